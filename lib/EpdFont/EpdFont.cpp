@@ -4,6 +4,11 @@
 
 #include <algorithm>
 
+#include "EpdFontFile.h"
+#include "EpdGlyphCache.h"
+
+EpdFont::EpdFont(EpdFontFile* file) : data(file->getData()), file(file) {}
+
 void EpdFont::getTextBounds(const char* string, const int startX, const int startY, int* minX, int* minY, int* maxX,
                             int* maxY) const {
   *minX = startX;
@@ -55,7 +60,104 @@ bool EpdFont::hasPrintableChars(const char* string) const {
   return w > 0 || h > 0;
 }
 
-const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
+namespace {
+constexpr uint32_t SOFT_HYPHEN = 0xAD;
+
+// Horizontal bounds of text measured so far, the way getTextBounds() tracks them from x = 0
+struct TextExtent {
+  int cursorX = 0;
+  int minX = 0;
+  int maxX = 0;
+
+  void add(const EpdGlyph* glyph) {
+    minX = std::min(minX, cursorX + glyph->left);
+    maxX = std::max(maxX, cursorX + glyph->left + glyph->width);
+    cursorX += glyph->advanceX;
+  }
+  int width() const { return maxX - minX; }
+};
+}  // namespace
+
+int EpdFont::measureText(const std::string_view text, const uint8_t flags, const int maxWidth, size_t* fitBytes,
+                         uint16_t* prefixWidths) const {
+  const auto glyphFor = [this](const uint32_t cp) {
+    const EpdGlyph* glyph = getGlyph(cp);
+    return glyph ? glyph : getGlyph(REPLACEMENT_GLYPH);
+  };
+  const EpdGlyph* suffixGlyph = (flags & MEASURE_APPEND_HYPHEN)     ? glyphFor('-')
+                                : (flags & MEASURE_APPEND_ELLIPSIS) ? glyphFor('.')
+                                                                    : nullptr;
+  const int suffixLength = !suffixGlyph ? 0 : (flags & MEASURE_APPEND_HYPHEN) ? 1 : 3;
+
+  TextExtent extent;
+  const auto widthWithSuffix = [&extent, suffixGlyph, suffixLength] {
+    TextExtent withSuffix = extent;
+    for (int i = 0; i < suffixLength; i++) {
+      withSuffix.add(suffixGlyph);
+    }
+    return withSuffix.width();
+  };
+  size_t fit = 0;
+  const auto measurePrefix = [&](const size_t length) {
+    const int width = widthWithSuffix();
+    if (width <= maxWidth) {
+      fit = length;
+    }
+    if (prefixWidths) {
+      prefixWidths[length] = std::min<int>(width, UINT16_MAX);
+    }
+  };
+
+  const bool byPrefix = fitBytes || prefixWidths;
+  if (byPrefix) {
+    measurePrefix(0);
+  }
+  const auto* begin = reinterpret_cast<const unsigned char*>(text.data());
+  const unsigned char* end = begin + text.size();
+  const unsigned char* next = begin;
+  size_t measured = 0;
+  bool stopped = false;
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(&next, end))) {
+    if (cp != SOFT_HYPHEN || !(flags & MEASURE_SKIP_SOFT_HYPHENS)) {
+      if (const EpdGlyph* glyph = glyphFor(cp)) {
+        extent.add(glyph);
+      }
+    }
+    if (extent.width() > maxWidth) {
+      stopped = true;
+      break;
+    }
+    if (byPrefix) {
+      if (prefixWidths) {
+        std::fill(prefixWidths + measured + 1, prefixWidths + (next - begin), UINT16_MAX);
+      }
+      measured = next - begin;
+      measurePrefix(measured);
+    }
+  }
+
+  if (prefixWidths) {
+    std::fill(prefixWidths + measured + 1, prefixWidths + text.size() + 1, UINT16_MAX);
+  }
+  if (fitBytes) {
+    *fitBytes = fit;
+  }
+  return stopped ? extent.width() : widthWithSuffix();
+}
+
+const EpdGlyph* EpdFont::findGlyph(const uint32_t cp) const {
+  if (data->glyphPages && cp >= EPD_FONT_DIRECT_GLYPHS) {
+    const uint32_t page = cp >> EPD_FONT_GLYPH_PAGE_SHIFT;
+    const uint16_t slot = page < data->glyphPageCount ? data->glyphPages[page] : 0;
+    if (slot == 0) {
+      return nullptr;
+    }
+    const uint32_t pageMask = (1u << EPD_FONT_GLYPH_PAGE_SHIFT) - 1;
+    const uint16_t index = data->pageGlyphs[(slot - 1) << EPD_FONT_GLYPH_PAGE_SHIFT | (cp & pageMask)];
+    return index ? &data->glyph[index - 1] : nullptr;
+  }
+
   const EpdUnicodeInterval* intervals = data->intervals;
   const int count = data->intervalCount;
 
@@ -82,3 +184,13 @@ const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
 
   return nullptr;
 }
+
+const uint8_t* EpdFont::getGlyphBitmap(const EpdGlyph* glyph, EpdGlyphCache* cache) const {
+  if (file) {
+    return file->getGlyphBitmap(glyph);
+  }
+  if (data->blockOffsets) {
+    return cache ? cache->get(data, glyph) : nullptr;
+  }
+  return &data->bitmap[glyph->dataOffset];
+}
@@ -1,15 +1,53 @@
 #pragma once
+#include <climits>
+#include <cstddef>
+#include <string_view>
+
 #include "EpdFontData.h"
 
+class EpdFontFile;
+class EpdGlyphCache;
+
 class EpdFont {
   void getTextBounds(const char* string, int startX, int startY, int* minX, int* minY, int* maxX, int* maxY) const;
 
  public:
   const EpdFontData* data;
   explicit EpdFont(const EpdFontData* data) : data(data) {}
+  // A font read from an .epdfont file, which must stay open while the font is in use
+  explicit EpdFont(EpdFontFile* file);
   ~EpdFont() = default;
   void getTextDimensions(const char* string, int* w, int* h) const;
   bool hasPrintableChars(const char* string) const;
 
-  const EpdGlyph* getGlyph(uint32_t cp) const;
+  enum MeasureFlags : uint8_t {
+    MEASURE_SKIP_SOFT_HYPHENS = 1,  // Leave U+00AD out, as it is only drawn where a word is broken
+    MEASURE_APPEND_HYPHEN = 2,      // Measure the text, and each prefix, with a '-' after it
+    MEASURE_APPEND_ELLIPSIS = 4,    // Same with "..."
+  };
+  // Width of text as getTextDimensions() measures it, without copying the text or needing it NUL-terminated. Also, in
+  // one pass: *fitBytes gets the length of the longest prefix ending on a code point that is at most maxWidth wide,
+  // and prefixWidths (text.size() + 1 entries) the width of every prefix ending on a code point, UINT16_MAX at other
+  // offsets. Appended text is measured after each prefix. Prefixes only grow wider, so measuring stops at the first
+  // one wider than maxWidth without the appended text: the width returned is then that prefix's, and prefixWidths
+  // are UINT16_MAX from there on.
+  int measureText(std::string_view text, uint8_t flags = 0, int maxWidth = INT_MAX, size_t* fitBytes = nullptr,
+                  uint16_t* prefixWidths = nullptr) const;
+
+  // Looked up in the font's tables if it has them, Basic Latin to Latin Extended-B without leaving the caller
+  const EpdGlyph* getGlyph(const uint32_t cp) const {
+    if (cp < EPD_FONT_DIRECT_GLYPHS && data->directGlyphs) {
+      const uint16_t index = data->directGlyphs[cp];
+      return index ? &data->glyph[index - 1] : nullptr;
+    }
+    return findGlyph(cp);
+  }
+  // Bitmap of a glyph of this font. For fonts read from a file it is valid until the next call for any glyph, for
+  // compressed fonts until the next call with the same cache, and compressed fonts have no bitmaps without one.
+  const uint8_t* getGlyphBitmap(const EpdGlyph* glyph, EpdGlyphCache* cache = nullptr) const;
+
+ private:
+  EpdFontFile* file = nullptr;
+
+  const EpdGlyph* findGlyph(uint32_t cp) const;
 };
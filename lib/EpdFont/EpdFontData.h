@@ -4,6 +4,14 @@
 #pragma once
 #include <cstdint>
 
+/// Bitmaps of fonts converted with fontconvert.py --compress are raw deflate streams of this many bytes of glyph data
+/// each, and no glyph's bitmap crosses from one block into the next
+constexpr uint32_t EPD_FONT_COMPRESSED_BLOCK_SIZE = 2048;
+/// Code points below this (Basic Latin up to Latin Extended-B) are looked up in EpdFontData::directGlyphs
+constexpr uint32_t EPD_FONT_DIRECT_GLYPHS = 0x250;
+/// Code points from EPD_FONT_DIRECT_GLYPHS up are looked up in pages of 1 << EPD_FONT_GLYPH_PAGE_SHIFT code points
+constexpr uint32_t EPD_FONT_GLYPH_PAGE_SHIFT = 8;
+
 /// Font data stored PER GLYPH
 typedef struct {
   uint8_t width;        ///< Bitmap dimensions in pixels
@@ -24,7 +32,7 @@ typedef struct {
 
 /// Data stored for FONT AS A WHOLE
 typedef struct {
-  const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated
+  const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated, or deflated blocks of them
   const EpdGlyph* glyph;                ///< Glyph array
   const EpdUnicodeInterval* intervals;  ///< Valid unicode intervals for this font
   uint32_t intervalCount;               ///< Number of unicode intervals.
@@ -32,4 +40,14 @@ typedef struct {
   int ascender;                         ///< Maximal height of a glyph above the base line
   int descender;                        ///< Maximal height of a glyph below the base line
   bool is2Bit;
+  /// Set for compressed fonts: block i covers glyph data offsets from i * EPD_FONT_COMPRESSED_BLOCK_SIZE and is
+  /// stored in bitmap[blockOffsets[i]] up to bitmap[blockOffsets[i + 1]]
+  const uint32_t* blockOffsets = nullptr;
+  /// Optional tables that find a glyph without searching the intervals. Entries are the glyph's index plus one, 0
+  /// where the font has none. directGlyphs is indexed by code point. Above that, glyphPages[cp >> page shift] is 0 or
+  /// one plus the page of pageGlyphs holding cp, for code points below glyphPageCount << page shift.
+  const uint16_t* directGlyphs = nullptr;
+  const uint16_t* glyphPages = nullptr;
+  uint32_t glyphPageCount = 0;
+  const uint16_t* pageGlyphs = nullptr;
 } EpdFontData;
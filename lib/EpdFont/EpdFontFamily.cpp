@@ -26,8 +26,17 @@ bool EpdFontFamily::hasPrintableChars(const char* string, const Style style) con
   return getFont(style)->hasPrintableChars(string);
 }
 
+int EpdFontFamily::measureText(const std::string_view text, const Style style, const uint8_t flags, const int maxWidth,
+                               size_t* fitBytes, uint16_t* prefixWidths) const {
+  return getFont(style)->measureText(text, flags, maxWidth, fitBytes, prefixWidths);
+}
+
 const EpdFontData* EpdFontFamily::getData(const Style style) const { return getFont(style)->data; }
 
 const EpdGlyph* EpdFontFamily::getGlyph(const uint32_t cp, const Style style) const {
   return getFont(style)->getGlyph(cp);
 };
+
+const uint8_t* EpdFontFamily::getGlyphBitmap(const EpdGlyph* glyph, const Style style, EpdGlyphCache* cache) const {
+  return getFont(style)->getGlyphBitmap(glyph, cache);
+}
@@ -11,8 +11,11 @@ class EpdFontFamily {
   ~EpdFontFamily() = default;
   void getTextDimensions(const char* string, int* w, int* h, Style style = REGULAR) const;
   bool hasPrintableChars(const char* string, Style style = REGULAR) const;
+  int measureText(std::string_view text, Style style = REGULAR, uint8_t flags = 0, int maxWidth = INT_MAX,
+                  size_t* fitBytes = nullptr, uint16_t* prefixWidths = nullptr) const;
   const EpdFontData* getData(Style style = REGULAR) const;
   const EpdGlyph* getGlyph(uint32_t cp, Style style = REGULAR) const;
+  const uint8_t* getGlyphBitmap(const EpdGlyph* glyph, Style style = REGULAR, EpdGlyphCache* cache = nullptr) const;
 
  private:
   const EpdFont* regular;
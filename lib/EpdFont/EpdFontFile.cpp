@@ -0,0 +1,180 @@
+#include "EpdFontFile.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+// The tables are read straight into these structs, so their layout must match the file's little-endian records
+static_assert(sizeof(EpdUnicodeInterval) == 12, "EpdUnicodeInterval does not match the .epdfont interval record");
+static_assert(sizeof(EpdGlyph) == 16 && offsetof(EpdGlyph, left) == 4 && offsetof(EpdGlyph, dataLength) == 8 &&
+                  offsetof(EpdGlyph, dataOffset) == 12,
+              "EpdGlyph does not match the .epdfont glyph record");
+
+namespace {
+constexpr int HEADER_SIZE = 28;
+constexpr uint16_t FLAG_2BIT = 0x0001;
+
+uint16_t le16(const uint8_t* p) { return p[0] | p[1] << 8; }
+uint32_t le32(const uint8_t* p) { return le16(p) | static_cast<uint32_t>(le16(p + 2)) << 16; }
+}  // namespace
+
+EpdFontFile::~EpdFontFile() { close(); }
+
+bool EpdFontFile::open(const std::string& path) {
+  close();
+  if (!Storage.openFileForRead("FNT", path, file)) {
+    return false;
+  }
+
+  uint8_t header[HEADER_SIZE];
+  if (file.read(header, HEADER_SIZE) != HEADER_SIZE || memcmp(header, "EPDF", 4) != 0 ||
+      le16(header + 4) != VERSION) {
+    Serial.printf("[%lu] [FNT] Not a version %u .epdfont file: %s\n", millis(), VERSION, path.c_str());
+    close();
+    return false;
+  }
+  const uint16_t pageSize = le16(header + 8);
+  const uint32_t intervalCount = le32(header + 16);
+  const uint32_t glyphCount = le32(header + 20);
+  bitmapSize = le32(header + 24);
+  bitmapStart = HEADER_SIZE + intervalCount * sizeof(EpdUnicodeInterval) + glyphCount * sizeof(EpdGlyph);
+  if (pageSize == 0 || (pageSize & (pageSize - 1)) != 0) {
+    Serial.printf("[%lu] [FNT] Bad page size %u: %s\n", millis(), pageSize, path.c_str());
+    close();
+    return false;
+  }
+  pageShift = __builtin_ctz(pageSize);
+
+  intervals = static_cast<EpdUnicodeInterval*>(malloc(intervalCount * sizeof(EpdUnicodeInterval)));
+  glyphs = static_cast<EpdGlyph*>(malloc(glyphCount * sizeof(EpdGlyph)));
+  pageData = static_cast<uint8_t*>(malloc(cachePages * pageSize));
+  slotPage = static_cast<uint32_t*>(malloc(cachePages * sizeof(uint32_t)));
+  slotLastUse = static_cast<uint32_t*>(malloc(cachePages * sizeof(uint32_t)));
+  if (!intervals || !glyphs || !pageData || !slotPage || !slotLastUse) {
+    Serial.printf("[%lu] [FNT] !! Not enough memory for %s\n", millis(), path.c_str());
+    close();
+    return false;
+  }
+
+  const int intervalBytes = intervalCount * sizeof(EpdUnicodeInterval);
+  const int glyphBytes = glyphCount * sizeof(EpdGlyph);
+  if (file.read(intervals, intervalBytes) != intervalBytes || file.read(glyphs, glyphBytes) != glyphBytes) {
+    Serial.printf("[%lu] [FNT] Truncated tables: %s\n", millis(), path.c_str());
+    close();
+    return false;
+  }
+
+  // Reject tables that point outside themselves, or at bitmaps across a page, rather than trust them while drawing
+  for (uint32_t i = 0; i < intervalCount; i++) {
+    if (intervals[i].last < intervals[i].first || intervals[i].offset + (intervals[i].last - intervals[i].first) >=
+                                                     glyphCount) {
+      Serial.printf("[%lu] [FNT] Bad interval %u: %s\n", millis(), i, path.c_str());
+      close();
+      return false;
+    }
+  }
+  for (uint32_t i = 0; i < glyphCount; i++) {
+    const EpdGlyph& glyph = glyphs[i];
+    const uint32_t end = glyph.dataOffset + glyph.dataLength;
+    if (glyph.dataLength > 0 && (end > bitmapSize || glyph.dataOffset >> pageShift != (end - 1) >> pageShift)) {
+      Serial.printf("[%lu] [FNT] Bad glyph %u: %s\n", millis(), i, path.c_str());
+      close();
+      return false;
+    }
+  }
+
+  // The direct glyph table takes 1.2KB and serves most lookups; code points above it are searched in the intervals
+  if (glyphCount < UINT16_MAX) {
+    directGlyphs = static_cast<uint16_t*>(calloc(EPD_FONT_DIRECT_GLYPHS, sizeof(uint16_t)));
+  }
+  if (directGlyphs) {
+    for (uint32_t i = 0; i < intervalCount; i++) {
+      const EpdUnicodeInterval& interval = intervals[i];
+      for (uint32_t cp = interval.first; cp <= interval.last && cp < EPD_FONT_DIRECT_GLYPHS; cp++) {
+        directGlyphs[cp] = interval.offset + (cp - interval.first) + 1;
+      }
+    }
+  }
+
+  for (int slot = 0; slot < cachePages; slot++) {
+    slotPage[slot] = NO_PAGE;
+    slotLastUse[slot] = 0;
+  }
+  data.bitmap = nullptr;
+  data.glyph = glyphs;
+  data.intervals = intervals;
+  data.intervalCount = intervalCount;
+  data.directGlyphs = directGlyphs;
+  data.advanceY = header[10];
+  data.ascender = static_cast<int16_t>(le16(header + 12));
+  data.descender = static_cast<int16_t>(le16(header + 14));
+  data.is2Bit = (le16(header + 6) & FLAG_2BIT) != 0;
+  return true;
+}
+
+void EpdFontFile::close() {
+  if (file) {
+    file.close();
+  }
+  free(intervals);
+  free(glyphs);
+  free(directGlyphs);
+  free(pageData);
+  free(slotPage);
+  free(slotLastUse);
+  intervals = nullptr;
+  glyphs = nullptr;
+  directGlyphs = nullptr;
+  pageData = nullptr;
+  slotPage = nullptr;
+  slotLastUse = nullptr;
+  data = {};
+  lastSlot = 0;
+  useClock = 0;
+}
+
+const uint8_t* EpdFontFile::getGlyphBitmap(const EpdGlyph* glyph) {
+  if (!glyph || glyph->dataLength == 0 || !glyphs) {
+    return nullptr;
+  }
+  const uint32_t page = glyph->dataOffset >> pageShift;
+  const uint32_t pageSize = 1u << pageShift;
+
+  // Runs of text mostly stay on one page, so the slot used last is tried before the others
+  int slot = lastSlot;
+  if (slotPage[slot] != page) {
+    slot = -1;
+    int oldest = 0;
+    for (int i = 0; i < cachePages; i++) {
+      if (slotPage[i] == page) {
+        slot = i;
+        break;
+      }
+      if (slotLastUse[i] < slotLastUse[oldest]) {
+        oldest = i;
+      }
+    }
+    if (slot < 0) {
+      slot = oldest;
+      uint8_t* dest = pageData + (slot << pageShift);
+      const uint32_t pageOffset = page << pageShift;
+      const int length = std::min(pageSize, bitmapSize - pageOffset);
+      if (!file.seek(bitmapStart + pageOffset) || file.read(dest, length) != length) {
+        Serial.printf("[%lu] [FNT] Failed to read glyph page %u\n", millis(), page);
+        slotPage[slot] = NO_PAGE;
+        return nullptr;
+      }
+      slotPage[slot] = page;
+      cacheMisses++;
+    } else {
+      cacheHits++;
+    }
+  } else {
+    cacheHits++;
+  }
+
+  slotLastUse[slot] = ++useClock;
+  lastSlot = slot;
+  return pageData + (slot << pageShift) + (glyph->dataOffset & (pageSize - 1));
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <string>
+
+#include "EpdFontData.h"
+
+// A font read from an .epdfont file on the SD card (see docs/file-formats.md), written by
+// scripts/fontconvert.py --epdfont. The interval and glyph tables are read into RAM when the file is opened; glyph
+// bitmaps stay on the card and are read a page at a time into a fixed number of cache slots, least recently used
+// first out. The converter never lets a glyph's bitmap cross a page, so one page read serves every glyph on it.
+class EpdFontFile {
+ public:
+  static constexpr uint16_t VERSION = 1;
+  static constexpr int DEFAULT_CACHE_PAGES = 8;
+
+  explicit EpdFontFile(int cachePages = DEFAULT_CACHE_PAGES) : cachePages(cachePages) {}
+  ~EpdFontFile();
+  EpdFontFile(const EpdFontFile&) = delete;
+  EpdFontFile& operator=(const EpdFontFile&) = delete;
+
+  bool open(const std::string& path);
+  void close();
+  bool isOpen() const { return glyphs != nullptr; }
+  // Metrics and tables as for a font built into the firmware, with no bitmap blob
+  const EpdFontData* getData() const { return &data; }
+  // The glyph's bitmap, valid until the next call; nullptr for empty glyphs or if the page can't be read
+  const uint8_t* getGlyphBitmap(const EpdGlyph* glyph);
+
+  uint32_t getCacheHits() const { return cacheHits; }
+  uint32_t getCacheMisses() const { return cacheMisses; }
+
+ private:
+  static constexpr uint32_t NO_PAGE = UINT32_MAX;
+
+  FsFile file;
+  EpdFontData data = {};
+  EpdUnicodeInterval* intervals = nullptr;
+  EpdGlyph* glyphs = nullptr;
+  uint16_t* directGlyphs = nullptr;
+  uint32_t bitmapStart = 0;
+  uint32_t bitmapSize = 0;
+  uint8_t pageShift = 0;
+
+  int cachePages;
+  uint8_t* pageData = nullptr;
+  uint32_t* slotPage = nullptr;
+  uint32_t* slotLastUse = nullptr;
+  int lastSlot = 0;
+  uint32_t useClock = 0;
+  uint32_t cacheHits = 0;
+  uint32_t cacheMisses = 0;
+};
@@ -0,0 +1,109 @@
+#include "EpdGlyphCache.h"
+
+#include <HardwareSerial.h>
+#include <miniz.h>
+
+#include <cstdlib>
+#include <cstring>
+
+EpdGlyphCache::~EpdGlyphCache() { clear(); }
+
+bool EpdGlyphCache::allocate() {
+  slots = static_cast<Slot*>(calloc(sets * WAYS, sizeof(Slot)));
+  inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+  blockBuffer = static_cast<uint8_t*>(malloc(EPD_FONT_COMPRESSED_BLOCK_SIZE));
+  if (!slots || !inflator || !blockBuffer) {
+    Serial.printf("[%lu] [FNT] !! Not enough memory for the glyph cache\n", millis());
+    clear();
+    return false;
+  }
+  allocatedBytes = sets * WAYS * sizeof(Slot) + sizeof(tinfl_decompressor) + EPD_FONT_COMPRESSED_BLOCK_SIZE;
+  return true;
+}
+
+void EpdGlyphCache::clear() {
+  if (slots) {
+    for (int i = 0; i < sets * WAYS; i++) {
+      free(slots[i].data);
+    }
+  }
+  free(slots);
+  free(inflator);
+  free(blockBuffer);
+  slots = nullptr;
+  inflator = nullptr;
+  blockBuffer = nullptr;
+  bufferedFont = nullptr;
+  allocatedBytes = 0;
+}
+
+// Inflates the block until at least length bytes of it are in blockBuffer, carrying on from where the last call for
+// the same block stopped
+bool EpdGlyphCache::inflateTo(const EpdFontData* font, const uint32_t block, const uint32_t length) {
+  if (bufferedFont != font || bufferedBlock != block) {
+    memset(inflator, 0, sizeof(tinfl_decompressor));
+    tinfl_init(inflator);
+    bufferedFont = font;
+    bufferedBlock = block;
+    bufferedBytes = 0;
+    consumedBytes = 0;
+  }
+  if (length <= bufferedBytes) {
+    return true;
+  }
+
+  const uint32_t blockStart = font->blockOffsets[block];
+  size_t inBytes = font->blockOffsets[block + 1] - blockStart - consumedBytes;
+  size_t outBytes = length - bufferedBytes;
+  const tinfl_status status =
+      tinfl_decompress(inflator, font->bitmap + blockStart + consumedBytes, &inBytes, blockBuffer,
+                       blockBuffer + bufferedBytes, &outBytes, TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+  consumedBytes += inBytes;
+  bufferedBytes += outBytes;
+  if (status < 0 || bufferedBytes < length) {
+    Serial.printf("[%lu] [FNT] tinfl_decompress() failed with status %d on glyph block %u\n", millis(), status, block);
+    bufferedFont = nullptr;
+    return false;
+  }
+  return true;
+}
+
+const uint8_t* EpdGlyphCache::get(const EpdFontData* font, const EpdGlyph* glyph) {
+  if (!glyph || glyph->dataLength == 0 || !font->blockOffsets || (!slots && !allocate())) {
+    return nullptr;
+  }
+
+  Slot* set = slots + (reinterpret_cast<uintptr_t>(glyph) / sizeof(EpdGlyph) & (sets - 1)) * WAYS;
+  Slot* victim = set;
+  for (int way = 0; way < WAYS; way++) {
+    if (set[way].glyph == glyph) {
+      hits++;
+      set[way].lastUse = ++useClock;
+      return set[way].data;
+    }
+    if (set[way].lastUse < victim->lastUse) {
+      victim = &set[way];
+    }
+  }
+
+  misses++;
+  const uint32_t block = glyph->dataOffset / EPD_FONT_COMPRESSED_BLOCK_SIZE;
+  const uint32_t start = glyph->dataOffset % EPD_FONT_COMPRESSED_BLOCK_SIZE;
+  if (!inflateTo(font, block, start + glyph->dataLength)) {
+    return nullptr;
+  }
+  if (victim->capacity < glyph->dataLength) {
+    uint8_t* data = static_cast<uint8_t*>(realloc(victim->data, glyph->dataLength));
+    if (!data) {
+      Serial.printf("[%lu] [FNT] !! Not enough memory to cache a glyph\n", millis());
+      return nullptr;
+    }
+    allocatedBytes += glyph->dataLength - victim->capacity;
+    victim->data = data;
+    victim->capacity = glyph->dataLength;
+  }
+  memcpy(victim->data, blockBuffer + start, glyph->dataLength);
+  victim->glyph = glyph;
+  victim->lastUse = ++useClock;
+  return victim->data;
+}
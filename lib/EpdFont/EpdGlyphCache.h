@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "EpdFontData.h"
+
+struct tinfl_decompressor_tag;
+
+// Inflated bitmaps of glyphs from compressed fonts (see EpdFontData::blockOffsets). A glyph entry belongs to one font
+// and code point, so entries are looked up by glyph: its address picks a set of WAYS slots, and a miss replaces the
+// least recently used of them. A miss inflates the glyph's block only as far as the glyph's last byte, and the
+// inflated part is kept so that later misses in the same block are a copy or carry on from there. A font must not
+// be freed while its glyphs are cached.
+class EpdGlyphCache {
+ public:
+  static constexpr int WAYS = 4;
+  static constexpr int DEFAULT_SETS = 32;
+
+  // sets must be a power of two; nothing is allocated until the first glyph is looked up
+  explicit EpdGlyphCache(int sets = DEFAULT_SETS) : sets(sets) {}
+  ~EpdGlyphCache();
+  EpdGlyphCache(const EpdGlyphCache&) = delete;
+  EpdGlyphCache& operator=(const EpdGlyphCache&) = delete;
+
+  // The glyph's bitmap, valid until the next call; nullptr for empty glyphs or if it can't be inflated
+  const uint8_t* get(const EpdFontData* font, const EpdGlyph* glyph);
+  // Frees the inflated glyphs and the inflator, such as before work that needs the heap
+  void clear();
+
+  uint32_t getHits() const { return hits; }
+  uint32_t getMisses() const { return misses; }
+  // Heap held for slots, inflated glyphs, the inflator and its block buffer
+  size_t getAllocatedBytes() const { return allocatedBytes; }
+
+ private:
+  struct Slot {
+    const EpdGlyph* glyph;
+    uint8_t* data;
+    uint16_t capacity;
+    uint32_t lastUse;
+  };
+
+  bool allocate();
+  bool inflateTo(const EpdFontData* font, uint32_t block, uint32_t length);
+
+  int sets;
+  Slot* slots = nullptr;
+  tinfl_decompressor_tag* inflator = nullptr;
+  uint8_t* blockBuffer = nullptr;
+  // Block held in blockBuffer, how much of it has been inflated and from how many compressed bytes
+  const EpdFontData* bufferedFont = nullptr;
+  uint32_t bufferedBlock = 0;
+  uint32_t bufferedBytes = 0;
+  uint32_t consumedBytes = 0;
+  uint32_t useClock = 0;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  size_t allocatedBytes = 0;
+};
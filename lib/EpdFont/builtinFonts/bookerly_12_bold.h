@@ -2,3259 +2,1913 @@
  * generated by fontconvert.py
  * name: bookerly_12_bold
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_12_bold 12 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_12_bold 12 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_boldBitmaps[51922] = {
-    0x0A, 0x83, 0xFC, 0x3F, 0x87, 0xF4, 0x7F, 0x43, 0xF4, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
-    0x03, 0xF0, 0x2F, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x2F, 0xC3, 0xFC, 0x3F, 0xC0, 0x50, 0x7E, 0x1F,
-    0x7F, 0x8F, 0xDF, 0xD3, 0xF3, 0xF4, 0xFC, 0xFD, 0x3F, 0x2F, 0x0F, 0xCB, 0xC3, 0xF2, 0xE0, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x3F, 0x07, 0xD0, 0x00,
-    0x3E, 0x0B, 0xC0, 0x05, 0xBE, 0x5F, 0xD4, 0x1F, 0xFF, 0xFF, 0xFC, 0x1A, 0xFE, 0xBF, 0xE8, 0x00,
-    0xF8, 0x2F, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xD0, 0xFC, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x0F,
-    0x82, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x7E, 0x40, 0x01, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0xFC, 0xF1, 0xF8, 0x7D, 0x3C,
-    0x3D, 0x1F, 0x8F, 0x05, 0x07, 0xFB, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0x00, 0x03, 0xFF, 0xD0, 0x80, 0xF3, 0xFC, 0xF4, 0x3C, 0x7F, 0x3E, 0x0E, 0x1F, 0x8F, 0xE7,
-    0x9F, 0xC2, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x1E, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xDB, 0xE0, 0x07, 0xD0, 0x00,
-    0xBD, 0x0F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x0F, 0x80,
-    0x00, 0x3F, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0xFC, 0x0F, 0xC3, 0xD0, 0x00, 0x02, 0xF4, 0x7E, 0x2F,
-    0x0B, 0xFD, 0x03, 0xFF, 0xF0, 0xF4, 0xFE, 0xFD, 0x02, 0xFE, 0x0F, 0x87, 0xD0, 0xFC, 0x00, 0x00,
-    0x7C, 0x2F, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0xFC, 0x0B, 0xC0, 0x00, 0x2F, 0x03, 0xF0, 0x2F, 0x00,
-    0x00, 0xF8, 0x0F, 0xC0, 0xFC, 0x00, 0x0B, 0xC0, 0x2F, 0x43, 0xE0, 0x00, 0x7D, 0x00, 0x3F, 0xBF,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00,
-    0x01, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0xFD, 0x3D, 0x00, 0x00, 0x00, 0xFE, 0x20, 0x00, 0x00, 0x02,
-    0xFF, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0xC1, 0xFF, 0xF0, 0x2F, 0xCF, 0xE0, 0x3F, 0x00, 0x3F, 0x47,
-    0xF8, 0x2F, 0x00, 0x3F, 0x02, 0xFE, 0x2F, 0x00, 0x3F, 0x40, 0xBF, 0xFF, 0x00, 0x3F, 0x80, 0x2F,
-    0xFE, 0x00, 0x2F, 0xE0, 0x0F, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0x5F,
-    0xFC, 0x00, 0x05, 0x50, 0x00, 0x50, 0x7E, 0xFE, 0xFD, 0xFD, 0xFD, 0xBC, 0xBC, 0xB8, 0x00, 0x00,
-    0x28, 0x00, 0xBD, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0x1F, 0xC0, 0x3F, 0x40, 0x3F, 0x00, 0x7E,
-    0x00, 0xBE, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x7F,
-    0x00, 0x3F, 0x40, 0x2F, 0x80, 0x0F, 0xD0, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3C, 0x00,
-    0x00, 0x1C, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0F,
-    0xD0, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F,
-    0xD0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x0F, 0xD0, 0x07, 0xF0,
-    0x03, 0xF4, 0x03, 0xF4, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x47, 0xC0, 0x3D,
-    0x7C, 0x03, 0xFB, 0x44, 0x0B, 0xFF, 0xC1, 0xBF, 0xFC, 0x3F, 0xB4, 0x42, 0xC7, 0xC0, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x6A,
-    0xFE, 0xA8, 0xBF, 0xFF, 0xFD, 0xAA, 0xFE, 0xA8, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x3F, 0xC0, 0xBF, 0x01, 0xFC, 0x0B, 0xD0,
-    0x3F, 0x02, 0xF4, 0x0F, 0x40, 0x24, 0x00, 0x2F, 0xFF, 0x4F, 0xFF, 0xE3, 0xFF, 0xF4, 0x19, 0x1F,
-    0xEB, 0xFD, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00,
-    0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xF8, 0x01, 0xFF, 0x6F, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x7F, 0x40, 0x2F, 0xD3, 0xFC, 0x00, 0x7F,
-    0x8F, 0xF0, 0x01, 0xFE, 0x3F, 0xC0, 0x03, 0xFC, 0xFE, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x3F, 0x8F,
-    0xF0, 0x01, 0xFE, 0x3F, 0xC0, 0x07, 0xF4, 0xFF, 0x00, 0x3F, 0xC1, 0xFE, 0x01, 0xFE, 0x03, 0xFE,
-    0x6F, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x1B, 0xFF, 0x40, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xA4, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x1F, 0xFF, 0xFD, 0x03, 0xFE,
-    0x6F, 0xF0, 0x7F, 0x40, 0xFF, 0x47, 0xF0, 0x0B, 0xF4, 0x3F, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x00, 0x01, 0xBF, 0xFD, 0x02, 0xFF, 0xFF, 0xD0, 0xFF, 0x5B, 0xFC,
-    0x3E, 0x00, 0xBF, 0x07, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x01, 0xBF, 0xF0,
-    0x00, 0xFF, 0xFF, 0x40, 0x1E, 0x6F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F,
-    0xD0, 0x00, 0x2F, 0xF0, 0x05, 0xBF, 0xF4, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xE0, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0xFC, 0xBF,
-    0x00, 0x03, 0xF4, 0xBF, 0x00, 0x0B, 0xE0, 0xBF, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x3F, 0xAA, 0xFF,
-    0xA8, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x05, 0x55, 0xBF, 0x54, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x01, 0x5B, 0xFF, 0x80, 0x00, 0x1F,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x05, 0xBF,
-    0xF0, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFE, 0x40, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFE, 0xBF, 0xF0, 0xBF, 0x40,
-    0xBF, 0x8B, 0xF4, 0x03, 0xFC, 0x7F, 0x40, 0x3F, 0xC7, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x82,
-    0xFF, 0x9F, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x3F, 0x43,
-    0xD0, 0x0F, 0xE0, 0x18, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x01, 0xFE, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF8, 0x2F, 0xD0, 0xBF, 0x00, 0xFF, 0xAF, 0xD0, 0x07, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFF, 0x80, 0x0F, 0xEB, 0xFF, 0x03, 0xF8, 0x0F, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0,
-    0x03, 0xFC, 0xBF, 0x40, 0x3F, 0xC3, 0xFD, 0x5F, 0xF4, 0x2F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x02, 0xFE,
-    0x6F, 0xF0, 0x3F, 0x80, 0xBF, 0x87, 0xF4, 0x03, 0xFC, 0x7F, 0x40, 0x3F, 0xC7, 0xF8, 0x03, 0xFC,
-    0x3F, 0xC0, 0x2F, 0xC2, 0xFF, 0x9B, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x03,
-    0xFF, 0xD0, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0x6F, 0xFB, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x47, 0xFA, 0xFF, 0x7F, 0x81, 0x40, 0x0B, 0xD0, 0x7F, 0xC1, 0xFF, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x02, 0xFC, 0x07, 0xF0,
-    0x2F, 0x40, 0xFC, 0x0B, 0xD0, 0x3D, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x07, 0xFC, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xF4,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x6A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0xBF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFC,
-    0x00, 0xBF, 0xD0, 0x1F, 0xFD, 0x00, 0x7F, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x24, 0x1F, 0xD0, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x6F, 0xF0, 0x2F, 0xFF, 0x40, 0xFF, 0xF4, 0x03, 0xFD, 0x00,
-    0x0B, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xD0,
-    0x00, 0xBF, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xF9, 0x55, 0xBF, 0xD0, 0x02, 0xFE, 0x00,
-    0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0x0B, 0xE0,
-    0x3F, 0xFF, 0x00, 0xBD, 0x3F, 0x02, 0xF0, 0xBD, 0x01, 0xF5, 0xFC, 0x07, 0x81, 0xF8, 0x07, 0xEB,
-    0xE0, 0x00, 0x07, 0xE0, 0x1F, 0xAF, 0x40, 0x0B, 0xFF, 0x80, 0xBD, 0xFD, 0x01, 0xFD, 0xBE, 0x03,
-    0xF2, 0xF4, 0x0F, 0xC1, 0xF8, 0x0F, 0x8B, 0xE0, 0x3F, 0x4B, 0xF5, 0xFC, 0x1F, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0x00, 0xBF, 0x4B, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0xEA, 0xAF, 0xF8, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F,
-    0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x05, 0x6A, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFC, 0x03, 0xF0, 0x03, 0xFC, 0x07,
-    0xF0, 0x03, 0xFC, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x1B,
-    0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x03,
-    0xFC, 0x03, 0xFD, 0x6F, 0xF8, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x03, 0xFD, 0x00, 0xFC,
-    0x2F, 0xD0, 0x03, 0xF0, 0xFF, 0x00, 0x0B, 0x87, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x80, 0x01, 0x47, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x6A, 0xA9, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x01, 0xBF, 0xF0, 0x03, 0xFC, 0x00, 0x7F,
-    0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x03,
-    0xFC, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xF8,
-    0x00, 0xFF, 0x9A, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC,
-    0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x15, 0x55, 0x55, 0x53,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0x7F, 0x03, 0xFC, 0x02, 0xF0, 0x3F, 0xC0,
-    0x1D, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0xAA, 0x80, 0x3F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xBF, 0x90, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xF4, 0x03, 0xF4, 0x2F, 0xE0, 0x00, 0xBD,
-    0x0F, 0xF0, 0x00, 0x1F, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x01, 0x55, 0x4F, 0xF0, 0x03, 0xFF, 0xF7, 0xFD, 0x00, 0x7F, 0xFC, 0xBF, 0x80,
-    0x00, 0xFF, 0x1F, 0xF4, 0x00, 0x3F, 0xC3, 0xFF, 0x40, 0x0F, 0xF0, 0x7F, 0xFE, 0xAF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x15, 0x40, 0x00, 0x15, 0x55, 0x40, 0x55,
-    0x55, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE2, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x2F,
-    0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xEA, 0xAA, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4,
-    0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFF, 0xD0, 0xBF, 0xFF, 0x8F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE0, 0x15, 0x55, 0x43, 0xFF, 0xFD,
-    0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x01, 0x55, 0x54, 0x07, 0xFF, 0xFD, 0x03, 0xFF,
-    0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0xBF,
-    0x80, 0x00, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x40, 0x55, 0x50, 0xFF, 0xFF, 0x0F, 0xFF, 0xD2, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xFF,
-    0x00, 0x7F, 0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xF4,
-    0x00, 0x00, 0xFF, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xDF, 0xF0, 0x00, 0x00, 0xFF, 0x2F, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xF0,
-    0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xF4, 0x2F, 0xFF, 0xC0, 0x7F,
-    0xF8, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x15, 0x55, 0x40, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3C, 0x03,
-    0xFC, 0x00, 0x7D, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x01, 0x55, 0x40, 0x01, 0x55, 0x50, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x07,
-    0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF,
-    0x00, 0x01, 0xFB, 0xF4, 0x1F, 0xBF, 0x40, 0x01, 0xF7, 0xF8, 0x2F, 0x3F, 0x40, 0x02, 0xF6, 0xFC,
-    0x3E, 0x3F, 0x40, 0x02, 0xF1, 0xFC, 0x3D, 0x3F, 0x80, 0x02, 0xF0, 0xFD, 0x7C, 0x3F, 0x80, 0x03,
-    0xF0, 0xBF, 0xF8, 0x3F, 0xC0, 0x03, 0xF0, 0x7F, 0xF4, 0x3F, 0xC0, 0x03, 0xF0, 0x3F, 0xF0, 0x2F,
-    0xC0, 0x03, 0xF0, 0x2F, 0xE0, 0x2F, 0xC0, 0x07, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x07, 0xE0, 0x0F,
-    0xC0, 0x2F, 0xD0, 0x3F, 0xFE, 0x06, 0x40, 0xFF, 0xFC, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x15,
-    0x54, 0x00, 0x15, 0x55, 0x1F, 0xFF, 0x40, 0x2F, 0xFF, 0xC2, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x0F,
-    0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xD0, 0x07, 0xF0, 0x00, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x3F,
-    0xFF, 0x80, 0x7F, 0x00, 0x0F, 0xDF, 0xF4, 0x1F, 0xC0, 0x03, 0xF2, 0xFF, 0x07, 0xF0, 0x00, 0xFC,
-    0x3F, 0xF1, 0xFC, 0x00, 0x3F, 0x03, 0xFE, 0x7F, 0x00, 0x0F, 0xC0, 0xBF, 0xDF, 0xC0, 0x03, 0xF0,
-    0x0F, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xC0,
-    0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0x80,
-    0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD,
-    0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xC7, 0xFC, 0x00,
-    0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x05, 0x6A, 0xA9, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x03, 0xFC, 0x1F, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03,
-    0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x1F, 0xF4, 0x03, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFE, 0x90, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFE, 0x01, 0xFF, 0xC0, 0x2F, 0xD0, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x02, 0xFF, 0x07, 0xF8, 0x00,
-    0x03, 0xFD, 0x2F, 0xD0, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xFF,
-    0x4F, 0xF4, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xC1, 0xFF,
-    0x40, 0x02, 0xFD, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFF, 0x96, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x05, 0x6A, 0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x6F, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x6F,
-    0xA4, 0x01, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0xFC, 0x7F, 0x40, 0x3F, 0x1F, 0xE0,
-    0x0B, 0x47, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x28, 0x00, 0xFF, 0x6F, 0x00, 0x1F, 0xDB, 0xD0, 0x0B, 0xF2, 0xFE,
-    0x07, 0xF8, 0xBF, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x00, 0x15, 0x50, 0x00, 0x15, 0x55, 0x55, 0x55,
-    0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF4, 0x7F, 0xC1, 0xFC, 0x3E, 0x03,
-    0xFC, 0x0F, 0xC3, 0xD0, 0x3F, 0xC0, 0xF8, 0x04, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x15, 0x55, 0x40,
-    0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC,
-    0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55,
-    0x54, 0xBF, 0xFF, 0xC0, 0xFF, 0xFC, 0x7F, 0xFF, 0x40, 0xBF, 0xF4, 0x0F, 0xFC, 0x00, 0x1F, 0xC0,
-    0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0x00, 0x7F, 0x00, 0x00,
-    0xFF, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0xFC, 0x00, 0x00, 0x7F, 0xC2, 0xFC, 0x00, 0x00, 0x3F,
-    0xC3, 0xF4, 0x00, 0x00, 0x2F, 0xD3, 0xF0, 0x00, 0x00, 0x0F, 0xEB, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x55, 0x54, 0x7F, 0xFF, 0xC0, 0x7F, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x40, 0xBF, 0x00, 0x7F, 0xF8,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xD0, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xC0, 0x03, 0xFD,
-    0x02, 0xFF, 0xC0, 0x2F, 0x80, 0x02, 0xFE, 0x03, 0xFF, 0xD0, 0x3F, 0x40, 0x01, 0xFF, 0x03, 0xFF,
-    0xE0, 0x3F, 0x00, 0x00, 0xFF, 0x07, 0xEF, 0xF0, 0x7E, 0x00, 0x00, 0xBF, 0x4B, 0xCB, 0xF0, 0xBD,
-    0x00, 0x00, 0x7F, 0x8F, 0xC7, 0xF4, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0x83, 0xFC, 0xF8, 0x00, 0x00,
-    0x2F, 0xDF, 0x02, 0xFD, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x40, 0x55, 0x50, 0xFF, 0xFF, 0x4B, 0xFF, 0xD2, 0xFF, 0xF8, 0x1B, 0xFE, 0x00, 0xFF,
-    0xC0, 0x2F, 0xC0, 0x00, 0xFF, 0x81, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xD0, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xF8, 0x00, 0x03, 0xF8,
-    0x1F, 0xF4, 0x00, 0x2F, 0xC0, 0x2F, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xF0, 0x7F, 0xFF, 0x07, 0xFF,
-    0xFE, 0xFF, 0xFC, 0x2F, 0xFF, 0xF0, 0x15, 0x55, 0x01, 0x55, 0x4B, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F,
-    0xFE, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xE0, 0x03, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x3F,
-    0x40, 0x00, 0xFF, 0x47, 0xE0, 0x00, 0x03, 0xFC, 0xFC, 0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x05, 0x55, 0x55, 0x40, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xD0, 0x0F, 0xF8, 0x3E, 0x00, 0xBF, 0xC0, 0x74, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x70, 0x3F, 0xE0, 0x03, 0xE2, 0xFF, 0x00, 0x1F, 0x8F,
-    0xFA, 0xAA, 0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0xA1, 0xFF, 0xD7, 0xFA, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
-    0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0,
-    0x1F, 0x80, 0x7E, 0x01, 0xFD, 0x47, 0xFF, 0x5F, 0xFC, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x6A, 0xAF, 0xFF, 0x6B, 0xF0, 0x7F,
-    0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07,
-    0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF1, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xEF, 0x80, 0x01, 0xF3, 0xF0, 0x00, 0xFC,
-    0x7D, 0x00, 0x3E, 0x0F, 0xC0, 0x2F, 0x02, 0xF0, 0x0F, 0xC0, 0x7E, 0x07, 0xD0, 0x0F, 0xC3, 0xF0,
-    0x02, 0xF4, 0xA4, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x18,
-    0x03, 0xD0, 0x3F, 0x41, 0xFC, 0x07, 0xE0, 0x08, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5,
-    0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x15, 0x00, 0x03, 0xFD, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xAF, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x02,
-    0xFE, 0x03, 0xFC, 0x01, 0xFE, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x03,
-    0xFC, 0x03, 0xFD, 0x1F, 0xF4, 0x03, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD3, 0xFC, 0x1F, 0xD0,
-    0x7F, 0x0F, 0xF0, 0x0E, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xFA, 0xAC, 0x0B, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x05, 0x6F, 0xD0, 0x00, 0xBF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x2F, 0xD0, 0x1F, 0xD0, 0x2F, 0xD0, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x3F, 0xE0, 0x2F, 0xD0, 0x2F, 0xFA, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF,
-    0x8F, 0xFD, 0x00, 0x14, 0x01, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0,
-    0x3F, 0x82, 0xFD, 0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x0F, 0xE3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE,
-    0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE9, 0x6D, 0x0F, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFC, 0x07, 0xF8, 0x7E, 0x02, 0xFC, 0x02, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0xF4, 0x16, 0xFF, 0x54, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0x40, 0x50, 0x07, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0x83, 0xF8, 0x1F, 0xC4, 0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFE, 0x00, 0xFD,
-    0x03, 0xF4, 0x02, 0xFE, 0xBF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0x40, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF5, 0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC2, 0xFE, 0xAA, 0xFF,
-    0x1F, 0xD0, 0x02, 0xFC, 0x7F, 0x40, 0x1F, 0xE0, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xE4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x01, 0x50,
-    0x00, 0x2F, 0xDB, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0xBF, 0x80,
-    0xBF, 0x40, 0x2F, 0xD0, 0x1F, 0xD0, 0x0B, 0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0xBF,
-    0x40, 0x7F, 0x40, 0x2F, 0xD0, 0x1F, 0xD0, 0x0B, 0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD, 0x02,
-    0xFF, 0xD1, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF, 0xFC, 0x00, 0x40, 0x01, 0xFD, 0x00, 0xBF, 0xC0, 0x2F,
-    0xE0, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x7F, 0xF8, 0x02, 0xFE, 0x00, 0x7F,
-    0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE,
-    0x02, 0xFF, 0xF4, 0xFF, 0xFD, 0x00, 0x04, 0x00, 0x2F, 0xC0, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0xFC, 0x0F, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0,
-    0x02, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x3F, 0xD0, 0x7F, 0xE0, 0x7F, 0xF0, 0x0B, 0x90, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0xF8,
-    0x0B, 0xF0, 0x7F, 0xF4, 0x0B, 0xF0, 0x3F, 0x80, 0x0B, 0xF0, 0xFE, 0x00, 0x0B, 0xF2, 0xF8, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x0B, 0xFB, 0xF8, 0x00, 0x0B, 0xF2, 0xFD, 0x00, 0x0B, 0xF0, 0xFF, 0x00,
-    0x0B, 0xF0, 0x7F, 0xC0, 0x0B, 0xF0, 0x2F, 0xF0, 0x2F, 0xFD, 0x0F, 0xFC, 0x7F, 0xFE, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x1B, 0xFD, 0x0F, 0xFF, 0x40, 0x7F, 0xD0, 0x0B, 0xF4, 0x02,
-    0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B,
-    0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x07, 0xFF, 0xF2, 0xFF,
-    0xFC, 0x00, 0x50, 0x15, 0x00, 0x15, 0x00, 0x0B, 0xFC, 0xBF, 0xF4, 0x7F, 0xF4, 0x07, 0xFF, 0xFF,
-    0xFF, 0xBF, 0xFF, 0x00, 0x6F, 0xFE, 0xBF, 0xFE, 0xBF, 0xD0, 0x07, 0xF8, 0x0B, 0xFC, 0x0B, 0xF8,
-    0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x1F, 0xE0, 0x1F,
-    0xE0, 0x1F, 0xE0, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x00,
-    0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x2F, 0xFE, 0x1F, 0xFE,
-    0x1F, 0xFF, 0x0F, 0xFF, 0x8B, 0xFF, 0x8B, 0xFF, 0xD0, 0x00, 0x50, 0x15, 0x00, 0x0B, 0xFC, 0xBF,
-    0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x6F, 0xFE, 0xBF, 0xE0, 0x07, 0xF8, 0x07, 0xF8, 0x01, 0xFE,
-    0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01,
-    0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0, 0x2F, 0xFE, 0x0F, 0xFF,
-    0x4F, 0xFF, 0xC7, 0xFF, 0xD0, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC,
-    0x03, 0xFD, 0x1F, 0xF4, 0x1F, 0xD0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F,
-    0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFE, 0x01, 0xFE, 0x07, 0xFE,
-    0x1F, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x40,
-    0x14, 0x01, 0xFF, 0x9F, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xAF, 0xFC, 0x0B, 0xF4, 0x0F,
-    0xF4, 0x2F, 0xC0, 0x2F, 0xE0, 0xBF, 0x00, 0x7F, 0x82, 0xFC, 0x01, 0xFE, 0x0B, 0xF0, 0x07, 0xF8,
-    0x2F, 0xC0, 0x1F, 0xD0, 0xBF, 0x00, 0xFF, 0x02, 0xFE, 0x5B, 0xF8, 0x0B, 0xFF, 0xFF, 0x80, 0x2F,
-    0xFF, 0xF4, 0x00, 0xBF, 0x54, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x1A, 0xAA, 0x80, 0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFD, 0x1F, 0xF4, 0x1F, 0xD0, 0x2F, 0xD0, 0xFF, 0x00, 0xBF, 0x43,
-    0xFC, 0x02, 0xFD, 0x0F, 0xF0, 0x0B, 0xF4, 0x3F, 0xC0, 0x2F, 0xD0, 0xFF, 0x00, 0xBF, 0x43, 0xFE,
-    0x03, 0xFD, 0x07, 0xFF, 0xBF, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFE, 0xBF, 0x40, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0xAA, 0xA9, 0x00, 0x50, 0x14, 0x2F, 0xF1, 0xFD, 0xBF, 0xF7, 0xFD, 0x1B, 0xFF, 0xFC,
-    0x07, 0xFD, 0x04, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07,
-    0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0xC0, 0x00, 0x55,
-    0x00, 0x1F, 0xFF, 0x82, 0xFE, 0xFF, 0x0F, 0xC0, 0x7D, 0x7F, 0x00, 0xF1, 0xFF, 0x80, 0x03, 0xFF,
-    0xF4, 0x03, 0xFF, 0xF8, 0x02, 0xFF, 0xF4, 0x40, 0x7F, 0xEB, 0x80, 0x3F, 0xBF, 0x40, 0xFD, 0xBF,
-    0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x17, 0xFD, 0x50, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFF, 0xAC, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFF, 0x0B, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x2F, 0xFA, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0xFF, 0xC0, 0x01, 0x50, 0x14, 0x00, 0x7F, 0xFF,
-    0x0F, 0xFF, 0x0F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80, 0x1F, 0xF0, 0x0F, 0xC0, 0x03,
-    0xFC, 0x07, 0xE0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0xBD, 0x00,
-    0x00, 0x7F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x07, 0xD0, 0xBF, 0xF0,
-    0xFF, 0xF4, 0x2F, 0x81, 0xFF, 0xC0, 0xFF, 0x00, 0xFF, 0x00, 0xFC, 0x02, 0xFC, 0x07, 0xFC, 0x07,
-    0xD0, 0x03, 0xF8, 0x2F, 0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0xFF, 0xE0, 0xFC, 0x00, 0x2F, 0xC3, 0xDF,
-    0xC7, 0xD0, 0x00, 0x3F, 0x6E, 0x3F, 0x2F, 0x00, 0x00, 0xFE, 0xF4, 0xBD, 0xF8, 0x00, 0x01, 0xFF,
-    0xC1, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x0B, 0xF8, 0x00, 0x00,
-    0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x3F,
-    0xF8, 0x1F, 0xF4, 0x07, 0xFC, 0x1F, 0xC0, 0x02, 0xFE, 0x3F, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBE, 0xFE, 0x00, 0x02,
-    0xF8, 0xBF, 0x40, 0x0B, 0xF0, 0x3F, 0xD0, 0x3F, 0xF4, 0x7F, 0xFC, 0xBF, 0xF8, 0xFF, 0xFC, 0x7F,
-    0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0,
-    0x03, 0xFC, 0x07, 0xE0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0xBD,
-    0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xC3, 0xF5, 0x7F, 0xE0, 0xF4, 0x1F, 0xE0, 0x18, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0x07, 0xFC, 0x03,
-    0xD3, 0xFE, 0x56, 0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0xFF, 0xD0, 0xBF, 0x50, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x2F, 0x80,
-    0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00, 0x7E, 0x00,
-    0x1F, 0x80, 0x0B, 0xE0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00,
-    0x3F, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
-    0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x3F, 0x80,
-    0x1F, 0xFC, 0x01, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0xBF, 0x40, 0x7F, 0x40, 0x2F, 0x40,
-    0x0B, 0xD0, 0x02, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFE, 0x07,
-    0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x01, 0x07, 0xFF, 0x42, 0xE3, 0xFF, 0xFE,
-    0xF8, 0xF4, 0x7F, 0xFC, 0x1C, 0x02, 0xF8, 0x00, 0x05, 0x03, 0xFC, 0x3F, 0xD2, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFD, 0x0F, 0xD0, 0xFD, 0x0F, 0xD0, 0xFE,
-    0x1F, 0xE1, 0xFD, 0x2F, 0xC1, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE,
-    0x1F, 0xD7, 0x4F, 0xCF, 0xD2, 0xD2, 0xD3, 0xF0, 0xB4, 0x11, 0xFC, 0x2C, 0x00, 0x7F, 0x0B, 0x00,
-    0x1F, 0xC2, 0xC0, 0x07, 0xF0, 0xB0, 0x00, 0xFE, 0x3C, 0x00, 0x3F, 0xEF, 0x5B, 0x83, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0x40, 0x0B, 0xF0, 0xBF, 0x00, 0x3F, 0x40, 0xFC, 0x01, 0xFC, 0x03, 0xC0, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x05, 0xFF, 0x55, 0x00, 0xBF, 0xFF, 0xFC, 0x01, 0xAF, 0xFA,
-    0x90, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0A, 0xFE, 0xAA, 0xBD, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xC0, 0x90, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x50, 0x38, 0xBE, 0xBF, 0xEF, 0xC1, 0xFF, 0xFF, 0xF0, 0x0B, 0xE1,
-    0xFD, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0xD0, 0xFD, 0x01,
-    0xFF, 0xFF, 0xF0, 0xBE, 0xFF, 0xEF, 0xC3, 0x81, 0x50, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xC1, 0xFF, 0xF3, 0xFF, 0xE0, 0x7F, 0xF4, 0x2F, 0xE0, 0x03, 0xF0, 0x03,
-    0xFC, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x0F, 0xF0, 0x7D, 0x00, 0x00, 0xFD, 0x3F, 0x00,
-    0x03, 0xFF, 0xDF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xAF, 0xFA,
-    0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBD, 0xBD, 0xBD, 0xBD,
-    0xBD, 0xBD, 0xBD, 0xBD, 0x69, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
-    0xBD, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x1F, 0x40,
-    0x7C, 0x2F, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x3D, 0xFF, 0x00, 0x3C, 0x7F, 0xE0, 0x3E, 0x0B, 0xF8,
-    0x1F, 0x80, 0xFD, 0x0B, 0xF4, 0x2E, 0x02, 0xFF, 0x0F, 0x00, 0x7F, 0xCF, 0x00, 0x0B, 0xFF, 0x09,
-    0x00, 0xFE, 0x3F, 0x00, 0xBC, 0x3F, 0x40, 0xF8, 0x2F, 0xFF, 0xE0, 0x0B, 0xFF, 0x40, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x7E, 0x3F, 0x8F, 0xF3, 0xF4, 0xBE, 0x04, 0x01, 0x40, 0x00, 0x01,
-    0xA9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0x01,
-    0xE0, 0x0F, 0x00, 0xAA, 0x41, 0xD0, 0x74, 0x1F, 0xFF, 0x02, 0xC3, 0xC0, 0xF4, 0x3C, 0x07, 0x4E,
-    0x0B, 0xC0, 0x90, 0x0E, 0x34, 0x3E, 0x00, 0x00, 0x38, 0xD0, 0xF8, 0x00, 0x00, 0xF3, 0x43, 0xE0,
-    0x00, 0x03, 0x8E, 0x0B, 0xC0, 0x00, 0x0E, 0x2C, 0x1F, 0xEA, 0xC0, 0x74, 0x74, 0x1F, 0xFE, 0x03,
-    0xC0, 0xF0, 0x05, 0x40, 0x2D, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xF9, 0x00, 0x7D, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0A, 0xE0, 0x0F, 0xFF, 0x07, 0xC3, 0xC0,
-    0x00, 0xF4, 0x1B, 0xFD, 0x1F, 0x5F, 0x4B, 0x83, 0xD2, 0xFF, 0xFF, 0x2F, 0x8F, 0x40, 0x00, 0x02,
-    0xAA, 0xB6, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x3D, 0x02, 0xF8,
-    0x1F, 0xC0, 0xBF, 0x07, 0xF0, 0x3F, 0xC2, 0xFD, 0x03, 0xF4, 0x3F, 0x80, 0x3F, 0xC2, 0xFC, 0x00,
-    0xFE, 0x0B, 0xF0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA,
-    0xA8, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x14, 0x2F, 0xFF, 0x4F, 0xFF, 0xE3, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x07, 0x80, 0x1F, 0x00, 0xD5, 0x50, 0x38, 0x28, 0xBE, 0xD0, 0xC3, 0x43, 0x8F, 0x0E, 0x30,
-    0x39, 0xD0, 0xA3, 0x03, 0xF8, 0x0B, 0x30, 0x3A, 0xD0, 0xA3, 0x87, 0xDF, 0x4D, 0x1C, 0x54, 0x26,
-    0xC0, 0xB0, 0x00, 0x74, 0x02, 0xE5, 0xBD, 0x00, 0x01, 0xA9, 0x00, 0x7F, 0xFF, 0xAF, 0xFF, 0xE1,
-    0x55, 0x50, 0x00, 0x50, 0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xD0, 0xFC, 0xFC, 0x0B, 0xCF, 0x80,
-    0xBC, 0xBD, 0x0F, 0xC7, 0xFF, 0xF4, 0x1F, 0xFD, 0x00, 0x15, 0x00, 0x00, 0x68, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x55, 0xBD, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x14, 0x00, 0x15,
-    0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x94, 0x02, 0xFF, 0xF0,
-    0x7F, 0xBF, 0x8B, 0xC1, 0xF8, 0x28, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F,
-    0xC0, 0x07, 0xFA, 0xA8, 0xBF, 0xFF, 0xC2, 0xAA, 0xA4, 0x01, 0x94, 0x0B, 0xFF, 0xC7, 0xE7, 0xF4,
-    0xD0, 0xBD, 0x00, 0x7F, 0x01, 0xFF, 0x00, 0xBF, 0xF0, 0x00, 0xBE, 0x00, 0x1F, 0x80, 0x6F, 0xDB,
-    0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x03, 0xE2, 0xF5, 0xFC, 0xBC, 0x08, 0x00, 0x00,
-    0x40, 0x00, 0x40, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-    0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-    0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xF6, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xEB, 0xFE, 0x7F, 0xFF, 0x83, 0xFC, 0x7F, 0x14, 0x00, 0x50, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF9, 0x0B, 0xFF, 0xD7, 0xC0, 0x3F, 0xFF,
-    0x5F, 0x01, 0xFF, 0xFD, 0x7C, 0x0B, 0xFF, 0xF5, 0xF0, 0x2F, 0xFF, 0xD7, 0xC0, 0x7F, 0xFF, 0x5F,
-    0x00, 0xFF, 0xFD, 0x7C, 0x01, 0xFF, 0xF5, 0xF0, 0x01, 0xFB, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00,
-    0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xE0, 0x00, 0x03, 0xC6, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x2F, 0x2F, 0xFB, 0xFC, 0xFD, 0x00, 0x00, 0x2E, 0x2F, 0xE0, 0xFC, 0x3D, 0x7E, 0x09,
-    0x00, 0x00, 0x10, 0x01, 0xFD, 0x03, 0xFF, 0x40, 0x6F, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F,
-    0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x03, 0xFF, 0xF4, 0xAA, 0xA8, 0x06, 0xF8, 0x0B, 0xFF,
-    0xC7, 0xC1, 0xFB, 0xE0, 0x3F, 0xF8, 0x0B, 0xFF, 0x02, 0xFB, 0xC0, 0xF4, 0xFF, 0xFC, 0x0B, 0xF8,
-    0x00, 0x00, 0x01, 0xAA, 0xB0, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x01, 0xF0,
-    0x07, 0xF0, 0x3F, 0x40, 0xBF, 0x07, 0xF4, 0x0B, 0xF4, 0x7F, 0x80, 0xFE, 0x0B, 0xF0, 0xBF, 0x47,
-    0xF8, 0x7F, 0x43, 0xF8, 0x3F, 0x03, 0xF4, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xF4,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x07, 0xC0, 0x1F, 0xD0, 0x02,
-    0xF4, 0x00, 0xF8, 0x03, 0xFD, 0x02, 0xFF, 0xF4, 0x1F, 0x00, 0xFB, 0xD0, 0x3F, 0xFF, 0x43, 0xE0,
-    0x2F, 0x3D, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0xF4, 0x3D, 0x00,
-    0x00, 0x03, 0xF0, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x02,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xBC, 0x1F, 0xFD, 0x00,
-    0xBD, 0x00, 0x3D, 0x1F, 0xFF, 0xC0, 0x2F, 0x40, 0x2F, 0x0F, 0xC3, 0xF4, 0xBF, 0xFD, 0x0F, 0x42,
-    0xE0, 0xBD, 0x3F, 0xFF, 0x4F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x00,
-    0x03, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x7F,
-    0x55, 0x40, 0x00, 0xBC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFB,
-    0xF4, 0x00, 0x1F, 0x40, 0x00, 0x74, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBC,
-    0x00, 0x00, 0x06, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0x01,
-    0x2F, 0x80, 0x3E, 0x00, 0x7D, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0xF4,
-    0x03, 0xFD, 0x07, 0xFF, 0xE0, 0x2F, 0x00, 0xFB, 0xD0, 0x7F, 0xF4, 0x07, 0xD0, 0x2F, 0x3D, 0x00,
-    0x50, 0x00, 0xF8, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0xFF, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x02, 0xF0, 0x01, 0xBF, 0x00, 0xFF, 0xF0, 0x3F, 0xFE, 0x0B,
-    0xF9, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x18, 0x1F, 0xFF, 0xD0, 0xBF,
-    0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0,
-    0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07,
-    0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F,
-    0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F,
-    0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x00, 0x2C, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0,
-    0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00,
-    0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0,
-    0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x05, 0x40,
-    0x40, 0x00, 0x00, 0x1F, 0xF2, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x2C, 0x3F, 0xC0,
-    0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F,
-    0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00,
-    0x7F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x15, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0,
-    0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00,
-    0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0,
-    0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x00, 0x0F, 0x07, 0x80,
-    0x00, 0x00, 0x0F, 0x8B, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F,
-    0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03,
-    0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0,
-    0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x55, 0x55, 0x55, 0x54,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFF, 0x05, 0xFC, 0x00, 0x00, 0x3F, 0x7F, 0xC0, 0x2F, 0x00, 0x00, 0x1F, 0x8F, 0xF0, 0x02, 0x00,
-    0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0xFF, 0xF4, 0x00, 0x02, 0xF4, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFE, 0xAA, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x05, 0x00, 0x3F, 0x00, 0x0F, 0xF0,
-    0x03, 0xD0, 0x2F, 0x80, 0x03, 0xFC, 0x01, 0xF4, 0x0F, 0xD0, 0x01, 0xFF, 0xAA, 0xFD, 0x2F, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFE, 0x40, 0x02,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x03, 0xFD, 0x00, 0xFC, 0x2F, 0xD0, 0x03, 0xF0, 0xFF, 0x00,
-    0x0B, 0x87, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0x80, 0x01, 0x47, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA,
-    0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00,
-    0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00,
-    0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00,
-    0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00,
-    0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x02, 0xFD, 0x3F,
-    0xC0, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00,
-    0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x2F, 0xC0, 0x01, 0xFF, 0x40, 0x07,
-    0xFD, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x55, 0x54, 0x3F, 0xFF, 0xD2, 0xFF, 0xF8, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x02, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x03, 0xFE,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x3F, 0xFF, 0xD2, 0xFF, 0xF8, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x02, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0x00, 0xBD, 0xFC, 0x2F, 0x03, 0xE2,
-    0x80, 0x08, 0x00, 0x00, 0x01, 0x55, 0x54, 0x3F, 0xFF, 0xD2, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x02, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x7D, 0x7F, 0x4F, 0xF7, 0xF4, 0xFE, 0x14, 0x01, 0x40, 0x00,
-    0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x05, 0x6A,
-    0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x01, 0xBF,
-    0xF0, 0x03, 0xFC, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x03, 0xFD, 0x6B, 0xFE, 0xA4, 0x0F, 0xF5, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x3F, 0xD0,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x9A, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x40, 0x00, 0x00, 0x03,
-    0xFD, 0x3C, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x38, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x01, 0x55, 0x51, 0xFF, 0xF4,
-    0x02, 0xFF, 0xFC, 0x2F, 0xFF, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0xFD,
-    0x00, 0x7F, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xC0, 0x03, 0xFF, 0xF8, 0x07, 0xF0, 0x00, 0xFD, 0xFF,
-    0x41, 0xFC, 0x00, 0x3F, 0x2F, 0xF0, 0x7F, 0x00, 0x0F, 0xC3, 0xFF, 0x1F, 0xC0, 0x03, 0xF0, 0x3F,
-    0xE7, 0xF0, 0x00, 0xFC, 0x0B, 0xFD, 0xFC, 0x00, 0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x0F,
-    0xFF, 0xC0, 0x03, 0xF0, 0x01, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xF0, 0x03,
-    0xFF, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA4,
-    0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x07, 0xFF, 0x02, 0xFD,
-    0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0xBF, 0xC7, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x3F,
-    0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x80,
-    0x00, 0x3F, 0xCB, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0x43, 0xFF, 0x00, 0x1F, 0xF0,
-    0x1F, 0xFE, 0x5B, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xF8, 0x07, 0xFF, 0x02, 0xFD, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0xBF, 0xC7, 0xF8, 0x00, 0x03,
-    0xFD, 0xBF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4,
-    0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCB, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0xBF,
-    0x43, 0xFF, 0x00, 0x1F, 0xF0, 0x1F, 0xFE, 0x5B, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFA, 0xF8, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x07, 0x80,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x07, 0xFF, 0x02, 0xFD, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00,
-    0xBF, 0xC7, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF,
-    0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCB, 0xFC, 0x00, 0x03,
-    0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0x43, 0xFF, 0x00, 0x1F, 0xF0, 0x1F, 0xFE, 0x5B, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
-    0x00, 0x03, 0xFD, 0x3C, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x03, 0x8B, 0xF4, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00,
-    0x0B, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF,
-    0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00,
-    0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x00,
-    0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC,
-    0x00, 0x0B, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F,
-    0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0,
-    0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x04, 0x00,
-    0x10, 0xB8, 0x03, 0xD3, 0xF8, 0x3F, 0x83, 0xFB, 0xF8, 0x03, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F,
-    0xF8, 0x03, 0xFB, 0xF8, 0x3F, 0x83, 0xF8, 0xF8, 0x03, 0xD0, 0x80, 0x05, 0x00, 0x00, 0x01, 0xBF,
-    0x90, 0x20, 0x00, 0x2F, 0xFF, 0xFD, 0xBC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x01, 0xFF,
-    0xD0, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0xBF, 0xF0, 0x1F, 0xE0, 0x02, 0xFF, 0xF4,
-    0x2F, 0xD0, 0x0B, 0xCF, 0xF4, 0x3F, 0xD0, 0x2F, 0x0F, 0xF4, 0x3F, 0xD0, 0xBC, 0x0F, 0xF4, 0x3F,
-    0xD2, 0xF0, 0x0F, 0xF4, 0x3F, 0xEB, 0xC0, 0x0F, 0xF0, 0x2F, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFC,
-    0x00, 0x2F, 0xD0, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0x96, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7C, 0x2F, 0xFF, 0xE0, 0x00, 0x10, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00,
-    0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x0A, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40,
-    0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF,
-    0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x2F, 0xC3, 0xF8,
-    0x00, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F,
-    0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x50, 0x15, 0x54, 0xBF, 0xFF, 0x87, 0xFF, 0xE7, 0xFF, 0xE0, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0xFE,
-    0x00, 0x3F, 0xD0, 0x1F, 0xC0, 0x01, 0xFF, 0x03, 0xF4, 0x00, 0x0F, 0xF4, 0x7E, 0x00, 0x00, 0x3F,
-    0xCF, 0xC0, 0x00, 0x02, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x15, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x1F, 0xFC, 0x03, 0xFC, 0x03, 0xFC,
-    0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x07, 0xF8,
-    0x03, 0xFD, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x94, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xFD, 0x0B, 0xF4, 0x03, 0xF8, 0x03, 0xF4, 0x07, 0xF4, 0x03, 0xF4,
-    0x0B, 0xF0, 0x07, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x0B, 0xF0, 0xBD, 0x00, 0x0B, 0xF0, 0xFC, 0x00,
-    0x0B, 0xF0, 0xFE, 0x00, 0x0B, 0xF0, 0xFF, 0xC0, 0x0B, 0xF0, 0x7F, 0xF0, 0x0B, 0xF0, 0x1F, 0xFC,
-    0x0B, 0xF0, 0x03, 0xFE, 0x0B, 0xF0, 0x00, 0xFF, 0x0B, 0xF1, 0xC0, 0xFE, 0x0B, 0xF3, 0xE0, 0xFD,
-    0x7F, 0xF3, 0xFF, 0xFC, 0xBF, 0xF1, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F,
-    0x47, 0xFC, 0x07, 0xF0, 0x3F, 0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC,
-    0x03, 0xFF, 0xBF, 0xC0, 0xBF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xF8, 0xFF, 0x40, 0x14, 0x01, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07,
-    0xF0, 0x3F, 0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF,
-    0xC0, 0xBF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xF8, 0xFF, 0x40, 0x14, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x3E, 0xBC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07, 0xF0, 0x3F, 0xC0,
-    0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF, 0xC0, 0xBF, 0x03,
-    0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xF8, 0xFF, 0x40,
-    0x14, 0x01, 0x40, 0x02, 0x80, 0x40, 0x00, 0xFF, 0x4F, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xE1, 0xFD,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5,
-    0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x3F, 0x00, 0x2F, 0xC7, 0xF4, 0x02, 0xFC, 0x7F, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0,
-    0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB,
-    0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2,
-    0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0x83,
-    0xC0, 0x00, 0x78, 0x3C, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07, 0xF0, 0x3F,
-    0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF, 0xC0, 0xBF,
-    0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xF8, 0xFF,
-    0x40, 0x14, 0x01, 0x40, 0x00, 0x15, 0x00, 0x14, 0x00, 0x1F, 0xFF, 0x1F, 0xFF, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xD1, 0xFF, 0x82, 0xFD, 0x7F, 0x03, 0xFC, 0x03, 0xF8, 0x54, 0x0F, 0xE0, 0x1F,
-    0xF0, 0x01, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xA9, 0x3F, 0xE7, 0xF8, 0x00, 0x02, 0xFC,
-    0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD5, 0xFF, 0xF9, 0xAE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0xBF, 0xF8, 0x2F, 0xFF, 0x40, 0x14, 0x00, 0x05, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x2F, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD3, 0xFC, 0x1F, 0xD0, 0x7F, 0x0F, 0xF0, 0x0E, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x7F, 0xFA, 0xAC, 0x0B, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00, 0xFE, 0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4, 0x3F,
-    0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00, 0xFE,
-    0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4, 0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0xF4,
-    0x7C, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00, 0xFE, 0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4, 0x3F,
-    0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x40,
-    0x7F, 0x4F, 0xE0, 0x0F, 0xC3, 0xF4, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x03, 0xF8, 0x2F, 0xD1, 0xFC, 0x03, 0xF8, 0xFE, 0x00, 0xFE,
-    0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x07, 0xFE, 0x96, 0xD0, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x08, 0x00,
-    0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x1F, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80,
-    0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0xBF, 0xFD, 0x3F, 0xFF, 0x40, 0x00, 0x24,
-    0x00, 0x0F, 0x40, 0x0F, 0xD0, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x1F, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80,
-    0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0xBF, 0xFD, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x7F, 0xC0, 0x3D, 0xFC, 0x3E, 0x0F, 0x8F, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x1F, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80,
-    0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0xBF, 0xFD, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0x07, 0xD1, 0xF8, 0xFF, 0x2F, 0xCF, 0xE2, 0xFC, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x7F, 0xF8, 0x00, 0xBF, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F,
-    0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0x43, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x70, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x03, 0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0xFF, 0x47, 0xFE, 0x07, 0xF4, 0x0B, 0xFC, 0x3F, 0xC0, 0x0F,
-    0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0,
-    0xBF, 0x80, 0x7F, 0x41, 0xFF, 0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x0F, 0xF5, 0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x50,
-    0x00, 0xBF, 0xCB, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xEB, 0xFE, 0x00, 0x7F, 0x80,
-    0x7F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F,
-    0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x02,
-    0xFF, 0xE0, 0xFF, 0xF4, 0xFF, 0xFC, 0x7F, 0xFD, 0x00, 0x20, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x47,
-    0xFD, 0x07, 0xF4, 0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF,
-    0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x80, 0x7F, 0x81, 0xFF, 0x87, 0xFC, 0x02,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0xFF, 0x47, 0xFD, 0x07, 0xF4, 0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x80, 0x7F, 0x81, 0xFF,
-    0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0x7F, 0x00, 0x00, 0xF8, 0x3E,
-    0x00, 0x03, 0xC0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x47, 0xFD, 0x07, 0xF4, 0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x80,
-    0x7F, 0x81, 0xFF, 0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x28, 0x04, 0x00, 0x03, 0xFC, 0x78, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x74, 0xBF, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xD1, 0xFF, 0x41, 0xFD, 0x01, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0,
-    0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xE0, 0x1F,
-    0xE0, 0x7F, 0xE1, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xD1, 0xF8, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0xFE, 0x2F, 0xC0, 0x00,
-    0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xD1, 0xFF, 0x41, 0xFD, 0x01, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F,
-    0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xE0, 0x1F, 0xE0,
-    0x7F, 0xE1, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x6A, 0xAA,
-    0xA8, 0xBF, 0xFF, 0xFD, 0x6A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xFA, 0xC0, 0x3F, 0xFF,
-    0xFF, 0x03, 0xFC, 0x1F, 0xF4, 0x1F, 0xD0, 0x2F, 0xF0, 0xFF, 0x02, 0xFF, 0xC3, 0xFC, 0x2F, 0xFF,
-    0x0F, 0xF2, 0xF2, 0xFC, 0x3F, 0xEF, 0x0F, 0xF0, 0xFF, 0xF0, 0x3F, 0xC2, 0xFF, 0x00, 0xFE, 0x07,
-    0xFD, 0x0F, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0xF7, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBD, 0xF4, 0x00, 0x00, 0x7D, 0x2F, 0x00,
-    0x00, 0x2D, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B,
-    0xD0, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0xBF, 0xF0, 0xBF, 0xF0, 0x07,
-    0xFC, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F,
-    0xF0, 0x02, 0xFF, 0xAF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x8F, 0xFC, 0x00, 0x15,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40,
-    0x2F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xE0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F,
-    0xE0, 0xFC, 0x00, 0x02, 0xFC, 0xBD, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x01, 0x40,
-    0x02, 0xFD, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0xFF, 0xC0, 0xBF, 0x40, 0xFF, 0x42,
-    0xFC, 0x02, 0xFE, 0x0B, 0xF0, 0x07, 0xF8, 0x2F, 0xC0, 0x1F, 0xE0, 0xBF, 0x00, 0x7F, 0x82, 0xFC,
-    0x01, 0xFD, 0x0B, 0xF0, 0x0F, 0xF0, 0x2F, 0xE5, 0xBF, 0x80, 0xBF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF,
-    0x40, 0x0B, 0xF5, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0x40, 0x01, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x3F, 0xFC, 0x7F, 0xFE, 0x0B, 0xFE, 0x03, 0xFD,
-    0x00, 0xBE, 0x00, 0x7F, 0x80, 0x3F, 0x00, 0x0F, 0xF0, 0x1F, 0x80, 0x02, 0xFD, 0x0F, 0xD0, 0x00,
-    0x3F, 0x83, 0xF0, 0x00, 0x0B, 0xF2, 0xF4, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F,
-    0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03,
-    0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0,
-    0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5,
-    0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x08, 0x00,
-    0x40, 0x00, 0x00, 0x3E, 0x01, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F,
-    0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x1F, 0xD6, 0xE0, 0x00,
-    0xBF, 0xFC, 0x00, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00,
-    0x17, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC,
-    0x0F, 0xF5, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F,
-    0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC,
-    0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF,
-    0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF,
-    0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00,
-    0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF,
-    0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x1F, 0xE8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xC0, 0xFF, 0x40, 0x3F, 0x0B, 0xF4, 0x00, 0xFC, 0x3F, 0xC0, 0x02, 0xE1, 0xFD, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x51,
-    0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0x40, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0x80,
-    0xFF, 0x4F, 0xF0, 0x7F, 0x41, 0xFC, 0x3F, 0xC0, 0x38, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0xEA, 0xB0, 0x2F, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0xBD, 0x0F, 0xC0, 0x01, 0xD0, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0x40, 0x3F,
-    0x0B, 0xF4, 0x00, 0xFC, 0x3F, 0xC0, 0x02, 0xE1, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0x02, 0xF7, 0xD0, 0x01, 0xF4, 0xBC, 0x00, 0xB4, 0x0B, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0x4F, 0xF0, 0x7F, 0x41, 0xFC,
-    0x3F, 0xC0, 0x38, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x0B, 0xFC, 0x00, 0x01, 0xFF, 0xEA, 0xB0, 0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0x0F, 0xC2, 0xFD, 0x00, 0x3F, 0x0F, 0xF0, 0x00, 0xB8, 0x7F, 0x40,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x14,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0x03, 0xFD, 0x3F, 0xC1,
-    0xFD, 0x07, 0xF0, 0xFF, 0x00, 0xE0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFF, 0xAA, 0xC0, 0xBF, 0xFF, 0xF0, 0x07, 0xFF, 0xF4,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x0F, 0xC2, 0xF4, 0x00,
-    0x1F, 0xEF, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0x40, 0x3F, 0x0B, 0xF4, 0x00,
-    0xFC, 0x3F, 0xC0, 0x02, 0xE1, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x40, 0x14, 0x00, 0xF4, 0x2F, 0x00, 0x3F, 0x1F, 0x40,
-    0x03, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0x4F, 0xF0, 0x7F, 0x41, 0xFC, 0x3F, 0xC0, 0x38,
-    0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x00,
-    0x01, 0xFF, 0xEA, 0xB0, 0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x1F, 0x00, 0x00, 0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0x80,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x5A, 0xAA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0,
-    0x6F, 0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xF4, 0x03, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xE6, 0xBF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
-    0x1B, 0xFD, 0x2F, 0x00, 0x03, 0xFF, 0xD2, 0xF0, 0x00, 0x07, 0xFD, 0x3E, 0x00, 0x00, 0x2F, 0xD3,
-    0xC0, 0x00, 0x02, 0xFD, 0x38, 0x00, 0x05, 0x6F, 0xD1, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0x42, 0xFD, 0x00, 0x1F, 0xD0, 0x2F, 0xD0, 0x03, 0xFC, 0x02, 0xFD, 0x00,
-    0x3F, 0xC0, 0x2F, 0xD0, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x03, 0xFC, 0x02,
-    0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xD0, 0x02, 0xFF, 0xAF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xF8, 0xFF, 0xD0, 0x00, 0x14, 0x01, 0x00, 0x00, 0x05, 0x6A, 0xA9, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x01, 0xBF, 0xF0, 0x03, 0xFC, 0x00, 0x7F,
-    0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x6B,
-    0xFE, 0xA4, 0x0F, 0xF5, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xF8,
-    0x00, 0xFF, 0x9A, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x6F, 0xD0, 0x00, 0x06, 0xBF, 0xE9, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x2B, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x1F, 0xE0, 0x2F, 0xD0,
-    0x2F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0,
-    0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xE0, 0x2F, 0xD0, 0x2F, 0xFA, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x03, 0xFF, 0x8F, 0xFD, 0x00, 0x14, 0x01, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C,
-    0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10,
-    0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x82, 0xFD, 0x1F, 0xC0,
-    0x3F, 0x8F, 0xE0, 0x0F, 0xE3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE9, 0x6D, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00,
-    0x54, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0xF4, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC,
-    0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC,
-    0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x03, 0x40, 0x3F, 0x9B, 0xC0, 0x07, 0xFF, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x03,
-    0xF8, 0x2F, 0xD1, 0xFC, 0x03, 0xF8, 0xFE, 0x00, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3,
-    0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x96, 0xD0, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03,
-    0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0x03, 0xF8, 0x2F, 0xD1, 0xFC, 0x03, 0xF8, 0xFE, 0x00, 0xFE, 0x3F, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE,
-    0x96, 0xD0, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x15, 0x55, 0x55, 0x54,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C,
-    0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10,
-    0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x05, 0x40, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x82, 0xFD, 0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x0F, 0xE3,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x7F, 0xE9, 0x6D, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x0B, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xFE, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x0B, 0x40, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0xBE, 0xBC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00,
-    0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00,
-    0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x40, 0x14, 0x00, 0xF4, 0x2F, 0x00, 0x2F, 0x1F, 0x40, 0x03, 0xFF, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00, 0xFE, 0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4, 0x3F,
-    0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0x0A,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xD0, 0x0F, 0xD0, 0xBF, 0x80, 0x02, 0xF4, 0x3F, 0xC0, 0x00, 0x7C,
-    0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x05,
-    0x55, 0x3F, 0xC0, 0x0F, 0xFF, 0xDF, 0xF4, 0x01, 0xFF, 0xF2, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xD0,
-    0x00, 0xFF, 0x0F, 0xFD, 0x00, 0x3F, 0xC1, 0xFF, 0xFA, 0xBF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x01, 0xF4, 0x7C, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x14, 0x01, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0xFE, 0x07,
-    0xF1, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x00, 0xBF, 0xAF, 0xF0,
-    0x00, 0xFF, 0xFF, 0x00, 0x07, 0xEA, 0x90, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x50, 0x03,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0xBF, 0xAA, 0xBF, 0xC7, 0xF4, 0x00, 0xBF, 0x1F, 0xD0,
-    0x07, 0xF8, 0x3F, 0xFA, 0xFF, 0xC0, 0xBF, 0xFF, 0xF8, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x40, 0x00, 0x0F, 0x40, 0xB4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40, 0x3F, 0x42, 0xFE, 0x00, 0x0B, 0xD0, 0xFF, 0x00, 0x01,
-    0xF0, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x15, 0x54, 0xFF, 0x00, 0x3F, 0xFF, 0x7F, 0xD0, 0x07, 0xFF, 0xCB, 0xF8, 0x00, 0x0F, 0xF1, 0xFF,
-    0x40, 0x03, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0x07, 0xFF, 0xEA, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x30,
-    0x00, 0x3F, 0x9B, 0xC0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x05, 0x00, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0x81, 0xFC, 0x40, 0xFD,
-    0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0x2F, 0xEB, 0xFC, 0x00, 0x3F, 0xFF,
-    0xC0, 0x01, 0xFA, 0xA4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFD,
-    0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xEA, 0xAF, 0xF1, 0xFD, 0x00, 0x2F, 0xC7, 0xF4, 0x01, 0xFE, 0x0F,
-    0xFE, 0xBF, 0xF0, 0x2F, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0x40, 0x3F, 0x42, 0xFE, 0x00, 0x0B, 0xD0, 0xFF, 0x00, 0x01, 0xF0, 0x7F, 0x80,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x15, 0x54, 0xFF,
-    0x00, 0x3F, 0xFF, 0x7F, 0xD0, 0x07, 0xFF, 0xCB, 0xF8, 0x00, 0x0F, 0xF1, 0xFF, 0x40, 0x03, 0xFC,
-    0x3F, 0xF4, 0x00, 0xFF, 0x07, 0xFF, 0xEA, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x05,
-    0x00, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0x81, 0xFC, 0x40, 0xFD, 0x03, 0xF4, 0x03,
-    0xF0, 0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0x2F, 0xEB, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFA,
-    0xA4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xEA, 0xAF, 0xF1, 0xFD, 0x00, 0x2F, 0xC7, 0xF4, 0x01, 0xFE, 0x0F, 0xFE, 0xBF, 0xF0,
-    0x2F, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x06, 0xBF, 0x90, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xF4, 0x03, 0xF4, 0x2F, 0xE0, 0x00, 0xBD, 0x0F, 0xF0, 0x00,
-    0x1F, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x01, 0x55, 0x4F, 0xF0, 0x03, 0xFF, 0xF7, 0xFD, 0x00, 0x7F, 0xFC, 0xBF, 0x80, 0x00, 0xFF, 0x1F,
-    0xF4, 0x00, 0x3F, 0xC3, 0xFF, 0x40, 0x0F, 0xF0, 0x7F, 0xFE, 0xAF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x50, 0x07, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x83, 0xF8, 0x1F, 0xC4,
-    0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x02, 0xFE, 0xBF, 0xC0, 0x03,
-    0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF5, 0x55, 0x40, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC2, 0xFE, 0xAA, 0xFF, 0x1F, 0xD0, 0x02, 0xFC, 0x7F, 0x40, 0x1F,
-    0xE0, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xEB, 0xE0,
-    0x00, 0x00, 0x07, 0xE0, 0xBC, 0x00, 0x00, 0x01, 0xE0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x01, 0x55, 0x54, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF, 0x8B, 0xFF, 0xE0, 0x2F, 0xFF,
-    0x80, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4,
-    0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xAA, 0xAB, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40,
-    0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00,
-    0x3F, 0xD0, 0x00, 0xFF, 0x80, 0xBF, 0xFF, 0x42, 0xFF, 0xFE, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFD, 0xFC,
-    0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
-    0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x05, 0x40, 0x00, 0x2F, 0xDB, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFE, 0xFF, 0xC0, 0x02, 0xFE, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x1F,
-    0xD0, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x1F, 0xD0, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0x2F,
-    0xD0, 0x1F, 0xD0, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x1F, 0xD0, 0x0B, 0xFF, 0x47, 0xFF,
-    0xC1, 0xFF, 0xF8, 0xFF, 0xFC, 0x15, 0x55, 0x40, 0x55, 0x55, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE2,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x17, 0xFE, 0x55, 0x5F, 0xF9, 0x5F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xEA, 0xAA, 0xFF, 0x40, 0x0F,
-    0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F,
-    0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xD0, 0xBF, 0xFF, 0x8F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x6F, 0xFA, 0x80, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x2F, 0xC1, 0xB9, 0x00, 0x0B, 0xFB, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xD1, 0xFF, 0x40, 0x2F, 0xD0, 0x2F, 0xD0, 0x0B, 0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD, 0x00,
-    0xBF, 0x40, 0x7F, 0x40, 0x2F, 0xD0, 0x1F, 0xD0, 0x0B, 0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD,
-    0x03, 0xFF, 0xD1, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF, 0xFC, 0x06, 0x40, 0x42, 0xFE, 0x2C, 0x3F, 0xFF,
-    0xD3, 0xC7, 0xFC, 0x04, 0x05, 0x00, 0x00, 0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0,
-    0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x0A, 0x01, 0x0F, 0xF1, 0xEB, 0xFF, 0xF9, 0xD2, 0xFC, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x7F, 0xF8, 0x02, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0,
-    0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x02, 0xFF, 0xF4,
-    0xFF, 0xFD, 0x05, 0x55, 0x43, 0xFF, 0xFD, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x54, 0x3F, 0xFF, 0xD2, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x02, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0xAF, 0xFF,
-    0xE1, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x07, 0xFF, 0x80, 0x2F, 0xE0, 0x07, 0xF8,
-    0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0,
-    0x2F, 0xFF, 0x4F, 0xFF, 0xD0, 0x08, 0x00, 0x43, 0xE0, 0x1D, 0x3F, 0xFF, 0xC0, 0xFF, 0xF4, 0x01,
-    0xA4, 0x00, 0x00, 0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF,
-    0xFD, 0x00, 0x00, 0x1E, 0x00, 0xAB, 0xF5, 0xF4, 0xFF, 0xF8, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x7F, 0xF8, 0x02, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE,
-    0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x02, 0xFF, 0xF4, 0xFF, 0xFD, 0x15, 0x55,
-    0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x02, 0xE0, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0xFF, 0x90, 0x0B, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00, 0x7F, 0x40, 0x0B,
-    0xFC, 0x00, 0xBF, 0x80, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xF8,
-    0x00, 0xBF, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00,
-    0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0x43, 0xFF, 0xF4, 0x00, 0x3E, 0x00, 0x0F,
-    0x80, 0x01, 0xF4, 0x00, 0x1F, 0xE8, 0x00, 0xBF, 0xC0, 0x00, 0x50, 0x00, 0x64, 0x00, 0x2F, 0xC0,
-    0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x2F,
-    0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x07, 0xFF, 0x80, 0x2F, 0xE0,
-    0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80,
-    0x1F, 0xE0, 0x2F, 0xFF, 0x4F, 0xFF, 0xD0, 0x15, 0x55, 0x41, 0x55, 0x55, 0x3F, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x2F, 0xFF, 0x82, 0xFF, 0xF9, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0,
-    0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03,
-    0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC,
-    0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00,
-    0x2F, 0xD0, 0x03, 0xFD, 0x00, 0x2F, 0xD0, 0x2F, 0xFF, 0xD0, 0x2F, 0xD0, 0x3F, 0xFF, 0xD0, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x10, 0x07, 0xF4, 0x02, 0xFC, 0x0B, 0xFC, 0x03, 0xFD, 0x0B, 0xF8, 0x03, 0xFC, 0x01,
-    0x90, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2F, 0xF8, 0x1F, 0xFC, 0x7F,
-    0xF8, 0x3F, 0xFC, 0x0B, 0xF8, 0x07, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x07,
-    0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x07,
-    0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x2F, 0xFF, 0x43, 0xFC, 0x3F, 0xFF, 0x43, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xF0,
-    0x00, 0xFD, 0xFC, 0x03, 0xF0, 0x7E, 0x02, 0x80, 0x18, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x07,
-    0xFF, 0xFD, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x7D, 0xF8, 0x03,
-    0xD1, 0xF0, 0x1E, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x40, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x02, 0xE4, 0x00, 0x00, 0x15,
-    0x55, 0x40, 0x55, 0x50, 0xFF, 0xFF, 0x0F, 0xFF, 0xD2, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0x00,
-    0x7F, 0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xF4, 0x00,
-    0x00, 0xFF, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xDF, 0xF0, 0x00, 0x00, 0xFF, 0x2F, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x3F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xF4, 0x2F, 0xFF, 0xC0, 0x7F, 0xF8,
-    0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0xFF, 0xF8, 0x0B, 0xF0, 0x7F, 0xF4, 0x0B, 0xF0, 0x3F, 0x80, 0x0B, 0xF0,
-    0xFE, 0x00, 0x0B, 0xF2, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x0B, 0xFB, 0xF8, 0x00, 0x0B, 0xF2,
-    0xFD, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x0B, 0xF0, 0x7F, 0xC0, 0x0B, 0xF0, 0x2F, 0xF0, 0x2F, 0xFD,
-    0x0F, 0xFC, 0x7F, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x2F, 0xFF, 0x07, 0xFF, 0x87, 0xFF, 0x80, 0x2F,
-    0xE0, 0xBF, 0x00, 0x07, 0xF8, 0x7F, 0x00, 0x01, 0xFE, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xF5, 0xFE, 0x00, 0x01, 0xFD, 0x3F, 0xD0, 0x00, 0x7F, 0x43, 0xFC,
-    0x00, 0x1F, 0xD0, 0xBF, 0xC0, 0x2F, 0xFE, 0x0F, 0xFD, 0x0F, 0xFF, 0xC0, 0xBF, 0x80, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x3C, 0x03, 0xFC, 0x00, 0x7D, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x04, 0x00, 0x1F, 0x80, 0x2F, 0xE0, 0x7F, 0xF0, 0x2E,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x01, 0xBF, 0xD0, 0xFF, 0xF4, 0x07, 0xFD, 0x00, 0xBF, 0x40, 0x2F,
-    0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF,
-    0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x7F, 0xFF, 0x2F, 0xFF,
-    0xC0, 0x15, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0x7D, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFE, 0xAA,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x1B, 0xFD, 0x0F, 0xFF, 0x40, 0x7F, 0xD0, 0x0B, 0xF4,
-    0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0,
-    0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x07, 0xFF, 0xF2,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xF4, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x15, 0x55, 0x43, 0xF0, 0x3F, 0xFF,
-    0xD3, 0xE0, 0x2F, 0xFF, 0x83, 0xC0, 0x03, 0xFC, 0x03, 0x80, 0x03, 0xFC, 0x01, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC,
-    0x00, 0x7D, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x10, 0x11, 0xBF, 0xD2, 0xFF, 0xFF, 0x4B, 0xC7, 0xFD, 0x3E, 0x0B, 0xF4, 0xF0,
-    0x2F, 0xD3, 0xC0, 0xBF, 0x44, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x40,
-    0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x00, 0x0B, 0xF4,
-    0x00, 0x2F, 0xD0, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0xC0, 0x15, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x01, 0xF4, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x02,
-    0xF4, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00,
-    0x7D, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x10, 0x00, 0x06, 0xFF, 0x40, 0x00, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0xBF, 0x42, 0xF8, 0x0B, 0xF4, 0x3F, 0xC0, 0xBF, 0x43, 0xFC, 0x0B, 0xF4, 0x0A, 0x00, 0xBF,
-    0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x50, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0xB0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0x3F,
-    0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x02, 0xF4, 0x03, 0xFE, 0xAA, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0x01, 0xBF, 0xD0, 0x3F, 0xFD, 0x00, 0x7F, 0xD0, 0x02, 0xFD,
-    0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x2F, 0xDC, 0x02, 0xFF, 0xD0, 0x2F, 0xF4, 0x02, 0xFD, 0x00,
-    0xBF, 0xD0, 0x3F, 0xFD, 0x01, 0x6F, 0xD0, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x2F,
-    0xD0, 0x1F, 0xFF, 0xC2, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x55, 0x54,
-    0x7F, 0xFD, 0x00, 0xBF, 0xFF, 0x0B, 0xFF, 0xC0, 0x1F, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x7F, 0x00,
-    0x0F, 0xFF, 0x40, 0x1F, 0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xF0, 0x00, 0xFF, 0xFE, 0x01, 0xFC, 0x00,
-    0x3F, 0x7F, 0xD0, 0x7F, 0x00, 0x0F, 0xCB, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0xFF, 0xC7, 0xF0, 0x00,
-    0xFC, 0x0F, 0xF9, 0xFC, 0x00, 0x3F, 0x02, 0xFF, 0x7F, 0x00, 0x0F, 0xC0, 0x3F, 0xFF, 0xC0, 0x03,
-    0xF0, 0x03, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0x00, 0xFF,
-    0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x54,
-    0x00, 0x2F, 0xF2, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFA, 0xFF, 0x80, 0x1F, 0xE0,
-    0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F,
-    0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80,
-    0xBF, 0xF8, 0x3F, 0xFD, 0x3F, 0xFF, 0x1F, 0xFF, 0x40, 0x15, 0x54, 0x00, 0x15, 0x55, 0x1F, 0xFF,
-    0x40, 0x2F, 0xFF, 0xC2, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFF,
-    0xD0, 0x07, 0xF0, 0x00, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x7F, 0x00, 0x0F, 0xDF,
-    0xF4, 0x1F, 0xC0, 0x03, 0xF2, 0xFF, 0x07, 0xF0, 0x00, 0xFC, 0x3F, 0xF1, 0xFC, 0x00, 0x3F, 0x03,
-    0xFE, 0x7F, 0x00, 0x0F, 0xC0, 0xBF, 0xDF, 0xC0, 0x03, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0xFC, 0x00,
-    0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0x00,
-    0x3F, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x15,
-    0x00, 0x0B, 0xFC, 0xBF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x6F, 0xFE, 0xBF, 0xE0, 0x07, 0xF8,
-    0x07, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0, 0x07,
-    0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0,
-    0x2F, 0xFE, 0x0F, 0xFF, 0x4F, 0xFF, 0xC7, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x3C,
-    0x00, 0x00, 0x02, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x55,
-    0x54, 0x7F, 0xFD, 0x00, 0xBF, 0xFF, 0x0B, 0xFF, 0xC0, 0x1F, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x7F,
-    0x00, 0x0F, 0xFF, 0x40, 0x1F, 0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xF0, 0x00, 0xFF, 0xFE, 0x01, 0xFC,
-    0x00, 0x3F, 0x7F, 0xD0, 0x7F, 0x00, 0x0F, 0xCB, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0xFF, 0xC7, 0xF0,
-    0x00, 0xFC, 0x0F, 0xF9, 0xFC, 0x00, 0x3F, 0x02, 0xFF, 0x7F, 0x00, 0x0F, 0xC0, 0x3F, 0xFF, 0xC0,
-    0x03, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0x00,
-    0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x10, 0x01, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x54, 0x00, 0x2F, 0xF2, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFA, 0xFF, 0x80, 0x1F,
-    0xE0, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80,
-    0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F,
-    0x80, 0xBF, 0xF8, 0x3F, 0xFD, 0x3F, 0xFF, 0x1F, 0xFF, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x05, 0x01, 0x50, 0x00, 0x7D, 0x0B, 0xFC, 0xBF, 0xF0, 0x03, 0xE0, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x0A, 0x00, 0x6F, 0xFE, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0x40, 0x00, 0x02,
-    0xFD, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xE0, 0x00,
-    0x00, 0xBF, 0x40, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x07, 0xF8,
-    0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xE0, 0x00, 0x02, 0xFF, 0xE1, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x8B,
-    0xFF, 0xC0, 0x15, 0x54, 0x00, 0x15, 0x55, 0x1F, 0xFF, 0x00, 0x2F, 0xFF, 0xC2, 0xFF, 0xF0, 0x07,
-    0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0xFF, 0xFC, 0x01,
-    0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x7F, 0x00, 0x0F, 0xDF, 0xF0, 0x1F, 0xC0, 0x03, 0xF2, 0xFF, 0x07,
-    0xF0, 0x00, 0xFC, 0x3F, 0xD1, 0xFC, 0x00, 0x3F, 0x03, 0xFC, 0x7F, 0x00, 0x0F, 0xC0, 0xBF, 0xDF,
-    0xC0, 0x03, 0xF0, 0x0F, 0xFB, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xFF,
-    0x00, 0x1F, 0xC0, 0x02, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xFF, 0xC0, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x38, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x50, 0x15, 0x00, 0xBF,
-    0xCB, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xEB, 0xFE, 0x07, 0xF8, 0x07, 0xF8, 0x1F, 0xE0,
-    0x0F, 0xE0, 0x7F, 0x80, 0x3F, 0x81, 0xFE, 0x00, 0xFE, 0x07, 0xF8, 0x03, 0xF8, 0x1F, 0xE0, 0x0F,
-    0xE0, 0x7F, 0x80, 0x3F, 0x81, 0xFE, 0x00, 0xFE, 0x2F, 0xFE, 0x03, 0xF8, 0xFF, 0xFC, 0x0F, 0xE0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA4,
-    0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x07, 0xFF, 0x02, 0xFD,
-    0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0xBF, 0xC7, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x3F,
-    0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x80,
-    0x00, 0x3F, 0xCB, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0x43, 0xFF, 0x00, 0x1F, 0xF0,
-    0x1F, 0xFE, 0x5B, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x1F, 0xF4,
-    0x1F, 0xD0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F,
-    0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFE, 0x01, 0xFE, 0x07, 0xFE, 0x1F, 0xF0, 0x0B, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x07,
-    0xC0, 0x3C, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x0B, 0xFC,
-    0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00,
-    0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xC7,
-    0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x28, 0x00, 0x2F, 0xD7, 0xD0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xD1, 0xFF,
-    0x41, 0xFD, 0x01, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xE0, 0x1F, 0xE0, 0x7F, 0xE1, 0xFF, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x50, 0x08, 0x00, 0x00,
-    0x1F, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x3F, 0x07, 0xE0,
-    0x00, 0x02, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x07, 0xFF, 0x02, 0xFD, 0x00, 0x0F, 0xF8,
-    0x3F, 0xC0, 0x00, 0xBF, 0xC7, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00,
-    0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCB,
-    0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0x43, 0xFF, 0x00, 0x1F, 0xF0, 0x1F, 0xFE, 0x5B,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x09, 0x0A, 0x00, 0x00, 0x3D, 0x3E, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x7C,
-    0x3C, 0x00, 0x00, 0xC0, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x47, 0xFD, 0x07, 0xF4, 0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0,
-    0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF,
-    0x80, 0x7F, 0x81, 0xFF, 0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFD, 0x02, 0xFD, 0x05, 0xF8, 0x2F, 0xE0, 0x02, 0xFD, 0x00, 0xF4,
-    0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x60, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFD,
-    0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0x00,
-    0x02, 0xFE, 0xAA, 0x40, 0xFF, 0x40, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x02, 0xFD, 0x00, 0x10,
-    0x7F, 0xC0, 0x02, 0xFD, 0x00, 0x3C, 0x3F, 0xF0, 0x02, 0xFD, 0x00, 0xBC, 0x0F, 0xFE, 0x57, 0xFE,
-    0xAA, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x01, 0x50, 0x00, 0x0B, 0xFF, 0xC2, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x47, 0xFF, 0x82, 0xFD, 0x1F, 0xD0, 0x1F, 0xF0, 0x0F, 0xF3,
-    0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0xF3, 0xFC, 0x00, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF4, 0x00,
-    0x01, 0xFF, 0x87, 0xFF, 0xF9, 0x6E, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0x42, 0xFF,
-    0xF8, 0x00, 0x05, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xAA, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0xFF,
-    0x1B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xCF, 0xF0,
-    0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0xF0, 0x3F, 0xF8, 0x3F, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x2F, 0xF1, 0xFD, 0xBF, 0xF7,
-    0xFD, 0x1B, 0xFF, 0xFC, 0x07, 0xFD, 0x04, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00,
-    0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x7F,
-    0xFF, 0xC0, 0x05, 0x6A, 0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x6F, 0xF0, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xC0, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x14, 0x2F, 0xF1, 0xFD, 0xBF,
-    0xF7, 0xFD, 0x1B, 0xFF, 0xFC, 0x07, 0xFD, 0x04, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8,
-    0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0x80,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x02,
-    0xF4, 0x00, 0x03, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x3C,
-    0x00, 0x00, 0x2F, 0x43, 0xE0, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xAA, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00,
-    0xFF, 0x1B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xCF,
-    0xF0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x3F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0xF0, 0x3F, 0xF8, 0x3F, 0xFF, 0xC0, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x10, 0x07, 0xC0, 0xF8, 0x03, 0xE2, 0xF0, 0x01, 0xFF, 0xC0,
-    0x00, 0xBF, 0x40, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x2F, 0xF1, 0xFD, 0xBF,
-    0xF7, 0xFD, 0x1B, 0xFF, 0xFC, 0x07, 0xFD, 0x04, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8,
-    0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0x80,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xC0,
-    0x00, 0xBF, 0x80, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x90, 0x07, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xC3, 0xFC, 0x03, 0xF1, 0xFD, 0x00, 0xFC, 0x7F, 0x80, 0x2D, 0x1F, 0xF4, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xBF,
-    0xF0, 0xA0, 0x03, 0xFD, 0xBC, 0x00, 0x7F, 0x6F, 0x40, 0x2F, 0xCB, 0xF8, 0x1F, 0xE2, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x55, 0x40, 0x00, 0x00, 0x09, 0x00, 0x00, 0x7D, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0x80, 0x00, 0xF8, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x07, 0xFF,
-    0xE0, 0xBF, 0xBF, 0xC3, 0xF0, 0x1F, 0x5F, 0xC0, 0x3C, 0x7F, 0xE0, 0x00, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFD, 0x10, 0x1F, 0xFA, 0xE0, 0x0F, 0xEF, 0xD0, 0x3F, 0x6F, 0xFF, 0xF8, 0x7F,
-    0xFF, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x0B,
-    0xDF, 0xD0, 0x0B, 0xD0, 0xBC, 0x01, 0xD0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x90, 0x07,
-    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC3, 0xFC, 0x03, 0xF1, 0xFD, 0x00, 0xFC, 0x7F, 0x80, 0x2D, 0x1F,
-    0xF4, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF0, 0xA0, 0x03, 0xFD, 0xBC, 0x00, 0x7F, 0x6F, 0x40, 0x2F, 0xCB, 0xF8, 0x1F, 0xE2,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x2F, 0xF0, 0x01, 0xF7, 0xF0, 0x0F, 0x83, 0xD0, 0x78, 0x07, 0x40, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x07, 0xFF, 0xE0, 0xBF, 0xBF, 0xC3, 0xF0, 0x1F, 0x5F, 0xC0, 0x3C, 0x7F, 0xE0, 0x00, 0xFF, 0xFD,
-    0x00, 0xFF, 0xFE, 0x00, 0xBF, 0xFD, 0x10, 0x1F, 0xFA, 0xE0, 0x0F, 0xEF, 0xD0, 0x3F, 0x6F, 0xFF,
-    0xF8, 0x7F, 0xFF, 0x80, 0x01, 0x40, 0x00, 0x00, 0x6F, 0xA4, 0x01, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xF0, 0xFF, 0x00, 0xFC, 0x7F, 0x40, 0x3F, 0x1F, 0xE0, 0x0B, 0x47, 0xFD, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x1F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x28, 0x00,
-    0xFF, 0x6F, 0x00, 0x1F, 0xDB, 0xD0, 0x0B, 0xF2, 0xFE, 0x07, 0xF8, 0xBF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xF8, 0x00, 0x15, 0x50, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x55, 0x00, 0x1F, 0xFF, 0x82, 0xFE,
-    0xFF, 0x0F, 0xC0, 0x7D, 0x7F, 0x00, 0xF1, 0xFF, 0x80, 0x03, 0xFF, 0xF4, 0x03, 0xFF, 0xF8, 0x02,
-    0xFF, 0xF4, 0x40, 0x7F, 0xEB, 0x80, 0x3F, 0xBF, 0x40, 0xFD, 0xBF, 0xFF, 0xE1, 0xFF, 0xFE, 0x00,
-    0x05, 0x00, 0x00, 0x6E, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x7E, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x1F, 0x00, 0xFC, 0x1F, 0x40, 0x1F, 0xEF, 0x40,
-    0x01, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x90, 0x07, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xC3, 0xFC, 0x03, 0xF1, 0xFD, 0x00, 0xFC, 0x7F, 0x80, 0x2D, 0x1F, 0xF4, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xBF,
-    0xF0, 0xA0, 0x03, 0xFD, 0xBC, 0x00, 0x7F, 0x6F, 0x40, 0x2F, 0xCB, 0xF8, 0x1F, 0xE2, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x55, 0x40, 0x00, 0x04, 0x01, 0x40, 0xB8, 0x1F, 0x41, 0xF4, 0xF8,
-    0x02, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x07, 0xFF,
-    0xE0, 0xBF, 0xBF, 0xC3, 0xF0, 0x1F, 0x5F, 0xC0, 0x3C, 0x7F, 0xE0, 0x00, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFD, 0x10, 0x1F, 0xFA, 0xE0, 0x0F, 0xEF, 0xD0, 0x3F, 0x6F, 0xFF, 0xF8, 0x7F,
-    0xFF, 0x80, 0x01, 0x40, 0x00, 0x15, 0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xF4, 0x7F, 0xC1, 0xFC, 0x3E, 0x03, 0xFC, 0x0F, 0xC3, 0xD0, 0x3F, 0xC0, 0xF8,
-    0x04, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x17, 0xFD, 0x50, 0x03, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFF, 0xAC, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x3F, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x3D, 0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x03, 0xFB, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0x47, 0xFC, 0x1F, 0xC3,
-    0xE0, 0x3F, 0xC0, 0xFC, 0x3D, 0x03, 0xFC, 0x0F, 0x80, 0x40, 0x3F, 0xC0, 0x50, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x14, 0xB8, 0x00, 0xFC, 0xB0, 0x02, 0xFC,
-    0x60, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x17, 0xFD, 0x50, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFF, 0xAC, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x15, 0x55,
-    0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF4, 0x7F, 0xC1, 0xFC,
-    0x3E, 0x03, 0xFC, 0x0F, 0xC3, 0xD0, 0x3F, 0xC0, 0xF8, 0x04, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xAB, 0xFE, 0x90, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x17, 0xFD, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xF8, 0x17, 0xFD, 0x50, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x17, 0xFD, 0x50, 0x3F, 0xFF, 0xF0,
-    0x07, 0xFD, 0x50, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xAC, 0x02, 0xFF, 0xFC, 0x00,
-    0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x01, 0x90, 0x40, 0x00, 0x00, 0x0B, 0xF8, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40,
-    0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF,
-    0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x19, 0x05, 0x00, 0x00, 0x2F, 0xE3, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03,
-    0xC3, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0xBF, 0xC0, 0xBF, 0xF0, 0xBF, 0xF0, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x02, 0xFF, 0xAF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x8F, 0xFC, 0x00, 0x15, 0x01, 0x40, 0x00, 0x00, 0x05, 0x55, 0x50,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F,
-    0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0,
-    0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x05, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFF, 0x0B,
-    0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0xFF, 0x40, 0xFF, 0x00, 0x2F, 0xFA, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0xFF,
-    0xC0, 0x01, 0x50, 0x14, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x40, 0xB0, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40,
-    0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF,
-    0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xC0, 0x00, 0x0F, 0xE6, 0xF0, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0xBF, 0xC0, 0xBF, 0xF0, 0xBF, 0xF0, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x02, 0xFF, 0xAF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x8F, 0xFC, 0x00, 0x15, 0x01, 0x40, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x03, 0xC2, 0xD0, 0x00,
-    0x00, 0x03, 0xD3, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x15,
-    0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x06,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x00,
-    0x3D, 0x3C, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x04, 0x02,
-    0x00, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x7F, 0x40,
-    0x00, 0x0B, 0xD0, 0xF8, 0x00, 0x00, 0x06, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x06,
-    0x03, 0x40, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00,
-    0x3D, 0x2E, 0x00, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x15, 0x55, 0x40, 0x55,
-    0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00,
-    0x2F, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xEA, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFF, 0x0B, 0xFF,
-    0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0xFF, 0x00, 0x2F, 0xFA, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0xFF, 0xC0,
-    0x01, 0x50, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xFE,
-    0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xEB, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x55,
-    0x54, 0x7F, 0xFF, 0xC0, 0x7F, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x40, 0xBF, 0x00, 0x7F, 0xF8, 0x0B,
-    0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xD0, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xC0, 0x03, 0xFD, 0x02,
-    0xFF, 0xC0, 0x2F, 0x80, 0x02, 0xFE, 0x03, 0xFF, 0xD0, 0x3F, 0x40, 0x01, 0xFF, 0x03, 0xFF, 0xE0,
-    0x3F, 0x00, 0x00, 0xFF, 0x07, 0xEF, 0xF0, 0x7E, 0x00, 0x00, 0xBF, 0x4B, 0xCB, 0xF0, 0xBD, 0x00,
-    0x00, 0x7F, 0x8F, 0xC7, 0xF4, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0x83, 0xFC, 0xF8, 0x00, 0x00, 0x2F,
-    0xDF, 0x02, 0xFD, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x07,
-    0xD0, 0xBF, 0xF0, 0xFF, 0xF4, 0x2F, 0x81, 0xFF, 0xC0, 0xFF, 0x00, 0xFF, 0x00, 0xFC, 0x02, 0xFC,
-    0x07, 0xFC, 0x07, 0xD0, 0x03, 0xF8, 0x2F, 0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0xFF, 0xE0, 0xFC, 0x00,
-    0x2F, 0xC3, 0xDF, 0xC7, 0xD0, 0x00, 0x3F, 0x6E, 0x3F, 0x2F, 0x00, 0x00, 0xFE, 0xF4, 0xBD, 0xF8,
-    0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x0B,
-    0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFA, 0xF8, 0x00,
-    0x00, 0x3E, 0x07, 0xD0, 0x00, 0x03, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50,
-    0x15, 0x54, 0xBF, 0xFF, 0x87, 0xFF, 0xE7, 0xFF, 0xE0, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0xFE, 0x00,
-    0x3F, 0xD0, 0x1F, 0xC0, 0x01, 0xFF, 0x03, 0xF4, 0x00, 0x0F, 0xF4, 0x7E, 0x00, 0x00, 0x3F, 0xCF,
-    0xC0, 0x00, 0x02, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFA, 0xF0, 0x00,
-    0x00, 0xBC, 0x3E, 0x00, 0x00, 0x3C, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80, 0x1F, 0xE0,
-    0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xE0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02,
-    0xFC, 0xBD, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xE0, 0x00,
-    0x0B, 0xF0, 0xFD, 0x00, 0x00, 0x14, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01,
-    0x55, 0x4B, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0xFE, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xE0, 0x03,
-    0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0xFF, 0x47, 0xE0, 0x00, 0x03, 0xFC, 0xFC,
-    0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x2F, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xC3, 0xF4, 0x03, 0xFE, 0x0F, 0x80, 0x2F, 0xF0, 0x1D, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x1C, 0x0F, 0xF8, 0x00, 0xF8, 0xBF, 0xC0, 0x07,
-    0xE3, 0xFE, 0xAA, 0xBF, 0x4F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xC3, 0xF5, 0x7F, 0xE0, 0xF4, 0x1F, 0xE0, 0x18, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4,
-    0x00, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0x07, 0xFC, 0x03, 0xD3, 0xFE, 0x56, 0xF0, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x54, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0xFD, 0x00, 0xFF, 0x83, 0xE0, 0x0B,
-    0xFC, 0x07, 0x40, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0x03,
-    0xFE, 0x00, 0x3E, 0x2F, 0xF0, 0x01, 0xF8, 0xFF, 0xAA, 0xAF, 0xD3, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF4, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x2F, 0xFF, 0xFF, 0x0F, 0xD5, 0xFF, 0x83, 0xD0, 0x7F, 0x80, 0x60, 0x7F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF0, 0x2C, 0x1F, 0xF0, 0x0F, 0x4F, 0xF9, 0x5B,
-    0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x7C, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xC3, 0xF4, 0x03, 0xFE, 0x0F, 0x80, 0x2F, 0xF0, 0x1D, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xFF, 0x40, 0x1C, 0x0F, 0xF8, 0x00, 0xF8, 0xBF, 0xC0, 0x07, 0xE3, 0xFE, 0xAA,
-    0xBF, 0x4F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50,
-    0x03, 0xE0, 0x7C, 0x00, 0xBD, 0x3D, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xC3, 0xF5, 0x7F,
-    0xE0, 0xF4, 0x1F, 0xE0, 0x18, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF8,
-    0x00, 0x07, 0xFC, 0x0B, 0x07, 0xFC, 0x03, 0xD3, 0xFE, 0x56, 0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF4, 0x0F,
-    0xF0, 0xBD, 0x07, 0xF4, 0x09, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x07,
-    0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x00, 0x14, 0x07, 0xD0, 0x7F, 0x02, 0xFC, 0x07, 0xD0, 0x08, 0x02,
-    0x03, 0xF1, 0xFC, 0xFC, 0x7D, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xFE, 0x00, 0xBD,
-    0xF4, 0x1F, 0x0B, 0xC2, 0xD0, 0x38, 0x00, 0x00, 0x00, 0x06, 0x41, 0x03, 0xFE, 0x3C, 0x3F, 0xFF,
-    0xC3, 0xC7, 0xF8, 0x00, 0x04, 0x00, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x03, 0xC0, 0x1C, 0x3F, 0x9B, 0xC2, 0xFF, 0xF4, 0x06, 0xF8, 0x00, 0x05, 0x03, 0xFC, 0x3F, 0xC3,
-    0xF8, 0x04, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x7F, 0x0F, 0xD7, 0xF0, 0xFD, 0x04, 0x01, 0x00,
-    0x0B, 0xE0, 0x3F, 0xFC, 0x7C, 0x3D, 0x24, 0x3C, 0x01, 0xF4, 0x07, 0xC0, 0x03, 0x40, 0x06, 0xE0,
-    0x2F, 0xFC, 0x3C, 0x3C, 0x78, 0x2D, 0x3D, 0x3C, 0x1F, 0xF4, 0x01, 0x40, 0x06, 0x03, 0x40, 0xFC,
-    0xBC, 0x0F, 0x8F, 0xC2, 0xF1, 0xF4, 0x3D, 0x2E, 0x02, 0x81, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x01,
-    0x43, 0xC0, 0xBC, 0x3F, 0x1F, 0x00, 0xFF, 0xD0, 0x07, 0xF8, 0x00, 0x1A, 0x00, 0x1C, 0x09, 0x03,
-    0xE3, 0xF0, 0x3F, 0x2F, 0x01, 0xF4, 0xF8, 0x0B, 0x87, 0xC0, 0x34, 0x28, 0x00, 0x00, 0x00, 0x01,
-    0xA8, 0x00, 0xFF, 0xF4, 0x3E, 0xAF, 0xC3, 0x40, 0x7C, 0x10, 0x01, 0x00, 0x01, 0x02, 0xF1, 0xF0,
-    0xFC, 0x3F, 0x0F, 0xC2, 0xF8, 0x10, 0x2F, 0x0F, 0xE1, 0xFC, 0x7E, 0x2F, 0x1F, 0x46, 0x40, 0x3E,
-    0x2F, 0xCF, 0xD2, 0xF4, 0x3E, 0x07, 0xD0, 0x60, 0x14, 0x3E, 0x3E, 0x3C, 0x3C, 0x34, 0x10, 0x1F,
-    0x43, 0xE0, 0xF8, 0xFC, 0x3C, 0x04, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xC3, 0xFC, 0x1E, 0x40, 0x19,
-    0x06, 0x87, 0xF0, 0xFD, 0x7F, 0x0F, 0xD2, 0x90, 0x64, 0x1A, 0x47, 0xFD, 0xF0, 0xFF, 0x0E, 0x7F,
-    0xC1, 0x90, 0x0A, 0x0B, 0xF0, 0xFC, 0x3E, 0x3F, 0x05, 0x00, 0x2E, 0x43, 0xFC, 0x07, 0xD0, 0xBC,
-    0x2F, 0x02, 0x40, 0x00, 0x01, 0xF4, 0x7D, 0x0B, 0xC0, 0xBF, 0x93, 0xFD, 0x01, 0x00, 0xAB, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x2F, 0xC0, 0x07, 0xFF, 0x00, 0xF9, 0xFC, 0x3E, 0x03,
-    0xD1, 0x40, 0x04, 0x00, 0x00, 0x02, 0xC0, 0x0C, 0x3F, 0x47, 0xC2, 0xFF, 0xF4, 0x0B, 0xF9, 0x00,
-    0x00, 0x00, 0x0B, 0x82, 0x43, 0xFE, 0x7C, 0x3E, 0xFF, 0xC2, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x43, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x01, 0xA8, 0x00, 0xFF, 0xF4, 0x3E, 0xAF, 0xC3, 0x40,
-    0x7C, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x40, 0x07, 0xF0, 0x00, 0xFC,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFD, 0x7F, 0x0F, 0xD3, 0xF0, 0xFC, 0x00, 0x00, 0x00,
-    0x14, 0x1F, 0x0B, 0xC1, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC,
-    0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x2F, 0x40, 0x02, 0xFD, 0x3F, 0xC0, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x50, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC,
-    0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x15, 0x55, 0x55, 0x55,
-    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFD, 0x2F, 0xE0, 0x7E,
-    0x00, 0x3E, 0x07, 0xF8, 0x0F, 0x80, 0x0F, 0x41, 0xFE, 0x03, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x7F, 0xEA, 0xFF, 0xD0, 0x00, 0x1F, 0xE0, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xFF,
-    0x00, 0x01, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0x80, 0x0B, 0xF4, 0x00, 0x2F, 0xE0, 0x02, 0xFD,
-    0x00, 0xBF, 0xFF, 0x40, 0xBF, 0x00, 0x3F, 0xFF, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xD5, 0x6F, 0x40, 0xFF, 0x00, 0x7D, 0x03, 0xFC, 0x01, 0xF0, 0x0F, 0xF0, 0x03, 0x80, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0xBF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xF4, 0x02, 0xF8, 0x2F, 0xD0, 0x01, 0xF8, 0x3F, 0xC0, 0x00, 0xF4,
-    0x7F, 0x40, 0x00, 0x90, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xAA, 0xA0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x78,
-    0x3F, 0xE0, 0x00, 0xFC, 0x2F, 0xFD, 0x17, 0xFC, 0x0B, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xD0,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x6F, 0xA4, 0x01, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0xFF, 0x00,
-    0xFC, 0x7F, 0x40, 0x3F, 0x1F, 0xE0, 0x0B, 0x47, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x28, 0x00, 0xFF, 0x6F, 0x00,
-    0x1F, 0xDB, 0xD0, 0x0B, 0xF2, 0xFE, 0x07, 0xF8, 0xBF, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x00, 0x15,
-    0x50, 0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x00,
-    0x00, 0x03, 0xF0, 0x7D, 0x7F, 0x4F, 0xF7, 0xF4, 0xFE, 0x14, 0x01, 0x40, 0x00, 0x00, 0x15, 0x55,
-    0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x01, 0x55, 0x54, 0x07, 0xFF,
-    0xFD, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0xFF, 0x54, 0x00, 0x00, 0x1F, 0x40, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0x00, 0xFF, 0x07, 0xFE, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3E, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0xFF, 0x20, 0xFC, 0x00, 0xFF, 0x01, 0xFE, 0x7F, 0xF8, 0x00,
-    0xFF, 0x6F, 0xFC, 0xBF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF4, 0x7F, 0x80, 0x2F, 0xFF, 0xFF, 0x40, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x55, 0x00, 0x03, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0x81, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0xAA, 0xAF, 0xFA, 0xFF, 0xC0, 0x3F, 0xC0, 0x01,
-    0xFE, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0xFE,
-    0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x2F, 0xD0, 0x3F, 0xD0, 0x01, 0xFF, 0x6F, 0xFC, 0x2F, 0xFF, 0xD1,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x55, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xD2, 0xFE, 0x07, 0xE0, 0x00, 0x3E, 0x07, 0xF8, 0x0F, 0x80, 0x00, 0xF4, 0x1F,
-    0xE0, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0xE0,
-    0x00, 0x01, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x03,
-    0xFC, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xFF,
-    0x4B, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x50, 0x02, 0x90, 0x3F,
-    0xFF, 0xD0, 0x7F, 0xC0, 0xBF, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xC0, 0x2F, 0xFC, 0x00, 0xFF, 0x00,
-    0xFC, 0x00, 0x03, 0xFC, 0x0B, 0xD0, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0xC2, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x3F,
-    0xC1, 0xFE, 0x00, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F,
-    0xFC, 0x00, 0x3F, 0xD0, 0x1F, 0xF8, 0x0B, 0xFF, 0xF0, 0x2F, 0xF8, 0x3F, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0x55, 0x54, 0x3F,
-    0xFF, 0xD0, 0xFF, 0xFF, 0x4B, 0xFF, 0xD0, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x3F,
-    0xC0, 0x3F, 0xFF, 0x00, 0x0F, 0xF0, 0x7F, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0x0F, 0xF0, 0x00, 0xFF,
-    0x7F, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0xBF, 0xFF,
-    0x42, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF, 0x40, 0x00, 0x28, 0x02, 0x80, 0x00, 0x07, 0xD0,
-    0x3E, 0x00, 0x00, 0x3F, 0x5F, 0xD0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55, 0x5B, 0xFF, 0xF4, 0x3F, 0xFF, 0x7F, 0xFE, 0x02,
-    0xFF, 0xD0, 0xFF, 0x80, 0x0B, 0xF0, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0xD0, 0x1F, 0x80, 0x00,
-    0xFF, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x7E, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x02, 0xFD, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x03, 0x03, 0xE0, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0x3F,
-    0xFF, 0xD3, 0xFF, 0xFE, 0x2F, 0xFF, 0x82, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC,
-    0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00,
-    0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x2F,
-    0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xD0,
-    0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFE, 0x55, 0x7F, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00,
-    0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00,
-    0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00,
-    0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x50,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xF8, 0x03, 0xFD, 0x56, 0xF4, 0x03, 0xFC, 0x01, 0xF4,
-    0x03, 0xFC, 0x00, 0xF0, 0x03, 0xFC, 0x00, 0x40, 0x03, 0xFD, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x1B, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x01, 0xFD,
-    0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x6F, 0xF8, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6A, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFC, 0x03, 0xF0,
-    0x03, 0xFC, 0x07, 0xF0, 0x03, 0xFC, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFC, 0x1B, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x02, 0xFC,
-    0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x6F, 0xF8, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0x55, 0xBD, 0x03, 0xFC, 0x01, 0xF4, 0x0F, 0xF0, 0x07, 0xC0, 0x3F, 0xC0, 0x0E, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xC0, 0xBF, 0x40, 0x00, 0x0F, 0xC0, 0xBF,
-    0x40, 0x00, 0x0F, 0xC0, 0xBF, 0x40, 0x00, 0x0F, 0xC0, 0xBF, 0x40, 0x00, 0x0F, 0x80, 0xBF, 0x40,
-    0x00, 0x1F, 0x80, 0xBF, 0x40, 0x00, 0x1F, 0x40, 0xBF, 0x40, 0x00, 0x2F, 0x00, 0xBF, 0x40, 0x00,
-    0x3F, 0x00, 0xBF, 0x40, 0x00, 0x7E, 0x00, 0xBF, 0x40, 0x00, 0xBD, 0x00, 0xBF, 0x40, 0x00, 0xFC,
-    0x00, 0xBF, 0x40, 0x07, 0xFD, 0x55, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x2C, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC,
-    0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x02, 0x80, 0x05, 0x55, 0x50, 0x06, 0x80, 0x0F,
-    0xF4, 0x0F, 0xFF, 0xF0, 0x2F, 0xE0, 0x0F, 0xFC, 0x0B, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFE, 0x00,
-    0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0x00, 0xFE, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0xFE, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0xFE, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x0F, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0xFE, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFE,
-    0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xFE, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0xFE, 0x01, 0xFF,
-    0x40, 0x0B, 0xFD, 0x00, 0xFF, 0x40, 0xBF, 0xD0, 0x2F, 0xF8, 0x0F, 0xFF, 0xF0, 0x3F, 0xF4, 0x7F,
-    0xE0, 0x1F, 0xFF, 0xF0, 0x0F, 0xFC, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x2B, 0xE8,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xF0, 0x0B, 0xFC, 0x0F, 0x80, 0x0F, 0xF0,
-    0x3D, 0x00, 0x3F, 0xC0, 0x10, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x3C, 0x00,
-    0x2F, 0xE3, 0xFC, 0x00, 0xFF, 0x4F, 0xF8, 0x0B, 0xFC, 0x2F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x55, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xD2,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0xC0, 0x03,
-    0xFC, 0x1F, 0xCF, 0xF0, 0x00, 0xFF, 0x1F, 0xC3, 0xFC, 0x00, 0x3F, 0xDF, 0xC0, 0xFF, 0x00, 0x0F,
-    0xFF, 0xC0, 0x3F, 0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD0, 0xBF, 0xFF, 0x4F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xD0, 0x00, 0x07, 0x40, 0x78, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x00,
-    0xBE, 0x5F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x05, 0x55, 0x50, 0xFF, 0xFF, 0x43, 0xFF, 0xFD, 0x2F, 0xFF,
-    0x40, 0xBF, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xC1,
-    0xFC, 0xFF, 0x00, 0x0F, 0xF1, 0xFC, 0x3F, 0xC0, 0x03, 0xFD, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0xFC,
-    0x03, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x02, 0xFF, 0xFD, 0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0x43,
-    0xFF, 0xFD, 0x15, 0x55, 0x40, 0x0A, 0x40, 0xFF, 0xFF, 0x41, 0xFF, 0x02, 0xFF, 0xF4, 0x0F, 0xFC,
-    0x00, 0xFF, 0x00, 0xBF, 0xF0, 0x03, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x2F, 0x40, 0x00, 0x3F,
-    0xC0, 0xFC, 0x00, 0x00, 0xFF, 0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xE0, 0x2F, 0xFF,
-    0xC0, 0xBF, 0xE0, 0xFF, 0xFF, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x55, 0x55,
-    0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x3F, 0xC0,
-    0x00, 0x0F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x03, 0xFC, 0x00, 0x00, 0xF8, 0x0F, 0xF0, 0x00, 0x03,
-    0xE0, 0x3F, 0xC0, 0x00, 0x1F, 0x40, 0xFF, 0x00, 0x00, 0x7D, 0x03, 0xFC, 0x00, 0x02, 0xF0, 0x0F,
-    0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x00, 0x3E, 0x00, 0xFF, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x02,
-    0x0F, 0xC0, 0x0F, 0xF0, 0x1F, 0xFE, 0x00, 0x3F, 0xD0, 0xBF, 0xF0, 0x0F, 0xFF, 0xF5, 0xFE, 0x00,
-    0x7F, 0xFF, 0xD0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x01, 0x55, 0x50, 0x0F, 0xFF,
-    0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x0B, 0xFF, 0x00,
-    0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x01, 0xFB, 0xF4, 0x1F, 0xBF, 0x40, 0x01, 0xF7, 0xF8, 0x2F,
-    0x3F, 0x40, 0x02, 0xF6, 0xFC, 0x3E, 0x3F, 0x40, 0x02, 0xF1, 0xFC, 0x3D, 0x3F, 0x80, 0x02, 0xF0,
-    0xFD, 0x7C, 0x3F, 0x80, 0x03, 0xF0, 0xBF, 0xF8, 0x3F, 0xC0, 0x03, 0xF0, 0x7F, 0xF4, 0x3F, 0xC0,
-    0x03, 0xF0, 0x3F, 0xF0, 0x2F, 0xC0, 0x03, 0xF0, 0x2F, 0xE0, 0x2F, 0xC0, 0x07, 0xF0, 0x0F, 0xD0,
-    0x2F, 0xC0, 0x07, 0xE0, 0x0F, 0xC0, 0x2F, 0xD0, 0x3F, 0xFE, 0x06, 0x40, 0xFF, 0xFC, 0x7F, 0xFF,
-    0x00, 0x01, 0xFF, 0xFC, 0x15, 0x55, 0x40, 0x55, 0x55, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE2, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF,
-    0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xEA, 0xAA, 0xFF, 0x40, 0x0F, 0xF0,
-    0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0,
-    0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xD0, 0xBF, 0xFF, 0x8F, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xE0, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0x80,
-    0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD,
-    0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xC7, 0xFC, 0x00,
-    0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x03, 0xFC,
-    0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00,
-    0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0xD0,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF, 0xC0, 0x05, 0x6A, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x03, 0xFC, 0x1F, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC,
-    0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x1F, 0xF4, 0x03, 0xFF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFE, 0x90, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x00, 0x06, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x03, 0xFD, 0x00, 0xFC, 0x2F,
-    0xD0, 0x03, 0xF0, 0xFF, 0x00, 0x0B, 0x87, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x80, 0x01, 0x47, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF4, 0x7F, 0xC1, 0xFC, 0x3E, 0x03, 0xFC, 0x0F, 0xC3, 0xD0,
-    0x3F, 0xC0, 0xF8, 0x04, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x15, 0x55, 0x01, 0x55, 0x5B, 0xFF, 0xF4,
-    0x3F, 0xFF, 0x7F, 0xFE, 0x02, 0xFF, 0xD0, 0xFF, 0x80, 0x0B, 0xF0, 0x07, 0xFC, 0x00, 0xFC, 0x00,
-    0x2F, 0xD0, 0x1F, 0x80, 0x00, 0xFF, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x7E, 0x00, 0x00, 0x3F, 0x8F,
-    0xC0, 0x00, 0x02, 0xFD, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0x03, 0xE0, 0x00, 0x00, 0xBE, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xA4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xFF, 0x7F, 0xF0, 0x1F, 0xE0, 0xBF,
-    0x0B, 0xF8, 0x3F, 0xC0, 0xBF, 0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x02, 0xFD, 0x3F, 0xC0, 0xBF, 0x02,
-    0xFD, 0x3F, 0xC0, 0xBF, 0x03, 0xFC, 0x2F, 0xE0, 0xBF, 0x07, 0xF8, 0x0F, 0xF9, 0xFF, 0x6F, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xA0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x55, 0x50, 0x00, 0x15, 0x55,
-    0x40, 0x55, 0x50, 0xFF, 0xFF, 0x4B, 0xFF, 0xD2, 0xFF, 0xF8, 0x1B, 0xFE, 0x00, 0xFF, 0xC0, 0x2F,
-    0xC0, 0x00, 0xFF, 0x81, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xF8, 0x00, 0x03, 0xF8, 0x1F, 0xF4,
-    0x00, 0x2F, 0xC0, 0x2F, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xF0, 0x7F, 0xFF, 0x07, 0xFF, 0xFE, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xF0, 0x15, 0x55, 0x40, 0x55, 0x54, 0x0F, 0xFF, 0xF4, 0xFF, 0xFF, 0x82, 0xFF,
-    0xF8, 0x2F, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0xFF,
-    0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x03, 0xFC,
-    0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x0F, 0xF0,
-    0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0,
-    0x02, 0xFD, 0x00, 0x0F, 0xF9, 0x55, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x01, 0x55, 0x52, 0xFF, 0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xE0, 0x7F, 0xFE,
-    0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F,
-    0xC0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xA9, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x15, 0x55, 0x45, 0x55, 0x51, 0x55, 0x54, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xCF, 0xFF, 0xF2, 0xFF, 0xF4, 0xBF, 0xFD, 0x2F, 0xFE, 0x40, 0xFF, 0x00, 0x3F,
-    0xC0, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x03, 0xF8, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80,
-    0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x95,
-    0x7F, 0xD5, 0x6F, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x15, 0x55, 0x45, 0x55, 0x51, 0x55, 0x54, 0x3F, 0xFF, 0xCF, 0xFF, 0xF3, 0xFF, 0xFC,
-    0x2F, 0xFF, 0x4B, 0xFF, 0xD2, 0xFF, 0xE4, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-    0x80, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00,
-    0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFE, 0x55, 0xFF, 0x55,
-    0xBF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xD1, 0xFF, 0x00, 0x00, 0x3E, 0x03, 0xFC,
-    0x00, 0x00, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0x40, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x54, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xC1, 0xFF, 0x40, 0x00,
-    0xFF, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x3F, 0xC0,
-    0xBF, 0x40, 0x01, 0xFF, 0x6F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x55, 0x55, 0x0F, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xE2, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x03, 0xFC,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF,
-    0x40, 0x0F, 0xF5, 0x40, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFD, 0x00, 0x3F, 0xC1, 0xFF, 0x80, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x2F, 0xD0,
-    0x03, 0xFC, 0x02, 0xFC, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x7F,
-    0xC0, 0xBF, 0x40, 0x0F, 0xF9, 0xBF, 0xD0, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x8F,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFC, 0x0B, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x01, 0xFD,
-    0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x6F, 0xF8, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x40, 0x7F, 0xE0, 0x1F, 0x80, 0x07, 0xFC, 0x03, 0xD0, 0x00,
-    0xBF, 0x80, 0x60, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0x6A, 0xAF, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x03,
-    0xC0, 0x00, 0xFF, 0x43, 0xF8, 0x00, 0xBF, 0xC0, 0xFF, 0x91, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x54, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0xAF, 0x90, 0x00,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF8, 0x02, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x00,
-    0x3F, 0xD0, 0x2F, 0xF4, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0x3F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x7F, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0xFF, 0x40, 0xFF, 0x02, 0xFD, 0x00, 0x03, 0xFE, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xF8, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x3F, 0xE5, 0xFF,
-    0x40, 0x00, 0xBF, 0x80, 0xFF, 0x02, 0xFE, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x0B, 0xFC, 0x00, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0x7F, 0xF5, 0x7F, 0xD0, 0x2F, 0xFF, 0xD0, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xE0, 0x3F, 0xC0, 0x07, 0xF8, 0x03, 0xFC,
-    0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x03, 0xFE,
-    0x43, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFC, 0x7F, 0xC0,
-    0x00, 0x7F, 0x43, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xC0,
-    0x7F, 0xC0, 0x2F, 0xF0, 0x3F, 0xFF, 0xCB, 0xFC, 0x07, 0xFF, 0xFC, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03,
-    0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B,
-    0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F,
-    0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6E, 0x00, 0x2F, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFD, 0x03, 0xFD, 0xAF, 0x80, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x15,
-    0x00, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xE0, 0x7F, 0xD3, 0xFC, 0x01, 0xFE, 0x3F,
-    0xC0, 0x0F, 0xF3, 0xFC, 0x00, 0xFF, 0x3F, 0xC0, 0x0F, 0xF2, 0xFD, 0x00, 0xFF, 0x1F, 0xE0, 0x1F,
-    0xD0, 0xFF, 0x97, 0xFC, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x15, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0x02, 0xFC, 0x07, 0xF0, 0x1F,
-    0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xD0, 0x7F,
-    0x00, 0xFE, 0x07, 0xF0, 0x0F, 0xE0, 0x7F, 0x02, 0xFD, 0x2F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xD0, 0x7F, 0x82, 0xF4, 0x1F, 0xE0,
-    0x7D, 0x07, 0xF8, 0x0F, 0x01, 0xFE, 0x02, 0x40, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xE0, 0xFF, 0x00, 0x00, 0xF4, 0x3F, 0xC0,
-    0x00, 0x3D, 0x0F, 0xF0, 0x00, 0x1F, 0x03, 0xFC, 0x00, 0x0B, 0xC0, 0xFF, 0x00, 0x03, 0xF0, 0x3F,
-    0xC0, 0x00, 0xF8, 0x0F, 0xF0, 0x00, 0xBC, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0xFF, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x03, 0xF0, 0xF8,
-    0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x1E, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x40, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x82, 0xFD, 0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x0F, 0xE3,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x7F, 0xE9, 0x6D, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x7F, 0x03, 0xFF, 0xD0, 0xBF, 0x02, 0xFF, 0x0B, 0xFE, 0x07, 0xFC, 0x0A, 0xFE,
-    0x07, 0xF0, 0x3F, 0xB0, 0x00, 0xFC, 0x1F, 0xC2, 0xF4, 0x00, 0x00, 0xF8, 0x7F, 0x0F, 0x80, 0x00,
-    0x02, 0xFA, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x6F, 0xCB, 0xF0,
-    0x00, 0x07, 0xF8, 0x7F, 0x0F, 0xE0, 0x00, 0x3F, 0xC1, 0xFC, 0x2F, 0xD0, 0x02, 0xFE, 0x07, 0xF0,
-    0x3F, 0xC0, 0x2F, 0xF0, 0x7F, 0xF0, 0x7F, 0xC1, 0xFF, 0x03, 0xFF, 0xC0, 0xBF, 0xC0, 0x50, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x15, 0x40, 0x01, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0xFD, 0x0B,
-    0xF8, 0x08, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x16,
-    0xFE, 0x01, 0x00, 0x3F, 0xC3, 0xD0, 0x0F, 0xF1, 0xFD, 0x07, 0xF8, 0x3F, 0xFF, 0xFC, 0x02, 0xFF,
-    0xF8, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xFE, 0x0F, 0xFF, 0x4F, 0xFF, 0x43, 0xFF, 0xC0, 0x7F, 0x40,
-    0x3F, 0x80, 0x1F, 0xD0, 0x2F, 0xE0, 0x07, 0xF4, 0x2F, 0xF8, 0x01, 0xFD, 0x2F, 0xFE, 0x00, 0x7F,
-    0x6F, 0x3F, 0x80, 0x1F, 0xFF, 0x0F, 0xE0, 0x07, 0xFF, 0x03, 0xF8, 0x01, 0xFF, 0x00, 0xFE, 0x00,
-    0x7F, 0x40, 0x3F, 0x80, 0xBF, 0xF4, 0x2F, 0xFD, 0x3F, 0xFE, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x3F, 0xFD, 0x3F,
-    0xFD, 0x0F, 0xFF, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0xBF, 0x80, 0x1F, 0xD0, 0xBF, 0xE0,
-    0x07, 0xF4, 0xBF, 0xF8, 0x01, 0xFD, 0xBC, 0xFE, 0x00, 0x7F, 0xFC, 0x3F, 0x80, 0x1F, 0xFC, 0x0F,
-    0xE0, 0x07, 0xFC, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xFE, 0x02, 0xFF, 0xD0, 0xBF, 0xF4, 0xFF, 0xF8,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x3F, 0xFE, 0x03, 0xF4, 0x3F, 0xFD, 0x0F, 0xF8, 0x07, 0xF4,
-    0x2F, 0xE8, 0x07, 0xF4, 0x3F, 0x00, 0x07, 0xF4, 0xBC, 0x00, 0x07, 0xFA, 0xF8, 0x00, 0x07, 0xFF,
-    0xFC, 0x00, 0x07, 0xF5, 0xFE, 0x00, 0x07, 0xF4, 0xBF, 0x40, 0x07, 0xF4, 0x3F, 0xC0, 0x07, 0xF4,
-    0x2F, 0xE0, 0x2F, 0xFD, 0x0F, 0xF8, 0x3F, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x07, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x7D, 0x1F, 0xD0, 0x00, 0x7C, 0x1F, 0xD0, 0x00, 0x7C,
-    0x1F, 0xD0, 0x00, 0xBC, 0x1F, 0xD0, 0x00, 0xB8, 0x1F, 0xD0, 0x00, 0xF8, 0x1F, 0xD0, 0x00, 0xF4,
-    0x1F, 0xD0, 0x22, 0xF0, 0x1F, 0xD0, 0x7F, 0xE0, 0x1F, 0xE0, 0xBF, 0xC0, 0xFF, 0xFC, 0x7F, 0x42,
-    0xFF, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0xBF, 0xF4, 0x02, 0xFF, 0xD0,
-    0x7F, 0xF0, 0x0F, 0xFC, 0x01, 0xFF, 0xD0, 0xBF, 0xF0, 0x07, 0xEF, 0x83, 0xEF, 0xC0, 0x1F, 0x7F,
-    0x2E, 0x7F, 0x00, 0x7D, 0x7E, 0xF5, 0xFC, 0x01, 0xF4, 0xFF, 0xC7, 0xF0, 0x07, 0xD2, 0xFD, 0x1F,
-    0xC0, 0x1F, 0x43, 0xF0, 0x7F, 0x00, 0x7D, 0x0B, 0x41, 0xFC, 0x07, 0xFE, 0x00, 0x2F, 0xFD, 0x3F,
-    0xFC, 0x01, 0xFF, 0xF8, 0x3F, 0xFE, 0x0F, 0xFF, 0x8F, 0xFF, 0x43, 0xFF, 0xD0, 0x7F, 0x40, 0x3F,
-    0xC0, 0x1F, 0xD0, 0x0F, 0xF0, 0x07, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0xAA, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xE5, 0x5F, 0xF0, 0x07, 0xF4, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x7F,
-    0x40, 0x3F, 0xC0, 0xBF, 0xF8, 0x2F, 0xFD, 0x3F, 0xFE, 0x0F, 0xFF, 0x80, 0x00, 0x05, 0x50, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x1F, 0xF4, 0x1F, 0xD0, 0x1F, 0xF0, 0xFF,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00,
-    0x3F, 0xC3, 0xFE, 0x01, 0xFE, 0x07, 0xFE, 0x1F, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x80,
-    0x7F, 0x80, 0x1F, 0xD0, 0x0F, 0xE0, 0x07, 0xF4, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0x7F,
-    0x40, 0x3F, 0x80, 0x1F, 0xD0, 0x0F, 0xE0, 0x07, 0xF4, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xFE, 0x00,
-    0x7F, 0x40, 0x3F, 0x80, 0xBF, 0xF8, 0x3F, 0xFD, 0x3F, 0xFE, 0x1F, 0xFF, 0x40, 0x00, 0x40, 0x14,
-    0x01, 0xFF, 0x9F, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xAF, 0xFC, 0x0B, 0xF4, 0x0F, 0xF4,
-    0x2F, 0xC0, 0x2F, 0xE0, 0xBF, 0x00, 0x7F, 0x82, 0xFC, 0x01, 0xFE, 0x0B, 0xF0, 0x07, 0xF8, 0x2F,
-    0xC0, 0x1F, 0xD0, 0xBF, 0x00, 0xFF, 0x02, 0xFE, 0x5B, 0xF8, 0x0B, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
-    0xF4, 0x00, 0xBF, 0x54, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0x1A, 0xAA, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFF, 0x00, 0x3F,
-    0xFF, 0xE0, 0x3F, 0xD3, 0xFC, 0x1F, 0xD0, 0x7F, 0x0F, 0xF0, 0x0E, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xFA, 0xAC, 0x0B,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
-    0xE3, 0xE1, 0xFE, 0x1F, 0x8F, 0x43, 0xF8, 0x3D, 0x3D, 0x0F, 0xE0, 0xF0, 0x10, 0x3F, 0x81, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x01, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF,
-    0x82, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xE0, 0x00,
-    0xBF, 0x43, 0xF4, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0xBD, 0x00, 0x00, 0x3F, 0x7F, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x01, 0xE2, 0xFD, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xE3, 0xF9, 0xFF, 0x81, 0xFD, 0x0F, 0xE0, 0xFF, 0x0F,
-    0xF0, 0x3F, 0x81, 0xFD, 0x3F, 0xC0, 0xFE, 0x03, 0xF8, 0xFE, 0x03, 0xF8, 0x0F, 0xE3, 0xFC, 0x0F,
-    0xE0, 0x3F, 0x8F, 0xF0, 0x3F, 0x81, 0xFD, 0x2F, 0xE0, 0xFE, 0x0F, 0xF0, 0x3F, 0xE7, 0xF9, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x2A, 0xAA, 0x40, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF4, 0x07,
-    0xFC, 0x1F, 0xC0, 0x02, 0xFE, 0x3F, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBE, 0xFE, 0x00, 0x02, 0xF8, 0xBF, 0x40, 0x0B,
-    0xF0, 0x3F, 0xD0, 0x3F, 0xF4, 0x7F, 0xFC, 0xBF, 0xF8, 0xFF, 0xFC, 0x3F, 0xFF, 0x2F, 0xFF, 0x43,
-    0xFF, 0xD1, 0xFF, 0xE0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x07, 0xF4, 0x07,
-    0xF8, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x07,
-    0xF4, 0x07, 0xF8, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x07, 0xF8, 0x07, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x20, 0xBF, 0xFC, 0xBF, 0xFC,
-    0xBF, 0xF8, 0x7F, 0xF8, 0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x1F, 0xD0,
-    0x0F, 0xF0, 0x1F, 0xD0, 0x07, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x6F, 0xD0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC,
-    0x3F, 0xFD, 0x7F, 0xF5, 0xFF, 0xF0, 0xFF, 0xF1, 0xFF, 0xC7, 0xFF, 0x80, 0x7F, 0x01, 0xFC, 0x07,
-    0xF4, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xD0, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x40, 0x1F, 0xC0, 0x7F,
-    0x01, 0xFD, 0x00, 0x7F, 0x01, 0xFC, 0x07, 0xF4, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xD0, 0x07, 0xF0,
-    0x1F, 0xC0, 0x7F, 0x40, 0x1F, 0xC0, 0x7F, 0x01, 0xFD, 0x00, 0x7F, 0x41, 0xFD, 0x07, 0xF4, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFD, 0x7F, 0xF5, 0xFF,
-    0xF0, 0xFF, 0xF1, 0xFF, 0xC7, 0xFF, 0x80, 0x7F, 0x01, 0xFC, 0x07, 0xF4, 0x01, 0xFC, 0x07, 0xF0,
-    0x1F, 0xD0, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x40, 0x1F, 0xC0, 0x7F, 0x01, 0xFD, 0x00, 0x7F, 0x01,
-    0xFC, 0x07, 0xF4, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xD0, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x40, 0x1F,
-    0xC0, 0x7F, 0x01, 0xFD, 0x00, 0x7F, 0x41, 0xFD, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3E, 0x1F, 0xD0, 0x00, 0x3D,
-    0x1F, 0xD0, 0x00, 0x3C, 0x1F, 0xD5, 0x40, 0x04, 0x1F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x1F, 0xD0, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0x00, 0x1F, 0xD0, 0xBF, 0x00, 0x1F, 0xD1, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x1F, 0xFF,
-    0xC3, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0x40, 0x00, 0x2F,
-    0xD0, 0x07, 0xF5, 0x50, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0x42,
-    0xFD, 0x00, 0x7F, 0x43, 0xFC, 0x2F, 0xD0, 0x07, 0xF4, 0x2F, 0xC2, 0xFD, 0x00, 0x7F, 0x42, 0xFC,
-    0x2F, 0xD0, 0x07, 0xF4, 0x7F, 0x82, 0xFD, 0x02, 0xFF, 0xFF, 0xF0, 0xBF, 0xFC, 0x3F, 0xFF, 0xF8,
-    0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF5, 0x50, 0x00, 0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF,
-    0x80, 0x7F, 0x43, 0xFC, 0x07, 0xF4, 0x2F, 0xC0, 0x7F, 0x42, 0xFC, 0x07, 0xF4, 0x7F, 0x82, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0xFF, 0xFD, 0x02,
-    0xFF, 0xFF, 0xD0, 0xFD, 0x07, 0xFC, 0x18, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xE0, 0x0F, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFE, 0x00, 0x15, 0x7F, 0x81, 0x00, 0x1F, 0xD3, 0xD0, 0x0B, 0xF1, 0xFD, 0x07, 0xF8,
-    0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x03,
-    0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x3F, 0xFD, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0x40, 0xFF, 0x5F, 0xF8,
-    0x07, 0xF4, 0x2F, 0xC0, 0x7F, 0xC0, 0x7F, 0x43, 0xFC, 0x03, 0xFC, 0x07, 0xFF, 0xFF, 0x80, 0x2F,
-    0xC0, 0x7F, 0xFF, 0xF8, 0x02, 0xFC, 0x07, 0xF9, 0xBF, 0x80, 0x2F, 0xC0, 0x7F, 0x43, 0xFC, 0x03,
-    0xFC, 0x07, 0xF4, 0x3F, 0xD0, 0x3F, 0x80, 0x7F, 0x42, 0xFF, 0x5F, 0xF0, 0x2F, 0xFD, 0x0F, 0xFF,
-    0xFD, 0x03, 0xFF, 0xE0, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0x80, 0xBF, 0x43, 0xF8, 0x03, 0xF8, 0x0F, 0xE0, 0x0F, 0xF0, 0x3F, 0x80,
-    0x2F, 0xE0, 0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFC, 0x3F, 0x80, 0x0F,
-    0xF0, 0xFE, 0x00, 0xBF, 0x43, 0xF8, 0x0B, 0xF8, 0x3F, 0xFC, 0x7F, 0xC1, 0xFF, 0xF4, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00, 0xFE, 0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4,
-    0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F,
-    0x40, 0x7F, 0x4F, 0xE0, 0x0F, 0xC3, 0xF4, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x03, 0xF8, 0x2F, 0xD1, 0xFC, 0x03, 0xF8, 0xFE, 0x00,
-    0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x07, 0xFE, 0x96, 0xD0, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x10, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFA,
-    0xA0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF1, 0xFF,
-    0x80, 0x2F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x02, 0xFE, 0x03, 0xFD, 0x0B, 0xF4, 0x0B, 0xF8,
-    0x2F, 0xD0, 0x1F, 0xE0, 0xBF, 0x40, 0x7F, 0x82, 0xFD, 0x01, 0xFE, 0x0B, 0xF4, 0x07, 0xF8, 0x2F,
-    0xD0, 0x1F, 0xE3, 0xFF, 0xD0, 0x7F, 0x5F, 0xFF, 0x82, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF,
-    0xFF, 0xD0, 0x7F, 0x82, 0xF4, 0x1F, 0xE0, 0x7D, 0x07, 0xF8, 0x0F, 0x01, 0xFE, 0x02, 0x40, 0x7F,
-    0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xBF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x3F, 0xFF, 0xF8,
-    0x3F, 0x80, 0xBE, 0x1F, 0xC0, 0x0F, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0xAD, 0x00, 0xFF, 0xFF, 0x40,
-    0x3F, 0xEA, 0x80, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xF9, 0x6E, 0x0F, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0x80, 0x01, 0x54, 0x00, 0x00, 0x55, 0x00, 0x1F, 0xFF, 0x82, 0xFE, 0xFF, 0x0F,
-    0xC0, 0x7D, 0x7F, 0x00, 0xF1, 0xFF, 0x80, 0x03, 0xFF, 0xF4, 0x03, 0xFF, 0xF8, 0x02, 0xFF, 0xF4,
-    0x40, 0x7F, 0xEB, 0x80, 0x3F, 0xBF, 0x40, 0xFD, 0xBF, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x40, 0x01, 0xFD, 0x00, 0xBF, 0xC0, 0x2F, 0xE0, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x7F, 0xF8, 0x02, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE,
-    0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x02, 0xFF, 0xF4, 0xFF, 0xFD, 0x00, 0x00,
-    0x07, 0xD1, 0xF8, 0xFF, 0x2F, 0xCF, 0xE2, 0xFC, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x7F, 0xF8, 0x00, 0xBF, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F,
-    0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0x43, 0xFF, 0xF4,
-    0x00, 0x04, 0x00, 0x2F, 0xC0, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x1F, 0xFC, 0x0F, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0,
-    0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xFF, 0x00,
-    0x3F, 0x80, 0x3F, 0xD0, 0x7F, 0xE0, 0x7F, 0xF0, 0x0B, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7D, 0x2F, 0xC0, 0x00, 0x00, 0x7C, 0x2F, 0xC0, 0x00, 0x00,
-    0xBC, 0x2F, 0xD5, 0x00, 0x00, 0xBC, 0x2F, 0xFF, 0xF0, 0x00, 0xF8, 0x2F, 0xEB, 0xFC, 0x00, 0xF8,
-    0x2F, 0xC1, 0xFD, 0x01, 0xF4, 0x2F, 0xC0, 0xFD, 0x22, 0xF0, 0x2F, 0xC0, 0xFD, 0x7F, 0xE0, 0x2F,
-    0xC2, 0xFC, 0xBF, 0xC0, 0xBF, 0xFF, 0xF8, 0x7F, 0x40, 0xFF, 0xFF, 0x90, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0x1F, 0xFF, 0x40, 0x03, 0xFF, 0xD1, 0xFF, 0xF0, 0x00, 0x07, 0xF4, 0x03, 0xF8,
-    0x00, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x03, 0xF9, 0x50, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0xFF, 0x80, 0x7F, 0x95, 0xBF, 0x82, 0xFC, 0x07, 0xF4, 0x03,
-    0xF8, 0x1F, 0xC0, 0x7F, 0x40, 0x3F, 0x81, 0xFC, 0x07, 0xF4, 0x03, 0xF8, 0x3F, 0xC2, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFE, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x6F,
-    0xFA, 0xA0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF1, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xE0, 0x3F,
-    0xD0, 0x0B, 0xF4, 0x0B, 0xF4, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0xBF, 0x40, 0x7F, 0x40, 0x2F, 0xD0,
-    0x1F, 0xD0, 0x0B, 0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD, 0x02, 0xFF, 0xD1, 0xFF, 0xF1, 0xFF,
-    0xF8, 0xFF, 0xFC, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x3F, 0xFE, 0x03, 0xF4, 0x3F, 0xFD, 0x0F, 0xF8, 0x07, 0xF4, 0x2F, 0xE8, 0x07,
-    0xF4, 0x3F, 0x00, 0x07, 0xF4, 0xBC, 0x00, 0x07, 0xFA, 0xF8, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x07,
-    0xF5, 0xFE, 0x00, 0x07, 0xF4, 0xBF, 0x40, 0x07, 0xF4, 0x3F, 0xC0, 0x07, 0xF4, 0x2F, 0xE0, 0x2F,
-    0xFD, 0x0F, 0xF8, 0x3F, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x0F,
-    0xFF, 0x4F, 0xFF, 0x43, 0xFF, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0x1F, 0xD0, 0x2F, 0xE0, 0x07, 0xF4,
-    0x2F, 0xF8, 0x01, 0xFD, 0x2F, 0xFE, 0x00, 0x7F, 0x6F, 0x3F, 0x80, 0x1F, 0xFF, 0x0F, 0xE0, 0x07,
-    0xFF, 0x03, 0xF8, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0xBF, 0xF4, 0x2F, 0xFD,
-    0x3F, 0xFE, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x2F, 0x43,
-    0xF0, 0x00, 0x07, 0xFA, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFC, 0x3F, 0xFC, 0x7F, 0xFE, 0x0B, 0xFE, 0x03, 0xFD, 0x00, 0xBE, 0x00,
-    0x7F, 0x80, 0x3F, 0x00, 0x0F, 0xF0, 0x1F, 0x80, 0x02, 0xFD, 0x0F, 0xD0, 0x00, 0x3F, 0x83, 0xF0,
-    0x00, 0x0B, 0xF2, 0xF4, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x04, 0x03,
-    0xF0, 0x00, 0x07, 0x8B, 0xF4, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x2F, 0xFF, 0x4F, 0xFF, 0x47, 0xFF, 0x80, 0x7F, 0x40, 0x7F,
-    0x80, 0x1F, 0xD0, 0x1F, 0xE0, 0x07, 0xF4, 0x07, 0xF8, 0x01, 0xFD, 0x01, 0xFE, 0x00, 0x7F, 0x40,
-    0x7F, 0x80, 0x1F, 0xD0, 0x1F, 0xE0, 0x07, 0xF4, 0x07, 0xF8, 0x01, 0xFD, 0x01, 0xFE, 0x00, 0x7F,
-    0x80, 0x7F, 0x80, 0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x6A, 0xAA, 0x40, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xE4, 0xBF,
-    0x45, 0xF4, 0x0F, 0x41, 0xFC, 0x03, 0xD0, 0x3C, 0x07, 0xF0, 0x0F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFA, 0xFF, 0xD0, 0x00,
-    0x1F, 0xC0, 0x7F, 0xC0, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x07, 0xF0,
-    0x0F, 0xF0, 0x00, 0x2F, 0xE6, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x3C, 0x2F, 0xC1, 0xF0, 0x3C, 0x2F, 0xC1, 0xE0, 0x14, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xD9,
-    0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x2F, 0xD7, 0xFC, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x2F, 0xC0,
-    0xFE, 0x00, 0x2F, 0xC2, 0xFD, 0x01, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0x40, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x40, 0x00, 0x3F,
-    0xDB, 0xF0, 0x00, 0x03, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x95,
-    0x55, 0x7F, 0xDF, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x07, 0xF4,
-    0x3F, 0xF0, 0x00, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFC, 0x03, 0xF8, 0x0F, 0xF4, 0x1F, 0xC0, 0x0F, 0xF0, 0xFE, 0x00, 0x2F, 0xC3, 0xFD, 0x55,
-    0xBF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0x95, 0x5B, 0xF0, 0xFE, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0xFE,
-    0x07, 0xFC, 0x0B, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x15, 0x55, 0x40, 0x01, 0xF4, 0xBF, 0xFF, 0xC0, 0x0B, 0xFC, 0x7F, 0xFF, 0x40, 0x1F, 0xFD, 0x0F,
-    0xFC, 0x00, 0x3F, 0xFC, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0x02, 0xFF,
-    0x00, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x00, 0x7F, 0xC3,
-    0xF4, 0x00, 0x00, 0x3F, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0xD7, 0xE0, 0x00, 0x00, 0x0F, 0xEB, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x1F, 0xFF, 0xC0, 0x2F, 0xD3, 0xFF, 0xE0, 0x1F, 0xF8, 0x3F, 0xD0, 0x0F, 0xFD,
-    0x07, 0xFC, 0x03, 0xF2, 0x00, 0xFF, 0x02, 0xF4, 0x00, 0x2F, 0xD0, 0xFC, 0x00, 0x03, 0xF8, 0x7E,
-    0x00, 0x00, 0xBF, 0x2F, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x74, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x6F, 0x80, 0x00, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x54, 0x05, 0x55, 0x50, 0xFF, 0xFF, 0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x40, 0xBF, 0xFE, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFC,
-    0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xC1, 0xFC, 0xFF, 0x00, 0x0F, 0xF1,
-    0xFC, 0x3F, 0xC0, 0x03, 0xFD, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xFC,
-    0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40,
-    0x03, 0xFD, 0x02, 0xFF, 0xFD, 0x0B, 0xFF, 0xF8, 0xFF, 0xFF, 0x43, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x3F, 0xFD, 0x3F,
-    0xFC, 0x0F, 0xFF, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x1F, 0xC0, 0xBF, 0xE0,
-    0x07, 0xF0, 0xBF, 0xF8, 0x01, 0xFC, 0xBC, 0xFE, 0x00, 0x7F, 0xFC, 0x3F, 0x80, 0x1F, 0xFC, 0x0F,
-    0xE0, 0x07, 0xFC, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x02, 0xFF, 0xD0, 0xFF, 0xF8, 0xFF, 0xF4,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x15, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2B, 0xFE, 0xA0, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFC, 0x0B, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x01, 0xFD, 0x03, 0xFC, 0x02, 0xFD,
-    0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x6F, 0xF8, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xFF, 0xF4, 0x06, 0xFF, 0xA8, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0x02, 0xFD, 0x54, 0x00, 0xBF, 0xFF, 0xD0, 0x2F, 0xFB, 0xFD, 0x0B, 0xF0, 0x3F, 0x82, 0xFC,
-    0x0F, 0xF0, 0xBF, 0x03, 0xFC, 0x2F, 0xC1, 0xFE, 0x7F, 0xFF, 0xFF, 0x2F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x6A, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x03, 0xFC,
-    0x1F, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC,
-    0xF7, 0xF8, 0x03, 0xFC, 0x7F, 0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFE,
-    0x97, 0x80, 0x03, 0xFC, 0x02, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x40, 0x14, 0x01, 0xFF, 0x9F,
-    0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xAF, 0xFC, 0x0B, 0xF4, 0x0F, 0xF4, 0x2F, 0xC0, 0x2F,
-    0xE0, 0xBF, 0x00, 0x7F, 0x82, 0xFC, 0x01, 0xFE, 0x0B, 0xF0, 0x07, 0xF8, 0x2F, 0xC7, 0x1F, 0xD0,
-    0xBF, 0x0E, 0xFF, 0x02, 0xFD, 0x2F, 0xF4, 0x0B, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFC, 0x00, 0xBF,
-    0x54, 0xB4, 0x02, 0xFC, 0x00, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x1A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE1,
-    0x55, 0x55, 0xBE, 0x3F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFD, 0x03, 0xFD, 0x55, 0x40, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0x07, 0xF8, 0x05, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00,
-    0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xC0, 0x15, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x55,
-    0xBD, 0x03, 0xFC, 0x01, 0xF4, 0x0F, 0xF0, 0x07, 0xC0, 0x3F, 0xC0, 0x0E, 0x00, 0xFF, 0x00, 0x00,
-    0x17, 0xFE, 0x50, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0x7F, 0xD5, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE0, 0x7F, 0x81, 0xF8,
-    0x1F, 0xE0, 0x3D, 0x07, 0xF8, 0x0F, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xAF, 0xFA, 0x00,
-    0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x15, 0x55, 0x55, 0x50, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF4,
-    0x1F, 0xC0, 0x03, 0xFC, 0x02, 0xF0, 0x00, 0xFF, 0x00, 0x78, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xEA, 0xFF, 0xF0,
-    0x0F, 0xF0, 0x07, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x03,
-    0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0x2F, 0xFF, 0xC0, 0x3F, 0xCF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFD, 0x00, 0x7F,
-    0x40, 0xF4, 0x01, 0xFC, 0x03, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xD5, 0x50, 0x00, 0x7F, 0xFF,
-    0xF4, 0x01, 0xFF, 0xBF, 0xF4, 0x07, 0xF0, 0x1F, 0xF0, 0x1F, 0xC0, 0x2F, 0xD0, 0x7F, 0x00, 0x7F,
-    0x8B, 0xFF, 0x40, 0xFE, 0x3F, 0xFE, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7E, 0x40, 0x00, 0x02,
-    0x80, 0x05, 0x55, 0x50, 0x06, 0x80, 0x0F, 0xF4, 0x0F, 0xFF, 0xF0, 0x2F, 0xE0, 0x0F, 0xFC, 0x0B,
-    0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0x00, 0xFE, 0x01,
-    0xF8, 0x00, 0x00, 0x1F, 0x80, 0xFE, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0xFE, 0x0B, 0xD0, 0x00,
-    0x00, 0x03, 0xF0, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0xFE,
-    0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xFE, 0x03, 0xFE,
-    0x00, 0x02, 0xFF, 0x00, 0xFE, 0x01, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0xFF, 0x40, 0xBF, 0xD0, 0x2F,
-    0xF8, 0x0F, 0xFF, 0xF0, 0x3F, 0xF4, 0x7F, 0xE0, 0x1F, 0xFF, 0xF0, 0x0F, 0xFD, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7F, 0x03, 0xFF,
-    0xD0, 0xBF, 0x02, 0xFF, 0x0B, 0xFE, 0x07, 0xFC, 0x0A, 0xFE, 0x07, 0xF0, 0x3F, 0xB0, 0x00, 0xFC,
-    0x1F, 0xC2, 0xF4, 0x00, 0x00, 0xF8, 0x7F, 0x0F, 0x80, 0x00, 0x02, 0xFA, 0xFD, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x6F, 0xCB, 0xF0, 0x00, 0x07, 0xF8, 0x7F, 0x0F, 0xE0,
-    0x00, 0x3F, 0xC1, 0xFC, 0x2F, 0xD0, 0x02, 0xFE, 0x07, 0xF0, 0x3F, 0xC0, 0x2F, 0xF0, 0x7F, 0xF0,
-    0x7F, 0xC1, 0xFF, 0x03, 0xFF, 0xC0, 0xBF, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x2B, 0xE8, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD,
-    0x03, 0xF0, 0x0B, 0xFC, 0x0F, 0x80, 0x0F, 0xF0, 0x3D, 0x00, 0x3F, 0xC0, 0x10, 0x01, 0xFD, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x3C, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0xFF, 0x4F, 0xF8, 0x0B,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x52, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x15, 0x40, 0x01, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0xFD, 0x0B, 0xF8, 0x08, 0x00, 0xFE, 0x00,
-    0x00, 0x7F, 0x00, 0x0F, 0xFF, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x16, 0xFE, 0x01, 0x00, 0x3F, 0xC3,
-    0xD0, 0x0F, 0xF1, 0xFD, 0x07, 0xF8, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x06, 0x7E, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x15, 0x55, 0x40,
-    0x0A, 0x40, 0xFF, 0xFF, 0x41, 0xFF, 0x02, 0xFF, 0xF4, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0xBF, 0xF0,
-    0x03, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0xFF,
-    0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xC3, 0xFC,
-    0x00, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xE0, 0x2F, 0xFF, 0xC0, 0xBF, 0xE0, 0xFF, 0xFF,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x3F, 0xFE, 0x03, 0xF4, 0x3F, 0xFD, 0x0F, 0xF8, 0x07, 0xF4, 0x2F, 0xE8, 0x07,
-    0xF4, 0x3F, 0x00, 0x07, 0xF4, 0xBC, 0x00, 0x07, 0xFA, 0xF8, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x07,
-    0xF5, 0xFE, 0x00, 0x07, 0xF4, 0xBF, 0x40, 0x07, 0xF4, 0x3F, 0xC0, 0x07, 0xF4, 0x2F, 0xE0, 0x2F,
-    0xFD, 0x0F, 0xF8, 0x3F, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x14, 0x15, 0x55, 0x40, 0x02, 0x90,
-    0x3F, 0xFF, 0xD0, 0x1F, 0xF0, 0x2F, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0xB0, 0xF8, 0x00, 0x03, 0xFC, 0xF2, 0xF0, 0x00, 0x03, 0xFC,
-    0xF3, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0xF7,
-    0xF8, 0x00, 0x03, 0xFC, 0xF3, 0xFC, 0x00, 0x03, 0xFC, 0xF1, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x2F, 0xFF, 0xC0, 0x1F, 0xFC,
-    0x3F, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x0F, 0xFF,
-    0x40, 0x7F, 0x03, 0xFF, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x2F, 0xB0, 0x07, 0xF2, 0x0F, 0x40, 0x01,
-    0xFC, 0xD7, 0xC0, 0x00, 0x7F, 0x7B, 0xD0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xF3, 0x6F, 0x40,
-    0x01, 0xFC, 0xD7, 0xF0, 0x00, 0x7F, 0x20, 0xFE, 0x00, 0x1F, 0xC0, 0x1F, 0xD0, 0x2F, 0xFC, 0x03,
-    0xFC, 0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0x40, 0x15, 0x55, 0x40, 0x0A, 0x40, 0xFF,
-    0xFF, 0x40, 0xFF, 0x02, 0xFF, 0xF4, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0xF0, 0x2B, 0xFE, 0x83,
-    0xF0, 0x00, 0xFF, 0xFF, 0x1F, 0x40, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0xFF, 0x0B, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0xFF,
-    0x07, 0xF8, 0x00, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F,
-    0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xE0, 0x2F, 0xFF, 0xC0, 0xBF, 0xE0, 0xFF, 0xFF, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x06, 0xA0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x40, 0xBF, 0xFF, 0x07, 0xF0, 0x6F, 0xFA, 0x0F,
-    0xF4, 0x0B, 0xF0, 0x3F, 0xF4, 0x0B, 0xF0, 0x7E, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x0B, 0xF6, 0xF4,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xF1, 0xFD, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x0B, 0xF0, 0x7F,
-    0x80, 0x0B, 0xF0, 0x3F, 0xD0, 0x7F, 0xFC, 0x0F, 0xF4, 0xBF, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x50, 0x15, 0x55, 0x55, 0x00, 0x68, 0x03, 0xFF, 0xFF, 0xF4, 0x1F, 0xF0, 0x3F, 0xFF, 0xFD, 0x03,
-    0xFF, 0x03, 0xF4, 0xFF, 0x00, 0xBF, 0xF0, 0x3E, 0x0F, 0xF0, 0x1F, 0xC0, 0x03, 0xD0, 0xFF, 0x03,
-    0xF0, 0x00, 0x04, 0x0F, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0x0F,
-    0xF0, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0xBF, 0xFF, 0x03, 0xFF, 0x40, 0x0F,
-    0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xFF,
-    0xFF, 0xE0, 0x3F, 0x83, 0xFF, 0xFF, 0x43, 0xFE, 0x0F, 0x87, 0xF4, 0x2F, 0xE8, 0x3D, 0x1F, 0xD0,
-    0xFC, 0x00, 0xF0, 0x7F, 0x4B, 0xC0, 0x00, 0x41, 0xFE, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x1F, 0xD7, 0xF8, 0x00, 0x00, 0x7F, 0x4B, 0xF4, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x07,
-    0xF4, 0x2F, 0xE0, 0x00, 0xBF, 0xF4, 0x3F, 0xE0, 0x07, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x15, 0x55, 0x40, 0x55, 0x55, 0x03, 0xFF, 0xFD, 0x0F, 0xFF, 0xF8, 0x2F, 0xFF, 0x80,
-    0xBF, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0,
-    0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFE, 0xAA, 0xAF, 0xF4, 0x00, 0x3F,
-    0xC0, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x03,
-    0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0x2F, 0xFF, 0xD0, 0xBF, 0xFF, 0xC3,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x0F, 0xFF, 0x83, 0xFF, 0xD0, 0xFF, 0xF4, 0x07,
-    0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0xEA, 0xBF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x95, 0x7F, 0xC0, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x7F,
-    0x40, 0x3F, 0xC0, 0x07, 0xF4, 0x03, 0xFC, 0x02, 0xFF, 0xE0, 0xBF, 0xFC, 0x3F, 0xFE, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x24, 0x15, 0x55, 0x40, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xC2, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x2F, 0xD1, 0xFC,
-    0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x3E, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x0F, 0x80, 0x3F, 0xC0, 0x00,
-    0xBF, 0x41, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x2F,
-    0xD0, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0xBF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x0F, 0xFF, 0xFE, 0x3F, 0xFD, 0x0F,
-    0xFF, 0xFE, 0x07, 0xF4, 0x03, 0xFC, 0x7E, 0x07, 0xF4, 0x03, 0xFC, 0x3E, 0x07, 0xF4, 0x03, 0xFC,
-    0x3D, 0x07, 0xFE, 0xAB, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xF9, 0x57, 0xFC, 0x00,
-    0x07, 0xF4, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x2F,
-    0xFE, 0x0B, 0xFF, 0x40, 0x3F, 0xFE, 0x0F, 0xFF, 0x80, 0x15, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF1, 0x54, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x03,
-    0xFD, 0x5B, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x07, 0xFD, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x0B,
-    0xF8, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0xFF,
-    0x40, 0x0F, 0xF4, 0x00, 0xFE, 0x2F, 0xFF, 0xC2, 0xFF, 0xFC, 0x07, 0xF8, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xF0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0x01, 0xFD, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x1F, 0xEF, 0xF8, 0x00, 0x7F, 0x40,
-    0x7F, 0xFF, 0xFC, 0x01, 0xFD, 0x01, 0xFE, 0x5B, 0xFC, 0x07, 0xF4, 0x07, 0xF0, 0x0B, 0xF0, 0x1F,
-    0xD0, 0x1F, 0xC0, 0x1F, 0xD0, 0x7F, 0x40, 0x7F, 0x00, 0x3F, 0x8B, 0xFF, 0x47, 0xFF, 0x40, 0xFE,
-    0x3F, 0xFE, 0x2F, 0xFD, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x06, 0xB8, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x41, 0xA4, 0x00, 0x0B, 0xF8, 0x0F, 0xFF, 0x40, 0x1F, 0xE0, 0x3F,
-    0xBF, 0xD0, 0x3F, 0xC0, 0xFE, 0x0F, 0xF0, 0x7F, 0x80, 0xFD, 0x0B, 0xF4, 0xBF, 0x42, 0xFC, 0x07,
-    0xF4, 0xFF, 0x42, 0xFC, 0x07, 0xF8, 0xFF, 0x03, 0xFC, 0x07, 0xF4, 0xFF, 0x42, 0xFC, 0x07, 0xF4,
-    0xFF, 0x42, 0xFD, 0x0B, 0xF0, 0xBF, 0x81, 0xFD, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x0F, 0xD0, 0x2F,
-    0xF0, 0x7F, 0x7F, 0x80, 0x0F, 0xFD, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x6F,
-    0xFF, 0xBF, 0xFD, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x3F, 0xD0, 0x69, 0x00, 0x2F, 0xC2, 0xFF, 0xE0, 0x1F, 0xC1, 0xFD, 0xFD, 0x0B, 0xF0, 0xFD,
-    0x2F, 0xC3, 0xF8, 0x7F, 0x07, 0xF0, 0xFE, 0x1F, 0xC1, 0xFC, 0x3F, 0x87, 0xF0, 0x7F, 0x0F, 0xF0,
-    0xFC, 0x2F, 0x82, 0xFC, 0x2F, 0x8F, 0xC0, 0x3F, 0xC3, 0xFF, 0xD0, 0x07, 0xFE, 0xFF, 0xE6, 0x80,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x14, 0x05, 0x40, 0x00, 0x06, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0x03, 0xFD, 0x00, 0xFC, 0x2F, 0xD0, 0x03, 0xF0, 0xFF, 0x00, 0x0B, 0x87, 0xF4,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x80, 0x01,
-    0x47, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x62, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD3, 0xFC, 0x1F,
-    0xD0, 0x7F, 0x0F, 0xF0, 0x0E, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xFA, 0xAC, 0x0B, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0xBC, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x9F, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0x90, 0x00,
-    0x15, 0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF4, 0x7F,
-    0xC1, 0xFC, 0x3E, 0x03, 0xFC, 0x0F, 0xC3, 0xD0, 0x3F, 0xC0, 0xF8, 0x04, 0x03, 0xFC, 0x05, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xFE, 0x1F, 0x8F, 0x43, 0xF8, 0x3D, 0x3D, 0x0F, 0xE0, 0xF0, 0x10,
-    0x3F, 0x81, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x15, 0x55, 0x01, 0x55, 0x4B, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0xFE, 0x02, 0xFF, 0x80, 0xBF, 0xC0,
-    0x0F, 0xE0, 0x03, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0xFF, 0x47, 0xE0, 0x00,
-    0x03, 0xFC, 0xFC, 0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80, 0x1F, 0xF0,
-    0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xF0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02,
-    0xFC, 0xBD, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x02, 0xAA,
-    0x90, 0x00, 0x15, 0x55, 0x01, 0x55, 0x4B, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0xFE, 0x02, 0xFF, 0x80,
-    0xBF, 0xC0, 0x0F, 0xE0, 0x03, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x2F, 0x40, 0x00, 0xFF, 0x03,
-    0xE0, 0x00, 0x03, 0xF8, 0xBC, 0x00, 0x00, 0x2F, 0xDF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0xAF, 0xFF, 0xA4, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80,
-    0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xE0, 0x00, 0xBF, 0x42, 0xF4, 0x00, 0x0F, 0xE0, 0xFC,
-    0x00, 0x02, 0xFC, 0x7D, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x01, 0x7F, 0xF5, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x02, 0xAA, 0x90, 0x00, 0x15, 0x55, 0x40, 0x55, 0x50, 0x3F, 0xFF, 0xD2, 0xFF, 0xF4, 0x2F, 0xFF,
-    0x81, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x7F, 0xC3,
-    0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xEF, 0xE0, 0x00,
-    0x00, 0x3F, 0x4F, 0xF8, 0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x02, 0xFC, 0x02, 0xFF, 0x00, 0x0B,
-    0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xFF, 0x07, 0xFF, 0xFC, 0xBF, 0xFF, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x3F, 0xFC,
-    0x3F, 0xF8, 0x1F, 0xF4, 0x07, 0xFC, 0x1F, 0xC0, 0x02, 0xFE, 0x3F, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBE, 0xFE, 0x00,
-    0x02, 0xF8, 0xBF, 0x40, 0x0B, 0xF0, 0x3F, 0xD0, 0x3F, 0xF4, 0x7F, 0xFD, 0xBF, 0xF8, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x14, 0x15, 0x55, 0x55, 0x41, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0x83,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xF8, 0x0F, 0x0F, 0xF1, 0xF0, 0x7F, 0x80, 0x3C, 0x3F, 0xC7, 0xC1, 0xFE,
-    0x00, 0xA0, 0xFF, 0x0D, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00,
-    0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC,
-    0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x00,
-    0xFF, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF9, 0x55, 0xBF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x7F, 0xFC, 0x3F, 0xFF, 0xFD, 0x7F, 0xF4, 0x3C, 0x7F, 0x2D, 0x1F, 0xC0, 0x3C, 0x7F, 0x2C,
-    0x1F, 0xC0, 0x28, 0x7F, 0x18, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0x40, 0x2F, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x55, 0x01, 0x55, 0x50, 0xBF, 0xFF, 0x8F,
-    0xFF, 0xF4, 0x7F, 0xFE, 0x07, 0xFF, 0xE0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0xFF,
-    0x00, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0x03, 0xFE, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x1A, 0xA4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0xBF, 0xFC, 0xBF, 0xF8, 0x7F, 0xF8, 0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x1F, 0xD0,
-    0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x1F, 0xD0, 0x07, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xD0,
-    0x00, 0x15, 0x6F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x15, 0x55, 0x01, 0x55, 0x52, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xD7, 0xFF, 0xE0, 0x7F, 0xFE, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00,
-    0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0xC1, 0x0F, 0xF0, 0x00, 0xFF, 0x0D, 0x3F, 0xC0, 0x03, 0xFE,
-    0x74, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xBE, 0x7F,
-    0xC0, 0x00, 0x00, 0x34, 0xFF, 0x00, 0x00, 0x00, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0xBF, 0xFC,
-    0x7F, 0xFD, 0xBF, 0xF8, 0x3F, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xF1,
-    0x4F, 0xE0, 0x0F, 0xF2, 0x8F, 0xE0, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x17,
-    0xCF, 0xE0, 0x00, 0x02, 0x8F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x01,
-    0xFF, 0xFD, 0x15, 0x55, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xAB, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x03, 0xFC,
-    0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00,
-    0x7F, 0xC0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC7, 0xFF, 0xFC, 0x00, 0x10, 0x00, 0x00,
-    0x1B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x01, 0x50, 0x00, 0x2F, 0xDB, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0xBF, 0x80, 0xBF, 0x40, 0x2F, 0xD0, 0x1F, 0xD0, 0x0B,
-    0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0xBF, 0x40, 0x7F, 0x40, 0x2F, 0xD0, 0x1F, 0xD0,
-    0x0B, 0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD, 0x02, 0xFF, 0xD1, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF,
-    0xFC, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xE0, 0x0B, 0xF4, 0x1E, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0x4B, 0xF4, 0x00, 0x2F,
-    0xC7, 0xD3, 0xFC, 0x00, 0x0B, 0xF2, 0xFD, 0xFF, 0x55, 0x56, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x10,
-    0x00, 0x2F, 0xFF, 0xAF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFC, 0x1C, 0x3F, 0x82, 0xFD, 0x7C, 0x7F, 0x00, 0xFE, 0xBC, 0xBF, 0x00, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x7F, 0xF9, 0x6D, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xE0, 0x0B, 0xF4, 0x1E, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0x4B, 0xF4, 0x00, 0x2F,
-    0xC7, 0xD3, 0xFC, 0x00, 0x0B, 0xF2, 0xFD, 0xFF, 0x55, 0x56, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x10,
-    0x00, 0x2F, 0xFF, 0xAF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFC, 0x1C, 0x3F, 0x82, 0xFD, 0x7C,
-    0x7F, 0x00, 0xFE, 0xBC, 0xBF, 0x00, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFE, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0xF9, 0x6D, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD,
-    0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x00, 0x00, 0x0E, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x05, 0x55, 0x50, 0x06, 0x80, 0x0F, 0xF4, 0x0F, 0xFF, 0xF0, 0x2F, 0xE0,
-    0x0F, 0xFC, 0x0B, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x3F,
-    0x00, 0xFE, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0xFE, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0xFE,
-    0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x1F, 0xE0, 0x00, 0x00,
-    0x2F, 0xE0, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80,
-    0xFE, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0xFE, 0x01, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0xFF, 0x40,
-    0xBF, 0xD0, 0x2F, 0xF8, 0x0F, 0xFF, 0xF0, 0x3F, 0xF4, 0x7F, 0xE0, 0x1F, 0xFF, 0xF0, 0x0F, 0xFC,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x07,
-    0xF0, 0x3F, 0xFD, 0x0B, 0xF0, 0x2F, 0xF0, 0xBF, 0xE0, 0x7F, 0xC0, 0xAF, 0xE0, 0x7F, 0x03, 0xFB,
-    0x00, 0x0F, 0xC1, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0x87, 0xF0, 0xF8, 0x00, 0x00, 0x2F, 0xAF, 0xDF,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xF6, 0xFC, 0xBF, 0x00, 0x00, 0x7F, 0x87,
-    0xF0, 0xFE, 0x00, 0x03, 0xFC, 0x1F, 0xC2, 0xFD, 0x00, 0x2F, 0xE0, 0x7F, 0x03, 0xFC, 0x02, 0xFF,
-    0x07, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x3F, 0xFC, 0x0B, 0xFC, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x15, 0x55, 0x40, 0x0A, 0x43, 0xFF, 0xFD, 0x03, 0xFD, 0x2F, 0xFF, 0x40, 0xFF, 0xD0, 0x3F, 0xC0,
-    0x2F, 0xFD, 0x03, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x03, 0xFC, 0x2F, 0x40, 0x00,
-    0x3F, 0xD7, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFD, 0x07,
-    0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x03, 0xFC, 0x2F, 0xFF, 0xC0, 0x3F, 0xC3, 0xFF, 0xFC, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0xFF, 0xF8, 0x0F, 0xD3, 0xFF, 0xD0, 0xFF, 0x81, 0xFD, 0x0B, 0xFA, 0x07, 0xF4, 0x3F, 0x00, 0x1F,
-    0xD2, 0xF0, 0x00, 0x7F, 0xBF, 0xD0, 0x01, 0xFF, 0xFF, 0xE0, 0x07, 0xF9, 0x7F, 0xE0, 0x1F, 0xD0,
-    0x3F, 0xC0, 0x7F, 0x40, 0x7F, 0x81, 0xFD, 0x00, 0xFE, 0x2F, 0xFD, 0x03, 0xF8, 0xFF, 0xF8, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0xFF, 0x00, 0x00,
-    0x3F, 0x03, 0xFC, 0x00, 0x00, 0xF8, 0x0F, 0xF0, 0x00, 0x03, 0xE0, 0x3F, 0xC0, 0x00, 0x1F, 0x40,
-    0xFF, 0x00, 0x00, 0x7D, 0x03, 0xFC, 0x00, 0x02, 0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0xC0,
-    0x00, 0x3E, 0x00, 0xFF, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x02, 0x0F, 0xC0, 0x0F, 0xF0, 0x1F, 0xFE,
-    0x00, 0x3F, 0xD0, 0xBF, 0xF0, 0x0F, 0xFF, 0xF9, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x40, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x7D, 0x1F, 0xD0, 0x00, 0x7C, 0x1F, 0xD0, 0x00, 0x7C, 0x1F, 0xD0, 0x00, 0xBC, 0x1F,
-    0xD0, 0x00, 0xB8, 0x1F, 0xD0, 0x00, 0xF8, 0x1F, 0xD0, 0x00, 0xF4, 0x1F, 0xD0, 0x22, 0xF0, 0x1F,
-    0xD0, 0x7F, 0xE0, 0x1F, 0xE0, 0xBF, 0xC0, 0xFF, 0xFE, 0x7F, 0x42, 0xFF, 0xFE, 0x14, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x80, 0x15, 0x55, 0x40, 0x55, 0x55, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE2, 0xFF, 0xF8, 0x0B, 0xFF,
-    0xE0, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD,
-    0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xEA, 0xAA, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0,
-    0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40,
-    0x0F, 0xF4, 0x00, 0x2F, 0xD0, 0x2F, 0xFF, 0xD0, 0x0B, 0xF4, 0x0F, 0xFF, 0xF4, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x1F, 0xFF, 0x8F, 0xFF, 0x43, 0xFF, 0xD0, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0,
-    0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xF5, 0x5F,
-    0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0xBF, 0xF8,
-    0x0F, 0xF0, 0x3F, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0x90, 0x00,
-    0x15, 0x55, 0x40, 0x55, 0x55, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE2, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0,
-    0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00,
-    0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xEA, 0xAA, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03,
-    0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F,
-    0xF4, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xD0, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x0F, 0xFF, 0x83, 0xFF, 0xD0, 0xFF, 0xF4, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0,
-    0x07, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0xEA, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x95,
-    0x7F, 0xC0, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x07, 0xF4, 0x03, 0xFC, 0x02,
-    0xFF, 0xE0, 0xBF, 0xFC, 0x3F, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x40, 0x15,
-    0x55, 0x01, 0x55, 0x52, 0xFF, 0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xE0, 0x7F, 0xFE, 0x01, 0xFE, 0x00,
-    0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xA9, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFC, 0xBF, 0xFC, 0xBF, 0xF8, 0x7F, 0xF8, 0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x1F,
-    0xD0, 0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x1F, 0xD0, 0x07, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x15, 0x6F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x55, 0x40, 0x01, 0x55, 0x50, 0x0F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x0B, 0xFF,
-    0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x01, 0xFB, 0xF4, 0x1F, 0xBF, 0x40, 0x01, 0xF7, 0xF8,
-    0x2F, 0x3F, 0x40, 0x02, 0xF6, 0xFC, 0x3E, 0x3F, 0x40, 0x02, 0xF1, 0xFC, 0x3D, 0x3F, 0x80, 0x02,
-    0xF0, 0xFD, 0x7C, 0x3F, 0x80, 0x03, 0xF0, 0xBF, 0xF8, 0x3F, 0x80, 0x03, 0xF0, 0x7F, 0xF4, 0x3F,
-    0xC0, 0x03, 0xF0, 0x3F, 0xF0, 0x2F, 0xC0, 0x03, 0xF0, 0x2F, 0xE0, 0x2F, 0xC0, 0x07, 0xF0, 0x0F,
-    0xD0, 0x2F, 0xC0, 0x07, 0xE0, 0x0F, 0xC0, 0x2F, 0xD0, 0x3F, 0xFE, 0x06, 0x40, 0xFF, 0xFD, 0x7F,
-    0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x2F, 0xFD,
-    0x00, 0xBF, 0xF4, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x42, 0xFF, 0xC0, 0x07, 0xEF, 0x83,
-    0xEF, 0xC0, 0x07, 0xDF, 0xCB, 0x9F, 0xC0, 0x07, 0xD7, 0xEF, 0x5F, 0xC0, 0x07, 0xD3, 0xFF, 0x1F,
-    0xC0, 0x07, 0xD2, 0xFD, 0x1F, 0xC0, 0x07, 0xD0, 0xFC, 0x1F, 0xC0, 0x07, 0xD0, 0xB4, 0x1F, 0xC0,
-    0x1F, 0xF8, 0x00, 0xBF, 0xFC, 0x3F, 0xFC, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC7, 0xFF, 0xE0, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0,
-    0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x07, 0xFF, 0xF2, 0xFF, 0xFC,
-    0x00, 0x28, 0x02, 0xD0, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x5B, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0,
-    0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00,
-    0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC,
-    0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x2F,
-    0x43, 0xF0, 0x00, 0xFE, 0xBF, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50,
-    0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x4F, 0xF0,
-    0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x15, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F,
-    0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03,
-    0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0,
-    0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x3F,
-    0x00, 0x2F, 0xC7, 0xF4, 0x02, 0xFC, 0x7F, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC,
-    0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0,
-    0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4,
-    0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x05, 0xFC, 0x00, 0x00, 0x3F,
-    0x7F, 0xC0, 0x2F, 0x00, 0x00, 0x1F, 0x8F, 0xF0, 0x02, 0x00, 0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xFF, 0xF4, 0x00, 0x02, 0xF4, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFE, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x05, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x03, 0xD0, 0x2F, 0x80, 0x03, 0xFC,
-    0x01, 0xF4, 0x0F, 0xD0, 0x01, 0xFF, 0xAA, 0xFD, 0x2F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x15, 0x00, 0x14, 0x00, 0x1F, 0xFF, 0x1F, 0xFF, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xD1, 0xFF, 0x82, 0xFD, 0x7F, 0x03, 0xFC, 0x03, 0xF8, 0x54, 0x0F, 0xE0,
-    0x1F, 0xF0, 0x01, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xA9, 0x3F, 0xE7, 0xF8, 0x00, 0x02,
-    0xFC, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD5, 0xFF, 0xF9, 0xAE, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0xBF, 0xF8, 0x2F, 0xFF, 0x40, 0x14, 0x00, 0x05, 0x40, 0x00, 0x00, 0xA0, 0x0A,
-    0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xFD, 0x7F, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA,
-    0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00,
-    0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x0F, 0x40, 0x3F, 0x07, 0xD0, 0x0F, 0xEB, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x03, 0xF8, 0x2F, 0xD1, 0xFC, 0x03,
-    0xF8, 0xFE, 0x00, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xF8, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x96, 0xD0, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0xAF, 0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0xBF, 0x40,
-    0x7F, 0xF0, 0x74, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFD, 0x55, 0x55, 0x57, 0xFD, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x00,
-    0x03, 0xFC, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x0B, 0xF8, 0xBF, 0x40, 0x0F, 0xF0, 0x3F, 0xE5,
-    0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x15,
-    0x00, 0x01, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0xF9, 0x1B, 0xFC, 0x14, 0x00, 0xBF, 0x40, 0x00,
-    0x0F, 0xE0, 0x55, 0x57, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xE0, 0x0F, 0xD3, 0xF8,
-    0x07, 0xF0, 0xBF, 0x47, 0xF8, 0x0F, 0xFF, 0xF8, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x03, 0xF4, 0xBF, 0x00, 0x00,
-    0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0xBF, 0x40, 0x7F, 0xF0, 0x74, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0x55, 0x57, 0xFD, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x0B, 0xF8, 0xBF,
-    0x40, 0x0F, 0xF0, 0x3F, 0xE5, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xF8, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x7D, 0x00, 0xFE, 0x3F, 0xC0, 0x3F, 0x4B, 0xE0,
-    0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFD,
-    0x0F, 0x91, 0xBF, 0xC1, 0x40, 0x0B, 0xF4, 0x00, 0x00, 0xFE, 0x05, 0x55, 0x7F, 0x8F, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0xFD, 0x3F, 0x80, 0x7F, 0x0B, 0xF4, 0x7F, 0x80, 0xFF, 0xFF,
-    0x80, 0x1F, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC3, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x05, 0x55, 0x50, 0x06, 0x80, 0x0F, 0xF4, 0x0F, 0xFF, 0xF0, 0x2F, 0xE0,
-    0x0F, 0xFC, 0x0B, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x3F,
-    0x00, 0xFE, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0xFE, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0xFE,
-    0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x1F, 0xE0, 0x00, 0x00,
-    0x2F, 0xE0, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80,
-    0xFE, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0xFE, 0x01, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0xFF, 0x40,
-    0xBF, 0xD0, 0x2F, 0xF8, 0x0F, 0xFF, 0xF0, 0x3F, 0xF4, 0x7F, 0xE0, 0x1F, 0xFF, 0xF0, 0x0F, 0xFC,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC2,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x07,
-    0xF0, 0x3F, 0xFD, 0x0B, 0xF0, 0x2F, 0xF0, 0xBF, 0xE0, 0x7F, 0xC0, 0xAF, 0xE0, 0x7F, 0x03, 0xFB,
-    0x00, 0x0F, 0xC1, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0x87, 0xF0, 0xF8, 0x00, 0x00, 0x2F, 0xAF, 0xDF,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xF6, 0xFC, 0xBF, 0x00, 0x00, 0x7F, 0x87,
-    0xF0, 0xFE, 0x00, 0x03, 0xFC, 0x1F, 0xC2, 0xFD, 0x00, 0x2F, 0xE0, 0x7F, 0x03, 0xFC, 0x02, 0xFF,
-    0x07, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x3F, 0xFC, 0x0B, 0xFC, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0xFD, 0x3F, 0xC0, 0x01,
-    0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBE, 0x80, 0x01, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x3F, 0x00, 0xBF, 0xC0, 0xF8, 0x00, 0xFF, 0x03, 0xD0, 0x03, 0xFC, 0x01, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x05, 0xBF, 0xF0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0x83, 0xC0, 0x02, 0xFE, 0x3F, 0xC0, 0x0F, 0xF4, 0xFF,
-    0x80, 0xBF, 0xC2, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x7D, 0x00, 0xFE, 0x3F, 0xC0, 0x3F, 0x4B, 0xE0, 0x01, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x1F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFD, 0x0F, 0xD0, 0xBF, 0x80, 0x80,
-    0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0x6F, 0xE0, 0x10,
-    0x03, 0xFC, 0x3D, 0x00, 0xFF, 0x1F, 0xD0, 0x7F, 0x83, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0x80, 0x00,
-    0x14, 0x00, 0x00, 0x05, 0x55, 0x55, 0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xD2, 0xF4, 0x03,
-    0xFC, 0x3F, 0x00, 0xBF, 0x01, 0xE0, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F,
-    0xE0, 0x40, 0x01, 0xFD, 0x3D, 0x00, 0x2F, 0xD7, 0xFD, 0x5B, 0xFC, 0x3F, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x55, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xE3, 0xFA, 0xAF, 0xF0,
-    0xF0, 0x0B, 0xF0, 0x2C, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x1F, 0xD3, 0xC0, 0x0B, 0xF1, 0xF8, 0x07, 0xFC, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC,
-    0x00, 0x1A, 0xA0, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x50, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x0F, 0xFF, 0xF4, 0xBF, 0xFD, 0x02, 0xFF, 0xF8, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xF0,
-    0x03, 0xFF, 0xC0, 0x03, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0x07, 0xF3, 0xFC, 0x00, 0x3F, 0xC7,
-    0xF0, 0xFF, 0x00, 0x0F, 0xF7, 0xF0, 0x3F, 0xC0, 0x03, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0xF0,
-    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00,
-    0x0F, 0xF4, 0x0B, 0xFF, 0xF4, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x83, 0xFF, 0xD3, 0xFF, 0xD0, 0xFF, 0xF0, 0x1F, 0xD0, 0x0F, 0xE0, 0x07,
-    0xF4, 0x0B, 0xF8, 0x01, 0xFD, 0x0B, 0xFE, 0x00, 0x7F, 0x4B, 0xFF, 0x80, 0x1F, 0xDB, 0xCF, 0xE0,
-    0x07, 0xFF, 0xC3, 0xF8, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0x80, 0x1F, 0xD0, 0x0F,
-    0xE0, 0x2F, 0xFD, 0x0B, 0xFF, 0x4F, 0xFF, 0x83, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00,
-    0x01, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x05, 0x55, 0x50, 0xFF,
-    0xFF, 0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x40, 0xBF, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFF,
-    0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xC1, 0xFC, 0xFF, 0x00, 0x0F, 0xF1, 0xFC, 0x3F, 0xC0, 0x03, 0xFD,
-    0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x02, 0xFF, 0xFD,
-    0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0x43, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xE0,
-    0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x3F, 0xFD, 0x3F, 0xFD, 0x0F, 0xFF, 0x01, 0xFD,
-    0x00, 0xFE, 0x00, 0x7F, 0x40, 0xBF, 0x80, 0x1F, 0xD0, 0xBF, 0xE0, 0x07, 0xF4, 0xBF, 0xF8, 0x01,
-    0xFD, 0xBC, 0xFE, 0x00, 0x7F, 0xFC, 0x3F, 0x80, 0x1F, 0xFC, 0x0F, 0xE0, 0x07, 0xFC, 0x03, 0xF8,
-    0x01, 0xFD, 0x00, 0xFE, 0x02, 0xFF, 0xD0, 0xBF, 0xF4, 0xFF, 0xF8, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x00,
-    0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC,
-    0x00, 0x0B, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F,
-    0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0,
-    0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD1, 0xF8, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x40, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xD1, 0xFF, 0x41, 0xFD, 0x01, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xE0, 0x1F, 0xE0, 0x7F, 0xE1,
-    0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x06, 0xFA,
-    0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x40, 0x7F, 0xF0, 0x2F,
-    0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0xDB, 0xF0, 0x00, 0x03,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x95, 0x55, 0x7F, 0xDF, 0xF4,
-    0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x07, 0xF4, 0x3F, 0xF0, 0x00, 0xFF,
-    0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xF8,
-    0x0F, 0xF4, 0x1F, 0xC0, 0x0F, 0xF0, 0xFE, 0x00, 0x2F, 0xC3, 0xFD, 0x55, 0xBF, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0x95, 0x5B, 0xF0, 0xFE, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0xFE, 0x07, 0xFC, 0x0B, 0xF0,
-    0x0B, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x00, 0x14,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x40, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00,
-    0x07, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0xDB, 0xF0, 0x00, 0x03, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x95, 0x55, 0x7F, 0xDF, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00,
-    0x3F, 0xC7, 0xFC, 0x00, 0x07, 0xF4, 0x3F, 0xF0, 0x00, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD1, 0xF8, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x40, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x3F,
-    0x80, 0xFF, 0x41, 0xFC, 0x00, 0xFF, 0x0F, 0xE0, 0x02, 0xFC, 0x3F, 0xD5, 0x5B, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xF9, 0x55, 0xBF, 0x0F, 0xE0, 0x02, 0xFC, 0x3F, 0xC0, 0x0F, 0xE0, 0x7F, 0xC0, 0xBF,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x1F, 0x80, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x01, 0x50, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x07, 0xF4, 0x07, 0xFE, 0x01, 0xF8, 0x00, 0x7F, 0xC0, 0x3D, 0x00, 0x0B, 0xF8, 0x06,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x06, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x3C, 0x00, 0x0F,
-    0xF4, 0x3F, 0x80, 0x0B, 0xFC, 0x0F, 0xF9, 0x1F, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x01, 0xFD, 0x3F,
-    0x80, 0x3F, 0x0F, 0xD0, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1F, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFD, 0x0F, 0xD0, 0x7F, 0xC1, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x01, 0x57, 0xF8, 0x10, 0x01, 0xFD, 0x3D, 0x00, 0xBF, 0x1F, 0xD0,
-    0x7F, 0x83, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x55, 0xBF, 0xFF, 0x43, 0xFF, 0xF7, 0xFF, 0xE0, 0x2F, 0xFD,
-    0x0F, 0xF8, 0x00, 0xBF, 0x00, 0x7F, 0xC0, 0x0F, 0xC0, 0x02, 0xFD, 0x01, 0xF8, 0x00, 0x0F, 0xF0,
-    0x3F, 0x00, 0x00, 0xBF, 0x07, 0xE0, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x2F, 0xDF, 0x80, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x30, 0x3E, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC3,
-    0xFF, 0xC7, 0xFF, 0xE0, 0xBF, 0xE0, 0x3F, 0xD0, 0x0B, 0xE0, 0x07, 0xF8, 0x03, 0xF0, 0x00, 0xFF,
-    0x01, 0xF8, 0x00, 0x2F, 0xD0, 0xFD, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0xBF, 0x2F, 0x40, 0x00,
-    0x0F, 0xDF, 0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x78, 0xBF, 0x40,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x07, 0xF0, 0xFE, 0x00,
-    0x00, 0x14, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55, 0x5B, 0xFF, 0xF4,
-    0x3F, 0xFF, 0x7F, 0xFE, 0x02, 0xFF, 0xD0, 0xFF, 0x80, 0x0B, 0xF0, 0x07, 0xFC, 0x00, 0xFC, 0x00,
-    0x2F, 0xD0, 0x1F, 0x80, 0x00, 0xFF, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x7E, 0x00, 0x00, 0x3F, 0x8F,
-    0xC0, 0x00, 0x02, 0xFD, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0x03, 0xE0, 0x00, 0x00, 0xBE, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x0B, 0xE1, 0xFC, 0x00,
-    0x00, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x3F,
-    0xFC, 0x7F, 0xFE, 0x0B, 0xFE, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x7F, 0x80, 0x3F, 0x00, 0x0F, 0xF0,
-    0x1F, 0x80, 0x02, 0xFD, 0x0F, 0xD0, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x0B, 0xF2, 0xF4, 0x00, 0x00,
-    0xFD, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x04, 0x03, 0xF0, 0x00, 0x07, 0x8B, 0xF4, 0x00,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x08, 0x00, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0xBF, 0x1F, 0xD0,
-    0x00, 0x1F, 0x43, 0xF0, 0x00, 0x01, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50,
-    0x15, 0x55, 0xBF, 0xFF, 0x43, 0xFF, 0xF7, 0xFF, 0xE0, 0x2F, 0xFD, 0x0F, 0xF8, 0x00, 0xBF, 0x00,
-    0x7F, 0xC0, 0x0F, 0xC0, 0x02, 0xFD, 0x01, 0xF8, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0xBF, 0x07,
-    0xE0, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x2F, 0xDF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x30, 0x3E, 0x00,
-    0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x06, 0x00, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x01, 0xF4, 0xF8, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x0D, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40,
-    0x2F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xE0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F,
-    0xE0, 0xFC, 0x00, 0x02, 0xFC, 0xBD, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x01, 0x00, 0xFC, 0x00, 0x01, 0xE2, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00,
-    0x03, 0xF8, 0xBF, 0x00, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x55, 0x2F, 0xFF, 0xE3, 0xFF, 0xFD, 0x7F, 0xFE, 0x07, 0xFF,
-    0xE0, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07,
-    0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x6A, 0x93, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x3E, 0x00,
-    0x03, 0xFC, 0xBF, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0xBF, 0xFC, 0xBF, 0xF8, 0x7F, 0xF8, 0x0F, 0xF0, 0x1F, 0xD0,
-    0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x1F, 0xD0, 0x07, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x6F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xE2,
-    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x55, 0xBD, 0x03, 0xFC, 0x01, 0xF4, 0x0F, 0xF0, 0x07, 0xC0, 0x3F,
-    0xC0, 0x0E, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xD0, 0x7F, 0x82, 0xF4, 0x1F, 0xE0, 0x7D, 0x07,
-    0xF8, 0x0F, 0x01, 0xFE, 0x02, 0x40, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x05, 0x55, 0x50, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFE, 0x2F,
-    0xFF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xFF,
-    0x54, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xD0, 0x03, 0xFC, 0x1F, 0xF8, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0xC0,
-    0x2F, 0xC0, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x2F, 0xD0, 0x03, 0xFC, 0x07, 0xFC, 0x0B, 0xF4,
-    0x00, 0xFF, 0x9B, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0x40, 0x00, 0x2F,
-    0xD0, 0x07, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0x55, 0x00, 0x2F, 0xD0, 0x07, 0xFF, 0xFE, 0x02,
-    0xFD, 0x00, 0x7F, 0xFF, 0xF4, 0x2F, 0xD0, 0x07, 0xF4, 0x3F, 0xC2, 0xFD, 0x00, 0x7F, 0x42, 0xFC,
-    0x2F, 0xD0, 0x07, 0xF4, 0x2F, 0xC2, 0xFD, 0x00, 0x7F, 0x47, 0xF8, 0x2F, 0xD0, 0x2F, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xC3, 0xFF, 0xFF, 0x81, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x55, 0xBD, 0x03, 0xFC, 0x01,
-    0xF4, 0x0F, 0xF0, 0x07, 0xC0, 0x3F, 0xC0, 0x0E, 0x00, 0xFF, 0x00, 0x00, 0x17, 0xFE, 0x50, 0x00,
-    0xFF, 0xFF, 0xD0, 0x01, 0x7F, 0xD5, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x29, 0xF8, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE0, 0x7F,
-    0x81, 0xF8, 0x1F, 0xE0, 0x3D, 0x07, 0xF8, 0x0F, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xAF,
-    0xFA, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x02, 0xEF, 0x40, 0x00, 0xBF, 0xC0, 0x00,
-    0x0A, 0x40, 0x00, 0x15, 0x55, 0x40, 0x55, 0x50, 0xFF, 0xFF, 0x4B, 0xFF, 0xD2, 0xFF, 0xF8, 0x1B,
-    0xFE, 0x00, 0xFF, 0xC0, 0x2F, 0xC0, 0x00, 0xFF, 0x81, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xD0, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xF8,
-    0x00, 0x03, 0xF8, 0x0F, 0xF4, 0x00, 0x2F, 0xC0, 0x2F, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xE0, 0x7F,
-    0xFF, 0x00, 0x3F, 0xC2, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0xFF, 0xF0, 0x7F, 0xD0, 0x7F, 0xC1, 0xFC,
-    0x00, 0xBF, 0x8F, 0xC0, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0xBF, 0x02, 0xFC, 0x0F, 0xFD,
-    0x03, 0xF8, 0xBF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0B, 0xE4, 0x00, 0x15, 0x55, 0x40,
-    0x55, 0x50, 0xFF, 0xFF, 0x4B, 0xFF, 0xD2, 0xFF, 0xF8, 0x1B, 0xFE, 0x00, 0xFF, 0xC0, 0x2F, 0xC0,
-    0x00, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0xBD, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x07, 0xFB, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xF4, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00,
-    0x2F, 0xC0, 0x2F, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xF0, 0x7F, 0xFF, 0x07, 0xFF, 0xFE, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xF0, 0x3F, 0xFD, 0x3F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF4, 0x07, 0xFC, 0x1F, 0xC0, 0x01,
-    0xFE, 0x3F, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0x7F, 0xF9, 0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x02, 0xF8, 0xBF, 0x40, 0x0B, 0xF0, 0x3F, 0xD0, 0x3F,
-    0xF4, 0x7F, 0xFC, 0xBF, 0xF8, 0xFF, 0xFC, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x00, 0x00, 0x03, 0x0C, 0x2F, 0x80, 0xF0, 0x3F, 0xC1, 0x94, 0x09, 0x00, 0x90, 0x09, 0x00,
-    0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90,
-    0x09, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x38, 0x55, 0x5E, 0xEA, 0xAF, 0xC0,
-    0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x55, 0xFA, 0xAB, 0x34,
-    0x03, 0x0A, 0x03, 0x02, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x01, 0x2F, 0xFF, 0x4F, 0xFF, 0xE3, 0xFF, 0xF4, 0x2F, 0xFF, 0x4F, 0xFF,
-    0xE3, 0xFF, 0xF4, 0x15, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA,
-    0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x54, 0x05, 0x3F,
-    0x0B, 0xEF, 0xC2, 0xFB, 0xF0, 0xBE, 0xFC, 0x2F, 0xBF, 0x0B, 0xEF, 0xC2, 0xFB, 0xF0, 0xBE, 0xFC,
-    0x2F, 0xBF, 0x0B, 0xEF, 0xC2, 0xFB, 0xF0, 0xBE, 0xFC, 0x2F, 0xBF, 0x0B, 0xEF, 0xC2, 0xFB, 0xF0,
-    0xBE, 0xFC, 0x2F, 0xBF, 0x0B, 0xEF, 0xC2, 0xFB, 0xF0, 0xBE, 0xFC, 0x2F, 0xBF, 0x0B, 0xEF, 0xC2,
-    0xFB, 0xF0, 0xBE, 0xFC, 0x2F, 0xAA, 0x06, 0x90, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA,
-    0xAA, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x01,
-    0x40, 0x7C, 0x0F, 0x82, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x05, 0x02, 0xFC,
-    0x1F, 0xC0, 0xFC, 0x0F, 0xC0, 0xF8, 0x2F, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0xC0,
-    0xFC, 0x0F, 0xC0, 0xF8, 0x1F, 0x03, 0xD0, 0x14, 0x00, 0x05, 0x02, 0xFC, 0x3F, 0x83, 0xF0, 0x3F,
-    0x01, 0xF4, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0x01, 0x40, 0x50, 0x1F, 0x07, 0xC0, 0xF8, 0x3E, 0x0B,
-    0xC2, 0xF0, 0x3F, 0x0F, 0xC0, 0xFC, 0x3F, 0x03, 0xF8, 0xFE, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0x00,
-    0x05, 0x01, 0x40, 0xBF, 0x2F, 0xC1, 0xFC, 0x7F, 0x03, 0xF0, 0xFC, 0x0F, 0xC3, 0xF0, 0x3E, 0x0F,
-    0x82, 0xF0, 0xBC, 0x0F, 0x43, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x2F, 0x82, 0xFC,
-    0xBF, 0x03, 0xF0, 0xFC, 0x0F, 0xC3, 0xF0, 0x3E, 0x0F, 0x81, 0xF0, 0x7C, 0x0F, 0x43, 0xD0, 0x14,
-    0x05, 0x00, 0x05, 0x01, 0x40, 0xBF, 0x2F, 0xC3, 0xF8, 0xFE, 0x0F, 0xC3, 0xF0, 0x3F, 0x0F, 0xC0,
-    0x7D, 0x1F, 0x40, 0xF8, 0x3E, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x24, 0x3D, 0x19, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE,
-    0x29, 0x3D, 0x19, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x24, 0x3D, 0x19, 0x3F, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFE, 0x24, 0x3D, 0x19, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3D, 0x00, 0x3E, 0x7E, 0x6E, 0x3F, 0xFF, 0xFE, 0x3F, 0xBE, 0xBE, 0x00, 0x3E, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xDF, 0xFD,
-    0xFF, 0xD3, 0xF8, 0x00, 0x00, 0x24, 0x00, 0x1F, 0xD0, 0x07, 0xFF, 0x41, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xDF, 0xFF, 0x87, 0xFE, 0x01, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x19, 0x1F, 0xEB, 0xFD, 0xFE, 0x04,
-    0x00, 0x06, 0x40, 0x64, 0x3F, 0xC2, 0xFD, 0x3F, 0xD3, 0xFE, 0x3F, 0xC2, 0xFD, 0x05, 0x00, 0x50,
-    0x06, 0x40, 0x06, 0x40, 0x01, 0x40, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC3, 0xFD, 0x02, 0xFE, 0x01,
-    0xFF, 0x0F, 0xF0, 0x07, 0xF4, 0x03, 0xFC, 0x05, 0x00, 0x05, 0x00, 0x01, 0x40, 0x2F, 0x5F, 0xFB,
-    0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x38, 0x40, 0x5E, 0xD0, 0xAF, 0xC0, 0x1C,
-    0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x01, 0xFA, 0x07, 0x34, 0x03,
-    0x0A, 0x03, 0x02, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x29, 0xA8, 0x61, 0x89, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x01, 0x04, 0x00, 0x0A, 0x34, 0x00, 0x0A, 0x38, 0x15, 0x5E, 0x28, 0xEA,
-    0xBC, 0x73, 0x01, 0xC7, 0x0C, 0x1C, 0x70, 0x30, 0x86, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1C, 0xA0, 0x02, 0xCA, 0x00, 0x2C, 0xB5,
-    0x54, 0xD3, 0xEA, 0xB0, 0xD3, 0x40, 0xC0, 0xA3, 0x43, 0x00, 0x92, 0x0C, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0xBE, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x03, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC3, 0xD0, 0x00, 0x00,
-    0x00, 0x40, 0x2F, 0x47, 0xE2, 0xF0, 0xBF, 0xD0, 0x07, 0xFF, 0x03, 0xFF, 0xF0, 0xF4, 0xFE, 0xFD,
-    0x07, 0xFF, 0xF0, 0x2F, 0xE0, 0xF8, 0x7D, 0x0F, 0xC3, 0xF0, 0xBD, 0x00, 0x00, 0x7C, 0x2F, 0x03,
-    0xF0, 0xF8, 0x1F, 0x80, 0x00, 0x3E, 0x0F, 0xC0, 0xBC, 0x7D, 0x03, 0xE0, 0x00, 0x2F, 0x03, 0xF0,
-    0x2F, 0x1F, 0x40, 0xF8, 0x00, 0x0F, 0x80, 0xFC, 0x0F, 0xC7, 0xE0, 0x7D, 0x00, 0x0B, 0xC0, 0x2F,
-    0x43, 0xE0, 0xFC, 0x2F, 0x00, 0x07, 0xD0, 0x03, 0xFB, 0xF0, 0x2F, 0xEF, 0x80, 0x03, 0xF0, 0x00,
-    0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x74, 0x00, 0x01, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x02, 0xFC, 0x0F, 0xD0, 0xBF,
-    0x03, 0xF0, 0x0F, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x03, 0xF0, 0xFE, 0x0B,
-    0xF0, 0xFD, 0x0F, 0xD2, 0xFC, 0x2F, 0xC3, 0xF4, 0x3F, 0x0B, 0xE0, 0x3D, 0x0B, 0xC0, 0x14, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0xF4, 0x03, 0xF0, 0xFE, 0x1F, 0xC0, 0xBF,
-    0x0F, 0xD3, 0xFC, 0x0F, 0xD2, 0xFC, 0x3F, 0x42, 0xFC, 0x3F, 0x4B, 0xE0, 0x3F, 0x0B, 0xE0, 0xFC,
-    0x03, 0xD0, 0xBC, 0x0F, 0x40, 0x14, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xF0, 0x0F,
-    0xE0, 0x2F, 0xC0, 0x3F, 0x40, 0x7F, 0x00, 0xBC, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xD0,
-    0x3F, 0x4B, 0xF0, 0x3F, 0xC7, 0xF0, 0x1F, 0xC3, 0xF8, 0x0B, 0xE1, 0xFC, 0x03, 0xF0, 0xBE, 0x01,
-    0xF0, 0x3E, 0x00, 0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x3D, 0x0B, 0xC0, 0x3F, 0x4B,
-    0xF0, 0xFC, 0x03, 0xFC, 0x7F, 0x0F, 0xE0, 0x1F, 0xC3, 0xF8, 0x7F, 0x00, 0xBE, 0x1F, 0xC3, 0xF8,
-    0x03, 0xF0, 0xBE, 0x0F, 0xC0, 0x1F, 0x03, 0xE0, 0x7C, 0x00, 0x50, 0x08, 0x01, 0x40, 0x00, 0x60,
-    0x00, 0x07, 0xE0, 0x00, 0x7F, 0xE0, 0x07, 0xE3, 0xE0, 0x7E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x02, 0xF8, 0x0B, 0xF0, 0x3F, 0xC0, 0x3F, 0x40, 0x3F, 0xC0, 0x0F, 0xE0, 0x03,
-    0xF8, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x07, 0xF0, 0x0B, 0xF0, 0x0B, 0xF4, 0x0F, 0xE0,
-    0xBF, 0x47, 0xF4, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x2C, 0x7C, 0x07, 0xC0, 0x7C, 0x2F, 0x0B, 0xD1, 0xF0, 0x0B, 0xC3, 0x87, 0xC0, 0x02, 0xF0, 0x1F,
-    0x00, 0x00, 0xB8, 0x3D, 0x00, 0x08, 0x3E, 0xF4, 0x50, 0x3F, 0x0F, 0xD1, 0xF8, 0x3F, 0x0F, 0xD1,
-    0xF8, 0x04, 0x3E, 0xF4, 0x50, 0x00, 0xF8, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x40, 0x0B, 0xC7, 0x87,
-    0xC0, 0x2F, 0x0B, 0xD1, 0xF0, 0x7C, 0x07, 0xC0, 0x7C, 0x70, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x80, 0x2A, 0x0F, 0xF0, 0x2F, 0xC3, 0xF8, 0x0F, 0xF1, 0xFD, 0x03, 0xF8, 0x7F, 0x40,
-    0xFE, 0x0F, 0xD0, 0x3F, 0x83, 0xF0, 0x0F, 0xD0, 0xFC, 0x03, 0xF4, 0x3F, 0x00, 0xFD, 0x0F, 0xC0,
-    0x2F, 0x43, 0xF0, 0x0B, 0xD0, 0xFC, 0x02, 0xF4, 0x2F, 0x00, 0x7D, 0x07, 0xC0, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x10, 0x2F, 0xC0, 0x7F, 0x4F, 0xF0, 0x3F, 0xD3, 0xFC, 0x0B, 0xF0, 0x14,
-    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x2F, 0xF4, 0xFF, 0xE3,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04,
-    0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xF0, 0x24, 0x1F, 0xD0, 0x50, 0x7F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF0,
-    0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x6F, 0xF0, 0x01, 0xBF, 0xC0, 0xBF, 0xFD,
-    0x01, 0xFF, 0xF4, 0x0F, 0xFF, 0x40, 0x3F, 0xFD, 0x00, 0xFF, 0x40, 0x02, 0xFD, 0x00, 0x0B, 0xC0,
-    0x00, 0x2F, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x10, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x82, 0xFF,
-    0x80, 0x03, 0xFC, 0x7F, 0xFF, 0x00, 0x3F, 0x83, 0xFF, 0xFC, 0x03, 0xF8, 0x24, 0x1F, 0xD0, 0x3F,
-    0x40, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x6F,
-    0xF0, 0x3F, 0x00, 0xBF, 0xFD, 0x03, 0xF0, 0x0F, 0xFF, 0x40, 0x3F, 0x00, 0xFF, 0x40, 0x02, 0xF0,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x78, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x10, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0xFF, 0x40, 0x03, 0xFD, 0x0B, 0xF0, 0x00, 0x3F, 0xC0,
-    0x14, 0x00, 0x00, 0x50, 0x0A, 0x80, 0x04, 0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x3F, 0x81, 0xFF,
-    0xFC, 0x07, 0xF4, 0x0F, 0xFF, 0xF0, 0x7F, 0x40, 0x90, 0x7F, 0x43, 0xF4, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x01, 0xBF, 0xC3, 0xF0, 0x02, 0xFF,
-    0xF4, 0x3F, 0x00, 0x3F, 0xFD, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x01, 0xF0,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x2F, 0xC0, 0x2F, 0xC0,
-    0x03, 0xFC, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x3F, 0xF8, 0x02, 0xD3, 0xFF, 0xFE, 0xBF, 0x6F, 0x42, 0xFF, 0xF8, 0x24, 0x00, 0xBE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x3D, 0x07,
-    0xC0, 0x3F, 0x0F, 0xE1, 0xFC, 0x3F, 0x82, 0xFC, 0x3F, 0x4F, 0xF1, 0xFD, 0x0F, 0xD2, 0xFC, 0x3F,
-    0x4F, 0xF0, 0xBF, 0x0F, 0xD2, 0xF8, 0x3F, 0x03, 0xF0, 0xBE, 0x0F, 0xC2, 0xF4, 0x0F, 0x42, 0xF0,
-    0x3D, 0x0F, 0x80, 0x14, 0x02, 0x00, 0x50, 0x08, 0x00, 0x00, 0x69, 0x00, 0x1F, 0xFF, 0x01, 0xFE,
-    0xFF, 0x0F, 0xD0, 0xFD, 0x3F, 0x02, 0xF9, 0xF8, 0x07, 0xE7, 0xE0, 0x1F, 0x9F, 0x80, 0xBD, 0x3F,
-    0x03, 0xF0, 0xFE, 0x2F, 0xC1, 0xFF, 0xFC, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0xBE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x03, 0xEF, 0x80, 0x2F, 0x3E, 0x01, 0xF0, 0xF8,
-    0x0F, 0x97, 0xF4, 0x3F, 0xFF, 0xF8, 0x6A, 0xBF, 0x90, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x03, 0xFF, 0xD0, 0xFF, 0xF4, 0x7C, 0x00, 0x1F, 0x90, 0x0B, 0xFF, 0x40, 0x5B,
-    0xF0, 0x00, 0xBE, 0x00, 0x1F, 0x40, 0x2F, 0xC7, 0xFF, 0xD0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x1F, 0xFC, 0x0B, 0xF9, 0x01, 0xFC, 0x00, 0x3F, 0x94, 0x07, 0xFF, 0xF0, 0xBD, 0x6F,
-    0xCB, 0xC0, 0xFC, 0xBD, 0x0B, 0xC7, 0xF0, 0xFC, 0x3F, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x07, 0xFF, 0xFC, 0x7F, 0xFF, 0xC7, 0xC0, 0xF4, 0x24, 0x3E, 0x00, 0x0B, 0xC0, 0x00,
-    0xF8, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x07, 0xFF, 0xC3, 0xE1, 0xF9, 0xF4, 0x3E, 0x3F, 0x1F, 0x47, 0xFF, 0x41, 0xFF,
-    0xE1, 0xF8, 0xBE, 0xFC, 0x0F, 0xFF, 0x03, 0xF7, 0xFF, 0xF4, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0x90, 0x02, 0xFF, 0xE0, 0x7F, 0xBF, 0x4B, 0xC0, 0xFC, 0xBC, 0x0F, 0xCB, 0xE0, 0xFC, 0x3F, 0xFF,
-    0xC0, 0xBF, 0xF8, 0x00, 0x3F, 0x00, 0x1F, 0xD0, 0x7F, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x05, 0x00, 0x3F, 0xBF, 0xD0, 0x1F, 0xFB, 0xF0, 0x0B, 0xC1, 0xF0, 0x0B, 0xC1, 0xF0, 0x0B,
-    0xC1, 0xF0, 0x0B, 0xC1, 0xF0, 0x1F, 0xD3, 0xF8, 0x3F, 0xE7, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xFF,
-    0x42, 0xFD, 0x7F, 0x0F, 0xC0, 0xBD, 0x7E, 0x02, 0xF9, 0xF8, 0x07, 0xE7, 0xE0, 0x2F, 0x9F, 0x80,
-    0xBD, 0x3F, 0x03, 0xF0, 0xBF, 0xBF, 0x80, 0xFF, 0xF8, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4,
-    0x00, 0xBD, 0x01, 0xBF, 0xE0, 0xFF, 0xFD, 0x15, 0x55, 0x00, 0x0B, 0xF8, 0x03, 0xFF, 0xF4, 0xBE,
-    0x2F, 0x8B, 0xC1, 0xF8, 0x14, 0x2F, 0x40, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x2F, 0x80,
-    0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0, 0x55, 0x40, 0x0B, 0xF8, 0x0F, 0xFF, 0xC7, 0x82, 0xF4, 0x80,
-    0xBC, 0x00, 0xBD, 0x03, 0xFF, 0x40, 0x6B, 0xF4, 0x00, 0x7E, 0x00, 0x2F, 0x9A, 0xBF, 0xCB, 0xFF,
-    0xC0, 0x69, 0x00, 0x00, 0x0B, 0x80, 0x00, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xDF,
-    0x80, 0x3D, 0x3E, 0x02, 0xE0, 0xF8, 0x1F, 0xEB, 0xF9, 0x3F, 0xFF, 0xF8, 0x00, 0x3E, 0x00, 0x00,
-    0xF8, 0x00, 0x02, 0x90, 0x0A, 0xAA, 0x43, 0xFF, 0xD1, 0xFA, 0xA0, 0x7C, 0x00, 0x1F, 0xF4, 0x07,
-    0xFF, 0xC0, 0x07, 0xF4, 0x00, 0x7E, 0x00, 0x2F, 0x4A, 0xBF, 0xC7, 0xFF, 0xC0, 0x69, 0x00, 0x00,
-    0x7F, 0x40, 0x3F, 0xF8, 0x0F, 0xF4, 0x03, 0xF8, 0x00, 0x7F, 0xF9, 0x0B, 0xFF, 0xF4, 0xBC, 0x0F,
-    0xCB, 0xC0, 0xBC, 0xBD, 0x0F, 0xC3, 0xFA, 0xF8, 0x1F, 0xFF, 0x00, 0x1A, 0x40, 0x2A, 0xAA, 0x87,
-    0xFF, 0xFC, 0x7E, 0xAF, 0xC7, 0x82, 0xF0, 0x10, 0x3D, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x3F,
-    0x00, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x28, 0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xD3,
-    0xD0, 0xF9, 0xF8, 0x3E, 0x3F, 0xBF, 0x03, 0xFF, 0x02, 0xFF, 0xF6, 0xF0, 0x7F, 0xFC, 0x0F, 0xEF,
-    0x47, 0xE3, 0xFF, 0xE0, 0x1A, 0x80, 0x0B, 0xF8, 0x03, 0xFF, 0xF0, 0xBE, 0x2F, 0x8B, 0xC0, 0xFC,
-    0xBC, 0x0F, 0xC7, 0xF5, 0xFC, 0x2F, 0xFF, 0xC0, 0x1B, 0xF4, 0x00, 0xBF, 0x01, 0xBF, 0xC0, 0x7F,
-    0xF0, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF,
-    0x95, 0xBE, 0x07, 0xF4, 0x03, 0xE0, 0x7F, 0x40, 0x2D, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xF9, 0x54, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x07,
-    0xF0, 0xBF, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0xFC, 0x03, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x6F, 0xD5,
-    0x50, 0x0F, 0xFF, 0xFF, 0x40, 0x17, 0xFD, 0x54, 0x00, 0x0F, 0xE5, 0x50, 0x07, 0xFF, 0xFF, 0xC0,
-    0x1A, 0xFE, 0xA9, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0A, 0xFE, 0xAA, 0xBE, 0x3F,
-    0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xC0, 0x50, 0x00, 0x54, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x82, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0B,
-    0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x41, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x07, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x07, 0xFA, 0x90, 0x2F, 0xE0, 0x03,
-    0xF8, 0x2F, 0xE3, 0xFF, 0xFF, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x2B, 0xFA, 0x83, 0xF0, 0x7C,
-    0x03, 0xFF, 0xFD, 0x00, 0x3F, 0x40, 0x3F, 0x43, 0x40, 0x3F, 0xD4, 0x00, 0x03, 0xF4, 0x02, 0xFF,
-    0x40, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00,
-    0x1F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x18, 0x1F, 0xC0, 0x3F, 0xD0, 0x00, 0x03, 0xFC,
-    0x13, 0xC0, 0xFC, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x3F, 0xAF, 0x87, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0xD3, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xD0, 0xBC, 0x00, 0xFF, 0x00,
-    0xBC, 0x02, 0xFC, 0x00, 0xB4, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x6F, 0xFA, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xE5, 0xBC, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xAA, 0xAA, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xBF, 0xFD, 0x0B, 0xCF, 0xCF, 0x80,
-    0xD3, 0xF1, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xD3, 0xF2, 0xC0, 0xFC, 0xFD, 0xFC, 0x0F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x02, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x3E, 0x00, 0x03, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFA, 0xAA, 0xAF, 0xE0, 0x2F, 0x40, 0x07,
-    0xE0, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x74,
-    0x00, 0x07, 0xF4, 0x00, 0x7F, 0xF4, 0x07, 0xFF, 0xF4, 0x7E, 0xFE, 0xF4, 0xF3, 0xF3, 0xC0, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x01, 0x4F, 0xC5, 0x1F, 0x3F, 0x3D, 0x3F,
-    0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x07, 0xCF, 0xCF,
-    0x40, 0x53, 0xF1, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x4F, 0xC5, 0x01, 0xF3, 0xF3,
-    0xD0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x38, 0x3E, 0x02, 0xF8,
-    0xF8, 0x2F, 0x83, 0xE2, 0xF4, 0x0F, 0xAF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF8, 0xFE, 0xAA, 0x90, 0xFC,
-    0x00, 0x01, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x0B, 0x00,
-    0xBC, 0xBE, 0x02, 0xF0, 0xBE, 0x0B, 0xC0, 0x7E, 0x2F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0xAA, 0xAF,
-    0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x1C, 0x00, 0xBD, 0x01, 0xFC, 0x01, 0xF4, 0x1F,
-    0xC0, 0x07, 0xC1, 0xF8, 0x00, 0x1F, 0x0F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0xBE, 0xAA,
-    0xAA, 0x80, 0xBD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xFA, 0xAA, 0xAF, 0x03, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0xAA, 0xAA, 0xA0, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0x45, 0x55, 0x60,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x03, 0xF8, 0xBF, 0x00, 0x3F, 0xE2, 0xFF, 0x03, 0xF7, 0x8B, 0x7F, 0x07, 0x1E, 0x2D, 0x34, 0x00,
-    0x78, 0xB4, 0x00, 0x01, 0xE2, 0xD0, 0x00, 0x0B, 0x8B, 0x40, 0x00, 0x2E, 0x2E, 0x00, 0x00, 0xB8,
-    0xB8, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0x2E, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x3E, 0xAA, 0xAB, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x02, 0xAA, 0xAA, 0xAB, 0xF0, 0x00,
-    0x00, 0x00, 0x3C, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x02, 0x55, 0x54, 0x7E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x10, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0x2E, 0x2E, 0x00,
-    0x00, 0xB8, 0xB8, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x07, 0x8B, 0x40, 0x00, 0x1E, 0x2D, 0x00, 0x00,
-    0x78, 0xB4, 0x00, 0xB1, 0xE2, 0xD3, 0x83, 0xFB, 0x8B, 0xBF, 0x03, 0xFE, 0x2F, 0xF0, 0x02, 0xF8,
-    0xBE, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x0F, 0xD5,
-    0x5F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xAA, 0xAA, 0xAB, 0xC7, 0xC0, 0x00, 0x00, 0xF4, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0xFC, 0x00,
-    0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x01, 0x52, 0xFE, 0x00,
-    0x00, 0xBE, 0x1F, 0xF0, 0x00, 0x0F, 0xC0, 0xFF, 0x40, 0x01, 0xFC, 0x0B, 0xF8, 0x00, 0x3F, 0x40,
-    0x3F, 0xEA, 0xAB, 0xF0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x00,
-    0xF8, 0x00, 0x0F, 0xF4, 0x2F, 0x40, 0x00, 0x7F, 0x83, 0xF0, 0x00, 0x03, 0xFC, 0x7D, 0x00, 0x00,
-    0x2F, 0xDB, 0xC0, 0x00, 0x01, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x0D, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0x01, 0xFF, 0xFF, 0xC1, 0xFE, 0x6F, 0xF0,
-    0xFD, 0x02, 0xF8, 0xBE, 0x00, 0xFE, 0x3F, 0x40, 0x3F, 0x5F, 0xC0, 0x0F, 0xC7, 0xF0, 0x07, 0xE1,
-    0xFC, 0x03, 0xF4, 0x7F, 0x02, 0xFC, 0x0F, 0xE6, 0xFC, 0x02, 0xFF, 0xFC, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x1F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF8, 0x95, 0x56,
-    0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFE, 0x3F, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xE2, 0xAA, 0x9B, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x2F, 0xE0, 0x00, 0x0B, 0xF9, 0xFE, 0xAB, 0xFE, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x01, 0xD0, 0x03, 0xFF, 0xFF, 0x9F, 0x40, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x41, 0xFD, 0x00, 0x0F, 0xFE,
-    0x0B, 0xF0, 0x00, 0xFA, 0xFC, 0x3F, 0x40, 0x0F, 0x87, 0xF0, 0xFD, 0x00, 0xF8, 0x0F, 0xC3, 0xF0,
-    0x0F, 0x80, 0x7F, 0x0F, 0xD0, 0xF8, 0x01, 0xFC, 0x3F, 0x4F, 0x80, 0x0B, 0xF0, 0xFE, 0xFC, 0x00,
-    0x3F, 0x82, 0xFF, 0xC0, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x0F, 0xFE, 0x57, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xC7, 0xFF, 0xFD, 0x00, 0x0C, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xAF, 0xD0, 0x00, 0x07, 0xD3, 0xFC,
-    0x00, 0x03, 0xF0, 0xFF, 0x00, 0x00, 0xF8, 0x1F, 0xE0, 0x00, 0xBC, 0x03, 0xFC, 0x00, 0x3F, 0x00,
-    0xFF, 0x40, 0x1F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xF0, 0x00, 0xFF, 0x42, 0xF4,
-    0x00, 0x1F, 0xF0, 0xFD, 0x00, 0x07, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x05, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x40, 0x02,
-    0xFC, 0x2F, 0xE0, 0x00, 0xFD, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x1F, 0x80, 0x1F, 0xE0,
-    0x0F, 0xC0, 0x03, 0xFC, 0x03, 0xE0, 0x00, 0xBF, 0x42, 0xF4, 0x00, 0x1F, 0xE0, 0xFC, 0x00, 0x03,
-    0xFC, 0x7D, 0x00, 0x00, 0xBF, 0x6F, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x1B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA,
-    0xAA, 0xA9, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFA, 0xAA, 0xAA, 0xAA,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x05, 0x6F, 0xD4, 0x01, 0xBF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xAB, 0xFE, 0x92, 0xFE, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00,
-    0x7F, 0x00, 0x2F, 0x80, 0x2F, 0xC0, 0x0F, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xAA, 0xFE, 0xAA, 0xAF, 0xC0, 0x7E, 0x00, 0x07, 0xF4, 0x2F, 0x40, 0x00, 0xFF, 0x0F,
-    0xC0, 0x00, 0x1F, 0xFB, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x90, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xAA, 0xAA, 0xAA, 0x9F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xE5, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x56, 0xAA, 0xA4,
-    0x55, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFE, 0x01, 0xAA, 0xAA, 0xBF,
-    0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAB, 0xF8, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xD2,
-    0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x05, 0xFE, 0x54, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x1A, 0xFF, 0xAB, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xE0, 0x03, 0xF0, 0x03, 0xFC, 0x00,
-    0xBE, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x0F, 0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xAA, 0xAF, 0xEA, 0xBF, 0x80, 0x02, 0xF4, 0x0F, 0xE0, 0x00, 0x7E, 0x07, 0xF4, 0x00, 0x0F, 0xC3,
-    0xFC, 0x00, 0x02, 0xFB, 0xFD, 0x2F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xAA, 0xAA, 0xAA, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF1, 0x55, 0x55,
-    0x6F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xAA, 0xA5, 0x40, 0x00, 0x15,
-    0x55, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xF4, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F,
-    0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF,
-    0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC,
-    0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xD0, 0x3F, 0xFF, 0xD1, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xC0, 0x05, 0x55, 0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xF0, 0x00, 0xBD, 0x0B, 0xF8, 0x00, 0x3D, 0x03, 0xFD, 0x00, 0x3C, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0xFD, 0x00, 0x04, 0x03, 0xF8, 0x00, 0x1F, 0x0B, 0xF0, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0xBF, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0xAA, 0xA8, 0xBF, 0xFF, 0xFD, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7C, 0x00, 0x3C, 0x7C, 0x78, 0xBF, 0xBE, 0xFC, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x1F,
-    0xFF, 0xE0, 0xBF, 0xBF, 0xFC, 0x3C, 0x7C, 0x78, 0x10, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x14,
-    0x00, 0x01, 0xA4, 0x01, 0xFF, 0xF0, 0x3F, 0xBF, 0xCB, 0xC0, 0xBC, 0xBC, 0x07, 0xCB, 0xC0, 0x7C,
-    0x7E, 0x5F, 0xC3, 0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x47, 0xFC, 0x7F, 0xC3, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xAA, 0x00, 0x3D,
-    0x01, 0xFF, 0xC0, 0x1F, 0x00, 0x7F, 0xF0, 0x0B, 0xC0, 0x00, 0xFD, 0x03, 0xE0, 0x00, 0x2F, 0x81,
-    0xF0, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x2F, 0x4F, 0x40, 0x00, 0x07,
-    0xEB, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x50, 0x00, 0x42, 0xFF, 0x01, 0xF1, 0xFF,
-    0xF2, 0xF8, 0xFC, 0x3F, 0xF4, 0x3D, 0x03, 0xF4, 0x0F, 0x40, 0xFD, 0x03, 0xF0, 0xFF, 0xD0, 0xBF,
-    0xFC, 0xFE, 0x0F, 0xFC, 0x0F, 0xC0, 0x54, 0x00, 0x60, 0x01, 0x40, 0x01, 0x40, 0x1F, 0xF4, 0x1F,
-    0xF0, 0x3F, 0xFD, 0x7F, 0xFC, 0x7D, 0x3F, 0xF4, 0xBC, 0xBC, 0x0F, 0xD0, 0x3C, 0xBC, 0x0F, 0xE0,
-    0x3C, 0xBC, 0x2F, 0xF4, 0xBC, 0x7F, 0xFC, 0xBF, 0xF8, 0x2F, 0xF0, 0x2F, 0xF0, 0x05, 0x40, 0x05,
-    0x40, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x15, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x2A, 0x54, 0x05,
-    0x3F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD,
-    0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7,
-    0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF,
-    0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x6A, 0x06, 0x80, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x02, 0xFB, 0xF0, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0xFD, 0x0F,
-    0xC0, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0B,
-    0xF0, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x07,
-    0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x02, 0xFC, 0x14, 0x00, 0x00, 0x05, 0x47, 0xF0,
-    0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0xFD,
-    0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x02, 0xF8,
-    0x07, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x07, 0xF2, 0xF8, 0x00,
-    0x00, 0x3F, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x0B, 0xF4, 0x07, 0xF8, 0x3F, 0x40, 0x07, 0xF1, 0xFC, 0x00,
-    0x0F, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B,
-    0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7,
-    0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD0, 0x14,
-    0x00, 0x00, 0x51, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00,
-    0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02,
-    0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF4,
-    0xFC, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0xBF, 0x0B, 0xFE, 0x6F, 0xF8, 0x0B, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0x80, 0x02, 0xFC, 0x7C, 0x00, 0x0F, 0xF0, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xE1, 0xFD, 0x00, 0x0F, 0xEF, 0xF0,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF,
-    0x4F, 0xE0, 0x00, 0x2F, 0xC0, 0x50, 0x00, 0x01, 0x40, 0x1E, 0x40, 0x00, 0x2E, 0x1F, 0xF0, 0x00,
-    0x3F, 0xD7, 0xFC, 0x00, 0x0F, 0xF4, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0xC3, 0xFC, 0x1A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x43, 0xFC, 0x7F, 0xC3, 0xF8, 0x00, 0x00,
-    0x1E, 0x40, 0x00, 0x2E, 0x1F, 0xF0, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x0F, 0xF4, 0xFD, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0xFF,
-    0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x4F, 0xE0, 0x00, 0x2F, 0xC0, 0x50, 0x00, 0x01, 0x40,
-    0x00, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xD3, 0xFF, 0xFE, 0xBF, 0x6F, 0x42, 0xFF, 0xF8, 0x24,
-    0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x01, 0x82, 0xFF,
-    0xF9, 0x1F, 0x5F, 0xDB, 0xFF, 0xFC, 0x78, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xAA, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x55, 0x00,
-    0x00, 0x40, 0x00, 0x03, 0xFE, 0x02, 0xD3, 0xFF, 0xF9, 0xF8, 0xF9, 0xBF, 0xFD, 0x3C, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x74, 0xBF, 0xFD, 0x7E, 0x3F, 0x7F, 0xFF, 0x4F, 0x01, 0xFF,
-    0x80, 0x40, 0x05, 0x00, 0x10, 0x00, 0x00, 0x10, 0xFE, 0xAA, 0xAF, 0xC3, 0xFF, 0xFF, 0xFF, 0x01,
-    0xAF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xA4, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xAA, 0xAB, 0xF0, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0x03, 0xD0, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x6A, 0xBF, 0xA8, 0x00, 0x7C, 0x00, 0x15,
-    0xF9, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD, 0x15, 0x55,
-    0x55, 0x50, 0x00, 0x00, 0x24, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x2F, 0xE0,
-    0x00, 0xBF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F,
-    0xF8, 0x00, 0x02, 0xFD, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x7F, 0x80, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x02, 0xC0, 0x00, 0x7F, 0xC0, 0x0B, 0xF0, 0x01,
-    0xFF, 0x80, 0x6F, 0xF4, 0x07, 0xFE, 0x01, 0xFF, 0x90, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0x0B, 0xF4,
-    0x01, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x2F, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x1F,
-    0xFD, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xF8,
-    0x00, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x1B, 0xFD, 0x00, 0x01, 0xBF, 0xD0, 0x2F, 0xF4, 0x00, 0x02,
-    0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xD0, 0x07, 0xF8, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x01, 0xFF,
-    0x80, 0x7F, 0xF0, 0x07, 0xFE, 0x01, 0xFF, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0xF4, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF1, 0x55, 0x55, 0x6F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xAA, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1A, 0xFF, 0xFF, 0x80, 0xBF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x90, 0x3F, 0x00, 0x3F, 0x80, 0x2F, 0x80, 0x2F,
-    0xC0, 0x0F, 0xC0, 0x0B, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0x02, 0xF4, 0x00, 0xBF, 0x00, 0xFC, 0x00,
-    0x2F, 0xC0, 0x7E, 0x00, 0x03, 0xFC, 0x2F, 0x40, 0x00, 0xBF, 0xEF, 0xD5, 0x55, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0xAA, 0xA4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xDF, 0xF8, 0x00, 0x07, 0xE0,
-    0xBF, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x3F,
-    0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xF1, 0x57, 0xF5, 0x6F, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xBF, 0xA9, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x55, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFA, 0xAA, 0xA8, 0x3F, 0xD0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x95, 0x55, 0x50, 0x2F, 0xFF, 0xFF, 0xFD,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0x5A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0xAA, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x3F, 0xC1, 0x55, 0x55, 0xBF, 0xD1, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
-    0xD0, 0x0A, 0xAA, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1F, 0xDB, 0x9F, 0xD0, 0x01, 0xF4, 0x2E, 0x07, 0xD0, 0x0F, 0x00, 0xB8, 0x07, 0xC0, 0xB8,
-    0x02, 0xE0, 0x0B, 0x83, 0xC0, 0x0B, 0x80, 0x0F, 0x1E, 0x00, 0x2E, 0x00, 0x3D, 0x7E, 0xAA, 0xFE,
-    0xAA, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xD5, 0x5B, 0x95, 0x5F, 0x5F, 0x00, 0x2E, 0x00, 0x3D,
-    0x3C, 0x00, 0xB8, 0x00, 0xF0, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0xF4, 0x0B, 0x80, 0x7C, 0x01, 0xF8,
-    0x2E, 0x0B, 0xD0, 0x01, 0xFE, 0xBA, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xD4, 0x5F, 0xD0,
-    0x01, 0xF4, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x00, 0x0B, 0x83, 0xC0,
-    0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x7E, 0xAA, 0xAA, 0xAA, 0xF6, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE7, 0xD5, 0x55, 0x55, 0x5F, 0x5F, 0x00, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x00, 0xF0,
-    0xB8, 0x00, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0x7C, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFE,
-    0x56, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xD4, 0x5F, 0xD0, 0x01, 0xF4, 0x00, 0x07, 0xD0,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0xBB, 0xF0, 0x03, 0xEB, 0x83, 0xC3, 0xF0, 0x3E, 0x0F, 0x1E, 0x03,
-    0xF3, 0xE0, 0x3D, 0x78, 0x03, 0xFE, 0x00, 0xB6, 0xE0, 0x03, 0xF0, 0x02, 0xE7, 0x80, 0x3F, 0xF0,
-    0x0B, 0x5F, 0x03, 0xE3, 0xF0, 0x3D, 0x3C, 0x3E, 0x03, 0xF0, 0xF0, 0xBB, 0xE0, 0x03, 0xFB, 0x80,
-    0xFE, 0x00, 0x03, 0xFC, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFE, 0x56, 0xFD, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xD4, 0x5F, 0xD0, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0x3F, 0xC0,
-    0xB8, 0x00, 0x03, 0xEB, 0x83, 0xC0, 0x00, 0x3E, 0x0F, 0x1F, 0x00, 0x03, 0xE0, 0x3D, 0x78, 0x00,
-    0x3E, 0x00, 0xB6, 0xE0, 0x03, 0xE0, 0x02, 0xE7, 0x80, 0x3E, 0x00, 0x0B, 0x5F, 0x03, 0xE0, 0x00,
-    0x3D, 0x3C, 0x3E, 0x00, 0x00, 0xF0, 0xBB, 0xE0, 0x00, 0x0B, 0x80, 0xFE, 0x00, 0x00, 0x7C, 0x01,
-    0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFE, 0x56, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0x47, 0xFC, 0x7F, 0xC3, 0xF4, 0x00, 0x00, 0x1F,
-    0x80, 0x0B, 0xC0, 0x0B, 0xD0, 0xFF, 0x40, 0xBF, 0x80, 0x7F, 0xC3, 0xFD, 0x02, 0xFE, 0x01, 0xFF,
-    0x0B, 0xE0, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x74, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x7D, 0x04, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0xFD, 0x2F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF,
-    0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFE, 0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE2, 0xFF, 0xFE, 0x00,
-    0x00, 0x2F, 0xFC, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD2,
-    0xFE, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00,
+static const uint8_t bookerly_12_boldBitmaps[27760] = {
+    0x85, 0x55, 0x3D, 0x8C, 0xD5, 0x46, 0x10, 0x1E, 0x7B, 0xF5, 0xB0, 0x14, 0x4B, 0x59, 0x8A, 0x20,
+    0x25, 0x5C, 0x84, 0x53, 0x50, 0x24, 0x4D, 0xB6, 0xA5, 0xE0, 0x6E, 0xAD, 0x10, 0xE9, 0x0A, 0x0A,
+    0xAE, 0x00, 0xA5, 0xA0, 0xA0, 0xBF, 0xE6, 0xB5, 0x29, 0xE0, 0xFC, 0x80, 0xE2, 0x0A, 0x8A, 0xA3,
+    0x4E, 0x0A, 0x1A, 0x8A, 0x83, 0x86, 0x86, 0x22, 0xC5, 0xDD, 0xED, 0x1E, 0x57, 0x50, 0x50, 0xC4,
+    0x12, 0xE9, 0x52, 0x60, 0x29, 0x45, 0xA2, 0xD0, 0x6C, 0x60, 0x91, 0x4C, 0x58, 0xEF, 0xE4, 0x5B,
+    0xFB, 0x41, 0xAE, 0x4A, 0xFC, 0xB3, 0xEF, 0x79, 0xEC, 0x19, 0x7F, 0x33, 0xF3, 0x7D, 0xE3, 0x8F,
+    0x6E, 0x07, 0xBD, 0xED, 0x9B, 0x0B, 0x5E, 0x0B, 0x37, 0x1D, 0x2A, 0x73, 0x44, 0x27, 0xD5, 0x51,
+    0xD0, 0x76, 0x63, 0xAB, 0x6A, 0x76, 0x5E, 0x3C, 0x7F, 0xED, 0xC3, 0xA0, 0x95, 0x7C, 0x76, 0xF4,
+    0xAA, 0xEB, 0x69, 0xB9, 0x29, 0xD1, 0x91, 0x2E, 0x5A, 0x5A, 0x2B, 0xED, 0xEC, 0xE0, 0xDA, 0x2F,
+    0x15, 0x73, 0x38, 0x1D, 0xCD, 0x1F, 0xD4, 0x2B, 0xCA, 0xBC, 0xA6, 0xDC, 0xAD, 0x51, 0xC3, 0xEC,
+    0x18, 0x67, 0xD9, 0x06, 0x2A, 0x6D, 0x4F, 0xF2, 0xD0, 0x93, 0xBC, 0xE5, 0x26, 0xFF, 0xA2, 0xA6,
+    0xBC, 0x25, 0x7A, 0x4C, 0xB4, 0x55, 0x67, 0x1C, 0x73, 0xE6, 0x36, 0xFC, 0xD5, 0xDF, 0x38, 0xBF,
+    0x5A, 0xED, 0xCC, 0x8A, 0x77, 0x96, 0x18, 0xCF, 0x72, 0x87, 0x18, 0x24, 0xB8, 0x5D, 0xBC, 0x0E,
+    0xFE, 0x7C, 0xB3, 0xF6, 0x71, 0xB5, 0xF3, 0xFB, 0xBD, 0x27, 0x78, 0xB2, 0xE2, 0x05, 0x7D, 0x4D,
+    0x54, 0x2E, 0x28, 0xEF, 0x88, 0x7E, 0x22, 0xFA, 0xEA, 0x3D, 0xAC, 0x13, 0x77, 0xE9, 0x0C, 0x65,
+    0xEC, 0x28, 0x90, 0xFC, 0xB5, 0x03, 0xBE, 0x7D, 0x69, 0x35, 0x21, 0x2F, 0x24, 0x25, 0xED, 0x9E,
+    0x5C, 0x10, 0x32, 0xDC, 0x23, 0x0A, 0xF2, 0xA8, 0xA5, 0xDC, 0x6F, 0xA9, 0x72, 0x10, 0xEC, 0x7C,
+    0x1C, 0xF2, 0x28, 0xB7, 0x81, 0x93, 0xAE, 0x2B, 0xE1, 0x48, 0x74, 0xA1, 0xB4, 0x48, 0xD1, 0x29,
+    0xA2, 0x5E, 0xDA, 0x04, 0x5F, 0x5D, 0xE8, 0xE8, 0x06, 0x69, 0x83, 0x58, 0xD4, 0xB8, 0x04, 0xFF,
+    0x13, 0x3A, 0xBE, 0x95, 0x11, 0x8B, 0x06, 0x2E, 0x8A, 0xD2, 0x22, 0x3E, 0xFC, 0xB3, 0x20, 0xD3,
+    0x52, 0xD5, 0x44, 0xC3, 0x2A, 0xEE, 0xC6, 0x2F, 0x88, 0x72, 0x06, 0x38, 0xC9, 0x87, 0xEC, 0xD4,
+    0xCF, 0x9D, 0x26, 0xBD, 0x8E, 0x7A, 0xE9, 0x3C, 0x62, 0xA9, 0x0D, 0x93, 0x5E, 0xA8, 0x48, 0xAA,
+    0x93, 0x7C, 0x57, 0xA2, 0x70, 0x03, 0x8A, 0x72, 0x2D, 0xD0, 0x6C, 0x83, 0x36, 0xB6, 0xE2, 0x30,
+    0x0C, 0x7B, 0x7B, 0xC8, 0xF4, 0x4B, 0xDA, 0xCF, 0x43, 0xE1, 0x64, 0x5B, 0x59, 0x5D, 0x6B, 0xDA,
+    0xA2, 0x03, 0x1A, 0x3E, 0xEC, 0x07, 0xD4, 0x20, 0x90, 0x5A, 0xC8, 0xB6, 0x74, 0xA2, 0xA7, 0x48,
+    0xE7, 0x89, 0x3E, 0x47, 0xDE, 0x79, 0x20, 0x65, 0x85, 0xC7, 0x5D, 0xD9, 0xE6, 0x7D, 0xFA, 0x49,
+    0x57, 0x03, 0x9E, 0x95, 0xAD, 0x48, 0xB5, 0xDA, 0x4A, 0x7F, 0xAD, 0x6C, 0x0B, 0x27, 0x3C, 0xEE,
+    0x3C, 0x1E, 0x53, 0x3A, 0x49, 0xEB, 0x76, 0xF5, 0xBA, 0x78, 0xF7, 0x6D, 0xC9, 0x87, 0x26, 0xE8,
+    0xC7, 0xDF, 0x3C, 0xB5, 0xB4, 0x97, 0x6E, 0xEC, 0xFD, 0x7B, 0x6C, 0xC6, 0x5D, 0xC3, 0xC3, 0xC3,
+    0xB8, 0x7B, 0xDC, 0x88, 0x2D, 0xAB, 0xB5, 0x35, 0x59, 0x28, 0x5B, 0x9D, 0x7B, 0x59, 0x9F, 0x25,
+    0xC5, 0x97, 0xF8, 0x37, 0xF6, 0x9F, 0x55, 0x2F, 0x87, 0x38, 0x4B, 0x95, 0x02, 0x83, 0x16, 0x40,
+    0x43, 0x05, 0xAA, 0xED, 0x51, 0x25, 0x02, 0xF8, 0xF7, 0x56, 0x7B, 0xCC, 0x1A, 0x8F, 0x59, 0xCB,
+    0xD1, 0x4A, 0x53, 0x7C, 0x74, 0xB9, 0x47, 0xD8, 0x3E, 0xE3, 0x79, 0x2F, 0x9D, 0x74, 0x4D, 0xAD,
+    0x9E, 0x07, 0x6A, 0x76, 0x5C, 0x16, 0xB5, 0x15, 0x21, 0x92, 0x7C, 0xDD, 0x93, 0x9E, 0x2E, 0x0B,
+    0x8F, 0xDA, 0x1E, 0xC6, 0x2C, 0x8A, 0x38, 0x77, 0x05, 0x73, 0x2D, 0x40, 0x2D, 0xBA, 0xBC, 0x64,
+    0x32, 0xAD, 0x70, 0x0D, 0x9E, 0x69, 0x26, 0x32, 0xFF, 0x75, 0x64, 0x7C, 0x5F, 0x73, 0xC0, 0x41,
+    0xC8, 0x40, 0x71, 0x5D, 0xF1, 0x90, 0xE2, 0x35, 0x35, 0xAF, 0xBB, 0x12, 0x9C, 0x37, 0x35, 0x49,
+    0x47, 0xF9, 0x80, 0x67, 0x17, 0x54, 0x81, 0x23, 0x3D, 0x65, 0x71, 0xBC, 0x50, 0xC8, 0x13, 0x02,
+    0x81, 0x20, 0x8E, 0x18, 0xA8, 0x67, 0x94, 0x99, 0xD4, 0xDC, 0x96, 0xAF, 0x86, 0x35, 0x32, 0x05,
+    0x9A, 0x43, 0xB2, 0xA3, 0xAA, 0xCB, 0x8C, 0x23, 0xA0, 0x3B, 0x33, 0x77, 0xA3, 0x67, 0x33, 0x7A,
+    0x2A, 0x37, 0x33, 0x5E, 0xB3, 0x2F, 0x81, 0xF9, 0xD4, 0x98, 0x3B, 0x8D, 0x80, 0x72, 0xE0, 0x2D,
+    0x70, 0x4A, 0xA6, 0x09, 0x3B, 0x6C, 0x01, 0xFC, 0xF4, 0x86, 0xCA, 0xCE, 0x50, 0x65, 0x0D, 0xE9,
+    0x87, 0xBC, 0x8B, 0x97, 0x02, 0x33, 0x87, 0xD9, 0x15, 0x73, 0x79, 0xF4, 0xFB, 0x70, 0x4E, 0xC1,
+    0x00, 0xC3, 0x80, 0x8D, 0x1C, 0xCA, 0x8E, 0xC0, 0x19, 0xE2, 0x3A, 0xD1, 0x58, 0x72, 0xC8, 0xAE,
+    0xF2, 0x98, 0x86, 0x40, 0x17, 0xD2, 0x2B, 0x2C, 0xE9, 0x6E, 0x66, 0x5C, 0x93, 0xF8, 0xDB, 0x4E,
+    0xCE, 0x90, 0x40, 0x03, 0x56, 0xB1, 0xAD, 0x62, 0x2D, 0xE2, 0xE8, 0x5B, 0x21, 0x0A, 0xBF, 0x45,
+    0x88, 0xA1, 0x88, 0xC6, 0x99, 0xDA, 0xDC, 0xF1, 0x22, 0x34, 0xB5, 0x7E, 0xDA, 0x0B, 0x0C, 0x14,
+    0x7D, 0x8B, 0xEF, 0x79, 0xC9, 0x31, 0x95, 0x2F, 0x55, 0x11, 0x9B, 0x98, 0xF0, 0xA1, 0x30, 0xA8,
+    0x85, 0xBE, 0xD0, 0xCA, 0xEE, 0xD3, 0xD4, 0x77, 0x3D, 0x16, 0x33, 0x1B, 0xC6, 0x17, 0x17, 0x7E,
+    0x84, 0x80, 0xD8, 0xF9, 0x64, 0x48, 0x98, 0xC0, 0x09, 0xDA, 0x40, 0x00, 0x84, 0xC1, 0x3C, 0x28,
+    0x99, 0xB3, 0x88, 0x2E, 0x58, 0x7D, 0xBB, 0x17, 0xBD, 0x6A, 0x0D, 0xF1, 0xA3, 0xB6, 0xC0, 0x14,
+    0x51, 0x48, 0xE6, 0x25, 0x8B, 0x5E, 0xF6, 0x40, 0xF1, 0xCC, 0x89, 0x60, 0x6A, 0x7D, 0x34, 0x5C,
+    0xF3, 0x0A, 0x28, 0x1A, 0xA0, 0x38, 0x35, 0x85, 0x50, 0x8C, 0x42, 0x62, 0x0A, 0xCC, 0x9D, 0x5E,
+    0x98, 0xED, 0xE3, 0x98, 0xD5, 0x13, 0xFE, 0x31, 0x40, 0x8F, 0x76, 0x85, 0x27, 0x18, 0xBA, 0x25,
+    0x19, 0xF0, 0x4E, 0xB8, 0x2F, 0x30, 0x9C, 0x68, 0x06, 0x81, 0xAB, 0xF9, 0xBB, 0x10, 0x96, 0x23,
+    0x68, 0xFD, 0x6F, 0x6E, 0x6E, 0xD6, 0x65, 0xDB, 0x1C, 0x72, 0xEE, 0x3F, 0x0C, 0x88, 0x19, 0x71,
+    0x12, 0xAE, 0xAA, 0x21, 0x8A, 0x55, 0xBA, 0x3B, 0x19, 0xBF, 0xA7, 0x02, 0x9C, 0xED, 0x0A, 0x40,
+    0xE9, 0x12, 0x7F, 0xB4, 0x47, 0x4B, 0xEB, 0x54, 0x54, 0xD8, 0x71, 0x17, 0x8D, 0xE2, 0x01, 0xC7,
+    0xE6, 0xC3, 0xDD, 0xD4, 0xB0, 0x2B, 0x97, 0xA7, 0xCB, 0xC9, 0xF9, 0xDC, 0xC4, 0x90, 0x1E, 0x4C,
+    0xA8, 0x49, 0xF9, 0x54, 0x9B, 0x32, 0x90, 0x69, 0xAB, 0x21, 0xD9, 0xCF, 0xD1, 0x92, 0x2B, 0xA6,
+    0x2B, 0x52, 0xCB, 0xDC, 0xD9, 0xAA, 0x4D, 0x22, 0x52, 0x49, 0xA1, 0x73, 0x34, 0xBC, 0x66, 0x2F,
+    0xE0, 0x61, 0x31, 0x30, 0x27, 0xB5, 0x43, 0x5E, 0x48, 0xCD, 0x4C, 0x55, 0x1D, 0x97, 0x13, 0x1C,
+    0x93, 0xCE, 0x90, 0x3B, 0xA9, 0xB7, 0x57, 0x4C, 0x9B, 0x27, 0x35, 0x5A, 0xB0, 0x15, 0x93, 0x2A,
+    0x64, 0x90, 0x4C, 0xD9, 0x81, 0x79, 0xFB, 0x3A, 0x77, 0xFB, 0xD9, 0x9B, 0x50, 0xDC, 0xEC, 0x8B,
+    0x97, 0x1D, 0x15, 0x5D, 0xF5, 0xA8, 0x2E, 0x79, 0xB1, 0x3F, 0x64, 0xC3, 0x81, 0x78, 0xE5, 0xE5,
+    0x61, 0x2F, 0xEF, 0x74, 0xFA, 0xE2, 0x9B, 0x00, 0x4A, 0x82, 0x6D, 0x10, 0xCA, 0xC5, 0x3E, 0xD5,
+    0x91, 0x46, 0x75, 0x27, 0x0A, 0x82, 0x36, 0x58, 0xFF, 0x7C, 0xD4, 0xA7, 0x7C, 0xD3, 0x0C, 0x5D,
+    0x89, 0x63, 0x81, 0x4E, 0xA7, 0x85, 0x97, 0x8F, 0x80, 0x29, 0x76, 0xB9, 0x94, 0x2F, 0xF0, 0xE9,
+    0x90, 0x3B, 0xF8, 0x94, 0xA8, 0x4B, 0x58, 0x34, 0x94, 0x46, 0x5B, 0x89, 0x13, 0xC3, 0x77, 0xA8,
+    0x0D, 0xA3, 0xB3, 0x50, 0x17, 0xA7, 0x51, 0xCD, 0x75, 0x81, 0x8F, 0x08, 0x26, 0x1B, 0x52, 0x33,
+    0x21, 0xE7, 0x00, 0xCD, 0x42, 0x0B, 0x9B, 0xF7, 0xC1, 0x50, 0x5E, 0x28, 0xE6, 0x4E, 0x04, 0x09,
+    0x52, 0x14, 0xE8, 0xB8, 0x48, 0xBF, 0x38, 0x31, 0x13, 0x91, 0x31, 0x4E, 0xFC, 0x5F, 0x09, 0x62,
+    0xDC, 0xF3, 0x01, 0xE7, 0xF4, 0x7F, 0x98, 0xF7, 0xC9, 0x4F, 0x73, 0x5C, 0xF6, 0x3B, 0xD6, 0x78,
+    0x9B, 0x45, 0x3C, 0x94, 0x33, 0x28, 0x0C, 0x54, 0xA6, 0x72, 0x1B, 0x8D, 0x87, 0x76, 0x13, 0xF8,
+    0x84, 0x4B, 0xE2, 0x52, 0x63, 0xE4, 0x18, 0x3B, 0xA6, 0x22, 0x78, 0x91, 0xAD, 0x63, 0xC0, 0x63,
+    0x28, 0xB8, 0x3C, 0xC5, 0x01, 0x09, 0x67, 0x9B, 0x0F, 0x12, 0x74, 0x6E, 0x13, 0x74, 0x00, 0xC7,
+    0x2C, 0x80, 0x67, 0xD3, 0x42, 0x05, 0xC6, 0x82, 0xF2, 0x8C, 0x5D, 0x00, 0x05, 0x62, 0xC9, 0xD4,
+    0xA8, 0xF7, 0x26, 0x40, 0x82, 0x30, 0x60, 0x42, 0x3B, 0x6C, 0x89, 0xC2, 0xFE, 0x30, 0xE6, 0xE5,
+    0x11, 0xEB, 0x2D, 0xFD, 0xFF, 0xF6, 0x0F, 0x8D, 0x55, 0x31, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBB,
+    0xC5, 0xB9, 0xE2, 0x15, 0x4B, 0xC1, 0xAB, 0x10, 0xBA, 0x96, 0x6E, 0x1B, 0x4A, 0xF0, 0xAE, 0x44,
+    0xE1, 0xC2, 0x85, 0x2D, 0xE1, 0xAB, 0xE9, 0x43, 0x61, 0x0A, 0xCA, 0x90, 0x3D, 0x94, 0x1F, 0xE0,
+    0x54, 0xF4, 0x48, 0x69, 0x70, 0x93, 0x3F, 0x80, 0x75, 0xE7, 0xB8, 0x48, 0x41, 0xC1, 0x09, 0x17,
+    0x14, 0x29, 0xBC, 0x8A, 0x44, 0x03, 0x45, 0xD6, 0xD1, 0x89, 0x1C, 0xCE, 0xDE, 0x0D, 0xDF, 0xEC,
+    0x0B, 0x21, 0x48, 0x71, 0xE4, 0xF7, 0x6E, 0xF7, 0xDD, 0xCD, 0xDB, 0x9D, 0xF9, 0xF6, 0x9B, 0x6F,
+    0xE6, 0xD6, 0x4D, 0x73, 0x60, 0x99, 0x93, 0xC1, 0x50, 0x73, 0x91, 0x54, 0xA2, 0x3B, 0x18, 0x9F,
+    0x60, 0x50, 0x1E, 0xCC, 0x7D, 0x1E, 0xCB, 0xB1, 0x7B, 0x65, 0x7B, 0x1F, 0xE3, 0x53, 0x8C, 0x9F,
+    0x60, 0xCB, 0xFB, 0xB0, 0x7F, 0x5A, 0x37, 0xCD, 0x17, 0xCC, 0x8C, 0xC7, 0x68, 0x07, 0xAF, 0x52,
+    0x19, 0x6D, 0xFF, 0x91, 0x6C, 0xB0, 0x3D, 0x61, 0x5D, 0x6B, 0xE1, 0x9E, 0xB9, 0x95, 0xA7, 0x57,
+    0x46, 0xF9, 0x19, 0xC8, 0x70, 0x50, 0xBC, 0x10, 0xDD, 0xEA, 0xEE, 0xE3, 0x9E, 0x09, 0xBE, 0x06,
+    0x3B, 0xAA, 0xD1, 0x04, 0x3A, 0xD1, 0x91, 0xEA, 0x6A, 0x22, 0x2A, 0x67, 0x22, 0x62, 0x92, 0x6D,
+    0x45, 0xB3, 0x17, 0x15, 0xBF, 0x98, 0xC9, 0xA7, 0xAE, 0x25, 0xAE, 0x47, 0xB2, 0x67, 0xEC, 0x74,
+    0xF4, 0xCB, 0xC3, 0x54, 0x21, 0x3E, 0x7C, 0xFC, 0x4D, 0xB4, 0x76, 0xB4, 0x6E, 0x5C, 0xD3, 0x68,
+    0x1E, 0x2D, 0x3F, 0xE5, 0x69, 0xC5, 0x01, 0xBE, 0xCC, 0x80, 0x98, 0xAB, 0x11, 0x9E, 0xE0, 0x10,
+    0x08, 0x3A, 0xB7, 0x31, 0x62, 0x1B, 0x8C, 0xCC, 0x30, 0xFE, 0x71, 0xCC, 0xEE, 0xED, 0x2B, 0x11,
+    0x28, 0x18, 0x1E, 0x3A, 0x3E, 0x12, 0x9F, 0x61, 0xDD, 0x7C, 0xCE, 0xB3, 0x91, 0xF3, 0x60, 0xE5,
+    0xF5, 0xD3, 0x60, 0xF8, 0x9C, 0xE7, 0xA2, 0x39, 0xA8, 0x78, 0x56, 0x3C, 0x89, 0xAF, 0x9B, 0x5E,
+    0x2D, 0xC9, 0x01, 0xA9, 0x5A, 0xC8, 0x4E, 0x54, 0x0F, 0x38, 0x7D, 0x3E, 0xD3, 0x3E, 0xB3, 0xE6,
+    0x5F, 0x79, 0xD4, 0x33, 0xFE, 0xF4, 0xAD, 0x4A, 0x20, 0x08, 0xC7, 0x6F, 0xC1, 0xC3, 0x08, 0x92,
+    0xBC, 0x23, 0x89, 0x43, 0x38, 0x39, 0xE8, 0xBA, 0x88, 0x30, 0x99, 0x08, 0xAE, 0x6D, 0xC4, 0x2A,
+    0x4C, 0xB6, 0xF7, 0x91, 0xD8, 0xF9, 0xD1, 0x70, 0xEF, 0x27, 0xF0, 0xE5, 0xC5, 0xF3, 0x07, 0xE2,
+    0x1A, 0xD4, 0x4B, 0x3A, 0x5A, 0x7A, 0x9D, 0xFA, 0x77, 0x0F, 0x91, 0xC0, 0xB7, 0x18, 0x27, 0x6F,
+    0xCA, 0xA0, 0x68, 0x5C, 0xD1, 0xEC, 0x6B, 0xD1, 0x4C, 0xAC, 0x78, 0xC0, 0x45, 0x1C, 0x56, 0xC8,
+    0x1D, 0x47, 0xCD, 0x54, 0xBC, 0x1C, 0xEB, 0xCE, 0x15, 0x2F, 0x26, 0x63, 0x5D, 0xF9, 0x57, 0xDA,
+    0xC6, 0x7C, 0x99, 0x3E, 0xB3, 0x6D, 0x19, 0xE7, 0x3B, 0xB6, 0x55, 0xB1, 0x9B, 0x40, 0x5B, 0xF4,
+    0xA3, 0xCC, 0x36, 0x1A, 0xCC, 0x26, 0x98, 0xBE, 0x8A, 0x7A, 0xC0, 0x1C, 0x74, 0x6F, 0x06, 0xBB,
+    0xDC, 0x72, 0x9C, 0x3C, 0x5C, 0x71, 0x5A, 0x1F, 0x00, 0x76, 0xCD, 0xCE, 0xF0, 0xA3, 0x1C, 0x4C,
+    0x2F, 0x54, 0x23, 0xEE, 0x50, 0xE1, 0x84, 0xA9, 0x00, 0xFB, 0xDC, 0x7A, 0xD2, 0x17, 0x23, 0x8C,
+    0xCF, 0x19, 0xC6, 0x64, 0x2F, 0x61, 0x54, 0x0B, 0x8C, 0x7D, 0x77, 0x01, 0xE7, 0x9A, 0x61, 0xC4,
+    0x5A, 0xB2, 0x54, 0x73, 0xDE, 0xDB, 0x5B, 0x28, 0x30, 0xD6, 0xDC, 0x57, 0x49, 0x08, 0xDF, 0x87,
+    0x2E, 0xAF, 0x1C, 0xAD, 0x98, 0x9D, 0x12, 0x7D, 0xC0, 0x61, 0x34, 0x38, 0xD1, 0x3D, 0xA8, 0x23,
+    0x09, 0xE7, 0x4F, 0x46, 0x52, 0x33, 0x83, 0xBA, 0x8B, 0xD7, 0x37, 0x13, 0xB8, 0xE9, 0x90, 0xBF,
+    0xC7, 0xA2, 0x20, 0x1B, 0x0B, 0x2E, 0xF8, 0xF7, 0xAE, 0x87, 0x36, 0x23, 0xFC, 0x20, 0x33, 0x5B,
+    0x70, 0xBA, 0x75, 0xFB, 0xC7, 0x2C, 0x74, 0xB0, 0x36, 0xAA, 0x54, 0x4F, 0x2A, 0xBD, 0xF9, 0xAD,
+    0xF0, 0x5C, 0x8F, 0x08, 0x28, 0xD2, 0x74, 0x6A, 0xB9, 0xFF, 0x7F, 0xE6, 0x51, 0x0C, 0x10, 0x62,
+    0xCE, 0x56, 0x46, 0x57, 0x72, 0x7E, 0xC2, 0xEA, 0xA5, 0xE0, 0x5E, 0xE0, 0xB5, 0xD0, 0x2D, 0x43,
+    0x17, 0x6A, 0xC6, 0x93, 0x1E, 0x05, 0xD6, 0x39, 0x76, 0xF1, 0x9E, 0x80, 0xB4, 0x01, 0x4A, 0x10,
+    0x80, 0xA7, 0xEC, 0x4A, 0x88, 0x92, 0x6A, 0x70, 0xF7, 0x3D, 0x84, 0x26, 0x08, 0x4B, 0x96, 0x52,
+    0x83, 0xF0, 0x68, 0x23, 0x0C, 0xBF, 0x3C, 0x90, 0x68, 0x81, 0x48, 0x72, 0x08, 0x42, 0x04, 0xB9,
+    0xD4, 0x8A, 0x2B, 0x65, 0x22, 0x2E, 0x99, 0x04, 0x32, 0x5C, 0x6A, 0x11, 0x17, 0x84, 0xCB, 0xC5,
+    0x02, 0xD3, 0x21, 0xF4, 0x26, 0x65, 0x6D, 0x65, 0x2F, 0xE7, 0x72, 0xC7, 0xB4, 0x09, 0xDC, 0x33,
+    0x56, 0x11, 0xA0, 0x72, 0xCF, 0x01, 0x12, 0x64, 0x09, 0x77, 0x40, 0x74, 0xF8, 0xA0, 0x60, 0x3E,
+    0x05, 0x0C, 0xA6, 0xE4, 0x9D, 0xAD, 0xC3, 0x6A, 0x47, 0x50, 0x8F, 0x48, 0xCE, 0x80, 0x7F, 0x00,
+    0x01, 0x95, 0x99, 0x3E, 0x26, 0x3E, 0xA4, 0xFA, 0xC9, 0xB0, 0x7A, 0xBE, 0x54, 0x53, 0xC7, 0xA9,
+    0x06, 0xA9, 0xEB, 0x7D, 0x28, 0xA1, 0x41, 0x49, 0x6E, 0x54, 0xC8, 0x67, 0xA3, 0x3F, 0x4D, 0xDB,
+    0x2A, 0xE9, 0xB3, 0xC1, 0xF6, 0xD3, 0x7B, 0x2A, 0x6D, 0xE5, 0x96, 0x93, 0xF9, 0x7B, 0xD7, 0x8D,
+    0x9C, 0xD9, 0x83, 0xCD, 0x15, 0x68, 0x90, 0x62, 0x3B, 0xE8, 0x80, 0x67, 0xF1, 0xEC, 0xBA, 0x49,
+    0xCA, 0x6C, 0xB8, 0xF1, 0x94, 0x50, 0xB1, 0xF0, 0x08, 0x05, 0x4B, 0xFF, 0x28, 0xC1, 0x2F, 0xB8,
+    0x12, 0x3E, 0x8C, 0xD4, 0x25, 0x35, 0xF4, 0xAF, 0xFB, 0x5E, 0xC4, 0xEC, 0xBA, 0x51, 0x63, 0x87,
+    0x88, 0xCE, 0xE6, 0x1D, 0x60, 0x97, 0xBC, 0xB4, 0x3C, 0xEC, 0x60, 0x07, 0x64, 0xFE, 0x91, 0x74,
+    0x4B, 0xA9, 0x70, 0x73, 0x8E, 0x9A, 0xD6, 0x7F, 0x06, 0x29, 0x71, 0xC0, 0xAE, 0x84, 0x3C, 0x05,
+    0xEF, 0x48, 0x9D, 0x24, 0x68, 0xA1, 0xCD, 0x47, 0xEA, 0x99, 0x9A, 0x03, 0x8F, 0x2A, 0x27, 0xE1,
+    0xC4, 0x75, 0xE4, 0xA7, 0x15, 0xC4, 0xEE, 0x04, 0x1D, 0x74, 0x02, 0xB5, 0xCF, 0x25, 0x72, 0xD0,
+    0x96, 0x0B, 0x4A, 0xC6, 0xBA, 0x82, 0x15, 0x07, 0x8B, 0x70, 0xD5, 0xB3, 0x78, 0x17, 0x12, 0xD8,
+    0xFD, 0x39, 0x9E, 0x20, 0xEE, 0xD1, 0xE3, 0x51, 0x22, 0xFF, 0x72, 0x2F, 0x41, 0xBA, 0xE6, 0xA2,
+    0x9C, 0x01, 0xA1, 0x86, 0xA4, 0x05, 0xC4, 0x42, 0x59, 0x18, 0x33, 0x75, 0xA0, 0x0D, 0xD8, 0xBD,
+    0xD0, 0x98, 0x7B, 0xDC, 0x7F, 0x20, 0xA4, 0x5F, 0xED, 0xA2, 0x5F, 0x4D, 0x1F, 0x2E, 0x92, 0x71,
+    0x24, 0xFE, 0xBB, 0x84, 0xDA, 0xD5, 0x03, 0xF0, 0x2E, 0x02, 0x3A, 0x08, 0x7C, 0xCA, 0x6E, 0x10,
+    0x15, 0xB1, 0xAA, 0x97, 0x12, 0x70, 0x0F, 0xEA, 0x9D, 0xD0, 0xDD, 0x4D, 0x6F, 0xA2, 0xF4, 0xE0,
+    0xE8, 0xB9, 0xE2, 0x45, 0x5E, 0x53, 0x71, 0xDD, 0x14, 0xCD, 0x2E, 0x4F, 0x7E, 0xF1, 0x4B, 0xC9,
+    0x6D, 0xD7, 0xEB, 0x20, 0xEF, 0x2D, 0xC8, 0xD8, 0x82, 0xE3, 0x9D, 0x80, 0x4C, 0xC2, 0x81, 0x79,
+    0xD6, 0x4A, 0xCF, 0x81, 0xBB, 0xF9, 0xED, 0x29, 0x1F, 0x36, 0xDA, 0x84, 0x53, 0xDA, 0x6A, 0x1A,
+    0xD7, 0x31, 0x9A, 0x08, 0x5A, 0xEB, 0xA0, 0xA7, 0x6D, 0xEA, 0xFA, 0x6F, 0xF2, 0xDB, 0x29, 0x64,
+    0x52, 0x6B, 0x69, 0xA2, 0x8E, 0x34, 0x08, 0xC0, 0x09, 0x91, 0x9E, 0xAF, 0x6D, 0x50, 0x4F, 0x51,
+    0x37, 0x47, 0x57, 0xC7, 0x33, 0xD4, 0x16, 0xB1, 0x37, 0x1F, 0xF9, 0xF6, 0x0F, 0xFC, 0xDB, 0x55,
+    0xDD, 0xDE, 0x2D, 0xA6, 0x2A, 0x5C, 0xFB, 0x33, 0xEF, 0xF0, 0x97, 0x09, 0x48, 0x57, 0x38, 0xB8,
+    0xE0, 0x6C, 0x09, 0x9D, 0x89, 0x00, 0xB2, 0x86, 0x6F, 0x90, 0xDB, 0x81, 0xD8, 0x9E, 0x4A, 0x04,
+    0x43, 0x32, 0x74, 0xA0, 0x42, 0x80, 0xB8, 0xBC, 0x68, 0xB3, 0x5C, 0x45, 0x09, 0xF5, 0x90, 0xBF,
+    0x8A, 0xBE, 0xBA, 0xEE, 0xBA, 0xF4, 0xF2, 0x2A, 0xBC, 0xD1, 0xE7, 0x1F, 0xAD, 0x55, 0xCD, 0x8E,
+    0x15, 0x45, 0x14, 0x3E, 0xDD, 0xCD, 0xA4, 0x8C, 0x95, 0x58, 0x98, 0xCC, 0x08, 0x11, 0x93, 0x5A,
+    0x93, 0x98, 0xD4, 0x0B, 0x10, 0xAB, 0xC5, 0x07, 0xE0, 0x2E, 0xC0, 0x0D, 0xCF, 0xA0, 0xBC, 0x80,
+    0x50, 0xED, 0xB0, 0x74, 0x01, 0x6F, 0xE0, 0x66, 0x36, 0x4E, 0x48, 0x74, 0xE1, 0x76, 0xAC, 0x82,
+    0x31, 0x61, 0x69, 0x09, 0x0B, 0x17, 0x2E, 0x6C, 0x82, 0x1B, 0x65, 0x41, 0x83, 0x45, 0xEC, 0x40,
+    0x75, 0x1D, 0xBF, 0xBA, 0x97, 0x20, 0xA3, 0xE3, 0xCE, 0xAE, 0x3E, 0xB9, 0xD5, 0xF5, 0x73, 0x7E,
+    0xBE, 0x73, 0xBE, 0x73, 0xC9, 0xF6, 0xA4, 0x46, 0x92, 0x99, 0xBA, 0xC7, 0x43, 0xF3, 0xC7, 0x44,
+    0xF9, 0x2A, 0x7D, 0xA0, 0x82, 0x69, 0x27, 0x15, 0xAE, 0x89, 0xA8, 0x0E, 0xA7, 0x36, 0xED, 0xD1,
+    0x59, 0x66, 0x76, 0xCC, 0xBF, 0xEF, 0xEF, 0xEF, 0x9D, 0xEE, 0xA2, 0xFD, 0x30, 0x8B, 0xF1, 0x0D,
+    0xDA, 0x21, 0x72, 0x85, 0x0C, 0x27, 0x91, 0x5C, 0x70, 0x5D, 0xA6, 0x95, 0x0D, 0x74, 0x2A, 0x93,
+    0xE7, 0x60, 0x5F, 0x64, 0x39, 0xD9, 0xC0, 0x5D, 0x56, 0xCF, 0x7C, 0xF4, 0xCC, 0x77, 0xF8, 0x46,
+    0x6A, 0xFA, 0x6D, 0xA2, 0x13, 0x44, 0x3A, 0x13, 0x59, 0x88, 0x80, 0x74, 0xAF, 0x64, 0x87, 0xBA,
+    0x85, 0xC7, 0x8E, 0x79, 0xEE, 0xF8, 0xEB, 0xDC, 0xE5, 0x6E, 0xE9, 0x72, 0x5B, 0xA5, 0x74, 0xB9,
+    0x29, 0x2F, 0xE7, 0x75, 0x1D, 0x3B, 0x3A, 0xE1, 0xDC, 0xD8, 0x32, 0xF7, 0xB4, 0xB5, 0x22, 0xDA,
+    0xEA, 0xE1, 0x05, 0x59, 0x1E, 0xED, 0xFD, 0xAC, 0xA3, 0x53, 0xD3, 0x5B, 0x55, 0x25, 0xC3, 0x4A,
+    0x20, 0x95, 0xA8, 0xC5, 0xCC, 0x3D, 0xBF, 0x25, 0x99, 0xC9, 0xE1, 0xC6, 0x45, 0xC2, 0xD3, 0x53,
+    0xE3, 0x23, 0x75, 0x1C, 0xB1, 0x05, 0x31, 0x1B, 0xD9, 0xBA, 0x12, 0xE1, 0x7D, 0x84, 0xF2, 0xA8,
+    0x92, 0x89, 0x3A, 0x9A, 0x68, 0xC3, 0x31, 0x32, 0x9A, 0x68, 0x9E, 0xE3, 0x0C, 0xF3, 0xD2, 0xF1,
+    0x8D, 0x85, 0xB6, 0x9B, 0x8D, 0x13, 0x05, 0x4E, 0x4C, 0x76, 0x77, 0xD1, 0xC1, 0xDE, 0x18, 0xD5,
+    0x43, 0xC4, 0xC2, 0x5C, 0xEC, 0x40, 0x6A, 0x42, 0x70, 0xB0, 0xF4, 0xDB, 0x27, 0xB8, 0xD2, 0xFB,
+    0x8D, 0x13, 0xCD, 0x1E, 0x49, 0x8E, 0x92, 0xB3, 0x98, 0xAF, 0xB5, 0xB9, 0xA5, 0x02, 0x7F, 0x87,
+    0x6A, 0xDE, 0x73, 0x7A, 0x87, 0x2F, 0x92, 0x1B, 0x48, 0x8F, 0x24, 0x66, 0x6A, 0xB0, 0xF3, 0xFA,
+    0x47, 0xCB, 0x99, 0x10, 0x0B, 0x2C, 0xAE, 0x04, 0xF3, 0x84, 0xBC, 0x5C, 0x9F, 0xF5, 0xF7, 0x2A,
+    0xDA, 0xDE, 0x42, 0xC9, 0xD2, 0xA5, 0xB6, 0xF8, 0xD0, 0xE1, 0x90, 0xDE, 0xEF, 0xA9, 0x62, 0xFB,
+    0xEC, 0x52, 0x0F, 0xBB, 0xD1, 0x20, 0x0D, 0x65, 0x9F, 0x75, 0x6C, 0xB3, 0xEB, 0xF5, 0xC8, 0x8F,
+    0x18, 0x08, 0x8E, 0xE4, 0x7F, 0x25, 0x3A, 0x49, 0x74, 0x06, 0x0E, 0x2A, 0x78, 0xB6, 0xC6, 0x43,
+    0x26, 0xA2, 0x16, 0x0B, 0xE4, 0x9B, 0x15, 0x99, 0x9F, 0x19, 0x9E, 0xF2, 0xD4, 0xF2, 0x63, 0x24,
+    0x77, 0xF0, 0x7D, 0x45, 0x46, 0x22, 0xEB, 0xED, 0xD2, 0x2C, 0xE4, 0x7B, 0x77, 0x64, 0xA1, 0xE5,
+    0x1F, 0xF9, 0x09, 0x02, 0xCF, 0xD4, 0xD7, 0xDD, 0x60, 0xC6, 0xE6, 0x66, 0x45, 0x9C, 0xFC, 0xE8,
+    0xE6, 0xB6, 0x20, 0x12, 0x3D, 0x8A, 0xB9, 0xF9, 0x7B, 0xD2, 0x72, 0xE2, 0x05, 0x75, 0x61, 0x82,
+    0x4A, 0x40, 0xE9, 0x6C, 0x3D, 0x7B, 0x52, 0x67, 0x85, 0x6C, 0x05, 0x39, 0xB5, 0x30, 0x89, 0xAD,
+    0xA3, 0x13, 0x24, 0x7B, 0xB0, 0xD1, 0x8D, 0x6E, 0x92, 0x37, 0xD7, 0xCE, 0x5F, 0x99, 0x90, 0x6F,
+    0x88, 0x86, 0xC8, 0x23, 0xC2, 0xB3, 0x9C, 0x5C, 0x42, 0x31, 0x0E, 0x72, 0x2A, 0x24, 0x9F, 0xCE,
+    0x08, 0x65, 0x22, 0xF9, 0x02, 0xBF, 0x4F, 0x97, 0xBA, 0x0F, 0xA9, 0x76, 0xCC, 0x64, 0x16, 0x95,
+    0x5D, 0xA9, 0x79, 0xA2, 0x15, 0x9D, 0x3C, 0xB3, 0x00, 0x0C, 0x87, 0xA8, 0xDA, 0x1A, 0xA2, 0xF9,
+    0x8F, 0x89, 0xE0, 0xA7, 0x08, 0x74, 0xB5, 0x03, 0x2E, 0xC8, 0xEC, 0x93, 0x4B, 0x48, 0x08, 0x7B,
+    0xA6, 0x2B, 0xC5, 0x17, 0x1F, 0xC5, 0x2C, 0xB3, 0x44, 0x84, 0x75, 0x20, 0xDC, 0x3A, 0xF4, 0x58,
+    0x87, 0x98, 0xEB, 0x38, 0x66, 0xC3, 0x14, 0x5D, 0x34, 0x2B, 0xFE, 0x02, 0x23, 0x56, 0xBD, 0x55,
+    0x6B, 0xD5, 0x59, 0x35, 0x8E, 0x9B, 0x4B, 0x54, 0xAF, 0x58, 0x5C, 0x50, 0x58, 0xE8, 0x8E, 0x2E,
+    0x98, 0xA2, 0xF8, 0x02, 0xDF, 0xC5, 0x5D, 0xF0, 0xA2, 0xE5, 0x19, 0xF5, 0xB8, 0xA6, 0x8B, 0x8E,
+    0x1A, 0x91, 0xDA, 0x43, 0x40, 0xA7, 0xA6, 0x2E, 0xDB, 0xA0, 0xD6, 0x9F, 0x30, 0x2F, 0x8A, 0x9E,
+    0x2A, 0x33, 0x24, 0x2A, 0x61, 0x4D, 0x8D, 0x7E, 0xBB, 0xE1, 0x2F, 0x0B, 0x96, 0x8A, 0x00, 0x0F,
+    0x65, 0x02, 0x11, 0x90, 0x43, 0x4F, 0x6E, 0x17, 0x34, 0x94, 0x93, 0x98, 0x4D, 0xD0, 0xD1, 0x13,
+    0xB7, 0xE5, 0xF2, 0x8C, 0x53, 0x03, 0xF8, 0x4F, 0xFE, 0x22, 0x21, 0x2B, 0x6B, 0xC4, 0x2D, 0xAA,
+    0x14, 0x2B, 0xEF, 0xEE, 0x0F, 0xB4, 0xF1, 0xA1, 0x12, 0x73, 0xD9, 0xF8, 0x60, 0x22, 0x93, 0xFF,
+    0x08, 0x4C, 0x56, 0x93, 0x4C, 0x95, 0x48, 0xF5, 0x13, 0x88, 0x0B, 0xF6, 0xA9, 0x16, 0xA8, 0x2C,
+    0xBE, 0x5F, 0x97, 0x5D, 0x2D, 0xBF, 0x4A, 0x49, 0x1E, 0x40, 0xEC, 0x40, 0xFB, 0x5F, 0xD1, 0x6A,
+    0xDB, 0x3C, 0x59, 0xFC, 0x9F, 0xCB, 0x19, 0xD0, 0x65, 0x39, 0x01, 0x1E, 0xFC, 0xFB, 0x35, 0x3C,
+    0x38, 0x1C, 0xBE, 0x44, 0x9A, 0x77, 0x0B, 0xAB, 0x70, 0xD5, 0xD1, 0x13, 0x1E, 0x3A, 0x46, 0xAF,
+    0x98, 0x51, 0x63, 0xBD, 0x7B, 0x34, 0x58, 0xDF, 0x2F, 0x9E, 0x1F, 0x70, 0xA1, 0x2D, 0x44, 0x8A,
+    0x6E, 0x94, 0xAB, 0xDF, 0x78, 0x35, 0x67, 0xCB, 0xF3, 0xA9, 0x65, 0x85, 0xC6, 0x71, 0xCC, 0xCB,
+    0xB7, 0xD6, 0x9C, 0x4B, 0xEB, 0x6B, 0x70, 0x2F, 0x63, 0xB0, 0xAC, 0x05, 0xEA, 0x80, 0x64, 0x45,
+    0xB4, 0xAB, 0x45, 0x89, 0x50, 0x83, 0x7D, 0x6D, 0xA1, 0x67, 0x42, 0x9B, 0x00, 0x15, 0x41, 0x7A,
+    0x37, 0x73, 0x68, 0x56, 0xDB, 0xE8, 0x40, 0x0A, 0x63, 0x97, 0x07, 0xEE, 0xCD, 0xA0, 0xD1, 0x64,
+    0x3B, 0xF4, 0x52, 0xC0, 0x90, 0xD0, 0x85, 0xAB, 0x2B, 0x07, 0x20, 0xA0, 0xDB, 0x30, 0xB1, 0x41,
+    0x34, 0x15, 0xCF, 0x35, 0xAE, 0xF5, 0x71, 0x45, 0x44, 0x3F, 0x71, 0x32, 0x9F, 0x73, 0xA8, 0xD6,
+    0xD0, 0x0F, 0x45, 0x16, 0xB1, 0x9B, 0x4D, 0xB2, 0xE8, 0x31, 0x0C, 0x05, 0xE6, 0xF0, 0x97, 0xBB,
+    0x91, 0xEC, 0xA7, 0xD6, 0x10, 0x95, 0x74, 0x80, 0x7E, 0xC1, 0xB7, 0xB9, 0x36, 0xBA, 0x8E, 0x2B,
+    0xAC, 0x72, 0x06, 0x47, 0x82, 0x0E, 0x1B, 0x7D, 0x64, 0x17, 0x9B, 0xED, 0xAC, 0x93, 0xC8, 0x3A,
+    0xB4, 0xC5, 0x82, 0xA3, 0xC8, 0xA2, 0x01, 0xF8, 0xAA, 0x66, 0x12, 0x67, 0xBF, 0x43, 0xB7, 0x99,
+    0x7D, 0x0F, 0xFA, 0x44, 0x9B, 0x5C, 0xF6, 0xA0, 0x75, 0x0D, 0x40, 0xBF, 0x0A, 0x60, 0x3C, 0x2E,
+    0x00, 0xFB, 0xCF, 0x00, 0x04, 0xD4, 0x35, 0x50, 0x57, 0xBB, 0x11, 0x5A, 0x00, 0x79, 0x08, 0x9A,
+    0x25, 0x74, 0x63, 0xCD, 0x70, 0xAD, 0xB6, 0xC3, 0x67, 0x6E, 0x4C, 0x7A, 0x3C, 0x0D, 0x06, 0xC3,
+    0x38, 0xBA, 0x36, 0x5C, 0x15, 0x59, 0x8A, 0xDC, 0xDD, 0x2F, 0x1F, 0x4F, 0x5C, 0xF3, 0x53, 0x36,
+    0x20, 0x10, 0x3A, 0xE4, 0xCA, 0xF6, 0x30, 0x3C, 0xD1, 0x01, 0x99, 0x41, 0x8C, 0x4D, 0x06, 0x05,
+    0x90, 0x8D, 0x41, 0x24, 0xBA, 0x46, 0x7A, 0x90, 0x63, 0x9B, 0x68, 0x21, 0x60, 0x12, 0x60, 0xC1,
+    0x26, 0x51, 0x39, 0x4D, 0x07, 0xC7, 0x3E, 0xE0, 0x4D, 0x6E, 0x70, 0x13, 0x7F, 0x7C, 0xB8, 0xA0,
+    0xC3, 0xFA, 0x2E, 0xD4, 0x86, 0xEE, 0x65, 0x6B, 0xEB, 0x65, 0x84, 0x12, 0xA8, 0xAD, 0xF6, 0x60,
+    0x48, 0x70, 0xB3, 0x76, 0xA4, 0xBD, 0xD9, 0x08, 0x3E, 0xFF, 0x90, 0xCB, 0x0C, 0x60, 0xDE, 0xC3,
+    0x91, 0x2D, 0xF0, 0xEA, 0x1E, 0x02, 0x24, 0x35, 0x64, 0x15, 0xF0, 0x2E, 0x2A, 0xE2, 0x2D, 0xFA,
+    0xC1, 0x62, 0x6E, 0xEF, 0xD5, 0x2B, 0x0D, 0x60, 0xF8, 0x0C, 0x09, 0x00, 0x20, 0x03, 0xC1, 0x8C,
+    0xE6, 0x51, 0x73, 0xD1, 0x3F, 0x5D, 0xF8, 0xE1, 0xDE, 0xBD, 0xFB, 0xD3, 0xB7, 0x6F, 0xE7, 0xF7,
+    0xC9, 0x49, 0xD2, 0x77, 0x82, 0x98, 0xBE, 0xA1, 0x72, 0x8E, 0xEC, 0xE3, 0xCB, 0xD7, 0xD1, 0xA1,
+    0xF1, 0xC7, 0x46, 0x57, 0xA1, 0x16, 0x9D, 0x1C, 0x78, 0x42, 0xC7, 0x39, 0xA2, 0x37, 0xE9, 0x7F,
+    0x7A, 0xFE, 0x02, 0xBD, 0x55, 0xBF, 0x6F, 0xDD, 0x54, 0x14, 0xFE, 0xEC, 0xDB, 0xD4, 0xB4, 0x96,
+    0xE2, 0x0E, 0xA9, 0xC4, 0x2F, 0x61, 0x26, 0xD4, 0xA1, 0xD4, 0x1D, 0x18, 0x02, 0x6A, 0xE2, 0x0B,
+    0x19, 0x18, 0x2A, 0xE8, 0x1B, 0x1A, 0x31, 0x66, 0x05, 0x96, 0x2E, 0x19, 0x93, 0xD8, 0xA8, 0x03,
+    0x03, 0x12, 0xC9, 0xD0, 0xFF, 0xA0, 0x0C, 0xE5, 0x2D, 0xED, 0xC4, 0xF4, 0x5E, 0x7C, 0xD3, 0x48,
+    0x74, 0xAC, 0x85, 0x84, 0x3A, 0x30, 0xD4, 0x05, 0x21, 0x24, 0x18, 0x6A, 0x51, 0x17, 0xB9, 0x89,
+    0xFD, 0x0E, 0xDF, 0x79, 0x49, 0x68, 0x2B, 0x21, 0x36, 0x7A, 0xDF, 0xF5, 0xB5, 0xCF, 0xBD, 0xF7,
+    0x9C, 0x7B, 0xCE, 0x77, 0xBE, 0x7B, 0x1E, 0x70, 0x0C, 0x08, 0xC5, 0x42, 0xC4, 0x86, 0x75, 0x81,
+    0xD4, 0x76, 0x5E, 0x67, 0x5C, 0x58, 0x03, 0x89, 0xC3, 0x8C, 0x2C, 0xA3, 0x90, 0xCE, 0xBB, 0xB9,
+    0xB7, 0xC5, 0x15, 0x78, 0x1D, 0x10, 0x70, 0x85, 0x9F, 0x27, 0x27, 0xC3, 0x71, 0x2A, 0xD2, 0x88,
+    0x88, 0xDB, 0xC2, 0x1C, 0xD8, 0x4C, 0x3E, 0x98, 0xDF, 0x2E, 0x1E, 0xEE, 0x88, 0xD4, 0xE1, 0x83,
+    0x1E, 0x9D, 0xA9, 0xA2, 0x7C, 0x71, 0xFA, 0x2A, 0x7B, 0x8F, 0x93, 0xDB, 0xF2, 0x70, 0xF7, 0x8B,
+    0xC1, 0x3C, 0x0E, 0x5B, 0x2C, 0x3B, 0xF2, 0x48, 0xAA, 0xAC, 0x49, 0x2A, 0x53, 0x9B, 0xCE, 0x6F,
+    0x90, 0xD9, 0x0E, 0x51, 0xBD, 0x0E, 0xF4, 0x29, 0x8C, 0xDC, 0xEF, 0xE8, 0x93, 0x00, 0x99, 0x43,
+    0x78, 0x73, 0xAF, 0xF2, 0x79, 0x18, 0x40, 0x19, 0xA9, 0x03, 0xB7, 0x71, 0x41, 0x4A, 0x24, 0xC2,
+    0x8F, 0xF1, 0x61, 0xFB, 0x4C, 0xCD, 0xAE, 0x1F, 0x49, 0x2A, 0x64, 0x54, 0xEB, 0xC2, 0xBC, 0x8B,
+    0xED, 0x1A, 0xA3, 0x49, 0x1B, 0x2C, 0x08, 0x2E, 0x64, 0xD5, 0x62, 0xD8, 0xC6, 0x79, 0x1F, 0x36,
+    0xE7, 0x7C, 0x89, 0x90, 0xDD, 0x65, 0xFC, 0x27, 0x30, 0x49, 0x31, 0x4A, 0x6D, 0x9B, 0x48, 0xA5,
+    0x68, 0x9C, 0xA2, 0xB2, 0xDF, 0x6C, 0xA4, 0x9B, 0x8F, 0x9A, 0xED, 0x63, 0x1E, 0x23, 0xFF, 0x96,
+    0x13, 0x05, 0x0F, 0x8C, 0xAD, 0x5F, 0xA1, 0x86, 0x57, 0x45, 0x18, 0xBE, 0x5F, 0xAE, 0xC6, 0xE2,
+    0xEF, 0xBA, 0xE6, 0x42, 0xF0, 0x71, 0xE8, 0xB6, 0x66, 0xDF, 0x59, 0x04, 0xE6, 0xCB, 0x16, 0x78,
+    0xB4, 0x54, 0xC1, 0x7C, 0x1D, 0x3A, 0xCC, 0x9E, 0x8D, 0x7F, 0x77, 0xAB, 0xAB, 0xF1, 0xC4, 0xB8,
+    0x7A, 0xC6, 0xBE, 0x4D, 0x45, 0x6A, 0x3F, 0xC1, 0xBA, 0x3A, 0x9F, 0x03, 0x33, 0x03, 0xE0, 0x64,
+    0x15, 0x49, 0xB0, 0xEB, 0xD0, 0xBC, 0xD6, 0xC7, 0x2B, 0x17, 0xAF, 0xFE, 0x20, 0x92, 0x6C, 0x5A,
+    0xF8, 0xC3, 0xEF, 0xA4, 0x3B, 0x04, 0x2A, 0x70, 0x0B, 0x7E, 0x1B, 0xBB, 0x22, 0xA8, 0xD3, 0xDB,
+    0xBD, 0x69, 0xD2, 0x3C, 0xBD, 0xDD, 0x61, 0x12, 0xD6, 0xA6, 0x4D, 0x5C, 0xE8, 0xD6, 0x75, 0xCB,
+    0xE7, 0xC3, 0x1B, 0x85, 0xF4, 0xEC, 0x50, 0xDB, 0x07, 0x7D, 0x2E, 0x91, 0x4B, 0xF2, 0x0B, 0x41,
+    0x9B, 0xD1, 0x04, 0xE7, 0x41, 0x1E, 0xE3, 0xC7, 0xC1, 0xFC, 0x99, 0xED, 0x72, 0x77, 0x69, 0x73,
+    0xF6, 0xFC, 0xBB, 0xE5, 0x75, 0xD3, 0x86, 0xE7, 0xDF, 0x2B, 0xAF, 0x7F, 0x79, 0xFF, 0xA3, 0xD7,
+    0x2F, 0xBF, 0xE5, 0x6E, 0x61, 0xD5, 0xFF, 0x75, 0xAC, 0x81, 0x66, 0x72, 0x53, 0x1E, 0x2C, 0x0F,
+    0x30, 0x80, 0x54, 0xA9, 0x5C, 0x2C, 0xBB, 0x2E, 0xBC, 0x9B, 0x8F, 0xC6, 0xD1, 0x1D, 0x69, 0xE2,
+    0x1E, 0xA7, 0x81, 0x4F, 0x81, 0xD1, 0x61, 0x5F, 0x1E, 0x5F, 0x3E, 0x3C, 0x78, 0xF4, 0x74, 0x92,
+    0x74, 0x38, 0xBD, 0x7C, 0x34, 0x0F, 0x78, 0xD7, 0x7C, 0xA9, 0xB3, 0xE2, 0xAB, 0x9D, 0xF6, 0x4C,
+    0x9C, 0x9B, 0x1A, 0x3D, 0xF9, 0x13, 0xB9, 0x60, 0x8F, 0x2E, 0xDF, 0x1E, 0x7E, 0xE3, 0x5D, 0x0B,
+    0xE5, 0xCE, 0x6F, 0x4D, 0x39, 0x46, 0xE6, 0x09, 0x8A, 0x1A, 0xDB, 0x88, 0xF3, 0x2B, 0x3F, 0x49,
+    0xA5, 0x00, 0xE1, 0xA4, 0xF9, 0xF9, 0x71, 0x37, 0x7A, 0x09, 0xB0, 0xB0, 0xA9, 0xD3, 0x5F, 0x96,
+    0xFF, 0xE7, 0xCF, 0x15, 0x79, 0xF6, 0x97, 0x94, 0x99, 0xFC, 0x31, 0xC9, 0xE4, 0x6A, 0x97, 0xCD,
+    0x61, 0x90, 0x29, 0x11, 0xEC, 0xC1, 0x53, 0xF0, 0x99, 0xD2, 0xC4, 0x5B, 0x1E, 0x04, 0xA4, 0x6E,
+    0x21, 0x4F, 0x42, 0xB9, 0xE7, 0x52, 0x59, 0xF1, 0xA4, 0x5F, 0x0B, 0xE5, 0x71, 0x9D, 0x50, 0xCC,
+    0x64, 0x05, 0x14, 0x3D, 0x8A, 0xDE, 0xFE, 0x3D, 0x87, 0x68, 0x05, 0x58, 0x58, 0x03, 0x1E, 0xD7,
+    0x30, 0xCF, 0x8A, 0xCC, 0xF2, 0xF7, 0xE4, 0x22, 0xCD, 0xBD, 0xC9, 0xEB, 0x92, 0xEC, 0x77, 0x0C,
+    0xF7, 0x5C, 0x52, 0x75, 0x0B, 0x1B, 0x27, 0x80, 0x53, 0x5E, 0x6F, 0xC4, 0x5E, 0x29, 0x49, 0xEC,
+    0x31, 0x12, 0x1B, 0xEA, 0xC7, 0xB6, 0x91, 0x66, 0x78, 0xE3, 0x78, 0xCB, 0x90, 0x77, 0xF6, 0xAB,
+    0x94, 0x6F, 0x7F, 0xDF, 0x35, 0xA4, 0x28, 0x49, 0xE3, 0x0D, 0x6F, 0x1D, 0xA5, 0xFC, 0x9C, 0x57,
+    0x33, 0xD9, 0xB6, 0x08, 0x9A, 0xB0, 0xC9, 0x72, 0xA6, 0xBA, 0xF8, 0xB0, 0xCD, 0x96, 0xDA, 0xD4,
+    0x34, 0x89, 0xD7, 0xE0, 0xB9, 0x66, 0x72, 0xE8, 0xD4, 0x88, 0x17, 0xC6, 0x22, 0xCA, 0x95, 0xE3,
+    0xBE, 0xDE, 0x5D, 0xAB, 0x14, 0xE0, 0x89, 0x91, 0x53, 0x41, 0xB7, 0x50, 0x48, 0x39, 0x99, 0xD8,
+    0xC0, 0xC5, 0xEA, 0x4B, 0x6B, 0x7A, 0x9F, 0x19, 0xC5, 0x7E, 0x99, 0xCA, 0x52, 0x95, 0x2C, 0xD0,
+    0xD8, 0x28, 0xD8, 0x2D, 0x19, 0x8F, 0x6D, 0x28, 0x18, 0x22, 0x31, 0xA5, 0x93, 0x90, 0xF5, 0xB4,
+    0x62, 0x4A, 0xB5, 0x00, 0xAE, 0xA4, 0xF4, 0xD5, 0x6A, 0x46, 0x9E, 0x6B, 0x17, 0x78, 0xA3, 0xAD,
+    0xF6, 0x83, 0xED, 0xF4, 0x23, 0xA0, 0xAD, 0x31, 0x4C, 0xA5, 0x0E, 0xA8, 0x4F, 0x61, 0x89, 0x76,
+    0xEA, 0xC6, 0x88, 0x34, 0x1A, 0x63, 0x21, 0x16, 0x97, 0xD8, 0x24, 0xDA, 0x6D, 0x8A, 0x3E, 0xFA,
+    0xA0, 0x62, 0x35, 0xB9, 0xE4, 0xD4, 0x76, 0xE0, 0xB4, 0xBE, 0x50, 0x8D, 0x23, 0xD5, 0x38, 0x52,
+    0x2D, 0x5B, 0xB6, 0x8C, 0x31, 0xE5, 0x6D, 0xDF, 0x20, 0x99, 0x5B, 0x24, 0x07, 0x87, 0x3E, 0xEB,
+    0x03, 0xEB, 0x58, 0x90, 0x23, 0x9E, 0x00, 0x1D, 0x82, 0xFD, 0x46, 0x5D, 0x59, 0x4D, 0x2C, 0xF9,
+    0xC6, 0x50, 0x94, 0x94, 0xC7, 0x3B, 0xC5, 0x87, 0x9C, 0x56, 0x5F, 0xBC, 0x84, 0xA5, 0x69, 0x1D,
+    0x5E, 0x1B, 0x12, 0x0C, 0x32, 0xA3, 0x31, 0x7D, 0x20, 0x55, 0x42, 0x30, 0xB2, 0x26, 0x28, 0x09,
+    0xC6, 0x00, 0xED, 0x14, 0x8C, 0x18, 0x53, 0x30, 0xAA, 0x29, 0x18, 0xA3, 0x03, 0x30, 0x72, 0x05,
+    0x43, 0x0D, 0x73, 0x65, 0xF1, 0x00, 0x8C, 0x7C, 0xEA, 0xC2, 0x9C, 0xD6, 0x25, 0x99, 0x16, 0x27,
+    0x6D, 0x6F, 0xD0, 0x7F, 0xAF, 0x80, 0xD4, 0xE9, 0x24, 0x7C, 0x42, 0x65, 0x16, 0x84, 0x35, 0x98,
+    0xE6, 0xE5, 0x58, 0xCA, 0x62, 0xE2, 0x89, 0x3B, 0xF2, 0x7C, 0x76, 0x5A, 0x0E, 0x55, 0x8C, 0x5B,
+    0xBD, 0xEF, 0x7A, 0x69, 0xF0, 0xCA, 0x3F, 0x81, 0xBD, 0xAA, 0x83, 0x16, 0x3E, 0x8F, 0x29, 0x66,
+    0x9E, 0xDD, 0xE1, 0x10, 0xDE, 0xD7, 0x64, 0x6D, 0x6A, 0xB6, 0x2F, 0x69, 0x51, 0x0E, 0xA8, 0xBC,
+    0x61, 0x48, 0xA1, 0xFE, 0x13, 0x5A, 0x10, 0x99, 0xC0, 0xD7, 0x02, 0x4A, 0x47, 0xC5, 0x06, 0x15,
+    0xEB, 0x68, 0x54, 0x22, 0x2D, 0x8B, 0x8E, 0x25, 0x51, 0x48, 0xCD, 0xEE, 0x29, 0x83, 0xA6, 0xB5,
+    0x9E, 0x2A, 0x6A, 0x79, 0xA2, 0x95, 0xCF, 0xBE, 0xA8, 0xC3, 0xF5, 0xAD, 0xCC, 0xA5, 0x3D, 0x25,
+    0xEA, 0x12, 0x4D, 0x9D, 0xC5, 0xD6, 0xFF, 0x7E, 0xF8, 0x8C, 0xA5, 0xBD, 0xF8, 0x4F, 0x5A, 0x49,
+    0x99, 0x50, 0x9C, 0xD5, 0xBF, 0x94, 0x63, 0x33, 0x2F, 0x28, 0xE8, 0x94, 0x4B, 0xC8, 0xA6, 0x06,
+    0x74, 0x38, 0xED, 0xD9, 0x17, 0x04, 0xF6, 0xBF, 0xB5, 0xBF, 0x01, 0xB5, 0x55, 0xBF, 0x8F, 0xD5,
+    0x46, 0x10, 0x9E, 0xF5, 0xF2, 0xCE, 0x89, 0x5C, 0xEC, 0x15, 0x47, 0x13, 0x09, 0x39, 0x05, 0x45,
+    0xBA, 0x6D, 0x28, 0x52, 0x20, 0xAD, 0x11, 0x45, 0xCA, 0xBB, 0x48, 0xF7, 0x44, 0x91, 0x86, 0x22,
+    0x55, 0x28, 0xF2, 0x0F, 0x10, 0x6C, 0x89, 0x82, 0x82, 0x02, 0x2A, 0x0A, 0x2A, 0x0A, 0x1A, 0xAE,
+    0x4A, 0x99, 0xE2, 0x22, 0x3B, 0xA2, 0xA0, 0x48, 0xC1, 0x0A, 0x4A, 0x0A, 0xAC, 0x48, 0x88, 0x82,
+    0x66, 0x23, 0x39, 0x8A, 0x03, 0xBB, 0x1E, 0xBE, 0xF1, 0x7B, 0x2F, 0x40, 0x01, 0x02, 0x74, 0x67,
+    0x69, 0x46, 0xBB, 0xE3, 0xD9, 0xF9, 0x66, 0x76, 0x7E, 0x2C, 0xD1, 0x8F, 0x44, 0xA4, 0x19, 0xCC,
+    0xEC, 0x56, 0x60, 0x79, 0x03, 0x76, 0x1D, 0xAB, 0x7C, 0x82, 0x8C, 0xF6, 0x84, 0x7D, 0x25, 0x4C,
+    0x54, 0x14, 0x57, 0xA2, 0xDC, 0xAD, 0x59, 0xF1, 0xD4, 0x43, 0xF9, 0x46, 0x20, 0xB2, 0xBB, 0x60,
+    0x2E, 0x1F, 0x89, 0xAE, 0xE8, 0x48, 0x94, 0x2E, 0x24, 0x1C, 0xE0, 0x89, 0x32, 0x66, 0x26, 0x1D,
+    0x88, 0xAB, 0xBC, 0xA7, 0xBA, 0x33, 0x9E, 0x9C, 0x6F, 0x63, 0xC6, 0x91, 0x93, 0x66, 0x28, 0x2E,
+    0x97, 0xCB, 0x7D, 0x1C, 0x84, 0x56, 0x47, 0x5B, 0xE0, 0x62, 0x85, 0x17, 0xF8, 0xE1, 0xEA, 0xCE,
+    0x12, 0x95, 0x37, 0x42, 0x06, 0x84, 0xFB, 0x10, 0x50, 0xD1, 0x8B, 0x07, 0x3A, 0x38, 0x1E, 0x28,
+    0x1B, 0x0C, 0xCF, 0x30, 0xD3, 0x81, 0xE0, 0xC8, 0x8F, 0x1A, 0x26, 0x16, 0xE4, 0xC8, 0x04, 0xED,
+    0x6D, 0xA3, 0xA3, 0x1A, 0x8C, 0x57, 0x7C, 0x90, 0x2C, 0x6B, 0x28, 0x18, 0xFE, 0x63, 0x85, 0x31,
+    0x55, 0x70, 0xA9, 0x03, 0xA0, 0x4E, 0x14, 0xAD, 0xD7, 0x81, 0xA9, 0xB8, 0x36, 0x20, 0x00, 0x3F,
+    0x47, 0x28, 0xCE, 0x1B, 0x6C, 0x5D, 0x4F, 0xD4, 0x76, 0x73, 0xBC, 0x9A, 0x1B, 0xF5, 0x1D, 0x73,
+    0xCA, 0xE1, 0x5D, 0x86, 0x90, 0xE8, 0x24, 0xEE, 0x01, 0x81, 0x16, 0x20, 0x0D, 0xB5, 0xB2, 0xA2,
+    0x0C, 0xCB, 0x2D, 0x5A, 0x7D, 0x67, 0x40, 0xAD, 0x10, 0x0C, 0x96, 0xB0, 0x44, 0x17, 0x67, 0xF1,
+    0x49, 0x04, 0x0A, 0xD4, 0x68, 0x41, 0x3A, 0xA9, 0x08, 0xA0, 0xCB, 0xA0, 0x33, 0x02, 0x38, 0x13,
+    0xBC, 0x9A, 0x69, 0x3A, 0xA8, 0xD6, 0xB2, 0x6D, 0xD0, 0x59, 0xD0, 0x21, 0x64, 0xF3, 0x39, 0x9C,
+    0x1F, 0x57, 0x20, 0xA7, 0x56, 0x20, 0x39, 0x3C, 0x36, 0x10, 0x7D, 0x49, 0x47, 0x8F, 0x81, 0xA4,
+    0x91, 0x99, 0x13, 0x41, 0x14, 0x4D, 0x43, 0x77, 0xB2, 0xA3, 0xC7, 0x88, 0xB6, 0xCA, 0x92, 0xEB,
+    0x54, 0x74, 0x0D, 0xED, 0x2D, 0x8E, 0xDA, 0x7E, 0x4F, 0xB6, 0x43, 0x02, 0xF3, 0x44, 0x0A, 0x35,
+    0xAD, 0xC4, 0xEE, 0x23, 0x1E, 0xA1, 0xE8, 0xBA, 0xF7, 0xB3, 0x94, 0x71, 0x72, 0xEC, 0x57, 0x99,
+    0xB4, 0x9D, 0x89, 0x7A, 0xA2, 0xD3, 0xF4, 0x19, 0xC7, 0x0D, 0xDC, 0xA4, 0xDF, 0xA3, 0xD5, 0x7F,
+    0x35, 0x5F, 0x7C, 0xFA, 0x71, 0x1D, 0x7E, 0xA9, 0x77, 0xFF, 0x1D, 0xA6, 0x1D, 0x55, 0xC9, 0x9D,
+    0x9C, 0x67, 0xD4, 0x71, 0xF3, 0xA1, 0x93, 0x60, 0xDE, 0xF2, 0x63, 0x4E, 0x8B, 0x9F, 0xEE, 0xCD,
+    0x2D, 0xE1, 0xB3, 0xB9, 0x9D, 0x58, 0xB5, 0x01, 0x3F, 0x6B, 0x6F, 0x02, 0x0A, 0xDA, 0x75, 0x28,
+    0x72, 0x34, 0x64, 0xBA, 0x34, 0xDD, 0x35, 0xFF, 0x30, 0xF7, 0xCE, 0x3B, 0xBF, 0x12, 0xC9, 0x4D,
+    0x97, 0x3D, 0xB4, 0x18, 0xE6, 0x50, 0xDB, 0x7C, 0x9B, 0x1B, 0x5C, 0xE6, 0x00, 0x5B, 0xFF, 0xAD,
+    0x4B, 0x9B, 0x54, 0x25, 0xED, 0x9F, 0xCE, 0xCA, 0x20, 0x90, 0x9E, 0xFB, 0xB6, 0xC5, 0x9E, 0x16,
+    0x9B, 0xBF, 0xCB, 0x4A, 0x2D, 0xBF, 0xE7, 0x21, 0x93, 0xEC, 0x51, 0x9D, 0x88, 0x7B, 0x05, 0xB7,
+    0x12, 0xD5, 0x64, 0xB8, 0x2B, 0x71, 0x1F, 0x63, 0x1E, 0x28, 0xF1, 0x39, 0x08, 0x6D, 0x80, 0xF0,
+    0x3E, 0x43, 0x18, 0xDC, 0xF3, 0x40, 0xB1, 0x48, 0x10, 0x02, 0x0A, 0xD7, 0x06, 0x5D, 0x1D, 0x14,
+    0x07, 0x39, 0x1B, 0x35, 0x07, 0xCD, 0x0A, 0xBD, 0x5E, 0x77, 0x6F, 0x21, 0x65, 0xB2, 0x41, 0xCD,
+    0xAC, 0xE6, 0x56, 0x21, 0xD3, 0x41, 0x52, 0x3C, 0x7F, 0x3F, 0xDF, 0x45, 0x6B, 0xC0, 0x6D, 0x14,
+    0x81, 0x37, 0x63, 0xCE, 0x59, 0x42, 0x8B, 0x20, 0xEE, 0xF6, 0xC1, 0x08, 0xD7, 0xE1, 0xB0, 0x7B,
+    0x3A, 0x60, 0xC1, 0xFF, 0x2F, 0x1A, 0x72, 0x7F, 0x46, 0xC4, 0x0F, 0x84, 0xF6, 0x3C, 0x53, 0x19,
+    0xCA, 0xE9, 0x87, 0x28, 0xE3, 0x44, 0xEC, 0xC0, 0xEA, 0x72, 0x13, 0x3D, 0xFD, 0xBA, 0x46, 0xB5,
+    0x68, 0x6B, 0x54, 0x15, 0xCD, 0x85, 0x71, 0xCC, 0xA0, 0xB6, 0x59, 0x4D, 0x62, 0xF5, 0x52, 0x66,
+    0x6B, 0xD1, 0x51, 0xDE, 0x7C, 0x73, 0x9C, 0xA0, 0x0B, 0xB5, 0xCE, 0x70, 0x8D, 0x69, 0xA9, 0xAF,
+    0xCB, 0x00, 0xDB, 0x59, 0xE3, 0x6D, 0xBD, 0xAC, 0xA8, 0x60, 0xAE, 0xD0, 0x7E, 0xC8, 0x6D, 0x53,
+    0x07, 0xCC, 0x4C, 0xBE, 0x1A, 0x71, 0xFF, 0x35, 0x2C, 0x3F, 0x79, 0x17, 0x4B, 0x16, 0x70, 0x23,
+    0x62, 0x88, 0xBA, 0x07, 0xD0, 0x19, 0x1C, 0x72, 0xAA, 0xF8, 0x59, 0xDB, 0xC9, 0x1C, 0x85, 0x1D,
+    0x84, 0xB3, 0xD8, 0x5B, 0x5B, 0xCE, 0x7B, 0xA4, 0x90, 0x4B, 0x4F, 0xE6, 0x6F, 0x2C, 0x76, 0x16,
+    0xC7, 0x09, 0x78, 0x82, 0xB6, 0x7F, 0xD3, 0x8F, 0x47, 0x77, 0xF5, 0xD5, 0x88, 0xC9, 0x9E, 0xA3,
+    0xC8, 0x46, 0xFD, 0x0A, 0xDB, 0x71, 0xD4, 0xBE, 0x01, 0xB2, 0x6A, 0x6F, 0x7E, 0x4D, 0x96, 0xD3,
+    0xA1, 0x34, 0x51, 0xD0, 0x93, 0x62, 0x5F, 0xE0, 0x8E, 0xA5, 0x33, 0xDA, 0x50, 0xF6, 0x19, 0x0F,
+    0xD6, 0x17, 0x0F, 0x07, 0x74, 0x9B, 0x01, 0x3B, 0x04, 0x7B, 0x14, 0xC0, 0x5E, 0x74, 0x26, 0xA0,
+    0xEA, 0x4D, 0x28, 0x23, 0xDE, 0x12, 0x23, 0x3D, 0x69, 0xF8, 0x16, 0x93, 0xCC, 0x23, 0xBA, 0x6C,
+    0xB9, 0xA7, 0x6D, 0xB5, 0xBF, 0x49, 0x6A, 0x5E, 0xCD, 0xEF, 0x99, 0xB0, 0x34, 0xBF, 0xAA, 0x73,
+    0xB4, 0xB4, 0x99, 0xE2, 0xD5, 0x72, 0xBF, 0xC5, 0x7B, 0x35, 0xD5, 0x5C, 0xB5, 0x23, 0xDE, 0x54,
+    0xE3, 0x3F, 0x9A, 0xA1, 0x87, 0x3D, 0x1A, 0xD9, 0x62, 0x94, 0xC0, 0x83, 0x0C, 0x1E, 0x54, 0xF3,
+    0x3B, 0x0C, 0x3F, 0x24, 0x95, 0x6F, 0x6A, 0x79, 0xF3, 0xBD, 0x06, 0xBD, 0x55, 0x3D, 0x8F, 0xD5,
+    0x46, 0x14, 0x3D, 0xF6, 0xB0, 0x6B, 0x84, 0x25, 0x86, 0x62, 0x57, 0x89, 0x44, 0xE1, 0x14, 0xF4,
+    0xFE, 0x03, 0x01, 0x3B, 0x4A, 0xB1, 0x25, 0x5B, 0xEC, 0x56, 0x69, 0xD2, 0xA6, 0xA3, 0xA4, 0x00,
+    0xC6, 0x09, 0x05, 0xE5, 0xA6, 0x88, 0xF8, 0x07, 0x29, 0x22, 0x45, 0xA9, 0x52, 0xA4, 0x00, 0x79,
+    0x60, 0x0B, 0x0A, 0x0A, 0xBC, 0x89, 0x52, 0xA5, 0x71, 0x92, 0x82, 0x82, 0x66, 0x10, 0x83, 0x98,
+    0x24, 0x63, 0x5F, 0xCE, 0xF8, 0xBD, 0x55, 0x3E, 0x14, 0x89, 0xE8, 0x45, 0xC2, 0xEF, 0xCD, 0x68,
+    0x7C, 0x67, 0xE6, 0xCC, 0xBD, 0xE7, 0x9E, 0xB9, 0x06, 0x96, 0x27, 0x1B, 0xD8, 0x95, 0x8E, 0x9D,
+    0x19, 0xD9, 0x49, 0xC7, 0xEE, 0xF3, 0xD5, 0x14, 0x76, 0x0F, 0xDB, 0xC3, 0x83, 0x5E, 0x1E, 0xC8,
+    0x6C, 0xA4, 0xED, 0x43, 0x11, 0xA0, 0x87, 0xFF, 0xDC, 0x45, 0x54, 0x83, 0x8A, 0xA8, 0xAD, 0x9A,
+    0xD0, 0xD8, 0x5C, 0xEE, 0x4A, 0x0B, 0x91, 0x19, 0xA8, 0xC5, 0x13, 0xFB, 0x10, 0xA7, 0x8F, 0x49,
+    0x9D, 0x58, 0x40, 0xBD, 0xA2, 0x1B, 0xFA, 0x41, 0x00, 0xCE, 0xE1, 0xE3, 0xB7, 0xE8, 0x81, 0x7E,
+    0xC8, 0xD7, 0xFA, 0x98, 0xE7, 0x56, 0xA9, 0xDB, 0xC2, 0xFE, 0xDB, 0x0C, 0xFF, 0x1A, 0x5B, 0x43,
+    0xD6, 0x2B, 0x9A, 0x8B, 0x89, 0x2F, 0x97, 0xD6, 0x89, 0x39, 0xDC, 0xDF, 0xE5, 0xE9, 0x77, 0xE4,
+    0xA9, 0x8C, 0x75, 0x28, 0x23, 0x66, 0x34, 0x43, 0x65, 0x33, 0x51, 0x1E, 0xDA, 0xDF, 0xE2, 0xA6,
+    0x27, 0x16, 0xF9, 0x4C, 0x87, 0xB5, 0x24, 0x16, 0x99, 0x47, 0x9E, 0x47, 0xB3, 0xFD, 0xEB, 0x80,
+    0x80, 0x2A, 0x9D, 0x6A, 0x64, 0x4C, 0xF1, 0xA0, 0x91, 0x01, 0x17, 0xE7, 0xD5, 0x0A, 0x4E, 0xB4,
+    0x4A, 0xC4, 0xA9, 0x58, 0x45, 0xB5, 0xFC, 0xF2, 0x69, 0xD5, 0xD2, 0xAF, 0x08, 0x6A, 0xEA, 0x1D,
+    0xE7, 0x3B, 0x35, 0x7F, 0xB1, 0xAC, 0xAF, 0x98, 0xA4, 0xB4, 0x1F, 0xD9, 0x27, 0x29, 0x8C, 0x01,
+    0xBD, 0xB8, 0x7C, 0x2A, 0xBD, 0x0A, 0xCA, 0x17, 0x5E, 0xF9, 0xD2, 0x15, 0xAE, 0x74, 0x75, 0x57,
+    0xBA, 0xFB, 0x54, 0x54, 0x64, 0x9B, 0xD9, 0xC4, 0x96, 0xCE, 0xD0, 0x5E, 0xC5, 0xD2, 0xA9, 0x99,
+    0x4A, 0x93, 0xF2, 0xB9, 0x9D, 0xCB, 0x17, 0xE3, 0x64, 0x5E, 0x48, 0xEC, 0x9F, 0xD3, 0x31, 0xEC,
+    0x22, 0x6F, 0x81, 0x7B, 0x2B, 0x21, 0x26, 0x32, 0x38, 0x44, 0xB7, 0xA2, 0x61, 0x1F, 0x85, 0x8C,
+    0xB9, 0x48, 0x6B, 0xF6, 0x62, 0xE1, 0x1A, 0xBB, 0x45, 0x57, 0x32, 0x63, 0x4B, 0x89, 0x4A, 0x7A,
+    0xDB, 0xAB, 0xA8, 0x69, 0x94, 0x8F, 0xA6, 0x52, 0x24, 0xD6, 0x41, 0xDA, 0x9D, 0xAC, 0xC5, 0x36,
+    0x37, 0x92, 0x98, 0xBA, 0x83, 0x72, 0x0B, 0x58, 0x8E, 0xCD, 0xC1, 0xCE, 0xD0, 0x2D, 0xFA, 0xC8,
+    0xFC, 0x5D, 0xB9, 0x87, 0xF2, 0xD8, 0xC1, 0x9D, 0xDF, 0x18, 0x2C, 0xEF, 0xA8, 0x82, 0xAB, 0x64,
+    0xD2, 0xE1, 0x67, 0xA6, 0x26, 0x5B, 0x0B, 0x8D, 0xF9, 0x99, 0x93, 0x30, 0x0A, 0x6F, 0xAC, 0x21,
+    0xCA, 0x3E, 0x73, 0xF7, 0x4E, 0x24, 0xBF, 0xB6, 0xF9, 0x83, 0xB4, 0x11, 0x85, 0x60, 0x2F, 0xFB,
+    0xA1, 0x17, 0x79, 0x28, 0x47, 0x3E, 0x6B, 0x77, 0x16, 0x07, 0x42, 0x83, 0xFA, 0x91, 0xCF, 0xA3,
+    0x21, 0x50, 0xBB, 0x39, 0xD2, 0x7D, 0x72, 0x1E, 0x50, 0xDC, 0xB6, 0xB8, 0xFE, 0x3E, 0x8A, 0x47,
+    0x16, 0x35, 0x49, 0xDB, 0xD9, 0x90, 0xAD, 0x5D, 0xEE, 0xAC, 0xA4, 0x12, 0x6E, 0x13, 0xA9, 0x4E,
+    0xE4, 0xB3, 0x89, 0x6E, 0xA8, 0x70, 0xA0, 0xC7, 0xCA, 0x65, 0xCB, 0xA9, 0x22, 0x5F, 0x35, 0x4F,
+    0x03, 0x72, 0xBA, 0x03, 0xED, 0xAA, 0x11, 0xCD, 0x8F, 0xF2, 0xDB, 0x37, 0x9C, 0x12, 0xDF, 0x87,
+    0x9A, 0x28, 0xD8, 0x62, 0x30, 0x6C, 0xB5, 0x50, 0x6E, 0x63, 0xF3, 0x43, 0xAC, 0x06, 0xA3, 0xDD,
+    0xF9, 0x24, 0x41, 0x59, 0x64, 0xAD, 0x3D, 0x72, 0x8E, 0xCC, 0xEF, 0x5F, 0xF3, 0x64, 0x4A, 0xBB,
+    0xC5, 0x01, 0x70, 0x93, 0xF9, 0x1E, 0x96, 0xB4, 0xDF, 0x58, 0x42, 0x7A, 0x97, 0x74, 0xB0, 0x8A,
+    0x5C, 0xA6, 0x6E, 0x2D, 0xB2, 0x24, 0xDF, 0xEE, 0x54, 0x53, 0x64, 0xA9, 0x0F, 0xBC, 0x8D, 0x94,
+    0xA1, 0x37, 0x98, 0x9B, 0xAE, 0x39, 0x12, 0xF9, 0x55, 0x24, 0xCC, 0xA7, 0xF0, 0x99, 0x7C, 0xF9,
+    0x6D, 0x23, 0x53, 0x2E, 0x53, 0x62, 0x01, 0xB0, 0x8B, 0x8A, 0x1A, 0xFE, 0x5B, 0xE8, 0x76, 0x51,
+    0xEB, 0x46, 0x38, 0x48, 0x82, 0x54, 0x82, 0xFC, 0xD5, 0x08, 0x7F, 0x03, 0xDF, 0x95, 0x1B, 0xE3,
+    0xC4, 0xBA, 0x35, 0x57, 0x47, 0x7D, 0xEC, 0xD1, 0x5E, 0x58, 0x0C, 0x07, 0xE4, 0x64, 0xE4, 0x75,
+    0x55, 0xA1, 0x3E, 0x21, 0xE1, 0x33, 0x71, 0x44, 0x12, 0x4E, 0x58, 0xD1, 0x36, 0xA0, 0x98, 0xEF,
+    0x0E, 0x24, 0xB9, 0x64, 0x01, 0x22, 0xBB, 0x67, 0xA1, 0xAD, 0x0A, 0x0C, 0x28, 0x77, 0x0B, 0x57,
+    0xA4, 0x2F, 0x54, 0x33, 0xFA, 0xAE, 0x1A, 0x8B, 0x90, 0xCD, 0x30, 0x7F, 0x0E, 0xFA, 0xA9, 0x21,
+    0xC7, 0x97, 0x18, 0x39, 0x0B, 0xDB, 0xA8, 0xC6, 0x75, 0x75, 0x7E, 0xC3, 0x7A, 0x60, 0x82, 0xB1,
+    0x97, 0xE3, 0x15, 0x7D, 0xB4, 0x7C, 0x64, 0xDE, 0xB8, 0xBE, 0x38, 0x09, 0x52, 0x3F, 0xF9, 0x25,
+    0x5E, 0x58, 0x5D, 0x8B, 0x5C, 0x3A, 0x13, 0xB8, 0x9E, 0xF5, 0xD4, 0xFC, 0xB3, 0xAB, 0xE5, 0xC3,
+    0xA5, 0x8C, 0x32, 0xC5, 0xD7, 0x28, 0x52, 0x8B, 0x8A, 0x51, 0x36, 0x1E, 0xEA, 0xA7, 0xF4, 0x09,
+    0x49, 0x2D, 0x55, 0x27, 0x5B, 0x51, 0xBB, 0xB2, 0x37, 0x17, 0xBE, 0x8C, 0x8D, 0xD5, 0x8E, 0x7A,
+    0x3A, 0x8E, 0x10, 0xCD, 0x8A, 0x97, 0x5E, 0xFB, 0xCE, 0x7C, 0x20, 0x77, 0x22, 0x95, 0xCA, 0xAA,
+    0x1A, 0x96, 0x34, 0xE0, 0x1C, 0xCF, 0xD6, 0x2F, 0x47, 0x62, 0xD2, 0xF0, 0x7D, 0x2A, 0xA3, 0x67,
+    0x56, 0x77, 0x74, 0x8B, 0xBC, 0xF7, 0x8F, 0x79, 0x15, 0x58, 0x30, 0xB7, 0xE5, 0x59, 0x72, 0x3B,
+    0x45, 0xA0, 0x19, 0x83, 0x4A, 0x51, 0x24, 0x43, 0xF3, 0x37, 0x03, 0xD3, 0x21, 0x5E, 0xA2, 0x99,
+    0xF0, 0xDE, 0x92, 0x76, 0xE8, 0x71, 0xF1, 0x0B, 0x25, 0xD5, 0xB4, 0xBD, 0x2E, 0x48, 0x14, 0x6E,
+    0x3F, 0xB3, 0x82, 0x0B, 0x64, 0x6F, 0x2A, 0x7C, 0xF1, 0x6F, 0x7E, 0x92, 0x87, 0x4F, 0xD7, 0x7E,
+    0xE6, 0xA7, 0x7E, 0xFE, 0xFF, 0xE7, 0x35, 0xB5, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x7D, 0x6B,
+    0xDF, 0x27, 0x83, 0x5C, 0x2C, 0x05, 0x11, 0x84, 0xC6, 0x94, 0x69, 0x90, 0x5B, 0xAA, 0x5B, 0x1F,
+    0x14, 0x94, 0x39, 0xA4, 0x9C, 0x68, 0xA9, 0xA9, 0x53, 0x50, 0x40, 0x6C, 0x42, 0x41, 0x79, 0xF9,
+    0x11, 0x14, 0x88, 0x06, 0x0A, 0x1A, 0xA4, 0x1C, 0xBB, 0x4A, 0x8A, 0x14, 0x34, 0x8E, 0x90, 0x68,
+    0xF1, 0x09, 0x21, 0x21, 0x28, 0x58, 0x9D, 0x1C, 0xE5, 0x53, 0x58, 0x7B, 0x78, 0x63, 0x1F, 0x7C,
+    0x01, 0x51, 0x5D, 0x2E, 0xFB, 0x69, 0x57, 0xF6, 0x7A, 0xF7, 0xCD, 0x9B, 0x99, 0x37, 0xF3, 0x01,
+    0x77, 0x80, 0xBC, 0x07, 0x5C, 0x03, 0xB3, 0x05, 0x6C, 0x07, 0xBC, 0x8A, 0x65, 0x98, 0x1B, 0x80,
+    0x9F, 0x61, 0x45, 0x20, 0xEF, 0x4C, 0xC5, 0x58, 0x24, 0x17, 0x6C, 0x14, 0xB8, 0xFB, 0x09, 0x62,
+    0x63, 0xBE, 0xBE, 0x76, 0xED, 0x27, 0xF2, 0x59, 0xCA, 0x44, 0x42, 0x26, 0xBC, 0x7F, 0x65, 0xBD,
+    0xBB, 0xC0, 0x09, 0xE1, 0x5A, 0x60, 0xBB, 0x8F, 0x3C, 0xDC, 0x7C, 0x36, 0xC8, 0x6B, 0x7B, 0xC8,
+    0xD3, 0x87, 0xA8, 0x65, 0xC0, 0x4D, 0xCF, 0xF7, 0x97, 0x56, 0x2B, 0x47, 0xE0, 0x56, 0x97, 0xF3,
+    0xA4, 0x7B, 0x28, 0x07, 0x93, 0xD9, 0x61, 0x3C, 0x05, 0x39, 0x54, 0x43, 0x7B, 0x2A, 0xF0, 0x12,
+    0xD5, 0x36, 0x36, 0xCD, 0x72, 0xB5, 0x78, 0xB8, 0x85, 0xFB, 0x3E, 0x62, 0xAE, 0x03, 0x9A, 0xBD,
+    0x67, 0x86, 0x3B, 0x01, 0xF8, 0x32, 0x29, 0xB3, 0x0F, 0xBE, 0xFC, 0xC2, 0xCB, 0xC4, 0x55, 0xF7,
+    0xEF, 0xEE, 0xF6, 0xB1, 0x39, 0x44, 0x26, 0x4F, 0x82, 0x13, 0xC9, 0x53, 0x35, 0x56, 0x7D, 0x1D,
+    0x25, 0x93, 0xFB, 0xA9, 0x16, 0x7B, 0x76, 0x96, 0xDC, 0x1F, 0x34, 0x13, 0xDD, 0x3D, 0xC1, 0x5C,
+    0x4C, 0x36, 0xD6, 0x0C, 0xD1, 0x63, 0x7A, 0x0B, 0x46, 0x6C, 0x49, 0x88, 0xA5, 0x9D, 0x22, 0xF2,
+    0x41, 0xDD, 0x2F, 0x98, 0x30, 0xBC, 0x8E, 0x7F, 0x46, 0x1D, 0xF9, 0x4B, 0x75, 0x32, 0xC2, 0xA0,
+    0xBB, 0xA0, 0x94, 0x95, 0x6B, 0x4E, 0xCE, 0x78, 0x6A, 0x63, 0xE2, 0x86, 0xFF, 0x5D, 0x34, 0xFE,
+    0x74, 0xEE, 0x67, 0x21, 0xF9, 0xC3, 0x73, 0xA0, 0x9A, 0xB3, 0x0A, 0x34, 0xD3, 0xAF, 0x72, 0x50,
+    0x59, 0x5C, 0x0E, 0xBA, 0xA6, 0x3D, 0x71, 0x11, 0x2A, 0xEB, 0x64, 0x04, 0x3E, 0xA6, 0xA9, 0x37,
+    0xB2, 0x70, 0x79, 0xE8, 0xAE, 0xEC, 0x51, 0xFD, 0xB0, 0x45, 0x1E, 0x35, 0xCC, 0x7B, 0x3B, 0xDE,
+    0x3E, 0xF0, 0x17, 0x7D, 0x2C, 0x52, 0xF1, 0x1F, 0xB0, 0x7F, 0xA1, 0x8F, 0x36, 0x66, 0xF2, 0x55,
+    0x02, 0xF3, 0x32, 0x16, 0x72, 0x9C, 0x70, 0xC5, 0x68, 0x4E, 0xDF, 0xE7, 0xDC, 0x57, 0x7E, 0xE4,
+    0x6D, 0x49, 0xB7, 0x54, 0xCA, 0xDD, 0x0E, 0xBD, 0x15, 0x2B, 0x95, 0xDC, 0x96, 0x4E, 0x9A, 0xBA,
+    0xAB, 0x06, 0x1B, 0xF2, 0x54, 0x0C, 0xF0, 0x6F, 0x8F, 0xB0, 0x43, 0x42, 0x96, 0xA8, 0x08, 0x47,
+    0xF5, 0x5B, 0xD1, 0x4A, 0xE0, 0x5D, 0x37, 0xAC, 0x09, 0xD4, 0x2A, 0x03, 0x03, 0x92, 0xCD, 0x4B,
+    0x2D, 0xA0, 0xE6, 0xCC, 0x74, 0x8F, 0x12, 0x31, 0x3E, 0xF0, 0x02, 0xCF, 0xF1, 0x7B, 0xC9, 0xB3,
+    0xD4, 0x26, 0xBC, 0x69, 0xB2, 0x49, 0x86, 0x52, 0x64, 0xA8, 0x9F, 0x48, 0xF0, 0x8D, 0xBC, 0x95,
+    0xB2, 0xB9, 0x8C, 0xC5, 0xB6, 0x0E, 0xD5, 0xE0, 0xD1, 0xDE, 0x4E, 0x66, 0x2A, 0xE9, 0x55, 0xFD,
+    0x8B, 0xEF, 0xBC, 0x6C, 0x59, 0x37, 0x4D, 0xF9, 0xA8, 0x59, 0xEF, 0x32, 0x99, 0xB3, 0x52, 0x6D,
+    0xCC, 0x2A, 0x47, 0x8E, 0x5B, 0x74, 0xA6, 0x7E, 0x10, 0x51, 0x9E, 0xD2, 0xC8, 0xE1, 0x2E, 0x5C,
+    0x46, 0x92, 0x4B, 0xED, 0x5C, 0xCE, 0xF9, 0x84, 0xEF, 0xD0, 0x76, 0x0E, 0x36, 0x56, 0x5D, 0x36,
+    0x51, 0x11, 0xEE, 0x53, 0x1E, 0x3F, 0x63, 0xEE, 0x26, 0x5E, 0x71, 0x8C, 0x72, 0x21, 0xE7, 0x09,
+    0x55, 0xC9, 0xD0, 0x6B, 0xC6, 0x9E, 0x84, 0xB7, 0x58, 0xEA, 0xD5, 0x73, 0x96, 0x83, 0x42, 0x6E,
+    0x8E, 0x1A, 0xAD, 0x28, 0xED, 0x2E, 0xB2, 0x4B, 0xB8, 0x8E, 0xD7, 0x74, 0x91, 0xC5, 0x2A, 0x8F,
+    0xE4, 0xFA, 0x75, 0x59, 0xCA, 0x9F, 0x78, 0xD8, 0x1E, 0xAB, 0xEB, 0xD7, 0xB9, 0xB8, 0x82, 0x58,
+    0xB7, 0x98, 0x2C, 0x4C, 0xEF, 0xD1, 0xAC, 0xC8, 0x4C, 0x13, 0xAC, 0x0C, 0x9A, 0x93, 0x86, 0x76,
+    0xDB, 0xA0, 0xEC, 0x7A, 0xCF, 0x66, 0x91, 0x64, 0xCA, 0x25, 0x59, 0x89, 0x86, 0xDF, 0x37, 0x47,
+    0xAB, 0x36, 0xD8, 0x3A, 0xDA, 0x99, 0x0C, 0xC6, 0x62, 0x6C, 0x43, 0x4B, 0x9C, 0x43, 0x17, 0xF0,
+    0x0A, 0x85, 0xC4, 0x0A, 0xFF, 0x33, 0x95, 0xD1, 0x05, 0x96, 0xA2, 0x7D, 0xE4, 0x7B, 0x2F, 0x72,
+    0x4F, 0x8E, 0x47, 0xD3, 0xBC, 0x0C, 0xBC, 0x00, 0x52, 0xDA, 0x37, 0xBD, 0x52, 0x0F, 0x6B, 0x02,
+    0x61, 0x3E, 0x7F, 0xEE, 0xD4, 0x15, 0x36, 0x16, 0xA8, 0x7E, 0xA4, 0x88, 0x12, 0xCC, 0xB7, 0xB8,
+    0xB8, 0x07, 0xCF, 0x93, 0x63, 0xDD, 0xAC, 0x5D, 0x6D, 0xD1, 0x30, 0xEF, 0x68, 0x9F, 0xF0, 0xDA,
+    0x30, 0x36, 0x17, 0x21, 0xFB, 0xD1, 0xD2, 0xD8, 0x0C, 0xA5, 0x55, 0xFD, 0xAA, 0x05, 0x4B, 0x45,
+    0xAE, 0x7E, 0x5F, 0x5B, 0x8B, 0x85, 0x3B, 0x94, 0x15, 0xAE, 0x9E, 0x4B, 0xD4, 0xDF, 0xD1, 0xBE,
+    0xCB, 0x16, 0x10, 0xA4, 0x71, 0xE5, 0x08, 0x36, 0xE7, 0xEC, 0x94, 0xCC, 0xF9, 0xC8, 0x5A, 0x5E,
+    0x5C, 0xA6, 0x7A, 0x61, 0xB7, 0xDA, 0x56, 0x48, 0x86, 0xBC, 0xD8, 0x43, 0xDF, 0xA5, 0x4F, 0x07,
+    0x22, 0xCA, 0xA3, 0x5B, 0xFB, 0x75, 0xB7, 0xB8, 0xD0, 0x2E, 0x7F, 0x53, 0xB4, 0x9F, 0x35, 0x7F,
+    0xC7, 0x9A, 0x91, 0x17, 0x56, 0xF4, 0xF5, 0xD8, 0x1E, 0x10, 0xFB, 0x4D, 0x1B, 0xA1, 0xD1, 0x21,
+    0xAC, 0xEB, 0x51, 0x32, 0x2B, 0xF2, 0xDB, 0xD7, 0xB5, 0xB0, 0x55, 0x4D, 0x30, 0xE7, 0x44, 0xB5,
+    0x61, 0xD2, 0x7F, 0x8D, 0xEC, 0x89, 0x0D, 0xA6, 0x7F, 0xF1, 0x72, 0x99, 0x2E, 0x61, 0x60, 0x0D,
+    0x67, 0x8F, 0x7B, 0x33, 0xDE, 0xC5, 0x37, 0xE5, 0xC5, 0x99, 0xFE, 0xEF, 0xF8, 0x0B, 0xAD, 0x55,
+    0xBD, 0x6E, 0x1D, 0x45, 0x14, 0x3E, 0xB3, 0xC3, 0xCD, 0x4A, 0x6C, 0x31, 0x29, 0xEC, 0x06, 0x8A,
+    0xA5, 0xA7, 0x18, 0x0A, 0x8A, 0x14, 0x88, 0x99, 0xE4, 0x05, 0x30, 0xD2, 0xBD, 0x0D, 0x4D, 0x7A,
+    0x22, 0xE4, 0x17, 0xB0, 0xB2, 0x0B, 0x2F, 0xE0, 0x5B, 0x51, 0x40, 0x6B, 0x0A, 0xDC, 0x38, 0x85,
+    0x0B, 0x8A, 0x88, 0x5D, 0xA7, 0x49, 0x41, 0x33, 0x81, 0x07, 0xC8, 0xA2, 0x44, 0x48, 0x31, 0x45,
+    0xC6, 0x68, 0x91, 0x36, 0xD6, 0xCE, 0x1E, 0xBE, 0x99, 0xBD, 0x76, 0x02, 0x54, 0xA0, 0x3B, 0x57,
+    0x63, 0xDF, 0x7B, 0xF6, 0xFC, 0x7C, 0xE7, 0xEF, 0x5B, 0x12, 0x6B, 0xA2, 0xD2, 0x11, 0x35, 0x35,
+    0x89, 0x40, 0x24, 0x2C, 0xA5, 0xB3, 0xFF, 0x9C, 0x34, 0x8F, 0x92, 0xD9, 0x1B, 0xA7, 0x1E, 0x05,
+    0x32, 0xCA, 0xD3, 0x0F, 0x95, 0xA5, 0x0C, 0x3A, 0xF8, 0x4A, 0xA6, 0x25, 0x62, 0x4B, 0x72, 0x22,
+    0x2A, 0x46, 0x78, 0xE8, 0x21, 0x1A, 0x68, 0xA7, 0x62, 0x76, 0xB8, 0xB0, 0xED, 0x48, 0xEC, 0x11,
+    0x2D, 0xF0, 0xD8, 0x93, 0x84, 0x46, 0x93, 0x7E, 0xC4, 0xB3, 0xA4, 0x8C, 0xBD, 0xE4, 0x49, 0x06,
+    0x73, 0x16, 0x72, 0xCF, 0xD4, 0xC1, 0x99, 0x9A, 0xB5, 0xE0, 0x52, 0x7B, 0xCA, 0xF9, 0xB8, 0x6D,
+    0xD8, 0xE7, 0xDC, 0xD3, 0x62, 0xC6, 0x23, 0xDB, 0x92, 0xD4, 0xA3, 0x9E, 0xCA, 0x97, 0x96, 0xCA,
+    0x01, 0x10, 0xEA, 0x24, 0x16, 0xCD, 0x9A, 0xA0, 0xA8, 0x98, 0x5B, 0xB6, 0xA6, 0xE8, 0x69, 0x34,
+    0x6D, 0xF6, 0x2B, 0x20, 0x16, 0xFD, 0x06, 0x22, 0x4C, 0x23, 0x62, 0x98, 0xC0, 0x2F, 0x55, 0x48,
+    0x14, 0xC8, 0x3E, 0x65, 0xE6, 0xDB, 0xCC, 0x23, 0x6C, 0xEB, 0x14, 0xC1, 0xEE, 0x50, 0xAF, 0xC9,
+    0x94, 0x56, 0x42, 0x00, 0xBB, 0x6C, 0x76, 0xBF, 0x0B, 0xD8, 0x23, 0x31, 0xD7, 0xFC, 0x89, 0xAF,
+    0x6E, 0xC3, 0xF7, 0xAD, 0x2B, 0x98, 0xF0, 0xEE, 0x62, 0xE2, 0x82, 0xCF, 0x1F, 0xA0, 0x4E, 0x82,
+    0x43, 0x4A, 0x37, 0x9E, 0x0C, 0x50, 0xA9, 0x38, 0x8B, 0x20, 0x5F, 0xC2, 0x8D, 0x82, 0x3A, 0xA9,
+    0x76, 0x7E, 0x26, 0x3E, 0x3B, 0xB6, 0x64, 0x18, 0x79, 0x35, 0x31, 0xBC, 0x69, 0xF7, 0xE1, 0x1E,
+    0xC5, 0x83, 0x4F, 0xED, 0xE1, 0xDB, 0xB4, 0x08, 0xCE, 0x96, 0x01, 0x1A, 0x22, 0xD5, 0x5F, 0x8B,
+    0xF0, 0xC9, 0x07, 0x19, 0x2D, 0x94, 0xCF, 0x26, 0x32, 0xBF, 0x35, 0x5D, 0xC1, 0x08, 0x6A, 0x78,
+    0xDA, 0x34, 0x0C, 0xC7, 0x5A, 0x7A, 0x37, 0x68, 0x92, 0xFC, 0x33, 0x4A, 0x18, 0x3E, 0x46, 0xCA,
+    0xBF, 0x20, 0x95, 0x70, 0x8B, 0x16, 0xFB, 0x4F, 0xA8, 0x80, 0x36, 0xDA, 0xE9, 0x88, 0xEF, 0x04,
+    0x34, 0x5C, 0x3B, 0x39, 0xA2, 0x97, 0xA6, 0xFD, 0xD7, 0x97, 0x4E, 0xBB, 0x8C, 0x4F, 0x02, 0xA9,
+    0xE4, 0x7F, 0x80, 0xC5, 0x8E, 0x40, 0xEF, 0x3E, 0xFF, 0x1E, 0x69, 0xC3, 0x3E, 0xC3, 0x1F, 0x4F,
+    0x2C, 0x1A, 0x0F, 0x38, 0x95, 0x03, 0xC2, 0xE6, 0x0A, 0xA1, 0x0C, 0xF7, 0xA6, 0x23, 0xF5, 0x27,
+    0x73, 0x67, 0x1C, 0xCA, 0x93, 0x44, 0x23, 0xB4, 0xCA, 0x0E, 0x5A, 0x8C, 0x10, 0xC5, 0x40, 0xFC,
+    0x0D, 0xD7, 0x3A, 0x16, 0x80, 0xF9, 0x15, 0xBD, 0x46, 0x8E, 0x4E, 0x3A, 0xC0, 0x43, 0x7B, 0xF6,
+    0x1D, 0xDD, 0x68, 0x5E, 0x20, 0x3A, 0x26, 0x4B, 0x3B, 0x7A, 0xBF, 0x89, 0x11, 0x1D, 0x92, 0x75,
+    0x25, 0x90, 0x69, 0xC0, 0x34, 0xFF, 0xBC, 0x51, 0x7E, 0xC9, 0x2E, 0x02, 0x96, 0x7C, 0x18, 0x12,
+    0xDE, 0xD5, 0x2A, 0xC2, 0x9D, 0xEF, 0xE6, 0xEC, 0xAE, 0x56, 0x4B, 0xD4, 0x7E, 0x44, 0xF8, 0x51,
+    0x06, 0x11, 0x91, 0x1D, 0xE0, 0x7E, 0x18, 0x1B, 0x9A, 0x2E, 0xA6, 0x28, 0xDD, 0xE9, 0xD8, 0x6E,
+    0x64, 0x37, 0x71, 0x3F, 0xC2, 0x7D, 0x08, 0x59, 0xB2, 0x83, 0xFD, 0x90, 0xA1, 0x2E, 0xCC, 0x76,
+    0x77, 0x95, 0x2A, 0x8F, 0xF1, 0xD1, 0x68, 0x08, 0xF6, 0xE4, 0xAB, 0x50, 0xB6, 0xE6, 0xB0, 0x53,
+    0xCF, 0xA0, 0xC3, 0x3C, 0x99, 0x3A, 0x0D, 0x35, 0xA6, 0xAF, 0x7A, 0xF1, 0x05, 0xB0, 0xD9, 0x06,
+    0xC3, 0xBD, 0x24, 0xBA, 0x09, 0x74, 0x7D, 0x61, 0x13, 0x32, 0x83, 0xA7, 0x37, 0xD6, 0x5B, 0x45,
+    0x17, 0x7D, 0x9D, 0x4A, 0x6B, 0xBE, 0x6D, 0x73, 0x94, 0x53, 0xD7, 0xD7, 0x2B, 0xD7, 0xC1, 0x5A,
+    0x0E, 0xFA, 0xC9, 0x28, 0x87, 0x89, 0x26, 0xA8, 0x1E, 0x32, 0x3F, 0x1B, 0xAE, 0x66, 0x39, 0x9F,
+    0xBE, 0x76, 0x68, 0x4B, 0xB1, 0x59, 0x39, 0x51, 0xA7, 0xC5, 0x4D, 0xAB, 0x1E, 0xFF, 0x6F, 0x68,
+    0x61, 0x6B, 0x20, 0xFF, 0xC6, 0x0B, 0x82, 0xFE, 0x17, 0xC8, 0xED, 0x55, 0x4C, 0x21, 0x3B, 0xAC,
+    0x0B, 0xDD, 0xC7, 0xAD, 0x3A, 0x84, 0xF2, 0xA9, 0xAF, 0xFF, 0xAD, 0xB5, 0x77, 0x2D, 0x15, 0x35,
+    0x49, 0x98, 0x4F, 0x35, 0x95, 0xF0, 0x30, 0xF3, 0x41, 0x57, 0x58, 0x31, 0x18, 0xA2, 0x1F, 0x1F,
+    0xCE, 0x14, 0x94, 0xBB, 0xED, 0x56, 0x72, 0xA6, 0x2E, 0xFD, 0x9A, 0xBA, 0xD6, 0xD7, 0xD4, 0x85,
+    0x6D, 0xE3, 0x76, 0x2A, 0xFA, 0x0A, 0x95, 0xAC, 0x4D, 0xAC, 0x24, 0x0C, 0xA6, 0x44, 0x8C, 0xAA,
+    0x07, 0x75, 0x7D, 0x77, 0x6A, 0x38, 0x64, 0x6F, 0x50, 0x17, 0x19, 0x9A, 0x93, 0x37, 0x15, 0x2E,
+    0x52, 0x79, 0x9B, 0xDE, 0x9B, 0x1F, 0xBC, 0x03, 0x9A, 0x69, 0x38, 0x72, 0x21, 0xD8, 0xC9, 0x29,
+    0xD7, 0xD4, 0x59, 0x0F, 0x37, 0x07, 0x65, 0x37, 0x73, 0x6D, 0x84, 0x88, 0x26, 0x2D, 0x56, 0x20,
+    0x28, 0x7E, 0xDA, 0x0B, 0xFE, 0x63, 0x82, 0x0C, 0x74, 0xCB, 0x0A, 0x24, 0x72, 0xC6, 0x97, 0x8D,
+    0x2F, 0x67, 0xC2, 0x7D, 0x8E, 0xDD, 0xDC, 0x44, 0xAB, 0x62, 0x9A, 0xA8, 0xCA, 0x7D, 0x12, 0xFD,
+    0x01, 0x15, 0xF6, 0xC1, 0xCC, 0x91, 0x7B, 0x3B, 0x02, 0xAA, 0x50, 0xEF, 0xA6, 0xFC, 0x42, 0xF6,
+    0xCA, 0xA9, 0x16, 0xF0, 0x6D, 0xA0, 0xE6, 0xC4, 0xC7, 0xAD, 0xC9, 0xCF, 0xD7, 0x09, 0x68, 0x58,
+    0xED, 0xC9, 0x34, 0x0D, 0xEC, 0x9B, 0xE3, 0xE6, 0x31, 0x38, 0xB5, 0x74, 0xF9, 0x60, 0x2E, 0x19,
+    0xEF, 0x8E, 0x81, 0x74, 0xA4, 0x97, 0xB7, 0xC0, 0x2C, 0xCA, 0x9E, 0x22, 0xCC, 0x38, 0x2F, 0x9B,
+    0x38, 0xDA, 0xC4, 0xBE, 0xF7, 0x0A, 0xD3, 0x16, 0x5F, 0x43, 0x91, 0x33, 0xAC, 0xB9, 0x33, 0x51,
+    0xE1, 0x98, 0x84, 0xAF, 0xEA, 0x44, 0x3B, 0x69, 0xF0, 0x91, 0xD4, 0xEE, 0x12, 0xBC, 0xC5, 0x95,
+    0xCB, 0xF9, 0xA7, 0x81, 0xD4, 0x05, 0xA3, 0x17, 0x06, 0xDC, 0x95, 0xF3, 0x39, 0xB7, 0x78, 0xCF,
+    0x79, 0xF8, 0x58, 0x93, 0x58, 0xCE, 0x3E, 0x95, 0xFD, 0x80, 0xB0, 0x77, 0x54, 0x21, 0xD0, 0x66,
+    0xF1, 0x68, 0xB9, 0x20, 0xE8, 0xE5, 0x28, 0xBC, 0xF9, 0x72, 0xB4, 0x41, 0xF6, 0xD2, 0xAB, 0x4E,
+    0x39, 0x63, 0xF5, 0xEF, 0x60, 0x73, 0x6E, 0xC5, 0xE5, 0x51, 0x7A, 0x3B, 0x98, 0xD5, 0x12, 0xB9,
+    0xA1, 0x1B, 0x18, 0x89, 0xF3, 0x93, 0x8B, 0x40, 0xFA, 0x71, 0x2F, 0x26, 0x35, 0x35, 0x5E, 0x83,
+    0x09, 0x8B, 0x37, 0x58, 0x7E, 0xBB, 0xE7, 0x2F, 0x9D, 0x55, 0xBD, 0x6E, 0x1D, 0x45, 0x14, 0x3E,
+    0xBB, 0xEB, 0xEB, 0x8D, 0x3C, 0xC5, 0xA6, 0xE0, 0x0A, 0x24, 0x44, 0xF6, 0x05, 0x90, 0xE6, 0x0D,
+    0x98, 0xC1, 0x2E, 0x28, 0xE3, 0xE2, 0x6E, 0x1D, 0x0A, 0x3A, 0x8A, 0x3C, 0x01, 0xCC, 0x02, 0x25,
+    0x05, 0x7E, 0x04, 0x0A, 0x57, 0x4E, 0xE1, 0x3A, 0x12, 0x68, 0x37, 0x04, 0x29, 0x45, 0x9A, 0x75,
+    0x52, 0x52, 0xB0, 0x20, 0x17, 0xC8, 0x6E, 0xD6, 0xD1, 0x46, 0xCC, 0x4D, 0x66, 0xF7, 0xF0, 0x9D,
+    0xDD, 0x1B, 0x45, 0x58, 0xB2, 0xC1, 0x59, 0x79, 0xC6, 0x73, 0xE7, 0xE7, 0x9C, 0xEF, 0x3B, 0xBF,
+    0x44, 0x9F, 0x13, 0x51, 0x85, 0x61, 0x6A, 0x22, 0xD5, 0x61, 0xB1, 0x4F, 0xF3, 0xF7, 0xE5, 0x9A,
+    0x62, 0xE6, 0x2E, 0x61, 0x1E, 0x12, 0xB6, 0x66, 0x77, 0x24, 0xD5, 0x30, 0x45, 0x9D, 0x2B, 0x89,
+    0x74, 0x43, 0x94, 0xE1, 0x72, 0x12, 0x68, 0xB9, 0x62, 0x32, 0xEC, 0x9A, 0x94, 0x9F, 0x7A, 0xCA,
+    0x2E, 0xD8, 0x26, 0xC1, 0xF4, 0xC4, 0x29, 0x9F, 0x71, 0xED, 0xF0, 0x1E, 0x32, 0x0E, 0x28, 0x5A,
+    0x41, 0xE0, 0x62, 0xD6, 0x84, 0x37, 0x93, 0xA2, 0xC5, 0x46, 0xCF, 0x6A, 0x41, 0xB8, 0x97, 0x32,
+    0x7B, 0xF3, 0x4D, 0xB0, 0x43, 0xD2, 0x27, 0x5D, 0xD6, 0x66, 0x8D, 0xB1, 0xFA, 0x3C, 0x40, 0x72,
+    0x1D, 0xBD, 0x3A, 0xA4, 0x0C, 0xE0, 0x4C, 0xB1, 0x22, 0x60, 0x81, 0xBC, 0xA0, 0xCF, 0x8E, 0x2F,
+    0x06, 0xD2, 0x4F, 0xFA, 0x68, 0xCC, 0xC6, 0xAA, 0xD3, 0x0C, 0x6C, 0xA3, 0x25, 0xDA, 0xAE, 0x0E,
+    0x48, 0xB3, 0xE0, 0xE1, 0xC6, 0xF4, 0x49, 0xAF, 0x5B, 0xFA, 0x19, 0x30, 0xF3, 0xD4, 0x13, 0xC5,
+    0x03, 0x74, 0xF1, 0x44, 0x34, 0x2A, 0xEE, 0x82, 0xD6, 0xDF, 0x03, 0xB9, 0x50, 0x95, 0xC4, 0x79,
+    0x4F, 0xE6, 0x31, 0xDB, 0xAC, 0x73, 0xE3, 0x71, 0x00, 0x0E, 0x86, 0x8C, 0x35, 0xD1, 0x12, 0x02,
+    0xA3, 0x1F, 0xF1, 0x60, 0xC4, 0xD0, 0x20, 0xAD, 0x40, 0x3A, 0x6D, 0x37, 0x16, 0x8A, 0x30, 0x72,
+    0x8C, 0x1E, 0xFB, 0x02, 0x0E, 0x4B, 0xF0, 0x8A, 0xFD, 0x7C, 0xB2, 0xB0, 0xFB, 0x10, 0xD4, 0x81,
+    0xD7, 0x77, 0x3E, 0xFF, 0x55, 0xC8, 0x18, 0x88, 0x01, 0xB7, 0x78, 0xAC, 0xEA, 0x84, 0x03, 0xE5,
+    0x47, 0x56, 0xEE, 0x27, 0x2F, 0x0B, 0x9B, 0x01, 0x2C, 0x40, 0xFF, 0x32, 0x1E, 0x71, 0xDE, 0xC4,
+    0xC1, 0xD9, 0xBC, 0xE5, 0x73, 0x06, 0xCD, 0x96, 0xAA, 0xD3, 0x8D, 0x8D, 0x48, 0x89, 0xDE, 0x54,
+    0x90, 0xA4, 0xE7, 0xAD, 0xC0, 0xF8, 0x09, 0x8A, 0xDA, 0x9D, 0xCD, 0x69, 0x51, 0x44, 0xC5, 0xCA,
+    0x70, 0xC3, 0xFC, 0x3D, 0xB7, 0x9A, 0x4B, 0xF8, 0xB2, 0x02, 0x1F, 0xB8, 0x09, 0xC6, 0x56, 0xF0,
+    0x86, 0xB0, 0x9F, 0x37, 0x41, 0xAF, 0x81, 0x4B, 0x19, 0x9B, 0x47, 0x0F, 0xDE, 0x6C, 0x5E, 0xBE,
+    0xD9, 0x10, 0x97, 0x15, 0xEF, 0xF2, 0x38, 0xC9, 0x2C, 0x27, 0x1D, 0x39, 0xD8, 0x23, 0x0E, 0x88,
+    0x06, 0xE0, 0xD6, 0x49, 0x4B, 0x51, 0x79, 0x0B, 0xDB, 0x5B, 0xC0, 0x51, 0xE1, 0xC8, 0x88, 0x79,
+    0x5D, 0xB3, 0xB1, 0xB3, 0xC4, 0x47, 0x1C, 0x16, 0x96, 0xF4, 0x6F, 0x2C, 0x51, 0x14, 0x48, 0x8F,
+    0x5C, 0xC7, 0x23, 0x0E, 0x75, 0x03, 0x96, 0x43, 0x74, 0xD5, 0x42, 0xF1, 0x67, 0xFC, 0x88, 0x3D,
+    0x87, 0x65, 0x61, 0x8B, 0x22, 0xE3, 0xDE, 0xF0, 0x9F, 0xDC, 0x2B, 0x6E, 0x27, 0x90, 0xEF, 0x8F,
+    0xC5, 0xBD, 0xF5, 0x3D, 0xC0, 0xE7, 0x0E, 0x20, 0xDF, 0x20, 0x9F, 0xE9, 0x20, 0x36, 0xC8, 0x9C,
+    0x1D, 0xF1, 0x15, 0xC4, 0xE1, 0x64, 0x98, 0xA6, 0xA9, 0xF8, 0x07, 0x91, 0xD9, 0xD2, 0x6D, 0xA2,
+    0x0F, 0x01, 0x35, 0x13, 0x4A, 0x02, 0xF7, 0xFE, 0xAB, 0x12, 0x7E, 0xEF, 0xE7, 0x64, 0xD0, 0x8F,
+    0x1E, 0x92, 0x7A, 0xCD, 0xCD, 0x04, 0xBD, 0x3A, 0x61, 0xAB, 0x1B, 0xDD, 0xA8, 0x3E, 0xED, 0x27,
+    0x9C, 0x95, 0x75, 0x76, 0xC2, 0xBA, 0xD9, 0x48, 0xF8, 0x84, 0x2F, 0x04, 0xF3, 0xB6, 0xDD, 0x1D,
+    0x3F, 0x36, 0xFC, 0xFC, 0x49, 0xD8, 0x92, 0xE8, 0x5E, 0x16, 0x7B, 0x3C, 0x4C, 0xEE, 0x00, 0x9A,
+    0xAB, 0x27, 0x78, 0xFF, 0x39, 0x0F, 0x3B, 0x51, 0x76, 0x71, 0xCE, 0xEB, 0x67, 0x41, 0x4C, 0x2A,
+    0x99, 0xD2, 0x3A, 0x1F, 0x8F, 0xE4, 0xCA, 0xBC, 0x4D, 0x7D, 0xF4, 0x76, 0x11, 0x73, 0xCF, 0xC3,
+    0x42, 0x24, 0x23, 0x37, 0xE4, 0xE2, 0xE4, 0xFA, 0x67, 0xEC, 0xAF, 0xD5, 0x51, 0x27, 0x48, 0x1C,
+    0xBC, 0x68, 0x1C, 0x1F, 0xF3, 0x1F, 0xC5, 0x94, 0xE3, 0x6A, 0x4C, 0xB9, 0xD4, 0xFF, 0x96, 0x3E,
+    0x2D, 0x34, 0xDF, 0xE5, 0xE6, 0x16, 0xED, 0xB5, 0x1F, 0x41, 0x05, 0xF7, 0xD1, 0xE1, 0x4D, 0xB9,
+    0x10, 0xDD, 0xA1, 0x07, 0x2F, 0x7B, 0xF6, 0xDB, 0xA7, 0xFF, 0xCD, 0xE5, 0x46, 0x92, 0xE3, 0x16,
+    0x69, 0x83, 0x6A, 0xC0, 0x07, 0x6A, 0x90, 0x0A, 0x62, 0xC9, 0x59, 0x05, 0x17, 0x95, 0xD1, 0xC1,
+    0xA4, 0x29, 0xE6, 0xD2, 0x79, 0xFC, 0x44, 0xC6, 0xBB, 0xCB, 0x93, 0xE6, 0x3D, 0xF8, 0xF7, 0x13,
+    0xCA, 0xCA, 0xA8, 0xA7, 0xFC, 0x2F, 0xAA, 0x6A, 0x64, 0xF2, 0x17, 0xA4, 0x61, 0x1B, 0x4C, 0x53,
+    0x56, 0xDF, 0x90, 0xE5, 0xF5, 0x16, 0x5C, 0x16, 0x9F, 0x16, 0x05, 0xA2, 0x81, 0x59, 0xF3, 0xB7,
+    0xBC, 0xC6, 0x43, 0xDD, 0xBE, 0xDB, 0xD4, 0x08, 0x42, 0x28, 0x45, 0x10, 0xC2, 0x85, 0xBA, 0xDE,
+    0x94, 0x6B, 0xF0, 0x94, 0x9C, 0x94, 0xE4, 0x44, 0x4E, 0x52, 0xD6, 0x6E, 0xCA, 0x81, 0xA5, 0xDB,
+    0x08, 0xCC, 0xA0, 0x42, 0x32, 0x28, 0x84, 0x05, 0x4C, 0x73, 0xB8, 0x39, 0xD9, 0xD2, 0x3E, 0x0F,
+    0xCE, 0x9B, 0xA0, 0x7C, 0x1A, 0x52, 0x9C, 0x5D, 0x37, 0x60, 0xAF, 0x60, 0x30, 0xE6, 0x92, 0x9D,
+    0xF8, 0xB9, 0xE4, 0x3B, 0x64, 0xBE, 0x94, 0x84, 0x87, 0x73, 0x55, 0xA8, 0xC9, 0x74, 0x28, 0x09,
+    0x49, 0xF7, 0x75, 0x5C, 0x7E, 0x30, 0x47, 0x63, 0x2A, 0x0D, 0xC3, 0x0B, 0xC2, 0xFF, 0xFB, 0x57,
+    0x0A, 0x13, 0x96, 0xFA, 0x66, 0xFC, 0x54, 0x68, 0xE6, 0x0F, 0x9E, 0x0E, 0xF4, 0x95, 0x4F, 0x4E,
+    0xBA, 0x3B, 0xF1, 0x14, 0xEA, 0x36, 0x45, 0x6D, 0x47, 0xF1, 0xEC, 0xC4, 0x5F, 0x15, 0x2A, 0x8C,
+    0x34, 0x92, 0xCB, 0x4B, 0x80, 0x85, 0x25, 0xD8, 0xE6, 0x3E, 0x42, 0xC9, 0x39, 0x15, 0xA7, 0xDA,
+    0x62, 0x9F, 0x39, 0x43, 0x92, 0xF4, 0xD9, 0x00, 0x3D, 0xAE, 0x14, 0x82, 0x60, 0x83, 0x56, 0x66,
+    0x1E, 0x23, 0xE5, 0xD9, 0x59, 0x12, 0xC8, 0xA8, 0x06, 0xF8, 0x65, 0x7E, 0x07, 0x4D, 0xD6, 0x1D,
+    0x24, 0x81, 0x5B, 0xD6, 0x61, 0x32, 0xB5, 0xEB, 0x20, 0xD2, 0xF5, 0x1A, 0x4D, 0xCD, 0xA3, 0x43,
+    0x48, 0xA5, 0xA3, 0xF7, 0x88, 0x76, 0xAC, 0x94, 0x3D, 0xC1, 0x26, 0x65, 0x2F, 0x91, 0xFE, 0xA9,
+    0x69, 0xD3, 0x22, 0x50, 0x61, 0xEE, 0x8B, 0x24, 0x0C, 0x20, 0x9E, 0x7A, 0xDE, 0xDB, 0xC1, 0x5E,
+    0x75, 0xAE, 0x57, 0x9D, 0x29, 0x55, 0x87, 0xEE, 0xF5, 0xC2, 0x93, 0xC2, 0x45, 0xF5, 0x1A, 0xFF,
+    0x5F, 0x0C, 0x72, 0x8E, 0xE1, 0x6A, 0xD5, 0xE9, 0x4E, 0x0F, 0x59, 0x70, 0x63, 0x32, 0x4C, 0x52,
+    0x25, 0xCC, 0x93, 0x7E, 0x6E, 0x34, 0x31, 0x04, 0xA5, 0xCD, 0xDC, 0x70, 0xDE, 0xF5, 0xFB, 0x07,
+    0xBD, 0x55, 0xBD, 0x72, 0xDE, 0x44, 0x14, 0xBD, 0xD2, 0xC6, 0xDE, 0x99, 0xA8, 0x58, 0x53, 0xB8,
+    0xA2, 0x10, 0x05, 0x05, 0x15, 0x6A, 0x29, 0x32, 0x5E, 0x0D, 0x66, 0x86, 0x82, 0x82, 0xAF, 0xF0,
+    0x57, 0xF1, 0x10, 0x7E, 0x82, 0xB0, 0x62, 0x28, 0x28, 0x78, 0x8D, 0x14, 0x99, 0x54, 0x79, 0x01,
+    0xB2, 0x9A, 0x50, 0xB8, 0x70, 0xB3, 0x90, 0x96, 0x19, 0x0B, 0x5A, 0x9A, 0xC5, 0xA3, 0x4C, 0x04,
+    0xAC, 0xF6, 0x72, 0xAE, 0x84, 0x6D, 0xEC, 0x24, 0x86, 0x01, 0x26, 0xFB, 0xCD, 0x4A, 0xFB, 0xDD,
+    0xFD, 0xB9, 0xE7, 0x9E, 0x7B, 0xF6, 0x8A, 0x88, 0xA8, 0xCA, 0x0D, 0x6B, 0xFE, 0x8A, 0xBB, 0x66,
+    0xF0, 0xA4, 0x27, 0x47, 0x45, 0x76, 0x44, 0x8E, 0x5B, 0xAA, 0x39, 0x92, 0x7E, 0x9E, 0xA9, 0x98,
+    0x6D, 0x20, 0x77, 0x98, 0xA8, 0x0E, 0xBE, 0x6F, 0xB2, 0x99, 0x0D, 0xF7, 0xBE, 0x23, 0x2A, 0x68,
+    0x69, 0xBA, 0x25, 0x6A, 0x7A, 0x22, 0xEE, 0x49, 0x65, 0xA2, 0xB2, 0x5D, 0xCD, 0xFB, 0xDB, 0x96,
+    0x2C, 0x07, 0x6A, 0xB8, 0x23, 0x95, 0xE8, 0x9F, 0xF4, 0x7B, 0xE8, 0xF7, 0xD1, 0xBF, 0x51, 0xF9,
+    0x51, 0x6A, 0x98, 0x93, 0x65, 0x9E, 0xE8, 0x0E, 0xD5, 0xC0, 0xE6, 0xE2, 0xFB, 0x72, 0x70, 0x51,
+    0xF8, 0xC0, 0xA3, 0x9E, 0xC9, 0xB7, 0x4D, 0xA8, 0xC6, 0xF2, 0x75, 0x03, 0xC7, 0x0D, 0xF7, 0xFF,
+    0x1B, 0x04, 0x69, 0xBB, 0x88, 0xD8, 0x0C, 0xE0, 0x4B, 0x7A, 0x20, 0x80, 0x22, 0xDA, 0x81, 0x7D,
+    0xEF, 0x6D, 0xF0, 0xD1, 0xBA, 0xDB, 0xC0, 0xC8, 0x40, 0xF3, 0x39, 0xC3, 0x05, 0x3D, 0x20, 0x47,
+    0x26, 0xA8, 0x58, 0x8C, 0xB4, 0x59, 0x89, 0xA2, 0x72, 0xD8, 0xDF, 0x1E, 0x46, 0xCB, 0xCF, 0x86,
+    0x86, 0xBF, 0xEC, 0x55, 0x52, 0x9D, 0x4A, 0xC5, 0xBF, 0x03, 0xBA, 0xF7, 0x96, 0xFF, 0x9E, 0xF9,
+    0x93, 0x93, 0xF9, 0xA0, 0x1A, 0x63, 0xF3, 0xAC, 0xF7, 0x1F, 0x01, 0x42, 0x35, 0x52, 0x13, 0x00,
+    0xE4, 0x15, 0x43, 0xCD, 0xF1, 0x56, 0x9E, 0x8A, 0x11, 0x70, 0xFE, 0xFC, 0x95, 0xE3, 0xDF, 0xBB,
+    0xA7, 0x5D, 0xE8, 0x86, 0x47, 0x2A, 0xF0, 0x82, 0x03, 0x78, 0xBA, 0xF6, 0xFA, 0x70, 0xAA, 0x46,
+    0xDB, 0xFB, 0xC3, 0x54, 0x8D, 0x77, 0x6F, 0xCE, 0xB5, 0xD0, 0x1C, 0x55, 0x90, 0xDC, 0xCE, 0x76,
+    0x43, 0x8A, 0x67, 0x98, 0xF2, 0xEA, 0x8E, 0x18, 0xDD, 0x42, 0x61, 0x26, 0x3E, 0xC6, 0x0C, 0x2C,
+    0x2C, 0x1B, 0x02, 0x95, 0x58, 0x4D, 0x2F, 0xD6, 0x15, 0x06, 0x2B, 0x74, 0x30, 0x11, 0x28, 0x81,
+    0xA8, 0x62, 0x66, 0x85, 0xDE, 0xD1, 0x1D, 0x08, 0xC6, 0xCE, 0xE4, 0x02, 0x42, 0x6E, 0x96, 0xC7,
+    0x0F, 0x25, 0x87, 0x66, 0x49, 0x0D, 0x26, 0x8A, 0xE3, 0xAB, 0x89, 0x50, 0xF3, 0xD3, 0x25, 0x47,
+    0x4B, 0x7B, 0x2C, 0x8F, 0x2C, 0x92, 0x43, 0x2C, 0xEB, 0x83, 0xDE, 0xBD, 0x98, 0x04, 0xC4, 0xED,
+    0x91, 0xC3, 0x11, 0x5C, 0x71, 0x5F, 0x73, 0x6B, 0x27, 0x49, 0x2B, 0xB7, 0x75, 0xAF, 0x38, 0xEA,
+    0x48, 0x9C, 0x8B, 0x44, 0xD6, 0x05, 0x18, 0x4F, 0x13, 0x8C, 0x91, 0x4F, 0x22, 0x25, 0xF3, 0x2B,
+    0x8C, 0x25, 0xC3, 0xD8, 0x5B, 0x86, 0x11, 0x6B, 0x29, 0x91, 0x4B, 0xCB, 0x5E, 0x82, 0x6B, 0xEE,
+    0xC1, 0x41, 0x1D, 0xC5, 0xA9, 0xB8, 0x7B, 0x0F, 0xDD, 0x74, 0xAB, 0xDC, 0x70, 0x28, 0x95, 0x32,
+    0xF3, 0xCE, 0x8A, 0xA0, 0x68, 0x8F, 0xA8, 0x39, 0x67, 0x60, 0xE6, 0x54, 0xF8, 0xDF, 0xB8, 0xAB,
+    0x87, 0x7A, 0xD0, 0x93, 0x9A, 0x8A, 0x0C, 0xD4, 0xAE, 0xB3, 0x30, 0x98, 0xEB, 0x06, 0x3F, 0xD9,
+    0xD9, 0x32, 0xD0, 0xEE, 0x1F, 0xE1, 0x76, 0xE2, 0xDD, 0x20, 0xDE, 0xA8, 0x39, 0x98, 0x4C, 0x02,
+    0x3C, 0x08, 0xF0, 0x24, 0xC0, 0xB9, 0x03, 0xA2, 0xB3, 0x11, 0xC6, 0x73, 0x86, 0x31, 0xD9, 0x5F,
+    0x60, 0x54, 0x59, 0x80, 0xFB, 0x33, 0x00, 0x37, 0x0B, 0x70, 0x00, 0xB6, 0x28, 0x12, 0xCB, 0x5E,
+    0x04, 0x44, 0x36, 0xD6, 0xDC, 0xEB, 0x85, 0xC0, 0xCD, 0xA2, 0x74, 0x34, 0x27, 0x71, 0x18, 0xE0,
+    0x27, 0x25, 0xE0, 0xCB, 0xF1, 0x62, 0x96, 0x36, 0xFB, 0x54, 0x25, 0x3F, 0x6A, 0x64, 0x89, 0x8E,
+    0xB3, 0x07, 0x54, 0x7D, 0x0B, 0x76, 0x31, 0xA0, 0xF4, 0xF0, 0xA7, 0x7C, 0xC2, 0xE1, 0xF2, 0x3E,
+    0x2A, 0x39, 0xEE, 0x73, 0xF4, 0xBA, 0x5D, 0x99, 0x2A, 0xDA, 0x8B, 0x0C, 0xE9, 0xF6, 0x9E, 0xB8,
+    0x3B, 0x10, 0xE9, 0x3C, 0x11, 0xF7, 0x22, 0x22, 0x6A, 0xDE, 0x68, 0x02, 0xF7, 0x50, 0x21, 0x6B,
+    0x35, 0x90, 0xFA, 0x09, 0x16, 0x87, 0x2E, 0x42, 0xA7, 0x87, 0xFF, 0x3D, 0x81, 0x66, 0x09, 0xD3,
+    0x2F, 0xE7, 0x2C, 0x7C, 0x2F, 0xE4, 0x02, 0xD5, 0x4E, 0xB1, 0xA1, 0xFB, 0xA0, 0x35, 0xAA, 0xC1,
+    0x33, 0xC7, 0xBB, 0xC2, 0x2C, 0xE8, 0xF2, 0x1D, 0xAE, 0x57, 0x39, 0xE3, 0x20, 0x40, 0xD0, 0xA8,
+    0x67, 0xD0, 0xFA, 0x20, 0x77, 0xCE, 0x75, 0x2F, 0x9B, 0x4B, 0xFE, 0x11, 0x61, 0x19, 0xFE, 0x1A,
+    0x85, 0x61, 0x15, 0x0A, 0xDD, 0x10, 0x4A, 0x7F, 0x43, 0x28, 0xF1, 0x4A, 0x28, 0xDF, 0x89, 0x50,
+    0xD2, 0x95, 0x50, 0x7E, 0xBF, 0x2E, 0x94, 0x72, 0x15, 0xCA, 0x20, 0x42, 0x59, 0xCA, 0x2A, 0xAE,
+    0x39, 0x7D, 0x60, 0x25, 0x33, 0x2C, 0x42, 0xC7, 0x37, 0x44, 0xD0, 0x2E, 0xEA, 0xF0, 0xA7, 0xFC,
+    0x31, 0xC4, 0xB1, 0xCB, 0x3F, 0x67, 0xD1, 0x86, 0xB0, 0x01, 0x12, 0xBE, 0x00, 0x19, 0x42, 0xCA,
+    0x5F, 0xFE, 0x36, 0x59, 0x4D, 0x9C, 0xA4, 0x36, 0x43, 0x6D, 0x25, 0xF8, 0x40, 0x02, 0x4A, 0xA4,
+    0xDB, 0x82, 0xED, 0x03, 0xF9, 0x10, 0xD1, 0x5A, 0x35, 0x9C, 0xB8, 0xB8, 0x6C, 0xC7, 0xD0, 0xA7,
+    0x47, 0x21, 0x41, 0xE1, 0x0A, 0x66, 0xD2, 0x8C, 0x0A, 0x60, 0x26, 0x54, 0x19, 0x7F, 0x32, 0x91,
+    0x9A, 0xC1, 0x97, 0x3D, 0x1B, 0x31, 0xE0, 0xCB, 0x41, 0x47, 0xF6, 0x34, 0xA1, 0x20, 0x39, 0xAC,
+    0x39, 0x94, 0x2C, 0xD7, 0xF9, 0x33, 0x64, 0x1E, 0xF2, 0xC5, 0x39, 0x38, 0x79, 0x2B, 0x55, 0x22,
+    0x23, 0x86, 0x09, 0x25, 0x6C, 0xD5, 0xE1, 0xCE, 0x06, 0x40, 0x26, 0xB8, 0x48, 0x6A, 0xAE, 0xC7,
+    0x3A, 0xD4, 0x11, 0xC1, 0x7F, 0x0B, 0x42, 0x4C, 0x54, 0xC9, 0xF6, 0x66, 0xF9, 0x9B, 0x8B, 0xAC,
+    0x73, 0x1D, 0x51, 0xB2, 0xB0, 0x17, 0x41, 0x1C, 0xD1, 0x1B, 0x6B, 0x7F, 0x00, 0xB5, 0x55, 0x3D,
+    0x8F, 0xDD, 0x54, 0x10, 0x3D, 0xD7, 0xDE, 0x87, 0xB3, 0xB8, 0xF0, 0x16, 0x59, 0xF1, 0xB1, 0x85,
+    0x1B, 0x8A, 0x14, 0x80, 0xF9, 0x01, 0xBB, 0xB9, 0x37, 0x6C, 0xB1, 0xED, 0x2B, 0xB2, 0x42, 0x82,
+    0x02, 0x0A, 0x2A, 0x8A, 0x3C, 0x4A, 0x0A, 0x82, 0x4D, 0x52, 0xA4, 0x64, 0x7F, 0x42, 0x8A, 0x34,
+    0xAC, 0xF8, 0x01, 0x29, 0x56, 0xF1, 0x0D, 0xAF, 0x48, 0x91, 0x02, 0x53, 0x51, 0xA4, 0x88, 0x13,
+    0x89, 0x8A, 0x22, 0x5E, 0xB0, 0x14, 0x13, 0x6C, 0x0F, 0x67, 0xFC, 0x96, 0xA0, 0x68, 0xA5, 0xA0,
+    0x15, 0x60, 0xF9, 0x5D, 0x5D, 0xDB, 0x73, 0x67, 0xCE, 0x9C, 0x39, 0x33, 0x0F, 0x1B, 0x70, 0x88,
+    0xFC, 0x36, 0x90, 0x4B, 0x81, 0x40, 0x6A, 0xC0, 0xDC, 0xC2, 0xEA, 0x7A, 0xE5, 0x99, 0x43, 0x2C,
+    0xE2, 0x42, 0x91, 0x01, 0x52, 0xE4, 0x4D, 0x56, 0x41, 0xAE, 0xF7, 0x88, 0xFB, 0xBC, 0x80, 0x7D,
+    0xD0, 0x22, 0x1C, 0xC4, 0xC1, 0x3E, 0x7C, 0xBE, 0xE9, 0x10, 0xF6, 0xA5, 0x87, 0xBD, 0x47, 0x9B,
+    0xD6, 0x36, 0x46, 0x8C, 0xFC, 0x5C, 0xFA, 0x48, 0xA4, 0xA1, 0x9F, 0x0E, 0x98, 0xCD, 0x57, 0x8E,
+    0xA3, 0xE2, 0x02, 0xB2, 0x9F, 0x2A, 0xD8, 0x11, 0xD8, 0x3A, 0x58, 0xBD, 0xDB, 0x07, 0x32, 0x29,
+    0x18, 0xCA, 0xDB, 0x1F, 0xE5, 0xD2, 0x60, 0x24, 0x69, 0xC2, 0xDE, 0xFA, 0xA4, 0x11, 0xD8, 0x65,
+    0x8F, 0xD5, 0x63, 0x9D, 0xD6, 0xF9, 0x23, 0x41, 0x49, 0x87, 0x25, 0xCF, 0xCE, 0x1C, 0x0F, 0xCE,
+    0xCF, 0x01, 0x69, 0x58, 0x23, 0x6A, 0x4A, 0x60, 0xCC, 0x18, 0x3E, 0xAA, 0x11, 0xB8, 0xF7, 0x4E,
+    0x92, 0x58, 0x30, 0x9B, 0x52, 0x5A, 0x58, 0x91, 0x2A, 0xE9, 0x22, 0x09, 0x06, 0x24, 0x9D, 0xF5,
+    0x28, 0xEF, 0x11, 0xED, 0x50, 0xBE, 0x80, 0x7F, 0xDA, 0x30, 0xB5, 0xFB, 0x3D, 0x13, 0xC9, 0x69,
+    0xB3, 0x2B, 0x48, 0x9B, 0x74, 0xFC, 0xA8, 0x27, 0x3B, 0xA2, 0x7E, 0x8A, 0x09, 0x28, 0xD6, 0x5F,
+    0x05, 0x76, 0x2E, 0x22, 0x38, 0x6E, 0x91, 0x7C, 0xE3, 0xF1, 0x25, 0xE9, 0xF3, 0xD5, 0x14, 0xCE,
+    0x5C, 0x86, 0x42, 0x4B, 0x68, 0x2E, 0x7B, 0x43, 0xD4, 0x46, 0xA7, 0x72, 0xD0, 0xC7, 0x22, 0xFF,
+    0x5A, 0x6E, 0xF4, 0x01, 0x93, 0x0D, 0x94, 0x97, 0xCD, 0x89, 0x80, 0xFD, 0xFD, 0x39, 0x29, 0x10,
+    0xE9, 0xF8, 0x9E, 0x6B, 0x3C, 0x04, 0xC3, 0xAC, 0xCB, 0x6A, 0x02, 0x6E, 0xAD, 0xE7, 0xFA, 0x49,
+    0x5E, 0x70, 0x45, 0xE9, 0x74, 0x15, 0xE8, 0xE9, 0xE7, 0xEB, 0x78, 0xE8, 0x64, 0x7A, 0x5F, 0xAA,
+    0xCD, 0x46, 0xAE, 0xF6, 0xDB, 0xB6, 0xE1, 0x7A, 0x94, 0x8C, 0x1F, 0x8C, 0x87, 0x7D, 0xA8, 0x3E,
+    0x7B, 0x2C, 0xD4, 0x33, 0x70, 0x5E, 0x03, 0xCE, 0x9C, 0x99, 0xB3, 0x2E, 0xDF, 0x4B, 0x33, 0x7D,
+    0xF4, 0xB2, 0x27, 0xD7, 0x86, 0xB4, 0x4A, 0x9B, 0xE4, 0x37, 0x62, 0x85, 0x10, 0xA9, 0x88, 0x6E,
+    0x65, 0x54, 0xD0, 0xA4, 0x84, 0x6F, 0xC1, 0x1A, 0xB4, 0x30, 0x72, 0x43, 0x7E, 0xBF, 0x12, 0xCB,
+    0x48, 0x52, 0x33, 0x79, 0x9F, 0x2E, 0x67, 0x30, 0x27, 0xC5, 0x05, 0x3E, 0xE7, 0x2F, 0x51, 0x21,
+    0x91, 0x54, 0xD0, 0x1A, 0x78, 0xEB, 0xE4, 0x8B, 0xF9, 0xF0, 0xD0, 0x4D, 0x95, 0x20, 0x95, 0x5C,
+    0xAC, 0xA7, 0x5A, 0x18, 0x89, 0xAE, 0xE9, 0x3C, 0x69, 0x18, 0xC4, 0x7A, 0x6A, 0x4B, 0xB6, 0x58,
+    0x00, 0x21, 0xD9, 0x89, 0x82, 0xB5, 0x3F, 0x34, 0x50, 0xEE, 0x68, 0x95, 0x35, 0xB4, 0xB2, 0x6A,
+    0x65, 0x9B, 0x58, 0x1A, 0xDB, 0x59, 0xCA, 0x85, 0x91, 0x94, 0x41, 0x53, 0x80, 0x2A, 0x88, 0x6B,
+    0x24, 0x1E, 0x19, 0x70, 0x6E, 0x0A, 0x38, 0x3F, 0x9F, 0x1D, 0x0F, 0xE5, 0xD3, 0x61, 0x4B, 0xFA,
+    0x68, 0x58, 0x8B, 0x3A, 0x9C, 0xBE, 0xA9, 0xBA, 0x5C, 0xFC, 0xEC, 0xB3, 0x6F, 0x19, 0x84, 0x62,
+    0x57, 0xF2, 0x1D, 0x24, 0x78, 0x11, 0x14, 0x05, 0x23, 0x66, 0xE4, 0xAB, 0x05, 0x11, 0x08, 0xA5,
+    0x67, 0xB5, 0x53, 0x48, 0x11, 0xB4, 0xA2, 0xB4, 0x52, 0xD9, 0x7B, 0x99, 0xB2, 0xF1, 0x19, 0xB9,
+    0xAC, 0x55, 0x00, 0x54, 0x0B, 0xA8, 0x87, 0x37, 0x15, 0x09, 0xCF, 0x20, 0x60, 0x36, 0x88, 0x55,
+    0x28, 0x5F, 0x4D, 0xE0, 0xCE, 0x02, 0x50, 0xD9, 0xBB, 0x89, 0xB0, 0x55, 0x27, 0x41, 0xAB, 0xA9,
+    0x9A, 0x13, 0x52, 0x23, 0x47, 0xF9, 0x65, 0xBB, 0xC4, 0x63, 0xEF, 0xF0, 0x91, 0xF4, 0x40, 0x09,
+    0xF8, 0xBF, 0x09, 0x37, 0xD8, 0x88, 0x7C, 0x17, 0x3E, 0x66, 0x9B, 0xB3, 0x53, 0xDC, 0x2A, 0xCB,
+    0x33, 0xE5, 0x03, 0xBC, 0xCD, 0xB1, 0xE3, 0x40, 0x4C, 0x65, 0x81, 0x37, 0x56, 0x80, 0xEF, 0x1C,
+    0x70, 0x5E, 0xF0, 0x5E, 0xF6, 0xE1, 0xF1, 0x00, 0x4E, 0x9A, 0x77, 0xA8, 0xA0, 0x90, 0xD8, 0x73,
+    0x71, 0x11, 0x15, 0x9C, 0x69, 0xB4, 0xE6, 0x66, 0x38, 0x1C, 0x21, 0x5F, 0xB8, 0xEC, 0x7E, 0x97,
+    0x3E, 0xE6, 0x7C, 0xC9, 0x59, 0x8E, 0x7D, 0xAA, 0x6D, 0x1D, 0xB8, 0x8A, 0xB0, 0x41, 0x56, 0xA0,
+    0x53, 0x45, 0x28, 0x52, 0x1E, 0xAB, 0xCB, 0x72, 0xD9, 0xA4, 0x1F, 0xFB, 0xED, 0xBC, 0x86, 0xCE,
+    0xB2, 0x11, 0xE5, 0xB0, 0x91, 0x3E, 0xAB, 0x93, 0x27, 0x95, 0x5D, 0x48, 0xC7, 0xD1, 0x67, 0xDC,
+    0x14, 0x3E, 0xA9, 0x10, 0x0F, 0x88, 0x1F, 0x56, 0x71, 0x75, 0x64, 0xAA, 0xF5, 0xFF, 0x00, 0x11,
+    0xB4, 0x66, 0x59, 0x63, 0x9E, 0x36, 0xC9, 0xF5, 0xEA, 0x8B, 0xC8, 0x9D, 0x09, 0xD1, 0xE2, 0x96,
+    0x11, 0xB9, 0x4B, 0x6F, 0xC2, 0xB8, 0xCE, 0xA6, 0x75, 0xBC, 0xA7, 0xBD, 0xDF, 0x22, 0x95, 0x8A,
+    0x5F, 0xD8, 0xBD, 0x4C, 0xB5, 0xBF, 0x00, 0x59, 0x20, 0x7D, 0x50, 0xC5, 0xBF, 0x8E, 0x51, 0x57,
+    0x4A, 0x9F, 0xB2, 0x88, 0x9B, 0x14, 0xD7, 0x6D, 0x1D, 0x07, 0xCA, 0x86, 0x72, 0xC1, 0xBA, 0x7E,
+    0x3A, 0x8D, 0xD9, 0x54, 0xAE, 0x8D, 0x92, 0xF8, 0xAB, 0x39, 0x8E, 0x75, 0xDE, 0xB6, 0xA1, 0x0E,
+    0x9C, 0xD6, 0xE5, 0xBF, 0x14, 0xB6, 0x74, 0x43, 0x29, 0x8F, 0x88, 0x65, 0x06, 0x5C, 0xE1, 0x50,
+    0xD1, 0x83, 0x61, 0x45, 0xB1, 0x9A, 0x69, 0x48, 0x07, 0x3E, 0x45, 0x9F, 0xBA, 0xF4, 0x89, 0x33,
+    0x2A, 0x95, 0xE2, 0xDF, 0xB3, 0xB3, 0x66, 0xDC, 0xED, 0xF4, 0x52, 0x4B, 0x00, 0x9E, 0x7A, 0x0C,
+    0x0E, 0xCE, 0x54, 0xAF, 0x4D, 0x4E, 0xCC, 0x5D, 0x9D, 0x6A, 0xD4, 0xB7, 0x2C, 0xDB, 0xFC, 0x6E,
+    0x7F, 0x31, 0xEC, 0x93, 0x65, 0x65, 0x7D, 0xB7, 0x16, 0xF6, 0x4C, 0x81, 0x8D, 0xA9, 0x43, 0xEB,
+    0xA5, 0x9B, 0xBC, 0xD2, 0x7F, 0x3E, 0x56, 0x9D, 0x61, 0x56, 0xD7, 0xBB, 0xEE, 0xE4, 0xD3, 0xD4,
+    0xA8, 0x93, 0xB1, 0xE6, 0xAE, 0x85, 0x3B, 0xAF, 0xCF, 0xC1, 0x74, 0xA7, 0x1A, 0xB6, 0x7B, 0x6D,
+    0x98, 0x87, 0xFA, 0x5F, 0x71, 0xEA, 0x96, 0xEF, 0x02, 0xE6, 0xCE, 0x42, 0x11, 0x46, 0xCA, 0x0E,
+    0xAC, 0xB4, 0x61, 0x23, 0x0E, 0x26, 0x87, 0xD7, 0xFF, 0xEA, 0xDA, 0x1D, 0x6A, 0x95, 0xB3, 0x2A,
+    0xFC, 0x83, 0x05, 0x4A, 0xFA, 0xBF, 0x9B, 0xD6, 0x30, 0xAF, 0xCB, 0x53, 0x4E, 0x53, 0x72, 0x7B,
+    0x7D, 0xBA, 0xAC, 0xAD, 0xEF, 0x77, 0x98, 0x5C, 0xE1, 0xAC, 0x9F, 0xFF, 0x63, 0x4E, 0xBA, 0x89,
+    0x98, 0x4E, 0xA4, 0x39, 0x95, 0x52, 0xE1, 0x25, 0xD7, 0x9F, 0xBD, 0x55, 0x3D, 0x6F, 0xD4, 0x40,
+    0x10, 0x1D, 0x7B, 0x73, 0xB1, 0x84, 0x0B, 0x53, 0xE4, 0x04, 0x11, 0x42, 0xFE, 0x07, 0xF8, 0x0F,
+    0x24, 0xB1, 0xA5, 0x94, 0x34, 0x57, 0xC4, 0x35, 0xB4, 0x34, 0xD4, 0x14, 0x21, 0x36, 0xA1, 0xA0,
+    0x4C, 0x2A, 0xFE, 0x04, 0x48, 0xA4, 0xA0, 0xA0, 0x48, 0xF0, 0x86, 0x2B, 0x52, 0x50, 0x60, 0x89,
+    0x1F, 0x10, 0x4B, 0x91, 0x00, 0x91, 0x02, 0x23, 0xB9, 0xB0, 0xA2, 0xB5, 0x87, 0x37, 0xBE, 0xCB,
+    0x7D, 0xA0, 0x80, 0x90, 0x42, 0xB2, 0x7B, 0x5E, 0xED, 0x8D, 0xAD, 0x99, 0xF7, 0xE6, 0xCD, 0xCE,
+    0x12, 0x3D, 0x21, 0xDA, 0x24, 0xDA, 0xA7, 0xA5, 0x77, 0x64, 0xF6, 0x6C, 0xF3, 0xD0, 0x36, 0xE4,
+    0xB3, 0x09, 0xB9, 0xBE, 0xD5, 0x0C, 0x94, 0xA1, 0x0B, 0x7E, 0xFC, 0xDA, 0x66, 0x43, 0x5C, 0x51,
+    0x8F, 0xFA, 0x71, 0x1C, 0xAF, 0x33, 0xCB, 0xF7, 0xCC, 0xC3, 0x2A, 0x39, 0x34, 0x6B, 0xCA, 0x78,
+    0xC3, 0x3C, 0xD4, 0xF5, 0x82, 0x32, 0x3D, 0xA2, 0x50, 0x13, 0xBD, 0x6A, 0x77, 0xC9, 0xE3, 0x96,
+    0xE8, 0x56, 0x13, 0x8D, 0x2C, 0xF0, 0x32, 0xB3, 0x49, 0x72, 0x3C, 0x9C, 0x93, 0xCB, 0x0D, 0xD1,
+    0x12, 0x91, 0x21, 0xBB, 0xFB, 0xFD, 0x06, 0x03, 0x9B, 0x90, 0x4B, 0x67, 0x82, 0x6A, 0x06, 0x06,
+    0x59, 0xBB, 0xF0, 0xEC, 0xD6, 0x25, 0x21, 0x90, 0x2C, 0x7E, 0x01, 0xBF, 0x16, 0x6C, 0x32, 0xFA,
+    0x71, 0x14, 0x6F, 0x64, 0x7C, 0xC8, 0x6D, 0xC2, 0x51, 0x56, 0x3B, 0x35, 0x79, 0xF9, 0x3F, 0x2F,
+    0x80, 0x91, 0x23, 0x5A, 0xA0, 0x55, 0x03, 0xC4, 0x36, 0xBF, 0xE4, 0x88, 0x58, 0xC8, 0x04, 0x88,
+    0x4C, 0x14, 0xE3, 0x59, 0x06, 0x80, 0xE0, 0x44, 0x77, 0xA1, 0xD5, 0xB0, 0x86, 0xE5, 0x26, 0x4D,
+    0x46, 0xA6, 0x31, 0xCB, 0xAC, 0x74, 0x0C, 0x5C, 0x31, 0x66, 0xA8, 0x43, 0xED, 0x95, 0x5E, 0xA9,
+    0x8C, 0x9A, 0x31, 0x54, 0x5E, 0x69, 0xF3, 0x1B, 0x43, 0xC8, 0x63, 0xE5, 0xF0, 0x8E, 0xA1, 0xBE,
+    0xA0, 0xEF, 0xC5, 0x83, 0x73, 0x46, 0xB2, 0x4C, 0xC6, 0x55, 0x33, 0x62, 0x86, 0x3C, 0xAC, 0x47,
+    0xF1, 0xC7, 0xC3, 0x35, 0x98, 0xEC, 0x32, 0x25, 0x3A, 0xB9, 0x80, 0xC0, 0xC4, 0x10, 0x31, 0x05,
+    0x67, 0xAC, 0x15, 0x0A, 0x22, 0x4A, 0x6A, 0xD6, 0xD6, 0x00, 0x92, 0x5A, 0x92, 0x12, 0x2F, 0xDA,
+    0x1B, 0x13, 0x71, 0xE0, 0x9B, 0xE8, 0xD1, 0x35, 0xB1, 0x91, 0xB1, 0x42, 0xD0, 0xE7, 0x4B, 0x49,
+    0x96, 0x58, 0xEF, 0x14, 0xFF, 0x49, 0x1F, 0x5A, 0x96, 0x32, 0xE3, 0x14, 0x85, 0x3C, 0x94, 0x6A,
+    0xFE, 0x80, 0x4A, 0x56, 0x9F, 0xB5, 0xD8, 0xE4, 0xED, 0xD2, 0xD5, 0x73, 0x5B, 0x04, 0x15, 0x68,
+    0x82, 0xF8, 0x08, 0x5D, 0xBE, 0x25, 0x5A, 0x5D, 0x41, 0x7A, 0x9B, 0x51, 0x70, 0x19, 0x41, 0x89,
+    0x69, 0x02, 0x63, 0xB1, 0xF5, 0x27, 0x6E, 0x62, 0x68, 0x60, 0xC8, 0x4E, 0x19, 0xF2, 0x70, 0x63,
+    0xF1, 0x09, 0x53, 0x2F, 0x12, 0xE9, 0x17, 0x6C, 0x2C, 0xAB, 0x2E, 0x18, 0xB5, 0xBE, 0x26, 0x55,
+    0x27, 0x11, 0xB9, 0x39, 0x2A, 0x7C, 0x91, 0xF2, 0xEB, 0xD1, 0x6E, 0x51, 0x45, 0x64, 0xFF, 0x44,
+    0xC9, 0xD4, 0xE8, 0x14, 0xFB, 0x4F, 0x01, 0xE6, 0x1E, 0xD1, 0x0D, 0x67, 0xAA, 0xDF, 0x65, 0xF8,
+    0x5D, 0x06, 0xBC, 0x9A, 0x82, 0x6F, 0x3B, 0xF0, 0xDF, 0xCF, 0xC1, 0xFB, 0x1D, 0xF8, 0x07, 0x52,
+    0xE1, 0x81, 0x20, 0x0C, 0xBB, 0xE5, 0x1B, 0x16, 0x5F, 0x7A, 0x83, 0x35, 0xB8, 0xE4, 0x71, 0xF2,
+    0x50, 0x6E, 0xA2, 0x88, 0x92, 0x2A, 0x6E, 0xF1, 0xC7, 0x97, 0xD6, 0x30, 0x3D, 0xA8, 0xF4, 0xBE,
+    0x5B, 0xBB, 0xB2, 0x44, 0x2D, 0x9C, 0x76, 0xC5, 0xEE, 0x6F, 0x77, 0xFD, 0xE3, 0x2E, 0xED, 0xCE,
+    0x36, 0x11, 0xE4, 0x78, 0x23, 0x61, 0x9D, 0x90, 0x74, 0xDA, 0x28, 0xA3, 0xA4, 0x76, 0x25, 0xA4,
+    0x48, 0x63, 0xB1, 0xF6, 0xA1, 0x8B, 0xCD, 0x3A, 0x48, 0xED, 0x56, 0x71, 0x1E, 0x46, 0x16, 0x2B,
+    0x2E, 0xC0, 0x86, 0x9D, 0x1F, 0xE5, 0x16, 0x4E, 0xCE, 0xFD, 0x8F, 0xE5, 0x01, 0x3A, 0xF7, 0xCE,
+    0x51, 0x05, 0x6D, 0xC2, 0x4F, 0xCF, 0x0D, 0xE8, 0x05, 0xC7, 0x76, 0x53, 0x49, 0x0E, 0xAC, 0xAE,
+    0x6B, 0xB5, 0xC4, 0x52, 0xA0, 0x0D, 0x65, 0xA8, 0x17, 0xE8, 0x9D, 0x08, 0xEE, 0xBA, 0x6B, 0xFD,
+    0xF3, 0xA3, 0x4B, 0x92, 0xE2, 0x0E, 0xEA, 0x96, 0xAC, 0xD5, 0xA6, 0x24, 0x29, 0xDD, 0x9B, 0xFB,
+    0x2A, 0x69, 0x9D, 0x3C, 0x2B, 0xB9, 0x0A, 0x9E, 0xB1, 0x96, 0x54, 0x19, 0x1B, 0xA7, 0xD6, 0xC9,
+    0x55, 0x1D, 0x54, 0x21, 0x79, 0x25, 0x17, 0xD0, 0x63, 0x78, 0x7C, 0x94, 0x53, 0xF8, 0x38, 0x44,
+    0xEE, 0xDB, 0xEA, 0xA0, 0x46, 0x1E, 0x0E, 0x71, 0xB7, 0x28, 0x16, 0xE7, 0x6E, 0xE5, 0x02, 0xA3,
+    0x0F, 0x66, 0x73, 0x6E, 0xFD, 0x54, 0x5A, 0x12, 0x36, 0x67, 0x78, 0xBB, 0xE6, 0xE0, 0xEB, 0xF4,
+    0xF6, 0x28, 0x87, 0xF1, 0xA0, 0x8F, 0x02, 0x79, 0xC1, 0x5F, 0xB9, 0x08, 0x24, 0x37, 0x90, 0x3A,
+    0xF7, 0x35, 0x12, 0x51, 0x91, 0x57, 0x6D, 0x09, 0x6B, 0x4D, 0x76, 0x5B, 0x4B, 0x5B, 0x1B, 0x5F,
+    0x64, 0xF3, 0x57, 0x5B, 0xB7, 0x69, 0x84, 0x59, 0x2B, 0x77, 0x9C, 0x48, 0x81, 0xA4, 0xDB, 0xF5,
+    0xB8, 0x43, 0x9C, 0x21, 0x47, 0xFB, 0x6B, 0xE8, 0x4E, 0x2A, 0x9D, 0x72, 0x64, 0x8F, 0x7D, 0xDE,
+    0xE6, 0x94, 0xA3, 0x20, 0xF5, 0x0B, 0x4F, 0x2B, 0xE3, 0x14, 0x94, 0xAD, 0x23, 0x62, 0x21, 0xD7,
+    0x22, 0x52, 0x1E, 0x26, 0x12, 0x30, 0x82, 0x0F, 0xB8, 0x0F, 0xE1, 0xD4, 0x81, 0x1F, 0x4B, 0x8A,
+    0x0B, 0x31, 0x6D, 0x44, 0xCA, 0xE4, 0x0C, 0xB5, 0xA3, 0x40, 0x7F, 0x1F, 0xBF, 0x00, 0xAD, 0x55,
+    0x31, 0x6F, 0xDD, 0x54, 0x14, 0x3E, 0xB6, 0xF3, 0x9E, 0xDB, 0x1A, 0xE1, 0x0C, 0x89, 0x80, 0x2A,
+    0x60, 0x86, 0x0E, 0x1D, 0xA0, 0x5E, 0x32, 0x30, 0xBC, 0xD8, 0xB7, 0x8A, 0x44, 0x06, 0x86, 0x64,
+    0x88, 0x59, 0x58, 0x32, 0x74, 0x0F, 0x63, 0x87, 0x97, 0xDA, 0x25, 0x43, 0xC7, 0x46, 0x62, 0x64,
+    0xE9, 0xD0, 0x01, 0x85, 0x21, 0xFC, 0x80, 0x04, 0x3B, 0x79, 0x03, 0x23, 0x6E, 0xA3, 0x8A, 0x81,
+    0xC5, 0xA8, 0x4C, 0x2C, 0xDC, 0x20, 0x23, 0x9C, 0xEA, 0xDA, 0x87, 0xEF, 0xF8, 0xBD, 0x08, 0xA5,
+    0x52, 0x11, 0xA0, 0x5E, 0xF9, 0xDE, 0xF7, 0xEE, 0xF5, 0x3D, 0xDF, 0x3D, 0xE7, 0xBB, 0xDF, 0x39,
+    0x26, 0x42, 0x73, 0x2B, 0x43, 0xC4, 0x41, 0x45, 0x9E, 0x6E, 0x89, 0x16, 0x06, 0x4A, 0x16, 0x69,
+    0x31, 0xB1, 0x92, 0x4F, 0xB8, 0x49, 0xBB, 0xB4, 0xB3, 0x39, 0xCB, 0x0B, 0xBF, 0x72, 0x5A, 0xCB,
+    0x50, 0xA0, 0x63, 0x45, 0xBC, 0x56, 0x91, 0x63, 0x60, 0x15, 0xFE, 0x96, 0xC1, 0x54, 0x03, 0x03,
+    0x96, 0x14, 0x17, 0x84, 0xE5, 0x4B, 0x7F, 0x4A, 0x74, 0xAE, 0xC8, 0xE5, 0x8E, 0xA6, 0xED, 0x5B,
+    0xA2, 0xA0, 0x24, 0x9B, 0x61, 0xFB, 0x0B, 0xD1, 0x9D, 0x7E, 0xCD, 0x4A, 0x92, 0x8D, 0x90, 0x59,
+    0xE7, 0xCC, 0x93, 0xDA, 0xE9, 0xFC, 0x2C, 0xD4, 0xEF, 0x12, 0x76, 0xF8, 0x0D, 0x51, 0x5E, 0x90,
+    0x6B, 0x7A, 0x20, 0x07, 0x10, 0x01, 0x8E, 0x62, 0xB5, 0x84, 0x17, 0x4D, 0x5E, 0xB8, 0xCF, 0xBB,
+    0xFD, 0x7C, 0x9D, 0xD9, 0x88, 0x6D, 0x0F, 0x64, 0x2B, 0xB2, 0xF0, 0x0F, 0xFB, 0xBF, 0x23, 0x8A,
+    0x88, 0x86, 0xB3, 0x43, 0x29, 0xE4, 0xCE, 0x03, 0xF8, 0x1F, 0x69, 0x55, 0x07, 0xD5, 0xDB, 0x40,
+    0xF1, 0xF1, 0xD4, 0xE4, 0x35, 0x00, 0xF7, 0x5C, 0xE3, 0x9C, 0x76, 0x9F, 0x6A, 0x00, 0xC5, 0x33,
+    0x37, 0x87, 0xA0, 0x20, 0x55, 0x64, 0x63, 0xE6, 0xD6, 0xF0, 0x6F, 0x0A, 0x92, 0x24, 0x9B, 0xDE,
+    0xEC, 0xB4, 0x96, 0x78, 0xB7, 0xF2, 0x8C, 0xAB, 0x10, 0xA9, 0xF8, 0x15, 0x6A, 0xB2, 0xC4, 0x61,
+    0x6C, 0xE6, 0x6C, 0xE6, 0xB0, 0x8B, 0x17, 0x51, 0xA8, 0xAD, 0x86, 0xF7, 0x0F, 0x4E, 0x99, 0x59,
+    0x6C, 0xA7, 0xCC, 0x22, 0x8E, 0x82, 0xBC, 0x9A, 0x40, 0x27, 0xCD, 0x5D, 0xB8, 0x98, 0x73, 0x03,
+    0x64, 0xFF, 0x19, 0xEF, 0x96, 0x69, 0xB6, 0x95, 0x16, 0x42, 0x22, 0xA2, 0x0E, 0x2B, 0x04, 0xFD,
+    0x41, 0xA0, 0xFD, 0xF5, 0xF3, 0xCF, 0x26, 0x38, 0x99, 0xB9, 0xB9, 0xB0, 0xF0, 0x68, 0x4C, 0xB1,
+    0x5B, 0x52, 0x7C, 0x04, 0x6F, 0x2B, 0x1C, 0xF9, 0x5A, 0xC9, 0xB4, 0x68, 0xC3, 0xA9, 0xC6, 0x74,
+    0xB4, 0x42, 0x3E, 0xAC, 0xF1, 0x5C, 0x53, 0xFF, 0x93, 0xCC, 0x3D, 0x0A, 0xB8, 0x08, 0xB8, 0xF6,
+    0xF5, 0x91, 0x5B, 0x5F, 0xB5, 0xE1, 0x40, 0x0E, 0x10, 0x30, 0xA0, 0xE9, 0x1F, 0x27, 0x2E, 0x37,
+    0x36, 0x30, 0x16, 0xDC, 0x32, 0xB5, 0x8D, 0x5B, 0x5E, 0xB1, 0x9D, 0x33, 0x63, 0x76, 0xAE, 0x08,
+    0x66, 0x50, 0x20, 0x80, 0xA3, 0x3A, 0xF0, 0x4E, 0xCA, 0x8F, 0xE4, 0x88, 0xDB, 0x4E, 0x37, 0x8A,
+    0x79, 0xF2, 0x7D, 0x03, 0x3E, 0xF1, 0xCB, 0x66, 0x31, 0x81, 0xB7, 0x4E, 0xB1, 0x14, 0x7F, 0x75,
+    0xC2, 0xF5, 0xB0, 0xA1, 0x81, 0x63, 0xE2, 0x49, 0x23, 0x64, 0x3B, 0xFA, 0x30, 0xF5, 0x7F, 0xD4,
+    0xED, 0x9C, 0x45, 0x5E, 0x15, 0x9B, 0xF1, 0xCA, 0x8D, 0x91, 0x55, 0xBB, 0x85, 0xA3, 0x86, 0x55,
+    0x68, 0x46, 0xA3, 0xBB, 0x1F, 0xAE, 0x8C, 0x82, 0xDA, 0x52, 0x43, 0x47, 0x99, 0x43, 0xFF, 0xE1,
+    0xC9, 0x59, 0xBD, 0x72, 0xCB, 0xBE, 0x0F, 0x3D, 0xD3, 0x9C, 0xB5, 0x5A, 0x1C, 0xC6, 0x01, 0x71,
+    0xE9, 0x36, 0x74, 0x9D, 0x96, 0xAE, 0x3A, 0xCF, 0x75, 0x1C, 0x5A, 0x75, 0xE3, 0x3D, 0x28, 0x96,
+    0x6F, 0x0A, 0x63, 0x5F, 0x13, 0xD7, 0xD1, 0xC1, 0x44, 0x8D, 0xE7, 0x2D, 0xB2, 0xEC, 0x33, 0x6D,
+    0x62, 0xFF, 0xA4, 0x99, 0x0F, 0xFD, 0x9F, 0xCD, 0xBD, 0x30, 0xF8, 0x58, 0x45, 0xE1, 0x0F, 0x4F,
+    0xEB, 0xC8, 0x2D, 0xB7, 0x16, 0xA2, 0x68, 0x34, 0x5A, 0x9E, 0x0F, 0x56, 0xAB, 0xC6, 0x8C, 0xE0,
+    0x93, 0xD5, 0xC4, 0x13, 0xF3, 0x9E, 0x7A, 0x67, 0xF8, 0x40, 0xB7, 0xA9, 0xFF, 0x74, 0xEF, 0xCE,
+    0xF5, 0xB5, 0x56, 0xF3, 0x9B, 0xE9, 0xF1, 0xDE, 0x35, 0x4F, 0x9B, 0x28, 0x1E, 0xD0, 0xAD, 0x55,
+    0x10, 0x70, 0x18, 0x8A, 0xBE, 0xEB, 0x1D, 0xAF, 0xC8, 0xBF, 0x6C, 0x2D, 0xFA, 0x86, 0xFB, 0x9B,
+    0x9A, 0x07, 0x61, 0x2E, 0xD3, 0xB9, 0x89, 0x9C, 0x27, 0x0A, 0x60, 0x76, 0xF1, 0x46, 0xBC, 0x86,
+    0xA0, 0xBD, 0x73, 0x91, 0xC8, 0x17, 0xAB, 0xDD, 0x38, 0xE2, 0x93, 0xDD, 0xBA, 0xCF, 0xE8, 0x55,
+    0xB9, 0x95, 0xE2, 0x92, 0x9F, 0xD2, 0x34, 0x85, 0xCA, 0xD5, 0x48, 0x1B, 0xBF, 0xE7, 0x07, 0x3E,
+    0x9C, 0x6A, 0x91, 0xEA, 0x42, 0xE0, 0x1D, 0x73, 0x9C, 0x4D, 0x6F, 0x7D, 0x99, 0xFA, 0xDB, 0xA1,
+    0x1C, 0x29, 0x1D, 0x08, 0xDC, 0xD6, 0xAC, 0x4C, 0x24, 0x9B, 0xF1, 0x54, 0x36, 0x46, 0x0A, 0x04,
+    0xD2, 0x7E, 0x8C, 0xBE, 0x2C, 0xE9, 0xDF, 0x77, 0xE6, 0xA2, 0xEF, 0xDD, 0xBE, 0x9A, 0xAD, 0xCD,
+    0xA3, 0x8F, 0xD0, 0x0F, 0xB1, 0xD6, 0xDB, 0xC5, 0x17, 0xA2, 0x36, 0xA1, 0xB2, 0xDB, 0xB8, 0xB0,
+    0x0C, 0x0E, 0xDD, 0x18, 0xBC, 0x56, 0x7C, 0xE0, 0x24, 0xCA, 0x17, 0xCA, 0xB0, 0x1B, 0x89, 0xD8,
+    0x86, 0xD5, 0x3D, 0x8A, 0xDC, 0xC6, 0xCF, 0xFC, 0xDB, 0x9D, 0x83, 0x98, 0x52, 0x89, 0x13, 0x45,
+    0x10, 0x29, 0xCF, 0xBC, 0x87, 0x74, 0x16, 0xF9, 0xA6, 0xBF, 0x72, 0x89, 0x45, 0x0F, 0x62, 0x6C,
+    0x90, 0x03, 0x56, 0x27, 0xB9, 0x93, 0x66, 0xC8, 0xDD, 0xB0, 0xB2, 0x5B, 0xE4, 0xAC, 0xCA, 0xA1,
+    0xB7, 0x52, 0xEA, 0xDD, 0xD4, 0xD6, 0x97, 0xDC, 0x11, 0x7A, 0x6C, 0x16, 0x8E, 0x24, 0x2D, 0xFF,
+    0x6E, 0x9F, 0xE3, 0x7D, 0x05, 0xE4, 0xAC, 0xDF, 0x71, 0xA3, 0x5F, 0x1B, 0x4C, 0xE3, 0x6B, 0x90,
+    0xAE, 0x55, 0xFC, 0x6C, 0x5B, 0x31, 0xED, 0x38, 0xC6, 0xD2, 0xBE, 0x76, 0x32, 0x41, 0xE5, 0x69,
+    0x94, 0x02, 0xFB, 0xF2, 0xB4, 0x24, 0x0F, 0xB4, 0x49, 0x75, 0xA5, 0xE1, 0x0B, 0x05, 0x5F, 0x6A,
+    0x44, 0xD6, 0xF8, 0xB5, 0xDD, 0x84, 0x25, 0x14, 0x55, 0x50, 0x8D, 0x12, 0xB6, 0x27, 0x57, 0xC6,
+    0xF0, 0xA5, 0xEF, 0xFB, 0x8F, 0x90, 0xF0, 0x7D, 0x89, 0x92, 0x52, 0x70, 0x37, 0xAE, 0xC0, 0x78,
+    0xFB, 0x96, 0x41, 0x36, 0xD7, 0x88, 0xB7, 0xA4, 0xC1, 0x26, 0xD1, 0xF6, 0x63, 0xFC, 0x3D, 0x96,
+    0x4A, 0x43, 0x26, 0x55, 0x31, 0x82, 0x5F, 0x43, 0x6D, 0x87, 0x75, 0xC0, 0x25, 0xDE, 0xE0, 0x50,
+    0xC8, 0xC5, 0xDC, 0x24, 0xDE, 0xA6, 0xE0, 0xA7, 0xD2, 0xFB, 0xBD, 0x73, 0xE1, 0xBB, 0x09, 0xE0,
+    0xCA, 0xE2, 0x46, 0x2F, 0xB1, 0x36, 0x64, 0xB8, 0x0E, 0x37, 0x5F, 0x3D, 0x94, 0x21, 0x9F, 0x72,
+    0x2B, 0x5A, 0xDB, 0x49, 0xD7, 0xFF, 0xAC, 0xBB, 0x05, 0x4B, 0xD1, 0x7F, 0xB3, 0xB5, 0x92, 0x4D,
+    0x97, 0x5B, 0x47, 0x08, 0x28, 0xFE, 0xF5, 0x93, 0x51, 0x9E, 0x81, 0x42, 0x17, 0xB7, 0xD8, 0xC8,
+    0x57, 0x68, 0x5A, 0xD4, 0x93, 0x0D, 0xB9, 0x6C, 0x49, 0x25, 0x16, 0x0E, 0xC8, 0x2F, 0x98, 0x5E,
+    0x1A, 0xB3, 0xD9, 0x08, 0x7A, 0x02, 0x25, 0x9B, 0x64, 0x34, 0x14, 0x12, 0x0B, 0x16, 0x20, 0x19,
+    0x5F, 0x1B, 0x19, 0x8F, 0x64, 0x7C, 0xDF, 0x10, 0x5B, 0x5D, 0x0A, 0xC1, 0x6C, 0x9B, 0x5C, 0x07,
+    0x20, 0x37, 0xCD, 0x20, 0x43, 0x35, 0x37, 0x13, 0xB4, 0x4A, 0x12, 0xC8, 0x16, 0xA1, 0x82, 0x48,
+    0xBE, 0x2F, 0x3C, 0x40, 0xF2, 0x5D, 0x7F, 0xB3, 0xA2, 0xA1, 0xCB, 0x93, 0x52, 0xBE, 0x2B, 0x22,
+    0xD9, 0xFE, 0xAE, 0xD1, 0x50, 0xD3, 0xF7, 0x0F, 0x5E, 0x70, 0x21, 0xDB, 0xEC, 0xAE, 0xDF, 0x16,
+    0x54, 0xBD, 0xCD, 0x74, 0x12, 0x96, 0x62, 0xB3, 0x0D, 0xE1, 0x3F, 0xC1, 0xEE, 0xFE, 0x1C, 0x56,
+    0xF4, 0x8A, 0xF6, 0x17, 0x9D, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0xB0, 0xB1, 0x84,
+    0x25, 0x26, 0x05, 0xDB, 0x40, 0xE1, 0x16, 0x09, 0x24, 0x37, 0x94, 0xD9, 0x9D, 0x01, 0x4A, 0x8A,
+    0xBC, 0x22, 0x86, 0x22, 0x45, 0x7A, 0x1A, 0x5A, 0x8A, 0x10, 0x5B, 0xF0, 0x03, 0xC2, 0x4F, 0xA0,
+    0xA0, 0x4A, 0x45, 0x41, 0x49, 0xE2, 0x49, 0x52, 0x50, 0x62, 0x85, 0x92, 0x22, 0x56, 0x10, 0x12,
+    0x4A, 0xE5, 0x48, 0x06, 0x2C, 0x18, 0xCF, 0xE5, 0x1C, 0xFB, 0x6D, 0x10, 0x0A, 0x55, 0xDE, 0xEE,
+    0x9C, 0xF7, 0x7C, 0xE7, 0xCE, 0x9D, 0x73, 0x3F, 0x7D, 0xDA, 0x34, 0x8D, 0x17, 0xC5, 0x47, 0x0C,
+    0x20, 0x8A, 0x7D, 0x94, 0x8A, 0x51, 0xCE, 0x8B, 0xC5, 0x76, 0x32, 0x57, 0xE3, 0x99, 0x88, 0xB4,
+    0x1D, 0x20, 0x4B, 0x00, 0x29, 0x92, 0x8E, 0x22, 0x95, 0xEA, 0x04, 0xF1, 0x53, 0xFC, 0x86, 0xB8,
+    0x0F, 0x52, 0x2C, 0xA2, 0x10, 0x8F, 0x26, 0x52, 0xDB, 0x4E, 0x92, 0x27, 0x71, 0x83, 0xF4, 0xFA,
+    0xA1, 0xCE, 0x46, 0x57, 0xA7, 0x83, 0xEC, 0x1F, 0x43, 0x53, 0x3D, 0x96, 0x85, 0xA6, 0x28, 0x9E,
+    0x72, 0xBF, 0xEF, 0x9C, 0x34, 0x87, 0xFC, 0x2B, 0x28, 0xB6, 0xA1, 0x5F, 0x8D, 0x8A, 0x0B, 0x75,
+    0x84, 0xCD, 0x28, 0x26, 0x96, 0x83, 0xD8, 0xC9, 0x89, 0xB8, 0x07, 0xB8, 0x54, 0x35, 0x90, 0xA8,
+    0x87, 0x08, 0x37, 0xBA, 0xFB, 0x60, 0xA5, 0x66, 0x85, 0x56, 0x01, 0xEA, 0x13, 0xAC, 0xBA, 0xA1,
+    0x5A, 0x4A, 0x9D, 0xEA, 0xC5, 0x69, 0xA8, 0x17, 0x1A, 0x3E, 0x5E, 0x2D, 0xDF, 0x12, 0x9C, 0xBF,
+    0xB8, 0x9C, 0xBC, 0xE1, 0xD6, 0xD7, 0xC7, 0xDD, 0xA6, 0xC9, 0x9A, 0x6B, 0xB8, 0x5F, 0xC1, 0x79,
+    0xA8, 0xB5, 0x73, 0x01, 0xD7, 0xC3, 0x13, 0x17, 0xE0, 0x94, 0x9B, 0xF0, 0xE0, 0xF0, 0x1D, 0x1C,
+    0x85, 0x2D, 0x85, 0x2D, 0x36, 0xB5, 0xE5, 0xA6, 0x52, 0x93, 0x94, 0xCD, 0x76, 0x02, 0x91, 0x24,
+    0x0D, 0x51, 0xDF, 0xEB, 0xFB, 0x9B, 0xF3, 0xE4, 0xFB, 0x56, 0xDE, 0x49, 0x31, 0x9C, 0x83, 0xC1,
+    0x8D, 0x41, 0x32, 0x05, 0xB3, 0xEC, 0xDA, 0x7E, 0xF3, 0x29, 0x6E, 0xBE, 0xAE, 0xB3, 0xD3, 0x36,
+    0xE5, 0xD0, 0xED, 0xCA, 0x09, 0xBE, 0x44, 0xA9, 0x87, 0xAA, 0x83, 0x6F, 0x93, 0x94, 0xD3, 0x2D,
+    0x9C, 0xBA, 0x1D, 0x24, 0x5F, 0x71, 0x0A, 0x17, 0x81, 0x3A, 0xE2, 0xC9, 0x58, 0x4B, 0xED, 0xC5,
+    0x18, 0x64, 0xE4, 0x1E, 0x1E, 0x4A, 0xDC, 0x22, 0x2D, 0x23, 0x7D, 0xD8, 0xAC, 0x7A, 0xFA, 0xF3,
+    0x93, 0xA6, 0x5A, 0xBF, 0xD0, 0xC5, 0xD0, 0xE0, 0xCB, 0x42, 0x6A, 0xDA, 0xB1, 0x46, 0x75, 0x24,
+    0x47, 0xD8, 0x13, 0x28, 0x2D, 0xE1, 0x9C, 0x70, 0xF6, 0x1C, 0x5E, 0x21, 0xBC, 0x41, 0x20, 0xCB,
+    0x8C, 0x84, 0x0C, 0x12, 0xB6, 0x43, 0xF9, 0x18, 0xDC, 0xEC, 0x6D, 0x24, 0xB1, 0xBE, 0x0A, 0x70,
+    0x28, 0x1A, 0xB9, 0x45, 0x2F, 0xD6, 0x8F, 0x57, 0x26, 0x36, 0x49, 0xBE, 0x95, 0x21, 0x22, 0xE8,
+    0x51, 0x82, 0x6D, 0xB0, 0x03, 0xC2, 0xD8, 0xC7, 0x5C, 0xA3, 0xA2, 0x24, 0xE2, 0x69, 0xD3, 0x1C,
+    0x40, 0x60, 0x01, 0x93, 0xC5, 0xAC, 0x1F, 0xCD, 0x26, 0x66, 0x58, 0x32, 0x61, 0x79, 0xB3, 0x7A,
+    0x96, 0x45, 0x87, 0x85, 0xE7, 0x37, 0xA3, 0x89, 0xF9, 0x8A, 0xFD, 0x75, 0xFF, 0xC6, 0x5F, 0xFA,
+    0x94, 0xE7, 0x46, 0xA7, 0x69, 0xAF, 0xB6, 0x4F, 0xBE, 0x41, 0xDE, 0xB4, 0xA3, 0xCC, 0x44, 0x8B,
+    0x33, 0x05, 0x6C, 0x19, 0x7E, 0x63, 0xD9, 0x01, 0x76, 0xC2, 0xBF, 0xB6, 0xCC, 0xD1, 0x5E, 0xBE,
+    0xFF, 0x5E, 0xFF, 0x6B, 0x8B, 0xBC, 0x40, 0xFC, 0x09, 0x56, 0xA7, 0xCD, 0x5D, 0xD2, 0xB2, 0x53,
+    0x11, 0x5C, 0x78, 0x8D, 0x51, 0xA0, 0x83, 0x96, 0xEE, 0x06, 0x79, 0xE1, 0xD1, 0x4B, 0x8D, 0x16,
+    0x52, 0xB6, 0x01, 0xDA, 0xF0, 0xC0, 0x36, 0x5C, 0x08, 0xA3, 0xD8, 0xD0, 0xFB, 0x17, 0xA0, 0x03,
+    0x54, 0x1B, 0x78, 0x40, 0x2D, 0x00, 0x47, 0xB8, 0x45, 0xB8, 0x4B, 0x88, 0x80, 0x62, 0x6D, 0xB4,
+    0x6B, 0xD9, 0xCB, 0x3D, 0x60, 0x45, 0x9A, 0xB2, 0xB8, 0x01, 0x5A, 0x48, 0x22, 0x13, 0xB6, 0xBC,
+    0x03, 0xF8, 0xEE, 0x82, 0x3B, 0x8A, 0x44, 0x23, 0xFC, 0x81, 0x5F, 0x19, 0xBC, 0x93, 0x9B, 0x58,
+    0xEF, 0x92, 0xE6, 0xB6, 0xF6, 0x38, 0x04, 0x93, 0xEE, 0xF8, 0xA3, 0xEC, 0x32, 0xD6, 0x15, 0xAC,
+    0xEF, 0x21, 0xDB, 0xCE, 0x31, 0x27, 0x79, 0x87, 0xFE, 0xBD, 0xD4, 0xD9, 0xD9, 0xA2, 0xF5, 0x46,
+    0x1B, 0x4B, 0x50, 0x98, 0x6C, 0x92, 0x24, 0x70, 0xC6, 0x49, 0xCA, 0x90, 0xEB, 0xAA, 0x4B, 0xC8,
+    0xAD, 0x94, 0x21, 0x95, 0x2C, 0xDF, 0x29, 0x59, 0xC4, 0x80, 0x29, 0x47, 0x95, 0x14, 0xCA, 0xC6,
+    0x46, 0x64, 0x52, 0x85, 0x6A, 0xAE, 0xC7, 0x64, 0x67, 0x54, 0x58, 0x48, 0xE8, 0x04, 0x4C, 0x89,
+    0x64, 0x58, 0x1B, 0xB0, 0xA2, 0xBE, 0x5C, 0xD9, 0x57, 0x43, 0xBD, 0xE0, 0x22, 0x37, 0xB7, 0x63,
+    0xA5, 0x68, 0xFA, 0x13, 0x36, 0x75, 0x76, 0x90, 0xB7, 0x7F, 0xC3, 0x68, 0x82, 0x02, 0xCA, 0x65,
+    0x2A, 0xA3, 0xC5, 0x20, 0x3A, 0x43, 0xA0, 0x2F, 0x67, 0xEB, 0x16, 0x73, 0xF4, 0x29, 0xB6, 0x44,
+    0xAE, 0x33, 0x0D, 0x10, 0x95, 0xCB, 0x15, 0xA9, 0x7F, 0xC1, 0x94, 0xB9, 0xBA, 0x94, 0x74, 0x24,
+    0x54, 0x88, 0x3E, 0x9B, 0x92, 0xAD, 0xD3, 0x58, 0x76, 0xE4, 0x23, 0x9D, 0x4B, 0x1D, 0x2F, 0xA6,
+    0xC0, 0xD6, 0xDB, 0x1C, 0x31, 0xC1, 0xB2, 0xD1, 0x2D, 0xC2, 0x12, 0xAB, 0x1F, 0x21, 0xAC, 0x1E,
+    0x42, 0xF8, 0x38, 0x70, 0x0A, 0x04, 0x4E, 0x81, 0x40, 0xCD, 0x6D, 0x6E, 0x6C, 0x43, 0x64, 0x46,
+    0x19, 0xD7, 0x3A, 0xF4, 0x7A, 0x95, 0x36, 0x07, 0x29, 0xFC, 0x67, 0xF4, 0xBF, 0x06, 0xE9, 0x7B,
+    0x37, 0xE8, 0xF5, 0x36, 0x1E, 0x4F, 0x8F, 0x83, 0x10, 0x63, 0xE8, 0x84, 0x05, 0xF5, 0x81, 0xAE,
+    0x35, 0x5C, 0x4D, 0xC7, 0x79, 0x72, 0x1C, 0x47, 0x9B, 0x59, 0x25, 0x11, 0xCC, 0x6A, 0x77, 0x3F,
+    0x42, 0xF8, 0x2C, 0xE2, 0xCE, 0x35, 0x72, 0x93, 0xF9, 0x73, 0xF1, 0x82, 0xE5, 0x91, 0x32, 0x9A,
+    0x23, 0xD7, 0xB5, 0xD4, 0x79, 0xB3, 0x09, 0xE7, 0x5E, 0xF5, 0xAA, 0xEF, 0x69, 0xAE, 0xB3, 0xA5,
+    0x6A, 0x3F, 0xB1, 0xF0, 0xA1, 0x89, 0x59, 0xE2, 0x02, 0xE3, 0x5D, 0x6E, 0x23, 0x96, 0xBC, 0x10,
+    0x25, 0xF7, 0x90, 0x22, 0xF4, 0x2A, 0xDA, 0x62, 0x86, 0x56, 0xC5, 0x60, 0x70, 0x1E, 0x7A, 0xCE,
+    0x84, 0xD0, 0x8F, 0xD0, 0xEC, 0x91, 0x33, 0x79, 0x7D, 0x2F, 0x62, 0x66, 0x72, 0xB0, 0xEC, 0x66,
+    0x33, 0x81, 0xB4, 0x0D, 0x1C, 0xD3, 0x2C, 0x9D, 0x05, 0x5C, 0xCC, 0x08, 0x51, 0xE5, 0x21, 0xFA,
+    0x1C, 0xA2, 0x7C, 0x82, 0xC8, 0x22, 0x62, 0x18, 0x23, 0x2A, 0x39, 0x1A, 0x30, 0xB7, 0x08, 0x5D,
+    0xC5, 0x77, 0x47, 0x8F, 0xF0, 0xFE, 0x9E, 0xA4, 0xD5, 0xC1, 0xEF, 0x41, 0xF1, 0x59, 0x73, 0x60,
+    0xC4, 0x75, 0x2A, 0x74, 0xC0, 0x3F, 0x0A, 0xAB, 0x64, 0x42, 0xA1, 0x27, 0xD9, 0xDF, 0x73, 0xD5,
+    0xFB, 0xEC, 0xCF, 0xA5, 0x76, 0x3E, 0xFF, 0x23, 0x9E, 0x03, 0x9F, 0xC5, 0x33, 0xD7, 0xE5, 0xD3,
+    0x7A, 0xD3, 0x75, 0x66, 0xEA, 0x17, 0x04, 0x63, 0x6A, 0x67, 0xA2, 0x9B, 0x6A, 0x60, 0x3D, 0xD6,
+    0xA1, 0x98, 0xEC, 0x00, 0x1C, 0x6D, 0xA8, 0x07, 0x97, 0x2E, 0x79, 0x8D, 0x2D, 0x4C, 0x71, 0xCE,
+    0x5C, 0xA4, 0xFF, 0x89, 0x2E, 0x7B, 0xFA, 0xB7, 0x41, 0x58, 0xCE, 0x64, 0xB9, 0x32, 0x15, 0xBD,
+    0xDF, 0x85, 0xF0, 0x75, 0x66, 0xC3, 0x42, 0xF8, 0xF4, 0x8E, 0xFA, 0xFF, 0xD7, 0x44, 0xFA, 0xC7,
+    0x2D, 0xFD, 0xB7, 0x69, 0x73, 0x94, 0x4B, 0x7F, 0x79, 0xCC, 0x6A, 0xA4, 0x85, 0xE7, 0xD8, 0x27,
+    0x35, 0x9C, 0xF9, 0x12, 0xA7, 0x22, 0x5E, 0xB4, 0xEE, 0xE7, 0x19, 0xC5, 0x89, 0x96, 0x70, 0x8F,
+    0x9F, 0xFF, 0x60, 0xEC, 0xF1, 0xB2, 0x72, 0x3F, 0xD0, 0xB2, 0x9B, 0x32, 0xCD, 0xF4, 0xD7, 0x3E,
+    0x14, 0x7C, 0x09, 0x97, 0x7C, 0x91, 0x9C, 0x1C, 0xE4, 0xA5, 0x3F, 0xFF, 0x00, 0xAD, 0x55, 0x3D,
+    0x8F, 0xE5, 0x34, 0x14, 0xBD, 0x89, 0x79, 0x93, 0x22, 0x45, 0x1A, 0x9E, 0x28, 0x90, 0xC8, 0x4F,
+    0xC8, 0x2F, 0xD8, 0xB5, 0xA5, 0x11, 0xA2, 0xA0, 0xE0, 0x81, 0xE6, 0x55, 0x14, 0x50, 0xAF, 0x04,
+    0xAF, 0xA5, 0x01, 0x87, 0xA1, 0xA0, 0x9C, 0xA5, 0x40, 0xB4, 0x14, 0x34, 0x5B, 0xCD, 0x1F, 0x18,
+    0x11, 0x0F, 0x5B, 0x52, 0x10, 0x58, 0x21, 0x5A, 0x0B, 0x86, 0x82, 0xCE, 0xDA, 0xCD, 0x48, 0x19,
+    0xAD, 0xE3, 0xCB, 0xB9, 0xCE, 0xAC, 0x60, 0x9B, 0x15, 0x20, 0xF2, 0x5E, 0xEC, 0xC4, 0xF6, 0xFD,
+    0x3A, 0xF7, 0xDC, 0x9B, 0xED, 0x1E, 0x57, 0xC3, 0xB8, 0xBE, 0x93, 0x61, 0x6C, 0x26, 0xB2, 0x4E,
+    0x45, 0x6A, 0x03, 0x31, 0x55, 0x91, 0xB4, 0x2B, 0x98, 0x9A, 0xF0, 0x8F, 0x17, 0x45, 0xBC, 0xE3,
+    0x91, 0xB9, 0xE1, 0xC9, 0xB2, 0xDB, 0xDC, 0x7B, 0x40, 0x1A, 0x6A, 0x3B, 0xE6, 0x49, 0xC5, 0x76,
+    0x56, 0xF1, 0xEF, 0xBF, 0x0A, 0xEF, 0xED, 0xA4, 0xB0, 0x8F, 0xDB, 0xA8, 0x74, 0x9F, 0xA0, 0xEF,
+    0xAF, 0x7B, 0x21, 0x82, 0x2A, 0xC8, 0x8F, 0x44, 0x47, 0xC9, 0x94, 0xCC, 0x0E, 0xBA, 0xB0, 0x1C,
+    0xBB, 0x51, 0x05, 0xA6, 0xFA, 0xF3, 0x09, 0x27, 0xB0, 0xC9, 0xAB, 0x00, 0x8C, 0x93, 0xF6, 0x44,
+    0x83, 0xA3, 0x82, 0x0D, 0x29, 0xEE, 0x8B, 0x37, 0x98, 0x97, 0x8A, 0x39, 0x94, 0x9C, 0x88, 0xB6,
+    0xF8, 0x23, 0xDA, 0x63, 0xC4, 0x19, 0xA1, 0x88, 0x1F, 0x4E, 0xF6, 0x32, 0xDE, 0x55, 0xB1, 0x79,
+    0x38, 0x6A, 0x37, 0xBF, 0xA4, 0xE2, 0x06, 0xF2, 0x6E, 0xD5, 0xF5, 0xA2, 0x07, 0x0B, 0x93, 0x16,
+    0x4E, 0xD5, 0xBC, 0x40, 0x61, 0xB1, 0x7F, 0x97, 0x27, 0xCD, 0x36, 0x95, 0x08, 0xBB, 0xAF, 0x03,
+    0xA0, 0x88, 0xF0, 0xAA, 0xED, 0x89, 0x55, 0xA0, 0x3A, 0x7C, 0x02, 0xC9, 0x33, 0x47, 0xE5, 0x32,
+    0xC3, 0x43, 0x78, 0x4A, 0xC3, 0x78, 0xAB, 0xA7, 0x83, 0x8F, 0x0A, 0xFE, 0x7E, 0x8B, 0x97, 0x1A,
+    0x0E, 0x67, 0xC5, 0xB4, 0xC3, 0x8D, 0x83, 0x41, 0x06, 0x6C, 0x4A, 0x70, 0x74, 0xC4, 0xDF, 0x20,
+    0x24, 0x86, 0xFA, 0xC4, 0x36, 0xB4, 0x7E, 0xA8, 0x67, 0xED, 0x06, 0x15, 0x31, 0x94, 0xCB, 0xB3,
+    0x41, 0xC5, 0xCE, 0x0F, 0xD5, 0xDC, 0xDC, 0xF0, 0x21, 0x28, 0x39, 0x0C, 0xF4, 0xAE, 0xC4, 0x1E,
+    0xEE, 0x92, 0xBF, 0xBE, 0x55, 0xBA, 0xD9, 0xEF, 0xE0, 0xB4, 0xD9, 0xEF, 0x98, 0xDF, 0xE4, 0x9F,
+    0x78, 0x7E, 0x35, 0x11, 0xBB, 0xCE, 0x11, 0x7F, 0x1A, 0x61, 0xA2, 0x19, 0x29, 0x43, 0x55, 0x8A,
+    0x69, 0x25, 0xA6, 0xEB, 0x45, 0x54, 0xC0, 0xC3, 0xEA, 0x29, 0x06, 0xFD, 0xD6, 0x4C, 0x6A, 0x6E,
+    0x27, 0xEA, 0x5C, 0x17, 0xCA, 0x85, 0x74, 0xB0, 0x5C, 0x71, 0xE2, 0xD8, 0x71, 0x10, 0xAD, 0x27,
+    0x48, 0x3B, 0xF3, 0x29, 0xCF, 0x1D, 0xF7, 0x20, 0xC8, 0x60, 0x94, 0x60, 0x81, 0x18, 0xEA, 0x09,
+    0xF8, 0x41, 0xE0, 0x5F, 0x2C, 0xDE, 0xEC, 0xB9, 0xEF, 0x84, 0x94, 0x99, 0x9E, 0x02, 0x4D, 0x15,
+    0x04, 0x1B, 0x81, 0x8E, 0x74, 0x46, 0xA9, 0xC7, 0x50, 0xC8, 0x0E, 0xE5, 0x44, 0xBC, 0xC3, 0x49,
+    0xF3, 0x2F, 0xEC, 0x6D, 0x2A, 0x12, 0x94, 0x54, 0x33, 0xD4, 0xB5, 0x1E, 0x8A, 0xAD, 0x6B, 0x84,
+    0xA5, 0xDA, 0xA9, 0x24, 0x16, 0x90, 0x7F, 0x19, 0x02, 0x1D, 0x3D, 0x90, 0xA4, 0x66, 0x88, 0x73,
+    0x46, 0x1A, 0x31, 0xA0, 0x47, 0x49, 0x87, 0x70, 0x89, 0xC7, 0xED, 0xFE, 0xF5, 0xFD, 0xDB, 0xFB,
+    0x13, 0x66, 0xCD, 0x3F, 0xF0, 0x63, 0x9E, 0x86, 0xA5, 0x4B, 0x46, 0x14, 0x35, 0xA2, 0x16, 0x0F,
+    0x88, 0x12, 0x0F, 0x62, 0x0D, 0x0F, 0x33, 0xFD, 0xC7, 0xAD, 0x2F, 0xED, 0xCF, 0x87, 0x90, 0x63,
+    0xE5, 0x98, 0x47, 0x41, 0x33, 0x5B, 0x16, 0xBB, 0x4F, 0x04, 0x5E, 0x49, 0xD6, 0xD5, 0xAD, 0xF4,
+    0xFF, 0x3B, 0xA5, 0x3D, 0xEF, 0x87, 0x71, 0xB5, 0xBE, 0xE8, 0x3C, 0xA5, 0x0C, 0x29, 0x2D, 0xEB,
+    0x14, 0x9F, 0x9B, 0x2E, 0xD6, 0xE9, 0xA3, 0x75, 0x92, 0x8A, 0x32, 0x04, 0x11, 0xB0, 0x05, 0x98,
+    0x35, 0x3F, 0x02, 0xCB, 0xBB, 0x82, 0xE5, 0x24, 0x58, 0x9A, 0x15, 0xDE, 0x13, 0xE1, 0x12, 0x08,
+    0xDE, 0x08, 0x29, 0xF5, 0x25, 0x9E, 0x18, 0x09, 0x92, 0x0E, 0x00, 0xC4, 0x1B, 0x0F, 0x18, 0x06,
+    0x53, 0xF0, 0x21, 0x4A, 0xAB, 0x40, 0x17, 0xC9, 0xAC, 0xCD, 0xAA, 0x0D, 0x49, 0x73, 0x02, 0x21,
+    0xF8, 0x57, 0x9E, 0x91, 0x14, 0x2F, 0x4A, 0x51, 0xFC, 0x52, 0x30, 0x93, 0xA4, 0x4D, 0x28, 0x08,
+    0x13, 0x83, 0x69, 0xAE, 0x8D, 0x6C, 0x48, 0x89, 0x60, 0x83, 0xA3, 0x6C, 0x5C, 0x72, 0x8F, 0x8D,
+    0xD0, 0x04, 0x91, 0x28, 0x63, 0x96, 0xE0, 0x2C, 0x61, 0x61, 0xB0, 0xB9, 0x19, 0x46, 0xED, 0x11,
+    0xF6, 0x38, 0xF0, 0x19, 0xE4, 0x74, 0xAE, 0xB6, 0x5B, 0xB3, 0xD2, 0x73, 0x40, 0xE1, 0xE7, 0xFB,
+    0x51, 0xEE, 0x49, 0x3B, 0x09, 0xA5, 0x57, 0xB9, 0x9F, 0xD5, 0x88, 0xA0, 0x5C, 0x54, 0x2C, 0x96,
+    0x75, 0xC6, 0x2F, 0x1D, 0x40, 0x7D, 0xF6, 0xFA, 0x19, 0x84, 0x87, 0x2B, 0xD4, 0x12, 0x7B, 0x29,
+    0x5E, 0xB2, 0xC6, 0xFA, 0xB6, 0xAF, 0xA2, 0x1A, 0x69, 0xE8, 0xDF, 0x97, 0xC6, 0x29, 0x3A, 0xDB,
+    0x15, 0x3B, 0x47, 0xF7, 0xCE, 0xD7, 0x05, 0x2A, 0x92, 0x42, 0x3D, 0x1E, 0xCF, 0x68, 0x64, 0xFC,
+    0x05, 0x8A, 0x73, 0x05, 0xC5, 0x50, 0x71, 0xB2, 0x3A, 0x77, 0x7E, 0x1F, 0x11, 0x9A, 0x8E, 0xE7,
+    0x92, 0x67, 0x48, 0x66, 0x6A, 0x8D, 0xDD, 0xA4, 0x72, 0xD0, 0x41, 0x02, 0x06, 0xE1, 0x11, 0x24,
+    0x3A, 0x90, 0x91, 0x78, 0x55, 0xCA, 0xB9, 0xA9, 0xE7, 0x46, 0xCA, 0xA8, 0xF3, 0xFA, 0x77, 0x28,
+    0x1B, 0x7A, 0x2E, 0x13, 0x89, 0xD7, 0x75, 0xCE, 0x42, 0x80, 0x3B, 0xB6, 0xD7, 0x4E, 0x0B, 0x33,
+    0xD9, 0xD8, 0x6B, 0x0B, 0x4A, 0x00, 0x9A, 0x85, 0xC4, 0x73, 0x96, 0x4A, 0xA3, 0x4D, 0xEE, 0x4D,
+    0x48, 0x78, 0x29, 0x15, 0x84, 0x90, 0x8C, 0xF6, 0x52, 0x66, 0x90, 0x18, 0x90, 0xEA, 0x7A, 0x92,
+    0x52, 0xEB, 0xA5, 0xCA, 0x8E, 0xA3, 0x24, 0xDB, 0x21, 0xB8, 0x48, 0x65, 0xB4, 0x8E, 0xAC, 0xAC,
+    0x04, 0x6C, 0x2D, 0x72, 0x18, 0x09, 0xE8, 0x82, 0xE6, 0xEF, 0x63, 0xC5, 0xD2, 0x74, 0x29, 0xF7,
+    0x66, 0x9B, 0x00, 0xF9, 0x54, 0x4D, 0xD6, 0x59, 0x9C, 0xD9, 0x21, 0xAF, 0xAF, 0xE0, 0x28, 0x7A,
+    0xFE, 0xD3, 0x58, 0x43, 0x92, 0xD1, 0xA8, 0xAF, 0x07, 0x78, 0x84, 0x2F, 0xD5, 0xD9, 0x54, 0x98,
+    0x97, 0x57, 0x80, 0x37, 0x1F, 0x42, 0xCA, 0x37, 0xBC, 0xA8, 0xE5, 0xBC, 0x47, 0xAB, 0x03, 0x9D,
+    0x8A, 0xB8, 0xC5, 0x9A, 0x04, 0x3D, 0x6B, 0x6F, 0x1F, 0xC5, 0x22, 0xA1, 0xCE, 0x9E, 0xC0, 0x61,
+    0x4C, 0x8F, 0x11, 0x4F, 0xEB, 0xDB, 0x91, 0xBF, 0x82, 0x6D, 0x74, 0x07, 0x04, 0xB6, 0x41, 0xE7,
+    0xDD, 0x1A, 0xF9, 0x0A, 0x81, 0x7E, 0xBD, 0x2D, 0x63, 0x15, 0x5A, 0x67, 0x8B, 0xBC, 0x6F, 0xB3,
+    0x43, 0xA3, 0xA5, 0x54, 0x81, 0xA8, 0xB6, 0x5C, 0x90, 0x8C, 0xCF, 0xD6, 0x66, 0x24, 0x64, 0x05,
+    0x6F, 0x46, 0x7B, 0x3A, 0xB5, 0xFE, 0x63, 0xF4, 0xDD, 0x22, 0x95, 0x06, 0x98, 0xB7, 0x9E, 0xD0,
+    0x78, 0xC0, 0x6F, 0x40, 0x01, 0xF7, 0x71, 0xCC, 0x49, 0x7E, 0x53, 0xC6, 0x4B, 0x79, 0x90, 0x76,
+    0x42, 0x68, 0x77, 0x90, 0xA4, 0x16, 0x61, 0xD6, 0x0E, 0xD9, 0x47, 0x74, 0x34, 0x63, 0xE1, 0x42,
+    0xF0, 0x43, 0x6D, 0x48, 0x21, 0x5A, 0x0C, 0xEF, 0x39, 0x6A, 0x1E, 0x05, 0xEC, 0xE3, 0xD3, 0x71,
+    0x71, 0x87, 0xE8, 0x35, 0x60, 0x55, 0x18, 0x71, 0xB8, 0x43, 0xEF, 0xE0, 0xA0, 0x4F, 0x97, 0xD6,
+    0xE9, 0x33, 0xDF, 0xFC, 0x86, 0x50, 0x61, 0x42, 0xF7, 0xD2, 0xC1, 0xE4, 0xBB, 0x69, 0xFF, 0xF8,
+    0x00, 0xF8, 0x9B, 0x01, 0x89, 0x3E, 0xA1, 0x17, 0x5D, 0x7F, 0x02, 0xAD, 0x55, 0xB1, 0x8E, 0x1D,
+    0x35, 0x14, 0xBD, 0x33, 0x93, 0x95, 0x11, 0x23, 0x31, 0x5B, 0x64, 0x11, 0x82, 0xC2, 0x88, 0x92,
+    0x82, 0xF9, 0x01, 0x16, 0x4F, 0xF6, 0x7D, 0x40, 0xB6, 0x48, 0x47, 0xB1, 0xFC, 0xC1, 0xFE, 0x40,
+    0x82, 0x67, 0x97, 0x0F, 0x58, 0x2A, 0x5A, 0x68, 0x68, 0x22, 0x24, 0x28, 0x28, 0x28, 0x42, 0x3C,
+    0x49, 0x8A, 0x14, 0x34, 0x13, 0x22, 0xFA, 0x81, 0x15, 0x82, 0x2E, 0x8E, 0xE4, 0x95, 0x9C, 0x95,
+    0xC7, 0x97, 0x73, 0xFD, 0x36, 0x20, 0x90, 0xA0, 0xE2, 0xBD, 0xE7, 0x27, 0xCF, 0x1D, 0xDF, 0xE3,
+    0xEB, 0x7B, 0xCF, 0x3D, 0xDE, 0x21, 0xA2, 0x8A, 0x6C, 0xC3, 0xB3, 0xAB, 0xB9, 0xCD, 0x2A, 0xBD,
+    0x9A, 0x95, 0x37, 0xDF, 0x50, 0xD2, 0x0F, 0x03, 0x51, 0xB4, 0xDD, 0x48, 0xF5, 0xE5, 0x9A, 0x88,
+    0x3A, 0x66, 0x18, 0xDC, 0xF1, 0x0F, 0x9E, 0x14, 0xCC, 0x0B, 0x99, 0x07, 0xA9, 0x9F, 0x6B, 0x59,
+    0x3D, 0xF5, 0xDE, 0x7A, 0xFB, 0x80, 0x1B, 0x9E, 0xDC, 0x74, 0x08, 0xC0, 0x5D, 0xA2, 0xBD, 0xA1,
+    0xE2, 0xB5, 0x62, 0x9E, 0xD7, 0x36, 0xBE, 0x42, 0x99, 0xC8, 0x02, 0x61, 0x68, 0x78, 0xA1, 0xD7,
+    0x73, 0x45, 0xE6, 0xD1, 0xDC, 0x3D, 0x5F, 0x55, 0x34, 0x9C, 0x6A, 0x8E, 0x54, 0x0D, 0x64, 0x72,
+    0xC7, 0x37, 0x79, 0xC3, 0x93, 0x1D, 0xCC, 0xA8, 0xE7, 0x7E, 0x51, 0xA1, 0x8F, 0xD5, 0xDA, 0x67,
+    0xB2, 0xC7, 0x30, 0x70, 0xB7, 0x28, 0x6E, 0x62, 0xC5, 0x80, 0x92, 0x15, 0x2E, 0xF4, 0xAB, 0xB8,
+    0x0C, 0x24, 0x9F, 0xBE, 0xF6, 0xD4, 0xCE, 0x89, 0xAA, 0x8C, 0x8D, 0x74, 0xA6, 0x3F, 0x3F, 0x1C,
+    0xCD, 0x6A, 0xD6, 0x8E, 0xAB, 0xB5, 0xF8, 0x39, 0x20, 0x3B, 0x20, 0x3B, 0x20, 0xDF, 0x83, 0x21,
+    0x01, 0x39, 0x01, 0x39, 0x01, 0x19, 0x2B, 0x6A, 0x24, 0x21, 0x88, 0x0B, 0x3C, 0x0F, 0x4D, 0x6E,
+    0x02, 0x5C, 0x23, 0xE2, 0xF8, 0x5D, 0x05, 0x43, 0x2A, 0xDC, 0x23, 0x75, 0x19, 0x49, 0x71, 0x22,
+    0x75, 0x91, 0xF1, 0xEC, 0x06, 0xD8, 0x27, 0xBC, 0x5F, 0x7A, 0xAC, 0xC3, 0xFA, 0xE2, 0xA7, 0x98,
+    0x13, 0x46, 0xA4, 0x3B, 0x7A, 0xA6, 0xDB, 0x57, 0xE3, 0x1E, 0xC6, 0x77, 0x18, 0x11, 0x23, 0xE8,
+    0xF9, 0x1D, 0xAF, 0x67, 0xBB, 0xE8, 0xC5, 0x4D, 0x9C, 0xEC, 0x01, 0xA7, 0xEB, 0x70, 0x34, 0x89,
+    0x4C, 0x74, 0x01, 0x31, 0x58, 0xDF, 0xA5, 0x0A, 0xA1, 0x78, 0xF5, 0xEC, 0x93, 0x67, 0x93, 0xB6,
+    0xEF, 0x59, 0xBA, 0xF3, 0xF1, 0x45, 0xAA, 0x02, 0x3F, 0xF6, 0xEA, 0xC7, 0x55, 0x4F, 0x7A, 0xE3,
+    0x61, 0x6A, 0x6F, 0x24, 0x95, 0x09, 0x69, 0xC0, 0xE2, 0x28, 0xB9, 0x38, 0x43, 0xFA, 0x66, 0x24,
+    0x67, 0xD2, 0x73, 0xE7, 0x55, 0x68, 0x60, 0xBF, 0xCB, 0x64, 0x99, 0x27, 0xFD, 0xEB, 0xD1, 0xD6,
+    0xB0, 0x12, 0x4B, 0xFA, 0x26, 0x17, 0xB7, 0xE9, 0x1B, 0x69, 0xE7, 0x90, 0xA4, 0x02, 0x28, 0x44,
+    0xB3, 0x6A, 0x84, 0xA6, 0x3D, 0xA3, 0x3A, 0x89, 0xB8, 0xF3, 0x4D, 0x32, 0x53, 0x57, 0x1E, 0x73,
+    0x95, 0x55, 0xD6, 0xBE, 0x65, 0xA6, 0x16, 0x15, 0xA4, 0x5B, 0x08, 0x97, 0x19, 0xF5, 0x02, 0xB6,
+    0x1D, 0x2D, 0xB2, 0x8A, 0x24, 0x86, 0x6D, 0x12, 0x69, 0x5B, 0xC0, 0x7F, 0x18, 0x9C, 0x14, 0x22,
+    0x6B, 0xD4, 0x6B, 0xB8, 0x5E, 0xF1, 0xE7, 0x19, 0x50, 0x59, 0xF1, 0xD7, 0xA9, 0x0D, 0x5D, 0xE8,
+    0xA7, 0x7E, 0x71, 0x64, 0x4F, 0x53, 0x95, 0x5B, 0xAF, 0x62, 0x8F, 0xF8, 0x1D, 0x71, 0x9D, 0x3F,
+    0x8C, 0x58, 0x35, 0xF6, 0xA0, 0x9D, 0xBB, 0x45, 0x35, 0x28, 0xD8, 0x7A, 0xEC, 0xBB, 0xA0, 0x02,
+    0x81, 0xDE, 0xBC, 0x3B, 0x12, 0xED, 0x0C, 0xD4, 0x23, 0x3C, 0x5E, 0xCC, 0xD3, 0x84, 0x84, 0x76,
+    0xFE, 0xB5, 0x06, 0xAB, 0x18, 0x8B, 0x26, 0xEA, 0x02, 0xCE, 0x05, 0xD6, 0x5D, 0x7E, 0x25, 0x51,
+    0x5B, 0x6C, 0x7C, 0x4B, 0x62, 0x8E, 0x08, 0xF9, 0xFC, 0xE7, 0xAC, 0xCF, 0x36, 0x71, 0x7F, 0xBF,
+    0x5B, 0xFC, 0xAE, 0x39, 0x21, 0x61, 0x67, 0x13, 0xC1, 0x70, 0x9C, 0xCC, 0x8C, 0xE5, 0xB1, 0x67,
+    0xD0, 0x17, 0x91, 0x73, 0xC7, 0x9A, 0x4F, 0x79, 0xE4, 0xA1, 0x1F, 0xF5, 0xD2, 0x4D, 0x4D, 0x52,
+    0x0B, 0xB9, 0x4D, 0xC0, 0xDA, 0x84, 0x90, 0xBE, 0x87, 0x83, 0x95, 0xD6, 0x18, 0xA8, 0xE2, 0xA9,
+    0x04, 0x47, 0x0A, 0x41, 0x56, 0xA0, 0x34, 0x81, 0x8E, 0xBF, 0x80, 0x11, 0x8C, 0xD1, 0x63, 0xD4,
+    0xB1, 0x30, 0xF2, 0x9A, 0xD0, 0x15, 0xD3, 0x4A, 0xF2, 0x48, 0x16, 0xDB, 0xC9, 0x7E, 0x65, 0xFF,
+    0x12, 0x40, 0x8B, 0x6D, 0x6B, 0x96, 0x73, 0x9F, 0xBF, 0xE0, 0x93, 0xB5, 0x5B, 0x50, 0x08, 0x73,
+    0xB2, 0x9A, 0x29, 0x37, 0x11, 0xBF, 0xEE, 0x1C, 0x7C, 0x35, 0x67, 0x62, 0xEA, 0x97, 0x8C, 0x57,
+    0xBF, 0xBD, 0x90, 0x0C, 0xB0, 0xA7, 0xB7, 0x64, 0xA3, 0xBF, 0x63, 0x91, 0xFD, 0x54, 0x82, 0xC3,
+    0xEC, 0xDD, 0xBB, 0xE8, 0x30, 0x30, 0xC5, 0x44, 0x1D, 0x54, 0xD2, 0x53, 0x9D, 0x0D, 0x7A, 0x19,
+    0xC9, 0xEA, 0xD1, 0xD3, 0x9D, 0xA4, 0x15, 0x3E, 0xF7, 0xB1, 0x73, 0x74, 0x43, 0xEB, 0xCD, 0x6C,
+    0x82, 0x4D, 0x2E, 0x72, 0x32, 0xDC, 0x83, 0x54, 0x4F, 0x18, 0xC5, 0x54, 0x11, 0x85, 0xB4, 0xE3,
+    0x7F, 0x4D, 0xA2, 0x8A, 0x12, 0x7A, 0x12, 0x6E, 0x20, 0x1B, 0x55, 0x92, 0x38, 0xE4, 0x84, 0x25,
+    0x20, 0x69, 0xD5, 0xB7, 0x5D, 0xC2, 0x37, 0xDA, 0xD8, 0x79, 0x21, 0xE9, 0x5F, 0x03, 0x1D, 0x33,
+    0xC3, 0x77, 0xA6, 0xBD, 0xE3, 0x19, 0x2D, 0xBC, 0x1D, 0x15, 0x5A, 0xAD, 0x01, 0xDC, 0x6A, 0x2F,
+    0xD8, 0xF3, 0x73, 0x7E, 0xCC, 0xA3, 0xAD, 0x92, 0x0A, 0x18, 0xE2, 0xE2, 0x35, 0xC4, 0x02, 0x03,
+    0x24, 0xFB, 0x37, 0xF3, 0x8D, 0x55, 0x05, 0xD4, 0xFF, 0x2A, 0x26, 0xF6, 0xFF, 0x07, 0x54, 0x2E,
+    0x50, 0xA5, 0x9A, 0xED, 0x52, 0xD4, 0xA7, 0x88, 0xD0, 0xED, 0x52, 0x5E, 0x2F, 0x7F, 0xD5, 0x60,
+    0x50, 0x0C, 0x83, 0x35, 0x1F, 0xE0, 0x14, 0xFB, 0x18, 0xEF, 0xEB, 0x9F, 0x86, 0x6B, 0x1A, 0x06,
+    0x8D, 0x17, 0x7A, 0x66, 0x12, 0x8A, 0x97, 0xF1, 0x24, 0x93, 0x63, 0x74, 0x6A, 0xA1, 0x03, 0x7C,
+    0x06, 0xCD, 0x8F, 0x30, 0x67, 0xE8, 0x0E, 0xD5, 0xD8, 0x16, 0x14, 0x9F, 0xD5, 0xC5, 0xA1, 0x4C,
+    0x79, 0xE9, 0x25, 0x4F, 0x07, 0x98, 0x6E, 0x20, 0xBD, 0x10, 0x9E, 0x87, 0x98, 0x1E, 0x94, 0xA9,
+    0x3D, 0x5D, 0x91, 0x3E, 0xEF, 0x70, 0xCE, 0xA8, 0x25, 0xF9, 0x5B, 0x30, 0xD1, 0x5B, 0x00, 0x09,
+    0x0C, 0x40, 0x04, 0x02, 0x00, 0x23, 0xDC, 0xE1, 0x3C, 0xC1, 0x55, 0x1C, 0x25, 0x2D, 0xDB, 0xE3,
+    0xD0, 0x1E, 0x52, 0x2E, 0x38, 0xF3, 0xAA, 0xD2, 0x1B, 0xE4, 0x06, 0xB0, 0xA8, 0xE3, 0xD8, 0x80,
+    0x92, 0x7B, 0xF6, 0x84, 0xF4, 0xD3, 0xB9, 0xBD, 0x12, 0x6D, 0x05, 0x87, 0x9D, 0x72, 0xEC, 0x1D,
+    0xD9, 0x03, 0x42, 0x62, 0x56, 0x25, 0x7D, 0x36, 0xF0, 0x51, 0x2C, 0xD8, 0x13, 0x36, 0x69, 0x44,
+    0x08, 0x47, 0x3C, 0x70, 0xAC, 0x93, 0x7A, 0xE1, 0x64, 0x5A, 0xAC, 0x01, 0x0C, 0x1B, 0x21, 0x7C,
+    0x47, 0x1E, 0xCA, 0xC9, 0x2B, 0x10, 0xD0, 0xC7, 0x65, 0x7F, 0x84, 0xCA, 0x01, 0x57, 0xCD, 0xE8,
+    0x36, 0x11, 0x6C, 0x5F, 0xC0, 0xF0, 0x11, 0x44, 0x2F, 0xC9, 0x44, 0xA3, 0x13, 0x14, 0xBB, 0xF3,
+    0x48, 0xD9, 0x26, 0xB6, 0xD1, 0x24, 0xDC, 0x39, 0x61, 0x57, 0x1C, 0x3F, 0x22, 0xDA, 0x07, 0x65,
+    0xA6, 0xC2, 0x39, 0x0D, 0xCA, 0x8D, 0x57, 0xE7, 0x21, 0x17, 0x09, 0x64, 0xCC, 0x6D, 0xB0, 0x94,
+    0xCD, 0x68, 0xCE, 0xD0, 0xFE, 0x28, 0x5E, 0x7E, 0xA9, 0x11, 0x15, 0x7F, 0xF9, 0xAD, 0x91, 0x33,
+    0xAF, 0x54, 0x1D, 0x16, 0x9F, 0xD4, 0x0F, 0xF6, 0xE6, 0xD2, 0x3D, 0x0A, 0x34, 0x14, 0x68, 0xE8,
+    0x46, 0xCD, 0x4B, 0xC3, 0xB8, 0x7D, 0xFA, 0x27, 0xB8, 0x28, 0x32, 0x09, 0x01, 0x04, 0x27, 0x6E,
+    0xB5, 0x66, 0x26, 0x95, 0x3F, 0x9B, 0x71, 0x3B, 0xB6, 0xD0, 0x25, 0x49, 0xCA, 0x2E, 0x55, 0x6E,
+    0x2E, 0xA2, 0xA0, 0xD0, 0x92, 0xC7, 0x97, 0x5F, 0xD4, 0xD2, 0x0E, 0xC8, 0x66, 0xD1, 0xB0, 0xE7,
+    0x22, 0x69, 0x38, 0x1F, 0x43, 0xE1, 0x9A, 0xB5, 0x0D, 0x6D, 0xEC, 0x67, 0xDC, 0x04, 0x03, 0x2A,
+    0x08, 0xFD, 0x43, 0x2F, 0xE1, 0xF1, 0x1C, 0x3A, 0x7E, 0xC4, 0xA7, 0xE9, 0xAA, 0x37, 0x47, 0xF1,
+    0x14, 0x4C, 0xB9, 0xDA, 0x7A, 0x1C, 0xAD, 0x1A, 0x4B, 0x4F, 0xDD, 0xC7, 0x3B, 0x18, 0xA0, 0x2D,
+    0x2F, 0xEF, 0xBB, 0x6D, 0x64, 0xB3, 0x3D, 0x0D, 0x7A, 0xB9, 0xA3, 0x62, 0x57, 0xE5, 0x1A, 0x8D,
+    0x49, 0x1A, 0x2C, 0x80, 0x24, 0xE5, 0x22, 0x38, 0x4E, 0x04, 0x63, 0x7A, 0xE9, 0xF1, 0x07, 0x95,
+    0x55, 0xBF, 0x6F, 0xE5, 0x44, 0x10, 0x1E, 0xDB, 0x49, 0x8C, 0x64, 0x09, 0xA7, 0x08, 0x12, 0x3A,
+    0x24, 0x8C, 0x10, 0x0D, 0xA2, 0xD8, 0x86, 0xF2, 0xC4, 0x2E, 0x9C, 0x10, 0x25, 0x29, 0xF2, 0x2A,
+    0xFE, 0x83, 0x2B, 0x48, 0x43, 0x79, 0xC7, 0x9A, 0x5C, 0x49, 0x93, 0x26, 0xA2, 0xE4, 0x4A, 0x38,
+    0x09, 0xD1, 0x50, 0x9E, 0xB2, 0x4E, 0x52, 0x5C, 0x89, 0x4F, 0x08, 0x9D, 0x10, 0x45, 0x7C, 0x27,
+    0x40, 0x88, 0x34, 0xCE, 0xC9, 0x88, 0xBD, 0xB0, 0xBB, 0xC3, 0x37, 0x7E, 0x4F, 0x17, 0x7E, 0x49,
+    0x08, 0xBF, 0xB7, 0x6B, 0xEF, 0x7A, 0x76, 0x7E, 0x7C, 0xF3, 0xCD, 0x98, 0xD6, 0x0D, 0x29, 0x6E,
+    0x35, 0x7B, 0xDD, 0x1E, 0x36, 0x5D, 0x5D, 0x8F, 0x54, 0xA4, 0x2F, 0x88, 0xD9, 0xE8, 0x5F, 0xDA,
+    0x79, 0x41, 0x64, 0x9F, 0xBC, 0x5F, 0x63, 0xC3, 0x71, 0x9B, 0xED, 0x10, 0x2D, 0xA8, 0xE1, 0xBD,
+    0xC4, 0x75, 0x77, 0xD3, 0xD2, 0x39, 0xB7, 0x05, 0x4F, 0x05, 0xFB, 0x9C, 0x27, 0x63, 0xCF, 0x5A,
+    0xED, 0x4C, 0x74, 0xFC, 0x90, 0x13, 0xAD, 0x13, 0x91, 0xC9, 0x22, 0xB9, 0x4E, 0x0D, 0xD9, 0x3E,
+    0xC9, 0xE5, 0x06, 0xEB, 0xF3, 0x44, 0xB6, 0x6D, 0x86, 0xD2, 0x67, 0x97, 0x0F, 0x38, 0xCB, 0x91,
+    0xA8, 0xBC, 0xEF, 0x59, 0x7D, 0xFD, 0x28, 0x6C, 0x66, 0xB3, 0x74, 0xCE, 0xAD, 0xF5, 0xE4, 0xDA,
+    0xD2, 0x43, 0xF0, 0x6F, 0x93, 0xE2, 0x6B, 0x3C, 0xD1, 0x1A, 0xA9, 0xAE, 0x9E, 0x8A, 0x48, 0xAF,
+    0x8A, 0xFC, 0x66, 0x13, 0x6A, 0x26, 0xDB, 0x55, 0x63, 0x1E, 0xC8, 0xE1, 0xD5, 0x5F, 0x1F, 0x98,
+    0x74, 0xAB, 0x7B, 0x3B, 0xD8, 0xB1, 0xDA, 0xA7, 0x92, 0xD9, 0xCB, 0x34, 0x11, 0xDD, 0x54, 0x1D,
+    0xD1, 0x0D, 0x99, 0xEE, 0xAA, 0x6F, 0x65, 0xE2, 0x91, 0xBC, 0x3A, 0x0B, 0x98, 0x8E, 0x62, 0x36,
+    0xA9, 0x2E, 0xBE, 0x3C, 0x62, 0xB2, 0x83, 0x3A, 0x0E, 0xAE, 0x73, 0xEC, 0xAD, 0x61, 0xDE, 0xDF,
+    0x12, 0x8B, 0x3A, 0x35, 0x6C, 0x0A, 0xBE, 0x8F, 0x13, 0xE5, 0x54, 0x78, 0xE0, 0x64, 0x74, 0x2B,
+    0x8F, 0x4F, 0xB6, 0xC9, 0x32, 0xF3, 0x00, 0x0B, 0x09, 0x51, 0x1C, 0xB8, 0xBD, 0x20, 0x02, 0x4D,
+    0x07, 0x81, 0x8F, 0xE6, 0x47, 0x7D, 0xCC, 0x03, 0xF3, 0x28, 0x1A, 0x3C, 0x2D, 0xAF, 0x4D, 0xA2,
+    0x17, 0x80, 0x42, 0xCD, 0x06, 0x8A, 0x7A, 0xA2, 0xDD, 0x8B, 0xDB, 0x48, 0x4C, 0x00, 0x6C, 0xD8,
+    0x10, 0xFF, 0x2A, 0x80, 0x9D, 0x8B, 0xE3, 0x8E, 0x99, 0xD4, 0xA0, 0xFB, 0x6A, 0xAA, 0xA6, 0x3C,
+    0x0A, 0xC6, 0xC6, 0x1A, 0xD5, 0x37, 0xD8, 0x28, 0xE7, 0x8D, 0x1C, 0x3E, 0x9D, 0xB3, 0x97, 0xC3,
+    0xAF, 0x40, 0xF3, 0x4D, 0x0C, 0x68, 0xCE, 0x60, 0xA9, 0x18, 0x70, 0x6F, 0x57, 0x16, 0x69, 0x5B,
+    0xA7, 0x62, 0xD2, 0xB1, 0xF6, 0xE5, 0xA4, 0x7E, 0x2E, 0x27, 0x0D, 0xDF, 0xEF, 0x52, 0x79, 0x21,
+    0xD0, 0x04, 0x2A, 0x7F, 0x4D, 0x58, 0x3B, 0x83, 0xFD, 0x0E, 0xEF, 0x07, 0x05, 0x39, 0xC8, 0x47,
+    0x39, 0x47, 0xCF, 0x60, 0xAE, 0xE0, 0x93, 0x44, 0x0D, 0x60, 0x91, 0xAD, 0x11, 0x0F, 0xCF, 0xD3,
+    0xD3, 0x4B, 0xA7, 0x9A, 0xDF, 0x45, 0x96, 0x24, 0xE4, 0xB6, 0xE9, 0xD5, 0x00, 0x15, 0x3E, 0x8B,
+    0x0A, 0x59, 0xDF, 0xC5, 0x06, 0xD7, 0x00, 0xA7, 0xF0, 0x19, 0x53, 0x9A, 0x51, 0x73, 0x93, 0x8A,
+    0x72, 0xC4, 0xCC, 0x87, 0x6F, 0x40, 0xB5, 0xBA, 0x36, 0xCE, 0xAE, 0x90, 0xF5, 0x4F, 0x95, 0x66,
+    0x1C, 0x74, 0xB0, 0xA9, 0x12, 0x2F, 0x0E, 0x41, 0x03, 0x4D, 0xF5, 0xD8, 0xB4, 0x79, 0xAC, 0x7B,
+    0xD2, 0xB7, 0x46, 0xAA, 0x1E, 0x23, 0x9F, 0x11, 0x41, 0x6B, 0x61, 0x13, 0xE3, 0x00, 0xC3, 0xB3,
+    0x06, 0x6E, 0x96, 0x03, 0xAD, 0x15, 0xD0, 0xF7, 0xF1, 0x44, 0x85, 0x24, 0xDD, 0x61, 0x54, 0x83,
+    0xB8, 0xC9, 0x0A, 0x6E, 0xBE, 0x83, 0x24, 0x19, 0xB0, 0xB1, 0x07, 0x1F, 0x27, 0x30, 0x32, 0x0A,
+    0x39, 0xFF, 0xB1, 0xD1, 0xDA, 0x16, 0xC8, 0x07, 0x8D, 0xCC, 0x12, 0x05, 0x39, 0xBC, 0x02, 0x21,
+    0x17, 0x4D, 0xAF, 0x63, 0x5C, 0xBF, 0x63, 0xA0, 0x5F, 0xA0, 0x16, 0xC3, 0x99, 0x78, 0x02, 0xE1,
+    0x16, 0x23, 0x15, 0x3F, 0xB8, 0xB7, 0xA7, 0xFA, 0xCD, 0x50, 0xF4, 0x57, 0xCB, 0xB1, 0x5E, 0x7A,
+    0x45, 0x36, 0x19, 0x88, 0x72, 0x8F, 0x40, 0x31, 0x81, 0x1E, 0x1D, 0x59, 0x10, 0x35, 0x0B, 0x05,
+    0xE0, 0x1F, 0x51, 0x7C, 0xEA, 0x27, 0x36, 0x33, 0x4D, 0x15, 0x2A, 0x6A, 0x79, 0x5D, 0x69, 0x51,
+    0x19, 0xDD, 0x3C, 0x66, 0x56, 0x60, 0x68, 0x61, 0x12, 0xC6, 0x55, 0x75, 0x24, 0x63, 0xD8, 0x9A,
+    0xF7, 0xBF, 0x93, 0xBA, 0xC6, 0xC9, 0x07, 0x01, 0x32, 0x69, 0x39, 0x8E, 0x23, 0xCC, 0xA1, 0x56,
+    0x79, 0x59, 0x90, 0x1B, 0x17, 0x86, 0x2A, 0x16, 0x0E, 0xC3, 0x69, 0x36, 0x76, 0x54, 0x3D, 0xF1,
+    0x2D, 0xD8, 0x0E, 0xD6, 0x90, 0xFE, 0x1E, 0xC5, 0x1F, 0xE1, 0x3B, 0x9F, 0x62, 0x44, 0x3E, 0x58,
+    0xD8, 0x53, 0xC0, 0x17, 0x5C, 0x4B, 0xFA, 0x1E, 0x64, 0x26, 0x3D, 0x12, 0x67, 0xFC, 0xA3, 0xEB,
+    0xE0, 0x21, 0xC0, 0x17, 0x22, 0xAF, 0x6F, 0xD3, 0x3C, 0xE5, 0x58, 0x68, 0x0E, 0x85, 0xAF, 0x27,
+    0xB4, 0x94, 0x11, 0x96, 0x4F, 0xE2, 0xC2, 0xD5, 0x82, 0xDE, 0xC1, 0x7B, 0xF3, 0x32, 0x50, 0x2A,
+    0x43, 0x35, 0xC2, 0x3A, 0x4E, 0x02, 0x3F, 0xF4, 0x95, 0xE7, 0x16, 0x26, 0x9B, 0x1C, 0x77, 0x55,
+    0xB0, 0x6C, 0x9A, 0x58, 0x07, 0xD2, 0xA1, 0x0C, 0x40, 0x04, 0xD9, 0x76, 0x50, 0x29, 0x1C, 0x66,
+    0x01, 0x9E, 0xDF, 0x12, 0x5A, 0x9C, 0x20, 0x87, 0xFA, 0x04, 0xB4, 0x53, 0x0F, 0x70, 0xBE, 0x3E,
+    0xEB, 0xA5, 0x76, 0x24, 0xD7, 0x82, 0x7D, 0x21, 0x4C, 0xCA, 0x85, 0x02, 0x94, 0x2E, 0x49, 0xB9,
+    0xD6, 0x70, 0xA7, 0xBE, 0xE1, 0xA1, 0xF1, 0xBA, 0xAF, 0x63, 0x19, 0x8A, 0xC7, 0xC4, 0x39, 0x20,
+    0xEA, 0x03, 0x88, 0xFC, 0x21, 0x68, 0xA1, 0x90, 0x98, 0xD3, 0x0E, 0xA7, 0xA1, 0xCC, 0x42, 0x75,
+    0x0D, 0x43, 0x79, 0x58, 0x9D, 0xAE, 0xCC, 0x07, 0x52, 0x40, 0x92, 0xF5, 0xB8, 0x2B, 0xC4, 0x12,
+    0x6B, 0xE8, 0x86, 0x2B, 0x6E, 0x2E, 0x76, 0xD6, 0x17, 0xDB, 0x0C, 0xCA, 0x47, 0x85, 0x56, 0x99,
+    0xE0, 0x2A, 0xB2, 0xA8, 0x3B, 0xDC, 0x91, 0x48, 0xEE, 0xB0, 0x00, 0x4A, 0x4C, 0xA8, 0x2C, 0x7D,
+    0x14, 0xB0, 0x79, 0x1E, 0x74, 0x57, 0xC4, 0x20, 0x2F, 0x25, 0xDF, 0x5A, 0x5A, 0x94, 0xC4, 0x2C,
+    0x92, 0xB2, 0x69, 0x0A, 0xD4, 0x71, 0x04, 0xAC, 0xA2, 0x73, 0x0E, 0xC2, 0xD1, 0xAA, 0xD8, 0xA8,
+    0x16, 0xCB, 0x65, 0x2F, 0x66, 0x87, 0xCB, 0xF0, 0x48, 0xA1, 0xBC, 0xEB, 0x2E, 0x50, 0x96, 0x20,
+    0xDF, 0xFC, 0x29, 0x70, 0x46, 0x95, 0x6B, 0xB4, 0x47, 0x50, 0x12, 0x44, 0x46, 0x53, 0x6D, 0x3A,
+    0x37, 0x94, 0xA3, 0xF3, 0x59, 0xB8, 0x8B, 0x8D, 0x80, 0x8A, 0x0C, 0xA8, 0x48, 0x24, 0x4C, 0x24,
+    0x72, 0xEE, 0x61, 0x75, 0xB2, 0xA2, 0x40, 0x9B, 0xA5, 0x35, 0x31, 0x36, 0xDB, 0x7A, 0x49, 0xF2,
+    0x84, 0xE4, 0xF6, 0xF2, 0xD5, 0x90, 0x10, 0xE9, 0xB5, 0x74, 0x1B, 0xEB, 0x71, 0x7E, 0x2E, 0xE2,
+    0x36, 0xD0, 0x93, 0x8F, 0x02, 0xBE, 0x0A, 0xA1, 0x42, 0x60, 0x79, 0x2C, 0x42, 0x16, 0x97, 0x77,
+    0xFC, 0xD2, 0xAE, 0x57, 0xE8, 0x8C, 0x7A, 0xC5, 0xE7, 0x0D, 0xF4, 0xB8, 0x00, 0x06, 0xCC, 0x3C,
+    0xAE, 0x46, 0x61, 0xEC, 0x06, 0x7F, 0xB6, 0x5A, 0xE4, 0x71, 0x07, 0xBD, 0xAE, 0x57, 0xBF, 0xC7,
+    0x6A, 0xD4, 0x7B, 0x40, 0xCA, 0x15, 0x41, 0x1D, 0x25, 0xB4, 0x56, 0x25, 0x45, 0x06, 0xA6, 0x5D,
+    0xFF, 0x5C, 0xC8, 0xDF, 0xAB, 0xD9, 0x5A, 0xE3, 0x67, 0x0B, 0x4F, 0x7F, 0xBF, 0x61, 0x6D, 0x47,
+    0x78, 0xD2, 0x17, 0xC2, 0xF1, 0xF4, 0x49, 0x0B, 0x2F, 0xCC, 0xEC, 0xE5, 0xEC, 0x29, 0x6C, 0x22,
+    0x0A, 0x89, 0x84, 0xCC, 0x56, 0xC6, 0x9F, 0x26, 0x90, 0x31, 0x95, 0xFC, 0x65, 0xA8, 0xA6, 0x1A,
+    0x7D, 0x5F, 0x0D, 0x8E, 0xEC, 0x5E, 0xC8, 0x52, 0x35, 0x96, 0x5E, 0xDD, 0x6B, 0x7A, 0xF7, 0x2C,
+    0xE7, 0x51, 0x4D, 0x90, 0x6A, 0xA5, 0x2F, 0xBB, 0x9D, 0xAF, 0x40, 0x8D, 0x1E, 0x7E, 0x92, 0x1E,
+    0xC0, 0xBA, 0x89, 0xAE, 0xDC, 0x91, 0xDC, 0x48, 0x7B, 0x7D, 0x03, 0xFA, 0x1F, 0x2E, 0x16, 0x87,
+    0x70, 0xEE, 0x11, 0x6A, 0xA7, 0x88, 0x0B, 0x03, 0x26, 0x88, 0xD9, 0xFF, 0xBA, 0x45, 0xB0, 0x36,
+    0xC1, 0xA9, 0x55, 0x5A, 0x5F, 0x84, 0x93, 0x78, 0x01, 0x3D, 0xF8, 0x97, 0x7E, 0x1D, 0x5F, 0xBF,
+    0x7F, 0xFD, 0x2B, 0xEE, 0xF4, 0x4C, 0xC7, 0xFF, 0x7D, 0xFD, 0x01, 0xB5, 0x55, 0x31, 0x8F, 0x1D,
+    0x35, 0x10, 0x9E, 0x7D, 0x9B, 0xC4, 0x51, 0x2C, 0xE1, 0x14, 0x39, 0x28, 0x97, 0x82, 0x2E, 0xC5,
+    0xB6, 0x14, 0xB9, 0xF3, 0x9E, 0x28, 0x53, 0xE4, 0x09, 0xE5, 0x89, 0x82, 0x3F, 0x40, 0x77, 0x2D,
+    0x12, 0x70, 0x5E, 0x94, 0x82, 0x82, 0x02, 0x1A, 0x7A, 0xEA, 0x50, 0xE4, 0x7E, 0x40, 0xC8, 0x3A,
+    0xB9, 0x92, 0x82, 0xA5, 0x88, 0xD2, 0xAE, 0x80, 0x22, 0xBA, 0xCA, 0x97, 0x33, 0xB0, 0x9C, 0xBC,
+    0x1E, 0xBE, 0xF1, 0x3B, 0x38, 0x21, 0x44, 0x85, 0x58, 0x69, 0xBD, 0x5E, 0x7B, 0x3C, 0xF3, 0xCD,
+    0xCC, 0x37, 0xE3, 0x9D, 0xCD, 0x66, 0xCD, 0xCC, 0x3F, 0xE2, 0xED, 0x79, 0xF3, 0x6D, 0x9D, 0xAA,
+    0x68, 0x82, 0xF2, 0xD6, 0xBF, 0x46, 0x4C, 0xF4, 0x46, 0x5E, 0x13, 0xF3, 0x58, 0xB9, 0xE7, 0x24,
+    0xBF, 0x75, 0x22, 0x32, 0x81, 0xC8, 0x7A, 0xFC, 0x76, 0xD4, 0xF2, 0x84, 0xDD, 0x9E, 0x2C, 0xF3,
+    0x17, 0xCC, 0x93, 0xFB, 0x74, 0x6E, 0xA6, 0x5D, 0x35, 0x9B, 0x2A, 0x93, 0xE2, 0x44, 0x8F, 0xCE,
+    0x49, 0xCD, 0x84, 0x1F, 0x72, 0x3D, 0x0D, 0x0C, 0x31, 0x4F, 0x3B, 0x30, 0x67, 0x98, 0xD3, 0x0A,
+    0xF6, 0xC8, 0xC4, 0xC6, 0xD7, 0x69, 0x15, 0xA0, 0xFA, 0xC3, 0xA2, 0x53, 0x74, 0xD7, 0x5C, 0xB4,
+    0x42, 0xFC, 0x84, 0x03, 0xA0, 0x2C, 0x30, 0x3A, 0x78, 0x08, 0x07, 0x0B, 0x61, 0x13, 0x89, 0x5B,
+    0xF6, 0xF6, 0x7B, 0x0E, 0xCD, 0x44, 0xA4, 0x71, 0x00, 0x36, 0x48, 0x03, 0x18, 0x2C, 0x52, 0xFB,
+    0x33, 0xC9, 0x63, 0xC5, 0x19, 0x5E, 0xC8, 0x75, 0xB1, 0x4A, 0xB5, 0x57, 0x90, 0x6A, 0x9E, 0xAF,
+    0xC9, 0x71, 0xAC, 0x78, 0x88, 0x2A, 0x34, 0xA1, 0xF1, 0xED, 0xE8, 0xC8, 0x7D, 0xCE, 0x5D, 0xB6,
+    0xB9, 0x8E, 0xD8, 0x1F, 0x89, 0x06, 0x58, 0x87, 0x32, 0xE7, 0xA9, 0x85, 0xAE, 0xC3, 0x8E, 0x56,
+    0xFD, 0xD5, 0xCD, 0xFA, 0x5A, 0x6F, 0xA2, 0xE1, 0xD0, 0x4E, 0x26, 0x69, 0xEE, 0x5D, 0x30, 0x99,
+    0x32, 0x01, 0xA3, 0xA5, 0x5C, 0x41, 0xBA, 0xE9, 0x73, 0x0D, 0xFD, 0xDA, 0x67, 0x0D, 0x15, 0x75,
+    0xC8, 0x06, 0x8E, 0x88, 0x7B, 0x1D, 0xA0, 0xE1, 0x53, 0xDC, 0xCA, 0x02, 0xB6, 0x9D, 0x32, 0xE0,
+    0x43, 0x7D, 0x56, 0x02, 0x17, 0xE7, 0x32, 0x04, 0xA1, 0x85, 0x3B, 0xBD, 0x20, 0x9E, 0xC3, 0xD8,
+    0xCE, 0x30, 0x64, 0xA3, 0x9B, 0x1A, 0xB8, 0xBE, 0x5C, 0x85, 0x06, 0xAA, 0x96, 0xE2, 0x11, 0xA5,
+    0xED, 0xE7, 0xF1, 0xF6, 0xF3, 0xF1, 0xF6, 0xF3, 0xF6, 0xF6, 0x43, 0x57, 0x45, 0x90, 0x5C, 0xCD,
+    0xE3, 0xB0, 0x62, 0x0D, 0xF5, 0x37, 0xB2, 0x0A, 0xF6, 0x88, 0x52, 0xF3, 0x0C, 0x06, 0x67, 0x67,
+    0x7A, 0x5A, 0x9D, 0x2F, 0x92, 0x3C, 0x66, 0x2C, 0x0C, 0x07, 0xDF, 0x05, 0x84, 0xCD, 0x19, 0x38,
+    0xF1, 0x34, 0xB5, 0xE3, 0x4A, 0xA4, 0x7D, 0x1B, 0x5C, 0x70, 0x4F, 0xB9, 0x66, 0x3F, 0xF8, 0x35,
+    0x14, 0xBA, 0x4B, 0xBB, 0xF5, 0x24, 0xA3, 0x16, 0x3C, 0x74, 0x9D, 0xE8, 0xF6, 0x4B, 0x6A, 0x10,
+    0x5D, 0x44, 0xB8, 0x0E, 0x3A, 0x99, 0xDE, 0x84, 0x5D, 0xA4, 0xEF, 0xA6, 0x40, 0x45, 0x06, 0x2D,
+    0x88, 0x82, 0xF4, 0xD1, 0xFB, 0x42, 0x18, 0x2C, 0xE9, 0xF9, 0x0E, 0xB5, 0x3F, 0x25, 0xE2, 0x7B,
+    0xB3, 0x4E, 0x2D, 0x02, 0xD2, 0x30, 0x58, 0xE1, 0xB6, 0x5E, 0xBC, 0x1B, 0x10, 0x02, 0x5F, 0xF2,
+    0x57, 0x61, 0x65, 0xA7, 0xAB, 0x78, 0xA9, 0xC0, 0xB8, 0x45, 0xCF, 0xD7, 0x49, 0x98, 0x03, 0xC8,
+    0x5D, 0x8D, 0x68, 0xBF, 0x9E, 0x2B, 0xB2, 0xC7, 0xA3, 0x39, 0x5D, 0xD4, 0x6C, 0x85, 0x3F, 0x33,
+    0x81, 0x38, 0x50, 0x71, 0xED, 0x50, 0x82, 0x48, 0x7B, 0x1D, 0xB8, 0xD5, 0xDD, 0xE8, 0x98, 0xF7,
+    0x79, 0xC5, 0xD1, 0xC0, 0x1E, 0x0D, 0xA1, 0x4E, 0xC8, 0x8D, 0x09, 0x6D, 0x07, 0x7C, 0x12, 0x73,
+    0xED, 0x85, 0x5F, 0x12, 0x07, 0x00, 0xB3, 0xC7, 0xB2, 0x04, 0xFA, 0x14, 0x5A, 0x19, 0xB0, 0x02,
+    0x52, 0x16, 0x6C, 0xEC, 0xDC, 0x04, 0x8E, 0x0D, 0x13, 0x24, 0x07, 0xF1, 0x5C, 0xA8, 0x49, 0x4F,
+    0x24, 0xC6, 0x51, 0x82, 0x21, 0x7F, 0xE6, 0x22, 0xF2, 0xB4, 0x16, 0xFA, 0xD8, 0xC5, 0xCC, 0x2A,
+    0xB6, 0x2F, 0x55, 0xB4, 0xA4, 0xE2, 0x63, 0x52, 0xE7, 0x73, 0xA9, 0x00, 0xF5, 0x0B, 0x2A, 0x21,
+    0x0E, 0x1D, 0xD6, 0x3D, 0xF6, 0xA7, 0x16, 0x72, 0x56, 0xD2, 0xBE, 0x55, 0xF7, 0xC9, 0x45, 0x26,
+    0xEF, 0xE0, 0xBD, 0x05, 0xF4, 0xAB, 0x2F, 0x2D, 0x8F, 0x4D, 0x68, 0xB9, 0xB3, 0x40, 0x4E, 0x4E,
+    0x86, 0x04, 0x74, 0x47, 0x02, 0xF1, 0x55, 0xC0, 0x70, 0x36, 0x09, 0xFE, 0x51, 0x06, 0xF9, 0xFD,
+    0x4D, 0x36, 0xCE, 0x44, 0xE4, 0x34, 0x4B, 0x71, 0x22, 0x54, 0x52, 0x2C, 0x88, 0xBA, 0x85, 0x16,
+    0xDF, 0x24, 0x94, 0x9C, 0x2A, 0x04, 0x92, 0x84, 0xDE, 0x44, 0x28, 0xC1, 0x11, 0xD4, 0x36, 0xD8,
+    0x7F, 0xA4, 0x5E, 0x99, 0xAE, 0x4A, 0x2F, 0x3C, 0xB9, 0x8F, 0x46, 0xA4, 0x13, 0x60, 0xCF, 0x0E,
+    0x64, 0x21, 0x90, 0x7B, 0x33, 0x53, 0xE3, 0x9B, 0xB1, 0x4D, 0x08, 0x0C, 0x17, 0xEF, 0xAB, 0xEE,
+    0x22, 0xB8, 0xDD, 0x5F, 0xC1, 0x75, 0xE1, 0x76, 0x7E, 0x80, 0x60, 0x71, 0xF3, 0xDF, 0x82, 0x7B,
+    0x8B, 0xAE, 0x7D, 0x0D, 0x4A, 0x86, 0xED, 0xAB, 0xB7, 0x6F, 0x37, 0xB0, 0x0A, 0x07, 0xE7, 0x26,
+    0x6A, 0x94, 0x83, 0x0E, 0x87, 0x58, 0x4B, 0xA4, 0x7F, 0x8D, 0xA4, 0x01, 0x54, 0x9F, 0x2E, 0xF8,
+    0x67, 0xBC, 0xAE, 0xC7, 0xFE, 0xE8, 0x60, 0x61, 0x48, 0x52, 0x53, 0xB4, 0x46, 0x7F, 0xA1, 0x0F,
+    0x80, 0x22, 0x36, 0xC1, 0x82, 0x9E, 0x5C, 0x47, 0xA1, 0xC1, 0x1E, 0xEC, 0xFB, 0x7A, 0x64, 0x90,
+    0xE1, 0x8A, 0x81, 0x36, 0x20, 0x93, 0x2A, 0x35, 0x20, 0x91, 0x70, 0xB5, 0x94, 0x28, 0xCB, 0x54,
+    0x47, 0x2A, 0x8D, 0x06, 0x53, 0x21, 0x95, 0x09, 0x66, 0xA6, 0x52, 0x99, 0xE8, 0x5F, 0x35, 0x77,
+    0x46, 0xCA, 0x52, 0xC2, 0x79, 0x45, 0x86, 0x0A, 0xF1, 0x98, 0xEC, 0x03, 0xE6, 0x77, 0xB2, 0xF9,
+    0x0C, 0xD9, 0xDF, 0x6D, 0xC6, 0x44, 0xC1, 0xDD, 0xF5, 0xB4, 0x9F, 0x9F, 0x50, 0x21, 0x00, 0x35,
+    0x2F, 0xA4, 0xA1, 0xDC, 0x8D, 0xA8, 0x63, 0x94, 0x86, 0x70, 0x80, 0x86, 0x68, 0x27, 0x85, 0x83,
+    0x63, 0x71, 0x1E, 0x71, 0xDD, 0x6C, 0x6A, 0x5E, 0x80, 0xA5, 0xE5, 0x7E, 0xC8, 0x12, 0xEE, 0x41,
+    0xD2, 0x08, 0x28, 0xFF, 0x98, 0xB2, 0x94, 0xAF, 0x95, 0xDE, 0x52, 0xE7, 0x87, 0x8F, 0xE2, 0xBF,
+    0xC9, 0x8E, 0x68, 0x2E, 0x2D, 0x7A, 0x01, 0x1F, 0x8B, 0xDE, 0x52, 0xC1, 0x8D, 0x90, 0xB6, 0x2A,
+    0x53, 0x34, 0x03, 0x3C, 0xF3, 0x65, 0x45, 0x93, 0xCD, 0x86, 0x1F, 0xF0, 0xC8, 0x51, 0x45, 0xA1,
+    0x5D, 0x27, 0x64, 0x95, 0xC9, 0xC9, 0xE0, 0xD1, 0xC1, 0x30, 0xF9, 0xCA, 0xF9, 0xBF, 0x6D, 0xAD,
+    0x78, 0x1A, 0x92, 0x9C, 0x1A, 0x2F, 0x3A, 0x84, 0x44, 0xB3, 0xF4, 0x26, 0x25, 0xCA, 0xDF, 0x2A,
+    0x4E, 0x6D, 0x0C, 0x47, 0x60, 0x7D, 0xC6, 0xB3, 0x66, 0xE9, 0xE4, 0xD4, 0xFE, 0x90, 0x0A, 0xC0,
+    0x3D, 0xB0, 0x67, 0xB5, 0x98, 0x5E, 0x20, 0xEF, 0x77, 0xB2, 0x51, 0x08, 0x2D, 0x9D, 0x89, 0xB9,
+    0x70, 0xE7, 0xE4, 0x21, 0xBA, 0xE7, 0xC5, 0x46, 0x71, 0xA9, 0x9C, 0xA0, 0xAD, 0x93, 0xB8, 0x36,
+    0xC8, 0x4E, 0x54, 0x1C, 0xEC, 0x8B, 0x8D, 0xA9, 0x78, 0x90, 0x51, 0x85, 0x9C, 0x05, 0xDE, 0xA1,
+    0x0C, 0x7B, 0x32, 0xEC, 0xAA, 0xFC, 0x4D, 0xA2, 0xE2, 0x84, 0xFA, 0xFD, 0x3D, 0x0C, 0xE2, 0xC5,
+    0xE5, 0xD0, 0x66, 0x8D, 0x5A, 0xC3, 0xD9, 0x1E, 0xBC, 0xD9, 0xDC, 0x2F, 0xF6, 0x01, 0x43, 0xBA,
+    0x37, 0xAE, 0x35, 0x24, 0xBE, 0x5C, 0x48, 0xE9, 0xCF, 0xBB, 0x89, 0x4B, 0x2F, 0x90, 0x4B, 0x10,
+    0x53, 0x73, 0x7A, 0xBF, 0x6C, 0x71, 0x2E, 0x5B, 0x72, 0x61, 0xA1, 0xF0, 0xD0, 0xF4, 0xE4, 0xAA,
+    0x2A, 0xB7, 0x96, 0xF5, 0x7A, 0x2E, 0xA7, 0x9A, 0xA9, 0x9C, 0xB2, 0x1E, 0x0A, 0x23, 0xE5, 0x16,
+    0x31, 0x49, 0x6A, 0x66, 0x96, 0x5B, 0x65, 0x2C, 0x19, 0xE0, 0x32, 0x8A, 0xA3, 0xC8, 0xD2, 0x20,
+    0x31, 0xAC, 0x0A, 0x37, 0xA9, 0xF4, 0x8A, 0xFF, 0xF3, 0xF9, 0x03, 0x8D, 0x55, 0xB1, 0x6F, 0xDF,
+    0x44, 0x14, 0x7E, 0xB6, 0x69, 0x3C, 0x58, 0xAD, 0x33, 0x34, 0xA2, 0x02, 0x84, 0x19, 0x19, 0x40,
+    0x5E, 0x18, 0x93, 0x9E, 0xDB, 0x0C, 0x19, 0x3A, 0x34, 0x42, 0xFA, 0xB1, 0xB0, 0xB1, 0x31, 0xA0,
+    0x2E, 0x0C, 0x0C, 0x85, 0x73, 0xC2, 0xD0, 0x81, 0x21, 0xFD, 0x0F, 0xE8, 0x90, 0x09, 0x90, 0xC2,
+    0xC0, 0xC0, 0xD0, 0xE6, 0x1C, 0x32, 0x64, 0xC4, 0xD0, 0x81, 0x81, 0x81, 0x43, 0x48, 0xAC, 0x71,
+    0x2B, 0x23, 0xB9, 0xE8, 0xEE, 0x1E, 0xDF, 0x3B, 0xFF, 0x82, 0xA0, 0x10, 0x68, 0x7E, 0xF2, 0xCB,
+    0xF9, 0xE9, 0xEE, 0xBB, 0xEF, 0xBD, 0xF7, 0xBD, 0x67, 0xC5, 0xCC, 0x44, 0x30, 0x13, 0x91, 0x6E,
+    0x0C, 0x51, 0xE2, 0x13, 0x47, 0x94, 0x8F, 0xF9, 0x40, 0x54, 0xF5, 0xD5, 0xE9, 0x04, 0xB7, 0x66,
+    0x07, 0x77, 0x78, 0xDB, 0x89, 0xBB, 0x18, 0xE0, 0xEE, 0xAA, 0x1E, 0x6E, 0x52, 0x9F, 0xF0, 0x16,
+    0x37, 0x41, 0x85, 0xDA, 0x67, 0x00, 0x90, 0x13, 0x62, 0x8D, 0x98, 0xD9, 0xA1, 0x3B, 0x98, 0xDA,
+    0xC9, 0xF2, 0x6A, 0x43, 0xB4, 0xF2, 0xB5, 0xF8, 0xF0, 0x9A, 0xF2, 0xB5, 0x7D, 0x2A, 0xA6, 0x92,
+    0x9B, 0xCA, 0x2A, 0xD3, 0xAB, 0x2E, 0x94, 0x83, 0x6E, 0x7D, 0x31, 0x9A, 0xEB, 0xB8, 0x85, 0x61,
+    0x26, 0xCE, 0x96, 0x2B, 0x18, 0x5F, 0x0C, 0x66, 0xC7, 0x97, 0x83, 0xEA, 0xB8, 0xEC, 0xEB, 0x41,
+    0xEB, 0xB6, 0xF4, 0x55, 0x00, 0x0A, 0xF3, 0x01, 0xDD, 0x62, 0xE3, 0x89, 0xB6, 0xA9, 0xA1, 0x04,
+    0x57, 0x54, 0xB8, 0x57, 0xF5, 0xEF, 0x52, 0xFD, 0x0D, 0xDB, 0xEA, 0xC8, 0xE3, 0xA4, 0xAF, 0x8F,
+    0x27, 0x9D, 0x0F, 0xA1, 0x3A, 0x72, 0xEA, 0xCE, 0xA0, 0xCB, 0xC1, 0xD5, 0xBB, 0xAE, 0xDE, 0xEB,
+    0xD4, 0x31, 0xF7, 0x79, 0xE0, 0x5F, 0xDB, 0x9A, 0xD9, 0xD2, 0xE5, 0x0B, 0x0D, 0xAD, 0x84, 0x06,
+    0x90, 0x9D, 0x62, 0xCE, 0x3C, 0xB9, 0xBA, 0xCF, 0x06, 0xA6, 0xE2, 0xCE, 0x88, 0x08, 0x10, 0x17,
+    0xF2, 0x94, 0x81, 0x79, 0x89, 0x57, 0x65, 0x11, 0x64, 0x47, 0x09, 0x37, 0x94, 0x71, 0x9B, 0x6C,
+    0x31, 0xFB, 0x9C, 0x79, 0x48, 0x39, 0x60, 0x2B, 0x22, 0xBC, 0x4D, 0xF4, 0xCE, 0x00, 0x76, 0x1D,
+    0xE5, 0x38, 0x91, 0xC0, 0x03, 0xF0, 0x9A, 0x49, 0xB1, 0x55, 0x0F, 0x1D, 0x72, 0x57, 0x0E, 0x97,
+    0x04, 0x0B, 0x90, 0xAA, 0x13, 0xC4, 0x14, 0x2B, 0xFD, 0xFB, 0x17, 0x05, 0x8A, 0xA1, 0x01, 0x7A,
+    0x1F, 0x61, 0x50, 0xF2, 0x69, 0x2B, 0x97, 0x94, 0x77, 0x69, 0x6D, 0xB1, 0x58, 0x6C, 0x22, 0x54,
+    0x07, 0x62, 0x7C, 0x3C, 0xEA, 0x23, 0x77, 0x35, 0x73, 0xE5, 0x31, 0xB2, 0x36, 0x3D, 0x97, 0xB9,
+    0x0B, 0x11, 0x24, 0x72, 0xFB, 0xAF, 0x85, 0x46, 0x08, 0x1A, 0x71, 0x16, 0x42, 0x92, 0x4A, 0x44,
+    0x40, 0xC8, 0x1A, 0x15, 0xDD, 0xCC, 0x97, 0x32, 0x59, 0x60, 0x3F, 0xA4, 0x80, 0x5B, 0x7E, 0xF9,
+    0x39, 0x54, 0x7B, 0x9B, 0xD3, 0xC6, 0x46, 0x69, 0x87, 0x55, 0xB5, 0x43, 0x14, 0xE6, 0x8A, 0xCA,
+    0x39, 0xD5, 0xC6, 0xD7, 0x9A, 0xBB, 0x44, 0xC4, 0x93, 0x8A, 0x5E, 0xE0, 0x2E, 0x91, 0xFC, 0x0D,
+    0x20, 0xBC, 0x02, 0xBE, 0xC9, 0xE2, 0x06, 0x4F, 0x3A, 0xE8, 0x90, 0x72, 0x6B, 0xBA, 0xD2, 0x66,
+    0xA2, 0xAA, 0x6A, 0x50, 0x0D, 0xF1, 0x96, 0x05, 0x1F, 0x1C, 0xA9, 0x4F, 0x01, 0xC3, 0x50, 0x59,
+    0xEE, 0xFF, 0x9D, 0x78, 0x2F, 0x64, 0x2C, 0xE5, 0xE0, 0xAB, 0xB9, 0xC4, 0x6F, 0x97, 0x5B, 0x6E,
+    0xEA, 0xB6, 0x1A, 0xCA, 0x0E, 0xD2, 0x18, 0xC8, 0x6C, 0x8E, 0xE0, 0xE3, 0x40, 0xE0, 0x01, 0x42,
+    0xD3, 0x60, 0xC0, 0x2D, 0x6A, 0xD2, 0xCD, 0xF5, 0x29, 0x00, 0x9D, 0xC4, 0xC0, 0x45, 0x97, 0x70,
+    0x16, 0xE3, 0xBC, 0x23, 0xFD, 0xEC, 0xEE, 0xB9, 0x0C, 0x6D, 0x0D, 0x86, 0x19, 0x18, 0x4E, 0x28,
+    0x41, 0xFD, 0xD3, 0x92, 0xE1, 0x01, 0xEF, 0x53, 0xC5, 0x38, 0x9A, 0xF9, 0x67, 0x63, 0x68, 0x23,
+    0x43, 0x4B, 0xE6, 0xFA, 0x19, 0xC3, 0x0F, 0xB1, 0x55, 0xE1, 0xFE, 0xD3, 0x26, 0x32, 0x4C, 0xF4,
+    0x6F, 0xF8, 0x8F, 0x45, 0x7A, 0x3E, 0xC3, 0x66, 0xB1, 0xAD, 0xF8, 0x7B, 0x1E, 0x6B, 0xDE, 0x31,
+    0x36, 0x63, 0xE9, 0x2A, 0xDE, 0xC1, 0x76, 0x7D, 0x2C, 0x82, 0x64, 0x09, 0x11, 0x7B, 0x21, 0x40,
+    0x92, 0x76, 0x6A, 0xE4, 0x15, 0x18, 0xD5, 0xA9, 0x54, 0xE8, 0x26, 0x4A, 0x15, 0x90, 0xD8, 0xD4,
+    0x41, 0x59, 0x80, 0xE5, 0x4E, 0x73, 0xCE, 0xCE, 0x70, 0xC1, 0x72, 0x61, 0xBC, 0x35, 0x26, 0x87,
+    0x62, 0x97, 0x8E, 0x62, 0xBE, 0x9A, 0xEB, 0xEF, 0x95, 0x53, 0x53, 0x35, 0xE6, 0xAE, 0xEA, 0xD2,
+    0x00, 0xCA, 0x46, 0x6A, 0x25, 0xC4, 0x90, 0x08, 0x85, 0xDD, 0x87, 0x68, 0xBB, 0xC9, 0x34, 0xC5,
+    0xA0, 0x7A, 0x35, 0x6A, 0x6F, 0x26, 0xF6, 0x4B, 0x29, 0x09, 0x1E, 0xD2, 0x46, 0x1F, 0xE0, 0xB9,
+    0x0C, 0xCD, 0x5E, 0x5B, 0x34, 0x50, 0x52, 0xCD, 0x1F, 0x43, 0xB9, 0x7A, 0x2A, 0xCB, 0x47, 0xE8,
+    0xF0, 0x75, 0x75, 0x72, 0x14, 0xE8, 0x1E, 0x5F, 0xCC, 0x27, 0x49, 0x62, 0x65, 0x05, 0x57, 0xB7,
+    0x48, 0x6A, 0x12, 0xA4, 0x1F, 0xFE, 0xD7, 0xFD, 0x64, 0x61, 0xFA, 0x0C, 0xB0, 0x3C, 0x56, 0x62,
+    0x6D, 0xE4, 0xDC, 0xD0, 0xF2, 0x7A, 0xCA, 0x06, 0x3A, 0x13, 0x35, 0x5D, 0xA2, 0xA5, 0xA2, 0xBD,
+    0x76, 0x62, 0xC6, 0x75, 0xFD, 0x7A, 0xD5, 0xAD, 0xEB, 0xD7, 0xAA, 0xEE, 0x55, 0x7D, 0x05, 0x09,
+    0xD7, 0x74, 0x9E, 0x69, 0xEA, 0x5E, 0x66, 0x8B, 0x97, 0x9B, 0xA4, 0x5D, 0x28, 0x9A, 0x07, 0xB4,
+    0xEC, 0x15, 0x5A, 0xA7, 0x39, 0xC6, 0x64, 0xB1, 0x6D, 0x78, 0x8F, 0x47, 0x1D, 0x72, 0xB6, 0x20,
+    0x19, 0x99, 0x9E, 0x19, 0x07, 0x93, 0x45, 0x13, 0x60, 0xD2, 0x38, 0x69, 0x8D, 0x98, 0x17, 0xF6,
+    0xA5, 0x66, 0xF4, 0xB4, 0x89, 0x25, 0x94, 0x09, 0x73, 0x7E, 0x8D, 0xBE, 0x8C, 0x11, 0x19, 0x87,
+    0xDF, 0x84, 0x94, 0x62, 0x14, 0xFF, 0xF5, 0xC1, 0x0C, 0x12, 0xDA, 0x3D, 0xAD, 0xDD, 0xEA, 0xE7,
+    0x59, 0x8C, 0x27, 0x41, 0x00, 0x99, 0xDC, 0x4A, 0x87, 0x78, 0x3E, 0xA2, 0xB9, 0x49, 0x25, 0x80,
+    0x2B, 0xC2, 0xFF, 0x4D, 0x0E, 0x8A, 0x7F, 0x60, 0xAB, 0x03, 0x32, 0xAD, 0xBA, 0xC8, 0xBC, 0xB2,
+    0xA0, 0xAD, 0x8F, 0x50, 0x02, 0xBE, 0xA8, 0xBA, 0x2C, 0xBC, 0x0F, 0x0D, 0xA1, 0x86, 0x62, 0x06,
+    0x5A, 0x39, 0x94, 0x99, 0xFE, 0x86, 0x00, 0x3E, 0x14, 0x76, 0xA2, 0x8B, 0xD8, 0x0A, 0x05, 0xCB,
+    0x64, 0xE4, 0xDE, 0x38, 0x51, 0x85, 0x72, 0xE5, 0x50, 0xDA, 0xF8, 0x3C, 0xBA, 0x69, 0xCB, 0xC7,
+    0x7B, 0x16, 0xEC, 0x6C, 0x2A, 0x15, 0x7B, 0xFE, 0x5B, 0x4B, 0xE9, 0x9E, 0x9D, 0x87, 0x09, 0x46,
+    0x77, 0xC2, 0x1E, 0x6A, 0x8F, 0x67, 0x45, 0xD8, 0xED, 0xB2, 0xBD, 0x9E, 0x36, 0xC1, 0x8C, 0x12,
+    0x88, 0x44, 0xF3, 0xF9, 0x9C, 0xD8, 0x56, 0x68, 0xFE, 0xC3, 0x78, 0x7C, 0x74, 0x6A, 0x3E, 0x96,
+    0x69, 0x79, 0x02, 0xD2, 0xAB, 0x44, 0x2F, 0x7A, 0x49, 0x6A, 0x33, 0xCF, 0x40, 0x69, 0xB2, 0x54,
+    0xE4, 0x6A, 0x92, 0x6D, 0xAA, 0x7F, 0x8C, 0xA1, 0x61, 0x72, 0x9F, 0x3A, 0x32, 0xAD, 0x41, 0xDD,
+    0xAB, 0xBE, 0x18, 0xF3, 0x31, 0xF5, 0x89, 0x27, 0xD3, 0xE8, 0xBF, 0x39, 0x52, 0xFE, 0x8E, 0x1F,
+    0x61, 0x3C, 0x82, 0x0E, 0xBE, 0x14, 0xC8, 0xAE, 0x7C, 0x35, 0x6B, 0x69, 0xE3, 0xCA, 0x16, 0xE3,
+    0xCB, 0x92, 0xAF, 0xF2, 0xC6, 0x48, 0xF5, 0x09, 0x12, 0x53, 0x3C, 0xF6, 0xBC, 0x78, 0xCB, 0x69,
+    0x11, 0x69, 0x2E, 0xA6, 0xCB, 0xDD, 0x9F, 0xA5, 0x96, 0x74, 0x51, 0x11, 0x0B, 0x8C, 0x98, 0x57,
+    0x81, 0x71, 0x30, 0x89, 0x40, 0xBC, 0x60, 0x0A, 0xB7, 0x35, 0x51, 0xF4, 0x9A, 0xF4, 0xB5, 0x15,
+    0x39, 0xBC, 0xA4, 0x76, 0xFD, 0x6D, 0x4D, 0xE1, 0xBE, 0x21, 0x06, 0x62, 0xA8, 0x25, 0x0D, 0xBC,
+    0x44, 0x33, 0x12, 0xD8, 0x93, 0xF7, 0x00, 0xE2, 0x31, 0x8A, 0xC6, 0x78, 0xEE, 0x99, 0xFF, 0xFE,
+    0x00, 0xAD, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0xDB, 0xBA, 0xB3, 0x84, 0x25, 0x36, 0x45,
+    0x4E, 0x48, 0x08, 0x58, 0x89, 0x8A, 0x0A, 0xFF, 0x01, 0x72, 0x6B, 0xE5, 0x4A, 0x0A, 0x4E, 0x08,
+    0x43, 0x41, 0x91, 0x5F, 0x80, 0xF8, 0x03, 0x17, 0xD6, 0x21, 0x45, 0xCA, 0xA3, 0xA1, 0x86, 0x16,
+    0x9A, 0xA3, 0xA0, 0x00, 0x29, 0x92, 0x97, 0x50, 0xA4, 0xA0, 0x60, 0x95, 0x2B, 0xAE, 0x3C, 0x8B,
+    0x32, 0xCD, 0x2D, 0x91, 0x13, 0x7C, 0xDC, 0x7A, 0x87, 0x37, 0xF6, 0x77, 0x47, 0x90, 0x48, 0x05,
+    0xFE, 0xB4, 0xF3, 0xD9, 0xEB, 0xDD, 0xD9, 0x37, 0x6F, 0x66, 0x9E, 0x89, 0xB6, 0x53, 0x43, 0xA4,
+    0x79, 0x22, 0xAA, 0x99, 0x1D, 0xE9, 0xA1, 0x1A, 0xDF, 0x50, 0x81, 0x58, 0xBD, 0x3B, 0x52, 0xFD,
+    0xF0, 0x38, 0x52, 0xF5, 0x64, 0xE6, 0xF6, 0xC3, 0x68, 0x19, 0x57, 0x29, 0xC6, 0x95, 0x91, 0x70,
+    0xB1, 0x18, 0xE3, 0x61, 0x2A, 0x79, 0xCE, 0xD8, 0xD3, 0x35, 0xF8, 0x38, 0x9A, 0xA8, 0x60, 0x9E,
+    0xC5, 0xE7, 0x39, 0xA6, 0x6B, 0x07, 0x53, 0x0E, 0xB2, 0x60, 0x92, 0x0D, 0x37, 0xC4, 0x28, 0xBA,
+    0xBC, 0x76, 0x88, 0x72, 0x1E, 0x48, 0x71, 0x7C, 0xCD, 0x7C, 0x3E, 0x1F, 0x58, 0x4A, 0xF7, 0x7B,
+    0x62, 0x9C, 0x95, 0x80, 0x26, 0x2D, 0x67, 0xC8, 0xE8, 0x81, 0xD1, 0x9E, 0x7F, 0x02, 0xF7, 0x33,
+    0x55, 0x3C, 0xE2, 0x41, 0xCE, 0xDE, 0x8C, 0xB7, 0x31, 0x5E, 0xA7, 0x9D, 0x76, 0x8F, 0xE7, 0x9A,
+    0x3B, 0xE3, 0x8A, 0x48, 0x2F, 0x36, 0xBE, 0xE6, 0x63, 0x41, 0xF7, 0x32, 0x7D, 0x2D, 0xE7, 0xD7,
+    0xD9, 0x28, 0x7F, 0xFA, 0x24, 0xC8, 0x5F, 0xC5, 0x7E, 0x41, 0xD5, 0x5E, 0xE1, 0xA3, 0xBC, 0xDB,
+    0x6A, 0xF7, 0xB7, 0x3B, 0x35, 0x2A, 0x0E, 0xF5, 0xA0, 0x62, 0xC5, 0x9D, 0x0D, 0x2A, 0x11, 0xB0,
+    0x0D, 0x38, 0x3D, 0x49, 0x54, 0xBA, 0x4B, 0x05, 0xF6, 0x57, 0x2E, 0x55, 0xD8, 0x5F, 0x84, 0xA4,
+    0x9C, 0x84, 0xC5, 0x0C, 0xD4, 0xC2, 0x18, 0x9E, 0x54, 0x48, 0x1A, 0x24, 0xD4, 0x43, 0x52, 0x82,
+    0xDE, 0x25, 0xE1, 0x90, 0xB1, 0x2F, 0x61, 0x21, 0xBC, 0x70, 0x53, 0xCD, 0xC4, 0x4D, 0xEF, 0xEB,
+    0x09, 0x07, 0x99, 0xD1, 0x0E, 0x9A, 0x83, 0x8A, 0x5B, 0x8D, 0x10, 0xB7, 0xBF, 0xC1, 0xA2, 0x3A,
+    0x01, 0x6B, 0x16, 0x36, 0x53, 0x2F, 0x33, 0xFD, 0x78, 0x89, 0x53, 0xD6, 0x5C, 0x2B, 0x83, 0x99,
+    0xAB, 0x50, 0x87, 0x7E, 0xB0, 0xEE, 0x68, 0xB0, 0xC5, 0x05, 0xA9, 0x9F, 0x62, 0xDD, 0x90, 0xBA,
+    0x17, 0x24, 0xBF, 0x47, 0xA7, 0x40, 0xB2, 0xC0, 0xAA, 0x9E, 0x45, 0xEC, 0xB7, 0xF7, 0x42, 0xA2,
+    0x22, 0xEA, 0x07, 0x33, 0x80, 0xD9, 0x22, 0xE6, 0xC8, 0x6F, 0x19, 0x75, 0x30, 0xB1, 0x8A, 0x5B,
+    0x72, 0x30, 0x48, 0x6D, 0x5E, 0x02, 0xAD, 0x05, 0x88, 0x6D, 0xD8, 0x1B, 0x57, 0xCF, 0x45, 0x2C,
+    0x03, 0xA8, 0x8C, 0xD8, 0x07, 0xC7, 0x06, 0xBC, 0x21, 0xDB, 0x23, 0x19, 0x66, 0x5F, 0xCC, 0x25,
+    0xE3, 0x95, 0x9A, 0x16, 0xB2, 0x85, 0xEE, 0xF5, 0xC6, 0x63, 0x29, 0x3B, 0xF3, 0x33, 0xC7, 0x62,
+    0xDA, 0xE4, 0x52, 0x87, 0xB5, 0x6A, 0x0C, 0x0B, 0x51, 0xCD, 0x55, 0x10, 0x3C, 0xA9, 0x63, 0xF6,
+    0x7C, 0x67, 0xAE, 0xFE, 0x2C, 0x47, 0x43, 0xFA, 0x51, 0x20, 0xDB, 0xFB, 0x8C, 0x79, 0x28, 0xCF,
+    0x41, 0x09, 0x10, 0xD8, 0xC6, 0xDE, 0x99, 0x29, 0x01, 0xC8, 0x84, 0xC5, 0x60, 0xC2, 0x34, 0x94,
+    0xC1, 0x93, 0xDC, 0xC2, 0x59, 0x0F, 0xC7, 0x3F, 0x22, 0x81, 0x6D, 0xBB, 0x2F, 0xCC, 0x7B, 0x25,
+    0x55, 0x54, 0x04, 0xE3, 0x48, 0x39, 0xBC, 0x36, 0x40, 0x44, 0x13, 0xCA, 0xBB, 0x18, 0x30, 0xA5,
+    0x1B, 0x4C, 0xDD, 0xC6, 0x54, 0x1E, 0x30, 0xA5, 0x00, 0x99, 0x76, 0xE1, 0x24, 0x1F, 0x41, 0x85,
+    0x72, 0x2A, 0xE8, 0x84, 0x7A, 0xE9, 0x83, 0xE2, 0xF3, 0x44, 0x96, 0x87, 0x66, 0x2D, 0xBB, 0x5C,
+    0x82, 0x90, 0x0C, 0xAF, 0xB5, 0x3C, 0x2C, 0xC8, 0x71, 0x58, 0xC4, 0x98, 0xE8, 0xB6, 0xF6, 0x74,
+    0xB0, 0x19, 0xF7, 0x31, 0x7E, 0xC0, 0x98, 0x30, 0x46, 0xED, 0xDF, 0x0C, 0xDA, 0x23, 0x88, 0xA1,
+    0x77, 0x9C, 0xEC, 0x4D, 0x4E, 0xD7, 0x89, 0xE2, 0xDA, 0x16, 0x19, 0x50, 0xE7, 0xE2, 0xA8, 0x03,
+    0xE1, 0x6D, 0xAB, 0x78, 0x34, 0xFC, 0x1B, 0x4F, 0x15, 0x0F, 0xC0, 0x55, 0x83, 0x3F, 0xAA, 0x46,
+    0x01, 0x36, 0x83, 0x4E, 0xF0, 0xB7, 0x4E, 0xB2, 0xF0, 0xCE, 0xD2, 0x6A, 0xE6, 0xF1, 0xB7, 0xDC,
+    0xFC, 0xFB, 0x4A, 0xF4, 0x30, 0x2A, 0xDE, 0x57, 0x28, 0xDF, 0xB1, 0xF8, 0xBB, 0x6D, 0x6D, 0x27,
+    0x89, 0x90, 0xBA, 0x94, 0xE2, 0xCC, 0xB8, 0x5B, 0xF9, 0x37, 0xAC, 0xF9, 0x90, 0xF7, 0xD8, 0x5B,
+    0xB4, 0x91, 0xC6, 0xE1, 0x25, 0x72, 0x09, 0xF6, 0x19, 0xE1, 0xB3, 0xD3, 0x4F, 0x6F, 0xAD, 0x13,
+    0xD2, 0x97, 0xB2, 0xA2, 0x07, 0x93, 0x86, 0x17, 0xB7, 0x49, 0x9C, 0x36, 0x6B, 0xBB, 0xD7, 0x03,
+    0x3C, 0x4A, 0xB1, 0x7F, 0x41, 0xFF, 0x7F, 0x38, 0x66, 0x40, 0x38, 0x3D, 0xFF, 0x2A, 0x3E, 0xA5,
+    0x67, 0x4B, 0xE9, 0x80, 0x7C, 0x89, 0x6C, 0x31, 0xBB, 0xCF, 0xE9, 0x8B, 0x49, 0x8A, 0xEF, 0xA2,
+    0x9C, 0xC6, 0x52, 0x62, 0xB7, 0x8D, 0x71, 0xEB, 0xCD, 0xE3, 0xDE, 0x49, 0xBE, 0xC8, 0x7E, 0x69,
+    0xDD, 0x3F, 0x5E, 0x41, 0x8A, 0xFA, 0x28, 0xBB, 0x10, 0xC5, 0x52, 0xAB, 0x22, 0x2F, 0x85, 0x24,
+    0xE6, 0x1D, 0x69, 0x87, 0x66, 0xA7, 0xCD, 0xDA, 0xF7, 0x39, 0x19, 0x3E, 0xE1, 0xC1, 0x26, 0xF0,
+    0x80, 0x6D, 0x13, 0xF0, 0xE9, 0x41, 0x9C, 0x38, 0x91, 0x4D, 0x91, 0x19, 0xE1, 0xA7, 0x92, 0x03,
+    0x60, 0x02, 0x6D, 0x7F, 0x63, 0xDC, 0x86, 0xF7, 0x85, 0x2A, 0x15, 0x36, 0xBA, 0xA9, 0x44, 0xC8,
+    0x7A, 0x48, 0xCE, 0x02, 0xBF, 0x94, 0x69, 0xDD, 0x5D, 0x96, 0xD5, 0x77, 0x6B, 0x08, 0x7D, 0xC4,
+    0x6F, 0xB2, 0x20, 0x5A, 0xFB, 0xE7, 0x07, 0xF0, 0x7B, 0x28, 0x8C, 0xA7, 0x9D, 0x4F, 0xE1, 0x49,
+    0xAF, 0x23, 0xC3, 0x91, 0x85, 0x0C, 0xF8, 0xCD, 0xC3, 0x3A, 0xA4, 0xB4, 0x20, 0x0E, 0x59, 0xDB,
+    0x64, 0xED, 0x3E, 0x02, 0x2B, 0x38, 0x94, 0x8C, 0xED, 0x1E, 0xFA, 0x55, 0x01, 0x13, 0x54, 0x86,
+    0x29, 0xBB, 0x18, 0x75, 0xDF, 0x64, 0x7F, 0x4C, 0xB5, 0x69, 0xF2, 0x67, 0x71, 0x17, 0xF6, 0xF7,
+    0x78, 0xC3, 0x74, 0x79, 0x98, 0x0F, 0x4C, 0x57, 0x84, 0x7E, 0x12, 0x6B, 0x47, 0xC4, 0x16, 0x4C,
+    0xA8, 0x61, 0xEB, 0xA1, 0x76, 0x65, 0x50, 0x1E, 0x76, 0x50, 0xAE, 0xF6, 0x26, 0x6D, 0x37, 0x3C,
+    0x5B, 0xB8, 0x12, 0x71, 0xBD, 0xCC, 0x48, 0xB1, 0xC8, 0x53, 0xB1, 0x68, 0x6B, 0xE9, 0x16, 0x7B,
+    0x59, 0x69, 0x50, 0x86, 0xA9, 0x9E, 0x21, 0x60, 0xD0, 0x0C, 0x7C, 0x51, 0xF8, 0x26, 0xCC, 0xD9,
+    0xDD, 0x33, 0x57, 0x9E, 0xFE, 0xF2, 0x95, 0x2B, 0x4F, 0xCE, 0x6E, 0xB9, 0xF2, 0x98, 0xB5, 0x2B,
+    0x1F, 0xCD, 0x30, 0x3E, 0x8A, 0xF9, 0x5E, 0x3B, 0x3D, 0x81, 0x11, 0x13, 0x25, 0xD0, 0x4D, 0x23,
+    0x2E, 0xCE, 0x97, 0x14, 0x15, 0x6E, 0xC9, 0x91, 0x7C, 0xC7, 0x1E, 0x32, 0xE0, 0x55, 0x01, 0x20,
+    0x7A, 0x7A, 0xD1, 0x4D, 0xC9, 0x4F, 0xE0, 0xE5, 0xAD, 0x1C, 0xD4, 0xED, 0x8A, 0x13, 0xF3, 0xF1,
+    0x20, 0xDF, 0x2C, 0x69, 0x87, 0x0F, 0xAE, 0xD4, 0xFF, 0xD5, 0xCB, 0x8E, 0xC9, 0x44, 0xA4, 0x8A,
+    0xA5, 0x2E, 0xC4, 0x54, 0xA7, 0x92, 0xBF, 0x43, 0x6C, 0xAB, 0xDF, 0x93, 0xBD, 0xA8, 0x02, 0xFA,
+    0x4C, 0xB2, 0x3B, 0x7F, 0x34, 0x8B, 0xC4, 0xA6, 0x45, 0xFE, 0x05, 0x1C, 0x37, 0x90, 0x6B, 0x94,
+    0x86, 0x17, 0x29, 0x41, 0x81, 0x45, 0xA8, 0xE9, 0x82, 0x3E, 0x0B, 0x35, 0xD5, 0x7B, 0x41, 0x84,
+    0xBC, 0xDC, 0xF4, 0x1F, 0x3E, 0x86, 0x36, 0x01, 0x3E, 0xEA, 0xD5, 0x3A, 0xE8, 0x31, 0xED, 0xA3,
+    0x72, 0x5E, 0x01, 0x64, 0xA8, 0xE7, 0x45, 0xAC, 0xA0, 0x62, 0x68, 0x36, 0xF5, 0xB4, 0x47, 0xFD,
+    0xF3, 0x03, 0x3E, 0x1C, 0xB3, 0xE6, 0x3A, 0xFD, 0xC7, 0xEB, 0x2F, 0xAD, 0x55, 0x31, 0x6F, 0xE5,
+    0x44, 0x10, 0x9E, 0xB5, 0x79, 0xB1, 0x84, 0x8B, 0x4D, 0xF1, 0x22, 0xA4, 0xA3, 0xF0, 0x1F, 0x40,
+    0x72, 0x43, 0xC9, 0x69, 0x8D, 0x28, 0x28, 0xAE, 0xC8, 0x2B, 0x62, 0xA5, 0xE0, 0x47, 0xD0, 0x50,
+    0xC2, 0xAD, 0xC5, 0x2B, 0x52, 0x46, 0x34, 0xD4, 0x57, 0xD0, 0x90, 0x82, 0xFC, 0x81, 0x13, 0xEB,
+    0x24, 0x45, 0x0A, 0x8A, 0x73, 0x88, 0x10, 0xC5, 0x15, 0x31, 0x42, 0x27, 0x0A, 0x9A, 0x3D, 0x30,
+    0xE0, 0xBB, 0xDB, 0xF5, 0xF0, 0x8D, 0xDF, 0x4B, 0x8E, 0x02, 0x3A, 0xAC, 0xB7, 0x96, 0xDF, 0x7A,
+    0x66, 0xF6, 0xFB, 0x66, 0xBE, 0x19, 0x13, 0xC9, 0x65, 0xB2, 0x9E, 0xC8, 0xEE, 0x7B, 0x3C, 0xC9,
+    0x6D, 0x4F, 0x55, 0xB4, 0xBD, 0xEE, 0xC9, 0x8D, 0xB1, 0x14, 0x63, 0x2F, 0xE5, 0x76, 0x7B, 0xCB,
+    0x6F, 0x3A, 0x22, 0x7D, 0x0C, 0xE3, 0x72, 0x76, 0xCB, 0x46, 0xA2, 0x87, 0x69, 0x20, 0x8A, 0x87,
+    0x11, 0x0E, 0x3C, 0x51, 0xC2, 0xCC, 0x94, 0x7A, 0xE2, 0x0A, 0xC1, 0x6D, 0xAB, 0x3B, 0x32, 0x9D,
+    0x0B, 0x09, 0x07, 0x8E, 0x29, 0x07, 0x89, 0x38, 0x1A, 0x2A, 0x2F, 0x87, 0x24, 0x58, 0x52, 0xB4,
+    0x39, 0x70, 0x0F, 0x28, 0x26, 0x2A, 0x79, 0xC8, 0x06, 0xDB, 0x5A, 0x84, 0x5B, 0x99, 0x96, 0xDE,
+    0x0A, 0xE4, 0xB8, 0x35, 0xAF, 0x42, 0xEE, 0x4D, 0xCB, 0x69, 0xD0, 0x7F, 0xB8, 0xCE, 0x31, 0x9F,
+    0xF3, 0xF1, 0xA0, 0xAA, 0x25, 0xBC, 0xEA, 0xBA, 0x3E, 0x00, 0x04, 0x9C, 0xD7, 0xD2, 0x0E, 0xEE,
+    0x82, 0x87, 0x17, 0x38, 0xC2, 0xD8, 0xB6, 0x24, 0x2A, 0x8E, 0x7D, 0x02, 0xAC, 0x17, 0x72, 0x66,
+    0xDE, 0x0B, 0x97, 0xD4, 0x1B, 0x1E, 0x28, 0x19, 0x34, 0xCF, 0x80, 0xA7, 0x13, 0x41, 0x2C, 0x2F,
+    0x2C, 0x42, 0x2C, 0xC8, 0x90, 0xF6, 0x69, 0x57, 0x36, 0x69, 0x50, 0x83, 0xEE, 0x14, 0x9F, 0xC4,
+    0x92, 0x53, 0x18, 0x68, 0x3E, 0x9B, 0xCF, 0xD8, 0xA3, 0x25, 0x15, 0x5C, 0xB0, 0x30, 0xE4, 0xE2,
+    0x8A, 0x3F, 0x8F, 0x80, 0x9A, 0x8E, 0x07, 0xBA, 0x2F, 0xBC, 0x9A, 0x91, 0x31, 0x7F, 0x6D, 0x7E,
+    0x19, 0x29, 0x01, 0x64, 0xC4, 0x2A, 0x7A, 0x32, 0x3F, 0xF0, 0x8B, 0x6F, 0xF0, 0x8A, 0x07, 0x37,
+    0x96, 0x0C, 0xD4, 0x0B, 0x10, 0x7E, 0xF4, 0x26, 0xE1, 0x80, 0x86, 0xA2, 0xAD, 0x84, 0x36, 0x2D,
+    0x56, 0x9B, 0x24, 0x80, 0x0E, 0xC8, 0x84, 0x12, 0x2B, 0x8D, 0x2A, 0x20, 0x0D, 0x9F, 0x62, 0xBD,
+    0x2B, 0xD9, 0x9D, 0x17, 0x30, 0xCC, 0x6B, 0x3A, 0xA9, 0xB6, 0x7B, 0xBB, 0x58, 0xEF, 0x61, 0x3D,
+    0xC6, 0xDE, 0xEC, 0x07, 0xFF, 0x51, 0x62, 0x0D, 0xBA, 0x32, 0x59, 0xA7, 0x7F, 0xF5, 0xE4, 0x86,
+    0x39, 0xF8, 0x01, 0xEA, 0xD2, 0xC3, 0x3B, 0x1D, 0xCB, 0x2B, 0x60, 0x9E, 0x68, 0x82, 0xE9, 0x31,
+    0xF3, 0xCF, 0xE3, 0x5C, 0x66, 0xD3, 0x51, 0x36, 0x7D, 0xD9, 0x01, 0x67, 0x8E, 0x0C, 0x09, 0xC8,
+    0xD3, 0xAF, 0x48, 0x23, 0x37, 0xB0, 0x6A, 0x5D, 0x65, 0xFD, 0x27, 0xA4, 0x11, 0x28, 0xBB, 0x85,
+    0x12, 0xEB, 0xFA, 0x30, 0x82, 0xD6, 0x66, 0x61, 0x6F, 0xB3, 0xF2, 0xD1, 0x55, 0xDA, 0x9B, 0x67,
+    0xAE, 0x2B, 0x98, 0xAB, 0x54, 0xB0, 0xEC, 0x55, 0x52, 0x5E, 0xC5, 0x51, 0x31, 0x77, 0x2F, 0xDE,
+    0x0E, 0x4B, 0x72, 0x15, 0xE9, 0xBE, 0x3E, 0x1C, 0x21, 0x16, 0xC1, 0xD0, 0xEB, 0xEB, 0x31, 0xF3,
+    0xEE, 0xC3, 0x51, 0xF3, 0xA8, 0x70, 0xF8, 0x56, 0x83, 0xA9, 0x7F, 0x48, 0xD9, 0x88, 0xB0, 0x83,
+    0x23, 0x5A, 0x2D, 0x37, 0xAA, 0xFC, 0x3F, 0x41, 0x11, 0x84, 0xF0, 0x19, 0xD2, 0xD0, 0x9A, 0x07,
+    0xFD, 0x56, 0x87, 0x6A, 0x85, 0xFA, 0xC2, 0x2A, 0xEA, 0x2F, 0xDC, 0x59, 0x95, 0x23, 0xF6, 0xB4,
+    0xA8, 0xAD, 0x64, 0x09, 0x69, 0x9D, 0x28, 0x9A, 0xC6, 0xE6, 0x83, 0x6D, 0x98, 0x9B, 0x02, 0x5D,
+    0xB1, 0xA4, 0xD7, 0x57, 0xB1, 0xF6, 0x73, 0x3F, 0x5D, 0xCE, 0xD9, 0x2F, 0x2F, 0xE6, 0xA4, 0x2F,
+    0xD4, 0xEA, 0xCE, 0x20, 0x69, 0x16, 0xF5, 0x6A, 0xA7, 0xD1, 0xD0, 0x9E, 0x2F, 0x7B, 0x1D, 0x72,
+    0x6E, 0xAC, 0xD7, 0x28, 0x03, 0x31, 0x54, 0x42, 0x93, 0x82, 0x63, 0xD1, 0x4C, 0xE8, 0x1B, 0xCA,
+    0xDB, 0x29, 0xEF, 0x24, 0x01, 0x93, 0x46, 0xC3, 0x89, 0xD8, 0x00, 0x2E, 0x9B, 0x15, 0x08, 0x51,
+    0x4D, 0x50, 0x15, 0x95, 0xFD, 0x24, 0xCC, 0x6D, 0x3B, 0x09, 0x79, 0x86, 0x9F, 0xF4, 0x1D, 0xA2,
+    0x70, 0x95, 0x47, 0x74, 0x9E, 0xEB, 0x4A, 0xA4, 0xD3, 0x9B, 0xC1, 0xF6, 0x05, 0x7B, 0x1D, 0xA4,
+    0xA0, 0x74, 0x87, 0x26, 0x3F, 0x17, 0x78, 0x76, 0x1F, 0x81, 0x28, 0x18, 0x79, 0x55, 0xED, 0xDE,
+    0xE2, 0x14, 0x9B, 0xDD, 0xCC, 0x9B, 0x98, 0xFB, 0xD2, 0xBB, 0xDE, 0xB6, 0xA7, 0xBD, 0x4D, 0x5F,
+    0x91, 0x3E, 0x0B, 0x25, 0xCA, 0x76, 0xE4, 0x01, 0xB3, 0x3C, 0xBD, 0x69, 0xE7, 0xC6, 0xA9, 0x28,
+    0xFF, 0x33, 0xA0, 0x3A, 0xF6, 0xC8, 0x4F, 0xC8, 0x74, 0x71, 0x1E, 0x01, 0x0C, 0x2D, 0x91, 0x70,
+    0xC6, 0x59, 0x28, 0xBC, 0x09, 0x79, 0x58, 0xC8, 0xC1, 0x73, 0x64, 0x7D, 0x36, 0xCE, 0xA3, 0x26,
+    0x9A, 0x56, 0x6D, 0xEB, 0x99, 0x7C, 0xDB, 0x88, 0x2A, 0x50, 0xD2, 0xCE, 0x90, 0x6B, 0x47, 0xE2,
+    0xB4, 0x43, 0xF3, 0x51, 0xD1, 0x89, 0x28, 0x53, 0x34, 0x34, 0x48, 0xD0, 0xC2, 0xF9, 0x59, 0xA0,
+    0xE4, 0xD6, 0x6D, 0x82, 0x7A, 0xE9, 0x81, 0x1B, 0x87, 0x5E, 0x0B, 0xF0, 0x6D, 0xFE, 0xB3, 0x94,
+    0x07, 0xB7, 0xA5, 0xEC, 0x5C, 0xD3, 0xE8, 0x9E, 0x32, 0x4C, 0xA4, 0x81, 0xCC, 0x44, 0xEA, 0xE3,
+    0x1E, 0x6D, 0x73, 0x9F, 0xB8, 0xE8, 0xEC, 0x1A, 0x49, 0x2D, 0x11, 0x04, 0x70, 0x16, 0x75, 0x9D,
+    0x6C, 0x9A, 0xEF, 0xFB, 0x21, 0x0D, 0x80, 0xA3, 0xFA, 0xB2, 0x15, 0x2F, 0x25, 0x03, 0x25, 0x02,
+    0x0D, 0xA4, 0xE9, 0x5A, 0x4A, 0x30, 0xE6, 0x8A, 0xBE, 0x52, 0xF1, 0x3E, 0x95, 0x3F, 0xC6, 0x8F,
+    0xA4, 0xE3, 0x30, 0xA6, 0x1A, 0xAA, 0x2B, 0xCC, 0x2F, 0xDE, 0x87, 0x56, 0x5E, 0x9E, 0x7A, 0x9F,
+    0xFB, 0x77, 0xE0, 0x8A, 0x1F, 0x0A, 0x9A, 0xCA, 0x60, 0x1C, 0x49, 0xCE, 0x29, 0x10, 0x03, 0x0D,
+    0x6F, 0xF0, 0x74, 0xDD, 0xE6, 0xCF, 0xC7, 0x2C, 0x58, 0x0E, 0x19, 0xA6, 0xD1, 0xBD, 0x47, 0x80,
+    0x5C, 0xAF, 0x64, 0xDC, 0x4E, 0xF3, 0x3C, 0x6A, 0xFE, 0x21, 0x2E, 0x28, 0x67, 0xAF, 0xFE, 0x00,
+    0x54, 0x30, 0x45, 0x62, 0xC2, 0x23, 0xC4, 0xAE, 0xBD, 0x24, 0x28, 0x90, 0xC1, 0x44, 0x90, 0xA9,
+    0x85, 0xA9, 0x10, 0x24, 0x5F, 0x9C, 0xFD, 0x8E, 0xCD, 0x4B, 0x8F, 0xCD, 0xBF, 0xBC, 0xBC, 0xF4,
+    0x62, 0xE9, 0xC5, 0x52, 0x3C, 0xF0, 0x07, 0x9B, 0x11, 0x6D, 0x83, 0x36, 0x2F, 0xF9, 0x7A, 0x8E,
+    0x89, 0xD3, 0x5A, 0xA0, 0xF3, 0x1B, 0x00, 0xDB, 0x4B, 0xF3, 0x1A, 0xAF, 0x3B, 0xF6, 0x45, 0xA7,
+    0xFB, 0x6C, 0xC8, 0x47, 0x15, 0xF3, 0x89, 0xEC, 0x03, 0x48, 0xFF, 0xE9, 0x93, 0x3E, 0xE3, 0x0B,
+    0xF4, 0x6A, 0x8B, 0x8D, 0xD6, 0x34, 0x62, 0x51, 0xC6, 0x1C, 0xDC, 0xD7, 0xDC, 0x6D, 0xD5, 0x3E,
+    0x18, 0xF9, 0x7C, 0x94, 0xF8, 0x6B, 0x8E, 0x50, 0x3D, 0x55, 0x6D, 0x23, 0xAB, 0xFA, 0x00, 0x6C,
+    0x98, 0xC1, 0x06, 0xE3, 0xD0, 0x4D, 0xB7, 0x2C, 0x36, 0xD8, 0x84, 0x05, 0x09, 0x0B, 0x42, 0x4A,
+    0xCC, 0x19, 0x7A, 0x57, 0x3F, 0x0F, 0x02, 0x38, 0xC8, 0x4B, 0x19, 0x88, 0x26, 0x88, 0xE5, 0xCC,
+    0x7B, 0x93, 0x84, 0x2A, 0x45, 0x46, 0x70, 0xF8, 0x30, 0xC7, 0xDC, 0xF6, 0x62, 0x4F, 0xFA, 0xB7,
+    0x40, 0xC9, 0x68, 0xA1, 0x65, 0xF5, 0x3A, 0x8F, 0x3C, 0x9A, 0x68, 0xC0, 0x58, 0x45, 0xB4, 0x9D,
+    0xAD, 0x1C, 0x90, 0x3B, 0x70, 0x73, 0xE0, 0xF6, 0x18, 0x1B, 0x01, 0x54, 0x02, 0xC8, 0x62, 0x3C,
+    0x8A, 0x45, 0xC2, 0x9D, 0x1B, 0xC4, 0x65, 0xF6, 0xCD, 0x7A, 0x69, 0x34, 0x08, 0x13, 0x88, 0x88,
+    0x96, 0x8B, 0x6D, 0xC8, 0x9D, 0x97, 0x68, 0x82, 0x79, 0xAA, 0xE0, 0x70, 0x69, 0x69, 0x50, 0xE6,
+    0x75, 0xA0, 0x3C, 0xD8, 0x86, 0xCC, 0xD3, 0x01, 0xC5, 0x47, 0x9B, 0x98, 0x9B, 0xBB, 0x87, 0x11,
+    0x7C, 0xA1, 0x22, 0x73, 0x09, 0x9B, 0xC1, 0x78, 0xC5, 0x8A, 0x9F, 0xB9, 0x36, 0x93, 0x8F, 0x57,
+    0x2E, 0x93, 0x69, 0xFB, 0x2D, 0xA0, 0xEC, 0x6A, 0x24, 0xF3, 0x9D, 0xA7, 0x09, 0x22, 0xAC, 0xDE,
+    0xD8, 0xEC, 0xD5, 0x24, 0x22, 0x92, 0x4F, 0x80, 0xB9, 0xE2, 0xF7, 0x31, 0x50, 0x51, 0x78, 0xA4,
+    0x47, 0xA3, 0xDA, 0x06, 0x5F, 0xB9, 0xCD, 0xDF, 0xBE, 0xE8, 0xED, 0x4F, 0x22, 0x49, 0x8C, 0x7E,
+    0xF9, 0xB6, 0x54, 0xF4, 0xAF, 0xD7, 0xDF, 0xBD, 0x55, 0x31, 0x73, 0xDE, 0x44, 0x10, 0x7D, 0x92,
+    0x6C, 0x8B, 0xB1, 0x06, 0x2E, 0x85, 0x3D, 0x94, 0xA2, 0xA0, 0x61, 0x86, 0x41, 0xFC, 0x80, 0xD8,
+    0xA7, 0xE0, 0x82, 0x92, 0xAF, 0xB0, 0x86, 0xC2, 0xFF, 0x80, 0x86, 0x96, 0x86, 0x9C, 0x12, 0x97,
+    0x14, 0x29, 0x98, 0x54, 0xFC, 0x03, 0x1A, 0x5A, 0x0A, 0x9C, 0x53, 0x70, 0xE1, 0x82, 0x46, 0xC0,
+    0xA4, 0xA2, 0xB0, 0x48, 0x86, 0x3A, 0x0A, 0xA3, 0x19, 0x94, 0xCC, 0x49, 0xCB, 0x5B, 0x7D, 0x8E,
+    0xED, 0x30, 0x0C, 0x5D, 0x90, 0x47, 0xDF, 0xDC, 0xDD, 0xEA, 0xF6, 0xBD, 0xDD, 0xB7, 0xBB, 0xC6,
+    0xD6, 0x8B, 0x12, 0x99, 0x48, 0x99, 0x88, 0x4C, 0x90, 0xD2, 0xF5, 0x45, 0x0B, 0x39, 0x0E, 0x48,
+    0x83, 0x2B, 0x61, 0x7F, 0xEB, 0x91, 0x4C, 0xC2, 0xE7, 0x9C, 0xEF, 0x24, 0xF7, 0x2B, 0x77, 0x3E,
+    0x20, 0x09, 0xBE, 0x86, 0x3D, 0xE3, 0x37, 0x83, 0xED, 0x21, 0x91, 0xFC, 0xE1, 0x9B, 0x54, 0xA4,
+    0xA7, 0x9F, 0x11, 0xD8, 0x5C, 0x61, 0xF9, 0x89, 0xB9, 0xB1, 0x12, 0x92, 0xD1, 0x0C, 0x79, 0x63,
+    0xFA, 0x19, 0xC5, 0xE9, 0x54, 0x79, 0x23, 0x12, 0xEC, 0xFD, 0xA3, 0x65, 0x1B, 0x30, 0xA7, 0x21,
+    0xEB, 0x89, 0xCE, 0x9B, 0x1D, 0x70, 0x88, 0xF5, 0x93, 0x76, 0x01, 0x90, 0xBC, 0x85, 0x79, 0xC6,
+    0xC5, 0xCE, 0xE6, 0xC5, 0xF1, 0xEB, 0x61, 0xAA, 0x78, 0x3F, 0x93, 0xE9, 0x4F, 0x3D, 0xE6, 0xA2,
+    0x41, 0xB9, 0xB1, 0x3E, 0xAB, 0x80, 0x42, 0x6A, 0x42, 0x35, 0xB6, 0x96, 0x5B, 0x01, 0x62, 0xBA,
+    0x38, 0xD8, 0x47, 0x47, 0x3D, 0xBD, 0x9F, 0x3E, 0x67, 0x1C, 0xBA, 0x6D, 0x4C, 0xE7, 0x1A, 0x0F,
+    0x4F, 0x87, 0x7E, 0xA6, 0xBF, 0x72, 0x7D, 0x37, 0xE4, 0x35, 0xDC, 0x27, 0x3D, 0xCC, 0xAF, 0x01,
+    0xD1, 0x6A, 0xE7, 0x82, 0xFD, 0x5C, 0xD2, 0xE3, 0x8C, 0x9C, 0xF0, 0xE9, 0x90, 0xCE, 0xD1, 0x08,
+    0xD7, 0xEC, 0x21, 0x1B, 0xB7, 0x10, 0x09, 0xED, 0xB6, 0x89, 0x94, 0x18, 0x33, 0x86, 0xAD, 0x6F,
+    0xD7, 0x07, 0x40, 0xDE, 0xDD, 0x84, 0x19, 0x6C, 0x9D, 0x05, 0xF3, 0x3C, 0x0F, 0x31, 0x73, 0xC7,
+    0xFB, 0x03, 0xB0, 0xBB, 0x46, 0x4A, 0xFA, 0x93, 0x68, 0xB2, 0xB5, 0x35, 0x6D, 0x84, 0xE5, 0x24,
+    0x5A, 0xD1, 0xDE, 0x16, 0x32, 0x99, 0xD6, 0x3D, 0xAC, 0x33, 0x7E, 0x39, 0x43, 0xA4, 0xB6, 0xD2,
+    0x45, 0x9F, 0x8E, 0x37, 0xA2, 0x69, 0x0F, 0x3E, 0x6F, 0xDD, 0x31, 0xA3, 0x72, 0x52, 0x2F, 0xF9,
+    0xDE, 0xAD, 0x4A, 0x24, 0x74, 0x4B, 0xE0, 0x06, 0x2F, 0x9F, 0xA8, 0x5A, 0xED, 0x56, 0x5E, 0x0E,
+    0xE4, 0x2F, 0xE9, 0x8A, 0xC9, 0x8C, 0xF0, 0xE4, 0x6A, 0x9A, 0x78, 0x22, 0x69, 0xD3, 0x5B, 0xC0,
+    0xA7, 0x1D, 0x92, 0x91, 0xB7, 0x8A, 0xF3, 0x9A, 0x52, 0xF5, 0x40, 0x36, 0x5D, 0x50, 0x8E, 0x09,
+    0xFA, 0xE1, 0x3E, 0x0F, 0x9E, 0x72, 0xE3, 0xB9, 0x49, 0xD5, 0xB2, 0x68, 0x48, 0x9D, 0xE1, 0x08,
+    0xB3, 0x59, 0xAD, 0x2E, 0xA1, 0x72, 0x39, 0x95, 0x33, 0xE9, 0x7C, 0x67, 0xDB, 0xAC, 0x4B, 0xC7,
+    0x44, 0x55, 0x1A, 0x51, 0xB4, 0x13, 0xFD, 0x2B, 0x50, 0x51, 0xC2, 0x9C, 0x37, 0xA4, 0xD8, 0xF2,
+    0x2E, 0x71, 0x48, 0x06, 0x11, 0x81, 0x71, 0x1B, 0x28, 0xF9, 0xC1, 0x17, 0x9E, 0xDA, 0x8B, 0x16,
+    0x06, 0x13, 0xF0, 0xE0, 0xA5, 0x57, 0x26, 0x86, 0x77, 0x29, 0x41, 0xCA, 0x42, 0xC3, 0x4E, 0xB4,
+    0x4E, 0xD7, 0x6E, 0x15, 0x55, 0x47, 0x32, 0x58, 0x71, 0x73, 0x2C, 0xAD, 0xD4, 0x59, 0x9F, 0x06,
+    0x04, 0x82, 0x51, 0x2F, 0x21, 0x72, 0xD6, 0xD3, 0xA9, 0xBD, 0xD7, 0x20, 0x9E, 0x88, 0x62, 0x54,
+    0x04, 0x4F, 0xD8, 0x44, 0xE1, 0xC8, 0x23, 0x49, 0x58, 0xA3, 0x0F, 0xB8, 0x59, 0xB0, 0x1C, 0x2D,
+    0xB8, 0x8C, 0xE3, 0xB6, 0x69, 0x50, 0x9C, 0xD1, 0xC5, 0xEF, 0xB4, 0xAF, 0x36, 0xAE, 0x32, 0xC9,
+    0x6A, 0x0F, 0x6E, 0xCE, 0xE6, 0x64, 0x22, 0x3B, 0x57, 0x5B, 0xE6, 0x2F, 0xAF, 0x63, 0xEA, 0x03,
+    0x7B, 0xCC, 0xCF, 0xFF, 0x64, 0x82, 0x26, 0xCD, 0x3E, 0x93, 0x94, 0x2A, 0x20, 0x65, 0x41, 0xDE,
+    0x68, 0x0F, 0x60, 0x83, 0x94, 0xD2, 0xAF, 0x58, 0xC4, 0xAA, 0xB8, 0x66, 0x32, 0xEB, 0x16, 0x9F,
+    0xEF, 0xBC, 0x41, 0x72, 0xB7, 0x58, 0xEE, 0xA3, 0x83, 0xEA, 0x89, 0xFC, 0xA0, 0x47, 0x54, 0xBF,
+    0xFB, 0x3A, 0xA5, 0xDB, 0xDE, 0x62, 0x1E, 0x9E, 0x10, 0x66, 0x60, 0x66, 0xC2, 0x0F, 0xC0, 0xCD,
+    0x3D, 0xE0, 0xCD, 0xED, 0xCB, 0x38, 0xA9, 0xAB, 0x91, 0x5C, 0xEE, 0x4A, 0x2D, 0x65, 0x51, 0xE7,
+    0x9D, 0x69, 0x92, 0x40, 0x20, 0x7F, 0x30, 0xC0, 0xB0, 0x9B, 0xE3, 0x40, 0x3D, 0xAC, 0xD3, 0xA4,
+    0x96, 0xCC, 0x09, 0xDD, 0x5B, 0xC6, 0x92, 0x12, 0x9C, 0xB4, 0x22, 0x6A, 0x10, 0x3D, 0x26, 0x14,
+    0xDB, 0x1A, 0x05, 0xDF, 0x78, 0xBC, 0x74, 0x7B, 0x42, 0x69, 0x92, 0xD1, 0xF3, 0xE2, 0x2F, 0xA4,
+    0xBC, 0x79, 0x21, 0xE4, 0x12, 0x64, 0x21, 0x4F, 0x64, 0x72, 0x73, 0x2A, 0x5D, 0xDE, 0x51, 0x22,
+    0x57, 0x9B, 0x3E, 0x9A, 0x19, 0x07, 0x35, 0x15, 0x86, 0xCA, 0x23, 0xDB, 0x19, 0x36, 0x26, 0x8B,
+    0x5D, 0x7F, 0x80, 0xCF, 0xBE, 0x56, 0x21, 0x79, 0xB4, 0x8E, 0x16, 0x9A, 0xEE, 0x44, 0x23, 0xF4,
+    0xA2, 0x3D, 0x30, 0x2D, 0x9E, 0xC7, 0x7D, 0x1D, 0x1A, 0xA4, 0x40, 0xB2, 0xE5, 0x95, 0x8E, 0x3E,
+    0xF0, 0x6F, 0x74, 0x23, 0xD5, 0x6B, 0xAF, 0xBF, 0x1C, 0x26, 0x2D, 0xDB, 0xB2, 0xC5, 0xEE, 0xE7,
+    0xAC, 0x87, 0x7C, 0xFD, 0x52, 0x74, 0xED, 0xA9, 0xDD, 0xAA, 0x5A, 0x71, 0x5A, 0x3C, 0xE6, 0x5B,
+    0x4B, 0x75, 0x92, 0x84, 0x68, 0x30, 0x7D, 0xDA, 0xD8, 0xE6, 0x2D, 0x85, 0xD6, 0xAA, 0x52, 0x2E,
+    0x4A, 0xE5, 0x9F, 0x5B, 0x9D, 0x14, 0x6C, 0x04, 0xCD, 0x93, 0x5F, 0x52, 0xA4, 0xE5, 0x00, 0xC3,
+    0xE0, 0xDF, 0x5F, 0xD8, 0x58, 0x91, 0x7B, 0x04, 0x75, 0x77, 0x87, 0xBC, 0xFB, 0x32, 0x1D, 0x4D,
+    0x34, 0xC7, 0xA5, 0xAB, 0x39, 0x2D, 0x90, 0x32, 0x9D, 0xAC, 0x78, 0x6E, 0xBC, 0x2C, 0x2D, 0xAD,
+    0x39, 0xE6, 0xFD, 0xFD, 0xF5, 0xF5, 0xFA, 0xAA, 0xEF, 0x0E, 0x34, 0x0F, 0xE6, 0x99, 0x46, 0x9D,
+    0x04, 0xA7, 0x47, 0x97, 0x83, 0x96, 0xF9, 0x3D, 0xD4, 0x26, 0x5D, 0x66, 0xED, 0xCC, 0x31, 0xA8,
+    0xD3, 0x8D, 0x1C, 0xE3, 0x69, 0xA1, 0xE7, 0x4B, 0x25, 0x5A, 0xB4, 0x4A, 0x99, 0x23, 0x46, 0x0E,
+    0x17, 0x03, 0x07, 0x2A, 0x0D, 0xE4, 0xAC, 0x86, 0x7C, 0x54, 0x03, 0x64, 0xB9, 0x51, 0x34, 0x7A,
+    0xC3, 0xF4, 0x6A, 0xE0, 0xBC, 0xA7, 0xE1, 0x9B, 0x29, 0x61, 0x07, 0xCA, 0xC4, 0x29, 0x2C, 0x32,
+    0x12, 0x03, 0xAF, 0x3C, 0x36, 0x23, 0x4A, 0xB6, 0x50, 0x73, 0x46, 0x95, 0x2A, 0x6F, 0x5C, 0x37,
+    0xB3, 0x1F, 0xB4, 0xAD, 0x66, 0x16, 0x53, 0xCD, 0xC9, 0x5F, 0xB4, 0xE9, 0xA0, 0x0C, 0x5C, 0xA5,
+    0x4B, 0x99, 0x75, 0x29, 0x83, 0x9E, 0xDA, 0x1F, 0xB9, 0xFC, 0x28, 0xE8, 0xB2, 0xD0, 0xE5, 0xC7,
+    0x63, 0xC1, 0xD9, 0x28, 0x19, 0x47, 0x8E, 0xDC, 0xD1, 0x99, 0xB7, 0x1E, 0x0A, 0xFF, 0xA5, 0xD2,
+    0xDB, 0xF3, 0x8A, 0x3A, 0xB4, 0x91, 0x7B, 0xF4, 0xEF, 0x2A, 0x31, 0x18, 0xFD, 0xCF, 0xA5, 0x84,
+    0x0B, 0xE0, 0x3D, 0x66, 0x9A, 0xB5, 0x10, 0x4F, 0xD7, 0x54, 0xEA, 0xDC, 0x9D, 0x31, 0xEF, 0xF6,
+    0x16, 0x95, 0xD8, 0xE2, 0x01, 0xDF, 0xBD, 0x78, 0x45, 0xA5, 0xD2, 0xAA, 0x83, 0xEF, 0x81, 0x0F,
+    0x10, 0x3F, 0x2D, 0xE1, 0x1B, 0x6C, 0x97, 0xF8, 0xFF, 0x9E, 0xBF, 0x01, 0x9D, 0x55, 0xBF, 0x6F,
+    0x1D, 0x45, 0x10, 0x9E, 0xBB, 0xB5, 0x7D, 0xC1, 0x67, 0x69, 0x53, 0xD8, 0x45, 0x84, 0xA5, 0x6B,
+    0x52, 0xC4, 0x28, 0xD2, 0xA5, 0x48, 0xE1, 0x22, 0x7E, 0x7B, 0xE0, 0x22, 0x45, 0x0A, 0xBF, 0x22,
+    0x6E, 0x03, 0x48, 0x08, 0x29, 0x0D, 0x44, 0x82, 0x82, 0xE2, 0x3D, 0xDF, 0xC5, 0x48, 0x44, 0x54,
+    0x44, 0x88, 0x3F, 0x20, 0x12, 0x14, 0xE8, 0x51, 0x40, 0x13, 0x29, 0x85, 0xF3, 0x6E, 0x6D, 0x17,
+    0x96, 0xA8, 0x2E, 0xF1, 0x1F, 0x90, 0x23, 0xA1, 0x32, 0x45, 0x16, 0x71, 0xC5, 0x11, 0xEF, 0xDD,
+    0xF0, 0xED, 0xD9, 0x0F, 0x53, 0xE4, 0x27, 0x7B, 0x77, 0x7B, 0xFB, 0xE3, 0x9B, 0xD9, 0x6F, 0x67,
+    0x66, 0x67, 0x17, 0xD6, 0x93, 0xF5, 0x3E, 0xF3, 0x15, 0x7E, 0xC8, 0xF5, 0xDB, 0x2D, 0xB1, 0x8E,
+    0x35, 0xF1, 0x4D, 0x4B, 0x1E, 0xCB, 0x82, 0x7C, 0x6E, 0x09, 0x55, 0x49, 0x24, 0x98, 0x88, 0xC2,
+    0x06, 0x55, 0x6E, 0x89, 0x82, 0x43, 0x54, 0x6A, 0xAD, 0x26, 0x51, 0xCB, 0x8A, 0x62, 0x1D, 0x1B,
+    0xBF, 0x21, 0x55, 0xA6, 0x4C, 0x6A, 0x87, 0x2D, 0xE5, 0x09, 0x91, 0x07, 0x49, 0x0A, 0x2A, 0x54,
+    0xA9, 0x06, 0xB6, 0x93, 0xCC, 0xC8, 0x15, 0xD5, 0x28, 0xCB, 0x26, 0x2D, 0xD2, 0x6D, 0x20, 0xBF,
+    0xD1, 0x9D, 0xC2, 0xBC, 0x20, 0xC2, 0x0A, 0x12, 0x42, 0xE3, 0x86, 0xC2, 0xDF, 0x30, 0xE3, 0x5B,
+    0xD9, 0x88, 0x3A, 0xAF, 0x9D, 0x0E, 0x09, 0x06, 0xE0, 0x45, 0xE3, 0x4E, 0xA5, 0xE0, 0x8C, 0xC2,
+    0xDF, 0x69, 0xE1, 0x05, 0xCC, 0xC9, 0x31, 0xF7, 0xF8, 0xFE, 0x11, 0x73, 0x8F, 0xB1, 0x87, 0x80,
+    0xB9, 0x06, 0x91, 0x8E, 0x79, 0xED, 0x98, 0x57, 0x8E, 0xB9, 0xF9, 0x97, 0xB9, 0x49, 0x39, 0xE0,
+    0x96, 0x6D, 0xCC, 0xC6, 0xB1, 0x53, 0x75, 0x54, 0x05, 0x36, 0xD2, 0x5E, 0xAB, 0x3A, 0x29, 0x2F,
+    0xFD, 0x3B, 0x81, 0x0A, 0x4D, 0xAA, 0xEE, 0xF8, 0xF9, 0x75, 0x9E, 0x84, 0x46, 0x15, 0xAA, 0x4A,
+    0x6D, 0x5E, 0xB3, 0x9D, 0xF9, 0x78, 0x52, 0x60, 0xA8, 0xB9, 0x38, 0x33, 0x6A, 0xFB, 0xBB, 0xB7,
+    0xE8, 0xF6, 0x73, 0xDF, 0xCE, 0x04, 0x05, 0x2D, 0xAF, 0x5F, 0x3B, 0xF8, 0x59, 0x2F, 0xEA, 0x3B,
+    0xDB, 0x99, 0xA6, 0x97, 0x3D, 0x89, 0x33, 0x23, 0x2D, 0xD2, 0xDD, 0xF5, 0x67, 0x3F, 0x5D, 0x14,
+    0xB3, 0xC2, 0x5F, 0x25, 0xF1, 0xD2, 0xC7, 0x8B, 0x79, 0x8D, 0x9F, 0x70, 0x75, 0xFC, 0x5B, 0x58,
+    0x5F, 0x5F, 0x63, 0xFE, 0x8B, 0xD9, 0x8E, 0x46, 0xA3, 0x94, 0xF9, 0x29, 0x73, 0x35, 0xEA, 0x4A,
+    0xCE, 0x27, 0xC5, 0x3E, 0x67, 0xE8, 0xEA, 0xB4, 0x0A, 0x9F, 0xEE, 0x1C, 0x9A, 0xB1, 0x8D, 0xF3,
+    0x37, 0x69, 0x8C, 0x66, 0x6E, 0x43, 0x1C, 0x4B, 0x1D, 0x8C, 0x46, 0x3F, 0x80, 0xFD, 0x49, 0xC7,
+    0x4B, 0x06, 0x72, 0xD3, 0x28, 0x61, 0xD4, 0x26, 0x0C, 0x39, 0xED, 0xC3, 0xC4, 0x56, 0xEA, 0x3A,
+    0x16, 0xF0, 0x3E, 0x8C, 0x1A, 0x77, 0xBD, 0x48, 0x14, 0xF3, 0x6E, 0x4E, 0x7D, 0x69, 0x94, 0x57,
+    0xC9, 0xEC, 0x12, 0x62, 0x29, 0xE9, 0x47, 0x81, 0xAE, 0x7B, 0xE1, 0x8E, 0x51, 0x52, 0x5B, 0x25,
+    0xEA, 0x36, 0x7C, 0x0C, 0x0D, 0x34, 0xED, 0x25, 0x79, 0xBC, 0x6D, 0x53, 0x61, 0xAC, 0xDC, 0x35,
+    0x3D, 0x28, 0xDF, 0x92, 0xAB, 0x45, 0x67, 0x62, 0x1A, 0xC7, 0x9B, 0x36, 0x9F, 0x4C, 0xDC, 0x34,
+    0x03, 0x4C, 0xCC, 0x4F, 0x1F, 0x49, 0xEC, 0xD6, 0x2D, 0x46, 0xA1, 0x6A, 0x18, 0x25, 0x75, 0x8F,
+    0xCC, 0x25, 0x87, 0xBF, 0x8E, 0x28, 0x84, 0xB7, 0x89, 0x36, 0xE8, 0xEC, 0xCA, 0x19, 0xC5, 0x2D,
+    0xDE, 0xA5, 0x95, 0x33, 0xB4, 0x42, 0xC7, 0x6F, 0xAF, 0x7B, 0x37, 0x3A, 0x4C, 0xDA, 0x2D, 0xB1,
+    0x34, 0x69, 0xF7, 0x4E, 0x44, 0xD0, 0x70, 0xB0, 0x6E, 0x10, 0x52, 0xBD, 0x8D, 0x4F, 0xDC, 0xF8,
+    0x78, 0x7C, 0x2C, 0x9E, 0x76, 0xAB, 0x4C, 0x21, 0x4E, 0x2C, 0x3F, 0x6A, 0x78, 0x1F, 0xBB, 0x38,
+    0x4B, 0x51, 0x11, 0xF0, 0xBB, 0xDC, 0xA4, 0xFC, 0x88, 0x6F, 0xB5, 0x5E, 0x4D, 0xA7, 0x89, 0xCE,
+    0x44, 0x7F, 0x34, 0xED, 0x14, 0xCD, 0x24, 0x1F, 0xA9, 0x9D, 0x46, 0xED, 0xB7, 0xA8, 0xA7, 0xA9,
+    0x3F, 0x93, 0xCC, 0x24, 0x5E, 0xC2, 0x94, 0x66, 0x6A, 0xB7, 0xF1, 0x5B, 0x9C, 0x51, 0x13, 0x54,
+    0xC2, 0x62, 0x5B, 0xB0, 0x51, 0xFC, 0xFE, 0xA1, 0x6D, 0x26, 0xE1, 0x95, 0x5C, 0x2B, 0xDE, 0x2C,
+    0xBC, 0xBC, 0x67, 0xC1, 0xEB, 0x85, 0x17, 0x3C, 0x95, 0x85, 0xE5, 0xD2, 0x8F, 0x1F, 0x7E, 0xED,
+    0x65, 0xAF, 0x7E, 0xE0, 0xBC, 0x29, 0x9A, 0xBD, 0x48, 0xB3, 0xCB, 0x0B, 0xD7, 0xCE, 0x1D, 0x6C,
+    0x7D, 0xE6, 0xED, 0xCD, 0x2D, 0xDE, 0xB8, 0xF0, 0x15, 0x56, 0x16, 0x44, 0x73, 0x44, 0x17, 0xE8,
+    0x15, 0x4D, 0xD8, 0x02, 0xE6, 0x5A, 0xBC, 0xE3, 0xFF, 0x4A, 0xE7, 0xEF, 0x5E, 0xDD, 0x3F, 0xF8,
+    0x65, 0x3F, 0xD1, 0xDF, 0xAF, 0xD2, 0xB7, 0xAF, 0x23, 0x3B, 0x69, 0x4E, 0xD1, 0xA4, 0x5C, 0x27,
+    0x0F, 0xA9, 0x04, 0x49, 0xC1, 0x90, 0x75, 0xFD, 0x66, 0x4C, 0x43, 0xF7, 0xBF, 0x2F, 0xB5, 0xEA,
+    0x72, 0x93, 0x30, 0x91, 0xFB, 0x4B, 0xBD, 0x25, 0x5D, 0xB6, 0x42, 0xA8, 0x86, 0xDA, 0x0D, 0x20,
+    0x8C, 0x5C, 0x5C, 0x25, 0xF1, 0xE5, 0xC7, 0x26, 0x87, 0xBB, 0x04, 0x9B, 0xAA, 0x6D, 0x02, 0x36,
+    0x71, 0x59, 0x0F, 0x11, 0x4C, 0xC8, 0x36, 0x83, 0x58, 0x98, 0x3A, 0xCA, 0xA8, 0x07, 0xE1, 0xA1,
+    0x28, 0x09, 0xDD, 0x18, 0xF1, 0x45, 0x32, 0xB3, 0x72, 0xAF, 0x1C, 0x52, 0xA8, 0xE3, 0xD5, 0xD2,
+    0xC6, 0x14, 0x14, 0xE2, 0xD0, 0xC4, 0x4F, 0x33, 0x61, 0x28, 0x35, 0x2E, 0x97, 0x7D, 0x0E, 0xE7,
+    0xC1, 0x83, 0xFF, 0x29, 0x32, 0x53, 0x48, 0x7F, 0x05, 0xC2, 0x57, 0x26, 0xF3, 0x6E, 0x40, 0x94,
+    0x03, 0x61, 0xDA, 0xD0, 0x34, 0xF2, 0xA1, 0x8D, 0x77, 0x2B, 0x15, 0x96, 0x2B, 0xA1, 0x9E, 0xF7,
+    0x8F, 0xD0, 0xBD, 0x40, 0x57, 0x98, 0x8D, 0x74, 0x2E, 0xF7, 0x2D, 0x00, 0xEA, 0x3D, 0xAB, 0xAE,
+    0x94, 0xC0, 0x58, 0x51, 0x6C, 0x41, 0x81, 0x4F, 0x7D, 0xA0, 0xEE, 0x05, 0x46, 0x96, 0xB1, 0x56,
+    0x49, 0x4A, 0x5B, 0xE4, 0xF6, 0x86, 0x63, 0xA7, 0xAE, 0x18, 0xB5, 0x67, 0xA2, 0xDD, 0x1A, 0x19,
+    0x57, 0x98, 0xB1, 0x67, 0x7A, 0xD4, 0x3F, 0xE5, 0x54, 0xFA, 0x06, 0xFA, 0x31, 0x6B, 0x85, 0x4D,
+    0x65, 0x09, 0x40, 0x4A, 0x63, 0xD4, 0xC0, 0x48, 0x1D, 0x81, 0x0C, 0x60, 0xE0, 0xFC, 0x01, 0x05,
+    0x25, 0xA5, 0x65, 0xF0, 0xA4, 0xDC, 0x10, 0xE5, 0x11, 0x97, 0x81, 0x5F, 0x23, 0x33, 0x62, 0x15,
+    0xA5, 0x65, 0x29, 0x6A, 0x2C, 0x05, 0x65, 0x65, 0x60, 0x42, 0x13, 0x56, 0xB2, 0xCC, 0x2F, 0x57,
+    0xCA, 0x37, 0xC7, 0x9B, 0xBC, 0x41, 0x74, 0x7E, 0x10, 0xE8, 0x41, 0x1C, 0x3E, 0x30, 0xE1, 0xEE,
+    0x2D, 0xED, 0x3B, 0xD3, 0xDF, 0x5B, 0xA1, 0x53, 0xBD, 0xAA, 0xAF, 0xE4, 0x83, 0xDA, 0x7D, 0x53,
+    0x68, 0x53, 0xBD, 0x02, 0x15, 0x32, 0x09, 0xF7, 0x6E, 0x69, 0x87, 0x75, 0x32, 0x90, 0x3D, 0xE7,
+    0x74, 0xCC, 0x66, 0xEF, 0x48, 0x83, 0xF3, 0x2C, 0xFF, 0xC4, 0x5D, 0x91, 0x26, 0xAD, 0x2C, 0x90,
+    0x36, 0x64, 0x61, 0x45, 0xA5, 0xA8, 0x91, 0x30, 0xB8, 0x09, 0x0B, 0xEB, 0x57, 0x31, 0x0D, 0x03,
+    0x2D, 0x93, 0x2E, 0x94, 0x4E, 0xC7, 0x3A, 0x5D, 0x33, 0x6A, 0xDF, 0x86, 0x66, 0x9E, 0xFA, 0x27,
+    0xC9, 0x29, 0xAE, 0x90, 0x2E, 0x93, 0x23, 0x6A, 0xCB, 0xB8, 0xEB, 0xE0, 0x76, 0x1C, 0xCE, 0xD8,
+    0xD9, 0x9E, 0xDC, 0x36, 0x20, 0xEE, 0xA8, 0x0F, 0x9D, 0x77, 0xC8, 0x33, 0xDD, 0x69, 0x3E, 0x01,
+    0x05, 0x88, 0x0E, 0x44, 0x54, 0x74, 0x04, 0x72, 0xCE, 0xF4, 0xDC, 0x62, 0x3E, 0x67, 0x61, 0x4B,
+    0xB8, 0x17, 0xD9, 0x0A, 0xB6, 0x92, 0xCD, 0xD9, 0xA8, 0xE8, 0xA7, 0x19, 0x29, 0x87, 0x06, 0x32,
+    0xD0, 0x4E, 0x78, 0x8B, 0x3E, 0x35, 0x5E, 0xAE, 0xF3, 0xC6, 0xE3, 0x4A, 0x72, 0x82, 0xCB, 0x92,
+    0x13, 0x5C, 0x4B, 0x61, 0x37, 0xF9, 0x05, 0xD1, 0xC4, 0x62, 0x53, 0xEE, 0x38, 0x84, 0x06, 0xF9,
+    0x02, 0x00, 0xD1, 0xB8, 0x26, 0xEE, 0x3C, 0x04, 0x48, 0x9F, 0xFE, 0x77, 0xF9, 0x07, 0x8D, 0x55,
+    0x3D, 0x6C, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0x93, 0x68, 0x23, 0xAF, 0xD0, 0x5A, 0x22, 0x11, 0x24,
+    0xA0, 0x2C, 0x45, 0x0A, 0x04, 0x24, 0xDB, 0x50, 0x50, 0xC4, 0x37, 0x93, 0x44, 0x28, 0x12, 0x14,
+    0xB1, 0x84, 0x5D, 0x51, 0x40, 0x0B, 0x14, 0x6E, 0x28, 0x52, 0x04, 0xEF, 0xC6, 0x2E, 0x52, 0xA4,
+    0x71, 0x01, 0x42, 0xA2, 0x21, 0x05, 0x0D, 0x9B, 0xC2, 0x42, 0x4A, 0x91, 0xE2, 0xEE, 0x76, 0x8C,
+    0x85, 0xAE, 0x48, 0xE1, 0x23, 0x26, 0x35, 0x1B, 0x47, 0x51, 0x0A, 0x8A, 0x4C, 0xF0, 0x42, 0xD6,
+    0x66, 0x6E, 0x1F, 0xDF, 0xEC, 0x5E, 0x0C, 0x08, 0x21, 0x31, 0x77, 0xA3, 0x9B, 0x79, 0x33, 0xEF,
+    0x7B, 0x6F, 0xBE, 0xF7, 0x73, 0x1E, 0xD1, 0xCC, 0x0A, 0x67, 0xC2, 0xA6, 0x4C, 0x72, 0x95, 0xAD,
+    0xA8, 0x4F, 0xC5, 0x63, 0xA9, 0x48, 0x8A, 0x8A, 0x7C, 0x23, 0x89, 0x12, 0x61, 0x68, 0x09, 0x8B,
+    0x62, 0x22, 0x4C, 0xC4, 0x4A, 0x12, 0x2B, 0xDF, 0x84, 0x9A, 0x12, 0xBA, 0x4C, 0x9E, 0x21, 0x37,
+    0x0E, 0x11, 0xCD, 0x86, 0x86, 0x12, 0xCD, 0x4A, 0x4C, 0xB0, 0x90, 0xFA, 0x28, 0xD1, 0xFC, 0x4C,
+    0x76, 0x88, 0x84, 0x0D, 0x1B, 0x92, 0x57, 0xD9, 0x06, 0x55, 0xC4, 0x26, 0x55, 0x6B, 0xE9, 0x85,
+    0x8A, 0xC8, 0x02, 0x36, 0xDC, 0x84, 0x6E, 0x5F, 0x92, 0x57, 0x6C, 0x1A, 0x9F, 0x2B, 0x49, 0x12,
+    0xF8, 0x62, 0x02, 0xD8, 0x04, 0xB0, 0x5E, 0xD9, 0x02, 0xD3, 0x2C, 0x3E, 0x89, 0x4E, 0xB4, 0xB0,
+    0x38, 0x92, 0x58, 0xD0, 0x3C, 0x3E, 0xA4, 0x88, 0x64, 0xED, 0x6F, 0x73, 0x53, 0x2C, 0x9D, 0xE7,
+    0xFA, 0x14, 0x0D, 0x15, 0x1D, 0x8C, 0xE8, 0xAA, 0x99, 0x0B, 0xB4, 0x8C, 0xEE, 0x5B, 0xB9, 0x62,
+    0xE5, 0xA5, 0x27, 0x93, 0xE8, 0x2E, 0x7E, 0x4C, 0x11, 0xDD, 0xAD, 0xA5, 0x30, 0xC3, 0xE8, 0xFB,
+    0x2A, 0x3A, 0x6F, 0xE6, 0xA2, 0xEC, 0xA8, 0x4F, 0xF3, 0x47, 0x88, 0x3E, 0xA2, 0x98, 0xBD, 0x86,
+    0xA3, 0xF1, 0x44, 0xFA, 0x7B, 0x75, 0xF0, 0xA8, 0x8C, 0xBF, 0xCE, 0x06, 0xB8, 0xD8, 0x24, 0x1B,
+    0x6C, 0xBD, 0x22, 0x73, 0x90, 0x9E, 0xA2, 0x21, 0x05, 0x35, 0xC9, 0x52, 0x3C, 0xCE, 0x92, 0x9E,
+    0x67, 0xEA, 0xE8, 0xCB, 0x4A, 0x72, 0xFD, 0x71, 0xB1, 0x46, 0x35, 0x09, 0xE7, 0xEB, 0xE1, 0x45,
+    0xC1, 0x63, 0xAE, 0xAE, 0x50, 0xBC, 0x16, 0xB2, 0x7A, 0xDF, 0x40, 0x21, 0x56, 0xC9, 0x08, 0xB2,
+    0x16, 0xE1, 0x38, 0xC5, 0x36, 0xDC, 0xF3, 0x2C, 0xC9, 0xCF, 0x03, 0x36, 0x83, 0xA5, 0x3B, 0xDA,
+    0x0E, 0xC2, 0x91, 0xB1, 0x92, 0x55, 0x31, 0xC6, 0xF9, 0xB1, 0xC5, 0x80, 0x11, 0x81, 0x91, 0xAE,
+    0x4E, 0xF5, 0x08, 0xE4, 0xC2, 0x96, 0xC3, 0x1D, 0xB8, 0xF5, 0x95, 0xD6, 0x85, 0x6F, 0x02, 0xDE,
+    0xBC, 0xBF, 0x57, 0xF5, 0x64, 0x7C, 0x91, 0xCF, 0xF1, 0xFD, 0x7A, 0x68, 0x23, 0x16, 0x4F, 0xB9,
+    0x4A, 0x9D, 0x75, 0x6F, 0xCD, 0xE7, 0x32, 0x2D, 0xDE, 0xD5, 0xB6, 0x1F, 0xDD, 0x29, 0x81, 0xAA,
+    0x0B, 0x87, 0x10, 0x8F, 0xD3, 0x5A, 0xD4, 0xAD, 0xFA, 0x61, 0x92, 0xC5, 0x38, 0xFE, 0xC3, 0x84,
+    0x1B, 0x7F, 0x7D, 0xE3, 0xED, 0x5A, 0x3E, 0xB2, 0x1E, 0x62, 0xCA, 0xE7, 0x27, 0x69, 0xA4, 0x07,
+    0xCB, 0x1D, 0x03, 0x49, 0xC7, 0x40, 0x51, 0x64, 0x5C, 0x83, 0x1F, 0x8C, 0x37, 0x7C, 0x56, 0x3C,
+    0xF6, 0x2B, 0x38, 0x94, 0xA8, 0xB0, 0x5D, 0x78, 0x45, 0xC9, 0x93, 0x63, 0x8B, 0x14, 0xD6, 0x82,
+    0xAB, 0x61, 0x72, 0x7D, 0xA3, 0x3E, 0x9A, 0xA8, 0xC0, 0xE0, 0x89, 0xCB, 0x94, 0x64, 0x21, 0xDB,
+    0x82, 0xF5, 0xA2, 0x0A, 0xEB, 0x88, 0x47, 0x2B, 0x55, 0xD6, 0xA7, 0x81, 0x60, 0xF5, 0x49, 0xE5,
+    0x0E, 0xBF, 0x2A, 0xEE, 0xB0, 0x06, 0x6C, 0x98, 0x51, 0x03, 0x75, 0x4A, 0x4B, 0xF1, 0x73, 0x36,
+    0xD7, 0xF3, 0xCB, 0x3A, 0xFE, 0x65, 0x0F, 0xAC, 0x52, 0x8F, 0xF0, 0x7E, 0x7F, 0x6D, 0x26, 0xBF,
+    0xC0, 0x3F, 0xEE, 0xDF, 0x00, 0xA5, 0x55, 0xC0, 0x3A, 0x68, 0x75, 0xDF, 0x29, 0x46, 0xAD, 0x6E,
+    0xAA, 0x64, 0x1D, 0x55, 0x78, 0x5B, 0xBA, 0x17, 0x72, 0x85, 0x47, 0xEB, 0xFE, 0x20, 0xDA, 0xDC,
+    0xAF, 0x63, 0xA6, 0x13, 0xEA, 0xB5, 0xFC, 0x1A, 0xDB, 0xE5, 0xF5, 0xD1, 0x8A, 0x99, 0x9D, 0xA3,
+    0x48, 0x7B, 0x15, 0xA8, 0x08, 0x4A, 0xEA, 0x3B, 0x32, 0x5F, 0xA5, 0x60, 0x12, 0xF2, 0xF6, 0x78,
+    0xAF, 0xEE, 0xC9, 0x42, 0xB0, 0xCF, 0xBF, 0x9B, 0xD4, 0x46, 0x8F, 0x2F, 0x3E, 0xE0, 0xF2, 0x44,
+    0xE6, 0xDE, 0x62, 0xF0, 0x16, 0x47, 0xE3, 0xE8, 0x37, 0x9B, 0xB0, 0x7E, 0xA9, 0xA2, 0xC2, 0x2B,
+    0x74, 0x6A, 0xBC, 0x1B, 0x8E, 0x87, 0x90, 0x79, 0x52, 0x30, 0x97, 0xC5, 0x17, 0xC3, 0xA0, 0x12,
+    0x65, 0xAA, 0x4E, 0xC3, 0x2D, 0x38, 0x43, 0x01, 0x33, 0xA5, 0x6C, 0x82, 0xBD, 0x05, 0xB7, 0xC3,
+    0xD3, 0x41, 0x00, 0xB9, 0x33, 0x24, 0x50, 0xDA, 0xED, 0xDA, 0x32, 0x09, 0x91, 0x0E, 0xCC, 0x59,
+    0x60, 0x0A, 0x92, 0xCA, 0x92, 0x15, 0x3A, 0x40, 0x19, 0x2C, 0xDD, 0x9B, 0x8F, 0x98, 0xD5, 0x0B,
+    0x93, 0x05, 0x8A, 0x1E, 0xCE, 0x03, 0x4B, 0x9F, 0x68, 0xBE, 0x25, 0x77, 0x92, 0x64, 0x34, 0xD3,
+    0xE4, 0x43, 0xC9, 0x5C, 0xC1, 0xAE, 0x9E, 0xA7, 0x05, 0xA4, 0x5A, 0x97, 0xEC, 0x02, 0x7E, 0xB4,
+    0x0B, 0x1C, 0x8E, 0xDB, 0x45, 0xBA, 0xC2, 0xDD, 0x49, 0x1D, 0x1A, 0xAF, 0x3D, 0xC9, 0xD2, 0x73,
+    0x55, 0x2B, 0x08, 0x4C, 0xA2, 0x5A, 0x41, 0x11, 0xEC, 0xAF, 0x25, 0xA5, 0xA8, 0x93, 0x07, 0xCC,
+    0x31, 0x6B, 0xD0, 0xFD, 0xFA, 0xFE, 0xAA, 0xB9, 0x22, 0x18, 0xE5, 0xA5, 0xE4, 0x05, 0x25, 0x7F,
+    0x22, 0x51, 0x21, 0xDA, 0x2E, 0x6D, 0xA4, 0x8A, 0xD0, 0x13, 0x32, 0x08, 0x90, 0xBD, 0x9D, 0xE0,
+    0xC5, 0x58, 0xCB, 0x31, 0xAA, 0xFA, 0x79, 0x0D, 0x76, 0xC6, 0x30, 0x2D, 0xD7, 0xAF, 0x41, 0x95,
+    0x78, 0x7B, 0xEA, 0x8C, 0x72, 0xB5, 0x49, 0x87, 0x89, 0x7C, 0x04, 0x32, 0xC6, 0xB3, 0xD3, 0x71,
+    0x9F, 0x98, 0xFA, 0xBE, 0xA5, 0x5B, 0x0E, 0x22, 0x81, 0x48, 0x62, 0x86, 0xEE, 0xD9, 0xFB, 0xB7,
+    0x40, 0x95, 0xA1, 0xB0, 0x72, 0x2E, 0x62, 0x36, 0x48, 0x54, 0x7E, 0xD8, 0x07, 0x63, 0xB8, 0xE0,
+    0x00, 0x17, 0xBB, 0x92, 0x7E, 0xCE, 0x95, 0xB5, 0xC6, 0x1C, 0x4F, 0x7F, 0x99, 0x79, 0x13, 0xD3,
+    0x14, 0x79, 0x6E, 0x43, 0xF7, 0xF8, 0xA1, 0x0B, 0x0E, 0x4E, 0xC8, 0x55, 0xDB, 0x91, 0xF6, 0x56,
+    0x64, 0x71, 0x4F, 0xC7, 0xC5, 0x24, 0xDC, 0xDA, 0xCA, 0xB6, 0x9F, 0x68, 0x42, 0x08, 0x64, 0x7B,
+    0x82, 0x86, 0xF6, 0xAF, 0xCD, 0xC1, 0xF0, 0x80, 0xE2, 0x39, 0x41, 0xEC, 0xE0, 0xEC, 0x81, 0xA9,
+    0x26, 0xBF, 0x09, 0x17, 0xFD, 0xE9, 0xA4, 0xBA, 0xB3, 0x73, 0xFC, 0x3F, 0x01, 0xBB, 0xCD, 0xF6,
+    0xAF, 0xDA, 0x4E, 0x00, 0x62, 0x09, 0x5F, 0x78, 0xD4, 0xEA, 0x61, 0xBC, 0xE2, 0x13, 0xF5, 0x7C,
+    0x74, 0x4A, 0x95, 0x22, 0xDD, 0x85, 0x41, 0x0C, 0x11, 0x0E, 0xE6, 0xBB, 0xFB, 0xF9, 0x7A, 0x89,
+    0x3A, 0x2A, 0x5D, 0x0C, 0x69, 0x0E, 0xFD, 0xD5, 0x43, 0x07, 0xA4, 0x4F, 0x5D, 0x2E, 0xA5, 0x28,
+    0x83, 0x6A, 0xB9, 0xA9, 0x76, 0x77, 0x35, 0x90, 0xA5, 0xB3, 0x22, 0x8C, 0x77, 0xE9, 0x87, 0x58,
+    0xCE, 0x49, 0x06, 0x02, 0x49, 0xE3, 0xA4, 0xB3, 0xAD, 0x01, 0x14, 0x57, 0x47, 0x00, 0x6C, 0x07,
+    0x5B, 0x5B, 0xEA, 0xBD, 0x27, 0xAA, 0xF3, 0x0A, 0x0A, 0xDE, 0xEE, 0xEE, 0x18, 0x1A, 0xC8, 0x75,
+    0xA7, 0xE2, 0x97, 0xC8, 0x48, 0xB4, 0x0C, 0xC6, 0x53, 0x75, 0x9B, 0x3E, 0x86, 0x3A, 0xFC, 0xB6,
+    0xB5, 0x45, 0xD9, 0x5B, 0x3D, 0xBF, 0xAE, 0x93, 0xD5, 0x9D, 0x2A, 0x5A, 0xE7, 0x86, 0xB9, 0x6E,
+    0xF2, 0x35, 0x4B, 0xDE, 0x84, 0x50, 0x57, 0x9E, 0xFA, 0xFB, 0x7D, 0xE7, 0x8F, 0x8B, 0x42, 0x12,
+    0x52, 0x7F, 0xE8, 0x9B, 0x61, 0xA8, 0x97, 0x13, 0xB4, 0x68, 0x9E, 0xE4, 0xEB, 0x8E, 0x7D, 0x10,
+    0xFA, 0x19, 0xB9, 0xEE, 0xDD, 0x39, 0x88, 0xB0, 0x25, 0xEA, 0x65, 0x34, 0x12, 0xEB, 0x55, 0xB1,
+    0x0E, 0x36, 0x90, 0x2E, 0xF0, 0x00, 0x4D, 0x10, 0x25, 0x98, 0xE7, 0xD9, 0x00, 0x77, 0x9A, 0x29,
+    0xD1, 0xD9, 0x54, 0x47, 0x64, 0xAD, 0xB5, 0x6E, 0x82, 0x29, 0xE1, 0x82, 0xB3, 0x9F, 0xE7, 0x37,
+    0xDC, 0xDF, 0x50, 0x82, 0x8D, 0x8F, 0xA9, 0x93, 0xB7, 0x17, 0x3F, 0xF4, 0x9D, 0x44, 0x3A, 0x95,
+    0x67, 0xFF, 0x0C, 0x5E, 0x27, 0x10, 0x28, 0x11, 0x89, 0xDE, 0x5A, 0xA3, 0x00, 0x77, 0xD0, 0x40,
+    0xAF, 0xA7, 0xC1, 0xC9, 0xD3, 0x6F, 0xD2, 0xE5, 0x5B, 0xE4, 0xED, 0x8C, 0x29, 0xBC, 0xAE, 0xE8,
+    0xCC, 0x19, 0xA2, 0xDB, 0xB7, 0xC9, 0xDF, 0x29, 0xB1, 0xCD, 0xDA, 0xED, 0xC1, 0x08, 0xBB, 0xE7,
+    0x3A, 0xA4, 0x5E, 0x7E, 0xD3, 0xB8, 0xE4, 0xF0, 0x73, 0x2C, 0x20, 0x39, 0x0B, 0x06, 0x1B, 0x08,
+    0x1A, 0x7F, 0x71, 0x61, 0x19, 0xFB, 0xDE, 0xD4, 0x81, 0x60, 0xAA, 0x3A, 0x3B, 0xFB, 0x0F, 0xC8,
+    0xA9, 0x85, 0x00, 0x06, 0x4F, 0x9E, 0x26, 0x67, 0xFF, 0xBB, 0x9D, 0xED, 0xD5, 0x3F, 0xAE, 0x17,
+    0xA2, 0x49, 0x8C, 0x5F, 0x0F, 0xC9, 0x7F, 0x5A, 0x92, 0x0F, 0x02, 0xFC, 0x67, 0xFF, 0x84, 0xE8,
+    0x1E, 0x91, 0x40, 0x5A, 0xA3, 0x97, 0x46, 0xF7, 0x3E, 0xD0, 0x8E, 0xAB, 0x08, 0xB6, 0x47, 0x88,
+    0x99, 0xEB, 0x0D, 0x68, 0xB4, 0xA8, 0x38, 0x8B, 0xD4, 0x8D, 0x34, 0x02, 0x6D, 0xCE, 0xD2, 0xFF,
+    0x1B, 0x7F, 0x02, 0xA5, 0x55, 0xBF, 0x6F, 0xE5, 0x44, 0x10, 0x1E, 0xDB, 0xBC, 0x58, 0xC2, 0xA0,
+    0xBD, 0x82, 0x34, 0x5C, 0xE1, 0x9E, 0xC6, 0xFF, 0x40, 0xC2, 0x9A, 0x34, 0x57, 0x50, 0xDC, 0x09,
+    0xC5, 0x47, 0x19, 0xEA, 0x6B, 0x5E, 0x4B, 0x91, 0xC4, 0x06, 0x0A, 0x4A, 0x10, 0x12, 0x15, 0xC5,
+    0x35, 0x87, 0x74, 0x38, 0x45, 0x1A, 0x0A, 0x8A, 0x97, 0x67, 0x73, 0x29, 0xAE, 0xB8, 0xC6, 0xFC,
+    0x90, 0xAE, 0xA0, 0xC0, 0x87, 0x80, 0xE2, 0x52, 0xB0, 0x39, 0x19, 0xE1, 0x24, 0xEB, 0x1D, 0xBE,
+    0xB1, 0x93, 0x10, 0x21, 0x1D, 0x02, 0xB1, 0x7A, 0xFB, 0x64, 0xEF, 0xCC, 0xCE, 0x7E, 0xDF, 0xCC,
+    0x37, 0xEB, 0xD5, 0x94, 0xBC, 0xB7, 0x1C, 0xD1, 0x32, 0x36, 0xA4, 0x6A, 0x4E, 0x3D, 0x1B, 0xF5,
+    0xA4, 0x53, 0xFD, 0x74, 0xCF, 0x04, 0xCC, 0x8E, 0x12, 0xE6, 0x9A, 0x98, 0x7A, 0x52, 0x5D, 0x92,
+    0x52, 0xFE, 0x81, 0xA1, 0xC0, 0xEE, 0x10, 0x25, 0x3F, 0xD4, 0xE4, 0xB9, 0x9E, 0x48, 0x31, 0x11,
+    0x55, 0x2D, 0x51, 0x30, 0xE0, 0x41, 0x17, 0xF8, 0x4B, 0x31, 0x57, 0x52, 0xD2, 0x8E, 0x34, 0xB7,
+    0x2F, 0xFB, 0x76, 0x5C, 0x56, 0x2D, 0xE1, 0xA9, 0x62, 0x8F, 0xF9, 0x6B, 0x37, 0x37, 0x83, 0xDF,
+    0x2F, 0xC9, 0xE1, 0x9C, 0xAD, 0x5A, 0x3D, 0x34, 0xE1, 0x13, 0x1B, 0x74, 0xB9, 0x6F, 0xD5, 0xAF,
+    0xD6, 0x67, 0x4B, 0x09, 0xE2, 0x62, 0xAC, 0x66, 0x59, 0xCC, 0xFC, 0x98, 0xB9, 0xFF, 0xF4, 0x36,
+    0x10, 0x56, 0x05, 0x25, 0x2D, 0x01, 0x9D, 0xEF, 0x34, 0xF3, 0x47, 0xCC, 0x3F, 0x95, 0x9F, 0xC9,
+    0xCB, 0xA5, 0xE5, 0xC4, 0xED, 0xB9, 0x8A, 0x79, 0x2E, 0x88, 0xC7, 0xF1, 0xE2, 0x89, 0xD7, 0x80,
+    0xC4, 0xDD, 0x34, 0x67, 0xEE, 0x80, 0xAF, 0xAA, 0x35, 0xB8, 0xBC, 0x31, 0x90, 0x72, 0x91, 0xA1,
+    0x53, 0xAB, 0x53, 0xF5, 0xA1, 0x19, 0xA8, 0x57, 0x87, 0x46, 0x15, 0xB9, 0x6A, 0x7A, 0xCF, 0xEA,
+    0x9B, 0x45, 0x64, 0x9C, 0x25, 0xFD, 0x3E, 0xD7, 0x9E, 0x0D, 0x2C, 0xC5, 0xAD, 0x72, 0x6F, 0x33,
+    0x80, 0xB3, 0x89, 0x1E, 0xF2, 0x40, 0x2F, 0x51, 0x46, 0x17, 0xE3, 0x2B, 0xCC, 0x91, 0x7E, 0x03,
+    0x8A, 0xC0, 0x1C, 0xE3, 0x45, 0xED, 0x37, 0x14, 0x7E, 0x67, 0x29, 0x30, 0x78, 0xE9, 0xE3, 0x96,
+    0x16, 0x08, 0xA2, 0x89, 0xD3, 0xB8, 0x40, 0xA8, 0x3A, 0xB0, 0xA1, 0x21, 0xDE, 0xE8, 0x28, 0xC6,
+    0xC1, 0xA1, 0x05, 0x30, 0xC1, 0xCB, 0xCD, 0x2C, 0xCB, 0x32, 0xC5, 0x23, 0x5B, 0x36, 0x9C, 0xFA,
+    0x16, 0x84, 0x86, 0xBF, 0xED, 0x0C, 0x5A, 0xAA, 0x64, 0x67, 0x6B, 0xA7, 0x1A, 0x54, 0x73, 0x1C,
+    0xF9, 0x5B, 0x41, 0x81, 0xF0, 0xAD, 0x0C, 0xCE, 0xEE, 0x50, 0x06, 0xC9, 0xDD, 0x35, 0x41, 0x97,
+    0x65, 0xE9, 0x75, 0x04, 0x43, 0x01, 0xAD, 0x3E, 0x2D, 0xBF, 0x40, 0x40, 0x52, 0x70, 0xC2, 0xF9,
+    0x52, 0x09, 0x12, 0x4A, 0x2C, 0xF3, 0xE8, 0xB4, 0x2C, 0x4B, 0x59, 0xC8, 0xD3, 0xC9, 0xC3, 0xE3,
+    0x54, 0xB8, 0xB0, 0x43, 0xAD, 0xB8, 0x5E, 0x41, 0x0C, 0x18, 0x5F, 0x91, 0xEA, 0x12, 0xCD, 0xE6,
+    0xDF, 0x7B, 0xD8, 0xE4, 0xC3, 0x72, 0xC8, 0x7B, 0xEE, 0x13, 0x47, 0x03, 0x52, 0xA0, 0x29, 0xA7,
+    0xA4, 0x48, 0x6A, 0xD5, 0x44, 0x30, 0x9C, 0x61, 0xBA, 0xAA, 0x74, 0xE5, 0x7E, 0xBD, 0x4B, 0xA1,
+    0xC8, 0x86, 0x55, 0x4D, 0xF1, 0x19, 0x14, 0x00, 0x4B, 0x8B, 0xC8, 0x22, 0x04, 0xD9, 0x85, 0x63,
+    0xCE, 0x4B, 0x45, 0x80, 0x5A, 0x48, 0x92, 0xE1, 0x61, 0xAB, 0x8F, 0x01, 0x06, 0x4A, 0x4A, 0x60,
+    0xBC, 0x12, 0xB0, 0x2C, 0xEF, 0x62, 0x21, 0x18, 0xB1, 0xFF, 0x92, 0x65, 0x62, 0xA9, 0x73, 0x41,
+    0x77, 0xBB, 0xBC, 0x07, 0xB2, 0x50, 0x1B, 0x17, 0x4A, 0x60, 0x97, 0xA5, 0x08, 0x52, 0x94, 0x41,
+    0x5A, 0x76, 0x20, 0x2D, 0x24, 0xCA, 0xE0, 0x7D, 0x4C, 0xB0, 0xDD, 0x93, 0x1C, 0xB9, 0x73, 0xC6,
+    0xE2, 0x91, 0x7F, 0x2B, 0x35, 0x90, 0xA9, 0xD9, 0xA5, 0x34, 0x83, 0x29, 0x00, 0xE9, 0x99, 0xDB,
+    0x44, 0x72, 0xB9, 0x27, 0x81, 0xFD, 0x2A, 0xE8, 0x02, 0x6E, 0xD2, 0x06, 0x06, 0x10, 0x96, 0xE8,
+    0x91, 0xB8, 0x56, 0x47, 0x12, 0x10, 0x93, 0xCB, 0xFD, 0xA7, 0x55, 0xE1, 0x77, 0x50, 0xF9, 0x6E,
+    0xD8, 0x91, 0x3A, 0xB4, 0xE4, 0x9F, 0x0D, 0x48, 0xBD, 0x03, 0xA0, 0x61, 0x8C, 0x31, 0xA6, 0x8F,
+    0x54, 0x33, 0xB2, 0xAD, 0xF8, 0x44, 0xE0, 0xF6, 0x52, 0x72, 0x9C, 0x7F, 0x5D, 0xCC, 0x95, 0x98,
+    0xFF, 0x0A, 0x08, 0x12, 0xC5, 0xE4, 0xAF, 0x8E, 0xB3, 0x6C, 0xDE, 0x63, 0xAD, 0xC7, 0x96, 0x6E,
+    0xA5, 0xFC, 0x3C, 0x95, 0xD6, 0x98, 0xF4, 0xC2, 0x0F, 0xE4, 0xAF, 0x41, 0xE5, 0xF3, 0x5A, 0xD4,
+    0x0A, 0x71, 0x41, 0x56, 0x20, 0xE5, 0xB1, 0xD4, 0xF2, 0x7F, 0x2D, 0xF6, 0x10, 0xB6, 0xE6, 0x6F,
+    0x98, 0x15, 0x77, 0x39, 0xD7, 0x90, 0xE8, 0xA6, 0xD4, 0x4E, 0x04, 0x05, 0xC7, 0x03, 0x74, 0xE2,
+    0x3A, 0x9A, 0x6A, 0xCD, 0x1B, 0x5B, 0x00, 0x58, 0x35, 0xB0, 0xC2, 0x40, 0x51, 0x37, 0xE5, 0x5C,
+    0xB4, 0x24, 0x25, 0x94, 0x2C, 0x0F, 0xF4, 0x02, 0x94, 0x19, 0xA3, 0xED, 0x34, 0x4A, 0x5E, 0x81,
+    0x88, 0x34, 0xF1, 0x30, 0x6A, 0x01, 0xE3, 0x4E, 0x79, 0xBF, 0xE2, 0xA1, 0x2C, 0xEF, 0x8F, 0x59,
+    0x4A, 0x0A, 0xE1, 0x0D, 0xA1, 0x22, 0x8A, 0x07, 0xFB, 0xF2, 0x72, 0xB5, 0xBE, 0xB2, 0xEA, 0xAE,
+    0xAC, 0x46, 0x66, 0xAA, 0x32, 0x96, 0x52, 0x8A, 0x50, 0x7C, 0x3B, 0x5A, 0x44, 0xEB, 0xC3, 0x28,
+    0x32, 0xB1, 0x22, 0xC1, 0x70, 0xF5, 0xFB, 0x71, 0x1F, 0x2A, 0x25, 0x41, 0xE0, 0x2E, 0x4E, 0x93,
+    0xBB, 0xD4, 0x7C, 0x54, 0xFA, 0xB6, 0xFC, 0xD6, 0xB6, 0xDF, 0xAD, 0x96, 0x36, 0xE6, 0x36, 0x40,
+    0x0B, 0x72, 0x5B, 0x55, 0x16, 0x2B, 0xD7, 0x46, 0x13, 0x7C, 0xBC, 0x7B, 0x1E, 0x1B, 0x5D, 0x3D,
+    0xAA, 0x17, 0x8B, 0xF0, 0x51, 0xBD, 0xBD, 0xBB, 0x75, 0xC8, 0x5D, 0x24, 0x65, 0x4C, 0x6E, 0xD8,
+    0xFC, 0xB0, 0xBB, 0xBC, 0x23, 0xA2, 0x66, 0xD2, 0x12, 0x89, 0x6D, 0x47, 0xEC, 0x52, 0x66, 0x64,
+    0x2B, 0x84, 0xC1, 0x17, 0x83, 0xF5, 0x4B, 0x5A, 0xF7, 0xB8, 0x8E, 0x29, 0x37, 0x51, 0x8D, 0xAE,
+    0x6F, 0x29, 0x79, 0x0F, 0x7C, 0xCC, 0x02, 0xB6, 0xD7, 0xB1, 0xE1, 0x26, 0x30, 0x1E, 0x21, 0x8F,
+    0x0C, 0x5E, 0x09, 0x22, 0x87, 0xF6, 0x5C, 0xBE, 0xE8, 0x2C, 0xBA, 0x45, 0x1B, 0xEC, 0x1D, 0xF3,
+    0xB3, 0xDE, 0xEA, 0x6E, 0x3D, 0xE8, 0x54, 0x3A, 0xE0, 0xE6, 0x69, 0x2A, 0xEB, 0x94, 0x55, 0xF5,
+    0x26, 0xBD, 0xE3, 0xA5, 0x5E, 0x1A, 0x77, 0xB1, 0xD1, 0x43, 0x6E, 0x77, 0x74, 0xB7, 0x58, 0xA8,
+    0x66, 0x6D, 0xA1, 0xDA, 0xB5, 0x45, 0xD2, 0x2D, 0x72, 0x5B, 0xF5, 0x89, 0x49, 0xCC, 0x2C, 0x9D,
+    0xA5, 0xAB, 0x34, 0x66, 0x67, 0xC2, 0x6A, 0x2F, 0xD4, 0xFA, 0xEF, 0x17, 0xA4, 0x6F, 0x51, 0x51,
+    0x3E, 0x57, 0xF4, 0x34, 0xBE, 0xC4, 0x0C, 0xBB, 0x8B, 0x36, 0x94, 0x3D, 0xA2, 0x07, 0x5F, 0xBE,
+    0x14, 0xB8, 0x19, 0x27, 0x12, 0xA2, 0x92, 0x51, 0xFB, 0x22, 0x9B, 0xB1, 0xED, 0xC7, 0x2B, 0x4C,
+    0x76, 0xC8, 0x75, 0xE1, 0x20, 0x37, 0x3E, 0x11, 0x91, 0xB7, 0xAB, 0xF9, 0x73, 0xC6, 0x6B, 0x9B,
+    0x33, 0x1D, 0xFD, 0xF8, 0xE0, 0x0F, 0x73, 0x60, 0x93, 0xFC, 0xBF, 0x3C, 0xDC, 0x59, 0x29, 0xC8,
+    0xBB, 0x35, 0xA9, 0x86, 0x42, 0x39, 0x56, 0xB0, 0xC7, 0x80, 0xE5, 0x9F, 0x01, 0x96, 0x16, 0x31,
+    0x3D, 0x01, 0xEC, 0x41, 0xEE, 0xAF, 0x7A, 0x09, 0x64, 0x10, 0x8B, 0x86, 0x77, 0x64, 0x70, 0x85,
+    0xE2, 0x3B, 0x52, 0x43, 0x5A, 0x0E, 0x78, 0x43, 0x83, 0x64, 0xE8, 0x37, 0x0D, 0x6E, 0x56, 0xC8,
+    0x67, 0x76, 0x03, 0x0F, 0x3D, 0x36, 0xEB, 0x8D, 0x1E, 0xD2, 0x84, 0xCF, 0x40, 0x72, 0x77, 0x84,
+    0xC6, 0x1F, 0xBF, 0xAD, 0xA9, 0x2F, 0x71, 0x54, 0x3D, 0x4C, 0x91, 0xC3, 0x67, 0x22, 0xC9, 0x5C,
+    0xF8, 0xCA, 0x25, 0x3E, 0x9C, 0xC3, 0x08, 0x2F, 0xEE, 0x8C, 0xF9, 0xCF, 0xF8, 0xCA, 0x5A, 0x64,
+    0xD8, 0x46, 0x5D, 0x88, 0xB0, 0xE1, 0xB1, 0x25, 0xF5, 0x18, 0x2A, 0xD9, 0x2A, 0xE8, 0x60, 0x97,
+    0xFC, 0xDF, 0x71, 0xC8, 0x3F, 0xBF, 0x36, 0xF4, 0xDC, 0xF1, 0x27, 0x95, 0x55, 0x31, 0x6F, 0xDD,
+    0x54, 0x14, 0xFE, 0xAE, 0x4D, 0x78, 0x12, 0x96, 0xB8, 0x1D, 0x9A, 0x81, 0x44, 0x8A, 0x97, 0xAE,
+    0x7D, 0x5E, 0x19, 0x92, 0xF7, 0xAC, 0x76, 0x60, 0x60, 0x68, 0x90, 0x6A, 0x90, 0x60, 0x78, 0x3B,
+    0x0C, 0x59, 0x32, 0x64, 0x08, 0xB1, 0x45, 0x86, 0xAE, 0x6F, 0xC9, 0xCC, 0x52, 0xA4, 0xD4, 0x0C,
+    0xDD, 0x50, 0x44, 0x44, 0x6C, 0x94, 0x3F, 0xE0, 0x02, 0x55, 0x86, 0x0E, 0xB8, 0x30, 0x74, 0x60,
+    0xA8, 0x2B, 0x1C, 0x74, 0x53, 0x6C, 0x5F, 0xBE, 0xF3, 0xFC, 0x1E, 0xE9, 0x40, 0x4B, 0x7B, 0x15,
+    0xDF, 0xF8, 0x1C, 0x9F, 0xF3, 0x9D, 0xEF, 0xDE, 0xFB, 0x9D, 0xFB, 0xAE, 0x02, 0x1F, 0x19, 0x78,
+    0x67, 0x25, 0x82, 0x49, 0x82, 0x1F, 0xF6, 0xE0, 0x9C, 0xBF, 0xD2, 0xAC, 0x1B, 0xE8, 0x53, 0x83,
+    0xCC, 0xEB, 0xB6, 0x8C, 0x67, 0x6D, 0x32, 0xB0, 0x35, 0x70, 0x1B, 0x1C, 0x2B, 0x21, 0x5C, 0x9B,
+    0x63, 0x6C, 0x13, 0xA7, 0xD9, 0x85, 0xAE, 0x42, 0x8C, 0x13, 0xA0, 0x03, 0x5C, 0x03, 0xE8, 0x12,
+    0x6F, 0x6A, 0xAA, 0xC7, 0x2D, 0xF4, 0xD3, 0x8A, 0x80, 0x40, 0x50, 0xB0, 0x80, 0x43, 0xB7, 0xC3,
+    0x10, 0x64, 0x0C, 0xF5, 0xC5, 0xF3, 0xB2, 0x31, 0x85, 0x9A, 0x5A, 0xB8, 0x6D, 0x9C, 0xC3, 0xDE,
+    0x22, 0xF7, 0x7C, 0x13, 0x2A, 0x5C, 0x0B, 0x31, 0xF4, 0x09, 0x77, 0xC6, 0x15, 0xD4, 0x2D, 0x9C,
+    0xE6, 0x15, 0x00, 0xEF, 0xF1, 0xF1, 0x59, 0xCE, 0x23, 0x1B, 0xD5, 0xD2, 0xB8, 0x0A, 0xA1, 0x16,
+    0x9F, 0x36, 0x2B, 0x8B, 0x90, 0x95, 0x9B, 0x4D, 0xCC, 0x8D, 0xC0, 0x1B, 0xC0, 0xFE, 0x27, 0x2D,
+    0x84, 0x5C, 0xAC, 0x71, 0x7E, 0xB6, 0x5D, 0xB6, 0x75, 0xC3, 0x9A, 0x6B, 0x38, 0x09, 0x17, 0xF1,
+    0xAB, 0xA5, 0xFA, 0xCA, 0x5E, 0xF8, 0x93, 0x47, 0xB6, 0xD9, 0x71, 0x6C, 0xB2, 0x28, 0x9C, 0xA6,
+    0x87, 0xB1, 0xB5, 0xE7, 0xD6, 0x72, 0xB7, 0xFB, 0x31, 0x37, 0x1F, 0x44, 0x51, 0x04, 0xE2, 0xB9,
+    0x1D, 0xE1, 0x2E, 0xCC, 0x45, 0xD6, 0xAE, 0xBB, 0x42, 0x1E, 0x59, 0xB8, 0x9D, 0xB5, 0x7B, 0xE3,
+    0xD8, 0xDE, 0x52, 0x36, 0x09, 0x97, 0x70, 0x05, 0xB8, 0xD2, 0xA5, 0xF7, 0x4F, 0x99, 0xA3, 0xEE,
+    0x77, 0xD3, 0x45, 0xBD, 0x2F, 0xEC, 0x5D, 0x6D, 0x6D, 0x33, 0x4E, 0xBF, 0xE5, 0xE1, 0x61, 0x46,
+    0x43, 0x15, 0x70, 0x8B, 0xCC, 0xB6, 0xFC, 0xFB, 0x3C, 0x3B, 0xC4, 0x2E, 0x96, 0x2F, 0x6E, 0xF7,
+    0xA6, 0x4E, 0xA0, 0xF9, 0x7D, 0x96, 0xA8, 0x08, 0x74, 0xC6, 0x67, 0xCE, 0x5C, 0xA5, 0x69, 0x7A,
+    0x87, 0xE6, 0x84, 0x60, 0x73, 0xE8, 0x41, 0x6F, 0xB6, 0xCB, 0x51, 0xB4, 0x09, 0x5C, 0x93, 0x6D,
+    0x0A, 0x6A, 0xC7, 0x86, 0x41, 0x49, 0x72, 0x88, 0x4B, 0x0C, 0x78, 0xB0, 0xFC, 0xE7, 0x31, 0xE1,
+    0x88, 0xF1, 0x51, 0x34, 0x2F, 0xC3, 0xF7, 0x75, 0x7E, 0x49, 0x10, 0x18, 0x96, 0x49, 0xE0, 0x1B,
+    0x38, 0x2D, 0x56, 0x0D, 0xDF, 0xF9, 0x4A, 0xFF, 0xFB, 0x33, 0xFC, 0x17, 0xE3, 0x65, 0xAC, 0xC1,
+    0xC9, 0x11, 0xE7, 0x5E, 0xC5, 0xB8, 0xAD, 0x7A, 0xD0, 0x29, 0x3B, 0xF5, 0x8D, 0xDB, 0xC1, 0xAB,
+    0x15, 0x0B, 0x65, 0x45, 0x50, 0x93, 0x52, 0x98, 0x15, 0xF0, 0x5B, 0xB2, 0x60, 0xA4, 0xAE, 0xA1,
+    0x4A, 0xAE, 0xEF, 0x72, 0xBC, 0x0B, 0xA7, 0x10, 0x39, 0xCA, 0xE7, 0x72, 0xB5, 0x85, 0x9A, 0x65,
+    0x39, 0x96, 0xD9, 0xD4, 0xE3, 0x80, 0xC5, 0x4B, 0x5F, 0x68, 0xC4, 0x95, 0xC0, 0x8B, 0x83, 0x91,
+    0x35, 0xAE, 0x2F, 0xF2, 0x33, 0x7B, 0x41, 0xED, 0x5A, 0xA3, 0xFB, 0x83, 0x5A, 0x35, 0xE2, 0x43,
+    0xAF, 0x6E, 0x77, 0x61, 0x88, 0xEA, 0x35, 0xA5, 0xAC, 0x9F, 0x45, 0xD1, 0x96, 0x61, 0xA4, 0x61,
+    0x4A, 0xFD, 0x76, 0xFA, 0xCD, 0x6C, 0x2B, 0x45, 0x75, 0x63, 0x91, 0x22, 0xA3, 0xBC, 0x02, 0x2B,
+    0xEC, 0xB7, 0xCC, 0xDA, 0x8A, 0x61, 0x4D, 0x36, 0x1D, 0x33, 0x39, 0x48, 0x82, 0x5C, 0x73, 0x95,
+    0x6E, 0xE5, 0x1A, 0xA7, 0x26, 0x22, 0xB7, 0x35, 0xDF, 0x83, 0xDB, 0x04, 0x21, 0xB2, 0xA7, 0x0F,
+    0x23, 0x4F, 0x6A, 0x53, 0x1D, 0x95, 0xEA, 0xD2, 0xBB, 0x38, 0x99, 0xC3, 0xE9, 0x85, 0x6E, 0xB0,
+    0x34, 0xB7, 0x06, 0x15, 0x5B, 0x8B, 0xF9, 0xDC, 0xBF, 0x4B, 0xCA, 0xFA, 0x57, 0x83, 0x41, 0x99,
+    0xC1, 0xAD, 0x49, 0xB9, 0x21, 0xE5, 0x13, 0x16, 0x90, 0xAA, 0x7E, 0xAE, 0x0B, 0xAF, 0xD0, 0xCF,
+    0x3E, 0x39, 0x7F, 0x81, 0x72, 0x76, 0x2F, 0x9C, 0xF1, 0x14, 0x38, 0xB7, 0x5A, 0x14, 0x50, 0x54,
+    0x64, 0x60, 0x6D, 0x41, 0x0E, 0x75, 0xFC, 0x3C, 0x3D, 0x1C, 0x17, 0xFD, 0x7A, 0xA5, 0xA0, 0x12,
+    0x71, 0xC4, 0x5C, 0xA8, 0x16, 0xC3, 0x1E, 0x44, 0x9B, 0x8C, 0x6C, 0x45, 0x4B, 0xA1, 0xFA, 0x34,
+    0x4D, 0xFA, 0x3D, 0xB4, 0x2D, 0x9D, 0xF6, 0x43, 0x3E, 0xC5, 0x32, 0xA5, 0xE3, 0x5B, 0x5B, 0x8A,
+    0x96, 0xC2, 0x34, 0xCD, 0x6A, 0xC9, 0x92, 0xDD, 0x91, 0x8A, 0x34, 0xD0, 0xCE, 0xF1, 0xC6, 0x3F,
+    0x46, 0x51, 0xF6, 0x80, 0x51, 0x25, 0xCB, 0x16, 0xEF, 0xA4, 0x07, 0xFF, 0x8A, 0xD4, 0xD0, 0xD1,
+    0x11, 0x83, 0x42, 0x52, 0xF7, 0xE8, 0x93, 0x65, 0xFA, 0x8F, 0xBE, 0x2E, 0x54, 0x3D, 0x1C, 0x14,
+    0x1A, 0x47, 0x83, 0xFC, 0xC8, 0x29, 0xBD, 0xFD, 0xDC, 0x4B, 0xF4, 0x1A, 0x86, 0xD8, 0xD8, 0x4B,
+    0xBB, 0xF4, 0x2F, 0x86, 0xDB, 0x27, 0x0F, 0x3F, 0x3B, 0x98, 0x4C, 0xC4, 0xB5, 0x4E, 0x7D, 0x56,
+    0x12, 0x95, 0xD4, 0x5E, 0xB2, 0xAB, 0xCC, 0xD0, 0x2B, 0x54, 0xF7, 0x7D, 0x2B, 0x5C, 0x49, 0x79,
+    0x49, 0xCE, 0xED, 0x12, 0xFA, 0x97, 0x09, 0xA1, 0x41, 0xE8, 0x10, 0x84, 0xE6, 0x21, 0xEE, 0x93,
+    0xAB, 0xF6, 0xF9, 0x99, 0xD0, 0xE9, 0x02, 0x3A, 0x8A, 0x08, 0x0D, 0x81, 0x06, 0xA1, 0x19, 0x95,
+    0x70, 0x35, 0x84, 0x86, 0x40, 0x7F, 0xFC, 0x7F, 0xD0, 0xBC, 0x7B, 0xF2, 0xE3, 0xCA, 0xFD, 0x63,
+    0xFF, 0xB4, 0x1A, 0xE9, 0x35, 0xF7, 0xCF, 0x72, 0x63, 0x87, 0x42, 0xFF, 0xAE, 0x74, 0x2B, 0xE7,
+    0x49, 0x32, 0xAE, 0xBC, 0x89, 0xFB, 0x7B, 0xB5, 0xB1, 0x3E, 0x72, 0xAB, 0xEA, 0xB8, 0x74, 0xFF,
+    0x4E, 0x3A, 0xAA, 0xE3, 0x75, 0xA1, 0x79, 0x85, 0x93, 0x35, 0xA1, 0x73, 0x8C, 0xC8, 0xDA, 0x25,
+    0x34, 0x46, 0x02, 0x5D, 0x12, 0x7A, 0x04, 0x42, 0x97, 0x64, 0x3D, 0x22, 0xEB, 0x63, 0xB6, 0x2E,
+    0xA1, 0x5F, 0xC2, 0x5A, 0x26, 0x11, 0x5E, 0xD3, 0x4B, 0x43, 0x24, 0xF2, 0x3A, 0x26, 0x4F, 0xBE,
+    0xA3, 0x02, 0x9E, 0xCB, 0x49, 0x06, 0x1F, 0xF0, 0xBA, 0xAD, 0xA5, 0x15, 0xBC, 0xDC, 0x2B, 0xD8,
+    0xBA, 0x49, 0x7C, 0xDA, 0x3A, 0x6C, 0x3C, 0xAF, 0x1C, 0x54, 0xB3, 0xD3, 0xEF, 0x47, 0x7F, 0x05,
+    0xED, 0xF4, 0xD7, 0xE2, 0x4C, 0x43, 0xB1, 0xF4, 0x1A, 0xB6, 0x45, 0x9B, 0xD8, 0x9E, 0x7D, 0xF9,
+    0xF2, 0x2D, 0x2F, 0x91, 0x4B, 0xB3, 0x34, 0x32, 0xB7, 0x41, 0x22, 0x17, 0xE8, 0x1D, 0x23, 0xF3,
+    0x63, 0xF6, 0xB3, 0x74, 0x99, 0x09, 0xAC, 0xC1, 0xB8, 0x73, 0x78, 0x81, 0x65, 0x1D, 0x89, 0xDC,
+    0xB0, 0x1D, 0x5B, 0xFF, 0x37, 0xCE, 0x08, 0x1A, 0x7A, 0x68, 0xC8, 0x3B, 0x82, 0x9F, 0x64, 0x76,
+    0xAA, 0x91, 0xD4, 0xB8, 0x3E, 0x94, 0x79, 0xF6, 0x13, 0x05, 0x0C, 0x7B, 0xD1, 0xF1, 0xF9, 0x07,
+};
+
+static const uint32_t bookerly_12_boldBlockOffsets[27] = {
+    0, 1255, 2364, 3539, 4619, 5483, 6359, 7198,
+    8168, 9168, 10045, 11050, 11838, 12948, 14061, 15147,
+    16351, 17547, 18683, 19793, 20907, 22103, 23148, 24286,
+    25603, 26747, 27760,
+};
+
+static const uint16_t bookerly_12_boldDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_boldGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_12_boldPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_12_boldGlyphs[] = {
@@ -3300,711 +1954,711 @@ static const EpdGlyph bookerly_12_boldGlyphs[] = {
     { 16, 19, 16, 0, 18, 76, 1781 }, // B
     { 15, 19, 16, 1, 18, 72, 1857 }, // C
     { 19, 19, 19, 0, 18, 91, 1929 }, // D
-    { 16, 18, 16, 0, 18, 72, 2020 }, // E
-    { 14, 18, 15, 0, 18, 63, 2092 }, // F
-    { 17, 19, 19, 1, 18, 81, 2155 }, // G
-    { 21, 18, 22, 0, 18, 95, 2236 }, // H
-    { 10, 18, 10, 0, 18, 45, 2331 }, // I
-    { 12, 24, 10, -2, 18, 72, 2376 }, // J
-    { 19, 19, 19, 0, 18, 91, 2448 }, // K
-    { 16, 18, 16, 0, 18, 72, 2539 }, // L
-    { 24, 18, 24, 0, 18, 108, 2611 }, // M
-    { 21, 19, 20, 0, 18, 100, 2719 }, // N
-    { 18, 19, 20, 1, 18, 86, 2819 }, // O
-    { 16, 18, 16, 0, 18, 72, 2905 }, // P
-    { 19, 24, 20, 1, 18, 114, 2977 }, // Q
-    { 19, 19, 18, 0, 18, 91, 3091 }, // R
-    { 13, 19, 15, 1, 18, 62, 3182 }, // S
-    { 18, 18, 18, 0, 18, 81, 3244 }, // T
-    { 20, 19, 20, 0, 18, 95, 3325 }, // U
-    { 20, 19, 19, 0, 18, 95, 3420 }, // V
-    { 28, 19, 28, 0, 18, 133, 3515 }, // W
-    { 19, 18, 19, 0, 18, 86, 3648 }, // X
-    { 18, 18, 18, 0, 18, 81, 3734 }, // Y
-    { 15, 19, 15, 0, 18, 72, 3815 }, // Z
-    { 7, 24, 8, 1, 20, 42, 3887 }, // [
-    { 13, 20, 13, 0, 18, 65, 3929 }, // <backslash>
-    { 6, 24, 8, 1, 20, 36, 3994 }, // ]
-    { 13, 12, 16, 1, 16, 39, 4030 }, // ^
-    { 13, 3, 13, 0, -1, 10, 4069 }, // _
-    { 6, 6, 17, 5, 21, 9, 4079 }, // `
-    { 14, 15, 14, 1, 14, 53, 4088 }, // a
-    { 16, 21, 15, -1, 20, 84, 4141 }, // b
-    { 13, 15, 13, 0, 14, 49, 4225 }, // c
-    { 16, 21, 16, 0, 20, 84, 4274 }, // d
-    { 13, 15, 14, 0, 14, 49, 4358 }, // e
-    { 13, 20, 11, 0, 20, 65, 4407 }, // f
-    { 15, 20, 15, 0, 14, 75, 4472 }, // g
-    { 17, 20, 17, 0, 20, 85, 4547 }, // h
-    { 9, 20, 9, 0, 20, 45, 4632 }, // i
-    { 9, 26, 8, -2, 20, 59, 4677 }, // j
-    { 16, 21, 16, 0, 20, 84, 4736 }, // k
-    { 9, 20, 9, 0, 20, 45, 4820 }, // l
-    { 25, 14, 25, 0, 14, 88, 4865 }, // m
-    { 17, 14, 17, 0, 14, 60, 4953 }, // n
-    { 15, 15, 15, 0, 14, 57, 5013 }, // o
-    { 15, 20, 16, 0, 14, 75, 5070 }, // p
-    { 15, 20, 15, 0, 14, 75, 5145 }, // q
-    { 12, 14, 12, 0, 14, 42, 5220 }, // r
-    { 11, 15, 13, 1, 14, 42, 5262 }, // s
-    { 12, 18, 11, -1, 17, 54, 5304 }, // t
-    { 17, 15, 16, 0, 14, 64, 5358 }, // u
-    { 17, 14, 16, 0, 13, 60, 5422 }, // v
-    { 23, 14, 23, 0, 13, 81, 5482 }, // w
-    { 16, 13, 16, 0, 13, 52, 5563 }, // x
-    { 17, 19, 16, 0, 13, 81, 5615 }, // y
-    { 13, 14, 13, 0, 13, 46, 5696 }, // z
-    { 9, 25, 10, 1, 20, 57, 5742 }, // {
-    { 4, 23, 8, 2, 20, 23, 5799 }, // |
-    { 9, 25, 10, 0, 20, 57, 5822 }, // }
-    { 13, 5, 16, 1, 11, 17, 5879 }, // ~
-    { 0, 0, 5, 0, 0, 0, 5896 }, //  
-    { 6, 20, 7, 0, 14, 30, 5896 }, // ¡
-    { 13, 25, 16, 1, 20, 82, 5926 }, // ¢
-    { 15, 19, 16, 0, 18, 72, 6008 }, // £
-    { 14, 13, 16, 1, 15, 46, 6080 }, // ¤
-    { 17, 18, 16, -1, 18, 77, 6126 }, // ¥
-    { 4, 23, 8, 2, 20, 23, 6203 }, // ¦
-    { 12, 21, 13, 0, 18, 63, 6226 }, // §
-    { 10, 5, 17, 3, 20, 13, 6289 }, // ¨
-    { 19, 19, 20, 0, 18, 91, 6302 }, // ©
-    { 9, 13, 11, 1, 18, 30, 6393 }, // ª
-    { 14, 11, 15, 0, 12, 39, 6423 }, // «
-    { 12, 7, 16, 2, 12, 21, 6462 }, // ¬
-    { 9, 3, 10, 0, 8, 7, 6483 }, // ­
-    { 14, 14, 15, 0, 20, 49, 6490 }, // ®
-    { 9, 3, 17, 4, 18, 7, 6539 }, // ¯
-    { 10, 10, 13, 2, 18, 25, 6546 }, // °
-    { 12, 16, 16, 2, 15, 48, 6571 }, // ±
-    { 10, 12, 11, 1, 21, 30, 6619 }, // ²
-    { 9, 13, 11, 1, 21, 30, 6649 }, // ³
-    { 5, 6, 17, 6, 21, 8, 6679 }, // ´
-    { 16, 20, 16, 1, 14, 80, 6687 }, // µ
-    { 15, 22, 15, 0, 18, 83, 6767 }, // ¶
-    { 5, 5, 7, 1, 9, 7, 6850 }, // ·
-    { 5, 6, 17, 6, -1, 8, 6857 }, // ¸
-    { 9, 12, 11, 1, 21, 27, 6865 }, // ¹
-    { 9, 13, 11, 1, 18, 30, 6892 }, // º
-    { 13, 11, 15, 1, 12, 36, 6922 }, // »
-    { 26, 21, 27, 1, 19, 137, 6958 }, // ¼
-    { 25, 21, 27, 1, 19, 132, 7095 }, // ½
-    { 26, 21, 27, 1, 19, 137, 7227 }, // ¾
-    { 10, 20, 12, 1, 14, 50, 7364 }, // ¿
-    { 20, 25, 19, 0, 25, 125, 7414 }, // À
-    { 20, 25, 19, 0, 25, 125, 7539 }, // Á
-    { 20, 25, 19, 0, 25, 125, 7664 }, // Â
-    { 20, 24, 19, 0, 24, 120, 7789 }, // Ã
-    { 20, 24, 19, 0, 24, 120, 7909 }, // Ä
-    { 20, 25, 19, 0, 25, 125, 8029 }, // Å
-    { 25, 18, 25, -1, 18, 113, 8154 }, // Æ
-    { 15, 25, 16, 1, 18, 94, 8267 }, // Ç
-    { 16, 25, 16, 0, 25, 100, 8361 }, // È
-    { 16, 25, 16, 0, 25, 100, 8461 }, // É
-    { 16, 25, 16, 0, 25, 100, 8561 }, // Ê
-    { 16, 24, 16, 0, 24, 96, 8661 }, // Ë
-    { 10, 25, 10, 0, 25, 63, 8757 }, // Ì
-    { 10, 25, 10, 0, 25, 63, 8820 }, // Í
-    { 10, 25, 10, 0, 25, 63, 8883 }, // Î
-    { 10, 24, 10, 0, 24, 60, 8946 }, // Ï
-    { 19, 19, 19, 0, 18, 91, 9006 }, // Ð
-    { 21, 25, 20, 0, 24, 132, 9097 }, // Ñ
-    { 18, 26, 20, 1, 25, 117, 9229 }, // Ò
-    { 18, 26, 20, 1, 25, 117, 9346 }, // Ó
-    { 18, 26, 20, 1, 25, 117, 9463 }, // Ô
-    { 18, 25, 20, 1, 24, 113, 9580 }, // Õ
-    { 18, 25, 20, 1, 24, 113, 9693 }, // Ö
-    { 11, 11, 16, 2, 14, 31, 9806 }, // ×
-    { 20, 19, 20, 0, 18, 95, 9837 }, // Ø
-    { 20, 26, 20, 0, 25, 130, 9932 }, // Ù
-    { 20, 26, 20, 0, 25, 130, 10062 }, // Ú
-    { 20, 26, 20, 0, 25, 130, 10192 }, // Û
-    { 20, 25, 20, 0, 24, 125, 10322 }, // Ü
-    { 18, 25, 18, 0, 25, 113, 10447 }, // Ý
-    { 16, 18, 16, 0, 18, 72, 10560 }, // Þ
-    { 16, 21, 17, 0, 20, 84, 10632 }, // ß
-    { 14, 22, 14, 1, 21, 77, 10716 }, // à
-    { 14, 22, 14, 1, 21, 77, 10793 }, // á
-    { 14, 22, 14, 1, 21, 77, 10870 }, // â
-    { 14, 21, 14, 1, 20, 74, 10947 }, // ã
-    { 14, 21, 14, 1, 20, 74, 11021 }, // ä
-    { 14, 22, 14, 1, 21, 77, 11095 }, // å
-    { 19, 15, 21, 1, 14, 72, 11172 }, // æ
-    { 13, 21, 13, 0, 14, 69, 11244 }, // ç
-    { 13, 22, 14, 0, 21, 72, 11313 }, // è
-    { 13, 22, 14, 0, 21, 72, 11385 }, // é
-    { 13, 22, 14, 0, 21, 72, 11457 }, // ê
-    { 13, 21, 14, 0, 20, 69, 11529 }, // ë
-    { 9, 21, 9, 0, 21, 48, 11598 }, // ì
-    { 9, 21, 9, 0, 21, 48, 11646 }, // í
-    { 9, 21, 9, 0, 21, 48, 11694 }, // î
-    { 10, 20, 9, 0, 20, 50, 11742 }, // ï
-    { 15, 22, 15, 0, 21, 83, 11792 }, // ð
-    { 17, 20, 17, 0, 20, 85, 11875 }, // ñ
-    { 15, 22, 15, 0, 21, 83, 11960 }, // ò
-    { 15, 22, 15, 0, 21, 83, 12043 }, // ó
-    { 15, 22, 15, 0, 21, 83, 12126 }, // ô
-    { 15, 21, 15, 0, 20, 79, 12209 }, // õ
-    { 15, 21, 15, 0, 20, 79, 12288 }, // ö
-    { 12, 13, 16, 2, 15, 39, 12367 }, // ÷
-    { 15, 15, 15, 0, 14, 57, 12406 }, // ø
-    { 17, 22, 16, 0, 21, 94, 12463 }, // ù
-    { 17, 22, 16, 0, 21, 94, 12557 }, // ú
-    { 17, 22, 16, 0, 21, 94, 12651 }, // û
-    { 17, 21, 16, 0, 20, 90, 12745 }, // ü
-    { 17, 27, 16, 0, 21, 115, 12835 }, // ý
-    { 15, 26, 16, 0, 20, 98, 12950 }, // þ
-    { 17, 26, 16, 0, 20, 111, 13048 }, // ÿ
-    { 20, 23, 19, 0, 23, 115, 13159 }, // Ā
-    { 14, 19, 14, 1, 18, 67, 13274 }, // ā
-    { 20, 24, 19, 0, 24, 120, 13341 }, // Ă
-    { 14, 21, 14, 1, 20, 74, 13461 }, // ă
-    { 20, 24, 19, 0, 18, 120, 13535 }, // Ą
-    { 14, 20, 14, 1, 14, 70, 13655 }, // ą
-    { 15, 26, 16, 1, 25, 98, 13725 }, // Ć
-    { 13, 22, 13, 0, 21, 72, 13823 }, // ć
-    { 15, 26, 16, 1, 25, 98, 13895 }, // Ĉ
-    { 13, 22, 13, 0, 21, 72, 13993 }, // ĉ
-    { 15, 25, 16, 1, 24, 94, 14065 }, // Ċ
-    { 13, 21, 13, 0, 20, 69, 14159 }, // ċ
-    { 15, 26, 16, 1, 25, 98, 14228 }, // Č
-    { 13, 22, 13, 0, 21, 72, 14326 }, // č
-    { 19, 26, 19, 0, 25, 124, 14398 }, // Ď
-    { 18, 21, 16, 0, 20, 95, 14522 }, // ď
-    { 19, 19, 19, 0, 18, 91, 14617 }, // Đ
-    { 16, 21, 16, 0, 20, 84, 14708 }, // đ
-    { 16, 23, 16, 0, 23, 92, 14792 }, // Ē
-    { 13, 19, 14, 0, 18, 62, 14884 }, // ē
-    { 16, 24, 16, 0, 24, 96, 14946 }, // Ĕ
-    { 13, 21, 14, 0, 20, 69, 15042 }, // ĕ
-    { 16, 24, 16, 0, 24, 96, 15111 }, // Ė
-    { 13, 21, 14, 0, 20, 69, 15207 }, // ė
-    { 16, 24, 16, 0, 18, 96, 15276 }, // Ę
-    { 13, 20, 14, 0, 14, 65, 15372 }, // ę
-    { 16, 25, 16, 0, 25, 100, 15437 }, // Ě
-    { 13, 22, 14, 0, 21, 72, 15537 }, // ě
-    { 17, 26, 19, 1, 25, 111, 15609 }, // Ĝ
-    { 15, 27, 15, 0, 21, 102, 15720 }, // ĝ
-    { 17, 25, 19, 1, 24, 107, 15822 }, // Ğ
-    { 15, 26, 15, 0, 20, 98, 15929 }, // ğ
-    { 17, 25, 19, 1, 24, 107, 16027 }, // Ġ
-    { 15, 26, 15, 0, 20, 98, 16134 }, // ġ
-    { 17, 25, 19, 1, 18, 107, 16232 }, // Ģ
-    { 15, 28, 15, 0, 22, 105, 16339 }, // ģ
-    { 21, 25, 22, 0, 25, 132, 16444 }, // Ĥ
-    { 18, 26, 17, -1, 26, 117, 16576 }, // ĥ
-    { 21, 18, 22, 0, 18, 95, 16693 }, // Ħ
-    { 17, 20, 17, 0, 20, 85, 16788 }, // ħ
-    { 10, 24, 10, 0, 24, 60, 16873 }, // Ĩ
-    { 9, 20, 9, 0, 20, 45, 16933 }, // ĩ
-    { 10, 23, 10, 0, 23, 58, 16978 }, // Ī
-    { 9, 18, 9, 0, 18, 41, 17036 }, // ī
-    { 10, 24, 10, 0, 24, 60, 17077 }, // Ĭ
-    { 9, 20, 9, 0, 20, 45, 17137 }, // ĭ
-    { 10, 24, 10, 0, 18, 60, 17182 }, // Į
-    { 10, 26, 9, 0, 20, 65, 17242 }, // į
-    { 10, 24, 10, 0, 24, 60, 17307 }, // İ
-    { 9, 14, 9, 0, 14, 32, 17367 }, // ı
-    { 20, 24, 20, 0, 18, 120, 17399 }, // Ĳ
-    { 16, 26, 17, 0, 20, 104, 17519 }, // ĳ
-    { 12, 31, 10, -2, 25, 93, 17623 }, // Ĵ
-    { 11, 27, 8, -2, 21, 75, 17716 }, // ĵ
-    { 19, 25, 19, 0, 18, 119, 17791 }, // Ķ
-    { 16, 27, 16, 0, 20, 108, 17910 }, // ķ
-    { 17, 15, 16, 0, 14, 64, 18018 }, // ĸ
-    { 16, 25, 16, 0, 25, 100, 18082 }, // Ĺ
-    { 9, 26, 9, 0, 26, 59, 18182 }, // ĺ
-    { 16, 25, 16, 0, 18, 100, 18241 }, // Ļ
-    { 9, 27, 9, 0, 20, 61, 18341 }, // ļ
-    { 16, 20, 16, 0, 20, 80, 18402 }, // Ľ
-    { 11, 20, 9, 0, 20, 55, 18482 }, // ľ
-    { 16, 18, 16, 0, 18, 72, 18537 }, // Ŀ
-    { 14, 20, 13, 0, 20, 70, 18609 }, // ŀ
-    { 17, 18, 16, -1, 18, 77, 18679 }, // Ł
-    { 10, 20, 9, -1, 20, 50, 18756 }, // ł
-    { 21, 26, 20, 0, 25, 137, 18806 }, // Ń
-    { 17, 21, 17, 0, 21, 90, 18943 }, // ń
-    { 21, 25, 20, 0, 18, 132, 19033 }, // Ņ
-    { 17, 21, 17, 0, 14, 90, 19165 }, // ņ
-    { 21, 26, 20, 0, 25, 137, 19255 }, // Ň
-    { 17, 21, 17, 0, 21, 90, 19392 }, // ň
-    { 23, 18, 23, 0, 18, 104, 19482 }, // ŉ
-    { 21, 23, 20, 0, 18, 121, 19586 }, // Ŋ
-    { 15, 20, 16, 0, 14, 75, 19707 }, // ŋ
-    { 18, 24, 20, 1, 23, 108, 19782 }, // Ō
-    { 15, 19, 15, 0, 18, 72, 19890 }, // ō
-    { 18, 25, 20, 1, 24, 113, 19962 }, // Ŏ
-    { 15, 21, 15, 0, 20, 79, 20075 }, // ŏ
-    { 18, 26, 20, 1, 25, 117, 20154 }, // Ő
-    { 15, 22, 15, 0, 21, 83, 20271 }, // ő
-    { 24, 19, 25, 1, 18, 114, 20354 }, // Œ
-    { 22, 15, 23, 0, 14, 83, 20468 }, // œ
-    { 19, 26, 18, 0, 25, 124, 20551 }, // Ŕ
-    { 12, 21, 12, 0, 21, 63, 20675 }, // ŕ
-    { 19, 25, 18, 0, 18, 119, 20738 }, // Ŗ
-    { 12, 21, 12, 0, 14, 63, 20857 }, // ŗ
-    { 19, 26, 18, 0, 25, 124, 20920 }, // Ř
-    { 12, 21, 12, 0, 21, 63, 21044 }, // ř
-    { 13, 26, 15, 1, 25, 85, 21107 }, // Ś
-    { 11, 22, 13, 1, 21, 61, 21192 }, // ś
-    { 13, 26, 15, 1, 25, 85, 21253 }, // Ŝ
-    { 11, 22, 13, 1, 21, 61, 21338 }, // ŝ
-    { 13, 25, 15, 1, 18, 82, 21399 }, // Ş
-    { 11, 21, 13, 1, 14, 58, 21481 }, // ş
-    { 13, 26, 15, 1, 25, 85, 21539 }, // Š
-    { 11, 22, 13, 1, 21, 61, 21624 }, // š
-    { 18, 25, 18, 0, 18, 113, 21685 }, // Ţ
-    { 12, 24, 11, -1, 17, 72, 21798 }, // ţ
-    { 18, 25, 18, 0, 25, 113, 21870 }, // Ť
-    { 12, 21, 11, -1, 20, 63, 21983 }, // ť
-    { 18, 18, 18, 0, 18, 81, 22046 }, // Ŧ
-    { 12, 18, 11, -1, 17, 54, 22127 }, // ŧ
-    { 20, 25, 20, 0, 24, 125, 22181 }, // Ũ
-    { 17, 21, 16, 0, 20, 90, 22306 }, // ũ
-    { 20, 24, 20, 0, 23, 120, 22396 }, // Ū
-    { 17, 19, 16, 0, 18, 81, 22516 }, // ū
-    { 20, 25, 20, 0, 24, 125, 22597 }, // Ŭ
-    { 17, 21, 16, 0, 20, 90, 22722 }, // ŭ
-    { 20, 26, 20, 0, 25, 130, 22812 }, // Ů
-    { 17, 22, 16, 0, 21, 94, 22942 }, // ů
-    { 20, 26, 20, 0, 25, 130, 23036 }, // Ű
-    { 17, 22, 16, 0, 21, 94, 23166 }, // ű
-    { 20, 24, 20, 0, 18, 120, 23260 }, // Ų
-    { 17, 20, 16, 0, 14, 85, 23380 }, // ų
-    { 28, 26, 28, 0, 25, 182, 23465 }, // Ŵ
-    { 23, 22, 23, 0, 21, 127, 23647 }, // ŵ
-    { 18, 25, 18, 0, 25, 113, 23774 }, // Ŷ
-    { 17, 27, 16, 0, 21, 115, 23887 }, // ŷ
-    { 18, 24, 18, 0, 24, 108, 24002 }, // Ÿ
-    { 15, 26, 15, 0, 25, 98, 24110 }, // Ź
-    { 13, 22, 13, 0, 21, 72, 24208 }, // ź
-    { 15, 25, 15, 0, 24, 94, 24280 }, // Ż
-    { 13, 21, 13, 0, 20, 69, 24374 }, // ż
-    { 15, 26, 15, 0, 25, 98, 24443 }, // Ž
-    { 13, 22, 13, 0, 21, 72, 24541 }, // ž
-    { 13, 20, 10, 0, 20, 65, 24613 }, // ſ
-    { 6, 6, 0, -4, 21, 9, 24678 }, // ̀
-    { 5, 6, 0, -2, 21, 8, 24687 }, // ́
-    { 10, 7, 0, -5, 21, 18, 24695 }, // ̂
-    { 10, 5, 0, -5, 20, 13, 24713 }, // ̃
-    { 10, 3, 0, -5, 18, 8, 24726 }, // ̄
-    { 10, 5, 0, -5, 20, 13, 24734 }, // ̆
-    { 6, 5, 0, -3, 20, 8, 24747 }, // ̇
-    { 10, 5, 0, -5, 20, 13, 24755 }, // ̈
-    { 8, 7, 0, -4, 22, 14, 24768 }, // ̉
-    { 8, 7, 0, -4, 21, 14, 24782 }, // ̊
-    { 10, 7, 0, -4, 21, 18, 24796 }, // ̋
-    { 10, 6, 0, -5, 21, 15, 24814 }, // ̌
-    { 10, 7, 0, -6, 21, 18, 24829 }, // ̏
-    { 10, 5, 0, -5, 20, 13, 24847 }, // ̑
-    { 5, 8, 0, -3, 22, 10, 24860 }, // ̒
-    { 5, 7, 0, -2, 22, 9, 24870 }, // ̓
-    { 5, 7, 0, -3, 22, 9, 24879 }, // ̔
-    { 4, 7, 0, -2, 22, 7, 24888 }, // ̕
-    { 5, 6, 0, -3, 16, 8, 24895 }, // ̛
-    { 6, 5, 0, -3, -1, 8, 24903 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 24911 }, // ̤
-    { 6, 6, 0, -3, -1, 9, 24921 }, // ̥
-    { 5, 6, 0, -3, -1, 8, 24930 }, // ̦
-    { 6, 6, 0, -3, -1, 9, 24938 }, // ̧
-    { 6, 7, 0, -3, 1, 11, 24947 }, // ̨
-    { 3, 7, 7, 2, -1, 6, 24958 }, // ̩
-    { 10, 6, 0, -5, -1, 15, 24964 }, // ̭
-    { 10, 6, 0, -5, -1, 15, 24979 }, // ̮
-    { 10, 5, 0, -5, -2, 13, 24994 }, // ̰
-    { 10, 3, 0, -5, -2, 8, 25007 }, // ̱
-    { 10, 5, 0, -5, 20, 13, 25015 }, // ͂
-    { 10, 11, 0, -5, 26, 28, 25028 }, // ̈́
-    { 5, 6, 0, -2, -1, 8, 25056 }, // ͅ
-    { 16, 25, 16, 0, 25, 100, 25064 }, // Ѐ
-    { 16, 24, 16, 0, 24, 96, 25164 }, // Ё
-    { 21, 24, 22, 0, 18, 126, 25260 }, // Ђ
-    { 15, 25, 16, 0, 25, 94, 25386 }, // Ѓ
-    { 16, 19, 17, 1, 18, 76, 25480 }, // Є
-    { 13, 19, 15, 1, 18, 62, 25556 }, // Ѕ
-    { 10, 18, 10, 0, 18, 45, 25618 }, // І
-    { 10, 24, 10, 0, 24, 60, 25663 }, // Ї
-    { 12, 24, 10, -2, 18, 72, 25723 }, // Ј
-    { 24, 19, 25, 0, 18, 114, 25795 }, // Љ
-    { 26, 19, 27, 0, 18, 124, 25909 }, // Њ
-    { 23, 18, 23, 0, 18, 104, 26033 }, // Ћ
-    { 19, 26, 19, 0, 25, 124, 26137 }, // Ќ
-    { 21, 25, 21, 0, 25, 132, 26261 }, // Ѝ
-    { 18, 25, 18, 0, 24, 113, 26393 }, // Ў
-    { 20, 24, 21, 0, 18, 120, 26506 }, // Џ
-    { 20, 18, 19, 0, 18, 90, 26626 }, // А
-    { 16, 19, 16, 0, 18, 76, 26716 }, // Б
-    { 16, 19, 16, 0, 18, 76, 26792 }, // В
-    { 15, 18, 16, 0, 18, 68, 26868 }, // Г
-    { 20, 24, 20, 0, 18, 120, 26936 }, // Д
-    { 16, 18, 16, 0, 18, 72, 27056 }, // Е
-    { 28, 19, 28, 0, 18, 133, 27128 }, // Ж
-    { 15, 19, 16, 0, 18, 72, 27261 }, // З
-    { 21, 18, 21, 0, 18, 95, 27333 }, // И
-    { 21, 24, 21, 0, 24, 126, 27428 }, // Й
-    { 19, 19, 19, 0, 18, 91, 27554 }, // К
-    { 19, 19, 19, 0, 18, 91, 27645 }, // Л
-    { 24, 18, 24, 0, 18, 108, 27736 }, // М
-    { 21, 18, 22, 0, 18, 95, 27844 }, // Н
-    { 18, 19, 20, 1, 18, 86, 27939 }, // О
-    { 21, 18, 21, 0, 18, 95, 28025 }, // П
-    { 16, 18, 16, 0, 18, 72, 28120 }, // Р
-    { 15, 19, 16, 1, 18, 72, 28192 }, // С
-    { 18, 18, 18, 0, 18, 81, 28264 }, // Т
-    { 18, 19, 18, 0, 18, 86, 28345 }, // У
-    { 20, 19, 20, 0, 18, 95, 28431 }, // Ф
-    { 19, 18, 19, 0, 18, 86, 28526 }, // Х
-    { 21, 24, 21, 0, 18, 126, 28612 }, // Ц
-    { 19, 18, 19, 0, 18, 86, 28738 }, // Ч
-    { 27, 18, 28, 0, 18, 122, 28824 }, // Ш
-    { 28, 24, 28, 0, 18, 168, 28946 }, // Щ
-    { 19, 19, 20, 0, 18, 91, 29114 }, // Ъ
-    { 25, 19, 26, 0, 18, 119, 29205 }, // Ы
-    { 16, 19, 16, 0, 18, 76, 29324 }, // Ь
-    { 17, 19, 17, 0, 18, 81, 29400 }, // Э
-    { 27, 19, 28, 0, 18, 129, 29481 }, // Ю
-    { 18, 19, 18, 0, 18, 86, 29610 }, // Я
-    { 14, 15, 14, 1, 14, 53, 29696 }, // а
-    { 14, 21, 15, 0, 20, 74, 29749 }, // б
-    { 14, 15, 15, 0, 14, 53, 29823 }, // в
-    { 13, 13, 13, 0, 13, 43, 29876 }, // г
-    { 17, 18, 17, 0, 13, 77, 29919 }, // д
-    { 13, 15, 14, 0, 14, 49, 29996 }, // е
-    { 23, 15, 22, 0, 14, 87, 30045 }, // ж
-    { 13, 15, 13, 0, 14, 49, 30132 }, // з
-    { 17, 13, 17, 0, 13, 56, 30181 }, // и
-    { 17, 20, 17, 0, 20, 85, 30237 }, // й
-    { 16, 15, 16, 0, 14, 60, 30322 }, // к
-    { 16, 14, 16, 0, 13, 56, 30382 }, // л
-    { 19, 13, 20, 0, 13, 62, 30438 }, // м
-    { 17, 13, 18, 0, 13, 56, 30500 }, // н
-    { 15, 15, 15, 0, 14, 57, 30556 }, // о
-    { 17, 13, 17, 0, 13, 56, 30613 }, // п
-    { 15, 20, 16, 0, 14, 75, 30669 }, // р
-    { 13, 15, 13, 0, 14, 49, 30744 }, // с
-    { 15, 13, 15, 0, 13, 49, 30793 }, // т
-    { 17, 19, 16, 0, 13, 81, 30842 }, // у
-    { 19, 26, 20, 0, 20, 124, 30923 }, // ф
-    { 16, 13, 16, 0, 13, 52, 31047 }, // х
-    { 18, 18, 18, 0, 13, 81, 31099 }, // ц
-    { 16, 13, 16, 0, 13, 52, 31180 }, // ч
-    { 23, 13, 23, 0, 13, 75, 31232 }, // ш
-    { 23, 18, 23, 0, 13, 104, 31307 }, // щ
-    { 16, 14, 17, 0, 13, 56, 31411 }, // ъ
-    { 22, 14, 22, 0, 13, 77, 31467 }, // ы
-    { 14, 14, 14, 0, 13, 49, 31544 }, // ь
-    { 13, 15, 14, 0, 14, 49, 31593 }, // э
-    { 22, 15, 22, 0, 14, 83, 31642 }, // ю
-    { 15, 14, 15, 0, 13, 53, 31725 }, // я
-    { 13, 22, 14, 0, 21, 72, 31778 }, // ѐ
-    { 13, 21, 14, 0, 20, 69, 31850 }, // ё
-    { 15, 26, 16, 0, 20, 98, 31919 }, // ђ
-    { 13, 21, 13, 0, 21, 69, 32017 }, // ѓ
-    { 13, 15, 13, 0, 14, 49, 32086 }, // є
-    { 11, 15, 13, 1, 14, 42, 32135 }, // ѕ
-    { 9, 20, 9, 0, 20, 45, 32177 }, // і
-    { 10, 20, 9, 0, 20, 50, 32222 }, // ї
-    { 9, 26, 8, -2, 20, 59, 32272 }, // ј
-    { 20, 14, 20, 0, 13, 70, 32331 }, // љ
-    { 22, 14, 22, 0, 13, 77, 32401 }, // њ
-    { 17, 20, 17, 0, 20, 85, 32478 }, // ћ
-    { 16, 22, 16, 0, 21, 88, 32563 }, // ќ
-    { 17, 21, 17, 0, 21, 90, 32651 }, // ѝ
-    { 17, 26, 16, 0, 20, 111, 32741 }, // ў
-    { 17, 18, 17, 0, 13, 77, 32852 }, // џ
-    { 19, 21, 19, 0, 20, 100, 32929 }, // Ѣ
-    { 16, 19, 16, 0, 18, 76, 33029 }, // ѣ
-    { 18, 19, 20, 1, 18, 86, 33105 }, // Ѳ
-    { 15, 15, 15, 0, 14, 57, 33191 }, // ѳ
-    { 20, 19, 20, 0, 18, 95, 33248 }, // Ѵ
-    { 17, 15, 17, 0, 14, 64, 33343 }, // ѵ
-    { 21, 30, 21, 0, 24, 158, 33407 }, // Ҋ
-    { 17, 25, 17, 0, 20, 107, 33565 }, // ҋ
-    { 16, 19, 16, 0, 18, 76, 33672 }, // Ҍ
-    { 13, 19, 14, 0, 18, 62, 33748 }, // ҍ
-    { 16, 18, 16, 0, 18, 72, 33810 }, // Ҏ
-    { 15, 20, 16, 0, 14, 75, 33882 }, // ҏ
-    { 14, 21, 14, 0, 21, 74, 33957 }, // Ґ
-    { 12, 17, 13, 0, 17, 51, 34031 }, // ґ
-    { 15, 18, 15, 0, 18, 68, 34082 }, // Ғ
-    { 13, 13, 13, 0, 13, 43, 34150 }, // ғ
-    { 17, 24, 18, 0, 18, 102, 34193 }, // Ҕ
-    { 15, 19, 15, 0, 13, 72, 34295 }, // ҕ
-    { 28, 24, 28, 0, 18, 168, 34367 }, // Җ
-    { 23, 19, 22, 0, 14, 110, 34535 }, // җ
-    { 15, 24, 16, 0, 18, 90, 34645 }, // Ҙ
-    { 13, 19, 13, 0, 14, 62, 34735 }, // ҙ
-    { 19, 24, 19, 0, 18, 114, 34797 }, // Қ
-    { 16, 19, 16, 0, 14, 76, 34911 }, // қ
-    { 20, 19, 20, 0, 18, 95, 34987 }, // Ҝ
-    { 17, 15, 17, 0, 14, 64, 35082 }, // ҝ
-    { 19, 19, 19, 0, 18, 91, 35146 }, // Ҟ
-    { 16, 19, 16, 0, 18, 76, 35237 }, // ҟ
-    { 22, 19, 22, 0, 18, 105, 35313 }, // Ҡ
-    { 19, 15, 19, 0, 14, 72, 35418 }, // ҡ
-    { 22, 24, 22, 0, 18, 132, 35490 }, // Ң
-    { 18, 18, 18, 0, 13, 81, 35622 }, // ң
-    { 25, 18, 25, 0, 18, 113, 35703 }, // Ҥ
-    { 20, 13, 21, 0, 13, 65, 35816 }, // ҥ
-    { 27, 24, 28, 0, 18, 162, 35881 }, // Ҧ
-    { 23, 19, 24, 0, 13, 110, 36043 }, // ҧ
-    { 20, 19, 21, 1, 18, 95, 36153 }, // Ҩ
-    { 17, 15, 17, 0, 14, 64, 36248 }, // ҩ
-    { 15, 24, 16, 1, 18, 90, 36312 }, // Ҫ
-    { 13, 19, 13, 0, 14, 62, 36402 }, // ҫ
-    { 18, 24, 18, 0, 18, 108, 36464 }, // Ҭ
-    { 15, 18, 15, 0, 13, 68, 36572 }, // ҭ
-    { 18, 18, 18, 0, 18, 81, 36640 }, // Ү
-    { 17, 19, 16, 0, 13, 81, 36721 }, // ү
-    { 18, 18, 18, 0, 18, 81, 36802 }, // Ұ
-    { 17, 19, 16, 0, 13, 81, 36883 }, // ұ
-    { 20, 24, 20, 0, 18, 120, 36964 }, // Ҳ
-    { 16, 18, 16, 0, 13, 72, 37084 }, // ҳ
-    { 23, 24, 23, 0, 18, 138, 37156 }, // Ҵ
-    { 20, 18, 20, 0, 13, 90, 37294 }, // ҵ
-    { 20, 24, 20, 0, 18, 120, 37384 }, // Ҷ
-    { 16, 18, 16, 0, 13, 72, 37504 }, // ҷ
-    { 19, 18, 19, 0, 18, 86, 37576 }, // Ҹ
-    { 16, 13, 16, 0, 13, 52, 37662 }, // ҹ
-    { 20, 18, 19, 0, 18, 90, 37714 }, // Һ
-    { 17, 20, 17, 0, 20, 85, 37804 }, // һ
-    { 21, 19, 21, 0, 18, 100, 37889 }, // Ҽ
-    { 16, 15, 17, 0, 14, 60, 37989 }, // ҽ
-    { 21, 24, 21, 0, 18, 126, 38049 }, // Ҿ
-    { 16, 19, 17, 0, 14, 76, 38175 }, // ҿ
-    { 10, 18, 10, 0, 18, 45, 38251 }, // Ӏ
-    { 28, 25, 28, 0, 24, 175, 38296 }, // Ӂ
-    { 23, 21, 22, 0, 20, 121, 38471 }, // ӂ
-    { 18, 24, 19, 0, 18, 108, 38592 }, // Ӄ
-    { 15, 20, 16, 0, 14, 75, 38700 }, // ӄ
-    { 19, 24, 19, 0, 18, 114, 38775 }, // Ӆ
-    { 16, 18, 16, 0, 13, 72, 38889 }, // ӆ
-    { 21, 24, 21, 0, 18, 126, 38961 }, // Ӈ
-    { 17, 19, 17, 0, 13, 81, 39087 }, // ӈ
-    { 21, 24, 21, 0, 18, 126, 39168 }, // Ӊ
-    { 18, 18, 18, 0, 13, 81, 39294 }, // ӊ
-    { 19, 24, 19, 0, 18, 114, 39375 }, // Ӌ
-    { 16, 18, 16, 0, 13, 72, 39489 }, // ӌ
-    { 24, 24, 24, 0, 18, 144, 39561 }, // Ӎ
-    { 20, 18, 20, 0, 13, 90, 39705 }, // ӎ
-    { 9, 20, 10, 1, 20, 45, 39795 }, // ӏ
-    { 20, 24, 19, 0, 24, 120, 39840 }, // Ӑ
-    { 14, 21, 14, 1, 20, 74, 39960 }, // ӑ
-    { 20, 24, 19, 0, 24, 120, 40034 }, // Ӓ
-    { 14, 21, 14, 1, 20, 74, 40154 }, // ӓ
-    { 25, 18, 25, -1, 18, 113, 40228 }, // Ӕ
-    { 19, 15, 21, 1, 14, 72, 40341 }, // ӕ
-    { 16, 24, 16, 0, 24, 96, 40413 }, // Ӗ
-    { 13, 21, 14, 0, 20, 69, 40509 }, // ӗ
-    { 16, 19, 17, 1, 18, 76, 40578 }, // Ә
-    { 13, 15, 14, 0, 14, 49, 40654 }, // ә
-    { 16, 25, 17, 1, 24, 100, 40703 }, // Ӛ
-    { 13, 21, 14, 0, 20, 69, 40803 }, // ӛ
-    { 28, 25, 28, 0, 24, 175, 40872 }, // Ӝ
-    { 23, 21, 22, 0, 20, 121, 41047 }, // ӝ
-    { 15, 25, 16, 0, 24, 94, 41168 }, // Ӟ
-    { 13, 21, 13, 0, 20, 69, 41262 }, // ӟ
-    { 14, 19, 15, 0, 18, 67, 41331 }, // Ӡ
-    { 13, 19, 14, 0, 13, 62, 41398 }, // ӡ
-    { 21, 23, 21, 0, 23, 121, 41460 }, // Ӣ
-    { 17, 18, 17, 0, 18, 77, 41581 }, // ӣ
-    { 21, 24, 21, 0, 24, 126, 41658 }, // Ӥ
-    { 17, 20, 17, 0, 20, 85, 41784 }, // ӥ
-    { 18, 25, 20, 1, 24, 113, 41869 }, // Ӧ
-    { 15, 21, 15, 0, 20, 79, 41982 }, // ӧ
-    { 18, 19, 20, 1, 18, 86, 42061 }, // Ө
-    { 15, 15, 15, 0, 14, 57, 42147 }, // ө
-    { 18, 25, 20, 1, 24, 113, 42204 }, // Ӫ
-    { 15, 21, 15, 0, 20, 79, 42317 }, // ӫ
-    { 17, 25, 17, 0, 24, 107, 42396 }, // Ӭ
-    { 13, 21, 14, 0, 20, 69, 42503 }, // ӭ
-    { 18, 24, 18, 0, 23, 108, 42572 }, // Ӯ
-    { 17, 24, 16, 0, 18, 102, 42680 }, // ӯ
-    { 18, 25, 18, 0, 24, 113, 42782 }, // Ӱ
-    { 17, 26, 16, 0, 20, 111, 42895 }, // ӱ
-    { 18, 26, 18, 0, 25, 117, 43006 }, // Ӳ
-    { 17, 27, 16, 0, 21, 115, 43123 }, // ӳ
-    { 19, 24, 19, 0, 24, 114, 43238 }, // Ӵ
-    { 16, 20, 16, 0, 20, 80, 43352 }, // ӵ
-    { 15, 24, 16, 0, 18, 90, 43432 }, // Ӷ
-    { 13, 18, 13, 0, 13, 59, 43522 }, // ӷ
-    { 25, 25, 26, 0, 24, 157, 43581 }, // Ӹ
-    { 22, 21, 22, 0, 20, 116, 43738 }, // ӹ
-    { 15, 24, 15, 0, 18, 90, 43854 }, // Ӻ
-    { 13, 18, 13, 0, 13, 59, 43944 }, // ӻ
-    { 19, 24, 19, 0, 18, 114, 44003 }, // Ӽ
-    { 15, 19, 15, 0, 13, 72, 44117 }, // ӽ
-    { 19, 18, 19, 0, 18, 86, 44189 }, // Ӿ
-    { 16, 13, 16, 0, 13, 52, 44275 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 44327 }, //  
-    { 0, 0, 25, 0, 0, 0, 44327 }, //  
-    { 0, 0, 13, 0, 0, 0, 44327 }, //  
-    { 0, 0, 25, 0, 0, 0, 44327 }, //  
-    { 0, 0, 8, 0, 0, 0, 44327 }, //  
-    { 0, 0, 6, 0, 0, 0, 44327 }, //  
-    { 0, 0, 4, 0, 0, 0, 44327 }, //  
-    { 0, 0, 16, 0, 0, 0, 44327 }, //  
-    { 0, 0, 7, 0, 0, 0, 44327 }, //  
-    { 0, 0, 5, 0, 0, 0, 44327 }, //  
-    { 0, 0, 1, 0, 0, 0, 44327 }, //  
-    { 0, 0, 0, 0, 0, 0, 44327 }, // ​
-    { 2, 21, 0, -1, 15, 11, 44327 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 44338 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 44373 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 44421 }, // ‏
-    { 9, 3, 10, 0, 8, 7, 44469 }, // ‐
-    { 9, 3, 10, 0, 8, 7, 44476 }, // ‑
-    { 13, 3, 16, 1, 10, 10, 44483 }, // ‒
-    { 13, 3, 13, 0, 8, 10, 44493 }, // –
-    { 25, 3, 25, 0, 8, 19, 44503 }, // —
-    { 25, 3, 25, 0, 8, 19, 44522 }, // ―
-    { 9, 26, 13, 2, 20, 59, 44541 }, // ‖
-    { 13, 7, 13, 0, -1, 23, 44600 }, // ‗
-    { 6, 9, 6, 0, 19, 14, 44623 }, // ‘
-    { 6, 9, 6, 0, 19, 14, 44637 }, // ’
-    { 6, 9, 6, 0, 4, 14, 44651 }, // ‚
-    { 6, 9, 6, 0, 19, 14, 44665 }, // ‛
-    { 11, 9, 11, 0, 19, 25, 44679 }, // “
-    { 11, 9, 11, 0, 19, 25, 44704 }, // ”
-    { 11, 9, 11, 0, 4, 25, 44729 }, // „
-    { 11, 9, 11, 0, 19, 25, 44754 }, // ‟
-    { 12, 17, 12, 0, 18, 51, 44779 }, // †
-    { 12, 20, 12, 0, 18, 60, 44830 }, // ‡
-    { 6, 7, 8, 1, 10, 11, 44890 }, // •
-    { 9, 9, 16, 3, 13, 21, 44901 }, // ‣
-    { 5, 5, 7, 1, 4, 7, 44922 }, // ․
-    { 12, 5, 13, 0, 4, 15, 44929 }, // ‥
-    { 23, 5, 25, 1, 4, 29, 44944 }, // …
-    { 5, 5, 7, 1, 9, 7, 44973 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 44980 }, //  
-    { 0, 0, 0, 0, 0, 0, 44980 }, //  
-    { 8, 24, 0, -4, 18, 48, 44980 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 45028 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 45076 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 45124 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 45190 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 45256 }, //  
-    { 33, 21, 35, 1, 19, 174, 45256 }, // ‰
-    { 7, 9, 7, 0, 18, 16, 45430 }, // ′
-    { 12, 9, 12, 0, 18, 27, 45446 }, // ″
-    { 18, 9, 18, 0, 18, 41, 45473 }, // ‴
-    { 7, 9, 7, 0, 18, 16, 45514 }, // ‵
-    { 12, 9, 13, 0, 18, 27, 45530 }, // ‶
-    { 18, 9, 18, 0, 18, 41, 45557 }, // ‷
-    { 11, 6, 12, 1, 0, 17, 45598 }, // ‸
-    { 8, 11, 8, 0, 12, 22, 45615 }, // ‹
-    { 7, 11, 8, 1, 12, 20, 45637 }, // ›
-    { 16, 18, 16, 0, 17, 72, 45657 }, // ※
-    { 13, 20, 15, 1, 19, 65, 45729 }, // ‼
-    { 13, 3, 13, 0, 21, 10, 45794 }, // ‾
-    { 7, 3, 8, 0, 8, 6, 45804 }, // ⁃
-    { 14, 21, 5, -5, 19, 74, 45810 }, // ⁄
-    { 22, 20, 23, 1, 19, 110, 45884 }, // ⁇
-    { 18, 20, 19, 1, 19, 90, 45994 }, // ⁈
-    { 18, 20, 19, 1, 19, 90, 46084 }, // ⁉
-    { 15, 6, 25, 5, 10, 23, 46174 }, // ⁓
-    { 23, 9, 23, 0, 18, 52, 46197 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 46249 }, //  
-    { 0, 0, 0, 0, 0, 0, 46249 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 46249 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 46249 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 46249 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 46249 }, // ⁤
-    { 11, 13, 11, 0, 21, 36, 46249 }, // ⁰
-    { 11, 13, 11, 0, 21, 36, 46285 }, // ⁴
-    { 9, 13, 11, 1, 21, 30, 46321 }, // ⁵
-    { 10, 13, 11, 1, 21, 33, 46351 }, // ⁶
-    { 10, 13, 11, 1, 21, 33, 46384 }, // ⁷
-    { 9, 13, 11, 1, 21, 30, 46417 }, // ⁸
-    { 10, 13, 11, 1, 21, 33, 46447 }, // ⁹
-    { 12, 9, 14, 1, 18, 27, 46480 }, // ⁿ
-    { 11, 12, 11, 0, 8, 33, 46507 }, // ₀
-    { 9, 13, 11, 1, 9, 30, 46540 }, // ₁
-    { 10, 12, 11, 1, 8, 30, 46570 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 46600 }, // ₃
-    { 11, 12, 11, 0, 8, 33, 46627 }, // ₄
-    { 9, 12, 11, 1, 8, 27, 46660 }, // ₅
-    { 10, 12, 11, 1, 8, 30, 46687 }, // ₆
-    { 10, 12, 11, 1, 8, 30, 46717 }, // ₇
-    { 9, 12, 11, 1, 8, 27, 46747 }, // ₈
-    { 10, 12, 11, 1, 8, 30, 46774 }, // ₉
-    { 14, 18, 16, 1, 18, 63, 46804 }, // ₣
-    { 15, 19, 16, 0, 18, 72, 46867 }, // ₤
-    { 34, 19, 34, 0, 18, 162, 46939 }, // ₧
-    { 16, 19, 16, 0, 18, 76, 47101 }, // €
-    { 17, 12, 25, 4, 15, 51, 47177 }, // ←
-    { 13, 17, 25, 6, 17, 56, 47228 }, // ↑
-    { 17, 12, 25, 4, 15, 51, 47284 }, // →
-    { 13, 17, 25, 6, 17, 56, 47335 }, // ↓
-    { 17, 11, 25, 4, 14, 47, 47391 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 47438 }, // ↕
-    { 13, 18, 25, 6, 18, 59, 47485 }, // ↨
-    { 11, 18, 25, 7, 18, 50, 47544 }, // ↲
-    { 11, 18, 25, 7, 18, 50, 47594 }, // ↳
-    { 15, 14, 25, 5, 16, 53, 47644 }, // ↵
-    { 17, 15, 25, 4, 16, 64, 47697 }, // ⇐
-    { 15, 17, 25, 5, 17, 64, 47761 }, // ⇑
-    { 17, 15, 25, 4, 16, 64, 47825 }, // ⇒
-    { 15, 17, 25, 5, 17, 64, 47889 }, // ⇓
-    { 17, 13, 25, 4, 15, 56, 47953 }, // ⇔
-    { 18, 19, 25, 3, 18, 86, 48009 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 48095 }, // ∂
-    { 13, 18, 25, 6, 18, 59, 48164 }, // ∃
-    { 19, 21, 25, 3, 19, 100, 48223 }, // ∅
-    { 17, 18, 17, 0, 18, 77, 48323 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 48400 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 48481 }, // ∈
-    { 17, 23, 25, 4, 20, 98, 48558 }, // ∉
-    { 17, 15, 25, 4, 16, 64, 48656 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 48720 }, // ∋
-    { 17, 23, 25, 4, 20, 98, 48797 }, // ∌
-    { 17, 15, 25, 4, 16, 64, 48895 }, // ∍
-    { 21, 22, 21, 0, 18, 116, 48959 }, // ∏
-    { 16, 23, 17, 0, 18, 92, 49075 }, // ∑
-    { 12, 3, 16, 2, 10, 9, 49167 }, // −
-    { 13, 20, 13, 0, 18, 65, 49176 }, // ∕
-    { 13, 20, 13, 0, 18, 65, 49241 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 49306 }, // ∗
-    { 10, 10, 16, 3, 13, 25, 49345 }, // ∘
-    { 6, 5, 16, 5, 9, 8, 49370 }, // ∙
-    { 17, 24, 16, -1, 21, 102, 49378 }, // √
-    { 13, 10, 16, 1, 13, 33, 49480 }, // ∝
-    { 16, 10, 16, 0, 13, 40, 49513 }, // ∞
-    { 17, 18, 25, 4, 18, 77, 49553 }, // ∟
-    { 19, 18, 25, 3, 18, 86, 49630 }, // ∠
-    { 4, 26, 13, 4, 20, 26, 49716 }, // ∣
-    { 9, 26, 13, 2, 20, 59, 49742 }, // ∥
-    { 18, 18, 25, 4, 18, 81, 49801 }, // ∧
-    { 18, 18, 25, 4, 18, 81, 49882 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 49963 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 50031 }, // ∪
-    { 15, 26, 16, 0, 20, 98, 50103 }, // ∫
-    { 17, 15, 25, 4, 14, 64, 50201 }, // ∴
-    { 17, 15, 25, 4, 14, 64, 50265 }, // ∵
-    { 6, 15, 8, 1, 16, 23, 50329 }, // ∶
-    { 17, 15, 25, 4, 14, 64, 50352 }, // ∷
-    { 15, 6, 25, 5, 10, 23, 50416 }, // ∼
-    { 15, 15, 25, 5, 16, 57, 50439 }, // ≅
-    { 13, 11, 16, 1, 14, 36, 50496 }, // ≈
-    { 15, 10, 25, 5, 12, 38, 50532 }, // ≍
-    { 12, 13, 16, 2, 15, 39, 50570 }, // ≠
-    { 15, 13, 25, 5, 14, 49, 50609 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 50658 }, // ≤
-    { 12, 16, 16, 2, 16, 48, 50703 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 50751 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 50820 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 50889 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 50953 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 51051 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 51149 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 51226 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 51303 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 51394 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 51485 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 51576 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 51667 }, // ⊥
-    { 6, 5, 16, 5, 9, 8, 51735 }, // ⋅
-    { 23, 5, 25, 1, 9, 29, 51743 }, // ⋯
-    { 25, 24, 25, 0, 21, 150, 51772 }, // �
+    { 16, 18, 16, 0, 18, 72, 2048 }, // E
+    { 14, 18, 15, 0, 18, 63, 2120 }, // F
+    { 17, 19, 19, 1, 18, 81, 2183 }, // G
+    { 21, 18, 22, 0, 18, 95, 2264 }, // H
+    { 10, 18, 10, 0, 18, 45, 2359 }, // I
+    { 12, 24, 10, -2, 18, 72, 2404 }, // J
+    { 19, 19, 19, 0, 18, 91, 2476 }, // K
+    { 16, 18, 16, 0, 18, 72, 2567 }, // L
+    { 24, 18, 24, 0, 18, 108, 2639 }, // M
+    { 21, 19, 20, 0, 18, 100, 2747 }, // N
+    { 18, 19, 20, 1, 18, 86, 2847 }, // O
+    { 16, 18, 16, 0, 18, 72, 2933 }, // P
+    { 19, 24, 20, 1, 18, 114, 3005 }, // Q
+    { 19, 19, 18, 0, 18, 91, 3119 }, // R
+    { 13, 19, 15, 1, 18, 62, 3210 }, // S
+    { 18, 18, 18, 0, 18, 81, 3272 }, // T
+    { 20, 19, 20, 0, 18, 95, 3353 }, // U
+    { 20, 19, 19, 0, 18, 95, 3448 }, // V
+    { 28, 19, 28, 0, 18, 133, 3543 }, // W
+    { 19, 18, 19, 0, 18, 86, 3676 }, // X
+    { 18, 18, 18, 0, 18, 81, 3762 }, // Y
+    { 15, 19, 15, 0, 18, 72, 3843 }, // Z
+    { 7, 24, 8, 1, 20, 42, 3915 }, // [
+    { 13, 20, 13, 0, 18, 65, 3957 }, // <backslash>
+    { 6, 24, 8, 1, 20, 36, 4022 }, // ]
+    { 13, 12, 16, 1, 16, 39, 4096 }, // ^
+    { 13, 3, 13, 0, -1, 10, 4135 }, // _
+    { 6, 6, 17, 5, 21, 9, 4145 }, // `
+    { 14, 15, 14, 1, 14, 53, 4154 }, // a
+    { 16, 21, 15, -1, 20, 84, 4207 }, // b
+    { 13, 15, 13, 0, 14, 49, 4291 }, // c
+    { 16, 21, 16, 0, 20, 84, 4340 }, // d
+    { 13, 15, 14, 0, 14, 49, 4424 }, // e
+    { 13, 20, 11, 0, 20, 65, 4473 }, // f
+    { 15, 20, 15, 0, 14, 75, 4538 }, // g
+    { 17, 20, 17, 0, 20, 85, 4613 }, // h
+    { 9, 20, 9, 0, 20, 45, 4698 }, // i
+    { 9, 26, 8, -2, 20, 59, 4743 }, // j
+    { 16, 21, 16, 0, 20, 84, 4802 }, // k
+    { 9, 20, 9, 0, 20, 45, 4886 }, // l
+    { 25, 14, 25, 0, 14, 88, 4931 }, // m
+    { 17, 14, 17, 0, 14, 60, 5019 }, // n
+    { 15, 15, 15, 0, 14, 57, 5079 }, // o
+    { 15, 20, 16, 0, 14, 75, 5136 }, // p
+    { 15, 20, 15, 0, 14, 75, 5211 }, // q
+    { 12, 14, 12, 0, 14, 42, 5286 }, // r
+    { 11, 15, 13, 1, 14, 42, 5328 }, // s
+    { 12, 18, 11, -1, 17, 54, 5370 }, // t
+    { 17, 15, 16, 0, 14, 64, 5424 }, // u
+    { 17, 14, 16, 0, 13, 60, 5488 }, // v
+    { 23, 14, 23, 0, 13, 81, 5548 }, // w
+    { 16, 13, 16, 0, 13, 52, 5629 }, // x
+    { 17, 19, 16, 0, 13, 81, 5681 }, // y
+    { 13, 14, 13, 0, 13, 46, 5762 }, // z
+    { 9, 25, 10, 1, 20, 57, 5808 }, // {
+    { 4, 23, 8, 2, 20, 23, 5865 }, // |
+    { 9, 25, 10, 0, 20, 57, 5888 }, // }
+    { 13, 5, 16, 1, 11, 17, 5945 }, // ~
+    { 0, 0, 5, 0, 0, 0, 5962 }, //  
+    { 6, 20, 7, 0, 14, 30, 5962 }, // ¡
+    { 13, 25, 16, 1, 20, 82, 5992 }, // ¢
+    { 15, 19, 16, 0, 18, 72, 6144 }, // £
+    { 14, 13, 16, 1, 15, 46, 6216 }, // ¤
+    { 17, 18, 16, -1, 18, 77, 6262 }, // ¥
+    { 4, 23, 8, 2, 20, 23, 6339 }, // ¦
+    { 12, 21, 13, 0, 18, 63, 6362 }, // §
+    { 10, 5, 17, 3, 20, 13, 6425 }, // ¨
+    { 19, 19, 20, 0, 18, 91, 6438 }, // ©
+    { 9, 13, 11, 1, 18, 30, 6529 }, // ª
+    { 14, 11, 15, 0, 12, 39, 6559 }, // «
+    { 12, 7, 16, 2, 12, 21, 6598 }, // ¬
+    { 9, 3, 10, 0, 8, 7, 6619 }, // ­
+    { 14, 14, 15, 0, 20, 49, 6626 }, // ®
+    { 9, 3, 17, 4, 18, 7, 6675 }, // ¯
+    { 10, 10, 13, 2, 18, 25, 6682 }, // °
+    { 12, 16, 16, 2, 15, 48, 6707 }, // ±
+    { 10, 12, 11, 1, 21, 30, 6755 }, // ²
+    { 9, 13, 11, 1, 21, 30, 6785 }, // ³
+    { 5, 6, 17, 6, 21, 8, 6815 }, // ´
+    { 16, 20, 16, 1, 14, 80, 6823 }, // µ
+    { 15, 22, 15, 0, 18, 83, 6903 }, // ¶
+    { 5, 5, 7, 1, 9, 7, 6986 }, // ·
+    { 5, 6, 17, 6, -1, 8, 6993 }, // ¸
+    { 9, 12, 11, 1, 21, 27, 7001 }, // ¹
+    { 9, 13, 11, 1, 18, 30, 7028 }, // º
+    { 13, 11, 15, 1, 12, 36, 7058 }, // »
+    { 26, 21, 27, 1, 19, 137, 7094 }, // ¼
+    { 25, 21, 27, 1, 19, 132, 7231 }, // ½
+    { 26, 21, 27, 1, 19, 137, 7363 }, // ¾
+    { 10, 20, 12, 1, 14, 50, 7500 }, // ¿
+    { 20, 25, 19, 0, 25, 125, 7550 }, // À
+    { 20, 25, 19, 0, 25, 125, 7675 }, // Á
+    { 20, 25, 19, 0, 25, 125, 7800 }, // Â
+    { 20, 24, 19, 0, 24, 120, 7925 }, // Ã
+    { 20, 24, 19, 0, 24, 120, 8045 }, // Ä
+    { 20, 25, 19, 0, 25, 125, 8192 }, // Å
+    { 25, 18, 25, -1, 18, 113, 8317 }, // Æ
+    { 15, 25, 16, 1, 18, 94, 8430 }, // Ç
+    { 16, 25, 16, 0, 25, 100, 8524 }, // È
+    { 16, 25, 16, 0, 25, 100, 8624 }, // É
+    { 16, 25, 16, 0, 25, 100, 8724 }, // Ê
+    { 16, 24, 16, 0, 24, 96, 8824 }, // Ë
+    { 10, 25, 10, 0, 25, 63, 8920 }, // Ì
+    { 10, 25, 10, 0, 25, 63, 8983 }, // Í
+    { 10, 25, 10, 0, 25, 63, 9046 }, // Î
+    { 10, 24, 10, 0, 24, 60, 9109 }, // Ï
+    { 19, 19, 19, 0, 18, 91, 9169 }, // Ð
+    { 21, 25, 20, 0, 24, 132, 9260 }, // Ñ
+    { 18, 26, 20, 1, 25, 117, 9392 }, // Ò
+    { 18, 26, 20, 1, 25, 117, 9509 }, // Ó
+    { 18, 26, 20, 1, 25, 117, 9626 }, // Ô
+    { 18, 25, 20, 1, 24, 113, 9743 }, // Õ
+    { 18, 25, 20, 1, 24, 113, 9856 }, // Ö
+    { 11, 11, 16, 2, 14, 31, 9969 }, // ×
+    { 20, 19, 20, 0, 18, 95, 10000 }, // Ø
+    { 20, 26, 20, 0, 25, 130, 10095 }, // Ù
+    { 20, 26, 20, 0, 25, 130, 10240 }, // Ú
+    { 20, 26, 20, 0, 25, 130, 10370 }, // Û
+    { 20, 25, 20, 0, 24, 125, 10500 }, // Ü
+    { 18, 25, 18, 0, 25, 113, 10625 }, // Ý
+    { 16, 18, 16, 0, 18, 72, 10738 }, // Þ
+    { 16, 21, 17, 0, 20, 84, 10810 }, // ß
+    { 14, 22, 14, 1, 21, 77, 10894 }, // à
+    { 14, 22, 14, 1, 21, 77, 10971 }, // á
+    { 14, 22, 14, 1, 21, 77, 11048 }, // â
+    { 14, 21, 14, 1, 20, 74, 11125 }, // ã
+    { 14, 21, 14, 1, 20, 74, 11199 }, // ä
+    { 14, 22, 14, 1, 21, 77, 11273 }, // å
+    { 19, 15, 21, 1, 14, 72, 11350 }, // æ
+    { 13, 21, 13, 0, 14, 69, 11422 }, // ç
+    { 13, 22, 14, 0, 21, 72, 11491 }, // è
+    { 13, 22, 14, 0, 21, 72, 11563 }, // é
+    { 13, 22, 14, 0, 21, 72, 11635 }, // ê
+    { 13, 21, 14, 0, 20, 69, 11707 }, // ë
+    { 9, 21, 9, 0, 21, 48, 11776 }, // ì
+    { 9, 21, 9, 0, 21, 48, 11824 }, // í
+    { 9, 21, 9, 0, 21, 48, 11872 }, // î
+    { 10, 20, 9, 0, 20, 50, 11920 }, // ï
+    { 15, 22, 15, 0, 21, 83, 11970 }, // ð
+    { 17, 20, 17, 0, 20, 85, 12053 }, // ñ
+    { 15, 22, 15, 0, 21, 83, 12138 }, // ò
+    { 15, 22, 15, 0, 21, 83, 12288 }, // ó
+    { 15, 22, 15, 0, 21, 83, 12371 }, // ô
+    { 15, 21, 15, 0, 20, 79, 12454 }, // õ
+    { 15, 21, 15, 0, 20, 79, 12533 }, // ö
+    { 12, 13, 16, 2, 15, 39, 12612 }, // ÷
+    { 15, 15, 15, 0, 14, 57, 12651 }, // ø
+    { 17, 22, 16, 0, 21, 94, 12708 }, // ù
+    { 17, 22, 16, 0, 21, 94, 12802 }, // ú
+    { 17, 22, 16, 0, 21, 94, 12896 }, // û
+    { 17, 21, 16, 0, 20, 90, 12990 }, // ü
+    { 17, 27, 16, 0, 21, 115, 13080 }, // ý
+    { 15, 26, 16, 0, 20, 98, 13195 }, // þ
+    { 17, 26, 16, 0, 20, 111, 13293 }, // ÿ
+    { 20, 23, 19, 0, 23, 115, 13404 }, // Ā
+    { 14, 19, 14, 1, 18, 67, 13519 }, // ā
+    { 20, 24, 19, 0, 24, 120, 13586 }, // Ă
+    { 14, 21, 14, 1, 20, 74, 13706 }, // ă
+    { 20, 24, 19, 0, 18, 120, 13780 }, // Ą
+    { 14, 20, 14, 1, 14, 70, 13900 }, // ą
+    { 15, 26, 16, 1, 25, 98, 13970 }, // Ć
+    { 13, 22, 13, 0, 21, 72, 14068 }, // ć
+    { 15, 26, 16, 1, 25, 98, 14140 }, // Ĉ
+    { 13, 22, 13, 0, 21, 72, 14238 }, // ĉ
+    { 15, 25, 16, 1, 24, 94, 14336 }, // Ċ
+    { 13, 21, 13, 0, 20, 69, 14430 }, // ċ
+    { 15, 26, 16, 1, 25, 98, 14499 }, // Č
+    { 13, 22, 13, 0, 21, 72, 14597 }, // č
+    { 19, 26, 19, 0, 25, 124, 14669 }, // Ď
+    { 18, 21, 16, 0, 20, 95, 14793 }, // ď
+    { 19, 19, 19, 0, 18, 91, 14888 }, // Đ
+    { 16, 21, 16, 0, 20, 84, 14979 }, // đ
+    { 16, 23, 16, 0, 23, 92, 15063 }, // Ē
+    { 13, 19, 14, 0, 18, 62, 15155 }, // ē
+    { 16, 24, 16, 0, 24, 96, 15217 }, // Ĕ
+    { 13, 21, 14, 0, 20, 69, 15313 }, // ĕ
+    { 16, 24, 16, 0, 24, 96, 15382 }, // Ė
+    { 13, 21, 14, 0, 20, 69, 15478 }, // ė
+    { 16, 24, 16, 0, 18, 96, 15547 }, // Ę
+    { 13, 20, 14, 0, 14, 65, 15643 }, // ę
+    { 16, 25, 16, 0, 25, 100, 15708 }, // Ě
+    { 13, 22, 14, 0, 21, 72, 15808 }, // ě
+    { 17, 26, 19, 1, 25, 111, 15880 }, // Ĝ
+    { 15, 27, 15, 0, 21, 102, 15991 }, // ĝ
+    { 17, 25, 19, 1, 24, 107, 16093 }, // Ğ
+    { 15, 26, 15, 0, 20, 98, 16200 }, // ğ
+    { 17, 25, 19, 1, 24, 107, 16384 }, // Ġ
+    { 15, 26, 15, 0, 20, 98, 16491 }, // ġ
+    { 17, 25, 19, 1, 18, 107, 16589 }, // Ģ
+    { 15, 28, 15, 0, 22, 105, 16696 }, // ģ
+    { 21, 25, 22, 0, 25, 132, 16801 }, // Ĥ
+    { 18, 26, 17, -1, 26, 117, 16933 }, // ĥ
+    { 21, 18, 22, 0, 18, 95, 17050 }, // Ħ
+    { 17, 20, 17, 0, 20, 85, 17145 }, // ħ
+    { 10, 24, 10, 0, 24, 60, 17230 }, // Ĩ
+    { 9, 20, 9, 0, 20, 45, 17290 }, // ĩ
+    { 10, 23, 10, 0, 23, 58, 17335 }, // Ī
+    { 9, 18, 9, 0, 18, 41, 17393 }, // ī
+    { 10, 24, 10, 0, 24, 60, 17434 }, // Ĭ
+    { 9, 20, 9, 0, 20, 45, 17494 }, // ĭ
+    { 10, 24, 10, 0, 18, 60, 17539 }, // Į
+    { 10, 26, 9, 0, 20, 65, 17599 }, // į
+    { 10, 24, 10, 0, 24, 60, 17664 }, // İ
+    { 9, 14, 9, 0, 14, 32, 17724 }, // ı
+    { 20, 24, 20, 0, 18, 120, 17756 }, // Ĳ
+    { 16, 26, 17, 0, 20, 104, 17876 }, // ĳ
+    { 12, 31, 10, -2, 25, 93, 17980 }, // Ĵ
+    { 11, 27, 8, -2, 21, 75, 18073 }, // ĵ
+    { 19, 25, 19, 0, 18, 119, 18148 }, // Ķ
+    { 16, 27, 16, 0, 20, 108, 18267 }, // ķ
+    { 17, 15, 16, 0, 14, 64, 18432 }, // ĸ
+    { 16, 25, 16, 0, 25, 100, 18496 }, // Ĺ
+    { 9, 26, 9, 0, 26, 59, 18596 }, // ĺ
+    { 16, 25, 16, 0, 18, 100, 18655 }, // Ļ
+    { 9, 27, 9, 0, 20, 61, 18755 }, // ļ
+    { 16, 20, 16, 0, 20, 80, 18816 }, // Ľ
+    { 11, 20, 9, 0, 20, 55, 18896 }, // ľ
+    { 16, 18, 16, 0, 18, 72, 18951 }, // Ŀ
+    { 14, 20, 13, 0, 20, 70, 19023 }, // ŀ
+    { 17, 18, 16, -1, 18, 77, 19093 }, // Ł
+    { 10, 20, 9, -1, 20, 50, 19170 }, // ł
+    { 21, 26, 20, 0, 25, 137, 19220 }, // Ń
+    { 17, 21, 17, 0, 21, 90, 19357 }, // ń
+    { 21, 25, 20, 0, 18, 132, 19447 }, // Ņ
+    { 17, 21, 17, 0, 14, 90, 19579 }, // ņ
+    { 21, 26, 20, 0, 25, 137, 19669 }, // Ň
+    { 17, 21, 17, 0, 21, 90, 19806 }, // ň
+    { 23, 18, 23, 0, 18, 104, 19896 }, // ŉ
+    { 21, 23, 20, 0, 18, 121, 20000 }, // Ŋ
+    { 15, 20, 16, 0, 14, 75, 20121 }, // ŋ
+    { 18, 24, 20, 1, 23, 108, 20196 }, // Ō
+    { 15, 19, 15, 0, 18, 72, 20304 }, // ō
+    { 18, 25, 20, 1, 24, 113, 20480 }, // Ŏ
+    { 15, 21, 15, 0, 20, 79, 20593 }, // ŏ
+    { 18, 26, 20, 1, 25, 117, 20672 }, // Ő
+    { 15, 22, 15, 0, 21, 83, 20789 }, // ő
+    { 24, 19, 25, 1, 18, 114, 20872 }, // Œ
+    { 22, 15, 23, 0, 14, 83, 20986 }, // œ
+    { 19, 26, 18, 0, 25, 124, 21069 }, // Ŕ
+    { 12, 21, 12, 0, 21, 63, 21193 }, // ŕ
+    { 19, 25, 18, 0, 18, 119, 21256 }, // Ŗ
+    { 12, 21, 12, 0, 14, 63, 21375 }, // ŗ
+    { 19, 26, 18, 0, 25, 124, 21438 }, // Ř
+    { 12, 21, 12, 0, 21, 63, 21562 }, // ř
+    { 13, 26, 15, 1, 25, 85, 21625 }, // Ś
+    { 11, 22, 13, 1, 21, 61, 21710 }, // ś
+    { 13, 26, 15, 1, 25, 85, 21771 }, // Ŝ
+    { 11, 22, 13, 1, 21, 61, 21856 }, // ŝ
+    { 13, 25, 15, 1, 18, 82, 21917 }, // Ş
+    { 11, 21, 13, 1, 14, 58, 21999 }, // ş
+    { 13, 26, 15, 1, 25, 85, 22057 }, // Š
+    { 11, 22, 13, 1, 21, 61, 22142 }, // š
+    { 18, 25, 18, 0, 18, 113, 22203 }, // Ţ
+    { 12, 24, 11, -1, 17, 72, 22316 }, // ţ
+    { 18, 25, 18, 0, 25, 113, 22388 }, // Ť
+    { 12, 21, 11, -1, 20, 63, 22528 }, // ť
+    { 18, 18, 18, 0, 18, 81, 22591 }, // Ŧ
+    { 12, 18, 11, -1, 17, 54, 22672 }, // ŧ
+    { 20, 25, 20, 0, 24, 125, 22726 }, // Ũ
+    { 17, 21, 16, 0, 20, 90, 22851 }, // ũ
+    { 20, 24, 20, 0, 23, 120, 22941 }, // Ū
+    { 17, 19, 16, 0, 18, 81, 23061 }, // ū
+    { 20, 25, 20, 0, 24, 125, 23142 }, // Ŭ
+    { 17, 21, 16, 0, 20, 90, 23267 }, // ŭ
+    { 20, 26, 20, 0, 25, 130, 23357 }, // Ů
+    { 17, 22, 16, 0, 21, 94, 23487 }, // ů
+    { 20, 26, 20, 0, 25, 130, 23581 }, // Ű
+    { 17, 22, 16, 0, 21, 94, 23711 }, // ű
+    { 20, 24, 20, 0, 18, 120, 23805 }, // Ų
+    { 17, 20, 16, 0, 14, 85, 23925 }, // ų
+    { 28, 26, 28, 0, 25, 182, 24010 }, // Ŵ
+    { 23, 22, 23, 0, 21, 127, 24192 }, // ŵ
+    { 18, 25, 18, 0, 25, 113, 24319 }, // Ŷ
+    { 17, 27, 16, 0, 21, 115, 24432 }, // ŷ
+    { 18, 24, 18, 0, 24, 108, 24576 }, // Ÿ
+    { 15, 26, 15, 0, 25, 98, 24684 }, // Ź
+    { 13, 22, 13, 0, 21, 72, 24782 }, // ź
+    { 15, 25, 15, 0, 24, 94, 24854 }, // Ż
+    { 13, 21, 13, 0, 20, 69, 24948 }, // ż
+    { 15, 26, 15, 0, 25, 98, 25017 }, // Ž
+    { 13, 22, 13, 0, 21, 72, 25115 }, // ž
+    { 13, 20, 10, 0, 20, 65, 25187 }, // ſ
+    { 6, 6, 0, -4, 21, 9, 25252 }, // ̀
+    { 5, 6, 0, -2, 21, 8, 25261 }, // ́
+    { 10, 7, 0, -5, 21, 18, 25269 }, // ̂
+    { 10, 5, 0, -5, 20, 13, 25287 }, // ̃
+    { 10, 3, 0, -5, 18, 8, 25300 }, // ̄
+    { 10, 5, 0, -5, 20, 13, 25308 }, // ̆
+    { 6, 5, 0, -3, 20, 8, 25321 }, // ̇
+    { 10, 5, 0, -5, 20, 13, 25329 }, // ̈
+    { 8, 7, 0, -4, 22, 14, 25342 }, // ̉
+    { 8, 7, 0, -4, 21, 14, 25356 }, // ̊
+    { 10, 7, 0, -4, 21, 18, 25370 }, // ̋
+    { 10, 6, 0, -5, 21, 15, 25388 }, // ̌
+    { 10, 7, 0, -6, 21, 18, 25403 }, // ̏
+    { 10, 5, 0, -5, 20, 13, 25421 }, // ̑
+    { 5, 8, 0, -3, 22, 10, 25434 }, // ̒
+    { 5, 7, 0, -2, 22, 9, 25444 }, // ̓
+    { 5, 7, 0, -3, 22, 9, 25453 }, // ̔
+    { 4, 7, 0, -2, 22, 7, 25462 }, // ̕
+    { 5, 6, 0, -3, 16, 8, 25469 }, // ̛
+    { 6, 5, 0, -3, -1, 8, 25477 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 25485 }, // ̤
+    { 6, 6, 0, -3, -1, 9, 25495 }, // ̥
+    { 5, 6, 0, -3, -1, 8, 25504 }, // ̦
+    { 6, 6, 0, -3, -1, 9, 25512 }, // ̧
+    { 6, 7, 0, -3, 1, 11, 25521 }, // ̨
+    { 3, 7, 7, 2, -1, 6, 25532 }, // ̩
+    { 10, 6, 0, -5, -1, 15, 25538 }, // ̭
+    { 10, 6, 0, -5, -1, 15, 25553 }, // ̮
+    { 10, 5, 0, -5, -2, 13, 25568 }, // ̰
+    { 10, 3, 0, -5, -2, 8, 25581 }, // ̱
+    { 10, 5, 0, -5, 20, 13, 25589 }, // ͂
+    { 10, 11, 0, -5, 26, 28, 25602 }, // ̈́
+    { 5, 6, 0, -2, -1, 8, 25630 }, // ͅ
+    { 16, 25, 16, 0, 25, 100, 25638 }, // Ѐ
+    { 16, 24, 16, 0, 24, 96, 25738 }, // Ё
+    { 21, 24, 22, 0, 18, 126, 25834 }, // Ђ
+    { 15, 25, 16, 0, 25, 94, 25960 }, // Ѓ
+    { 16, 19, 17, 1, 18, 76, 26054 }, // Є
+    { 13, 19, 15, 1, 18, 62, 26130 }, // Ѕ
+    { 10, 18, 10, 0, 18, 45, 26192 }, // І
+    { 10, 24, 10, 0, 24, 60, 26237 }, // Ї
+    { 12, 24, 10, -2, 18, 72, 26297 }, // Ј
+    { 24, 19, 25, 0, 18, 114, 26369 }, // Љ
+    { 26, 19, 27, 0, 18, 124, 26483 }, // Њ
+    { 23, 18, 23, 0, 18, 104, 26624 }, // Ћ
+    { 19, 26, 19, 0, 25, 124, 26728 }, // Ќ
+    { 21, 25, 21, 0, 25, 132, 26852 }, // Ѝ
+    { 18, 25, 18, 0, 24, 113, 26984 }, // Ў
+    { 20, 24, 21, 0, 18, 120, 27097 }, // Џ
+    { 20, 18, 19, 0, 18, 90, 27217 }, // А
+    { 16, 19, 16, 0, 18, 76, 27307 }, // Б
+    { 16, 19, 16, 0, 18, 76, 27383 }, // В
+    { 15, 18, 16, 0, 18, 68, 27459 }, // Г
+    { 20, 24, 20, 0, 18, 120, 27527 }, // Д
+    { 16, 18, 16, 0, 18, 72, 27647 }, // Е
+    { 28, 19, 28, 0, 18, 133, 27719 }, // Ж
+    { 15, 19, 16, 0, 18, 72, 27852 }, // З
+    { 21, 18, 21, 0, 18, 95, 27924 }, // И
+    { 21, 24, 21, 0, 24, 126, 28019 }, // Й
+    { 19, 19, 19, 0, 18, 91, 28145 }, // К
+    { 19, 19, 19, 0, 18, 91, 28236 }, // Л
+    { 24, 18, 24, 0, 18, 108, 28327 }, // М
+    { 21, 18, 22, 0, 18, 95, 28435 }, // Н
+    { 18, 19, 20, 1, 18, 86, 28530 }, // О
+    { 21, 18, 21, 0, 18, 95, 28672 }, // П
+    { 16, 18, 16, 0, 18, 72, 28767 }, // Р
+    { 15, 19, 16, 1, 18, 72, 28839 }, // С
+    { 18, 18, 18, 0, 18, 81, 28911 }, // Т
+    { 18, 19, 18, 0, 18, 86, 28992 }, // У
+    { 20, 19, 20, 0, 18, 95, 29078 }, // Ф
+    { 19, 18, 19, 0, 18, 86, 29173 }, // Х
+    { 21, 24, 21, 0, 18, 126, 29259 }, // Ц
+    { 19, 18, 19, 0, 18, 86, 29385 }, // Ч
+    { 27, 18, 28, 0, 18, 122, 29471 }, // Ш
+    { 28, 24, 28, 0, 18, 168, 29593 }, // Щ
+    { 19, 19, 20, 0, 18, 91, 29761 }, // Ъ
+    { 25, 19, 26, 0, 18, 119, 29852 }, // Ы
+    { 16, 19, 16, 0, 18, 76, 29971 }, // Ь
+    { 17, 19, 17, 0, 18, 81, 30047 }, // Э
+    { 27, 19, 28, 0, 18, 129, 30128 }, // Ю
+    { 18, 19, 18, 0, 18, 86, 30257 }, // Я
+    { 14, 15, 14, 1, 14, 53, 30343 }, // а
+    { 14, 21, 15, 0, 20, 74, 30396 }, // б
+    { 14, 15, 15, 0, 14, 53, 30470 }, // в
+    { 13, 13, 13, 0, 13, 43, 30523 }, // г
+    { 17, 18, 17, 0, 13, 77, 30566 }, // д
+    { 13, 15, 14, 0, 14, 49, 30643 }, // е
+    { 23, 15, 22, 0, 14, 87, 30720 }, // ж
+    { 13, 15, 13, 0, 14, 49, 30807 }, // з
+    { 17, 13, 17, 0, 13, 56, 30856 }, // и
+    { 17, 20, 17, 0, 20, 85, 30912 }, // й
+    { 16, 15, 16, 0, 14, 60, 30997 }, // к
+    { 16, 14, 16, 0, 13, 56, 31057 }, // л
+    { 19, 13, 20, 0, 13, 62, 31113 }, // м
+    { 17, 13, 18, 0, 13, 56, 31175 }, // н
+    { 15, 15, 15, 0, 14, 57, 31231 }, // о
+    { 17, 13, 17, 0, 13, 56, 31288 }, // п
+    { 15, 20, 16, 0, 14, 75, 31344 }, // р
+    { 13, 15, 13, 0, 14, 49, 31419 }, // с
+    { 15, 13, 15, 0, 13, 49, 31468 }, // т
+    { 17, 19, 16, 0, 13, 81, 31517 }, // у
+    { 19, 26, 20, 0, 20, 124, 31598 }, // ф
+    { 16, 13, 16, 0, 13, 52, 31722 }, // х
+    { 18, 18, 18, 0, 13, 81, 31774 }, // ц
+    { 16, 13, 16, 0, 13, 52, 31855 }, // ч
+    { 23, 13, 23, 0, 13, 75, 31907 }, // ш
+    { 23, 18, 23, 0, 13, 104, 31982 }, // щ
+    { 16, 14, 17, 0, 13, 56, 32086 }, // ъ
+    { 22, 14, 22, 0, 13, 77, 32142 }, // ы
+    { 14, 14, 14, 0, 13, 49, 32219 }, // ь
+    { 13, 15, 14, 0, 14, 49, 32268 }, // э
+    { 22, 15, 22, 0, 14, 83, 32317 }, // ю
+    { 15, 14, 15, 0, 13, 53, 32400 }, // я
+    { 13, 22, 14, 0, 21, 72, 32453 }, // ѐ
+    { 13, 21, 14, 0, 20, 69, 32525 }, // ё
+    { 15, 26, 16, 0, 20, 98, 32594 }, // ђ
+    { 13, 21, 13, 0, 21, 69, 32692 }, // ѓ
+    { 13, 15, 13, 0, 14, 49, 32768 }, // є
+    { 11, 15, 13, 1, 14, 42, 32817 }, // ѕ
+    { 9, 20, 9, 0, 20, 45, 32859 }, // і
+    { 10, 20, 9, 0, 20, 50, 32904 }, // ї
+    { 9, 26, 8, -2, 20, 59, 32954 }, // ј
+    { 20, 14, 20, 0, 13, 70, 33013 }, // љ
+    { 22, 14, 22, 0, 13, 77, 33083 }, // њ
+    { 17, 20, 17, 0, 20, 85, 33160 }, // ћ
+    { 16, 22, 16, 0, 21, 88, 33245 }, // ќ
+    { 17, 21, 17, 0, 21, 90, 33333 }, // ѝ
+    { 17, 26, 16, 0, 20, 111, 33423 }, // ў
+    { 17, 18, 17, 0, 13, 77, 33534 }, // џ
+    { 19, 21, 19, 0, 20, 100, 33611 }, // Ѣ
+    { 16, 19, 16, 0, 18, 76, 33711 }, // ѣ
+    { 18, 19, 20, 1, 18, 86, 33787 }, // Ѳ
+    { 15, 15, 15, 0, 14, 57, 33873 }, // ѳ
+    { 20, 19, 20, 0, 18, 95, 33930 }, // Ѵ
+    { 17, 15, 17, 0, 14, 64, 34025 }, // ѵ
+    { 21, 30, 21, 0, 24, 158, 34089 }, // Ҋ
+    { 17, 25, 17, 0, 20, 107, 34247 }, // ҋ
+    { 16, 19, 16, 0, 18, 76, 34354 }, // Ҍ
+    { 13, 19, 14, 0, 18, 62, 34430 }, // ҍ
+    { 16, 18, 16, 0, 18, 72, 34492 }, // Ҏ
+    { 15, 20, 16, 0, 14, 75, 34564 }, // ҏ
+    { 14, 21, 14, 0, 21, 74, 34639 }, // Ґ
+    { 12, 17, 13, 0, 17, 51, 34713 }, // ґ
+    { 15, 18, 15, 0, 18, 68, 34816 }, // Ғ
+    { 13, 13, 13, 0, 13, 43, 34884 }, // ғ
+    { 17, 24, 18, 0, 18, 102, 34927 }, // Ҕ
+    { 15, 19, 15, 0, 13, 72, 35029 }, // ҕ
+    { 28, 24, 28, 0, 18, 168, 35101 }, // Җ
+    { 23, 19, 22, 0, 14, 110, 35269 }, // җ
+    { 15, 24, 16, 0, 18, 90, 35379 }, // Ҙ
+    { 13, 19, 13, 0, 14, 62, 35469 }, // ҙ
+    { 19, 24, 19, 0, 18, 114, 35531 }, // Қ
+    { 16, 19, 16, 0, 14, 76, 35645 }, // қ
+    { 20, 19, 20, 0, 18, 95, 35721 }, // Ҝ
+    { 17, 15, 17, 0, 14, 64, 35816 }, // ҝ
+    { 19, 19, 19, 0, 18, 91, 35880 }, // Ҟ
+    { 16, 19, 16, 0, 18, 76, 35971 }, // ҟ
+    { 22, 19, 22, 0, 18, 105, 36047 }, // Ҡ
+    { 19, 15, 19, 0, 14, 72, 36152 }, // ҡ
+    { 22, 24, 22, 0, 18, 132, 36224 }, // Ң
+    { 18, 18, 18, 0, 13, 81, 36356 }, // ң
+    { 25, 18, 25, 0, 18, 113, 36437 }, // Ҥ
+    { 20, 13, 21, 0, 13, 65, 36550 }, // ҥ
+    { 27, 24, 28, 0, 18, 162, 36615 }, // Ҧ
+    { 23, 19, 24, 0, 13, 110, 36864 }, // ҧ
+    { 20, 19, 21, 1, 18, 95, 36974 }, // Ҩ
+    { 17, 15, 17, 0, 14, 64, 37069 }, // ҩ
+    { 15, 24, 16, 1, 18, 90, 37133 }, // Ҫ
+    { 13, 19, 13, 0, 14, 62, 37223 }, // ҫ
+    { 18, 24, 18, 0, 18, 108, 37285 }, // Ҭ
+    { 15, 18, 15, 0, 13, 68, 37393 }, // ҭ
+    { 18, 18, 18, 0, 18, 81, 37461 }, // Ү
+    { 17, 19, 16, 0, 13, 81, 37542 }, // ү
+    { 18, 18, 18, 0, 18, 81, 37623 }, // Ұ
+    { 17, 19, 16, 0, 13, 81, 37704 }, // ұ
+    { 20, 24, 20, 0, 18, 120, 37785 }, // Ҳ
+    { 16, 18, 16, 0, 13, 72, 37905 }, // ҳ
+    { 23, 24, 23, 0, 18, 138, 37977 }, // Ҵ
+    { 20, 18, 20, 0, 13, 90, 38115 }, // ҵ
+    { 20, 24, 20, 0, 18, 120, 38205 }, // Ҷ
+    { 16, 18, 16, 0, 13, 72, 38325 }, // ҷ
+    { 19, 18, 19, 0, 18, 86, 38397 }, // Ҹ
+    { 16, 13, 16, 0, 13, 52, 38483 }, // ҹ
+    { 20, 18, 19, 0, 18, 90, 38535 }, // Һ
+    { 17, 20, 17, 0, 20, 85, 38625 }, // һ
+    { 21, 19, 21, 0, 18, 100, 38710 }, // Ҽ
+    { 16, 15, 17, 0, 14, 60, 38810 }, // ҽ
+    { 21, 24, 21, 0, 18, 126, 38912 }, // Ҿ
+    { 16, 19, 17, 0, 14, 76, 39038 }, // ҿ
+    { 10, 18, 10, 0, 18, 45, 39114 }, // Ӏ
+    { 28, 25, 28, 0, 24, 175, 39159 }, // Ӂ
+    { 23, 21, 22, 0, 20, 121, 39334 }, // ӂ
+    { 18, 24, 19, 0, 18, 108, 39455 }, // Ӄ
+    { 15, 20, 16, 0, 14, 75, 39563 }, // ӄ
+    { 19, 24, 19, 0, 18, 114, 39638 }, // Ӆ
+    { 16, 18, 16, 0, 13, 72, 39752 }, // ӆ
+    { 21, 24, 21, 0, 18, 126, 39824 }, // Ӈ
+    { 17, 19, 17, 0, 13, 81, 39950 }, // ӈ
+    { 21, 24, 21, 0, 18, 126, 40031 }, // Ӊ
+    { 18, 18, 18, 0, 13, 81, 40157 }, // ӊ
+    { 19, 24, 19, 0, 18, 114, 40238 }, // Ӌ
+    { 16, 18, 16, 0, 13, 72, 40352 }, // ӌ
+    { 24, 24, 24, 0, 18, 144, 40424 }, // Ӎ
+    { 20, 18, 20, 0, 13, 90, 40568 }, // ӎ
+    { 9, 20, 10, 1, 20, 45, 40658 }, // ӏ
+    { 20, 24, 19, 0, 24, 120, 40703 }, // Ӑ
+    { 14, 21, 14, 1, 20, 74, 40823 }, // ӑ
+    { 20, 24, 19, 0, 24, 120, 40960 }, // Ӓ
+    { 14, 21, 14, 1, 20, 74, 41080 }, // ӓ
+    { 25, 18, 25, -1, 18, 113, 41154 }, // Ӕ
+    { 19, 15, 21, 1, 14, 72, 41267 }, // ӕ
+    { 16, 24, 16, 0, 24, 96, 41339 }, // Ӗ
+    { 13, 21, 14, 0, 20, 69, 41435 }, // ӗ
+    { 16, 19, 17, 1, 18, 76, 41504 }, // Ә
+    { 13, 15, 14, 0, 14, 49, 41580 }, // ә
+    { 16, 25, 17, 1, 24, 100, 41629 }, // Ӛ
+    { 13, 21, 14, 0, 20, 69, 41729 }, // ӛ
+    { 28, 25, 28, 0, 24, 175, 41798 }, // Ӝ
+    { 23, 21, 22, 0, 20, 121, 41973 }, // ӝ
+    { 15, 25, 16, 0, 24, 94, 42094 }, // Ӟ
+    { 13, 21, 13, 0, 20, 69, 42188 }, // ӟ
+    { 14, 19, 15, 0, 18, 67, 42257 }, // Ӡ
+    { 13, 19, 14, 0, 13, 62, 42324 }, // ӡ
+    { 21, 23, 21, 0, 23, 121, 42386 }, // Ӣ
+    { 17, 18, 17, 0, 18, 77, 42507 }, // ӣ
+    { 21, 24, 21, 0, 24, 126, 42584 }, // Ӥ
+    { 17, 20, 17, 0, 20, 85, 42710 }, // ӥ
+    { 18, 25, 20, 1, 24, 113, 42795 }, // Ӧ
+    { 15, 21, 15, 0, 20, 79, 42908 }, // ӧ
+    { 18, 19, 20, 1, 18, 86, 43008 }, // Ө
+    { 15, 15, 15, 0, 14, 57, 43094 }, // ө
+    { 18, 25, 20, 1, 24, 113, 43151 }, // Ӫ
+    { 15, 21, 15, 0, 20, 79, 43264 }, // ӫ
+    { 17, 25, 17, 0, 24, 107, 43343 }, // Ӭ
+    { 13, 21, 14, 0, 20, 69, 43450 }, // ӭ
+    { 18, 24, 18, 0, 23, 108, 43519 }, // Ӯ
+    { 17, 24, 16, 0, 18, 102, 43627 }, // ӯ
+    { 18, 25, 18, 0, 24, 113, 43729 }, // Ӱ
+    { 17, 26, 16, 0, 20, 111, 43842 }, // ӱ
+    { 18, 26, 18, 0, 25, 117, 43953 }, // Ӳ
+    { 17, 27, 16, 0, 21, 115, 44070 }, // ӳ
+    { 19, 24, 19, 0, 24, 114, 44185 }, // Ӵ
+    { 16, 20, 16, 0, 20, 80, 44299 }, // ӵ
+    { 15, 24, 16, 0, 18, 90, 44379 }, // Ӷ
+    { 13, 18, 13, 0, 13, 59, 44469 }, // ӷ
+    { 25, 25, 26, 0, 24, 157, 44528 }, // Ӹ
+    { 22, 21, 22, 0, 20, 116, 44685 }, // ӹ
+    { 15, 24, 15, 0, 18, 90, 44801 }, // Ӻ
+    { 13, 18, 13, 0, 13, 59, 44891 }, // ӻ
+    { 19, 24, 19, 0, 18, 114, 45056 }, // Ӽ
+    { 15, 19, 15, 0, 13, 72, 45170 }, // ӽ
+    { 19, 18, 19, 0, 18, 86, 45242 }, // Ӿ
+    { 16, 13, 16, 0, 13, 52, 45328 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 45380 }, //  
+    { 0, 0, 25, 0, 0, 0, 45380 }, //  
+    { 0, 0, 13, 0, 0, 0, 45380 }, //  
+    { 0, 0, 25, 0, 0, 0, 45380 }, //  
+    { 0, 0, 8, 0, 0, 0, 45380 }, //  
+    { 0, 0, 6, 0, 0, 0, 45380 }, //  
+    { 0, 0, 4, 0, 0, 0, 45380 }, //  
+    { 0, 0, 16, 0, 0, 0, 45380 }, //  
+    { 0, 0, 7, 0, 0, 0, 45380 }, //  
+    { 0, 0, 5, 0, 0, 0, 45380 }, //  
+    { 0, 0, 1, 0, 0, 0, 45380 }, //  
+    { 0, 0, 0, 0, 0, 0, 45380 }, // ​
+    { 2, 21, 0, -1, 15, 11, 45380 }, // ‌
+    { 6, 23, 0, -3, 17, 35, 45391 }, // ‍
+    { 8, 24, 0, -4, 18, 48, 45426 }, // ‎
+    { 8, 24, 0, -4, 18, 48, 45474 }, // ‏
+    { 9, 3, 10, 0, 8, 7, 45522 }, // ‐
+    { 9, 3, 10, 0, 8, 7, 45529 }, // ‑
+    { 13, 3, 16, 1, 10, 10, 45536 }, // ‒
+    { 13, 3, 13, 0, 8, 10, 45546 }, // –
+    { 25, 3, 25, 0, 8, 19, 45556 }, // —
+    { 25, 3, 25, 0, 8, 19, 45575 }, // ―
+    { 9, 26, 13, 2, 20, 59, 45594 }, // ‖
+    { 13, 7, 13, 0, -1, 23, 45653 }, // ‗
+    { 6, 9, 6, 0, 19, 14, 45676 }, // ‘
+    { 6, 9, 6, 0, 19, 14, 45690 }, // ’
+    { 6, 9, 6, 0, 4, 14, 45704 }, // ‚
+    { 6, 9, 6, 0, 19, 14, 45718 }, // ‛
+    { 11, 9, 11, 0, 19, 25, 45732 }, // “
+    { 11, 9, 11, 0, 19, 25, 45757 }, // ”
+    { 11, 9, 11, 0, 4, 25, 45782 }, // „
+    { 11, 9, 11, 0, 19, 25, 45807 }, // ‟
+    { 12, 17, 12, 0, 18, 51, 45832 }, // †
+    { 12, 20, 12, 0, 18, 60, 45883 }, // ‡
+    { 6, 7, 8, 1, 10, 11, 45943 }, // •
+    { 9, 9, 16, 3, 13, 21, 45954 }, // ‣
+    { 5, 5, 7, 1, 4, 7, 45975 }, // ․
+    { 12, 5, 13, 0, 4, 15, 45982 }, // ‥
+    { 23, 5, 25, 1, 4, 29, 45997 }, // …
+    { 5, 5, 7, 1, 9, 7, 46026 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 46033 }, //  
+    { 0, 0, 0, 0, 0, 0, 46033 }, //  
+    { 8, 24, 0, -4, 18, 48, 46033 }, // ‪
+    { 8, 24, 0, -4, 18, 48, 46081 }, // ‫
+    { 8, 24, 0, -4, 18, 48, 46129 }, // ‬
+    { 11, 24, 0, -5, 18, 66, 46177 }, // ‭
+    { 11, 24, 0, -5, 18, 66, 46243 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 46309 }, //  
+    { 33, 21, 35, 1, 19, 174, 46309 }, // ‰
+    { 7, 9, 7, 0, 18, 16, 46483 }, // ′
+    { 12, 9, 12, 0, 18, 27, 46499 }, // ″
+    { 18, 9, 18, 0, 18, 41, 46526 }, // ‴
+    { 7, 9, 7, 0, 18, 16, 46567 }, // ‵
+    { 12, 9, 13, 0, 18, 27, 46583 }, // ‶
+    { 18, 9, 18, 0, 18, 41, 46610 }, // ‷
+    { 11, 6, 12, 1, 0, 17, 46651 }, // ‸
+    { 8, 11, 8, 0, 12, 22, 46668 }, // ‹
+    { 7, 11, 8, 1, 12, 20, 46690 }, // ›
+    { 16, 18, 16, 0, 17, 72, 46710 }, // ※
+    { 13, 20, 15, 1, 19, 65, 46782 }, // ‼
+    { 13, 3, 13, 0, 21, 10, 46847 }, // ‾
+    { 7, 3, 8, 0, 8, 6, 46857 }, // ⁃
+    { 14, 21, 5, -5, 19, 74, 46863 }, // ⁄
+    { 22, 20, 23, 1, 19, 110, 46937 }, // ⁇
+    { 18, 20, 19, 1, 19, 90, 47104 }, // ⁈
+    { 18, 20, 19, 1, 19, 90, 47194 }, // ⁉
+    { 15, 6, 25, 5, 10, 23, 47284 }, // ⁓
+    { 23, 9, 23, 0, 18, 52, 47307 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 47359 }, //  
+    { 0, 0, 0, 0, 0, 0, 47359 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 47359 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 47359 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 47359 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 47359 }, // ⁤
+    { 11, 13, 11, 0, 21, 36, 47359 }, // ⁰
+    { 11, 13, 11, 0, 21, 36, 47395 }, // ⁴
+    { 9, 13, 11, 1, 21, 30, 47431 }, // ⁵
+    { 10, 13, 11, 1, 21, 33, 47461 }, // ⁶
+    { 10, 13, 11, 1, 21, 33, 47494 }, // ⁷
+    { 9, 13, 11, 1, 21, 30, 47527 }, // ⁸
+    { 10, 13, 11, 1, 21, 33, 47557 }, // ⁹
+    { 12, 9, 14, 1, 18, 27, 47590 }, // ⁿ
+    { 11, 12, 11, 0, 8, 33, 47617 }, // ₀
+    { 9, 13, 11, 1, 9, 30, 47650 }, // ₁
+    { 10, 12, 11, 1, 8, 30, 47680 }, // ₂
+    { 9, 12, 11, 1, 8, 27, 47710 }, // ₃
+    { 11, 12, 11, 0, 8, 33, 47737 }, // ₄
+    { 9, 12, 11, 1, 8, 27, 47770 }, // ₅
+    { 10, 12, 11, 1, 8, 30, 47797 }, // ₆
+    { 10, 12, 11, 1, 8, 30, 47827 }, // ₇
+    { 9, 12, 11, 1, 8, 27, 47857 }, // ₈
+    { 10, 12, 11, 1, 8, 30, 47884 }, // ₉
+    { 14, 18, 16, 1, 18, 63, 47914 }, // ₣
+    { 15, 19, 16, 0, 18, 72, 47977 }, // ₤
+    { 34, 19, 34, 0, 18, 162, 48049 }, // ₧
+    { 16, 19, 16, 0, 18, 76, 48211 }, // €
+    { 17, 12, 25, 4, 15, 51, 48287 }, // ←
+    { 13, 17, 25, 6, 17, 56, 48338 }, // ↑
+    { 17, 12, 25, 4, 15, 51, 48394 }, // →
+    { 13, 17, 25, 6, 17, 56, 48445 }, // ↓
+    { 17, 11, 25, 4, 14, 47, 48501 }, // ↔
+    { 11, 17, 25, 7, 17, 47, 48548 }, // ↕
+    { 13, 18, 25, 6, 18, 59, 48595 }, // ↨
+    { 11, 18, 25, 7, 18, 50, 48654 }, // ↲
+    { 11, 18, 25, 7, 18, 50, 48704 }, // ↳
+    { 15, 14, 25, 5, 16, 53, 48754 }, // ↵
+    { 17, 15, 25, 4, 16, 64, 48807 }, // ⇐
+    { 15, 17, 25, 5, 17, 64, 48871 }, // ⇑
+    { 17, 15, 25, 4, 16, 64, 48935 }, // ⇒
+    { 15, 17, 25, 5, 17, 64, 48999 }, // ⇓
+    { 17, 13, 25, 4, 15, 56, 49063 }, // ⇔
+    { 18, 19, 25, 3, 18, 86, 49152 }, // ∀
+    { 13, 21, 16, 1, 20, 69, 49238 }, // ∂
+    { 13, 18, 25, 6, 18, 59, 49307 }, // ∃
+    { 19, 21, 25, 3, 19, 100, 49366 }, // ∅
+    { 17, 18, 17, 0, 18, 77, 49466 }, // ∆
+    { 17, 19, 25, 4, 18, 81, 49543 }, // ∇
+    { 17, 18, 25, 4, 18, 77, 49624 }, // ∈
+    { 17, 23, 25, 4, 20, 98, 49701 }, // ∉
+    { 17, 15, 25, 4, 16, 64, 49799 }, // ∊
+    { 17, 18, 25, 4, 18, 77, 49863 }, // ∋
+    { 17, 23, 25, 4, 20, 98, 49940 }, // ∌
+    { 17, 15, 25, 4, 16, 64, 50038 }, // ∍
+    { 21, 22, 21, 0, 18, 116, 50102 }, // ∏
+    { 16, 23, 17, 0, 18, 92, 50218 }, // ∑
+    { 12, 3, 16, 2, 10, 9, 50310 }, // −
+    { 13, 20, 13, 0, 18, 65, 50319 }, // ∕
+    { 13, 20, 13, 0, 18, 65, 50384 }, // ∖
+    { 12, 13, 16, 2, 15, 39, 50449 }, // ∗
+    { 10, 10, 16, 3, 13, 25, 50488 }, // ∘
+    { 6, 5, 16, 5, 9, 8, 50513 }, // ∙
+    { 17, 24, 16, -1, 21, 102, 50521 }, // √
+    { 13, 10, 16, 1, 13, 33, 50623 }, // ∝
+    { 16, 10, 16, 0, 13, 40, 50656 }, // ∞
+    { 17, 18, 25, 4, 18, 77, 50696 }, // ∟
+    { 19, 18, 25, 3, 18, 86, 50773 }, // ∠
+    { 4, 26, 13, 4, 20, 26, 50859 }, // ∣
+    { 9, 26, 13, 2, 20, 59, 50885 }, // ∥
+    { 18, 18, 25, 4, 18, 81, 50944 }, // ∧
+    { 18, 18, 25, 4, 18, 81, 51025 }, // ∨
+    { 15, 18, 25, 5, 18, 68, 51106 }, // ∩
+    { 15, 19, 25, 5, 18, 72, 51200 }, // ∪
+    { 15, 26, 16, 0, 20, 98, 51272 }, // ∫
+    { 17, 15, 25, 4, 14, 64, 51370 }, // ∴
+    { 17, 15, 25, 4, 14, 64, 51434 }, // ∵
+    { 6, 15, 8, 1, 16, 23, 51498 }, // ∶
+    { 17, 15, 25, 4, 14, 64, 51521 }, // ∷
+    { 15, 6, 25, 5, 10, 23, 51585 }, // ∼
+    { 15, 15, 25, 5, 16, 57, 51608 }, // ≅
+    { 13, 11, 16, 1, 14, 36, 51665 }, // ≈
+    { 15, 10, 25, 5, 12, 38, 51701 }, // ≍
+    { 12, 13, 16, 2, 15, 39, 51739 }, // ≠
+    { 15, 13, 25, 5, 14, 49, 51778 }, // ≡
+    { 12, 15, 16, 2, 15, 45, 51827 }, // ≤
+    { 12, 16, 16, 2, 16, 48, 51872 }, // ≥
+    { 21, 13, 25, 2, 15, 69, 51920 }, // ≪
+    { 21, 13, 25, 2, 15, 69, 51989 }, // ≫
+    { 17, 15, 25, 4, 16, 64, 52058 }, // ⊃
+    { 17, 23, 25, 4, 20, 98, 52122 }, // ⊄
+    { 17, 23, 25, 4, 20, 98, 52220 }, // ⊅
+    { 17, 18, 25, 4, 18, 77, 52318 }, // ⊆
+    { 17, 18, 25, 4, 18, 77, 52395 }, // ⊇
+    { 19, 19, 25, 3, 18, 91, 52472 }, // ⊕
+    { 19, 19, 25, 3, 18, 91, 52563 }, // ⊖
+    { 19, 19, 25, 3, 18, 91, 52654 }, // ⊗
+    { 19, 19, 25, 3, 18, 91, 52745 }, // ⊘
+    { 15, 18, 25, 5, 18, 68, 52836 }, // ⊥
+    { 6, 5, 16, 5, 9, 8, 52904 }, // ⋅
+    { 23, 5, 25, 1, 9, 29, 52912 }, // ⋯
+    { 25, 24, 25, 0, 21, 150, 52941 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_boldIntervals[] = {
@@ -4083,4 +2737,9 @@ static const EpdFontData bookerly_12_bold = {
     27,
     -7,
     true,
+    bookerly_12_boldBlockOffsets,
+    bookerly_12_boldDirectGlyphs,
+    bookerly_12_boldGlyphPages,
+    256,
+    bookerly_12_boldPageGlyphs,
 };
@@ -2,3341 +2,2065 @@
  * generated by fontconvert.py
  * name: bookerly_12_bolditalic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_12_bolditalic 12 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_12_bolditalic 12 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_bolditalicBitmaps[53236] = {
-    0x00, 0x68, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x07, 0xF0, 0x0B, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x40, 0x1F, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x7F, 0x00, 0xBF, 0x00, 0xBD, 0x00, 0x10, 0x00, 0x0B, 0x87, 0xC2, 0xF4, 0xFC, 0x3F, 0x2F, 0x83,
-    0xF2, 0xF4, 0x7E, 0x3F, 0x07, 0xD3, 0xF0, 0x7C, 0x3E, 0x0B, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x3E, 0x0B, 0xC0, 0x05,
-    0xBE, 0x5F, 0xD4, 0x1F, 0xFF, 0xFF, 0xFD, 0x1A, 0xFE, 0xBF, 0xE8, 0x00, 0xF8, 0x2F, 0x00, 0x01,
-    0xF4, 0x3F, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xE0, 0xFC, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x74, 0x00, 0x00, 0x6F,
-    0x80, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xEF, 0xFC, 0x03, 0xE1, 0xDB, 0xD0, 0x7D, 0x2C, 0x3C, 0x07,
-    0xF3, 0xC3, 0x40, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x01, 0xFF, 0xE0, 0x7C, 0x2C, 0xBF, 0x0F, 0xC3, 0xC3, 0xF0, 0xFD, 0x38, 0x7E, 0x0B, 0xFB,
-    0x5F, 0xC0, 0x3F, 0xFF, 0xF4, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x02, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xFB, 0xF4, 0x00,
-    0xFC, 0x00, 0x2F, 0x47, 0xE0, 0x0B, 0xC0, 0x00, 0xFC, 0x0F, 0x80, 0x7D, 0x00, 0x07, 0xD0, 0x3E,
-    0x03, 0xE0, 0x00, 0x2F, 0x41, 0xF4, 0x3F, 0x00, 0x00, 0xBC, 0x0F, 0xC1, 0xF0, 0x00, 0x02, 0xF4,
-    0x7E, 0x0F, 0x42, 0xFE, 0x07, 0xFB, 0xF0, 0xF8, 0x3F, 0xFE, 0x07, 0xFE, 0x0B, 0xC3, 0xF0, 0xFC,
-    0x00, 0x00, 0x7C, 0x1F, 0x42, 0xF4, 0x00, 0x03, 0xD0, 0xFC, 0x0B, 0xC0, 0x00, 0x3F, 0x03, 0xF0,
-    0x3F, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0xF8, 0x00, 0x1F, 0x40, 0x3F, 0x0B, 0xD0, 0x00, 0xFC, 0x00,
-    0xFE, 0xBE, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x2D, 0x00, 0x00, 0x64, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0xF8, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x60, 0x01, 0xFB, 0xF4, 0x01, 0xBC, 0x00, 0x7F,
-    0xE0, 0x2F, 0xFE, 0x00, 0xBF, 0xC0, 0xBF, 0xF9, 0x00, 0xFF, 0xF4, 0x3F, 0xF4, 0x00, 0xFD, 0x3F,
-    0x04, 0x7C, 0x00, 0x7F, 0x0F, 0xE0, 0x3F, 0x00, 0x2F, 0x81, 0xFD, 0x1F, 0x40, 0x0B, 0xE0, 0x2F,
-    0xDF, 0xC0, 0x02, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0x90, 0xBF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x90, 0x00, 0x7F, 0xFE, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x8B, 0xD3, 0xF0, 0xFC, 0x7E, 0x1F, 0x47, 0xC2, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00,
-    0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x18, 0x00, 0x00, 0x20, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x2F,
-    0x40, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x47, 0xC0, 0x3C, 0xBC, 0x07, 0xFF, 0x04, 0x0B, 0xFF, 0xC1, 0xBF, 0xFC, 0x7F, 0xB0,
-    0x43, 0xCB, 0x80, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x6A, 0xFE, 0xA8, 0xBF, 0xFF, 0xFD, 0xAA, 0xFE, 0xA8, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x2F, 0xC0,
-    0x7F, 0x40, 0xFC, 0x07, 0xE0, 0x3F, 0x07, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0xFF, 0xFE,
-    0xFF, 0xFD, 0x05, 0x0F, 0xCB, 0xF2, 0xF8, 0x14, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0xFF, 0x9F, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xF0, 0x02, 0xFC, 0x0F, 0xD0, 0x02, 0xFC,
-    0x2F, 0xC0, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x7F, 0x00, 0x03, 0xF8,
-    0xBF, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x0F, 0xE0, 0xBF, 0x40, 0x2F, 0xC0, 0x7F, 0x80, 0x7F, 0x40,
-    0x3F, 0xFB, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x06, 0xFC, 0x01, 0xBF, 0xFC, 0x02, 0xFF, 0xF8, 0x00, 0x5B, 0xF4, 0x00,
-    0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x40,
-    0x1F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0xFF, 0x97, 0xFC, 0x07, 0xF0, 0x07, 0xF4, 0x0F, 0x40, 0x1F, 0xD0, 0x04, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7F,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0xBF, 0x97, 0xFC, 0x03, 0xF0, 0x0B, 0xF0, 0x07, 0x00, 0x2F,
-    0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x1B, 0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x0B, 0xAF, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x1F, 0xF0, 0x05, 0x6B, 0xFF, 0x40, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x1F, 0x8B, 0xD0,
-    0x01, 0xF8, 0x3F, 0x40, 0x1F, 0xC0, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0x3F, 0xAA, 0xA0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x16, 0xBF, 0xF8, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0xFE,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFD, 0x01, 0xFE, 0xAF, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0x80, 0x1F, 0xD0, 0xFE,
-    0x00, 0x7F, 0x03, 0xF8, 0x02, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xF5, 0xFF, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0x00, 0x3F, 0x80, 0xF8, 0x03, 0xFC,
-    0x01, 0x80, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xD0,
-    0xFE, 0x01, 0xFC, 0x02, 0xF8, 0x0B, 0xE0, 0x0F, 0xD0, 0x2F, 0xC0, 0xBF, 0x00, 0x3F, 0xEF, 0xF0,
-    0x00, 0x7F, 0xFE, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0xEF, 0xF4, 0x03, 0xF8, 0x0F, 0xF0, 0x2F,
-    0x80, 0x1F, 0xD0, 0xFD, 0x00, 0x3F, 0x43, 0xF8, 0x02, 0xFC, 0x0F, 0xF9, 0x6F, 0xD0, 0x1F, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0x97, 0xFC, 0x00, 0xFE, 0x01, 0xFD, 0x01, 0xFC,
-    0x00, 0xFE, 0x02, 0xFC, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0xFD, 0x01, 0xFE, 0x01, 0xFD, 0x00, 0xFF,
-    0xEB, 0xFC, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0xD0, 0x7F, 0x40, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0xF0, 0x2F, 0xC0, 0xBE, 0x00, 0x50, 0x00, 0x00,
-    0x1F, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x07,
-    0xFC, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xF4, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x6A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0xBF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x2F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFC, 0x00,
-    0xBF, 0xD0, 0x1F, 0xFD, 0x00, 0x7F, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x7F, 0xFC, 0xBF, 0xFE, 0x74, 0x3F, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0xFC, 0x03, 0xF0,
-    0x1F, 0xC0, 0x3E, 0x00, 0xBC, 0x00, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x7E, 0x00,
-    0xFE, 0x00, 0xFD, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFE, 0x40, 0x1B, 0xF8, 0x00, 0x7F, 0x80,
-    0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x7E, 0x2C, 0x0F, 0xC2, 0xF4,
-    0x0F, 0xFF, 0xF0, 0x3F, 0x0F, 0x80, 0xBD, 0x2F, 0x80, 0xFC, 0xBC, 0x07, 0xE0, 0x3D, 0x03, 0xF3,
-    0xF0, 0x3F, 0x01, 0xF0, 0x0F, 0x8F, 0x80, 0xF8, 0x0F, 0x80, 0x7D, 0x7D, 0x07, 0xE0, 0x7D, 0x03,
-    0xF1, 0xF4, 0x1F, 0x83, 0xF4, 0x2F, 0x47, 0xD0, 0x7F, 0xBF, 0xD2, 0xF8, 0x1F, 0x80, 0xFF, 0xCB,
-    0xFF, 0x80, 0x7F, 0x02, 0xFC, 0x1F, 0xE4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xA0, 0x00, 0x07, 0xFF, 0xAA, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x6F, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01,
-    0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0,
-    0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F,
-    0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD,
-    0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x1A, 0xBA, 0x40, 0x02, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xEF,
-    0xFC, 0x01, 0x2F, 0xC1, 0xFD, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x7F, 0x40,
-    0xFC, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xFD, 0x1B,
-    0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x01, 0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xF8, 0x03,
-    0xFC, 0x07, 0xF8, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6B, 0xA0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFE,
-    0x00, 0xFC, 0x03, 0xFD, 0x00, 0x3E, 0x02, 0xFD, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0D, 0x02, 0xFF, 0x80, 0x1F,
-    0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xBA, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x4B, 0xF0, 0x2F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x07,
-    0xF4, 0x00, 0xBF, 0x40, 0x2F, 0xC0, 0x01, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xF4, 0x03, 0xFC, 0x00,
-    0x2F, 0xD0, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x1F, 0xD0,
-    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x01, 0xFF, 0x6B, 0xFF, 0x40, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x7C, 0x00, 0x3F,
-    0xC0, 0x1F, 0x00, 0x0F, 0xE0, 0x07, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xE5, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x2D, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x1F, 0xE5, 0x5F,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x55, 0x55, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xC0, 0x3E, 0x00, 0x3F, 0xC0, 0x3D, 0x00, 0x3F,
-    0x80, 0x3C, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x5A, 0x80, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x6B, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xF8, 0x00, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0x40, 0xBF, 0x40, 0x00, 0xF0, 0x0F, 0xF0, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x55, 0x54, 0x3F,
-    0xC0, 0x0F, 0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFE, 0x00, 0x0F,
-    0xE0, 0x2F, 0xF4, 0x00, 0xFD, 0x00, 0xFF, 0xF9, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x50, 0x1F, 0xFF,
-    0xD0, 0xFF, 0xFE, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F,
-    0xC0, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x0B,
-    0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0xFE, 0x55, 0x5F, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00,
-    0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00,
-    0x7F, 0xFF, 0x43, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x7F, 0xFF, 0x40, 0x00, 0x55, 0x55, 0x01, 0xFF,
-    0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80,
-    0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02,
-    0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF,
-    0x40, 0x00, 0x00, 0x55, 0x55, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2C, 0x2F, 0xC0,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x54,
-    0x05, 0x55, 0x01, 0xFF, 0xFD, 0x3F, 0xFE, 0x00, 0xBF, 0xF4, 0x1F, 0xF8, 0x00, 0x2F, 0xC0, 0x2F,
-    0xC0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x00, 0x7F, 0x4F, 0xE0, 0x00,
-    0x00, 0xBF, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x40, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
-    0x1F, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF8, 0x00, 0x07, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0x01,
-    0xFF, 0xD0, 0xBF, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x34, 0x0F, 0xF0, 0x03,
-    0xE0, 0x3F, 0xC0, 0x1F, 0x41, 0xFE, 0x55, 0xFC, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x05, 0x55, 0x00, 0x05, 0x55, 0x00, 0x0B, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xF0,
-    0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xF0, 0x00,
-    0x03, 0xEF, 0xD0, 0x7E, 0xFC, 0x00, 0x00, 0xF7, 0xF4, 0x3E, 0x7F, 0x00, 0x00, 0xBC, 0xBE, 0x1F,
-    0x2F, 0x80, 0x00, 0x3F, 0x2F, 0x8F, 0x8B, 0xE0, 0x00, 0x0F, 0x87, 0xF7, 0xC2, 0xF8, 0x00, 0x07,
-    0xC0, 0xFF, 0xD0, 0xFE, 0x00, 0x03, 0xF0, 0x3F, 0xF0, 0x3F, 0x80, 0x00, 0xF8, 0x0F, 0xF4, 0x0F,
-    0xD0, 0x00, 0x7D, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0xFD, 0x00, 0x0F, 0xC0,
-    0x1E, 0x00, 0x7F, 0x40, 0x2F, 0xFD, 0x00, 0x01, 0xFF, 0xFC, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x55, 0x40, 0x01, 0x55, 0x40, 0x1F, 0xFE, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xF0, 0x06,
-    0xFF, 0x40, 0x02, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xD0,
-    0x1F, 0x80, 0x00, 0x7F, 0xFE, 0x01, 0xF4, 0x00, 0x07, 0xDF, 0xF0, 0x2F, 0x00, 0x00, 0xBC, 0x7F,
-    0x83, 0xF0, 0x00, 0x0F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0xE7, 0xE0, 0x00, 0x1F, 0x80,
-    0xFF, 0xBD, 0x00, 0x02, 0xF4, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xF0,
-    0x02, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0xFF, 0x40, 0x0B, 0xFF,
-    0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F,
-    0xD0, 0xFF, 0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0,
-    0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC,
-    0x3F, 0xC0, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xBA, 0x40, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x04, 0xBF, 0x0B,
-    0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x02, 0xFC,
-    0x03, 0xF8, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x3F, 0xEF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x07,
-    0xFE, 0x90, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x90, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF4,
-    0x1F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x1F, 0xF0,
-    0x00, 0x2F, 0xE0, 0x02, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x03, 0xFC,
-    0x00, 0x02, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0x00,
-    0xFF, 0xE6, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAA,
-    0x80, 0x00, 0x01, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x16, 0xBA, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xEB, 0xFD, 0x00, 0x12,
-    0xFC, 0x1F, 0xF0, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFF,
-    0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0xBF, 0x1B, 0xF8, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xDB, 0xF0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0xC2, 0xFD, 0x00,
-    0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xBF, 0xD0, 0x7F, 0xFF, 0x02, 0xFF, 0x8B, 0xFF, 0xF0,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBA, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0x40, 0x7F, 0x40, 0xBC, 0x02, 0xFC, 0x02, 0xF0, 0x0F, 0xF0, 0x0B, 0x40, 0x2F, 0xF0,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x2F, 0xF0, 0x0F, 0x00, 0x3F, 0xC0, 0xBC, 0x00, 0xBF, 0x03, 0xF4, 0x03, 0xFC, 0x0F,
-    0xF9, 0x7F, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xF8, 0x1F, 0xD0, 0xBC,
-    0x7D, 0x0B, 0xF0, 0x2F, 0x0F, 0x03, 0xFC, 0x0F, 0x41, 0x40, 0xFE, 0x01, 0x40, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55,
-    0x52, 0xFF, 0xFC, 0x0F, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xF9, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x0F,
-    0xE0, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00,
-    0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x3F, 0x40,
-    0x2F, 0xC0, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF8,
-    0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x55, 0x54, 0xFF, 0xFE, 0x07, 0xFF,
-    0xE2, 0xFF, 0xD0, 0x0B, 0xFE, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x07, 0xF4, 0x00, 0x7F, 0x00, 0x0F,
-    0xD0, 0x03, 0xF4, 0x00, 0x3F, 0x80, 0x2F, 0x80, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x0B,
-    0xE0, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0xC2, 0xF4, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0x00, 0xFD, 0xBC, 0x00, 0x00, 0x02, 0xFB, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x01, 0x55, 0x43, 0xFF, 0xF8, 0x0F, 0x80, 0xBF, 0xFC, 0x2F,
-    0xFE, 0x01, 0xF8, 0x02, 0xFF, 0x40, 0xBF, 0x40, 0x3F, 0xC0, 0x0F, 0xC0, 0x07, 0xF4, 0x03, 0xFC,
-    0x02, 0xF8, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x3F, 0x00, 0x03, 0xF4, 0x0F, 0xFC, 0x0B, 0xE0, 0x00,
-    0x3F, 0x42, 0xFF, 0xC0, 0xFC, 0x00, 0x03, 0xF4, 0x3D, 0xFC, 0x2F, 0x40, 0x00, 0x3F, 0x8B, 0xCF,
-    0xC3, 0xF0, 0x00, 0x03, 0xF8, 0xF4, 0xFC, 0xBD, 0x00, 0x00, 0x2F, 0xAF, 0x0B, 0xCF, 0xC0, 0x00,
-    0x02, 0xFB, 0xE0, 0xBE, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x54, 0x05, 0x55, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xC0, 0x0B, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0x7F,
-    0x40, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x3F,
-    0xEF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x4F,
-    0xE0, 0x00, 0x00, 0x2F, 0x82, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x0B,
-    0xF4, 0x00, 0x7F, 0xFD, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x4B, 0xFF, 0xF0, 0x00, 0x15, 0x55, 0x01,
-    0x55, 0x47, 0xFF, 0xF0, 0xFF, 0xFC, 0x3F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x40, 0x0B,
-    0xF0, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x00, 0x1F, 0xCB, 0xD0,
-    0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x0F, 0xF4, 0x03,
-    0xE0, 0x0F, 0xF8, 0x00, 0xB0, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x74, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x1F, 0x80, 0xFF, 0x95,
-    0x5F, 0xD0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xA9, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xE8, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x90,
-    0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x07,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xA9, 0x00, 0x0F, 0xFD, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x05, 0xF8, 0x00,
-    0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xFC, 0x00,
-    0x03, 0xEF, 0x80, 0x01, 0xF3, 0xF0, 0x00, 0xFC, 0x7D, 0x00, 0x3E, 0x0F, 0xC0, 0x2F, 0x02, 0xF0,
-    0x0F, 0xC0, 0x7E, 0x07, 0xD0, 0x0F, 0xC3, 0xF0, 0x02, 0xF4, 0xA4, 0x00, 0x29, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x24, 0x07, 0xC0, 0xBE, 0x03, 0xF4, 0x0F, 0xC0, 0x2C,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F, 0xFF, 0xFD, 0x00, 0xFE, 0x1F,
-    0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x2F, 0xC0,
-    0x3F, 0x40, 0xFF, 0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2, 0x0F, 0xFB, 0xDF, 0xFD, 0x3F,
-    0xFC, 0x3F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x02, 0xF8, 0x04, 0x00, 0x3F, 0x0F, 0xF4, 0x03, 0xF3, 0xFF, 0xC0, 0x3E, 0xFB, 0xFC, 0x07, 0xFD,
-    0x1F, 0xC0, 0xBF, 0x81, 0xFC, 0x0F, 0xF0, 0x1F, 0xC0, 0xFD, 0x02, 0xFC, 0x1F, 0xC0, 0x3F, 0x82,
-    0xFC, 0x07, 0xF0, 0x3F, 0x80, 0xFE, 0x03, 0xFD, 0x7F, 0xC0, 0x7F, 0xFF, 0xF0, 0x0B, 0xEF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF9,
-    0xBC, 0x0F, 0xE0, 0x10, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00,
-    0x7F, 0x40, 0x00, 0x3F, 0x80, 0xB0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x10, 0xBE, 0x00, 0x0F, 0xFB, 0xF4,
-    0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F,
-    0xC0, 0x3F, 0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xE0, 0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B,
-    0xBE, 0x20, 0xFF, 0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC,
-    0x1F, 0x81, 0xF8, 0x2F, 0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F,
-    0x00, 0xB4, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x16, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x02, 0xF8,
-    0x3C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x16, 0xFD, 0x50, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0x81, 0xFC, 0x00, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFE, 0xFF, 0xF4, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0xFD, 0x03, 0xF0, 0x00,
-    0x3F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x02, 0xF9, 0xFF, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x03, 0xF4, 0x07, 0xFD, 0x02, 0xF8, 0x00, 0x3F, 0x80, 0xBE, 0x00,
-    0x0F, 0xD0, 0x1F, 0xF5, 0x6F, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x40, 0x00, 0xFD, 0x2F, 0xE0, 0x03, 0xF3, 0xFF,
-    0xC0, 0x1F, 0xEE, 0xBF, 0x00, 0x7F, 0xE1, 0xFC, 0x02, 0xFE, 0x0B, 0xF0, 0x0F, 0xF0, 0x3F, 0x80,
-    0x3F, 0x80, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x80, 0xFD, 0x20, 0xFD,
-    0x03, 0xFF, 0xC7, 0xF0, 0x0F, 0xFE, 0x2F, 0xC0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xE0,
-    0x3F, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00,
-    0x7F, 0x00, 0x2F, 0x88, 0x0F, 0xFF, 0x43, 0xFF, 0xC0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x74, 0x3F, 0x40, 0x0F, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x80, 0x01,
-    0xFF, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x40,
-    0x0F, 0xC2, 0xFC, 0x03, 0xF7, 0xFF, 0x80, 0xFB, 0xC7, 0xE0, 0x7F, 0x80, 0xF8, 0x2F, 0xC0, 0xBC,
-    0x0F, 0xD0, 0xBD, 0x03, 0xFB, 0xFC, 0x01, 0xFF, 0xF0, 0x00, 0xBE, 0xBD, 0x00, 0x3F, 0x4F, 0xC0,
-    0x0F, 0xC2, 0xFE, 0x47, 0xF0, 0x3F, 0xFA, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x0B, 0xFE, 0x1F, 0xFE, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x02, 0xF8, 0x03, 0xF8, 0x03, 0xF4,
-    0x07, 0xF0, 0x0B, 0xF0, 0x0F, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F, 0xC0, 0x2F, 0x80, 0x3F, 0x48,
-    0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0xFF, 0x47,
-    0xF8, 0x1F, 0xE0, 0x3F, 0xF5, 0xFF, 0xCB, 0xFF, 0x00, 0x3F, 0xBE, 0xFE, 0xFB, 0xF0, 0x03, 0xFF,
-    0x0F, 0xF8, 0x7F, 0x00, 0x3F, 0xC1, 0xFF, 0x0B, 0xE0, 0x07, 0xF8, 0x2F, 0xD0, 0xFD, 0x00, 0xBF,
-    0x03, 0xFC, 0x0F, 0xC0, 0x0F, 0xE0, 0x3F, 0x41, 0xFC, 0x00, 0xFD, 0x07, 0xF0, 0x2F, 0x80, 0x1F,
-    0xC0, 0xBF, 0x03, 0xF4, 0x81, 0xFC, 0x0F, 0xE0, 0x3F, 0xFC, 0x2F, 0x80, 0xFD, 0x03, 0xFF, 0x83,
-    0xF4, 0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x7F,
-    0xD0, 0xFF, 0x03, 0xFF, 0x9F, 0xFE, 0x00, 0xFE, 0xFB, 0xF8, 0x03, 0xFF, 0x0B, 0xE0, 0x0F, 0xF4,
-    0x3F, 0x40, 0x7F, 0x80, 0xFC, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD,
-    0x01, 0xFC, 0x07, 0xF1, 0x47, 0xF0, 0x1F, 0xFE, 0x2F, 0xC0, 0xBF, 0xF4, 0xFD, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x1F, 0xE1,
-    0xFE, 0x0F, 0xE0, 0x3F, 0xC7, 0xF0, 0x0B, 0xF3, 0xF8, 0x02, 0xFC, 0xFD, 0x00, 0xFE, 0x3F, 0x40,
-    0x3F, 0x5F, 0xD0, 0x1F, 0xC3, 0xF4, 0x0F, 0xD0, 0xFF, 0x5F, 0xF0, 0x1F, 0xFF, 0xE0, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x02, 0xFF, 0x0B, 0xF8, 0x07, 0xFF, 0x6F,
-    0xFC, 0x00, 0x3F, 0xBE, 0xFD, 0x00, 0x3F, 0xE0, 0xFE, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x7F, 0x40,
-    0xFD, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0xFC, 0x03, 0xF4, 0x01, 0xFC, 0x0B,
-    0xF0, 0x02, 0xFE, 0x6F, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFB, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x6A, 0xAA, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xFE, 0x7E, 0x01, 0xFF, 0xFF, 0xD0,
-    0x3F, 0x87, 0xFC, 0x0B, 0xF0, 0x2F, 0x81, 0xFC, 0x03, 0xF4, 0x2F, 0xC0, 0x3F, 0x03, 0xF4, 0x0B,
-    0xF0, 0x3F, 0x40, 0xFE, 0x03, 0xF0, 0x2F, 0xE0, 0x7F, 0x4B, 0xFD, 0x03, 0xFE, 0xFB, 0xC0, 0x3F,
-    0xFC, 0xFC, 0x01, 0xFE, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0xAA, 0x90, 0x00, 0x10, 0x04, 0x07, 0xFD,
-    0x1F, 0xC3, 0xFF, 0x9F, 0xF0, 0x0B, 0xDF, 0xFC, 0x02, 0xFB, 0x95, 0x00, 0xFF, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xFC, 0x00,
-    0xFF, 0xFD, 0x03, 0xF4, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF,
-    0xE0, 0x00, 0x1F, 0xF4, 0x08, 0x03, 0xF8, 0x2F, 0x02, 0xF8, 0x3F, 0xD7, 0xF0, 0x3F, 0xFF, 0xD0,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x00, 0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0xC1, 0x7F, 0x94, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x07, 0x81, 0xFF, 0xFE, 0x07,
-    0xFF, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7,
-    0xFF, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE,
-    0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00, 0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F,
-    0xF1, 0x8F, 0xFB, 0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x0B, 0xF4, 0x1F, 0xDB, 0xFF, 0x03, 0xF8, 0x6F, 0xC0, 0xFE, 0x03, 0xF4,
-    0x2F, 0x80, 0xFD, 0x0F, 0xC0, 0x2F, 0x83, 0xF0, 0x0B, 0xE1, 0xF4, 0x01, 0xF8, 0xF8, 0x00, 0x7E,
-    0xBC, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0xBF, 0x02, 0xF8, 0x1F, 0xCB, 0xFE, 0x07, 0xF0, 0x3F,
-    0x82, 0xFC, 0x0F, 0xD0, 0xBE, 0x03, 0xF0, 0x3F, 0x42, 0xF4, 0x0F, 0xD0, 0xFE, 0x0B, 0xC0, 0x2F,
-    0x87, 0xFC, 0x3E, 0x00, 0x7E, 0x2F, 0xF1, 0xF4, 0x00, 0xF8, 0xFF, 0xCF, 0xC0, 0x03, 0xEB, 0xAF,
-    0x7D, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0x3F, 0xD2, 0xFF, 0x00, 0x00, 0xFD, 0x0B, 0xF0, 0x00,
-    0x03, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0xFD,
-    0x02, 0xFC, 0x0B, 0xFF, 0x0B, 0xFD, 0x05, 0x7F, 0x5F, 0xAC, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0xF4, 0xFF, 0xA4, 0x3F, 0xE0, 0xBF, 0xF4, 0x3F, 0x80,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x0B,
-    0xFF, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0xD0,
-    0x00, 0x2F, 0x83, 0xF0, 0x00, 0x07, 0xE1, 0xF4, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0x3F, 0x3D,
-    0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x38, 0x1F, 0xC0, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2F,
-    0xF4, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0xBE, 0xFF, 0xF0, 0x0B, 0x80, 0xFD, 0x00, 0x70, 0x3F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x80, 0x0B, 0xE0,
-    0x1F, 0x02, 0xFF, 0xFB, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xF9, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0,
-    0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x01, 0xFD, 0x00, 0x0F, 0xD0,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E,
-    0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xFF, 0x80, 0x06,
-    0xBF, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0x80, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00,
-    0x07, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90,
-    0x01, 0x07, 0xFF, 0x42, 0xE3, 0xFF, 0xFE, 0xF8, 0xF4, 0x7F, 0xFC, 0x1C, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x01,
-    0xF0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x7F,
-    0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x2F, 0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x0B, 0xFB, 0xDB, 0x80, 0xFD, 0x3C, 0x00, 0x2F,
-    0x83, 0x80, 0x03, 0xF0, 0x74, 0x00, 0x7F, 0x0B, 0x00, 0x07, 0xF0, 0xF0, 0x00, 0x7F, 0x0E, 0x00,
-    0x03, 0xF5, 0xE0, 0xB0, 0x3F, 0xFE, 0xBF, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x90, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x07, 0xE0, 0xFD, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0x02, 0xF8, 0x07, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x6F, 0xD5, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x6F,
-    0xFA, 0xA4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xFA, 0xAB, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xE1, 0xBF, 0xFC,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x40, 0x38, 0x0F, 0xDF, 0xFE,
-    0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xF8, 0x1F, 0x80, 0x03, 0xE0, 0x0F, 0xC0, 0x03, 0xD0, 0x0F,
-    0x80, 0x07, 0xC0, 0x1F, 0x40, 0x03, 0xE0, 0x3F, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0xBE, 0xFF, 0xFF,
-    0xD0, 0x74, 0x15, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC7,
-    0xFF, 0xDF, 0xFF, 0xD1, 0xFF, 0xE0, 0x7F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x0F, 0xD0, 0x02, 0xFC,
-    0x0B, 0xD0, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0xFE, 0xFF, 0xC0, 0x0A,
-    0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8,
-    0x00, 0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x07, 0xFF, 0xF4, 0x07, 0xE0, 0xBD, 0x03, 0xF0, 0x0F, 0x02, 0xFE, 0x00, 0x00, 0xE7, 0xD0,
-    0x00, 0x38, 0xBE, 0x00, 0x0F, 0x0B, 0xF0, 0x03, 0xE0, 0x7F, 0x00, 0x7E, 0x07, 0xE0, 0x0B, 0xE0,
-    0x7C, 0x00, 0xBF, 0x0F, 0x00, 0x0B, 0xF3, 0xC0, 0x00, 0x7D, 0xF0, 0x24, 0x0B, 0xF8, 0x3E, 0x01,
-    0xFC, 0x0F, 0xD0, 0xBD, 0x03, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC2, 0xE7, 0xF2, 0xFD, 0xF8, 0xBD, 0x00, 0x04, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x0F, 0x00,
-    0xAA, 0x41, 0xD0, 0x74, 0x1F, 0xFF, 0x02, 0xC3, 0xC0, 0xF4, 0x3C, 0x07, 0x4E, 0x0B, 0xC0, 0x90,
-    0x0E, 0x34, 0x3E, 0x00, 0x00, 0x38, 0xD0, 0xF8, 0x00, 0x00, 0xF3, 0x43, 0xE0, 0x00, 0x03, 0x8E,
-    0x0B, 0xC0, 0x00, 0x0E, 0x2C, 0x1F, 0xEA, 0xC0, 0x74, 0x74, 0x1F, 0xFE, 0x03, 0xC0, 0xF0, 0x05,
-    0x40, 0x2D, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xF9, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0xA5, 0x90, 0x7F, 0xFC, 0x0F, 0x8B, 0xC2, 0xE0, 0xB4,
-    0x3C, 0x0F, 0x03, 0xC2, 0xF0, 0x7D, 0xBE, 0x63, 0xFE, 0xFE, 0x1F, 0x4F, 0x80, 0x00, 0x00, 0x2A,
-    0xAF, 0xCB, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xC0, 0x0F,
-    0xE0, 0xBF, 0x01, 0xFD, 0x0F, 0xE0, 0x1F, 0xD0, 0xFE, 0x00, 0xFE, 0x0B, 0xF0, 0x03, 0xFC, 0x2F,
-    0xC0, 0x03, 0xF4, 0x3F, 0x80, 0x07, 0xF0, 0x3F, 0x40, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0xA8, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x14, 0xBF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0x00, 0x05, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x07, 0x80, 0x1F, 0x00, 0xD5, 0x50, 0x38, 0x28, 0xBE, 0xD0, 0xC3, 0x43, 0x8F,
-    0x0E, 0x30, 0x39, 0xD0, 0xA3, 0x03, 0xF8, 0x0B, 0x30, 0x3A, 0xD0, 0xA3, 0x87, 0xDF, 0x4D, 0x1C,
-    0x54, 0x26, 0xC0, 0xB0, 0x00, 0x74, 0x02, 0xE5, 0xBD, 0x00, 0x01, 0xA9, 0x00, 0x3F, 0xFF, 0x5F,
-    0xFF, 0xD1, 0x55, 0x50, 0x00, 0x50, 0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xD0, 0xFC, 0xFC, 0x0B,
-    0xCF, 0x80, 0xBC, 0xBD, 0x0F, 0xC7, 0xFF, 0xF4, 0x1F, 0xFD, 0x00, 0x15, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x55, 0xBD, 0x54, 0xBF, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xFD, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x14,
-    0x00, 0x15, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x0B, 0xFF, 0x40, 0xBE, 0x7F, 0x03, 0xD0, 0xBC, 0x01, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xBE, 0x55, 0x03, 0xFF, 0xFD, 0x0A, 0xAA, 0x90, 0x00, 0x64,
-    0x01, 0xFF, 0xD0, 0xF9, 0xF8, 0x34, 0x2E, 0x00, 0x1F, 0x00, 0xBF, 0x40, 0xBF, 0xE0, 0x00, 0xBC,
-    0x00, 0x2F, 0x00, 0x2F, 0x8F, 0xFF, 0x82, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0F,
-    0xC2, 0xFC, 0x3F, 0x0B, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFE, 0x00,
-    0x1F, 0xC0, 0x3F, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0xFD, 0x02, 0xF8,
-    0x00, 0x3F, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x02, 0xFC, 0x0F,
-    0xF0, 0x00, 0xBF, 0x0B, 0xFC, 0x10, 0x3F, 0xFF, 0xEF, 0xBC, 0x0F, 0xFF, 0xD7, 0xFE, 0x07, 0xEF,
-    0xD0, 0xFE, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xEF, 0x90, 0x02, 0xFF, 0xF3, 0xC0, 0x00, 0xFF, 0xF8,
-    0xF0, 0x00, 0xBF, 0xFE, 0x78, 0x00, 0x3F, 0xFF, 0x6D, 0x00, 0x0F, 0xFF, 0xCB, 0x40, 0x03, 0xFF,
-    0xF3, 0xC0, 0x00, 0xFF, 0xF8, 0xF0, 0x00, 0x1F, 0xFD, 0x78, 0x00, 0x01, 0xEF, 0x2E, 0x00, 0x00,
-    0x03, 0xCB, 0x40, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x2D, 0x78, 0x00,
-    0x00, 0x0F, 0x2D, 0x00, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xD6, 0xFF, 0x40,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE3, 0xFC, 0xFE, 0x2E,
-    0x00, 0x0B, 0x81, 0xFD, 0x03, 0xC0, 0xB8, 0x7E, 0x06, 0x40, 0x00, 0x14, 0x06, 0xFD, 0x0F, 0xFC,
-    0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x3F, 0xFC,
-    0x6A, 0xA8, 0x00, 0x6A, 0x00, 0x2F, 0xFC, 0x0B, 0xC3, 0xD1, 0xF4, 0x3E, 0x2F, 0x03, 0xD2, 0xE0,
-    0x7C, 0x2E, 0x0F, 0x81, 0xFF, 0xF0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0xAF, 0x4B, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0xBF,
-    0x07, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x02, 0xFC, 0x1F, 0xC0, 0x1F, 0xD0, 0xFE, 0x01, 0xFD, 0x0F,
-    0xE0, 0x1F, 0xC0, 0xFD, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x05, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x3F, 0x00, 0x03, 0xE0, 0x03, 0xF8, 0x03, 0xE0,
-    0x00, 0xBC, 0x00, 0xFF, 0x42, 0xFF, 0xC0, 0x1F, 0x00, 0x3D, 0xF0, 0x7F, 0xFC, 0x03, 0xD0, 0x0F,
-    0x5F, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xD2, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x3E, 0x00, 0x00,
-    0x0B, 0xD0, 0x2F, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x05,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xF8,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7C, 0x07, 0xFE, 0x00, 0xFC,
-    0x00, 0x3D, 0x0B, 0xFF, 0xE0, 0x3E, 0x00, 0x3E, 0x03, 0xD0, 0xFC, 0xBF, 0xF0, 0x2F, 0x00, 0x90,
-    0x3E, 0x7F, 0xFC, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x0E, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x40,
-    0x00, 0x01, 0xBD, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x05, 0x2F,
-    0x00, 0x2F, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x03, 0xD0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0xF8, 0x00,
-    0xFF, 0x4A, 0xBF, 0xC0, 0x2E, 0x00, 0x3D, 0xF0, 0xFF, 0xE0, 0x0B, 0xC0, 0x0F, 0x5F, 0x00, 0x00,
-    0x01, 0xF4, 0x03, 0xD2, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x2F,
-    0xFF, 0xFC, 0x00, 0x02, 0xF4, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x0F, 0xFC, 0x01, 0x7F, 0x00, 0x1F, 0x40, 0x2F, 0x40, 0x2F, 0x40, 0x2F, 0x40,
-    0x1F, 0x40, 0x0B, 0xC0, 0x02, 0xF4, 0x24, 0xBF, 0xFE, 0x0F, 0xFF, 0x80, 0xFF, 0x80, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0,
-    0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00,
-    0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0,
-    0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00,
-    0x3F, 0x47, 0xD0, 0x00, 0x00, 0x78, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00,
-    0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00,
-    0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD,
-    0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00,
-    0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0x40, 0x40, 0x00, 0x00, 0x1F, 0xE2,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3C, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0,
-    0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x00,
-    0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00,
-    0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00,
-    0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD,
-    0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00,
-    0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x5F, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4,
-    0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F,
-    0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0,
-    0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F,
-    0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xBC, 0x00, 0x00,
-    0x01, 0xF7, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x60, 0x00, 0x00, 0x0F, 0xCB, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
-    0x1F, 0x82, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x95, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x03, 0xD0, 0x01,
-    0xFC, 0x00, 0xBE, 0x00, 0x7D, 0x00, 0x7F, 0x00, 0x0F, 0xE5, 0x5F, 0xC0, 0x2F, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6B, 0xA0, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x3E, 0x02, 0xFD,
-    0x00, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x0D, 0x02, 0xFF, 0x80, 0x1F, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFC, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x7C, 0x00, 0x3F, 0x80, 0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x40, 0x03, 0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00,
-    0x3D, 0x00, 0x7F, 0x95, 0x7F, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x54, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0xFF,
-    0x00, 0x7C, 0x00, 0x3F, 0x80, 0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x40, 0x03, 0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x95, 0x7F,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x02, 0xF8, 0x3E, 0x00,
-    0x00, 0xB4, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x7C, 0x00, 0x3F, 0x80,
-    0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x40, 0x03,
-    0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x95, 0x7F, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x2F,
-    0xCB, 0xF0, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0B, 0xF0, 0x07, 0xC0,
-    0x03, 0xFC, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0x74, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x55, 0x40, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x2F, 0xC0, 0x01, 0x00, 0x0F, 0xF0, 0x02, 0xD0, 0x03, 0xF8, 0x00, 0xF4, 0x01, 0xFE,
-    0x55, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE,
-    0x00, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00,
-    0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x07, 0xF0,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54,
-    0x01, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80,
-    0x01, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0xBE, 0xFC, 0x00, 0xBD, 0x0F, 0x40, 0x3D, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x54, 0x01, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x7F, 0x80, 0x01, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47,
-    0xD0, 0x0F, 0xE3, 0xF8, 0x03, 0xF0, 0xFC, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x50, 0x07, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE,
-    0x00, 0x07, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x1A, 0xBA, 0x90, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x4B, 0xF0, 0x2F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0,
-    0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0xBF, 0x40, 0x2F, 0xC0, 0x01, 0xFE, 0x1A, 0xFF,
-    0xA8, 0x07, 0xF4, 0xBF, 0xFF, 0xF0, 0x2F, 0xD0, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0x03,
-    0xFC, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x01,
-    0xFF, 0x6B, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x3C, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0x4B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x01, 0x55, 0x40, 0x1F, 0xFE, 0x00, 0xBF, 0xFD, 0x00,
-    0xBF, 0xF0, 0x06, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x00,
-    0x03, 0xFF, 0xD0, 0x1F, 0x80, 0x00, 0x7F, 0xFE, 0x01, 0xF4, 0x00, 0x07, 0xDF, 0xF0, 0x2F, 0x00,
-    0x00, 0xBC, 0x7F, 0x83, 0xF0, 0x00, 0x0F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0xE7, 0xE0,
-    0x00, 0x1F, 0x80, 0xFF, 0xBD, 0x00, 0x02, 0xF4, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xFC,
-    0x00, 0x03, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0xFF,
-    0x40, 0x0B, 0xFF, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x7F,
-    0xC0, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x2F, 0xE1, 0xFF, 0x00, 0x02, 0xFE, 0x2F, 0xD0, 0x00, 0x2F,
-    0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xD0,
-    0x0F, 0xFE, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x01,
-    0xFF, 0x41, 0xFF, 0xC0, 0x7F, 0xC0, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x2F, 0xE1, 0xFF, 0x00, 0x02,
-    0xFE, 0x2F, 0xD0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC,
-    0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x01, 0xFF,
-    0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x0F, 0xFE, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00, 0x3D,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x7F, 0xC0, 0x03, 0xFD, 0x0F, 0xF4, 0x00,
-    0x2F, 0xE1, 0xFF, 0x00, 0x02, 0xFE, 0x2F, 0xD0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F,
-    0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x0B,
-    0xF8, 0x3F, 0xD0, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x0F, 0xFE, 0xBF, 0xF4, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x04,
-    0x00, 0x00, 0x1F, 0xF2, 0xD0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3C, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40,
-    0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3,
-    0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF,
-    0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F,
-    0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0,
-    0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x10, 0xB8, 0x03, 0xD3, 0xF8, 0x3F, 0x83, 0xFB, 0xF8, 0x03, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F,
-    0xF8, 0x03, 0xFB, 0xF8, 0x3F, 0x83, 0xF8, 0xF8, 0x03, 0xD0, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x03, 0x80, 0x00, 0x3F, 0xFF, 0xF7, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xD0, 0x7F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFF, 0x80, 0x1F, 0xE0, 0x03, 0xEF, 0xE0, 0x0B, 0xF4, 0x03, 0xD7, 0xF8, 0x03, 0xFC, 0x07, 0xD1,
-    0xFE, 0x00, 0xFF, 0x07, 0xD0, 0x7F, 0x80, 0x3F, 0x87, 0xD0, 0x2F, 0xD0, 0x0F, 0xE7, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xF0, 0x07, 0xFD,
-    0x00, 0x0B, 0xFF, 0xAF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xC2, 0xFF, 0xF4, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0x03, 0xFF,
-    0xF5, 0xFF, 0xF4, 0x0B, 0xFE, 0x40, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x1F,
-    0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00,
-    0x7F, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x00,
-    0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0x03, 0xFF, 0xF5, 0xFF, 0xF4, 0x0B,
-    0xFE, 0x40, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFE, 0x00,
-    0xBF, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x80,
-    0x02, 0xF8, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC,
-    0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0xFC,
-    0x00, 0x00, 0x0B, 0xE0, 0xF4, 0x00, 0x00, 0x3D, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0x03, 0xFF, 0xF5, 0xFF, 0xF4, 0x0B, 0xFE, 0x40, 0xFF, 0x00,
-    0x07, 0xF0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x03, 0xF4,
-    0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x01, 0xFD,
-    0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x0F,
-    0xE0, 0x02, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x47, 0xD0, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x01, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x55, 0x2F, 0xFF, 0xC0, 0xFF, 0xFD,
-    0x7F, 0xFD, 0x02, 0xFF, 0x90, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4,
-    0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0x1F,
-    0xC0, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x80, 0x2F, 0xC0, 0x01, 0xFF, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x50, 0x15, 0x54, 0x7F, 0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF0,
-    0x03, 0xF4, 0x00, 0xBF, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0xC3, 0xF0, 0x00,
-    0x01, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0x47, 0xFC, 0x00, 0xBF,
-    0x01, 0xFE, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0xFE, 0x02, 0xFC, 0x01, 0xFD,
-    0x0B, 0xF4, 0x02, 0xFE, 0xBF, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0x90, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x0B, 0xC0, 0x00,
-    0x00, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x7F, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00,
-    0x0F, 0xD1, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x80, 0x00, 0x01, 0xFC, 0x0B, 0xF8, 0x00, 0x00,
-    0x7F, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0x80, 0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x03,
-    0xF0, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0xBE, 0x6F, 0x80, 0x00, 0xBE, 0x3F, 0xFF, 0x80, 0x00, 0x3F,
-    0x43, 0xFF, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0x42, 0xF8,
-    0x00, 0x00, 0x01, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x3F, 0xE7, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x3F, 0x87, 0xFC, 0x02, 0xFC, 0x0B, 0xE0,
-    0x0F, 0xC0, 0x3F, 0x40, 0xBF, 0x00, 0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x3F,
-    0x02, 0xFE, 0x00, 0xFD, 0x2E, 0xF8, 0x83, 0xFE, 0xF7, 0xFF, 0x4F, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F, 0xFF, 0xFD, 0x00,
-    0xFE, 0x1F, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0, 0x0F, 0xE0,
-    0x2F, 0xC0, 0x3F, 0x40, 0xFF, 0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2, 0x0F, 0xFB, 0xDF,
-    0xFD, 0x3F, 0xFC, 0x3F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xF7, 0xD0, 0x00, 0x2F, 0x0B, 0xC0,
-    0x00, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xE7, 0xE0, 0x07,
-    0xFF, 0xFF, 0x40, 0x3F, 0x87, 0xFC, 0x02, 0xFC, 0x0B, 0xE0, 0x0F, 0xC0, 0x3F, 0x40, 0xBF, 0x00,
-    0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x3F, 0x02, 0xFE, 0x00, 0xFD, 0x2E, 0xF8,
-    0x83, 0xFE, 0xF7, 0xFF, 0x4F, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x40, 0x00, 0x3F, 0xC7, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0x0F, 0xE0, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xF9, 0xF8, 0x01, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F,
-    0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xF0, 0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B, 0xBE, 0x20,
-    0xFF, 0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x04,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xF9, 0xF8, 0x01, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F, 0x00,
-    0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xF0, 0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B, 0xBE, 0x20, 0xFF,
-    0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xB0, 0xB4, 0x00, 0x03, 0xC1, 0xD0, 0x00, 0x0F, 0x5F,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xE7, 0xE0,
-    0x07, 0xFF, 0xFF, 0x40, 0x3F, 0x87, 0xFC, 0x02, 0xFC, 0x0B, 0xE0, 0x0F, 0xC0, 0x3F, 0x40, 0xBF,
-    0x00, 0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x3F, 0x02, 0xFE, 0x00, 0xFD, 0x2E,
-    0xF8, 0x83, 0xFE, 0xF7, 0xFF, 0x4F, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x2F, 0xF9, 0x3F, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xF8, 0x1F, 0xE0, 0xFC, 0x0B, 0xF0, 0x1F, 0xC0, 0xFC, 0x0F, 0xC0, 0x3F, 0x42, 0xF4, 0x2F,
-    0xC0, 0x3F, 0x0B, 0xE0, 0x3F, 0x80, 0xBF, 0xBF, 0x40, 0x3F, 0x40, 0xFF, 0xF8, 0x00, 0x3F, 0x03,
-    0xFF, 0x40, 0x10, 0x3F, 0x4B, 0xFF, 0x00, 0xF0, 0x3F, 0xEF, 0x7F, 0xAB, 0xF0, 0x3F, 0xFC, 0x3F,
-    0xFF, 0xC0, 0x0F, 0xE0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF9, 0xBC, 0x0F, 0xE0, 0x10, 0x1F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0xB0, 0x3F, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xB8, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x09, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F,
-    0x81, 0xF8, 0x2F, 0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F, 0x00,
-    0xB4, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFF,
-    0xC0, 0x0F, 0xC3, 0xF4, 0x0F, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x02, 0xF0, 0xBE, 0x00, 0xFE, 0xFE,
-    0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x04, 0x03, 0xF0, 0x0B, 0x40, 0xFF, 0xAF, 0xD0, 0x2F, 0xFF,
-    0xD0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xFC, 0x00, 0x2F, 0x7D, 0x00, 0xBC, 0x2F, 0x00, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F, 0x81, 0xF8, 0x2F,
-    0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F, 0x00, 0xB4, 0x3F, 0xEB,
-    0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x47,
-    0xC0, 0x0F, 0xE3, 0xF4, 0x03, 0xF0, 0xFC, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xFC, 0x3F, 0x40, 0xFC, 0x0F, 0xC0, 0x7E, 0x07,
-    0xE0, 0x2F, 0x0B, 0xE0, 0x0F, 0xEF, 0xE0, 0x03, 0xFF, 0x80, 0x01, 0xFD, 0x00, 0x40, 0x3F, 0x00,
-    0xB4, 0x0F, 0xFA, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x03, 0xD0, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0xBD, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x10, 0x1F,
-    0xF8, 0x3F, 0xF8, 0x03, 0xF4, 0x03, 0xF0, 0x07, 0xF0, 0x0B, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x2F, 0x88, 0x3F, 0xFD, 0x3F, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x80, 0x0F,
-    0xFF, 0x40, 0x3F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0xF4,
-    0x00, 0xFF, 0xC0, 0x2F, 0x7D, 0x0B, 0xC2, 0xE0, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1F,
-    0xF8, 0x03, 0xFF, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xD0,
-    0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x80, 0x3F, 0xFD, 0x03, 0xFF, 0xC0, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xC0, 0xFE, 0x3F, 0x43, 0xF0, 0xFC, 0x01, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00,
-    0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x88,
-    0x00, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x30, 0x00, 0x1F, 0xEF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x03,
-    0xFE, 0xBF, 0xC0, 0xFF, 0x02, 0xFC, 0x1F, 0xC0, 0x1F, 0xC3, 0xF8, 0x01, 0xFC, 0x3F, 0x40, 0x2F,
-    0x83, 0xF0, 0x03, 0xF4, 0x7F, 0x00, 0x7F, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0xEB, 0xF8, 0x01, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x40, 0x00, 0x7F, 0xCB,
-    0x40, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0x0F, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x10, 0x07, 0xFD, 0x0F, 0xF0, 0x3F, 0xF9, 0xFF, 0xE0, 0x0F, 0xEF, 0xBF, 0x80, 0x3F,
-    0xF0, 0xBE, 0x00, 0xFF, 0x43, 0xF4, 0x07, 0xF8, 0x0F, 0xC0, 0x2F, 0xC0, 0x7F, 0x00, 0xFE, 0x03,
-    0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x1F, 0xC0, 0x7F, 0x14, 0x7F, 0x01, 0xFF, 0xE2, 0xFC, 0x0B, 0xFF,
-    0x4F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0x87, 0xF8, 0x3F, 0x80, 0xFF, 0x1F,
-    0xC0, 0x2F, 0xCF, 0xE0, 0x0B, 0xF3, 0xF4, 0x03, 0xF8, 0xFD, 0x00, 0xFD, 0x7F, 0x40, 0x7F, 0x0F,
-    0xD0, 0x3F, 0x43, 0xFD, 0x7F, 0xC0, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F, 0xC1, 0xFC, 0x02,
-    0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4, 0x07, 0xF0, 0x3F,
-    0x40, 0xFD, 0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0x7D, 0x00, 0x1F,
-    0x07, 0xC0, 0x0F, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x7F,
-    0xFF, 0xC0, 0x7F, 0x87, 0xF8, 0x3F, 0x80, 0xFF, 0x1F, 0xC0, 0x2F, 0xCF, 0xE0, 0x0B, 0xF3, 0xF4,
-    0x03, 0xF8, 0xFD, 0x00, 0xFD, 0x7F, 0x40, 0x7F, 0x0F, 0xD0, 0x3F, 0x43, 0xFD, 0x7F, 0xC0, 0x7F,
-    0xFF, 0x80, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x40, 0x00, 0xFF, 0x1E,
-    0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xC3, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F, 0xC1,
-    0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4, 0x07,
-    0xF0, 0x3F, 0x40, 0xFD, 0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x7D, 0x00, 0x2F, 0x8F, 0xD0, 0x02, 0xF0,
-    0xFC, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F, 0xC1, 0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x2F,
-    0xC3, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4, 0x07, 0xF0, 0x3F, 0x40, 0xFD, 0x03, 0xFD,
-    0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x6A, 0xAA, 0xA8, 0xBF,
-    0xFF, 0xFD, 0x6A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0xBF, 0xF2, 0xD0, 0x01, 0xFF, 0xFF,
-    0xE0, 0x01, 0xFE, 0x1F, 0xE0, 0x00, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0x03, 0xFF, 0x00, 0x3F, 0x43,
-    0xEF, 0xC0, 0x0F, 0xC7, 0xCB, 0xE0, 0x03, 0xFB, 0xC3, 0xF4, 0x01, 0xFF, 0x81, 0xFC, 0x00, 0x3F,
-    0x80, 0xFD, 0x00, 0x0F, 0xF1, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0x1F, 0xFD, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x2F, 0xF4, 0x07, 0xF1, 0xFF, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x00, 0xFC, 0x03,
-    0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x2F, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0xC0,
-    0x1F, 0xC1, 0xFF, 0x00, 0xBE, 0x1F, 0xFC, 0x63, 0xFE, 0xF3, 0xFF, 0xCF, 0xFF, 0x0F, 0xFC, 0x1F,
-    0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE,
-    0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE, 0x03, 0xF8, 0x03,
-    0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00, 0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F, 0xF1, 0x8F, 0xFB,
-    0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x2F, 0x0B,
-    0x80, 0x01, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xF1,
-    0xFF, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x2F,
-    0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0xC0, 0x1F, 0xC1, 0xFF, 0x00, 0xBE, 0x1F,
-    0xFC, 0x63, 0xFE, 0xF3, 0xFF, 0xCF, 0xFF, 0x0F, 0xFC, 0x1F, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x0F, 0xC3, 0xE0,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC, 0x7F,
-    0xF8, 0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xE0,
-    0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xF0, 0x7F, 0xC0, 0x2F, 0x87, 0xFF,
-    0x18, 0xFF, 0xBC, 0xFF, 0xF3, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x0B, 0xFF, 0x03, 0xF8, 0x00,
-    0x2F, 0xC0, 0xFE, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x2F, 0x83, 0xF0,
-    0x00, 0x07, 0xE1, 0xF4, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xEF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x38, 0x1F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0x3F, 0x0F, 0xF4, 0x00, 0x0F, 0xCF, 0xFF, 0x00, 0x07, 0xEF,
-    0xBF, 0xC0, 0x02, 0xFF, 0x47, 0xF0, 0x00, 0xFF, 0x41, 0xFC, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x0F,
-    0xD0, 0x2F, 0x80, 0x07, 0xF0, 0x0F, 0xD0, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0xFD, 0x03, 0xF4, 0x00,
-    0x3F, 0xD7, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x0A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00,
-    0x1F, 0xCB, 0xE0, 0x00, 0x0B, 0xD2, 0xF0, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0xBF, 0x41, 0xFD, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x0F,
-    0xE0, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x7E,
-    0x1F, 0x40, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0x81, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F,
-    0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40,
-    0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD,
-    0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F,
-    0xFF, 0xFD, 0x00, 0xFE, 0x1F, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03,
-    0xF0, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0x40, 0xFF, 0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2,
-    0x0F, 0xFB, 0xDF, 0xFD, 0x3F, 0xFC, 0x3F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x2E, 0x01, 0xC0, 0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F,
-    0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40,
-    0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD,
-    0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00,
-    0x02, 0xF9, 0xBC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x0F, 0xF9, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02,
-    0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F, 0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xF0,
-    0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B, 0xBE, 0x20, 0xFF, 0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07,
-    0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00,
-    0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F, 0xFF, 0xFD, 0x00, 0xFE, 0x1F, 0xF0, 0x0B, 0xF0,
-    0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0x40, 0xFF,
-    0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2, 0x0F, 0xFB, 0xDF, 0xFD, 0x3F, 0xFC, 0x3F, 0xE0,
-    0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x01, 0xFA, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAE, 0x80, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x03, 0xF0, 0x0F, 0xF4, 0x00, 0xF8, 0x0B, 0xF4, 0x00,
-    0x3C, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x34, 0x0B, 0xFE, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xE6, 0xF0,
-    0x0F, 0xE0, 0x10, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x1F, 0xD0, 0x00, 0x03, 0xF8, 0x0B, 0x00, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x02, 0xF8, 0x3E, 0x00, 0x00, 0xF4, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAE, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xF8, 0x03, 0xF0, 0x0F, 0xF4, 0x00, 0xF8, 0x0B, 0xF4, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x34, 0x0B, 0xFE, 0x00,
-    0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0x7D, 0x00,
-    0xBC, 0x2F, 0x00, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF,
-    0xFC, 0x03, 0xF9, 0xBC, 0x0F, 0xE0, 0x10, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0xB0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xBA, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xE0, 0x0F, 0xC0,
-    0x3F, 0xD0, 0x03, 0xE0, 0x2F, 0xD0, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xD0, 0x2F, 0xF8, 0x01, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF9, 0xBC, 0x0F, 0xE0,
-    0x10, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00,
-    0x3F, 0x80, 0xB0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x07, 0xC0, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0x03, 0xFB, 0xD0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAE,
-    0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x03, 0xF0, 0x0F, 0xF4,
-    0x00, 0xF8, 0x0B, 0xF4, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x34, 0x0B, 0xFE, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x07, 0x40, 0x1F, 0x0B, 0xC0, 0x03, 0xD7, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x01,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x3F,
-    0x9B, 0xC0, 0x3F, 0x80, 0x40, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xE0, 0x2C, 0x03, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x40, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x2F, 0x00,
-    0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAE, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x12, 0xFC, 0x0B, 0xFD, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00,
-    0x3F, 0x80, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x0B, 0xF0, 0x00, 0x7F, 0x80, 0x2F, 0xC0,
-    0x01, 0xFD, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x00, 0xFF,
-    0x00, 0xBF, 0x00, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xFC, 0x00, 0x7F,
-    0xDA, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xD2, 0xE0, 0x00, 0x07, 0xFF, 0x4F,
-    0x80, 0x00, 0x00, 0xFD, 0x3C, 0x00, 0x00, 0x03, 0xF1, 0xE0, 0x00, 0x00, 0x1F, 0xCB, 0x00, 0x00,
-    0x10, 0xBE, 0x14, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE1, 0xFF,
-    0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x00,
-    0xFE, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0xBF, 0x80, 0x00, 0x3F, 0x4B,
-    0xBE, 0x20, 0x00, 0xFF, 0xBD, 0xFF, 0xD0, 0x03, 0xFF, 0xC3, 0xFE, 0x00, 0x07, 0xF8, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBA, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x4B, 0xF0, 0x2F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0xFE,
-    0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0xBF, 0x40, 0x2F, 0xC0, 0x01, 0xFE, 0x1A, 0xFF, 0xA8, 0x07,
-    0xF4, 0xBF, 0xFF, 0xF0, 0x2F, 0xD0, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x02,
-    0xFC, 0x00, 0x1F, 0xD0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x01, 0xFF, 0x6B,
-    0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xAB, 0xFA, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x7F, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xFF, 0x6F, 0xF0, 0x00, 0xBF, 0x02, 0xF8, 0x00,
-    0x3F, 0x40, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x03, 0xF4, 0x0F, 0xE0,
-    0x00, 0xFC, 0x0B, 0xF8, 0x00, 0x7F, 0x4B, 0xBE, 0x20, 0x0F, 0xFB, 0xDF, 0xFD, 0x03, 0xFF, 0xC3,
-    0xFE, 0x00, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xC0,
-    0x1F, 0x00, 0x0F, 0xF0, 0x07, 0xC0, 0x03, 0xF8, 0x01, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xF9, 0x55, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x04, 0x00, 0x3F, 0xC0, 0x0B, 0x40, 0x0F, 0xE0, 0x03, 0xD0,
-    0x07, 0xF9, 0x57, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x3F, 0xFF, 0xC0, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0B, 0xFE,
-    0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xC3, 0xF4, 0x0F, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x02, 0xF0, 0xBE,
-    0x00, 0xFE, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x04, 0x03, 0xF0, 0x0B, 0x40, 0xFF, 0xAF,
-    0xD0, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00,
-    0x00, 0x7C, 0x07, 0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x0B, 0xF0, 0x07, 0xC0, 0x03, 0xFC, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0x74, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0xFE, 0x55, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0x00, 0x0F, 0xF0, 0x02, 0xD0,
-    0x03, 0xF8, 0x00, 0xF4, 0x01, 0xFE, 0x55, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x00, 0xC0, 0x0B, 0xE6, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x0B,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xFC,
-    0x3F, 0x40, 0xFC, 0x0F, 0xC0, 0x7E, 0x07, 0xE0, 0x2F, 0x0B, 0xE0, 0x0F, 0xEF, 0xE0, 0x03, 0xFF,
-    0x80, 0x01, 0xFD, 0x00, 0x40, 0x3F, 0x00, 0xB4, 0x0F, 0xFA, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0B, 0xF0, 0x07,
-    0xC0, 0x03, 0xFC, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0x74, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x55, 0x40, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0x00, 0x0F, 0xF0, 0x02, 0xD0, 0x03, 0xF8, 0x00, 0xF4, 0x01,
-    0xFE, 0x55, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F, 0x81, 0xF8,
-    0x2F, 0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F, 0x00, 0xB4, 0x3F,
-    0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F,
-    0x00, 0x0F, 0xE0, 0x07, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xE5, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x10, 0x00, 0xFF, 0x00, 0x2D, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x1F, 0xE5, 0x5F, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0xE8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC,
-    0x1F, 0x81, 0xF8, 0x2F, 0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F,
-    0x00, 0xB4, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0xFA, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x07, 0xD0, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0x03, 0xFB, 0xD0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x54, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x7C,
-    0x00, 0x3F, 0x80, 0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x40, 0x03, 0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x95, 0x7F, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x24, 0x07, 0x40, 0x1F, 0x0B, 0xC0, 0x03,
-    0xD7, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0x0F, 0xD0, 0x3F, 0x03, 0xF0, 0x1F,
-    0x81, 0xF8, 0x0B, 0xC2, 0xF8, 0x03, 0xFB, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x10, 0x0F,
-    0xC0, 0x2D, 0x03, 0xFE, 0xBF, 0x40, 0xBF, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03,
-    0xFB, 0xD0, 0x00, 0x01, 0xFC, 0x2F, 0x00, 0x00, 0x2E, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xBA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80,
-    0x0F, 0x80, 0x3F, 0xD0, 0x00, 0xF4, 0x0B, 0xF4, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x05, 0x55, 0x43, 0xFC, 0x00, 0xFF,
-    0xFC, 0x3F, 0xC0, 0x0B, 0xFF, 0x43, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0xE0, 0x00, 0xFE, 0x02, 0xFF,
-    0x40, 0x0F, 0xD0, 0x0F, 0xFF, 0x9B, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFB, 0xFF, 0xD0,
-    0x07, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0x03, 0xF8,
-    0x00, 0x0B, 0xE7, 0xFC, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xFB, 0xFF, 0x80, 0x0F, 0xD0,
-    0x1F, 0xF4, 0x0B, 0xE0, 0x00, 0xFE, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x7F, 0xD5, 0xBF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x0F, 0x40,
-    0xB0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xF8, 0x00, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0x40, 0xBF, 0x40, 0x00, 0xF0, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x55, 0x54,
-    0x3F, 0xC0, 0x0F, 0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFE, 0x00,
-    0x0F, 0xE0, 0x2F, 0xF4, 0x00, 0xFD, 0x00, 0xFF, 0xF9, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C,
-    0x02, 0x80, 0x00, 0x0F, 0xD7, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xEF, 0xFF, 0x40,
-    0x1F, 0xC0, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0xFC, 0x0F, 0xE0,
-    0x00, 0x2F, 0x9F, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xFE, 0x00, 0x3F, 0x40,
-    0x7F, 0xD0, 0x2F, 0x80, 0x03, 0xF8, 0x0B, 0xE0, 0x00, 0xFD, 0x01, 0xFF, 0x56, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xF8, 0x00, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0x40, 0xBF, 0x40, 0x00, 0xF0, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x55, 0x54,
-    0x3F, 0xC0, 0x0F, 0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFE, 0x00,
-    0x0F, 0xE0, 0x2F, 0xF4, 0x00, 0xFD, 0x00, 0xFF, 0xF9, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xEF, 0xFF, 0x40,
-    0x1F, 0xC0, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0xFC, 0x0F, 0xE0,
-    0x00, 0x2F, 0x9F, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xFE, 0x00, 0x3F, 0x40,
-    0x7F, 0xD0, 0x2F, 0x80, 0x03, 0xF8, 0x0B, 0xE0, 0x00, 0xFD, 0x01, 0xFF, 0x56, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xA4, 0x00, 0x00, 0x7F, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0x40, 0xBF,
-    0x40, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x55, 0x54, 0x3F, 0xC0, 0x0F, 0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xF4, 0x3F, 0xC0,
-    0x00, 0xFE, 0x03, 0xFE, 0x00, 0x0F, 0xE0, 0x2F, 0xF4, 0x00, 0xFD, 0x00, 0xFF, 0xF9, 0xBF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFE, 0xFF, 0xF4, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0xFD, 0x03, 0xF0,
-    0x00, 0x3F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x02, 0xF9, 0xFF, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x03, 0xF4, 0x07, 0xFD, 0x02, 0xF8, 0x00, 0x3F, 0x80, 0xBE,
-    0x00, 0x0F, 0xD0, 0x1F, 0xF5, 0x6F, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x00, 0x02, 0xD0, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x55, 0x55, 0x01, 0xFF, 0xFD, 0x0F,
-    0xFF, 0xE0, 0x0B, 0xFF, 0x40, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x40,
-    0x07, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE5,
-    0x55, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x03, 0xFC,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x07, 0xFF,
-    0xF4, 0x3F, 0xFF, 0x40, 0xBF, 0xFF, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x0B, 0xC0, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x04, 0x00, 0x0F, 0xD2, 0xFE, 0x00, 0x3F,
-    0x3F, 0xFC, 0x01, 0xFE, 0xEB, 0xF0, 0x07, 0xFE, 0x1F, 0xC0, 0x2F, 0xE0, 0xBF, 0x00, 0xFF, 0x03,
-    0xF8, 0x03, 0xF8, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF8, 0x0F, 0xD2,
-    0x0F, 0xD0, 0x3F, 0xFC, 0x7F, 0x00, 0xFF, 0xE2, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x54, 0x05, 0x55, 0x50, 0x1F, 0xFF, 0xD0, 0xFF, 0xFE, 0x00, 0xBF, 0xF4, 0x0B, 0xFF,
-    0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x01, 0x7F, 0xD5, 0x57, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x7F, 0x80, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x55, 0x5F, 0xF0, 0x00, 0x1F, 0xD0, 0x00,
-    0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0,
-    0x7F, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x1A, 0xFE, 0xA0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x1B,
-    0xD0, 0x03, 0xF2, 0xFF, 0xC0, 0x1F, 0xEF, 0xFF, 0x00, 0xBF, 0xE1, 0xFC, 0x02, 0xFF, 0x0B, 0xF0,
-    0x0F, 0xF0, 0x3F, 0x80, 0x3F, 0x80, 0xFD, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F,
-    0x80, 0xFD, 0x20, 0xFD, 0x03, 0xFF, 0xC7, 0xF0, 0x0F, 0xFE, 0x2F, 0xC0, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x1F, 0xF2, 0xD0, 0x0F, 0xFF, 0xF0, 0x03, 0xC3, 0xF4, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x50, 0x07, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x90, 0x10, 0x1F, 0xF2, 0xD0, 0xFB, 0xFF, 0x03, 0xC3, 0xF4, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x88, 0x00, 0xFF,
-    0xF4, 0x03, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x2F, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x1F, 0xFF,
-    0xE0, 0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x80, 0x0F, 0xFF,
-    0x40, 0x3F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x1F, 0x01,
-    0xC0, 0x07, 0xFB, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x50, 0x07, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE,
-    0x00, 0x07, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x2E, 0x00, 0xC0, 0xBE, 0x6F,
-    0x01, 0xFF, 0xF0, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0x88, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xF8, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0x02, 0xFA, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0B,
-    0xF0, 0x03, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x00, 0xFD,
-    0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0x88,
-    0x0F, 0xFF, 0x43, 0xFF, 0x80, 0xBF, 0x40, 0x0B, 0x40, 0x07, 0x80, 0x03, 0xC0, 0x00, 0xFE, 0x40,
-    0x2F, 0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B,
-    0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xF8,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x10, 0x1F,
-    0xF8, 0x3F, 0xF8, 0x03, 0xF4, 0x03, 0xF0, 0x07, 0xF0, 0x0B, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x2F, 0x88, 0x3F, 0xFD, 0x3F, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x55,
-    0x50, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x0B, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x1F,
-    0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFD, 0x00,
-    0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80,
-    0x03, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x7F, 0x40, 0x0B, 0xFF, 0xF4, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x3C, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x0B, 0xD0, 0x0B, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0xBD, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x7F, 0xE0, 0x2F, 0xF0, 0x3F, 0xF8, 0x2F, 0xFC,
-    0x00, 0xFD, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x0B, 0xE0, 0x0B, 0xE0, 0x03,
-    0xF4, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x2F, 0x88,
-    0x0F, 0xE0, 0x0F, 0xFF, 0x43, 0xF4, 0x03, 0xFF, 0xC1, 0xFC, 0x00, 0xBF, 0x80, 0xBF, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0D, 0x0F, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x7F, 0x0B, 0xC0, 0x00,
-    0x2E, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xC2, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7D, 0xF8, 0x00, 0x01, 0xF4, 0x3C, 0x00, 0x02, 0xD0,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x74, 0x3F, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x01, 0xFF, 0xFD, 0x3F, 0xFE, 0x00,
-    0xBF, 0xF4, 0x1F, 0xF8, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F,
-    0x83, 0xF8, 0x00, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x40,
-    0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF8, 0x00,
-    0x07, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0x01, 0xFF, 0xD0, 0xBF, 0xFF, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x40, 0x0F, 0xC2, 0xFC, 0x03, 0xF7, 0xFF, 0x80,
-    0xFB, 0xC7, 0xE0, 0x7F, 0x80, 0xF8, 0x2F, 0xC0, 0xBC, 0x0F, 0xD0, 0xBD, 0x03, 0xFB, 0xFC, 0x01,
-    0xFF, 0xF0, 0x00, 0xBE, 0xBD, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC2, 0xFE, 0x47, 0xF0, 0x3F, 0xFA,
-    0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x41, 0xFF, 0x40,
-    0xFE, 0x3F, 0xF4, 0x3F, 0xE0, 0x3F, 0x4F, 0xFC, 0x03, 0xF3, 0xE0, 0x40, 0x3F, 0xB8, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0xFC, 0xBC, 0x00, 0x1F, 0xC7, 0xF0,
-    0x81, 0xFC, 0x3F, 0xFD, 0x2F, 0x82, 0xFF, 0xC3, 0xF4, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x0D, 0x03, 0xFC, 0x00, 0xF8, 0x0F, 0xF0,
-    0x07, 0xD0, 0x7F, 0x95, 0x7F, 0x1F, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x1F, 0xE0, 0x1F, 0xFD, 0x03, 0xF9, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0xBF,
-    0xE0, 0x1F, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x80,
-    0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F,
-    0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x48, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x54, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC,
-    0x00, 0x34, 0x0F, 0xF0, 0x03, 0xE0, 0x3F, 0xC0, 0x1F, 0x41, 0xFE, 0x55, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xE2, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0xBF, 0xE0, 0x7F, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x03,
-    0xF8, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x7F,
-    0x00, 0x2F, 0x80, 0x0F, 0xD2, 0x03, 0xFF, 0xC0, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x55, 0x54, 0x3D, 0x01, 0xFF, 0xFD, 0x7C, 0x00, 0xBF, 0xF4, 0xB8,
-    0x00, 0x2F, 0xC0, 0xF0, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0xF8, 0x03, 0xFC, 0x01, 0xF4,
-    0x07, 0xF9, 0x57, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x14, 0x04, 0x0B,
-    0xFE, 0x2F, 0x1F, 0xFE, 0x3E, 0x00, 0xFD, 0x3D, 0x00, 0xFC, 0x7C, 0x01, 0xFC, 0xB4, 0x02, 0xF8,
-    0x20, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
-    0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x48, 0x00, 0x3F,
-    0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x7C, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0xBF, 0x02, 0xFC, 0x00,
-    0xFF, 0x00, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x34, 0x03,
-    0xFC, 0x00, 0xF8, 0x03, 0xFC, 0x01, 0xF4, 0x07, 0xF9, 0x57, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0,
-    0xBC, 0x0B, 0xF1, 0xFC, 0x0F, 0xE1, 0xFC, 0x0F, 0xD0, 0xA0, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00,
-    0x2F, 0x80, 0x00, 0x3F, 0x48, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF5, 0xC0, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xBF, 0x40, 0x00, 0x02,
-    0xFC, 0x00, 0x34, 0x0F, 0xF0, 0x03, 0xE0, 0x3F, 0xC0, 0x1F, 0x41, 0xFE, 0x55, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x2F, 0xF8, 0x07, 0xFF, 0x80, 0x03, 0xF4,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0xE0, 0x1F, 0xF8, 0x02,
-    0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF4, 0x01, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xD2,
-    0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x15, 0x54, 0x01, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0x00,
-    0x6F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0xFD,
-    0x01, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0x40, 0x00, 0x7D, 0xFF, 0x02, 0xF0, 0x00, 0x0B, 0xC7,
-    0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0xC3, 0xF0, 0x00, 0x0F, 0xC1, 0xFE, 0x7E, 0x00, 0x01, 0xF8,
-    0x0F, 0xFB, 0xD0, 0x00, 0x2F, 0x40, 0xBF, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x3F,
-    0x00, 0x2F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0xBF,
-    0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x7F, 0xD0, 0xFF, 0x03,
-    0xFF, 0x9F, 0xFE, 0x00, 0xFE, 0xFB, 0xF8, 0x03, 0xFF, 0x0B, 0xE0, 0x0F, 0xF4, 0x3F, 0x40, 0x7F,
-    0x80, 0xFC, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x01, 0xFC, 0x07,
-    0xF1, 0x47, 0xF0, 0x1F, 0xFE, 0x2F, 0xC0, 0xBF, 0xF4, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x40, 0x01, 0x55, 0x40, 0x1F, 0xFE, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xF0, 0x06,
-    0xFF, 0x40, 0x02, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xD0,
-    0x1F, 0x80, 0x00, 0x7F, 0xFE, 0x01, 0xF4, 0x00, 0x07, 0xDF, 0xF0, 0x2F, 0x00, 0x00, 0xBC, 0x7F,
-    0x83, 0xF0, 0x00, 0x0F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0xE7, 0xE0, 0x00, 0x1F, 0x80,
-    0xFF, 0xBD, 0x00, 0x02, 0xF4, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xF0,
-    0x02, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0xFF, 0x40, 0x0B, 0xFF,
-    0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x7F,
-    0xD0, 0xFF, 0x03, 0xFF, 0x9F, 0xFE, 0x00, 0xFE, 0xFB, 0xF8, 0x03, 0xFF, 0x0B, 0xE0, 0x0F, 0xF4,
-    0x3F, 0x40, 0x7F, 0x80, 0xFC, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD,
-    0x01, 0xFC, 0x07, 0xF1, 0x47, 0xF0, 0x1F, 0xFE, 0x2F, 0xC0, 0xBF, 0xF4, 0xFD, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFB, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x15, 0x54, 0x01, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x6F,
-    0xF4, 0x00, 0x2F, 0xF4, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0xFD, 0x01,
-    0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0x40, 0x00, 0x7D, 0xFF, 0x02, 0xF0, 0x00, 0x0B, 0xC7, 0xF8,
-    0x3F, 0x00, 0x00, 0xFC, 0x3F, 0xC3, 0xF0, 0x00, 0x0F, 0xC1, 0xFE, 0x7E, 0x00, 0x01, 0xF8, 0x0F,
-    0xFB, 0xD0, 0x00, 0x2F, 0x40, 0xBF, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0x00,
-    0x2F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0xBF, 0xFD,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x01, 0xD0, 0x00, 0x7C, 0x2F,
-    0x00, 0x00, 0xF5, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x1F, 0xF4, 0x3F, 0xC0, 0xFF, 0xE7, 0xFF, 0x80, 0x3F,
-    0xBE, 0xFE, 0x00, 0xFF, 0xC2, 0xF8, 0x03, 0xFD, 0x0F, 0xD0, 0x1F, 0xE0, 0x3F, 0x00, 0xBF, 0x01,
-    0xFC, 0x03, 0xF8, 0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0x7F, 0x01, 0xFC, 0x51, 0xFC, 0x07, 0xFF,
-    0x8B, 0xF0, 0x2F, 0xFD, 0x3F, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x10, 0x01, 0x00, 0x3F, 0x1F, 0xFC, 0x2F, 0xD0, 0x3C,
-    0x3F, 0xFC, 0xFF, 0xF0, 0x00, 0x02, 0xFB, 0xEB, 0xF0, 0x00, 0x02, 0xFF, 0x47, 0xF0, 0x00, 0x03,
-    0xFE, 0x0B, 0xE0, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x3F, 0x48, 0x00, 0x0F, 0xD0, 0x3F,
-    0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0xF8, 0x00, 0x2F, 0x80, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x01, 0x55, 0x40, 0x1F, 0xFE, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xF0, 0x06, 0xFF,
-    0x40, 0x02, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x1F,
-    0x80, 0x00, 0x7F, 0xFE, 0x01, 0xF4, 0x00, 0x07, 0xDF, 0xF0, 0x2F, 0x00, 0x00, 0xBC, 0x7F, 0x83,
-    0xF0, 0x00, 0x0F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0xE7, 0xE0, 0x00, 0x1F, 0x80, 0xFF,
-    0xBD, 0x00, 0x02, 0xF4, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xF0, 0x02,
-    0xFF, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0x40, 0x0B, 0xFF, 0xD0,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0D, 0x0B, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x10, 0x01, 0x01, 0xFF, 0x43, 0xFC, 0x3F, 0xF9, 0xFF, 0xE0, 0x3F, 0xBE, 0xFE, 0x03, 0xFF, 0x0B,
-    0xE0, 0x3F, 0xD0, 0xFD, 0x07, 0xF8, 0x0F, 0xC0, 0xBF, 0x01, 0xFC, 0x0F, 0xE0, 0x2F, 0x80, 0xFD,
-    0x03, 0xF8, 0x1F, 0xC0, 0x3F, 0x01, 0xFC, 0x07, 0xF0, 0x2F, 0xC0, 0xBE, 0x03, 0xF4, 0x0F, 0xD0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x02, 0x83, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x7F, 0xC0,
-    0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x2F, 0xE1, 0xFF, 0x00, 0x02, 0xFE, 0x2F, 0xD0, 0x00, 0x2F, 0xE3,
-    0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC3, 0xFC, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x0F,
-    0xFE, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F,
-    0xC1, 0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4,
-    0x07, 0xF0, 0x3F, 0x40, 0xFD, 0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x1F, 0x01, 0xC0, 0x00, 0x01, 0xFE,
-    0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F,
-    0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD,
-    0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F,
-    0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0,
-    0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xE0, 0x0C, 0x00, 0x2F, 0x9B, 0xC0,
-    0x00, 0xFF, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F, 0xC1, 0xFC, 0x02, 0xFC, 0x3F,
-    0x80, 0x2F, 0xC3, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4, 0x07, 0xF0, 0x3F, 0x40, 0xFD,
-    0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x02, 0xD0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x3F,
-    0xD7, 0xFC, 0x00, 0x03, 0xF8, 0x7F, 0x40, 0x00, 0x0D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x1F,
-    0xF4, 0x1F, 0xFC, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x00,
-    0xBF, 0x82, 0xFD, 0x00, 0x02, 0xFE, 0x0F, 0xF0, 0x00, 0x0B, 0xF8, 0x3F, 0xC0, 0x00, 0x2F, 0xE0,
-    0xFF, 0x00, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x3F, 0xD0,
-    0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x50, 0x00,
-    0x07, 0xC3, 0xD0, 0x00, 0x3F, 0x2F, 0x40, 0x03, 0xF1, 0xF8, 0x00, 0x1F, 0x0F, 0x40, 0x00, 0x70,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x7F, 0x87, 0xF8, 0x03, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0xC0, 0xFE, 0x00, 0xBF, 0x03,
-    0xF4, 0x03, 0xF8, 0x0F, 0xD0, 0x0F, 0xD0, 0x7F, 0x40, 0x7F, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xFD,
-    0x7F, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x5A, 0x95, 0x55, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFE, 0x40, 0x7F, 0x00, 0x3D, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x0F, 0x02, 0xFD, 0x00,
-    0x0F, 0xE0, 0x03, 0x80, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0xBF, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x2F, 0xFF, 0xF4, 0x03, 0xF8, 0x00, 0x0F,
-    0xE5, 0x54, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x10, 0x0F,
-    0xF4, 0x00, 0xBF, 0x00, 0x1E, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0x80, 0x3F, 0xFA, 0xBF, 0xE5,
-    0x5B, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0x00, 0x2F, 0xF8, 0x1F, 0xFC, 0x01,
-    0xFF, 0xFE, 0x7F, 0xFE, 0x07, 0xF8, 0x7F, 0xF4, 0x7F, 0x0F, 0xE0, 0x3F, 0xE0, 0x7E, 0x1F, 0xC0,
-    0x2F, 0xC0, 0xFC, 0x3F, 0x80, 0x2F, 0x83, 0xF4, 0x3F, 0x40, 0x3F, 0xAF, 0xC0, 0x3F, 0x40, 0x3F,
-    0xFD, 0x00, 0x7F, 0x40, 0x7F, 0x90, 0x04, 0x3F, 0x40, 0xFF, 0x80, 0x3C, 0x3F, 0xD7, 0xFF, 0xEA,
-    0xFC, 0x1F, 0xFF, 0xDF, 0xFF, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x6B, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0xBF, 0xD0, 0x01, 0x2F, 0xC1,
-    0xFF, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xF0, 0x00,
-    0xBF, 0x01, 0xFD, 0x00, 0x0B, 0xF1, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x3F,
-    0x80, 0xFF, 0x00, 0x07, 0xF8, 0x0B, 0xFD, 0x07, 0xFF, 0xF0, 0x2F, 0xF8, 0xBF, 0xFF, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xF0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x04, 0x07, 0xFD, 0x1F, 0xC3, 0xFF, 0x9F, 0xF0, 0x0B, 0xDF, 0xFC, 0x02, 0xFB, 0x95, 0x00,
-    0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x16, 0xBA,
-    0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xEB, 0xFD, 0x00, 0x12, 0xFC, 0x1F, 0xF0, 0x00,
-    0x3F, 0x80, 0xFF, 0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x0B, 0xF0, 0x1F,
-    0xD0, 0x00, 0xBF, 0x1B, 0xF8, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
-    0xDB, 0xF0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x03, 0xF8, 0x0F, 0xF0,
-    0x00, 0x7F, 0x80, 0xBF, 0xD0, 0x7F, 0xFF, 0x02, 0xFF, 0x8B, 0xFF, 0xF0, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x01, 0x00, 0x7F, 0xD1, 0xFC, 0x0F, 0xFE, 0x7F, 0xC0, 0x0B, 0xDF, 0xFC, 0x00, 0xBE, 0xE5, 0x40,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x07,
-    0xD0, 0x00, 0x07, 0xC1, 0xF8, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFE, 0xBF, 0xD0, 0x01, 0x2F, 0xC1, 0xFF, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x3F,
-    0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xF0, 0x00, 0xBF, 0x01, 0xFD, 0x00, 0x0B, 0xF1, 0xBF, 0x80,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x2F, 0xC3,
-    0xF8, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x07, 0xF8, 0x0B, 0xFD, 0x07,
-    0xFF, 0xF0, 0x2F, 0xF8, 0xBF, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x07,
-    0x40, 0x1F, 0x0B, 0xC0, 0x03, 0xD7, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x1F, 0xF4, 0x7F, 0x0F, 0xFE, 0x7F, 0xC0, 0x2F, 0x7F,
-    0xF0, 0x0B, 0xEE, 0x54, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xC0,
-    0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x90,
-    0x00, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xD0, 0x1F, 0xD0, 0x2F, 0x00, 0xBF, 0x00, 0xBC, 0x03,
-    0xFC, 0x02, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xC0, 0x0F, 0xF0, 0x2F, 0x00, 0x2F,
-    0xC0, 0xFD, 0x00, 0xFF, 0x03, 0xFE, 0x5F, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFF, 0xD0, 0x0F, 0xD1, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x02, 0x00, 0xFE, 0x02, 0xF0,
-    0x2F, 0x80, 0xFF, 0x5F, 0xC0, 0x3F, 0xFF, 0xD0, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x0F,
-    0xD1, 0xF0, 0x00, 0x78, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x90, 0x00, 0x2F, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xD0, 0x1F, 0xD0, 0x2F, 0x00, 0xBF, 0x00, 0xBC, 0x03, 0xFC, 0x02, 0xD0,
-    0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xC0, 0x0F, 0xF0, 0x2F, 0x00, 0x2F, 0xC0, 0xFD, 0x00,
-    0xFF, 0x03, 0xFE, 0x5F, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x7D, 0xFC, 0x00, 0x3D,
-    0x0F, 0x00, 0x2D, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x3F,
-    0xFF, 0x40, 0x3F, 0x47, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x08, 0x03, 0xF8, 0x0B, 0xC0, 0xBE, 0x03, 0xFD, 0x7F, 0x00, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBA, 0x40, 0x00, 0xBF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0x40, 0x7F, 0x40, 0xBC, 0x02, 0xFC, 0x02, 0xF0, 0x0F, 0xF0, 0x0B, 0x40,
-    0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0x00, 0x3F, 0xC0, 0xBC, 0x00, 0xBF, 0x03, 0xF4, 0x03,
-    0xFC, 0x0F, 0xF9, 0x7F, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xFD,
-    0x03, 0xF4, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00,
-    0x1F, 0xF4, 0x08, 0x03, 0xF8, 0x2F, 0x02, 0xF8, 0x3F, 0xD7, 0xF0, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x00,
-    0x07, 0xE0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x0F,
-    0x83, 0xF0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xBA, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF4, 0x01, 0xFD,
-    0x02, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x03, 0xFC, 0x02, 0xD0, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xC0, 0x0F, 0x00, 0x3F, 0xC0, 0x2F, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x3F, 0xC0, 0x3F, 0xE5,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-    0x03, 0x80, 0x03, 0xD0, 0xF4, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xD0, 0x03, 0xF4, 0x7C, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x08, 0x03, 0xF8, 0x02, 0xF0, 0x2F, 0x80, 0x3F, 0xD7, 0xF0,
-    0x03, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xF8, 0x1F, 0xD0, 0xBC, 0x7D, 0x0B, 0xF0, 0x2F,
-    0x0F, 0x03, 0xFC, 0x0F, 0x41, 0x40, 0xFE, 0x01, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x00, 0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0xC1, 0x7F, 0x94, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x07, 0x81, 0xFF, 0xFE, 0x07,
-    0xFF, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x40, 0x01, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3D,
-    0x00, 0x01, 0xF4, 0x7E, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xE0, 0x7F, 0x42, 0xF1, 0xF4, 0x2F, 0xC0, 0xBC, 0x3C, 0x0F, 0xF0, 0x3D, 0x05,
-    0x03, 0xF8, 0x05, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x14, 0xF0,
-    0x00, 0x7E, 0x38, 0x00, 0x3F, 0x48, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0,
-    0x05, 0xFE, 0x50, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC1, 0xE0, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xFC,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xF8, 0x1F, 0xD0, 0xBC, 0x7D, 0x0B, 0xF0, 0x2F, 0x0F, 0x03, 0xFC,
-    0x0F, 0x41, 0x40, 0xFE, 0x01, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xBF, 0xEA, 0x00, 0x01, 0xFF,
-    0xFF, 0xC0, 0x00, 0x17, 0xFD, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00,
-    0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0xC1, 0x7F, 0x94, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x07, 0x81, 0xFF, 0xFE, 0x07, 0xFF,
-    0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0x0F, 0xF2, 0xD0,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x02, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x55, 0x2F, 0xFF, 0xC0, 0xFF, 0xFD, 0x7F, 0xFD, 0x02,
-    0xFF, 0x90, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x3F, 0x80,
-    0x2F, 0xC0, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x0F, 0xE0,
-    0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F,
-    0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x80, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x40, 0x00, 0x7F, 0x8B, 0x40, 0x03, 0xEF, 0xFC, 0x00, 0x0E, 0x1F, 0xD0, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC, 0x7F, 0xF8, 0x0F, 0xE0,
-    0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xE0, 0x3F, 0x80, 0x3F,
-    0x40, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xF0, 0x7F, 0xC0, 0x2F, 0x87, 0xFF, 0x18, 0xFF, 0xBC,
-    0xFF, 0xF3, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x50, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x4B, 0xFF, 0xF0, 0x3F, 0xFF, 0x5F, 0xFF,
-    0x40, 0xBF, 0xE4, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x01, 0xFD, 0x00, 0x0F,
-    0xE0, 0x0B, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x03,
-    0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x00,
-    0x1F, 0xC0, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x2F, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE, 0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00,
-    0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F, 0xF1, 0x8F, 0xFB, 0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F,
-    0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x01, 0xD0,
-    0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x55, 0x2F, 0xFF, 0xC0, 0xFF, 0xFD, 0x7F, 0xFD, 0x02,
-    0xFF, 0x90, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x3F, 0x80,
-    0x2F, 0xC0, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x0F, 0xE0,
-    0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F,
-    0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x80, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0xB4, 0x07, 0x00, 0x03, 0xF9, 0xB8, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x06, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC, 0x7F, 0xF8, 0x0F, 0xE0,
-    0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xE0, 0x3F, 0x80, 0x3F,
-    0x40, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xF0, 0x7F, 0xC0, 0x2F, 0x87, 0xFF, 0x18, 0xFF, 0xBC,
-    0xFF, 0xF3, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2D, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x74, 0x00,
-    0x00, 0x02, 0xD7, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x55,
-    0x40, 0x55, 0x54, 0xBF, 0xFF, 0x03, 0xFF, 0xF5, 0xFF, 0xF4, 0x0B, 0xFE, 0x40, 0xFF, 0x00, 0x07,
-    0xF0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x03,
-    0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x01, 0xFD, 0x00,
-    0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xE0,
-    0x02, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0xF0, 0xB0, 0x00, 0x03, 0x82, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xF1, 0xFF, 0xE0, 0x3F, 0x80, 0x3F,
-    0x40, 0xFD, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x2F, 0x80, 0xFE, 0x00, 0xFD, 0x03,
-    0xF4, 0x03, 0xF0, 0x2F, 0xC0, 0x1F, 0xC1, 0xFF, 0x00, 0xBE, 0x1F, 0xFC, 0x63, 0xFE, 0xF3, 0xFF,
-    0xCF, 0xFF, 0x0F, 0xFC, 0x1F, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x78, 0x0B, 0x40, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0xFF, 0x5F, 0xF0, 0x00,
-    0x0F, 0xE1, 0xFD, 0x00, 0x00, 0x34, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x55, 0x54, 0xBF, 0xFF, 0x03, 0xFF, 0xF5, 0xFF, 0xF4, 0x0B, 0xFE, 0x40, 0xFF, 0x00, 0x07, 0xF0,
-    0x03, 0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x03, 0xFC,
-    0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x01, 0xFD, 0x00, 0x0F,
-    0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x02,
-    0xFE, 0x00, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x0B, 0x83, 0xC0,
-    0x00, 0x7E, 0x3F, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xA0, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xF1, 0xFF, 0xE0, 0x3F, 0x80, 0x3F, 0x40,
-    0xFD, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x2F, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4,
-    0x03, 0xF0, 0x2F, 0xC0, 0x1F, 0xC1, 0xFF, 0x00, 0xBE, 0x1F, 0xFC, 0x63, 0xFE, 0xF3, 0xFF, 0xCF,
-    0xFF, 0x0F, 0xFC, 0x1F, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55, 0x52,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xF9, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x0F, 0xE0,
-    0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F,
-    0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x3F, 0x40, 0x2F,
-    0xC0, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF8, 0x02,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFA, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0xBF, 0xD0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x7F, 0x00, 0xBE, 0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00, 0x7F,
-    0x07, 0xFC, 0x02, 0xF8, 0x7F, 0xF1, 0x8F, 0xFB, 0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC0,
-    0x7F, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xFE,
-    0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x15, 0x54, 0x3F, 0xFF, 0x80, 0xF8,
-    0x0B, 0xFF, 0xC2, 0xFF, 0xE0, 0x1F, 0x80, 0x2F, 0xF4, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xFC, 0x00,
-    0x7F, 0x40, 0x3F, 0xC0, 0x2F, 0x80, 0x07, 0xF4, 0x0B, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0xFF,
-    0xC0, 0xBE, 0x00, 0x03, 0xF4, 0x2F, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x43, 0xDF, 0xC2, 0xF4, 0x00,
-    0x03, 0xF8, 0xBC, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x8F, 0x4F, 0xCB, 0xD0, 0x00, 0x02, 0xFA, 0xF0,
-    0xBC, 0xFC, 0x00, 0x00, 0x2F, 0xBE, 0x0B, 0xEF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0xBF, 0xF0, 0x00,
-    0x00, 0x1F, 0xF8, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xE0,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x7D, 0xF8, 0x00, 0x00, 0x07, 0xD1, 0xF0, 0x00, 0x00, 0x2D, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x2F, 0xC0, 0xBE, 0x07, 0xF2, 0xFF, 0x81, 0xFC, 0x0F,
-    0xE0, 0xBF, 0x03, 0xF4, 0x2F, 0x80, 0xFC, 0x0F, 0xD0, 0xBD, 0x03, 0xF4, 0x3F, 0x82, 0xF0, 0x0B,
-    0xE1, 0xFF, 0x0F, 0x80, 0x1F, 0x8B, 0xFC, 0x7D, 0x00, 0x3E, 0x3F, 0xF3, 0xF0, 0x00, 0xFA, 0xEB,
-    0xDF, 0x40, 0x03, 0xFF, 0x2F, 0xF8, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x00, 0x3F, 0x42, 0xFC, 0x00,
-    0x00, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x1F, 0xC2, 0xF0,
-    0x00, 0x02, 0xE0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x54, 0x7F, 0xFF,
-    0x0F, 0xFF, 0xC3, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0xBE, 0x00,
-    0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0xC3, 0xF0, 0x00, 0x01, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0xEF,
-    0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x01, 0xF4, 0x3C,
-    0x00, 0x00, 0xB4, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2F, 0xD0,
-    0x7F, 0x40, 0x2F, 0xFC, 0x0F, 0xE0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x03,
-    0xF4, 0x3F, 0x40, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x1F, 0x87, 0xD0, 0x00, 0x07, 0xE2, 0xF0, 0x00,
-    0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x01, 0xF8, 0xBE, 0x00,
-    0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55, 0x47, 0xFF, 0xF0,
-    0xFF, 0xFC, 0x3F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x0B, 0xE0, 0x00,
-    0x3F, 0x40, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x00, 0x1F, 0xCB, 0xD0, 0x00, 0x00, 0xFE, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0x00, 0x3F, 0xD0, 0x0F, 0x80, 0x3F, 0xE0, 0x02, 0xC0, 0x2F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x01, 0xD0, 0x07,
-    0xFC, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x7E, 0x03, 0xFE, 0x55, 0x7F, 0x40, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2F, 0xF4, 0xFC, 0x07, 0xFF, 0xFF, 0xC0,
-    0xBE, 0xFF, 0xF0, 0x0B, 0x80, 0xFD, 0x00, 0x70, 0x3F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x80, 0x0B, 0xE0, 0x1F, 0x02, 0xFF, 0xFB, 0xF0, 0x3F,
-    0xFF, 0xFF, 0x03, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFC, 0x00, 0xFF, 0x40, 0x3E, 0x00, 0xFF, 0x80, 0x0B, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0x40, 0x1F, 0xF0, 0x03, 0xF0, 0x0F,
-    0xF4, 0x01, 0xF8, 0x0F, 0xF9, 0x55, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2F, 0xF4,
-    0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0xBE, 0xFF, 0xF0, 0x0B, 0x80, 0xFD, 0x00, 0x70, 0x3F, 0x40, 0x00,
-    0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x80, 0x0B, 0xE0, 0x1F,
-    0x02, 0xFF, 0xFB, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x1F, 0xBF, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x50, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0x00, 0x3F, 0xD0, 0x0F, 0x80,
-    0x3F, 0xE0, 0x02, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x07, 0xFC, 0x01, 0xD0, 0x07, 0xFC, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x7E, 0x03, 0xFE, 0x55, 0x7F,
-    0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x07, 0x80, 0x03, 0xC1, 0xF4, 0x00, 0x3E, 0x7D, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0xFF, 0x4F, 0xC0, 0x7F, 0xFF,
-    0xFC, 0x0B, 0xEF, 0xFF, 0x00, 0xB8, 0x0F, 0xD0, 0x07, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x08, 0x00, 0xBE, 0x01, 0xF0, 0x2F, 0xFF, 0xBF,
-    0x03, 0xFF, 0xFF, 0xF0, 0x3E, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x02, 0xF8, 0x3C, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x02, 0x81, 0xFC, 0x00, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x14, 0x07, 0xC0, 0x7F, 0x03, 0xF8, 0x0B, 0xC0, 0x1C,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x0B, 0xC1, 0xFC, 0x3F, 0x07, 0xC0, 0x20, 0x00, 0x00, 0x14, 0x00,
-    0x7F, 0x00, 0x3F, 0xE0, 0x3E, 0x7C, 0x3F, 0x0F, 0x9F, 0x00, 0xD0, 0x00, 0x00, 0x06, 0x40, 0x41,
-    0xFE, 0x2C, 0x3E, 0xFF, 0xC3, 0x87, 0xF4, 0x00, 0x04, 0x00, 0x2F, 0xFF, 0xCF, 0xFF, 0xE1, 0x55,
-    0x50, 0x10, 0x00, 0xB4, 0x07, 0xFD, 0x6E, 0x7F, 0xFC, 0x1B, 0x90, 0x04, 0x7F, 0xFF, 0xFD, 0x10,
-    0x00, 0x00, 0x01, 0xF0, 0xBC, 0x3F, 0x5F, 0xC3, 0xF1, 0xF8, 0x04, 0x00, 0x00, 0x1B, 0xD2, 0xFF,
-    0xDF, 0x0F, 0x54, 0x3C, 0x0B, 0xD0, 0xB8, 0x01, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xFC, 0x3C,
-    0x3C, 0x38, 0x2C, 0x3D, 0x78, 0x2F, 0xF0, 0x01, 0x40, 0x00, 0x80, 0x40, 0x0B, 0x87, 0xC0, 0x7E,
-    0x3F, 0x03, 0xF2, 0xF0, 0x3E, 0x1F, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0B, 0x6E,
-    0x0B, 0xC7, 0xDB, 0xC0, 0xFF, 0xC0, 0x1F, 0xD0, 0x02, 0x90, 0x00, 0x00, 0x10, 0x78, 0xB4, 0xBC,
-    0xF8, 0x3C, 0x7C, 0x2D, 0x3D, 0x0D, 0x1C, 0x00, 0x00, 0x00, 0x54, 0x01, 0xFF, 0xC2, 0xFF, 0xF8,
-    0xE0, 0x2E, 0x10, 0x02, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x02, 0xE0, 0x3D, 0x03, 0xE0, 0x3F, 0x00,
-    0x40, 0x07, 0xD0, 0xBF, 0x03, 0xF0, 0x3D, 0x0B, 0xC2, 0xF0, 0x28, 0x00, 0x2E, 0x2F, 0x8F, 0xC3,
-    0xE0, 0xBC, 0x0F, 0x01, 0x80, 0x14, 0x3E, 0x3D, 0x7C, 0xB8, 0xF0, 0x10, 0x07, 0x80, 0xBC, 0x0F,
-    0xC2, 0xF0, 0x3C, 0x01, 0x00, 0x00, 0x2E, 0xBF, 0xFE, 0x78, 0x0A, 0x02, 0x43, 0xF4, 0xFC, 0x3F,
-    0x1F, 0xC1, 0x80, 0xA0, 0x0A, 0x43, 0xFE, 0xB0, 0xEB, 0x0E, 0x7F, 0xC0, 0x50, 0x06, 0x43, 0xF0,
-    0xF8, 0x3C, 0x3D, 0x04, 0x00, 0x0B, 0x80, 0xFD, 0x03, 0xD0, 0xBC, 0x2F, 0x02, 0x40, 0x01, 0x00,
-    0xE0, 0x3C, 0x07, 0x80, 0xBE, 0x83, 0xFC, 0x04, 0x00, 0x1A, 0x0B, 0xC3, 0xF0, 0xF8, 0x7D, 0x2F,
-    0x40, 0x00, 0x00, 0x14, 0x00, 0x7F, 0x40, 0x3F, 0xF0, 0x7E, 0x7E, 0x7E, 0x07, 0xC4, 0x00, 0x40,
-    0x00, 0x00, 0xB0, 0x03, 0xFD, 0x1E, 0xBF, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0x81, 0x82, 0xFF,
-    0x3C, 0x3D, 0xFF, 0xC3, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x55, 0x0F, 0xFF, 0xF3, 0xFF, 0xF8,
-    0x00, 0x50, 0x1F, 0xFC, 0x7F, 0xFF, 0xF0, 0x2F, 0x80, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xBD, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0xBE, 0x3F,
-    0x8B, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x0F, 0x07, 0xC1, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x54,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0xFF, 0x00,
-    0x7C, 0x00, 0x3F, 0x80, 0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x40, 0x03, 0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x95, 0x7F, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x0F, 0x80, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x0B, 0xF0, 0x07, 0xC0, 0x03, 0xFC, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0x74, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x55,
-    0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0x00, 0x0F, 0xF0, 0x02, 0xD0, 0x03, 0xF8,
-    0x00, 0xF4, 0x01, 0xFE, 0x55, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x05,
-    0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x2F, 0xC0, 0xFC,
-    0x7C, 0x0B, 0xF0, 0x3E, 0x0F, 0x03, 0xF8, 0x0F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x44,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x1F, 0xF4, 0x00, 0xFD,
-    0x00, 0xFE, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x2F, 0xC0, 0x0F, 0xE0, 0x0F, 0xF0, 0x03, 0xF8, 0x03,
-    0xF8, 0x00, 0xFD, 0x0F, 0xFF, 0xD0, 0x7F, 0x0B, 0xFF, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x04, 0x0B, 0xF0, 0x00, 0x0F, 0x9F, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFC, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0xF8, 0x00, 0x3F, 0x80, 0x3D, 0x00, 0x1F, 0xD0, 0x0E,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x6B, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x00,
-    0xFC, 0x07, 0xF8, 0x00, 0x3E, 0x03, 0xFC, 0x00, 0x0F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0xAA, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x20, 0x0F, 0xF4, 0x00, 0x1F, 0x01, 0xFF, 0x40, 0x1F, 0xC0,
-    0x3F, 0xFE, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xBA, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x40, 0x7F, 0x40, 0xBC,
-    0x02, 0xFC, 0x02, 0xF0, 0x0F, 0xF0, 0x0B, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0x00,
-    0x3F, 0xC0, 0xBC, 0x00, 0xBF, 0x03, 0xF4, 0x03, 0xFC, 0x0F, 0xF9, 0x7F, 0xD0, 0x3F, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0xFF, 0xFE, 0x00,
-    0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F,
-    0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x00,
-    0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x0F, 0xE3, 0xF8, 0x03, 0xF0, 0xFC, 0x00, 0x10, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x50, 0x07, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2C, 0x2F, 0xC0, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x40, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x7D, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0xFC, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x7D, 0x03, 0xF8, 0x2F, 0xE0, 0x00, 0x2F,
-    0x00, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0x80, 0x7F, 0x40, 0xBF, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x2F,
-    0xC1, 0x4B, 0xD0, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF, 0xF0, 0x03, 0xFC, 0x1F, 0xF0, 0x3F, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 0x0F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x54, 0x05, 0x55, 0x40, 0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x2F,
-    0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFE, 0x55, 0xBF,
-    0x86, 0xFE, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0xFF, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0xBF, 0x03, 0xFC,
-    0x00, 0xBF, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0xFE, 0x0B, 0xFC,
-    0x7F, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0x82, 0xFC, 0x0F, 0xC0, 0x7C, 0x0B, 0xF0, 0x3E, 0x00, 0xF0, 0x3F, 0x80, 0xF4, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x2F, 0xC0,
-    0x02, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xFF,
-    0xC3, 0xFF, 0xF0, 0xBF, 0xFF, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0xA8,
-    0x01, 0xFF, 0xFD, 0x07, 0xFE, 0x00, 0xBF, 0xF4, 0x0F, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0x6C, 0x00,
-    0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0x81, 0xF4, 0x00, 0x00, 0x7F, 0x43, 0xE0, 0x00, 0x00, 0xBF,
-    0x0F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFD, 0x2F,
-    0x80, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x0B, 0xF0,
-    0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0x40,
-    0xBF, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x55, 0x54, 0x01, 0xFF, 0xFD, 0x0F, 0xFF, 0xF0, 0x02, 0xFF,
-    0xD0, 0x2F, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0x0F, 0xFC, 0x00, 0x01, 0xFD, 0x01, 0xFF, 0xF0, 0x00, 0x0B, 0xF0, 0x1F, 0xFF, 0x80,
-    0x00, 0x2F, 0xC2, 0xFA, 0xFD, 0x00, 0x00, 0xFF, 0x2F, 0x8B, 0xF0, 0x00, 0x03, 0xFB, 0xF4, 0x3F,
-    0xC0, 0x00, 0x1F, 0xFF, 0x40, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x07, 0xF4, 0x00, 0x03, 0xFF, 0x00,
-    0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xFF,
-    0xD0, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x24, 0x02, 0x80, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x54, 0x3F, 0xFF,
-    0x03, 0xFF, 0xD2, 0xFF, 0xD0, 0x1F, 0xF8, 0x0B, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x2F, 0x40,
-    0x03, 0xF8, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x01, 0xFC, 0x1F, 0x40, 0x00, 0x0F, 0xD3,
-    0xF0, 0x00, 0x00, 0xBE, 0xBC, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0x07, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x54, 0x05, 0x55, 0x40, 0x1F, 0xFF, 0xD3, 0xFF, 0xFC, 0x00, 0xBF, 0xF4, 0x2F, 0xFE, 0x00,
-    0x02, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x00,
-    0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0,
-    0x00, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x03, 0xF8,
-    0x00, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0xBF,
-    0x00, 0x00, 0x7F, 0x95, 0x5F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0,
-    0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x55, 0x55,
-    0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0xF8, 0x00, 0x3F,
-    0x80, 0x3D, 0x00, 0x0F, 0xD0, 0x0E, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xD0, 0xBF, 0xC0, 0x07, 0xF0, 0x0B, 0xF4,
-    0x02, 0xFC, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x7F,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xBA, 0x40, 0x02, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xEF, 0xFC, 0x01, 0x2F, 0xC1, 0xFD, 0x00, 0x3F,
-    0x80, 0xFE, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xFD, 0x1B, 0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC,
-    0x01, 0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x1F, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x3E, 0x00,
-    0x0F, 0xE0, 0x0F, 0x40, 0x07, 0xF4, 0x03, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x03, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x7D,
-    0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0xFF, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x00, 0x0B,
-    0xD0, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0xC0, 0x00, 0x03,
-    0xF0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0xC0, 0x0B, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x07,
-    0xD0, 0x00, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00,
-    0x74, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F,
-    0x00, 0x0F, 0xE0, 0x07, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xE5, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x10, 0x00, 0xFF, 0x00, 0x2D, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x1F, 0xE5, 0x5F, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x29, 0x00, 0x15, 0x54, 0x01, 0xA4, 0x00,
-    0xFF, 0x80, 0xFF, 0xFC, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x2F, 0xFC, 0x00, 0xA7, 0xE0,
-    0x1F, 0x80, 0x7F, 0x68, 0x00, 0x02, 0xF0, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x3F, 0x43,
-    0xF0, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x7F, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC1, 0xFC,
-    0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xF8, 0x0F, 0xE0, 0x00, 0x03, 0xFE, 0x03, 0xF4, 0x07, 0xF4,
-    0x00, 0x0F, 0xF8, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0xF0, 0x2F, 0xFE, 0x02, 0xFF, 0x00, 0x7F,
-    0x80, 0x3F, 0xFE, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xB9,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0xBC, 0x03, 0xFC, 0x02, 0xE0, 0x0B, 0xF0,
-    0x07, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x38, 0x00,
-    0x7F, 0x83, 0xF0, 0x03, 0xFC, 0x0F, 0xF5, 0x7F, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x01, 0x55, 0x50, 0x07, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xC0, 0x0B, 0xFF, 0x40, 0xBF, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x2F, 0xC0,
-    0x7F, 0xFE, 0x00, 0x00, 0xBF, 0x0B, 0xEB, 0xF4, 0x00, 0x03, 0xFC, 0xBE, 0x2F, 0xC0, 0x00, 0x0F,
-    0xEF, 0xD0, 0xFF, 0x00, 0x00, 0x7F, 0xFD, 0x03, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x1F, 0xD0, 0x00,
-    0x0F, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF8, 0x02, 0xFF, 0xFC, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x64, 0x03, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x2D, 0x00, 0x00, 0x00,
-    0x0F, 0xEB, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x55, 0x54, 0x01, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xF0, 0x02, 0xFF, 0xD0, 0x2F, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xFC, 0x00, 0x01, 0xFD, 0x01, 0xFF, 0xF0, 0x00, 0x0B, 0xF0,
-    0x1F, 0xFF, 0x80, 0x00, 0x2F, 0xC2, 0xFA, 0xFD, 0x00, 0x00, 0xFF, 0x2F, 0x8B, 0xF0, 0x00, 0x03,
-    0xFB, 0xF4, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0x40, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x07, 0xF4, 0x00,
-    0x03, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFC,
-    0x00, 0x1F, 0xFF, 0xD0, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x54,
-    0x00, 0xA8, 0x01, 0xFF, 0xFD, 0x07, 0xFE, 0x00, 0xBF, 0xF4, 0x0F, 0xFD, 0x00, 0x2F, 0xC0, 0x3F,
-    0x6C, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0x81, 0xF4, 0x00, 0x00, 0x7F, 0x43, 0xE0, 0x00,
-    0x00, 0xBF, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xFD, 0x2F, 0x80, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x03, 0xFC,
-    0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0x00,
-    0xFF, 0x40, 0xBF, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x55, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xE0,
-    0x3F, 0x80, 0x00, 0x00, 0x7D, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0xFC,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0xFE, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x3F,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x2F, 0xC0, 0x00, 0x00, 0xBC, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x3F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xF4, 0x00, 0x14, 0xBD, 0x00, 0xBF, 0x00, 0x03, 0xFF,
-    0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xE0, 0x03, 0xF8, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x05, 0x55, 0x00, 0x0B, 0xFF, 0xC0, 0x03,
-    0xFF, 0xC0, 0x01, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xEF, 0xD0, 0x7E, 0xFC, 0x00, 0x00, 0xF7, 0xF4, 0x3E, 0x7F,
-    0x00, 0x00, 0xBC, 0xBE, 0x1F, 0x2F, 0x80, 0x00, 0x3F, 0x2F, 0x8F, 0x8B, 0xE0, 0x00, 0x0F, 0x87,
-    0xF7, 0xC2, 0xF8, 0x00, 0x07, 0xC0, 0xFF, 0xD0, 0xFE, 0x00, 0x03, 0xF0, 0x3F, 0xF0, 0x3F, 0x80,
-    0x00, 0xF8, 0x0F, 0xF4, 0x0F, 0xD0, 0x00, 0x7D, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0x7D,
-    0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x1E, 0x00, 0x7F, 0x40, 0x2F, 0xFD, 0x00, 0x01, 0xFF, 0xFC, 0x1F,
-    0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x50, 0x1F, 0xFF, 0xD0, 0xFF,
-    0xFE, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02,
-    0xFC, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00,
-    0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x55,
-    0x5F, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0,
-    0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0xFF,
-    0x43, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0,
-    0xFF, 0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00,
-    0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F,
-    0xC0, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x55, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x40,
-    0x02, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xE0,
-    0x00, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xD0, 0x03, 0xFC,
-    0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7F,
-    0x40, 0x00, 0x7F, 0x80, 0x0B, 0xF4, 0x00, 0x7F, 0xFF, 0x4B, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0xFF,
-    0xFE, 0x00, 0x00, 0x1A, 0xBA, 0x40, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x04,
-    0xBF, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0,
-    0x02, 0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x3F, 0xEF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x07, 0xFE, 0x90, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x6B, 0xA0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0xFC,
-    0x03, 0xFD, 0x00, 0x3E, 0x02, 0xFD, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0D, 0x02, 0xFF, 0x80, 0x1F, 0x80, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xF8, 0x1F, 0xD0,
-    0xBC, 0x7D, 0x0B, 0xF0, 0x2F, 0x0F, 0x03, 0xFC, 0x0F, 0x41, 0x40, 0xFE, 0x01, 0x40, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x55, 0x01,
-    0x55, 0x43, 0xFF, 0xF0, 0x3F, 0xFD, 0x2F, 0xFD, 0x01, 0xFF, 0x80, 0xBF, 0x40, 0x0F, 0xC0, 0x03,
-    0xF4, 0x02, 0xF4, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0xC1, 0xF4,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xEB, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x20, 0x7E, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x6F, 0xE5, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0F, 0xFB, 0xFE, 0xFF, 0x40,
-    0xFF, 0x0F, 0xE0, 0xFF, 0x0B, 0xF0, 0x3F, 0x42, 0xFC, 0x3F, 0x40, 0xFC, 0x07, 0xF1, 0xFD, 0x07,
-    0xF0, 0x2F, 0xC7, 0xF4, 0x2F, 0xC0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0B, 0xF0, 0x2F, 0xE7, 0xF5, 0xFF,
-    0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x55,
-    0x54, 0x05, 0x55, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xC0, 0x0B, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0x7F,
-    0x40, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x3F,
-    0xEF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x4F,
-    0xE0, 0x00, 0x00, 0x2F, 0x82, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x0B,
-    0xF4, 0x00, 0x7F, 0xFD, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x4B, 0xFF, 0xF0, 0x00, 0x00, 0x55, 0x54,
-    0x05, 0x55, 0x40, 0x1F, 0xFF, 0xD3, 0xFF, 0xFC, 0x00, 0xBF, 0xF4, 0x2F, 0xFE, 0x00, 0x02, 0xFC,
-    0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x7F,
-    0x40, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x00, 0x0F,
-    0xF0, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x03, 0xF8, 0x00, 0x02,
-    0xFC, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00,
-    0x7F, 0x95, 0x5F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x05, 0x55, 0x43, 0xFF, 0xF4, 0xFF, 0xFE, 0x2F, 0xFD, 0x0B, 0xFF, 0x80, 0xBF,
-    0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x07, 0xF8,
-    0x00, 0xFE, 0x00, 0x7F, 0x40, 0x0F, 0xF4, 0x0B, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xE0, 0x00, 0x05, 0xA5, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x55, 0x54, 0x15, 0x54, 0x55, 0x54, 0x01, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xFC,
-    0x00, 0xBF, 0xE0, 0xBF, 0xE0, 0xBF, 0xE0, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x3F,
-    0x80, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x3F, 0x40, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0xBF,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0xFD,
-    0x00, 0x00, 0xFE, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0x01,
-    0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x03,
-    0xF8, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x0B, 0xF4, 0x0B,
-    0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x55, 0x54, 0x15, 0x54, 0x55, 0x54, 0x01, 0xFF, 0xFC, 0xFF, 0xF9, 0xFF, 0xFC, 0x00, 0xBF,
-    0xE0, 0xBF, 0xE0, 0xBF, 0xE0, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x3F,
-    0x40, 0x7F, 0x40, 0x00, 0x3F, 0x40, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x00,
-    0xFE, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x02,
-    0xFC, 0x03, 0xFC, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x03,
-    0xF4, 0x00, 0x03, 0xF8, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x0B, 0xF4, 0x0B, 0xF0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x0B, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x7D, 0x0F, 0xE0, 0x00, 0x0F, 0x03, 0xF4,
-    0x00, 0x01, 0x41, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x2F, 0xE0, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0xBF, 0x00,
-    0x3F, 0xC0, 0x2F, 0xC0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x1F, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x05, 0x55, 0x40,
-    0x1F, 0xFF, 0xE0, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0xF4, 0x00, 0x1B, 0xFF, 0x40, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFE,
-    0x40, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x0F, 0xF4, 0x1F, 0xD0,
-    0x00, 0x1F, 0xC0, 0x3F, 0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x3F, 0x83, 0xFC, 0x00, 0x03, 0xF8, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x7F, 0x86, 0xFF, 0x07, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFF, 0x83, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x90, 0xBF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFD, 0x0B,
-    0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x01, 0xFD, 0x03, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x03,
-    0xFC, 0x07, 0xF8, 0x1F, 0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x16, 0xB9, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0xFB, 0xFF, 0x80, 0x0B, 0xC0,
-    0x1F, 0xF0, 0x02, 0xE0, 0x02, 0xFE, 0x00, 0x70, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xAA, 0xAF, 0xF0,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xC0, 0x02, 0xFE, 0x03, 0xF4, 0x01, 0xFF,
-    0x00, 0xFF, 0x97, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x6B, 0xA0, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x00,
-    0x0B, 0xFF, 0x42, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x00, 0x3F, 0xC1,
-    0xFF, 0x00, 0x2F, 0xE0, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xF4, 0x7F, 0x80, 0x00,
-    0xFF, 0x00, 0x1F, 0xC2, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x0F, 0xE5, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0x43, 0xFC,
-    0x00, 0x0B, 0xF4, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x3F, 0xD0, 0x02, 0xFE,
-    0x00, 0x3F, 0x80, 0xBF, 0xC0, 0x1F, 0xF0, 0x01, 0xFE, 0x00, 0xFF, 0xEB, 0xFF, 0x00, 0x7F, 0xFF,
-    0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1F, 0xE0, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x3F,
-    0x40, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x2F, 0xF9, 0xFF, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xE1, 0xFC, 0x00, 0x00,
-    0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x2F, 0x43, 0xFC, 0x00, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x3F, 0xFC,
-    0x07, 0xF8, 0x00, 0x3F, 0xF0, 0x3F, 0xFF, 0x00, 0x3F, 0x80, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F, 0xFF, 0xFD, 0x00, 0xFE, 0x1F,
-    0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x2F, 0xC0,
-    0x3F, 0x40, 0xFF, 0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2, 0x0F, 0xFB, 0xDF, 0xFD, 0x3F,
-    0xFC, 0x3F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF,
-    0x90, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x50, 0x00, 0x2F, 0x6F, 0xF8,
-    0x00, 0xFF, 0xFF, 0xF4, 0x07, 0xFD, 0x1F, 0xE0, 0x2F, 0xD0, 0x2F, 0xC0, 0xFF, 0x00, 0xBF, 0x03,
-    0xF4, 0x02, 0xF8, 0x0F, 0xD0, 0x0F, 0xD0, 0x3F, 0x40, 0x7F, 0x00, 0xFD, 0x03, 0xF8, 0x03, 0xFD,
-    0x7F, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xF0, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0x3F, 0x07, 0xD0,
-    0x2F, 0x43, 0xFA, 0xFF, 0x40, 0xFF, 0xFF, 0xF8, 0x3F, 0x40, 0xBF, 0x1F, 0xC0, 0x1F, 0xC3, 0xF0,
-    0x0F, 0xE0, 0xFE, 0x0B, 0xF0, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x0B, 0xFF, 0x80, 0xFF, 0xFF, 0x87, 0xD0, 0xBE, 0x08, 0x02, 0xF8, 0x00, 0x2F, 0xD0,
-    0x07, 0xFE, 0x00, 0xFF, 0xD0, 0x1F, 0xF4, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x0B, 0x2F, 0xD1, 0xFC,
-    0x3F, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x0B, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0x00, 0x34, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0x01, 0xFE, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0x97, 0xFC, 0x0F, 0xE0, 0x1F, 0xC1,
-    0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x2F, 0x83, 0xF4, 0x03, 0xF4, 0x3F, 0x00, 0x7F, 0x07, 0xF0, 0x0B,
-    0xE0, 0x3F, 0x41, 0xFC, 0x03, 0xFD, 0x7F, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F,
-    0xC0, 0xFC, 0x1F, 0x81, 0xF8, 0x2F, 0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40,
-    0x10, 0x3F, 0x00, 0xB4, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x10, 0x01, 0x40, 0x07, 0xFC, 0x07, 0xC0, 0x7F, 0xC0, 0xBF, 0xFC, 0x3F, 0x07,
-    0xFF, 0x43, 0xEF, 0xF0, 0xF8, 0x3F, 0x6C, 0x0D, 0x0F, 0xCB, 0xD3, 0xE0, 0x00, 0x00, 0x2F, 0x7F,
-    0x2F, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0xDF, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0xBF, 0xBC, 0x00, 0x00, 0x03, 0xD3, 0xF2, 0xF8, 0x2C, 0x1E,
-    0xBE, 0x0F, 0x87, 0xFF, 0xF0, 0xFF, 0xF0, 0x3D, 0x0F, 0xFF, 0x02, 0xFE, 0x01, 0xF0, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xFD,
-    0x07, 0xD0, 0xBE, 0x02, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x2B, 0xF0, 0x00, 0x7F, 0xF0, 0x00,
-    0x16, 0xFC, 0x00, 0x00, 0xFC, 0x1C, 0x00, 0xFC, 0x3F, 0x03, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE, 0x00,
-    0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE, 0x03, 0xF8, 0x03, 0xF4,
-    0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00, 0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F, 0xF1, 0x8F, 0xFB, 0xCF,
-    0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0x74, 0x07, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC, 0x7F, 0xF8, 0x0F, 0xE0, 0x0F,
-    0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xE0, 0x3F, 0x80, 0x3F, 0x40,
-    0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xF0, 0x7F, 0xC0, 0x2F, 0x87, 0xFF, 0x18, 0xFF, 0xBC, 0xFF,
-    0xF3, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x41,
-    0xFF, 0x80, 0xFE, 0x3F, 0xF8, 0x3F, 0xE0, 0x3F, 0x4F, 0xE9, 0x03, 0xF3, 0xF0, 0x00, 0x3F, 0x7C,
-    0x00, 0x07, 0xEF, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFD, 0xBD, 0x00, 0x1F,
-    0xC3, 0xF0, 0x91, 0xFC, 0x3F, 0xFD, 0x2F, 0xC1, 0xFF, 0xC3, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xF1,
-    0xFC, 0x00, 0x07, 0xC2, 0xF8, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x2F, 0x0B,
-    0xE0, 0x00, 0x3E, 0x0F, 0xD0, 0x00, 0x7D, 0x0F, 0xC0, 0x10, 0xFC, 0x1F, 0xC5, 0x3F, 0xF4, 0x1F,
-    0xFE, 0x3F, 0xE0, 0x2F, 0xFD, 0x3F, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x40, 0x00, 0x2F, 0xFC, 0x01, 0xFF, 0x40, 0x1F, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xBF, 0xE0,
-    0xBF, 0xE0, 0x00, 0x2E, 0xFC, 0x3D, 0xF4, 0x00, 0x0F, 0x6F, 0x2D, 0xBC, 0x00, 0x03, 0xCB, 0xDF,
-    0x2F, 0x00, 0x01, 0xF1, 0xFF, 0x4F, 0xC0, 0x00, 0xBC, 0x7F, 0xC3, 0xE0, 0x00, 0x3E, 0x1F, 0xE1,
-    0xF8, 0x00, 0x0F, 0x07, 0xF0, 0x7D, 0x30, 0xFF, 0xC1, 0xF8, 0x2F, 0xFC, 0x3F, 0xD0, 0x3D, 0x0B,
-    0xFD, 0x0F, 0xD0, 0x09, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x7F, 0xE0, 0x0F, 0xC3, 0xFF, 0xC0, 0x7F, 0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xE0, 0x0F,
-    0xC0, 0x3F, 0x40, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x7F, 0x80, 0x3F, 0x40,
-    0xFD, 0x01, 0xFC, 0x03, 0xF0, 0x47, 0xF0, 0x1F, 0xFF, 0x2F, 0x80, 0x7F, 0xF4, 0xFD, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x1F,
-    0xE1, 0xFE, 0x0F, 0xE0, 0x3F, 0xC7, 0xF0, 0x0B, 0xF3, 0xF8, 0x02, 0xFC, 0xFD, 0x00, 0xFE, 0x3F,
-    0x40, 0x3F, 0x5F, 0xD0, 0x1F, 0xC3, 0xF4, 0x0F, 0xD0, 0xFF, 0x5F, 0xF0, 0x1F, 0xFF, 0xE0, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x7F, 0xD0, 0xFF, 0x03, 0xFF, 0x9F,
-    0xFE, 0x00, 0xFE, 0xFB, 0xF8, 0x03, 0xFF, 0x0B, 0xE0, 0x0F, 0xF4, 0x3F, 0x40, 0x7F, 0x80, 0xFC,
-    0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x01, 0xFC, 0x07, 0xF1, 0x47,
-    0xF0, 0x1F, 0xFE, 0x2F, 0xC0, 0xBF, 0xF4, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x40, 0x02, 0xFF, 0x0B, 0xF8, 0x07, 0xFF, 0x6F, 0xFC, 0x00, 0x3F, 0xBE, 0xFD, 0x00,
-    0x3F, 0xE0, 0xFE, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x7F, 0x40, 0xFD, 0x00, 0xBF, 0x00, 0xFC, 0x00,
-    0xFD, 0x02, 0xFC, 0x00, 0xFC, 0x03, 0xF4, 0x01, 0xFC, 0x0B, 0xF0, 0x02, 0xFE, 0x6F, 0xD0, 0x03,
-    0xFF, 0xFF, 0x40, 0x03, 0xFB, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x6A, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF9, 0xBC, 0x0F, 0xE0, 0x10, 0x1F, 0xC0,
-    0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0xB0,
-    0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x10, 0x01, 0xFF, 0x47, 0xF8, 0x1F, 0xE0, 0x3F, 0xF5, 0xFF, 0xCB, 0xFF, 0x00, 0x3F, 0xBE, 0xFE,
-    0xFB, 0xF0, 0x03, 0xFF, 0x0F, 0xF8, 0x7F, 0x00, 0x3F, 0xC1, 0xFF, 0x0B, 0xE0, 0x07, 0xF8, 0x2F,
-    0xD0, 0xFD, 0x00, 0xBF, 0x03, 0xFC, 0x0F, 0xC0, 0x0F, 0xE0, 0x3F, 0x41, 0xFC, 0x00, 0xFD, 0x07,
-    0xF0, 0x2F, 0x80, 0x1F, 0xC0, 0xBF, 0x03, 0xF4, 0x81, 0xFC, 0x0F, 0xE0, 0x3F, 0xFC, 0x2F, 0x80,
-    0xFD, 0x03, 0xFF, 0x83, 0xF4, 0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x0B, 0xFF, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0xFE,
-    0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x07, 0xE1,
-    0xF4, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x38, 0x1F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x01, 0xF8, 0x78, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0x9F, 0xCB,
-    0xF4, 0x0F, 0xE0, 0xFC, 0x3F, 0xC2, 0xF8, 0x0F, 0x81, 0xFC, 0x3F, 0x41, 0xF4, 0x0F, 0xC3, 0xF0,
-    0x2F, 0x41, 0xFC, 0x7F, 0x02, 0xF0, 0x2F, 0xC3, 0xF4, 0x3F, 0x03, 0xF4, 0x3F, 0xC3, 0xF0, 0xFF,
-    0x01, 0xFF, 0x7F, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x04, 0x0F, 0x40, 0x00, 0x02, 0xE7, 0xF0, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0xFD, 0x02,
-    0xFC, 0x0B, 0xFF, 0x0B, 0xFD, 0x05, 0x7F, 0x5F, 0xAC, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0xF4, 0xFF, 0xA4, 0x3F, 0xE0, 0xBF, 0xF4, 0x3F, 0x80, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xF0, 0x7F, 0xF8, 0x0F,
-    0xE0, 0x03, 0xF4, 0x0F, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x07, 0xF0, 0x1F, 0xC0, 0x0B, 0xE0, 0x3F,
-    0x80, 0x0F, 0xD0, 0x3F, 0x40, 0x0F, 0xC0, 0xBF, 0x00, 0x1F, 0xC1, 0xFF, 0x00, 0x2F, 0x87, 0xFF,
-    0x28, 0x3F, 0xEF, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xF4, 0x1F, 0xF0, 0x2E, 0xB4, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0x83, 0xFF, 0x40, 0xFD, 0x00, 0xFC, 0x07, 0xF0,
-    0x03, 0xF0, 0x2F, 0xC0, 0x1F, 0x80, 0xFE, 0x00, 0x7E, 0x07, 0xF4, 0x01, 0xFE, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0x00, 0x01, 0x92, 0xF8, 0x00, 0x00, 0x0F, 0xE2, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x03, 0xF0, 0x2F, 0x47, 0xFF, 0x41, 0xFC, 0x0F, 0xC0, 0x0F, 0xD0, 0xBE, 0x07, 0xF0, 0x03,
-    0xF0, 0x3F, 0x42, 0xF8, 0x01, 0xFC, 0x0F, 0xC0, 0xFD, 0x00, 0xBE, 0x07, 0xF0, 0x3F, 0x00, 0x3F,
-    0x03, 0xF4, 0x2F, 0xC0, 0x0F, 0xC1, 0xFC, 0x0F, 0xE0, 0x07, 0xE0, 0xFF, 0x0B, 0xF8, 0x02, 0xF4,
-    0xBF, 0x87, 0xBD, 0x30, 0xFF, 0xFB, 0xFB, 0xCF, 0xFD, 0x3F, 0xF8, 0xFF, 0xC3, 0xFE, 0x07, 0xF4,
-    0x2F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x03, 0xF0, 0x2F, 0x47, 0xFF, 0x41, 0xFC, 0x0F, 0xC0, 0x0F, 0xD0, 0xBE, 0x07, 0xF0, 0x03, 0xF0,
-    0x3F, 0x42, 0xF8, 0x01, 0xFC, 0x0F, 0xC0, 0xFD, 0x00, 0xBE, 0x07, 0xF0, 0x3F, 0x00, 0x3F, 0x03,
-    0xF4, 0x2F, 0xC0, 0x0F, 0xC1, 0xFC, 0x0F, 0xE0, 0x07, 0xE0, 0xFF, 0x0B, 0xF8, 0x02, 0xF4, 0xBF,
-    0x87, 0xBD, 0x34, 0xFF, 0xFB, 0xFB, 0xDF, 0xFD, 0x3F, 0xF8, 0xFF, 0xC7, 0xFF, 0x07, 0xF4, 0x2F,
-    0x80, 0xF7, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x01, 0x40, 0x00,
-    0x03, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xF4, 0x0B, 0xD0, 0x3D, 0x0B, 0xC0, 0x0B, 0x4F, 0xC0,
-    0x00, 0x0B, 0xFF, 0xE0, 0x07, 0xFB, 0xFE, 0x03, 0xF0, 0x1F, 0xC0, 0xFC, 0x03, 0xF0, 0x3F, 0x01,
-    0xF8, 0x0F, 0xD1, 0xFD, 0x02, 0xFF, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xC7, 0xFF, 0x40, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x02,
-    0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x1F, 0x85, 0x00, 0x3F, 0x40, 0xFF, 0xFF, 0x80, 0xFC, 0x03,
-    0xFE, 0xFF, 0x47, 0xF0, 0x0F, 0xC0, 0xBE, 0x2F, 0x80, 0x7E, 0x01, 0xF8, 0xFD, 0x01, 0xF8, 0x0B,
-    0xD3, 0xF0, 0x47, 0xF0, 0x7F, 0x0F, 0xFF, 0x0F, 0xFF, 0xF0, 0x7F, 0xF4, 0x0F, 0xFE, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xF4, 0x00, 0x03,
-    0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE1, 0x40, 0x0F, 0xFF, 0xF8, 0x0F, 0xFB, 0xFE, 0x0F, 0xC0,
-    0x7F, 0x1F, 0x80, 0x3F, 0x1F, 0x80, 0x7E, 0x1F, 0xC1, 0xFC, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x1F, 0x42, 0xFC,
-    0x03, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xAB, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x25, 0xBF,
-    0x00, 0x00, 0x2F, 0x81, 0xC0, 0x0F, 0xC0, 0xFC, 0x1F, 0xE0, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x05, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0xE0, 0x3F, 0xFC,
-    0x07, 0xFF, 0xF8, 0x03, 0xF8, 0x1F, 0xE7, 0xFC, 0x03, 0xF4, 0x3F, 0x41, 0xFC, 0x03, 0xF0, 0xBE,
-    0x00, 0xFC, 0x07, 0xFA, 0xFD, 0x00, 0xFC, 0x0B, 0xFF, 0xFC, 0x01, 0xFC, 0x0F, 0xFA, 0xFC, 0x02,
-    0xF8, 0x0F, 0xD1, 0xFC, 0x03, 0xF4, 0x1F, 0xC1, 0xFC, 0x0B, 0xF0, 0x1F, 0xC0, 0xFF, 0xBF, 0xC0,
-    0x2F, 0x80, 0xBF, 0xFF, 0x00, 0x3F, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x07, 0xFF, 0xFD, 0x00, 0x3F, 0x43, 0xF0, 0x02, 0xF8,
-    0x1F, 0xC0, 0x0B, 0xD0, 0xBE, 0x00, 0x2F, 0xC2, 0xF4, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0x00, 0x02, 0xF1, 0xF8, 0x00, 0x1F, 0x4B, 0xD3, 0x2F, 0xF8, 0x3F, 0xFC, 0xFF, 0xC0, 0xFF, 0xD2,
-    0xFC, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F, 0x81, 0xF8, 0x2F,
-    0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F, 0x00, 0xB4, 0x3F, 0xEB,
-    0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x47,
-    0xC0, 0x0F, 0xE3, 0xF4, 0x03, 0xF0, 0xFC, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xFC, 0x3F, 0x40, 0xFC, 0x0F, 0xC0, 0x7E, 0x07,
-    0xE0, 0x2F, 0x0B, 0xE0, 0x0F, 0xEF, 0xE0, 0x03, 0xFF, 0x80, 0x01, 0xFD, 0x00, 0x40, 0x3F, 0x00,
-    0xB4, 0x0F, 0xFA, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1A, 0xFF, 0xAE,
-    0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x40, 0x03, 0xF0, 0xFF, 0x00, 0x7F,
-    0x7F, 0xF8, 0x07, 0xEF, 0xBF, 0xC0, 0xBF, 0xC2, 0xFC, 0x0F, 0xF4, 0x1F, 0xC0, 0xFF, 0x01, 0xFC,
-    0x1F, 0xD0, 0x1F, 0xC2, 0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x3F, 0x83, 0xF4, 0x03, 0xF4, 0x7F, 0x00,
-    0x7F, 0x0B, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x06, 0x07, 0xF0, 0x00,
-    0xFE, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x1F, 0x42, 0xF8, 0x08, 0x02,
-    0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x00,
-    0x7F, 0x00, 0xB0, 0xBF, 0x47, 0xF0, 0x3F, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x2F, 0xFC, 0x01, 0xFF, 0xFE, 0x07, 0xF9, 0x7D, 0x0F, 0xD0, 0x04, 0x1F, 0x80,
-    0x00, 0x3F, 0xEB, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0x55, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x78,
-    0x3F, 0xEB, 0xF8, 0x2F, 0xFF, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x2F, 0xFC, 0x00, 0xFF, 0xFD, 0x03, 0xF4, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xF4, 0x08, 0x03, 0xF8, 0x2F, 0x02, 0xF8, 0x3F, 0xD7, 0xF0,
-    0x3F, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xF0,
-    0x03, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x00, 0xFD, 0x00,
-    0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0x88, 0x0F,
-    0xFF, 0x43, 0xFF, 0xC0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xC0, 0xFE,
-    0x3F, 0x43, 0xF0, 0xFC, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xFE, 0x00, 0x3F,
-    0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x88, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00,
-    0x74, 0x3F, 0x40, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF2,
-    0xF4, 0x00, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x40, 0x00, 0x0F, 0x47, 0xFF,
-    0xF8, 0x00, 0x2F, 0x0B, 0xFF, 0xFE, 0x00, 0x3E, 0x0F, 0xC0, 0x7F, 0x00, 0x7D, 0x0F, 0xC0, 0x3F,
-    0x10, 0xFC, 0x0F, 0xC0, 0x7E, 0x3F, 0xF4, 0x0F, 0xD1, 0xFD, 0x3F, 0xE0, 0x0B, 0xFF, 0xF4, 0x3F,
-    0x80, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x3F, 0x40, 0x03, 0xFF, 0xC0, 0xFD, 0x00, 0x00, 0xFE, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x2F, 0xC0,
-    0x00, 0x0F, 0xC0, 0xFD, 0x10, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFB, 0xFC, 0x0F,
-    0xE5, 0xBE, 0x02, 0xF4, 0x3F, 0x42, 0xF8, 0x07, 0xD1, 0xFC, 0x0B, 0xE0, 0x2F, 0x47, 0xF0, 0x1F,
-    0xC2, 0xFC, 0x2F, 0x80, 0x3F, 0xFF, 0xC0, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x1A, 0xFF, 0xAE, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x03,
-    0xF0, 0xBF, 0x40, 0x1F, 0xCF, 0xFF, 0x00, 0x7E, 0xFB, 0xFC, 0x02, 0xFF, 0x0B, 0xE0, 0x0F, 0xF4,
-    0x3F, 0x80, 0x3F, 0xC0, 0xFD, 0x01, 0xFD, 0x07, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x80, 0xFD,
-    0x20, 0xFD, 0x03, 0xFF, 0xC7, 0xF0, 0x0F, 0xFE, 0x2F, 0xC0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x41,
-    0xFF, 0x80, 0xFE, 0x3F, 0xF8, 0x3F, 0xE0, 0x3F, 0x4F, 0xE9, 0x03, 0xF3, 0xF0, 0x00, 0x3F, 0x7C,
-    0x00, 0x07, 0xEF, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFD, 0xBD, 0x00, 0x1F,
-    0xC3, 0xF0, 0x91, 0xFC, 0x3F, 0xFD, 0x2F, 0xC1, 0xFF, 0xC3, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F,
-    0xF4, 0x07, 0xF1, 0xFF, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0,
-    0x1F, 0xC0, 0x2F, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0xC0, 0x1F, 0xC1, 0xFF,
-    0x00, 0xBE, 0x1F, 0xFC, 0x63, 0xFE, 0xF3, 0xFF, 0xCF, 0xFF, 0x0F, 0xFC, 0x1F, 0xF0, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3C, 0x03, 0x80, 0x00, 0x2F, 0x02,
-    0xD0, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0xBF, 0x41, 0xFD, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x0F, 0xE0, 0x00,
-    0x3F, 0x42, 0xF8, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x40,
-    0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0x81, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE, 0x00, 0xFD,
-    0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE, 0x03, 0xF8, 0x03, 0xF4, 0x0F,
-    0xD0, 0x0F, 0xC0, 0xBF, 0x00, 0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F, 0xF1, 0x8F, 0xFB, 0xCF, 0xFF,
-    0x3F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC9, 0xBE, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x40, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x05, 0x5F, 0xF5, 0x50, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x7C, 0x2F, 0xC0, 0xF4, 0x7C, 0x2F, 0xC0, 0xF0, 0x24, 0x3F, 0x80, 0x90, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xFF, 0x1B, 0xFD, 0x00,
-    0xFE, 0x01, 0xFE, 0x00, 0xFD, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFE, 0x02, 0xFC, 0x02, 0xFD, 0x03,
-    0xFC, 0x1B, 0xF8, 0x2F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x01, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x00, 0x03, 0xFF, 0x9F, 0xFD, 0x00, 0x00, 0xFE, 0xFB,
-    0xF4, 0x00, 0x03, 0xFF, 0x0F, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0x04, 0x00, 0x7F, 0x81, 0xFF, 0xFE,
-    0x02, 0xFC, 0x0B, 0xFF, 0xFD, 0x0F, 0xE0, 0x3F, 0x01, 0xF8, 0x3F, 0x40, 0xFC, 0x03, 0xF1, 0xFC,
-    0x03, 0xF0, 0x1F, 0x87, 0xF0, 0x0F, 0xD1, 0xFC, 0x2F, 0xC0, 0x2F, 0xFF, 0xD0, 0xFD, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x00,
-    0x02, 0xFE, 0x1F, 0xE0, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x01, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xD5, 0x55, 0x7F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0x7F, 0x83, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0xFF, 0xE6, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x1F, 0xE1, 0xFE, 0x0F, 0xD0, 0x2F, 0xC7, 0xF0, 0x07,
-    0xF3, 0xFE, 0xAA, 0xFC, 0xFF, 0xFF, 0xFE, 0x3F, 0x55, 0x7F, 0x5F, 0xC0, 0x1F, 0xC3, 0xF0, 0x0F,
-    0xD0, 0xFF, 0x1F, 0xF0, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x00, 0x02, 0xA0, 0x3F, 0xFF, 0x80, 0x0F, 0xFC, 0x2F, 0xFD, 0x00, 0x3F, 0xFC, 0x0B, 0xF0, 0x00,
-    0xBF, 0xB4, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x02, 0xF4, 0x00, 0x03, 0xF8, 0x03, 0xF0,
-    0x00, 0x03, 0xF8, 0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x1F, 0x40, 0x00,
-    0x01, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00,
-    0xBE, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x04, 0x2F, 0xF8, 0x00, 0xFE, 0x3F, 0xFC, 0x03, 0xFF, 0x03, 0xFC, 0x0B, 0xFA, 0x02, 0xFC, 0x1F,
-    0x80, 0x02, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0xBC, 0x00, 0x01, 0xFC, 0xF4, 0x00, 0x01, 0xFE, 0xE0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x64, 0x03, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x2D, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x00, 0x55, 0x54, 0x01, 0xFF, 0xFD, 0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0xD0,
-    0x2F, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0x80, 0x0F, 0xFC, 0x00, 0x01, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0x0B, 0xF0, 0x1F, 0xFF, 0x80, 0x00,
-    0x2F, 0xC2, 0xFA, 0xFD, 0x00, 0x00, 0xFF, 0x2F, 0x8B, 0xF0, 0x00, 0x03, 0xFB, 0xF4, 0x3F, 0xC0,
-    0x00, 0x1F, 0xFF, 0x40, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x07, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x2F,
-    0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xD0,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x74, 0x07, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC, 0x7F, 0xF8, 0x0F, 0xE0, 0x0F, 0xD0,
-    0x3F, 0x40, 0x3F, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD,
-    0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xF0, 0x7F, 0xC0, 0x2F, 0x87, 0xFF, 0x38, 0xFF, 0xBC, 0xFF, 0xE3,
-    0xFF, 0xC3, 0xFF, 0x87, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x55, 0x54, 0x00, 0x01, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0x7F, 0xD5, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFD, 0x0B, 0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x01, 0xFD, 0x03, 0xFC,
-    0x01, 0xFC, 0x03, 0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x1F, 0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB4, 0x00, 0xBF, 0xF0, 0x02, 0xBF, 0x80, 0x00, 0xBD,
-    0x00, 0x03, 0xF0, 0x02, 0xFF, 0xFE, 0x06, 0xFF, 0xA0, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
-    0x14, 0x02, 0xFF, 0xFE, 0x0F, 0xFB, 0xFE, 0x3F, 0x01, 0xFD, 0xF8, 0x03, 0xF7, 0xE0, 0x1F, 0x9F,
-    0xC1, 0xFC, 0x3F, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBA, 0x40, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x04, 0xBF, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0xBF,
-    0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x07, 0xF4, 0x47, 0xF0, 0x02, 0xFC, 0xB2, 0xF8, 0x00, 0xBF, 0x1F,
-    0xFC, 0x00, 0x3F, 0xDB, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x9F, 0x00, 0x02, 0xFC,
-    0x02, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x02, 0xFF, 0x0B, 0xF8,
-    0x07, 0xFF, 0x6F, 0xFC, 0x00, 0x3F, 0xBE, 0xFD, 0x00, 0x3F, 0xE0, 0xFE, 0x00, 0x3F, 0xC0, 0xFE,
-    0x00, 0x7F, 0x40, 0xFD, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0xFD, 0x11, 0xFC, 0x00, 0xFC, 0xB2, 0xF4,
-    0x01, 0xFC, 0x7B, 0xF0, 0x02, 0xFD, 0x3F, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFB, 0xFF, 0x00,
-    0x07, 0xF0, 0x0B, 0x40, 0x07, 0xF0, 0x03, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x6A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x01, 0xF4, 0x01, 0x55, 0x55, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x07,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x5B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x0B,
-    0xBF, 0x40, 0x03, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x3F,
-    0xC0, 0x3E, 0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x07, 0xF4, 0x02, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x05,
-    0xFF, 0x54, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0B, 0xFF, 0x81,
-    0xFF, 0xFF, 0x8B, 0x90, 0xBE, 0x04, 0x02, 0xF8, 0x0A, 0x1F, 0xC0, 0x2F, 0xFD, 0x00, 0xFF, 0x80,
-    0x1F, 0xFC, 0x00, 0xFD, 0x38, 0x07, 0xF0, 0x07, 0x2F, 0xD1, 0xBD, 0x3F, 0xFF, 0xE0, 0x7F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0x01, 0xF8, 0x00, 0x3F, 0xC0, 0x7D, 0x00, 0x0F, 0xE0, 0x1E, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x02, 0xFC, 0x10, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F,
-    0xE0, 0x7F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x80,
-    0x3F, 0x80, 0x0F, 0xE0, 0x1F, 0xE0, 0x07, 0xF4, 0x7F, 0xFF, 0x01, 0xFC, 0x2F, 0xFF, 0xC0, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3D, 0x7F, 0xC0, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF,
-    0xC0, 0x3F, 0x41, 0xF0, 0x0F, 0xC0, 0x38, 0x03, 0xF0, 0x04, 0x01, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xF4, 0x0F, 0xC0, 0xFF, 0x07, 0xF0, 0x1F, 0xC2, 0xF8, 0x03, 0xF0, 0xFD, 0x00,
-    0xFC, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x08, 0x07, 0xF0, 0x0B, 0xEB,
-    0xF0, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x29, 0x00, 0x15, 0x54, 0x01, 0xA4, 0x00,
-    0xFF, 0x80, 0xFF, 0xFC, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x2F, 0xFC, 0x00, 0xA7, 0xE0,
-    0x1F, 0x80, 0x7F, 0x68, 0x00, 0x02, 0xF0, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x3F, 0x43,
-    0xF0, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x7F, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC1, 0xFC,
-    0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xF8, 0x0F, 0xE0, 0x00, 0x03, 0xFE, 0x03, 0xF4, 0x07, 0xF4,
-    0x00, 0x0F, 0xF8, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0xF0, 0x2F, 0xFE, 0x02, 0xFF, 0x00, 0x7F,
-    0x80, 0x3F, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x10, 0x01, 0x40, 0x07, 0xFC, 0x07, 0xC0, 0x7F, 0xC0, 0xBF, 0xFC, 0x3F, 0x07,
-    0xFF, 0x43, 0xEF, 0xF0, 0xF8, 0x3F, 0x6C, 0x0D, 0x0F, 0xCB, 0xD3, 0xE0, 0x00, 0x00, 0x2F, 0x7F,
-    0x2F, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0xDF, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0xBF, 0xBC, 0x00, 0x00, 0x03, 0xD3, 0xF2, 0xF8, 0x2C, 0x1E,
-    0xBE, 0x0F, 0x87, 0xFF, 0xF0, 0xFF, 0xF0, 0x3D, 0x0F, 0xFF, 0x82, 0xFE, 0x01, 0xF0, 0x1F, 0xDE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x06,
-    0xB9, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0xBC, 0x03, 0xFC, 0x02, 0xE0, 0x0B,
-    0xF0, 0x07, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x38,
-    0x00, 0x7F, 0x83, 0xF0, 0x03, 0xFC, 0x0F, 0xF5, 0x7F, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x02, 0x5F, 0x40, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xBF, 0xF8, 0x03, 0xFF,
-    0xFD, 0x07, 0xD0, 0xBE, 0x02, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x2B, 0xF0, 0x00, 0x7F, 0xF0,
-    0x00, 0x16, 0xFC, 0x00, 0x00, 0xFC, 0x1C, 0x00, 0xFC, 0x3F, 0x03, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F,
-    0xFF, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0xBC, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0x90,
-    0x00, 0x00, 0x55, 0x54, 0x00, 0xA4, 0x01, 0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0xBF, 0xF4, 0x2F, 0xFC,
-    0x00, 0x2F, 0xC0, 0x7F, 0x68, 0x00, 0x3F, 0xC0, 0xF8, 0x00, 0x00, 0x3F, 0x82, 0xF0, 0x00, 0x00,
-    0x7F, 0x47, 0xD0, 0x00, 0x00, 0xBF, 0x0F, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0F,
-    0xE0, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x02, 0xFD,
-    0x00, 0x7F, 0xFF, 0x00, 0xFF, 0x40, 0xBF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x41, 0xFF, 0x80, 0xFE,
-    0x3F, 0xF8, 0x3F, 0xE0, 0x3F, 0x4F, 0xE9, 0x03, 0xF3, 0xF0, 0x00, 0x3F, 0x7C, 0x00, 0x07, 0xEF,
-    0x40, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFD, 0xBD, 0x00, 0x1F, 0xC3, 0xF0, 0x91,
-    0xFC, 0x3F, 0xFE, 0x2F, 0xC1, 0xFF, 0xD3, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x55, 0x54, 0x00,
-    0x2A, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xD0, 0x0B, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0xBF, 0x00, 0x3F,
-    0x6C, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0x0F, 0xDA, 0x2F, 0x00, 0x00, 0x07, 0xF3, 0x8F, 0x40,
-    0x00, 0x02, 0xFC, 0xDB, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x00, 0x0F, 0xDB, 0x7F, 0x00, 0x00, 0x07, 0xF3, 0x8F, 0xD0, 0x00, 0x02, 0xFC, 0xE2, 0xFC, 0x00,
-    0x00, 0xFE, 0x10, 0x7F, 0x40, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x02, 0xFE, 0x00,
-    0x7F, 0xFF, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x1F, 0xF4, 0x00, 0xFD, 0x3F, 0xF8, 0x03, 0xFD, 0x03, 0xF4, 0x0B, 0xEC,
-    0x03, 0xF5, 0x1F, 0x00, 0x03, 0xF7, 0x3C, 0x00, 0x07, 0xFB, 0xB4, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x0F, 0xDD, 0xBC, 0x00, 0x0F, 0xDD, 0x7D, 0x00, 0x1F, 0xC4, 0x3F, 0x0C, 0x1F, 0xC0, 0x3F, 0xFC,
-    0x2F, 0x80, 0x1F, 0xF8, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00,
-    0xA8, 0x01, 0xFF, 0xFD, 0x07, 0xFE, 0x00, 0xBF, 0xF4, 0x0F, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0x6C,
-    0x01, 0x7F, 0xD0, 0xBC, 0x00, 0x07, 0xFF, 0xF5, 0xF4, 0x00, 0x00, 0x7F, 0x43, 0xE0, 0x00, 0x00,
-    0xBF, 0x0B, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFD,
-    0x2F, 0x80, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x0B,
-    0xF0, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0x00, 0xFF,
-    0x40, 0xBF, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x10,
-    0x3F, 0xFF, 0x0F, 0xD2, 0xBF, 0x93, 0xFD, 0x03, 0xF0, 0xFE, 0xC0, 0x7E, 0x3E, 0x00, 0x0B, 0xDB,
-    0x80, 0x00, 0xBD, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFE, 0xF8, 0x00, 0x1F, 0xCF, 0xC0, 0x02,
-    0xFC, 0xBE, 0x0C, 0x3F, 0x83, 0xFF, 0xC3, 0xF4, 0x2F, 0xF8, 0x7F, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x55, 0x00, 0x2A, 0x0B, 0xFF, 0xFF, 0xD0, 0x7F, 0xE3, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xF4, 0xF8, 0x2F, 0xC0, 0x3F, 0x6C, 0x7D, 0x0F, 0xE0, 0x3F, 0x00, 0x0F, 0x03, 0xF8, 0x2F, 0x40,
-    0x01, 0x41, 0xFD, 0x0F, 0x40, 0x00, 0x00, 0xBF, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00,
-    0x00, 0xBF, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00,
-    0x07, 0xF8, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x7F, 0xD0, 0x0F, 0xFF, 0xF0, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x04, 0x0F, 0xFF, 0xC0, 0xFE, 0x3F, 0xFF, 0x83,
-    0xFF, 0x3C, 0x1F, 0x4F, 0xE9, 0x3D, 0x3F, 0x2F, 0x00, 0x2D, 0x3F, 0x7C, 0x00, 0x00, 0x7E, 0xF4,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC, 0x3F,
-    0x09, 0x01, 0xFC, 0x2F, 0xFD, 0x02, 0xFC, 0x1F, 0xFC, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x50, 0x1F, 0xFF, 0xD0, 0xFF, 0xFE, 0x00, 0xBF, 0xF4, 0x0B,
-    0xFF, 0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00,
-    0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x55, 0x5F, 0xF0, 0x00, 0x1F, 0xD0,
-    0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xF0, 0x3F, 0xFC, 0x07,
-    0xF0, 0x03, 0xF8, 0x0B, 0xF0, 0x03, 0xF4, 0x0F, 0xE0, 0x03, 0xF0, 0x0F, 0xD0, 0x07, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xE5, 0x7F, 0x80, 0x0F, 0xD0, 0x3F, 0x40, 0x1F, 0xC0, 0x3F,
-    0x1C, 0x1F, 0xC0, 0x7F, 0xFC, 0x2F, 0x80, 0x7F, 0xF8, 0x3F, 0x40, 0x3F, 0x78, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x55, 0x54, 0x05, 0x55, 0x55, 0x40, 0x1F, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0xFC, 0x00, 0x3F, 0xC0, 0x02, 0xFC,
-    0x0F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0xF4, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x04, 0x00, 0x0B,
-    0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0xFE, 0x55, 0x5F, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xF0, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xFF, 0xD3,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0xFE, 0x02, 0xFC, 0x2F, 0x03, 0xF4, 0x0F, 0xE1, 0xF8, 0x0F, 0xC0,
-    0x3F, 0x4F, 0x80, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE5, 0x7F, 0x80,
-    0x00, 0x3F, 0x40, 0xFD, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x40, 0x07, 0xF0, 0x1F, 0xFF, 0x00, 0x2F,
-    0x80, 0x7F, 0xF4, 0x00, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xFD,
-    0x10, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFE, 0x00, 0x3F, 0x81, 0xFF, 0x80, 0x1F, 0xD0, 0x07, 0xF4, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x7F,
-    0x40, 0x2F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xC0,
-    0x7F, 0x80, 0x0F, 0xE0, 0x02, 0xFC, 0x7F, 0xFE, 0x07, 0xFF, 0xD0, 0x3F, 0x8B, 0xFF, 0xE0, 0xFF,
-    0xFC, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0x9B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x1F,
-    0xF4, 0x3F, 0xD0, 0x00, 0x3F, 0xF9, 0xFF, 0xE0, 0x00, 0x03, 0xFB, 0xEF, 0xE0, 0x00, 0x03, 0xFF,
-    0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x07, 0xF8, 0x1F, 0xFF, 0xF0, 0x0B, 0xF0, 0x2F,
-    0xFF, 0xFC, 0x0F, 0xE0, 0x2F, 0xC1, 0xFD, 0x0F, 0xD0, 0x3F, 0x80, 0xBF, 0x1F, 0xC0, 0x3F, 0x40,
-    0x7F, 0x1F, 0xC0, 0x7F, 0x00, 0x3F, 0x2F, 0x80, 0xBF, 0x00, 0x7F, 0x3F, 0x40, 0xFE, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x05, 0x03, 0xF4, 0x00,
-    0x00, 0x1F, 0xAF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x6A, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xA4, 0x00, 0x0B, 0xFC,
-    0x07, 0xFF, 0xD0, 0x07, 0xF8, 0x0B, 0xFB, 0xFC, 0x03, 0xFC, 0x03, 0xF0, 0x3F, 0x41, 0xFD, 0x03,
-    0xF4, 0x0B, 0xE0, 0xBF, 0x00, 0xFC, 0x03, 0xF8, 0x3F, 0xC0, 0x7F, 0x00, 0xFD, 0x0F, 0xE0, 0x2F,
-    0xC0, 0x3F, 0x03, 0xF8, 0x0B, 0xE0, 0x1F, 0xC0, 0xFE, 0x02, 0xF8, 0x0F, 0xE0, 0x3F, 0xC0, 0x7F,
-    0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xC3, 0xF4, 0x01, 0xFF, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xF9, 0xBF,
-    0xF4, 0x08, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFD, 0x06, 0x80, 0x07, 0xE0,
-    0x7F, 0xF4, 0x0F, 0xC0, 0xF9, 0xFC, 0x2F, 0x43, 0xF0, 0xBC, 0x3F, 0x03, 0xD0, 0xBC, 0x3F, 0x07,
-    0xD0, 0xFC, 0x3F, 0x07, 0xC0, 0xF8, 0x3F, 0x07, 0xD2, 0xF0, 0x3F, 0x43, 0xE7, 0xD0, 0x2F, 0xC2,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x5D, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x6B, 0xA0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0xFC, 0x03,
-    0xFD, 0x00, 0x3E, 0x02, 0xFD, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0D, 0x02, 0xFF, 0x80, 0x1F, 0x80, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x97, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF9, 0xBC,
-    0x0F, 0xE0, 0x10, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x40, 0x00, 0x3F, 0x80, 0xB0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0A, 0x40, 0x00, 0x05, 0x55, 0x55,
-    0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xF8, 0x1F, 0xD0, 0xBC, 0x7D, 0x0B,
-    0xF0, 0x2F, 0x0F, 0x03, 0xFC, 0x0F, 0x41, 0x40, 0xFE, 0x01, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0xFF, 0x47, 0xF8, 0x1F, 0xE0, 0x3F, 0xF5,
-    0xFF, 0xCB, 0xFF, 0x00, 0x3F, 0xBE, 0xFE, 0xFB, 0xF0, 0x03, 0xFF, 0x0F, 0xF8, 0x7F, 0x00, 0x3F,
-    0xC1, 0xFF, 0x0B, 0xE0, 0x07, 0xF8, 0x2F, 0xD0, 0xFD, 0x00, 0xBF, 0x03, 0xFC, 0x0F, 0xC0, 0x0F,
-    0xE0, 0x3F, 0x41, 0xFC, 0x00, 0xFD, 0x07, 0xF0, 0x2F, 0x80, 0x1F, 0xC0, 0xBF, 0x03, 0xF4, 0xD1,
-    0xFC, 0x0F, 0xE0, 0x3F, 0xFD, 0x2F, 0x80, 0xFD, 0x03, 0xFF, 0xC3, 0xF4, 0x0F, 0xC0, 0x3F, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x15, 0x55, 0x01, 0x55,
-    0x47, 0xFF, 0xF0, 0xFF, 0xFC, 0x3F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xF0,
-    0x0B, 0xE0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x00, 0x1F, 0xCB, 0xD0, 0x00,
-    0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x0B, 0xF4, 0x1F, 0xDB, 0xFF, 0x03, 0xF8, 0x6F, 0xC0, 0xFE, 0x03, 0xF4, 0x2F, 0x40, 0xFD, 0x0F,
-    0xC0, 0x2F, 0x83, 0xE0, 0x07, 0xE1, 0xF0, 0x01, 0xF8, 0xF8, 0x00, 0x3E, 0xBC, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x01, 0xAA, 0xA4, 0x00, 0x15, 0x55,
-    0x01, 0x55, 0x47, 0xFF, 0xF0, 0xFF, 0xFC, 0x3F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x40,
-    0x0B, 0xF0, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x00, 0x1F, 0xCB,
-    0xD0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x05, 0xBF, 0xE5, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x0B, 0xF4, 0x1F, 0xDB, 0xFF, 0x03, 0xF8, 0x6F, 0xC0, 0xFE, 0x03, 0xF4, 0x2F, 0x40,
-    0xFD, 0x0F, 0xC0, 0x2F, 0x83, 0xE0, 0x07, 0xE1, 0xF0, 0x01, 0xF8, 0xF8, 0x00, 0x3E, 0xBC, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x15, 0xFF, 0x50, 0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-    0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x01, 0xAA, 0xA4, 0x00,
-    0x00, 0x55, 0x54, 0x05, 0x55, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xC0, 0x0B, 0xFE, 0x01, 0xFF, 0x80,
-    0x00, 0x7F, 0x40, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x3F, 0x40, 0x00,
-    0x00, 0x3F, 0xEF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0x4F, 0xE0, 0x00, 0x00, 0x2F, 0x82, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x1F,
-    0xC0, 0x0B, 0xF4, 0x00, 0x7F, 0xFD, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x4B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x02, 0xFD, 0x02, 0xFC, 0x0B, 0xFF, 0x0B, 0xFD, 0x05, 0x7F, 0x5F, 0xAC, 0x00, 0x3F,
-    0xBD, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x34, 0x3F, 0xF4, 0xFF, 0xF4, 0x3F, 0xE0,
-    0xBF, 0xF0, 0x3F, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x01, 0x55, 0x55, 0x40, 0x55, 0x50,
-    0x2F, 0xFF, 0xFF, 0x8B, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x03, 0xD3, 0xF4, 0xF0, 0x2F,
-    0xC0, 0x1F, 0x1F, 0xC3, 0xC0, 0xBF, 0x00, 0x38, 0xBF, 0x1D, 0x03, 0xF8, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00,
-    0x00, 0xBF, 0x55, 0x57, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x15, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xF0, 0x7F, 0xF8, 0x0F, 0xE0,
-    0x03, 0xF4, 0x0F, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x07, 0xF0, 0x1F, 0xC0, 0x0B, 0xE0, 0x3F, 0x80,
-    0x0F, 0xD0, 0x3F, 0x40, 0x0F, 0xC0, 0xBF, 0x00, 0x1F, 0xC1, 0xFF, 0x00, 0x2F, 0x87, 0xFF, 0x28,
-    0x3F, 0xEF, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xF4, 0x1F, 0xF0, 0x2E, 0xB4, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0x80,
-    0x15, 0x55, 0x05, 0x55, 0x43, 0xFF, 0xF4, 0xFF, 0xFE, 0x2F, 0xFD, 0x0B, 0xFF, 0x80, 0xBF, 0x00,
-    0x2F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x07, 0xF4, 0x00,
-    0xFE, 0x00, 0x7F, 0x40, 0x0F, 0xF4, 0x0B, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x05, 0xA5, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x2F, 0x83, 0xFF, 0x40, 0xFD, 0x00, 0xFC, 0x07, 0xF0, 0x03, 0xF0, 0x2F, 0xC0, 0x1F,
-    0x80, 0xFE, 0x00, 0x7E, 0x07, 0xF4, 0x01, 0xFE, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0x92,
-    0xF8, 0x00, 0x00, 0x0F, 0xE3, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xF7,
-    0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x01, 0xF4, 0x00, 0x15, 0x55, 0x01, 0x55, 0x53, 0xFF, 0xF4, 0xFF, 0xFE, 0x2F, 0xFD, 0x0B,
-    0xFF, 0x80, 0xBF, 0x00, 0x1F, 0xD0, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x0F,
-    0xE1, 0xC3, 0xF8, 0x00, 0xFE, 0x2C, 0x7F, 0x80, 0x0F, 0xF3, 0xC7, 0xF4, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xF9, 0xFE, 0x00, 0x00, 0x0B, 0x1F, 0xD0, 0x00, 0x00,
-    0xF2, 0xFD, 0x00, 0x00, 0x04, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xC3, 0xFF, 0x00, 0xFE,
-    0x00, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x1F, 0xC0, 0x1F, 0x88, 0x7F, 0x00, 0x7E, 0x72, 0xF8, 0x01,
-    0xFE, 0xEF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xB9, 0xFC, 0x00, 0x00, 0xDB, 0xF1, 0x00, 0x02,
-    0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x54, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xFB,
-    0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0F, 0xF9, 0x6F, 0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x40,
-    0x1F, 0xD0, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x00,
-    0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x7F, 0xFF, 0x0F, 0xFF, 0xCB, 0xFF, 0xF2, 0xFF, 0xFC, 0x00,
-    0x14, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x40, 0x00, 0xFD, 0x2F, 0xE0, 0x03, 0xF3, 0xFF,
-    0xC0, 0x1F, 0xEE, 0xBF, 0x00, 0x7F, 0xE1, 0xFC, 0x02, 0xFE, 0x0B, 0xF0, 0x0F, 0xF0, 0x3F, 0x80,
-    0x3F, 0x80, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x80, 0xFD, 0x20, 0xFD,
-    0x03, 0xFF, 0xC7, 0xF0, 0x0F, 0xFE, 0x2F, 0xC0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6E, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x06, 0x81, 0xFE,
-    0x02, 0xFE, 0x2F, 0x07, 0xF8, 0x00, 0xFF, 0x3E, 0x0F, 0xF0, 0x00, 0xFE, 0x3E, 0x1F, 0xD0, 0x00,
-    0xFE, 0x3F, 0x7F, 0xC0, 0x01, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x70, 0x00, 0x3F, 0xE0, 0x03, 0xF0, 0x00, 0x2F, 0xFE, 0xBF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF0, 0xFD, 0x18, 0x3F, 0x03, 0xF1,
-    0xF1, 0xF8, 0x1F, 0x8B, 0x8B, 0xC2, 0xF8, 0x1F, 0x7F, 0xBF, 0x80, 0x3F, 0xFF, 0xE0, 0x00, 0x1F,
-    0xF4, 0x01, 0x00, 0x0F, 0xC0, 0x2D, 0x00, 0x3F, 0xEB, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x06, 0x81, 0xFE, 0x02, 0xFE, 0x2F, 0x07, 0xF8, 0x00, 0xFF, 0x3E,
-    0x0F, 0xF0, 0x00, 0xFE, 0x3E, 0x1F, 0xD0, 0x00, 0xFE, 0x3F, 0x7F, 0xC0, 0x01, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x70, 0x00, 0x3F, 0xE0, 0x03,
-    0xF0, 0x00, 0x2F, 0xFE, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF0, 0xFD, 0x18, 0x3F, 0x03,
-    0xF1, 0xF1, 0xF8, 0x1F, 0x8B, 0x8B, 0xC2, 0xF8, 0x1F, 0x7F, 0xBF, 0x80, 0x3F, 0xFF, 0xE0, 0x00,
-    0x1F, 0xF4, 0x01, 0x00, 0x0F, 0xC0, 0x2D, 0x00, 0x3F, 0xEB, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0xBF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x15, 0x54, 0x01, 0xA4, 0x00, 0x3F, 0xD0, 0x3F, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xFC,
-    0x0B, 0xFE, 0x02, 0xFF, 0xC0, 0x02, 0x5F, 0x80, 0xBE, 0x01, 0xFD, 0xA0, 0x00, 0x02, 0xF0, 0x2F,
-    0x40, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0xBC,
-    0x00, 0x00, 0x00, 0x02, 0xF1, 0xFC, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0xC3, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x83, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xD0,
-    0xBE, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0x40, 0xBF, 0x40, 0x00, 0x7F, 0xE0, 0x0F, 0xD0,
-    0x0F, 0xF0, 0x00, 0xBF, 0xF0, 0x2F, 0xFE, 0x02, 0xFF, 0x00, 0x1F, 0xE0, 0x0F, 0xFF, 0x80, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x2C, 0x02, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x1E, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x00,
-    0x14, 0x00, 0x7F, 0xC0, 0x7C, 0x07, 0xFC, 0x0B, 0xFF, 0xC3, 0xF0, 0x7F, 0xF4, 0x3E, 0xFF, 0x0F,
-    0x83, 0xF6, 0xC0, 0xD0, 0xFC, 0xBD, 0x3E, 0x00, 0x00, 0x02, 0xF7, 0xF2, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0xDF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xF0, 0x00, 0x00,
-    0x07, 0xCB, 0xFB, 0xC0, 0x00, 0x00, 0x3D, 0x3F, 0x2F, 0x82, 0xC1, 0xEB, 0xE0, 0xF8, 0x7F, 0xFF,
-    0x0F, 0xFF, 0x03, 0xD0, 0xFF, 0xF0, 0x2F, 0xE0, 0x1F, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0xA8, 0x01, 0xFF, 0xFD, 0x07, 0xFE, 0x00, 0xBF, 0xF4, 0x0F,
-    0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0x6C, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0x81, 0xF4, 0x00,
-    0x00, 0x7F, 0x43, 0xE0, 0x00, 0x00, 0xBF, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x01, 0xFD, 0x01, 0xFF, 0x00, 0x02, 0xFC,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x07, 0xF8, 0x00,
-    0xBF, 0x00, 0x7F, 0xFF, 0x00, 0xFE, 0x00, 0xBF, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x04, 0x07, 0xF4, 0x00, 0x00, 0x2E, 0x6F, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFF, 0x80,
-    0xBE, 0x3F, 0xF8, 0x2F, 0xF0, 0x3F, 0x87, 0xE9, 0x03, 0xF4, 0xF8, 0x00, 0x3F, 0x1F, 0x00, 0x07,
-    0xF3, 0xD0, 0x00, 0xBF, 0xFF, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0xFD, 0x0B, 0xF0, 0x1F, 0xC0, 0x3F,
-    0x41, 0xFC, 0x03, 0xF4, 0x2F, 0x80, 0x3F, 0x43, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x07, 0xE0, 0x01, 0x40, 0xFC, 0x00, 0x3E, 0xBF, 0x40, 0x07, 0xFF, 0xD0, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x01, 0x55, 0x55, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x03, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x7D, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0xBF,
-    0x00, 0x00, 0x00, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0xFE, 0x00, 0x00, 0x01, 0xF0, 0x1F,
-    0xD0, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x2F, 0xC0, 0x00, 0x00, 0xBC, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xF4, 0x00, 0x14, 0xBD, 0x00,
-    0xBF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xF0, 0x03, 0xF8, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x07, 0xC2, 0xF8, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0xF4,
-    0x3F, 0x00, 0x00, 0xBC, 0x2F, 0x80, 0x00, 0x3E, 0x0F, 0xD0, 0x00, 0x1F, 0x43, 0xF0, 0x01, 0x0F,
-    0xC1, 0xFC, 0xB0, 0xFF, 0xD0, 0x7F, 0xFC, 0x3F, 0xE0, 0x2F, 0xFF, 0x0F, 0xE0, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x50, 0x1F, 0xFF, 0xD0, 0xFF, 0xFE,
-    0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC,
-    0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x7F,
-    0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x55, 0x5F,
-    0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x40,
-    0x3F, 0x80, 0x0B, 0xFF, 0xF0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7F, 0xE0, 0x0F,
-    0xC3, 0xFF, 0xC0, 0x7F, 0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xE0, 0x0F, 0xC0, 0x3F, 0x40,
-    0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x7F, 0x80, 0x3F, 0x40, 0xFE, 0x01, 0xFC,
-    0x03, 0xF4, 0x07, 0xF0, 0x1F, 0xC0, 0x2F, 0x80, 0xBF, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x42, 0xF4, 0x00, 0x1F, 0xAF, 0xC0, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x6F, 0x80, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x50, 0x1F, 0xFF, 0xD0, 0xFF, 0xFE, 0x00,
-    0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00,
-    0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x40,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x55, 0x5F, 0xF0,
-    0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x43, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xF0,
-    0x3F, 0xFC, 0x07, 0xF0, 0x03, 0xF8, 0x0B, 0xF0, 0x03, 0xF4, 0x0F, 0xE0, 0x03, 0xF0, 0x0F, 0xD0,
-    0x07, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xE5, 0x7F, 0x80, 0x0F, 0xD0, 0x3F, 0x40,
-    0x1F, 0xC0, 0x3F, 0x2C, 0x1F, 0xC0, 0x7F, 0xFC, 0x2F, 0x80, 0x7F, 0xFC, 0x3F, 0x40, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x15, 0x55, 0x05, 0x55, 0x43, 0xFF, 0xF4, 0xFF, 0xFE, 0x2F, 0xFD, 0x0B,
-    0xFF, 0x80, 0xBF, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
-    0xE0, 0x07, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x0F, 0xF4, 0x0B, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0xA5, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0xBE, 0x3F, 0xF4, 0x0F, 0xD0, 0x3F, 0x01, 0xFC, 0x03, 0xF0,
-    0x2F, 0xC0, 0x7E, 0x03, 0xF8, 0x07, 0xE0, 0x7F, 0x40, 0x7F, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0x00,
-    0x06, 0x4B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x05, 0x55, 0x00, 0x0B, 0xFF, 0xC0, 0x03, 0xFF, 0xC0,
-    0x01, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00,
-    0xFF, 0xF0, 0x00, 0x03, 0xEF, 0xD0, 0x7E, 0xFC, 0x00, 0x00, 0xF7, 0xF4, 0x3E, 0x7F, 0x00, 0x00,
-    0xBC, 0xBE, 0x1F, 0x2F, 0x80, 0x00, 0x3F, 0x2F, 0x8F, 0x8B, 0xE0, 0x00, 0x0F, 0x87, 0xF7, 0xC2,
-    0xF8, 0x00, 0x07, 0xC0, 0xFF, 0xD0, 0xFE, 0x00, 0x03, 0xF0, 0x3F, 0xF0, 0x3F, 0x80, 0x00, 0xF8,
-    0x0F, 0xF4, 0x0F, 0xD0, 0x00, 0x7D, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0xFD,
-    0x00, 0x0F, 0xC0, 0x1E, 0x00, 0x7F, 0x40, 0x2F, 0xFD, 0x00, 0x01, 0xFF, 0xFE, 0x1F, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x2F,
-    0xFC, 0x01, 0xFF, 0x40, 0x1F, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0xBF, 0xE0, 0x00, 0x2E,
-    0xFC, 0x3D, 0xF4, 0x00, 0x0F, 0x6F, 0x2D, 0xBC, 0x00, 0x03, 0xCB, 0xDF, 0x2F, 0x00, 0x01, 0xF1,
-    0xFF, 0x4F, 0xC0, 0x00, 0xBC, 0x7F, 0xC3, 0xE0, 0x00, 0x3E, 0x1F, 0xE1, 0xF8, 0x00, 0x0F, 0x07,
-    0xF0, 0x7D, 0x74, 0xFF, 0xC1, 0xF8, 0x2F, 0xFD, 0x3F, 0xD0, 0x3D, 0x0B, 0xFF, 0x0F, 0xD0, 0x09,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00,
-    0x03, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x19, 0x00, 0xD0, 0x00, 0x00, 0x3E, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00,
-    0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F,
-    0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00,
-    0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF,
-    0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x78, 0x03, 0x40, 0x03, 0xF0,
-    0x3C, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x0F, 0xF9, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03,
-    0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F, 0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xF0, 0x0F, 0xC0,
-    0xBF, 0x80, 0x3F, 0x4B, 0xBE, 0x20, 0xFF, 0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xC0, 0x00,
-    0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0,
-    0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x1F, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x04, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xF9, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xE1, 0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F, 0x00, 0xFE, 0x02,
-    0xFC, 0x03, 0xF4, 0x0F, 0xF0, 0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B, 0xBE, 0x20, 0xFF, 0xBD, 0xFF,
-    0xD3, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x55, 0x55, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF7, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x3E,
-    0x7E, 0x00, 0x60, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x82, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x95, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x04,
-    0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x03, 0xD0, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x7D, 0x00, 0x7F, 0x00,
-    0x0F, 0xE5, 0x5F, 0xC0, 0x2F, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x2F, 0xF9, 0x3F, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xF8, 0x1F, 0xE0, 0xFC, 0x0B, 0xF0, 0x1F, 0xC0, 0xFC, 0x0F, 0xC0, 0x3F, 0x42, 0xF4, 0x2F,
-    0xC0, 0x3F, 0x0B, 0xE0, 0x3F, 0x80, 0xBF, 0xBF, 0x40, 0x3F, 0x40, 0xFF, 0xF8, 0x00, 0x3F, 0x03,
-    0xFF, 0x40, 0x10, 0x3F, 0x4B, 0xFF, 0x00, 0xF0, 0x3F, 0xEF, 0x7F, 0xAB, 0xF0, 0x3F, 0xFC, 0x3F,
-    0xFF, 0xC0, 0x0F, 0xE0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x28, 0x02, 0xC0, 0x00, 0x2F, 0x01, 0xE0, 0x00, 0x0B, 0xFA, 0xF0, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x54, 0x01, 0xFF,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x7C, 0x00,
-    0x3F, 0x80, 0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x40, 0x03, 0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x95, 0x7F, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1E, 0x00, 0xD0, 0x0F, 0xC0,
-    0xF0, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xFC, 0x3F, 0x40, 0xFC, 0x0F, 0xC0, 0x7E, 0x07, 0xE0, 0x2F, 0x0B,
-    0xE0, 0x0F, 0xEF, 0xE0, 0x03, 0xFF, 0x80, 0x01, 0xFD, 0x00, 0x40, 0x3F, 0x00, 0xB4, 0x0F, 0xFA,
-    0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF4, 0x07, 0xE0, 0x0B, 0xFC, 0x07, 0x80, 0x02, 0xFD,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x55, 0x55, 0xFF,
-    0x2F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0x40, 0x03, 0xFC, 0xBF, 0x00, 0x03, 0xF8,
-    0xBF, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x2F, 0xD0, 0x7F, 0xE6, 0xFF, 0x80, 0x2F, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xFF, 0xE0, 0x07, 0xFF,
-    0xF8, 0x1F, 0x81, 0xFC, 0x1D, 0x00, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xFD, 0x03, 0xF9, 0xFC,
-    0x0F, 0xD0, 0xFC, 0x3F, 0x02, 0xF8, 0x7E, 0x03, 0xF0, 0x7E, 0x1F, 0xD0, 0x3F, 0xFF, 0x40, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x1F, 0xC7,
-    0xF0, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF4, 0x07, 0xE0, 0x0B, 0xFC, 0x07, 0x80, 0x02,
-    0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x55, 0x55,
-    0xFF, 0x2F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0x40, 0x03, 0xFC, 0xBF, 0x00, 0x03,
-    0xF8, 0xBF, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x2F, 0xD0, 0x7F, 0xE6, 0xFF, 0x80, 0x2F, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x7D, 0x02,
-    0xF8, 0xFD, 0x02, 0xF4, 0xFC, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xFF,
-    0xE0, 0x07, 0xFF, 0xF8, 0x1F, 0x81, 0xFC, 0x1D, 0x00, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xFD,
-    0x03, 0xF9, 0xFC, 0x0F, 0xD0, 0xFC, 0x3F, 0x02, 0xF8, 0x7E, 0x03, 0xF0, 0x7E, 0x1F, 0xD0, 0x3F,
-    0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x15, 0x54, 0x01, 0xA4, 0x00, 0xFF, 0x80, 0xFF, 0xFC, 0x0B, 0xFC,
-    0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x2F, 0xFC, 0x00, 0xA7, 0xE0, 0x1F, 0x80, 0x7F, 0x68, 0x00, 0x02,
-    0xF0, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x3F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x3F,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x7F, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xFD, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xE0, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x42,
-    0xF8, 0x0F, 0xE0, 0x00, 0x03, 0xFE, 0x03, 0xF4, 0x07, 0xF4, 0x00, 0x0F, 0xF8, 0x03, 0xF4, 0x03,
-    0xFC, 0x00, 0x7F, 0xF0, 0x2F, 0xFE, 0x02, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xFE, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x0F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x00, 0x14, 0x00,
-    0x7F, 0xC0, 0x7C, 0x07, 0xFC, 0x0B, 0xFF, 0xC3, 0xF0, 0x7F, 0xF4, 0x3E, 0xFF, 0x0F, 0x83, 0xF6,
-    0xC0, 0xD0, 0xFC, 0xBD, 0x3E, 0x00, 0x00, 0x02, 0xF7, 0xF2, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xDF,
-    0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xCB,
-    0xFB, 0xC0, 0x00, 0x00, 0x3D, 0x3F, 0x2F, 0x82, 0xC1, 0xEB, 0xE0, 0xF8, 0x7F, 0xFF, 0x0F, 0xFF,
-    0x03, 0xD0, 0xFF, 0xF0, 0x2F, 0xE0, 0x1F, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0F, 0x80, 0x02, 0xFC, 0xBF, 0x00, 0x0B, 0xE2, 0xF4, 0x00,
-    0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x90, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xC0, 0x3F, 0xC0, 0x2E, 0x00, 0xBF, 0x00, 0x70, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xD0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFE, 0x03, 0x80, 0x07, 0xF8, 0x3F, 0x00, 0x3F, 0xC0, 0xFF,
-    0x57, 0xFD, 0x02, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x87, 0xD0, 0x0B, 0xE3, 0xF8, 0x02, 0xF4, 0xFC, 0x00, 0x10, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFD, 0x01, 0xF4, 0x2F, 0x80, 0x20,
-    0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x2B, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0x6F, 0xC0, 0x00,
-    0x03, 0xF0, 0x1C, 0x00, 0xFC, 0x0F, 0xC0, 0xFE, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x01,
-    0xF4, 0x03, 0xF8, 0x02, 0xF0, 0x0F, 0xF0, 0x01, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x1F, 0xD0, 0x01, 0x00, 0x0F, 0xD0, 0x1F, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x3F, 0xC0, 0x3F,
-    0xE6, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xF9, 0x5B, 0xF4, 0x02, 0xF0, 0x0F, 0xD0, 0x00,
-    0x80, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x1C, 0x00, 0x3F, 0x80, 0x3E, 0x00, 0xBF, 0x00, 0x3F,
-    0xEB, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x05, 0x55, 0x40, 0x1F, 0xFF,
-    0xD0, 0xFF, 0xFF, 0x00, 0x2F, 0xFD, 0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x00,
-    0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xD0, 0x1F, 0xFF, 0x00,
-    0x00, 0xBF, 0x01, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x2F, 0xAF, 0xD0, 0x00, 0x0F, 0xF2, 0xF8, 0xBF,
-    0x00, 0x00, 0x3F, 0xBF, 0x43, 0xFC, 0x00, 0x01, 0xFF, 0xF4, 0x0F, 0xE0, 0x00, 0x0B, 0xFF, 0x00,
-    0x7F, 0x40, 0x00, 0x3F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF8,
-    0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xFD, 0x0F, 0xFF, 0xE0, 0x0B, 0xFF, 0xF0, 0x7F, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE, 0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF,
-    0x00, 0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F, 0xF1, 0x8F, 0xFB, 0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0,
-    0x7F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00,
-    0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x15, 0x55,
-    0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xFC, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x07,
-    0xF4, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0x40,
-    0x7F, 0xFC, 0x00, 0x02, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xF0, 0xBE, 0xBF, 0x40, 0x00, 0x3F,
-    0xCB, 0xE2, 0xFC, 0x00, 0x00, 0xFE, 0xFD, 0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x3F, 0x80, 0x00,
-    0x2F, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0,
-    0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xFF, 0xC1, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x0F, 0xC3,
-    0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC,
-    0x7F, 0xF8, 0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B,
-    0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xF0, 0x7F, 0xC0, 0x2F, 0x87,
-    0xFF, 0x18, 0xFF, 0xBC, 0xFF, 0xF3, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00,
-    0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC,
-    0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE,
-    0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00,
-    0x03, 0xFC, 0x3F, 0xC0, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00,
-    0xFF, 0xEB, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x7D, 0x00, 0x2F, 0x8F, 0xD0, 0x02, 0xF0, 0xFC,
-    0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F, 0xC1, 0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x2F, 0xC3,
-    0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4, 0x07, 0xF0, 0x3F, 0x40, 0xFD, 0x03, 0xFD, 0x7F,
-    0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x0F, 0xFC, 0x07, 0xFC,
-    0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x02, 0xFE, 0x1F, 0xE0, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x01, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xD5, 0x55, 0x7F, 0xD3, 0xFC, 0x00,
-    0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0xF0, 0x03, 0xFD, 0x00,
-    0xFF, 0xE6, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x1F, 0xE1, 0xFE, 0x0F,
-    0xD0, 0x2F, 0xC7, 0xF0, 0x07, 0xF3, 0xFE, 0xAA, 0xFC, 0xFF, 0xFF, 0xFE, 0x3F, 0x55, 0x7F, 0x5F,
-    0xC0, 0x1F, 0xC3, 0xF0, 0x0F, 0xD0, 0xFF, 0x1F, 0xF0, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x03, 0xF8, 0xFE,
-    0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x0F, 0xFC,
-    0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x02, 0xFE, 0x1F, 0xE0, 0x00, 0x1F, 0xE2, 0xFD, 0x00,
-    0x01, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xD5, 0x55, 0x7F, 0xD3,
-    0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0xF0, 0x03,
-    0xFD, 0x00, 0xFF, 0xE6, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x7D, 0x00, 0x2F, 0x8F, 0xD0, 0x02,
-    0xF0, 0xFC, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xD0, 0x2F, 0xC1, 0xFC, 0x01, 0xFC, 0x3F, 0xEA,
-    0xAF, 0xC3, 0xFF, 0xFF, 0xF8, 0x3F, 0x55, 0x7F, 0x47, 0xF0, 0x07, 0xF0, 0x3F, 0x00, 0xFD, 0x03,
-    0xFC, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6B, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x01, 0xFF, 0xBF, 0xF8, 0x00, 0xBC, 0x01, 0xFF, 0x00, 0x2E, 0x00, 0x2F, 0xE0, 0x07, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x0A, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x3C,
-    0x00, 0x2F, 0xE0, 0x3F, 0x40, 0x1F, 0xF0, 0x0F, 0xF9, 0x7F, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xC0,
-    0x0F, 0xD3, 0xF0, 0x03, 0xF0, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFD, 0x01, 0xF4, 0x2F, 0xC0, 0x30, 0x07, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x2A, 0xBF, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0x5B, 0xF0, 0x00, 0x02, 0xF8, 0x1C, 0x00, 0xFC,
-    0x0F, 0xC1, 0xFE, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x54, 0x3F, 0xFF, 0x03, 0xFF, 0xD2, 0xFF, 0xD0,
-    0x1F, 0xF8, 0x0B, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x2F, 0x40, 0x03, 0xF8, 0x03, 0xF0, 0x00,
-    0x2F, 0xC0, 0xFC, 0x00, 0x01, 0xFC, 0x1F, 0x40, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBE, 0xBC,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x02, 0x07, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x7F, 0xFF, 0x40, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x0B, 0xF4, 0x1F, 0xD0, 0x0B, 0xFF, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x03, 0xF4, 0x2F,
-    0x80, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x07, 0xE1, 0xF4, 0x00, 0x01, 0xF8,
-    0xBC, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x38,
-    0x1F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0xFD,
-    0x3F, 0x40, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55, 0x43,
-    0xFF, 0xF0, 0x3F, 0xFD, 0x2F, 0xFD, 0x01, 0xFF, 0x80, 0xBF, 0x40, 0x0F, 0xC0, 0x03, 0xF4, 0x02,
-    0xF4, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0xC1, 0xF4, 0x00, 0x00,
-    0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xEB, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x20, 0x7E, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x0B,
-    0xD2, 0xF0, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0xBF, 0x41, 0xFD, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x3F, 0x42, 0xF8,
-    0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x1F, 0x8B,
-    0xC0, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x81,
-    0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xE0, 0x2D, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x3F,
-    0xD3, 0xFC, 0x00, 0x0F, 0xE0, 0xFD, 0x00, 0x00, 0xD0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x50, 0x15, 0x54, 0x3F, 0xFF, 0x03, 0xFF, 0xD2, 0xFF, 0xD0, 0x1F, 0xF8, 0x0B, 0xF4, 0x00,
-    0xFC, 0x00, 0x3F, 0x40, 0x2F, 0x40, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x01,
-    0xFC, 0x1F, 0x40, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBE, 0xBC, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0x07,
-    0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x03,
-    0xF1, 0xF8, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2F, 0xD0, 0x7F, 0x40, 0x2F, 0xFC, 0x0F, 0xE0,
-    0x00, 0xBF, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0xBE, 0x0F,
-    0xC0, 0x00, 0x1F, 0x87, 0xD0, 0x00, 0x07, 0xE2, 0xF0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F,
-    0xBC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x1F,
-    0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x05, 0x55, 0x43, 0xFF, 0xF4, 0xFF, 0xFE, 0x2F, 0xFD, 0x0B, 0xFF,
-    0x80, 0xBF, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0,
-    0x07, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x0F, 0xF4, 0x0B, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0xA5, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x03, 0xF5, 0xFC, 0x00,
-    0x0F, 0xC7, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x02, 0xF8, 0x3F, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0x7F, 0x00, 0x3F, 0x02, 0xFC, 0x01, 0xF8, 0x0F,
-    0xE0, 0x07, 0xE0, 0x7F, 0x40, 0x1F, 0xEF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x19, 0x2F, 0x80,
-    0x00, 0x00, 0xFE, 0x20, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x3E, 0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x07, 0xF4, 0x03,
-    0x80, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0B, 0xFF, 0x80, 0xFF,
-    0xFF, 0x87, 0xD0, 0xBE, 0x08, 0x02, 0xF8, 0x00, 0x2F, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0xD0, 0x1F,
-    0xF4, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x0B, 0x2F, 0xD1, 0xFC, 0x3F, 0xFF, 0xE0, 0x7F, 0xE7, 0x80,
-    0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x6F, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x05, 0x55, 0x40, 0x1F, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFD, 0x00, 0xBF, 0xF4, 0x00, 0x1B, 0xFF, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x40, 0x00,
-    0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x0F, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xC0, 0x3F,
-    0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x3F, 0x83, 0xFC, 0x00,
-    0x03, 0xF8, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x7F, 0x86, 0xFF, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
-    0x83, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x90, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0x2F, 0x8F, 0xE0, 0x00,
-    0x00, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFC, 0x7F, 0xF4, 0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x2F,
-    0xC0, 0x3F, 0x00, 0x00, 0xFE, 0x01, 0xF8, 0x50, 0x03, 0xF4, 0x0F, 0xFF, 0xF8, 0x0F, 0xC0, 0x3F,
-    0xEF, 0xF4, 0x7F, 0x00, 0xFC, 0x0B, 0xE2, 0xF8, 0x07, 0xE0, 0x1F, 0x8F, 0xD0, 0x1F, 0x80, 0xBD,
-    0x3F, 0x04, 0x7F, 0x07, 0xF0, 0xFF, 0xF0, 0xFF, 0xFF, 0x07, 0xFF, 0x40, 0xFF, 0xE0, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x3E, 0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x07,
-    0xF4, 0x02, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x05, 0xFF, 0x54, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x97, 0xD0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0B, 0xFF,
-    0x81, 0xFF, 0xFF, 0x8B, 0x90, 0xBE, 0x04, 0x02, 0xF8, 0x0A, 0x1F, 0xC0, 0x2F, 0xFD, 0x00, 0xFF,
-    0x80, 0x1F, 0xFC, 0x00, 0xFD, 0x38, 0x07, 0xF0, 0x07, 0x2F, 0xD1, 0xBE, 0x3F, 0xFF, 0xF8, 0x7F,
-    0xFB, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0xBB, 0xF0, 0x02, 0xFF, 0x00, 0x02, 0x90, 0x00,
-    0x00, 0x55, 0x54, 0x05, 0x55, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xC0, 0x0B, 0xFE, 0x01, 0xFF, 0x80,
-    0x00, 0x7F, 0x40, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x3F, 0x40, 0x00,
-    0x00, 0x3F, 0xEF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x2F, 0x82, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x07, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0xFE, 0x00, 0x3F, 0xFF, 0x40, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF5, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x02, 0xFD, 0x02, 0xFC, 0x0B, 0xFF, 0x0B, 0xFD, 0x05, 0x7F, 0x5F, 0xAC, 0x00, 0x3F,
-    0xBD, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0xF4, 0xFE, 0x00, 0x3F, 0xE0,
-    0x7F, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x14,
-    0x1F, 0x40, 0x00, 0x7E, 0xBF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x55,
-    0x54, 0x05, 0x55, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xC0, 0x0B, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0x7F,
-    0x40, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x3F,
-    0xEF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x4F,
-    0xE0, 0x00, 0x00, 0x2F, 0x82, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x0B,
-    0xF4, 0x00, 0x7F, 0xFD, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x4B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x02, 0xFD, 0x02, 0xFC, 0x0B, 0xFF, 0x0B, 0xFD, 0x05, 0x7F, 0x5F, 0xAC, 0x00, 0x2F, 0xBD,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x5F, 0xF5, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0xF4, 0xFE, 0xA4, 0x3F, 0xE0, 0xBF,
-    0xF4, 0x3F, 0x80, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x00, 0x00, 0x03, 0x0C, 0x2F, 0x80, 0xF0, 0x3F, 0xC1, 0x94, 0x09, 0x00, 0x90,
-    0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09,
-    0x00, 0x90, 0x09, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x38, 0x55, 0x5E, 0xEA,
-    0xAF, 0xC0, 0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x55, 0xFA,
-    0xAB, 0x34, 0x03, 0x0A, 0x03, 0x02, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0xBF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0xBF, 0xFD, 0xFF,
-    0xFE, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA,
-    0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x54, 0x05, 0x3F,
-    0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC,
-    0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0,
-    0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2,
-    0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x6A, 0x06, 0x80, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA,
-    0xAA, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x00,
-    0x40, 0x7C, 0x0F, 0x83, 0xF0, 0x7E, 0x0B, 0xD0, 0xFE, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0x40, 0xBF,
-    0x07, 0xF0, 0x7F, 0x0B, 0xD0, 0xFC, 0x2F, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0,
-    0xFC, 0x0F, 0xC2, 0xF4, 0x3E, 0x0B, 0xC0, 0x10, 0x00, 0x04, 0x03, 0xF4, 0xBF, 0x0B, 0xE0, 0x7F,
-    0x02, 0xF0, 0x0F, 0x80, 0x7C, 0x01, 0x80, 0x00, 0x40, 0x10, 0x1F, 0x03, 0xD0, 0xF8, 0x3F, 0x0F,
-    0xC2, 0xF0, 0x7E, 0x0F, 0xC2, 0xF4, 0x7E, 0x0F, 0xE2, 0xFC, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0xFC, 0x07, 0xF0, 0xFC, 0x03, 0xF0, 0xFC, 0x07, 0xD0, 0xF8, 0x0F,
-    0xC2, 0xF0, 0x1F, 0x43, 0xE0, 0x3D, 0x0F, 0x80, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F,
-    0xC0, 0xFD, 0x3F, 0x43, 0xF0, 0xFC, 0x0F, 0xC3, 0xF0, 0xBD, 0x2F, 0x43, 0xE0, 0xF8, 0x2F, 0x0B,
-    0xC0, 0x10, 0x04, 0x00, 0x04, 0x01, 0x00, 0xFD, 0x3F, 0x4B, 0xF2, 0xFC, 0x2F, 0x8B, 0xE0, 0x7F,
-    0x1F, 0xC0, 0xBC, 0x2F, 0x00, 0xF8, 0x3E, 0x01, 0xF0, 0x7C, 0x01, 0x80, 0x60, 0x00, 0x19, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x90, 0x3C, 0x04, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x02, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xF8, 0x10, 0x3D, 0x04, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x29, 0x7D, 0x69, 0x0F, 0xFF, 0xFF, 0x47, 0xEB, 0xEB, 0xC0, 0x02, 0xE0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC3, 0xFF, 0x4F, 0xFD, 0x3F, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x24, 0x00, 0x1F, 0xD0, 0x07, 0xFF,
-    0x41, 0xFF, 0xFD, 0x7F, 0xFF, 0xDF, 0xFF, 0x87, 0xFE, 0x01, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x19,
-    0x1F, 0xEB, 0xFD, 0xFE, 0x04, 0x00, 0x19, 0x00, 0x51, 0xFC, 0x0F, 0xDF, 0xF0, 0xBF, 0x6F, 0x82,
-    0xFC, 0x10, 0x01, 0x40, 0x19, 0x00, 0x05, 0x00, 0x05, 0x1F, 0xC0, 0x0F, 0xD0, 0x0F, 0xEF, 0xF0,
-    0x0B, 0xF4, 0x03, 0xFB, 0xF8, 0x01, 0xFC, 0x00, 0xFC, 0x10, 0x00, 0x14, 0x00, 0x04, 0x00, 0x2F,
-    0x5F, 0xFB, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x38, 0x40, 0x5E, 0xD0, 0xAF,
-    0xC0, 0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x01, 0xFA, 0x07,
-    0x34, 0x03, 0x0A, 0x03, 0x02, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x29, 0xA8, 0x61, 0x89,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x01, 0x04, 0x00, 0x0A, 0x34, 0x00, 0x0A, 0x38, 0x15, 0x5E,
-    0x28, 0xEA, 0xBC, 0x73, 0x01, 0xC7, 0x0C, 0x1C, 0x70, 0x30, 0x86, 0x00, 0xC0, 0x00, 0x03, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1C, 0xA0, 0x02, 0xCA, 0x00,
-    0x2C, 0xB5, 0x54, 0xD3, 0xEA, 0xB0, 0xD3, 0x40, 0xC0, 0xA3, 0x43, 0x00, 0x92, 0x0C, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00,
-    0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x1F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0xC1, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0xF4, 0x2F, 0xE0, 0x00, 0xBF, 0x47, 0xFB, 0xF0, 0xF8,
-    0x3F, 0xFE, 0x01, 0xFF, 0xF4, 0x7F, 0xE0, 0xBC, 0x3F, 0x0F, 0xC1, 0xF8, 0x7F, 0x00, 0x00, 0x7C,
-    0x1F, 0x42, 0xF4, 0xFC, 0x0F, 0xC0, 0x00, 0x3D, 0x0F, 0xC0, 0xBC, 0x3E, 0x03, 0xF0, 0x00, 0x3F,
-    0x03, 0xF0, 0x3F, 0x1F, 0x40, 0xF8, 0x00, 0x2F, 0x00, 0xF8, 0x0F, 0x8B, 0xD0, 0xBD, 0x00, 0x1F,
-    0x40, 0x3F, 0x0B, 0xD1, 0xF4, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xEB, 0xE0, 0x7F, 0x7F, 0x00, 0x0F,
-    0xC0, 0x01, 0xFF, 0xE0, 0x0B, 0xFF, 0x00, 0x02, 0xD0, 0x00, 0x06, 0x40, 0x00, 0x15, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xF0, 0xBE, 0x0F, 0xC2,
-    0xF8, 0x3F, 0x03, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x7F, 0x1F, 0x82, 0xF8,
-    0xFD, 0x0F, 0xC7, 0xF0, 0xBE, 0x2F, 0x43, 0xF0, 0xFC, 0x0F, 0x07, 0xC0, 0x14, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x1E, 0x03, 0xC0, 0x7F, 0x0F, 0xD1, 0xF8, 0x2F, 0x87, 0xF0, 0xFD,
-    0x0F, 0xC2, 0xF8, 0x7F, 0x0B, 0xE0, 0xFC, 0x2F, 0x43, 0xF0, 0xBD, 0x0F, 0xC0, 0xF0, 0x2E, 0x07,
-    0xC0, 0x14, 0x02, 0x00, 0x50, 0x00, 0x00, 0x02, 0xD0, 0x7E, 0x03, 0xF0, 0x2F, 0x80, 0xFC, 0x0B,
-    0xD0, 0x3E, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x7E, 0x0F, 0xC0, 0x3F, 0x0B, 0xE0,
-    0x2F, 0x87, 0xF0, 0x0F, 0xC2, 0xF4, 0x0B, 0xD0, 0xFC, 0x03, 0xE0, 0x7C, 0x00, 0x80, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x41, 0xE0, 0x3C, 0x07, 0xE0, 0xFC, 0x2F, 0x80, 0xFC, 0x2F, 0x87, 0xF0,
-    0x2F, 0x87, 0xF0, 0xFD, 0x03, 0xF0, 0xBD, 0x1F, 0xC0, 0xBD, 0x0F, 0xC2, 0xF4, 0x0F, 0x81, 0xF0,
-    0x3D, 0x00, 0x80, 0x14, 0x01, 0x00, 0x00, 0x60, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0xE0, 0x07, 0xE3,
-    0xE0, 0x7E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0xE0, 0x1F, 0xD0,
-    0x1F, 0xD0, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0xBF, 0x01, 0xFD, 0x07, 0xF4,
-    0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x2C, 0x7C, 0x07,
-    0xC0, 0x7C, 0x2F, 0x0B, 0xD1, 0xF0, 0x0B, 0xC3, 0x87, 0xC0, 0x02, 0xF0, 0x1F, 0x00, 0x00, 0xB8,
-    0x3D, 0x00, 0x08, 0x3E, 0xF4, 0x50, 0x3F, 0x0F, 0xD1, 0xF8, 0x3F, 0x0F, 0xD1, 0xF8, 0x04, 0x3E,
-    0xF4, 0x50, 0x00, 0xF8, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x40, 0x0B, 0xC7, 0x87, 0xC0, 0x2F, 0x0B,
-    0xD1, 0xF0, 0x7C, 0x07, 0xC0, 0x7C, 0x70, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x01, 0xA0, 0x07, 0xF0, 0x2F, 0xC0, 0x3F, 0x80, 0xFE, 0x01, 0xFD, 0x07, 0xF0, 0x07, 0xF0, 0x2F,
-    0xC0, 0x2F, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x7E, 0x00,
-    0x3E, 0x01, 0xF4, 0x01, 0xF4, 0x07, 0xC0, 0x07, 0xC0, 0x2F, 0x00, 0x2F, 0x00, 0xB8, 0x00, 0xB4,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x7F, 0x01, 0xF8, 0x02, 0xFC, 0x0F,
-    0xE0, 0x0B, 0xD0, 0x3F, 0x40, 0x04, 0x00, 0x10, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA,
-    0xAA, 0xAA, 0xA4, 0xBF, 0xDF, 0xFD, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0xFC, 0x0F, 0xFF, 0x8B,
-    0xFF, 0xE0, 0xFF, 0xFC, 0x74, 0x3F, 0x0E, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x3D, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0xBD, 0x01, 0xFC, 0x00, 0x2F, 0x40, 0x3E,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x07, 0xF8, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x0F, 0xE0,
-    0x01, 0xFC, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x01, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x1F, 0xF0, 0x01, 0xFC, 0x7F, 0xFC, 0x03, 0xF8, 0xBF, 0xFE, 0x03, 0xF4, 0x74, 0x3F, 0x07, 0xF0,
-    0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x3D, 0x0F, 0xD0, 0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x1F, 0x00, 0xFF, 0xC0, 0x1F, 0x00,
-    0x7F, 0x80, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x7E, 0x00, 0x7F, 0x00,
-    0xFE, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0x00, 0x7F, 0x07, 0xFD, 0x00, 0x3F, 0x83, 0xFF, 0xD0, 0x1F, 0xD0, 0xFF, 0xFC, 0x07, 0xF0, 0x34,
-    0x3F, 0x02, 0xF8, 0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x02, 0xF0, 0x0F, 0xC0,
-    0x03, 0xF0, 0x03, 0xE0, 0x03, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x7C, 0x01, 0xF4, 0x00, 0x2F,
-    0x00, 0x7F, 0xE0, 0x0B, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00,
-    0x7F, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x0B, 0xD0, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xD3, 0xFF, 0xFE, 0xBF, 0x6F, 0x42, 0xFF, 0xF8,
-    0x24, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x41,
-    0xE0, 0x3C, 0x0B, 0x80, 0x7F, 0x0F, 0xD1, 0xF8, 0x3F, 0x02, 0xF8, 0x7F, 0x0F, 0xD1, 0xFC, 0x0F,
-    0xC2, 0xF8, 0x7F, 0x0F, 0xD0, 0xBE, 0x0F, 0xC2, 0xF4, 0x3F, 0x03, 0xF0, 0xBD, 0x0F, 0xC2, 0xF4,
-    0x0F, 0x02, 0xE0, 0x7C, 0x0F, 0x80, 0x14, 0x02, 0x00, 0x50, 0x08, 0x00, 0x00, 0x19, 0x00, 0x07,
-    0xFF, 0x80, 0x7E, 0x7F, 0x03, 0xF0, 0xBD, 0x2F, 0x41, 0xF4, 0xFC, 0x07, 0xD3, 0xE0, 0x2F, 0x1F,
-    0x80, 0xFC, 0x7E, 0x07, 0xD0, 0xFC, 0x3F, 0x02, 0xFF, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0xF7, 0xD0, 0x0F, 0x4F, 0x00, 0xF4, 0x7C,
-    0x0F, 0xD7, 0xF4, 0x7F, 0xFF, 0xF0, 0x55, 0xBE, 0x40, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x15,
-    0x50, 0x03, 0xFF, 0xD0, 0x1F, 0xAA, 0x00, 0xB8, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x01,
-    0xFC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x01, 0xFD, 0x03, 0xFF, 0xD0, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x80, 0x0B, 0xFF, 0x03, 0xF9, 0x00, 0xFC, 0x00, 0x2F, 0x90, 0x07, 0xFF,
-    0xE0, 0xBD, 0x6F, 0x4F, 0x80, 0xF8, 0xF8, 0x0F, 0x8B, 0xC1, 0xF4, 0x7F, 0xFE, 0x00, 0xBF, 0x40,
-    0x15, 0x55, 0x0F, 0xFF, 0xFB, 0xEB, 0xFB, 0xC0, 0xFC, 0x50, 0xBC, 0x00, 0x7D, 0x00, 0x3E, 0x00,
-    0x3F, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x07, 0xFF, 0x80, 0x3E, 0x2F, 0x02, 0xF0, 0x7C, 0x07, 0xD3, 0xE0, 0x0B, 0xFD, 0x00, 0x7F,
-    0xF4, 0x07, 0xC3, 0xF0, 0x3E, 0x07, 0xD0, 0xF8, 0x2F, 0x02, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00,
-    0x19, 0x00, 0x0B, 0xFF, 0x00, 0xBD, 0x7F, 0x03, 0xE0, 0x7C, 0x0F, 0x41, 0xF0, 0x3E, 0x0B, 0xC0,
-    0xBF, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0x1F, 0x80, 0x02, 0xFC, 0x07, 0xFF, 0x80, 0x0F, 0xE0, 0x00,
-    0x05, 0x01, 0x40, 0xFD, 0xBF, 0x00, 0xFB, 0xBC, 0x03, 0xF1, 0xF0, 0x0F, 0x8B, 0x80, 0x7C, 0x3D,
-    0x02, 0xE0, 0xF6, 0x0F, 0x47, 0xFC, 0x3C, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0F,
-    0xFF, 0xC0, 0xBD, 0x3F, 0x47, 0xE0, 0x7D, 0x2F, 0x01, 0xF4, 0xFC, 0x0B, 0xD3, 0xE0, 0x3F, 0x1F,
-    0x80, 0xF8, 0x3E, 0x0B, 0xC0, 0xFE, 0xBE, 0x01, 0xFF, 0xD0, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x0F, 0xFC, 0x0A, 0xFC, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF4, 0x02, 0xF0, 0x03, 0xF0, 0x03,
-    0xE0, 0x1B, 0xF4, 0x7F, 0xFC, 0x15, 0x50, 0x00, 0xBF, 0x80, 0x0F, 0xFF, 0xC0, 0xFC, 0x2F, 0x02,
-    0xC0, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00,
-    0xFF, 0xFF, 0x43, 0xFF, 0xFC, 0x00, 0x55, 0x00, 0x01, 0xFE, 0x03, 0xFF, 0xE0, 0xF0, 0xFC, 0x10,
-    0x3E, 0x00, 0x7F, 0x01, 0xFF, 0x40, 0x6B, 0xF0, 0x00, 0x7C, 0x00, 0x3F, 0x15, 0xBF, 0x4F, 0xFF,
-    0x41, 0xA4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0xC0, 0x02, 0xFE, 0x00, 0x2F, 0xF4, 0x01, 0xF3,
-    0xC0, 0x1F, 0x1F, 0x01, 0xF0, 0xBC, 0x1F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF0, 0x00, 0x7C, 0x00, 0x01,
-    0xF0, 0x00, 0x01, 0x40, 0x00, 0xAA, 0xA4, 0x03, 0xFF, 0xC0, 0x2F, 0x55, 0x00, 0xF8, 0x00, 0x03,
-    0xFE, 0x00, 0x06, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x57, 0xFC, 0x03,
-    0xFF, 0x80, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFE, 0x0B, 0xF4, 0x01, 0xF8, 0x00, 0x3F,
-    0xF8, 0x07, 0xFF, 0xF0, 0xBC, 0x1F, 0x8F, 0x80, 0xF8, 0xFC, 0x0F, 0x4B, 0xD7, 0xF0, 0x3F, 0xFC,
-    0x00, 0x69, 0x00, 0x2A, 0xAA, 0x5F, 0xFF, 0xFB, 0x82, 0xF6, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xBC,
-    0x00, 0x7D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x00, 0x90, 0x00, 0x00, 0x7F,
-    0x80, 0x0B, 0xEF, 0xC0, 0x7C, 0x1F, 0x02, 0xF0, 0xBC, 0x03, 0xFB, 0xC0, 0x0B, 0xFC, 0x00, 0xF9,
-    0xFC, 0x0B, 0xC2, 0xF4, 0x3E, 0x07, 0xD0, 0xFD, 0x7F, 0x01, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x00,
-    0xBF, 0x40, 0x0F, 0xFF, 0x80, 0xFC, 0x2F, 0x03, 0xD0, 0x7C, 0x0F, 0x41, 0xF0, 0x3F, 0x5B, 0xC0,
-    0x7F, 0xFE, 0x00, 0x17, 0xF0, 0x00, 0x2F, 0x40, 0x1B, 0xF4, 0x07, 0xFE, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xD5,
-    0x7D, 0x00, 0x0F, 0xE0, 0x0F, 0x00, 0x03, 0xF4, 0x03, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x07, 0xF9, 0x54, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x06, 0xFF, 0xA4, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x03,
-    0xF0, 0x1F, 0x40, 0x02, 0xF8, 0x07, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x06, 0xBF, 0x5A, 0x40, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0x5F, 0xE5, 0x50, 0x00, 0x57, 0xF5, 0x54, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x06, 0xFE, 0xA9, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0xFA, 0xAB,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xE1, 0xBF, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0xF4, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x0F, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x07, 0xF4, 0x3F, 0x50, 0x02, 0xA0,
-    0x00, 0xFF, 0x03, 0xFC, 0xFF, 0xFE, 0x0B, 0xFF, 0x00, 0x3F, 0xDB, 0xFC, 0x2F, 0xFA, 0x07, 0xD6,
-    0xC0, 0x0F, 0xFF, 0xF8, 0x03, 0xF4, 0x02, 0xF0, 0x00, 0x07, 0xFF, 0x90, 0x00, 0xFC, 0x00, 0xBF,
-    0x40, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0xBF, 0x40, 0x3F, 0x80, 0x00, 0x0B, 0xE0, 0x44, 0x0B, 0xE0, 0x1F, 0xE0, 0x00, 0x03, 0xF9, 0xF3,
-    0xC1, 0xF4, 0x3F, 0xFF, 0x40, 0x00, 0xFF, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xF4,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xE4, 0xBC, 0x00, 0x1F, 0xE0,
-    0x0B, 0x80, 0x03, 0xF8, 0x00, 0xA0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x05, 0x00, 0x0B,
-    0xFF, 0xAB, 0xE0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xAA, 0xAA, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xC0, 0x1F, 0xBF, 0xFD, 0x0B, 0xCF, 0xCF, 0x80, 0xD3, 0xF1, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0xD3, 0xF2, 0xC0, 0xFC, 0xFD, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00,
-    0x3F, 0x40, 0x7F, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xD2, 0xFA, 0xAA, 0xAF, 0xE0, 0x2F, 0x40, 0x07, 0xE0, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x3D, 0x01,
-    0xF0, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x74, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0xF4, 0x07, 0xFF,
-    0xF4, 0x7E, 0xFE, 0xF4, 0xF3, 0xF3, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x01, 0x4F, 0xC5, 0x1F, 0x3F, 0x3D, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x3F, 0xF0, 0x00,
-    0x3F, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x07, 0xCF, 0xCF, 0x40, 0x53, 0xF1, 0x40, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x01, 0x4F, 0xC5, 0x01, 0xF3, 0xF3, 0xD0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0x0F, 0x80, 0x38, 0x3E, 0x02, 0xF8, 0xF8, 0x2F, 0x83, 0xE2, 0xF4, 0x0F, 0xAF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xF8, 0xFE, 0xAA, 0x90, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x0B, 0x00, 0xBC, 0xBE, 0x02, 0xF0, 0xBE, 0x0B, 0xC0, 0x7E,
-    0x2F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0xAA, 0xAF, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x7D,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x40,
-    0x1C, 0x00, 0xBD, 0x01, 0xFC, 0x01, 0xF4, 0x1F, 0xC0, 0x07, 0xC1, 0xF8, 0x00, 0x1F, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0xBE, 0xAA, 0xAA, 0x80, 0xBD, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xAF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFA, 0xAA, 0xAA, 0xA0, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0x45, 0x55, 0x60, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x3F, 0xE2, 0xFF, 0x03,
-    0xF7, 0x8B, 0x7F, 0x07, 0x1E, 0x2D, 0x34, 0x00, 0x78, 0xB4, 0x00, 0x01, 0xE2, 0xD0, 0x00, 0x0B,
-    0x8B, 0x40, 0x00, 0x2E, 0x2E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x0B, 0x8B,
-    0x80, 0x00, 0x2E, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0xAA, 0xAB, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x02, 0xAA, 0xAA, 0xAB, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x02, 0x55, 0x54, 0x7E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x02, 0xE2, 0xE0,
-    0x00, 0x0B, 0x8B, 0x80, 0x00, 0x2E, 0x2E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x02, 0xE2, 0xE0, 0x00,
-    0x07, 0x8B, 0x40, 0x00, 0x1E, 0x2D, 0x00, 0x00, 0x78, 0xB4, 0x00, 0xB1, 0xE2, 0xD3, 0x83, 0xFB,
-    0x8B, 0xBF, 0x03, 0xFE, 0x2F, 0xF0, 0x02, 0xF8, 0xBE, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x0F, 0x03,
-    0xC0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x0F, 0xD5, 0x5F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xAA,
-    0xAA, 0xAB, 0xC7, 0xC0, 0x00, 0x00, 0xF4, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x01, 0x52, 0xFE, 0x00, 0x00, 0xBE, 0x1F, 0xF0, 0x00, 0x0F, 0xC0, 0xFF,
-    0x40, 0x01, 0xFC, 0x0B, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0xEA, 0xAB, 0xF0, 0x03, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xF8, 0x00, 0x0F, 0xF4, 0x2F, 0x40, 0x00, 0x7F,
-    0x83, 0xF0, 0x00, 0x03, 0xFC, 0x7D, 0x00, 0x00, 0x2F, 0xDB, 0xC0, 0x00, 0x01, 0xFE, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF,
-    0xE0, 0x0D, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0xBF,
-    0xFF, 0x01, 0xFF, 0xFF, 0xC1, 0xFE, 0x6F, 0xF0, 0xFD, 0x02, 0xF8, 0xBE, 0x00, 0xFE, 0x3F, 0x40,
-    0x3F, 0x5F, 0xC0, 0x0F, 0xC7, 0xF0, 0x07, 0xE1, 0xFC, 0x03, 0xF4, 0x7F, 0x02, 0xFC, 0x0F, 0xE6,
-    0xFC, 0x02, 0xFF, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x1F,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF8, 0x95, 0x56, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0,
-    0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE2, 0xAA, 0x9B, 0xF8,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF9, 0xFE, 0xAB, 0xFE,
-    0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x01,
-    0xD0, 0x03, 0xFF, 0xFF, 0x9F, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x3F,
-    0xC0, 0x00, 0xFF, 0x41, 0xFD, 0x00, 0x0F, 0xFE, 0x0B, 0xF0, 0x00, 0xFA, 0xFC, 0x3F, 0x40, 0x0F,
-    0x87, 0xF0, 0xFD, 0x00, 0xF8, 0x0F, 0xC3, 0xF0, 0x0F, 0x80, 0x7F, 0x0F, 0xD0, 0xF8, 0x01, 0xFC,
-    0x3F, 0x4F, 0x80, 0x0B, 0xF0, 0xFE, 0xFC, 0x00, 0x3F, 0x82, 0xFF, 0xC0, 0x01, 0xFC, 0x03, 0xFC,
-    0x00, 0x1F, 0xE0, 0x0F, 0xFE, 0x57, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xC7, 0xFF, 0xFD,
-    0x00, 0x0C, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x0F, 0xAF, 0xD0, 0x00, 0x07, 0xD3, 0xFC, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0x00, 0xF8, 0x1F,
-    0xE0, 0x00, 0xBC, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x1F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0,
-    0x03, 0xFC, 0x07, 0xF0, 0x00, 0xFF, 0x42, 0xF4, 0x00, 0x1F, 0xF0, 0xFD, 0x00, 0x07, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xD0, 0x05, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x40, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0xFD, 0x03, 0xFC, 0x00,
-    0x3F, 0x00, 0xFF, 0x40, 0x1F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x03, 0xE0, 0x00, 0xBF,
-    0x42, 0xF4, 0x00, 0x1F, 0xE0, 0xFC, 0x00, 0x03, 0xFC, 0x7D, 0x00, 0x00, 0xBF, 0x6F, 0x00, 0x00,
-    0x1F, 0xEF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x1B, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xAA, 0xA9, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xEB, 0xFA, 0xAA, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x06, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x05, 0x6F, 0xD4, 0x01, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xAB, 0xFE, 0x92,
-    0xFE, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x2F, 0x80, 0x2F, 0xC0, 0x0F, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xAA, 0xFE, 0xAA, 0xAF, 0xC0, 0x7E,
-    0x00, 0x07, 0xF4, 0x2F, 0x40, 0x00, 0xFF, 0x0F, 0xC0, 0x00, 0x1F, 0xFB, 0xE0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x90, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xAA, 0xAA, 0xAA, 0x9F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE5, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x56, 0xAA, 0xA4, 0x55, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x01, 0xAA, 0xAA, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF,
-    0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xD2, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05, 0xFE, 0x54,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x1A, 0xFF, 0xAB, 0xFE, 0x00, 0x1F,
-    0xC0, 0x2F, 0xE0, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x0F, 0xEB,
-    0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAF, 0xEA, 0xBF, 0x80, 0x02, 0xF4, 0x0F,
-    0xE0, 0x00, 0x7E, 0x07, 0xF4, 0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x02, 0xFB, 0xFD, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F,
-    0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xBF, 0x80, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF1, 0x55, 0x55, 0x6F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x06, 0xAA, 0xA5, 0x40, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC,
-    0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0,
-    0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xD0,
-    0x3F, 0xFF, 0xD1, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF, 0xC0, 0x05, 0x55, 0x55, 0x54, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x1F, 0xF0, 0x00, 0xBD, 0x0B, 0xF8, 0x00, 0x3D, 0x03,
-    0xFD, 0x00, 0x3C, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x04, 0x03, 0xF8, 0x00, 0x1F, 0x0B,
-    0xF0, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0xBF, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA8, 0xBF, 0xFF, 0xFD, 0xAA, 0xAA, 0xA8,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x7C, 0x78, 0xBF, 0xBE, 0xFC, 0x1F, 0xFF, 0xE0, 0x03, 0xFF,
-    0x40, 0x1F, 0xFF, 0xE0, 0xBF, 0xBF, 0xFC, 0x3C, 0x7C, 0x78, 0x10, 0x7C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x14, 0x00, 0x01, 0xA4, 0x01, 0xFF, 0xF0, 0x3F, 0xBF, 0xCB, 0xC0, 0xBC, 0xBC, 0x07, 0xCB,
-    0xC0, 0x7C, 0x7E, 0x5F, 0xC3, 0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x47, 0xFC, 0x7F,
-    0xC3, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xAA,
-    0x00, 0x3D, 0x01, 0xFF, 0xC0, 0x1F, 0x00, 0x7F, 0xF0, 0x0B, 0xC0, 0x00, 0xFD, 0x03, 0xE0, 0x00,
-    0x2F, 0x81, 0xF0, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x2F, 0x4F, 0x40,
-    0x00, 0x07, 0xEB, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x50, 0x00, 0x42, 0xFF, 0x01,
-    0xF1, 0xFF, 0xF2, 0xF8, 0xFC, 0x3F, 0xF4, 0x3D, 0x03, 0xF4, 0x0F, 0x40, 0xFD, 0x03, 0xF0, 0xFF,
-    0xD0, 0xBF, 0xFC, 0xFE, 0x0F, 0xFC, 0x0F, 0xC0, 0x54, 0x00, 0x60, 0x01, 0x40, 0x01, 0x40, 0x1F,
-    0xF4, 0x1F, 0xF0, 0x3F, 0xFD, 0x7F, 0xFC, 0x7D, 0x3F, 0xF4, 0xBC, 0xBC, 0x0F, 0xD0, 0x3C, 0xBC,
-    0x0F, 0xE0, 0x3C, 0xBC, 0x2F, 0xF4, 0xBC, 0x7F, 0xFC, 0xBF, 0xF8, 0x2F, 0xF0, 0x2F, 0xF0, 0x05,
-    0x40, 0x05, 0x40, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x15, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x2A,
-    0x54, 0x05, 0x3F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7,
-    0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF,
-    0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F,
-    0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x6A, 0x06, 0x80, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00,
-    0xFD, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x3F,
-    0x40, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0xFE, 0x03, 0xF8,
-    0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x02, 0xFC, 0x14, 0x00, 0x00, 0x05,
-    0x47, 0xF0, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x0B, 0xF0, 0x1F, 0xC0,
-    0x00, 0xFD, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0x40,
-    0x02, 0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x07, 0xF2,
-    0xF8, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x6F, 0xE4,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x0B, 0xF4, 0x07, 0xF8, 0x3F, 0x40, 0x07, 0xF1,
-    0xFC, 0x00, 0x0F, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8,
-    0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00,
-    0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B,
-    0xD0, 0x14, 0x00, 0x00, 0x51, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD,
-    0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E,
-    0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00,
-    0x02, 0xF4, 0xFC, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0xBF, 0x0B, 0xFE, 0x6F, 0xF8, 0x0B, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC, 0x7C, 0x00, 0x0F, 0xF0, 0x40, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xE1, 0xFD, 0x00, 0x0F,
-    0xEF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0,
-    0x00, 0xFF, 0x4F, 0xE0, 0x00, 0x2F, 0xC0, 0x50, 0x00, 0x01, 0x40, 0x1E, 0x40, 0x00, 0x2E, 0x1F,
-    0xF0, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x0F, 0xF4, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0xE1,
-    0xFD, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x07, 0xF0, 0xFF, 0x0B, 0xE0,
-    0x10, 0x00, 0x1E, 0x40, 0x00, 0x2E, 0x1F, 0xF0, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x0F, 0xF4, 0xFD,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01,
-    0x90, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x4F, 0xE0, 0x00, 0x2F, 0xC0, 0x50, 0x00,
-    0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xD3, 0xFF, 0xFE, 0xBF, 0x6F, 0x42, 0xFF,
-    0xF8, 0x24, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x01,
-    0x82, 0xFF, 0xF9, 0x1F, 0x5F, 0xDB, 0xFF, 0xFC, 0x78, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xD1, 0x55, 0x55,
-    0x55, 0x00, 0x00, 0x40, 0x00, 0x03, 0xFE, 0x02, 0xD3, 0xFF, 0xF9, 0xF8, 0xF9, 0xBF, 0xFD, 0x3C,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x74, 0xBF, 0xFD, 0x7E, 0x3F, 0x7F, 0xFF, 0x4F,
-    0x01, 0xFF, 0x80, 0x40, 0x05, 0x00, 0x10, 0x00, 0x00, 0x10, 0xFE, 0xAA, 0xAF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0x01, 0xAF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xA4,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAB, 0xF0, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x03, 0xD0, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x6A, 0xBF, 0xA8, 0x00, 0x7C,
-    0x00, 0x15, 0xF9, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD,
-    0x15, 0x55, 0x55, 0x50, 0x00, 0x00, 0x24, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40,
-    0x2F, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x7F,
-    0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x02, 0xC0, 0x00, 0x7F, 0xC0, 0x0B,
-    0xF0, 0x01, 0xFF, 0x80, 0x6F, 0xF4, 0x07, 0xFE, 0x01, 0xFF, 0x90, 0x1F, 0xF8, 0x03, 0xFE, 0x00,
-    0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x2F, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0xBF, 0xD0,
-    0x00, 0x1F, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x01, 0xE0, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0xD0, 0x00,
-    0x03, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x1B, 0xFD, 0x00, 0x01, 0xBF, 0xD0, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xD0, 0x07, 0xF8, 0x00, 0x7F, 0xE0, 0x1F, 0xF8,
-    0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x07, 0xFE, 0x01, 0xFF, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0x00,
-    0xF4, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF1, 0x55, 0x55, 0x6F, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xAA, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1A, 0xFF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x90, 0x3F, 0x00, 0x3F, 0x80, 0x2F,
-    0x80, 0x2F, 0xC0, 0x0F, 0xC0, 0x0B, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0x02, 0xF4, 0x00, 0xBF, 0x00,
-    0xFC, 0x00, 0x2F, 0xC0, 0x7E, 0x00, 0x03, 0xFC, 0x2F, 0x40, 0x00, 0xBF, 0xEF, 0xD5, 0x55, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0xAA, 0xA4, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xDF, 0xF8, 0x00,
-    0x07, 0xE0, 0xBF, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0xBF,
-    0x00, 0x3F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xF1, 0x57, 0xF5, 0x6F,
-    0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xBF, 0xA9, 0x40, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x55, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFA, 0xAA, 0xA8,
-    0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x95, 0x55, 0x50, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0x5A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x50, 0x00,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0xAA, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xC1, 0x55, 0x55, 0xBF, 0xD1, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x0A, 0xAA, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xDB, 0x9F, 0xD0, 0x01, 0xF4, 0x2E, 0x07, 0xD0, 0x0F, 0x00, 0xB8, 0x07,
-    0xC0, 0xB8, 0x02, 0xE0, 0x0B, 0x83, 0xC0, 0x0B, 0x80, 0x0F, 0x1E, 0x00, 0x2E, 0x00, 0x3D, 0x7E,
-    0xAA, 0xFE, 0xAA, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xD5, 0x5B, 0x95, 0x5F, 0x5F, 0x00, 0x2E,
-    0x00, 0x3D, 0x3C, 0x00, 0xB8, 0x00, 0xF0, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0xF4, 0x0B, 0x80, 0x7C,
-    0x01, 0xF8, 0x2E, 0x0B, 0xD0, 0x01, 0xFE, 0xBA, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xD4,
-    0x5F, 0xD0, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x00, 0x0B,
-    0x83, 0xC0, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x7E, 0xAA, 0xAA, 0xAA, 0xF6, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE7, 0xD5, 0x55, 0x55, 0x5F, 0x5F, 0x00, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00,
-    0x00, 0xF0, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0x7C, 0x01, 0xF8, 0x00, 0x0B, 0xD0,
-    0x01, 0xFE, 0x56, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xD4, 0x5F, 0xD0, 0x01, 0xF4, 0x00,
-    0x07, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0xBB, 0xF0, 0x03, 0xEB, 0x83, 0xC3, 0xF0, 0x3E, 0x0F,
-    0x1E, 0x03, 0xF3, 0xE0, 0x3D, 0x78, 0x03, 0xFE, 0x00, 0xB6, 0xE0, 0x03, 0xF0, 0x02, 0xE7, 0x80,
-    0x3F, 0xF0, 0x0B, 0x5F, 0x03, 0xE3, 0xF0, 0x3D, 0x3C, 0x3E, 0x03, 0xF0, 0xF0, 0xBB, 0xE0, 0x03,
-    0xFB, 0x80, 0xFE, 0x00, 0x03, 0xFC, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFE, 0x56, 0xFD, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xD4, 0x5F, 0xD0, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00,
-    0x3F, 0xC0, 0xB8, 0x00, 0x03, 0xEB, 0x83, 0xC0, 0x00, 0x3E, 0x0F, 0x1F, 0x00, 0x03, 0xE0, 0x3D,
-    0x78, 0x00, 0x3E, 0x00, 0xB6, 0xE0, 0x03, 0xE0, 0x02, 0xE7, 0x80, 0x3E, 0x00, 0x0B, 0x5F, 0x03,
-    0xE0, 0x00, 0x3D, 0x3C, 0x3E, 0x00, 0x00, 0xF0, 0xBB, 0xE0, 0x00, 0x0B, 0x80, 0xFE, 0x00, 0x00,
-    0x7C, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFE, 0x56, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0x47, 0xFC, 0x7F, 0xC3, 0xF4, 0x00,
-    0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x0B, 0xD0, 0xFF, 0x40, 0xBF, 0x80, 0x7F, 0xC3, 0xFD, 0x02, 0xFE,
-    0x01, 0xFF, 0x0B, 0xE0, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x74, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x74,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x7D, 0x04, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xFD, 0x2F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
-    0xE1, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x02,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE2, 0xFF,
-    0xFE, 0x00, 0x00, 0x2F, 0xFC, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xD2, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_12_bolditalicBitmaps[30186] = {
+    0xA5, 0x55, 0x31, 0x73, 0xDE, 0x44, 0x10, 0x7D, 0x92, 0x9C, 0x5C, 0xA1, 0x42, 0x14, 0x09, 0xC3,
+    0x24, 0xCC, 0x1C, 0x3F, 0xC0, 0x70, 0x6D, 0x8A, 0xC4, 0x27, 0x92, 0xC2, 0x2D, 0x05, 0x54, 0x14,
+    0x49, 0x41, 0x91, 0x09, 0x45, 0x9A, 0x14, 0x29, 0x6C, 0x4B, 0x90, 0x82, 0x22, 0x05, 0xE9, 0x52,
+    0x92, 0x32, 0x71, 0x13, 0x4A, 0x86, 0xB1, 0x7D, 0xB2, 0x5D, 0xA6, 0xD1, 0x10, 0x3A, 0x0A, 0x94,
+    0x19, 0x0A, 0x66, 0x28, 0x7C, 0x24, 0x82, 0x91, 0xC7, 0x27, 0x1D, 0x6F, 0xF5, 0x7D, 0x49, 0x5C,
+    0x30, 0x34, 0x9C, 0x25, 0x7D, 0xBE, 0xD3, 0xDD, 0xEE, 0xDB, 0xB7, 0x6F, 0x57, 0xB8, 0x99, 0x84,
+    0x6C, 0x50, 0xBD, 0xF2, 0x79, 0x57, 0xB4, 0x45, 0xC3, 0xBF, 0x5A, 0x97, 0x1A, 0x06, 0x1F, 0x02,
+    0x58, 0x41, 0x05, 0x87, 0x5D, 0xBC, 0x83, 0xFC, 0x9B, 0x83, 0x3E, 0x58, 0x73, 0xEF, 0x65, 0xBF,
+    0x65, 0xD5, 0x73, 0xBF, 0xB1, 0x96, 0xDF, 0xAB, 0xB1, 0x1C, 0x26, 0xEB, 0x60, 0x55, 0x8B, 0xB5,
+    0xBC, 0x39, 0xB3, 0x77, 0xFD, 0x67, 0x1D, 0xE3, 0x78, 0x61, 0x72, 0xBF, 0x63, 0x30, 0x48, 0x7A,
+    0x8B, 0xD4, 0xAF, 0xA1, 0x8A, 0xD1, 0x3B, 0xDE, 0xAA, 0x0B, 0xC8, 0x9B, 0x01, 0xC5, 0x7E, 0x8F,
+    0xE2, 0x6B, 0xBF, 0x34, 0xB0, 0x0A, 0x64, 0xB4, 0x76, 0x07, 0xB8, 0x5D, 0x73, 0x6B, 0xA9, 0x8F,
+    0x42, 0xF6, 0xE2, 0x97, 0x76, 0x73, 0xF5, 0xB2, 0x7A, 0x75, 0x58, 0xDA, 0x01, 0x69, 0x6C, 0x90,
+    0x47, 0x7A, 0x0A, 0x48, 0x62, 0xB7, 0xB1, 0xEA, 0x8A, 0xC3, 0x43, 0x3F, 0x5E, 0xDA, 0xCA, 0x4F,
+    0xAE, 0x37, 0x36, 0xF6, 0x70, 0x03, 0x92, 0x0E, 0x02, 0x39, 0x6B, 0x80, 0xCB, 0xC0, 0xD9, 0xF2,
+    0x35, 0x38, 0x62, 0x4F, 0x1B, 0x98, 0x01, 0xBA, 0xCE, 0x4E, 0x7A, 0x04, 0x98, 0xF5, 0x2E, 0x6F,
+    0x10, 0x8A, 0x7A, 0x13, 0xAA, 0x5D, 0x23, 0x74, 0xF3, 0x31, 0x41, 0x62, 0xA7, 0xD8, 0xF7, 0x48,
+    0xFB, 0xAD, 0xE2, 0xEA, 0xA4, 0x4E, 0xFC, 0x60, 0x27, 0x35, 0xE5, 0x87, 0x3E, 0x00, 0x1B, 0xFA,
+    0x6A, 0x8F, 0xAC, 0x0D, 0x3C, 0x64, 0x33, 0x2F, 0xE1, 0x14, 0x35, 0xAD, 0x95, 0x36, 0x6F, 0x69,
+    0x6D, 0xDA, 0x43, 0xD1, 0x10, 0x93, 0xF8, 0xFE, 0x42, 0x9C, 0xBD, 0x1D, 0x95, 0x84, 0xE7, 0xA2,
+    0xFC, 0x57, 0x10, 0x95, 0x4D, 0x39, 0x97, 0xA3, 0x50, 0x2F, 0x06, 0xDC, 0x48, 0x4E, 0xFA, 0x64,
+    0x07, 0x55, 0x67, 0x26, 0xB8, 0xC6, 0x1D, 0x23, 0xF6, 0xB6, 0xC7, 0x68, 0x57, 0x36, 0xB8, 0xBB,
+    0xB3, 0x30, 0x5F, 0x8D, 0xBA, 0xCC, 0x3B, 0xF3, 0x6B, 0x93, 0x86, 0x8C, 0xD1, 0x57, 0x0F, 0x5C,
+    0x47, 0x0A, 0x62, 0x7C, 0x80, 0x6A, 0x32, 0x5C, 0xA0, 0xE9, 0x6E, 0xE1, 0x27, 0xBF, 0xFF, 0xDC,
+    0x87, 0x2D, 0xBD, 0x7E, 0x30, 0xCF, 0xDF, 0x07, 0x46, 0x28, 0x0F, 0xCD, 0x33, 0x20, 0xC0, 0x74,
+    0x90, 0x19, 0xB1, 0x12, 0x83, 0xAE, 0x61, 0x4A, 0x30, 0xD8, 0xD3, 0x17, 0x57, 0xB8, 0x97, 0x6F,
+    0xF3, 0x0E, 0x99, 0x47, 0xC2, 0x90, 0x77, 0x81, 0xF7, 0x80, 0x0F, 0x64, 0x2A, 0x67, 0x3B, 0x79,
+    0x6B, 0xEA, 0x85, 0xBD, 0xAC, 0x17, 0x63, 0x9C, 0xED, 0x92, 0x2D, 0x79, 0x61, 0xC5, 0x05, 0x7F,
+    0xB7, 0x64, 0xBB, 0x29, 0x39, 0x31, 0x0D, 0x1F, 0xB6, 0xC6, 0x8D, 0x99, 0xFD, 0xF5, 0xE6, 0xF2,
+    0x8E, 0x8A, 0x2B, 0x79, 0xDC, 0x77, 0xA1, 0xFA, 0xFE, 0xDA, 0xB3, 0x1A, 0x3F, 0x08, 0xCE, 0x9D,
+    0xB7, 0xD7, 0xAD, 0xE9, 0xB1, 0x8B, 0xE3, 0xF6, 0xF4, 0xF8, 0xF4, 0x22, 0x47, 0xF2, 0xC0, 0x34,
+    0x55, 0x19, 0x54, 0x67, 0x95, 0xFF, 0x48, 0x02, 0x1E, 0xE3, 0x14, 0xC7, 0x33, 0xC5, 0xB3, 0x97,
+    0xC3, 0x39, 0x4E, 0xE9, 0x5E, 0x90, 0x13, 0x13, 0x54, 0x37, 0x87, 0xF2, 0xEF, 0x2B, 0xC5, 0x7F,
+    0xAD, 0x2C, 0x06, 0xCD, 0x29, 0x72, 0x6A, 0xA3, 0x47, 0xFC, 0x6E, 0xC8, 0x42, 0x16, 0x72, 0x9F,
+    0x86, 0xA2, 0x4D, 0x03, 0x63, 0x09, 0xB6, 0xE6, 0x5D, 0x66, 0xA1, 0x42, 0x36, 0x38, 0x32, 0xE2,
+    0x50, 0x74, 0xAE, 0x24, 0xB6, 0xBA, 0x2A, 0xED, 0xC9, 0x04, 0x4D, 0x05, 0xAA, 0x58, 0xBF, 0xD1,
+    0xDB, 0xD9, 0x90, 0xB8, 0x90, 0xC6, 0x01, 0x9F, 0x93, 0x2B, 0x72, 0xE4, 0xE5, 0xD2, 0x14, 0x5A,
+    0x0B, 0xDB, 0x2C, 0xAF, 0xAA, 0x86, 0x2B, 0x41, 0xA9, 0x33, 0xEF, 0x3C, 0x8E, 0x4F, 0xA8, 0x92,
+    0x09, 0x45, 0x9C, 0x10, 0x1F, 0x06, 0xE5, 0x55, 0x5F, 0x94, 0xBA, 0x5D, 0x01, 0xD5, 0xA3, 0xA8,
+    0x98, 0xAA, 0x81, 0x0A, 0xF3, 0x4F, 0xCE, 0x99, 0xAB, 0x51, 0xF4, 0x48, 0x26, 0x06, 0xCB, 0x92,
+    0xA2, 0x26, 0x0E, 0x62, 0xE4, 0xDB, 0xD9, 0xC6, 0x48, 0x1B, 0x23, 0xDC, 0xC3, 0x90, 0xF9, 0xDC,
+    0x2B, 0xA6, 0x02, 0xC9, 0x08, 0xF1, 0x7C, 0x91, 0x52, 0xE0, 0xAE, 0xFC, 0x29, 0x0D, 0x10, 0x8E,
+    0xBC, 0x81, 0x58, 0xF0, 0x67, 0xBE, 0x8C, 0xA5, 0x93, 0xC0, 0x8F, 0xDF, 0x28, 0xB7, 0x9C, 0x69,
+    0x9C, 0x1D, 0xD0, 0x0F, 0x89, 0xD1, 0x11, 0xC9, 0x31, 0x45, 0x7F, 0xBF, 0x4D, 0x06, 0x5B, 0xEA,
+    0x26, 0x24, 0xC4, 0x28, 0x75, 0x4E, 0xE7, 0x7F, 0xF3, 0x6E, 0x66, 0xDA, 0xA9, 0x8F, 0x54, 0xAC,
+    0xB7, 0xCB, 0xB6, 0x40, 0x77, 0x96, 0x2C, 0xD8, 0xED, 0x47, 0xD8, 0x83, 0xC8, 0x12, 0x0C, 0x98,
+    0xF6, 0x58, 0xAC, 0x91, 0x81, 0x25, 0x9C, 0x08, 0x0F, 0x22, 0x95, 0xF9, 0x96, 0x60, 0x27, 0xBC,
+    0xCB, 0x62, 0xB6, 0x91, 0x54, 0x8D, 0xAF, 0xE1, 0x24, 0x25, 0xA1, 0xB7, 0x70, 0x53, 0x59, 0x10,
+    0x52, 0x9C, 0xA3, 0x17, 0x4B, 0x4A, 0x8C, 0xC7, 0x31, 0x99, 0x9E, 0x32, 0x5D, 0xB9, 0xB7, 0xB5,
+    0x6E, 0x27, 0x54, 0xD9, 0xC0, 0xCC, 0xF9, 0xA2, 0xD3, 0x7F, 0x45, 0x42, 0x20, 0xF1, 0xD3, 0xDB,
+    0x92, 0xB4, 0x31, 0xEE, 0x13, 0x2E, 0xEB, 0x68, 0xB0, 0x74, 0xC9, 0x4C, 0x27, 0x35, 0x89, 0x48,
+    0xC9, 0x9E, 0x6E, 0x67, 0x3E, 0x84, 0x1A, 0x26, 0x46, 0x48, 0xB7, 0x0B, 0x0A, 0x64, 0x45, 0xD0,
+    0x2D, 0x19, 0x5E, 0xA8, 0x85, 0x55, 0x9B, 0x31, 0x06, 0xDB, 0x4E, 0x49, 0x48, 0x07, 0x69, 0x9D,
+    0xA6, 0x71, 0xB0, 0x47, 0x5E, 0xB2, 0x98, 0x32, 0xA1, 0xF6, 0xA8, 0xCF, 0x86, 0xC2, 0x1B, 0x62,
+    0x1A, 0x61, 0xAF, 0x09, 0xA6, 0xE3, 0xDB, 0xAD, 0x8E, 0x92, 0xE3, 0xFA, 0xB4, 0xEA, 0x58, 0x4B,
+    0xD2, 0xC0, 0x1E, 0xB2, 0x95, 0x24, 0x23, 0x8B, 0x6F, 0x4A, 0x17, 0x37, 0xC3, 0x62, 0xE6, 0xE2,
+    0x1F, 0x81, 0x0D, 0x71, 0x60, 0xE5, 0xFB, 0x39, 0x8B, 0x92, 0x7B, 0x72, 0x04, 0xD7, 0x43, 0x9A,
+    0x80, 0x59, 0xE6, 0x2C, 0xF5, 0xBA, 0xAD, 0xCA, 0xFE, 0x4D, 0x9C, 0xE7, 0x32, 0x6F, 0x9A, 0x3D,
+    0x81, 0xAB, 0x29, 0x3C, 0xD5, 0xA3, 0x3F, 0xD5, 0x97, 0xD8, 0xA7, 0x1C, 0xC3, 0xCD, 0x7C, 0x32,
+    0x80, 0x89, 0x5C, 0x94, 0xE3, 0x3C, 0xEE, 0x8A, 0xCA, 0xAA, 0x8E, 0x0E, 0xAA, 0x4E, 0x58, 0xB0,
+    0xA2, 0xEB, 0x12, 0x55, 0x3F, 0xAB, 0xEF, 0xEE, 0xDC, 0xCE, 0x46, 0x5E, 0xB7, 0xB6, 0x1F, 0xF3,
+    0xFF, 0xF3, 0x9F, 0x7D, 0xBA, 0x98, 0x2E, 0x0E, 0x5F, 0x9A, 0x93, 0x69, 0xA4, 0x59, 0x97, 0x30,
+    0x3D, 0xD2, 0x11, 0x79, 0x80, 0x6B, 0xF5, 0x28, 0xEB, 0x97, 0x96, 0x2E, 0xB4, 0xAF, 0x82, 0x9B,
+    0xEE, 0x90, 0x7D, 0x5C, 0x01, 0x45, 0xAA, 0x9B, 0x35, 0x16, 0x7B, 0x6C, 0x44, 0x07, 0x2B, 0xEC,
+    0x21, 0x13, 0x65, 0x32, 0x37, 0xD1, 0xF3, 0x98, 0xDD, 0x75, 0xA2, 0x23, 0x12, 0xA0, 0xA6, 0xF2,
+    0xE2, 0x20, 0x86, 0x58, 0x1B, 0xA4, 0x22, 0x67, 0x8B, 0xDC, 0x5A, 0x2D, 0x0E, 0xFA, 0x22, 0x7A,
+    0x5B, 0xD4, 0xBB, 0xA6, 0x0E, 0x3B, 0xAA, 0xBB, 0x92, 0xBD, 0xF2, 0x36, 0xF1, 0xC5, 0xB7, 0xF5,
+    0xC0, 0xF6, 0xBE, 0xA9, 0xBA, 0xCD, 0xEC, 0xCF, 0x5E, 0xDF, 0xEB, 0xCD, 0x7A, 0x5B, 0xB9, 0x9F,
+    0x06, 0x5D, 0xC7, 0x67, 0xB1, 0xAE, 0xD2, 0xA0, 0x7F, 0x9B, 0xB3, 0x39, 0xE7, 0x9D, 0x9F, 0x8C,
+    0x11, 0xC9, 0x23, 0x06, 0xBA, 0xCD, 0xC4, 0x30, 0xA9, 0x42, 0xD5, 0xED, 0x27, 0x0B, 0xB4, 0x37,
+    0x5F, 0x6F, 0x92, 0xF8, 0x51, 0x48, 0xA4, 0x46, 0x1E, 0x6B, 0xA2, 0x67, 0xF6, 0x03, 0x7E, 0xDF,
+    0xF8, 0x90, 0xAF, 0x02, 0x9B, 0xA2, 0x2D, 0xD9, 0x58, 0xA8, 0x14, 0x23, 0xF5, 0x50, 0xC9, 0x63,
+    0x5C, 0xB4, 0x42, 0xE1, 0x9A, 0x69, 0xE0, 0xC9, 0x38, 0x56, 0x53, 0x4A, 0xC2, 0x2E, 0xFC, 0x58,
+    0xA6, 0xF2, 0x35, 0x8C, 0x47, 0x21, 0x31, 0xFB, 0x14, 0x48, 0x3D, 0xC1, 0x96, 0x24, 0xAA, 0x24,
+    0x63, 0xEC, 0xB0, 0x8E, 0xB2, 0x10, 0x24, 0xE3, 0x45, 0x26, 0x28, 0x1D, 0xD3, 0x90, 0x8C, 0x59,
+    0xE0, 0x87, 0x80, 0x82, 0x55, 0x03, 0x29, 0xA4, 0x71, 0x77, 0xAA, 0x5E, 0xFF, 0xC7, 0xF8, 0x07,
+    0x65, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0xDB, 0x1C, 0x2E, 0x2C, 0xB4, 0x11, 0x52, 0x28,
+    0x40, 0x62, 0xFF, 0x00, 0x68, 0x1B, 0x4A, 0x72, 0xBB, 0x21, 0x05, 0x45, 0x0A, 0x10, 0x3A, 0x37,
+    0x34, 0xE9, 0xB9, 0xBF, 0xC0, 0x61, 0x8B, 0x2B, 0x28, 0xAE, 0xE0, 0x7E, 0x02, 0x05, 0x15, 0x0D,
+    0x3D, 0xBA, 0xDC, 0x5A, 0x77, 0x25, 0x45, 0x2C, 0xA5, 0xA0, 0xA0, 0xC0, 0x0A, 0x04, 0x8A, 0x14,
+    0xB7, 0x85, 0xA5, 0xF8, 0xC4, 0x7A, 0x87, 0x37, 0xEB, 0xEF, 0x8B, 0x22, 0x61, 0x7D, 0x3E, 0xFB,
+    0xEC, 0x9D, 0x37, 0x33, 0x6F, 0xDF, 0x3C, 0x13, 0x1D, 0xFF, 0x40, 0x25, 0xF3, 0x50, 0x31, 0x87,
+    0x2A, 0x51, 0xAC, 0x56, 0x3A, 0x2C, 0x57, 0x52, 0xC4, 0x44, 0xD4, 0x39, 0x22, 0x3B, 0x10, 0xA9,
+    0x40, 0x54, 0x45, 0x3C, 0x90, 0x87, 0xF9, 0xC1, 0x42, 0x6F, 0x95, 0xDC, 0xEB, 0xDE, 0x22, 0xB4,
+    0x66, 0x1E, 0xC9, 0x70, 0x4F, 0xF9, 0x78, 0xF7, 0x97, 0x73, 0x6A, 0x98, 0x67, 0xEA, 0x98, 0x17,
+    0x7A, 0x18, 0xCC, 0x8C, 0x08, 0x13, 0x28, 0xE1, 0x52, 0xCF, 0xE4, 0x9D, 0x19, 0x8A, 0x44, 0x9E,
+    0xEA, 0x19, 0x88, 0x66, 0x54, 0x13, 0xEE, 0x3B, 0x57, 0xC5, 0x32, 0x92, 0x1E, 0x91, 0x88, 0xC9,
+    0xF6, 0x3A, 0x14, 0x7C, 0xCC, 0x0E, 0x08, 0x13, 0x6A, 0xFB, 0x8B, 0x76, 0x47, 0xDB, 0xB6, 0x82,
+    0x3A, 0x66, 0x78, 0x4F, 0x5F, 0x03, 0x51, 0x93, 0x9A, 0x6A, 0x07, 0x5C, 0x2A, 0xA5, 0x3E, 0xCF,
+    0x13, 0x59, 0xBC, 0x54, 0xCF, 0x8F, 0x68, 0xF7, 0xF0, 0x0E, 0x10, 0x3F, 0x04, 0xA6, 0x72, 0xFA,
+    0xF9, 0xA3, 0x01, 0xE1, 0xC1, 0x48, 0xB8, 0x80, 0x15, 0xCC, 0x8C, 0x10, 0x26, 0x33, 0x1C, 0x02,
+    0xEB, 0x1E, 0x56, 0x7D, 0x9C, 0x7B, 0xF6, 0x72, 0x7E, 0xD9, 0x13, 0x9A, 0xC3, 0xD9, 0x17, 0xEB,
+    0x06, 0x2F, 0x14, 0x54, 0x0B, 0x51, 0x8D, 0xB3, 0xC3, 0x2B, 0x9F, 0x7B, 0x3E, 0xFE, 0x51, 0xFE,
+    0x5B, 0x48, 0xA8, 0x00, 0x2F, 0x0B, 0x18, 0x54, 0x0E, 0x08, 0x41, 0x58, 0x03, 0x95, 0x1B, 0x63,
+    0x88, 0x6D, 0x8F, 0xEC, 0xA0, 0xF8, 0x3A, 0x92, 0x9F, 0xF1, 0x24, 0x81, 0x6D, 0x35, 0x81, 0x9D,
+    0x95, 0xF8, 0xD6, 0x0B, 0xFF, 0x91, 0x6A, 0xBE, 0xDD, 0xB7, 0x7A, 0x74, 0xD0, 0x7E, 0xAE, 0x79,
+    0x64, 0x50, 0x35, 0x37, 0xDC, 0x67, 0x76, 0x00, 0x84, 0x2B, 0x2A, 0x40, 0x38, 0x28, 0x5B, 0xA8,
+    0x99, 0xA5, 0x5C, 0x2F, 0xFD, 0x28, 0xE9, 0x85, 0x52, 0xFB, 0x28, 0xC8, 0xC2, 0x44, 0xAF, 0x07,
+    0xC4, 0x1C, 0xD0, 0xE3, 0xDA, 0xF1, 0x03, 0x06, 0x5C, 0xE8, 0xD8, 0x91, 0xF4, 0x0F, 0xF4, 0x05,
+    0xDD, 0xCB, 0x7B, 0xDB, 0xCB, 0x4F, 0xE0, 0xF2, 0x36, 0x27, 0x42, 0xD7, 0xA8, 0x7E, 0x8B, 0x47,
+    0xC7, 0x08, 0xF1, 0x88, 0x42, 0x18, 0x49, 0x9C, 0x04, 0x4A, 0x06, 0x89, 0xCE, 0x0D, 0x22, 0x78,
+    0xE3, 0x8E, 0xB6, 0x53, 0xA4, 0x82, 0x65, 0xFF, 0xE3, 0x0E, 0xD4, 0x37, 0x20, 0x06, 0xFB, 0xFE,
+    0x01, 0x42, 0x3B, 0x50, 0xD8, 0x61, 0x99, 0x99, 0x76, 0x4D, 0x17, 0xBC, 0x5A, 0xE9, 0x59, 0x4B,
+    0x5D, 0xB9, 0x32, 0x00, 0xD9, 0x53, 0x61, 0xFC, 0x33, 0xAC, 0xF1, 0x39, 0x85, 0x90, 0xCA, 0x59,
+    0x8F, 0x39, 0x03, 0xC8, 0x2E, 0x23, 0x6A, 0xA8, 0xA2, 0x0E, 0x48, 0x82, 0x4D, 0xA8, 0x97, 0x8A,
+    0x81, 0x5D, 0xF0, 0xE8, 0x71, 0x1D, 0xF6, 0x9C, 0x82, 0xE0, 0x19, 0xE2, 0x74, 0xB9, 0x02, 0x29,
+    0x3A, 0x6D, 0x05, 0x49, 0x0F, 0x7E, 0xAB, 0x11, 0x75, 0x49, 0x1B, 0x28, 0xF9, 0x23, 0x15, 0xAA,
+    0x09, 0x0A, 0xBB, 0x9F, 0xDA, 0x08, 0xD9, 0x3C, 0x03, 0xC1, 0x8E, 0x0E, 0x5A, 0xF9, 0x35, 0x32,
+    0x2F, 0x43, 0xC1, 0x01, 0x33, 0x40, 0x3A, 0x12, 0xB4, 0xD0, 0x30, 0x31, 0x92, 0xDF, 0x8C, 0xDF,
+    0x00, 0xE4, 0xE5, 0x7C, 0xD8, 0x11, 0x5D, 0x5C, 0x6A, 0x03, 0x52, 0xCD, 0xF7, 0x67, 0x13, 0xA9,
+    0xEF, 0x5E, 0x5E, 0xA1, 0xAC, 0x81, 0xC7, 0x44, 0x55, 0xB0, 0x01, 0x6C, 0x2D, 0x6A, 0x56, 0x23,
+    0x9D, 0x94, 0xB1, 0x9A, 0xC9, 0xD0, 0x09, 0x74, 0xA0, 0x86, 0xF7, 0x91, 0xDB, 0xAC, 0x20, 0x38,
+    0x6A, 0x24, 0x93, 0x1D, 0x6D, 0x5D, 0xD1, 0x3A, 0x9D, 0xA4, 0x67, 0x1F, 0xDE, 0x64, 0x57, 0xB2,
+    0x53, 0x60, 0x25, 0x12, 0xF6, 0x85, 0x47, 0x2D, 0xEC, 0x15, 0x33, 0xD5, 0x7F, 0x04, 0x83, 0x84,
+    0xDD, 0x69, 0x20, 0x75, 0x1D, 0x2D, 0x51, 0xD4, 0xFF, 0x4C, 0xA4, 0x7B, 0x7E, 0x4C, 0x25, 0xF6,
+    0x1B, 0x01, 0x12, 0x52, 0xE5, 0x7A, 0x3B, 0x99, 0x5E, 0x24, 0x61, 0xD7, 0xF0, 0x58, 0x07, 0x61,
+    0xE6, 0x8E, 0xFC, 0xF9, 0xEA, 0x1C, 0x7C, 0x62, 0x92, 0xD1, 0xAB, 0xD3, 0xB3, 0x8E, 0x35, 0x64,
+    0x33, 0x22, 0x61, 0x02, 0xA9, 0xE6, 0x19, 0x94, 0x90, 0xC0, 0x98, 0xF9, 0x33, 0x6E, 0x37, 0xF6,
+    0xA9, 0x08, 0x03, 0x37, 0xFE, 0x74, 0x25, 0x1D, 0x4C, 0xA8, 0x81, 0xF8, 0x82, 0x5D, 0x36, 0x03,
+    0x00, 0xD3, 0xDE, 0x0D, 0x44, 0x9F, 0x29, 0x8F, 0xED, 0x1B, 0xBE, 0x89, 0x79, 0x3F, 0x21, 0x7B,
+    0x58, 0x81, 0x0A, 0x68, 0x7D, 0x21, 0x2F, 0xF2, 0xBC, 0x89, 0x10, 0x30, 0xF8, 0x49, 0xE7, 0xDB,
+    0x1C, 0x67, 0x9F, 0x81, 0xA0, 0xF4, 0xB4, 0x4D, 0x9A, 0xE1, 0x69, 0x5F, 0x22, 0xE0, 0x46, 0x79,
+    0x88, 0x25, 0x52, 0x65, 0x56, 0xF7, 0x88, 0x66, 0x30, 0x4E, 0x52, 0xE8, 0x24, 0x9A, 0x15, 0xAF,
+    0xC1, 0x6D, 0x15, 0x77, 0xB7, 0x76, 0xAC, 0xF6, 0x63, 0xE0, 0x7B, 0x99, 0x4F, 0x2C, 0x0C, 0xB8,
+    0x12, 0xFF, 0x0D, 0x9A, 0x6B, 0x19, 0x73, 0xD2, 0x79, 0x98, 0x6D, 0xCE, 0x23, 0xDA, 0x96, 0x44,
+    0x3F, 0xF5, 0x54, 0x78, 0x5E, 0xF2, 0xBD, 0x3C, 0xB9, 0xEB, 0xE8, 0x1D, 0x34, 0x04, 0x03, 0xE9,
+    0x6B, 0x7E, 0xB1, 0xD2, 0xDB, 0x22, 0x38, 0xDB, 0x33, 0x44, 0x07, 0x45, 0x75, 0x8E, 0x21, 0x2C,
+    0xCC, 0x84, 0x7F, 0x6F, 0x41, 0x3B, 0xEB, 0x26, 0x4F, 0xFD, 0x7B, 0x10, 0x75, 0x42, 0x08, 0x57,
+    0xAB, 0x88, 0x13, 0xEB, 0x7A, 0x3F, 0x76, 0x5C, 0xF2, 0x19, 0x87, 0x66, 0xD9, 0x68, 0x2A, 0x33,
+    0x4D, 0x03, 0x8C, 0xCD, 0x75, 0xEE, 0xA2, 0x8C, 0x25, 0xCC, 0xA3, 0x71, 0x70, 0x4D, 0xEA, 0xE6,
+    0xAD, 0x1C, 0x0F, 0x5A, 0x3A, 0x5C, 0x4D, 0x50, 0x68, 0xE3, 0x02, 0xB4, 0xC1, 0x3F, 0xD5, 0x6D,
+    0x37, 0x5A, 0x24, 0xD2, 0x3B, 0xF3, 0x3D, 0x80, 0xA9, 0x01, 0x83, 0x9F, 0xE2, 0x9C, 0x17, 0x3D,
+    0x5E, 0x9C, 0x34, 0xC1, 0x28, 0xAC, 0xBB, 0xEF, 0x52, 0xE1, 0xF2, 0x78, 0x9A, 0x71, 0x9B, 0xBF,
+    0x6C, 0xE7, 0x69, 0xE7, 0xF1, 0xE6, 0x35, 0x8F, 0x57, 0xA0, 0xBA, 0x11, 0x83, 0xBC, 0xDB, 0x16,
+    0xED, 0x17, 0x1C, 0x15, 0xFF, 0xC6, 0xA3, 0xB9, 0xC5, 0x2B, 0x3D, 0x60, 0x38, 0x2E, 0xB3, 0xF3,
+    0x60, 0x93, 0x94, 0x98, 0x35, 0x64, 0x35, 0x14, 0x11, 0x38, 0xCD, 0x84, 0x39, 0xB2, 0xF0, 0x76,
+    0xE8, 0x92, 0xA9, 0x0E, 0x42, 0x76, 0xDF, 0xC8, 0x3A, 0xCD, 0xD9, 0x93, 0x65, 0xC6, 0xF7, 0x9F,
+    0x08, 0x40, 0x63, 0x18, 0x39, 0xD5, 0x18, 0xAA, 0xB1, 0x49, 0x19, 0x0C, 0xE1, 0x10, 0xE6, 0x88,
+    0x59, 0xB0, 0x3D, 0xA6, 0x06, 0x5F, 0x22, 0xB0, 0xD6, 0x4C, 0x80, 0x82, 0x9A, 0xF5, 0x15, 0xEA,
+    0xB1, 0xD0, 0x3D, 0xAD, 0x17, 0x20, 0xEB, 0x5F, 0x6C, 0x52, 0x23, 0x1B, 0xA2, 0xE7, 0x9D, 0xBB,
+    0xD2, 0x4A, 0xAF, 0xA0, 0x1D, 0x15, 0xED, 0x03, 0x5E, 0x54, 0xEF, 0xA3, 0x49, 0xC5, 0x82, 0x81,
+    0xF1, 0x0E, 0xC6, 0x3B, 0xC8, 0x07, 0xA7, 0x84, 0x8F, 0x39, 0x3F, 0x58, 0xAA, 0x66, 0x25, 0xE8,
+    0xF6, 0x13, 0x1E, 0xA0, 0x8C, 0xF9, 0x5E, 0x34, 0x8E, 0xEC, 0xD9, 0x93, 0x6B, 0xF1, 0x8F, 0x39,
+    0x3E, 0x46, 0xB1, 0x3F, 0x37, 0x4F, 0x06, 0x49, 0x75, 0x29, 0xFE, 0x10, 0x25, 0x5D, 0xC1, 0x7D,
+    0x07, 0xF6, 0x74, 0xA8, 0x37, 0xEE, 0x84, 0x39, 0x35, 0x54, 0x81, 0x5E, 0x1D, 0x62, 0x60, 0x90,
+    0xA6, 0xC2, 0x4E, 0xA6, 0x42, 0x46, 0xCD, 0x59, 0x21, 0xD6, 0xA2, 0xA4, 0xD5, 0xCA, 0xB7, 0xF4,
+    0xC6, 0x49, 0xE5, 0x42, 0xC3, 0xA6, 0x36, 0x29, 0xDD, 0x8A, 0x06, 0x8C, 0xB4, 0x63, 0xC4, 0xE1,
+    0xCC, 0xB7, 0x40, 0xD7, 0x03, 0x04, 0xA3, 0x07, 0xF1, 0xF7, 0x15, 0x68, 0x96, 0x1F, 0xC2, 0x5C,
+    0x64, 0x43, 0x3E, 0xE5, 0xC0, 0xD1, 0x2E, 0x75, 0x92, 0xEF, 0xA4, 0x6B, 0x82, 0xF4, 0xE0, 0xF2,
+    0x24, 0x22, 0xE8, 0x57, 0x54, 0x97, 0x96, 0x1D, 0x37, 0xE2, 0x7A, 0x62, 0xB8, 0xB9, 0x4C, 0xD9,
+    0xF1, 0x3C, 0x54, 0xB2, 0xCB, 0xB2, 0xC3, 0x25, 0x6F, 0x8C, 0xFD, 0x07, 0x6D, 0x55, 0x3D, 0x6C,
+    0x1C, 0x45, 0x14, 0x7E, 0xBB, 0xE3, 0x68, 0x51, 0xB6, 0x18, 0x17, 0x28, 0xED, 0xA4, 0xA0, 0x41,
+    0x42, 0x9A, 0x96, 0x02, 0x3C, 0x0B, 0x14, 0x41, 0x4A, 0x01, 0x05, 0xA9, 0xDD, 0xD3, 0x98, 0x22,
+    0x25, 0xF1, 0xAE, 0x93, 0x22, 0x74, 0xA4, 0x20, 0x75, 0x9A, 0x34, 0x58, 0x48, 0xA4, 0xA0, 0xC3,
+    0xBE, 0x9D, 0xC4, 0x85, 0x8B, 0x14, 0x59, 0x41, 0x41, 0x41, 0x91, 0x35, 0x15, 0x22, 0x12, 0x9E,
+    0x28, 0x1B, 0x31, 0xE1, 0x66, 0xE6, 0xF1, 0xCD, 0xDE, 0x39, 0x09, 0x88, 0xD3, 0xAC, 0x4F, 0xE7,
+    0x79, 0xBF, 0xDF, 0xF7, 0xBD, 0xB7, 0x74, 0xE5, 0xCA, 0x67, 0xD4, 0x32, 0x5B, 0xCD, 0xEC, 0xA4,
+    0x95, 0x93, 0x18, 0xA5, 0xA7, 0x7B, 0x75, 0x20, 0xAA, 0xD6, 0x8F, 0x88, 0xEB, 0x27, 0x11, 0x95,
+    0x4C, 0x54, 0x30, 0x5D, 0xC5, 0x63, 0x88, 0x1B, 0xD5, 0xF1, 0xED, 0xED, 0xC1, 0x64, 0x57, 0x66,
+    0x4F, 0xF3, 0xE7, 0xFC, 0xB7, 0x24, 0x23, 0xC9, 0xDF, 0x49, 0x75, 0xA4, 0x1B, 0x98, 0xE5, 0xB3,
+    0x4B, 0x74, 0x48, 0x14, 0xF2, 0x29, 0x3C, 0x95, 0x13, 0x09, 0x1C, 0x47, 0x15, 0xCE, 0x48, 0xF5,
+    0x40, 0xD2, 0xE6, 0x93, 0x3D, 0x6E, 0x91, 0xF1, 0x64, 0xA6, 0xEC, 0x11, 0xB2, 0x21, 0xEE, 0x71,
+    0xB3, 0x0A, 0x34, 0x3B, 0xC3, 0x0D, 0x0E, 0x30, 0x35, 0xEB, 0x98, 0xC2, 0x9D, 0x19, 0xBD, 0x4A,
+    0x7F, 0xFE, 0xF5, 0x54, 0x6E, 0x6D, 0x52, 0xC3, 0xEA, 0xF5, 0x54, 0xFF, 0x53, 0xDC, 0xB9, 0x39,
+    0x37, 0x0E, 0x99, 0x86, 0x24, 0x5C, 0x10, 0xFE, 0xB4, 0x2B, 0x9E, 0x39, 0x0A, 0xD7, 0x68, 0x4B,
+    0x5A, 0x5D, 0x02, 0xA4, 0xDD, 0x6A, 0x90, 0x47, 0xAE, 0x9C, 0xEE, 0xD2, 0xDB, 0xCC, 0x0C, 0xF0,
+    0xFE, 0xD8, 0xDF, 0xBF, 0xFB, 0x56, 0x65, 0x17, 0x62, 0x92, 0xF6, 0x1D, 0xD4, 0x50, 0xE0, 0xE1,
+    0x3B, 0x9D, 0xE2, 0x48, 0x49, 0xB9, 0xDA, 0xE9, 0xCE, 0x50, 0x2C, 0x83, 0x70, 0x72, 0xD4, 0xD6,
+    0x34, 0x4C, 0xA1, 0xF6, 0x62, 0xFA, 0xF1, 0x37, 0xB9, 0x7C, 0x1C, 0x4D, 0x30, 0x63, 0xDB, 0xA5,
+    0x15, 0x76, 0x6F, 0x12, 0xF5, 0x23, 0x29, 0xFC, 0x42, 0xA1, 0xB9, 0x22, 0x65, 0xA9, 0xF4, 0x1B,
+    0x64, 0xC0, 0xCB, 0x33, 0xB6, 0x5B, 0xCB, 0x50, 0x45, 0x65, 0xFB, 0xBD, 0x20, 0x9D, 0xB2, 0x88,
+    0xA8, 0xAC, 0xB9, 0x1E, 0x2A, 0x67, 0xBA, 0x24, 0x62, 0x6B, 0x5B, 0x76, 0xF5, 0xE9, 0x9A, 0x05,
+    0x6A, 0x48, 0x7B, 0xE2, 0x20, 0x5E, 0x1C, 0xC8, 0x71, 0x13, 0x61, 0x74, 0x97, 0x5B, 0xC2, 0x69,
+    0xF1, 0xB7, 0xBB, 0x67, 0xD8, 0x69, 0x1E, 0xEA, 0xF4, 0xD2, 0x9A, 0xFA, 0x81, 0x2A, 0xC6, 0x77,
+    0x66, 0xDA, 0xCD, 0x99, 0x37, 0x17, 0x24, 0x97, 0x53, 0x01, 0x71, 0xC8, 0x13, 0xA6, 0xBE, 0xF4,
+    0x68, 0x60, 0x40, 0x03, 0x94, 0xD0, 0xCB, 0x24, 0x47, 0x69, 0xFB, 0xCE, 0x5C, 0x5E, 0x5C, 0xE4,
+    0x43, 0xFE, 0x99, 0x8F, 0x52, 0xE5, 0x01, 0xD8, 0xBF, 0x72, 0xBB, 0x28, 0x6D, 0x50, 0x7B, 0x5E,
+    0xD7, 0xA3, 0x81, 0xA9, 0x47, 0xEE, 0x4D, 0x43, 0x3F, 0x98, 0x27, 0xD3, 0xEB, 0xB9, 0x2F, 0x20,
+    0xA9, 0x60, 0x0B, 0xC8, 0x91, 0xBE, 0xF4, 0xEF, 0x51, 0xE6, 0x07, 0xF5, 0xE0, 0x11, 0xB9, 0x9B,
+    0x1E, 0x77, 0x92, 0x61, 0x7D, 0x21, 0x7E, 0x4A, 0x54, 0xA3, 0x36, 0x34, 0x40, 0x73, 0xA1, 0x59,
+    0x40, 0x44, 0x3A, 0x9B, 0x2F, 0xCE, 0xCC, 0x33, 0x72, 0xD4, 0xE2, 0x29, 0x43, 0xFE, 0x95, 0x4B,
+    0x42, 0xD7, 0xE5, 0x5E, 0x46, 0xF3, 0x14, 0x77, 0x6D, 0xF6, 0xEB, 0xBB, 0x33, 0xBC, 0xD1, 0xDE,
+    0x58, 0x26, 0x9E, 0x8A, 0x80, 0xAC, 0x11, 0x9D, 0x9B, 0x22, 0xA0, 0x80, 0x44, 0xE5, 0x0B, 0x68,
+    0x5D, 0xC3, 0xB8, 0x82, 0x1A, 0xA0, 0x1E, 0x2A, 0x73, 0xC1, 0x3D, 0x04, 0x98, 0x78, 0x14, 0x53,
+    0x15, 0x4B, 0x68, 0xA5, 0x03, 0x44, 0x83, 0x7A, 0xBE, 0x33, 0x96, 0x08, 0x43, 0x75, 0x6A, 0xE6,
+    0x98, 0xE8, 0xBE, 0xC0, 0xCF, 0xB9, 0xCC, 0xB8, 0x2A, 0x52, 0x77, 0x0D, 0x45, 0x3D, 0x66, 0x16,
+    0xD5, 0x9F, 0x3D, 0xB5, 0x27, 0xA1, 0x4C, 0xB5, 0x93, 0xA0, 0xCE, 0x74, 0xA1, 0x00, 0x87, 0xB3,
+    0x4A, 0xBA, 0x78, 0x31, 0x0A, 0x3E, 0x76, 0x32, 0x69, 0xAB, 0x87, 0x35, 0x3E, 0xD2, 0xD6, 0x4E,
+    0x84, 0x2C, 0x51, 0x08, 0xAB, 0x1D, 0x01, 0x63, 0x84, 0x6A, 0x95, 0xAD, 0x51, 0x05, 0x34, 0xD2,
+    0x92, 0xFE, 0x4A, 0xF2, 0x47, 0x6C, 0xD7, 0x3D, 0xE5, 0x0F, 0x6C, 0xD5, 0x48, 0x25, 0x72, 0xCB,
+    0xD5, 0x3F, 0x37, 0x50, 0x01, 0xE6, 0x86, 0x57, 0xC5, 0xF4, 0x2B, 0x5C, 0xE2, 0x8C, 0x34, 0xDA,
+    0xCD, 0x08, 0x66, 0xEC, 0x80, 0xD3, 0xD9, 0xF5, 0x90, 0xFF, 0x7F, 0xD5, 0x34, 0x92, 0x1D, 0x98,
+    0x04, 0x18, 0x33, 0x5A, 0x25, 0x77, 0xB9, 0x31, 0xE4, 0xCD, 0xE2, 0x6C, 0xE7, 0xB6, 0xE4, 0x83,
+    0x20, 0xFE, 0xE2, 0x6E, 0x79, 0x0C, 0x19, 0x7B, 0x6D, 0x0F, 0xE4, 0x70, 0x28, 0x96, 0xA1, 0x80,
+    0xDF, 0xE2, 0x90, 0xCC, 0x27, 0x56, 0x3E, 0x48, 0x97, 0x9C, 0xF9, 0xDB, 0xCF, 0x74, 0x20, 0x48,
+    0x9D, 0xA0, 0xEF, 0x48, 0x68, 0x1A, 0x82, 0xC2, 0x18, 0xE4, 0xD6, 0xA1, 0xA5, 0x41, 0x5A, 0x65,
+    0x01, 0xC1, 0xC7, 0x18, 0x08, 0x6F, 0xE6, 0xDE, 0x0B, 0xDA, 0x2C, 0xF8, 0x92, 0x57, 0xA3, 0x79,
+    0xCE, 0x0F, 0xB1, 0x70, 0x16, 0x69, 0xE9, 0x04, 0x4B, 0xDF, 0x92, 0xB9, 0xCF, 0xF5, 0x58, 0x79,
+    0x3D, 0x44, 0xEA, 0x05, 0x88, 0x93, 0xA3, 0xF9, 0x20, 0x50, 0xAC, 0x80, 0x21, 0xC6, 0x43, 0x4C,
+    0x18, 0x90, 0xD1, 0x04, 0xDD, 0x01, 0xCC, 0x1B, 0x98, 0x49, 0x73, 0x06, 0xE5, 0x26, 0x00, 0x1C,
+    0x58, 0xF0, 0x9D, 0x44, 0x69, 0xE9, 0x05, 0x82, 0xC8, 0xC9, 0x34, 0x6D, 0x17, 0x4A, 0x30, 0x00,
+    0x97, 0xCE, 0x34, 0x11, 0x64, 0x3C, 0xBD, 0xE4, 0x14, 0x18, 0xE8, 0x27, 0xCC, 0xEF, 0xCA, 0xB1,
+    0x68, 0x00, 0x5E, 0xA3, 0xD8, 0xA9, 0x93, 0x04, 0xBB, 0x63, 0x57, 0x3F, 0x43, 0x43, 0xB8, 0x36,
+    0x8D, 0xD9, 0x1E, 0xD4, 0xD1, 0x24, 0x07, 0xDE, 0x76, 0x8A, 0xC7, 0x82, 0x87, 0x35, 0xE0, 0x4D,
+    0xC9, 0xB5, 0xAF, 0x78, 0x27, 0xA0, 0x70, 0x10, 0x36, 0x26, 0x32, 0x50, 0x55, 0xDB, 0xA0, 0x64,
+    0x80, 0x87, 0xE1, 0x25, 0x0C, 0x51, 0x11, 0x6A, 0x57, 0xA6, 0x9D, 0x41, 0x30, 0x37, 0x40, 0x6D,
+    0x86, 0x3F, 0x3F, 0x58, 0x55, 0xA4, 0x80, 0x72, 0x0B, 0xC6, 0x3E, 0xDF, 0x5F, 0xAD, 0x14, 0x91,
+    0x76, 0x21, 0xD6, 0xC1, 0xDC, 0x84, 0x8F, 0xDE, 0x83, 0x33, 0x46, 0x51, 0x4C, 0xB5, 0x33, 0x4D,
+    0x12, 0x4E, 0x8F, 0xED, 0xE5, 0x28, 0xD2, 0xD2, 0x9A, 0x10, 0x8A, 0x94, 0x69, 0xF5, 0x99, 0x9D,
+    0x99, 0xAA, 0xB6, 0xCB, 0x71, 0xCE, 0xEF, 0xDF, 0xA2, 0xCD, 0x0D, 0xEC, 0x8F, 0x23, 0xBE, 0xE3,
+    0xEA, 0xC7, 0xA1, 0x5C, 0xDE, 0x26, 0xC6, 0x52, 0xB0, 0x59, 0x2A, 0x98, 0xAA, 0x2C, 0x80, 0xB8,
+    0x22, 0xD5, 0xAE, 0xC6, 0x26, 0xCF, 0x71, 0x20, 0x8E, 0x62, 0xFA, 0x32, 0xEF, 0xD0, 0x08, 0x51,
+    0x77, 0xF3, 0x7E, 0x9A, 0xDE, 0x10, 0x5E, 0x97, 0xDE, 0xFC, 0xE2, 0x0C, 0xE6, 0x98, 0xE7, 0x86,
+    0xCF, 0xE5, 0x8C, 0x90, 0x8D, 0x01, 0x50, 0x13, 0xF3, 0xFD, 0xF6, 0x1B, 0x44, 0x43, 0x2B, 0x08,
+    0xD6, 0xE7, 0xD8, 0xB8, 0x6A, 0xAB, 0x3D, 0x4E, 0x15, 0x96, 0x54, 0x7C, 0xB5, 0x73, 0xD4, 0x31,
+    0x63, 0xF9, 0x21, 0x05, 0x76, 0x0B, 0x04, 0xD0, 0xD2, 0x22, 0x6B, 0x22, 0xAB, 0x01, 0x43, 0x52,
+    0x41, 0x22, 0xED, 0xD3, 0xAF, 0x97, 0x8F, 0x18, 0xA2, 0x70, 0xAD, 0x5D, 0xAC, 0x69, 0xDC, 0xA8,
+    0x27, 0xF5, 0x2B, 0x0B, 0xBF, 0x63, 0x13, 0x50, 0xE8, 0xB0, 0x65, 0xF4, 0x0D, 0x57, 0x9F, 0x4C,
+    0x85, 0xF7, 0xB4, 0x7B, 0x90, 0xF7, 0x7F, 0x7E, 0x57, 0xE1, 0x6C, 0x9D, 0x39, 0x50, 0x83, 0xF5,
+    0xA5, 0x1E, 0x26, 0xEC, 0xCA, 0xEB, 0x41, 0x0E, 0x0B, 0xE1, 0xCC, 0x87, 0xC8, 0x92, 0x6A, 0xAB,
+    0x6F, 0x86, 0x2D, 0xDA, 0xD5, 0x4F, 0x27, 0xF2, 0xFC, 0xC8, 0x8A, 0x27, 0xDF, 0x5F, 0x23, 0x19,
+    0xD0, 0xA4, 0xF9, 0x09, 0x7D, 0xC5, 0x8C, 0xCB, 0xA8, 0x5E, 0xCE, 0x15, 0x6D, 0x96, 0x20, 0xAE,
+    0xE6, 0x3A, 0x9E, 0x6B, 0xB7, 0xBF, 0x23, 0x93, 0xE7, 0x0C, 0xB0, 0x49, 0xB7, 0xDA, 0x4B, 0x32,
+    0xBF, 0x37, 0x20, 0xF3, 0x43, 0x70, 0x3E, 0xF1, 0x5D, 0x33, 0xF6, 0x13, 0x24, 0x35, 0xBC, 0x2C,
+    0x02, 0x65, 0x03, 0x2E, 0x80, 0xA1, 0xA1, 0x84, 0x5C, 0x39, 0x45, 0xC0, 0x82, 0xDA, 0xA9, 0x3A,
+    0x99, 0x80, 0xDF, 0x01, 0xDC, 0xDF, 0x47, 0x98, 0xD3, 0xBC, 0x10, 0xF3, 0x3B, 0xA4, 0x59, 0xED,
+    0x10, 0xEC, 0xE2, 0x3C, 0xA9, 0xEF, 0xE2, 0x5B, 0x61, 0x19, 0x56, 0xA0, 0x81, 0x56, 0x58, 0x14,
+    0xA4, 0xA7, 0x50, 0x61, 0x43, 0x2F, 0x00, 0x6B, 0x17, 0xE9, 0x0B, 0x8C, 0x30, 0xDE, 0x8E, 0x78,
+    0xEB, 0xE5, 0x1D, 0xA0, 0x9B, 0xAE, 0x1E, 0x55, 0xC9, 0x4B, 0xF0, 0xC4, 0xE2, 0x24, 0xEF, 0xD8,
+    0xFF, 0x7E, 0xFE, 0x01, 0xB5, 0x55, 0x31, 0x6F, 0xD5, 0x56, 0x14, 0x3E, 0xF6, 0x25, 0xB1, 0xC4,
+    0x95, 0x72, 0x3B, 0xC0, 0x50, 0x89, 0xCA, 0x0B, 0xAA, 0x68, 0x55, 0x62, 0x06, 0x86, 0xB4, 0x82,
+    0x67, 0x17, 0x86, 0x4A, 0x45, 0x6D, 0x33, 0x90, 0x99, 0x4A, 0xED, 0x80, 0x90, 0x2A, 0x96, 0x0C,
+    0x19, 0x20, 0x36, 0xED, 0xD0, 0xA1, 0x52, 0x79, 0xFF, 0x81, 0x56, 0xA2, 0x74, 0x28, 0x03, 0x03,
+    0x43, 0x5E, 0x7C, 0x15, 0x06, 0x06, 0x06, 0x2E, 0x95, 0x68, 0x87, 0x0E, 0xB8, 0x42, 0x15, 0x52,
+    0x97, 0x58, 0xC5, 0x95, 0x0C, 0xBD, 0xF6, 0xE9, 0x77, 0xFC, 0xF2, 0x12, 0x8A, 0x58, 0x7B, 0xE3,
+    0xD8, 0x7E, 0xC7, 0x3E, 0xE7, 0x7E, 0xE7, 0x3B, 0xE7, 0x7C, 0xA6, 0xA8, 0x26, 0x76, 0xFA, 0x19,
+    0xA5, 0x14, 0x34, 0xA4, 0x1D, 0x25, 0x19, 0x6D, 0x90, 0xAA, 0xC9, 0xD8, 0xA0, 0x23, 0xE3, 0x28,
+    0x2D, 0xF0, 0x88, 0x3C, 0xA9, 0x8A, 0x92, 0xE1, 0xEA, 0xE4, 0xBA, 0x41, 0x61, 0x43, 0x11, 0x93,
+    0x6E, 0x69, 0xBA, 0xB4, 0x85, 0x8F, 0xA7, 0x11, 0xC5, 0xD9, 0x70, 0xDB, 0xD2, 0xFA, 0xDE, 0xED,
+    0x65, 0x44, 0xDD, 0xBB, 0x45, 0x68, 0xDC, 0x52, 0x52, 0x84, 0x5C, 0xCC, 0x97, 0x43, 0x2C, 0x6C,
+    0x57, 0xE0, 0xD1, 0xEC, 0x0A, 0x24, 0x80, 0x65, 0x2A, 0x2A, 0x29, 0x9A, 0x6D, 0x2B, 0x88, 0x04,
+    0x64, 0x4B, 0xB1, 0x35, 0x3D, 0xA5, 0x4E, 0x76, 0x0D, 0xC7, 0x41, 0xC4, 0xA7, 0x1E, 0x73, 0xDF,
+    0x36, 0xB9, 0x3F, 0x14, 0x0E, 0x60, 0x8C, 0xD5, 0x75, 0xE8, 0xE9, 0x00, 0x6E, 0x95, 0x0D, 0x6A,
+    0x84, 0x1F, 0x21, 0x6A, 0xE4, 0x00, 0xD8, 0x53, 0x4E, 0x89, 0x35, 0x55, 0xD4, 0xE0, 0x85, 0xDB,
+    0x53, 0xE0, 0x91, 0x25, 0xB9, 0xD5, 0x19, 0x11, 0x40, 0xC5, 0x19, 0x25, 0x9C, 0xC5, 0xEC, 0xF5,
+    0x3F, 0xBF, 0x15, 0xDD, 0x09, 0x4A, 0xBE, 0x2A, 0x54, 0xBD, 0x4A, 0xB9, 0x06, 0xA0, 0x9A, 0xF2,
+    0x05, 0x52, 0x7F, 0x57, 0x37, 0xD3, 0xBE, 0x24, 0xE6, 0x42, 0xF1, 0x98, 0xA2, 0x62, 0xF0, 0x36,
+    0x3B, 0xDE, 0x44, 0xC1, 0x78, 0x88, 0x8A, 0xDF, 0x11, 0x67, 0xA4, 0xB9, 0x46, 0x06, 0x1D, 0xD0,
+    0xC7, 0x59, 0xD8, 0x46, 0x19, 0x10, 0x10, 0x30, 0x50, 0x70, 0xF1, 0x61, 0x86, 0x10, 0x35, 0x5D,
+    0x7C, 0xFE, 0x1D, 0x05, 0x62, 0xDC, 0xC4, 0x7F, 0x3A, 0xA0, 0x27, 0xE2, 0xE7, 0x3F, 0xD6, 0x39,
+    0x73, 0x1B, 0xFF, 0x5E, 0xFA, 0x20, 0x9B, 0x11, 0x4C, 0xD9, 0x92, 0x79, 0xD4, 0x7B, 0xC5, 0x5C,
+    0x05, 0x6D, 0x5C, 0xA8, 0x0A, 0x34, 0x3A, 0x24, 0x66, 0xE3, 0x4C, 0x55, 0x29, 0xC5, 0xCC, 0xB4,
+    0xC9, 0xEC, 0x56, 0x0F, 0x86, 0x76, 0xC7, 0x05, 0xA9, 0xDC, 0xE5, 0x47, 0xFC, 0x80, 0xAB, 0xBC,
+    0x00, 0x69, 0x95, 0x71, 0xA1, 0x47, 0x85, 0xD3, 0x0F, 0x2A, 0x32, 0x8F, 0x6B, 0x4A, 0x7B, 0xB6,
+    0xFB, 0x4B, 0x76, 0x43, 0x11, 0x99, 0x3D, 0x5E, 0xEF, 0x49, 0xEA, 0x2D, 0x65, 0xA7, 0xA8, 0x41,
+    0x3E, 0x6C, 0xC9, 0x00, 0xE5, 0xAB, 0x0B, 0xFC, 0x16, 0xED, 0xAE, 0x93, 0xAF, 0x2A, 0xB0, 0xD4,
+    0x87, 0x8B, 0x88, 0x9B, 0xA8, 0x9A, 0xA8, 0xDA, 0x84, 0x08, 0xFE, 0xC4, 0xD1, 0xD2, 0x26, 0x19,
+    0x5D, 0xAB, 0x2A, 0xA7, 0xF5, 0xA8, 0xD2, 0xD5, 0x25, 0x2A, 0x0D, 0xE9, 0xA7, 0x96, 0x2E, 0xD7,
+    0x87, 0x75, 0x3B, 0x0A, 0xBC, 0x71, 0x13, 0xC5, 0x1D, 0x25, 0xBB, 0x8D, 0xB5, 0xF5, 0xE4, 0xAF,
+    0xAE, 0x9D, 0xD0, 0x3E, 0xB0, 0xF6, 0x03, 0x7E, 0x0B, 0x60, 0x90, 0x59, 0x81, 0xEF, 0xA0, 0x32,
+    0x74, 0xE3, 0x7D, 0xB7, 0x1A, 0x73, 0x78, 0xC7, 0x36, 0x27, 0xA2, 0x8F, 0xB5, 0x1D, 0x2F, 0x1C,
+    0x1F, 0x11, 0x2D, 0x39, 0x78, 0x3F, 0x3D, 0x5D, 0x91, 0xFA, 0x56, 0x5B, 0x5A, 0x78, 0x27, 0xFE,
+    0xD3, 0xAE, 0xAE, 0xC6, 0xBD, 0xB2, 0xF5, 0x5C, 0x76, 0x14, 0x8E, 0xF0, 0x7E, 0x06, 0xA0, 0x94,
+    0x33, 0x92, 0x9D, 0x5B, 0x46, 0xD4, 0xEF, 0xC7, 0xB9, 0x37, 0xDF, 0x6C, 0x55, 0xB7, 0x4E, 0x18,
+    0xB5, 0x55, 0x5F, 0xDE, 0xFC, 0xAC, 0xEF, 0xE3, 0x4F, 0xF0, 0xF0, 0xED, 0x9F, 0xEE, 0x71, 0x33,
+    0xCB, 0xF2, 0x76, 0x04, 0x12, 0xCB, 0xA0, 0x33, 0x55, 0xEC, 0x7A, 0xEA, 0x91, 0x85, 0x4F, 0xAC,
+    0x6A, 0xD2, 0x22, 0xAA, 0xD3, 0x4C, 0xB9, 0xD1, 0xF0, 0xD2, 0x85, 0x1B, 0xD7, 0x4B, 0xEE, 0x70,
+    0x90, 0xEC, 0x30, 0x3D, 0x0E, 0x94, 0x1D, 0xF7, 0xB0, 0xCC, 0x21, 0x1D, 0x30, 0x52, 0xC4, 0xF4,
+    0x70, 0x79, 0xE9, 0xC8, 0xA6, 0xBB, 0x73, 0xFA, 0xEA, 0xC2, 0xB1, 0x77, 0xDD, 0x35, 0xD5, 0xEA,
+    0x63, 0xEF, 0xB9, 0x6B, 0x5F, 0x3F, 0xFA, 0xE8, 0xD0, 0xD9, 0x37, 0xED, 0x4D, 0x5A, 0x0D, 0xFF,
+    0x98, 0x48, 0xB6, 0x29, 0x9F, 0xE3, 0x07, 0x2B, 0xCB, 0xB4, 0x4C, 0x5C, 0xA5, 0x7C, 0xC6, 0x79,
+    0xAF, 0xEF, 0x17, 0x1B, 0x13, 0x73, 0x97, 0x9B, 0xB8, 0xA3, 0x83, 0x44, 0xE7, 0x65, 0x7A, 0xA6,
+    0xC7, 0xCA, 0xE4, 0xEC, 0xCE, 0xBE, 0x1B, 0x7B, 0x46, 0x4C, 0xC1, 0xC1, 0x95, 0x99, 0x1D, 0xEB,
+    0x75, 0xEC, 0x9F, 0x6D, 0xE6, 0xCA, 0x6D, 0x04, 0xA8, 0x50, 0x22, 0x53, 0x95, 0xCA, 0x88, 0x6D,
+    0xAE, 0x80, 0xF3, 0xFD, 0x37, 0xC6, 0xF4, 0x79, 0xC0, 0xEE, 0x59, 0x7B, 0x7C, 0x11, 0xAD, 0x5C,
+    0x66, 0x65, 0x85, 0x10, 0x09, 0x25, 0x57, 0xF9, 0xCB, 0x7E, 0xDA, 0x86, 0xC7, 0xCD, 0x96, 0x4F,
+    0xB5, 0xFD, 0x74, 0xCA, 0x47, 0x9A, 0xF5, 0x18, 0xC6, 0x94, 0x74, 0x1D, 0xDB, 0xB0, 0xD5, 0x15,
+    0x75, 0x98, 0xC0, 0x94, 0x20, 0x1B, 0x30, 0x46, 0x62, 0xF4, 0xA6, 0xA6, 0x52, 0xFB, 0xD7, 0x52,
+    0xDE, 0xDE, 0x30, 0xFC, 0x6B, 0x1F, 0x6D, 0xBB, 0x3E, 0x94, 0xD6, 0xF0, 0x3B, 0xED, 0x1E, 0xA3,
+    0x57, 0xE1, 0x28, 0x15, 0x91, 0x35, 0xB7, 0x32, 0x14, 0x38, 0xE4, 0xED, 0x71, 0xC8, 0x68, 0x0A,
+    0x6E, 0xE1, 0xDF, 0xAF, 0x81, 0x88, 0x2F, 0xD0, 0x88, 0xF7, 0x32, 0x35, 0x33, 0xC6, 0xDD, 0x1A,
+    0x05, 0xDB, 0x8B, 0x18, 0xF1, 0x7B, 0x40, 0x06, 0x23, 0xAD, 0x21, 0xEC, 0xD1, 0x35, 0xF4, 0xEE,
+    0x51, 0x18, 0xEF, 0x4B, 0xEB, 0x65, 0xC1, 0x2F, 0x18, 0xC1, 0x1C, 0xF6, 0xF9, 0x61, 0x28, 0xA3,
+    0xC7, 0xBE, 0x5F, 0x24, 0x7D, 0xA5, 0x53, 0xF6, 0xF6, 0xFA, 0x7C, 0x46, 0x07, 0xE6, 0x3B, 0xE3,
+    0x81, 0xA4, 0x0D, 0x9A, 0xB0, 0x0E, 0xD1, 0x92, 0x51, 0x95, 0xFA, 0x0B, 0xD7, 0xE9, 0x02, 0x25,
+    0x5E, 0xDF, 0x79, 0xD0, 0x8C, 0x12, 0xF5, 0x73, 0x75, 0x69, 0xD1, 0x5C, 0xE1, 0x5A, 0x86, 0x01,
+    0xBD, 0x70, 0x86, 0xAB, 0x9D, 0x56, 0x88, 0xD1, 0x45, 0xB9, 0x6A, 0xA8, 0x14, 0xF9, 0x34, 0xD0,
+    0x9B, 0xD8, 0xA2, 0x27, 0x86, 0xD6, 0xB0, 0x1D, 0xB5, 0xDA, 0xD2, 0x4B, 0xEB, 0x16, 0x41, 0x4E,
+    0x65, 0xBA, 0x31, 0x52, 0x60, 0x7D, 0x0E, 0x04, 0x4C, 0x48, 0xD4, 0x0E, 0x07, 0xE4, 0x4E, 0x4D,
+    0xD5, 0x03, 0x15, 0x03, 0x3D, 0x71, 0x66, 0x8A, 0x14, 0x82, 0xAB, 0x5A, 0x25, 0x15, 0xE0, 0x53,
+    0x6C, 0x63, 0x3A, 0x59, 0xE7, 0x1E, 0xF3, 0x7E, 0x0E, 0xB1, 0x5A, 0xE0, 0xC2, 0x70, 0x53, 0x8B,
+    0x8E, 0xD3, 0x2E, 0xC1, 0xE4, 0x06, 0x6D, 0x00, 0x41, 0x12, 0x46, 0xB1, 0xB3, 0x4C, 0x6F, 0x4B,
+    0x3B, 0xFA, 0x16, 0xBC, 0x84, 0x03, 0x3A, 0x17, 0x3B, 0x51, 0xD7, 0xB4, 0xDE, 0xC1, 0x01, 0x5D,
+    0xC4, 0x54, 0x43, 0x57, 0x45, 0xFC, 0xDA, 0x41, 0x10, 0xA7, 0x30, 0x2E, 0x45, 0x3D, 0xD8, 0x39,
+    0xA9, 0xB9, 0x1A, 0xD1, 0x48, 0x39, 0x5F, 0xD6, 0x09, 0x8D, 0x47, 0xB9, 0x17, 0x8D, 0x1C, 0xA0,
+    0xE3, 0x53, 0x31, 0x68, 0xB2, 0x6C, 0xBA, 0x4E, 0xD2, 0x47, 0xE8, 0x75, 0x04, 0xCD, 0x59, 0xE6,
+    0x3F, 0x06, 0x59, 0xB7, 0x86, 0x3D, 0xF7, 0xBD, 0x08, 0x40, 0x00, 0x61, 0x6B, 0xC6, 0x76, 0x05,
+    0xF5, 0xAD, 0xBC, 0xBF, 0xA0, 0x8B, 0xA1, 0x21, 0x1A, 0x89, 0x18, 0x4C, 0xE4, 0x53, 0x43, 0xA5,
+    0x13, 0xD3, 0x5C, 0x22, 0x6A, 0x52, 0x04, 0xB5, 0x72, 0xAA, 0x85, 0x70, 0xB6, 0xC4, 0x1F, 0x96,
+    0x76, 0x11, 0x64, 0x70, 0xA5, 0xAD, 0x90, 0x11, 0x34, 0x03, 0x19, 0xA3, 0x81, 0x0C, 0x63, 0x85,
+    0x8C, 0xB0, 0x19, 0xC8, 0x58, 0x9F, 0x92, 0x61, 0x07, 0x32, 0x9A, 0xFF, 0x92, 0xF1, 0xC2, 0x37,
+    0x22, 0x76, 0xC6, 0x07, 0x39, 0x72, 0x4F, 0x86, 0x3F, 0x51, 0xB7, 0xB0, 0x39, 0x5C, 0xF6, 0x86,
+    0x0B, 0x2E, 0x76, 0x1D, 0xDE, 0x18, 0xE4, 0xB4, 0x90, 0x93, 0xB4, 0x6F, 0x24, 0x70, 0xE9, 0xC8,
+    0x6E, 0x52, 0xE7, 0x45, 0xEB, 0xFC, 0xEC, 0x81, 0x91, 0x59, 0x4B, 0xE4, 0x34, 0x12, 0x59, 0xF7,
+    0x22, 0xF8, 0x4D, 0x2E, 0xD4, 0x08, 0x57, 0x2E, 0x15, 0xDA, 0x20, 0xB3, 0x09, 0xA3, 0x17, 0x72,
+    0x39, 0x41, 0xEE, 0x30, 0x40, 0x80, 0x22, 0xB4, 0x55, 0xF0, 0xE4, 0x2E, 0xEF, 0xC3, 0xE9, 0xC8,
+    0xFE, 0xCF, 0xEB, 0x5F, 0xBD, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x9D, 0xB5, 0x13, 0x2C, 0x61,
+    0xC1, 0xA6, 0xA0, 0x40, 0x91, 0x90, 0x1B, 0x6A, 0xDC, 0x52, 0x84, 0xF3, 0x52, 0xA5, 0x48, 0x91,
+    0x14, 0xB8, 0x4E, 0x0A, 0x0A, 0xA4, 0xB4, 0x14, 0x14, 0x01, 0x5B, 0xF0, 0x07, 0x68, 0xE8, 0x29,
+    0xA1, 0x4F, 0x85, 0x48, 0x6C, 0x94, 0x32, 0xCD, 0x4A, 0xFC, 0x00, 0x0E, 0x02, 0xA2, 0x64, 0x0B,
+    0x4B, 0x58, 0xC2, 0xDE, 0xE1, 0xCD, 0xDE, 0x87, 0x42, 0x8D, 0x2E, 0x56, 0x6E, 0xB4, 0xBB, 0xF1,
+    0xCE, 0x9B, 0x79, 0xF3, 0x66, 0x4C, 0x34, 0x7B, 0xE2, 0x1A, 0x26, 0x6F, 0x61, 0x18, 0xAB, 0x78,
+    0xC4, 0x22, 0x32, 0xB4, 0x78, 0x9E, 0xC8, 0x76, 0x80, 0x49, 0xC4, 0x68, 0xF9, 0x6F, 0x2E, 0x66,
+    0x72, 0x0A, 0x33, 0x54, 0x44, 0xAA, 0x83, 0x89, 0x5D, 0x41, 0x94, 0xDA, 0xC2, 0x90, 0x6E, 0x8B,
+    0x9A, 0x72, 0xE6, 0x96, 0x2A, 0x31, 0x23, 0x3C, 0x47, 0x3D, 0x65, 0x36, 0x76, 0x94, 0x4D, 0x71,
+    0x93, 0xC7, 0xCA, 0x47, 0x3C, 0x2E, 0xDC, 0x7F, 0x14, 0xF7, 0x0C, 0x93, 0xFE, 0x42, 0x04, 0xC5,
+    0xB6, 0x25, 0x7A, 0xA6, 0xEA, 0x95, 0x83, 0x47, 0x06, 0x19, 0x66, 0xDF, 0x80, 0x56, 0xE0, 0x3D,
+    0xDA, 0xAA, 0x24, 0xE1, 0xB5, 0x2B, 0x4A, 0x3A, 0xDB, 0x96, 0x54, 0x77, 0x05, 0x5C, 0x63, 0x75,
+    0x6B, 0xFD, 0x0A, 0x70, 0x1F, 0x4B, 0xA1, 0x85, 0x67, 0xBD, 0x8B, 0x54, 0x75, 0x2A, 0x66, 0x5F,
+    0x80, 0x42, 0x50, 0x7B, 0x2B, 0x05, 0x57, 0x65, 0x59, 0x1A, 0x61, 0x3A, 0x44, 0x12, 0x5E, 0xA6,
+    0x84, 0xA5, 0xF4, 0xEA, 0xB7, 0x4B, 0x50, 0xEC, 0xC9, 0x0B, 0x3A, 0x00, 0xE2, 0xB9, 0x95, 0x08,
+    0x9C, 0xA0, 0xD3, 0x89, 0xE6, 0x0E, 0x4C, 0xBD, 0x64, 0x0E, 0x90, 0x6F, 0x10, 0x21, 0xCB, 0x89,
+    0x78, 0x41, 0xA1, 0xD2, 0x69, 0xE2, 0x62, 0xAB, 0x06, 0x3A, 0xA5, 0xE7, 0x54, 0x91, 0xFE, 0xB1,
+    0xDF, 0xE6, 0xBD, 0x66, 0xEE, 0x53, 0xFE, 0xC4, 0xCC, 0x40, 0x3B, 0x7C, 0x0B, 0x5D, 0x71, 0x1B,
+    0x33, 0xBB, 0xD8, 0xD3, 0x00, 0x59, 0x4F, 0xA2, 0x91, 0x34, 0x09, 0x07, 0x52, 0xED, 0x02, 0x41,
+    0x68, 0x07, 0xE7, 0x02, 0x27, 0x87, 0xE1, 0xA0, 0xA7, 0x1B, 0x11, 0xD7, 0x59, 0x0D, 0x94, 0x36,
+    0x61, 0xB6, 0xC8, 0x6F, 0x2E, 0xC6, 0x7B, 0xC2, 0xC9, 0x14, 0xA6, 0xC7, 0xEF, 0x48, 0x22, 0xC4,
+    0xEF, 0xEE, 0xB2, 0x72, 0xF7, 0xA5, 0xAE, 0xED, 0xBC, 0x7D, 0x72, 0x49, 0xE4, 0x20, 0x9C, 0x23,
+    0xF7, 0x47, 0x4A, 0x22, 0x02, 0x51, 0x36, 0x1A, 0x94, 0x03, 0xD6, 0x11, 0x15, 0xF5, 0x1D, 0x10,
+    0x05, 0x1E, 0x9D, 0xA8, 0x1F, 0x10, 0x02, 0x25, 0x49, 0xCE, 0x0F, 0x0D, 0xA2, 0x3A, 0x26, 0x4F,
+    0x0F, 0xA8, 0x7A, 0x53, 0xC9, 0xF5, 0xB6, 0x91, 0x37, 0xE6, 0x4F, 0x3A, 0xC7, 0xCA, 0x71, 0xBB,
+    0x40, 0x48, 0xD7, 0xCD, 0xAA, 0xA0, 0x14, 0x18, 0x57, 0x60, 0x53, 0xFD, 0x71, 0x14, 0xF5, 0x13,
+    0xA2, 0xE3, 0xD8, 0xAC, 0x08, 0x6A, 0xA2, 0x21, 0xA6, 0x73, 0x47, 0xE9, 0x67, 0x60, 0x9A, 0x8D,
+    0x70, 0xB6, 0x5E, 0x96, 0x7B, 0x89, 0xA8, 0x06, 0xEF, 0x99, 0xD4, 0x25, 0x6D, 0x2C, 0x50, 0x9E,
+    0x9E, 0x86, 0x0A, 0xCA, 0xC8, 0x4A, 0xD9, 0x43, 0xD6, 0x88, 0xD0, 0x43, 0x61, 0xB3, 0x43, 0x85,
+    0xB2, 0x46, 0x36, 0xEE, 0xA9, 0x53, 0xBE, 0x1C, 0x70, 0x9D, 0xA3, 0x99, 0x22, 0x42, 0x91, 0xA0,
+    0xE5, 0xAA, 0x0D, 0x11, 0x86, 0xFA, 0x94, 0xA5, 0x82, 0x87, 0xA6, 0x17, 0x67, 0x10, 0x00, 0x04,
+    0x8D, 0x3F, 0xF8, 0x69, 0x82, 0x26, 0x3C, 0xA9, 0x91, 0xA0, 0x1A, 0x74, 0x05, 0x42, 0x4F, 0x7A,
+    0x68, 0xD7, 0x34, 0x33, 0x57, 0x14, 0xD5, 0x94, 0x38, 0xD2, 0x03, 0xE9, 0x6E, 0x3E, 0x2E, 0x95,
+    0x70, 0xE2, 0x29, 0xF7, 0xA1, 0x8B, 0x70, 0x1D, 0xAE, 0xA0, 0x98, 0xA4, 0xBB, 0xB4, 0x07, 0x13,
+    0xE9, 0x72, 0x5F, 0xD5, 0x2A, 0xE4, 0x36, 0x1F, 0xB6, 0x10, 0x54, 0xD3, 0xD2, 0xE9, 0x00, 0xED,
+    0x9B, 0x07, 0x61, 0x06, 0xFE, 0xA7, 0xC7, 0x6C, 0xDB, 0xEA, 0x8B, 0x3E, 0x46, 0x43, 0x6D, 0xAC,
+    0xCD, 0xE8, 0x04, 0x9B, 0xBD, 0x64, 0x8B, 0xFC, 0x45, 0xF7, 0x7E, 0xE9, 0x61, 0xB9, 0x47, 0xEE,
+    0xF9, 0x62, 0xAF, 0x3C, 0xDA, 0xB4, 0x0B, 0x2D, 0xBC, 0xF9, 0xE1, 0x35, 0xB8, 0x46, 0x03, 0xA2,
+    0x7B, 0x7B, 0xDA, 0x71, 0x79, 0x07, 0xBA, 0x72, 0xA9, 0x45, 0xD1, 0x22, 0x9C, 0xC6, 0x80, 0x77,
+    0xBF, 0xC9, 0xEF, 0x92, 0xAE, 0x61, 0x97, 0xDB, 0x6C, 0x0A, 0x06, 0x2B, 0xD4, 0x1B, 0x71, 0x65,
+    0x56, 0x8B, 0x3C, 0x8A, 0x3A, 0x73, 0x8A, 0x0F, 0xD9, 0xC0, 0xC3, 0x14, 0x15, 0xF9, 0xBE, 0x6C,
+    0x9D, 0x6B, 0x32, 0x8B, 0xA3, 0x71, 0x8B, 0xE6, 0xC3, 0x38, 0xDE, 0x71, 0x74, 0xF9, 0x29, 0x8D,
+    0x2A, 0x4D, 0x86, 0x2A, 0x21, 0x33, 0x77, 0x8D, 0x4D, 0xC4, 0x06, 0x63, 0xB3, 0x18, 0x08, 0x55,
+    0x61, 0x9B, 0xA1, 0x5E, 0x1E, 0x3A, 0x4D, 0xBE, 0xB8, 0x1C, 0x9F, 0x93, 0xEA, 0x15, 0x8A, 0x72,
+    0x36, 0x60, 0x46, 0x0D, 0xD9, 0xCF, 0x29, 0x65, 0x35, 0x9F, 0x50, 0xD4, 0xA5, 0xF0, 0x5B, 0xC8,
+    0x95, 0xD8, 0xA1, 0xBD, 0x65, 0x60, 0xF4, 0x32, 0xDB, 0x20, 0x2A, 0xB6, 0x49, 0x40, 0xDB, 0x58,
+    0xA0, 0xDD, 0x94, 0xDA, 0x4A, 0x8F, 0x67, 0x6E, 0xF1, 0x59, 0xBC, 0xBD, 0x08, 0xF4, 0x3D, 0x46,
+    0x00, 0xD8, 0x80, 0xA6, 0x3A, 0xC5, 0x0F, 0xB9, 0xAD, 0xDA, 0x78, 0x44, 0xF9, 0xF3, 0xAF, 0x4C,
+    0x91, 0x07, 0x6D, 0xF9, 0xC5, 0x80, 0x05, 0x74, 0x24, 0x8B, 0x78, 0x14, 0x41, 0x9D, 0x0D, 0x94,
+    0xF6, 0x85, 0x55, 0x10, 0x21, 0x55, 0x56, 0xFB, 0x46, 0x28, 0x04, 0xA1, 0xCD, 0xF8, 0x4F, 0x8E,
+    0x50, 0x13, 0xA9, 0x30, 0x89, 0xE4, 0xD3, 0x60, 0x2F, 0x7D, 0x81, 0x57, 0x07, 0xFA, 0x17, 0xBD,
+    0x55, 0xB1, 0x6E, 0x1D, 0x45, 0x14, 0x3D, 0x3B, 0x63, 0x7B, 0x85, 0x56, 0x30, 0x2E, 0x40, 0xA2,
+    0x40, 0x5A, 0x0A, 0x1A, 0x1A, 0xF6, 0x07, 0xB0, 0x66, 0x09, 0x45, 0x8A, 0x14, 0xA1, 0xF0, 0xAB,
+    0xE9, 0x69, 0xF8, 0x02, 0xB4, 0x83, 0x5C, 0xA4, 0xF5, 0x1F, 0x50, 0x47, 0x14, 0xA4, 0x48, 0x11,
+    0x89, 0xF8, 0xED, 0x82, 0x0B, 0xDA, 0x8D, 0x5C, 0x50, 0xB2, 0x09, 0x45, 0x8A, 0x14, 0x1E, 0xA1,
+    0x45, 0x1E, 0xE3, 0xD9, 0xBD, 0x9C, 0x79, 0xEF, 0xD9, 0x8F, 0x50, 0x62, 0x85, 0xD1, 0x9B, 0xD1,
+    0xEC, 0xDB, 0x3B, 0xF7, 0x9C, 0xB9, 0xF7, 0xDC, 0xBB, 0xC0, 0x6A, 0x9C, 0x70, 0x56, 0x1E, 0x28,
+    0xCE, 0x3B, 0xA8, 0xF1, 0x00, 0x38, 0xC8, 0xDC, 0xFA, 0xCD, 0xDE, 0x43, 0xC0, 0xC8, 0x84, 0x5C,
+    0x64, 0xCC, 0xE4, 0x33, 0xE9, 0x9A, 0x4E, 0x4F, 0x66, 0x44, 0xF5, 0x5C, 0xA0, 0xE6, 0xAA, 0x47,
+    0xF5, 0x7B, 0xE4, 0xC6, 0x76, 0xAB, 0x8D, 0x9E, 0xB8, 0xB1, 0xA7, 0x11, 0x45, 0xB0, 0x7D, 0x26,
+    0x4A, 0xD0, 0xF4, 0x66, 0x6E, 0x47, 0x34, 0x74, 0x81, 0x76, 0xC2, 0x66, 0x7C, 0xB4, 0x03, 0x94,
+    0x7F, 0xF4, 0xD0, 0x12, 0x81, 0x4F, 0x6D, 0xCD, 0xBF, 0xEA, 0xCD, 0xAB, 0xAF, 0x8E, 0x01, 0x91,
+    0x9E, 0x27, 0xA4, 0x2E, 0xC7, 0x32, 0xE6, 0x11, 0xB6, 0x97, 0x5A, 0xCD, 0xA5, 0x47, 0xF5, 0x62,
+    0xDA, 0x62, 0xAD, 0x36, 0xF6, 0x8C, 0xA0, 0x91, 0x9B, 0xF6, 0x68, 0x42, 0xE9, 0x2B, 0x9F, 0x4F,
+    0x90, 0x57, 0x52, 0xE7, 0xC9, 0x45, 0xC1, 0xF9, 0x8F, 0x51, 0xDE, 0x25, 0x60, 0x98, 0x01, 0x6B,
+    0x3A, 0xE2, 0xED, 0xBF, 0x41, 0xC0, 0x1D, 0xEC, 0x3F, 0xD1, 0x67, 0xC1, 0x1E, 0x5D, 0x05, 0x2D,
+    0x2E, 0x79, 0x0C, 0xFA, 0x8A, 0x8F, 0x21, 0xE8, 0xDE, 0xED, 0x5E, 0x13, 0xDA, 0x7B, 0xA8, 0x1D,
+    0xAC, 0x5C, 0x0C, 0x09, 0x9B, 0x4B, 0xDF, 0x78, 0x30, 0xBC, 0xB4, 0xEE, 0x78, 0xAA, 0x1C, 0xF4,
+    0xF9, 0x50, 0x8C, 0xFA, 0xD7, 0xA0, 0x63, 0xFE, 0x6C, 0x86, 0xE4, 0x7D, 0xE3, 0xEC, 0x83, 0xBE,
+    0xEA, 0xCD, 0xCB, 0xCE, 0x78, 0x2D, 0x5D, 0x1E, 0x20, 0xC9, 0x7C, 0x45, 0xA2, 0x90, 0x1F, 0xD2,
+    0x92, 0x52, 0xF5, 0xB3, 0x8C, 0x80, 0xDB, 0x5E, 0xFC, 0x9D, 0xB4, 0xB4, 0x9C, 0x99, 0x5C, 0xEF,
+    0xF0, 0xFE, 0xFA, 0xD5, 0xEE, 0xA2, 0x5E, 0x1C, 0xB6, 0xA2, 0xE5, 0x4F, 0x19, 0x8B, 0xB9, 0x16,
+    0xE4, 0x5E, 0x07, 0x54, 0xAE, 0xEC, 0x31, 0xD3, 0x50, 0x8F, 0x74, 0x6F, 0x88, 0x86, 0x06, 0xD6,
+    0xA9, 0x90, 0x4D, 0x30, 0x7D, 0xE1, 0x61, 0x49, 0x31, 0x8B, 0x10, 0x98, 0x41, 0x25, 0x3B, 0xDE,
+    0x3E, 0x50, 0x26, 0xE2, 0xC8, 0x60, 0xC0, 0x6B, 0x43, 0x31, 0xD6, 0x3C, 0x4D, 0x15, 0x31, 0xD5,
+    0xA0, 0x05, 0x94, 0xFB, 0xBF, 0xB0, 0xBF, 0xE1, 0xCC, 0x13, 0xEC, 0x92, 0x4B, 0x31, 0x8C, 0x5B,
+    0x5D, 0xBF, 0x71, 0x6C, 0x43, 0xB1, 0x61, 0xB6, 0x8E, 0xAE, 0x88, 0x9D, 0x6D, 0xE4, 0x9D, 0x2D,
+    0xBE, 0x78, 0x6F, 0x51, 0x49, 0x27, 0x53, 0x33, 0x29, 0x39, 0x5E, 0x39, 0x9B, 0xC9, 0x2C, 0x1F,
+    0x09, 0x53, 0x75, 0xA0, 0x96, 0xA0, 0x3D, 0xB1, 0xCB, 0xCE, 0x0C, 0x58, 0xA2, 0xA9, 0xF5, 0xA8,
+    0xB6, 0x4C, 0x3A, 0x72, 0x6C, 0x69, 0x97, 0x89, 0xCC, 0xAC, 0x1D, 0x42, 0x2A, 0xE2, 0xBF, 0x36,
+    0x3E, 0x48, 0xD8, 0x84, 0xA6, 0x22, 0x28, 0x58, 0x3E, 0x7C, 0x8C, 0x1B, 0xE4, 0xC3, 0x46, 0x8C,
+    0x9C, 0x8A, 0x6B, 0x06, 0xCA, 0x67, 0x24, 0xFD, 0x25, 0xD9, 0x99, 0x54, 0xB0, 0x1E, 0x59, 0x64,
+    0x0F, 0x30, 0xE7, 0x8C, 0x4E, 0xEB, 0x37, 0x41, 0x23, 0x79, 0x90, 0xD8, 0x5A, 0x30, 0x24, 0xC0,
+    0xEC, 0xA5, 0x49, 0xA7, 0xD5, 0x4A, 0xE7, 0x8B, 0x43, 0x0A, 0x8A, 0x4F, 0x2C, 0x6F, 0x90, 0x3B,
+    0x95, 0x9C, 0xD4, 0x1C, 0xD0, 0xDC, 0x8D, 0x68, 0xB3, 0x14, 0x1E, 0x8A, 0x96, 0x57, 0x9A, 0x55,
+    0xCC, 0xA6, 0x62, 0x54, 0x73, 0x3B, 0xE8, 0xC4, 0x7B, 0x3E, 0x06, 0x95, 0x4B, 0xCD, 0xD7, 0x68,
+    0x65, 0x9D, 0x8D, 0xE3, 0xD4, 0x7F, 0xF8, 0xCC, 0xF3, 0xC4, 0xA9, 0x1C, 0xE1, 0x4D, 0x67, 0x53,
+    0xCE, 0x48, 0x4F, 0x8F, 0x05, 0xBD, 0xC7, 0x9C, 0x98, 0x8D, 0x66, 0x94, 0xAB, 0x23, 0xDA, 0x98,
+    0x67, 0xB4, 0xD1, 0xBE, 0x71, 0x64, 0x5E, 0x24, 0x6F, 0x68, 0x6B, 0x1E, 0x24, 0x4D, 0xD3, 0x33,
+    0xA8, 0xDA, 0xF3, 0x78, 0x16, 0x97, 0x5F, 0x3B, 0x2C, 0x57, 0xBC, 0x3E, 0xA7, 0xF7, 0x54, 0xF6,
+    0x4C, 0x34, 0x03, 0x73, 0x87, 0x27, 0xB2, 0xBF, 0xD2, 0x25, 0x9B, 0xD4, 0x93, 0x8A, 0x75, 0x10,
+    0xF7, 0x38, 0xD9, 0xFB, 0xC0, 0xFF, 0x55, 0x4A, 0x1A, 0xEF, 0x95, 0x6D, 0x0A, 0x3A, 0x51, 0x7B,
+    0x39, 0x30, 0xDD, 0xB5, 0x7D, 0x10, 0x55, 0x4C, 0xBC, 0x6C, 0xDD, 0x22, 0xEA, 0x50, 0x78, 0xD3,
+    0xDB, 0xCE, 0x32, 0xD6, 0xD3, 0x27, 0xE1, 0x68, 0xBE, 0x90, 0xFB, 0x62, 0x42, 0x39, 0xD8, 0x7F,
+    0xD5, 0xDF, 0xD3, 0x35, 0x32, 0xEF, 0x94, 0x25, 0x02, 0x9B, 0xA4, 0xA4, 0x78, 0x7E, 0xE7, 0x4A,
+    0x16, 0x2D, 0xBB, 0x4D, 0xE1, 0x2B, 0x67, 0x31, 0xA9, 0xA8, 0xBD, 0x19, 0x2A, 0xFA, 0x17, 0xF0,
+    0x6A, 0x7A, 0xFC, 0xF1, 0x85, 0xB9, 0xFA, 0x6D, 0xB2, 0xD1, 0x0E, 0x8D, 0x9B, 0x37, 0x2E, 0xDF,
+    0xE5, 0xE5, 0x49, 0xCF, 0x7A, 0xA8, 0x0B, 0xF6, 0x60, 0x06, 0xC8, 0xBF, 0x7D, 0x3B, 0xA6, 0x59,
+    0x5D, 0xC3, 0xFE, 0x52, 0xA7, 0x8E, 0x6C, 0xA8, 0x3D, 0xB6, 0xB0, 0xD5, 0x60, 0x97, 0x34, 0x97,
+    0x81, 0x82, 0xEB, 0x0D, 0x3B, 0x7E, 0xAB, 0x02, 0xC9, 0xF5, 0x24, 0x97, 0xB2, 0x4A, 0xF1, 0x78,
+    0xD3, 0xB5, 0xCE, 0xDE, 0x5B, 0x7E, 0x28, 0x27, 0x72, 0x26, 0xA7, 0x73, 0x1E, 0xCC, 0xB6, 0x0E,
+    0x0E, 0x4A, 0xF6, 0x5B, 0x56, 0x0E, 0xE5, 0xB5, 0x93, 0xDD, 0xD2, 0xDD, 0xC9, 0xBA, 0x81, 0x3C,
+    0x7A, 0x0C, 0xFD, 0x53, 0x0F, 0xF3, 0x25, 0xDB, 0x39, 0xEF, 0xBF, 0x7B, 0xAB, 0x0B, 0x67, 0x54,
+    0xCC, 0xA5, 0x1D, 0xD9, 0xFD, 0x85, 0xD6, 0xE5, 0x10, 0x0B, 0x5F, 0x76, 0x91, 0xC7, 0xEF, 0x8C,
+    0xA4, 0x54, 0xD0, 0xB0, 0x6D, 0x6B, 0xA6, 0x21, 0xC0, 0x6A, 0xA9, 0xF7, 0xED, 0x3D, 0x81, 0xB7,
+    0xE7, 0xCD, 0xF7, 0x9E, 0xB9, 0x10, 0x16, 0x68, 0x71, 0xF3, 0x3D, 0xA3, 0x23, 0xF6, 0xE2, 0xA8,
+    0x2F, 0x9F, 0x9A, 0x61, 0xBF, 0xE4, 0xE7, 0x82, 0x8A, 0xAB, 0xD3, 0xAF, 0xE1, 0xEA, 0x1E, 0x51,
+    0xD5, 0x2C, 0x99, 0x62, 0x95, 0x3C, 0x35, 0x30, 0x28, 0xC0, 0x93, 0xA4, 0x83, 0xA2, 0xC7, 0x5B,
+    0xEB, 0x5E, 0x7C, 0xB0, 0x92, 0x06, 0xAB, 0x88, 0x2A, 0xDF, 0x68, 0xEE, 0xDA, 0xA7, 0x9F, 0x4C,
+    0x17, 0xCB, 0x6F, 0x43, 0x45, 0x42, 0x0C, 0x0E, 0xEB, 0x8B, 0x54, 0xF0, 0xD8, 0xBE, 0x1A, 0x6F,
+    0x7C, 0xFE, 0xF7, 0xF1, 0x37, 0xB5, 0x55, 0xB1, 0x72, 0xDD, 0x44, 0x14, 0x3D, 0x92, 0x0C, 0xCA,
+    0xA0, 0xC9, 0xAC, 0x8B, 0x14, 0x34, 0xB0, 0xF9, 0x82, 0x2C, 0x65, 0x0A, 0x60, 0x15, 0x5C, 0xB8,
+    0x24, 0x05, 0xF9, 0x02, 0x1A, 0x86, 0x9A, 0x32, 0xCE, 0xCA, 0x43, 0x91, 0xCC, 0x50, 0xE4, 0x13,
+    0x68, 0x99, 0x34, 0x34, 0x74, 0x38, 0x7E, 0x1B, 0x5E, 0x91, 0xC2, 0x85, 0x35, 0x34, 0x94, 0x88,
+    0x40, 0x97, 0xC2, 0x32, 0xD6, 0x0C, 0x82, 0xEC, 0xEA, 0x72, 0x56, 0x7A, 0xCF, 0xA6, 0x4E, 0x86,
+    0x9D, 0xF7, 0x56, 0xF6, 0xEA, 0xDD, 0x73, 0xEF, 0x3D, 0xF7, 0xDE, 0xB3, 0x00, 0x57, 0xD1, 0x20,
+    0xEF, 0x91, 0x05, 0x80, 0x9F, 0xFB, 0xC0, 0x35, 0xCC, 0xAB, 0x46, 0x35, 0x41, 0x89, 0x57, 0xEB,
+    0x41, 0xF9, 0x50, 0x76, 0x0F, 0xF2, 0xFE, 0x18, 0xD3, 0x04, 0x3B, 0x42, 0xB7, 0x3B, 0x45, 0x5F,
+    0xD5, 0xF2, 0x7D, 0x6B, 0xA4, 0xCD, 0xA5, 0x59, 0x0C, 0xEE, 0xA2, 0x18, 0xA0, 0x02, 0xCC, 0x01,
+    0x8E, 0x0C, 0xFA, 0xEB, 0x1B, 0x14, 0x33, 0x42, 0x42, 0xD1, 0x47, 0x82, 0xE8, 0xC3, 0xD1, 0x54,
+    0x9D, 0x5D, 0x35, 0xC4, 0x70, 0xF5, 0xAE, 0xC5, 0x0F, 0xF6, 0xE5, 0x40, 0x08, 0x3A, 0xDA, 0x2C,
+    0xB5, 0xEF, 0xD5, 0xEF, 0x43, 0xD1, 0x07, 0xEC, 0xEE, 0xCC, 0x07, 0xDC, 0x57, 0x1D, 0x01, 0x10,
+    0x6C, 0x1D, 0x94, 0x7F, 0x50, 0x76, 0x44, 0x50, 0x67, 0x5D, 0x21, 0x4D, 0x16, 0x51, 0x13, 0x42,
+    0xFD, 0x13, 0x73, 0x89, 0xC9, 0x4D, 0x5A, 0x59, 0x53, 0xB4, 0x65, 0x9F, 0x8F, 0x78, 0x8A, 0xF7,
+    0xF8, 0xEF, 0xAE, 0x1E, 0xED, 0x58, 0x10, 0xB0, 0xEC, 0x69, 0xD6, 0x2A, 0xAF, 0xBD, 0x79, 0x64,
+    0xA3, 0x0D, 0xA6, 0x5B, 0x1C, 0x32, 0x79, 0x9B, 0x72, 0x57, 0x1E, 0x47, 0xC0, 0x9C, 0xC9, 0x2E,
+    0x5C, 0x82, 0x47, 0x44, 0xD1, 0x43, 0x7B, 0x1C, 0xCF, 0x79, 0x79, 0x38, 0xE4, 0x63, 0xA3, 0xA4,
+    0xB6, 0x01, 0xAB, 0x25, 0xE5, 0xB7, 0xD2, 0x1B, 0xF1, 0xE6, 0xA0, 0xFA, 0xA9, 0x9B, 0xF3, 0xCD,
+    0xA0, 0x47, 0x9A, 0xF2, 0xD4, 0xA2, 0xEC, 0x69, 0xA9, 0x5A, 0x92, 0xAA, 0x3D, 0x0D, 0x6D, 0x2C,
+    0xF8, 0xCB, 0x8D, 0x57, 0xBD, 0xEF, 0x27, 0xBB, 0xD7, 0x87, 0x8C, 0xFC, 0x24, 0xAB, 0x72, 0xA6,
+    0x95, 0x3F, 0x9E, 0x63, 0xA9, 0x3A, 0xD8, 0x9A, 0x76, 0x44, 0x30, 0x8F, 0x20, 0x03, 0x0D, 0xAB,
+    0x71, 0xCB, 0x10, 0xBE, 0xFA, 0x00, 0xFA, 0xAC, 0x86, 0xF3, 0x28, 0x03, 0x32, 0xE9, 0x70, 0xCD,
+    0x02, 0xF9, 0x00, 0x23, 0x0C, 0x2E, 0x14, 0xD3, 0xCA, 0x4B, 0x1E, 0xB4, 0xD7, 0xEB, 0x31, 0x23,
+    0x67, 0xE6, 0xEB, 0xBE, 0x18, 0x1C, 0x5C, 0x31, 0xA8, 0xD6, 0xBE, 0x1C, 0x33, 0x11, 0x94, 0x9B,
+    0x82, 0xE5, 0x35, 0x51, 0x4E, 0xEA, 0x82, 0xE4, 0x2A, 0xBA, 0xC6, 0x42, 0x78, 0x86, 0xDD, 0x32,
+    0xAA, 0xDE, 0xFE, 0x2D, 0xA4, 0x99, 0x95, 0x62, 0xD1, 0x65, 0x6F, 0x28, 0x47, 0xE5, 0x8D, 0x77,
+    0x98, 0x8A, 0x31, 0x21, 0x69, 0xEF, 0x6E, 0xB8, 0x4C, 0x5E, 0x84, 0x4A, 0x3E, 0x6D, 0xD5, 0x92,
+    0x54, 0x4E, 0x32, 0xDB, 0xB9, 0x87, 0x8C, 0x47, 0xC6, 0x78, 0xAF, 0x6F, 0x38, 0x82, 0x89, 0x70,
+    0xE2, 0xDD, 0xC3, 0xD1, 0x36, 0x42, 0xFE, 0x4F, 0xBB, 0xEA, 0x62, 0x28, 0xC6, 0x88, 0xE8, 0x6A,
+    0xC7, 0xA8, 0xF6, 0xA2, 0xF3, 0x4E, 0x9A, 0x52, 0xEA, 0xCB, 0x1C, 0x71, 0x1B, 0xA8, 0xFC, 0xDC,
+    0x93, 0x4C, 0xAE, 0xF4, 0xC0, 0xCD, 0x25, 0xB8, 0x1A, 0xB9, 0xB4, 0x29, 0x09, 0xA2, 0xA9, 0xCE,
+    0x3E, 0x0B, 0x79, 0xB0, 0x8D, 0x59, 0x13, 0xCE, 0xD6, 0x76, 0x7F, 0x28, 0x7B, 0x5B, 0xC7, 0x82,
+    0x78, 0x9A, 0xBC, 0xB8, 0x61, 0x03, 0x76, 0x03, 0x89, 0x4F, 0xD3, 0xA7, 0xCE, 0xD4, 0xA5, 0x57,
+    0x75, 0xF7, 0x5A, 0x81, 0x65, 0xE4, 0x4B, 0xDE, 0x47, 0x6A, 0xF9, 0xF5, 0x78, 0x49, 0xD7, 0x6B,
+    0x45, 0xC4, 0x35, 0x1C, 0xC0, 0x3C, 0x6E, 0x73, 0x76, 0xFA, 0x4E, 0xF6, 0x46, 0x48, 0x4F, 0x01,
+    0x8E, 0x4F, 0x4C, 0x7D, 0xFB, 0xE5, 0x93, 0xEF, 0x56, 0x12, 0xB9, 0xA7, 0xF3, 0xA3, 0xAB, 0x73,
+    0x52, 0x40, 0x1F, 0xAB, 0x3F, 0x13, 0x7A, 0x97, 0x4D, 0xBA, 0x43, 0x2C, 0x02, 0x7B, 0x42, 0x60,
+    0xF7, 0xCE, 0xBC, 0x7A, 0x7E, 0xD2, 0x15, 0xAF, 0xD6, 0x43, 0x26, 0x87, 0x01, 0xB6, 0x89, 0x50,
+    0xE7, 0xC2, 0xC1, 0xE7, 0xF0, 0xEB, 0x88, 0x6C, 0x5B, 0x44, 0x7C, 0x88, 0xB9, 0x1E, 0xC5, 0x38,
+    0x77, 0x1B, 0x32, 0x8F, 0x65, 0x58, 0x60, 0x86, 0xF2, 0x5C, 0x3A, 0xDB, 0x30, 0x3C, 0x84, 0x34,
+    0x69, 0xA4, 0xB2, 0x99, 0xE8, 0x82, 0x63, 0x67, 0xBC, 0x7E, 0x26, 0x38, 0xD6, 0xE1, 0xF3, 0xE9,
+    0x42, 0x4E, 0x45, 0x05, 0xDD, 0x9B, 0xE6, 0x8A, 0x84, 0x34, 0xA2, 0xC4, 0x64, 0xC3, 0xA7, 0x3A,
+    0x53, 0x85, 0xF0, 0xF6, 0x56, 0x7C, 0xB0, 0x6A, 0xF5, 0x73, 0xD9, 0xE2, 0xA4, 0xC1, 0x75, 0x38,
+    0x5E, 0xBA, 0x4F, 0xF9, 0x15, 0x5C, 0x19, 0xF2, 0xD1, 0x9D, 0x3F, 0x7E, 0x75, 0x2A, 0x36, 0xD8,
+    0xDE, 0xF9, 0xE3, 0xAB, 0x62, 0x73, 0x6C, 0x61, 0x7B, 0x14, 0x7F, 0x79, 0x98, 0xAA, 0xC9, 0x36,
+    0x4A, 0xF4, 0x46, 0x91, 0xDE, 0x37, 0x1C, 0x75, 0xCE, 0xC9, 0xBA, 0xDB, 0xD4, 0x3D, 0x3D, 0xAA,
+    0x98, 0x05, 0xC7, 0x52, 0xB1, 0x55, 0x28, 0x44, 0x21, 0x0B, 0x49, 0x64, 0x36, 0xE8, 0x15, 0xD1,
+    0x9D, 0x37, 0x0F, 0xE5, 0x5D, 0x39, 0x92, 0x0B, 0x59, 0x4B, 0x19, 0xAA, 0xEE, 0x2A, 0x71, 0x28,
+    0x7E, 0xCB, 0x76, 0x89, 0x35, 0xD1, 0x89, 0xF4, 0xBD, 0xB9, 0x7D, 0xBB, 0x83, 0x6A, 0xD0, 0x6D,
+    0x25, 0x24, 0xDB, 0xF8, 0x89, 0xAE, 0x19, 0x4A, 0xE4, 0x8C, 0x72, 0x9A, 0x51, 0xFE, 0x36, 0x70,
+    0xBC, 0x58, 0x5D, 0xFB, 0x11, 0x61, 0xCE, 0x08, 0x21, 0xB4, 0x48, 0x3D, 0x6A, 0x19, 0x2F, 0xF5,
+    0x2A, 0x69, 0xD5, 0x6D, 0x3E, 0xB5, 0xF8, 0x65, 0xD6, 0x8F, 0x37, 0xF2, 0x9C, 0x04, 0x7D, 0x39,
+    0x51, 0x1B, 0xCF, 0xA9, 0xA0, 0x78, 0xCA, 0x1A, 0x5B, 0x45, 0x89, 0x3B, 0xA5, 0x36, 0x9C, 0xAD,
+    0x7C, 0x2E, 0xFB, 0x3D, 0xE4, 0x0E, 0x7B, 0x81, 0x94, 0xAB, 0xD6, 0x34, 0x65, 0xAF, 0xDA, 0x7C,
+    0xA4, 0x1A, 0xC5, 0x24, 0x6C, 0xBF, 0x50, 0xD0, 0x28, 0x19, 0x95, 0x8C, 0xD4, 0x43, 0xCC, 0x1D,
+    0x96, 0x8A, 0x07, 0xF3, 0x07, 0x9F, 0x04, 0x7F, 0xE7, 0xC9, 0x25, 0x6D, 0xB7, 0x54, 0x0D, 0x7D,
+    0xD2, 0xA1, 0xFA, 0x99, 0xBE, 0xEA, 0xDD, 0xED, 0x71, 0x8D, 0xD5, 0x9D, 0x88, 0x55, 0x6F, 0x9B,
+    0x3C, 0x50, 0x3C, 0xEC, 0x27, 0x49, 0xFA, 0x22, 0xD1, 0x08, 0xF3, 0x40, 0xD3, 0xE4, 0x1B, 0x8F,
+    0xE2, 0x82, 0x21, 0x4E, 0x4B, 0x21, 0xC1, 0xE0, 0xE6, 0xBE, 0x9B, 0xC3, 0x0D, 0x28, 0x0E, 0x93,
+    0xF0, 0xF1, 0x6F, 0x37, 0x2E, 0xBD, 0x93, 0x3A, 0xF4, 0x1E, 0x09, 0x30, 0xCC, 0x98, 0x31, 0x78,
+    0xFC, 0x77, 0x7D, 0x91, 0xB4, 0x29, 0x19, 0x96, 0x69, 0x53, 0x29, 0x5C, 0x93, 0xB6, 0x8F, 0x13,
+    0x2D, 0xC1, 0x11, 0x95, 0xFA, 0x48, 0x36, 0xE8, 0xBC, 0x62, 0x21, 0xC9, 0x1E, 0x79, 0x34, 0x42,
+    0x14, 0x97, 0x36, 0xDE, 0x2C, 0x94, 0x6F, 0x5E, 0x79, 0xE9, 0x32, 0xE8, 0x68, 0x29, 0xD1, 0x4D,
+    0xE9, 0xC2, 0x49, 0xF4, 0x72, 0x58, 0x71, 0xEF, 0xB3, 0x8D, 0x6E, 0xB2, 0x08, 0xDF, 0x36, 0x9A,
+    0x6F, 0x26, 0xDD, 0x57, 0x6C, 0x1E, 0x8B, 0x98, 0xB3, 0xCB, 0x54, 0x67, 0xBC, 0xAD, 0x85, 0x2D,
+    0xC1, 0xE6, 0xFD, 0xF1, 0x85, 0x7A, 0xF5, 0x2B, 0xAF, 0x1F, 0xDB, 0xB9, 0x66, 0x7B, 0xE9, 0x5D,
+    0x4B, 0xDD, 0x7E, 0x2B, 0xCD, 0x93, 0x39, 0x4B, 0xB5, 0x49, 0xE7, 0xD9, 0xDD, 0xFF, 0x3D, 0xFE,
+    0xB4, 0xFE, 0x05, 0xB5, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0x3D, 0xF6, 0xEC, 0x62, 0xC4, 0x08,
+    0xCD, 0x0A, 0x41, 0x93, 0x02, 0x53, 0x50, 0x02, 0x6E, 0x28, 0x43, 0x3C, 0x7D, 0x0A, 0xB6, 0x88,
+    0x45, 0x49, 0x8B, 0x44, 0x41, 0x43, 0x41, 0x11, 0xD6, 0x46, 0xFC, 0x00, 0x3D, 0x05, 0x29, 0x28,
+    0x90, 0x90, 0x42, 0x8A, 0x54, 0x61, 0x59, 0x5B, 0x4A, 0x49, 0x33, 0x82, 0x02, 0x89, 0x86, 0x01,
+    0x91, 0x08, 0x89, 0x82, 0x41, 0x9A, 0xC2, 0x2F, 0x6B, 0x7B, 0x38, 0xD7, 0xEF, 0x85, 0xB7, 0xDB,
+    0x20, 0x81, 0x88, 0x65, 0xCF, 0xF3, 0x7A, 0xE7, 0xCE, 0x3D, 0xF7, 0xDC, 0x33, 0x67, 0x70, 0x00,
+    0xE0, 0x03, 0x85, 0x7C, 0x73, 0x0A, 0x95, 0x06, 0xE4, 0xBF, 0x61, 0xBD, 0x8E, 0x00, 0xB3, 0x19,
+    0xB3, 0x94, 0x9C, 0xF9, 0x39, 0xA1, 0xCF, 0x47, 0x15, 0x8C, 0xAB, 0x86, 0x1A, 0x4B, 0x3E, 0xA9,
+    0x68, 0x82, 0x19, 0xFA, 0xAE, 0xBE, 0x7E, 0xF6, 0x52, 0xFA, 0x26, 0x7D, 0x9F, 0xEE, 0x2F, 0xC5,
+    0x68, 0xFC, 0x36, 0x10, 0xEF, 0xF0, 0xC9, 0x27, 0x0E, 0x85, 0x0C, 0x66, 0xE6, 0x50, 0xC9, 0x70,
+    0xED, 0x8C, 0xC3, 0xD4, 0x02, 0x59, 0xE4, 0xA0, 0x42, 0x0D, 0x68, 0x57, 0x5B, 0x98, 0xA1, 0xEE,
+    0x50, 0x25, 0xE6, 0x6E, 0x65, 0x98, 0x51, 0x0D, 0xF9, 0x88, 0xD2, 0xA9, 0x80, 0xD2, 0x33, 0x32,
+    0xCD, 0xED, 0x92, 0x27, 0x59, 0x41, 0x5B, 0x0E, 0x6F, 0x48, 0x8E, 0x53, 0x19, 0xFA, 0x5B, 0x1C,
+    0x6A, 0xC7, 0x21, 0x5B, 0x6F, 0xA4, 0xCF, 0xBA, 0x92, 0x13, 0x97, 0x32, 0xE8, 0x50, 0x75, 0x35,
+    0x66, 0x42, 0x0D, 0xC6, 0x13, 0xB5, 0x4D, 0x98, 0xF4, 0xA8, 0xE2, 0xD7, 0xBF, 0x98, 0xF3, 0x9F,
+    0xE6, 0x7A, 0xAA, 0x7D, 0xDB, 0x2D, 0x8C, 0x20, 0x66, 0xC3, 0x9F, 0x9B, 0x8C, 0x7F, 0x44, 0x4C,
+    0x13, 0xF6, 0x97, 0xE6, 0x53, 0x0E, 0xC4, 0x1E, 0x98, 0x84, 0xF3, 0x9E, 0xB1, 0xDB, 0xEF, 0xD9,
+    0xED, 0x0E, 0x3A, 0x25, 0x18, 0x82, 0x35, 0xC2, 0x4A, 0xC4, 0xA8, 0x23, 0xAE, 0x4A, 0x70, 0x26,
+    0x28, 0x93, 0xA0, 0x62, 0xA0, 0x09, 0xBB, 0x15, 0xD7, 0x0F, 0x1E, 0xAF, 0xEB, 0x05, 0x27, 0x48,
+    0x0C, 0x2D, 0x53, 0xB2, 0xE8, 0x97, 0x0B, 0xC9, 0x54, 0x87, 0x3C, 0x20, 0xE3, 0xEC, 0x69, 0x45,
+    0xF3, 0xF4, 0xF6, 0xB3, 0x05, 0x63, 0x0C, 0xF3, 0x3C, 0x64, 0x19, 0x47, 0x45, 0x00, 0x89, 0x21,
+    0x41, 0x20, 0x6B, 0xA5, 0x83, 0x1A, 0x35, 0x97, 0x1B, 0xAA, 0xE4, 0xF2, 0xD4, 0xED, 0xD7, 0xCA,
+    0x22, 0x1F, 0x26, 0xC8, 0xCE, 0x65, 0xFE, 0x35, 0x20, 0xAA, 0x27, 0x85, 0xFC, 0x18, 0x2A, 0xC2,
+    0x4C, 0xA8, 0x3E, 0xC4, 0x69, 0x85, 0xF0, 0xEC, 0x0E, 0x74, 0x35, 0x22, 0x4D, 0x6A, 0x73, 0x4A,
+    0xCC, 0x64, 0xB0, 0xEA, 0x04, 0x2F, 0xEF, 0x96, 0x63, 0x77, 0xA7, 0x4E, 0x81, 0x88, 0xF5, 0x6E,
+    0x8D, 0xCC, 0x8A, 0x14, 0xB0, 0x96, 0xCE, 0x1C, 0xC0, 0xE1, 0x6E, 0xE9, 0xA7, 0xEE, 0x91, 0xFA,
+    0x34, 0xA1, 0x66, 0xD6, 0xDA, 0x53, 0x23, 0x4E, 0xF9, 0xCA, 0x21, 0x08, 0xB6, 0x22, 0x5E, 0xC4,
+    0x77, 0x09, 0x70, 0x07, 0x57, 0x8D, 0xD9, 0xA8, 0x12, 0x43, 0x5B, 0x6A, 0x21, 0x4F, 0xE3, 0x05,
+    0xB0, 0x01, 0x9A, 0xB7, 0x5B, 0xC5, 0xF2, 0x6F, 0x91, 0xCA, 0x75, 0xA7, 0xE0, 0x24, 0xC6, 0xAB,
+    0x73, 0xAA, 0xAE, 0x65, 0x62, 0xFE, 0xFD, 0x64, 0xA8, 0x7D, 0xB9, 0xB0, 0xA5, 0x1E, 0xD4, 0x0F,
+    0x03, 0x7A, 0x07, 0x6E, 0xAD, 0xEC, 0xD6, 0x36, 0x0F, 0x04, 0x72, 0x4D, 0x4A, 0x3E, 0xE5, 0xAE,
+    0xB1, 0xC4, 0xAC, 0xBD, 0xF4, 0x40, 0x44, 0x41, 0xD0, 0xC6, 0xBF, 0xC2, 0xCA, 0xD1, 0x27, 0xAB,
+    0x2F, 0xA9, 0x6B, 0xA8, 0x98, 0xF9, 0x63, 0xA6, 0x2E, 0x7B, 0x6C, 0x15, 0x8D, 0xD7, 0x1E, 0xF3,
+    0x7C, 0xFB, 0x73, 0x92, 0x44, 0xA6, 0x98, 0x7F, 0xC1, 0x73, 0x93, 0x9E, 0x89, 0x51, 0x93, 0xF7,
+    0xCE, 0x04, 0x22, 0xAF, 0x1C, 0x19, 0x6B, 0xBB, 0x6A, 0xE0, 0x7B, 0x82, 0x8E, 0x6A, 0xE4, 0xF6,
+    0xA4, 0xF6, 0x98, 0x84, 0x6D, 0x60, 0x25, 0xF5, 0x60, 0x3C, 0x37, 0x7A, 0xFB, 0x63, 0x72, 0x5C,
+    0x61, 0x64, 0xEE, 0xCD, 0x3E, 0xB1, 0x6C, 0x99, 0xFE, 0x3B, 0x8F, 0x22, 0xBD, 0x49, 0x81, 0xCE,
+    0x57, 0x09, 0xE5, 0x4F, 0x6E, 0xA5, 0xF2, 0x5B, 0xFA, 0xCB, 0xD9, 0xF3, 0x30, 0xE7, 0x91, 0x4A,
+    0xE5, 0x9E, 0x17, 0x8B, 0x11, 0x8F, 0x81, 0x98, 0x0C, 0xC4, 0x65, 0xC4, 0x66, 0x58, 0x18, 0x2B,
+    0x17, 0xA3, 0x81, 0x38, 0x0D, 0x68, 0x35, 0x4E, 0xD1, 0x6B, 0x70, 0xC1, 0x6C, 0xAE, 0xDC, 0xFB,
+    0x44, 0x88, 0x8F, 0xE2, 0x1D, 0x23, 0xAE, 0x87, 0x2A, 0x12, 0x11, 0x0B, 0x5C, 0xF8, 0x43, 0x99,
+    0xF4, 0x96, 0xC8, 0x97, 0x2B, 0xE9, 0x8B, 0x22, 0xF6, 0xEC, 0xA6, 0x2B, 0x3D, 0x71, 0xB7, 0x56,
+    0x4D, 0x5C, 0xBD, 0x74, 0x6C, 0x06, 0x99, 0xEC, 0xCA, 0x90, 0xA5, 0x77, 0x93, 0xE5, 0x0A, 0x9E,
+    0x4C, 0xFC, 0x7A, 0x09, 0x3E, 0xE9, 0x20, 0x7A, 0xBE, 0x18, 0x36, 0xEF, 0x4B, 0x7A, 0x44, 0x4F,
+    0xB8, 0xA0, 0x93, 0xB5, 0xA4, 0x5B, 0xDE, 0xD3, 0x7B, 0x61, 0x45, 0x5E, 0xDB, 0x79, 0x05, 0x2E,
+    0x76, 0xB3, 0xE2, 0xA6, 0xDF, 0xA0, 0x25, 0x6C, 0x31, 0x9C, 0x15, 0xF5, 0xD6, 0x71, 0xD6, 0xAB,
+    0xB9, 0xC1, 0x05, 0xA8, 0xD5, 0x32, 0xB9, 0xBF, 0x93, 0xBD, 0xD0, 0x34, 0x96, 0x0C, 0xC6, 0xB5,
+    0x19, 0xE4, 0x98, 0x6D, 0x28, 0x06, 0x35, 0x66, 0x6E, 0xD5, 0xCF, 0xDA, 0x37, 0x56, 0x68, 0xF8,
+    0x4F, 0xB5, 0x69, 0xB0, 0xFB, 0x78, 0xC0, 0x32, 0xB5, 0x35, 0x5E, 0xB9, 0x62, 0xF3, 0x56, 0x60,
+    0xF8, 0xA4, 0x25, 0x9C, 0x8B, 0x53, 0x24, 0x43, 0xD6, 0x1C, 0x5F, 0xB6, 0x91, 0xFB, 0xD1, 0x0C,
+    0x53, 0xE1, 0x4F, 0xF2, 0x70, 0x86, 0x85, 0x14, 0x89, 0xCD, 0x1E, 0xA8, 0xA0, 0x6D, 0xFA, 0xCA,
+    0x5D, 0xB4, 0x91, 0x63, 0xEA, 0xEC, 0x66, 0x61, 0x25, 0x86, 0xE2, 0x60, 0xC1, 0x87, 0x5B, 0xF3,
+    0x3B, 0x6C, 0x9A, 0xE3, 0x42, 0x12, 0xF4, 0x14, 0xAB, 0x16, 0x7C, 0x53, 0x26, 0x5C, 0xBF, 0x2F,
+    0xE2, 0x23, 0x68, 0xF2, 0x45, 0x11, 0x29, 0x51, 0xF2, 0xD2, 0xD8, 0xDD, 0xC7, 0x8C, 0x95, 0xE4,
+    0x8E, 0xC2, 0x89, 0xD9, 0xD2, 0x4C, 0x0C, 0x4F, 0x2C, 0x91, 0x33, 0x78, 0xC2, 0xBC, 0x88, 0x41,
+    0x3F, 0x64, 0x13, 0xB8, 0x29, 0xB7, 0xFA, 0xE6, 0x61, 0xD4, 0x7B, 0x6E, 0x49, 0x4C, 0xB5, 0x9D,
+    0xCC, 0x70, 0x52, 0xF8, 0x4A, 0x7B, 0xF3, 0x87, 0x57, 0xA9, 0x63, 0xC5, 0xB6, 0xC6, 0x5D, 0xF3,
+    0x68, 0x96, 0xC3, 0xA0, 0x7A, 0xBC, 0xAD, 0x57, 0x03, 0x89, 0xBB, 0x5D, 0xD6, 0xEE, 0x0D, 0xE4,
+    0x7F, 0x85, 0xFA, 0x0F, 0xDE, 0x11, 0x66, 0x52, 0x5A, 0x7E, 0x34, 0x12, 0x67, 0xCD, 0x13, 0x91,
+    0x3D, 0xB7, 0x47, 0x84, 0x59, 0xFF, 0x1E, 0xF7, 0xDE, 0xD1, 0x34, 0x8D, 0xE8, 0xD3, 0xAD, 0x42,
+    0xED, 0xE9, 0xEF, 0xB5, 0xB4, 0xD7, 0x17, 0x56, 0x8C, 0x6C, 0x3D, 0x2A, 0xFB, 0xE4, 0xD9, 0x30,
+    0x7A, 0xE9, 0x83, 0x1B, 0xD8, 0x7D, 0x3C, 0xA2, 0x36, 0x5F, 0x95, 0x6D, 0x68, 0xCB, 0x07, 0x6F,
+    0x0F, 0x0C, 0xA7, 0x19, 0x71, 0x06, 0x70, 0x97, 0x4F, 0xDC, 0x1E, 0x5A, 0x28, 0x79, 0x5A, 0xAB,
+    0x79, 0x4B, 0xDC, 0x7F, 0xBB, 0xFE, 0x02, 0xB5, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0x3D, 0xF3,
+    0x26, 0x1B, 0x2B, 0x72, 0xE1, 0x2D, 0x92, 0x86, 0x08, 0x39, 0x45, 0x1A, 0x24, 0xC0, 0x3F, 0x90,
+    0x30, 0x23, 0xE5, 0x07, 0xB6, 0x58, 0x43, 0xC9, 0x07, 0x50, 0xA4, 0xA1, 0x48, 0x81, 0x62, 0x23,
+    0x1A, 0xCA, 0x6D, 0x52, 0x51, 0x90, 0x82, 0x0F, 0xA0, 0x48, 0x03, 0x12, 0xEB, 0x11, 0x29, 0xD2,
+    0x5A, 0x91, 0xA2, 0xB4, 0x06, 0x81, 0x28, 0x52, 0xAC, 0x15, 0x19, 0xC9, 0x9B, 0x67, 0xCF, 0xE5,
+    0x5C, 0xFB, 0x3D, 0x76, 0x5B, 0x84, 0x76, 0x64, 0xCB, 0x1E, 0x7B, 0xE6, 0xDE, 0x7B, 0xEE, 0x39,
+    0xF7, 0x0E, 0xE0, 0x51, 0x8C, 0x90, 0xC9, 0xF6, 0x73, 0x16, 0xA6, 0xFC, 0xEB, 0xB1, 0x48, 0x3B,
+    0xD7, 0xD4, 0x6E, 0x44, 0xE5, 0x0F, 0x1D, 0x9E, 0xB9, 0x37, 0x43, 0x21, 0x6D, 0x2A, 0xC0, 0x87,
+    0xC0, 0x97, 0x40, 0x0F, 0xBC, 0xF3, 0x68, 0x3C, 0xAE, 0x61, 0x1D, 0xCF, 0x92, 0x16, 0x45, 0xDA,
+    0xC2, 0x6E, 0x5B, 0xA0, 0xE2, 0xCD, 0xB9, 0x0E, 0x53, 0x96, 0xC7, 0x46, 0x44, 0x7C, 0x21, 0xD2,
+    0x6E, 0x26, 0xD3, 0x43, 0xF0, 0x15, 0x5C, 0xFD, 0x3E, 0x72, 0x2E, 0x48, 0x69, 0x67, 0x23, 0x52,
+    0x83, 0x3F, 0xE1, 0x9E, 0x1C, 0xED, 0x3F, 0x7A, 0x3B, 0xE1, 0x19, 0x22, 0xEE, 0xA3, 0x7A, 0x52,
+    0xE9, 0xF6, 0xD0, 0xE8, 0x0A, 0xDC, 0x4D, 0x7C, 0x9E, 0x06, 0xFB, 0x3A, 0xA0, 0x69, 0x91, 0x75,
+    0x30, 0x4F, 0x57, 0x27, 0xD0, 0xE8, 0x9D, 0xC0, 0x65, 0xAD, 0xB3, 0x3D, 0xC3, 0x4F, 0x7F, 0x1D,
+    0xED, 0x96, 0x80, 0x3A, 0x8D, 0x3F, 0x0B, 0x1F, 0xD9, 0xD8, 0xF8, 0x46, 0x7C, 0x1A, 0x71, 0x69,
+    0x38, 0xDE, 0xD9, 0x88, 0x25, 0x66, 0x33, 0x15, 0xC0, 0xC7, 0x58, 0xED, 0xE1, 0xFA, 0xCF, 0x1E,
+    0x09, 0xE3, 0xB2, 0x22, 0x13, 0xA4, 0xCE, 0x6A, 0xD7, 0x62, 0x48, 0x07, 0x64, 0x8C, 0x9E, 0xBE,
+    0x18, 0x09, 0x03, 0xA4, 0x81, 0x70, 0x50, 0x3E, 0xE0, 0x82, 0xC9, 0x85, 0x54, 0xF8, 0x92, 0x75,
+    0xAE, 0x43, 0xDC, 0x88, 0xCF, 0xDA, 0x4C, 0xBE, 0x9B, 0x18, 0x91, 0x04, 0x54, 0x72, 0xB2, 0xF3,
+    0x67, 0x3C, 0xD1, 0x72, 0x9F, 0x11, 0xBE, 0xBC, 0x23, 0xF4, 0xF1, 0x3E, 0xF0, 0x28, 0xD9, 0xFD,
+    0x3D, 0xC2, 0xE2, 0x32, 0xDD, 0x4A, 0x9B, 0xF4, 0x0E, 0x76, 0xC8, 0x02, 0xA6, 0xA4, 0x87, 0xB3,
+    0x23, 0xD2, 0xBF, 0xB8, 0xAD, 0x19, 0xB0, 0xE4, 0x27, 0xAF, 0x99, 0xA3, 0x51, 0x13, 0xD7, 0x21,
+    0xDB, 0x32, 0xBA, 0x36, 0x1F, 0x52, 0xF5, 0xCB, 0x14, 0xF8, 0xEA, 0x55, 0x53, 0xA7, 0x9A, 0xD1,
+    0xE2, 0x5C, 0x8D, 0xDE, 0x61, 0x6A, 0x32, 0xFF, 0x23, 0x20, 0xB3, 0x9A, 0xA7, 0xDF, 0xEB, 0x7E,
+    0xE7, 0xEF, 0x8B, 0x1F, 0x48, 0x94, 0x8C, 0x4B, 0x90, 0xCC, 0xC2, 0x68, 0x67, 0xAE, 0x24, 0xA3,
+    0x7D, 0xA6, 0xA4, 0xCC, 0x0B, 0xBC, 0x05, 0x67, 0x79, 0xEC, 0x42, 0x26, 0xCF, 0x27, 0x06, 0xC0,
+    0x2F, 0xD1, 0x46, 0xE2, 0x2C, 0x06, 0xCC, 0x90, 0xF3, 0x26, 0x2C, 0x19, 0x4A, 0xE4, 0x7C, 0x9F,
+    0xD3, 0x43, 0xDE, 0xF7, 0x36, 0x35, 0xB2, 0xD7, 0xED, 0x12, 0x20, 0x6E, 0x9F, 0x5C, 0x80, 0xCF,
+    0x25, 0xA2, 0x38, 0x13, 0x9F, 0x07, 0xE6, 0xAA, 0x25, 0xC6, 0x3E, 0x27, 0x46, 0xF2, 0x58, 0x7C,
+    0xDF, 0x73, 0xB5, 0x2A, 0x87, 0xAB, 0x1E, 0x6B, 0x8A, 0xB9, 0x33, 0x25, 0x0A, 0x77, 0x16, 0x15,
+    0x54, 0x5B, 0xD4, 0x76, 0x24, 0xC6, 0xD9, 0xC8, 0xA7, 0x34, 0x41, 0x33, 0x68, 0xFE, 0xD8, 0x5B,
+    0xC5, 0xA9, 0xF2, 0xC8, 0x0D, 0x98, 0x56, 0x2D, 0x5C, 0x25, 0xBE, 0x85, 0x43, 0x26, 0x1F, 0x71,
+    0x27, 0x20, 0x83, 0xAB, 0xC4, 0x77, 0x25, 0x20, 0x3E, 0xE0, 0x6D, 0xFB, 0x5D, 0xFC, 0x56, 0xEB,
+    0x54, 0x01, 0xDD, 0xB8, 0x28, 0x8C, 0x7B, 0xBB, 0x9B, 0xF2, 0x44, 0xEE, 0xD7, 0x5A, 0x36, 0xD3,
+    0xEE, 0xE7, 0x4D, 0x15, 0xB0, 0x74, 0x9B, 0x28, 0x83, 0x99, 0xA8, 0xD1, 0x99, 0xA6, 0x1C, 0xFF,
+    0x66, 0x21, 0x62, 0x73, 0xCE, 0xFA, 0x28, 0x54, 0x6A, 0xD4, 0x6A, 0x42, 0x8C, 0x1B, 0x4D, 0x53,
+    0x33, 0xC2, 0x46, 0xE9, 0xEC, 0x90, 0xCC, 0xAA, 0xD1, 0xFA, 0x94, 0xC9, 0xC9, 0xFF, 0x7E, 0xD8,
+    0xB1, 0xF2, 0x3B, 0xA4, 0xD1, 0xFF, 0xEB, 0x57, 0x77, 0xAC, 0xD5, 0x81, 0xC7, 0xEA, 0x2E, 0xFF,
+    0x46, 0x4D, 0xB4, 0xFB, 0xC8, 0x0E, 0x4A, 0x5F, 0x96, 0x46, 0xE6, 0x4C, 0xBA, 0x54, 0x3C, 0xAD,
+    0x16, 0xC1, 0xCC, 0x0A, 0xBE, 0x08, 0xB4, 0xCA, 0x27, 0xBD, 0xBA, 0x9A, 0x5D, 0x89, 0xCF, 0x54,
+    0x7B, 0x0E, 0xDB, 0x8A, 0xF4, 0xC8, 0xFE, 0x2C, 0x05, 0x5C, 0xA8, 0x3C, 0x5C, 0xDA, 0x10, 0x74,
+    0x03, 0xC3, 0x09, 0x89, 0x0C, 0x8E, 0xE6, 0x84, 0xCF, 0xB5, 0x3C, 0x98, 0x5F, 0xED, 0x74, 0xBF,
+    0x7C, 0x82, 0x34, 0x3C, 0xDA, 0x93, 0xBB, 0x21, 0x5B, 0x39, 0xD1, 0xB0, 0x1A, 0x19, 0x3E, 0x59,
+    0x51, 0x1D, 0x5C, 0x43, 0xF6, 0x92, 0x04, 0xBA, 0xC9, 0xC4, 0x37, 0x7D, 0x12, 0xF3, 0x50, 0x74,
+    0x0D, 0xC4, 0x8E, 0x76, 0xCC, 0x42, 0x1E, 0x2A, 0x34, 0x1B, 0x7D, 0x7D, 0x49, 0x2D, 0x4C, 0x15,
+    0xE4, 0xF7, 0x69, 0x61, 0x8C, 0xA3, 0x3C, 0x3E, 0x28, 0x8F, 0x72, 0x69, 0x49, 0x74, 0x33, 0x50,
+    0x07, 0xEC, 0x0A, 0x79, 0x6B, 0xAA, 0x57, 0x9F, 0x45, 0xC6, 0x21, 0xAC, 0xD5, 0xAA, 0xD6, 0xAA,
+    0x1F, 0x54, 0x2F, 0xFC, 0xC0, 0xC6, 0xC3, 0xAF, 0xD4, 0x5C, 0xF9, 0x79, 0xAF, 0x2D, 0x20, 0x62,
+    0xD9, 0xC0, 0xD8, 0xF9, 0x24, 0x0C, 0x32, 0x5E, 0x29, 0xFE, 0x4A, 0x1E, 0x08, 0xCD, 0xF5, 0x15,
+    0xA1, 0xDF, 0x5C, 0x7A, 0xA2, 0xD1, 0x12, 0x64, 0x4E, 0xDE, 0x8B, 0x4F, 0xA1, 0xCD, 0xA8, 0x60,
+    0xEF, 0x98, 0x6F, 0xB7, 0xF6, 0xAD, 0x84, 0xFC, 0x4C, 0xD0, 0xFC, 0x36, 0x6D, 0x24, 0xA5, 0x98,
+    0x5C, 0xED, 0xEA, 0xD9, 0xB0, 0xDD, 0xA4, 0x7D, 0xA1, 0xAF, 0x77, 0x66, 0x2B, 0x2F, 0xFA, 0x2C,
+    0x16, 0xA1, 0x58, 0xFB, 0xF8, 0x0D, 0x83, 0xFC, 0x2D, 0xBB, 0x5A, 0x6F, 0x9F, 0x0F, 0x6B, 0x95,
+    0x93, 0x8E, 0xA3, 0x84, 0xD2, 0x24, 0x0F, 0xEC, 0xD8, 0xDA, 0x0F, 0xE3, 0xE2, 0x8A, 0x71, 0x5D,
+    0xCC, 0x19, 0x7F, 0xB1, 0x9F, 0x9B, 0x48, 0x0D, 0x0E, 0x1B, 0xED, 0x44, 0x27, 0x87, 0x34, 0xB6,
+    0x15, 0xB5, 0x65, 0xD6, 0x06, 0x9E, 0x30, 0x8D, 0xA3, 0x26, 0xD6, 0xA9, 0xD2, 0x58, 0x0A, 0xCE,
+    0xB3, 0x9C, 0xD9, 0xFE, 0x8A, 0x6F, 0x21, 0x83, 0x95, 0xA0, 0x1D, 0x8F, 0xE3, 0x56, 0x89, 0xE5,
+    0x20, 0xEA, 0x77, 0x9A, 0xB8, 0x55, 0xFA, 0x9C, 0x62, 0x14, 0xE5, 0x16, 0x2C, 0x0A, 0xA5, 0x67,
+    0xE7, 0x77, 0x3F, 0x27, 0xE5, 0x4A, 0xE9, 0x3A, 0x27, 0xE3, 0xB9, 0xEE, 0x1F, 0x18, 0x4B, 0xEF,
+    0x24, 0x94, 0xE5, 0xDA, 0xB5, 0xAA, 0xCE, 0x92, 0xE0, 0x59, 0xEB, 0x82, 0x35, 0x7B, 0xCA, 0xF6,
+    0x4B, 0x41, 0x93, 0xE4, 0xCD, 0x58, 0x67, 0xE2, 0x1D, 0xEB, 0xAA, 0x5E, 0xFC, 0xDD, 0x65, 0x1E,
+    0x4C, 0x48, 0xB6, 0xBD, 0x9E, 0x2D, 0x07, 0xFE, 0xFF, 0xE5, 0xC1, 0xE8, 0x91, 0x13, 0x4E, 0x1F,
+    0x1A, 0xC2, 0xF9, 0xE9, 0xBF, 0xE5, 0x41, 0x0B, 0x21, 0x62, 0xA9, 0x01, 0xA5, 0x9F, 0xFE, 0x78,
+    0xA9, 0x5A, 0xA0, 0x47, 0x54, 0x54, 0xD0, 0x14, 0xDB, 0x2A, 0x0F, 0x62, 0xAE, 0x54, 0xE0, 0x5E,
+    0x0B, 0x9A, 0x8D, 0x88, 0x17, 0x0F, 0x6F, 0xB9, 0x74, 0x12, 0xFE, 0x03, 0xA5, 0x55, 0x31, 0x73,
+    0xDE, 0x44, 0x10, 0x7D, 0x92, 0xE2, 0x68, 0x06, 0x4D, 0x38, 0x17, 0x49, 0xC9, 0x88, 0x82, 0x22,
+    0x15, 0x6A, 0x28, 0xE3, 0xDC, 0x65, 0x28, 0x92, 0xCE, 0x2E, 0xFC, 0x0D, 0x2D, 0x05, 0x3D, 0x4D,
+    0x0A, 0x8A, 0x04, 0x09, 0xD2, 0xA4, 0xA4, 0xA1, 0x26, 0x3F, 0x82, 0x22, 0x85, 0x1D, 0x29, 0x76,
+    0xE1, 0x56, 0x93, 0x3F, 0x80, 0x42, 0x43, 0x89, 0x32, 0x88, 0x41, 0xC1, 0x27, 0x2D, 0x6F, 0xEF,
+    0xBE, 0x2F, 0x13, 0x66, 0x08, 0x14, 0x68, 0xF4, 0x49, 0xF6, 0x49, 0xB7, 0xFB, 0xF6, 0xBD, 0xB7,
+    0x2B, 0x00, 0xA6, 0x2B, 0xC6, 0xCC, 0xE3, 0x14, 0x40, 0x82, 0x7A, 0xB0, 0x33, 0x16, 0x58, 0x94,
+    0x5D, 0x31, 0x64, 0x13, 0x3C, 0x6A, 0x54, 0x8F, 0x8D, 0x7C, 0x2A, 0x4D, 0xEB, 0x0A, 0x97, 0x37,
+    0x59, 0x87, 0xD5, 0x55, 0x3D, 0x1C, 0x5F, 0x3F, 0x42, 0x36, 0xA2, 0xE0, 0x39, 0x20, 0xD1, 0xFF,
+    0xB1, 0xD9, 0x24, 0xB2, 0xA2, 0x9D, 0x51, 0x75, 0xB0, 0x3C, 0x1B, 0x3D, 0x6B, 0x87, 0x16, 0x10,
+    0x60, 0x45, 0xB2, 0x20, 0xE5, 0xE9, 0xC1, 0x7C, 0xF9, 0x8C, 0x5A, 0x5C, 0x2B, 0x0E, 0xFB, 0xE5,
+    0x6C, 0xE7, 0x6C, 0xCA, 0xC6, 0x7C, 0x2C, 0x06, 0xD3, 0x9B, 0xAE, 0xEC, 0xAA, 0xC7, 0x76, 0xB1,
+    0xBE, 0x1A, 0x42, 0xCC, 0xBD, 0xCD, 0x51, 0x29, 0x2F, 0x43, 0xE0, 0x42, 0x1A, 0xEE, 0x2E, 0x7B,
+    0x46, 0xD7, 0x28, 0x73, 0xCC, 0xC2, 0x7B, 0x3E, 0xC5, 0x3C, 0x44, 0x63, 0xC6, 0x98, 0x8C, 0x77,
+    0xBE, 0xB8, 0x6A, 0x46, 0xDE, 0xAB, 0x2E, 0xA6, 0xE5, 0x86, 0x5A, 0x37, 0x30, 0x77, 0xED, 0x0A,
+    0x99, 0xB8, 0x01, 0xFA, 0x36, 0x70, 0x8B, 0xA0, 0x91, 0xCB, 0xC4, 0x3F, 0xEB, 0x85, 0x97, 0x54,
+    0x17, 0xC3, 0x41, 0x86, 0xFA, 0x62, 0xCC, 0xE7, 0xCC, 0xB3, 0x80, 0x53, 0xDC, 0x0E, 0x8B, 0x49,
+    0x60, 0xAB, 0x1A, 0xED, 0x5C, 0x79, 0x32, 0x56, 0x07, 0xCE, 0x94, 0x35, 0xE5, 0x8D, 0xCC, 0x2D,
+    0x81, 0x3B, 0xB2, 0xC7, 0x62, 0xCC, 0x40, 0x06, 0xA7, 0x4C, 0x9E, 0x7B, 0xB4, 0x0D, 0xC9, 0x80,
+    0x75, 0x1A, 0x15, 0xD7, 0xCC, 0x00, 0x23, 0x23, 0x52, 0xFE, 0x50, 0x7D, 0xB7, 0xCB, 0x17, 0x32,
+    0x58, 0x16, 0x6F, 0x29, 0x4A, 0x5D, 0x74, 0xF8, 0x18, 0xF1, 0x59, 0xB2, 0x39, 0x86, 0x32, 0x8C,
+    0x8A, 0xBF, 0x44, 0x41, 0x86, 0x60, 0xC4, 0xCD, 0x40, 0xCA, 0x81, 0x72, 0xFB, 0x8E, 0x45, 0xD1,
+    0xC5, 0x06, 0xCA, 0x85, 0xB2, 0xA4, 0xE4, 0xA5, 0x67, 0x3E, 0x86, 0xAB, 0xF9, 0x2B, 0xE6, 0x98,
+    0x82, 0xC8, 0xA8, 0x27, 0x2A, 0xEE, 0x7B, 0x38, 0x23, 0x99, 0x6E, 0x21, 0xED, 0x6F, 0x46, 0x58,
+    0x57, 0x18, 0x8A, 0x61, 0x0A, 0x0D, 0x55, 0x6F, 0xF3, 0x28, 0x49, 0x0A, 0x84, 0x29, 0x12, 0x1F,
+    0x53, 0x31, 0x32, 0x48, 0x00, 0xF2, 0x31, 0x66, 0x32, 0xCC, 0x58, 0x76, 0xB8, 0xCF, 0xA2, 0x85,
+    0x5B, 0xC5, 0x6F, 0x6B, 0xDD, 0x1C, 0xEF, 0xD1, 0x2F, 0x8B, 0xA5, 0xB0, 0x53, 0xA9, 0x9E, 0x09,
+    0xAE, 0xE1, 0x1B, 0xF6, 0x11, 0x23, 0xD4, 0x87, 0x44, 0xD1, 0x52, 0x54, 0xB4, 0x1A, 0x5F, 0x42,
+    0x0D, 0xA1, 0xEC, 0xD6, 0x31, 0x0D, 0xEB, 0xCB, 0x7C, 0x39, 0x32, 0x99, 0xA1, 0xFA, 0x73, 0x26,
+    0x54, 0x34, 0x91, 0xBE, 0xE5, 0xBD, 0xDB, 0xB2, 0xF8, 0x44, 0x45, 0xD4, 0xAA, 0x12, 0xBD, 0xA4,
+    0x2A, 0x74, 0x4E, 0x28, 0xD8, 0xD3, 0x87, 0xD7, 0x59, 0x4A, 0x93, 0xC8, 0x10, 0x90, 0xFA, 0x50,
+    0x4F, 0xD5, 0x38, 0x73, 0xE6, 0xB3, 0x3F, 0xA4, 0xB9, 0xBC, 0x18, 0xEA, 0x66, 0xAE, 0xBA, 0x13,
+    0xD3, 0x9F, 0x66, 0x97, 0x3E, 0xA1, 0x3C, 0xCF, 0x4E, 0x61, 0x0F, 0x3B, 0x73, 0xB6, 0xDE, 0x1D,
+    0xED, 0x9F, 0x73, 0x60, 0x14, 0xEF, 0xB1, 0xBE, 0x1E, 0x09, 0x03, 0x3F, 0x05, 0xBE, 0xD2, 0x98,
+    0xC0, 0x3E, 0xEE, 0x88, 0x5B, 0xED, 0x64, 0x07, 0x7B, 0xE8, 0xB3, 0xDF, 0x06, 0x67, 0x9F, 0xD2,
+    0x54, 0x2C, 0x82, 0xC6, 0xFC, 0xB5, 0x81, 0x3F, 0x41, 0x79, 0x31, 0x7E, 0xE3, 0xED, 0x52, 0x7D,
+    0x2B, 0xE7, 0x5B, 0xF7, 0xC5, 0xE3, 0x66, 0x64, 0x4C, 0x3A, 0x18, 0x42, 0xFA, 0x28, 0x2E, 0xDE,
+    0xD8, 0x50, 0x21, 0xB6, 0x8C, 0xF4, 0x81, 0x5A, 0x7A, 0x5A, 0x45, 0x54, 0xE9, 0x75, 0xAB, 0x3A,
+    0x56, 0x22, 0xE1, 0x2A, 0x6B, 0x8B, 0x6B, 0x74, 0xF8, 0x6C, 0xC6, 0xBC, 0xAF, 0xBF, 0xAF, 0x4B,
+    0x91, 0xB9, 0x15, 0xD1, 0x8A, 0xF1, 0x01, 0xCA, 0xA1, 0x5C, 0xB2, 0xD7, 0x84, 0x47, 0x94, 0xED,
+    0x50, 0xAE, 0xAA, 0x0A, 0x3B, 0xA9, 0x23, 0x41, 0x6C, 0x20, 0x76, 0x8F, 0x06, 0xFC, 0xDB, 0xEA,
+    0xBD, 0x4C, 0x3A, 0xF6, 0xE5, 0x12, 0x70, 0xD0, 0x78, 0xDA, 0x1A, 0x05, 0xDB, 0x55, 0x13, 0xAB,
+    0xBB, 0xD6, 0x68, 0x2E, 0xC5, 0x40, 0x23, 0x64, 0x3E, 0xFA, 0xAD, 0x56, 0x71, 0xF0, 0x89, 0x19,
+    0xB3, 0xC1, 0x76, 0xE5, 0x9D, 0x75, 0xE3, 0x6B, 0x91, 0x9F, 0x45, 0x24, 0x0C, 0x88, 0x34, 0x5A,
+    0x81, 0xBD, 0x42, 0x67, 0xF1, 0x4F, 0x2E, 0x7E, 0x1E, 0x14, 0x69, 0x87, 0xFA, 0xAD, 0xB9, 0x33,
+    0x87, 0x86, 0xAA, 0x3A, 0xF3, 0x66, 0x04, 0x35, 0xE6, 0x05, 0xE1, 0xC8, 0x60, 0x19, 0x20, 0x69,
+    0x30, 0xB3, 0x45, 0x0C, 0x8C, 0x4B, 0xDE, 0x6A, 0x99, 0xCD, 0xF1, 0x01, 0xA9, 0x7A, 0x40, 0x33,
+    0x3D, 0xE5, 0xD6, 0x91, 0x18, 0x8F, 0x82, 0xE1, 0x83, 0x85, 0xB6, 0x6E, 0x95, 0xE8, 0x58, 0xE5,
+    0x4F, 0x51, 0x2A, 0x5B, 0x6C, 0xEA, 0x29, 0x7F, 0xFD, 0xD9, 0x48, 0x98, 0x43, 0xA0, 0xEB, 0xFA,
+    0x95, 0x62, 0xAD, 0xCA, 0xF5, 0x36, 0x96, 0x03, 0xF8, 0x07, 0x89, 0xFF, 0x31, 0x9D, 0x3F, 0x24,
+    0x22, 0x22, 0xC9, 0xC3, 0xB4, 0xD3, 0x9E, 0xED, 0xB5, 0x7B, 0x59, 0x48, 0xC5, 0x09, 0x77, 0x0F,
+    0x96, 0x63, 0x85, 0x84, 0xF5, 0x3B, 0xA6, 0x54, 0x31, 0xC2, 0x88, 0xDC, 0x28, 0x55, 0x11, 0x06,
+    0xA1, 0xB1, 0x45, 0x5A, 0x26, 0x16, 0x4C, 0xFF, 0x0D, 0x03, 0xC5, 0x0A, 0xEA, 0xA4, 0xDD, 0xE5,
+    0xB5, 0xB7, 0xA8, 0xC9, 0x0E, 0xC6, 0x49, 0xF1, 0xCA, 0x9B, 0x97, 0xDE, 0xF4, 0x4F, 0xFE, 0x0D,
+    0xC6, 0x3F, 0x09, 0xF6, 0x3B, 0x5F, 0xE6, 0x12, 0x7D, 0x9F, 0x33, 0x22, 0x6F, 0xA6, 0x7D, 0xB7,
+    0x60, 0x7B, 0xA8, 0xE6, 0x5C, 0xD4, 0x1D, 0x56, 0x6B, 0x7F, 0xA6, 0xA5, 0xCB, 0x50, 0xD2, 0xFD,
+    0x89, 0x34, 0x76, 0x4A, 0x76, 0xAB, 0x2F, 0x20, 0xA3, 0x59, 0x11, 0x25, 0xDE, 0x1D, 0xF7, 0xF5,
+    0x42, 0x60, 0x54, 0x59, 0x47, 0x6A, 0x11, 0x7C, 0xF4, 0xC5, 0xEE, 0xE9, 0xDE, 0x31, 0x6E, 0x1C,
+    0xB3, 0xFD, 0x0A, 0xE9, 0x39, 0x4E, 0xBE, 0x9C, 0x74, 0xDE, 0x70, 0x3E, 0x4B, 0xC7, 0x82, 0xEC,
+    0xC2, 0x86, 0xCD, 0x99, 0xC8, 0xE1, 0xA1, 0xB0, 0x6D, 0x8B, 0x8B, 0x99, 0x7E, 0xF1, 0xF6, 0x9C,
+    0xDC, 0x3F, 0x5F, 0xBF, 0x66, 0x3B, 0x9B, 0x4B, 0x0E, 0x74, 0xD7, 0x72, 0xC3, 0xC8, 0x2D, 0x44,
+    0x57, 0xCD, 0x0A, 0x85, 0x1F, 0x07, 0xE9, 0xD9, 0x3C, 0xED, 0x12, 0xC6, 0x13, 0xDE, 0xB8, 0xE3,
+    0xFD, 0x38, 0xA0, 0xB4, 0xBD, 0xD4, 0x79, 0xBC, 0xA5, 0xF1, 0xC1, 0x3E, 0x67, 0x78, 0x2F, 0x99,
+    0xFC, 0xB0, 0x62, 0xBD, 0xE4, 0x10, 0xE1, 0xF7, 0x67, 0xB2, 0xAE, 0x6E, 0x7C, 0xEA, 0xF3, 0xD1,
+    0x0C, 0xB6, 0xB1, 0x6E, 0x49, 0x7C, 0xFE, 0xEA, 0xEE, 0x58, 0xAE, 0x55, 0xD7, 0x4E, 0x0B, 0xB6,
+    0x1F, 0x85, 0x8D, 0x4B, 0x36, 0x8E, 0xEA, 0x30, 0x55, 0x3B, 0x5E, 0x15, 0x97, 0x8A, 0x53, 0xE4,
+    0x3E, 0x14, 0xD1, 0x97, 0xFC, 0xEA, 0xAD, 0x34, 0x78, 0xFE, 0xD3, 0x58, 0x01, 0x27, 0xF5, 0x23,
+    0x22, 0x3F, 0xF7, 0x5A, 0x44, 0xF9, 0xCB, 0x80, 0xB2, 0x91, 0x53, 0xA4, 0x53, 0x11, 0x90, 0x5B,
+    0x2D, 0x82, 0xA3, 0x88, 0x88, 0x39, 0xC8, 0xAA, 0x85, 0x2C, 0x92, 0x93, 0x3C, 0xCC, 0x85, 0x7D,
+    0xE5, 0x2D, 0x90, 0xEA, 0xE3, 0x67, 0x48, 0xAF, 0x4A, 0x26, 0x0E, 0xF4, 0x72, 0x15, 0xFF, 0xFF,
+    0xF8, 0x0B, 0xB5, 0x55, 0x3D, 0x8C, 0xDD, 0x44, 0x10, 0x1E, 0x7B, 0x2F, 0x67, 0x82, 0x89, 0xF6,
+    0x84, 0x14, 0x8A, 0x20, 0xB1, 0x0D, 0x35, 0xDB, 0x50, 0x86, 0xEC, 0xA2, 0x14, 0xA1, 0x0C, 0xD2,
+    0x5D, 0x03, 0x05, 0x0D, 0x15, 0x14, 0x50, 0x50, 0x86, 0xAC, 0xC5, 0x15, 0x14, 0x69, 0xAE, 0x49,
+    0x45, 0x11, 0x8A, 0x34, 0x69, 0xA0, 0x47, 0x97, 0xF3, 0x5E, 0x5E, 0x41, 0x6B, 0x44, 0x91, 0x82,
+    0xE2, 0x0C, 0x28, 0x8A, 0x44, 0x24, 0xB4, 0x91, 0x8C, 0x64, 0xB8, 0xB5, 0x87, 0x6F, 0xFC, 0xDE,
+    0x91, 0x54, 0x14, 0x48, 0x58, 0xEF, 0xED, 0xDB, 0xB7, 0x3F, 0x33, 0xF3, 0x7D, 0x33, 0xF3, 0x99,
+    0x76, 0x0A, 0x0A, 0x1D, 0x2B, 0xBE, 0x33, 0xD3, 0x7C, 0x3A, 0x2A, 0xAE, 0x7B, 0x3D, 0x38, 0x1F,
+    0x9A, 0x5C, 0xE6, 0x2A, 0xE9, 0xDE, 0x35, 0xCE, 0x4F, 0x45, 0xAE, 0x9E, 0x5E, 0x4B, 0x66, 0xB6,
+    0xB1, 0x1D, 0x26, 0x9A, 0x49, 0x9E, 0xB2, 0x21, 0x72, 0xF8, 0x3D, 0x24, 0x52, 0x1D, 0xD1, 0x1B,
+    0x98, 0x5E, 0xA7, 0xB3, 0x47, 0x35, 0x57, 0x30, 0x5E, 0xD1, 0x11, 0xE7, 0x4E, 0x7B, 0x4C, 0xF5,
+    0x28, 0xCB, 0x57, 0xCE, 0xF6, 0xCF, 0xED, 0xD2, 0xC5, 0xDD, 0x82, 0xFB, 0x9A, 0xBB, 0x9A, 0xE9,
+    0x93, 0x81, 0xEC, 0x40, 0x99, 0x14, 0x47, 0xDC, 0x70, 0x53, 0x31, 0x52, 0xC5, 0xBD, 0xF1, 0xF4,
+    0x39, 0x97, 0x89, 0xEA, 0xEF, 0x47, 0xF8, 0xC9, 0x6E, 0x95, 0x48, 0x1F, 0xCF, 0x37, 0xA9, 0x18,
+    0xF5, 0x69, 0x47, 0xD6, 0xB7, 0xB8, 0x90, 0x70, 0x05, 0x51, 0x58, 0x5C, 0x48, 0xC4, 0x4D, 0xC9,
+    0x9D, 0x1E, 0xA8, 0x9D, 0x28, 0x88, 0x93, 0x02, 0xDF, 0xF3, 0x45, 0x47, 0x37, 0x2C, 0xD1, 0x1F,
+    0x89, 0x4A, 0xF6, 0xA4, 0x06, 0xA2, 0xED, 0x66, 0x09, 0x61, 0x8B, 0xBC, 0x19, 0x5C, 0xE4, 0xC7,
+    0xDC, 0xB8, 0xA3, 0x99, 0xF8, 0xC1, 0xA8, 0x26, 0xDD, 0x99, 0xDE, 0x51, 0x5B, 0x64, 0x35, 0xEA,
+    0x5E, 0x77, 0xA0, 0xA1, 0xC8, 0xEF, 0xE6, 0x8A, 0x6F, 0x25, 0x3B, 0x39, 0xEF, 0x96, 0x8B, 0xE5,
+    0x01, 0x86, 0x3A, 0x61, 0xA8, 0x96, 0x41, 0xD0, 0xD5, 0x51, 0x20, 0x36, 0xA0, 0xD2, 0x99, 0x6C,
+    0xBB, 0xCB, 0x2E, 0x33, 0xFC, 0x9D, 0x3E, 0x11, 0xA7, 0xD7, 0x12, 0xA9, 0xB9, 0xEE, 0x49, 0x65,
+    0xDD, 0x51, 0x35, 0x00, 0x60, 0x9D, 0x0C, 0x86, 0xDE, 0x36, 0x04, 0x17, 0xEF, 0xC8, 0x90, 0xC9,
+    0x44, 0x37, 0x92, 0x6D, 0x5C, 0xB7, 0xE6, 0x67, 0xCF, 0x17, 0x7B, 0xDE, 0xCC, 0x02, 0xA5, 0x4D,
+    0xDB, 0xEC, 0x11, 0xBB, 0x30, 0x93, 0x17, 0x92, 0x3A, 0xD3, 0x50, 0x98, 0x8B, 0x81, 0xAA, 0x93,
+    0x04, 0x68, 0x87, 0x61, 0x1F, 0xCC, 0xAC, 0xB2, 0x90, 0x64, 0x1E, 0xF7, 0x64, 0x1A, 0xBE, 0x4F,
+    0xE5, 0x50, 0x2F, 0xCC, 0x38, 0x21, 0xA9, 0x64, 0x5C, 0x90, 0x14, 0x58, 0x98, 0xF3, 0xE0, 0x7C,
+    0x89, 0x7C, 0xC9, 0xC6, 0x05, 0x09, 0xBD, 0x64, 0xC9, 0x8E, 0x5D, 0xF2, 0x7A, 0xE4, 0x31, 0xEC,
+    0x14, 0x05, 0x5F, 0xCD, 0xEE, 0x4F, 0xEE, 0x41, 0x8D, 0x94, 0x84, 0xEB, 0xA6, 0x6A, 0xD4, 0x11,
+    0xCC, 0x68, 0xC4, 0x3D, 0xA9, 0x11, 0xF1, 0xA2, 0x28, 0x92, 0x8D, 0x47, 0x6A, 0x00, 0xAE, 0x22,
+    0xE3, 0x7E, 0x53, 0x22, 0x90, 0x30, 0x21, 0x77, 0x0D, 0x19, 0x61, 0x69, 0x6F, 0x17, 0xAB, 0xDC,
+    0xC1, 0x7E, 0xA6, 0x67, 0xCF, 0xF6, 0x3D, 0x70, 0xC5, 0x72, 0x8C, 0x87, 0x82, 0xDF, 0xE6, 0x18,
+    0x22, 0x98, 0x47, 0x09, 0xFC, 0xCC, 0x54, 0xCE, 0x16, 0xA9, 0xFD, 0x35, 0x63, 0xE2, 0xE2, 0x32,
+    0x51, 0x13, 0x26, 0x6E, 0x95, 0xA9, 0x1E, 0x5D, 0x57, 0x70, 0xC9, 0xA8, 0x56, 0x3D, 0xB7, 0x03,
+    0x05, 0x98, 0x10, 0x7E, 0xD6, 0x8F, 0xE1, 0x28, 0x5E, 0xCE, 0xED, 0xF9, 0x25, 0xF3, 0x1E, 0x3E,
+    0x71, 0x1A, 0x87, 0xBF, 0x44, 0x26, 0xDD, 0x31, 0x8A, 0xD9, 0x35, 0x76, 0x35, 0xA8, 0x11, 0x69,
+    0xBC, 0x36, 0x54, 0x09, 0x45, 0xAD, 0xA6, 0x10, 0x0D, 0xF7, 0x14, 0x86, 0x8D, 0x8D, 0x83, 0x2D,
+    0xD8, 0x29, 0x22, 0x15, 0x33, 0xC2, 0xD5, 0xC2, 0xC6, 0xC5, 0xB3, 0x98, 0x3F, 0x02, 0x1C, 0x06,
+    0x92, 0xC0, 0x8C, 0xAA, 0x31, 0xB9, 0xCA, 0xE4, 0x3A, 0xA4, 0x65, 0x36, 0x89, 0xEC, 0x2F, 0xD3,
+    0xB3, 0x70, 0x97, 0x89, 0xFB, 0x11, 0x71, 0x67, 0x4C, 0xDA, 0xFD, 0x89, 0x4C, 0xB2, 0xA9, 0x9A,
+    0x88, 0x9F, 0xB0, 0xAF, 0xC4, 0x04, 0xE8, 0xDF, 0x18, 0x85, 0xBB, 0xA2, 0x7F, 0x89, 0xEC, 0x57,
+    0x91, 0xA4, 0x5C, 0x96, 0x0E, 0xF9, 0x8F, 0xA1, 0x23, 0x65, 0x44, 0xAF, 0x95, 0xA0, 0x1A, 0x87,
+    0xC9, 0x3D, 0x84, 0xFF, 0x31, 0x78, 0xBA, 0x50, 0x9C, 0xF9, 0xBA, 0x74, 0x77, 0x4D, 0x3A, 0x0C,
+    0x23, 0x24, 0x20, 0x28, 0x98, 0xF4, 0x20, 0xAC, 0xF7, 0x01, 0x71, 0x7E, 0x21, 0x10, 0x74, 0x12,
+    0x92, 0x81, 0xA3, 0x67, 0xA0, 0xBD, 0x2A, 0x18, 0xB0, 0x64, 0x7B, 0xE1, 0x9D, 0xDA, 0x68, 0x86,
+    0x05, 0x04, 0x2C, 0x0C, 0xCF, 0x11, 0x4F, 0xE4, 0xAF, 0x53, 0xB5, 0xEA, 0xC8, 0x59, 0xAF, 0x9E,
+    0x8E, 0x64, 0xB4, 0xA7, 0x4F, 0xDF, 0x5C, 0xEF, 0x40, 0x0F, 0xAC, 0xE4, 0x39, 0x0B, 0x16, 0xB4,
+    0x14, 0xEA, 0xDE, 0x46, 0x14, 0xB5, 0x02, 0x18, 0xDD, 0xE9, 0x2E, 0xF8, 0x40, 0x13, 0xFE, 0x00,
+    0x4D, 0xC5, 0xD2, 0xF3, 0x7E, 0x63, 0xF2, 0xBD, 0xDB, 0x7B, 0x7B, 0x12, 0x2A, 0x73, 0xAF, 0x64,
+    0x1C, 0xD5, 0x8C, 0xA3, 0x6F, 0xA9, 0x89, 0x6C, 0xD4, 0xE5, 0x44, 0xBA, 0x57, 0x0D, 0x2F, 0xCD,
+    0xDC, 0x7A, 0x29, 0x3D, 0xA1, 0x9A, 0x7B, 0x09, 0x96, 0x61, 0x9A, 0xF4, 0xA3, 0x5D, 0x88, 0x94,
+    0x6C, 0xBB, 0x88, 0xED, 0x1D, 0xD1, 0x04, 0xB0, 0xC3, 0xF8, 0xAB, 0x1B, 0xF7, 0x57, 0xFB, 0xE8,
+    0xFD, 0xAE, 0x12, 0xB3, 0x72, 0x9E, 0x79, 0x3C, 0x03, 0x02, 0xEA, 0xAF, 0x43, 0x4A, 0x84, 0x9B,
+    0x39, 0xCC, 0xD5, 0x18, 0x86, 0x80, 0x04, 0xF4, 0x37, 0x25, 0x6A, 0xC9, 0xC1, 0x3E, 0x74, 0xD1,
+    0x7D, 0x1B, 0x31, 0x40, 0x60, 0x7C, 0x38, 0xD8, 0x72, 0x9E, 0x9B, 0xCB, 0xEE, 0x21, 0xFF, 0x96,
+    0x0D, 0x9F, 0x70, 0xAA, 0xA0, 0xA2, 0xFE, 0xB9, 0x42, 0xA7, 0x5A, 0x94, 0x70, 0x90, 0xFE, 0xC2,
+    0x04, 0x4D, 0x41, 0x2F, 0x6E, 0xB6, 0x8B, 0x8F, 0xEF, 0x62, 0x11, 0x9E, 0xC3, 0xDC, 0x76, 0x85,
+    0x3D, 0x06, 0x16, 0xB0, 0x43, 0xAE, 0x69, 0x45, 0x21, 0x12, 0x14, 0x68, 0xA2, 0xFA, 0x69, 0xDB,
+    0x2C, 0x35, 0xA7, 0x91, 0xE8, 0x62, 0x6A, 0xC1, 0xE5, 0x6A, 0x44, 0x4A, 0xD0, 0x20, 0x0E, 0xE0,
+    0xAB, 0xB1, 0x9E, 0x2A, 0x4E, 0x76, 0x6C, 0x91, 0x9B, 0xE6, 0x39, 0xE1, 0x45, 0xBF, 0x2F, 0xED,
+    0x88, 0xCF, 0x0D, 0xA2, 0x17, 0xD6, 0xC5, 0xB1, 0x55, 0x4D, 0x66, 0xC5, 0x77, 0x52, 0x7D, 0x92,
+    0xCB, 0xD3, 0xDB, 0x12, 0x0B, 0x28, 0x33, 0xBD, 0xE8, 0x18, 0xF8, 0x22, 0x24, 0x13, 0x8A, 0x69,
+    0x23, 0x88, 0xC5, 0xE9, 0x57, 0xBE, 0xF3, 0x42, 0x4C, 0x53, 0xF1, 0x93, 0x89, 0x5E, 0xCE, 0x26,
+    0x2D, 0x0E, 0xD5, 0x88, 0xC3, 0xC1, 0xB3, 0xC8, 0x57, 0x47, 0xED, 0xAB, 0xE3, 0x52, 0x4F, 0xC4,
+    0xE8, 0x13, 0xF3, 0x53, 0xDA, 0x14, 0xDE, 0x83, 0x69, 0x8D, 0x24, 0x34, 0x6D, 0x17, 0xD0, 0xAC,
+    0xB7, 0x38, 0xD5, 0x1B, 0x7E, 0x2F, 0x49, 0x74, 0xA2, 0x3B, 0x56, 0x26, 0xE2, 0x47, 0x36, 0xCE,
+    0x2F, 0x8D, 0x80, 0x57, 0xD0, 0x0F, 0x59, 0xCF, 0x21, 0x22, 0x3E, 0x3A, 0x7A, 0xE4, 0xE5, 0x6D,
+    0x01, 0xCE, 0x10, 0x60, 0x29, 0xD9, 0x6D, 0x16, 0x16, 0xC3, 0x5A, 0x76, 0xD7, 0x6F, 0x1F, 0xFA,
+    0x10, 0xF5, 0x1C, 0x17, 0x1B, 0x7A, 0xFD, 0x02, 0xDA, 0xF9, 0x87, 0x83, 0xCF, 0x2A, 0x08, 0xED,
+    0x31, 0x76, 0xDC, 0x7D, 0xE1, 0x1D, 0x9C, 0x57, 0xDD, 0xFF, 0xC9, 0xFB, 0xEB, 0x95, 0x37, 0x75,
+    0x54, 0x0F, 0x51, 0x84, 0xB8, 0x05, 0x31, 0xFC, 0x7A, 0xDD, 0x17, 0x3B, 0x06, 0x05, 0x04, 0x50,
+    0x36, 0xA4, 0xFA, 0xF7, 0x5D, 0x35, 0x2F, 0x98, 0x42, 0xB3, 0xE1, 0x19, 0x90, 0x24, 0x4D, 0xED,
+    0x82, 0xEF, 0x59, 0xF6, 0x64, 0xC1, 0x8C, 0x28, 0x7E, 0x4F, 0xDB, 0x9B, 0x6A, 0xF9, 0xE6, 0x00,
+    0xE9, 0x80, 0x88, 0x43, 0xF8, 0x3B, 0x8B, 0xFD, 0x43, 0x95, 0xCB, 0xAE, 0xC6, 0x5D, 0x33, 0xAD,
+    0x55, 0xDB, 0x0A, 0x57, 0xF8, 0xAD, 0xB3, 0x8A, 0x1A, 0xAF, 0x04, 0x1B, 0xA1, 0x37, 0x6A, 0xFE,
+    0x60, 0xD0, 0x2C, 0xA2, 0xD3, 0xD3, 0xBF, 0x3C, 0x7F, 0x03, 0xB5, 0x55, 0x3D, 0x8F, 0xDD, 0x44,
+    0x14, 0x3D, 0x9E, 0xE1, 0xC5, 0x20, 0x4B, 0x19, 0x0A, 0xA2, 0x84, 0xCA, 0x2D, 0xCD, 0x32, 0x0D,
+    0x05, 0x45, 0x16, 0x0F, 0x34, 0x44, 0xA2, 0x60, 0x8B, 0x75, 0xBD, 0x05, 0x7F, 0x81, 0x22, 0x48,
+    0x24, 0x7E, 0x40, 0x41, 0x41, 0xC1, 0x16, 0xFC, 0x0E, 0x44, 0x91, 0x22, 0x42, 0x2F, 0xCF, 0xB3,
+    0x4A, 0x41, 0x19, 0x23, 0x8A, 0xB4, 0x46, 0x0A, 0x0D, 0x4D, 0x66, 0x89, 0x91, 0x1C, 0x61, 0xFB,
+    0x72, 0xC6, 0x7E, 0x6F, 0x93, 0x02, 0x04, 0x12, 0x64, 0xA4, 0x79, 0x1F, 0xE3, 0x3B, 0x73, 0xCF,
+    0x39, 0xF7, 0x9E, 0x31, 0xC0, 0xA1, 0x3C, 0x92, 0x1E, 0x18, 0x81, 0x7B, 0xC0, 0x21, 0xF0, 0x0A,
+    0xE6, 0xE1, 0x90, 0x09, 0x8C, 0x34, 0xE6, 0xC7, 0xA0, 0x03, 0x20, 0x0E, 0x79, 0x0F, 0x25, 0x6B,
+    0xE4, 0x9D, 0xC2, 0xA4, 0x82, 0x5D, 0xCB, 0x89, 0x2F, 0xA4, 0x51, 0xE2, 0x71, 0x31, 0x36, 0x40,
+    0x36, 0x00, 0x53, 0x0F, 0x6E, 0xC3, 0x4D, 0xB5, 0x9E, 0x57, 0xBF, 0x3D, 0x85, 0x95, 0xA0, 0x44,
+    0x9A, 0xBC, 0xB1, 0xA8, 0xB1, 0xD1, 0x83, 0x6A, 0x62, 0x5C, 0xCE, 0xA4, 0x76, 0xE2, 0x14, 0xFE,
+    0x9E, 0xE2, 0x5E, 0xED, 0x4D, 0xB0, 0xB0, 0x7E, 0x84, 0xE8, 0xE9, 0xA4, 0x33, 0x22, 0x2E, 0x95,
+    0x76, 0x77, 0xFA, 0x11, 0xB0, 0x05, 0xAA, 0x06, 0xB7, 0x06, 0x1C, 0x1A, 0x1C, 0xA8, 0x39, 0x73,
+    0xC2, 0xFD, 0x03, 0x0A, 0x71, 0xC5, 0xFB, 0xDE, 0x78, 0x68, 0x9E, 0x59, 0xB5, 0xC8, 0xA6, 0x18,
+    0xF9, 0xB2, 0xEE, 0x33, 0xBF, 0xD5, 0x63, 0x05, 0x1E, 0x44, 0x3E, 0xF3, 0x50, 0xDF, 0x3B, 0xD4,
+    0xE2, 0x33, 0x2E, 0x55, 0x6E, 0xA3, 0x06, 0x15, 0x4C, 0xC8, 0x9C, 0x25, 0xC9, 0xAA, 0x03, 0x6A,
+    0x6A, 0x51, 0x13, 0x5B, 0xC5, 0x6F, 0x1B, 0x0C, 0x0A, 0xBF, 0x41, 0xAD, 0x3B, 0x3D, 0x98, 0xA7,
+    0x55, 0x53, 0xC8, 0x88, 0x5C, 0x16, 0x56, 0x19, 0xBF, 0x0A, 0xCE, 0x77, 0x08, 0x81, 0x7B, 0xAD,
+    0x03, 0x4E, 0x17, 0xE1, 0x08, 0x47, 0x46, 0xDD, 0x7D, 0x4A, 0xDD, 0x88, 0x26, 0x61, 0x7C, 0xDD,
+    0x52, 0x36, 0x82, 0xB1, 0xAA, 0x2F, 0x1E, 0x06, 0xAA, 0xB6, 0xC3, 0x72, 0x07, 0x09, 0x53, 0x5D,
+    0x07, 0x7A, 0xA4, 0x2D, 0x2E, 0xED, 0x78, 0x1A, 0xEA, 0x68, 0xBE, 0x08, 0x48, 0x1F, 0x7B, 0x2A,
+    0xCE, 0x85, 0xBB, 0xCF, 0x80, 0x53, 0x48, 0x82, 0xEF, 0x92, 0x51, 0x85, 0x88, 0x3C, 0x2A, 0x19,
+    0x43, 0x12, 0x69, 0x16, 0xE8, 0x51, 0xCA, 0x34, 0x22, 0xAC, 0x7D, 0xC4, 0x1E, 0xB5, 0x2C, 0x5C,
+    0xE1, 0x8B, 0x5F, 0xA8, 0x0F, 0xC1, 0x5F, 0x88, 0x79, 0x4D, 0xAF, 0x75, 0xD3, 0xC1, 0x12, 0x3D,
+    0xA3, 0x33, 0x12, 0x78, 0x63, 0x79, 0xF0, 0xD2, 0x2C, 0x27, 0x0B, 0x4F, 0x02, 0x28, 0x30, 0xEB,
+    0x99, 0x47, 0x4D, 0x5A, 0x26, 0x71, 0xE4, 0x10, 0x4B, 0x4F, 0x12, 0x9A, 0xA7, 0xED, 0x58, 0xAC,
+    0xCA, 0xB2, 0xA4, 0x9A, 0xF2, 0x13, 0x67, 0xD7, 0xE7, 0xCD, 0xE6, 0x56, 0x16, 0xAC, 0xA1, 0x62,
+    0xEF, 0xBA, 0x29, 0x71, 0xA8, 0xA8, 0x8C, 0x25, 0xBC, 0x98, 0x44, 0x93, 0x2E, 0x58, 0x9A, 0x65,
+    0x91, 0xF5, 0x33, 0xBB, 0x45, 0x43, 0x60, 0x99, 0x74, 0xB8, 0x90, 0x56, 0x33, 0x27, 0xDE, 0xE4,
+    0xCC, 0xB1, 0x88, 0xBB, 0xF4, 0xE5, 0x2A, 0x36, 0xAB, 0x69, 0x88, 0x8C, 0xD1, 0x22, 0x67, 0xD5,
+    0x37, 0xEC, 0xDC, 0x34, 0xC4, 0xB3, 0xEA, 0xB8, 0x87, 0x8F, 0xAA, 0xF4, 0x33, 0x99, 0x52, 0x09,
+    0xD9, 0x18, 0x37, 0x7C, 0x02, 0x35, 0xC4, 0x02, 0x19, 0x97, 0x74, 0xDC, 0xBD, 0x8C, 0x74, 0x7D,
+    0x88, 0xA4, 0xBB, 0xCD, 0x02, 0x6E, 0x17, 0x86, 0xB1, 0xF1, 0xE3, 0xB8, 0x52, 0x96, 0xC7, 0x96,
+    0x34, 0x3E, 0x8C, 0x74, 0xDA, 0xEA, 0xBD, 0xF3, 0xCE, 0xFA, 0xCD, 0x75, 0x13, 0x0E, 0x57, 0xBA,
+    0x67, 0xEA, 0x18, 0x59, 0x3F, 0x8F, 0x9C, 0x20, 0x97, 0x45, 0xCE, 0x62, 0xB7, 0x58, 0x50, 0x50,
+    0x1B, 0xEB, 0x01, 0x5C, 0x66, 0x2A, 0xD6, 0x30, 0xE0, 0xB5, 0x80, 0xDB, 0x6F, 0xA3, 0xB8, 0x01,
+    0x76, 0x28, 0x9F, 0x15, 0x12, 0x56, 0xD3, 0x11, 0x0A, 0x9A, 0xCA, 0x47, 0x5D, 0xD4, 0x30, 0xAB,
+    0x12, 0xFF, 0x9F, 0xB5, 0xA9, 0xF4, 0x89, 0x0C, 0xB0, 0xDD, 0xBF, 0x14, 0x57, 0xD5, 0xBF, 0xB2,
+    0x34, 0xB4, 0xE1, 0xD5, 0xD1, 0xFD, 0x93, 0xB8, 0x7F, 0x23, 0x1F, 0xBD, 0x99, 0x49, 0xFF, 0x57,
+    0xF2, 0xD1, 0x75, 0xAF, 0xF2, 0x80, 0xDF, 0x62, 0x7B, 0xF1, 0x0E, 0x50, 0xF7, 0xFB, 0xC5, 0x72,
+    0xB3, 0xF3, 0xCA, 0xA3, 0x2B, 0xA5, 0x15, 0x2F, 0x63, 0x35, 0x2A, 0x39, 0x2D, 0x3C, 0x9B, 0x79,
+    0x42, 0xD6, 0xA6, 0x1D, 0x8D, 0xC1, 0xFC, 0x34, 0x31, 0x34, 0x5B, 0x94, 0x24, 0x4D, 0x4B, 0xEB,
+    0x56, 0x4E, 0x77, 0x64, 0x6A, 0xE8, 0x71, 0x54, 0x94, 0x8B, 0xF9, 0x6A, 0xC6, 0x11, 0xFB, 0x04,
+    0x2D, 0xC4, 0xA8, 0xA4, 0xDF, 0xDF, 0x24, 0xCA, 0x91, 0xDB, 0x57, 0x4E, 0x3F, 0x1E, 0x70, 0x39,
+    0x6F, 0xE6, 0xB6, 0x5C, 0x9A, 0x33, 0x1B, 0x93, 0xA1, 0xEA, 0x4D, 0x6B, 0x1A, 0xF6, 0x35, 0x86,
+    0x64, 0x48, 0x43, 0xD6, 0x16, 0xEB, 0xC2, 0x8D, 0x18, 0xB2, 0x90, 0x86, 0xCA, 0xDB, 0x2F, 0xE5,
+    0x9A, 0x6C, 0xE4, 0x89, 0xDC, 0x97, 0x74, 0xC8, 0xDA, 0x3D, 0x54, 0x76, 0xD2, 0x6C, 0x12, 0x79,
+    0x76, 0x5D, 0xA1, 0x3C, 0x5E, 0x95, 0x1F, 0x08, 0x0D, 0x79, 0x22, 0xAE, 0x7E, 0xB4, 0xC0, 0x5A,
+    0xAB, 0x9E, 0x25, 0x35, 0x2D, 0xCB, 0x12, 0x9D, 0x03, 0x9A, 0x99, 0x0A, 0x11, 0xAB, 0x5D, 0x13,
+    0xC8, 0x18, 0xDB, 0x6C, 0xC7, 0x29, 0x90, 0xAD, 0x8D, 0x71, 0x95, 0xB0, 0xE4, 0x12, 0xC1, 0xD7,
+    0xD3, 0xFE, 0x68, 0xEA, 0xC2, 0xA5, 0x25, 0xF1, 0x7C, 0x2B, 0xA0, 0x6E, 0xF2, 0x1F, 0x64, 0x3D,
+    0x81, 0x57, 0x83, 0x0E, 0xC6, 0xE7, 0xBE, 0xC2, 0x56, 0xF7, 0xBA, 0x33, 0x8D, 0xF1, 0x35, 0x65,
+    0x1F, 0x54, 0x5F, 0x9D, 0x7F, 0xFD, 0xC7, 0x03, 0x29, 0x86, 0x82, 0x34, 0xB6, 0x7B, 0x21, 0xA2,
+    0x07, 0x12, 0x22, 0xAF, 0x62, 0x93, 0xD1, 0xFE, 0x84, 0xFD, 0xE2, 0xF5, 0x8F, 0x7A, 0xDF, 0x49,
+    0xA1, 0x9F, 0xDE, 0xE5, 0x9D, 0xE1, 0x71, 0xE9, 0xD1, 0x7F, 0xD3, 0x1F, 0xAF, 0x73, 0xEA, 0x28,
+    0xFD, 0xC1, 0x01, 0x3F, 0xC2, 0xC7, 0x24, 0xF6, 0xD0, 0xEF, 0xBC, 0xC7, 0x36, 0x5E, 0x95, 0xAE,
+    0x3C, 0xAE, 0x45, 0xCB, 0xEF, 0xD2, 0x65, 0x93, 0x7B, 0x5E, 0xF1, 0x29, 0x2A, 0xCE, 0xFB, 0xF7,
+    0x02, 0xF7, 0xAE, 0x40, 0x4D, 0x2C, 0x10, 0x66, 0xD2, 0x7C, 0x51, 0xB5, 0x2A, 0xC6, 0xA5, 0xB1,
+    0x08, 0x26, 0x56, 0x23, 0xBB, 0x78, 0x6B, 0xCC, 0x6F, 0xB7, 0x9C, 0x2E, 0x08, 0xDF, 0x41, 0x7F,
+    0xEE, 0x61, 0x4E, 0xF8, 0x37, 0x44, 0x2B, 0x80, 0x9D, 0x6D, 0xBB, 0xF4, 0x5C, 0xF6, 0xF8, 0x35,
+    0xF1, 0xE7, 0xDE, 0xEE, 0x6B, 0x64, 0x7D, 0x7E, 0x26, 0xD8, 0xE6, 0xC3, 0x47, 0xD3, 0x13, 0x79,
+    0x20, 0x66, 0xC8, 0x79, 0xF5, 0xED, 0x4F, 0x65, 0x59, 0x6E, 0x66, 0x7C, 0x49, 0x06, 0x92, 0x92,
+    0x13, 0xDE, 0x2F, 0x3F, 0x93, 0xCA, 0x5B, 0xA9, 0xDB, 0x99, 0xF6, 0xC5, 0xD1, 0xF9, 0x1F, 0xC7,
+    0x9F, 0xB5, 0x55, 0xB1, 0x92, 0xD4, 0x46, 0x10, 0x6D, 0x69, 0xCE, 0x8C, 0xCD, 0x14, 0x9E, 0x0D,
+    0xC0, 0x81, 0x71, 0x59, 0x0E, 0x1C, 0x10, 0x00, 0x22, 0x24, 0xD8, 0xDD, 0x91, 0x7D, 0x81, 0x43,
+    0xAE, 0x5C, 0xB7, 0xB1, 0x03, 0x27, 0x8E, 0x28, 0xC2, 0x0B, 0xB8, 0x93, 0x80, 0x80, 0x80, 0x00,
+    0xFE, 0xC0, 0x7C, 0x02, 0xC1, 0x05, 0x04, 0x7B, 0xAB, 0xB9, 0x5B, 0x57, 0x11, 0x38, 0x40, 0x76,
+    0xE2, 0xC0, 0x01, 0x3A, 0xA7, 0x04, 0x37, 0x80, 0xAA, 0x2C, 0x60, 0x56, 0xED, 0x37, 0xDA, 0x5D,
+    0x83, 0x53, 0x57, 0x31, 0x55, 0x33, 0x92, 0x46, 0xDD, 0x3D, 0xFD, 0x5E, 0xBF, 0x96, 0x88, 0x8A,
+    0x8C, 0xD4, 0x1D, 0x4B, 0x7B, 0x86, 0xC4, 0xCB, 0x86, 0xD2, 0x24, 0xA3, 0x87, 0x37, 0x28, 0x8C,
+    0x01, 0x51, 0xDA, 0xC8, 0x17, 0x5C, 0x9B, 0xC2, 0x64, 0x0B, 0xF2, 0xC2, 0x49, 0x97, 0xD8, 0xB4,
+    0xE8, 0x68, 0x21, 0x1A, 0xE1, 0x52, 0x9B, 0x1C, 0x32, 0xCD, 0x12, 0xFF, 0x63, 0xF7, 0x8A, 0x9F,
+    0xB2, 0xF6, 0x89, 0x4B, 0x8B, 0xE0, 0x77, 0x6E, 0x12, 0x4D, 0xBE, 0x67, 0xAF, 0xF9, 0x0F, 0xAE,
+    0xD2, 0xD7, 0xC2, 0x53, 0x62, 0x75, 0x4D, 0x33, 0xCA, 0x33, 0xD1, 0xC6, 0x9E, 0x74, 0xA5, 0x1D,
+    0x19, 0x32, 0x36, 0xF2, 0xD4, 0x91, 0xAA, 0x65, 0x43, 0x26, 0x4B, 0x2D, 0x79, 0x62, 0x92, 0x0E,
+    0xE6, 0xA6, 0x50, 0xC1, 0x2E, 0x61, 0xAE, 0xC8, 0xF0, 0x02, 0x59, 0x30, 0xE2, 0xC6, 0x0E, 0xA1,
+    0x93, 0x10, 0xBF, 0xC5, 0x14, 0x6F, 0x32, 0x22, 0xE9, 0x71, 0x17, 0x85, 0x2D, 0x3C, 0x94, 0x55,
+    0xF2, 0x84, 0xD7, 0xB9, 0x69, 0x9B, 0xD8, 0x9C, 0x66, 0xA2, 0x15, 0x0D, 0x8E, 0xB3, 0x25, 0xE5,
+    0xD2, 0xC7, 0x6D, 0xFE, 0xE2, 0xFE, 0xDB, 0xA7, 0x6C, 0xBC, 0x71, 0x39, 0xDE, 0x12, 0x3D, 0x42,
+    0x08, 0x78, 0x0E, 0x71, 0xDB, 0x65, 0x14, 0x2F, 0x96, 0x81, 0x56, 0x23, 0x6A, 0xFB, 0x4B, 0x5E,
+    0x85, 0x35, 0x29, 0xC3, 0x2A, 0xEB, 0x7E, 0x6F, 0x3F, 0x5E, 0x5B, 0x45, 0x93, 0x6D, 0xC0, 0xDD,
+    0x36, 0x5C, 0xB4, 0x8A, 0x8F, 0xB8, 0x4E, 0x8A, 0xB4, 0x51, 0x0D, 0x20, 0x78, 0x80, 0x35, 0xA0,
+    0x4A, 0x36, 0x0A, 0xB4, 0x01, 0x1F, 0xDB, 0x19, 0x89, 0x26, 0xF5, 0xDA, 0x92, 0xD9, 0x7C, 0x76,
+    0xD4, 0x90, 0x68, 0xA7, 0xDE, 0x10, 0x99, 0xFB, 0xD7, 0x7E, 0xAD, 0x28, 0x7E, 0xE3, 0xA6, 0xC0,
+    0x92, 0xCE, 0xD4, 0x09, 0xF2, 0x60, 0x5B, 0x02, 0x6B, 0xD2, 0x4A, 0x24, 0x14, 0x31, 0xE5, 0x96,
+    0x48, 0x07, 0x96, 0x08, 0x61, 0x0D, 0xBD, 0x1B, 0x1F, 0x85, 0xA5, 0xC3, 0x54, 0x81, 0x87, 0x5D,
+    0xE4, 0x26, 0x7F, 0x83, 0xE3, 0xA5, 0xB8, 0x58, 0xA7, 0x47, 0x83, 0xD4, 0xCE, 0xE4, 0x4B, 0xBE,
+    0xE5, 0x75, 0x5D, 0xE2, 0xF8, 0xC2, 0xEB, 0xEA, 0x40, 0x34, 0xE6, 0xB6, 0x53, 0xC7, 0xAC, 0x8B,
+    0xE4, 0x9E, 0xDF, 0xA5, 0xB1, 0x79, 0xE5, 0xE8, 0xCD, 0xF3, 0x67, 0x99, 0xE0, 0xB4, 0x25, 0xDD,
+    0x94, 0xC8, 0xF0, 0x5B, 0x04, 0x6C, 0xA5, 0x7D, 0xEF, 0x2C, 0x12, 0x35, 0x96, 0x50, 0x07, 0x73,
+    0x80, 0xDC, 0x8E, 0x1C, 0xC5, 0xF5, 0x27, 0x2B, 0x0E, 0xB6, 0xCE, 0x6D, 0xE7, 0xAC, 0x79, 0xCE,
+    0x45, 0x5E, 0x6B, 0x27, 0x1A, 0x2A, 0x29, 0x80, 0x0D, 0x50, 0xE7, 0x8E, 0x22, 0x0F, 0x07, 0x7D,
+    0x02, 0xCF, 0x80, 0xAA, 0x2F, 0x99, 0xC1, 0x43, 0x8F, 0x27, 0xB0, 0xAA, 0x43, 0x5D, 0x39, 0xCC,
+    0x2E, 0x54, 0xBA, 0xA7, 0x3B, 0x02, 0xC1, 0x31, 0xF0, 0xC4, 0xD8, 0x8F, 0xFE, 0xAE, 0x29, 0x6A,
+    0x50, 0xA3, 0xFD, 0xD3, 0xEB, 0x5C, 0x06, 0x94, 0x56, 0x79, 0x06, 0x32, 0x6B, 0x2A, 0x05, 0x72,
+    0xAE, 0xC2, 0x71, 0x26, 0xA3, 0x19, 0x8E, 0x4C, 0xEE, 0x56, 0x24, 0xFF, 0x42, 0x4C, 0x8F, 0x03,
+    0xCC, 0x14, 0xF1, 0x71, 0xA2, 0x58, 0xAC, 0x98, 0x0A, 0x55, 0x07, 0x85, 0x35, 0xAE, 0x39, 0x62,
+    0x27, 0xDD, 0xF2, 0x9C, 0xD5, 0x98, 0xA6, 0xD8, 0x7A, 0x82, 0x94, 0xDB, 0x19, 0xD8, 0x8D, 0x96,
+    0x55, 0x0E, 0x6A, 0xFE, 0x8E, 0x1D, 0x7B, 0xD3, 0xCA, 0x0E, 0x89, 0x9A, 0x4C, 0x39, 0x55, 0xE3,
+    0xE2, 0x49, 0x84, 0x0A, 0x26, 0xA8, 0x1F, 0x75, 0x08, 0xA2, 0x02, 0x88, 0x50, 0x2C, 0x11, 0x22,
+    0xE6, 0xF0, 0x56, 0x6B, 0x68, 0x01, 0xA3, 0xE6, 0x1A, 0x78, 0x16, 0xFF, 0x1E, 0x76, 0x75, 0x95,
+    0x4E, 0xE0, 0x94, 0x61, 0xFC, 0xF5, 0x5A, 0x52, 0x93, 0xAD, 0x88, 0x99, 0xA9, 0x64, 0xB6, 0xE8,
+    0x92, 0x4A, 0x17, 0xA6, 0x8E, 0x6D, 0x1A, 0x14, 0xB1, 0x9A, 0xBA, 0x59, 0xCD, 0x76, 0x59, 0x7A,
+    0xE9, 0xA3, 0x0A, 0xBC, 0x7A, 0xA0, 0xDC, 0x13, 0xDD, 0x24, 0xCF, 0x38, 0xB8, 0x32, 0xD7, 0xEF,
+    0x95, 0x0F, 0xF7, 0x69, 0x46, 0x90, 0x22, 0x2D, 0x96, 0x5D, 0x54, 0xAC, 0x25, 0x92, 0x36, 0x5E,
+    0xC2, 0x7E, 0xC6, 0x4E, 0x15, 0x0B, 0xBA, 0x01, 0x1A, 0x15, 0x04, 0x89, 0xF0, 0x07, 0xC1, 0xA5,
+    0x50, 0x75, 0x12, 0xF3, 0x5B, 0x87, 0x70, 0xE2, 0x98, 0xED, 0x3B, 0xE1, 0x81, 0xEA, 0x1E, 0x5F,
+    0x4F, 0xDF, 0x60, 0xB5, 0x3F, 0x99, 0x64, 0x88, 0xE5, 0xE3, 0x90, 0x3F, 0xDA, 0x39, 0x1B, 0x03,
+    0x9D, 0x22, 0x28, 0xAA, 0xE7, 0x25, 0x4C, 0x53, 0xAD, 0x66, 0x48, 0xA8, 0xC7, 0x23, 0xB3, 0xC4,
+    0xA1, 0x61, 0x9B, 0xA8, 0xD5, 0xAF, 0x27, 0x0B, 0x11, 0x5C, 0x31, 0xD7, 0x12, 0xDE, 0xEA, 0xEB,
+    0x25, 0x61, 0xB9, 0xF7, 0x0E, 0xCC, 0xFF, 0x4A, 0x3A, 0x68, 0xD8, 0xA2, 0xC0, 0x1E, 0x3C, 0x84,
+    0x76, 0x0E, 0xDA, 0xA2, 0xF4, 0x43, 0x91, 0x7E, 0x41, 0x16, 0xE2, 0xB0, 0xA1, 0xF1, 0x2E, 0x3A,
+    0x38, 0x43, 0xFB, 0x12, 0xFD, 0xB4, 0x16, 0x6F, 0xCC, 0xD7, 0x6C, 0xCE, 0x5E, 0x9D, 0x30, 0x3D,
+    0xD6, 0x95, 0x14, 0xEB, 0xAC, 0x97, 0x10, 0x3E, 0xA6, 0x59, 0xE4, 0x52, 0x2E, 0x41, 0x84, 0x1B,
+    0x27, 0x7E, 0xE5, 0xF4, 0x19, 0x04, 0x22, 0x02, 0x12, 0x83, 0x68, 0x71, 0x3B, 0x5C, 0xF2, 0xDF,
+    0xF7, 0x4F, 0xAF, 0x36, 0x5D, 0x2D, 0x85, 0x8D, 0x6E, 0xA3, 0x95, 0xEE, 0x42, 0x93, 0x85, 0x62,
+    0xF7, 0xE4, 0xE1, 0x13, 0x8C, 0x65, 0xF6, 0x1F, 0xF3, 0x20, 0xBE, 0x38, 0x98, 0x87, 0xEC, 0xA0,
+    0x67, 0x8A, 0x6F, 0xE1, 0x29, 0x39, 0xC1, 0xBB, 0x3C, 0xF8, 0x95, 0x21, 0xC0, 0x59, 0x69, 0x73,
+    0xD1, 0x2A, 0xFB, 0x45, 0x2F, 0x59, 0x75, 0xE8, 0x8D, 0xB4, 0x5F, 0x61, 0x1B, 0xDE, 0xA6, 0x1E,
+    0xDF, 0x34, 0xFA, 0x67, 0x82, 0xFD, 0xA9, 0xEC, 0x9B, 0xEE, 0xE2, 0x98, 0xE7, 0x77, 0x1B, 0xDA,
+    0x40, 0x0F, 0x3F, 0xE5, 0xE3, 0xC9, 0xD6, 0x80, 0xF6, 0xE5, 0xE2, 0x7A, 0xEE, 0xCF, 0x3F, 0xD8,
+    0xC8, 0x79, 0x01, 0x85, 0x44, 0x6E, 0x6A, 0x7E, 0x98, 0xBF, 0x68, 0x37, 0x88, 0xCE, 0xFF, 0xCE,
+    0xCF, 0xF4, 0xF6, 0x50, 0x55, 0x8F, 0xA3, 0x2A, 0x7C, 0x56, 0x13, 0x3F, 0x1C, 0x5E, 0xBD, 0x38,
+    0xDA, 0x49, 0x1D, 0x9A, 0xAE, 0xC8, 0xD4, 0x5D, 0xBB, 0x67, 0xC4, 0x4B, 0xE0, 0xA7, 0xBA, 0xFF,
+    0x15, 0x5D, 0x51, 0xD7, 0xD5, 0x93, 0x3F, 0x2D, 0xDB, 0xA4, 0x8A, 0x1F, 0x80, 0xC2, 0x9D, 0xFD,
+    0x69, 0x3B, 0xBC, 0x79, 0x69, 0x74, 0x26, 0xA4, 0xB5, 0x1D, 0xE1, 0xD3, 0xDB, 0xD6, 0x97, 0x07,
+    0x31, 0x1E, 0x86, 0x3A, 0xAE, 0x47, 0xA2, 0x36, 0x94, 0xC9, 0xAA, 0x14, 0x6E, 0xA4, 0x8E, 0xDC,
+    0x05, 0xBA, 0x9C, 0xDE, 0x9F, 0xD7, 0x53, 0x1D, 0x15, 0x67, 0xC7, 0xA3, 0x9B, 0x8F, 0xDD, 0x40,
+    0x16, 0x53, 0x7D, 0xE4, 0x86, 0xF8, 0x73, 0x5C, 0x2E, 0xBB, 0x9D, 0xD3, 0xF1, 0x66, 0xE3, 0x4D,
+    0x72, 0x58, 0x3C, 0x3C, 0xBD, 0xD9, 0x3D, 0x7A, 0xFE, 0x69, 0x6E, 0xB7, 0x4E, 0x6D, 0xBA, 0x76,
+    0x38, 0xDA, 0x20, 0x88, 0x4B, 0x54, 0xD3, 0x34, 0xCE, 0x22, 0xAA, 0x87, 0xB2, 0x98, 0xDD, 0xF1,
+    0x1B, 0xF4, 0xB9, 0x9A, 0xBB, 0x76, 0x17, 0xE5, 0x0A, 0x24, 0x64, 0xC6, 0xED, 0xED, 0xED, 0xC9,
+    0x5F, 0xC2, 0x7F, 0xE3, 0x91, 0x58, 0x7C, 0x59, 0xFA, 0x14, 0x64, 0xAA, 0x5B, 0xB7, 0x79, 0x38,
+    0xE2, 0xF9, 0xA6, 0xEB, 0x9B, 0x42, 0xF3, 0x2B, 0x6E, 0x69, 0x2B, 0xF1, 0x39, 0xE3, 0x0F, 0x79,
+    0x26, 0x00, 0xDA, 0x41, 0xFD, 0x50, 0xF8, 0x03, 0x52, 0xA1, 0x24, 0xC7, 0xCD, 0xCC, 0xDC, 0x3B,
+    0x0A, 0xC6, 0x1B, 0x5A, 0x1E, 0x76, 0xEF, 0x7F, 0xE3, 0x3F, 0xF8, 0xF8, 0x07, 0xB5, 0x55, 0x3D,
+    0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x64, 0x71, 0x61, 0x29, 0x93, 0x26, 0x05, 0x20, 0x64, 0x0A,
+    0x4A, 0xA4, 0x69, 0x29, 0xC8, 0x7A, 0x24, 0x90, 0x28, 0x68, 0x52, 0xAC, 0x6B, 0x28, 0x91, 0xA0,
+    0x4C, 0x41, 0x91, 0x68, 0x1E, 0x14, 0x34, 0x34, 0x69, 0xB6, 0x86, 0x12, 0x51, 0x53, 0x45, 0x51,
+    0x3C, 0x09, 0x25, 0x8D, 0x45, 0xFE, 0xC0, 0x93, 0xF8, 0x01, 0x99, 0xC2, 0x85, 0x03, 0x63, 0x5F,
+    0xCE, 0x19, 0xEF, 0xDB, 0xB0, 0x3F, 0x00, 0x6B, 0x3D, 0xEB, 0x37, 0x9E, 0xFB, 0x71, 0xCE, 0x3D,
+    0xF7, 0x5A, 0x84, 0xD7, 0x47, 0xB8, 0xBB, 0x28, 0x62, 0x56, 0x3C, 0xB8, 0x09, 0xCB, 0x97, 0x65,
+    0xBF, 0x1A, 0x86, 0x8B, 0x4A, 0x55, 0xBD, 0x53, 0x9D, 0xEA, 0x5C, 0x25, 0x51, 0x79, 0x28, 0xFD,
+    0xE1, 0x3D, 0xE9, 0x70, 0xA8, 0x4D, 0x22, 0xB5, 0xEA, 0x41, 0xF0, 0x52, 0xFA, 0xCB, 0xFB, 0xA7,
+    0x4D, 0x6F, 0xB2, 0xFC, 0x26, 0x9B, 0xDC, 0x93, 0x70, 0x19, 0x68, 0x1E, 0x47, 0x9E, 0xD8, 0xAF,
+    0x73, 0x7B, 0x10, 0xF7, 0x47, 0x92, 0xF6, 0xE5, 0x2C, 0xE2, 0xEF, 0x94, 0xBD, 0xB3, 0x61, 0xB8,
+    0xDF, 0xA8, 0xAE, 0x82, 0x73, 0xBE, 0x4D, 0x4D, 0x34, 0x0C, 0xB5, 0xC9, 0x03, 0x09, 0x1E, 0xF9,
+    0x20, 0xB1, 0x56, 0x37, 0x31, 0x78, 0x29, 0xDB, 0xE0, 0xAF, 0x36, 0x2B, 0xB1, 0xA9, 0x9E, 0xCC,
+    0x22, 0x73, 0xB5, 0x0D, 0x19, 0xE6, 0x5A, 0x33, 0x53, 0xF8, 0x1A, 0x2C, 0x1E, 0x5E, 0xE2, 0x4E,
+    0x8B, 0x8B, 0xF9, 0x61, 0x9B, 0xCE, 0xAD, 0x59, 0xAC, 0xC0, 0xA1, 0x48, 0xF8, 0x14, 0xB6, 0xBA,
+    0x08, 0x8E, 0x44, 0xB3, 0x74, 0xB3, 0xAC, 0xD8, 0x0E, 0xBE, 0x8F, 0x2E, 0xDA, 0xA3, 0x4D, 0x66,
+    0x81, 0xC3, 0xD5, 0xEA, 0x14, 0x5A, 0x4D, 0x0C, 0x6C, 0x27, 0xB9, 0x05, 0x48, 0xF6, 0xA7, 0x84,
+    0xF8, 0xC0, 0x3B, 0x9E, 0x70, 0x94, 0xEB, 0xB6, 0xEC, 0xE9, 0x85, 0x23, 0x6E, 0xBC, 0x79, 0x5B,
+    0x6E, 0xD0, 0x86, 0x48, 0x1A, 0xEB, 0x6C, 0x48, 0xDB, 0x02, 0xDA, 0xEE, 0x81, 0xA1, 0xDB, 0x3B,
+    0x6D, 0x19, 0xC7, 0x14, 0x77, 0x7F, 0x90, 0x6B, 0x2E, 0x0D, 0x37, 0x4B, 0x92, 0x07, 0x81, 0x39,
+    0x82, 0x81, 0x5B, 0x5C, 0x5F, 0x3F, 0x26, 0xCD, 0x11, 0x10, 0x53, 0xB3, 0x4A, 0x6E, 0x16, 0x39,
+    0xC7, 0x51, 0x5B, 0xB1, 0x58, 0x23, 0x7D, 0x28, 0x7E, 0x91, 0xA0, 0xED, 0xD7, 0xDD, 0xBE, 0x8F,
+    0xF2, 0xBE, 0x9D, 0xA5, 0xAB, 0xD4, 0x77, 0xB1, 0xDF, 0xF4, 0x08, 0xEA, 0x8E, 0xD2, 0xE9, 0xE3,
+    0x3D, 0xBD, 0xFA, 0x89, 0x87, 0xEB, 0xD8, 0x82, 0xAD, 0xE0, 0x9F, 0xD6, 0xB9, 0x4E, 0x36, 0xB5,
+    0xDE, 0x21, 0x83, 0x80, 0x9A, 0x8C, 0x0B, 0x6E, 0x64, 0x12, 0xF0, 0xDF, 0x25, 0x0B, 0x67, 0x4F,
+    0x65, 0x34, 0xB3, 0xC9, 0xF6, 0x75, 0x98, 0x7A, 0x14, 0xA9, 0xDB, 0xB3, 0x12, 0x19, 0x86, 0x0A,
+    0x51, 0x71, 0x1E, 0x14, 0x20, 0x24, 0xA0, 0xE0, 0x0F, 0xC5, 0x19, 0x0B, 0xB4, 0x4D, 0x90, 0x60,
+    0xBD, 0x12, 0x2A, 0xB2, 0x45, 0xD2, 0x41, 0xFD, 0x88, 0x0A, 0x52, 0x6A, 0x9F, 0x4D, 0xF6, 0xAF,
+    0xC5, 0xA4, 0x2C, 0x77, 0x6E, 0xED, 0xF5, 0x47, 0xF9, 0x17, 0x7A, 0x02, 0x0D, 0x64, 0x61, 0x2B,
+    0xC4, 0x80, 0x97, 0x37, 0xBF, 0xE1, 0xD7, 0x9D, 0x7E, 0x57, 0x9B, 0x34, 0x3A, 0xD7, 0xBA, 0x96,
+    0x24, 0x84, 0x59, 0x94, 0xB4, 0x49, 0x24, 0xCB, 0xD1, 0xC7, 0x9D, 0x58, 0x0A, 0x65, 0xBC, 0x22,
+    0x49, 0x77, 0x6E, 0x49, 0x1A, 0xC9, 0xA7, 0x57, 0x94, 0x5A, 0x9A, 0x79, 0xE7, 0xDE, 0x1E, 0xE5,
+    0x43, 0x98, 0x06, 0x60, 0x0B, 0x38, 0xE6, 0x8E, 0x7B, 0x19, 0xA1, 0x36, 0xA1, 0x90, 0x28, 0x1A,
+    0xE5, 0xDE, 0xC2, 0x36, 0x91, 0x47, 0x34, 0x11, 0x57, 0x0A, 0x66, 0x23, 0x29, 0x37, 0x13, 0x83,
+    0x55, 0xC9, 0x51, 0xE8, 0xD9, 0xB2, 0x7A, 0x8F, 0xCC, 0x02, 0x37, 0x4E, 0x56, 0x16, 0xEB, 0x10,
+    0xFC, 0x88, 0xA3, 0x2E, 0xBA, 0xE7, 0x9F, 0x4F, 0x36, 0xD9, 0xA3, 0x26, 0x93, 0xBB, 0xD4, 0xA7,
+    0x0E, 0xDE, 0xA1, 0x3C, 0x3D, 0x15, 0x07, 0x88, 0x2E, 0xCE, 0x06, 0x5F, 0x69, 0xEE, 0x91, 0xCB,
+    0x38, 0x3B, 0x66, 0x13, 0x19, 0xAF, 0x3F, 0x58, 0xAE, 0xDE, 0x52, 0x6C, 0x1E, 0xC2, 0x04, 0x2E,
+    0x66, 0x83, 0xA6, 0x81, 0x31, 0x16, 0xC8, 0x60, 0x1B, 0xC6, 0x1F, 0xB6, 0x2A, 0xE3, 0xBD, 0x02,
+    0xE5, 0x88, 0xC2, 0x71, 0x55, 0x20, 0xDD, 0xAA, 0x15, 0x58, 0xB7, 0x36, 0x07, 0x45, 0xE1, 0xD3,
+    0xA8, 0x50, 0x8C, 0x97, 0x53, 0xFB, 0x0D, 0xB4, 0x5F, 0x0D, 0xA1, 0xDA, 0xEF, 0xB3, 0x8D, 0x6C,
+    0x1A, 0x49, 0xFD, 0x61, 0xDE, 0x05, 0x45, 0x96, 0xC4, 0xBD, 0xDA, 0x0A, 0x19, 0x98, 0x12, 0x0D,
+    0x10, 0x4D, 0xC8, 0x29, 0x78, 0x17, 0x4B, 0x1C, 0x76, 0x0E, 0x12, 0xEC, 0x00, 0xE4, 0x77, 0x3A,
+    0xEF, 0x34, 0x9E, 0xE0, 0x34, 0x8C, 0xE2, 0x50, 0x8D, 0x8A, 0xBA, 0x69, 0x58, 0xB3, 0xB7, 0xFC,
+    0x35, 0x54, 0xF9, 0xA5, 0xD2, 0xB5, 0x81, 0x8A, 0x66, 0xBB, 0x02, 0x67, 0xFF, 0x0D, 0x8A, 0x07,
+    0x56, 0xFB, 0xEF, 0x10, 0x31, 0x7C, 0x02, 0xA4, 0xA3, 0x2D, 0x10, 0x59, 0x41, 0x8A, 0x67, 0x85,
+    0xA7, 0x6A, 0x05, 0xEC, 0x3A, 0x83, 0x07, 0x93, 0x29, 0x08, 0xF6, 0x6C, 0xB3, 0x40, 0x6A, 0x41,
+    0x85, 0x1A, 0x63, 0xFF, 0xFC, 0xF7, 0x7A, 0x50, 0x44, 0xBF, 0x70, 0x6D, 0x73, 0x49, 0xA9, 0xAC,
+    0xF2, 0xF3, 0xE9, 0xC0, 0xDD, 0x41, 0xD8, 0xB0, 0xE8, 0xFB, 0x54, 0xEB, 0x04, 0xC6, 0x81, 0x09,
+    0x5A, 0xB2, 0xEC, 0x5B, 0xD2, 0x0E, 0xC5, 0xAD, 0x15, 0x44, 0xD0, 0x26, 0x6A, 0xDF, 0xBD, 0xF8,
+    0x1B, 0x20, 0xD4, 0xFD, 0x88, 0xD0, 0xFF, 0xCC, 0xD0, 0x5A, 0xA7, 0x9E, 0x02, 0x4C, 0x60, 0xC9,
+    0x28, 0x55, 0x0A, 0xC3, 0x91, 0x5D, 0x0C, 0xF2, 0x3B, 0x9D, 0xD8, 0x23, 0x0A, 0xBD, 0x5E, 0x05,
+    0xFB, 0xA0, 0x3E, 0x40, 0x08, 0xDF, 0xC2, 0x03, 0xCE, 0x34, 0xE4, 0xE4, 0xCC, 0x5F, 0x4D, 0x8D,
+    0xFB, 0x77, 0x2F, 0x7A, 0x35, 0xFA, 0xA7, 0x4E, 0xDD, 0xD2, 0xCE, 0x92, 0x51, 0x6C, 0xE7, 0x01,
+    0x2F, 0x81, 0x19, 0xE4, 0x90, 0x3B, 0x2F, 0xF6, 0x25, 0x34, 0xF0, 0xEC, 0x29, 0x2D, 0x61, 0xD5,
+    0x9F, 0xA6, 0x86, 0xF3, 0x52, 0x37, 0x60, 0x0B, 0x12, 0x10, 0xCB, 0x8A, 0x8D, 0xFE, 0x86, 0x9C,
+    0x3A, 0xCC, 0xC3, 0xBC, 0xAB, 0xA9, 0xA6, 0x3A, 0xC0, 0x72, 0x61, 0x8E, 0x00, 0xA1, 0x25, 0x42,
+    0x63, 0xA1, 0xC7, 0x1D, 0x76, 0x5D, 0x5A, 0x8E, 0xC8, 0x38, 0x5F, 0xAF, 0x0D, 0x66, 0x1A, 0x10,
+    0xD8, 0xE5, 0x17, 0x28, 0x3D, 0x94, 0x70, 0x6C, 0xA9, 0x1A, 0xA4, 0xC0, 0x6E, 0x90, 0x5E, 0x4A,
+    0x1F, 0x70, 0xFD, 0xB8, 0x3C, 0x16, 0x09, 0xEC, 0x13, 0x5E, 0xBE, 0x92, 0xAB, 0xA1, 0x57, 0xB8,
+    0xB7, 0xE5, 0x3B, 0xC3, 0xE5, 0xFC, 0x19, 0x96, 0x1C, 0x80, 0x7E, 0x0E, 0x74, 0x04, 0x27, 0xED,
+    0xD4, 0x03, 0x67, 0x44, 0x03, 0x73, 0x7C, 0x32, 0x50, 0x14, 0x6A, 0x03, 0x15, 0x44, 0x3E, 0x49,
+    0xBA, 0x23, 0x2C, 0x75, 0x0D, 0x1B, 0x07, 0x00, 0xA5, 0xCB, 0x13, 0xD4, 0x34, 0x72, 0xDB, 0xA7,
+    0xAC, 0xC5, 0x94, 0xA5, 0x64, 0x4B, 0x40, 0x0E, 0xD1, 0x32, 0x21, 0xA7, 0x31, 0x36, 0xA9, 0x9D,
+    0xF1, 0x19, 0x83, 0xB9, 0x04, 0x9C, 0xEC, 0x63, 0x77, 0x0C, 0x13, 0xCC, 0x27, 0x77, 0xDD, 0x0C,
+    0xEF, 0x3C, 0xF1, 0x35, 0x07, 0xAD, 0xBE, 0xCA, 0x95, 0x7B, 0xBE, 0xE2, 0x14, 0x98, 0xF0, 0xD0,
+    0x96, 0xCF, 0x1C, 0x83, 0x70, 0x37, 0x41, 0x89, 0xF8, 0x6E, 0xBC, 0x9B, 0xAB, 0x5C, 0xAF, 0xF4,
+    0x66, 0x32, 0x66, 0xFC, 0x62, 0x30, 0x98, 0xBB, 0x14, 0xCA, 0xD7, 0xEE, 0xF5, 0x69, 0x40, 0xDE,
+    0x48, 0x0E, 0xF5, 0x8C, 0xE7, 0x98, 0x34, 0xD6, 0x37, 0xB3, 0x39, 0xEC, 0xC9, 0xED, 0xD3, 0x9A,
+    0xE3, 0xE7, 0x4D, 0xC6, 0xD7, 0xDF, 0x05, 0x36, 0x3A, 0xC0, 0xBB, 0x32, 0x79, 0xFE, 0x9F, 0xEB,
+    0x5F, 0xA5, 0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0x7B, 0x79, 0xB8, 0xB0, 0xD0, 0x52, 0x90,
+    0x86, 0x48, 0x98, 0x96, 0x22, 0xDA, 0x96, 0xEA, 0x76, 0xC9, 0x95, 0x14, 0xA4, 0x38, 0xD7, 0xD7,
+    0x50, 0x20, 0x40, 0xA2, 0xA1, 0xCC, 0xC5, 0x86, 0x14, 0x14, 0x29, 0x48, 0x43, 0x4F, 0x01, 0x82,
+    0x9F, 0x00, 0xE8, 0x88, 0x9D, 0x34, 0xB4, 0x96, 0xEE, 0x0F, 0x58, 0xC0, 0x89, 0xE2, 0x8A, 0x5B,
+    0xA4, 0x8D, 0x62, 0x91, 0xF5, 0x0E, 0xDF, 0xAC, 0xDF, 0x0B, 0x88, 0x96, 0xA7, 0xBB, 0xF7, 0xFC,
+    0xEC, 0x9D, 0x99, 0xEF, 0x9B, 0xEF, 0x9B, 0x79, 0x54, 0xB4, 0x6D, 0xEB, 0xC8, 0x32, 0x47, 0x2A,
+    0x99, 0x93, 0x23, 0x35, 0xDB, 0x9E, 0xE8, 0x4C, 0x05, 0xA2, 0x7A, 0xEC, 0x1C, 0x51, 0xAC, 0x3D,
+    0x51, 0xE3, 0x98, 0xA8, 0xF4, 0x7A, 0x26, 0x3A, 0xA2, 0x15, 0x8F, 0xA6, 0x66, 0xC4, 0xA3, 0x32,
+    0x12, 0x19, 0x67, 0x47, 0x52, 0x5E, 0x2D, 0xF8, 0x4E, 0xD6, 0x51, 0x37, 0xD6, 0x41, 0x12, 0x72,
+    0x50, 0x78, 0x63, 0xD7, 0x11, 0x9E, 0x56, 0x93, 0x04, 0xDE, 0x25, 0xAA, 0xA6, 0x0A, 0x81, 0x77,
+    0xE9, 0x53, 0x5C, 0x22, 0x79, 0x7E, 0x01, 0x02, 0x75, 0xCC, 0x53, 0x8D, 0x18, 0x1A, 0xF0, 0xD0,
+    0x8E, 0x0D, 0xE9, 0xB9, 0x72, 0x15, 0x40, 0x48, 0x09, 0x1A, 0x78, 0x46, 0xCA, 0x40, 0xFA, 0xF2,
+    0x84, 0xF6, 0x37, 0x5F, 0x25, 0xA6, 0x5B, 0x64, 0x7B, 0xED, 0x9A, 0xCB, 0xD3, 0x11, 0xE1, 0xDE,
+    0x48, 0x38, 0xBD, 0x45, 0x37, 0x4E, 0x8A, 0x6F, 0x88, 0x7B, 0x8E, 0x75, 0x24, 0x1E, 0xBB, 0xD9,
+    0x44, 0xFA, 0x6E, 0x6E, 0xFA, 0xEE, 0x03, 0x10, 0x30, 0x3D, 0x60, 0x52, 0xB0, 0xC7, 0xE0, 0x44,
+    0x8B, 0x15, 0x2C, 0x74, 0xDE, 0x69, 0x97, 0x6B, 0x80, 0x22, 0x15, 0x9C, 0x3F, 0xAA, 0xB0, 0x82,
+    0x0A, 0x40, 0x44, 0x83, 0x23, 0xF6, 0x71, 0xD4, 0xF8, 0xE0, 0xDB, 0x0B, 0x1A, 0xA0, 0x92, 0x0A,
+    0xC0, 0xA0, 0x17, 0x15, 0x54, 0xA4, 0xCE, 0x9B, 0x54, 0x32, 0x75, 0xBD, 0x4D, 0x34, 0x1C, 0x08,
+    0xD1, 0xCB, 0x3F, 0x12, 0xC8, 0x53, 0x83, 0xFF, 0x73, 0x15, 0xCB, 0xB9, 0xF6, 0x15, 0x49, 0xA2,
+    0x55, 0x52, 0x92, 0x49, 0xC8, 0x85, 0xFF, 0x9B, 0xD2, 0x48, 0xE0, 0x69, 0xE6, 0xB7, 0xA9, 0xBB,
+    0xEF, 0x55, 0xD4, 0x4F, 0xBB, 0xC9, 0xF0, 0x8A, 0xB8, 0x7E, 0xDF, 0x99, 0x93, 0xA2, 0xBD, 0x53,
+    0x71, 0xB0, 0x3C, 0xD6, 0xEC, 0x86, 0x85, 0xA0, 0x05, 0x34, 0xB1, 0x23, 0x2A, 0x53, 0x22, 0xEB,
+    0x01, 0xB4, 0xE2, 0x11, 0xB9, 0x3B, 0xE4, 0x1B, 0xEA, 0xAB, 0x40, 0x2A, 0x3E, 0x42, 0x25, 0x7D,
+    0x3D, 0x81, 0x46, 0xB7, 0x42, 0x95, 0x92, 0xC7, 0x66, 0x22, 0x1D, 0x05, 0x9E, 0x1D, 0xD1, 0xB9,
+    0x22, 0x91, 0x46, 0x1A, 0x3E, 0xE6, 0xA5, 0xE4, 0xD8, 0xF0, 0x94, 0x4B, 0x09, 0xF6, 0xF7, 0x15,
+    0xDE, 0xD5, 0x7C, 0x0B, 0x97, 0xFA, 0x0A, 0x52, 0x67, 0xA4, 0x44, 0xBB, 0x17, 0xBC, 0x6E, 0xB4,
+    0x02, 0x89, 0x57, 0xCD, 0xBE, 0xE4, 0x09, 0x4F, 0x91, 0x4E, 0x92, 0x7B, 0x88, 0x21, 0x5A, 0x20,
+    0xF9, 0x5A, 0xB0, 0x07, 0x4C, 0xA1, 0x60, 0x9E, 0xFC, 0x05, 0x86, 0x6C, 0x1E, 0x78, 0x52, 0xCF,
+    0x03, 0x5C, 0xD2, 0xB0, 0x13, 0x98, 0x1E, 0xED, 0x53, 0x4C, 0x26, 0x07, 0x0E, 0x80, 0xD9, 0x83,
+    0x0E, 0x70, 0xA0, 0x27, 0x03, 0x57, 0x22, 0x62, 0x7B, 0x42, 0xDF, 0xA3, 0x4C, 0x85, 0x1B, 0x41,
+    0xAF, 0xA0, 0x67, 0x3F, 0x06, 0x76, 0x70, 0xB6, 0x9F, 0xE1, 0x69, 0x77, 0x0C, 0x6C, 0x83, 0x28,
+    0x32, 0x88, 0x56, 0xF0, 0x18, 0x3A, 0x6B, 0x7A, 0xD4, 0x86, 0x29, 0xCB, 0x28, 0x1A, 0x89, 0x69,
+    0xD5, 0x02, 0xF6, 0xD5, 0x52, 0xAE, 0xE0, 0x4A, 0xE8, 0x9E, 0xA8, 0xB4, 0xD1, 0xF8, 0x8F, 0xE9,
+    0xE9, 0x60, 0xFA, 0x2A, 0x9B, 0x1E, 0x88, 0x28, 0x02, 0x19, 0x69, 0x41, 0x5B, 0x78, 0x10, 0x24,
+    0x2B, 0x36, 0xAC, 0x26, 0xD1, 0xF0, 0x5C, 0x7A, 0xAF, 0x7B, 0x04, 0x28, 0x21, 0xF2, 0xDA, 0xCF,
+    0xA0, 0xA0, 0x78, 0x44, 0x80, 0xF5, 0x9A, 0x67, 0x85, 0xA6, 0xA6, 0x43, 0xBF, 0x76, 0xAD, 0xFC,
+    0xD5, 0x3C, 0xE2, 0x40, 0x21, 0x3D, 0xEB, 0xA9, 0x11, 0x53, 0xE2, 0x16, 0xA1, 0x4D, 0xEA, 0x7A,
+    0xBA, 0x87, 0x64, 0xCF, 0xC2, 0x11, 0x86, 0xE4, 0xFC, 0x51, 0x03, 0x0E, 0xD6, 0x7C, 0xF9, 0x60,
+    0x26, 0xFD, 0xC5, 0xB3, 0x27, 0xC0, 0x3E, 0xF2, 0x94, 0x50, 0xC5, 0x7A, 0x14, 0x5B, 0x74, 0xD0,
+    0x13, 0x9D, 0x95, 0x11, 0x93, 0x69, 0xE8, 0x0C, 0x56, 0xD2, 0xE3, 0x1B, 0x30, 0x83, 0x59, 0xE1,
+    0x59, 0xA8, 0xE8, 0x48, 0x8C, 0xDB, 0x9E, 0xEC, 0xDA, 0x3B, 0xFB, 0x56, 0x86, 0x9A, 0xFB, 0x4D,
+    0x9F, 0x2C, 0x3B, 0x9A, 0x01, 0x09, 0x3A, 0x87, 0x4F, 0x0C, 0x28, 0x5C, 0x34, 0xC8, 0xBC, 0xE8,
+    0xEC, 0xF7, 0xD4, 0x9E, 0x7A, 0x39, 0x78, 0x10, 0x74, 0x0B, 0x88, 0x39, 0x40, 0xC4, 0x11, 0xB3,
+    0x20, 0x9D, 0xEF, 0xA4, 0xD5, 0x1F, 0x3E, 0x94, 0x9E, 0x4F, 0x32, 0xB2, 0xAE, 0x09, 0x4D, 0xAC,
+    0x70, 0x6E, 0x62, 0x57, 0xA6, 0xC6, 0x93, 0xF9, 0x75, 0xA5, 0x32, 0x21, 0xCC, 0xFC, 0x16, 0xB7,
+    0x0B, 0x7B, 0x21, 0x99, 0x70, 0x31, 0xDC, 0x87, 0xB1, 0xBD, 0xF1, 0xD5, 0x4A, 0x7C, 0xC5, 0xAE,
+    0x92, 0x14, 0xF5, 0xDE, 0x7C, 0x79, 0x07, 0xB4, 0x0E, 0xF3, 0x02, 0x49, 0x06, 0xD9, 0x43, 0xA8,
+    0x0F, 0xB5, 0xEC, 0x28, 0x56, 0x59, 0xB2, 0x49, 0x5C, 0x2D, 0xBE, 0x12, 0xA3, 0x0D, 0x32, 0x44,
+    0xDA, 0x17, 0xAB, 0xCC, 0x00, 0x24, 0x69, 0x26, 0x40, 0x2C, 0x33, 0x5A, 0x4C, 0xC6, 0x22, 0xC0,
+    0x41, 0xAF, 0xEB, 0x85, 0x26, 0xBF, 0xCB, 0x1E, 0xC0, 0x45, 0x92, 0xD7, 0x7F, 0x12, 0xCE, 0x29,
+    0xAF, 0x9A, 0x97, 0x86, 0x5A, 0xCE, 0x33, 0x32, 0x19, 0xD4, 0xD0, 0x1E, 0x7D, 0x45, 0x19, 0xA1,
+    0x7C, 0x1D, 0xD1, 0x14, 0x34, 0x3F, 0x3D, 0xDC, 0x76, 0x8F, 0x58, 0x4C, 0xDC, 0xD1, 0xC0, 0x74,
+    0x9D, 0xCC, 0x1A, 0xCB, 0x64, 0xD0, 0x47, 0x5F, 0x8B, 0x77, 0x20, 0x2C, 0x7B, 0x95, 0x28, 0xAA,
+    0x95, 0x8E, 0xE0, 0x34, 0x9D, 0x8F, 0xCB, 0xDA, 0x04, 0x18, 0xB1, 0xB7, 0x80, 0xD9, 0xE7, 0x90,
+    0x1B, 0x0B, 0xBD, 0x02, 0x13, 0x34, 0x3D, 0xBC, 0x37, 0xE6, 0x0E, 0x98, 0xFD, 0xA8, 0xEF, 0xC0,
+    0x1F, 0xFB, 0x8F, 0x2F, 0x64, 0x71, 0x2E, 0xCD, 0x74, 0x7E, 0x56, 0x7B, 0xA3, 0xB1, 0x12, 0xDE,
+    0x71, 0xA9, 0x70, 0x39, 0x23, 0xE6, 0x45, 0x1A, 0xB0, 0x65, 0x4C, 0xFB, 0x32, 0xE6, 0x5F, 0x65,
+    0xE0, 0x3E, 0x74, 0x34, 0xC8, 0x98, 0x16, 0xED, 0x31, 0x7B, 0xBB, 0x1A, 0x4C, 0x63, 0x3F, 0x38,
+    0x3D, 0xAA, 0x50, 0x62, 0x29, 0xF7, 0x56, 0xC6, 0x03, 0x0D, 0x7B, 0x8C, 0x43, 0xAB, 0x45, 0xBA,
+    0x2B, 0x84, 0x77, 0xF8, 0xA2, 0x0E, 0x08, 0x71, 0x8C, 0xDE, 0xBC, 0x27, 0xB9, 0x64, 0xE1, 0x81,
+    0x29, 0x9A, 0x78, 0x78, 0x61, 0x5B, 0xD0, 0x26, 0x99, 0x2C, 0x7B, 0xFA, 0xE4, 0x32, 0x2F, 0x4D,
+    0xA7, 0x9F, 0x27, 0x76, 0xAC, 0x67, 0xAE, 0xBD, 0xBD, 0x1D, 0xAD, 0x8B, 0xD5, 0x9F, 0x6B, 0xE5,
+    0xCD, 0x2F, 0xC1, 0x8C, 0x49, 0xCF, 0x09, 0x3C, 0xFE, 0x78, 0xCA, 0x0E, 0x8C, 0x3D, 0xDD, 0xE4,
+    0xDF, 0x91, 0x46, 0x82, 0xCD, 0x22, 0x45, 0x83, 0x10, 0x77, 0xB4, 0xF9, 0x16, 0xDD, 0x45, 0xD5,
+    0x3A, 0x01, 0x32, 0xA8, 0x59, 0xE1, 0x85, 0x1D, 0x5C, 0xE4, 0x45, 0x6C, 0xAF, 0x9D, 0x94, 0x96,
+    0x5E, 0xE5, 0x37, 0x81, 0x4A, 0x36, 0x27, 0x12, 0xE4, 0xE6, 0x3D, 0x20, 0x35, 0x9F, 0x03, 0x5E,
+    0x33, 0x42, 0xAB, 0x46, 0x7E, 0x82, 0x3A, 0x6C, 0xA9, 0xD1, 0x8A, 0xFE, 0x5B, 0x7A, 0xB8, 0xEB,
+    0x42, 0xDC, 0x15, 0xB6, 0xB5, 0x95, 0xD7, 0x68, 0xDE, 0x12, 0xA2, 0x4E, 0xE7, 0x74, 0x76, 0x97,
+    0xAC, 0xA7, 0x6D, 0xA3, 0x95, 0xDB, 0x86, 0xCD, 0xEE, 0x5A, 0xFE, 0x09, 0x78, 0x61, 0xC7, 0xAF,
+    0x4E, 0x65, 0x87, 0xB2, 0xB8, 0x6B, 0xFB, 0xC9, 0xA0, 0x2A, 0xFB, 0xE2, 0x4C, 0xDE, 0x6A, 0x81,
+    0x47, 0x3F, 0xE4, 0xCB, 0x17, 0xAB, 0x73, 0x07, 0x4D, 0x02, 0x27, 0xB3, 0x82, 0xC7, 0x00, 0xE1,
+    0x34, 0x36, 0xBE, 0x94, 0xE8, 0xF1, 0x53, 0xB7, 0xE0, 0x02, 0x18, 0x82, 0x18, 0x1C, 0xD9, 0xE0,
+    0xAA, 0x99, 0x76, 0xDF, 0xAE, 0xB4, 0x09, 0x9C, 0x15, 0x17, 0xCA, 0x38, 0x47, 0x79, 0x41, 0x6E,
+    0x15, 0xFF, 0xFF, 0xEB, 0x6F, 0xAD, 0x54, 0x3D, 0x6F, 0x1D, 0x45, 0x14, 0xBD, 0xBB, 0x1B, 0x18,
+    0xD0, 0x0A, 0xCD, 0x2B, 0x20, 0x42, 0x02, 0x31, 0x3F, 0x80, 0x8F, 0xA1, 0xA0, 0x24, 0xCC, 0x06,
+    0x17, 0x94, 0x49, 0x61, 0xD7, 0xA1, 0x06, 0x24, 0x53, 0x50, 0xC6, 0xEC, 0x22, 0x4B, 0xB8, 0x04,
+    0xAA, 0x94, 0xA1, 0x4E, 0x03, 0x45, 0x0A, 0x10, 0x8E, 0x77, 0x1C, 0x0B, 0xA5, 0x48, 0xC1, 0xA2,
+    0xFC, 0x80, 0x8C, 0x91, 0x52, 0xA0, 0x14, 0x19, 0xE3, 0x29, 0xE6, 0xE1, 0xD9, 0xBD, 0x9C, 0x79,
+    0x6B, 0xE3, 0x20, 0x51, 0x66, 0x9F, 0xDF, 0x8C, 0xB5, 0x6F, 0xE6, 0xDE, 0x73, 0xCF, 0x39, 0xF7,
+    0xD2, 0xC6, 0xFA, 0x2B, 0xEB, 0x1B, 0xEB, 0x05, 0x27, 0x8E, 0x9C, 0xA8, 0x77, 0xF9, 0x43, 0xDA,
+    0x9A, 0xCE, 0x74, 0x94, 0x97, 0xB6, 0x21, 0xD3, 0xB4, 0x4D, 0x4F, 0x94, 0x17, 0x26, 0xEA, 0xF1,
+    0x99, 0x68, 0xB5, 0x8C, 0x94, 0x97, 0x22, 0x51, 0x5E, 0xCA, 0x44, 0x79, 0xA9, 0x12, 0xE5, 0xA5,
+    0x8A, 0x94, 0x97, 0x2A, 0x50, 0x5E, 0x84, 0x27, 0x11, 0xEB, 0x50, 0x7B, 0x6A, 0x19, 0xCF, 0x44,
+    0xFD, 0xBC, 0xD1, 0x79, 0xF6, 0xE5, 0xFF, 0x65, 0x6F, 0xFE, 0x9B, 0xBD, 0x7F, 0x26, 0xD9, 0x79,
+    0xCE, 0x8E, 0x52, 0xF2, 0xD3, 0xCE, 0xDB, 0xD6, 0xBC, 0xED, 0xCE, 0xDB, 0x4F, 0xF3, 0x76, 0x9B,
+    0x4E, 0x9F, 0xE7, 0x36, 0x36, 0xA8, 0x66, 0x76, 0x15, 0xBE, 0x14, 0xB5, 0xA5, 0x2D, 0xE9, 0x48,
+    0x22, 0x7C, 0x71, 0x19, 0x28, 0x32, 0x2E, 0xD2, 0x3C, 0x90, 0x44, 0xD0, 0x2A, 0x68, 0x57, 0x64,
+    0x1C, 0x19, 0xA9, 0xB1, 0xDA, 0x4A, 0x27, 0x9D, 0x88, 0xCA, 0x2B, 0x66, 0x8F, 0x18, 0xDF, 0xCE,
+    0x11, 0x37, 0xD6, 0x11, 0xB4, 0x51, 0xEC, 0x4A, 0x1E, 0xA9, 0x0F, 0xF4, 0x1A, 0x37, 0x28, 0x01,
+    0x17, 0x50, 0x36, 0x65, 0xF8, 0x01, 0xD0, 0x3A, 0x54, 0x4D, 0x22, 0x10, 0x90, 0xAF, 0x6A, 0x9F,
+    0x1A, 0xE9, 0x91, 0x64, 0xCA, 0x0C, 0x8C, 0x32, 0xA8, 0x81, 0x94, 0x35, 0x77, 0xE7, 0x92, 0x01,
+    0xCA, 0x58, 0xB3, 0x9D, 0x70, 0x59, 0x04, 0xC4, 0x68, 0xBF, 0x66, 0x11, 0x73, 0xC1, 0xDB, 0x73,
+    0xDA, 0x9E, 0xCF, 0x8A, 0xC9, 0xB9, 0x8B, 0x4C, 0x7E, 0x1F, 0x01, 0xDB, 0x52, 0xCE, 0x08, 0x96,
+    0x33, 0xC5, 0x73, 0x29, 0x3D, 0x77, 0x04, 0xB0, 0x34, 0xD6, 0x09, 0x9C, 0x8E, 0x65, 0x2A, 0xC6,
+    0x0A, 0xFF, 0x81, 0xCA, 0x84, 0x42, 0x02, 0x62, 0x0E, 0x3D, 0x2F, 0xE7, 0x58, 0x17, 0x7F, 0xC6,
+    0x5D, 0x8E, 0xA4, 0x4E, 0xB8, 0xAB, 0xAD, 0xF2, 0xA5, 0x2B, 0x27, 0xFA, 0x3C, 0xD7, 0x41, 0xC0,
+    0x0A, 0x15, 0x66, 0x52, 0x98, 0x2D, 0xDD, 0xFA, 0x01, 0x2F, 0xEA, 0x90, 0x5F, 0x56, 0xB6, 0x9C,
+    0xAA, 0x50, 0x30, 0xF1, 0x0D, 0x06, 0x73, 0x0C, 0x3C, 0xCB, 0x73, 0x70, 0x9F, 0x7E, 0x4F, 0x82,
+    0xC1, 0x57, 0x04, 0xE7, 0x1F, 0x72, 0xDE, 0xBC, 0x0E, 0x2A, 0x90, 0xD9, 0xC7, 0x61, 0x47, 0x13,
+    0x02, 0x1B, 0x5B, 0x05, 0xD0, 0xC3, 0xA4, 0xEE, 0x8E, 0x39, 0x49, 0x0F, 0xB8, 0xD2, 0xAF, 0xD2,
+    0x18, 0x2B, 0x1F, 0x21, 0xE0, 0x44, 0xED, 0x5A, 0x42, 0xBA, 0x32, 0xAD, 0x8E, 0xD7, 0xDE, 0x0C,
+    0x40, 0x66, 0xBA, 0x1E, 0x20, 0xF1, 0x23, 0x3F, 0x66, 0x90, 0x53, 0x70, 0x16, 0x00, 0xD7, 0x97,
+    0x74, 0xFE, 0x14, 0x2B, 0x7E, 0x20, 0x0B, 0x68, 0x0B, 0xA4, 0xDC, 0xCC, 0xEC, 0xEC, 0x47, 0x9A,
+    0x1B, 0xC2, 0x82, 0x26, 0xBD, 0x04, 0xA3, 0x75, 0xE6, 0xB1, 0xC2, 0x59, 0x12, 0x87, 0x90, 0x4F,
+    0x42, 0x0C, 0xD2, 0xC8, 0x4B, 0x3D, 0x34, 0x34, 0xA0, 0x8B, 0x8C, 0x37, 0x9C, 0xD3, 0x9E, 0xD1,
+    0x5F, 0xE0, 0xCB, 0x37, 0x3B, 0x85, 0x3B, 0x93, 0xF2, 0xA8, 0xAC, 0x33, 0x04, 0x8A, 0x2B, 0x2F,
+    0x91, 0xC8, 0x34, 0x4C, 0xA9, 0x86, 0x65, 0x7F, 0xF9, 0x43, 0x9E, 0x3C, 0x1C, 0x4D, 0x32, 0xAE,
+    0xED, 0xA6, 0xA7, 0xB0, 0xD1, 0xC7, 0x90, 0xC9, 0x52, 0x3B, 0x81, 0x56, 0x47, 0x30, 0x93, 0x1C,
+    0x88, 0xEE, 0x00, 0x82, 0xBB, 0x4A, 0x7A, 0x33, 0x42, 0xB6, 0x20, 0x46, 0x40, 0x1E, 0xB4, 0x85,
+    0xCD, 0xAB, 0x50, 0x46, 0x39, 0xC8, 0x01, 0x2D, 0x44, 0x23, 0xE4, 0x1B, 0x5B, 0x2B, 0x50, 0xAD,
+    0x80, 0xBE, 0xF3, 0xD3, 0xA0, 0x80, 0x46, 0xB2, 0x97, 0x36, 0x49, 0x6B, 0xC4, 0xA0, 0xD7, 0xFE,
+    0xE6, 0x06, 0x8C, 0x9B, 0xA6, 0x57, 0x56, 0x1D, 0x00, 0xD3, 0x04, 0x84, 0xEC, 0x4B, 0x98, 0x7B,
+    0xD5, 0x07, 0x38, 0xDF, 0x31, 0xEF, 0x0C, 0x7B, 0x2F, 0x94, 0x91, 0xF4, 0x20, 0x40, 0xE4, 0x00,
+    0x65, 0x26, 0x12, 0xBE, 0xD6, 0xBF, 0x27, 0xC3, 0x43, 0x1B, 0x57, 0x27, 0x9F, 0xBF, 0x8A, 0xA3,
+    0x16, 0x82, 0xD0, 0x7B, 0x59, 0x72, 0xF8, 0x21, 0xDB, 0x5B, 0xD9, 0x62, 0x4A, 0x00, 0x69, 0xCD,
+    0x8D, 0x24, 0x9D, 0xDA, 0x47, 0xC7, 0x9A, 0x4E, 0x6F, 0x87, 0x2A, 0x18, 0x6A, 0x11, 0xC2, 0x99,
+    0xCB, 0x09, 0x28, 0xD1, 0x17, 0x03, 0xB5, 0xEE, 0x5F, 0x90, 0x1A, 0x85, 0x81, 0xA1, 0x11, 0x30,
+    0xD5, 0x57, 0x51, 0xE3, 0x58, 0xDF, 0x19, 0x98, 0xBB, 0x59, 0x18, 0xBA, 0x6D, 0x1E, 0x07, 0xF4,
+    0x5E, 0x3D, 0xB3, 0xF4, 0x32, 0x2D, 0x8A, 0x46, 0x24, 0x61, 0x5B, 0xDB, 0x27, 0x23, 0x78, 0xED,
+    0x89, 0x8F, 0xE6, 0xB3, 0x97, 0xE4, 0xFD, 0x07, 0x88, 0xA6, 0x5B, 0x9D, 0xDD, 0x3D, 0xC6, 0x2C,
+    0x59, 0xAE, 0x48, 0x3E, 0xCC, 0xAA, 0x5C, 0xEF, 0xD1, 0xF5, 0xD5, 0x83, 0xBF, 0xE2, 0x5B, 0x6F,
+    0xEC, 0xC9, 0x1D, 0xF6, 0xEC, 0x2F, 0x49, 0x2E, 0xA7, 0xC2, 0x6B, 0x47, 0xE7, 0xA2, 0xF5, 0x11,
+    0x32, 0x8B, 0x61, 0xAF, 0xA4, 0x2F, 0x89, 0x12, 0xBD, 0x89, 0x61, 0xE2, 0xE9, 0x22, 0x6A, 0x4A,
+    0xAF, 0x53, 0x32, 0x55, 0x34, 0x60, 0x91, 0x9B, 0x19, 0x2F, 0xF5, 0x83, 0xBA, 0xC7, 0x10, 0x6E,
+    0xAC, 0x02, 0x84, 0xB5, 0xCA, 0xB6, 0xB4, 0x97, 0x27, 0x11, 0xC4, 0x80, 0x75, 0x5A, 0x91, 0xCA,
+    0xD8, 0x1E, 0x7D, 0x73, 0xF2, 0x1B, 0x43, 0x61, 0xDF, 0xDA, 0xBD, 0xB3, 0x3C, 0x1D, 0x7D, 0x21,
+    0xA0, 0xE5, 0xFB, 0x50, 0x17, 0xD3, 0x24, 0xAD, 0xDE, 0x5D, 0x80, 0xCB, 0x30, 0xE0, 0xDA, 0x88,
+    0x41, 0x02, 0x25, 0x0D, 0xA1, 0x15, 0x57, 0x54, 0xC1, 0x8E, 0x23, 0xDC, 0xE2, 0x05, 0x22, 0xE8,
+    0x1D, 0x7E, 0x95, 0x77, 0xF9, 0x98, 0x0F, 0x58, 0xA4, 0x7A, 0xC6, 0xBD, 0xA0, 0xCB, 0xC0, 0x60,
+    0xA2, 0x71, 0xE6, 0xCA, 0x9F, 0xD5, 0x31, 0xBA, 0xE0, 0x3A, 0x89, 0x27, 0x4D, 0x6E, 0x7B, 0x89,
+    0x3E, 0x19, 0xEF, 0x10, 0x14, 0xFE, 0x2E, 0x99, 0x51, 0xEF, 0xF3, 0x41, 0x38, 0xBD, 0x44, 0xC5,
+    0x55, 0xA8, 0x05, 0x32, 0xE1, 0x93, 0xEA, 0x08, 0x5E, 0xB9, 0x8B, 0xD3, 0xDB, 0x68, 0xAE, 0x35,
+    0x4F, 0x20, 0x9E, 0x3E, 0x80, 0xE1, 0xB6, 0xA4, 0x5D, 0x24, 0xF5, 0xAB, 0x09, 0x6A, 0x32, 0x4E,
+    0x8F, 0xA6, 0x53, 0xEE, 0x8C, 0x25, 0x68, 0x95, 0x0A, 0x86, 0x7E, 0x0D, 0x32, 0xAC, 0x86, 0xF9,
+    0x3B, 0xE9, 0x52, 0x20, 0xB9, 0xF9, 0xF6, 0x2E, 0x55, 0xF7, 0x1F, 0x6A, 0x2A, 0x8E, 0xF8, 0x8A,
+    0xA5, 0xDD, 0xF6, 0x00, 0xA1, 0xD4, 0x21, 0x62, 0x0B, 0xBF, 0xF5, 0x2E, 0xEF, 0x47, 0x9D, 0xCC,
+    0x70, 0xA9, 0x1E, 0xE5, 0xF0, 0x62, 0x31, 0x9E, 0x92, 0xB1, 0x80, 0xD5, 0x9D, 0x3C, 0x60, 0x90,
+    0x37, 0xA1, 0x41, 0x02, 0xEA, 0x47, 0x83, 0xB4, 0x9C, 0x4A, 0x0C, 0x27, 0xF9, 0xA8, 0xCD, 0xF5,
+    0x63, 0x2A, 0xF9, 0x8F, 0x30, 0x2A, 0x74, 0xD7, 0x86, 0x91, 0x66, 0xFE, 0xA9, 0x58, 0xD9, 0x5A,
+    0x61, 0x84, 0x1C, 0x4E, 0xD2, 0x99, 0x7B, 0xBE, 0x3E, 0x8E, 0x65, 0x42, 0xBF, 0x81, 0xBD, 0x6B,
+    0x83, 0x3A, 0x80, 0x0C, 0x7C, 0x0D, 0x97, 0x5C, 0x71, 0x6A, 0xEB, 0x45, 0x41, 0xED, 0xC0, 0x15,
+    0xDF, 0xC4, 0x64, 0x3D, 0x81, 0xCE, 0xB5, 0x93, 0x01, 0x99, 0x3A, 0xD8, 0x53, 0xA0, 0x07, 0xCC,
+    0x9C, 0x49, 0x1C, 0x21, 0xD3, 0xA4, 0x6D, 0x8F, 0x4C, 0xA7, 0x3D, 0x79, 0x81, 0x9A, 0x92, 0xEB,
+    0x28, 0x78, 0x33, 0x91, 0xD9, 0x1B, 0xC9, 0x38, 0x8C, 0x18, 0x8B, 0xD1, 0x03, 0x65, 0x7A, 0xB8,
+    0x04, 0x8D, 0x4D, 0x40, 0x5E, 0x40, 0xA5, 0x72, 0xDA, 0x1C, 0xE0, 0xBA, 0xA6, 0x3A, 0x01, 0xA9,
+    0x18, 0x84, 0xF9, 0x9B, 0x39, 0x57, 0x79, 0xD0, 0xC3, 0x86, 0x9F, 0xDC, 0x7A, 0xDA, 0xEB, 0xCB,
+    0x5D, 0xE9, 0x16, 0xCA, 0x92, 0xEE, 0xF2, 0x64, 0xC6, 0x5F, 0x9E, 0x3A, 0xDD, 0x8F, 0x30, 0xD9,
+    0xB9, 0xD7, 0x9F, 0xC9, 0xF3, 0x0F, 0xAD, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x24,
+    0x38, 0xD2, 0x14, 0xB3, 0x45, 0x0A, 0x44, 0x33, 0x34, 0x48, 0x54, 0x0C, 0x05, 0x45, 0x0A, 0xC2,
+    0x78, 0x93, 0xE2, 0x15, 0x14, 0x49, 0x93, 0x9A, 0x82, 0x5F, 0x48, 0x91, 0x22, 0x59, 0x7B, 0xB5,
+    0x42, 0x49, 0x0B, 0x3F, 0x00, 0x05, 0x1D, 0x08, 0x51, 0xA4, 0xCC, 0x3E, 0xCF, 0xEE, 0x2B, 0xB6,
+    0x48, 0x11, 0x87, 0x14, 0x94, 0x18, 0x10, 0x8A, 0x50, 0x8A, 0x9D, 0x90, 0x41, 0x4C, 0xF2, 0xC6,
+    0xBE, 0x9C, 0xF1, 0xDB, 0x97, 0x7C, 0x00, 0x78, 0x65, 0xAF, 0xDE, 0xD8, 0x73, 0xE6, 0xDE, 0x7B,
+    0xCE, 0x3D, 0x97, 0xA8, 0xA0, 0x9D, 0x82, 0x17, 0x51, 0x0F, 0xF6, 0x6F, 0x7E, 0xC8, 0x64, 0x97,
+    0xD3, 0xDA, 0x0B, 0x56, 0xB1, 0x21, 0x7B, 0xC4, 0x72, 0xA8, 0xA2, 0xE9, 0x47, 0xEA, 0x44, 0x52,
+    0x4E, 0x0D, 0x76, 0x37, 0xD1, 0x58, 0x79, 0xD3, 0x6A, 0xD7, 0x89, 0xB0, 0x9F, 0xB0, 0x92, 0x4C,
+    0x3B, 0x0A, 0x3E, 0x08, 0xCA, 0xD9, 0x9E, 0xB6, 0xD7, 0x39, 0x92, 0x41, 0xF7, 0x92, 0x45, 0x24,
+    0xE3, 0x26, 0x12, 0xC1, 0xB4, 0x34, 0xAA, 0x9E, 0xCC, 0x81, 0xA7, 0xEA, 0xD7, 0x40, 0x45, 0x7C,
+    0x40, 0x64, 0x2F, 0x13, 0xA9, 0x53, 0x22, 0xC1, 0xD8, 0xC1, 0x35, 0x16, 0x5A, 0x22, 0xED, 0xB0,
+    0xE8, 0xE8, 0x12, 0xFE, 0x6B, 0x76, 0x54, 0x31, 0xD6, 0x96, 0x5B, 0x50, 0x22, 0x13, 0x89, 0x24,
+    0xD6, 0x8B, 0x78, 0x0B, 0xDF, 0x63, 0x41, 0x0C, 0x78, 0xDC, 0x21, 0x2A, 0x78, 0xC2, 0xCD, 0x23,
+    0x35, 0x5F, 0x3F, 0x0C, 0x6A, 0x48, 0xF6, 0x38, 0xAA, 0xFD, 0x64, 0x77, 0x83, 0x5A, 0x79, 0xB3,
+    0x9B, 0x9A, 0xD2, 0x9B, 0x55, 0xB0, 0x22, 0xD8, 0x95, 0xE7, 0x82, 0x9B, 0xCE, 0x55, 0xCC, 0x03,
+    0xE0, 0xBF, 0x01, 0x1E, 0x8E, 0xA4, 0x04, 0x7C, 0x55, 0x53, 0xF9, 0xD4, 0x03, 0x17, 0x3F, 0xB6,
+    0x87, 0xEE, 0x94, 0x63, 0x99, 0x24, 0xCB, 0xF1, 0x7C, 0xF3, 0xD9, 0xF7, 0x64, 0x0F, 0x11, 0x21,
+    0x42, 0x50, 0xF8, 0x4A, 0xE2, 0x56, 0x61, 0xF3, 0xF5, 0x61, 0x22, 0x1B, 0xF8, 0x5B, 0x3B, 0x74,
+    0xC1, 0xB6, 0x67, 0x75, 0x40, 0x42, 0x26, 0x54, 0xBE, 0x89, 0x6A, 0x10, 0x41, 0xF5, 0xC2, 0x2B,
+    0x57, 0x79, 0xED, 0xE4, 0x60, 0x5B, 0xD5, 0xDB, 0x5A, 0xB9, 0x8E, 0xF4, 0x11, 0x93, 0xB9, 0xCB,
+    0xEF, 0xDB, 0x53, 0x9B, 0xF0, 0x17, 0xB4, 0xFF, 0xE0, 0x3E, 0x76, 0x86, 0x37, 0x77, 0x95, 0x0F,
+    0x6A, 0x33, 0x5C, 0xD3, 0x9B, 0x03, 0xAE, 0x47, 0x4A, 0x95, 0x17, 0xDE, 0x38, 0xDD, 0x4E, 0xB4,
+    0x57, 0x85, 0x62, 0x62, 0x27, 0x98, 0xA9, 0xF8, 0x2A, 0x47, 0xF5, 0xDB, 0x26, 0x1A, 0x24, 0x56,
+    0x8E, 0xB4, 0x0D, 0x82, 0x64, 0xC2, 0x86, 0x05, 0xEF, 0x66, 0x06, 0xFB, 0x65, 0xDE, 0x6E, 0xAF,
+    0xC4, 0x02, 0xBF, 0x46, 0xC2, 0x2F, 0x4B, 0xA8, 0x8A, 0x71, 0xEA, 0x08, 0x64, 0x56, 0x03, 0xCB,
+    0x58, 0x86, 0xEE, 0xEE, 0xE1, 0x87, 0xBC, 0x5E, 0x3F, 0x1A, 0x6D, 0xE4, 0xD5, 0x54, 0x81, 0xBC,
+    0x89, 0xFE, 0x1B, 0xDC, 0x47, 0x80, 0xFB, 0x25, 0xC3, 0x9D, 0x70, 0x86, 0xFB, 0x27, 0x57, 0xBC,
+    0xF0, 0x19, 0xF1, 0x41, 0x7E, 0x98, 0xF9, 0x91, 0xC1, 0x75, 0x5D, 0xD4, 0x10, 0x04, 0xAF, 0xC0,
+    0x4E, 0x90, 0xFD, 0x65, 0xE9, 0xE4, 0x35, 0x07, 0xC6, 0x87, 0x6A, 0x3D, 0x09, 0x54, 0x0F, 0x67,
+    0xDB, 0x22, 0xAA, 0xC7, 0x63, 0x09, 0xBE, 0xCD, 0x26, 0xC9, 0x1D, 0xDC, 0x5D, 0x4F, 0xEA, 0x04,
+    0x1A, 0x6A, 0x68, 0xA4, 0x12, 0x1F, 0x91, 0x1A, 0xF4, 0x17, 0x64, 0x6B, 0xE6, 0x36, 0x89, 0x89,
+    0x17, 0x28, 0xFE, 0xD2, 0xB4, 0x7B, 0x45, 0x1C, 0x8B, 0x28, 0x9F, 0xF8, 0x85, 0x6F, 0x14, 0x2B,
+    0xF6, 0x4D, 0x50, 0xD3, 0x2C, 0xBD, 0x0D, 0x8E, 0x09, 0xD4, 0x04, 0xA8, 0x95, 0x44, 0x96, 0x69,
+    0xAD, 0x38, 0xAA, 0xF5, 0xA4, 0x5C, 0xA3, 0x5B, 0xAB, 0xDB, 0x3D, 0x8D, 0x9C, 0x38, 0x08, 0x9E,
+    0xE9, 0x40, 0x98, 0x66, 0x22, 0xCB, 0xBD, 0xBE, 0x92, 0x04, 0x8E, 0x85, 0x68, 0xCB, 0xEF, 0x7C,
+    0xC1, 0x89, 0xDE, 0xEB, 0x90, 0xCB, 0xBE, 0x53, 0x2E, 0xA1, 0xA5, 0x78, 0x10, 0xDC, 0x9F, 0xA1,
+    0x9F, 0x87, 0x74, 0x0A, 0x46, 0xC7, 0x54, 0x1C, 0x45, 0xD4, 0x4F, 0x13, 0xD4, 0xB8, 0x8B, 0x58,
+    0x97, 0xE0, 0xF4, 0x15, 0x88, 0x95, 0x9C, 0x50, 0xC6, 0x57, 0xA9, 0x44, 0x7E, 0x78, 0x87, 0xE3,
+    0x24, 0x32, 0xE6, 0xCE, 0x99, 0xB6, 0x43, 0x5F, 0xD6, 0x59, 0xFB, 0x9B, 0xEB, 0x06, 0xE4, 0xC0,
+    0x50, 0xF0, 0x48, 0xF6, 0xAA, 0x2F, 0x23, 0x44, 0xD5, 0x2F, 0xC9, 0x1C, 0x07, 0xC4, 0xE3, 0xF0,
+    0x86, 0xCA, 0xE7, 0x91, 0xF4, 0xA7, 0x4F, 0x4C, 0xB4, 0x89, 0x1D, 0xFF, 0x94, 0xB6, 0x6A, 0x78,
+    0x9B, 0xE8, 0xF2, 0xDC, 0x36, 0x06, 0x9D, 0xD5, 0x53, 0xB1, 0x15, 0x2A, 0x90, 0x19, 0x81, 0x8C,
+    0x39, 0xE6, 0xFD, 0x68, 0x20, 0xD1, 0xAE, 0xB5, 0x91, 0x9A, 0x7A, 0xC7, 0xD2, 0x7D, 0xFB, 0x2C,
+    0x18, 0xEE, 0xE5, 0x56, 0x02, 0xA4, 0x16, 0x4E, 0xFD, 0x1E, 0x84, 0x4F, 0xB4, 0x73, 0x6E, 0xDB,
+    0x97, 0xDD, 0x00, 0x00, 0x4A, 0xB6, 0x86, 0x0C, 0xF6, 0xAA, 0x01, 0x08, 0xEA, 0x14, 0x99, 0xB7,
+    0xC5, 0x48, 0x35, 0x20, 0xD4, 0x2B, 0xF0, 0x35, 0xD2, 0x36, 0x81, 0x8B, 0xF3, 0x06, 0x0D, 0x44,
+    0x58, 0xC2, 0x3B, 0xFC, 0x43, 0xC9, 0xDC, 0x97, 0x78, 0x67, 0xEB, 0x5A, 0x78, 0xA6, 0xA6, 0x89,
+    0xD5, 0x69, 0xE7, 0xBA, 0xE3, 0xA4, 0x02, 0xF2, 0x2F, 0x92, 0xEE, 0xF5, 0x71, 0x2A, 0x13, 0x3A,
+    0xEB, 0x20, 0x88, 0xD0, 0x50, 0x23, 0xBD, 0x1C, 0xE6, 0x96, 0x35, 0xED, 0x5B, 0xE8, 0x90, 0x69,
+    0x24, 0x95, 0xB9, 0x6F, 0x37, 0xF0, 0x97, 0xD0, 0x8F, 0xF9, 0x2D, 0x78, 0x44, 0x92, 0xE5, 0xBC,
+    0x76, 0x9E, 0x4A, 0x1E, 0xC0, 0xA7, 0xBE, 0x12, 0x2F, 0xE0, 0x28, 0x09, 0xA2, 0x11, 0x5F, 0xAD,
+    0x43, 0x36, 0x9D, 0x86, 0x7E, 0xEC, 0x16, 0x3E, 0x73, 0x39, 0x6D, 0x65, 0x6E, 0x12, 0x0C, 0xA5,
+    0x7A, 0x79, 0x47, 0xF5, 0xE7, 0x74, 0x4B, 0xF6, 0x59, 0x6B, 0xB9, 0xB5, 0x37, 0x32, 0xCF, 0xB6,
+    0xBE, 0x65, 0x9F, 0x45, 0xC3, 0x5E, 0x9E, 0xE9, 0x26, 0x7F, 0x4C, 0x3C, 0x8A, 0x70, 0x1B, 0xAA,
+    0x11, 0x23, 0x5C, 0xA8, 0x9D, 0xD3, 0x0B, 0x17, 0x44, 0x34, 0x65, 0xB4, 0x3F, 0x67, 0x64, 0xC9,
+    0xDB, 0xEA, 0x39, 0xE9, 0x45, 0xCA, 0x01, 0xC2, 0x78, 0x9B, 0x01, 0x55, 0x06, 0x89, 0x94, 0x6D,
+    0x01, 0xE1, 0x26, 0x1C, 0x60, 0xEE, 0x29, 0xBE, 0xCA, 0xAE, 0x3B, 0x4B, 0x46, 0x2F, 0xDC, 0x04,
+    0x92, 0x53, 0x31, 0xF7, 0x5E, 0x41, 0x15, 0x44, 0x17, 0x73, 0xDD, 0x2C, 0x15, 0x89, 0x50, 0x06,
+    0x5B, 0x63, 0x1B, 0x8A, 0x60, 0xEE, 0x51, 0x16, 0xA7, 0x93, 0xAF, 0x55, 0x32, 0x97, 0x41, 0x6F,
+    0xBC, 0x40, 0xB5, 0x5B, 0xAA, 0x8C, 0xA7, 0x1C, 0x4C, 0x36, 0x16, 0x08, 0x55, 0xA1, 0x8E, 0xE3,
+    0xEC, 0xB8, 0x45, 0x9A, 0x65, 0x21, 0x66, 0x1E, 0x5E, 0xBF, 0xEE, 0xF3, 0xFA, 0x4D, 0xB8, 0x15,
+    0xFB, 0xCC, 0x70, 0xF9, 0x72, 0xD6, 0xFE, 0xF5, 0xEC, 0x47, 0x29, 0x9B, 0x2E, 0x1E, 0xE2, 0xAF,
+    0xEC, 0x53, 0xAB, 0xEC, 0x86, 0x07, 0xBE, 0x86, 0x3C, 0x18, 0xA6, 0x2F, 0xD1, 0x9E, 0x9F, 0xA0,
+    0x73, 0xE8, 0x0E, 0xE6, 0xC2, 0x4E, 0x56, 0x85, 0x0D, 0xE8, 0x5A, 0x3B, 0x48, 0x86, 0x43, 0x96,
+    0xDC, 0xD2, 0xEB, 0xD6, 0x45, 0x11, 0x6A, 0xC4, 0x8D, 0x28, 0x26, 0x9C, 0x9A, 0xCD, 0x03, 0xE1,
+    0x8C, 0x3B, 0xD0, 0x31, 0x43, 0x35, 0xBC, 0x4E, 0xEA, 0x8F, 0x65, 0x19, 0xE0, 0x31, 0xD5, 0xE3,
+    0x24, 0x07, 0xB3, 0xF0, 0x10, 0x83, 0x01, 0x1F, 0xD8, 0x61, 0xB7, 0xB9, 0x5E, 0x9C, 0x27, 0x03,
+    0x9A, 0x6B, 0x1E, 0x22, 0x90, 0x14, 0x75, 0x1C, 0xA0, 0x0E, 0x24, 0x57, 0xA0, 0x99, 0xBB, 0x5A,
+    0x3F, 0x62, 0xDA, 0x5B, 0xA7, 0x12, 0x03, 0x4D, 0x65, 0x8B, 0x76, 0x63, 0x81, 0x39, 0x26, 0x31,
+    0xC9, 0x6C, 0x3B, 0xBE, 0x8B, 0x01, 0x76, 0xE2, 0xD5, 0x64, 0x9C, 0x79, 0x33, 0xC2, 0xE8, 0xE6,
+    0x5C, 0x96, 0xAC, 0xCB, 0xBD, 0x4D, 0xFD, 0xAE, 0x9F, 0x85, 0xBC, 0xCB, 0xED, 0x64, 0xA3, 0x1D,
+    0xEC, 0xB5, 0x3F, 0xC5, 0x0B, 0x4F, 0xF6, 0x36, 0x55, 0xA7, 0x35, 0x75, 0x60, 0x05, 0xDD, 0x37,
+    0x1E, 0x92, 0x5E, 0xF9, 0x2F, 0x93, 0x1D, 0xCD, 0x11, 0xAF, 0x42, 0xD6, 0xE9, 0x2C, 0x3F, 0xA2,
+    0x8F, 0x69, 0xAE, 0x71, 0x2E, 0x70, 0x89, 0x8A, 0x15, 0x6E, 0x5B, 0x01, 0x4C, 0x89, 0xE7, 0xB0,
+    0x85, 0xD6, 0x66, 0x77, 0x17, 0x3E, 0x0F, 0x89, 0xEC, 0xB8, 0x50, 0xD4, 0x6C, 0xF4, 0x98, 0x11,
+    0x4B, 0x9D, 0x3E, 0x9F, 0x5E, 0xF0, 0x23, 0x56, 0x49, 0x7B, 0xD3, 0xD2, 0xFF, 0x78, 0xFD, 0x0B,
+    0x6D, 0x55, 0xBF, 0x8F, 0x16, 0x45, 0x18, 0x7E, 0x77, 0xE6, 0x8E, 0x21, 0x6E, 0xCC, 0x60, 0x02,
+    0x16, 0x62, 0x98, 0xC6, 0x46, 0x85, 0x6C, 0x7B, 0x05, 0x30, 0x0B, 0x14, 0xB4, 0x16, 0x7C, 0x95,
+    0x05, 0x8D, 0x85, 0x31, 0x26, 0x36, 0x76, 0xC2, 0xED, 0xA2, 0xC5, 0x15, 0x14, 0xDE, 0x7F, 0x00,
+    0x85, 0x89, 0x09, 0x25, 0xA1, 0x40, 0x73, 0xF7, 0xED, 0x02, 0x05, 0x31, 0x16, 0x2E, 0xB9, 0x50,
+    0x99, 0xE8, 0xAA, 0x89, 0x0D, 0x85, 0x83, 0x2C, 0x71, 0xE1, 0x66, 0xF7, 0xF5, 0x79, 0x77, 0xEF,
+    0x20, 0x1A, 0xBE, 0x64, 0xE6, 0xDB, 0x9D, 0xDD, 0xF7, 0xD7, 0xF3, 0x3C, 0xEF, 0xBB, 0x44, 0x94,
+    0x10, 0x9D, 0xD4, 0x25, 0x65, 0xAA, 0x21, 0xB3, 0x1B, 0x88, 0xAA, 0x86, 0xF6, 0x7E, 0x39, 0x55,
+    0x67, 0x06, 0xAA, 0x82, 0x2F, 0x55, 0xB4, 0x2D, 0xF9, 0xB3, 0x3D, 0xD9, 0x66, 0x20, 0xD5, 0x7B,
+    0xA2, 0x75, 0x97, 0x93, 0xBB, 0x5A, 0x93, 0x7E, 0x82, 0xD7, 0x47, 0x98, 0x79, 0x2C, 0xDB, 0x11,
+    0xE9, 0x1E, 0x2E, 0x23, 0xAC, 0x23, 0xE9, 0x2B, 0x91, 0x12, 0xC6, 0x75, 0x81, 0xB3, 0xB4, 0x9D,
+    0x5D, 0xC2, 0xBF, 0xBB, 0xCF, 0xE5, 0x48, 0x83, 0xEE, 0x74, 0xB0, 0xB5, 0xAB, 0x0B, 0x5A, 0xEA,
+    0x5E, 0x77, 0xB6, 0xB1, 0x75, 0x45, 0x85, 0x89, 0xAA, 0x2F, 0x1E, 0x7F, 0xBD, 0xFB, 0x13, 0xFB,
+    0xE8, 0x43, 0xF1, 0xC3, 0x92, 0xE8, 0x16, 0xBC, 0x22, 0x8A, 0xCD, 0x27, 0xC7, 0x07, 0xE0, 0x83,
+    0xDE, 0xBB, 0x81, 0xE4, 0x18, 0x29, 0x74, 0xB4, 0x7A, 0xF1, 0xE9, 0x07, 0x9E, 0x39, 0x62, 0xF5,
+    0x97, 0xB2, 0xBA, 0xC3, 0x0A, 0xEF, 0xF8, 0x72, 0x93, 0x3C, 0x5E, 0x2C, 0xC6, 0x12, 0xEF, 0x75,
+    0xC4, 0x47, 0x07, 0x1A, 0x13, 0x04, 0xC5, 0x1E, 0x69, 0x54, 0x51, 0x0D, 0x3A, 0x1E, 0xED, 0x33,
+    0xE6, 0xB6, 0xE0, 0x71, 0x2E, 0xF7, 0x10, 0x90, 0x28, 0x1A, 0x26, 0xCD, 0xD7, 0x06, 0xD4, 0xB4,
+    0xDB, 0xE1, 0xCA, 0xD6, 0x28, 0xCA, 0xAF, 0x50, 0x71, 0x85, 0x61, 0x94, 0xF2, 0x60, 0x5B, 0x9F,
+    0xF4, 0x3E, 0x8F, 0xFA, 0x71, 0xD4, 0xC1, 0x6D, 0x04, 0xFB, 0x20, 0x66, 0x75, 0xC6, 0x80, 0x25,
+    0xEB, 0xF7, 0x71, 0xFB, 0x64, 0x93, 0x88, 0xB9, 0xA1, 0x82, 0x39, 0x77, 0x9D, 0x8D, 0x26, 0x92,
+    0x87, 0x5F, 0x35, 0xBA, 0x96, 0xDC, 0xEF, 0x03, 0x25, 0x23, 0x72, 0xE5, 0x3F, 0xB0, 0x46, 0xFF,
+    0x70, 0x51, 0xEC, 0x00, 0xA9, 0xE8, 0x6B, 0x2A, 0xBE, 0x8A, 0x64, 0x43, 0x16, 0xF4, 0x40, 0xFC,
+    0x27, 0xE7, 0x46, 0x5C, 0xA4, 0xBC, 0xCF, 0x46, 0x92, 0xE3, 0x86, 0x1C, 0x07, 0xF7, 0xDB, 0x68,
+    0x9B, 0xEC, 0x7E, 0x30, 0x4F, 0xC6, 0x1B, 0x51, 0x5C, 0x2C, 0x8A, 0x8B, 0xB5, 0xBB, 0x17, 0x6C,
+    0xC3, 0x2E, 0x38, 0x6E, 0x93, 0xD9, 0xE4, 0xC8, 0x82, 0xD4, 0x75, 0xCF, 0xA5, 0x8D, 0xD9, 0x40,
+    0x3E, 0xA6, 0x81, 0xAA, 0x5B, 0xA6, 0x13, 0x56, 0x3A, 0x85, 0xCA, 0x7A, 0x1D, 0xB0, 0xA5, 0x0D,
+    0x81, 0xDA, 0x1A, 0xB8, 0x3A, 0x01, 0xD7, 0x0B, 0x6D, 0x97, 0xB1, 0x0D, 0x42, 0xE0, 0x12, 0x6C,
+    0x82, 0x7D, 0x12, 0x54, 0xB0, 0x21, 0x43, 0x6C, 0xF4, 0x52, 0x1C, 0x2B, 0xA8, 0x78, 0xF4, 0x51,
+    0xB3, 0x8E, 0xE9, 0x73, 0x15, 0x1D, 0x54, 0xE2, 0xE1, 0x64, 0x0B, 0xAB, 0x43, 0x8D, 0x2D, 0xB8,
+    0x87, 0x67, 0x90, 0x44, 0x2C, 0x2E, 0xB1, 0x5E, 0x20, 0x34, 0x09, 0x81, 0x3E, 0xD2, 0xD8, 0x75,
+    0x7B, 0x02, 0x97, 0xF6, 0x91, 0xC8, 0x23, 0x9B, 0x98, 0x58, 0xCD, 0xF7, 0x5F, 0x42, 0x0D, 0x8B,
+    0x0B, 0x09, 0x40, 0xE7, 0xA0, 0xB8, 0xC1, 0x53, 0x15, 0xC9, 0x35, 0x00, 0x49, 0x3C, 0x7A, 0x94,
+    0x46, 0xC9, 0x90, 0x70, 0x4B, 0x29, 0xEA, 0x86, 0x82, 0xEF, 0x3E, 0x47, 0x10, 0xCE, 0xAE, 0xA2,
+    0xB2, 0xDD, 0x0E, 0xE9, 0x3A, 0xCE, 0x47, 0xA9, 0xC0, 0x08, 0x93, 0x94, 0x4D, 0x86, 0x15, 0xAA,
+    0x29, 0x35, 0xDC, 0x70, 0xC3, 0x0C, 0x69, 0x18, 0xD1, 0x27, 0x91, 0x99, 0xD4, 0x99, 0x4D, 0x91,
+    0xB7, 0x64, 0xD3, 0xD3, 0x81, 0x7D, 0x99, 0x30, 0x95, 0xF4, 0xB9, 0xC1, 0xF1, 0x49, 0xB2, 0x00,
+    0xD8, 0x4E, 0x56, 0xB4, 0x02, 0x5D, 0x0F, 0x49, 0x2C, 0x7A, 0xDB, 0xDA, 0xC6, 0xE7, 0x9E, 0x62,
+    0x12, 0x4D, 0x48, 0x5B, 0x5F, 0xFA, 0x7C, 0x20, 0x80, 0x6E, 0x42, 0x51, 0x67, 0x1B, 0xBC, 0xC6,
+    0x5B, 0xE0, 0xFB, 0x1E, 0x6F, 0xC4, 0x14, 0x86, 0x2A, 0xCC, 0x9E, 0x6F, 0x23, 0x0C, 0x40, 0x3D,
+    0x48, 0xA8, 0x12, 0x40, 0x49, 0xAE, 0x40, 0x28, 0x03, 0x68, 0xC5, 0x43, 0x32, 0x72, 0x5F, 0x48,
+    0xBF, 0x08, 0x0B, 0x28, 0x8F, 0x39, 0xD0, 0x90, 0x22, 0x80, 0x1A, 0x54, 0x4C, 0x20, 0xDF, 0x24,
+    0x82, 0xC5, 0x68, 0x7A, 0xD7, 0x41, 0x68, 0x4D, 0xC5, 0xCF, 0x66, 0x9D, 0xDC, 0x42, 0xC5, 0xAA,
+    0x2A, 0x69, 0x9B, 0x34, 0x50, 0x1B, 0x0F, 0xF0, 0x75, 0xDD, 0x11, 0x38, 0x5E, 0x3F, 0x8C, 0x3B,
+    0xBB, 0x3B, 0xFA, 0x64, 0xE8, 0xF5, 0x3F, 0xAD, 0xBB, 0x76, 0x07, 0x2D, 0xD3, 0xF8, 0x99, 0x93,
+    0xB7, 0xBE, 0x97, 0x7E, 0x1A, 0x45, 0xB2, 0xCD, 0x4A, 0x25, 0x82, 0x45, 0x2F, 0xDA, 0xD6, 0xD5,
+    0xA6, 0x3B, 0x1F, 0x54, 0xBC, 0xD9, 0x53, 0xE5, 0x70, 0xF8, 0x33, 0x14, 0x0A, 0xC0, 0xCC, 0x78,
+    0x0D, 0x54, 0xA8, 0x7A, 0x22, 0xD6, 0x97, 0x44, 0x10, 0x36, 0x4C, 0x6B, 0xCA, 0xB8, 0x9D, 0x50,
+    0xC9, 0x15, 0xA7, 0xBD, 0xE1, 0xCF, 0x60, 0xB2, 0x84, 0xFA, 0xDA, 0x11, 0xFE, 0xE0, 0x1C, 0x98,
+    0x54, 0x50, 0xE0, 0xF0, 0x46, 0xA4, 0x78, 0xB3, 0x4B, 0xE2, 0x17, 0x41, 0x0D, 0xBE, 0xD1, 0x68,
+    0x13, 0xBD, 0xCB, 0x04, 0xE0, 0x72, 0x13, 0x74, 0x29, 0x93, 0x02, 0x7D, 0x0D, 0x87, 0x68, 0xA5,
+    0x1B, 0x53, 0x7A, 0x26, 0x9F, 0x47, 0x40, 0xD2, 0x25, 0x8B, 0x45, 0x4C, 0xA0, 0x7A, 0x84, 0xE2,
+    0x5C, 0x09, 0x0B, 0x2F, 0x72, 0xC0, 0x73, 0xA8, 0x9C, 0x5E, 0x79, 0xA8, 0xE5, 0x50, 0xD4, 0x55,
+    0x94, 0x40, 0x9A, 0x67, 0x44, 0x45, 0x6B, 0x33, 0xF5, 0x78, 0x7A, 0x1A, 0xFD, 0x86, 0x4C, 0xE8,
+    0xC3, 0x30, 0x79, 0xC0, 0xD8, 0xC1, 0xFC, 0xB0, 0x0D, 0x40, 0x9C, 0xA6, 0xCE, 0x92, 0xD2, 0x2A,
+    0xD7, 0x30, 0xAA, 0xCA, 0x59, 0x0E, 0x8B, 0xC5, 0x42, 0xD0, 0xAA, 0x53, 0xE1, 0x45, 0xAA, 0xF2,
+    0xF5, 0x69, 0x20, 0x66, 0x73, 0xD3, 0xA9, 0x29, 0xB1, 0x55, 0xBE, 0x00, 0x12, 0x79, 0x06, 0x07,
+    0x12, 0xFC, 0x5F, 0x62, 0xFF, 0x41, 0x6C, 0x15, 0xBD, 0x7D, 0x85, 0xF9, 0xEA, 0xE6, 0x72, 0x45,
+    0xF5, 0xAF, 0xB9, 0x1A, 0x2D, 0xCB, 0x25, 0x00, 0x1F, 0xD6, 0x4C, 0x30, 0xD9, 0x83, 0x6D, 0x8F,
+    0x31, 0xF5, 0xEC, 0x15, 0x61, 0x93, 0x1E, 0x61, 0x2F, 0x23, 0xEC, 0xB1, 0xBD, 0x08, 0x87, 0xA4,
+    0x32, 0x8C, 0x6A, 0x00, 0x64, 0xDB, 0x02, 0xEC, 0x99, 0x1E, 0x61, 0x47, 0x84, 0x85, 0x24, 0x4B,
+    0x10, 0xDA, 0x1A, 0xA8, 0x25, 0x89, 0x19, 0xD7, 0xE3, 0x5E, 0x3B, 0x23, 0x9B, 0x53, 0x85, 0x34,
+    0x4B, 0x49, 0x8A, 0xE7, 0xD6, 0x73, 0xCC, 0xE7, 0x11, 0xC3, 0x9F, 0xC1, 0x7C, 0x5E, 0xD3, 0x61,
+    0x05, 0x61, 0x64, 0xDA, 0x7A, 0xEE, 0x6C, 0xCD, 0x26, 0xB8, 0xBB, 0x98, 0x1E, 0x90, 0xB7, 0x17,
+    0x7B, 0x57, 0x52, 0xDA, 0x1C, 0x04, 0x77, 0x8F, 0xA0, 0xB6, 0x40, 0x19, 0x66, 0xDF, 0xBB, 0x74,
+    0xE4, 0x42, 0xF2, 0x0D, 0x2A, 0x60, 0x91, 0x3B, 0xD7, 0x45, 0x9B, 0x45, 0xFA, 0xB6, 0x75, 0x65,
+    0xF1, 0x31, 0xB4, 0x9F, 0x95, 0x22, 0xB9, 0xCE, 0x9F, 0x93, 0xC9, 0xD2, 0x7B, 0x23, 0x63, 0x65,
+    0xAB, 0xB0, 0xF9, 0x24, 0x73, 0x81, 0x07, 0xFC, 0xC8, 0x9F, 0xE9, 0x06, 0x99, 0xE0, 0xB6, 0xC5,
+    0x80, 0x45, 0x96, 0x77, 0x64, 0x4E, 0x11, 0x9F, 0x45, 0xAB, 0x91, 0x1E, 0x75, 0x87, 0x7A, 0x2D,
+    0xBE, 0x1A, 0x20, 0xB6, 0x08, 0xD9, 0xA8, 0x18, 0xCC, 0xFA, 0x91, 0xAA, 0x7A, 0x2E, 0x60, 0x26,
+    0xC9, 0xCD, 0xE5, 0x64, 0x33, 0x63, 0x27, 0xE6, 0xBF, 0xE3, 0x2F, 0x3A, 0xFA, 0x30, 0x46, 0x7E,
+    0x6E, 0xA2, 0xA9, 0x8B, 0xBA, 0x8A, 0xDE, 0xF0, 0xB9, 0xBF, 0x42, 0xEF, 0x3F, 0x7D, 0xDD, 0xFE,
+    0xB8, 0x03, 0x4E, 0xB2, 0x42, 0xCC, 0xAA, 0x01, 0xC9, 0x6A, 0x99, 0xC4, 0x64, 0x7F, 0x95, 0xAC,
+    0x2E, 0x55, 0x18, 0x0F, 0x7A, 0xE7, 0xEF, 0xFE, 0xF8, 0xB1, 0xA5, 0xDD, 0xE0, 0xC0, 0xE1, 0x94,
+    0xE5, 0x2F, 0xC7, 0x24, 0xB8, 0x5F, 0x26, 0x9F, 0xB7, 0x65, 0x93, 0x06, 0x87, 0x81, 0x24, 0x91,
+    0x6C, 0x4F, 0xFA, 0x85, 0xFD, 0x81, 0xEF, 0xC4, 0x91, 0x60, 0x4B, 0x5B, 0x3A, 0xAA, 0x16, 0xC3,
+    0x41, 0x7A, 0x5D, 0x06, 0x23, 0x4A, 0x92, 0xD1, 0x27, 0x1D, 0x8F, 0xEF, 0x14, 0xA5, 0xBD, 0xE8,
+    0x63, 0x0D, 0x1F, 0x84, 0xA0, 0xA3, 0x7D, 0x5A, 0x34, 0x19, 0x0F, 0x13, 0x3F, 0x24, 0x1C, 0xB7,
+    0xA4, 0x2E, 0xE6, 0xD3, 0x00, 0xF2, 0x7B, 0x52, 0x4C, 0x64, 0x70, 0x68, 0x1E, 0x4C, 0xB3, 0x54,
+    0xB4, 0x2E, 0x6A, 0x7E, 0x3F, 0x00, 0x15, 0x7A, 0x13, 0xEF, 0xC4, 0xB7, 0xC1, 0x93, 0xEE, 0x3D,
+    0x07, 0x0B, 0x72, 0x4F, 0xE2, 0x5B, 0x4F, 0x76, 0x0B, 0xC8, 0x91, 0xDA, 0x14, 0xD3, 0x7F, 0x01,
+    0x9D, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0xF6, 0xE4, 0x18, 0xC0, 0x41, 0x73, 0x0D, 0x1D,
+    0x68, 0xFA, 0x48, 0x30, 0xFF, 0x40, 0x72, 0xE3, 0xD3, 0x15, 0x29, 0x43, 0xC1, 0x96, 0x28, 0x2D,
+    0x82, 0x48, 0xB4, 0x14, 0xC9, 0x8D, 0x21, 0x25, 0x05, 0x42, 0x14, 0x14, 0x34, 0x14, 0x29, 0x10,
+    0x4D, 0x28, 0x28, 0x28, 0x2E, 0xE7, 0x09, 0xA1, 0x4B, 0x81, 0x49, 0x3A, 0x4E, 0x48, 0x0E, 0x08,
+    0xA1, 0x48, 0x48, 0x19, 0x29, 0x8E, 0x98, 0xD3, 0x8D, 0xFD, 0xF8, 0x66, 0x76, 0x2F, 0x89, 0x10,
+    0x15, 0xD6, 0xAE, 0xBD, 0x5A, 0x7B, 0xDE, 0x7C, 0xBF, 0xDE, 0x33, 0xAD, 0xDE, 0xA6, 0x1B, 0x15,
+    0xCF, 0xCD, 0x4C, 0xFD, 0x64, 0x12, 0x19, 0xEF, 0xDE, 0x25, 0xEB, 0x23, 0x91, 0xFD, 0x38, 0x10,
+    0xB9, 0x8B, 0x03, 0x51, 0xAF, 0x3A, 0x9C, 0x98, 0x88, 0x98, 0x5B, 0xA2, 0xC5, 0x78, 0xAA, 0x66,
+    0xED, 0xA9, 0x4E, 0x6A, 0x24, 0x91, 0x9A, 0x40, 0x22, 0x8A, 0x44, 0x32, 0xD6, 0x33, 0x39, 0x26,
+    0x6E, 0xF1, 0xAC, 0xC3, 0x3A, 0x52, 0x3E, 0x9F, 0xB0, 0x98, 0x34, 0x9D, 0x9E, 0x5E, 0xA7, 0xF5,
+    0xB1, 0x4D, 0xBB, 0xDC, 0x2D, 0x36, 0xDA, 0xD1, 0x5E, 0x7A, 0x28, 0x1E, 0x07, 0xB2, 0x57, 0x49,
+    0x3E, 0x6A, 0xA9, 0x8F, 0xA4, 0xD8, 0xD3, 0x7C, 0x8B, 0xF4, 0x9D, 0xF0, 0x59, 0xB2, 0x8B, 0xB9,
+    0xCD, 0xF7, 0x27, 0xC0, 0x23, 0x81, 0x92, 0x3B, 0xE5, 0x52, 0x25, 0xA2, 0x37, 0x89, 0x00, 0xFD,
+    0x5C, 0xDE, 0xD0, 0x0D, 0x0D, 0xB7, 0x6E, 0xA2, 0x9E, 0xEC, 0x15, 0xB2, 0x9D, 0xC5, 0x9E, 0xBF,
+    0x18, 0x22, 0xF9, 0xF8, 0xD3, 0x16, 0x18, 0x8F, 0x7C, 0x06, 0x8F, 0x93, 0xE5, 0x09, 0x77, 0x8E,
+    0x5C, 0xB9, 0x33, 0xE0, 0xCE, 0x6F, 0x28, 0xB3, 0x6C, 0xBB, 0x96, 0x6C, 0xAB, 0x02, 0xE9, 0xA1,
+    0x5E, 0x72, 0x35, 0x3B, 0x18, 0xF6, 0x32, 0xD2, 0xE9, 0xB1, 0xAD, 0x27, 0x9A, 0x6D, 0x14, 0xB3,
+    0x98, 0x9A, 0xBF, 0xC4, 0x13, 0x4D, 0xE2, 0xEF, 0xF3, 0x24, 0x4F, 0xBE, 0xA3, 0x86, 0x01, 0xF5,
+    0xD7, 0x03, 0x7C, 0xAF, 0x91, 0xFE, 0xD1, 0x9E, 0xD5, 0xDE, 0x26, 0xD3, 0xE9, 0x88, 0x6A, 0x63,
+    0x59, 0x09, 0x7C, 0x5F, 0x43, 0x5A, 0xB9, 0x40, 0x5A, 0x35, 0x43, 0x5A, 0x7B, 0xA5, 0x72, 0xC3,
+    0x01, 0x49, 0x7E, 0x02, 0x24, 0x6E, 0x0F, 0x4F, 0xF5, 0x8D, 0x7F, 0x5E, 0xDA, 0xD9, 0x74, 0xFF,
+    0x21, 0x6D, 0xFC, 0x97, 0xB4, 0xDD, 0x53, 0x6C, 0xCE, 0x93, 0x06, 0x89, 0xCB, 0x28, 0x02, 0xC0,
+    0xBA, 0xDB, 0xB6, 0xAC, 0xEE, 0xF5, 0x9F, 0xCF, 0x22, 0x2C, 0x7E, 0x7F, 0x87, 0x9A, 0xA3, 0x8E,
+    0x6E, 0x05, 0xE8, 0xD9, 0xD2, 0x12, 0x49, 0xFF, 0xE4, 0xEB, 0x74, 0x78, 0xD6, 0x5E, 0xE7, 0x3B,
+    0x93, 0x89, 0x8E, 0xE6, 0x5C, 0x61, 0x6B, 0xB5, 0xA2, 0x73, 0x0D, 0xF3, 0xE0, 0x7E, 0xCF, 0xA7,
+    0x29, 0x66, 0x94, 0xD7, 0xD4, 0x68, 0x49, 0x89, 0x68, 0xDA, 0x6A, 0x77, 0x56, 0xED, 0x26, 0x01,
+    0x36, 0x8B, 0xA8, 0xB2, 0x88, 0x62, 0x3A, 0x24, 0x98, 0xA0, 0x33, 0x76, 0x91, 0xA3, 0xE2, 0x7B,
+    0xDC, 0x19, 0x01, 0x59, 0x42, 0x27, 0xD2, 0xEC, 0xDD, 0xA0, 0x38, 0x9C, 0x8A, 0x58, 0xB5, 0x74,
+    0x06, 0x9E, 0x2E, 0x96, 0xAF, 0xF3, 0x79, 0x7D, 0xE9, 0xE1, 0x05, 0x6B, 0xE8, 0x0D, 0xD8, 0x4D,
+    0xFB, 0xA8, 0x05, 0xBF, 0xA9, 0x07, 0x87, 0x79, 0x9F, 0x28, 0xD9, 0x97, 0xAA, 0x64, 0xE6, 0x3A,
+    0xE9, 0x04, 0xB1, 0x4F, 0x45, 0xDC, 0x5A, 0xBD, 0xA5, 0x79, 0xE0, 0xAC, 0x62, 0xC3, 0x5D, 0x9D,
+    0xE0, 0x14, 0x76, 0xC4, 0x15, 0x5B, 0x5B, 0x4F, 0xAE, 0xC5, 0xB5, 0x99, 0x70, 0x85, 0x90, 0x9C,
+    0xD9, 0x32, 0xF4, 0x5C, 0x56, 0x97, 0xB3, 0xA5, 0xB4, 0xD0, 0xF3, 0x0B, 0x52, 0x59, 0xD0, 0xE1,
+    0xEA, 0x78, 0x8F, 0x53, 0xC3, 0xC1, 0x65, 0x52, 0x54, 0x17, 0xA4, 0xA6, 0xCD, 0x3F, 0x43, 0xFE,
+    0x79, 0x21, 0x9F, 0x84, 0x7F, 0x9A, 0x55, 0xD2, 0x51, 0x04, 0x9B, 0x64, 0x10, 0xB1, 0x09, 0x62,
+    0x52, 0xA3, 0x08, 0x6A, 0x90, 0xCC, 0x1E, 0xD2, 0x79, 0xF5, 0x87, 0xEB, 0xD4, 0x60, 0x5B, 0x04,
+    0xE0, 0x35, 0xED, 0x1D, 0x42, 0xE0, 0x10, 0x02, 0xFB, 0x21, 0x56, 0x7E, 0x8F, 0x2F, 0xC8, 0x65,
+    0x77, 0x24, 0x0A, 0xCB, 0xAE, 0xF0, 0x59, 0xB5, 0x99, 0x10, 0xA7, 0xC2, 0x88, 0x7D, 0x41, 0x98,
+    0x0A, 0x44, 0xD5, 0x15, 0x52, 0x53, 0x61, 0x75, 0x66, 0x43, 0x6B, 0xCD, 0x6B, 0x43, 0x6C, 0xCD,
+    0x6C, 0x4D, 0x6D, 0xC3, 0x6D, 0x4D, 0x6E, 0xC3, 0x6E, 0x4D, 0xAF, 0xF0, 0x9B, 0xA8, 0x10, 0x6C,
+    0x0B, 0x01, 0x72, 0xA3, 0xE2, 0xFB, 0x70, 0x06, 0x46, 0xD4, 0xC9, 0x80, 0xC3, 0x83, 0xA8, 0xBC,
+    0xBD, 0xD4, 0x39, 0xE0, 0xA8, 0x8B, 0x70, 0xA0, 0x81, 0x56, 0x98, 0xE1, 0xAC, 0x08, 0xAD, 0x0C,
+    0x9A, 0x09, 0x4C, 0x10, 0x7E, 0xCA, 0x25, 0xD6, 0x66, 0xE0, 0xC0, 0xDE, 0x00, 0x12, 0x0B, 0xAA,
+    0x35, 0x04, 0x98, 0x8F, 0x9D, 0xD1, 0x42, 0xD9, 0x91, 0x25, 0x6F, 0x55, 0x3A, 0xA0, 0x09, 0xD5,
+    0x8C, 0x8D, 0x7B, 0x32, 0xB9, 0x51, 0x82, 0xC8, 0x7B, 0x2C, 0x64, 0x3F, 0xE2, 0x4E, 0x0F, 0x72,
+    0x12, 0x09, 0x2B, 0x5D, 0x8B, 0xB8, 0xF9, 0x26, 0xD4, 0x09, 0x2B, 0x39, 0x0F, 0x9F, 0x4E, 0x8D,
+    0x75, 0x72, 0x8B, 0xE4, 0xC1, 0x7E, 0xC2, 0x23, 0x27, 0x39, 0x95, 0x8D, 0xFB, 0x62, 0x83, 0x29,
+    0xF3, 0xE4, 0xCB, 0xF2, 0x17, 0x97, 0xF8, 0x36, 0xCB, 0xB3, 0x3E, 0xAD, 0x80, 0x6C, 0xB2, 0xB0,
+    0xFA, 0x98, 0xD1, 0x3B, 0x27, 0x8F, 0x70, 0xE2, 0xD2, 0x45, 0x6A, 0x40, 0x2E, 0x35, 0x87, 0x26,
+    0x18, 0x46, 0x5F, 0x99, 0xDB, 0x33, 0xDC, 0xEA, 0x7A, 0xD8, 0xD5, 0x3A, 0xF8, 0x45, 0xD6, 0x74,
+    0x3D, 0x39, 0xDB, 0x2E, 0xB4, 0x9F, 0x0B, 0x95, 0xC2, 0x90, 0x70, 0x4B, 0x60, 0x23, 0x7D, 0x73,
+    0xC8, 0x84, 0x21, 0x40, 0x49, 0xF3, 0x7B, 0x39, 0x21, 0x8C, 0xBF, 0xE4, 0x52, 0xDD, 0xA0, 0x26,
+    0x01, 0xA7, 0x8C, 0xCD, 0x49, 0x12, 0x90, 0xCC, 0xEE, 0xE6, 0x11, 0x31, 0xF6, 0x04, 0x32, 0x16,
+    0x65, 0x67, 0x6C, 0xE5, 0x2D, 0x02, 0x33, 0x6A, 0x48, 0x1E, 0xD1, 0x53, 0xDE, 0xC9, 0xA0, 0x82,
+    0xBA, 0x33, 0x55, 0x2C, 0xE0, 0x8E, 0x3D, 0xEE, 0xA7, 0x17, 0x21, 0x0B, 0x6C, 0xD5, 0x7C, 0xF3,
+    0x94, 0xC9, 0x56, 0x5B, 0xFA, 0xBA, 0x9E, 0x5F, 0xE8, 0xE4, 0xE8, 0x26, 0xE5, 0x8F, 0x93, 0xD9,
+    0x0B, 0x07, 0x56, 0x0C, 0x07, 0x56, 0x0E, 0xC9, 0x4A, 0x1F, 0xAD, 0xBC, 0x17, 0xEC, 0xDE, 0x9F,
+    0x83, 0xF9, 0x81, 0x3B, 0xA4, 0xE2, 0x9D, 0x9A, 0x1F, 0xE5, 0x90, 0x61, 0xE1, 0xFB, 0x5F, 0x65,
+    0x2F, 0x7D, 0xD6, 0x5A, 0x2C, 0x00, 0x32, 0xD3, 0x0E, 0x26, 0x87, 0x22, 0x2E, 0xAE, 0x50, 0x09,
+    0x48, 0x31, 0x2A, 0x3F, 0xCF, 0xB4, 0xF9, 0x23, 0xD2, 0x2B, 0x35, 0x5C, 0xE9, 0x2C, 0x96, 0x22,
+    0xD4, 0x03, 0x1C, 0x43, 0xBF, 0x9F, 0xCF, 0x62, 0x63, 0xCD, 0x17, 0x39, 0x54, 0x63, 0x6E, 0xF0,
+    0x53, 0xA9, 0x5B, 0x32, 0xB0, 0x2B, 0x89, 0xE3, 0x03, 0x35, 0x6E, 0x63, 0x0A, 0x98, 0x9C, 0x9B,
+    0xFC, 0xC9, 0xB3, 0xB4, 0xFB, 0xD6, 0x32, 0x84, 0x1E, 0xB2, 0x35, 0x21, 0x7F, 0x76, 0x30, 0xDB,
+    0x47, 0x7A, 0xB9, 0xCD, 0xB3, 0x66, 0x85, 0xBC, 0x23, 0x85, 0xCC, 0x53, 0xD4, 0xC3, 0xC1, 0x35,
+    0x38, 0xA2, 0xE0, 0xCF, 0x6E, 0xBB, 0x54, 0x65, 0x31, 0x99, 0x21, 0xE7, 0x66, 0x83, 0x6F, 0xD9,
+    0x80, 0x36, 0xCF, 0x81, 0xC6, 0x58, 0x41, 0xAA, 0xF3, 0xDD, 0xC3, 0x4D, 0xC7, 0xE6, 0x09, 0x9A,
+    0x5F, 0x0D, 0x14, 0x4E, 0xE1, 0x55, 0xC8, 0x02, 0x5F, 0x8C, 0x7A, 0xB4, 0x4F, 0xF8, 0x2E, 0x06,
+    0xFA, 0xE1, 0x72, 0x82, 0xF4, 0x29, 0x8C, 0x3C, 0x7B, 0x9B, 0x9B, 0x51, 0x46, 0x33, 0xE0, 0x6D,
+    0x87, 0x7D, 0x3D, 0x3C, 0xD9, 0x4D, 0x34, 0xCB, 0x80, 0xB9, 0xED, 0x7B, 0x31, 0xFD, 0x8C, 0x78,
+    0x58, 0x0C, 0xE1, 0x59, 0x60, 0x46, 0xA2, 0x3B, 0xAE, 0xE6, 0x72, 0xB2, 0x8C, 0x81, 0xF2, 0xB3,
+    0x79, 0x36, 0x2C, 0x2E, 0xD0, 0xAB, 0xAB, 0x6A, 0x75, 0x91, 0x03, 0x27, 0x1B, 0x31, 0xE2, 0xB1,
+    0x4F, 0xDB, 0x04, 0x0C, 0x2D, 0xDB, 0xE6, 0x41, 0x83, 0x97, 0x90, 0xBE, 0x0B, 0x54, 0x98, 0xBB,
+    0xC0, 0xBB, 0x1E, 0xD5, 0xB9, 0x3D, 0xD6, 0x8C, 0x32, 0xC5, 0x22, 0xBF, 0x2A, 0x7D, 0x3D, 0xC2,
+    0xB4, 0x92, 0xBA, 0x33, 0xCD, 0xA4, 0x8F, 0x58, 0xC4, 0x0F, 0xFC, 0x22, 0x26, 0xD3, 0xCE, 0xCA,
+    0x9B, 0xEB, 0xA3, 0x7C, 0x10, 0xAA, 0x18, 0x69, 0x07, 0x6F, 0x1A, 0x54, 0x9E, 0x4B, 0x40, 0x73,
+    0xF9, 0x8E, 0x9A, 0x81, 0x44, 0xC8, 0x59, 0x15, 0x3C, 0x56, 0xDF, 0xDC, 0xA0, 0xFF, 0x71, 0xFC,
+    0x03, 0xB5, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0x63, 0xDF, 0xC6, 0x85, 0x25, 0x26, 0x05,
+    0x2B, 0xD1, 0xC0, 0x50, 0x82, 0x14, 0x32, 0x4D, 0x0A, 0x0A, 0x6E, 0xC7, 0xD1, 0x15, 0x14, 0x14,
+    0x89, 0xC4, 0x59, 0x94, 0xF9, 0x03, 0x88, 0x43, 0xD4, 0x28, 0x76, 0x72, 0x45, 0x90, 0xAE, 0xE3,
+    0x17, 0x50, 0x04, 0x09, 0x21, 0x4A, 0x1A, 0xA4, 0xDC, 0xD9, 0xC7, 0x15, 0x29, 0xAE, 0xB1, 0x44,
+    0x99, 0x02, 0x9F, 0x10, 0x05, 0x8A, 0xC4, 0xCD, 0xDD, 0x59, 0xC4, 0x51, 0xEC, 0x79, 0x7C, 0xCF,
+    0xBB, 0x7B, 0x47, 0x8D, 0x94, 0xD9, 0xF5, 0xAC, 0x3D, 0x6B, 0xBF, 0xF9, 0xBE, 0xEF, 0x7D, 0xEF,
+    0x79, 0x9E, 0xAB, 0xFC, 0x63, 0xF6, 0x3C, 0xB8, 0x3E, 0x09, 0xC4, 0xE4, 0xB2, 0xD4, 0xA7, 0x2D,
+    0x7E, 0x06, 0x8A, 0x07, 0x47, 0x64, 0x8E, 0x1B, 0xA2, 0xD0, 0x13, 0xA5, 0x4C, 0x34, 0xAB, 0xFE,
+    0x24, 0x62, 0x6E, 0x89, 0x8A, 0x0C, 0x2B, 0x9E, 0x70, 0x85, 0x43, 0xE3, 0x44, 0x63, 0x35, 0xE2,
+    0x11, 0x57, 0xB4, 0x91, 0x76, 0xE6, 0x19, 0xC7, 0xFD, 0x4E, 0x1D, 0xE2, 0xCE, 0x66, 0xA3, 0xAE,
+    0xED, 0x6E, 0x9B, 0x9C, 0x78, 0xD5, 0xF7, 0xB4, 0x78, 0x42, 0x1A, 0x91, 0x47, 0x9A, 0xF3, 0x5D,
+    0xCD, 0x03, 0x99, 0x92, 0xD2, 0x86, 0x62, 0x04, 0xC0, 0x2A, 0xB7, 0xEA, 0xC7, 0xC7, 0x44, 0xF9,
+    0xF6, 0x2C, 0xA7, 0x82, 0x35, 0xD7, 0x69, 0x50, 0x5C, 0x62, 0x2F, 0x27, 0x7B, 0xB8, 0x8C, 0xD4,
+    0x88, 0x89, 0xDC, 0xA9, 0x6C, 0x8E, 0x3F, 0xB0, 0xBB, 0x4C, 0xAE, 0x96, 0x09, 0x10, 0xC9, 0x0A,
+    0x1A, 0x7B, 0x07, 0xF8, 0xEC, 0xC3, 0x01, 0xD8, 0x6B, 0x57, 0x62, 0x4A, 0x3B, 0x2A, 0x46, 0xCD,
+    0x8D, 0xE3, 0x4F, 0x58, 0xEE, 0xA2, 0x7D, 0x99, 0xAC, 0x4C, 0x5A, 0x9E, 0x8F, 0xE5, 0x79, 0x12,
+    0x32, 0xCB, 0x71, 0x3D, 0x1A, 0xA3, 0x21, 0xE5, 0x74, 0x9C, 0x15, 0xF7, 0x7E, 0x22, 0x87, 0xBB,
+    0x4D, 0xBF, 0x24, 0x29, 0x8C, 0x75, 0x87, 0xCD, 0x10, 0x7C, 0x7F, 0xB8, 0xE5, 0x3A, 0xEE, 0x5C,
+    0x5B, 0x79, 0x57, 0x3A, 0xBF, 0x8C, 0xA0, 0xF0, 0xA7, 0x92, 0x1B, 0x5B, 0x89, 0xAD, 0xF2, 0x3C,
+    0xCB, 0xEF, 0x5A, 0xE6, 0x3D, 0x6E, 0x98, 0x47, 0x13, 0xE2, 0xDF, 0x3A, 0x6F, 0x6B, 0x63, 0x8E,
+    0xEA, 0x8A, 0x3E, 0xAC, 0xDE, 0x8E, 0x7B, 0x8A, 0x7A, 0xD2, 0x8D, 0x7C, 0x21, 0xA8, 0xA3, 0x68,
+    0x20, 0x35, 0xC8, 0x4E, 0xD8, 0x08, 0xD0, 0xF1, 0x85, 0xA0, 0x23, 0x25, 0x5E, 0x14, 0xB2, 0x35,
+    0xB8, 0x88, 0xDE, 0x55, 0xFE, 0x59, 0x0F, 0xAA, 0x18, 0x24, 0xD3, 0x44, 0x09, 0x22, 0x8A, 0x08,
+    0x13, 0xFE, 0x69, 0x21, 0x9E, 0x16, 0xF4, 0x9A, 0x93, 0xE5, 0x9A, 0x1C, 0x8E, 0x79, 0xBE, 0xBC,
+    0x86, 0x82, 0xB6, 0x4B, 0x7C, 0xD1, 0xEB, 0x36, 0xEE, 0x74, 0x13, 0x7B, 0x5D, 0x27, 0x1E, 0x52,
+    0xB5, 0xAE, 0xD4, 0x8D, 0xCB, 0x34, 0x00, 0x9A, 0x43, 0x26, 0xFB, 0x88, 0xDF, 0x73, 0xA7, 0x6E,
+    0xC0, 0xA7, 0x33, 0xFE, 0xE6, 0xCF, 0x78, 0xB2, 0xBB, 0x3A, 0x12, 0x61, 0x5A, 0xCE, 0xF3, 0x59,
+    0xBE, 0xC5, 0x1D, 0x07, 0x3B, 0x22, 0x29, 0x15, 0x70, 0x6A, 0x1F, 0x0F, 0x14, 0x00, 0x5F, 0xB7,
+    0x49, 0x87, 0x93, 0x22, 0xD3, 0x1D, 0x18, 0x09, 0xE0, 0x58, 0xDC, 0x33, 0xFB, 0x5E, 0x7C, 0x02,
+    0x3E, 0xB0, 0xD8, 0x2A, 0x7F, 0x09, 0x40, 0x27, 0xF0, 0x03, 0x6E, 0xC2, 0x55, 0xD4, 0xAD, 0xC8,
+    0xC4, 0xD0, 0x91, 0x36, 0x2F, 0x73, 0x34, 0x8D, 0xA2, 0xB1, 0xBB, 0x9C, 0x8D, 0x34, 0x24, 0x3E,
+    0x16, 0x35, 0xCB, 0x40, 0xF7, 0x93, 0x4E, 0x05, 0xAE, 0x11, 0x9C, 0xD4, 0xB7, 0x92, 0xAB, 0x3F,
+    0xA0, 0x26, 0xF6, 0x60, 0x08, 0xF7, 0x02, 0x29, 0x36, 0x78, 0xEC, 0x09, 0xC2, 0x02, 0xAF, 0xCD,
+    0x24, 0x49, 0x73, 0xB8, 0xFE, 0xD3, 0xFF, 0x60, 0x36, 0x8D, 0xF6, 0xD1, 0x84, 0xB9, 0xD6, 0x27,
+    0x47, 0x3D, 0x85, 0x1B, 0x45, 0xA9, 0x2F, 0x9E, 0x76, 0x6B, 0xCC, 0x9E, 0xAE, 0xBD, 0x0C, 0x20,
+    0x6B, 0xA0, 0xEA, 0x39, 0x02, 0x6F, 0xAC, 0xC1, 0xC7, 0x22, 0x7F, 0xC5, 0xD9, 0x12, 0x98, 0x39,
+    0x62, 0xC4, 0x18, 0xE2, 0x2E, 0x86, 0x96, 0xE6, 0x9B, 0x82, 0xEE, 0x7F, 0xD5, 0xAB, 0x70, 0xDA,
+    0x4C, 0xC0, 0x7E, 0xC1, 0xED, 0xCF, 0xCE, 0x28, 0xB2, 0x4B, 0x60, 0x2A, 0x2C, 0xE9, 0xE4, 0xDB,
+    0xC0, 0xC7, 0x88, 0x5B, 0x21, 0x52, 0xB4, 0xD6, 0x23, 0x96, 0x24, 0x8A, 0xD9, 0x93, 0x57, 0xF0,
+    0x78, 0xC5, 0x81, 0xF4, 0xCB, 0x1D, 0x8F, 0xE0, 0x55, 0x66, 0x9A, 0x44, 0xB0, 0xAE, 0x84, 0xEE,
+    0x45, 0xDF, 0xD2, 0xB4, 0x52, 0x2F, 0xC7, 0x7C, 0x0E, 0x09, 0xDF, 0x04, 0xC9, 0x9E, 0x94, 0x54,
+    0x29, 0x0C, 0x24, 0x0E, 0x92, 0x3C, 0xD9, 0x32, 0xA3, 0xD1, 0xB6, 0xF1, 0x05, 0xD7, 0xE6, 0xEF,
+    0x8A, 0x8A, 0x93, 0x21, 0x0A, 0xA9, 0xD7, 0xE2, 0xDD, 0x72, 0x50, 0xD0, 0x32, 0xF5, 0x16, 0xA7,
+    0xE3, 0xBB, 0x63, 0xCC, 0x4F, 0xBD, 0x0E, 0xB6, 0xB6, 0xCD, 0x4A, 0xF0, 0x2F, 0x4A, 0x29, 0x6F,
+    0xA4, 0xA4, 0xE0, 0xE1, 0xDA, 0x83, 0x10, 0x05, 0x8B, 0x6C, 0xF1, 0x02, 0x36, 0x0D, 0x0B, 0x08,
+    0x12, 0x5C, 0x51, 0xAB, 0xD1, 0x40, 0xA9, 0x21, 0x99, 0xEC, 0x28, 0xBD, 0x61, 0x35, 0x49, 0x79,
+    0x15, 0x35, 0x7D, 0x49, 0xAE, 0x15, 0x07, 0x87, 0xAA, 0x45, 0x24, 0x10, 0x8A, 0x96, 0xAE, 0x95,
+    0x31, 0x03, 0x6B, 0xAC, 0x38, 0xE8, 0xEC, 0xC7, 0xB7, 0x5C, 0x7C, 0x76, 0xD6, 0x9B, 0xBD, 0xBD,
+    0x5F, 0x7B, 0x53, 0x54, 0xA5, 0x03, 0x09, 0xD3, 0x29, 0xD2, 0xF5, 0x07, 0xE4, 0x9E, 0x77, 0x93,
+    0xD0, 0x55, 0x4B, 0xAF, 0x1B, 0x97, 0xE8, 0xBE, 0xAC, 0x25, 0xB1, 0x1E, 0x7D, 0x74, 0x39, 0x5D,
+    0xFF, 0xBF, 0x80, 0x37, 0x97, 0xED, 0x41, 0x5C, 0xFC, 0x06, 0x4E, 0x6F, 0x49, 0xDE, 0x73, 0x85,
+    0xAC, 0x22, 0xE9, 0xB0, 0x12, 0x32, 0xBE, 0x2C, 0x77, 0xA0, 0xAB, 0xA6, 0x9E, 0x1A, 0xD0, 0xEB,
+    0x28, 0x1A, 0xC5, 0x10, 0xB0, 0x19, 0x78, 0x15, 0x9C, 0xAD, 0x6C, 0x46, 0xD3, 0x7C, 0x6D, 0x0A,
+    0x82, 0x02, 0x99, 0x80, 0x51, 0x38, 0x58, 0x96, 0xF9, 0xCA, 0x54, 0xDB, 0x74, 0x35, 0xDE, 0xA7,
+    0xF9, 0xB6, 0x7A, 0x4C, 0x0E, 0xFD, 0x2F, 0x62, 0x74, 0xDF, 0x34, 0x44, 0x5C, 0x47, 0xF7, 0xCA,
+    0x03, 0x35, 0x7E, 0x87, 0x92, 0xB0, 0x99, 0x50, 0xDE, 0xD4, 0x8D, 0x58, 0x4F, 0xEF, 0x7A, 0xD4,
+    0x09, 0x45, 0x67, 0xC3, 0xC4, 0x5C, 0x7C, 0x37, 0xFD, 0x48, 0x51, 0x52, 0x71, 0xE7, 0x68, 0xAA,
+    0xCB, 0x5D, 0x2F, 0x9B, 0xB9, 0xC3, 0x01, 0xED, 0x08, 0x61, 0x0F, 0xC4, 0xAB, 0xAE, 0x75, 0x59,
+    0x95, 0x51, 0xD1, 0x6A, 0x54, 0x12, 0x55, 0xDE, 0x62, 0x13, 0x32, 0xAD, 0xE6, 0xF2, 0xD2, 0x46,
+    0xB4, 0x56, 0xF0, 0x46, 0x54, 0x4B, 0xA7, 0x7C, 0x87, 0xA4, 0xE4, 0xA5, 0x71, 0xA6, 0x61, 0xFD,
+    0xB7, 0xCA, 0x14, 0xFC, 0x5B, 0xD4, 0x5F, 0x27, 0x68, 0xC0, 0x47, 0xBE, 0xE8, 0x16, 0xAC, 0x77,
+    0xFF, 0xA9, 0x9B, 0x61, 0x7F, 0x01, 0x54, 0x2F, 0xCE, 0xA5, 0xE1, 0xF0, 0xEF, 0xC8, 0x9E, 0x9B,
+    0x5E, 0x35, 0xA3, 0x3C, 0x9E, 0x1C, 0xBF, 0x42, 0xBC, 0x4D, 0x67, 0x1F, 0x1E, 0x3E, 0x6F, 0x7B,
+    0xA9, 0x83, 0xB8, 0x61, 0x6F, 0x5B, 0x13, 0x5D, 0x86, 0x45, 0x8D, 0xFD, 0xA0, 0x78, 0xC4, 0x0B,
+    0xAE, 0xEA, 0xF4, 0x08, 0xC5, 0xDD, 0xE7, 0xD0, 0x1C, 0x84, 0xDD, 0x03, 0xB1, 0xCF, 0x16, 0x32,
+    0x54, 0xE9, 0x5A, 0x88, 0x36, 0xD2, 0x81, 0xC0, 0x27, 0x24, 0x23, 0x32, 0xA0, 0x58, 0x12, 0xC0,
+    0x92, 0x82, 0x4A, 0x4A, 0xB2, 0x92, 0x4C, 0xA0, 0x78, 0xA4, 0xCA, 0x2B, 0x96, 0xD2, 0x9A, 0x2A,
+    0x76, 0x03, 0x5D, 0x8E, 0x6E, 0xEE, 0x48, 0xC1, 0xC9, 0x0B, 0xC9, 0xF4, 0x57, 0x7C, 0x6F, 0x73,
+    0x79, 0xE0, 0x7A, 0xEB, 0xDD, 0xA3, 0xBF, 0xE2, 0xAE, 0x27, 0x67, 0x28, 0xB9, 0x68, 0xC4, 0x16,
+    0x1A, 0x04, 0xC6, 0x14, 0x6D, 0xC2, 0xDD, 0x46, 0xBF, 0x40, 0xE9, 0x6D, 0x75, 0xF2, 0x16, 0x84,
+    0xEB, 0x92, 0x56, 0xE1, 0xE5, 0xBB, 0xA8, 0xB2, 0x04, 0x68, 0x4C, 0x4B, 0xAF, 0x77, 0xFC, 0x0B,
+    0xBD, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x7D, 0xF6, 0xE6, 0x8B, 0x85, 0x2C, 0xB4, 0x29, 0x92,
+    0x82, 0x22, 0x31, 0x25, 0x05, 0xE0, 0x96, 0x22, 0xF7, 0xED, 0x2A, 0x29, 0x28, 0xAE, 0xC8, 0x15,
+    0xF9, 0xEA, 0x50, 0xD2, 0xA5, 0xA1, 0xA0, 0xE0, 0xCE, 0x86, 0x86, 0x82, 0x82, 0x2A, 0x3F, 0x81,
+    0x02, 0x51, 0x40, 0x91, 0xF2, 0xEE, 0xEC, 0x70, 0x05, 0x45, 0x1A, 0x4B, 0x14, 0x94, 0x38, 0x45,
+    0x68, 0x6F, 0x91, 0x2C, 0xC5, 0x17, 0xAD, 0x3D, 0xBC, 0xF1, 0xF7, 0x5D, 0x92, 0x92, 0x08, 0x89,
+    0xD5, 0x7A, 0xED, 0xB5, 0x77, 0x67, 0xDF, 0x9B, 0x79, 0x33, 0x46, 0xB2, 0xD9, 0x6C, 0x3C, 0x9C,
+    0x48, 0x44, 0x2A, 0x32, 0x03, 0xA6, 0x77, 0x35, 0x70, 0x98, 0x0D, 0x40, 0xDE, 0x36, 0x00, 0xA2,
+    0x0D, 0x80, 0xF5, 0xFC, 0x94, 0x84, 0xA2, 0x03, 0x5C, 0x1A, 0x81, 0xAC, 0x2B, 0x5B, 0xE0, 0xD8,
+    0xF0, 0xD1, 0xD6, 0xDC, 0x60, 0x02, 0x37, 0x5C, 0x3F, 0x41, 0x03, 0x23, 0x2D, 0x37, 0xB8, 0x60,
+    0x25, 0x98, 0x91, 0x26, 0x69, 0x01, 0x59, 0xAF, 0x63, 0xD4, 0xA1, 0xF4, 0x3A, 0xEF, 0xF4, 0xF1,
+    0x31, 0x2E, 0x5B, 0x72, 0x40, 0x33, 0x52, 0xF3, 0x6A, 0x61, 0x7F, 0x0B, 0xC8, 0x7E, 0x1D, 0x89,
+    0x83, 0xEB, 0x07, 0xC7, 0x43, 0xCA, 0x1A, 0x6B, 0xDB, 0xA1, 0xB8, 0x1B, 0x12, 0xFB, 0x24, 0xFE,
+    0x22, 0x5D, 0x15, 0x5D, 0x5F, 0x8A, 0xED, 0x33, 0x6E, 0x81, 0x21, 0x8E, 0xB4, 0x57, 0x70, 0x34,
+    0xA4, 0xD7, 0x35, 0x60, 0x73, 0x7F, 0xB5, 0x39, 0x28, 0xA4, 0x23, 0x9F, 0x66, 0xC8, 0xA5, 0x26,
+    0x62, 0x22, 0x77, 0x2D, 0xEF, 0x66, 0xE4, 0x1D, 0x95, 0xE7, 0x3D, 0x1F, 0x78, 0x47, 0x23, 0x32,
+    0xF0, 0x60, 0x05, 0x3A, 0x6F, 0x1E, 0x04, 0x5D, 0x38, 0xE3, 0xCD, 0x0D, 0x71, 0xD9, 0x50, 0xF3,
+    0x5E, 0x89, 0x77, 0x75, 0x2E, 0x4A, 0x95, 0x6D, 0x61, 0x46, 0x5C, 0x30, 0x7F, 0x28, 0xB3, 0x4A,
+    0xE7, 0xA9, 0x22, 0xDA, 0x36, 0xC2, 0xA8, 0x7A, 0x7B, 0x26, 0x6D, 0x85, 0x39, 0x8D, 0x66, 0xB0,
+    0xBD, 0x6D, 0x9D, 0xAF, 0x24, 0xD2, 0x27, 0xC1, 0x3E, 0xAF, 0x6A, 0xE7, 0xE7, 0x84, 0xEF, 0xB3,
+    0x50, 0xB4, 0x65, 0xDD, 0x60, 0x4A, 0xC7, 0xAD, 0x39, 0x87, 0xE4, 0xCE, 0x80, 0xE2, 0x67, 0x1E,
+    0x4A, 0xBB, 0x0F, 0xEB, 0xB7, 0xA6, 0x13, 0xFE, 0x35, 0x9D, 0xBB, 0x12, 0x49, 0xA7, 0xA2, 0xD7,
+    0x09, 0x7D, 0x21, 0xE5, 0x74, 0xC8, 0x75, 0x9E, 0x2C, 0xF3, 0xDB, 0x6F, 0xD0, 0x29, 0x46, 0x13,
+    0x5C, 0xCC, 0x18, 0xD6, 0x3C, 0x28, 0x1F, 0x13, 0x6C, 0x97, 0x89, 0xB4, 0x39, 0x2F, 0x25, 0x64,
+    0x3B, 0xE7, 0x8B, 0xD6, 0x7D, 0x58, 0xB4, 0x55, 0x2C, 0x6B, 0x06, 0xC9, 0xBB, 0x71, 0x1B, 0x13,
+    0x8D, 0x4F, 0x46, 0xA3, 0x96, 0xD3, 0x2B, 0xB8, 0xB1, 0x59, 0x6D, 0xEE, 0xCA, 0x20, 0x73, 0x39,
+    0x91, 0x4C, 0x83, 0x92, 0x82, 0x21, 0x9C, 0x19, 0xAE, 0x66, 0x4C, 0x47, 0x3E, 0x54, 0xDE, 0x0E,
+    0x79, 0x80, 0xB2, 0x30, 0x22, 0x3D, 0x56, 0x3F, 0x4C, 0x2A, 0x1D, 0x5A, 0x50, 0xC1, 0x29, 0x01,
+    0x70, 0x1D, 0x72, 0x46, 0x0E, 0xCA, 0xD4, 0xF2, 0x45, 0xA2, 0x67, 0x15, 0xD8, 0x09, 0xE1, 0x5D,
+    0xBC, 0x16, 0x97, 0xF8, 0x53, 0x37, 0x10, 0x1C, 0xBD, 0x1D, 0xCA, 0xF6, 0xC8, 0x8C, 0x59, 0x5F,
+    0xF9, 0xAA, 0x09, 0x34, 0x8D, 0xAB, 0xFB, 0x5C, 0x3D, 0x2F, 0x8E, 0xCF, 0x34, 0x03, 0x5A, 0x38,
+    0x4F, 0xE9, 0x01, 0x7B, 0x5B, 0x65, 0x7D, 0x42, 0x03, 0xAB, 0x8D, 0xF6, 0x5C, 0x5A, 0x4A, 0x3B,
+    0x91, 0xA0, 0x31, 0x2E, 0x22, 0xB8, 0x34, 0x17, 0xD0, 0xD9, 0xE6, 0xBC, 0x3B, 0x22, 0xAA, 0x17,
+    0xC3, 0xBA, 0xA2, 0x58, 0x4F, 0x0B, 0xCA, 0xD5, 0x95, 0xDF, 0x7F, 0xD7, 0xC3, 0x7E, 0xFB, 0x82,
+    0x3A, 0xCE, 0x5A, 0xE9, 0x66, 0xE6, 0x87, 0x0B, 0x4C, 0x93, 0xD1, 0x12, 0x08, 0x0E, 0x55, 0x0F,
+    0x28, 0x71, 0x88, 0x89, 0xD0, 0x6F, 0x91, 0x6E, 0x39, 0x11, 0xE6, 0x5C, 0x88, 0x27, 0x1D, 0xBF,
+    0xE8, 0xAA, 0xC5, 0xAB, 0x3C, 0x31, 0x4B, 0xF6, 0x98, 0xB0, 0xB0, 0xE9, 0x5F, 0xD1, 0x02, 0x3C,
+    0xCA, 0x48, 0x76, 0xDC, 0x46, 0x30, 0x4D, 0xDF, 0xF4, 0xF8, 0x38, 0xEE, 0x51, 0xCC, 0x0F, 0x3F,
+    0x3A, 0x86, 0x79, 0xFA, 0x67, 0x89, 0xE4, 0x6F, 0xB9, 0xD7, 0xE2, 0xB8, 0x3A, 0xEB, 0xB1, 0x2E,
+    0x9E, 0x8D, 0xB0, 0x59, 0x38, 0xFC, 0x42, 0x9E, 0x8C, 0xE5, 0xE4, 0xBA, 0xBD, 0x5C, 0x6C, 0xF7,
+    0x4E, 0xB2, 0xC4, 0xDE, 0x74, 0x97, 0x7E, 0xC3, 0xF0, 0x2A, 0x33, 0xAF, 0x03, 0x37, 0xEE, 0x43,
+    0x35, 0x37, 0xA2, 0x68, 0xB5, 0x2B, 0x33, 0xAF, 0x9D, 0x44, 0xD9, 0x4F, 0x41, 0xFC, 0xEC, 0x49,
+    0x54, 0x81, 0x51, 0xBE, 0x24, 0xC5, 0xEE, 0x84, 0x22, 0x5C, 0x20, 0x92, 0xC9, 0x7B, 0xA0, 0xE9,
+    0x75, 0xAA, 0xB2, 0xA6, 0xA0, 0x51, 0xCC, 0xBB, 0x6C, 0xDF, 0xB5, 0xCF, 0x55, 0x78, 0x1A, 0xD2,
+    0x4C, 0x07, 0xBB, 0x44, 0x59, 0x87, 0xF5, 0xA9, 0xD6, 0x8B, 0x4A, 0x55, 0x58, 0x29, 0x75, 0xCA,
+    0x32, 0xA7, 0xBA, 0xE8, 0x16, 0x3A, 0xB1, 0xA4, 0xDE, 0x28, 0x5E, 0x0E, 0x13, 0x35, 0xC1, 0x73,
+    0x8B, 0x8E, 0xCE, 0x29, 0x7A, 0xEE, 0x94, 0xA9, 0x9A, 0x53, 0x99, 0x96, 0xB3, 0xBF, 0x34, 0xDE,
+    0x84, 0xDB, 0x0C, 0x52, 0xB7, 0x35, 0xBC, 0x15, 0xB1, 0xBD, 0x18, 0x13, 0x91, 0xCE, 0x3E, 0x23,
+    0xCA, 0x74, 0x54, 0x09, 0x97, 0xAD, 0xDB, 0x65, 0x68, 0xB0, 0x6D, 0x53, 0xBB, 0xFD, 0xD3, 0xF7,
+    0xE5, 0x44, 0x7E, 0x97, 0xB3, 0x39, 0x1B, 0x6D, 0xFF, 0x5A, 0x47, 0x28, 0x3E, 0x25, 0x03, 0x77,
+    0x4F, 0xB9, 0x68, 0x78, 0xAE, 0xAF, 0xFE, 0x07, 0x1A, 0x14, 0x62, 0xC1, 0x24, 0xA7, 0x4E, 0xCE,
+    0x02, 0xAE, 0x24, 0xFF, 0x91, 0xC6, 0xB6, 0xD8, 0x6B, 0xB5, 0x9F, 0x96, 0x8A, 0xA5, 0xC1, 0xCF,
+    0x04, 0xC7, 0xFC, 0xF2, 0x22, 0x64, 0xAC, 0x34, 0xEB, 0x23, 0x7C, 0x46, 0xE3, 0x4F, 0x55, 0x0F,
+    0x69, 0x58, 0x0A, 0xF6, 0x89, 0xD5, 0x2C, 0x2B, 0xBE, 0xD1, 0x3C, 0x23, 0x83, 0x47, 0x07, 0x9A,
+    0x72, 0xAA, 0x12, 0x5A, 0x61, 0x32, 0xE7, 0x3D, 0x0B, 0x42, 0x47, 0x09, 0x9C, 0x52, 0xCE, 0x15,
+    0xEC, 0xF3, 0x07, 0x6D, 0x39, 0xB2, 0xFE, 0x8C, 0xB9, 0x3C, 0x11, 0x15, 0x73, 0xE2, 0x13, 0xEA,
+    0xF4, 0xC2, 0x0D, 0x9A, 0xCE, 0xD1, 0x8C, 0x45, 0x1F, 0x73, 0x96, 0xBC, 0x48, 0x1F, 0xDC, 0x19,
+    0x08, 0x3A, 0xE7, 0xFF, 0xA6, 0x69, 0xBC, 0xF3, 0xC2, 0x52, 0x66, 0xC4, 0x5F, 0x73, 0xFB, 0x82,
+    0xE0, 0xCE, 0xAB, 0x9F, 0x58, 0x6C, 0x1C, 0x2B, 0x4B, 0x9F, 0x4F, 0x78, 0x43, 0xF4, 0x1F, 0xA4,
+    0x14, 0x62, 0xD2, 0x23, 0x7F, 0x49, 0xBD, 0x32, 0xFD, 0xB0, 0x3A, 0xB8, 0xE4, 0x76, 0x3F, 0xD1,
+    0x13, 0xE9, 0xD7, 0x2E, 0x8D, 0x54, 0xB3, 0xE0, 0x2B, 0x96, 0x94, 0x9B, 0x5A, 0xFA, 0x90, 0x6B,
+    0x15, 0x12, 0x66, 0x2E, 0x3F, 0x42, 0x49, 0xEC, 0x5E, 0x7A, 0x16, 0x94, 0xC7, 0x2C, 0x00, 0x7B,
+    0xA8, 0x1E, 0x55, 0xBA, 0xBD, 0x6D, 0x74, 0x85, 0x9E, 0x74, 0x0B, 0x9D, 0x6D, 0x99, 0xED, 0x54,
+    0xF4, 0x92, 0x14, 0x24, 0xCB, 0x24, 0x03, 0x7F, 0x94, 0xAC, 0x6C, 0x84, 0x7F, 0x94, 0xF5, 0x65,
+    0xDE, 0xDB, 0xF3, 0xDE, 0x48, 0x9D, 0x4C, 0xF0, 0x0E, 0x8F, 0xED, 0xCB, 0x49, 0xC3, 0x56, 0x8E,
+    0x5B, 0xB4, 0x57, 0x7F, 0xE4, 0x0E, 0x82, 0xA1, 0xBF, 0xB2, 0x3E, 0x8F, 0x59, 0x9D, 0x92, 0x49,
+    0x32, 0xEF, 0xFE, 0x1D, 0xB2, 0xDA, 0x6C, 0x84, 0x60, 0x67, 0x0D, 0x07, 0x2B, 0x78, 0xE4, 0xBF,
+    0x73, 0x6C, 0x60, 0x43, 0xE3, 0xCB, 0xAE, 0xFA, 0x4B, 0xEA, 0x92, 0xA6, 0xF2, 0x05, 0x8C, 0x16,
+    0x21, 0x16, 0x08, 0xFE, 0xF0, 0xC6, 0xE2, 0xEB, 0x78, 0x93, 0x82, 0xA1, 0xA5, 0x6A, 0x32, 0x17,
+    0xD1, 0x76, 0xD1, 0xA5, 0xE3, 0x91, 0x09, 0x47, 0x45, 0xE7, 0x58, 0x0A, 0x46, 0xBC, 0x5D, 0xFB,
+    0x07, 0xAD, 0x55, 0xB1, 0x6E, 0xE5, 0x44, 0x14, 0xBD, 0x63, 0xEF, 0x63, 0x24, 0x5C, 0x4C, 0x8A,
+    0x44, 0xA2, 0x58, 0x34, 0xB4, 0x80, 0x94, 0xE1, 0x03, 0x20, 0x63, 0x91, 0x22, 0xED, 0x16, 0x79,
+    0xA2, 0xD8, 0x82, 0x16, 0x41, 0x01, 0x1F, 0xB0, 0xBB, 0x63, 0x48, 0x91, 0x72, 0xF3, 0x11, 0x48,
+    0x88, 0x6D, 0xF6, 0x07, 0x42, 0x3C, 0xE1, 0x15, 0x29, 0xB6, 0xC0, 0x62, 0x45, 0x8D, 0x49, 0xA4,
+    0x14, 0xA4, 0x19, 0x76, 0x2D, 0x70, 0xB4, 0x63, 0x5F, 0xCE, 0xF8, 0x25, 0x9B, 0x2C, 0x01, 0x09,
+    0x21, 0x46, 0xF2, 0x9B, 0xE7, 0xB1, 0xE7, 0xCE, 0xB9, 0xE7, 0x9E, 0x7B, 0x4C, 0x84, 0x51, 0x7C,
+    0x1F, 0x48, 0x1F, 0xA5, 0xAB, 0xA5, 0x99, 0x28, 0xD3, 0x12, 0xBD, 0xF6, 0x2D, 0x51, 0xCD, 0x4D,
+    0xC6, 0xDC, 0xC9, 0xB6, 0x88, 0xB2, 0xCA, 0x06, 0x22, 0x31, 0xE2, 0x09, 0xA7, 0x6B, 0x36, 0x9F,
+    0xB3, 0x61, 0x1E, 0x2D, 0xF3, 0xE0, 0xCA, 0x3C, 0xD6, 0x94, 0xF7, 0x35, 0xA9, 0x50, 0x97, 0xA6,
+    0x71, 0xA7, 0x5C, 0x19, 0x1E, 0xA8, 0xE0, 0x86, 0x2E, 0x47, 0x77, 0x3F, 0xEB, 0x87, 0xAC, 0x8B,
+    0x54, 0xAE, 0xA4, 0xDB, 0x19, 0x09, 0x6E, 0x25, 0xF7, 0xFA, 0xCB, 0xF8, 0x26, 0x0D, 0x84, 0xD8,
+    0x6E, 0xC8, 0xCF, 0xA3, 0x6A, 0xA2, 0xCD, 0xFA, 0x07, 0x79, 0x78, 0xA0, 0x1B, 0xCB, 0xA5, 0xEE,
+    0xE9, 0x95, 0x71, 0x5F, 0x4F, 0xD3, 0x60, 0x27, 0x88, 0xD1, 0x4E, 0x77, 0x77, 0x56, 0xAF, 0x5E,
+    0x78, 0x9B, 0xD6, 0xB6, 0xC5, 0xD7, 0xC4, 0x15, 0xC7, 0x22, 0x12, 0x7B, 0xD7, 0x9A, 0x48, 0xDF,
+    0xB4, 0xBA, 0x72, 0x9F, 0x50, 0x16, 0x4C, 0x95, 0xE2, 0x75, 0x76, 0x33, 0x60, 0xEA, 0xAD, 0xF4,
+    0x98, 0xF6, 0x9D, 0x4A, 0xC1, 0x6A, 0x4E, 0x59, 0x09, 0x9E, 0x26, 0xD9, 0x4D, 0x27, 0xA8, 0x36,
+    0x1A, 0xBC, 0x62, 0x0F, 0xA3, 0xC2, 0xC4, 0x1F, 0xF6, 0xAA, 0xA5, 0x7C, 0xCC, 0x3B, 0xD9, 0x91,
+    0xEA, 0xF3, 0x2E, 0x8F, 0xE4, 0x82, 0x19, 0x33, 0x26, 0x57, 0xD9, 0x91, 0xEA, 0xF2, 0x55, 0xAC,
+    0x64, 0x54, 0x85, 0x88, 0x20, 0x06, 0x01, 0x8F, 0xBB, 0xB4, 0x22, 0x2E, 0x1F, 0x89, 0x52, 0xD0,
+    0x2A, 0x39, 0x7F, 0x4F, 0xC6, 0x82, 0x17, 0xC1, 0x75, 0x1B, 0xAC, 0x76, 0x7E, 0xF7, 0x4D, 0xFC,
+    0x6E, 0x83, 0x28, 0xFB, 0xE3, 0x19, 0xF0, 0x15, 0xFC, 0x33, 0xB6, 0x5B, 0xB0, 0x88, 0x7C, 0x19,
+    0x0B, 0xF2, 0xC9, 0x0B, 0xA0, 0xF8, 0xC0, 0x9A, 0xAF, 0x0E, 0xCF, 0xDA, 0xDE, 0xB1, 0xE2, 0xBC,
+    0xE1, 0x60, 0x5A, 0x9D, 0x8D, 0xD7, 0x4F, 0x5D, 0x57, 0x55, 0x86, 0x33, 0x0B, 0x9C, 0x38, 0xBB,
+    0x38, 0xEF, 0xB3, 0x3D, 0xC4, 0x09, 0xC8, 0x2D, 0x14, 0xDE, 0xFA, 0x75, 0xAA, 0xE9, 0x8B, 0x2C,
+    0x22, 0x3D, 0x14, 0x67, 0xA4, 0x8C, 0x5B, 0x52, 0xB8, 0x44, 0x8D, 0xDB, 0xBA, 0x42, 0x85, 0xF3,
+    0x4A, 0xF6, 0x96, 0xAC, 0xE7, 0x8F, 0x06, 0x14, 0xBF, 0x11, 0x7C, 0x55, 0x04, 0xB5, 0xDB, 0x14,
+    0x27, 0x7D, 0xAA, 0xE2, 0xCA, 0xAD, 0x69, 0x61, 0x25, 0xED, 0xCF, 0x79, 0x10, 0x9D, 0xA9, 0xDE,
+    0x92, 0xA0, 0x27, 0xD0, 0xBB, 0x90, 0x51, 0x24, 0xF1, 0xB9, 0xC7, 0xCD, 0x6D, 0x02, 0x75, 0x63,
+    0x0E, 0x52, 0xED, 0xB0, 0x8C, 0x30, 0x9F, 0x6F, 0x13, 0x14, 0x93, 0x2E, 0xD1, 0xE5, 0x7D, 0x16,
+    0x54, 0x10, 0x8D, 0xF5, 0x93, 0xA8, 0x40, 0x28, 0x15, 0x48, 0x46, 0x31, 0x32, 0x77, 0x58, 0xD3,
+    0x8D, 0x00, 0x4A, 0x4D, 0xDA, 0xDB, 0xD2, 0x7A, 0x7B, 0xCA, 0x64, 0x38, 0x92, 0xBC, 0x54, 0x55,
+    0x8D, 0x1B, 0xE6, 0x28, 0xCE, 0xEF, 0x76, 0x88, 0xD3, 0x50, 0x95, 0x8A, 0x86, 0x73, 0x72, 0x90,
+    0x5D, 0x80, 0x31, 0x35, 0x26, 0x1A, 0x13, 0x8B, 0x29, 0xD6, 0xCB, 0xEB, 0x36, 0xD9, 0x6A, 0x03,
+    0x24, 0xD8, 0xB3, 0x01, 0xF1, 0x3A, 0xCA, 0xC6, 0x54, 0xB9, 0xD9, 0x7C, 0x29, 0x03, 0xFC, 0xE4,
+    0x88, 0x7B, 0x7D, 0x88, 0xF9, 0x1D, 0x3C, 0xD5, 0xDC, 0x20, 0x0F, 0x33, 0x24, 0xC2, 0x8C, 0x17,
+    0x43, 0x82, 0xAC, 0x02, 0x54, 0x0F, 0x99, 0x01, 0xA9, 0xC6, 0xCE, 0x3A, 0x71, 0x95, 0x45, 0xF3,
+    0xB8, 0x21, 0xF5, 0x0C, 0xDD, 0x40, 0xB6, 0xDE, 0x04, 0x15, 0xDC, 0x41, 0x38, 0x05, 0x64, 0x52,
+    0x92, 0x0D, 0xD9, 0xB4, 0x11, 0xF0, 0x64, 0x0F, 0x5C, 0x82, 0x07, 0x90, 0x5F, 0x70, 0x70, 0x8C,
+    0xE3, 0x0D, 0x22, 0xE1, 0x0C, 0x9C, 0x37, 0x9D, 0x8B, 0x95, 0xBA, 0xD1, 0x47, 0x5C, 0x8D, 0x34,
+    0x40, 0x6E, 0x41, 0x79, 0xED, 0x1D, 0x1D, 0xE4, 0xD0, 0x9E, 0x6A, 0x94, 0xAF, 0xC9, 0xC9, 0x98,
+    0xF5, 0xEE, 0xB7, 0x87, 0x2F, 0x7E, 0x60, 0x1B, 0x6D, 0x70, 0xFE, 0xE0, 0x66, 0xB7, 0xE4, 0x5D,
+    0x62, 0x5E, 0x2D, 0x92, 0xE4, 0x57, 0x67, 0x97, 0x8F, 0x90, 0xCF, 0xDA, 0x9C, 0x1C, 0x6F, 0x22,
+    0xD5, 0xBA, 0x4B, 0x24, 0xD5, 0x50, 0x7D, 0xAA, 0x00, 0xB8, 0x52, 0xA8, 0x28, 0x0A, 0x50, 0xBA,
+    0x88, 0x64, 0x24, 0xD2, 0x2D, 0xC2, 0x01, 0xD4, 0x6D, 0x9F, 0x1C, 0x83, 0x97, 0x71, 0x40, 0xD2,
+    0x28, 0x81, 0xAD, 0xC8, 0xC4, 0x89, 0x05, 0x5F, 0x4C, 0x1B, 0xD1, 0x2A, 0xBA, 0x45, 0x6A, 0x92,
+    0x3B, 0x9B, 0xDA, 0xFF, 0x90, 0x2F, 0x4A, 0x7E, 0xCF, 0x00, 0x44, 0x04, 0x84, 0x96, 0x96, 0xA2,
+    0x49, 0x53, 0x31, 0x88, 0xE8, 0xD0, 0x50, 0xAA, 0x41, 0x69, 0x29, 0x8A, 0x28, 0x43, 0xD1, 0x5A,
+    0x54, 0x70, 0xA0, 0x58, 0x04, 0x89, 0x5C, 0xCC, 0x2E, 0xBF, 0xC1, 0xFB, 0xFC, 0x9C, 0x17, 0x8C,
+    0x2E, 0x69, 0xAF, 0xD2, 0xD2, 0x5B, 0x0D, 0x58, 0x47, 0x6D, 0x6D, 0x6A, 0xCB, 0xA5, 0x9D, 0x60,
+    0x7C, 0xBA, 0x07, 0x2C, 0x90, 0x86, 0x63, 0xF8, 0x46, 0xA7, 0xA3, 0x44, 0x2E, 0x0D, 0x97, 0xD9,
+    0xA8, 0x03, 0x99, 0x63, 0x58, 0xCC, 0x88, 0xD4, 0xCC, 0x49, 0x5C, 0xFE, 0xB1, 0x4F, 0x23, 0x40,
+    0xE3, 0x4F, 0xBD, 0x33, 0x90, 0x0E, 0x26, 0x48, 0x68, 0xF2, 0x8C, 0x4B, 0x99, 0x42, 0x5C, 0xF7,
+    0xAD, 0xE4, 0x5C, 0x64, 0x1E, 0x36, 0x59, 0x88, 0x74, 0x4B, 0x5C, 0x74, 0x2F, 0x54, 0x8F, 0xBE,
+    0x40, 0x45, 0x77, 0x91, 0x02, 0xFC, 0x21, 0x8B, 0xB6, 0x32, 0x0B, 0xE8, 0x19, 0xC9, 0x6C, 0x75,
+    0x32, 0x20, 0x8D, 0x7C, 0x70, 0x5E, 0x83, 0x3B, 0xD7, 0xFD, 0x2D, 0x3E, 0x75, 0x81, 0x0F, 0x68,
+    0xC0, 0x9A, 0x06, 0x3E, 0x91, 0xAC, 0x94, 0x4F, 0x38, 0x79, 0xEA, 0x4F, 0x73, 0x77, 0x89, 0xCF,
+    0xED, 0x80, 0x3A, 0xE0, 0xCB, 0x81, 0xEF, 0xF4, 0x06, 0x3E, 0x40, 0x81, 0xB0, 0x34, 0x07, 0xFD,
+    0xCB, 0xA8, 0x1A, 0x73, 0x14, 0xE4, 0xF3, 0xF1, 0x51, 0x4C, 0x21, 0xE6, 0xEE, 0x63, 0xAF, 0x17,
+    0x68, 0x0B, 0xD6, 0x01, 0x38, 0xC4, 0xF5, 0x94, 0xFE, 0x15, 0x83, 0xFF, 0x13, 0xC2, 0x7F, 0x66,
+    0xD0, 0x5F, 0x32, 0xD8, 0x98, 0x43, 0x08, 0xC0, 0xFE, 0xFA, 0x78, 0xC1, 0xDC, 0x03, 0xF8, 0x16,
+    0xEA, 0x6F, 0x21, 0xF9, 0xF8, 0x17, 0x06, 0xD3, 0x46, 0x84, 0xA2, 0x11, 0xDA, 0x4B, 0xC8, 0x05,
+    0x2D, 0x2D, 0x57, 0xC0, 0xE0, 0xE0, 0x31, 0x95, 0xE0, 0xBA, 0xA7, 0x7D, 0xC1, 0xB4, 0x4E, 0xA6,
+    0x95, 0x93, 0x9D, 0x4C, 0xDF, 0x2A, 0x9B, 0xBA, 0x2A, 0xC0, 0x03, 0x23, 0xBD, 0xFE, 0x28, 0x2D,
+    0x24, 0xAB, 0xB6, 0xFE, 0x7D, 0xBC, 0x65, 0x4B, 0x1D, 0xD4, 0xB9, 0x0B, 0x59, 0x7A, 0x41, 0xF3,
+    0xDE, 0x75, 0x8E, 0xBC, 0x7A, 0x1A, 0xF2, 0xD0, 0xD3, 0x05, 0x3D, 0xAB, 0x57, 0x56, 0xE7, 0xDF,
+    0x93, 0x68, 0xA7, 0x48, 0xEF, 0xD4, 0xD8, 0xE3, 0xB3, 0xBB, 0x81, 0xB2, 0x3E, 0x59, 0xDD, 0x21,
+    0xAC, 0x6E, 0x7C, 0x69, 0x75, 0x53, 0x1B, 0xA7, 0xBE, 0x2E, 0x92, 0x7D, 0x5F, 0x79, 0xC9, 0xDA,
+    0xB6, 0xE5, 0x9C, 0x7F, 0xE4, 0x46, 0xF7, 0xE8, 0x1C, 0x70, 0x5C, 0x9A, 0x12, 0x3D, 0x0D, 0x95,
+    0x7A, 0x98, 0x45, 0xD4, 0x25, 0xE1, 0x60, 0xA2, 0x83, 0x7D, 0x78, 0x7E, 0x72, 0x05, 0x1B, 0x96,
+    0xD6, 0x48, 0x06, 0xAC, 0xC1, 0x63, 0x29, 0xD9, 0x53, 0xF2, 0xB6, 0x9B, 0x9F, 0x9C, 0xFF, 0x30,
+    0xFE, 0x04, 0x95, 0x54, 0x3D, 0x73, 0xDD, 0x44, 0x14, 0x3D, 0xD2, 0xFA, 0x45, 0x10, 0xC1, 0xAC,
+    0x0B, 0x52, 0x30, 0x64, 0x50, 0xFE, 0x00, 0xD9, 0x86, 0xC2, 0x4D, 0xB2, 0x82, 0x14, 0x14, 0x14,
+    0x76, 0xE1, 0xD7, 0x92, 0x8E, 0x82, 0x06, 0x7E, 0x40, 0xB0, 0x14, 0x3C, 0x43, 0x8A, 0x14, 0x71,
+    0xC1, 0x0C, 0x2D, 0x45, 0x68, 0x0C, 0x33, 0x54, 0x54, 0xC4, 0x4F, 0x8A, 0x1B, 0x0A, 0x1A, 0x25,
+    0xF9, 0x01, 0x88, 0x50, 0x30, 0x13, 0x0A, 0x8B, 0x89, 0x32, 0x68, 0x40, 0xD2, 0xE5, 0x5C, 0x3D,
+    0x3F, 0x87, 0x4C, 0x32, 0x1E, 0xD8, 0x67, 0xAD, 0xA5, 0xFD, 0xB8, 0x1F, 0xE7, 0x9C, 0x7B, 0x01,
+    0x19, 0x80, 0x4C, 0x52, 0xCC, 0xE6, 0x29, 0x96, 0x63, 0x0D, 0x71, 0x9B, 0x54, 0xB1, 0x98, 0x0E,
+    0xAE, 0x1C, 0x61, 0x5A, 0x97, 0x63, 0xB0, 0x15, 0xDC, 0x6E, 0x83, 0xE8, 0x97, 0x16, 0x41, 0x77,
+    0x07, 0xF0, 0x97, 0x00, 0x7B, 0x04, 0x18, 0xE1, 0x0D, 0x5E, 0x87, 0xCF, 0x81, 0xA4, 0xE4, 0x62,
+    0x89, 0x0D, 0xFE, 0x4F, 0xA4, 0x44, 0x24, 0x5C, 0x5B, 0x60, 0x35, 0x2E, 0xD9, 0x14, 0xF6, 0xD7,
+    0x0E, 0x18, 0x7C, 0x8A, 0x00, 0x4B, 0x77, 0xE7, 0xE6, 0xC1, 0xFC, 0x8A, 0x34, 0x7E, 0x70, 0x43,
+    0x20, 0x79, 0x91, 0xDA, 0xD2, 0xB4, 0x61, 0x4B, 0x6B, 0x1E, 0x61, 0x4F, 0x5B, 0xC9, 0xDD, 0x56,
+    0x2F, 0x00, 0xF1, 0xEF, 0x34, 0x9E, 0xB5, 0xC7, 0x1E, 0x3D, 0x3F, 0x78, 0x0C, 0x17, 0x76, 0xE8,
+    0x91, 0xAE, 0x20, 0x35, 0x8F, 0xB4, 0x78, 0x66, 0x5C, 0xA4, 0xC3, 0xE4, 0xA7, 0x1A, 0xF1, 0xFD,
+    0x06, 0x48, 0xD7, 0x57, 0xCB, 0x29, 0x8A, 0x77, 0x06, 0x14, 0x8D, 0xCF, 0xE9, 0xA1, 0x86, 0x7F,
+    0xB7, 0x83, 0xAD, 0x06, 0x84, 0x1D, 0xBD, 0xEC, 0x24, 0xBC, 0x72, 0xB3, 0x84, 0x79, 0x5C, 0x01,
+    0x23, 0xAF, 0x79, 0x3E, 0x56, 0xBD, 0x32, 0xEE, 0xA0, 0xE7, 0xED, 0x1E, 0xE6, 0x7A, 0x8F, 0x40,
+    0xF8, 0x9E, 0x71, 0x2D, 0xAE, 0x4F, 0xAC, 0x06, 0xF5, 0x5B, 0x40, 0x11, 0x37, 0xF0, 0x0F, 0x7A,
+    0xD8, 0x9A, 0xB8, 0x56, 0xAF, 0x4E, 0x5B, 0xC1, 0x7C, 0xEB, 0xDC, 0xB6, 0x17, 0x23, 0xF7, 0xA5,
+    0x4A, 0x3A, 0x46, 0xD9, 0xC3, 0xA7, 0x2E, 0x35, 0x9D, 0x69, 0x88, 0x30, 0x8D, 0xF5, 0xF4, 0x6A,
+    0x1F, 0xD0, 0xD3, 0x82, 0xC8, 0x46, 0x13, 0x9A, 0xFC, 0x30, 0xEA, 0xCE, 0xA5, 0x08, 0x23, 0xFA,
+    0x50, 0x7F, 0x76, 0xE4, 0x42, 0x91, 0x9E, 0xE4, 0x37, 0x0B, 0x79, 0xE8, 0xB0, 0x86, 0xF9, 0xA3,
+    0x23, 0x18, 0x0C, 0x46, 0x9F, 0x4F, 0x36, 0x56, 0xDB, 0xEB, 0x70, 0x55, 0x96, 0x3A, 0xCD, 0xB1,
+    0x30, 0x9A, 0xE3, 0x82, 0x5C, 0x12, 0xFA, 0x85, 0xC2, 0x7A, 0xA3, 0x42, 0xF4, 0x90, 0x4E, 0x7A,
+    0xE6, 0xE6, 0xE9, 0xD5, 0xD2, 0xBE, 0x61, 0xC8, 0x50, 0x1F, 0x99, 0x22, 0x0C, 0xD4, 0x99, 0x4A,
+    0x83, 0xB4, 0x72, 0x2D, 0xEC, 0x4E, 0xDC, 0x7E, 0x9A, 0xF0, 0xF8, 0x03, 0xDE, 0xEB, 0x79, 0x66,
+    0x16, 0xAC, 0x78, 0x9C, 0x91, 0xC7, 0x56, 0x46, 0x37, 0xC4, 0xE4, 0x91, 0x79, 0xD9, 0x86, 0x09,
+    0x8C, 0x64, 0xD2, 0xD6, 0x51, 0xC7, 0x97, 0x2C, 0xB5, 0x2D, 0xC1, 0x11, 0x11, 0x52, 0x48, 0xBA,
+    0x66, 0x5F, 0xAB, 0x3B, 0x57, 0x1E, 0x27, 0xAA, 0x8C, 0xF2, 0x1C, 0xD3, 0xA7, 0x65, 0x91, 0xA5,
+    0xAB, 0x6B, 0x0E, 0xE6, 0x09, 0xC1, 0xFC, 0xB1, 0xA6, 0x2A, 0x57, 0x23, 0x1A, 0x48, 0x55, 0x6B,
+    0x2B, 0x5B, 0x66, 0xF0, 0x61, 0x1F, 0x74, 0x74, 0x50, 0x67, 0x69, 0x72, 0x44, 0x58, 0xA5, 0xC1,
+    0xEB, 0x94, 0x2B, 0xC6, 0x0B, 0x74, 0x52, 0x4E, 0x88, 0xB9, 0x6A, 0xBA, 0x35, 0x9F, 0xCF, 0x99,
+    0x8C, 0x94, 0xB1, 0xF0, 0x4C, 0xA1, 0x14, 0x94, 0x97, 0xC9, 0x92, 0x4D, 0xA3, 0xD6, 0x50, 0x08,
+    0x8A, 0xEC, 0x71, 0x14, 0xC4, 0x0B, 0x11, 0x83, 0x98, 0x16, 0x27, 0xB1, 0xA9, 0xB4, 0x6B, 0xC5,
+    0xA2, 0x84, 0x53, 0xA1, 0xA9, 0xF2, 0xA0, 0xBB, 0x97, 0xF9, 0x50, 0x64, 0x30, 0xE5, 0x8A, 0x12,
+    0x30, 0x7B, 0x91, 0x1B, 0xD5, 0xE2, 0x25, 0x22, 0xE6, 0xAA, 0x68, 0x04, 0x39, 0x6F, 0x99, 0x7E,
+    0xD4, 0xC4, 0xEE, 0x5E, 0xEF, 0xA5, 0xCE, 0x7E, 0xCB, 0x71, 0x11, 0xB8, 0x03, 0x53, 0xE3, 0xE3,
+    0x34, 0xF8, 0x97, 0x66, 0x93, 0xF7, 0xD4, 0x8C, 0x69, 0x15, 0x17, 0x78, 0xAB, 0x1F, 0x41, 0xBA,
+    0x75, 0xB2, 0x3D, 0xDF, 0xD6, 0x22, 0x4D, 0xA4, 0x0E, 0x59, 0xB3, 0x45, 0x8B, 0x37, 0x24, 0xD5,
+    0x10, 0x19, 0x32, 0x03, 0x24, 0xC1, 0x86, 0xA6, 0xB2, 0x9C, 0x38, 0x6B, 0xF4, 0x44, 0x5A, 0x13,
+    0x2A, 0xC6, 0xD4, 0x36, 0xAC, 0x90, 0x51, 0x79, 0x1D, 0x2C, 0xEB, 0x9A, 0x45, 0xEA, 0x0F, 0x7B,
+    0x26, 0x67, 0x7A, 0x62, 0xEF, 0x4B, 0xBF, 0x4B, 0x45, 0x77, 0x51, 0x4B, 0x1B, 0xD9, 0xE7, 0x42,
+    0x06, 0x08, 0xD2, 0xAE, 0x34, 0x84, 0x69, 0xAF, 0x90, 0x67, 0xEB, 0xC9, 0xB0, 0xF8, 0xE1, 0x6E,
+    0x11, 0x80, 0x03, 0x8F, 0xA7, 0x15, 0x15, 0xF0, 0x89, 0x19, 0x73, 0xCF, 0xEA, 0x8C, 0x1A, 0x6D,
+    0x14, 0x25, 0xB7, 0xC7, 0xA0, 0xDB, 0x32, 0xAD, 0x95, 0xCE, 0x96, 0xFE, 0xA8, 0xCD, 0xD0, 0xC7,
+    0x0F, 0xBB, 0xA8, 0x4E, 0x6E, 0x55, 0x49, 0x7E, 0xE0, 0xD7, 0xB2, 0xA8, 0x91, 0x46, 0x84, 0x5A,
+    0x97, 0xDA, 0x1E, 0x43, 0x70, 0x0A, 0x43, 0xE1, 0x94, 0xE9, 0x4C, 0xB6, 0x29, 0x0F, 0x59, 0x92,
+    0x71, 0x0A, 0x43, 0x2A, 0xD5, 0x37, 0x35, 0x28, 0xAE, 0x7E, 0x49, 0xF6, 0x7D, 0xBD, 0x24, 0xF5,
+    0x84, 0xA1, 0xEB, 0x22, 0x37, 0xF7, 0x16, 0x6B, 0x61, 0x77, 0x36, 0x29, 0xDD, 0x00, 0xC9, 0x93,
+    0x1E, 0xC3, 0x46, 0xD4, 0x44, 0xEE, 0xDE, 0xC2, 0x4B, 0x97, 0xFD, 0x5D, 0x2B, 0xAB, 0x97, 0xF0,
+    0x43, 0x13, 0x0A, 0xC2, 0x3D, 0x85, 0x7E, 0xA6, 0xB1, 0xB1, 0xD3, 0xC4, 0x23, 0xDB, 0x14, 0x31,
+    0x66, 0x86, 0xB6, 0xD1, 0x3E, 0xA6, 0xCD, 0x0C, 0xFE, 0x88, 0x53, 0xAC, 0xED, 0x0E, 0xD3, 0xE4,
+    0x55, 0x73, 0x7E, 0xAA, 0x5F, 0xAD, 0x66, 0xB7, 0x49, 0x36, 0xDC, 0x67, 0x83, 0x76, 0x48, 0xD2,
+    0x95, 0x94, 0x51, 0x83, 0x6C, 0xD0, 0xE2, 0x90, 0x54, 0xD5, 0x0A, 0xAD, 0xF0, 0x40, 0x55, 0x15,
+    0x3C, 0x99, 0x94, 0xA8, 0x0A, 0xB0, 0x4F, 0x2B, 0x0E, 0xEB, 0xE1, 0x10, 0xF6, 0xB1, 0xC4, 0xC3,
+    0x2C, 0xBB, 0xFA, 0x2D, 0xFC, 0x01, 0x0D, 0x75, 0x1A, 0x00, 0x26, 0x9E, 0x15, 0x40, 0x75, 0x76,
+    0x40, 0xC8, 0x5A, 0x1A, 0x65, 0xDD, 0xB2, 0x7F, 0xAA, 0x5F, 0x85, 0x25, 0xC7, 0x6B, 0x6C, 0x2F,
+    0x3B, 0x14, 0x43, 0xC6, 0x33, 0x14, 0xC0, 0x7F, 0xCB, 0x66, 0x6A, 0xDE, 0x85, 0x70, 0x76, 0x22,
+    0x0A, 0x62, 0x37, 0x65, 0xA3, 0xD3, 0x66, 0xAD, 0xD9, 0xF4, 0x53, 0x36, 0x39, 0x27, 0x76, 0xB4,
+    0x6C, 0xA0, 0x35, 0x2F, 0xEF, 0x93, 0xB9, 0xE7, 0xC2, 0x75, 0x07, 0xCB, 0x64, 0xAE, 0x3E, 0x49,
+    0x8D, 0x9A, 0x4A, 0xDA, 0xA5, 0xB5, 0x65, 0xB8, 0xB7, 0x7D, 0x5D, 0x50, 0x7C, 0x13, 0x62, 0x38,
+    0xF3, 0xE1, 0x6A, 0x50, 0x6D, 0xAF, 0xB8, 0xBC, 0xF1, 0x77, 0xBF, 0x78, 0x19, 0x7B, 0x2F, 0xFC,
+    0x9B, 0x80, 0xA9, 0xB0, 0x31, 0xFF, 0xE0, 0xD1, 0x77, 0xE5, 0xF9, 0xF2, 0xAB, 0xBB, 0x79, 0x89,
+    0xD3, 0x7E, 0xDA, 0xA7, 0x22, 0x9C, 0xC7, 0xF7, 0xF3, 0xBF, 0xBE, 0x79, 0xDB, 0x9C, 0x35, 0xE1,
+    0x15, 0x98, 0x53, 0x7F, 0x41, 0x31, 0xC8, 0x28, 0xC3, 0x72, 0x3E, 0x37, 0x9F, 0x6F, 0x8A, 0x3C,
+    0x16, 0xE9, 0xF7, 0xF7, 0xF7, 0xA9, 0xD2, 0x23, 0x91, 0x76, 0x7F, 0x1A, 0xC4, 0xE8, 0x64, 0xF4,
+    0x2F, 0x58, 0xDA, 0x9E, 0xF9, 0xF8, 0xE7, 0xC3, 0x3F, 0x9B, 0x83, 0xDE, 0x65, 0xFF, 0xE7, 0xE5,
+    0xA3, 0x33, 0x6C, 0x24, 0x42, 0x57, 0x8F, 0xF6, 0xF7, 0x6F, 0xAB, 0xB0, 0x9E, 0x7E, 0xA4, 0xD7,
+    0xEC, 0x6E, 0xB3, 0x13, 0x57, 0x63, 0x5C, 0x69, 0x8B, 0x28, 0xA2, 0x26, 0x8B, 0xAB, 0xDE, 0x99,
+    0x09, 0xC3, 0xDE, 0x56, 0xBD, 0x3D, 0x6C, 0x2F, 0xC7, 0xE5, 0x3A, 0xD6, 0x4C, 0x5B, 0xC4, 0x75,
+    0x16, 0x36, 0x36, 0xBF, 0x16, 0xE4, 0x78, 0x7E, 0xFC, 0x03, 0x8D, 0x55, 0x31, 0x6F, 0x1C, 0x45,
+    0x14, 0x7E, 0xB3, 0x73, 0xCE, 0x46, 0xDE, 0x88, 0xB9, 0x22, 0x2E, 0x02, 0x16, 0xDB, 0xA4, 0x48,
+    0xA4, 0x90, 0x4D, 0x91, 0x22, 0x45, 0x6E, 0x67, 0x9D, 0x2B, 0x5C, 0xA4, 0xB0, 0x91, 0xB0, 0xE8,
+    0x42, 0x90, 0x28, 0x12, 0x51, 0x24, 0x12, 0x29, 0x2F, 0xB7, 0x4B, 0x90, 0xB0, 0x90, 0x0B, 0x22,
+    0x7E, 0x41, 0x24, 0x52, 0x20, 0x37, 0x50, 0x10, 0x29, 0xC5, 0x9D, 0x6F, 0x1C, 0x17, 0x91, 0xA8,
+    0x36, 0x72, 0x91, 0x32, 0x23, 0xE8, 0xE2, 0x82, 0x01, 0x56, 0x30, 0xE0, 0xD9, 0x1B, 0xBE, 0xB9,
+    0x4B, 0x04, 0x05, 0x4A, 0x98, 0xF3, 0x79, 0x76, 0x6F, 0xDE, 0x7B, 0xF3, 0xDE, 0xFB, 0xBE, 0x6F,
+    0x86, 0x8A, 0x6E, 0xCA, 0x6B, 0x2B, 0xC5, 0x23, 0x33, 0x14, 0x8F, 0x9A, 0xA1, 0xF8, 0xD1, 0x65,
+    0xAB, 0x9A, 0x66, 0x23, 0xD6, 0x2E, 0x36, 0x8E, 0x1B, 0x17, 0xD7, 0x16, 0xEB, 0x69, 0x5F, 0xF7,
+    0x44, 0xD5, 0x5D, 0x08, 0x4B, 0x52, 0xA8, 0x56, 0xF6, 0x8D, 0x13, 0x7B, 0x66, 0x9C, 0xF5, 0xB5,
+    0xCD, 0x12, 0xD5, 0xED, 0x50, 0x87, 0x51, 0x2B, 0x2F, 0xFF, 0xEA, 0xB2, 0x2D, 0x5D, 0xA6, 0x6A,
+    0x94, 0x91, 0xCD, 0x99, 0x19, 0xB0, 0xEA, 0x2A, 0x9D, 0x20, 0x72, 0xC4, 0x35, 0x09, 0xA2, 0x41,
+    0xE4, 0xC3, 0xB8, 0x7B, 0xB1, 0x43, 0x86, 0x62, 0x45, 0x67, 0x89, 0x2C, 0xF1, 0x9A, 0xD2, 0x22,
+    0x98, 0x98, 0xD9, 0xCE, 0xEC, 0x6E, 0xB0, 0xA7, 0x9C, 0x82, 0x43, 0xAC, 0xE0, 0x61, 0xBC, 0xB7,
+    0xDD, 0x5E, 0x87, 0x44, 0x41, 0x89, 0x9A, 0x99, 0x59, 0x3A, 0x7D, 0xFB, 0xBA, 0xF0, 0x7E, 0xF5,
+    0xE0, 0x40, 0x45, 0x3A, 0xBC, 0x07, 0xFB, 0xAC, 0x9A, 0xE7, 0x2E, 0xF7, 0xFC, 0x5A, 0x2B, 0x4D,
+    0x59, 0x10, 0x9D, 0xA4, 0xB4, 0x8E, 0xFD, 0x8A, 0x6F, 0x4B, 0xFF, 0xCC, 0x6F, 0x4E, 0x99, 0xA5,
+    0x2E, 0xD1, 0x89, 0xF4, 0xA0, 0x9D, 0x76, 0x90, 0xD7, 0xBB, 0x4E, 0x3C, 0x33, 0x93, 0x1B, 0x77,
+    0x5C, 0x97, 0x15, 0x27, 0x68, 0x81, 0x16, 0x52, 0x25, 0x6A, 0xF1, 0xB3, 0x49, 0x1A, 0x7E, 0x68,
+    0x99, 0x23, 0xD7, 0xA5, 0xE3, 0xD4, 0xA1, 0xEC, 0x83, 0x43, 0xD7, 0xCE, 0x22, 0xD7, 0x74, 0xA1,
+    0xB8, 0x52, 0x7F, 0xAB, 0x96, 0xD5, 0xBD, 0xDD, 0x4A, 0xD1, 0xAB, 0x3E, 0x45, 0x68, 0x22, 0x2D,
+    0xD3, 0x03, 0xF6, 0x57, 0x7C, 0x9E, 0x2F, 0xF2, 0xA8, 0x4F, 0xFC, 0x95, 0x1F, 0x46, 0x14, 0x55,
+    0x89, 0x3E, 0xFD, 0xCD, 0x87, 0x5F, 0xB0, 0xEA, 0xF5, 0x1F, 0x34, 0xAA, 0x43, 0x8B, 0xE7, 0x69,
+    0xF1, 0xC2, 0xD2, 0x95, 0x53, 0xCF, 0x47, 0x9F, 0xB0, 0xC7, 0xC7, 0x96, 0x6F, 0x9E, 0xFB, 0x1C,
+    0x3B, 0x73, 0xA2, 0x63, 0x44, 0xE7, 0xE8, 0x35, 0x8F, 0x68, 0x04, 0x6A, 0x5B, 0xBE, 0x17, 0xFD,
+    0x40, 0x67, 0x1E, 0xBC, 0xB7, 0xFF, 0xFC, 0xBB, 0xFD, 0x42, 0x7D, 0xDD, 0xA7, 0xAF, 0xFE, 0x8F,
+    0xEF, 0xCB, 0xC7, 0x0E, 0xBD, 0x1C, 0xC8, 0xFE, 0x4C, 0x98, 0x33, 0x4B, 0x69, 0x80, 0x41, 0x4E,
+    0x0A, 0xA1, 0xC2, 0xFB, 0xAA, 0x4E, 0xC2, 0x2C, 0x94, 0x8D, 0xEB, 0xD0, 0x92, 0x3A, 0xE7, 0x81,
+    0x62, 0x51, 0x93, 0xF6, 0x67, 0x78, 0x8F, 0xC4, 0xEE, 0x6C, 0x86, 0x61, 0x93, 0x69, 0x9A, 0xAC,
+    0x1E, 0x1A, 0x2B, 0xA7, 0xCC, 0x37, 0xA5, 0x1E, 0x49, 0xB1, 0x6B, 0x4B, 0xB0, 0x26, 0xBD, 0xD4,
+    0x38, 0x44, 0xEB, 0x09, 0x35, 0xCA, 0x01, 0xBF, 0xE4, 0x46, 0xA6, 0x85, 0x25, 0x70, 0x4C, 0x6C,
+    0xD5, 0x63, 0xB0, 0x47, 0x26, 0x4F, 0x1A, 0x89, 0x3D, 0xC4, 0x81, 0x2E, 0x4B, 0xCC, 0xCC, 0xEB,
+    0xC4, 0x53, 0x54, 0xD3, 0x91, 0x82, 0x96, 0xE6, 0xA5, 0xCE, 0x47, 0x2F, 0x36, 0x3B, 0xE2, 0x91,
+    0x95, 0x5C, 0x1D, 0x0F, 0xAF, 0xA2, 0xAF, 0xCA, 0xF4, 0x8E, 0x6D, 0xC5, 0x63, 0xB3, 0x93, 0x05,
+    0x4A, 0xC7, 0xEA, 0xF8, 0xC2, 0xDC, 0xB2, 0x79, 0x9B, 0xAB, 0x52, 0x3C, 0xB1, 0xD9, 0xA6, 0x69,
+    0xE1, 0x51, 0x26, 0xDA, 0xC1, 0x62, 0x2C, 0x94, 0x39, 0x0B, 0xA3, 0x88, 0xD6, 0x51, 0x43, 0x3D,
+    0xE4, 0x26, 0xAB, 0x5C, 0x52, 0xE7, 0x14, 0x6A, 0x7E, 0x27, 0xAE, 0x86, 0x42, 0xC9, 0x44, 0xC3,
+    0x07, 0x7A, 0x4A, 0x6A, 0xC7, 0xF5, 0x80, 0xAA, 0xD9, 0x4E, 0xC9, 0x8A, 0xBE, 0x08, 0x4D, 0xC1,
+    0x1A, 0x8B, 0x21, 0x26, 0x37, 0xE3, 0x54, 0x8D, 0x61, 0x26, 0x3E, 0x35, 0x3D, 0x18, 0xA1, 0x81,
+    0x57, 0xA1, 0x3A, 0x2A, 0x75, 0xFC, 0x93, 0x1E, 0xF2, 0x17, 0x32, 0x4C, 0x2A, 0xA1, 0xD3, 0x3A,
+    0xAD, 0x85, 0xE6, 0x8E, 0x64, 0x11, 0x1B, 0xEA, 0xCD, 0xE5, 0xA9, 0x62, 0x13, 0x39, 0xF2, 0x34,
+    0x61, 0x6D, 0xDC, 0xA4, 0x2A, 0x7F, 0x51, 0xDF, 0x4D, 0xC0, 0x30, 0x88, 0xD5, 0x20, 0x4B, 0x9E,
+    0x98, 0x64, 0x6F, 0x53, 0x45, 0x26, 0x25, 0x7A, 0xD8, 0xA3, 0xA3, 0x79, 0xB3, 0x2E, 0x51, 0x4D,
+    0xF8, 0x76, 0xF0, 0x4C, 0xB6, 0x47, 0x91, 0x16, 0x45, 0xF2, 0x78, 0x53, 0x05, 0xDB, 0xE0, 0x03,
+    0xDF, 0x53, 0xB3, 0x20, 0xD7, 0xD8, 0xBD, 0xD8, 0x64, 0x4A, 0x56, 0x53, 0x04, 0x37, 0xE1, 0x31,
+    0xAB, 0xA6, 0x84, 0x8C, 0xB9, 0x41, 0x8B, 0xD5, 0x90, 0x72, 0xD6, 0xB0, 0x06, 0x29, 0xA8, 0x0C,
+    0x18, 0x3C, 0xA4, 0xEF, 0x79, 0x3D, 0xA7, 0x40, 0x87, 0x4A, 0x66, 0x23, 0x27, 0x74, 0x52, 0xCB,
+    0xA2, 0x83, 0xB6, 0x43, 0xEB, 0xA5, 0xF7, 0xCF, 0xB7, 0xB7, 0xEF, 0x4F, 0x9E, 0xB5, 0x5E, 0xBD,
+    0x48, 0x32, 0x86, 0x36, 0x82, 0x8A, 0xA3, 0x06, 0x4E, 0xF8, 0x06, 0xF9, 0x06, 0xC9, 0xD3, 0x20,
+    0x20, 0x44, 0x33, 0x2D, 0x23, 0x30, 0x51, 0x1A, 0x20, 0x2A, 0x02, 0x79, 0x28, 0x28, 0x9F, 0x02,
+    0x83, 0x42, 0x67, 0x5E, 0x3A, 0x63, 0xEF, 0x7F, 0x0D, 0xE6, 0x49, 0xEA, 0xD2, 0x09, 0xBF, 0xE5,
+    0xB5, 0x77, 0xB7, 0xE4, 0x1B, 0x49, 0x0D, 0xC3, 0xDB, 0x88, 0x18, 0xB2, 0x8E, 0x1A, 0xBC, 0x8C,
+    0x21, 0xEA, 0xAC, 0xC8, 0x11, 0x0C, 0xE1, 0x2C, 0x79, 0x95, 0xDA, 0x18, 0xD3, 0xDC, 0xBF, 0x40,
+    0xC2, 0xC3, 0x60, 0xAB, 0x61, 0xD5, 0x82, 0xC6, 0x80, 0x64, 0x7D, 0xD6, 0x8F, 0xD4, 0x30, 0x57,
+    0x3A, 0x6E, 0x27, 0x53, 0xDE, 0xDC, 0x92, 0x00, 0x01, 0x18, 0x83, 0x8D, 0x35, 0x81, 0x95, 0xA1,
+    0x27, 0x38, 0x36, 0xAA, 0x1C, 0x34, 0x1C, 0x21, 0x63, 0xC4, 0xA4, 0xB2, 0x3A, 0x3B, 0x8B, 0x88,
+    0x53, 0x11, 0x11, 0x4B, 0x9A, 0xD2, 0x04, 0x01, 0xC7, 0x88, 0x0F, 0x26, 0x5E, 0xC3, 0x42, 0x19,
+    0xB7, 0x24, 0x3F, 0xF3, 0x00, 0xD6, 0xE3, 0x98, 0x3D, 0x2F, 0x23, 0x8B, 0x94, 0x5A, 0xD4, 0x25,
+    0x29, 0x32, 0x21, 0x26, 0xD7, 0xDC, 0xB0, 0x90, 0xF1, 0x00, 0x0D, 0xCA, 0x40, 0x8A, 0xA4, 0x10,
+    0x73, 0x4A, 0x84, 0x18, 0x25, 0x49, 0x02, 0x28, 0x2A, 0xA9, 0x91, 0x47, 0x11, 0x8E, 0x1A, 0xFC,
+    0x49, 0x1B, 0xED, 0xFB, 0xE9, 0xE4, 0xC6, 0x25, 0x6F, 0x4F, 0xD2, 0x4E, 0xF1, 0x4F, 0x5F, 0x04,
+    0xA8, 0x97, 0x54, 0x81, 0xCB, 0xD8, 0x07, 0x93, 0x0B, 0x74, 0x16, 0x35, 0x74, 0xD0, 0x40, 0x49,
+    0x33, 0x0A, 0x46, 0x7A, 0x20, 0xAA, 0x40, 0xEA, 0xA3, 0x38, 0x1D, 0x29, 0xF6, 0xD5, 0xB0, 0xC4,
+    0x4A, 0xB6, 0xD2, 0xB8, 0x78, 0x5F, 0x67, 0x69, 0xE5, 0x86, 0x71, 0xED, 0x64, 0xE4, 0x4D, 0x14,
+    0xCE, 0xC1, 0xF5, 0x00, 0xC8, 0x94, 0x84, 0xA5, 0x3F, 0x6A, 0xB1, 0x46, 0xCD, 0x40, 0x3C, 0x6D,
+    0x4A, 0x6F, 0x36, 0x76, 0x0A, 0x86, 0x53, 0xBD, 0xA2, 0xA5, 0x75, 0x8E, 0xD2, 0xB6, 0x81, 0x0E,
+    0xB7, 0x24, 0x5A, 0x42, 0x3B, 0x23, 0x13, 0x54, 0xD9, 0xE2, 0x77, 0x61, 0x67, 0x49, 0x2D, 0x54,
+    0x89, 0xE7, 0x7F, 0x02, 0xF5, 0xEC, 0x6E, 0xEC, 0xF5, 0xF8, 0xC6, 0x5A, 0x65, 0x21, 0xE6, 0xDD,
+    0xA6, 0x44, 0xAF, 0x8A, 0xA5, 0x0D, 0xE1, 0x0F, 0x0F, 0x0E, 0x95, 0x5B, 0x1F, 0x01, 0xBF, 0x3C,
+    0x54, 0x8B, 0xD3, 0x24, 0xAE, 0xD9, 0xFC, 0x86, 0x78, 0xB3, 0x40, 0x86, 0x79, 0x16, 0x81, 0xB5,
+    0xFB, 0x3A, 0x69, 0xA9, 0x6C, 0xE2, 0x3D, 0x93, 0xE3, 0xA2, 0xCA, 0x22, 0xDF, 0x44, 0xD3, 0x50,
+    0x02, 0xD4, 0x3F, 0x2E, 0xA1, 0x3E, 0xB1, 0x62, 0xF2, 0x44, 0x4D, 0xA0, 0x93, 0x06, 0x80, 0x46,
+    0x0E, 0x8E, 0xE8, 0xE3, 0x02, 0x2B, 0xDA, 0x09, 0x1D, 0x8E, 0xF8, 0x2F, 0x46, 0x6C, 0x55, 0x83,
+    0x5E, 0xA4, 0x7F, 0x17, 0xAB, 0xEE, 0xA2, 0x98, 0xDD, 0x1F, 0x65, 0x25, 0xBC, 0x1A, 0xCB, 0x55,
+    0x7D, 0x3B, 0x63, 0x8D, 0x4B, 0xF6, 0xB5, 0x4C, 0x2B, 0x8B, 0x20, 0xD3, 0x1D, 0xE6, 0x6B, 0xFA,
+    0x28, 0x98, 0x0C, 0x84, 0x5B, 0x74, 0xE0, 0x0F, 0x54, 0x10, 0x99, 0x00, 0xD6, 0x5B, 0x4D, 0xE9,
+    0x96, 0xD6, 0x69, 0x12, 0x5C, 0x5D, 0x16, 0xA9, 0x51, 0x50, 0xF2, 0x30, 0xFC, 0x1B, 0x87, 0x5E,
+    0x79, 0xDF, 0xF7, 0x8E, 0x36, 0x88, 0x4D, 0xB9, 0xD7, 0xC6, 0x75, 0x73, 0xE8, 0xC4, 0x17, 0x1F,
+    0x03, 0x5D, 0x92, 0x4B, 0x93, 0x35, 0xBF, 0x72, 0x1F, 0xEC, 0x35, 0x80, 0x14, 0xC9, 0x67, 0x0D,
+    0xFB, 0x4D, 0xA5, 0x29, 0x33, 0xA3, 0xD4, 0xB7, 0xD2, 0x07, 0x1B, 0x2C, 0xB1, 0x82, 0xB6, 0xEF,
+    0x73, 0xAF, 0xB2, 0x8D, 0x70, 0x61, 0x4E, 0xE9, 0xC8, 0x34, 0x28, 0x06, 0x5D, 0x4D, 0xAB, 0xF7,
+    0x1D, 0xF7, 0xD5, 0x11, 0x5C, 0x9A, 0xA9, 0x4E, 0xA7, 0x49, 0x83, 0x2B, 0x4E, 0xDA, 0xD8, 0xC3,
+    0xFD, 0xCB, 0xCA, 0x3A, 0x71, 0xF9, 0xA9, 0x91, 0x8E, 0xAE, 0xD3, 0x7F, 0x8D, 0xBF, 0x01, 0x75,
+    0x55, 0xBF, 0x6F, 0xDD, 0x54, 0x14, 0x3E, 0xF6, 0x25, 0x31, 0x60, 0xAA, 0x9B, 0x81, 0x0A, 0xA1,
+    0xA2, 0x9A, 0x19, 0xA9, 0xF5, 0xC2, 0xC0, 0xD0, 0xE6, 0xBA, 0x08, 0xE6, 0x56, 0x90, 0xD7, 0x4A,
+    0x30, 0x94, 0xFF, 0x20, 0x0B, 0x03, 0x43, 0x1B, 0x9B, 0x76, 0xE8, 0xD0, 0x81, 0x0A, 0x89, 0x89,
+    0xA1, 0x1D, 0xBA, 0xD4, 0x6F, 0x88, 0x90, 0x18, 0x3A, 0xA4, 0xB1, 0x4B, 0x85, 0x3A, 0xE6, 0x89,
+    0x50, 0x3A, 0x74, 0x71, 0x23, 0xCA, 0x00, 0x43, 0x6F, 0x89, 0xA1, 0x4E, 0x72, 0xDF, 0x3D, 0x7C,
+    0xC7, 0x7E, 0x44, 0x01, 0xC4, 0x95, 0xAE, 0xEC, 0xFB, 0xE3, 0xFC, 0xFA, 0xCE, 0x77, 0xCE, 0x7D,
+    0xAB, 0x3C, 0xCF, 0x7B, 0x97, 0xFE, 0xAC, 0x3B, 0xEA, 0x68, 0x8D, 0x2E, 0xD2, 0x22, 0x19, 0x4A,
+    0x8A, 0xB8, 0xA6, 0x6B, 0x44, 0x79, 0x11, 0x3F, 0xAD, 0x2F, 0x24, 0xA1, 0x5D, 0x53, 0x7B, 0x75,
+    0xEC, 0x68, 0xC7, 0xC5, 0xDF, 0xB5, 0x8B, 0xD1, 0x64, 0x9A, 0x07, 0xDC, 0xD0, 0x12, 0x51, 0x95,
+    0x69, 0x2E, 0x5C, 0xAA, 0x26, 0x17, 0xF4, 0x29, 0x6B, 0x3E, 0xAE, 0x73, 0x4F, 0xAF, 0x59, 0x4A,
+    0xB3, 0x23, 0x6D, 0xE4, 0x69, 0x2E, 0xA3, 0x7E, 0x24, 0xCC, 0x4D, 0xCC, 0xDC, 0x91, 0x79, 0x70,
+    0x91, 0x74, 0xA3, 0x49, 0xB5, 0xAA, 0x08, 0x1C, 0x4E, 0x2A, 0x4C, 0xC3, 0x96, 0x34, 0x0E, 0xA3,
+    0x9D, 0x25, 0x0A, 0xB1, 0x39, 0xCF, 0x37, 0x29, 0x64, 0x4F, 0xA4, 0x27, 0x44, 0x51, 0x2B, 0xE2,
+    0x0D, 0x2E, 0xB4, 0xBD, 0x2A, 0x68, 0x8C, 0x38, 0xA3, 0x18, 0x32, 0x91, 0x9D, 0x92, 0xB2, 0x49,
+    0x16, 0x76, 0x51, 0x46, 0x53, 0xC8, 0x55, 0x1F, 0x65, 0x8A, 0xB9, 0xA6, 0xF3, 0x4F, 0xCE, 0xD0,
+    0xB9, 0x3F, 0x96, 0xA0, 0xD8, 0xD1, 0xBC, 0xBF, 0x05, 0x0B, 0xE2, 0x43, 0x4D, 0xC4, 0xBB, 0x63,
+    0x9B, 0xC3, 0x8F, 0xE4, 0x71, 0xE5, 0x82, 0xC1, 0xB7, 0xA5, 0xC1, 0xC3, 0x74, 0xA6, 0xDE, 0x30,
+    0x17, 0xF2, 0x7D, 0x89, 0x93, 0xD9, 0xC6, 0xE7, 0xBE, 0xFF, 0xEA, 0x89, 0x29, 0x64, 0x27, 0xB2,
+    0xBA, 0x59, 0xC3, 0x37, 0x74, 0x51, 0x6B, 0xCE, 0x84, 0x37, 0x88, 0x95, 0x63, 0x1F, 0x33, 0x99,
+    0x47, 0x2E, 0xDD, 0x8D, 0x7E, 0xAA, 0x11, 0x89, 0x6A, 0x43, 0x78, 0xC7, 0xD7, 0xC8, 0x01, 0x1E,
+    0x89, 0xC8, 0x90, 0x6E, 0x89, 0x7B, 0x1F, 0xAA, 0xCC, 0x14, 0x14, 0x37, 0xEF, 0xC5, 0x4D, 0xD2,
+    0x90, 0xDA, 0xD9, 0xBE, 0xDB, 0x1A, 0x84, 0xC3, 0x3B, 0xEC, 0x52, 0x9E, 0x50, 0xD2, 0x26, 0x1D,
+    0x1D, 0x18, 0x67, 0x60, 0x08, 0xC8, 0x04, 0x12, 0x55, 0xFE, 0xF3, 0x1A, 0x25, 0x4D, 0x5C, 0xA8,
+    0x8E, 0x6E, 0x50, 0x2E, 0xD8, 0x21, 0x3C, 0x2D, 0xFE, 0x4A, 0x68, 0x29, 0x33, 0x21, 0xF8, 0x86,
+    0x7A, 0x58, 0x13, 0x20, 0x47, 0x9C, 0xCD, 0x01, 0xA7, 0x71, 0x83, 0x33, 0xEC, 0xE5, 0xFE, 0x80,
+    0xDE, 0x43, 0x12, 0x51, 0x3D, 0x20, 0xDC, 0x7F, 0x99, 0xF9, 0x1E, 0xA6, 0xAD, 0xCA, 0xD2, 0xC5,
+    0x22, 0xBC, 0x8E, 0x09, 0x0A, 0x10, 0x09, 0x1C, 0x2F, 0xF6, 0xB7, 0xB4, 0x98, 0xAB, 0x93, 0x6A,
+    0x1A, 0x6F, 0x6C, 0x14, 0x9B, 0xCF, 0x6A, 0xEA, 0x23, 0x93, 0x13, 0x65, 0xE9, 0x3F, 0x8B, 0xFD,
+    0x11, 0x40, 0xCB, 0xE0, 0x94, 0xA8, 0x73, 0xFB, 0xA6, 0x7C, 0x39, 0x46, 0xAC, 0xE1, 0x6C, 0x52,
+    0x37, 0xD8, 0x79, 0xFD, 0x7F, 0x15, 0x0E, 0x8B, 0xCD, 0xDF, 0x6B, 0x37, 0x85, 0x12, 0x47, 0x12,
+    0xBD, 0x1B, 0xE4, 0x30, 0xDE, 0x0C, 0x89, 0x16, 0x01, 0xBB, 0xC9, 0x72, 0x10, 0x58, 0x59, 0x24,
+    0x92, 0x41, 0x3B, 0xFE, 0x61, 0xB7, 0x5C, 0x6D, 0xD2, 0x2C, 0x6A, 0x54, 0x17, 0x5B, 0x3A, 0x19,
+    0x58, 0x0A, 0x68, 0x81, 0xE8, 0x53, 0x21, 0x56, 0xDE, 0x46, 0xDC, 0xAE, 0xF8, 0x76, 0x7B, 0xBB,
+    0x86, 0x66, 0x23, 0x56, 0x94, 0x0D, 0x4E, 0x7F, 0x9F, 0x98, 0x93, 0xE0, 0xA4, 0x41, 0x4E, 0xAD,
+    0xEC, 0x2E, 0xF4, 0x06, 0xE2, 0x62, 0x06, 0x00, 0x6C, 0x47, 0x1B, 0x1B, 0xD9, 0x87, 0xCF, 0xB2,
+    0xC1, 0x2B, 0x08, 0x04, 0xDB, 0xDB, 0x13, 0x48, 0x28, 0x90, 0x12, 0x22, 0x61, 0x43, 0xCC, 0x0E,
+    0x0E, 0x68, 0x49, 0x1B, 0x06, 0x02, 0x18, 0xF4, 0x77, 0xA4, 0xC0, 0xE4, 0xE2, 0x9D, 0xC5, 0xB0,
+    0xEB, 0xD2, 0xCB, 0x5B, 0xAD, 0x5E, 0x65, 0x0F, 0x3A, 0xFA, 0xF2, 0x9A, 0xA3, 0x60, 0x4A, 0x41,
+    0x4B, 0x3D, 0x2B, 0xF7, 0xEF, 0x8B, 0x3F, 0x92, 0x85, 0x34, 0xA6, 0xB5, 0xF5, 0xD0, 0xAE, 0xC7,
+    0xF5, 0x4A, 0xCA, 0xBE, 0xE2, 0x69, 0xB9, 0x2A, 0xE8, 0x03, 0xD0, 0x8B, 0x3D, 0x47, 0x06, 0x07,
+    0x91, 0xB6, 0x34, 0x7B, 0x83, 0xEE, 0x04, 0x2E, 0x68, 0x93, 0x3A, 0xBA, 0xDB, 0x51, 0x02, 0x0F,
+    0x1C, 0x08, 0x6F, 0xD7, 0xCB, 0xB2, 0xB8, 0x83, 0x3B, 0x7E, 0x06, 0x74, 0x31, 0x93, 0x51, 0x45,
+    0x6F, 0x6D, 0x98, 0x40, 0x4A, 0x49, 0x72, 0x76, 0xCB, 0xF2, 0x86, 0xED, 0x6B, 0x82, 0x39, 0xC4,
+    0xAC, 0xD3, 0xF7, 0x47, 0x9F, 0x84, 0xB2, 0x23, 0x75, 0xA4, 0xB2, 0xBF, 0xF3, 0x3A, 0x6C, 0x28,
+    0xF0, 0xDA, 0x18, 0x52, 0x5D, 0x45, 0x66, 0x8B, 0xD5, 0xF3, 0xAB, 0x79, 0x74, 0xF4, 0xD8, 0xDB,
+    0xF4, 0xD9, 0xB7, 0x14, 0x6C, 0x4D, 0x28, 0xBE, 0x9A, 0xD1, 0xF1, 0xE3, 0x44, 0xB7, 0x6F, 0x53,
+    0xB8, 0xD5, 0x60, 0x59, 0xF4, 0xCB, 0xFD, 0x11, 0x0F, 0xE1, 0x8A, 0xA6, 0xC5, 0x72, 0x6C, 0x85,
+    0x1C, 0x61, 0x89, 0x1F, 0xEC, 0x9C, 0x00, 0x82, 0x1E, 0x1B, 0x3E, 0x1C, 0x2D, 0xAD, 0x60, 0xBD,
+    0x38, 0x73, 0x20, 0x9A, 0x89, 0x2E, 0x2C, 0xFC, 0x43, 0xE5, 0xCC, 0x42, 0x04, 0x83, 0x47, 0x8F,
+    0x91, 0xD8, 0xFF, 0x66, 0x6B, 0xF3, 0xF2, 0xDE, 0xD5, 0x4A, 0xF9, 0xD4, 0x86, 0xDD, 0x3A, 0x85,
+    0xCF, 0x1B, 0x0A, 0x01, 0x00, 0xD2, 0x33, 0xC8, 0xBF, 0x00, 0x42, 0x29, 0xD0, 0xBA, 0x58, 0x23,
+    0xFD, 0xE0, 0x7C, 0x2D, 0x58, 0x69, 0xD8, 0xBE, 0x8F, 0x9C, 0xB5, 0x15, 0xD2, 0xA2, 0xA5, 0x63,
+    0x39, 0x50, 0x57, 0xD7, 0x48, 0xB4, 0x3D, 0x31, 0x88, 0x1D, 0xCE, 0x28, 0xF8, 0x00, 0x6A, 0xD6,
+    0x13, 0xC9, 0x12, 0x67, 0x81, 0x8B, 0xD1, 0xD7, 0x32, 0xF3, 0xEB, 0x18, 0xF9, 0x47, 0xD7, 0x4A,
+    0x25, 0xE9, 0x0C, 0x94, 0x75, 0x9B, 0x66, 0x94, 0x5F, 0xB6, 0xA4, 0x1C, 0xB2, 0x94, 0x3E, 0xAA,
+    0x29, 0xF0, 0x9D, 0x94, 0x9A, 0x94, 0x2E, 0x7C, 0x50, 0x53, 0x09, 0xA8, 0x18, 0x7A, 0x1A, 0xCD,
+    0x67, 0x64, 0x3C, 0xDA, 0x4F, 0x73, 0xA8, 0x6F, 0x18, 0x20, 0x5B, 0x23, 0xCD, 0xB0, 0x62, 0xD4,
+    0xFE, 0x5D, 0xBF, 0x6C, 0xA7, 0x12, 0x82, 0x87, 0x1D, 0x38, 0x7A, 0xDF, 0x46, 0x8F, 0x9D, 0x6A,
+    0xF3, 0xD0, 0xE9, 0x5F, 0x5C, 0x88, 0x3A, 0x48, 0x87, 0x22, 0x38, 0x3C, 0x1A, 0x81, 0xF2, 0x0F,
+    0xE1, 0xF6, 0x57, 0x67, 0xE1, 0x61, 0x55, 0x50, 0x0A, 0x7C, 0x3A, 0x44, 0x0D, 0x28, 0xBF, 0x60,
+    0xDE, 0x2A, 0xBF, 0xEE, 0x7A, 0x08, 0x66, 0x27, 0x3B, 0x7E, 0x0C, 0x32, 0xF1, 0xF2, 0x8C, 0xA6,
+    0x44, 0x2F, 0xEF, 0x04, 0x13, 0x04, 0x71, 0x3D, 0x03, 0x67, 0x5A, 0xF8, 0x57, 0xD5, 0x06, 0xB1,
+    0x9C, 0x9A, 0x92, 0xF6, 0x28, 0x9E, 0x5D, 0x67, 0x32, 0x7D, 0x05, 0x4D, 0xB7, 0xD3, 0xF7, 0xAC,
+    0x2E, 0x72, 0x3D, 0xE9, 0x02, 0x67, 0x4E, 0x17, 0xB1, 0xF5, 0x8E, 0xCC, 0x25, 0xAE, 0x03, 0xA7,
+    0x40, 0xCA, 0x46, 0xFB, 0x73, 0x0C, 0xC7, 0xD9, 0xC6, 0xF7, 0x79, 0x4A, 0xAF, 0xD0, 0x68, 0x3F,
+    0xDB, 0xB7, 0xA5, 0x2B, 0x49, 0xF8, 0xA0, 0xAA, 0xE9, 0xA4, 0xB1, 0x03, 0x8F, 0xD5, 0x09, 0x45,
+    0x9B, 0xC2, 0x74, 0x2C, 0x3A, 0x34, 0xC5, 0x35, 0x28, 0x31, 0x68, 0x5E, 0x49, 0x01, 0x55, 0xB5,
+    0x72, 0x91, 0x25, 0x7E, 0xB7, 0xA5, 0x04, 0x86, 0x23, 0x21, 0xB3, 0xF8, 0xCB, 0x93, 0xB9, 0xD1,
+    0x68, 0x24, 0x6C, 0x79, 0x28, 0xAD, 0x84, 0xD1, 0x65, 0x11, 0xD0, 0xF4, 0x5F, 0x92, 0x28, 0xB6,
+    0x4A, 0x24, 0x1B, 0x37, 0xE4, 0xA0, 0x5A, 0x86, 0xC9, 0xA7, 0x05, 0x28, 0x8B, 0x78, 0x2B, 0x70,
+    0x0C, 0x5D, 0x19, 0xC4, 0xA5, 0x59, 0x89, 0x8F, 0x46, 0xD9, 0x11, 0x28, 0x4B, 0xA5, 0x78, 0x77,
+    0xCB, 0x5B, 0x50, 0x48, 0xDA, 0x4A, 0xC7, 0xA7, 0xFE, 0x59, 0x92, 0x90, 0x58, 0xE6, 0x6F, 0x28,
+    0x90, 0x52, 0x36, 0xF2, 0x6C, 0xB8, 0x11, 0xA0, 0x83, 0xCB, 0x1B, 0xE7, 0x03, 0xA9, 0x96, 0x79,
+    0xE8, 0xC0, 0xE1, 0xAB, 0x03, 0x5D, 0xE7, 0x96, 0x7F, 0x0C, 0xAA, 0xA1, 0x8E, 0xEE, 0xF1, 0xD8,
+    0x7F, 0xE9, 0xF1, 0x52, 0xA1, 0xB1, 0xA0, 0x81, 0xA7, 0x45, 0x5A, 0xEB, 0x09, 0x9E, 0x45, 0xDE,
+    0xC3, 0xF4, 0x55, 0xE9, 0x51, 0xD5, 0x2B, 0xE8, 0x4B, 0xA0, 0x0D, 0xA3, 0xFE, 0x93, 0x3D, 0x30,
+    0x00, 0x27, 0x0D, 0x34, 0x0B, 0x11, 0x78, 0xFF, 0x19, 0xEB, 0x07, 0x5C, 0x2D, 0x04, 0x64, 0xDC,
+    0x70, 0x55, 0xFF, 0x52, 0x83, 0x64, 0x38, 0x3C, 0xA0, 0xB0, 0x2C, 0xAF, 0x63, 0x43, 0xF5, 0xBE,
+    0x3F, 0x19, 0x8D, 0xE4, 0xA4, 0x96, 0x6E, 0x40, 0x67, 0xCB, 0x9B, 0x07, 0x6A, 0xF0, 0x2F, 0xA5,
+    0x55, 0xAD, 0x73, 0xDC, 0x46, 0x14, 0x7F, 0x92, 0x7A, 0x11, 0x10, 0x58, 0x83, 0x1A, 0xD4, 0x9E,
+    0xA9, 0x48, 0x50, 0x41, 0x45, 0x0B, 0xCE, 0xD5, 0x8E, 0x49, 0x40, 0x81, 0x9D, 0x99, 0x3B, 0xEC,
+    0x62, 0x17, 0x98, 0x14, 0x04, 0x38, 0xD6, 0xB5, 0xA4, 0xD4, 0x7F, 0x44, 0x3A, 0xE3, 0x91, 0x81,
+    0x49, 0x41, 0xC1, 0xD9, 0xD2, 0xC4, 0x30, 0x44, 0x69, 0x81, 0x41, 0x41, 0xE5, 0x99, 0xA2, 0x06,
+    0x54, 0xCE, 0x28, 0xD3, 0xBD, 0x66, 0x57, 0xAF, 0xBF, 0x27, 0xDD, 0x4D, 0x0D, 0x12, 0xB7, 0x9E,
+    0xEE, 0xDC, 0xEA, 0x76, 0xF7, 0x7D, 0xEC, 0xEF, 0x7D, 0xEE, 0x74, 0xAA, 0x29, 0x65, 0x9E, 0x29,
+    0xE6, 0xCE, 0xCB, 0xF3, 0xA2, 0x26, 0xF2, 0x3B, 0x22, 0x4A, 0x4B, 0xA2, 0xA0, 0xC5, 0xA2, 0x2B,
+    0x98, 0xF9, 0x0C, 0xF3, 0xAF, 0x3C, 0x3F, 0x35, 0x72, 0x80, 0x99, 0xE9, 0x81, 0x23, 0xFB, 0x09,
+    0x84, 0x4A, 0x66, 0xCA, 0x9D, 0xA6, 0x11, 0x48, 0x41, 0x43, 0x34, 0xEA, 0x26, 0x14, 0x30, 0x1B,
+    0x02, 0xA5, 0xDE, 0xE0, 0xD3, 0x8E, 0xE2, 0x32, 0xA9, 0x83, 0x26, 0xB0, 0x74, 0x41, 0xA9, 0x8E,
+    0x4B, 0xF5, 0x4A, 0x14, 0x62, 0x72, 0x7E, 0xF6, 0x7B, 0x31, 0xF3, 0x5B, 0x55, 0xD3, 0x51, 0xD8,
+    0x92, 0xBA, 0xB4, 0xE4, 0xBF, 0x75, 0x09, 0xC0, 0x00, 0x90, 0xEB, 0x75, 0xE0, 0x26, 0x4C, 0x55,
+    0x91, 0x8C, 0x82, 0x17, 0x02, 0xD7, 0x80, 0xCA, 0xB8, 0x7F, 0x53, 0xC8, 0x85, 0x90, 0xFF, 0x51,
+    0x08, 0x23, 0x66, 0x03, 0xBF, 0xBA, 0x99, 0x4E, 0x0F, 0x0C, 0xCE, 0x0C, 0x44, 0xDA, 0x07, 0xF9,
+    0xF7, 0x9A, 0xD6, 0xA7, 0x18, 0x22, 0xCC, 0xCF, 0xE5, 0x53, 0xA9, 0x96, 0xB2, 0x12, 0xB0, 0xE2,
+    0x86, 0x98, 0x42, 0x0B, 0xA3, 0x3C, 0x26, 0xD5, 0xFC, 0xBF, 0x43, 0x43, 0x05, 0xFC, 0xF1, 0x92,
+    0x59, 0x71, 0x9B, 0x71, 0x39, 0x9A, 0x4E, 0x27, 0x31, 0xB3, 0x85, 0x55, 0x16, 0x8C, 0xE7, 0x91,
+    0xA1, 0xAD, 0xC0, 0xD1, 0x18, 0xAC, 0x00, 0x0F, 0xAC, 0x29, 0xB0, 0x82, 0x40, 0x51, 0x3B, 0xF8,
+    0x1C, 0x5A, 0x29, 0x29, 0x07, 0x2F, 0x3B, 0xFA, 0x20, 0x30, 0x14, 0x47, 0x0D, 0xA5, 0x71, 0x49,
+    0x05, 0x0C, 0xE9, 0x30, 0x9D, 0xE8, 0x13, 0x7F, 0xEC, 0xE7, 0x27, 0x05, 0xBB, 0x3C, 0x3F, 0x41,
+    0xD8, 0x20, 0x09, 0x16, 0xC2, 0x79, 0x58, 0xF7, 0x4E, 0x7B, 0xF7, 0x89, 0xBA, 0xEB, 0x44, 0x46,
+    0xAA, 0x29, 0xAA, 0xFB, 0x93, 0x64, 0x46, 0x61, 0x23, 0x18, 0x44, 0x8D, 0x20, 0x2B, 0x7A, 0x66,
+    0xDF, 0xF4, 0xA2, 0x88, 0x99, 0x67, 0x7B, 0x76, 0x61, 0x1A, 0xD8, 0x25, 0xFA, 0x44, 0x1F, 0x12,
+    0x1D, 0xCA, 0x6F, 0x7C, 0xF8, 0xA4, 0xB8, 0xB0, 0x31, 0xD7, 0x01, 0x6B, 0x7C, 0x8B, 0xC2, 0xE2,
+    0x64, 0xAD, 0x27, 0x81, 0xC7, 0x7B, 0xE6, 0x71, 0x93, 0x16, 0x2F, 0xCA, 0xF9, 0x3C, 0x7C, 0x51,
+    0x1E, 0x1E, 0xED, 0x5D, 0x72, 0x1B, 0x49, 0x40, 0x93, 0x47, 0x36, 0xBB, 0x6C, 0x69, 0x35, 0xA2,
+    0x6A, 0xC8, 0x2A, 0x12, 0xDA, 0x53, 0xA1, 0x4B, 0xC0, 0xE1, 0xB7, 0x10, 0x04, 0x5F, 0x08, 0xD6,
+    0xCF, 0x69, 0xCB, 0xE3, 0x32, 0xA6, 0xAC, 0x89, 0x4A, 0x72, 0x41, 0x4D, 0xC9, 0x37, 0x0D, 0x84,
+    0xE6, 0xA0, 0x7D, 0x0E, 0x81, 0x1D, 0x60, 0x7C, 0x05, 0x2B, 0x19, 0x76, 0x25, 0xD0, 0x1C, 0xDA,
+    0x65, 0x22, 0x27, 0x70, 0xF1, 0x2E, 0x6D, 0xB3, 0x77, 0xC3, 0xAF, 0x8D, 0x4D, 0xDB, 0xAD, 0xA0,
+    0x55, 0xDA, 0x05, 0x0D, 0x57, 0x85, 0xED, 0x94, 0x55, 0xE5, 0x84, 0xBE, 0xF4, 0xB4, 0xA7, 0xE3,
+    0x36, 0x6E, 0x52, 0x97, 0xD9, 0xA7, 0x69, 0x3B, 0x9F, 0xAB, 0x6A, 0x3C, 0x57, 0xF5, 0x78, 0x9E,
+    0xB4, 0xF3, 0xCC, 0x16, 0x26, 0x69, 0x92, 0x66, 0xA4, 0x47, 0x7A, 0x9D, 0x06, 0x57, 0xF6, 0x58,
+    0xED, 0x2A, 0x6F, 0xFF, 0xFB, 0x01, 0xF2, 0xD1, 0x22, 0xB6, 0xBC, 0xCC, 0xED, 0x61, 0xFC, 0x80,
+    0x19, 0xB6, 0xAB, 0x82, 0x14, 0x19, 0xC9, 0x0C, 0x1F, 0x21, 0xA1, 0xB8, 0x5E, 0x1A, 0x21, 0xF9,
+    0xD2, 0x57, 0x81, 0x24, 0x10, 0x65, 0xF0, 0x4C, 0x60, 0x96, 0x12, 0x3E, 0x74, 0x75, 0x48, 0x3C,
+    0x5E, 0x48, 0xBA, 0xD7, 0xEB, 0xD9, 0x7B, 0xC6, 0x27, 0x93, 0x51, 0x1A, 0xFD, 0xFA, 0xFC, 0xCF,
+    0xE6, 0xDC, 0x26, 0xD9, 0x7D, 0x16, 0xFB, 0x0F, 0x66, 0xE4, 0xED, 0x0E, 0x59, 0x43, 0xA1, 0x5C,
+    0x2B, 0xD8, 0x63, 0xC0, 0xF2, 0xDF, 0x02, 0x56, 0x2A, 0xC9, 0x74, 0x0D, 0xD8, 0x0E, 0x66, 0xC6,
+    0xE5, 0x05, 0x90, 0x21, 0x59, 0x52, 0x70, 0x47, 0x8D, 0x6F, 0x91, 0x59, 0xAA, 0x44, 0x6A, 0x75,
+    0xC0, 0x1B, 0x36, 0x70, 0x46, 0xFA, 0x45, 0x43, 0xBE, 0x45, 0xFA, 0x8C, 0x1E, 0x61, 0x61, 0x20,
+    0x9C, 0x6E, 0x1B, 0x8A, 0x1A, 0xF0, 0x38, 0x92, 0x2E, 0x12, 0x36, 0x48, 0xBE, 0x54, 0xA7, 0xDA,
+    0x17, 0x3D, 0xAA, 0x74, 0x83, 0xE6, 0xF0, 0xB5, 0xA4, 0x64, 0x26, 0xF6, 0xE2, 0x52, 0xE5, 0x96,
+    0x30, 0xC2, 0x55, 0xF7, 0x38, 0xF8, 0x8D, 0x14, 0x0A, 0x06, 0x0E, 0x8E, 0xDA, 0x10, 0x6A, 0xC3,
+    0x1B, 0x4B, 0xEA, 0x0A, 0x59, 0xB2, 0x37, 0xA3, 0xF3, 0x23, 0xF2, 0xDF, 0xE0, 0x92, 0xBB, 0xB7,
+    0x15, 0x40, 0x3D, 0xFE, 0x57, 0xAE, 0x5B, 0xDB, 0x16, 0x37, 0x5C, 0xA2, 0x13, 0x44, 0xDD, 0x81,
+    0x89, 0xD0, 0x60, 0x43, 0x46, 0x70, 0x26, 0x12, 0xD2, 0x0D, 0x8D, 0xE6, 0x58, 0xA2, 0x8D, 0xCD,
+    0x7C, 0x7B, 0x88, 0xE0, 0xC1, 0xC8, 0x59, 0x1F, 0x48, 0x89, 0x9A, 0x92, 0xB2, 0xBC, 0xDF, 0xD6,
+    0xBB, 0x86, 0x1B, 0xFF, 0x80, 0x57, 0xD1, 0x4F, 0x12, 0x69, 0x93, 0xFE, 0xAA, 0x89, 0x4B, 0x73,
+    0x89, 0x2B, 0x7A, 0xFF, 0x38, 0x26, 0xEF, 0x98, 0x29, 0x70, 0x59, 0x49, 0xBC, 0x03, 0xEC, 0xE5,
+    0x2E, 0x79, 0xFA, 0x63, 0x4D, 0x9F, 0xA2, 0x1D, 0xA5, 0x57, 0xB0, 0xA0, 0x75, 0x88, 0xC7, 0x1D,
+    0x0A, 0x3E, 0x5A, 0xE6, 0xA1, 0xD4, 0xAD, 0xE7, 0x86, 0xD2, 0x47, 0x91, 0xAA, 0x6B, 0x27, 0x05,
+    0x3A, 0xB0, 0x84, 0x0D, 0x47, 0xF5, 0x1A, 0xDD, 0x43, 0xED, 0x3B, 0x61, 0x91, 0xBC, 0x39, 0xC6,
+    0xFF, 0x99, 0xBB, 0xE2, 0x60, 0x9B, 0xCD, 0x43, 0xBA, 0xD0, 0x2B, 0xFE, 0xCD, 0xDA, 0xFB, 0x96,
+    0x17, 0xF1, 0xDE, 0x2F, 0x6C, 0x9F, 0xF8, 0xBC, 0xBA, 0x78, 0x03, 0x6D, 0x31, 0x63, 0x7E, 0x73,
+    0xAB, 0x9C, 0x96, 0xDB, 0x97, 0x78, 0x04, 0x08, 0xFA, 0x82, 0x0E, 0xEA, 0x16, 0x66, 0x51, 0xB8,
+    0x71, 0xE0, 0xFA, 0xE7, 0x45, 0x7F, 0x5D, 0xB8, 0xA3, 0x34, 0xE3, 0x1D, 0x8F, 0x67, 0x7A, 0x44,
+    0x6B, 0x44, 0x6B, 0x5D, 0x7E, 0x76, 0x09, 0x19, 0xEF, 0xAC, 0x3B, 0x5E, 0xDD, 0xF7, 0x15, 0x3F,
+    0x53, 0x52, 0xAC, 0xF9, 0x29, 0x82, 0x47, 0x3D, 0x0C, 0xAF, 0xA2, 0xA0, 0x42, 0x2B, 0xC6, 0x6F,
+    0xBF, 0x38, 0x41, 0x83, 0x5B, 0x5F, 0x4C, 0x86, 0x2D, 0x1C, 0xA1, 0x40, 0xEF, 0x05, 0x3D, 0x28,
+    0xBA, 0xC2, 0x5C, 0x22, 0xC7, 0x83, 0x9B, 0x7F, 0x87, 0xED, 0xDE, 0xB2, 0x9B, 0x4B, 0xAD, 0x0F,
+    0x5B, 0x87, 0x87, 0x0A, 0x55, 0xF5, 0x50, 0xDC, 0x94, 0xB4, 0x3E, 0xEB, 0xA4, 0x06, 0x38, 0xCA,
+    0x6A, 0x0A, 0x11, 0x58, 0xFC, 0x45, 0x10, 0xF8, 0x11, 0xFC, 0x78, 0x5B, 0x86, 0x6B, 0xB0, 0x1E,
+    0xF7, 0xC5, 0x9F, 0x18, 0x5C, 0x33, 0xA3, 0xD8, 0x48, 0x97, 0xD8, 0x34, 0x58, 0x63, 0x89, 0xF3,
+    0xCF, 0x7A, 0xFD, 0xB7, 0xF9, 0x65, 0xFC, 0x0D, 0x8D, 0x93, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x86,
+    0xC7, 0x36, 0xC1, 0x12, 0x96, 0x70, 0x03, 0x0D, 0x91, 0xE2, 0x27, 0xC8, 0xF9, 0x05, 0x92, 0xB3,
+    0x45, 0x43, 0x41, 0x93, 0xC6, 0x20, 0x41, 0x71, 0x8F, 0x90, 0x26, 0x45, 0x8A, 0x10, 0x5B, 0x4A,
+    0x41, 0x9B, 0x26, 0x35, 0x0D, 0x48, 0xC4, 0x0F, 0x80, 0x4E, 0x44, 0x8A, 0x8D, 0xF2, 0x02, 0x1B,
+    0x44, 0x2A, 0x0A, 0x16, 0x28, 0x52, 0x50, 0xB0, 0x11, 0x06, 0x2D, 0xC1, 0xF6, 0xF0, 0x8F, 0x2F,
+    0xA7, 0xA4, 0x41, 0xC4, 0xD2, 0x8E, 0xBC, 0xE3, 0x99, 0x6F, 0xFE, 0xF5, 0xCE, 0x10, 0x0D, 0xCF,
+    0x12, 0xB9, 0x35, 0xE5, 0x75, 0x60, 0x1C, 0x2E, 0xD6, 0x1B, 0xBF, 0x77, 0x78, 0x37, 0xB2, 0x5E,
+    0x4F, 0x41, 0xE3, 0xF4, 0x44, 0x95, 0x8A, 0x1B, 0xF2, 0x39, 0xAD, 0x14, 0x45, 0x9D, 0xCB, 0x29,
+    0x22, 0xC3, 0x86, 0x1C, 0x4D, 0x5B, 0x74, 0xF9, 0xDC, 0x26, 0x57, 0x91, 0x67, 0x49, 0x3E, 0xEB,
+    0xC5, 0x8E, 0x9C, 0x21, 0xCB, 0x65, 0x64, 0x53, 0xAC, 0x7C, 0x0B, 0x6F, 0x64, 0x81, 0xCF, 0x8D,
+    0xE0, 0xC5, 0x81, 0xC8, 0x86, 0x96, 0xE7, 0xF9, 0x15, 0xFF, 0xA6, 0x84, 0xD9, 0x86, 0xCC, 0x5C,
+    0x13, 0x2D, 0x5A, 0xF1, 0x61, 0x85, 0x9A, 0x04, 0x3B, 0xDB, 0x24, 0x05, 0x1C, 0x0A, 0xEB, 0x2C,
+    0xCB, 0xD6, 0x2D, 0x22, 0x2D, 0x52, 0x9A, 0x9B, 0xE5, 0xAB, 0x54, 0x10, 0x77, 0x24, 0x02, 0x2B,
+    0x42, 0x54, 0xA0, 0xE8, 0x1E, 0x73, 0x51, 0x31, 0x1B, 0x84, 0xB5, 0xD5, 0x6E, 0x82, 0xE4, 0xB8,
+    0x88, 0xEB, 0x10, 0xA7, 0xF4, 0x8C, 0x67, 0xDD, 0x06, 0xC4, 0x96, 0xE2, 0x7A, 0x9B, 0xBC, 0x36,
+    0x4E, 0xA9, 0xFA, 0x7E, 0x92, 0x05, 0x52, 0x3B, 0x47, 0x8A, 0xD3, 0x97, 0x2F, 0xE9, 0xF0, 0x02,
+    0x17, 0xD6, 0x73, 0x8D, 0x0B, 0x17, 0x3B, 0xDF, 0x10, 0x49, 0x3E, 0x77, 0x57, 0x24, 0x87, 0x9F,
+    0x2C, 0xF9, 0xBA, 0x22, 0xAF, 0x81, 0xE4, 0x16, 0x92, 0x0F, 0x51, 0x40, 0xAA, 0x46, 0x75, 0xA8,
+    0x02, 0x15, 0x9E, 0x3D, 0xFE, 0x79, 0x45, 0x72, 0xB5, 0x9F, 0x0E, 0x3A, 0x05, 0xE7, 0x99, 0x79,
+    0x01, 0x27, 0xCB, 0x28, 0x66, 0x56, 0xD0, 0xD0, 0xE4, 0xE7, 0xE5, 0xEB, 0x44, 0xCD, 0xCE, 0x2B,
+    0x05, 0x9D, 0x16, 0x01, 0x39, 0x0E, 0x1A, 0xCA, 0x86, 0xF7, 0xB2, 0x35, 0x44, 0x76, 0x0E, 0x88,
+    0xA9, 0xF3, 0xA4, 0x2C, 0x66, 0xFF, 0x90, 0x3B, 0x38, 0xF9, 0x21, 0x96, 0xBA, 0x9B, 0xAD, 0x51,
+    0xC4, 0xAC, 0x7D, 0x89, 0x28, 0xCB, 0xAA, 0x91, 0x2C, 0xF9, 0x3B, 0x52, 0x11, 0x1B, 0xEA, 0x2E,
+    0x78, 0xC9, 0xBB, 0x2C, 0xAB, 0x8E, 0x11, 0xA5, 0x51, 0x56, 0xDD, 0x2A, 0xF7, 0x66, 0x52, 0x44,
+    0x2A, 0x1C, 0x3D, 0x18, 0x5C, 0x90, 0xB3, 0x0F, 0x9F, 0x1C, 0x33, 0xFA, 0xF8, 0x42, 0x39, 0xCD,
+    0xC8, 0x57, 0x21, 0x4D, 0xFD, 0x7A, 0xEA, 0xEA, 0x60, 0xA7, 0x0E, 0x8A, 0x70, 0x89, 0x46, 0xB4,
+    0xBA, 0x5D, 0xF6, 0xE5, 0x2F, 0x84, 0xF3, 0xE9, 0xC9, 0xD3, 0xBD, 0xC9, 0x44, 0x5C, 0x2B, 0x34,
+    0x25, 0x23, 0x51, 0x45, 0x13, 0x14, 0x5B, 0x8E, 0x1D, 0x05, 0xCA, 0xE9, 0xDF, 0x76, 0xA2, 0x15,
+    0x92, 0x17, 0xE4, 0xDE, 0x2E, 0xD1, 0x1F, 0x26, 0x40, 0x13, 0xD0, 0x29, 0x01, 0x8D, 0x4B, 0xDC,
+    0x81, 0xD6, 0x30, 0xC2, 0x67, 0xA0, 0xCB, 0x39, 0x3A, 0xCB, 0x80, 0x26, 0x41, 0x13, 0xD0, 0x88,
+    0x2A, 0x70, 0x1A, 0xA0, 0x49, 0xD0, 0x8F, 0xFE, 0x87, 0x36, 0x94, 0xD4, 0x07, 0xC6, 0xFB, 0xB6,
+    0x73, 0x64, 0xC6, 0xE1, 0x92, 0xF7, 0x43, 0xAF, 0x6E, 0xA2, 0xD1, 0xDF, 0x68, 0xCF, 0xB8, 0xA7,
+    0x45, 0x62, 0x82, 0x89, 0xF7, 0xD5, 0xAC, 0xAE, 0x8C, 0x3D, 0x63, 0x0E, 0xB4, 0xF7, 0xA7, 0xE8,
+    0xD1, 0x1D, 0xD7, 0x45, 0xA7, 0x40, 0x4F, 0x09, 0xE8, 0x9A, 0xC6, 0x50, 0xED, 0x01, 0x4D, 0x63,
+    0x41, 0x6B, 0xA0, 0xC7, 0x04, 0xB4, 0x86, 0xEA, 0x31, 0x54, 0x1F, 0x68, 0xA8, 0xEE, 0xFF, 0xA5,
+    0x5A, 0x8C, 0x34, 0x5E, 0x3B, 0x6B, 0x0D, 0x69, 0x91, 0xEB, 0x6C, 0x71, 0xF3, 0x3D, 0x3A, 0xE0,
+    0x5C, 0x6E, 0x32, 0x7E, 0xD0, 0xE6, 0x47, 0x8D, 0x8C, 0x42, 0x50, 0x07, 0x0A, 0xA3, 0x5B, 0xE4,
+    0x47, 0x9D, 0x8B, 0xC1, 0x0B, 0xB4, 0x6F, 0x86, 0xDB, 0x9F, 0x3D, 0xC3, 0xDC, 0xD0, 0xE6, 0x60,
+    0xF3, 0xA1, 0x87, 0x72, 0x99, 0x35, 0xDA, 0x90, 0xDE, 0xA4, 0x8D, 0xE1, 0xCB, 0xB3, 0x1B, 0x01,
+    0x36, 0x39, 0x6B, 0x2B, 0xB6, 0x8B, 0x0B, 0x58, 0x7E, 0x6E, 0xC5, 0x7E, 0xC6, 0x3C, 0xCB, 0x94,
+    0xD9, 0x98, 0x2D, 0x25, 0xBD, 0xCB, 0x2D, 0x55, 0x3D, 0x84, 0xDC, 0xE7, 0x1E, 0xA3, 0xFF, 0x05,
+    0x96, 0xE2, 0x16, 0x1E, 0x6C, 0xE4, 0x9D, 0xE2, 0xF7, 0x62, 0x5D, 0x33, 0x96, 0x1A, 0xCB, 0x23,
+    0xB1, 0x6E, 0x3F, 0x14, 0x1F, 0xCD, 0x9A, 0x0E, 0xEB, 0x2F,
+};
+
+static const uint32_t bookerly_12_bolditalicBlockOffsets[28] = {
+    0, 1216, 2412, 3668, 4900, 5711, 6661, 7731,
+    8743, 9772, 10882, 12058, 13057, 14221, 15329, 16501,
+    17686, 18912, 20192, 21409, 22544, 23649, 24770, 25898,
+    27215, 28479, 29512, 30186,
+};
+
+static const uint16_t bookerly_12_bolditalicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_bolditalicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_12_bolditalicPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
@@ -3380,713 +2104,713 @@ static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
     { 23, 23, 25, 1, 18, 133, 1686 }, // @
     { 20, 18, 19, -2, 18, 90, 1819 }, // A
     { 16, 19, 16, -1, 18, 76, 1909 }, // B
-    { 17, 19, 16, 0, 18, 81, 1985 }, // C
-    { 19, 19, 18, -1, 18, 91, 2066 }, // D
-    { 17, 18, 16, -1, 18, 77, 2157 }, // E
-    { 16, 18, 14, -1, 18, 72, 2234 }, // F
-    { 18, 19, 18, 0, 18, 86, 2306 }, // G
-    { 22, 18, 20, -1, 18, 99, 2392 }, // H
-    { 12, 18, 10, -1, 18, 54, 2491 }, // I
-    { 16, 23, 9, -5, 18, 92, 2545 }, // J
-    { 20, 19, 18, -1, 18, 95, 2637 }, // K
-    { 15, 18, 14, -1, 18, 68, 2732 }, // L
-    { 25, 18, 22, -2, 18, 113, 2800 }, // M
-    { 22, 19, 19, -1, 18, 105, 2913 }, // N
-    { 18, 19, 18, 0, 18, 86, 3018 }, // O
-    { 17, 18, 15, -1, 18, 77, 3104 }, // P
-    { 22, 24, 19, 0, 18, 132, 3181 }, // Q
-    { 18, 19, 17, -1, 18, 86, 3313 }, // R
-    { 15, 19, 14, -1, 18, 72, 3399 }, // S
-    { 17, 18, 17, 1, 18, 77, 3471 }, // T
-    { 19, 19, 20, 2, 18, 91, 3548 }, // U
-    { 19, 19, 18, 1, 18, 91, 3639 }, // V
-    { 26, 19, 25, 1, 18, 124, 3730 }, // W
-    { 21, 18, 17, -2, 18, 95, 3854 }, // X
-    { 18, 18, 16, 1, 18, 81, 3949 }, // Y
-    { 17, 19, 16, -1, 18, 81, 4030 }, // Z
-    { 12, 24, 8, -2, 20, 72, 4111 }, // [
-    { 11, 20, 13, 1, 18, 55, 4183 }, // <backslash>
-    { 12, 24, 8, -2, 20, 72, 4238 }, // ]
-    { 13, 12, 16, 1, 16, 39, 4310 }, // ^
-    { 13, 3, 13, 0, -1, 10, 4349 }, // _
-    { 6, 7, 16, 5, 21, 11, 4359 }, // `
-    { 15, 15, 15, 0, 14, 57, 4370 }, // a
-    { 14, 21, 14, 0, 20, 74, 4427 }, // b
-    { 12, 15, 11, 0, 14, 45, 4501 }, // c
-    { 15, 21, 15, 0, 20, 79, 4546 }, // d
-    { 12, 15, 12, 0, 14, 45, 4625 }, // e
-    { 19, 26, 11, -5, 20, 124, 4670 }, // f
-    { 17, 20, 13, -2, 14, 85, 4794 }, // g
-    { 15, 21, 15, 0, 20, 79, 4879 }, // h
-    { 9, 21, 8, 0, 20, 48, 4958 }, // i
-    { 14, 26, 8, -5, 20, 91, 5006 }, // j
-    { 13, 21, 13, 0, 20, 69, 5097 }, // k
-    { 8, 21, 8, 0, 20, 42, 5166 }, // l
-    { 22, 15, 22, 0, 14, 83, 5208 }, // m
-    { 15, 15, 16, 0, 14, 57, 5291 }, // n
-    { 13, 15, 14, 0, 14, 49, 5348 }, // o
-    { 16, 20, 14, -2, 14, 80, 5397 }, // p
-    { 14, 20, 14, 0, 14, 70, 5477 }, // q
-    { 13, 14, 12, 0, 14, 46, 5547 }, // r
-    { 12, 15, 11, -1, 14, 45, 5593 }, // s
-    { 11, 18, 11, 0, 17, 50, 5638 }, // t
-    { 15, 15, 15, 0, 14, 57, 5688 }, // u
-    { 13, 15, 13, 0, 14, 49, 5745 }, // v
-    { 19, 15, 19, 0, 14, 72, 5794 }, // w
-    { 16, 15, 14, -1, 14, 60, 5866 }, // x
-    { 17, 20, 13, -4, 14, 85, 5926 }, // y
-    { 14, 15, 12, -1, 14, 53, 6011 }, // z
-    { 11, 25, 10, 1, 20, 69, 6064 }, // {
-    { 9, 23, 8, -1, 20, 52, 6133 }, // |
-    { 11, 25, 10, -1, 20, 69, 6185 }, // }
-    { 13, 5, 16, 1, 11, 17, 6254 }, // ~
-    { 0, 0, 5, 0, 0, 0, 6271 }, //  
-    { 9, 20, 8, -1, 14, 45, 6271 }, // ¡
-    { 14, 25, 16, 1, 20, 88, 6316 }, // ¢
-    { 17, 19, 16, -1, 18, 81, 6404 }, // £
-    { 16, 13, 16, 0, 15, 52, 6485 }, // ¤
-    { 17, 18, 16, 1, 18, 77, 6537 }, // ¥
-    { 9, 23, 8, -1, 20, 52, 6614 }, // ¦
-    { 13, 21, 13, -1, 18, 69, 6666 }, // §
-    { 9, 5, 16, 3, 20, 12, 6735 }, // ¨
-    { 19, 19, 20, 0, 18, 91, 6747 }, // ©
-    { 10, 13, 11, 1, 18, 33, 6838 }, // ª
-    { 15, 11, 15, 0, 12, 42, 6871 }, // «
-    { 12, 7, 16, 2, 12, 21, 6913 }, // ¬
-    { 8, 3, 10, 1, 8, 6, 6934 }, // ­
-    { 14, 14, 15, 0, 20, 49, 6940 }, // ®
-    { 9, 3, 16, 3, 18, 7, 6989 }, // ¯
-    { 10, 10, 13, 2, 18, 25, 6996 }, // °
-    { 12, 16, 16, 2, 15, 48, 7021 }, // ±
-    { 11, 12, 11, 0, 21, 33, 7069 }, // ²
-    { 9, 13, 11, 1, 21, 30, 7102 }, // ³
-    { 6, 7, 16, 5, 22, 11, 7132 }, // ´
-    { 17, 20, 15, -1, 14, 85, 7143 }, // µ
-    { 17, 22, 15, -1, 18, 94, 7228 }, // ¶
-    { 5, 5, 8, 1, 10, 7, 7322 }, // ·
-    { 6, 6, 16, 5, -1, 9, 7329 }, // ¸
-    { 8, 12, 11, 1, 21, 24, 7338 }, // ¹
-    { 10, 13, 11, 1, 18, 33, 7362 }, // º
-    { 15, 11, 15, 0, 12, 42, 7395 }, // »
-    { 26, 21, 27, 1, 19, 137, 7437 }, // ¼
-    { 25, 21, 27, 1, 19, 132, 7574 }, // ½
-    { 26, 21, 27, 1, 19, 137, 7706 }, // ¾
-    { 9, 20, 10, 0, 14, 45, 7843 }, // ¿
-    { 20, 25, 19, -2, 25, 125, 7888 }, // À
-    { 20, 25, 19, -2, 25, 125, 8013 }, // Á
-    { 20, 25, 19, -2, 25, 125, 8138 }, // Â
-    { 20, 24, 19, -2, 24, 120, 8263 }, // Ã
-    { 20, 24, 19, -2, 24, 120, 8383 }, // Ä
-    { 20, 25, 19, -2, 25, 125, 8503 }, // Å
-    { 26, 18, 23, -2, 18, 117, 8628 }, // Æ
-    { 17, 25, 16, 0, 18, 107, 8745 }, // Ç
-    { 17, 25, 16, -1, 25, 107, 8852 }, // È
-    { 17, 25, 16, -1, 25, 107, 8959 }, // É
-    { 17, 25, 16, -1, 25, 107, 9066 }, // Ê
-    { 17, 24, 16, -1, 24, 102, 9173 }, // Ë
-    { 12, 25, 10, -1, 25, 75, 9275 }, // Ì
-    { 13, 25, 10, -1, 25, 82, 9350 }, // Í
-    { 13, 25, 10, -1, 25, 82, 9432 }, // Î
-    { 13, 24, 10, -1, 24, 78, 9514 }, // Ï
-    { 19, 19, 18, -1, 18, 91, 9592 }, // Ð
-    { 22, 25, 19, -1, 24, 138, 9683 }, // Ñ
-    { 18, 26, 18, 0, 25, 117, 9821 }, // Ò
-    { 18, 26, 18, 0, 25, 117, 9938 }, // Ó
-    { 18, 26, 18, 0, 25, 117, 10055 }, // Ô
-    { 18, 25, 18, 0, 24, 113, 10172 }, // Õ
-    { 18, 25, 18, 0, 24, 113, 10285 }, // Ö
-    { 11, 11, 16, 2, 14, 31, 10398 }, // ×
-    { 21, 20, 18, -1, 19, 105, 10429 }, // Ø
-    { 19, 26, 20, 2, 25, 124, 10534 }, // Ù
-    { 19, 26, 20, 2, 25, 124, 10658 }, // Ú
-    { 19, 26, 20, 2, 25, 124, 10782 }, // Û
-    { 19, 25, 20, 2, 24, 119, 10906 }, // Ü
-    { 18, 25, 16, 1, 25, 113, 11025 }, // Ý
-    { 16, 18, 15, -1, 18, 72, 11138 }, // Þ
-    { 21, 26, 16, -5, 20, 137, 11210 }, // ß
-    { 15, 22, 15, 0, 21, 83, 11347 }, // à
-    { 15, 23, 15, 0, 22, 87, 11430 }, // á
-    { 15, 22, 15, 0, 21, 83, 11517 }, // â
-    { 15, 21, 15, 0, 20, 79, 11600 }, // ã
-    { 15, 21, 15, 0, 20, 79, 11679 }, // ä
-    { 15, 22, 15, 0, 21, 83, 11758 }, // å
-    { 20, 15, 20, 0, 14, 75, 11841 }, // æ
-    { 12, 21, 11, 0, 14, 63, 11916 }, // ç
-    { 12, 22, 12, 0, 21, 66, 11979 }, // è
-    { 13, 23, 12, 0, 22, 75, 12045 }, // é
-    { 12, 22, 12, 0, 21, 66, 12120 }, // ê
-    { 13, 21, 12, 0, 20, 69, 12186 }, // ë
-    { 8, 22, 8, 0, 21, 44, 12255 }, // ì
-    { 11, 23, 8, 0, 22, 64, 12299 }, // í
-    { 10, 22, 8, 0, 21, 55, 12363 }, // î
-    { 11, 21, 8, 0, 20, 58, 12418 }, // ï
-    { 14, 22, 14, 0, 21, 77, 12476 }, // ð
-    { 15, 21, 16, 0, 20, 79, 12553 }, // ñ
-    { 13, 22, 14, 0, 21, 72, 12632 }, // ò
-    { 14, 23, 14, 0, 22, 81, 12704 }, // ó
-    { 13, 22, 14, 0, 21, 72, 12785 }, // ô
-    { 14, 21, 14, 0, 20, 74, 12857 }, // õ
-    { 14, 21, 14, 0, 20, 74, 12931 }, // ö
-    { 12, 13, 16, 2, 15, 39, 13005 }, // ÷
-    { 17, 15, 14, -2, 14, 64, 13044 }, // ø
-    { 15, 22, 15, 0, 21, 83, 13108 }, // ù
-    { 15, 23, 15, 0, 22, 87, 13191 }, // ú
-    { 15, 22, 15, 0, 21, 83, 13278 }, // û
-    { 15, 21, 15, 0, 20, 79, 13361 }, // ü
-    { 17, 28, 13, -4, 22, 119, 13440 }, // ý
-    { 17, 26, 14, -3, 20, 111, 13559 }, // þ
-    { 17, 26, 13, -4, 20, 111, 13670 }, // ÿ
-    { 20, 23, 19, -2, 23, 115, 13781 }, // Ā
-    { 15, 19, 15, 0, 18, 72, 13896 }, // ā
-    { 20, 24, 19, -2, 24, 120, 13968 }, // Ă
-    { 15, 21, 15, 0, 20, 79, 14088 }, // ă
-    { 20, 24, 19, -2, 18, 120, 14167 }, // Ą
-    { 15, 20, 15, 0, 14, 75, 14287 }, // ą
-    { 17, 26, 16, 0, 25, 111, 14362 }, // Ć
-    { 13, 23, 11, 0, 22, 75, 14473 }, // ć
-    { 17, 26, 16, 0, 25, 111, 14548 }, // Ĉ
-    { 12, 22, 11, 0, 21, 66, 14659 }, // ĉ
-    { 17, 25, 16, 0, 24, 107, 14725 }, // Ċ
-    { 12, 21, 11, 0, 20, 63, 14832 }, // ċ
-    { 17, 26, 16, 0, 25, 111, 14895 }, // Č
-    { 13, 22, 11, 0, 21, 72, 15006 }, // č
-    { 19, 26, 18, -1, 25, 124, 15078 }, // Ď
-    { 19, 21, 16, 0, 20, 100, 15202 }, // ď
-    { 19, 19, 18, -1, 18, 91, 15302 }, // Đ
-    { 17, 21, 15, 0, 20, 90, 15393 }, // đ
-    { 17, 23, 16, -1, 23, 98, 15483 }, // Ē
-    { 13, 19, 12, 0, 18, 62, 15581 }, // ē
-    { 17, 24, 16, -1, 24, 102, 15643 }, // Ĕ
-    { 13, 21, 12, 0, 20, 69, 15745 }, // ĕ
-    { 17, 24, 16, -1, 24, 102, 15814 }, // Ė
-    { 12, 21, 12, 0, 20, 63, 15916 }, // ė
-    { 17, 24, 16, -1, 18, 102, 15979 }, // Ę
-    { 12, 20, 12, 0, 14, 60, 16081 }, // ę
-    { 17, 25, 16, -1, 25, 107, 16141 }, // Ě
-    { 13, 22, 12, 0, 21, 72, 16248 }, // ě
-    { 18, 26, 18, 0, 25, 117, 16320 }, // Ĝ
-    { 17, 27, 13, -2, 21, 115, 16437 }, // ĝ
-    { 18, 25, 18, 0, 24, 113, 16552 }, // Ğ
-    { 17, 26, 13, -2, 20, 111, 16665 }, // ğ
-    { 18, 25, 18, 0, 24, 113, 16776 }, // Ġ
-    { 17, 26, 13, -2, 20, 111, 16889 }, // ġ
-    { 18, 25, 18, 0, 18, 113, 17000 }, // Ģ
-    { 17, 28, 13, -2, 22, 119, 17113 }, // ģ
-    { 22, 25, 20, -1, 25, 138, 17232 }, // Ĥ
-    { 15, 27, 15, 0, 26, 102, 17370 }, // ĥ
-    { 22, 18, 20, -1, 18, 99, 17472 }, // Ħ
-    { 15, 21, 15, 0, 20, 79, 17571 }, // ħ
-    { 13, 24, 10, -1, 24, 78, 17650 }, // Ĩ
-    { 11, 21, 8, 0, 20, 58, 17728 }, // ĩ
-    { 13, 23, 10, -1, 23, 75, 17786 }, // Ī
-    { 11, 19, 8, 0, 18, 53, 17861 }, // ī
-    { 13, 24, 10, -1, 24, 78, 17914 }, // Ĭ
-    { 11, 21, 8, 0, 20, 58, 17992 }, // ĭ
-    { 12, 24, 10, -1, 18, 72, 18050 }, // Į
-    { 9, 26, 8, 0, 20, 59, 18122 }, // į
-    { 12, 24, 10, -1, 24, 72, 18181 }, // İ
-    { 8, 15, 8, 0, 14, 30, 18253 }, // ı
-    { 22, 23, 19, -1, 18, 127, 18283 }, // Ĳ
-    { 17, 26, 16, 0, 20, 111, 18410 }, // ĳ
-    { 17, 30, 9, -5, 25, 128, 18521 }, // Ĵ
-    { 16, 27, 8, -5, 21, 108, 18649 }, // ĵ
-    { 20, 25, 18, -1, 18, 125, 18757 }, // Ķ
-    { 13, 27, 13, 0, 20, 88, 18882 }, // ķ
-    { 14, 15, 14, 0, 14, 53, 18970 }, // ĸ
-    { 15, 25, 14, -1, 25, 94, 19023 }, // Ĺ
-    { 10, 27, 8, 0, 26, 68, 19117 }, // ĺ
-    { 15, 25, 14, -1, 18, 94, 19185 }, // Ļ
-    { 9, 27, 8, -1, 20, 61, 19279 }, // ļ
-    { 16, 20, 14, -1, 20, 80, 19340 }, // Ľ
-    { 12, 21, 9, 0, 20, 63, 19420 }, // ľ
-    { 16, 18, 14, -1, 18, 72, 19483 }, // Ŀ
-    { 12, 21, 11, 0, 20, 63, 19555 }, // ŀ
-    { 15, 18, 14, -1, 18, 68, 19618 }, // Ł
-    { 10, 21, 8, -1, 20, 53, 19686 }, // ł
-    { 22, 26, 19, -1, 25, 143, 19739 }, // Ń
-    { 15, 23, 16, 0, 22, 87, 19882 }, // ń
-    { 22, 25, 19, -1, 18, 138, 19969 }, // Ņ
-    { 15, 21, 16, 0, 14, 79, 20107 }, // ņ
-    { 22, 26, 19, -1, 25, 143, 20186 }, // Ň
-    { 15, 22, 16, 0, 21, 83, 20329 }, // ň
-    { 20, 20, 21, 1, 19, 100, 20412 }, // ŉ
-    { 22, 23, 19, -1, 18, 127, 20512 }, // Ŋ
-    { 14, 20, 15, 0, 14, 70, 20639 }, // ŋ
-    { 18, 24, 18, 0, 23, 108, 20709 }, // Ō
-    { 14, 19, 14, 0, 18, 67, 20817 }, // ō
-    { 18, 25, 18, 0, 24, 113, 20884 }, // Ŏ
-    { 14, 21, 14, 0, 20, 74, 20997 }, // ŏ
-    { 19, 26, 18, 0, 25, 124, 21071 }, // Ő
-    { 15, 22, 14, 0, 21, 83, 21195 }, // ő
-    { 25, 19, 25, 0, 18, 119, 21278 }, // Œ
-    { 20, 15, 20, 0, 14, 75, 21397 }, // œ
-    { 18, 26, 17, -1, 25, 117, 21472 }, // Ŕ
-    { 13, 22, 12, 0, 22, 72, 21589 }, // ŕ
-    { 18, 25, 17, -1, 18, 113, 21661 }, // Ŗ
-    { 14, 21, 12, -1, 14, 74, 21774 }, // ŗ
-    { 18, 26, 17, -1, 25, 117, 21848 }, // Ř
-    { 13, 21, 12, 0, 21, 69, 21965 }, // ř
-    { 15, 26, 14, -1, 25, 98, 22034 }, // Ś
-    { 13, 23, 11, -1, 22, 75, 22132 }, // ś
-    { 15, 26, 14, -1, 25, 98, 22207 }, // Ŝ
-    { 13, 22, 11, -1, 21, 72, 22305 }, // ŝ
-    { 15, 25, 14, -1, 18, 94, 22377 }, // Ş
-    { 12, 21, 11, -1, 14, 63, 22471 }, // ş
-    { 16, 26, 14, -1, 25, 104, 22534 }, // Š
-    { 14, 22, 11, -1, 21, 77, 22638 }, // š
-    { 17, 25, 17, 1, 18, 107, 22715 }, // Ţ
-    { 11, 24, 11, 0, 17, 66, 22822 }, // ţ
-    { 17, 25, 17, 1, 25, 107, 22888 }, // Ť
-    { 13, 21, 11, 0, 20, 69, 22995 }, // ť
-    { 17, 18, 17, 1, 18, 77, 23064 }, // Ŧ
-    { 11, 18, 11, 0, 17, 50, 23141 }, // ŧ
-    { 19, 25, 20, 2, 24, 119, 23191 }, // Ũ
-    { 15, 21, 15, 0, 20, 79, 23310 }, // ũ
-    { 19, 24, 20, 2, 23, 114, 23389 }, // Ū
-    { 15, 19, 15, 0, 18, 72, 23503 }, // ū
-    { 19, 25, 20, 2, 24, 119, 23575 }, // Ŭ
-    { 15, 21, 15, 0, 20, 79, 23694 }, // ŭ
-    { 19, 26, 20, 2, 25, 124, 23773 }, // Ů
-    { 15, 22, 15, 0, 21, 83, 23897 }, // ů
-    { 19, 26, 20, 2, 25, 124, 23980 }, // Ű
-    { 15, 22, 15, 0, 21, 83, 24104 }, // ű
-    { 19, 24, 20, 2, 18, 114, 24187 }, // Ų
-    { 15, 20, 15, 0, 14, 75, 24301 }, // ų
-    { 26, 26, 25, 1, 25, 169, 24376 }, // Ŵ
-    { 19, 22, 19, 0, 21, 105, 24545 }, // ŵ
-    { 18, 25, 16, 1, 25, 113, 24650 }, // Ŷ
-    { 17, 27, 13, -4, 21, 115, 24763 }, // ŷ
-    { 18, 24, 16, 1, 24, 108, 24878 }, // Ÿ
-    { 17, 26, 16, -1, 25, 111, 24986 }, // Ź
-    { 14, 23, 12, -1, 22, 81, 25097 }, // ź
-    { 17, 25, 16, -1, 24, 107, 25178 }, // Ż
-    { 14, 21, 12, -1, 20, 74, 25285 }, // ż
-    { 17, 26, 16, -1, 25, 111, 25359 }, // Ž
-    { 14, 22, 12, -1, 21, 77, 25470 }, // ž
-    { 19, 26, 11, -5, 20, 124, 25547 }, // ſ
-    { 6, 7, 0, -4, 21, 11, 25671 }, // ̀
-    { 6, 7, 0, -2, 22, 11, 25682 }, // ́
-    { 9, 7, 0, -5, 21, 16, 25693 }, // ̂
-    { 10, 5, 0, -5, 20, 13, 25709 }, // ̃
-    { 9, 3, 0, -5, 18, 7, 25722 }, // ̄
-    { 8, 5, 0, -4, 20, 10, 25729 }, // ̆
-    { 4, 5, 0, -2, 20, 5, 25739 }, // ̇
-    { 10, 5, 0, -5, 20, 13, 25744 }, // ̈
-    { 7, 8, 0, -3, 22, 14, 25757 }, // ̉
-    { 8, 7, 0, -4, 21, 14, 25771 }, // ̊
-    { 11, 7, 0, -5, 21, 20, 25785 }, // ̋
-    { 9, 6, 0, -4, 21, 14, 25805 }, // ̌
-    { 8, 7, 0, -5, 21, 14, 25819 }, // ̏
-    { 9, 5, 0, -5, 20, 12, 25833 }, // ̑
-    { 6, 8, 0, -3, 22, 12, 25845 }, // ̒
-    { 6, 7, 0, -3, 22, 11, 25857 }, // ̓
-    { 5, 7, 0, -3, 22, 9, 25868 }, // ̔
-    { 4, 7, 0, -2, 22, 7, 25877 }, // ̕
-    { 6, 6, 0, -3, 16, 9, 25884 }, // ̛
-    { 4, 5, 0, -2, -1, 5, 25893 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 25898 }, // ̤
-    { 6, 6, 0, -3, -1, 9, 25908 }, // ̥
-    { 5, 6, 0, -3, -1, 8, 25917 }, // ̦
-    { 6, 6, 0, -3, -1, 9, 25925 }, // ̧
-    { 6, 7, 0, -3, 1, 11, 25934 }, // ̨
-    { 5, 7, 7, -1, -1, 9, 25945 }, // ̩
-    { 9, 6, 0, -5, -1, 14, 25954 }, // ̭
-    { 8, 6, 0, -4, -1, 12, 25968 }, // ̮
-    { 10, 5, 0, -5, -2, 13, 25980 }, // ̰
-    { 9, 3, 0, -5, -2, 7, 25993 }, // ̱
-    { 8, 5, 0, -4, 20, 10, 26000 }, // ͂
-    { 10, 11, 0, -5, 26, 28, 26010 }, // ̈́
-    { 5, 6, 0, -2, -1, 8, 26038 }, // ͅ
-    { 17, 25, 16, -1, 25, 107, 26046 }, // Ѐ
-    { 17, 24, 16, -1, 24, 102, 26153 }, // Ё
-    { 17, 24, 19, 1, 18, 102, 26255 }, // Ђ
-    { 17, 25, 14, -1, 25, 107, 26357 }, // Ѓ
-    { 17, 19, 16, 0, 18, 81, 26464 }, // Є
-    { 15, 19, 14, -1, 18, 72, 26545 }, // Ѕ
-    { 12, 18, 10, -1, 18, 54, 26617 }, // І
-    { 13, 24, 10, -1, 24, 78, 26671 }, // Ї
-    { 16, 23, 9, -5, 18, 92, 26749 }, // Ј
-    { 25, 19, 23, -2, 18, 119, 26841 }, // Љ
-    { 24, 19, 24, -1, 18, 114, 26960 }, // Њ
-    { 19, 18, 21, 1, 18, 86, 27074 }, // Ћ
-    { 20, 26, 18, -1, 25, 130, 27160 }, // Ќ
-    { 23, 25, 20, -1, 25, 144, 27290 }, // Ѝ
-    { 18, 26, 17, 1, 25, 117, 27434 }, // Ў
-    { 22, 24, 19, -1, 18, 132, 27551 }, // Џ
-    { 20, 18, 19, -2, 18, 90, 27683 }, // А
-    { 17, 19, 16, -1, 18, 81, 27773 }, // Б
-    { 16, 19, 16, -1, 18, 76, 27854 }, // В
-    { 17, 18, 14, -1, 18, 77, 27930 }, // Г
-    { 22, 24, 19, -2, 18, 132, 28007 }, // Д
-    { 17, 18, 16, -1, 18, 77, 28139 }, // Е
-    { 28, 19, 24, -2, 18, 133, 28216 }, // Ж
-    { 15, 19, 14, -1, 18, 72, 28349 }, // З
-    { 23, 18, 20, -1, 18, 104, 28421 }, // И
-    { 23, 25, 20, -1, 25, 144, 28525 }, // Й
-    { 20, 19, 18, -1, 18, 95, 28669 }, // К
-    { 22, 19, 18, -2, 18, 105, 28764 }, // Л
-    { 25, 18, 22, -2, 18, 113, 28869 }, // М
-    { 22, 18, 20, -1, 18, 99, 28982 }, // Н
-    { 18, 19, 18, 0, 18, 86, 29081 }, // О
-    { 22, 18, 19, -1, 18, 99, 29167 }, // П
-    { 17, 18, 15, -1, 18, 77, 29266 }, // Р
-    { 17, 19, 16, 0, 18, 81, 29343 }, // С
-    { 17, 18, 17, 1, 18, 77, 29424 }, // Т
-    { 18, 19, 17, 1, 18, 86, 29501 }, // У
-    { 19, 19, 19, 0, 18, 91, 29587 }, // Ф
-    { 21, 18, 17, -2, 18, 95, 29678 }, // Х
-    { 22, 24, 19, -1, 18, 132, 29773 }, // Ц
-    { 18, 18, 18, 1, 18, 81, 29905 }, // Ч
-    { 28, 18, 25, -1, 18, 126, 29986 }, // Ш
-    { 28, 24, 25, -1, 18, 168, 30112 }, // Щ
-    { 17, 19, 18, 1, 18, 81, 30280 }, // Ъ
-    { 26, 19, 24, -1, 18, 124, 30361 }, // Ы
-    { 16, 19, 15, -1, 18, 76, 30485 }, // Ь
-    { 17, 19, 16, -1, 18, 81, 30561 }, // Э
-    { 27, 19, 26, -1, 18, 129, 30642 }, // Ю
-    { 20, 19, 17, -2, 18, 95, 30771 }, // Я
-    { 15, 15, 15, 0, 14, 57, 30866 }, // а
-    { 15, 22, 14, 0, 21, 83, 30923 }, // б
-    { 13, 15, 13, 0, 14, 49, 31006 }, // в
-    { 11, 15, 11, 0, 14, 42, 31055 }, // г
-    { 14, 21, 14, 0, 20, 74, 31097 }, // д
-    { 12, 15, 12, 0, 14, 45, 31171 }, // е
-    { 23, 15, 22, 0, 14, 87, 31216 }, // ж
-    { 12, 15, 12, -1, 14, 45, 31303 }, // з
-    { 15, 15, 15, 0, 14, 57, 31348 }, // и
-    { 15, 21, 15, 0, 20, 79, 31405 }, // й
-    { 14, 15, 14, 0, 14, 53, 31484 }, // к
-    { 16, 15, 16, -1, 14, 60, 31537 }, // л
-    { 21, 15, 20, -1, 14, 79, 31597 }, // м
-    { 15, 15, 16, 0, 14, 57, 31676 }, // н
-    { 13, 15, 14, 0, 14, 49, 31733 }, // о
-    { 15, 15, 16, 0, 14, 57, 31782 }, // п
-    { 16, 20, 14, -2, 14, 80, 31839 }, // р
-    { 12, 15, 11, 0, 14, 45, 31919 }, // с
-    { 22, 15, 22, 0, 14, 83, 31964 }, // т
-    { 17, 20, 13, -4, 14, 85, 32047 }, // у
-    { 18, 26, 18, 0, 20, 117, 32132 }, // ф
-    { 16, 15, 14, -1, 14, 60, 32249 }, // х
-    { 16, 19, 16, 0, 14, 76, 32309 }, // ц
-    { 15, 15, 15, 0, 14, 57, 32385 }, // ч
-    { 21, 15, 21, 0, 14, 79, 32442 }, // ш
-    { 21, 19, 21, 0, 14, 100, 32521 }, // щ
-    { 13, 15, 14, 0, 14, 49, 32621 }, // ъ
-    { 19, 15, 20, 0, 14, 72, 32670 }, // ы
-    { 12, 15, 13, 0, 14, 45, 32742 }, // ь
-    { 13, 15, 12, -1, 14, 49, 32787 }, // э
-    { 20, 15, 20, 0, 14, 75, 32836 }, // ю
-    { 15, 15, 15, 0, 14, 57, 32911 }, // я
-    { 12, 22, 12, 0, 21, 66, 32968 }, // ѐ
-    { 13, 21, 12, 0, 20, 69, 33034 }, // ё
-    { 14, 26, 14, 0, 20, 91, 33103 }, // ђ
-    { 12, 23, 11, 0, 22, 69, 33194 }, // ѓ
-    { 12, 15, 12, 0, 14, 45, 33263 }, // є
-    { 12, 15, 11, -1, 14, 45, 33308 }, // ѕ
-    { 9, 21, 8, 0, 20, 48, 33353 }, // і
-    { 11, 21, 8, 0, 20, 58, 33401 }, // ї
-    { 14, 26, 8, -5, 20, 91, 33459 }, // ј
-    { 20, 15, 20, -1, 14, 75, 33550 }, // љ
-    { 19, 15, 19, 0, 14, 72, 33625 }, // њ
-    { 15, 21, 15, 0, 20, 79, 33697 }, // ћ
-    { 14, 23, 14, 0, 22, 81, 33776 }, // ќ
-    { 15, 22, 15, 0, 21, 83, 33857 }, // ѝ
-    { 17, 26, 13, -4, 20, 111, 33940 }, // ў
-    { 15, 19, 15, 0, 14, 72, 34051 }, // џ
-    { 16, 21, 18, 1, 20, 84, 34123 }, // Ѣ
-    { 19, 15, 20, 0, 14, 72, 34207 }, // ѣ
-    { 18, 19, 18, 0, 18, 86, 34279 }, // Ѳ
-    { 13, 15, 14, 0, 14, 49, 34365 }, // ѳ
-    { 20, 19, 19, 1, 18, 95, 34414 }, // Ѵ
-    { 16, 15, 15, -1, 14, 60, 34509 }, // ѵ
-    { 23, 31, 20, -1, 25, 179, 34569 }, // Ҋ
-    { 15, 25, 15, 0, 20, 94, 34748 }, // ҋ
-    { 16, 19, 15, -1, 18, 76, 34842 }, // Ҍ
-    { 11, 19, 13, 1, 18, 53, 34918 }, // ҍ
-    { 17, 18, 15, -1, 18, 77, 34971 }, // Ҏ
-    { 16, 20, 14, -2, 14, 80, 35048 }, // ҏ
-    { 17, 21, 14, -1, 21, 90, 35128 }, // Ґ
-    { 13, 18, 12, 0, 17, 59, 35218 }, // ґ
-    { 17, 18, 14, -1, 18, 77, 35277 }, // Ғ
-    { 11, 15, 11, 0, 14, 42, 35354 }, // ғ
-    { 17, 24, 17, -1, 18, 102, 35396 }, // Ҕ
-    { 13, 19, 14, 0, 13, 62, 35498 }, // ҕ
-    { 28, 24, 25, -2, 18, 168, 35560 }, // Җ
-    { 23, 19, 22, 0, 14, 110, 35728 }, // җ
-    { 15, 24, 14, -1, 18, 90, 35838 }, // Ҙ
-    { 12, 19, 12, -1, 14, 57, 35928 }, // ҙ
-    { 20, 24, 18, -1, 18, 120, 35985 }, // Қ
-    { 14, 19, 14, 0, 14, 67, 36105 }, // қ
-    { 21, 19, 18, -1, 18, 100, 36172 }, // Ҝ
-    { 16, 15, 16, 0, 14, 60, 36272 }, // ҝ
-    { 20, 19, 18, -1, 18, 95, 36332 }, // Ҟ
-    { 14, 20, 14, 0, 19, 70, 36427 }, // ҟ
-    { 21, 19, 21, 1, 18, 100, 36497 }, // Ҡ
-    { 16, 15, 16, 0, 14, 60, 36597 }, // ҡ
-    { 22, 24, 20, -1, 18, 132, 36657 }, // Ң
-    { 16, 19, 16, 0, 14, 76, 36789 }, // ң
-    { 26, 18, 23, -1, 18, 117, 36865 }, // Ҥ
-    { 19, 15, 19, 0, 14, 72, 36982 }, // ҥ
-    { 26, 24, 26, -1, 18, 156, 37054 }, // Ҧ
-    { 20, 20, 21, 0, 14, 100, 37210 }, // ҧ
-    { 21, 19, 21, 0, 18, 100, 37310 }, // Ҩ
-    { 16, 15, 16, 0, 14, 60, 37410 }, // ҩ
-    { 17, 24, 16, 0, 18, 102, 37470 }, // Ҫ
-    { 12, 19, 11, 0, 14, 57, 37572 }, // ҫ
-    { 17, 24, 17, 1, 18, 102, 37629 }, // Ҭ
-    { 22, 19, 22, 0, 14, 105, 37731 }, // ҭ
-    { 18, 18, 16, 1, 18, 81, 37836 }, // Ү
-    { 13, 20, 13, 0, 14, 65, 37917 }, // ү
-    { 18, 18, 16, 1, 18, 81, 37982 }, // Ұ
-    { 13, 20, 13, 0, 14, 65, 38063 }, // ұ
-    { 21, 24, 17, -2, 18, 126, 38128 }, // Ҳ
-    { 16, 19, 14, -1, 14, 76, 38254 }, // ҳ
-    { 23, 24, 23, 1, 18, 138, 38330 }, // Ҵ
-    { 16, 23, 16, 0, 18, 92, 38468 }, // ҵ
-    { 18, 24, 18, 1, 18, 108, 38560 }, // Ҷ
-    { 15, 19, 15, 0, 14, 72, 38668 }, // ҷ
-    { 18, 18, 18, 1, 18, 81, 38740 }, // Ҹ
-    { 15, 15, 15, 0, 14, 57, 38821 }, // ҹ
-    { 18, 18, 18, -1, 18, 81, 38878 }, // Һ
-    { 15, 21, 15, 0, 20, 79, 38959 }, // һ
-    { 20, 19, 21, 0, 18, 95, 39038 }, // Ҽ
-    { 15, 15, 15, 0, 14, 57, 39133 }, // ҽ
-    { 20, 24, 21, 0, 18, 120, 39190 }, // Ҿ
-    { 15, 19, 15, 0, 14, 72, 39310 }, // ҿ
-    { 12, 18, 10, -1, 18, 54, 39382 }, // Ӏ
-    { 29, 26, 24, -3, 25, 189, 39436 }, // Ӂ
-    { 23, 21, 22, 0, 20, 121, 39625 }, // ӂ
-    { 20, 24, 18, -1, 18, 120, 39746 }, // Ӄ
-    { 14, 20, 14, 0, 14, 70, 39866 }, // ӄ
-    { 22, 24, 18, -2, 18, 132, 39936 }, // Ӆ
-    { 17, 19, 16, -1, 14, 81, 40068 }, // ӆ
-    { 22, 24, 20, -1, 18, 132, 40149 }, // Ӈ
-    { 15, 20, 15, 0, 14, 75, 40281 }, // ӈ
-    { 22, 24, 20, -1, 18, 132, 40356 }, // Ӊ
-    { 16, 19, 16, 0, 14, 76, 40488 }, // ӊ
-    { 18, 24, 18, 1, 18, 108, 40564 }, // Ӌ
-    { 14, 19, 15, 0, 14, 67, 40672 }, // ӌ
-    { 25, 24, 23, -2, 18, 150, 40739 }, // Ӎ
-    { 21, 19, 20, -1, 14, 100, 40889 }, // ӎ
-    { 12, 20, 10, -1, 20, 60, 40989 }, // ӏ
-    { 20, 25, 19, -2, 25, 125, 41049 }, // Ӑ
-    { 15, 21, 15, 0, 20, 79, 41174 }, // ӑ
-    { 20, 24, 19, -2, 24, 120, 41253 }, // Ӓ
-    { 15, 21, 15, 0, 20, 79, 41373 }, // ӓ
-    { 26, 18, 23, -2, 18, 117, 41452 }, // Ӕ
-    { 20, 15, 20, 0, 14, 75, 41569 }, // ӕ
-    { 17, 25, 16, -1, 25, 107, 41644 }, // Ӗ
-    { 13, 21, 12, 0, 20, 69, 41751 }, // ӗ
-    { 16, 19, 17, 0, 18, 76, 41820 }, // Ә
-    { 12, 15, 12, 0, 14, 45, 41896 }, // ә
-    { 16, 25, 17, 0, 24, 100, 41941 }, // Ӛ
-    { 12, 21, 12, 0, 20, 63, 42041 }, // ӛ
-    { 28, 25, 24, -2, 24, 175, 42104 }, // Ӝ
-    { 23, 21, 22, 0, 20, 121, 42279 }, // ӝ
-    { 15, 25, 14, -1, 24, 94, 42400 }, // Ӟ
-    { 13, 21, 12, -1, 20, 69, 42494 }, // ӟ
-    { 16, 19, 14, -1, 18, 76, 42563 }, // Ӡ
-    { 16, 19, 13, -2, 13, 76, 42639 }, // ӡ
-    { 23, 23, 20, -1, 23, 133, 42715 }, // Ӣ
-    { 15, 19, 15, 0, 18, 72, 42848 }, // ӣ
-    { 23, 24, 20, -1, 24, 138, 42920 }, // Ӥ
-    { 15, 21, 15, 0, 20, 79, 43058 }, // ӥ
-    { 18, 25, 18, 0, 24, 113, 43137 }, // Ӧ
-    { 14, 21, 14, 0, 20, 74, 43250 }, // ӧ
-    { 18, 19, 18, 0, 18, 86, 43324 }, // Ө
-    { 13, 15, 14, 0, 14, 49, 43410 }, // ө
-    { 18, 25, 18, 0, 24, 113, 43459 }, // Ӫ
-    { 14, 21, 14, 0, 20, 74, 43572 }, // ӫ
-    { 17, 25, 16, -1, 24, 107, 43646 }, // Ӭ
-    { 13, 21, 12, -1, 20, 69, 43753 }, // ӭ
-    { 18, 24, 17, 1, 23, 108, 43822 }, // Ӯ
-    { 17, 24, 13, -4, 18, 102, 43930 }, // ӯ
-    { 18, 25, 17, 1, 24, 113, 44032 }, // Ӱ
-    { 17, 26, 13, -4, 20, 111, 44145 }, // ӱ
-    { 18, 26, 17, 1, 25, 117, 44256 }, // Ӳ
-    { 17, 27, 13, -4, 21, 115, 44373 }, // ӳ
-    { 18, 24, 18, 1, 24, 108, 44488 }, // Ӵ
-    { 15, 21, 15, 0, 20, 79, 44596 }, // ӵ
-    { 17, 24, 14, -1, 18, 102, 44675 }, // Ӷ
-    { 11, 19, 11, 0, 14, 53, 44777 }, // ӷ
-    { 26, 25, 24, -1, 24, 163, 44830 }, // Ӹ
-    { 19, 21, 20, 0, 20, 100, 44993 }, // ӹ
-    { 17, 24, 14, -1, 18, 102, 45093 }, // Ӻ
-    { 11, 19, 11, 0, 14, 53, 45195 }, // ӻ
-    { 21, 24, 17, -2, 18, 126, 45248 }, // Ӽ
-    { 16, 20, 14, -1, 14, 80, 45374 }, // ӽ
-    { 21, 18, 17, -2, 18, 95, 45454 }, // Ӿ
-    { 16, 15, 14, -1, 14, 60, 45549 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 45609 }, //  
-    { 0, 0, 25, 0, 0, 0, 45609 }, //  
-    { 0, 0, 13, 0, 0, 0, 45609 }, //  
-    { 0, 0, 25, 0, 0, 0, 45609 }, //  
-    { 0, 0, 8, 0, 0, 0, 45609 }, //  
-    { 0, 0, 6, 0, 0, 0, 45609 }, //  
-    { 0, 0, 4, 0, 0, 0, 45609 }, //  
-    { 0, 0, 16, 0, 0, 0, 45609 }, //  
-    { 0, 0, 8, 0, 0, 0, 45609 }, //  
-    { 0, 0, 5, 0, 0, 0, 45609 }, //  
-    { 0, 0, 1, 0, 0, 0, 45609 }, //  
-    { 0, 0, 0, 0, 0, 0, 45609 }, // ​
-    { 2, 21, 0, -1, 15, 11, 45609 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 45620 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 45655 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 45703 }, // ‏
-    { 8, 3, 10, 1, 8, 6, 45751 }, // ‐
-    { 8, 3, 10, 1, 8, 6, 45757 }, // ‑
-    { 13, 3, 16, 1, 10, 10, 45763 }, // ‒
-    { 13, 3, 13, 0, 8, 10, 45773 }, // –
-    { 25, 3, 25, 0, 8, 19, 45783 }, // —
-    { 25, 3, 25, 0, 8, 19, 45802 }, // ―
-    { 9, 26, 13, 2, 20, 59, 45821 }, // ‖
-    { 13, 7, 13, 0, -1, 23, 45880 }, // ‗
-    { 6, 9, 8, 2, 19, 14, 45903 }, // ‘
-    { 6, 9, 8, 1, 19, 14, 45917 }, // ’
-    { 6, 9, 8, 0, 4, 14, 45931 }, // ‚
-    { 6, 9, 8, 1, 19, 14, 45945 }, // ‛
-    { 11, 9, 13, 2, 19, 25, 45959 }, // “
-    { 12, 9, 13, 1, 19, 27, 45984 }, // ”
-    { 11, 9, 13, 0, 4, 25, 46011 }, // „
-    { 11, 9, 13, 1, 19, 25, 46036 }, // ‟
-    { 11, 17, 12, 1, 18, 47, 46061 }, // †
-    { 13, 20, 12, -1, 18, 65, 46108 }, // ‡
-    { 7, 7, 8, 0, 10, 13, 46173 }, // •
-    { 9, 9, 16, 3, 13, 21, 46186 }, // ‣
-    { 5, 5, 7, 1, 4, 7, 46207 }, // ․
-    { 11, 5, 13, 1, 4, 14, 46214 }, // ‥
-    { 21, 5, 25, 2, 4, 27, 46228 }, // …
-    { 5, 5, 7, 1, 9, 7, 46255 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 46262 }, //  
-    { 0, 0, 0, 0, 0, 0, 46262 }, //  
-    { 8, 24, 0, -4, 18, 48, 46262 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 46310 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 46358 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 46406 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 46472 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 46538 }, //  
-    { 33, 21, 35, 1, 19, 174, 46538 }, // ‰
-    { 6, 9, 6, 0, 18, 14, 46712 }, // ′
-    { 11, 9, 11, 0, 18, 25, 46726 }, // ″
-    { 17, 9, 17, 0, 18, 39, 46751 }, // ‴
-    { 6, 9, 6, 0, 18, 14, 46790 }, // ‵
-    { 12, 9, 12, 0, 18, 27, 46804 }, // ‶
-    { 17, 9, 17, 0, 18, 39, 46831 }, // ‷
-    { 11, 6, 12, 1, 0, 17, 46870 }, // ‸
-    { 9, 11, 9, 0, 12, 25, 46887 }, // ‹
-    { 8, 11, 9, 0, 12, 22, 46912 }, // ›
-    { 16, 18, 16, 0, 17, 72, 46934 }, // ※
-    { 15, 20, 15, 1, 19, 75, 47006 }, // ‼
-    { 13, 3, 13, 0, 21, 10, 47081 }, // ‾
-    { 6, 3, 8, 1, 8, 5, 47091 }, // ⁃
-    { 17, 21, 7, -5, 19, 90, 47096 }, // ⁄
-    { 18, 20, 20, 2, 19, 90, 47186 }, // ⁇
-    { 16, 20, 17, 2, 19, 80, 47276 }, // ⁈
-    { 17, 20, 17, 1, 19, 85, 47356 }, // ⁉
-    { 15, 6, 25, 5, 10, 23, 47441 }, // ⁓
-    { 23, 9, 23, 0, 18, 52, 47464 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 47516 }, //  
-    { 0, 0, 0, 0, 0, 0, 47516 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 47516 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 47516 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 47516 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 47516 }, // ⁤
-    { 11, 12, 11, 0, 21, 33, 47516 }, // ⁰
-    { 11, 12, 11, 0, 21, 33, 47549 }, // ⁴
-    { 11, 13, 11, 0, 21, 36, 47582 }, // ⁵
-    { 10, 12, 11, 1, 21, 30, 47618 }, // ⁶
-    { 9, 13, 11, 2, 21, 30, 47648 }, // ⁷
-    { 11, 12, 11, 0, 21, 33, 47678 }, // ⁸
-    { 11, 12, 11, 0, 21, 33, 47711 }, // ⁹
-    { 11, 10, 14, 2, 18, 28, 47744 }, // ⁿ
-    { 11, 12, 11, 0, 8, 33, 47772 }, // ₀
-    { 8, 13, 11, 1, 9, 26, 47805 }, // ₁
-    { 11, 12, 11, 0, 8, 33, 47831 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 47864 }, // ₃
-    { 11, 12, 11, 0, 8, 33, 47891 }, // ₄
-    { 11, 12, 11, 0, 8, 33, 47924 }, // ₅
-    { 10, 12, 11, 1, 8, 30, 47957 }, // ₆
-    { 9, 12, 11, 2, 8, 27, 47987 }, // ₇
-    { 11, 12, 11, 0, 8, 33, 48014 }, // ₈
-    { 11, 12, 11, 0, 8, 33, 48047 }, // ₉
-    { 17, 18, 16, -1, 18, 77, 48080 }, // ₣
-    { 17, 19, 16, -1, 18, 81, 48157 }, // ₤
-    { 33, 19, 33, 0, 18, 157, 48238 }, // ₧
-    { 18, 19, 16, -1, 18, 86, 48395 }, // €
-    { 17, 12, 25, 4, 15, 51, 48481 }, // ←
-    { 13, 17, 25, 6, 17, 56, 48532 }, // ↑
-    { 17, 12, 25, 4, 15, 51, 48588 }, // →
-    { 13, 17, 25, 6, 17, 56, 48639 }, // ↓
-    { 17, 11, 25, 4, 14, 47, 48695 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 48742 }, // ↕
-    { 13, 18, 25, 6, 18, 59, 48789 }, // ↨
-    { 11, 18, 25, 7, 18, 50, 48848 }, // ↲
-    { 11, 18, 25, 7, 18, 50, 48898 }, // ↳
-    { 15, 14, 25, 5, 16, 53, 48948 }, // ↵
-    { 17, 15, 25, 4, 16, 64, 49001 }, // ⇐
-    { 15, 17, 25, 5, 17, 64, 49065 }, // ⇑
-    { 17, 15, 25, 4, 16, 64, 49129 }, // ⇒
-    { 15, 17, 25, 5, 17, 64, 49193 }, // ⇓
-    { 17, 13, 25, 4, 15, 56, 49257 }, // ⇔
-    { 18, 19, 25, 3, 18, 86, 49313 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 49399 }, // ∂
-    { 13, 18, 25, 6, 18, 59, 49468 }, // ∃
-    { 19, 21, 25, 3, 19, 100, 49527 }, // ∅
-    { 17, 18, 17, 0, 18, 77, 49627 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 49704 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 49785 }, // ∈
-    { 17, 23, 25, 4, 20, 98, 49862 }, // ∉
-    { 17, 15, 25, 4, 16, 64, 49960 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 50024 }, // ∋
-    { 17, 23, 25, 4, 20, 98, 50101 }, // ∌
-    { 17, 15, 25, 4, 16, 64, 50199 }, // ∍
-    { 21, 22, 21, 0, 18, 116, 50263 }, // ∏
-    { 16, 23, 17, 0, 18, 92, 50379 }, // ∑
-    { 12, 3, 16, 2, 10, 9, 50471 }, // −
-    { 15, 20, 13, -1, 18, 75, 50480 }, // ∕
-    { 13, 20, 13, 0, 18, 65, 50555 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 50620 }, // ∗
-    { 10, 10, 16, 3, 13, 25, 50659 }, // ∘
-    { 6, 5, 16, 5, 9, 8, 50684 }, // ∙
-    { 17, 24, 16, -1, 21, 102, 50692 }, // √
-    { 13, 10, 16, 1, 13, 33, 50794 }, // ∝
-    { 16, 10, 16, 0, 13, 40, 50827 }, // ∞
-    { 17, 18, 25, 4, 18, 77, 50867 }, // ∟
-    { 19, 18, 25, 3, 18, 86, 50944 }, // ∠
-    { 4, 26, 13, 4, 20, 26, 51030 }, // ∣
-    { 9, 26, 13, 2, 20, 59, 51056 }, // ∥
-    { 18, 18, 25, 4, 18, 81, 51115 }, // ∧
-    { 18, 18, 25, 4, 18, 81, 51196 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 51277 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 51345 }, // ∪
-    { 15, 26, 16, 0, 20, 98, 51417 }, // ∫
-    { 17, 15, 25, 4, 14, 64, 51515 }, // ∴
-    { 17, 15, 25, 4, 14, 64, 51579 }, // ∵
-    { 6, 15, 8, 1, 16, 23, 51643 }, // ∶
-    { 17, 15, 25, 4, 14, 64, 51666 }, // ∷
-    { 15, 6, 25, 5, 10, 23, 51730 }, // ∼
-    { 15, 15, 25, 5, 16, 57, 51753 }, // ≅
-    { 13, 11, 16, 1, 14, 36, 51810 }, // ≈
-    { 15, 10, 25, 5, 12, 38, 51846 }, // ≍
-    { 12, 13, 16, 2, 15, 39, 51884 }, // ≠
-    { 15, 13, 25, 5, 14, 49, 51923 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 51972 }, // ≤
-    { 12, 16, 16, 2, 16, 48, 52017 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 52065 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 52134 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 52203 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 52267 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 52365 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 52463 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 52540 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 52617 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 52708 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 52799 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 52890 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 52981 }, // ⊥
-    { 6, 5, 16, 5, 9, 8, 53049 }, // ⋅
-    { 23, 5, 25, 1, 9, 29, 53057 }, // ⋯
-    { 25, 24, 25, 0, 21, 150, 53086 }, // �
+    { 17, 19, 16, 0, 18, 81, 2048 }, // C
+    { 19, 19, 18, -1, 18, 91, 2129 }, // D
+    { 17, 18, 16, -1, 18, 77, 2220 }, // E
+    { 16, 18, 14, -1, 18, 72, 2297 }, // F
+    { 18, 19, 18, 0, 18, 86, 2369 }, // G
+    { 22, 18, 20, -1, 18, 99, 2455 }, // H
+    { 12, 18, 10, -1, 18, 54, 2554 }, // I
+    { 16, 23, 9, -5, 18, 92, 2608 }, // J
+    { 20, 19, 18, -1, 18, 95, 2700 }, // K
+    { 15, 18, 14, -1, 18, 68, 2795 }, // L
+    { 25, 18, 22, -2, 18, 113, 2863 }, // M
+    { 22, 19, 19, -1, 18, 105, 2976 }, // N
+    { 18, 19, 18, 0, 18, 86, 3081 }, // O
+    { 17, 18, 15, -1, 18, 77, 3167 }, // P
+    { 22, 24, 19, 0, 18, 132, 3244 }, // Q
+    { 18, 19, 17, -1, 18, 86, 3376 }, // R
+    { 15, 19, 14, -1, 18, 72, 3462 }, // S
+    { 17, 18, 17, 1, 18, 77, 3534 }, // T
+    { 19, 19, 20, 2, 18, 91, 3611 }, // U
+    { 19, 19, 18, 1, 18, 91, 3702 }, // V
+    { 26, 19, 25, 1, 18, 124, 3793 }, // W
+    { 21, 18, 17, -2, 18, 95, 3917 }, // X
+    { 18, 18, 16, 1, 18, 81, 4012 }, // Y
+    { 17, 19, 16, -1, 18, 81, 4096 }, // Z
+    { 12, 24, 8, -2, 20, 72, 4177 }, // [
+    { 11, 20, 13, 1, 18, 55, 4249 }, // <backslash>
+    { 12, 24, 8, -2, 20, 72, 4304 }, // ]
+    { 13, 12, 16, 1, 16, 39, 4376 }, // ^
+    { 13, 3, 13, 0, -1, 10, 4415 }, // _
+    { 6, 7, 16, 5, 21, 11, 4425 }, // `
+    { 15, 15, 15, 0, 14, 57, 4436 }, // a
+    { 14, 21, 14, 0, 20, 74, 4493 }, // b
+    { 12, 15, 11, 0, 14, 45, 4567 }, // c
+    { 15, 21, 15, 0, 20, 79, 4612 }, // d
+    { 12, 15, 12, 0, 14, 45, 4691 }, // e
+    { 19, 26, 11, -5, 20, 124, 4736 }, // f
+    { 17, 20, 13, -2, 14, 85, 4860 }, // g
+    { 15, 21, 15, 0, 20, 79, 4945 }, // h
+    { 9, 21, 8, 0, 20, 48, 5024 }, // i
+    { 14, 26, 8, -5, 20, 91, 5072 }, // j
+    { 13, 21, 13, 0, 20, 69, 5163 }, // k
+    { 8, 21, 8, 0, 20, 42, 5232 }, // l
+    { 22, 15, 22, 0, 14, 83, 5274 }, // m
+    { 15, 15, 16, 0, 14, 57, 5357 }, // n
+    { 13, 15, 14, 0, 14, 49, 5414 }, // o
+    { 16, 20, 14, -2, 14, 80, 5463 }, // p
+    { 14, 20, 14, 0, 14, 70, 5543 }, // q
+    { 13, 14, 12, 0, 14, 46, 5613 }, // r
+    { 12, 15, 11, -1, 14, 45, 5659 }, // s
+    { 11, 18, 11, 0, 17, 50, 5704 }, // t
+    { 15, 15, 15, 0, 14, 57, 5754 }, // u
+    { 13, 15, 13, 0, 14, 49, 5811 }, // v
+    { 19, 15, 19, 0, 14, 72, 5860 }, // w
+    { 16, 15, 14, -1, 14, 60, 5932 }, // x
+    { 17, 20, 13, -4, 14, 85, 5992 }, // y
+    { 14, 15, 12, -1, 14, 53, 6077 }, // z
+    { 11, 25, 10, 1, 20, 69, 6144 }, // {
+    { 9, 23, 8, -1, 20, 52, 6213 }, // |
+    { 11, 25, 10, -1, 20, 69, 6265 }, // }
+    { 13, 5, 16, 1, 11, 17, 6334 }, // ~
+    { 0, 0, 5, 0, 0, 0, 6351 }, //  
+    { 9, 20, 8, -1, 14, 45, 6351 }, // ¡
+    { 14, 25, 16, 1, 20, 88, 6396 }, // ¢
+    { 17, 19, 16, -1, 18, 81, 6484 }, // £
+    { 16, 13, 16, 0, 15, 52, 6565 }, // ¤
+    { 17, 18, 16, 1, 18, 77, 6617 }, // ¥
+    { 9, 23, 8, -1, 20, 52, 6694 }, // ¦
+    { 13, 21, 13, -1, 18, 69, 6746 }, // §
+    { 9, 5, 16, 3, 20, 12, 6815 }, // ¨
+    { 19, 19, 20, 0, 18, 91, 6827 }, // ©
+    { 10, 13, 11, 1, 18, 33, 6918 }, // ª
+    { 15, 11, 15, 0, 12, 42, 6951 }, // «
+    { 12, 7, 16, 2, 12, 21, 6993 }, // ¬
+    { 8, 3, 10, 1, 8, 6, 7014 }, // ­
+    { 14, 14, 15, 0, 20, 49, 7020 }, // ®
+    { 9, 3, 16, 3, 18, 7, 7069 }, // ¯
+    { 10, 10, 13, 2, 18, 25, 7076 }, // °
+    { 12, 16, 16, 2, 15, 48, 7101 }, // ±
+    { 11, 12, 11, 0, 21, 33, 7149 }, // ²
+    { 9, 13, 11, 1, 21, 30, 7182 }, // ³
+    { 6, 7, 16, 5, 22, 11, 7212 }, // ´
+    { 17, 20, 15, -1, 14, 85, 7223 }, // µ
+    { 17, 22, 15, -1, 18, 94, 7308 }, // ¶
+    { 5, 5, 8, 1, 10, 7, 7402 }, // ·
+    { 6, 6, 16, 5, -1, 9, 7409 }, // ¸
+    { 8, 12, 11, 1, 21, 24, 7418 }, // ¹
+    { 10, 13, 11, 1, 18, 33, 7442 }, // º
+    { 15, 11, 15, 0, 12, 42, 7475 }, // »
+    { 26, 21, 27, 1, 19, 137, 7517 }, // ¼
+    { 25, 21, 27, 1, 19, 132, 7654 }, // ½
+    { 26, 21, 27, 1, 19, 137, 7786 }, // ¾
+    { 9, 20, 10, 0, 14, 45, 7923 }, // ¿
+    { 20, 25, 19, -2, 25, 125, 7968 }, // À
+    { 20, 25, 19, -2, 25, 125, 8192 }, // Á
+    { 20, 25, 19, -2, 25, 125, 8317 }, // Â
+    { 20, 24, 19, -2, 24, 120, 8442 }, // Ã
+    { 20, 24, 19, -2, 24, 120, 8562 }, // Ä
+    { 20, 25, 19, -2, 25, 125, 8682 }, // Å
+    { 26, 18, 23, -2, 18, 117, 8807 }, // Æ
+    { 17, 25, 16, 0, 18, 107, 8924 }, // Ç
+    { 17, 25, 16, -1, 25, 107, 9031 }, // È
+    { 17, 25, 16, -1, 25, 107, 9138 }, // É
+    { 17, 25, 16, -1, 25, 107, 9245 }, // Ê
+    { 17, 24, 16, -1, 24, 102, 9352 }, // Ë
+    { 12, 25, 10, -1, 25, 75, 9454 }, // Ì
+    { 13, 25, 10, -1, 25, 82, 9529 }, // Í
+    { 13, 25, 10, -1, 25, 82, 9611 }, // Î
+    { 13, 24, 10, -1, 24, 78, 9693 }, // Ï
+    { 19, 19, 18, -1, 18, 91, 9771 }, // Ð
+    { 22, 25, 19, -1, 24, 138, 9862 }, // Ñ
+    { 18, 26, 18, 0, 25, 117, 10000 }, // Ò
+    { 18, 26, 18, 0, 25, 117, 10117 }, // Ó
+    { 18, 26, 18, 0, 25, 117, 10240 }, // Ô
+    { 18, 25, 18, 0, 24, 113, 10357 }, // Õ
+    { 18, 25, 18, 0, 24, 113, 10470 }, // Ö
+    { 11, 11, 16, 2, 14, 31, 10583 }, // ×
+    { 21, 20, 18, -1, 19, 105, 10614 }, // Ø
+    { 19, 26, 20, 2, 25, 124, 10719 }, // Ù
+    { 19, 26, 20, 2, 25, 124, 10843 }, // Ú
+    { 19, 26, 20, 2, 25, 124, 10967 }, // Û
+    { 19, 25, 20, 2, 24, 119, 11091 }, // Ü
+    { 18, 25, 16, 1, 25, 113, 11210 }, // Ý
+    { 16, 18, 15, -1, 18, 72, 11323 }, // Þ
+    { 21, 26, 16, -5, 20, 137, 11395 }, // ß
+    { 15, 22, 15, 0, 21, 83, 11532 }, // à
+    { 15, 23, 15, 0, 22, 87, 11615 }, // á
+    { 15, 22, 15, 0, 21, 83, 11702 }, // â
+    { 15, 21, 15, 0, 20, 79, 11785 }, // ã
+    { 15, 21, 15, 0, 20, 79, 11864 }, // ä
+    { 15, 22, 15, 0, 21, 83, 11943 }, // å
+    { 20, 15, 20, 0, 14, 75, 12026 }, // æ
+    { 12, 21, 11, 0, 14, 63, 12101 }, // ç
+    { 12, 22, 12, 0, 21, 66, 12164 }, // è
+    { 13, 23, 12, 0, 22, 75, 12288 }, // é
+    { 12, 22, 12, 0, 21, 66, 12363 }, // ê
+    { 13, 21, 12, 0, 20, 69, 12429 }, // ë
+    { 8, 22, 8, 0, 21, 44, 12498 }, // ì
+    { 11, 23, 8, 0, 22, 64, 12542 }, // í
+    { 10, 22, 8, 0, 21, 55, 12606 }, // î
+    { 11, 21, 8, 0, 20, 58, 12661 }, // ï
+    { 14, 22, 14, 0, 21, 77, 12719 }, // ð
+    { 15, 21, 16, 0, 20, 79, 12796 }, // ñ
+    { 13, 22, 14, 0, 21, 72, 12875 }, // ò
+    { 14, 23, 14, 0, 22, 81, 12947 }, // ó
+    { 13, 22, 14, 0, 21, 72, 13028 }, // ô
+    { 14, 21, 14, 0, 20, 74, 13100 }, // õ
+    { 14, 21, 14, 0, 20, 74, 13174 }, // ö
+    { 12, 13, 16, 2, 15, 39, 13248 }, // ÷
+    { 17, 15, 14, -2, 14, 64, 13287 }, // ø
+    { 15, 22, 15, 0, 21, 83, 13351 }, // ù
+    { 15, 23, 15, 0, 22, 87, 13434 }, // ú
+    { 15, 22, 15, 0, 21, 83, 13521 }, // û
+    { 15, 21, 15, 0, 20, 79, 13604 }, // ü
+    { 17, 28, 13, -4, 22, 119, 13683 }, // ý
+    { 17, 26, 14, -3, 20, 111, 13802 }, // þ
+    { 17, 26, 13, -4, 20, 111, 13913 }, // ÿ
+    { 20, 23, 19, -2, 23, 115, 14024 }, // Ā
+    { 15, 19, 15, 0, 18, 72, 14139 }, // ā
+    { 20, 24, 19, -2, 24, 120, 14211 }, // Ă
+    { 15, 21, 15, 0, 20, 79, 14336 }, // ă
+    { 20, 24, 19, -2, 18, 120, 14415 }, // Ą
+    { 15, 20, 15, 0, 14, 75, 14535 }, // ą
+    { 17, 26, 16, 0, 25, 111, 14610 }, // Ć
+    { 13, 23, 11, 0, 22, 75, 14721 }, // ć
+    { 17, 26, 16, 0, 25, 111, 14796 }, // Ĉ
+    { 12, 22, 11, 0, 21, 66, 14907 }, // ĉ
+    { 17, 25, 16, 0, 24, 107, 14973 }, // Ċ
+    { 12, 21, 11, 0, 20, 63, 15080 }, // ċ
+    { 17, 26, 16, 0, 25, 111, 15143 }, // Č
+    { 13, 22, 11, 0, 21, 72, 15254 }, // č
+    { 19, 26, 18, -1, 25, 124, 15326 }, // Ď
+    { 19, 21, 16, 0, 20, 100, 15450 }, // ď
+    { 19, 19, 18, -1, 18, 91, 15550 }, // Đ
+    { 17, 21, 15, 0, 20, 90, 15641 }, // đ
+    { 17, 23, 16, -1, 23, 98, 15731 }, // Ē
+    { 13, 19, 12, 0, 18, 62, 15829 }, // ē
+    { 17, 24, 16, -1, 24, 102, 15891 }, // Ĕ
+    { 13, 21, 12, 0, 20, 69, 15993 }, // ĕ
+    { 17, 24, 16, -1, 24, 102, 16062 }, // Ė
+    { 12, 21, 12, 0, 20, 63, 16164 }, // ė
+    { 17, 24, 16, -1, 18, 102, 16227 }, // Ę
+    { 12, 20, 12, 0, 14, 60, 16384 }, // ę
+    { 17, 25, 16, -1, 25, 107, 16444 }, // Ě
+    { 13, 22, 12, 0, 21, 72, 16551 }, // ě
+    { 18, 26, 18, 0, 25, 117, 16623 }, // Ĝ
+    { 17, 27, 13, -2, 21, 115, 16740 }, // ĝ
+    { 18, 25, 18, 0, 24, 113, 16855 }, // Ğ
+    { 17, 26, 13, -2, 20, 111, 16968 }, // ğ
+    { 18, 25, 18, 0, 24, 113, 17079 }, // Ġ
+    { 17, 26, 13, -2, 20, 111, 17192 }, // ġ
+    { 18, 25, 18, 0, 18, 113, 17303 }, // Ģ
+    { 17, 28, 13, -2, 22, 119, 17416 }, // ģ
+    { 22, 25, 20, -1, 25, 138, 17535 }, // Ĥ
+    { 15, 27, 15, 0, 26, 102, 17673 }, // ĥ
+    { 22, 18, 20, -1, 18, 99, 17775 }, // Ħ
+    { 15, 21, 15, 0, 20, 79, 17874 }, // ħ
+    { 13, 24, 10, -1, 24, 78, 17953 }, // Ĩ
+    { 11, 21, 8, 0, 20, 58, 18031 }, // ĩ
+    { 13, 23, 10, -1, 23, 75, 18089 }, // Ī
+    { 11, 19, 8, 0, 18, 53, 18164 }, // ī
+    { 13, 24, 10, -1, 24, 78, 18217 }, // Ĭ
+    { 11, 21, 8, 0, 20, 58, 18295 }, // ĭ
+    { 12, 24, 10, -1, 18, 72, 18353 }, // Į
+    { 9, 26, 8, 0, 20, 59, 18432 }, // į
+    { 12, 24, 10, -1, 24, 72, 18491 }, // İ
+    { 8, 15, 8, 0, 14, 30, 18563 }, // ı
+    { 22, 23, 19, -1, 18, 127, 18593 }, // Ĳ
+    { 17, 26, 16, 0, 20, 111, 18720 }, // ĳ
+    { 17, 30, 9, -5, 25, 128, 18831 }, // Ĵ
+    { 16, 27, 8, -5, 21, 108, 18959 }, // ĵ
+    { 20, 25, 18, -1, 18, 125, 19067 }, // Ķ
+    { 13, 27, 13, 0, 20, 88, 19192 }, // ķ
+    { 14, 15, 14, 0, 14, 53, 19280 }, // ĸ
+    { 15, 25, 14, -1, 25, 94, 19333 }, // Ĺ
+    { 10, 27, 8, 0, 26, 68, 19427 }, // ĺ
+    { 15, 25, 14, -1, 18, 94, 19495 }, // Ļ
+    { 9, 27, 8, -1, 20, 61, 19589 }, // ļ
+    { 16, 20, 14, -1, 20, 80, 19650 }, // Ľ
+    { 12, 21, 9, 0, 20, 63, 19730 }, // ľ
+    { 16, 18, 14, -1, 18, 72, 19793 }, // Ŀ
+    { 12, 21, 11, 0, 20, 63, 19865 }, // ŀ
+    { 15, 18, 14, -1, 18, 68, 19928 }, // Ł
+    { 10, 21, 8, -1, 20, 53, 19996 }, // ł
+    { 22, 26, 19, -1, 25, 143, 20049 }, // Ń
+    { 15, 23, 16, 0, 22, 87, 20192 }, // ń
+    { 22, 25, 19, -1, 18, 138, 20279 }, // Ņ
+    { 15, 21, 16, 0, 14, 79, 20480 }, // ņ
+    { 22, 26, 19, -1, 25, 143, 20559 }, // Ň
+    { 15, 22, 16, 0, 21, 83, 20702 }, // ň
+    { 20, 20, 21, 1, 19, 100, 20785 }, // ŉ
+    { 22, 23, 19, -1, 18, 127, 20885 }, // Ŋ
+    { 14, 20, 15, 0, 14, 70, 21012 }, // ŋ
+    { 18, 24, 18, 0, 23, 108, 21082 }, // Ō
+    { 14, 19, 14, 0, 18, 67, 21190 }, // ō
+    { 18, 25, 18, 0, 24, 113, 21257 }, // Ŏ
+    { 14, 21, 14, 0, 20, 74, 21370 }, // ŏ
+    { 19, 26, 18, 0, 25, 124, 21444 }, // Ő
+    { 15, 22, 14, 0, 21, 83, 21568 }, // ő
+    { 25, 19, 25, 0, 18, 119, 21651 }, // Œ
+    { 20, 15, 20, 0, 14, 75, 21770 }, // œ
+    { 18, 26, 17, -1, 25, 117, 21845 }, // Ŕ
+    { 13, 22, 12, 0, 22, 72, 21962 }, // ŕ
+    { 18, 25, 17, -1, 18, 113, 22034 }, // Ŗ
+    { 14, 21, 12, -1, 14, 74, 22147 }, // ŗ
+    { 18, 26, 17, -1, 25, 117, 22221 }, // Ř
+    { 13, 21, 12, 0, 21, 69, 22338 }, // ř
+    { 15, 26, 14, -1, 25, 98, 22407 }, // Ś
+    { 13, 23, 11, -1, 22, 75, 22528 }, // ś
+    { 15, 26, 14, -1, 25, 98, 22603 }, // Ŝ
+    { 13, 22, 11, -1, 21, 72, 22701 }, // ŝ
+    { 15, 25, 14, -1, 18, 94, 22773 }, // Ş
+    { 12, 21, 11, -1, 14, 63, 22867 }, // ş
+    { 16, 26, 14, -1, 25, 104, 22930 }, // Š
+    { 14, 22, 11, -1, 21, 77, 23034 }, // š
+    { 17, 25, 17, 1, 18, 107, 23111 }, // Ţ
+    { 11, 24, 11, 0, 17, 66, 23218 }, // ţ
+    { 17, 25, 17, 1, 25, 107, 23284 }, // Ť
+    { 13, 21, 11, 0, 20, 69, 23391 }, // ť
+    { 17, 18, 17, 1, 18, 77, 23460 }, // Ŧ
+    { 11, 18, 11, 0, 17, 50, 23537 }, // ŧ
+    { 19, 25, 20, 2, 24, 119, 23587 }, // Ũ
+    { 15, 21, 15, 0, 20, 79, 23706 }, // ũ
+    { 19, 24, 20, 2, 23, 114, 23785 }, // Ū
+    { 15, 19, 15, 0, 18, 72, 23899 }, // ū
+    { 19, 25, 20, 2, 24, 119, 23971 }, // Ŭ
+    { 15, 21, 15, 0, 20, 79, 24090 }, // ŭ
+    { 19, 26, 20, 2, 25, 124, 24169 }, // Ů
+    { 15, 22, 15, 0, 21, 83, 24293 }, // ů
+    { 19, 26, 20, 2, 25, 124, 24376 }, // Ű
+    { 15, 22, 15, 0, 21, 83, 24576 }, // ű
+    { 19, 24, 20, 2, 18, 114, 24659 }, // Ų
+    { 15, 20, 15, 0, 14, 75, 24773 }, // ų
+    { 26, 26, 25, 1, 25, 169, 24848 }, // Ŵ
+    { 19, 22, 19, 0, 21, 105, 25017 }, // ŵ
+    { 18, 25, 16, 1, 25, 113, 25122 }, // Ŷ
+    { 17, 27, 13, -4, 21, 115, 25235 }, // ŷ
+    { 18, 24, 16, 1, 24, 108, 25350 }, // Ÿ
+    { 17, 26, 16, -1, 25, 111, 25458 }, // Ź
+    { 14, 23, 12, -1, 22, 81, 25569 }, // ź
+    { 17, 25, 16, -1, 24, 107, 25650 }, // Ż
+    { 14, 21, 12, -1, 20, 74, 25757 }, // ż
+    { 17, 26, 16, -1, 25, 111, 25831 }, // Ž
+    { 14, 22, 12, -1, 21, 77, 25942 }, // ž
+    { 19, 26, 11, -5, 20, 124, 26019 }, // ſ
+    { 6, 7, 0, -4, 21, 11, 26143 }, // ̀
+    { 6, 7, 0, -2, 22, 11, 26154 }, // ́
+    { 9, 7, 0, -5, 21, 16, 26165 }, // ̂
+    { 10, 5, 0, -5, 20, 13, 26181 }, // ̃
+    { 9, 3, 0, -5, 18, 7, 26194 }, // ̄
+    { 8, 5, 0, -4, 20, 10, 26201 }, // ̆
+    { 4, 5, 0, -2, 20, 5, 26211 }, // ̇
+    { 10, 5, 0, -5, 20, 13, 26216 }, // ̈
+    { 7, 8, 0, -3, 22, 14, 26229 }, // ̉
+    { 8, 7, 0, -4, 21, 14, 26243 }, // ̊
+    { 11, 7, 0, -5, 21, 20, 26257 }, // ̋
+    { 9, 6, 0, -4, 21, 14, 26277 }, // ̌
+    { 8, 7, 0, -5, 21, 14, 26291 }, // ̏
+    { 9, 5, 0, -5, 20, 12, 26305 }, // ̑
+    { 6, 8, 0, -3, 22, 12, 26317 }, // ̒
+    { 6, 7, 0, -3, 22, 11, 26329 }, // ̓
+    { 5, 7, 0, -3, 22, 9, 26340 }, // ̔
+    { 4, 7, 0, -2, 22, 7, 26349 }, // ̕
+    { 6, 6, 0, -3, 16, 9, 26356 }, // ̛
+    { 4, 5, 0, -2, -1, 5, 26365 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 26370 }, // ̤
+    { 6, 6, 0, -3, -1, 9, 26380 }, // ̥
+    { 5, 6, 0, -3, -1, 8, 26389 }, // ̦
+    { 6, 6, 0, -3, -1, 9, 26397 }, // ̧
+    { 6, 7, 0, -3, 1, 11, 26406 }, // ̨
+    { 5, 7, 7, -1, -1, 9, 26417 }, // ̩
+    { 9, 6, 0, -5, -1, 14, 26426 }, // ̭
+    { 8, 6, 0, -4, -1, 12, 26440 }, // ̮
+    { 10, 5, 0, -5, -2, 13, 26452 }, // ̰
+    { 9, 3, 0, -5, -2, 7, 26465 }, // ̱
+    { 8, 5, 0, -4, 20, 10, 26472 }, // ͂
+    { 10, 11, 0, -5, 26, 28, 26482 }, // ̈́
+    { 5, 6, 0, -2, -1, 8, 26510 }, // ͅ
+    { 17, 25, 16, -1, 25, 107, 26624 }, // Ѐ
+    { 17, 24, 16, -1, 24, 102, 26731 }, // Ё
+    { 17, 24, 19, 1, 18, 102, 26833 }, // Ђ
+    { 17, 25, 14, -1, 25, 107, 26935 }, // Ѓ
+    { 17, 19, 16, 0, 18, 81, 27042 }, // Є
+    { 15, 19, 14, -1, 18, 72, 27123 }, // Ѕ
+    { 12, 18, 10, -1, 18, 54, 27195 }, // І
+    { 13, 24, 10, -1, 24, 78, 27249 }, // Ї
+    { 16, 23, 9, -5, 18, 92, 27327 }, // Ј
+    { 25, 19, 23, -2, 18, 119, 27419 }, // Љ
+    { 24, 19, 24, -1, 18, 114, 27538 }, // Њ
+    { 19, 18, 21, 1, 18, 86, 27652 }, // Ћ
+    { 20, 26, 18, -1, 25, 130, 27738 }, // Ќ
+    { 23, 25, 20, -1, 25, 144, 27868 }, // Ѝ
+    { 18, 26, 17, 1, 25, 117, 28012 }, // Ў
+    { 22, 24, 19, -1, 18, 132, 28129 }, // Џ
+    { 20, 18, 19, -2, 18, 90, 28261 }, // А
+    { 17, 19, 16, -1, 18, 81, 28351 }, // Б
+    { 16, 19, 16, -1, 18, 76, 28432 }, // В
+    { 17, 18, 14, -1, 18, 77, 28508 }, // Г
+    { 22, 24, 19, -2, 18, 132, 28672 }, // Д
+    { 17, 18, 16, -1, 18, 77, 28804 }, // Е
+    { 28, 19, 24, -2, 18, 133, 28881 }, // Ж
+    { 15, 19, 14, -1, 18, 72, 29014 }, // З
+    { 23, 18, 20, -1, 18, 104, 29086 }, // И
+    { 23, 25, 20, -1, 25, 144, 29190 }, // Й
+    { 20, 19, 18, -1, 18, 95, 29334 }, // К
+    { 22, 19, 18, -2, 18, 105, 29429 }, // Л
+    { 25, 18, 22, -2, 18, 113, 29534 }, // М
+    { 22, 18, 20, -1, 18, 99, 29647 }, // Н
+    { 18, 19, 18, 0, 18, 86, 29746 }, // О
+    { 22, 18, 19, -1, 18, 99, 29832 }, // П
+    { 17, 18, 15, -1, 18, 77, 29931 }, // Р
+    { 17, 19, 16, 0, 18, 81, 30008 }, // С
+    { 17, 18, 17, 1, 18, 77, 30089 }, // Т
+    { 18, 19, 17, 1, 18, 86, 30166 }, // У
+    { 19, 19, 19, 0, 18, 91, 30252 }, // Ф
+    { 21, 18, 17, -2, 18, 95, 30343 }, // Х
+    { 22, 24, 19, -1, 18, 132, 30438 }, // Ц
+    { 18, 18, 18, 1, 18, 81, 30570 }, // Ч
+    { 28, 18, 25, -1, 18, 126, 30720 }, // Ш
+    { 28, 24, 25, -1, 18, 168, 30846 }, // Щ
+    { 17, 19, 18, 1, 18, 81, 31014 }, // Ъ
+    { 26, 19, 24, -1, 18, 124, 31095 }, // Ы
+    { 16, 19, 15, -1, 18, 76, 31219 }, // Ь
+    { 17, 19, 16, -1, 18, 81, 31295 }, // Э
+    { 27, 19, 26, -1, 18, 129, 31376 }, // Ю
+    { 20, 19, 17, -2, 18, 95, 31505 }, // Я
+    { 15, 15, 15, 0, 14, 57, 31600 }, // а
+    { 15, 22, 14, 0, 21, 83, 31657 }, // б
+    { 13, 15, 13, 0, 14, 49, 31740 }, // в
+    { 11, 15, 11, 0, 14, 42, 31789 }, // г
+    { 14, 21, 14, 0, 20, 74, 31831 }, // д
+    { 12, 15, 12, 0, 14, 45, 31905 }, // е
+    { 23, 15, 22, 0, 14, 87, 31950 }, // ж
+    { 12, 15, 12, -1, 14, 45, 32037 }, // з
+    { 15, 15, 15, 0, 14, 57, 32082 }, // и
+    { 15, 21, 15, 0, 20, 79, 32139 }, // й
+    { 14, 15, 14, 0, 14, 53, 32218 }, // к
+    { 16, 15, 16, -1, 14, 60, 32271 }, // л
+    { 21, 15, 20, -1, 14, 79, 32331 }, // м
+    { 15, 15, 16, 0, 14, 57, 32410 }, // н
+    { 13, 15, 14, 0, 14, 49, 32467 }, // о
+    { 15, 15, 16, 0, 14, 57, 32516 }, // п
+    { 16, 20, 14, -2, 14, 80, 32573 }, // р
+    { 12, 15, 11, 0, 14, 45, 32653 }, // с
+    { 22, 15, 22, 0, 14, 83, 32768 }, // т
+    { 17, 20, 13, -4, 14, 85, 32851 }, // у
+    { 18, 26, 18, 0, 20, 117, 32936 }, // ф
+    { 16, 15, 14, -1, 14, 60, 33053 }, // х
+    { 16, 19, 16, 0, 14, 76, 33113 }, // ц
+    { 15, 15, 15, 0, 14, 57, 33189 }, // ч
+    { 21, 15, 21, 0, 14, 79, 33246 }, // ш
+    { 21, 19, 21, 0, 14, 100, 33325 }, // щ
+    { 13, 15, 14, 0, 14, 49, 33425 }, // ъ
+    { 19, 15, 20, 0, 14, 72, 33474 }, // ы
+    { 12, 15, 13, 0, 14, 45, 33546 }, // ь
+    { 13, 15, 12, -1, 14, 49, 33591 }, // э
+    { 20, 15, 20, 0, 14, 75, 33640 }, // ю
+    { 15, 15, 15, 0, 14, 57, 33715 }, // я
+    { 12, 22, 12, 0, 21, 66, 33772 }, // ѐ
+    { 13, 21, 12, 0, 20, 69, 33838 }, // ё
+    { 14, 26, 14, 0, 20, 91, 33907 }, // ђ
+    { 12, 23, 11, 0, 22, 69, 33998 }, // ѓ
+    { 12, 15, 12, 0, 14, 45, 34067 }, // є
+    { 12, 15, 11, -1, 14, 45, 34112 }, // ѕ
+    { 9, 21, 8, 0, 20, 48, 34157 }, // і
+    { 11, 21, 8, 0, 20, 58, 34205 }, // ї
+    { 14, 26, 8, -5, 20, 91, 34263 }, // ј
+    { 20, 15, 20, -1, 14, 75, 34354 }, // љ
+    { 19, 15, 19, 0, 14, 72, 34429 }, // њ
+    { 15, 21, 15, 0, 20, 79, 34501 }, // ћ
+    { 14, 23, 14, 0, 22, 81, 34580 }, // ќ
+    { 15, 22, 15, 0, 21, 83, 34661 }, // ѝ
+    { 17, 26, 13, -4, 20, 111, 34816 }, // ў
+    { 15, 19, 15, 0, 14, 72, 34927 }, // џ
+    { 16, 21, 18, 1, 20, 84, 34999 }, // Ѣ
+    { 19, 15, 20, 0, 14, 72, 35083 }, // ѣ
+    { 18, 19, 18, 0, 18, 86, 35155 }, // Ѳ
+    { 13, 15, 14, 0, 14, 49, 35241 }, // ѳ
+    { 20, 19, 19, 1, 18, 95, 35290 }, // Ѵ
+    { 16, 15, 15, -1, 14, 60, 35385 }, // ѵ
+    { 23, 31, 20, -1, 25, 179, 35445 }, // Ҋ
+    { 15, 25, 15, 0, 20, 94, 35624 }, // ҋ
+    { 16, 19, 15, -1, 18, 76, 35718 }, // Ҍ
+    { 11, 19, 13, 1, 18, 53, 35794 }, // ҍ
+    { 17, 18, 15, -1, 18, 77, 35847 }, // Ҏ
+    { 16, 20, 14, -2, 14, 80, 35924 }, // ҏ
+    { 17, 21, 14, -1, 21, 90, 36004 }, // Ґ
+    { 13, 18, 12, 0, 17, 59, 36094 }, // ґ
+    { 17, 18, 14, -1, 18, 77, 36153 }, // Ғ
+    { 11, 15, 11, 0, 14, 42, 36230 }, // ғ
+    { 17, 24, 17, -1, 18, 102, 36272 }, // Ҕ
+    { 13, 19, 14, 0, 13, 62, 36374 }, // ҕ
+    { 28, 24, 25, -2, 18, 168, 36436 }, // Җ
+    { 23, 19, 22, 0, 14, 110, 36604 }, // җ
+    { 15, 24, 14, -1, 18, 90, 36714 }, // Ҙ
+    { 12, 19, 12, -1, 14, 57, 36804 }, // ҙ
+    { 20, 24, 18, -1, 18, 120, 36864 }, // Қ
+    { 14, 19, 14, 0, 14, 67, 36984 }, // қ
+    { 21, 19, 18, -1, 18, 100, 37051 }, // Ҝ
+    { 16, 15, 16, 0, 14, 60, 37151 }, // ҝ
+    { 20, 19, 18, -1, 18, 95, 37211 }, // Ҟ
+    { 14, 20, 14, 0, 19, 70, 37306 }, // ҟ
+    { 21, 19, 21, 1, 18, 100, 37376 }, // Ҡ
+    { 16, 15, 16, 0, 14, 60, 37476 }, // ҡ
+    { 22, 24, 20, -1, 18, 132, 37536 }, // Ң
+    { 16, 19, 16, 0, 14, 76, 37668 }, // ң
+    { 26, 18, 23, -1, 18, 117, 37744 }, // Ҥ
+    { 19, 15, 19, 0, 14, 72, 37861 }, // ҥ
+    { 26, 24, 26, -1, 18, 156, 37933 }, // Ҧ
+    { 20, 20, 21, 0, 14, 100, 38089 }, // ҧ
+    { 21, 19, 21, 0, 18, 100, 38189 }, // Ҩ
+    { 16, 15, 16, 0, 14, 60, 38289 }, // ҩ
+    { 17, 24, 16, 0, 18, 102, 38349 }, // Ҫ
+    { 12, 19, 11, 0, 14, 57, 38451 }, // ҫ
+    { 17, 24, 17, 1, 18, 102, 38508 }, // Ҭ
+    { 22, 19, 22, 0, 14, 105, 38610 }, // ҭ
+    { 18, 18, 16, 1, 18, 81, 38715 }, // Ү
+    { 13, 20, 13, 0, 14, 65, 38796 }, // ү
+    { 18, 18, 16, 1, 18, 81, 38912 }, // Ұ
+    { 13, 20, 13, 0, 14, 65, 38993 }, // ұ
+    { 21, 24, 17, -2, 18, 126, 39058 }, // Ҳ
+    { 16, 19, 14, -1, 14, 76, 39184 }, // ҳ
+    { 23, 24, 23, 1, 18, 138, 39260 }, // Ҵ
+    { 16, 23, 16, 0, 18, 92, 39398 }, // ҵ
+    { 18, 24, 18, 1, 18, 108, 39490 }, // Ҷ
+    { 15, 19, 15, 0, 14, 72, 39598 }, // ҷ
+    { 18, 18, 18, 1, 18, 81, 39670 }, // Ҹ
+    { 15, 15, 15, 0, 14, 57, 39751 }, // ҹ
+    { 18, 18, 18, -1, 18, 81, 39808 }, // Һ
+    { 15, 21, 15, 0, 20, 79, 39889 }, // һ
+    { 20, 19, 21, 0, 18, 95, 39968 }, // Ҽ
+    { 15, 15, 15, 0, 14, 57, 40063 }, // ҽ
+    { 20, 24, 21, 0, 18, 120, 40120 }, // Ҿ
+    { 15, 19, 15, 0, 14, 72, 40240 }, // ҿ
+    { 12, 18, 10, -1, 18, 54, 40312 }, // Ӏ
+    { 29, 26, 24, -3, 25, 189, 40366 }, // Ӂ
+    { 23, 21, 22, 0, 20, 121, 40555 }, // ӂ
+    { 20, 24, 18, -1, 18, 120, 40676 }, // Ӄ
+    { 14, 20, 14, 0, 14, 70, 40796 }, // ӄ
+    { 22, 24, 18, -2, 18, 132, 40960 }, // Ӆ
+    { 17, 19, 16, -1, 14, 81, 41092 }, // ӆ
+    { 22, 24, 20, -1, 18, 132, 41173 }, // Ӈ
+    { 15, 20, 15, 0, 14, 75, 41305 }, // ӈ
+    { 22, 24, 20, -1, 18, 132, 41380 }, // Ӊ
+    { 16, 19, 16, 0, 14, 76, 41512 }, // ӊ
+    { 18, 24, 18, 1, 18, 108, 41588 }, // Ӌ
+    { 14, 19, 15, 0, 14, 67, 41696 }, // ӌ
+    { 25, 24, 23, -2, 18, 150, 41763 }, // Ӎ
+    { 21, 19, 20, -1, 14, 100, 41913 }, // ӎ
+    { 12, 20, 10, -1, 20, 60, 42013 }, // ӏ
+    { 20, 25, 19, -2, 25, 125, 42073 }, // Ӑ
+    { 15, 21, 15, 0, 20, 79, 42198 }, // ӑ
+    { 20, 24, 19, -2, 24, 120, 42277 }, // Ӓ
+    { 15, 21, 15, 0, 20, 79, 42397 }, // ӓ
+    { 26, 18, 23, -2, 18, 117, 42476 }, // Ӕ
+    { 20, 15, 20, 0, 14, 75, 42593 }, // ӕ
+    { 17, 25, 16, -1, 25, 107, 42668 }, // Ӗ
+    { 13, 21, 12, 0, 20, 69, 42775 }, // ӗ
+    { 16, 19, 17, 0, 18, 76, 42844 }, // Ә
+    { 12, 15, 12, 0, 14, 45, 42920 }, // ә
+    { 16, 25, 17, 0, 24, 100, 43008 }, // Ӛ
+    { 12, 21, 12, 0, 20, 63, 43108 }, // ӛ
+    { 28, 25, 24, -2, 24, 175, 43171 }, // Ӝ
+    { 23, 21, 22, 0, 20, 121, 43346 }, // ӝ
+    { 15, 25, 14, -1, 24, 94, 43467 }, // Ӟ
+    { 13, 21, 12, -1, 20, 69, 43561 }, // ӟ
+    { 16, 19, 14, -1, 18, 76, 43630 }, // Ӡ
+    { 16, 19, 13, -2, 13, 76, 43706 }, // ӡ
+    { 23, 23, 20, -1, 23, 133, 43782 }, // Ӣ
+    { 15, 19, 15, 0, 18, 72, 43915 }, // ӣ
+    { 23, 24, 20, -1, 24, 138, 43987 }, // Ӥ
+    { 15, 21, 15, 0, 20, 79, 44125 }, // ӥ
+    { 18, 25, 18, 0, 24, 113, 44204 }, // Ӧ
+    { 14, 21, 14, 0, 20, 74, 44317 }, // ӧ
+    { 18, 19, 18, 0, 18, 86, 44391 }, // Ө
+    { 13, 15, 14, 0, 14, 49, 44477 }, // ө
+    { 18, 25, 18, 0, 24, 113, 44526 }, // Ӫ
+    { 14, 21, 14, 0, 20, 74, 44639 }, // ӫ
+    { 17, 25, 16, -1, 24, 107, 44713 }, // Ӭ
+    { 13, 21, 12, -1, 20, 69, 44820 }, // ӭ
+    { 18, 24, 17, 1, 23, 108, 44889 }, // Ӯ
+    { 17, 24, 13, -4, 18, 102, 45056 }, // ӯ
+    { 18, 25, 17, 1, 24, 113, 45158 }, // Ӱ
+    { 17, 26, 13, -4, 20, 111, 45271 }, // ӱ
+    { 18, 26, 17, 1, 25, 117, 45382 }, // Ӳ
+    { 17, 27, 13, -4, 21, 115, 45499 }, // ӳ
+    { 18, 24, 18, 1, 24, 108, 45614 }, // Ӵ
+    { 15, 21, 15, 0, 20, 79, 45722 }, // ӵ
+    { 17, 24, 14, -1, 18, 102, 45801 }, // Ӷ
+    { 11, 19, 11, 0, 14, 53, 45903 }, // ӷ
+    { 26, 25, 24, -1, 24, 163, 45956 }, // Ӹ
+    { 19, 21, 20, 0, 20, 100, 46119 }, // ӹ
+    { 17, 24, 14, -1, 18, 102, 46219 }, // Ӻ
+    { 11, 19, 11, 0, 14, 53, 46321 }, // ӻ
+    { 21, 24, 17, -2, 18, 126, 46374 }, // Ӽ
+    { 16, 20, 14, -1, 14, 80, 46500 }, // ӽ
+    { 21, 18, 17, -2, 18, 95, 46580 }, // Ӿ
+    { 16, 15, 14, -1, 14, 60, 46675 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 46735 }, //  
+    { 0, 0, 25, 0, 0, 0, 46735 }, //  
+    { 0, 0, 13, 0, 0, 0, 46735 }, //  
+    { 0, 0, 25, 0, 0, 0, 46735 }, //  
+    { 0, 0, 8, 0, 0, 0, 46735 }, //  
+    { 0, 0, 6, 0, 0, 0, 46735 }, //  
+    { 0, 0, 4, 0, 0, 0, 46735 }, //  
+    { 0, 0, 16, 0, 0, 0, 46735 }, //  
+    { 0, 0, 8, 0, 0, 0, 46735 }, //  
+    { 0, 0, 5, 0, 0, 0, 46735 }, //  
+    { 0, 0, 1, 0, 0, 0, 46735 }, //  
+    { 0, 0, 0, 0, 0, 0, 46735 }, // ​
+    { 2, 21, 0, -1, 15, 11, 46735 }, // ‌
+    { 6, 23, 0, -3, 17, 35, 46746 }, // ‍
+    { 8, 24, 0, -4, 18, 48, 46781 }, // ‎
+    { 8, 24, 0, -4, 18, 48, 46829 }, // ‏
+    { 8, 3, 10, 1, 8, 6, 46877 }, // ‐
+    { 8, 3, 10, 1, 8, 6, 46883 }, // ‑
+    { 13, 3, 16, 1, 10, 10, 46889 }, // ‒
+    { 13, 3, 13, 0, 8, 10, 46899 }, // –
+    { 25, 3, 25, 0, 8, 19, 46909 }, // —
+    { 25, 3, 25, 0, 8, 19, 46928 }, // ―
+    { 9, 26, 13, 2, 20, 59, 46947 }, // ‖
+    { 13, 7, 13, 0, -1, 23, 47006 }, // ‗
+    { 6, 9, 8, 2, 19, 14, 47029 }, // ‘
+    { 6, 9, 8, 1, 19, 14, 47043 }, // ’
+    { 6, 9, 8, 0, 4, 14, 47057 }, // ‚
+    { 6, 9, 8, 1, 19, 14, 47071 }, // ‛
+    { 11, 9, 13, 2, 19, 25, 47104 }, // “
+    { 12, 9, 13, 1, 19, 27, 47129 }, // ”
+    { 11, 9, 13, 0, 4, 25, 47156 }, // „
+    { 11, 9, 13, 1, 19, 25, 47181 }, // ‟
+    { 11, 17, 12, 1, 18, 47, 47206 }, // †
+    { 13, 20, 12, -1, 18, 65, 47253 }, // ‡
+    { 7, 7, 8, 0, 10, 13, 47318 }, // •
+    { 9, 9, 16, 3, 13, 21, 47331 }, // ‣
+    { 5, 5, 7, 1, 4, 7, 47352 }, // ․
+    { 11, 5, 13, 1, 4, 14, 47359 }, // ‥
+    { 21, 5, 25, 2, 4, 27, 47373 }, // …
+    { 5, 5, 7, 1, 9, 7, 47400 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 47407 }, //  
+    { 0, 0, 0, 0, 0, 0, 47407 }, //  
+    { 8, 24, 0, -4, 18, 48, 47407 }, // ‪
+    { 8, 24, 0, -4, 18, 48, 47455 }, // ‫
+    { 8, 24, 0, -4, 18, 48, 47503 }, // ‬
+    { 11, 24, 0, -5, 18, 66, 47551 }, // ‭
+    { 11, 24, 0, -5, 18, 66, 47617 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 47683 }, //  
+    { 33, 21, 35, 1, 19, 174, 47683 }, // ‰
+    { 6, 9, 6, 0, 18, 14, 47857 }, // ′
+    { 11, 9, 11, 0, 18, 25, 47871 }, // ″
+    { 17, 9, 17, 0, 18, 39, 47896 }, // ‴
+    { 6, 9, 6, 0, 18, 14, 47935 }, // ‵
+    { 12, 9, 12, 0, 18, 27, 47949 }, // ‶
+    { 17, 9, 17, 0, 18, 39, 47976 }, // ‷
+    { 11, 6, 12, 1, 0, 17, 48015 }, // ‸
+    { 9, 11, 9, 0, 12, 25, 48032 }, // ‹
+    { 8, 11, 9, 0, 12, 22, 48057 }, // ›
+    { 16, 18, 16, 0, 17, 72, 48079 }, // ※
+    { 15, 20, 15, 1, 19, 75, 48151 }, // ‼
+    { 13, 3, 13, 0, 21, 10, 48226 }, // ‾
+    { 6, 3, 8, 1, 8, 5, 48236 }, // ⁃
+    { 17, 21, 7, -5, 19, 90, 48241 }, // ⁄
+    { 18, 20, 20, 2, 19, 90, 48331 }, // ⁇
+    { 16, 20, 17, 2, 19, 80, 48421 }, // ⁈
+    { 17, 20, 17, 1, 19, 85, 48501 }, // ⁉
+    { 15, 6, 25, 5, 10, 23, 48586 }, // ⁓
+    { 23, 9, 23, 0, 18, 52, 48609 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 48661 }, //  
+    { 0, 0, 0, 0, 0, 0, 48661 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 48661 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 48661 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 48661 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 48661 }, // ⁤
+    { 11, 12, 11, 0, 21, 33, 48661 }, // ⁰
+    { 11, 12, 11, 0, 21, 33, 48694 }, // ⁴
+    { 11, 13, 11, 0, 21, 36, 48727 }, // ⁵
+    { 10, 12, 11, 1, 21, 30, 48763 }, // ⁶
+    { 9, 13, 11, 2, 21, 30, 48793 }, // ⁷
+    { 11, 12, 11, 0, 21, 33, 48823 }, // ⁸
+    { 11, 12, 11, 0, 21, 33, 48856 }, // ⁹
+    { 11, 10, 14, 2, 18, 28, 48889 }, // ⁿ
+    { 11, 12, 11, 0, 8, 33, 48917 }, // ₀
+    { 8, 13, 11, 1, 9, 26, 48950 }, // ₁
+    { 11, 12, 11, 0, 8, 33, 48976 }, // ₂
+    { 9, 12, 11, 1, 8, 27, 49009 }, // ₃
+    { 11, 12, 11, 0, 8, 33, 49036 }, // ₄
+    { 11, 12, 11, 0, 8, 33, 49069 }, // ₅
+    { 10, 12, 11, 1, 8, 30, 49102 }, // ₆
+    { 9, 12, 11, 2, 8, 27, 49152 }, // ₇
+    { 11, 12, 11, 0, 8, 33, 49179 }, // ₈
+    { 11, 12, 11, 0, 8, 33, 49212 }, // ₉
+    { 17, 18, 16, -1, 18, 77, 49245 }, // ₣
+    { 17, 19, 16, -1, 18, 81, 49322 }, // ₤
+    { 33, 19, 33, 0, 18, 157, 49403 }, // ₧
+    { 18, 19, 16, -1, 18, 86, 49560 }, // €
+    { 17, 12, 25, 4, 15, 51, 49646 }, // ←
+    { 13, 17, 25, 6, 17, 56, 49697 }, // ↑
+    { 17, 12, 25, 4, 15, 51, 49753 }, // →
+    { 13, 17, 25, 6, 17, 56, 49804 }, // ↓
+    { 17, 11, 25, 4, 14, 47, 49860 }, // ↔
+    { 11, 17, 25, 7, 17, 47, 49907 }, // ↕
+    { 13, 18, 25, 6, 18, 59, 49954 }, // ↨
+    { 11, 18, 25, 7, 18, 50, 50013 }, // ↲
+    { 11, 18, 25, 7, 18, 50, 50063 }, // ↳
+    { 15, 14, 25, 5, 16, 53, 50113 }, // ↵
+    { 17, 15, 25, 4, 16, 64, 50166 }, // ⇐
+    { 15, 17, 25, 5, 17, 64, 50230 }, // ⇑
+    { 17, 15, 25, 4, 16, 64, 50294 }, // ⇒
+    { 15, 17, 25, 5, 17, 64, 50358 }, // ⇓
+    { 17, 13, 25, 4, 15, 56, 50422 }, // ⇔
+    { 18, 19, 25, 3, 18, 86, 50478 }, // ∀
+    { 13, 21, 16, 1, 20, 69, 50564 }, // ∂
+    { 13, 18, 25, 6, 18, 59, 50633 }, // ∃
+    { 19, 21, 25, 3, 19, 100, 50692 }, // ∅
+    { 17, 18, 17, 0, 18, 77, 50792 }, // ∆
+    { 17, 19, 25, 4, 18, 81, 50869 }, // ∇
+    { 17, 18, 25, 4, 18, 77, 50950 }, // ∈
+    { 17, 23, 25, 4, 20, 98, 51027 }, // ∉
+    { 17, 15, 25, 4, 16, 64, 51125 }, // ∊
+    { 17, 18, 25, 4, 18, 77, 51200 }, // ∋
+    { 17, 23, 25, 4, 20, 98, 51277 }, // ∌
+    { 17, 15, 25, 4, 16, 64, 51375 }, // ∍
+    { 21, 22, 21, 0, 18, 116, 51439 }, // ∏
+    { 16, 23, 17, 0, 18, 92, 51555 }, // ∑
+    { 12, 3, 16, 2, 10, 9, 51647 }, // −
+    { 15, 20, 13, -1, 18, 75, 51656 }, // ∕
+    { 13, 20, 13, 0, 18, 65, 51731 }, // ∖
+    { 12, 13, 16, 2, 15, 39, 51796 }, // ∗
+    { 10, 10, 16, 3, 13, 25, 51835 }, // ∘
+    { 6, 5, 16, 5, 9, 8, 51860 }, // ∙
+    { 17, 24, 16, -1, 21, 102, 51868 }, // √
+    { 13, 10, 16, 1, 13, 33, 51970 }, // ∝
+    { 16, 10, 16, 0, 13, 40, 52003 }, // ∞
+    { 17, 18, 25, 4, 18, 77, 52043 }, // ∟
+    { 19, 18, 25, 3, 18, 86, 52120 }, // ∠
+    { 4, 26, 13, 4, 20, 26, 52206 }, // ∣
+    { 9, 26, 13, 2, 20, 59, 52232 }, // ∥
+    { 18, 18, 25, 4, 18, 81, 52291 }, // ∧
+    { 18, 18, 25, 4, 18, 81, 52372 }, // ∨
+    { 15, 18, 25, 5, 18, 68, 52453 }, // ∩
+    { 15, 19, 25, 5, 18, 72, 52521 }, // ∪
+    { 15, 26, 16, 0, 20, 98, 52593 }, // ∫
+    { 17, 15, 25, 4, 14, 64, 52691 }, // ∴
+    { 17, 15, 25, 4, 14, 64, 52755 }, // ∵
+    { 6, 15, 8, 1, 16, 23, 52819 }, // ∶
+    { 17, 15, 25, 4, 14, 64, 52842 }, // ∷
+    { 15, 6, 25, 5, 10, 23, 52906 }, // ∼
+    { 15, 15, 25, 5, 16, 57, 52929 }, // ≅
+    { 13, 11, 16, 1, 14, 36, 52986 }, // ≈
+    { 15, 10, 25, 5, 12, 38, 53022 }, // ≍
+    { 12, 13, 16, 2, 15, 39, 53060 }, // ≠
+    { 15, 13, 25, 5, 14, 49, 53099 }, // ≡
+    { 12, 15, 16, 2, 15, 45, 53148 }, // ≤
+    { 12, 16, 16, 2, 16, 48, 53193 }, // ≥
+    { 21, 13, 25, 2, 15, 69, 53248 }, // ≪
+    { 21, 13, 25, 2, 15, 69, 53317 }, // ≫
+    { 17, 15, 25, 4, 16, 64, 53386 }, // ⊃
+    { 17, 23, 25, 4, 20, 98, 53450 }, // ⊄
+    { 17, 23, 25, 4, 20, 98, 53548 }, // ⊅
+    { 17, 18, 25, 4, 18, 77, 53646 }, // ⊆
+    { 17, 18, 25, 4, 18, 77, 53723 }, // ⊇
+    { 19, 19, 25, 3, 18, 91, 53800 }, // ⊕
+    { 19, 19, 25, 3, 18, 91, 53891 }, // ⊖
+    { 19, 19, 25, 3, 18, 91, 53982 }, // ⊗
+    { 19, 19, 25, 3, 18, 91, 54073 }, // ⊘
+    { 15, 18, 25, 5, 18, 68, 54164 }, // ⊥
+    { 6, 5, 16, 5, 9, 8, 54232 }, // ⋅
+    { 23, 5, 25, 1, 9, 29, 54240 }, // ⋯
+    { 25, 24, 25, 0, 21, 150, 54269 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_bolditalicIntervals[] = {
@@ -4165,4 +2889,9 @@ static const EpdFontData bookerly_12_bolditalic = {
     27,
     -7,
     true,
+    bookerly_12_bolditalicBlockOffsets,
+    bookerly_12_bolditalicDirectGlyphs,
+    bookerly_12_bolditalicGlyphPages,
+    256,
+    bookerly_12_bolditalicPageGlyphs,
 };
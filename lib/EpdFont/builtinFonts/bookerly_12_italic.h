@@ -2,3106 +2,1928 @@
  * generated by fontconvert.py
  * name: bookerly_12_italic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_12_italic 12 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_12_italic 12 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_italicBitmaps[49479] = {
-    0x00, 0x14, 0x03, 0xD0, 0x1F, 0x00, 0xF8, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x02, 0xD0, 0x0B, 0x00,
-    0x3C, 0x00, 0xE0, 0x03, 0x80, 0x1D, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x01, 0xF8, 0x07,
-    0xC0, 0x04, 0x00, 0x0A, 0x07, 0x0B, 0x87, 0xC3, 0xD2, 0xE0, 0xF0, 0xB4, 0x38, 0x3C, 0x0D, 0x0E,
-    0x07, 0x03, 0x41, 0x40, 0x40, 0x00, 0x0E, 0x02, 0xC0, 0x00, 0x0D, 0x03, 0x80, 0x00, 0x1D, 0x03,
-    0x40, 0x00, 0x2C, 0x0B, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x05, 0xB9, 0x5F, 0x54, 0x00, 0x74, 0x0D,
-    0x00, 0x00, 0xB0, 0x1C, 0x00, 0x00, 0xF0, 0x2C, 0x00, 0x15, 0xF5, 0x7D, 0x50, 0x7F, 0xFF, 0xFF,
-    0xE0, 0x02, 0xC0, 0x74, 0x00, 0x03, 0xC0, 0xB0, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x07, 0x40, 0xE0,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x6F, 0x40,
-    0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xE1, 0xDF, 0xC0, 0x0F, 0x0B, 0x0F, 0x40, 0x7C, 0x38, 0x3C, 0x01,
-    0xF0, 0xD0, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1D, 0xFC, 0x00, 0x40, 0xB0, 0xF8, 0x0F, 0x03, 0x83, 0xE0, 0x3D, 0x0D, 0x0F,
-    0x80, 0xFC, 0x70, 0xBC, 0x01, 0xFF, 0xEF, 0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xF0, 0x00,
-    0xB8, 0x7C, 0x00, 0x3D, 0x00, 0x0F, 0x02, 0xC0, 0x0B, 0x80, 0x02, 0xC0, 0x2D, 0x01, 0xF0, 0x00,
-    0x3C, 0x02, 0xC0, 0x3C, 0x00, 0x03, 0x80, 0x3C, 0x0B, 0x40, 0x00, 0x78, 0x03, 0x81, 0xE0, 0x00,
-    0x03, 0xC0, 0xF0, 0x3C, 0x0B, 0xF4, 0x3E, 0x7D, 0x0F, 0x03, 0xD7, 0xC0, 0xFF, 0x42, 0xD0, 0xF0,
-    0x2D, 0x00, 0x00, 0x78, 0x1D, 0x01, 0xD0, 0x00, 0x0F, 0x03, 0xC0, 0x1D, 0x00, 0x03, 0xC0, 0x3C,
-    0x02, 0xC0, 0x00, 0xB8, 0x03, 0xC0, 0x3C, 0x00, 0x1F, 0x00, 0x3C, 0x0B, 0x40, 0x03, 0xC0, 0x03,
-    0xD1, 0xF0, 0x00, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x0A, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3E,
-    0xBC, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x02, 0xC0, 0x00, 0x00, 0x07, 0x81,
-    0xE0, 0x00, 0x00, 0x02, 0xE1, 0xF0, 0x00, 0x10, 0x00, 0xBB, 0xE0, 0x00, 0x1C, 0x00, 0x3F, 0x80,
-    0x00, 0x6F, 0x00, 0x7F, 0x80, 0x1B, 0xFE, 0x00, 0x79, 0xF0, 0x3F, 0xF4, 0x00, 0x38, 0x3D, 0x1E,
-    0x74, 0x00, 0x3C, 0x07, 0xC0, 0x2C, 0x00, 0x0F, 0x00, 0xF8, 0x0F, 0x00, 0x03, 0x80, 0x0F, 0x8B,
-    0x40, 0x00, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xFE,
-    0x00, 0x00, 0x7F, 0xFE, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x2E, 0x3D, 0x3C, 0x38, 0x34, 0x70, 0x50, 0x00, 0x00, 0x20, 0x00, 0x0B, 0xC0,
-    0x00, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00,
-    0x1E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xD0, 0x00,
-    0x0B, 0x40, 0x00, 0x2D, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x40,
-    0x00, 0x0F, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x20, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80,
-    0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E,
-    0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E,
-    0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0x8B, 0x01, 0xFB, 0x80, 0x07, 0xEF, 0x42,
-    0xFA, 0xD7, 0xDE, 0x00, 0x92, 0xC0, 0x00, 0xB0, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x0F, 0x00, 0x15, 0x7D, 0x55, 0xFF, 0xFF, 0xF1, 0x57, 0xD5, 0x40, 0x0F, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x2E, 0x03, 0xD0,
-    0x78, 0x1F, 0x07, 0x80, 0x00, 0x00, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x00, 0x2E, 0x7F, 0x7D,
-    0x10, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x02,
-    0xFE, 0xFF, 0x00, 0x3F, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0xF8, 0x0F, 0x40, 0x03, 0xF0, 0xBC, 0x00,
-    0x0F, 0xC3, 0xD0, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x03, 0xD3, 0xE0, 0x00, 0x1F,
-    0x0F, 0x40, 0x00, 0xFC, 0x3D, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x2F, 0x03, 0xE0, 0x01, 0xF0, 0x0F,
-    0xD0, 0x2F, 0x40, 0x1F, 0xFF, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBC, 0x02, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x1F,
-    0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00,
-    0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x1B, 0xFE, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xBF, 0xD0, 0x1F, 0x80, 0x7F, 0x03, 0xD0, 0x03, 0xF0, 0x18, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00,
-    0x02, 0xF9, 0x55, 0x50, 0xBF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0xBF, 0xBF, 0xC0, 0x1F, 0x40, 0x7D, 0x02, 0xC0, 0x03, 0xD0, 0x04, 0x00, 0x7C,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x25,
-    0xBF, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x7F, 0xC0, 0x6B, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xF7,
-    0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0xF4, 0xB8, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0xF4, 0x0F, 0x00,
-    0x0F, 0x80, 0x7C, 0x00, 0xF8, 0x02, 0xE0, 0x0F, 0x80, 0x0F, 0x80, 0xBF, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x0F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0x6F,
-    0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0xAB, 0xFF, 0x00, 0x0B, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xE4,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03,
-    0xFA, 0xA4, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xF8, 0x06, 0xF8, 0x03, 0xD0, 0x03, 0xF0, 0x1F, 0x00,
-    0x0B, 0xC0, 0x7C, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0xBC, 0x07, 0xD0, 0x03, 0xD0, 0x0F, 0xC0, 0x3F,
-    0x00, 0x1F, 0xEB, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xF0, 0x00, 0xBC, 0x78, 0x00, 0x7C, 0x1C, 0x00, 0x7C,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0xBE, 0x6F, 0xC0, 0x2F, 0x00, 0x7C, 0x03, 0xD0, 0x03, 0xC0, 0x3D, 0x00, 0x7C,
-    0x03, 0xE0, 0x0F, 0x40, 0x2F, 0x87, 0xD0, 0x00, 0xBF, 0xF0, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xE3,
-    0xF8, 0x01, 0xF0, 0x0B, 0xD0, 0x3D, 0x00, 0x3F, 0x0B, 0xC0, 0x03, 0xF0, 0xBC, 0x00, 0x3E, 0x0B,
-    0xD0, 0x0F, 0xC0, 0x3F, 0xEF, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFA, 0xFC, 0x00, 0x7E, 0x01, 0xF8, 0x03, 0xE0, 0x02,
-    0xF0, 0x0F, 0x40, 0x0B, 0xC0, 0x7C, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0xBC, 0x07, 0xE0, 0x03, 0xE0,
-    0x0F, 0xE4, 0x5F, 0x40, 0x0F, 0xFF, 0xFC, 0x00, 0x06, 0xAB, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x16, 0xFE, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0xC0, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x1F, 0xC0, 0x7D, 0x00, 0x40, 0x00, 0x00,
-    0x05, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x78,
-    0x00, 0x7C, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x07,
-    0xF8, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0xA9, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF2,
-    0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x0B, 0xF8,
-    0x00, 0x3F, 0x80, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0xFC, 0x3E, 0xBE,
-    0x10, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x3C, 0x00,
-    0x7E, 0x40, 0x3F, 0x40, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xF9, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xD0, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xC0, 0x3D, 0x00, 0xBE, 0x28, 0x0F, 0x02, 0xD0, 0x0F, 0xFF, 0xD0, 0x2D, 0x0F, 0x00,
-    0xF4, 0x1F, 0x00, 0xB4, 0xB4, 0x07, 0x80, 0x3C, 0x03, 0xC3, 0xC0, 0x3C, 0x01, 0xD0, 0x0F, 0x0F,
-    0x00, 0xF0, 0x0B, 0x00, 0x78, 0x78, 0x07, 0x80, 0x3C, 0x03, 0xC1, 0xE0, 0x2E, 0x03, 0xF0, 0x2E,
-    0x07, 0x80, 0x7C, 0x3B, 0xC2, 0xF0, 0x1E, 0x01, 0xFF, 0xCF, 0xFE, 0x00, 0x7C, 0x02, 0xF8, 0x1F,
-    0x90, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x80, 0x00, 0x03, 0xF9, 0x41, 0x6F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1,
-    0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0x3D, 0x00,
-    0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3D,
-    0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x03,
-    0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x06, 0xA9, 0x00, 0x01,
-    0xFF, 0xFF, 0xE0, 0x01, 0x9F, 0x42, 0xF8, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x7C, 0x00,
-    0x2E, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0xBE, 0xBF, 0xE0, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xB8, 0x01,
-    0xF0, 0x00, 0xF8, 0x02, 0xE0, 0x01, 0xF4, 0x03, 0xD0, 0x03, 0xE0, 0x1B, 0xFA, 0xBF, 0x80, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x0F,
-    0xE5, 0xBF, 0x80, 0xFC, 0x00, 0x2D, 0x0F, 0xC0, 0x00, 0xB0, 0x7C, 0x00, 0x02, 0x83, 0xE0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0C, 0x0F,
-    0xF4, 0x06, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0xA9, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x19, 0xF4, 0x5F, 0xF4, 0x00, 0x07, 0xC0,
-    0x07, 0xF0, 0x00, 0x2F, 0x00, 0x07, 0xE0, 0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x2F,
-    0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0F,
-    0x80, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x07, 0xC0, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xBE, 0x00, 0x1B, 0xFA, 0xBF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFA, 0xAA, 0xF0, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x0C, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x1C, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x1B, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xAA, 0xBC, 0x00, 0x1F, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x34, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x40, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0x69, 0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFE, 0x5A, 0xFC, 0x03, 0xF0, 0x00, 0x3C, 0x0F,
-    0xC0, 0x00, 0x38, 0x1F, 0x00, 0x00, 0x30, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0xFD, 0xF8, 0x00, 0x06, 0xF8, 0xFC,
-    0x00, 0x00, 0xF0, 0xBC, 0x00, 0x01, 0xF0, 0x7F, 0x00, 0x02, 0xE0, 0x3F, 0xC0, 0x03, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x01, 0x55,
-    0x40, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x00,
-    0x00, 0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x00, 0x00, 0x55,
-    0x54, 0x03, 0xFF, 0xE0, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xB8, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x3E, 0xBE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x55, 0x50, 0x15,
-    0x54, 0x00, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x3E, 0x00,
-    0x00, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x2E, 0x07, 0xD0, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x00,
-    0x3D, 0xBC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xF9,
-    0xF4, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x01, 0xF0, 0x1F,
-    0x80, 0x00, 0x02, 0xF0, 0x0B, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF8, 0x00, 0x1B, 0xF9, 0x00, 0xFF,
-    0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xD0,
-    0x2F, 0x00, 0x0B, 0x00, 0xF8, 0x00, 0x7C, 0x1B, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x01, 0x55, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x00,
-    0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xEE, 0x00, 0x3D, 0xF0, 0x00, 0x01,
-    0xEB, 0x80, 0x2D, 0xBC, 0x00, 0x00, 0xB5, 0xF0, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0x7C, 0x0B, 0x0B,
-    0x80, 0x00, 0x1E, 0x0F, 0x03, 0x82, 0xE0, 0x00, 0x0B, 0x43, 0xD3, 0xC0, 0xF4, 0x00, 0x03, 0xC0,
-    0xF9, 0xE0, 0x3D, 0x00, 0x00, 0xF0, 0x2E, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x07, 0xF4, 0x03, 0xD0,
-    0x00, 0x3D, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x0A,
-    0x00, 0x1F, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xE4, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x55, 0x00, 0x01, 0x55, 0x40, 0x3F, 0xD0, 0x01, 0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x0B, 0x80,
-    0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0xF0, 0x00, 0x0F, 0xBC, 0x00, 0x3C, 0x00,
-    0x03, 0xCF, 0x80, 0x1E, 0x00, 0x00, 0xF2, 0xF0, 0x0B, 0x40, 0x00, 0x78, 0x3D, 0x03, 0xD0, 0x00,
-    0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x0F, 0x00, 0xF4, 0x3C, 0x00, 0x03, 0xC0, 0x3E, 0x1E, 0x00, 0x01,
-    0xF0, 0x07, 0xCB, 0x40, 0x00, 0x78, 0x00, 0xFB, 0xC0, 0x00, 0x2D, 0x00, 0x1F, 0xF0, 0x00, 0x0F,
-    0x00, 0x03, 0xFC, 0x00, 0x0B, 0xE4, 0x00, 0x7E, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x6F,
-    0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x07, 0xD3, 0xE0, 0x00,
-    0x00, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x0F, 0x7E, 0x00, 0x00, 0x07, 0xCF, 0x80,
-    0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3E, 0x07,
-    0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0x9F, 0x42,
-    0xF8, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3D, 0x00,
-    0x7C, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0xBD, 0xAF, 0x80, 0x00, 0xFF, 0xF9,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x69,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xE5, 0x6F, 0xC0, 0x00, 0x0F, 0xC0, 0x01,
-    0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x01,
-    0xF4, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x07,
-    0xC0, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00,
-    0x00, 0x0F, 0xFA, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x05, 0xA9, 0x00, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x19, 0xF4, 0x6F, 0x40, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x7C,
-    0x00, 0x0B, 0x80, 0x1F, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0xF0, 0x0B, 0xC0, 0x00, 0x7C, 0x1F,
-    0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0xF0,
-    0x3D, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x2E, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x1B,
-    0xF9, 0x02, 0xFC, 0x1F, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00,
-    0x2F, 0xFF, 0xD0, 0x2F, 0x45, 0xF4, 0x1F, 0x00, 0x2D, 0x0B, 0xC0, 0x0B, 0x02, 0xF0, 0x01, 0x40,
-    0xBD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x03, 0xF0, 0x20, 0x00, 0x7D, 0x1D, 0x00, 0x0F, 0x4B, 0x40, 0x07, 0xC2, 0xF0, 0x03, 0xE0,
-    0xBF, 0xAB, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x51, 0xFF, 0xFF,
-    0xFF, 0xEB, 0xAA, 0xFE, 0xAF, 0x7C, 0x03, 0xD0, 0x2C, 0xF0, 0x1F, 0x00, 0xB2, 0x40, 0xBC, 0x02,
-    0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x55, 0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0,
-    0x0F, 0x80, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00,
-    0x0B, 0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07,
-    0xC0, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F,
-    0x80, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x55, 0x50, 0xFF, 0xF8, 0x0B, 0xFF, 0xC0, 0xBE, 0x00,
-    0x07, 0xF4, 0x01, 0xF4, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x80, 0x03, 0xC0,
-    0x00, 0x3E, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0xF0, 0x00, 0x02, 0xF0, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x7C, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x00, 0xF4, 0xF0,
-    0x00, 0x00, 0x02, 0xD7, 0x80, 0x00, 0x00, 0x0B, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x54, 0x00, 0x00, 0x01, 0x55, 0x4B, 0xFF, 0xC0, 0x1E, 0x00, 0x7F, 0xFC, 0x1F, 0xD0, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0B, 0xF0, 0x01, 0xF0, 0x00,
-    0xF8, 0x00, 0xFF, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x2E, 0xF0, 0x03, 0xC0, 0x00, 0xB8, 0x03, 0xCF,
-    0x00, 0xB4, 0x00, 0x0B, 0xC0, 0xB4, 0xF4, 0x0F, 0x00, 0x00, 0xBC, 0x0F, 0x0F, 0x42, 0xD0, 0x00,
-    0x07, 0xC2, 0xD0, 0xF4, 0x3C, 0x00, 0x00, 0x7C, 0x3C, 0x0B, 0x87, 0x40, 0x00, 0x07, 0xCB, 0x40,
-    0xB8, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x07, 0x9D, 0x00, 0x00, 0x03, 0xED, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x05, 0x54,
-    0x00, 0xFF, 0xF8, 0x2F, 0xFD, 0x00, 0x2F, 0x80, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00,
-    0x07, 0xD0, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xCB, 0xC0, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x02, 0xF0,
-    0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x1F, 0xE4, 0x01, 0xFF, 0x80,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xD0, 0x15, 0x54, 0x01, 0x55, 0x1F, 0xFF, 0x42, 0xFF, 0xD1, 0xFD, 0x00,
-    0x1F, 0x80, 0x2F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0xBC, 0x03, 0xC0, 0x00, 0x1F,
-    0x03, 0xD0, 0x00, 0x03, 0xE2, 0xE0, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x80, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xFA, 0xAA, 0xFC, 0x03, 0xC0,
-    0x02, 0xF0, 0x03, 0xC0, 0x07, 0xD0, 0x01, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xB0, 0x0F, 0xC0, 0x00, 0xF0, 0x2F, 0x00,
-    0x02, 0xE0, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x02, 0xFD, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78,
-    0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00,
-    0x3C, 0x00, 0x07, 0x80, 0x00, 0xBE, 0x40, 0x0B, 0xF4, 0x00, 0x3C, 0x00, 0x02, 0xC0, 0x00, 0x1E,
-    0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00,
-    0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x02,
-    0xFD, 0x00, 0x02, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
-    0xB4, 0x00, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0,
-    0x00, 0x3C, 0x00, 0x6B, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFF,
-    0x00, 0x02, 0xDF, 0x00, 0x03, 0xC7, 0x80, 0x07, 0x83, 0xC0, 0x0F, 0x02, 0xD0, 0x1F, 0x00, 0xF0,
-    0x2D, 0x00, 0xF4, 0x3C, 0x00, 0x78, 0xB8, 0x00, 0x3C, 0x10, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0D, 0x0B, 0xC0, 0xF8, 0x0F, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xE1, 0xD0, 0x2F, 0xFF, 0xF0, 0x1F, 0x42, 0xF8, 0x0F, 0x00, 0x3D, 0x0F, 0x80, 0x0F, 0x03,
-    0xC0, 0x07, 0xC1, 0xE0, 0x02, 0xE0, 0xB4, 0x01, 0xF4, 0x3D, 0x00, 0xFC, 0x0F, 0x40, 0xBF, 0x07,
-    0xF0, 0xB3, 0xCF, 0xBF, 0xF4, 0xFF, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x6B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x07, 0xC2, 0xF8, 0x02, 0xD3, 0xFF, 0x40, 0xB7, 0xC3, 0xE0, 0x3E, 0xC0,
-    0xBC, 0x0F, 0xC0, 0x2F, 0x07, 0xD0, 0x0B, 0x82, 0xF0, 0x03, 0xD0, 0xF4, 0x00, 0xF0, 0x3C, 0x00,
-    0x7C, 0x1F, 0x00, 0x3D, 0x0B, 0x80, 0x3E, 0x03, 0xFE, 0xBE, 0x01, 0xFB, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0xD0, 0xB8, 0x18, 0x1E, 0x00, 0x03, 0xC0,
-    0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x4B, 0xC0, 0x78,
-    0x7F, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x6B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F,
-    0x00, 0x02, 0xF9, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x7D, 0x0B, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0,
-    0x03, 0xC0, 0x3C, 0x00, 0x78, 0x07, 0x80, 0x0B, 0x80, 0xB4, 0x01, 0xF4, 0x0F, 0x40, 0x3F, 0x00,
-    0xF4, 0x0B, 0xF0, 0x4F, 0xC2, 0xCF, 0x3C, 0xBF, 0xF4, 0xFF, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x2E, 0xBF, 0x02, 0xD0, 0x7C, 0x1E, 0x01, 0xF0,
-    0xF0, 0x0F, 0x47, 0x82, 0xF4, 0x2E, 0xBF, 0x00, 0xFF, 0x90, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x04,
-    0x3F, 0x01, 0xF0, 0x7F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x3C, 0x08, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x02, 0xC1, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0xD0, 0x00, 0x7E, 0xBF, 0xF0, 0x00, 0x7C,
-    0x07, 0x80, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,
-    0xF4, 0x3D, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0xBE, 0xBF, 0xC0, 0x01, 0xF4, 0x02, 0xFC,
-    0x00, 0xF4, 0x00, 0x1F, 0x40, 0x3D, 0x00, 0x03, 0xD0, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x6B, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x78, 0x1F, 0xD0, 0x02, 0xD2, 0xFF, 0x80, 0x0F, 0x2E, 0x2F, 0x00, 0x3D, 0xD0, 0xB8, 0x01,
-    0xFD, 0x03, 0xD0, 0x0B, 0xF0, 0x0F, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0xF8, 0x02, 0xE0, 0x03, 0xC0,
-    0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x10, 0xB8, 0x00, 0xF3, 0xC3, 0xD0, 0x07, 0xFD, 0x0F, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F, 0x00, 0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xF0, 0x0F,
-    0x40, 0x3C, 0x11, 0xF3, 0xCB, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x03, 0xD0, 0x00, 0xE6, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x0F, 0xF4, 0x00, 0x1A, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0,
-    0x00, 0x03, 0xD0, 0x00, 0x03, 0xC2, 0xF8, 0x03, 0xDF, 0xBD, 0x07, 0xF4, 0x2D, 0x0B, 0xD0, 0x3D,
-    0x0F, 0x80, 0xB8, 0x0F, 0x07, 0xF0, 0x1F, 0xBF, 0x40, 0x2F, 0xF8, 0x00, 0x3D, 0x7C, 0x00, 0x3C,
-    0x3E, 0x00, 0x7C, 0x1F, 0x80, 0x78, 0x0B, 0xF9, 0xB4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x7F, 0xC1, 0xAF, 0x00, 0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x2D, 0x00,
-    0xF4, 0x03, 0xC0, 0x1F, 0x00, 0xB8, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x12, 0xE7, 0x8F, 0xFC, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x2F, 0x40, 0xBE, 0x0B, 0xFC, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x1E, 0x3D, 0x7C, 0xF5, 0xF0, 0x0B, 0xBC, 0x1E, 0xF0, 0x3C, 0x03, 0xFC, 0x0B,
-    0xF0, 0x1F, 0x00, 0xFD, 0x03, 0xF4, 0x0B, 0x80, 0x3E, 0x00, 0xFC, 0x03, 0xD0, 0x1F, 0x00, 0x3D,
-    0x00, 0xF0, 0x0B, 0x80, 0x1F, 0x00, 0x78, 0x03, 0xD0, 0x0B, 0x40, 0x2D, 0x10, 0xF0, 0x03, 0xC0,
-    0x0F, 0x6D, 0x7C, 0x00, 0xF0, 0x03, 0xFE, 0x2E, 0x00, 0x78, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x0B, 0xE0, 0xBF, 0xC3, 0xFF, 0x00, 0x78, 0xF4, 0xF4,
-    0x0B, 0xBC, 0x0F, 0x00, 0xFF, 0x01, 0xF0, 0x0F, 0xD0, 0x2E, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00,
-    0x3C, 0x02, 0xE0, 0x07, 0xC0, 0x3D, 0x00, 0xB8, 0x43, 0xC0, 0x0F, 0x5D, 0x7C, 0x00, 0xFF, 0x8B,
-    0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x02, 0xFF, 0xF8,
-    0x0F, 0xC0, 0x7C, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0x3E, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xF4,
-    0x00, 0x3C, 0xF4, 0x00, 0xB8, 0xF8, 0x00, 0xF0, 0xBC, 0x03, 0xE0, 0x7F, 0xAF, 0x80, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x07, 0xF0, 0x02, 0xFE, 0x2F, 0xFC,
-    0x00, 0x1E, 0x78, 0xBC, 0x00, 0x2E, 0xD0, 0x3D, 0x00, 0x3F, 0x80, 0x3C, 0x00, 0x3F, 0x00, 0x3C,
-    0x00, 0x3D, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF4, 0x02, 0xE0,
-    0x00, 0xF4, 0x07, 0xC0, 0x01, 0xFF, 0xBF, 0x00, 0x02, 0xEF, 0xF8, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x2A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE1, 0xD0, 0x2F, 0xFF, 0xF0, 0x2F, 0x02,
-    0xF8, 0x1F, 0x00, 0x3D, 0x0F, 0x40, 0x0F, 0x03, 0xC0, 0x07, 0xC2, 0xE0, 0x02, 0xD0, 0xF4, 0x01,
-    0xF4, 0x3D, 0x00, 0xFC, 0x0F, 0x40, 0xBF, 0x03, 0xF0, 0xB7, 0x80, 0xBF, 0xF5, 0xD0, 0x0F, 0xF0,
-    0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x0B,
-    0xFF, 0x00, 0x02, 0xAA, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xCB, 0xFC, 0xBF, 0x01, 0xE7, 0xE8,
-    0x07, 0xB8, 0x00, 0x2E, 0xC0, 0x00, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFD, 0x02, 0xFF, 0xE0, 0x78, 0x09, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xE0,
-    0x00, 0x3F, 0x40, 0x00, 0xFC, 0x20, 0x07, 0xCB, 0x80, 0xB4, 0xBF, 0xAE, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x0A, 0xFF, 0xE3, 0xFF,
-    0xFD, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x00, 0xF0, 0x18, 0x0F, 0x0B, 0x80, 0xFF, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E,
-    0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0,
-    0x3B, 0x80, 0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xCB, 0xFC, 0x02, 0xF0, 0x1F, 0x00, 0x7C, 0x03, 0xD0, 0x0F,
-    0x00, 0xB8, 0x07, 0x80, 0x2E, 0x03, 0xD0, 0x07, 0xC0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x78,
-    0x00, 0x0F, 0x3C, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xF0, 0x07, 0xDB, 0xFC, 0x03, 0xE0, 0x0F, 0x80,
-    0xF4, 0x0B, 0xC0, 0x3E, 0x03, 0xD0, 0x2F, 0x00, 0xF4, 0x0B, 0x80, 0xBD, 0x03, 0xC0, 0x1F, 0x03,
-    0xF4, 0x0F, 0x00, 0x3C, 0x1F, 0xE0, 0xB4, 0x00, 0xF0, 0xF7, 0x83, 0xC0, 0x03, 0xC7, 0x4F, 0x2D,
-    0x00, 0x0F, 0x3C, 0x3C, 0xE0, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x02,
-    0xD0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00,
-    0xFC, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0x3E, 0x0F, 0x44, 0x00, 0x1F, 0x2D, 0x00, 0x00, 0x0F, 0xB8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1E, 0xF0,
-    0x00, 0x00, 0x78, 0xF4, 0x00, 0x10, 0xF0, 0xBC, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0x40, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00,
-    0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0,
-    0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3,
-    0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x2E, 0x40, 0x00, 0x00, 0x07, 0xE4, 0x1C, 0x0F, 0xFF, 0x7D, 0x2D, 0x5F, 0xF8, 0x2C, 0x02,
-    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00,
-    0x0F, 0x00, 0x10, 0x3F, 0x50, 0x38, 0xFF, 0xFF, 0xF8, 0xF0, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xD0, 0x02, 0xFC, 0x00, 0x7C, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0E, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x07, 0xC0, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x00,
-    0xB4, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80,
-    0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x7E, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x07, 0x40, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x0E, 0x00, 0x74, 0x02, 0xD0, 0x0F, 0x00,
-    0x3C, 0x00, 0xE0, 0x07, 0x40, 0x2C, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0x74, 0x02, 0xC0, 0x0F,
-    0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x40, 0x00, 0x00, 0x2E, 0x40, 0x03, 0xFC, 0x00, 0x03, 0xD0, 0x00,
-    0x2D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0,
-    0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0xB4, 0x00, 0x0B, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x2B, 0xC0,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x3F, 0xF0, 0x1D, 0xBE, 0xFE, 0xBC, 0xF0,
-    0x2F, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0xB0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xD0, 0x02, 0xD0, 0x03, 0xC0, 0x03,
-    0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3E, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xD0, 0x00,
-    0x7F, 0xFD, 0x03, 0xFF, 0xFE, 0x0F, 0x8B, 0x08, 0x2E, 0x0E, 0x00, 0x3C, 0x0D, 0x00, 0xB8, 0x1C,
-    0x00, 0xF4, 0x1C, 0x00, 0xF4, 0x28, 0x00, 0xF4, 0x38, 0x00, 0xBC, 0x34, 0x08, 0x7E, 0xB0, 0xB8,
-    0x2F, 0xFF, 0xE0, 0x0B, 0xFE, 0x40, 0x00, 0xD0, 0x00, 0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x07, 0xEB, 0xF0, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x01, 0xF0,
-    0x01, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x17, 0xF5, 0x50, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x47, 0xC0, 0x01, 0x40, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xD6, 0xFF, 0xF8, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x2C, 0x07, 0x8B, 0xFD, 0xB4, 0x01, 0xFE, 0xBF, 0xC0, 0x00, 0xF0, 0x0B, 0x80, 0x02, 0xD0, 0x07,
-    0x80, 0x03, 0xC0, 0x07, 0x40, 0x03, 0xC0, 0x0F, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x0B, 0xF5, 0xFE,
-    0x00, 0x3D, 0xBF, 0xE7, 0x80, 0x70, 0x04, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x03, 0xFF, 0xC7, 0xFE, 0x00, 0x7F, 0x80, 0x3E, 0x00, 0x0F, 0x40, 0x0B, 0xC0,
-    0x0B, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x3F,
-    0xF6, 0xFF, 0x40, 0x06, 0xBF, 0xFA, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0x1A, 0xFE, 0xA8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x06, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x40,
-    0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x0E, 0x00, 0x74, 0x02, 0xC0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x03, 0xC0, 0x1E, 0x00, 0x74, 0x02, 0xC0, 0x0F, 0x00, 0x3C, 0x01, 0xE0,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFA, 0xFC, 0x07, 0xC0, 0x3C, 0x0F,
-    0x80, 0x38, 0x2E, 0xC0, 0x00, 0x38, 0xF0, 0x00, 0x38, 0x7C, 0x00, 0x38, 0x0F, 0x40, 0x3C, 0x03,
-    0xD0, 0x1F, 0x40, 0xF0, 0x07, 0xD0, 0x78, 0x01, 0xF8, 0x38, 0x00, 0x3D, 0x38, 0x00, 0x0F, 0x38,
-    0x10, 0x03, 0xF4, 0xB0, 0x03, 0xF0, 0xF8, 0x07, 0xC0, 0xBE, 0xAF, 0x40, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x02, 0x0F, 0x83, 0xE7, 0xD1, 0xF4, 0x40, 0x10, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x0F, 0x00,
-    0x6A, 0x01, 0xD0, 0x74, 0x0F, 0xFE, 0x02, 0xC3, 0xC0, 0xF0, 0x38, 0x07, 0x4E, 0x07, 0x40, 0x50,
-    0x0E, 0x34, 0x2C, 0x00, 0x00, 0x38, 0xD0, 0xB0, 0x00, 0x00, 0xF3, 0x42, 0xC0, 0x00, 0x03, 0x8E,
-    0x07, 0x80, 0x00, 0x0E, 0x2C, 0x0F, 0x95, 0x80, 0x74, 0x74, 0x0F, 0xFE, 0x03, 0xC0, 0xF0, 0x01,
-    0x40, 0x2D, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xF9, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x61, 0x40, 0x7F, 0xF4, 0x0F, 0x0F, 0x02, 0xC0, 0xF0,
-    0x3C, 0x0D, 0x03, 0x82, 0xC0, 0x78, 0x7C, 0x83, 0xFD, 0xFC, 0x2E, 0x0E, 0x00, 0x00, 0x00, 0x2A,
-    0xAB, 0x0F, 0xFF, 0xE0, 0x00, 0x2C, 0x0B, 0x00, 0x3D, 0x0F, 0x40, 0x3D, 0x0F, 0x40, 0x7E, 0x1F,
-    0x80, 0x3E, 0x0F, 0x80, 0x0F, 0xC3, 0xF0, 0x00, 0xF4, 0x3D, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0xE0,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0xFF, 0xFF, 0xF1, 0x55, 0x57, 0xC0, 0x00, 0x0F,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x00,
-    0x05, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x07, 0x80, 0x1F, 0x00, 0xD1, 0x50, 0x38, 0x28, 0x7E, 0xD0,
-    0xC3, 0x43, 0x8E, 0x0E, 0x30, 0x39, 0xD0, 0xA3, 0x03, 0xF8, 0x0B, 0x30, 0x39, 0xD0, 0xA3, 0x83,
-    0xCB, 0x4D, 0x1C, 0x54, 0x16, 0xC0, 0xB0, 0x00, 0x74, 0x02, 0xE5, 0xBD, 0x00, 0x01, 0xA9, 0x00,
-    0x2A, 0xAA, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x02, 0xFF, 0x43, 0xE5, 0xF1, 0xE0, 0x1E,
-    0x74, 0x03, 0x9E, 0x01, 0xE3, 0xD0, 0xF0, 0x7F, 0xF4, 0x01, 0x90, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x01, 0xFF, 0xFF, 0xF2, 0xAB, 0xEA, 0x80,
-    0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC0, 0x00, 0x19, 0x00, 0x1F, 0xFD, 0x03, 0xD2, 0xF0, 0x70, 0x0F,
-    0x00, 0x02, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3F,
-    0xFF, 0xC2, 0xAA, 0xA4, 0x00, 0x64, 0x01, 0xFF, 0xC0, 0xE0, 0xF0, 0x10, 0x2C, 0x00, 0x1E, 0x00,
-    0xBE, 0x00, 0x7F, 0xC0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x1F, 0x06, 0xBF, 0x42, 0xFE, 0x00, 0x00,
-    0x00, 0x3C, 0x0F, 0xC2, 0xF0, 0x7C, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0xB0, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0xF0, 0x03, 0xD0, 0x01, 0xF0,
-    0x03, 0xC0, 0x02, 0xE0, 0x03, 0xC0, 0x03, 0xD0, 0x07, 0xC0, 0x03, 0xC0, 0x0B, 0x80, 0x03, 0xC0,
-    0x0F, 0x40, 0x07, 0xC0, 0x2F, 0x40, 0x07, 0xE0, 0x7B, 0x85, 0x0B, 0xFF, 0xE3, 0xFD, 0x0F, 0xBF,
-    0x82, 0xF4, 0x0E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x2F, 0xFA, 0xE4, 0x00, 0xBF, 0xF5, 0xC0, 0x01, 0xFF,
-    0xF2, 0xC0, 0x03, 0xFF, 0xF3, 0x80, 0x03, 0xFF, 0xF3, 0x80, 0x03, 0xFF, 0xE3, 0x40, 0x03, 0xFF,
-    0xD7, 0x00, 0x03, 0xFF, 0xCB, 0x00, 0x01, 0xFF, 0xCE, 0x00, 0x00, 0x6B, 0xCE, 0x00, 0x00, 0x03,
-    0x8D, 0x00, 0x00, 0x03, 0x5C, 0x00, 0x00, 0x07, 0x2C, 0x00, 0x00, 0x0B, 0x38, 0x00, 0x00, 0x0E,
-    0x34, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x2D, 0xD0, 0x00, 0x60, 0xBF, 0x40, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x18, 0xBD, 0xFC, 0xB4, 0x0A, 0x41, 0xFC, 0x03, 0xC0, 0xB4,
-    0x3E, 0x01, 0x00, 0x00, 0x20, 0x2F, 0xC1, 0xBF, 0x00, 0x78, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x00,
-    0xF0, 0x07, 0x80, 0x2D, 0x06, 0xFE, 0x2A, 0xA8, 0x00, 0x19, 0x00, 0x2F, 0xF4, 0x07, 0x83, 0xC0,
-    0xF0, 0x3C, 0x1E, 0x03, 0xC2, 0xD0, 0x78, 0x1D, 0x0F, 0x00, 0xFB, 0xD0, 0x07, 0xE4, 0x00, 0x00,
-    0x00, 0x2A, 0xAB, 0x47, 0xFF, 0xE0, 0x0A, 0x02, 0x80, 0x03, 0x80, 0xE0, 0x02, 0xE0, 0xB8, 0x00,
-    0xF8, 0x3E, 0x00, 0xFC, 0x3F, 0x02, 0xF4, 0xBD, 0x07, 0xC1, 0xF0, 0x1F, 0x07, 0xC0, 0x38, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0D, 0x00,
-    0x06, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0,
-    0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x3D, 0x07, 0x80, 0x00, 0xB0, 0x00, 0xFC,
-    0x07, 0x40, 0x01, 0xD0, 0x03, 0xFC, 0x1F, 0x90, 0x03, 0x80, 0x0F, 0x38, 0xBF, 0xF0, 0x0F, 0x00,
-    0x3C, 0x74, 0x00, 0x00, 0x2D, 0x00, 0xF0, 0xB4, 0x00, 0x00, 0x78, 0x03, 0xC0, 0xF0, 0x00, 0x00,
-    0xF0, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xC0, 0x01, 0x56, 0xE4, 0x00, 0x0B, 0x40, 0x00, 0x01, 0xD0,
-    0x00, 0x1F, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x34, 0x00, 0x06, 0xF0,
-    0x00, 0x00, 0xB4, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x78,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x0F, 0xF8, 0x07, 0x80, 0x02, 0xC0, 0x7E, 0xBD, 0x07, 0x40,
-    0x07, 0x40, 0xB0, 0x1E, 0x1F, 0x90, 0x0E, 0x00, 0x10, 0x2D, 0xBF, 0xF0, 0x3C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xB4, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xC0, 0x00,
-    0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2E, 0x00, 0x03, 0xFA, 0xA8, 0x00, 0x7C,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0xF0, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x08, 0x0B, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x1E, 0x00, 0x0F, 0x40, 0x07, 0x80, 0x0F, 0x00, 0x0F, 0xC0, 0x03,
-    0xD0, 0x0F, 0x00, 0x0F, 0xF1, 0x5B, 0xE0, 0x0B, 0x40, 0x0F, 0x38, 0xFF, 0xD0, 0x07, 0x80, 0x0F,
-    0x1D, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x0F, 0x03, 0xC0, 0x00, 0x02,
-    0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0x01, 0xF0, 0x00, 0x55, 0xB9, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x06, 0xF8, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x1F,
-    0x00, 0x0F, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x7E, 0x6D, 0x0B, 0xFF, 0x40, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x74, 0x3C, 0x00, 0x00,
-    0x03, 0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x0F, 0x95,
-    0x6F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xD0,
-    0x00, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x40, 0x01, 0xFE, 0x4F, 0xFF,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x74, 0x3C,
-    0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00,
-    0x0F, 0x95, 0x6F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56, 0xF4, 0x00, 0x2E, 0x00,
-    0x03, 0xD0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x40, 0x01, 0xFE,
-    0x4F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x3E, 0xF4, 0x00, 0x00, 0x07, 0xD1, 0xF0, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00,
-    0x74, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x0B,
-    0x80, 0x00, 0x0F, 0x95, 0x6F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56, 0xF4, 0x00,
-    0x2E, 0x00, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x40,
-    0x01, 0xFE, 0x4F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x8B,
-    0x00, 0x00, 0x02, 0xEF, 0xFC, 0x00, 0x00, 0x0A, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00,
-    0x00, 0x00, 0x74, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00,
-    0xF0, 0x0B, 0x80, 0x00, 0x0F, 0x95, 0x6F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56,
-    0xF4, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00,
-    0xBE, 0x40, 0x01, 0xFE, 0x4F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0A, 0x02, 0xC0, 0x00, 0x00,
-    0xFC, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x76, 0xE0, 0x00, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x00, 0x1D,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x0B, 0x40, 0xF4, 0x00, 0x00, 0x3C, 0x02, 0xE0,
-    0x00, 0x03, 0xE5, 0x5B, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xF5, 0x55, 0xBD, 0x00, 0x0B,
-    0x80, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x02, 0xE0, 0x00, 0x0F, 0xC0, 0x2F, 0x90, 0x00,
-    0x7F, 0x93, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0xB0, 0xB0, 0x00, 0x00, 0x03, 0xC1, 0xC0, 0x00, 0x00, 0x0B, 0x0F, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0x6E, 0x00,
-    0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x01, 0xD0, 0xF0, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00,
-    0xB4, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x00, 0x3E, 0x55, 0xBC, 0x00, 0x01, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0x55, 0x5B, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0x3E, 0x00,
-    0x2E, 0x00, 0x00, 0xFC, 0x02, 0xF9, 0x00, 0x07, 0xF9, 0x3F, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0xAA,
-    0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x38, 0x00, 0x00, 0x02, 0xDF, 0x40, 0x0D, 0x00, 0x00, 0x01,
-    0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x3F, 0xAB, 0xC0, 0x00, 0x00, 0x78, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3D, 0x57,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x55, 0xF8, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x3E, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0xC0,
-    0x07, 0x80, 0x1F, 0xE0, 0x07, 0xFF, 0xFF, 0xD0, 0x2F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0x69, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xE5, 0xBF, 0x80, 0xFC, 0x00, 0x2D, 0x0F, 0xC0,
-    0x00, 0xB0, 0x7C, 0x00, 0x02, 0x83, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0C, 0x0F, 0xF4, 0x06, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xAA, 0xAF, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x02, 0xF0, 0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x01, 0xC0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
-    0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x02, 0xF0,
-    0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
-    0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78,
-    0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x02, 0xD0, 0x0C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00,
-    0x07, 0xC0, 0x03, 0x80, 0x02, 0xF0, 0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0,
-    0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xB0, 0x2D, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0xAA,
-    0xBC, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x0B, 0xC0, 0x03, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xAA, 0xA0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0x00,
-    0x0B, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x06, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x40, 0x3F, 0xFE, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xBF, 0x80,
-    0x1F, 0xFF, 0x40, 0x00, 0x00, 0x06, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xFE, 0x00, 0x0B, 0xF4, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x1F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0xF4, 0x7C, 0x00, 0xF4, 0x07, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x01, 0xBF, 0x80, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2C, 0x0B, 0x00, 0x3F, 0x4B, 0xD0,
-    0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x06, 0xFE, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x19, 0xF4,
-    0x5F, 0xF4, 0x00, 0x07, 0xC0, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x07, 0xE0, 0x00, 0xB8, 0x00, 0x0F,
-    0xC0, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x05, 0xBD, 0x54, 0x02, 0xF0, 0x3F,
-    0xFF, 0xF0, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0xF0, 0x00,
-    0x0B, 0xC0, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xBE, 0x00,
-    0x1B, 0xFA, 0xBF, 0xD0, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xE0, 0x00, 0x00, 0x03, 0xEF, 0xF4, 0x00, 0x00,
-    0x00, 0xD2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x15, 0x54, 0x03, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0x80, 0x00, 0xB8, 0x00, 0x07,
-    0xF0, 0x00, 0x2D, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0x00, 0x00, 0xFB, 0xC0, 0x03, 0xC0, 0x00, 0x3C,
-    0xF8, 0x01, 0xE0, 0x00, 0x0F, 0x2F, 0x00, 0xB4, 0x00, 0x07, 0x83, 0xD0, 0x3D, 0x00, 0x02, 0xD0,
-    0xBC, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x43, 0xC0, 0x00, 0x3C, 0x03, 0xE1, 0xE0, 0x00, 0x1F, 0x00,
-    0x7C, 0xB4, 0x00, 0x07, 0x80, 0x0F, 0xBC, 0x00, 0x02, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0xBE, 0x40, 0x07, 0xE0, 0x01, 0xFF, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFE, 0x56, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0xFC, 0x00,
-    0x03, 0xF0, 0x7C, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x03, 0xDB, 0xC0,
-    0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x0F, 0x8F,
-    0x80, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x02, 0xF0, 0x0F, 0xD0, 0x07, 0xF0,
-    0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0xFE, 0x56, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00,
-    0x7D, 0x3E, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0xF7, 0xE0, 0x00,
-    0x00, 0x7C, 0xF8, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x07, 0xC3, 0xF0,
-    0x00, 0x03, 0xE0, 0x7D, 0x00, 0x02, 0xF0, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00,
-    0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xBD, 0x00, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x0F, 0x40, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFE, 0x56, 0xFC, 0x00,
-    0xFC, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x0F,
-    0x5F, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00,
-    0x2F, 0x3E, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x03, 0xE0, 0x7D, 0x00,
-    0x02, 0xF0, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0xFE, 0x1C, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x2C, 0x3F, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFE, 0x56, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0xFC,
-    0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x03, 0xDB,
-    0xC0, 0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x0F,
-    0x8F, 0x80, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x02, 0xF0, 0x0F, 0xD0, 0x07,
-    0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0xB0, 0x00, 0x03, 0xF4, 0xBD, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x5B,
-    0xF0, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x01, 0xF4, 0xF8, 0x00,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x03, 0xDF, 0x80, 0x00, 0x01, 0xF3, 0xE0,
-    0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0F, 0x81,
-    0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x1F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x1C, 0x7C, 0x07, 0xC1, 0xF1, 0xF0, 0x07,
-    0xFC, 0x00, 0x2F, 0x00, 0x07, 0xFC, 0x01, 0xF1, 0xF0, 0x7C, 0x07, 0xCB, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x90, 0x04, 0x00, 0x01, 0xFF, 0xFE, 0x2D, 0x00, 0x0F, 0xE5, 0x6F, 0xF4,
-    0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xF0, 0x00, 0x3E, 0xF4, 0x03,
-    0xE0, 0x00, 0xF4, 0xF4, 0x07, 0xC0, 0x03, 0xC0, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xF4, 0x0F, 0x80,
-    0x3C, 0x01, 0xF0, 0x0F, 0x80, 0xF0, 0x02, 0xF0, 0x0F, 0x83, 0xC0, 0x03, 0xE0, 0x0F, 0x9F, 0x00,
-    0x07, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x07, 0xF4, 0x01, 0xFC,
-    0x00, 0x1E, 0xFF, 0xAF, 0xE0, 0x00, 0x38, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x55, 0x57,
-    0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00,
-    0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00, 0x0B, 0x40, 0x2E,
-    0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x1E,
-    0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x55,
-    0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x0F, 0x80,
-    0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00, 0x0B, 0x40,
-    0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00,
-    0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFB, 0xD0, 0x00,
-    0x00, 0x7D, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00,
-    0x55, 0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x0F,
-    0x80, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00, 0x0B,
-    0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07, 0xC0,
-    0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F, 0x80,
-    0x03, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0xB0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0x83, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x05, 0x55, 0x7F, 0xFC,
-    0x01, 0xFF, 0xE1, 0xBD, 0x00, 0x07, 0xE0, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x03, 0xC0,
-    0x0F, 0x40, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x2F, 0x00, 0x00, 0xB4, 0x02, 0xE0, 0x00,
-    0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x07,
-    0xC0, 0x00, 0x2D, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x15, 0x51, 0xFF, 0xF4, 0x2F,
-    0xFD, 0x1F, 0xD0, 0x01, 0xF8, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x0B, 0xC0,
-    0x3C, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x3E, 0x2E, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0xE8, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0xBE, 0xBF, 0xC0, 0x03, 0xD0, 0x1F, 0x80,
-    0x0F, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0xBC, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0x80, 0x0F, 0x40, 0x3D,
-    0x00, 0xFC, 0x00, 0xF0, 0x2F, 0xC0, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0x94, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x1B, 0xE4, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xE5, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x1F,
-    0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x74, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x02,
-    0xC0, 0x00, 0x00, 0xB8, 0x07, 0x40, 0x00, 0x00, 0xB4, 0x0E, 0x00, 0x00, 0x00, 0xF4, 0x1E, 0x00,
-    0x00, 0x00, 0xF0, 0x1F, 0x40, 0x00, 0x01, 0xF0, 0x0B, 0xD0, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07,
-    0xCB, 0x00, 0xB4, 0x00, 0x0B, 0x8F, 0xEA, 0xE0, 0x00, 0x0F, 0x43, 0xFF, 0x40, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x74, 0x7C, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x87, 0x40, 0xBF, 0xFF, 0xC0, 0x7D, 0x0B, 0xE0, 0x3C,
-    0x00, 0xF4, 0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x1F, 0x07, 0x80, 0x0B, 0x82, 0xD0, 0x07, 0xD0, 0xF4,
-    0x03, 0xF0, 0x3D, 0x02, 0xFC, 0x1F, 0xC2, 0xCF, 0x3E, 0xFF, 0xD3, 0xFC, 0x3F, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x87,
-    0x40, 0xBF, 0xFF, 0xC0, 0x7D, 0x0B, 0xE0, 0x3C, 0x00, 0xF4, 0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x1F,
-    0x07, 0x80, 0x0B, 0x82, 0xD0, 0x07, 0xD0, 0xF4, 0x03, 0xF0, 0x3D, 0x02, 0xFC, 0x1F, 0xC2, 0xCF,
-    0x3E, 0xFF, 0xD3, 0xFC, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3D, 0xF0, 0x00, 0x3C, 0x2D, 0x00, 0x3D, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x87, 0x40, 0xBF, 0xFF, 0xC0, 0x7D, 0x0B, 0xE0, 0x3C,
-    0x00, 0xF4, 0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x1F, 0x07, 0x80, 0x0B, 0x82, 0xD0, 0x07, 0xD0, 0xF4,
-    0x03, 0xF0, 0x3D, 0x02, 0xFC, 0x1F, 0xC2, 0xCF, 0x3E, 0xFF, 0xD3, 0xFC, 0x3F, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xC0, 0x07, 0xFE, 0xF0, 0x02, 0xC3, 0xF4,
-    0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D, 0x02, 0xFF, 0xFF,
-    0x01, 0xF4, 0x2F, 0x80, 0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x2E,
-    0x0B, 0x40, 0x1F, 0x43, 0xD0, 0x0F, 0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C, 0xFB, 0xFF, 0x4F,
-    0xF0, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x2F, 0x4B, 0xD0, 0x0B,
-    0xC2, 0xF0, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x74, 0x0B,
-    0xFF, 0xFC, 0x07, 0xD0, 0xBE, 0x03, 0xC0, 0x0F, 0x43, 0xE0, 0x03, 0xC0, 0xF0, 0x01, 0xF0, 0x78,
-    0x00, 0xB8, 0x2D, 0x00, 0x7D, 0x0F, 0x40, 0x3F, 0x03, 0xD0, 0x2F, 0xC1, 0xFC, 0x2C, 0xF3, 0xEF,
-    0xFD, 0x3F, 0xC3, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x02, 0xFE, 0x00,
-    0x01, 0xD2, 0xC0, 0x00, 0xB0, 0x70, 0x00, 0x2C, 0x2C, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0x87, 0x40, 0xBF, 0xFF, 0xC0, 0x7D, 0x0B, 0xE0, 0x3C, 0x00, 0xF4,
-    0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x1F, 0x07, 0x80, 0x0B, 0x82, 0xD0, 0x07, 0xD0, 0xF4, 0x03, 0xF0,
-    0x3D, 0x02, 0xFC, 0x1F, 0xC2, 0xCF, 0x3E, 0xFF, 0xD3, 0xFC, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x0B, 0xF8, 0x01, 0xFF, 0xFF, 0xEB, 0xD0, 0x7D,
-    0x02, 0xF0, 0x2E, 0x0F, 0x40, 0x3C, 0x03, 0xD2, 0xE0, 0x07, 0x80, 0xBC, 0x3C, 0x00, 0xF4, 0x3F,
-    0x07, 0x80, 0x1F, 0x7F, 0x80, 0xB4, 0x03, 0xFF, 0x40, 0x0F, 0x40, 0xBF, 0x00, 0x00, 0xF4, 0x0F,
-    0xF0, 0x00, 0x4F, 0x83, 0xCF, 0x40, 0xB8, 0xBF, 0xF0, 0xFF, 0xFE, 0x03, 0xF8, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0xD0, 0xB8, 0x18, 0x1E,
-    0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00,
-    0x4B, 0xC0, 0x78, 0x7F, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0B, 0xE0, 0x00,
-    0x1E, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xC0, 0x0B, 0xAF, 0xC0, 0xB4, 0x1F, 0x07, 0x80, 0x7C, 0x3C, 0x03, 0xD1, 0xE0, 0xBD,
-    0x0B, 0xAF, 0xC0, 0x3F, 0xE4, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x01, 0x0F, 0xC0, 0x7C, 0x1F, 0xFF,
-    0xD0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0,
-    0x0B, 0xAF, 0xC0, 0xB4, 0x1F, 0x07, 0x80, 0x7C, 0x3C, 0x03, 0xD1, 0xE0, 0xBD, 0x0B, 0xAF, 0xC0,
-    0x3F, 0xE4, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x01, 0x0F, 0xC0, 0x7C, 0x1F, 0xFF, 0xD0, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0x7C, 0x00,
-    0xF0, 0xB4, 0x0F, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x0B, 0xAF, 0xC0,
-    0xB4, 0x1F, 0x07, 0x80, 0x7C, 0x3C, 0x03, 0xD1, 0xE0, 0xBD, 0x0B, 0xAF, 0xC0, 0x3F, 0xE4, 0x00,
-    0xF4, 0x00, 0x03, 0xD0, 0x01, 0x0F, 0xC0, 0x7C, 0x1F, 0xFF, 0xD0, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x14, 0x02, 0xF4, 0xBD, 0x02, 0xF0, 0xBC, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0, 0x1E, 0x01, 0xF0, 0x3C,
-    0x03, 0xD0, 0x78, 0x2F, 0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0x40, 0xFC, 0x07, 0xC0, 0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
-    0x00, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xFF, 0x00, 0x3C,
-    0x01, 0xF0, 0x0B, 0x80, 0x3D, 0x01, 0xF0, 0x0B, 0xC0, 0x3D, 0x00, 0xF0, 0x47, 0xCF, 0x2F, 0xF0,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x0F, 0x04, 0x07, 0xCF, 0x02, 0xFF,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0xE0, 0x0F, 0x7C, 0x0F,
-    0x0B, 0x4F, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xF0, 0x00, 0x3C, 0x00, 0x1F,
-    0x00, 0x0B, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x0F, 0x04, 0x07, 0xCF,
-    0x02, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x42, 0xF4, 0xBD, 0x2F, 0x0B, 0xC0,
-    0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x7C,
-    0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x03, 0xC1, 0x00,
-    0x7C, 0xF0, 0x0B, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x03, 0xF2,
-    0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0x7C, 0x00, 0x02, 0x0B, 0x80, 0x00, 0x00,
-    0xF0, 0x00, 0xBF, 0xAC, 0x01, 0xFE, 0xFF, 0x40, 0xF4, 0x0B, 0xE0, 0xF8, 0x00, 0xF8, 0x7C, 0x00,
-    0x3E, 0x2E, 0x00, 0x0F, 0x4F, 0x40, 0x03, 0xC3, 0xD0, 0x00, 0xF0, 0xF4, 0x00, 0xB8, 0x3D, 0x00,
-    0x3C, 0x0F, 0xC0, 0x3D, 0x01, 0xFE, 0xBE, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x70, 0x00, 0x7F, 0xEF, 0x00, 0x0B, 0x1F, 0xD0, 0x00, 0x10, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x0B, 0xE0, 0xBF, 0xC3, 0xFF, 0x00, 0x78,
-    0xF4, 0xF4, 0x0B, 0xBC, 0x0F, 0x00, 0xFF, 0x01, 0xF0, 0x0F, 0xD0, 0x2E, 0x00, 0xF8, 0x03, 0xD0,
-    0x1F, 0x00, 0x3C, 0x02, 0xE0, 0x07, 0xC0, 0x3D, 0x00, 0xB8, 0x43, 0xC0, 0x0F, 0x5D, 0x7C, 0x00,
-    0xFF, 0x8B, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE0, 0x02, 0xFF, 0xF8, 0x0F, 0xC0, 0x7C, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0x3E,
-    0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0xB8, 0xF8, 0x00, 0xF0, 0xBC,
-    0x03, 0xE0, 0x7F, 0xAF, 0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x02, 0xFF, 0xF8, 0x0F, 0xC0, 0x7C, 0x2F, 0x00, 0x3D, 0x3D,
-    0x00, 0x3E, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0xB8, 0xF8, 0x00,
-    0xF0, 0xBC, 0x03, 0xE0, 0x7F, 0xAF, 0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x3D, 0x2D, 0x00, 0xF4, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x02, 0xFF, 0xF8, 0x0F, 0xC0, 0x7C, 0x2F, 0x00,
-    0x3D, 0x3D, 0x00, 0x3E, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0xB8,
-    0xF8, 0x00, 0xF0, 0xBC, 0x03, 0xE0, 0x7F, 0xAF, 0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE1, 0xC0, 0x07, 0xFE, 0xF0, 0x02, 0xC3, 0xF4, 0x00, 0x10, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x02, 0xFF, 0xF8, 0x03, 0xF0, 0x1F, 0x02,
-    0xF0, 0x03, 0xD0, 0xF4, 0x00, 0xF8, 0x7C, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0x4F, 0x40, 0x03, 0xC3,
-    0xD0, 0x02, 0xE0, 0xF8, 0x00, 0xF0, 0x2F, 0x00, 0xF8, 0x07, 0xFA, 0xF8, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x2F, 0x4B, 0xD0, 0x0B, 0xC2, 0xF0, 0x00, 0x40,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0B, 0xFF, 0xE0, 0x0F, 0xC0,
-    0x7C, 0x0B, 0xC0, 0x0F, 0x43, 0xD0, 0x03, 0xE1, 0xF0, 0x00, 0xF4, 0xB8, 0x00, 0x3D, 0x3D, 0x00,
-    0x0F, 0x0F, 0x40, 0x0B, 0x83, 0xE0, 0x03, 0xC0, 0xBC, 0x03, 0xE0, 0x1F, 0xEB, 0xE0, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x57, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x1C, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFC, 0x07, 0xE0, 0x02, 0xF0, 0x0B, 0xD0, 0x03, 0xD0, 0x3F,
-    0xE0, 0x07, 0xC0, 0xF3, 0xE0, 0x0B, 0x87, 0xC3, 0xD0, 0x0F, 0x5E, 0x03, 0xC0, 0x0F, 0xF8, 0x0B,
-    0x80, 0x0F, 0xD0, 0x0F, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x3F, 0xFA, 0xF8, 0x00, 0xB1, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B,
-    0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8,
-    0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00,
-    0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B,
-    0x80, 0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x2D, 0x1E,
-    0x00, 0x0B, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC,
-    0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0,
-    0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F,
-    0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00,
-    0x07, 0xD1, 0xF4, 0x00, 0xBC, 0x2F, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B,
-    0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8,
-    0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B,
-    0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02,
-    0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01,
-    0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x06, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x82, 0xF8, 0x00, 0x2D, 0x3F, 0xF4,
-    0x00, 0xF7, 0xC3, 0xE0, 0x03, 0xEC, 0x0B, 0xC0, 0x0F, 0xC0, 0x2E, 0x00, 0x7D, 0x00, 0xB8, 0x02,
-    0xF0, 0x03, 0xD0, 0x0F, 0x40, 0x0F, 0x00, 0x3C, 0x00, 0xB8, 0x01, 0xF0, 0x03, 0xC0, 0x0B, 0x80,
-    0x3E, 0x00, 0x3F, 0xEB, 0xE0, 0x00, 0xFB, 0xFD, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xAA, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x20, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0x01, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C,
-    0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0,
-    0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x76, 0xE0, 0x00, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x00, 0x1D, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x3D, 0x00, 0x00, 0x0B, 0x40, 0xF4, 0x00, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x03, 0xE5, 0x5B, 0xC0,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xF5, 0x55, 0xBD, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x3C,
-    0x00, 0x03, 0xE0, 0x02, 0xE0, 0x00, 0x0F, 0xC0, 0x2F, 0x90, 0x00, 0x7F, 0x93, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xC0, 0x00, 0x2A, 0xAA, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE1, 0xD0, 0x2F, 0xFF, 0xF0, 0x1F, 0x42, 0xF8, 0x0F, 0x00, 0x3D, 0x0F,
-    0x80, 0x0F, 0x03, 0xC0, 0x07, 0xC1, 0xE0, 0x02, 0xE0, 0xB4, 0x01, 0xF4, 0x3D, 0x00, 0xFC, 0x0F,
-    0x40, 0xBF, 0x07, 0xF0, 0xB3, 0xCF, 0xBF, 0xF4, 0xFF, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00, 0x01, 0xF9, 0xB8, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x74, 0x3C, 0x00, 0x00, 0x03,
-    0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x0F, 0x95, 0x6F,
-    0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00,
-    0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x40, 0x01, 0xFE, 0x4F, 0xFF, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x80, 0x07, 0xD1, 0xF0, 0x00, 0xFF, 0xF0, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D, 0x02, 0xFF, 0xFF, 0x01,
-    0xF4, 0x2F, 0x80, 0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x2E, 0x0B,
-    0x40, 0x1F, 0x43, 0xD0, 0x0F, 0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C, 0xFB, 0xFF, 0x4F, 0xF0,
-    0xFF, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00,
-    0x00, 0xF1, 0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x02, 0xD0,
-    0x3D, 0x00, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3D, 0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0xB8,
-    0x00, 0x03, 0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE1, 0xD0,
-    0x2F, 0xFF, 0xF0, 0x1F, 0x42, 0xF8, 0x0F, 0x00, 0x3D, 0x0F, 0x80, 0x0F, 0x03, 0xC0, 0x07, 0xC1,
-    0xE0, 0x02, 0xE0, 0xB4, 0x01, 0xF4, 0x3D, 0x00, 0xFC, 0x0F, 0x40, 0xBF, 0x07, 0xF0, 0xB3, 0xCF,
-    0xBF, 0xF4, 0xFF, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x40, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0xB9, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x16, 0x94, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFE, 0x5B, 0xF8, 0x0F, 0xC0, 0x02, 0xD0,
-    0xFC, 0x00, 0x0B, 0x07, 0xC0, 0x00, 0x28, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xC0, 0xFF, 0x40, 0x6F, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x1F,
-    0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x0B, 0xFF, 0x40, 0xB8, 0x18, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80,
-    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x01, 0x0B, 0xC0, 0x78, 0x1F, 0xFF, 0xC0, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xBE,
-    0x00, 0x00, 0xF8, 0x3C, 0x00, 0x0B, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x94, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0xFE, 0x5B, 0xF8, 0x0F, 0xC0, 0x02, 0xD0, 0xFC, 0x00, 0x0B, 0x07, 0xC0,
-    0x00, 0x28, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0xC0, 0xFF, 0x40, 0x6F, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0x7C, 0x00, 0xF0,
-    0xB4, 0x0F, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0B, 0xFF, 0x40, 0xB8,
-    0x18, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xE0, 0x01, 0x0B, 0xC0, 0x78, 0x1F, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x94, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFE,
-    0x5B, 0xF8, 0x0F, 0xC0, 0x02, 0xD0, 0xFC, 0x00, 0x0B, 0x07, 0xC0, 0x00, 0x28, 0x3E, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xC0, 0xFF,
-    0x40, 0x6F, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x2F, 0xFD, 0x0B, 0x81, 0x81, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40,
-    0x00, 0xF4, 0x00, 0x0F, 0x80, 0x04, 0xBC, 0x07, 0x87, 0xFF, 0xF0, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x3C, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x03, 0xF7, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xFE, 0x5B, 0xF8, 0x03, 0xF0, 0x00, 0xB4, 0x0F, 0xC0, 0x00, 0xB0,
-    0x1F, 0x00, 0x00, 0xA0, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xC0, 0x3F, 0xD0, 0x1B, 0xC0, 0x0F, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x2D, 0x00, 0xF0,
-    0xB4, 0x00, 0xBA, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x02, 0xFF, 0xD0, 0x0B, 0x81, 0x80, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x40, 0xBC, 0x07,
-    0x80, 0x7F, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x2E, 0x00, 0x00, 0x0F, 0x82, 0xE0, 0x00, 0x00, 0x1F, 0x6E, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x50, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0x7D, 0x17, 0xFD, 0x00, 0x01, 0xF0, 0x01, 0xFC, 0x00, 0x0B,
-    0xC0, 0x01, 0xF8, 0x00, 0x2E, 0x00, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x00,
-    0x1F, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x0F, 0x80,
-    0x0F, 0x40, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x0B, 0xC0,
-    0x00, 0xF8, 0x00, 0x3E, 0x00, 0x2F, 0x80, 0x06, 0xFE, 0xAF, 0xF4, 0x00, 0x7F, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x01, 0x42, 0xD0, 0x00, 0x07, 0xFC, 0x3C, 0x00, 0x00, 0x6B, 0xC3, 0x80, 0x00, 0x00, 0x7C,
-    0x70, 0x00, 0x00, 0x0B, 0x81, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02,
-    0xF9, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x0F, 0x00, 0x3C, 0x00,
-    0x02, 0xE0, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x07, 0x80, 0x0B, 0x80, 0x00, 0xB4, 0x01,
-    0xF4, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0xF4, 0x0B, 0xF0, 0x40, 0x0F, 0xC2, 0xCF, 0x3C, 0x00,
-    0xBF, 0xF4, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0xA9, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x19, 0xF4, 0x5F, 0xF4, 0x00, 0x07, 0xC0, 0x07,
-    0xF0, 0x00, 0x2F, 0x00, 0x07, 0xE0, 0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x2F, 0x00,
-    0x0F, 0x00, 0x00, 0x7C, 0x05, 0xBD, 0x54, 0x02, 0xF0, 0x3F, 0xFF, 0xF0, 0x0B, 0xC0, 0x0F, 0x80,
-    0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x07, 0xC0, 0x00, 0x7D,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xBE, 0x00, 0x1B, 0xFA, 0xBF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x06, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xAF, 0xE4, 0x00, 0x0A, 0xBF, 0x80,
-    0x00, 0x00, 0xF0, 0x00, 0x06, 0x93, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0x87, 0xF4, 0x00, 0xF4,
-    0x03, 0xC0, 0x0B, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xE0, 0x02, 0xE0, 0x0B, 0x40, 0x1F,
-    0x40, 0x3D, 0x00, 0xFC, 0x00, 0xF4, 0x0B, 0xF0, 0x43, 0xF0, 0xB3, 0xCF, 0x0B, 0xFF, 0x4F, 0xF0,
-    0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0xAA, 0xBC, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x0B,
-    0xC0, 0x03, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x1F, 0xAA, 0xA0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x01,
-    0xE0, 0x06, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xAA, 0xA8, 0x01, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B,
-    0x41, 0xF0, 0x1E, 0x01, 0xF0, 0x3C, 0x03, 0xD0, 0x78, 0x2F, 0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90,
-    0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x40, 0xFC, 0x07, 0xC0, 0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x02, 0x40, 0x00, 0x0F, 0xDB, 0xC0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
-    0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x02, 0xF0,
-    0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
-    0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78,
-    0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x08, 0x01,
-    0xF4, 0x7C, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0, 0x1E, 0x01, 0xF0, 0x3C, 0x03, 0xD0, 0x78, 0x2F, 0x40,
-    0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x40, 0xFC, 0x07, 0xC0, 0x7F,
-    0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00, 0x07,
-    0xC0, 0x03, 0x80, 0x02, 0xF0, 0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0, 0x00,
-    0xF0, 0x00, 0xF8, 0x00, 0x78, 0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFC, 0x00, 0xBA, 0xFC, 0x0B, 0x41, 0xF0, 0x78, 0x07, 0xC3, 0xC0, 0x3D, 0x1E, 0x0B, 0xD0, 0xBA,
-    0xFC, 0x03, 0xFE, 0x40, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x10, 0xFC, 0x07, 0xC1, 0xFF, 0xFD, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFA,
-    0xAA, 0xF0, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x0C, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x1C,
-    0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x1B, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x2F, 0x90, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x00, 0x2E, 0xBF, 0x02, 0xD0, 0x7C, 0x1E, 0x01, 0xF0, 0xF0, 0x0F, 0x47, 0x82, 0xF4, 0x2E, 0xBF,
-    0x00, 0xFF, 0x90, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x04, 0x3F, 0x01, 0xF0, 0x7F, 0xFF, 0x40, 0xBF,
-    0xF0, 0x00, 0x0B, 0x00, 0x00, 0x74, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x90, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x03, 0xC0, 0x00, 0x1F, 0x07, 0xD0, 0x00,
-    0x03, 0xF7, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xEA, 0xAB, 0xC0, 0x01, 0xF0, 0x00,
-    0xE0, 0x00, 0xBC, 0x00, 0x30, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x01, 0xFA, 0xAA, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x70, 0x00, 0xBC, 0x00, 0x3C, 0x00,
-    0x3E, 0x00, 0x1E, 0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x2D, 0x00, 0xF0, 0xB4, 0x00, 0xBA, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0, 0x1E, 0x01,
-    0xF0, 0x3C, 0x03, 0xD0, 0x78, 0x2F, 0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00,
-    0xF4, 0x00, 0x40, 0xFC, 0x07, 0xC0, 0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xC3, 0xD0,
-    0x00, 0x07, 0x80, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x7F, 0x96, 0xFE, 0x00, 0x7E, 0x00, 0x0B, 0x80, 0x7D, 0x00, 0x02, 0xD0, 0x3E, 0x00,
-    0x00, 0xA0, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFF, 0x1F, 0x00, 0x01, 0x7F, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0xF8, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0xF4, 0x03, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x3C, 0x3D, 0x00,
-    0x00, 0x3C, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB,
-    0x40, 0x01, 0xFA, 0xFF, 0xC0, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x3C, 0x01,
-    0xE0, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x02,
-    0xFA, 0xFF, 0x00, 0x07, 0xD0, 0x0B, 0xF0, 0x03, 0xD0, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0x0F, 0x40,
-    0x3F, 0x40, 0x1F, 0x80, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x04, 0x00, 0x00, 0xF0, 0x0A, 0x00, 0x00, 0x3F, 0xAF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x7F, 0x96, 0xFE, 0x00, 0x7E, 0x00, 0x0B, 0x80, 0x7D, 0x00, 0x02, 0xD0, 0x3E, 0x00, 0x00, 0xA0,
-    0x1F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x1F, 0xFF, 0x1F, 0x00, 0x01, 0x7F, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0xF8, 0x00,
-    0x03, 0xE0, 0x2F, 0x40, 0x00, 0xF4, 0x03, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0xC0, 0x00, 0x07, 0xD1, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xED, 0x00, 0x07, 0xEB, 0xFF, 0x00, 0x07,
-    0xC0, 0x78, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x3C, 0x03, 0xC0, 0x00,
-    0x0F, 0x43, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x0B, 0xEB, 0xFC, 0x00, 0x1F, 0x40, 0x2F,
-    0xC0, 0x0F, 0x40, 0x01, 0xF4, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x7F, 0x96, 0xFE, 0x00, 0x7E, 0x00,
-    0x0B, 0x80, 0x7D, 0x00, 0x02, 0xD0, 0x3E, 0x00, 0x00, 0xA0, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFF, 0x1F,
-    0x00, 0x01, 0x7F, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0xF8, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0xF4,
-    0x03, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xB4,
-    0x00, 0x1F, 0xAF, 0xFC, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xC0, 0x1E,
-    0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x2F,
-    0xAF, 0xF0, 0x00, 0x7D, 0x00, 0xBF, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0xF4, 0x03,
-    0xF4, 0x01, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x07, 0xF9, 0x6F, 0xE0, 0x07, 0xE0, 0x00, 0xB8, 0x07, 0xD0,
-    0x00, 0x2D, 0x03, 0xE0, 0x00, 0x0A, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xFF, 0xF1, 0xF0, 0x00, 0x17, 0xF0,
-    0x3D, 0x00, 0x00, 0xB8, 0x0F, 0x80, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x3F, 0x80, 0x07,
-    0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0xD0, 0x00, 0x7E, 0xBF, 0xF0, 0x00, 0x7C, 0x07, 0x80, 0x00, 0x3D, 0x01, 0xF0, 0x00,
-    0x0F, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0xBE, 0xBF, 0xC0, 0x01, 0xF4, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x3D, 0x00,
-    0x03, 0xD0, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x54, 0x01, 0x55, 0x40, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xBD,
-    0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00,
-    0x7C, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x07, 0xFF, 0xD0,
-    0x2F, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7C,
-    0x3D, 0x00, 0x07, 0x80, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x06, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x07, 0x81, 0xFD, 0x00, 0x2D, 0x2F, 0xF8, 0x00, 0xF2, 0xE2, 0xF0, 0x03,
-    0xDD, 0x0B, 0x80, 0x1F, 0xD0, 0x3D, 0x00, 0xBF, 0x00, 0xF0, 0x02, 0xF0, 0x07, 0xC0, 0x0F, 0x80,
-    0x2E, 0x00, 0x3C, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xC1, 0x0B, 0x80, 0x0F, 0x3C, 0x3D, 0x00, 0x7F,
-    0xD0, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x01, 0x55, 0x40, 0x0F,
-    0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x02,
-    0xBF, 0xAA, 0xAA, 0xFE, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF4,
-    0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x6B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0A, 0xFE, 0x90, 0x00, 0x6B,
-    0xFA, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x0A, 0x80, 0x02, 0xD1, 0xFF, 0x80, 0x0F, 0x2F,
-    0x7E, 0x00, 0x3D, 0xE0, 0xB8, 0x01, 0xFE, 0x03, 0xD0, 0x0B, 0xF0, 0x0F, 0x00, 0x2F, 0x00, 0x7C,
-    0x00, 0xF8, 0x02, 0xE0, 0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x10, 0xB8, 0x00, 0xF3, 0xC3,
-    0xD0, 0x07, 0xFD, 0x0F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x0F,
-    0xE1, 0xC0, 0x07, 0xFF, 0xF0, 0x02, 0xC3, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x01, 0xBF, 0x80, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1C, 0x1F, 0xFB,
-    0xC2, 0xC3, 0xF4, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
-    0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xD0,
-    0x00, 0x3C, 0x10, 0x07, 0xCF, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x06, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0A, 0xAA, 0x81, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00,
-    0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x10, 0x07, 0xCF,
-    0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0E, 0x00, 0xC0,
-    0x03, 0xE6, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x03, 0xFF, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x01, 0xBF, 0x80, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x08, 0x1F, 0x47, 0xC0, 0xFF,
-    0xF0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3C, 0x00,
-    0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x3C,
-    0x10, 0x07, 0xCF, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x03,
-    0xFF, 0xE0, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00,
-    0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00,
-    0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0xF4, 0x00, 0x0B, 0x40,
-    0x00, 0xB0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x94, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x1F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F, 0x00,
-    0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xF0, 0x0F, 0x40, 0x3C, 0x11, 0xF3, 0xCB, 0xFC, 0x1F,
-    0xC0, 0x2C, 0x00, 0xD0, 0x0B, 0x00, 0x3E, 0x50, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x3F, 0xFE, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00,
-    0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00,
-    0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xBF, 0x80, 0x1F, 0xFF, 0x40, 0x2F, 0xC7,
-    0xFC, 0x03, 0xC0, 0x7C, 0x0B, 0x80, 0xF4, 0x1F, 0x02, 0xF0, 0x3D, 0x03, 0xC1, 0x7C, 0xFB, 0xFC,
-    0x7E, 0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x00, 0x3F, 0xFE, 0x0B, 0xFF, 0xC0, 0x01, 0xF8,
-    0x00, 0x7F, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00,
-    0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00,
-    0x7C, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x1B, 0xF8, 0x00, 0xBC, 0x00, 0x1F, 0xFF, 0x40, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x9F, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x02, 0xE0, 0x1F, 0xC0, 0x1F, 0xC0, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0x00,
-    0x0F, 0x00, 0x7C, 0x00, 0x7C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0x40, 0x0B, 0x40, 0x7C, 0x00, 0x3D,
-    0x02, 0xF0, 0x00, 0xF0, 0x0F, 0x40, 0x07, 0xC0, 0x3C, 0x10, 0x2E, 0x01, 0xF3, 0xC0, 0xF4, 0x0B,
-    0xFC, 0x03, 0xC0, 0x1F, 0x80, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0xE6, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0xF8, 0x3C, 0x00,
-    0x00, 0xB4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xEB, 0xE0, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x0F, 0x00,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x39, 0xBC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x50, 0x15, 0x54, 0x00, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x00,
-    0x1F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x2E, 0x07, 0xD0, 0x00, 0x00, 0x3D,
-    0x2F, 0x00, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00,
-    0x00, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0x02, 0xF0, 0x0B, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF8, 0x00,
-    0x1B, 0xF9, 0x00, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x0F, 0xF4, 0x00, 0x1A, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03,
-    0xD0, 0x00, 0x03, 0xC2, 0xF8, 0x03, 0xDF, 0xBD, 0x07, 0xF4, 0x2D, 0x0B, 0xD0, 0x3D, 0x0F, 0x80,
-    0xB8, 0x0F, 0x07, 0xF0, 0x1F, 0xBF, 0x40, 0x2F, 0xF8, 0x00, 0x3D, 0x7C, 0x00, 0x3C, 0x3E, 0x00,
-    0x7C, 0x1F, 0x80, 0x78, 0x0B, 0xF9, 0xB4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0x80, 0x7E, 0xBF, 0xC1, 0xFF, 0x07, 0x87, 0xD5, 0x0B, 0x5E, 0x00, 0x0F, 0x78, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xB4, 0x00, 0x2E, 0x7C, 0x00, 0x3C, 0x3D, 0x01, 0x3C,
-    0x1F, 0x4E, 0x7C, 0x0F, 0xFC, 0xB4, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x0D, 0x02, 0xF0, 0x00, 0xB0, 0x0F, 0x80, 0x07, 0xC1, 0xBF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x07, 0xF4, 0x1F, 0xF8, 0x0E, 0x90,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x7F, 0xC0, 0x1A, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40,
-    0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x2D, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00,
-    0xB8, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x07, 0xC1, 0x02, 0xE7, 0x80, 0xFF, 0xC0, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xD0, 0x2F, 0x00, 0x0B, 0x00, 0xF8, 0x00, 0x7C, 0x1B, 0xFF,
-    0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x7F, 0xC0, 0x1A, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0,
-    0x01, 0xF0, 0x00, 0xB8, 0x00, 0x2D, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00,
-    0x3D, 0x00, 0x0F, 0x00, 0x07, 0xC1, 0x02, 0xE7, 0x80, 0xFF, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x55, 0x54, 0x3C, 0x00, 0xFF, 0xF8, 0x78, 0x00, 0x1F, 0x80,
-    0xB0, 0x00, 0x1F, 0x00, 0xE0, 0x00, 0x2F, 0x00, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x34, 0x02, 0xF0, 0x00,
-    0xB0, 0x03, 0xE0, 0x01, 0xF0, 0x1B, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x10,
-    0x00, 0x01, 0xE0, 0x05, 0x0B, 0x47, 0xFC, 0x3C, 0x1A, 0xF0, 0xE0, 0x07, 0xC7, 0x00, 0x2E, 0x04,
-    0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x40,
-    0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC1,
-    0x00, 0x2E, 0x78, 0x00, 0xFF, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x68, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x7C, 0x01,
-    0xFC, 0x00, 0xBC, 0x00, 0x90, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x34, 0x02, 0xF0, 0x00, 0xB0, 0x03, 0xE0, 0x01, 0xF0, 0x1B, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x50, 0x01, 0xFF, 0x00, 0x1A, 0xF0, 0x00, 0x1F, 0x00, 0x02,
-    0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xB4, 0x1D, 0x0F, 0x47,
-    0xF0, 0xF0, 0x7D, 0x1F, 0x01, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x10, 0x0B,
-    0x9E, 0x00, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x0A, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xD0, 0x2F,
-    0x00, 0x0B, 0x00, 0xF8, 0x00, 0x7C, 0x1B, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x05,
-    0x00, 0x1F, 0xF0, 0x01, 0xAF, 0x00, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00,
-    0x07, 0xC0, 0x00, 0xBE, 0xC0, 0x0B, 0xF4, 0x01, 0xF8, 0x00, 0xBF, 0x00, 0x3E, 0xF0, 0x00, 0x2E,
-    0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC1, 0x00, 0xB9, 0xE0, 0x0F, 0xFC, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x15, 0x54, 0x03, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0x80,
-    0x00, 0xB8, 0x00, 0x07, 0xF0, 0x00, 0x2D, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0x00, 0x00, 0xFB, 0xC0,
-    0x03, 0xC0, 0x00, 0x3C, 0xF8, 0x01, 0xE0, 0x00, 0x0F, 0x2F, 0x00, 0xB4, 0x00, 0x07, 0x83, 0xD0,
-    0x3D, 0x00, 0x02, 0xD0, 0xBC, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x43, 0xC0, 0x00, 0x3C, 0x03, 0xE1,
-    0xE0, 0x00, 0x1F, 0x00, 0x7C, 0xB4, 0x00, 0x07, 0x80, 0x0F, 0xBC, 0x00, 0x02, 0xD0, 0x01, 0xFF,
-    0x00, 0x00, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBE, 0x40, 0x07, 0xE0, 0x01, 0xFF, 0xF0, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x80, 0xBE, 0x0B, 0xFC, 0x3F, 0xF0, 0x07, 0x8F, 0x4F, 0x40, 0xBB, 0xC0,
-    0xF0, 0x0F, 0xF0, 0x1F, 0x00, 0xFD, 0x02, 0xE0, 0x0F, 0x80, 0x3D, 0x01, 0xF0, 0x03, 0xC0, 0x2E,
-    0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x84, 0x3C, 0x00, 0xF5, 0xD7, 0xC0, 0x0F, 0xF8, 0xB8, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0x55, 0x40, 0x3F, 0xD0, 0x01, 0xFF, 0xE0, 0x02,
-    0xF8, 0x00, 0x0B, 0x80, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0xF0, 0x00, 0x0F,
-    0xBC, 0x00, 0x3C, 0x00, 0x03, 0xCF, 0x80, 0x1E, 0x00, 0x00, 0xF2, 0xF0, 0x0B, 0x40, 0x00, 0x78,
-    0x3D, 0x03, 0xD0, 0x00, 0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x0F, 0x00, 0xF4, 0x3C, 0x00, 0x03, 0xC0,
-    0x3E, 0x1E, 0x00, 0x01, 0xF0, 0x07, 0xCB, 0x40, 0x00, 0x78, 0x00, 0xFB, 0xC0, 0x00, 0x2D, 0x00,
-    0x1F, 0xF0, 0x00, 0x0F, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xE4, 0x00, 0x7E, 0x00, 0x1F, 0xFF, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x0B, 0xE0, 0xBF,
-    0xC3, 0xFF, 0x00, 0x78, 0xF4, 0xF4, 0x0B, 0xBC, 0x0F, 0x00, 0xFF, 0x01, 0xF0, 0x0F, 0xD0, 0x2E,
-    0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0x3C, 0x02, 0xE0, 0x07, 0xC0, 0x3D, 0x00, 0xB8, 0x43, 0xC0,
-    0x0F, 0x5D, 0x7C, 0x00, 0xFF, 0x8B, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0,
-    0xF4, 0x00, 0x00, 0x00, 0xBD, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x05, 0x55, 0x00, 0xFF, 0x40, 0x07,
-    0xFF, 0x80, 0x0B, 0xE0, 0x00, 0x2E, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0x40, 0x00, 0xBF, 0x80, 0x03,
-    0xC0, 0x00, 0x3E, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0x3E, 0x00, 0x78, 0x00, 0x03, 0xCB, 0xC0, 0x2D,
-    0x00, 0x01, 0xE0, 0xF4, 0x0F, 0x40, 0x00, 0xB4, 0x2F, 0x03, 0xC0, 0x00, 0x3C, 0x03, 0xD0, 0xF0,
-    0x00, 0x0F, 0x00, 0xF8, 0x78, 0x00, 0x07, 0xC0, 0x1F, 0x2D, 0x00, 0x01, 0xE0, 0x03, 0xEF, 0x00,
-    0x00, 0xB4, 0x00, 0x7F, 0xC0, 0x00, 0x3C, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0x90, 0x01, 0xF8, 0x00,
-    0x7F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0xB4, 0x00, 0x3C, 0x2D, 0x00, 0x02, 0xEB, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0xBE, 0x0B, 0xFC, 0x3F, 0xF0, 0x07, 0x8F,
-    0x4F, 0x40, 0xBB, 0xC0, 0xF0, 0x0F, 0xF0, 0x1F, 0x00, 0xFD, 0x02, 0xE0, 0x0F, 0x80, 0x3D, 0x01,
-    0xF0, 0x03, 0xC0, 0x2E, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x84, 0x3C, 0x00, 0xF5, 0xD7, 0xC0, 0x0F,
-    0xF8, 0xB8, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xBF, 0x01, 0xFC, 0x0D, 0x07, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0xF3, 0xD3, 0xE0, 0x00, 0x07, 0xAC, 0x0F, 0x40, 0x00, 0x2F, 0xC0, 0x3C, 0x00, 0x00, 0xFE, 0x01,
-    0xF0, 0x00, 0x03, 0xF0, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0xF0, 0x00,
-    0x02, 0xE0, 0x07, 0xC1, 0x00, 0x0F, 0x40, 0x2E, 0x78, 0x00, 0x3C, 0x00, 0xBF, 0xC0, 0x01, 0xF0,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0x55, 0x40, 0x3F, 0xD0, 0x01,
-    0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F, 0xE0, 0x00,
-    0xF0, 0x00, 0x0F, 0xBC, 0x00, 0x3C, 0x00, 0x03, 0xCF, 0x80, 0x1E, 0x00, 0x00, 0xF2, 0xF0, 0x0B,
-    0x40, 0x00, 0x78, 0x3D, 0x03, 0xD0, 0x00, 0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x0F, 0x00, 0xF4, 0x3C,
-    0x00, 0x03, 0xC0, 0x2E, 0x1E, 0x00, 0x01, 0xF0, 0x03, 0xCB, 0x40, 0x00, 0x78, 0x00, 0xFB, 0xC0,
-    0x00, 0x2D, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xE4, 0x00, 0x7D, 0x00,
-    0x1F, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE0, 0x2F, 0x8B, 0xFC, 0x3F, 0xF0, 0x1E, 0x3D, 0x3D, 0x0B, 0xBC, 0x0F,
-    0x03, 0xFC, 0x07, 0xC0, 0xFD, 0x02, 0xE0, 0x3E, 0x00, 0xF4, 0x1F, 0x00, 0x3C, 0x0B, 0x80, 0x1F,
-    0x03, 0xD0, 0x0B, 0x80, 0xF0, 0x03, 0xD0, 0x7C, 0x00, 0xF0, 0x2E, 0x00, 0x7C, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x03, 0xDB, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x03,
-    0xF9, 0x5B, 0xF0, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x01, 0xF4,
-    0xF8, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x03, 0xDF, 0x80, 0x00, 0x01,
-    0xF3, 0xE0, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x1F, 0x0F, 0xC0, 0x00,
-    0x0F, 0x81, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x1F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x2F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x3F, 0x01,
-    0xF0, 0x2F, 0x00, 0x3D, 0x0F, 0x40, 0x0F, 0x87, 0xC0, 0x03, 0xD2, 0xE0, 0x00, 0xF4, 0xF4, 0x00,
-    0x3C, 0x3D, 0x00, 0x2E, 0x0F, 0x80, 0x0F, 0x02, 0xF0, 0x0F, 0x80, 0x7F, 0xAF, 0x80, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0C, 0x00, 0x00, 0x3E,
-    0x6E, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFE, 0x56, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80,
-    0xFC, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x03,
-    0xDB, 0xC0, 0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00,
-    0x0F, 0x8F, 0x80, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x02, 0xF0, 0x0F, 0xD0,
-    0x07, 0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x80, 0x03, 0xD1, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x02, 0xFF, 0xF8, 0x03, 0xF0, 0x1F,
-    0x02, 0xF0, 0x03, 0xD0, 0xF4, 0x00, 0xF8, 0x7C, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0x4F, 0x40, 0x03,
-    0xC3, 0xD0, 0x02, 0xE0, 0xF8, 0x00, 0xF0, 0x2F, 0x00, 0xF8, 0x07, 0xFA, 0xF8, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x1C, 0x00, 0x00,
-    0x7F, 0x0B, 0xE0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x00, 0xD0, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xE5,
-    0x6F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x00, 0x1F, 0x43,
-    0xE0, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00,
-    0x1F, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0xFC,
-    0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0xFF, 0xAF, 0xF0,
-    0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
-    0x2C, 0x00, 0x0F, 0xC7, 0xD0, 0x02, 0xF0, 0xF8, 0x00, 0x3D, 0x2E, 0x00, 0x0B, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0x80, 0x0F, 0xC0, 0x7C,
-    0x02, 0xF0, 0x03, 0xD0, 0x3D, 0x00, 0x3E, 0x07, 0xC0, 0x03, 0xD0, 0xB8, 0x00, 0x3D, 0x0F, 0x40,
-    0x03, 0xC0, 0xF4, 0x00, 0xB8, 0x0F, 0x80, 0x0F, 0x00, 0xBC, 0x03, 0xE0, 0x07, 0xFA, 0xF8, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x54, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFA, 0x5B, 0xEA, 0xAF, 0x80, 0xBE, 0x00, 0x1F, 0x00, 0x1D, 0x0B, 0xD0,
-    0x00, 0xB8, 0x00, 0x70, 0x7D, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x1F,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xFA, 0xA9, 0x03, 0xE0, 0x00, 0x0B, 0xFF, 0xF4,
-    0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x06, 0x07, 0xD0, 0x00, 0xF8, 0x00, 0x38, 0x0F, 0xD0, 0x03,
-    0xD0, 0x02, 0xD0, 0x0F, 0xFA, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x7F, 0x80, 0x2F,
-    0xFF, 0x8F, 0xAF, 0x43, 0xF0, 0x1F, 0xF0, 0x2E, 0x2F, 0x00, 0x3F, 0x00, 0xF4, 0xF4, 0x00, 0xF8,
-    0x0B, 0xC7, 0xC0, 0x03, 0xD0, 0xBC, 0x2E, 0x00, 0x0F, 0xBF, 0x80, 0xF4, 0x00, 0x3F, 0xE0, 0x03,
-    0xD0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x01, 0x2F, 0x00, 0xFF, 0x40, 0xB8, 0x7F, 0xAF,
-    0xBF, 0xFF, 0xC0, 0x7F, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x01,
-    0x9F, 0x46, 0xF4, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0xB8, 0x01, 0xF0,
-    0x00, 0x3D, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x07, 0xC1, 0xFD, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0xFE, 0xF4, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x07, 0xC0,
-    0xBC, 0x00, 0x02, 0xE0, 0x0F, 0x80, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xBF, 0x90, 0x2F, 0xC1, 0xFF,
-    0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2F,
-    0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82,
-    0xF2, 0xFF, 0x2F, 0xC0, 0x79, 0xFA, 0x01, 0xEE, 0x00, 0x0B, 0xB0, 0x00, 0x3F, 0x40, 0x00, 0xF8,
-    0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x05, 0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x19, 0xF4, 0x6F, 0x40, 0x00,
-    0x7C, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x1F, 0x00, 0x03, 0xD0, 0x0F, 0x80,
-    0x00, 0xF0, 0x0B, 0xC0, 0x00, 0x7C, 0x1F, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0x40,
-    0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x2E, 0x00,
-    0xF8, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x1B, 0xF9, 0x02, 0xFC, 0x1F, 0xFF, 0x80, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x0B, 0xC0, 0xBF, 0xCB, 0xF0, 0x01, 0xE7, 0xE8, 0x00, 0x7B, 0x80, 0x00, 0x2E, 0xC0,
-    0x00, 0x0F, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x1E, 0x00, 0x00, 0xBC, 0x1F, 0x00, 0x00,
-    0x0F, 0xAF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x16, 0xA4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x67, 0xD1, 0xBD, 0x00, 0x01, 0xF0, 0x0F,
-    0xC0, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x03, 0xC0,
-    0x2F, 0x00, 0x01, 0xF0, 0x7F, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x0F,
-    0x4B, 0xC0, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0xB8, 0x03, 0xE0, 0x00,
-    0x3E, 0x00, 0x7E, 0x00, 0x6F, 0xE4, 0x0B, 0xF0, 0x7F, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x3C, 0x01, 0xE0, 0xF0, 0x00, 0xF7, 0xD0, 0x00, 0x7F, 0x40,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF0, 0xBF, 0xCB, 0xF0, 0x07,
-    0x9F, 0xA0, 0x07, 0xB8, 0x00, 0x0B, 0xB0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40,
-    0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x06, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x02, 0xFF, 0xFD, 0x02, 0xF4, 0x5F, 0x41, 0xF0, 0x02,
-    0xD0, 0xBC, 0x00, 0xB0, 0x2F, 0x00, 0x14, 0x0B, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x07, 0xD1, 0xD0, 0x00,
-    0xF4, 0xB4, 0x00, 0x7C, 0x2F, 0x00, 0x3E, 0x0B, 0xFA, 0xBF, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x0B, 0x80,
-    0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x0B, 0xFF, 0x80, 0x78, 0x09,
-    0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F,
-    0xC0, 0x80, 0x1F, 0x0B, 0x80, 0xB4, 0x2F, 0xEB, 0x80, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0xBC, 0x2E, 0x00, 0x78, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x02, 0xFF, 0xFD, 0x02, 0xF4, 0x5F, 0x41, 0xF0, 0x02, 0xD0,
-    0xBC, 0x00, 0xB0, 0x2F, 0x00, 0x14, 0x0B, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x07, 0xD1, 0xD0, 0x00, 0xF4,
-    0xB4, 0x00, 0x7C, 0x2F, 0x00, 0x3E, 0x0B, 0xFA, 0xBF, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0x7C, 0x00, 0xF4, 0x78, 0x0B,
-    0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x0B, 0xFF, 0x80, 0x78, 0x09, 0x03,
-    0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0,
-    0x80, 0x1F, 0x0B, 0x80, 0xB4, 0x2F, 0xEB, 0x80, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x94, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0x45, 0xF4, 0x1F, 0x00, 0x2D, 0x0B, 0xC0, 0x0B, 0x02, 0xF0,
-    0x01, 0x40, 0xBD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x03, 0xF0, 0x20, 0x00, 0x7D, 0x1D, 0x00, 0x0F, 0x4B, 0x40, 0x07, 0xC2, 0xF0,
-    0x03, 0xE0, 0xBF, 0xAB, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFD, 0x02, 0xFF, 0xE0, 0x78, 0x09, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x03,
-    0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x20, 0x07, 0xCB, 0x80, 0xB4, 0xBF, 0xAE,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0B, 0xF0, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x01,
-    0xF4, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x2D, 0x00, 0x3D, 0x0F, 0x80,
-    0x01, 0xF7, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
-    0x40, 0x00, 0xBF, 0xFF, 0x40, 0x2F, 0x45, 0xF4, 0x07, 0xC0, 0x0B, 0x40, 0xBC, 0x00, 0xB0, 0x0B,
-    0xC0, 0x05, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFC, 0x02, 0x00, 0x07, 0xD0, 0x74, 0x00, 0x3D, 0x0B, 0x40,
-    0x07, 0xC0, 0xBC, 0x00, 0xF8, 0x0B, 0xFA, 0xBF, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x2D, 0x00, 0xF0, 0xB8, 0x00, 0x79, 0xE0, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x02, 0xFF, 0xE0, 0x07, 0x80,
-    0x90, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0xC0, 0x20, 0x07, 0xC0, 0xB8, 0x0B, 0x40, 0xBF, 0xAE, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x55, 0x51, 0xFF, 0xFF, 0xFF, 0xEB, 0xAA, 0xFE, 0xAF, 0x7C, 0x03, 0xD0,
-    0x2C, 0xF0, 0x1F, 0x00, 0xB2, 0x40, 0xBC, 0x02, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1B, 0xF9,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x0A, 0xFF, 0xE3, 0xFF, 0xFD, 0x02,
-    0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40,
-    0x00, 0xF0, 0x18, 0x0F, 0x0B, 0x80, 0xFF, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0xBD, 0x00, 0x02, 0xD0, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xD0, 0x0B, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x0B, 0xDF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFA, 0xEA, 0xBF,
-    0xAB, 0xDF, 0x00, 0xF4, 0x0B, 0x3C, 0x07, 0xC0, 0x2C, 0x90, 0x2F, 0x00, 0x90, 0x00, 0xB8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x01, 0xE0,
-    0x00, 0x0B, 0x40, 0x00, 0x3C, 0x00, 0x38, 0xD0, 0x02, 0xD2, 0x00, 0x0F, 0x00, 0x02, 0xBF, 0xF8,
-    0x3F, 0xFF, 0xD0, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00,
-    0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x01, 0x80, 0x3C, 0x2E, 0x00, 0xFF, 0xF0, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x51, 0xFF, 0xFF, 0xFF, 0xEB, 0xAA, 0xFE, 0xAF, 0x7C,
-    0x03, 0xD0, 0x2C, 0xF0, 0x1F, 0x00, 0xB2, 0x40, 0xBC, 0x02, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x05, 0x7E, 0x50, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x1B, 0xF9, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xB4, 0x00,
-    0x0F, 0x00, 0x0A, 0xFF, 0xE3, 0xFF, 0xFD, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x0B, 0xFF,
-    0xF8, 0x6F, 0xEA, 0x40, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x18, 0x0F, 0x0B, 0x80, 0xFF, 0xF0,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x8B, 0x00, 0x00, 0x0B,
-    0xBF, 0xF0, 0x00, 0x00, 0xA0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x54, 0x00, 0x55, 0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00,
-    0x03, 0xD0, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02,
-    0xF0, 0x00, 0x0B, 0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C,
-    0x00, 0x0F, 0x80, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x30, 0x00, 0x3F, 0xEF,
-    0x00, 0x07, 0x0F, 0xE0, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x78, 0xBF, 0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xB8, 0x01, 0xE0,
-    0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x2E, 0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x80, 0x3D, 0x03,
-    0xB8, 0x03, 0xD0, 0xF7, 0x9D, 0x3F, 0xFC, 0x7F, 0xC1, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x05, 0x55, 0x7F, 0xFC, 0x01, 0xFF, 0xE1,
-    0xBD, 0x00, 0x07, 0xE0, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x0F, 0x40, 0x00,
-    0x3C, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x2F, 0x00, 0x00, 0xB4, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x3D,
-    0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x07, 0xC0, 0x00, 0x2D,
-    0x00, 0xBC, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x78, 0xBF, 0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xB8, 0x01, 0xE0, 0x0F,
-    0x40, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x2E, 0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x80, 0x3D, 0x03, 0xB8,
-    0x03, 0xD0, 0xF7, 0x9D, 0x3F, 0xFC, 0x7F, 0xC1, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00, 0x07, 0xE6, 0xE0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x55, 0x57, 0xFF,
-    0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x3C,
-    0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00, 0x0B, 0x40, 0x2E, 0x00,
-    0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x1E, 0x00,
-    0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x24, 0x00, 0x3D, 0x1B, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x06,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x78, 0xBF, 0xC0, 0x0F, 0x40,
-    0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xB8, 0x01, 0xE0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03,
-    0xC0, 0x2E, 0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x80, 0x3D, 0x03, 0xB8, 0x03, 0xD0, 0xF7, 0x9D, 0x3F,
-    0xFC, 0x7F, 0xC1, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x02, 0xC2, 0xC0, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x02, 0xC3, 0xC0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x55, 0x40, 0x05, 0x55, 0x7F, 0xFC,
-    0x01, 0xFF, 0xE1, 0xBD, 0x00, 0x07, 0xE0, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x03, 0xC0,
-    0x0F, 0x40, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x2F, 0x00, 0x00, 0xB4, 0x02, 0xE0, 0x00,
-    0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x07,
-    0xC0, 0x00, 0x2D, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1E, 0x1D, 0x00, 0x02, 0xC1, 0xD0, 0x00, 0x2C, 0x2C,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC,
-    0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0,
-    0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F,
-    0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xD0, 0x1C, 0x00, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x0F,
-    0xD0, 0xFD, 0x00, 0x00, 0xD0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x05, 0x55,
-    0x7F, 0xFC, 0x01, 0xFF, 0xE1, 0xBD, 0x00, 0x07, 0xE0, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0xF8, 0x00,
-    0x03, 0xC0, 0x0F, 0x40, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x2F, 0x00, 0x00, 0xB4, 0x02,
-    0xE0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x01,
-    0xE0, 0x07, 0xC0, 0x00, 0x2D, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x0B, 0xC3, 0xD0, 0x01, 0xF4, 0xFC, 0x00,
-    0x3D, 0x2F, 0x00, 0x07, 0x43, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07,
-    0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4,
-    0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80,
-    0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x55, 0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0,
-    0x0F, 0x80, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00,
-    0x0B, 0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07,
-    0xC0, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F,
-    0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00,
-    0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F, 0x79,
-    0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3F, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x01, 0x55, 0x4B, 0xFF, 0xC0, 0x1E, 0x00, 0x7F,
-    0xFC, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0x40, 0x0F, 0x80,
-    0x0B, 0xF0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x2E, 0xF0, 0x03,
-    0xC0, 0x00, 0xB8, 0x03, 0xCF, 0x00, 0xB4, 0x00, 0x0B, 0xC0, 0xB4, 0xF4, 0x0F, 0x00, 0x00, 0xBC,
-    0x0F, 0x0F, 0x42, 0xD0, 0x00, 0x07, 0xC2, 0xD0, 0xF4, 0x3C, 0x00, 0x00, 0x7C, 0x3C, 0x0B, 0x87,
-    0x40, 0x00, 0x07, 0xCB, 0x40, 0xB8, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x07, 0x9D, 0x00, 0x00, 0x03,
-    0xED, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x2D, 0xF4, 0x00, 0x00, 0x02, 0xE1, 0xF0, 0x00, 0x00, 0x1E, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x3C, 0x01, 0xF6, 0xFF, 0x00, 0xF8, 0x03, 0xE0,
-    0x3D, 0x02, 0xF0, 0x0F, 0x80, 0xF4, 0x0B, 0xC0, 0x3D, 0x02, 0xE0, 0x2F, 0x40, 0xF0, 0x07, 0xC0,
-    0xFD, 0x03, 0xC0, 0x0F, 0x07, 0xF8, 0x2D, 0x00, 0x3C, 0x3D, 0xE0, 0xF0, 0x00, 0xF1, 0xD3, 0xCB,
-    0x40, 0x03, 0xCF, 0x0F, 0x38, 0x00, 0x0B, 0xF0, 0x3F, 0xC0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00,
-    0xB4, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0x0B, 0x80, 0x00, 0x1E, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x40, 0x15, 0x51, 0xFF, 0xF4, 0x2F, 0xFD, 0x1F, 0xD0, 0x01, 0xF8, 0x02,
-    0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x01, 0xF0, 0x3D, 0x00,
-    0x00, 0x3E, 0x2E, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0xE8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xE0, 0x00,
-    0x01, 0xE0, 0xF0, 0x00, 0x07, 0x80, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00,
-    0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00,
-    0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25,
-    0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x41, 0xE0, 0x00,
-    0x07, 0xE0, 0xFC, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x00, 0x55, 0x47, 0xFF, 0xD0, 0xBF, 0xF4, 0x7F, 0x40, 0x07, 0xE0, 0x0B, 0xC0, 0x02,
-    0xE0, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x00, 0xF8,
-    0xB8, 0x00, 0x00, 0x2F, 0x3C, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xFA, 0xAA,
-    0xFC, 0x03, 0xC0, 0x02, 0xF0, 0x03, 0xC0, 0x07, 0xD0, 0x01, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xB0, 0x0F, 0xC0, 0x00,
-    0xF0, 0x2F, 0x00, 0x02, 0xE0, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x1C, 0x0F, 0xFF, 0x7D, 0x2D,
-    0x5F, 0xF8, 0x2C, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0,
-    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x10, 0x3F, 0x50, 0x38, 0xFF, 0xFF, 0xF8, 0xF0, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x01,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFA, 0xAA, 0xFC, 0x03, 0xC0, 0x02, 0xF0, 0x03, 0xC0, 0x07, 0xD0, 0x01,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xB0, 0x0F, 0xC0, 0x00, 0xF0, 0x2F, 0x00, 0x02, 0xE0, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x1C, 0x0F, 0xFF, 0x7D, 0x2D,
-    0x5F, 0xF8, 0x2C, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0,
-    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x10, 0x3F, 0x50, 0x38, 0xFF, 0xFF, 0xF8, 0xF0, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xB4, 0x00, 0x0F, 0x42, 0xE0, 0x00,
-    0x07, 0xDF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xFA, 0xAA, 0xFC, 0x03, 0xC0, 0x02, 0xF0, 0x03,
-    0xC0, 0x07, 0xD0, 0x01, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xB0, 0x0F, 0xC0, 0x00, 0xF0, 0x2F, 0x00, 0x02, 0xE0, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x2D, 0x00, 0xF0, 0xB8, 0x00, 0x79, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE4, 0x1C, 0x0F, 0xFF, 0x7D, 0x2D, 0x5F, 0xF8, 0x2C, 0x02, 0xE0, 0x00,
-    0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
-    0x10, 0x3F, 0x50, 0x38, 0xFF, 0xFF, 0xF8, 0xF0, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x3C, 0x09, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x02, 0xD1, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x7C, 0x03, 0xF0, 0x0F, 0x80, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x0B, 0xC1, 0xF0, 0x3C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0xD0, 0x1F,
-    0xBC, 0x0F, 0x0F, 0x0F, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4A, 0xBF, 0xEE, 0xE1, 0xFC,
-    0x00, 0x50, 0x6A, 0xA9, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0xBD, 0x1E, 0x3F, 0xFC,
-    0x0B, 0x90, 0x2D, 0x7E, 0xBD, 0x10, 0x05, 0x01, 0x43, 0xF0, 0xFC, 0x3E, 0x0F, 0x80, 0x40, 0x10,
-    0x06, 0x80, 0xFF, 0xCB, 0x0F, 0x18, 0x3C, 0x03, 0xC0, 0x7C, 0x01, 0xC0, 0x00, 0x00, 0x01, 0x90,
-    0x0F, 0xF4, 0x2C, 0x3C, 0x38, 0x2C, 0x3C, 0x38, 0x2F, 0xF0, 0x06, 0x80, 0x00, 0x00, 0x00, 0x74,
-    0x38, 0x0F, 0x8B, 0xC3, 0xF1, 0xF4, 0xBC, 0x3D, 0x0E, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1D, 0x03, 0xC7, 0x83, 0xD0, 0xF7, 0xD0, 0x1F, 0xD0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x34, 0x70,
-    0xB8, 0xB4, 0x7C, 0x78, 0x3C, 0x3C, 0x0D, 0x1C, 0x00, 0x00, 0x00, 0x10, 0x01, 0xFF, 0x81, 0xFB,
-    0xF4, 0xE0, 0x2D, 0x10, 0x02, 0x00, 0x00, 0x00, 0x2C, 0x0B, 0x41, 0xE0, 0x3D, 0x03, 0xD0, 0x3F,
-    0x01, 0x80, 0x0A, 0x07, 0xE0, 0xF8, 0x3D, 0x1F, 0x0F, 0x0B, 0x00, 0x09, 0x0F, 0xCB, 0xC2, 0xD0,
-    0x74, 0x0E, 0x01, 0xC0, 0x04, 0x2D, 0x3C, 0x3C, 0x74, 0xB0, 0x00, 0x06, 0x80, 0x7C, 0x0F, 0x81,
-    0xF0, 0x38, 0x00, 0x00, 0x2D, 0x7E, 0xBD, 0x10, 0x09, 0x02, 0x43, 0xF0, 0xFC, 0x3E, 0x0F, 0x80,
-    0x40, 0x10, 0x0A, 0x43, 0xED, 0x70, 0xEB, 0x0D, 0x3F, 0xC0, 0x50, 0x06, 0x43, 0xE0, 0xB8, 0x3C,
-    0x2D, 0x04, 0x00, 0x0A, 0x80, 0xBD, 0x02, 0xD0, 0x78, 0x2E, 0x01, 0x40, 0x01, 0x00, 0xD0, 0x3C,
-    0x07, 0x40, 0x7D, 0x43, 0xFC, 0x00, 0x00, 0x0A, 0x03, 0xC1, 0xE0, 0xB4, 0x3C, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x3F, 0xE0, 0x3E, 0x3D, 0x3D, 0x03, 0x84, 0x00, 0x00, 0x10, 0x00, 0xF0,
-    0x0A, 0xFD, 0x7C, 0x7F, 0xF4, 0x06, 0x40, 0x00, 0x00, 0x2F, 0x06, 0xBF, 0xDF, 0xF2, 0xFD, 0x50,
-    0xA4, 0x15, 0x54, 0xBF, 0xFE, 0x6A, 0xA9, 0x00, 0x10, 0x01, 0xFF, 0x81, 0xFB, 0xF4, 0xE0, 0x2D,
-    0x10, 0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0xB4, 0x00, 0x10,
-    0x02, 0x80, 0x62, 0xF4, 0xBD, 0xFC, 0x2F, 0x04, 0x01, 0x00, 0x04, 0x0F, 0x03, 0xC0, 0xF9, 0x3F,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x02, 0xF0, 0x00, 0xC0,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xA8,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x01, 0xBF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xB0, 0x2D, 0x00, 0x00, 0xBD, 0x1F, 0x80,
-    0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0xAA, 0xBC, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x0B, 0xC0,
-    0x03, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F,
-    0xAA, 0xA0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0,
-    0x06, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x55, 0x55, 0x50, 0x7F, 0xFF, 0xFF,
-    0xF8, 0xBA, 0xAF, 0xAA, 0xF4, 0xF0, 0x1F, 0x00, 0xB0, 0xE0, 0x2F, 0x00, 0xF0, 0x40, 0x3E, 0x00,
-    0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0xF4, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0xBC, 0x01, 0xF0, 0x00,
-    0x7C, 0x02, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x1B, 0xF8, 0x00, 0xF8, 0xBF, 0xFC, 0x00,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x34, 0x1F, 0x80, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xAA, 0xBE, 0x00, 0x1F, 0x00,
-    0x2E, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2C, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x7F, 0xFF,
-    0xD0, 0x0F, 0xE5, 0xBF, 0x80, 0xFC, 0x00, 0x2D, 0x0F, 0xC0, 0x00, 0xB0, 0x7C, 0x00, 0x02, 0x83,
-    0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBE, 0xAB, 0xE0, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0x80,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x06, 0x07, 0xE0, 0x00,
-    0x3C, 0x0F, 0xE0, 0x07, 0xF0, 0x0F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x94, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0x45, 0xF4, 0x1F, 0x00, 0x2D, 0x0B, 0xC0,
-    0x0B, 0x02, 0xF0, 0x01, 0x40, 0xBD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x20, 0x00, 0x7D, 0x1D, 0x00, 0x0F, 0x4B, 0x40,
-    0x07, 0xC2, 0xF0, 0x03, 0xE0, 0xBF, 0xAB, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x54, 0x03, 0xFF, 0xE0, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xB8, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00,
-    0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x2C, 0x0B, 0x00, 0x3F, 0x4B, 0xD0, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x06, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x55, 0x54,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0xBE, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x5B, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x3C, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x78, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x1F, 0xFF, 0x80, 0x00, 0x02,
-    0xC0, 0x2F, 0xAF, 0xF4, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0xFC, 0x00, 0x0B, 0x40, 0x3D, 0x00, 0x7C,
-    0x00, 0x0F, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xB8,
-    0x00, 0xB8, 0x35, 0xF4, 0x00, 0xF8, 0x02, 0xF0, 0x3F, 0xE0, 0x06, 0xFF, 0xBF, 0xC0, 0x3F, 0x40,
-    0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x05, 0x55, 0x00,
-    0x00, 0xFF, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0xFF, 0xAF, 0xF4, 0x00, 0xF8, 0x00, 0x2E, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0x3E,
-    0x00, 0x3D, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x3C, 0x02, 0xF0,
-    0x00, 0x7C, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0xB8, 0x01, 0xF4, 0x1B, 0xF8, 0x02, 0xFF, 0xBF, 0xD0,
-    0x7F, 0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x50,
-    0x7F, 0xFF, 0xFF, 0xF8, 0xBA, 0xAF, 0xAA, 0xF4, 0xF0, 0x1F, 0x00, 0xB0, 0xE0, 0x2F, 0x00, 0xF0,
-    0x40, 0x3E, 0x00, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x15, 0x00, 0x00, 0x7E, 0xFF, 0xF0,
-    0x00, 0xBF, 0xEB, 0xF8, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0xB8,
-    0x01, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0xF4, 0x03, 0xE0, 0x01, 0xF0, 0x1B, 0xF8, 0x07, 0xF9,
-    0xBF, 0xFC, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x00, 0x1A, 0x00, 0x3F, 0xFD, 0x02, 0xFD, 0x00, 0x1F, 0x80, 0x3F, 0xF0, 0x00,
-    0x7C, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0x2E, 0x00, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x0F,
-    0x00, 0x00, 0x00, 0xF4, 0xB0, 0x00, 0x00, 0x07, 0xEF, 0x80, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00,
-    0x00, 0xF8, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x0F, 0x01, 0xF4, 0x00, 0x00, 0x7C,
-    0x03, 0xF0, 0x00, 0x02, 0xF0, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x01, 0xBF, 0x90, 0x1F,
-    0xC0, 0x1F, 0xFF, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x01,
-    0x55, 0x40, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x3D, 0x00,
-    0x3D, 0xF0, 0x00, 0x03, 0xD0, 0x0F, 0x1F, 0x00, 0x00, 0x7C, 0x03, 0xC2, 0xF0, 0x00, 0x0B, 0xC1,
-    0xF0, 0x3E, 0x00, 0x00, 0xF8, 0x78, 0x03, 0xD0, 0x00, 0x0F, 0x5E, 0x00, 0x7C, 0x00, 0x00, 0xFB,
-    0x80, 0x0B, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0xB8, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x3E,
-    0x00, 0x00, 0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0x40, 0x00, 0x0F, 0x40, 0x70, 0x00, 0x00, 0xF8, 0x2E,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x50, 0x05, 0x55, 0x2F, 0xFF, 0x02, 0xFF, 0xE0, 0x7F, 0x40, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x7C,
-    0x00, 0x1F, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0xBC,
-    0x0B, 0x40, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x02, 0xEB, 0x40, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x28, 0x7C, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x00, 0x3F, 0xFD, 0x07, 0xFF, 0xC0, 0x01,
-    0xF8, 0x00, 0x7F, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x0B,
-    0x80, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x7C,
-    0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x03, 0xD0,
-    0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x1B, 0xFF, 0xFF, 0xFE, 0x40, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00,
-    0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x0F, 0x00,
-    0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x55, 0x6F, 0x40,
-    0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x03, 0xF0, 0x0B, 0xE4,
-    0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x55, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x1F, 0xAA, 0xBC, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x38, 0x00, 0x2E, 0x00, 0x10,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xBE, 0xAF, 0xE0,
-    0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xF0, 0x00, 0xF8,
-    0x02, 0xF0, 0x00, 0xF4, 0x03, 0xE0, 0x03, 0xE0, 0x1B, 0xFE, 0xBF, 0x80, 0x7F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0x9F, 0x42, 0xF8,
-    0x00, 0x1F, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF8,
-    0x00, 0x3C, 0x02, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBE, 0xBF, 0xE0, 0x00, 0xF8, 0x02, 0xF4,
-    0x00, 0xF4, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xF0, 0x00, 0xF8, 0x02, 0xE0, 0x01, 0xF4,
-    0x03, 0xD0, 0x03, 0xE0, 0x1B, 0xFA, 0xBF, 0x80, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x55, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xAA, 0xBE, 0x00, 0x1F, 0x00, 0x2E,
-    0x00, 0x2F, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2C, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xF5, 0x7F, 0x40, 0x00, 0x00, 0xB4, 0x0B, 0x80, 0x00, 0x00, 0x3C,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x40, 0x7C, 0x00, 0x00, 0x03, 0xC0,
-    0x2F, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x80, 0x00, 0x00, 0xB4, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00,
-    0xF0, 0x00, 0x00, 0x2D, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x40, 0x0F,
-    0x40, 0x00, 0x07, 0x80, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x78, 0x00, 0x00, 0x0B, 0x40, 0x1D, 0x00, 0x00, 0x02, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFA, 0xAA, 0xF0, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x0C, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x1C, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x1B, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x28, 0x00, 0x15, 0x50, 0x01, 0xA0, 0x03, 0xFD, 0x03, 0xFF, 0xC0, 0x3F,
-    0xC0, 0x0B, 0xFC, 0x01, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0xB4, 0x03, 0xC0, 0x3E, 0x00, 0x00, 0x00,
-    0xF0, 0x1F, 0x02, 0xD0, 0x00, 0x00, 0x02, 0xC0, 0xB8, 0x1E, 0x00, 0x00, 0x00, 0x03, 0x83, 0xD0,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBE, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFB, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x0B, 0x87, 0xC0, 0x00, 0x00, 0x01, 0xF4,
-    0x3D, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xC0, 0x3E,
-    0x00, 0x00, 0x0F, 0xC0, 0x2E, 0x00, 0xBC, 0x00, 0x00, 0xFD, 0x00, 0xB4, 0x00, 0xFC, 0x00, 0x1F,
-    0xD0, 0x0B, 0xF4, 0x02, 0xF8, 0x01, 0xFD, 0x00, 0xFF, 0xF0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x90, 0x00, 0xBF, 0xFF, 0x40, 0x3E, 0x57, 0xF0, 0x0F, 0x00,
-    0x3D, 0x07, 0x40, 0x0F, 0x40, 0x80, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x6B,
-    0xF4, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x08, 0x00,
-    0x0F, 0x8B, 0x40, 0x07, 0xD3, 0xF0, 0x07, 0xF0, 0x7F, 0xEF, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x54, 0x01, 0x55, 0x40, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80,
-    0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xE0,
-    0x00, 0xFF, 0x40, 0x00, 0x3D, 0x00, 0x3D, 0xF0, 0x00, 0x03, 0xD0, 0x0F, 0x1F, 0x00, 0x00, 0x7C,
-    0x03, 0xC2, 0xF0, 0x00, 0x0B, 0xC1, 0xF0, 0x3E, 0x00, 0x00, 0xF8, 0x78, 0x03, 0xD0, 0x00, 0x0F,
-    0x5E, 0x00, 0x7C, 0x00, 0x00, 0xFB, 0x80, 0x0B, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0xB8, 0x00, 0x02,
-    0xF4, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x07,
-    0xFF, 0xD0, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0D, 0x00,
-    0x00, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x15,
-    0x54, 0x00, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x00, 0x00,
-    0xFC, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x2E, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xD0, 0x03,
-    0xDF, 0x00, 0x00, 0x3D, 0x00, 0xF1, 0xF0, 0x00, 0x07, 0xC0, 0x3C, 0x2F, 0x00, 0x00, 0xBC, 0x1F,
-    0x03, 0xE0, 0x00, 0x0F, 0x87, 0x80, 0x3D, 0x00, 0x00, 0xF5, 0xE0, 0x07, 0xC0, 0x00, 0x0F, 0xB8,
-    0x00, 0xBC, 0x00, 0x01, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x40, 0x00, 0xF4, 0x00, 0x03, 0xE0,
-    0x00, 0x0F, 0x40, 0x01, 0xBF, 0x80, 0x07, 0xF9, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x55, 0x50, 0x01, 0xA0, 0x03, 0xFF, 0xD0, 0x2F, 0xD0, 0x01, 0xF8, 0x03, 0xFF, 0x00, 0x07, 0xC0,
-    0x2E, 0x00, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0xF0, 0x00,
-    0x00, 0x0F, 0x4B, 0x00, 0x00, 0x00, 0x7E, 0xF8, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x0F,
-    0x83, 0xD0, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0xF0, 0x1F, 0x40, 0x00, 0x07, 0xC0, 0x3F,
-    0x00, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x1B, 0xF9, 0x01, 0xFC, 0x01,
-    0xFF, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7E, 0x5B, 0xE0, 0x00, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x00,
-    0x3C, 0x0B, 0xC0, 0x00, 0x00, 0x78, 0x0F, 0x80, 0x00, 0x00, 0xB0, 0x0F, 0x40, 0x00, 0x00, 0xF0,
-    0x0F, 0x00, 0x00, 0x01, 0xE0, 0x1F, 0x00, 0x00, 0x02, 0xC0, 0x2F, 0x00, 0x00, 0x03, 0xC0, 0x3E,
-    0x00, 0x00, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x7C, 0x00,
-    0x00, 0x7C, 0x00, 0xBC, 0x00, 0x35, 0xF4, 0x00, 0xF8, 0x00, 0x3F, 0xE0, 0x06, 0xFE, 0x00, 0x3F,
-    0x40, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x01, 0x55, 0x00,
-    0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00,
-    0xBF, 0xC0, 0x00, 0x03, 0xEE, 0x00, 0x3D, 0xF0, 0x00, 0x01, 0xEB, 0x80, 0x2D, 0xBC, 0x00, 0x00,
-    0xB5, 0xF0, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0x7C, 0x0B, 0x0B, 0x80, 0x00, 0x1E, 0x0F, 0x03, 0x82,
-    0xE0, 0x00, 0x0B, 0x43, 0xD3, 0xC0, 0xF4, 0x00, 0x03, 0xC0, 0xF9, 0xE0, 0x3D, 0x00, 0x00, 0xF0,
-    0x2E, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x07, 0xF4, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x0A, 0x00, 0x1F, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x1F, 0xE4, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x55, 0x54, 0x01, 0x55, 0x40,
-    0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0,
-    0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x00, 0x00,
-    0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x6F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x0F, 0xC0,
-    0x00, 0x3F, 0x07, 0xC0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBC,
-    0x00, 0x00, 0x0F, 0x7E, 0x00, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8,
-    0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x7F,
-    0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0xAA, 0xBF, 0x40, 0x00, 0x7C,
-    0x00, 0x0B, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x03, 0xD0,
-    0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00,
-    0x2F, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00,
-    0xF0, 0x00, 0x1B, 0xF8, 0x01, 0xFE, 0x40, 0x1F, 0xFF, 0x42, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0xA9,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0x9F, 0x42, 0xF8, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x2F, 0x00,
-    0x3D, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x7C, 0x03,
-    0xF0, 0x00, 0xBD, 0xAF, 0x80, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xE5, 0xBF,
-    0x80, 0xFC, 0x00, 0x2D, 0x0F, 0xC0, 0x00, 0xB0, 0x7C, 0x00, 0x02, 0x83, 0xE0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0C, 0x0F, 0xF4, 0x06,
-    0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x51, 0xFF, 0xFF, 0xFF, 0xEB, 0xAA, 0xFE, 0xAF, 0x7C, 0x03, 0xD0, 0x2C, 0xF0, 0x1F, 0x00, 0xB2,
-    0x40, 0xBC, 0x02, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x05, 0x55, 0x00, 0x55, 0x52, 0xFF, 0xF0, 0x2F, 0xFE, 0x07, 0xF4, 0x00, 0x7E, 0x00, 0x2F,
-    0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x1E, 0x00, 0x00, 0xF8, 0x03, 0xC0,
-    0x00, 0x0B, 0xC0, 0xB4, 0x00, 0x00, 0x7C, 0x1E, 0x00, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x00, 0x2E,
-    0xB4, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x02, 0x87, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xF4, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0xFF, 0xBE, 0xFF, 0x00, 0x7E, 0x03,
-    0xC0, 0xFC, 0x0F, 0x40, 0x78, 0x07, 0xD2, 0xF0, 0x0B, 0x80, 0x3D, 0x3D, 0x00, 0xF4, 0x03, 0xD3,
-    0xC0, 0x0F, 0x00, 0x3D, 0x3C, 0x01, 0xF0, 0x07, 0xC3, 0xD0, 0x1E, 0x00, 0xF8, 0x3F, 0x02, 0xD0,
-    0x7E, 0x00, 0xFE, 0xBE, 0xBF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x15, 0x54,
-    0x05, 0x54, 0x00, 0xFF, 0xF8, 0x2F, 0xFD, 0x00, 0x2F, 0x80, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x0F,
-    0x80, 0x00, 0x07, 0xD0, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xCB, 0xC0, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0x3D,
-    0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x1F, 0xE4, 0x01,
-    0xFF, 0x80, 0xFF, 0xFC, 0x0B, 0xFF, 0xD0, 0x00, 0x55, 0x54, 0x05, 0x55, 0x00, 0x3F, 0xFD, 0x07,
-    0xFF, 0xC0, 0x01, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03,
-    0xD0, 0x00, 0x0B, 0x80, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x2F,
-    0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF0,
-    0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x40,
-    0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x05, 0x55, 0x1F, 0xFF, 0x03, 0xFF, 0xD0, 0xBD, 0x00,
-    0x2F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFE, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x55, 0x50, 0x15, 0x50, 0x55, 0x50, 0x03, 0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0xC0,
-    0x01, 0xF8, 0x02, 0xF4, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x07,
-    0xC0, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x02,
-    0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x3C,
-    0x00, 0x7C, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x40,
-    0x00, 0x2E, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x1B, 0xFF,
-    0xAF, 0xFA, 0xFF, 0xE4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x55, 0x50, 0x15,
-    0x50, 0x55, 0x50, 0x03, 0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0xC0, 0x01, 0xF8, 0x02, 0xF4, 0x03, 0xF4,
-    0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8,
-    0x00, 0xF4, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x1F, 0x00,
-    0x2E, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x00,
-    0x0F, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x01,
-    0xF0, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x3D,
-    0x00, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x1B, 0xFF, 0xAF, 0xFA, 0xFF, 0xE8, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x54, 0x01, 0xFF, 0xFF, 0xE0, 0x0B, 0xAA, 0xF8, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0xF0, 0x1F, 0x00,
-    0x02, 0x40, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x40,
-    0x02, 0xFA, 0xFF, 0x80, 0x0B, 0x80, 0x2F, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0xF4, 0x07,
-    0xC0, 0x03, 0xD0, 0x2F, 0x00, 0x1F, 0x00, 0xF8, 0x01, 0xF4, 0x1B, 0xFE, 0xFF, 0x41, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x05, 0x55, 0x00, 0x3F, 0xFE, 0x00,
-    0x0B, 0xFF, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0x40, 0x00, 0x2F,
-    0xAF, 0xF4, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x3F, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0xBC,
-    0x00, 0x00, 0xF0, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x2F, 0x00,
-    0x2F, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x01, 0xF0, 0x00, 0x1B, 0xFE, 0xFF, 0x42, 0xFE, 0x40,
-    0x1F, 0xFF, 0xF9, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x02,
-    0xFA, 0xBF, 0x80, 0x0F, 0x80, 0x2F, 0x40, 0x3D, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0xB8, 0x07, 0xC0,
-    0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0xF8, 0x1B, 0xFE, 0xBF, 0x81, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xA4, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x3E, 0x96, 0xFC,
-    0x00, 0xF0, 0x01, 0xF8, 0x07, 0x80, 0x02, 0xF0, 0x0C, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x2A, 0xAA, 0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x80, 0x00, 0x3E, 0x0B, 0x40, 0x03, 0xF0, 0x3F, 0x00, 0x7F,
-    0x40, 0x7F, 0xEF, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54,
-    0x00, 0x1A, 0x40, 0x00, 0x0F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0x80, 0x1F, 0xD6, 0xFE,
-    0x00, 0x01, 0xF0, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x02, 0xE0,
-    0x2E, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x03, 0xC0, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x7C, 0x00, 0x00,
-    0x7C, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x07, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0xF8,
-    0x0F, 0x40, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0xF0, 0x0F, 0x80, 0x00,
-    0x1F, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0xB8, 0x00, 0x3E,
-    0x00, 0x3F, 0x40, 0x3F, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0xBF, 0x80, 0x07, 0xFF, 0xD0, 0x07, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xEA, 0xF4, 0x00, 0x02, 0xF4, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x2E,
-    0x00, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00,
-    0x0F, 0xD0, 0xB8, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0xF0,
-    0x3C, 0x00, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x7C, 0x0B, 0x80, 0x00, 0x07, 0xC0, 0x3D, 0x00,
-    0x00, 0xBD, 0x00, 0xF0, 0x00, 0x7F, 0xE0, 0x1B, 0xE4, 0x00, 0xFD, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE1, 0xD0, 0x2F, 0xFF, 0xF0, 0x1F, 0x42,
-    0xF8, 0x0F, 0x00, 0x3D, 0x0F, 0x80, 0x0F, 0x03, 0xC0, 0x07, 0xC1, 0xE0, 0x02, 0xE0, 0xB4, 0x01,
-    0xF4, 0x3D, 0x00, 0xFC, 0x0F, 0x40, 0xBF, 0x07, 0xF0, 0xB3, 0xCF, 0xBF, 0xF4, 0xFF, 0x0F, 0xF0,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xFF, 0xC0,
-    0x01, 0xFF, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x0F, 0x2F, 0xF0, 0x02, 0xFF, 0xAF, 0xC0, 0x3F, 0x80, 0x7C, 0x03, 0xE0, 0x03, 0xD0, 0x7C,
-    0x00, 0x3D, 0x0B, 0xC0, 0x03, 0xD0, 0xB8, 0x00, 0x3C, 0x0B, 0x80, 0x0B, 0xC0, 0xB8, 0x00, 0xF4,
-    0x07, 0xC0, 0x3E, 0x00, 0x3F, 0xAF, 0x80, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xAF, 0x82, 0xE0, 0x2E, 0x1E, 0x00, 0xB8, 0xF0, 0x07, 0xC7,
-    0xC1, 0xFC, 0x2F, 0xFF, 0xF8, 0xF8, 0x01, 0xF7, 0xD0, 0x03, 0xDF, 0x40, 0x0F, 0x3E, 0x00, 0xF8,
-    0x7E, 0x6F, 0x80, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0xBF,
-    0xFE, 0x03, 0x80, 0x7C, 0x04, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0B,
-    0xD0, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x05, 0x0F, 0x40, 0x78, 0x3F, 0xEF, 0xC0, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0xFF, 0xD0, 0x0B, 0x97, 0xF4, 0x04, 0x00, 0xBC, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2E, 0x00, 0x2A, 0xAE, 0x02, 0xFF, 0xFE, 0x0B, 0x80,
-    0x7E, 0x2F, 0x00, 0x2E, 0x3C, 0x00, 0x3D, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3C, 0xF4, 0x00, 0xB8,
-    0xF4, 0x00, 0xF0, 0xF8, 0x01, 0xE0, 0xBC, 0x07, 0xC0, 0x7F, 0xAF, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x2E, 0xBF, 0x02, 0xD0, 0x7C, 0x1E, 0x01, 0xF0,
-    0xF0, 0x0F, 0x47, 0x82, 0xF4, 0x2E, 0xBF, 0x00, 0xFF, 0x90, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x04,
-    0x3F, 0x01, 0xF0, 0x7F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x1C, 0x00, 0xBE, 0x07, 0xFF, 0x03, 0xC0, 0x3F, 0xF0, 0xE0, 0xF0, 0x7C,
-    0x0F, 0x45, 0x08, 0x0B, 0x0F, 0x82, 0xC0, 0x00, 0x00, 0xB6, 0xF4, 0xB8, 0x00, 0x00, 0x0B, 0xBB,
-    0x1F, 0x00, 0x00, 0x00, 0xBC, 0xF3, 0xE0, 0x00, 0x00, 0x0F, 0x4E, 0xDE, 0x00, 0x00, 0x01, 0xE1,
-    0xF9, 0xE0, 0x00, 0x00, 0x38, 0x2F, 0x1E, 0x00, 0x44, 0x0F, 0x03, 0xD0, 0xF0, 0x78, 0xFF, 0xC0,
-    0x3C, 0x0F, 0xFF, 0x0B, 0xF0, 0x07, 0x40, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xBF, 0x03, 0x80, 0x3D, 0x04, 0x00, 0xF0, 0x00, 0x07, 0x80,
-    0x05, 0xB8, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xC2, 0x00, 0x2F, 0x3C, 0x01, 0xF4,
-    0xFE, 0xAF, 0x80, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00, 0xF4,
-    0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x00,
-    0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F, 0x79, 0xD3,
-    0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x80,
-    0x28, 0x00, 0x7C, 0x07, 0x40, 0x07, 0xD6, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x78, 0xBF, 0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F,
-    0x00, 0xB8, 0x01, 0xE0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x2E, 0x00, 0xBC, 0x03, 0xD0,
-    0x1F, 0x80, 0x3D, 0x03, 0xB8, 0x03, 0xD0, 0xF7, 0x9D, 0x3F, 0xFC, 0x7F, 0xC1, 0xFE, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x0B, 0xCB, 0xFC, 0x0F, 0xF0, 0x1E, 0x0F,
-    0x58, 0x0B, 0x4F, 0x00, 0x03, 0xCB, 0x00, 0x00, 0xF7, 0x40, 0x00, 0x3B, 0xD0, 0x00, 0x1F, 0x7C,
-    0x00, 0x0B, 0x8F, 0x40, 0x03, 0xC1, 0xF0, 0x10, 0xF0, 0x3D, 0x38, 0x7C, 0x0B, 0xFC, 0x2D, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x07, 0x42, 0xE0, 0x00, 0x0B, 0x03, 0xD0, 0x00, 0x0E, 0x03,
-    0xC0, 0x00, 0x1D, 0x03, 0xC0, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x38, 0x0B, 0x80, 0x00, 0xB4, 0x0F,
-    0x44, 0x25, 0xF0, 0x0F, 0x2C, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F, 0x40, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x1F, 0x80, 0x3F, 0xF4, 0x01, 0xFD, 0x00,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x37, 0xC0, 0x77, 0x80, 0x00, 0xDB, 0x43, 0x9D, 0x00, 0x07, 0x1D,
-    0x2C, 0xB4, 0x00, 0x2C, 0x78, 0xD3, 0xC0, 0x00, 0xE0, 0xEB, 0x0F, 0x00, 0x03, 0x43, 0xF4, 0x3C,
-    0x00, 0x1C, 0x0F, 0xC1, 0xE0, 0x54, 0xE0, 0x3D, 0x07, 0x9E, 0xFF, 0x40, 0xF0, 0x1F, 0xF2, 0xF4,
-    0x02, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x4B, 0xFC, 0x00, 0xF4,
-    0x07, 0xC0, 0x0F, 0x00, 0xB8, 0x00, 0xF0, 0x0F, 0x40, 0x1F, 0x00, 0xF5, 0x56, 0xE0, 0x0F, 0xFF,
-    0xFD, 0x01, 0xF5, 0x57, 0xC0, 0x2E, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x80, 0x3C, 0x00, 0xB9, 0xD7,
-    0xC0, 0x0F, 0xF8, 0xB8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0,
-    0x02, 0xFF, 0xF8, 0x0F, 0xC0, 0x7C, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0x3E, 0x7C, 0x00, 0x3D, 0xB8,
-    0x00, 0x3D, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0xB8, 0xF8, 0x00, 0xF0, 0xBC, 0x03, 0xE0, 0x7F, 0xAF,
-    0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x0B, 0xE0, 0xBF, 0xC3,
-    0xFF, 0x00, 0x78, 0xF4, 0xF4, 0x0B, 0xBC, 0x0F, 0x00, 0xFF, 0x01, 0xF0, 0x0F, 0xD0, 0x2E, 0x00,
-    0xF8, 0x03, 0xD0, 0x1F, 0x00, 0x3C, 0x02, 0xE0, 0x07, 0xC0, 0x3D, 0x00, 0xB8, 0x43, 0xC0, 0x0F,
-    0x5D, 0x7C, 0x00, 0xFF, 0x8B, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBE, 0x07, 0xF0, 0x02, 0xFE, 0x2F, 0xFC, 0x00, 0x1E, 0x78, 0xBC, 0x00, 0x2E, 0xD0, 0x3D,
-    0x00, 0x3F, 0x80, 0x3C, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xB8,
-    0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF4, 0x02, 0xE0, 0x00, 0xF4, 0x07, 0xC0, 0x01, 0xFF, 0xBF, 0x00,
-    0x02, 0xEF, 0xF8, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x2A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x02, 0xFF, 0xD0, 0xB8, 0x18, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00,
-    0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x4B, 0xC0, 0x78, 0x7F, 0xFF, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x2F, 0x40, 0xBE, 0x0B, 0xFC, 0x3F, 0xF0,
-    0xFF, 0xC0, 0x1E, 0x3D, 0x7C, 0xF5, 0xF0, 0x0B, 0xBC, 0x1E, 0xF0, 0x3C, 0x03, 0xFC, 0x0B, 0xF0,
-    0x1F, 0x00, 0xFD, 0x03, 0xF4, 0x0B, 0x80, 0x3E, 0x00, 0xFC, 0x03, 0xD0, 0x1F, 0x00, 0x3D, 0x00,
-    0xF0, 0x0B, 0x80, 0x1F, 0x00, 0x78, 0x03, 0xD0, 0x0B, 0x40, 0x2D, 0x10, 0xF0, 0x03, 0xC0, 0x0F,
-    0x6D, 0x7C, 0x00, 0xF0, 0x03, 0xFE, 0x2E, 0x00, 0x78, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-    0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x02, 0xD0,
-    0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00, 0xEB,
-    0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2E, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2E, 0xBC, 0x00, 0x00, 0x78,
-    0x04, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1B, 0xFE,
-    0x40, 0x01, 0xFF, 0xFF, 0xE0, 0x0B, 0xD3, 0xD1, 0xF8, 0x2F, 0x03, 0xC0, 0xBC, 0x3C, 0x03, 0xC0,
-    0x3C, 0xB8, 0x03, 0xC0, 0x3C, 0xF4, 0x07, 0x80, 0x3C, 0xF4, 0x0B, 0x40, 0x7C, 0xF4, 0x0B, 0x40,
-    0xB8, 0xB8, 0x0F, 0x01, 0xF0, 0x7D, 0x0F, 0x0B, 0xC0, 0x2F, 0xEF, 0xFF, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x60, 0xB4, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00,
-    0xFC, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0x3E, 0x0F, 0x44, 0x00, 0x1F, 0x2D, 0x00, 0x00, 0x0F, 0xB8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1E, 0xF0,
-    0x00, 0x00, 0x78, 0xF4, 0x00, 0x10, 0xF0, 0xBC, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0x40, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00,
-    0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B,
-    0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x89, 0x3D, 0x0F, 0x7A, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F,
-    0xE0, 0x3A, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x01, 0x90, 0x6F, 0x80, 0x0B, 0x3F, 0xE0, 0x07, 0xC0, 0xB8, 0x02, 0xE0, 0x2D, 0x00,
-    0xF4, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x3F, 0x00, 0xFD, 0xBF, 0x80, 0x1F, 0xFB, 0xD0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x3C, 0x10, 0x00, 0x1F, 0x3C, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x0B, 0x00, 0xB4, 0xBF, 0xC0, 0x2F, 0x00, 0xF4, 0x03, 0xC0, 0x3E, 0x01,
-    0xF0, 0x07, 0xC0, 0x3C, 0x02, 0xE0, 0x0B, 0x80, 0x3C, 0x02, 0xD0, 0x0F, 0x00, 0x78, 0x03, 0xC0,
-    0x1F, 0x00, 0xF4, 0x07, 0xC0, 0x2E, 0x01, 0xF0, 0x0F, 0x80, 0x3D, 0x03, 0xF0, 0x1F, 0x80, 0x3C,
-    0x0B, 0xE0, 0x3B, 0x44, 0x3C, 0x2D, 0xF0, 0xEB, 0x5C, 0x3F, 0xF5, 0xFF, 0xCB, 0xF8, 0x2F, 0xC0,
-    0xFE, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0x00, 0xB4, 0xBF, 0xC0, 0x2F,
-    0x00, 0xF4, 0x03, 0xC0, 0x3E, 0x01, 0xF0, 0x07, 0xC0, 0x3C, 0x02, 0xE0, 0x0B, 0x80, 0x3C, 0x02,
-    0xD0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1F, 0x00, 0xF4, 0x07, 0xC0, 0x2E, 0x01, 0xF0, 0x0F, 0x80,
-    0x3D, 0x03, 0xF0, 0x1F, 0x80, 0x3C, 0x0B, 0xE0, 0x3B, 0x48, 0x3C, 0x2D, 0xF0, 0xEB, 0x6C, 0x3F,
-    0xF5, 0xFF, 0xCB, 0xFC, 0x2F, 0xC0, 0xFE, 0x07, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x42, 0xFF, 0xFF, 0xD0, 0xE0, 0x07, 0x80, 0x3C,
-    0x0B, 0x40, 0x05, 0x0B, 0x40, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xEA, 0xFC, 0x01, 0xD0, 0x0F, 0x00,
-    0xF4, 0x03, 0xD0, 0x3C, 0x00, 0xF0, 0x0F, 0x40, 0xB8, 0x01, 0xF5, 0xBC, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x03, 0x83, 0xFE, 0x00, 0x00, 0x78, 0x02, 0xD0, 0x00, 0x0B,
-    0x80, 0x3C, 0x00, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x7F, 0xFE, 0x01, 0xF0, 0x0B, 0xEA,
-    0xF8, 0x2E, 0x00, 0xF0, 0x0B, 0xC3, 0xD0, 0x0F, 0x00, 0x7C, 0x3C, 0x00, 0xF0, 0x0B, 0x83, 0xC1,
-    0x0F, 0x00, 0xF0, 0x7C, 0xE0, 0xF9, 0xBD, 0x0B, 0xFC, 0x03, 0xFF, 0x40, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
-    0x2F, 0xFF, 0x80, 0xFE, 0x6F, 0x83, 0xC0, 0x1F, 0x1F, 0x00, 0x3C, 0x78, 0x01, 0xF1, 0xF0, 0x0F,
-    0x43, 0xE6, 0xF8, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x7F,
-    0xFF, 0x03, 0xC0, 0x3E, 0x08, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x05, 0x5B, 0xC0, 0x3F, 0xFF, 0x00,
-    0x50, 0xB8, 0x00, 0x03, 0xD2, 0x00, 0x1F, 0x2D, 0x00, 0xF4, 0xBE, 0x6F, 0x80, 0xBF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x2F, 0xE0, 0xBF, 0xC0, 0x2F, 0xFF,
-    0x80, 0x7C, 0x0B, 0xD0, 0x7C, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0xF4, 0x3E, 0x00, 0x3E, 0x0F, 0x47,
-    0xC0, 0x03, 0xD1, 0xFF, 0xFC, 0x00, 0x3D, 0x1F, 0x5F, 0x80, 0x03, 0xC2, 0xD0, 0xF8, 0x00, 0xB8,
-    0x3D, 0x0B, 0x80, 0x0F, 0x03, 0xC0, 0xBC, 0x03, 0xD0, 0x7C, 0x03, 0xFA, 0xF8, 0x0B, 0x80, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x02, 0xFE, 0xFC, 0x00, 0xB8,
-    0x07, 0x80, 0x0F, 0x00, 0xB4, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x40, 0xF0, 0x00, 0xBF, 0xFF, 0x00,
-    0x01, 0xFB, 0xE0, 0x00, 0x3C, 0x3D, 0x00, 0x0B, 0x83, 0xC1, 0x11, 0xF0, 0x3C, 0xE3, 0xFD, 0x07,
-    0xFC, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0x40,
-    0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xC0, 0x0B, 0xAF, 0xC0, 0xB4, 0x1F, 0x07, 0x80, 0x7C, 0x3C, 0x03, 0xD1, 0xE0, 0xBD, 0x0B, 0xAF,
-    0xC0, 0x3F, 0xE4, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x01, 0x0F, 0xC0, 0x7C, 0x1F, 0xFF, 0xD0, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x02, 0xF4, 0xBD, 0x02, 0xF0, 0xBC, 0x00, 0x40,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0,
-    0x1E, 0x01, 0xF0, 0x3C, 0x03, 0xD0, 0x78, 0x2F, 0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x40, 0xFC, 0x07, 0xC0, 0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x6B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x0A, 0xFE,
-    0xBC, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xD0, 0xBD, 0x00, 0xF1,
-    0xFF, 0xC0, 0x3D, 0xF5, 0xF4, 0x1F, 0xE0, 0x3E, 0x0B, 0xF0, 0x0F, 0x82, 0xF0, 0x03, 0xD0, 0xF8,
-    0x00, 0xF4, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x1F, 0x0B, 0x80, 0x0B, 0xC3, 0xD0, 0x03, 0xE0, 0xF0,
-    0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x1C, 0x1F, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x1F, 0x00, 0x00,
-    0xF4, 0x00, 0x0F, 0x40, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x2F,
-    0xFF, 0x80, 0xD0, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x02,
-    0xF0, 0x00, 0x2F, 0x00, 0x00, 0xF0, 0x01, 0x43, 0xD0, 0x1E, 0x0F, 0xFB, 0xF0, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x2F, 0xFF, 0x02, 0xE0, 0x28, 0x1E, 0x00,
-    0x00, 0xF0, 0x00, 0x07, 0xD5, 0x90, 0x2F, 0xFF, 0x80, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80,
-    0x04, 0x3F, 0x01, 0xF0, 0x7F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFD, 0x02, 0xFF, 0xE0, 0x78, 0x09, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF4, 0x00, 0x1F,
-    0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x20, 0x07, 0xCB, 0x80, 0xB4, 0xBF, 0xAE, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x7F, 0xC0, 0x0F, 0x00, 0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xF0, 0x0F, 0x40, 0x3C,
-    0x11, 0xF3, 0xCB, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0x05, 0x01, 0x42, 0xF4, 0xBD, 0x2F, 0x0B, 0xC0,
-    0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x7C,
-    0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x03, 0xC1, 0x00,
-    0x7C, 0xF0, 0x0B, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x03, 0xD0, 0x00, 0xE6, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xF0,
-    0x78, 0x00, 0x00, 0x07, 0x42, 0xD0, 0x00, 0x00, 0x2C, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x3E, 0xA8,
-    0x00, 0x07, 0x41, 0xFF, 0xFC, 0x00, 0x3C, 0x0B, 0x40, 0xF4, 0x00, 0xE0, 0x3C, 0x02, 0xE0, 0x0B,
-    0x40, 0xF0, 0x0B, 0x49, 0x7C, 0x03, 0xD0, 0x3C, 0x3F, 0xD0, 0x0B, 0xD7, 0xD0, 0xFD, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x1C, 0x00, 0xBF, 0xC0, 0x3D, 0x00, 0x07,
-    0xC0, 0x3C, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x0F, 0x40, 0x78, 0x00, 0x0F, 0x55, 0xBA, 0xA4, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x1F, 0x55, 0xF0, 0x2F, 0x2E, 0x01, 0xF0, 0x0F, 0x3D, 0x01, 0xE0, 0x1F, 0x3C,
-    0x01, 0xF0, 0x2D, 0x7C, 0x00, 0xF9, 0xBC, 0xB8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x6B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0A, 0xFE,
-    0xBC, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x02, 0xD0, 0x7F,
-    0x00, 0x0F, 0x0B, 0xFE, 0x00, 0x3C, 0xF4, 0xB8, 0x01, 0xEB, 0x03, 0xD0, 0x0B, 0xF4, 0x0F, 0x00,
-    0x2F, 0x80, 0x3C, 0x00, 0xFC, 0x02, 0xE0, 0x03, 0xD0, 0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x10, 0xB8,
-    0x01, 0xF3, 0xC3, 0xD0, 0x07, 0xFD, 0x0F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x2F, 0x2F, 0xF0, 0x3F, 0xC0, 0x78,
-    0x3D, 0x60, 0x2D, 0x3C, 0x00, 0x0F, 0x2C, 0x00, 0x03, 0xDD, 0x00, 0x00, 0xEF, 0x40, 0x00, 0x7D,
-    0xF0, 0x00, 0x2E, 0x3D, 0x00, 0x0F, 0x07, 0xC0, 0x43, 0xC0, 0xF4, 0xE1, 0xF0, 0x2F, 0xF0, 0xB4,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0,
-    0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01,
-    0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0xC0, 0x1C, 0x00, 0x03, 0xC0, 0x38, 0x00,
-    0x03, 0xE5, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00,
-    0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00,
-    0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25,
-    0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC,
-    0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0,
-    0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F,
-    0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE2, 0x3E, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x2A, 0xA8, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0xFE, 0xFE, 0xBF,
-    0x83, 0x81, 0xF0, 0x1D, 0x0D, 0x0B, 0x80, 0xB0, 0x10, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x07, 0xFF, 0xA0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xB8, 0x02, 0xF4, 0x03, 0xE0, 0x03, 0xF0, 0x0F,
-    0x40, 0x0B, 0xC0, 0x7C, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0xF4, 0x0B, 0x80, 0x0F, 0x81, 0xBF, 0xEB,
-    0xF8, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x2F,
-    0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x1E, 0x38, 0xB8, 0x00, 0x0B, 0xB8, 0x2D, 0x00, 0x03, 0xFC,
-    0x0F, 0x00, 0x00, 0xFC, 0x03, 0xEA, 0x80, 0x3E, 0x01, 0xFF, 0xFC, 0x1F, 0x00, 0xB4, 0x0F, 0x4B,
-    0x80, 0x3D, 0x02, 0xE3, 0xD0, 0x0F, 0x00, 0xB4, 0xF0, 0x03, 0xD0, 0x3C, 0x7C, 0x00, 0xBD, 0x7D,
-    0x2E, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x0F, 0xE5, 0x6F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x2F, 0x07, 0xC0,
-    0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBE, 0xAA, 0xAA, 0xAF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x7C,
-    0x3F, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x0F, 0xFA, 0xFE,
-    0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0,
-    0x02, 0xFE, 0xFC, 0x0B, 0xC0, 0x3D, 0x1F, 0x00, 0x2E, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x2E, 0xBF,
-    0xFF, 0xFE, 0xF4, 0x00, 0x3D, 0xF0, 0x00, 0x7C, 0xF4, 0x00, 0xF4, 0xB8, 0x02, 0xF0, 0x3F, 0xAF,
-    0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x06, 0x8F, 0xFF, 0xC0, 0x03, 0xFC,
-    0x2F, 0x90, 0x00, 0xBF, 0xC0, 0xF8, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0xBC, 0x00,
-    0x7C, 0x00, 0x0B, 0xC0, 0x0F, 0x00, 0x00, 0x7C, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x00,
-    0x3D, 0x07, 0x80, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0x3D, 0x0E, 0x00, 0x00, 0x02, 0xE2, 0xC0,
-    0x00, 0x00, 0x1E, 0x38, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0x00, 0x03, 0xEB, 0xFC, 0x00, 0x3F, 0xC0, 0xF4, 0x03, 0xE5, 0x03, 0xD0, 0x2E, 0x00,
-    0x0F, 0x40, 0xE0, 0x00, 0x2D, 0x0F, 0x00, 0x00, 0xB4, 0x74, 0x00, 0x02, 0xD3, 0x80, 0x00, 0x0B,
-    0x6C, 0x00, 0x00, 0x2E, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0D,
-    0x00, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x15, 0x54, 0x00, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x00,
-    0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x2E, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xD0,
-    0x03, 0xDF, 0x00, 0x00, 0x3D, 0x00, 0xF1, 0xF0, 0x00, 0x07, 0xC0, 0x3C, 0x2F, 0x00, 0x00, 0xBC,
-    0x1F, 0x03, 0xE0, 0x00, 0x0F, 0x87, 0x80, 0x3D, 0x00, 0x00, 0xF5, 0xE0, 0x07, 0xC0, 0x00, 0x0F,
-    0xB8, 0x00, 0xBC, 0x00, 0x01, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x40, 0x00, 0xF4, 0x00, 0x03,
-    0xE0, 0x00, 0x0F, 0x40, 0x01, 0xBF, 0x80, 0x07, 0xFE, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x80, 0x28, 0x00, 0x7C, 0x07, 0x40, 0x07, 0xD6, 0xE0, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x78, 0xBF, 0xC0, 0x0F,
-    0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xB8, 0x01, 0xE0, 0x0F, 0x00, 0x3D, 0x00, 0xF0,
-    0x03, 0xC0, 0x1E, 0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x80, 0x3D, 0x03, 0xB8, 0x53, 0xD0, 0xF7, 0x9E,
-    0x3F, 0xFC, 0x7F, 0xD1, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x55, 0x54, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xBF, 0xA8, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xFA, 0xBF, 0x80, 0x0F,
-    0x80, 0x2F, 0x40, 0x3D, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x03, 0xE0, 0x2F, 0x00,
-    0x0F, 0x40, 0xF8, 0x00, 0xF8, 0x1B, 0xFE, 0xBF, 0x81, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xB0, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x00, 0xFF,
-    0xF8, 0x06, 0xFE, 0x90, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xFB, 0xFC, 0x0B,
-    0xEA, 0xFC, 0x3D, 0x00, 0xF0, 0xF0, 0x03, 0xD3, 0xC0, 0x0F, 0x0F, 0x00, 0xB8, 0x2F, 0x5F, 0xC0,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0x9F,
-    0x42, 0xF8, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x2E, 0x00, 0x3C, 0x00, 0x3D,
-    0x10, 0x7C, 0x00, 0x3C, 0x38, 0xF8, 0x00, 0x7C, 0x2F, 0xF0, 0x00, 0xBD, 0xBF, 0x80, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0xF4, 0x03, 0x80, 0x00, 0xF0, 0x02, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBE, 0x07, 0xF0, 0x02, 0xFE, 0x2F, 0xFC, 0x00, 0x1E, 0x78, 0xBC, 0x00, 0x2E,
-    0xD0, 0x3D, 0x00, 0x3F, 0x80, 0x3D, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x7C,
-    0x00, 0xB8, 0x00, 0xB8, 0xB0, 0xF4, 0x00, 0xF4, 0x76, 0xE0, 0x00, 0xF4, 0x3F, 0xC0, 0x01, 0xFF,
-    0xBF, 0x00, 0x02, 0xEF, 0xFF, 0x00, 0x02, 0xD0, 0x0B, 0x00, 0x03, 0xC0, 0x03, 0x40, 0x03, 0xC0,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x2A, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xB4, 0x01, 0x55, 0x55, 0x7C, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xEA, 0xAA, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x6F,
-    0xE4, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3C, 0x02, 0xBF, 0xFD, 0x01, 0xFF, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2D, 0x00, 0x02, 0xEF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xAA, 0xBE, 0x00,
-    0x1F, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2C, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x05, 0xBD, 0x54, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x00, 0xBF, 0xFE, 0x03, 0x80, 0x7C, 0x04, 0x01, 0xF0, 0x08, 0x0F, 0x40, 0x3E, 0xF4, 0x00, 0x7F,
-    0x00, 0x0B, 0xEE, 0x00, 0xBC, 0x14, 0x03, 0xD0, 0x05, 0x0F, 0x40, 0x78, 0x3F, 0xEF, 0xC0, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xAA,
-    0xBC, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x38, 0x00, 0x2E, 0x00, 0x10, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xF8, 0x01,
-    0xFC, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0xF0, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x7C, 0x02, 0xF0, 0x00,
-    0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x1B, 0xF8, 0x00, 0xB8, 0x7F, 0xFD, 0x00, 0xF4, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x24, 0x1F, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x07, 0xC0, 0xB0, 0x0B, 0x80,
-    0x60, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x6F, 0xE0, 0x1F, 0xFF, 0xF8, 0x2F, 0x40, 0xFC,
-    0x3D, 0x00, 0x3D, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x3D, 0x78, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xB8, 0x00, 0x01, 0xF0, 0x0A, 0x07, 0xD0, 0x0F, 0xFF, 0x40, 0x07, 0xE4, 0x00, 0x00, 0x28,
-    0x00, 0x15, 0x50, 0x01, 0xA0, 0x03, 0xFD, 0x03, 0xFF, 0xC0, 0x3F, 0xC0, 0x0B, 0xFC, 0x01, 0xF4,
-    0x03, 0xFF, 0x00, 0x00, 0xB4, 0x03, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x02, 0xD0, 0x00,
-    0x00, 0x02, 0xC0, 0xB8, 0x1E, 0x00, 0x00, 0x00, 0x03, 0x83, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBE, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xFB, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x0B, 0x87, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x3D, 0x0F, 0x80, 0x00, 0x00,
-    0x1F, 0x80, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xC0, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x2E,
-    0x00, 0xBC, 0x00, 0x00, 0xFD, 0x00, 0xB4, 0x00, 0xFC, 0x00, 0x1F, 0xD0, 0x0B, 0xF4, 0x02, 0xFC,
-    0x01, 0xFD, 0x00, 0xFF, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1C, 0x00, 0xBE, 0x07, 0xFF, 0x03, 0xC0, 0x3F,
-    0xF0, 0xE0, 0xF0, 0x7C, 0x0F, 0x45, 0x08, 0x0B, 0x0F, 0x82, 0xC0, 0x00, 0x00, 0xB6, 0xF4, 0xB8,
-    0x00, 0x00, 0x0B, 0xBB, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0xF3, 0xE0, 0x00, 0x00, 0x0F, 0x4E, 0xDE,
-    0x00, 0x00, 0x01, 0xE1, 0xF9, 0xE0, 0x00, 0x00, 0x38, 0x2F, 0x1E, 0x01, 0x84, 0x0F, 0x03, 0xD0,
-    0xF0, 0x78, 0xFF, 0xC0, 0x3C, 0x0F, 0xFF, 0x4B, 0xF0, 0x07, 0x40, 0x7F, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x16, 0x90, 0x00, 0xBF, 0xFF, 0x40,
-    0x3E, 0x57, 0xF0, 0x0F, 0x00, 0x3D, 0x07, 0x40, 0x0F, 0x40, 0x80, 0x03, 0xC0, 0x00, 0x01, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x6B, 0xF4, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x08, 0x00, 0x0F, 0x8B, 0x40, 0x07, 0xD3, 0xF0, 0x07, 0xF0, 0x7F, 0xEF, 0xF0,
-    0x07, 0xFF, 0xD0, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x2C, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xBF, 0x03,
-    0x80, 0x3D, 0x04, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x05, 0xB8, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xE0,
-    0x00, 0x0B, 0xC2, 0x00, 0x2F, 0x3C, 0x01, 0xF4, 0xFE, 0xAF, 0x80, 0xFF, 0xE4, 0x00, 0x0B, 0x00,
-    0x00, 0x2C, 0x00, 0x14, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x55, 0x50, 0x01,
-    0xA0, 0x03, 0xFF, 0xD0, 0x2F, 0xD0, 0x01, 0xF8, 0x03, 0xFF, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x00,
-    0x2F, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0x0F, 0x4B,
-    0x00, 0x00, 0x00, 0x7E, 0xF8, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x0F, 0x83, 0xD0, 0x00,
-    0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x2F,
-    0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x1B, 0xF9, 0x01, 0xFD, 0x01, 0xFF, 0xF8, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE0, 0x0B, 0xCB, 0xFC, 0x0F, 0xF0, 0x1E, 0x0F, 0x58, 0x0B, 0x4F, 0x00, 0x03, 0xCB,
-    0x00, 0x00, 0xF7, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xBC, 0x00, 0x0B, 0x8F, 0x00, 0x03, 0xC2,
-    0xF0, 0x20, 0xF0, 0x3D, 0x2C, 0x7C, 0x0B, 0xFF, 0x2D, 0x00, 0xFE, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x06, 0x40, 0x00, 0x55, 0x50, 0x00,
-    0x29, 0x00, 0xFF, 0xF4, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x07, 0xFE, 0x00, 0x1F, 0x00, 0x0F, 0x00,
-    0x00, 0x2F, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x70, 0xB0, 0x00, 0x00, 0x3D, 0xB1, 0xD0, 0x00, 0x00,
-    0x3C, 0xE3, 0x80, 0x00, 0x00, 0x7E, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x00, 0x00, 0xF9,
-    0xCB, 0x80, 0x00, 0x00, 0xF6, 0xC3, 0xC0, 0x00, 0x00, 0xF2, 0x83, 0xE0, 0x00, 0x01, 0xF0, 0x01,
-    0xF0, 0x00, 0x02, 0xE0, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x00, 0x7D, 0x00, 0x1B, 0xF9, 0x00, 0x3F,
-    0x40, 0x7F, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8,
-    0x00, 0x7E, 0xBF, 0xC0, 0x1F, 0xE0, 0x78, 0x03, 0xD5, 0x0B, 0x50, 0xF0, 0x00, 0xF7, 0x2C, 0x00,
-    0x0F, 0x77, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1E, 0xAB, 0x40, 0x02, 0xDD, 0x3C, 0x00, 0x3C, 0x43,
-    0xD0, 0x03, 0xC0, 0x1F, 0x0D, 0x7C, 0x00, 0xFF, 0xCB, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x50, 0x01, 0xA0, 0x03, 0xFF, 0xD0, 0x2F, 0xD0, 0x01, 0xF8, 0x03, 0xFF, 0x00, 0x07,
-    0xC0, 0x2E, 0x00, 0x02, 0xBF, 0x92, 0xE0, 0x00, 0x0F, 0xFF, 0x5F, 0x00, 0x00, 0x03, 0xD0, 0xF0,
-    0x00, 0x00, 0x0F, 0x4B, 0x00, 0x00, 0x00, 0x7E, 0xF8, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00,
-    0x0F, 0x83, 0xD0, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0xF0, 0x1F, 0x40, 0x00, 0x07, 0xC0,
-    0x3F, 0x00, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x1B, 0xF9, 0x01, 0xFC,
-    0x01, 0xFF, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0xFE, 0x0B, 0xC2, 0xBE,
-    0x4B, 0xF0, 0x1E, 0x0F, 0x58, 0x0B, 0x4B, 0x00, 0x03, 0xCB, 0x00, 0x00, 0xF7, 0x40, 0x00, 0x3F,
-    0xD0, 0x00, 0x1F, 0x7C, 0x00, 0x0B, 0x8F, 0x40, 0x03, 0xC1, 0xF0, 0x10, 0xF0, 0x3D, 0x38, 0x7C,
-    0x07, 0xFC, 0x2D, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x01, 0xA1, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xDB, 0xAA, 0xF8, 0x03, 0xFF, 0x3C, 0x07, 0xC0, 0x2E, 0x00, 0xF0, 0x2F, 0x02, 0xE0,
-    0x02, 0x40, 0xB8, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0x0F, 0x4B, 0x00, 0x00, 0x00,
-    0x7E, 0xF8, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0x00, 0x3D, 0x0B,
-    0xC0, 0x00, 0x00, 0xF0, 0x1F, 0x40, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x7D, 0x00,
-    0x00, 0xF8, 0x00, 0xFC, 0x00, 0x1B, 0xF9, 0x01, 0xFC, 0x01, 0xFF, 0xF8, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x03, 0xE2, 0xFF, 0xE0, 0x7F, 0xCE,
-    0x07, 0x47, 0xD5, 0x3C, 0x2C, 0x3C, 0x00, 0x50, 0xF3, 0xC0, 0x00, 0x03, 0xAC, 0x00, 0x00, 0x1E,
-    0xF4, 0x00, 0x00, 0xBE, 0xE0, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x7C, 0x0F,
-    0x4D, 0x02, 0xE0, 0x2F, 0xF0, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54,
-    0x01, 0x55, 0x40, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D,
-    0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x00,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00,
-    0x3E, 0x00, 0x00, 0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0xE4, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0x4B, 0xFC, 0x00, 0xF4, 0x07, 0xC0, 0x0F, 0x00, 0xB8, 0x00, 0xF0, 0x0F,
-    0x40, 0x1F, 0x00, 0xF5, 0x56, 0xE0, 0x0F, 0xFF, 0xFD, 0x01, 0xF5, 0x57, 0xC0, 0x2E, 0x00, 0x7C,
-    0x03, 0xD0, 0x0B, 0x85, 0x3C, 0x00, 0xB5, 0xE7, 0xC0, 0x0F, 0xFC, 0xB8, 0x00, 0xBD, 0xC0, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x90,
-    0x00, 0x55, 0x54, 0x01, 0x55, 0x55, 0x00, 0x3F, 0xFD, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xF8, 0x00,
-    0x0B, 0xEA, 0xF4, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x2D, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x0B, 0x00,
-    0x0B, 0x80, 0x00, 0x3D, 0x02, 0x40, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x3D, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x00, 0x1F, 0xFF, 0x40, 0xBF, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0xFE, 0x6F, 0xF0, 0x03, 0xFF, 0xF0, 0x7C, 0x00, 0xF0, 0x3C, 0x2E, 0x00,
-    0x3C, 0x3D, 0x0F, 0x40, 0x1F, 0x09, 0x03, 0xD5, 0x5B, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7D,
-    0x55, 0xF0, 0x00, 0x2E, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x2E, 0x00, 0x03, 0xC0, 0x0B, 0x9D, 0x01,
-    0xF0, 0x03, 0xFE, 0x00, 0xB8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xAA, 0xAB, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x0F, 0x5F, 0xFD, 0x00, 0x0B, 0xC0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xF8,
-    0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x0F, 0x40, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0xF0, 0x00, 0x3E, 0x00,
-    0x07, 0xD0, 0x1F, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x3E,
-    0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x1B, 0xF8, 0x02, 0xFE, 0x40, 0x0B, 0xC7, 0xFF, 0xC0, 0xFF, 0xF8,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0x81, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80,
-    0xBE, 0x00, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x00, 0x07, 0x8F, 0x4F, 0x40, 0x00, 0x0B, 0xBC, 0x0F,
-    0x00, 0x00, 0x0F, 0xF0, 0x1F, 0x00, 0x00, 0x0F, 0xD0, 0x2F, 0xBF, 0xD0, 0x0F, 0x80, 0x2F, 0xFF,
-    0xF4, 0x1F, 0x00, 0x3E, 0x01, 0xFC, 0x2E, 0x00, 0x3C, 0x00, 0xBC, 0x3D, 0x00, 0x7C, 0x00, 0x7C,
-    0x3C, 0x00, 0xB8, 0x00, 0x7C, 0x7C, 0x00, 0xF4, 0x00, 0x7C, 0xB8, 0x00, 0xF0, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x0D, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xA8,
-    0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00, 0x1F, 0xD0, 0x1B, 0xD0, 0x01, 0xF8, 0x02, 0xFB, 0xE0,
-    0x0F, 0x80, 0x3E, 0x07, 0xD0, 0xBC, 0x01, 0xF0, 0x0F, 0x83, 0xD0, 0x0F, 0x40, 0x3E, 0x1F, 0x00,
-    0x7C, 0x00, 0xF8, 0xFC, 0x02, 0xF0, 0x03, 0xE3, 0xE0, 0x0B, 0xC0, 0x0F, 0x4F, 0x80, 0x3E, 0x00,
-    0xBC, 0x3E, 0x00, 0xBC, 0x03, 0xE0, 0xFC, 0x02, 0xF0, 0x1F, 0x02, 0xF0, 0x07, 0xC0, 0xF4, 0x03,
-    0xE0, 0x0F, 0x8F, 0x80, 0x0B, 0xE0, 0x0F, 0xF8, 0x00, 0x0B, 0xFA, 0xBF, 0xD0, 0x60, 0x07, 0xFF,
-    0xEB, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x3E, 0x07, 0xF4, 0x03, 0xD0, 0xB9, 0xF4, 0x2E, 0x07, 0x81, 0xE0, 0xF0, 0x3D, 0x07, 0xCB, 0x80,
-    0xF0, 0x1F, 0x3D, 0x07, 0xC0, 0xB8, 0xF4, 0x1F, 0x03, 0xC3, 0xD0, 0x7C, 0x1E, 0x0F, 0x80, 0xF0,
-    0xF0, 0x1F, 0x02, 0xEF, 0x40, 0x3F, 0x97, 0xF4, 0x10, 0x2F, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x0F, 0xE5, 0xBF, 0x80, 0xFC, 0x00, 0x2D,
-    0x0F, 0xC0, 0x00, 0xB0, 0x7C, 0x00, 0x02, 0x83, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0C, 0x0F, 0xF4, 0x06, 0xF0, 0x0F, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x02, 0xFF, 0xD0, 0xB8, 0x18, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4,
-    0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x4B, 0xC0, 0x78, 0x7F, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0xE0,
-    0x00, 0x0E, 0x00, 0x10, 0xE0, 0x03, 0xFC, 0x00, 0x1A, 0x00, 0x00, 0x15, 0x55, 0x55, 0x51, 0xFF,
-    0xFF, 0xFF, 0xEB, 0xAA, 0xFE, 0xAF, 0x7C, 0x03, 0xD0, 0x2C, 0xF0, 0x1F, 0x00, 0xB2, 0x40, 0xBC,
-    0x02, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x2F, 0x40, 0xBE, 0x0B,
-    0xFC, 0x3F, 0xF0, 0xFF, 0xC0, 0x1E, 0x3D, 0x7C, 0xF5, 0xF0, 0x0B, 0xBC, 0x1E, 0xF0, 0x3C, 0x03,
-    0xFC, 0x0B, 0xF0, 0x1F, 0x00, 0xFD, 0x03, 0xF4, 0x0B, 0x80, 0x3E, 0x00, 0xFC, 0x03, 0xD0, 0x1F,
-    0x00, 0x7D, 0x00, 0xF0, 0x0B, 0x80, 0x1F, 0x00, 0x78, 0x03, 0xD0, 0x0B, 0x40, 0x2D, 0x24, 0xF0,
-    0x03, 0xC0, 0x0F, 0x5D, 0x7C, 0x00, 0xF0, 0x03, 0xFF, 0x2E, 0x00, 0x78, 0x00, 0xFE, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x06, 0x40, 0x15, 0x54, 0x01, 0x55, 0x1F, 0xFF, 0x42,
-    0xFF, 0xD1, 0xFD, 0x00, 0x1F, 0x80, 0x2F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0xBC,
-    0x03, 0xC0, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x03, 0xE2, 0xE0, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x80,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xCB, 0xFC, 0x02, 0xF0,
-    0x1F, 0x00, 0x7C, 0x03, 0xD0, 0x0F, 0x00, 0xB8, 0x07, 0x80, 0x2E, 0x03, 0xD0, 0x07, 0xC0, 0xF0,
-    0x00, 0xF0, 0xF4, 0x00, 0x3C, 0x78, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xB4, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0xAA, 0xA0, 0x00, 0x15, 0x54, 0x01, 0x55, 0x1F, 0xFF, 0x42, 0xFF, 0xD1,
-    0xFD, 0x00, 0x1F, 0x80, 0x2F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0xBC, 0x03, 0xC0,
-    0x00, 0x1F, 0x03, 0xD0, 0x00, 0x03, 0xE2, 0xE0, 0x00, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x17, 0xF9, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x80, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xCB, 0xFC, 0x02, 0xF0, 0x1F, 0x00,
-    0x7C, 0x03, 0xD0, 0x0F, 0x00, 0xB8, 0x07, 0x80, 0x2E, 0x03, 0xD0, 0x07, 0xC0, 0xF0, 0x00, 0xF0,
-    0xF4, 0x00, 0x3C, 0x78, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x5F, 0x54, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x15, 0x54, 0x05, 0x54, 0x00, 0xFF, 0xF8, 0x2F, 0xFD, 0x00,
-    0x2F, 0x80, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x2E, 0x00, 0x00, 0x03,
-    0xE0, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xCB, 0xC0,
-    0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00,
-    0x02, 0xE0, 0x00, 0xBC, 0x00, 0x1F, 0xE4, 0x01, 0xFF, 0x90, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xB8, 0x00, 0xFC, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0x3E, 0x0F, 0x44, 0x00, 0x1F, 0x2D,
-    0x00, 0x00, 0x0F, 0xB8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x78, 0xF4, 0x30, 0x10, 0xF0, 0xBD, 0xF0, 0x3F, 0xC0, 0x3F,
-    0xF0, 0x3F, 0x40, 0x2E, 0xB0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x06, 0x00, 0x05, 0x55, 0x55, 0x01, 0x55, 0x07, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xD2, 0xE6, 0xF6, 0xF0, 0x1F, 0x40, 0xF0, 0xB8, 0x3C, 0x07, 0xC0, 0x38, 0x3D,
-    0x0F, 0x02, 0xE0, 0x09, 0x0F, 0x03, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x00,
-    0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00,
-    0x07, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x90, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x78, 0xBF, 0xC0, 0x0F, 0x40,
-    0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xB8, 0x01, 0xE0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03,
-    0xC0, 0x2E, 0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x80, 0x3D, 0x03, 0xB8, 0x93, 0xD0, 0xF7, 0xAD, 0x3F,
-    0xFC, 0x7F, 0xC1, 0xFE, 0x03, 0xAC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x19, 0x00, 0x15, 0x54, 0x05, 0x55, 0x1F, 0xFF, 0x03, 0xFF,
-    0xD0, 0xBD, 0x00, 0x2F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x03, 0xE0, 0x03, 0xD0, 0x00,
-    0xF4, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x02, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFE, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x90,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80,
-    0x0B, 0x0F, 0xF8, 0x01, 0xF0, 0x0B, 0x80, 0x2E, 0x00, 0xB4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x00,
-    0xF0, 0x0F, 0xC0, 0x0F, 0xDB, 0xF8, 0x00, 0x7F, 0xEF, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x08, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xF7, 0x40, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x80, 0x15, 0x54, 0x05,
-    0x55, 0x1F, 0xFF, 0x03, 0xFF, 0xD0, 0xBD, 0x00, 0x2F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x0F, 0x80,
-    0x03, 0xE0, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0xF0, 0x70, 0x3C, 0x00, 0x3D, 0x2C, 0x1F, 0x00, 0x0F,
-    0x8E, 0x0B, 0xC0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFE, 0xF4, 0x00, 0x00, 0xB0, 0x7C, 0x00,
-    0x00, 0x2C, 0x2F, 0x00, 0x00, 0x0E, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x6F, 0x80, 0x0B, 0x3F, 0xE0, 0x07,
-    0xC0, 0xB8, 0x02, 0xE0, 0x2D, 0x00, 0xF4, 0x0F, 0x04, 0x3C, 0x03, 0xCA, 0x3F, 0x00, 0xFF, 0xFF,
-    0x80, 0x1F, 0xFB, 0xD0, 0x00, 0x70, 0xF0, 0x00, 0x1C, 0x3C, 0x10, 0x01, 0x1F, 0x3C, 0x00, 0x0B,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0xBF, 0xD0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xBE, 0x00, 0xFC,
-    0x00, 0xF8, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xF0, 0x00, 0xF8,
-    0x02, 0xF0, 0x00, 0xF4, 0x03, 0xE0, 0x00, 0xF0, 0x1B, 0xF8, 0x07, 0xF9, 0x7F, 0xFC, 0x1F, 0xFE,
-    0x00, 0x10, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x6B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x1F, 0xD0, 0x02, 0xD2,
-    0xFF, 0x80, 0x0F, 0x2E, 0x2F, 0x00, 0x3D, 0xD0, 0xB8, 0x01, 0xFD, 0x03, 0xD0, 0x0B, 0xF0, 0x0F,
-    0x00, 0x2F, 0x00, 0x7C, 0x00, 0xF8, 0x02, 0xE0, 0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x10,
-    0xB8, 0x00, 0xF3, 0xC3, 0xD0, 0x07, 0xFD, 0x0F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x5F, 0xD0, 0x80, 0x7D, 0x00,
-    0x3E, 0x78, 0x0F, 0x40, 0x03, 0xFB, 0x42, 0xE0, 0x00, 0x2F, 0xF4, 0x3C, 0x00, 0x03, 0xEB, 0xDB,
-    0xC0, 0x00, 0x3D, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xEA, 0xAA, 0xA8, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x07, 0x40, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xEB, 0xD0,
-    0x00, 0xF0, 0x2E, 0x14, 0x3C, 0x03, 0xD3, 0x87, 0x80, 0xBC, 0x74, 0xF4, 0x2F, 0x07, 0xDF, 0xBF,
-    0x80, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x40, 0x0F, 0x40, 0xB8, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x5F, 0xD0, 0x80, 0x7D, 0x00, 0x3E, 0x78, 0x0F, 0x40, 0x03,
-    0xFB, 0x42, 0xF0, 0x00, 0x2F, 0xF4, 0x3D, 0x00, 0x03, 0xEB, 0xDB, 0xC0, 0x00, 0x3D, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xEA, 0xAA, 0xA8, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x07, 0x40, 0x0F, 0xE0,
-    0x07, 0xF0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xEB,
-    0xD0, 0x00, 0xF0, 0x2E, 0x14, 0x3C, 0x03, 0xD3, 0x87, 0x80, 0xBC, 0x74, 0xF4, 0x2F, 0x07, 0xDF,
-    0xBF, 0x80, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x40, 0x0F, 0x40, 0xB8,
-    0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0x34, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x55, 0x54, 0x03, 0xFF, 0xE0, 0x01,
-    0xF8, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00,
-    0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0xF8, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x05, 0x54, 0x00,
-    0x68, 0x00, 0xFF, 0x40, 0xFF, 0xF0, 0x0F, 0xF0, 0x02, 0xFF, 0x00, 0x7D, 0x00, 0xFF, 0xC0, 0x00,
-    0x2D, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x3C, 0x07, 0xC0, 0xB4, 0x00, 0x00, 0x00, 0xB0, 0x2E,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0xE0, 0xF4, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xC3, 0xC3, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xEF, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xC2, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0x43, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x3C, 0x07,
-    0xC0, 0x00, 0x00, 0x3F, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x0B, 0x80, 0x2F, 0x00, 0x00,
-    0x3F, 0x40, 0x2D, 0x00, 0x3F, 0x00, 0x07, 0xF4, 0x02, 0xFD, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x3F,
-    0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x90, 0x0C, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xC0, 0x00, 0x00, 0x02, 0xF5, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x1C, 0x00, 0xBE, 0x07, 0xFF, 0x03, 0xC0, 0x3F, 0xF0, 0xE0, 0xF0, 0x7C,
-    0x0F, 0x45, 0x08, 0x0B, 0x0F, 0x82, 0xC0, 0x00, 0x00, 0xB6, 0xF4, 0xB8, 0x00, 0x00, 0x0B, 0xBB,
-    0x1F, 0x00, 0x00, 0x00, 0xBC, 0xF3, 0xE0, 0x00, 0x00, 0x0F, 0x4E, 0xDE, 0x00, 0x00, 0x01, 0xE1,
-    0xF9, 0xE0, 0x00, 0x00, 0x38, 0x2F, 0x1E, 0x00, 0x44, 0x0F, 0x03, 0xD0, 0xF0, 0x78, 0xFF, 0xC0,
-    0x3C, 0x0F, 0xFF, 0x0B, 0xF0, 0x07, 0x40, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x50, 0x01, 0xA0, 0x03, 0xFF, 0xD0, 0x2F, 0xD0, 0x01, 0xF8, 0x03, 0xFF, 0x00, 0x07, 0xC0,
-    0x2E, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00, 0xB8, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0xF0, 0x00,
-    0x00, 0x0F, 0x4B, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x02, 0xFA, 0xFF, 0xC0, 0x00, 0x0F,
-    0x80, 0x2F, 0x80, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0x00,
-    0xF4, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x1B, 0xF9, 0x00, 0x7C, 0x01,
-    0xFF, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0C,
-    0x0B, 0xC0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x2E, 0xBF, 0xC0, 0xFF, 0x07, 0x82, 0xD5, 0x0B, 0x47, 0x40,
-    0x0F, 0x0F, 0x00, 0x0F, 0x1D, 0x00, 0x0F, 0xBF, 0x80, 0x1F, 0xEF, 0xF0, 0x2D, 0x00, 0xF8, 0x3C,
-    0x00, 0xBC, 0x3C, 0x00, 0x7C, 0x7C, 0x00, 0x3C, 0xB4, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0xF4, 0x00, 0x01, 0xF0, 0x0D, 0x0B, 0xC0, 0x1F, 0xFF, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7E, 0x5B, 0xE0, 0x00, 0x00, 0x3C, 0x07,
-    0xC0, 0x00, 0x00, 0x3C, 0x0B, 0xC0, 0x00, 0x00, 0x78, 0x0F, 0x80, 0x00, 0x00, 0xB0, 0x0F, 0x40,
-    0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x1F, 0x00, 0x00, 0x02, 0xC0, 0x2F, 0x00, 0x00,
-    0x03, 0xC0, 0x3E, 0x00, 0x00, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0x2D,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x35, 0xF4, 0x00, 0xF8, 0x00, 0x3F, 0xE0, 0x06,
-    0xFE, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x07, 0x42, 0xE0, 0x00, 0x0B, 0x03, 0xD0, 0x00, 0x0E, 0x03,
-    0xC0, 0x00, 0x1D, 0x03, 0xC0, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x38, 0x0B, 0x80, 0x00, 0xB4, 0x0F,
-    0x48, 0x25, 0xF0, 0x0F, 0x2D, 0x3F, 0xD0, 0x0F, 0xFC, 0x3F, 0x40, 0x0F, 0xBC, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x55, 0x54, 0x01, 0x55, 0x40, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00,
-    0xBD, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xE0, 0x00,
-    0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40,
-    0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0,
-    0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x1F, 0x00, 0x07, 0xFF,
-    0xD0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0xD0, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x6F, 0xF0, 0x03, 0xD0, 0x7C, 0x00, 0xF0, 0x2E,
-    0x00, 0x3C, 0x0F, 0x40, 0x1F, 0x03, 0xD5, 0x5B, 0x80, 0xFF, 0xFF, 0xD0, 0x7D, 0x55, 0xF0, 0x2E,
-    0x00, 0x3C, 0x0F, 0x40, 0x1E, 0x03, 0xC0, 0x0B, 0x41, 0xF0, 0x03, 0xC0, 0xB8, 0x00, 0xF0, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xDF, 0x40, 0x00, 0xFF, 0xC0, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x55, 0x54, 0x01, 0x55, 0x40, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F,
-    0x80, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00,
-    0x0F, 0x40, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0xE0,
-    0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x34,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x4B, 0xFC, 0x00, 0xF4, 0x07, 0xC0,
-    0x0F, 0x00, 0xB8, 0x00, 0xF0, 0x0F, 0x40, 0x1F, 0x00, 0xF5, 0x56, 0xE0, 0x0F, 0xFF, 0xFD, 0x01,
-    0xF5, 0x57, 0xC0, 0x2E, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x89, 0x3C, 0x00, 0xB9, 0xE7, 0xC0, 0x0B,
-    0xFD, 0xB8, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x01, 0x00, 0x15, 0x54, 0x05, 0x55, 0x1F, 0xFF, 0x03, 0xFF, 0xD0, 0xBD,
-    0x00, 0x2F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0xF4, 0x00,
-    0xF0, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFE, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x07,
-    0xFF, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x0B, 0x3F,
-    0xE0, 0x07, 0xC0, 0xB8, 0x02, 0xE0, 0x2D, 0x00, 0xF4, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x3F, 0x00,
-    0xFD, 0xBF, 0x80, 0x1F, 0xFB, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x07, 0x80, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x01, 0x55, 0x00, 0x07, 0xFF,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0,
-    0x00, 0x03, 0xEE, 0x00, 0x3D, 0xF0, 0x00, 0x01, 0xEB, 0x80, 0x2D, 0xBC, 0x00, 0x00, 0xB5, 0xF0,
-    0x0F, 0x2E, 0x00, 0x00, 0x3C, 0x7C, 0x0B, 0x0B, 0x80, 0x00, 0x1E, 0x0F, 0x03, 0x82, 0xE0, 0x00,
-    0x0B, 0x43, 0xD3, 0xC0, 0xF4, 0x00, 0x03, 0xC0, 0xF9, 0xE0, 0x3D, 0x00, 0x00, 0xF0, 0x2E, 0xF0,
-    0x0F, 0x40, 0x00, 0xB8, 0x07, 0xF4, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x3D, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x0A, 0x00, 0x1F, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F,
-    0xE8, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xF8, 0x00, 0x1F, 0x80, 0x3F, 0xF4, 0x01, 0xFD, 0x00, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x00, 0x37, 0xC0, 0x77, 0x80, 0x00, 0xDB, 0x43, 0x9D, 0x00, 0x07, 0x1D, 0x2C, 0xB4, 0x00, 0x2C,
-    0x78, 0xD3, 0xC0, 0x00, 0xE0, 0xEB, 0x0F, 0x00, 0x03, 0x43, 0xF4, 0x3C, 0x00, 0x1C, 0x0F, 0xC1,
-    0xE1, 0x94, 0xE0, 0x3D, 0x07, 0x8F, 0xFF, 0x40, 0xF0, 0x1F, 0xFA, 0xF4, 0x02, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x06, 0xF9,
-    0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3C,
-    0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0xB8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x01, 0xBE, 0x40, 0x2F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x40, 0x00, 0x03, 0xD0, 0x1D, 0x00, 0x00, 0x0F,
-    0x81, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0x6E, 0x00, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x01, 0xD0,
-    0xF0, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0xB4, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x2E, 0x00,
-    0x00, 0x3E, 0x55, 0xBC, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x55, 0x5B, 0xD0, 0x00, 0xB8,
-    0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x2E, 0x00, 0x00, 0xFC, 0x02, 0xF9, 0x00, 0x07,
-    0xF9, 0x3F, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x90, 0x0B, 0x80, 0x70,
-    0x02, 0xF5, 0xB8, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D,
-    0x02, 0xFF, 0xFF, 0x01, 0xF4, 0x2F, 0x80, 0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C,
-    0x1E, 0x00, 0x2E, 0x0B, 0x40, 0x1F, 0x43, 0xD0, 0x0F, 0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C,
-    0xFB, 0xFF, 0x4F, 0xF0, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0xC0,
-    0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x76, 0xE0, 0x00, 0x00, 0x03, 0xC7, 0xC0, 0x00,
-    0x00, 0x1D, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x0B, 0x40, 0xF4, 0x00, 0x00, 0x3C,
-    0x02, 0xE0, 0x00, 0x03, 0xE5, 0x5B, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xF5, 0x55, 0xBD,
-    0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x02, 0xE0, 0x00, 0x0F, 0xC0, 0x2F,
-    0x90, 0x00, 0x7F, 0x93, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x14, 0x05, 0x00, 0x2F, 0x4B, 0xD0,
-    0x0B, 0xC2, 0xF0, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x74,
-    0x0B, 0xFF, 0xFC, 0x07, 0xD0, 0xBE, 0x03, 0xC0, 0x0F, 0x43, 0xE0, 0x03, 0xC0, 0xF0, 0x01, 0xF0,
-    0x78, 0x00, 0xB8, 0x2D, 0x00, 0x7D, 0x0F, 0x40, 0x3F, 0x03, 0xD0, 0x2F, 0xC1, 0xFC, 0x2C, 0xF3,
-    0xEF, 0xFD, 0x3F, 0xC3, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xF0, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x38, 0x00, 0x00, 0x02, 0xDF, 0x40, 0x0D, 0x00, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x3F,
-    0xAB, 0xC0, 0x00, 0x00, 0x78, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3D, 0x57, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x55, 0xF8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x3E, 0x00,
-    0x0C, 0x00, 0x1E, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x07, 0x80, 0x1F, 0xE0,
-    0x07, 0xFF, 0xFF, 0xD0, 0x2F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x0B, 0xF8, 0x01, 0xFF, 0xFF, 0xEB, 0xD0, 0x7D, 0x02, 0xF0, 0x2E, 0x0F, 0x40, 0x3C,
-    0x03, 0xD2, 0xE0, 0x07, 0x80, 0xBC, 0x3C, 0x00, 0xF4, 0x3F, 0x07, 0x80, 0x1F, 0x7F, 0x80, 0xB4,
-    0x03, 0xFF, 0x40, 0x0F, 0x40, 0xBF, 0x00, 0x00, 0xF4, 0x0F, 0xF0, 0x00, 0x4F, 0x83, 0xCF, 0x40,
-    0xB8, 0xBF, 0xF0, 0xFF, 0xFE, 0x03, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x80, 0x00, 0x1E, 0x00, 0xE0, 0x00, 0x07, 0xC1, 0xF0,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x54, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xEA, 0xAB, 0xC0, 0x01, 0xF0, 0x00, 0xE0, 0x00, 0xBC,
-    0x00, 0x30, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01,
-    0xFA, 0xAA, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x70, 0x00, 0xBC, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x1E,
-    0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09,
-    0x02, 0xE0, 0x1C, 0x02, 0xF5, 0xB8, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0, 0x1E, 0x01, 0xF0, 0x3C, 0x03, 0xD0, 0x78, 0x2F,
-    0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x40, 0xFC, 0x07, 0xC0,
-    0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x3F, 0x56, 0xFC, 0x02, 0xD0, 0x00, 0xFC, 0x01, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xBC, 0x7C, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x2F, 0x0B, 0xC0, 0x01,
-    0xF4, 0x1F, 0x00, 0x2F, 0x40, 0x3F, 0xAB, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xFF, 0x02, 0xD0, 0x3E, 0x04, 0x00, 0x7C, 0x00,
-    0x01, 0xF0, 0x00, 0xBF, 0xC0, 0x2F, 0xAF, 0x0B, 0xD0, 0xB8, 0xBC, 0x03, 0xC3, 0xC0, 0x2E, 0x0F,
-    0x02, 0xF0, 0x3E, 0x7F, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x02, 0xC0, 0x00,
-    0xBD, 0x2F, 0x40, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFD, 0x5B, 0xF0, 0x0B, 0x40, 0x03, 0xF0, 0x04, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0x3C, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0x0F, 0x4B, 0xC0,
-    0x00, 0xBC, 0x2F, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0xBD, 0x00, 0xFE, 0xAF, 0xD0, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x01, 0xF4, 0x7D, 0x02, 0xF0, 0xBC, 0x00, 0x40,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0xF0, 0x0B, 0x40, 0xF8,
-    0x04, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x0B, 0xFC, 0x00, 0xBE, 0xBC, 0x0B, 0xD0, 0xB8, 0x2F,
-    0x00, 0xF0, 0x3C, 0x02, 0xE0, 0x3C, 0x0B, 0xC0, 0x3E, 0x7F, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x55, 0x40, 0x06, 0x80, 0x0F, 0xF4, 0x0F, 0xFF, 0x00, 0xFF,
-    0x00, 0x2F, 0xF0, 0x07, 0xD0, 0x0F, 0xFC, 0x00, 0x02, 0xD0, 0x0F, 0x00, 0xF8, 0x00, 0x00, 0x03,
-    0xC0, 0x7C, 0x0B, 0x40, 0x00, 0x00, 0x0B, 0x02, 0xE0, 0x78, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x43,
-    0xC0, 0x00, 0x00, 0x00, 0x2C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFB, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xEF, 0xEF, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x2E, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0xF4, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x03, 0xF4, 0x02, 0xD0, 0x03, 0xF0, 0x00, 0x7F,
-    0x40, 0x2F, 0xD0, 0x0B, 0xE0, 0x07, 0xF4, 0x03, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x00,
-    0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x01, 0xC0, 0x0B, 0xE0, 0x7F, 0xF0, 0x3C, 0x03, 0xFF, 0x0E,
-    0x0F, 0x07, 0xC0, 0xF4, 0x50, 0x80, 0xB0, 0xF8, 0x2C, 0x00, 0x00, 0x0B, 0x6F, 0x4B, 0x80, 0x00,
-    0x00, 0xBB, 0xB1, 0xF0, 0x00, 0x00, 0x0B, 0xCF, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0xED, 0xE0, 0x00,
-    0x00, 0x1E, 0x1F, 0x9E, 0x00, 0x00, 0x03, 0x82, 0xF1, 0xE0, 0x04, 0x40, 0xF0, 0x3D, 0x0F, 0x07,
-    0x8F, 0xFC, 0x03, 0xC0, 0xFF, 0xF0, 0xBF, 0x00, 0x74, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x0B, 0x40, 0x2F, 0x47, 0xE0, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA4, 0x00, 0x2F, 0xFF, 0xD0, 0x0F, 0x95, 0xFC, 0x03, 0xC0, 0x0F, 0x41, 0xD0,
-    0x03, 0xD0, 0x20, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x1A, 0xFD, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC2, 0x00, 0x03, 0xE2, 0xD0,
-    0x01, 0xF4, 0xFC, 0x01, 0xFC, 0x1F, 0xFB, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x14, 0x02, 0xF4, 0xBD, 0x02, 0xF0, 0xBC, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x07, 0xFB, 0xF0, 0x0E, 0x00, 0xF4, 0x04, 0x00, 0xF0, 0x00, 0x01, 0xE0,
-    0x00, 0x5B, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x20, 0x02, 0xF0, 0xF0,
-    0x07, 0xD0, 0xFE, 0xAF, 0x80, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0xFA, 0xAA, 0xFC, 0x00, 0xF0, 0x02, 0xF0, 0x00, 0xD0, 0x0B, 0xC0, 0x00,
-    0x80, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x01, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x08,
-    0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x7F, 0x00, 0x2F, 0xEB, 0xFC, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xC0, 0x3C,
-    0x00, 0x7D, 0x00, 0xD0, 0x03, 0xD0, 0x01, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x00, 0x02, 0xE0, 0x0E,
-    0x00, 0x1F, 0x00, 0x7E, 0x02, 0xF8, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x15, 0x54,
-    0x00, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x2E, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xD0, 0x03, 0xDF,
-    0x00, 0x00, 0x3D, 0x00, 0xF1, 0xF0, 0x00, 0x07, 0xC0, 0x3C, 0x2F, 0x00, 0x00, 0xBC, 0x1F, 0x03,
-    0xE0, 0x00, 0x0F, 0x87, 0x80, 0x3D, 0x00, 0x00, 0xF5, 0xE0, 0x07, 0xC0, 0x00, 0x0F, 0xB8, 0x00,
-    0xBC, 0x00, 0x01, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x40, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x00,
-    0x0F, 0x40, 0x01, 0xBF, 0x80, 0x07, 0xF9, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2A,
-    0xAA, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x78, 0xBF, 0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xB8, 0x01,
-    0xE0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x2E, 0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x80, 0x3D,
-    0x03, 0xB8, 0x03, 0xD0, 0xF7, 0x9D, 0x3F, 0xFC, 0x7F, 0xC1, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x02, 0x80, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x15, 0x54, 0x00, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x00,
-    0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x2E, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xD0,
-    0x03, 0xDF, 0x00, 0x00, 0x3D, 0x00, 0xF1, 0xF0, 0x00, 0x07, 0xC0, 0x3C, 0x2F, 0x00, 0x00, 0xBC,
-    0x1F, 0x03, 0xE0, 0x00, 0x0F, 0x87, 0x80, 0x3D, 0x00, 0x00, 0xF5, 0xE0, 0x07, 0xC0, 0x00, 0x0F,
-    0xB8, 0x00, 0xBC, 0x00, 0x01, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x40, 0x00, 0xF4, 0x00, 0x03,
-    0xE0, 0x00, 0x0F, 0x40, 0x01, 0xBF, 0x80, 0x07, 0xF9, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x18, 0x06, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0xBC, 0x2F, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00,
-    0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B,
-    0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F,
-    0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0xB0, 0x00, 0x03, 0xF4, 0xBD, 0x00, 0x00,
-    0xFC, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x01, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x5B, 0xF0, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0F,
-    0xC1, 0xF0, 0x00, 0x01, 0xF4, 0xF8, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x0F, 0x6F, 0x00, 0x00,
-    0x03, 0xDF, 0x80, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x1F, 0xC0, 0x03,
-    0xFE, 0xBF, 0xC0, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00,
-    0x2F, 0x4B, 0xD0, 0x0B, 0xC2, 0xF0, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFE, 0x00, 0x0B, 0xFF, 0xE0, 0x0F, 0xC0, 0x7C, 0x0B, 0xC0, 0x0F, 0x43, 0xD0, 0x03, 0xE1,
-    0xF0, 0x00, 0xF4, 0xB8, 0x00, 0x3D, 0x3D, 0x00, 0x0F, 0x0F, 0x40, 0x0B, 0x83, 0xE0, 0x03, 0xC0,
-    0xBC, 0x03, 0xE0, 0x1F, 0xEB, 0xE0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x6F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x0F, 0xC0,
-    0x00, 0x2F, 0x07, 0xC0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBE,
-    0xAA, 0xAA, 0xAF, 0x7F, 0xFF, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x00, 0xF8,
-    0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x7F,
-    0x00, 0x0F, 0xFA, 0xFE, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE0, 0x02, 0xFE, 0xFC, 0x0B, 0xC0, 0x3D, 0x1F, 0x00, 0x2E, 0x3C, 0x00, 0x1F,
-    0x7C, 0x00, 0x2E, 0xBF, 0xFF, 0xFE, 0xF4, 0x00, 0x3D, 0xF0, 0x00, 0x7C, 0xF4, 0x00, 0xF4, 0xB8,
-    0x02, 0xF0, 0x3F, 0xAF, 0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0xB0, 0x00,
-    0x03, 0xF4, 0xBD, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x5B, 0xF0, 0x03, 0xF0, 0x00,
-    0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xC1, 0xF0, 0x00, 0x01, 0xF4, 0xF8, 0x00, 0x00, 0x3D, 0x7C, 0x00,
-    0x00, 0x0F, 0x6F, 0xAA, 0xAA, 0xAB, 0xDF, 0xFF, 0xFF, 0xFF, 0xF3, 0xE0, 0x00, 0x00, 0x7C, 0xF8,
-    0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x0B, 0xC0,
-    0x3F, 0x40, 0x1F, 0xC0, 0x03, 0xFE, 0xBF, 0x80, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x06, 0x00, 0x1F, 0x47, 0xD0, 0x0B, 0xC2, 0xF0, 0x00, 0x40, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0B, 0xFB, 0xF0, 0x0B, 0xC0, 0x3D, 0x07, 0xC0,
-    0x0B, 0x83, 0xC0, 0x01, 0xF1, 0xF0, 0x00, 0xB8, 0xBF, 0xFF, 0xFE, 0x3D, 0x00, 0x0F, 0x4F, 0x00,
-    0x07, 0xC3, 0xD0, 0x03, 0xD0, 0xB8, 0x02, 0xF0, 0x0F, 0xEB, 0xE0, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x02, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xFA, 0x5B, 0xF0,
-    0x03, 0xC0, 0x07, 0xE0, 0x1E, 0x00, 0x0B, 0xC0, 0x30, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0xAA, 0xAB, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0xF8, 0x2D, 0x00, 0x0F, 0xC0, 0xFC, 0x01, 0xFD,
-    0x01, 0xFF, 0xBF, 0xC0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x02,
-    0xF0, 0xBC, 0x03, 0xF0, 0xFC, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x07, 0xFF, 0xF0, 0x0F, 0x00, 0xF8, 0x08, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x55, 0xBC,
-    0x00, 0xFF, 0xFC, 0x00, 0x50, 0xB8, 0x00, 0x00, 0xF4, 0x20, 0x01, 0xF0, 0xB4, 0x03, 0xD0, 0xBE,
-    0x6F, 0x80, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x50, 0x05, 0x55, 0x2F, 0xFF, 0x02, 0xFF, 0xE0, 0x7F, 0x40, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x7C,
-    0x00, 0x1F, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0xBC,
-    0x0B, 0x40, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x02, 0xEB, 0x40, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x28, 0x7C, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C,
-    0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0,
-    0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x2E, 0x40, 0x00, 0x00, 0x00, 0x07, 0x80, 0xB0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0x83,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x05, 0x55, 0x2F,
-    0xFF, 0x02, 0xFF, 0xE0, 0x7F, 0x40, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0F,
-    0x40, 0x00, 0xF4, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x07,
-    0xC1, 0xE0, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x02, 0xEB, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x28, 0x7C,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x20, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0x01, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C,
-    0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0,
-    0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x1C, 0x00, 0x00, 0xBE,
-    0x0B, 0xD0, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0xD0, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x05, 0x55, 0x2F, 0xFF, 0x02, 0xFF, 0xE0, 0x7F, 0x40, 0x07,
-    0xE0, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x01, 0xE0, 0x00, 0x0F,
-    0x80, 0x3C, 0x00, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x00, 0x3D, 0x3C, 0x00,
-    0x00, 0x02, 0xEB, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x28, 0x7C, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x0D, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x03, 0x82,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00,
-    0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0,
-    0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3,
-    0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x02, 0xD0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x02, 0xF0,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x01, 0x55, 0x47, 0xFF,
-    0xC0, 0xFF, 0xF4, 0x2F, 0x40, 0x0B, 0xD0, 0x0B, 0xC0, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0xF4, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x03, 0xE0, 0x02, 0xF0,
-    0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x7F, 0x90, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x24, 0x09, 0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0x83,
-    0xE0, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0xB3, 0xFE, 0x00,
-    0x7C, 0x0B, 0x80, 0x2E, 0x02, 0xD0, 0x0F, 0x40, 0xF0, 0x03, 0xC0, 0x3C, 0x03, 0xF0, 0x0F, 0xDB,
-    0xF8, 0x01, 0xFF, 0xBD, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC1, 0x00, 0x01, 0xF3, 0xC0, 0x00,
-    0xBF, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x1F, 0xAA, 0xBE, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2C,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xFA, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0xBF, 0xFE,
-    0x03, 0x80, 0x7C, 0x04, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0B, 0xD0,
-    0x00, 0xBC, 0x00, 0x03, 0xD0, 0x08, 0x0F, 0x40, 0xF0, 0x3F, 0xAF, 0x80, 0x7F, 0xDD, 0x00, 0x00,
-    0x38, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x7C, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x74, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00,
-    0x01, 0x55, 0x40, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x1F,
-    0xFF, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0xEB, 0xFD, 0x00, 0xF0, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x7C,
-    0x00, 0x00, 0xF4, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0x3C, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x1F, 0x00,
-    0x1F, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x7C, 0x00,
-    0x06, 0xFF, 0xBF, 0xD0, 0xBF, 0x90, 0x07, 0xFF, 0xFE, 0x40, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0xF8,
-    0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x00, 0x03, 0x83, 0xFE, 0x00, 0x00, 0x78, 0x02, 0xD0, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x00, 0xF4,
-    0x03, 0xC0, 0x00, 0x0F, 0x00, 0x7F, 0xFE, 0x01, 0xF0, 0x0B, 0xEA, 0xF8, 0x2E, 0x00, 0xF0, 0x0B,
-    0xC3, 0xD0, 0x0F, 0x00, 0x7C, 0x3C, 0x00, 0xF0, 0x0B, 0x83, 0xC1, 0x0F, 0x00, 0xF0, 0x7C, 0xE0,
-    0xF9, 0xBD, 0x0B, 0xFC, 0x03, 0xFF, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x55, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xAA, 0xBE, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x2F, 0x00,
-    0x2D, 0x00, 0x2E, 0x00, 0x2C, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x05, 0xBD, 0x54,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFE, 0x00, 0xBF, 0xFE, 0x03, 0x80, 0x7C, 0x04, 0x01, 0xF0, 0x08, 0x0F, 0x40, 0x3E, 0xF4,
-    0x00, 0x7F, 0x00, 0x0B, 0xEE, 0x00, 0xBC, 0x14, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x74, 0x3F, 0xEF,
-    0xE0, 0x3F, 0xF7, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x70, 0x00, 0x47, 0xC0, 0x03, 0xFC, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x15, 0x54, 0x05, 0x54, 0x00, 0xFF, 0xF8, 0x2F, 0xFD, 0x00, 0x2F, 0x80, 0x07,
-    0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0xB8, 0x00,
-    0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xCB, 0xC0, 0x00, 0x00, 0x0F,
-    0x03, 0xD0, 0x00, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00,
-    0xBC, 0x00, 0x1F, 0xE4, 0x00, 0x7C, 0x00, 0xFF, 0xFC, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xD0, 0xB4, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB8,
-    0x00, 0xFC, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0x3E, 0x0F, 0x44, 0x00, 0x1F, 0x2D, 0x00, 0x00, 0x0F,
-    0xB8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1E,
-    0xF0, 0x00, 0x00, 0x78, 0xF4, 0x00, 0x10, 0xF0, 0xBC, 0x00, 0x3F, 0xC0, 0x3C, 0x00, 0x3F, 0x40,
-    0x3D, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x38,
-    0x3C, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x15, 0x54, 0x05, 0x54, 0x00,
-    0xFF, 0xF8, 0x2F, 0xFD, 0x00, 0x2F, 0x80, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x07,
-    0xD0, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x2A, 0xBF, 0xAA, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xCB, 0xC0, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x02, 0xF0, 0x00,
-    0x00, 0xF4, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x1F, 0xE4, 0x01, 0xFF, 0x80, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00, 0xFC, 0x0B, 0xFC, 0x03, 0xFC,
-    0x00, 0x3E, 0x0F, 0x44, 0x00, 0x1F, 0x2D, 0x00, 0x00, 0x0F, 0xB8, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x78, 0xF4, 0x00,
-    0x10, 0xF0, 0xBC, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x03, 0x0C, 0x2F, 0x80,
-    0xF0, 0x3F, 0xC1, 0x94, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90,
-    0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xD0, 0x00, 0x38, 0x55, 0x5E, 0xEA, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x1C, 0x00, 0xB5, 0x55, 0xFA, 0xAB, 0x34, 0x03, 0x0A, 0x03, 0x02, 0x43, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x55, 0x54,
-    0xFF, 0xFD, 0xAA, 0xA8, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFE,
-    0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x54, 0x14, 0x05, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x68, 0x0A, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x02, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x0F, 0x02,
-    0xD0, 0x3C, 0x0B, 0xC0, 0xBD, 0x07, 0xC0, 0x02, 0x80, 0xBD, 0x07, 0xD0, 0x7C, 0x0B, 0x80, 0xF0,
-    0x2C, 0x02, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xE0, 0x3D, 0x07, 0xC0, 0xB8, 0x0F, 0x03, 0xC0, 0x10,
-    0x00, 0x14, 0x1F, 0x4F, 0xC2, 0xE0, 0x7C, 0x0F, 0x01, 0xD0, 0x2C, 0x00, 0x40, 0x10, 0x0E, 0x03,
-    0x80, 0xF0, 0x3C, 0x0B, 0x42, 0xD0, 0x3C, 0x0F, 0x02, 0xF0, 0xBC, 0x0B, 0xD2, 0xF4, 0x1F, 0x07,
-    0xC0, 0x01, 0x40, 0x50, 0x2F, 0x4B, 0xD0, 0x7D, 0x1F, 0x41, 0xF0, 0x7C, 0x0B, 0x82, 0xE0, 0x3C,
-    0x0F, 0x02, 0xD0, 0xB4, 0x0D, 0x03, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x7E, 0x1F, 0x80,
-    0xF4, 0x3D, 0x07, 0xC1, 0xF0, 0x2E, 0x0B, 0x80, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0x10, 0x04, 0x00,
-    0x14, 0x05, 0x07, 0xD1, 0xF4, 0xFC, 0x3F, 0x0B, 0x82, 0xE0, 0x7C, 0x1F, 0x03, 0xC0, 0xF0, 0x1D,
-    0x07, 0x40, 0xB0, 0x2C, 0x00, 0x19, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00,
-    0x38, 0x01, 0xFE, 0xFF, 0xDB, 0xFF, 0xBF, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00,
-    0x1E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00,
-    0x0E, 0x00, 0x1F, 0xEF, 0xFD, 0x2F, 0xFE, 0xFC, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xB4, 0x00, 0x54, 0xB0, 0x60, 0xFF, 0xFF, 0xF0, 0xE9, 0xE6, 0xE0,
-    0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0x47, 0xFC, 0xBF, 0xCB, 0xFC, 0x3F, 0x00, 0x00, 0x24, 0x00, 0x1F, 0xD0, 0x07, 0xFF, 0x41, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xDF, 0xFF, 0x87, 0xFE, 0x01, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x2E, 0x1F, 0xC3,
-    0xF0, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0xBE, 0x07, 0xFB, 0xC0, 0x7D, 0x10, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x07, 0xCB, 0xE0, 0x03, 0xF0, 0x03, 0xF6, 0xF0,
-    0x00, 0xF4, 0x00, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x19, 0x0F, 0xC7, 0xF0, 0xB4, 0x00,
-    0x00, 0x00, 0xD0, 0x00, 0x38, 0x40, 0x5E, 0xD0, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x01, 0xFA, 0x07, 0x34, 0x03, 0x0A, 0x03, 0x02, 0x43, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00,
-    0x00, 0x02, 0x80, 0x0B, 0xE0, 0x29, 0xA8, 0x61, 0x89, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x01,
-    0x04, 0x00, 0x0A, 0x34, 0x00, 0x0A, 0x38, 0x15, 0x5E, 0x28, 0xEA, 0xBC, 0x73, 0x01, 0xC7, 0x0C,
-    0x1C, 0x70, 0x30, 0x86, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x1C, 0xA0, 0x02, 0xCA, 0x00, 0x2C, 0xB5, 0x54, 0xD3, 0xEA, 0xB0, 0xD3,
-    0x40, 0xC0, 0xA3, 0x43, 0x00, 0x92, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x87, 0xC0, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0x02, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x2C, 0x02, 0xD0, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x02, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0xC0, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x03, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x03, 0xC0, 0xBF,
-    0x40, 0x0F, 0xF0, 0x3E, 0x7D, 0x0F, 0x03, 0xD7, 0xC0, 0x7D, 0xBC, 0x0F, 0xF4, 0x2D, 0x0F, 0x02,
-    0xD0, 0xF0, 0x2C, 0x00, 0x00, 0x78, 0x1D, 0x01, 0xD2, 0xD0, 0x2D, 0x00, 0x00, 0xF0, 0x3C, 0x01,
-    0xD3, 0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x02, 0xC3, 0xC0, 0x3C, 0x00, 0x0B, 0x80, 0x3C, 0x03,
-    0xC3, 0x80, 0x3C, 0x00, 0x1F, 0x00, 0x3C, 0x0B, 0x43, 0xC0, 0xB4, 0x00, 0x3C, 0x00, 0x3D, 0x1F,
-    0x03, 0xD2, 0xE0, 0x00, 0xF4, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0xA0, 0x00, 0x01, 0x40,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xF8, 0x7C,
-    0x3E, 0x1F, 0x0B, 0x43, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x2D, 0x0F, 0x83, 0xD1, 0xF0,
-    0xBC, 0x3E, 0x0F, 0x87, 0xC1, 0xF0, 0xB4, 0x3D, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x0B, 0x43, 0xC0, 0xF8, 0x3D, 0x1F, 0x47, 0xC2, 0xF0, 0xBC, 0x3E, 0x0F, 0x83,
-    0xD1, 0xF0, 0x7C, 0x2F, 0x0B, 0x43, 0xD0, 0xF0, 0x38, 0x0E, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x3E, 0x02, 0xF0, 0x0F, 0x40, 0xBC, 0x03, 0xD0, 0x0D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x1E, 0x03, 0xE0, 0xBC, 0x0B, 0xC0, 0xF4, 0x0F, 0x42, 0xF0, 0x2F, 0x03, 0xD0, 0x3D,
-    0x07, 0xC0, 0x34, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x3C, 0x03,
-    0xE0, 0xBC, 0x0F, 0x40, 0xBC, 0x0F, 0x43, 0xF0, 0x0F, 0x42, 0xF0, 0x7D, 0x02, 0xF0, 0x3D, 0x0B,
-    0xC0, 0x3D, 0x07, 0xC0, 0xF0, 0x03, 0x40, 0xB0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x07, 0xE0, 0x00, 0x7D, 0xE0, 0x07, 0xC1, 0xE0, 0x7C, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0xF4, 0x03, 0xD0, 0x1F, 0x80, 0x3E, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00,
-    0xE0, 0x00, 0x00, 0x0A, 0x00, 0x0E, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0xFC, 0x0B, 0xD0, 0x7C, 0x07,
-    0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0C, 0x38, 0x02, 0x40,
-    0x38, 0x0E, 0x07, 0xC0, 0xE0, 0x03, 0x42, 0x43, 0x80, 0x01, 0xD0, 0x0F, 0x00, 0x00, 0x74, 0x2C,
-    0x00, 0x04, 0x1D, 0xB0, 0x00, 0x1F, 0x07, 0xC1, 0xF0, 0x1F, 0x0B, 0xC0, 0xF0, 0x00, 0x1C, 0xB0,
-    0x00, 0x00, 0x74, 0x2C, 0x00, 0x01, 0xD0, 0x0B, 0x00, 0x03, 0x43, 0x83, 0xC0, 0x0D, 0x07, 0xC0,
-    0xE0, 0x38, 0x02, 0x40, 0x38, 0xA0, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x50, 0x0F, 0x40, 0x3D, 0x01, 0xF0, 0x0B, 0xC0, 0x3E, 0x00, 0xF8, 0x03, 0xD0, 0x0F, 0x00, 0x3C,
-    0x01, 0xF0, 0x07, 0xC0, 0x2E, 0x00, 0xB4, 0x02, 0xD0, 0x0B, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
-    0x0E, 0x00, 0x38, 0x00, 0xE0, 0x07, 0x40, 0x1D, 0x00, 0x70, 0x01, 0xC0, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0xB0, 0x07, 0xE0, 0x1F, 0x40, 0x7C, 0x02, 0xF0, 0x01,
-    0x00, 0x04, 0x00, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x50, 0x55, 0x4F, 0xFD,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x3E,
-    0xBE, 0x03, 0xEB, 0xE1, 0x00, 0xF0, 0x10, 0x1F, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x01, 0xE0, 0x00,
-    0x2D, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x7C, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x07, 0xE4, 0x00, 0x7E, 0x40, 0x3F, 0x40, 0x03, 0xF4,
-    0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x28, 0x00, 0xBC, 0x00,
-    0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x0B, 0xE0, 0x00, 0x3D, 0x3F, 0xFC, 0x00, 0xBC, 0x3E, 0xBE, 0x00, 0xF8, 0x10, 0x0F, 0x00, 0xF4,
-    0x00, 0x0F, 0x01, 0xF0, 0x00, 0x1E, 0x02, 0xE0, 0x00, 0x7C, 0x02, 0xD0, 0x01, 0xF0, 0x03, 0xC0,
-    0x07, 0xC0, 0x03, 0xC0, 0x1F, 0x00, 0x03, 0x80, 0x3C, 0x00, 0x07, 0x40, 0x7E, 0x40, 0x07, 0x00,
-    0x3F, 0x40, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0B, 0x00,
-    0xBC, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x3D, 0x01, 0xB9, 0x00, 0x1F, 0x00, 0xFF, 0xD0, 0x0F, 0x80, 0x7E, 0xFC, 0x03, 0xD0, 0x00,
-    0x0B, 0x40, 0xF0, 0x00, 0x02, 0xD0, 0x7C, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0xB4, 0x0B, 0x00,
-    0x00, 0xB8, 0x03, 0xC0, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0xF8, 0x00, 0x38, 0x00, 0x78, 0x00, 0x1D,
-    0x00, 0x3E, 0x80, 0x07, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1D, 0x00, 0x1D, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xD0, 0x00, 0x40, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01, 0x81, 0xFB, 0xFD, 0x6F, 0x0E, 0x01, 0xBF, 0xF0,
-    0x10, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x42, 0xD0, 0xF0, 0x3C, 0x0F, 0x83,
-    0xD1, 0xF4, 0x7C, 0x1F, 0x0B, 0xC2, 0xF0, 0xFC, 0x3E, 0x0F, 0x83, 0xD1, 0xF4, 0x7C, 0x1F, 0x0B,
-    0xC2, 0xE0, 0xB4, 0x3D, 0x0F, 0x03, 0xC0, 0xE0, 0x38, 0x0D, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x64, 0x00, 0x3F, 0xF4, 0x0F, 0x4B, 0xC2, 0xD0, 0x3C, 0x3C, 0x03, 0xC7, 0x80, 0x3C,
-    0xB4, 0x07, 0x8F, 0x00, 0xB4, 0xF0, 0x0F, 0x0B, 0x42, 0xD0, 0x7F, 0xF8, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x0F, 0x80, 0x00, 0xFD, 0x00, 0x0F, 0xB0, 0x00, 0xF3, 0xC0, 0x0F, 0x0E, 0x00,
-    0xF0, 0x74, 0x0F, 0x96, 0xE4, 0x3F, 0xFF, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x40,
-    0x00, 0x55, 0x40, 0x2F, 0xFC, 0x03, 0xD5, 0x40, 0x74, 0x00, 0x0B, 0xD0, 0x00, 0x6F, 0xC0, 0x00,
-    0x2E, 0x00, 0x01, 0xF0, 0x00, 0x1E, 0x00, 0x07, 0xC0, 0x6B, 0xF0, 0x07, 0xE4, 0x00, 0x00, 0x05,
-    0x80, 0x07, 0xFD, 0x02, 0xF4, 0x00, 0xB8, 0x00, 0x0F, 0x50, 0x02, 0xFF, 0xD0, 0x3C, 0x0F, 0x07,
-    0x80, 0xB4, 0x78, 0x0B, 0x43, 0xC0, 0xF0, 0x2F, 0xBD, 0x00, 0xBE, 0x00, 0x05, 0x55, 0x0B, 0xFF,
-    0xE3, 0x95, 0xF4, 0xC0, 0x78, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x1E, 0x00, 0x0F, 0x00,
-    0x07, 0x80, 0x03, 0xC0, 0x00, 0xA0, 0x00, 0x00, 0x68, 0x00, 0xFF, 0xD0, 0xF0, 0x3C, 0x38, 0x0E,
-    0x0F, 0x0F, 0x01, 0xFF, 0x00, 0xFB, 0xC0, 0xF0, 0x78, 0xB4, 0x0F, 0x2D, 0x07, 0xC7, 0xEB, 0xC0,
-    0x7F, 0x80, 0x00, 0x19, 0x00, 0x1F, 0xFC, 0x03, 0xC2, 0xE0, 0xB0, 0x0F, 0x0F, 0x00, 0xF0, 0xF4,
-    0x0E, 0x07, 0xEB, 0xD0, 0x0A, 0xBC, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x1B, 0xF4, 0x03, 0xE4, 0x00,
-    0x05, 0x01, 0x03, 0xF5, 0xFC, 0x07, 0xB7, 0xC0, 0xBC, 0x3C, 0x0F, 0x47, 0x80, 0xF0, 0xB0, 0x1D,
-    0x0F, 0x12, 0xC0, 0xFD, 0x2C, 0x0F, 0x40, 0x01, 0xFE, 0x00, 0x7F, 0xF8, 0x1F, 0x07, 0xC3, 0xC0,
-    0x3C, 0x7C, 0x03, 0xCB, 0x40, 0x3C, 0xF0, 0x07, 0x8F, 0x00, 0xB4, 0xF0, 0x1F, 0x0B, 0x87, 0xC0,
-    0x3F, 0xF4, 0x00, 0x64, 0x00, 0x00, 0x00, 0x06, 0xC1, 0xFF, 0x01, 0x7C, 0x01, 0xE0, 0x0B, 0x40,
-    0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0xB8, 0x2F, 0xFC, 0x15, 0x40, 0x00, 0x7F, 0x80, 0x2F,
-    0xBE, 0x07, 0x81, 0xF0, 0x20, 0x1E, 0x00, 0x03, 0xD0, 0x00, 0xB4, 0x00, 0x3D, 0x00, 0x0F, 0x40,
-    0x07, 0xC0, 0x02, 0xF5, 0x54, 0x3F, 0xFF, 0xC0, 0x15, 0x40, 0x01, 0xFD, 0x02, 0xFB, 0xC0, 0xD0,
-    0xB0, 0x00, 0x3C, 0x00, 0x7D, 0x01, 0xFE, 0x00, 0x27, 0xD0, 0x00, 0x78, 0x00, 0x2D, 0x00, 0x6F,
-    0x0F, 0xFE, 0x01, 0xA4, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x2F, 0x40, 0x01, 0xFC, 0x00, 0x1D, 0xF0,
-    0x01, 0xD3, 0xC0, 0x1E, 0x0E, 0x01, 0xE0, 0x74, 0x0F, 0xFF, 0xFC, 0x2A, 0xAF, 0x90, 0x00, 0x38,
-    0x00, 0x01, 0xE0, 0x00, 0x01, 0x00, 0x01, 0xAA, 0x80, 0x3F, 0xFC, 0x03, 0x80, 0x00, 0x74, 0x00,
-    0x0B, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x1F, 0x80, 0xFF,
-    0xD0, 0x01, 0x50, 0x00, 0x00, 0x1B, 0xD0, 0x0F, 0xE4, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x1F, 0xA4,
-    0x03, 0xEB, 0xF0, 0x38, 0x0B, 0x47, 0x80, 0xB4, 0x38, 0x0B, 0x03, 0xD1, 0xE0, 0x1F, 0xF8, 0x00,
-    0x14, 0x00, 0x1A, 0xAA, 0x4F, 0xFF, 0xE3, 0x40, 0xF0, 0x80, 0xB0, 0x00, 0x74, 0x00, 0x38, 0x00,
-    0x3C, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x0B, 0x40, 0x03, 0xC0, 0x00, 0x50, 0x00, 0x01, 0xBE, 0x01,
-    0xE6, 0xE0, 0xF0, 0x3C, 0x38, 0x1E, 0x0B, 0x9E, 0x00, 0xFE, 0x01, 0xD3, 0xD1, 0xE0, 0x3C, 0xB0,
-    0x0F, 0x2E, 0x0B, 0x83, 0xFF, 0x80, 0x15, 0x00, 0x00, 0xBF, 0x40, 0x3E, 0xBC, 0x07, 0x81, 0xE0,
-    0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xB8, 0x1E, 0x02, 0xFF, 0xC0, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x1F,
-    0xC0, 0x3F, 0xE0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x6F,
-    0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x34, 0x00, 0x2E, 0x00, 0x10, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0A, 0xFA, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x07, 0xEB, 0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00,
-    0x03, 0xD0, 0x0F, 0x00, 0x01, 0xF0, 0x01, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xEA, 0x90, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x01, 0xBD, 0x55, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x47, 0x80,
-    0x01, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xD6, 0xFF, 0xF8, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
-    0x5B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0xB0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xB8,
-    0x1E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x02, 0xE5, 0x00, 0x69, 0x00, 0xB8, 0x03, 0xE3, 0xFF,
-    0xF0, 0x3F, 0xF0, 0x0F, 0x96, 0xF8, 0x17, 0xD4, 0x0F, 0x01, 0x00, 0xFF, 0xF8, 0x00, 0x78, 0x00,
-    0xF0, 0x00, 0x1F, 0x40, 0x00, 0x07, 0x40, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x3F,
-    0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0,
-    0x3D, 0x00, 0x00, 0x1E, 0x0E, 0x70, 0x2C, 0x1F, 0xE8, 0x00, 0x01, 0xFB, 0xCB, 0xDB, 0x8B, 0xFF,
-    0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xAF, 0xC0, 0x00, 0xBD, 0x00, 0x78,
-    0x00, 0x1F, 0x00, 0x07, 0x40, 0x03, 0xD0, 0x00, 0x10, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x6F, 0xAA,
-    0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02,
-    0xBF, 0xAA, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x01, 0xD0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x3D, 0x55, 0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xE3, 0xD0, 0x00, 0x05, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xDD, 0xF0, 0x3C, 0x70, 0xF0, 0x81, 0xD1, 0x80, 0x07,
-    0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00,
-    0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x6A, 0xA9, 0x55, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xE1, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00,
-    0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00,
-    0x01, 0xD0, 0x00, 0x07, 0x40, 0x0D, 0x1D, 0x2C, 0x2D, 0x71, 0xE0, 0x2E, 0xEE, 0x00, 0x2F, 0xE0,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x74, 0x00, 0x78, 0x00,
-    0xB4, 0x07, 0x80, 0x00, 0xB4, 0x7D, 0x55, 0x55, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xC0, 0x00, 0x0F,
-    0x03, 0xC0, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x07, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0xF4, 0x07, 0xDD, 0xF4, 0x3C, 0x74, 0xF0, 0x41, 0xD0,
-    0x40, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x09, 0x1D,
-    0x18, 0x3C, 0x74, 0xF0, 0x3D, 0xDF, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x20, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xDD, 0xF0, 0x3C, 0x74, 0xF0, 0x41, 0xD0, 0x40,
-    0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x41, 0xD0, 0x43, 0xC7, 0x4F, 0x03, 0xDD, 0xF0,
-    0x03, 0xFF, 0x00, 0x03, 0xF0, 0x01, 0x5B, 0x95, 0x2F, 0xFF, 0xFE, 0x15, 0x55, 0x50, 0x00, 0x00,
-    0x50, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xC0, 0x00,
-    0x0B, 0x00, 0x3C, 0x2C, 0x03, 0xC0, 0xB0, 0x3C, 0x02, 0xC3, 0xE5, 0x5B, 0x1F, 0xFF, 0xFC, 0x2E,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01,
-    0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x03, 0x80, 0x00,
-    0x0E, 0x0F, 0x00, 0x38, 0x0F, 0x00, 0xE0, 0x0F, 0x03, 0x95, 0x6F, 0x0F, 0xFF, 0xFD, 0x00, 0x02,
-    0xE0, 0x00, 0x1E, 0x00, 0x02, 0xE0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0xF0, 0x04, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x0F, 0x40, 0x03, 0xCF, 0x40, 0x00, 0xFB,
-    0xEA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFE, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x15, 0x03, 0xFF,
-    0xFF, 0xFE, 0x3E, 0xAA, 0xAA, 0xA6, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF,
-    0xFE, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x03, 0xF0, 0x00, 0x3C, 0xF0, 0x07, 0xE2, 0xF4, 0x7B, 0x8B, 0xB5, 0xCE, 0x2C, 0xD0, 0x38, 0xB0,
-    0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x00, 0x0E, 0x2C, 0x00, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B,
-    0x00, 0x0E, 0x2C, 0x00, 0x14, 0x50, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x50,
-    0x00, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x6A, 0xAA, 0xAA, 0xF0, 0x00, 0x00, 0x01, 0xE7, 0xFF, 0xFF,
-    0xFF, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x03, 0x8B, 0x00, 0x0E, 0x2C, 0x00, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x00, 0x0E,
-    0x2C, 0x00, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x02, 0xCE, 0x2C, 0xE3, 0xF8, 0xBF, 0x03,
-    0xE2, 0xF0, 0x03, 0xDF, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x18, 0x00, 0x0B,
-    0x80, 0xB8, 0x00, 0xB4, 0x00, 0xB8, 0x0B, 0xFF, 0xFF, 0xF8, 0x7A, 0xAA, 0xAA, 0xB7, 0xC0, 0x00,
-    0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x07, 0x80, 0x0B, 0x40, 0x07, 0x80, 0xB4,
-    0x00, 0x04, 0x00, 0x40, 0x00, 0x14, 0x00, 0x00, 0x05, 0x1F, 0x80, 0x00, 0x03, 0xD3, 0xF0, 0x00,
-    0x02, 0xF0, 0xBD, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0xF0, 0x00,
-    0x0F, 0xC0, 0xB8, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x0B, 0xCB, 0x40,
-    0x00, 0x00, 0xF7, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x2E, 0x5F, 0xD0,
-    0x04, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x6E, 0x7E,
-    0x00, 0xBF, 0xFF, 0x80, 0xF8, 0x07, 0xE0, 0xB8, 0x00, 0xF8, 0x3C, 0x00, 0x3D, 0x2E, 0x00, 0x0F,
-    0x0F, 0x40, 0x07, 0xC3, 0xD0, 0x02, 0xE0, 0xF4, 0x00, 0xF0, 0x3D, 0x00, 0xB8, 0x0F, 0xC0, 0x7C,
-    0x01, 0xFE, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x53, 0xFF, 0xFF,
-    0xFB, 0xAA, 0xAF, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2F, 0x7A, 0xAA, 0xFD, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA4, 0x01, 0xC0, 0x02, 0xFF, 0xFF, 0x4F, 0x00, 0x3F, 0xE5, 0xBF, 0xF0,
-    0x03, 0xF4, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0xF4, 0x00, 0x0F, 0x7D, 0x0B, 0xC0,
-    0x00, 0xF4, 0xB8, 0x3E, 0x00, 0x0F, 0x41, 0xF0, 0xF4, 0x00, 0xF4, 0x07, 0xC3, 0xD0, 0x0F, 0x80,
-    0x1F, 0x0F, 0x40, 0xB8, 0x00, 0x7C, 0x3E, 0x0B, 0x80, 0x02, 0xF0, 0xBC, 0xB8, 0x00, 0x0F, 0x81,
-    0xFB, 0x80, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x7F, 0xFE,
-    0xBF, 0xE0, 0x07, 0xC2, 0xFF, 0xFD, 0x00, 0x08, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0x7C, 0x00,
-    0x00, 0x2D, 0x3D, 0x00, 0x00, 0x3C, 0x2F, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0xB4, 0x0F, 0x80,
-    0x00, 0xF0, 0x0B, 0xC0, 0x02, 0xE0, 0x07, 0xD0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x02, 0xF0,
-    0x0F, 0x40, 0x01, 0xF4, 0x0F, 0x00, 0x00, 0xF8, 0x2E, 0x00, 0x00, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x05, 0x55, 0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0x55, 0x6B,
-    0xF0, 0xBD, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x2E, 0x00, 0x7D, 0x00,
-    0x0F, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x0F,
-    0xC0, 0xB8, 0x00, 0x01, 0xF4, 0x3C, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x0B, 0xCB, 0x40, 0x00,
-    0x00, 0xF7, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x1F, 0xFA,
-    0xAA, 0xA0, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xD0, 0x55, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x05, 0x7D, 0x40, 0x01, 0xFF, 0xFF, 0xF4, 0x07,
-    0xFE, 0xAF, 0xA8, 0x07, 0xF0, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00,
-    0xF8, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0xAA, 0xAF, 0xEA, 0x87, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xF4, 0x16, 0xE5, 0x54, 0x3D, 0x00, 0xB4, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x01, 0xF0, 0x1E,
-    0x00, 0x00, 0x3F, 0x0B, 0x40, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x55, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xEA, 0xAA, 0xA0, 0x7E, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xEA, 0xAA, 0xAF, 0xD1, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x90, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x02, 0xAA, 0xAB, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x2A, 0xAA,
-    0xAA, 0xAF, 0x0F, 0xFF, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0,
-    0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x05, 0xF5, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0xAB, 0xEA, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xF4, 0x00, 0x2D,
-    0x00, 0x2F, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0xBC, 0x00, 0x2D, 0x00, 0x0F, 0x0A,
-    0xAF, 0xEA, 0xAB, 0xC3, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x6E, 0x50, 0x7C, 0x00, 0x07, 0x80, 0x1F,
-    0x00, 0x00, 0xF0, 0x0B, 0xC0, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x07, 0x83, 0xF0, 0x00, 0x00, 0xFB,
-    0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02,
-    0xAA, 0xAA, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07,
-    0xC1, 0xFE, 0xAA, 0xAA, 0xF0, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1B, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA, 0xAB,
-    0xF4, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x6F, 0xF8, 0x01, 0xBF, 0xE3, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x05, 0x55, 0x55, 0x50,
-    0xBF, 0xFF, 0xFF, 0xD2, 0xFE, 0xAA, 0xAF, 0x43, 0xF4, 0x00, 0x2E, 0x07, 0xF0, 0x00, 0x38, 0x0B,
-    0xE0, 0x00, 0x80, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x14, 0x1F, 0x00, 0x00, 0xF0,
-    0xF4, 0x00, 0x07, 0xCF, 0xD5, 0x55, 0xBE, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0x40, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x02, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x38,
-    0x00, 0x03, 0xC0, 0x00, 0x1D, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0,
-    0x00, 0x2D, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x24, 0x38, 0x24,
-    0x7E, 0x39, 0xFC, 0x0B, 0xFF, 0xD0, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x3F, 0x39, 0xF8, 0x34,
-    0x38, 0x28, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0xFF, 0x42,
-    0xE5, 0xF4, 0xF0, 0x1E, 0x78, 0x03, 0xCE, 0x00, 0xE3, 0xD0, 0xB4, 0x7F, 0xF8, 0x01, 0xA0, 0x00,
-    0x14, 0xFD, 0xFD, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0xAA, 0x80, 0x0B, 0x40,
-    0xFF, 0xC0, 0x0F, 0x00, 0x57, 0xD0, 0x1F, 0x00, 0x03, 0xE0, 0x2D, 0x00, 0x01, 0xF0, 0x3C, 0x00,
-    0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF8, 0xB8, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xD1, 0xFF, 0xE2, 0xE0, 0xF0, 0x2E,
-    0xD0, 0x38, 0x03, 0xE0, 0x0E, 0x00, 0xB8, 0x03, 0xC0, 0x7B, 0x40, 0xBE, 0xF8, 0xF8, 0x0B, 0xF4,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x2F, 0xFC, 0x3F, 0xF8, 0x38, 0x0F, 0xF0,
-    0x3C, 0x74, 0x07, 0xC0, 0x2C, 0x74, 0x07, 0xC0, 0x2C, 0x78, 0x0E, 0xF0, 0x3C, 0x3E, 0xBC, 0x7E,
-    0xF4, 0x0F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x3D, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x53, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF,
-    0x7D, 0xF7, 0xDF, 0x7D, 0xF6, 0x80, 0x14, 0x04, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E,
-    0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E,
-    0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E,
-    0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x28, 0x19, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00,
-    0x07, 0xCB, 0x80, 0x00, 0x02, 0xD1, 0xF0, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x78, 0x0B, 0x80,
-    0x00, 0x3D, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x0B, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x00,
-    0xF0, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x00, 0xF4, 0x2F, 0x00,
-    0x00, 0x2F, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x14, 0x00, 0x00, 0x05, 0x0F, 0x80, 0x00, 0x07, 0xC1,
-    0xF0, 0x00, 0x02, 0xE0, 0x3D, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x3D,
-    0x00, 0x3D, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x0B, 0x80, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x2D, 0x01,
-    0xF0, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x2E, 0x1F, 0x00, 0x00, 0x03,
-    0xCF, 0x40, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x56, 0xFC, 0x0B,
-    0xC0, 0x00, 0xF8, 0x3D, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00,
-    0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D,
-    0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD0, 0x14, 0x00, 0x00, 0x51, 0xF0, 0x00, 0x03, 0xD7,
-    0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0,
-    0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00,
-    0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2F,
-    0x0B, 0xD0, 0x01, 0xF8, 0x0B, 0xFA, 0xBF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xF4, 0x24, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x10, 0x2E, 0x00,
-    0x07, 0xC7, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x01, 0xFC, 0xFD,
-    0x00, 0x01, 0xFC, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0xFE,
-    0x00, 0x01, 0xFC, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x07, 0x83, 0xF1, 0xF8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0B,
-    0xD3, 0xF4, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x01, 0xFC,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x01, 0xFC, 0x10, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01, 0x81, 0xFB, 0xFD, 0x6F, 0x0E, 0x01, 0xBF, 0xF0, 0x10,
-    0x00, 0x15, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xC3, 0xE5, 0xFF, 0xBD, 0x0D, 0x00,
-    0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x0A, 0x40, 0x04, 0x3F, 0xF4, 0x2D, 0xB9, 0xBF, 0xFC, 0xB0, 0x1F, 0xF4,
-    0x00, 0x00, 0x40, 0x2F, 0xE0, 0x1D, 0x7F, 0xFE, 0x7C, 0xF0, 0x2F, 0xF8, 0x10, 0x02, 0x90, 0x24,
-    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xC0, 0x6B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x03, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x18, 0x00, 0x00, 0x40,
-    0x00, 0x07, 0x42, 0xAA, 0xBE, 0x9F, 0xFF, 0xFF, 0x00, 0x2D, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x00,
-    0x1F, 0xFF, 0xFF, 0x2B, 0xEA, 0xA8, 0x2C, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x50, 0xFF,
-    0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0xE0, 0x02,
-    0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xD0, 0x06, 0xFD, 0x00, 0x3F, 0xD0,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x80, 0x00, 0x2F, 0xC0, 0x0B, 0xF0,
-    0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0x07,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x00,
-    0x07, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0x80, 0x00, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x00,
-    0x01, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x2F, 0xD0, 0x0B, 0xF4, 0x00,
-    0xBF, 0x40, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x57, 0xD5, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xEA, 0xFA, 0xA0, 0x3F, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x2E, 0x00,
-    0x0F, 0x40, 0x0F, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xF0, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0xF4,
-    0x00, 0x0F, 0x80, 0x3C, 0x00, 0x02, 0xF0, 0x1E, 0x00, 0x00, 0x3F, 0x4F, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1B, 0xFF, 0xFF, 0xD0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x15, 0x55, 0xB8,
-    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xBF, 0xFF, 0x40, 0x00, 0x07, 0x83, 0xF0, 0x00, 0x03,
-    0xC0, 0x3E, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x00,
-    0x0F, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x0B, 0xC0, 0x02, 0xD0, 0x03, 0xE0, 0x00, 0xF0, 0x07, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x55, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xEA, 0xAA, 0xA0, 0x3F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x1B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x50, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0x47, 0x47, 0xD0, 0x01, 0xE0, 0x1D, 0x02, 0xD0, 0x0E, 0x00, 0x74, 0x02, 0xC0,
-    0xB0, 0x01, 0xD0, 0x03, 0x83, 0x80, 0x07, 0x40, 0x0B, 0x1C, 0x00, 0x1D, 0x00, 0x1D, 0x75, 0x55,
-    0xB9, 0x55, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x40, 0x07, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x00,
-    0x1D, 0x38, 0x00, 0x74, 0x00, 0xB0, 0xB0, 0x01, 0xD0, 0x03, 0x80, 0xE0, 0x07, 0x40, 0x3C, 0x01,
-    0xE0, 0x1D, 0x03, 0xD0, 0x01, 0xF8, 0x74, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x07,
-    0xD0, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x0E, 0x00, 0x00, 0x02, 0xC0, 0xB0, 0x00, 0x00, 0x03, 0x83,
-    0x80, 0x00, 0x00, 0x0B, 0x1C, 0x00, 0x00, 0x00, 0x1D, 0x75, 0x55, 0x55, 0x55, 0x76, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE7, 0x40, 0x00, 0x00, 0x07, 0x5D, 0x00, 0x00, 0x00, 0x1D, 0x38, 0x00, 0x00, 0x00,
-    0xB0, 0xB0, 0x00, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x00, 0x3C, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x01,
-    0xF8, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x03,
-    0xD0, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xB2, 0xE0, 0x02, 0xD3, 0x83, 0x82, 0xE0, 0x2D, 0x0B, 0x1C,
-    0x02, 0xE2, 0xD0, 0x1D, 0x70, 0x02, 0xFD, 0x00, 0x36, 0xC0, 0x03, 0xF0, 0x00, 0xE7, 0x00, 0x2E,
-    0xE0, 0x03, 0x5D, 0x02, 0xD2, 0xE0, 0x1D, 0x38, 0x2D, 0x02, 0xE0, 0xB0, 0xB2, 0xD0, 0x02, 0xE3,
-    0x80, 0xFD, 0x00, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x0E, 0x00, 0x00, 0x2F,
-    0xC0, 0xB0, 0x00, 0x02, 0xD3, 0x83, 0x80, 0x00, 0x2D, 0x0B, 0x1D, 0x00, 0x02, 0xD0, 0x1D, 0x70,
-    0x00, 0x2D, 0x00, 0x36, 0xC0, 0x02, 0xD0, 0x00, 0xE7, 0x00, 0x2D, 0x00, 0x03, 0x5D, 0x02, 0xD0,
-    0x00, 0x1D, 0x38, 0x2D, 0x00, 0x00, 0xB0, 0xB2, 0xD0, 0x00, 0x03, 0x80, 0xFD, 0x00, 0x00, 0x3C,
-    0x01, 0xF0, 0x00, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x05, 0x56, 0xE5, 0x54,
-    0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xE0, 0x10, 0xBD, 0xFE, 0xBC, 0x04, 0x00, 0x04, 0x00,
-    0x05, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B, 0xDB, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0xF4, 0x00, 0xF8, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x74, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7D, 0x04, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0xFF,
-    0xE0, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x2F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x87, 0xF8, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFE, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xE2, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xD2, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_12_italicBitmaps[27992] = {
+    0x55, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0x27, 0xF1, 0x4A, 0x59, 0x9C, 0x49, 0x91,
+    0x20, 0x50, 0x72, 0xD9, 0x14, 0x20, 0x45, 0x28, 0xE7, 0x6B, 0x52, 0x58, 0xE2, 0x7E, 0x6C, 0x92,
+    0x92, 0xC6, 0x45, 0x0C, 0xA5, 0x69, 0x81, 0xC2, 0x29, 0x5C, 0x1C, 0xD2, 0x3A, 0xB7, 0x28, 0x45,
+    0x8A, 0x34, 0x11, 0xFF, 0x00, 0x0D, 0x05, 0x71, 0x1A, 0x17, 0x2E, 0x0E, 0x71, 0xF1, 0x0D, 0xE4,
+    0x0F, 0x60, 0x00, 0xA1, 0x74, 0xB0, 0x51, 0x4C, 0x45, 0x91, 0x09, 0x5A, 0x94, 0xB5, 0xD9, 0xDC,
+    0xF0, 0xBD, 0xBD, 0x0B, 0x21, 0xE3, 0x3B, 0xDF, 0xCE, 0xCC, 0x9B, 0x37, 0xDF, 0xFB, 0xDE, 0xF7,
+    0xDE, 0xE2, 0xB4, 0xB2, 0x09, 0x2A, 0x65, 0x35, 0xB2, 0xD0, 0xC6, 0xE8, 0xA2, 0x50, 0x79, 0x0B,
+    0x37, 0xC0, 0xD1, 0x0A, 0xAA, 0xC8, 0x1C, 0xC3, 0x89, 0x28, 0xBE, 0xFD, 0xF0, 0xE7, 0xC2, 0xED,
+    0xAD, 0x76, 0x97, 0x4F, 0x46, 0xEA, 0x4A, 0x9A, 0xE2, 0x64, 0x68, 0xB0, 0xAC, 0x72, 0xB4, 0x54,
+    0x8A, 0x4B, 0x31, 0xB4, 0xF7, 0xF5, 0xF1, 0x6F, 0x37, 0xAE, 0x63, 0x6B, 0x19, 0xD8, 0x3D, 0x07,
+    0xB8, 0x4B, 0x38, 0xF3, 0xF7, 0xF6, 0xDA, 0xC8, 0xFB, 0x22, 0x34, 0x5B, 0x50, 0x66, 0x17, 0x2A,
+    0x77, 0x88, 0xD2, 0x82, 0x6E, 0x69, 0x23, 0xFE, 0xE9, 0x02, 0x9B, 0x29, 0x3A, 0xDE, 0x86, 0x8F,
+    0x7F, 0x37, 0x3A, 0xD6, 0x69, 0xB6, 0xDA, 0x0D, 0x9C, 0x85, 0x7A, 0x0E, 0xC4, 0x35, 0x10, 0xBD,
+    0x00, 0x14, 0xBF, 0xAD, 0x1A, 0xE9, 0x6E, 0xA5, 0xD5, 0xAD, 0xA2, 0xB7, 0xAC, 0xF3, 0xFA, 0xC6,
+    0x24, 0xF0, 0x4F, 0x2D, 0xA6, 0x15, 0xB0, 0x0A, 0x04, 0xF4, 0xA2, 0xE9, 0xB0, 0xCB, 0xEF, 0x5D,
+    0x2C, 0x46, 0xC0, 0xC3, 0x08, 0x7C, 0x0A, 0x87, 0x71, 0x86, 0x1E, 0x74, 0x68, 0xE2, 0x3C, 0x34,
+    0xED, 0xC0, 0xA1, 0x1B, 0x9A, 0x2E, 0xB1, 0x74, 0xE3, 0x14, 0x43, 0xF5, 0x45, 0x41, 0x68, 0xAE,
+    0x1B, 0x97, 0xFD, 0x6D, 0xAD, 0x1E, 0x19, 0x7F, 0xD5, 0xBA, 0x36, 0x30, 0x6C, 0x05, 0x16, 0x5A,
+    0x99, 0x16, 0x37, 0x69, 0x8E, 0x31, 0x7F, 0x90, 0x80, 0x47, 0x94, 0x51, 0x3F, 0x39, 0x94, 0xD0,
+    0x15, 0x4E, 0x00, 0xA7, 0xF1, 0xDA, 0xE8, 0x48, 0x6C, 0xFD, 0x09, 0xFF, 0xB5, 0xE9, 0x5C, 0xEE,
+    0x24, 0x0A, 0xDE, 0x80, 0xF0, 0xB1, 0xC3, 0x29, 0x7C, 0x57, 0xE0, 0x1C, 0x06, 0x39, 0x36, 0x31,
+    0xCA, 0xCF, 0xCE, 0xF0, 0xB9, 0x1B, 0x94, 0x58, 0xED, 0x9D, 0xDF, 0x42, 0x37, 0x32, 0x97, 0x18,
+    0x42, 0xA5, 0x09, 0x4B, 0xDF, 0x21, 0xE6, 0xC0, 0xE7, 0xE8, 0xA3, 0x63, 0x10, 0xCD, 0xFC, 0x0C,
+    0x18, 0xCD, 0xF4, 0xA1, 0xF8, 0x1F, 0x15, 0xF3, 0x7B, 0x4E, 0xAC, 0xF4, 0xBA, 0xAB, 0x97, 0x6F,
+    0xAC, 0x01, 0x17, 0x10, 0x1B, 0x54, 0xD0, 0x29, 0x21, 0xC5, 0x39, 0x32, 0xE2, 0xC5, 0x79, 0x70,
+    0x32, 0xFF, 0x1D, 0x23, 0xB4, 0x20, 0x94, 0xB6, 0x3C, 0x32, 0x74, 0xAE, 0x72, 0x46, 0xB2, 0xB8,
+    0xD0, 0x6B, 0x18, 0xBB, 0x20, 0x1F, 0xEE, 0xF0, 0x43, 0x53, 0xD9, 0xCF, 0x65, 0x9F, 0x3B, 0x7B,
+    0x08, 0x0B, 0x99, 0xAD, 0xC8, 0x23, 0x37, 0xB8, 0x3A, 0x5C, 0xB8, 0x75, 0xE2, 0x65, 0x2C, 0x9B,
+    0x63, 0xB9, 0xFA, 0xE3, 0x06, 0x54, 0x5B, 0xDD, 0x09, 0xFE, 0xC9, 0xA3, 0xA7, 0x57, 0x8F, 0x1E,
+    0xFD, 0x86, 0x2F, 0x0D, 0x76, 0x9B, 0xE4, 0xB8, 0xF9, 0xD1, 0x33, 0xDB, 0xEB, 0xDE, 0x3F, 0xFB,
+    0xE8, 0xD7, 0x74, 0xEE, 0x9B, 0xAB, 0xB9, 0x50, 0xA5, 0xDC, 0x8A, 0xB2, 0xC3, 0x24, 0xE2, 0x64,
+    0xFD, 0xBA, 0x7F, 0xB1, 0xF3, 0x0D, 0x56, 0x46, 0xDB, 0xA7, 0x98, 0xBD, 0xA2, 0x31, 0x13, 0x12,
+    0x5D, 0x83, 0x54, 0x2C, 0x5C, 0x03, 0x9B, 0xEE, 0x18, 0x9E, 0xA0, 0x90, 0xA7, 0x71, 0x93, 0x7A,
+    0x22, 0x27, 0xB6, 0xE6, 0x69, 0x7E, 0x70, 0x3E, 0x98, 0x9D, 0xC4, 0x23, 0x9C, 0x79, 0x0C, 0xF0,
+    0x20, 0x74, 0xE4, 0x37, 0x55, 0x6E, 0x02, 0xFD, 0xD0, 0xA2, 0xDF, 0x01, 0xAA, 0x1A, 0xEA, 0x97,
+    0x02, 0x09, 0x23, 0xA8, 0x7B, 0x50, 0xB6, 0x44, 0x47, 0x15, 0x81, 0xD3, 0xB6, 0x93, 0x26, 0xBE,
+    0x44, 0x32, 0xFB, 0x2F, 0xAF, 0xC1, 0x24, 0xF4, 0x66, 0xB0, 0xA0, 0x39, 0x01, 0x5D, 0xF5, 0x69,
+    0xCF, 0x8B, 0x22, 0x03, 0xFA, 0xCB, 0x9B, 0xD5, 0xB3, 0xB3, 0x98, 0xA7, 0x98, 0x66, 0x4C, 0x4B,
+    0x4C, 0xA7, 0x36, 0xC9, 0x47, 0xCA, 0x2A, 0xF7, 0x16, 0x2F, 0x87, 0x22, 0x2C, 0xCA, 0xB9, 0x93,
+    0x22, 0xB6, 0x08, 0x69, 0xF5, 0x00, 0xB2, 0x9C, 0xE4, 0xCD, 0xFC, 0x70, 0x7D, 0x6D, 0xEA, 0xFD,
+    0x07, 0xAC, 0x14, 0x60, 0x8D, 0xA2, 0x75, 0x3C, 0x6E, 0x92, 0x74, 0x3B, 0x34, 0xCA, 0x1E, 0x63,
+    0x4E, 0xE5, 0x86, 0xA8, 0x40, 0x54, 0x22, 0xF2, 0x16, 0xEF, 0x4E, 0x09, 0x88, 0x2E, 0x92, 0x54,
+    0x80, 0x60, 0x9F, 0xB2, 0x30, 0x9F, 0xF9, 0x42, 0xF9, 0xE2, 0x25, 0xDC, 0xB4, 0xF1, 0x1C, 0xB0,
+    0x6E, 0x12, 0x1A, 0x3C, 0x27, 0xFF, 0x1B, 0xE4, 0x8C, 0xA9, 0xBA, 0x66, 0x51, 0x6A, 0x7A, 0xCB,
+    0x50, 0x85, 0x85, 0xCE, 0x75, 0xCE, 0x6B, 0x9F, 0x79, 0x4F, 0xB1, 0x51, 0x45, 0x92, 0x68, 0x61,
+    0x56, 0x68, 0xE5, 0x88, 0x7C, 0x8D, 0xA9, 0x37, 0x0C, 0x99, 0xD2, 0x90, 0x3D, 0xC5, 0x3D, 0x72,
+    0x10, 0x6C, 0x72, 0xDA, 0xC9, 0x9B, 0x78, 0xE4, 0xD4, 0xA4, 0x81, 0xA7, 0x28, 0x9F, 0x1A, 0xF7,
+    0x3D, 0xE2, 0x59, 0xFA, 0x0A, 0x46, 0xE0, 0x0D, 0x46, 0x07, 0x88, 0xCB, 0x06, 0x26, 0x43, 0xC5,
+    0x4D, 0xFA, 0x39, 0xFA, 0x9A, 0x69, 0xA9, 0x50, 0x2D, 0x55, 0xC2, 0x4F, 0x42, 0x2F, 0x19, 0x3A,
+    0xBC, 0x64, 0x12, 0x59, 0xF6, 0x20, 0x33, 0x40, 0xF2, 0xA7, 0xFB, 0x3F, 0xFB, 0x91, 0xF7, 0x4F,
+    0xBC, 0xAF, 0x68, 0x30, 0x44, 0x76, 0x4E, 0xF8, 0xA0, 0x20, 0xFA, 0x04, 0xC1, 0xF8, 0x20, 0x39,
+    0xD1, 0x46, 0x90, 0x90, 0x63, 0xA2, 0x60, 0x31, 0x08, 0xA4, 0x95, 0xA6, 0x03, 0x60, 0xCE, 0x67,
+    0x81, 0xFD, 0x4D, 0xD3, 0x41, 0xC6, 0xEB, 0x4C, 0x8F, 0x3F, 0x85, 0x4E, 0x3B, 0xB7, 0xD9, 0x3E,
+    0x28, 0xE3, 0x19, 0xA2, 0x27, 0x55, 0xE0, 0x62, 0xDB, 0xC3, 0x20, 0x36, 0xA2, 0x8E, 0x7E, 0x2C,
+    0x18, 0x9E, 0xBA, 0xA6, 0xBB, 0x2C, 0x5C, 0x60, 0x54, 0x23, 0x3A, 0xAA, 0x71, 0x33, 0xA8, 0x54,
+    0x11, 0x3A, 0x9D, 0xBE, 0x82, 0x5C, 0xD0, 0xDB, 0xC1, 0x46, 0xAA, 0xC9, 0xD6, 0xD2, 0x7D, 0xDB,
+    0x64, 0x55, 0x50, 0xF0, 0x27, 0x76, 0x78, 0x73, 0x06, 0xA9, 0x64, 0x34, 0x94, 0xAC, 0x49, 0x68,
+    0xEE, 0x55, 0xB3, 0x08, 0x8B, 0xC4, 0x6C, 0xCB, 0xD6, 0x71, 0x06, 0xA0, 0xA4, 0xA7, 0xBC, 0x36,
+    0xFA, 0x5C, 0xA5, 0x9A, 0x4B, 0x0A, 0x3B, 0x13, 0x71, 0x2F, 0xC6, 0x16, 0xA2, 0x0A, 0x23, 0xCB,
+    0xC6, 0xC8, 0x46, 0x42, 0x36, 0x93, 0x02, 0xC1, 0xAC, 0xE9, 0x3C, 0xE4, 0x1F, 0xEF, 0xD0, 0xE2,
+    0xBD, 0x9D, 0x7B, 0xDE, 0xBF, 0xBC, 0x27, 0xF0, 0xFE, 0xAF, 0x9D, 0x1D, 0xA9, 0xB5, 0xCB, 0x8C,
+    0x22, 0x45, 0x52, 0x36, 0x4D, 0x51, 0x4E, 0xD5, 0x8D, 0xA7, 0x3C, 0xAE, 0xC4, 0xD3, 0xC5, 0xC6,
+    0x3A, 0x2E, 0x06, 0x75, 0x7F, 0xFF, 0x14, 0x25, 0xC2, 0xFA, 0xCA, 0x02, 0x17, 0x19, 0xF6, 0x3C,
+    0xDC, 0x4C, 0x07, 0xE9, 0x31, 0xEE, 0x5E, 0x24, 0xB1, 0xB5, 0xE8, 0xFB, 0x65, 0xB7, 0x93, 0xD0,
+    0x12, 0x51, 0xAD, 0x3A, 0x44, 0xE4, 0x9A, 0xDC, 0xDA, 0x88, 0x1C, 0x44, 0x64, 0x79, 0xFF, 0xA2,
+    0x0E, 0xAD, 0xF6, 0xB6, 0xAD, 0x51, 0x26, 0xD8, 0xDB, 0x8B, 0xF2, 0xAE, 0x7A, 0x68, 0xBA, 0x81,
+    0xD5, 0x1A, 0x2E, 0xC6, 0x70, 0x28, 0x0B, 0xDF, 0x17, 0x2B, 0xEC, 0x00, 0x51, 0x9E, 0xBD, 0xFF,
+    0x83, 0x3B, 0x1F, 0xF8, 0x1F, 0x67, 0x7C, 0x01, 0x55, 0xC9, 0xDD, 0x39, 0x15, 0x61, 0x13, 0x83,
+    0x90, 0x49, 0x79, 0x1D, 0x5E, 0xD9, 0xE4, 0x4A, 0x53, 0x21, 0xF8, 0x74, 0xD1, 0xE4, 0xA5, 0xED,
+    0x88, 0x02, 0x31, 0x20, 0x89, 0x4A, 0xF4, 0xD2, 0x62, 0x3B, 0xC0, 0x33, 0x9E, 0x88, 0xAE, 0x71,
+    0xBD, 0x4B, 0x69, 0x84, 0x4C, 0x2C, 0xA3, 0xE1, 0xFA, 0xE1, 0x87, 0x4E, 0x94, 0x64, 0xD0, 0x5B,
+    0xDF, 0x4C, 0x49, 0x6C, 0x4F, 0xDA, 0x45, 0xC5, 0x1D, 0xE5, 0xE2, 0x03, 0x24, 0x07, 0xDE, 0x29,
+    0xB2, 0xB6, 0x74, 0x4F, 0x28, 0x2B, 0x82, 0xAF, 0xAE, 0x56, 0x14, 0xD7, 0x84, 0x1A, 0xCB, 0xA8,
+    0x25, 0x79, 0x81, 0x54, 0x7C, 0x6F, 0x38, 0x8C, 0x18, 0xF3, 0xFE, 0xB4, 0x60, 0xFD, 0x94, 0x44,
+    0x59, 0xC9, 0xDB, 0x85, 0x32, 0x60, 0x35, 0x05, 0x25, 0xD5, 0x55, 0x9C, 0x3D, 0x9A, 0xE6, 0x23,
+    0xBF, 0x10, 0x4E, 0xF0, 0x49, 0xCA, 0x0A, 0xB2, 0xFA, 0x8F, 0x69, 0x5E, 0xA3, 0x4D, 0x91, 0xEE,
+    0x66, 0x08, 0x6F, 0x15, 0x8D, 0x6A, 0x45, 0xA3, 0xD2, 0x14, 0x58, 0x3A, 0x22, 0x65, 0x29, 0x26,
+    0x89, 0x97, 0x55, 0xFE, 0x86, 0x2E, 0x97, 0x1C, 0xDF, 0xA6, 0x88, 0x59, 0xEB, 0xCD, 0x38, 0x7E,
+    0x2F, 0x85, 0x92, 0xD0, 0xDF, 0x2E, 0x37, 0xD8, 0x02, 0x0C, 0xA9, 0xEE, 0x88, 0xE5, 0x58, 0x74,
+    0x63, 0xF9, 0xCC, 0x40, 0x32, 0xFE, 0x85, 0x8E, 0x2E, 0x62, 0xA3, 0xE5, 0xD5, 0xD1, 0x93, 0x52,
+    0x96, 0x19, 0x3B, 0xD4, 0x36, 0x4D, 0x78, 0x57, 0xC5, 0x1A, 0x24, 0x3E, 0xCB, 0xF8, 0x0E, 0x5E,
+    0x53, 0xDA, 0xBF, 0x85, 0x55, 0x3D, 0x6F, 0xE4, 0x54, 0x14, 0x3D, 0xB6, 0x95, 0xB5, 0xB4, 0x46,
+    0x7A, 0x55, 0x0A, 0x18, 0xC8, 0xE3, 0x07, 0x90, 0x31, 0x05, 0xC5, 0x16, 0x33, 0xB1, 0x15, 0x44,
+    0xB5, 0x0D, 0x48, 0xB1, 0x90, 0xF8, 0x07, 0x2B, 0x8A, 0x6D, 0xB7, 0xF0, 0x66, 0x2C, 0x1A, 0xDA,
+    0x14, 0xB4, 0x88, 0x9A, 0xA1, 0x58, 0x84, 0xB2, 0xD2, 0x14, 0x93, 0xCC, 0xD3, 0xB6, 0x29, 0xE2,
+    0x65, 0x0B, 0x5A, 0x0B, 0x85, 0x6A, 0x05, 0x3C, 0xC0, 0x48, 0x9E, 0xE0, 0xCC, 0xE3, 0xDC, 0xE7,
+    0x04, 0x16, 0xC4, 0xC7, 0x8C, 0x9C, 0x8F, 0xE7, 0xF7, 0xEE, 0x39, 0xF7, 0xDC, 0x73, 0xEF, 0x43,
+    0x51, 0x14, 0xC8, 0x9C, 0x33, 0xC1, 0xE5, 0xDC, 0xA2, 0xC4, 0x1D, 0xA4, 0x78, 0x09, 0x49, 0x05,
+    0x44, 0x35, 0x00, 0xCB, 0xE7, 0x70, 0x5E, 0x21, 0x75, 0x0D, 0xD4, 0x8B, 0x8B, 0x25, 0x5E, 0xE5,
+    0x4E, 0xC5, 0xC5, 0xB8, 0x1A, 0x39, 0x57, 0x6B, 0xE7, 0xB8, 0x5C, 0x14, 0x07, 0x70, 0xAE, 0x87,
+    0x9E, 0x2F, 0xA1, 0x7D, 0xAC, 0xB7, 0x30, 0xE6, 0xEE, 0xE9, 0xF5, 0x73, 0x38, 0xCF, 0xB1, 0x72,
+    0x39, 0x3A, 0xFE, 0xDD, 0x0E, 0x91, 0x02, 0x3E, 0x21, 0x9F, 0xA8, 0x01, 0x46, 0x6B, 0x60, 0xE6,
+    0xB8, 0x1E, 0xDC, 0xCB, 0x09, 0xD9, 0x63, 0xF3, 0x41, 0x1F, 0x59, 0x4C, 0x94, 0xC1, 0x1D, 0x0D,
+    0xBC, 0xB9, 0xE7, 0x81, 0x81, 0x25, 0x9F, 0xCE, 0x3F, 0xD9, 0x55, 0x87, 0x5B, 0x5D, 0xCF, 0x48,
+    0x4B, 0x46, 0x9A, 0x21, 0x6C, 0x32, 0x13, 0x35, 0x8A, 0x84, 0x02, 0xB7, 0x81, 0xFF, 0x14, 0x07,
+    0x41, 0x91, 0x2B, 0x97, 0xCF, 0xAE, 0xA0, 0x2B, 0x9C, 0x08, 0x60, 0x62, 0xC8, 0x8C, 0xA7, 0x43,
+    0x26, 0x95, 0x0B, 0x31, 0x2B, 0x89, 0x69, 0x01, 0x67, 0x16, 0x89, 0x93, 0xA3, 0x9D, 0x2C, 0xF1,
+    0x6D, 0x29, 0x6F, 0x79, 0x80, 0x6F, 0x17, 0x42, 0x94, 0x4B, 0x7B, 0x42, 0x7E, 0xD4, 0x61, 0x76,
+    0x14, 0xBB, 0x3A, 0x75, 0x02, 0x11, 0xB9, 0x26, 0xE8, 0x10, 0xFB, 0xB8, 0x8B, 0x3F, 0x4E, 0xCA,
+    0xF6, 0x6A, 0x88, 0x1F, 0x5F, 0x43, 0x8E, 0xBA, 0xC0, 0xB5, 0x9E, 0x15, 0xE0, 0x98, 0x03, 0x29,
+    0xC9, 0x5E, 0x09, 0x2F, 0x1B, 0xFE, 0xA2, 0xD6, 0x8B, 0xA9, 0xFE, 0x83, 0x5A, 0x91, 0x81, 0x84,
+    0xF5, 0x8C, 0x4E, 0x81, 0x8C, 0xDB, 0x6E, 0x1F, 0x49, 0xE8, 0x77, 0xB7, 0x59, 0x85, 0x36, 0x63,
+    0x19, 0x2A, 0x25, 0x69, 0x91, 0x6F, 0x1A, 0x30, 0xC0, 0x38, 0x66, 0xF5, 0xA6, 0x82, 0x32, 0x95,
+    0xB0, 0x33, 0xC6, 0xC0, 0x4A, 0x7E, 0xAC, 0x25, 0x7A, 0x2B, 0x6B, 0x36, 0x13, 0x0C, 0x92, 0x0A,
+    0x6D, 0xD2, 0x10, 0x25, 0xEA, 0xA4, 0x28, 0x0E, 0xB3, 0x0D, 0x32, 0x73, 0xA3, 0x27, 0x98, 0x2D,
+    0x98, 0xAE, 0x47, 0x97, 0x70, 0x8B, 0xC1, 0x18, 0x92, 0x47, 0x39, 0xF0, 0x13, 0xAF, 0x4C, 0x07,
+    0xCA, 0xDC, 0x54, 0xA7, 0x48, 0x98, 0x45, 0x49, 0xA3, 0x3C, 0x75, 0x8E, 0x82, 0x6D, 0x1D, 0x20,
+    0x28, 0x10, 0x3B, 0x04, 0x8E, 0xBA, 0xD4, 0xA0, 0x25, 0x54, 0x8B, 0x95, 0x41, 0xF4, 0x03, 0xA6,
+    0x16, 0xC1, 0xF3, 0x6A, 0x97, 0x6C, 0x1E, 0x5B, 0x45, 0x39, 0x26, 0x65, 0x42, 0x3B, 0xEE, 0xA8,
+    0xE8, 0xA3, 0x06, 0xC9, 0xDB, 0xCF, 0x4C, 0xCB, 0xC4, 0xD7, 0x8D, 0x88, 0x3A, 0xB6, 0x44, 0x5C,
+    0xC4, 0x2D, 0xB1, 0xA7, 0xE8, 0x89, 0xA5, 0xF8, 0x7B, 0x82, 0xB8, 0xBA, 0xCD, 0xA4, 0x63, 0xE6,
+    0xA4, 0x2F, 0x14, 0xC1, 0x7C, 0x85, 0x88, 0x97, 0x67, 0x34, 0x45, 0x13, 0x76, 0xE2, 0x6E, 0x3A,
+    0xA5, 0x46, 0xDA, 0xC8, 0x99, 0x25, 0x8F, 0x44, 0xE7, 0xD5, 0x0E, 0xF0, 0xB3, 0x4D, 0x72, 0x3C,
+    0x98, 0x32, 0xDC, 0x6E, 0x62, 0x24, 0x5A, 0xCB, 0x37, 0x66, 0x6F, 0x87, 0x8A, 0xC4, 0x67, 0x7C,
+    0x83, 0xDF, 0x0C, 0x76, 0xA1, 0xE5, 0x4D, 0xD4, 0x23, 0xB9, 0xC0, 0x21, 0xB4, 0xF3, 0x59, 0x0F,
+    0x9F, 0x7B, 0x4C, 0x96, 0x35, 0x55, 0xDF, 0xDD, 0x37, 0xCA, 0x04, 0x1D, 0x5D, 0x9B, 0x31, 0xF9,
+    0xF8, 0x19, 0x25, 0xFE, 0xD5, 0x0E, 0xA2, 0xAB, 0x43, 0xEE, 0x39, 0xA7, 0xBC, 0xBF, 0x70, 0xB1,
+    0xA3, 0x84, 0x25, 0x05, 0xDF, 0x63, 0x5D, 0x52, 0x5C, 0x91, 0x94, 0xBA, 0x24, 0xD7, 0xD5, 0xFA,
+    0x3A, 0xDE, 0xD6, 0xE7, 0xD4, 0x87, 0xC6, 0xFA, 0x6C, 0xBF, 0x63, 0x42, 0x25, 0xF7, 0x4C, 0xE9,
+    0x8F, 0x29, 0xBF, 0x25, 0x39, 0x53, 0x4F, 0xF6, 0xC6, 0xC9, 0xA3, 0x0A, 0x6E, 0xFD, 0x7F, 0xDD,
+    0x84, 0x81, 0x99, 0xA7, 0x06, 0xE1, 0x06, 0x21, 0x27, 0xA5, 0x89, 0xD9, 0x2E, 0x08, 0x5A, 0x39,
+    0x37, 0x15, 0xB3, 0xA9, 0x7C, 0x4F, 0x4A, 0xA6, 0xC4, 0x01, 0x12, 0xA4, 0x13, 0xF7, 0x09, 0x34,
+    0x5D, 0x44, 0x9A, 0x64, 0x2B, 0x3C, 0x49, 0x54, 0xBA, 0x4B, 0x42, 0x22, 0x11, 0x68, 0x29, 0x22,
+    0x81, 0xDC, 0x91, 0x47, 0xDA, 0xD0, 0x17, 0x89, 0x13, 0x67, 0x6D, 0xE5, 0x92, 0x05, 0x69, 0x74,
+    0x78, 0xB9, 0xBD, 0x9F, 0x7B, 0xCA, 0x29, 0xE3, 0x25, 0x95, 0xA6, 0x65, 0x88, 0x62, 0xD9, 0x5A,
+    0xA5, 0x66, 0xFE, 0xAE, 0x82, 0xFA, 0x31, 0x47, 0xF4, 0x35, 0x99, 0x58, 0x56, 0xB7, 0xE4, 0x8B,
+    0x31, 0xC1, 0x55, 0xA5, 0xAB, 0xD1, 0x3A, 0xEC, 0xB5, 0xAB, 0xF4, 0xE0, 0xC0, 0x5B, 0x9F, 0x70,
+    0x77, 0x9D, 0xBE, 0xD3, 0x6A, 0xA9, 0x53, 0x12, 0xDA, 0x20, 0x3F, 0x21, 0x23, 0xA6, 0x21, 0x36,
+    0x22, 0xA5, 0x59, 0x85, 0xC8, 0xBE, 0x8E, 0x87, 0xAF, 0x41, 0xDD, 0xCD, 0xE3, 0x27, 0xCC, 0x63,
+    0xF5, 0x85, 0x65, 0xAB, 0xCA, 0xE1, 0xED, 0xA2, 0x78, 0x8F, 0x16, 0x7C, 0x3E, 0xDF, 0x3C, 0x2A,
+    0xA3, 0xFA, 0x0D, 0xAB, 0xF1, 0x55, 0xBE, 0x0C, 0x73, 0x4E, 0x02, 0x5F, 0xC8, 0xC9, 0x20, 0x21,
+    0xB1, 0xA5, 0x6B, 0x44, 0x55, 0xE9, 0x32, 0x3D, 0x34, 0x22, 0x05, 0x0D, 0x38, 0x94, 0xC0, 0xF6,
+    0x2A, 0xDE, 0x77, 0x46, 0x6F, 0x46, 0x35, 0x2D, 0xB0, 0x18, 0x12, 0x99, 0x40, 0x8C, 0xC9, 0x9D,
+    0x0F, 0xA8, 0x7F, 0x92, 0xD3, 0xB8, 0x56, 0xC6, 0x80, 0xEF, 0x7E, 0xEA, 0xBC, 0x23, 0xE3, 0xA0,
+    0x66, 0xDC, 0x09, 0xFF, 0x50, 0x55, 0x64, 0x45, 0x08, 0x09, 0xC6, 0xB1, 0x34, 0x7C, 0xB6, 0x0B,
+    0x76, 0xAE, 0xEB, 0x12, 0x67, 0x4E, 0x69, 0x5E, 0xF6, 0xAB, 0x92, 0xA6, 0x5A, 0xC8, 0x66, 0x43,
+    0x32, 0x63, 0xA1, 0x60, 0x59, 0x15, 0xD2, 0x8C, 0x0D, 0xDB, 0x4C, 0x49, 0xCB, 0x4D, 0x85, 0x5A,
+    0x2B, 0x45, 0xFF, 0x86, 0x1D, 0x97, 0x48, 0x0B, 0x6B, 0xD1, 0x3D, 0xC3, 0xF5, 0xCC, 0x18, 0x42,
+    0x73, 0xD8, 0x04, 0xC5, 0x5D, 0x67, 0x76, 0x30, 0xEB, 0x75, 0x2D, 0xB6, 0xA1, 0xB2, 0xB4, 0x5B,
+    0xAE, 0xAA, 0xC4, 0x32, 0xE1, 0x8E, 0x2D, 0x3E, 0x25, 0xD2, 0xD8, 0x12, 0x6B, 0x11, 0x9D, 0xE3,
+    0x98, 0x12, 0x1C, 0xB7, 0x8A, 0x98, 0x4A, 0xED, 0xD7, 0x88, 0x9F, 0xD4, 0xEC, 0x05, 0x94, 0x93,
+    0xE4, 0x63, 0xA2, 0x9F, 0xE5, 0x0B, 0x22, 0x4E, 0x6C, 0xFC, 0x29, 0xE5, 0xF9, 0x1E, 0x33, 0x2A,
+    0x94, 0x99, 0x98, 0xC2, 0x47, 0xAD, 0x07, 0xCE, 0xBC, 0xFD, 0xFE, 0x04, 0x67, 0xB7, 0xBB, 0x2E,
+    0xBD, 0x42, 0x5A, 0xC5, 0x1C, 0xB8, 0xE2, 0xAD, 0xB8, 0x1E, 0x8B, 0x47, 0x39, 0x37, 0xF0, 0x93,
+    0xDC, 0x26, 0x2B, 0x73, 0xC3, 0x79, 0xE6, 0x6D, 0xC4, 0x4A, 0x44, 0x67, 0xE6, 0x26, 0x47, 0x31,
+    0x74, 0xCB, 0x2F, 0x8B, 0xC4, 0x6B, 0xE5, 0x22, 0x70, 0x95, 0xEB, 0x13, 0x57, 0x6F, 0x73, 0xB0,
+    0x6B, 0xB7, 0xEF, 0x9E, 0xCA, 0x60, 0xE7, 0x84, 0xA9, 0xA2, 0x9A, 0x42, 0x2F, 0x99, 0x81, 0xE6,
+    0xB1, 0xE8, 0x5B, 0x72, 0x58, 0xCA, 0x28, 0x12, 0x75, 0xDA, 0xEB, 0x51, 0x2A, 0x45, 0x95, 0x3A,
+    0x4B, 0x55, 0x7D, 0xAF, 0x6C, 0xE8, 0x15, 0xB9, 0xB9, 0xE4, 0xEA, 0x62, 0xB3, 0xF5, 0xE1, 0xE5,
+    0xBC, 0x8F, 0x0C, 0xBD, 0x6F, 0xE2, 0x3A, 0xF0, 0x5B, 0xE5, 0x48, 0x3F, 0x74, 0x95, 0xD8, 0x42,
+    0x73, 0xE9, 0xE1, 0x30, 0x94, 0xA9, 0xE3, 0x97, 0xEC, 0x23, 0x9B, 0x92, 0x19, 0x6F, 0x8E, 0x5A,
+    0xAE, 0x51, 0x9F, 0xF2, 0x2B, 0x47, 0xE1, 0x95, 0x4C, 0x15, 0xC3, 0x99, 0xC1, 0x91, 0x22, 0x03,
+    0x23, 0x68, 0x38, 0x3A, 0x22, 0xF3, 0xAF, 0xAB, 0x71, 0x85, 0xD3, 0x9C, 0xAD, 0x34, 0x41, 0x28,
+    0x66, 0x91, 0x3B, 0x27, 0xE7, 0x05, 0x1A, 0xC9, 0xC4, 0xF1, 0x5B, 0x79, 0xC8, 0xFF, 0xC3, 0x23,
+    0xFC, 0xE7, 0x78, 0x38, 0x15, 0x34, 0x37, 0x68, 0xE1, 0x7F, 0x86, 0x66, 0x39, 0xF1, 0xB7, 0xD5,
+    0x0F, 0x2B, 0xDF, 0xB8, 0xBF, 0x03, 0x95, 0x55, 0x3D, 0x8F, 0xDC, 0x44, 0x18, 0x7E, 0xEC, 0x09,
+    0xE7, 0x80, 0x95, 0xCC, 0x41, 0x43, 0x44, 0xC2, 0x9A, 0x06, 0x29, 0x82, 0xEC, 0xBA, 0xA1, 0x88,
+    0x84, 0xBD, 0xB6, 0x00, 0x29, 0x05, 0x45, 0xF2, 0x07, 0x10, 0x3F, 0x00, 0x21, 0x28, 0x52, 0x2C,
+    0x92, 0x73, 0x6B, 0x25, 0x65, 0x0A, 0xF8, 0x1B, 0x50, 0x90, 0x48, 0x9C, 0x14, 0x17, 0x7B, 0xE7,
+    0xC9, 0xA5, 0x48, 0x71, 0x45, 0x46, 0x44, 0xA2, 0xA1, 0x88, 0xA3, 0x44, 0x04, 0x29, 0x42, 0x8C,
+    0x14, 0x47, 0x38, 0x8A, 0x77, 0x87, 0x67, 0xBC, 0x77, 0x17, 0x5A, 0x46, 0xF6, 0xCA, 0x3B, 0xF3,
+    0x7E, 0x3E, 0xEF, 0xF3, 0xBE, 0x83, 0x02, 0x58, 0x02, 0x16, 0xFE, 0x03, 0x88, 0xBB, 0x65, 0x70,
+    0x4D, 0x49, 0x5F, 0x47, 0x30, 0x63, 0xB4, 0x09, 0x66, 0x15, 0x92, 0x4D, 0x1C, 0xB3, 0xD6, 0xCE,
+    0xAD, 0xD5, 0x38, 0x11, 0xAA, 0x4E, 0xE6, 0x06, 0x6E, 0x9D, 0x7E, 0xA8, 0x63, 0x6B, 0xA2, 0x4F,
+    0x3A, 0x89, 0x54, 0x96, 0x52, 0xA8, 0xE0, 0x76, 0xE3, 0x37, 0xDB, 0x5E, 0x9B, 0xA2, 0x97, 0x79,
+    0x1D, 0x98, 0x5F, 0xEE, 0xD5, 0xAD, 0x95, 0x26, 0x1B, 0xA4, 0x37, 0xE1, 0x5B, 0xE0, 0x2B, 0x05,
+    0x8F, 0xDA, 0x15, 0x90, 0x02, 0x12, 0x08, 0xF6, 0x3A, 0xFF, 0xBE, 0xCD, 0x6F, 0xDD, 0x69, 0xA6,
+    0x6A, 0x21, 0x55, 0x1C, 0xE8, 0xF0, 0xAA, 0x11, 0xBA, 0x85, 0x49, 0x50, 0x44, 0x48, 0xC3, 0x72,
+    0x2A, 0x56, 0xBB, 0xDE, 0xCB, 0x25, 0x0E, 0x56, 0xD0, 0xFB, 0x56, 0x57, 0xA7, 0x46, 0x10, 0x0A,
+    0x05, 0xC2, 0x12, 0x2D, 0x64, 0x8E, 0x0E, 0x9F, 0xAB, 0xD9, 0xDC, 0xFA, 0x36, 0x1F, 0x84, 0xBC,
+    0x9C, 0x72, 0x83, 0x33, 0xCA, 0x38, 0x21, 0x4A, 0xD1, 0x9B, 0xFF, 0xC2, 0x78, 0x76, 0x85, 0x2B,
+    0xA1, 0x96, 0x48, 0xFC, 0x46, 0x28, 0xA6, 0x17, 0x94, 0x61, 0xC9, 0x90, 0x65, 0x9E, 0xA1, 0x0D,
+    0xCD, 0xC5, 0xBD, 0x7B, 0x09, 0x63, 0x16, 0xBD, 0x54, 0x07, 0xFE, 0xBC, 0x1A, 0x93, 0xDA, 0xD7,
+    0xC5, 0xC8, 0x33, 0x46, 0x5E, 0xB8, 0xDA, 0x4E, 0x6A, 0xD8, 0x1F, 0x84, 0xA6, 0xD3, 0x63, 0x99,
+    0x67, 0xE6, 0x36, 0xAF, 0x1B, 0xBC, 0x5A, 0x01, 0xE3, 0xF4, 0x5E, 0x32, 0xC1, 0xE4, 0x38, 0xFF,
+    0xD0, 0xAF, 0x73, 0xEC, 0xF2, 0x44, 0x48, 0xF0, 0x84, 0x65, 0x50, 0xD4, 0xE5, 0x31, 0x5F, 0xE1,
+    0x5C, 0x14, 0x58, 0xC7, 0x77, 0x24, 0xE7, 0xD0, 0x41, 0xC4, 0xD7, 0x77, 0x76, 0xD3, 0xFF, 0xCA,
+    0x31, 0x4F, 0xFF, 0x36, 0x8F, 0x33, 0x5A, 0xF1, 0x56, 0x47, 0x3E, 0xE3, 0x95, 0xC6, 0x56, 0x6D,
+    0x50, 0xD0, 0x5F, 0x4A, 0x75, 0x89, 0x19, 0x5C, 0x6A, 0x60, 0x1D, 0x10, 0xB9, 0x80, 0x68, 0xDB,
+    0x73, 0xD6, 0x16, 0x4E, 0xFA, 0x31, 0xB0, 0x5B, 0x2B, 0xAF, 0xF5, 0x7B, 0xFA, 0x8C, 0xF2, 0x94,
+    0x01, 0x49, 0x1D, 0x34, 0xB0, 0xB6, 0xC1, 0xC6, 0x2A, 0x77, 0x85, 0x42, 0x6C, 0xD6, 0xE0, 0xB9,
+    0x38, 0xAA, 0x75, 0x04, 0x2E, 0xB6, 0x59, 0xA4, 0xFD, 0x5F, 0x6D, 0x29, 0x27, 0x31, 0x52, 0x5D,
+    0x79, 0x4B, 0xA1, 0x43, 0x23, 0x11, 0x33, 0xB8, 0xCE, 0xA1, 0x29, 0xF3, 0x88, 0x5C, 0xA9, 0xF0,
+    0xEC, 0x8E, 0x0E, 0x96, 0x12, 0x87, 0x10, 0xFA, 0x26, 0x52, 0x57, 0x86, 0xAF, 0xD0, 0xCC, 0x95,
+    0x44, 0xE1, 0x37, 0x32, 0x2F, 0x7C, 0x23, 0xF3, 0xE4, 0xCD, 0x67, 0xFB, 0x7D, 0x54, 0x1E, 0xE4,
+    0x21, 0x1A, 0x78, 0xDD, 0x3A, 0xD3, 0xC3, 0x15, 0x1A, 0x84, 0xFD, 0x10, 0x46, 0xA0, 0x06, 0x40,
+    0xDA, 0x01, 0xBA, 0x68, 0xC0, 0xCC, 0x01, 0x69, 0x06, 0xF9, 0xC9, 0x80, 0x0D, 0x45, 0xB8, 0xF5,
+    0x87, 0xC1, 0x9C, 0x5A, 0x7A, 0x60, 0x9C, 0x6C, 0xF1, 0x4E, 0xEB, 0xA4, 0x08, 0x0B, 0xD5, 0x79,
+    0x2C, 0xF6, 0x3A, 0xF1, 0x60, 0x27, 0x68, 0xC7, 0xA1, 0x26, 0x67, 0x2B, 0x19, 0x98, 0xA8, 0xCE,
+    0xE3, 0x0E, 0x69, 0x81, 0x64, 0x4A, 0xC6, 0x95, 0xB3, 0xF0, 0xC5, 0xB6, 0x37, 0xB0, 0xED, 0xD2,
+    0xFC, 0xF6, 0x8D, 0x75, 0xB0, 0x89, 0x67, 0xC2, 0x92, 0xDD, 0x20, 0x54, 0x84, 0x8A, 0x70, 0xA1,
+    0x78, 0xEB, 0xC9, 0xF7, 0x7D, 0x7C, 0x18, 0xF8, 0xE9, 0x26, 0xCE, 0x77, 0xC3, 0x3E, 0x33, 0x56,
+    0x8D, 0xD2, 0xE2, 0xB9, 0x09, 0x17, 0x23, 0x93, 0x88, 0x3E, 0x34, 0x11, 0x96, 0xA2, 0x25, 0x83,
+    0xD1, 0x0B, 0xF6, 0x53, 0x0A, 0x5A, 0x89, 0x30, 0x23, 0x6A, 0xF9, 0x78, 0xD3, 0x10, 0xAF, 0xAF,
+    0x0B, 0x18, 0xB1, 0x9A, 0xB0, 0x5E, 0x47, 0xF4, 0xC6, 0x46, 0x17, 0x36, 0xF5, 0x1D, 0x8B, 0x59,
+    0xDB, 0x86, 0x0B, 0x09, 0xEB, 0x19, 0xA9, 0x27, 0xE8, 0x9C, 0x01, 0x52, 0x36, 0x50, 0x29, 0xAA,
+    0x4F, 0x95, 0xFC, 0xA2, 0x80, 0xBD, 0x5E, 0xCA, 0x23, 0xEA, 0x7D, 0xD3, 0xF8, 0xB6, 0x93, 0xAA,
+    0x60, 0x61, 0x52, 0x4C, 0x0B, 0xA4, 0x15, 0xD2, 0x16, 0x49, 0x8B, 0xAA, 0x83, 0x59, 0x88, 0x66,
+    0x7E, 0xA3, 0x8C, 0x8E, 0x7C, 0x78, 0xBB, 0x81, 0xF1, 0x57, 0x71, 0x8F, 0xD1, 0x6C, 0x81, 0x89,
+    0x4E, 0x91, 0x95, 0x09, 0x32, 0x02, 0x9B, 0x12, 0xCC, 0x82, 0x05, 0xAF, 0x88, 0x73, 0x4B, 0xBC,
+    0xDA, 0x40, 0x79, 0xB6, 0x86, 0xFF, 0x77, 0x07, 0x5F, 0xAF, 0x69, 0xE0, 0x5E, 0xC7, 0xEB, 0x98,
+    0xD6, 0x3E, 0xF8, 0x71, 0x6D, 0x2F, 0x1A, 0xE6, 0x40, 0xEC, 0x77, 0xCC, 0x51, 0xE6, 0x6E, 0x0E,
+    0xEC, 0x35, 0xBE, 0x6E, 0x0F, 0xE7, 0x80, 0x30, 0xB7, 0xCA, 0xFA, 0xB9, 0x96, 0x66, 0x7B, 0x28,
+    0x9E, 0x1C, 0x8A, 0xC9, 0x82, 0x84, 0x1C, 0x38, 0x3F, 0x39, 0x0C, 0x77, 0xC3, 0xFD, 0xBE, 0xF6,
+    0x9E, 0xFC, 0x19, 0x54, 0x98, 0x28, 0x42, 0x41, 0x22, 0x44, 0x39, 0xC9, 0xEA, 0xBA, 0xCC, 0xA9,
+    0x78, 0xEB, 0x34, 0x37, 0x96, 0xBE, 0x6D, 0x66, 0xAF, 0xCB, 0xE1, 0x88, 0xD4, 0x6D, 0x90, 0xE5,
+    0xE8, 0xDF, 0x0B, 0xF6, 0xCB, 0xED, 0xFA, 0xE7, 0xC3, 0xCE, 0x87, 0x28, 0xB1, 0x4D, 0xB5, 0x37,
+    0xEC, 0x23, 0xBB, 0x64, 0x0A, 0xE9, 0x7A, 0x4E, 0x30, 0xE4, 0xCA, 0x71, 0xC4, 0x9C, 0x92, 0x61,
+    0x69, 0x4D, 0xE8, 0xBA, 0x2D, 0x56, 0xC1, 0xF5, 0xDE, 0x15, 0x95, 0xF5, 0x74, 0x05, 0x1E, 0xF1,
+    0x7B, 0x3D, 0x18, 0x42, 0x95, 0x7A, 0x44, 0xFC, 0xE3, 0x32, 0x95, 0xDF, 0xDD, 0xB7, 0x77, 0xFB,
+    0xA8, 0x99, 0x1E, 0x12, 0x52, 0xCB, 0xFD, 0x9E, 0x84, 0x46, 0xE1, 0x44, 0xAB, 0xA0, 0x9C, 0x08,
+    0x1D, 0x28, 0x03, 0x63, 0x90, 0xCC, 0x20, 0x13, 0x08, 0xD2, 0x95, 0xCF, 0xB9, 0x57, 0x1C, 0xDE,
+    0x81, 0x09, 0x7E, 0xEF, 0x45, 0x23, 0xCB, 0x36, 0x54, 0x53, 0xA1, 0x63, 0xCE, 0x99, 0x72, 0x87,
+    0x54, 0x12, 0x2D, 0x9D, 0x45, 0xCD, 0x36, 0xCC, 0x3F, 0xD7, 0x94, 0xB8, 0x7B, 0x71, 0x4C, 0xFD,
+    0xA4, 0x61, 0x58, 0x1C, 0x93, 0x3B, 0x82, 0x84, 0xD5, 0xF2, 0x3F, 0xAD, 0xE0, 0x55, 0xE8, 0xC3,
+    0x9E, 0xE6, 0xA7, 0xF2, 0x33, 0x44, 0x63, 0xE2, 0x58, 0x0D, 0xFD, 0x31, 0xB4, 0x41, 0x48, 0x84,
+    0x46, 0xFC, 0x9E, 0xB5, 0xD8, 0x34, 0x0B, 0x64, 0x2A, 0x33, 0x59, 0x9E, 0x95, 0x47, 0xCA, 0x5B,
+    0xCC, 0xD0, 0x62, 0x0A, 0x59, 0x4E, 0x10, 0xAA, 0xF1, 0x30, 0x1E, 0x84, 0x4E, 0xE8, 0xE2, 0x32,
+    0xFB, 0x82, 0xED, 0xF1, 0x50, 0xC3, 0x7B, 0xC4, 0xD2, 0x3E, 0xA5, 0xA3, 0xBF, 0x30, 0xF4, 0xA1,
+    0x6F, 0xD6, 0xD5, 0x66, 0xB3, 0xBD, 0xCF, 0xC1, 0x91, 0xD1, 0xC5, 0x84, 0x18, 0x07, 0x8F, 0xCF,
+    0x48, 0x7B, 0x65, 0xFC, 0x65, 0x77, 0x8E, 0xE8, 0xB2, 0x90, 0x91, 0xEB, 0x40, 0x56, 0x93, 0xA2,
+    0x12, 0x9B, 0xD9, 0xA5, 0xF3, 0xD6, 0x76, 0xA6, 0x1E, 0x2E, 0x88, 0x0D, 0xCD, 0x19, 0xC3, 0x19,
+    0x4D, 0xD8, 0x5D, 0x21, 0x0D, 0x4E, 0xBA, 0x52, 0x8E, 0xA9, 0x45, 0x55, 0xEA, 0x6D, 0xAF, 0x8F,
+    0x22, 0x47, 0xAE, 0xC4, 0x95, 0x68, 0xE6, 0x7E, 0xB6, 0x72, 0xBF, 0x3B, 0x08, 0xBB, 0x09, 0xF2,
+    0x31, 0x3B, 0x44, 0x9D, 0xC4, 0x65, 0x07, 0x46, 0xE2, 0x36, 0xCE, 0xB9, 0x8D, 0x11, 0x37, 0x58,
+    0xB6, 0xC4, 0x6B, 0x68, 0x81, 0x61, 0x11, 0x16, 0xC2, 0xE0, 0xF2, 0x5A, 0x1B, 0x72, 0xFE, 0xE8,
+    0x6A, 0x04, 0x5E, 0x0C, 0xB2, 0xE4, 0x11, 0x5D, 0xE1, 0x30, 0x8A, 0xE1, 0x67, 0x8C, 0x0F, 0x55,
+    0x38, 0xF0, 0xEA, 0x35, 0x1C, 0xCB, 0xCC, 0xBB, 0xBB, 0xAB, 0x85, 0x89, 0x5B, 0x77, 0x71, 0xB8,
+    0x7C, 0xFA, 0x61, 0x1C, 0x03, 0xDF, 0xE2, 0x26, 0x1A, 0x34, 0x9E, 0xF6, 0xB5, 0x50, 0xE4, 0xB5,
+    0xE2, 0x35, 0xC7, 0x21, 0x37, 0xC5, 0xD9, 0x83, 0x00, 0xE1, 0x69, 0xF8, 0xCA, 0xF9, 0xA5, 0x93,
+    0xF9, 0x52, 0xD8, 0x95, 0xBC, 0x7E, 0x7C, 0x72, 0x12, 0xC9, 0x09, 0x54, 0x67, 0xD0, 0xF2, 0x39,
+    0x8B, 0xF6, 0x3C, 0x16, 0x1F, 0x1D, 0xDF, 0xBA, 0x59, 0xC5, 0xB6, 0x09, 0x39, 0x60, 0x09, 0xB5,
+    0x1A, 0x94, 0x4A, 0xF7, 0xF8, 0x83, 0x21, 0x07, 0x2C, 0x19, 0x1C, 0x3C, 0x75, 0x40, 0x16, 0x6E,
+    0x24, 0x13, 0x53, 0x6F, 0x18, 0xBE, 0xC3, 0x1D, 0x10, 0x51, 0xC2, 0x5A, 0x83, 0xB7, 0x9F, 0x5F,
+    0x5A, 0x5F, 0x15, 0x6E, 0x4A, 0x4E, 0xD6, 0x77, 0x02, 0x2E, 0x28, 0x2F, 0xCF, 0x78, 0x2A, 0x7F,
+    0xB3, 0x9D, 0x97, 0xE3, 0x7F, 0xAF, 0x7F, 0x01, 0xB5, 0x55, 0x3F, 0x8C, 0x14, 0x55, 0x18, 0xFF,
+    0xCD, 0x3C, 0x6E, 0x1F, 0xB9, 0x09, 0xFB, 0xAE, 0x50, 0x03, 0x0A, 0xBB, 0x16, 0x14, 0x84, 0xDC,
+    0xDE, 0x5A, 0x50, 0x8C, 0xC9, 0xFE, 0x19, 0xA1, 0xB0, 0x52, 0xAF, 0x60, 0xB1, 0xC0, 0x42, 0x13,
+    0x2A, 0x8D, 0x4A, 0x71, 0x31, 0x97, 0x78, 0xDE, 0x4D, 0xB8, 0x58, 0x11, 0xC9, 0x25, 0x86, 0xD6,
+    0x98, 0x68, 0x71, 0x42, 0xE1, 0x16, 0x57, 0x60, 0xC2, 0xB1, 0x0F, 0xAE, 0xA0, 0x20, 0x31, 0x83,
+    0x89, 0xB1, 0xB0, 0x99, 0x04, 0x08, 0x89, 0x8D, 0x0F, 0x18, 0xC8, 0x72, 0xEE, 0xED, 0xF3, 0xF7,
+    0xCD, 0x71, 0x8A, 0xDA, 0x99, 0xF0, 0x76, 0xBF, 0xB7, 0x3B, 0x6F, 0xE6, 0xFB, 0x7E, 0xDF, 0x9F,
+    0xDF, 0xF7, 0x0D, 0x00, 0x54, 0x80, 0x69, 0x7D, 0x76, 0x6B, 0x2D, 0x18, 0x0F, 0x2C, 0x5C, 0x94,
+    0x86, 0x99, 0x4E, 0x95, 0xD5, 0x89, 0xB2, 0x06, 0xCA, 0xCE, 0x20, 0x7A, 0x38, 0x46, 0x7B, 0x70,
+    0x37, 0x3D, 0xBD, 0x2B, 0x4C, 0xF1, 0x64, 0x35, 0xBD, 0xF2, 0xD7, 0xC7, 0x58, 0x4A, 0x3B, 0x30,
+    0x49, 0x64, 0xA3, 0x34, 0x70, 0xDA, 0xA2, 0xA3, 0x2C, 0xF4, 0x46, 0x86, 0xEE, 0x23, 0x9F, 0x54,
+    0x06, 0x9B, 0x29, 0x94, 0x03, 0x06, 0x7E, 0x88, 0x17, 0xC7, 0xAB, 0x40, 0x9D, 0x7A, 0x11, 0x2D,
+    0xA8, 0x9C, 0x98, 0xE3, 0x04, 0x91, 0xCF, 0x4B, 0x5B, 0xB9, 0x4E, 0x1A, 0x70, 0xCA, 0x56, 0x31,
+    0x17, 0xDA, 0xC9, 0x1D, 0x84, 0xAF, 0x95, 0xAD, 0xC9, 0x81, 0x41, 0x2B, 0xC8, 0xA3, 0x64, 0x1B,
+    0xD5, 0x05, 0x9B, 0x23, 0x6D, 0x5B, 0x26, 0x8D, 0x67, 0x2C, 0x62, 0x87, 0x78, 0x01, 0xB1, 0x49,
+    0x5A, 0x2A, 0xAB, 0x27, 0x4E, 0x67, 0xF3, 0xC1, 0x30, 0x46, 0x3B, 0x86, 0x89, 0xA7, 0x54, 0xD1,
+    0x57, 0x6E, 0xA8, 0xED, 0x95, 0xEF, 0x93, 0xE6, 0x50, 0x54, 0x77, 0x87, 0x66, 0xF9, 0xEE, 0xCD,
+    0x22, 0x99, 0x42, 0xF0, 0x1D, 0xC4, 0xA9, 0x0C, 0xF5, 0x24, 0xCC, 0xE1, 0x10, 0xE4, 0x06, 0xEF,
+    0x07, 0xD9, 0x9C, 0x19, 0x87, 0x1B, 0xD6, 0xC5, 0xFA, 0x4D, 0x9D, 0xCC, 0x56, 0x8F, 0x4C, 0x03,
+    0x71, 0xD6, 0x07, 0x1E, 0x1C, 0xB5, 0x50, 0xE7, 0x74, 0x8A, 0xEA, 0xB4, 0x39, 0x9F, 0xCE, 0xF1,
+    0x29, 0x65, 0x5D, 0x20, 0x0E, 0x83, 0xDA, 0x8F, 0xF1, 0x19, 0xB0, 0xE4, 0x19, 0xD4, 0xC4, 0x2C,
+    0xAD, 0xBE, 0x97, 0x2C, 0x15, 0xC6, 0x84, 0xD6, 0xB5, 0xF6, 0xA8, 0x33, 0x76, 0x7E, 0x61, 0x79,
+    0x6B, 0x34, 0x53, 0xE5, 0xF9, 0xE1, 0x8B, 0x86, 0xB1, 0x4E, 0x47, 0x68, 0x9B, 0x84, 0xDF, 0xC5,
+    0x7A, 0xDA, 0x31, 0xA9, 0xD9, 0x70, 0x28, 0xDA, 0x30, 0xCC, 0x59, 0x1E, 0x8B, 0x8B, 0xCF, 0xF7,
+    0x7A, 0xDE, 0xDF, 0xEB, 0xBD, 0x6D, 0x61, 0x80, 0x16, 0x88, 0x00, 0xF4, 0x8E, 0xFB, 0xAD, 0x0B,
+    0xAB, 0x98, 0x60, 0xE6, 0x7C, 0xAA, 0xD3, 0x3A, 0x6E, 0xCE, 0xC6, 0x87, 0x16, 0xB3, 0x8D, 0x63,
+    0xE7, 0xAA, 0xAF, 0xBC, 0x9A, 0x7D, 0xA3, 0x86, 0x91, 0xFC, 0x2C, 0xDF, 0x78, 0x63, 0xFF, 0xF1,
+    0x17, 0x6C, 0x9F, 0xF9, 0xBA, 0xB3, 0x2E, 0x01, 0x1E, 0xBE, 0x60, 0x18, 0x20, 0x30, 0x1B, 0xFA,
+    0x63, 0x77, 0xEE, 0xE5, 0xB5, 0x39, 0xF5, 0x55, 0x70, 0x2B, 0x73, 0x4B, 0x45, 0xB0, 0x02, 0x1C,
+    0x14, 0xD3, 0x6A, 0x1B, 0x25, 0xF0, 0xFE, 0xFE, 0xC5, 0xDF, 0xD2, 0x1D, 0x40, 0x9E, 0xCA, 0xE2,
+    0xE9, 0x5D, 0xEF, 0x2D, 0xF6, 0xA1, 0xBE, 0xA5, 0x7E, 0x72, 0xA7, 0x0D, 0xC2, 0x0C, 0x0B, 0x2C,
+    0x60, 0x94, 0xAA, 0x0C, 0x05, 0xBA, 0xFE, 0xDA, 0x85, 0x6F, 0x71, 0x2A, 0xF0, 0x36, 0x77, 0x53,
+    0xD3, 0xA8, 0xE1, 0x0A, 0x96, 0x2C, 0x2E, 0x61, 0x06, 0xF5, 0xCA, 0xE0, 0xE8, 0x98, 0x16, 0x5A,
+    0xE6, 0x9A, 0x5B, 0xF8, 0xAB, 0x96, 0xF3, 0xE8, 0xA3, 0x08, 0x1C, 0x9C, 0x24, 0x5C, 0x65, 0x01,
+    0x8B, 0x1D, 0xE6, 0xCA, 0xAA, 0x4C, 0x5B, 0x45, 0xEE, 0x90, 0x68, 0x89, 0xB6, 0xCD, 0x44, 0xE7,
+    0x9F, 0x7E, 0x1E, 0xF9, 0x5B, 0x5B, 0x66, 0x70, 0xA6, 0x90, 0xB4, 0xD5, 0x28, 0x33, 0x94, 0x06,
+    0xA5, 0x4D, 0x89, 0x77, 0xEC, 0x61, 0xE2, 0x38, 0xB4, 0x1F, 0xA3, 0xB9, 0x79, 0x1B, 0x83, 0x87,
+    0x36, 0xF0, 0xF7, 0xAD, 0xF2, 0x0F, 0xD2, 0x6D, 0xB9, 0x95, 0x28, 0xFF, 0x0B, 0x94, 0xBF, 0xC1,
+    0x30, 0x7E, 0x04, 0x3E, 0xA0, 0xA8, 0x2F, 0x28, 0xEF, 0x00, 0x9A, 0x55, 0x8D, 0x68, 0xA5, 0x7A,
+    0x04, 0xD8, 0xC3, 0xE2, 0x36, 0x32, 0xBC, 0x3B, 0x48, 0x30, 0x60, 0xAA, 0xF6, 0xD1, 0xEA, 0xDE,
+    0xF5, 0xD1, 0xDA, 0xE4, 0x6B, 0x23, 0x65, 0xD7, 0x3A, 0x01, 0xF0, 0x72, 0xF3, 0xEA, 0x00, 0xF3,
+    0xC2, 0xBD, 0x16, 0x9C, 0x4E, 0x1B, 0x95, 0xF1, 0xE1, 0x55, 0x3E, 0xD6, 0x2C, 0xF4, 0x32, 0x0B,
+    0x5C, 0x53, 0xD7, 0xB2, 0xF9, 0x03, 0x06, 0x7F, 0x64, 0xFA, 0x76, 0x59, 0xE1, 0xD7, 0x7D, 0x3E,
+    0x19, 0xA6, 0x2A, 0xCD, 0xC3, 0xFC, 0x12, 0x86, 0x1D, 0x8C, 0xBA, 0x61, 0xB1, 0xAE, 0xAF, 0xBA,
+    0xBA, 0xB6, 0x71, 0x15, 0x7F, 0xAF, 0x29, 0x42, 0xA3, 0xE2, 0x24, 0xA2, 0xBA, 0x93, 0xD4, 0x48,
+    0x9D, 0x85, 0x85, 0x92, 0x7C, 0xA6, 0x99, 0x54, 0xE7, 0x1F, 0x86, 0xCE, 0xBD, 0x85, 0x36, 0x99,
+    0xD7, 0xC7, 0x48, 0x27, 0x41, 0xA6, 0x46, 0xF5, 0x15, 0x95, 0x9A, 0x78, 0xE0, 0xD8, 0x12, 0x73,
+    0x92, 0x15, 0xB7, 0x46, 0x7D, 0xD2, 0x91, 0xFA, 0x11, 0xB3, 0xA1, 0x6C, 0x70, 0xE2, 0xB6, 0xE8,
+    0x07, 0x99, 0xF4, 0x5A, 0x68, 0xB1, 0x1F, 0xFF, 0x5E, 0x44, 0x3F, 0x52, 0xA2, 0xAF, 0x09, 0x3A,
+    0x41, 0xB7, 0x8B, 0xCE, 0x3F, 0xA4, 0x00, 0xD1, 0x1B, 0x25, 0xEE, 0x7C, 0xB9, 0x3B, 0x33, 0xD4,
+    0x69, 0x68, 0x17, 0xD7, 0x75, 0xA2, 0x93, 0x7E, 0xAD, 0xBE, 0x52, 0xC5, 0x54, 0x63, 0xE0, 0x48,
+    0x94, 0x05, 0xD1, 0x0F, 0x4A, 0xFD, 0xC8, 0xCA, 0xA3, 0xAC, 0x12, 0xF5, 0x0B, 0x29, 0x97, 0xDA,
+    0x5C, 0xE5, 0x7D, 0xE5, 0x0B, 0x9C, 0xFE, 0x0F, 0xFA, 0x2E, 0x52, 0xCB, 0xA2, 0x5B, 0xA2, 0xB6,
+    0x17, 0x44, 0x61, 0x77, 0x04, 0xF2, 0x46, 0x4C, 0xF0, 0xF2, 0x25, 0x89, 0x58, 0xFC, 0x6A, 0x94,
+    0x85, 0xAF, 0x71, 0xB4, 0x68, 0x52, 0xD3, 0x90, 0x28, 0xDC, 0xEF, 0x9D, 0x64, 0x29, 0x4C, 0xEC,
+    0x39, 0x9D, 0xCC, 0x01, 0x51, 0x31, 0x65, 0xAA, 0xA4, 0x7F, 0xC2, 0x5C, 0xE2, 0xA7, 0x43, 0xBD,
+    0x1F, 0xCA, 0x74, 0x1E, 0x28, 0x7D, 0xA1, 0xE9, 0x43, 0xFF, 0xC4, 0x27, 0xDD, 0x1C, 0x3D, 0x97,
+    0x65, 0xB2, 0xCA, 0x90, 0x08, 0x75, 0x7E, 0x9A, 0x14, 0x03, 0x9D, 0x32, 0x9A, 0xC5, 0x0F, 0x23,
+    0x9F, 0x0C, 0x92, 0x27, 0xBE, 0x6E, 0xB3, 0x0E, 0x5B, 0xB2, 0xAD, 0xCB, 0xF6, 0xDC, 0x8E, 0xA1,
+    0x8A, 0x6C, 0x97, 0x29, 0x8A, 0x38, 0x65, 0x40, 0xC1, 0xAF, 0x1C, 0x02, 0x46, 0x46, 0xDC, 0x5C,
+    0x4B, 0x9C, 0xE3, 0x79, 0x83, 0xBD, 0x22, 0xF3, 0x14, 0xE6, 0xFC, 0xC7, 0x32, 0x25, 0x46, 0x50,
+    0x3F, 0x9F, 0x28, 0x24, 0x45, 0x19, 0x9D, 0x34, 0x29, 0xEF, 0x74, 0x71, 0x25, 0x09, 0xC6, 0x6F,
+    0x79, 0x76, 0x94, 0xB4, 0x9D, 0x00, 0x37, 0x65, 0x4A, 0xCA, 0xC8, 0xF2, 0xBC, 0x0A, 0x93, 0x67,
+    0x8B, 0x78, 0x70, 0xC7, 0x60, 0x87, 0x9B, 0xBE, 0xE9, 0x64, 0x22, 0xD8, 0x67, 0x89, 0x58, 0x86,
+    0xD8, 0x3D, 0xCB, 0xC8, 0x7E, 0x1F, 0x01, 0x93, 0xC6, 0x3E, 0x5D, 0x9E, 0x67, 0x82, 0x38, 0xC9,
+    0x3E, 0xC0, 0xA8, 0x49, 0xAA, 0xE4, 0xA3, 0xA7, 0xC1, 0x82, 0xF4, 0x49, 0xB2, 0xCB, 0xFA, 0x1A,
+    0xC9, 0xF8, 0x27, 0x44, 0x54, 0xD7, 0xF9, 0x38, 0xFB, 0x9A, 0x18, 0x2C, 0x7E, 0x94, 0x10, 0xB1,
+    0xC5, 0xA9, 0xA5, 0xEE, 0x9C, 0xB4, 0xA8, 0x7B, 0xDA, 0x7B, 0xD8, 0x5B, 0x97, 0xB7, 0x58, 0x41,
+    0xAA, 0x2A, 0xF6, 0x3A, 0xD9, 0xD9, 0x5C, 0xC1, 0xD2, 0x97, 0xDE, 0x1A, 0x2F, 0xC1, 0x9C, 0xDA,
+    0x31, 0xD6, 0xE7, 0x7C, 0x51, 0x57, 0x79, 0x14, 0x89, 0x31, 0x23, 0xC3, 0x7C, 0x42, 0xD0, 0xF6,
+    0x52, 0x42, 0x57, 0x32, 0x50, 0x8A, 0x4C, 0x2F, 0xF4, 0x47, 0x32, 0x30, 0xC9, 0xFF, 0x20, 0xE3,
+    0xB9, 0x91, 0xF8, 0xD6, 0x4C, 0x52, 0xBE, 0x7A, 0xD1, 0xE9, 0x5D, 0x96, 0x69, 0xCC, 0xC0, 0x7A,
+    0x27, 0x33, 0x76, 0x8A, 0xE1, 0x5B, 0x19, 0x1D, 0xE9, 0xB7, 0x51, 0xF8, 0x18, 0xFA, 0x71, 0x77,
+    0x04, 0x3F, 0xC2, 0xFF, 0x5F, 0x7F, 0x02, 0xB5, 0x55, 0xBF, 0x73, 0xDC, 0x44, 0x18, 0x7D, 0xAB,
+    0xE5, 0x2C, 0x40, 0x86, 0xA5, 0x48, 0x0A, 0x70, 0xC6, 0x6A, 0x28, 0x71, 0xD4, 0xA6, 0x38, 0xFB,
+    0x34, 0x43, 0x41, 0x41, 0xE3, 0xC2, 0x22, 0x05, 0x45, 0xD2, 0x52, 0x85, 0xD2, 0xC5, 0x39, 0x11,
+    0xE3, 0x3F, 0x00, 0xFF, 0x07, 0xA4, 0x04, 0x53, 0xD8, 0x45, 0x0A, 0x17, 0xE7, 0xDC, 0x26, 0x94,
+    0x34, 0x1A, 0x5A, 0x8A, 0x88, 0x81, 0x34, 0x34, 0x59, 0x0F, 0x3B, 0x83, 0x20, 0xB2, 0x96, 0xF7,
+    0xED, 0x39, 0xB6, 0x4B, 0x9A, 0xD3, 0xCC, 0xCA, 0xA7, 0xFD, 0xF1, 0xBD, 0xB7, 0xEF, 0xFB, 0xDE,
+    0x67, 0x00, 0x55, 0x55, 0x01, 0x98, 0x87, 0x60, 0x01, 0x3D, 0x1C, 0x3A, 0x79, 0xE3, 0x0E, 0x90,
+    0xBC, 0x28, 0xDF, 0x03, 0xD4, 0xEF, 0x9C, 0x06, 0xCE, 0x9C, 0xBC, 0xDD, 0x4C, 0xDE, 0x4F, 0x26,
+    0x3F, 0x72, 0x6E, 0xD7, 0x84, 0x16, 0xD8, 0xBC, 0x2B, 0xCB, 0x93, 0x20, 0xCB, 0x9B, 0x55, 0xC7,
+    0xF7, 0x6D, 0x6C, 0x61, 0x15, 0xEB, 0x30, 0xA5, 0x81, 0x41, 0x6A, 0xD3, 0x3A, 0x6F, 0xD3, 0x10,
+    0x9A, 0xA2, 0x37, 0x41, 0xB6, 0xA9, 0xAF, 0x4A, 0x82, 0x35, 0xE6, 0xE5, 0xBC, 0xEE, 0xB1, 0x61,
+    0x2C, 0x8E, 0xA7, 0x48, 0xF6, 0x19, 0x2A, 0xE7, 0x61, 0xC6, 0xD7, 0xFC, 0x69, 0x6A, 0x30, 0x0A,
+    0xD0, 0x93, 0x05, 0x8F, 0xA4, 0x2D, 0x56, 0x8D, 0x5F, 0x71, 0x0C, 0x80, 0x2C, 0x34, 0xC2, 0x01,
+    0x2B, 0xDC, 0x32, 0xE1, 0xD8, 0x10, 0x5A, 0x40, 0xC1, 0x3F, 0xDB, 0x32, 0xFF, 0x41, 0xA4, 0x00,
+    0x64, 0xAD, 0x5C, 0x8A, 0x43, 0xD5, 0x71, 0xFF, 0xA8, 0xAA, 0xB6, 0x75, 0x08, 0x3D, 0xF2, 0xC3,
+    0x23, 0xB2, 0xD2, 0x35, 0x03, 0x5B, 0x9C, 0x08, 0x6D, 0x0E, 0xC3, 0x91, 0xFE, 0xF9, 0x3D, 0x92,
+    0x30, 0x00, 0xDD, 0xF5, 0x49, 0xAB, 0x2C, 0x77, 0x3A, 0x4E, 0xEE, 0xAA, 0x79, 0x38, 0x57, 0x81,
+    0x1C, 0xF8, 0xBC, 0x8D, 0x05, 0xE6, 0x23, 0x5E, 0x7F, 0x4E, 0x84, 0x8F, 0xB1, 0x04, 0x94, 0x84,
+    0x81, 0x13, 0xD1, 0xE0, 0x55, 0x4D, 0x59, 0x3C, 0x92, 0x66, 0x75, 0x09, 0x28, 0xC7, 0x94, 0xF0,
+    0x34, 0xAF, 0x51, 0xA4, 0x0B, 0x65, 0xE5, 0xB9, 0x59, 0x55, 0x65, 0x4C, 0xD7, 0xC3, 0xC3, 0x19,
+    0x13, 0xF3, 0x3E, 0x32, 0xAB, 0x91, 0x88, 0xA4, 0x9E, 0x63, 0xCC, 0x91, 0x1F, 0x3E, 0x66, 0x2E,
+    0xBA, 0x98, 0xAE, 0xAB, 0x49, 0xA4, 0xB2, 0xD3, 0xEA, 0x56, 0xB5, 0x2B, 0x21, 0xF8, 0x54, 0x48,
+    0xE2, 0x86, 0x6C, 0xD0, 0x1D, 0x12, 0x92, 0xB9, 0x1F, 0xE9, 0x97, 0x93, 0x01, 0x44, 0x9C, 0x4A,
+    0x76, 0xB3, 0x5A, 0x08, 0x7A, 0xB2, 0x13, 0x41, 0x19, 0xB0, 0x11, 0xB2, 0x71, 0xC9, 0xD4, 0x6A,
+    0x5E, 0xE7, 0xA1, 0x64, 0xB6, 0x45, 0x6D, 0x35, 0x20, 0xF3, 0x78, 0x27, 0x12, 0xAC, 0x76, 0x40,
+    0x70, 0xC6, 0xC8, 0x63, 0x1E, 0x6E, 0xC7, 0x5B, 0x6E, 0xCA, 0x39, 0xA9, 0xA1, 0x2E, 0x52, 0x72,
+    0x50, 0x4E, 0xC2, 0x90, 0xE2, 0x5A, 0x87, 0x47, 0xE7, 0x3C, 0xF6, 0x18, 0xA0, 0x28, 0xAF, 0x1B,
+    0xF8, 0x29, 0x7C, 0xBA, 0xD0, 0xB2, 0xD4, 0x2C, 0x64, 0x46, 0x22, 0x01, 0x29, 0xB6, 0x93, 0x18,
+    0xC7, 0x94, 0x6F, 0xBE, 0xBB, 0xC5, 0x37, 0xAE, 0xBE, 0x49, 0x4A, 0x05, 0xC6, 0xFF, 0x24, 0xC3,
+    0xE4, 0xF3, 0xC6, 0x3C, 0x77, 0x97, 0xA2, 0xC1, 0x84, 0x1A, 0x0F, 0x63, 0x29, 0x67, 0x36, 0xEA,
+    0xE5, 0xE3, 0xE9, 0xC5, 0xB7, 0x5E, 0x7C, 0x8F, 0xAF, 0x7D, 0xAF, 0x0C, 0x48, 0xA5, 0xA0, 0x47,
+    0x3F, 0x94, 0x60, 0x46, 0x5B, 0x7C, 0xE8, 0xEF, 0x89, 0x14, 0xA9, 0xE3, 0xAD, 0x58, 0xF6, 0x27,
+    0x30, 0x96, 0x82, 0x14, 0x51, 0x92, 0xD1, 0xE9, 0x4E, 0xE2, 0x68, 0xB5, 0xCC, 0xD2, 0x1F, 0x5B,
+    0x0B, 0xD5, 0xA8, 0x9F, 0x25, 0xB1, 0x3D, 0x6E, 0x61, 0xB8, 0x0E, 0x4F, 0xB1, 0xF6, 0xEF, 0xBC,
+    0x61, 0x66, 0xFF, 0xB8, 0xCC, 0xA5, 0x92, 0x57, 0xEA, 0x08, 0xAE, 0x5F, 0x49, 0xA2, 0x7E, 0xE9,
+    0x70, 0xED, 0x19, 0x6D, 0xE3, 0xE6, 0x8E, 0x3E, 0x47, 0x3E, 0xA0, 0xA8, 0x89, 0x47, 0xE4, 0x0D,
+    0x24, 0x83, 0x00, 0xBE, 0x66, 0x26, 0x31, 0xEE, 0x54, 0x0B, 0x53, 0xE0, 0x09, 0xD2, 0xFD, 0x66,
+    0x93, 0x25, 0x38, 0xE3, 0x8A, 0x33, 0x9F, 0x72, 0x45, 0xFF, 0x46, 0xDD, 0x30, 0xE5, 0x4A, 0x6D,
+    0x66, 0x5C, 0x51, 0x41, 0x34, 0x9F, 0x58, 0x3C, 0x2D, 0xD3, 0x56, 0xB1, 0x78, 0xFC, 0x25, 0x85,
+    0xF2, 0xA2, 0x48, 0xC4, 0xB1, 0x52, 0x06, 0x92, 0xD0, 0x85, 0x8D, 0x0F, 0xE8, 0x21, 0x8A, 0x36,
+    0x7C, 0xD1, 0xD3, 0xED, 0x39, 0x5B, 0x82, 0x76, 0xCC, 0xE1, 0x1E, 0xDD, 0x6F, 0xEE, 0x91, 0xF1,
+    0xAF, 0xF4, 0xD7, 0xDF, 0xA4, 0x3E, 0xE5, 0xA1, 0x42, 0x26, 0xBF, 0x65, 0xA2, 0x7E, 0x92, 0x9C,
+    0xEE, 0x31, 0x1B, 0xA6, 0x21, 0xDD, 0x70, 0x44, 0x11, 0xC2, 0xC1, 0xE5, 0x8D, 0xEE, 0x2F, 0xFA,
+    0x08, 0xAB, 0x05, 0x89, 0xE4, 0xFC, 0x60, 0x69, 0x50, 0xEF, 0x8A, 0xB1, 0xA4, 0x5D, 0x9D, 0x72,
+    0x7C, 0x66, 0x59, 0x34, 0x5F, 0x2F, 0x0B, 0x6A, 0x9B, 0x7D, 0x6D, 0xB8, 0x25, 0x51, 0x59, 0x77,
+    0x93, 0xF2, 0x22, 0xAB, 0xCB, 0x80, 0x4A, 0xEC, 0x31, 0xB4, 0xE7, 0x8D, 0xFA, 0xE2, 0x5A, 0x99,
+    0x7C, 0x54, 0x42, 0xB1, 0x9F, 0xE8, 0x7F, 0xBE, 0x74, 0x9A, 0x5D, 0x81, 0xC3, 0x3C, 0xA3, 0xBF,
+    0xBC, 0xB8, 0x83, 0x70, 0xE6, 0x01, 0xA1, 0x5E, 0xD4, 0x50, 0x7F, 0x11, 0x6A, 0xC6, 0xC9, 0x2D,
+    0x42, 0xE5, 0x6C, 0xEE, 0xE6, 0x1B, 0xCF, 0x0A, 0x9D, 0x94, 0xB9, 0xD5, 0xC3, 0x9C, 0x0E, 0x1F,
+    0xCA, 0x8B, 0x80, 0x19, 0x6E, 0x4D, 0xD3, 0x67, 0x67, 0x2E, 0xED, 0xA5, 0xD2, 0x7B, 0x75, 0xE6,
+    0xA6, 0xE9, 0xCF, 0xB1, 0x9B, 0xCB, 0x9D, 0xDE, 0x12, 0xB4, 0x0D, 0x98, 0x97, 0x0F, 0x3C, 0x26,
+    0x62, 0x84, 0x1E, 0xC6, 0xD1, 0xCD, 0x5B, 0x9E, 0x55, 0xEE, 0x3D, 0x7B, 0x9E, 0xF5, 0xB4, 0x01,
+    0xBC, 0xA9, 0xC7, 0xCA, 0x99, 0xDA, 0xF1, 0x2A, 0xFB, 0x6C, 0x3B, 0xE6, 0x3B, 0x9A, 0xC7, 0x70,
+    0x73, 0xCD, 0x7B, 0xF1, 0xA0, 0x57, 0x3D, 0xD6, 0xC3, 0x51, 0x8B, 0x3B, 0x57, 0xC8, 0x51, 0x39,
+    0xE9, 0x89, 0x5A, 0x2A, 0x32, 0x93, 0xA6, 0x37, 0xBA, 0x30, 0xF0, 0x0E, 0xAA, 0xBB, 0xC1, 0xE6,
+    0xC3, 0x5A, 0x43, 0x17, 0x9F, 0xB0, 0x15, 0xD1, 0x68, 0x63, 0x69, 0x5E, 0x96, 0x8E, 0xDD, 0x95,
+    0x66, 0x55, 0xB2, 0xD3, 0xB8, 0xD8, 0xA2, 0x18, 0xC1, 0xD1, 0x79, 0xEB, 0xD2, 0xAA, 0x1A, 0xBA,
+    0x79, 0xCC, 0x1F, 0xA6, 0xD6, 0x22, 0x4F, 0x21, 0x5D, 0x2F, 0xF6, 0x9B, 0x37, 0xD9, 0xBB, 0xF8,
+    0x6F, 0x51, 0x48, 0xB1, 0xF8, 0xAB, 0x9A, 0x5C, 0x1A, 0xE0, 0xFF, 0x7E, 0xFE, 0x03, 0x9D, 0x55,
+    0x31, 0x6F, 0xDC, 0x36, 0x18, 0x7D, 0x22, 0xEB, 0x08, 0x05, 0x81, 0xD0, 0x43, 0x02, 0x14, 0x48,
+    0x62, 0xFD, 0x01, 0xDB, 0x5A, 0x3A, 0x9E, 0x7C, 0x4C, 0x3D, 0x74, 0xC8, 0xE0, 0x14, 0xE8, 0xA1,
+    0x53, 0xF7, 0x6C, 0xF6, 0xE0, 0xC1, 0x83, 0xEC, 0x13, 0xEA, 0xA1, 0x43, 0x87, 0x66, 0xE8, 0xCF,
+    0x28, 0x90, 0x0C, 0x37, 0x1C, 0x0A, 0xDB, 0xC7, 0xC4, 0xE8, 0xD4, 0xC1, 0x4C, 0xFA, 0x07, 0x64,
+    0x20, 0x05, 0x8A, 0x7A, 0x08, 0xD1, 0x6A, 0x10, 0x1A, 0xF9, 0xD8, 0xC7, 0xB3, 0xCF, 0x09, 0x50,
+    0x14, 0x85, 0x2D, 0x9D, 0x04, 0x9E, 0xF4, 0xF1, 0xBD, 0xEF, 0x7B, 0xFC, 0xF8, 0x04, 0x7C, 0x0C,
+    0x40, 0x36, 0xBC, 0xBD, 0x73, 0xC0, 0x6E, 0x06, 0x68, 0x6C, 0x21, 0x1E, 0x77, 0xBF, 0xC4, 0xE0,
+    0xAB, 0x60, 0xB3, 0xE9, 0x3D, 0x87, 0x3D, 0x8C, 0x21, 0x9D, 0xAE, 0xD0, 0x43, 0x03, 0x69, 0x19,
+    0xB5, 0x23, 0x3C, 0x94, 0x59, 0x05, 0xBC, 0x74, 0x9C, 0x52, 0x70, 0x90, 0x5A, 0x2C, 0xA1, 0x84,
+    0x70, 0xCA, 0x32, 0xAE, 0x84, 0xAE, 0xA4, 0x97, 0x1E, 0x79, 0xE8, 0x80, 0xE1, 0x39, 0x2E, 0x0F,
+    0x51, 0x3D, 0x07, 0xBA, 0xDC, 0x40, 0xEF, 0xFB, 0xF9, 0x33, 0x24, 0x03, 0xB3, 0x30, 0x18, 0x76,
+    0x49, 0x38, 0x3D, 0x44, 0x5A, 0xAB, 0x8A, 0x78, 0x2D, 0x79, 0xB4, 0x41, 0x2F, 0xF1, 0x48, 0xAB,
+    0x1C, 0x18, 0x89, 0xFA, 0x92, 0x67, 0x46, 0x58, 0x22, 0xA9, 0x49, 0xB8, 0x82, 0x03, 0xC6, 0x71,
+    0xD0, 0xA2, 0xCF, 0x53, 0x84, 0x60, 0x91, 0x06, 0x77, 0x05, 0x5C, 0x11, 0x9B, 0xC5, 0x49, 0xA6,
+    0x90, 0xB6, 0x1C, 0x3F, 0x9D, 0xD3, 0xDD, 0xFD, 0x22, 0x34, 0xF9, 0x79, 0xE6, 0x92, 0x96, 0x85,
+    0x8C, 0x89, 0x5B, 0x42, 0xD9, 0x1E, 0x12, 0x4F, 0x86, 0x35, 0x96, 0xA5, 0x4E, 0x18, 0x17, 0x78,
+    0x31, 0x53, 0xBE, 0x21, 0x44, 0xCD, 0x3F, 0x51, 0xA7, 0x1E, 0xAF, 0x2C, 0xBE, 0xF8, 0x1D, 0xE8,
+    0xC7, 0x88, 0xC1, 0x63, 0x48, 0x52, 0x46, 0x1E, 0x26, 0xC2, 0x7A, 0x0D, 0x8E, 0x26, 0x56, 0xBA,
+    0xAC, 0xD2, 0xC8, 0x89, 0x7B, 0x20, 0x6A, 0x51, 0xEB, 0x4A, 0x9B, 0x02, 0x1D, 0x7C, 0x6E, 0xD3,
+    0xD0, 0x20, 0xFF, 0x61, 0x06, 0x76, 0xEF, 0x0D, 0x92, 0x70, 0x21, 0xC3, 0x2D, 0x13, 0x09, 0x39,
+    0x96, 0xBF, 0x31, 0x59, 0x6D, 0xCA, 0xC8, 0x42, 0xAE, 0x02, 0xDB, 0x91, 0x93, 0x2F, 0x4A, 0x41,
+    0xF4, 0x71, 0xCA, 0xB8, 0xD1, 0xED, 0x98, 0xCB, 0x12, 0x6F, 0x3E, 0x33, 0xCC, 0x59, 0x39, 0x88,
+    0x9A, 0x52, 0x53, 0x99, 0x28, 0x1B, 0x39, 0xD3, 0xD9, 0xED, 0x17, 0x8C, 0xA0, 0xBE, 0xFF, 0x83,
+    0xC2, 0xAD, 0x33, 0x29, 0x8D, 0xCB, 0xCC, 0xA3, 0x8A, 0xD8, 0x26, 0x01, 0x26, 0x91, 0x3B, 0xAF,
+    0x2E, 0xC5, 0x4A, 0x11, 0x11, 0xA8, 0xE8, 0xAC, 0xE0, 0xED, 0xB9, 0x86, 0x9B, 0xDF, 0x9A, 0x49,
+    0xB0, 0xBB, 0xAA, 0xE6, 0xE2, 0xAF, 0xA1, 0xA7, 0x91, 0xA5, 0x95, 0xFA, 0xC6, 0xA5, 0xAE, 0x91,
+    0xBE, 0x10, 0x5D, 0xF6, 0xF2, 0x64, 0x2D, 0xFC, 0xDA, 0xF5, 0x6D, 0x77, 0xA5, 0xBA, 0x32, 0x48,
+    0x5D, 0xC4, 0x8A, 0x70, 0xEE, 0xE6, 0x38, 0x4C, 0x71, 0xC8, 0x5E, 0xF0, 0xE8, 0xAD, 0xA0, 0x90,
+    0xD5, 0x4D, 0x71, 0xD4, 0x2B, 0x9B, 0x4E, 0xBD, 0x38, 0x6E, 0xB0, 0xB8, 0x38, 0x6F, 0xB8, 0xA3,
+    0x07, 0xEC, 0x95, 0xA4, 0xC9, 0x2B, 0xB6, 0x53, 0x0B, 0xCF, 0x7E, 0x5D, 0xC2, 0xAA, 0x32, 0xD9,
+    0xBA, 0xD3, 0xB6, 0x51, 0x7E, 0xA8, 0x7A, 0xEF, 0xC2, 0x86, 0x0F, 0xF2, 0x62, 0x71, 0xEE, 0x2C,
+    0x20, 0x7F, 0xE4, 0xD4, 0x4B, 0x0F, 0x33, 0x47, 0xB8, 0xD5, 0x6E, 0xAB, 0xD0, 0xA5, 0xEE, 0x88,
+    0x6D, 0xBA, 0x5E, 0x4B, 0xEB, 0x13, 0xBF, 0x83, 0xF1, 0x0A, 0x76, 0xB5, 0xE9, 0x4B, 0x97, 0xBF,
+    0xE8, 0x96, 0xFF, 0x7A, 0x7B, 0xDE, 0x3F, 0xEE, 0xB4, 0x9D, 0xF1, 0x3D, 0x85, 0x98, 0x22, 0x79,
+    0x6D, 0xF1, 0x7C, 0x0B, 0xCB, 0xCB, 0x48, 0xB9, 0x1F, 0x9E, 0xDC, 0x50, 0x15, 0x71, 0xAE, 0xDA,
+    0x24, 0x84, 0x33, 0xB7, 0x2B, 0xFC, 0xAA, 0x36, 0x3D, 0xF9, 0xBA, 0x4E, 0xAB, 0x03, 0x4E, 0xEF,
+    0xA7, 0x55, 0x36, 0xAC, 0x46, 0x32, 0x18, 0x6D, 0x26, 0x6C, 0x10, 0xED, 0xB1, 0xB1, 0x7F, 0x62,
+    0xC6, 0x13, 0x1F, 0xA6, 0xB2, 0xE5, 0xE3, 0x39, 0x42, 0xDA, 0x89, 0xE0, 0xC6, 0x9F, 0x2C, 0x5D,
+    0xF4, 0x0A, 0xB7, 0x5B, 0xC3, 0x86, 0x63, 0xEB, 0x3C, 0xB2, 0x3B, 0xC3, 0x20, 0x66, 0x71, 0x4F,
+    0xA0, 0x6A, 0xC4, 0x00, 0xEE, 0xBF, 0x3B, 0x17, 0x92, 0xD9, 0x18, 0xC4, 0x9D, 0xC8, 0xDF, 0x83,
+    0xF9, 0x52, 0x58, 0xF5, 0xCC, 0x8E, 0x98, 0x71, 0xD9, 0x93, 0xAF, 0xEA, 0x43, 0xFE, 0xE9, 0xBF,
+    0x89, 0x0E, 0xE1, 0x12, 0x6D, 0xCB, 0x2C, 0xB8, 0xBC, 0xBD, 0x4A, 0xDA, 0x81, 0xAD, 0x3A, 0xE3,
+    0xF9, 0xF4, 0xDA, 0x93, 0x33, 0x24, 0x53, 0xE8, 0x12, 0x7E, 0xA4, 0x4D, 0x7D, 0xAD, 0xC9, 0x8F,
+    0xEF, 0x88, 0xE6, 0x50, 0xF8, 0x83, 0xF7, 0xEB, 0xB6, 0x69, 0xC5, 0x99, 0x57, 0x0F, 0xFD, 0x52,
+    0xE2, 0x7B, 0xD2, 0xED, 0xE4, 0xE6, 0xA7, 0x0E, 0xE1, 0x69, 0xDC, 0x8C, 0x0D, 0x4C, 0x97, 0xDA,
+    0x61, 0x30, 0x73, 0xE2, 0xFB, 0x68, 0x84, 0x17, 0x3E, 0x89, 0x1D, 0x9C, 0xBF, 0x08, 0xD1, 0x8B,
+    0x54, 0x55, 0xF0, 0x66, 0x0B, 0xF8, 0xCF, 0x4F, 0x72, 0xBF, 0x37, 0xAF, 0x8D, 0x7B, 0x3F, 0x9E,
+    0x17, 0x95, 0xE5, 0x36, 0x63, 0xC7, 0x32, 0x69, 0x55, 0x31, 0x1D, 0xCF, 0xFD, 0x54, 0x40, 0x7F,
+    0x94, 0x9E, 0x88, 0x80, 0xBD, 0xAB, 0x82, 0xB2, 0x5A, 0x97, 0x5A, 0x6D, 0x5C, 0x94, 0xF3, 0x7F,
+    0x33, 0x16, 0x92, 0xCF, 0x9A, 0xC3, 0x5C, 0xD9, 0xCB, 0x22, 0x68, 0x21, 0xDD, 0x07, 0x4B, 0x97,
+    0x81, 0x16, 0x56, 0x40, 0xBE, 0x40, 0xE9, 0x55, 0x77, 0xC9, 0x71, 0x2B, 0x81, 0xFC, 0xD3, 0xA1,
+    0x6F, 0x41, 0x73, 0xA0, 0x74, 0x82, 0xA1, 0x34, 0x91, 0xC9, 0x8F, 0xC9, 0x34, 0x98, 0x46, 0xD5,
+    0x2D, 0xDA, 0x32, 0x1A, 0x9D, 0xDE, 0x30, 0xF2, 0xD8, 0xC1, 0x37, 0x18, 0x17, 0xEC, 0x3E, 0x5B,
+    0x24, 0xD3, 0x23, 0x64, 0xE7, 0xEF, 0x9B, 0xAD, 0xD9, 0xC2, 0xF0, 0x2D, 0x54, 0xE6, 0xB0, 0xF8,
+    0xF8, 0xAA, 0xF5, 0x55, 0x3D, 0x39, 0x0E, 0xD8, 0x69, 0x1A, 0x75, 0xA0, 0x11, 0x12, 0xAF, 0xDD,
+    0x2A, 0x5A, 0x3A, 0x1E, 0x7A, 0x82, 0xAE, 0x5C, 0x60, 0xBC, 0x6E, 0xF5, 0xD7, 0x25, 0xC2, 0x77,
+    0x95, 0xAE, 0xE7, 0x48, 0xF7, 0x69, 0xAC, 0xB3, 0xE6, 0xA1, 0xB9, 0x24, 0x73, 0x53, 0xD8, 0xAC,
+    0x45, 0x68, 0xB9, 0x62, 0x39, 0x8A, 0x02, 0x6B, 0x25, 0x0A, 0x5A, 0x71, 0x83, 0x1E, 0xB3, 0xE1,
+    0xA6, 0x3C, 0x90, 0xF5, 0xF0, 0x59, 0xF5, 0x41, 0x32, 0x2B, 0xFC, 0x42, 0x61, 0xB6, 0xCA, 0x90,
+    0xE6, 0x26, 0x08, 0xD4, 0x56, 0xB6, 0x51, 0x8E, 0x62, 0x05, 0xCD, 0xED, 0x9B, 0x20, 0xA8, 0xD3,
+    0x7F, 0x7B, 0xC9, 0xA4, 0x22, 0x80, 0xF4, 0x99, 0xA0, 0x97, 0x34, 0x51, 0xD7, 0x62, 0xAE, 0xAB,
+    0xA0, 0xCE, 0x3E, 0x47, 0x9B, 0xFE, 0xDD, 0x62, 0xD8, 0xE0, 0x3F, 0xBD, 0x64, 0x0A, 0x15, 0x6A,
+    0xA6, 0xA0, 0xE8, 0x25, 0x4E, 0x9E, 0x7A, 0x34, 0xE3, 0x98, 0x8C, 0xD6, 0x46, 0xED, 0xD3, 0x5B,
+    0x98, 0x44, 0x76, 0x56, 0x27, 0x57, 0xDF, 0x35, 0x96, 0xC1, 0x55, 0x8D, 0xFE, 0x8F, 0x01, 0xBF,
+    0xD1, 0xE1, 0xE7, 0xC1, 0x20, 0x8E, 0xEB, 0xF8, 0x34, 0xC7, 0x75, 0x8E, 0x7F, 0x00, 0xBD, 0x55,
+    0xBF, 0x8F, 0x1B, 0x45, 0x18, 0x7D, 0xB3, 0x13, 0x79, 0xA5, 0x8C, 0xA2, 0xE9, 0x20, 0x52, 0x72,
+    0xB7, 0x69, 0x22, 0x45, 0x48, 0xF6, 0x52, 0xD0, 0xB1, 0xF6, 0xAE, 0x92, 0x3F, 0x20, 0x69, 0x92,
+    0x26, 0x12, 0xA2, 0x85, 0x82, 0x6B, 0x22, 0x74, 0x48, 0x97, 0x78, 0x2E, 0x4D, 0x0A, 0x9A, 0x48,
+    0x40, 0x9F, 0x3A, 0x0D, 0x41, 0x5C, 0x61, 0x90, 0xB9, 0x9B, 0x28, 0x45, 0x4A, 0x36, 0x42, 0x54,
+    0x34, 0x1B, 0x11, 0xAA, 0x80, 0x34, 0x88, 0x45, 0xB7, 0x47, 0xD6, 0x1E, 0xDE, 0x78, 0xED, 0x38,
+    0x25, 0x4A, 0x4E, 0xCC, 0x79, 0xEC, 0xD1, 0xFC, 0x78, 0xF3, 0xBE, 0xF7, 0xBD, 0xF9, 0x0E, 0x60,
+    0xEB, 0xCD, 0xCF, 0x22, 0xF5, 0x0D, 0xDA, 0xB8, 0x8A, 0x9C, 0x2A, 0x65, 0x99, 0x57, 0xB1, 0xFD,
+    0xAB, 0x52, 0x77, 0x1E, 0x95, 0xFA, 0x03, 0x69, 0x75, 0xA3, 0x8C, 0x2E, 0x35, 0xB4, 0x1D, 0x21,
+    0xFF, 0xA7, 0xC1, 0x37, 0xBE, 0xC4, 0xAA, 0x09, 0x0B, 0x8C, 0xF8, 0x53, 0x03, 0x31, 0x87, 0x1B,
+    0xAB, 0xF9, 0xD4, 0xC6, 0x9F, 0xB7, 0xA8, 0x79, 0x18, 0x3B, 0xC2, 0x29, 0xB3, 0xC9, 0x31, 0x21,
+    0xB2, 0xA8, 0x52, 0x76, 0x28, 0x1A, 0x59, 0xBE, 0x6F, 0x86, 0xFA, 0xB3, 0x9F, 0xFC, 0xE3, 0x36,
+    0xA9, 0x46, 0x6B, 0x34, 0x02, 0x0F, 0x01, 0x6D, 0x10, 0x55, 0xC0, 0x7B, 0x6F, 0x06, 0x96, 0x00,
+    0xB2, 0x05, 0x0E, 0x4B, 0xF4, 0x37, 0xA1, 0x8A, 0xEA, 0xB5, 0xC1, 0x4E, 0xF7, 0x10, 0x3F, 0xA9,
+    0x31, 0x4D, 0x21, 0x50, 0xBC, 0x11, 0x25, 0xC0, 0x91, 0x14, 0x99, 0x28, 0xBB, 0xE0, 0x87, 0x0B,
+    0xEB, 0x95, 0x5B, 0x04, 0xF2, 0xD4, 0x52, 0x9B, 0x01, 0x97, 0xFB, 0x90, 0x36, 0x83, 0x2C, 0x33,
+    0x44, 0xE5, 0x0D, 0xAA, 0xE1, 0x20, 0x9E, 0x96, 0x10, 0xBF, 0xF2, 0xDC, 0x73, 0xEA, 0xF4, 0x07,
+    0x7B, 0x03, 0x44, 0x01, 0xAE, 0x83, 0x3A, 0x3F, 0x05, 0x72, 0x22, 0x0F, 0x02, 0x43, 0xC1, 0x25,
+    0xCF, 0xBC, 0x72, 0x4E, 0x70, 0x8B, 0x32, 0x0B, 0x59, 0xC3, 0xE5, 0xF1, 0xED, 0x06, 0xFD, 0xBC,
+    0xC6, 0xE1, 0xA3, 0x4A, 0xFE, 0xAE, 0xAC, 0xB6, 0x03, 0xDC, 0xC4, 0x24, 0x72, 0x24, 0x5F, 0x90,
+    0x3E, 0x26, 0xC2, 0x49, 0xAB, 0x0C, 0x13, 0xFD, 0xBC, 0xC2, 0x8B, 0xD9, 0x22, 0xA9, 0x9B, 0x3C,
+    0xBA, 0xD7, 0x5D, 0x34, 0x6E, 0x10, 0xDD, 0xBF, 0x17, 0xE8, 0x9A, 0x73, 0x0C, 0xA4, 0x59, 0x08,
+    0xB3, 0x56, 0xE5, 0x78, 0xA3, 0xE8, 0xDA, 0x98, 0x81, 0x08, 0x9A, 0xF3, 0x95, 0x26, 0x4C, 0xC8,
+    0x40, 0x18, 0xCD, 0xD8, 0x75, 0x58, 0xFB, 0x94, 0x87, 0xE4, 0xE3, 0xE0, 0x40, 0x1D, 0x02, 0x65,
+    0xB4, 0xAA, 0xA0, 0x27, 0x99, 0x0F, 0xC8, 0xDF, 0xAE, 0x5B, 0x24, 0x9E, 0x30, 0x7F, 0x5F, 0xFD,
+    0x21, 0x68, 0x51, 0x33, 0x4E, 0x59, 0x71, 0x45, 0xDB, 0xF4, 0x2E, 0xC6, 0x5F, 0x78, 0xAB, 0xBD,
+    0xC5, 0x3B, 0xF7, 0xB9, 0xC9, 0xAE, 0x2F, 0x39, 0xF3, 0xB4, 0x4C, 0xBD, 0x4B, 0x2E, 0x36, 0x1A,
+    0x43, 0x6D, 0xB4, 0xB4, 0xF1, 0x43, 0x9E, 0xD9, 0x13, 0xF5, 0x10, 0xAD, 0x2E, 0x0E, 0x62, 0xF7,
+    0xED, 0x8F, 0x07, 0xB5, 0xD7, 0x2E, 0xEF, 0xB6, 0x9F, 0x08, 0x5F, 0xDB, 0x31, 0xC9, 0x1D, 0x4D,
+    0x82, 0xFA, 0xA4, 0x28, 0xAE, 0xAC, 0xB0, 0x7A, 0xE1, 0x8B, 0xA1, 0x41, 0x92, 0xD3, 0x22, 0x40,
+    0xF1, 0x0B, 0x37, 0xE8, 0x60, 0x81, 0x1B, 0x59, 0x88, 0x9E, 0xF3, 0x7D, 0x49, 0xF7, 0xD3, 0x4A,
+    0xD0, 0x5F, 0x6D, 0x85, 0xB0, 0x5B, 0xC8, 0x9F, 0xAF, 0xD5, 0x18, 0x50, 0x3F, 0x66, 0x4E, 0x1B,
+    0xAE, 0xE4, 0xD8, 0x2F, 0xC4, 0xFC, 0xB2, 0x47, 0xEE, 0x03, 0xE2, 0x29, 0x98, 0xF8, 0x89, 0x83,
+    0x77, 0x50, 0x2B, 0x77, 0x8B, 0xFD, 0x8D, 0xC8, 0x7B, 0x51, 0xA7, 0x86, 0x29, 0x6D, 0xE0, 0x32,
+    0xEC, 0x6C, 0x62, 0xA0, 0x8A, 0xE4, 0x52, 0xA9, 0x6D, 0xAD, 0xDC, 0x58, 0x65, 0x2F, 0xFC, 0x65,
+    0xE7, 0xA5, 0x5B, 0x1E, 0xF8, 0x10, 0x9D, 0x1B, 0x91, 0x53, 0x72, 0x39, 0xE7, 0x60, 0x83, 0xFC,
+    0xF1, 0x67, 0xF0, 0xCA, 0x25, 0xCE, 0x67, 0xBA, 0x60, 0xF2, 0xC2, 0xA3, 0x04, 0xE7, 0x8F, 0xAE,
+    0x39, 0xC4, 0x9E, 0x32, 0x0D, 0xAF, 0x6E, 0x15, 0x54, 0x70, 0xC8, 0x69, 0x34, 0x5C, 0x91, 0x4E,
+    0x3D, 0x43, 0xF2, 0xCC, 0x3B, 0xE9, 0x03, 0xF2, 0x36, 0x7B, 0x1C, 0xB2, 0xD4, 0x0F, 0x77, 0xEC,
+    0x13, 0x5A, 0xCC, 0x5F, 0x47, 0x59, 0xEA, 0x29, 0x79, 0x3F, 0x79, 0x7C, 0x57, 0x20, 0x59, 0x06,
+    0x79, 0x6E, 0xC1, 0x98, 0x36, 0x43, 0x4A, 0xC5, 0xEE, 0x76, 0x93, 0x6F, 0x7D, 0x09, 0xE5, 0x67,
+    0x98, 0x5F, 0x6F, 0xB4, 0x8D, 0xCA, 0x16, 0x8A, 0xCE, 0xBD, 0x30, 0x5A, 0xFA, 0xBF, 0x2B, 0x52,
+    0x24, 0xBA, 0x78, 0x7C, 0xDA, 0x76, 0xEE, 0xB9, 0x05, 0x58, 0x5F, 0x6C, 0xC1, 0x93, 0xF2, 0xC1,
+    0xEC, 0x25, 0xBD, 0xA8, 0x44, 0x52, 0xD0, 0x24, 0x0C, 0x7C, 0x55, 0x81, 0xC6, 0x56, 0xF9, 0x62,
+    0x72, 0x9A, 0x11, 0x65, 0x01, 0x90, 0x99, 0xA0, 0x20, 0x35, 0xC1, 0x84, 0xB2, 0xDB, 0x74, 0x4D,
+    0x5A, 0x77, 0xFB, 0x4E, 0xB2, 0x33, 0x4E, 0xBD, 0xCF, 0xBB, 0x32, 0x3A, 0xF0, 0xDD, 0x63, 0xA6,
+    0x96, 0x04, 0x19, 0xF5, 0x0E, 0xDC, 0x9E, 0x5E, 0xD5, 0xB3, 0xFF, 0x4A, 0x6D, 0xE9, 0xC0, 0x90,
+    0x77, 0xBD, 0x7E, 0x5C, 0xC7, 0x44, 0x2D, 0x2E, 0xD0, 0x22, 0x31, 0xB8, 0xB2, 0xE2, 0x94, 0xCE,
+    0xD4, 0xEE, 0x6E, 0x45, 0x4A, 0xC4, 0x9B, 0x84, 0x0B, 0x29, 0xA7, 0x39, 0x31, 0x8D, 0xEF, 0x78,
+    0xB7, 0x26, 0x14, 0x87, 0xF5, 0x87, 0x0E, 0xF2, 0x90, 0xD0, 0xC1, 0xD0, 0x3B, 0x4B, 0x0F, 0x7F,
+    0x54, 0xF0, 0xDF, 0x51, 0x1D, 0x58, 0x91, 0xEE, 0x1E, 0x2F, 0x7E, 0xC0, 0x87, 0x72, 0x6F, 0xB4,
+    0xDC, 0x31, 0xED, 0x38, 0xBD, 0xEC, 0xED, 0x72, 0x2E, 0x10, 0xCB, 0xCB, 0x33, 0x7C, 0xCC, 0x9E,
+    0xEF, 0x6F, 0x1D, 0x76, 0xD5, 0xA7, 0x5E, 0xF8, 0xBE, 0x42, 0x6E, 0x16, 0x35, 0x77, 0x49, 0x31,
+    0xF2, 0xA5, 0xDA, 0x65, 0xDD, 0x26, 0x89, 0x00, 0x3B, 0x09, 0xAA, 0x85, 0x4F, 0x83, 0x62, 0x1A,
+    0x1B, 0x56, 0x9D, 0x57, 0x95, 0x8B, 0x58, 0x27, 0xA1, 0x6F, 0x53, 0x86, 0xE4, 0x93, 0x50, 0x7B,
+    0x82, 0xF8, 0x83, 0xD5, 0x93, 0xFB, 0x98, 0x61, 0x7B, 0x56, 0xA8, 0xDE, 0xCD, 0xB7, 0x67, 0x54,
+    0x4E, 0x50, 0x46, 0xCB, 0xBA, 0x36, 0x08, 0x62, 0xD7, 0x1C, 0xB3, 0xB6, 0x25, 0xE1, 0xE6, 0x29,
+    0xFF, 0x58, 0x69, 0x59, 0x77, 0x0C, 0x15, 0x19, 0xF2, 0xE2, 0xC8, 0x51, 0xE8, 0xA4, 0xA0, 0xD2,
+    0x0D, 0xA5, 0x4E, 0x4D, 0x6F, 0xFE, 0x75, 0xCD, 0x97, 0x7F, 0x84, 0xFF, 0xAD, 0xFD, 0x0B, 0xB5,
+    0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0xD7, 0xBE, 0x41, 0x5E, 0x60, 0xD2, 0x44, 0x01,
+    0x19, 0xDD, 0xB6, 0x14, 0xD8, 0x4B, 0x41, 0x41, 0x71, 0x97, 0x1B, 0x48, 0x41, 0x09, 0x45, 0xAE,
+    0xA6, 0x87, 0xC2, 0x29, 0x52, 0x5C, 0x71, 0xE7, 0x5B, 0x68, 0x68, 0x2D, 0x21, 0x51, 0xA7, 0x48,
+    0x11, 0x4C, 0xE1, 0x02, 0x17, 0x91, 0xE5, 0x64, 0x07, 0xFC, 0x03, 0xB2, 0xD4, 0x34, 0x5B, 0xA4,
+    0x8A, 0x85, 0x34, 0x48, 0x2B, 0x71, 0x36, 0xEB, 0x1B, 0xBE, 0x77, 0xB7, 0xBE, 0x5C, 0x1B, 0x09,
+    0x8F, 0x34, 0xDA, 0xDB, 0xB7, 0xEF, 0xDE, 0xFB, 0xDE, 0xF7, 0xBE, 0x37, 0x03, 0x00, 0x96, 0x7B,
+    0x07, 0x50, 0x9F, 0x97, 0xD0, 0x4D, 0x0F, 0xF8, 0xF6, 0x2C, 0x07, 0xC6, 0x0F, 0x80, 0xE4, 0x3B,
+    0x7E, 0xA9, 0xB9, 0x0D, 0x10, 0x5D, 0x78, 0xA8, 0x30, 0x07, 0x26, 0x49, 0xC9, 0xF7, 0x1E, 0xA2,
+    0x2A, 0x76, 0x7C, 0x8C, 0xA0, 0xF3, 0x24, 0xC7, 0xB1, 0xAA, 0x61, 0xEC, 0x80, 0xEE, 0x89, 0xB7,
+    0xE6, 0xF7, 0x17, 0x3D, 0x14, 0x75, 0x40, 0xDC, 0x18, 0x87, 0xE5, 0xDA, 0xFC, 0xD9, 0x22, 0x0E,
+    0xA1, 0xC2, 0xFB, 0xF5, 0xD7, 0x35, 0xB4, 0xD3, 0x1E, 0x19, 0x74, 0x85, 0xA7, 0x30, 0x2E, 0x2E,
+    0xF9, 0x9B, 0x39, 0xC6, 0x9B, 0xCF, 0xEE, 0x47, 0x7E, 0x10, 0x7C, 0xE2, 0x4C, 0x8E, 0xBB, 0xE8,
+    0x4B, 0x76, 0x8F, 0xC4, 0x69, 0x87, 0x09, 0x5D, 0xE2, 0x0A, 0x33, 0x3C, 0xC7, 0xF6, 0x65, 0x51,
+    0xAA, 0x10, 0x5E, 0xE2, 0x7A, 0x29, 0x4B, 0x68, 0x40, 0xE7, 0x94, 0x3F, 0x3D, 0xA2, 0xA3, 0x97,
+    0xD8, 0x2A, 0x58, 0x82, 0x47, 0xE7, 0x47, 0x07, 0x62, 0x36, 0x3F, 0xD4, 0xA8, 0x63, 0x97, 0xE4,
+    0x82, 0x7B, 0xA4, 0xAA, 0xA8, 0x4A, 0x6C, 0x6A, 0xFB, 0x68, 0x04, 0xED, 0x3D, 0xFF, 0xEB, 0x8B,
+    0x24, 0x7C, 0xE9, 0x8D, 0x1F, 0xE0, 0xF5, 0x1A, 0x30, 0x9E, 0x09, 0x6E, 0xF5, 0x7E, 0x7B, 0x38,
+    0xB4, 0x26, 0x04, 0x8F, 0xFD, 0xC3, 0x53, 0xA4, 0x78, 0x97, 0xA0, 0x62, 0x52, 0xD0, 0xF2, 0x43,
+    0xD2, 0x90, 0x1E, 0x3E, 0x42, 0x12, 0x66, 0x02, 0x72, 0xCD, 0x08, 0x2D, 0x9E, 0x2E, 0xAE, 0x54,
+    0xD5, 0x09, 0xA1, 0xD6, 0x21, 0x34, 0xC0, 0xE1, 0x13, 0x25, 0x8F, 0xEB, 0xB5, 0xE7, 0xA2, 0x73,
+    0x9F, 0x7C, 0xE6, 0xBB, 0xCA, 0xF7, 0xE2, 0x72, 0x94, 0xD9, 0x93, 0x06, 0xE1, 0x40, 0x62, 0xD4,
+    0xB0, 0x8D, 0x76, 0xD3, 0x60, 0xB3, 0xD9, 0xD2, 0xF5, 0x96, 0xC4, 0x8D, 0x2C, 0xCC, 0x9F, 0x8E,
+    0x25, 0x13, 0xDE, 0xA6, 0x5D, 0xB2, 0x3B, 0x1C, 0x7E, 0x15, 0x4B, 0xEC, 0xF4, 0xF0, 0x88, 0xE4,
+    0xC6, 0x79, 0xE4, 0xE1, 0xC8, 0x2D, 0x84, 0x43, 0xA1, 0x16, 0xFA, 0xD5, 0x13, 0x44, 0xD2, 0xBF,
+    0xD9, 0xBA, 0xD1, 0x29, 0x47, 0x4F, 0x4F, 0xE3, 0x48, 0x15, 0xE1, 0x8A, 0xAC, 0x86, 0x45, 0xBC,
+    0xF2, 0x2D, 0x55, 0x8F, 0xC1, 0x72, 0xB3, 0xFC, 0xCD, 0x41, 0xCA, 0x62, 0x54, 0xA0, 0x69, 0x53,
+    0x5D, 0x4B, 0xE0, 0xFF, 0x04, 0xA9, 0x2D, 0x06, 0x50, 0x33, 0xE9, 0xFD, 0x62, 0x75, 0x1A, 0x9C,
+    0x34, 0xC4, 0x37, 0xD2, 0x67, 0xAE, 0xDF, 0x4D, 0xCA, 0x93, 0x26, 0x9E, 0x5B, 0x63, 0x19, 0xE5,
+    0x56, 0xA3, 0x7F, 0x0B, 0x57, 0x51, 0x58, 0x54, 0x32, 0x1C, 0x0E, 0xD9, 0xDB, 0xE0, 0xD4, 0xE5,
+    0xA1, 0xC7, 0x18, 0x9F, 0x52, 0x55, 0x6F, 0x83, 0xFA, 0x05, 0x35, 0x28, 0x8A, 0x01, 0x1B, 0x9C,
+    0x23, 0xA3, 0x4E, 0xCD, 0xBA, 0x71, 0x8C, 0x0F, 0x16, 0x12, 0x35, 0xB9, 0xCE, 0xB7, 0x43, 0x28,
+    0x53, 0x91, 0x02, 0x50, 0xB5, 0xFB, 0x98, 0x3B, 0x3B, 0xA0, 0xFF, 0xAA, 0xAB, 0xAA, 0xC0, 0x6E,
+    0x11, 0x95, 0x63, 0xD2, 0xE5, 0xCD, 0x17, 0xDF, 0xD7, 0xBB, 0x05, 0xD9, 0x62, 0x38, 0x63, 0x37,
+    0x06, 0xCA, 0x93, 0xAC, 0x82, 0xBA, 0x06, 0x1E, 0x82, 0x43, 0x64, 0x0E, 0x90, 0x95, 0x2B, 0x96,
+    0x1E, 0xD2, 0x92, 0xEA, 0x12, 0xF1, 0x3F, 0x6C, 0xEF, 0x80, 0x3B, 0x5E, 0xAA, 0x50, 0x0D, 0x87,
+    0xF7, 0x21, 0xA5, 0xEB, 0x57, 0xBF, 0x38, 0xCA, 0xBC, 0xC2, 0x29, 0x3E, 0xC6, 0xAE, 0x90, 0x64,
+    0x97, 0x4E, 0xAC, 0x09, 0x28, 0x82, 0x4C, 0xCE, 0x9A, 0xD1, 0xE3, 0x01, 0x3D, 0x7B, 0x34, 0x76,
+    0xB1, 0x17, 0x82, 0x9D, 0x86, 0x56, 0xD6, 0xD5, 0x0E, 0xFC, 0x31, 0x4E, 0x2A, 0x0C, 0x72, 0xEA,
+    0xF4, 0xCD, 0xDB, 0xDC, 0xE1, 0x4E, 0xC8, 0x42, 0xC2, 0x6E, 0x24, 0x67, 0x3C, 0x3B, 0xF2, 0x4F,
+    0xDA, 0x0F, 0x8F, 0xC9, 0x06, 0x27, 0x61, 0xFA, 0xD3, 0x1C, 0xFB, 0x24, 0x77, 0x82, 0xA8, 0x24,
+    0xA4, 0x47, 0x92, 0x64, 0x45, 0x75, 0xBD, 0x60, 0x35, 0x0D, 0x29, 0xD4, 0x94, 0x86, 0x24, 0x97,
+    0xC9, 0xC9, 0x2C, 0xE7, 0x74, 0x46, 0x3B, 0x41, 0x52, 0x08, 0x17, 0x58, 0x5F, 0x9C, 0x6E, 0x4C,
+    0x59, 0x55, 0x9F, 0x39, 0x7B, 0x14, 0x47, 0x2F, 0xB6, 0xAF, 0x3F, 0x16, 0xFF, 0x5A, 0x75, 0xC9,
+    0xB6, 0xFA, 0x2E, 0x43, 0xF3, 0xB8, 0xE8, 0x29, 0x76, 0x90, 0xAD, 0x8B, 0x4B, 0x26, 0x9A, 0x72,
+    0x93, 0x51, 0x22, 0x6C, 0x85, 0x59, 0x1C, 0x20, 0xBA, 0x24, 0x93, 0x65, 0xE2, 0x99, 0x7B, 0x82,
+    0xC5, 0xD9, 0x65, 0xD3, 0x9C, 0xEA, 0xCC, 0xB1, 0xBD, 0x48, 0x6B, 0x37, 0xD8, 0xF9, 0x2D, 0x76,
+    0xE0, 0x88, 0xFF, 0x93, 0xA1, 0xB8, 0x8D, 0x9B, 0xAC, 0xEE, 0x1D, 0x4E, 0x82, 0xFE, 0x83, 0x5A,
+    0x12, 0x5D, 0x25, 0x07, 0x6B, 0x83, 0x14, 0xFE, 0x82, 0x3E, 0x27, 0x56, 0x37, 0x62, 0x68, 0x26,
+    0xF1, 0xAC, 0xA2, 0x27, 0xAA, 0xB9, 0x57, 0xF2, 0x08, 0x60, 0xB2, 0x94, 0x34, 0x74, 0x25, 0x39,
+    0xDB, 0x1A, 0xCD, 0x2D, 0x92, 0x73, 0x4E, 0x98, 0xCD, 0x9C, 0xB1, 0xAA, 0x66, 0xEE, 0x3E, 0xAE,
+    0x88, 0xD3, 0xC8, 0x54, 0xED, 0xAD, 0x8E, 0x4C, 0x61, 0x23, 0x16, 0x90, 0x6B, 0x23, 0x7B, 0x03,
+    0x95, 0x45, 0xFC, 0x87, 0x92, 0x14, 0xCF, 0xB8, 0x37, 0xD6, 0x52, 0x25, 0xE1, 0x18, 0xE9, 0x11,
+    0x71, 0x4A, 0x9B, 0xEC, 0x98, 0x4A, 0x65, 0x05, 0x9E, 0xD3, 0xDE, 0xA7, 0x6E, 0x75, 0x60, 0x45,
+    0x13, 0x7A, 0x8D, 0x64, 0xAC, 0xC4, 0x9B, 0x01, 0xB3, 0x23, 0x4F, 0x5B, 0xC1, 0x72, 0x74, 0x69,
+    0x24, 0x5D, 0xCD, 0xC0, 0x03, 0xA2, 0x55, 0xC5, 0x82, 0xAD, 0x6F, 0x2C, 0x13, 0x87, 0x5C, 0x5F,
+    0xEC, 0x55, 0x72, 0xAB, 0xB0, 0xC0, 0x1D, 0x9E, 0xC4, 0x5B, 0x4A, 0xDA, 0xBD, 0x3A, 0x62, 0xEC,
+    0xE2, 0x34, 0x09, 0x7F, 0x7B, 0xDC, 0xF1, 0x34, 0x3C, 0x95, 0x5B, 0x26, 0x5A, 0x34, 0x3F, 0xE7,
+    0x8D, 0x24, 0x33, 0x9D, 0x85, 0x96, 0xFB, 0x0F, 0xC5, 0x5F, 0x8A, 0xAE, 0xDA, 0x23, 0xC0, 0xB7,
+    0xC7, 0x6F, 0xBB, 0x3E, 0x5A, 0x5E, 0x9A, 0xBC, 0x09, 0x88, 0xCF, 0xB6, 0xE4, 0xC8, 0xF8, 0xBF,
+    0xD7, 0x3A, 0x64, 0xF3, 0x12, 0xFB, 0x9C, 0xF2, 0x31, 0xFB, 0xD5, 0x27, 0x0C, 0xC3, 0x72, 0x62,
+    0xC7, 0x4B, 0xA1, 0x66, 0xE6, 0xF4, 0x8A, 0xC4, 0x90, 0x4A, 0x55, 0xB5, 0xC2, 0xCE, 0xD8, 0x9A,
+    0xE7, 0x85, 0x53, 0x75, 0xC4, 0x4B, 0x09, 0x72, 0x39, 0xC5, 0xA5, 0x29, 0x59, 0x89, 0x5C, 0x99,
+    0x9D, 0xB9, 0xC5, 0x0D, 0xAD, 0xFF, 0x00, 0xA5, 0x55, 0xBF, 0x6F, 0xDB, 0x46, 0x18, 0x7D, 0x24,
+    0x6D, 0xB3, 0x35, 0xD1, 0x9C, 0x3B, 0x04, 0x28, 0xE2, 0x02, 0xDC, 0x8B, 0x5A, 0x5C, 0xBA, 0x14,
+    0x10, 0x2D, 0x6E, 0xD9, 0x8A, 0x0C, 0xD6, 0xDA, 0x7F, 0x20, 0x43, 0x57, 0x0F, 0x8C, 0x79, 0x99,
+    0xBA, 0x7A, 0xE8, 0xDE, 0xCE, 0x9E, 0x32, 0x78, 0xD0, 0x60, 0x43, 0xA7, 0x78, 0xC8, 0xD0, 0xA1,
+    0xCC, 0xD0, 0x31, 0x28, 0xDB, 0x21, 0x1D, 0xBA, 0x1C, 0x6A, 0x0E, 0x74, 0x2D, 0xEB, 0xFA, 0xBE,
+    0xA3, 0x64, 0x39, 0x41, 0x51, 0x24, 0x2D, 0x21, 0x1D, 0x74, 0x77, 0x1F, 0xBF, 0xEF, 0xBD, 0xF7,
+    0xFD, 0x10, 0x80, 0x4F, 0xC0, 0x27, 0xB1, 0x5C, 0x42, 0x67, 0xB8, 0x4E, 0x72, 0x2E, 0x03, 0xD4,
+    0xE8, 0x9F, 0xF1, 0x41, 0x30, 0x2E, 0x94, 0x2B, 0xAA, 0x1B, 0xA4, 0x1A, 0xE7, 0x08, 0x2C, 0x12,
+    0x83, 0x0C, 0xE8, 0x10, 0x36, 0x50, 0x05, 0x68, 0x6E, 0x11, 0xD5, 0x48, 0x81, 0xCA, 0x39, 0xDE,
+    0x3A, 0xB7, 0x90, 0x5B, 0x1E, 0xF1, 0xB6, 0x94, 0x5B, 0xBE, 0xC0, 0xDB, 0x09, 0x42, 0x2B, 0x47,
+    0xFB, 0x40, 0x8B, 0xDD, 0x0E, 0xD5, 0x71, 0xEC, 0xEA, 0xCC, 0x01, 0x01, 0xC3, 0x54, 0x40, 0xCC,
+    0xD7, 0xCA, 0x1C, 0xB1, 0xFE, 0xC2, 0x07, 0x0E, 0x04, 0x10, 0xB0, 0x75, 0x06, 0x89, 0x89, 0x44,
+    0x03, 0x43, 0x88, 0x37, 0xC4, 0x4F, 0x6F, 0xB0, 0x97, 0x75, 0xF8, 0xF3, 0x37, 0x1B, 0xBD, 0x4A,
+    0x74, 0x5A, 0xE7, 0x98, 0xC2, 0x86, 0x36, 0x36, 0x4A, 0x0F, 0x68, 0xD4, 0x06, 0x36, 0x9A, 0x25,
+    0x5A, 0x0D, 0x73, 0x54, 0xB5, 0xC5, 0xFC, 0x5F, 0x88, 0x84, 0xD3, 0x93, 0x93, 0x85, 0x1E, 0x39,
+    0xE7, 0xE6, 0x6F, 0x11, 0x69, 0xFE, 0x03, 0x91, 0x1D, 0x20, 0x23, 0xBE, 0xC7, 0x94, 0x91, 0x66,
+    0xDB, 0x8B, 0x63, 0x3C, 0xFE, 0xAB, 0x80, 0x62, 0xF0, 0xC3, 0x6D, 0x1D, 0xBE, 0x74, 0x5A, 0x65,
+    0x47, 0xC8, 0x9B, 0x49, 0xB0, 0x88, 0xEA, 0xC4, 0x2A, 0xAA, 0x58, 0xA2, 0x0B, 0x9B, 0xC8, 0xA8,
+    0x22, 0xC5, 0x70, 0x67, 0x82, 0xCB, 0x8B, 0x3A, 0xBE, 0x51, 0x50, 0xC6, 0x23, 0xDE, 0x0C, 0xA0,
+    0x7E, 0x35, 0xB1, 0xB3, 0xE1, 0x45, 0xEB, 0x9D, 0xF3, 0x68, 0x5C, 0x44, 0x84, 0x46, 0x02, 0xB1,
+    0x11, 0x14, 0xC4, 0x22, 0xB8, 0x09, 0x66, 0xB9, 0xEF, 0xFA, 0x3D, 0xD6, 0xFB, 0x60, 0xAA, 0x03,
+    0xD7, 0xCA, 0xCB, 0xE7, 0x9F, 0xA6, 0xD7, 0xCF, 0x2F, 0xDA, 0x8D, 0x0D, 0xEF, 0x3D, 0x9C, 0xA3,
+    0x32, 0x54, 0x8B, 0x86, 0x13, 0x3A, 0xA0, 0x1C, 0x99, 0x50, 0x1D, 0xEE, 0xC4, 0x3F, 0x61, 0x6A,
+    0xE2, 0x66, 0x99, 0x7F, 0xA4, 0x8E, 0x10, 0x56, 0xBB, 0xFB, 0x63, 0x28, 0xA7, 0x71, 0xE4, 0x09,
+    0x52, 0x0D, 0x96, 0x00, 0x35, 0x90, 0x90, 0xFD, 0x3E, 0xEA, 0xF7, 0xC3, 0x3B, 0xFB, 0xAD, 0x05,
+    0x28, 0x0F, 0xB6, 0x4F, 0x9E, 0xBA, 0x65, 0x26, 0xDE, 0x2D, 0x34, 0xF9, 0xDE, 0x83, 0x89, 0x5E,
+    0x37, 0x98, 0x36, 0x08, 0x8A, 0xFF, 0xCD, 0xBE, 0xFE, 0x20, 0x7D, 0x68, 0xA8, 0x65, 0xF7, 0xEE,
+    0x10, 0xC6, 0x07, 0x0C, 0x17, 0x74, 0x62, 0x94, 0x49, 0xB0, 0x55, 0x25, 0x48, 0xFA, 0x75, 0x5F,
+    0x2F, 0xF1, 0xB2, 0x17, 0x76, 0x3B, 0x09, 0x93, 0x14, 0x78, 0x86, 0xC8, 0x40, 0x7D, 0x87, 0xAC,
+    0x6F, 0xA0, 0xD0, 0xA6, 0xE6, 0x09, 0xFA, 0x16, 0xAB, 0x8C, 0x42, 0x19, 0x36, 0xAA, 0x28, 0x43,
+    0xAB, 0x8A, 0xE1, 0xC7, 0x97, 0x3F, 0xCE, 0x53, 0xF3, 0x39, 0xEA, 0x04, 0xFB, 0x8F, 0x2A, 0x4F,
+    0xB0, 0x90, 0xD4, 0x57, 0x5E, 0xC2, 0x25, 0xDF, 0xD1, 0x42, 0xE8, 0xFA, 0x90, 0x89, 0x0F, 0xD9,
+    0xDE, 0x86, 0x14, 0x34, 0x58, 0xA1, 0x21, 0xCF, 0xD4, 0x15, 0xD9, 0x8B, 0x79, 0x64, 0xCA, 0x44,
+    0xB7, 0x69, 0x68, 0xF3, 0x68, 0x56, 0x5E, 0xCF, 0x8F, 0x3C, 0x8D, 0xCD, 0x31, 0x46, 0x8B, 0xC4,
+    0x19, 0x72, 0xA9, 0x84, 0x00, 0xD1, 0x7B, 0xBA, 0x74, 0xE9, 0x4B, 0xBE, 0x14, 0xBF, 0x19, 0xEE,
+    0xDC, 0xD0, 0xE3, 0xEA, 0xC6, 0xFE, 0xC3, 0x0D, 0xAB, 0xFE, 0x8C, 0x95, 0x51, 0xEC, 0x0B, 0x4C,
+    0x29, 0xF0, 0x0D, 0xE9, 0xCF, 0xE4, 0x7B, 0xB3, 0x9A, 0x22, 0x9F, 0x15, 0xCB, 0x54, 0xDB, 0xB0,
+    0x49, 0x8D, 0x68, 0xF0, 0x04, 0xEB, 0x27, 0xB1, 0xA2, 0x86, 0xE8, 0x41, 0x45, 0x44, 0x13, 0x51,
+    0x25, 0x29, 0x4A, 0xE4, 0x24, 0x43, 0x6D, 0x62, 0x33, 0xDC, 0x19, 0x04, 0x97, 0xA6, 0x4D, 0xC8,
+    0x27, 0xD5, 0x8C, 0x2F, 0x92, 0x50, 0x58, 0x0E, 0x26, 0xBC, 0x26, 0x30, 0x36, 0x5B, 0xD2, 0xE7,
+    0xE8, 0x07, 0x7E, 0xB9, 0xC3, 0x35, 0xB7, 0x1D, 0xEB, 0xEE, 0x34, 0xBA, 0xD5, 0x0E, 0x52, 0x2C,
+    0x22, 0x9F, 0xC0, 0xF6, 0x43, 0x84, 0xA0, 0xBD, 0x0B, 0x49, 0xE3, 0x9B, 0x87, 0xFB, 0xAB, 0x43,
+    0xF3, 0xF6, 0x21, 0x7C, 0x35, 0x89, 0x75, 0xF4, 0x07, 0xDD, 0x89, 0xCB, 0xED, 0xE3, 0x5B, 0x26,
+    0x84, 0x16, 0xDC, 0xD0, 0x4A, 0x74, 0x6A, 0x69, 0xBC, 0x1A, 0x9B, 0x52, 0x60, 0x7E, 0x18, 0xC4,
+    0xFD, 0x30, 0x90, 0x52, 0x95, 0x80, 0xE2, 0x8E, 0xB6, 0xD2, 0x37, 0x12, 0x6E, 0xB8, 0x1E, 0x6E,
+    0x79, 0xFF, 0x93, 0xA7, 0x5F, 0x9E, 0x21, 0xA0, 0x88, 0xA1, 0xAF, 0x82, 0xF1, 0xA3, 0xFB, 0x07,
+    0x70, 0xED, 0x68, 0x4E, 0x22, 0x4A, 0x86, 0x13, 0x41, 0x65, 0x01, 0xAF, 0x06, 0x31, 0xDD, 0xE5,
+    0x22, 0x4D, 0x2E, 0x58, 0x2B, 0x91, 0x63, 0x2A, 0xCB, 0x95, 0xBC, 0xD7, 0xCA, 0x99, 0x1D, 0x89,
+    0x4F, 0x0A, 0x10, 0x5A, 0xAA, 0x15, 0x35, 0x11, 0xEB, 0xF4, 0x8A, 0x6A, 0x55, 0x0B, 0x8C, 0xCC,
+    0x12, 0xA7, 0xE8, 0x17, 0xF8, 0x48, 0xB2, 0x04, 0xE2, 0x40, 0x34, 0xC0, 0x66, 0xDF, 0x83, 0xAA,
+    0xC5, 0x83, 0x56, 0x6A, 0x80, 0xD8, 0x08, 0x5A, 0x54, 0x78, 0xDE, 0x45, 0xBF, 0x9C, 0xC7, 0xED,
+    0x5E, 0x52, 0xE7, 0x4A, 0x4F, 0x54, 0x6C, 0xD3, 0x69, 0xC1, 0x69, 0x9C, 0x97, 0x18, 0xEE, 0xA3,
+    0x4C, 0xF5, 0x61, 0x72, 0x75, 0x2A, 0x9A, 0x78, 0xDF, 0xAD, 0xFF, 0x58, 0xF1, 0x19, 0xF8, 0x78,
+    0xDF, 0xE8, 0xA3, 0xE9, 0xCC, 0xC5, 0xDF, 0xFE, 0x9C, 0x7C, 0x0D, 0x75, 0x08, 0x65, 0xE5, 0x93,
+    0x9E, 0x62, 0xC0, 0xD7, 0xF3, 0x60, 0x98, 0x7E, 0x55, 0xAA, 0xF9, 0x69, 0xD4, 0x37, 0xC0, 0x56,
+    0x9F, 0x87, 0xB4, 0x41, 0x48, 0x7F, 0x1F, 0xAE, 0x13, 0xCB, 0xAE, 0xF0, 0x79, 0x15, 0x25, 0xD7,
+    0xF2, 0x49, 0x24, 0x91, 0x5B, 0x34, 0xE9, 0xEE, 0xCA, 0xFD, 0x11, 0x8D, 0x9E, 0x29, 0x1D, 0xCF,
+    0xA6, 0xEE, 0x26, 0x95, 0xFF, 0x28, 0x12, 0xAD, 0xE3, 0x36, 0xED, 0xEE, 0x1D, 0x7B, 0xA6, 0x95,
+    0x79, 0x60, 0x69, 0x36, 0xA0, 0xF8, 0x91, 0x21, 0xD1, 0x09, 0xF6, 0xD6, 0x3F, 0x73, 0x3A, 0x89,
+    0x67, 0xE1, 0xEF, 0xDA, 0x99, 0x4C, 0xF7, 0x53, 0xC1, 0x17, 0x16, 0x7B, 0xE9, 0x36, 0xDA, 0x2A,
+    0xB9, 0xC5, 0x2D, 0x24, 0xB5, 0x84, 0xD4, 0x57, 0x40, 0x9D, 0x21, 0x21, 0xA4, 0x72, 0xD7, 0xB9,
+    0x97, 0xFC, 0xAF, 0xE9, 0x0B, 0x44, 0xBF, 0x61, 0xA5, 0xFA, 0x91, 0xF7, 0x9E, 0x68, 0x02, 0x4D,
+    0xB7, 0x72, 0xA6, 0x96, 0xF2, 0xBE, 0xE7, 0xF3, 0x37, 0x9D, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14,
+    0xFE, 0x76, 0x07, 0x7B, 0x25, 0x96, 0x68, 0x52, 0x40, 0xE3, 0x10, 0x6F, 0x8F, 0xF0, 0x6D, 0x93,
+    0x82, 0xE2, 0xF6, 0x6E, 0x25, 0x17, 0x29, 0x28, 0x92, 0xC2, 0xA6, 0x89, 0x10, 0x2D, 0x15, 0xA1,
+    0x74, 0x71, 0x97, 0x1B, 0x04, 0x12, 0x45, 0x8A, 0xF8, 0x17, 0xD0, 0x83, 0x90, 0x9C, 0xC2, 0xC5,
+    0x21, 0x8C, 0x6F, 0x22, 0x17, 0x2E, 0x52, 0xB0, 0x81, 0x82, 0x82, 0x82, 0x41, 0x0A, 0x0D, 0x14,
+    0x8C, 0xC8, 0x02, 0x8B, 0x59, 0xDF, 0xF0, 0xBD, 0xBD, 0xB3, 0xE3, 0x48, 0x20, 0xA4, 0x8C, 0x34,
+    0xA7, 0xD3, 0xBC, 0x99, 0xF7, 0xBE, 0xF7, 0xBD, 0xEF, 0xBD, 0x05, 0xBA, 0xD5, 0xC7, 0xF6, 0x56,
+    0x1F, 0xA1, 0xD9, 0x41, 0x66, 0xEE, 0x23, 0x83, 0x43, 0x8E, 0x12, 0x3D, 0x5A, 0x8A, 0xE5, 0x1E,
+    0x71, 0x1F, 0x70, 0x37, 0xDC, 0x35, 0xB7, 0x07, 0x22, 0x8F, 0x6B, 0xB1, 0xC7, 0x7D, 0xE5, 0x22,
+    0x7F, 0x25, 0x84, 0x6A, 0x12, 0x82, 0x05, 0x2E, 0x23, 0x72, 0x2B, 0xE9, 0xF5, 0xB6, 0xBF, 0xE6,
+    0x5D, 0x72, 0x8C, 0xDE, 0x0B, 0xBC, 0xAE, 0x2C, 0x7D, 0x62, 0x8A, 0xB8, 0x82, 0x2E, 0x19, 0x8C,
+    0x2F, 0x53, 0x23, 0x6E, 0x3D, 0x92, 0x07, 0xE8, 0xED, 0x20, 0xD8, 0xB8, 0x59, 0x20, 0xD9, 0xDE,
+    0x02, 0x71, 0x80, 0x38, 0x20, 0x6F, 0x88, 0x03, 0x4B, 0x1C, 0xEF, 0x72, 0xB7, 0x18, 0x45, 0x2D,
+    0x71, 0xEC, 0xFE, 0x2F, 0x8E, 0x9B, 0x51, 0xC0, 0x9A, 0xA7, 0x8B, 0xD8, 0xF1, 0x1D, 0x01, 0x8C,
+    0x24, 0xE4, 0xFE, 0x55, 0x7D, 0xDD, 0xFB, 0x71, 0x16, 0x9D, 0x9F, 0x5E, 0x4E, 0x3F, 0x61, 0xF4,
+    0xD4, 0x9D, 0x05, 0x57, 0xC1, 0x21, 0xA2, 0xF3, 0xC4, 0x2E, 0x62, 0x4F, 0x01, 0x55, 0x01, 0xFA,
+    0x10, 0x98, 0x54, 0x48, 0x6A, 0x44, 0xC1, 0xE0, 0xC5, 0x62, 0x11, 0x99, 0x97, 0xAA, 0x1C, 0x29,
+    0xC1, 0x8C, 0x18, 0xF8, 0x51, 0x08, 0x01, 0x58, 0x41, 0xE6, 0xA3, 0x3D, 0x01, 0xD5, 0x93, 0x97,
+    0x7D, 0xB9, 0x74, 0x68, 0xD3, 0x9A, 0x4E, 0x67, 0x18, 0x3C, 0x3D, 0x7D, 0x80, 0x2F, 0x9C, 0x6E,
+    0x71, 0xB8, 0x48, 0x1B, 0xB1, 0xFC, 0x24, 0x8C, 0x04, 0x4D, 0xC7, 0xC8, 0x04, 0xD0, 0xEA, 0xD2,
+    0x86, 0x95, 0x9B, 0x78, 0x65, 0x4B, 0x9D, 0x22, 0x9B, 0x23, 0x37, 0x84, 0x94, 0x78, 0x6C, 0x20,
+    0x9E, 0x43, 0x03, 0x7F, 0x5B, 0x66, 0xD1, 0x6F, 0x22, 0x07, 0x9D, 0x63, 0x1F, 0xC9, 0x87, 0x55,
+    0x41, 0x9A, 0x0F, 0x68, 0xF1, 0x7A, 0x93, 0x16, 0xF5, 0xA3, 0x23, 0x09, 0x23, 0x5A, 0x8C, 0x3E,
+    0xA0, 0x85, 0xB4, 0x10, 0xF9, 0x90, 0x98, 0xCA, 0xC4, 0x45, 0xC1, 0x77, 0x24, 0x9E, 0x2F, 0x16,
+    0x08, 0x63, 0x48, 0x91, 0x24, 0xE9, 0x6B, 0x67, 0xC7, 0xB7, 0xCD, 0x61, 0xDA, 0x0E, 0x7D, 0x72,
+    0xEF, 0x46, 0xF9, 0xA5, 0xF5, 0xDA, 0x67, 0x38, 0x8D, 0x9D, 0x36, 0x45, 0xE4, 0x95, 0xED, 0x61,
+    0xA4, 0xAA, 0xF4, 0xA3, 0x3E, 0x7E, 0xFF, 0xCE, 0xEA, 0x66, 0x8A, 0xF9, 0x82, 0x49, 0x44, 0xDB,
+    0xE5, 0x90, 0xD1, 0x1C, 0x0B, 0x4B, 0xE2, 0x27, 0xE2, 0x3A, 0x77, 0x0C, 0x4D, 0x14, 0x7D, 0xA8,
+    0xAF, 0xCD, 0x3A, 0xF0, 0x9B, 0x4F, 0x4B, 0xEC, 0x14, 0x0C, 0xB5, 0x91, 0x5A, 0x5A, 0x50, 0xD3,
+    0x62, 0x07, 0xEB, 0x24, 0x2F, 0x79, 0x48, 0x0B, 0x93, 0x63, 0x9E, 0x99, 0x58, 0x54, 0x8B, 0xF4,
+    0x31, 0xEE, 0x20, 0x0B, 0x02, 0x6E, 0x09, 0xD6, 0x60, 0x29, 0x82, 0x4E, 0xA1, 0x9D, 0x5C, 0x84,
+    0x12, 0x2A, 0x62, 0x79, 0x63, 0xB5, 0x49, 0xDD, 0xEC, 0x28, 0x60, 0xA7, 0xAE, 0x53, 0x52, 0x12,
+    0x22, 0xAF, 0xAB, 0x1E, 0x1A, 0x55, 0x65, 0xE8, 0xC7, 0x2E, 0xB1, 0x05, 0xA6, 0x9B, 0x56, 0xBF,
+    0x3D, 0x42, 0xB8, 0x6B, 0x74, 0x27, 0x81, 0xD5, 0xB2, 0x93, 0xB9, 0x54, 0x9F, 0x8E, 0x37, 0x9E,
+    0xBA, 0xE2, 0xBA, 0x24, 0x25, 0x57, 0x56, 0x02, 0x7E, 0x25, 0x3F, 0xBA, 0x3E, 0x8F, 0x2F, 0x31,
+    0xB7, 0xB0, 0xB2, 0x8D, 0x50, 0x26, 0xC1, 0x50, 0x4D, 0x3D, 0x50, 0xA7, 0xCC, 0x6E, 0x66, 0x58,
+    0x1E, 0x56, 0x9D, 0x39, 0x0C, 0x98, 0x90, 0x7A, 0x68, 0x37, 0xD8, 0x1F, 0x35, 0x73, 0xD8, 0xCF,
+    0xA5, 0x70, 0xAA, 0x92, 0xEC, 0xD8, 0x77, 0x89, 0xCD, 0xC4, 0xA2, 0x7E, 0x05, 0xAB, 0x38, 0xA1,
+    0x45, 0x74, 0x90, 0xEF, 0x52, 0x35, 0x93, 0x76, 0x91, 0xDE, 0x72, 0xA9, 0x72, 0x1F, 0x7D, 0x56,
+    0xFF, 0x17, 0x03, 0x81, 0x3C, 0x7A, 0xEE, 0x1A, 0x45, 0xC2, 0x63, 0x2E, 0x3F, 0x63, 0x74, 0x4D,
+    0x04, 0x29, 0x94, 0xCC, 0x02, 0xD1, 0xC1, 0x2C, 0x6A, 0x2F, 0x25, 0xED, 0x90, 0xD9, 0x3D, 0xF9,
+    0xD6, 0x21, 0xF9, 0x9C, 0x88, 0x73, 0x4B, 0xD3, 0x9C, 0x17, 0x95, 0xE7, 0x45, 0x5D, 0x16, 0x12,
+    0xDD, 0xB3, 0xC1, 0xA8, 0x65, 0x5D, 0xB2, 0x8B, 0xFB, 0x98, 0xD9, 0xC8, 0x9F, 0x77, 0xF2, 0xF3,
+    0x4B, 0xA0, 0x27, 0x12, 0x50, 0xFF, 0x2A, 0x81, 0x71, 0x27, 0x81, 0x8E, 0x08, 0xBB, 0x14, 0x2C,
+    0xFE, 0x90, 0xD2, 0x4D, 0xBA, 0x8E, 0xD9, 0xED, 0x42, 0x5F, 0x71, 0xF9, 0x5D, 0x72, 0xB1, 0x5E,
+    0x14, 0x2C, 0xBB, 0x6A, 0x13, 0x4B, 0x2A, 0x06, 0xA8, 0x59, 0xF5, 0xD4, 0x64, 0x64, 0xC2, 0x78,
+    0x55, 0x11, 0x7A, 0x4F, 0xD8, 0xEB, 0x75, 0x9A, 0x49, 0x8D, 0xFA, 0xDE, 0x72, 0x10, 0x74, 0x73,
+    0xA7, 0x63, 0x27, 0xB4, 0xF4, 0x39, 0xBF, 0x40, 0xFC, 0x5A, 0xC9, 0xC3, 0x39, 0xD4, 0x5F, 0xB7,
+    0xBC, 0xF2, 0xB8, 0xC3, 0xAD, 0x1F, 0x78, 0x44, 0x35, 0xD3, 0x2D, 0xE8, 0x47, 0xDF, 0x26, 0xA4,
+    0x1F, 0x0C, 0xA2, 0x27, 0x04, 0x72, 0xC0, 0xC3, 0xC1, 0x80, 0x92, 0xD4, 0x16, 0xFA, 0x83, 0x1A,
+    0xA9, 0x1D, 0x96, 0x99, 0x55, 0xF3, 0x99, 0x45, 0x3E, 0x5F, 0xEA, 0xF7, 0xB5, 0xCF, 0x98, 0x8A,
+    0x7D, 0xEA, 0xFF, 0x4A, 0x83, 0x3C, 0x98, 0x61, 0xE4, 0x73, 0x14, 0xBA, 0xD4, 0x1F, 0x5B, 0xF5,
+    0x8D, 0x43, 0x5D, 0xA3, 0x5F, 0xA0, 0xA7, 0x8D, 0x8E, 0xBD, 0x36, 0x93, 0x3D, 0x93, 0x84, 0xC5,
+    0xF3, 0x4E, 0x97, 0xEE, 0x25, 0x86, 0x79, 0x8F, 0xE8, 0x05, 0xE7, 0xCB, 0x67, 0xA2, 0x27, 0x07,
+    0x13, 0x0E, 0xA9, 0xF9, 0x5B, 0x2D, 0xE7, 0x65, 0x66, 0x5A, 0xD6, 0x8B, 0xF8, 0xC6, 0x84, 0xA3,
+    0xDF, 0x21, 0x46, 0xE6, 0x89, 0x3F, 0x45, 0x39, 0xC4, 0x98, 0xCB, 0xE1, 0x3D, 0x83, 0xE4, 0x88,
+    0x55, 0x75, 0x63, 0x30, 0x48, 0xC5, 0xE1, 0x12, 0xF6, 0x38, 0xA0, 0xC3, 0xEE, 0x45, 0xE9, 0x1B,
+    0xF5, 0x88, 0xE7, 0x3C, 0x76, 0x67, 0x7A, 0x9F, 0x99, 0x38, 0x34, 0xCA, 0x67, 0x31, 0xC9, 0xAC,
+    0xD1, 0x8C, 0x50, 0xF4, 0xA0, 0x6F, 0x94, 0xEA, 0xA8, 0x8A, 0x5D, 0x03, 0x66, 0xD1, 0x24, 0x27,
+    0x54, 0xEF, 0x33, 0xF3, 0xA5, 0x7A, 0x95, 0xD8, 0xE8, 0x22, 0x3F, 0x6A, 0xA1, 0xAB, 0x53, 0x1E,
+    0x5C, 0xBA, 0x80, 0x3A, 0xE3, 0xEC, 0xD5, 0x3F, 0xDD, 0xB6, 0x42, 0x2F, 0x04, 0x36, 0x3B, 0x3A,
+    0xDB, 0x64, 0xC0, 0x5A, 0xF8, 0x7D, 0x53, 0x7A, 0x52, 0xBE, 0x0C, 0xDA, 0x10, 0xA7, 0x10, 0xCC,
+    0x3F, 0x89, 0x65, 0x99, 0x1A, 0xCE, 0xCD, 0x1C, 0xC2, 0x70, 0x87, 0x3C, 0x0E, 0x8F, 0x2F, 0x84,
+    0xBC, 0xF6, 0x3A, 0xF4, 0x71, 0x25, 0x0F, 0x88, 0x2F, 0x55, 0xE6, 0xBC, 0x5F, 0x9C, 0xD0, 0xAD,
+    0xED, 0x48, 0xF0, 0x17, 0x18, 0x24, 0x56, 0x55, 0x53, 0x61, 0x5E, 0x3A, 0x7C, 0x4A, 0xC2, 0x71,
+    0xA0, 0x9C, 0x64, 0x90, 0x9D, 0x2E, 0x5F, 0x6C, 0x6F, 0xF3, 0xFB, 0x90, 0x73, 0xC8, 0xBB, 0xF4,
+    0xE4, 0xD6, 0xCF, 0x7B, 0xE6, 0x90, 0x13, 0xE7, 0x6A, 0x5A, 0x71, 0x1E, 0xBF, 0x3F, 0x96, 0x79,
+    0xA9, 0x9C, 0xCC, 0xA6, 0xAC, 0xEB, 0x49, 0x8E, 0xDA, 0x93, 0x4F, 0x79, 0x90, 0x86, 0x9A, 0x28,
+    0xC9, 0xF2, 0xA0, 0x9B, 0x14, 0x8D, 0x4C, 0x16, 0xA6, 0x97, 0x63, 0x95, 0x98, 0x1B, 0xBC, 0xA1,
+    0x2B, 0x55, 0xC5, 0x95, 0x3E, 0x99, 0xF1, 0xD3, 0x91, 0xD2, 0x75, 0x73, 0x91, 0xAD, 0x68, 0x56,
+    0x4E, 0x4C, 0x1E, 0xEE, 0xED, 0x6D, 0xFA, 0xCC, 0xF7, 0x98, 0xA1, 0xC8, 0xA1, 0x49, 0x8F, 0x89,
+    0xF4, 0x80, 0x5C, 0xCF, 0x4C, 0x8D, 0xA1, 0xE3, 0x7B, 0x2A, 0x91, 0x89, 0x44, 0x39, 0xA7, 0xCF,
+    0x74, 0xB2, 0x37, 0x0B, 0x76, 0x52, 0x0F, 0x9F, 0xA1, 0xFD, 0xBF, 0xD7, 0x3F, 0xB5, 0x95, 0xBD,
+    0x6F, 0x1C, 0x45, 0x18, 0xC6, 0x9F, 0xDD, 0xC5, 0x5E, 0x25, 0x23, 0xB1, 0x29, 0x1C, 0x04, 0xB2,
+    0xC8, 0xBA, 0x44, 0x28, 0xBE, 0xA5, 0x48, 0x41, 0x71, 0xE7, 0x1D, 0x0A, 0x68, 0x68, 0x82, 0xE4,
+    0x13, 0x12, 0x0D, 0x74, 0x88, 0xCA, 0x14, 0x14, 0x17, 0x71, 0xF8, 0x46, 0x69, 0x69, 0xAE, 0xA0,
+    0x45, 0x71, 0x41, 0x43, 0x22, 0x25, 0x11, 0x72, 0x71, 0xC5, 0x99, 0x1D, 0xD3, 0xA6, 0xD9, 0xE4,
+    0x1F, 0xC8, 0x22, 0x10, 0xA0, 0x44, 0x22, 0x23, 0xB4, 0x52, 0x36, 0xD6, 0xDD, 0x0D, 0xCF, 0xCC,
+    0xDE, 0xC5, 0x48, 0x20, 0x45, 0x44, 0xB0, 0xB6, 0xA5, 0xDD, 0xF9, 0x78, 0xDF, 0xE7, 0xFD, 0xBD,
+    0x1F, 0x06, 0x70, 0x19, 0xC0, 0x14, 0x08, 0x16, 0x40, 0x34, 0xE7, 0xFB, 0x18, 0xED, 0xF3, 0xC1,
+    0x18, 0xB1, 0xB5, 0x2A, 0xB8, 0xF6, 0x4E, 0x8D, 0x58, 0xE7, 0x08, 0x4D, 0xAC, 0x31, 0x09, 0x0C,
+    0x7A, 0x68, 0x90, 0xF0, 0x4A, 0x7C, 0x3C, 0x47, 0x68, 0x1B, 0x60, 0x51, 0x03, 0xBD, 0x0C, 0x48,
+    0xA2, 0x92, 0x27, 0xA7, 0x08, 0xAB, 0x44, 0xA1, 0x09, 0x9A, 0xA0, 0x18, 0x67, 0xC7, 0xB6, 0x09,
+    0x66, 0x58, 0x3D, 0x91, 0x46, 0x06, 0x9A, 0x48, 0x80, 0x4F, 0xDB, 0x95, 0xEC, 0xEA, 0x1F, 0x36,
+    0xD3, 0x57, 0x4E, 0x82, 0xDF, 0x21, 0x6E, 0x23, 0x97, 0xB4, 0x1D, 0x97, 0x3C, 0x84, 0xDA, 0x1D,
+    0xE6, 0xB9, 0x01, 0x0F, 0xAD, 0x7D, 0x0B, 0x8C, 0xE8, 0xE9, 0x95, 0x7A, 0x4F, 0x62, 0x18, 0x19,
+    0xEE, 0x0F, 0x21, 0x54, 0x8A, 0xA8, 0xA4, 0x27, 0x23, 0x34, 0x86, 0x29, 0x2F, 0x59, 0x85, 0xE4,
+    0x91, 0x44, 0x74, 0xCF, 0x00, 0xA6, 0x07, 0x0C, 0xB9, 0xD1, 0x71, 0x62, 0x55, 0xAA, 0x36, 0x9F,
+    0x84, 0xB3, 0xD4, 0xAA, 0x54, 0x7B, 0xAF, 0x67, 0x9D, 0x96, 0x0A, 0xCE, 0x0B, 0xD0, 0x5D, 0xFE,
+    0xBD, 0xB0, 0x14, 0xF9, 0xBD, 0xD0, 0xC5, 0x1D, 0x13, 0xFC, 0xFA, 0x1B, 0x3E, 0x57, 0xE8, 0x50,
+    0x44, 0xE9, 0xCE, 0x06, 0xB5, 0xC7, 0x44, 0xB3, 0x89, 0x8F, 0x23, 0xA8, 0xFC, 0xE1, 0xD7, 0xF8,
+    0x4D, 0x97, 0x25, 0x3D, 0xFA, 0xDF, 0x73, 0xAB, 0x50, 0x43, 0x7D, 0x81, 0x17, 0x52, 0x6E, 0xDF,
+    0x22, 0x5C, 0xCB, 0x95, 0x0B, 0xCB, 0x9D, 0x97, 0xBE, 0xE1, 0xB7, 0xAD, 0xF0, 0xF1, 0xDD, 0x23,
+    0xB2, 0x48, 0x34, 0xA6, 0x24, 0xD2, 0x61, 0x44, 0x89, 0xDC, 0xA1, 0x65, 0x07, 0x68, 0x24, 0x51,
+    0x30, 0x1F, 0xF9, 0x11, 0xAF, 0xBF, 0xAB, 0xB9, 0x58, 0x73, 0x91, 0x50, 0x26, 0x14, 0xB2, 0x83,
+    0x7D, 0xEC, 0xFD, 0x2C, 0xCC, 0x68, 0x81, 0xD1, 0xCA, 0x59, 0xA0, 0xBB, 0x41, 0x65, 0xF0, 0xB8,
+    0x04, 0x6F, 0x76, 0xB0, 0x42, 0x6B, 0x18, 0x47, 0x7C, 0xED, 0x20, 0x9E, 0x38, 0xB6, 0x0C, 0x83,
+    0xB0, 0x52, 0xE9, 0xE0, 0xF6, 0x7C, 0xC4, 0xDD, 0x96, 0x2E, 0x42, 0x38, 0xE6, 0x82, 0x69, 0xA9,
+    0xB0, 0x2E, 0xFD, 0xDD, 0x4F, 0x64, 0x68, 0xE7, 0x61, 0xFD, 0xE1, 0x5B, 0x26, 0x2C, 0xA7, 0xB8,
+    0x9D, 0x61, 0x43, 0x30, 0x44, 0x4A, 0x4A, 0x89, 0x81, 0x9C, 0x63, 0xA6, 0x3D, 0x0F, 0x11, 0xDF,
+    0x2D, 0x51, 0x1F, 0x62, 0x98, 0x61, 0x47, 0x9C, 0x14, 0x18, 0xCD, 0x9F, 0x66, 0x3A, 0x28, 0x1D,
+    0x97, 0x86, 0x59, 0xC2, 0xA5, 0xE5, 0xD2, 0x5E, 0x29, 0xAC, 0x1A, 0x9C, 0x21, 0x2B, 0xE1, 0xA1,
+    0xA6, 0x95, 0xD7, 0xA4, 0x55, 0x2A, 0xD4, 0x61, 0xF6, 0x50, 0x65, 0x75, 0x7B, 0xEE, 0x23, 0xB8,
+    0xC0, 0xF6, 0x0D, 0xA6, 0x1D, 0x0C, 0x42, 0xF9, 0x9F, 0xC8, 0x49, 0xDD, 0xE9, 0x64, 0x88, 0x7A,
+    0x20, 0x64, 0xF5, 0xAF, 0xE4, 0xAC, 0x7F, 0xC5, 0xC2, 0x2A, 0xB3, 0xB7, 0xEB, 0x14, 0xDB, 0x42,
+    0x8B, 0xD0, 0x04, 0xD2, 0x65, 0x85, 0x05, 0x61, 0x25, 0x12, 0xFA, 0x1D, 0x29, 0x44, 0x66, 0x0B,
+    0x5F, 0xBC, 0xCA, 0x54, 0xC9, 0xF8, 0x07, 0x13, 0x55, 0xC5, 0x0D, 0x13, 0xDB, 0xD2, 0x93, 0x1D,
+    0xC3, 0x55, 0x3F, 0x2B, 0x26, 0x56, 0x0E, 0x45, 0xD0, 0xBA, 0x5E, 0x9F, 0x87, 0xB6, 0x1A, 0x9C,
+    0x21, 0xA0, 0x29, 0xA2, 0xDA, 0x79, 0x66, 0xE1, 0xCF, 0xB6, 0xE2, 0x3B, 0xEA, 0xB0, 0xB8, 0x19,
+    0x5A, 0xE9, 0xEB, 0x8A, 0xF9, 0x78, 0x91, 0x99, 0x67, 0xDD, 0x6D, 0x2C, 0x9B, 0x47, 0x6D, 0xA3,
+    0x97, 0xA8, 0x80, 0x59, 0x16, 0xB5, 0xCF, 0x61, 0x8B, 0x06, 0x85, 0x95, 0xD4, 0x17, 0x6B, 0x21,
+    0xC9, 0x46, 0xE8, 0x35, 0x50, 0x60, 0xD4, 0xB4, 0x70, 0xF2, 0xCA, 0x2B, 0xC4, 0x8C, 0x74, 0xCA,
+    0xCF, 0xD0, 0x13, 0xD2, 0x75, 0x68, 0xE3, 0xF0, 0xA4, 0x56, 0xAE, 0xF0, 0x54, 0xDB, 0x30, 0x13,
+    0x5C, 0xA1, 0x0E, 0xED, 0x50, 0xAD, 0x00, 0x51, 0x65, 0xAC, 0xC6, 0x94, 0x49, 0x42, 0xD4, 0xE9,
+    0x46, 0x04, 0x85, 0x26, 0x7A, 0x2B, 0xD6, 0x13, 0x21, 0x8B, 0x9B, 0x68, 0x19, 0x9D, 0xEF, 0xF7,
+    0xDF, 0xB3, 0xD6, 0x3E, 0xBC, 0xBE, 0xB8, 0x35, 0x8C, 0xCA, 0x8B, 0x26, 0xC5, 0x77, 0x72, 0x1A,
+    0xCA, 0xB0, 0xF2, 0xBD, 0xE1, 0xCA, 0x8C, 0x05, 0xEE, 0x6C, 0xB0, 0x76, 0x7D, 0xCB, 0xB1, 0x7D,
+    0xBC, 0x1B, 0xF6, 0xD3, 0xE6, 0x13, 0x82, 0x6C, 0x07, 0x44, 0x70, 0xE0, 0xB9, 0x42, 0xB4, 0x77,
+    0xDC, 0xF9, 0xA7, 0x91, 0xE3, 0x90, 0x10, 0xCF, 0xDA, 0x9F, 0x58, 0x05, 0x15, 0x23, 0xA7, 0x81,
+    0xA1, 0x43, 0x3A, 0x71, 0x0E, 0xCC, 0xCB, 0x89, 0x50, 0xD6, 0x38, 0x26, 0x58, 0x57, 0x0C, 0x3E,
+    0x2C, 0xB9, 0xCB, 0x36, 0x5A, 0x86, 0x57, 0x0A, 0xDF, 0x40, 0xE2, 0x3E, 0xA5, 0xD7, 0xAD, 0x24,
+    0x8E, 0x94, 0x7E, 0x7F, 0x77, 0x64, 0xED, 0xC9, 0x83, 0xE2, 0xC6, 0x7D, 0xD4, 0xA2, 0x1B, 0xEB,
+    0x8B, 0xE3, 0x8C, 0xB3, 0x6F, 0x02, 0xDF, 0xCC, 0xCC, 0x18, 0x6D, 0x70, 0xE6, 0xC1, 0x35, 0x8D,
+    0x67, 0xCD, 0x57, 0x0E, 0x40, 0xD7, 0x3D, 0xEB, 0x0B, 0xC9, 0x71, 0xE4, 0xAC, 0x5C, 0x72, 0x63,
+    0x80, 0x7A, 0xBB, 0x78, 0xB3, 0x0C, 0xEF, 0xF1, 0x56, 0x58, 0x34, 0xB9, 0x2D, 0x99, 0xE9, 0x9E,
+    0xBB, 0xC0, 0xF3, 0x6C, 0xFA, 0x89, 0xB3, 0x98, 0x04, 0xAA, 0xDB, 0x81, 0x35, 0xE1, 0xFC, 0xD9,
+    0xC4, 0xD6, 0xF6, 0x2F, 0x23, 0x67, 0x55, 0x3F, 0x93, 0xD8, 0x3F, 0x70, 0x11, 0xB6, 0xD9, 0x7B,
+    0x20, 0xFF, 0xC6, 0xA5, 0x1D, 0xF3, 0xF9, 0x97, 0xC4, 0x5A, 0x30, 0x90, 0x83, 0xD3, 0x91, 0x8C,
+    0xF3, 0xBB, 0xE8, 0xBF, 0x6F, 0x75, 0xBA, 0xD8, 0x2C, 0x39, 0x59, 0x26, 0xED, 0x4C, 0xED, 0xFA,
+    0xF9, 0x4B, 0x8F, 0x03, 0x22, 0x10, 0x92, 0x23, 0xC5, 0xB8, 0x20, 0x7C, 0x58, 0x3E, 0xAA, 0x21,
+    0x29, 0x53, 0x5F, 0xD7, 0x8D, 0x2D, 0x15, 0x19, 0x37, 0x93, 0x9D, 0xA8, 0xBF, 0xB4, 0x1C, 0x13,
+    0xDA, 0xBC, 0x81, 0xFC, 0x11, 0x62, 0x26, 0xF5, 0xDC, 0xC6, 0x6A, 0x2C, 0xCE, 0x30, 0x28, 0x74,
+    0x22, 0xBB, 0xCE, 0x4E, 0xCA, 0xFF, 0x27, 0x55, 0x22, 0x7B, 0x34, 0xAE, 0x3B, 0x98, 0x46, 0x65,
+    0xAA, 0x7A, 0xD1, 0x24, 0x2A, 0x1F, 0x7F, 0x9D, 0xCF, 0x46, 0xC7, 0x8B, 0xA8, 0x3A, 0xB5, 0xE5,
+    0x78, 0xC7, 0xF6, 0x74, 0x21, 0xE8, 0xCB, 0xB5, 0xFE, 0x68, 0x16, 0xD8, 0x1F, 0x8F, 0x10, 0x57,
+    0x1E, 0x78, 0x43, 0xC5, 0x0C, 0xBB, 0xCB, 0x62, 0x8B, 0x15, 0xD3, 0x74, 0x48, 0x24, 0xAD, 0x62,
+    0x2F, 0x7D, 0xC8, 0x5C, 0x51, 0xFA, 0xB6, 0xEB, 0x39, 0xCD, 0x97, 0x06, 0x39, 0x7F, 0x42, 0x6B,
+    0x35, 0x96, 0xDD, 0xCA, 0xE7, 0xF5, 0xEB, 0xFC, 0x30, 0xA7, 0x6E, 0x9F, 0x43, 0xAE, 0xEF, 0xF1,
+    0x41, 0x4C, 0xB9, 0xBF, 0x70, 0x21, 0x63, 0x1F, 0x62, 0xF7, 0xFF, 0x26, 0xFD, 0xDC, 0xCF, 0x9F,
+    0xB5, 0x55, 0x3F, 0x6F, 0x1C, 0x45, 0x1C, 0x7D, 0xB3, 0x13, 0x7B, 0x15, 0x56, 0xF1, 0xB8, 0x20,
+    0x92, 0xA3, 0x38, 0xB7, 0x0D, 0x74, 0x77, 0xDE, 0x86, 0xE2, 0x24, 0x76, 0x7D, 0x4B, 0x52, 0x20,
+    0x41, 0x63, 0xA4, 0x9C, 0x28, 0xE9, 0xA9, 0x52, 0xB8, 0x70, 0xA4, 0x8B, 0x6F, 0x23, 0x0A, 0x8A,
+    0x34, 0xFE, 0x02, 0x91, 0xD2, 0x42, 0xE5, 0xC2, 0xC5, 0x49, 0x9C, 0x73, 0x63, 0xBB, 0x48, 0xE1,
+    0xC2, 0x83, 0xF2, 0x01, 0x58, 0x8B, 0x14, 0x48, 0x28, 0x68, 0x23, 0x2D, 0x64, 0x45, 0xD6, 0x1E,
+    0xDE, 0xEC, 0xDD, 0xD9, 0x88, 0x2E, 0x11, 0x19, 0x7B, 0x56, 0xF3, 0xFF, 0xF7, 0xDE, 0x9B, 0xF7,
+    0x9B, 0x03, 0x00, 0x99, 0x7D, 0x84, 0xE4, 0x26, 0x3C, 0x6B, 0xB0, 0x98, 0x63, 0x5A, 0xBC, 0x1A,
+    0x5B, 0x13, 0xAD, 0xD2, 0x18, 0x85, 0xAF, 0x43, 0x8C, 0x44, 0xAE, 0xD2, 0x04, 0x85, 0xD4, 0x6B,
+    0x18, 0x4B, 0x13, 0x66, 0x89, 0x1C, 0x49, 0xF3, 0xFA, 0x71, 0xAF, 0x1E, 0x1E, 0x9C, 0xCB, 0xD9,
+    0xA6, 0x1B, 0xAC, 0xAA, 0xE2, 0xDE, 0x43, 0x0D, 0xC4, 0xAB, 0x6C, 0x1C, 0xB1, 0xA1, 0x0A, 0x0E,
+    0x7F, 0x08, 0xD1, 0x4F, 0x17, 0xFA, 0xC3, 0x5A, 0xD8, 0xD3, 0x7D, 0xF8, 0x79, 0x90, 0x21, 0x41,
+    0x05, 0xC9, 0x08, 0x88, 0x45, 0x01, 0x3F, 0x8B, 0x80, 0x3D, 0x2F, 0x87, 0xE2, 0x38, 0xC3, 0x18,
+    0x36, 0x06, 0x10, 0xB9, 0xAF, 0xD1, 0xC1, 0x98, 0xEB, 0xD8, 0xA8, 0xD0, 0xE3, 0x9F, 0x67, 0xAD,
+    0x86, 0x4F, 0xA8, 0xD3, 0x22, 0x76, 0x80, 0x89, 0x46, 0xEB, 0x16, 0xBC, 0x03, 0x83, 0x76, 0x1B,
+    0xB0, 0x19, 0xBC, 0x1D, 0x37, 0x15, 0x69, 0xFF, 0x51, 0x8D, 0x92, 0x31, 0x30, 0x10, 0x45, 0x90,
+    0xB5, 0xD8, 0x36, 0x0A, 0xB1, 0x97, 0x07, 0x3A, 0x11, 0x95, 0x34, 0x9F, 0x66, 0x89, 0xBA, 0xFF,
+    0xDC, 0x3E, 0xAB, 0xC3, 0x7C, 0x1D, 0x17, 0x45, 0x18, 0x22, 0xDF, 0x0E, 0x0C, 0xA2, 0xA3, 0x0A,
+    0xCA, 0x9C, 0x01, 0xE6, 0xC6, 0x74, 0xE2, 0xFD, 0x30, 0x70, 0xA5, 0xBB, 0x8A, 0xE0, 0xC8, 0x88,
+    0xB2, 0x46, 0x12, 0xC1, 0xBF, 0x93, 0xCD, 0x86, 0xDF, 0x9A, 0xC1, 0xF5, 0xBB, 0xE8, 0x7F, 0x6D,
+    0x75, 0x78, 0x7E, 0xD3, 0x60, 0x1B, 0x23, 0x70, 0x75, 0x86, 0x18, 0x25, 0xC3, 0x87, 0xC0, 0x96,
+    0x57, 0x20, 0x48, 0xD7, 0xE6, 0xE8, 0x1C, 0x4C, 0x82, 0x6A, 0x11, 0xA6, 0x67, 0x02, 0xCD, 0x75,
+    0x03, 0xA8, 0x54, 0x16, 0xB2, 0x40, 0x64, 0x6B, 0x60, 0x48, 0xEA, 0x58, 0x6B, 0xFC, 0xC1, 0xCF,
+    0x1E, 0x6B, 0xF0, 0x82, 0x9F, 0x9E, 0x7E, 0x7B, 0x70, 0x3D, 0x7A, 0x81, 0xDB, 0x76, 0xE9, 0x06,
+    0xEE, 0xFC, 0x93, 0x27, 0x15, 0x33, 0x8A, 0x2B, 0xCD, 0x77, 0xDA, 0xF5, 0x6C, 0x43, 0x7C, 0x94,
+    0xA0, 0x09, 0x7C, 0x21, 0x10, 0x59, 0x51, 0xFC, 0x2F, 0xAD, 0x6E, 0x61, 0x58, 0x87, 0x86, 0xF8,
+    0xF6, 0x29, 0xE5, 0x90, 0x60, 0x55, 0x16, 0x14, 0xD4, 0xBE, 0x82, 0x25, 0x1B, 0x95, 0xAD, 0xD1,
+    0x9F, 0x18, 0xC9, 0x13, 0x82, 0x0D, 0xF4, 0x5E, 0xC9, 0x58, 0x63, 0xA5, 0x6E, 0x1B, 0xF8, 0x87,
+    0xA6, 0x8C, 0x81, 0x41, 0x1C, 0x7C, 0x9F, 0xC2, 0x3F, 0x4E, 0x47, 0x0C, 0x17, 0x17, 0xFE, 0x63,
+    0x52, 0x7B, 0x89, 0xA1, 0x76, 0x9C, 0x7C, 0xFA, 0x56, 0x96, 0xBC, 0x1D, 0x76, 0x30, 0x37, 0xF4,
+    0x65, 0x71, 0x90, 0x24, 0x35, 0x41, 0xA7, 0x24, 0xCE, 0x53, 0xEE, 0x6F, 0x79, 0xFA, 0x72, 0x3A,
+    0x4A, 0x63, 0xF1, 0x97, 0x45, 0x25, 0xF3, 0xC4, 0x2B, 0x54, 0x56, 0x52, 0x01, 0x2F, 0x8F, 0x52,
+    0xCA, 0x7B, 0x46, 0x7D, 0xFC, 0xAA, 0x83, 0x38, 0xC9, 0x0B, 0xBC, 0x7A, 0x7E, 0x9C, 0xCA, 0x13,
+    0xD5, 0x25, 0x5F, 0xAA, 0x18, 0xA5, 0x3C, 0x70, 0x4F, 0x5E, 0x1C, 0xB3, 0xD2, 0x88, 0xCA, 0xCA,
+    0xE1, 0x88, 0xF6, 0x6A, 0x4D, 0x15, 0xA0, 0xED, 0xAE, 0x7F, 0x65, 0xCB, 0xE8, 0x2C, 0x34, 0xA2,
+    0xE2, 0x0D, 0x8E, 0x08, 0x66, 0x40, 0x7E, 0x31, 0x44, 0x41, 0x58, 0xEB, 0xBC, 0xA1, 0xE0, 0x84,
+    0xEB, 0x6C, 0x83, 0x83, 0x1D, 0x1E, 0xD1, 0x10, 0x20, 0x52, 0xDE, 0x29, 0x10, 0xBA, 0x89, 0xDF,
+    0xC8, 0xCB, 0xCE, 0x23, 0xD1, 0xB2, 0xCD, 0x35, 0xFE, 0x94, 0xD3, 0xA0, 0xCE, 0xBA, 0xBB, 0x17,
+    0x4C, 0xB6, 0x79, 0x99, 0x16, 0xEB, 0x4E, 0x4C, 0x9E, 0xD4, 0xA1, 0x71, 0x62, 0xBA, 0x28, 0xA6,
+    0x43, 0x36, 0xE1, 0x71, 0xAD, 0x38, 0x35, 0x10, 0xBF, 0x72, 0xEF, 0xEF, 0x44, 0xF6, 0x92, 0xD5,
+    0xE5, 0x3B, 0xE5, 0x70, 0x34, 0x18, 0xE8, 0xE3, 0x31, 0x4F, 0x66, 0xF0, 0xB5, 0xD4, 0xDD, 0xEA,
+    0x67, 0x39, 0x13, 0xA5, 0x86, 0x28, 0x93, 0x8B, 0xF3, 0x17, 0xFA, 0xE8, 0x7F, 0x6E, 0xCD, 0xA4,
+    0x1C, 0xA6, 0xCC, 0x21, 0xCD, 0x7C, 0x29, 0x79, 0x81, 0x11, 0x88, 0x42, 0x13, 0x70, 0x35, 0x22,
+    0xD6, 0x78, 0xA6, 0xF5, 0xBE, 0x03, 0xEE, 0xE0, 0xD2, 0x16, 0xD2, 0x69, 0xE1, 0x5C, 0x32, 0x60,
+    0x9D, 0x3C, 0x21, 0xDD, 0xBA, 0x39, 0x6F, 0x03, 0x0C, 0xC1, 0x65, 0x9C, 0x3E, 0x67, 0x77, 0x67,
+    0x1A, 0xA5, 0xDF, 0xBF, 0x2B, 0xAC, 0xAD, 0xBD, 0xBF, 0x7F, 0xAC, 0xA5, 0xF6, 0xE8, 0x0A, 0xDF,
+    0x88, 0x86, 0xB5, 0xCB, 0x92, 0x7A, 0x8A, 0xD8, 0xE9, 0x14, 0x72, 0xE8, 0x01, 0x87, 0xDC, 0xE5,
+    0x17, 0xD8, 0x55, 0x1A, 0x45, 0x44, 0x9A, 0x43, 0x6B, 0x4D, 0xCF, 0x65, 0xE9, 0xBC, 0x6C, 0x3A,
+    0x35, 0x29, 0x2A, 0x6F, 0xE5, 0xDA, 0x6C, 0xC8, 0x7F, 0xB1, 0xAA, 0xEC, 0x83, 0xCE, 0x37, 0x55,
+    0x9B, 0x1C, 0x98, 0x46, 0xA1, 0x83, 0x46, 0x2A, 0x14, 0x42, 0x61, 0xB9, 0xB7, 0xD1, 0xB5, 0xB6,
+    0x2A, 0x26, 0x53, 0x9B, 0x5F, 0xC1, 0x34, 0xF2, 0x53, 0xD6, 0xF1, 0xA5, 0x6B, 0xFE, 0x4F, 0x94,
+    0x7E, 0x06, 0x8E, 0x53, 0xA9, 0x85, 0x77, 0xC0, 0xC7, 0xB2, 0xC4, 0x9C, 0x51, 0xB7, 0xB9, 0xF2,
+    0x17, 0x3E, 0x9F, 0x4E, 0xC9, 0xD1, 0x7B, 0x51, 0x32, 0xEF, 0xA0, 0x18, 0xE1, 0x7E, 0xEE, 0xEC,
+    0x17, 0xBE, 0x1B, 0x52, 0x06, 0x70, 0x0F, 0xD3, 0x1B, 0x97, 0xC3, 0x57, 0x1B, 0xE2, 0x53, 0xAB,
+    0xBB, 0x97, 0x45, 0x14, 0xB3, 0x27, 0xCB, 0x33, 0xF3, 0xA4, 0xD5, 0x33, 0xCF, 0x04, 0xFF, 0x5E,
+    0xD7, 0x38, 0xC9, 0xC5, 0xF7, 0xF2, 0xFF, 0xAE, 0x23, 0x37, 0xEF, 0x67, 0x4E, 0xF7, 0x48, 0x4E,
+    0x3C, 0x6D, 0x9E, 0xA5, 0x6C, 0x20, 0x99, 0xD4, 0x6D, 0xD7, 0x8E, 0x83, 0x83, 0x22, 0xF6, 0x67,
+    0x49, 0x8F, 0xD0, 0x84, 0x7C, 0x60, 0x94, 0x68, 0xF2, 0xB4, 0xF7, 0xC5, 0xE4, 0x8F, 0xD3, 0x1A,
+    0x1B, 0xDF, 0xFE, 0x30, 0x71, 0xFA, 0xE1, 0x9E, 0xDC, 0x6F, 0xF5, 0xEA, 0x60, 0xA7, 0xB3, 0xBD,
+    0xBF, 0xBC, 0x20, 0xEE, 0x14, 0xF5, 0xBA, 0xCA, 0xD2, 0xE5, 0xC5, 0xCC, 0x1E, 0xAB, 0x95, 0x58,
+    0xEA, 0x81, 0xD0, 0xEE, 0xD7, 0x4B, 0x95, 0xED, 0xB8, 0xCB, 0xFF, 0xA8, 0x58, 0x74, 0x00, 0x37,
+    0xBB, 0xEA, 0xD1, 0xD1, 0xAB, 0x72, 0x9C, 0x2C, 0xF9, 0x69, 0x13, 0xE4, 0x96, 0x7C, 0xF6, 0x9D,
+    0x79, 0x6D, 0x42, 0xD3, 0x20, 0xFD, 0xE4, 0xDE, 0x68, 0x6F, 0xB0, 0x15, 0xC7, 0xD7, 0xF8, 0x13,
+    0x85, 0x65, 0x61, 0x1F, 0xBE, 0x29, 0xF3, 0xCE, 0xB2, 0xC7, 0x4E, 0x9B, 0xC9, 0x96, 0x48, 0xD3,
+    0x13, 0xD9, 0x07, 0x7E, 0x5E, 0x25, 0xA1, 0x0A, 0x70, 0x55, 0x1D, 0x1F, 0x9A, 0xCD, 0x25, 0xA1,
+    0xAF, 0x74, 0xE2, 0x78, 0x73, 0x17, 0x8B, 0xD9, 0x40, 0x3D, 0x2C, 0xBA, 0x7C, 0xC3, 0x88, 0x68,
+    0xAE, 0xE5, 0x3F, 0xAD, 0x54, 0xB1, 0x6E, 0xE4, 0x54, 0x14, 0x3D, 0xB6, 0x93, 0x31, 0xC4, 0x02,
+    0x4F, 0x93, 0x86, 0xD1, 0xCA, 0x5B, 0x50, 0x50, 0xEC, 0xC4, 0xCD, 0x22, 0x51, 0xD8, 0x33, 0x16,
+    0x11, 0xD5, 0x36, 0x29, 0x62, 0x1A, 0x24, 0x84, 0xE8, 0xA0, 0x61, 0xCB, 0x14, 0x93, 0xD8, 0x2B,
+    0xF8, 0x80, 0x14, 0xF4, 0x4B, 0x41, 0xC1, 0x66, 0x8B, 0xA4, 0xD8, 0x62, 0x84, 0x26, 0xB1, 0xB3,
+    0x5F, 0x30, 0x7F, 0xC0, 0x2B, 0x96, 0x86, 0x08, 0xF1, 0x40, 0x2E, 0x1C, 0x76, 0x66, 0x1E, 0xE7,
+    0xBE, 0xC9, 0xEC, 0x64, 0x85, 0x84, 0x90, 0x60, 0xA2, 0x67, 0xC5, 0xEF, 0x3D, 0xDF, 0x73, 0xEF,
+    0x3D, 0xE7, 0xDC, 0x37, 0xDD, 0x5D, 0x3D, 0x1B, 0x84, 0x65, 0xD6, 0xDD, 0xDA, 0xFD, 0xF5, 0xE1,
+    0xD5, 0x5B, 0xC3, 0x7A, 0xAF, 0xB3, 0xAB, 0xC6, 0x49, 0x7F, 0x03, 0x5B, 0xE5, 0xB9, 0x3B, 0x3D,
+    0xD8, 0x71, 0x32, 0x07, 0xD3, 0xC4, 0xCF, 0x0E, 0x77, 0x67, 0xC0, 0x96, 0x77, 0xA9, 0x9E, 0x25,
+    0x9B, 0xE0, 0x6F, 0x88, 0xA1, 0x1A, 0xA4, 0xA9, 0xF7, 0x0D, 0xD0, 0x85, 0xDE, 0x9A, 0x8F, 0x8A,
+    0xA6, 0x93, 0x01, 0x71, 0xA7, 0xFA, 0xE9, 0x8F, 0xF9, 0xDE, 0xF7, 0xDB, 0xFB, 0xD5, 0xE2, 0xCB,
+    0x27, 0xE8, 0x3A, 0xE6, 0xD1, 0xCB, 0x46, 0xF5, 0xBB, 0x2E, 0xE0, 0xC1, 0x55, 0x8E, 0x46, 0x83,
+    0x67, 0xE8, 0xBA, 0xE5, 0xE7, 0xCD, 0xF9, 0x2C, 0xDE, 0x70, 0xB0, 0x11, 0x7A, 0xF5, 0xF5, 0x10,
+    0x12, 0x05, 0xD8, 0xE1, 0x0A, 0x14, 0x1F, 0x15, 0x97, 0x53, 0x0A, 0x0E, 0x36, 0xF3, 0x7C, 0xCF,
+    0x33, 0x66, 0x86, 0xE8, 0xE4, 0x14, 0x7E, 0xED, 0x95, 0xAE, 0x46, 0x8D, 0x31, 0x4F, 0x52, 0xAE,
+    0x90, 0xCB, 0xFF, 0xE5, 0x07, 0xB8, 0x66, 0x01, 0xB4, 0xB7, 0x37, 0x6B, 0xA7, 0xE6, 0x4D, 0xCD,
+    0xCD, 0x03, 0xA7, 0x32, 0x73, 0xC7, 0x18, 0xC3, 0xED, 0xB3, 0x3E, 0x70, 0x1E, 0x95, 0x88, 0xFD,
+    0x29, 0x56, 0xBF, 0xED, 0x3C, 0xCF, 0x42, 0x63, 0x34, 0x8E, 0x4E, 0x26, 0x88, 0xF0, 0x36, 0x82,
+    0x5A, 0x72, 0xE5, 0x49, 0xC3, 0x95, 0x70, 0x45, 0x27, 0xDF, 0x21, 0x30, 0x2D, 0xBC, 0xD7, 0x36,
+    0xE1, 0xCB, 0xCD, 0xDA, 0x53, 0x8E, 0xEA, 0x18, 0xD3, 0xF8, 0x92, 0x24, 0x63, 0xED, 0x15, 0xC6,
+    0xB4, 0x3F, 0x9E, 0x9E, 0x34, 0x3A, 0xC2, 0x99, 0x8A, 0xA1, 0xB3, 0x01, 0x32, 0x9B, 0x97, 0x7C,
+    0x75, 0x64, 0x6A, 0x54, 0xC4, 0x6A, 0xDD, 0x96, 0x91, 0x66, 0x6C, 0xC8, 0x84, 0x6B, 0xC4, 0x54,
+    0x47, 0x8C, 0x3E, 0xE9, 0xB5, 0x68, 0xAB, 0x99, 0x60, 0x70, 0x07, 0xDE, 0x14, 0xF7, 0x99, 0xEC,
+    0x70, 0xCE, 0xC6, 0xAA, 0x55, 0xBA, 0x6F, 0x70, 0x4D, 0x58, 0x20, 0xF9, 0x88, 0x59, 0xC4, 0xBB,
+    0xCB, 0xDD, 0x3C, 0xCF, 0x21, 0x25, 0x46, 0x27, 0x17, 0xCC, 0x6C, 0x07, 0x31, 0xFA, 0x7C, 0xDE,
+    0xB3, 0xB8, 0xB2, 0x46, 0xCB, 0xAF, 0x6C, 0x8F, 0xA4, 0x02, 0x46, 0x27, 0xEE, 0x12, 0x85, 0xA1,
+    0x7B, 0xD7, 0x40, 0xB1, 0x90, 0xAE, 0x7F, 0xC1, 0x7F, 0xCC, 0x34, 0xFC, 0xB9, 0x2A, 0x67, 0xE8,
+    0x87, 0x35, 0xCE, 0x46, 0x70, 0xBF, 0x9E, 0x4A, 0xB9, 0xC0, 0xC5, 0x53, 0x45, 0x2A, 0xB2, 0x90,
+    0xCC, 0x0C, 0xF8, 0x3A, 0xB3, 0xDF, 0x77, 0x7C, 0x85, 0x24, 0x54, 0xBE, 0x66, 0x0F, 0xB3, 0xC0,
+    0xDC, 0xE4, 0xD9, 0xF9, 0x16, 0xB1, 0x99, 0xC6, 0x1F, 0x35, 0x11, 0xFA, 0x41, 0x1D, 0xB8, 0xDA,
+    0xC9, 0xCE, 0xC9, 0x8C, 0x82, 0x63, 0x32, 0x84, 0xCC, 0xA2, 0x28, 0xE1, 0xE9, 0xBB, 0x38, 0xBC,
+    0x83, 0xF0, 0x41, 0xE6, 0x3F, 0xD7, 0x9E, 0xAA, 0x9E, 0x6A, 0xDF, 0x2C, 0x69, 0xC9, 0xF7, 0x3D,
+    0xA3, 0x9C, 0x96, 0x2C, 0xB2, 0x10, 0x92, 0xCD, 0x46, 0x84, 0x19, 0x6B, 0x20, 0x1C, 0xC1, 0x53,
+    0x49, 0x7F, 0x79, 0xD4, 0xA2, 0xD7, 0x3A, 0x86, 0x05, 0xDD, 0x0B, 0x30, 0x7C, 0x30, 0x0D, 0x9F,
+    0xEB, 0x57, 0xA4, 0x22, 0x34, 0x25, 0x8E, 0x6C, 0xE2, 0x41, 0x6D, 0xF9, 0x6C, 0x6C, 0x2B, 0x96,
+    0xEF, 0xDE, 0xF2, 0x3D, 0xB9, 0xF5, 0xDE, 0x59, 0x60, 0x89, 0x9F, 0xEF, 0x03, 0x64, 0x1B, 0x6C,
+    0xBD, 0xC0, 0xDA, 0xD2, 0xE3, 0x1B, 0x79, 0xFE, 0xCB, 0x7E, 0x7A, 0xB5, 0x48, 0xD0, 0x7E, 0x3E,
+    0xB8, 0xA0, 0x5B, 0x78, 0x6D, 0xEB, 0x78, 0xC5, 0x13, 0xD5, 0x2A, 0x72, 0xC5, 0xD1, 0x27, 0x82,
+    0x96, 0xC8, 0x3D, 0x24, 0x81, 0x3C, 0x0F, 0xA4, 0xB5, 0x38, 0x13, 0x50, 0x68, 0x91, 0xB1, 0xA3,
+    0x22, 0x56, 0xE1, 0xD6, 0xF1, 0x69, 0xC3, 0x98, 0x03, 0xB6, 0x3C, 0xC8, 0x52, 0x82, 0x87, 0xCC,
+    0x3C, 0x21, 0xC5, 0x23, 0xFB, 0x37, 0xC6, 0xF8, 0xFD, 0x86, 0x92, 0xD2, 0x43, 0x2A, 0xB1, 0xAA,
+    0x87, 0x59, 0x64, 0xAE, 0x57, 0x72, 0xC9, 0xF7, 0x36, 0x89, 0x68, 0x9A, 0x78, 0x21, 0x05, 0x91,
+    0x2B, 0x96, 0x23, 0xD9, 0xC5, 0x36, 0xBF, 0x1D, 0xA9, 0x9D, 0x05, 0x05, 0xA5, 0x3C, 0x05, 0x97,
+    0xEA, 0x25, 0x62, 0x65, 0x0C, 0x11, 0x5B, 0x9E, 0x8B, 0x18, 0x07, 0x3C, 0xD3, 0x5C, 0x29, 0x4B,
+    0x24, 0xAE, 0x88, 0x15, 0x13, 0x96, 0x39, 0x76, 0x9A, 0x5E, 0xEB, 0x9A, 0x6A, 0x5A, 0xCC, 0x42,
+    0x33, 0x5F, 0xDB, 0xE9, 0x1F, 0x2C, 0xB0, 0x2D, 0x16, 0xD0, 0xA8, 0xAE, 0x5A, 0x46, 0x96, 0xD8,
+    0x22, 0xFF, 0xB1, 0x23, 0x86, 0xE0, 0x6C, 0xA0, 0x97, 0x74, 0xAF, 0xF5, 0xAF, 0xAB, 0x59, 0x24,
+    0x0D, 0x72, 0x25, 0xDE, 0xA1, 0x38, 0x5A, 0xDA, 0x2B, 0x3B, 0x9D, 0x1B, 0x10, 0xD6, 0xF4, 0x0E,
+    0x7D, 0xE1, 0xCE, 0x59, 0xD3, 0x50, 0xFC, 0xA3, 0xD8, 0x7A, 0xF2, 0x13, 0x3C, 0xE2, 0xCD, 0x54,
+    0x3A, 0xD7, 0x9C, 0x91, 0x81, 0xDF, 0x58, 0x56, 0x2C, 0xC3, 0xA4, 0x4D, 0xC5, 0x4D, 0x24, 0x2C,
+    0x74, 0xC8, 0xD6, 0xC8, 0xD3, 0xBC, 0xCE, 0x11, 0x10, 0x96, 0x61, 0xED, 0x54, 0xC7, 0x51, 0xCD,
+    0x2E, 0xC7, 0xF5, 0x4D, 0xEC, 0x0D, 0xFB, 0xB4, 0x42, 0x0A, 0xAD, 0x1C, 0x0B, 0xA1, 0x63, 0x65,
+    0x34, 0x91, 0x87, 0x23, 0x03, 0x23, 0x2B, 0x04, 0x1C, 0xE7, 0xC2, 0x7B, 0x28, 0x62, 0xF4, 0x5A,
+    0x51, 0x99, 0x91, 0x42, 0x53, 0x4D, 0xB4, 0x30, 0x12, 0x24, 0x2A, 0x32, 0xB8, 0xD4, 0xB4, 0x4B,
+    0x7B, 0x20, 0x2A, 0xFE, 0x54, 0x94, 0xF3, 0xB2, 0x64, 0xD7, 0x23, 0xF6, 0x0F, 0x6E, 0x63, 0x25,
+    0x22, 0x1A, 0xA2, 0xF5, 0x8B, 0x63, 0x0A, 0x30, 0x36, 0x37, 0x38, 0x77, 0x3D, 0x3A, 0x25, 0x7B,
+    0xC8, 0x2F, 0x59, 0x98, 0x4F, 0x52, 0xB0, 0x99, 0xAD, 0x39, 0x8D, 0x8D, 0x6B, 0x54, 0x91, 0xF9,
+    0xCA, 0xB2, 0x11, 0x49, 0x98, 0xC6, 0x51, 0xAC, 0x88, 0x92, 0x9E, 0x04, 0x19, 0xFC, 0x4B, 0x52,
+    0x9D, 0xF2, 0xC5, 0xBD, 0x12, 0x09, 0xAB, 0xA5, 0x5F, 0x2D, 0xC5, 0xBC, 0x86, 0xF7, 0x98, 0x86,
+    0x27, 0x48, 0xC3, 0x72, 0x5D, 0x17, 0xBB, 0x3A, 0x9C, 0xFB, 0xA6, 0xA6, 0xF3, 0x0A, 0xB1, 0x1B,
+    0xD5, 0x18, 0x8B, 0xF7, 0xA8, 0x0E, 0x29, 0x48, 0x52, 0x6F, 0xC4, 0x09, 0xEB, 0x93, 0xB0, 0x74,
+    0x56, 0x27, 0x5A, 0xFC, 0x31, 0x12, 0x80, 0xF5, 0x49, 0x8F, 0x42, 0xA7, 0x18, 0x65, 0xB8, 0xDA,
+    0x89, 0x61, 0xE1, 0xAD, 0xFC, 0x00, 0x3B, 0x28, 0xEE, 0xAF, 0x1B, 0x8E, 0xCF, 0x60, 0x9D, 0xC8,
+    0x94, 0x78, 0xC9, 0x13, 0xB6, 0xEF, 0xC8, 0x98, 0xFF, 0x9D, 0xDF, 0xFA, 0xBB, 0xDC, 0x4F, 0xF8,
+    0xB1, 0x3B, 0x4D, 0x65, 0xBE, 0x73, 0xFF, 0xFA, 0x63, 0xCE, 0x00, 0xC3, 0x69, 0x9A, 0xE6, 0x5F,
+    0x65, 0xEC, 0x7B, 0x2A, 0x63, 0xBF, 0x95, 0x59, 0xA1, 0x83, 0x17, 0x88, 0x5E, 0x18, 0xED, 0x11,
+    0x35, 0xA7, 0x97, 0x0D, 0xA5, 0x19, 0xD9, 0xD1, 0x9E, 0x30, 0xB5, 0x0F, 0x98, 0x66, 0xF7, 0x95,
+    0x8D, 0x0B, 0xD2, 0x75, 0x71, 0xAA, 0xA8, 0xBE, 0x06, 0xA2, 0xF7, 0xD7, 0xB4, 0xE8, 0xA9, 0xDE,
+    0xA2, 0x2A, 0x0B, 0x19, 0x05, 0x76, 0xA4, 0x3D, 0xE1, 0xF0, 0xE2, 0x58, 0x7A, 0xFC, 0x61, 0xCB,
+    0x58, 0x13, 0xC6, 0x1A, 0x31, 0xD6, 0x88, 0x71, 0x5A, 0xEB, 0x89, 0x82, 0x14, 0x5D, 0x54, 0x7F,
+    0x8F, 0xA5, 0x9C, 0xC6, 0x9B, 0x32, 0xD6, 0x9F, 0xB7, 0x62, 0xFD, 0x5F, 0xE3, 0xFA, 0x3F, 0xFE,
+    0xFE, 0x02, 0x95, 0x55, 0x3D, 0x8F, 0xDC, 0x54, 0x14, 0x3D, 0xCF, 0x56, 0xD6, 0x08, 0x07, 0xBD,
+    0x6A, 0x69, 0x16, 0xE2, 0x96, 0x82, 0x1D, 0x57, 0x48, 0x14, 0xF6, 0x8E, 0x15, 0x4A, 0x9A, 0x05,
+    0xAD, 0x45, 0x81, 0x44, 0x1F, 0x51, 0xD0, 0x6E, 0x61, 0x76, 0x2C, 0x52, 0xA4, 0xA0, 0xC9, 0x3F,
+    0x20, 0x2D, 0xDB, 0x24, 0x42, 0x8B, 0xB4, 0xC5, 0x26, 0x63, 0x48, 0x49, 0x81, 0xC5, 0xFE, 0x00,
+    0x5C, 0x90, 0x2A, 0x12, 0xBC, 0x08, 0x47, 0xF2, 0xEE, 0xCE, 0xCC, 0xE3, 0x1C, 0x4F, 0x92, 0x5D,
+    0x29, 0x69, 0xF0, 0x8C, 0xC6, 0xE3, 0x77, 0xDF, 0xBB, 0x1F, 0xE7, 0x9C, 0x7B, 0x0D, 0x94, 0x65,
+    0x09, 0xCC, 0xBC, 0x6F, 0xB0, 0xF1, 0x7C, 0x56, 0x00, 0x47, 0x71, 0x0D, 0x64, 0x61, 0x0B, 0x58,
+    0x38, 0x20, 0x2A, 0x2A, 0x20, 0x6C, 0x52, 0x00, 0x9D, 0x2C, 0x47, 0xB2, 0x64, 0xB2, 0x6C, 0xA3,
+    0xD2, 0x9E, 0x09, 0x10, 0x17, 0xB6, 0x40, 0x54, 0xD3, 0x12, 0x35, 0xB4, 0x24, 0xDE, 0xFB, 0xDA,
+    0xF2, 0xA7, 0x0F, 0x1B, 0xA0, 0x32, 0xDC, 0x9B, 0x60, 0x5F, 0xDB, 0xDE, 0x07, 0x82, 0x26, 0xA2,
+    0xAB, 0x7B, 0x58, 0x5F, 0x0A, 0x3E, 0x65, 0x6C, 0x73, 0x7E, 0xE8, 0xE8, 0xEE, 0x63, 0xA4, 0xB8,
+    0x0E, 0x85, 0x51, 0x14, 0x05, 0xC1, 0xC1, 0x61, 0x8D, 0xD4, 0x77, 0xB0, 0x57, 0x17, 0x2B, 0xBC,
+    0xC7, 0x9D, 0x96, 0x8B, 0x51, 0xBD, 0xE5, 0x7D, 0xCB, 0x88, 0x5C, 0xFE, 0x00, 0x9B, 0xBB, 0xE6,
+    0x5E, 0xB8, 0x0C, 0x7D, 0x33, 0x6D, 0xE2, 0x85, 0xE9, 0x43, 0xAF, 0x7C, 0x9B, 0x1D, 0x9D, 0x4A,
+    0x82, 0x56, 0xC1, 0x8F, 0x6F, 0xF0, 0x21, 0xBC, 0xDD, 0xCA, 0x4B, 0x6C, 0xAD, 0x72, 0x98, 0x3E,
+    0xEA, 0xB5, 0x76, 0x71, 0xD1, 0xF1, 0x96, 0xC6, 0x77, 0x98, 0xB3, 0xE9, 0x73, 0xC5, 0x4B, 0x6A,
+    0x97, 0x70, 0x6D, 0x11, 0xC9, 0x85, 0x6D, 0x26, 0x38, 0x01, 0x96, 0x38, 0xC2, 0x02, 0x49, 0x1B,
+    0xF7, 0xC1, 0x60, 0x96, 0xF0, 0x2E, 0x18, 0xF0, 0xF2, 0x7A, 0xF7, 0x2E, 0xE6, 0xBE, 0xD8, 0xF9,
+    0xC2, 0x59, 0xE4, 0x11, 0x31, 0xA9, 0x59, 0x3F, 0xAB, 0xE7, 0xF7, 0xEB, 0x1E, 0xE9, 0x8A, 0x11,
+    0x99, 0xC3, 0x82, 0x41, 0xDE, 0x82, 0xFD, 0xBE, 0x88, 0x4E, 0x5D, 0xE4, 0x66, 0xFF, 0xB8, 0xC8,
+    0xB7, 0x6B, 0x2C, 0xF6, 0x4C, 0x59, 0x58, 0x5F, 0xCC, 0x96, 0x0C, 0x8C, 0x87, 0x3A, 0x66, 0x1B,
+    0x96, 0x19, 0x0E, 0x08, 0x3A, 0xF8, 0x02, 0x39, 0x72, 0x47, 0x0C, 0x2C, 0x73, 0xAA, 0xC2, 0x5F,
+    0x1D, 0xE2, 0x5F, 0x1C, 0xF3, 0x1A, 0xF6, 0x09, 0x8B, 0xFD, 0x4A, 0x64, 0x5C, 0xD4, 0x71, 0x83,
+    0xA4, 0xC3, 0x31, 0x82, 0x1E, 0xA4, 0x84, 0xD6, 0x1E, 0x5B, 0x03, 0x66, 0x77, 0x19, 0x23, 0xF5,
+    0xAF, 0xF2, 0xAC, 0xDF, 0xE1, 0x4F, 0x66, 0x58, 0x68, 0xD8, 0x1D, 0xF3, 0x6F, 0xB2, 0xD2, 0xEA,
+    0xE6, 0x4B, 0xF3, 0xB5, 0xB2, 0xD8, 0xDC, 0x83, 0xEF, 0x79, 0xC8, 0x0C, 0xCA, 0x39, 0x51, 0xD6,
+    0x81, 0xC3, 0xB4, 0x26, 0xDB, 0xB6, 0x67, 0x0E, 0xE1, 0x9F, 0x60, 0x3A, 0xCF, 0x1C, 0x09, 0xCF,
+    0x28, 0x8D, 0x93, 0x24, 0x24, 0x43, 0x77, 0xEA, 0x1C, 0x78, 0xDE, 0x51, 0x03, 0xF6, 0x98, 0x50,
+    0x99, 0x95, 0x98, 0x4C, 0x0B, 0xE6, 0x20, 0x6B, 0x61, 0xE6, 0x75, 0x74, 0x86, 0xD9, 0x32, 0x10,
+    0x57, 0xA5, 0x98, 0x62, 0x52, 0x8C, 0x40, 0x96, 0x22, 0x62, 0x8B, 0x94, 0x55, 0xE2, 0x38, 0x11,
+    0xCD, 0xDC, 0x60, 0x3F, 0x15, 0xF9, 0xC4, 0x36, 0xB8, 0xD0, 0xD3, 0x6D, 0x62, 0x94, 0xB3, 0x3A,
+    0x12, 0x49, 0xA9, 0x35, 0x53, 0x6E, 0xC7, 0xB7, 0x2C, 0x9E, 0x89, 0x6D, 0x9D, 0x99, 0x85, 0xF1,
+    0x43, 0xB0, 0xC0, 0x15, 0x51, 0x05, 0xDE, 0xB3, 0xA8, 0x83, 0x2F, 0xE9, 0x32, 0x63, 0x42, 0xC8,
+    0x74, 0x76, 0x5F, 0xA4, 0x3E, 0x20, 0x30, 0x20, 0x43, 0x30, 0x5D, 0x22, 0x45, 0xA4, 0x92, 0xF7,
+    0x8E, 0xD4, 0x99, 0x4B, 0xCE, 0xD9, 0x0B, 0x61, 0x57, 0xAC, 0xE0, 0xA3, 0x9E, 0x01, 0xA6, 0xDD,
+    0xC6, 0x0A, 0xD3, 0x22, 0x21, 0x01, 0x6B, 0x74, 0xF6, 0x60, 0x4A, 0x44, 0x1E, 0x86, 0x2D, 0x93,
+    0xB6, 0x22, 0x86, 0x90, 0xCC, 0x1B, 0x84, 0x7F, 0x8B, 0x1F, 0xF3, 0xB4, 0xDE, 0xA6, 0x4C, 0x7E,
+    0x76, 0x96, 0x25, 0x65, 0x55, 0x4C, 0x08, 0x6E, 0xD8, 0xF0, 0xBB, 0x0E, 0xF1, 0x27, 0xA7, 0x0D,
+    0x91, 0x68, 0xCE, 0x3A, 0xC6, 0x71, 0x13, 0xC7, 0x34, 0x8E, 0xA3, 0x9E, 0xDC, 0xE5, 0xAC, 0x81,
+    0x54, 0xF3, 0x9E, 0xB1, 0x89, 0xDE, 0x26, 0xDA, 0x11, 0x05, 0x99, 0xFC, 0x65, 0x49, 0x98, 0x48,
+    0x7B, 0x83, 0x2E, 0x62, 0xE9, 0x02, 0xA3, 0x2E, 0xAC, 0x74, 0x01, 0xE9, 0x42, 0x34, 0xCD, 0xD4,
+    0x08, 0xF1, 0x58, 0xFB, 0xA0, 0x25, 0x5A, 0x2B, 0x59, 0xA5, 0x0B, 0x48, 0x17, 0xEE, 0xCD, 0xBA,
+    0xB8, 0xC5, 0x46, 0xF7, 0x03, 0xEC, 0x93, 0x6F, 0x1A, 0xDB, 0x98, 0x81, 0xBA, 0x9B, 0x12, 0xB5,
+    0xE8, 0x94, 0xF0, 0x3D, 0x27, 0xFC, 0x39, 0x2B, 0xB2, 0x07, 0xDC, 0xF3, 0x7B, 0x8D, 0xE0, 0x5F,
+    0x2E, 0x0E, 0x24, 0xA6, 0x22, 0x09, 0x3B, 0x51, 0xCB, 0x4C, 0x96, 0x98, 0xC1, 0x9E, 0xD3, 0xCF,
+    0xFC, 0xEC, 0x92, 0x82, 0xB1, 0xB1, 0xD9, 0xD9, 0xAB, 0xC3, 0xB9, 0x92, 0x90, 0x14, 0xA4, 0x03,
+    0xDE, 0x25, 0x20, 0xA5, 0xD5, 0xAB, 0x88, 0x4A, 0x9D, 0x9D, 0x8E, 0xB9, 0xD6, 0xEB, 0x32, 0xC6,
+    0x84, 0x5F, 0xB7, 0x6C, 0x0D, 0x66, 0x45, 0x16, 0x6E, 0x4A, 0x3D, 0xD7, 0x7E, 0x24, 0xFA, 0xBE,
+    0x33, 0x3F, 0xDC, 0x1C, 0x58, 0x57, 0xC5, 0x5D, 0x39, 0x95, 0xC9, 0xFE, 0xE0, 0xFF, 0x8C, 0x95,
+    0x57, 0xA1, 0xC3, 0xC3, 0xFB, 0x35, 0xFC, 0x99, 0xA2, 0x8C, 0x33, 0x43, 0x53, 0x88, 0xD5, 0x2B,
+    0x05, 0x2A, 0x46, 0x48, 0x71, 0xDD, 0xDC, 0x2A, 0xD8, 0xB1, 0xAD, 0x7D, 0x32, 0xAF, 0x17, 0xD8,
+    0x66, 0xD5, 0x0F, 0x2A, 0x04, 0xB7, 0x3B, 0xCD, 0x2B, 0xA8, 0xD9, 0xB5, 0x59, 0x9A, 0xD1, 0x04,
+    0x59, 0xAC, 0xCF, 0x47, 0x1D, 0xAE, 0xDB, 0x7E, 0xC3, 0x71, 0xBE, 0x11, 0xE8, 0x75, 0xE7, 0x6E,
+    0x96, 0xE5, 0x67, 0xAC, 0xF5, 0xE9, 0xE1, 0xEA, 0x7E, 0x15, 0xB6, 0x1F, 0x72, 0x68, 0xFC, 0x54,
+    0x9C, 0x04, 0x85, 0xF4, 0x2C, 0xB1, 0x65, 0xEB, 0xE8, 0x52, 0xA0, 0x1C, 0xF5, 0x12, 0xDC, 0xAB,
+    0x10, 0xCC, 0xC5, 0xF8, 0x85, 0x9A, 0x0E, 0xE5, 0xE7, 0xDE, 0xA5, 0x2B, 0x92, 0x7F, 0xC0, 0x82,
+    0xA2, 0x86, 0x67, 0xD4, 0xC5, 0x1C, 0x58, 0x03, 0xF7, 0xC7, 0xCD, 0x11, 0x21, 0xE1, 0x43, 0x78,
+    0xCA, 0xC3, 0x13, 0x3E, 0x18, 0x75, 0x2D, 0x73, 0x5E, 0x97, 0x48, 0x4B, 0xA0, 0xD1, 0x35, 0x55,
+    0x8D, 0x97, 0x23, 0xC9, 0x08, 0xAE, 0x0D, 0x6D, 0xA0, 0x1C, 0xCD, 0x7C, 0x55, 0xC0, 0x3F, 0xF2,
+    0x38, 0x08, 0x9B, 0x85, 0x2D, 0xF6, 0xA3, 0x3F, 0x5C, 0x5C, 0xE7, 0x39, 0x7A, 0xFA, 0xA4, 0xFE,
+    0x32, 0xE3, 0xA2, 0xC7, 0xED, 0x0D, 0x0C, 0xD3, 0xA0, 0x3D, 0xC0, 0xEA, 0xD1, 0xBC, 0x66, 0x17,
+    0xD5, 0x22, 0x02, 0xE3, 0x4C, 0x8E, 0xD5, 0x02, 0xE5, 0xAE, 0x0A, 0xDE, 0x63, 0x17, 0xF8, 0x21,
+    0x5D, 0x22, 0xAD, 0x09, 0x88, 0x6D, 0x08, 0x52, 0xD4, 0x4E, 0x5E, 0xCE, 0x93, 0x67, 0x9A, 0xAE,
+    0x73, 0x65, 0x36, 0x55, 0x0E, 0xB3, 0x31, 0x0F, 0x9E, 0x0D, 0x7F, 0xE3, 0x9A, 0xD5, 0x14, 0xCF,
+    0x05, 0x65, 0xCF, 0x0F, 0x31, 0x3A, 0xA1, 0xD6, 0x8D, 0xAF, 0xFD, 0x42, 0x70, 0x96, 0x7B, 0x04,
+    0x62, 0xBA, 0x8C, 0x28, 0x1C, 0xEA, 0xB3, 0xB8, 0x22, 0x82, 0xF8, 0x52, 0x1E, 0xAF, 0x09, 0xC7,
+    0x8C, 0x96, 0x13, 0x11, 0x3D, 0x19, 0x2D, 0xC5, 0x15, 0xCB, 0x96, 0x5E, 0x47, 0x7A, 0x27, 0x09,
+    0x85, 0xB1, 0x98, 0x11, 0x7B, 0x36, 0x3C, 0xD4, 0xFF, 0xB8, 0x7C, 0x1D, 0xB1, 0xAC, 0x32, 0xF1,
+    0x1C, 0x4B, 0x0F, 0x39, 0xB6, 0x52, 0x42, 0x6E, 0xEB, 0xB0, 0xA3, 0x9B, 0x9E, 0x7E, 0x33, 0x8A,
+    0x2B, 0xA1, 0xC3, 0xB8, 0x21, 0x28, 0x1D, 0xA7, 0x79, 0xFF, 0xC2, 0x59, 0xFA, 0x02, 0x9D, 0xF1,
+    0xE5, 0xD4, 0x8B, 0x96, 0x02, 0xE1, 0x7A, 0xC4, 0x6D, 0xEE, 0x96, 0xBB, 0xA1, 0x7F, 0xCC, 0x0F,
+    0xAB, 0x09, 0xFA, 0xB0, 0x27, 0xAB, 0x72, 0xCA, 0x33, 0x52, 0x2B, 0xFB, 0xB1, 0x1F, 0x6B, 0x0A,
+    0x1B, 0xCD, 0x4C, 0xBA, 0x9F, 0xAC, 0xE7, 0x0E, 0x1B, 0xDB, 0x8D, 0x81, 0x6D, 0x6D, 0x0B, 0x8B,
+    0x71, 0x32, 0xA8, 0x2B, 0x8C, 0x23, 0x5C, 0x74, 0xC1, 0x55, 0x6E, 0xDD, 0x91, 0x8B, 0x01, 0xFD,
+    0x58, 0xE2, 0xFD, 0x73, 0x4F, 0x10, 0x75, 0x39, 0xFC, 0x9F, 0xEB, 0x3F, 0x4D, 0x55, 0xBF, 0x8F,
+    0xDC, 0x44, 0x14, 0xFE, 0x6C, 0x5F, 0x62, 0xC4, 0x20, 0x26, 0x4D, 0x10, 0x62, 0x93, 0x75, 0x15,
+    0x09, 0x45, 0xC9, 0xBA, 0x24, 0x52, 0xD6, 0x6B, 0x93, 0x04, 0x51, 0x44, 0x82, 0x2B, 0x72, 0x40,
+    0x83, 0xC4, 0x3F, 0x80, 0xD2, 0x20, 0xB1, 0x48, 0x4E, 0x76, 0x92, 0x36, 0x05, 0xA9, 0xA0, 0x0A,
+    0x15, 0x0D, 0x29, 0xD8, 0x82, 0x13, 0x32, 0x62, 0xB9, 0xF5, 0x91, 0x22, 0x45, 0x0A, 0x8C, 0x22,
+    0x85, 0x02, 0x09, 0x1C, 0x91, 0x02, 0x11, 0xA1, 0x1B, 0xC1, 0x44, 0x71, 0x90, 0xCF, 0xC3, 0x37,
+    0xBB, 0xF7, 0x6B, 0x56, 0xB3, 0xDA, 0xF5, 0x8C, 0xDF, 0xFB, 0xBE, 0xF7, 0xBE, 0xF7, 0x1E, 0xD6,
+    0x56, 0x8F, 0xAE, 0xAE, 0xAD, 0x06, 0xF6, 0x0E, 0x3F, 0xA5, 0xD7, 0xF8, 0x26, 0x30, 0x08, 0x4B,
+    0x51, 0x4A, 0x85, 0x18, 0x03, 0x24, 0x40, 0x01, 0x03, 0x8D, 0xA0, 0x0A, 0xCA, 0xB0, 0x84, 0x44,
+    0xC4, 0xA7, 0xC8, 0x31, 0x43, 0x03, 0x5F, 0x07, 0x75, 0x50, 0x41, 0x2A, 0x99, 0x49, 0xF0, 0xEA,
+    0x90, 0xCF, 0xA1, 0x3D, 0xED, 0xD7, 0xCE, 0x04, 0x9F, 0xF2, 0xEA, 0xC8, 0x99, 0x68, 0x60, 0x3C,
+    0x8D, 0x9E, 0x9D, 0xFE, 0x67, 0xFF, 0xF4, 0xAC, 0x5B, 0x06, 0x6E, 0xD1, 0xA0, 0x5B, 0xD1, 0xE2,
+    0x1B, 0xEB, 0x8B, 0x6F, 0x7F, 0xF9, 0xEC, 0x79, 0xEC, 0xAC, 0xA3, 0x6B, 0x97, 0xF8, 0x4A, 0x2D,
+    0x6E, 0x37, 0x18, 0xF2, 0xBE, 0x8E, 0xE0, 0x67, 0x05, 0x88, 0x07, 0xA0, 0x03, 0x4C, 0xBA, 0xCC,
+    0xFF, 0xCF, 0x2A, 0xA1, 0x62, 0x3A, 0x4A, 0x08, 0xD4, 0x84, 0x65, 0x50, 0xC5, 0xB4, 0xD9, 0x78,
+    0xA6, 0xD7, 0xD9, 0xD7, 0xF9, 0xEE, 0xD2, 0xD0, 0xDA, 0x25, 0x1C, 0x5A, 0x43, 0xDA, 0x41, 0x38,
+    0xA2, 0x7C, 0x33, 0x73, 0x70, 0x17, 0x3C, 0x9D, 0x35, 0xA1, 0xE0, 0xE9, 0x85, 0xD9, 0x19, 0xC8,
+    0xD8, 0xB1, 0x9C, 0x74, 0xCE, 0x45, 0x3C, 0x35, 0x01, 0x89, 0xAB, 0x74, 0x71, 0x1C, 0x96, 0x3C,
+    0xA6, 0x97, 0x91, 0x0B, 0x42, 0xEE, 0x8E, 0x11, 0x2F, 0x8E, 0x63, 0xC7, 0xB0, 0xB3, 0xE7, 0xBA,
+    0x2C, 0xB2, 0xCF, 0x82, 0x5D, 0xA7, 0x0B, 0xB7, 0xEE, 0x9F, 0xF3, 0xE8, 0xE8, 0xD2, 0x19, 0x0E,
+    0xC2, 0xB7, 0x84, 0x3F, 0x57, 0x7C, 0x3D, 0x4B, 0x18, 0x2B, 0x8D, 0x82, 0xF0, 0xEB, 0x98, 0x67,
+    0x0D, 0x9A, 0x5E, 0x37, 0xBF, 0xB6, 0x07, 0xFF, 0xA5, 0x2F, 0x09, 0xBC, 0xC5, 0xE8, 0xB3, 0x96,
+    0x21, 0x6E, 0x42, 0xE5, 0xEB, 0x17, 0x10, 0xEE, 0x58, 0x49, 0x70, 0xF2, 0xB6, 0x81, 0xB5, 0x3B,
+    0xF6, 0x17, 0xAE, 0x14, 0x46, 0x22, 0x0B, 0x74, 0x4A, 0x9E, 0x93, 0x2D, 0x8D, 0xC9, 0xF6, 0x3E,
+    0x9E, 0x57, 0x32, 0x48, 0xAB, 0x62, 0xAB, 0x10, 0xA9, 0xE8, 0x41, 0x47, 0xDE, 0x61, 0xC5, 0xB4,
+    0xC7, 0xA4, 0x2D, 0x95, 0x5F, 0x93, 0x79, 0x8B, 0x84, 0xA4, 0x04, 0x23, 0x99, 0x3B, 0x9E, 0x13,
+    0x5E, 0x65, 0x46, 0x5D, 0xD6, 0x98, 0x77, 0x7A, 0x74, 0xC9, 0x35, 0x2E, 0x4C, 0x9A, 0xF1, 0x8B,
+    0xF8, 0x69, 0xC9, 0xC8, 0xD7, 0xA2, 0x22, 0xB7, 0x11, 0xD2, 0x2C, 0x45, 0xAF, 0xF1, 0xEC, 0x5C,
+    0x85, 0xB6, 0x0A, 0xED, 0x4D, 0xEC, 0x2D, 0x6F, 0x6D, 0x15, 0x9E, 0xC3, 0x99, 0xFE, 0x65, 0xE0,
+    0x33, 0x55, 0x4B, 0x39, 0xCD, 0x68, 0xC9, 0xAF, 0xE9, 0x31, 0x2C, 0xA9, 0x05, 0x59, 0x31, 0x40,
+    0xD2, 0xF1, 0x8E, 0xA6, 0x24, 0xA7, 0x87, 0x80, 0xB8, 0xA6, 0x89, 0x43, 0x38, 0x14, 0x94, 0xD3,
+    0x0F, 0x8C, 0xD3, 0xA4, 0xEE, 0x3D, 0xC2, 0xB6, 0x6F, 0xF5, 0xBE, 0xF1, 0xDE, 0xC3, 0x2A, 0xB6,
+    0x3A, 0x3A, 0xD7, 0x48, 0x24, 0xD4, 0x24, 0xF5, 0xBA, 0x59, 0xFB, 0xF5, 0xBA, 0x67, 0x12, 0xB4,
+    0x32, 0x9B, 0x87, 0xFA, 0x9B, 0x9F, 0xE6, 0xC6, 0x4A, 0x86, 0x64, 0xB9, 0x56, 0x9D, 0x25, 0x8F,
+    0x62, 0xA0, 0xAB, 0x2B, 0x40, 0x9F, 0x59, 0x29, 0x17, 0x2A, 0x94, 0xB1, 0xF6, 0xED, 0xB4, 0x4C,
+    0x55, 0xEE, 0xF4, 0x9D, 0x23, 0x71, 0x81, 0x28, 0x30, 0x14, 0x4A, 0x94, 0x85, 0x13, 0x18, 0x29,
+    0x4E, 0x15, 0x6C, 0xB5, 0xE7, 0x7A, 0xAE, 0xA2, 0xE9, 0xF5, 0x7A, 0xD0, 0x47, 0xA1, 0xC3, 0xBB,
+    0x9B, 0x6D, 0x6C, 0x9B, 0xC6, 0x7B, 0x5A, 0x05, 0xBF, 0x67, 0x72, 0x84, 0xE6, 0xEA, 0x65, 0x35,
+    0x37, 0x3B, 0x17, 0x0F, 0x77, 0x98, 0x77, 0x81, 0xCA, 0x57, 0xA8, 0x96, 0x28, 0xF3, 0x0D, 0xAE,
+    0x82, 0x41, 0x9B, 0x31, 0x7A, 0x87, 0x64, 0x36, 0x4E, 0xB7, 0xCA, 0x74, 0x79, 0x73, 0x85, 0xC0,
+    0x2A, 0xF1, 0xB9, 0x59, 0x71, 0x6A, 0x24, 0xE5, 0x91, 0x13, 0xE4, 0xC9, 0xAF, 0x7D, 0xDB, 0x09,
+    0x75, 0x95, 0x85, 0x39, 0x44, 0x42, 0x5C, 0xC4, 0x64, 0x50, 0x30, 0x0B, 0x8D, 0x57, 0xCF, 0xC2,
+    0x72, 0x32, 0x45, 0xD4, 0xEC, 0x46, 0x7A, 0x8E, 0xC1, 0xDC, 0xAF, 0xF2, 0xBE, 0xA7, 0xB5, 0x7C,
+    0xF3, 0xBA, 0x19, 0xCC, 0x61, 0x6F, 0xBA, 0x62, 0xCD, 0x56, 0x28, 0x64, 0xCA, 0x6E, 0x5E, 0xEF,
+    0x47, 0x2E, 0x2A, 0x8F, 0x61, 0x23, 0xB4, 0x41, 0x99, 0xEA, 0x5A, 0xE7, 0xF2, 0x8D, 0xE7, 0x84,
+    0xBC, 0xCE, 0x50, 0x7C, 0x6B, 0x98, 0x08, 0xF1, 0xBD, 0x2B, 0xCF, 0xD9, 0xBF, 0xBC, 0x2E, 0xDF,
+    0xFA, 0x8D, 0x86, 0x1F, 0x3E, 0xE3, 0xCF, 0x33, 0x71, 0x1F, 0x17, 0x64, 0x50, 0xE9, 0xB1, 0x2D,
+    0x87, 0xD2, 0x0A, 0x1D, 0x66, 0x13, 0xB5, 0x67, 0xCF, 0xEF, 0x30, 0x99, 0x07, 0x2A, 0x59, 0x61,
+    0xA2, 0x42, 0x75, 0xA8, 0x40, 0xCA, 0x8E, 0x50, 0x43, 0xFC, 0x88, 0x78, 0xE8, 0x99, 0x6E, 0xAA,
+    0x96, 0xF5, 0x1F, 0x97, 0xE1, 0x8D, 0x16, 0xAC, 0x2E, 0x89, 0xDC, 0xD3, 0x42, 0xF5, 0xF9, 0xBB,
+    0x92, 0x18, 0xFA, 0xB5, 0x28, 0x13, 0xAF, 0x09, 0xAA, 0xB3, 0x2A, 0x91, 0x9F, 0xDC, 0xB7, 0x77,
+    0xDB, 0xA8, 0x1E, 0xED, 0x98, 0xCE, 0x7C, 0xF5, 0x2A, 0xF2, 0x30, 0x0B, 0x1F, 0xD4, 0x88, 0x77,
+    0xC9, 0xFA, 0x2D, 0xC6, 0xF3, 0x52, 0x66, 0x43, 0x68, 0xA7, 0xA0, 0xC2, 0xAB, 0x25, 0xCB, 0x49,
+    0x07, 0xE5, 0x00, 0xB3, 0xA0, 0x8A, 0x54, 0x12, 0x14, 0x41, 0xF5, 0xF4, 0x56, 0xDA, 0x4E, 0x36,
+    0xBB, 0x60, 0x97, 0x77, 0xAF, 0x16, 0xF7, 0x5A, 0xA9, 0xFB, 0xF2, 0x3D, 0xF1, 0x36, 0x82, 0x7B,
+    0xC0, 0xD3, 0x0C, 0x67, 0x2B, 0x44, 0x39, 0xC4, 0xA7, 0x59, 0xB0, 0xA9, 0x8F, 0xE8, 0xE4, 0x4C,
+    0x2E, 0xDA, 0xD3, 0xD8, 0xDE, 0x0F, 0x54, 0x4C, 0xDC, 0x94, 0x1C, 0x4F, 0x11, 0x9E, 0x23, 0x21,
+    0x06, 0xF4, 0x45, 0x8A, 0xE6, 0x38, 0xB7, 0x6B, 0x4E, 0x67, 0xA8, 0xD0, 0x75, 0x79, 0xE1, 0x84,
+    0x96, 0xA7, 0xD2, 0x4A, 0x9A, 0x34, 0x93, 0xFB, 0x12, 0x39, 0xDC, 0xB0, 0xDA, 0x52, 0xE3, 0x6D,
+    0x43, 0x6A, 0xA9, 0xF1, 0x5A, 0xF9, 0xB1, 0xC2, 0xAF, 0xE7, 0x6F, 0x21, 0x3C, 0x7E, 0x6A, 0x1D,
+    0xA7, 0xC6, 0xF7, 0x4B, 0xD4, 0x8F, 0x25, 0x82, 0xF3, 0x66, 0x88, 0x63, 0x72, 0xB3, 0xBE, 0x54,
+    0x27, 0xE1, 0x17, 0x36, 0xD3, 0xD1, 0x3F, 0xC6, 0xA7, 0x48, 0xB0, 0x13, 0xAF, 0x8B, 0xAD, 0xD3,
+    0x9F, 0x64, 0x99, 0x69, 0x99, 0x45, 0x78, 0xF2, 0x4E, 0x2D, 0xED, 0xB6, 0xF7, 0xE4, 0x5D, 0x32,
+    0xCD, 0x83, 0x4A, 0xA8, 0x21, 0xBE, 0xFB, 0xA5, 0x94, 0x4D, 0x81, 0x8D, 0x5D, 0xBF, 0x97, 0x6B,
+    0xDF, 0x36, 0xB2, 0xCC, 0xD9, 0x1F, 0xD9, 0x61, 0x16, 0xA2, 0x49, 0xCC, 0x42, 0x37, 0x0D, 0xF4,
+    0x2C, 0xA8, 0x27, 0x53, 0x15, 0x6D, 0xEF, 0x61, 0x14, 0xF5, 0xFC, 0x8E, 0xC5, 0xD8, 0x18, 0x31,
+    0x93, 0xB0, 0x9E, 0x96, 0xD5, 0x00, 0x4C, 0x44, 0xE4, 0x92, 0xE2, 0x6A, 0xAF, 0x38, 0x5F, 0xCA,
+    0xF7, 0x73, 0xD8, 0x1B, 0x4A, 0xEE, 0xE9, 0xC7, 0xDB, 0x08, 0xB5, 0xDF, 0xC5, 0x2D, 0xFA, 0xE3,
+    0x19, 0x06, 0x55, 0x82, 0x94, 0x30, 0x52, 0x4E, 0x83, 0xC4, 0xB5, 0x48, 0x42, 0x75, 0x13, 0xC4,
+    0x70, 0x28, 0x10, 0x39, 0x9B, 0x02, 0xFC, 0x2D, 0x8E, 0x8E, 0x6A, 0x59, 0x6D, 0x6E, 0x87, 0x14,
+    0x4E, 0x4C, 0x08, 0x27, 0xBF, 0x5A, 0x0E, 0x85, 0xD6, 0xB7, 0x55, 0xF1, 0x72, 0xDF, 0x9D, 0xE5,
+    0xAE, 0x2D, 0x1B, 0xD7, 0xE3, 0x1A, 0x5C, 0x2C, 0xC7, 0x13, 0xEB, 0xDB, 0x6C, 0xAF, 0xDC, 0xEB,
+    0x38, 0xDB, 0x10, 0x6D, 0xAA, 0x6D, 0xD9, 0x4F, 0xF2, 0x27, 0x5A, 0xCC, 0xFA, 0x7A, 0x18, 0xB4,
+    0x82, 0x13, 0x62, 0x3B, 0x30, 0x42, 0x8D, 0xD0, 0x3A, 0xE0, 0xD4, 0x81, 0x50, 0x11, 0xC6, 0x8C,
+    0x4E, 0x76, 0xFA, 0x08, 0x35, 0x21, 0x3F, 0xCC, 0x29, 0x8D, 0x6E, 0x80, 0xF1, 0xC1, 0xCC, 0x32,
+    0xC6, 0xB9, 0x67, 0x59, 0x67, 0x52, 0x0D, 0xD8, 0xF8, 0x4E, 0xD3, 0xFB, 0x90, 0x55, 0x39, 0x24,
+    0xD2, 0x8F, 0xD8, 0x9B, 0x34, 0x75, 0x5F, 0xC1, 0xFB, 0x83, 0x70, 0x1F, 0x93, 0xF1, 0xDF, 0x58,
+    0x34, 0x74, 0x5F, 0x2F, 0x19, 0xB0, 0x42, 0x4E, 0xB0, 0x4E, 0xA9, 0x72, 0x0C, 0xF6, 0xF0, 0x85,
+    0x2D, 0xFF, 0xF1, 0xE9, 0x78, 0xC5, 0x0D, 0x8C, 0xC5, 0xF6, 0x78, 0xA1, 0xD7, 0x65, 0x8B, 0x79,
+    0x76, 0xFF, 0xE7, 0x86, 0x83, 0x63, 0x36, 0xA4, 0x9F, 0x82, 0xDB, 0x84, 0x6A, 0x68, 0x44, 0x96,
+    0x73, 0x17, 0x85, 0xF4, 0xF4, 0x15, 0x29, 0xCA, 0x78, 0xCB, 0xE2, 0xB0, 0x7D, 0xB4, 0x68, 0x4D,
+    0x38, 0xCD, 0xCD, 0x4E, 0xF8, 0x01, 0xFB, 0xD3, 0xFC, 0x80, 0x1F, 0xAF, 0x40, 0x2B, 0xDA, 0x80,
+    0x83, 0x41, 0x5E, 0x40, 0xC4, 0x4B, 0xD2, 0xD5, 0xAC, 0x5E, 0x4E, 0x18, 0xC1, 0x8B, 0x7D, 0xFE,
+    0x1E, 0x1B, 0x1C, 0xD1, 0x33, 0xA4, 0xAC, 0x6F, 0xF6, 0x66, 0x75, 0x80, 0xF5, 0xFF, 0x9D, 0x55,
+    0xCF, 0x8F, 0x14, 0x45, 0x14, 0xFE, 0xBA, 0x0B, 0x68, 0xA5, 0xA2, 0xB5, 0x24, 0x7A, 0x02, 0xB6,
+    0xBD, 0x98, 0x18, 0xC3, 0x4E, 0x7B, 0x24, 0xD2, 0xBD, 0xD3, 0x80, 0x89, 0x1A, 0x2F, 0x1C, 0xE4,
+    0xA4, 0x89, 0x5E, 0x8D, 0x24, 0x7B, 0xF1, 0x30, 0x9A, 0x86, 0x29, 0xDC, 0x93, 0xF1, 0xE0, 0xFE,
+    0x09, 0x1C, 0x3C, 0x10, 0x0E, 0xE2, 0x61, 0x0F, 0x23, 0x99, 0x65, 0x0A, 0x39, 0x78, 0xE0, 0x60,
+    0x23, 0x31, 0x9E, 0x4C, 0x0A, 0x10, 0x0E, 0x6C, 0x8C, 0x45, 0xE8, 0x4D, 0x06, 0xE9, 0x99, 0xF2,
+    0xAB, 0xD9, 0xD9, 0x85, 0x9B, 0xD1, 0xCA, 0x6C, 0x6F, 0x77, 0xA7, 0xDE, 0xAB, 0xF7, 0xBE, 0x1F,
+    0xAF, 0x33, 0x93, 0x7C, 0xDD, 0xA2, 0x11, 0x46, 0xA1, 0x8A, 0x9C, 0xD4, 0x8B, 0xBC, 0xAF, 0x15,
+    0xF2, 0xD8, 0x4A, 0x53, 0x44, 0x63, 0x51, 0x1F, 0xFB, 0xAA, 0x50, 0x5F, 0xDC, 0xF2, 0x3F, 0xB5,
+    0xA9, 0x7D, 0xD3, 0x00, 0x39, 0x20, 0xB6, 0xFF, 0xA9, 0x12, 0xD1, 0xDA, 0x8A, 0x96, 0x5D, 0x9B,
+    0x98, 0x41, 0x6C, 0x97, 0xD0, 0x30, 0x4C, 0x98, 0x2E, 0x26, 0x23, 0x9D, 0x3E, 0xA9, 0x01, 0xC7,
+    0x6D, 0x0B, 0x48, 0x73, 0xC8, 0x16, 0x51, 0x0B, 0xAE, 0xCC, 0x48, 0xAC, 0x8F, 0x4C, 0x16, 0xCE,
+    0x5B, 0x8E, 0x5C, 0x62, 0xC2, 0x31, 0x3A, 0x8F, 0x79, 0x60, 0x4F, 0x98, 0x14, 0x4D, 0x62, 0x3A,
+    0x91, 0x53, 0xBA, 0x10, 0x2E, 0xD5, 0xB9, 0xB4, 0xC7, 0xDE, 0xCA, 0x97, 0xDC, 0xE6, 0x87, 0xDD,
+    0x2D, 0x7F, 0x63, 0x9C, 0x99, 0x69, 0x62, 0xF1, 0xBF, 0xB2, 0xBC, 0x13, 0xB2, 0x9C, 0x09, 0x59,
+    0xDA, 0x90, 0xE5, 0x62, 0x48, 0x92, 0xEF, 0x5E, 0x8E, 0xF2, 0x2F, 0x72, 0xE1, 0xA2, 0x79, 0x89,
+    0xFD, 0xE8, 0x84, 0xF7, 0xB5, 0x4D, 0x18, 0x59, 0xEE, 0x95, 0x25, 0x12, 0xAF, 0xC5, 0x83, 0x36,
+    0x62, 0x72, 0x02, 0x93, 0xC3, 0xA9, 0x72, 0x10, 0x6D, 0x0D, 0x91, 0x8D, 0x43, 0xEC, 0x41, 0x0B,
+    0xB1, 0x3A, 0x05, 0x7A, 0x71, 0x0D, 0x96, 0x80, 0x50, 0x12, 0x14, 0xFA, 0x53, 0x42, 0xF9, 0x60,
+    0xDC, 0x81, 0x93, 0xD7, 0x19, 0x58, 0x31, 0x4C, 0xAE, 0x5E, 0x53, 0x70, 0x95, 0x7D, 0xBC, 0x21,
+    0x5B, 0xE1, 0xCB, 0x73, 0xB3, 0x4E, 0x0E, 0xD6, 0xF0, 0x1A, 0x45, 0x80, 0x2A, 0xD1, 0xC8, 0xBC,
+    0x9E, 0xAE, 0xAC, 0x9A, 0x34, 0x45, 0xDE, 0x8B, 0x1E, 0x3A, 0x75, 0xF2, 0xFE, 0x38, 0xF1, 0xE5,
+    0x6C, 0x23, 0xE2, 0x29, 0xFA, 0x9E, 0xED, 0x3E, 0x87, 0x21, 0x8B, 0xDD, 0xFB, 0x81, 0xE9, 0x7A,
+    0x9C, 0x1A, 0x40, 0xFC, 0x82, 0x94, 0xC0, 0x5F, 0x5D, 0xD1, 0xA3, 0x06, 0xF3, 0xB5, 0xAF, 0x45,
+    0x66, 0x09, 0x8F, 0xD7, 0x95, 0xAC, 0x2B, 0x79, 0xDE, 0x89, 0xBA, 0x59, 0xC6, 0xB2, 0x7A, 0xDB,
+    0x88, 0x9B, 0xBE, 0x45, 0x91, 0x7E, 0xA4, 0xC5, 0x8F, 0xF5, 0x18, 0x83, 0x42, 0x6A, 0x25, 0xCC,
+    0x50, 0xD4, 0x95, 0xF8, 0x7B, 0x2C, 0x75, 0x3A, 0xD9, 0x49, 0xE0, 0x4D, 0x3C, 0x6D, 0x31, 0x48,
+    0xB4, 0xC2, 0x3A, 0x1B, 0x26, 0xD3, 0x0E, 0x23, 0x8F, 0xE8, 0x89, 0x45, 0x5E, 0x80, 0x9D, 0x1C,
+    0x70, 0xF9, 0xDD, 0x49, 0xD2, 0x76, 0xCB, 0xE5, 0x79, 0x48, 0x64, 0x82, 0x1C, 0x32, 0x84, 0xDF,
+    0xE1, 0xF9, 0xBB, 0x15, 0x23, 0x2F, 0x9B, 0xF5, 0x34, 0xD1, 0x55, 0x2E, 0x6E, 0xDA, 0x0D, 0x3E,
+    0x74, 0xFF, 0x40, 0x03, 0x51, 0x47, 0xCA, 0x54, 0xA9, 0xAF, 0xB7, 0x11, 0xC4, 0xA9, 0x97, 0xE2,
+    0x66, 0x23, 0x76, 0x43, 0x94, 0x0B, 0xBB, 0x81, 0xF1, 0xA6, 0x93, 0xC7, 0xDD, 0x62, 0xE4, 0x72,
+    0x51, 0xF7, 0xB2, 0xF2, 0x4A, 0x0B, 0xBF, 0xC6, 0x50, 0xFE, 0xCA, 0x36, 0x31, 0x7D, 0x5F, 0xCE,
+    0x63, 0x17, 0x48, 0x17, 0xF0, 0xA9, 0x09, 0xFC, 0xED, 0x9F, 0x0E, 0x85, 0x9F, 0x12, 0xFC, 0x00,
+    0x65, 0x5C, 0x6F, 0xE0, 0xA1, 0x37, 0xC5, 0x56, 0x93, 0xDA, 0x65, 0xE9, 0xD4, 0x97, 0x04, 0x61,
+    0x8C, 0x26, 0x67, 0xF7, 0x48, 0xA5, 0x26, 0x2B, 0xC2, 0xBA, 0x20, 0xD0, 0xC1, 0x4C, 0x04, 0x1D,
+    0x1C, 0x4A, 0x21, 0x99, 0xEA, 0x87, 0x39, 0xDA, 0x35, 0xD2, 0x70, 0x1A, 0x7B, 0x7A, 0x63, 0xDE,
+    0xE0, 0x48, 0x13, 0xD0, 0x9A, 0xED, 0x55, 0x48, 0x6A, 0x6C, 0x20, 0xD5, 0xB1, 0x0B, 0xDD, 0xBA,
+    0xE8, 0x64, 0xBD, 0xA8, 0x9E, 0x38, 0xB5, 0x83, 0x5E, 0x34, 0x2A, 0x33, 0x1F, 0xDB, 0xD7, 0x16,
+    0x67, 0xAC, 0xFE, 0xBA, 0xC6, 0xB0, 0xD0, 0x34, 0x94, 0xDE, 0xD3, 0x8D, 0x1C, 0x6B, 0x1F, 0xD9,
+    0x1D, 0x9C, 0x27, 0xB1, 0xB7, 0xBD, 0xE7, 0x79, 0xC8, 0x10, 0xA2, 0x41, 0x6A, 0xD1, 0x2D, 0xD1,
+    0xBE, 0x92, 0xDC, 0xD0, 0xEB, 0xA3, 0xEF, 0xE2, 0x39, 0xF3, 0xB1, 0x4B, 0xCD, 0xD9, 0xD9, 0x9D,
+    0x74, 0xFD, 0x60, 0xD2, 0xD8, 0xAA, 0xB2, 0x8A, 0x29, 0xC3, 0xFC, 0xC0, 0xA3, 0x1B, 0x6D, 0x4A,
+    0xCD, 0xEE, 0x8D, 0x4E, 0x34, 0x1B, 0x99, 0x34, 0x73, 0x00, 0x33, 0x93, 0xB4, 0xC1, 0xA3, 0x15,
+    0x15, 0xC9, 0x1E, 0x52, 0xA6, 0xA0, 0xC4, 0xC4, 0x35, 0x54, 0x8E, 0x46, 0x3C, 0xB7, 0x23, 0x13,
+    0x08, 0x8B, 0x68, 0x1C, 0xFA, 0x79, 0xBA, 0xA4, 0x0B, 0x5E, 0x0D, 0xBD, 0x27, 0x06, 0xB1, 0x0D,
+    0x10, 0x04, 0x78, 0xF8, 0xCC, 0x54, 0x62, 0xDB, 0xD2, 0x55, 0x80, 0x2B, 0x20, 0xC3, 0x2D, 0x7C,
+    0x75, 0xDF, 0xA1, 0xCF, 0xA8, 0x7A, 0x37, 0xC7, 0x88, 0xB7, 0x8A, 0x50, 0xC2, 0xF5, 0x98, 0xE6,
+    0x04, 0x9F, 0x8E, 0x90, 0x13, 0xD8, 0xE5, 0x8B, 0x48, 0x8E, 0x53, 0x7F, 0xB4, 0x55, 0x03, 0x1B,
+    0x2C, 0x5B, 0x3A, 0xF9, 0x6E, 0x45, 0x4F, 0x75, 0x6B, 0xF9, 0x5B, 0x3D, 0x81, 0x9C, 0x23, 0x98,
+    0x99, 0x43, 0x18, 0x99, 0x82, 0xF9, 0xF3, 0x99, 0xA7, 0x54, 0xD9, 0x83, 0x3A, 0x7D, 0xE5, 0x5B,
+    0xE5, 0xFD, 0x24, 0x3D, 0xED, 0xB2, 0xE0, 0xED, 0x22, 0xB2, 0x69, 0x1E, 0xB9, 0xA5, 0x0A, 0x8F,
+    0x87, 0x03, 0xF4, 0xED, 0x5C, 0x0D, 0xC8, 0xDC, 0x4C, 0x0E, 0xA1, 0x62, 0xEA, 0x01, 0x5D, 0x6F,
+    0x83, 0x20, 0xD0, 0x0B, 0x94, 0xF6, 0xA1, 0xE4, 0x14, 0x79, 0x33, 0x88, 0x36, 0x45, 0x2D, 0x39,
+    0xAC, 0x32, 0x26, 0x6F, 0x63, 0xCB, 0x71, 0x57, 0xD2, 0x72, 0x0B, 0x83, 0xE8, 0xD1, 0xF5, 0x3A,
+    0x99, 0x50, 0xEE, 0x66, 0xB7, 0x19, 0x06, 0xF3, 0x49, 0x9A, 0x19, 0x1E, 0x7A, 0x47, 0x9F, 0x3A,
+    0xCB, 0x5C, 0xD7, 0xF4, 0x8A, 0x8F, 0x97, 0x58, 0xDD, 0x11, 0x88, 0xDF, 0x81, 0xBF, 0x4A, 0x9C,
+    0x75, 0xE8, 0x14, 0x50, 0x89, 0x39, 0x69, 0x9A, 0xDB, 0x2E, 0x73, 0xEB, 0x62, 0xD7, 0x92, 0xB4,
+    0x07, 0x68, 0x95, 0xA8, 0x99, 0x01, 0xBB, 0xEB, 0x90, 0x40, 0xD5, 0xBF, 0x0C, 0x5F, 0x5D, 0xA8,
+    0xCF, 0xB7, 0x87, 0xEF, 0x8E, 0xD5, 0xF6, 0x30, 0xDB, 0x21, 0xF2, 0x7B, 0x14, 0xE2, 0x9E, 0x43,
+    0xE4, 0xF5, 0x6E, 0xB1, 0xE7, 0x98, 0xC4, 0xF3, 0x1C, 0xA5, 0x3B, 0x2C, 0x79, 0x89, 0x7B, 0x72,
+    0x84, 0x91, 0x15, 0xD7, 0x9F, 0x91, 0x4C, 0xEE, 0xBD, 0x5D, 0x23, 0xBA, 0xCB, 0xF3, 0x37, 0x59,
+    0xCA, 0x9F, 0x98, 0xB1, 0x4F, 0x6D, 0xCC, 0xE6, 0x39, 0x01, 0x7B, 0x75, 0x08, 0x74, 0x89, 0x64,
+    0xA7, 0xFC, 0x4F, 0x85, 0xDD, 0x61, 0x61, 0x17, 0x80, 0x17, 0x03, 0xC7, 0x33, 0x75, 0xEC, 0xE7,
+    0xDD, 0xEB, 0x17, 0x59, 0x99, 0x9D, 0xD9, 0x8B, 0x1A, 0xC9, 0xBC, 0xB7, 0xD3, 0xE9, 0x68, 0xF5,
+    0xBC, 0x3B, 0xFC, 0x82, 0xD4, 0xDF, 0x2F, 0x84, 0x56, 0x02, 0x14, 0xFE, 0x02, 0x52, 0xCF, 0x41,
+    0x14, 0x37, 0xC2, 0x0A, 0x2A, 0x5A, 0x9A, 0x0A, 0x64, 0x17, 0x0D, 0x07, 0xD3, 0xF9, 0xD1, 0xE6,
+    0x58, 0xD1, 0xCF, 0x3B, 0xEB, 0xA0, 0xCD, 0xA8, 0x4D, 0x32, 0xBD, 0x78, 0x74, 0x00, 0x39, 0x60,
+    0x77, 0x2D, 0xC9, 0x69, 0xC5, 0x03, 0xBD, 0x1C, 0xF9, 0x36, 0xC5, 0xBA, 0x7A, 0x4F, 0x17, 0xF1,
+    0x5D, 0x16, 0xB9, 0x4E, 0xAF, 0xE7, 0x15, 0x36, 0xCE, 0x76, 0x76, 0x25, 0x85, 0x4F, 0xC2, 0x69,
+    0x63, 0xA8, 0x7B, 0x2B, 0x46, 0x99, 0x68, 0x4C, 0x4E, 0x33, 0x12, 0x91, 0xDC, 0x62, 0x89, 0x5B,
+    0x44, 0xA0, 0xB8, 0x7A, 0xE9, 0xD2, 0xE5, 0xBE, 0xF7, 0xFE, 0x67, 0x8D, 0xE8, 0x11, 0x5F, 0x8E,
+    0x83, 0x31, 0xBA, 0x24, 0x8D, 0x5E, 0xCF, 0x30, 0x01, 0xB5, 0xF3, 0x37, 0x6B, 0x19, 0x3D, 0x7E,
+    0xEA, 0x95, 0x15, 0xCB, 0x21, 0x49, 0x34, 0x52, 0x74, 0x72, 0xA4, 0x2C, 0x7C, 0xE4, 0xA7, 0x0D,
+    0x0A, 0x87, 0xAA, 0x41, 0x33, 0x88, 0x5D, 0xF7, 0xF2, 0x7C, 0xA2, 0xBE, 0xFC, 0x3E, 0xF6, 0x7D,
+    0xE3, 0x8D, 0x68, 0xB3, 0x35, 0xEA, 0x7A, 0x4C, 0xA8, 0x95, 0x26, 0x28, 0xC3, 0x60, 0x50, 0xE2,
+    0x4B, 0x80, 0xED, 0x4C, 0xEB, 0x28, 0x92, 0x60, 0xB2, 0x50, 0x0E, 0xC1, 0x8C, 0xEF, 0x90, 0x95,
+    0x45, 0x7E, 0x9B, 0xA2, 0x27, 0x41, 0x87, 0x41, 0xE1, 0xE1, 0x13, 0xAA, 0xF4, 0x33, 0x76, 0x5D,
+    0x81, 0xD8, 0x6C, 0xD1, 0x35, 0x8D, 0xB8, 0x27, 0xEA, 0x0E, 0x8D, 0x62, 0xB1, 0xC4, 0x84, 0xEB,
+    0xA4, 0xFB, 0x96, 0x86, 0x3C, 0x43, 0x2E, 0xEB, 0x20, 0x8B, 0xD9, 0xE7, 0x2D, 0x79, 0x36, 0xF2,
+    0xE9, 0xFA, 0x07, 0xAD, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xF6, 0xE4, 0xCE, 0x11, 0x56,
+    0x98, 0x2B, 0x12, 0x9A, 0x43, 0x6B, 0x8A, 0x14, 0x01, 0xDD, 0x9D, 0xDB, 0x2B, 0xBC, 0xE7, 0x11,
+    0x08, 0x51, 0x9C, 0x80, 0x48, 0xE4, 0x04, 0x5D, 0xE8, 0x29, 0x92, 0x0A, 0xB6, 0x70, 0xB2, 0x0E,
+    0x41, 0x4A, 0x41, 0x41, 0xC4, 0x0F, 0x80, 0xD0, 0x91, 0x80, 0xC4, 0x21, 0x9D, 0xD0, 0x4A, 0x6C,
+    0xCE, 0x26, 0x94, 0x27, 0x21, 0xA3, 0x28, 0x34, 0x08, 0x30, 0x90, 0x2A, 0x05, 0x37, 0x10, 0x43,
+    0x1C, 0xCE, 0xEB, 0xE1, 0xCD, 0x7A, 0x2F, 0x04, 0x52, 0x84, 0x82, 0xD1, 0xEE, 0xC8, 0x33, 0xE3,
+    0x99, 0xF7, 0xE6, 0x7D, 0xEF, 0xFB, 0x0C, 0x74, 0x2D, 0x3D, 0xC4, 0x2E, 0x72, 0x72, 0x40, 0x94,
+    0x23, 0x3E, 0x06, 0xAD, 0x9D, 0x3D, 0x32, 0x5B, 0xC5, 0xDC, 0x86, 0x3A, 0x72, 0x02, 0xA6, 0xF2,
+    0x4C, 0xE1, 0xD4, 0xF0, 0x0B, 0x04, 0x40, 0x03, 0x57, 0x23, 0x4E, 0xB1, 0x02, 0x59, 0x41, 0x14,
+    0xE2, 0x07, 0xA0, 0x8F, 0x5F, 0x35, 0xBC, 0x3C, 0x0A, 0x81, 0x71, 0x20, 0x4A, 0xC8, 0x0B, 0x69,
+    0x1F, 0xF8, 0xBD, 0xF4, 0x72, 0xC8, 0x11, 0xC6, 0x70, 0x5A, 0xF8, 0x29, 0x42, 0x05, 0x6E, 0xE0,
+    0xAA, 0x72, 0xB2, 0xD4, 0x6B, 0x31, 0x9C, 0xB8, 0x46, 0x5B, 0x94, 0x35, 0xDB, 0xF1, 0x5D, 0xB6,
+    0xCA, 0x76, 0xCB, 0xB6, 0x13, 0x0A, 0xF7, 0x9A, 0x72, 0xD3, 0x63, 0x48, 0x3C, 0xE5, 0x7D, 0x53,
+    0x22, 0xAC, 0x67, 0x93, 0x6E, 0x83, 0x41, 0x96, 0x4B, 0x15, 0x41, 0x7B, 0x79, 0x80, 0x91, 0x53,
+    0x4A, 0x12, 0xD1, 0x22, 0xEF, 0x61, 0x2C, 0x8A, 0x20, 0xED, 0x8B, 0xD1, 0x4B, 0xC5, 0x9D, 0xF7,
+    0xE2, 0x66, 0xF8, 0x75, 0x2B, 0x1A, 0x1E, 0x98, 0x02, 0x9B, 0xC0, 0xA3, 0x7C, 0x22, 0xD4, 0x02,
+    0xB0, 0x71, 0x02, 0xC2, 0x94, 0xE0, 0xC5, 0x2C, 0xB8, 0x93, 0x7D, 0x08, 0x49, 0x3E, 0xA2, 0x00,
+    0x19, 0x02, 0x43, 0xA3, 0xDC, 0x3F, 0xB3, 0x54, 0xA6, 0xA1, 0xEA, 0x93, 0xA1, 0xC6, 0xC8, 0xCB,
+    0x45, 0x19, 0x72, 0xAD, 0x46, 0xBD, 0xD8, 0x66, 0xE7, 0x0C, 0xF7, 0xDA, 0x36, 0xBF, 0x89, 0x61,
+    0x01, 0x09, 0x24, 0x70, 0x0B, 0x98, 0x7A, 0xBE, 0xBD, 0xE8, 0x94, 0x76, 0x1C, 0xC1, 0xD9, 0x6B,
+    0xFC, 0x5B, 0x0D, 0x49, 0x69, 0x71, 0x3D, 0x97, 0x12, 0xA3, 0xF0, 0x64, 0x1E, 0x77, 0xFC, 0xE7,
+    0x2E, 0xC3, 0xE1, 0x09, 0xCE, 0xFB, 0x4F, 0xD7, 0x14, 0x35, 0x41, 0x48, 0xEE, 0x2B, 0xDC, 0xD2,
+    0x5F, 0x48, 0x10, 0xAD, 0xD6, 0x48, 0x42, 0x8D, 0xAB, 0x59, 0x0A, 0x63, 0x28, 0x0A, 0xA9, 0x6B,
+    0x37, 0x77, 0x28, 0x16, 0xA5, 0xB7, 0x12, 0x62, 0xF1, 0xAE, 0x65, 0xD8, 0x09, 0xE1, 0x6C, 0x7B,
+    0xDA, 0x6D, 0xC3, 0x06, 0xBD, 0xC1, 0x18, 0x2B, 0x45, 0x9F, 0xC1, 0xE1, 0xDF, 0x9E, 0xC5, 0x73,
+    0x13, 0x8C, 0x30, 0xDA, 0xAC, 0x50, 0xBD, 0x5E, 0xA2, 0x8A, 0x73, 0xC7, 0x64, 0x70, 0x77, 0x0D,
+    0x99, 0xFA, 0x94, 0x41, 0x28, 0x2B, 0x85, 0x47, 0x61, 0xC2, 0x09, 0xF0, 0xD4, 0xE5, 0x4E, 0x57,
+    0xDB, 0x51, 0x04, 0x6C, 0x39, 0x1B, 0x1B, 0x09, 0x09, 0xB4, 0xF0, 0x6E, 0x5D, 0x51, 0x16, 0x9D,
+    0xA1, 0x04, 0x59, 0x76, 0x02, 0x59, 0xA1, 0xEE, 0x4D, 0xAE, 0xED, 0x4F, 0xE6, 0xFF, 0x9A, 0x3C,
+    0x75, 0xF3, 0x6F, 0xA2, 0xDD, 0x32, 0x57, 0x23, 0x37, 0x9B, 0x38, 0xA6, 0xB6, 0x43, 0x4A, 0x85,
+    0xC1, 0x34, 0xE4, 0xDC, 0x3E, 0x5B, 0x9E, 0x8E, 0xDD, 0x5D, 0x20, 0x9B, 0x6D, 0xDB, 0xD8, 0xD8,
+    0x20, 0x0F, 0x83, 0xE0, 0xCA, 0x36, 0xC5, 0x5A, 0xA1, 0x58, 0xCB, 0xEC, 0x97, 0x78, 0x41, 0xEB,
+    0x3D, 0xCC, 0x5D, 0x3D, 0x81, 0xC0, 0x30, 0xC4, 0xF5, 0xCC, 0x41, 0xBA, 0x23, 0xF1, 0x0F, 0xB1,
+    0xDA, 0x2E, 0x58, 0x2D, 0xB2, 0x56, 0xA4, 0xC9, 0x01, 0x47, 0x1F, 0x94, 0x6A, 0xAD, 0xC2, 0x10,
+    0xFE, 0x2F, 0x18, 0x1F, 0x16, 0xC5, 0x9C, 0x54, 0x83, 0x78, 0x37, 0x8F, 0xAB, 0x19, 0x22, 0x6D,
+    0x6F, 0x26, 0x44, 0x1C, 0x13, 0x31, 0x22, 0xE2, 0x2A, 0x11, 0x17, 0xF6, 0x11, 0x71, 0xD6, 0x14,
+    0xC8, 0x4C, 0x85, 0xDA, 0x69, 0x88, 0x38, 0x26, 0x62, 0x42, 0xC4, 0x84, 0x88, 0x09, 0x11, 0xC7,
+    0x8B, 0x35, 0x46, 0xC3, 0x89, 0xE5, 0x32, 0xE5, 0x50, 0xE0, 0x68, 0x90, 0x22, 0x26, 0x85, 0xB0,
+    0xF3, 0x4C, 0x6C, 0xEA, 0x98, 0x59, 0x95, 0x6F, 0xFA, 0xE9, 0xAB, 0xBC, 0x37, 0xCD, 0x22, 0x4F,
+    0x95, 0x81, 0xA9, 0x43, 0x45, 0xB7, 0xF4, 0xA3, 0xE9, 0x6F, 0x40, 0x58, 0x86, 0x8F, 0xF1, 0x73,
+    0xF4, 0x23, 0x5E, 0x21, 0x8D, 0xF2, 0xA8, 0xE5, 0x31, 0x1C, 0x39, 0xEE, 0x5C, 0x12, 0x13, 0x61,
+    0xF2, 0x38, 0xF7, 0x1B, 0xA7, 0x12, 0x14, 0x77, 0x4B, 0xE4, 0x56, 0x6B, 0x1D, 0xD0, 0x80, 0x70,
+    0xF3, 0x51, 0xCF, 0x4A, 0x7D, 0xBE, 0xB0, 0x71, 0xF0, 0x69, 0x3B, 0x0B, 0xB8, 0x6D, 0xEF, 0x25,
+    0xF6, 0xF6, 0x2C, 0x7E, 0xE8, 0x5F, 0xB0, 0x61, 0xAA, 0xFA, 0x92, 0x91, 0x0F, 0x52, 0xCD, 0xA4,
+    0x46, 0xE3, 0xD9, 0x23, 0x64, 0xBE, 0x62, 0x23, 0x37, 0xC1, 0x16, 0xD3, 0x3C, 0x28, 0xFC, 0xCA,
+    0x6D, 0x9C, 0x09, 0x8C, 0x76, 0x27, 0x9D, 0xD3, 0x3A, 0x71, 0xBA, 0x54, 0x45, 0xAF, 0x0B, 0xCE,
+    0x66, 0xE7, 0x9A, 0x14, 0xF7, 0xB7, 0x20, 0x7F, 0x1C, 0xDB, 0x9E, 0x11, 0x79, 0xAC, 0x4B, 0x9D,
+    0xC8, 0x67, 0x0F, 0xFA, 0xF2, 0x4D, 0xEE, 0xFA, 0xAC, 0x62, 0x91, 0xF1, 0x3F, 0xB7, 0x80, 0xE3,
+    0xDB, 0xA4, 0x22, 0x5F, 0xF8, 0x9E, 0xA7, 0xFE, 0x78, 0x97, 0x8F, 0xAB, 0x61, 0xCF, 0x79, 0x4B,
+    0x8A, 0x42, 0x0F, 0x4C, 0x1E, 0x49, 0xB3, 0xAE, 0x3D, 0x35, 0x3C, 0x3D, 0x45, 0x9B, 0x16, 0x82,
+    0x2D, 0xDB, 0xF9, 0xF6, 0xD1, 0x9D, 0x4A, 0x78, 0x14, 0x78, 0xEC, 0x22, 0x43, 0xA0, 0xD6, 0x5E,
+    0xD6, 0xCC, 0x7B, 0x4F, 0x49, 0x95, 0x5A, 0x3B, 0x69, 0xFB, 0x7B, 0xAD, 0x42, 0x48, 0xB1, 0x59,
+    0xAF, 0x78, 0x0D, 0x84, 0x07, 0x21, 0xDF, 0x56, 0xDE, 0x75, 0xED, 0xE9, 0xE1, 0xAE, 0x66, 0x29,
+    0xA3, 0x44, 0x00, 0xCF, 0x5E, 0x82, 0xE0, 0x5B, 0xED, 0x3E, 0x67, 0x97, 0x25, 0x29, 0x13, 0x69,
+    0xFF, 0x00, 0xA3, 0xE9, 0xA5, 0x73, 0x23, 0xC4, 0x25, 0xBC, 0x12, 0xFE, 0x35, 0x84, 0x91, 0x53,
+    0xB5, 0x9F, 0xA4, 0xE6, 0x26, 0x7C, 0xBB, 0xEB, 0xB0, 0x46, 0xA6, 0x70, 0xC9, 0xDA, 0xC4, 0xC6,
+    0xC2, 0x14, 0x21, 0xAB, 0x23, 0xE3, 0xE0, 0x51, 0x3D, 0x84, 0x96, 0xDF, 0x28, 0xB0, 0x51, 0xA7,
+    0xFE, 0x72, 0xDD, 0x9A, 0x85, 0xBE, 0x74, 0xF7, 0xEC, 0xE8, 0x3C, 0x19, 0xF5, 0x7D, 0xEB, 0xF2,
+    0xC0, 0xCA, 0x18, 0xF3, 0x75, 0x9C, 0xB1, 0xBE, 0x6D, 0x68, 0x52, 0xC7, 0xE6, 0xC4, 0x54, 0xE9,
+    0xA9, 0xCE, 0x53, 0x95, 0x7B, 0xFB, 0x0A, 0xBB, 0xF9, 0x3E, 0xCD, 0xC5, 0xD2, 0xDF, 0x69, 0xA4,
+    0xEE, 0xC9, 0x57, 0xFC, 0x17, 0x21, 0x76, 0x80, 0x3B, 0x0A, 0x31, 0x2B, 0xF3, 0x18, 0xFE, 0x3B,
+    0x10, 0xD7, 0xF4, 0x13, 0xBA, 0xBF, 0x94, 0xF8, 0x66, 0x19, 0xED, 0x2C, 0xD9, 0x60, 0xFD, 0x15,
+    0x28, 0xCC, 0x2B, 0xF2, 0xC5, 0x93, 0x2C, 0xE7, 0x0E, 0x53, 0x49, 0xB1, 0x02, 0x07, 0x76, 0x25,
+    0xB4, 0x6F, 0xAC, 0x9C, 0x26, 0x48, 0xFF, 0x53, 0xD2, 0x8B, 0x7E, 0x4E, 0xAD, 0xBD, 0x09, 0xB4,
+    0x6D, 0xBB, 0xBB, 0x3B, 0x1C, 0xFE, 0xF1, 0x25, 0x8F, 0xFA, 0xED, 0x3C, 0x6B, 0xA5, 0xA6, 0xBA,
+    0xBC, 0x60, 0x63, 0x3D, 0x7D, 0xC6, 0x26, 0x56, 0xAC, 0x98, 0x59, 0xF2, 0x1E, 0xB9, 0xF9, 0x1A,
+    0x67, 0xB3, 0x3C, 0x28, 0x07, 0xE2, 0x86, 0x7F, 0x5C, 0xE3, 0xCE, 0x12, 0xE4, 0x1B, 0xA0, 0x81,
+    0xD0, 0xFB, 0x48, 0xB9, 0xDF, 0x45, 0x88, 0x9E, 0x29, 0x44, 0x1E, 0x1C, 0x62, 0x59, 0xD9, 0x51,
+    0x42, 0x77, 0xA9, 0xF6, 0x80, 0x86, 0x6E, 0xF6, 0x2E, 0x0B, 0xA8, 0x39, 0xF9, 0x50, 0x0D, 0xD5,
+    0x83, 0x1A, 0x36, 0x56, 0xC3, 0x66, 0x46, 0x86, 0xC1, 0x6B, 0xA6, 0x1A, 0xB2, 0xC4, 0x31, 0x35,
+    0x64, 0xEB, 0x5F, 0xDB, 0x5E, 0x9F, 0x2A, 0xB7, 0x7E, 0xBF, 0x72, 0x09, 0x95, 0x53, 0xE2, 0x0B,
+    0xBD, 0xA0, 0xFB, 0xAB, 0x89, 0xD7, 0x2C, 0xE3, 0xEA, 0xF4, 0x23, 0x48, 0x62, 0x1F, 0x18, 0x12,
+    0xFB, 0xF6, 0x0A, 0x89, 0x45, 0x96, 0x98, 0x66, 0x70, 0x5D, 0xF5, 0x1F, 0x82, 0xFB, 0x10, 0x62,
+    0xB6, 0x85, 0xB5, 0xF8, 0xC9, 0x94, 0xC3, 0xAF, 0xBC, 0xE7, 0x6E, 0x44, 0x4B, 0x11, 0x8E, 0xDF,
+    0xCE, 0x21, 0x3E, 0x26, 0x59, 0x86, 0x7E, 0xBB, 0x04, 0xBF, 0x17, 0x90, 0xFC, 0x66, 0x26, 0xF2,
+    0x79, 0xB7, 0x0C, 0xB5, 0x54, 0x31, 0xFE, 0xD7, 0xF6, 0x17, 0xAD, 0x55, 0x3D, 0x8C, 0xDC, 0x44,
+    0x14, 0xFE, 0xEC, 0x51, 0xCE, 0x44, 0x86, 0xCC, 0x35, 0x11, 0x3F, 0x27, 0xCE, 0x0D, 0x15, 0xBA,
+    0x5B, 0x53, 0xA6, 0x58, 0xEF, 0x5A, 0x88, 0x2E, 0x45, 0x84, 0x74, 0x0B, 0x05, 0x42, 0xA1, 0xA5,
+    0x4A, 0xCA, 0x2D, 0x36, 0x5A, 0x47, 0x11, 0x2D, 0x39, 0x89, 0x82, 0x0A, 0x29, 0x25, 0x3A, 0x40,
+    0x44, 0x28, 0x48, 0x8B, 0xB4, 0x97, 0x35, 0x4A, 0x41, 0x71, 0x8D, 0x01, 0x51, 0xD1, 0x58, 0x10,
+    0x40, 0x22, 0x45, 0x06, 0xE1, 0x23, 0x06, 0xBC, 0x1E, 0xBE, 0x37, 0xDE, 0x25, 0x47, 0x0A, 0x44,
+    0x81, 0x75, 0x37, 0x6B, 0xBF, 0xF9, 0x79, 0xDF, 0xF7, 0xDE, 0xF7, 0xDE, 0x60, 0xB4, 0xE7, 0x8D,
+    0x52, 0x6D, 0xD3, 0xE9, 0x12, 0x51, 0x86, 0x43, 0x78, 0x06, 0x61, 0x8E, 0x18, 0xA8, 0xE1, 0x97,
+    0xD0, 0x29, 0x12, 0xC0, 0x40, 0x15, 0x88, 0x80, 0xA9, 0xB5, 0x9C, 0xB5, 0xB6, 0x95, 0x59, 0x9A,
+    0x38, 0x3B, 0x91, 0x59, 0x6E, 0xE0, 0xEC, 0x0C, 0xBE, 0x11, 0xD3, 0x00, 0xA8, 0xB0, 0x55, 0x63,
+    0x7A, 0x37, 0xB0, 0x45, 0x6C, 0x33, 0x40, 0x0C, 0x7C, 0xB4, 0x0C, 0x5E, 0x29, 0xE3, 0xB3, 0xEE,
+    0x35, 0x87, 0x7B, 0xE2, 0x3C, 0x38, 0xDF, 0xA0, 0x0A, 0x72, 0xCD, 0x33, 0x8C, 0x4E, 0x23, 0x1C,
+    0xBF, 0x52, 0x6A, 0xBB, 0xF4, 0x8E, 0x5F, 0xCD, 0x7B, 0x98, 0xA8, 0x22, 0x7C, 0xAB, 0x8F, 0x4F,
+    0x7F, 0xCA, 0x75, 0x33, 0xC3, 0x21, 0xF7, 0xEC, 0x00, 0x7E, 0x01, 0xF4, 0x81, 0x90, 0x87, 0xEF,
+    0x43, 0x28, 0x8C, 0x30, 0x5C, 0x7A, 0xD6, 0x96, 0x5E, 0x8D, 0xF0, 0xE7, 0x8A, 0xB0, 0x7C, 0xB3,
+    0xEB, 0x58, 0x84, 0xB2, 0x28, 0xF1, 0x53, 0x81, 0xEB, 0x80, 0x04, 0xF9, 0x8A, 0x08, 0x62, 0x6B,
+    0x6B, 0xA2, 0xCA, 0x84, 0x62, 0x47, 0xB0, 0xE3, 0x22, 0xBB, 0x89, 0x32, 0x76, 0xB0, 0xBB, 0x69,
+    0xA1, 0xB3, 0x8F, 0xC8, 0xA6, 0x8B, 0xC6, 0xE1, 0x6D, 0x2F, 0x19, 0x65, 0xCD, 0x04, 0xA6, 0xDF,
+    0x43, 0x3F, 0x21, 0xE4, 0xD3, 0xEA, 0x9B, 0xD7, 0x32, 0x58, 0x5B, 0xE0, 0xCA, 0xC8, 0x80, 0xA8,
+    0x19, 0x89, 0x1E, 0x54, 0x1E, 0xBE, 0xE7, 0x19, 0xD5, 0x92, 0xD7, 0xED, 0x8E, 0x2B, 0x46, 0x7C,
+    0x78, 0xAA, 0x75, 0x08, 0xA2, 0x83, 0x0F, 0x38, 0x32, 0xE4, 0x89, 0x84, 0x81, 0xCB, 0x21, 0x9E,
+    0x19, 0x53, 0x1A, 0x04, 0x08, 0x0D, 0x44, 0x28, 0x87, 0x5D, 0x5C, 0x8A, 0xC1, 0xDA, 0x8A, 0x86,
+    0x28, 0x8B, 0x72, 0x9D, 0x72, 0xE1, 0x9C, 0x78, 0x07, 0x08, 0x8A, 0x48, 0xE0, 0x27, 0x8C, 0xFE,
+    0x84, 0xEC, 0x06, 0xB2, 0x70, 0xB2, 0x55, 0xFB, 0x6D, 0x1A, 0x7E, 0x61, 0x73, 0x52, 0xAC, 0x9D,
+    0xE3, 0xC8, 0x8D, 0x5C, 0x48, 0x1F, 0x57, 0x9D, 0x69, 0xD8, 0xCA, 0xE8, 0xB7, 0x38, 0xF9, 0x5C,
+    0xCA, 0x88, 0x74, 0x71, 0xC7, 0x02, 0xC1, 0xF5, 0x0B, 0x29, 0xC2, 0x39, 0xA3, 0xA6, 0x0D, 0x37,
+    0xEB, 0x22, 0x5E, 0x14, 0x3A, 0x8B, 0x6D, 0x15, 0x61, 0xE0, 0x35, 0xE4, 0x8D, 0x79, 0x42, 0x8F,
+    0x93, 0x3E, 0xD9, 0x4D, 0x26, 0x8C, 0xD5, 0x84, 0xD9, 0x73, 0xE0, 0x69, 0x70, 0xB1, 0x74, 0x6C,
+    0xF0, 0x84, 0x30, 0x89, 0xC4, 0x4B, 0xC8, 0x2F, 0xEF, 0x7D, 0xBE, 0x2C, 0x6E, 0xD0, 0x52, 0x6C,
+    0x15, 0x5E, 0xED, 0xFF, 0x59, 0xEA, 0x6C, 0x10, 0x14, 0x73, 0xCF, 0xE8, 0x6B, 0x85, 0x4E, 0x07,
+    0x11, 0x4F, 0xA8, 0x1B, 0xDF, 0xA8, 0xEF, 0xCB, 0x30, 0xD7, 0x17, 0xB2, 0x01, 0xE6, 0xFC, 0x53,
+    0x25, 0x4D, 0x91, 0x6F, 0x82, 0xBC, 0x52, 0xA5, 0xBE, 0x9E, 0x85, 0xA5, 0x66, 0xA2, 0xFF, 0x58,
+    0x14, 0x6F, 0x04, 0xF6, 0x9E, 0x4D, 0x79, 0x64, 0xEA, 0xD0, 0x7B, 0x74, 0x33, 0x08, 0x2A, 0x55,
+    0x7C, 0x56, 0xF5, 0x82, 0xAB, 0xA5, 0x49, 0x82, 0xA3, 0xCC, 0x44, 0x49, 0x90, 0xCF, 0xAA, 0x48,
+    0xDD, 0x29, 0x26, 0xDB, 0x3A, 0x33, 0x3C, 0xE7, 0x7E, 0x3A, 0x7C, 0xB7, 0xDA, 0x8C, 0xDB, 0x4E,
+    0x9C, 0xF0, 0xDE, 0x14, 0x49, 0x14, 0xFA, 0x87, 0x45, 0xD6, 0x60, 0x57, 0xE7, 0xB8, 0x49, 0x05,
+    0x5C, 0x2B, 0xBB, 0x98, 0xCD, 0x19, 0xB4, 0xD2, 0xE9, 0x40, 0x94, 0x0D, 0xE6, 0x9F, 0x81, 0x46,
+    0x50, 0xE2, 0x71, 0x5D, 0x6D, 0x18, 0x26, 0x92, 0x15, 0x51, 0x38, 0xB6, 0x92, 0xBE, 0x33, 0xDC,
+    0xC4, 0xD7, 0x69, 0xBA, 0x8E, 0x67, 0xD0, 0xF8, 0xB6, 0x98, 0x3D, 0xB5, 0x2D, 0xB3, 0x13, 0xD1,
+    0x62, 0x25, 0x35, 0x52, 0xE3, 0x7C, 0x3E, 0x9E, 0x5A, 0x9F, 0xD0, 0x4B, 0xEE, 0xD9, 0x2C, 0x55,
+    0x83, 0x67, 0x80, 0xB3, 0xA3, 0xD1, 0xCB, 0x54, 0xC6, 0xBD, 0x83, 0xF6, 0x63, 0xCA, 0x7E, 0x87,
+    0x61, 0xFF, 0x24, 0x9D, 0xFB, 0x92, 0x6A, 0xD9, 0x24, 0x8A, 0xA7, 0x56, 0x9C, 0x32, 0x06, 0x5D,
+    0x51, 0x89, 0xCB, 0x15, 0xC8, 0xAD, 0x16, 0x9E, 0x5D, 0x76, 0x2B, 0x44, 0xE3, 0xBB, 0x34, 0xDF,
+    0x24, 0xD8, 0xEC, 0x61, 0x6E, 0xB7, 0xCA, 0x38, 0xBD, 0x1D, 0x36, 0x43, 0x63, 0xF3, 0xED, 0x64,
+    0x72, 0x6C, 0xC2, 0xF9, 0xB6, 0xE9, 0xAB, 0x26, 0xA4, 0x9F, 0xA5, 0xAA, 0x42, 0xC6, 0xBA, 0x51,
+    0x14, 0xD3, 0x15, 0x98, 0x30, 0x8B, 0x30, 0x66, 0xE1, 0xA5, 0xBB, 0xCF, 0x19, 0x95, 0xEB, 0xD7,
+    0xA9, 0x74, 0x65, 0x7B, 0x18, 0xA3, 0xCD, 0xD7, 0xA9, 0x15, 0x34, 0xAB, 0x9A, 0x16, 0x6C, 0xD8,
+    0x48, 0xCF, 0xB2, 0x0E, 0x23, 0xFB, 0xA2, 0xFD, 0x52, 0x5A, 0x49, 0x4C, 0xAE, 0xAA, 0x20, 0x90,
+    0x39, 0x31, 0x46, 0x94, 0x9D, 0xFA, 0x8E, 0x2C, 0xE6, 0x46, 0xD4, 0x44, 0x54, 0x55, 0x07, 0xDA,
+    0xF1, 0x90, 0xED, 0x42, 0x44, 0x90, 0xFB, 0x6D, 0x06, 0x65, 0xDD, 0xF9, 0x08, 0x0B, 0x7D, 0x24,
+    0x69, 0x97, 0x16, 0xC0, 0xD6, 0x10, 0x64, 0x3D, 0x39, 0xD0, 0xC0, 0x54, 0xE8, 0x8F, 0xA1, 0xFB,
+    0x60, 0xD0, 0x24, 0x1F, 0x89, 0x83, 0x41, 0x57, 0xD2, 0x5B, 0x6E, 0x31, 0x0A, 0x19, 0x0E, 0x6E,
+    0xE0, 0x3F, 0xA0, 0x39, 0x5C, 0xA1, 0x79, 0xF2, 0xF7, 0x94, 0xCD, 0xC0, 0xFC, 0x0F, 0x68, 0x96,
+    0x08, 0x58, 0xA2, 0x17, 0xF7, 0x04, 0x8D, 0x7F, 0x12, 0x0D, 0xE1, 0x9C, 0xDA, 0x83, 0xAD, 0xE3,
+    0x25, 0xE2, 0x8C, 0xE2, 0xD1, 0x39, 0x05, 0x15, 0x14, 0x3D, 0x11, 0x97, 0x54, 0xCB, 0x2F, 0xE2,
+    0x64, 0x21, 0xC1, 0x1D, 0x8A, 0xB3, 0xA9, 0xA8, 0x52, 0x74, 0xAD, 0x8E, 0x68, 0xD3, 0x52, 0xB5,
+    0x52, 0xDF, 0x4C, 0x79, 0x05, 0x57, 0xF8, 0xD1, 0x5D, 0xCF, 0xEE, 0xDB, 0x26, 0xB4, 0xE5, 0xBA,
+    0xA8, 0x25, 0xE7, 0x08, 0x24, 0xDB, 0x21, 0xD6, 0x43, 0xF7, 0x78, 0x33, 0x34, 0x61, 0x43, 0x78,
+    0x03, 0xFD, 0x12, 0x22, 0xEA, 0x42, 0xD3, 0x63, 0x68, 0xBA, 0x7D, 0x52, 0x93, 0xDB, 0x7C, 0x1F,
+    0x57, 0x2F, 0x6C, 0x9A, 0x43, 0x33, 0xCC, 0x87, 0x66, 0x98, 0xF6, 0x6E, 0xAE, 0x92, 0xBC, 0xFA,
+    0x0F, 0xB8, 0x70, 0x03, 0xA7, 0x46, 0x23, 0x6F, 0x14, 0x58, 0xFB, 0xB5, 0xFD, 0xEA, 0xC7, 0xDF,
+    0x4C, 0x94, 0x9A, 0x59, 0x3F, 0xC8, 0xCF, 0x25, 0xDA, 0x2F, 0x4F, 0x6B, 0xC5, 0x9A, 0x27, 0x82,
+    0x44, 0xC2, 0xA6, 0xB1, 0xFE, 0x90, 0x1B, 0x64, 0xD5, 0x73, 0xD7, 0x1F, 0x8F, 0xCC, 0x44, 0x94,
+    0xFB, 0xFE, 0x90, 0x43, 0x03, 0xD7, 0xF5, 0xD6, 0x92, 0x92, 0x0C, 0xC0, 0x13, 0x5E, 0xB8, 0xBC,
+    0xA2, 0xF1, 0xFC, 0x01, 0x83, 0x6B, 0x1E, 0xD2, 0xF2, 0x1B, 0x8C, 0x17, 0x6C, 0x84, 0x7D, 0xB0,
+    0x2D, 0x44, 0x98, 0x79, 0xA5, 0x4E, 0x13, 0xEA, 0x94, 0x77, 0xC6, 0x9C, 0x32, 0xCE, 0x12, 0x35,
+    0x7B, 0xA7, 0x78, 0xF0, 0xD1, 0xB0, 0x99, 0x7E, 0xDE, 0xAA, 0x0F, 0xBB, 0x23, 0xFB, 0xDD, 0x0F,
+    0xD5, 0xF7, 0xB4, 0x64, 0x84, 0x02, 0x51, 0xB6, 0x38, 0x44, 0x9C, 0x52, 0x20, 0xCC, 0x88, 0x2A,
+    0x19, 0x92, 0x8A, 0x8C, 0xFB, 0x84, 0x12, 0xB1, 0xE6, 0xC3, 0xDC, 0xE7, 0xA5, 0x82, 0xB8, 0xAD,
+    0x5C, 0x1B, 0x76, 0x97, 0x82, 0xBB, 0x75, 0x5C, 0xC8, 0x2B, 0x49, 0xD2, 0x3E, 0x15, 0x52, 0xAF,
+    0xB0, 0xEB, 0x55, 0x0A, 0x1C, 0xF0, 0xCB, 0xAB, 0x7E, 0x1A, 0xEA, 0xDA, 0x63, 0x41, 0xF5, 0x70,
+    0x4B, 0x84, 0x43, 0xB4, 0xCC, 0xFD, 0xB7, 0xBC, 0x4F, 0xEE, 0xA7, 0x2E, 0xB6, 0xFA, 0x31, 0x78,
+    0xBF, 0xF2, 0xC6, 0xAD, 0xE1, 0x3D, 0xA0, 0xE5, 0x5C, 0x77, 0xC2, 0xD8, 0xD5, 0xB5, 0x9F, 0xFD,
+    0x0B, 0xC8, 0xCB, 0x04, 0xB9, 0x43, 0x90, 0x6F, 0x9F, 0x04, 0xC9, 0xCE, 0x85, 0x1D, 0x82, 0x3C,
+    0xF3, 0x0F, 0x90, 0x6D, 0xFA, 0xB7, 0x8C, 0x1F, 0x79, 0xFE, 0x02, 0xAD, 0x55, 0x3D, 0x8C, 0xDC,
+    0x44, 0x18, 0x7D, 0xF6, 0x24, 0x31, 0x3A, 0x87, 0x4C, 0x8A, 0xA4, 0xBA, 0x1F, 0x57, 0x74, 0xD9,
+    0x75, 0x13, 0x44, 0x0A, 0x6F, 0x6C, 0x38, 0x10, 0x48, 0x91, 0x10, 0xC5, 0x2D, 0x14, 0x29, 0x68,
+    0x91, 0x28, 0x92, 0x22, 0x12, 0x57, 0xEC, 0xB1, 0x56, 0x1A, 0x44, 0x45, 0x0A, 0x5A, 0x24, 0x0A,
+    0x0A, 0x44, 0x95, 0xE2, 0x40, 0x8B, 0xB8, 0xCB, 0x4E, 0xB8, 0x8E, 0xCA, 0xE2, 0x94, 0x2A, 0x12,
+    0xF1, 0x49, 0x48, 0x20, 0x4E, 0x22, 0x23, 0xC5, 0x27, 0xF9, 0x92, 0xDD, 0x1D, 0xDE, 0x67, 0xEF,
+    0xE5, 0xAE, 0x02, 0x81, 0xB0, 0x34, 0xB6, 0x77, 0x77, 0xE6, 0xFB, 0xDE, 0xF7, 0xDE, 0xFB, 0xBE,
+    0xBD, 0x91, 0x87, 0x69, 0x19, 0x98, 0x91, 0x5F, 0x76, 0x50, 0xE9, 0x53, 0x89, 0xFA, 0x29, 0x85,
+    0x73, 0x79, 0xF4, 0xAC, 0xC0, 0x4D, 0x8B, 0xA5, 0xE4, 0xBC, 0x17, 0x25, 0x08, 0x27, 0xF0, 0x26,
+    0x90, 0xAB, 0xBF, 0x06, 0xB8, 0x1A, 0x88, 0x72, 0x2E, 0x7E, 0x8E, 0xB9, 0xBA, 0x5C, 0x3D, 0x59,
+    0xE3, 0x02, 0x43, 0xFE, 0x78, 0x0F, 0x13, 0xD4, 0xD8, 0x42, 0x85, 0x01, 0x2C, 0x46, 0x9E, 0x45,
+    0xED, 0x5B, 0x54, 0xAA, 0x84, 0x5D, 0xAC, 0x83, 0xC3, 0xE1, 0x24, 0x9A, 0xE1, 0x3C, 0x8F, 0x5A,
+    0xE0, 0x43, 0xD3, 0x86, 0x19, 0x01, 0x8A, 0xAF, 0x9A, 0xAF, 0xEB, 0x51, 0xE1, 0xFF, 0xEC, 0x72,
+    0xDD, 0x8D, 0xD1, 0x2B, 0x46, 0xDE, 0x54, 0x15, 0xA1, 0xD5, 0xCC, 0x33, 0x60, 0x94, 0x52, 0x19,
+    0x9D, 0x45, 0x48, 0xCE, 0x8F, 0xF0, 0x64, 0xA7, 0x08, 0xA6, 0x1A, 0xDA, 0x34, 0xB0, 0xE0, 0x7D,
+    0x05, 0xF8, 0xAE, 0x82, 0x37, 0x7D, 0xBF, 0xC8, 0x37, 0x70, 0x75, 0x5D, 0x67, 0xEA, 0xD9, 0x6B,
+    0x25, 0xE2, 0x2A, 0x81, 0xDA, 0x7F, 0x68, 0xD0, 0x8B, 0x9D, 0x73, 0x26, 0xFE, 0xE3, 0x9B, 0xAF,
+    0x89, 0xA7, 0x4D, 0xDA, 0xBE, 0x64, 0xBC, 0x4D, 0x10, 0x64, 0xBA, 0x0C, 0x2C, 0x52, 0xA9, 0x6D,
+    0x5C, 0xE3, 0xF8, 0x0A, 0x6A, 0x9E, 0x2F, 0x60, 0xBB, 0x17, 0x12, 0xB5, 0xFB, 0x49, 0xBE, 0x75,
+    0xAB, 0x8A, 0x83, 0x47, 0xE3, 0x3C, 0x76, 0xB9, 0xD4, 0xCE, 0x10, 0x99, 0xCE, 0x46, 0x64, 0x0C,
+    0xCA, 0x65, 0x7F, 0x07, 0xC5, 0x12, 0x4A, 0xEF, 0xBF, 0x41, 0x91, 0xA5, 0xE5, 0x37, 0xD9, 0x74,
+    0x4E, 0x52, 0x14, 0x5C, 0xA7, 0xFE, 0x15, 0xC0, 0xF1, 0xAC, 0x01, 0x28, 0x24, 0x5F, 0x21, 0xD7,
+    0x8C, 0x76, 0x99, 0x8F, 0x46, 0x50, 0xE5, 0x4A, 0xAF, 0x46, 0x60, 0x64, 0xFB, 0x08, 0xAA, 0x90,
+    0x5C, 0x03, 0x50, 0x31, 0x9D, 0x8B, 0xAC, 0x76, 0xFE, 0x53, 0x8D, 0xC5, 0xDA, 0x63, 0x59, 0xC7,
+    0xD7, 0x9D, 0x05, 0xB9, 0x87, 0xD9, 0x65, 0x79, 0xC4, 0x41, 0xA3, 0x44, 0xDA, 0x72, 0x77, 0xF1,
+    0x78, 0xD7, 0x02, 0x4E, 0xAF, 0xE1, 0x03, 0xB8, 0xCC, 0x59, 0x6D, 0x7D, 0x87, 0x0D, 0x38, 0x83,
+    0x0E, 0x2C, 0xA3, 0x23, 0x09, 0xCC, 0x26, 0xB7, 0xDC, 0xED, 0x06, 0xFC, 0x80, 0x92, 0x5A, 0x91,
+    0xBA, 0x9D, 0x1D, 0x89, 0xA4, 0x1F, 0x6F, 0xCB, 0xE9, 0xD9, 0x4C, 0x02, 0x86, 0x3F, 0xEE, 0x49,
+    0xED, 0x1B, 0x7A, 0xB5, 0x64, 0xC1, 0x65, 0x22, 0xB9, 0x52, 0x4F, 0x42, 0x28, 0x1B, 0xE6, 0x04,
+    0x97, 0x66, 0x1D, 0xA4, 0x08, 0x2A, 0x7F, 0x4A, 0xF7, 0x0D, 0xB3, 0x74, 0xC2, 0xC7, 0x89, 0x4B,
+    0xC8, 0xBB, 0x73, 0x56, 0x2C, 0xEA, 0xF3, 0xA4, 0x7F, 0x20, 0x55, 0xE8, 0xE9, 0xC9, 0x1D, 0x88,
+    0xCC, 0x12, 0xEE, 0x05, 0x4E, 0x99, 0xD4, 0x96, 0x76, 0xA0, 0xDF, 0x78, 0x21, 0xD4, 0xB7, 0xB9,
+    0xF7, 0xBB, 0x8A, 0xD6, 0x0C, 0x7F, 0x10, 0x8D, 0xB6, 0x9E, 0x30, 0xB9, 0x7E, 0xFB, 0x17, 0x92,
+    0xBA, 0x77, 0xC8, 0xD7, 0x2B, 0xF1, 0x0A, 0x5E, 0xD7, 0xAA, 0xB0, 0xEB, 0xCE, 0x24, 0xDA, 0x85,
+    0x36, 0xC8, 0x86, 0xF9, 0x3C, 0x5A, 0xFF, 0x1D, 0xEF, 0x4B, 0xE5, 0x8A, 0xB8, 0xF0, 0x6A, 0xE5,
+    0x48, 0x20, 0x5B, 0x24, 0x26, 0xA3, 0x18, 0x31, 0x10, 0x4F, 0x30, 0xCE, 0x35, 0x62, 0x1A, 0x52,
+    0x11, 0xFF, 0x29, 0xE9, 0xD0, 0x79, 0x2C, 0x5C, 0xA7, 0xC2, 0xF6, 0x86, 0xF0, 0x5D, 0x91, 0x71,
+    0x2A, 0x51, 0x53, 0x8B, 0xC5, 0x43, 0x0C, 0x3C, 0x27, 0x1D, 0x34, 0x77, 0xC1, 0x16, 0x70, 0x36,
+    0x24, 0xB4, 0xB1, 0x74, 0xE4, 0x91, 0xE9, 0x78, 0xDD, 0xC8, 0xBB, 0x63, 0xE3, 0x82, 0xDB, 0x0F,
+    0xC2, 0x37, 0x33, 0xCD, 0xCE, 0x58, 0x86, 0x1E, 0xE7, 0xD1, 0x63, 0xDB, 0x41, 0x9D, 0x60, 0x2B,
+    0xC1, 0x60, 0x80, 0x64, 0x93, 0xCA, 0x4A, 0xB3, 0xD1, 0x9D, 0xF6, 0xC5, 0xD0, 0x44, 0x0E, 0xE1,
+    0xAF, 0x02, 0xB7, 0xDF, 0xA7, 0x65, 0xDD, 0x0C, 0xF8, 0xF8, 0x7A, 0xD9, 0xC8, 0xC2, 0x9B, 0xE4,
+    0x58, 0x17, 0x95, 0xEE, 0x4A, 0x5A, 0xF6, 0x20, 0xBC, 0x92, 0xF0, 0x7D, 0x13, 0x4B, 0xB3, 0x5E,
+    0x15, 0xE5, 0x7B, 0xD2, 0xB2, 0x14, 0xAD, 0x23, 0x61, 0x07, 0x44, 0xF6, 0x72, 0x45, 0xCC, 0x69,
+    0x79, 0x66, 0x46, 0x45, 0xA2, 0x06, 0x9B, 0x0C, 0x88, 0x66, 0x3A, 0x48, 0x5A, 0x46, 0xE0, 0x4D,
+    0xE5, 0x27, 0x89, 0x8F, 0x29, 0x86, 0xB3, 0x50, 0xF7, 0x69, 0x34, 0x36, 0x6C, 0xC8, 0xB2, 0xCF,
+    0xD1, 0xA6, 0xCB, 0x5C, 0x82, 0xE3, 0x4A, 0x98, 0x63, 0x53, 0xBF, 0xF5, 0x92, 0xD5, 0x9D, 0xB4,
+    0xD0, 0x93, 0x34, 0xD3, 0xAC, 0x1F, 0xB7, 0xDA, 0x6E, 0xF0, 0x8A, 0x36, 0x9A, 0x27, 0x3E, 0xF6,
+    0xFA, 0x99, 0x76, 0xD9, 0x70, 0x2A, 0xB3, 0x69, 0x5B, 0x8C, 0x1F, 0xCE, 0x7D, 0xEB, 0x97, 0x42,
+    0x5C, 0x63, 0x65, 0x06, 0x8F, 0x84, 0x77, 0x26, 0x0C, 0x9B, 0x7A, 0xEB, 0xE7, 0x86, 0x47, 0x73,
+    0x20, 0x12, 0x9C, 0xAD, 0xF7, 0xAF, 0x0A, 0x4D, 0x8B, 0x35, 0xBF, 0x0A, 0x5C, 0xD1, 0xD0, 0xDF,
+    0xD6, 0xD1, 0x18, 0xBD, 0x10, 0x0B, 0xC5, 0x33, 0x9C, 0x94, 0x20, 0x36, 0xC1, 0x0D, 0xAB, 0x0A,
+    0x0E, 0xBD, 0x2E, 0x12, 0xCE, 0x29, 0xF5, 0xE0, 0x7A, 0xEE, 0x5C, 0xB1, 0xD1, 0x6F, 0x3F, 0xAF,
+    0x28, 0x13, 0xBE, 0x6A, 0x95, 0x19, 0x09, 0xF2, 0x75, 0x21, 0x8D, 0xE4, 0xA9, 0x47, 0x99, 0xF4,
+    0x83, 0xB4, 0xFE, 0xFF, 0x5D, 0x41, 0xF6, 0xBC, 0x82, 0x61, 0xC9, 0x0A, 0x62, 0x27, 0x18, 0x95,
+    0x08, 0x20, 0x7B, 0xE7, 0x66, 0xF2, 0x65, 0x94, 0xE0, 0xF2, 0x71, 0x05, 0xD7, 0x26, 0xA8, 0x02,
+    0xA3, 0x19, 0xC3, 0xCA, 0xA8, 0x3D, 0x78, 0xB7, 0xD4, 0x6E, 0xEA, 0x1D, 0xBC, 0x47, 0x0B, 0x0F,
+    0x38, 0x8A, 0x3F, 0x4D, 0xF0, 0xFD, 0x6F, 0x26, 0x9C, 0x8E, 0x30, 0x6C, 0x47, 0x49, 0x28, 0x8D,
+    0x0B, 0x5C, 0x12, 0x11, 0x2E, 0xAE, 0x9D, 0xEE, 0x47, 0x8E, 0xBE, 0xDF, 0x46, 0x9C, 0xC5, 0x04,
+    0xA3, 0x73, 0x55, 0x12, 0x5D, 0x45, 0x64, 0x09, 0xE1, 0x47, 0xA4, 0x35, 0x34, 0x34, 0x1A, 0xE7,
+    0xF2, 0xAC, 0x9A, 0xE3, 0x10, 0x83, 0x50, 0x63, 0xA9, 0x42, 0xE0, 0xC2, 0x9B, 0x65, 0x24, 0xDC,
+    0xB6, 0x23, 0x91, 0x34, 0x09, 0x4F, 0x4D, 0x16, 0x2F, 0x3F, 0xF2, 0xF9, 0xC9, 0x7F, 0x2C, 0x24,
+    0x6C, 0x59, 0x4C, 0xC7, 0xCD, 0x3F, 0x96, 0x30, 0x9B, 0x34, 0x13, 0x95, 0x11, 0xE3, 0x86, 0x34,
+    0x4E, 0x16, 0x71, 0xC9, 0x4D, 0xE0, 0x02, 0xCF, 0x72, 0x14, 0x79, 0x7D, 0x86, 0x87, 0x47, 0xD2,
+    0xE3, 0x42, 0xB4, 0xD3, 0x15, 0xC6, 0x06, 0xEA, 0x4F, 0xF4, 0x98, 0x73, 0x3F, 0xEF, 0xD0, 0x5E,
+    0xDF, 0x5A, 0xCD, 0x86, 0x4D, 0x06, 0x21, 0xA3, 0xAC, 0x68, 0x75, 0x9B, 0xAE, 0x5C, 0xDD, 0x35,
+    0x15, 0x5D, 0x7F, 0x58, 0x8A, 0x08, 0x5D, 0x52, 0x83, 0x51, 0x50, 0x11, 0x72, 0x8F, 0x03, 0x9B,
+    0x5C, 0xF3, 0x99, 0x30, 0xD5, 0x82, 0x98, 0x85, 0x35, 0x44, 0xBF, 0x6B, 0xB2, 0xDD, 0x32, 0x2E,
+    0x56, 0x3A, 0x72, 0x4D, 0x5B, 0xE4, 0x9C, 0x74, 0x14, 0x27, 0xDB, 0xE0, 0x0C, 0x8D, 0x96, 0xA7,
+    0x95, 0x37, 0x85, 0xE6, 0x9C, 0xC4, 0x2B, 0xE6, 0xA3, 0x1C, 0x0F, 0x57, 0xBF, 0x40, 0xB0, 0x7C,
+    0x69, 0x13, 0x97, 0xD6, 0x77, 0x0D, 0xCA, 0x7D, 0xDA, 0x65, 0x95, 0x33, 0x72, 0x49, 0xDF, 0xDF,
+    0xFB, 0xBC, 0xEC, 0x05, 0x9F, 0xB9, 0xCC, 0x46, 0x4F, 0x2B, 0x1F, 0xA9, 0x44, 0x92, 0xFF, 0xCE,
+    0xA6, 0x2F, 0x64, 0xC6, 0x63, 0xE9, 0x68, 0xEC, 0xFD, 0xD3, 0xF5, 0x17, 0xBD, 0x55, 0x31, 0x8F,
+    0x1B, 0x45, 0x14, 0xFE, 0x76, 0xE7, 0xEE, 0x96, 0x30, 0x70, 0x43, 0x91, 0x48, 0x51, 0x20, 0xDE,
+    0xD4, 0xD1, 0x71, 0x4B, 0x89, 0xC4, 0xDA, 0x3B, 0x51, 0x0A, 0x8A, 0x14, 0x49, 0x81, 0xA1, 0xB8,
+    0x86, 0x5F, 0x40, 0x52, 0x44, 0xE8, 0x90, 0x2E, 0xF1, 0x02, 0x05, 0x05, 0x45, 0x4E, 0x42, 0x94,
+    0x20, 0x8A, 0x54, 0x97, 0x22, 0x20, 0xA5, 0xB0, 0xC0, 0x77, 0x9E, 0x24, 0x45, 0xCA, 0x0C, 0xE1,
+    0x07, 0x64, 0x45, 0x44, 0x43, 0x84, 0x32, 0x11, 0x1B, 0xE1, 0xCB, 0xAD, 0x3D, 0x7C, 0x63, 0x3B,
+    0x77, 0x07, 0x35, 0x62, 0x64, 0x8F, 0xD7, 0x33, 0x6F, 0xE7, 0x7D, 0xEF, 0x7B, 0xDF, 0x7B, 0x03,
+    0x40, 0xF8, 0x6A, 0x69, 0x17, 0xC2, 0x20, 0x05, 0xFA, 0x10, 0x16, 0x4A, 0x23, 0x47, 0xE4, 0x20,
+    0x4B, 0x74, 0x80, 0xFA, 0x60, 0xAB, 0xE2, 0x56, 0xB4, 0xA3, 0x33, 0x8F, 0xF9, 0x38, 0x15, 0x6B,
+    0xBE, 0x70, 0x12, 0x50, 0x9F, 0x56, 0x40, 0x3A, 0xE1, 0xD2, 0xA2, 0x7E, 0xB1, 0x79, 0x9C, 0xDF,
+    0xD8, 0x71, 0x52, 0x96, 0x93, 0x2F, 0x81, 0xE4, 0x23, 0x3E, 0xE4, 0x1B, 0x40, 0x64, 0xB9, 0xAE,
+    0xE8, 0x0A, 0xB7, 0xE8, 0x4C, 0x98, 0x55, 0xA0, 0xD3, 0x1D, 0x20, 0xF2, 0xDE, 0x41, 0x75, 0xD7,
+    0x2C, 0x9D, 0x29, 0x4D, 0xB7, 0x1D, 0x70, 0xA7, 0x89, 0x77, 0x91, 0xEC, 0x16, 0x0D, 0x7C, 0x13,
+    0x8E, 0x3D, 0x82, 0x4D, 0x59, 0x5E, 0x8A, 0x9F, 0xF5, 0x91, 0xD5, 0x73, 0x4F, 0xD1, 0xCE, 0xC9,
+    0xD8, 0xFB, 0xA8, 0xCE, 0x4A, 0x27, 0xEC, 0x08, 0x2E, 0xC7, 0x46, 0x0B, 0xAB, 0x52, 0xA7, 0x67,
+    0xAD, 0x32, 0xB5, 0x74, 0x3D, 0x99, 0xEF, 0xF9, 0xF3, 0xCE, 0x0B, 0x37, 0xB3, 0x7F, 0x39, 0x36,
+    0x3C, 0x36, 0xA3, 0xE7, 0xAA, 0xC1, 0xA1, 0x11, 0x11, 0x23, 0xB2, 0xF0, 0x34, 0x0E, 0xB0, 0x47,
+    0x9C, 0x3E, 0x66, 0x5C, 0xE2, 0x1E, 0xCD, 0x4F, 0x2A, 0xFE, 0x73, 0x6D, 0x40, 0x6A, 0xBA, 0xCD,
+    0xE3, 0x0A, 0xE2, 0xB7, 0x35, 0x12, 0xE3, 0x49, 0xC6, 0xB3, 0xEE, 0x76, 0x20, 0xAB, 0x26, 0x6D,
+    0xA2, 0xE2, 0x8E, 0x32, 0xD9, 0x26, 0x7A, 0x5F, 0x79, 0xA3, 0xBC, 0xC1, 0xD1, 0x45, 0x64, 0xE7,
+    0xAC, 0xBC, 0xE3, 0xA0, 0x5F, 0x9B, 0xFB, 0x59, 0x1A, 0x5D, 0x96, 0xBE, 0x49, 0xEC, 0x8E, 0x30,
+    0xEA, 0x6C, 0x25, 0x8C, 0x8B, 0xDC, 0x3A, 0xFA, 0x6F, 0xE2, 0x8A, 0xD2, 0x85, 0xB0, 0xD9, 0xED,
+    0x66, 0xE5, 0xCF, 0x27, 0xE3, 0xE2, 0x6E, 0xA3, 0xCC, 0xCC, 0xBE, 0xDB, 0xED, 0x72, 0x1E, 0x7A,
+    0x9E, 0x06, 0x31, 0xD9, 0x72, 0x61, 0xC6, 0xDB, 0x64, 0xF7, 0xA1, 0x7E, 0x95, 0xA8, 0x1F, 0x4D,
+    0xCD, 0x9E, 0x4E, 0x83, 0x73, 0x83, 0x30, 0xDF, 0x2A, 0x6E, 0x70, 0x6D, 0x5D, 0x79, 0xA2, 0x6F,
+    0x7F, 0x10, 0xB6, 0x0B, 0x1F, 0xB6, 0xDB, 0xDD, 0x10, 0xD3, 0x2A, 0x79, 0x7D, 0x05, 0x2D, 0x52,
+    0xAC, 0xA0, 0x90, 0x98, 0xA4, 0x4C, 0xAB, 0xC4, 0x7B, 0x9B, 0x35, 0xCA, 0xFB, 0x39, 0x45, 0xF1,
+    0x58, 0x8E, 0x98, 0x8E, 0xC7, 0xF6, 0x4A, 0xEC, 0x56, 0x95, 0xCE, 0xC5, 0x83, 0x2A, 0x29, 0x07,
+    0x39, 0xEA, 0x82, 0xD6, 0xBD, 0xF2, 0x96, 0xF0, 0x5A, 0xE9, 0x21, 0xD5, 0xA1, 0x1C, 0xCE, 0x7F,
+    0x7E, 0x5F, 0xF7, 0x87, 0xCE, 0x4F, 0xC4, 0x88, 0xCB, 0x87, 0xF8, 0x3C, 0x4A, 0x42, 0x5B, 0xA8,
+    0x90, 0xDC, 0xE6, 0xA9, 0xE1, 0xE4, 0xB9, 0x38, 0xA2, 0x6E, 0xF7, 0x3D, 0x78, 0x32, 0x97, 0xFC,
+    0x7E, 0xC3, 0x50, 0x68, 0x15, 0x06, 0x78, 0x2B, 0xA4, 0x3A, 0x48, 0x2F, 0xC8, 0x0D, 0xD1, 0xF3,
+    0xAD, 0x10, 0xF0, 0x54, 0x80, 0x07, 0x8B, 0x0E, 0x97, 0x68, 0x99, 0x73, 0xB1, 0x85, 0x8B, 0xDE,
+    0xEB, 0xDE, 0x94, 0x11, 0x8E, 0xCD, 0x23, 0x71, 0xF5, 0x46, 0x90, 0xC4, 0xD0, 0xCE, 0x5D, 0x5F,
+    0x34, 0xF1, 0x63, 0x27, 0xCF, 0xB8, 0x56, 0xE4, 0x72, 0x61, 0xD7, 0x33, 0xFD, 0x23, 0xF5, 0xB3,
+    0xC9, 0x14, 0xF1, 0xA3, 0x9B, 0xC4, 0xF4, 0xBC, 0xCE, 0x46, 0xB3, 0x64, 0x5C, 0x47, 0xEC, 0xC7,
+    0x28, 0xDE, 0x6F, 0x62, 0x8B, 0x26, 0x42, 0x44, 0x1B, 0x2A, 0x1D, 0x8A, 0x62, 0x08, 0xDE, 0x47,
+    0x85, 0xF7, 0x8F, 0x08, 0x96, 0xF9, 0x1F, 0x6C, 0x40, 0x3C, 0x70, 0xC8, 0xA4, 0x89, 0xEA, 0x14,
+    0x99, 0x2E, 0x6E, 0xD4, 0xC8, 0xC6, 0x07, 0xF2, 0xF1, 0xBA, 0xF0, 0xB1, 0xED, 0x2C, 0x60, 0x23,
+    0x60, 0x1D, 0x9A, 0xEC, 0xA6, 0xB4, 0xFD, 0x81, 0xB8, 0x6B, 0x56, 0x55, 0xEC, 0x3A, 0x3D, 0xF4,
+    0xAA, 0xA9, 0x9D, 0xA4, 0xFC, 0xB6, 0x33, 0x2D, 0x66, 0xB9, 0x9A, 0x8E, 0x13, 0x9B, 0x90, 0xBE,
+    0xC6, 0x78, 0xCD, 0x49, 0xAE, 0x2F, 0x20, 0xB1, 0x87, 0x00, 0x04, 0x3C, 0x04, 0x70, 0xCD, 0xFB,
+    0x26, 0x47, 0xCC, 0x3C, 0xAB, 0x73, 0x06, 0x83, 0x8C, 0x46, 0x1B, 0xD8, 0xC6, 0xE4, 0xA6, 0xC5,
+    0x70, 0x5E, 0x09, 0x1F, 0x1E, 0x8F, 0x6A, 0x26, 0x6C, 0x70, 0x20, 0xB5, 0x9E, 0x15, 0x9E, 0x67,
+    0x8E, 0x02, 0x26, 0x7E, 0x64, 0x83, 0x9D, 0x01, 0x41, 0x65, 0x2C, 0x92, 0xB8, 0xCA, 0xA5, 0x21,
+    0xAA, 0x74, 0x34, 0xB7, 0x5D, 0x91, 0x61, 0x16, 0xF5, 0x76, 0xF8, 0x51, 0x77, 0x1C, 0xFE, 0x35,
+    0xBE, 0x43, 0x57, 0x2F, 0x95, 0xAA, 0x56, 0x1E, 0x1E, 0x99, 0x4B, 0xAC, 0x6A, 0x10, 0x5B, 0x35,
+    0x05, 0x68, 0x36, 0xA4, 0x0E, 0x91, 0x55, 0xEB, 0x34, 0x5C, 0x56, 0x67, 0x43, 0x5E, 0x56, 0xF2,
+    0x3C, 0xBC, 0x36, 0xD9, 0x0B, 0x49, 0x51, 0x4F, 0x9E, 0x84, 0xEA, 0x1A, 0xAC, 0xB2, 0x95, 0x10,
+    0x79, 0x1D, 0x22, 0xBB, 0xCA, 0xD7, 0xF8, 0xAE, 0x4B, 0xC3, 0x11, 0x05, 0xFA, 0xEC, 0x16, 0xA2,
+    0x8E, 0x2D, 0xCB, 0xB4, 0xA7, 0x33, 0x2B, 0xAB, 0xA4, 0x16, 0xDE, 0xC8, 0x6A, 0x1F, 0xC0, 0x62,
+    0xA4, 0x43, 0x4B, 0x09, 0xB4, 0x15, 0xD3, 0xDA, 0xD8, 0x0F, 0x73, 0xC6, 0x7F, 0x13, 0xD1, 0xBA,
+    0xC7, 0x84, 0xFB, 0x65, 0x95, 0x98, 0xFA, 0x42, 0xF9, 0xFD, 0x68, 0x85, 0xA0, 0x2E, 0x9E, 0xA3,
+    0xE7, 0x9F, 0x7E, 0x60, 0x3C, 0xF2, 0x7E, 0x70, 0x5B, 0xFF, 0xC1, 0x23, 0x5B, 0xE9, 0xB7, 0x74,
+    0xFD, 0xD9, 0xD3, 0x6A, 0x41, 0xBB, 0xB6, 0x4A, 0xAE, 0x35, 0xC2, 0x78, 0x37, 0xC4, 0xE5, 0xE4,
+    0x80, 0x0D, 0x9D, 0xBD, 0x5B, 0xC9, 0x7D, 0x1A, 0x16, 0xAF, 0x23, 0xF3, 0x56, 0x7D, 0x4D, 0x43,
+    0x75, 0xC6, 0x0A, 0x7B, 0x0A, 0x0E, 0x33, 0x52, 0x4F, 0x8C, 0x99, 0xBC, 0x12, 0x71, 0x1D, 0x82,
+    0x80, 0xBC, 0x03, 0xF1, 0xAB, 0x8D, 0xEA, 0x26, 0x6A, 0xD2, 0xBD, 0x26, 0xF2, 0xB3, 0xD4, 0x5C,
+    0x38, 0x1A, 0xD7, 0xDB, 0xFF, 0xC8, 0xCC, 0xB0, 0x4C, 0xF6, 0xDC, 0x32, 0xEA, 0x05, 0x9E, 0x13,
+    0x55, 0x58, 0x2B, 0x43, 0x8B, 0x4C, 0x2A, 0xC6, 0x77, 0x2A, 0x76, 0x24, 0x77, 0x72, 0xB3, 0x2C,
+    0x66, 0xDA, 0x3A, 0xC6, 0x6A, 0x19, 0x52, 0xA2, 0xCF, 0xB7, 0x1A, 0x38, 0x72, 0x64, 0xA5, 0x41,
+    0x19, 0xDA, 0xD4, 0x60, 0xD6, 0x60, 0x05, 0xCD, 0xA2, 0x21, 0xA9, 0x09, 0x9C, 0x24, 0xD3, 0xEF,
+    0x4B, 0x90, 0x26, 0xA7, 0x82, 0x0A, 0xF4, 0x90, 0x3D, 0x6E, 0x88, 0x6F, 0x5E, 0x18, 0x2C, 0x70,
+    0xC9, 0xAA, 0xC9, 0x71, 0x05, 0x8C, 0x21, 0x02, 0x1B, 0x5A, 0x68, 0xC3, 0xA4, 0x25, 0x0E, 0x1D,
+    0x9C, 0x60, 0x5F, 0x0F, 0xFA, 0x77, 0xB3, 0x83, 0x42, 0xCF, 0xDB, 0x88, 0xB8, 0xB5, 0xCC, 0x1B,
+    0xE0, 0x6A, 0x3C, 0x22, 0x0C, 0x8D, 0xD3, 0x9B, 0xFB, 0x8C, 0xC7, 0x3E, 0xB0, 0x95, 0xFE, 0xA3,
+    0xE8, 0xB1, 0xD8, 0xD5, 0xC7, 0x58, 0xDE, 0x75, 0xE2, 0x6D, 0x34, 0x82, 0xB4, 0xE1, 0xF2, 0x68,
+    0x02, 0xD0, 0xA2, 0x64, 0x8D, 0x2B, 0xDE, 0x27, 0x56, 0x3C, 0x64, 0x2F, 0x0A, 0x1D, 0x2B, 0x31,
+    0x39, 0x03, 0x19, 0xA4, 0xE1, 0x6A, 0xF9, 0xA2, 0x24, 0x98, 0x67, 0x15, 0xFD, 0xAA, 0x3E, 0x43,
+    0x8B, 0x26, 0xA1, 0xA7, 0xB2, 0x49, 0xD7, 0xF3, 0x8B, 0x87, 0x84, 0xED, 0xA2, 0x37, 0x8E, 0x43,
+    0x23, 0x39, 0xBD, 0x85, 0xC4, 0x1F, 0x12, 0x68, 0xDC, 0x60, 0x7D, 0x68, 0xD8, 0xA7, 0xE0, 0x12,
+    0x93, 0xA2, 0x1F, 0x55, 0x4A, 0xB7, 0xE1, 0xC2, 0xCD, 0x32, 0x10, 0x36, 0x2D, 0xDB, 0xA2, 0x2F,
+    0xEC, 0x5F, 0xDF, 0x14, 0x4D, 0xEF, 0xF6, 0x44, 0xCC, 0x05, 0xD5, 0x8A, 0xCB, 0x10, 0x69, 0xB8,
+    0x01, 0x3A, 0x2F, 0x3A, 0xED, 0xFF, 0x17, 0xC1, 0xF1, 0x25, 0x24, 0x3F, 0xD7, 0xA1, 0x8C, 0x23,
+    0xBC, 0xA0, 0x2F, 0x33, 0xC9, 0x97, 0x0D, 0x6A, 0x0A, 0x8C, 0xAC, 0x3B, 0x59, 0xB6, 0xF8, 0xCC,
+    0xFA, 0x62, 0xA5, 0x4A, 0xD3, 0x8E, 0x46, 0xC2, 0xBE, 0x53, 0xB6, 0xD5, 0x27, 0xBF, 0xF8, 0x7B,
+    0x4D, 0x5A, 0x75, 0xF0, 0x9F, 0x8C, 0xBF, 0x01, 0xB5, 0x55, 0x3D, 0x6F, 0x1C, 0x45, 0x18, 0x7E,
+    0x66, 0x27, 0xF6, 0x06, 0x46, 0x68, 0x28, 0x8C, 0x04, 0x04, 0x65, 0x53, 0x04, 0x89, 0x22, 0xBE,
+    0xA5, 0xA0, 0x48, 0x71, 0xE7, 0x5B, 0x89, 0xC2, 0x05, 0x05, 0x2E, 0xB8, 0x06, 0x7E, 0x01, 0x95,
+    0x29, 0x52, 0x50, 0x6C, 0x7C, 0x0B, 0xF7, 0x07, 0xFC, 0x13, 0xA8, 0x2F, 0x45, 0x22, 0x91, 0xC2,
+    0xC5, 0xD9, 0x37, 0xC6, 0x3F, 0x80, 0x89, 0x28, 0x11, 0xCA, 0x46, 0x88, 0x06, 0x0B, 0x18, 0xC4,
+    0x22, 0xD6, 0x66, 0x6F, 0x87, 0x67, 0xEE, 0x8C, 0x8F, 0x00, 0x41, 0x34, 0x37, 0xD2, 0xDC, 0xC7,
+    0xCE, 0xCC, 0xFB, 0x3E, 0x1F, 0xF3, 0xBE, 0x8B, 0xC8, 0x3C, 0x80, 0xAC, 0x0E, 0x81, 0x26, 0xC5,
+    0x72, 0xBC, 0x9A, 0x41, 0xF8, 0x16, 0xF2, 0xEC, 0x03, 0x27, 0x1D, 0xF6, 0x38, 0xF5, 0xB1, 0x83,
+    0xA8, 0x6A, 0xA0, 0x97, 0x03, 0x7A, 0x17, 0x90, 0x8F, 0x0B, 0x88, 0x5F, 0x4A, 0x60, 0xC2, 0x87,
+    0x5B, 0x5B, 0x40, 0xA2, 0x0D, 0xF4, 0x27, 0x15, 0x94, 0xE9, 0x67, 0x89, 0x91, 0xED, 0xD4, 0x20,
+    0x6D, 0xB3, 0x45, 0xBC, 0x8D, 0x35, 0xA4, 0xEF, 0x58, 0xF5, 0x85, 0x43, 0xF6, 0xE2, 0x45, 0x8A,
+    0xF5, 0x16, 0xCA, 0x97, 0xDA, 0xE4, 0xCA, 0xE8, 0xB7, 0xAD, 0x7C, 0xE2, 0x50, 0x1D, 0xA0, 0xD7,
+    0x83, 0xD6, 0x99, 0x1A, 0x95, 0xD2, 0x4C, 0x64, 0x99, 0x9C, 0x96, 0xC2, 0xDB, 0xC5, 0xF6, 0x0F,
+    0x81, 0xD8, 0xD7, 0xD0, 0xDF, 0xED, 0x1A, 0x6D, 0x44, 0xCD, 0x5C, 0x69, 0x6C, 0x10, 0x7F, 0x45,
+    0x00, 0xBF, 0x3A, 0xA2, 0x3A, 0x1A, 0x8F, 0xEF, 0x0F, 0xBD, 0xF7, 0x5F, 0x5E, 0xA0, 0xAA, 0x89,
+    0x2A, 0xEF, 0x13, 0x59, 0x6C, 0x91, 0x62, 0x86, 0x21, 0xF4, 0x79, 0x0B, 0x4C, 0xCF, 0x96, 0x24,
+    0x77, 0xCB, 0xA8, 0x6D, 0x94, 0xE9, 0x25, 0xE8, 0x74, 0x91, 0xE4, 0xE8, 0x4C, 0x7D, 0x5B, 0xA1,
+    0xE7, 0x90, 0x57, 0xC4, 0x12, 0xB9, 0xFE, 0xFD, 0x22, 0x99, 0xCD, 0x77, 0xFE, 0x5F, 0x91, 0xD4,
+    0xD3, 0x22, 0x8D, 0xC7, 0xF7, 0x1E, 0x13, 0x52, 0x80, 0x93, 0x3F, 0x4B, 0xA4, 0x62, 0x29, 0xD2,
+    0xCB, 0xEB, 0x48, 0xB6, 0xFF, 0x29, 0xD2, 0xEF, 0x8E, 0x18, 0x63, 0xA3, 0x46, 0x46, 0xFC, 0xEC,
+    0x70, 0x40, 0x90, 0x14, 0xE9, 0x5D, 0xC4, 0x27, 0x56, 0x5A, 0xA2, 0xD4, 0x4B, 0x91, 0xAE, 0x47,
+    0x05, 0x9A, 0x3E, 0x64, 0xD9, 0x5C, 0x62, 0x7C, 0x7F, 0x1F, 0xA9, 0x77, 0x38, 0x27, 0x44, 0x13,
+    0x97, 0xD7, 0x99, 0xF7, 0x4D, 0x24, 0xCC, 0xD7, 0xE3, 0x5A, 0x85, 0xF1, 0x3D, 0x2B, 0xBD, 0xE7,
+    0xCF, 0x09, 0xFD, 0x24, 0xCA, 0x24, 0xA2, 0x70, 0x9B, 0xD0, 0xA6, 0x11, 0x33, 0xE1, 0xA7, 0x46,
+    0xF8, 0x6A, 0x11, 0x66, 0x67, 0x23, 0x72, 0x13, 0xE9, 0x9A, 0x25, 0xB2, 0x69, 0x11, 0x7B, 0xA7,
+    0x51, 0x5F, 0x0D, 0x67, 0x73, 0x0C, 0x26, 0xF0, 0x0D, 0x76, 0x0E, 0x18, 0xF5, 0x86, 0x70, 0x0F,
+    0xA5, 0x3D, 0xDA, 0x2D, 0xD2, 0xD9, 0x52, 0xAB, 0xA9, 0x0F, 0xFE, 0x95, 0xCB, 0x07, 0x83, 0x9D,
+    0xB5, 0x41, 0xEA, 0x23, 0x5F, 0x0E, 0xB3, 0xB8, 0x8C, 0xA8, 0x39, 0x12, 0xE8, 0x0C, 0x95, 0x28,
+    0xA1, 0x8B, 0x2E, 0x11, 0xA9, 0x0C, 0xF1, 0x31, 0x0F, 0xF4, 0xF8, 0x27, 0x3A, 0x25, 0xE4, 0x24,
+    0x9C, 0x0E, 0xCC, 0xB8, 0x0D, 0xDC, 0x86, 0x37, 0x28, 0xB2, 0x0C, 0xE8, 0xFB, 0xC5, 0x9F, 0x51,
+    0xA3, 0xF1, 0x67, 0x7C, 0x54, 0xE1, 0xAF, 0x63, 0x0F, 0xB9, 0xF0, 0xD8, 0x62, 0xD8, 0x0E, 0xE9,
+    0x6F, 0x42, 0x9A, 0x2E, 0xA4, 0xED, 0x22, 0xB2, 0x77, 0x10, 0x95, 0x34, 0xEC, 0x89, 0x85, 0xF8,
+    0xD6, 0x00, 0xA7, 0x0C, 0xFB, 0x03, 0x27, 0xAD, 0x22, 0x20, 0xEE, 0x63, 0x4E, 0xE0, 0x75, 0xF2,
+    0xEB, 0x33, 0x5B, 0x27, 0xB8, 0x14, 0x17, 0x0F, 0x10, 0x24, 0x86, 0x1E, 0xB9, 0x55, 0x73, 0x41,
+    0x71, 0x83, 0xA6, 0xD4, 0x88, 0x1F, 0x55, 0x10, 0xC8, 0x56, 0xC2, 0x67, 0x3E, 0x84, 0x7D, 0x0D,
+    0x38, 0x52, 0xAC, 0x93, 0x13, 0x16, 0x98, 0x25, 0x2C, 0xFB, 0xCA, 0x4A, 0x89, 0x85, 0x71, 0xEB,
+    0x05, 0x5E, 0x1B, 0x16, 0x44, 0x3D, 0x41, 0xA8, 0x7D, 0xF9, 0xA9, 0x59, 0x09, 0x41, 0x15, 0x59,
+    0xA8, 0x47, 0x35, 0xD7, 0xEF, 0x5E, 0xC6, 0x5F, 0x1B, 0x88, 0xC1, 0xB6, 0x37, 0xBE, 0x4A, 0x33,
+    0x65, 0x95, 0x89, 0x1C, 0xAF, 0x7E, 0xCD, 0x6A, 0xE8, 0xA1, 0x0B, 0x4D, 0xE0, 0xB1, 0x91, 0x81,
+    0xEC, 0x94, 0xED, 0x46, 0x79, 0x16, 0x7D, 0x08, 0x4A, 0x20, 0x4C, 0x52, 0xCE, 0xAB, 0x66, 0x51,
+    0x3D, 0xC3, 0x7D, 0x84, 0x2B, 0x8F, 0x9B, 0xCF, 0xA1, 0xAF, 0x8D, 0x1E, 0x95, 0x97, 0xB5, 0xB1,
+    0x5E, 0xE3, 0xF3, 0x16, 0xB9, 0x2A, 0x3A, 0x91, 0xD5, 0x19, 0x0B, 0xAF, 0x2B, 0x9D, 0xFE, 0xBA,
+    0x16, 0x21, 0x96, 0x26, 0xCC, 0x63, 0x76, 0x28, 0x03, 0xB6, 0xC7, 0x64, 0xCE, 0x79, 0x30, 0x18,
+    0x80, 0x5D, 0x02, 0xC9, 0xF8, 0x88, 0x99, 0x3A, 0xEC, 0x56, 0x9B, 0xFC, 0xBC, 0x35, 0x4F, 0x12,
+    0x66, 0xBE, 0xA8, 0x4F, 0x42, 0x5C, 0x24, 0x27, 0x53, 0xE1, 0x2E, 0x18, 0x13, 0xD0, 0xB5, 0x73,
+    0x62, 0x09, 0x02, 0x87, 0xD6, 0xD4, 0xE1, 0xDC, 0xE4, 0xA4, 0x1D, 0x78, 0xEB, 0x92, 0x30, 0xBB,
+    0xC8, 0xB4, 0x95, 0x45, 0x7E, 0x85, 0xE7, 0x92, 0x2C, 0xAA, 0xA8, 0x30, 0xDD, 0xA6, 0xF0, 0xF6,
+    0x2A, 0xF1, 0xB1, 0xCD, 0x0D, 0xBF, 0x01, 0x6E, 0x07, 0xBB, 0xE2, 0x82, 0xE9, 0xA2, 0xE0, 0x54,
+    0x10, 0x3B, 0x48, 0xDB, 0x0F, 0x01, 0xEE, 0x26, 0xD9, 0x53, 0xE6, 0xE1, 0xA5, 0x01, 0xC4, 0x20,
+    0xD3, 0xBE, 0x88, 0xD8, 0x5C, 0xF6, 0xA8, 0x90, 0x0D, 0x22, 0x11, 0x4E, 0x90, 0xA9, 0x9A, 0x0B,
+    0x95, 0xCF, 0xD1, 0xA6, 0x73, 0x0E, 0xAA, 0x40, 0xE2, 0x0B, 0x49, 0x2B, 0x4E, 0x67, 0xC4, 0x2F,
+    0x43, 0xDB, 0xE7, 0xB2, 0x70, 0x69, 0x80, 0xDA, 0xD3, 0x5C, 0x46, 0x12, 0x96, 0x8D, 0x32, 0x61,
+    0x59, 0x71, 0x79, 0xDD, 0x4F, 0xED, 0x74, 0x3F, 0xF6, 0x6D, 0xE6, 0xEB, 0xCB, 0xBC, 0xFB, 0x37,
+    0x11, 0xD4, 0x9E, 0xD7, 0x05, 0xAE, 0x88, 0x25, 0xA0, 0x6B, 0x25, 0xE4, 0x88, 0xFD, 0xFD, 0xE3,
+    0xE0, 0x77, 0xB8, 0x9A, 0x15, 0x6F, 0x83, 0xC6, 0xB0, 0x15, 0x4E, 0x7D, 0x5F, 0x77, 0xE0, 0xD4,
+    0x89, 0xD5, 0xC8, 0xBB, 0xFC, 0x31, 0x3A, 0xD6, 0x70, 0x79, 0x79, 0x76, 0xA8, 0x1A, 0xE9, 0xB3,
+    0xBD, 0x8B, 0x9B, 0xFE, 0xDF, 0x26, 0xAC, 0x1D, 0xBE, 0x47, 0x06, 0xCD, 0xB3, 0x4D, 0x38, 0x0B,
+    0x26, 0x14, 0x8B, 0x3B, 0x28, 0xF9, 0x1D, 0x87, 0x77, 0x03, 0xF7, 0x34, 0xFF, 0x66, 0x02, 0x55,
+    0xDF, 0xAA, 0xF8, 0x46, 0x52, 0x3F, 0x62, 0xB2, 0x41, 0xDA, 0x3A, 0xBB, 0xD3, 0xFF, 0xA9, 0xEC,
+    0xFF, 0x56, 0x80, 0x45, 0xF1, 0x11, 0xB6, 0x8D, 0x6C, 0xF0, 0xFC, 0xDF, 0x14, 0x5F, 0xD1, 0xF8,
+    0x03, 0x95, 0x55, 0x31, 0x4F, 0x1C, 0x47, 0x14, 0xFE, 0x66, 0x07, 0x32, 0x0A, 0x0B, 0xCC, 0x15,
+    0xB8, 0xB0, 0x02, 0x6C, 0x93, 0x82, 0x44, 0x07, 0xE7, 0x82, 0xE2, 0x8A, 0xBD, 0xDB, 0x31, 0x17,
+    0x89, 0x22, 0x85, 0x29, 0xEE, 0x5A, 0xE4, 0x34, 0x51, 0x4A, 0xA4, 0xA4, 0xA0, 0xD8, 0xB3, 0xD7,
+    0xB1, 0x14, 0x94, 0x2E, 0x8A, 0xF2, 0x03, 0x90, 0xD2, 0x38, 0xA4, 0xC8, 0x15, 0x67, 0x89, 0xE2,
+    0x80, 0xC1, 0x14, 0x96, 0x42, 0x33, 0x86, 0x22, 0x45, 0x8A, 0x6C, 0x24, 0x27, 0x52, 0x48, 0x91,
+    0x89, 0x74, 0x89, 0x4E, 0xCE, 0xC1, 0xE6, 0xCD, 0xDE, 0x81, 0xA3, 0x08, 0x81, 0x3D, 0x73, 0x3B,
+    0xB7, 0x3B, 0xF3, 0xDE, 0x37, 0xF3, 0xDE, 0xFB, 0xDE, 0x1B, 0xDC, 0xA8, 0x8F, 0xD6, 0x91, 0xF5,
+    0x4A, 0xA7, 0x28, 0x25, 0x22, 0x85, 0xD4, 0x32, 0x81, 0x30, 0x0B, 0x00, 0x4F, 0xB7, 0x01, 0xFC,
+    0x69, 0x69, 0xD8, 0xD3, 0x34, 0x44, 0xF4, 0xE0, 0x3E, 0x3D, 0x2C, 0x53, 0xB4, 0x7A, 0x48, 0x73,
+    0x92, 0x1B, 0xA0, 0xE2, 0x91, 0x48, 0x97, 0xBA, 0x97, 0xA2, 0x83, 0xE0, 0x39, 0x62, 0x64, 0x7D,
+    0x84, 0x4E, 0xFA, 0x62, 0x30, 0x6D, 0xA7, 0x96, 0x3A, 0x28, 0x85, 0x8B, 0xC6, 0xB6, 0xD1, 0xF7,
+    0xFB, 0xBC, 0x8F, 0xAA, 0x7C, 0x0F, 0xC1, 0x3C, 0xE1, 0xD1, 0x8E, 0x3E, 0xA1, 0x39, 0x58, 0x9F,
+    0xA4, 0x67, 0xE9, 0x7D, 0xBD, 0x8B, 0x82, 0xED, 0x20, 0xD2, 0x21, 0x22, 0x55, 0x21, 0xAD, 0x85,
+    0xE1, 0x43, 0xF2, 0x65, 0xC2, 0x8E, 0xBA, 0x40, 0x90, 0x00, 0x57, 0xDB, 0xC1, 0x72, 0x3B, 0x32,
+    0x3A, 0xF3, 0xBB, 0x7B, 0x5B, 0x64, 0x46, 0x96, 0x5D, 0x6B, 0x07, 0xCB, 0x92, 0xAC, 0xEF, 0x67,
+    0xE6, 0xAA, 0x93, 0xF2, 0x8C, 0x20, 0xE5, 0xFF, 0x4F, 0x1A, 0xD9, 0x48, 0x45, 0x89, 0xD3, 0x7B,
+    0xE3, 0xC3, 0xF3, 0x46, 0x3B, 0x8D, 0x97, 0x12, 0x1B, 0xED, 0x7F, 0xF5, 0x26, 0xBE, 0xB8, 0xF4,
+    0x97, 0xBB, 0xC4, 0xA0, 0xDC, 0x58, 0x3D, 0xF9, 0x4E, 0x4F, 0xEB, 0xCD, 0xFD, 0x44, 0xE3, 0xAA,
+    0xEE, 0x1C, 0x29, 0x30, 0x8D, 0xC7, 0x8D, 0x17, 0xDF, 0x2E, 0xF2, 0x31, 0xEE, 0xD5, 0xC0, 0xAF,
+    0xEC, 0xAC, 0x51, 0xCF, 0x4E, 0xB7, 0x1E, 0x0D, 0x47, 0xFA, 0xCB, 0xCE, 0x68, 0x6C, 0x34, 0x1A,
+    0x51, 0x96, 0xFD, 0xD2, 0x68, 0xAC, 0x34, 0xF2, 0x46, 0xAE, 0xA1, 0xF6, 0x57, 0xFE, 0x5E, 0xBF,
+    0x64, 0x6A, 0x6A, 0x34, 0x0E, 0x5E, 0xAF, 0x7F, 0x34, 0x46, 0xDA, 0x84, 0x41, 0x9E, 0xF4, 0xB6,
+    0xB6, 0xBE, 0xA1, 0x8F, 0xDC, 0x37, 0xAA, 0x2C, 0x3D, 0x13, 0xFA, 0x7A, 0x47, 0x68, 0x2F, 0xD9,
+    0x11, 0x26, 0xF6, 0x13, 0x5B, 0xF4, 0x68, 0xA1, 0x29, 0xD2, 0x8A, 0xD0, 0xDB, 0x92, 0xEB, 0x02,
+    0xA6, 0x82, 0x3B, 0x4F, 0xD2, 0x58, 0x32, 0x53, 0x84, 0x2A, 0x4C, 0xF2, 0xC4, 0x86, 0xFE, 0x92,
+    0x09, 0xA5, 0x67, 0x3B, 0xFE, 0x51, 0x37, 0x10, 0x9A, 0xA9, 0x95, 0xD2, 0xFB, 0xA6, 0x19, 0xDC,
+    0xB6, 0xB1, 0xFF, 0x69, 0x4A, 0x0B, 0xA6, 0x3D, 0xC1, 0x9D, 0x67, 0x82, 0x65, 0x73, 0x2F, 0x48,
+    0xBA, 0x15, 0xB1, 0x6F, 0x17, 0x08, 0x38, 0x74, 0x68, 0x23, 0x98, 0x1A, 0x15, 0xCF, 0xBA, 0xFD,
+    0x88, 0x44, 0xE3, 0x80, 0x6B, 0x3B, 0x23, 0x54, 0xAB, 0x88, 0x9B, 0x40, 0xCF, 0x51, 0x4E, 0x12,
+    0xA1, 0xD8, 0x59, 0xF6, 0x63, 0xB6, 0x87, 0x22, 0x40, 0xC1, 0x4D, 0x30, 0x0B, 0xB4, 0xC1, 0xB5,
+    0x5B, 0x8A, 0x1D, 0x2F, 0xF2, 0x98, 0x2A, 0x10, 0xB5, 0xA4, 0x72, 0x93, 0x93, 0x08, 0xFE, 0x38,
+    0x2D, 0x9D, 0xE5, 0x74, 0x0F, 0x9D, 0x0C, 0x31, 0x87, 0x34, 0xEA, 0xAD, 0xBB, 0x59, 0x66, 0x7F,
+    0xFB, 0x35, 0x65, 0x29, 0x3C, 0xE3, 0xB0, 0x79, 0x4E, 0xA3, 0xB7, 0x96, 0xFB, 0x7B, 0x87, 0x7D,
+    0x4A, 0xA4, 0xB7, 0x11, 0x18, 0x91, 0xDD, 0xCE, 0x4E, 0xEF, 0x67, 0x3F, 0x65, 0x1B, 0x67, 0xAC,
+    0x87, 0x02, 0x91, 0x3A, 0x38, 0xB0, 0x05, 0x47, 0xFE, 0x85, 0x5D, 0xF1, 0x8F, 0x6E, 0x16, 0xD8,
+    0x20, 0x4B, 0x64, 0xE2, 0x6B, 0x71, 0x98, 0x72, 0xCB, 0xFF, 0xB6, 0xC4, 0xCE, 0x3E, 0x89, 0x60,
+    0x04, 0x37, 0xE5, 0x53, 0xDB, 0x1E, 0x10, 0x46, 0xAD, 0x9A, 0xD7, 0x23, 0x0C, 0x7B, 0x21, 0x5E,
+    0x8D, 0x30, 0x14, 0xB0, 0xC4, 0x4F, 0xDF, 0x79, 0xF4, 0xC1, 0xE7, 0x2C, 0xB9, 0xBE, 0x53, 0x9A,
+    0x8C, 0x60, 0x6C, 0x11, 0x63, 0xE5, 0x1B, 0xAB, 0x73, 0x27, 0x9D, 0x8F, 0xD9, 0xD3, 0xF1, 0xE9,
+    0xB5, 0x5B, 0x9F, 0xD1, 0xCE, 0x1C, 0x18, 0x07, 0x6E, 0xE1, 0x9A, 0xD7, 0x81, 0x65, 0xD3, 0x9B,
+    0xDE, 0xF7, 0x28, 0x3E, 0xAE, 0x1F, 0x9F, 0xB4, 0x8E, 0x95, 0xFE, 0xBA, 0x86, 0x2F, 0x5F, 0x45,
+    0xF7, 0xFC, 0x75, 0xE4, 0xA2, 0xBA, 0x10, 0xDA, 0xDA, 0xB0, 0x5A, 0xB9, 0xDC, 0xF7, 0x37, 0x74,
+    0x1E, 0x04, 0xE9, 0x69, 0xDF, 0xF1, 0xAF, 0xE8, 0x99, 0x20, 0x2F, 0x4F, 0x9E, 0xCE, 0xCB, 0x54,
+    0x99, 0x6B, 0xE7, 0x4F, 0xAC, 0xF3, 0x07, 0x79, 0x9C, 0x1D, 0x63, 0xF6, 0x94, 0xB4, 0xD5, 0xA6,
+    0xE4, 0x3F, 0xE8, 0x66, 0x47, 0x76, 0xE7, 0x89, 0x5D, 0x96, 0x98, 0xB1, 0x3E, 0xC3, 0x8E, 0x0C,
+    0xD5, 0x00, 0x1B, 0xB2, 0x63, 0x3D, 0x4F, 0xF4, 0x08, 0xBD, 0x03, 0xC2, 0xF0, 0x93, 0x90, 0x1F,
+    0x24, 0x21, 0x02, 0x84, 0x7E, 0x8D, 0xB0, 0x42, 0x54, 0x02, 0x7E, 0x94, 0x52, 0xC8, 0x64, 0x8F,
+    0x6A, 0x09, 0x36, 0xC1, 0x14, 0xA6, 0x5E, 0x56, 0x3F, 0xCF, 0xF4, 0xE2, 0x6A, 0xE0, 0xD7, 0xF2,
+    0x64, 0x40, 0x7B, 0x5E, 0x3E, 0x7C, 0x66, 0x3B, 0x55, 0xB9, 0xB1, 0x6F, 0xDB, 0x15, 0x62, 0xFA,
+    0x50, 0x6A, 0x9E, 0xB0, 0x7A, 0x95, 0x60, 0xF9, 0x89, 0x5B, 0x23, 0x89, 0xB8, 0xE4, 0xD7, 0x8C,
+    0x2D, 0x4F, 0xF2, 0x41, 0x1D, 0xE5, 0xBA, 0xEA, 0x59, 0xA9, 0x3A, 0xDC, 0x4C, 0xE4, 0xDF, 0x76,
+    0x96, 0xA7, 0x1D, 0x5F, 0x77, 0xE5, 0x92, 0x2D, 0x71, 0x43, 0x69, 0xB4, 0xE8, 0x0F, 0x81, 0x24,
+    0x4B, 0x43, 0x5A, 0x23, 0x59, 0x59, 0xB3, 0xB4, 0xDC, 0xF4, 0x6C, 0xC5, 0xD7, 0x24, 0x61, 0xB9,
+    0x6A, 0x0D, 0x94, 0x71, 0x17, 0x54, 0x39, 0x9B, 0xA9, 0xD8, 0x4F, 0x63, 0x96, 0x3B, 0xA1, 0x88,
+    0x2E, 0x37, 0x41, 0x52, 0xA5, 0xE2, 0x2F, 0x15, 0xE5, 0x01, 0x4D, 0x8E, 0x11, 0xE9, 0x17, 0x50,
+    0xA5, 0x7A, 0x68, 0x62, 0xA1, 0xCB, 0x43, 0xF4, 0x4D, 0x0A, 0x42, 0xD9, 0x53, 0xE5, 0x49, 0xA1,
+    0x53, 0xBE, 0x54, 0x4B, 0x98, 0xA1, 0xEC, 0xF8, 0xA4, 0x88, 0x91, 0x99, 0x16, 0x02, 0xCA, 0xC1,
+    0xC0, 0xD7, 0x16, 0xD3, 0xAD, 0x7C, 0x8E, 0x19, 0x1F, 0xBC, 0xF6, 0x50, 0x4F, 0x90, 0xAC, 0xD3,
+    0xD9, 0xCC, 0x03, 0x48, 0x6D, 0x0A, 0x2B, 0x52, 0x55, 0x98, 0xF5, 0x75, 0x15, 0x3D, 0x4E, 0x08,
+    0x21, 0xB3, 0x42, 0x2F, 0xA0, 0xED, 0x91, 0x46, 0x08, 0xCB, 0xF5, 0x24, 0xCA, 0x48, 0x85, 0x9A,
+    0xC1, 0x1A, 0xD3, 0xE7, 0x86, 0x61, 0x06, 0x2D, 0x91, 0x06, 0x2A, 0xF6, 0x2C, 0xA3, 0xF0, 0xFF,
+    0xA7, 0x9E, 0xDD, 0x39, 0xDD, 0x3A, 0x77, 0xE3, 0x1C, 0xF2, 0xEC, 0x74, 0x4C, 0xA0, 0x84, 0x84,
+    0xA0, 0x79, 0x39, 0xBC, 0x9B, 0x5C, 0xD4, 0x53, 0xE7, 0x49, 0xE2, 0x48, 0x8E, 0x46, 0x5C, 0xB8,
+    0x5C, 0xF2, 0xDC, 0x58, 0xBA, 0x9A, 0x76, 0x78, 0xA6, 0xA3, 0x7E, 0x75, 0x97, 0xFF, 0xFE, 0x33,
+    0x6C, 0x21, 0x70, 0x22, 0x96, 0x5C, 0x36, 0x4F, 0x9B, 0x08, 0x1D, 0xC0, 0x9D, 0x1B, 0x31, 0xB3,
+    0x8E, 0x0C, 0x84, 0x2C, 0x9E, 0xE3, 0x9E, 0x8A, 0x14, 0xEF, 0x52, 0x0E, 0x0E, 0x08, 0xEA, 0x25,
+    0x74, 0xA4, 0x0E, 0x7C, 0x2D, 0x35, 0x5C, 0xF2, 0x0F, 0x72, 0x7D, 0x94, 0x90, 0x2B, 0x51, 0x1F,
+    0x9D, 0xEA, 0x2E, 0x7A, 0x05, 0xE9, 0xA8, 0x43, 0x18, 0xB3, 0x54, 0x78, 0x62, 0xCF, 0x30, 0xB2,
+    0x5F, 0x68, 0x4E, 0xE8, 0x9C, 0x58, 0x26, 0xD4, 0x3D, 0x25, 0xE8, 0x46, 0x14, 0x17, 0x8C, 0x9F,
+    0xA3, 0xE3, 0xD3, 0xBD, 0xA5, 0xFA, 0x28, 0x11, 0xE0, 0xCB, 0x3C, 0xB8, 0xBA, 0xFD, 0x0B, 0x95,
+    0x55, 0x31, 0x6C, 0x1C, 0x45, 0x14, 0x7D, 0xB3, 0x1B, 0x67, 0x21, 0xAB, 0xDC, 0x44, 0xC8, 0x16,
+    0x81, 0xC8, 0xB7, 0x29, 0x90, 0x40, 0xC8, 0xE7, 0xA3, 0xA0, 0x70, 0xB1, 0xBE, 0xDB, 0x90, 0x22,
+    0x05, 0x45, 0x2C, 0xC1, 0x55, 0x29, 0xA0, 0xA0, 0x80, 0x20, 0xE1, 0x20, 0xB9, 0xB0, 0xC2, 0x25,
+    0xB7, 0x56, 0x0A, 0x8A, 0x14, 0xA4, 0x49, 0x4A, 0x44, 0x61, 0x45, 0xE2, 0x9A, 0x5C, 0x71, 0x28,
+    0x87, 0x64, 0xE7, 0x06, 0xA7, 0x48, 0x11, 0x29, 0xAC, 0x15, 0xA0, 0x41, 0x51, 0x96, 0xD8, 0x01,
+    0x14, 0x4B, 0x68, 0x44, 0x36, 0xCA, 0xC1, 0xDD, 0x79, 0x78, 0xB3, 0x67, 0x13, 0x22, 0x68, 0x98,
+    0xF3, 0x78, 0x66, 0x67, 0xE7, 0xFF, 0x79, 0xFF, 0xFD, 0xF7, 0x67, 0x31, 0x0E, 0x60, 0x56, 0x7C,
+    0x8D, 0x00, 0x26, 0x91, 0xF1, 0xD9, 0x81, 0x9B, 0xC0, 0x8F, 0x34, 0x9C, 0xA4, 0x0E, 0xE8, 0x12,
+    0xD0, 0xF6, 0x81, 0x8E, 0xAB, 0xD0, 0x43, 0xCA, 0x3E, 0x83, 0x45, 0x4C, 0xA2, 0x12, 0x7B, 0xF0,
+    0x35, 0x0D, 0xE7, 0x60, 0xDB, 0x24, 0x7F, 0x41, 0x2C, 0x63, 0x4F, 0xD1, 0x38, 0xE2, 0xCF, 0xB6,
+    0x20, 0x15, 0x4B, 0xFD, 0xE1, 0x7C, 0x41, 0x74, 0xF5, 0x01, 0x4C, 0xE4, 0x4B, 0xF0, 0xDF, 0x48,
+    0x74, 0x28, 0xCF, 0xAD, 0x67, 0xF5, 0xC0, 0x5F, 0xD3, 0x83, 0xCA, 0xEE, 0x34, 0x6D, 0xCF, 0x4A,
+    0x57, 0xA5, 0x33, 0xFB, 0xBD, 0x91, 0x2D, 0xDE, 0x43, 0x35, 0x93, 0x6F, 0xAE, 0x25, 0x61, 0xE8,
+    0xDE, 0x88, 0xC3, 0xB6, 0xF7, 0x19, 0xDA, 0x5A, 0xD2, 0xBA, 0xD1, 0x13, 0x43, 0xBE, 0x8E, 0x20,
+    0x63, 0x0C, 0x21, 0x5B, 0x78, 0xA8, 0x64, 0x01, 0x7A, 0x41, 0x5E, 0xDA, 0xAC, 0x1A, 0x8D, 0x10,
+    0x04, 0xE9, 0x44, 0xA8, 0x45, 0xE5, 0x81, 0xFB, 0x7D, 0xB4, 0x00, 0x3F, 0xC1, 0xBC, 0xC2, 0x34,
+    0x84, 0x46, 0x11, 0x9E, 0xFA, 0x50, 0x7B, 0x9B, 0xC0, 0x58, 0xEC, 0x0D, 0x9D, 0x0C, 0x1D, 0xC8,
+    0x39, 0xC7, 0x24, 0xA1, 0xF4, 0xE2, 0xF6, 0xA2, 0x7F, 0x54, 0xE9, 0xF2, 0x2A, 0xAE, 0x61, 0xAC,
+    0xE6, 0x9B, 0x8D, 0x8B, 0x99, 0x5A, 0x64, 0xA8, 0x21, 0x4A, 0x34, 0x93, 0xF0, 0x62, 0xC6, 0xFF,
+    0x05, 0xF0, 0x3E, 0x29, 0xD2, 0xE1, 0x4C, 0x41, 0x4A, 0x61, 0xD0, 0x57, 0x7A, 0xB1, 0x2D, 0x4B,
+    0xDE, 0x8D, 0x2D, 0xD5, 0x88, 0xF1, 0x02, 0x82, 0x81, 0xBB, 0x96, 0xB6, 0xA4, 0x84, 0xCE, 0x0A,
+    0xDE, 0x56, 0xB2, 0x6F, 0x05, 0x32, 0xF2, 0x92, 0x43, 0x99, 0xBB, 0x89, 0x31, 0xE1, 0x3E, 0x1A,
+    0x78, 0x57, 0xD5, 0x4A, 0x28, 0x8F, 0xC5, 0xBA, 0x35, 0x29, 0x9F, 0x53, 0xC3, 0x29, 0x19, 0x89,
+    0x6D, 0x34, 0x7A, 0x81, 0x77, 0x5D, 0x85, 0x75, 0xF7, 0x66, 0x14, 0xEA, 0x3C, 0xCA, 0xC0, 0xFF,
+    0x54, 0x55, 0x33, 0x12, 0x00, 0xEC, 0xFD, 0xC6, 0x88, 0xBA, 0x48, 0xFD, 0x28, 0x84, 0x76, 0x55,
+    0x11, 0x9D, 0xF2, 0x60, 0x22, 0x42, 0x23, 0x2E, 0x5F, 0xF3, 0x96, 0xF4, 0xE1, 0x22, 0x48, 0x76,
+    0x1B, 0xB3, 0xF6, 0x18, 0xE5, 0x3C, 0x7A, 0xBB, 0x6A, 0xD4, 0x44, 0x24, 0x86, 0x4E, 0x5F, 0x25,
+    0x2D, 0x22, 0x3F, 0x43, 0xEF, 0x2F, 0x27, 0xCC, 0x56, 0x09, 0xF3, 0x72, 0x5B, 0x2C, 0x03, 0x22,
+    0x41, 0x39, 0x12, 0x03, 0x4C, 0x6A, 0x71, 0x5B, 0x15, 0x0B, 0x22, 0x5D, 0x90, 0x66, 0xF0, 0xEA,
+    0x95, 0x0B, 0x0C, 0x54, 0xA4, 0x10, 0x10, 0xCD, 0xB8, 0x3A, 0x70, 0x63, 0x90, 0xB5, 0xCC, 0x12,
+    0x57, 0xB4, 0xCB, 0x25, 0x26, 0xD6, 0x24, 0x82, 0x79, 0x3E, 0x94, 0xC8, 0x4D, 0x37, 0x45, 0x86,
+    0x60, 0xD9, 0xDD, 0xD2, 0x33, 0xFE, 0xB1, 0xB8, 0x3D, 0xE3, 0xBB, 0xEB, 0x69, 0xD0, 0xC3, 0x38,
+    0x5E, 0x6C, 0x1E, 0x37, 0x1B, 0x91, 0x8E, 0x5B, 0xB4, 0x1E, 0xF1, 0x26, 0xA9, 0x22, 0xB2, 0x36,
+    0x07, 0x71, 0x4D, 0xFC, 0x9C, 0x92, 0xB5, 0xA2, 0xFF, 0x39, 0xB6, 0xC5, 0xED, 0xF5, 0x34, 0x6C,
+    0xC9, 0x69, 0xFF, 0x9C, 0x89, 0xA9, 0x89, 0x6E, 0x54, 0x59, 0xF1, 0x96, 0x52, 0x6D, 0x59, 0xEB,
+    0x14, 0x1D, 0xA3, 0x88, 0x37, 0x40, 0xA0, 0xAA, 0xA9, 0x18, 0x29, 0x0B, 0xC6, 0x0C, 0x30, 0xCF,
+    0x2E, 0xE9, 0x34, 0xC0, 0xEB, 0x4C, 0xE5, 0x01, 0x86, 0x8C, 0xBC, 0x37, 0x4C, 0x8C, 0xAE, 0x89,
+    0x98, 0x48, 0x10, 0x16, 0xF6, 0xFD, 0x19, 0x23, 0xA0, 0x0B, 0x87, 0xC2, 0x24, 0x50, 0x1C, 0xFA,
+    0xC3, 0x6E, 0xC9, 0xBD, 0x50, 0x55, 0x1E, 0x37, 0x7A, 0x5B, 0x9A, 0x22, 0xA8, 0x93, 0x38, 0x49,
+    0x45, 0x08, 0xE4, 0x96, 0xF4, 0x24, 0x0C, 0xCD, 0xE6, 0x1F, 0x5C, 0xC8, 0xCD, 0x02, 0x33, 0x84,
+    0x58, 0xAD, 0x81, 0x47, 0x81, 0xC7, 0x02, 0xC7, 0x62, 0x11, 0x55, 0x8D, 0xD1, 0xF2, 0x07, 0xD3,
+    0x13, 0xB9, 0x3E, 0x77, 0xC0, 0x05, 0xA6, 0x67, 0x07, 0xA7, 0x7B, 0x42, 0xE7, 0xA3, 0xA6, 0x28,
+    0xD9, 0x2A, 0x58, 0xB1, 0x83, 0x9B, 0xF8, 0xAA, 0xC5, 0x31, 0x44, 0xA7, 0xC8, 0xC1, 0x53, 0xD2,
+    0xB9, 0x8F, 0x0F, 0x58, 0x4A, 0x1B, 0x46, 0x57, 0xB5, 0xBC, 0xD4, 0x7B, 0xFE, 0x3B, 0x29, 0x40,
+    0x17, 0x8B, 0xD0, 0x08, 0x08, 0x2E, 0x92, 0x31, 0x65, 0xCA, 0x94, 0x56, 0xED, 0xD1, 0x3C, 0xD9,
+    0x96, 0x22, 0xDF, 0xB9, 0x09, 0x21, 0x16, 0x0B, 0xA7, 0xA6, 0x82, 0x5F, 0x21, 0xFA, 0x37, 0x7F,
+    0x3C, 0x6F, 0x12, 0xC8, 0xB4, 0x9A, 0xE0, 0x49, 0x23, 0x1E, 0x87, 0x9E, 0x84, 0xB9, 0xA2, 0xB0,
+    0x9A, 0x73, 0xE8, 0x45, 0x34, 0x3E, 0x90, 0x07, 0x38, 0xDF, 0x5C, 0x86, 0x34, 0x24, 0x22, 0xE0,
+    0x43, 0xD9, 0x6C, 0x13, 0x70, 0x33, 0xCE, 0x59, 0xCA, 0x57, 0x60, 0x83, 0xF0, 0x53, 0xAB, 0x0E,
+    0xF2, 0x8C, 0xC6, 0xF6, 0x13, 0xB7, 0x1E, 0xE3, 0xE1, 0x2D, 0xC0, 0x34, 0x62, 0xB6, 0xD6, 0xBC,
+    0x6C, 0x8C, 0xD9, 0x48, 0x30, 0x66, 0x51, 0xE5, 0x7D, 0xA7, 0x56, 0x79, 0x8C, 0xAB, 0x51, 0xD5,
+    0xEE, 0x1D, 0x1D, 0x9E, 0xD2, 0x4B, 0xEB, 0x31, 0x8B, 0x78, 0x12, 0x14, 0x02, 0x5D, 0xFE, 0x6B,
+    0xBA, 0xDB, 0xDA, 0xA3, 0x9C, 0x41, 0x9F, 0xFC, 0xB2, 0xF6, 0x3B, 0x1D, 0xFF, 0x14, 0x59, 0x30,
+    0x36, 0x7E, 0x8B, 0xE9, 0xD4, 0x68, 0xD3, 0xE1, 0xFF, 0x74, 0xB1, 0x33, 0xDD, 0x3F, 0x39, 0x55,
+    0xFA, 0x38, 0x9D, 0xFE, 0x0D, 0xE5, 0x34, 0x4F, 0xD5, 0xE8, 0x82, 0x61, 0xCD, 0x2F, 0xA2, 0x4D,
+    0xE0, 0xED, 0x33, 0xB5, 0xDA, 0x63, 0x3A, 0x7E, 0xA8, 0xC0, 0xAB, 0xC5, 0x16, 0x10, 0xEB, 0x18,
+    0xAF, 0xED, 0x3A, 0x26, 0xE2, 0x46, 0xE6, 0xDD, 0xC9, 0xC2, 0x05, 0x7D, 0x24, 0x89, 0x9E, 0x72,
+    0xFC, 0xEC, 0xE4, 0x41, 0xAE, 0xCE, 0xDE, 0x65, 0x48, 0x4C, 0x05, 0xA3, 0x1B, 0x6D, 0x1F, 0x05,
+    0xF8, 0xD4, 0xF6, 0x23, 0xC9, 0xD1, 0x1B, 0xC7, 0xB9, 0xEA, 0x1A, 0x6E, 0x10, 0x27, 0x2E, 0x92,
+    0xDC, 0x89, 0xDA, 0x9C, 0x4D, 0x87, 0x63, 0x2F, 0x51, 0xD8, 0xDB, 0x13, 0x8E, 0x82, 0x8F, 0x70,
+    0xCA, 0x55, 0xAD, 0xD0, 0xB9, 0x7E, 0xFF, 0x44, 0x60, 0x06, 0x44, 0x5B, 0xCA, 0xFF, 0x5E, 0xB1,
+    0x58, 0xC6, 0x6D, 0x99, 0x11, 0x30, 0x45, 0xB2, 0x68, 0xA7, 0xAC, 0xC0, 0x82, 0xC4, 0x8C, 0x44,
+    0x2A, 0xDD, 0x8B, 0xF3, 0x92, 0x6A, 0x74, 0x52, 0xBE, 0xE4, 0xBF, 0x7D, 0x23, 0xF0, 0xC2, 0xD2,
+    0xB6, 0x07, 0xA1, 0x84, 0x94, 0x91, 0xFB, 0x6D, 0x84, 0xFE, 0x83, 0x66, 0xD7, 0x98, 0xED, 0x70,
+    0x94, 0x29, 0x0E, 0x0E, 0x77, 0xBC, 0x6B, 0x25, 0x67, 0x9F, 0x26, 0x5C, 0xBE, 0xAB, 0x34, 0x9B,
+    0x97, 0x6D, 0xCA, 0x48, 0xC8, 0x51, 0x3E, 0xDA, 0x7D, 0xB6, 0x8B, 0xBF, 0xC9, 0xE0, 0xED, 0x73,
+    0x2F, 0xFB, 0xE4, 0xFC, 0x57, 0xB7, 0xA6, 0x92, 0x99, 0x16, 0xEE, 0x29, 0xF7, 0x3C, 0x0A, 0x53,
+    0xF8, 0xC7, 0x74, 0xDC, 0x6A, 0xFE, 0x25, 0x7B, 0x34, 0xD5, 0xAF, 0xCB, 0xAC, 0x87, 0x93, 0xCD,
+    0x26, 0xD3, 0x25, 0x7E, 0xA1, 0x4F, 0xFB, 0x38, 0x2A, 0x16, 0x9D, 0x3B, 0xFD, 0x97, 0xF5, 0xCE,
+    0xD4, 0xB9, 0x35, 0xB5, 0xD1, 0xEB, 0xBA, 0xF7, 0xB4, 0x7B, 0xD7, 0x1E, 0x6A, 0x8F, 0xBF, 0x70,
+    0x10, 0x7E, 0xDC, 0x21, 0x4F, 0x1D, 0xDF, 0x98, 0xDE, 0xE9, 0x66, 0xF3, 0x2A, 0x71, 0x3D, 0xA4,
+    0x4F, 0xCF, 0x98, 0xCC, 0x8B, 0xFD, 0x88, 0xB7, 0x33, 0xF6, 0xB0, 0x82, 0xF9, 0x9D, 0x1A, 0x0B,
+    0x62, 0xB8, 0xB7, 0xF9, 0x6D, 0xD2, 0xAB, 0x54, 0x0F, 0xAB, 0xAD, 0x4E, 0x15, 0x4F, 0xB3, 0xC8,
+    0x8D, 0x15, 0xB8, 0x72, 0x34, 0x65, 0x59, 0x21, 0x04, 0xA9, 0x3A, 0x94, 0x12, 0x89, 0xA8, 0x90,
+    0x54, 0xFF, 0x26, 0x75, 0xFA, 0x98, 0x4E, 0x6D, 0xC5, 0x78, 0x7A, 0x47, 0x77, 0x3B, 0x44, 0x96,
+    0x87, 0x98, 0x7E, 0x27, 0xD9, 0x83, 0x41, 0xAE, 0x3B, 0xAB, 0xEA, 0x1E, 0x3E, 0x3A, 0xCB, 0x5B,
+    0x25, 0xEE, 0x79, 0x69, 0x07, 0xBD, 0x10, 0xB3, 0xD3, 0x96, 0x66, 0xEF, 0x7A, 0xE2, 0xA4, 0x19,
+    0xF4, 0x2C, 0x3A, 0x52, 0xD5, 0xC5, 0xF6, 0x00, 0x41, 0x5E, 0xFB, 0x98, 0xA8, 0xBD, 0x65, 0x4C,
+    0xBF, 0xC9, 0xBA, 0x2B, 0x83, 0x75, 0x4F, 0x3C, 0x3E, 0xA7, 0xA7, 0x9B, 0x43, 0xCB, 0x88, 0xFF,
+    0xF4, 0xAA, 0xB1, 0x2D, 0x1D, 0x9D, 0xBD, 0x77, 0x59, 0x28, 0xC7, 0x98, 0xE3, 0xA8, 0xDE, 0xEF,
+    0x6A, 0x37, 0x43, 0x39, 0xE6, 0x4E, 0x43, 0x68, 0xF2, 0x0C, 0xB7, 0x66, 0x9D, 0x0A, 0xE4, 0x11,
+    0x9D, 0x21, 0xE3, 0xC1, 0x32, 0x0E, 0x64, 0xD4, 0x41, 0xBD, 0xE2, 0xC7, 0x8E, 0x5E, 0xE1, 0x57,
+    0x6B, 0xA9, 0xCF, 0xC8, 0xDD, 0x01, 0xBC, 0x94, 0xDF, 0xE0, 0x06, 0x2B, 0xB6, 0x9B, 0x7A, 0x6B,
+    0xD4, 0xC9, 0x33, 0xBB, 0x9F, 0xD9, 0xFF, 0xD3, 0xFE, 0x02, 0xA5, 0x55, 0x3B, 0x6F, 0xE4, 0x54,
+    0x14, 0xFE, 0x6C, 0x13, 0x5D, 0x69, 0x2D, 0xE2, 0x14, 0x59, 0x24, 0x84, 0xC8, 0x34, 0x29, 0x56,
+    0x88, 0x19, 0x37, 0x14, 0xB3, 0x92, 0x93, 0xF1, 0xC2, 0x1F, 0x08, 0xDA, 0x18, 0x4A, 0x7A, 0x90,
+    0x48, 0x43, 0x31, 0x12, 0x79, 0x18, 0x6D, 0x41, 0xCB, 0x4F, 0x48, 0xB1, 0x05, 0x38, 0xC5, 0x34,
+    0x29, 0x52, 0x4C, 0x36, 0x5E, 0xA5, 0xD8, 0x62, 0x25, 0xD6, 0x01, 0x21, 0x0A, 0x0A, 0x2C, 0x56,
+    0x69, 0x52, 0xDD, 0x48, 0x77, 0x59, 0x2B, 0x99, 0x99, 0xCB, 0x77, 0x6C, 0x8F, 0x04, 0x12, 0x5A,
+    0x94, 0xE5, 0x7A, 0xEE, 0xD8, 0xE7, 0xFA, 0x3C, 0xBE, 0xF3, 0x34, 0xB0, 0x01, 0x78, 0x1A, 0x50,
+    0x06, 0xF0, 0x27, 0x40, 0xB0, 0x0D, 0x74, 0xD7, 0x80, 0x28, 0x04, 0x86, 0x1D, 0xE0, 0x30, 0x48,
+    0xA1, 0xFD, 0xDC, 0x2D, 0x55, 0xE1, 0xE5, 0x5E, 0xA9, 0x72, 0x57, 0x07, 0xB1, 0x63, 0x02, 0xA0,
+    0xEA, 0x01, 0xE3, 0x81, 0xB5, 0x53, 0xEE, 0xD9, 0x42, 0x92, 0x6C, 0x06, 0xD6, 0xDA, 0xD3, 0xAB,
+    0xE4, 0x0B, 0x7D, 0x0C, 0x18, 0x8A, 0x6D, 0x53, 0x6F, 0x0F, 0x3B, 0x08, 0x10, 0xE4, 0x22, 0xE7,
+    0x15, 0x58, 0x87, 0x26, 0x71, 0x04, 0xC7, 0x44, 0xC0, 0xFA, 0x0A, 0x4D, 0x3E, 0x8D, 0x81, 0x97,
+    0x39, 0x30, 0x28, 0x88, 0x81, 0x38, 0x40, 0x1C, 0xCD, 0xBA, 0x9D, 0x40, 0x59, 0x5B, 0x74, 0xAE,
+    0xB2, 0xFD, 0x0E, 0x19, 0xA8, 0x10, 0x3E, 0xEF, 0x5E, 0xC9, 0x77, 0xC2, 0xB8, 0x9E, 0x65, 0x59,
+    0x47, 0x4C, 0x16, 0x49, 0xB2, 0x21, 0x52, 0xEB, 0xDC, 0x8A, 0x1C, 0xA0, 0x1B, 0x08, 0x84, 0xED,
+    0xC4, 0xDA, 0xD8, 0xA5, 0x8E, 0x46, 0x62, 0x61, 0x27, 0x76, 0xAC, 0x35, 0x6A, 0x36, 0xFA, 0x5E,
+    0x69, 0x71, 0xC6, 0x29, 0x5D, 0x4D, 0x7B, 0x15, 0x22, 0x5E, 0x2B, 0x08, 0xB2, 0xD1, 0xC5, 0xB7,
+    0x54, 0xA8, 0xCD, 0x5B, 0xE7, 0x9B, 0x6B, 0x38, 0xA4, 0xC9, 0x08, 0x8E, 0x26, 0xCA, 0x81, 0x1F,
+    0xC3, 0xBB, 0xA6, 0xEA, 0x50, 0x94, 0x51, 0x07, 0xF9, 0x41, 0x89, 0x76, 0xD1, 0xF9, 0xFA, 0xCD,
+    0xDE, 0x45, 0xB6, 0xBF, 0x4B, 0x7A, 0x20, 0xF6, 0xE9, 0x97, 0x77, 0x91, 0x8D, 0xCE, 0xA8, 0xB0,
+    0x5A, 0x43, 0x83, 0xDF, 0x15, 0x98, 0x83, 0xEF, 0xF8, 0xC0, 0xD3, 0xD8, 0xA7, 0x08, 0x9D, 0x44,
+    0x47, 0x50, 0x66, 0x07, 0x53, 0x61, 0x12, 0xA8, 0xE3, 0x39, 0xB7, 0x78, 0x19, 0xBD, 0x97, 0x65,
+    0x23, 0x89, 0xEC, 0x59, 0x92, 0xDC, 0x93, 0x03, 0xE6, 0x07, 0x61, 0x6B, 0x20, 0x10, 0x48, 0xF9,
+    0x9E, 0xB5, 0x69, 0xC7, 0xCE, 0x68, 0x8F, 0xE4, 0xC2, 0x8B, 0xB8, 0x0E, 0x1B, 0x0E, 0x2E, 0x6C,
+    0x0C, 0xED, 0x19, 0x74, 0xC9, 0xAE, 0xE8, 0x2D, 0x43, 0x30, 0x26, 0x11, 0xDC, 0x1A, 0x5D, 0x1C,
+    0x9C, 0x52, 0xA1, 0x49, 0xBE, 0xDC, 0xD8, 0x86, 0x4A, 0x99, 0x64, 0x26, 0x18, 0x5D, 0xA6, 0x47,
+    0x3D, 0xA0, 0x85, 0x6B, 0x4D, 0x40, 0x25, 0x75, 0xE4, 0x6D, 0xA0, 0xBB, 0xF3, 0x7C, 0x6C, 0x0A,
+    0xD4, 0xD2, 0xCD, 0x32, 0x6A, 0x6E, 0xD0, 0x89, 0xA7, 0xEA, 0xF1, 0x2C, 0xCB, 0x34, 0x43, 0x2D,
+    0x0E, 0x50, 0x59, 0x9D, 0x25, 0xC5, 0xF0, 0xBF, 0xA3, 0x89, 0xAC, 0xA4, 0x48, 0x8A, 0x84, 0xEB,
+    0x3E, 0x6D, 0x5A, 0xF2, 0x1E, 0x18, 0x8A, 0xFA, 0x39, 0xB9, 0x42, 0x71, 0x64, 0xCC, 0xCB, 0xD5,
+    0xFF, 0xEF, 0x68, 0xAB, 0x72, 0x4E, 0x9E, 0x5B, 0x1D, 0xD8, 0x9C, 0xA9, 0xD8, 0x20, 0x94, 0x9F,
+    0x66, 0xD9, 0xE8, 0x23, 0x83, 0x1E, 0x2B, 0xAA, 0xEF, 0x97, 0x48, 0xFD, 0xA2, 0x09, 0x96, 0x14,
+    0x52, 0x98, 0x36, 0xB8, 0xAB, 0x06, 0x29, 0xE3, 0x49, 0xCF, 0xA5, 0x78, 0xA8, 0x6A, 0x59, 0x82,
+    0x61, 0xA0, 0x9E, 0xFD, 0x92, 0x3C, 0x22, 0x78, 0x63, 0x9B, 0x28, 0xD0, 0xF7, 0xC4, 0xDA, 0xCB,
+    0x24, 0xA1, 0xDF, 0x0E, 0x3D, 0x63, 0xF6, 0x59, 0x11, 0x12, 0x1C, 0x66, 0x56, 0xA5, 0xF5, 0x53,
+    0xB7, 0x89, 0xBF, 0xA9, 0xEB, 0x42, 0x9E, 0x8E, 0x68, 0x92, 0x4A, 0xA9, 0x7B, 0xD8, 0x3C, 0x35,
+    0x82, 0xB2, 0x22, 0xB8, 0xB9, 0xB0, 0x69, 0x51, 0xD3, 0x17, 0xEE, 0x77, 0x6B, 0x42, 0x58, 0x49,
+    0x50, 0x55, 0x29, 0x12, 0x87, 0x42, 0x44, 0xB5, 0x45, 0x59, 0x7D, 0xF9, 0xAD, 0xF6, 0x57, 0x77,
+    0xEF, 0x4E, 0x7C, 0x26, 0x78, 0xC6, 0x3C, 0x17, 0x83, 0xBB, 0xD5, 0x07, 0xFD, 0x3B, 0xCD, 0x2B,
+    0x59, 0x2C, 0xF7, 0x0F, 0xCF, 0x8D, 0x5E, 0x19, 0x7A, 0x3F, 0xE2, 0x79, 0x71, 0xB8, 0x57, 0x39,
+    0xFB, 0x58, 0x9E, 0x4E, 0x87, 0x98, 0x1B, 0x6E, 0x0A, 0xE8, 0xA8, 0x69, 0x34, 0x47, 0x37, 0xB0,
+    0x24, 0x00, 0x02, 0x59, 0xA5, 0x59, 0xEA, 0xC7, 0x36, 0x0F, 0xF0, 0x69, 0xD1, 0x61, 0xA7, 0x75,
+    0xC9, 0x41, 0x11, 0x69, 0xD6, 0x8A, 0x22, 0x63, 0xB2, 0x47, 0xDC, 0x03, 0x8A, 0x84, 0x45, 0x13,
+    0xCD, 0xBA, 0x2D, 0x63, 0xD1, 0xED, 0x4C, 0xDD, 0x33, 0xFB, 0x47, 0xA9, 0x7B, 0x45, 0xDF, 0x2B,
+    0x17, 0x71, 0xE4, 0xE5, 0x5F, 0xC7, 0x8F, 0xAA, 0xCA, 0x37, 0xF5, 0x6B, 0xBF, 0xF4, 0xCB, 0x70,
+    0x32, 0xA8, 0xFA, 0x81, 0x8E, 0xBE, 0x52, 0xF9, 0xFB, 0xB2, 0x87, 0x8B, 0x3A, 0x5A, 0x1F, 0xEF,
+    0x9A, 0xA0, 0xEC, 0xD4, 0x2E, 0x2E, 0xB7, 0x08, 0x5F, 0x67, 0xAF, 0x71, 0x00, 0x71, 0x10, 0x59,
+    0xD9, 0xAD, 0xB3, 0x5E, 0xDA, 0x36, 0x53, 0x27, 0x6E, 0x0A, 0xB2, 0x1E, 0x0C, 0x92, 0x7A, 0x29,
+    0x07, 0xA7, 0x9A, 0x77, 0x6A, 0xDE, 0x16, 0xF3, 0x4E, 0xDB, 0x77, 0x32, 0x0E, 0x71, 0x4C, 0x7D,
+    0xEC, 0x69, 0xFB, 0x84, 0x7B, 0x72, 0xFF, 0xF7, 0x9D, 0x97, 0xFF, 0xFC, 0xFD, 0x99, 0x2E, 0xBF,
+    0x11, 0xF5, 0x6E, 0x76, 0xDD, 0x79, 0x1B, 0x32, 0x6D, 0x1B, 0x14, 0x84, 0x14, 0xD2, 0x4E, 0x40,
+    0xEC, 0xEA, 0x69, 0x0A, 0xF7, 0x8C, 0x84, 0x66, 0x35, 0x0D, 0xFD, 0x94, 0x45, 0xC5, 0x29, 0xC9,
+    0x7F, 0x3F, 0x65, 0xDF, 0xE6, 0xD0, 0x8E, 0xCC, 0xD1, 0x8A, 0x4D, 0x2C, 0xB9, 0x60, 0xE5, 0x87,
+    0xEC, 0x7D, 0x2F, 0x67, 0xB4, 0x16, 0x08, 0x57, 0x3D, 0xD6, 0xCC, 0x21, 0x25, 0x0D, 0x25, 0xB7,
+    0xC9, 0xBA, 0xC6, 0x2B, 0x60, 0x2A, 0x49, 0xCA, 0xC8, 0xED, 0xF2, 0x48, 0x71, 0xE4, 0x42, 0x32,
+    0xD9, 0x63, 0x7D, 0x7B, 0xCF, 0xDA, 0x91, 0x2B, 0x41, 0xF7, 0x4C, 0x1B, 0xA3, 0xCF, 0x1F, 0x22,
+    0xB0, 0x13, 0xCC, 0x3E, 0x99, 0xB0, 0x29, 0x38, 0xB0, 0x9C, 0x4B, 0x0D, 0xEF, 0xD7, 0x1C, 0xC1,
+    0x67, 0x8C, 0x2D, 0x4B, 0xE6, 0xC5, 0x7F, 0x92, 0x05, 0x01, 0x7D, 0x7C, 0x13, 0x21, 0x43, 0xF2,
+    0xB4, 0x44, 0xE8, 0x17, 0x4E, 0xE5, 0x5F, 0x9D, 0xA4, 0x8A, 0x73, 0x15, 0x9B, 0x6D, 0x21, 0x84,
+    0xF4, 0xF7, 0xB7, 0x1C, 0x66, 0x55, 0x46, 0x8A, 0xD4, 0xE9, 0xEB, 0xDC, 0x98, 0xD6, 0xA5, 0x1E,
+    0xD4, 0x93, 0x1C, 0x7B, 0x06, 0xCE, 0x0F, 0x6D, 0x5D, 0x48, 0xC2, 0x83, 0x76, 0x20, 0xBC, 0x62,
+    0x11, 0x61, 0x35, 0x83, 0x33, 0x99, 0x72, 0x2F, 0x01, 0x4B, 0x72, 0xC6, 0x2F, 0xDB, 0x44, 0xCE,
+    0xC6, 0xF5, 0xF8, 0x78, 0xC5, 0xF2, 0xFF, 0x66, 0xC3, 0x61, 0x8A, 0x1F, 0x5C, 0x56, 0xCB, 0xED,
+    0xC7, 0xC2, 0xFF, 0xD9, 0x1C, 0xE1, 0x26, 0xCA, 0xFE, 0x0D, 0x48, 0xA7, 0x74, 0xBE, 0xB9, 0x9E,
+    0x6E, 0x2D, 0x3A, 0x27, 0x7A, 0x09, 0xB7, 0xEB, 0xBA, 0x1A, 0x54, 0xEE, 0xE9, 0xB9, 0x3D, 0x7E,
+    0x13, 0x5B, 0x45, 0x2B, 0xE8, 0x70, 0xEA, 0xF2, 0xD3, 0x31, 0xE1, 0xF4, 0xDA, 0x98, 0xFB, 0x4E,
+    0x92, 0x2D, 0xA2, 0xE7, 0xBA, 0xFF, 0x02, 0xAD, 0x54, 0x31, 0x4F, 0x14, 0x41, 0x14, 0xFE, 0x76,
+    0x16, 0xDC, 0xC0, 0x26, 0xAC, 0x0D, 0x89, 0x51, 0x8E, 0xA3, 0xB0, 0x30, 0xEA, 0xB1, 0x1D, 0xA1,
+    0x38, 0xBC, 0x0D, 0x0D, 0x85, 0x85, 0x14, 0xAE, 0x56, 0x24, 0xF6, 0x36, 0x14, 0xA7, 0xA1, 0x40,
+    0x6F, 0xE3, 0x15, 0xB6, 0xFC, 0x03, 0x29, 0x2C, 0xF4, 0xAA, 0x0B, 0xB1, 0x80, 0x44, 0xBC, 0x35,
+    0xFE, 0x81, 0x09, 0xC6, 0xCA, 0x66, 0xC4, 0x18, 0x22, 0xD5, 0x16, 0x57, 0x6C, 0x08, 0x77, 0xE3,
+    0xF7, 0xEE, 0x16, 0x39, 0x13, 0x43, 0x2C, 0x9C, 0xDD, 0x99, 0xDD, 0xF7, 0xE6, 0xBD, 0x6F, 0xBE,
+    0xF7, 0xE6, 0xCD, 0x4C, 0x46, 0x63, 0xB5, 0x6E, 0x65, 0xAF, 0x73, 0xDA, 0x2E, 0x77, 0x81, 0x28,
+    0x34, 0xA5, 0x46, 0x7F, 0x33, 0x0B, 0xF3, 0xCB, 0x6A, 0xEB, 0x3A, 0xF0, 0xC8, 0x5A, 0x9B, 0x3E,
+    0xB6, 0xAF, 0x51, 0xB4, 0xAB, 0xF6, 0xA7, 0x4B, 0xD5, 0x04, 0x70, 0x85, 0xC6, 0xF0, 0x96, 0x5B,
+    0x1F, 0x5E, 0x59, 0x8B, 0x0A, 0x60, 0xE0, 0xA3, 0x6C, 0xED, 0xAD, 0xE3, 0x37, 0xB7, 0x81, 0x55,
+    0xE0, 0x66, 0xAB, 0xB5, 0x2D, 0xCE, 0x85, 0xE3, 0x74, 0x1C, 0xAF, 0x52, 0xFC, 0x18, 0xC7, 0xF1,
+    0x19, 0x16, 0xC5, 0x4F, 0xEC, 0xFC, 0x9B, 0x83, 0xCA, 0x11, 0x1A, 0xD5, 0x47, 0xA8, 0xF1, 0x1C,
+    0x32, 0xAA, 0x1E, 0xD0, 0xD0, 0xF0, 0x72, 0x60, 0x63, 0x68, 0xDE, 0xB0, 0x79, 0xC3, 0x9E, 0xCE,
+    0x01, 0x77, 0x68, 0x60, 0x40, 0xE3, 0x81, 0xDD, 0xA9, 0xBC, 0xA1, 0xBE, 0xD4, 0x43, 0x4D, 0x63,
+    0xE9, 0x0C, 0x7B, 0x68, 0x5C, 0x08, 0x13, 0x50, 0x09, 0xC2, 0xD4, 0xCF, 0xD0, 0x89, 0x42, 0x4D,
+    0xE4, 0x4E, 0xE4, 0x77, 0xF9, 0xF1, 0x32, 0xD0, 0xA4, 0x91, 0x94, 0x0D, 0x9C, 0x3E, 0xBF, 0x5C,
+    0xCD, 0x11, 0xD4, 0x94, 0x13, 0xD8, 0xC6, 0x0D, 0x9C, 0xB7, 0x49, 0x38, 0x09, 0xDC, 0x1C, 0x9C,
+    0x2E, 0x1B, 0x21, 0x35, 0xE2, 0x15, 0xA4, 0x6E, 0x97, 0x0C, 0xFC, 0xEE, 0x39, 0x3C, 0x15, 0xFD,
+    0x3F, 0x20, 0xA6, 0xE3, 0x55, 0xC9, 0x8E, 0x51, 0xAD, 0x96, 0x8D, 0x00, 0x97, 0x0B, 0x48, 0x1C,
+    0xF0, 0x24, 0x3F, 0x22, 0x08, 0xF3, 0x80, 0xDD, 0xA7, 0xC2, 0x35, 0x9C, 0xC8, 0x1A, 0xD6, 0x66,
+    0x74, 0xD9, 0x1A, 0x61, 0x81, 0x4D, 0xF6, 0xCA, 0xD0, 0xD2, 0x79, 0xF8, 0x05, 0xA1, 0xB5, 0xBA,
+    0x71, 0x7C, 0xB2, 0x5D, 0x43, 0x15, 0x21, 0xE6, 0x11, 0x44, 0x01, 0xDC, 0xD4, 0x4D, 0x9D, 0xCC,
+    0x31, 0x54, 0x75, 0x11, 0x24, 0x55, 0xA8, 0x6C, 0x16, 0xA8, 0xDD, 0x8B, 0x20, 0x1B, 0x17, 0x5D,
+    0xA3, 0x0B, 0xDE, 0x11, 0xA2, 0xCA, 0x3E, 0x2B, 0x0B, 0x46, 0xA3, 0x0B, 0x88, 0xE4, 0x0E, 0x39,
+    0x4D, 0xC7, 0xBB, 0x05, 0xE5, 0x0E, 0x29, 0x7B, 0xCD, 0x8C, 0x13, 0xA4, 0x9C, 0x91, 0xF2, 0x06,
+    0xA7, 0x97, 0xF8, 0x04, 0x7C, 0xBC, 0xC4, 0x4F, 0x95, 0x26, 0xE5, 0x6C, 0x84, 0xB2, 0x44, 0xE2,
+    0x25, 0x80, 0xD2, 0x45, 0x78, 0x83, 0xE6, 0x70, 0xEF, 0x87, 0x94, 0x5B, 0xA4, 0xCC, 0x44, 0x4B,
+    0x24, 0xC5, 0x82, 0x4E, 0x56, 0x70, 0x0A, 0xC4, 0x4D, 0x84, 0x9A, 0xCC, 0xFC, 0xA6, 0x5C, 0x34,
+    0xBA, 0xDB, 0xBB, 0xEC, 0xFA, 0x7F, 0x24, 0x94, 0x8A, 0x3E, 0x15, 0x36, 0x81, 0xF3, 0x76, 0x50,
+    0x8F, 0x29, 0xCA, 0x2B, 0x2B, 0xDA, 0x31, 0x25, 0xA5, 0xA7, 0x50, 0x57, 0x69, 0xDB, 0xD1, 0x6E,
+    0x33, 0xF1, 0x22, 0x7F, 0x06, 0x25, 0x94, 0x9E, 0xC4, 0x7B, 0xF1, 0x53, 0x9A, 0xDB, 0xA3, 0xC8,
+    0x8B, 0xBC, 0x35, 0x51, 0x2D, 0xA2, 0x8E, 0xB6, 0x58, 0x25, 0xC6, 0x8B, 0xAA, 0x74, 0x74, 0xB5,
+    0x93, 0xD7, 0xF7, 0x81, 0x0E, 0x41, 0x31, 0x2E, 0xA9, 0x3D, 0x87, 0x8E, 0x3C, 0x42, 0x43, 0xA0,
+    0x41, 0x68, 0xB2, 0x6A, 0xD2, 0x86, 0xD0, 0x10, 0xE8, 0xF8, 0x0C, 0x9A, 0x4C, 0xD7, 0x44, 0xB5,
+    0xC8, 0xA1, 0x2D, 0x56, 0x09, 0xA3, 0x21, 0x34, 0x04, 0x1A, 0x17, 0x40, 0x73, 0x7F, 0x74, 0x60,
+    0x58, 0xBD, 0x3B, 0x46, 0x7D, 0x6E, 0xBE, 0x30, 0x15, 0x7F, 0x46, 0x1D, 0xEA, 0xD2, 0x3A, 0x0B,
+    0x72, 0x21, 0x65, 0x7E, 0x8E, 0x30, 0x6F, 0xDC, 0x35, 0x75, 0x60, 0x4A, 0x8B, 0x15, 0x65, 0xDA,
+    0x3B, 0x5A, 0x7D, 0x4F, 0x7A, 0x3C, 0x3C, 0x03, 0xC7, 0x8B, 0xA1, 0x65, 0xF1, 0x29, 0x39, 0x18,
+    0x6D, 0x10, 0x3A, 0x41, 0xC5, 0x2F, 0x31, 0x8E, 0xD2, 0x3A, 0x6B, 0x71, 0x81, 0x9B, 0x4F, 0xE8,
+    0x0A, 0x08, 0xAD, 0xC9, 0x9A, 0xD5, 0x49, 0x68, 0xB2, 0xEE, 0x09, 0xEB, 0xBF, 0x42, 0xB3, 0xCF,
+    0xB3, 0xEF, 0x32, 0x0D, 0xDC, 0x17, 0x3F, 0xF9, 0x37, 0x71, 0xFC, 0xC1, 0x8F, 0xFB, 0x1D, 0x6B,
+    0x4F, 0x98, 0x24, 0x73, 0x79, 0xBF, 0xFF, 0x7E, 0x0C, 0x63, 0x18, 0x2F, 0xA7, 0x41, 0xEA, 0x7F,
+    0xCD, 0xDC, 0xCC, 0xCD, 0xBB, 0xC8, 0x07, 0xC7, 0x63, 0x58, 0xCE, 0xC3, 0x3B, 0x83, 0x87, 0x53,
+    0xC6, 0x5C, 0xC6, 0x7A, 0x59, 0x84, 0xFA, 0x60, 0xE6, 0xD9, 0x98, 0xE0, 0x36, 0xAC, 0x91, 0x83,
+    0x6C, 0x7B, 0x61, 0x22, 0xA5, 0xF0, 0x32, 0x97, 0xF1, 0x9B, 0x4D, 0x38, 0x26, 0x9D, 0x3C, 0xB4,
+    0x39, 0x6A, 0x7D, 0xC5, 0x4B, 0xA4, 0xC3, 0x6B, 0xC9, 0x2E, 0xDB, 0x3E, 0x94, 0x3D, 0xB4, 0x72,
+    0x3F, 0x9C, 0x52, 0x43, 0x41, 0xFE, 0x11, 0x1E, 0xC8, 0xA8, 0x32, 0xA9, 0x3D, 0x54, 0x84, 0xEA,
+    0xE0, 0x66, 0x2A, 0x62, 0x1C, 0x46, 0xFB, 0x0B,
+};
+
+static const uint32_t bookerly_12_italicBlockOffsets[26] = {
+    0, 1299, 2486, 3768, 4935, 5870, 6910, 7839,
+    8839, 9833, 10989, 12048, 13091, 14226, 15420, 16750,
+    18019, 19226, 20411, 21564, 22776, 23729, 24847, 26186,
+    27239, 27992,
+};
+
+static const uint16_t bookerly_12_italicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_italicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_12_italicPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_12_italicGlyphs[] = {
@@ -3147,711 +1969,711 @@ static const EpdGlyph bookerly_12_italicGlyphs[] = {
     { 16, 19, 16, -1, 18, 76, 1803 }, // B
     { 15, 19, 16, 1, 18, 72, 1879 }, // C
     { 19, 19, 18, -1, 18, 91, 1951 }, // D
-    { 17, 18, 15, -1, 18, 77, 2042 }, // E
-    { 16, 18, 14, -1, 18, 72, 2119 }, // F
-    { 16, 19, 18, 1, 18, 76, 2191 }, // G
-    { 22, 18, 20, -1, 18, 99, 2267 }, // H
-    { 11, 18, 9, -1, 18, 50, 2366 }, // I
-    { 16, 23, 9, -5, 18, 92, 2416 }, // J
-    { 20, 19, 18, -1, 18, 95, 2508 }, // K
-    { 15, 18, 14, -1, 18, 68, 2603 }, // L
-    { 25, 18, 23, -2, 18, 113, 2671 }, // M
-    { 21, 19, 19, -1, 18, 100, 2784 }, // N
-    { 17, 19, 18, 1, 18, 81, 2884 }, // O
-    { 16, 18, 15, -1, 18, 72, 2965 }, // P
-    { 21, 24, 18, 1, 18, 126, 3037 }, // Q
-    { 17, 19, 16, -1, 18, 81, 3163 }, // R
-    { 13, 19, 13, 0, 18, 62, 3244 }, // S
-    { 15, 18, 16, 2, 18, 68, 3306 }, // T
-    { 18, 19, 19, 2, 18, 86, 3374 }, // U
-    { 19, 19, 18, 1, 18, 91, 3460 }, // V
-    { 26, 19, 26, 2, 18, 124, 3551 }, // W
-    { 20, 18, 17, -2, 18, 90, 3675 }, // X
-    { 17, 18, 16, 1, 18, 77, 3765 }, // Y
-    { 16, 19, 15, -1, 18, 76, 3842 }, // Z
-    { 10, 24, 8, -1, 20, 60, 3918 }, // [
-    { 10, 20, 12, 1, 18, 50, 3978 }, // <backslash>
-    { 10, 24, 8, -1, 20, 60, 4028 }, // ]
-    { 12, 12, 16, 2, 16, 36, 4088 }, // ^
-    { 13, 2, 13, 0, -1, 7, 4124 }, // _
-    { 5, 7, 15, 5, 21, 9, 4131 }, // `
-    { 13, 15, 15, 1, 14, 49, 4140 }, // a
-    { 13, 21, 14, 0, 20, 69, 4189 }, // b
-    { 10, 15, 11, 1, 14, 38, 4258 }, // c
-    { 14, 21, 15, 1, 20, 74, 4296 }, // d
-    { 11, 15, 12, 1, 14, 42, 4370 }, // e
-    { 18, 26, 10, -5, 20, 117, 4412 }, // f
-    { 17, 20, 12, -3, 14, 85, 4529 }, // g
-    { 15, 21, 15, 0, 20, 79, 4614 }, // h
-    { 7, 21, 8, 1, 20, 37, 4693 }, // i
-    { 13, 26, 7, -5, 20, 85, 4730 }, // j
-    { 12, 21, 13, 1, 20, 63, 4815 }, // k
-    { 7, 21, 8, 1, 20, 37, 4878 }, // l
-    { 21, 15, 22, 1, 14, 79, 4915 }, // m
-    { 14, 15, 15, 1, 14, 53, 4994 }, // n
-    { 12, 15, 14, 1, 14, 45, 5047 }, // o
-    { 16, 20, 14, -2, 14, 80, 5092 }, // p
-    { 13, 20, 14, 1, 14, 65, 5172 }, // q
-    { 11, 14, 11, 1, 14, 39, 5237 }, // r
-    { 10, 15, 10, 0, 14, 38, 5276 }, // s
-    { 10, 18, 10, 0, 17, 45, 5314 }, // t
-    { 14, 14, 15, 1, 13, 49, 5359 }, // u
-    { 13, 15, 13, 0, 14, 49, 5408 }, // v
-    { 19, 15, 19, 0, 14, 72, 5457 }, // w
-    { 16, 15, 14, -1, 14, 60, 5529 }, // x
-    { 16, 20, 13, -3, 14, 80, 5589 }, // y
-    { 12, 14, 12, 0, 13, 42, 5669 }, // z
-    { 10, 25, 10, 1, 20, 63, 5711 }, // {
-    { 7, 23, 7, 0, 20, 41, 5774 }, // |
-    { 10, 25, 10, -1, 20, 63, 5815 }, // }
-    { 12, 5, 16, 2, 11, 15, 5878 }, // ~
-    { 0, 0, 5, 0, 0, 0, 5893 }, //  
-    { 8, 20, 8, -1, 14, 40, 5893 }, // ¡
-    { 12, 25, 16, 2, 20, 75, 5933 }, // ¢
-    { 17, 19, 16, -1, 18, 81, 6008 }, // £
-    { 16, 13, 16, 0, 15, 52, 6089 }, // ¤
-    { 17, 18, 16, 1, 18, 77, 6141 }, // ¥
-    { 7, 23, 7, 0, 20, 41, 6218 }, // ¦
-    { 12, 21, 12, 0, 18, 63, 6259 }, // §
-    { 9, 4, 15, 3, 19, 9, 6322 }, // ¨
-    { 19, 19, 20, 0, 18, 91, 6331 }, // ©
-    { 10, 12, 11, 1, 18, 30, 6422 }, // ª
-    { 13, 10, 13, 0, 11, 33, 6452 }, // «
-    { 11, 7, 16, 2, 12, 20, 6485 }, // ¬
-    { 8, 3, 9, 1, 8, 6, 6505 }, // ­
-    { 14, 14, 15, 0, 20, 49, 6511 }, // ®
-    { 9, 3, 15, 3, 18, 7, 6560 }, // ¯
-    { 9, 9, 13, 2, 18, 21, 6567 }, // °
-    { 11, 15, 16, 2, 15, 42, 6588 }, // ±
-    { 10, 12, 11, 0, 21, 30, 6630 }, // ²
-    { 9, 12, 11, 1, 21, 27, 6660 }, // ³
-    { 6, 7, 15, 5, 21, 11, 6687 }, // ´
-    { 16, 21, 15, -1, 14, 84, 6698 }, // µ
-    { 16, 22, 15, -1, 18, 88, 6782 }, // ¶
-    { 4, 4, 8, 2, 9, 4, 6870 }, // ·
-    { 6, 6, 15, 5, -1, 9, 6874 }, // ¸
-    { 7, 12, 11, 2, 21, 21, 6883 }, // ¹
-    { 10, 12, 11, 1, 18, 30, 6904 }, // º
-    { 12, 10, 13, 0, 11, 30, 6934 }, // »
-    { 24, 21, 27, 2, 19, 126, 6964 }, // ¼
-    { 24, 21, 27, 2, 19, 126, 7090 }, // ½
-    { 25, 21, 27, 1, 19, 132, 7216 }, // ¾
-    { 9, 20, 10, 0, 14, 45, 7348 }, // ¿
-    { 19, 24, 18, -2, 24, 114, 7393 }, // À
-    { 19, 24, 18, -2, 24, 114, 7507 }, // Á
-    { 19, 24, 18, -2, 24, 114, 7621 }, // Â
-    { 19, 24, 18, -2, 24, 114, 7735 }, // Ã
-    { 19, 23, 18, -2, 23, 110, 7849 }, // Ä
-    { 19, 25, 18, -2, 25, 119, 7959 }, // Å
-    { 25, 18, 22, -2, 18, 113, 8078 }, // Æ
-    { 15, 25, 16, 1, 18, 94, 8191 }, // Ç
-    { 17, 24, 15, -1, 24, 102, 8285 }, // È
-    { 17, 24, 15, -1, 24, 102, 8387 }, // É
-    { 17, 24, 15, -1, 24, 102, 8489 }, // Ê
-    { 17, 23, 15, -1, 23, 98, 8591 }, // Ë
-    { 11, 24, 9, -1, 24, 66, 8689 }, // Ì
-    { 12, 24, 9, -1, 24, 72, 8755 }, // Í
-    { 13, 24, 9, -1, 24, 78, 8827 }, // Î
-    { 13, 23, 9, -1, 23, 75, 8905 }, // Ï
-    { 19, 19, 18, -1, 18, 91, 8980 }, // Ð
-    { 21, 25, 19, -1, 24, 132, 9071 }, // Ñ
-    { 17, 25, 18, 1, 24, 107, 9203 }, // Ò
-    { 17, 25, 18, 1, 24, 107, 9310 }, // Ó
-    { 17, 25, 18, 1, 24, 107, 9417 }, // Ô
-    { 17, 25, 18, 1, 24, 107, 9524 }, // Õ
-    { 17, 24, 18, 1, 23, 102, 9631 }, // Ö
-    { 10, 11, 16, 3, 14, 28, 9733 }, // ×
-    { 20, 19, 18, -1, 18, 95, 9761 }, // Ø
-    { 18, 25, 19, 2, 24, 113, 9856 }, // Ù
-    { 18, 25, 19, 2, 24, 113, 9969 }, // Ú
-    { 18, 25, 19, 2, 24, 113, 10082 }, // Û
-    { 18, 24, 19, 2, 23, 108, 10195 }, // Ü
-    { 17, 24, 16, 1, 24, 102, 10303 }, // Ý
-    { 15, 18, 15, -1, 18, 68, 10405 }, // Þ
-    { 20, 26, 16, -4, 20, 130, 10473 }, // ß
-    { 13, 22, 15, 1, 21, 72, 10603 }, // à
-    { 13, 22, 15, 1, 21, 72, 10675 }, // á
-    { 13, 22, 15, 1, 21, 72, 10747 }, // â
-    { 13, 21, 15, 1, 20, 69, 10819 }, // ã
-    { 13, 20, 15, 1, 19, 65, 10888 }, // ä
-    { 13, 22, 15, 1, 21, 72, 10953 }, // å
-    { 18, 15, 19, 1, 14, 68, 11025 }, // æ
-    { 10, 21, 11, 1, 14, 53, 11093 }, // ç
-    { 11, 22, 12, 1, 21, 61, 11146 }, // è
-    { 11, 22, 12, 1, 21, 61, 11207 }, // é
-    { 11, 22, 12, 1, 21, 61, 11268 }, // ê
-    { 12, 20, 12, 1, 19, 60, 11329 }, // ë
-    { 7, 22, 8, 1, 21, 39, 11389 }, // ì
-    { 9, 22, 8, 1, 21, 50, 11428 }, // í
-    { 9, 22, 8, 1, 21, 50, 11478 }, // î
-    { 10, 20, 8, 1, 19, 50, 11528 }, // ï
-    { 13, 21, 14, 0, 20, 69, 11578 }, // ð
-    { 14, 21, 15, 1, 20, 74, 11647 }, // ñ
-    { 12, 22, 14, 1, 21, 66, 11721 }, // ò
-    { 12, 22, 14, 1, 21, 66, 11787 }, // ó
-    { 12, 22, 14, 1, 21, 66, 11853 }, // ô
-    { 13, 21, 14, 1, 20, 69, 11919 }, // õ
-    { 13, 20, 14, 1, 19, 65, 11988 }, // ö
-    { 11, 13, 16, 2, 15, 36, 12053 }, // ÷
-    { 16, 15, 14, -1, 14, 60, 12089 }, // ø
-    { 14, 22, 15, 1, 21, 77, 12149 }, // ù
-    { 14, 22, 15, 1, 21, 77, 12226 }, // ú
-    { 14, 22, 15, 1, 21, 77, 12303 }, // û
-    { 14, 20, 15, 1, 19, 70, 12380 }, // ü
-    { 16, 27, 13, -3, 21, 108, 12450 }, // ý
-    { 15, 26, 14, -2, 20, 98, 12558 }, // þ
-    { 16, 25, 13, -3, 19, 100, 12656 }, // ÿ
-    { 19, 23, 18, -2, 23, 110, 12756 }, // Ā
-    { 13, 19, 15, 1, 18, 62, 12866 }, // ā
-    { 19, 24, 18, -2, 24, 114, 12928 }, // Ă
-    { 13, 21, 15, 1, 20, 69, 13042 }, // ă
-    { 19, 24, 18, -2, 18, 114, 13111 }, // Ą
-    { 13, 20, 15, 1, 14, 65, 13225 }, // ą
-    { 15, 25, 16, 1, 24, 94, 13290 }, // Ć
-    { 11, 22, 11, 1, 21, 61, 13384 }, // ć
-    { 15, 25, 16, 1, 24, 94, 13445 }, // Ĉ
-    { 11, 22, 11, 1, 21, 61, 13539 }, // ĉ
-    { 15, 25, 16, 1, 24, 94, 13600 }, // Ċ
-    { 10, 20, 11, 1, 19, 50, 13694 }, // ċ
-    { 16, 26, 16, 1, 25, 104, 13744 }, // Č
-    { 12, 22, 11, 1, 21, 66, 13848 }, // č
-    { 19, 26, 18, -1, 25, 124, 13914 }, // Ď
-    { 18, 23, 15, 1, 22, 104, 14038 }, // ď
-    { 19, 19, 18, -1, 18, 91, 14142 }, // Đ
-    { 15, 21, 15, 1, 20, 79, 14233 }, // đ
-    { 17, 23, 15, -1, 23, 98, 14312 }, // Ē
-    { 12, 19, 12, 1, 18, 57, 14410 }, // ē
-    { 17, 24, 15, -1, 24, 102, 14467 }, // Ĕ
-    { 12, 21, 12, 1, 20, 63, 14569 }, // ĕ
-    { 17, 24, 15, -1, 24, 102, 14632 }, // Ė
-    { 11, 20, 12, 1, 19, 55, 14734 }, // ė
-    { 17, 24, 15, -1, 18, 102, 14789 }, // Ę
-    { 11, 20, 12, 1, 14, 55, 14891 }, // ę
-    { 17, 25, 15, -1, 25, 107, 14946 }, // Ě
-    { 12, 22, 12, 1, 21, 66, 15053 }, // ě
-    { 17, 25, 18, 1, 24, 107, 15119 }, // Ĝ
-    { 17, 27, 12, -3, 21, 115, 15226 }, // ĝ
-    { 17, 25, 18, 1, 24, 107, 15341 }, // Ğ
-    { 17, 26, 12, -3, 20, 111, 15448 }, // ğ
-    { 17, 25, 18, 1, 24, 107, 15559 }, // Ġ
-    { 17, 25, 12, -3, 19, 107, 15666 }, // ġ
-    { 17, 25, 18, 1, 18, 107, 15773 }, // Ģ
-    { 17, 28, 12, -3, 22, 119, 15880 }, // ģ
-    { 22, 24, 20, -1, 24, 132, 15999 }, // Ĥ
-    { 15, 27, 15, 0, 26, 102, 16131 }, // ĥ
-    { 22, 18, 20, -1, 18, 99, 16233 }, // Ħ
-    { 15, 21, 15, 0, 20, 79, 16332 }, // ħ
-    { 13, 24, 9, -1, 24, 78, 16411 }, // Ĩ
-    { 10, 21, 8, 1, 20, 53, 16489 }, // ĩ
-    { 13, 23, 9, -1, 23, 75, 16542 }, // Ī
-    { 10, 19, 8, 1, 18, 48, 16617 }, // ī
-    { 13, 24, 9, -1, 24, 78, 16665 }, // Ĭ
-    { 10, 21, 8, 1, 20, 53, 16743 }, // ĭ
-    { 11, 24, 9, -1, 18, 66, 16796 }, // Į
-    { 7, 26, 8, 1, 20, 46, 16862 }, // į
-    { 11, 24, 9, -1, 24, 66, 16908 }, // İ
-    { 6, 14, 8, 1, 13, 21, 16974 }, // ı
-    { 21, 23, 18, -1, 18, 121, 16995 }, // Ĳ
-    { 15, 26, 15, 1, 20, 98, 17116 }, // ĳ
-    { 17, 29, 9, -5, 24, 124, 17214 }, // Ĵ
-    { 15, 27, 7, -5, 21, 102, 17338 }, // ĵ
-    { 20, 25, 18, -1, 18, 125, 17440 }, // Ķ
-    { 12, 27, 13, 1, 20, 81, 17565 }, // ķ
-    { 12, 15, 14, 1, 14, 45, 17646 }, // ĸ
-    { 15, 24, 14, -1, 24, 90, 17691 }, // Ĺ
-    { 9, 27, 8, 1, 26, 61, 17781 }, // ĺ
-    { 15, 25, 14, -1, 18, 94, 17842 }, // Ļ
-    { 9, 27, 8, -1, 20, 61, 17936 }, // ļ
-    { 16, 20, 14, -1, 20, 80, 17997 }, // Ľ
-    { 11, 23, 8, 1, 22, 64, 18077 }, // ľ
-    { 16, 18, 15, -1, 18, 72, 18141 }, // Ŀ
-    { 10, 21, 10, 1, 20, 53, 18213 }, // ŀ
-    { 15, 18, 14, -1, 18, 68, 18266 }, // Ł
-    { 10, 21, 8, -1, 20, 53, 18334 }, // ł
-    { 21, 25, 19, -1, 24, 132, 18387 }, // Ń
-    { 14, 22, 15, 1, 21, 77, 18519 }, // ń
-    { 21, 25, 19, -1, 18, 132, 18596 }, // Ņ
-    { 14, 21, 15, 1, 14, 74, 18728 }, // ņ
-    { 21, 26, 19, -1, 25, 137, 18802 }, // Ň
-    { 14, 22, 15, 1, 21, 77, 18939 }, // ň
-    { 19, 20, 21, 1, 19, 95, 19016 }, // ŉ
-    { 21, 23, 19, -1, 18, 121, 19111 }, // Ŋ
-    { 13, 20, 15, 1, 14, 65, 19232 }, // ŋ
-    { 17, 24, 18, 1, 23, 102, 19297 }, // Ō
-    { 13, 19, 14, 1, 18, 62, 19399 }, // ō
-    { 17, 25, 18, 1, 24, 107, 19461 }, // Ŏ
-    { 13, 21, 14, 1, 20, 69, 19568 }, // ŏ
-    { 18, 26, 18, 1, 25, 117, 19637 }, // Ő
-    { 14, 22, 14, 1, 21, 77, 19754 }, // ő
-    { 23, 19, 24, 1, 18, 110, 19831 }, // Œ
-    { 19, 15, 20, 1, 14, 72, 19941 }, // œ
-    { 17, 25, 16, -1, 24, 107, 20013 }, // Ŕ
-    { 11, 21, 11, 1, 21, 58, 20120 }, // ŕ
-    { 17, 25, 16, -1, 18, 107, 20178 }, // Ŗ
-    { 13, 21, 11, -1, 14, 69, 20285 }, // ŗ
-    { 17, 26, 16, -1, 25, 111, 20354 }, // Ř
-    { 12, 21, 11, 1, 21, 63, 20465 }, // ř
-    { 13, 25, 13, 0, 24, 82, 20528 }, // Ś
-    { 11, 22, 10, 0, 21, 61, 20610 }, // ś
-    { 13, 25, 13, 0, 24, 82, 20671 }, // Ŝ
-    { 11, 22, 10, 0, 21, 61, 20753 }, // ŝ
-    { 13, 25, 13, 0, 18, 82, 20814 }, // Ş
-    { 10, 21, 10, 0, 14, 53, 20896 }, // ş
-    { 14, 26, 13, 0, 25, 91, 20949 }, // Š
-    { 12, 22, 10, 0, 21, 66, 21040 }, // š
-    { 15, 25, 16, 2, 18, 94, 21106 }, // Ţ
-    { 10, 24, 10, 0, 17, 60, 21200 }, // ţ
-    { 15, 25, 16, 2, 25, 94, 21260 }, // Ť
-    { 11, 21, 10, 0, 20, 58, 21354 }, // ť
-    { 15, 18, 16, 2, 18, 68, 21412 }, // Ŧ
-    { 10, 18, 10, 0, 17, 45, 21480 }, // ŧ
-    { 18, 25, 19, 2, 24, 113, 21525 }, // Ũ
-    { 14, 21, 15, 1, 20, 74, 21638 }, // ũ
-    { 18, 24, 19, 2, 23, 108, 21712 }, // Ū
-    { 14, 19, 15, 1, 18, 67, 21820 }, // ū
-    { 18, 25, 19, 2, 24, 113, 21887 }, // Ŭ
-    { 14, 21, 15, 1, 20, 74, 22000 }, // ŭ
-    { 18, 26, 19, 2, 25, 117, 22074 }, // Ů
-    { 14, 22, 15, 1, 21, 77, 22191 }, // ů
-    { 18, 26, 19, 2, 25, 117, 22268 }, // Ű
-    { 14, 22, 15, 1, 21, 77, 22385 }, // ű
-    { 18, 24, 19, 2, 18, 108, 22462 }, // Ų
-    { 14, 19, 15, 1, 13, 67, 22570 }, // ų
-    { 26, 25, 26, 2, 24, 163, 22637 }, // Ŵ
-    { 19, 22, 19, 0, 21, 105, 22800 }, // ŵ
-    { 17, 24, 16, 1, 24, 102, 22905 }, // Ŷ
-    { 16, 27, 13, -3, 21, 108, 23007 }, // ŷ
-    { 17, 23, 16, 1, 23, 98, 23115 }, // Ÿ
-    { 16, 25, 15, -1, 24, 100, 23213 }, // Ź
-    { 12, 22, 12, 0, 21, 66, 23313 }, // ź
-    { 16, 25, 15, -1, 24, 100, 23379 }, // Ż
-    { 12, 20, 12, 0, 19, 60, 23479 }, // ż
-    { 16, 26, 15, -1, 25, 104, 23539 }, // Ž
-    { 12, 22, 12, 0, 21, 66, 23643 }, // ž
-    { 18, 26, 10, -5, 20, 117, 23709 }, // ſ
-    { 6, 7, 0, -4, 21, 11, 23826 }, // ̀
-    { 6, 7, 0, -2, 21, 11, 23837 }, // ́
-    { 9, 7, 0, -5, 21, 16, 23848 }, // ̂
-    { 8, 5, 0, -4, 20, 10, 23864 }, // ̃
-    { 8, 3, 0, -4, 18, 6, 23874 }, // ̄
-    { 8, 5, 0, -4, 20, 10, 23880 }, // ̆
-    { 4, 4, 0, -2, 19, 4, 23890 }, // ̇
-    { 10, 4, 0, -5, 19, 10, 23894 }, // ̈
-    { 7, 8, 0, -3, 22, 14, 23904 }, // ̉
-    { 8, 7, 0, -4, 21, 14, 23918 }, // ̊
-    { 10, 7, 0, -4, 21, 18, 23932 }, // ̋
-    { 9, 6, 0, -4, 21, 14, 23950 }, // ̌
-    { 8, 7, 0, -5, 21, 14, 23964 }, // ̏
-    { 9, 5, 0, -5, 20, 12, 23978 }, // ̑
-    { 6, 8, 0, -3, 22, 12, 23990 }, // ̒
-    { 5, 7, 0, -2, 22, 9, 24002 }, // ̓
-    { 5, 7, 0, -3, 22, 9, 24011 }, // ̔
-    { 4, 7, 0, -2, 22, 7, 24020 }, // ̕
-    { 6, 6, 0, -3, 16, 9, 24027 }, // ̛
-    { 4, 4, 0, -2, -2, 4, 24036 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 24040 }, // ̤
-    { 6, 6, 0, -3, -1, 9, 24050 }, // ̥
-    { 5, 6, 0, -3, -1, 8, 24059 }, // ̦
-    { 6, 6, 0, -3, -1, 9, 24067 }, // ̧
-    { 6, 7, 0, -3, 1, 11, 24076 }, // ̨
-    { 5, 6, 7, -1, -1, 8, 24087 }, // ̩
-    { 9, 6, 0, -5, -1, 14, 24095 }, // ̭
-    { 8, 5, 0, -4, -1, 10, 24109 }, // ̮
-    { 8, 5, 0, -4, -1, 10, 24119 }, // ̰
-    { 8, 3, 0, -4, -2, 6, 24129 }, // ̱
-    { 9, 5, 0, -5, 20, 12, 24135 }, // ͂
-    { 9, 10, 0, -5, 25, 23, 24147 }, // ̈́
-    { 5, 5, 0, -2, -1, 7, 24170 }, // ͅ
-    { 17, 24, 15, -1, 24, 102, 24177 }, // Ѐ
-    { 17, 23, 15, -1, 23, 98, 24279 }, // Ё
-    { 16, 24, 19, 2, 18, 96, 24377 }, // Ђ
-    { 16, 24, 14, -1, 24, 96, 24473 }, // Ѓ
-    { 15, 19, 16, 1, 18, 72, 24569 }, // Є
-    { 13, 19, 13, 0, 18, 62, 24641 }, // Ѕ
-    { 11, 18, 9, -1, 18, 50, 24703 }, // І
-    { 13, 23, 9, -1, 23, 75, 24753 }, // Ї
-    { 16, 23, 9, -5, 18, 92, 24828 }, // Ј
-    { 24, 19, 22, -2, 18, 114, 24920 }, // Љ
-    { 24, 19, 23, -1, 18, 114, 25034 }, // Њ
-    { 16, 18, 20, 2, 18, 72, 25148 }, // Ћ
-    { 19, 25, 17, -1, 24, 119, 25220 }, // Ќ
-    { 22, 24, 20, -1, 24, 132, 25339 }, // Ѝ
-    { 18, 26, 16, 0, 25, 117, 25471 }, // Ў
-    { 21, 24, 19, -1, 18, 126, 25588 }, // Џ
-    { 19, 18, 18, -2, 18, 86, 25714 }, // А
-    { 16, 19, 15, -1, 18, 76, 25800 }, // Б
-    { 16, 19, 16, -1, 18, 76, 25876 }, // В
-    { 16, 18, 14, -1, 18, 72, 25952 }, // Г
-    { 21, 24, 18, -2, 18, 126, 26024 }, // Д
-    { 17, 18, 15, -1, 18, 77, 26150 }, // Е
-    { 27, 19, 24, -2, 18, 129, 26227 }, // Ж
-    { 13, 19, 14, 0, 18, 62, 26356 }, // З
-    { 22, 18, 20, -1, 18, 99, 26418 }, // И
-    { 22, 25, 20, -1, 25, 138, 26517 }, // Й
-    { 19, 19, 17, -1, 18, 91, 26655 }, // К
-    { 20, 19, 17, -2, 18, 95, 26746 }, // Л
-    { 25, 18, 23, -2, 18, 113, 26841 }, // М
-    { 22, 18, 20, -1, 18, 99, 26954 }, // Н
-    { 17, 19, 18, 1, 18, 81, 27053 }, // О
-    { 21, 18, 19, -1, 18, 95, 27134 }, // П
-    { 16, 18, 15, -1, 18, 72, 27229 }, // Р
-    { 15, 19, 16, 1, 18, 72, 27301 }, // С
-    { 15, 18, 16, 2, 18, 68, 27373 }, // Т
-    { 18, 19, 16, 0, 18, 86, 27441 }, // У
-    { 18, 19, 18, 0, 18, 86, 27527 }, // Ф
-    { 20, 18, 17, -2, 18, 90, 27613 }, // Х
-    { 21, 24, 19, -1, 18, 126, 27703 }, // Ц
-    { 17, 18, 17, 1, 18, 77, 27829 }, // Ч
-    { 27, 18, 25, -1, 18, 122, 27906 }, // Ш
-    { 27, 24, 25, -1, 18, 162, 28028 }, // Щ
-    { 15, 19, 17, 2, 18, 72, 28190 }, // Ъ
-    { 25, 19, 23, -1, 18, 119, 28262 }, // Ы
-    { 15, 19, 15, -1, 18, 72, 28381 }, // Ь
-    { 15, 19, 15, 0, 18, 72, 28453 }, // Э
-    { 26, 19, 25, -1, 18, 124, 28525 }, // Ю
-    { 19, 19, 16, -2, 18, 91, 28649 }, // Я
-    { 13, 15, 15, 1, 14, 49, 28740 }, // а
-    { 14, 21, 14, 1, 20, 74, 28789 }, // б
-    { 11, 15, 13, 1, 14, 42, 28863 }, // в
-    { 11, 15, 11, 0, 14, 42, 28905 }, // г
-    { 12, 21, 14, 1, 20, 63, 28947 }, // д
-    { 11, 15, 12, 1, 14, 42, 29010 }, // е
-    { 22, 15, 22, 0, 14, 83, 29052 }, // ж
-    { 11, 15, 11, 0, 14, 42, 29135 }, // з
-    { 14, 14, 15, 1, 13, 49, 29177 }, // и
-    { 14, 21, 15, 1, 20, 74, 29226 }, // й
-    { 13, 15, 14, 1, 14, 49, 29300 }, // к
-    { 16, 15, 15, -1, 14, 60, 29349 }, // л
-    { 19, 15, 19, 0, 14, 72, 29409 }, // м
-    { 14, 14, 15, 1, 13, 49, 29481 }, // н
-    { 12, 15, 14, 1, 14, 45, 29530 }, // о
-    { 14, 15, 15, 1, 14, 53, 29575 }, // п
-    { 16, 20, 14, -2, 14, 80, 29628 }, // р
-    { 10, 15, 11, 1, 14, 38, 29708 }, // с
-    { 21, 15, 22, 1, 14, 79, 29746 }, // т
-    { 16, 20, 13, -3, 14, 80, 29825 }, // у
-    { 16, 26, 17, 1, 20, 104, 29905 }, // ф
-    { 16, 15, 14, -1, 14, 60, 30009 }, // х
-    { 14, 18, 15, 1, 13, 63, 30069 }, // ц
-    { 13, 14, 15, 1, 13, 46, 30132 }, // ч
-    { 20, 14, 21, 1, 13, 70, 30178 }, // ш
-    { 20, 18, 21, 1, 13, 90, 30248 }, // щ
-    { 13, 15, 13, 0, 14, 49, 30338 }, // ъ
-    { 18, 14, 19, 0, 13, 63, 30387 }, // ы
-    { 11, 14, 12, 0, 13, 39, 30450 }, // ь
-    { 11, 15, 12, 0, 14, 42, 30489 }, // э
-    { 18, 15, 20, 1, 14, 68, 30531 }, // ю
-    { 14, 14, 14, -1, 13, 49, 30599 }, // я
-    { 11, 22, 12, 1, 21, 61, 30648 }, // ѐ
-    { 12, 20, 12, 1, 19, 60, 30709 }, // ё
-    { 13, 26, 14, 0, 20, 85, 30769 }, // ђ
-    { 11, 22, 11, 0, 21, 61, 30854 }, // ѓ
-    { 11, 15, 12, 1, 14, 42, 30915 }, // є
-    { 10, 15, 10, 0, 14, 38, 30957 }, // ѕ
-    { 7, 21, 8, 1, 20, 37, 30995 }, // і
-    { 10, 20, 8, 1, 19, 50, 31032 }, // ї
-    { 13, 26, 7, -5, 20, 85, 31082 }, // ј
-    { 19, 15, 18, -1, 14, 72, 31167 }, // љ
-    { 16, 14, 18, 1, 13, 56, 31239 }, // њ
-    { 15, 21, 15, 0, 20, 79, 31295 }, // ћ
-    { 13, 22, 14, 1, 21, 72, 31374 }, // ќ
-    { 14, 22, 15, 1, 21, 77, 31446 }, // ѝ
-    { 16, 26, 13, -3, 20, 104, 31523 }, // ў
-    { 14, 18, 15, 1, 13, 63, 31627 }, // џ
-    { 15, 21, 17, 1, 20, 79, 31690 }, // Ѣ
-    { 17, 15, 18, 1, 14, 64, 31769 }, // ѣ
-    { 17, 19, 18, 1, 18, 81, 31833 }, // Ѳ
-    { 12, 15, 14, 1, 14, 45, 31914 }, // ѳ
-    { 18, 19, 18, 2, 18, 86, 31959 }, // Ѵ
-    { 15, 15, 14, 0, 14, 57, 32045 }, // ѵ
-    { 22, 31, 20, -1, 25, 171, 32102 }, // Ҋ
-    { 14, 25, 15, 1, 20, 88, 32273 }, // ҋ
-    { 15, 19, 15, -1, 18, 72, 32361 }, // Ҍ
-    { 11, 19, 12, 1, 18, 53, 32433 }, // ҍ
-    { 16, 18, 15, -1, 18, 72, 32486 }, // Ҏ
-    { 16, 20, 14, -2, 14, 80, 32558 }, // ҏ
-    { 17, 21, 14, -1, 21, 90, 32638 }, // Ґ
-    { 13, 18, 11, 0, 17, 59, 32728 }, // ґ
-    { 16, 18, 14, -1, 18, 72, 32787 }, // Ғ
-    { 11, 15, 11, 0, 14, 42, 32859 }, // ғ
-    { 16, 24, 15, -1, 18, 96, 32901 }, // Ҕ
-    { 12, 19, 13, 1, 13, 57, 32997 }, // ҕ
-    { 27, 24, 24, -2, 18, 162, 33054 }, // Җ
-    { 22, 19, 22, 0, 14, 105, 33216 }, // җ
-    { 13, 24, 14, 0, 18, 78, 33321 }, // Ҙ
-    { 11, 19, 11, 0, 14, 53, 33399 }, // ҙ
-    { 19, 24, 17, -1, 18, 114, 33452 }, // Қ
-    { 13, 19, 14, 1, 14, 62, 33566 }, // қ
-    { 20, 19, 18, -1, 18, 95, 33628 }, // Ҝ
-    { 14, 15, 15, 1, 14, 53, 33723 }, // ҝ
-    { 19, 19, 17, -1, 18, 91, 33776 }, // Ҟ
-    { 13, 19, 14, 1, 18, 62, 33867 }, // ҟ
-    { 19, 19, 20, 2, 18, 91, 33929 }, // Ҡ
-    { 15, 15, 15, 0, 14, 57, 34020 }, // ҡ
-    { 22, 24, 20, -1, 18, 132, 34077 }, // Ң
-    { 14, 18, 16, 1, 13, 63, 34209 }, // ң
-    { 25, 18, 23, -1, 18, 113, 34272 }, // Ҥ
-    { 17, 14, 18, 1, 13, 60, 34385 }, // ҥ
-    { 26, 24, 26, -1, 18, 156, 34445 }, // Ҧ
-    { 20, 20, 21, 1, 14, 100, 34601 }, // ҧ
-    { 19, 19, 20, 1, 18, 91, 34701 }, // Ҩ
-    { 15, 15, 16, 1, 14, 57, 34792 }, // ҩ
-    { 15, 24, 16, 1, 18, 90, 34849 }, // Ҫ
-    { 10, 19, 11, 1, 14, 48, 34939 }, // ҫ
-    { 15, 24, 16, 2, 18, 90, 34987 }, // Ҭ
-    { 21, 19, 22, 1, 14, 100, 35077 }, // ҭ
-    { 17, 18, 16, 1, 18, 77, 35177 }, // Ү
-    { 13, 20, 13, 0, 14, 65, 35254 }, // ү
-    { 17, 18, 16, 1, 18, 77, 35319 }, // Ұ
-    { 13, 20, 13, 0, 14, 65, 35396 }, // ұ
-    { 20, 24, 17, -2, 18, 120, 35461 }, // Ҳ
-    { 16, 19, 14, -1, 14, 76, 35581 }, // ҳ
-    { 21, 24, 21, 1, 18, 126, 35657 }, // Ҵ
-    { 14, 23, 15, 1, 18, 81, 35783 }, // ҵ
-    { 17, 24, 17, 1, 18, 102, 35864 }, // Ҷ
-    { 14, 18, 15, 1, 13, 63, 35966 }, // ҷ
-    { 17, 18, 17, 1, 18, 77, 36029 }, // Ҹ
-    { 13, 14, 15, 1, 13, 46, 36106 }, // ҹ
-    { 16, 18, 17, -1, 18, 72, 36152 }, // Һ
-    { 15, 21, 15, 0, 20, 79, 36224 }, // һ
-    { 18, 19, 20, 1, 18, 86, 36303 }, // Ҽ
-    { 14, 15, 14, 0, 14, 53, 36389 }, // ҽ
-    { 18, 24, 20, 1, 18, 108, 36442 }, // Ҿ
-    { 14, 19, 14, 0, 14, 67, 36550 }, // ҿ
-    { 11, 18, 9, -1, 18, 50, 36617 }, // Ӏ
-    { 27, 26, 24, -2, 25, 176, 36667 }, // Ӂ
-    { 22, 21, 22, 0, 20, 116, 36843 }, // ӂ
-    { 19, 24, 17, -1, 18, 114, 36959 }, // Ӄ
-    { 12, 20, 14, 1, 14, 60, 37073 }, // ӄ
-    { 20, 24, 17, -2, 18, 120, 37133 }, // Ӆ
-    { 16, 19, 15, -1, 14, 76, 37253 }, // ӆ
-    { 22, 24, 20, -1, 18, 132, 37329 }, // Ӈ
-    { 13, 19, 14, 1, 13, 62, 37461 }, // ӈ
-    { 22, 24, 20, -1, 18, 132, 37523 }, // Ӊ
-    { 14, 18, 16, 1, 13, 63, 37655 }, // ӊ
-    { 17, 24, 17, 1, 18, 102, 37718 }, // Ӌ
-    { 13, 18, 14, 1, 13, 59, 37820 }, // ӌ
-    { 25, 24, 23, -2, 18, 150, 37879 }, // Ӎ
-    { 19, 19, 19, 0, 14, 91, 38029 }, // ӎ
-    { 11, 20, 8, -1, 20, 55, 38120 }, // ӏ
-    { 19, 25, 18, -2, 25, 119, 38175 }, // Ӑ
-    { 13, 21, 15, 1, 20, 69, 38294 }, // ӑ
-    { 19, 23, 18, -2, 23, 110, 38363 }, // Ӓ
-    { 13, 20, 15, 1, 19, 65, 38473 }, // ӓ
-    { 25, 18, 22, -2, 18, 113, 38538 }, // Ӕ
-    { 18, 15, 19, 1, 14, 68, 38651 }, // ӕ
-    { 17, 25, 15, -1, 25, 107, 38719 }, // Ӗ
-    { 12, 21, 12, 1, 20, 63, 38826 }, // ӗ
-    { 15, 19, 16, 0, 18, 72, 38889 }, // Ә
-    { 11, 15, 12, 0, 14, 42, 38961 }, // ә
-    { 15, 24, 16, 0, 23, 90, 39003 }, // Ӛ
-    { 12, 20, 12, 0, 19, 60, 39093 }, // ӛ
-    { 27, 24, 24, -2, 23, 162, 39153 }, // Ӝ
-    { 22, 20, 22, 0, 19, 110, 39315 }, // ӝ
-    { 13, 24, 14, 0, 23, 78, 39425 }, // Ӟ
-    { 12, 20, 11, 0, 19, 60, 39503 }, // ӟ
-    { 16, 19, 14, -1, 18, 76, 39563 }, // Ӡ
-    { 15, 19, 13, -2, 13, 72, 39639 }, // ӡ
-    { 22, 23, 20, -1, 23, 127, 39711 }, // Ӣ
-    { 14, 19, 15, 1, 18, 67, 39838 }, // ӣ
-    { 22, 23, 20, -1, 23, 127, 39905 }, // Ӥ
-    { 14, 20, 15, 1, 19, 70, 40032 }, // ӥ
-    { 17, 24, 18, 1, 23, 102, 40102 }, // Ӧ
-    { 13, 20, 14, 1, 19, 65, 40204 }, // ӧ
-    { 17, 19, 18, 1, 18, 81, 40269 }, // Ө
-    { 12, 15, 14, 1, 14, 45, 40350 }, // ө
-    { 17, 24, 18, 1, 23, 102, 40395 }, // Ӫ
-    { 13, 20, 14, 1, 19, 65, 40497 }, // ӫ
-    { 15, 24, 15, 0, 23, 90, 40562 }, // Ӭ
-    { 12, 20, 12, 0, 19, 60, 40652 }, // ӭ
-    { 18, 24, 16, 0, 23, 108, 40712 }, // Ӯ
-    { 16, 24, 13, -3, 18, 96, 40820 }, // ӯ
-    { 18, 24, 16, 0, 23, 108, 40916 }, // Ӱ
-    { 16, 25, 13, -3, 19, 100, 41024 }, // ӱ
-    { 18, 26, 16, 0, 25, 117, 41124 }, // Ӳ
-    { 16, 27, 13, -3, 21, 108, 41241 }, // ӳ
-    { 17, 23, 17, 1, 23, 98, 41349 }, // Ӵ
-    { 13, 20, 15, 1, 19, 65, 41447 }, // ӵ
-    { 16, 24, 14, -1, 18, 96, 41512 }, // Ӷ
-    { 11, 19, 11, 0, 14, 53, 41608 }, // ӷ
-    { 25, 24, 23, -1, 23, 150, 41661 }, // Ӹ
-    { 18, 20, 19, 0, 19, 90, 41811 }, // ӹ
-    { 16, 24, 14, -1, 18, 96, 41901 }, // Ӻ
-    { 11, 19, 11, 0, 14, 53, 41997 }, // ӻ
-    { 20, 24, 17, -2, 18, 120, 42050 }, // Ӽ
-    { 16, 20, 14, -1, 14, 80, 42170 }, // ӽ
-    { 20, 18, 17, -2, 18, 90, 42250 }, // Ӿ
-    { 16, 15, 14, -1, 14, 60, 42340 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 42400 }, //  
-    { 0, 0, 25, 0, 0, 0, 42400 }, //  
-    { 0, 0, 13, 0, 0, 0, 42400 }, //  
-    { 0, 0, 25, 0, 0, 0, 42400 }, //  
-    { 0, 0, 8, 0, 0, 0, 42400 }, //  
-    { 0, 0, 6, 0, 0, 0, 42400 }, //  
-    { 0, 0, 4, 0, 0, 0, 42400 }, //  
-    { 0, 0, 16, 0, 0, 0, 42400 }, //  
-    { 0, 0, 7, 0, 0, 0, 42400 }, //  
-    { 0, 0, 5, 0, 0, 0, 42400 }, //  
-    { 0, 0, 1, 0, 0, 0, 42400 }, //  
-    { 0, 0, 0, 0, 0, 0, 42400 }, // ​
-    { 2, 21, 0, -1, 15, 11, 42400 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 42411 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 42446 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 42494 }, // ‏
-    { 8, 3, 9, 1, 8, 6, 42542 }, // ‐
-    { 8, 3, 9, 1, 8, 6, 42548 }, // ‑
-    { 12, 3, 16, 2, 10, 9, 42554 }, // ‒
-    { 13, 3, 13, 0, 8, 10, 42563 }, // –
-    { 25, 3, 25, 0, 8, 19, 42573 }, // —
-    { 25, 3, 25, 0, 8, 19, 42592 }, // ―
-    { 8, 26, 13, 2, 20, 52, 42611 }, // ‖
-    { 13, 6, 13, 0, -1, 20, 42663 }, // ‗
-    { 6, 8, 8, 2, 19, 12, 42683 }, // ‘
-    { 6, 8, 8, 1, 19, 12, 42695 }, // ’
-    { 6, 9, 8, 0, 4, 14, 42707 }, // ‚
-    { 5, 8, 6, 1, 19, 10, 42721 }, // ‛
-    { 11, 8, 13, 2, 19, 22, 42731 }, // “
-    { 11, 8, 13, 1, 19, 22, 42753 }, // ”
-    { 11, 9, 13, 0, 4, 25, 42775 }, // „
-    { 10, 8, 11, 1, 19, 20, 42800 }, // ‟
-    { 11, 17, 12, 1, 18, 47, 42820 }, // †
-    { 12, 20, 12, 0, 18, 60, 42867 }, // ‡
-    { 6, 6, 8, 1, 9, 9, 42927 }, // •
-    { 9, 9, 16, 3, 13, 21, 42936 }, // ‣
-    { 5, 4, 7, 1, 3, 5, 42957 }, // ․
-    { 10, 5, 13, 1, 4, 13, 42962 }, // ‥
-    { 21, 5, 25, 2, 4, 27, 42975 }, // …
-    { 5, 4, 7, 1, 9, 5, 43002 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 43007 }, //  
-    { 0, 0, 0, 0, 0, 0, 43007 }, //  
-    { 8, 24, 0, -4, 18, 48, 43007 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 43055 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 43103 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 43151 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 43217 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 43283 }, //  
-    { 32, 21, 34, 1, 19, 168, 43283 }, // ‰
-    { 5, 9, 7, 1, 18, 12, 43451 }, // ′
-    { 10, 9, 11, 1, 18, 23, 43463 }, // ″
-    { 15, 9, 16, 1, 18, 34, 43486 }, // ‴
-    { 6, 9, 7, 0, 18, 14, 43520 }, // ‵
-    { 11, 9, 12, 0, 18, 25, 43534 }, // ‶
-    { 17, 9, 17, 0, 18, 39, 43559 }, // ‷
-    { 11, 6, 12, 1, 0, 17, 43598 }, // ‸
-    { 8, 10, 8, 0, 11, 20, 43615 }, // ‹
-    { 7, 10, 8, 0, 11, 18, 43635 }, // ›
-    { 16, 18, 16, 0, 17, 72, 43653 }, // ※
-    { 14, 20, 14, 1, 19, 70, 43725 }, // ‼
-    { 13, 3, 13, 0, 21, 10, 43795 }, // ‾
-    { 6, 3, 8, 1, 8, 5, 43805 }, // ⁃
-    { 16, 21, 6, -5, 19, 84, 43810 }, // ⁄
-    { 18, 19, 20, 2, 18, 86, 43894 }, // ⁇
-    { 16, 20, 17, 2, 19, 80, 43980 }, // ⁈
-    { 17, 20, 18, 1, 19, 85, 44060 }, // ⁉
-    { 15, 5, 25, 5, 10, 19, 44145 }, // ⁓
-    { 20, 9, 21, 1, 18, 45, 44164 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 44209 }, //  
-    { 0, 0, 0, 0, 0, 0, 44209 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 44209 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 44209 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 44209 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 44209 }, // ⁤
-    { 10, 12, 11, 1, 21, 30, 44209 }, // ⁰
-    { 11, 12, 11, 0, 21, 33, 44239 }, // ⁴
-    { 10, 12, 11, 1, 21, 30, 44272 }, // ⁵
-    { 10, 12, 11, 1, 21, 30, 44302 }, // ⁶
-    { 9, 12, 11, 2, 21, 27, 44332 }, // ⁷
-    { 9, 12, 11, 1, 21, 27, 44359 }, // ⁸
-    { 10, 12, 11, 0, 21, 30, 44386 }, // ⁹
-    { 10, 9, 14, 2, 18, 23, 44416 }, // ⁿ
-    { 10, 12, 11, 1, 8, 30, 44439 }, // ₀
-    { 7, 13, 11, 2, 9, 23, 44469 }, // ₁
-    { 10, 12, 11, 0, 8, 30, 44492 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 44522 }, // ₃
-    { 11, 12, 11, 0, 8, 33, 44549 }, // ₄
-    { 10, 12, 11, 1, 8, 30, 44582 }, // ₅
-    { 10, 12, 11, 1, 8, 30, 44612 }, // ₆
-    { 9, 12, 11, 2, 8, 27, 44642 }, // ₇
-    { 9, 12, 11, 1, 8, 27, 44669 }, // ₈
-    { 10, 12, 11, 0, 8, 30, 44696 }, // ₉
-    { 16, 18, 16, 0, 18, 72, 44726 }, // ₣
-    { 17, 19, 16, -1, 18, 81, 44798 }, // ₤
-    { 30, 19, 31, 0, 18, 143, 44879 }, // ₧
-    { 18, 19, 16, -1, 18, 86, 45022 }, // €
-    { 15, 11, 25, 5, 14, 42, 45108 }, // ←
-    { 11, 17, 25, 7, 17, 47, 45150 }, // ↑
-    { 15, 11, 25, 5, 14, 42, 45197 }, // →
-    { 11, 17, 25, 7, 17, 47, 45239 }, // ↓
-    { 15, 11, 25, 5, 14, 42, 45286 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 45328 }, // ↕
-    { 11, 17, 25, 7, 17, 47, 45375 }, // ↨
-    { 11, 17, 25, 7, 17, 47, 45422 }, // ↲
-    { 11, 17, 25, 7, 17, 47, 45469 }, // ↳
-    { 13, 12, 25, 6, 15, 39, 45516 }, // ↵
-    { 15, 11, 25, 5, 14, 42, 45555 }, // ⇐
-    { 11, 15, 25, 7, 16, 42, 45597 }, // ⇑
-    { 15, 11, 25, 5, 14, 42, 45639 }, // ⇒
-    { 11, 15, 25, 7, 16, 42, 45681 }, // ⇓
-    { 15, 11, 25, 5, 14, 42, 45723 }, // ⇔
-    { 17, 19, 25, 4, 18, 81, 45765 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 45846 }, // ∂
-    { 11, 18, 25, 7, 18, 50, 45915 }, // ∃
-    { 19, 20, 25, 3, 19, 95, 45965 }, // ∅
-    { 16, 18, 16, 0, 18, 72, 46060 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 46132 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 46213 }, // ∈
-    { 17, 22, 25, 4, 19, 94, 46290 }, // ∉
-    { 17, 14, 25, 4, 16, 60, 46384 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 46444 }, // ∋
-    { 17, 22, 25, 4, 19, 94, 46521 }, // ∌
-    { 17, 14, 25, 4, 16, 60, 46615 }, // ∍
-    { 19, 22, 20, 1, 18, 105, 46675 }, // ∏
-    { 15, 23, 15, 0, 18, 87, 46780 }, // ∑
-    { 11, 3, 16, 2, 10, 9, 46867 }, // −
-    { 14, 20, 12, -1, 18, 70, 46876 }, // ∕
-    { 10, 20, 12, 1, 18, 50, 46946 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 46996 }, // ∗
-    { 9, 9, 16, 3, 13, 21, 47035 }, // ∘
-    { 4, 4, 16, 6, 9, 4, 47056 }, // ∙
-    { 16, 24, 16, 0, 21, 96, 47060 }, // √
-    { 13, 10, 16, 1, 13, 33, 47156 }, // ∝
-    { 16, 9, 16, 0, 12, 36, 47189 }, // ∞
-    { 16, 18, 25, 4, 18, 72, 47225 }, // ∟
-    { 18, 18, 25, 3, 18, 81, 47297 }, // ∠
-    { 3, 26, 13, 5, 20, 20, 47378 }, // ∣
-    { 8, 26, 13, 2, 20, 52, 47398 }, // ∥
-    { 17, 18, 25, 4, 18, 77, 47450 }, // ∧
-    { 17, 18, 25, 4, 18, 77, 47527 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 47604 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 47672 }, // ∪
-    { 14, 26, 16, 1, 20, 91, 47744 }, // ∫
-    { 16, 15, 25, 5, 14, 60, 47835 }, // ∴
-    { 16, 15, 25, 5, 14, 60, 47895 }, // ∵
-    { 5, 13, 8, 1, 15, 17, 47955 }, // ∶
-    { 16, 15, 25, 5, 14, 60, 47972 }, // ∷
-    { 15, 5, 25, 5, 10, 19, 48032 }, // ∼
-    { 15, 13, 25, 5, 15, 49, 48051 }, // ≅
-    { 12, 9, 16, 2, 13, 27, 48100 }, // ≈
-    { 15, 8, 25, 5, 11, 30, 48127 }, // ≍
-    { 11, 11, 16, 2, 14, 31, 48157 }, // ≠
-    { 15, 11, 25, 5, 13, 42, 48188 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 48230 }, // ≤
-    { 12, 15, 16, 2, 15, 45, 48275 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 48320 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 48389 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 48458 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 48522 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 48620 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 48718 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 48795 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 48872 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 48963 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 49054 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 49145 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 49236 }, // ⊥
-    { 4, 4, 16, 6, 9, 4, 49304 }, // ⋅
-    { 21, 4, 25, 2, 9, 21, 49308 }, // ⋯
-    { 25, 24, 25, 0, 21, 150, 49329 }, // �
+    { 17, 18, 15, -1, 18, 77, 2048 }, // E
+    { 16, 18, 14, -1, 18, 72, 2125 }, // F
+    { 16, 19, 18, 1, 18, 76, 2197 }, // G
+    { 22, 18, 20, -1, 18, 99, 2273 }, // H
+    { 11, 18, 9, -1, 18, 50, 2372 }, // I
+    { 16, 23, 9, -5, 18, 92, 2422 }, // J
+    { 20, 19, 18, -1, 18, 95, 2514 }, // K
+    { 15, 18, 14, -1, 18, 68, 2609 }, // L
+    { 25, 18, 23, -2, 18, 113, 2677 }, // M
+    { 21, 19, 19, -1, 18, 100, 2790 }, // N
+    { 17, 19, 18, 1, 18, 81, 2890 }, // O
+    { 16, 18, 15, -1, 18, 72, 2971 }, // P
+    { 21, 24, 18, 1, 18, 126, 3043 }, // Q
+    { 17, 19, 16, -1, 18, 81, 3169 }, // R
+    { 13, 19, 13, 0, 18, 62, 3250 }, // S
+    { 15, 18, 16, 2, 18, 68, 3312 }, // T
+    { 18, 19, 19, 2, 18, 86, 3380 }, // U
+    { 19, 19, 18, 1, 18, 91, 3466 }, // V
+    { 26, 19, 26, 2, 18, 124, 3557 }, // W
+    { 20, 18, 17, -2, 18, 90, 3681 }, // X
+    { 17, 18, 16, 1, 18, 77, 3771 }, // Y
+    { 16, 19, 15, -1, 18, 76, 3848 }, // Z
+    { 10, 24, 8, -1, 20, 60, 3924 }, // [
+    { 10, 20, 12, 1, 18, 50, 3984 }, // <backslash>
+    { 10, 24, 8, -1, 20, 60, 4034 }, // ]
+    { 12, 12, 16, 2, 16, 36, 4096 }, // ^
+    { 13, 2, 13, 0, -1, 7, 4132 }, // _
+    { 5, 7, 15, 5, 21, 9, 4139 }, // `
+    { 13, 15, 15, 1, 14, 49, 4148 }, // a
+    { 13, 21, 14, 0, 20, 69, 4197 }, // b
+    { 10, 15, 11, 1, 14, 38, 4266 }, // c
+    { 14, 21, 15, 1, 20, 74, 4304 }, // d
+    { 11, 15, 12, 1, 14, 42, 4378 }, // e
+    { 18, 26, 10, -5, 20, 117, 4420 }, // f
+    { 17, 20, 12, -3, 14, 85, 4537 }, // g
+    { 15, 21, 15, 0, 20, 79, 4622 }, // h
+    { 7, 21, 8, 1, 20, 37, 4701 }, // i
+    { 13, 26, 7, -5, 20, 85, 4738 }, // j
+    { 12, 21, 13, 1, 20, 63, 4823 }, // k
+    { 7, 21, 8, 1, 20, 37, 4886 }, // l
+    { 21, 15, 22, 1, 14, 79, 4923 }, // m
+    { 14, 15, 15, 1, 14, 53, 5002 }, // n
+    { 12, 15, 14, 1, 14, 45, 5055 }, // o
+    { 16, 20, 14, -2, 14, 80, 5100 }, // p
+    { 13, 20, 14, 1, 14, 65, 5180 }, // q
+    { 11, 14, 11, 1, 14, 39, 5245 }, // r
+    { 10, 15, 10, 0, 14, 38, 5284 }, // s
+    { 10, 18, 10, 0, 17, 45, 5322 }, // t
+    { 14, 14, 15, 1, 13, 49, 5367 }, // u
+    { 13, 15, 13, 0, 14, 49, 5416 }, // v
+    { 19, 15, 19, 0, 14, 72, 5465 }, // w
+    { 16, 15, 14, -1, 14, 60, 5537 }, // x
+    { 16, 20, 13, -3, 14, 80, 5597 }, // y
+    { 12, 14, 12, 0, 13, 42, 5677 }, // z
+    { 10, 25, 10, 1, 20, 63, 5719 }, // {
+    { 7, 23, 7, 0, 20, 41, 5782 }, // |
+    { 10, 25, 10, -1, 20, 63, 5823 }, // }
+    { 12, 5, 16, 2, 11, 15, 5886 }, // ~
+    { 0, 0, 5, 0, 0, 0, 5901 }, //  
+    { 8, 20, 8, -1, 14, 40, 5901 }, // ¡
+    { 12, 25, 16, 2, 20, 75, 5941 }, // ¢
+    { 17, 19, 16, -1, 18, 81, 6016 }, // £
+    { 16, 13, 16, 0, 15, 52, 6144 }, // ¤
+    { 17, 18, 16, 1, 18, 77, 6196 }, // ¥
+    { 7, 23, 7, 0, 20, 41, 6273 }, // ¦
+    { 12, 21, 12, 0, 18, 63, 6314 }, // §
+    { 9, 4, 15, 3, 19, 9, 6377 }, // ¨
+    { 19, 19, 20, 0, 18, 91, 6386 }, // ©
+    { 10, 12, 11, 1, 18, 30, 6477 }, // ª
+    { 13, 10, 13, 0, 11, 33, 6507 }, // «
+    { 11, 7, 16, 2, 12, 20, 6540 }, // ¬
+    { 8, 3, 9, 1, 8, 6, 6560 }, // ­
+    { 14, 14, 15, 0, 20, 49, 6566 }, // ®
+    { 9, 3, 15, 3, 18, 7, 6615 }, // ¯
+    { 9, 9, 13, 2, 18, 21, 6622 }, // °
+    { 11, 15, 16, 2, 15, 42, 6643 }, // ±
+    { 10, 12, 11, 0, 21, 30, 6685 }, // ²
+    { 9, 12, 11, 1, 21, 27, 6715 }, // ³
+    { 6, 7, 15, 5, 21, 11, 6742 }, // ´
+    { 16, 21, 15, -1, 14, 84, 6753 }, // µ
+    { 16, 22, 15, -1, 18, 88, 6837 }, // ¶
+    { 4, 4, 8, 2, 9, 4, 6925 }, // ·
+    { 6, 6, 15, 5, -1, 9, 6929 }, // ¸
+    { 7, 12, 11, 2, 21, 21, 6938 }, // ¹
+    { 10, 12, 11, 1, 18, 30, 6959 }, // º
+    { 12, 10, 13, 0, 11, 30, 6989 }, // »
+    { 24, 21, 27, 2, 19, 126, 7019 }, // ¼
+    { 24, 21, 27, 2, 19, 126, 7145 }, // ½
+    { 25, 21, 27, 1, 19, 132, 7271 }, // ¾
+    { 9, 20, 10, 0, 14, 45, 7403 }, // ¿
+    { 19, 24, 18, -2, 24, 114, 7448 }, // À
+    { 19, 24, 18, -2, 24, 114, 7562 }, // Á
+    { 19, 24, 18, -2, 24, 114, 7676 }, // Â
+    { 19, 24, 18, -2, 24, 114, 7790 }, // Ã
+    { 19, 23, 18, -2, 23, 110, 7904 }, // Ä
+    { 19, 25, 18, -2, 25, 119, 8014 }, // Å
+    { 25, 18, 22, -2, 18, 113, 8192 }, // Æ
+    { 15, 25, 16, 1, 18, 94, 8305 }, // Ç
+    { 17, 24, 15, -1, 24, 102, 8399 }, // È
+    { 17, 24, 15, -1, 24, 102, 8501 }, // É
+    { 17, 24, 15, -1, 24, 102, 8603 }, // Ê
+    { 17, 23, 15, -1, 23, 98, 8705 }, // Ë
+    { 11, 24, 9, -1, 24, 66, 8803 }, // Ì
+    { 12, 24, 9, -1, 24, 72, 8869 }, // Í
+    { 13, 24, 9, -1, 24, 78, 8941 }, // Î
+    { 13, 23, 9, -1, 23, 75, 9019 }, // Ï
+    { 19, 19, 18, -1, 18, 91, 9094 }, // Ð
+    { 21, 25, 19, -1, 24, 132, 9185 }, // Ñ
+    { 17, 25, 18, 1, 24, 107, 9317 }, // Ò
+    { 17, 25, 18, 1, 24, 107, 9424 }, // Ó
+    { 17, 25, 18, 1, 24, 107, 9531 }, // Ô
+    { 17, 25, 18, 1, 24, 107, 9638 }, // Õ
+    { 17, 24, 18, 1, 23, 102, 9745 }, // Ö
+    { 10, 11, 16, 3, 14, 28, 9847 }, // ×
+    { 20, 19, 18, -1, 18, 95, 9875 }, // Ø
+    { 18, 25, 19, 2, 24, 113, 9970 }, // Ù
+    { 18, 25, 19, 2, 24, 113, 10083 }, // Ú
+    { 18, 25, 19, 2, 24, 113, 10240 }, // Û
+    { 18, 24, 19, 2, 23, 108, 10353 }, // Ü
+    { 17, 24, 16, 1, 24, 102, 10461 }, // Ý
+    { 15, 18, 15, -1, 18, 68, 10563 }, // Þ
+    { 20, 26, 16, -4, 20, 130, 10631 }, // ß
+    { 13, 22, 15, 1, 21, 72, 10761 }, // à
+    { 13, 22, 15, 1, 21, 72, 10833 }, // á
+    { 13, 22, 15, 1, 21, 72, 10905 }, // â
+    { 13, 21, 15, 1, 20, 69, 10977 }, // ã
+    { 13, 20, 15, 1, 19, 65, 11046 }, // ä
+    { 13, 22, 15, 1, 21, 72, 11111 }, // å
+    { 18, 15, 19, 1, 14, 68, 11183 }, // æ
+    { 10, 21, 11, 1, 14, 53, 11251 }, // ç
+    { 11, 22, 12, 1, 21, 61, 11304 }, // è
+    { 11, 22, 12, 1, 21, 61, 11365 }, // é
+    { 11, 22, 12, 1, 21, 61, 11426 }, // ê
+    { 12, 20, 12, 1, 19, 60, 11487 }, // ë
+    { 7, 22, 8, 1, 21, 39, 11547 }, // ì
+    { 9, 22, 8, 1, 21, 50, 11586 }, // í
+    { 9, 22, 8, 1, 21, 50, 11636 }, // î
+    { 10, 20, 8, 1, 19, 50, 11686 }, // ï
+    { 13, 21, 14, 0, 20, 69, 11736 }, // ð
+    { 14, 21, 15, 1, 20, 74, 11805 }, // ñ
+    { 12, 22, 14, 1, 21, 66, 11879 }, // ò
+    { 12, 22, 14, 1, 21, 66, 11945 }, // ó
+    { 12, 22, 14, 1, 21, 66, 12011 }, // ô
+    { 13, 21, 14, 1, 20, 69, 12077 }, // õ
+    { 13, 20, 14, 1, 19, 65, 12146 }, // ö
+    { 11, 13, 16, 2, 15, 36, 12211 }, // ÷
+    { 16, 15, 14, -1, 14, 60, 12288 }, // ø
+    { 14, 22, 15, 1, 21, 77, 12348 }, // ù
+    { 14, 22, 15, 1, 21, 77, 12425 }, // ú
+    { 14, 22, 15, 1, 21, 77, 12502 }, // û
+    { 14, 20, 15, 1, 19, 70, 12579 }, // ü
+    { 16, 27, 13, -3, 21, 108, 12649 }, // ý
+    { 15, 26, 14, -2, 20, 98, 12757 }, // þ
+    { 16, 25, 13, -3, 19, 100, 12855 }, // ÿ
+    { 19, 23, 18, -2, 23, 110, 12955 }, // Ā
+    { 13, 19, 15, 1, 18, 62, 13065 }, // ā
+    { 19, 24, 18, -2, 24, 114, 13127 }, // Ă
+    { 13, 21, 15, 1, 20, 69, 13241 }, // ă
+    { 19, 24, 18, -2, 18, 114, 13310 }, // Ą
+    { 13, 20, 15, 1, 14, 65, 13424 }, // ą
+    { 15, 25, 16, 1, 24, 94, 13489 }, // Ć
+    { 11, 22, 11, 1, 21, 61, 13583 }, // ć
+    { 15, 25, 16, 1, 24, 94, 13644 }, // Ĉ
+    { 11, 22, 11, 1, 21, 61, 13738 }, // ĉ
+    { 15, 25, 16, 1, 24, 94, 13799 }, // Ċ
+    { 10, 20, 11, 1, 19, 50, 13893 }, // ċ
+    { 16, 26, 16, 1, 25, 104, 13943 }, // Č
+    { 12, 22, 11, 1, 21, 66, 14047 }, // č
+    { 19, 26, 18, -1, 25, 124, 14113 }, // Ď
+    { 18, 23, 15, 1, 22, 104, 14336 }, // ď
+    { 19, 19, 18, -1, 18, 91, 14440 }, // Đ
+    { 15, 21, 15, 1, 20, 79, 14531 }, // đ
+    { 17, 23, 15, -1, 23, 98, 14610 }, // Ē
+    { 12, 19, 12, 1, 18, 57, 14708 }, // ē
+    { 17, 24, 15, -1, 24, 102, 14765 }, // Ĕ
+    { 12, 21, 12, 1, 20, 63, 14867 }, // ĕ
+    { 17, 24, 15, -1, 24, 102, 14930 }, // Ė
+    { 11, 20, 12, 1, 19, 55, 15032 }, // ė
+    { 17, 24, 15, -1, 18, 102, 15087 }, // Ę
+    { 11, 20, 12, 1, 14, 55, 15189 }, // ę
+    { 17, 25, 15, -1, 25, 107, 15244 }, // Ě
+    { 12, 22, 12, 1, 21, 66, 15351 }, // ě
+    { 17, 25, 18, 1, 24, 107, 15417 }, // Ĝ
+    { 17, 27, 12, -3, 21, 115, 15524 }, // ĝ
+    { 17, 25, 18, 1, 24, 107, 15639 }, // Ğ
+    { 17, 26, 12, -3, 20, 111, 15746 }, // ğ
+    { 17, 25, 18, 1, 24, 107, 15857 }, // Ġ
+    { 17, 25, 12, -3, 19, 107, 15964 }, // ġ
+    { 17, 25, 18, 1, 18, 107, 16071 }, // Ģ
+    { 17, 28, 12, -3, 22, 119, 16178 }, // ģ
+    { 22, 24, 20, -1, 24, 132, 16384 }, // Ĥ
+    { 15, 27, 15, 0, 26, 102, 16516 }, // ĥ
+    { 22, 18, 20, -1, 18, 99, 16618 }, // Ħ
+    { 15, 21, 15, 0, 20, 79, 16717 }, // ħ
+    { 13, 24, 9, -1, 24, 78, 16796 }, // Ĩ
+    { 10, 21, 8, 1, 20, 53, 16874 }, // ĩ
+    { 13, 23, 9, -1, 23, 75, 16927 }, // Ī
+    { 10, 19, 8, 1, 18, 48, 17002 }, // ī
+    { 13, 24, 9, -1, 24, 78, 17050 }, // Ĭ
+    { 10, 21, 8, 1, 20, 53, 17128 }, // ĭ
+    { 11, 24, 9, -1, 18, 66, 17181 }, // Į
+    { 7, 26, 8, 1, 20, 46, 17247 }, // į
+    { 11, 24, 9, -1, 24, 66, 17293 }, // İ
+    { 6, 14, 8, 1, 13, 21, 17359 }, // ı
+    { 21, 23, 18, -1, 18, 121, 17380 }, // Ĳ
+    { 15, 26, 15, 1, 20, 98, 17501 }, // ĳ
+    { 17, 29, 9, -5, 24, 124, 17599 }, // Ĵ
+    { 15, 27, 7, -5, 21, 102, 17723 }, // ĵ
+    { 20, 25, 18, -1, 18, 125, 17825 }, // Ķ
+    { 12, 27, 13, 1, 20, 81, 17950 }, // ķ
+    { 12, 15, 14, 1, 14, 45, 18031 }, // ĸ
+    { 15, 24, 14, -1, 24, 90, 18076 }, // Ĺ
+    { 9, 27, 8, 1, 26, 61, 18166 }, // ĺ
+    { 15, 25, 14, -1, 18, 94, 18227 }, // Ļ
+    { 9, 27, 8, -1, 20, 61, 18321 }, // ļ
+    { 16, 20, 14, -1, 20, 80, 18432 }, // Ľ
+    { 11, 23, 8, 1, 22, 64, 18512 }, // ľ
+    { 16, 18, 15, -1, 18, 72, 18576 }, // Ŀ
+    { 10, 21, 10, 1, 20, 53, 18648 }, // ŀ
+    { 15, 18, 14, -1, 18, 68, 18701 }, // Ł
+    { 10, 21, 8, -1, 20, 53, 18769 }, // ł
+    { 21, 25, 19, -1, 24, 132, 18822 }, // Ń
+    { 14, 22, 15, 1, 21, 77, 18954 }, // ń
+    { 21, 25, 19, -1, 18, 132, 19031 }, // Ņ
+    { 14, 21, 15, 1, 14, 74, 19163 }, // ņ
+    { 21, 26, 19, -1, 25, 137, 19237 }, // Ň
+    { 14, 22, 15, 1, 21, 77, 19374 }, // ň
+    { 19, 20, 21, 1, 19, 95, 19451 }, // ŉ
+    { 21, 23, 19, -1, 18, 121, 19546 }, // Ŋ
+    { 13, 20, 15, 1, 14, 65, 19667 }, // ŋ
+    { 17, 24, 18, 1, 23, 102, 19732 }, // Ō
+    { 13, 19, 14, 1, 18, 62, 19834 }, // ō
+    { 17, 25, 18, 1, 24, 107, 19896 }, // Ŏ
+    { 13, 21, 14, 1, 20, 69, 20003 }, // ŏ
+    { 18, 26, 18, 1, 25, 117, 20072 }, // Ő
+    { 14, 22, 14, 1, 21, 77, 20189 }, // ő
+    { 23, 19, 24, 1, 18, 110, 20266 }, // Œ
+    { 19, 15, 20, 1, 14, 72, 20376 }, // œ
+    { 17, 25, 16, -1, 24, 107, 20480 }, // Ŕ
+    { 11, 21, 11, 1, 21, 58, 20587 }, // ŕ
+    { 17, 25, 16, -1, 18, 107, 20645 }, // Ŗ
+    { 13, 21, 11, -1, 14, 69, 20752 }, // ŗ
+    { 17, 26, 16, -1, 25, 111, 20821 }, // Ř
+    { 12, 21, 11, 1, 21, 63, 20932 }, // ř
+    { 13, 25, 13, 0, 24, 82, 20995 }, // Ś
+    { 11, 22, 10, 0, 21, 61, 21077 }, // ś
+    { 13, 25, 13, 0, 24, 82, 21138 }, // Ŝ
+    { 11, 22, 10, 0, 21, 61, 21220 }, // ŝ
+    { 13, 25, 13, 0, 18, 82, 21281 }, // Ş
+    { 10, 21, 10, 0, 14, 53, 21363 }, // ş
+    { 14, 26, 13, 0, 25, 91, 21416 }, // Š
+    { 12, 22, 10, 0, 21, 66, 21507 }, // š
+    { 15, 25, 16, 2, 18, 94, 21573 }, // Ţ
+    { 10, 24, 10, 0, 17, 60, 21667 }, // ţ
+    { 15, 25, 16, 2, 25, 94, 21727 }, // Ť
+    { 11, 21, 10, 0, 20, 58, 21821 }, // ť
+    { 15, 18, 16, 2, 18, 68, 21879 }, // Ŧ
+    { 10, 18, 10, 0, 17, 45, 21947 }, // ŧ
+    { 18, 25, 19, 2, 24, 113, 21992 }, // Ũ
+    { 14, 21, 15, 1, 20, 74, 22105 }, // ũ
+    { 18, 24, 19, 2, 23, 108, 22179 }, // Ū
+    { 14, 19, 15, 1, 18, 67, 22287 }, // ū
+    { 18, 25, 19, 2, 24, 113, 22354 }, // Ŭ
+    { 14, 21, 15, 1, 20, 74, 22528 }, // ŭ
+    { 18, 26, 19, 2, 25, 117, 22602 }, // Ů
+    { 14, 22, 15, 1, 21, 77, 22719 }, // ů
+    { 18, 26, 19, 2, 25, 117, 22796 }, // Ű
+    { 14, 22, 15, 1, 21, 77, 22913 }, // ű
+    { 18, 24, 19, 2, 18, 108, 22990 }, // Ų
+    { 14, 19, 15, 1, 13, 67, 23098 }, // ų
+    { 26, 25, 26, 2, 24, 163, 23165 }, // Ŵ
+    { 19, 22, 19, 0, 21, 105, 23328 }, // ŵ
+    { 17, 24, 16, 1, 24, 102, 23433 }, // Ŷ
+    { 16, 27, 13, -3, 21, 108, 23535 }, // ŷ
+    { 17, 23, 16, 1, 23, 98, 23643 }, // Ÿ
+    { 16, 25, 15, -1, 24, 100, 23741 }, // Ź
+    { 12, 22, 12, 0, 21, 66, 23841 }, // ź
+    { 16, 25, 15, -1, 24, 100, 23907 }, // Ż
+    { 12, 20, 12, 0, 19, 60, 24007 }, // ż
+    { 16, 26, 15, -1, 25, 104, 24067 }, // Ž
+    { 12, 22, 12, 0, 21, 66, 24171 }, // ž
+    { 18, 26, 10, -5, 20, 117, 24237 }, // ſ
+    { 6, 7, 0, -4, 21, 11, 24354 }, // ̀
+    { 6, 7, 0, -2, 21, 11, 24365 }, // ́
+    { 9, 7, 0, -5, 21, 16, 24376 }, // ̂
+    { 8, 5, 0, -4, 20, 10, 24392 }, // ̃
+    { 8, 3, 0, -4, 18, 6, 24402 }, // ̄
+    { 8, 5, 0, -4, 20, 10, 24408 }, // ̆
+    { 4, 4, 0, -2, 19, 4, 24418 }, // ̇
+    { 10, 4, 0, -5, 19, 10, 24422 }, // ̈
+    { 7, 8, 0, -3, 22, 14, 24432 }, // ̉
+    { 8, 7, 0, -4, 21, 14, 24446 }, // ̊
+    { 10, 7, 0, -4, 21, 18, 24460 }, // ̋
+    { 9, 6, 0, -4, 21, 14, 24478 }, // ̌
+    { 8, 7, 0, -5, 21, 14, 24492 }, // ̏
+    { 9, 5, 0, -5, 20, 12, 24506 }, // ̑
+    { 6, 8, 0, -3, 22, 12, 24518 }, // ̒
+    { 5, 7, 0, -2, 22, 9, 24530 }, // ̓
+    { 5, 7, 0, -3, 22, 9, 24539 }, // ̔
+    { 4, 7, 0, -2, 22, 7, 24548 }, // ̕
+    { 6, 6, 0, -3, 16, 9, 24555 }, // ̛
+    { 4, 4, 0, -2, -2, 4, 24564 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 24576 }, // ̤
+    { 6, 6, 0, -3, -1, 9, 24586 }, // ̥
+    { 5, 6, 0, -3, -1, 8, 24595 }, // ̦
+    { 6, 6, 0, -3, -1, 9, 24603 }, // ̧
+    { 6, 7, 0, -3, 1, 11, 24612 }, // ̨
+    { 5, 6, 7, -1, -1, 8, 24623 }, // ̩
+    { 9, 6, 0, -5, -1, 14, 24631 }, // ̭
+    { 8, 5, 0, -4, -1, 10, 24645 }, // ̮
+    { 8, 5, 0, -4, -1, 10, 24655 }, // ̰
+    { 8, 3, 0, -4, -2, 6, 24665 }, // ̱
+    { 9, 5, 0, -5, 20, 12, 24671 }, // ͂
+    { 9, 10, 0, -5, 25, 23, 24683 }, // ̈́
+    { 5, 5, 0, -2, -1, 7, 24706 }, // ͅ
+    { 17, 24, 15, -1, 24, 102, 24713 }, // Ѐ
+    { 17, 23, 15, -1, 23, 98, 24815 }, // Ё
+    { 16, 24, 19, 2, 18, 96, 24913 }, // Ђ
+    { 16, 24, 14, -1, 24, 96, 25009 }, // Ѓ
+    { 15, 19, 16, 1, 18, 72, 25105 }, // Є
+    { 13, 19, 13, 0, 18, 62, 25177 }, // Ѕ
+    { 11, 18, 9, -1, 18, 50, 25239 }, // І
+    { 13, 23, 9, -1, 23, 75, 25289 }, // Ї
+    { 16, 23, 9, -5, 18, 92, 25364 }, // Ј
+    { 24, 19, 22, -2, 18, 114, 25456 }, // Љ
+    { 24, 19, 23, -1, 18, 114, 25570 }, // Њ
+    { 16, 18, 20, 2, 18, 72, 25684 }, // Ћ
+    { 19, 25, 17, -1, 24, 119, 25756 }, // Ќ
+    { 22, 24, 20, -1, 24, 132, 25875 }, // Ѝ
+    { 18, 26, 16, 0, 25, 117, 26007 }, // Ў
+    { 21, 24, 19, -1, 18, 126, 26124 }, // Џ
+    { 19, 18, 18, -2, 18, 86, 26250 }, // А
+    { 16, 19, 15, -1, 18, 76, 26336 }, // Б
+    { 16, 19, 16, -1, 18, 76, 26412 }, // В
+    { 16, 18, 14, -1, 18, 72, 26488 }, // Г
+    { 21, 24, 18, -2, 18, 126, 26624 }, // Д
+    { 17, 18, 15, -1, 18, 77, 26750 }, // Е
+    { 27, 19, 24, -2, 18, 129, 26827 }, // Ж
+    { 13, 19, 14, 0, 18, 62, 26956 }, // З
+    { 22, 18, 20, -1, 18, 99, 27018 }, // И
+    { 22, 25, 20, -1, 25, 138, 27117 }, // Й
+    { 19, 19, 17, -1, 18, 91, 27255 }, // К
+    { 20, 19, 17, -2, 18, 95, 27346 }, // Л
+    { 25, 18, 23, -2, 18, 113, 27441 }, // М
+    { 22, 18, 20, -1, 18, 99, 27554 }, // Н
+    { 17, 19, 18, 1, 18, 81, 27653 }, // О
+    { 21, 18, 19, -1, 18, 95, 27734 }, // П
+    { 16, 18, 15, -1, 18, 72, 27829 }, // Р
+    { 15, 19, 16, 1, 18, 72, 27901 }, // С
+    { 15, 18, 16, 2, 18, 68, 27973 }, // Т
+    { 18, 19, 16, 0, 18, 86, 28041 }, // У
+    { 18, 19, 18, 0, 18, 86, 28127 }, // Ф
+    { 20, 18, 17, -2, 18, 90, 28213 }, // Х
+    { 21, 24, 19, -1, 18, 126, 28303 }, // Ц
+    { 17, 18, 17, 1, 18, 77, 28429 }, // Ч
+    { 27, 18, 25, -1, 18, 122, 28506 }, // Ш
+    { 27, 24, 25, -1, 18, 162, 28672 }, // Щ
+    { 15, 19, 17, 2, 18, 72, 28834 }, // Ъ
+    { 25, 19, 23, -1, 18, 119, 28906 }, // Ы
+    { 15, 19, 15, -1, 18, 72, 29025 }, // Ь
+    { 15, 19, 15, 0, 18, 72, 29097 }, // Э
+    { 26, 19, 25, -1, 18, 124, 29169 }, // Ю
+    { 19, 19, 16, -2, 18, 91, 29293 }, // Я
+    { 13, 15, 15, 1, 14, 49, 29384 }, // а
+    { 14, 21, 14, 1, 20, 74, 29433 }, // б
+    { 11, 15, 13, 1, 14, 42, 29507 }, // в
+    { 11, 15, 11, 0, 14, 42, 29549 }, // г
+    { 12, 21, 14, 1, 20, 63, 29591 }, // д
+    { 11, 15, 12, 1, 14, 42, 29654 }, // е
+    { 22, 15, 22, 0, 14, 83, 29696 }, // ж
+    { 11, 15, 11, 0, 14, 42, 29779 }, // з
+    { 14, 14, 15, 1, 13, 49, 29821 }, // и
+    { 14, 21, 15, 1, 20, 74, 29870 }, // й
+    { 13, 15, 14, 1, 14, 49, 29944 }, // к
+    { 16, 15, 15, -1, 14, 60, 29993 }, // л
+    { 19, 15, 19, 0, 14, 72, 30053 }, // м
+    { 14, 14, 15, 1, 13, 49, 30125 }, // н
+    { 12, 15, 14, 1, 14, 45, 30174 }, // о
+    { 14, 15, 15, 1, 14, 53, 30219 }, // п
+    { 16, 20, 14, -2, 14, 80, 30272 }, // р
+    { 10, 15, 11, 1, 14, 38, 30352 }, // с
+    { 21, 15, 22, 1, 14, 79, 30390 }, // т
+    { 16, 20, 13, -3, 14, 80, 30469 }, // у
+    { 16, 26, 17, 1, 20, 104, 30549 }, // ф
+    { 16, 15, 14, -1, 14, 60, 30653 }, // х
+    { 14, 18, 15, 1, 13, 63, 30720 }, // ц
+    { 13, 14, 15, 1, 13, 46, 30783 }, // ч
+    { 20, 14, 21, 1, 13, 70, 30829 }, // ш
+    { 20, 18, 21, 1, 13, 90, 30899 }, // щ
+    { 13, 15, 13, 0, 14, 49, 30989 }, // ъ
+    { 18, 14, 19, 0, 13, 63, 31038 }, // ы
+    { 11, 14, 12, 0, 13, 39, 31101 }, // ь
+    { 11, 15, 12, 0, 14, 42, 31140 }, // э
+    { 18, 15, 20, 1, 14, 68, 31182 }, // ю
+    { 14, 14, 14, -1, 13, 49, 31250 }, // я
+    { 11, 22, 12, 1, 21, 61, 31299 }, // ѐ
+    { 12, 20, 12, 1, 19, 60, 31360 }, // ё
+    { 13, 26, 14, 0, 20, 85, 31420 }, // ђ
+    { 11, 22, 11, 0, 21, 61, 31505 }, // ѓ
+    { 11, 15, 12, 1, 14, 42, 31566 }, // є
+    { 10, 15, 10, 0, 14, 38, 31608 }, // ѕ
+    { 7, 21, 8, 1, 20, 37, 31646 }, // і
+    { 10, 20, 8, 1, 19, 50, 31683 }, // ї
+    { 13, 26, 7, -5, 20, 85, 31733 }, // ј
+    { 19, 15, 18, -1, 14, 72, 31818 }, // љ
+    { 16, 14, 18, 1, 13, 56, 31890 }, // њ
+    { 15, 21, 15, 0, 20, 79, 31946 }, // ћ
+    { 13, 22, 14, 1, 21, 72, 32025 }, // ќ
+    { 14, 22, 15, 1, 21, 77, 32097 }, // ѝ
+    { 16, 26, 13, -3, 20, 104, 32174 }, // ў
+    { 14, 18, 15, 1, 13, 63, 32278 }, // џ
+    { 15, 21, 17, 1, 20, 79, 32341 }, // Ѣ
+    { 17, 15, 18, 1, 14, 64, 32420 }, // ѣ
+    { 17, 19, 18, 1, 18, 81, 32484 }, // Ѳ
+    { 12, 15, 14, 1, 14, 45, 32565 }, // ѳ
+    { 18, 19, 18, 2, 18, 86, 32610 }, // Ѵ
+    { 15, 15, 14, 0, 14, 57, 32696 }, // ѵ
+    { 22, 31, 20, -1, 25, 171, 32768 }, // Ҋ
+    { 14, 25, 15, 1, 20, 88, 32939 }, // ҋ
+    { 15, 19, 15, -1, 18, 72, 33027 }, // Ҍ
+    { 11, 19, 12, 1, 18, 53, 33099 }, // ҍ
+    { 16, 18, 15, -1, 18, 72, 33152 }, // Ҏ
+    { 16, 20, 14, -2, 14, 80, 33224 }, // ҏ
+    { 17, 21, 14, -1, 21, 90, 33304 }, // Ґ
+    { 13, 18, 11, 0, 17, 59, 33394 }, // ґ
+    { 16, 18, 14, -1, 18, 72, 33453 }, // Ғ
+    { 11, 15, 11, 0, 14, 42, 33525 }, // ғ
+    { 16, 24, 15, -1, 18, 96, 33567 }, // Ҕ
+    { 12, 19, 13, 1, 13, 57, 33663 }, // ҕ
+    { 27, 24, 24, -2, 18, 162, 33720 }, // Җ
+    { 22, 19, 22, 0, 14, 105, 33882 }, // җ
+    { 13, 24, 14, 0, 18, 78, 33987 }, // Ҙ
+    { 11, 19, 11, 0, 14, 53, 34065 }, // ҙ
+    { 19, 24, 17, -1, 18, 114, 34118 }, // Қ
+    { 13, 19, 14, 1, 14, 62, 34232 }, // қ
+    { 20, 19, 18, -1, 18, 95, 34294 }, // Ҝ
+    { 14, 15, 15, 1, 14, 53, 34389 }, // ҝ
+    { 19, 19, 17, -1, 18, 91, 34442 }, // Ҟ
+    { 13, 19, 14, 1, 18, 62, 34533 }, // ҟ
+    { 19, 19, 20, 2, 18, 91, 34595 }, // Ҡ
+    { 15, 15, 15, 0, 14, 57, 34686 }, // ҡ
+    { 22, 24, 20, -1, 18, 132, 34816 }, // Ң
+    { 14, 18, 16, 1, 13, 63, 34948 }, // ң
+    { 25, 18, 23, -1, 18, 113, 35011 }, // Ҥ
+    { 17, 14, 18, 1, 13, 60, 35124 }, // ҥ
+    { 26, 24, 26, -1, 18, 156, 35184 }, // Ҧ
+    { 20, 20, 21, 1, 14, 100, 35340 }, // ҧ
+    { 19, 19, 20, 1, 18, 91, 35440 }, // Ҩ
+    { 15, 15, 16, 1, 14, 57, 35531 }, // ҩ
+    { 15, 24, 16, 1, 18, 90, 35588 }, // Ҫ
+    { 10, 19, 11, 1, 14, 48, 35678 }, // ҫ
+    { 15, 24, 16, 2, 18, 90, 35726 }, // Ҭ
+    { 21, 19, 22, 1, 14, 100, 35816 }, // ҭ
+    { 17, 18, 16, 1, 18, 77, 35916 }, // Ү
+    { 13, 20, 13, 0, 14, 65, 35993 }, // ү
+    { 17, 18, 16, 1, 18, 77, 36058 }, // Ұ
+    { 13, 20, 13, 0, 14, 65, 36135 }, // ұ
+    { 20, 24, 17, -2, 18, 120, 36200 }, // Ҳ
+    { 16, 19, 14, -1, 14, 76, 36320 }, // ҳ
+    { 21, 24, 21, 1, 18, 126, 36396 }, // Ҵ
+    { 14, 23, 15, 1, 18, 81, 36522 }, // ҵ
+    { 17, 24, 17, 1, 18, 102, 36603 }, // Ҷ
+    { 14, 18, 15, 1, 13, 63, 36705 }, // ҷ
+    { 17, 18, 17, 1, 18, 77, 36768 }, // Ҹ
+    { 13, 14, 15, 1, 13, 46, 36864 }, // ҹ
+    { 16, 18, 17, -1, 18, 72, 36910 }, // Һ
+    { 15, 21, 15, 0, 20, 79, 36982 }, // һ
+    { 18, 19, 20, 1, 18, 86, 37061 }, // Ҽ
+    { 14, 15, 14, 0, 14, 53, 37147 }, // ҽ
+    { 18, 24, 20, 1, 18, 108, 37200 }, // Ҿ
+    { 14, 19, 14, 0, 14, 67, 37308 }, // ҿ
+    { 11, 18, 9, -1, 18, 50, 37375 }, // Ӏ
+    { 27, 26, 24, -2, 25, 176, 37425 }, // Ӂ
+    { 22, 21, 22, 0, 20, 116, 37601 }, // ӂ
+    { 19, 24, 17, -1, 18, 114, 37717 }, // Ӄ
+    { 12, 20, 14, 1, 14, 60, 37831 }, // ӄ
+    { 20, 24, 17, -2, 18, 120, 37891 }, // Ӆ
+    { 16, 19, 15, -1, 14, 76, 38011 }, // ӆ
+    { 22, 24, 20, -1, 18, 132, 38087 }, // Ӈ
+    { 13, 19, 14, 1, 13, 62, 38219 }, // ӈ
+    { 22, 24, 20, -1, 18, 132, 38281 }, // Ӊ
+    { 14, 18, 16, 1, 13, 63, 38413 }, // ӊ
+    { 17, 24, 17, 1, 18, 102, 38476 }, // Ӌ
+    { 13, 18, 14, 1, 13, 59, 38578 }, // ӌ
+    { 25, 24, 23, -2, 18, 150, 38637 }, // Ӎ
+    { 19, 19, 19, 0, 14, 91, 38787 }, // ӎ
+    { 11, 20, 8, -1, 20, 55, 38912 }, // ӏ
+    { 19, 25, 18, -2, 25, 119, 38967 }, // Ӑ
+    { 13, 21, 15, 1, 20, 69, 39086 }, // ӑ
+    { 19, 23, 18, -2, 23, 110, 39155 }, // Ӓ
+    { 13, 20, 15, 1, 19, 65, 39265 }, // ӓ
+    { 25, 18, 22, -2, 18, 113, 39330 }, // Ӕ
+    { 18, 15, 19, 1, 14, 68, 39443 }, // ӕ
+    { 17, 25, 15, -1, 25, 107, 39511 }, // Ӗ
+    { 12, 21, 12, 1, 20, 63, 39618 }, // ӗ
+    { 15, 19, 16, 0, 18, 72, 39681 }, // Ә
+    { 11, 15, 12, 0, 14, 42, 39753 }, // ә
+    { 15, 24, 16, 0, 23, 90, 39795 }, // Ӛ
+    { 12, 20, 12, 0, 19, 60, 39885 }, // ӛ
+    { 27, 24, 24, -2, 23, 162, 39945 }, // Ӝ
+    { 22, 20, 22, 0, 19, 110, 40107 }, // ӝ
+    { 13, 24, 14, 0, 23, 78, 40217 }, // Ӟ
+    { 12, 20, 11, 0, 19, 60, 40295 }, // ӟ
+    { 16, 19, 14, -1, 18, 76, 40355 }, // Ӡ
+    { 15, 19, 13, -2, 13, 72, 40431 }, // ӡ
+    { 22, 23, 20, -1, 23, 127, 40503 }, // Ӣ
+    { 14, 19, 15, 1, 18, 67, 40630 }, // ӣ
+    { 22, 23, 20, -1, 23, 127, 40697 }, // Ӥ
+    { 14, 20, 15, 1, 19, 70, 40824 }, // ӥ
+    { 17, 24, 18, 1, 23, 102, 40960 }, // Ӧ
+    { 13, 20, 14, 1, 19, 65, 41062 }, // ӧ
+    { 17, 19, 18, 1, 18, 81, 41127 }, // Ө
+    { 12, 15, 14, 1, 14, 45, 41208 }, // ө
+    { 17, 24, 18, 1, 23, 102, 41253 }, // Ӫ
+    { 13, 20, 14, 1, 19, 65, 41355 }, // ӫ
+    { 15, 24, 15, 0, 23, 90, 41420 }, // Ӭ
+    { 12, 20, 12, 0, 19, 60, 41510 }, // ӭ
+    { 18, 24, 16, 0, 23, 108, 41570 }, // Ӯ
+    { 16, 24, 13, -3, 18, 96, 41678 }, // ӯ
+    { 18, 24, 16, 0, 23, 108, 41774 }, // Ӱ
+    { 16, 25, 13, -3, 19, 100, 41882 }, // ӱ
+    { 18, 26, 16, 0, 25, 117, 41982 }, // Ӳ
+    { 16, 27, 13, -3, 21, 108, 42099 }, // ӳ
+    { 17, 23, 17, 1, 23, 98, 42207 }, // Ӵ
+    { 13, 20, 15, 1, 19, 65, 42305 }, // ӵ
+    { 16, 24, 14, -1, 18, 96, 42370 }, // Ӷ
+    { 11, 19, 11, 0, 14, 53, 42466 }, // ӷ
+    { 25, 24, 23, -1, 23, 150, 42519 }, // Ӹ
+    { 18, 20, 19, 0, 19, 90, 42669 }, // ӹ
+    { 16, 24, 14, -1, 18, 96, 42759 }, // Ӻ
+    { 11, 19, 11, 0, 14, 53, 42855 }, // ӻ
+    { 20, 24, 17, -2, 18, 120, 43008 }, // Ӽ
+    { 16, 20, 14, -1, 14, 80, 43128 }, // ӽ
+    { 20, 18, 17, -2, 18, 90, 43208 }, // Ӿ
+    { 16, 15, 14, -1, 14, 60, 43298 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 43358 }, //  
+    { 0, 0, 25, 0, 0, 0, 43358 }, //  
+    { 0, 0, 13, 0, 0, 0, 43358 }, //  
+    { 0, 0, 25, 0, 0, 0, 43358 }, //  
+    { 0, 0, 8, 0, 0, 0, 43358 }, //  
+    { 0, 0, 6, 0, 0, 0, 43358 }, //  
+    { 0, 0, 4, 0, 0, 0, 43358 }, //  
+    { 0, 0, 16, 0, 0, 0, 43358 }, //  
+    { 0, 0, 7, 0, 0, 0, 43358 }, //  
+    { 0, 0, 5, 0, 0, 0, 43358 }, //  
+    { 0, 0, 1, 0, 0, 0, 43358 }, //  
+    { 0, 0, 0, 0, 0, 0, 43358 }, // ​
+    { 2, 21, 0, -1, 15, 11, 43358 }, // ‌
+    { 6, 23, 0, -3, 17, 35, 43369 }, // ‍
+    { 8, 24, 0, -4, 18, 48, 43404 }, // ‎
+    { 8, 24, 0, -4, 18, 48, 43452 }, // ‏
+    { 8, 3, 9, 1, 8, 6, 43500 }, // ‐
+    { 8, 3, 9, 1, 8, 6, 43506 }, // ‑
+    { 12, 3, 16, 2, 10, 9, 43512 }, // ‒
+    { 13, 3, 13, 0, 8, 10, 43521 }, // –
+    { 25, 3, 25, 0, 8, 19, 43531 }, // —
+    { 25, 3, 25, 0, 8, 19, 43550 }, // ―
+    { 8, 26, 13, 2, 20, 52, 43569 }, // ‖
+    { 13, 6, 13, 0, -1, 20, 43621 }, // ‗
+    { 6, 8, 8, 2, 19, 12, 43641 }, // ‘
+    { 6, 8, 8, 1, 19, 12, 43653 }, // ’
+    { 6, 9, 8, 0, 4, 14, 43665 }, // ‚
+    { 5, 8, 6, 1, 19, 10, 43679 }, // ‛
+    { 11, 8, 13, 2, 19, 22, 43689 }, // “
+    { 11, 8, 13, 1, 19, 22, 43711 }, // ”
+    { 11, 9, 13, 0, 4, 25, 43733 }, // „
+    { 10, 8, 11, 1, 19, 20, 43758 }, // ‟
+    { 11, 17, 12, 1, 18, 47, 43778 }, // †
+    { 12, 20, 12, 0, 18, 60, 43825 }, // ‡
+    { 6, 6, 8, 1, 9, 9, 43885 }, // •
+    { 9, 9, 16, 3, 13, 21, 43894 }, // ‣
+    { 5, 4, 7, 1, 3, 5, 43915 }, // ․
+    { 10, 5, 13, 1, 4, 13, 43920 }, // ‥
+    { 21, 5, 25, 2, 4, 27, 43933 }, // …
+    { 5, 4, 7, 1, 9, 5, 43960 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 43965 }, //  
+    { 0, 0, 0, 0, 0, 0, 43965 }, //  
+    { 8, 24, 0, -4, 18, 48, 43965 }, // ‪
+    { 8, 24, 0, -4, 18, 48, 44013 }, // ‫
+    { 8, 24, 0, -4, 18, 48, 44061 }, // ‬
+    { 11, 24, 0, -5, 18, 66, 44109 }, // ‭
+    { 11, 24, 0, -5, 18, 66, 44175 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 44241 }, //  
+    { 32, 21, 34, 1, 19, 168, 44241 }, // ‰
+    { 5, 9, 7, 1, 18, 12, 44409 }, // ′
+    { 10, 9, 11, 1, 18, 23, 44421 }, // ″
+    { 15, 9, 16, 1, 18, 34, 44444 }, // ‴
+    { 6, 9, 7, 0, 18, 14, 44478 }, // ‵
+    { 11, 9, 12, 0, 18, 25, 44492 }, // ‶
+    { 17, 9, 17, 0, 18, 39, 44517 }, // ‷
+    { 11, 6, 12, 1, 0, 17, 44556 }, // ‸
+    { 8, 10, 8, 0, 11, 20, 44573 }, // ‹
+    { 7, 10, 8, 0, 11, 18, 44593 }, // ›
+    { 16, 18, 16, 0, 17, 72, 44611 }, // ※
+    { 14, 20, 14, 1, 19, 70, 44683 }, // ‼
+    { 13, 3, 13, 0, 21, 10, 44753 }, // ‾
+    { 6, 3, 8, 1, 8, 5, 44763 }, // ⁃
+    { 16, 21, 6, -5, 19, 84, 44768 }, // ⁄
+    { 18, 19, 20, 2, 18, 86, 44852 }, // ⁇
+    { 16, 20, 17, 2, 19, 80, 44938 }, // ⁈
+    { 17, 20, 18, 1, 19, 85, 45056 }, // ⁉
+    { 15, 5, 25, 5, 10, 19, 45141 }, // ⁓
+    { 20, 9, 21, 1, 18, 45, 45160 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 45205 }, //  
+    { 0, 0, 0, 0, 0, 0, 45205 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 45205 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 45205 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 45205 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 45205 }, // ⁤
+    { 10, 12, 11, 1, 21, 30, 45205 }, // ⁰
+    { 11, 12, 11, 0, 21, 33, 45235 }, // ⁴
+    { 10, 12, 11, 1, 21, 30, 45268 }, // ⁵
+    { 10, 12, 11, 1, 21, 30, 45298 }, // ⁶
+    { 9, 12, 11, 2, 21, 27, 45328 }, // ⁷
+    { 9, 12, 11, 1, 21, 27, 45355 }, // ⁸
+    { 10, 12, 11, 0, 21, 30, 45382 }, // ⁹
+    { 10, 9, 14, 2, 18, 23, 45412 }, // ⁿ
+    { 10, 12, 11, 1, 8, 30, 45435 }, // ₀
+    { 7, 13, 11, 2, 9, 23, 45465 }, // ₁
+    { 10, 12, 11, 0, 8, 30, 45488 }, // ₂
+    { 9, 12, 11, 1, 8, 27, 45518 }, // ₃
+    { 11, 12, 11, 0, 8, 33, 45545 }, // ₄
+    { 10, 12, 11, 1, 8, 30, 45578 }, // ₅
+    { 10, 12, 11, 1, 8, 30, 45608 }, // ₆
+    { 9, 12, 11, 2, 8, 27, 45638 }, // ₇
+    { 9, 12, 11, 1, 8, 27, 45665 }, // ₈
+    { 10, 12, 11, 0, 8, 30, 45692 }, // ₉
+    { 16, 18, 16, 0, 18, 72, 45722 }, // ₣
+    { 17, 19, 16, -1, 18, 81, 45794 }, // ₤
+    { 30, 19, 31, 0, 18, 143, 45875 }, // ₧
+    { 18, 19, 16, -1, 18, 86, 46018 }, // €
+    { 15, 11, 25, 5, 14, 42, 46104 }, // ←
+    { 11, 17, 25, 7, 17, 47, 46146 }, // ↑
+    { 15, 11, 25, 5, 14, 42, 46193 }, // →
+    { 11, 17, 25, 7, 17, 47, 46235 }, // ↓
+    { 15, 11, 25, 5, 14, 42, 46282 }, // ↔
+    { 11, 17, 25, 7, 17, 47, 46324 }, // ↕
+    { 11, 17, 25, 7, 17, 47, 46371 }, // ↨
+    { 11, 17, 25, 7, 17, 47, 46418 }, // ↲
+    { 11, 17, 25, 7, 17, 47, 46465 }, // ↳
+    { 13, 12, 25, 6, 15, 39, 46512 }, // ↵
+    { 15, 11, 25, 5, 14, 42, 46551 }, // ⇐
+    { 11, 15, 25, 7, 16, 42, 46593 }, // ⇑
+    { 15, 11, 25, 5, 14, 42, 46635 }, // ⇒
+    { 11, 15, 25, 7, 16, 42, 46677 }, // ⇓
+    { 15, 11, 25, 5, 14, 42, 46719 }, // ⇔
+    { 17, 19, 25, 4, 18, 81, 46761 }, // ∀
+    { 13, 21, 16, 1, 20, 69, 46842 }, // ∂
+    { 11, 18, 25, 7, 18, 50, 46911 }, // ∃
+    { 19, 20, 25, 3, 19, 95, 46961 }, // ∅
+    { 16, 18, 16, 0, 18, 72, 47104 }, // ∆
+    { 17, 19, 25, 4, 18, 81, 47176 }, // ∇
+    { 17, 18, 25, 4, 18, 77, 47257 }, // ∈
+    { 17, 22, 25, 4, 19, 94, 47334 }, // ∉
+    { 17, 14, 25, 4, 16, 60, 47428 }, // ∊
+    { 17, 18, 25, 4, 18, 77, 47488 }, // ∋
+    { 17, 22, 25, 4, 19, 94, 47565 }, // ∌
+    { 17, 14, 25, 4, 16, 60, 47659 }, // ∍
+    { 19, 22, 20, 1, 18, 105, 47719 }, // ∏
+    { 15, 23, 15, 0, 18, 87, 47824 }, // ∑
+    { 11, 3, 16, 2, 10, 9, 47911 }, // −
+    { 14, 20, 12, -1, 18, 70, 47920 }, // ∕
+    { 10, 20, 12, 1, 18, 50, 47990 }, // ∖
+    { 12, 13, 16, 2, 15, 39, 48040 }, // ∗
+    { 9, 9, 16, 3, 13, 21, 48079 }, // ∘
+    { 4, 4, 16, 6, 9, 4, 48100 }, // ∙
+    { 16, 24, 16, 0, 21, 96, 48104 }, // √
+    { 13, 10, 16, 1, 13, 33, 48200 }, // ∝
+    { 16, 9, 16, 0, 12, 36, 48233 }, // ∞
+    { 16, 18, 25, 4, 18, 72, 48269 }, // ∟
+    { 18, 18, 25, 3, 18, 81, 48341 }, // ∠
+    { 3, 26, 13, 5, 20, 20, 48422 }, // ∣
+    { 8, 26, 13, 2, 20, 52, 48442 }, // ∥
+    { 17, 18, 25, 4, 18, 77, 48494 }, // ∧
+    { 17, 18, 25, 4, 18, 77, 48571 }, // ∨
+    { 15, 18, 25, 5, 18, 68, 48648 }, // ∩
+    { 15, 19, 25, 5, 18, 72, 48716 }, // ∪
+    { 14, 26, 16, 1, 20, 91, 48788 }, // ∫
+    { 16, 15, 25, 5, 14, 60, 48879 }, // ∴
+    { 16, 15, 25, 5, 14, 60, 48939 }, // ∵
+    { 5, 13, 8, 1, 15, 17, 48999 }, // ∶
+    { 16, 15, 25, 5, 14, 60, 49016 }, // ∷
+    { 15, 5, 25, 5, 10, 19, 49076 }, // ∼
+    { 15, 13, 25, 5, 15, 49, 49095 }, // ≅
+    { 12, 9, 16, 2, 13, 27, 49152 }, // ≈
+    { 15, 8, 25, 5, 11, 30, 49179 }, // ≍
+    { 11, 11, 16, 2, 14, 31, 49209 }, // ≠
+    { 15, 11, 25, 5, 13, 42, 49240 }, // ≡
+    { 12, 15, 16, 2, 15, 45, 49282 }, // ≤
+    { 12, 15, 16, 2, 15, 45, 49327 }, // ≥
+    { 21, 13, 25, 2, 15, 69, 49372 }, // ≪
+    { 21, 13, 25, 2, 15, 69, 49441 }, // ≫
+    { 17, 15, 25, 4, 16, 64, 49510 }, // ⊃
+    { 17, 23, 25, 4, 20, 98, 49574 }, // ⊄
+    { 17, 23, 25, 4, 20, 98, 49672 }, // ⊅
+    { 17, 18, 25, 4, 18, 77, 49770 }, // ⊆
+    { 17, 18, 25, 4, 18, 77, 49847 }, // ⊇
+    { 19, 19, 25, 3, 18, 91, 49924 }, // ⊕
+    { 19, 19, 25, 3, 18, 91, 50015 }, // ⊖
+    { 19, 19, 25, 3, 18, 91, 50106 }, // ⊗
+    { 19, 19, 25, 3, 18, 91, 50197 }, // ⊘
+    { 15, 18, 25, 5, 18, 68, 50288 }, // ⊥
+    { 4, 4, 16, 6, 9, 4, 50356 }, // ⋅
+    { 21, 4, 25, 2, 9, 21, 50360 }, // ⋯
+    { 25, 24, 25, 0, 21, 150, 50381 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_italicIntervals[] = {
@@ -3930,4 +2752,9 @@ static const EpdFontData bookerly_12_italic = {
     27,
     -7,
     true,
+    bookerly_12_italicBlockOffsets,
+    bookerly_12_italicDirectGlyphs,
+    bookerly_12_italicGlyphPages,
+    256,
+    bookerly_12_italicPageGlyphs,
 };
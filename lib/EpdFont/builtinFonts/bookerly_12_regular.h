@@ -2,2997 +2,1810 @@
  * generated by fontconvert.py
  * name: bookerly_12_regular
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_12_regular 12 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_12_regular 12 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_regularBitmaps[47742] = {
-    0x28, 0xBC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF4, 0xF4, 0xF4, 0xF4, 0xB4, 0xB4, 0x74, 0x74, 0x00, 0x00,
-    0x78, 0xFD, 0xFC, 0x10, 0x28, 0x2E, 0xE1, 0xFB, 0x47, 0xED, 0x1E, 0xB4, 0x7A, 0xD1, 0xEB, 0x03,
-    0x94, 0x04, 0x00, 0x0E, 0x02, 0xC0, 0x00, 0x0D, 0x03, 0x80, 0x00, 0x1D, 0x03, 0x40, 0x00, 0x2C,
-    0x0B, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x05, 0xB9, 0x5F, 0x54, 0x00, 0x74, 0x0D, 0x00, 0x00, 0xB0,
-    0x1C, 0x00, 0x00, 0xF0, 0x2C, 0x00, 0x15, 0xF5, 0x7D, 0x50, 0x7F, 0xFF, 0xFF, 0xE0, 0x02, 0xC0,
-    0x74, 0x00, 0x03, 0xC0, 0xB0, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x07, 0x40, 0xE0, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x2D, 0x00, 0x02, 0xFF, 0xF4, 0x0F, 0xAD, 0xFC,
-    0x2E, 0x1C, 0x3D, 0x3D, 0x1C, 0x2C, 0x3D, 0x1C, 0x00, 0x2F, 0x1C, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x29, 0xFC, 0x10, 0x38, 0x3D, 0x74, 0x38, 0x3D, 0xB8, 0x38,
-    0x3C, 0xBD, 0x38, 0xBC, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x34, 0x00, 0x00, 0x74, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x28, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xC0, 0x01, 0xF5, 0xF4, 0x00, 0xB0, 0x00, 0x3C,
-    0x07, 0xC0, 0x1E, 0x00, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x00, 0x78, 0x03, 0xC0, 0x74, 0x00, 0x07,
-    0x80, 0x3C, 0x0F, 0x00, 0x00, 0x78, 0x03, 0xC2, 0xC0, 0x10, 0x03, 0xC0, 0xB8, 0x38, 0x2F, 0xF0,
-    0x2F, 0x5F, 0x0B, 0x0F, 0x9B, 0xC0, 0xFF, 0xC1, 0xD1, 0xE0, 0x3D, 0x00, 0x40, 0x3C, 0x2D, 0x01,
-    0xE0, 0x00, 0x0B, 0x03, 0xD0, 0x1E, 0x00, 0x00, 0xE0, 0x3C, 0x01, 0xE0, 0x00, 0x2C, 0x03, 0xD0,
-    0x2E, 0x00, 0x07, 0x80, 0x2E, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0xF9, 0xB8, 0x00, 0x2D, 0x00, 0x07,
-    0xFE, 0x00, 0x02, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xEB, 0xD0, 0x00, 0x00, 0x7C, 0x0B, 0x80, 0x00,
-    0x02, 0xE0, 0x1E, 0x00, 0x00, 0x0F, 0x40, 0xB4, 0x00, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x00, 0xBC,
-    0x3C, 0x00, 0x00, 0x01, 0xF0, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFE, 0x01, 0xFB, 0xD0, 0x7F,
-    0xF4, 0x0F, 0x4B, 0xC0, 0x2D, 0x00, 0x7C, 0x0F, 0xC0, 0x74, 0x02, 0xF0, 0x0F, 0xC2, 0xD0, 0x0B,
-    0xC0, 0x0F, 0xDB, 0x00, 0x1F, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0x96,
-    0xFF, 0xFE, 0x40, 0x7F, 0xFF, 0xD1, 0xFF, 0x40, 0x05, 0x50, 0x00, 0x10, 0x2A, 0xEB, 0x6D, 0xB6,
-    0xDB, 0x14, 0x00, 0x18, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0x2E, 0x00,
-    0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xB8, 0x00,
-    0xBC, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3C, 0x00, 0x00, 0x24, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xF4,
-    0x00, 0xBC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
-    0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x0B, 0x80,
-    0x2E, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0xCB, 0x40, 0xFA, 0xC0, 0x07,
-    0xFF, 0x42, 0xFA, 0xE3, 0xEB, 0x00, 0xA2, 0xD0, 0x00, 0xB4, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF0,
-    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x15, 0x7D, 0x55, 0xFF, 0xFF, 0xF1, 0x57, 0xD5, 0x40, 0x0F,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x07, 0xD0, 0x7D,
-    0x0B, 0xC0, 0xF8, 0x1F, 0x03, 0xC0, 0x10, 0x00, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x2E, 0x1F,
-    0xC3, 0xF0, 0x10, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00,
-    0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00,
-    0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x07, 0xFA, 0xFE, 0x00, 0xF8, 0x03, 0xF4, 0x3F, 0x00, 0x0F,
-    0x83, 0xD0, 0x00, 0xBC, 0x7C, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7D, 0xFC, 0x00, 0x07, 0xDF, 0xC0,
-    0x00, 0x7D, 0xFC, 0x00, 0x07, 0xDF, 0xC0, 0x00, 0x7D, 0xBC, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0xFC,
-    0x3E, 0x00, 0x1F, 0x42, 0xF4, 0x03, 0xF0, 0x0F, 0xFA, 0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x6F, 0xF8, 0x0B, 0xFF, 0x80, 0x01, 0xF8, 0x00, 0x0F,
-    0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80,
-    0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x1B, 0xFF, 0xC7, 0xFF, 0xFD, 0x00,
-    0x05, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0xFE, 0xBF, 0xC0, 0xBC, 0x02, 0xF8, 0x3D, 0x00, 0x3F, 0x0F,
-    0x00, 0x0F, 0xC0, 0x40, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xBD, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x2F, 0xFF, 0x03,
-    0xFA, 0xFF, 0x2F, 0x00, 0xBC, 0x70, 0x01, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x01, 0xFF, 0x40, 0x1F, 0xFF, 0x80, 0x10, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xE0, 0x00, 0x2F, 0x40, 0x03, 0xF8, 0x5A, 0xFF, 0x82, 0xFF, 0xF4, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3E, 0x0F, 0x40, 0x02, 0xF0, 0x3D,
-    0x00, 0x1F, 0x00, 0xF4, 0x00, 0xF4, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x40, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xD4, 0x00, 0x07, 0xFF, 0x80, 0x07,
-    0xFF, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF8, 0x16, 0xBF, 0xE0, 0x2F, 0xFE, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x01, 0xBF, 0xD0, 0x02, 0xFE, 0x50, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0xAA, 0x00, 0x2F, 0xFF, 0xF8, 0x0F, 0xD0, 0x7F,
-    0x83, 0xE0, 0x03, 0xF0, 0xF8, 0x00, 0x7D, 0x3E, 0x00, 0x0F, 0x8F, 0xC0, 0x03, 0xE2, 0xF4, 0x01,
-    0xF4, 0x3F, 0x00, 0xFC, 0x0B, 0xFA, 0xFD, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xF0, 0x01, 0xF8, 0x74, 0x00, 0xBC, 0x1C, 0x00,
-    0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x3F, 0xAF, 0xD0, 0x3E, 0x00, 0xFC, 0x0F, 0x40, 0x1F, 0x03, 0xD0, 0x07, 0xC0,
-    0xFC, 0x03, 0xE0, 0x1F, 0xD3, 0xE0, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x7D, 0x2F, 0xD0,
-    0x7D, 0x00, 0xFC, 0x3F, 0x00, 0x1F, 0x8F, 0x80, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0xBD, 0x00, 0xBC,
-    0x0F, 0xFA, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x04, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0xFF, 0xBF, 0xC0, 0xBC, 0x02, 0xF8, 0x3E, 0x00, 0x3F, 0x0F, 0x40, 0x0B, 0xC7, 0xD0, 0x01,
-    0xF4, 0xF8, 0x00, 0x3D, 0x3F, 0x00, 0x1F, 0x47, 0xF4, 0x0B, 0xC0, 0x7F, 0xFF, 0xF0, 0x01, 0xAA,
-    0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0x06, 0xFF,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x0F, 0xC7, 0xF0, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE1, 0xFC, 0x3F, 0x01, 0x00, 0x01, 0x40, 0xFD, 0x0F, 0xD0, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x7D, 0x07, 0xD0, 0xBC, 0x0F,
-    0x81, 0xF0, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x07, 0xF8, 0x00, 0x7F,
-    0xD0, 0x07, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA9, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF2, 0xAA, 0xAA, 0x80,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x3F, 0x80,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFD, 0x03, 0xAB,
-    0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xD0, 0x00, 0x2D, 0x00, 0x1F, 0xC0, 0x7F, 0xF8,
-    0x0F, 0xFD, 0x00, 0xF9, 0x00, 0x0B, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0xBE, 0x00, 0x07, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xD0, 0x02,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x40, 0x1B, 0xD0, 0x03, 0xC3,
-    0xE0, 0x1F, 0xBF, 0x40, 0x3D, 0x3C, 0x03, 0xC0, 0xB8, 0x02, 0xE7, 0xC0, 0x28, 0x07, 0x80, 0x2E,
-    0xB8, 0x00, 0x00, 0xB8, 0x02, 0xEB, 0x80, 0x06, 0xFF, 0x80, 0x2D, 0xF8, 0x02, 0xF5, 0xB8, 0x03,
-    0xCB, 0x80, 0x3C, 0x07, 0x80, 0x7C, 0xB8, 0x07, 0xC0, 0xBC, 0x1F, 0x47, 0xC0, 0x3F, 0xBF, 0xFF,
-    0xD0, 0x3D, 0x01, 0xFE, 0x1F, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0x00, 0x00, 0xFF, 0x94, 0x5B, 0xF0, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00,
-    0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D,
-    0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03,
-    0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x05, 0xAA,
-    0x50, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xC1, 0xBF, 0x00, 0xBC, 0x02, 0xF4, 0x0B, 0xC0, 0x0F, 0x40,
-    0xBC, 0x00, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xBC, 0x02, 0xE0, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xF4, 0x0B, 0xC0, 0x1F, 0xC0, 0xBC, 0x00, 0x3D, 0x0B, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0x3E, 0x0B,
-    0xC0, 0x07, 0xD0, 0xBC, 0x01, 0xFC, 0x2F, 0xFB, 0xFF, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF9, 0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F,
-    0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8,
-    0x00, 0x01, 0x50, 0x00, 0x05, 0xAA, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x01, 0xFC, 0x56, 0xFF,
-    0x00, 0x2F, 0x00, 0x0B, 0xF0, 0x0B, 0xC0, 0x00, 0xBE, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x00,
-    0x02, 0xF4, 0x2F, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x1F, 0x82, 0xF0, 0x00, 0x03, 0xD0, 0xBC,
-    0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x0F, 0x40,
-    0xBC, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0,
-    0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xD1, 0xFE, 0xAA, 0xF4, 0x2F, 0x00,
-    0x1D, 0x0B, 0xC0, 0x03, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xD5,
-    0x68, 0x02, 0xFF, 0xFF, 0x00, 0xBD, 0x55, 0x40, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0xA9, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x02, 0xFE, 0x56, 0xF8, 0x0B, 0xD0, 0x00, 0xB8, 0x1F,
-    0x40, 0x00, 0x78, 0x3E, 0x00, 0x00, 0x30, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xBC, 0x00, 0x1A, 0xFD, 0xBD,
-    0x00, 0x00, 0x7C, 0x7F, 0x00, 0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7C, 0x1F, 0xE0, 0x00, 0x7C, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0x54, 0x00, 0x55, 0x54, 0x00, 0x55, 0x57,
-    0xFF, 0xF0, 0x07, 0xFF, 0xE1, 0xFD, 0x00, 0x05, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0,
-    0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02,
-    0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00,
-    0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xF8, 0x00, 0x6F, 0xE7, 0xFF, 0xF0, 0x07, 0xFF,
-    0xE0, 0x55, 0x54, 0xFF, 0xFD, 0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x2F, 0xF8, 0xFF, 0xFD, 0x05, 0x55, 0x40, 0xFF, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC,
-    0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x54, 0x05, 0x55, 0x0F, 0xFF, 0xC0, 0xFF, 0xF4, 0x1F, 0xD0, 0x02, 0xF8, 0x00, 0xBC,
-    0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x2F, 0x40, 0x00, 0xBC, 0x0B, 0xD0, 0x00, 0x0B, 0xC2, 0xF0, 0x00,
-    0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0xBC, 0x7F, 0x00, 0x00, 0x0B, 0xC2, 0xFC, 0x00, 0x00, 0xBC, 0x0B, 0xF0, 0x00,
-    0x0B, 0xC0, 0x2F, 0xC0, 0x00, 0xBC, 0x00, 0xBF, 0x40, 0x2F, 0xF8, 0x02, 0xFE, 0x0F, 0xFF, 0xC0,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0E, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x2E, 0x2F,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFC, 0x05, 0x54, 0x00, 0x00, 0x55, 0x00, 0x3F, 0xF8, 0x00, 0x0F,
-    0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0xEF, 0x40,
-    0x0F, 0x7C, 0x00, 0x07, 0x6F, 0x00, 0x39, 0xF0, 0x00, 0x2D, 0x7C, 0x02, 0xD7, 0xC0, 0x00, 0xB0,
-    0xF4, 0x0F, 0x0F, 0x00, 0x03, 0xC2, 0xE0, 0x38, 0x3C, 0x00, 0x0F, 0x07, 0xC2, 0xC0, 0xF4, 0x00,
-    0x3C, 0x0F, 0x4F, 0x03, 0xD0, 0x00, 0xF0, 0x2E, 0x78, 0x0F, 0x40, 0x03, 0xC0, 0x3E, 0xC0, 0x3E,
-    0x00, 0x1F, 0x00, 0xFF, 0x00, 0xB8, 0x00, 0x78, 0x02, 0xF4, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xC0,
-    0x0B, 0xC0, 0x2F, 0xE4, 0x05, 0x00, 0xBF, 0xE3, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x55, 0x40,
-    0x00, 0x55, 0x57, 0xFF, 0x40, 0x03, 0xFF, 0xE1, 0xFF, 0x00, 0x01, 0xF8, 0x02, 0xFE, 0x00, 0x02,
-    0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0x40, 0x2D, 0xBC, 0x00, 0x2D, 0x00, 0xB4, 0xFC, 0x00, 0xB4, 0x02,
-    0xD1, 0xF8, 0x02, 0xD0, 0x0B, 0x42, 0xF0, 0x0B, 0x40, 0x2D, 0x03, 0xF0, 0x2D, 0x00, 0xB4, 0x07,
-    0xE0, 0xB4, 0x02, 0xD0, 0x0B, 0xD2, 0xD0, 0x0B, 0x40, 0x0F, 0xCB, 0x40, 0x2D, 0x00, 0x0F, 0xAD,
-    0x00, 0xB4, 0x00, 0x1F, 0xF4, 0x02, 0xD0, 0x00, 0x3F, 0xD0, 0x2F, 0xE4, 0x00, 0x3F, 0x43, 0xFF,
-    0xF0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43,
-    0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E,
-    0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F,
-    0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x05,
-    0xAA, 0x50, 0x0F, 0xFF, 0xFF, 0xD0, 0x1F, 0xC1, 0xBF, 0x40, 0xBC, 0x00, 0xFC, 0x0B, 0xC0, 0x0B,
-    0xC0, 0xBC, 0x00, 0x7C, 0x0B, 0xC0, 0x0B, 0xC0, 0xBC, 0x00, 0xFC, 0x0B, 0xC0, 0x2F, 0x00, 0xBE,
-    0xBF, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x05,
-    0xA9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xD5, 0xBF, 0xC0, 0x03, 0xF4, 0x00, 0x3F,
-    0x80, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x00, 0x7E, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0x00, 0xBC, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0xBD,
-    0x02, 0xF8, 0x00, 0x03, 0xE0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x03, 0xFE, 0xAF, 0xE0, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x1F,
-    0xF9, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x05, 0xAA, 0x50, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFC, 0x1B, 0xF4, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x0B, 0xC0,
-    0xBE, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x0B,
-    0xC1, 0xF8, 0x00, 0x02, 0xF0, 0x2F, 0x80, 0x00, 0xBC, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0x3F, 0x80,
-    0x2F, 0xE8, 0x07, 0xF8, 0x3F, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x69, 0x40,
-    0x07, 0xFF, 0xFC, 0x1F, 0xD5, 0xBC, 0x3E, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F,
-    0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02,
-    0xFC, 0x20, 0x00, 0x7D, 0xF0, 0x00, 0x3D, 0xF4, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0,
-    0x2F, 0xFF, 0xC0, 0x01, 0x54, 0x00, 0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xEA,
-    0xBF, 0xAA, 0xF0, 0xF0, 0x0F, 0x80, 0x3C, 0x3C, 0x03, 0xE0, 0x0F, 0x09, 0x00, 0xF8, 0x02, 0x40,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1B, 0xFA, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x15, 0x54, 0x00, 0x15, 0x55, 0xFF, 0xF4, 0x03, 0xFF, 0xE1, 0xBE, 0x00, 0x01,
-    0xFC, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00,
-    0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40,
-    0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B,
-    0x80, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00,
-    0xFF, 0xEF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x15, 0x55,
-    0x00, 0x55, 0x52, 0xFF, 0xF8, 0x0B, 0xFF, 0xC1, 0xFE, 0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x0F,
-    0x80, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00,
-    0x3F, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0x03, 0xF0,
-    0x3C, 0x00, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x00, 0x2E, 0x3C, 0x00,
-    0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x15, 0x54,
-    0x7F, 0xFF, 0x00, 0x28, 0x00, 0xBF, 0xFC, 0x1B, 0xF4, 0x00, 0x3D, 0x00, 0x0B, 0xD0, 0x03, 0xF0,
-    0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0xFF,
-    0x00, 0x0F, 0x00, 0x00, 0xF8, 0x01, 0xEF, 0x80, 0x1F, 0x00, 0x00, 0xFC, 0x02, 0xDB, 0xC0, 0x2E,
-    0x00, 0x00, 0x7C, 0x03, 0xC7, 0xC0, 0x3D, 0x00, 0x00, 0x3D, 0x07, 0x83, 0xD0, 0x3C, 0x00, 0x00,
-    0x3E, 0x0B, 0x42, 0xF0, 0xB8, 0x00, 0x00, 0x2F, 0x0F, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x0F, 0x0E,
-    0x00, 0xF4, 0xF0, 0x00, 0x00, 0x0F, 0x6D, 0x00, 0xB9, 0xE0, 0x00, 0x00, 0x0B, 0xBC, 0x00, 0x7E,
-    0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x00, 0x55, 0x43, 0xFF, 0xF0, 0x2F, 0xFD, 0x07, 0xF4, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x0F, 0x80,
-    0x00, 0xBD, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x1F, 0xCF, 0x40, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xF2, 0xF4, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x0B, 0x80, 0x3F, 0x00, 0x01, 0xF0, 0x02,
-    0xF8, 0x00, 0x3D, 0x00, 0x0F, 0xD0, 0x2F, 0xE4, 0x01, 0xFF, 0x9F, 0xFF, 0xC0, 0xBF, 0xFF, 0x15,
-    0x54, 0x01, 0x55, 0x6F, 0xFF, 0x81, 0xFF, 0xE1, 0xFE, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x03, 0xD0,
-    0x02, 0xF4, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0xF4, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0xFC, 0x3C,
-    0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x05, 0x55, 0x55, 0x40,
-    0x7F, 0xFF, 0xFF, 0x41, 0xFA, 0xAA, 0xFD, 0x0B, 0x80, 0x03, 0xE0, 0x2C, 0x00, 0x3F, 0x00, 0x20,
-    0x02, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x02,
-    0xC0, 0xFC, 0x00, 0x0F, 0x0B, 0xD0, 0x00, 0x7C, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x83, 0xFD, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
-    0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
-    0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x83, 0xFD, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x6A, 0xAF, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1,
-    0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF6,
-    0xBE, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xDF, 0x00, 0x03, 0xC7,
-    0x80, 0x07, 0x83, 0xC0, 0x0F, 0x02, 0xD0, 0x1F, 0x00, 0xF0, 0x2D, 0x00, 0xF4, 0x3C, 0x00, 0x78,
-    0xB8, 0x00, 0x3C, 0x10, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xC0,
-    0x3F, 0x01, 0xF8, 0x07, 0xD0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFA,
-    0xBE, 0x00, 0xF4, 0x0F, 0xC0, 0x3C, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x1B,
-    0xFF, 0xC0, 0x2F, 0xEA, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x1F, 0x02, 0xF0, 0x0F, 0xC0, 0x7F,
-    0xAF, 0xFF, 0x8B, 0xFE, 0x2F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xF4, 0x1F, 0xC0, 0x3F,
-    0x00, 0x1F, 0x80, 0xF8, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x80, 0x02, 0xF0, 0x3E, 0x00,
-    0x0F, 0xC0, 0xF8, 0x00, 0x3E, 0x03, 0xE0, 0x01, 0xF0, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0xEA, 0xFC,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0xBE, 0xBF,
-    0x4B, 0xC0, 0x3E, 0x3C, 0x00, 0xB6, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0xFF, 0xC0,
-    0x0F, 0xFB, 0xFF, 0x00, 0xBC, 0x00, 0xFC, 0x03, 0xD0, 0x02, 0xF0, 0x2F, 0x00, 0x0B, 0xC0, 0xF8,
-    0x00, 0x2F, 0x03, 0xE0, 0x00, 0xBC, 0x0F, 0x80, 0x02, 0xF0, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00,
-    0x2F, 0x01, 0xFC, 0x01, 0xFC, 0x02, 0xFE, 0xBF, 0xFA, 0x02, 0xFF, 0xD3, 0xFD, 0x00, 0x50, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xFE, 0xBF, 0x0F, 0x80, 0x3E, 0x7C, 0x00, 0xBE, 0xE0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x01, 0x50, 0x00, 0x00, 0x01, 0x50, 0x00, 0x2F,
-    0xFE, 0x00, 0xBD, 0x7F, 0x00, 0xF0, 0x09, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x1B, 0xFF, 0xE0, 0x7F, 0xFF, 0xE0, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x0B, 0xFA, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xAF, 0xEF, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0xF4, 0x02,
-    0xF0, 0x02, 0xF4, 0x1F, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x2E, 0x69, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x41, 0xF0, 0x00, 0x7E, 0x0F,
-    0x00, 0x00, 0xB8, 0x7C, 0x00, 0x03, 0xC0, 0xFD, 0x00, 0xBE, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xE4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x1F, 0xFD, 0x00, 0x03, 0xEF, 0xFF, 0xC0, 0x00, 0xFE, 0x02, 0xF8, 0x00, 0x3D, 0x00, 0x3F,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x01, 0xBF,
-    0x80, 0x7F, 0x91, 0xFF, 0xF0, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03,
-    0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0B,
-    0xFC, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xF8, 0x07, 0xF0, 0x2F,
-    0xC0, 0x2E, 0x00, 0x00, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x3F,
-    0xFD, 0x03, 0xC0, 0xBF, 0xE0, 0x0F, 0x00, 0xF8, 0x00, 0x3C, 0x1F, 0x80, 0x00, 0xF1, 0xF4, 0x00,
-    0x03, 0xEF, 0x00, 0x00, 0x0F, 0x7E, 0x00, 0x00, 0x3C, 0x7D, 0x00, 0x00, 0xF0, 0xBD, 0x00, 0x03,
-    0xC0, 0xFD, 0x00, 0x0F, 0x00, 0xFE, 0x01, 0xBE, 0x40, 0xFE, 0x1F, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x40, 0x2F, 0xD0, 0x6F, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x1B, 0xF9, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF0, 0xBF, 0xD0, 0x7F, 0xE0, 0x07, 0xFE, 0xFF, 0xFD, 0xFF, 0xFE, 0x00, 0x1F, 0xE0, 0x2F,
-    0xF4, 0x1F, 0xC0, 0x03, 0xE0, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x7C, 0x00,
-    0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x02, 0xF0,
-    0x00, 0xF4, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0F,
-    0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x0B, 0xF8, 0x07, 0xF9, 0x02, 0xFE, 0x0F, 0xFF, 0x43, 0xFF, 0x83,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF0, 0xBF, 0xE0, 0x07, 0xFE, 0xFF, 0xFD, 0x00, 0x1F,
-    0xE0, 0x1F, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00,
-    0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F,
-    0x00, 0x0F, 0x80, 0x07, 0xC0, 0x0B, 0xF8, 0x03, 0xFA, 0x0F, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xBF, 0xD0, 0xBC, 0x01, 0xFC, 0x7C, 0x00, 0x2F, 0x6F, 0x00,
-    0x03, 0xEF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xEB, 0xD0,
-    0x00, 0xF0, 0xFC, 0x00, 0xF8, 0x2F, 0xE6, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x1F, 0xF8, 0x0F, 0xFE, 0xFF, 0xFC, 0x02, 0xFD, 0x02, 0xF8, 0x07, 0xD0,
-    0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x1F, 0x41, 0xF0, 0x00, 0x7D, 0x07, 0xC0, 0x01,
-    0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x3E, 0x01, 0xF0, 0x02, 0xF0, 0x07, 0xFE, 0xBF, 0x40,
-    0x1F, 0xFF, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x90, 0x0F, 0xFB, 0xFF, 0x02, 0xF0, 0x03, 0xF0, 0x7D, 0x00, 0x2F, 0x0B, 0xC0, 0x02, 0xF0, 0xF8,
-    0x00, 0x2F, 0x0F, 0x80, 0x02, 0xF0, 0xF8, 0x00, 0x2F, 0x0F, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x3F,
-    0x07, 0xF0, 0x0F, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x7F, 0xE2, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x6A, 0xA9,
-    0x00, 0x00, 0x00, 0x1B, 0xC2, 0xFC, 0x7F, 0xCB, 0xFC, 0x07, 0xFE, 0x68, 0x03, 0xF4, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFA, 0x40, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x1F,
-    0x5B, 0xD3, 0xC0, 0x2D, 0x3C, 0x00, 0xC3, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0xBF,
-    0xC1, 0x00, 0xBE, 0x70, 0x02, 0xE7, 0x80, 0x2E, 0x7E, 0x5B, 0xC3, 0xFF, 0xF0, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x2F, 0xFF, 0xCF, 0xFF, 0xFC, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0,
-    0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xAF, 0x02, 0xFF, 0xD0, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x0A, 0xF8, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0,
-    0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B,
-    0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x3F, 0x40,
-    0x03, 0xFE, 0xFF, 0xF9, 0x00, 0x3F, 0xF8, 0xBF, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x7F, 0xF8, 0x2F,
-    0xF8, 0xFF, 0x90, 0x6F, 0xD0, 0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0x0F, 0x40,
-    0x0B, 0xC0, 0x3C, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00,
-    0xF7, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x07, 0x00, 0xBF, 0xE3, 0xFE, 0x40, 0xB4, 0x06, 0xFD, 0x0F, 0x80, 0x0F,
-    0xC0, 0x0F, 0x40, 0xBC, 0x01, 0xFC, 0x01, 0xF0, 0x03, 0xD0, 0x2F, 0xD0, 0x2E, 0x00, 0x3E, 0x03,
-    0xEF, 0x03, 0xC0, 0x02, 0xF0, 0x75, 0xF0, 0x3C, 0x00, 0x0F, 0x0B, 0x0F, 0x47, 0x40, 0x00, 0xF8,
-    0xF0, 0xBC, 0xF0, 0x00, 0x07, 0xDD, 0x03, 0xCE, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x02,
-    0xF8, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x3F, 0xF4, 0xFF, 0xD0, 0xBF, 0x80, 0x7E, 0x00, 0xF4, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0xBC,
-    0xB4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3C, 0xF8,
-    0x00, 0x03, 0xC1, 0xF4, 0x00, 0x3D, 0x02, 0xF0, 0x07, 0xF4, 0x07, 0xF8, 0xBF, 0xF4, 0xBF, 0xF4,
-    0x7F, 0xF8, 0x2F, 0xF8, 0xFF, 0x90, 0x6F, 0xD0, 0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03,
-    0xD0, 0x0F, 0x40, 0x0B, 0xC0, 0x3C, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C,
-    0x78, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x5B, 0xF8, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x2C, 0x00,
-    0xF8, 0x2C, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xF0, 0x05, 0x0B, 0xC0, 0x0F, 0x1F, 0x40, 0x1E, 0x3F, 0xAA, 0xFE, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x03, 0xFD, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x0B, 0x80, 0x0B, 0xC0,
-    0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x0B, 0xC0, 0x3F, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xC0,
-    0x03, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xF9,
-    0x00, 0xFF, 0x00, 0x00, 0x02, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D,
-    0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x40, 0x3E, 0x40, 0x7F, 0xD0, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0xF4,
-    0x00, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0xBD, 0x00, 0x7E,
-    0x00, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4,
-    0x00, 0xF4, 0x1B, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x05, 0x00, 0x04, 0x3F, 0xF0, 0x1D, 0xBE, 0xFE,
-    0xBC, 0xF0, 0x2F, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x7E, 0xBE, 0x7D, 0x00, 0x00, 0x1C, 0x2D, 0x2D,
-    0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x3F, 0x3F, 0x3F, 0x3E, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x1F,
-    0xFF, 0xD0, 0x1F, 0xBD, 0xFC, 0x0F, 0x4B, 0x1F, 0x0B, 0x82, 0x83, 0x43, 0xD0, 0xA0, 0x00, 0xF0,
-    0x28, 0x00, 0x7C, 0x0E, 0x00, 0x1F, 0x03, 0x80, 0x03, 0xD0, 0xE0, 0x00, 0xFC, 0x34, 0x00, 0x2F,
-    0x8D, 0x02, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0x80, 0x00, 0x78, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0xAF, 0xC0, 0x03, 0xD0, 0x3D, 0x00, 0x7C, 0x02, 0xD0, 0x0F,
-    0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x04, 0x03, 0xFF, 0xFF, 0xC0,
-    0x17, 0xF5, 0x54, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xEF, 0xFF, 0xF8, 0x24, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x2C, 0x3D, 0xBF, 0xEB, 0x80, 0xFE, 0xAF, 0xD0, 0x0B, 0x80,
-    0x3C, 0x00, 0xF0, 0x02, 0xD0, 0x0F, 0x00, 0x1E, 0x00, 0xF0, 0x02, 0xD0, 0x0B, 0x80, 0x3C, 0x00,
-    0xFE, 0x6F, 0xD0, 0x3D, 0xFF, 0xDB, 0x87, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0xBF, 0xD2, 0xFE, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x02, 0xE0, 0x03,
-    0xF0, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0xB8, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x00, 0xF8, 0x2D, 0x00,
-    0x02, 0xFF, 0x0F, 0xF4, 0x00, 0x6B, 0xEB, 0xA8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0xAB, 0xFA, 0x90, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x1B, 0xFA, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x02, 0xDB, 0x6D, 0xB6, 0xDB,
-    0x6D, 0xB5, 0x90, 0x00, 0x00, 0x07, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0xB9, 0xBD, 0x0B, 0x80, 0x78, 0x3D, 0x00, 0x82, 0xF8, 0x00, 0x0F, 0xF8, 0x00,
-    0x3C, 0xFD, 0x00, 0xF0, 0xBF, 0x02, 0xD0, 0x7F, 0x03, 0xD0, 0x2F, 0x0B, 0xE0, 0x2D, 0x07, 0xF4,
-    0x38, 0x03, 0xF8, 0xE0, 0x01, 0xFB, 0x80, 0x00, 0xFD, 0x74, 0x02, 0xF2, 0xF0, 0x0F, 0x47, 0xF5,
-    0xF8, 0x0B, 0xFF, 0x40, 0x00, 0x40, 0x00, 0x24, 0x06, 0x3F, 0x07, 0xEF, 0xC1, 0xF4, 0x40, 0x14,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0x02, 0xE0, 0x00, 0xF0,
-    0x00, 0x01, 0xE0, 0x0F, 0x00, 0x6A, 0x01, 0xD0, 0x74, 0x0F, 0xFE, 0x02, 0xC3, 0xC0, 0xF0, 0x38,
-    0x07, 0x4E, 0x07, 0x40, 0x50, 0x0E, 0x34, 0x2C, 0x00, 0x00, 0x38, 0xD0, 0xB0, 0x00, 0x00, 0xF3,
-    0x42, 0xC0, 0x00, 0x03, 0x8E, 0x07, 0x80, 0x00, 0x0E, 0x2C, 0x0F, 0x95, 0x80, 0x74, 0x74, 0x0F,
-    0xFE, 0x03, 0xC0, 0xF0, 0x01, 0x40, 0x2D, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xF9, 0x00, 0x7D,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01, 0x90, 0x0B, 0xEE, 0x03,
-    0xC3, 0xC0, 0x50, 0xF0, 0x0B, 0xFC, 0x0F, 0x5F, 0x07, 0x83, 0xC0, 0xFA, 0xFE, 0x1F, 0x8E, 0x00,
-    0x00, 0x02, 0xAA, 0xB1, 0xFF, 0xF8, 0x00, 0x34, 0x02, 0x80, 0x1F, 0x00, 0xF4, 0x07, 0xC0, 0x7D,
-    0x02, 0xF4, 0x1F, 0x80, 0x3E, 0x03, 0xF0, 0x03, 0xF0, 0x2F, 0x40, 0x0B, 0xC0, 0x7C, 0x00, 0x2E,
-    0x01, 0xF0, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0xFF, 0xFF, 0xF1, 0x55,
-    0x57, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x54, 0xFF,
-    0xFD, 0xAA, 0xA8, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x07, 0x80, 0x1F, 0x00, 0xD1, 0x50,
-    0x38, 0x28, 0x7E, 0xD0, 0xC3, 0x43, 0x8E, 0x0E, 0x30, 0x39, 0xD0, 0xA3, 0x03, 0xF8, 0x0B, 0x30,
-    0x39, 0xD0, 0xA3, 0x83, 0xCB, 0x4D, 0x1C, 0x54, 0x16, 0xC0, 0xB0, 0x00, 0x74, 0x02, 0xE5, 0xBD,
-    0x00, 0x01, 0xA9, 0x00, 0x3F, 0xFF, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x02, 0xFF, 0x43,
-    0xE5, 0xF1, 0xE0, 0x1E, 0x74, 0x03, 0x9E, 0x01, 0xE3, 0xD0, 0xF0, 0x7F, 0xF4, 0x01, 0x90, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x01, 0xFF, 0xFF,
-    0xF2, 0xAB, 0xEA, 0x80, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC0, 0x01, 0x64, 0x03, 0xFF, 0x83, 0xD1,
-    0xF0, 0xF0, 0x3D, 0x14, 0x0F, 0x00, 0x0B, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x03, 0xFF, 0xFC, 0xAA, 0xA9, 0x01, 0x90, 0x0B, 0xFF, 0x43, 0xC1, 0xF0, 0x40, 0x3C, 0x00, 0x3D,
-    0x01, 0xBE, 0x00, 0xBF, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x0B, 0xC2, 0xBF, 0xC0, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0xF8, 0xFC, 0x7C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00,
-    0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x2F, 0x00,
-    0x3F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x80, 0xBF, 0x80, 0x3F, 0xFB, 0xF3, 0xFA,
-    0x3D, 0xFF, 0xC2, 0xFD, 0x3C, 0x14, 0x00, 0x50, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00,
-    0xBF, 0xFF, 0xD0, 0xFF, 0xFB, 0x80, 0xBF, 0xF9, 0xD0, 0x3F, 0xFE, 0x74, 0x1F, 0xFF, 0x9D, 0x07,
-    0xFF, 0xE7, 0x41, 0xFF, 0xF9, 0xD0, 0x3F, 0xFE, 0x74, 0x0B, 0xFF, 0x9D, 0x00, 0xFF, 0xE7, 0x40,
-    0x07, 0xB9, 0xD0, 0x00, 0x0E, 0x74, 0x00, 0x03, 0x9D, 0x00, 0x00, 0xE7, 0x40, 0x00, 0x39, 0xD0,
-    0x00, 0x0E, 0x74, 0x00, 0x03, 0x9D, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x38, 0x40, 0x00, 0x0D, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x19, 0x0F, 0xC7, 0xF0, 0xB4, 0x29, 0x1F, 0xD0, 0xF8, 0x3C, 0x7D, 0x04,
-    0x00, 0x00, 0x40, 0x1F, 0xC0, 0xBF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
-    0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x2F, 0xF8, 0x6A, 0xA8, 0x01, 0xA4, 0x03, 0xFF, 0xC3, 0xC0, 0xF5,
-    0xE0, 0x1F, 0x78, 0x03, 0xDE, 0x00, 0xF3, 0xC0, 0xB4, 0xBE, 0xBC, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0xAA, 0xB0, 0xBF, 0xF8, 0x70, 0x03, 0x40, 0x0F, 0x40, 0xB8, 0x00, 0xF4, 0x0F, 0x80, 0x1F, 0x80,
-    0xFC, 0x02, 0xF0, 0x1F, 0x40, 0xFC, 0x0F, 0xC0, 0xF8, 0x0B, 0xC0, 0xF8, 0x0B, 0xC0, 0x74, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x0B, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x17, 0xC0, 0x00,
-    0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2C, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x38, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xB0, 0x01, 0xF0, 0x03, 0xC0, 0x00, 0xD0, 0x07,
-    0xF0, 0x03, 0xC0, 0x02, 0xC0, 0x0F, 0xF0, 0x1B, 0xE4, 0x07, 0x40, 0x2D, 0xF0, 0xBF, 0xFC, 0x0F,
-    0x00, 0xB8, 0xF0, 0x00, 0x00, 0x2C, 0x01, 0xE0, 0xF0, 0x00, 0x00, 0x38, 0x03, 0xC0, 0xF0, 0x00,
-    0x00, 0xB0, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0xE0, 0x02, 0xAB, 0xF9, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xF0, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0x40, 0x00, 0x17, 0xC0, 0x00, 0x0F, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0xB0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x2F, 0xF0, 0x03, 0xC0, 0x02, 0xC0, 0xF9, 0xFC, 0x03,
-    0xC0, 0x03, 0x41, 0xE0, 0x3C, 0x1B, 0xE4, 0x0F, 0x00, 0xD0, 0x3C, 0xBF, 0xFC, 0x1D, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xE0,
-    0x00, 0x1F, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x07, 0x80, 0x02, 0xFF, 0xFE, 0x00,
-    0x0F, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0D, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x07, 0x80, 0x00, 0xF5, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0x20, 0x0F, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0xB0, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x0D, 0x00, 0x3F, 0x00,
-    0x01, 0xF0, 0x0B, 0x00, 0x2F, 0xC0, 0x5B, 0xF4, 0x07, 0x40, 0x2E, 0xF0, 0x3F, 0xF0, 0x03, 0xC0,
-    0x1F, 0x3C, 0x01, 0x00, 0x02, 0xC0, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x43, 0xC0, 0x00,
-    0x00, 0xB0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x78, 0x00, 0xAA, 0xBE, 0x80, 0x00, 0x3C, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xD0, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x74, 0x00, 0x2E, 0x01, 0xFF, 0xC2, 0xFF, 0xD1, 0xFE, 0x40,
-    0xB8, 0x00, 0x2D, 0x00, 0x07, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x96, 0x82, 0xFF, 0xF0, 0x1F, 0xF4,
-    0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00, 0x0F, 0x0F, 0xC0, 0x00,
-    0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0xB9,
-    0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF, 0xC0, 0x00, 0xF4, 0x00, 0x1F,
-    0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x00, 0x0B, 0xFE, 0x3F,
-    0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00, 0x0F, 0x0F,
-    0xC0, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00,
-    0x00, 0xB9, 0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF, 0xC0, 0x00, 0xF4,
-    0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x00, 0x0B,
-    0xFE, 0x3F, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x7E, 0xF0, 0x00, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00,
-    0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0xBC, 0x00, 0x00, 0xB9, 0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF, 0xC0,
-    0x00, 0xF4, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02, 0xFE,
-    0x00, 0x0B, 0xFE, 0x3F, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x4F,
-    0x00, 0x00, 0x03, 0xEF, 0xFC, 0x00, 0x00, 0x0E, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0,
-    0x00, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00,
-    0x1F, 0x00, 0xBC, 0x00, 0x00, 0xB9, 0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA,
-    0xAF, 0xC0, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC,
-    0x02, 0xFE, 0x00, 0x0B, 0xFE, 0x3F, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x00, 0xB4, 0xF4, 0x00, 0x00, 0x03,
-    0xC3, 0xF0, 0x00, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x2F,
-    0x00, 0x00, 0x2E, 0x55, 0xBD, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xEA, 0xAB, 0xF0, 0x00,
-    0x3D, 0x00, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0xBF, 0x80,
-    0x02, 0xFF, 0x8F, 0xFF, 0x40, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x03, 0x82, 0xC0, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xF7, 0xC0,
-    0x00, 0x00, 0x0B, 0x4F, 0x40, 0x00, 0x00, 0x3C, 0x3F, 0x00, 0x00, 0x01, 0xE0, 0x7C, 0x00, 0x00,
-    0x0F, 0x40, 0xF8, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x02, 0xE5, 0x5B, 0xD0, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0xBE, 0xAA, 0xBF, 0x00, 0x03, 0xD0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x00, 0xFC,
-    0x00, 0xF8, 0x00, 0x02, 0xF0, 0x0B, 0xF8, 0x00, 0x2F, 0xF8, 0xFF, 0xF4, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0xAA,
-    0xF8, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x38, 0x00, 0x00, 0x3C,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x7E, 0xAF, 0xC0, 0x00, 0x07, 0xC0, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0x55, 0xBD, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x55, 0xBC, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x7C, 0x00, 0x0C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2D, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x3C, 0x0B,
-    0xE4, 0x01, 0xFF, 0xFF, 0xFC, 0x3F, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0xA5, 0x00, 0x07,
-    0xFF, 0xFC, 0x03, 0xF9, 0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C,
-    0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01,
-    0xFF, 0x40, 0x06, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xFC,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E,
-    0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B,
-    0xF4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00,
-    0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0x1F, 0x0B, 0xC0, 0x03, 0xC0, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0,
-    0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00,
-    0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x02,
-    0x90, 0x78, 0x00, 0x7F, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA, 0xBC, 0x0B, 0xC0, 0x02, 0xC0, 0xBC,
-    0x00, 0x1C, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBE, 0xAF, 0xE0,
-    0x0B, 0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0xA0, 0xBC, 0x00, 0x0F, 0x0B, 0xC0, 0x01, 0xE2, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x50, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x1F, 0xE0, 0x00, 0x60, 0x00, 0x00, 0x55, 0x54, 0xFF, 0xFD,
-    0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x2F, 0xF8, 0xFF, 0xFD,
-    0x00, 0x08, 0x00, 0x7D, 0x03, 0xFC, 0x0F, 0xE0, 0x19, 0x00, 0x00, 0x00, 0x55, 0x54, 0xFF, 0xFD,
-    0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x2F, 0xF8, 0xFF, 0xFD,
-    0x00, 0xA0, 0x00, 0xFF, 0x00, 0xBF, 0xF0, 0xBC, 0x3E, 0x38, 0x02, 0x80, 0x00, 0x01, 0x55, 0x50,
-    0xFF, 0xFD, 0x07, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00,
-    0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0xBF, 0xE0, 0xFF, 0xFD, 0x28, 0x0B, 0x4B, 0xE0, 0xFC, 0x7D, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x50, 0x3F, 0xFF, 0x40, 0x7F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0,
-    0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xBF, 0xE0, 0x3F, 0xFF, 0x40,
-    0x01, 0x6A, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xF1, 0x5B, 0xFC, 0x00, 0x2F, 0x00,
-    0x0B, 0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xD0,
-    0x2F, 0x00, 0x00, 0x7D, 0x17, 0xF5, 0x50, 0x07, 0xE7, 0xFF, 0xFF, 0x00, 0x3D, 0x02, 0xF0, 0x00,
-    0x07, 0xD0, 0x2F, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xF4, 0x02,
-    0xF0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0xBF, 0x0E, 0x00, 0x00,
-    0x03, 0xEF, 0xFC, 0x00, 0x00, 0x0E, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x05, 0x55, 0x7F, 0xF4, 0x00, 0x3F, 0xFE, 0x1F, 0xF0, 0x00, 0x1F,
-    0x80, 0x2F, 0xE0, 0x00, 0x2D, 0x00, 0xBF, 0xD0, 0x00, 0xB4, 0x02, 0xDB, 0xC0, 0x02, 0xD0, 0x0B,
-    0x4F, 0xC0, 0x0B, 0x40, 0x2D, 0x1F, 0x80, 0x2D, 0x00, 0xB4, 0x2F, 0x00, 0xB4, 0x02, 0xD0, 0x3F,
-    0x02, 0xD0, 0x0B, 0x40, 0x7E, 0x0B, 0x40, 0x2D, 0x00, 0xBD, 0x2D, 0x00, 0xB4, 0x00, 0xFC, 0xB4,
-    0x02, 0xD0, 0x00, 0xFA, 0xD0, 0x0B, 0x40, 0x01, 0xFF, 0x40, 0x2D, 0x00, 0x03, 0xFD, 0x02, 0xFE,
-    0x40, 0x03, 0xF4, 0x3F, 0xFF, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43, 0xF0,
-    0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0B,
-    0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F, 0xC0,
-    0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43,
-    0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E,
-    0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F,
-    0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xF0, 0xB8,
-    0x00, 0x00, 0x38, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F,
-    0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00,
-    0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC,
-    0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00,
-    0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x05, 0x01, 0x00, 0x00, 0x03, 0xFC, 0x38, 0x00, 0x00, 0x3E, 0xFF, 0x80, 0x00, 0x03, 0x47,
-    0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00,
-    0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC,
-    0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00,
-    0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE,
-    0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x28, 0x07, 0x40, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x3F, 0x91, 0xBF, 0xC0, 0x0F, 0xD0, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xBC,
-    0xFC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00,
-    0x00, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0x43, 0xF8, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x01, 0xFC, 0x00,
-    0x7F, 0xEA, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x1C, 0x7C, 0x07, 0xC1, 0xF1, 0xF0, 0x07, 0xFC, 0x00, 0x2F, 0x00, 0x07, 0xFC, 0x01, 0xF1,
-    0xF0, 0x7C, 0x07, 0xCB, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x10, 0x00, 0xBF,
-    0xFF, 0xE1, 0xE0, 0x0F, 0xE4, 0x6F, 0xFE, 0x00, 0xFD, 0x00, 0x0F, 0xF0, 0x0B, 0xD0, 0x00, 0x2F,
-    0xD0, 0x3F, 0x00, 0x02, 0xFF, 0xC1, 0xF4, 0x00, 0x2E, 0x3F, 0x0B, 0xC0, 0x02, 0xE0, 0xFC, 0x2F,
-    0x00, 0x2E, 0x02, 0xF4, 0xFC, 0x02, 0xE0, 0x0B, 0xC3, 0xF0, 0x2E, 0x00, 0x2F, 0x0B, 0xD2, 0xE0,
-    0x00, 0xFC, 0x2F, 0xAE, 0x00, 0x03, 0xE0, 0x3F, 0xE0, 0x00, 0x2F, 0x40, 0xFF, 0x00, 0x00, 0xFC,
-    0x02, 0xFE, 0x00, 0x1F, 0xC0, 0x2E, 0xFF, 0xAB, 0xFC, 0x00, 0xE0, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x40, 0x01, 0x55, 0x5F, 0xFF, 0x40, 0x3F, 0xFE, 0x1B, 0xE0, 0x00, 0x1F, 0xC0, 0x0F,
-    0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0,
-    0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF8,
-    0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01, 0xF8, 0x00, 0x0F, 0xFE, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x01, 0x55, 0x5F, 0xFF, 0x40, 0x3F,
-    0xFE, 0x1B, 0xE0, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00,
-    0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E,
-    0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x07,
-    0xF0, 0x01, 0xF8, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x0F, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x40, 0x01, 0x55, 0x5F, 0xFF, 0x40, 0x3F, 0xFE, 0x1B, 0xE0, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0,
-    0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x03,
-    0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01, 0xF8, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0A, 0x01, 0xE0, 0x00, 0x00, 0x7E,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x50, 0x00, 0x55, 0x57, 0xFF, 0xD0, 0x0F, 0xFF, 0x86, 0xF8, 0x00, 0x07, 0xF0, 0x03,
-    0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00,
-    0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8,
-    0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3E,
-    0x00, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xBF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x15, 0x56, 0xFF, 0xF8, 0x1F, 0xFE, 0x1F, 0xE0, 0x00,
-    0xBD, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x7D,
-    0x0B, 0x80, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xFF, 0xE4, 0x00, 0xBE, 0xAF, 0xF0, 0x0B, 0xC0, 0x1F, 0xC0, 0xBC, 0x00, 0xBC, 0x0B, 0xC0, 0x07,
-    0xD0, 0xBC, 0x00, 0x3D, 0x0B, 0xC0, 0x07, 0xC0, 0xBC, 0x00, 0xF8, 0x0B, 0xC0, 0x7F, 0x00, 0xBF,
-    0xFF, 0x80, 0x0B, 0xE9, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x7E, 0x5F, 0xD0, 0x00, 0xF4, 0x03, 0xE0,
-    0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x02, 0xE0, 0x03, 0xD0, 0x07, 0xC0, 0x03, 0xD0, 0x1F, 0x00,
-    0x03, 0xD0, 0x3C, 0x00, 0x03, 0xD0, 0xB4, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x03, 0xD0, 0x7F, 0x00,
-    0x03, 0xD0, 0x2F, 0xD0, 0x03, 0xD0, 0x0B, 0xF4, 0x03, 0xD0, 0x01, 0xFC, 0x03, 0xD0, 0x00, 0x7C,
-    0x03, 0xD1, 0x00, 0x3C, 0x03, 0xD3, 0x80, 0x7C, 0x0B, 0xD3, 0xE5, 0xF4, 0x3F, 0xD2, 0xFF, 0xD0,
-    0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x80, 0x0B, 0xEA, 0xF8, 0x03, 0xD0, 0x3F, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x6F, 0xFF, 0x00, 0xBF, 0xAB, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0,
-    0x3F, 0x01, 0xFE, 0xBF, 0xFE, 0x2F, 0xF8, 0xBF, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x0B, 0xEA, 0xF8, 0x03, 0xD0, 0x3F, 0x00,
-    0xF0, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x6F, 0xFF, 0x00, 0xBF, 0xAB, 0xC0,
-    0xBC, 0x01, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x3F, 0x01, 0xFE, 0xBF, 0xFE, 0x2F, 0xF8, 0xBF,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3E, 0xF4, 0x00, 0x2E, 0x1F,
-    0x00, 0x1E, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xAB,
-    0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x01, 0xBF,
-    0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC, 0x07, 0xFA,
-    0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x30, 0x01,
-    0xFF, 0xBD, 0x00, 0x70, 0xFF, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFE, 0x00, 0x2F, 0xAB, 0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x02, 0xF0, 0x01, 0xBF, 0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0,
-    0x2F, 0x00, 0xFC, 0x07, 0xFA, 0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x09, 0x01,
-    0x80, 0x0F, 0xC1, 0xF8, 0x02, 0xF0, 0x7E, 0x00, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF8, 0x00, 0xBE, 0xAF, 0x80, 0x3D, 0x03, 0xF0, 0x0F, 0x00, 0x7C, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x06, 0xFF, 0xF0, 0x0B, 0xFA, 0xBC, 0x0B, 0xC0, 0x1F, 0x02, 0xF0,
-    0x07, 0xC0, 0xBC, 0x03, 0xF0, 0x1F, 0xEB, 0xFF, 0xE2, 0xFF, 0x8B, 0xF0, 0x05, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x74, 0xB4, 0x00, 0x2C, 0x1D, 0x00, 0x0B, 0x47, 0x40, 0x00,
-    0xFF, 0xC0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x0B, 0xEA, 0xF8, 0x03,
-    0xD0, 0x3F, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x6F, 0xFF, 0x00,
-    0xBF, 0xAB, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x3F, 0x01, 0xFE, 0xBF, 0xFE,
-    0x2F, 0xF8, 0xBF, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x0B, 0xFD,
-    0x02, 0xFA, 0xBD, 0xFA, 0xFD, 0x0F, 0x40, 0xFF, 0x40, 0xFC, 0x3C, 0x01, 0xF8, 0x01, 0xF0, 0x00,
-    0x07, 0xD0, 0x07, 0xD0, 0x00, 0x6F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xEA, 0x54, 0x2F, 0x91, 0xF0,
-    0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0xBF, 0x80, 0x04,
-    0x7F, 0xAF, 0xBF, 0xFF, 0xF0, 0xBF, 0xF4, 0x2F, 0xFF, 0x40, 0x14, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0xBE, 0xBF, 0x4B, 0xC0, 0x3E, 0x3C, 0x00, 0xB6, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x01, 0x50, 0x00, 0x1A, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x3D,
-    0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x3F, 0xAF, 0xC3, 0xE0, 0x0F, 0x9F, 0x00, 0x2F, 0xB8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBD, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBC, 0x00, 0x07,
-    0xD0, 0x00, 0x3D, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x3F,
-    0xAF, 0xC3, 0xE0, 0x0F, 0x9F, 0x00, 0x2F, 0xB8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD,
-    0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x0B, 0xFF, 0xE0,
-    0x00, 0x54, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xBC, 0x00, 0xF0, 0xF4, 0x0F, 0x40,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0F, 0xEB, 0xF0, 0xF8, 0x03, 0xE7, 0xC0,
-    0x0B, 0xEE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xBC,
-    0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x82, 0xFF, 0xF8, 0x00, 0x15, 0x00, 0x06, 0x00, 0x90,
-    0x7E, 0x0F, 0xC0, 0xF8, 0x3F, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x03, 0xFA, 0xFC, 0x3E, 0x00, 0xF9, 0xF0, 0x02, 0xFB, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFB, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0xBF,
-    0xFE, 0x00, 0x05, 0x40, 0x10, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0xBD, 0x00, 0xF8, 0x03, 0xE0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE, 0x03, 0xD0, 0x0B, 0xF4, 0x1F, 0xBC, 0x3D, 0x2E,
-    0xB4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE,
-    0x18, 0x02, 0x43, 0xF0, 0xFC, 0x3F, 0x0B, 0xC0, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xF8, 0x01, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8,
-    0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x2F, 0xE4, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x1C, 0x00, 0x2F, 0x6E, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0xF4, 0xF4, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x01, 0xFF, 0x7D, 0x03, 0xFF, 0xFF,
-    0xC2, 0xF4, 0x07, 0xF0, 0xF4, 0x00, 0xBD, 0xBC, 0x00, 0x0F, 0xBE, 0x00, 0x03, 0xEF, 0x80, 0x00,
-    0xBB, 0xE0, 0x00, 0x2E, 0xFC, 0x00, 0x0F, 0x6F, 0x40, 0x03, 0xC3, 0xF0, 0x03, 0xE0, 0xBF, 0x9B,
-    0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xC0,
-    0x00, 0x07, 0xFE, 0xB4, 0x00, 0x01, 0xD3, 0xFC, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x0B, 0xFE, 0x00, 0x7F, 0xEF, 0xFF, 0xD0, 0x01, 0xFE,
-    0x01, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00,
-    0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
-    0x00, 0xF8, 0x00, 0x7C, 0x00, 0xBF, 0x80, 0x3F, 0xA0, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x40, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xFE, 0xFF, 0x42, 0xF0, 0x07,
-    0xF1, 0xF0, 0x00, 0xBD, 0xBC, 0x00, 0x0F, 0xBE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00,
-    0x3E, 0xFC, 0x00, 0x0F, 0xAF, 0x40, 0x03, 0xC3, 0xF0, 0x03, 0xE0, 0xBF, 0x9B, 0xF0, 0x07, 0xFF,
-    0xE0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x03, 0xFE, 0xFF, 0x42, 0xF0, 0x07, 0xF1, 0xF0, 0x00, 0xBD, 0xBC, 0x00, 0x0F, 0xBE,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3E, 0xFC, 0x00, 0x0F, 0xAF, 0x40, 0x03, 0xC3,
-    0xF0, 0x03, 0xE0, 0xBF, 0x9B, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xBD, 0x00, 0x0B, 0x87, 0xC0, 0x07, 0xC0, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFB, 0xFD, 0x0B, 0xC0, 0x1F, 0xC7, 0xC0, 0x02,
-    0xF6, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFB, 0xF0, 0x00,
-    0x3E, 0xBD, 0x00, 0x0F, 0x0F, 0xC0, 0x0F, 0x82, 0xFE, 0x6F, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0C, 0x00, 0x7F, 0xEF, 0x40, 0x1C, 0x3F, 0xC0, 0x01,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFB, 0xFD, 0x0B,
-    0xC0, 0x1F, 0xC7, 0xC0, 0x02, 0xF6, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0xFB, 0xF0, 0x00, 0x3E, 0xBD, 0x00, 0x0F, 0x0F, 0xC0, 0x0F, 0x82, 0xFE, 0x6F, 0xC0,
-    0x1F, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x02, 0x40, 0x60, 0x02, 0xF4, 0x7E, 0x00, 0xBC, 0x1F,
-    0x80, 0x04, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xEF,
-    0xF4, 0x2F, 0x00, 0x7F, 0x1F, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFE, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0xFA, 0xF4, 0x00, 0x3C, 0x3F, 0x00, 0x3E, 0x0B, 0xF9,
-    0xBF, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xD0,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x57, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xE1, 0xC0, 0x3F, 0xAF, 0xFE, 0x02, 0xF0, 0x07, 0xF0, 0x1F, 0x00, 0x2F, 0xD0, 0xBC,
-    0x02, 0xEF, 0x83, 0xE0, 0x2E, 0x3F, 0x0F, 0x82, 0xE0, 0xBC, 0x3E, 0x2E, 0x02, 0xE0, 0xFE, 0xE0,
-    0x0F, 0x82, 0xFE, 0x00, 0x3C, 0x03, 0xF0, 0x02, 0xE0, 0x2F, 0xF9, 0xBF, 0x00, 0xE7, 0xFF, 0xE0,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2B, 0xE0, 0x2F, 0xF0, 0x0F, 0xF4, 0x00,
-    0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4,
-    0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00,
-    0xF4, 0x00, 0x7D, 0x00, 0xFD, 0x00, 0x0F, 0xFB, 0xFF, 0xE4, 0x00, 0xFF, 0xE2, 0xFF, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2B, 0xE0, 0x2F, 0xF0, 0x0F, 0xF4, 0x00, 0xBC, 0x00,
-    0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC,
-    0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00,
-    0x7D, 0x00, 0xFD, 0x00, 0x0F, 0xFB, 0xFF, 0xE4, 0x00, 0xFF, 0xE2, 0xFF, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x01, 0xF0,
-    0xF0, 0x00, 0x00, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0xAF, 0x80, 0xBF, 0xC0, 0x3F, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D,
-    0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x03, 0xF4, 0x00, 0x3F, 0xEF,
-    0xFF, 0x90, 0x03, 0xFF, 0x8B, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x50, 0x18, 0x00, 0x00,
-    0x7E, 0x0F, 0xC0, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xBE, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0x0B, 0xC0, 0x03,
-    0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0,
-    0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x07,
-    0xD0, 0x0F, 0xD0, 0x00, 0xFF, 0xBF, 0xFE, 0x40, 0x0F, 0xFE, 0x2F, 0xF0, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x2F, 0xF8, 0xFF, 0x90, 0x6F, 0xD0, 0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0x0F,
-    0x40, 0x0B, 0xC0, 0x3C, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C, 0x78, 0x00,
-    0x00, 0xF7, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x5B, 0xF8, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x06, 0xFD, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF5, 0xFF, 0xC0, 0x03, 0xEF, 0xFF, 0xC0, 0x0F, 0xE0, 0x2F, 0xC0, 0x3D, 0x00, 0x3F, 0x00,
-    0xF4, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0xF4, 0x0F, 0x40, 0x03, 0xD0, 0x3D, 0x00, 0x0F, 0x40, 0xF4,
-    0x00, 0x7C, 0x03, 0xD0, 0x02, 0xF0, 0x0F, 0x40, 0x2F, 0x40, 0x3F, 0xEB, 0xF4, 0x00, 0xFF, 0xFE,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x01, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x90, 0x14, 0x00, 0x0F, 0xC2, 0xF4, 0x00,
-    0x3F, 0x0B, 0xD0, 0x00, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x82, 0xFF, 0x8F, 0xF9, 0x06, 0xFD, 0x0F, 0x80, 0x03, 0xD0, 0x2F, 0x00, 0x1F, 0x00, 0x3D, 0x00,
-    0xF4, 0x00, 0xBC, 0x03, 0xC0, 0x01, 0xF0, 0x2E, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x07, 0xC7, 0x80,
-    0x00, 0x0F, 0x7C, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x05, 0xBF, 0x80, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x00, 0xB4, 0xF4, 0x00, 0x00, 0x03, 0xC3, 0xF0, 0x00, 0x00,
-    0x1E, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x2E, 0x55,
-    0xBD, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xEA, 0xAB, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xD0,
-    0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x8F, 0xFF,
-    0x40, 0x3F, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFA, 0xBE, 0x00, 0xF4, 0x0F, 0xC0, 0x3C, 0x01,
-    0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x1B, 0xFF, 0xC0, 0x2F, 0xEA, 0xF0, 0x2F, 0x00,
-    0x7C, 0x0B, 0xC0, 0x1F, 0x02, 0xF0, 0x0F, 0xC0, 0x7F, 0xAF, 0xFF, 0x8B, 0xFE, 0x2F, 0xC0, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x03, 0xF9, 0xB8, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00, 0x0F, 0x0F, 0xC0, 0x00,
-    0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0xB9,
-    0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF, 0xC0, 0x00, 0xF4, 0x00, 0x1F,
-    0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x00, 0x0B, 0xFE, 0x3F,
-    0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0x00, 0x30, 0x01, 0xF4, 0x2C, 0x00, 0x3F, 0xFE,
-    0x00, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xAB,
-    0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x01, 0xBF,
-    0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC, 0x07, 0xFA,
-    0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xDF, 0x00,
-    0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0,
-    0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFA, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xE0, 0x02, 0xFA, 0xBE, 0x00, 0xF4, 0x0F, 0xC0, 0x3C, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x00, 0x1B, 0xFF, 0xC0, 0x2F, 0xEA, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x1F, 0x02, 0xF0,
-    0x0F, 0xC0, 0x7F, 0xAF, 0xFF, 0x8B, 0xFE, 0x2F, 0xC0, 0x14, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x7E, 0x50, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF9, 0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F,
-    0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xE0, 0x00,
-    0x3E, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x2F, 0xAF, 0xD2,
-    0xF0, 0x0F, 0x8F, 0x00, 0x2D, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x07, 0xFF, 0xF0, 0x00, 0x54,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xBD, 0x00, 0x03, 0xD1, 0xF0, 0x00,
-    0xB4, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF9, 0x5F,
-    0xC0, 0xFC, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06, 0x07, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xFC, 0x00, 0x1F,
-    0xBC, 0x00, 0xF0, 0xB8, 0x0B, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x0B,
-    0xEB, 0xF4, 0xBC, 0x03, 0xE3, 0xC0, 0x0B, 0x6F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xC1, 0xFF, 0xFC,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03,
-    0xF9, 0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06,
-    0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xF8,
-    0x00, 0x0B, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x02, 0xFA,
-    0xFD, 0x2F, 0x00, 0xF8, 0xF0, 0x02, 0xDB, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x7F, 0xFF, 0x00,
-    0x05, 0x40, 0x00, 0x90, 0x07, 0x40, 0x0F, 0x41, 0xF0, 0x00, 0x7E, 0x7C, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF9,
-    0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06, 0x07,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0xC0,
-    0xB8, 0x3C, 0x00, 0xF6, 0xD0, 0x00, 0xFE, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x2F, 0xAF, 0xD2, 0xF0, 0x0F, 0x8F, 0x00, 0x2D, 0xBC, 0x00, 0x03, 0xE0, 0x00,
-    0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFF, 0x07, 0xFF, 0xF0, 0x00, 0x54, 0x00, 0x02, 0x40, 0x1E, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0xA9, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xC5, 0x6F, 0xF0, 0x02, 0xF0, 0x00,
-    0xBF, 0x00, 0xBC, 0x00, 0x0B, 0xE0, 0x2F, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x2F, 0x42, 0xF0,
-    0x00, 0x07, 0xD0, 0xBC, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x1F, 0x42,
-    0xF0, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xFC,
-    0x02, 0xF0, 0x01, 0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xC0, 0x00, 0x2F, 0xF0, 0xF4, 0x00,
-    0x00, 0xBC, 0x3C, 0x00, 0x00, 0x2F, 0x0E, 0x00, 0x00, 0x0B, 0xC3, 0x40, 0x00, 0x02, 0xF0, 0x80,
-    0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x03, 0xD0, 0x02, 0xF0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x02,
-    0xF0, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x02, 0xFE,
-    0xBF, 0xFA, 0x00, 0x2F, 0xFD, 0x3F, 0xD0, 0x00, 0x50, 0x04, 0x00, 0x00, 0x01, 0x6A, 0xA4, 0x00,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xF1, 0x5B, 0xFC, 0x00, 0x2F, 0x00, 0x0B, 0xF0, 0x02, 0xF0,
-    0x00, 0x2F, 0x80, 0x2F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0x7D,
-    0x17, 0xF5, 0x50, 0x07, 0xE7, 0xFF, 0xFF, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x2F, 0x00,
-    0x00, 0x7C, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0x3F, 0x00,
-    0x2F, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2B, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x0A, 0xBF, 0xA0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x1A, 0xAF, 0xC0,
-    0x07, 0xFF, 0xFF, 0x00, 0x7E, 0x46, 0xFC, 0x03, 0xE0, 0x02, 0xF0, 0x2F, 0x00, 0x0B, 0xC0, 0xF8,
-    0x00, 0x2F, 0x03, 0xE0, 0x00, 0xBC, 0x0F, 0x80, 0x02, 0xF0, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00,
-    0x2F, 0x01, 0xFC, 0x01, 0xFC, 0x03, 0xFE, 0xBF, 0xFA, 0x02, 0xFF, 0xD3, 0xFD, 0x00, 0x50, 0x04,
-    0x00, 0x00, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA, 0xBC, 0x0B, 0xC0, 0x02,
-    0xC0, 0xBC, 0x00, 0x1C, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBE,
-    0xAF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0xA0, 0xBC, 0x00, 0x0F, 0x0B, 0xC0, 0x01, 0xE2, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0xFE, 0xBF, 0x0F, 0x80, 0x3E, 0x7C, 0x00, 0xBE, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFF,
-    0xF8, 0x2F, 0xFF, 0x80, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x03, 0xF9,
-    0xB8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00,
-    0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x38, 0x01,
-    0x80, 0xF8, 0x1E, 0x01, 0xFF, 0xF0, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x0F, 0xEB, 0xF0, 0xF8, 0x03, 0xE7, 0xC0, 0x0B, 0xEE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xEF, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x82,
-    0xFF, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC,
-    0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x3C, 0x00, 0x02, 0xF8, 0x00, 0x0B,
-    0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x03, 0xFA, 0xFC, 0x3E,
-    0x00, 0xF9, 0xF0, 0x02, 0xFB, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xD0, 0x00, 0x0F,
-    0x80, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0xBF, 0xFE, 0x00, 0x05, 0x40,
-    0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0,
-    0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00,
-    0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0xE8, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xFE, 0xBF, 0x0F, 0x80, 0x3E, 0x7C,
-    0x00, 0xBE, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x2F, 0xFF, 0xC0, 0x01, 0xB8, 0x00, 0x03, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0x7E, 0x50, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x06, 0x00, 0x2C, 0x00, 0x7C,
-    0x0F, 0x80, 0x02, 0xF7, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0,
-    0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00,
-    0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x38, 0x07, 0xC0, 0xF4, 0x3C, 0x00, 0xF7, 0xD0, 0x01, 0xFE, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x3F, 0xAF, 0xC3, 0xE0, 0x0F, 0x9F, 0x00, 0x2F,
-    0xB8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x0B, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x3C, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x02, 0xFE, 0x56, 0xF8,
-    0x0B, 0xD0, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x78, 0x3E, 0x00, 0x00, 0x30, 0x7D, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF,
-    0xBC, 0x00, 0x1A, 0xFD, 0xBD, 0x00, 0x00, 0x7C, 0x7F, 0x00, 0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7C,
-    0x1F, 0xE0, 0x00, 0x7C, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xEF, 0x00, 0x00, 0x3C, 0x3E, 0x00, 0x02,
-    0xD0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFA,
-    0xFE, 0xF0, 0x3E, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x07, 0xC0, 0x0F, 0x40, 0x2F,
-    0x00, 0x2F, 0x41, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xE6, 0x90, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF4, 0x1F, 0x00, 0x07, 0xE0, 0xF0,
-    0x00, 0x0B, 0x87, 0xC0, 0x00, 0x3C, 0x0F, 0xD0, 0x0B, 0xE0, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x3F, 0x9B, 0x80, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x7F,
-    0xFF, 0xF8, 0x02, 0xFE, 0x56, 0xF8, 0x0B, 0xD0, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x78, 0x3E, 0x00,
-    0x00, 0x30, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xBC, 0x00, 0x1A, 0xFD, 0xBD, 0x00, 0x00, 0x7C, 0x7F, 0x00,
-    0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7C, 0x1F, 0xE0, 0x00, 0x7C, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x30, 0x00, 0x3E, 0x07,
-    0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFA, 0xFE, 0xF0, 0x3E, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x03,
-    0xD0, 0x07, 0xC0, 0x0F, 0x40, 0x2F, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xE6,
-    0x90, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xF4, 0x1F, 0x00, 0x07, 0xE0, 0xF0, 0x00, 0x0B, 0x87, 0xC0, 0x00, 0x3C, 0x0F, 0xD0, 0x0B, 0xE0,
-    0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x02, 0xFE, 0x56, 0xF8, 0x0B, 0xD0, 0x00, 0xB8,
-    0x1F, 0x40, 0x00, 0x78, 0x3E, 0x00, 0x00, 0x30, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xBC, 0x00, 0x1A, 0xFD,
-    0xBD, 0x00, 0x00, 0x7C, 0x7F, 0x00, 0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7C, 0x1F, 0xE0, 0x00, 0x7C,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFE, 0xBF, 0xBC, 0x0F, 0x80, 0x3E, 0x00, 0x3D, 0x00,
-    0x7C, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0x7E, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0xB9, 0xA4, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFD, 0x07, 0xC0, 0x01, 0xF8, 0x3C, 0x00, 0x02, 0xE1, 0xF0, 0x00, 0x0F, 0x03, 0xF4,
-    0x02, 0xF8, 0x07, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x7F,
-    0xFF, 0xF8, 0x02, 0xFE, 0x56, 0xF8, 0x0B, 0xD0, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x78, 0x3E, 0x00,
-    0x00, 0x30, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xBC, 0x00, 0x1A, 0xFD, 0xBD, 0x00, 0x00, 0x7C, 0x7F, 0x00,
-    0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7C, 0x1F, 0xE0, 0x00, 0x7C, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xAF, 0xEF, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3D,
-    0x00, 0x7C, 0x00, 0xF4, 0x02, 0xF0, 0x02, 0xF4, 0x1F, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x2E, 0x69,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF,
-    0x41, 0xF0, 0x00, 0x7E, 0x0F, 0x00, 0x00, 0xB8, 0x7C, 0x00, 0x03, 0xC0, 0xFD, 0x00, 0xBE, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x00, 0x1D, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x05, 0x55, 0x7F, 0xFF, 0x00, 0x7F, 0xFE, 0x1F, 0xD0, 0x00,
-    0x5F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0,
-    0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00,
-    0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x02,
-    0xFF, 0x80, 0x06, 0xFE, 0x7F, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x3C, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0xFD, 0x00, 0x00, 0xFB, 0xFF, 0xF0, 0x00, 0x0F, 0xE0, 0x2F,
-    0x80, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x0F,
-    0x40, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0xBC,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x06, 0xFE, 0x01, 0xFE, 0x41, 0xFF, 0xF0, 0x7F, 0xFC, 0x15, 0x55,
-    0x00, 0x15, 0x55, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x7F, 0x40, 0x01, 0x7E, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0x80, 0x2B, 0xFA, 0xAA, 0xAB, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0x80, 0x0B, 0xFE, 0x00, 0x1B, 0xF9, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x40, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x6B, 0xFA,
-    0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x06, 0xA4, 0x00, 0x03,
-    0xDF, 0xFF, 0xC0, 0x00, 0xFF, 0x9B, 0xF4, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x0B, 0xC0,
-    0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B,
-    0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x01, 0xBF, 0x80, 0x7F, 0x91, 0xFF, 0xF0,
-    0x7F, 0xFC, 0x05, 0x01, 0x0F, 0xF0, 0xE7, 0xEF, 0xF8, 0xD1, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x01,
-    0x55, 0x50, 0xFF, 0xFD, 0x07, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0xBF, 0xE0, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xC2, 0x8F, 0xFE, 0xF3, 0xC7,
-    0xF8, 0x10, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x7F, 0xE0, 0x00, 0xF8, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
-    0x00, 0xBF, 0x91, 0xFF, 0xF8, 0x05, 0x55, 0x0F, 0xFF, 0xE3, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x43, 0xFF, 0xF4, 0x1F, 0xD0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00,
-    0x0B, 0xC0, 0x02, 0xF0, 0x02, 0xFF, 0x83, 0xFF, 0xF4, 0xBF, 0xFF, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x07, 0xFE, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x0B, 0xF9, 0x1F,
-    0xFF, 0x80, 0x10, 0x00, 0x1E, 0x00, 0xA3, 0xF5, 0xF4, 0x7F, 0xF8, 0x01, 0x50, 0x00, 0x00, 0x01,
-    0x55, 0x50, 0xFF, 0xFD, 0x07, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0xBF, 0xE0, 0xFF, 0xFD, 0x00, 0x00, 0xB0, 0x03, 0xFD, 0x1F, 0x7F, 0xFC,
-    0x0B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE,
-    0x55, 0x54, 0xFF, 0xFD, 0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x2F, 0xF8, 0xFF, 0xFD, 0x07, 0x80, 0x1E, 0x00, 0x3E, 0x00, 0x2F, 0xA4, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE, 0x00, 0xF4, 0x03, 0xC0, 0x07, 0xC0, 0x03, 0xE5,
-    0x01, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x54, 0xFF, 0xFD, 0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x2F, 0xF8, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE,
-    0x55, 0x54, 0x15, 0x55, 0x3F, 0xFF, 0x4F, 0xFF, 0xD1, 0xFD, 0x01, 0x7F, 0x40, 0x2F, 0x00, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x2F,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x0B, 0xC0, 0x2F, 0xF8, 0x03, 0xF0, 0x3F, 0xFF, 0x40, 0xF8, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xBC, 0x0B, 0xF0, 0x0F,
-    0xD0, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE,
-    0x02, 0xFC, 0x7F, 0xE0, 0xBF, 0xC0, 0x3E, 0x00, 0x7C, 0x03, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0x7C,
-    0x03, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0x7C, 0x03, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0x7C, 0x03, 0xE0,
-    0x07, 0xC0, 0x3E, 0x00, 0x7C, 0x0B, 0xF9, 0x07, 0xC7, 0xFF, 0xE0, 0x7C, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x28, 0x00, 0x0F, 0xE0, 0x02, 0xFF, 0xC0, 0xB8, 0x3E, 0x0E, 0x00, 0xA0, 0x00, 0x00,
-    0x05, 0x55, 0x40, 0xFF, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC,
-    0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00,
-    0x1F, 0x00, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F,
-    0xF0, 0x02, 0xEF, 0x80, 0x7C, 0x3C, 0x0F, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x0B, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00,
-    0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C,
-    0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x02, 0xE0, 0x00, 0x55, 0x54, 0x05,
-    0x55, 0x0F, 0xFF, 0xC0, 0xFF, 0xF4, 0x1F, 0xD0, 0x02, 0xF8, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x0B,
-    0xC0, 0x2F, 0x40, 0x00, 0xBC, 0x0B, 0xD0, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0xBC, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0xBC,
-    0x7F, 0x00, 0x00, 0x0B, 0xC2, 0xFC, 0x00, 0x00, 0xBC, 0x0B, 0xF0, 0x00, 0x0B, 0xC0, 0x2F, 0xC0,
-    0x00, 0xBC, 0x00, 0xBF, 0x40, 0x2F, 0xF8, 0x02, 0xFE, 0x0F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xFD, 0x03, 0xC0, 0xBF, 0xE0,
-    0x0F, 0x00, 0xF8, 0x00, 0x3C, 0x1F, 0x80, 0x00, 0xF1, 0xF4, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x0F,
-    0x7E, 0x00, 0x00, 0x3C, 0x7D, 0x00, 0x00, 0xF0, 0xBD, 0x00, 0x03, 0xC0, 0xFD, 0x00, 0x0F, 0x00,
-    0xFE, 0x01, 0xBE, 0x40, 0xFE, 0x1F, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0xBF, 0xF8, 0x7F, 0xD0, 0x6F, 0xF4,
-    0x03, 0xD0, 0x2F, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x03, 0xEF, 0xC0, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x03, 0xDB, 0xE0, 0x00, 0x03, 0xD3, 0xF4, 0x00, 0x03, 0xD0, 0xFE, 0x00,
-    0x03, 0xD0, 0x3F, 0x80, 0x0B, 0xF4, 0x0F, 0xF0, 0x3F, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x08, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0E, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x2E, 0x2F, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2C, 0x02, 0xFC, 0x2F, 0xF4, 0x3A, 0x40, 0x00, 0x00,
-    0x00, 0x40, 0x2F, 0xD0, 0x6F, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x1B, 0xF9, 0xBF, 0xFE, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0E, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x2E,
-    0x2F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x40, 0x2F, 0xD0, 0x6F, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x1B, 0xF9, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x03, 0xE0, 0x02, 0xE0,
-    0x03, 0xD0, 0x07, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x55, 0x54, 0x1F,
-    0x0F, 0xFF, 0xD2, 0xE0, 0x1F, 0xD0, 0x2C, 0x00, 0xBC, 0x02, 0x80, 0x0B, 0xC0, 0x10, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0E, 0x0B, 0xC0,
-    0x00, 0xF0, 0xBC, 0x00, 0x2E, 0x2F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x40, 0x42, 0xFD,
-    0x0F, 0x6F, 0xD0, 0xF0, 0x3D, 0x1E, 0x03, 0xD1, 0xD0, 0x3D, 0x2C, 0x03, 0xD0, 0x40, 0x3D, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03,
-    0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x1B, 0xF9, 0x0B, 0xFF, 0xE0, 0x55, 0x54,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x0A, 0x00, 0xBC, 0x02, 0xF8, 0x0B, 0xC0, 0x2F, 0x80, 0xBC, 0x00,
-    0xA0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0E, 0x0B,
-    0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x2E, 0x2F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x40, 0x00,
-    0x2F, 0xD0, 0x00, 0x6F, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03,
-    0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x38, 0x03, 0xD0, 0xBE, 0x03, 0xD0,
-    0xBD, 0x03, 0xD0, 0x14, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00,
-    0x03, 0xD0, 0x00, 0x1B, 0xF9, 0x00, 0xBF, 0xFE, 0x00, 0x05, 0x55, 0x40, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xBC, 0x14, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x28, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x0E, 0x00, 0xBC, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x2E, 0x02, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x10, 0x00, 0xBF, 0x40, 0x1B, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40,
-    0x00, 0xF4, 0x00, 0x0F, 0x48, 0x00, 0xFB, 0xC0, 0x0F, 0xE0, 0x01, 0xF8, 0x00, 0x7F, 0x40, 0x2F,
-    0xF4, 0x03, 0x4F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x06, 0xFE,
-    0x42, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x05, 0x55, 0x7F, 0xF4, 0x00, 0x3F, 0xFE, 0x1F, 0xF0, 0x00, 0x1F, 0x80, 0x2F, 0xE0,
-    0x00, 0x2D, 0x00, 0xBF, 0xD0, 0x00, 0xB4, 0x02, 0xDB, 0xC0, 0x02, 0xD0, 0x0B, 0x4F, 0xC0, 0x0B,
-    0x40, 0x2D, 0x1F, 0x80, 0x2D, 0x00, 0xB4, 0x2F, 0x00, 0xB4, 0x02, 0xD0, 0x3F, 0x02, 0xD0, 0x0B,
-    0x40, 0x7E, 0x0B, 0x40, 0x2D, 0x00, 0xBD, 0x2D, 0x00, 0xB4, 0x00, 0xFC, 0xB4, 0x02, 0xD0, 0x00,
-    0xFA, 0xD0, 0x0B, 0x40, 0x01, 0xFF, 0x40, 0x2D, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x40, 0x03, 0xF4,
-    0x3F, 0xFF, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC2, 0xFF, 0x80,
-    0x1F, 0xFB, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xE0, 0x01,
-    0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0,
-    0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x2F, 0xE0, 0x0F, 0xE8, 0x3F,
-    0xFD, 0x0F, 0xFF, 0x00, 0x55, 0x40, 0x00, 0x55, 0x57, 0xFF, 0x40, 0x03, 0xFF, 0xE1, 0xFF, 0x00,
-    0x01, 0xF8, 0x02, 0xFE, 0x00, 0x02, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0x40, 0x2D, 0xBC, 0x00, 0x2D,
-    0x00, 0xB4, 0xFC, 0x00, 0xB4, 0x02, 0xD1, 0xF8, 0x02, 0xD0, 0x0B, 0x42, 0xF0, 0x0B, 0x40, 0x2D,
-    0x03, 0xF0, 0x2D, 0x00, 0xB4, 0x07, 0xE0, 0xB4, 0x02, 0xD0, 0x0B, 0xD2, 0xD0, 0x0B, 0x40, 0x0F,
-    0xCB, 0x40, 0x2D, 0x00, 0x0F, 0xAD, 0x00, 0xB4, 0x00, 0x1F, 0xF4, 0x02, 0xD0, 0x00, 0x3F, 0xD0,
-    0x2F, 0xE4, 0x00, 0x3F, 0x43, 0xFF, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xF0, 0xBF, 0xE0, 0x07, 0xFE, 0xFF, 0xFD, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x03, 0xE0, 0x02, 0xF0,
-    0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01,
-    0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x0B, 0xF8,
-    0x03, 0xFA, 0x0F, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0xC0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x02,
-    0xF7, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x05, 0x55, 0x7F, 0xF4, 0x00, 0x3F, 0xFE, 0x1F, 0xF0, 0x00, 0x1F, 0x80,
-    0x2F, 0xE0, 0x00, 0x2D, 0x00, 0xBF, 0xD0, 0x00, 0xB4, 0x02, 0xDB, 0xC0, 0x02, 0xD0, 0x0B, 0x4F,
-    0xC0, 0x0B, 0x40, 0x2D, 0x1F, 0x80, 0x2D, 0x00, 0xB4, 0x2F, 0x00, 0xB4, 0x02, 0xD0, 0x3F, 0x02,
-    0xD0, 0x0B, 0x40, 0x7E, 0x0B, 0x40, 0x2D, 0x00, 0xBD, 0x2D, 0x00, 0xB4, 0x00, 0xFC, 0xB4, 0x02,
-    0xD0, 0x00, 0xFA, 0xD0, 0x0B, 0x40, 0x01, 0xFF, 0x40, 0x2D, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x40,
-    0x03, 0xF4, 0x3F, 0xFF, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x02, 0xD0, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC2,
-    0xFF, 0x80, 0x1F, 0xFB, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03,
-    0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0,
-    0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x2F, 0xE0, 0x0F,
-    0xE8, 0x3F, 0xFD, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x1B, 0xC7, 0xFF, 0x40, 0x0E, 0x02,
-    0xFF, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40,
-    0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFE, 0x01, 0xFE, 0x40, 0x00, 0x3F,
-    0xFC, 0x0F, 0xFF, 0x00, 0x55, 0x40, 0x00, 0x55, 0x57, 0xFF, 0x40, 0x03, 0xFF, 0xE1, 0xFF, 0x00,
-    0x01, 0xF8, 0x02, 0xFE, 0x00, 0x02, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0x40, 0x2D, 0xBC, 0x00, 0x2D,
-    0x00, 0xB4, 0xF8, 0x00, 0xB4, 0x02, 0xD1, 0xF4, 0x02, 0xD0, 0x0B, 0x42, 0xF0, 0x0B, 0x40, 0x2D,
-    0x03, 0xE0, 0x2D, 0x00, 0xB4, 0x07, 0xD0, 0xB4, 0x02, 0xD0, 0x0B, 0xC2, 0xD0, 0x0B, 0x40, 0x0F,
-    0x8B, 0x40, 0x2D, 0x00, 0x0F, 0x6D, 0x00, 0xB4, 0x00, 0x1F, 0xF4, 0x02, 0xD0, 0x00, 0x3F, 0xD0,
-    0x2F, 0xE4, 0x00, 0x3F, 0x43, 0xFF, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x06, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x0B, 0xFE, 0x07, 0xFE, 0xFF, 0xFD, 0x01, 0xFE, 0x01,
-    0xFC, 0x03, 0xE0, 0x02, 0xF0, 0x0F, 0x80, 0x07, 0xC0, 0x3E, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x7C,
-    0x03, 0xE0, 0x01, 0xF0, 0x0F, 0x80, 0x07, 0xC0, 0x3E, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x7C, 0x0B,
-    0xF8, 0x01, 0xF0, 0xFF, 0xF4, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x05, 0x55,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0x91, 0xBF,
-    0xC0, 0x0F, 0xD0, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x1F, 0xC7, 0xD0,
-    0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B,
-    0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0xF8, 0x3F, 0x00,
-    0x00, 0x2F, 0x43, 0xF8, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0xEA, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xBF, 0xD0,
-    0xBC, 0x01, 0xFC, 0x7C, 0x00, 0x2F, 0x6F, 0x00, 0x03, 0xEF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F,
-    0xF8, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0xF0, 0xFC, 0x00, 0xF8, 0x2F, 0xE6, 0xFC,
-    0x01, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x80, 0x28, 0x00,
-    0x00, 0x3F, 0x5F, 0x40, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00,
-    0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00,
-    0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC,
-    0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02,
-    0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x09, 0x00, 0x7D,
-    0x0B, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x0F, 0xFB, 0xFD, 0x0B, 0xC0, 0x1F, 0xC7, 0xC0, 0x02, 0xF6, 0xF0, 0x00, 0x3E, 0xF8,
-    0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFB, 0xF0, 0x00, 0x3E, 0xBD, 0x00, 0x0F, 0x0F,
-    0xC0, 0x0F, 0x82, 0xFE, 0x6F, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x01, 0xD0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00,
-    0x3F, 0x07, 0xE0, 0x00, 0x03, 0x40, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0x91, 0xBF, 0xC0, 0x0F, 0xD0, 0x00, 0xBF, 0x02, 0xF4,
-    0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0F,
-    0xCB, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xBD, 0x00,
-    0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0x43, 0xF8, 0x00, 0x03, 0xF0,
-    0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0xEA, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x07, 0x40, 0x03, 0xC3, 0xE0, 0x03, 0xE1, 0xF0, 0x01,
-    0xF0, 0xF4, 0x00, 0xB0, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x03,
-    0xFE, 0xFF, 0x42, 0xF0, 0x07, 0xF1, 0xF0, 0x00, 0xBD, 0xBC, 0x00, 0x0F, 0xBE, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3E, 0xFC, 0x00, 0x0F, 0xAF, 0x40, 0x03, 0xC3, 0xF0, 0x03, 0xE0,
-    0xBF, 0x9B, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xE5, 0x7F, 0xAA, 0xBE, 0x02, 0xF8, 0x00, 0xF8, 0x00,
-    0x38, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0xD0, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x3E,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFA, 0xFF, 0x03, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xC2, 0xF8, 0x00, 0x3E, 0x00, 0x0B,
-    0x03, 0xFD, 0x00, 0xF8, 0x00, 0x3C, 0x02, 0xFF, 0xAB, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x0F, 0xFE, 0x00, 0xFE, 0xBF, 0x5F, 0xEF, 0xE0, 0xF8, 0x02, 0xFF, 0x40, 0x7C, 0x7C, 0x00, 0x3F,
-    0xC0, 0x0F, 0xAF, 0x00, 0x07, 0xE0, 0x03, 0xEF, 0x80, 0x00, 0xFF, 0xFF, 0xFB, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFD, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x02, 0xFC,
-    0x00, 0x01, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xE6, 0xFB, 0xFF, 0xFF, 0x42, 0xFF, 0xF4, 0x2F,
-    0xFF, 0x80, 0x05, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0xA5, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xC1, 0xBF, 0x40, 0x02, 0xF0, 0x03,
-    0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0xF0,
-    0x03, 0xD0, 0x00, 0xBC, 0x0B, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x02,
-    0xF0, 0xFC, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x2F, 0x02, 0xF8, 0x00, 0x0B, 0xC0, 0x3F, 0x40,
-    0x02, 0xF0, 0x03, 0xF8, 0x02, 0xFE, 0x80, 0x7F, 0x83, 0xFF, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3D,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC2, 0xFC, 0x7F, 0xCB, 0xFC,
-    0x07, 0xFE, 0x68, 0x03, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFA, 0x40, 0x7F, 0xFF,
-    0x80, 0x05, 0xAA, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFC, 0x1B, 0xF4, 0x00, 0x2F, 0x00,
-    0x3F, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F,
-    0x00, 0x3D, 0x00, 0x0B, 0xC0, 0xBE, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x2F, 0x0F, 0xC0, 0x00, 0x0B, 0xC1, 0xF8, 0x00, 0x02, 0xF0, 0x2F, 0x80, 0x00, 0xBC, 0x03, 0xF4,
-    0x00, 0x2F, 0x00, 0x3F, 0x80, 0x2F, 0xE8, 0x07, 0xF8, 0x3F, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xC2, 0xFC, 0x7F, 0xCB, 0xFC, 0x07, 0xFE, 0x68, 0x03, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x1B, 0xFA, 0x40, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x0A, 0x00, 0x38, 0x00, 0x03,
-    0xE0, 0x7D, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xA5, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xC1, 0xBF,
-    0x40, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0xBC, 0x0B, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x2F, 0x02, 0xF8, 0x00,
-    0x0B, 0xC0, 0x3F, 0x40, 0x02, 0xF0, 0x03, 0xF8, 0x02, 0xFE, 0x80, 0x7F, 0x83, 0xFF, 0xF4, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x01, 0xE0, 0x0F, 0x47, 0xC0, 0x07,
-    0xDF, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC2,
-    0xFC, 0x7F, 0xCB, 0xFC, 0x07, 0xFE, 0x68, 0x03, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B,
-    0xFA, 0x40, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0xFE,
-    0x40, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x07, 0xFF, 0xFC, 0x1F, 0xD5, 0xBC,
-    0x3E, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x20, 0x00, 0x7D, 0xF0, 0x00,
-    0x3D, 0xF4, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0, 0x2F, 0xFF, 0xC0, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x81, 0xF5, 0xBD, 0x3C, 0x02, 0xD3, 0xC0, 0x0C, 0x3F, 0x40,
-    0x02, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x0B, 0xFC, 0x10, 0x0B, 0xE7, 0x00, 0x2E, 0x78, 0x02, 0xE7,
-    0xE5, 0xBC, 0x3F, 0xFF, 0x00, 0x15, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFB, 0xD0,
-    0x07, 0xC1, 0xF0, 0x0B, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x07, 0xFF, 0xFC, 0x1F,
-    0xD5, 0xBC, 0x3E, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F, 0x40, 0x00, 0x2F, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x20, 0x00, 0x7D,
-    0xF0, 0x00, 0x3D, 0xF4, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0, 0x2F, 0xFF, 0xC0, 0x01,
-    0x54, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0xD0, 0x07, 0xEF, 0x00, 0xF4, 0xB8, 0x2D, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x1F, 0x5B, 0xD3, 0xC0, 0x2D, 0x3C, 0x00, 0xC3, 0xF4, 0x00,
-    0x2F, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xC1, 0x00, 0xBE, 0x70, 0x02, 0xE7, 0x80, 0x2E, 0x7E,
-    0x5B, 0xC3, 0xFF, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x69, 0x40, 0x07, 0xFF, 0xFC, 0x1F, 0xD5, 0xBC,
-    0x3E, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x20, 0x00, 0x7D, 0xF0, 0x00,
-    0x3D, 0xF4, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0, 0x2F, 0xFF, 0xC0, 0x01, 0x54, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x1F, 0x5B, 0xD3, 0xC0, 0x2D, 0x3C, 0x00, 0xC3, 0xF4,
-    0x00, 0x2F, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xC1, 0x00, 0xBE, 0x70, 0x02, 0xE7, 0x80, 0x2E,
-    0x7E, 0x5B, 0xC3, 0xFF, 0xF0, 0x01, 0x50, 0x00, 0x1A, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0x1F, 0x00, 0x01, 0x40, 0x00, 0x08, 0x00, 0x74, 0x0F, 0x42, 0xF0, 0x07, 0xDB, 0xC0,
-    0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x07, 0xFF, 0xFC, 0x1F,
-    0xD5, 0xBC, 0x3E, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F, 0x40, 0x00, 0x2F, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x20, 0x00, 0x7D,
-    0xF0, 0x00, 0x3D, 0xF4, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0, 0x2F, 0xFF, 0xC0, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x2E, 0x0F, 0x40, 0xF6, 0xE0, 0x03, 0xFC, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x81, 0xF5, 0xBD, 0x3C, 0x02, 0xD3, 0xC0, 0x0C,
-    0x3F, 0x40, 0x02, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x0B, 0xFC, 0x10, 0x0B, 0xE7, 0x00, 0x2E, 0x78,
-    0x02, 0xE7, 0xE5, 0xBC, 0x3F, 0xFF, 0x00, 0x15, 0x00, 0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xEA, 0xBF, 0xAA, 0xF0, 0xF0, 0x0F, 0x80, 0x3C, 0x3C, 0x03, 0xE0, 0x0F, 0x09, 0x00,
-    0xF8, 0x02, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1B, 0xFA,
-    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x2F, 0xFF,
-    0xCF, 0xFF, 0xFC, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xAF, 0x02, 0xFF, 0xD0, 0x01,
-    0x40, 0x00, 0x68, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x05, 0x00,
-    0x00, 0xA0, 0x03, 0x80, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x50, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3E, 0xAB, 0xFA, 0xAF, 0x0F, 0x00, 0xF8, 0x03, 0xC3, 0xC0, 0x3E, 0x00, 0xF0, 0x90,
-    0x0F, 0x80, 0x24, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xBF,
-    0xA0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0x40, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0x74,
-    0x03, 0xC7, 0x00, 0x7C, 0x10, 0x07, 0xC0, 0x02, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0,
-    0x00, 0x7C, 0x00, 0x07, 0xFA, 0xF0, 0x2F, 0xFD, 0x00, 0x14, 0x00, 0x15, 0x55, 0x55, 0x55, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xEA, 0xBF, 0xAA, 0xF0, 0xF0, 0x0F, 0x80, 0x3C, 0x3C, 0x03, 0xE0, 0x0F,
-    0x09, 0x00, 0xF8, 0x02, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x17, 0xF5,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x1B, 0xFA, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00,
-    0x7C, 0x00, 0x2F, 0xFF, 0xCF, 0xFF, 0xFC, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC,
-    0x00, 0xFF, 0xFF, 0x80, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xAF,
-    0x02, 0xFF, 0xD0, 0x01, 0x40, 0x00, 0x01, 0x40, 0x40, 0x00, 0x00, 0x2F, 0xC3, 0x80, 0x00, 0x00,
-    0xFB, 0xFF, 0x00, 0x00, 0x03, 0x87, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x40, 0x01, 0x55, 0x5F, 0xFF, 0x40, 0x3F, 0xFE, 0x1B, 0xE0, 0x00, 0x1F, 0xC0,
-    0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0,
-    0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02,
-    0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00,
-    0xF8, 0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01, 0xF8, 0x00, 0x0F, 0xFE,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x83, 0x40, 0x00, 0x0F, 0xFA, 0xE0, 0x00, 0x03, 0x4B, 0xF4, 0x00, 0x00, 0x40, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xAF, 0x80, 0xBF, 0xC0,
-    0x3F, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B,
-    0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40,
-    0x0B, 0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x03, 0xF4, 0x00, 0x3F, 0xEF, 0xFF, 0x90, 0x03, 0xFF, 0x8B,
-    0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50,
-    0x00, 0x55, 0x57, 0xFF, 0xD0, 0x0F, 0xFF, 0x86, 0xF8, 0x00, 0x07, 0xF0, 0x03, 0xD0, 0x00, 0x0B,
-    0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03,
-    0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00,
-    0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x00, 0xF4,
-    0x00, 0xFC, 0x00, 0x07, 0xC0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xBF, 0xF0, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0A,
-    0xF8, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0,
-    0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02,
-    0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x3F, 0x40, 0x03, 0xFE, 0xFF, 0xF9,
-    0x00, 0x3F, 0xF8, 0xBF, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x01, 0xC0, 0x00, 0x00, 0xFE, 0x6E, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x01, 0x55, 0x5F, 0xFF, 0x40, 0x3F, 0xFE, 0x1B,
-    0xE0, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00,
-    0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8,
-    0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D,
-    0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01,
-    0xF8, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x80, 0x00, 0x0F, 0x82, 0xD0, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0xAF, 0x80, 0xBF, 0xC0, 0x3F, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x03, 0xF4, 0x00, 0x3F, 0xEF, 0xFF,
-    0x90, 0x03, 0xFF, 0x8B, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0x00, 0x00, 0x03, 0xC3,
-    0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x55, 0x00, 0x05, 0x55,
-    0x7F, 0xFD, 0x00, 0xFF, 0xF8, 0x6F, 0x80, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4,
-    0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00,
-    0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00,
-    0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x0F, 0xC0,
-    0x00, 0x7C, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03,
-    0x87, 0x80, 0x00, 0x01, 0xD0, 0xF0, 0x00, 0x00, 0x78, 0x38, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2B, 0xE0, 0x2F, 0xF0, 0x0F, 0xF4,
-    0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00,
-    0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0,
-    0x00, 0xF4, 0x00, 0x7D, 0x00, 0xFD, 0x00, 0x0F, 0xFB, 0xFF, 0xE4, 0x00, 0xFF, 0xE2, 0xFF, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x0D, 0x00, 0x00, 0x0B,
-    0xC0, 0xFC, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x34, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x05, 0x55, 0x7F, 0xFD, 0x00, 0xFF, 0xF8, 0x6F,
-    0x80, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0,
-    0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4,
-    0x00, 0x02, 0xE0, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x1F, 0xC0, 0x07,
-    0xE0, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x7C, 0x3D,
-    0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x1D, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x2B, 0xE0, 0x2F, 0xF0, 0x0F, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0xFD,
-    0x00, 0x0F, 0xFB, 0xFF, 0xE4, 0x00, 0xFF, 0xE2, 0xFF, 0x00, 0x05, 0x40, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x15, 0x55, 0xFF, 0xF4, 0x03, 0xFF, 0xE1, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0xF4, 0x00, 0x02,
-    0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00,
-    0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x80, 0x00, 0x3D,
-    0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0A, 0xF8, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x2F, 0x00, 0x0F,
-    0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00,
-    0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x1F,
-    0x40, 0x3F, 0x40, 0x03, 0xFE, 0xFF, 0xF9, 0x00, 0x3F, 0xF8, 0x7F, 0xC0, 0x01, 0x50, 0x0F, 0x40,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x40, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x00, 0x00, 0x00, 0x15, 0x54, 0x7F, 0xFF, 0x00, 0x28, 0x00, 0xBF, 0xFC, 0x1B, 0xF4, 0x00,
-    0x3D, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xFF, 0x00,
-    0x0F, 0x80, 0x01, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x01, 0xEF, 0x80, 0x1F, 0x00,
-    0x00, 0xFC, 0x02, 0xDB, 0xC0, 0x2E, 0x00, 0x00, 0x7C, 0x03, 0xC7, 0xC0, 0x3D, 0x00, 0x00, 0x3D,
-    0x07, 0x83, 0xD0, 0x3C, 0x00, 0x00, 0x3E, 0x0B, 0x42, 0xF0, 0xB8, 0x00, 0x00, 0x2F, 0x0F, 0x01,
-    0xF0, 0xF4, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0xF4, 0xF0, 0x00, 0x00, 0x0F, 0x6D, 0x00, 0xB9, 0xE0,
-    0x00, 0x00, 0x0B, 0xBC, 0x00, 0x7E, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x70, 0x0B, 0xFE,
-    0x3F, 0xE4, 0x0B, 0x40, 0x6F, 0xD0, 0xF8, 0x00, 0xFC, 0x00, 0xF4, 0x0B, 0xC0, 0x1F, 0xC0, 0x1F,
-    0x00, 0x3D, 0x02, 0xFD, 0x02, 0xE0, 0x03, 0xE0, 0x3E, 0xF0, 0x3C, 0x00, 0x2F, 0x07, 0x5F, 0x03,
-    0xC0, 0x00, 0xF0, 0xB0, 0xF4, 0x74, 0x00, 0x0F, 0x8F, 0x0B, 0xCF, 0x00, 0x00, 0x7D, 0xD0, 0x3C,
-    0xE0, 0x00, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00, 0x01, 0xF4, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0x74, 0x03, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x40, 0x15, 0x56, 0xFF, 0xF8, 0x1F, 0xFE, 0x1F, 0xE0, 0x00, 0xBD, 0x00, 0xFC,
-    0x00, 0x3D, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x7D, 0x0B, 0x80, 0x00,
-    0x0F, 0xC3, 0xC0, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x3D, 0x2E, 0x00, 0x01, 0xE0, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x0B, 0xFE, 0x3F, 0xE4, 0x1B, 0xF4,
-    0x3E, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x7C, 0x00, 0xF4, 0x03, 0xD0, 0x02, 0xF0, 0x0F, 0x00, 0x07,
-    0xC0, 0xB8, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x16, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x0A, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x55, 0x5B, 0xFF, 0xE0, 0x7F, 0xF8, 0x7F, 0x80,
-    0x02, 0xF4, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0xBD, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x01,
-    0xF4, 0x2E, 0x00, 0x00, 0x3F, 0x0F, 0x00, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xAA, 0xAF, 0xD0, 0xB8, 0x00, 0x3E, 0x02, 0xC0, 0x03, 0xF0, 0x02, 0x00, 0x2F, 0x40, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x2C, 0x0F, 0xC0, 0x00,
-    0xF0, 0xBD, 0x00, 0x07, 0xC3, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x2C, 0x00,
-    0xF8, 0x2C, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xF0, 0x05, 0x0B, 0xC0, 0x0F, 0x1F, 0x40, 0x1E, 0x3F, 0xAA, 0xFE, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xAA, 0xAF, 0xD0, 0xB8, 0x00, 0x3E, 0x02, 0xC0, 0x03, 0xF0, 0x02, 0x00, 0x2F, 0x40, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x2C, 0x0F, 0xC0, 0x00,
-    0xF0, 0xBD, 0x00, 0x07, 0xC3, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x2C, 0x00, 0xF8, 0x2C, 0x03, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x05, 0x0B, 0xC0, 0x0F,
-    0x1F, 0x40, 0x1E, 0x3F, 0xAA, 0xFE, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x80, 0x0E, 0x00,
-    0x0F, 0x81, 0xF4, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0xAA, 0xAF, 0xD0, 0xB8, 0x00,
-    0x3E, 0x02, 0xC0, 0x03, 0xF0, 0x02, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x2C, 0x0F, 0xC0, 0x00, 0xF0, 0xBD, 0x00, 0x07, 0xC3, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xB4,
-    0x07, 0xC2, 0xE0, 0x02, 0xF7, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x2C, 0x00, 0xF8, 0x2C, 0x03, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x05, 0x0B, 0xC0, 0x0F,
-    0x1F, 0x40, 0x1E, 0x3F, 0xAA, 0xFE, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x2F, 0xFE, 0x00, 0xBD, 0x7F, 0x00, 0xF0, 0x09, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x0B, 0xFA, 0x00, 0x3F, 0xFF, 0x40, 0x10, 0x07, 0x80, 0x7E, 0x02, 0xF4, 0x0B, 0xC0,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xD0, 0xF8, 0x3E, 0x03, 0x40, 0x00, 0x00, 0x03, 0xD0,
-    0x0B, 0xF0, 0x1F, 0xBC, 0x3C, 0x2E, 0xB4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0A, 0xFF, 0xEF,
-    0xF1, 0xFE, 0x10, 0x24, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x03,
-    0xF8, 0x1F, 0x7F, 0xFC, 0x0B, 0xA0, 0x3C, 0xBE, 0xBD, 0x14, 0x18, 0x02, 0x43, 0xF0, 0xFC, 0x3E,
-    0x0F, 0xC0, 0x40, 0x10, 0x06, 0x90, 0x2F, 0xFC, 0x3C, 0x3C, 0x34, 0x3C, 0x00, 0xB8, 0x07, 0xD0,
-    0x03, 0x40, 0x00, 0x00, 0x01, 0x90, 0x1F, 0xF4, 0x3C, 0x3C, 0x38, 0x2C, 0x3C, 0x3C, 0x2F, 0xF4,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x34, 0x38, 0x0B, 0xC7, 0xC0, 0xF4, 0xF8, 0x2E, 0x1F, 0x03, 0x82,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x3C, 0x2E, 0x0F, 0x00, 0xF6, 0xD0, 0x03, 0xF8,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xC1, 0xC0, 0x3D, 0x3E, 0x02, 0xF1, 0xF0, 0x0F, 0x4B, 0x80,
-    0x38, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xFE, 0xE0, 0x1F, 0x80, 0x05, 0x00,
-    0x0E, 0x3C, 0xB8, 0xF4, 0xF8, 0xBD, 0x14, 0x19, 0x0F, 0xC1, 0xF4, 0x3D, 0x0F, 0x0B, 0x43, 0x40,
-    0x19, 0x0F, 0xC7, 0xD1, 0xF0, 0x3C, 0x07, 0x80, 0x70, 0x00, 0x2D, 0x3D, 0x3C, 0x38, 0x30, 0x10,
-    0x28, 0x3E, 0x3E, 0x7C, 0xB0, 0x00, 0x3C, 0xBE, 0xBD, 0x14, 0x18, 0x02, 0x43, 0xF0, 0xFC, 0x3E,
-    0x0F, 0xC0, 0x40, 0x10, 0x0A, 0x47, 0xBD, 0xB0, 0xEB, 0x0E, 0x7F, 0xC0, 0x50, 0x0A, 0x07, 0xE0,
-    0xF8, 0x3D, 0x1E, 0x05, 0x00, 0x1A, 0x03, 0xFC, 0x03, 0xC0, 0x7C, 0x2F, 0x01, 0x40, 0x00, 0x01,
-    0xE0, 0x3C, 0x0B, 0x80, 0x7E, 0x52, 0xFD, 0x00, 0x00, 0x66, 0xDB, 0x6D, 0xB5, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x0F, 0xF8, 0x2E, 0x3D, 0xB8, 0x0F, 0x10, 0x00, 0x00, 0x00, 0xF0, 0x07, 0xFD, 0x1F,
-    0x3F, 0xFC, 0x06, 0x90, 0x00, 0x00, 0x3E, 0x0A, 0xFF, 0xDF, 0xF2, 0xFE, 0x50, 0x68, 0x05, 0x55,
-    0x43, 0xFF, 0xFC, 0x2A, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xFE, 0xE0, 0x1F, 0x80, 0x05,
-    0x00, 0x09, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xC0, 0x00, 0xB4, 0x00, 0x01, 0x00, 0x18,
-    0x02, 0x47, 0xF0, 0xFD, 0x3E, 0x0F, 0xC0, 0x40, 0x10, 0x10, 0x0F, 0x03, 0xC0, 0xFA, 0x2F, 0x40,
-    0x00, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0,
-    0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFD, 0x02, 0x90, 0x78, 0x00, 0x7F, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA, 0xBC,
-    0x0B, 0xC0, 0x02, 0xC0, 0xBC, 0x00, 0x1C, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBE, 0xAF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xA0, 0xBC, 0x00, 0x0F, 0x0B, 0xC0, 0x01, 0xE2, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3E,
-    0xAB, 0xFA, 0xBF, 0x00, 0x3C, 0x03, 0xD0, 0x1E, 0x00, 0x3C, 0x03, 0xD0, 0x0D, 0x00, 0x24, 0x03,
-    0xD0, 0x04, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xD0, 0x0B, 0xF0, 0x00, 0x03, 0xD0, 0x01,
-    0xF8, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x00, 0x7C,
-    0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0xF9, 0x00, 0xBC, 0x00, 0xFF, 0xFE, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x05, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0xBC, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFE, 0x1F, 0xEA, 0xAF, 0x42, 0xF0, 0x03, 0xD0, 0xBC, 0x00,
-    0xB4, 0x2F, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x02, 0xFF, 0x90, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x02,
-    0xFF, 0xFF, 0x40, 0x3F, 0x95, 0xFE, 0x03, 0xF0, 0x00, 0xB8, 0x2F, 0x00, 0x01, 0xE0, 0xF8, 0x00,
-    0x03, 0x47, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xA0, 0x03, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xD5, 0x54, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x43,
-    0xF0, 0x00, 0x0B, 0x47, 0xF4, 0x00, 0xBD, 0x0B, 0xFE, 0xAF, 0xF0, 0x06, 0xFF, 0xFE, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x69, 0x40, 0x07, 0xFF, 0xFC, 0x1F, 0xD5, 0xBC, 0x3E, 0x00, 0x3C, 0x3D,
-    0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x20, 0x00, 0x7D, 0xF0, 0x00, 0x3D, 0xF4, 0x00, 0x7D,
-    0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0, 0x2F, 0xFF, 0xC0, 0x01, 0x54, 0x00, 0x55, 0x54, 0xFF, 0xFD,
-    0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x2F, 0xF8, 0xFF, 0xFD,
-    0x28, 0x0B, 0x4B, 0xE0, 0xFC, 0x7D, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x3F,
-    0xFF, 0x40, 0x7F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0,
-    0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0xBF, 0xE0, 0x3F, 0xFF, 0x40, 0x05, 0x55, 0x40, 0xFF, 0xFD, 0x01,
-    0xFD, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC,
-    0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x02, 0xFC,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xEA, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0x40, 0xBC, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0x40, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0x00, 0xBE,
-    0xAF, 0xF4, 0x00, 0x1E, 0x00, 0xBC, 0x01, 0xFC, 0x00, 0x2D, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x3C,
-    0x00, 0xBC, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0xBC,
-    0x76, 0xF0, 0x00, 0xBC, 0x01, 0xF8, 0xBF, 0xC0, 0x06, 0xFE, 0xBF, 0xF0, 0xBF, 0x40, 0x0F, 0xFF,
-    0xFE, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x01, 0x55, 0x40, 0x00, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xD0, 0x01, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7D,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFA, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xC0, 0x00, 0x7D, 0x01, 0xFC, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x7D,
-    0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x7D, 0x01, 0xFC, 0x2F, 0xF8, 0x01, 0xFF, 0xBF, 0xF0, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xEA, 0xBF, 0xAB, 0xF0, 0x00, 0xF0, 0x0F, 0x40, 0x78, 0x00, 0x3C,
-    0x03, 0xD0, 0x0D, 0x00, 0x09, 0x00, 0xF4, 0x01, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x3E, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x00,
-    0xF4, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x1F,
-    0xF8, 0x02, 0xFE, 0x40, 0x3F, 0xFF, 0x43, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x40, 0x06, 0x03, 0xFF, 0xF0, 0x0B, 0xF0, 0x1F, 0xD0, 0x07, 0xFC, 0x02,
-    0xF0, 0x03, 0xD0, 0x00, 0xBC, 0x02, 0xE0, 0x00, 0x2F, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0xB4, 0x00,
-    0x02, 0xF0, 0x38, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0B, 0xC1, 0xF4,
-    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x0B, 0xC0,
-    0x0F, 0xC0, 0x02, 0xF0, 0x01, 0xFC, 0x02, 0xFF, 0x80, 0x2F, 0xC3, 0xFF, 0xF0, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x40, 0x05, 0x55, 0x3F, 0xFF, 0x00, 0x7F, 0xFE, 0x1F, 0xD0, 0x00, 0x6F, 0x80, 0x2F,
-    0x00, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0x03, 0xF4, 0x02, 0xF0, 0x00, 0x3F, 0xD0, 0x0B, 0xC0, 0x03,
-    0xEF, 0x40, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0xBC, 0x03, 0xD0, 0xF4, 0x02, 0xF0, 0x3D, 0x03, 0xD0,
-    0x0B, 0xC3, 0xD0, 0x0F, 0x40, 0x2F, 0x3E, 0x00, 0x3D, 0x00, 0xBF, 0xE0, 0x00, 0xF4, 0x02, 0xFE,
-    0x00, 0x03, 0xD0, 0x0B, 0xE0, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00, 0x3D, 0x02, 0xFE, 0x80, 0x06,
-    0xFE, 0x7F, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x04, 0x00, 0x40, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00,
-    0x3E, 0x03, 0xF0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x54, 0x00, 0x55, 0x5B, 0xFF, 0xE0, 0x2F, 0xFE, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x3E,
-    0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0xBC, 0x01, 0xF0,
-    0x00, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0xB4, 0x00, 0x00, 0x0B,
-    0xCF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x0C, 0x3C, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x54, 0x01, 0x55, 0x5F, 0xFF, 0xC0, 0x7F, 0xFF,
-    0x1F, 0xD0, 0x01, 0x7F, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00,
-    0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00,
-    0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00,
-    0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00,
-    0x00, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0,
-    0x0B, 0xC0, 0x00, 0x0B, 0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC,
-    0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F,
-    0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x1F, 0xEA, 0xAF, 0x40, 0xBC, 0x00, 0xB4, 0x0B, 0xC0, 0x07, 0x00, 0xBC, 0x00, 0x10, 0x0B, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0xBE, 0xBF, 0xF8, 0x0B, 0xC0, 0x0B, 0xD0,
-    0xBC, 0x00, 0x3F, 0x0B, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x2F, 0x0B, 0xC0, 0x03, 0xE0, 0xBC, 0x00,
-    0xFC, 0x2F, 0xFB, 0xFF, 0x4F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0x50, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xC1, 0xBF, 0x00, 0xBC, 0x02, 0xF4, 0x0B, 0xC0, 0x0F, 0x40, 0xBC, 0x00,
-    0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xBC, 0x02, 0xE0, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x0B,
-    0xC0, 0x1F, 0xC0, 0xBC, 0x00, 0x3D, 0x0B, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0x3E, 0x0B, 0xC0, 0x07,
-    0xD0, 0xBC, 0x01, 0xFC, 0x2F, 0xFB, 0xFF, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xE1, 0xFE, 0xAA, 0xF4, 0x2F, 0x00, 0x3D, 0x0B, 0xC0, 0x0B, 0x42,
-    0xF0, 0x02, 0xC0, 0xBC, 0x00, 0x10, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x1B, 0xEA, 0xFE, 0x00, 0x00, 0xB4, 0x07, 0xC0, 0x00, 0x0B, 0x40, 0x7C,
-    0x00, 0x00, 0xB0, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x0F,
-    0x00, 0x7C, 0x00, 0x01, 0xE0, 0x07, 0xC0, 0x00, 0x2D, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x07, 0xC0,
-    0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0B, 0x40, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00,
-    0x07, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x97, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x00, 0x00, 0x03, 0xF3,
-    0xC0, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x02, 0xD3, 0xC0, 0x00, 0x00, 0x1D, 0x28, 0x00, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB,
-    0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x06, 0x40, 0x05, 0x55, 0x00, 0x24, 0x03, 0xF4, 0x0F, 0xFF, 0xC0,
-    0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x40, 0x3F, 0xD0, 0x02, 0xF0, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x2D,
-    0x02, 0xF0, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0xBC, 0x0B, 0x40, 0x00, 0x00, 0xB4, 0x2F, 0x03, 0xC0,
-    0x00, 0x00, 0x0F, 0x0B, 0xC2, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0xF4, 0x00,
-    0x00, 0x3F, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x2F,
-    0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x0B, 0xC0, 0x0F, 0xD0, 0x0F, 0xE0, 0x0B, 0xFE, 0x00, 0xFD, 0x1F,
-    0xE0, 0x0F, 0xFF, 0xC0, 0x1F, 0xE1, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x6A, 0x90, 0x00,
-    0xBF, 0xFF, 0xD0, 0x0F, 0xD0, 0x7F, 0x00, 0xF0, 0x00, 0xF8, 0x0E, 0x00, 0x0F, 0x80, 0xD0, 0x00,
-    0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x40, 0x00, 0x7D, 0x3D, 0x00, 0x0B,
-    0xC3, 0xF0, 0x01, 0xFC, 0x2F, 0xE6, 0xBF, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x15, 0x40, 0x00, 0x55,
-    0x54, 0x00, 0x55, 0x53, 0xFF, 0xF0, 0x07, 0xFF, 0xE1, 0xFD, 0x00, 0x06, 0xF8, 0x02, 0xF0, 0x00,
-    0x07, 0xD0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x2F, 0x00, 0x03, 0xFD, 0x00, 0xBC, 0x00, 0x3E, 0xF4,
-    0x02, 0xF0, 0x03, 0xD3, 0xD0, 0x0B, 0xC0, 0x3D, 0x0F, 0x40, 0x2F, 0x03, 0xD0, 0x3D, 0x00, 0xBC,
-    0x3D, 0x00, 0xF4, 0x02, 0xF3, 0xE0, 0x03, 0xD0, 0x0B, 0xFE, 0x00, 0x0F, 0x40, 0x2F, 0xE0, 0x00,
-    0x3D, 0x00, 0xBE, 0x00, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x2F, 0xE8, 0x00, 0x6F, 0xE7,
-    0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x03,
-    0xE0, 0x3F, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x40, 0x05, 0x55, 0x3F, 0xFF, 0x00, 0x7F, 0xFE, 0x1F, 0xD0, 0x00, 0x6F, 0x80,
-    0x2F, 0x00, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0x03, 0xF4, 0x02, 0xF0, 0x00, 0x3F, 0xD0, 0x0B, 0xC0,
-    0x03, 0xEF, 0x40, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0xBC, 0x03, 0xD0, 0xF4, 0x02, 0xF0, 0x3D, 0x03,
-    0xD0, 0x0B, 0xC3, 0xD0, 0x0F, 0x40, 0x2F, 0x3E, 0x00, 0x3D, 0x00, 0xBF, 0xE0, 0x00, 0xF4, 0x02,
-    0xFE, 0x00, 0x03, 0xD0, 0x0B, 0xE0, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00, 0x3D, 0x02, 0xFE, 0x80,
-    0x06, 0xFE, 0x7F, 0xFF, 0x00, 0x7F, 0xFE, 0x55, 0x54, 0x00, 0x60, 0x3F, 0xFF, 0x00, 0xBF, 0x01,
-    0xFD, 0x00, 0x7F, 0xC0, 0x2F, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x2E, 0x00, 0x02, 0xF0, 0x0F, 0x00,
-    0x00, 0xBC, 0x0B, 0x40, 0x00, 0x2F, 0x03, 0x80, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x02, 0xF0,
-    0x0B, 0xD0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x1F, 0xC0, 0x2F, 0xF8, 0x02, 0xFC, 0x3F,
-    0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x55, 0x55, 0x55, 0x40, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x1F, 0xEA, 0xFE, 0x00, 0x00, 0xB4, 0x07, 0xC0, 0x00, 0x0B, 0x40, 0x7C, 0x00, 0x00,
-    0xB4, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x7C,
-    0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x07, 0xC0, 0x00, 0x3C,
-    0x00, 0x7C, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x7C, 0x07, 0x6F, 0x00, 0x07, 0xC0,
-    0xBF, 0xC0, 0x01, 0xFF, 0x8B, 0xF4, 0x00, 0xFF, 0xFD, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x55, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00,
-    0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0xEF, 0x40, 0x0F, 0x7C, 0x00, 0x07, 0x6F, 0x00, 0x39, 0xF0,
-    0x00, 0x2D, 0x7C, 0x02, 0xD7, 0xC0, 0x00, 0xB0, 0xF4, 0x0F, 0x0F, 0x00, 0x03, 0xC2, 0xE0, 0x38,
-    0x3C, 0x00, 0x0F, 0x07, 0xC2, 0xC0, 0xF4, 0x00, 0x3C, 0x0F, 0x4F, 0x03, 0xD0, 0x00, 0xF0, 0x2E,
-    0x78, 0x0F, 0x40, 0x03, 0xC0, 0x3E, 0xC0, 0x3E, 0x00, 0x1F, 0x00, 0xFF, 0x00, 0xB8, 0x00, 0x78,
-    0x02, 0xF4, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0B, 0xC0, 0x2F, 0xE4, 0x05, 0x00, 0xBF, 0xE3,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x55, 0x54, 0x00, 0x55, 0x57, 0xFF, 0xF0, 0x07, 0xFF, 0xE1,
-    0xFD, 0x00, 0x05, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B,
-    0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00,
-    0x03, 0xE0, 0x2F, 0xF8, 0x00, 0x6F, 0xE7, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40,
-    0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC,
-    0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00,
-    0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00,
-    0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA, 0xAB, 0xF4,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x2F, 0xF8,
-    0x00, 0xBF, 0xA3, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x05, 0xAA, 0x50, 0x0F, 0xFF, 0xFF, 0xD0, 0x1F,
-    0xC1, 0xBF, 0x40, 0xBC, 0x00, 0xFC, 0x0B, 0xC0, 0x0B, 0xC0, 0xBC, 0x00, 0x7C, 0x0B, 0xC0, 0x0B,
-    0xC0, 0xBC, 0x00, 0xFC, 0x0B, 0xC0, 0x2F, 0x00, 0xBE, 0xBF, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x2F, 0xF9, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF9,
-    0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06, 0x07,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xEA, 0xBF, 0xAA, 0xF0, 0xF0, 0x0F, 0x80, 0x3C, 0x3C, 0x03, 0xE0, 0x0F, 0x09,
-    0x00, 0xF8, 0x02, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1B,
-    0xFA, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x15, 0x54, 0x00, 0x55, 0x5B, 0xFF, 0xE0, 0x2F, 0xFE,
-    0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
-    0x0F, 0x40, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x2F, 0x07, 0xC0, 0x00,
-    0x00, 0xF8, 0xB4, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0C, 0x3C, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x06, 0xBF, 0xE9, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x02, 0xF8, 0x1F, 0x07, 0xF8, 0x7E, 0x01, 0xF0, 0x0B, 0xDB, 0xC0, 0x1F, 0x00,
-    0x3E, 0xFC, 0x01, 0xF0, 0x03, 0xFF, 0x80, 0x1F, 0x00, 0x3F, 0xFC, 0x01, 0xF0, 0x03, 0xEB, 0xD0,
-    0x1F, 0x00, 0xBC, 0x3F, 0x41, 0xF0, 0x2F, 0x80, 0xFF, 0xAF, 0xAF, 0xD0, 0x01, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x15,
-    0x55, 0x00, 0x00, 0x15, 0x55, 0x00, 0x55, 0x43, 0xFF, 0xF0, 0x2F, 0xFD, 0x07, 0xF4, 0x00, 0x7E,
-    0x00, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x1F,
-    0xCF, 0x40, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xF2, 0xF4, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x0B, 0x80,
-    0x3F, 0x00, 0x01, 0xF0, 0x02, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0xD0, 0x2F, 0xE4, 0x01, 0xFF, 0x9F,
-    0xFF, 0xC0, 0xBF, 0xFF, 0x55, 0x54, 0x01, 0x55, 0x53, 0xFF, 0xF0, 0x1F, 0xFF, 0xC1, 0xFD, 0x00,
-    0x17, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xF8,
-    0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00,
-    0x3E, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x05, 0x55, 0x5F, 0xFF, 0x43, 0xFF, 0xE1, 0xBE,
-    0x00, 0x6F, 0x80, 0x0F, 0x40, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x3D, 0x00,
-    0x3D, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x03, 0xD0, 0x03, 0xF4, 0x00, 0xF4, 0x00, 0x7F, 0xEA, 0xFD,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x15, 0x43, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x00,
-    0x0F, 0xFF, 0xE0, 0x55, 0x54, 0x15, 0x54, 0x05, 0x55, 0x3F, 0xFF, 0x0F, 0xFF, 0x87, 0xFF, 0xD1,
-    0xFC, 0x00, 0x7E, 0x00, 0x6F, 0x80, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x0B, 0xC0, 0x03, 0xE0,
-    0x00, 0xF4, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x2F,
-    0x00, 0x0F, 0x80, 0x03, 0xD0, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xF8, 0x00,
-    0x3D, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x0B, 0xC0,
-    0x03, 0xE0, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x0F,
-    0x40, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x55, 0x54, 0x15, 0x54, 0x05, 0x55, 0x3F, 0xFF, 0x0F, 0xFF, 0x87, 0xFF,
-    0xD1, 0xFC, 0x00, 0x7E, 0x00, 0x6F, 0x80, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x0B, 0xC0, 0x03,
-    0xE0, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x0F, 0x40,
-    0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xF8,
-    0x00, 0x3D, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x0B,
-    0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x3E, 0x00,
-    0x0F, 0x40, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xEA, 0xBF, 0x40, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x3C, 0x03, 0xF0,
-    0x00, 0x00, 0x90, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00,
-    0xFC, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x3F, 0x00,
-    0x2F, 0x00, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x1B, 0xFA, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x01, 0x55, 0x4F, 0xFF, 0xC0, 0x00, 0xFF, 0xFD,
-    0x1F, 0xD0, 0x00, 0x01, 0xBD, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0xBC, 0x00, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x00, 0x07,
-    0xC0, 0x0B, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0xBE, 0xAF, 0xF4, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0,
-    0x7C, 0x00, 0xBC, 0x00, 0x7D, 0x07, 0xC0, 0x0B, 0xC0, 0x03, 0xE0, 0x7C, 0x00, 0xBC, 0x00, 0x3D,
-    0x07, 0xC0, 0x0B, 0xC0, 0x07, 0xC0, 0x7C, 0x00, 0xBC, 0x01, 0xFC, 0x07, 0xC0, 0x2F, 0xEB, 0xFF,
-    0x02, 0xFF, 0x8F, 0xFF, 0xFE, 0x40, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xBE, 0xAB,
-    0xF8, 0x0B, 0xC0, 0x0B, 0xD0, 0xBC, 0x00, 0x3F, 0x0B, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x2F, 0x0B,
-    0xC0, 0x03, 0xE0, 0xBC, 0x00, 0xFC, 0x2F, 0xFB, 0xFF, 0x4F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x00, 0x7F, 0xFF, 0xE0, 0x03, 0xF9, 0x6F, 0xF4, 0x0F, 0x00, 0x07, 0xF0,
-    0x3C, 0x00, 0x07, 0xE0, 0xB0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x00,
-    0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x02, 0xF0, 0x40, 0x00, 0x0F, 0x8B, 0x80, 0x00, 0xBC, 0x3F, 0x40, 0x0B, 0xE0, 0x7F, 0xEA, 0xFE,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x55, 0x54, 0x00, 0x06, 0xA4, 0x00, 0x3F,
-    0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0x96, 0xFF, 0x00, 0x2F, 0x00, 0x2F, 0x40,
-    0x0B, 0xF0, 0x0B, 0xC0, 0x1F, 0x40, 0x00, 0xFD, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0xBC,
-    0x03, 0xE0, 0x00, 0x03, 0xF0, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x0B, 0xEA, 0xFC, 0x00, 0x00,
-    0x2F, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x2F, 0x02,
-    0xF4, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x1F,
-    0x40, 0xBC, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x2F, 0xE8, 0x03,
-    0xFE, 0xBF, 0xC0, 0x3F, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x03, 0xF9, 0x6F, 0x80, 0x03, 0xF0, 0x03,
-    0xD0, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x03, 0xD0,
-    0x03, 0xD0, 0x00, 0xBD, 0x00, 0xF4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x3F, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0xF4, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x0F, 0x40,
-    0x0B, 0xE0, 0x03, 0xD0, 0x0B, 0xF0, 0x06, 0xFE, 0x4B, 0xE0, 0x0B, 0xFF, 0xE1, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFA, 0xBE, 0x00, 0xF4, 0x0F, 0xC0, 0x3C, 0x01,
-    0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x1B, 0xFF, 0xC0, 0x2F, 0xEA, 0xF0, 0x2F, 0x00,
-    0x7C, 0x0B, 0xC0, 0x1F, 0x02, 0xF0, 0x0F, 0xC0, 0x7F, 0xAF, 0xFF, 0x8B, 0xFE, 0x2F, 0xC0, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xC0, 0x0B, 0xFF, 0xF0, 0x0F, 0xEB, 0xF4, 0x0F,
-    0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB9, 0xFF, 0xE0, 0x2F,
-    0xFE, 0xFF, 0x0F, 0xE0, 0x07, 0xF3, 0xE0, 0x00, 0xBC, 0xF8, 0x00, 0x0F, 0x7E, 0x00, 0x03, 0xEF,
-    0xC0, 0x00, 0xF6, 0xF0, 0x00, 0x3D, 0x7D, 0x00, 0x1F, 0x0F, 0xC0, 0x0F, 0x81, 0xFE, 0x6F, 0xC0,
-    0x1F, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xFE, 0xBF, 0x40, 0x3D, 0x02,
-    0xF0, 0x0F, 0x40, 0x7C, 0x03, 0xD0, 0x1F, 0x00, 0xF9, 0x5F, 0x00, 0x3F, 0xFF, 0xD0, 0x0F, 0x41,
-    0xBD, 0x03, 0xD0, 0x0F, 0x80, 0xF4, 0x03, 0xE0, 0x3D, 0x00, 0xF4, 0x2F, 0x96, 0xFC, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x03, 0xE0, 0x2D, 0x03, 0xE0,
-    0x1D, 0x03, 0xE0, 0x1C, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xFA, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x38, 0x0B, 0x80,
-    0x00, 0x38, 0x0B, 0x80, 0x00, 0x74, 0x0B, 0x80, 0x00, 0xB0, 0x0B, 0x80, 0x00, 0xF0, 0x0B, 0x80,
-    0x01, 0xE0, 0x0B, 0x80, 0x03, 0xC0, 0x0B, 0x80, 0x1F, 0xFA, 0xBF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x7C, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x38, 0x00, 0x00, 0x2C,
-    0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xFE, 0xBF, 0x0F, 0x80, 0x3E, 0x7C,
-    0x00, 0xBE, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x01, 0xFF, 0xC0, 0xFC, 0x2F, 0xC1, 0xBE, 0x43, 0xFC, 0x01, 0xE0, 0x3C,
-    0x07, 0x80, 0x00, 0xB0, 0x3C, 0x0F, 0x00, 0x00, 0x38, 0x3C, 0x2D, 0x00, 0x00, 0x2D, 0x7D, 0x78,
-    0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7C, 0x3C, 0x3D, 0x00, 0x00, 0xF8, 0x3C, 0x1F, 0x00,
-    0x01, 0xF0, 0x3C, 0x0F, 0x80, 0x03, 0xE0, 0x3C, 0x07, 0xD0, 0x0F, 0xC0, 0x7E, 0x02, 0xF0, 0x7F,
-    0x03, 0xFF, 0xC0, 0xFD, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x41, 0xFA,
-    0xFF, 0x0A, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x05, 0xBC, 0x00, 0x3F, 0xF8, 0x00,
-    0x01, 0xF8, 0x00, 0x02, 0xF1, 0x40, 0x0B, 0xCF, 0x00, 0x3E, 0x3F, 0x9B, 0xF0, 0x3F, 0xFE, 0x00,
-    0x05, 0x40, 0x00, 0x3F, 0xFC, 0x0B, 0xFF, 0x4B, 0xFD, 0x02, 0xFF, 0x80, 0x3D, 0x00, 0x0F, 0x00,
-    0x0F, 0x40, 0x0F, 0xC0, 0x03, 0xD0, 0x0F, 0xF0, 0x00, 0xF4, 0x1F, 0x3C, 0x00, 0x3D, 0x1F, 0x0F,
-    0x00, 0x0F, 0x5E, 0x03, 0xC0, 0x03, 0xFE, 0x00, 0xF0, 0x00, 0xFE, 0x00, 0x3C, 0x00, 0x3E, 0x00,
-    0x0F, 0x00, 0x2F, 0x90, 0x0B, 0xF8, 0x3F, 0xFC, 0x0F, 0xFF, 0x40, 0x00, 0x74, 0x03, 0x80, 0x00,
-    0x2E, 0x01, 0xF0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xF4, 0xBF, 0xD0, 0x2F, 0xF8, 0x03, 0xD0, 0x00,
-    0xF0, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0xFF, 0x00, 0x0F, 0x41, 0xF3, 0xC0, 0x03, 0xD1,
-    0xF0, 0xF0, 0x00, 0xF5, 0xE0, 0x3C, 0x00, 0x3F, 0xE0, 0x0F, 0x00, 0x0F, 0xE0, 0x03, 0xC0, 0x03,
-    0xE0, 0x00, 0xF0, 0x02, 0xF9, 0x00, 0xBF, 0x83, 0xFF, 0xC0, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x1F, 0x42, 0xFF, 0x40, 0xFD, 0x00, 0xF4, 0x0F, 0x00, 0x03, 0xD0, 0xB4, 0x00, 0x0F,
-    0x43, 0x80, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x0F, 0x43,
-    0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0xC0, 0x0B, 0xF4, 0x0F, 0x80, 0xFF, 0xF0, 0x1F,
-    0xC0, 0x00, 0x00, 0x05, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xC0, 0xF4,
-    0x00, 0x0E, 0x03, 0xD0, 0x00, 0x38, 0x0F, 0x40, 0x00, 0xE0, 0x3D, 0x00, 0x07, 0x40, 0xF4, 0x00,
-    0x2C, 0x03, 0xD0, 0x00, 0xF0, 0x0F, 0x40, 0x07, 0x80, 0x3D, 0x02, 0x7C, 0x00, 0xF4, 0x2F, 0xE0,
-    0x0B, 0xF8, 0xBE, 0x00, 0xFF, 0xF4, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x82, 0xFE,
-    0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0xFB, 0x80, 0x3B, 0xD0, 0x0F, 0x3C, 0x0B, 0x3D,
-    0x00, 0xF2, 0xD0, 0xE3, 0xD0, 0x0F, 0x1F, 0x2C, 0x3D, 0x00, 0xF0, 0xF7, 0x83, 0xD0, 0x0F, 0x07,
-    0xF0, 0x3D, 0x00, 0xF0, 0x3E, 0x03, 0xD0, 0x0F, 0x01, 0xC0, 0x3D, 0x02, 0xF9, 0x00, 0x07, 0xF8,
-    0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x0F, 0xFF, 0x4B, 0xFE, 0x02, 0xFF, 0x40, 0x3E, 0x00,
-    0x0F, 0x40, 0x0F, 0x80, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0xF9, 0x55, 0x7D, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x0F, 0x95, 0x57, 0xD0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x3D, 0x00,
-    0x3E, 0x00, 0x0F, 0x40, 0x2F, 0xE0, 0x0B, 0xF8, 0x3F, 0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xBF, 0xD0, 0xBC, 0x01, 0xFC, 0x7C, 0x00, 0x2F, 0x6F, 0x00, 0x03,
-    0xEF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xEB, 0xD0, 0x00,
-    0xF0, 0xFC, 0x00, 0xF8, 0x2F, 0xE6, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03,
-    0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0,
-    0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x2F, 0xE0, 0x1F,
-    0xE8, 0x3F, 0xFD, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x1F, 0xF8, 0x0F, 0xFE, 0xFF,
-    0xFC, 0x02, 0xFD, 0x02, 0xF8, 0x07, 0xD0, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x1F,
-    0x41, 0xF0, 0x00, 0x7D, 0x07, 0xC0, 0x01, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x3E, 0x01,
-    0xF0, 0x02, 0xF0, 0x07, 0xFE, 0xBF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x1A, 0xAA, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0xBE, 0xBF, 0x4B, 0xC0, 0x3E, 0x3C, 0x00, 0xB6, 0xF0,
-    0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F,
-    0xD0, 0x00, 0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x01, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFC, 0x3C, 0x1F, 0x03, 0xC3, 0x81, 0xF0, 0x3C, 0x38, 0x1F, 0x02, 0x80, 0x01, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x07, 0xFE, 0x40, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x2F, 0xF8, 0xFF, 0x90, 0x6F,
-    0xD0, 0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0x0F, 0x40, 0x0B, 0xC0, 0x3C, 0x00,
-    0x1F, 0x02, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xBD, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x0B, 0xD0, 0xF4, 0x7F, 0x43, 0xD0, 0x3D, 0x03, 0xF2,
-    0xF0, 0x0F, 0x40, 0x7C, 0xF8, 0x03, 0xD0, 0x0F, 0x7E, 0x00, 0xF4, 0x03, 0xDF, 0x80, 0x3D, 0x00,
-    0xF7, 0xF0, 0x0F, 0x40, 0x7C, 0x7D, 0x03, 0xD0, 0x2F, 0x0F, 0xD0, 0xF4, 0x2F, 0x00, 0xFF, 0xBF,
-    0xFF, 0x40, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0A, 0xAA, 0x40, 0x00,
-    0x3F, 0xF8, 0x3F, 0xF4, 0xFF, 0xD0, 0xBF, 0x80, 0x7E, 0x00, 0xF4, 0x00, 0x7D, 0x0F, 0x40, 0x00,
-    0xBC, 0xB4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3C,
-    0xF8, 0x00, 0x03, 0xC1, 0xF4, 0x00, 0x3D, 0x02, 0xF0, 0x07, 0xF4, 0x07, 0xF8, 0xBF, 0xF4, 0xBF,
-    0xF4, 0x3F, 0xFC, 0x1F, 0xFF, 0x0B, 0xFE, 0x03, 0xFF, 0x40, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80,
-    0x0B, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x2F, 0x00,
-    0x2F, 0xEA, 0xBF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x40, 0xBF, 0xF0,
-    0xBF, 0xF2, 0xFF, 0x82, 0xFF, 0x40, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F,
-    0x00, 0x2F, 0x00, 0x7C, 0x00, 0x7F, 0x56, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x05, 0x1F, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x02, 0xFF, 0xF0, 0x2F,
-    0xF8, 0x7F, 0xE2, 0xFF, 0xC2, 0xFF, 0x47, 0xFC, 0x1F, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x00,
-    0x3D, 0x00, 0xF0, 0x07, 0xC0, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF0, 0x07, 0xC0,
-    0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF0, 0x07, 0xC0, 0x03, 0xD0, 0x0F, 0x00, 0x7C,
-    0x00, 0x3D, 0x00, 0xF0, 0x07, 0xC0, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x00, 0xBF, 0xAA, 0xFA, 0xAF,
-    0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xF8, 0x7F, 0xE2, 0xFF, 0xC2, 0xFF, 0x47, 0xFC,
-    0x1F, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF0, 0x07, 0xC0, 0x03, 0xD0, 0x0F,
-    0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF0, 0x07, 0xC0, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x00, 0x3D, 0x00,
-    0xF0, 0x07, 0xC0, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF0, 0x07, 0xC0, 0x03, 0xD0,
-    0x0F, 0x00, 0x7C, 0x00, 0xBF, 0xAA, 0xFA, 0xAF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x38, 0x0F, 0x00, 0x00, 0x34, 0x0F, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x90, 0x00, 0x0F, 0xEF, 0xF4, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x3C, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x2F, 0xAB, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xFD, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x03, 0xD0, 0x00, 0x07,
-    0xC0, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x03, 0xFB, 0xE4, 0x07, 0xC0,
-    0x03, 0xFF, 0xFE, 0x07, 0xC0, 0x03, 0xD0, 0x2F, 0x07, 0xC0, 0x03, 0xD0, 0x0F, 0x47, 0xC0, 0x03,
-    0xD0, 0x0F, 0x47, 0xC0, 0x03, 0xD0, 0x1F, 0x07, 0xC0, 0x0B, 0xFA, 0xFD, 0x0B, 0xF8, 0x3F, 0xFF,
-    0xE4, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x3F, 0xEF, 0xF0, 0x0F,
-    0x40, 0x7D, 0x03, 0xD0, 0x0F, 0x40, 0xF4, 0x03, 0xD0, 0x3D, 0x00, 0xF0, 0x2F, 0xEA, 0xF8, 0x3F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xAF, 0xF4, 0x28,
-    0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x55, 0x7F, 0x00, 0xFF, 0xFF, 0x00, 0x14,
-    0x2E, 0x00, 0x00, 0x3E, 0x14, 0x00, 0x3D, 0x3C, 0x00, 0xBC, 0x3F, 0xAB, 0xF0, 0x0F, 0xFF, 0x80,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0x80,
-    0xBE, 0xBF, 0x80, 0x0F, 0x80, 0xBC, 0x02, 0xF4, 0x03, 0xE0, 0x3D, 0x00, 0x3E, 0x00, 0xF8, 0x1F,
-    0x00, 0x0B, 0xC0, 0x3E, 0x5B, 0xC0, 0x01, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x7C, 0x03, 0xE5, 0xBC,
-    0x00, 0x1F, 0x00, 0xF8, 0x1F, 0x00, 0x0B, 0xC0, 0x3E, 0x07, 0xD0, 0x03, 0xE0, 0x0F, 0x80, 0xFC,
-    0x01, 0xF0, 0x0B, 0xF8, 0x1F, 0xD6, 0xF4, 0x0F, 0xFF, 0x41, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x2B, 0xFF, 0xD0, 0x2F, 0xFF, 0xF8, 0x07, 0xD0, 0x3D, 0x00, 0xBC, 0x03, 0xD0,
-    0x0B, 0xC0, 0x3D, 0x00, 0x7E, 0x03, 0xD0, 0x02, 0xFF, 0xBD, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8,
-    0x3D, 0x00, 0x1F, 0x03, 0xD0, 0x03, 0xE0, 0x3D, 0x00, 0xFC, 0x0B, 0xF8, 0x3F, 0x03, 0xFF, 0xD1,
-    0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x3F, 0xAF, 0xC3, 0xE0,
-    0x0F, 0x9F, 0x00, 0x2F, 0xB8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x00, 0x00, 0xF8,
-    0x00, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x0B, 0xFF, 0xE0, 0x00, 0x54, 0x00,
-    0x06, 0x00, 0x90, 0x7E, 0x0F, 0xC0, 0xF8, 0x3F, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x03, 0xFA, 0xFC, 0x3E, 0x00, 0xF9, 0xF0, 0x02, 0xFB, 0x80, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0xBF, 0xFE, 0x00, 0x05, 0x40, 0x00, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x06, 0xFD,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x6B, 0xFA, 0xA0, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC6, 0xFD, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0x91, 0xFD,
-    0x00, 0xF4, 0x01, 0xF8, 0x03, 0xD0, 0x03, 0xF0, 0x0F, 0x40, 0x0B, 0xC0, 0x3D, 0x00, 0x2F, 0x00,
-    0xF4, 0x00, 0x7C, 0x03, 0xD0, 0x01, 0xF0, 0x0F, 0x40, 0x0B, 0xC1, 0xBF, 0x80, 0x2F, 0x1F, 0xFF,
-    0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x03, 0xE0, 0x2D, 0x03, 0xE0, 0x1D, 0x03, 0xE0, 0x1C,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x0B, 0xFA, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x0F, 0xEA,
-    0xFC, 0x2E, 0x00, 0x7C, 0x7C, 0x00, 0x38, 0xB8, 0x00, 0x00, 0xF8, 0x15, 0x00, 0xFF, 0xFF, 0x00,
-    0xF9, 0x55, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x07,
-    0xFF, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x1F, 0x5B, 0xD3, 0xC0, 0x2D, 0x3C,
-    0x00, 0xC3, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xC1, 0x00, 0xBE, 0x70, 0x02,
-    0xE7, 0x80, 0x2E, 0x7E, 0x5B, 0xC3, 0xFF, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0B,
-    0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03,
-    0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B,
-    0xF9, 0x7F, 0xFE, 0x18, 0x02, 0x43, 0xF0, 0xFC, 0x3F, 0x0B, 0xC0, 0x40, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F,
-    0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x2F, 0xE4,
-    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x0B, 0xFC, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xBC, 0x00,
-    0xF8, 0x07, 0xF0, 0x2F, 0xC0, 0x2E, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x00, 0x38, 0x0F, 0x40, 0x00, 0x00, 0x38, 0x0F, 0x40, 0x00,
-    0x00, 0x38, 0x0F, 0xFF, 0x90, 0x00, 0x74, 0x0F, 0xEF, 0xF4, 0x00, 0xB0, 0x0F, 0x40, 0xBC, 0x00,
-    0xF0, 0x0F, 0x40, 0x3C, 0x01, 0xE0, 0x0F, 0x40, 0x3C, 0x27, 0xC0, 0x0F, 0x40, 0xBC, 0xBF, 0x80,
-    0x2F, 0xAB, 0xF0, 0xBE, 0x00, 0xFF, 0xFF, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x1F,
-    0xFE, 0x00, 0x0B, 0xFE, 0x07, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x80, 0x0B,
-    0x80, 0x00, 0x03, 0xE0, 0x02, 0xE0, 0x00, 0x00, 0xF9, 0x55, 0xFE, 0xA8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0F, 0x95, 0x5F, 0x80, 0xBC, 0x03, 0xE0, 0x02, 0xE0, 0x0F, 0x40, 0xF8, 0x00, 0xB8,
-    0x03, 0xD0, 0x3E, 0x00, 0x2E, 0x01, 0xF0, 0x2F, 0xE0, 0x1F, 0xEA, 0xF8, 0x3F, 0xFD, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x06,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x6B, 0xFA, 0xA0, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC2, 0xFE, 0x00, 0x00, 0xFB, 0xFF,
-    0xF0, 0x00, 0x3F, 0xD1, 0xFE, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4,
-    0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00,
-    0xF4, 0x00, 0xBC, 0x01, 0xBF, 0x80, 0x7F, 0x91, 0xFF, 0xF0, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x07, 0xD0, 0xBF, 0xD0,
-    0x3F, 0x40, 0x3D, 0x03, 0xC0, 0x00, 0xF4, 0x2D, 0x00, 0x03, 0xD0, 0xE0, 0x00, 0x0F, 0x9F, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x0F, 0x41, 0xF0, 0x00,
-    0x3D, 0x03, 0xF0, 0x02, 0xFD, 0x03, 0xE0, 0x3F, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x0B, 0xFF, 0x4B, 0xFD, 0x02, 0xFF, 0x80, 0x3D, 0x00, 0x0F, 0x00, 0x0F, 0x40,
-    0x0F, 0xC0, 0x03, 0xD0, 0x0F, 0xF0, 0x00, 0xF4, 0x1F, 0x3C, 0x00, 0x3D, 0x1F, 0x0F, 0x00, 0x0F,
-    0x5E, 0x03, 0xC0, 0x03, 0xFE, 0x00, 0xF0, 0x00, 0xFE, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x0F, 0x00,
-    0x2F, 0x90, 0x0B, 0xF8, 0x3F, 0xFC, 0x0F, 0xFF, 0x40, 0x02, 0xC0, 0x18, 0x00, 0x0F, 0x00, 0xF8,
-    0x00, 0x3F, 0x07, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x82, 0xFF, 0x8F, 0xF9, 0x06, 0xFD, 0x0F, 0x80, 0x03, 0xD0, 0x2F, 0x00, 0x1F, 0x00, 0x3D,
-    0x00, 0xF4, 0x00, 0xBC, 0x03, 0xC0, 0x01, 0xF0, 0x2E, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x07, 0xC7,
-    0x80, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x1F, 0xFF, 0x0B, 0xFE, 0x03, 0xFF, 0x40,
-    0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xBC,
-    0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF8, 0x00,
-    0xBC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x2F, 0xEA, 0xBF, 0xE4, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x00, 0xAA, 0xA8, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xFA, 0xFE, 0xBF, 0xC0, 0x74,
-    0x0F, 0x80, 0x38, 0x07, 0x00, 0xF8, 0x03, 0x40, 0x10, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00,
-    0xF8, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x0B,
-    0xC0, 0x00, 0xF8, 0x01, 0xF8, 0x00, 0x6F, 0xEB, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFB, 0xFB, 0xF0, 0x0E, 0x0F, 0x42,
-    0xC0, 0x24, 0x3D, 0x05, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xEA, 0xA4, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x3D, 0x01, 0xF4, 0x00, 0xF4, 0x03, 0xE0, 0x03, 0xD0, 0x0F, 0x40, 0x0F, 0x40, 0x3C, 0x00,
-    0xBE, 0xAB, 0xE0, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00,
-    0x3F, 0x43, 0xE0, 0x00, 0x01, 0xF8, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xBC, 0xFE,
-    0xAA, 0xAA, 0xAF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00,
-    0xBC, 0xBD, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x01, 0xF4, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0xFE,
-    0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xBF, 0xD0, 0xBC, 0x01, 0xFC, 0x7C, 0x00,
-    0x1F, 0x6E, 0x00, 0x03, 0xEF, 0x95, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0x5B, 0xBF, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0xF0, 0xFC, 0x00, 0xF8, 0x2F, 0xE6, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x05,
-    0x50, 0x00, 0x15, 0x55, 0x00, 0x01, 0xA2, 0xFF, 0xF8, 0x00, 0x3F, 0xD1, 0xFE, 0x00, 0x02, 0xFF,
-    0x41, 0xF8, 0x00, 0x0F, 0x44, 0x03, 0xF0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0x1F,
-    0x40, 0x0F, 0x00, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x02, 0xD0, 0x00, 0x00, 0xF4, 0x0F,
-    0x00, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x07, 0xC2, 0xD0, 0x00, 0x00, 0x0F, 0x4F, 0x00, 0x00,
-    0x00, 0x2E, 0x3C, 0x00, 0x00, 0x00, 0x7E, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0xFC, 0x3F, 0xE4, 0x03, 0xFC, 0x0F, 0x80, 0x07, 0xD8, 0x0B, 0xC0, 0x0F,
-    0x00, 0x03, 0xD0, 0x0F, 0x00, 0x03, 0xE0, 0x2D, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0xF4, 0x78,
-    0x00, 0x00, 0xB8, 0xB0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0xF0,
-    0x07, 0xC0, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x05, 0x55, 0x3F, 0xFF, 0x00, 0x7F, 0xFE, 0x1F,
-    0xD0, 0x00, 0x6F, 0x80, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0x03, 0xF4, 0x02, 0xF0, 0x00,
-    0x3F, 0xD0, 0x0B, 0xC0, 0x03, 0xEF, 0x40, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0xBC, 0x03, 0xD0, 0xF4,
-    0x02, 0xF0, 0x3D, 0x03, 0xD0, 0x0B, 0xC3, 0xD0, 0x0F, 0x40, 0x2F, 0x3E, 0x00, 0x3D, 0x00, 0xBF,
-    0xE0, 0x00, 0xF4, 0x02, 0xFE, 0x00, 0x03, 0xD0, 0x0B, 0xE0, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00,
-    0x3D, 0x02, 0xFE, 0x80, 0x06, 0xFE, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x03, 0x80, 0x00, 0x2E, 0x01, 0xF0,
-    0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xF4, 0xBF, 0xD0, 0x2F, 0xF8, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0xF4,
-    0x00, 0xFC, 0x00, 0x3D, 0x00, 0xFF, 0x00, 0x0F, 0x41, 0xF3, 0xC0, 0x03, 0xD1, 0xF0, 0xF0, 0x00,
-    0xF5, 0xE0, 0x3C, 0x00, 0x3F, 0xE0, 0x0F, 0x00, 0x0F, 0xE0, 0x03, 0xC0, 0x03, 0xE0, 0x00, 0xF0,
-    0x02, 0xF9, 0x00, 0xBF, 0x83, 0xFF, 0xC0, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x40, 0x15, 0x55,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2B, 0xFA, 0x80,
-    0x01, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x0B, 0xEA, 0xBF, 0x80, 0x2F, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0xBC, 0x0B,
-    0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0xFC, 0x0B, 0xFE, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xBC, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x06, 0xBE, 0xA4, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x0F, 0xEB, 0xF4, 0x03, 0xC0, 0x2F,
-    0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x00, 0xF0, 0x0F, 0x00, 0xBC, 0x1B, 0xEA, 0xFD, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0x50, 0x0F, 0xFF, 0xFF, 0xD0, 0x1F, 0xC1, 0xBF, 0x40, 0xBC,
-    0x00, 0xFC, 0x0B, 0xC0, 0x0B, 0xC0, 0xBC, 0x00, 0x7C, 0x0B, 0xC2, 0x0B, 0xC0, 0xBC, 0x78, 0xF8,
-    0x0B, 0xC2, 0xFF, 0x00, 0xBE, 0xAF, 0xD0, 0x0B, 0xFF, 0xFC, 0x00, 0xBC, 0x01, 0xD0, 0x0B, 0xC0,
-    0x0B, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x1F, 0xF8, 0x0F, 0xFE, 0xFF, 0xFC, 0x02, 0xFD,
-    0x02, 0xF8, 0x07, 0xD0, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x1F, 0x41, 0xF0, 0x00,
-    0x7C, 0x07, 0xC0, 0x41, 0xF0, 0x1F, 0x07, 0x4B, 0xC0, 0x7C, 0x0F, 0x3E, 0x01, 0xF0, 0x0F, 0xF0,
-    0x07, 0xFE, 0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x00, 0x7C, 0x00, 0x38, 0x01, 0xF0, 0x00, 0x50, 0x07,
-    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xB5, 0x55, 0x55, 0x7D, 0xFF, 0xFF, 0xFF, 0x47, 0xFA,
-    0xAA, 0x80, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x02, 0xC0, 0x00, 0x0B, 0x2F, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xF0, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8,
-    0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x02, 0xFE, 0x80, 0x3F, 0xFF, 0x80, 0x15,
-    0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFE, 0x07, 0xFA, 0xAB, 0xD0, 0x2F, 0x00, 0x3D, 0x02, 0xF0, 0x02,
-    0xD0, 0x2F, 0x00, 0x2C, 0x02, 0xF0, 0x00, 0x40, 0x2F, 0x00, 0x00, 0x17, 0xF5, 0x50, 0x07, 0xFF,
-    0xFF, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xFD, 0x03, 0xE0, 0x2D, 0x03, 0xE0, 0x1D, 0x03, 0xE0, 0x1C, 0x03, 0xE0, 0x00,
-    0x3F, 0xFF, 0x80, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x0B,
-    0xFA, 0x00, 0x3F, 0xFF, 0x40, 0x55, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFE, 0x01, 0xFE, 0xAA, 0xF4,
-    0x02, 0xF0, 0x02, 0xD0, 0x0B, 0xC0, 0x0B, 0x00, 0x2F, 0x00, 0x04, 0x00, 0xBC, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0xBC, 0x01, 0xFE, 0x02, 0xF0,
-    0x00, 0xFC, 0x0B, 0xC0, 0x01, 0xF8, 0x2F, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x0F, 0x82, 0xF0, 0x00,
-    0x3E, 0x2F, 0xF8, 0x00, 0xFB, 0xFF, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1B, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xE0, 0x0F, 0x00, 0x3E, 0x00, 0x60, 0x03, 0xE0, 0x00,
-    0x00, 0x3E, 0x6A, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x3E, 0x01, 0xFC, 0x03, 0xE0, 0x03, 0xE0, 0x3E,
-    0x00, 0x3F, 0x03, 0xE0, 0x02, 0xF0, 0xBF, 0x80, 0x2F, 0x3F, 0xFD, 0x02, 0xF0, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x6F, 0xE0, 0x00, 0x07,
-    0xE4, 0x00, 0x06, 0x40, 0x05, 0x55, 0x00, 0x24, 0x03, 0xF4, 0x0F, 0xFF, 0xC0, 0x3F, 0x40, 0xFF,
-    0x00, 0x7F, 0x40, 0x3F, 0xD0, 0x02, 0xF0, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x2D, 0x02, 0xF0, 0x0F,
-    0x00, 0x00, 0x03, 0xC0, 0xBC, 0x0B, 0x40, 0x00, 0x00, 0xB4, 0x2F, 0x03, 0xC0, 0x00, 0x00, 0x0F,
-    0x0B, 0xC2, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x7C, 0x2F, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x3F, 0x02,
-    0xF0, 0x2F, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0xBE, 0x00,
-    0x0F, 0xD0, 0x0B, 0xC0, 0x0F, 0xD0, 0x0F, 0xE0, 0x0B, 0xFE, 0x00, 0xFD, 0x1F, 0xE0, 0x0F, 0xFF,
-    0xC0, 0x1F, 0xE1, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x01, 0xFF,
-    0xC0, 0xFC, 0x2F, 0xC1, 0xBE, 0x43, 0xFC, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0x00, 0xB0, 0x3C, 0x0F,
-    0x00, 0x00, 0x38, 0x3C, 0x2D, 0x00, 0x00, 0x2D, 0x7D, 0x78, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x00, 0x7C, 0x3C, 0x3D, 0x00, 0x00, 0xF8, 0x3C, 0x1F, 0x00, 0x01, 0xF0, 0x3C, 0x0F, 0x80, 0x03,
-    0xE0, 0x3C, 0x07, 0xD0, 0x0F, 0xC0, 0x7E, 0x03, 0xF4, 0x7F, 0x03, 0xFF, 0xC0, 0xFE, 0x14, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x6A, 0x90, 0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xD0,
-    0x7F, 0x00, 0xF0, 0x00, 0xF8, 0x0E, 0x00, 0x0F, 0x80, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xD0, 0x40, 0x00, 0x7D, 0x3D, 0x00, 0x0B, 0xC3, 0xF0, 0x01, 0xFC, 0x2F,
-    0xE6, 0xBF, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x17, 0xC0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x41, 0xFA, 0xFF, 0x0A, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x05, 0xBC, 0x00, 0x3F,
-    0xF8, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF1, 0x40, 0x0B, 0xCF, 0x00, 0x3E, 0x3F, 0x9B, 0xF0, 0x3F,
-    0xFE, 0x00, 0x06, 0xC0, 0x00, 0x07, 0x40, 0x01, 0x2C, 0x00, 0x1F, 0xE0, 0x00, 0x29, 0x00, 0x00,
-    0x55, 0x54, 0x00, 0x60, 0x3F, 0xFF, 0x00, 0xBF, 0x01, 0xFD, 0x00, 0x7F, 0xC0, 0x2F, 0x00, 0x3D,
-    0x00, 0x0B, 0xC0, 0x2E, 0x00, 0x02, 0xF0, 0x0F, 0x00, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x2F, 0x03,
-    0x80, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x2F,
-    0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0xFC, 0x00,
-    0x2F, 0x00, 0x1F, 0xC0, 0x2F, 0xF8, 0x02, 0xFC, 0x3F, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x1F, 0x42, 0xFF, 0x40,
-    0xFD, 0x00, 0xF4, 0x0F, 0x00, 0x03, 0xD0, 0xB4, 0x00, 0x0F, 0x43, 0x80, 0x00, 0x3E, 0x7C, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00,
-    0xF4, 0x0F, 0xC0, 0x0B, 0xF4, 0x0F, 0x80, 0xFF, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x55, 0x54,
-    0x00, 0x18, 0x0F, 0xFF, 0xC0, 0x0F, 0xE0, 0x1F, 0xD0, 0x02, 0xFE, 0x00, 0xBC, 0x00, 0x3C, 0x00,
-    0x0B, 0xC0, 0x0B, 0x40, 0x00, 0xBC, 0xA0, 0xF0, 0x00, 0x0B, 0xCB, 0x1D, 0x00, 0x00, 0xBC, 0xB3,
-    0xC0, 0x00, 0x0B, 0xEF, 0xF8, 0x00, 0x00, 0xBE, 0xFF, 0xC0, 0x00, 0x0B, 0xCB, 0x3E, 0x00, 0x00,
-    0xBC, 0xB2, 0xF0, 0x00, 0x0B, 0xCB, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x2F, 0xE8, 0x00, 0xBE, 0x0F, 0xFF, 0xC0, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xC2, 0xFF, 0x40, 0xBF, 0x00,
-    0xF4, 0x03, 0x80, 0x03, 0xD5, 0x2C, 0x00, 0x0F, 0x68, 0xE0, 0x00, 0x3D, 0xBB, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x03, 0xDA, 0x7C, 0x00, 0x0F, 0x68, 0xF4, 0x00, 0x3D, 0x52, 0xF0, 0x00, 0xF4, 0x03,
-    0xE0, 0x0B, 0xE4, 0x07, 0xD0, 0xFF, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x15, 0x55, 0x00,
-    0x18, 0x03, 0xFF, 0xF0, 0x0B, 0xF0, 0x07, 0xF4, 0x01, 0xFF, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x2B,
-    0xFA, 0x0B, 0x80, 0x03, 0xFF, 0xF0, 0xF0, 0x00, 0x02, 0xF0, 0x2D, 0x00, 0x00, 0x2F, 0x03, 0x80,
-    0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x00, 0x2F,
-    0x03, 0xF0, 0x00, 0x02, 0xF0, 0x1F, 0x80, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x03, 0xF0,
-    0x00, 0x2F, 0x00, 0x1F, 0xC0, 0x0B, 0xFE, 0x00, 0xBF, 0x03, 0xFF, 0xF0, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x06, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0xFC, 0x6B, 0xE8, 0x3F, 0xC0, 0x3C, 0x0B, 0x80, 0x03,
-    0xC0, 0xE0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xD7, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xC7, 0xC0,
-    0x00, 0x3C, 0x2F, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x3C, 0x0B, 0xD0, 0x1B, 0xE4, 0x3F, 0x07, 0xFF,
-    0xC0, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x15, 0x55, 0x54, 0x00, 0x60, 0x0F, 0xFF, 0xFF, 0x40, 0xBF,
-    0x03, 0xEA, 0xBE, 0x00, 0x7F, 0xC0, 0xF0, 0x1F, 0x40, 0x3D, 0x00, 0x3C, 0x07, 0xD0, 0x2E, 0x00,
-    0x09, 0x01, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0x7D, 0x0B, 0x40, 0x00, 0x00, 0x1F, 0x43, 0xC0, 0x00,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00,
-    0x00, 0x1F, 0x42, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00,
-    0x00, 0x7D, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x1F, 0xC0, 0x00, 0x1F, 0xF8, 0x02, 0xFC, 0x00,
-    0x2F, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x1F, 0x43, 0xFF, 0xF8, 0x1F, 0xD0, 0xF0, 0xB8, 0x0F, 0x00, 0x38, 0x2E, 0x0B, 0x40, 0x0E,
-    0x0B, 0x83, 0x80, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2E, 0x2F, 0x00,
-    0x00, 0x0B, 0x83, 0xD0, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0xB8, 0x0F, 0xC0, 0x00, 0x7F, 0x41,
-    0xF8, 0x00, 0xBF, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x55, 0x54, 0x00, 0x55, 0x54, 0xFF,
-    0xFC, 0x01, 0xFF, 0xF8, 0x1F, 0xD0, 0x00, 0x5F, 0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0,
-    0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00,
-    0x0F, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0xF8, 0x00, 0x6F, 0xE8, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x4B, 0xFE, 0x02, 0xFF, 0x40, 0x3E, 0x00, 0x0F, 0x40, 0x0F,
-    0x80, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0xF9, 0x55, 0x7D, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x0F, 0x95, 0x57, 0xD0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x0F,
-    0x40, 0x2F, 0xE0, 0x0B, 0xF9, 0x3F, 0xFD, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x40, 0x55,
-    0x54, 0x00, 0x55, 0x55, 0x53, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xD1, 0xFD, 0x00, 0x05, 0xFE, 0xAF,
-    0x02, 0xF0, 0x00, 0x03, 0xE0, 0x3C, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0xF0, 0x2F, 0x00, 0x00, 0x3E,
-    0x02, 0x40, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x6F, 0xE4,
-    0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0xF8, 0xBF, 0xE0, 0x2F, 0xFF,
-    0xE0, 0x3E, 0x00, 0x0F, 0x43, 0x80, 0xF8, 0x00, 0x3D, 0x0E, 0x03, 0xE0, 0x00, 0xF4, 0x34, 0x0F,
-    0x95, 0x57, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xF9, 0x55, 0x7D, 0x00, 0x03, 0xE0, 0x00,
-    0xF4, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x02, 0xFE, 0x00, 0xBF, 0x80,
-    0x3F, 0xFD, 0x0F, 0xFF, 0x40, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x01, 0xFE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xF0, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x2F, 0xC0, 0x2F, 0x00, 0x02, 0xF0, 0x01, 0xF8,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0B,
-    0xC0, 0x01, 0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x7C, 0x2F, 0xF8, 0x02, 0xFE, 0x80, 0x2F, 0x3F,
-    0xFF, 0x03, 0xFF, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x7C,
-    0x00, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xDF, 0xFD, 0x00, 0x3E, 0x00,
-    0x1F, 0xFF, 0xFE, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0xFC, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xF8, 0x0F,
-    0x80, 0x07, 0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0xC2, 0xFE, 0x01, 0xFE, 0x40, 0x2F,
-    0x3F, 0xFD, 0x0F, 0xFF, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x0A, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x01, 0xFE,
-    0x80, 0x00, 0x00, 0x2F, 0x80, 0x7F, 0x80, 0x02, 0xF4, 0x0B, 0xEF, 0xC0, 0x1F, 0x40, 0xBC, 0x0F,
-    0x40, 0xFC, 0x03, 0xD0, 0x2F, 0x03, 0xD0, 0x1F, 0x00, 0x7C, 0x2F, 0x00, 0xBC, 0x01, 0xF0, 0xBC,
-    0x02, 0xF0, 0x03, 0xC3, 0xF0, 0x0B, 0xC0, 0x1F, 0x0F, 0xC0, 0x2F, 0x00, 0x7C, 0x2F, 0x00, 0x7C,
-    0x02, 0xF0, 0x7D, 0x00, 0xF0, 0x0F, 0x40, 0xFC, 0x03, 0xE0, 0x3C, 0x02, 0xF4, 0x07, 0xC3, 0xD0,
-    0x03, 0xF4, 0x0B, 0xEE, 0x00, 0x03, 0xFE, 0x5F, 0xF4, 0x14, 0x01, 0xFF, 0xFA, 0xFF, 0xD0, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xB8, 0x1F, 0xD0, 0x0B,
-    0x82, 0xE7, 0xD0, 0x3C, 0x0F, 0x07, 0xC2, 0xE0, 0xB8, 0x0F, 0x0F, 0x42, 0xD0, 0x3D, 0x3D, 0x0F,
-    0x40, 0xF4, 0xF4, 0x2D, 0x03, 0xC3, 0xE0, 0xB8, 0x0F, 0x0B, 0xC1, 0xF0, 0xB4, 0x0F, 0x82, 0xE7,
-    0xC0, 0x1F, 0x93, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x01, 0x50, 0x54, 0x00, 0x00, 0x05, 0xA5,
-    0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF9, 0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xE0,
-    0x00, 0x2C, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x01, 0xFF, 0x40, 0x06, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x43, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0xBE, 0xBF, 0x4B, 0xC0, 0x3E, 0x3C, 0x00, 0xB6, 0xF0,
-    0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F,
-    0xD0, 0x00, 0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x02, 0xD0, 0x00, 0x07, 0x40, 0x01, 0x2C, 0x00,
-    0x1F, 0xE0, 0x00, 0x29, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xEA,
-    0xBF, 0xAA, 0xF0, 0xF0, 0x0F, 0x80, 0x3C, 0x3C, 0x03, 0xE0, 0x0F, 0x09, 0x00, 0xF8, 0x02, 0x40,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFC, 0x3C, 0x1F, 0x03, 0xC3, 0x81, 0xF0, 0x3C, 0x38, 0x1F, 0x02, 0x80, 0x01, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x34, 0x00, 0x00, 0x01, 0x00, 0x15, 0x54, 0x01, 0x55, 0x6F,
-    0xFF, 0x81, 0xFF, 0xE1, 0xFE, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x03, 0xD0, 0x02, 0xF4, 0x01, 0xF0,
-    0x00, 0x3F, 0x00, 0xF4, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x0F, 0x6E,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x1B, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x2F, 0xF8, 0xFF, 0x90, 0x6F, 0xD0,
-    0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0x0F, 0x40, 0x0B, 0xC0, 0x3C, 0x00, 0x1F,
-    0x02, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0A, 0xAA, 0x40, 0x00,
-    0x15, 0x54, 0x01, 0x55, 0x6F, 0xFF, 0x81, 0xFF, 0xE1, 0xFE, 0x00, 0x0B, 0xD0, 0x0F, 0x80, 0x03,
-    0xD0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x07, 0xD0, 0x78, 0x00, 0x00, 0xFC,
-    0x3C, 0x00, 0x00, 0x0F, 0x5E, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0A, 0xBF, 0xE9, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x2F,
-    0xF8, 0xFF, 0x90, 0x6F, 0xD0, 0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0x0F, 0x40,
-    0x0B, 0xC0, 0x3C, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00,
-    0xF2, 0xC0, 0x00, 0x02, 0xEE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0x6F,
-    0x50, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x0A, 0xAA, 0x40, 0x00, 0x15, 0x55, 0x00, 0x55, 0x40, 0xFF, 0xFC, 0x0B, 0xFF, 0x40, 0x7F,
-    0x40, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x1F,
-    0x00, 0x00, 0x01, 0xFC, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xCB, 0xD0, 0x00, 0x00, 0x3D,
-    0x0F, 0xC0, 0x00, 0x02, 0xE0, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x2F, 0x80, 0x00, 0xF4, 0x00, 0x3F,
-    0x40, 0x2F, 0xE4, 0x01, 0xFF, 0xA3, 0xFF, 0xF0, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF4, 0xFF, 0xD0, 0xBF, 0x80, 0x7E,
-    0x00, 0xF4, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0xBC, 0xB4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3C, 0xF8, 0x00, 0x03, 0xC1, 0xF4, 0x00, 0x3D, 0x02, 0xF0,
-    0x07, 0xF4, 0x07, 0xF8, 0xBF, 0xF4, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x40, 0x15, 0x55, 0x55, 0x01, 0x55,
-    0x40, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0x83, 0xE7, 0xF5, 0xF4, 0x07, 0xE0, 0x0F, 0x0B, 0xC2, 0xD0,
-    0x0F, 0x40, 0x38, 0x2F, 0x07, 0x00, 0x3D, 0x00, 0x90, 0xBC, 0x18, 0x00, 0xF4, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40,
-    0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03,
-    0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xF4, 0xFF, 0xFF, 0xF0, 0xFF, 0x83, 0x87,
-    0xC3, 0xC0, 0xF4, 0x0D, 0x1F, 0x0B, 0x03, 0xD0, 0x20, 0x7C, 0x14, 0x0F, 0x40, 0x01, 0xF0, 0x00,
-    0x3D, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x40,
-    0x01, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x7F, 0xEA, 0xAF, 0xF9, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x54, 0x05, 0x55, 0x47,
-    0xFF, 0xD0, 0xFF, 0xF8, 0x1B, 0xE0, 0x06, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00,
-    0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x03,
-    0xF4, 0x00, 0xF4, 0x00, 0x1F, 0xFA, 0xBF, 0x40, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xF2, 0xFF, 0x82, 0xFF, 0x40, 0xF8,
-    0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x7F, 0x56,
-    0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x05, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0x15, 0x54, 0x05, 0x55, 0x5F,
-    0xFF, 0x43, 0xFF, 0xE1, 0xBE, 0x00, 0x6F, 0x80, 0x0F, 0x40, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0xF4,
-    0x00, 0xF4, 0x00, 0x3D, 0x00, 0x3D, 0x04, 0x0F, 0x40, 0x0F, 0x83, 0x83, 0xD0, 0x03, 0xF4, 0xE0,
-    0xF4, 0x00, 0x7F, 0xFE, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x17, 0x83, 0xD0, 0x00, 0x00,
-    0xE0, 0xF4, 0x00, 0x00, 0x38, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x07, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xE0, 0xBF, 0xF0, 0xBF, 0xF2, 0xFF, 0x82, 0xFF, 0x40,
-    0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x81, 0x1F, 0x00, 0x2F, 0x2C, 0x7C, 0x00, 0x7F,
-    0xB6, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0x1F, 0x00, 0x00, 0x2C, 0x7C, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x02, 0xFF, 0xF0, 0x55, 0x54, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02,
-    0xF4, 0x01, 0xFC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x0B, 0xC0, 0x01, 0xF4,
-    0x02, 0xF0, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x2F, 0x00, 0x07, 0xD0, 0x2F, 0xE8, 0x07,
-    0xFE, 0x3F, 0xFF, 0x07, 0xFF, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0xFD, 0x00, 0x03, 0xEF, 0xFF, 0xC0, 0x00, 0xFE, 0x02, 0xF8,
-    0x00, 0x3D, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00,
-    0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4,
-    0x00, 0xBC, 0x01, 0xBF, 0x80, 0x7F, 0x91, 0xFF, 0xF0, 0x7F, 0xFC, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x03, 0xF9, 0x1B, 0xF0, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x08,
-    0x1F, 0x40, 0x00, 0xFC, 0x3C, 0x3F, 0x00, 0x00, 0xBC, 0x38, 0x3D, 0x00, 0x00, 0xBC, 0x7D, 0xBD,
-    0x00, 0x00, 0xBC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0A, 0xFE, 0xAA, 0xAA, 0xA8, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x68, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x01, 0xFE, 0xBF, 0x05, 0x0F, 0x40, 0x7D, 0x38, 0xB8, 0x00, 0xF9, 0xE3, 0xD0, 0x02,
-    0xE3, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x03, 0xF9,
-    0x1B, 0xF0, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x08, 0x1F, 0x40, 0x00, 0xFC, 0x3C, 0x3F, 0x00, 0x00,
-    0xBC, 0x38, 0x3D, 0x00, 0x00, 0xBC, 0x7D, 0xBD, 0x00, 0x00, 0xBC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0A, 0xFE, 0xAA, 0xAA, 0xA8, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x68, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x01, 0xFE, 0xBF, 0x05, 0x0F, 0x40, 0x7D, 0x38, 0xB8, 0x00, 0xF9, 0xE3, 0xD0,
-    0x02, 0xE3, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x55, 0x54, 0xFF, 0xFD, 0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x2F, 0xF8, 0xFF, 0xFD, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x55,
-    0x50, 0x02, 0x40, 0x3F, 0x40, 0xFF, 0xFC, 0x03, 0xF4, 0x0F, 0xF0, 0x07, 0xF4, 0x03, 0xFD, 0x00,
-    0x2F, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x0B, 0xC0,
-    0xB4, 0x00, 0x00, 0x0B, 0x42, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0xBC, 0x2D, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xC2, 0xF0, 0xBC,
-    0x00, 0x00, 0x03, 0xE0, 0xBC, 0x0F, 0x40, 0x00, 0x03, 0xF0, 0x2F, 0x02, 0xF0, 0x00, 0x01, 0xF4,
-    0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0xBC, 0x00, 0xFD,
-    0x00, 0xFE, 0x00, 0xBF, 0xE0, 0x0F, 0xD1, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFE, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x0A, 0x00, 0xA0, 0x00, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x00, 0x0F,
-    0x82, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x01, 0xFF, 0xC0, 0xFC, 0x2F, 0xC1, 0xBE, 0x43, 0xFC, 0x01, 0xE0, 0x3C, 0x07,
-    0x80, 0x00, 0xB0, 0x3C, 0x0F, 0x00, 0x00, 0x38, 0x3C, 0x2D, 0x00, 0x00, 0x2D, 0x7D, 0x78, 0x00,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7C, 0x3C, 0x3D, 0x00, 0x00, 0xF8, 0x3C, 0x1F, 0x00, 0x01,
-    0xF0, 0x3C, 0x0F, 0x80, 0x03, 0xE0, 0x3C, 0x07, 0xD0, 0x0F, 0xC0, 0x7E, 0x02, 0xF0, 0x7F, 0x03,
-    0xFF, 0xC0, 0xFD, 0x14, 0x00, 0x00, 0x00, 0x04, 0x55, 0x54, 0x00, 0x28, 0xFF, 0xFC, 0x01, 0xFE,
-    0x1F, 0xD0, 0x07, 0xFE, 0x0B, 0xC0, 0x0F, 0x40, 0x0B, 0xC0, 0x3D, 0x00, 0x0B, 0xC0, 0xB8, 0x00,
-    0x0B, 0xC1, 0xF0, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xC0, 0x1F, 0xF0, 0x0B, 0xC0, 0x03, 0xF4, 0x0B, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xFC,
-    0x0B, 0xC0, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0xFC, 0x2F, 0xF8, 0x00, 0xF8, 0xFF, 0xFC, 0x00, 0xF4,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x16, 0xFE, 0x00,
-    0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x7D, 0x2F,
-    0xF4, 0x1F, 0xD0, 0x3D, 0x03, 0xC0, 0x03, 0xD0, 0xB0, 0x00, 0x3D, 0x0E, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x3F, 0xFF, 0xD0, 0x03, 0xE5, 0xBF, 0x40, 0x3D, 0x00, 0xFC, 0x03, 0xD0, 0x07, 0xD0, 0x3D,
-    0x00, 0x3E, 0x0B, 0xF4, 0x03, 0xE3, 0xFF, 0xC0, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xEA, 0xFE, 0x00, 0x00, 0xB4, 0x07, 0xC0,
-    0x00, 0x0B, 0x40, 0x7C, 0x00, 0x00, 0xB4, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0xF0,
-    0x07, 0xC0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x7C, 0x00,
-    0x02, 0xD0, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0xF4, 0x00,
-    0x7C, 0x07, 0x6F, 0x00, 0x07, 0xC0, 0xBF, 0xC0, 0x01, 0xFF, 0x9B, 0xF4, 0x00, 0xFF, 0xFE, 0x14,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0x80, 0x03, 0xC0, 0xF4, 0x00, 0x0E, 0x03, 0xD0, 0x00, 0x38, 0x0F, 0x40, 0x00, 0xE0, 0x3D,
-    0x00, 0x07, 0x40, 0xF4, 0x00, 0x2C, 0x03, 0xD0, 0x00, 0xF0, 0x0F, 0x40, 0x07, 0x80, 0x3D, 0x02,
-    0x7C, 0x00, 0xF4, 0x2F, 0xE0, 0x0B, 0xF9, 0xBE, 0x00, 0xFF, 0xF8, 0x40, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x04, 0x00, 0x55, 0x54,
-    0x00, 0x55, 0x57, 0xFF, 0xF0, 0x07, 0xFF, 0xE1, 0xFD, 0x00, 0x05, 0xF8, 0x02, 0xF0, 0x00, 0x03,
-    0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02,
-    0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xBC, 0x00,
-    0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xF8, 0x00, 0x0F, 0x43, 0xFF,
-    0xF0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x01, 0xAF, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x0F, 0xFF, 0x4B, 0xFE, 0x02, 0xFF, 0x80, 0x3E, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x03,
-    0xD0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0xF9, 0x55, 0x7D, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0x95,
-    0x57, 0xD0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x2F,
-    0xE0, 0x03, 0xC0, 0x3F, 0xFD, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x55, 0x54, 0x00, 0x55, 0x57, 0xFF, 0xF0, 0x07, 0xFF, 0xE1, 0xFD, 0x00, 0x05, 0xF8, 0x02,
-    0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00,
-    0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F,
-    0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xF8, 0x00,
-    0x6F, 0xE7, 0xFF, 0xF0, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x4B, 0xFE, 0x02, 0xFF, 0x40, 0x3E, 0x00, 0x0F, 0x40,
-    0x0F, 0x80, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0xF9, 0x55, 0x7D, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x0F, 0x95, 0x57, 0xD0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x3E, 0x00,
-    0x0F, 0x40, 0x2F, 0xE0, 0x0B, 0xF8, 0x3F, 0xFD, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x15, 0x54, 0x05, 0x55, 0x5F, 0xFF, 0x43, 0xFF, 0xE1, 0xBE, 0x00, 0x6F, 0x80, 0x0F, 0x40, 0x03,
-    0xD0, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x0F, 0x80,
-    0x03, 0xD0, 0x03, 0xF4, 0x00, 0xF4, 0x00, 0x7F, 0xEA, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00,
-    0x15, 0x43, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xF2, 0xFF, 0x82, 0xFF, 0x40, 0xF8, 0x01,
-    0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x7F, 0x56, 0xF0,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x05, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x55, 0x00,
-    0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x02, 0xFE,
-    0x00, 0x01, 0xEF, 0x40, 0x0F, 0x7C, 0x00, 0x07, 0x6F, 0x00, 0x39, 0xF0, 0x00, 0x2D, 0x7C, 0x02,
-    0xD7, 0xC0, 0x00, 0xB0, 0xF4, 0x0F, 0x0F, 0x00, 0x03, 0xC2, 0xE0, 0x38, 0x3C, 0x00, 0x0F, 0x07,
-    0xC2, 0xC0, 0xF4, 0x00, 0x3C, 0x0F, 0x4F, 0x03, 0xD0, 0x00, 0xF0, 0x2E, 0x78, 0x0F, 0x40, 0x03,
-    0xC0, 0x3E, 0xC0, 0x3E, 0x00, 0x1F, 0x00, 0xFF, 0x00, 0xB8, 0x00, 0x78, 0x02, 0xF4, 0x02, 0xF0,
-    0x01, 0xE0, 0x03, 0xC0, 0x0B, 0xC0, 0x2F, 0xE4, 0x05, 0x00, 0xBF, 0xE3, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x82, 0xFE, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x02,
-    0xFD, 0x00, 0xFB, 0x80, 0x3B, 0xD0, 0x0F, 0x3C, 0x0B, 0x3D, 0x00, 0xF2, 0xD0, 0xE3, 0xD0, 0x0F,
-    0x1F, 0x2C, 0x3D, 0x00, 0xF0, 0xF7, 0x83, 0xD0, 0x0F, 0x07, 0xF0, 0x3D, 0x00, 0xF0, 0x3E, 0x03,
-    0xD0, 0x0F, 0x01, 0xC0, 0x3D, 0x02, 0xF9, 0x00, 0x07, 0xF8, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x2B, 0xE4, 0x03, 0xD0, 0x03, 0xD0, 0x03,
-    0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03,
-    0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x1B, 0xF9, 0xBF, 0xFE, 0x00, 0x10, 0x00,
-    0x40, 0x00, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x7D, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0xF0,
-    0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00,
-    0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0xB9, 0x56, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF, 0xC0, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0x3F,
-    0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x00, 0x0B, 0xFE, 0x3F, 0xFD, 0x00, 0xFF, 0xFD, 0x1C,
-    0x01, 0xD0, 0x0F, 0x40, 0xB8, 0x02, 0xF4, 0x7D, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0xBE, 0xAF, 0x80, 0x3D, 0x03, 0xF0, 0x0F, 0x00, 0x7C, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x06, 0xFF, 0xF0, 0x0B, 0xFA, 0xBC, 0x0B, 0xC0, 0x1F, 0x02,
-    0xF0, 0x07, 0xC0, 0xBC, 0x03, 0xF0, 0x1F, 0xEB, 0xFF, 0xE2, 0xFF, 0x8B, 0xF0, 0x05, 0x00, 0x00,
-    0x00, 0x2D, 0x07, 0x80, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00,
-    0x00, 0xB4, 0xF4, 0x00, 0x00, 0x03, 0xC3, 0xF0, 0x00, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x00, 0xF4,
-    0x0F, 0x80, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x2E, 0x55, 0xBD, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0B, 0xEA, 0xAB, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x0F,
-    0x80, 0x00, 0x2F, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x8F, 0xFF, 0x40, 0x3F, 0xFF, 0x40, 0x09, 0x01,
-    0x80, 0x0F, 0xC1, 0xF8, 0x02, 0xF0, 0x7E, 0x00, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF8, 0x00, 0xBE, 0xAF, 0x80, 0x3D, 0x03, 0xF0, 0x0F, 0x00, 0x7C, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x06, 0xFF, 0xF0, 0x0B, 0xFA, 0xBC, 0x0B, 0xC0, 0x1F, 0x02, 0xF0,
-    0x07, 0xC0, 0xBC, 0x03, 0xF0, 0x1F, 0xEB, 0xFF, 0xE2, 0xFF, 0x8B, 0xF0, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0xAA,
-    0xF8, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x38, 0x00, 0x00, 0x3C,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x7E, 0xAF, 0xC0, 0x00, 0x07, 0xC0, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0x55, 0xBD, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x55, 0xBC, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x7C, 0x00, 0x0C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2D, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x3C, 0x0B,
-    0xE4, 0x01, 0xFF, 0xFF, 0xFC, 0x3F, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFD, 0x0B, 0xFD, 0x02, 0xFA, 0xBD, 0xFA, 0xFD, 0x0F, 0x40, 0xFF, 0x40, 0xFC, 0x3C, 0x01,
-    0xF8, 0x01, 0xF0, 0x00, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0x6F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xEA,
-    0x54, 0x2F, 0x91, 0xF0, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x2F,
-    0x00, 0xBF, 0x80, 0x04, 0x7F, 0xAF, 0xBF, 0xFF, 0xF0, 0xBF, 0xF4, 0x2F, 0xFF, 0x40, 0x14, 0x00,
-    0x05, 0x40, 0x00, 0x01, 0x00, 0x14, 0x00, 0xB8, 0x03, 0xD0, 0x0B, 0xD0, 0x7D, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E,
-    0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x0A, 0x00, 0xA0, 0x7C, 0x03, 0xC0, 0xF8, 0x2F, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x03, 0xFA, 0xFC, 0x3E, 0x00, 0xF9,
-    0xF0, 0x02, 0xFB, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xD0, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0xBF, 0xFE, 0x00, 0x05, 0x40, 0x00, 0x6A,
-    0x90, 0x00, 0x2F, 0xFF, 0xF4, 0x03, 0xF9, 0x5B, 0xF8, 0x2E, 0x00, 0x03, 0xF4, 0x60, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xF6, 0xF0,
-    0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x3E, 0x0F, 0xC0, 0x03, 0xF0, 0x1F, 0xEA, 0xBF, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x07, 0xFA, 0xFD, 0x28, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xEA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x02, 0xFF, 0x80, 0x0F, 0xAF, 0x00, 0x7C, 0x3F, 0x5B, 0xD0, 0x3F, 0xFD, 0x00, 0x05, 0x00, 0x00,
-    0x01, 0xD0, 0x28, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xE5, 0x6F, 0xE0, 0xB8, 0x00,
-    0x0F, 0xD1, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFB,
-    0xE0, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xF8, 0x3F, 0x00, 0x0F, 0xC0, 0x7F,
-    0xAA, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x05, 0x50, 0x00, 0x18, 0x02, 0x40, 0xFC, 0x2F, 0x43,
-    0xF0, 0xBC, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x1F, 0xEB, 0xF4,
-    0xA0, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x3E, 0xBC, 0x01, 0xF0, 0xFD, 0x6F, 0x40, 0xFF, 0xF4, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x28, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x90, 0x01, 0x55, 0x40, 0x09, 0x00, 0xFD, 0x03, 0xFF, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x1F,
-    0xD0, 0x0F, 0xF4, 0x00, 0xBC, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0B, 0x40, 0xBC, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x2F, 0x02, 0xD0, 0x00, 0x00, 0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x00, 0x03, 0xC2, 0xF0,
-    0xB4, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x82, 0xF0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x0B,
-    0xC0, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x2F, 0x80, 0x03, 0xF4,
-    0x02, 0xF0, 0x03, 0xF4, 0x03, 0xF8, 0x02, 0xFF, 0x80, 0x3F, 0x47, 0xF8, 0x03, 0xFF, 0xF0, 0x07,
-    0xF8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x06, 0x00, 0x90, 0x00, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x01, 0xFF, 0xC0, 0xFC, 0x2F, 0xC1, 0xBE, 0x43, 0xFC, 0x01,
-    0xE0, 0x3C, 0x07, 0x80, 0x00, 0xB0, 0x3C, 0x0F, 0x00, 0x00, 0x38, 0x3C, 0x2D, 0x00, 0x00, 0x2D,
-    0x7D, 0x78, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7C, 0x3C, 0x3D, 0x00, 0x00, 0xF8, 0x3C,
-    0x1F, 0x00, 0x01, 0xF0, 0x3C, 0x0F, 0x80, 0x03, 0xE0, 0x3C, 0x07, 0xD0, 0x0F, 0xC0, 0x7E, 0x02,
-    0xF0, 0x7F, 0x03, 0xFF, 0xC0, 0xFD, 0x14, 0x00, 0x00, 0x00, 0x04, 0x01, 0xD0, 0x28, 0x00, 0x3F,
-    0x0B, 0xD0, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0xFD, 0x07, 0xF0, 0x0F, 0x00, 0x0F, 0x80, 0xE0, 0x00, 0xF8, 0x0D, 0x00,
-    0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x04, 0x00, 0x07, 0xD3, 0xD0, 0x00,
-    0xBC, 0x3F, 0x00, 0x1F, 0xC2, 0xFE, 0x6B, 0xF0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x06,
-    0x01, 0x80, 0x7E, 0x0F, 0xC1, 0xF4, 0x3F, 0x01, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x07, 0xEB, 0xFC, 0x28, 0x01, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x16, 0xF0,
-    0x00, 0xFF, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xC5, 0x00, 0x2F, 0x3C, 0x00, 0xF8, 0xFE, 0x6F,
-    0xC0, 0xFF, 0xF8, 0x00, 0x15, 0x00, 0x05, 0x55, 0x55, 0x00, 0xFF, 0xFF, 0xFC, 0x1F, 0xAA, 0xAF,
-    0xC1, 0xE0, 0x02, 0xF0, 0x1D, 0x00, 0xBC, 0x00, 0x80, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0x6F, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x20, 0x00, 0x0F, 0xC3, 0xD0, 0x02, 0xF4, 0x3F, 0xEA,
-    0xFE, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x3C,
-    0x00, 0xF8, 0x34, 0x03, 0xE0, 0x10, 0x0F, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF9,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x34, 0x00, 0xFC, 0x7E, 0x07, 0xF0, 0x2F, 0xFF, 0xC0, 0x06,
-    0xA9, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x01, 0x55, 0x4F, 0xFF,
-    0xC0, 0x1F, 0xFF, 0x87, 0xF4, 0x00, 0x1B, 0xE0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x2F, 0x00, 0x00,
-    0xFD, 0x00, 0xBC, 0x00, 0x0F, 0xF4, 0x02, 0xF0, 0x00, 0xFB, 0xD0, 0x0B, 0xC0, 0x0F, 0x4F, 0x40,
-    0x2F, 0x00, 0xF4, 0x3D, 0x00, 0xBC, 0x0F, 0x40, 0xF4, 0x02, 0xF0, 0xF4, 0x03, 0xD0, 0x0B, 0xCF,
-    0x80, 0x0F, 0x40, 0x2F, 0xF8, 0x00, 0x3D, 0x00, 0xBF, 0x80, 0x00, 0xF4, 0x02, 0xF8, 0x00, 0x03,
-    0xD0, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0xBF, 0xA0, 0x01, 0xBF, 0x9F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x02, 0xFF, 0xD2, 0xFF, 0x40, 0xBF, 0xE0, 0x0F, 0x40,
-    0x03, 0xC0, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0xF4, 0x03, 0xFC, 0x00, 0x3D, 0x07, 0xCF, 0x00, 0x0F,
-    0x47, 0xC3, 0xC0, 0x03, 0xD7, 0x80, 0xF0, 0x00, 0xFF, 0x80, 0x3C, 0x00, 0x3F, 0x80, 0x0F, 0x00,
-    0x0F, 0x80, 0x03, 0xC0, 0x0B, 0xE4, 0x02, 0xFE, 0x0F, 0xFF, 0x03, 0xFF, 0xD0, 0x00, 0x1E, 0x02,
-    0x80, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x01, 0x55, 0x4F, 0xFF, 0xC0, 0x1F, 0xFF, 0x87, 0xF4,
-    0x00, 0x1B, 0xE0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x2F, 0x00, 0x00, 0xFD, 0x00, 0xBC, 0x00, 0x0F,
-    0xF4, 0x02, 0xF0, 0x00, 0xFB, 0xD0, 0x0B, 0xC0, 0x0F, 0x4F, 0x40, 0x2F, 0x00, 0xF4, 0x3D, 0x00,
-    0xBC, 0x0F, 0x40, 0xF4, 0x02, 0xF0, 0xF4, 0x03, 0xD0, 0x0B, 0xCF, 0x80, 0x0F, 0x40, 0x2F, 0xF8,
-    0x00, 0x3D, 0x00, 0xBF, 0x80, 0x00, 0xF4, 0x02, 0xF8, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x0F,
-    0x40, 0xBF, 0xA0, 0x01, 0xBF, 0x9F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x14, 0x06, 0x00, 0x00,
-    0x2F, 0x43, 0xF0, 0x00, 0x07, 0xD0, 0xFC, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xF4, 0xBF, 0xD0, 0x2F, 0xF8, 0x03, 0xD0, 0x00,
-    0xF0, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0xFF, 0x00, 0x0F, 0x41, 0xF3, 0xC0, 0x03, 0xD1,
-    0xF0, 0xF0, 0x00, 0xF5, 0xE0, 0x3C, 0x00, 0x3F, 0xE0, 0x0F, 0x00, 0x0F, 0xE0, 0x03, 0xC0, 0x03,
-    0xE0, 0x00, 0xF0, 0x02, 0xF9, 0x00, 0xBF, 0x83, 0xFF, 0xC0, 0xFF, 0xF4, 0x00, 0x28, 0x07, 0x40,
-    0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0x91, 0xBF, 0xC0,
-    0x0F, 0xD0, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x1F, 0xC7, 0xD0, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCF,
-    0xC0, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00,
-    0x2F, 0x43, 0xF8, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0xEA, 0xFF, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x02, 0x40, 0x60, 0x02, 0xF4, 0x7E, 0x00, 0xBC,
-    0x1F, 0x80, 0x04, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x3F,
-    0xEF, 0xF4, 0x2F, 0x00, 0x7F, 0x1F, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x3F, 0xF8,
-    0x00, 0x0F, 0xFE, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0xFA, 0xF4, 0x00, 0x3C, 0x3F, 0x00, 0x3E, 0x0B,
-    0xF9, 0xBF, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0x54, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43,
-    0xE0, 0x00, 0x01, 0xF8, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xBC, 0xFE, 0xAA, 0xAA,
-    0xAF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0xBC, 0xBD,
-    0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x01, 0xF4, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F,
-    0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xBF, 0xD0, 0xBC, 0x01, 0xFC, 0x7C, 0x00, 0x1F, 0x6E,
-    0x00, 0x03, 0xEF, 0x95, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0x5B, 0xBF, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0xF0, 0xFC, 0x00, 0xF8, 0x2F, 0xE6, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x28, 0x07, 0x40, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
-    0x3F, 0x91, 0xBF, 0xC0, 0x0F, 0xC0, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x00,
-    0x1F, 0x87, 0xD0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xEA, 0xAA, 0xAA, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00,
-    0xF8, 0x3F, 0x00, 0x00, 0x1F, 0x43, 0xF4, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F,
-    0xEA, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x02, 0x40, 0x60, 0x02,
-    0xF4, 0x7E, 0x00, 0xBC, 0x1F, 0x80, 0x04, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x3F, 0xEF, 0xF4, 0x2F, 0x00, 0x7F, 0x1F, 0x00, 0x07, 0xDB, 0x80, 0x00, 0xFB,
-    0xE5, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x55, 0x56, 0xEF, 0xC0, 0x00, 0xFA, 0xF0, 0x00, 0x3C,
-    0x3F, 0x00, 0x3E, 0x0B, 0xF9, 0xBF, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0x54, 0x00, 0x07, 0x80, 0xA0,
-    0x00, 0x3F, 0x0B, 0xE0, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA9, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xE5, 0xBF, 0xD0, 0x3C, 0x00, 0x1F, 0xC0, 0xF0,
-    0x00, 0x1F, 0x82, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xF4, 0x02, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B,
-    0xC1, 0x00, 0x00, 0x3E, 0x2E, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x2F, 0x81, 0xFF, 0xAB, 0xF8, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x06, 0x00, 0x90, 0x1F, 0x83, 0xF0, 0x1F, 0x83, 0xF0,
-    0x05, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xEF, 0xF4, 0x28,
-    0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x55, 0x7F, 0x00, 0xFF, 0xFF, 0x00, 0x14,
-    0x2E, 0x00, 0x00, 0x3E, 0x14, 0x00, 0x3D, 0x3C, 0x00, 0xBC, 0x3F, 0xAB, 0xF0, 0x0F, 0xFF, 0x80,
-    0x00, 0x54, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x05, 0x55, 0xBF, 0xFE,
-    0x02, 0xFF, 0xE1, 0xFE, 0x00, 0x03, 0xF4, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x07, 0xC0,
-    0x00, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x02, 0xF0,
-    0x7C, 0x00, 0x00, 0x0F, 0x8B, 0x40, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xC3, 0xC0,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0xBF, 0xE3, 0xFE, 0x41, 0xBF, 0x43, 0xE0, 0x00, 0xF4, 0x0B, 0xC0, 0x07,
-    0xC0, 0x0F, 0x40, 0x3D, 0x00, 0x2F, 0x00, 0xF0, 0x00, 0x7C, 0x0B, 0x80, 0x00, 0xF8, 0x3C, 0x00,
-    0x01, 0xF1, 0xE0, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x02, 0x80, 0x00, 0x03, 0xF0,
-    0xBE, 0x00, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x40, 0x05, 0x55, 0xBF, 0xFE, 0x02, 0xFF, 0xE1, 0xFE, 0x00, 0x03, 0xF4, 0x03, 0xE0, 0x00,
-    0x3D, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00,
-    0x3E, 0x03, 0xD0, 0x00, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x0F, 0x8B, 0x40, 0x00, 0x00, 0xBC, 0xF0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0xC3, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x90, 0x14, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x3F, 0x0B, 0xD0,
-    0x00, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x82, 0xFF, 0x8F,
-    0xF9, 0x06, 0xFD, 0x0F, 0x80, 0x03, 0xD0, 0x2F, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0xBC,
-    0x03, 0xC0, 0x01, 0xF0, 0x2E, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x07, 0xC7, 0x80, 0x00, 0x0F, 0x7C,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0xB0, 0x00, 0x01, 0xF8, 0x2F,
-    0x40, 0x00, 0x7F, 0x0B, 0xE0, 0x00, 0x1F, 0x83, 0xF4, 0x00, 0x02, 0x80, 0x34, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x40, 0x05, 0x55, 0xBF, 0xFE, 0x02, 0xFF, 0xE1, 0xFE, 0x00, 0x03, 0xF4,
-    0x03, 0xE0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xC0,
-    0x1F, 0x00, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x0F, 0x8B, 0x40, 0x00,
-    0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xC3, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x2C, 0x00,
-    0x01, 0xF0, 0xF4, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0xB8, 0x3C, 0x00, 0x03, 0xC1, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x2F, 0xF8, 0xFF, 0x90, 0x6F, 0xD0, 0xF8, 0x00,
-    0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0x0F, 0x40, 0x0B, 0xC0, 0x3C, 0x00, 0x1F, 0x02, 0xE0,
-    0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0xFA, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x0B, 0x40, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x0B, 0xD0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x01, 0x55, 0x57, 0xFF, 0xD0, 0xFF, 0xF8, 0x6F, 0x80, 0x1B, 0xE0,
-    0x03, 0xD0, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x03,
-    0xD0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0xFD, 0x00, 0x3D, 0x00, 0x1F, 0xFA, 0xBF, 0x40, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x05, 0x50, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xF8,
-    0x01, 0x80, 0x24, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x10, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x0B, 0xFF, 0x2F, 0xF8, 0x2F, 0xF4, 0x0F, 0x80,
-    0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x02, 0xF0, 0x07, 0xC0, 0x07, 0xF5, 0x6F,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x51, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0x00, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xE1, 0xFE,
-    0xAA, 0xF4, 0x2F, 0x00, 0x3D, 0x0B, 0xC0, 0x0B, 0x42, 0xF0, 0x02, 0xC0, 0xBC, 0x00, 0x10, 0x2F,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x03, 0xE0, 0x2D, 0x03,
-    0xE0, 0x1D, 0x03, 0xE0, 0x1C, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0x40,
-    0x00, 0x0B, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x90, 0x78,
-    0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x15, 0x54, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xD1, 0xFD, 0x00, 0x00, 0x1B, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00,
-    0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xC0, 0x0B, 0xC0,
-    0x00, 0x00, 0x7C, 0x00, 0xBF, 0xFF, 0x80, 0x07, 0xC0, 0x0B, 0xEA, 0xFF, 0x40, 0x7C, 0x00, 0xBC,
-    0x00, 0xFC, 0x07, 0xC0, 0x0B, 0xC0, 0x07, 0xD0, 0x7C, 0x00, 0xBC, 0x00, 0x3E, 0x07, 0xC0, 0x0B,
-    0xC0, 0x03, 0xD0, 0x7C, 0x00, 0xBC, 0x00, 0x7C, 0x07, 0xC0, 0x0B, 0xC0, 0x1F, 0xC0, 0x7C, 0x02,
-    0xFE, 0xBF, 0xF0, 0x2F, 0xF8, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x90, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00,
-    0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x7F, 0xFD, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x00,
-    0x07, 0xC0, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x03, 0xFB, 0xE4, 0x07, 0xC0, 0x03, 0xFF, 0xFE, 0x07,
-    0xC0, 0x03, 0xD0, 0x2F, 0x07, 0xC0, 0x03, 0xD0, 0x0F, 0x47, 0xC0, 0x03, 0xD0, 0x0F, 0x47, 0xC0,
-    0x03, 0xD0, 0x1F, 0x07, 0xC0, 0x0B, 0xFA, 0xFD, 0x0B, 0xF8, 0x3F, 0xFF, 0xE4, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFE, 0x07, 0xFA, 0xAB, 0xD0, 0x2F,
-    0x00, 0x3D, 0x02, 0xF0, 0x02, 0xD0, 0x2F, 0x00, 0x2C, 0x02, 0xF0, 0x00, 0x40, 0x2F, 0x00, 0x00,
-    0x17, 0xF5, 0x50, 0x07, 0xFF, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x03, 0xE0,
-    0x2D, 0x03, 0xE0, 0x1D, 0x03, 0xE0, 0x1C, 0x03, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xE0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xF9, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x47, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x68, 0x00, 0x15, 0x55,
-    0x00, 0x55, 0x43, 0xFF, 0xF0, 0x2F, 0xFD, 0x07, 0xF4, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x0F, 0x80,
-    0x00, 0xBD, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x1F, 0xCF, 0x40, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xF2, 0xF4, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x0B, 0x80, 0x3F, 0x00, 0x01, 0xF0, 0x02,
-    0xF8, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x2F, 0xE4, 0x00, 0x7F, 0x0F, 0xFF, 0xC0, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x6F,
-    0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF4, 0xFF, 0xD0,
-    0xBF, 0x80, 0x7E, 0x00, 0xF4, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0xBC, 0xB4, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3C, 0xF8, 0x00, 0x03, 0xC1, 0xF4, 0x00,
-    0x3D, 0x02, 0xF0, 0x07, 0xF4, 0x03, 0xF0, 0xBF, 0xF4, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x15, 0x55, 0x00, 0x55, 0x43, 0xFF, 0xF0, 0x2F, 0xFD, 0x07, 0xF4, 0x00, 0x7E, 0x00,
-    0x1F, 0x80, 0x0F, 0x80, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x0F, 0x8F,
-    0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xAB, 0xFE, 0xA8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xF2, 0xF4, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x0B, 0x80, 0x3F,
-    0x00, 0x01, 0xF0, 0x01, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0xD0, 0x2F, 0xE4, 0x01, 0xFF, 0x9F, 0xFF,
-    0xC0, 0xBF, 0xFF, 0x3F, 0xF8, 0x3F, 0xF4, 0xFF, 0xD0, 0xBF, 0x80, 0x7E, 0x00, 0xF4, 0x00, 0x7C,
-    0x0F, 0x40, 0x00, 0xBC, 0xB4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x5B, 0xFD,
-    0x40, 0x00, 0x3C, 0xF4, 0x00, 0x03, 0xC1, 0xF4, 0x00, 0x3D, 0x02, 0xF0, 0x07, 0xF4, 0x07, 0xF8,
-    0xBF, 0xF4, 0xBF, 0xF4, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00,
-    0x03, 0x0C, 0x2F, 0x80, 0xF0, 0x3F, 0xC1, 0x94, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00,
-    0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x38, 0x55, 0x5E, 0xEA, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0,
-    0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x55, 0xFA, 0xAB, 0x34, 0x03, 0x0A, 0x03,
-    0x02, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x01, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x55, 0x55,
-    0x54, 0xFF, 0xFF, 0xFE, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xE5, 0x55, 0x55,
-    0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x14, 0x05, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x68, 0x0A, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0x03, 0xC3, 0xC0, 0xF0, 0xB8, 0x3F, 0x0B, 0xD0, 0xF4, 0x05, 0x0B, 0xD0, 0xF8, 0x3E, 0x0F, 0x43,
-    0xC2, 0xD0, 0xE0, 0x00, 0x07, 0xC1, 0xF8, 0x3E, 0x0F, 0x83, 0xC1, 0xE0, 0xF0, 0x10, 0x00, 0x14,
-    0x1F, 0x4F, 0xC2, 0xE0, 0x7C, 0x0F, 0x01, 0xD0, 0x2C, 0x01, 0x00, 0x40, 0xF0, 0x3C, 0x3C, 0x0F,
-    0x03, 0xC0, 0xF0, 0xB8, 0x2E, 0x0F, 0xC3, 0xF0, 0xBD, 0x2F, 0x43, 0xD0, 0xF4, 0x05, 0x01, 0x42,
-    0xF4, 0xBD, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x43, 0xD0, 0xF0, 0x3C, 0x2D, 0x0B, 0x43, 0x80,
-    0xE0, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x1F, 0x87, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF0, 0x3C,
-    0x1E, 0x07, 0x83, 0xC0, 0xF0, 0x10, 0x04, 0x00, 0x14, 0x05, 0x07, 0xD1, 0xF4, 0xFC, 0x3F, 0x0B,
-    0x82, 0xE0, 0x7C, 0x1F, 0x03, 0xC0, 0xF0, 0x1D, 0x07, 0x40, 0xB0, 0x2C, 0x00, 0x29, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xBE, 0xFE, 0x3F, 0xFF,
-    0xFE, 0x10, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xBE,
-    0xFE, 0x3F, 0xFF, 0xFE, 0x10, 0x3C, 0x04, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x3D, 0x00, 0x25, 0x3D, 0x19, 0x3F, 0xFF, 0xFE, 0x3E, 0x7D, 0x6D, 0x00, 0x3D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x4B, 0xFC, 0xFF, 0xDB,
-    0xFC, 0x3F, 0x40, 0x00, 0x24, 0x00, 0x1F, 0xD0, 0x07, 0xFF, 0x41, 0xFF, 0xFD, 0x7F, 0xFF, 0xDF,
-    0xFF, 0x87, 0xFE, 0x01, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x2E, 0x1F, 0xC3, 0xF0, 0x10, 0x00, 0x00,
-    0x00, 0xF4, 0x0B, 0x8B, 0xF0, 0x7F, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x07, 0xCB, 0xF0, 0x03, 0xF0, 0x03, 0xF9, 0xF8, 0x00, 0xFC, 0x00,
-    0xBD, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x19, 0x0F, 0xC7, 0xF0, 0xB4, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x38, 0x40, 0x5E, 0xD0, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x1C, 0x00, 0xB5, 0x01, 0xFA, 0x07, 0x34, 0x03, 0x0A, 0x03, 0x02, 0x43, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x80,
-    0x0B, 0xE0, 0x29, 0xA8, 0x61, 0x89, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x01, 0x04, 0x00, 0x0A,
-    0x34, 0x00, 0x0A, 0x38, 0x15, 0x5E, 0x28, 0xEA, 0xBC, 0x73, 0x01, 0xC7, 0x0C, 0x1C, 0x70, 0x30,
-    0x86, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x1C, 0xA0, 0x02, 0xCA, 0x00, 0x2C, 0xB5, 0x54, 0xD3, 0xEA, 0xB0, 0xD3, 0x40, 0xC0, 0xA3,
-    0x43, 0x00, 0x92, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0,
-    0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x5F, 0x40, 0x0B, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x07, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x03, 0xC0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x03, 0xC2, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0x83, 0x82, 0xFF, 0x00, 0x2F, 0xF4,
-    0x2F, 0x5F, 0x0B, 0x0F, 0x9B, 0xC0, 0xB9, 0xBC, 0x0F, 0xFC, 0x1D, 0x1E, 0x03, 0xD0, 0xF0, 0x2E,
-    0x00, 0x40, 0x3C, 0x2D, 0x01, 0xE1, 0xE0, 0x1F, 0x00, 0x00, 0xB0, 0x3D, 0x01, 0xE2, 0xD0, 0x0F,
-    0x00, 0x00, 0xE0, 0x3C, 0x01, 0xE2, 0xD0, 0x0F, 0x00, 0x02, 0xC0, 0x3D, 0x02, 0xE2, 0xE0, 0x1E,
-    0x00, 0x07, 0x80, 0x2E, 0x03, 0xC1, 0xF0, 0x2D, 0x00, 0x0F, 0x00, 0x0F, 0x9B, 0x80, 0xF9, 0xBC,
-    0x00, 0x2D, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0B,
-    0x43, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x2D, 0x0F, 0x83, 0xD1, 0xF0, 0xBC, 0x3E, 0x0F,
-    0x87, 0xC1, 0xF0, 0xB4, 0x3D, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x0B, 0x43, 0xC0, 0xF8, 0x3D, 0x1F, 0x47, 0xC2, 0xF0, 0xBC, 0x3E, 0x0F, 0x83, 0xD1, 0xF0, 0x7C,
-    0x2F, 0x0B, 0x43, 0xD0, 0xF0, 0x38, 0x0E, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x3E, 0x02, 0xF0, 0x0F, 0x40, 0xBC, 0x03, 0xD0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E,
-    0x03, 0xE0, 0xBC, 0x0B, 0xC0, 0xF4, 0x0F, 0x42, 0xF0, 0x2F, 0x03, 0xD0, 0x3D, 0x07, 0xC0, 0x34,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x3C, 0x03, 0xE0, 0xBC, 0x0F,
-    0x40, 0xBC, 0x0F, 0x43, 0xF0, 0x0F, 0x42, 0xF0, 0x3D, 0x02, 0xF0, 0x3D, 0x0B, 0xC0, 0x3D, 0x07,
-    0xC0, 0xF0, 0x03, 0x40, 0xB0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x07, 0xE0,
-    0x00, 0x7D, 0xE0, 0x07, 0xC1, 0xE0, 0x7C, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x07, 0xC0,
-    0x7C, 0x0B, 0xD0, 0x3E, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0xB8, 0x00, 0x78, 0x00, 0x00, 0x70, 0x00,
-    0xF4, 0x00, 0xF4, 0x01, 0xF8, 0x02, 0xF0, 0x0F, 0xC0, 0xF8, 0x0F, 0x80, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0C, 0x38, 0x02, 0x40, 0x38, 0x0E, 0x07, 0xC0, 0xE0,
-    0x03, 0x42, 0x43, 0x80, 0x01, 0xD0, 0x0F, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x1D, 0xB0, 0x00,
-    0x1F, 0x07, 0xC0, 0xF0, 0x1F, 0x0B, 0xC0, 0xF0, 0x00, 0x1C, 0xB0, 0x00, 0x00, 0x74, 0x2C, 0x00,
-    0x01, 0xD0, 0x0B, 0x00, 0x03, 0x43, 0x83, 0xC0, 0x0D, 0x07, 0xC0, 0xE0, 0x38, 0x02, 0x40, 0x38,
-    0xA0, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xA2, 0xF0, 0x0F, 0xCF, 0xC0, 0x3E,
-    0x3E, 0x00, 0xF8, 0xF8, 0x03, 0xD3, 0xE0, 0x0F, 0x4F, 0x40, 0x3D, 0x3D, 0x00, 0xF0, 0xF4, 0x03,
-    0xC3, 0xD0, 0x0F, 0x0B, 0x40, 0x3C, 0x2D, 0x00, 0xF0, 0x74, 0x02, 0xC1, 0xD0, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x01, 0xE3, 0xF4, 0x0F, 0xCF, 0xC0, 0x3F, 0x04, 0x00, 0x10, 0x55,
-    0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x50, 0x55, 0x4F, 0xFD, 0xAA, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x40, 0x3F, 0xFD, 0x02,
-    0xFF, 0xE0, 0x3A, 0xBF, 0x41, 0xE6, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00,
-    0x1E, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x01, 0xBE,
-    0x07, 0xFF, 0x80, 0x2F, 0xFC, 0x0F, 0xFD, 0x00, 0x7F, 0xE0, 0x0F, 0x90, 0x00, 0x7D, 0x00, 0x0B,
-    0x00, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x1E, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00,
-    0x3F, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x07, 0xF8, 0x00, 0x0F, 0xC3,
-    0xFF, 0xD0, 0x03, 0xE0, 0xEA, 0xFD, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0xF0, 0x0F,
-    0x40, 0x00, 0x1D, 0x03, 0xD0, 0x00, 0x0B, 0x40, 0xF4, 0x00, 0x1F, 0xC0, 0x3D, 0x01, 0xFF, 0xE0,
-    0x0F, 0x40, 0xFF, 0xD0, 0x03, 0xD0, 0x3E, 0x40, 0x00, 0xB4, 0x0B, 0x00, 0x00, 0x2D, 0x01, 0xC0,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x1E, 0x02,
-    0xF8, 0x00, 0x0F, 0xD0, 0x7D, 0x00, 0x03, 0xF0, 0x05, 0x00, 0x00, 0x10, 0x28, 0x00, 0x00, 0x00,
-    0xBC, 0x02, 0xFE, 0x00, 0xFC, 0x03, 0xFF, 0xC0, 0xF8, 0x03, 0xAB, 0xF0, 0xF8, 0x00, 0x00, 0xB8,
-    0xF8, 0x00, 0x00, 0x3C, 0xF4, 0x00, 0x00, 0x2C, 0xF4, 0x00, 0x00, 0x3C, 0xF4, 0x00, 0x01, 0xFC,
-    0xF4, 0x00, 0xBF, 0xF4, 0xB4, 0x00, 0xFF, 0xD0, 0xB4, 0x00, 0xF8, 0x00, 0x74, 0x00, 0xF0, 0x00,
-    0x74, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x38, 0x00,
-    0xFD, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x01, 0x81, 0xFB, 0xFD, 0x6F, 0x0E, 0x01, 0xBF, 0xF0, 0x10, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x42, 0xD0, 0xF0, 0x3C, 0x0F, 0x83, 0xD1, 0xF4, 0x7C, 0x1F, 0x0B,
-    0xC2, 0xF0, 0xFC, 0x3E, 0x0F, 0x83, 0xD1, 0xF4, 0x7C, 0x1F, 0x0B, 0xC2, 0xE0, 0xB4, 0x3D, 0x0F,
-    0x03, 0xC0, 0xE0, 0x38, 0x0D, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x1F,
-    0xFF, 0x00, 0xF8, 0x7E, 0x0B, 0x80, 0x7C, 0x3D, 0x00, 0xF0, 0xF0, 0x03, 0xD3, 0xC0, 0x0F, 0x4F,
-    0x00, 0x3C, 0x3D, 0x01, 0xF0, 0xBC, 0x0F, 0x80, 0xFE, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xD0, 0x01, 0xEB, 0x40, 0x0F, 0x2D,
-    0x00, 0xF0, 0xB4, 0x0B, 0x96, 0xD4, 0x3F, 0xFF, 0xF0, 0x15, 0x7E, 0x40, 0x00, 0xB4, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0x54, 0x03, 0xFF, 0xC0, 0xF5, 0x50, 0x38, 0x00, 0x0F, 0x90, 0x07,
-    0xFF, 0x00, 0x07, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x0B, 0x82, 0xBF, 0xC0, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x3F, 0xD0, 0x7E, 0x00, 0x3D, 0x00, 0x3F, 0x50, 0x0F, 0xFF, 0x87,
-    0xC1, 0xF5, 0xE0, 0x1F, 0x7C, 0x07, 0xCF, 0x42, 0xE2, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x15, 0x54, 0xBF, 0xFF, 0xF5, 0x6F, 0xE0, 0x3C, 0x00, 0xB4, 0x01, 0xF0, 0x03, 0xC0, 0x07, 0xC0,
-    0x0B, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x94, 0x03, 0xFF, 0x82, 0xD0,
-    0xF0, 0xF0, 0x2D, 0x2E, 0x1F, 0x02, 0xFF, 0x00, 0xFF, 0xD0, 0xF4, 0x7D, 0x78, 0x07, 0x9E, 0x02,
-    0xE3, 0xE6, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x90, 0x03, 0xFF, 0x43, 0xD1, 0xF1, 0xF0,
-    0x2E, 0x7C, 0x07, 0xCF, 0x41, 0xE1, 0xFF, 0xF8, 0x1F, 0xFD, 0x00, 0x1F, 0x00, 0x1F, 0x41, 0xBF,
-    0x40, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x03, 0xFB, 0xFC, 0x06, 0xF4, 0xB8, 0x07, 0x80,
-    0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x0B, 0x81, 0xF4, 0xBF, 0x4F, 0xF0, 0x01,
-    0xFE, 0x00, 0x2F, 0xFF, 0x41, 0xF0, 0x2F, 0x0B, 0x40, 0x3C, 0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xD3,
-    0xC0, 0x0F, 0x0F, 0x00, 0x3C, 0x3D, 0x01, 0xF0, 0x7D, 0x1F, 0x40, 0xBF, 0xF4, 0x00, 0x69, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0xBF, 0xC0, 0x6B, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0xC0, 0x07, 0xD0, 0x7F, 0xFC, 0x15, 0x50, 0x06, 0xF8, 0x0B, 0xEF, 0xC3, 0xC0,
-    0xF4, 0xE0, 0x3D, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x40, 0x0F, 0xEA,
-    0xA3, 0xFF, 0xFC, 0x15, 0x50, 0x0B, 0xF8, 0x0F, 0xEF, 0x83, 0x40, 0xF0, 0x00, 0x78, 0x00, 0xBC,
-    0x02, 0xFF, 0x00, 0x56, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x1F, 0x83, 0xFF, 0x80, 0x69, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0xBD, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xD0, 0x03, 0xDB, 0x40, 0x2D, 0x2D,
-    0x01, 0xE0, 0xB4, 0x0F, 0xAB, 0xF8, 0x2F, 0xFF, 0xF0, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0x01,
-    0x80, 0x0A, 0xAA, 0x03, 0xFF, 0xC0, 0xF0, 0x00, 0x38, 0x00, 0x0F, 0xF4, 0x02, 0xBF, 0x40, 0x01,
-    0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x2F, 0x47, 0xFF, 0x40, 0x69, 0x00, 0x00, 0x6F, 0x40, 0xBE,
-    0x40, 0xBC, 0x00, 0xBC, 0x00, 0x3F, 0xF8, 0x1F, 0xFF, 0xC7, 0x80, 0xF9, 0xE0, 0x1F, 0x7C, 0x07,
-    0xCF, 0x83, 0xD1, 0xFF, 0xE0, 0x06, 0x90, 0x6A, 0xAA, 0xFF, 0xFF, 0xE0, 0x2D, 0x90, 0x7C, 0x00,
-    0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x09, 0x00, 0x07,
-    0xF8, 0x07, 0xEB, 0xC3, 0xC0, 0xB4, 0xF0, 0x3C, 0x1F, 0x6E, 0x02, 0xFF, 0x01, 0xF7, 0xF0, 0xF0,
-    0x3E, 0x78, 0x07, 0x9F, 0x03, 0xD2, 0xFF, 0xE0, 0x1A, 0x40, 0x07, 0xF8, 0x0B, 0xEF, 0xC3, 0xC0,
-    0xF5, 0xF0, 0x1E, 0x7C, 0x07, 0xCF, 0x92, 0xE0, 0xFF, 0xF8, 0x06, 0xBC, 0x00, 0x2E, 0x00, 0x7F,
-    0x02, 0xFE, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xF8, 0x0F,
-    0x40, 0x0E, 0x03, 0xD0, 0x03, 0x80, 0xF4, 0x00, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x6B, 0xFA, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x1B, 0xFA, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0xAF, 0xC0, 0x03, 0xD0, 0x3D, 0x00, 0x7C,
-    0x02, 0xD0, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x01,
-    0xAF, 0x55, 0x40, 0x01, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x17, 0xE5, 0x50, 0x00, 0x3C, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xEF, 0xFF, 0xF8, 0x24,
-    0x00, 0x15, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x5B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0xC0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x3D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x3D, 0x00, 0x05,
-    0x50, 0x03, 0xE0, 0x1F, 0x8F, 0xFF, 0xF0, 0xFF, 0xF0, 0x0F, 0xEF, 0xF8, 0x17, 0xD5, 0x0B, 0x42,
-    0xC0, 0x3F, 0xFE, 0x40, 0x0F, 0x00, 0x3C, 0x05, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0xBD, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x7F, 0xC0,
-    0x3E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0xE0, 0x3C, 0x1B,
-    0xFA, 0x00, 0x00, 0xFD, 0x63, 0xC2, 0xF0, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x8F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0xFF, 0xAF, 0xC0, 0x0F, 0xC0, 0x1E, 0x00, 0xBC, 0x00, 0x34, 0x07, 0xD0, 0x00, 0x40, 0x2F, 0x00,
-    0x00, 0x0A, 0xFE, 0xAA, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x1A, 0xFE, 0xA8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x3F, 0x80, 0x01, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3D, 0x55,
-    0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xE3, 0xD0, 0x00, 0x05, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0xF0, 0x03, 0xDD, 0xF0, 0x3C, 0x70, 0xF0, 0x81, 0xD1, 0x80, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00,
-    0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00,
-    0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x6A, 0xA9, 0x55, 0xF2, 0xFF, 0xFF, 0xFF, 0xE1, 0x40,
-    0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00,
-    0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40,
-    0x0D, 0x1D, 0x2C, 0x2D, 0x71, 0xE0, 0x2E, 0xEE, 0x00, 0x2F, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x74, 0x00, 0x78, 0x00, 0xB4, 0x07, 0x80, 0x00, 0xB4,
-    0x7D, 0x55, 0x55, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xC0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0xF0, 0x03,
-    0xC0, 0x0F, 0x00, 0x07, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0xF0,
-    0x00, 0x7F, 0xF4, 0x07, 0xDD, 0xF4, 0x3C, 0x74, 0xF0, 0x41, 0xD0, 0x40, 0x07, 0x40, 0x00, 0x1D,
-    0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x09, 0x1D, 0x18, 0x3C, 0x74, 0xF0, 0x3D,
-    0xDF, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0xF0, 0x03, 0xDD, 0xF0, 0x3C, 0x74, 0xF0, 0x41, 0xD0, 0x40, 0x07, 0x40, 0x00, 0x1D, 0x00,
-    0x00, 0x74, 0x00, 0x41, 0xD0, 0x43, 0xC7, 0x4F, 0x03, 0xDD, 0xF0, 0x03, 0xFF, 0x00, 0x03, 0xF0,
-    0x01, 0x5B, 0x95, 0x2F, 0xFF, 0xFE, 0x15, 0x55, 0x50, 0x00, 0x00, 0x50, 0x00, 0x02, 0xD0, 0x00,
-    0x0B, 0x40, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xC0, 0x00, 0x0B, 0x00, 0x3C, 0x2C, 0x03,
-    0xC0, 0xB0, 0x3C, 0x02, 0xC3, 0xE5, 0x5B, 0x1F, 0xFF, 0xFC, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00,
-    0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x0F, 0x00, 0x38, 0x0F,
-    0x00, 0xE0, 0x0F, 0x03, 0x95, 0x6F, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xE0, 0x00, 0x1E, 0x00, 0x02,
-    0xE0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x04, 0x00,
-    0x3C, 0x0F, 0x00, 0x0F, 0x0F, 0x40, 0x03, 0xCF, 0x40, 0x00, 0xFB, 0xEA, 0xAA, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x15, 0x03, 0xFF, 0xFF, 0xFE, 0x3E, 0xAA, 0xAA,
-    0xA6, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFE, 0x03, 0xC0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0xF0, 0x00, 0x3C, 0xF0,
-    0x07, 0xE2, 0xF4, 0x7B, 0x8B, 0xB5, 0xCE, 0x2C, 0xD0, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B,
-    0x00, 0x0E, 0x2C, 0x00, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x00, 0x0E, 0x2C, 0x00, 0x14,
-    0x50, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x50, 0x00, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x6A, 0xAA, 0xAA, 0xF0, 0x00, 0x00, 0x01, 0xE7, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x8B, 0x00, 0x0E,
-    0x2C, 0x00, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x00, 0x0E, 0x2C, 0x00, 0x38, 0xB0, 0x00,
-    0xE2, 0xC0, 0x03, 0x8B, 0x02, 0xCE, 0x2C, 0xE3, 0xF8, 0xBF, 0x03, 0xE2, 0xF0, 0x03, 0xDF, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x18, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0xB4, 0x00,
-    0xB8, 0x0B, 0xFF, 0xFF, 0xF8, 0x7A, 0xAA, 0xAA, 0xB7, 0xC0, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xF4, 0x07, 0x80, 0x0B, 0x40, 0x07, 0x80, 0xB4, 0x00, 0x04, 0x00, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x05, 0x1F, 0x80, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x02, 0xF0, 0xBD, 0x00, 0x00,
-    0xF4, 0x0F, 0x80, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0xB8, 0x00, 0x01,
-    0xF0, 0x3C, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x0B, 0xCB, 0x40, 0x00, 0x00, 0xF7, 0xC0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x2E, 0x5F, 0xD0, 0x04, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x6E, 0x7E, 0x00, 0xBF, 0xFF, 0x80, 0xF8,
-    0x07, 0xE0, 0xB8, 0x00, 0xF8, 0x3C, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0x0F, 0x40, 0x07, 0xC3, 0xD0,
-    0x02, 0xE0, 0xF4, 0x00, 0xF0, 0x3D, 0x00, 0xB8, 0x0F, 0xC0, 0x7C, 0x01, 0xFE, 0xFC, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x53, 0xFF, 0xFF, 0xFB, 0xAA, 0xAF, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x7A, 0xAA, 0xFD, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4,
-    0x01, 0xC0, 0x02, 0xFF, 0xFF, 0x4F, 0x00, 0x3F, 0xE5, 0xBF, 0xF0, 0x03, 0xF4, 0x00, 0x2F, 0x80,
-    0x2F, 0x00, 0x00, 0xFF, 0x00, 0xF4, 0x00, 0x0F, 0x7D, 0x0B, 0xC0, 0x00, 0xF4, 0xB8, 0x3E, 0x00,
-    0x0F, 0x41, 0xF0, 0xF4, 0x00, 0xF4, 0x07, 0xC3, 0xD0, 0x0F, 0x80, 0x1F, 0x0F, 0x40, 0xB8, 0x00,
-    0x7C, 0x3E, 0x0B, 0x80, 0x02, 0xF0, 0xBC, 0xB8, 0x00, 0x0F, 0x81, 0xFB, 0x80, 0x00, 0x7C, 0x03,
-    0xFC, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x7F, 0xFE, 0xBF, 0xE0, 0x07, 0xC2, 0xFF,
-    0xFD, 0x00, 0x08, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00,
-    0x3C, 0x2F, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0xB4, 0x0F, 0x80, 0x00, 0xF0, 0x0B, 0xC0, 0x02,
-    0xE0, 0x07, 0xD0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x02, 0xF0, 0x0F, 0x40, 0x01, 0xF4, 0x0F,
-    0x00, 0x00, 0xF8, 0x2E, 0x00, 0x00, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFE, 0x05,
-    0x55, 0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0x55, 0x6B, 0xF0, 0xBD, 0x00, 0x00, 0xF4,
-    0x0F, 0x80, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x2E, 0x00, 0x7D, 0x00, 0x0F, 0x00, 0x0F, 0xC0, 0x07,
-    0xC0, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0xB8, 0x00, 0x01, 0xF4,
-    0x3C, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x0B, 0xCB, 0x40, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x1F, 0xFA, 0xAA, 0xA0, 0x1F, 0xC0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x3E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xC3, 0xD0, 0x55, 0x55, 0x50, 0xF4,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x05, 0x7D, 0x40, 0x01, 0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0xAF, 0xA8, 0x07, 0xF0,
-    0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x3C,
-    0x00, 0x1E, 0x00, 0x0F, 0xAA, 0xAF, 0xEA, 0x87, 0xFF, 0xFF, 0xFF, 0xF0, 0xF4, 0x16, 0xE5, 0x54,
-    0x3D, 0x00, 0xB4, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0x3F, 0x0B, 0x40,
-    0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xEA, 0xAA, 0xA0, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x03, 0xEA, 0xAA, 0xAF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF8, 0x3D, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x02,
-    0xAA, 0xAB, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x2A, 0xAA, 0xAA, 0xAF, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD1, 0x55, 0x55, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x05, 0xF5, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x00, 0xAB, 0xEA, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xF4, 0x00, 0x2D, 0x00, 0x2F, 0x00, 0x07, 0xC0,
-    0x03, 0xE0, 0x00, 0xF0, 0x00, 0xBC, 0x00, 0x2D, 0x00, 0x0F, 0x0A, 0xAF, 0xEA, 0xAB, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x55, 0x6E, 0x50, 0x7C, 0x00, 0x07, 0x80, 0x1F, 0x00, 0x00, 0xF0, 0x0B, 0xC0,
-    0x00, 0x2D, 0x03, 0xD0, 0x00, 0x07, 0x83, 0xF0, 0x00, 0x00, 0xFB, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFE, 0xAA, 0xAA, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x1B, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x55, 0x55,
-    0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA, 0xAB, 0xF4, 0x02, 0xF0, 0x00, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x6F, 0xF8, 0x01,
-    0xBF, 0xE3, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x05, 0x55, 0x55, 0x50, 0xBF, 0xFF, 0xFF, 0xD2, 0xFE,
-    0xAA, 0xAF, 0x43, 0xF4, 0x00, 0x2E, 0x07, 0xF0, 0x00, 0x38, 0x0B, 0xE0, 0x00, 0x80, 0x0B, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x14, 0x1F, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x07, 0xCF, 0xD5,
-    0x55, 0xBE, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF4,
-    0x00, 0x01, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xD0,
-    0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03,
-    0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x24, 0x38, 0x24, 0x7E, 0x39, 0xFC, 0x0B, 0xFF,
-    0xD0, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x3F, 0x39, 0xF8, 0x34, 0x38, 0x28, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0xFF, 0x42, 0xE5, 0xF4, 0xF0, 0x1E, 0x78,
-    0x03, 0xCE, 0x00, 0xE3, 0xD0, 0xB4, 0x7F, 0xF8, 0x01, 0xA0, 0x00, 0x14, 0xFD, 0xFD, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0xAA, 0x80, 0x0B, 0x40, 0xFF, 0xC0, 0x0F, 0x00, 0x57,
-    0xD0, 0x1F, 0x00, 0x03, 0xE0, 0x2D, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00,
-    0xF8, 0xB8, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x02, 0xD1, 0xFF, 0xE2, 0xE0, 0xF0, 0x2E, 0xD0, 0x38, 0x03, 0xE0, 0x0E,
-    0x00, 0xB8, 0x03, 0xC0, 0x7B, 0x40, 0xBE, 0xF8, 0xF8, 0x0B, 0xF4, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x0B, 0xE0, 0x2F, 0xFC, 0x3F, 0xF8, 0x38, 0x0F, 0xF0, 0x3C, 0x74, 0x07, 0xC0, 0x2C,
-    0x74, 0x07, 0xC0, 0x2C, 0x78, 0x0E, 0xF0, 0x3C, 0x3E, 0xBC, 0x7E, 0xF4, 0x0F, 0xE0, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x3D, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xBD, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x53, 0xDF, 0x7D,
-    0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF6,
-    0x80, 0x14, 0x04, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C,
-    0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C,
-    0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C,
-    0x2E, 0x3C, 0x2E, 0x28, 0x19, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x07, 0xCB, 0x80, 0x00, 0x02,
-    0xD1, 0xF0, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x78, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x3D, 0x00, 0x0B, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x2E,
-    0x00, 0xF8, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x2F, 0x0F, 0x40, 0x00,
-    0x03, 0xC0, 0x14, 0x00, 0x00, 0x05, 0x0F, 0x80, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x02, 0xE0, 0x3D,
-    0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0F, 0x00,
-    0x07, 0x80, 0x0B, 0x80, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x2D, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0xB8,
-    0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x2E, 0x1F, 0x00, 0x00, 0x03, 0xCF, 0x40, 0x00, 0x00, 0xF7,
-    0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x6A, 0xA4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x56, 0xFC, 0x0B, 0xC0, 0x00, 0xF8, 0x3D, 0x00,
-    0x01, 0xF1, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00,
-    0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5,
-    0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0,
-    0x00, 0x03, 0xD0, 0x14, 0x00, 0x00, 0x51, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00,
-    0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D,
-    0x7C, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2F, 0x0B, 0xD0, 0x01, 0xF8, 0x0B,
-    0xFA, 0xBF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xF4, 0x24, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x10, 0x2E, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x7F,
-    0xF4, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x01, 0xFC, 0x10, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x01, 0xFC, 0xBC, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7C, 0xFE,
-    0xFD, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xBE, 0xFE, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0xFC, 0xFE, 0x00, 0x01, 0xFC, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x01, 0xFC, 0xFD,
-    0x00, 0x01, 0xFC, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01, 0x81, 0xFB,
-    0xFD, 0x6F, 0x0E, 0x01, 0xBF, 0xF0, 0x10, 0x00, 0x15, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F, 0xF8,
-    0x02, 0xC3, 0xE5, 0xFF, 0xBD, 0x0D, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x06, 0x40, 0x04, 0x3F, 0xF4,
-    0x2D, 0xB9, 0xBF, 0xFC, 0xB0, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1D, 0xBF, 0xFE, 0x7D,
-    0xF0, 0x2F, 0xF8, 0x10, 0x02, 0x90, 0x24, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xC0, 0x6B, 0xFF,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x03, 0xFF, 0xFF, 0xFF,
-    0x09, 0x00, 0x00, 0x18, 0x00, 0x00, 0x40, 0x00, 0x07, 0x42, 0xAA, 0xBE, 0x9F, 0xFF, 0xFF, 0x00,
-    0x2D, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x00, 0x1F, 0xFF, 0xFF, 0x2B, 0xEA, 0xA8, 0x2C, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x02, 0xF8, 0x00, 0x2F, 0xE0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00,
-    0x2F, 0xD0, 0x06, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x02, 0x80, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0xBF,
-    0x40, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xE0,
-    0x00, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x07,
-    0xF0, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x01, 0x80, 0x00, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xF8,
-    0x00, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xC0, 0x03,
-    0xF4, 0x00, 0x2F, 0xD0, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0xBF, 0x40,
-    0x03, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x01, 0x57, 0xD5, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xEA, 0xFA, 0xA0, 0x3F,
-    0x00, 0x3C, 0x00, 0x2F, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x01,
-    0xF0, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x02, 0xF0, 0x1E, 0x00,
-    0x00, 0x3F, 0x4F, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x1B, 0xFF, 0xFF, 0xD0, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x15, 0x55, 0xB8, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xBF, 0xFF,
-    0x40, 0x00, 0x07, 0x83, 0xF0, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x78,
-    0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x0B, 0xC0, 0x02,
-    0xD0, 0x03, 0xE0, 0x00, 0xF0, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x90, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xEA,
-    0xAA, 0xA0, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x1B, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x47, 0x47, 0xD0, 0x01, 0xE0, 0x1D,
-    0x02, 0xD0, 0x0E, 0x00, 0x74, 0x02, 0xC0, 0xB0, 0x01, 0xD0, 0x03, 0x83, 0x80, 0x07, 0x40, 0x0B,
-    0x1C, 0x00, 0x1D, 0x00, 0x1D, 0x75, 0x55, 0xB9, 0x55, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x40,
-    0x07, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x00, 0x1D, 0x38, 0x00, 0x74, 0x00, 0xB0, 0xB0, 0x01, 0xD0,
-    0x03, 0x80, 0xE0, 0x07, 0x40, 0x3C, 0x01, 0xE0, 0x1D, 0x03, 0xD0, 0x01, 0xF8, 0x74, 0xBD, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x0E, 0x00, 0x00,
-    0x02, 0xC0, 0xB0, 0x00, 0x00, 0x03, 0x83, 0x80, 0x00, 0x00, 0x0B, 0x1C, 0x00, 0x00, 0x00, 0x1D,
-    0x75, 0x55, 0x55, 0x55, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x40, 0x00, 0x00, 0x07, 0x5D, 0x00,
-    0x00, 0x00, 0x1D, 0x38, 0x00, 0x00, 0x00, 0xB0, 0xB0, 0x00, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x00,
-    0x3C, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0x40, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xB2, 0xE0, 0x02,
-    0xD3, 0x83, 0x82, 0xE0, 0x2D, 0x0B, 0x1C, 0x02, 0xE2, 0xD0, 0x1D, 0x70, 0x02, 0xFD, 0x00, 0x36,
-    0xC0, 0x03, 0xF0, 0x00, 0xE7, 0x00, 0x2E, 0xE0, 0x03, 0x5D, 0x02, 0xD2, 0xE0, 0x1D, 0x38, 0x2D,
-    0x02, 0xE0, 0xB0, 0xB2, 0xD0, 0x02, 0xE3, 0x80, 0xFD, 0x00, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0x03,
-    0xD0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xE0,
-    0x00, 0x03, 0xD0, 0x0E, 0x00, 0x00, 0x2F, 0xC0, 0xB0, 0x00, 0x02, 0xD3, 0x83, 0x80, 0x00, 0x2D,
-    0x0B, 0x1D, 0x00, 0x02, 0xD0, 0x1D, 0x70, 0x00, 0x2D, 0x00, 0x36, 0xC0, 0x02, 0xD0, 0x00, 0xE7,
-    0x00, 0x2D, 0x00, 0x03, 0x5D, 0x02, 0xD0, 0x00, 0x1D, 0x38, 0x2D, 0x00, 0x00, 0xB0, 0xB2, 0xD0,
-    0x00, 0x03, 0x80, 0xFD, 0x00, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0xBD,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x05, 0x56, 0xE5, 0x54, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xE0, 0x10,
-    0xBD, 0xFE, 0xBC, 0x04, 0x00, 0x04, 0x00, 0x05, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B, 0xDB, 0xF0, 0x03,
-    0xF0, 0x03, 0xF8, 0xF4, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7D,
-    0x04, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x2F, 0x80,
-    0x00, 0x7F, 0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0x80, 0x7F, 0xFF, 0xFF,
-    0x80, 0xBF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00,
-    0x2F, 0xFF, 0x42, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE2, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0xBF,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0xFE, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_12_regularBitmaps[26104] = {
+    0x75, 0x55, 0x3F, 0x6C, 0xD4, 0x56, 0x1C, 0xFE, 0xEC, 0x47, 0xB0, 0xDA, 0x27, 0xFA, 0x32, 0x40,
+    0x55, 0x95, 0x10, 0x2F, 0x1D, 0x52, 0x94, 0xC4, 0x1D, 0x18, 0x32, 0x9C, 0x73, 0x16, 0x0B, 0x43,
+    0x87, 0x66, 0x48, 0xA8, 0xD4, 0x0E, 0x74, 0xAC, 0x2A, 0x55, 0x30, 0x64, 0x88, 0xAA, 0x3B, 0xCE,
+    0xC0, 0xD8, 0x01, 0x06, 0xDA, 0xA5, 0x5B, 0xA5, 0x4A, 0xE5, 0x50, 0xD5, 0x0C, 0x51, 0x75, 0x95,
+    0x0C, 0xF7, 0x80, 0x21, 0x03, 0xCB, 0x8B, 0x28, 0x13, 0x03, 0xA6, 0x0C, 0x95, 0x88, 0xAA, 0xBA,
+    0x95, 0x91, 0x9C, 0xE0, 0xBB, 0xD7, 0xEF, 0x39, 0x09, 0x20, 0x55, 0xF5, 0x3D, 0xDB, 0xF7, 0xFE,
+    0xFC, 0xFE, 0x7D, 0xBF, 0xEF, 0xF7, 0xF3, 0x4C, 0x56, 0x57, 0x55, 0x55, 0xF2, 0xDA, 0xD8, 0x58,
+    0x5D, 0x05, 0xD6, 0x46, 0xF5, 0xE4, 0xCC, 0xFC, 0x93, 0x17, 0x67, 0xFE, 0x9C, 0xDE, 0xF8, 0x6A,
+    0x6B, 0x5B, 0x5C, 0x3F, 0x84, 0xB7, 0x7C, 0x8D, 0x23, 0x22, 0xC5, 0x09, 0x91, 0x60, 0x56, 0x42,
+    0x59, 0x5B, 0x4F, 0xFC, 0x7A, 0x6E, 0x19, 0xAB, 0x47, 0x80, 0xF5, 0x29, 0xA0, 0x98, 0xC5, 0xB1,
+    0xE7, 0xDD, 0xA5, 0x9E, 0xB5, 0xB9, 0xAF, 0x57, 0x21, 0xF4, 0x3A, 0x44, 0x5A, 0x20, 0x48, 0x72,
+    0xE0, 0x0D, 0xE0, 0x04, 0xC0, 0x43, 0x73, 0xF0, 0x6D, 0xA9, 0x7E, 0xAA, 0xE7, 0xA7, 0xE2, 0x78,
+    0x6A, 0x36, 0x9E, 0x42, 0x34, 0x05, 0x55, 0x43, 0xD8, 0x04, 0xBD, 0x02, 0xEF, 0xD7, 0x93, 0x0B,
+    0xF1, 0xEA, 0x42, 0x3C, 0x58, 0x68, 0xDD, 0x5A, 0xC8, 0xDA, 0xB6, 0x90, 0x36, 0xC5, 0x29, 0xEC,
+    0x0F, 0xBA, 0xF5, 0x19, 0xF6, 0xAE, 0x09, 0x60, 0x06, 0xC1, 0x88, 0x46, 0xBC, 0xE7, 0x25, 0xD6,
+    0xD1, 0x0A, 0xF4, 0x34, 0x02, 0xDD, 0x12, 0x1A, 0x6B, 0x82, 0xC6, 0x83, 0xB4, 0xA5, 0x18, 0x84,
+    0xB8, 0xAB, 0x27, 0x85, 0x1E, 0x2C, 0x44, 0x45, 0x74, 0x4E, 0xAA, 0xEF, 0xB4, 0xBD, 0xB3, 0x95,
+    0xC7, 0x48, 0x5A, 0x73, 0x5E, 0x0E, 0x29, 0xCC, 0x34, 0x90, 0xB7, 0xF8, 0x77, 0x56, 0x98, 0x79,
+    0x8A, 0xCC, 0x53, 0xBA, 0xC0, 0xCE, 0x80, 0x4E, 0x06, 0x63, 0x30, 0xDA, 0x09, 0xBC, 0x7E, 0xF5,
+    0x0C, 0x20, 0xB7, 0xF9, 0xE8, 0xC8, 0x14, 0x7E, 0x4E, 0x61, 0x95, 0x6C, 0x00, 0x8B, 0x94, 0x42,
+    0xD6, 0x02, 0xBC, 0x22, 0x01, 0xC2, 0x3C, 0x1C, 0x7B, 0x2F, 0x4C, 0xAF, 0x54, 0x1F, 0xEA, 0x39,
+    0x74, 0x94, 0x5E, 0xF5, 0x0B, 0x75, 0xD7, 0x48, 0xAD, 0x1E, 0x21, 0x74, 0x91, 0xB6, 0xA1, 0x2A,
+    0xF4, 0xBE, 0xB5, 0xE3, 0xA4, 0x67, 0xB7, 0x6C, 0x32, 0xB1, 0x84, 0xC9, 0x93, 0xDB, 0x5F, 0xFE,
+    0xF2, 0xE8, 0x28, 0xDE, 0x41, 0x07, 0x85, 0x30, 0x32, 0x55, 0x98, 0x47, 0x8C, 0x16, 0xA7, 0x03,
+    0x54, 0xCD, 0x6F, 0x80, 0x8C, 0xB3, 0x45, 0x44, 0x50, 0x69, 0xA0, 0x45, 0x81, 0x9A, 0xDB, 0x78,
+    0x8F, 0x2B, 0x9C, 0x1B, 0xBF, 0x40, 0xC9, 0x03, 0x71, 0x73, 0x20, 0xA2, 0x19, 0xF7, 0x3B, 0x50,
+    0x51, 0x7A, 0x8D, 0xCE, 0x79, 0x2C, 0xEC, 0x45, 0x31, 0x2D, 0xEE, 0x27, 0xBB, 0x3A, 0xB0, 0xA7,
+    0x77, 0x9F, 0x6E, 0xE3, 0x7B, 0x03, 0x46, 0xC0, 0x9D, 0x82, 0x48, 0x42, 0xE1, 0x58, 0x77, 0xC5,
+    0xDA, 0xBF, 0x3F, 0x7E, 0x98, 0x10, 0xBC, 0x56, 0xB3, 0x9A, 0x52, 0xA4, 0x13, 0x98, 0xAE, 0xD4,
+    0x55, 0x28, 0xF4, 0x24, 0x56, 0x96, 0xED, 0xA8, 0xFF, 0xE3, 0x7C, 0x78, 0xAF, 0x98, 0x6C, 0x8E,
+    0xAC, 0x81, 0xB6, 0xBD, 0x02, 0xBE, 0x71, 0x1A, 0x08, 0x0C, 0x25, 0xA7, 0x9B, 0x9D, 0x8E, 0xDB,
+    0xC1, 0x7F, 0x76, 0xE2, 0x97, 0x09, 0x54, 0x36, 0x09, 0x76, 0xC7, 0xA8, 0x44, 0x49, 0x4C, 0xAE,
+    0x18, 0x64, 0x1D, 0x04, 0xF7, 0x35, 0xBA, 0x35, 0x82, 0xC7, 0xAF, 0x5E, 0x19, 0xE4, 0xA6, 0x41,
+    0xBD, 0x88, 0xF0, 0x74, 0x29, 0x0A, 0xB5, 0x5B, 0x23, 0x1A, 0x03, 0xC7, 0x1A, 0x25, 0x32, 0x3D,
+    0x5F, 0x91, 0x21, 0x5E, 0x45, 0x18, 0xF0, 0x7F, 0x8F, 0xE3, 0x76, 0xD3, 0x8E, 0x9C, 0xBD, 0x61,
+    0x8D, 0xF1, 0x50, 0x67, 0x7E, 0x15, 0xA3, 0xAD, 0xA0, 0x74, 0x22, 0x72, 0x78, 0x74, 0xB1, 0x66,
+    0xFA, 0x80, 0x5B, 0xAF, 0x0D, 0x37, 0x5D, 0x59, 0x6E, 0x5B, 0xFB, 0xB5, 0xB5, 0x06, 0x47, 0x11,
+    0x59, 0xB1, 0x6B, 0x23, 0x64, 0x17, 0x78, 0x3C, 0xD0, 0x4C, 0x61, 0x50, 0x78, 0x36, 0x09, 0x6D,
+    0x3A, 0xD9, 0x4E, 0x38, 0xA3, 0x06, 0xAA, 0x8A, 0x12, 0x51, 0x7D, 0x62, 0x2F, 0xDB, 0x12, 0xCB,
+    0xFB, 0x84, 0xF1, 0xA9, 0x3C, 0x24, 0x5F, 0xC8, 0x6D, 0x35, 0xA2, 0xD6, 0x12, 0xE2, 0x81, 0xC1,
+    0xA2, 0x4A, 0xFC, 0x22, 0x66, 0x86, 0x4A, 0x94, 0x4D, 0xB6, 0x13, 0x1A, 0x2A, 0x7B, 0xCE, 0x92,
+    0x30, 0x8E, 0x53, 0x7B, 0x18, 0x51, 0xD6, 0x4B, 0x9C, 0x16, 0x61, 0xAD, 0x1B, 0x0D, 0x8A, 0x6E,
+    0xFC, 0x86, 0xC0, 0xA6, 0x01, 0xCD, 0x04, 0x74, 0xFC, 0x36, 0xF9, 0x77, 0x30, 0x08, 0x58, 0xF5,
+    0xF6, 0x30, 0x27, 0x3C, 0x13, 0x4E, 0xF0, 0x10, 0xBC, 0xA1, 0xF1, 0xC7, 0x4B, 0xA2, 0x82, 0x28,
+    0x9B, 0x40, 0x2B, 0xE0, 0x62, 0x9F, 0xC1, 0x54, 0xCA, 0xF4, 0xAE, 0xE4, 0xA2, 0xA8, 0xD0, 0x25,
+    0x81, 0xAE, 0x6A, 0xF1, 0x7B, 0xE9, 0x31, 0x07, 0xB5, 0xDC, 0x1D, 0xA1, 0x47, 0xA5, 0x4B, 0xCE,
+    0x2C, 0xCB, 0x7B, 0x93, 0x5C, 0x28, 0xBC, 0x6A, 0x15, 0xD9, 0x94, 0x73, 0x89, 0x26, 0x42, 0x38,
+    0x54, 0x09, 0x81, 0x83, 0xAE, 0x68, 0x34, 0x76, 0x41, 0xCA, 0x11, 0x4D, 0xB7, 0xE4, 0x9C, 0x3E,
+    0xB4, 0x97, 0xDC, 0x68, 0x84, 0xF6, 0xCF, 0x66, 0x11, 0xB5, 0x4A, 0x42, 0x61, 0x02, 0x5D, 0x8B,
+    0x3C, 0x7C, 0x90, 0x7B, 0x0C, 0xB2, 0x5D, 0xA3, 0x1B, 0x99, 0x2E, 0xEA, 0x36, 0xC2, 0xAB, 0xA9,
+    0x78, 0x9A, 0xA3, 0xBC, 0x85, 0x4C, 0xD1, 0x36, 0xD3, 0xE4, 0x2D, 0x35, 0x1A, 0x86, 0x15, 0x6C,
+    0x93, 0xAA, 0x45, 0xA6, 0x2A, 0x21, 0x01, 0xBC, 0xB2, 0x42, 0x4C, 0x81, 0x33, 0xA5, 0xD4, 0x3D,
+    0x5B, 0x78, 0xFD, 0x3D, 0xCB, 0xED, 0x66, 0xF4, 0x92, 0xC3, 0xB6, 0x41, 0xD8, 0x09, 0xAB, 0xCD,
+    0x62, 0x70, 0x80, 0xFF, 0x93, 0xBA, 0xED, 0x11, 0xC5, 0x91, 0x32, 0x83, 0x97, 0x55, 0x1C, 0xE8,
+    0x6E, 0x60, 0x32, 0x75, 0xA9, 0x68, 0x79, 0x7B, 0x0B, 0x6C, 0x16, 0x2C, 0x48, 0xC3, 0x66, 0xD2,
+    0x4E, 0x71, 0xD1, 0x55, 0x30, 0x3C, 0x32, 0x2C, 0xCA, 0xE1, 0xD7, 0xAE, 0xC6, 0x80, 0x93, 0xFD,
+    0x1B, 0xD6, 0x16, 0xFB, 0xF2, 0x9E, 0xB5, 0xFF, 0xF4, 0xFB, 0xAE, 0x2C, 0x4E, 0x39, 0xCB, 0x08,
+    0x89, 0x2D, 0x13, 0xEC, 0xA4, 0xEA, 0x46, 0x53, 0x2A, 0x2B, 0xA7, 0x69, 0xE6, 0xE0, 0xFC, 0x18,
+    0xED, 0x91, 0xB8, 0x59, 0x42, 0x6A, 0x56, 0x85, 0x67, 0xD8, 0x5C, 0x42, 0xDD, 0xAB, 0xE8, 0xEE,
+    0x0E, 0x24, 0x70, 0x61, 0xDF, 0x55, 0xCD, 0x54, 0x06, 0x8E, 0x6B, 0xFB, 0x97, 0xB4, 0x84, 0x33,
+    0x74, 0x66, 0x65, 0x49, 0x12, 0x39, 0x2A, 0x45, 0x8E, 0x97, 0xA8, 0x54, 0x72, 0xDC, 0x88, 0x7B,
+    0x79, 0x38, 0x4C, 0x62, 0xB6, 0xBB, 0x81, 0xFF, 0x87, 0x9E, 0x61, 0xEB, 0x62, 0x80, 0x03, 0x7F,
+    0x3B, 0x3D, 0x6C, 0xD3, 0xB9, 0xCA, 0x7F, 0x3E, 0x10, 0xF7, 0xD3, 0x56, 0x90, 0x76, 0x06, 0x81,
+    0xCE, 0xC2, 0x33, 0xBA, 0x3D, 0xB4, 0x26, 0xF6, 0xC6, 0x61, 0xEE, 0x37, 0x51, 0xA8, 0xB4, 0x69,
+    0x67, 0x09, 0x7C, 0x72, 0xF3, 0xFA, 0xA7, 0x85, 0x8B, 0x89, 0x78, 0xE2, 0x8B, 0x6B, 0x6E, 0xDD,
+    0xB9, 0x20, 0xDC, 0x39, 0x47, 0x5D, 0x0C, 0x79, 0x56, 0x3C, 0xE6, 0x9F, 0x39, 0x47, 0xCA, 0x82,
+    0x88, 0x04, 0x97, 0xB8, 0x19, 0x37, 0x04, 0x60, 0x48, 0xF2, 0x9B, 0xF3, 0x2C, 0x01, 0xCB, 0x76,
+    0xB9, 0xDB, 0xAF, 0x49, 0x5E, 0xF2, 0xAC, 0x43, 0x71, 0x6E, 0x4B, 0x4D, 0x08, 0x87, 0x4F, 0xAD,
+    0x51, 0xD6, 0x4C, 0xF4, 0x97, 0xC8, 0x27, 0x1D, 0xDE, 0x19, 0x22, 0xF3, 0x99, 0x42, 0x95, 0x64,
+    0x70, 0x2F, 0xCE, 0x72, 0x69, 0x6B, 0x0C, 0x2D, 0x67, 0xA1, 0x66, 0x0F, 0x93, 0x5A, 0xE4, 0x19,
+    0x16, 0xA5, 0x66, 0x92, 0xBC, 0x3A, 0x7A, 0x61, 0x29, 0x97, 0xEC, 0x75, 0x8C, 0x1F, 0x48, 0xFC,
+    0x5A, 0xEC, 0x9C, 0xD3, 0x6C, 0x7E, 0x21, 0x08, 0x01, 0x66, 0x49, 0x01, 0xA9, 0x9B, 0x7A, 0x25,
+    0x01, 0x5D, 0x21, 0xBB, 0x19, 0x0B, 0x38, 0xA0, 0x8B, 0xCC, 0x01, 0x13, 0x73, 0x38, 0xE0, 0xE7,
+    0x48, 0x32, 0x3C, 0x32, 0x6B, 0xA2, 0x7F, 0x8D, 0xAE, 0x5A, 0xE3, 0xD5, 0x67, 0x2D, 0xD1, 0x94,
+    0xCE, 0xFF, 0xDB, 0x84, 0x44, 0xD1, 0xB0, 0x5F, 0x92, 0xC5, 0xEC, 0x72, 0x08, 0x2F, 0xB3, 0xEB,
+    0x99, 0x8C, 0x05, 0x13, 0xB9, 0x4E, 0xCF, 0x6A, 0x77, 0x27, 0xE8, 0xAF, 0xD2, 0x6C, 0xAD, 0x3A,
+    0xB2, 0x36, 0x75, 0xE1, 0x36, 0xD7, 0xCA, 0xCA, 0xCA, 0x47, 0xFC, 0x0A, 0x86, 0xCF, 0x6E, 0x52,
+    0xC3, 0xAC, 0xD4, 0x1E, 0x5F, 0x07, 0x0E, 0xC9, 0x67, 0x63, 0x86, 0x95, 0x1F, 0xCC, 0x9A, 0xD7,
+    0x9B, 0x7C, 0x15, 0x19, 0xA6, 0xA9, 0xE4, 0x2F, 0x6B, 0x47, 0x14, 0xA7, 0x3B, 0x5B, 0xE3, 0x3E,
+    0x4D, 0x9D, 0x60, 0xE0, 0x2E, 0x3B, 0x59, 0x53, 0x4E, 0xF2, 0xE1, 0xE7, 0xBE, 0xB5, 0x6C, 0x42,
+    0x49, 0xD4, 0xC8, 0xBE, 0xDA, 0x89, 0x76, 0x18, 0x02, 0x73, 0xE2, 0xDD, 0xE0, 0x07, 0xD3, 0x56,
+    0xFE, 0xF8, 0x6C, 0x25, 0x0D, 0x06, 0x61, 0x82, 0x35, 0xD6, 0xE7, 0x07, 0x04, 0xA4, 0x61, 0x89,
+    0xBB, 0xEB, 0xE6, 0x6E, 0xDB, 0x0C, 0xEF, 0x8E, 0x88, 0x49, 0xA7, 0xC7, 0x9B, 0xA0, 0x74, 0x48,
+    0xD5, 0x0E, 0x51, 0x69, 0x50, 0x87, 0xB7, 0xDF, 0xAC, 0xFE, 0x05, 0x85, 0x55, 0x31, 0x8F, 0xDC,
+    0x44, 0x14, 0xFE, 0x3C, 0x93, 0xC5, 0x02, 0x4B, 0x19, 0x0A, 0xAE, 0x3A, 0x09, 0xA7, 0x44, 0x88,
+    0x3B, 0x37, 0x14, 0x20, 0xED, 0xAD, 0x0D, 0x29, 0x29, 0x72, 0x42, 0x6B, 0xF1, 0x1B, 0x40, 0x82,
+    0xB4, 0x57, 0xEC, 0xDD, 0x1A, 0x5D, 0x49, 0xC3, 0x3F, 0xA0, 0x26, 0x08, 0x1D, 0xC5, 0x09, 0x1D,
+    0x92, 0xB3, 0x9E, 0xBB, 0x14, 0x29, 0x52, 0xC4, 0x80, 0x22, 0x0A, 0x8A, 0x38, 0x22, 0x12, 0x28,
+    0x4D, 0x46, 0xC8, 0x42, 0xCE, 0xE1, 0xF5, 0xF0, 0xBD, 0xDD, 0x44, 0x20, 0x85, 0x24, 0xF6, 0xAE,
+    0xBD, 0xF3, 0x66, 0xE6, 0xBD, 0xF7, 0x7D, 0xEF, 0x7B, 0xB3, 0xF9, 0x14, 0xF9, 0x47, 0xDE, 0x85,
+    0xFE, 0xDE, 0x12, 0xA3, 0x4E, 0x39, 0xE8, 0x26, 0xB2, 0x30, 0x45, 0x02, 0x4C, 0x50, 0x02, 0x8F,
+    0x4D, 0xDE, 0xFB, 0x22, 0xF1, 0x7E, 0xF8, 0x8F, 0xE9, 0xE9, 0x55, 0x49, 0x87, 0xAB, 0xBF, 0x8B,
+    0xAF, 0x26, 0x9F, 0xFA, 0x65, 0x5C, 0x47, 0xF6, 0x59, 0x77, 0xD2, 0xF9, 0xE5, 0x28, 0xCF, 0xFC,
+    0x32, 0x58, 0x82, 0x8E, 0xCA, 0x17, 0x3C, 0x8C, 0x45, 0x87, 0x18, 0x61, 0xA3, 0x7A, 0x2C, 0xC0,
+    0x2B, 0x9F, 0x8E, 0x72, 0xE3, 0xAD, 0x6F, 0xE3, 0x5A, 0x75, 0x5C, 0xB0, 0xCF, 0x75, 0x49, 0x86,
+    0x32, 0xAA, 0x11, 0x9D, 0x39, 0xA0, 0xEC, 0x81, 0xC8, 0x73, 0x61, 0xC5, 0x41, 0x74, 0xD7, 0xD2,
+    0x32, 0xE7, 0x8F, 0x33, 0x9A, 0xCB, 0xC8, 0xC9, 0x62, 0x71, 0x5B, 0x65, 0x49, 0xA7, 0x06, 0xFA,
+    0x09, 0x69, 0xC7, 0x88, 0x5E, 0x61, 0x7C, 0x8D, 0xB8, 0x86, 0x60, 0x8A, 0xEC, 0x8B, 0x5E, 0x17,
+    0xF9, 0x72, 0x25, 0xB6, 0x49, 0xCC, 0x5D, 0xEF, 0xFB, 0xD1, 0x94, 0x89, 0x21, 0xED, 0x60, 0x06,
+    0x24, 0x0E, 0x69, 0x8D, 0xB9, 0x55, 0x03, 0x82, 0x87, 0x99, 0x99, 0x21, 0xBC, 0x8A, 0x77, 0x1D,
+    0xB6, 0x66, 0xEA, 0x17, 0x8B, 0xEF, 0x5A, 0x63, 0xA0, 0xCF, 0x9A, 0x77, 0xC6, 0x30, 0xE1, 0x99,
+    0x6D, 0x31, 0x36, 0x57, 0x74, 0x0D, 0xB7, 0xBD, 0x67, 0x32, 0x6D, 0x27, 0x76, 0x42, 0xAC, 0x1E,
+    0x27, 0xD8, 0x53, 0xAD, 0x72, 0x41, 0xA3, 0x85, 0xB0, 0xFB, 0x23, 0x54, 0xBF, 0x79, 0xC7, 0x04,
+    0x6D, 0x9E, 0x49, 0xC9, 0x32, 0xED, 0xEF, 0x79, 0x04, 0x04, 0x00, 0x55, 0x47, 0xA4, 0x31, 0xDB,
+    0x2A, 0xB1, 0x85, 0xE3, 0x1E, 0xC7, 0xEA, 0xC7, 0x8E, 0xA6, 0xF7, 0x1D, 0x4D, 0xDA, 0xD1, 0x14,
+    0x36, 0xC7, 0x1C, 0xFF, 0x54, 0x47, 0x99, 0xB9, 0x95, 0x6D, 0xC1, 0x7C, 0x8B, 0x63, 0xC4, 0xAD,
+    0xAA, 0x99, 0x62, 0x72, 0x1F, 0xE9, 0x65, 0xBA, 0xDD, 0x17, 0x56, 0x33, 0xE0, 0xA5, 0xAF, 0x85,
+    0xB8, 0x01, 0xFA, 0xD1, 0x66, 0x0F, 0x3A, 0x75, 0x64, 0x35, 0xBD, 0xEC, 0x10, 0xF4, 0x5C, 0x61,
+    0x6E, 0x11, 0x76, 0x2F, 0xF0, 0x6F, 0xDB, 0xC7, 0x1C, 0xDF, 0x22, 0x57, 0xFD, 0x01, 0xA7, 0x0E,
+    0x1D, 0x54, 0x9B, 0x16, 0x48, 0x31, 0x20, 0xB6, 0xE1, 0x70, 0x44, 0x96, 0x7D, 0x47, 0x56, 0x77,
+    0xF9, 0xBD, 0xB6, 0x6B, 0xBC, 0xAF, 0xE3, 0xD3, 0x2A, 0x2B, 0xD1, 0x4B, 0xFD, 0x4B, 0xCC, 0xD6,
+    0x2F, 0x8E, 0x12, 0x2C, 0xAA, 0x3A, 0xF2, 0xCD, 0xD3, 0x2C, 0x27, 0x8F, 0x08, 0xB7, 0xE1, 0x7E,
+    0x26, 0x15, 0x50, 0x80, 0x48, 0xEF, 0x54, 0x56, 0xB7, 0x48, 0x0B, 0xC9, 0x2A, 0x63, 0xFC, 0x83,
+    0x50, 0xE2, 0x53, 0x85, 0xDA, 0xC9, 0xB6, 0x1B, 0xAC, 0x76, 0x62, 0x64, 0x33, 0x17, 0x68, 0x47,
+    0xA9, 0x98, 0x82, 0xAB, 0xAE, 0x53, 0x23, 0xBA, 0xD1, 0x1D, 0xE6, 0xD0, 0xC3, 0x51, 0x43, 0x5F,
+    0x4B, 0xA2, 0x4D, 0x09, 0x17, 0xC9, 0x97, 0x7C, 0xC4, 0x8F, 0x32, 0x41, 0xCD, 0x48, 0xC1, 0x42,
+    0x92, 0x45, 0xEA, 0x7D, 0x16, 0xF4, 0x9B, 0x2D, 0x12, 0xE2, 0x91, 0x44, 0x95, 0xA3, 0xC0, 0x4B,
+    0xDE, 0x09, 0x76, 0x68, 0x58, 0x40, 0x89, 0x8B, 0xAA, 0x5F, 0x87, 0x8B, 0x4E, 0x3B, 0x28, 0x97,
+    0x14, 0x28, 0xF5, 0x6A, 0x4B, 0x91, 0xFC, 0x11, 0x76, 0xA9, 0xCF, 0x52, 0x66, 0x12, 0x64, 0xF8,
+    0x38, 0x0B, 0x7D, 0x1F, 0xDF, 0x29, 0x27, 0x18, 0xEF, 0xC8, 0xE7, 0x6D, 0x46, 0x4E, 0x1A, 0x44,
+    0x94, 0x86, 0xA8, 0xAD, 0x85, 0xEA, 0x2F, 0x61, 0xDF, 0x61, 0xA7, 0xC5, 0x7E, 0x8F, 0xBE, 0xFA,
+    0xC6, 0x25, 0xDE, 0x06, 0x53, 0x6C, 0xE4, 0x39, 0x45, 0xEE, 0xFD, 0x8D, 0x07, 0xD5, 0x35, 0xE7,
+    0x4C, 0x31, 0x1E, 0xEB, 0xC6, 0xBC, 0xCC, 0x5E, 0xCB, 0xD8, 0x74, 0x02, 0x8D, 0xB0, 0x99, 0x33,
+    0x5B, 0x03, 0xCF, 0x36, 0x6C, 0x9E, 0x13, 0x29, 0xC3, 0x6C, 0x88, 0x3F, 0xDF, 0x52, 0x34, 0x0B,
+    0x16, 0x13, 0x0C, 0xDA, 0x50, 0x72, 0x51, 0x61, 0x32, 0x6C, 0x13, 0x13, 0xD5, 0xF6, 0x5C, 0x53,
+    0x41, 0x43, 0x8A, 0xC0, 0x91, 0xC2, 0xB8, 0x80, 0x7F, 0x48, 0xE4, 0x15, 0x0B, 0x82, 0x11, 0x99,
+    0xDB, 0xC8, 0x91, 0x7F, 0xE8, 0xBB, 0xC8, 0x9F, 0x52, 0x8A, 0x6D, 0x40, 0xFD, 0x17, 0xDA, 0xAD,
+    0x78, 0xE2, 0xFA, 0x38, 0x33, 0x22, 0x8A, 0x31, 0x6B, 0xC2, 0x11, 0x5A, 0x23, 0x85, 0xE1, 0x28,
+    0x3C, 0x65, 0xA6, 0xE6, 0x0A, 0xB7, 0x6F, 0x73, 0x84, 0x03, 0xC9, 0x5B, 0x1A, 0x56, 0x49, 0x2B,
+    0x32, 0xE6, 0xFA, 0xA2, 0x6B, 0x3E, 0xA6, 0x73, 0x8F, 0x37, 0xC8, 0x36, 0x0B, 0x42, 0xAF, 0x35,
+    0x9D, 0x1F, 0x40, 0x6A, 0xC2, 0x0D, 0xA6, 0x08, 0x5A, 0x79, 0x11, 0x74, 0xF0, 0xB0, 0x88, 0x29,
+    0x06, 0xF5, 0xAB, 0xDD, 0x06, 0x66, 0xFA, 0xA6, 0x25, 0x84, 0x9D, 0xF0, 0xB0, 0xA6, 0xFB, 0x09,
+    0x9B, 0xE1, 0x44, 0x6A, 0x15, 0xB8, 0x96, 0x51, 0x2F, 0xA2, 0x65, 0x2A, 0xE6, 0x53, 0xFC, 0xC0,
+    0xA8, 0x51, 0x89, 0x03, 0x86, 0xD3, 0x3D, 0xA4, 0x5C, 0x52, 0x40, 0xC2, 0x52, 0x92, 0x38, 0xFE,
+    0x4D, 0x22, 0x67, 0x8F, 0x24, 0xCB, 0xB0, 0x65, 0xE0, 0xD8, 0x12, 0xD0, 0x75, 0x39, 0xEF, 0xDC,
+    0x8C, 0xD2, 0xB9, 0xCD, 0x65, 0x55, 0xB3, 0xDA, 0xCF, 0x00, 0xF4, 0x10, 0x0E, 0xFC, 0xF1, 0x27,
+    0xC3, 0xEC, 0x88, 0x32, 0x0A, 0x21, 0x8D, 0xF2, 0xDB, 0x81, 0x61, 0xAF, 0x05, 0xFE, 0x2B, 0x6F,
+    0x2B, 0xBF, 0x31, 0x0D, 0xF2, 0xAB, 0xFE, 0x73, 0x7F, 0x6F, 0x20, 0x1A, 0x63, 0x75, 0x4D, 0xD6,
+    0x78, 0x5E, 0x90, 0xEE, 0xB0, 0x66, 0x9A, 0x3D, 0x33, 0x36, 0x9F, 0x31, 0x09, 0xFF, 0x58, 0xA5,
+    0xD2, 0x0E, 0x0C, 0xB8, 0xEA, 0x09, 0xEA, 0x6B, 0x6D, 0xD8, 0x1C, 0x32, 0xC4, 0xD4, 0xEC, 0x28,
+    0xCF, 0xB3, 0xB9, 0xF7, 0xEF, 0x9D, 0x5F, 0x5B, 0x46, 0x85, 0x6E, 0xDE, 0xA2, 0x9F, 0x4B, 0x8A,
+    0xE1, 0x59, 0x26, 0x48, 0x87, 0x12, 0xDB, 0x81, 0xF4, 0xC7, 0x6A, 0x67, 0x20, 0xF0, 0x0B, 0x65,
+    0x7B, 0x18, 0x4E, 0xCC, 0xA8, 0xF3, 0x86, 0x02, 0x5B, 0x21, 0x7D, 0xF3, 0x70, 0x39, 0xD6, 0xF6,
+    0x39, 0x9F, 0x09, 0x17, 0x00, 0xAF, 0x43, 0xC8, 0x8E, 0x0A, 0x68, 0xCB, 0x73, 0x07, 0xAB, 0x9A,
+    0x02, 0x7B, 0x90, 0x0A, 0x6F, 0xAF, 0xE7, 0x32, 0x99, 0xD3, 0xEB, 0x39, 0xF7, 0x64, 0x0E, 0x9F,
+    0x1C, 0xB9, 0x59, 0x1C, 0x9E, 0xFE, 0xDF, 0xE3, 0xAF, 0x85, 0x07, 0xB9, 0x5C, 0x8A, 0x02, 0xD4,
+    0x5D, 0xE8, 0x9B, 0x45, 0x78, 0x68, 0x8D, 0xAA, 0x63, 0xF0, 0xF4, 0x6A, 0xC7, 0xD8, 0x3B, 0xC1,
+    0xF8, 0x55, 0x5C, 0x60, 0xA6, 0x04, 0x5A, 0xD3, 0x7B, 0x1A, 0x74, 0x61, 0xFD, 0xCA, 0xAA, 0x38,
+    0x41, 0xD5, 0xA8, 0xF3, 0x05, 0x75, 0x65, 0xC7, 0x12, 0x6F, 0x26, 0x30, 0x37, 0xBD, 0x4D, 0x1E,
+    0xB8, 0x44, 0xCE, 0x98, 0x58, 0x39, 0x63, 0xE7, 0x47, 0xFE, 0x8B, 0x21, 0xB1, 0xAF, 0xAD, 0xCB,
+    0x59, 0x15, 0x50, 0xC3, 0xBA, 0x4B, 0xA4, 0x5B, 0xA4, 0x49, 0xA4, 0x59, 0xBA, 0xAA, 0xD6, 0xA4,
+    0xC3, 0xB4, 0xB1, 0x4D, 0x49, 0x5E, 0x87, 0x94, 0xB3, 0x3D, 0xC9, 0x72, 0x13, 0xFE, 0xFF, 0x74,
+    0x98, 0xE8, 0x26, 0x60, 0x13, 0x9A, 0x22, 0x7D, 0xD0, 0xAF, 0xB4, 0x3F, 0x5A, 0xD1, 0x16, 0xFA,
+    0x6C, 0x51, 0x7D, 0x60, 0x27, 0x63, 0x7C, 0xEF, 0xC4, 0xD7, 0x44, 0x1C, 0x93, 0xED, 0x68, 0xF5,
+    0x3F, 0x92, 0xB0, 0xF1, 0xD9, 0xCB, 0xBB, 0xEB, 0xC8, 0x91, 0x9C, 0x17, 0x6E, 0x5D, 0xBE, 0x64,
+    0x5D, 0x4E, 0x96, 0x75, 0xEE, 0xAD, 0xF9, 0xDB, 0x73, 0xD0, 0x53, 0x08, 0xCC, 0x3A, 0x62, 0xB0,
+    0x84, 0xB1, 0x4B, 0x89, 0x2D, 0xC7, 0x0F, 0x4F, 0x9D, 0xA0, 0x0F, 0x7A, 0x35, 0x54, 0xE7, 0xCA,
+    0xFF, 0xBC, 0xC4, 0xEE, 0x85, 0x95, 0xB3, 0x01, 0x43, 0x65, 0x8A, 0xC9, 0x0C, 0x8B, 0x86, 0x87,
+    0x23, 0xAF, 0xA1, 0x15, 0x40, 0x74, 0x1E, 0x5B, 0x06, 0xEE, 0x12, 0x5F, 0x3C, 0x09, 0xFC, 0x9C,
+    0xEB, 0x1F, 0x8D, 0x55, 0x3F, 0x6C, 0xDD, 0x44, 0x1C, 0xFE, 0xEC, 0x6B, 0x6B, 0xC0, 0xA2, 0x66,
+    0xA0, 0x20, 0x91, 0x52, 0x2F, 0x1D, 0x3A, 0x24, 0x31, 0x43, 0x87, 0x20, 0xBD, 0x3C, 0x1B, 0x32,
+    0x74, 0x40, 0xA0, 0x0C, 0x8D, 0x18, 0x3A, 0xB0, 0x42, 0x11, 0x0A, 0x43, 0x90, 0x3A, 0xBC, 0xC4,
+    0x56, 0x33, 0x30, 0x51, 0x85, 0x81, 0x15, 0x21, 0xB1, 0x94, 0x30, 0xA4, 0x48, 0x05, 0x15, 0xE9,
+    0x25, 0xBE, 0x92, 0xB1, 0x12, 0x1C, 0x30, 0x56, 0x48, 0x16, 0x6D, 0x61, 0xA8, 0x44, 0xAE, 0xE0,
+    0x8A, 0x4B, 0xEA, 0xE7, 0xE3, 0x3B, 0xBF, 0x80, 0x68, 0xA9, 0x2A, 0x7C, 0x96, 0xFF, 0xDC, 0xDD,
+    0xEF, 0xF3, 0xEF, 0xCF, 0xF7, 0xFB, 0x0C, 0x6F, 0x1E, 0x49, 0x8B, 0xCD, 0x1C, 0xFA, 0x71, 0x5F,
+    0x43, 0x54, 0xEE, 0x9C, 0xB0, 0x55, 0x6E, 0xAB, 0xF1, 0xF3, 0x43, 0xCF, 0x70, 0x0F, 0xA9, 0xCD,
+    0xC0, 0x43, 0x58, 0x2B, 0xD3, 0x8D, 0x1D, 0x51, 0x45, 0x45, 0x94, 0xC5, 0x98, 0xC5, 0x00, 0xB5,
+    0xAF, 0xFD, 0x3A, 0x2E, 0x84, 0x35, 0x98, 0x7E, 0x0B, 0xD0, 0xDC, 0xA4, 0x80, 0xC8, 0xDA, 0x2C,
+    0xB1, 0xF6, 0x25, 0x8D, 0x95, 0x08, 0xB8, 0x32, 0x80, 0x90, 0x23, 0x6C, 0x79, 0xD6, 0x2A, 0x94,
+    0x37, 0x01, 0x82, 0x45, 0x35, 0x10, 0x8C, 0x88, 0x19, 0x65, 0x63, 0x13, 0x70, 0x82, 0x88, 0x9C,
+    0x88, 0x47, 0x10, 0x3B, 0x56, 0xA2, 0xF5, 0x0D, 0x27, 0x52, 0xEE, 0x08, 0xA5, 0x50, 0xF4, 0xB7,
+    0xC6, 0x90, 0x13, 0xC9, 0x7D, 0x13, 0x5E, 0x59, 0xE4, 0x1F, 0x5A, 0x9D, 0x37, 0x84, 0xAB, 0x42,
+    0x1D, 0x54, 0xE8, 0x8E, 0x89, 0x2A, 0x67, 0x48, 0x0F, 0x8E, 0x70, 0x37, 0x6F, 0xB9, 0x38, 0xC4,
+    0x08, 0xCD, 0x78, 0x9F, 0xDF, 0x84, 0x0D, 0xDF, 0x07, 0x0F, 0x1D, 0x43, 0x98, 0x40, 0x27, 0x72,
+    0xBA, 0x73, 0xD8, 0xF2, 0x03, 0xCE, 0xC8, 0x45, 0x28, 0xE9, 0x25, 0x1F, 0x7B, 0xEE, 0x35, 0x1D,
+    0x09, 0x59, 0x56, 0x11, 0x0C, 0x7A, 0x71, 0x81, 0x3B, 0x35, 0x7D, 0xE7, 0xEA, 0x0A, 0x57, 0x97,
+    0xB9, 0xBA, 0xD9, 0x45, 0x1E, 0xA1, 0xF5, 0xB6, 0xB2, 0x36, 0xB6, 0x0E, 0x05, 0xF3, 0xC8, 0x12,
+    0xB5, 0xA8, 0xC4, 0x23, 0xC7, 0xC4, 0x6E, 0xD9, 0x8E, 0x5D, 0x3C, 0xA4, 0x4B, 0x95, 0x57, 0x41,
+    0x6B, 0x47, 0xB6, 0x45, 0x5C, 0x25, 0x75, 0x2C, 0x19, 0x8B, 0xF6, 0x34, 0x3F, 0xE9, 0x3C, 0xEF,
+    0x77, 0x19, 0x89, 0x0A, 0x97, 0x13, 0x51, 0x75, 0x59, 0x31, 0x5D, 0xA2, 0xFE, 0xBD, 0x10, 0x9A,
+    0x60, 0xD7, 0x6F, 0x23, 0x3B, 0x67, 0x57, 0xAD, 0xDA, 0x47, 0xED, 0x30, 0x89, 0xE8, 0xF0, 0x7C,
+    0x87, 0xE6, 0xB0, 0x62, 0x44, 0x45, 0xC0, 0x09, 0xEF, 0xFE, 0x89, 0xD0, 0x88, 0x3D, 0x67, 0x2D,
+    0x9D, 0x6D, 0x6E, 0x60, 0x4B, 0x35, 0xF4, 0x9A, 0x01, 0x92, 0x45, 0xC6, 0x5B, 0xC0, 0x56, 0x48,
+    0x0D, 0xA2, 0x12, 0xE2, 0xB6, 0x82, 0x6E, 0x60, 0x92, 0x5F, 0x1A, 0x8F, 0x94, 0x38, 0x38, 0xDF,
+    0x85, 0xB0, 0x15, 0x9B, 0xA8, 0xB5, 0x8D, 0x3F, 0xF2, 0x4D, 0xA0, 0x84, 0x8E, 0x11, 0xCA, 0x01,
+    0x62, 0xB2, 0x63, 0x39, 0x90, 0xDE, 0xFE, 0x6B, 0xDF, 0xD3, 0xBE, 0x0E, 0xDA, 0x32, 0x8B, 0x09,
+    0x36, 0x00, 0xE8, 0x00, 0x02, 0x7E, 0x2E, 0x66, 0x91, 0xE8, 0xF2, 0x73, 0xEB, 0x1D, 0x03, 0x11,
+    0xDB, 0xB5, 0xE8, 0x9E, 0xF5, 0xB5, 0xD0, 0xCB, 0x48, 0x42, 0xE9, 0x6B, 0x83, 0x24, 0x2A, 0xC6,
+    0x37, 0xBE, 0x0D, 0x91, 0x06, 0x3A, 0xD2, 0xE4, 0x1E, 0xF2, 0x9F, 0x89, 0x90, 0xD0, 0xFA, 0x9F,
+    0x9B, 0x4F, 0xE4, 0xB3, 0x9F, 0x39, 0x76, 0x7C, 0xD3, 0xE4, 0xD7, 0x9A, 0xA0, 0x7D, 0x53, 0xD4,
+    0x0F, 0xA7, 0xFC, 0xC4, 0x5E, 0x96, 0xDB, 0xA2, 0x0B, 0x35, 0x3E, 0xF3, 0xA3, 0x9C, 0xEA, 0x61,
+    0xBB, 0x46, 0x52, 0xA3, 0xE4, 0x79, 0x15, 0x5B, 0xEF, 0xFA, 0xBF, 0x16, 0xD3, 0x2B, 0x67, 0xB6,
+    0xAD, 0xF6, 0xBA, 0x00, 0x7B, 0xCE, 0x53, 0x26, 0xC3, 0x7E, 0x67, 0x9B, 0x50, 0x32, 0xF9, 0x0F,
+    0x5C, 0xB8, 0x9A, 0x6F, 0x30, 0x0A, 0xAF, 0x8B, 0x21, 0xD4, 0x4F, 0x98, 0xB0, 0x11, 0xA3, 0x07,
+    0x98, 0xFC, 0x1F, 0x6A, 0x73, 0x22, 0xCE, 0xD2, 0x4C, 0xB4, 0x76, 0x97, 0xD9, 0x2D, 0xA5, 0xFB,
+    0x56, 0x6E, 0x12, 0x63, 0xD7, 0x16, 0x15, 0x3B, 0xC3, 0x27, 0x05, 0x84, 0x72, 0x06, 0x3D, 0xC4,
+    0x7E, 0x85, 0x3E, 0x29, 0x39, 0x38, 0x07, 0xFC, 0x29, 0x19, 0x28, 0x49, 0xCA, 0x7E, 0x8A, 0xBA,
+    0x72, 0xD1, 0x28, 0x40, 0x79, 0xA3, 0xCD, 0x2E, 0x1F, 0x1A, 0xB1, 0x71, 0x65, 0x94, 0xB1, 0x74,
+    0xCE, 0x36, 0x51, 0xD3, 0xE8, 0x8B, 0x1D, 0xC1, 0xBC, 0xBD, 0xA7, 0x7B, 0x88, 0xC2, 0xE8, 0x54,
+    0x06, 0xA3, 0x87, 0x1A, 0xC1, 0x4F, 0xE2, 0x5B, 0x20, 0x95, 0xA9, 0x82, 0x6F, 0x3C, 0xD2, 0x3E,
+    0x26, 0x8F, 0xC6, 0x74, 0x4C, 0x4D, 0x5A, 0x5B, 0x55, 0x16, 0x2B, 0x74, 0x71, 0x99, 0xCD, 0x3B,
+    0xBC, 0x0C, 0x94, 0x5C, 0x73, 0x0D, 0x68, 0x98, 0x0A, 0x03, 0x71, 0xB5, 0x76, 0xDE, 0x05, 0x75,
+    0x60, 0xCA, 0xBA, 0xAC, 0xFF, 0xA7, 0xCB, 0xED, 0xD8, 0x65, 0xE6, 0xCB, 0xA9, 0x40, 0x57, 0xB4,
+    0x0C, 0x67, 0x0C, 0x63, 0x91, 0x08, 0x6E, 0x76, 0x95, 0x6F, 0x12, 0x3B, 0x9A, 0x84, 0x99, 0x14,
+    0xDA, 0x6D, 0x8B, 0x33, 0xB2, 0x93, 0x24, 0x15, 0xFA, 0x60, 0x28, 0xA3, 0x38, 0x3B, 0x96, 0xAE,
+    0xB7, 0xA9, 0xED, 0xFA, 0x7A, 0x59, 0x8C, 0x38, 0x45, 0x8D, 0x0A, 0x49, 0x7E, 0xB2, 0x99, 0x23,
+    0x94, 0x69, 0x46, 0x29, 0xE9, 0x9E, 0x49, 0x67, 0x19, 0x16, 0xFB, 0xAD, 0xB1, 0xEB, 0x7A, 0xD2,
+    0xBF, 0xFE, 0xCE, 0x57, 0xF7, 0x9D, 0x59, 0x3F, 0xCB, 0x95, 0xE7, 0xCA, 0xE0, 0x86, 0x76, 0xDC,
+    0x74, 0xCE, 0x63, 0x13, 0x2B, 0x9D, 0xE4, 0xB9, 0xE7, 0xBF, 0x57, 0xEB, 0x89, 0x2A, 0x65, 0x02,
+    0x0E, 0xE2, 0x40, 0xAA, 0x9F, 0xDF, 0x6A, 0x87, 0x9A, 0x44, 0x61, 0xA5, 0x57, 0xB6, 0x28, 0x00,
+    0x47, 0xA7, 0xA6, 0xA6, 0xA6, 0x79, 0x24, 0x69, 0x9A, 0xF6, 0x67, 0x9C, 0x6F, 0x1E, 0x03, 0xBC,
+    0x04, 0x4C, 0x32, 0x54, 0x7E, 0x57, 0x31, 0x2C, 0x15, 0x6F, 0x36, 0xD1, 0x2B, 0x71, 0x78, 0x7E,
+    0x75, 0x4E, 0x7D, 0x02, 0x7D, 0x02, 0x83, 0xC3, 0x88, 0x45, 0x21, 0x54, 0x85, 0xE6, 0x24, 0x92,
+    0x0F, 0x7C, 0x27, 0xBB, 0x09, 0xE9, 0xC8, 0x4C, 0x3D, 0xC9, 0x2C, 0x91, 0x44, 0x6C, 0xE1, 0x25,
+    0xE0, 0x31, 0x87, 0xF7, 0x14, 0xEB, 0x5B, 0x23, 0xDE, 0x20, 0x6D, 0xA8, 0xC7, 0xBE, 0x72, 0x75,
+    0xAA, 0x3B, 0x7D, 0xF2, 0xF4, 0x01, 0x67, 0xF9, 0xEC, 0xDD, 0xD3, 0x98, 0x1E, 0x6B, 0x6C, 0x6F,
+    0xDC, 0x52, 0x57, 0x58, 0x31, 0x6B, 0xAF, 0xED, 0x58, 0x73, 0x1C, 0x47, 0x1C, 0x46, 0x40, 0x7F,
+    0x66, 0xCB, 0xDB, 0x45, 0xBB, 0xA1, 0xC2, 0xA2, 0x07, 0x4D, 0x14, 0x1C, 0x73, 0x37, 0xF7, 0xD6,
+    0x2E, 0xAA, 0x59, 0x7B, 0xFD, 0xFD, 0xCE, 0x65, 0xEC, 0xF7, 0x20, 0xCA, 0x1F, 0x5A, 0x84, 0x2A,
+    0x2E, 0x7C, 0x2A, 0x11, 0x13, 0xD1, 0x27, 0xA6, 0x2B, 0x2A, 0xCC, 0x14, 0x0B, 0x46, 0x6D, 0x7F,
+    0xFB, 0xF6, 0x45, 0x52, 0xA5, 0x40, 0x60, 0xE9, 0xF7, 0xE7, 0x7B, 0x6B, 0x70, 0x2D, 0xED, 0x7A,
+    0xB9, 0x73, 0x60, 0x62, 0xCF, 0x81, 0x54, 0xFB, 0x69, 0xFF, 0x92, 0xAB, 0xC1, 0x7E, 0xDA, 0xDD,
+    0x86, 0x16, 0x5F, 0x6F, 0x86, 0xC5, 0xB9, 0x59, 0x9C, 0xA7, 0xA4, 0x50, 0x56, 0x47, 0xD0, 0xA5,
+    0xAF, 0x72, 0xF2, 0x35, 0xAC, 0xA6, 0x82, 0x7A, 0x46, 0x98, 0xCA, 0xBB, 0x57, 0x60, 0xB4, 0xE4,
+    0xFF, 0xAE, 0xA3, 0x53, 0x77, 0x4D, 0xC8, 0x9F, 0x53, 0x86, 0xE3, 0x87, 0xD2, 0x60, 0xE7, 0x6A,
+    0x9D, 0x3D, 0x0D, 0xCF, 0xB5, 0x78, 0x49, 0xCD, 0x88, 0x33, 0x72, 0x4C, 0xC3, 0xA3, 0x3A, 0x9F,
+    0xF5, 0xD4, 0x52, 0xD4, 0xFA, 0xDB, 0x52, 0xCF, 0x04, 0xAF, 0x05, 0xD9, 0xFC, 0xE1, 0x93, 0x8C,
+    0x66, 0x46, 0xB1, 0x10, 0x7F, 0xBC, 0x2C, 0x21, 0x2E, 0x04, 0x05, 0x0E, 0x4F, 0x46, 0x1F, 0x15,
+    0x4B, 0xDC, 0x25, 0xA4, 0xF6, 0xB2, 0x29, 0x1A, 0xD2, 0x7A, 0x17, 0x2C, 0x62, 0x27, 0x05, 0x4E,
+    0xCA, 0xBC, 0xB5, 0xF0, 0x37, 0xB1, 0x2D, 0xE7, 0x75, 0xD8, 0x44, 0x6F, 0x04, 0xAB, 0x72, 0xAF,
+    0x8D, 0x2F, 0xB0, 0x88, 0xEB, 0x5F, 0x50, 0xEA, 0x4E, 0xFA, 0x45, 0x8C, 0x3A, 0x90, 0xCB, 0xEE,
+    0x77, 0xD8, 0x17, 0x14, 0xA8, 0x24, 0x73, 0xBA, 0x36, 0x4D, 0xA6, 0x9C, 0x73, 0x7F, 0x0C, 0x1C,
+    0x59, 0x58, 0xB0, 0xF6, 0xCE, 0xC2, 0xEB, 0xD2, 0x15, 0xA7, 0xD7, 0xFD, 0x49, 0xB0, 0x70, 0xDA,
+    0x8E, 0xD6, 0x2F, 0x92, 0x3B, 0x08, 0x6D, 0x11, 0x10, 0xE1, 0xFB, 0xF9, 0x99, 0x13, 0x2B, 0x6A,
+    0x7B, 0xEE, 0xC2, 0xE1, 0x17, 0x5E, 0x54, 0x9F, 0x0A, 0x13, 0xBA, 0xDB, 0xEA, 0xB5, 0x57, 0x8F,
+    0x9E, 0x7E, 0x46, 0x5E, 0xC2, 0x92, 0x7F, 0x6B, 0xD3, 0xC5, 0x97, 0xDA, 0xC5, 0x4E, 0x8A, 0xE7,
+    0x7D, 0x3B, 0x77, 0xEB, 0x4E, 0x75, 0x6C, 0x49, 0x7C, 0xEC, 0xDD, 0x50, 0x3A, 0xAF, 0xBD, 0x35,
+    0x3C, 0xE2, 0xF8, 0x0B, 0xB5, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xBB, 0x1B, 0x7B, 0x11,
+    0x4B, 0x32, 0x14, 0x41, 0x80, 0x02, 0xDE, 0x14, 0x29, 0x40, 0xBA, 0xF3, 0xB6, 0x46, 0xDA, 0xF3,
+    0x4E, 0x94, 0x3F, 0xC0, 0x2E, 0x38, 0x9A, 0x14, 0x50, 0xA4, 0x81, 0x8A, 0xC2, 0x85, 0x0B, 0xFF,
+    0x58, 0x25, 0x7F, 0x00, 0xA9, 0xE8, 0x2C, 0x51, 0x80, 0x04, 0xE7, 0x22, 0x2E, 0x5C, 0x38, 0xD2,
+    0xE1, 0x9D, 0x38, 0x05, 0xED, 0x46, 0xF4, 0x68, 0x85, 0x8C, 0x2C, 0xB9, 0xC9, 0x8A, 0x5C, 0xC4,
+    0x99, 0xEC, 0xED, 0xF0, 0xBE, 0x39, 0x27, 0xD8, 0x12, 0x74, 0xF1, 0xED, 0xED, 0xDB, 0xDB, 0xDD,
+    0x99, 0xF7, 0xBE, 0xEF, 0xCD, 0xF7, 0xCD, 0xE1, 0x06, 0x50, 0x23, 0x30, 0x50, 0x40, 0xEA, 0x59,
+    0xFB, 0xE7, 0xF6, 0x71, 0x2E, 0x3F, 0x4F, 0x9F, 0xCA, 0x87, 0x4F, 0x8F, 0xAC, 0x35, 0xDE, 0x9D,
+    0xC0, 0xDE, 0x7B, 0x52, 0xD7, 0xBD, 0xAB, 0x0A, 0x51, 0x1E, 0x9A, 0xD0, 0x44, 0x3C, 0x02, 0xDB,
+    0x0C, 0x7E, 0xF2, 0xEE, 0x47, 0xF6, 0xD6, 0xA3, 0x5A, 0xA7, 0xE8, 0x79, 0xFB, 0x28, 0x2A, 0x4E,
+    0xE7, 0x98, 0x83, 0xC2, 0xD8, 0xDC, 0x11, 0x94, 0xE3, 0x66, 0xAD, 0xE3, 0xB8, 0x90, 0xF0, 0x4D,
+    0x86, 0x18, 0x8B, 0xFF, 0x79, 0x26, 0x7C, 0x27, 0x67, 0xA6, 0xB3, 0xBC, 0xC8, 0xB3, 0x17, 0xCF,
+    0xFE, 0xEE, 0xD9, 0x83, 0x49, 0x7A, 0x15, 0xCB, 0x3D, 0xCE, 0x95, 0x73, 0xF1, 0xF4, 0xFC, 0x48,
+    0xC8, 0x66, 0xFA, 0x28, 0x6C, 0x69, 0x5F, 0xE4, 0xC5, 0x49, 0x99, 0xB5, 0x2B, 0xB1, 0xDD, 0x0A,
+    0xED, 0xD1, 0x4D, 0xEB, 0x6E, 0x22, 0xBB, 0x05, 0x7B, 0xA4, 0xC3, 0x87, 0x25, 0xAE, 0xAC, 0x20,
+    0xD8, 0x02, 0x8E, 0x34, 0x3E, 0xF9, 0xF7, 0x06, 0x58, 0xD0, 0xB8, 0x0C, 0xF8, 0xC0, 0xFB, 0xEA,
+    0x97, 0x7A, 0xF7, 0xE3, 0xB8, 0x1C, 0xA7, 0xEB, 0x97, 0x00, 0x1D, 0x9B, 0xC2, 0x04, 0xE7, 0x8E,
+    0x64, 0xFC, 0xD5, 0x8F, 0xDE, 0xF7, 0x81, 0x7D, 0x6C, 0x9E, 0x57, 0xF1, 0x6A, 0xF0, 0x1B, 0x9E,
+    0x99, 0xDD, 0xFD, 0x61, 0x34, 0x66, 0x08, 0x83, 0x9D, 0x62, 0xFC, 0x75, 0xA0, 0x95, 0xDE, 0xC3,
+    0x48, 0xE5, 0x71, 0xDE, 0xF8, 0x75, 0xAC, 0x1B, 0x65, 0xC6, 0x91, 0x7C, 0x57, 0x82, 0x1C, 0xE7,
+    0x3E, 0x25, 0x22, 0x03, 0xAF, 0x42, 0x61, 0xC4, 0xDD, 0x77, 0x0D, 0x22, 0x7D, 0x6A, 0x3E, 0xB1,
+    0xE3, 0x70, 0xC1, 0xE1, 0x8E, 0x57, 0x13, 0xCB, 0x90, 0xE8, 0x1B, 0x55, 0x5F, 0x3B, 0x0C, 0x75,
+    0xB7, 0x2E, 0x1A, 0x85, 0xBD, 0x1A, 0xE8, 0x78, 0x15, 0x71, 0x21, 0x30, 0xC4, 0x9D, 0xD0, 0xB6,
+    0x64, 0xF4, 0xB7, 0x4F, 0xDC, 0x7A, 0xD5, 0x08, 0x73, 0x41, 0x32, 0x62, 0x19, 0xDE, 0x39, 0x71,
+    0xCF, 0x88, 0x3A, 0x47, 0x51, 0x3D, 0xD4, 0xA2, 0x3E, 0xD5, 0xED, 0x3A, 0x4C, 0xA7, 0xBA, 0x0E,
+    0xAB, 0xC4, 0xE9, 0x9E, 0x34, 0xCC, 0xFE, 0x66, 0x95, 0x5E, 0x3B, 0x54, 0x28, 0xD3, 0xA2, 0xF9,
+    0x10, 0xD8, 0x93, 0xDA, 0xF0, 0x44, 0x17, 0x21, 0xE5, 0x2A, 0x2E, 0x1B, 0x7C, 0x23, 0x8F, 0xC3,
+    0xDC, 0x67, 0x24, 0x8A, 0xE5, 0x32, 0xC1, 0x9C, 0xD3, 0xBB, 0x74, 0x46, 0xFB, 0x6D, 0xD0, 0x6C,
+    0xCF, 0x1A, 0x09, 0xEF, 0xF9, 0x50, 0x34, 0xAE, 0x2B, 0xF8, 0x25, 0x58, 0x4A, 0x8C, 0x16, 0x71,
+    0x2E, 0xCA, 0xC9, 0x48, 0xB2, 0x27, 0x65, 0x87, 0x22, 0x81, 0xB9, 0xCC, 0x4A, 0xF0, 0xEA, 0x08,
+    0x89, 0xB9, 0x3D, 0x0A, 0xF5, 0x7C, 0x9D, 0x31, 0xA8, 0x38, 0xF5, 0xA8, 0xA7, 0x24, 0xBD, 0x2A,
+    0xBA, 0xC5, 0x08, 0x76, 0x02, 0x6B, 0x81, 0x55, 0x0C, 0xF6, 0x73, 0x49, 0x81, 0x2F, 0xE6, 0x70,
+    0x6A, 0x29, 0x0D, 0x80, 0x3E, 0xD5, 0x4F, 0xB4, 0x2A, 0x25, 0xEC, 0xA9, 0x0D, 0x2B, 0x98, 0xF7,
+    0xEC, 0x81, 0x7D, 0xD2, 0x72, 0xD9, 0xBA, 0x12, 0xD2, 0x08, 0xF1, 0xB7, 0x77, 0x6D, 0x1D, 0x8F,
+    0x18, 0xE8, 0x1B, 0x32, 0xE8, 0x67, 0x19, 0xD8, 0x0A, 0x14, 0x72, 0xFB, 0xDE, 0x2B, 0x0F, 0x85,
+    0x30, 0x93, 0x1F, 0x13, 0x82, 0x2B, 0x81, 0x1E, 0x69, 0xFD, 0x5F, 0x99, 0x8A, 0x52, 0x8C, 0x67,
+    0x95, 0x86, 0x04, 0xE5, 0xA2, 0x64, 0x31, 0x04, 0x1E, 0x7E, 0x36, 0x02, 0x03, 0xAC, 0x90, 0x0C,
+    0x1E, 0x18, 0x51, 0xD1, 0x74, 0x2D, 0x93, 0x0A, 0x1E, 0xFA, 0x2D, 0xA2, 0x36, 0x9B, 0x80, 0x76,
+    0x49, 0x11, 0x02, 0x1B, 0x42, 0x38, 0x22, 0x88, 0xAC, 0xAF, 0x2F, 0x56, 0xF1, 0x0B, 0xE1, 0x12,
+    0x3F, 0x36, 0x08, 0xE1, 0x41, 0x2D, 0xDD, 0x6F, 0x2E, 0x52, 0x71, 0x46, 0x98, 0x8B, 0x25, 0x4E,
+    0x7C, 0xDA, 0x00, 0x57, 0xE2, 0xF2, 0x5C, 0x65, 0x5E, 0x84, 0x62, 0x97, 0xEB, 0xEA, 0x35, 0x19,
+    0x1B, 0xAC, 0x6A, 0xCE, 0xF5, 0x01, 0xCB, 0x02, 0x42, 0x8A, 0x4D, 0xCA, 0xFA, 0xE2, 0xB6, 0x5A,
+    0x23, 0xEC, 0xD2, 0xFB, 0xE0, 0x31, 0x65, 0xE7, 0xA4, 0xB2, 0xD9, 0xCD, 0xAC, 0xF0, 0x04, 0x98,
+    0xEF, 0xB3, 0x16, 0xAC, 0x1D, 0x23, 0x3A, 0xDE, 0xAE, 0xB9, 0x07, 0x85, 0x52, 0x47, 0xCA, 0xF0,
+    0x75, 0x82, 0x82, 0x35, 0xFF, 0x8D, 0xD5, 0x99, 0x25, 0xD1, 0x1D, 0xA9, 0x5C, 0x59, 0xBE, 0x9A,
+    0x14, 0xC1, 0x5D, 0x23, 0x91, 0xCB, 0x23, 0x31, 0xD9, 0x25, 0xEF, 0x40, 0x22, 0x09, 0x65, 0x54,
+    0x52, 0x11, 0xFE, 0xE2, 0xA8, 0x68, 0x89, 0x93, 0x53, 0x26, 0xEF, 0x55, 0x8C, 0x42, 0x69, 0x26,
+    0xBF, 0xE6, 0xD7, 0xF0, 0xFF, 0xB8, 0x5D, 0x42, 0x59, 0xEE, 0xA0, 0xFB, 0x83, 0x82, 0xB9, 0x63,
+    0x5D, 0x5A, 0xAD, 0xC1, 0x18, 0x7E, 0x4D, 0x83, 0x92, 0xB1, 0x1D, 0x05, 0x96, 0x44, 0xEF, 0xF4,
+    0xFB, 0xCC, 0x27, 0x93, 0x00, 0x11, 0xB6, 0x83, 0xB1, 0x4B, 0x86, 0x5D, 0x34, 0xE7, 0x30, 0x95,
+    0xC4, 0xB0, 0xEB, 0xB0, 0x16, 0xF4, 0xCB, 0x0D, 0x5A, 0x16, 0x9A, 0x4D, 0xB6, 0xA2, 0x92, 0xCC,
+    0x10, 0x5B, 0x89, 0xA9, 0xD7, 0xA7, 0xAF, 0x6C, 0xE3, 0x35, 0xBC, 0xC5, 0x7E, 0x5C, 0x43, 0x37,
+    0xA8, 0x88, 0x69, 0x74, 0xC8, 0xDD, 0xBF, 0xC9, 0x26, 0x11, 0x11, 0x33, 0x3F, 0x20, 0xB4, 0x4D,
+    0x70, 0xF2, 0xB9, 0x69, 0x90, 0xC6, 0xF4, 0xAA, 0x42, 0x67, 0x1D, 0xB2, 0xA7, 0xC8, 0xA2, 0x88,
+    0xA3, 0xCD, 0xF4, 0x8E, 0xB4, 0x21, 0xD3, 0xCE, 0xE8, 0xBF, 0xD5, 0xB3, 0x21, 0x57, 0x2A, 0x62,
+    0x78, 0x1E, 0xE3, 0xFC, 0x72, 0x5A, 0x75, 0x4A, 0xBB, 0x3D, 0x64, 0x38, 0x35, 0x25, 0x97, 0xBF,
+    0x05, 0xD7, 0x6D, 0xB3, 0x24, 0xF0, 0xDC, 0x96, 0xD9, 0xEF, 0xF7, 0x97, 0xA8, 0x19, 0x1F, 0x6F,
+    0x9B, 0x21, 0x3A, 0x91, 0xF1, 0x78, 0x79, 0xA9, 0x14, 0x1D, 0xB7, 0xDC, 0xF7, 0xAB, 0x97, 0x77,
+    0xEE, 0xF2, 0x26, 0x2F, 0xF5, 0x10, 0x73, 0x89, 0xB5, 0x4F, 0xAD, 0x14, 0xF8, 0x75, 0x66, 0xA6,
+    0xA5, 0x9F, 0x02, 0x5A, 0x72, 0x03, 0xAF, 0x83, 0x73, 0x96, 0xF6, 0x35, 0xAE, 0x63, 0x62, 0xFE,
+    0xF1, 0x99, 0xCE, 0x6B, 0xE0, 0xF4, 0xEF, 0xAF, 0x62, 0x53, 0x99, 0xF0, 0x55, 0x85, 0xCE, 0xF4,
+    0xFB, 0x9F, 0x5A, 0x6B, 0x1F, 0xB5, 0x83, 0x61, 0xC4, 0x1D, 0x78, 0x88, 0x0F, 0xCE, 0x4C, 0xDF,
+    0x7F, 0x40, 0x23, 0x5B, 0x9C, 0x51, 0x30, 0xF8, 0x6E, 0x08, 0x45, 0xD9, 0xDF, 0xAD, 0x6D, 0x39,
+    0xAF, 0x5C, 0xE6, 0x1A, 0x14, 0x3A, 0xAE, 0xA4, 0xC1, 0xC9, 0x34, 0x89, 0xCB, 0xC8, 0xFC, 0xDF,
+    0xC1, 0x1A, 0x9A, 0xFC, 0x03, 0xBD, 0x55, 0x3D, 0x6F, 0x1D, 0x45, 0x14, 0x3D, 0xB3, 0x13, 0x7B,
+    0x51, 0x46, 0xCA, 0x52, 0x10, 0x11, 0x64, 0xC4, 0xB6, 0x2E, 0xB0, 0x97, 0x32, 0x45, 0xEC, 0x5D,
+    0x29, 0x45, 0x0A, 0x0A, 0x5E, 0xE1, 0x07, 0x05, 0x45, 0xFA, 0x34, 0xE1, 0x07, 0xBC, 0x8F, 0x95,
+    0x90, 0xA8, 0xC3, 0x3F, 0x48, 0x41, 0x03, 0x96, 0x30, 0x85, 0x0B, 0x17, 0x6B, 0x76, 0xA2, 0x14,
+    0x29, 0x5C, 0xB0, 0x24, 0x25, 0xCD, 0x80, 0x8C, 0x10, 0x69, 0x18, 0x4B, 0x0B, 0x5A, 0xA2, 0x79,
+    0x3B, 0x9C, 0xD9, 0xF7, 0x6C, 0x09, 0x09, 0x82, 0x14, 0xC9, 0xAC, 0x35, 0xF3, 0xC6, 0x77, 0x67,
+    0xCE, 0x99, 0x7B, 0xEF, 0xB9, 0x77, 0xF1, 0x1A, 0xA6, 0xD2, 0x25, 0xE6, 0x2D, 0x00, 0xE3, 0x3D,
+    0xBF, 0x48, 0x1B, 0xA5, 0xFF, 0xED, 0x2F, 0xEB, 0xFC, 0x02, 0x0F, 0xE1, 0x51, 0xDB, 0x6A, 0xF7,
+    0x66, 0x54, 0x42, 0x8C, 0x47, 0x7E, 0x11, 0xB7, 0xA8, 0x90, 0x41, 0xE9, 0xC8, 0xFE, 0xE3, 0xA2,
+    0x36, 0x7E, 0xB1, 0xA9, 0xDE, 0x37, 0x6E, 0x9A, 0x68, 0x92, 0x84, 0x43, 0xB9, 0x2F, 0xE6, 0x05,
+    0x5F, 0x66, 0x78, 0xD9, 0x54, 0x1B, 0xEE, 0x13, 0xF7, 0xBE, 0x80, 0xF4, 0xE4, 0x8D, 0xCF, 0x3E,
+    0x76, 0x01, 0xD4, 0x86, 0xD7, 0x65, 0x06, 0x38, 0x2E, 0x54, 0xC3, 0xC5, 0xF4, 0xCD, 0xDF, 0x47,
+    0xF1, 0x2F, 0xDE, 0x63, 0x87, 0x96, 0x38, 0x58, 0x26, 0x5C, 0x24, 0x9A, 0x8B, 0x96, 0x8B, 0x9C,
+    0xA7, 0x52, 0xAD, 0xBC, 0x37, 0xC4, 0x31, 0x58, 0x3E, 0x6B, 0x82, 0x53, 0x7D, 0x0D, 0x90, 0xBF,
+    0x39, 0xE0, 0x5A, 0xDA, 0xE0, 0xE2, 0x59, 0xDB, 0xC3, 0xDA, 0x78, 0xDE, 0x22, 0xEF, 0x53, 0x8B,
+    0xB4, 0xCC, 0x0C, 0xB6, 0x50, 0x37, 0x38, 0x8C, 0x7E, 0xD0, 0x51, 0xA3, 0x3E, 0xD0, 0xAA, 0xD8,
+    0x4A, 0xCB, 0x2D, 0x1C, 0x66, 0x34, 0x35, 0x39, 0x4D, 0xC5, 0x8C, 0x26, 0x1C, 0xD3, 0x04, 0x47,
+    0x13, 0x5E, 0xD0, 0x24, 0x3C, 0x4D, 0x72, 0x11, 0xF5, 0x85, 0x6C, 0x73, 0xCF, 0x5B, 0x11, 0xF8,
+    0x0A, 0xF0, 0x06, 0x7F, 0xA4, 0xE5, 0x94, 0x05, 0xC3, 0xBC, 0xE4, 0x74, 0x63, 0x45, 0xBB, 0xFE,
+    0x25, 0xA0, 0x7C, 0x0F, 0xF9, 0xE7, 0x86, 0xC3, 0x82, 0x7E, 0x66, 0x05, 0xF2, 0xDB, 0x16, 0xC2,
+    0x4D, 0x81, 0xE4, 0x84, 0xA1, 0x73, 0x15, 0x77, 0x7C, 0xC7, 0x45, 0xC5, 0x2B, 0xAB, 0x13, 0x22,
+    0xB8, 0x19, 0x5F, 0x7D, 0x6A, 0x11, 0xB5, 0x79, 0x49, 0x3F, 0x7B, 0xFA, 0x19, 0xF7, 0x07, 0x0C,
+    0x8B, 0xEF, 0xE8, 0xC7, 0x28, 0xC0, 0x46, 0x21, 0xE2, 0x2D, 0x27, 0xCF, 0xC1, 0x5D, 0x88, 0x8A,
+    0xCB, 0x25, 0x7C, 0x18, 0x78, 0x74, 0x80, 0x26, 0x97, 0x3D, 0x02, 0x82, 0x50, 0x2E, 0x91, 0x30,
+    0x64, 0x52, 0xBA, 0x9B, 0xC0, 0xAE, 0x2F, 0x21, 0xEF, 0xD8, 0x65, 0xA0, 0x2F, 0x91, 0x70, 0x33,
+    0x2E, 0xA0, 0x0C, 0xF7, 0xAF, 0xF4, 0xBC, 0x7A, 0xEE, 0x3D, 0xA0, 0xA0, 0xA8, 0xAF, 0xFC, 0xF3,
+    0x5A, 0x27, 0x0D, 0xEA, 0xA8, 0x05, 0x53, 0x0F, 0xA4, 0x4F, 0x9A, 0x25, 0xCF, 0x40, 0x38, 0xF0,
+    0x0C, 0x84, 0xC7, 0xB4, 0x3C, 0xA1, 0x1C, 0x3B, 0xEE, 0xC9, 0x6E, 0x77, 0x94, 0x45, 0x62, 0x84,
+    0xC3, 0xFC, 0xB9, 0x0F, 0x38, 0x0C, 0xD9, 0x38, 0xA0, 0x2A, 0xBC, 0x3D, 0x89, 0x1F, 0x9D, 0xD9,
+    0x38, 0x68, 0x3F, 0x76, 0xE2, 0xCC, 0x4E, 0xE2, 0x13, 0x0A, 0x32, 0x64, 0xF5, 0xAB, 0xE2, 0x75,
+    0xEE, 0xFC, 0xD1, 0x24, 0xA7, 0xF7, 0x7B, 0xBA, 0x97, 0x58, 0xD5, 0x50, 0x57, 0x39, 0x22, 0xFF,
+    0xA8, 0xC5, 0x76, 0xCE, 0xF2, 0x33, 0x2E, 0xC3, 0x76, 0xD4, 0xBA, 0xC8, 0xA8, 0xC7, 0x76, 0x1B,
+    0x99, 0x7A, 0x6A, 0xE0, 0xB2, 0xAF, 0x21, 0x4D, 0x6E, 0x90, 0x15, 0x3E, 0x14, 0x51, 0xF0, 0x70,
+    0xDB, 0xEF, 0x3B, 0x98, 0x81, 0xF5, 0x7A, 0x90, 0xC7, 0x7A, 0xC0, 0xCF, 0xC2, 0x54, 0x87, 0xDC,
+    0xCD, 0xF5, 0xB9, 0x2D, 0x54, 0x6F, 0x21, 0xC6, 0x77, 0x7D, 0x91, 0xF7, 0x1B, 0x86, 0x27, 0x93,
+    0x02, 0xDB, 0xD8, 0x01, 0x8E, 0xD0, 0x22, 0x32, 0xB2, 0x81, 0x2A, 0x5F, 0x6A, 0xA2, 0x9F, 0x0D,
+    0x0B, 0x20, 0x45, 0x6C, 0x45, 0x87, 0xA4, 0xF7, 0x7A, 0x19, 0x59, 0xEC, 0x0D, 0xE8, 0x81, 0x2D,
+    0xE5, 0x0D, 0x22, 0xB7, 0x52, 0x2B, 0x1E, 0xFC, 0x0F, 0xB4, 0x9B, 0x58, 0x31, 0x66, 0x9C, 0x84,
+    0x0D, 0xB9, 0xC2, 0x37, 0x97, 0x4E, 0x7B, 0x55, 0x30, 0xFB, 0x33, 0x6A, 0x48, 0x04, 0x09, 0x5C,
+    0x3C, 0xE3, 0x11, 0xC6, 0x1F, 0xF9, 0x26, 0xF1, 0x9F, 0x75, 0x3C, 0xF6, 0xDF, 0x1C, 0x7F, 0x37,
+    0xED, 0xB2, 0xE7, 0xC1, 0x21, 0xD6, 0x94, 0xD2, 0x8C, 0x8D, 0xB3, 0xA6, 0x92, 0x59, 0x01, 0xCC,
+    0xEB, 0xD0, 0xDA, 0x82, 0xA2, 0x98, 0xCC, 0xD4, 0x2C, 0x3B, 0xD0, 0xDA, 0x45, 0x70, 0xAF, 0x7F,
+    0xE8, 0xBB, 0xB4, 0xA7, 0xFD, 0x98, 0xA7, 0x77, 0xA8, 0x8D, 0x34, 0x08, 0xB2, 0xC0, 0x54, 0x95,
+    0x48, 0x1E, 0xF3, 0xC8, 0x1F, 0xE1, 0x08, 0x8B, 0x4B, 0x86, 0x5E, 0x52, 0xAD, 0xE4, 0x11, 0xB0,
+    0x22, 0xBB, 0x34, 0x88, 0xFA, 0x14, 0x82, 0x54, 0xE3, 0x3D, 0x24, 0xF4, 0x33, 0xD5, 0x83, 0x55,
+    0xF9, 0x53, 0x7C, 0x7B, 0x60, 0x95, 0x4E, 0x75, 0x85, 0x4A, 0xE9, 0xB8, 0xA9, 0xB0, 0xC3, 0x1F,
+    0xFE, 0xD7, 0x29, 0x3D, 0x0F, 0x4A, 0x57, 0xBF, 0x16, 0x61, 0x67, 0x7A, 0x3A, 0x9C, 0x1B, 0x62,
+    0x93, 0xFA, 0x02, 0xB3, 0xBB, 0x0D, 0x5A, 0x69, 0x22, 0xF6, 0x7B, 0xCE, 0x74, 0x31, 0xD6, 0xB2,
+    0xE1, 0xAD, 0x9A, 0x5B, 0x1C, 0x87, 0x1C, 0x15, 0xC7, 0x9C, 0x23, 0x6B, 0x64, 0xA3, 0x5A, 0xD9,
+    0x08, 0xC7, 0x30, 0x4C, 0xE4, 0xF7, 0xB8, 0x25, 0x9F, 0x95, 0x13, 0xF5, 0xEC, 0xE7, 0x36, 0x7F,
+    0xEA, 0x9B, 0xD0, 0x73, 0x43, 0x87, 0x08, 0xC5, 0x4E, 0x60, 0x7E, 0xB3, 0x18, 0xFF, 0xAB, 0xE7,
+    0xC1, 0x5E, 0x27, 0xFD, 0xF3, 0x4E, 0xB2, 0x68, 0x6C, 0xCC, 0x44, 0xD8, 0x70, 0xE7, 0xFB, 0xFC,
+    0xBE, 0xED, 0xEB, 0x4A, 0xD8, 0x0C, 0x13, 0xA5, 0x73, 0xD1, 0xD7, 0x7D, 0xD6, 0xD5, 0x18, 0xAD,
+    0x62, 0x45, 0xC4, 0x6E, 0xC0, 0x9A, 0x00, 0xEF, 0xBE, 0x22, 0xCE, 0xD1, 0xD0, 0xFB, 0x77, 0x59,
+    0xA5, 0x29, 0xDE, 0x89, 0xCE, 0xBF, 0x3D, 0x1B, 0x3D, 0xB2, 0x7D, 0x93, 0x14, 0x4E, 0xEA, 0x14,
+    0x4C, 0x21, 0x43, 0x2B, 0x6A, 0x16, 0xE8, 0x41, 0x44, 0xD0, 0x01, 0xC7, 0xC5, 0x2F, 0x7C, 0x57,
+    0xFF, 0xE4, 0xC4, 0xB2, 0x87, 0xCB, 0xF6, 0x3D, 0xE1, 0x8F, 0xF1, 0x89, 0xC7, 0x95, 0x75, 0xBC,
+    0x22, 0xC8, 0x5F, 0xAD, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xB3, 0x13, 0x7B, 0x05, 0x8B,
+    0x18, 0x17, 0x89, 0x14, 0x91, 0xE0, 0xFD, 0x03, 0x80, 0xDB, 0x96, 0xE2, 0xEE, 0x76, 0x44, 0x0A,
+    0x0A, 0x1A, 0x17, 0xB1, 0x28, 0x68, 0x52, 0x50, 0xE3, 0x14, 0x29, 0x28, 0x1C, 0xDF, 0xCA, 0x14,
+    0x14, 0x29, 0x62, 0xEA, 0x14, 0x50, 0x50, 0x91, 0xC2, 0x8D, 0x85, 0x90, 0xB8, 0xF3, 0x0E, 0xB1,
+    0x50, 0xDA, 0x95, 0x28, 0x69, 0x16, 0x64, 0x29, 0x92, 0x2D, 0x71, 0x83, 0xB4, 0xC0, 0xDA, 0xBE,
+    0xDB, 0xE1, 0xCD, 0xDE, 0xD9, 0x4E, 0x84, 0xB1, 0x44, 0xC4, 0x58, 0x3E, 0xED, 0x8F, 0xF9, 0xDE,
+    0xBE, 0x79, 0xF3, 0xBE, 0x37, 0xAF, 0x88, 0x4C, 0xFD, 0x50, 0x07, 0x76, 0x03, 0x4B, 0x0B, 0x98,
+    0x8F, 0xB5, 0x1A, 0xBB, 0xDB, 0x59, 0x4F, 0x5A, 0x85, 0x75, 0x20, 0x06, 0x22, 0xB3, 0xE8, 0x6C,
+    0x74, 0x3C, 0x8C, 0x4C, 0x1C, 0xD8, 0xD0, 0x0C, 0xA5, 0x8D, 0x0F, 0xDD, 0xAF, 0xEE, 0x81, 0xF5,
+    0x25, 0x1F, 0x03, 0xCE, 0xE0, 0xDE, 0x0E, 0xDE, 0x7E, 0x13, 0xD1, 0xFB, 0xDA, 0xDF, 0xBC, 0xAA,
+    0x3D, 0xCC, 0xA2, 0xCB, 0xA2, 0x83, 0x5A, 0x16, 0x29, 0x58, 0x03, 0x61, 0x81, 0x21, 0xD6, 0x1C,
+    0xF2, 0xC7, 0x66, 0x28, 0x6C, 0x82, 0xF5, 0xC8, 0xA4, 0xA2, 0xC9, 0x9B, 0xA4, 0xCE, 0xB1, 0x32,
+    0xFF, 0xF2, 0x8D, 0x69, 0x34, 0x0D, 0x8E, 0x47, 0xC7, 0x53, 0xA5, 0x9D, 0x9E, 0x74, 0x45, 0xCD,
+    0xAA, 0xB0, 0x08, 0x0B, 0xD6, 0x39, 0xE1, 0xDC, 0xC1, 0xED, 0xE4, 0x0B, 0x0B, 0x4F, 0x01, 0xCA,
+    0xA8, 0x0C, 0x09, 0xF2, 0xEC, 0xCA, 0x60, 0x3B, 0x77, 0x36, 0xAF, 0x12, 0xA7, 0xAF, 0x62, 0xA1,
+    0xFD, 0x70, 0xE8, 0xF4, 0x6E, 0xFE, 0x81, 0xE9, 0x77, 0xF1, 0xAD, 0x05, 0xA7, 0xF5, 0x81, 0x1A,
+    0xD2, 0x22, 0x2A, 0x10, 0x17, 0x48, 0xDC, 0x24, 0x76, 0x46, 0xAC, 0xE0, 0x0D, 0x8D, 0x1C, 0xE8,
+    0x79, 0x66, 0x5C, 0xE3, 0x0A, 0x04, 0xB0, 0x0C, 0x8C, 0x80, 0xA9, 0x67, 0x8A, 0xBB, 0x33, 0x4A,
+    0x81, 0xCB, 0xD2, 0xED, 0xBD, 0x52, 0x7D, 0x89, 0xE4, 0x3B, 0x0C, 0x9C, 0x1F, 0x23, 0x8F, 0x17,
+    0x90, 0x19, 0x21, 0x5D, 0x13, 0xB9, 0x12, 0xB7, 0xDB, 0xA9, 0xCA, 0xD7, 0x91, 0x6C, 0x0F, 0x28,
+    0xFE, 0x5B, 0x71, 0x0F, 0x72, 0x82, 0x78, 0x08, 0x5B, 0x29, 0x6D, 0x67, 0xA5, 0x79, 0xA9, 0x0E,
+    0x6D, 0x2D, 0x9F, 0x99, 0xE8, 0x37, 0xC4, 0x6D, 0xE5, 0x58, 0xFB, 0x95, 0x0C, 0x21, 0x26, 0xC4,
+    0x75, 0x9B, 0xAE, 0xC6, 0x35, 0x2C, 0x62, 0x6B, 0x43, 0x99, 0x3A, 0x85, 0x5E, 0x9A, 0x95, 0x25,
+    0xB5, 0x3C, 0x9E, 0xF4, 0x71, 0x64, 0x83, 0x93, 0x2C, 0x6C, 0xCB, 0x4E, 0x0A, 0xB4, 0x52, 0x61,
+    0x40, 0x50, 0x57, 0xE6, 0x0D, 0x55, 0x5A, 0x42, 0x17, 0x1B, 0x48, 0x74, 0x64, 0x66, 0x4C, 0x6F,
+    0x94, 0x83, 0x52, 0xFE, 0xE3, 0x2F, 0x3A, 0x1A, 0x34, 0x7C, 0xD9, 0xA5, 0x26, 0x35, 0xEF, 0xF5,
+    0xE5, 0x33, 0x65, 0x11, 0x55, 0xF1, 0xB0, 0xD7, 0xD9, 0x51, 0x97, 0xCF, 0xBB, 0x1E, 0xDC, 0xB2,
+    0x93, 0x34, 0x32, 0x73, 0xC6, 0x8B, 0xB5, 0x70, 0x19, 0x25, 0x51, 0x17, 0xFC, 0x24, 0xFB, 0x31,
+    0xDF, 0x71, 0xDC, 0xB9, 0x89, 0xE4, 0x13, 0x08, 0x6E, 0x4C, 0x9E, 0xA1, 0xAA, 0xB0, 0xC4, 0x6F,
+    0x08, 0x2B, 0xDC, 0x7D, 0xE9, 0xDC, 0x93, 0x2A, 0xB4, 0x15, 0x46, 0x43, 0xA8, 0x5D, 0xC8, 0x71,
+    0x86, 0xEF, 0x4B, 0x74, 0x26, 0x50, 0x6B, 0x5A, 0xEE, 0x59, 0x59, 0xE6, 0x8F, 0x6C, 0x48, 0x8D,
+    0xAF, 0xE9, 0x99, 0x3C, 0x51, 0x61, 0x10, 0x36, 0x3B, 0x10, 0x3F, 0x4D, 0x80, 0xA5, 0xEB, 0x38,
+    0x1B, 0x6B, 0x51, 0x83, 0xC1, 0xD8, 0x15, 0xA2, 0xA1, 0xBC, 0x7D, 0xCA, 0xA5, 0xB2, 0xD0, 0xC8,
+    0x92, 0xDE, 0xA8, 0xD9, 0x04, 0x7D, 0x3A, 0xE4, 0x85, 0x07, 0x79, 0x96, 0x7E, 0xE5, 0xAA, 0x74,
+    0x02, 0xE2, 0x72, 0xC3, 0x52, 0x9A, 0xAE, 0x04, 0x25, 0x45, 0x90, 0xCD, 0x01, 0x85, 0x2B, 0x65,
+    0xE3, 0xDE, 0xB3, 0xE1, 0xEF, 0xF6, 0x94, 0x1C, 0xD7, 0x42, 0x2A, 0x7D, 0x92, 0xDB, 0xBE, 0x90,
+    0xDC, 0x3D, 0xF8, 0x0D, 0x4E, 0x67, 0x2D, 0x87, 0x97, 0xC3, 0xE9, 0xB0, 0xBA, 0x84, 0x1A, 0x21,
+    0xFA, 0xDC, 0x84, 0x66, 0x67, 0x0E, 0x12, 0xBA, 0x4C, 0x9D, 0x4C, 0xD9, 0xBE, 0x4F, 0x4D, 0xF0,
+    0xA7, 0x45, 0x9F, 0xFA, 0x36, 0x2D, 0xCE, 0x09, 0x6F, 0x46, 0x50, 0xEC, 0xA6, 0xCD, 0x66, 0xCD,
+    0x78, 0xB5, 0x57, 0x67, 0x15, 0xD3, 0xD7, 0x28, 0x87, 0xBE, 0x99, 0x1A, 0x21, 0xB2, 0x97, 0x02,
+    0x09, 0xF4, 0x9D, 0xA0, 0xDA, 0xC0, 0x30, 0xCE, 0xAE, 0x88, 0xF9, 0xFA, 0x10, 0x37, 0x48, 0xC7,
+    0x55, 0x82, 0x41, 0x8C, 0xE8, 0x67, 0x83, 0x93, 0x12, 0xE9, 0x0C, 0x64, 0x6C, 0x70, 0x5C, 0xA1,
+    0x9B, 0xA2, 0x1F, 0x1D, 0xE5, 0xA0, 0xEB, 0x44, 0xDB, 0x51, 0xA2, 0xED, 0xD9, 0x65, 0x7F, 0xB9,
+    0xBA, 0xFA, 0xA1, 0x73, 0x3F, 0xAE, 0xB6, 0xEC, 0xCA, 0xB6, 0x93, 0xCF, 0x05, 0xFA, 0xC5, 0xA4,
+    0xDB, 0x0D, 0x53, 0xC1, 0xC6, 0x48, 0x8A, 0x61, 0x30, 0xFE, 0xAC, 0xEC, 0xA4, 0x6A, 0xB3, 0x1C,
+    0xF6, 0x3B, 0x41, 0xD9, 0x94, 0x24, 0x85, 0xAE, 0xB4, 0x41, 0x99, 0x10, 0xFA, 0x19, 0x65, 0x6A,
+    0xB1, 0xBD, 0xF9, 0xDE, 0xF1, 0x3D, 0x6B, 0xF8, 0x33, 0x39, 0xBD, 0xB8, 0x7B, 0x6E, 0x88, 0xC4,
+    0xBC, 0x55, 0x26, 0x56, 0x55, 0x6C, 0xB8, 0x9E, 0xB7, 0x03, 0x7B, 0x45, 0x16, 0xEC, 0xDB, 0x0B,
+    0x1E, 0xDC, 0x67, 0x62, 0xA8, 0x13, 0xB7, 0x0F, 0x66, 0xE2, 0x3C, 0x82, 0xE6, 0x71, 0xD0, 0xA2,
+    0x92, 0x2C, 0x24, 0xFF, 0x85, 0xF9, 0x9F, 0xD0, 0x19, 0x7F, 0x3E, 0x2F, 0x10, 0xD0, 0xED, 0xC2,
+    0xD2, 0x7E, 0xF6, 0xF5, 0x73, 0xE4, 0x1C, 0xDB, 0x59, 0x6E, 0xD2, 0x7F, 0x01, 0x7B, 0xFE, 0x81,
+    0xA8, 0x64, 0xC5, 0xFD, 0x70, 0x5B, 0xD2, 0x3D, 0x98, 0x30, 0x4B, 0x38, 0x56, 0xD8, 0x11, 0xCC,
+    0x13, 0xC4, 0xB7, 0x2C, 0xC4, 0x69, 0xA4, 0xF8, 0x1C, 0x9B, 0x04, 0xBB, 0x81, 0x83, 0xBB, 0x84,
+    0xE6, 0xE9, 0x83, 0xB0, 0x50, 0x05, 0x5C, 0xDE, 0x68, 0xD5, 0x24, 0x76, 0x1E, 0x8C, 0x04, 0xE0,
+    0xFA, 0x63, 0xDD, 0x2A, 0x1D, 0xD1, 0x4F, 0xEF, 0x9E, 0x21, 0x0F, 0xEA, 0xA4, 0x76, 0x5B, 0x6B,
+    0x45, 0x8D, 0x5E, 0x60, 0x85, 0x95, 0x85, 0x87, 0xEC, 0x22, 0x0E, 0x68, 0x70, 0x0A, 0xB8, 0xFE,
+    0x29, 0xF0, 0x97, 0x41, 0xC0, 0x1C, 0x22, 0x59, 0x1E, 0x44, 0x3E, 0x2B, 0x7D, 0x7C, 0x32, 0xBC,
+    0xF0, 0x11, 0x83, 0x94, 0xA7, 0x4D, 0xB8, 0xEF, 0x81, 0x08, 0x9E, 0x6B, 0x2C, 0x32, 0x22, 0x48,
+    0xA6, 0xD5, 0x5B, 0xE9, 0x76, 0x32, 0xFE, 0x70, 0x46, 0x8E, 0x9D, 0x51, 0x65, 0x62, 0x7A, 0xEC,
+    0x2E, 0x2A, 0xCA, 0xB7, 0x0C, 0x5A, 0x59, 0xF4, 0x38, 0xA7, 0xC2, 0xBA, 0x5F, 0x81, 0xD2, 0x89,
+    0x4E, 0x0F, 0x2B, 0xB8, 0xE6, 0x85, 0x5A, 0x42, 0x25, 0x74, 0xE3, 0x37, 0x5F, 0xF3, 0x7A, 0xEB,
+    0x2A, 0xD4, 0x13, 0x2A, 0xC6, 0xFD, 0x3C, 0x3F, 0x2B, 0x43, 0x06, 0xF1, 0xC3, 0xA3, 0xC5, 0xA9,
+    0xCA, 0x64, 0x91, 0xD0, 0x94, 0x3D, 0x2F, 0x85, 0x34, 0xC2, 0x76, 0x20, 0x4B, 0xA6, 0xFC, 0xD3,
+    0x0C, 0x8A, 0x87, 0x68, 0xC2, 0x74, 0x48, 0x75, 0x7B, 0xAE, 0x78, 0x78, 0xA6, 0x71, 0x50, 0x61,
+    0x81, 0x61, 0x96, 0x50, 0x91, 0x0D, 0xBF, 0xA9, 0x0B, 0xDE, 0xDA, 0xCE, 0xF1, 0x3D, 0x83, 0xFD,
+    0xF9, 0xB1, 0x72, 0x6A, 0xCE, 0x01, 0xA7, 0x79, 0x21, 0x5A, 0x40, 0xEC, 0xF8, 0x55, 0xEE, 0x51,
+    0x88, 0x65, 0x6F, 0x87, 0x8A, 0x79, 0x19, 0x1A, 0xC2, 0x76, 0x56, 0x47, 0x1E, 0xA6, 0x46, 0x74,
+    0xF0, 0xD8, 0x92, 0x4D, 0x58, 0xB0, 0x89, 0xCE, 0x0E, 0xCB, 0xC0, 0x3D, 0x74, 0x3A, 0x75, 0xFA,
+    0x1C, 0xFD, 0x6F, 0xAD, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0x66, 0xCC, 0xC5, 0x22, 0x23,
+    0x31, 0x0D, 0x11, 0x12, 0x41, 0xE7, 0x3F, 0x80, 0x0B, 0xA6, 0x4C, 0xB1, 0x7B, 0x36, 0x14, 0xB4,
+    0x6C, 0x91, 0xA5, 0x80, 0x82, 0x9E, 0xE6, 0x5A, 0x8A, 0xCD, 0xED, 0x42, 0x4B, 0x41, 0x1A, 0x6A,
+    0x52, 0x40, 0xC1, 0xA5, 0xD8, 0x26, 0xC5, 0x45, 0x32, 0xE7, 0x81, 0x88, 0xDE, 0x90, 0x92, 0x02,
+    0x2B, 0x29, 0x82, 0x2E, 0x12, 0x19, 0x24, 0x03, 0xBE, 0xBD, 0x59, 0x0F, 0xDF, 0x78, 0x77, 0x4F,
+    0xA7, 0x34, 0xFC, 0xC8, 0x8D, 0xB4, 0xF6, 0xF8, 0xCD, 0xBC, 0x6F, 0xBE, 0x79, 0xEF, 0x7B, 0x6F,
+    0xB5, 0xAF, 0x94, 0xB7, 0x38, 0x1B, 0xA2, 0xAC, 0xE5, 0xE2, 0x08, 0x8D, 0x36, 0x03, 0x41, 0xF3,
+    0x04, 0x48, 0x71, 0xD5, 0x9B, 0xF4, 0xD8, 0xA6, 0x98, 0x28, 0x93, 0x48, 0xAB, 0xCD, 0x74, 0xEE,
+    0x3F, 0xEB, 0x52, 0xF3, 0xF2, 0xC6, 0xC7, 0xC6, 0x40, 0x74, 0x72, 0xC8, 0x87, 0x9F, 0x11, 0x61,
+    0x74, 0x86, 0x95, 0xF3, 0x91, 0x85, 0xC9, 0x92, 0x0F, 0xD5, 0xF2, 0x31, 0x24, 0xA6, 0x7C, 0x50,
+    0x01, 0x5A, 0x1B, 0xE0, 0xE3, 0x84, 0x3E, 0xD5, 0x2E, 0x90, 0xA0, 0x00, 0xEE, 0xBD, 0xD7, 0x10,
+    0xC1, 0xD7, 0x48, 0x0F, 0xE6, 0x06, 0x0D, 0x92, 0x3C, 0x36, 0x74, 0xE7, 0x72, 0x21, 0x3B, 0xA8,
+    0x2E, 0x5B, 0xC2, 0x07, 0xA0, 0x18, 0x6F, 0x8A, 0x66, 0x07, 0x59, 0x07, 0x71, 0x6F, 0x73, 0xD4,
+    0xD5, 0x0E, 0xE9, 0x9D, 0x5A, 0xE7, 0x2E, 0x32, 0xC4, 0xA4, 0x9F, 0xB4, 0xA2, 0x74, 0xB2, 0x9B,
+    0x4B, 0x1B, 0x9B, 0x42, 0x90, 0xBC, 0x8B, 0x17, 0xBE, 0x2D, 0x1F, 0xBA, 0x9E, 0x14, 0x02, 0xF7,
+    0x28, 0x5C, 0x3B, 0x21, 0x17, 0x94, 0xA4, 0x1D, 0xFD, 0xC2, 0xC9, 0xB5, 0x61, 0xB8, 0x8E, 0x23,
+    0xC2, 0x27, 0x5C, 0x1C, 0x46, 0x35, 0x84, 0x55, 0x06, 0xEA, 0x8B, 0xBD, 0x1C, 0x99, 0xEF, 0x20,
+    0x17, 0x07, 0x0E, 0x3A, 0x17, 0x0D, 0x03, 0x13, 0x59, 0x2E, 0x2B, 0x93, 0xD6, 0x28, 0x1F, 0xF9,
+    0x4A, 0x7B, 0x02, 0xC9, 0x9A, 0xEE, 0x6F, 0x04, 0xFC, 0x26, 0xE0, 0x2F, 0x02, 0x59, 0xF7, 0x7F,
+    0x22, 0x1B, 0xCF, 0x10, 0x19, 0x84, 0x6D, 0xFB, 0x23, 0xA8, 0xA6, 0xF7, 0xDF, 0xEA, 0x19, 0x8B,
+    0x8E, 0x74, 0x73, 0xBC, 0xB8, 0xC2, 0xDC, 0xFA, 0x1A, 0xB1, 0x77, 0xD1, 0xC9, 0x87, 0xC6, 0x61,
+    0x90, 0x20, 0xBA, 0x5F, 0x63, 0xE7, 0x26, 0x43, 0xCD, 0xD8, 0x32, 0xA0, 0x21, 0xC4, 0x6E, 0xF5,
+    0xF5, 0x2D, 0x99, 0x10, 0x2D, 0x9B, 0x41, 0xF8, 0xFC, 0x52, 0xCC, 0x28, 0x2B, 0xDF, 0x6E, 0x52,
+    0xA5, 0xC3, 0x3A, 0x2F, 0xC3, 0x48, 0x57, 0x6B, 0xAE, 0xBE, 0x4A, 0xE7, 0x3F, 0x59, 0xFD, 0x39,
+    0xAE, 0x15, 0x61, 0x45, 0xCF, 0xC2, 0xA2, 0x83, 0x6C, 0x10, 0x37, 0x50, 0xDE, 0xC7, 0xD4, 0xCC,
+    0x0D, 0xEE, 0xBB, 0x05, 0x4C, 0x73, 0x68, 0xBA, 0xFF, 0x68, 0x71, 0x37, 0xCA, 0x2F, 0x88, 0xD4,
+    0x10, 0xD2, 0x21, 0x29, 0x60, 0x0F, 0x55, 0xBE, 0x16, 0xE7, 0xB4, 0x51, 0x4F, 0x9A, 0x22, 0x7A,
+    0x64, 0xD4, 0x1E, 0xD0, 0xAE, 0x49, 0x65, 0x01, 0x84, 0xEA, 0x92, 0xDE, 0x7F, 0xE7, 0x1D, 0xAE,
+    0x70, 0x5F, 0xDE, 0x4B, 0x2E, 0xE0, 0xEE, 0x9E, 0x89, 0xFA, 0x02, 0x18, 0x0D, 0x20, 0x5B, 0xA8,
+    0x2A, 0x64, 0xA1, 0x1F, 0xC9, 0x52, 0x2E, 0x96, 0x29, 0x5A, 0x2B, 0x7F, 0x36, 0xE1, 0xA4, 0x15,
+    0x23, 0x83, 0x34, 0x0F, 0x01, 0x29, 0xBD, 0x9D, 0x7A, 0x6C, 0xE5, 0xB8, 0x15, 0xE7, 0xFA, 0x2D,
+    0x8B, 0xFD, 0x09, 0x01, 0x83, 0xD6, 0x2F, 0x2E, 0x6B, 0xD7, 0x23, 0x73, 0x38, 0xC0, 0x9F, 0x15,
+    0xBA, 0x5E, 0x27, 0xFF, 0x21, 0x6B, 0x32, 0xDF, 0x26, 0xDF, 0x84, 0x69, 0xFB, 0x92, 0xC1, 0xF2,
+    0xFC, 0xE9, 0x7C, 0x05, 0xF0, 0xFE, 0x37, 0xA1, 0x00, 0x97, 0x48, 0x7E, 0xD8, 0xB3, 0xD2, 0xA2,
+    0x24, 0x1D, 0x55, 0xA7, 0x84, 0x20, 0x99, 0xF4, 0x6D, 0x8B, 0xB8, 0x2A, 0x20, 0x5A, 0x1A, 0x86,
+    0x34, 0x24, 0xC1, 0x60, 0x78, 0x10, 0xF5, 0x8B, 0x86, 0x06, 0xC7, 0x9A, 0x73, 0xCC, 0x44, 0xDB,
+    0x17, 0xF1, 0xB9, 0x51, 0x7E, 0x4F, 0x77, 0x4B, 0x15, 0x17, 0x03, 0x8A, 0xFE, 0x25, 0xDE, 0xED,
+    0x7E, 0xCE, 0x02, 0x9D, 0x31, 0x08, 0xD0, 0xA7, 0x9E, 0x57, 0xD5, 0x26, 0xAA, 0x64, 0x38, 0xB2,
+    0x60, 0x20, 0x53, 0xB2, 0xA6, 0x69, 0x26, 0x6D, 0x14, 0x0C, 0x05, 0x0D, 0x89, 0x49, 0x8C, 0xEC,
+    0xCA, 0x05, 0xD2, 0x65, 0x56, 0x61, 0xF4, 0x02, 0xEF, 0xFA, 0xD1, 0x57, 0x2B, 0xAE, 0xF1, 0xEF,
+    0x1F, 0x38, 0xEE, 0x50, 0xC1, 0x3B, 0x9D, 0x05, 0xB2, 0x9C, 0xA8, 0x8A, 0x93, 0x9B, 0xAF, 0xFC,
+    0x31, 0x8A, 0x1F, 0x7B, 0x8F, 0xA1, 0x0C, 0xD4, 0x69, 0x99, 0x70, 0xA2, 0x4D, 0xA0, 0xCB, 0x49,
+    0xD6, 0xE3, 0x32, 0x2A, 0xF5, 0x33, 0x7C, 0x15, 0xA3, 0xFF, 0xBA, 0xED, 0x33, 0x70, 0xB9, 0xBC,
+    0x8D, 0x94, 0x4D, 0x8D, 0xDB, 0x5F, 0x9D, 0x1B, 0x26, 0x00, 0xFB, 0xEF, 0xB8, 0xA8, 0x96, 0xBC,
+    0xB2, 0x32, 0x64, 0xCA, 0x20, 0x17, 0x81, 0x68, 0xC6, 0x4F, 0xF2, 0x14, 0x4E, 0xB8, 0x88, 0x34,
+    0xA5, 0x7F, 0xB0, 0xEC, 0x59, 0x8E, 0x47, 0x6C, 0x1B, 0x26, 0xF2, 0xCD, 0x46, 0x88, 0xE3, 0xF1,
+    0x0D, 0x4F, 0xAD, 0x76, 0x07, 0x85, 0x32, 0x92, 0x2E, 0xAF, 0xAD, 0x93, 0x1E, 0x5E, 0x47, 0x73,
+    0xA6, 0xB7, 0xDB, 0x7C, 0xAD, 0x5E, 0xB7, 0x0B, 0x68, 0x65, 0xC4, 0x43, 0xEF, 0x3B, 0xFA, 0xB1,
+    0x55, 0xD7, 0x59, 0xE8, 0xB1, 0x6B, 0xA2, 0x1D, 0xBA, 0x52, 0xCF, 0x76, 0x27, 0x38, 0xAA, 0x85,
+    0x0F, 0xA3, 0x6B, 0xD0, 0x37, 0x25, 0x5E, 0x8C, 0xBC, 0x5B, 0x52, 0x5F, 0x97, 0xF8, 0x40, 0x98,
+    0xD0, 0xA1, 0x35, 0xBB, 0xC7, 0x95, 0xDE, 0x30, 0x1E, 0x8F, 0xDF, 0xF5, 0xDE, 0x25, 0xC7, 0x77,
+    0xC8, 0x62, 0x87, 0x47, 0x98, 0x73, 0xE7, 0x1E, 0x77, 0x54, 0x70, 0x7D, 0x8E, 0x5A, 0x81, 0xCB,
+    0x7C, 0xD9, 0x02, 0xDB, 0xA9, 0xF7, 0x4F, 0x7D, 0xDF, 0x86, 0xAF, 0x8B, 0x59, 0xBB, 0x2D, 0xA8,
+    0xA8, 0x4D, 0x13, 0x2E, 0x6B, 0xFD, 0xC4, 0xB6, 0xD1, 0x63, 0xA3, 0x7E, 0x43, 0xD2, 0xD3, 0x79,
+    0x9A, 0xF7, 0xDD, 0x1B, 0xC2, 0x85, 0x0A, 0xFD, 0x94, 0xDA, 0x5D, 0x1D, 0x4E, 0x41, 0xF6, 0xA2,
+    0xDE, 0x84, 0xE5, 0xB9, 0xD9, 0x3C, 0x5B, 0x9D, 0x69, 0x1B, 0x2D, 0xDC, 0x2E, 0x4E, 0xAC, 0x3C,
+    0xA5, 0xCA, 0xC2, 0x38, 0xAD, 0x42, 0x39, 0x30, 0xF5, 0x53, 0x04, 0xB4, 0xB2, 0x63, 0x75, 0x3E,
+    0x77, 0x0C, 0x86, 0x7D, 0xEF, 0x0C, 0xE5, 0x97, 0xFC, 0xBA, 0xFA, 0x17, 0xF9, 0x97, 0x69, 0x31,
+    0xE2, 0x30, 0x34, 0xF8, 0xA4, 0xEF, 0xEF, 0x6C, 0xE7, 0xB8, 0x84, 0x1D, 0x4C, 0xA8, 0xA4, 0xBF,
+    0xEA, 0x5E, 0x7E, 0xC9, 0x05, 0xE5, 0xE8, 0x9F, 0xC7, 0xDF, 0xAD, 0x55, 0xBF, 0x8F, 0xDC, 0x44,
+    0x14, 0xFE, 0xEC, 0xE1, 0xD6, 0x12, 0x96, 0x32, 0xD7, 0x5C, 0x43, 0x94, 0xB8, 0xA1, 0x40, 0x42,
+    0x3A, 0xA7, 0xA4, 0xD8, 0xAC, 0x7D, 0xE2, 0x0F, 0x20, 0x45, 0x96, 0x96, 0x86, 0x06, 0x51, 0xA4,
+    0xA5, 0x58, 0xCE, 0x96, 0x28, 0x28, 0x49, 0xEA, 0x14, 0x44, 0x22, 0x0D, 0x50, 0x24, 0xE5, 0x22,
+    0x2D, 0xE7, 0x51, 0x28, 0xD2, 0x3A, 0x7F, 0x01, 0x83, 0xF8, 0x55, 0x9E, 0x25, 0x8C, 0xF0, 0x1D,
+    0x6B, 0x3F, 0xBE, 0x19, 0x6F, 0xA2, 0x3D, 0x92, 0x83, 0x80, 0x6E, 0xAC, 0xF1, 0xCE, 0x3E, 0xBF,
+    0x79, 0xEF, 0xFB, 0xDE, 0x9B, 0xF7, 0x06, 0xC0, 0x5B, 0x91, 0x69, 0xA7, 0xF8, 0xA3, 0x0E, 0x06,
+    0x04, 0x0D, 0xFC, 0x08, 0xA5, 0xCC, 0x1E, 0x7C, 0x67, 0xF5, 0xE7, 0x48, 0x97, 0x28, 0xC4, 0x8D,
+    0x6F, 0x81, 0x0E, 0x61, 0x83, 0xA8, 0x41, 0x2C, 0x43, 0x2C, 0x16, 0x37, 0xA9, 0x78, 0x8F, 0xBA,
+    0x6B, 0x50, 0x02, 0x24, 0xB1, 0xC1, 0x34, 0x34, 0x7E, 0x7F, 0xF0, 0x65, 0xCE, 0x6D, 0x5D, 0x38,
+    0xBC, 0xDB, 0xC5, 0x35, 0x96, 0x49, 0x8E, 0x8F, 0x66, 0xC0, 0xB5, 0x8F, 0xF9, 0x69, 0xB5, 0x99,
+    0x6B, 0x3F, 0x33, 0x59, 0xE1, 0xB5, 0x9E, 0xB6, 0x17, 0x05, 0x67, 0x56, 0x62, 0x91, 0x58, 0x2C,
+    0x22, 0x91, 0x35, 0x2A, 0x69, 0x11, 0xD0, 0x87, 0xCE, 0x01, 0x9A, 0x8F, 0x8E, 0x81, 0xE9, 0x0C,
+    0x61, 0x3D, 0xC5, 0xD3, 0x91, 0xC9, 0x5A, 0x9D, 0x0E, 0xCD, 0x8C, 0xC0, 0xDA, 0xA0, 0x51, 0x75,
+    0x64, 0x74, 0x9E, 0x22, 0x3D, 0xE8, 0xF8, 0xA5, 0x0C, 0x7F, 0xB9, 0x0D, 0x4D, 0xA5, 0xEB, 0x9C,
+    0x22, 0x6D, 0xC8, 0x99, 0x20, 0xB2, 0x44, 0xFF, 0x29, 0x71, 0xEA, 0x3A, 0xB6, 0x89, 0xF4, 0x88,
+    0x87, 0x7C, 0xB4, 0x35, 0x0D, 0x0C, 0xB2, 0xBB, 0x25, 0xF4, 0x40, 0xF4, 0x37, 0x70, 0xE1, 0x2C,
+    0x38, 0x5E, 0xC5, 0x35, 0xCC, 0x22, 0x83, 0x82, 0x9B, 0xF6, 0xCB, 0x8B, 0x67, 0xC1, 0x19, 0xB6,
+    0x80, 0xEA, 0xF0, 0x2C, 0x8F, 0x17, 0x9E, 0x0B, 0x2A, 0x1E, 0x8D, 0x6E, 0x82, 0xFC, 0x99, 0x07,
+    0x2D, 0x82, 0xA1, 0x5A, 0xE9, 0x72, 0x46, 0x9C, 0x8B, 0x91, 0x45, 0x6C, 0xE2, 0xFA, 0x90, 0x5F,
+    0x2C, 0xBE, 0xB9, 0x0F, 0x65, 0xC6, 0x34, 0x66, 0xC4, 0x5A, 0x49, 0x1F, 0x99, 0xA0, 0x9B, 0x22,
+    0xFC, 0xA1, 0x81, 0x56, 0x6D, 0xD8, 0xD1, 0x43, 0x1E, 0xCA, 0xED, 0x0B, 0x8E, 0xF7, 0xFB, 0x1B,
+    0x6D, 0xB7, 0x6B, 0xC9, 0xD9, 0x8C, 0x11, 0x72, 0xE3, 0xD2, 0xF8, 0x37, 0x2E, 0xC7, 0xB8, 0x76,
+    0x67, 0x08, 0x29, 0x11, 0x93, 0x3D, 0x38, 0x56, 0x56, 0x97, 0x3A, 0x4F, 0x46, 0x42, 0x61, 0x13,
+    0xB6, 0x49, 0xA9, 0xA4, 0xC3, 0xFE, 0x07, 0x7E, 0xAB, 0xAA, 0x3D, 0xEB, 0x3C, 0x15, 0x39, 0x68,
+    0x70, 0xC8, 0xB0, 0x2C, 0x17, 0x64, 0xD9, 0xE3, 0x28, 0x10, 0xA9, 0x51, 0xFD, 0xB4, 0x01, 0xE0,
+    0x72, 0x81, 0x19, 0x5F, 0xCA, 0xD2, 0xC3, 0x15, 0xD4, 0xDE, 0xC5, 0xCE, 0x3C, 0xDF, 0x99, 0x17,
+    0x82, 0x62, 0x48, 0x6A, 0xBC, 0x57, 0xA6, 0x54, 0x71, 0x30, 0x3B, 0x56, 0x97, 0xB2, 0xAC, 0x22,
+    0x3D, 0x8A, 0x2A, 0x61, 0x2C, 0x58, 0x79, 0x5B, 0xA2, 0xE7, 0xB5, 0x58, 0xA9, 0x93, 0xC1, 0xDB,
+    0x82, 0x3B, 0xB5, 0x29, 0x39, 0x45, 0x83, 0xE3, 0x47, 0x7F, 0x53, 0xF5, 0xF4, 0x94, 0xED, 0xBA,
+    0xE3, 0x43, 0x7E, 0x49, 0x8B, 0x31, 0x13, 0x38, 0xBB, 0x48, 0x7A, 0xE0, 0x4F, 0x61, 0x3E, 0x2C,
+    0x0D, 0xB4, 0x8C, 0x9B, 0xCE, 0xE9, 0xA1, 0xA5, 0xBF, 0x17, 0x2F, 0x26, 0x43, 0x30, 0x1C, 0x48,
+    0x53, 0xAC, 0xF7, 0xE6, 0xD8, 0x9B, 0x6B, 0x31, 0x89, 0x94, 0x45, 0x1E, 0x1C, 0xC2, 0xE3, 0x7A,
+    0xF3, 0xF4, 0xAB, 0xAF, 0x4F, 0x13, 0xD7, 0x34, 0x8C, 0x47, 0xED, 0x85, 0x9E, 0x89, 0xE7, 0x84,
+    0x2D, 0xA1, 0xE3, 0xE2, 0x59, 0x6D, 0x09, 0xE3, 0x01, 0x97, 0x4F, 0x46, 0x9B, 0x2E, 0x63, 0x9A,
+    0x08, 0x27, 0xFD, 0x06, 0xEE, 0x87, 0xA7, 0x39, 0x12, 0x46, 0xD8, 0x27, 0x4E, 0x4F, 0x78, 0xB4,
+    0xBE, 0x17, 0x03, 0xB9, 0xDB, 0x22, 0xE3, 0x76, 0x07, 0x4D, 0xD5, 0x34, 0xEA, 0x70, 0x5E, 0xA7,
+    0xC9, 0x6D, 0x41, 0x50, 0x95, 0xC5, 0x1D, 0x87, 0x79, 0x27, 0xD0, 0xCD, 0xAF, 0xC7, 0xDD, 0x93,
+    0x35, 0x5E, 0x61, 0xD6, 0xE7, 0x37, 0x78, 0x20, 0x9D, 0x7E, 0x4A, 0xEF, 0xD4, 0x7C, 0xD1, 0xA2,
+    0xB2, 0x3C, 0xB8, 0x48, 0x1E, 0x7D, 0x36, 0xFC, 0xF6, 0xB8, 0xDB, 0x7D, 0xDD, 0x87, 0xF4, 0x56,
+    0x59, 0x58, 0xC2, 0xA6, 0xD3, 0x52, 0x9D, 0x59, 0x54, 0x77, 0xA4, 0xDB, 0x61, 0x4C, 0x7E, 0x94,
+    0x76, 0x4C, 0xF6, 0xDB, 0xAC, 0xD9, 0xFA, 0x1C, 0xCB, 0xE3, 0x22, 0x94, 0x4F, 0xA4, 0xAD, 0x24,
+    0x93, 0xB1, 0x7B, 0x62, 0xD2, 0x31, 0x87, 0x7F, 0xB7, 0xEB, 0x16, 0xF1, 0x09, 0x83, 0xB2, 0x8B,
+    0xAB, 0xF8, 0xE2, 0xF7, 0xB6, 0xE8, 0x5C, 0x9F, 0xFA, 0x0F, 0xF8, 0x1F, 0xAA, 0x3E, 0x29, 0xD6,
+    0xF1, 0x3D, 0xE7, 0xE1, 0xB2, 0x2D, 0xAC, 0x7A, 0xEE, 0x89, 0x4F, 0x8A, 0x61, 0x7E, 0x53, 0xFA,
+    0xC4, 0x95, 0xEF, 0x39, 0x4F, 0xDA, 0xD1, 0x5F, 0x79, 0x95, 0x70, 0xD2, 0xFB, 0xDA, 0x33, 0x8C,
+    0x6C, 0xDC, 0x44, 0x76, 0x44, 0x7E, 0xBE, 0x5D, 0xB4, 0xCA, 0x44, 0x46, 0xFD, 0x1C, 0xB8, 0x06,
+    0x0B, 0x5D, 0xB3, 0x77, 0x79, 0xB6, 0x2F, 0xE3, 0xEF, 0x9F, 0xF1, 0xEE, 0xCD, 0x33, 0x79, 0x47,
+    0x9E, 0xF4, 0x41, 0x91, 0x3B, 0xC6, 0x3E, 0xA0, 0x8E, 0xB5, 0x0B, 0xC0, 0xCB, 0x09, 0xD2, 0x4E,
+    0x35, 0x99, 0xE4, 0xDD, 0xA6, 0xD1, 0xF2, 0x28, 0x22, 0x61, 0xE9, 0xDC, 0x32, 0x63, 0x41, 0x6D,
+    0xC6, 0x21, 0x56, 0x71, 0xA3, 0xD9, 0xD5, 0xD6, 0x5B, 0xCD, 0xF5, 0x28, 0x5C, 0x17, 0xB6, 0x32,
+    0x33, 0x2C, 0x94, 0x8D, 0xCE, 0xFD, 0x89, 0x4F, 0xA2, 0xC7, 0x62, 0x17, 0x8C, 0x95, 0xF1, 0x1D,
+    0x49, 0x97, 0xEE, 0x1E, 0x75, 0x37, 0xE7, 0x3E, 0xF0, 0x06, 0xCB, 0x2E, 0x14, 0xB3, 0x9C, 0x5D,
+    0x72, 0xD7, 0x29, 0x9B, 0x83, 0xF4, 0x41, 0xEF, 0x4A, 0x61, 0xF5, 0x2F, 0x2F, 0x6D, 0x78, 0x2C,
+    0xDC, 0x75, 0x40, 0x43, 0x47, 0xF8, 0x7F, 0xE3, 0x2F, 0xBD, 0x55, 0x31, 0x6F, 0xE4, 0x44, 0x14,
+    0xFE, 0x3C, 0xC3, 0x66, 0xD1, 0x59, 0xCA, 0xA4, 0xB8, 0x02, 0xB4, 0x02, 0xB7, 0x14, 0x49, 0xDC,
+    0x22, 0x94, 0xC4, 0xA3, 0xA4, 0xA1, 0x3B, 0x8A, 0xAC, 0x68, 0xA9, 0x91, 0xD0, 0xF2, 0x03, 0x72,
+    0xB1, 0x7B, 0x1A, 0xF8, 0x07, 0xFC, 0x01, 0xBA, 0x14, 0x14, 0xDE, 0xD8, 0x97, 0x26, 0xC5, 0x15,
+    0xCC, 0x85, 0xF2, 0x8A, 0x33, 0x12, 0x05, 0xA2, 0x39, 0x23, 0x59, 0xC2, 0xB9, 0xF3, 0x7A, 0xF8,
+    0x9E, 0x1D, 0x2E, 0xC0, 0x91, 0xDC, 0xA1, 0x93, 0xF0, 0xEE, 0x8C, 0xED, 0xEF, 0x3D, 0xBF, 0xF7,
+    0xE6, 0x9B, 0xF7, 0xDE, 0xE0, 0x08, 0xA6, 0x56, 0x4F, 0xB3, 0xA3, 0x1D, 0x13, 0x54, 0x90, 0x2B,
+    0x2E, 0xC3, 0x0E, 0x61, 0x89, 0x23, 0x4C, 0x6F, 0x9A, 0x28, 0x6D, 0x91, 0x52, 0x53, 0x55, 0x98,
+    0x1F, 0x4E, 0xE6, 0xC6, 0x97, 0xBE, 0x89, 0x9C, 0x6A, 0x91, 0xE3, 0x3E, 0xA5, 0xB1, 0x45, 0x1E,
+    0x3A, 0x84, 0x67, 0x35, 0x90, 0x77, 0x40, 0xE8, 0x69, 0xB7, 0xE0, 0x4B, 0xF8, 0xA4, 0x24, 0x92,
+    0xF2, 0xE1, 0x8C, 0x70, 0x1E, 0xD6, 0xA2, 0x5C, 0xF2, 0xAB, 0xC2, 0xC6, 0xAD, 0xEA, 0x69, 0x67,
+    0x4A, 0x1C, 0x13, 0xE0, 0x0E, 0x6F, 0x41, 0xC3, 0xC9, 0x58, 0x4E, 0xFC, 0x14, 0xDB, 0x82, 0xC8,
+    0x0B, 0x07, 0xED, 0x0D, 0x8A, 0xC4, 0x35, 0x2D, 0x1A, 0x3E, 0xEE, 0xC8, 0x6B, 0xB2, 0xD2, 0x65,
+    0x51, 0x19, 0x46, 0xB7, 0x13, 0x65, 0xF8, 0xAD, 0x81, 0x7E, 0x4A, 0xE9, 0x31, 0xA5, 0xF7, 0x29,
+    0x5D, 0x52, 0x79, 0x45, 0xE5, 0x3E, 0x38, 0xB5, 0x7D, 0xE4, 0xC5, 0x0A, 0x3E, 0xC1, 0x1A, 0xE7,
+    0x84, 0xE3, 0x08, 0xE0, 0x72, 0x06, 0x5B, 0x1B, 0x03, 0x11, 0x98, 0xB9, 0xA2, 0x4D, 0xDD, 0xA2,
+    0xD1, 0x2E, 0x86, 0x76, 0x39, 0xF4, 0x45, 0x4D, 0x83, 0x25, 0xB4, 0xCF, 0xA0, 0x1F, 0x57, 0xD0,
+    0x3F, 0xD2, 0x81, 0xEB, 0x39, 0x92, 0x2C, 0x6C, 0x4C, 0x9D, 0x74, 0xAA, 0x1B, 0xBE, 0x7E, 0x1B,
+    0x42, 0x91, 0xEE, 0x10, 0xF4, 0xC0, 0x3B, 0xA3, 0xB1, 0xF9, 0x21, 0x8C, 0x77, 0x88, 0x1C, 0xD7,
+    0x3D, 0x88, 0x5F, 0x71, 0x5B, 0xE7, 0xAD, 0xCE, 0xB1, 0x1D, 0x7B, 0xFF, 0xC4, 0x7B, 0xB1, 0xBB,
+    0xA9, 0xBA, 0xB8, 0xF9, 0x68, 0x60, 0x20, 0x76, 0x0B, 0xA7, 0x6F, 0xFD, 0xCD, 0x2E, 0x8B, 0xFE,
+    0xCD, 0x5D, 0x22, 0xF8, 0x7A, 0x20, 0x27, 0x20, 0xD1, 0xD1, 0xC8, 0xF5, 0xC6, 0xEB, 0xFB, 0x27,
+    0xA1, 0x99, 0xAE, 0x54, 0xA5, 0xDD, 0x34, 0x9B, 0x8C, 0x2C, 0x04, 0xD5, 0xFC, 0x30, 0x32, 0xFE,
+    0xA2, 0x8A, 0xDC, 0x26, 0x72, 0x95, 0x85, 0xE5, 0xC6, 0x7F, 0x0C, 0xCA, 0xEE, 0xAF, 0xCC, 0xC2,
+    0xD5, 0xBB, 0xEF, 0xEB, 0x47, 0x6E, 0x77, 0x53, 0x3B, 0xBB, 0x4B, 0xFE, 0xF1, 0xEF, 0xD3, 0xEC,
+    0x32, 0xF4, 0xD5, 0x0D, 0x2C, 0xDC, 0xA1, 0xFB, 0x96, 0xD9, 0x97, 0xE5, 0xF8, 0xF6, 0x76, 0x87,
+    0x88, 0x1D, 0x16, 0x4E, 0x2C, 0xBE, 0xF4, 0xFF, 0x50, 0xBB, 0x53, 0xED, 0x96, 0xDA, 0xDD, 0xFD,
+    0x87, 0x68, 0x76, 0x09, 0xAE, 0x7F, 0x32, 0xB7, 0x83, 0xEF, 0x60, 0x85, 0xC1, 0xC1, 0xF5, 0xB8,
+    0x0B, 0x2C, 0x5B, 0xD6, 0xC4, 0x28, 0x8B, 0xC9, 0xF5, 0x07, 0xD7, 0xF2, 0x75, 0x0E, 0xC3, 0xB1,
+    0xAD, 0xBC, 0x5F, 0x19, 0x89, 0x61, 0x83, 0x05, 0x32, 0x6B, 0xA4, 0x16, 0xFE, 0x9C, 0x3E, 0xC6,
+    0xF3, 0xD2, 0x54, 0x01, 0xCB, 0xD0, 0xC6, 0x8D, 0xBE, 0x77, 0x2D, 0xB0, 0x6B, 0xFD, 0xBE, 0xA7,
+    0x69, 0x25, 0x74, 0x33, 0xEB, 0x11, 0x4A, 0xF1, 0x70, 0x2F, 0xA0, 0xEC, 0xB8, 0x07, 0x93, 0x43,
+    0x06, 0x96, 0x36, 0x48, 0xFA, 0xA8, 0x46, 0x94, 0xC5, 0x15, 0xB6, 0x24, 0x90, 0x13, 0xF5, 0xB8,
+    0x54, 0x2E, 0xBC, 0x57, 0x86, 0x76, 0x2B, 0xCA, 0xB6, 0x70, 0x12, 0x13, 0x72, 0x09, 0x21, 0x7B,
+    0x4C, 0x08, 0x4B, 0x42, 0xE8, 0x08, 0xE1, 0x19, 0xA1, 0xC0, 0x13, 0xD2, 0x2B, 0xD5, 0x5B, 0xDD,
+    0x24, 0x1E, 0x53, 0xB2, 0x8B, 0xB7, 0x46, 0xFB, 0x98, 0x66, 0x4C, 0x15, 0x7A, 0x55, 0xF5, 0x98,
+    0x39, 0xF8, 0x12, 0x2F, 0xAE, 0xD9, 0x99, 0xCF, 0xA2, 0xE7, 0xBE, 0x41, 0x9A, 0xA5, 0x30, 0xDC,
+    0x7F, 0x5D, 0x51, 0xA5, 0x65, 0xF5, 0xED, 0x31, 0xC3, 0x4C, 0x36, 0xFD, 0x3B, 0x10, 0x57, 0xE6,
+    0x97, 0x84, 0x1C, 0x80, 0x4C, 0xCE, 0x3F, 0xF5, 0x56, 0xFB, 0x9F, 0x3C, 0x02, 0xB6, 0x0A, 0x30,
+    0xAE, 0x15, 0x18, 0x57, 0xCE, 0xE8, 0x4F, 0x3A, 0x86, 0xFA, 0xA8, 0x25, 0xB4, 0x5F, 0x13, 0xD2,
+    0x35, 0xA1, 0x69, 0xC5, 0x50, 0xC3, 0x0B, 0x86, 0x6A, 0x1E, 0x32, 0x54, 0xF3, 0x1D, 0xA3, 0x8F,
+    0x1A, 0x46, 0x9F, 0xB8, 0xF8, 0x67, 0x24, 0x07, 0xBE, 0x1E, 0xD8, 0x91, 0x6E, 0xF2, 0xAE, 0xDC,
+    0x25, 0xDD, 0x87, 0x60, 0xC3, 0xEC, 0xAA, 0x9B, 0xE0, 0x8A, 0xAF, 0xB5, 0xBA, 0xA8, 0xA6, 0xBD,
+    0x5F, 0x21, 0xAA, 0x22, 0x46, 0xA7, 0x6E, 0x09, 0x57, 0x80, 0xB0, 0xD5, 0xCF, 0x8C, 0x3F, 0xF0,
+    0xE5, 0xF8, 0xB1, 0x1D, 0x79, 0x90, 0xF6, 0x22, 0x25, 0x34, 0xF4, 0x97, 0x40, 0x24, 0x9F, 0xA9,
+    0x92, 0x0E, 0xF7, 0x28, 0xFE, 0x9D, 0x6D, 0x47, 0x0D, 0x3B, 0x54, 0xFF, 0x3F, 0x3B, 0xF4, 0x1E,
+    0x55, 0xF4, 0x03, 0x7A, 0x5D, 0x4A, 0x4F, 0x96, 0x2E, 0xFB, 0xFD, 0x9B, 0xEF, 0xD0, 0x58, 0xE1,
+    0xCB, 0x61, 0x6E, 0x65, 0xD2, 0xC3, 0x79, 0x32, 0xF4, 0xEF, 0x91, 0x4F, 0xE5, 0x66, 0xE7, 0xDE,
+    0xAE, 0x2B, 0x9F, 0x7A, 0x82, 0x69, 0x76, 0x3C, 0x68, 0x92, 0x78, 0xED, 0x64, 0xE5, 0xC6, 0x4A,
+    0x01, 0xEE, 0x22, 0x26, 0xDC, 0x48, 0x29, 0xBC, 0x04, 0xAB, 0x3E, 0xE8, 0x2D, 0x92, 0xEE, 0x95,
+    0xF9, 0xD0, 0x4A, 0x3E, 0x34, 0x2F, 0xF2, 0xA1, 0x92, 0x7C, 0x70, 0x92, 0x0F, 0x67, 0x92, 0x0F,
+    0x5F, 0x49, 0x3E, 0x7C, 0x71, 0x43, 0x3E, 0xD0, 0xE3, 0x1A, 0x0F, 0x39, 0xEC, 0x49, 0x74, 0x5E,
+    0x36, 0xE4, 0x74, 0xE4, 0x65, 0x11, 0xF6, 0x92, 0x05, 0x41, 0x1F, 0x74, 0x92, 0x04, 0x42, 0x84,
+    0xAC, 0x9F, 0x3C, 0x08, 0x1F, 0x7F, 0x79, 0x0D, 0xDB, 0xA0, 0xF6, 0x8D, 0xD8, 0x88, 0xC6, 0x92,
+    0x16, 0x22, 0xD2, 0xB1, 0x10, 0x79, 0x88, 0x4D, 0xE6, 0x44, 0xA4, 0x42, 0x13, 0x6F, 0xAF, 0x59,
+    0xC7, 0xE7, 0xEC, 0xB4, 0x85, 0xAF, 0x90, 0x7C, 0x53, 0x94, 0xC6, 0xA1, 0x50, 0x3C, 0x5B, 0x1A,
+    0xB6, 0xDE, 0xE8, 0x9C, 0x1B, 0xD7, 0xD1, 0x8A, 0x79, 0x58, 0x5E, 0x9D, 0xA6, 0x3F, 0xC8, 0x03,
+    0x89, 0x36, 0xE7, 0x34, 0xDC, 0x52, 0x27, 0x3E, 0x68, 0x59, 0x70, 0x6C, 0x07, 0x1D, 0xD2, 0x5F,
+    0xBD, 0xD8, 0x61, 0x0E, 0xCF, 0xF1, 0x3A, 0xD7, 0x1F, 0xB5, 0x55, 0x3D, 0x6F, 0x1C, 0x45, 0x18,
+    0x7E, 0x76, 0x47, 0x66, 0x49, 0x16, 0x31, 0x2E, 0x62, 0x05, 0x61, 0xA1, 0xA5, 0xA0, 0xA0, 0x89,
+    0xB7, 0x49, 0x91, 0xE2, 0x7C, 0x3B, 0x4A, 0x8A, 0xB4, 0x2E, 0x70, 0x43, 0x8A, 0xB4, 0x09, 0x05,
+    0x49, 0x91, 0x82, 0xE2, 0x9C, 0x5B, 0xC8, 0x1F, 0x30, 0x35, 0x8D, 0x1B, 0x0A, 0xEC, 0xC2, 0x94,
+    0x14, 0x6B, 0xEF, 0x38, 0x2E, 0x5C, 0xB8, 0xC8, 0x4A, 0x11, 0x15, 0x05, 0x4B, 0x91, 0x18, 0x85,
+    0xC2, 0x83, 0xB4, 0x89, 0x16, 0x7B, 0xEE, 0x86, 0x67, 0xF6, 0xEE, 0x12, 0x89, 0x08, 0xC9, 0x09,
+    0x62, 0x77, 0xE7, 0x74, 0xF3, 0xCE, 0xFB, 0xF1, 0xBC, 0x9F, 0x23, 0x5C, 0x13, 0x3A, 0x8B, 0x57,
+    0xCF, 0xB0, 0x85, 0x2B, 0xAB, 0x22, 0xB0, 0x03, 0xA4, 0x77, 0x20, 0x8E, 0x73, 0xB8, 0x1A, 0x59,
+    0x0B, 0x59, 0x42, 0xFC, 0x51, 0xC1, 0x58, 0xB4, 0xE9, 0x53, 0x1B, 0xB8, 0x16, 0x73, 0x2B, 0xC0,
+    0x3C, 0x25, 0xA2, 0xFC, 0x53, 0x20, 0xBB, 0xA9, 0x10, 0x90, 0x13, 0xC1, 0xCA, 0x54, 0xD1, 0x3B,
+    0x3F, 0x00, 0xB1, 0x1B, 0x43, 0xFC, 0xB5, 0x68, 0x31, 0x42, 0x6C, 0x52, 0x85, 0xEC, 0x9A, 0x41,
+    0x60, 0xD7, 0x00, 0x79, 0xA8, 0x01, 0x5B, 0x90, 0xE3, 0x11, 0xFF, 0x14, 0x04, 0x10, 0x1F, 0x56,
+    0xA4, 0xDC, 0xE7, 0xD1, 0x03, 0x83, 0xB0, 0xC9, 0x72, 0x64, 0x18, 0x23, 0xD1, 0xD1, 0x78, 0xDB,
+    0x50, 0x4F, 0x8B, 0xCE, 0x1E, 0x9F, 0x40, 0x9F, 0xC3, 0x5A, 0x0C, 0xE9, 0x72, 0x7C, 0xA9, 0xA6,
+    0xB6, 0x22, 0x97, 0xCB, 0xD3, 0x51, 0xAC, 0x93, 0x03, 0x1D, 0xBE, 0x30, 0xE8, 0x13, 0x2E, 0x0D,
+    0x93, 0xE3, 0x94, 0x9B, 0x1D, 0x48, 0xA9, 0xE5, 0x37, 0xE3, 0x3B, 0x3A, 0x21, 0x65, 0x75, 0xE6,
+    0xE8, 0xF9, 0xA0, 0x82, 0x30, 0x34, 0x38, 0x4A, 0x34, 0xB2, 0xA8, 0x86, 0x50, 0x1B, 0xD3, 0xA3,
+    0x2F, 0xD6, 0x81, 0xD2, 0xBB, 0xFD, 0x6D, 0xA9, 0x65, 0x85, 0x32, 0x6C, 0x20, 0x9A, 0x0C, 0x48,
+    0x0E, 0xAA, 0x09, 0xEA, 0x0E, 0x7E, 0x87, 0xBA, 0x83, 0xBF, 0x43, 0xCA, 0x01, 0x7D, 0x6F, 0xC9,
+    0x93, 0x5E, 0x6B, 0xA9, 0x56, 0xD6, 0x81, 0xC5, 0xF0, 0x99, 0xF3, 0x7A, 0x72, 0xCC, 0x8C, 0xC6,
+    0x91, 0x12, 0xFB, 0xB5, 0xF8, 0xCD, 0x04, 0xA6, 0xC1, 0x8F, 0x97, 0xA7, 0xD6, 0x18, 0x36, 0x31,
+    0x76, 0x57, 0x4D, 0xF4, 0xA7, 0xC1, 0x4E, 0x01, 0xB9, 0xDB, 0x21, 0xA7, 0xF9, 0xBE, 0x85, 0xDC,
+    0xA6, 0x84, 0x11, 0x75, 0xF9, 0x9D, 0x89, 0x48, 0x59, 0xF0, 0x0E, 0xAF, 0xAE, 0xAE, 0x2A, 0xAA,
+    0x75, 0x2E, 0x4F, 0x9F, 0x0C, 0x37, 0x77, 0xC3, 0x16, 0x2D, 0xAE, 0x24, 0x4A, 0xD4, 0xA8, 0x28,
+    0x90, 0x23, 0xAA, 0xD0, 0x27, 0x0E, 0xC2, 0x21, 0x34, 0x88, 0x13, 0x27, 0x0C, 0xA3, 0x65, 0xA5,
+    0x7E, 0x45, 0x5E, 0x03, 0xB9, 0xD1, 0x71, 0x3F, 0x6C, 0x49, 0x8E, 0xC5, 0x88, 0xE4, 0x5E, 0xE8,
+    0xB6, 0x9C, 0x33, 0x13, 0xDD, 0x08, 0xD4, 0xCB, 0x9A, 0x28, 0x1B, 0x86, 0x73, 0x5C, 0xDE, 0x3C,
+    0xAE, 0xDB, 0xD0, 0xA9, 0xC1, 0x00, 0x99, 0x96, 0xDB, 0x88, 0xEA, 0xAE, 0x3A, 0xDC, 0x29, 0x03,
+    0xE5, 0x46, 0x0C, 0x39, 0xF3, 0xEB, 0x8D, 0xC7, 0x3A, 0xB4, 0xCC, 0x72, 0xE0, 0x34, 0xD2, 0xA7,
+    0xA7, 0xCE, 0x5D, 0x75, 0x4D, 0xEA, 0xF2, 0x39, 0x85, 0x0B, 0x54, 0xE5, 0x73, 0x58, 0x78, 0x9F,
+    0xB9, 0x46, 0xD3, 0xBD, 0x7F, 0x3E, 0xFF, 0x9E, 0x5E, 0xBB, 0x06, 0xC9, 0x5E, 0xA9, 0x42, 0x43,
+    0xC4, 0x05, 0xDF, 0x94, 0x6F, 0xAC, 0xA9, 0xCF, 0x88, 0x0A, 0x45, 0x5C, 0x23, 0x75, 0x54, 0x4F,
+    0xBD, 0x21, 0xCB, 0x10, 0x45, 0x92, 0x23, 0xA5, 0xF7, 0xB1, 0xCE, 0xBC, 0x48, 0x1B, 0x8E, 0xF3,
+    0xE1, 0x03, 0xD7, 0x08, 0x5F, 0xCD, 0x17, 0x3A, 0xA5, 0x42, 0x83, 0x5E, 0xB3, 0xEE, 0x96, 0x81,
+    0xBB, 0x53, 0x43, 0x8B, 0x0F, 0xED, 0xF0, 0xD0, 0x46, 0xE3, 0x5B, 0xA2, 0xF1, 0x41, 0x78, 0xFD,
+    0x5B, 0x3C, 0x51, 0x43, 0xC2, 0xDD, 0x5C, 0xA1, 0x57, 0x4E, 0x05, 0x76, 0xB1, 0x21, 0x8A, 0x6C,
+    0x8A, 0x23, 0x9C, 0x01, 0x5B, 0x26, 0x61, 0x17, 0xA1, 0xA3, 0x0F, 0x25, 0x0D, 0xA6, 0xB4, 0x13,
+    0xEF, 0xB5, 0x04, 0x96, 0xE6, 0x28, 0x44, 0x27, 0x92, 0xA7, 0xBF, 0x47, 0x6D, 0xE6, 0x54, 0xC6,
+    0x12, 0x61, 0x30, 0xCF, 0x7B, 0x40, 0x66, 0xE2, 0x3E, 0x96, 0xB8, 0xA4, 0xCF, 0xFD, 0x1B, 0x81,
+    0x22, 0x67, 0x98, 0x7B, 0x25, 0x84, 0x11, 0xD6, 0x88, 0x34, 0xE6, 0x58, 0xC7, 0xB8, 0x42, 0x0E,
+    0xF6, 0x54, 0x9F, 0x4B, 0xF8, 0x98, 0x2E, 0xFF, 0x8F, 0x31, 0xFD, 0x28, 0xA8, 0xE5, 0x75, 0x1D,
+    0xFD, 0xDA, 0x65, 0xAF, 0xC0, 0x1B, 0xC2, 0xCF, 0xFD, 0x26, 0xAD, 0x30, 0x56, 0x58, 0xEF, 0x24,
+    0x6F, 0xAB, 0xC8, 0xD9, 0xE4, 0xE7, 0xA2, 0x8F, 0xDE, 0xB2, 0xFF, 0x2E, 0x67, 0x0A, 0x69, 0x8D,
+    0x78, 0xCC, 0x0A, 0xA9, 0x90, 0x34, 0x08, 0xED, 0xC7, 0x58, 0x33, 0x58, 0x6E, 0xB0, 0x66, 0x61,
+    0xCB, 0x2D, 0x93, 0x3A, 0x1D, 0x7C, 0xD6, 0xC9, 0x1A, 0x74, 0x45, 0xDF, 0xE2, 0xFD, 0xD9, 0x10,
+    0xF8, 0xFA, 0xF9, 0x4E, 0x2F, 0x7C, 0xAC, 0xDF, 0x23, 0x76, 0xA7, 0x62, 0x7E, 0x76, 0x3E, 0x3E,
+    0xC2, 0xD2, 0x57, 0xE1, 0xD1, 0x93, 0x22, 0x73, 0x58, 0x00, 0x3E, 0xE0, 0x80, 0x53, 0xC1, 0x69,
+    0x15, 0xED, 0x99, 0x78, 0x52, 0x12, 0x6F, 0x8D, 0x80, 0x39, 0xAE, 0xA2, 0x63, 0x34, 0x3F, 0x5D,
+    0x62, 0x99, 0x4D, 0x26, 0x67, 0x72, 0xE3, 0xB1, 0xBE, 0xD4, 0xC3, 0x3E, 0x8F, 0x1A, 0x36, 0x0D,
+    0xCA, 0x3D, 0xEC, 0xDE, 0x0D, 0x8F, 0xF2, 0xA5, 0xFB, 0x37, 0xF6, 0x9D, 0xF1, 0x93, 0xF1, 0xAD,
+    0xAD, 0xDD, 0x66, 0x9D, 0xC1, 0xB7, 0x58, 0xDA, 0x85, 0x7D, 0xE5, 0x8C, 0x06, 0x3F, 0xA4, 0x42,
+    0xDF, 0x06, 0x03, 0x24, 0xBE, 0x06, 0xDF, 0xC5, 0x3D, 0xC9, 0x41, 0xF3, 0x8B, 0xF6, 0xFD, 0x37,
+    0xF8, 0x8F, 0x19, 0x10, 0xBA, 0xB7, 0x24, 0xD5, 0x8B, 0x9A, 0xC5, 0x91, 0x9C, 0x39, 0x03, 0x0B,
+    0x9C, 0x5E, 0x92, 0xF3, 0x65, 0xFF, 0x59, 0xB9, 0x69, 0x8C, 0xCC, 0x7B, 0x3D, 0x51, 0xCB, 0x73,
+    0x68, 0x43, 0xE5, 0xA7, 0x93, 0x1F, 0x48, 0xDD, 0x68, 0xF2, 0x43, 0xEA, 0xDF, 0x09, 0x8B, 0x27,
+    0xBC, 0x70, 0x88, 0x6E, 0x32, 0xC7, 0x39, 0xA7, 0xA2, 0x66, 0x76, 0xCA, 0x4D, 0xA2, 0x5E, 0xF6,
+    0x55, 0xCF, 0xF7, 0x08, 0x2F, 0x32, 0xF7, 0xC8, 0xD9, 0x58, 0x33, 0x70, 0xFF, 0xF8, 0xE1, 0xE9,
+    0x70, 0x3B, 0x74, 0x15, 0x43, 0x73, 0x8B, 0x37, 0x14, 0x5B, 0x32, 0xF0, 0x5D, 0xC2, 0xAE, 0xDA,
+    0x10, 0x39, 0xFA, 0x1C, 0x66, 0xE2, 0x88, 0x66, 0x32, 0x2E, 0x31, 0x31, 0x17, 0x10, 0xFF, 0x0A,
+    0xF1, 0xDB, 0xFE, 0xD6, 0xC9, 0xB6, 0x44, 0x2B, 0xF6, 0x75, 0x1F, 0x66, 0x5D, 0xE6, 0x9F, 0x9C,
+    0x01, 0xF7, 0x8C, 0x10, 0x94, 0x1B, 0xEC, 0x4C, 0x36, 0x90, 0x50, 0x1E, 0x62, 0x8E, 0x7B, 0xE2,
+    0x00, 0x83, 0xF9, 0x48, 0xF3, 0x2A, 0x76, 0x4E, 0xBF, 0x06, 0x33, 0xF6, 0x4E, 0x44, 0x27, 0x26,
+    0x1D, 0xB1, 0x09, 0xCF, 0x10, 0xC1, 0x8B, 0xCF, 0xD1, 0xB5, 0xF5, 0x19, 0x22, 0xF8, 0x37, 0xB5,
+    0x55, 0x31, 0x6F, 0xDB, 0x46, 0x14, 0xFE, 0x8E, 0x07, 0x5B, 0x40, 0x88, 0xFA, 0x96, 0xAA, 0x8B,
+    0x91, 0xDC, 0x1A, 0xA0, 0x86, 0xB9, 0x64, 0xF0, 0x20, 0x8B, 0x87, 0xAE, 0x5D, 0x32, 0x58, 0xED,
+    0xD0, 0x21, 0x4B, 0xD7, 0x36, 0x1D, 0x32, 0x64, 0xB0, 0x2D, 0xA2, 0x06, 0x9A, 0xA1, 0x43, 0xFD,
+    0x13, 0x3A, 0x16, 0x59, 0x9C, 0xD1, 0x05, 0xE4, 0xEA, 0x02, 0x0F, 0x19, 0xC3, 0x3D, 0x0B, 0x5B,
+    0x78, 0x37, 0x07, 0xA2, 0x60, 0x6A, 0x8A, 0xAF, 0xDF, 0x51, 0xB2, 0xE4, 0xA0, 0x68, 0x83, 0x20,
+    0x8D, 0x60, 0x51, 0xD4, 0xA3, 0xEF, 0x7D, 0xEF, 0xFB, 0xBE, 0xF7, 0x9E, 0x00, 0x0C, 0xD0, 0xF3,
+    0xD8, 0x47, 0x22, 0x2F, 0xA5, 0x89, 0x3D, 0x26, 0xE8, 0x2E, 0x22, 0xD9, 0xE2, 0x8E, 0x4F, 0xC7,
+    0x27, 0x91, 0xE4, 0xCA, 0x41, 0x39, 0x07, 0x24, 0xE7, 0x19, 0x70, 0x25, 0x80, 0x7E, 0x52, 0x61,
+    0xF9, 0x52, 0x23, 0xA7, 0x46, 0x0F, 0xC4, 0xA5, 0xED, 0x66, 0x01, 0xEB, 0x8D, 0xC3, 0x36, 0x76,
+    0x81, 0x53, 0x54, 0x88, 0x0A, 0x9D, 0x23, 0xCE, 0xFE, 0x33, 0x54, 0x43, 0xE7, 0xBA, 0x84, 0x45,
+    0xAF, 0x54, 0x35, 0x4C, 0x2B, 0x1E, 0xB1, 0xD4, 0xCC, 0xBB, 0xB7, 0xC8, 0x9F, 0x1C, 0x39, 0x98,
+    0xBF, 0x0A, 0xE8, 0xCF, 0x09, 0xEA, 0xBE, 0x5E, 0x01, 0x4F, 0x71, 0x92, 0x4D, 0x7D, 0x9A, 0x47,
+    0x25, 0xF3, 0x4E, 0x98, 0x2D, 0x81, 0x71, 0xB1, 0xD7, 0xFF, 0x0C, 0xA8, 0x4A, 0x57, 0x48, 0x2F,
+    0xE5, 0x58, 0xCB, 0x8F, 0x0D, 0xFA, 0x8B, 0xAA, 0x81, 0x94, 0x60, 0x90, 0xD9, 0x2A, 0x25, 0x46,
+    0xF7, 0x31, 0xFA, 0x52, 0x72, 0x23, 0x3F, 0xD4, 0x2C, 0xE8, 0xED, 0xD5, 0xBF, 0x19, 0x1A, 0x82,
+    0x81, 0x86, 0xBA, 0xA9, 0x06, 0x87, 0xD0, 0x32, 0x2D, 0x11, 0x49, 0xCB, 0xB4, 0x01, 0x32, 0xDC,
+    0x8C, 0xC5, 0xE1, 0xE6, 0x2B, 0x2E, 0x6F, 0xD5, 0x71, 0xA3, 0x67, 0xFF, 0x5E, 0xFA, 0x32, 0x60,
+    0x5D, 0xEA, 0x74, 0x2B, 0xAF, 0x91, 0xD6, 0x53, 0xAF, 0xEE, 0x5F, 0x67, 0xD8, 0x51, 0xA4, 0xD0,
+    0x7E, 0x4B, 0x42, 0x52, 0xAC, 0x44, 0xFB, 0xD0, 0x9E, 0xDC, 0x53, 0x19, 0xCC, 0xF7, 0x39, 0xD9,
+    0x95, 0xC0, 0xE6, 0xF1, 0xFF, 0xE4, 0x09, 0xEE, 0xF2, 0xDD, 0x0B, 0x76, 0xEC, 0x0C, 0x78, 0x29,
+    0x98, 0x5B, 0x87, 0x96, 0x8B, 0x9B, 0x40, 0xC9, 0x61, 0x6D, 0xC4, 0xBF, 0xF1, 0x0C, 0x52, 0x3F,
+    0xCC, 0x30, 0x7E, 0x17, 0x42, 0x5D, 0xA8, 0x20, 0xB2, 0x09, 0x0D, 0x6F, 0x7D, 0xAF, 0x40, 0x1A,
+    0x1A, 0x39, 0x09, 0xA2, 0x75, 0x62, 0xAE, 0xBB, 0x39, 0x8E, 0x7E, 0x92, 0x41, 0xE5, 0x44, 0x7E,
+    0xBC, 0x03, 0x98, 0x00, 0xFC, 0xCB, 0xA2, 0x0D, 0xFD, 0xA7, 0x45, 0x52, 0x9A, 0xB7, 0xB0, 0xEA,
+    0x02, 0x07, 0x98, 0xC1, 0x5C, 0xC9, 0x05, 0xE4, 0x0F, 0xC1, 0xDA, 0xCA, 0xF1, 0x67, 0x1F, 0x11,
+    0xC3, 0x33, 0xE7, 0xCC, 0x7A, 0x98, 0xE7, 0x14, 0xF4, 0xDE, 0xFA, 0xFC, 0xC9, 0x87, 0x64, 0xD6,
+    0xF5, 0x43, 0x9E, 0x03, 0xF5, 0x04, 0xD8, 0xE7, 0xA1, 0xC1, 0x36, 0x70, 0x7B, 0x63, 0xE5, 0xD9,
+    0xFB, 0x30, 0xEB, 0xEF, 0xA1, 0x3F, 0x92, 0x4A, 0xCB, 0xEF, 0xBF, 0x81, 0x4D, 0xFF, 0x0E, 0x35,
+    0x77, 0xA1, 0x8C, 0x81, 0x14, 0xAA, 0x24, 0x67, 0x9B, 0x41, 0x2E, 0xA9, 0xCD, 0x54, 0xE8, 0xF8,
+    0x3A, 0x0D, 0x80, 0x09, 0xC5, 0xED, 0x87, 0xEA, 0x5B, 0x22, 0x45, 0xED, 0xFB, 0x8E, 0xCD, 0x98,
+    0x63, 0x63, 0x82, 0xCD, 0x7C, 0x6B, 0x4E, 0x0D, 0x66, 0xBC, 0xB1, 0xE5, 0x22, 0xE7, 0xDD, 0xF9,
+    0xC7, 0x1C, 0x25, 0x0A, 0x8B, 0x81, 0xFF, 0x79, 0x14, 0x66, 0x0A, 0x1B, 0xF8, 0x79, 0x09, 0xDD,
+    0x1F, 0x85, 0xCB, 0xDE, 0x58, 0x78, 0x60, 0xDA, 0x6C, 0x56, 0x84, 0x88, 0xC3, 0xAC, 0x1C, 0xD2,
+    0x59, 0x82, 0x0A, 0x4C, 0xA6, 0xAA, 0xF0, 0x41, 0xBD, 0xD5, 0x65, 0x66, 0x81, 0x26, 0x7A, 0xE5,
+    0xA9, 0xF8, 0xBE, 0x7E, 0xE1, 0xC9, 0x7E, 0xB7, 0x77, 0x94, 0xB3, 0xB9, 0x87, 0xF1, 0x67, 0xE5,
+    0x29, 0xA5, 0x37, 0xAA, 0xE4, 0x56, 0x33, 0x1B, 0xA8, 0x58, 0x87, 0xF9, 0x06, 0xBF, 0x12, 0x30,
+    0x9E, 0xE0, 0x90, 0x76, 0xE9, 0x06, 0x29, 0xAB, 0xE0, 0x94, 0x24, 0x54, 0x84, 0xB9, 0xED, 0x8D,
+    0xDD, 0xD1, 0x69, 0xA3, 0x9B, 0x6E, 0xE4, 0x3A, 0xAD, 0x02, 0x31, 0x9D, 0xEF, 0xDC, 0x5C, 0x2E,
+    0x3D, 0xC9, 0xBE, 0x8B, 0xDB, 0xF4, 0x22, 0x76, 0x0F, 0xF3, 0x9A, 0x6B, 0xA9, 0x8A, 0xBD, 0xF5,
+    0x16, 0xBB, 0xD1, 0x2C, 0xB4, 0xCC, 0xB0, 0x1C, 0x20, 0xE9, 0x3D, 0xA0, 0x10, 0xE5, 0xB3, 0xEA,
+    0x11, 0xCC, 0x4F, 0xF1, 0x4B, 0xE0, 0x20, 0x1F, 0x70, 0xD1, 0x06, 0x65, 0x09, 0xCA, 0x26, 0x25,
+    0x95, 0x7A, 0xB9, 0xE7, 0x8F, 0x17, 0xF2, 0x5C, 0xB1, 0xC6, 0x9A, 0x54, 0x1E, 0x69, 0xB7, 0xD8,
+    0x35, 0xFD, 0x2F, 0xA4, 0xB6, 0xAD, 0x2D, 0x70, 0x46, 0x18, 0x9A, 0xE0, 0x2C, 0x74, 0xC9, 0x8A,
+    0x0E, 0x62, 0xAE, 0x89, 0x73, 0x92, 0xF8, 0x93, 0x47, 0x92, 0xB2, 0x23, 0x03, 0xDA, 0xC2, 0x2F,
+    0x41, 0x5D, 0xDF, 0xD1, 0xEA, 0x02, 0x6A, 0x7A, 0xC1, 0x0D, 0xC6, 0xEC, 0x3C, 0x81, 0xA9, 0x83,
+    0xBE, 0xA4, 0x54, 0xDB, 0x50, 0xC5, 0xD6, 0x35, 0xBC, 0x6D, 0x03, 0x97, 0xCD, 0x6A, 0x48, 0x87,
+    0x27, 0x6C, 0x8B, 0x2A, 0x98, 0x6C, 0xB8, 0x6B, 0x4F, 0x61, 0x8E, 0x3C, 0xEC, 0x1D, 0x1E, 0x60,
+    0xB2, 0x29, 0xCF, 0xCF, 0xE6, 0x79, 0x83, 0x24, 0x4C, 0x1D, 0xE7, 0xF8, 0xA4, 0xED, 0x64, 0x52,
+    0xAF, 0x43, 0xA2, 0xC7, 0xB7, 0xB8, 0xF8, 0x39, 0x26, 0xE6, 0xF9, 0xEA, 0x47, 0x8C, 0xF3, 0x37,
+    0xFA, 0x4A, 0x8A, 0x71, 0x3D, 0xCE, 0xA2, 0x4A, 0x87, 0xDE, 0x39, 0x23, 0x84, 0xA1, 0x61, 0xAA,
+    0xA2, 0x77, 0x29, 0xE5, 0xD6, 0xAF, 0x42, 0x65, 0x2C, 0xD9, 0xE4, 0xAB, 0xB2, 0xDF, 0xE0, 0xB1,
+    0x2E, 0xC7, 0xD4, 0x3C, 0xE8, 0xF5, 0xF1, 0x3C, 0x30, 0xE6, 0xDA, 0xAC, 0xBA, 0x6F, 0xDD, 0x4F,
+    0xCB, 0x68, 0xAF, 0x27, 0x52, 0xD9, 0xA7, 0x27, 0xF9, 0x29, 0x86, 0x91, 0xD7, 0x65, 0x44, 0xA5,
+    0xC0, 0x05, 0x4B, 0x20, 0x10, 0x10, 0x2C, 0x8A, 0xD3, 0xD0, 0x1D, 0x0D, 0x5E, 0xD7, 0xD8, 0xE2,
+    0x83, 0xF2, 0x0C, 0xBD, 0x73, 0x91, 0xD6, 0xF0, 0xEC, 0xD2, 0x8A, 0x1C, 0x61, 0xE6, 0xC9, 0x1A,
+    0xB8, 0x16, 0xC8, 0x4A, 0x93, 0xC8, 0x6C, 0x0B, 0xF5, 0x16, 0xEB, 0x67, 0x49, 0xCC, 0x30, 0x0C,
+    0x39, 0x74, 0xB9, 0x16, 0x7B, 0x63, 0xDD, 0x9D, 0xF4, 0x69, 0x9B, 0x4A, 0xB3, 0xA4, 0xFC, 0x37,
+    0xAD, 0x55, 0xBF, 0x6F, 0xDD, 0x54, 0x14, 0xFE, 0x6C, 0xF7, 0x3D, 0xD3, 0x18, 0x72, 0x33, 0xB4,
+    0x52, 0x8B, 0x20, 0x66, 0xE8, 0x50, 0xA1, 0x34, 0x66, 0xE8, 0x90, 0xC1, 0xF6, 0xB3, 0xC8, 0x90,
+    0xA1, 0x03, 0x11, 0xE4, 0x4D, 0xEC, 0x08, 0x06, 0x04, 0x13, 0xEA, 0x90, 0xF4, 0x19, 0xFE, 0x82,
+    0x2C, 0xCC, 0x64, 0x60, 0x4A, 0x87, 0x74, 0x08, 0x52, 0x06, 0xBF, 0x3C, 0x87, 0x0C, 0x1D, 0x31,
+    0x43, 0x27, 0x06, 0x2C, 0xC6, 0x74, 0xC8, 0x2D, 0xB2, 0xC0, 0x44, 0x7E, 0xBE, 0x7C, 0xC7, 0x2F,
+    0x91, 0x42, 0x51, 0x0B, 0x48, 0xF8, 0x59, 0xC7, 0xCF, 0xF7, 0xDE, 0xF3, 0xEB, 0x3B, 0xDF, 0x39,
+    0x86, 0x05, 0x60, 0x00, 0x58, 0x0D, 0xE0, 0x94, 0xB8, 0xB8, 0x86, 0xC3, 0x0D, 0xD7, 0x98, 0xCA,
+    0xDF, 0xDD, 0x2B, 0x0E, 0x10, 0xDB, 0xB9, 0xA3, 0x6D, 0x04, 0x09, 0xAC, 0x1A, 0x50, 0x39, 0x30,
+    0x06, 0xDC, 0xB2, 0xD3, 0xB3, 0x35, 0xE0, 0x27, 0x40, 0x8D, 0x25, 0x6E, 0xE8, 0x31, 0xDC, 0x63,
+    0x63, 0x5A, 0x45, 0xDD, 0xCE, 0xCE, 0x72, 0x77, 0x88, 0xF7, 0x95, 0x73, 0xC3, 0xBE, 0x69, 0x02,
+    0x33, 0x5D, 0x42, 0xBD, 0xE4, 0x68, 0x78, 0xB9, 0xE8, 0xC6, 0xA2, 0xED, 0xE8, 0x9E, 0x97, 0x2B,
+    0x3F, 0x59, 0x1C, 0xEC, 0xB6, 0x03, 0xC3, 0x60, 0x60, 0xA7, 0xF3, 0x50, 0x5F, 0x56, 0x50, 0xDF,
+    0x24, 0x50, 0xB4, 0xA6, 0x92, 0xFF, 0x35, 0x32, 0xC0, 0xC3, 0xBE, 0xFB, 0x7D, 0x69, 0xFF, 0x9E,
+    0xC3, 0x00, 0xD1, 0x7F, 0x8E, 0x0F, 0xD6, 0x3A, 0x82, 0x16, 0xE3, 0x11, 0xF4, 0x55, 0xFA, 0x22,
+    0x78, 0xFF, 0xE6, 0xF6, 0xCE, 0x30, 0x30, 0xC9, 0x82, 0x9B, 0x3E, 0xB0, 0x2B, 0x2F, 0x7F, 0x53,
+    0xEC, 0x84, 0x5E, 0x51, 0xC7, 0x0E, 0x23, 0x75, 0x0A, 0x4F, 0xFB, 0x59, 0xB8, 0xBC, 0xAF, 0x64,
+    0x79, 0x34, 0x67, 0x4E, 0x9F, 0xB5, 0x0B, 0xB7, 0x02, 0x73, 0x3C, 0xF3, 0x87, 0x1D, 0xA7, 0xF6,
+    0x47, 0x8D, 0xB7, 0x13, 0x1E, 0x8E, 0xAF, 0xDD, 0xB0, 0x57, 0x75, 0x13, 0xAB, 0x3C, 0x59, 0xE8,
+    0x6F, 0x07, 0x4D, 0x18, 0xDE, 0x0D, 0x71, 0xE0, 0x16, 0x62, 0xC5, 0xDA, 0xF6, 0xAB, 0x30, 0x5C,
+    0x59, 0x0A, 0xC3, 0xA0, 0xEA, 0x6F, 0x53, 0xED, 0xEE, 0x8A, 0xF7, 0x38, 0xAF, 0xEA, 0x65, 0xDF,
+    0xF9, 0x2A, 0xEF, 0xEC, 0x38, 0x69, 0xB8, 0xAC, 0xF0, 0x5B, 0xE1, 0xD4, 0xF0, 0x05, 0xE8, 0xA3,
+    0x3C, 0x8A, 0xED, 0x67, 0x5A, 0xDD, 0x4B, 0x57, 0x96, 0x66, 0x20, 0xD4, 0xA3, 0xB6, 0xF4, 0xD3,
+    0x1E, 0xE6, 0xC3, 0x83, 0xAA, 0x1E, 0x5F, 0xBB, 0xA9, 0x8E, 0xAA, 0x48, 0x79, 0xAB, 0xC9, 0x4D,
+    0xF5, 0xF8, 0x47, 0x1D, 0xBA, 0xE9, 0xE7, 0xB8, 0x13, 0x85, 0x2B, 0xEF, 0x2C, 0xDC, 0x8E, 0xE3,
+    0xCD, 0x47, 0xF8, 0x6B, 0x3C, 0x73, 0x6B, 0xE3, 0x47, 0x4F, 0xE7, 0x47, 0xF9, 0xFA, 0x9C, 0x5B,
+    0xD6, 0xD1, 0x62, 0x0F, 0xAF, 0x3B, 0x8D, 0x93, 0x6F, 0x06, 0x16, 0x8B, 0x54, 0x86, 0x5E, 0xFA,
+    0xE0, 0xFD, 0x29, 0xF0, 0xD1, 0x4F, 0x9F, 0x7E, 0x97, 0x0A, 0xE3, 0x54, 0xBD, 0x1C, 0x1D, 0xA8,
+    0x05, 0x3A, 0xD5, 0xEE, 0xD4, 0x1F, 0x34, 0x12, 0x71, 0x3C, 0x67, 0x7E, 0xFE, 0xB5, 0x5D, 0xFF,
+    0xB8, 0x37, 0x5C, 0x35, 0xCD, 0xDB, 0xBB, 0xC9, 0xA5, 0x80, 0xAE, 0xF2, 0x1C, 0x02, 0x38, 0x39,
+    0xF6, 0x61, 0xE1, 0x86, 0xBD, 0xA6, 0xA7, 0x9D, 0xD3, 0x05, 0xE5, 0xE4, 0x67, 0xA4, 0x01, 0x6D,
+    0x06, 0x84, 0xA0, 0x05, 0xFA, 0xC4, 0xCC, 0x4A, 0x67, 0x8C, 0x19, 0xBE, 0x67, 0x4C, 0xE3, 0x9F,
+    0x3C, 0xCC, 0x33, 0x2C, 0x79, 0xB9, 0xC5, 0x87, 0x94, 0x16, 0xF2, 0x38, 0x69, 0x31, 0x31, 0xE5,
+    0xC5, 0x5B, 0xF7, 0x98, 0xE3, 0x43, 0x67, 0x58, 0x0C, 0x8C, 0x39, 0x35, 0x66, 0x6A, 0x6F, 0xDF,
+    0xC7, 0x48, 0xE5, 0x6E, 0xD9, 0x9C, 0x53, 0xA4, 0x47, 0x0A, 0x1A, 0x63, 0x8E, 0xDA, 0xDD, 0xCC,
+    0xCB, 0x6D, 0x1A, 0x7B, 0xE3, 0x92, 0xFA, 0xE1, 0x5E, 0xE9, 0x99, 0x16, 0x97, 0x3C, 0xE4, 0xD8,
+    0xC9, 0xA0, 0xE8, 0xF6, 0x17, 0xD2, 0x8F, 0x7A, 0xC5, 0x75, 0x06, 0x44, 0x12, 0x18, 0x83, 0xF8,
+    0xE1, 0xD9, 0x04, 0xA1, 0x53, 0x2C, 0x8A, 0x78, 0x0D, 0xB7, 0x9C, 0xE2, 0x8A, 0xB0, 0x00, 0x17,
+    0x82, 0x86, 0x28, 0x4C, 0xD1, 0x31, 0x83, 0x82, 0x24, 0xE7, 0x46, 0x23, 0x22, 0x13, 0xB1, 0x39,
+    0x13, 0xFE, 0x1F, 0x7C, 0xE5, 0xD9, 0x2E, 0x40, 0x61, 0xB7, 0x50, 0x1F, 0x1E, 0x4D, 0xF4, 0x26,
+    0x04, 0xCF, 0xAB, 0x2F, 0xBA, 0x7A, 0x5D, 0x22, 0xB2, 0x0C, 0xEC, 0x69, 0xF7, 0xBF, 0x4B, 0xE5,
+    0x03, 0x46, 0xE5, 0x9F, 0xEC, 0xBD, 0xAB, 0x9D, 0x22, 0xC3, 0x7E, 0xD0, 0x01, 0x24, 0xFA, 0x59,
+    0x87, 0x24, 0xA3, 0x7F, 0xFE, 0xC5, 0x36, 0xDB, 0x8E, 0xA1, 0xC9, 0xFE, 0xB7, 0xFC, 0x6B, 0x92,
+    0xC1, 0xD7, 0x2D, 0x3B, 0xE5, 0x20, 0x60, 0x71, 0x19, 0xDD, 0x5A, 0xD1, 0x9D, 0xC4, 0xE1, 0xEE,
+    0x0E, 0x03, 0xCF, 0xD5, 0x93, 0x8D, 0xEE, 0x95, 0xFA, 0xD2, 0xA0, 0xAB, 0x6C, 0xA9, 0xB5, 0x0A,
+    0x63, 0xAF, 0xDD, 0xD3, 0x7D, 0x49, 0xEE, 0x3A, 0xF7, 0x3E, 0x49, 0x5C, 0x16, 0xE7, 0x49, 0x16,
+    0x23, 0x8C, 0xE4, 0xBE, 0x3B, 0x48, 0x10, 0xB0, 0x51, 0x5A, 0x46, 0x5A, 0xC0, 0xAF, 0x60, 0x37,
+    0x6F, 0x61, 0x4B, 0x23, 0xAA, 0xB0, 0xD5, 0xA0, 0x99, 0x3C, 0xD4, 0x81, 0xC9, 0xAD, 0x0D, 0xB0,
+    0x08, 0x53, 0xBF, 0xF0, 0xF2, 0x17, 0xFD, 0x82, 0xDA, 0x4C, 0x6F, 0x7B, 0xF7, 0xCA, 0x66, 0x4B,
+    0x75, 0xB4, 0xB7, 0x86, 0xEB, 0xEC, 0xBC, 0x51, 0x62, 0x0B, 0x81, 0x5E, 0x26, 0x26, 0x25, 0xCF,
+    0xF5, 0x86, 0x89, 0x99, 0x5A, 0x53, 0xC9, 0x39, 0xFB, 0x07, 0x41, 0xF3, 0xD2, 0x48, 0x6E, 0x69,
+    0x37, 0x38, 0x3C, 0x9F, 0x51, 0x43, 0xE2, 0xCE, 0x0A, 0xD3, 0xB1, 0x7F, 0x32, 0x95, 0x62, 0x24,
+    0xD9, 0x73, 0x52, 0xE1, 0xB2, 0x9C, 0x98, 0x94, 0xF2, 0x70, 0xAF, 0xC2, 0x22, 0x32, 0xCE, 0xE2,
+    0x3B, 0x5C, 0xDF, 0x42, 0x48, 0x19, 0xB1, 0xC0, 0x22, 0x2B, 0xCA, 0xEC, 0x0B, 0xCD, 0xDD, 0x7A,
+    0x92, 0xF7, 0xDB, 0x89, 0x9E, 0x24, 0xCA, 0xB4, 0xC9, 0xB5, 0x99, 0xC3, 0x0D, 0x8B, 0x1E, 0x4D,
+    0xE3, 0x09, 0x62, 0x85, 0x75, 0xD8, 0xD5, 0x6A, 0xEB, 0x25, 0x92, 0xB1, 0x9D, 0x25, 0x22, 0x4D,
+    0x25, 0x2B, 0x56, 0xD3, 0xAD, 0xC7, 0x7F, 0x93, 0xD1, 0x6C, 0x37, 0xA8, 0x2D, 0x33, 0xD1, 0x62,
+    0xDF, 0xCC, 0xA6, 0x30, 0x3A, 0x12, 0x2B, 0x49, 0xD1, 0x39, 0x61, 0x49, 0xA0, 0x55, 0x72, 0x7F,
+    0xC6, 0xE2, 0xAB, 0xA8, 0xE4, 0x9B, 0xD2, 0x0D, 0xD4, 0x6E, 0x66, 0x3B, 0x4F, 0x99, 0x1C, 0xD1,
+    0x20, 0x3D, 0x63, 0x19, 0xD5, 0x2A, 0x91, 0x51, 0x58, 0x10, 0x34, 0x26, 0x35, 0x90, 0x93, 0x44,
+    0x90, 0x8B, 0x9A, 0x6D, 0x6E, 0xB7, 0xC9, 0xC0, 0xAC, 0x1A, 0x4E, 0xF0, 0x3E, 0x66, 0x2D, 0xA4,
+    0x64, 0x8C, 0x9F, 0xBF, 0x77, 0x8C, 0x4D, 0xFA, 0x8E, 0xD1, 0x1C, 0x94, 0x85, 0xDB, 0xD8, 0x5A,
+    0x3A, 0xC1, 0x2E, 0x59, 0x37, 0x19, 0xD6, 0xFB, 0xAC, 0xDE, 0x0A, 0xB9, 0x47, 0x47, 0x01, 0x5D,
+    0x7A, 0x47, 0xE4, 0x8E, 0xA6, 0x83, 0xCC, 0x95, 0x13, 0x63, 0x9E, 0x50, 0xB9, 0xAD, 0xAD, 0xC6,
+    0x36, 0x69, 0x70, 0x6C, 0xB4, 0x2D, 0xFD, 0x42, 0x06, 0xBE, 0x22, 0x76, 0x63, 0x11, 0x46, 0x84,
+    0xB4, 0x8C, 0xCC, 0x99, 0x73, 0x6F, 0xBD, 0xE1, 0xC0, 0x60, 0xD4, 0xFA, 0x05, 0x3E, 0x4B, 0x49,
+    0xE5, 0x2D, 0xE9, 0xBC, 0x8A, 0x2C, 0x19, 0x90, 0x7A, 0xCE, 0x69, 0x12, 0x20, 0x8A, 0x90, 0x39,
+    0x05, 0x97, 0x22, 0x76, 0xE9, 0x71, 0xA1, 0x92, 0x20, 0x66, 0x4A, 0x93, 0x12, 0x95, 0xDD, 0x4A,
+    0xE3, 0x96, 0xCC, 0x8D, 0x8A, 0x91, 0xDD, 0xA6, 0xFD, 0x76, 0x24, 0xB6, 0xF8, 0x31, 0x4C, 0x38,
+    0xC2, 0x38, 0x7B, 0x63, 0x26, 0x6D, 0x09, 0x30, 0xE4, 0xF3, 0x0C, 0x56, 0xF2, 0xFA, 0x43, 0x53,
+    0x06, 0x2D, 0x53, 0x1E, 0x24, 0x31, 0xF5, 0xE9, 0x6A, 0x13, 0x2A, 0x25, 0x92, 0x99, 0x25, 0x5F,
+    0x19, 0xE2, 0x1A, 0xB8, 0xC4, 0xA5, 0xDE, 0x27, 0x3E, 0x3F, 0xC8, 0xC7, 0x9B, 0x2D, 0xD7, 0xA5,
+    0xD2, 0x81, 0x4D, 0xA4, 0x5E, 0x0D, 0xB9, 0x20, 0x75, 0x0A, 0x0A, 0x9C, 0xF7, 0xF9, 0x8B, 0xAF,
+    0x3F, 0x01, 0x95, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0x61, 0xCF, 0x22, 0x83, 0x98,
+    0x14, 0x39, 0x51, 0x44, 0xC4, 0x0D, 0x05, 0x45, 0x2E, 0xD3, 0x82, 0xB4, 0xBB, 0x36, 0xE4, 0x0F,
+    0xC8, 0x49, 0xC4, 0xA2, 0xA0, 0x08, 0x35, 0xCD, 0xB5, 0x29, 0xEE, 0x87, 0x11, 0x25, 0x4D, 0x1A,
+    0x44, 0x49, 0x11, 0xA5, 0xE0, 0x52, 0x5C, 0x8A, 0x2B, 0x28, 0x9C, 0x78, 0x92, 0x2B, 0x53, 0x64,
+    0xA4, 0x14, 0x14, 0x14, 0x38, 0x22, 0xE2, 0xC7, 0x51, 0x9C, 0x45, 0xB6, 0xD8, 0x4B, 0xBC, 0x1E,
+    0xBE, 0xE7, 0xBD, 0x84, 0x10, 0x44, 0x91, 0x95, 0xBC, 0x7E, 0x33, 0x9E, 0x79, 0x3F, 0xBE, 0xF7,
+    0xBD, 0xF7, 0x8A, 0xCB, 0x51, 0x71, 0x25, 0xB8, 0x9D, 0x90, 0xFA, 0x68, 0x07, 0x15, 0x54, 0xA3,
+    0x1D, 0xA6, 0xAF, 0x2F, 0xD8, 0x10, 0xC2, 0x77, 0x7C, 0x02, 0xA2, 0x16, 0x40, 0xCA, 0x07, 0x22,
+    0x18, 0x11, 0x1A, 0x9C, 0xFC, 0xCE, 0xF0, 0x51, 0xC3, 0x77, 0xCF, 0xBF, 0xBA, 0xE4, 0xEA, 0x67,
+    0x0A, 0x6B, 0x13, 0x39, 0xDD, 0x01, 0xC9, 0x97, 0xFC, 0x38, 0x51, 0x0D, 0x95, 0x50, 0xB3, 0xFE,
+    0x66, 0x23, 0x47, 0x16, 0x7A, 0xC4, 0x4F, 0x77, 0x3B, 0x98, 0x3C, 0x9A, 0x61, 0x93, 0xD7, 0xF9,
+    0x59, 0x3B, 0xDB, 0xA0, 0xFE, 0x25, 0x78, 0x13, 0x7C, 0x51, 0x14, 0x26, 0x84, 0x79, 0x7A, 0xB8,
+    0x97, 0x57, 0xD8, 0xD7, 0x2E, 0xA1, 0x3F, 0xA7, 0x79, 0x9B, 0x2F, 0xE8, 0x70, 0x8C, 0x3B, 0xF5,
+    0x5C, 0x3B, 0xED, 0x2B, 0x64, 0xDA, 0xC5, 0x6D, 0x05, 0xAB, 0x9D, 0x6A, 0x2A, 0x74, 0xF6, 0x59,
+    0xB8, 0x14, 0x42, 0x29, 0x6E, 0x8D, 0x76, 0xD7, 0xA9, 0xC2, 0xA5, 0x77, 0x6B, 0x54, 0xF1, 0x4C,
+    0x3B, 0x43, 0x4D, 0xF2, 0xE2, 0xAA, 0xD1, 0xA1, 0x43, 0x1D, 0xB8, 0x4A, 0x5D, 0x85, 0xC9, 0xF2,
+    0xEE, 0x94, 0x56, 0x7C, 0x15, 0x89, 0x0A, 0xDE, 0xCB, 0x45, 0x05, 0xBD, 0xC8, 0x42, 0x78, 0xD4,
+    0xEF, 0xCE, 0xAC, 0x9C, 0xD2, 0x1F, 0xB7, 0x31, 0xCF, 0x9F, 0xB6, 0xF4, 0xC1, 0x21, 0x6E, 0x07,
+    0x6F, 0x5E, 0x5D, 0xD8, 0x63, 0x46, 0x57, 0x0E, 0x77, 0x73, 0xEA, 0x59, 0xE0, 0xEC, 0x61, 0x0F,
+    0xEC, 0x27, 0x8C, 0x3C, 0xDF, 0x04, 0x6E, 0x51, 0x30, 0x8C, 0x18, 0xED, 0x89, 0x10, 0x35, 0x14,
+    0xD6, 0x04, 0x03, 0x47, 0x61, 0x4C, 0x41, 0xE7, 0x14, 0x5A, 0x0A, 0x17, 0x90, 0x38, 0x49, 0xC1,
+    0xB7, 0x92, 0x82, 0x2D, 0xC2, 0xFA, 0x84, 0x00, 0x4C, 0xC7, 0x40, 0xFC, 0x90, 0xC2, 0xBB, 0xEF,
+    0xD3, 0x43, 0x77, 0xE2, 0x26, 0x83, 0xEE, 0xD2, 0xC3, 0x9B, 0xF4, 0xEE, 0xBC, 0x76, 0x91, 0xAB,
+    0x06, 0xA7, 0x06, 0xB0, 0x68, 0xBD, 0x0E, 0xCD, 0xF3, 0xD5, 0xF0, 0x3A, 0xC5, 0x17, 0x31, 0x3B,
+    0x47, 0xDD, 0x47, 0xF4, 0x70, 0x25, 0x1F, 0x15, 0x78, 0x4F, 0xCD, 0x4C, 0x70, 0x59, 0x1E, 0xB0,
+    0x93, 0x67, 0x3E, 0x66, 0xA6, 0x98, 0xED, 0xB5, 0xB8, 0x65, 0xAA, 0x95, 0xAB, 0x34, 0xE1, 0xD8,
+    0xB7, 0x8A, 0xB7, 0x8D, 0xBE, 0xC7, 0x2C, 0x47, 0xE1, 0x99, 0x24, 0x9C, 0x46, 0xF9, 0xBF, 0x69,
+    0x45, 0x2D, 0xE1, 0x9B, 0x01, 0x59, 0xDC, 0x12, 0x83, 0x34, 0xAF, 0x48, 0x08, 0xE3, 0x2C, 0xEE,
+    0xC0, 0x78, 0x62, 0xEE, 0x4D, 0xA3, 0x7B, 0x2C, 0xD2, 0x86, 0x36, 0xD2, 0x47, 0x03, 0xB6, 0xEB,
+    0xF8, 0xE2, 0x1A, 0x3D, 0xF3, 0xC6, 0xEF, 0x30, 0xD8, 0xF9, 0xDB, 0x30, 0xA5, 0xC7, 0x7C, 0x20,
+    0x19, 0xB9, 0x90, 0x75, 0x50, 0x81, 0x26, 0x76, 0xA8, 0x59, 0x28, 0xE4, 0x73, 0x6C, 0x4D, 0xA0,
+    0x0F, 0x5A, 0xE6, 0xE7, 0xD7, 0x9A, 0xF7, 0x4A, 0xAC, 0xE6, 0x28, 0x2E, 0xA3, 0xF8, 0x24, 0xB4,
+    0x49, 0x78, 0xB4, 0xC0, 0xCA, 0x9C, 0x39, 0x48, 0x68, 0x0C, 0x59, 0x6E, 0xA1, 0x16, 0x8C, 0x73,
+    0x3A, 0x8B, 0x5B, 0xF5, 0x90, 0x5B, 0x13, 0x93, 0x5B, 0xE5, 0x27, 0xA8, 0x26, 0x98, 0xC5, 0x4F,
+    0x1A, 0xE5, 0xE9, 0x0C, 0xB7, 0x1A, 0x4C, 0xE8, 0x20, 0xB7, 0x5A, 0x28, 0x6F, 0x7F, 0xC7, 0xC6,
+    0x6F, 0xA2, 0xAB, 0xC1, 0x1B, 0xC8, 0x97, 0xF9, 0x51, 0x4D, 0x46, 0xDB, 0xE2, 0x47, 0x74, 0x79,
+    0xC9, 0xF5, 0x51, 0x41, 0xB0, 0x32, 0x82, 0xD4, 0x93, 0xEC, 0x1B, 0x25, 0x63, 0xDD, 0x92, 0x4A,
+    0x11, 0x15, 0x19, 0x0D, 0xA9, 0x23, 0xDA, 0x9E, 0xD0, 0x90, 0xF2, 0xDC, 0x9A, 0xD0, 0xD0, 0x81,
+    0xA7, 0xA1, 0x29, 0x0D, 0xD5, 0x0D, 0x0D, 0xF5, 0x34, 0xA4, 0x1B, 0xB1, 0xCD, 0x8A, 0x88, 0xFB,
+    0x72, 0xA5, 0xDF, 0x11, 0x5D, 0x8C, 0xE3, 0x73, 0x2A, 0xAD, 0xA3, 0x05, 0x03, 0xA6, 0x02, 0xE6,
+    0xE9, 0x02, 0x06, 0xEC, 0x05, 0x79, 0xAB, 0x4A, 0xE8, 0x23, 0x72, 0x2C, 0x10, 0x9E, 0x2A, 0x95,
+    0x8D, 0x96, 0x27, 0xB6, 0x79, 0x42, 0x7B, 0x5A, 0xEF, 0x48, 0xBB, 0xD4, 0xD9, 0x79, 0xDC, 0x51,
+    0x87, 0x25, 0x60, 0xD1, 0xFA, 0x3F, 0xEC, 0x4B, 0xFF, 0xC5, 0xBE, 0xFD, 0x57, 0xD9, 0x37, 0x08,
+    0xE7, 0x28, 0xC4, 0xFE, 0x84, 0x7D, 0x89, 0xD0, 0x90, 0x35, 0x99, 0x6C, 0x50, 0xAC, 0x5D, 0x14,
+    0xBE, 0x9E, 0x21, 0x2C, 0xCE, 0x0C, 0xC1, 0x13, 0x84, 0x02, 0xD9, 0x1C, 0xA6, 0x87, 0x95, 0x80,
+    0xE9, 0x2D, 0x43, 0x8A, 0x8E, 0x72, 0xC3, 0x7B, 0x1B, 0xF8, 0xB0, 0xC5, 0xDA, 0x66, 0xFC, 0xA3,
+    0xC3, 0xAD, 0x99, 0x31, 0x50, 0xF7, 0x9A, 0x0F, 0xC6, 0x30, 0xC9, 0x3D, 0xF2, 0x62, 0x6C, 0x2E,
+    0x29, 0x8F, 0xF6, 0xC2, 0x55, 0x93, 0x2B, 0x37, 0x75, 0x53, 0x66, 0x39, 0xE0, 0x07, 0x5C, 0x8D,
+    0x89, 0x52, 0xD4, 0x28, 0xC7, 0xD2, 0x7F, 0x3C, 0x92, 0xDA, 0x27, 0x6B, 0x82, 0x93, 0xB4, 0x7E,
+    0x7A, 0x92, 0xD6, 0x91, 0xA4, 0x75, 0x68, 0x49, 0x46, 0xD0, 0x96, 0xBE, 0x84, 0x93, 0x2D, 0x16,
+    0x45, 0x49, 0x0A, 0xF7, 0x2F, 0x6D, 0xFD, 0xF7, 0x94, 0x9D, 0xBF, 0x48, 0xEB, 0xCA, 0xF7, 0xD2,
+    0x3B, 0x98, 0x82, 0xE3, 0xB3, 0x1D, 0x16, 0xD0, 0xAD, 0x65, 0x23, 0xBA, 0xD8, 0x22, 0xEA, 0x58,
+    0x5B, 0xE6, 0xBE, 0x30, 0x4D, 0x4A, 0xE4, 0x81, 0xD4, 0x08, 0x39, 0xA7, 0xEF, 0x93, 0xE8, 0xDD,
+    0x36, 0x3F, 0x7D, 0xD5, 0x22, 0x9E, 0x65, 0x25, 0x32, 0xF4, 0x04, 0x3A, 0xE9, 0xF7, 0x08, 0xBF,
+    0xE4, 0x62, 0xB4, 0x3E, 0xD4, 0x1E, 0x29, 0xC8, 0xDF, 0xDD, 0x7E, 0xF7, 0xA6, 0xD0, 0x80, 0x6D,
+    0xC2, 0x31, 0x21, 0x56, 0x0A, 0xAD, 0x62, 0x8A, 0x5E, 0x63, 0x8B, 0xBE, 0xD6, 0xD7, 0x43, 0x4B,
+    0x04, 0x96, 0xBD, 0xCB, 0xB3, 0x77, 0xB1, 0x69, 0x75, 0x72, 0xB8, 0xC2, 0xE6, 0xF2, 0xC5, 0x15,
+    0xCB, 0xAA, 0xF6, 0x9A, 0x11, 0xBD, 0x54, 0xE6, 0xCB, 0x17, 0x9B, 0x8F, 0xE1, 0x3E, 0x46, 0x37,
+    0x48, 0xDB, 0x4E, 0x1D, 0x5F, 0x71, 0x1D, 0xC6, 0x29, 0xD4, 0x41, 0x83, 0xF3, 0x5B, 0x2F, 0x4E,
+    0x99, 0x65, 0x51, 0xC9, 0xEA, 0x36, 0xF9, 0x4D, 0x7A, 0x33, 0xB8, 0x28, 0xE4, 0x2B, 0x49, 0x60,
+    0xA7, 0x60, 0x64, 0x24, 0xD0, 0xEA, 0xB2, 0x03, 0x87, 0x83, 0xC3, 0x7A, 0xB7, 0x6D, 0x4D, 0x39,
+    0x1E, 0xAB, 0xC6, 0xBC, 0x49, 0x50, 0x73, 0xA2, 0x4B, 0x15, 0xE5, 0x50, 0xA6, 0x90, 0x8A, 0xFD,
+    0xFF, 0x8D, 0xB3, 0x4F, 0xA9, 0x3A, 0x78, 0xAC, 0x32, 0xA1, 0x9F, 0x85, 0xC6, 0xF6, 0x29, 0x2B,
+    0x3B, 0x9F, 0xB2, 0x08, 0x62, 0xE9, 0x6F, 0xA6, 0x34, 0x39, 0xAA, 0x48, 0xD2, 0xC4, 0x59, 0x61,
+    0xC9, 0x3B, 0xCC, 0xF7, 0x25, 0x03, 0xBC, 0x4E, 0x72, 0x21, 0x96, 0xEE, 0x62, 0xF2, 0xE5, 0xAC,
+    0x79, 0x4B, 0xFA, 0x9E, 0xB4, 0x65, 0xEB, 0x87, 0xEE, 0x21, 0xF3, 0x46, 0x96, 0xF5, 0x35, 0x0C,
+    0xD3, 0x69, 0xA5, 0xFE, 0x83, 0x31, 0x87, 0x45, 0x3C, 0x4F, 0x93, 0xF9, 0x36, 0x47, 0xCD, 0x4F,
+    0xEC, 0x60, 0xD3, 0x2E, 0x6A, 0x55, 0x28, 0x53, 0xF6, 0x13, 0x0A, 0x7F, 0xFA, 0x14, 0x55, 0xF6,
+    0x51, 0x6B, 0xCB, 0xB0, 0xB7, 0xE7, 0x23, 0x36, 0x9F, 0xE5, 0x4C, 0xE3, 0x08, 0x62, 0xF8, 0xFC,
+    0x5B, 0x2D, 0x86, 0xA7, 0xB8, 0x18, 0x5A, 0xBB, 0x48, 0x66, 0xD8, 0x66, 0xBA, 0x19, 0xC7, 0x6D,
+    0x61, 0x52, 0xCB, 0x62, 0x49, 0x1F, 0x88, 0x41, 0x3A, 0xA3, 0xC4, 0x33, 0x29, 0xB5, 0x84, 0xD5,
+    0x85, 0xBF, 0x78, 0x75, 0x42, 0x50, 0x75, 0x99, 0xD1, 0x95, 0x78, 0xCE, 0x02, 0x36, 0xDE, 0x3E,
+    0x8E, 0x38, 0x3B, 0x5D, 0x1D, 0x0A, 0x0E, 0x63, 0x36, 0xA9, 0x34, 0xDC, 0x5D, 0xE0, 0x1D, 0x49,
+    0xB4, 0x29, 0x87, 0x01, 0x6B, 0x05, 0x2B, 0x99, 0xB2, 0xAF, 0xB1, 0x25, 0xD3, 0xE0, 0xBA, 0xB0,
+    0x4D, 0xFA, 0xBE, 0x15, 0x0C, 0x36, 0x9F, 0xCF, 0x64, 0x25, 0x43, 0xEF, 0xD4, 0xB2, 0x4B, 0xFD,
+    0x0D, 0xBD, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0x3D, 0xF6, 0xB0, 0xB1, 0x84, 0x25, 0x86, 0x22,
+    0xDB, 0x10, 0x90, 0xFF, 0x40, 0x92, 0xA1, 0x5C, 0x09, 0xBF, 0x67, 0x2F, 0x5B, 0x6E, 0x91, 0x14,
+    0x59, 0xE8, 0x48, 0x4F, 0xB3, 0x4D, 0x0A, 0x8A, 0xB7, 0xFB, 0x1C, 0x52, 0x50, 0xA4, 0x20, 0x0D,
+    0x69, 0x68, 0x53, 0x41, 0x91, 0x14, 0x08, 0x09, 0xE9, 0xE5, 0x79, 0x50, 0x7E, 0x00, 0x0E, 0xBF,
+    0x60, 0x22, 0x10, 0x8A, 0x36, 0x05, 0x03, 0x31, 0xC4, 0xBB, 0x79, 0xF6, 0xE5, 0x8C, 0xDF, 0x86,
+    0x0F, 0x41, 0x81, 0x28, 0xF0, 0xDB, 0x99, 0x1D, 0xDF, 0x99, 0xB9, 0x1F, 0xE7, 0x9E, 0x7B, 0xBD,
+    0x79, 0x65, 0x63, 0xEF, 0xAA, 0xEC, 0xC8, 0xA3, 0x25, 0xF6, 0x2B, 0x5D, 0xAA, 0x46, 0x35, 0x68,
+    0xF9, 0x9B, 0xF0, 0xA7, 0x4B, 0x5D, 0x51, 0x10, 0x5E, 0xE7, 0x47, 0x3D, 0x12, 0x91, 0x12, 0x9B,
+    0x3B, 0x0D, 0x40, 0x01, 0xB8, 0x0F, 0x9E, 0x00, 0x78, 0x01, 0xC9, 0x50, 0x42, 0x8B, 0xDB, 0xBB,
+    0xB2, 0x49, 0x75, 0x85, 0x68, 0xF9, 0x48, 0x1E, 0xAE, 0x70, 0x48, 0x95, 0x06, 0x41, 0x47, 0x6A,
+    0x95, 0x43, 0x1B, 0x7B, 0x74, 0xBC, 0xB6, 0xC0, 0x94, 0x17, 0xFF, 0xEB, 0x86, 0x11, 0x3E, 0x43,
+    0x11, 0x66, 0x69, 0xFE, 0x3F, 0x83, 0xF3, 0xD1, 0xA0, 0x47, 0x78, 0x56, 0xE3, 0x7C, 0x71, 0x9C,
+    0xD3, 0x2A, 0xCC, 0x51, 0x33, 0xBE, 0xBC, 0x39, 0xCE, 0xD8, 0xDC, 0xDB, 0x03, 0x44, 0x56, 0x50,
+    0x47, 0x35, 0x71, 0x09, 0xE7, 0x73, 0xC5, 0xAB, 0xB7, 0xB4, 0xE5, 0x6E, 0xF1, 0x42, 0x85, 0x92,
+    0x81, 0x08, 0x1E, 0x49, 0x10, 0xCD, 0x83, 0x68, 0x01, 0xE5, 0xA3, 0x16, 0xDA, 0x26, 0x0D, 0x45,
+    0x86, 0xA2, 0xB8, 0xC3, 0xB9, 0x13, 0xA9, 0xA8, 0xEC, 0xFB, 0xB5, 0xEA, 0xBD, 0x2B, 0x88, 0xF6,
+    0x2E, 0x89, 0x85, 0xF4, 0x59, 0x83, 0xE8, 0x3E, 0xEF, 0x20, 0xB1, 0x29, 0xF5, 0xCE, 0xFE, 0xBE,
+    0x94, 0x8E, 0xCB, 0xE5, 0xDD, 0x36, 0x48, 0xB5, 0x0D, 0xD2, 0x83, 0xB0, 0x54, 0x2E, 0x2C, 0x27,
+    0x61, 0x99, 0x04, 0x69, 0xB4, 0x4A, 0xAC, 0x79, 0x22, 0xB1, 0x7C, 0x2C, 0x43, 0x29, 0xFD, 0xEF,
+    0x86, 0x34, 0xCD, 0xD0, 0x48, 0x50, 0x16, 0xB4, 0xFE, 0xE9, 0x1F, 0x0F, 0x2D, 0x3F, 0xEF, 0x52,
+    0x9B, 0x36, 0x0B, 0x14, 0xA9, 0x8D, 0xFD, 0x02, 0x26, 0xE8, 0x5D, 0x60, 0x65, 0x9E, 0xCB, 0x25,
+    0x91, 0x11, 0x14, 0xBC, 0x5F, 0x62, 0x2E, 0x4E, 0x1D, 0xEF, 0xB7, 0x1A, 0x89, 0xCF, 0x91, 0xB8,
+    0x7B, 0x08, 0x10, 0x18, 0xB2, 0xE6, 0x00, 0xB5, 0x74, 0x4A, 0xC4, 0x01, 0xD9, 0xF8, 0x8A, 0xD8,
+    0x13, 0xAB, 0x9B, 0x15, 0x16, 0x45, 0x99, 0xBA, 0xF9, 0xD1, 0xC0, 0xBB, 0x15, 0xA2, 0x72, 0x74,
+    0xE5, 0xCC, 0x1D, 0x14, 0x82, 0x4C, 0x5C, 0xD4, 0xC3, 0xDC, 0x16, 0x62, 0x63, 0xCA, 0xD4, 0xA7,
+    0x96, 0x57, 0xFB, 0xD8, 0x53, 0x67, 0x56, 0x2D, 0x98, 0x3E, 0xE5, 0x0D, 0xF1, 0xC3, 0x22, 0x3D,
+    0x22, 0xBE, 0x26, 0x16, 0x09, 0x2E, 0x2F, 0xE8, 0x75, 0xEC, 0x4D, 0xCC, 0x8D, 0x55, 0x6A, 0x0F,
+    0x81, 0xE9, 0xFA, 0x46, 0xB9, 0x20, 0xBA, 0xDA, 0x1A, 0x14, 0x15, 0xE7, 0xC7, 0x6A, 0xA8, 0x2D,
+    0x6D, 0x98, 0xB5, 0xEF, 0x67, 0xD7, 0x79, 0x04, 0x75, 0x84, 0x00, 0x2A, 0xE5, 0x4F, 0xEB, 0x62,
+    0x46, 0x76, 0x64, 0x38, 0x2D, 0x94, 0xFB, 0x14, 0x04, 0x30, 0xE8, 0x6A, 0x89, 0x82, 0x82, 0xAC,
+    0x0C, 0xE9, 0x63, 0xE5, 0x58, 0xCD, 0x20, 0x48, 0x2A, 0x7F, 0x66, 0xD8, 0x75, 0xA9, 0x3C, 0x2A,
+    0xD7, 0xA8, 0x46, 0xB5, 0x8B, 0x4F, 0x96, 0x68, 0xB5, 0xCD, 0x23, 0x1F, 0x12, 0xC5, 0x48, 0xCE,
+    0x89, 0x35, 0x47, 0xDE, 0x60, 0xC6, 0x70, 0x82, 0x67, 0xF3, 0xBB, 0x72, 0x73, 0x30, 0xF6, 0xEC,
+    0xFA, 0x06, 0xDE, 0x61, 0x1E, 0xBD, 0x7E, 0xD2, 0xB2, 0xD4, 0x18, 0x08, 0x6D, 0x84, 0x8B, 0x5F,
+    0x89, 0x33, 0x83, 0x68, 0x97, 0x3C, 0x75, 0x58, 0x30, 0x8A, 0x43, 0xA8, 0x1F, 0x2D, 0x7E, 0xF5,
+    0x98, 0x1C, 0x20, 0xA3, 0xF1, 0xEB, 0xC3, 0xBE, 0xCD, 0x18, 0xC9, 0x26, 0xB9, 0x25, 0x2E, 0x1D,
+    0xEA, 0x72, 0x42, 0xD5, 0xE5, 0x4C, 0x35, 0x19, 0x8E, 0xAF, 0x52, 0xD6, 0xE8, 0xED, 0xFB, 0xAA,
+    0xD1, 0x55, 0xAB, 0xDC, 0x04, 0xAD, 0xB9, 0xBD, 0x2A, 0x24, 0xD4, 0x34, 0x77, 0x7A, 0x23, 0xBD,
+    0x72, 0x17, 0x94, 0x7B, 0x43, 0xB9, 0xD7, 0x03, 0xA6, 0x7F, 0xFD, 0x4B, 0x4F, 0x78, 0xA6, 0x64,
+    0xE2, 0xD6, 0xC9, 0xCB, 0xC9, 0xFF, 0x30, 0xB6, 0x4E, 0xC7, 0x35, 0x8E, 0x7B, 0x1C, 0x3E, 0xAD,
+    0x22, 0x97, 0x56, 0xCA, 0xA6, 0x55, 0x76, 0x52, 0x3F, 0x66, 0xF5, 0xF4, 0x0C, 0x36, 0xCF, 0x4F,
+    0xC7, 0x16, 0x70, 0xFE, 0x55, 0xE0, 0xA5, 0x50, 0x40, 0x03, 0x86, 0x5A, 0x57, 0x53, 0x32, 0xD5,
+    0x45, 0x63, 0x91, 0x0D, 0xED, 0x68, 0x88, 0x29, 0xB2, 0x4C, 0x47, 0xC7, 0x8C, 0x44, 0x97, 0xD7,
+    0x58, 0x98, 0x48, 0xEC, 0xCA, 0x7C, 0xBD, 0xDC, 0x59, 0x45, 0x2E, 0x4F, 0x68, 0x29, 0xD7, 0xC0,
+    0x56, 0x7E, 0x01, 0xB8, 0x70, 0xF0, 0x01, 0xB7, 0x59, 0x72, 0x98, 0xE5, 0x6C, 0x4C, 0x5D, 0x9E,
+    0x11, 0xA7, 0x9C, 0xE5, 0xCB, 0x73, 0x8D, 0xB6, 0x87, 0xB1, 0x9F, 0x2B, 0xB1, 0x7D, 0x00, 0x75,
+    0x34, 0x2A, 0xDB, 0x27, 0xF2, 0x72, 0x60, 0x1D, 0x6D, 0xD9, 0x0D, 0xB2, 0xB8, 0x43, 0xD4, 0x21,
+    0xFE, 0xA9, 0x4C, 0xBF, 0xC1, 0xB4, 0xF8, 0xD4, 0x17, 0x03, 0x36, 0x98, 0xD2, 0x55, 0x2A, 0xBB,
+    0x7D, 0x2C, 0x15, 0x33, 0x1A, 0xBA, 0xA1, 0x25, 0x64, 0x1E, 0x6D, 0x96, 0x63, 0x92, 0x51, 0xF0,
+    0x9E, 0xB2, 0x6A, 0x80, 0xC7, 0x80, 0x3C, 0xF4, 0x0B, 0x98, 0x5B, 0x69, 0x57, 0xAC, 0x34, 0xB9,
+    0x70, 0x4D, 0x55, 0xB8, 0xC8, 0x44, 0x25, 0x4D, 0x47, 0x72, 0x74, 0x78, 0xF1, 0xD0, 0x87, 0xBA,
+    0xAD, 0x1B, 0xD3, 0x31, 0x8F, 0x54, 0xC4, 0x9A, 0x9F, 0x40, 0xA0, 0xB7, 0x9F, 0x5A, 0xF5, 0xD0,
+    0x7B, 0xFC, 0xE2, 0x72, 0x14, 0x8E, 0x9A, 0x9D, 0x0A, 0xDD, 0xC8, 0xC7, 0xC7, 0xA8, 0x6F, 0x88,
+    0x5D, 0xA7, 0x46, 0x7C, 0xF6, 0xB6, 0x94, 0x3D, 0xC9, 0x43, 0x16, 0x7C, 0x01, 0xBD, 0x53, 0x81,
+    0xA0, 0x51, 0x0C, 0xF5, 0xAD, 0xE7, 0x6B, 0x13, 0x4A, 0x3A, 0x50, 0x2B, 0x6D, 0x75, 0xC5, 0xC3,
+    0x2C, 0xB4, 0x0D, 0x1A, 0x94, 0x56, 0xB3, 0x1E, 0x95, 0x6D, 0xF1, 0x0A, 0x8D, 0x6E, 0x91, 0x46,
+    0xCC, 0x78, 0x42, 0x9E, 0x9E, 0x0F, 0x3E, 0xE8, 0x32, 0xA9, 0x26, 0xF1, 0x8C, 0x14, 0x70, 0x69,
+    0xB7, 0x84, 0xB4, 0x81, 0xA8, 0x73, 0x8B, 0xFA, 0xC3, 0x01, 0xBA, 0xD5, 0x3E, 0xEE, 0xF1, 0xBC,
+    0x7A, 0xAB, 0xD1, 0x79, 0x3A, 0xC1, 0xCF, 0xCD, 0x77, 0x8D, 0xCE, 0xCE, 0x4F, 0xE0, 0x9F, 0xDD,
+    0x68, 0x74, 0xE2, 0xB9, 0x98, 0x12, 0x90, 0xC8, 0x4E, 0xE8, 0x67, 0xD2, 0x89, 0x67, 0x74, 0x21,
+    0xFC, 0xDD, 0x21, 0x96, 0x72, 0xFA, 0xE2, 0xEB, 0xC1, 0xA6, 0x8A, 0xE3, 0xBD, 0x03, 0xB2, 0x46,
+    0x4A, 0xFD, 0xC9, 0xBB, 0x6B, 0x41, 0xE8, 0xB1, 0x63, 0x87, 0xA5, 0xD5, 0xA2, 0x0F, 0x88, 0x61,
+    0xC4, 0x49, 0xEA, 0x86, 0xED, 0x68, 0x06, 0xB3, 0x4F, 0x42, 0xB3, 0xED, 0xB9, 0x90, 0x18, 0x5D,
+    0x43, 0x3D, 0xA1, 0xAF, 0x2B, 0x74, 0xE6, 0x87, 0x55, 0xC4, 0xAE, 0xB6, 0x71, 0x39, 0xA8, 0x93,
+    0x94, 0x83, 0x86, 0x58, 0x8E, 0x55, 0x42, 0xBC, 0xA2, 0xD0, 0xBB, 0x67, 0xF8, 0x47, 0x81, 0x71,
+    0xD9, 0xE3, 0x60, 0x68, 0xCC, 0xC2, 0x32, 0xEB, 0xF4, 0x20, 0xAB, 0xB8, 0x8F, 0xBB, 0xA4, 0x51,
+    0x3E, 0x23, 0xD7, 0x66, 0xC8, 0xB6, 0x7D, 0x68, 0x8F, 0xD1, 0xE9, 0xEB, 0x34, 0xF2, 0xB1, 0x4F,
+    0x58, 0x38, 0x6C, 0x3A, 0xA1, 0x4E, 0x43, 0xD5, 0x11, 0x5E, 0xAA, 0x62, 0x4F, 0x68, 0xF0, 0xDA,
+    0x67, 0xA3, 0xCB, 0x89, 0x94, 0xCB, 0x7A, 0xD7, 0x4E, 0x73, 0x7C, 0xC9, 0x14, 0x30, 0x21, 0xA4,
+    0x1E, 0xBB, 0x10, 0xD2, 0x26, 0x74, 0x4E, 0xF2, 0x31, 0x13, 0x1B, 0x8D, 0xCE, 0x3E, 0xE0, 0xF7,
+    0x20, 0xCF, 0xD4, 0x83, 0xEB, 0x3E, 0xDF, 0xCA, 0xE2, 0x2A, 0xA8, 0xCB, 0xD6, 0x5A, 0xFF, 0xF8,
+    0xC7, 0xAF, 0xA8, 0x62, 0x74, 0xF3, 0xCE, 0x74, 0x72, 0x6B, 0x9F, 0xD4, 0x61, 0xD1, 0x46, 0x6C,
+    0x3C, 0xEC, 0x25, 0x36, 0x47, 0x16, 0x3B, 0x4C, 0xC9, 0xF7, 0x19, 0x99, 0xFE, 0x8C, 0x2D, 0x8D,
+    0x1F, 0x0F, 0x7E, 0x9A, 0xC7, 0x9E, 0x4C, 0xC6, 0x47, 0x6E, 0x54, 0x71, 0x42, 0x36, 0x30, 0xC8,
+    0xC4, 0xE1, 0x5F, 0x3E, 0xBF, 0x01, 0xA5, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0x3D, 0xF6, 0x64,
+    0xD7, 0x12, 0x46, 0x4C, 0x8A, 0x44, 0x8A, 0x94, 0x10, 0x37, 0x48, 0x20, 0x41, 0x76, 0x28, 0x28,
+    0xB6, 0x78, 0x5E, 0x3B, 0xA4, 0x48, 0x41, 0x93, 0x22, 0x41, 0x42, 0x91, 0xE0, 0x07, 0x50, 0x90,
+    0x22, 0xE5, 0xDB, 0xB5, 0xC5, 0x1F, 0x20, 0x29, 0xA8, 0xA1, 0x48, 0x11, 0x65, 0x8B, 0xA5, 0xA0,
+    0xD8, 0xC2, 0x59, 0x3B, 0x89, 0x04, 0xAD, 0x23, 0x24, 0x5A, 0x2C, 0xB4, 0x08, 0xB4, 0x14, 0x19,
+    0x45, 0x96, 0x98, 0xDD, 0xB5, 0x3D, 0x9C, 0xB1, 0xDF, 0x0B, 0x81, 0xA4, 0x00, 0xE1, 0xF7, 0x66,
+    0x34, 0x73, 0x7D, 0xE7, 0xCE, 0xFD, 0x38, 0xE7, 0x1A, 0x48, 0x81, 0xB0, 0x05, 0xFC, 0xFB, 0x00,
+    0x24, 0x37, 0xA2, 0xE6, 0x82, 0x02, 0xC4, 0x14, 0xDA, 0x1E, 0xA1, 0xB5, 0x6D, 0x58, 0xB7, 0xD9,
+    0xA5, 0x3A, 0x16, 0x4F, 0xB5, 0x4C, 0xE7, 0x46, 0xD4, 0x72, 0x0B, 0xAD, 0xF8, 0x29, 0x8F, 0xF1,
+    0x87, 0x13, 0x6C, 0x8A, 0x5A, 0xC9, 0xBA, 0x55, 0xB0, 0xA5, 0x4D, 0x03, 0x3B, 0xFC, 0xDD, 0xC6,
+    0x68, 0x54, 0x51, 0xF8, 0xCA, 0xBD, 0x14, 0x89, 0x49, 0x5A, 0x5B, 0x97, 0x39, 0xCF, 0x63, 0x93,
+    0x2F, 0x8A, 0x6F, 0x81, 0x32, 0x07, 0x3A, 0x20, 0x30, 0xC0, 0xCC, 0x40, 0x3C, 0x68, 0x11, 0xFB,
+    0x3A, 0x68, 0x03, 0x53, 0xB6, 0x65, 0x9B, 0x74, 0x91, 0x0D, 0x07, 0x61, 0xD3, 0x0D, 0x28, 0xC8,
+    0x3C, 0xAC, 0x44, 0xE3, 0x6B, 0x18, 0x14, 0x78, 0xA9, 0x40, 0x1D, 0x94, 0x26, 0xB1, 0xD6, 0x2E,
+    0xE3, 0xD0, 0x1C, 0xEF, 0x70, 0x04, 0x1C, 0x48, 0x4B, 0x5D, 0x3E, 0xB5, 0x9F, 0xDB, 0xD4, 0x78,
+    0x5A, 0x34, 0x41, 0x25, 0xF3, 0x88, 0x47, 0xE6, 0xC8, 0x3E, 0xD4, 0xC8, 0x6C, 0x85, 0x95, 0x88,
+    0x4A, 0x73, 0xC0, 0xE3, 0xA9, 0xB3, 0x86, 0xC1, 0x6B, 0x65, 0xB2, 0x9F, 0xED, 0x43, 0x7B, 0xB9,
+    0x8B, 0x5A, 0x06, 0xCD, 0x77, 0x31, 0x74, 0x50, 0xFD, 0xCB, 0x65, 0x79, 0xEF, 0x68, 0xE7, 0x37,
+    0xE7, 0x8C, 0xAD, 0xFE, 0xB7, 0x9D, 0x31, 0x28, 0xDB, 0x60, 0x91, 0xD2, 0x29, 0xB8, 0x31, 0x32,
+    0x78, 0x95, 0x9B, 0x4F, 0x24, 0xB6, 0x45, 0x42, 0x8D, 0x99, 0x04, 0xD6, 0x39, 0xDE, 0x93, 0x2E,
+    0xF5, 0xF6, 0x16, 0xE4, 0x93, 0x16, 0x92, 0xE9, 0x91, 0x98, 0x2D, 0x46, 0x01, 0xB5, 0xDD, 0xC2,
+    0xDA, 0xDC, 0x1D, 0x4C, 0x7A, 0x64, 0xBD, 0x32, 0x48, 0xE8, 0x19, 0xDC, 0x95, 0xCF, 0xA6, 0xE3,
+    0x7D, 0x4E, 0x76, 0x70, 0x5B, 0x35, 0xFA, 0x72, 0x79, 0x39, 0x45, 0x41, 0x15, 0x1E, 0xF5, 0x21,
+    0x9D, 0xDA, 0xE7, 0xF1, 0x85, 0x95, 0x70, 0x18, 0x7D, 0x63, 0x51, 0x9D, 0x73, 0x04, 0x4E, 0xF2,
+    0x84, 0xE0, 0x20, 0x36, 0x64, 0x4A, 0xD3, 0x8C, 0x47, 0x1D, 0x18, 0xE7, 0xE4, 0xF4, 0xF8, 0xB6,
+    0x8E, 0x76, 0xDA, 0xB7, 0x5C, 0xE1, 0x37, 0xC1, 0xD2, 0x5D, 0xCB, 0xE8, 0x10, 0x4E, 0xAD, 0x71,
+    0x7D, 0x0A, 0xF1, 0x0C, 0x45, 0xB2, 0xAD, 0x25, 0x3D, 0xBC, 0x3A, 0xA9, 0x4B, 0x8B, 0xAC, 0xF5,
+    0x6D, 0xBE, 0x57, 0xE6, 0x32, 0x2F, 0xFC, 0x56, 0x34, 0x31, 0x0F, 0x99, 0x08, 0x61, 0xB5, 0x71,
+    0xBD, 0xF2, 0xA8, 0xAA, 0x31, 0x17, 0xBF, 0x14, 0x88, 0x16, 0xC2, 0xA0, 0x16, 0x8D, 0xCC, 0x3B,
+    0x4F, 0x87, 0x26, 0xFA, 0xB1, 0x95, 0xF6, 0xE2, 0x78, 0xF3, 0xCA, 0x15, 0xE0, 0x6D, 0x5B, 0x2B,
+    0x6B, 0x02, 0x7A, 0x54, 0x88, 0x3A, 0xAC, 0x62, 0x6C, 0x89, 0xDA, 0xB7, 0xF7, 0x11, 0xD8, 0x1A,
+    0xBB, 0x31, 0x22, 0x51, 0x3B, 0xE3, 0x1D, 0xA3, 0x13, 0xF6, 0x31, 0x71, 0xE4, 0x01, 0xE7, 0x01,
+    0xB2, 0x83, 0x91, 0x16, 0xC0, 0x8D, 0xA5, 0xFF, 0x79, 0xB2, 0xF3, 0xA8, 0x91, 0x5F, 0x41, 0xED,
+    0x12, 0x3C, 0xEE, 0xA1, 0x0A, 0x41, 0xA3, 0x11, 0x68, 0x72, 0x66, 0x08, 0x59, 0x8B, 0xAB, 0x58,
+    0xC5, 0xAD, 0x2D, 0x59, 0x99, 0x04, 0xE9, 0xC9, 0xE9, 0x9C, 0x32, 0xE2, 0xA8, 0xDB, 0xC0, 0xA1,
+    0xF6, 0x8F, 0xF3, 0x60, 0x3C, 0x76, 0x5C, 0x13, 0xC6, 0xC4, 0x21, 0x32, 0x52, 0xC1, 0x36, 0xE5,
+    0x80, 0x95, 0xD4, 0x91, 0x92, 0x18, 0x5E, 0xED, 0x27, 0x1A, 0x7D, 0x7A, 0xF4, 0xB5, 0x67, 0xE9,
+    0x5E, 0x3C, 0x6D, 0xC5, 0x77, 0x3D, 0x13, 0x32, 0x20, 0xB9, 0xDD, 0xA3, 0xF5, 0x48, 0x47, 0xC1,
+    0x44, 0xBB, 0x48, 0x14, 0xDF, 0xCE, 0x45, 0xED, 0xB9, 0xED, 0x83, 0x32, 0x57, 0x91, 0xC5, 0xEE,
+    0x84, 0x15, 0x87, 0x6C, 0xF2, 0x2B, 0xAC, 0x46, 0x9B, 0x32, 0x9F, 0x62, 0x60, 0x99, 0x79, 0x79,
+    0x05, 0x66, 0x7D, 0x7D, 0x51, 0x97, 0xC4, 0xF6, 0xCA, 0xF6, 0xA2, 0xB9, 0x20, 0x9A, 0xD7, 0x45,
+    0x73, 0x4E, 0x34, 0xF8, 0xC7, 0x3F, 0x3C, 0xA2, 0x4E, 0xEA, 0x70, 0x67, 0x1B, 0x79, 0xD0, 0xAD,
+    0x61, 0x3E, 0xC7, 0x3A, 0x6F, 0x31, 0xA7, 0x5D, 0x01, 0x0F, 0xAF, 0xB9, 0x6B, 0x98, 0xA6, 0x24,
+    0x85, 0xB2, 0x5D, 0xC0, 0xB2, 0x9C, 0x76, 0x66, 0x33, 0x13, 0x5D, 0xFF, 0xA1, 0xBA, 0x30, 0xC3,
+    0xA3, 0x16, 0xAA, 0x45, 0xC9, 0xFF, 0x03, 0xEC, 0xDD, 0xF0, 0x7F, 0xCD, 0xD7, 0xB6, 0xAE, 0x3F,
+    0xB2, 0xDA, 0xBB, 0xE2, 0x48, 0xDA, 0x84, 0x3A, 0x68, 0x26, 0x3F, 0xCE, 0x36, 0x59, 0x23, 0x5E,
+    0xF8, 0x85, 0x87, 0xD9, 0x70, 0xC6, 0xBF, 0xA4, 0xBB, 0x24, 0xAC, 0x16, 0x19, 0x5D, 0x35, 0x1E,
+    0x61, 0x62, 0x5C, 0x4C, 0x2F, 0x4C, 0x6A, 0x3F, 0x1A, 0x41, 0x5E, 0xB0, 0x76, 0xDD, 0xA2, 0x6E,
+    0x5D, 0xD8, 0x71, 0x3F, 0x7F, 0xE9, 0xAF, 0x80, 0x09, 0xB4, 0xAA, 0xD6, 0x20, 0xD8, 0xF3, 0xDC,
+    0x44, 0x67, 0x66, 0xAE, 0x7D, 0xAD, 0x3F, 0x37, 0x91, 0x52, 0x37, 0x1D, 0xA7, 0xBE, 0x91, 0x69,
+    0x01, 0x66, 0x7A, 0xE6, 0x35, 0x9C, 0xDE, 0xAC, 0xB8, 0x65, 0xCA, 0xB7, 0xF5, 0x9E, 0x63, 0xD6,
+    0xE8, 0x1B, 0x7B, 0xD7, 0x40, 0x5A, 0x04, 0x83, 0x03, 0xF8, 0x9A, 0x4B, 0x7B, 0x98, 0x33, 0x85,
+    0x3E, 0xAD, 0x1E, 0x5E, 0x1B, 0xEE, 0xC2, 0x71, 0xBA, 0x91, 0x5F, 0x7E, 0x92, 0x17, 0x4E, 0x28,
+    0x53, 0x83, 0x5D, 0x51, 0x53, 0xD3, 0xD3, 0xAA, 0x89, 0x48, 0x96, 0x3E, 0x7A, 0x46, 0x17, 0xDE,
+    0x2C, 0xB9, 0x1E, 0x01, 0xE1, 0xDC, 0x20, 0x22, 0x10, 0x91, 0x63, 0xCF, 0x1A, 0xAC, 0x78, 0xC8,
+    0x5B, 0x8E, 0x99, 0xEE, 0xE4, 0xF1, 0xC0, 0x8B, 0x64, 0x4E, 0x50, 0x6B, 0xC2, 0xA1, 0x80, 0x83,
+    0x85, 0x83, 0xC7, 0x52, 0xE0, 0x95, 0x79, 0x76, 0xDB, 0xEA, 0x6C, 0x91, 0x10, 0xF6, 0x3A, 0x22,
+    0xC0, 0x91, 0xD0, 0xE1, 0xE4, 0x55, 0x2C, 0x9F, 0xA4, 0x0B, 0xEA, 0xB2, 0x4E, 0xD2, 0x58, 0x54,
+    0x68, 0x2F, 0xF0, 0x65, 0x03, 0x82, 0x9D, 0x62, 0x42, 0xB0, 0xE0, 0x96, 0x4D, 0xE5, 0xA2, 0x46,
+    0x2C, 0xB4, 0x4F, 0xB4, 0x50, 0x99, 0x76, 0xBC, 0x14, 0x27, 0x78, 0x32, 0x74, 0xEE, 0xB8, 0xC6,
+    0x9B, 0x60, 0xB1, 0x38, 0x87, 0xE7, 0xCC, 0x86, 0xF6, 0x83, 0x9E, 0xEC, 0x89, 0xD9, 0x88, 0x64,
+    0x2A, 0x5D, 0x4B, 0xA1, 0x5B, 0xD1, 0x0C, 0x71, 0x44, 0xC1, 0xC7, 0xA2, 0x12, 0x03, 0x7D, 0x1A,
+    0xD8, 0xA8, 0x36, 0xA8, 0xA1, 0x6E, 0x91, 0x87, 0x9D, 0xB4, 0xA9, 0x5F, 0x9D, 0xE1, 0x96, 0x6D,
+    0x8A, 0x88, 0x55, 0xFD, 0xD2, 0x5A, 0xC0, 0x6E, 0xFE, 0xC5, 0xE1, 0x6A, 0xEF, 0xC2, 0x55, 0x04,
+    0x79, 0xEC, 0x02, 0x14, 0xEC, 0x07, 0x2C, 0x61, 0x43, 0x26, 0x7E, 0x9F, 0x43, 0xB2, 0xA1, 0xAB,
+    0x66, 0x04, 0xA4, 0xC3, 0xA5, 0x0B, 0xF2, 0xFC, 0xD8, 0xE2, 0xE5, 0x0E, 0x85, 0xF4, 0x6E, 0x6B,
+    0xAA, 0xD4, 0x7F, 0xFC, 0xCA, 0xEC, 0xBB, 0xE2, 0x8D, 0x9C, 0x72, 0x95, 0x45, 0xE0, 0x1A, 0x85,
+    0xEB, 0xC9, 0xEF, 0x72, 0xDC, 0xBB, 0xEB, 0x1A, 0x56, 0xBA, 0xE0, 0x19, 0x55, 0xD8, 0x1F, 0xBA,
+    0xE0, 0x68, 0x28, 0xAB, 0x9B, 0x32, 0x5F, 0x0F, 0x60, 0x44, 0x7A, 0x72, 0xF9, 0x8A, 0x8A, 0x77,
+    0xC8, 0x75, 0x16, 0x4E, 0xE6, 0xAA, 0x1A, 0x6F, 0x70, 0xC1, 0x70, 0xB1, 0x39, 0xDE, 0x0B, 0xE3,
+    0x19, 0x7C, 0xF6, 0xBB, 0x75, 0x84, 0x4F, 0xA7, 0xA0, 0x3F, 0x9A, 0xB0, 0x70, 0xB6, 0x9E, 0x2A,
+    0x1F, 0xBB, 0xE3, 0x9D, 0x38, 0x3E, 0xD6, 0xAF, 0xC9, 0xF7, 0xAB, 0x37, 0xE2, 0x95, 0xA9, 0x47,
+    0x1C, 0xDC, 0xE1, 0x11, 0x83, 0xD8, 0x6B, 0xF9, 0xA9, 0x6E, 0x5C, 0x17, 0x26, 0x4A, 0xB1, 0xB7,
+    0xDD, 0x48, 0xDB, 0xFF, 0x55, 0x0E, 0xFC, 0x09, 0x7D, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE,
+    0xEC, 0x61, 0xCF, 0x12, 0x23, 0x98, 0x86, 0x28, 0x11, 0x47, 0xE2, 0x86, 0x06, 0xE5, 0xEE, 0x4C,
+    0x41, 0x91, 0xC2, 0xBB, 0xF6, 0x71, 0x48, 0x14, 0x14, 0x9C, 0x50, 0xB6, 0xA2, 0x49, 0x89, 0x82,
+    0x44, 0x28, 0x28, 0x52, 0xEC, 0xE5, 0x2C, 0xF2, 0x0F, 0xD0, 0x50, 0xD1, 0x20, 0x44, 0xC3, 0x51,
+    0x5C, 0x04, 0x41, 0x42, 0xC2, 0xD9, 0x9D, 0x5C, 0x0A, 0x8A, 0x14, 0x99, 0x20, 0x21, 0x10, 0x95,
+    0x91, 0x4E, 0x51, 0x94, 0x14, 0x37, 0x08, 0x47, 0xF2, 0x5D, 0xBC, 0x1E, 0xBE, 0xF1, 0x72, 0x81,
+    0x48, 0x08, 0x6B, 0xFD, 0xE3, 0xCD, 0xBC, 0x79, 0xEF, 0x7B, 0xEF, 0x7D, 0xEF, 0x2D, 0x96, 0xBE,
+    0x02, 0xA4, 0xEB, 0x20, 0x0E, 0x97, 0x5B, 0xB4, 0x90, 0x36, 0xC9, 0x91, 0x6D, 0x54, 0x08, 0x9A,
+    0x2D, 0x40, 0xDD, 0xD6, 0x40, 0xD9, 0xED, 0xEC, 0xEC, 0xDE, 0x71, 0xCE, 0xB5, 0x2D, 0x55, 0xFB,
+    0x95, 0x1B, 0xDC, 0xBA, 0x6A, 0x11, 0xD4, 0x19, 0x95, 0xD1, 0x21, 0xD6, 0x51, 0xB7, 0x6B, 0x69,
+    0xA7, 0x01, 0x06, 0x9B, 0xE8, 0xAF, 0xED, 0x06, 0x6E, 0x66, 0xCA, 0xA0, 0x9D, 0x20, 0xFE, 0x00,
+    0xE2, 0xE0, 0xD3, 0x31, 0x4D, 0xB8, 0xC3, 0xF1, 0xBB, 0x33, 0x88, 0x87, 0x1A, 0xB6, 0x45, 0x93,
+    0xDC, 0x6B, 0x03, 0x1E, 0xE1, 0x89, 0x13, 0x63, 0x04, 0x5F, 0xF0, 0x33, 0xBB, 0xDB, 0x21, 0x74,
+    0xEB, 0x0D, 0xD4, 0x1B, 0xC2, 0x62, 0x02, 0xA9, 0x45, 0x85, 0x38, 0x57, 0xA0, 0x9B, 0x09, 0x1D,
+    0x87, 0x06, 0xA8, 0x29, 0x89, 0x8A, 0x52, 0xB4, 0x47, 0x49, 0xBD, 0x4D, 0x5F, 0x6B, 0x29, 0x1F,
+    0x57, 0x28, 0xC1, 0xF1, 0x0E, 0x89, 0x13, 0xC2, 0xE0, 0x9F, 0x8B, 0x58, 0xDA, 0x6C, 0x5F, 0xB4,
+    0xAA, 0x88, 0x7E, 0x95, 0x5A, 0x71, 0x93, 0x77, 0xB5, 0x8A, 0xC0, 0xF2, 0x60, 0x7D, 0x19, 0xF8,
+    0xFE, 0x1A, 0x90, 0x5A, 0x7A, 0xE1, 0xA9, 0x98, 0x11, 0xAA, 0x62, 0x71, 0xF0, 0x19, 0xE4, 0x80,
+    0x8D, 0x34, 0xB5, 0x33, 0x3A, 0x74, 0x54, 0x09, 0xCE, 0x2F, 0xB6, 0x06, 0xE3, 0x7C, 0x30, 0xCE,
+    0x1C, 0xB6, 0xBB, 0xD8, 0xE0, 0x52, 0x91, 0x00, 0x5B, 0x28, 0x21, 0xEA, 0xD0, 0xD2, 0x0A, 0x71,
+    0x1F, 0xE4, 0x09, 0x86, 0x43, 0x94, 0xC2, 0x70, 0x69, 0x28, 0x8C, 0xBC, 0x65, 0x54, 0x9E, 0x8C,
+    0x30, 0xC4, 0xAC, 0x42, 0x1D, 0x32, 0xE3, 0x46, 0x56, 0xE0, 0x12, 0x30, 0x0C, 0xBB, 0x62, 0xA9,
+    0xDB, 0xA6, 0x2D, 0x0F, 0x1F, 0x35, 0x6F, 0xBA, 0x04, 0x56, 0xBD, 0x64, 0x7D, 0x30, 0xF9, 0xC2,
+    0xE7, 0x47, 0xA2, 0xC0, 0x5A, 0x60, 0x11, 0x99, 0xA6, 0x0F, 0xEA, 0xF8, 0x12, 0x4E, 0xCF, 0xEA,
+    0x99, 0x49, 0x1A, 0x46, 0x6D, 0x79, 0xBE, 0xA5, 0x17, 0x07, 0xB5, 0xFE, 0xA7, 0x16, 0x77, 0xAD,
+    0xC5, 0xA3, 0x2A, 0x45, 0x56, 0x29, 0xA8, 0x4A, 0xF8, 0x7C, 0xDA, 0xF0, 0x10, 0xB3, 0xAB, 0x4E,
+    0x3B, 0xEF, 0xC8, 0x67, 0xEE, 0x0C, 0x6F, 0x79, 0xEC, 0x26, 0x67, 0x2D, 0xE0, 0x98, 0xC2, 0x6D,
+    0x4A, 0x25, 0x70, 0xF6, 0xA8, 0x08, 0x1C, 0x71, 0x11, 0xA7, 0x17, 0x43, 0xE7, 0x72, 0xF9, 0x60,
+    0xC6, 0x78, 0x93, 0xBC, 0x44, 0xC6, 0x68, 0x4B, 0xA9, 0x43, 0x9B, 0x30, 0x65, 0x25, 0x5A, 0xD9,
+    0x39, 0xE3, 0xDC, 0x02, 0xD8, 0xA0, 0x40, 0x4C, 0x8E, 0xF0, 0x8C, 0x2F, 0x98, 0x46, 0xEC, 0xCC,
+    0xD2, 0xF4, 0xCB, 0xBF, 0x05, 0x1F, 0x56, 0xD6, 0xE5, 0xEA, 0x61, 0x2D, 0x74, 0x02, 0x2B, 0x74,
+    0x0A, 0xAB, 0x50, 0x2E, 0x3F, 0x98, 0xC7, 0x8B, 0xE3, 0x83, 0x9D, 0x4D, 0xE5, 0x9C, 0x89, 0x6F,
+    0xCE, 0x72, 0x6F, 0x57, 0x4B, 0x5D, 0x62, 0x22, 0xF7, 0xF8, 0xBA, 0xDC, 0xC8, 0x3D, 0x87, 0xE9,
+    0xAE, 0x91, 0x44, 0x59, 0x06, 0xCC, 0xB5, 0xF4, 0xC0, 0xA4, 0xEE, 0xF1, 0x25, 0x87, 0x50, 0xAE,
+    0xEA, 0x01, 0x4C, 0xE3, 0x46, 0x75, 0xAE, 0x0D, 0xE7, 0x61, 0x13, 0x19, 0x61, 0x63, 0xAA, 0x90,
+    0x8B, 0xEB, 0xE4, 0x55, 0xA4, 0xD7, 0x6D, 0x1C, 0xBD, 0xA5, 0x27, 0x6A, 0x14, 0x58, 0x65, 0xA3,
+    0xCE, 0xE5, 0x31, 0x8D, 0x4D, 0x70, 0x8E, 0xC9, 0xDD, 0xF4, 0xB9, 0x8F, 0x7D, 0xA4, 0x06, 0x2F,
+    0xEE, 0xF8, 0x94, 0x04, 0x14, 0xB8, 0xF6, 0xDD, 0x78, 0xBC, 0x45, 0x0A, 0xBF, 0x79, 0xB4, 0x53,
+    0x94, 0x7D, 0x3E, 0xE8, 0x92, 0xF1, 0xE3, 0x7F, 0x85, 0xD9, 0x3E, 0xD8, 0x5D, 0xBC, 0x5E, 0xF5,
+    0x36, 0x64, 0xE2, 0xDA, 0x99, 0xB3, 0x23, 0xA0, 0x21, 0xA5, 0x3C, 0xCD, 0x9E, 0xFA, 0x24, 0x0F,
+    0x32, 0x57, 0x9C, 0x18, 0x8F, 0x37, 0x9C, 0xEB, 0xA2, 0xA3, 0xAF, 0x0D, 0x29, 0x14, 0xDA, 0x90,
+    0xAF, 0x15, 0x9A, 0xF3, 0x54, 0x39, 0xF9, 0x68, 0x33, 0x62, 0x35, 0xBC, 0x71, 0x4A, 0x4F, 0xBF,
+    0x64, 0x97, 0x0B, 0xDF, 0x43, 0x6E, 0x9E, 0xB8, 0x39, 0xE9, 0x2D, 0xAA, 0xD3, 0xA2, 0x7A, 0x89,
+    0xB6, 0x69, 0x93, 0xCF, 0x27, 0x3F, 0x79, 0xC4, 0x95, 0x7C, 0x3C, 0x1E, 0x0B, 0x7A, 0x09, 0xBA,
+    0x9D, 0xDA, 0xBB, 0xF0, 0x59, 0x4C, 0xC8, 0xF7, 0x72, 0x61, 0x4E, 0xBA, 0x39, 0x12, 0x3A, 0x2A,
+    0x83, 0x8E, 0x22, 0xF3, 0x1F, 0x34, 0x09, 0xCF, 0x96, 0x50, 0x1F, 0x5B, 0x8C, 0x92, 0x06, 0x8F,
+    0x9D, 0x8D, 0xCC, 0x82, 0x15, 0x75, 0xDF, 0x33, 0x1C, 0x1F, 0x81, 0xEB, 0x79, 0x9A, 0x39, 0x47,
+    0x96, 0x58, 0x41, 0xC6, 0x8D, 0x70, 0x81, 0x0E, 0x31, 0xBA, 0x48, 0x64, 0x2E, 0x1F, 0x05, 0xAD,
+    0xA8, 0x44, 0x35, 0x42, 0x26, 0xAA, 0xD0, 0x92, 0x43, 0xD9, 0xDC, 0xFB, 0x5A, 0x5B, 0x74, 0x2B,
+    0x3B, 0x3A, 0xCE, 0x71, 0xA9, 0x42, 0xB4, 0x8F, 0x25, 0xF6, 0x16, 0x5E, 0x16, 0xB5, 0x72, 0x3A,
+    0xCB, 0xD9, 0x17, 0x79, 0x66, 0x42, 0x2B, 0x35, 0xAB, 0xB2, 0x1A, 0xDA, 0x9E, 0x41, 0xA5, 0xA4,
+    0xAF, 0xEB, 0x89, 0xA7, 0x92, 0x92, 0x7E, 0x10, 0x04, 0xEE, 0xB1, 0x6F, 0x15, 0xE7, 0xA9, 0x8B,
+    0x49, 0xE2, 0xE9, 0x30, 0x92, 0x9A, 0xD8, 0x32, 0xCF, 0x4E, 0x9A, 0x2E, 0x39, 0x51, 0x14, 0xC9,
+    0x36, 0x85, 0x62, 0xB4, 0xCA, 0xA8, 0x4A, 0x76, 0x98, 0xC7, 0x15, 0x7D, 0xC4, 0xBF, 0xF7, 0xC0,
+    0xDB, 0x9E, 0x36, 0x49, 0xFF, 0x8C, 0x16, 0x13, 0x60, 0x31, 0x45, 0x5E, 0xFB, 0xD7, 0x2C, 0x49,
+    0x02, 0xA7, 0xDB, 0xE4, 0xE6, 0x74, 0xA3, 0x0D, 0xAA, 0x94, 0x5A, 0xD7, 0x52, 0xE2, 0x39, 0x97,
+    0xB2, 0x57, 0x57, 0xB7, 0x38, 0x49, 0x12, 0xEF, 0x7F, 0x92, 0x0E, 0x59, 0xD6, 0x34, 0xF6, 0x03,
+    0x46, 0x31, 0xF7, 0x69, 0x64, 0x94, 0xBE, 0x22, 0xEA, 0x6D, 0x36, 0x6A, 0xF7, 0xC2, 0xB1, 0x8F,
+    0x33, 0x4F, 0x1E, 0xCF, 0x2D, 0x66, 0xCD, 0xC5, 0x4F, 0x30, 0x73, 0x46, 0x99, 0x6D, 0x76, 0x47,
+    0xF3, 0x3C, 0x29, 0x61, 0xC8, 0x0D, 0x4F, 0x45, 0x5F, 0xC3, 0x96, 0x5D, 0xCE, 0x00, 0xB7, 0x75,
+    0x8F, 0x33, 0x32, 0x39, 0xB6, 0x86, 0x90, 0xB7, 0x6C, 0xD0, 0x26, 0xF7, 0x66, 0x3C, 0x57, 0xE0,
+    0x24, 0xB7, 0x56, 0xFA, 0xEE, 0x52, 0xD4, 0x98, 0x1E, 0x03, 0x96, 0x6E, 0xFD, 0xC8, 0x3D, 0xCB,
+    0xE9, 0xC4, 0x42, 0x09, 0x3D, 0x60, 0xD3, 0x36, 0x9C, 0xEE, 0x08, 0xFF, 0xC8, 0xE5, 0x1D, 0x8C,
+    0xB2, 0xCF, 0x6C, 0xD6, 0x61, 0x49, 0x23, 0xCA, 0x83, 0x15, 0xC4, 0x15, 0x5E, 0x01, 0xC6, 0xE7,
+    0x71, 0x81, 0x93, 0x6D, 0x16, 0xCC, 0xE9, 0x8E, 0x14, 0x24, 0x9D, 0xD7, 0xD0, 0xE7, 0xDD, 0x67,
+    0x3D, 0xE1, 0x10, 0x92, 0x07, 0x24, 0xB8, 0x6F, 0xD4, 0x32, 0xF6, 0x0B, 0x1C, 0xFD, 0xFA, 0x0A,
+    0x35, 0xA4, 0x21, 0x7F, 0x5A, 0x46, 0x17, 0xEB, 0xA4, 0x09, 0x5B, 0xDA, 0x48, 0x88, 0x29, 0xF0,
+    0x73, 0x86, 0x09, 0xF1, 0xAD, 0xDF, 0x37, 0x12, 0x3E, 0x3C, 0xC6, 0xE6, 0x6C, 0xFC, 0xBA, 0xCB,
+    0xE7, 0x7E, 0xA6, 0x0B, 0x73, 0x1D, 0x6A, 0x83, 0x5D, 0x30, 0xF1, 0xCB, 0x10, 0x3F, 0xB1, 0x5A,
+    0x1B, 0x06, 0x43, 0x76, 0x63, 0xAD, 0xB4, 0xAC, 0x55, 0x41, 0x65, 0x3F, 0xF0, 0xF3, 0xC5, 0xD0,
+    0xE2, 0xC4, 0x0E, 0xBC, 0x71, 0x8F, 0xF6, 0x14, 0x6B, 0xA8, 0xAA, 0xD8, 0x70, 0xAA, 0x96, 0xDC,
+    0x24, 0x97, 0x73, 0x94, 0x9F, 0x13, 0xD5, 0xED, 0xD3, 0x84, 0xF8, 0x2D, 0xFB, 0xEE, 0x80, 0x58,
+    0xA7, 0x8E, 0x1F, 0xB7, 0xD9, 0x70, 0xE5, 0x37, 0x7E, 0x8B, 0x1D, 0x57, 0xE2, 0x86, 0xFF, 0x8B,
+    0xE1, 0x0C, 0xF3, 0x88, 0xEF, 0x63, 0x4A, 0x3B, 0xC2, 0xB3, 0x60, 0xB0, 0x40, 0x57, 0xA9, 0x3D,
+    0x97, 0xCF, 0x50, 0x8B, 0x42, 0xFC, 0xBC, 0x02, 0xF5, 0x5E, 0x85, 0xE1, 0x0F, 0x5C, 0x9E, 0x43,
+    0xFC, 0x36, 0xA1, 0x58, 0x63, 0xF8, 0x0E, 0xC7, 0xAD, 0xA8, 0xE4, 0x7E, 0x64, 0x9C, 0x8F, 0x9E,
+    0x70, 0x38, 0x3E, 0x4F, 0xB1, 0x52, 0xD2, 0x46, 0x75, 0xC0, 0xF8, 0x19, 0xF8, 0xD9, 0x23, 0x59,
+    0x70, 0xC5, 0x32, 0x41, 0x64, 0x89, 0x4F, 0x5F, 0xE8, 0xA9, 0x9A, 0xB0, 0x64, 0xA1, 0xDD, 0x42,
+    0x9F, 0xBF, 0xD0, 0xC6, 0x05, 0x95, 0x6F, 0xF0, 0x83, 0x92, 0x4F, 0x20, 0xC9, 0x39, 0xE3, 0xA9,
+    0xFE, 0xCF, 0x6C, 0x90, 0x2F, 0x15, 0x88, 0xF8, 0xB5, 0xAC, 0xFB, 0xE0, 0x59, 0xE2, 0x88, 0x2C,
+    0x7C, 0xFF, 0x7E, 0xA6, 0x53, 0xDA, 0xD6, 0x15, 0xD2, 0x14, 0xE2, 0x97, 0xC2, 0x97, 0x56, 0xFC,
+    0xA8, 0x91, 0xB2, 0x57, 0x49, 0xFD, 0x54, 0x9A, 0xE5, 0xFD, 0x8C, 0x9A, 0x73, 0x02, 0xCB, 0xF1,
+    0x5F, 0xD7, 0x5F, 0xBD, 0x55, 0xBF, 0x6F, 0x1C, 0x55, 0x10, 0x9E, 0xDD, 0x47, 0x58, 0xC5, 0xAB,
+    0xF8, 0x51, 0xC4, 0x12, 0x52, 0x84, 0x1E, 0x2D, 0x92, 0xF1, 0x36, 0x29, 0x5C, 0xEC, 0xDD, 0x3D,
+    0xE2, 0x32, 0x8D, 0x25, 0x7C, 0xA2, 0x40, 0xC2, 0xFC, 0x05, 0x98, 0x32, 0x85, 0x2F, 0xB7, 0x89,
+    0x0B, 0xDA, 0x48, 0x88, 0x3E, 0x12, 0xD0, 0xB8, 0x71, 0x13, 0xA1, 0x2B, 0x2E, 0xDE, 0x8D, 0xAF,
+    0xA4, 0x59, 0xFE, 0x02, 0x16, 0x29, 0x92, 0xC1, 0x45, 0x58, 0xA1, 0x87, 0x58, 0xA3, 0xF5, 0x0E,
+    0xDF, 0xBC, 0x3D, 0x1B, 0x82, 0x88, 0x04, 0x0D, 0x2B, 0xED, 0xDC, 0xDE, 0xEC, 0x9B, 0x99, 0xEF,
+    0x9B, 0x5F, 0xBB, 0x36, 0xDE, 0xA1, 0x8F, 0x35, 0xB3, 0xCD, 0xD5, 0xD9, 0x31, 0x4D, 0x8B, 0xDA,
+    0xD8, 0x01, 0xA5, 0x51, 0xB9, 0x41, 0xD7, 0x03, 0xA7, 0x89, 0x68, 0x12, 0x5B, 0x22, 0xB3, 0x55,
+    0x10, 0x45, 0x5C, 0x12, 0x05, 0xDC, 0x88, 0xD2, 0x88, 0xF2, 0x4E, 0x0D, 0x65, 0x39, 0x84, 0xD2,
+    0xC5, 0x78, 0x35, 0xA1, 0x16, 0x4A, 0x6B, 0x0A, 0x32, 0x4D, 0xD8, 0x52, 0xC2, 0x94, 0xC0, 0x8A,
+    0x68, 0x5B, 0x84, 0x66, 0x67, 0xB6, 0xB8, 0x31, 0x65, 0x3D, 0xD3, 0xB4, 0xB9, 0x11, 0xDB, 0xD5,
+    0xF8, 0x20, 0xA3, 0xF0, 0x37, 0x9C, 0xC8, 0xE1, 0x66, 0x23, 0x21, 0x8A, 0x0F, 0x4A, 0x0A, 0xAB,
+    0x39, 0xD1, 0x4C, 0x17, 0x34, 0x7D, 0xAF, 0xA1, 0xDC, 0x19, 0x71, 0x60, 0x01, 0x71, 0xBC, 0xC3,
+    0x6D, 0x20, 0xE6, 0xB4, 0x9B, 0xC5, 0x05, 0xE9, 0x7F, 0x16, 0xCC, 0xBC, 0x14, 0xAF, 0x3C, 0x22,
+    0x22, 0x69, 0x68, 0xEF, 0x47, 0xF1, 0xD7, 0x0A, 0xB2, 0xB9, 0x88, 0xFD, 0x2B, 0xB1, 0x29, 0xE2,
+    0xB6, 0x08, 0x1A, 0xB5, 0x9A, 0xEF, 0x76, 0x21, 0xDB, 0x21, 0x69, 0xAB, 0x33, 0x55, 0xAA, 0x8A,
+    0x1C, 0x9D, 0x8F, 0x27, 0x34, 0x42, 0xC2, 0xF4, 0x17, 0x1F, 0xF4, 0x8A, 0x86, 0x06, 0x24, 0x27,
+    0x92, 0x2A, 0x3E, 0x1F, 0x5D, 0x68, 0x06, 0xE6, 0xB0, 0x82, 0xF9, 0x3D, 0xDC, 0x6F, 0xE1, 0x56,
+    0xF6, 0x92, 0xC4, 0xF8, 0x7D, 0xAE, 0x23, 0xE6, 0xEF, 0x2E, 0xE8, 0x5A, 0x77, 0x14, 0xD6, 0xA4,
+    0xAA, 0xD4, 0x03, 0xAA, 0xC1, 0x7E, 0x18, 0x5A, 0x20, 0x69, 0xC8, 0xAB, 0xC9, 0xB3, 0x40, 0x0A,
+    0xB9, 0xF3, 0x00, 0xAF, 0xD4, 0x72, 0x9A, 0xE4, 0xF4, 0x4B, 0x6A, 0x21, 0xF4, 0x5C, 0x89, 0xEF,
+    0xCA, 0x83, 0x6E, 0xF2, 0x2A, 0xE1, 0x0A, 0x98, 0xB6, 0x32, 0x80, 0x5B, 0x15, 0x94, 0xB7, 0x05,
+    0xAE, 0xC7, 0xED, 0x09, 0x78, 0xE0, 0x42, 0xC9, 0x23, 0x0F, 0x3B, 0xCA, 0x33, 0x81, 0x6E, 0xC7,
+    0xB8, 0xAC, 0x1C, 0xE3, 0x9A, 0x82, 0xEE, 0xF0, 0x08, 0x65, 0x4D, 0x24, 0x88, 0x44, 0x46, 0x40,
+    0x3C, 0x25, 0x3E, 0x65, 0xF8, 0xFB, 0xE7, 0x8B, 0x9C, 0x33, 0x79, 0xC1, 0x17, 0xFE, 0x45, 0x52,
+    0xC8, 0x8B, 0xA0, 0xF1, 0x16, 0x23, 0x6F, 0x11, 0x17, 0xF2, 0x22, 0xA8, 0xBD, 0xC5, 0x7E, 0xD2,
+    0x84, 0x5D, 0x96, 0x8C, 0x18, 0x80, 0x63, 0xDF, 0x20, 0x40, 0x41, 0xDE, 0xB7, 0x48, 0x27, 0xF2,
+    0x43, 0x2F, 0x93, 0x8A, 0xFA, 0x4B, 0xF0, 0xA0, 0x4F, 0x98, 0x9D, 0x30, 0x37, 0x24, 0xCC, 0x51,
+    0x2C, 0x55, 0x05, 0xB0, 0xD1, 0x59, 0xF4, 0xFD, 0x85, 0xA8, 0x91, 0xAB, 0x86, 0xEE, 0x53, 0x2B,
+    0xEA, 0xA0, 0x81, 0xBA, 0x50, 0x95, 0x9C, 0xD6, 0x27, 0x5D, 0xD0, 0xD9, 0x44, 0xF8, 0x51, 0xE3,
+    0xE3, 0x79, 0xBF, 0x9A, 0xAE, 0xAA, 0xEF, 0x61, 0xAC, 0x5C, 0xC8, 0xA3, 0xC9, 0xD0, 0xCE, 0x5F,
+    0xE1, 0xEE, 0xF0, 0x90, 0x64, 0xD3, 0x2C, 0x74, 0xF1, 0xCF, 0x85, 0xB1, 0x73, 0x6D, 0x5B, 0x55,
+    0x26, 0xAA, 0x34, 0x20, 0x40, 0xF3, 0xA0, 0x9E, 0x87, 0xB5, 0x5A, 0x80, 0x80, 0xD1, 0xE0, 0x0B,
+    0xD5, 0x7E, 0x58, 0x4F, 0xA8, 0x96, 0x53, 0x55, 0x1A, 0xBA, 0x68, 0x51, 0x2A, 0x17, 0xBF, 0x20,
+    0xD5, 0xED, 0xBA, 0x9B, 0x01, 0xFF, 0x8E, 0xD1, 0x79, 0x8D, 0xDE, 0xF0, 0x11, 0x23, 0x60, 0x98,
+    0x99, 0x32, 0x7E, 0x78, 0x5A, 0xA6, 0x3A, 0x3A, 0xA9, 0x66, 0x5A, 0xDF, 0x29, 0x07, 0x03, 0x6D,
+    0x9D, 0x7B, 0x57, 0x2D, 0xF0, 0x37, 0x7E, 0x56, 0x3F, 0xD1, 0x0F, 0x4F, 0x0B, 0xF3, 0x79, 0x0B,
+    0x52, 0x5C, 0x04, 0xDB, 0x3B, 0x44, 0xD7, 0xBE, 0xC6, 0xFC, 0xB5, 0xEA, 0x7C, 0xB7, 0x68, 0x29,
+    0x35, 0x84, 0x83, 0xB4, 0x3E, 0xE9, 0x91, 0x83, 0x02, 0x06, 0x46, 0x86, 0x4F, 0xFE, 0x3D, 0x45,
+    0x04, 0x64, 0x65, 0x94, 0x61, 0x54, 0xED, 0xEB, 0xE8, 0xB6, 0x2A, 0xC6, 0xC8, 0x4A, 0x8A, 0xD7,
+    0x89, 0x30, 0xC6, 0x1A, 0xE7, 0x8E, 0x97, 0x79, 0x85, 0x4B, 0x7B, 0x9C, 0xDF, 0x2D, 0x86, 0x29,
+    0x7D, 0x53, 0x4B, 0x67, 0x0D, 0x25, 0xB3, 0xAA, 0x26, 0x8C, 0x33, 0x46, 0x2D, 0xE1, 0xD6, 0x70,
+    0x11, 0x96, 0x14, 0xD9, 0x60, 0x9D, 0x4C, 0x45, 0xEF, 0x10, 0xAD, 0xA1, 0x41, 0xB0, 0x2E, 0x78,
+    0x71, 0x96, 0x1F, 0xD6, 0xB5, 0xCE, 0xD2, 0x54, 0x55, 0xFA, 0x3A, 0x35, 0xA1, 0x15, 0x63, 0xF1,
+    0xD1, 0xA7, 0x57, 0x12, 0xFD, 0x4A, 0xC5, 0xAD, 0x4E, 0x6A, 0x2A, 0x5A, 0xA9, 0xF3, 0x60, 0x59,
+    0x8C, 0x50, 0xAA, 0xF0, 0xE9, 0x65, 0xC1, 0x17, 0xCC, 0x6D, 0x6A, 0xD4, 0xE2, 0x41, 0x9D, 0x6E,
+    0x9A, 0x30, 0x93, 0x4A, 0xA3, 0xF0, 0x2F, 0xFF, 0x44, 0x9D, 0x55, 0x32, 0xC4, 0x51, 0xE1, 0x87,
+    0x57, 0x65, 0x7E, 0x72, 0x03, 0x5A, 0xDB, 0x09, 0xC6, 0x7B, 0xFC, 0x80, 0x7F, 0xE8, 0xC0, 0x44,
+    0x17, 0xAA, 0x0C, 0x1D, 0x2C, 0x46, 0x88, 0x16, 0x95, 0x33, 0x64, 0x2A, 0x45, 0xC0, 0x4F, 0x10,
+    0x90, 0x25, 0x94, 0xED, 0xF3, 0xE6, 0xDB, 0x4F, 0xBA, 0x21, 0x59, 0x36, 0xC4, 0xAD, 0xCE, 0x22,
+    0xFD, 0x15, 0x4D, 0x9B, 0xA4, 0xE1, 0x47, 0x7B, 0x25, 0x26, 0x09, 0x6D, 0x5D, 0xAB, 0x52, 0xDB,
+    0xB8, 0x48, 0xC9, 0x60, 0xC6, 0x87, 0x80, 0xBD, 0x8F, 0x31, 0xC7, 0x16, 0xC3, 0x08, 0x91, 0x72,
+    0x7D, 0x25, 0x36, 0xE0, 0x61, 0xD6, 0x2F, 0x81, 0x58, 0xCA, 0x50, 0xD1, 0xCA, 0xA1, 0xFD, 0x1B,
+    0x28, 0x8C, 0x9E, 0x78, 0x03, 0xA8, 0x1A, 0xA0, 0xEE, 0x2D, 0x41, 0x7D, 0xD4, 0x83, 0x5A, 0xC9,
+    0x7F, 0x42, 0x69, 0xB0, 0x00, 0xFE, 0x2B, 0x28, 0x8D, 0x62, 0x0D, 0x96, 0xA0, 0x7E, 0x01, 0xA8,
+    0x17, 0xC8, 0x8D, 0x03, 0x82, 0x8E, 0x82, 0xBD, 0xED, 0x97, 0x41, 0x95, 0x3D, 0xA8, 0x31, 0x8D,
+    0x2D, 0xB7, 0x31, 0xDB, 0xA9, 0x8D, 0xE0, 0x56, 0x4A, 0xF4, 0x54, 0xA2, 0xB6, 0x92, 0xE5, 0xD6,
+    0x09, 0x1E, 0xA9, 0xA0, 0x6C, 0xCA, 0x58, 0xC0, 0x4C, 0x61, 0xAF, 0xBE, 0x45, 0x37, 0x0D, 0xC0,
+    0x34, 0xAC, 0x20, 0x0C, 0xC6, 0x04, 0x99, 0x1D, 0xD9, 0xE4, 0x79, 0xC0, 0x5F, 0x72, 0x9D, 0xC8,
+    0x02, 0xF4, 0x80, 0x3D, 0xF2, 0xA0, 0xBA, 0x5C, 0x81, 0x37, 0xFA, 0xD2, 0x36, 0x23, 0xC7, 0x65,
+    0x9E, 0xDD, 0x87, 0xCD, 0x44, 0x5B, 0x9A, 0x3F, 0xC1, 0x64, 0x67, 0xBE, 0x7D, 0x65, 0x32, 0x52,
+    0xF4, 0xDF, 0x33, 0x27, 0xAC, 0x22, 0x17, 0x35, 0xB9, 0xCB, 0x9B, 0x7E, 0x3F, 0xC8, 0x57, 0x68,
+    0x7D, 0xD9, 0x1F, 0x16, 0x4D, 0x18, 0x00, 0x36, 0x77, 0x9A, 0x0F, 0x4E, 0x7F, 0x75, 0x51, 0xA5,
+    0xE3, 0x13, 0x64, 0x60, 0x33, 0x89, 0xD0, 0x4C, 0x8F, 0xE6, 0x6F, 0xC2, 0xB5, 0x2C, 0xC6, 0xD2,
+    0xEF, 0x4B, 0x2B, 0x58, 0x06, 0x1E, 0xCC, 0xBF, 0x52, 0x63, 0xCD, 0xF0, 0x63, 0x69, 0x71, 0xCF,
+    0xA3, 0x27, 0xD2, 0xAF, 0x09, 0x4F, 0xA5, 0xE7, 0xB2, 0x24, 0x83, 0x46, 0x6D, 0x41, 0x87, 0x6B,
+    0x3E, 0xF8, 0x6C, 0x51, 0xB8, 0x1B, 0x26, 0x56, 0xE5, 0xDB, 0xFB, 0x37, 0xB5, 0x45, 0x65, 0x07,
+    0xD2, 0x96, 0x0E, 0xE9, 0x81, 0xE7, 0x7D, 0xFA, 0xAB, 0x6A, 0x7A, 0x76, 0x74, 0x8E, 0xF2, 0xFA,
+    0xCF, 0x8F, 0xAF, 0x70, 0x04, 0xFE, 0xB4, 0x7A, 0xF5, 0xE1, 0xB1, 0xF4, 0xFF, 0x5D, 0x7F, 0x00,
+    0xB5, 0x55, 0xBF, 0x6F, 0xE4, 0x44, 0x14, 0x7E, 0xF6, 0x64, 0xCF, 0xE8, 0x2C, 0xDD, 0x50, 0x10,
+    0x28, 0x02, 0xE7, 0x96, 0x22, 0x87, 0x29, 0x28, 0x52, 0xD8, 0xF1, 0x88, 0x14, 0x14, 0x34, 0x57,
+    0x64, 0xB9, 0x92, 0x86, 0x82, 0x2E, 0x0D, 0x05, 0xC5, 0xEE, 0xAD, 0xB9, 0x14, 0xD4, 0x14, 0x54,
+    0x34, 0x94, 0x70, 0x0D, 0x29, 0x4E, 0x28, 0xC5, 0x12, 0xFB, 0xE0, 0x1F, 0x30, 0xFF, 0x81, 0x4F,
+    0x01, 0x1D, 0xBA, 0x86, 0x11, 0x9A, 0xC2, 0x8B, 0x6C, 0x3F, 0xBE, 0x67, 0x6F, 0x2E, 0x1B, 0x10,
+    0x88, 0x48, 0xE0, 0xD5, 0xCC, 0xBE, 0x7D, 0xFB, 0xE6, 0xCD, 0xF7, 0xBE, 0xF7, 0xC3, 0xDB, 0x87,
+    0x93, 0xE9, 0x3B, 0x5C, 0x71, 0xB3, 0x53, 0xDF, 0x68, 0x28, 0x25, 0x6D, 0x54, 0x45, 0xEE, 0x52,
+    0xD8, 0x17, 0xC1, 0x41, 0x88, 0x7E, 0x2F, 0x0C, 0x2D, 0xD8, 0x11, 0x4D, 0xB5, 0x21, 0x82, 0x86,
+    0xE8, 0x8A, 0x10, 0xF4, 0x39, 0x29, 0x6E, 0xF1, 0x2B, 0x2C, 0xB1, 0x2D, 0xB1, 0x82, 0x1C, 0xDB,
+    0x1E, 0x96, 0x12, 0x43, 0x2A, 0x6C, 0xF1, 0x1B, 0x3F, 0x60, 0xD3, 0x78, 0x56, 0xD5, 0x41, 0xA9,
+    0xF3, 0x88, 0x62, 0x9A, 0xD1, 0xE2, 0x3D, 0x0B, 0xC7, 0x25, 0x4D, 0x22, 0xD8, 0xCC, 0x88, 0x3C,
+    0x4B, 0xB4, 0xB3, 0x22, 0x9F, 0x1B, 0x1C, 0xAC, 0xE1, 0x0E, 0x87, 0x5F, 0xC3, 0x5F, 0x6F, 0x62,
+    0x99, 0x6D, 0xE0, 0x7D, 0x9F, 0x0F, 0xF8, 0xC9, 0x19, 0x1D, 0xE5, 0x82, 0x71, 0x40, 0x29, 0x80,
+    0xD3, 0x2D, 0x6D, 0xF4, 0xF1, 0x71, 0xA5, 0x5C, 0xED, 0x68, 0xD1, 0x77, 0x14, 0x30, 0x1B, 0x7A,
+    0xE5, 0xB8, 0x22, 0x82, 0x82, 0xF6, 0xD2, 0x35, 0x4E, 0x1C, 0x00, 0x56, 0x43, 0x9A, 0xEB, 0x3F,
+    0x03, 0xFA, 0x04, 0x80, 0x76, 0x01, 0xE8, 0xDB, 0x11, 0x50, 0x08, 0x40, 0xBB, 0x17, 0x80, 0x1A,
+    0x00, 0xB2, 0xD3, 0x43, 0xA2, 0x8C, 0xA1, 0xE9, 0xE0, 0x2C, 0x5E, 0x87, 0xEA, 0xDB, 0x75, 0xB8,
+    0xF1, 0x51, 0x43, 0x21, 0x73, 0xE5, 0x3B, 0xAF, 0x85, 0x22, 0xC6, 0x27, 0xA8, 0xC2, 0xD2, 0x73,
+    0xB0, 0x98, 0x43, 0x11, 0x19, 0x51, 0xC4, 0xBF, 0x04, 0x7D, 0xC6, 0x01, 0xFC, 0x03, 0x8C, 0x06,
+    0xB2, 0xA0, 0xDB, 0x40, 0x36, 0xD0, 0x39, 0x40, 0x8D, 0x3A, 0x52, 0xBF, 0xC2, 0xAA, 0xF7, 0x25,
+    0x2F, 0x19, 0x2C, 0xC2, 0x52, 0x55, 0x70, 0xE5, 0xE0, 0x2A, 0x85, 0xEF, 0x4D, 0x85, 0x57, 0xE4,
+    0x8B, 0xCF, 0xD8, 0x2E, 0x40, 0xFF, 0x8D, 0xAF, 0x85, 0x6A, 0x1C, 0x54, 0xAB, 0x1D, 0x4B, 0xBA,
+    0xF4, 0x9B, 0x17, 0x22, 0x43, 0x6D, 0x92, 0x01, 0xA4, 0x90, 0xB0, 0x9C, 0x7F, 0x87, 0x2D, 0x63,
+    0xE6, 0xF6, 0x66, 0xFF, 0xF0, 0xE1, 0x57, 0x03, 0x74, 0xE0, 0xC3, 0x73, 0x5F, 0xB6, 0x4C, 0xB6,
+    0x58, 0x32, 0x07, 0x70, 0x1F, 0x22, 0xA5, 0x92, 0xF3, 0x82, 0x81, 0xCD, 0xBB, 0x4B, 0xC3, 0xA3,
+    0x7B, 0xF2, 0xFA, 0x62, 0xA2, 0xCD, 0x7C, 0xEF, 0x94, 0x56, 0xE7, 0x95, 0x7F, 0x0E, 0x67, 0x9F,
+    0x32, 0x77, 0x64, 0xC7, 0x20, 0x74, 0x39, 0x7A, 0xC8, 0x70, 0x34, 0xE6, 0x9C, 0x26, 0x72, 0xF0,
+    0xFF, 0xC3, 0x25, 0x45, 0x32, 0x6E, 0xBE, 0x30, 0xE8, 0x4B, 0xF9, 0x51, 0x49, 0x97, 0xCF, 0xB5,
+    0x01, 0x4B, 0x5A, 0x6F, 0xAF, 0x6B, 0x17, 0x7E, 0x7D, 0x43, 0xD3, 0x43, 0xEE, 0x22, 0x24, 0xF3,
+    0xEF, 0x3E, 0x71, 0x03, 0x6F, 0xF4, 0xA2, 0x47, 0x43, 0xFA, 0xA4, 0x22, 0x74, 0x39, 0x04, 0x20,
+    0x6A, 0x50, 0x77, 0xF8, 0x1C, 0xCC, 0x07, 0x34, 0xBD, 0xEB, 0x9B, 0xCC, 0x70, 0xAB, 0x9C, 0xB6,
+    0x81, 0x53, 0x1D, 0x72, 0xB9, 0x44, 0x8D, 0xF9, 0x55, 0x2C, 0x07, 0x93, 0xB0, 0x7C, 0x84, 0xC2,
+    0x7A, 0xDB, 0x26, 0x30, 0xB6, 0xCB, 0x3B, 0xD8, 0x23, 0x2E, 0xC4, 0x21, 0x83, 0x3C, 0x0A, 0xBE,
+    0xB7, 0x4B, 0x89, 0x76, 0x89, 0x8A, 0x51, 0x36, 0x46, 0xFA, 0x3D, 0x17, 0x96, 0x20, 0xA7, 0xF5,
+    0x6D, 0x58, 0x53, 0x07, 0xDA, 0x3A, 0xEA, 0xA9, 0xA8, 0xF5, 0x8F, 0x3D, 0x71, 0xEB, 0xF5, 0x2F,
+    0xC9, 0xA5, 0x13, 0xA2, 0x9B, 0xF4, 0x25, 0x3C, 0x49, 0x7D, 0xE9, 0x07, 0xB8, 0xC6, 0xE7, 0x4D,
+    0x86, 0x62, 0x8F, 0xCB, 0x36, 0x7E, 0x7C, 0x76, 0xD0, 0x7A, 0x75, 0x82, 0xB6, 0x3D, 0x49, 0x34,
+    0xA2, 0x4F, 0x70, 0xF9, 0x9D, 0xF9, 0xC7, 0xF8, 0x5B, 0xFA, 0x7A, 0x96, 0x20, 0x4B, 0x4D, 0x12,
+    0xA1, 0x1F, 0x12, 0x9D, 0x2B, 0xD8, 0x55, 0xBA, 0xBC, 0xEF, 0xDB, 0x85, 0xE2, 0xB2, 0x93, 0x5B,
+    0xB6, 0xD0, 0x1E, 0xAF, 0xCB, 0x95, 0x51, 0x15, 0xF4, 0x61, 0x29, 0xF5, 0x99, 0x82, 0xCA, 0x53,
+    0x0A, 0x1F, 0x5B, 0x0A, 0x7F, 0xA8, 0xD0, 0x1C, 0x9D, 0x34, 0x08, 0xE8, 0x8A, 0x2C, 0x6A, 0x17,
+    0xB8, 0xA9, 0xC1, 0x6A, 0x2F, 0x56, 0xDC, 0x50, 0x83, 0x9B, 0xDC, 0xD8, 0x53, 0x01, 0x98, 0x8F,
+    0x4A, 0x7A, 0xB9, 0xC7, 0xD7, 0x4F, 0x17, 0x40, 0x71, 0xD7, 0x3C, 0x76, 0x51, 0x95, 0x2A, 0xD4,
+    0xFE, 0x09, 0xA5, 0xB7, 0x48, 0x3D, 0xAD, 0x90, 0xB7, 0x4A, 0xFD, 0x5C, 0x98, 0x94, 0x5A, 0x55,
+    0x05, 0x55, 0x4A, 0xFB, 0xA1, 0x53, 0xE7, 0x8C, 0xDB, 0x87, 0xEC, 0xA2, 0x85, 0x75, 0x2E, 0x2E,
+    0x43, 0x44, 0x71, 0x86, 0x01, 0x36, 0x9D, 0x1A, 0x2D, 0xD9, 0x8F, 0x9E, 0xC1, 0xF7, 0xA3, 0x00,
+    0x9D, 0x6E, 0x66, 0xA3, 0xA0, 0xC5, 0xD8, 0x6E, 0x0A, 0xB7, 0x21, 0xF8, 0x15, 0x84, 0x04, 0x42,
+    0x50, 0x42, 0x70, 0x34, 0x0B, 0x8E, 0x20, 0x16, 0xA5, 0xC7, 0x5F, 0x38, 0x62, 0x61, 0x58, 0x09,
+    0x99, 0xA7, 0x92, 0x24, 0x1A, 0x4B, 0x86, 0x5E, 0x5D, 0xC3, 0x65, 0x87, 0xAB, 0x72, 0x55, 0x3A,
+    0xBA, 0x05, 0x2C, 0x7B, 0xC8, 0x5A, 0x9D, 0x52, 0x60, 0x1C, 0xED, 0xE2, 0xA7, 0xD5, 0x26, 0xC8,
+    0x53, 0x7F, 0x46, 0x2E, 0xAE, 0xC3, 0xD5, 0x19, 0x71, 0x63, 0x06, 0xC4, 0x32, 0x09, 0x51, 0x04,
+    0x0A, 0x25, 0xB9, 0x85, 0xD2, 0xA3, 0xE9, 0x3D, 0xB6, 0x01, 0x3F, 0xE9, 0x68, 0xD2, 0x20, 0x0C,
+    0x55, 0x83, 0x2C, 0x9D, 0x63, 0xFE, 0xEC, 0x4B, 0x93, 0xAC, 0x55, 0x28, 0xE9, 0x3C, 0x66, 0xEE,
+    0x37, 0x54, 0x7F, 0xB5, 0x02, 0xC3, 0xFA, 0x80, 0xED, 0x30, 0x61, 0xBC, 0xA1, 0x4A, 0xF3, 0x71,
+    0x78, 0x79, 0xDF, 0xE0, 0xDA, 0xB0, 0x19, 0x49, 0xCE, 0x5A, 0xCD, 0xEF, 0xF6, 0x3E, 0xE7, 0x32,
+    0xFD, 0x91, 0xEA, 0x0A, 0xCD, 0xE5, 0x68, 0x35, 0x9D, 0x83, 0x68, 0x36, 0xFA, 0xF3, 0x7B, 0xA3,
+    0x42, 0xE6, 0x92, 0x58, 0xC4, 0xB5, 0x2A, 0xB3, 0x6E, 0x70, 0x37, 0x5B, 0xCF, 0x45, 0x19, 0x67,
+    0xD2, 0x54, 0x85, 0x34, 0x96, 0xF9, 0xAF, 0x43, 0x38, 0x7A, 0x2A, 0xBE, 0x9E, 0xC3, 0x97, 0x46,
+    0xF1, 0xEB, 0x0B, 0xF2, 0xDF, 0xBA, 0x12, 0x82, 0xF9, 0xB7, 0x21, 0x84, 0x4D, 0xD6, 0x69, 0xB4,
+    0xFE, 0x90, 0x4A, 0x4F, 0xBC, 0x9D, 0xAC, 0x07, 0xC0, 0x16, 0xFD, 0xC3, 0x4B, 0xE7, 0xC2, 0xBB,
+    0xFC, 0x5C, 0x3C, 0x5B, 0xBF, 0x74, 0xB6, 0x0F, 0xAE, 0x4C, 0xF2, 0xAB, 0x2F, 0x9D, 0xCB, 0x31,
+    0x2F, 0xB8, 0x43, 0x49, 0xC4, 0xD8, 0x89, 0xD7, 0x78, 0x3D, 0x46, 0x0D, 0x2A, 0x0B, 0xF5, 0x0C,
+    0xB8, 0x6F, 0x40, 0xFB, 0x11, 0x96, 0xCC, 0x67, 0xBA, 0xFE, 0xF3, 0x07, 0xB5, 0x55, 0x31, 0x6F,
+    0x1C, 0x45, 0x14, 0xFE, 0x66, 0x27, 0xE7, 0x55, 0xB2, 0xC0, 0xB8, 0x48, 0x10, 0x92, 0x21, 0x4B,
+    0x69, 0x89, 0xD8, 0xDB, 0xA4, 0x08, 0x62, 0xEF, 0x76, 0xA5, 0x14, 0x29, 0x93, 0x22, 0x47, 0x93,
+    0x86, 0x1A, 0x0A, 0xB7, 0x2E, 0xCE, 0xBE, 0x55, 0x28, 0x28, 0x28, 0x30, 0xBF, 0x80, 0xB4, 0x5C,
+    0x0A, 0xA7, 0x48, 0x61, 0xA4, 0x4B, 0x76, 0xEC, 0x08, 0x51, 0x66, 0x80, 0x22, 0x05, 0xCD, 0x8A,
+    0x98, 0xC6, 0x29, 0x32, 0x42, 0x2B, 0xB2, 0xB6, 0x6F, 0x6F, 0xF8, 0x66, 0x1D, 0x43, 0xD2, 0x20,
+    0x81, 0xC4, 0xDE, 0xED, 0xDB, 0xBB, 0x9D, 0x79, 0xEF, 0x7D, 0xEF, 0xBD, 0xEF, 0xBD, 0xE9, 0xDD,
+    0x04, 0x86, 0xC8, 0x1A, 0xA8, 0x39, 0x12, 0x8B, 0xCC, 0x60, 0xAC, 0x83, 0x39, 0xC4, 0xF3, 0x5C,
+    0x8D, 0x10, 0xAE, 0xE1, 0x43, 0x8B, 0x95, 0x51, 0xF0, 0x44, 0xE3, 0x5E, 0xAD, 0x14, 0xE4, 0x5E,
+    0x75, 0x25, 0x85, 0x0A, 0xF7, 0x74, 0x8D, 0x54, 0x5D, 0x97, 0x06, 0x76, 0x75, 0x5D, 0xE5, 0x52,
+    0x0F, 0xF4, 0x00, 0x31, 0x1C, 0x76, 0xB0, 0x1E, 0xD4, 0x81, 0x15, 0x95, 0xD4, 0x91, 0x4E, 0xF6,
+    0x7B, 0x28, 0x9F, 0x3A, 0x0B, 0xE5, 0x34, 0x78, 0x25, 0x5E, 0xA0, 0xF6, 0x22, 0xEC, 0x5E, 0x5C,
+    0xEA, 0x5E, 0x54, 0x9D, 0xA4, 0x5F, 0x94, 0xB7, 0xE7, 0x50, 0xB5, 0xB2, 0x41, 0x8B, 0xE3, 0xE2,
+    0x23, 0xA3, 0xD2, 0xA8, 0x8F, 0xDF, 0xCD, 0x53, 0xA3, 0xE2, 0x4B, 0x7D, 0xD8, 0x17, 0x9F, 0x1B,
+    0x15, 0x5A, 0xFE, 0x18, 0x48, 0xA3, 0x84, 0xEE, 0x07, 0x87, 0x08, 0x1B, 0x67, 0xA5, 0xF3, 0x06,
+    0x52, 0x6F, 0xB4, 0xA0, 0xB8, 0xC7, 0xFB, 0x2D, 0x6F, 0x2F, 0x07, 0xCA, 0xF9, 0x07, 0xFB, 0xD2,
+    0xFC, 0xD3, 0x67, 0xE9, 0xB0, 0x9C, 0x63, 0x91, 0x7B, 0x83, 0x4A, 0xE5, 0x08, 0xCD, 0x06, 0x10,
+    0x79, 0x7B, 0xE2, 0x26, 0x5E, 0x5E, 0x82, 0x76, 0x90, 0xF9, 0x1F, 0x2D, 0x45, 0xD4, 0x50, 0xF4,
+    0x2D, 0x10, 0xFC, 0x6C, 0x00, 0xA5, 0x18, 0xC6, 0x7A, 0x0C, 0x48, 0x33, 0x00, 0xE3, 0x9F, 0x02,
+    0xDF, 0x7D, 0x5C, 0x43, 0x3A, 0x9A, 0x48, 0x26, 0xDB, 0x9A, 0xB1, 0xC6, 0x39, 0x43, 0xCD, 0xC0,
+    0xE5, 0x29, 0xD3, 0x1A, 0xCD, 0xB3, 0x16, 0xAE, 0x7D, 0x57, 0x18, 0x95, 0xEF, 0x04, 0xF5, 0x06,
+    0x92, 0xF6, 0xD4, 0xCF, 0x5A, 0x83, 0x87, 0xDB, 0x45, 0x5F, 0x5A, 0x85, 0x91, 0xB7, 0x85, 0x48,
+    0x2F, 0x38, 0x1B, 0x1D, 0x4D, 0x23, 0x1D, 0x07, 0x36, 0xD4, 0x53, 0x69, 0xE3, 0x67, 0xEE, 0x57,
+    0xF7, 0xA5, 0xED, 0x71, 0xF7, 0x0A, 0x63, 0x15, 0xB3, 0x2C, 0x87, 0xAC, 0x66, 0x78, 0xF5, 0xBA,
+    0xC1, 0xDB, 0xA3, 0xC2, 0x98, 0xB8, 0xE9, 0x91, 0xFF, 0x68, 0x0E, 0xF7, 0x99, 0x75, 0xF9, 0x88,
+    0xB8, 0x2F, 0xFA, 0xCC, 0xD7, 0xAA, 0x60, 0x05, 0x58, 0x8E, 0xD5, 0xE1, 0x03, 0xC0, 0xB9, 0x06,
+    0xD1, 0xC1, 0x5D, 0x8B, 0x3E, 0x13, 0x20, 0x58, 0x2D, 0xCD, 0xE5, 0x04, 0x65, 0x11, 0xB8, 0xAF,
+    0x5C, 0x9E, 0xB9, 0xFC, 0xAC, 0x28, 0xD4, 0x6E, 0x13, 0xD8, 0x4D, 0x2C, 0xF6, 0xFE, 0x1B, 0x5C,
+    0x5C, 0x18, 0x0E, 0x89, 0x2C, 0xF3, 0xAE, 0x10, 0xCE, 0x27, 0x4D, 0x07, 0xEB, 0x0A, 0xE1, 0x74,
+    0x32, 0xF5, 0x10, 0x71, 0xBF, 0x93, 0xD6, 0xCB, 0xC0, 0x6C, 0x32, 0x7B, 0xA1, 0x1E, 0x93, 0x38,
+    0xCA, 0x63, 0x44, 0xEC, 0x7C, 0x9C, 0xFD, 0x21, 0x53, 0x4C, 0x92, 0x8D, 0xF0, 0x06, 0x2C, 0xE5,
+    0x8A, 0xAC, 0x28, 0xD3, 0x68, 0x5F, 0x38, 0x37, 0xCB, 0xDA, 0xC8, 0xB9, 0x93, 0x6C, 0x2C, 0xB5,
+    0x51, 0x1B, 0x1C, 0x3D, 0x38, 0x6A, 0x55, 0xEE, 0xF2, 0x59, 0x2A, 0x1A, 0x86, 0x15, 0x9A, 0xD0,
+    0x60, 0xCD, 0x39, 0x6E, 0x3D, 0xB8, 0x99, 0x7C, 0x6D, 0xE1, 0x61, 0xFE, 0x1D, 0xEC, 0x99, 0xF1,
+    0x76, 0xE9, 0x6C, 0x59, 0x27, 0x2E, 0x3F, 0x8F, 0x5E, 0x0E, 0x81, 0xF3, 0xD8, 0x91, 0x26, 0x22,
+    0x25, 0x12, 0x57, 0xE0, 0x82, 0xA7, 0x01, 0x86, 0xC3, 0xE1, 0x75, 0xFA, 0x88, 0x0F, 0xEE, 0xEA,
+    0x29, 0x2E, 0x45, 0x5A, 0xF0, 0xC1, 0xC8, 0xE1, 0x2B, 0x1F, 0x1D, 0xCC, 0x51, 0xBA, 0xEA, 0xF4,
+    0x5F, 0xF7, 0x38, 0xC7, 0x87, 0x9D, 0xE2, 0x62, 0xE2, 0xDC, 0x73, 0xE7, 0xDA, 0x73, 0xB8, 0x33,
+    0x92, 0xBA, 0x49, 0x84, 0x7B, 0xC9, 0xF9, 0xA4, 0x91, 0x47, 0xB3, 0x01, 0x0E, 0x6D, 0x70, 0x5C,
+    0x84, 0xCE, 0x5F, 0xC7, 0x06, 0x1D, 0x20, 0x8C, 0xE1, 0xAD, 0x91, 0x9D, 0xC4, 0xF2, 0xE9, 0x16,
+    0x31, 0xD4, 0xF2, 0xF0, 0x56, 0xB3, 0x0A, 0x59, 0x7F, 0x02, 0xC9, 0x42, 0x46, 0xE4, 0x5F, 0x5C,
+    0x9C, 0x50, 0xB3, 0xF5, 0x8A, 0xBC, 0x59, 0xEE, 0x01, 0x53, 0xFB, 0x87, 0x45, 0xF4, 0x83, 0xC1,
+    0x40, 0x69, 0x16, 0xE1, 0xA0, 0x64, 0xEE, 0xAA, 0x53, 0x42, 0x27, 0x6D, 0x78, 0xD4, 0x2E, 0x7B,
+    0x80, 0x0D, 0xE3, 0x27, 0xE6, 0x49, 0x49, 0xBD, 0x2A, 0x70, 0x85, 0xDA, 0xC6, 0x28, 0xBB, 0x65,
+    0xC8, 0x4F, 0x16, 0x4C, 0x98, 0x65, 0xA8, 0xBD, 0x1A, 0x99, 0xF7, 0xF2, 0xB2, 0x0F, 0x26, 0x39,
+    0x01, 0x19, 0xF5, 0xDB, 0x5A, 0xB5, 0x03, 0xF5, 0x63, 0xD1, 0xB1, 0x2C, 0x61, 0x56, 0x36, 0xB9,
+    0xC8, 0xAC, 0xCB, 0x17, 0xAE, 0x0B, 0xD2, 0x57, 0xF8, 0xB8, 0x82, 0xFC, 0x45, 0x23, 0x89, 0x73,
+    0x34, 0x19, 0x37, 0x8E, 0x27, 0x33, 0x8C, 0x99, 0xC4, 0xDE, 0x0D, 0xBC, 0x13, 0xE4, 0xB3, 0xE4,
+    0xAA, 0x9D, 0x0A, 0xE4, 0x27, 0x76, 0xCB, 0x3A, 0x7E, 0x56, 0xDF, 0x21, 0x16, 0x96, 0x92, 0xD9,
+    0x4A, 0x26, 0x13, 0x9F, 0x86, 0x22, 0x9A, 0x63, 0x30, 0x15, 0xB6, 0x5D, 0xCB, 0x5D, 0xCD, 0x4A,
+    0x00, 0xCB, 0x91, 0x57, 0xA0, 0xAA, 0xEF, 0x42, 0xD3, 0xBC, 0x46, 0x7A, 0x88, 0x2D, 0x31, 0xCC,
+    0xCF, 0xA2, 0x95, 0xCE, 0x2A, 0x93, 0xE9, 0xD8, 0xA8, 0x9A, 0xFD, 0xE6, 0xEB, 0x1B, 0xE5, 0x53,
+    0x49, 0xA0, 0x36, 0x09, 0x18, 0xC9, 0x4A, 0xA4, 0xA9, 0x2E, 0xF7, 0xEC, 0x7D, 0xDF, 0x20, 0x73,
+    0xCF, 0x15, 0x52, 0xD2, 0xB3, 0x2B, 0xDA, 0xE3, 0x82, 0xBA, 0xCD, 0xE9, 0x42, 0xB8, 0xE4, 0x30,
+    0xD9, 0x92, 0x30, 0x2A, 0x69, 0x39, 0xC5, 0x0A, 0xC9, 0x89, 0x26, 0x6B, 0xD9, 0x30, 0x4B, 0xD9,
+    0xB5, 0x86, 0x3E, 0xC2, 0xC6, 0xB7, 0x19, 0x61, 0x2D, 0x60, 0x8B, 0x0A, 0xBE, 0xAF, 0x94, 0x37,
+    0xF0, 0x57, 0x50, 0x27, 0xB9, 0x16, 0x4E, 0xCF, 0x92, 0xDD, 0x87, 0x57, 0x67, 0xA2, 0x4A, 0xD9,
+    0xAF, 0xF7, 0x52, 0x05, 0x5C, 0x49, 0x57, 0x88, 0x63, 0x63, 0x9D, 0xCB, 0x9E, 0xAB, 0xA3, 0x94,
+    0x1E, 0x9B, 0x34, 0x86, 0xB0, 0xA9, 0x2A, 0x24, 0xF7, 0x19, 0xA5, 0x37, 0x03, 0x3B, 0x96, 0x4E,
+    0xB7, 0x3E, 0xEC, 0x33, 0xBE, 0x14, 0x2C, 0x83, 0xB4, 0x0F, 0x4E, 0xED, 0x2E, 0x7C, 0xCB, 0x19,
+    0xD5, 0xA2, 0x0D, 0xD9, 0x7B, 0xAA, 0xA8, 0xD0, 0xBC, 0xE9, 0x29, 0x43, 0x86, 0x73, 0xCA, 0x50,
+    0x8D, 0x21, 0xB1, 0xC7, 0x66, 0x27, 0x63, 0x60, 0xE3, 0x0C, 0x42, 0x4E, 0xAA, 0x69, 0x86, 0x78,
+    0x6F, 0xFE, 0x99, 0x8D, 0x58, 0x1D, 0x32, 0x61, 0x41, 0x14, 0x9B, 0x6A, 0xB7, 0xCE, 0x44, 0xBE,
+    0x88, 0x53, 0x5A, 0x3C, 0x9B, 0x2D, 0x0B, 0x8E, 0x2E, 0xD2, 0x0F, 0x6F, 0x5B, 0x90, 0x31, 0x21,
+    0xEB, 0xF1, 0x3D, 0x92, 0x14, 0xCD, 0x7C, 0x4D, 0x53, 0xEF, 0x02, 0x7A, 0xC3, 0x21, 0x3C, 0xFB,
+    0x27, 0xDB, 0xBB, 0x55, 0x60, 0xDF, 0x23, 0x8B, 0x8A, 0xA4, 0x1B, 0xE5, 0x82, 0xE5, 0xE0, 0x11,
+    0x22, 0xD6, 0x88, 0x21, 0x29, 0x3A, 0x3A, 0x74, 0xFC, 0x7F, 0x9F, 0xB9, 0x31, 0x41, 0x9D, 0x75,
+    0x9D, 0x91, 0xF3, 0x9C, 0xF1, 0x41, 0x67, 0xAE, 0xA5, 0xCD, 0xCB, 0xB2, 0x5A, 0x24, 0xEA, 0x55,
+    0xDF, 0x25, 0xE2, 0x10, 0x81, 0x33, 0x58, 0xAA, 0x3B, 0x4D, 0xC6, 0xD9, 0xEF, 0xBE, 0xA3, 0xCB,
+    0x98, 0x6D, 0x86, 0x36, 0x71, 0x9A, 0x11, 0xD3, 0xB9, 0xAF, 0x19, 0xAD, 0x08, 0xF7, 0xCA, 0xC4,
+    0x13, 0xC3, 0x1B, 0x82, 0x2D, 0xA9, 0x63, 0xF7, 0x45, 0x8D, 0x25, 0xDF, 0x7C, 0x71, 0x4E, 0x4C,
+    0x2D, 0xAD, 0x2A, 0x56, 0x0D, 0xC7, 0x26, 0xD2, 0xEA, 0x3A, 0x5F, 0xD5, 0x7D, 0x4C, 0x55, 0xCE,
+    0x57, 0x35, 0x7B, 0xFA, 0x71, 0xA1, 0xF2, 0xA4, 0xA1, 0x8F, 0xB2, 0x40, 0x1D, 0x34, 0x8C, 0x9A,
+    0x8A, 0x2A, 0x2F, 0xEF, 0x88, 0xF2, 0x1B, 0x6F, 0xAB, 0x60, 0x0E, 0x73, 0xB6, 0x8D, 0x79, 0x8D,
+    0x64, 0xCA, 0x05, 0xEE, 0x27, 0x97, 0x97, 0x95, 0x3F, 0xF0, 0x78, 0x78, 0x58, 0xD4, 0x72, 0x86,
+    0x7E, 0xF8, 0x18, 0xEA, 0xDA, 0x23, 0x2D, 0x9F, 0x14, 0x4C, 0x5B, 0x91, 0x22, 0x2B, 0x7C, 0x59,
+    0x78, 0xFE, 0xED, 0x07, 0x73, 0xE5, 0x24, 0x8D, 0x5C, 0x0C, 0x7C, 0x4E, 0xD8, 0xAC, 0xD2, 0x6E,
+    0xFC, 0xFF, 0xD0, 0xFF, 0xDD, 0xF5, 0x27, 0xB5, 0x55, 0x3D, 0x70, 0xDC, 0x44, 0x14, 0xFE, 0xA4,
+    0xCD, 0x59, 0x85, 0x66, 0x58, 0x17, 0xCE, 0x50, 0x18, 0xA2, 0x86, 0xC2, 0x45, 0xB0, 0x1A, 0x0A,
+    0x8A, 0xBB, 0x93, 0x82, 0x8B, 0x14, 0x34, 0x66, 0x26, 0x82, 0x82, 0x86, 0x92, 0xA1, 0xC0, 0x6D,
+    0x8A, 0x73, 0x4E, 0xC4, 0x05, 0x05, 0x05, 0x47, 0x41, 0x4F, 0x1B, 0xBB, 0x30, 0x65, 0x8A, 0x4B,
+    0xB4, 0x81, 0xC2, 0x85, 0x0B, 0x2B, 0x75, 0x0A, 0xC4, 0xE0, 0x50, 0x98, 0xC2, 0xCB, 0x20, 0x0F,
+    0x3A, 0x5B, 0xA7, 0xE5, 0x5B, 0xF9, 0x2E, 0x76, 0x0C, 0x05, 0x30, 0x93, 0x95, 0x6E, 0xB5, 0x6F,
+    0xA5, 0x7D, 0x3F, 0xDF, 0xFB, 0xDE, 0x3B, 0x2C, 0x2D, 0x00, 0xE1, 0x9A, 0x86, 0x97, 0xD7, 0xC0,
+    0xFA, 0x35, 0xCC, 0x87, 0x30, 0x2A, 0x2B, 0xB3, 0x3C, 0xAC, 0x44, 0x0E, 0x8D, 0x12, 0x35, 0x7A,
+    0x30, 0x90, 0xB7, 0xFE, 0x50, 0xE2, 0xA9, 0xD6, 0x38, 0x29, 0xBA, 0x88, 0x0A, 0x09, 0x59, 0x08,
+    0x25, 0x0A, 0x68, 0x77, 0x82, 0x6C, 0xCB, 0x28, 0x53, 0x62, 0xC5, 0x8B, 0xE1, 0x17, 0x54, 0xB6,
+    0x29, 0x15, 0x2E, 0xC6, 0x67, 0x23, 0x20, 0x33, 0x05, 0xA2, 0x6F, 0x32, 0x25, 0x73, 0x64, 0x6E,
+    0x09, 0x51, 0x46, 0x40, 0xB0, 0x97, 0x03, 0xF5, 0x18, 0x90, 0xFB, 0xFC, 0x7C, 0xCC, 0x73, 0xFE,
+    0x81, 0x5D, 0x3C, 0xE2, 0xCE, 0x5E, 0x01, 0x54, 0x91, 0xF5, 0xAF, 0x82, 0xD0, 0xB2, 0x70, 0x6A,
+    0x0C, 0x8F, 0x8C, 0xD5, 0x93, 0x02, 0x09, 0xE0, 0xC6, 0x9F, 0xB8, 0xE5, 0x3D, 0x8C, 0x83, 0xF4,
+    0x9A, 0x13, 0xCF, 0xEC, 0x04, 0x0D, 0xA2, 0xE3, 0x32, 0xC4, 0x30, 0x80, 0xFF, 0x4C, 0xE1, 0x8C,
+    0x16, 0x2B, 0xC8, 0x06, 0xE2, 0x58, 0xE1, 0xB4, 0x44, 0x37, 0x42, 0xDF, 0x9F, 0x64, 0x18, 0x36,
+    0x70, 0xEE, 0x00, 0x0B, 0x0F, 0x68, 0xCF, 0xF0, 0xED, 0x64, 0xB9, 0x66, 0x88, 0xBE, 0x0E, 0x63,
+    0x44, 0x6B, 0x05, 0x9C, 0x6A, 0x73, 0xEE, 0x51, 0xB3, 0xBD, 0xBD, 0x7B, 0x60, 0x8C, 0xA9, 0xAD,
+    0x6B, 0xFB, 0x73, 0xD7, 0xB6, 0x34, 0x9C, 0x32, 0xE2, 0xC7, 0x68, 0x10, 0x28, 0xAF, 0xD9, 0xD5,
+    0xD4, 0x53, 0x01, 0x9D, 0xF5, 0x73, 0x37, 0x86, 0x15, 0x4C, 0x96, 0x8F, 0x9D, 0x7A, 0x80, 0xE0,
+    0x73, 0x1A, 0xFF, 0x36, 0xA1, 0x0A, 0x33, 0x49, 0x3E, 0xCE, 0x20, 0x7E, 0x53, 0xD0, 0x35, 0xAA,
+    0xF0, 0xD7, 0xDA, 0xE1, 0x11, 0x7B, 0xE2, 0xDF, 0x60, 0xA6, 0x66, 0x98, 0xF5, 0x19, 0xE3, 0x97,
+    0x33, 0xCC, 0xFC, 0x83, 0xA3, 0xED, 0xED, 0xDA, 0x6A, 0x6E, 0x31, 0xB3, 0x3B, 0xFB, 0xF9, 0x39,
+    0x66, 0xC1, 0x5A, 0xF9, 0x7F, 0x30, 0xF3, 0x9E, 0xA5, 0x38, 0x7B, 0x9E, 0x0C, 0xA9, 0xB2, 0x49,
+    0x3E, 0xB4, 0x98, 0xE9, 0x2B, 0x98, 0x79, 0xE9, 0x77, 0x88, 0xFC, 0x02, 0x75, 0x30, 0x3F, 0x0E,
+    0xE7, 0x01, 0x1C, 0x63, 0x52, 0xF9, 0x3C, 0xCB, 0xBB, 0x44, 0x43, 0x23, 0xB8, 0xAF, 0x88, 0x0C,
+    0x40, 0xA4, 0x9C, 0xD2, 0x35, 0xA6, 0x90, 0xC6, 0x9A, 0xDF, 0xB4, 0x22, 0x7D, 0x7C, 0x02, 0xF4,
+    0x57, 0xE1, 0xEA, 0x29, 0xC2, 0x2F, 0xCC, 0x4E, 0xE5, 0x30, 0x01, 0xE8, 0x30, 0x19, 0x18, 0x05,
+    0x5B, 0x9A, 0x77, 0x07, 0x33, 0xD5, 0xAE, 0xC9, 0x83, 0xE3, 0x72, 0x05, 0x75, 0x7B, 0xB6, 0x8F,
+    0x64, 0x08, 0x63, 0xB0, 0xB4, 0xCA, 0xF5, 0x12, 0x7A, 0x5D, 0x8C, 0xA3, 0x1D, 0x2D, 0xA9, 0x99,
+    0x99, 0xEC, 0x30, 0x36, 0xC7, 0x4C, 0x49, 0x16, 0x73, 0x01, 0xA1, 0x93, 0xC4, 0x9D, 0x24, 0x6B,
+    0x5C, 0xF3, 0x33, 0x53, 0x5C, 0x92, 0xA7, 0x3D, 0x84, 0xF0, 0x14, 0x2A, 0x12, 0xDA, 0x57, 0x01,
+    0xD5, 0x90, 0xDD, 0xAE, 0x1E, 0x30, 0xA1, 0x5F, 0xD1, 0xE4, 0x58, 0x93, 0xF7, 0x54, 0x81, 0xD0,
+    0xAA, 0xA0, 0xA7, 0x78, 0x8D, 0xBF, 0x1F, 0x29, 0x84, 0x14, 0x5C, 0xFB, 0xA6, 0x63, 0xB5, 0x9A,
+    0x1A, 0xD2, 0xE8, 0x4B, 0x89, 0x72, 0x4C, 0x91, 0xFD, 0xD2, 0xDC, 0xCA, 0xC8, 0x9C, 0xD2, 0x57,
+    0x9E, 0x92, 0xB1, 0x35, 0xA4, 0x31, 0xF0, 0x53, 0x54, 0x5D, 0x38, 0xBF, 0x17, 0x10, 0x3F, 0x31,
+    0x70, 0x12, 0x84, 0xDC, 0xE7, 0xAB, 0x56, 0xBB, 0x47, 0x48, 0x06, 0x2D, 0x1D, 0x24, 0x03, 0x0C,
+    0x28, 0xE1, 0x86, 0x9B, 0x32, 0x6B, 0x8F, 0x81, 0xC8, 0xCB, 0x5F, 0x71, 0x14, 0x18, 0x2D, 0x41,
+    0xFE, 0x50, 0x32, 0x97, 0x39, 0x16, 0x3B, 0x73, 0x5B, 0x9E, 0xB9, 0x6F, 0xBE, 0x9E, 0x2C, 0x4C,
+    0x65, 0x2A, 0xF2, 0x10, 0x01, 0x4D, 0x95, 0x18, 0x0B, 0xE5, 0xE8, 0x55, 0x88, 0x82, 0x5D, 0x62,
+    0x2F, 0x85, 0xA4, 0xA1, 0x90, 0x95, 0x19, 0x59, 0x5B, 0x34, 0x45, 0x47, 0x6F, 0xD0, 0x49, 0x0D,
+    0xB9, 0xCB, 0x4D, 0x1A, 0xBF, 0x77, 0xD1, 0x44, 0xE2, 0xEF, 0x59, 0x4A, 0xAC, 0xA9, 0x21, 0x09,
+    0x13, 0x6C, 0x95, 0x70, 0xD3, 0x77, 0x5E, 0x65, 0x48, 0x76, 0xBC, 0x7B, 0x93, 0xBE, 0x94, 0x90,
+    0xEF, 0x2B, 0x3C, 0xEC, 0x42, 0x3C, 0x79, 0xC1, 0x86, 0x61, 0x15, 0x56, 0x66, 0xB4, 0x91, 0x57,
+    0xE8, 0xB9, 0xDA, 0xD1, 0x22, 0x97, 0xB1, 0xAF, 0xC8, 0x57, 0xB7, 0x40, 0x5F, 0x32, 0x13, 0x77,
+    0x81, 0x3F, 0x15, 0x5C, 0x72, 0x51, 0x58, 0x92, 0xF2, 0x5C, 0x8F, 0x8E, 0x32, 0x50, 0xBA, 0xC3,
+    0x2A, 0x10, 0x2C, 0x22, 0xAF, 0xB0, 0x8A, 0x56, 0xFC, 0xB8, 0x6D, 0x99, 0x3E, 0x55, 0xCD, 0x47,
+    0x27, 0x71, 0x92, 0x8F, 0x4C, 0x6E, 0xAA, 0x8D, 0x74, 0xB9, 0xA0, 0xEF, 0x25, 0xAF, 0x1E, 0x2F,
+    0x19, 0xCB, 0x58, 0xE4, 0x0C, 0xB0, 0xC4, 0x94, 0x62, 0x70, 0x9A, 0xC5, 0x2C, 0x95, 0x9C, 0x55,
+    0x6F, 0xA3, 0xA0, 0x01, 0x7E, 0x71, 0x8E, 0xA1, 0x0D, 0xCB, 0x31, 0x23, 0xDA, 0xA9, 0x9C, 0xF4,
+    0xAD, 0x59, 0x6A, 0x14, 0x16, 0x5F, 0xB4, 0x64, 0xDF, 0xF8, 0x26, 0xAC, 0xC2, 0x52, 0xA6, 0x01,
+    0x4B, 0x61, 0x80, 0xCA, 0xD1, 0xAE, 0xF6, 0x94, 0x77, 0xB2, 0xC1, 0xAC, 0x91, 0x40, 0x1F, 0x10,
+    0x24, 0x42, 0x68, 0xDD, 0x75, 0xB2, 0x94, 0x75, 0x80, 0x24, 0x49, 0x22, 0x43, 0x88, 0xB7, 0x59,
+    0xDB, 0x3D, 0x5F, 0xF9, 0xEF, 0x69, 0x57, 0x8D, 0xB1, 0x18, 0xB6, 0xD1, 0xB9, 0xBA, 0x4D, 0xDF,
+    0x55, 0x21, 0x9C, 0x20, 0x62, 0x05, 0x09, 0x6E, 0x3C, 0x04, 0x58, 0x69, 0x6C, 0x4D, 0x68, 0x31,
+    0x8C, 0xCC, 0x34, 0x34, 0x53, 0x51, 0xBC, 0x2D, 0x8A, 0x37, 0x45, 0xF1, 0x06, 0x63, 0xBA, 0x72,
+    0xFB, 0x6C, 0x23, 0x2C, 0x46, 0x06, 0x44, 0x80, 0x7C, 0x9E, 0xA4, 0x23, 0xCC, 0xCE, 0xE8, 0xAE,
+    0x05, 0xDF, 0x36, 0x36, 0xCF, 0xB6, 0x38, 0x5C, 0xC2, 0x2C, 0xC6, 0xF5, 0x3B, 0x6D, 0x31, 0x3D,
+    0x65, 0x0A, 0x97, 0x73, 0x8B, 0xF9, 0xC0, 0xFA, 0xE1, 0xA9, 0xBF, 0x2D, 0xD9, 0xBF, 0xB8, 0x3C,
+    0x32, 0xB1, 0xDD, 0xAD, 0xED, 0xAE, 0x97, 0xDB, 0x65, 0xDF, 0x2E, 0x45, 0xBB, 0x1C, 0xD8, 0x65,
+    0xA0, 0x06, 0x6E, 0x93, 0x69, 0xA6, 0xDA, 0x1C, 0x4A, 0x33, 0x2B, 0xA2, 0x85, 0x98, 0x9D, 0xD4,
+    0x22, 0x7A, 0x3E, 0x39, 0x88, 0x2F, 0xB9, 0x11, 0x4D, 0x31, 0x9C, 0x86, 0x15, 0xA2, 0x92, 0x69,
+    0xF0, 0xD4, 0xA5, 0xE9, 0xEC, 0x90, 0x93, 0x69, 0xAC, 0x18, 0xDA, 0x49, 0xDE, 0x9E, 0x4F, 0x01,
+    0x4D, 0x9D, 0x4E, 0xFD, 0x2A, 0x32, 0x87, 0xD1, 0xB4, 0xD5, 0x72, 0x3D, 0x49, 0xD6, 0xD8, 0x33,
+    0xBD, 0xD3, 0x1D, 0xD6, 0x0D, 0x09, 0xE6, 0xF2, 0x71, 0x93, 0xB0, 0xC6, 0xC4, 0xF4, 0xF5, 0x93,
+    0x75, 0x8F, 0x7D, 0xCB, 0x82, 0x4C, 0xE9, 0xE5, 0x87, 0xDF, 0xC4, 0xC2, 0xF6, 0x3F, 0x76, 0x0B,
+    0x90, 0x85, 0x8B, 0xBA, 0x25, 0x7A, 0x14, 0xFF, 0x33, 0xE2, 0xC4, 0xF7, 0x25, 0xC4, 0x27, 0x2D,
+    0xE2, 0x42, 0xD9, 0xFB, 0x76, 0xCA, 0x3F, 0x68, 0x7C, 0x8A, 0xFF, 0x34, 0xFE, 0x02, 0x95, 0x55,
+    0x3D, 0x6C, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0xE7, 0xCC, 0x0A, 0x6F, 0xE2, 0xB9, 0x22, 0x29, 0x22,
+    0xD9, 0xDE, 0x06, 0xA4, 0x44, 0xB2, 0x7D, 0x29, 0x5C, 0x58, 0x68, 0xF7, 0x76, 0x93, 0x2B, 0x28,
+    0x28, 0x92, 0xC2, 0x57, 0x21, 0x25, 0xD0, 0x20, 0x1A, 0x44, 0x24, 0x5C, 0xB8, 0x38, 0xC7, 0xAB,
+    0x9C, 0x44, 0x84, 0x28, 0x88, 0x10, 0x5D, 0x0A, 0x2C, 0x68, 0x82, 0x5D, 0x70, 0xC5, 0x45, 0x32,
+    0xD2, 0x39, 0x37, 0x67, 0x17, 0x91, 0xA0, 0xC8, 0x44, 0x29, 0x29, 0x58, 0x42, 0xA0, 0x70, 0x35,
+    0x42, 0x8B, 0xB4, 0x89, 0xEE, 0x6E, 0x78, 0xB3, 0x77, 0xC6, 0x8E, 0xB0, 0xF2, 0x33, 0x33, 0x3B,
+    0xBF, 0xEF, 0xBD, 0x79, 0x6F, 0xDE, 0xB7, 0xEF, 0x9D, 0xAE, 0xA3, 0x5E, 0x33, 0xBA, 0x32, 0x70,
+    0x33, 0x5C, 0x87, 0x2F, 0x45, 0x82, 0x1D, 0x47, 0x83, 0xEB, 0x06, 0xE0, 0x3F, 0x88, 0x81, 0x6E,
+    0x0A, 0xF0, 0x3E, 0x80, 0x8A, 0x04, 0xDC, 0x21, 0x4D, 0xFE, 0xCE, 0x80, 0x50, 0x48, 0x78, 0x49,
+    0x04, 0xA6, 0x9D, 0x1C, 0x21, 0x84, 0xAC, 0x3C, 0xC1, 0xBA, 0x30, 0x92, 0x58, 0x89, 0x8F, 0x3E,
+    0x66, 0x27, 0x11, 0x7D, 0x9F, 0x12, 0x9B, 0x20, 0x19, 0x76, 0x99, 0x47, 0x99, 0x51, 0xDD, 0xE4,
+    0x3A, 0x32, 0xAC, 0x89, 0x18, 0x9D, 0x36, 0x89, 0x4F, 0x00, 0x92, 0xEE, 0xE6, 0x40, 0x90, 0x83,
+    0xF7, 0x32, 0x84, 0x8E, 0x76, 0x33, 0xAE, 0xBB, 0x19, 0x27, 0x2E, 0x4F, 0x8E, 0xC4, 0x91, 0x36,
+    0xB4, 0x74, 0xBA, 0xB4, 0xA3, 0x70, 0xFA, 0x79, 0x9D, 0x93, 0xA3, 0x3A, 0x8B, 0xAF, 0x48, 0xE7,
+    0xF5, 0x14, 0x6C, 0x6B, 0x78, 0x07, 0x91, 0x31, 0xF2, 0x38, 0x9D, 0x59, 0xA1, 0xB3, 0xAA, 0x3C,
+    0x61, 0xE6, 0x5B, 0x23, 0xBB, 0xE6, 0xA8, 0x62, 0x8D, 0x43, 0xC5, 0xBA, 0x26, 0xC3, 0xFB, 0x83,
+    0x18, 0x41, 0x76, 0xA8, 0x98, 0x9B, 0x77, 0xB3, 0x6E, 0xF6, 0xC6, 0x47, 0x07, 0x85, 0xF4, 0x3A,
+    0x51, 0x49, 0x74, 0xD4, 0xFB, 0xE6, 0x4D, 0xDC, 0x3A, 0xB6, 0x15, 0xA6, 0x2B, 0x2C, 0xD5, 0xAF,
+    0xEC, 0xFF, 0x28, 0xA7, 0xE5, 0x46, 0x2F, 0x91, 0x78, 0x51, 0x25, 0xFD, 0xE1, 0x62, 0x1A, 0x77,
+    0xEB, 0xCF, 0xB6, 0x16, 0xF9, 0x24, 0x77, 0x6A, 0xE0, 0x2F, 0xAC, 0xAC, 0xBE, 0x6C, 0x06, 0x9B,
+    0x77, 0xC6, 0x3D, 0x0D, 0x66, 0x48, 0x7D, 0xBD, 0x5E, 0x27, 0xF3, 0xFF, 0xAC, 0xD7, 0x2F, 0xD7,
+    0x8B, 0xB2, 0x6E, 0x6C, 0xF9, 0xA7, 0x98, 0x2F, 0x1F, 0xB3, 0x75, 0x6A, 0xA2, 0xE1, 0xBF, 0x5E,
+    0xFD, 0x78, 0x92, 0xB8, 0x49, 0x86, 0x02, 0x9C, 0xCD, 0xCD, 0x1F, 0x68, 0x91, 0x58, 0xC7, 0xF3,
+    0x3D, 0xA9, 0xB7, 0x23, 0x4F, 0x65, 0x13, 0x9E, 0xCA, 0xAB, 0xA2, 0xB6, 0xAB, 0x52, 0xB8, 0x3D,
+    0x9A, 0x35, 0x7B, 0xA9, 0x2E, 0xE3, 0x94, 0x7F, 0x69, 0x37, 0x6D, 0x08, 0xA6, 0xE6, 0x18, 0x62,
+    0x1D, 0x04, 0x82, 0x13, 0xF9, 0x82, 0xD8, 0xD3, 0x3B, 0x95, 0x1A, 0xF1, 0xB0, 0x8B, 0xD9, 0x8E,
+    0x68, 0xA6, 0x96, 0x51, 0xE9, 0x60, 0xDE, 0xAB, 0x25, 0xA9, 0x05, 0x53, 0xC3, 0xBF, 0x69, 0xF7,
+    0x9A, 0xA9, 0x0E, 0x66, 0xDD, 0xA6, 0xD4, 0xE5, 0x12, 0x4E, 0x4D, 0xB8, 0x0F, 0xB3, 0x7E, 0xE4,
+    0xDD, 0x48, 0x1B, 0x3E, 0xC9, 0x98, 0x71, 0xE3, 0xD6, 0x1C, 0xCE, 0x01, 0x55, 0xF2, 0x74, 0xD1,
+    0x02, 0x44, 0xF7, 0x86, 0x91, 0x19, 0x96, 0xE7, 0x80, 0x51, 0x0B, 0x0E, 0x8E, 0x46, 0xAD, 0x5A,
+    0xB8, 0xE6, 0x58, 0x96, 0xA0, 0x34, 0x26, 0x28, 0xF6, 0xDF, 0x0E, 0xCF, 0xD0, 0x66, 0x75, 0xED,
+    0x93, 0x43, 0xC6, 0x82, 0x77, 0xE1, 0xBD, 0xBE, 0xF9, 0xB5, 0x1F, 0xC5, 0x78, 0x0B, 0xBE, 0x72,
+    0xCD, 0x05, 0x33, 0x58, 0x37, 0xBF, 0x99, 0x9B, 0x43, 0xC2, 0x57, 0x99, 0x4E, 0xFD, 0x3D, 0xB2,
+    0x17, 0xC8, 0xBC, 0x2F, 0xF5, 0xBA, 0x9F, 0x10, 0xCA, 0xE3, 0xE2, 0x42, 0x91, 0x78, 0xD2, 0xFD,
+    0x45, 0x73, 0xCD, 0x9F, 0xE6, 0x84, 0xFD, 0x9D, 0x12, 0x6C, 0x3D, 0x23, 0xEE, 0xEB, 0xF6, 0x08,
+    0x29, 0xF1, 0x15, 0xF5, 0x7A, 0x48, 0x61, 0xCF, 0xDC, 0x57, 0x43, 0x0A, 0x79, 0x2A, 0xF1, 0xD2,
+    0x73, 0x77, 0x3E, 0xFC, 0x82, 0x25, 0x2F, 0xAF, 0xF4, 0xF0, 0x25, 0x4C, 0x2E, 0x62, 0x72, 0xE9,
+    0xF4, 0x95, 0xB3, 0xFB, 0x9D, 0xCF, 0xD8, 0xFD, 0x13, 0xD3, 0xD7, 0xCE, 0x7F, 0x4E, 0x37, 0x73,
+    0xE0, 0x04, 0x70, 0x1E, 0x2F, 0x99, 0x5A, 0xEB, 0x4B, 0x98, 0xDE, 0x70, 0x7E, 0xC6, 0xDC, 0xDD,
+    0xE5, 0x47, 0xFB, 0xAD, 0x47, 0xB1, 0xFC, 0xBE, 0x86, 0xAF, 0x5F, 0x85, 0xF7, 0x60, 0x5A, 0xC2,
+    0x41, 0xB9, 0x4C, 0xCA, 0x5B, 0x8B, 0x07, 0xE0, 0xD2, 0x46, 0x99, 0xAB, 0xB1, 0x67, 0xB7, 0x03,
+    0x57, 0xCE, 0xDA, 0xB1, 0xC1, 0x65, 0x60, 0xC7, 0x55, 0x2E, 0x57, 0xC6, 0xA3, 0x1E, 0x8D, 0xBB,
+    0xD2, 0x2A, 0x12, 0x78, 0xCD, 0x1B, 0x06, 0x95, 0xAC, 0x72, 0xD5, 0x13, 0xB7, 0xE5, 0x4F, 0x1D,
+    0xD1, 0x9F, 0x99, 0xE5, 0x4A, 0x2F, 0x20, 0x0E, 0xE6, 0xD9, 0xEF, 0x29, 0x45, 0x99, 0x56, 0xC8,
+    0x1E, 0x2B, 0x01, 0xA4, 0x41, 0x31, 0x3A, 0x32, 0x74, 0x1E, 0xA7, 0xB3, 0x70, 0x93, 0x05, 0xDE,
+    0xD3, 0xF3, 0x10, 0x10, 0xB7, 0x93, 0xA7, 0x1D, 0xCC, 0xDB, 0x90, 0x12, 0x69, 0x0B, 0xA8, 0xCB,
+    0x98, 0xF8, 0x4F, 0x3D, 0x38, 0x2A, 0x6F, 0x54, 0x7D, 0x42, 0x6C, 0xB1, 0x6A, 0xCF, 0x8B, 0xE6,
+    0x43, 0xDD, 0xA9, 0x8A, 0x9B, 0x3D, 0xDD, 0x0E, 0xA7, 0x78, 0x32, 0xA6, 0x22, 0x48, 0xCB, 0x3C,
+    0xF4, 0xDF, 0xDD, 0xB5, 0x67, 0x44, 0xD1, 0xA8, 0x78, 0x84, 0xF4, 0xA5, 0x29, 0x3E, 0x02, 0x07,
+    0x97, 0x55, 0x47, 0x8B, 0xB8, 0xC3, 0xD5, 0xC9, 0x62, 0xAD, 0x67, 0x79, 0xDA, 0xF1, 0x64, 0x26,
+    0x2E, 0xEA, 0x0A, 0x57, 0xA1, 0x2B, 0x17, 0xBD, 0xB1, 0x20, 0xC1, 0xD2, 0x80, 0xCE, 0x88, 0x56,
+    0xD4, 0x34, 0x1D, 0x53, 0x78, 0x0A, 0x3D, 0x49, 0x14, 0x9A, 0xC7, 0xAD, 0x11, 0x33, 0x3E, 0x80,
+    0x9B, 0x62, 0x2D, 0x75, 0x7B, 0x69, 0x83, 0x15, 0x31, 0x78, 0xD1, 0x95, 0x0D, 0x4F, 0x55, 0x09,
+    0x76, 0x1D, 0x6C, 0x63, 0x15, 0xB8, 0x46, 0x21, 0x2F, 0x63, 0x39, 0xDD, 0x29, 0x73, 0x91, 0xAC,
+    0x8C, 0x65, 0x6F, 0x90, 0x0B, 0x96, 0x9C, 0x78, 0x69, 0xCA, 0x95, 0x29, 0xBF, 0x58, 0x4B, 0x98,
+    0x7D, 0x96, 0x15, 0x32, 0x78, 0xA6, 0x05, 0x9F, 0x6E, 0xF0, 0x3D, 0x7A, 0xDB, 0xE9, 0x56, 0xB1,
+    0xC7, 0x94, 0x07, 0x5E, 0x6B, 0xCA, 0x93, 0x44, 0x6B, 0x79, 0x36, 0x0A, 0xF7, 0x01, 0x67, 0xF1,
+    0x9D, 0x16, 0x0F, 0x64, 0xB5, 0x8A, 0x3C, 0xE7, 0x8F, 0x52, 0x71, 0x29, 0x0E, 0x43, 0xE8, 0x8C,
+    0xEF, 0x29, 0xE1, 0xD1, 0x93, 0x43, 0xAF, 0x38, 0x3D, 0x35, 0x36, 0x66, 0x95, 0xFD, 0x91, 0x11,
+    0x6D, 0x54, 0x42, 0xF9, 0x48, 0xDC, 0xBA, 0x34, 0xD8, 0x1C, 0xBD, 0x9A, 0xF5, 0x3B, 0xF9, 0x92,
+    0x7E, 0x8F, 0xA5, 0xE2, 0x3F, 0x9E, 0x22, 0xEB, 0x09, 0x08, 0xB1, 0x05, 0x02, 0x23, 0x2C, 0x90,
+    0x69, 0xAD, 0x83, 0xB3, 0x99, 0xE2, 0xCC, 0x2B, 0xCE, 0x1C, 0x35, 0xC2, 0x60, 0x51, 0xFC, 0x14,
+    0x26, 0x8E, 0x06, 0x8E, 0x49, 0xDF, 0xE9, 0x5E, 0xF8, 0x2B, 0xB7, 0xA9, 0x25, 0xB4, 0x44, 0xB3,
+    0x64, 0x01, 0xB1, 0x38, 0xB6, 0xF3, 0x25, 0xBB, 0xE7, 0x9A, 0xA4, 0xD2, 0x17, 0x03, 0x4A, 0x22,
+    0xE2, 0x16, 0xD6, 0xE0, 0x59, 0xC1, 0x6E, 0x21, 0xFD, 0xD0, 0xD3, 0x96, 0xCB, 0x4B, 0x29, 0xBF,
+    0xB9, 0x8A, 0x3A, 0x16, 0x8F, 0x50, 0x3A, 0x49, 0x59, 0x4C, 0xEC, 0x19, 0xC5, 0xD3, 0xFD, 0x01,
+    0xEC, 0x05, 0x14, 0x2A, 0xC8, 0x97, 0x98, 0xE1, 0x8A, 0x14, 0xCA, 0x48, 0x7A, 0xC8, 0x4C, 0x2A,
+    0x62, 0xA2, 0x50, 0xD5, 0x18, 0x6D, 0x12, 0x3D, 0x4F, 0xEA, 0x7B, 0xCF, 0xC9, 0xA5, 0x7C, 0x2A,
+    0xD4, 0x1A, 0x25, 0x33, 0x42, 0x56, 0xF9, 0x2C, 0x6D, 0x76, 0x9C, 0x21, 0xFA, 0xDC, 0xC8, 0x9C,
+    0x6F, 0x69, 0xCA, 0x92, 0xDB, 0x36, 0x53, 0x52, 0x36, 0x9B, 0xCB, 0x8A, 0x91, 0xF5, 0x33, 0x74,
+    0xB3, 0x36, 0x8C, 0x6A, 0xD3, 0x95, 0x2B, 0xF4, 0x4C, 0x2B, 0xE4, 0xD3, 0x83, 0xB2, 0x4A, 0x6A,
+    0x0F, 0xB0, 0x63, 0xA3, 0x0C, 0x3D, 0x44, 0x19, 0xFF, 0x2F, 0xFF, 0x02, 0x85, 0x55, 0x4F, 0x6C,
+    0x14, 0x55, 0x18, 0xFF, 0xCD, 0xBC, 0xB6, 0x23, 0x4C, 0xE8, 0xE3, 0xC0, 0x06, 0xC4, 0xD0, 0xE1,
+    0xC0, 0xC1, 0x43, 0xB7, 0xEB, 0xC1, 0x43, 0x0F, 0xB3, 0xBB, 0x53, 0x38, 0x78, 0xEC, 0x26, 0xB2,
+    0x5E, 0x38, 0x68, 0xE2, 0x45, 0x21, 0xA1, 0x98, 0xF4, 0xD0, 0xE0, 0xB6, 0x9D, 0xD2, 0x83, 0x07,
+    0x0E, 0x34, 0x46, 0x3C, 0xEA, 0x41, 0x43, 0x74, 0x3D, 0x94, 0xC3, 0x1A, 0xF7, 0xB0, 0xB8, 0x23,
+    0x3D, 0x70, 0x20, 0x81, 0xA9, 0xE8, 0xC9, 0x10, 0x1E, 0x25, 0x68, 0x02, 0x89, 0x7D, 0xCA, 0x34,
+    0x8C, 0x74, 0x77, 0x3F, 0xBF, 0x37, 0xBB, 0x45, 0x10, 0x13, 0x67, 0x76, 0xF6, 0xFD, 0xFB, 0xDE,
+    0xF7, 0xE7, 0xF7, 0xFD, 0xBE, 0xF7, 0x00, 0xC0, 0x53, 0xD6, 0xD2, 0x76, 0x77, 0x66, 0xD4, 0x6A,
+    0xEB, 0xBD, 0xC8, 0x21, 0x7B, 0xDC, 0xA3, 0xB1, 0xF6, 0xE5, 0xF2, 0x7A, 0x52, 0xF3, 0xDC, 0xAB,
+    0xBA, 0x53, 0xDA, 0xE9, 0xAA, 0x46, 0x51, 0x8A, 0x48, 0x4D, 0xEE, 0x71, 0x82, 0xBE, 0xE0, 0xFB,
+    0xF0, 0x08, 0xE9, 0x82, 0x1B, 0xD6, 0x8A, 0xD0, 0x5A, 0xDC, 0x8A, 0xE4, 0x34, 0xFC, 0xA2, 0xA5,
+    0x5B, 0x32, 0xEC, 0x75, 0xD0, 0x0E, 0x8D, 0x8C, 0x05, 0x14, 0x21, 0x12, 0x14, 0x62, 0xEB, 0x61,
+    0x20, 0xF3, 0xD0, 0x0D, 0xF7, 0xD3, 0x9F, 0xCA, 0xA4, 0x73, 0x0B, 0x01, 0x1A, 0xB0, 0x63, 0x23,
+    0x72, 0x5C, 0x50, 0xB4, 0x55, 0x99, 0x84, 0x5C, 0x71, 0x08, 0x8E, 0x86, 0x0F, 0x09, 0xF7, 0x5C,
+    0x3B, 0xA2, 0xCC, 0xCE, 0xCB, 0x28, 0xC7, 0x0B, 0xAC, 0xA4, 0x5C, 0x91, 0xF4, 0xD1, 0x0F, 0x5B,
+    0xCA, 0xAB, 0x39, 0x37, 0x8F, 0x6E, 0x90, 0x2E, 0x28, 0x5E, 0xCC, 0x1D, 0x6F, 0xD3, 0xD6, 0x8C,
+    0xF2, 0xD1, 0xB0, 0xB4, 0x88, 0x9C, 0xC8, 0x0D, 0x24, 0x6F, 0x1E, 0x35, 0x5A, 0x3F, 0x11, 0x74,
+    0x2E, 0xD6, 0x3A, 0x3F, 0xE1, 0xD9, 0x04, 0x8A, 0x93, 0xF9, 0x39, 0xE7, 0x33, 0xFB, 0xDE, 0xAF,
+    0xFD, 0x7D, 0xD6, 0x8A, 0xA0, 0x63, 0xEB, 0x7F, 0xE8, 0x09, 0x56, 0x36, 0x75, 0x97, 0x52, 0xAF,
+    0x0B, 0x0F, 0xDE, 0x54, 0x3B, 0xE8, 0x19, 0x93, 0x43, 0xFB, 0xC4, 0x76, 0x67, 0x24, 0x69, 0x3A,
+    0xA1, 0x1E, 0x13, 0xD1, 0x9C, 0xB4, 0x94, 0xEF, 0x2E, 0x25, 0xED, 0x69, 0x6D, 0xF5, 0x50, 0xA0,
+    0x29, 0x5D, 0x70, 0x03, 0xDF, 0x1F, 0x84, 0x2C, 0xB3, 0x90, 0xE7, 0xBD, 0xA0, 0x9D, 0x30, 0x20,
+    0x80, 0x1D, 0xB5, 0xA3, 0x53, 0x91, 0x78, 0xE6, 0x75, 0xE2, 0xC5, 0x4E, 0xAE, 0x32, 0x92, 0xBA,
+    0x9B, 0x6B, 0x51, 0xA2, 0x8A, 0xEC, 0x9F, 0x0C, 0x64, 0xC8, 0x6F, 0x20, 0x1F, 0x7C, 0x41, 0xBC,
+    0xE4, 0xA6, 0x72, 0x73, 0x39, 0xD0, 0x98, 0x43, 0x8B, 0x5D, 0x7D, 0xAB, 0x0F, 0x80, 0xB7, 0x4C,
+    0x21, 0xEB, 0x73, 0x03, 0x5C, 0x81, 0x93, 0x30, 0x06, 0xE2, 0x97, 0x20, 0x9F, 0xB7, 0x54, 0x43,
+    0x7E, 0x93, 0x16, 0x48, 0x23, 0x0F, 0xC6, 0xCF, 0x0A, 0x77, 0xD7, 0x19, 0x3C, 0x0D, 0x06, 0x2F,
+    0xB1, 0xDB, 0x81, 0x65, 0xF6, 0x7A, 0x28, 0xBC, 0x41, 0x01, 0xEF, 0x9D, 0x09, 0xBE, 0x0F, 0x5A,
+    0x68, 0xA1, 0x9C, 0x7A, 0x74, 0x2D, 0xFC, 0x2B, 0x43, 0x6E, 0x79, 0x9D, 0xD4, 0xC8, 0xCA, 0xC9,
+    0x3A, 0x91, 0xCA, 0xAF, 0xD4, 0xA0, 0x2D, 0xC5, 0x0E, 0x86, 0x7D, 0xD0, 0x76, 0xC1, 0x49, 0x9D,
+    0x87, 0x6B, 0x51, 0x43, 0xFB, 0xDE, 0x69, 0x9B, 0xAC, 0xC7, 0x5A, 0x97, 0xE6, 0x9C, 0xCF, 0xC5,
+    0x8F, 0xA4, 0x0E, 0x06, 0x4E, 0xE6, 0xFF, 0x96, 0x1E, 0x63, 0x25, 0x1F, 0x2B, 0x4A, 0x47, 0x5A,
+    0x98, 0xC0, 0xA2, 0xDD, 0xC3, 0x7B, 0x06, 0x31, 0x8F, 0x68, 0x83, 0x28, 0x95, 0xC1, 0xA8, 0x88,
+    0x45, 0x98, 0x20, 0x28, 0x82, 0xA3, 0x84, 0xA0, 0x2E, 0x88, 0x06, 0x83, 0x53, 0x4F, 0x58, 0x2C,
+    0x46, 0x7F, 0xF0, 0x8A, 0x19, 0x44, 0xBC, 0x73, 0x2F, 0xB0, 0x98, 0xC0, 0x5B, 0x8D, 0x44, 0x5C,
+    0x44, 0xCD, 0x8E, 0x5D, 0xA6, 0x4D, 0xC2, 0x22, 0x60, 0xA4, 0x3B, 0xD6, 0x6A, 0xD5, 0xC4, 0xE4,
+    0x10, 0x61, 0xFF, 0xFD, 0x0A, 0xC7, 0x06, 0xC1, 0x7B, 0x9A, 0x40, 0x9B, 0xE8, 0xFA, 0x26, 0xA5,
+    0x47, 0x0C, 0x67, 0x73, 0x7D, 0x3A, 0x12, 0x25, 0xA6, 0xB1, 0xE9, 0x44, 0x9A, 0x8D, 0x53, 0x5B,
+    0x9B, 0x46, 0x28, 0x61, 0x48, 0x06, 0x83, 0xB8, 0xB1, 0x57, 0x42, 0xD1, 0xCD, 0x96, 0x2D, 0x5D,
+    0xC4, 0x70, 0x45, 0x28, 0xEF, 0x02, 0x69, 0xD2, 0x72, 0x33, 0xDD, 0xFF, 0xB3, 0x7B, 0x34, 0x2A,
+    0xF7, 0x98, 0x41, 0xFE, 0x30, 0x58, 0x87, 0xCF, 0xC8, 0x0B, 0x26, 0x8B, 0x06, 0xF1, 0x5E, 0x63,
+    0x79, 0x31, 0x2A, 0x65, 0x9E, 0x49, 0xB3, 0x5C, 0x84, 0xF2, 0x39, 0x0A, 0x74, 0xDF, 0xBD, 0xAA,
+    0x39, 0x4C, 0x8B, 0x2E, 0xF4, 0xFA, 0x65, 0x61, 0x19, 0x7F, 0x86, 0x38, 0x75, 0xA4, 0x40, 0xAB,
+    0x91, 0x8C, 0xC6, 0x38, 0x07, 0xAF, 0x3B, 0x31, 0x82, 0x02, 0xB0, 0xBB, 0x57, 0x47, 0x99, 0x52,
+    0x4E, 0x52, 0x16, 0xD5, 0xC1, 0xDE, 0x57, 0x99, 0x0D, 0xC9, 0xAE, 0x79, 0x1C, 0x79, 0x39, 0xB4,
+    0xB2, 0xE5, 0x02, 0x85, 0x7D, 0x3D, 0x2C, 0xC6, 0xD3, 0xB5, 0x7E, 0xE0, 0xC5, 0x6A, 0xFD, 0x12,
+    0x11, 0xDD, 0x8B, 0x31, 0x6C, 0x82, 0xCA, 0xBE, 0x41, 0x2D, 0x32, 0x8E, 0x42, 0xA3, 0xAC, 0xC5,
+    0x6D, 0xED, 0x9F, 0xD1, 0x4B, 0xEB, 0x21, 0x17, 0xE9, 0x21, 0x60, 0x16, 0x56, 0x8C, 0x17, 0xBA,
+    0x3B, 0x4F, 0x03, 0x19, 0xD6, 0xD0, 0x27, 0xBF, 0xAE, 0xFE, 0xC9, 0x8A, 0xEF, 0x06, 0xC6, 0x2F,
+    0x06, 0xDC, 0x34, 0x38, 0xD3, 0x17, 0x3A, 0xFC, 0x9F, 0x2A, 0x06, 0xDD, 0x3D, 0x87, 0xC6, 0xF3,
+    0x1F, 0xA8, 0x89, 0xDF, 0xC1, 0x55, 0x35, 0xB1, 0xA3, 0xD6, 0x0D, 0x66, 0x99, 0xCB, 0x0D, 0x76,
+    0xBC, 0x31, 0x5F, 0xAD, 0x3E, 0x66, 0xC5, 0x8F, 0x22, 0xF0, 0xD1, 0x01, 0x2E, 0x51, 0x09, 0x07,
+    0xAF, 0xED, 0x28, 0x66, 0x8F, 0x17, 0x13, 0xE7, 0x76, 0xE2, 0xCF, 0xEA, 0xA9, 0x38, 0x78, 0x4E,
+    0xF1, 0xAE, 0x43, 0x07, 0x78, 0xB6, 0x78, 0x87, 0x43, 0x42, 0x39, 0x63, 0xC9, 0xE1, 0x7F, 0x02,
+    0x7C, 0x4E, 0x7C, 0x2A, 0x3E, 0x76, 0x6D, 0x9A, 0x67, 0x05, 0xB1, 0x80, 0x75, 0xE2, 0x62, 0x81,
+    0x7A, 0xB9, 0x6A, 0x05, 0xA8, 0x98, 0xD3, 0x85, 0xCB, 0x27, 0x2B, 0x14, 0x3B, 0x82, 0x0B, 0x7F,
+    0x5C, 0x44, 0x97, 0x7D, 0x7B, 0xED, 0xFE, 0x09, 0x8F, 0x3A, 0xEC, 0x6D, 0x3E, 0xFB, 0xBD, 0x6A,
+    0x7C, 0xD9, 0x07, 0x4B, 0x19, 0xA4, 0xC7, 0xC0, 0x9E, 0x73, 0x57, 0x84, 0x18, 0x95, 0x98, 0x94,
+    0x50, 0x52, 0x5C, 0x9C, 0x91, 0x9C, 0x5F, 0x5B, 0xF1, 0x22, 0xFF, 0xED, 0x1E, 0x24, 0xD9, 0xC0,
+    0x36, 0x04, 0x9F, 0x2B, 0x47, 0x06, 0xE2, 0x66, 0x80, 0xED, 0x07, 0x75, 0x26, 0x65, 0x6F, 0x40,
+    0x51, 0x6E, 0x6C, 0x96, 0x78, 0x87, 0xD3, 0x97, 0x8D, 0x72, 0x82, 0xD7, 0x4A, 0xF5, 0xFA, 0x25,
+    0x93, 0x32, 0x06, 0xE4, 0x18, 0x0F, 0x8D, 0x9C, 0xF9, 0xAC, 0xA7, 0x60, 0xF8, 0xDA, 0xD9, 0x48,
+    0x3E, 0x3C, 0xFF, 0xED, 0x8D, 0xF1, 0x78, 0xF2, 0x32, 0x36, 0x22, 0x71, 0x1E, 0xA3, 0xE3, 0x78,
+    0xA6, 0xBB, 0x8F, 0xE3, 0xC2, 0x11, 0x63, 0xDA, 0xAA, 0x40, 0x17, 0x88, 0xF4, 0xC9, 0x7A, 0x9D,
+    0xD3, 0x65, 0xFD, 0xC6, 0x3A, 0xCD, 0x30, 0xA3, 0x27, 0x74, 0xA6, 0xF4, 0x85, 0xDD, 0x83, 0xAE,
+    0x7D, 0x63, 0xFC, 0x5E, 0xDA, 0x16, 0x1B, 0x5A, 0xDC, 0x31, 0x46, 0x8D, 0xF9, 0x95, 0x03, 0x70,
+    0xC3, 0x26, 0xE3, 0xD4, 0x74, 0xB9, 0x8A, 0xCF, 0xD6, 0xEB, 0xDF, 0xB1, 0x5F, 0x8F, 0x58, 0x27,
+    0x73, 0x34, 0x71, 0x42, 0x37, 0x70, 0xC2, 0x06, 0x53, 0x3A, 0x60, 0x9C, 0x30, 0xCC, 0x3C, 0x15,
+    0xB7, 0x34, 0x6C, 0x7D, 0x85, 0xD9, 0xC3, 0x85, 0x51, 0xE3, 0x42, 0xE3, 0xA3, 0x80, 0xD9, 0x2C,
+    0x89, 0x22, 0x5B, 0x33, 0x2D, 0x4B, 0xEC, 0x82, 0x8C, 0x9A, 0x4C, 0x25, 0x06, 0xA2, 0xC4, 0xA0,
+    0xBA, 0xD7, 0x99, 0xA7, 0x8F, 0x59, 0x69, 0x99, 0x01, 0x70, 0xF4, 0x80, 0x77, 0x03, 0x20, 0x0B,
+    0x5D, 0x4C, 0xBC, 0x1D, 0x0F, 0xA1, 0x93, 0xF1, 0xCE, 0xB0, 0x3A, 0xC5, 0xE9, 0x05, 0xAE, 0xF1,
+    0x30, 0x75, 0x54, 0x13, 0xA9, 0x8F, 0xE2, 0x84, 0x81, 0xD9, 0x59, 0x8B, 0x6D, 0x95, 0x80, 0xEB,
+    0xB6, 0x29, 0xA3, 0x9A, 0xC5, 0x77, 0x8C, 0xD7, 0x2F, 0xF5, 0x5C, 0xF5, 0x4D, 0xA2, 0xED, 0xFA,
+    0x6A, 0x04, 0xAE, 0xB0, 0x16, 0x7B, 0x06, 0x97, 0xBB, 0x67, 0xEB, 0x5D, 0x83, 0x88, 0xFB, 0xFC,
+    0x2C, 0x99, 0x47, 0xF5, 0x6D, 0x8F, 0x7C, 0x69, 0x45, 0x36, 0xD1, 0x34, 0xCA, 0xF7, 0xDB, 0xDA,
+    0x5C, 0x52, 0x21, 0x4B, 0x12, 0xBB, 0x26, 0xE7, 0x59, 0x34, 0x69, 0x96, 0x20, 0xA7, 0x74, 0x82,
+    0x84, 0x0D, 0xCB, 0xD0, 0x93, 0x41, 0x13, 0xB5, 0x92, 0x1B, 0xDA, 0xBA, 0xD5, 0x84, 0x5C, 0xDA,
+    0xE6, 0xC8, 0x45, 0x07, 0x8E, 0x72, 0x99, 0xC5, 0x58, 0xEC, 0xB5, 0x95, 0x73, 0x95, 0x79, 0xF2,
+    0x52, 0xFF, 0x1A, 0xE5, 0x44, 0x31, 0xB6, 0xE6, 0xE4, 0x86, 0xCB, 0x71, 0x49, 0xAE, 0xE0, 0x3C,
+    0x9F, 0x7C, 0x3E, 0x1B, 0x98, 0xE3, 0x20, 0x1B, 0x8C, 0x9B, 0x76, 0x23, 0x5B, 0x39, 0x31, 0x5F,
+    0x11, 0xCA, 0x61, 0xD8, 0x64, 0x60, 0x25, 0x9C, 0xBC, 0x94, 0x89, 0xD9, 0x2A, 0x13, 0x75, 0xF9,
+    0xEB, 0x0D, 0x57, 0xAB, 0xC7, 0x19, 0x54, 0x5A, 0x7B, 0x52, 0x3D, 0xF5, 0x14, 0x6E, 0x61, 0xE0,
+    0x9E, 0x37, 0xD7, 0x48, 0xE4, 0xFC, 0x0B, 0xEE, 0xE4, 0x7F, 0xE1, 0x7E, 0xE6, 0xF9, 0x1B, 0xA5,
+    0x55, 0xBF, 0x8F, 0x1B, 0x45, 0x14, 0x7E, 0xBB, 0x9B, 0x63, 0x94, 0xAC, 0xB8, 0x75, 0xE1, 0x43,
+    0x01, 0xC4, 0x6D, 0x73, 0x45, 0x04, 0xB1, 0xB7, 0x49, 0xE1, 0x48, 0x76, 0xBC, 0x24, 0xFF, 0x80,
+    0x51, 0x6E, 0xA1, 0x84, 0x1A, 0x24, 0xAE, 0xA1, 0xB0, 0xC4, 0xFD, 0x58, 0x44, 0x91, 0x36, 0xFF,
+    0x01, 0x57, 0xA4, 0x08, 0x7B, 0x85, 0x29, 0x52, 0x04, 0xC9, 0x77, 0xDE, 0xE8, 0x8A, 0x14, 0x48,
+    0x64, 0x0F, 0x09, 0x51, 0x50, 0x30, 0x22, 0xBA, 0x02, 0x57, 0x13, 0x69, 0x42, 0x56, 0x39, 0x7B,
+    0x87, 0xEF, 0xED, 0xAE, 0x05, 0x89, 0xD0, 0xA1, 0x0B, 0xB3, 0x1E, 0xDB, 0x33, 0xF3, 0xDE, 0x9B,
+    0xEF, 0xBD, 0xF7, 0xBD, 0xB7, 0x44, 0x2B, 0x11, 0x09, 0x63, 0x32, 0xFF, 0x79, 0xB2, 0xEB, 0xA7,
+    0x44, 0x5E, 0x4C, 0xE4, 0xE2, 0xD7, 0x91, 0x44, 0xA4, 0x30, 0xAF, 0x25, 0x49, 0xE2, 0x1B, 0x63,
+    0x0E, 0xB3, 0x28, 0x1A, 0x68, 0xDE, 0xC0, 0x14, 0x90, 0xA0, 0x19, 0xA6, 0xC7, 0x62, 0x13, 0x63,
+    0x42, 0x1B, 0x36, 0x2A, 0x8D, 0xA5, 0xAD, 0xD0, 0x32, 0x46, 0x8B, 0x62, 0x74, 0x57, 0x28, 0x27,
+    0x75, 0xA4, 0x25, 0x6D, 0x45, 0x9A, 0x72, 0xEA, 0xE2, 0x59, 0x25, 0x2F, 0x19, 0x4D, 0x6F, 0xC1,
+    0xA0, 0xD2, 0x6F, 0x1C, 0xAF, 0xF7, 0xE8, 0x1E, 0xAE, 0xEC, 0x92, 0xA5, 0x56, 0x89, 0xFA, 0x6E,
+    0x48, 0xCE, 0x09, 0x4C, 0x07, 0x6C, 0x0C, 0x36, 0x20, 0x4F, 0xD0, 0xA8, 0xC7, 0x52, 0x14, 0x95,
+    0x27, 0x3B, 0xD3, 0x64, 0x77, 0x1B, 0xEB, 0x3E, 0xDF, 0x1F, 0x02, 0xEA, 0x34, 0x19, 0x1D, 0xC1,
+    0x60, 0xDE, 0xA3, 0x0A, 0xBF, 0xCD, 0x30, 0xFB, 0xB7, 0xF1, 0x07, 0xBB, 0xA1, 0x0B, 0x15, 0x38,
+    0x49, 0x3E, 0xA3, 0x4C, 0xF6, 0xE6, 0x2C, 0xC4, 0x50, 0xC7, 0x0B, 0x69, 0xF6, 0xB2, 0xFB, 0x6E,
+    0x92, 0x8C, 0x3C, 0x88, 0x1F, 0x45, 0xD1, 0xFB, 0xBC, 0xB1, 0x89, 0x19, 0xD4, 0x17, 0x78, 0x0C,
+    0x29, 0xDD, 0x31, 0x26, 0xF6, 0x4D, 0x81, 0xFB, 0xB0, 0x5C, 0x7A, 0x1A, 0x96, 0x61, 0xA3, 0xBD,
+    0xA9, 0x09, 0x49, 0x39, 0x9A, 0x5A, 0x10, 0x17, 0xF0, 0x16, 0x21, 0x18, 0x63, 0xE1, 0x5D, 0x18,
+    0x4D, 0xF7, 0x0E, 0x61, 0x50, 0x47, 0x9F, 0x0F, 0x36, 0x49, 0xC4, 0x3E, 0x82, 0x83, 0xC0, 0xB6,
+    0x9C, 0x8C, 0xC4, 0xD7, 0xB8, 0xE1, 0x44, 0x01, 0x90, 0x84, 0x8D, 0xB4, 0x0E, 0x74, 0xAB, 0xF2,
+    0x72, 0x25, 0x5A, 0x67, 0xA8, 0xD2, 0x4E, 0x12, 0x58, 0xAE, 0xD0, 0xB1, 0xA7, 0xE2, 0x41, 0x91,
+    0x24, 0x0A, 0xA1, 0x66, 0x07, 0x60, 0xAC, 0xCC, 0x92, 0x40, 0xF8, 0xDF, 0x56, 0x40, 0x26, 0xA1,
+    0x12, 0x53, 0x84, 0x71, 0x13, 0x77, 0x1A, 0xC8, 0xEE, 0x69, 0xA8, 0xBA, 0x29, 0xA4, 0x02, 0x76,
+    0x64, 0x8C, 0xC7, 0x56, 0xFF, 0x6F, 0x6B, 0x23, 0xB7, 0x26, 0x8F, 0x8D, 0xF2, 0x4C, 0x8A, 0x54,
+    0x0C, 0x00, 0xE5, 0xA7, 0x22, 0x19, 0xDD, 0xD0, 0xD4, 0x16, 0x8A, 0x3A, 0xAE, 0xA4, 0xD8, 0xCD,
+    0xAA, 0x60, 0x31, 0x91, 0x82, 0xB8, 0xC2, 0x9D, 0x57, 0x48, 0x11, 0x4F, 0x78, 0xCE, 0xE4, 0x81,
+    0xA9, 0x26, 0x07, 0x43, 0x93, 0x78, 0xF4, 0x73, 0x74, 0x00, 0xF0, 0xDA, 0x54, 0x51, 0x80, 0xEF,
+    0x91, 0x31, 0x4F, 0xA2, 0x08, 0x7E, 0x23, 0xF3, 0x43, 0x02, 0x6B, 0x2C, 0x45, 0x76, 0xC6, 0x21,
+    0x77, 0x63, 0xF2, 0x4A, 0x32, 0x74, 0x4B, 0x63, 0x9A, 0x83, 0xF6, 0xD2, 0x49, 0xAF, 0x0C, 0x20,
+    0xCE, 0xDB, 0xC4, 0x3B, 0xCC, 0xA6, 0x94, 0x6F, 0x85, 0x0D, 0x8E, 0xF0, 0xF0, 0xC5, 0x33, 0x70,
+    0x18, 0xC7, 0x96, 0x2C, 0xCF, 0xEE, 0x97, 0x67, 0xE5, 0xE8, 0xF0, 0x67, 0xAD, 0xB3, 0xB6, 0x7D,
+    0x75, 0xE6, 0x22, 0xC1, 0x05, 0xF2, 0x9C, 0xF5, 0xAF, 0xE6, 0x57, 0x3A, 0x97, 0xAA, 0x23, 0x1E,
+    0xA0, 0xFB, 0xF5, 0x63, 0xAD, 0x56, 0x87, 0xCE, 0x8F, 0xF4, 0x38, 0xBB, 0xB7, 0x93, 0x5B, 0xBB,
+    0xD4, 0x9C, 0xCF, 0x87, 0xB5, 0x89, 0x6E, 0x4D, 0x20, 0x58, 0x65, 0xA0, 0x7C, 0xBF, 0x2D, 0xAB,
+    0x00, 0x30, 0x79, 0x44, 0x9C, 0xC4, 0x6E, 0x68, 0x52, 0x8F, 0x3E, 0xCA, 0x7C, 0x54, 0x5A, 0x0B,
+    0x12, 0x50, 0xD1, 0x98, 0x39, 0x54, 0xC6, 0x10, 0xEF, 0x62, 0xF6, 0xA1, 0x12, 0x64, 0x55, 0x34,
+    0xCB, 0xB2, 0x0C, 0xD9, 0xB6, 0x35, 0xB7, 0x8F, 0xCC, 0xEF, 0x52, 0xB5, 0xB3, 0x8E, 0x23, 0x97,
+    0xE9, 0xBE, 0x93, 0x7E, 0x19, 0x1E, 0xE4, 0xB9, 0xAB, 0xCB, 0x63, 0x57, 0xBA, 0x32, 0x98, 0xF5,
+    0xF3, 0x8E, 0xA7, 0xBA, 0x5F, 0x88, 0xF4, 0x32, 0xCF, 0xE1, 0xB2, 0xEA, 0x5E, 0x1B, 0x6F, 0x6B,
+    0x4F, 0xFA, 0x5C, 0xAD, 0xD4, 0xAC, 0x11, 0xBE, 0xCA, 0xEC, 0x45, 0xD1, 0x7A, 0x1F, 0xE9, 0xE2,
+    0x59, 0x3B, 0xEB, 0xC4, 0x75, 0x31, 0xF9, 0x61, 0x45, 0xC8, 0xB2, 0x31, 0x70, 0xEA, 0x99, 0x0E,
+    0x56, 0xBE, 0xA8, 0xD4, 0xB4, 0x26, 0xF3, 0x56, 0x5D, 0x77, 0x0E, 0x2F, 0xF6, 0x61, 0x0F, 0x35,
+    0x6D, 0x1E, 0x62, 0xCE, 0x6E, 0xFE, 0xB6, 0xF5, 0xEC, 0xC5, 0xCF, 0x9F, 0x71, 0xF3, 0x5C, 0xB7,
+    0x7D, 0xB6, 0xE7, 0xD2, 0x9B, 0x44, 0x83, 0x05, 0x0A, 0x40, 0x0A, 0x70, 0x8F, 0x07, 0xEC, 0xE2,
+    0x87, 0x98, 0xEC, 0x23, 0xA6, 0x02, 0x78, 0x32, 0x04, 0x69, 0x7A, 0x48, 0xBC, 0x87, 0x6F, 0x37,
+    0x46, 0xDD, 0xA6, 0xA4, 0x90, 0xA6, 0x36, 0xE8, 0x2A, 0x52, 0xCE, 0x05, 0x98, 0x1F, 0x78, 0x4C,
+    0x20, 0x44, 0x6B, 0x09, 0x70, 0xC5, 0x03, 0xD0, 0x4D, 0x42, 0x53, 0x43, 0x73, 0x13, 0xA2, 0x3D,
+    0x3C, 0x1E, 0x52, 0x89, 0xA5, 0x42, 0x62, 0x5B, 0xD8, 0x12, 0x29, 0xB2, 0xC7, 0x99, 0x6C, 0x83,
+    0xDF, 0xCE, 0x23, 0xDC, 0xFD, 0x8C, 0x8B, 0x81, 0x33, 0xAF, 0xEB, 0x18, 0x7D, 0x7A, 0x87, 0x3C,
+    0x33, 0xA3, 0xE2, 0xC3, 0x19, 0x8A, 0x02, 0x0D, 0xCB, 0x7A, 0xA2, 0xC8, 0xF9, 0x25, 0x25, 0xEF,
+    0x63, 0xC4, 0x16, 0x94, 0x79, 0xFA, 0x9F, 0xCB, 0x0C, 0x80, 0x3E, 0x38, 0x8B, 0x92, 0xC6, 0xF2,
+    0x50, 0x52, 0xE0, 0x66, 0x56, 0xEE, 0x3E, 0x9F, 0xC4, 0x02, 0x7D, 0x95, 0xD6, 0x6B, 0x22, 0x04,
+    0xF0, 0xF7, 0xD7, 0x94, 0xF4, 0x1A, 0xB7, 0x14, 0xE6, 0xE9, 0xAB, 0xFC, 0x20, 0xAD, 0x8D, 0x36,
+    0x89, 0x87, 0x29, 0xED, 0xA0, 0x60, 0xBF, 0xAD, 0x79, 0xC1, 0x09, 0xF7, 0xEA, 0x86, 0x70, 0xCA,
+    0x00, 0xC2, 0xBC, 0x20, 0x6B, 0x36, 0xC7, 0x6C, 0x10, 0x35, 0x78, 0x6F, 0x1F, 0xD9, 0xE3, 0xBD,
+    0x71, 0xD9, 0x3E, 0x4E, 0x19, 0xEE, 0x3F, 0xEE, 0xB0, 0x60, 0xAB, 0x98, 0x37, 0xCB, 0xFD, 0xE6,
+    0x41, 0xB1, 0x79, 0x16, 0x43, 0xFF, 0x06, 0xC2, 0x97, 0xD6, 0x57, 0x27, 0xF3, 0x8D, 0x65, 0x6B,
+    0xA2, 0x1A, 0xB4, 0x52, 0x72, 0xAA, 0x9F, 0xDB, 0x87, 0xC7, 0x66, 0xFF, 0x75, 0xDA, 0xC8, 0x6A,
+    0x45, 0x0B, 0x1D, 0x17, 0xAF, 0x8D, 0x19, 0x3A, 0xD7, 0x60, 0xE1, 0x37, 0x96, 0x28, 0x0F, 0xF5,
+    0x5A, 0x78, 0xAE, 0xAF, 0x5B, 0xDF, 0x4F, 0x66, 0xDF, 0xF9, 0x9C, 0xFD, 0x40, 0xBE, 0x33, 0x29,
+    0xB6, 0x54, 0x90, 0x37, 0xEC, 0xDB, 0x6B, 0x44, 0x9F, 0x70, 0xCF, 0xFB, 0xCC, 0xDC, 0x59, 0x20,
+    0x78, 0xCB, 0xFC, 0xE1, 0x60, 0xEB, 0x3C, 0xD1, 0x45, 0xB4, 0x17, 0x12, 0xD7, 0x93, 0x83, 0x6F,
+    0x50, 0x62, 0x78, 0x29, 0x48, 0x72, 0xF9, 0x85, 0xF0, 0xDE, 0xF4, 0xEE, 0xE5, 0x12, 0x04, 0xDE,
+    0x54, 0xBB, 0x8B, 0x86, 0x59, 0xF5, 0xCC, 0x01, 0x77, 0x7C, 0x00, 0x59, 0xD8, 0xE2, 0xB7, 0xF5,
+    0xDF, 0xF5, 0x79, 0xEA, 0xF8, 0x0B, 0xAD, 0x54, 0xBF, 0x6F, 0xD3, 0x40, 0x14, 0xFE, 0x7C, 0x6E,
+    0xB1, 0xC0, 0x52, 0xCD, 0xD2, 0x89, 0xBA, 0xE9, 0xC8, 0x92, 0x7A, 0xAB, 0x3A, 0xA4, 0xC4, 0x62,
+    0xE9, 0xC0, 0x00, 0x03, 0x86, 0xA9, 0xFF, 0x43, 0x87, 0x80, 0x3A, 0x00, 0x39, 0x91, 0x81, 0x95,
+    0x3F, 0xA1, 0x2B, 0x9D, 0xA2, 0x8A, 0xA1, 0x48, 0x54, 0xF6, 0x9F, 0x70, 0x2A, 0x62, 0x62, 0x39,
+    0x8A, 0x50, 0x25, 0x26, 0x0F, 0x19, 0xAC, 0x2A, 0xF1, 0xF1, 0x3D, 0xC7, 0xD0, 0x20, 0xA1, 0x8A,
+    0x81, 0x73, 0xEE, 0x39, 0xEF, 0xD7, 0x77, 0xDF, 0x3B, 0xBF, 0x3B, 0x60, 0x03, 0xAA, 0x42, 0x62,
+    0x55, 0x8D, 0xC4, 0xE0, 0x15, 0x44, 0xAA, 0x19, 0x30, 0x34, 0x08, 0x2A, 0xE0, 0x00, 0xCD, 0x18,
+    0xBA, 0x6A, 0xE8, 0xA6, 0x1B, 0xC0, 0x3D, 0x06, 0x58, 0x30, 0xB8, 0x89, 0x9B, 0xCA, 0x2F, 0x31,
+    0x37, 0x66, 0xE8, 0x1B, 0xEC, 0x00, 0x8B, 0xC1, 0xAD, 0x72, 0x13, 0x4A, 0x23, 0x29, 0xC2, 0x12,
+    0x79, 0x9A, 0x18, 0x22, 0xE7, 0x69, 0x38, 0xE1, 0x2B, 0x28, 0xC1, 0x90, 0xA1, 0xEE, 0x58, 0x78,
+    0x35, 0xDF, 0x5C, 0xCD, 0x13, 0xD4, 0x82, 0x0E, 0x1C, 0xE2, 0x2E, 0xAE, 0xC6, 0x2D, 0x78, 0x1A,
+    0x7E, 0x05, 0xBA, 0x3B, 0x56, 0x48, 0x2D, 0x64, 0x45, 0x85, 0x3F, 0x21, 0x83, 0x70, 0x72, 0x05,
+    0x4F, 0x43, 0xFD, 0x07, 0xC4, 0x6A, 0xF6, 0x08, 0x1D, 0xE7, 0xAC, 0x3A, 0x3A, 0x72, 0x29, 0xE0,
+    0x73, 0x01, 0xA9, 0x03, 0x41, 0x41, 0x21, 0x8A, 0x30, 0x8F, 0x38, 0x43, 0x1A, 0x7C, 0x4B, 0x47,
+    0x39, 0x74, 0xAE, 0x64, 0xCA, 0xDB, 0x05, 0x16, 0x78, 0xC1, 0xD9, 0x9D, 0x47, 0x7A, 0x4F, 0x3F,
+    0x23, 0x71, 0xCE, 0x0C, 0x7F, 0x5C, 0x1E, 0xF6, 0xD1, 0x43, 0x82, 0x4D, 0x44, 0x69, 0x04, 0xBF,
+    0xF0, 0x0B, 0xAF, 0xF4, 0x2C, 0x4D, 0x13, 0x44, 0xBA, 0x07, 0x55, 0xAE, 0x03, 0xFD, 0x87, 0x29,
+    0x7C, 0xE7, 0x5C, 0x7A, 0x87, 0x29, 0x78, 0x4F, 0x88, 0x1E, 0xE7, 0xBA, 0x2C, 0x98, 0x2E, 0x2E,
+    0x20, 0x9A, 0x3F, 0xE7, 0xB4, 0x9A, 0x9D, 0xB4, 0x94, 0x73, 0x52, 0x0E, 0x46, 0x25, 0x1D, 0xA4,
+    0x5C, 0x92, 0xF2, 0x01, 0xDD, 0x3B, 0x7C, 0x22, 0x3E, 0x81, 0x0E, 0x0B, 0x65, 0x48, 0xB9, 0x5C,
+    0xA0, 0x2C, 0x95, 0x04, 0x1A, 0x50, 0xA6, 0x2D, 0xAF, 0x19, 0x5E, 0x96, 0xB5, 0x94, 0x8F, 0x48,
+    0x99, 0x1B, 0x2D, 0x95, 0xB4, 0x0B, 0x7A, 0x65, 0xCB, 0x29, 0x92, 0x34, 0x51, 0xFA, 0xE2, 0xF9,
+    0x4D, 0xB9, 0x1D, 0x4C, 0x77, 0x0F, 0x38, 0xCD, 0xFF, 0xD8, 0x50, 0x1A, 0x6A, 0x1A, 0x9C, 0x86,
+    0xF7, 0x8E, 0xAA, 0x73, 0x05, 0x3A, 0xBB, 0xBB, 0xC6, 0xB3, 0xB1, 0x32, 0x2B, 0x18, 0xA8, 0x62,
+    0xEC, 0x19, 0x7F, 0xA4, 0x83, 0x34, 0x5C, 0x43, 0x8C, 0xF8, 0x59, 0xF6, 0x21, 0x7B, 0xCE, 0x70,
+    0x77, 0x91, 0x06, 0x69, 0xB0, 0x27, 0xA6, 0x6D, 0x0C, 0x30, 0x96, 0x28, 0x6D, 0x83, 0xB4, 0xC7,
+    0x44, 0xDF, 0x78, 0xD5, 0xE0, 0x14, 0xC8, 0x09, 0x8A, 0x65, 0xD9, 0xDA, 0x2B, 0xE8, 0x34, 0x20,
+    0x34, 0x04, 0x1A, 0x84, 0x26, 0xAB, 0x11, 0x63, 0x08, 0x0D, 0x81, 0xCE, 0x7E, 0x41, 0x93, 0xE9,
+    0x9E, 0x98, 0xB6, 0x29, 0xC6, 0x12, 0xA5, 0x59, 0x0D, 0xA1, 0x21, 0xD0, 0xB8, 0x06, 0x9A, 0xDF,
+    0xC7, 0x44, 0x96, 0xDD, 0x7B, 0x6C, 0xD5, 0xA7, 0xD1, 0x6B, 0xDB, 0x0D, 0xD7, 0xD4, 0xB9, 0x89,
+    0xF7, 0xD9, 0x90, 0x5B, 0x05, 0xF7, 0xE7, 0x02, 0x9B, 0xD6, 0xDF, 0x53, 0x67, 0x36, 0xDE, 0xEE,
+    0x2A, 0x3B, 0x3E, 0x36, 0xEA, 0x9B, 0x9E, 0xF1, 0xF0, 0x34, 0x89, 0xD7, 0x43, 0xCB, 0xE2, 0x2B,
+    0x72, 0x30, 0xC6, 0x20, 0xB4, 0x46, 0x37, 0x8C, 0x59, 0x47, 0xBC, 0xCF, 0x5E, 0xDC, 0xE2, 0xC7,
+    0x27, 0x74, 0x17, 0x84, 0x36, 0x64, 0xCD, 0xEE, 0x24, 0x34, 0x59, 0xCF, 0x84, 0xF5, 0x5F, 0xA1,
+    0x39, 0x37, 0x39, 0x4F, 0xB8, 0x0D, 0xFC, 0x2E, 0xA1, 0xFE, 0x37, 0x75, 0xF9, 0xC9, 0xF7, 0xC7,
+    0xB9, 0x73, 0x97, 0xDC, 0x24, 0x7B, 0xFB, 0xB4, 0xFE, 0xB8, 0x84, 0x25, 0x2C, 0x77, 0x8A, 0xA8,
+    0x08, 0xBF, 0x94, 0x7E, 0xE9, 0x57, 0x13, 0x54, 0xCD, 0xF1, 0x98, 0xB7, 0xF3, 0xFC, 0xCE, 0xE0,
+    0xE1, 0x14, 0x59, 0x89, 0x1C, 0x74, 0x44, 0x19, 0x34, 0x9E, 0x97, 0x4B, 0x82, 0x3B, 0x74, 0x56,
+    0x0E, 0xB2, 0x9B, 0x25, 0x5A, 0x5A, 0xE1, 0x4D, 0x25, 0xF2, 0xAB, 0xD3, 0x94, 0x3A, 0xAF, 0x12,
+    0x57, 0xA1, 0x5F, 0x2B, 0x5E, 0x22, 0x39, 0xAF, 0x25, 0x77, 0xDF, 0xD5, 0x50, 0xEE, 0xDC, 0xC9,
+    0xFD, 0x30, 0xA5, 0x85, 0x8A, 0xFC, 0x47, 0x72, 0x26, 0x52, 0x95, 0xD2, 0x7B, 0xE8, 0x0A, 0xD5,
+    0xE6, 0x66, 0x6A, 0x6B, 0x9C, 0x57, 0xFB, 0x13,
+};
+
+static const uint32_t bookerly_12_regularBlockOffsets[25] = {
+    0, 1339, 2546, 3812, 4837, 5747, 6835, 7786,
+    8649, 9577, 10575, 11488, 12642, 13841, 15030, 16200,
+    17507, 18608, 19612, 20839, 21918, 23068, 24399, 25446,
+    26104,
+};
+
+static const uint16_t bookerly_12_regularDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_regularGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_12_regularPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_12_regularGlyphs[] = {
@@ -3041,708 +1854,708 @@ static const EpdGlyph bookerly_12_regularGlyphs[] = {
     { 14, 18, 16, 1, 18, 63, 1845 }, // E
     { 13, 18, 14, 1, 18, 59, 1908 }, // F
     { 16, 19, 18, 1, 18, 76, 1967 }, // G
-    { 19, 18, 21, 1, 18, 86, 2043 }, // H
-    { 8, 18, 9, 1, 18, 36, 2129 }, // I
-    { 10, 24, 9, -1, 18, 60, 2165 }, // J
-    { 18, 19, 18, 1, 18, 86, 2225 }, // K
-    { 14, 18, 15, 1, 18, 63, 2311 }, // L
-    { 23, 18, 22, 0, 18, 104, 2374 }, // M
-    { 19, 19, 20, 1, 18, 91, 2478 }, // N
-    { 18, 19, 19, 1, 18, 86, 2569 }, // O
-    { 14, 18, 15, 1, 18, 63, 2655 }, // P
-    { 19, 23, 19, 1, 18, 110, 2718 }, // Q
-    { 17, 19, 17, 1, 18, 81, 2828 }, // R
-    { 12, 19, 14, 1, 18, 57, 2909 }, // S
-    { 17, 18, 17, 0, 18, 77, 2966 }, // T
-    { 19, 19, 19, 0, 18, 91, 3043 }, // U
-    { 19, 19, 18, 0, 18, 91, 3134 }, // V
-    { 28, 19, 28, 0, 18, 133, 3225 }, // W
-    { 18, 18, 18, 0, 18, 81, 3358 }, // X
-    { 17, 18, 17, 0, 18, 77, 3439 }, // Y
-    { 15, 19, 15, 0, 18, 72, 3516 }, // Z
-    { 6, 24, 8, 1, 20, 36, 3588 }, // [
-    { 12, 20, 12, 0, 18, 60, 3624 }, // <backslash>
-    { 5, 24, 8, 1, 20, 30, 3684 }, // ]
-    { 12, 12, 16, 2, 16, 36, 3714 }, // ^
-    { 13, 2, 13, 0, -1, 7, 3750 }, // _
-    { 6, 7, 17, 5, 21, 11, 3757 }, // `
-    { 13, 15, 14, 1, 14, 49, 3768 }, // a
-    { 15, 21, 15, -1, 20, 79, 3817 }, // b
-    { 11, 15, 13, 1, 14, 42, 3896 }, // c
-    { 15, 21, 16, 1, 20, 79, 3938 }, // d
-    { 11, 15, 13, 1, 14, 42, 4017 }, // e
-    { 12, 20, 10, 0, 20, 60, 4059 }, // f
-    { 15, 20, 15, 0, 14, 75, 4119 }, // g
-    { 17, 20, 17, 0, 20, 85, 4194 }, // h
-    { 8, 20, 8, 0, 20, 40, 4279 }, // i
-    { 8, 26, 7, -2, 20, 52, 4319 }, // j
-    { 15, 21, 15, 0, 20, 79, 4371 }, // k
-    { 8, 20, 8, 0, 20, 40, 4450 }, // l
-    { 25, 14, 25, 0, 14, 88, 4490 }, // m
-    { 17, 14, 17, 0, 14, 60, 4578 }, // n
-    { 13, 15, 15, 1, 14, 49, 4638 }, // o
-    { 15, 20, 15, 0, 14, 75, 4687 }, // p
-    { 14, 20, 15, 1, 14, 70, 4762 }, // q
-    { 12, 14, 12, 0, 14, 42, 4832 }, // r
-    { 10, 15, 12, 1, 14, 38, 4874 }, // s
-    { 10, 18, 10, 0, 17, 45, 4912 }, // t
-    { 17, 15, 16, 0, 14, 64, 4957 }, // u
-    { 15, 14, 15, 0, 13, 53, 5021 }, // v
-    { 22, 14, 22, 0, 13, 77, 5074 }, // w
-    { 15, 13, 15, 0, 13, 49, 5151 }, // x
-    { 15, 19, 15, 0, 13, 72, 5200 }, // y
-    { 12, 14, 13, 0, 13, 42, 5272 }, // z
-    { 8, 25, 10, 1, 20, 50, 5314 }, // {
-    { 3, 23, 7, 2, 20, 18, 5364 }, // |
-    { 8, 25, 10, 0, 20, 50, 5382 }, // }
-    { 12, 5, 16, 2, 11, 15, 5432 }, // ~
-    { 0, 0, 5, 0, 0, 0, 5447 }, //  
-    { 4, 20, 7, 1, 14, 20, 5447 }, // ¡
-    { 13, 25, 16, 1, 20, 82, 5467 }, // ¢
-    { 14, 19, 16, 1, 18, 67, 5549 }, // £
-    { 14, 13, 16, 1, 15, 46, 5616 }, // ¤
-    { 17, 18, 16, -1, 18, 77, 5662 }, // ¥
-    { 3, 23, 7, 2, 20, 18, 5739 }, // ¦
-    { 11, 21, 13, 1, 18, 58, 5757 }, // §
-    { 9, 4, 17, 4, 19, 9, 5815 }, // ¨
-    { 19, 19, 20, 0, 18, 91, 5824 }, // ©
-    { 9, 12, 11, 1, 18, 27, 5915 }, // ª
-    { 14, 10, 13, 0, 11, 35, 5942 }, // «
-    { 11, 7, 16, 2, 12, 20, 5977 }, // ¬
-    { 8, 3, 9, 1, 8, 6, 5997 }, // ­
-    { 14, 14, 15, 0, 20, 49, 6003 }, // ®
-    { 9, 3, 17, 4, 18, 7, 6052 }, // ¯
-    { 9, 9, 13, 2, 18, 21, 6059 }, // °
-    { 11, 15, 16, 2, 15, 42, 6080 }, // ±
-    { 9, 12, 11, 1, 21, 27, 6122 }, // ²
-    { 9, 13, 11, 1, 21, 30, 6149 }, // ³
-    { 5, 7, 17, 6, 21, 9, 6179 }, // ´
-    { 16, 20, 17, 1, 14, 80, 6188 }, // µ
-    { 13, 22, 14, 0, 18, 72, 6268 }, // ¶
-    { 5, 4, 7, 1, 9, 5, 6340 }, // ·
-    { 5, 6, 17, 6, -1, 8, 6345 }, // ¸
-    { 8, 12, 11, 2, 21, 24, 6353 }, // ¹
-    { 9, 12, 11, 1, 18, 27, 6377 }, // º
-    { 13, 10, 13, 1, 11, 33, 6404 }, // »
-    { 24, 21, 27, 2, 19, 126, 6437 }, // ¼
-    { 24, 21, 27, 2, 19, 126, 6563 }, // ½
-    { 25, 21, 27, 1, 19, 132, 6689 }, // ¾
-    { 9, 20, 12, 1, 14, 45, 6821 }, // ¿
-    { 19, 24, 19, 0, 24, 114, 6866 }, // À
-    { 19, 24, 19, 0, 24, 114, 6980 }, // Á
-    { 19, 24, 19, 0, 24, 114, 7094 }, // Â
-    { 19, 24, 19, 0, 24, 114, 7208 }, // Ã
-    { 19, 23, 19, 0, 23, 110, 7322 }, // Ä
-    { 19, 25, 19, 0, 25, 119, 7432 }, // Å
-    { 24, 18, 23, -1, 18, 108, 7551 }, // Æ
-    { 14, 25, 16, 1, 18, 88, 7659 }, // Ç
-    { 14, 24, 16, 1, 24, 84, 7747 }, // È
-    { 14, 24, 16, 1, 24, 84, 7831 }, // É
-    { 14, 24, 16, 1, 24, 84, 7915 }, // Ê
-    { 14, 23, 16, 1, 23, 81, 7999 }, // Ë
-    { 8, 24, 9, 1, 24, 48, 8080 }, // Ì
-    { 8, 24, 9, 1, 24, 48, 8128 }, // Í
-    { 9, 24, 9, 0, 24, 54, 8176 }, // Î
-    { 10, 23, 9, 0, 23, 58, 8230 }, // Ï
-    { 18, 19, 19, 0, 18, 86, 8288 }, // Ð
-    { 19, 25, 20, 1, 24, 119, 8374 }, // Ñ
-    { 18, 25, 19, 1, 24, 113, 8493 }, // Ò
-    { 18, 25, 19, 1, 24, 113, 8606 }, // Ó
-    { 18, 25, 19, 1, 24, 113, 8719 }, // Ô
-    { 18, 25, 19, 1, 24, 113, 8832 }, // Õ
-    { 18, 24, 19, 1, 23, 108, 8945 }, // Ö
-    { 10, 11, 16, 3, 14, 28, 9053 }, // ×
-    { 19, 19, 19, 0, 18, 91, 9081 }, // Ø
-    { 19, 25, 19, 0, 24, 119, 9172 }, // Ù
-    { 19, 25, 19, 0, 24, 119, 9291 }, // Ú
-    { 19, 25, 19, 0, 24, 119, 9410 }, // Û
-    { 19, 24, 19, 0, 23, 114, 9529 }, // Ü
-    { 17, 24, 17, 0, 24, 102, 9643 }, // Ý
-    { 14, 18, 16, 1, 18, 63, 9745 }, // Þ
-    { 16, 21, 16, 0, 20, 84, 9808 }, // ß
-    { 13, 22, 14, 1, 21, 72, 9892 }, // à
-    { 13, 22, 14, 1, 21, 72, 9964 }, // á
-    { 13, 21, 14, 1, 20, 69, 10036 }, // â
-    { 13, 21, 14, 1, 20, 69, 10105 }, // ã
-    { 13, 20, 14, 1, 19, 65, 10174 }, // ä
-    { 13, 22, 14, 1, 21, 72, 10239 }, // å
-    { 19, 15, 20, 1, 14, 72, 10311 }, // æ
-    { 11, 21, 13, 1, 14, 58, 10383 }, // ç
-    { 11, 22, 13, 1, 21, 61, 10441 }, // è
-    { 11, 22, 13, 1, 21, 61, 10502 }, // é
-    { 11, 21, 13, 1, 20, 58, 10563 }, // ê
-    { 11, 20, 13, 1, 19, 55, 10621 }, // ë
-    { 8, 21, 8, 0, 21, 42, 10676 }, // ì
-    { 8, 21, 8, 0, 21, 42, 10718 }, // í
-    { 8, 20, 8, 0, 20, 40, 10760 }, // î
-    { 10, 19, 8, -1, 19, 48, 10800 }, // ï
-    { 13, 22, 15, 1, 21, 72, 10848 }, // ð
-    { 17, 20, 17, 0, 20, 85, 10920 }, // ñ
-    { 13, 22, 15, 1, 21, 72, 11005 }, // ò
-    { 13, 22, 15, 1, 21, 72, 11077 }, // ó
-    { 13, 21, 15, 1, 20, 69, 11149 }, // ô
-    { 13, 21, 15, 1, 20, 69, 11218 }, // õ
-    { 13, 20, 15, 1, 19, 65, 11287 }, // ö
-    { 11, 13, 16, 2, 15, 36, 11352 }, // ÷
-    { 15, 15, 15, 0, 14, 57, 11388 }, // ø
-    { 17, 22, 16, 0, 21, 94, 11445 }, // ù
-    { 17, 22, 16, 0, 21, 94, 11539 }, // ú
-    { 17, 21, 16, 0, 20, 90, 11633 }, // û
-    { 17, 20, 16, 0, 19, 85, 11723 }, // ü
-    { 15, 27, 15, 0, 21, 102, 11808 }, // ý
-    { 15, 26, 16, 0, 20, 98, 11910 }, // þ
-    { 15, 25, 15, 0, 19, 94, 12008 }, // ÿ
-    { 19, 23, 19, 0, 23, 110, 12102 }, // Ā
-    { 13, 19, 14, 1, 18, 62, 12212 }, // ā
-    { 19, 24, 19, 0, 24, 114, 12274 }, // Ă
-    { 13, 21, 14, 1, 20, 69, 12388 }, // ă
-    { 19, 24, 19, 0, 18, 114, 12457 }, // Ą
-    { 13, 20, 14, 1, 14, 65, 12571 }, // ą
-    { 14, 25, 16, 1, 24, 88, 12636 }, // Ć
-    { 11, 22, 13, 1, 21, 61, 12724 }, // ć
-    { 14, 25, 16, 1, 24, 88, 12785 }, // Ĉ
-    { 11, 21, 13, 1, 20, 58, 12873 }, // ĉ
-    { 14, 25, 16, 1, 24, 88, 12931 }, // Ċ
-    { 11, 20, 13, 1, 19, 55, 13019 }, // ċ
-    { 14, 25, 16, 1, 24, 88, 13074 }, // Č
-    { 11, 22, 13, 1, 21, 61, 13162 }, // č
-    { 17, 25, 19, 1, 24, 107, 13223 }, // Ď
-    { 17, 21, 16, 1, 20, 90, 13330 }, // ď
-    { 18, 19, 19, 0, 18, 86, 13420 }, // Đ
-    { 15, 21, 16, 1, 20, 79, 13506 }, // đ
-    { 14, 23, 16, 1, 23, 81, 13585 }, // Ē
-    { 11, 19, 13, 1, 18, 53, 13666 }, // ē
-    { 14, 24, 16, 1, 24, 84, 13719 }, // Ĕ
-    { 11, 21, 13, 1, 20, 58, 13803 }, // ĕ
-    { 14, 24, 16, 1, 24, 84, 13861 }, // Ė
-    { 11, 20, 13, 1, 19, 55, 13945 }, // ė
-    { 14, 24, 16, 1, 18, 84, 14000 }, // Ę
-    { 11, 20, 13, 1, 14, 55, 14084 }, // ę
-    { 14, 24, 16, 1, 24, 84, 14139 }, // Ě
-    { 11, 22, 13, 1, 21, 61, 14223 }, // ě
-    { 16, 25, 18, 1, 24, 100, 14284 }, // Ĝ
-    { 15, 26, 15, 0, 20, 98, 14384 }, // ĝ
-    { 16, 25, 18, 1, 24, 100, 14482 }, // Ğ
-    { 15, 26, 15, 0, 20, 98, 14582 }, // ğ
-    { 16, 25, 18, 1, 24, 100, 14680 }, // Ġ
-    { 15, 25, 15, 0, 19, 94, 14780 }, // ġ
-    { 16, 25, 18, 1, 18, 100, 14874 }, // Ģ
-    { 15, 28, 15, 0, 22, 105, 14974 }, // ģ
-    { 19, 24, 21, 1, 24, 114, 15079 }, // Ĥ
-    { 18, 26, 17, -1, 26, 117, 15193 }, // ĥ
-    { 21, 18, 21, 0, 18, 95, 15310 }, // Ħ
-    { 17, 20, 17, 0, 20, 85, 15405 }, // ħ
-    { 9, 24, 9, 0, 24, 54, 15490 }, // Ĩ
-    { 9, 20, 8, 0, 20, 45, 15544 }, // ĩ
-    { 9, 23, 9, 0, 23, 52, 15589 }, // Ī
-    { 9, 18, 8, 0, 18, 41, 15641 }, // ī
-    { 9, 24, 9, 0, 24, 54, 15682 }, // Ĭ
-    { 8, 20, 8, 0, 20, 40, 15736 }, // ĭ
-    { 8, 24, 9, 1, 18, 48, 15776 }, // Į
-    { 8, 26, 8, 0, 20, 52, 15824 }, // į
-    { 8, 24, 9, 1, 24, 48, 15876 }, // İ
-    { 8, 14, 8, 0, 14, 28, 15924 }, // ı
-    { 17, 24, 18, 1, 18, 102, 15952 }, // Ĳ
-    { 14, 26, 15, 0, 20, 91, 16054 }, // ĳ
-    { 10, 30, 9, -1, 24, 75, 16145 }, // Ĵ
-    { 10, 26, 7, -2, 20, 65, 16220 }, // ĵ
-    { 18, 25, 18, 1, 18, 113, 16285 }, // Ķ
-    { 15, 27, 15, 0, 20, 102, 16398 }, // ķ
-    { 16, 15, 15, 0, 14, 60, 16500 }, // ĸ
-    { 14, 24, 15, 1, 24, 84, 16560 }, // Ĺ
-    { 8, 26, 8, 0, 26, 52, 16644 }, // ĺ
-    { 14, 25, 15, 1, 18, 88, 16696 }, // Ļ
-    { 8, 27, 8, 0, 20, 54, 16784 }, // ļ
-    { 14, 20, 15, 1, 20, 70, 16838 }, // Ľ
-    { 10, 20, 9, 0, 20, 50, 16908 }, // ľ
-    { 14, 18, 15, 1, 18, 63, 16958 }, // Ŀ
-    { 12, 20, 12, 0, 20, 60, 17021 }, // ŀ
-    { 16, 18, 15, -1, 18, 72, 17081 }, // Ł
-    { 10, 20, 8, -1, 20, 50, 17153 }, // ł
-    { 19, 25, 20, 1, 24, 119, 17203 }, // Ń
-    { 17, 21, 17, 0, 21, 90, 17322 }, // ń
-    { 19, 25, 20, 1, 18, 119, 17412 }, // Ņ
-    { 17, 21, 17, 0, 14, 90, 17531 }, // ņ
-    { 19, 25, 20, 1, 24, 119, 17621 }, // Ň
-    { 17, 21, 17, 0, 21, 90, 17740 }, // ň
-    { 23, 19, 23, 0, 19, 110, 17830 }, // ŉ
-    { 19, 23, 20, 1, 18, 110, 17940 }, // Ŋ
-    { 15, 20, 16, 0, 14, 75, 18050 }, // ŋ
-    { 18, 24, 19, 1, 23, 108, 18125 }, // Ō
-    { 13, 19, 15, 1, 18, 62, 18233 }, // ō
-    { 18, 25, 19, 1, 24, 113, 18295 }, // Ŏ
-    { 13, 21, 15, 1, 20, 69, 18408 }, // ŏ
-    { 18, 26, 19, 1, 25, 117, 18477 }, // Ő
-    { 13, 22, 15, 1, 21, 72, 18594 }, // ő
-    { 23, 19, 24, 1, 18, 110, 18666 }, // Œ
-    { 21, 15, 23, 1, 14, 79, 18776 }, // œ
-    { 17, 25, 17, 1, 24, 107, 18855 }, // Ŕ
-    { 12, 21, 12, 0, 21, 63, 18962 }, // ŕ
-    { 17, 25, 17, 1, 18, 107, 19025 }, // Ŗ
-    { 12, 21, 12, 0, 14, 63, 19132 }, // ŗ
-    { 17, 25, 17, 1, 24, 107, 19195 }, // Ř
-    { 12, 21, 12, 0, 21, 63, 19302 }, // ř
-    { 12, 25, 14, 1, 24, 75, 19365 }, // Ś
-    { 10, 22, 12, 1, 21, 55, 19440 }, // ś
-    { 12, 25, 14, 1, 24, 75, 19495 }, // Ŝ
-    { 10, 21, 12, 1, 20, 53, 19570 }, // ŝ
-    { 12, 25, 14, 1, 18, 75, 19623 }, // Ş
-    { 10, 21, 12, 1, 14, 53, 19698 }, // ş
-    { 12, 25, 14, 1, 24, 75, 19751 }, // Š
-    { 10, 22, 12, 1, 21, 55, 19826 }, // š
-    { 17, 25, 17, 0, 18, 107, 19881 }, // Ţ
-    { 10, 24, 10, 0, 17, 60, 19988 }, // ţ
-    { 17, 24, 17, 0, 24, 102, 20048 }, // Ť
-    { 10, 21, 10, 0, 20, 53, 20150 }, // ť
-    { 17, 18, 17, 0, 18, 77, 20203 }, // Ŧ
-    { 10, 18, 10, 0, 17, 45, 20280 }, // ŧ
-    { 19, 25, 19, 0, 24, 119, 20325 }, // Ũ
-    { 17, 21, 16, 0, 20, 90, 20444 }, // ũ
-    { 19, 24, 19, 0, 23, 114, 20534 }, // Ū
-    { 17, 19, 16, 0, 18, 81, 20648 }, // ū
-    { 19, 25, 19, 0, 24, 119, 20729 }, // Ŭ
-    { 17, 21, 16, 0, 20, 90, 20848 }, // ŭ
-    { 19, 26, 19, 0, 25, 124, 20938 }, // Ů
-    { 17, 22, 16, 0, 21, 94, 21062 }, // ů
-    { 19, 26, 19, 0, 25, 124, 21156 }, // Ű
-    { 17, 22, 16, 0, 21, 94, 21280 }, // ű
-    { 19, 24, 19, 0, 18, 114, 21374 }, // Ų
-    { 17, 20, 16, 0, 14, 85, 21488 }, // ų
-    { 28, 25, 28, 0, 24, 175, 21573 }, // Ŵ
-    { 22, 21, 22, 0, 20, 116, 21748 }, // ŵ
-    { 17, 24, 17, 0, 24, 102, 21864 }, // Ŷ
-    { 15, 26, 15, 0, 20, 98, 21966 }, // ŷ
-    { 17, 23, 17, 0, 23, 98, 22064 }, // Ÿ
-    { 15, 25, 15, 0, 24, 94, 22162 }, // Ź
-    { 12, 22, 13, 0, 21, 66, 22256 }, // ź
-    { 15, 25, 15, 0, 24, 94, 22322 }, // Ż
-    { 12, 20, 13, 0, 19, 60, 22416 }, // ż
-    { 15, 25, 15, 0, 24, 94, 22476 }, // Ž
-    { 12, 22, 13, 0, 21, 66, 22570 }, // ž
-    { 12, 20, 10, 0, 20, 60, 22636 }, // ſ
-    { 6, 7, 0, -4, 21, 11, 22696 }, // ̀
-    { 6, 7, 0, -2, 21, 11, 22707 }, // ́
-    { 8, 6, 0, -4, 20, 12, 22718 }, // ̂
-    { 8, 5, 0, -4, 20, 10, 22730 }, // ̃
-    { 10, 3, 0, -5, 18, 8, 22740 }, // ̄
-    { 8, 5, 0, -4, 20, 10, 22748 }, // ̆
-    { 4, 4, 0, -2, 19, 4, 22758 }, // ̇
-    { 10, 4, 0, -5, 19, 10, 22762 }, // ̈
-    { 8, 8, 0, -4, 22, 16, 22772 }, // ̉
-    { 8, 7, 0, -4, 21, 14, 22788 }, // ̊
-    { 10, 7, 0, -4, 21, 18, 22802 }, // ̋
-    { 10, 6, 0, -5, 21, 15, 22820 }, // ̌
-    { 10, 7, 0, -6, 21, 18, 22835 }, // ̏
-    { 8, 5, 0, -4, 20, 10, 22853 }, // ̑
-    { 4, 8, 0, -2, 22, 8, 22863 }, // ̒
-    { 5, 7, 0, -2, 22, 9, 22871 }, // ̓
-    { 5, 7, 0, -3, 22, 9, 22880 }, // ̔
-    { 4, 7, 0, -2, 22, 7, 22889 }, // ̕
-    { 4, 6, 0, -2, 16, 6, 22896 }, // ̛
-    { 4, 4, 0, -2, -2, 4, 22902 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 22906 }, // ̤
-    { 6, 6, 0, -3, -1, 9, 22916 }, // ̥
-    { 5, 6, 0, -3, -1, 8, 22925 }, // ̦
-    { 6, 6, 0, -3, -1, 9, 22933 }, // ̧
-    { 6, 7, 0, -3, 1, 11, 22942 }, // ̨
-    { 3, 6, 7, 2, -1, 5, 22953 }, // ̩
-    { 8, 6, 0, -4, -1, 12, 22958 }, // ̭
-    { 8, 5, 0, -4, -1, 10, 22970 }, // ̮
-    { 8, 5, 0, -4, -1, 10, 22980 }, // ̰
-    { 10, 3, 0, -5, -2, 8, 22990 }, // ̱
-    { 8, 5, 0, -4, 20, 10, 22998 }, // ͂
-    { 10, 10, 0, -5, 25, 25, 23008 }, // ̈́
-    { 5, 5, 0, -2, -1, 7, 23033 }, // ͅ
-    { 14, 24, 16, 1, 24, 84, 23040 }, // Ѐ
-    { 14, 23, 16, 1, 23, 81, 23124 }, // Ё
-    { 20, 24, 20, 0, 18, 120, 23205 }, // Ђ
-    { 13, 24, 15, 1, 24, 78, 23325 }, // Ѓ
-    { 15, 19, 17, 1, 18, 72, 23403 }, // Є
-    { 12, 19, 14, 1, 18, 57, 23475 }, // Ѕ
-    { 8, 18, 9, 1, 18, 36, 23532 }, // І
-    { 10, 23, 9, 0, 23, 58, 23568 }, // Ї
-    { 10, 24, 9, -1, 18, 60, 23626 }, // Ј
-    { 24, 19, 24, 0, 18, 114, 23686 }, // Љ
-    { 24, 19, 26, 1, 18, 114, 23800 }, // Њ
-    { 21, 18, 21, 0, 18, 95, 23914 }, // Ћ
-    { 17, 25, 18, 1, 24, 107, 24009 }, // Ќ
-    { 19, 24, 21, 1, 24, 114, 24116 }, // Ѝ
-    { 18, 25, 18, 0, 24, 113, 24230 }, // Ў
-    { 18, 24, 20, 1, 18, 108, 24343 }, // Џ
-    { 19, 18, 19, 0, 18, 86, 24451 }, // А
-    { 14, 19, 16, 1, 18, 67, 24537 }, // Б
-    { 14, 19, 15, 1, 18, 67, 24604 }, // В
-    { 13, 18, 15, 1, 18, 59, 24671 }, // Г
-    { 18, 24, 19, 0, 18, 108, 24730 }, // Д
-    { 14, 18, 16, 1, 18, 63, 24838 }, // Е
-    { 25, 19, 25, 0, 18, 119, 24901 }, // Ж
-    { 14, 19, 15, 0, 18, 67, 25020 }, // З
-    { 19, 18, 21, 1, 18, 86, 25087 }, // И
-    { 19, 24, 21, 1, 24, 114, 25173 }, // Й
-    { 17, 19, 18, 1, 18, 81, 25287 }, // К
-    { 18, 19, 19, 0, 18, 86, 25368 }, // Л
-    { 23, 18, 22, 0, 18, 104, 25454 }, // М
-    { 19, 18, 21, 1, 18, 86, 25558 }, // Н
-    { 18, 19, 19, 1, 18, 86, 25644 }, // О
-    { 19, 18, 20, 1, 18, 86, 25730 }, // П
-    { 14, 18, 15, 1, 18, 63, 25816 }, // Р
-    { 14, 19, 16, 1, 18, 67, 25879 }, // С
-    { 17, 18, 17, 0, 18, 77, 25946 }, // Т
-    { 18, 19, 18, 0, 18, 86, 26023 }, // У
-    { 18, 19, 20, 1, 18, 86, 26109 }, // Ф
-    { 18, 18, 18, 0, 18, 81, 26195 }, // Х
-    { 19, 24, 20, 1, 18, 114, 26276 }, // Ц
-    { 17, 18, 18, 0, 18, 77, 26390 }, // Ч
-    { 25, 18, 27, 1, 18, 113, 26467 }, // Ш
-    { 25, 24, 27, 1, 18, 150, 26580 }, // Щ
-    { 19, 19, 19, 0, 18, 91, 26730 }, // Ъ
-    { 22, 19, 24, 1, 18, 105, 26821 }, // Ы
-    { 14, 19, 16, 1, 18, 67, 26926 }, // Ь
-    { 15, 19, 17, 1, 18, 72, 26993 }, // Э
-    { 25, 19, 26, 1, 18, 119, 27065 }, // Ю
-    { 17, 19, 17, -1, 18, 81, 27184 }, // Я
-    { 13, 15, 14, 1, 14, 49, 27265 }, // а
-    { 13, 21, 15, 1, 20, 69, 27314 }, // б
-    { 13, 14, 14, 0, 13, 46, 27383 }, // в
-    { 12, 13, 12, 0, 13, 39, 27429 }, // г
-    { 16, 18, 16, 0, 13, 72, 27468 }, // д
-    { 11, 15, 13, 1, 14, 42, 27540 }, // е
-    { 20, 15, 20, 0, 14, 75, 27582 }, // ж
-    { 11, 15, 12, 0, 14, 42, 27657 }, // з
-    { 17, 13, 17, 0, 13, 56, 27699 }, // и
-    { 17, 19, 17, 0, 19, 81, 27755 }, // й
-    { 15, 15, 15, 0, 14, 57, 27836 }, // к
-    { 15, 14, 16, 0, 13, 53, 27893 }, // л
-    { 18, 13, 19, 1, 13, 59, 27946 }, // м
-    { 17, 13, 17, 0, 13, 56, 28005 }, // н
-    { 13, 15, 15, 1, 14, 49, 28061 }, // о
-    { 17, 13, 17, 0, 13, 56, 28110 }, // п
-    { 15, 20, 15, 0, 14, 75, 28166 }, // р
-    { 11, 15, 13, 1, 14, 42, 28241 }, // с
-    { 14, 13, 14, 0, 13, 46, 28283 }, // т
-    { 15, 19, 15, 0, 13, 72, 28329 }, // у
-    { 17, 26, 18, 1, 20, 111, 28401 }, // ф
-    { 15, 13, 15, 0, 13, 49, 28512 }, // х
-    { 17, 18, 17, 0, 13, 77, 28561 }, // ц
-    { 15, 13, 15, 0, 13, 49, 28638 }, // ч
-    { 22, 13, 22, 0, 13, 72, 28687 }, // ш
-    { 22, 18, 22, 0, 13, 99, 28759 }, // щ
-    { 16, 14, 16, 0, 13, 56, 28858 }, // ъ
-    { 20, 14, 20, 0, 13, 70, 28914 }, // ы
-    { 13, 14, 13, 0, 13, 46, 28984 }, // ь
-    { 12, 15, 13, 0, 14, 45, 29030 }, // э
-    { 21, 15, 21, 0, 14, 79, 29075 }, // ю
-    { 14, 14, 14, 0, 13, 49, 29154 }, // я
-    { 11, 22, 13, 1, 21, 61, 29203 }, // ѐ
-    { 11, 20, 13, 1, 19, 55, 29264 }, // ё
-    { 15, 26, 16, 0, 20, 98, 29319 }, // ђ
-    { 12, 21, 12, 0, 21, 63, 29417 }, // ѓ
-    { 12, 15, 13, 1, 14, 45, 29480 }, // є
-    { 10, 15, 12, 1, 14, 38, 29525 }, // ѕ
-    { 8, 20, 8, 0, 20, 40, 29563 }, // і
-    { 10, 19, 8, -1, 19, 48, 29603 }, // ї
-    { 8, 26, 7, -2, 20, 52, 29651 }, // ј
-    { 20, 14, 20, 0, 13, 70, 29703 }, // љ
-    { 21, 14, 21, 0, 13, 74, 29773 }, // њ
-    { 17, 20, 17, 0, 20, 85, 29847 }, // ћ
-    { 15, 22, 15, 0, 21, 83, 29932 }, // ќ
-    { 17, 21, 17, 0, 21, 90, 30015 }, // ѝ
-    { 15, 25, 15, 0, 19, 94, 30105 }, // ў
-    { 17, 18, 17, 0, 13, 77, 30199 }, // џ
-    { 18, 21, 18, 0, 20, 95, 30276 }, // Ѣ
-    { 15, 19, 15, 0, 18, 72, 30371 }, // ѣ
-    { 18, 19, 19, 1, 18, 86, 30443 }, // Ѳ
-    { 13, 15, 15, 1, 14, 49, 30529 }, // ѳ
-    { 19, 19, 19, 0, 18, 91, 30578 }, // Ѵ
-    { 16, 15, 15, 0, 14, 60, 30669 }, // ѵ
-    { 19, 30, 21, 1, 24, 143, 30729 }, // Ҋ
-    { 17, 24, 17, 0, 19, 102, 30872 }, // ҋ
-    { 15, 19, 16, 0, 18, 72, 30974 }, // Ҍ
-    { 13, 19, 13, 0, 18, 62, 31046 }, // ҍ
-    { 14, 18, 15, 1, 18, 63, 31108 }, // Ҏ
-    { 15, 20, 15, 0, 14, 75, 31171 }, // ҏ
-    { 13, 21, 14, 1, 21, 69, 31246 }, // Ґ
-    { 11, 16, 12, 1, 16, 44, 31315 }, // ґ
-    { 14, 18, 15, 0, 18, 63, 31359 }, // Ғ
-    { 12, 13, 12, 0, 13, 39, 31422 }, // ғ
-    { 15, 24, 17, 1, 18, 90, 31461 }, // Ҕ
-    { 14, 19, 15, 0, 13, 67, 31551 }, // ҕ
-    { 25, 24, 25, 0, 18, 150, 31618 }, // Җ
-    { 20, 19, 20, 0, 14, 95, 31768 }, // җ
-    { 14, 24, 15, 0, 18, 84, 31863 }, // Ҙ
-    { 11, 19, 12, 0, 14, 53, 31947 }, // ҙ
-    { 17, 24, 18, 1, 18, 102, 32000 }, // Қ
-    { 15, 19, 15, 0, 14, 72, 32102 }, // қ
-    { 18, 19, 19, 1, 18, 86, 32174 }, // Ҝ
-    { 15, 15, 15, 0, 14, 57, 32260 }, // ҝ
-    { 18, 19, 18, 0, 18, 86, 32317 }, // Ҟ
-    { 14, 19, 14, 0, 18, 67, 32403 }, // ҟ
-    { 21, 19, 21, 0, 18, 100, 32470 }, // Ҡ
-    { 17, 15, 17, 0, 14, 64, 32570 }, // ҡ
-    { 20, 24, 21, 1, 18, 120, 32634 }, // Ң
-    { 17, 18, 18, 0, 13, 77, 32754 }, // ң
-    { 23, 18, 24, 1, 18, 104, 32831 }, // Ҥ
-    { 19, 13, 20, 0, 13, 62, 32935 }, // ҥ
-    { 25, 24, 26, 1, 18, 150, 32997 }, // Ҧ
-    { 23, 19, 24, 0, 13, 110, 33147 }, // ҧ
-    { 19, 19, 21, 1, 18, 91, 33257 }, // Ҩ
-    { 15, 15, 16, 1, 14, 57, 33348 }, // ҩ
-    { 14, 24, 16, 1, 18, 84, 33405 }, // Ҫ
-    { 11, 19, 13, 1, 14, 53, 33489 }, // ҫ
-    { 17, 24, 17, 0, 18, 102, 33542 }, // Ҭ
-    { 14, 18, 14, 0, 13, 63, 33644 }, // ҭ
-    { 17, 18, 17, 0, 18, 77, 33707 }, // Ү
-    { 15, 19, 15, 0, 13, 72, 33784 }, // ү
-    { 17, 18, 17, 0, 18, 77, 33856 }, // Ұ
-    { 15, 19, 15, 0, 13, 72, 33933 }, // ұ
-    { 19, 24, 18, 0, 18, 114, 34005 }, // Ҳ
-    { 15, 18, 15, 0, 13, 68, 34119 }, // ҳ
-    { 23, 24, 23, 0, 18, 138, 34187 }, // Ҵ
-    { 19, 18, 20, 0, 13, 86, 34325 }, // ҵ
-    { 18, 24, 18, 0, 18, 108, 34411 }, // Ҷ
-    { 15, 18, 16, 0, 13, 68, 34519 }, // ҷ
-    { 17, 18, 18, 0, 18, 77, 34587 }, // Ҹ
-    { 15, 13, 15, 0, 13, 49, 34664 }, // ҹ
-    { 17, 18, 18, 1, 18, 77, 34713 }, // Һ
-    { 17, 20, 17, 0, 20, 85, 34790 }, // һ
-    { 20, 19, 20, 0, 18, 95, 34875 }, // Ҽ
-    { 15, 15, 16, 0, 14, 57, 34970 }, // ҽ
-    { 20, 24, 20, 0, 18, 120, 35027 }, // Ҿ
-    { 15, 19, 16, 0, 14, 72, 35147 }, // ҿ
-    { 8, 18, 9, 1, 18, 36, 35219 }, // Ӏ
-    { 25, 25, 25, 0, 24, 157, 35255 }, // Ӂ
-    { 20, 20, 20, 0, 19, 100, 35412 }, // ӂ
-    { 16, 24, 17, 1, 18, 96, 35512 }, // Ӄ
-    { 14, 20, 15, 0, 14, 70, 35608 }, // ӄ
-    { 18, 24, 19, 0, 18, 108, 35678 }, // Ӆ
-    { 15, 18, 16, 0, 13, 68, 35786 }, // ӆ
-    { 19, 24, 20, 1, 18, 114, 35854 }, // Ӈ
-    { 17, 19, 17, 0, 13, 81, 35968 }, // ӈ
-    { 19, 24, 21, 1, 18, 114, 36049 }, // Ӊ
-    { 17, 18, 17, 0, 13, 77, 36163 }, // ӊ
-    { 17, 24, 18, 0, 18, 102, 36240 }, // Ӌ
-    { 15, 18, 15, 0, 13, 68, 36342 }, // ӌ
-    { 23, 24, 22, 0, 18, 138, 36410 }, // Ӎ
-    { 18, 18, 19, 1, 13, 81, 36548 }, // ӎ
-    { 8, 20, 8, 0, 20, 40, 36629 }, // ӏ
-    { 19, 24, 19, 0, 24, 114, 36669 }, // Ӑ
-    { 13, 20, 14, 1, 19, 65, 36783 }, // ӑ
-    { 19, 23, 19, 0, 23, 110, 36848 }, // Ӓ
-    { 13, 20, 14, 1, 19, 65, 36958 }, // ӓ
-    { 24, 18, 23, -1, 18, 108, 37023 }, // Ӕ
-    { 19, 15, 20, 1, 14, 72, 37131 }, // ӕ
-    { 14, 24, 16, 1, 24, 84, 37203 }, // Ӗ
-    { 11, 20, 13, 1, 19, 55, 37287 }, // ӗ
-    { 15, 19, 17, 1, 18, 72, 37342 }, // Ә
-    { 11, 15, 13, 1, 14, 42, 37414 }, // ә
-    { 15, 24, 17, 1, 23, 90, 37456 }, // Ӛ
-    { 11, 20, 13, 1, 19, 55, 37546 }, // ӛ
-    { 25, 24, 25, 0, 23, 150, 37601 }, // Ӝ
-    { 20, 20, 20, 0, 19, 100, 37751 }, // ӝ
-    { 14, 24, 15, 0, 23, 84, 37851 }, // Ӟ
-    { 11, 20, 12, 0, 19, 55, 37935 }, // ӟ
-    { 14, 19, 14, 0, 18, 67, 37990 }, // Ӡ
-    { 12, 19, 13, 0, 13, 57, 38057 }, // ӡ
-    { 19, 23, 21, 1, 23, 110, 38114 }, // Ӣ
-    { 17, 18, 17, 0, 18, 77, 38224 }, // ӣ
-    { 19, 23, 21, 1, 23, 110, 38301 }, // Ӥ
-    { 17, 19, 17, 0, 19, 81, 38411 }, // ӥ
-    { 18, 24, 19, 1, 23, 108, 38492 }, // Ӧ
-    { 13, 20, 15, 1, 19, 65, 38600 }, // ӧ
-    { 18, 19, 19, 1, 18, 86, 38665 }, // Ө
-    { 13, 15, 15, 1, 14, 49, 38751 }, // ө
-    { 18, 24, 21, 1, 23, 108, 38800 }, // Ӫ
-    { 13, 20, 15, 1, 19, 65, 38908 }, // ӫ
-    { 15, 24, 17, 1, 23, 90, 38973 }, // Ӭ
-    { 12, 20, 13, 0, 19, 60, 39063 }, // ӭ
-    { 18, 24, 18, 0, 23, 108, 39123 }, // Ӯ
-    { 15, 24, 15, 0, 18, 90, 39231 }, // ӯ
-    { 18, 24, 18, 0, 23, 108, 39321 }, // Ӱ
-    { 15, 25, 15, 0, 19, 94, 39429 }, // ӱ
-    { 18, 26, 18, 0, 25, 117, 39523 }, // Ӳ
-    { 15, 27, 15, 0, 21, 102, 39640 }, // ӳ
-    { 17, 23, 18, 0, 23, 98, 39742 }, // Ӵ
-    { 15, 19, 16, 0, 19, 72, 39840 }, // ӵ
-    { 13, 24, 15, 1, 18, 78, 39912 }, // Ӷ
-    { 12, 18, 12, 0, 13, 54, 39990 }, // ӷ
-    { 22, 24, 24, 1, 23, 132, 40044 }, // Ӹ
-    { 20, 20, 20, 0, 19, 100, 40176 }, // ӹ
-    { 14, 24, 15, 0, 18, 84, 40276 }, // Ӻ
-    { 12, 18, 12, 0, 13, 54, 40360 }, // ӻ
-    { 18, 24, 18, 0, 18, 108, 40414 }, // Ӽ
-    { 15, 19, 15, 0, 13, 72, 40522 }, // ӽ
-    { 18, 18, 18, 0, 18, 81, 40594 }, // Ӿ
-    { 15, 13, 15, 0, 13, 49, 40675 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 40724 }, //  
-    { 0, 0, 25, 0, 0, 0, 40724 }, //  
-    { 0, 0, 13, 0, 0, 0, 40724 }, //  
-    { 0, 0, 25, 0, 0, 0, 40724 }, //  
-    { 0, 0, 8, 0, 0, 0, 40724 }, //  
-    { 0, 0, 6, 0, 0, 0, 40724 }, //  
-    { 0, 0, 4, 0, 0, 0, 40724 }, //  
-    { 0, 0, 16, 0, 0, 0, 40724 }, //  
-    { 0, 0, 7, 0, 0, 0, 40724 }, //  
-    { 0, 0, 5, 0, 0, 0, 40724 }, //  
-    { 0, 0, 1, 0, 0, 0, 40724 }, //  
-    { 0, 0, 0, 0, 0, 0, 40724 }, // ​
-    { 2, 21, 0, -1, 15, 11, 40724 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 40735 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 40770 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 40818 }, // ‏
-    { 8, 3, 9, 1, 8, 6, 40866 }, // ‐
-    { 8, 3, 9, 1, 8, 6, 40872 }, // ‑
-    { 12, 3, 16, 2, 10, 9, 40878 }, // ‒
-    { 13, 3, 13, 0, 8, 10, 40887 }, // –
-    { 25, 3, 25, 0, 8, 19, 40897 }, // —
-    { 25, 3, 25, 0, 8, 19, 40916 }, // ―
-    { 8, 26, 13, 2, 20, 52, 40935 }, // ‖
-    { 13, 6, 13, 0, -1, 20, 40987 }, // ‗
-    { 5, 8, 6, 1, 19, 10, 41007 }, // ‘
-    { 5, 8, 6, 0, 19, 10, 41017 }, // ’
-    { 5, 9, 6, 0, 4, 12, 41027 }, // ‚
-    { 5, 8, 6, 1, 19, 10, 41039 }, // ‛
-    { 10, 8, 11, 1, 19, 20, 41049 }, // “
-    { 10, 8, 11, 0, 19, 20, 41069 }, // ”
-    { 10, 9, 11, 0, 4, 23, 41089 }, // „
-    { 10, 8, 11, 1, 19, 20, 41112 }, // ‟
-    { 12, 17, 13, 0, 18, 51, 41132 }, // †
-    { 12, 20, 13, 0, 18, 60, 41183 }, // ‡
-    { 6, 6, 8, 1, 9, 9, 41243 }, // •
-    { 9, 9, 16, 3, 13, 21, 41252 }, // ‣
-    { 5, 4, 7, 1, 3, 5, 41273 }, // ․
-    { 11, 5, 13, 1, 4, 14, 41278 }, // ‥
-    { 21, 5, 25, 2, 4, 27, 41292 }, // …
-    { 5, 4, 7, 1, 9, 5, 41319 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 41324 }, //  
-    { 0, 0, 0, 0, 0, 0, 41324 }, //  
-    { 8, 24, 0, -4, 18, 48, 41324 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 41372 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 41420 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 41468 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 41534 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 41600 }, //  
-    { 32, 21, 34, 1, 19, 168, 41600 }, // ‰
-    { 5, 9, 7, 1, 18, 12, 41768 }, // ′
-    { 10, 9, 11, 1, 18, 23, 41780 }, // ″
-    { 15, 9, 16, 1, 18, 34, 41803 }, // ‴
-    { 6, 9, 7, 0, 18, 14, 41837 }, // ‵
-    { 11, 9, 12, 0, 18, 25, 41851 }, // ‶
-    { 17, 9, 17, 0, 18, 39, 41876 }, // ‷
-    { 11, 6, 12, 1, 0, 17, 41915 }, // ‸
-    { 7, 10, 8, 0, 11, 18, 41932 }, // ‹
-    { 7, 10, 8, 1, 11, 18, 41950 }, // ›
-    { 16, 18, 16, 0, 17, 72, 41968 }, // ※
-    { 11, 20, 14, 2, 19, 55, 42040 }, // ‼
-    { 13, 3, 13, 0, 21, 10, 42095 }, // ‾
-    { 6, 3, 8, 1, 8, 5, 42105 }, // ⁃
-    { 13, 21, 5, -4, 19, 69, 42110 }, // ⁄
-    { 20, 20, 22, 1, 19, 100, 42179 }, // ⁇
-    { 17, 20, 19, 1, 19, 85, 42279 }, // ⁈
-    { 16, 20, 19, 2, 19, 80, 42364 }, // ⁉
-    { 15, 5, 25, 5, 10, 19, 42444 }, // ⁓
-    { 20, 9, 21, 1, 18, 45, 42463 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 42508 }, //  
-    { 0, 0, 0, 0, 0, 0, 42508 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 42508 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 42508 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 42508 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 42508 }, // ⁤
-    { 11, 13, 11, 0, 21, 36, 42508 }, // ⁰
-    { 11, 13, 11, 0, 21, 36, 42544 }, // ⁴
-    { 9, 13, 11, 1, 21, 30, 42580 }, // ⁵
-    { 9, 13, 11, 1, 21, 30, 42610 }, // ⁶
-    { 8, 13, 11, 2, 21, 26, 42640 }, // ⁷
-    { 9, 13, 11, 1, 21, 30, 42666 }, // ⁸
-    { 9, 13, 11, 1, 21, 30, 42696 }, // ⁹
-    { 11, 9, 14, 2, 18, 25, 42726 }, // ⁿ
-    { 11, 12, 11, 0, 8, 33, 42751 }, // ₀
-    { 8, 13, 11, 2, 9, 26, 42784 }, // ₁
-    { 9, 12, 11, 1, 8, 27, 42810 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 42837 }, // ₃
-    { 11, 12, 11, 0, 8, 33, 42864 }, // ₄
-    { 9, 12, 11, 1, 8, 27, 42897 }, // ₅
-    { 9, 12, 11, 1, 8, 27, 42924 }, // ₆
-    { 8, 12, 11, 2, 8, 24, 42951 }, // ₇
-    { 9, 12, 11, 1, 8, 27, 42975 }, // ₈
-    { 9, 12, 11, 1, 8, 27, 43002 }, // ₉
-    { 13, 18, 16, 1, 18, 59, 43029 }, // ₣
-    { 14, 19, 16, 1, 18, 67, 43088 }, // ₤
-    { 31, 19, 31, 0, 18, 148, 43155 }, // ₧
-    { 15, 19, 16, 0, 18, 72, 43303 }, // €
-    { 15, 11, 25, 5, 14, 42, 43375 }, // ←
-    { 11, 17, 25, 7, 17, 47, 43417 }, // ↑
-    { 15, 11, 25, 5, 14, 42, 43464 }, // →
-    { 11, 17, 25, 7, 17, 47, 43506 }, // ↓
-    { 15, 11, 25, 5, 14, 42, 43553 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 43595 }, // ↕
-    { 11, 17, 25, 7, 17, 47, 43642 }, // ↨
-    { 11, 17, 25, 7, 17, 47, 43689 }, // ↲
-    { 11, 17, 25, 7, 17, 47, 43736 }, // ↳
-    { 13, 12, 25, 6, 15, 39, 43783 }, // ↵
-    { 15, 11, 25, 5, 14, 42, 43822 }, // ⇐
-    { 11, 15, 25, 7, 16, 42, 43864 }, // ⇑
-    { 15, 11, 25, 5, 14, 42, 43906 }, // ⇒
-    { 11, 15, 25, 7, 16, 42, 43948 }, // ⇓
-    { 15, 11, 25, 5, 14, 42, 43990 }, // ⇔
-    { 17, 19, 25, 4, 18, 81, 44032 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 44113 }, // ∂
-    { 11, 18, 25, 7, 18, 50, 44182 }, // ∃
-    { 19, 20, 25, 3, 19, 95, 44232 }, // ∅
-    { 16, 18, 16, 0, 18, 72, 44327 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 44399 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 44480 }, // ∈
-    { 17, 22, 25, 4, 19, 94, 44557 }, // ∉
-    { 17, 14, 25, 4, 16, 60, 44651 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 44711 }, // ∋
-    { 17, 22, 25, 4, 19, 94, 44788 }, // ∌
-    { 17, 14, 25, 4, 16, 60, 44882 }, // ∍
-    { 19, 22, 20, 1, 18, 105, 44942 }, // ∏
-    { 15, 23, 15, 0, 18, 87, 45047 }, // ∑
-    { 11, 3, 16, 2, 10, 9, 45134 }, // −
-    { 12, 20, 12, 0, 18, 60, 45143 }, // ∕
-    { 12, 20, 13, 1, 18, 60, 45203 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 45263 }, // ∗
-    { 9, 9, 16, 3, 13, 21, 45302 }, // ∘
-    { 4, 4, 16, 6, 9, 4, 45323 }, // ∙
-    { 16, 24, 16, 0, 21, 96, 45327 }, // √
-    { 13, 10, 16, 1, 13, 33, 45423 }, // ∝
-    { 16, 9, 16, 0, 12, 36, 45456 }, // ∞
-    { 16, 18, 25, 4, 18, 72, 45492 }, // ∟
-    { 18, 18, 25, 3, 18, 81, 45564 }, // ∠
-    { 3, 26, 13, 5, 20, 20, 45645 }, // ∣
-    { 8, 26, 13, 2, 20, 52, 45665 }, // ∥
-    { 17, 18, 25, 4, 18, 77, 45717 }, // ∧
-    { 17, 18, 25, 4, 18, 77, 45794 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 45871 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 45939 }, // ∪
-    { 14, 26, 16, 1, 20, 91, 46011 }, // ∫
-    { 16, 15, 25, 5, 14, 60, 46102 }, // ∴
-    { 16, 15, 25, 5, 14, 60, 46162 }, // ∵
-    { 4, 13, 8, 2, 15, 13, 46222 }, // ∶
-    { 16, 15, 25, 5, 14, 60, 46235 }, // ∷
-    { 15, 5, 25, 5, 10, 19, 46295 }, // ∼
-    { 15, 13, 25, 5, 15, 49, 46314 }, // ≅
-    { 12, 9, 16, 2, 13, 27, 46363 }, // ≈
-    { 15, 8, 25, 5, 11, 30, 46390 }, // ≍
-    { 11, 11, 16, 2, 14, 31, 46420 }, // ≠
-    { 15, 11, 25, 5, 13, 42, 46451 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 46493 }, // ≤
-    { 12, 15, 16, 2, 15, 45, 46538 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 46583 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 46652 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 46721 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 46785 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 46883 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 46981 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 47058 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 47135 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 47226 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 47317 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 47408 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 47499 }, // ⊥
-    { 4, 4, 16, 6, 9, 4, 47567 }, // ⋅
-    { 21, 4, 25, 2, 9, 21, 47571 }, // ⋯
-    { 25, 24, 25, 0, 21, 150, 47592 }, // �
+    { 19, 18, 21, 1, 18, 86, 2048 }, // H
+    { 8, 18, 9, 1, 18, 36, 2134 }, // I
+    { 10, 24, 9, -1, 18, 60, 2170 }, // J
+    { 18, 19, 18, 1, 18, 86, 2230 }, // K
+    { 14, 18, 15, 1, 18, 63, 2316 }, // L
+    { 23, 18, 22, 0, 18, 104, 2379 }, // M
+    { 19, 19, 20, 1, 18, 91, 2483 }, // N
+    { 18, 19, 19, 1, 18, 86, 2574 }, // O
+    { 14, 18, 15, 1, 18, 63, 2660 }, // P
+    { 19, 23, 19, 1, 18, 110, 2723 }, // Q
+    { 17, 19, 17, 1, 18, 81, 2833 }, // R
+    { 12, 19, 14, 1, 18, 57, 2914 }, // S
+    { 17, 18, 17, 0, 18, 77, 2971 }, // T
+    { 19, 19, 19, 0, 18, 91, 3048 }, // U
+    { 19, 19, 18, 0, 18, 91, 3139 }, // V
+    { 28, 19, 28, 0, 18, 133, 3230 }, // W
+    { 18, 18, 18, 0, 18, 81, 3363 }, // X
+    { 17, 18, 17, 0, 18, 77, 3444 }, // Y
+    { 15, 19, 15, 0, 18, 72, 3521 }, // Z
+    { 6, 24, 8, 1, 20, 36, 3593 }, // [
+    { 12, 20, 12, 0, 18, 60, 3629 }, // <backslash>
+    { 5, 24, 8, 1, 20, 30, 3689 }, // ]
+    { 12, 12, 16, 2, 16, 36, 3719 }, // ^
+    { 13, 2, 13, 0, -1, 7, 3755 }, // _
+    { 6, 7, 17, 5, 21, 11, 3762 }, // `
+    { 13, 15, 14, 1, 14, 49, 3773 }, // a
+    { 15, 21, 15, -1, 20, 79, 3822 }, // b
+    { 11, 15, 13, 1, 14, 42, 3901 }, // c
+    { 15, 21, 16, 1, 20, 79, 3943 }, // d
+    { 11, 15, 13, 1, 14, 42, 4022 }, // e
+    { 12, 20, 10, 0, 20, 60, 4096 }, // f
+    { 15, 20, 15, 0, 14, 75, 4156 }, // g
+    { 17, 20, 17, 0, 20, 85, 4231 }, // h
+    { 8, 20, 8, 0, 20, 40, 4316 }, // i
+    { 8, 26, 7, -2, 20, 52, 4356 }, // j
+    { 15, 21, 15, 0, 20, 79, 4408 }, // k
+    { 8, 20, 8, 0, 20, 40, 4487 }, // l
+    { 25, 14, 25, 0, 14, 88, 4527 }, // m
+    { 17, 14, 17, 0, 14, 60, 4615 }, // n
+    { 13, 15, 15, 1, 14, 49, 4675 }, // o
+    { 15, 20, 15, 0, 14, 75, 4724 }, // p
+    { 14, 20, 15, 1, 14, 70, 4799 }, // q
+    { 12, 14, 12, 0, 14, 42, 4869 }, // r
+    { 10, 15, 12, 1, 14, 38, 4911 }, // s
+    { 10, 18, 10, 0, 17, 45, 4949 }, // t
+    { 17, 15, 16, 0, 14, 64, 4994 }, // u
+    { 15, 14, 15, 0, 13, 53, 5058 }, // v
+    { 22, 14, 22, 0, 13, 77, 5111 }, // w
+    { 15, 13, 15, 0, 13, 49, 5188 }, // x
+    { 15, 19, 15, 0, 13, 72, 5237 }, // y
+    { 12, 14, 13, 0, 13, 42, 5309 }, // z
+    { 8, 25, 10, 1, 20, 50, 5351 }, // {
+    { 3, 23, 7, 2, 20, 18, 5401 }, // |
+    { 8, 25, 10, 0, 20, 50, 5419 }, // }
+    { 12, 5, 16, 2, 11, 15, 5469 }, // ~
+    { 0, 0, 5, 0, 0, 0, 5484 }, //  
+    { 4, 20, 7, 1, 14, 20, 5484 }, // ¡
+    { 13, 25, 16, 1, 20, 82, 5504 }, // ¢
+    { 14, 19, 16, 1, 18, 67, 5586 }, // £
+    { 14, 13, 16, 1, 15, 46, 5653 }, // ¤
+    { 17, 18, 16, -1, 18, 77, 5699 }, // ¥
+    { 3, 23, 7, 2, 20, 18, 5776 }, // ¦
+    { 11, 21, 13, 1, 18, 58, 5794 }, // §
+    { 9, 4, 17, 4, 19, 9, 5852 }, // ¨
+    { 19, 19, 20, 0, 18, 91, 5861 }, // ©
+    { 9, 12, 11, 1, 18, 27, 5952 }, // ª
+    { 14, 10, 13, 0, 11, 35, 5979 }, // «
+    { 11, 7, 16, 2, 12, 20, 6014 }, // ¬
+    { 8, 3, 9, 1, 8, 6, 6034 }, // ­
+    { 14, 14, 15, 0, 20, 49, 6040 }, // ®
+    { 9, 3, 17, 4, 18, 7, 6089 }, // ¯
+    { 9, 9, 13, 2, 18, 21, 6096 }, // °
+    { 11, 15, 16, 2, 15, 42, 6144 }, // ±
+    { 9, 12, 11, 1, 21, 27, 6186 }, // ²
+    { 9, 13, 11, 1, 21, 30, 6213 }, // ³
+    { 5, 7, 17, 6, 21, 9, 6243 }, // ´
+    { 16, 20, 17, 1, 14, 80, 6252 }, // µ
+    { 13, 22, 14, 0, 18, 72, 6332 }, // ¶
+    { 5, 4, 7, 1, 9, 5, 6404 }, // ·
+    { 5, 6, 17, 6, -1, 8, 6409 }, // ¸
+    { 8, 12, 11, 2, 21, 24, 6417 }, // ¹
+    { 9, 12, 11, 1, 18, 27, 6441 }, // º
+    { 13, 10, 13, 1, 11, 33, 6468 }, // »
+    { 24, 21, 27, 2, 19, 126, 6501 }, // ¼
+    { 24, 21, 27, 2, 19, 126, 6627 }, // ½
+    { 25, 21, 27, 1, 19, 132, 6753 }, // ¾
+    { 9, 20, 12, 1, 14, 45, 6885 }, // ¿
+    { 19, 24, 19, 0, 24, 114, 6930 }, // À
+    { 19, 24, 19, 0, 24, 114, 7044 }, // Á
+    { 19, 24, 19, 0, 24, 114, 7158 }, // Â
+    { 19, 24, 19, 0, 24, 114, 7272 }, // Ã
+    { 19, 23, 19, 0, 23, 110, 7386 }, // Ä
+    { 19, 25, 19, 0, 25, 119, 7496 }, // Å
+    { 24, 18, 23, -1, 18, 108, 7615 }, // Æ
+    { 14, 25, 16, 1, 18, 88, 7723 }, // Ç
+    { 14, 24, 16, 1, 24, 84, 7811 }, // È
+    { 14, 24, 16, 1, 24, 84, 7895 }, // É
+    { 14, 24, 16, 1, 24, 84, 7979 }, // Ê
+    { 14, 23, 16, 1, 23, 81, 8063 }, // Ë
+    { 8, 24, 9, 1, 24, 48, 8144 }, // Ì
+    { 8, 24, 9, 1, 24, 48, 8192 }, // Í
+    { 9, 24, 9, 0, 24, 54, 8240 }, // Î
+    { 10, 23, 9, 0, 23, 58, 8294 }, // Ï
+    { 18, 19, 19, 0, 18, 86, 8352 }, // Ð
+    { 19, 25, 20, 1, 24, 119, 8438 }, // Ñ
+    { 18, 25, 19, 1, 24, 113, 8557 }, // Ò
+    { 18, 25, 19, 1, 24, 113, 8670 }, // Ó
+    { 18, 25, 19, 1, 24, 113, 8783 }, // Ô
+    { 18, 25, 19, 1, 24, 113, 8896 }, // Õ
+    { 18, 24, 19, 1, 23, 108, 9009 }, // Ö
+    { 10, 11, 16, 3, 14, 28, 9117 }, // ×
+    { 19, 19, 19, 0, 18, 91, 9145 }, // Ø
+    { 19, 25, 19, 0, 24, 119, 9236 }, // Ù
+    { 19, 25, 19, 0, 24, 119, 9355 }, // Ú
+    { 19, 25, 19, 0, 24, 119, 9474 }, // Û
+    { 19, 24, 19, 0, 23, 114, 9593 }, // Ü
+    { 17, 24, 17, 0, 24, 102, 9707 }, // Ý
+    { 14, 18, 16, 1, 18, 63, 9809 }, // Þ
+    { 16, 21, 16, 0, 20, 84, 9872 }, // ß
+    { 13, 22, 14, 1, 21, 72, 9956 }, // à
+    { 13, 22, 14, 1, 21, 72, 10028 }, // á
+    { 13, 21, 14, 1, 20, 69, 10100 }, // â
+    { 13, 21, 14, 1, 20, 69, 10169 }, // ã
+    { 13, 20, 14, 1, 19, 65, 10240 }, // ä
+    { 13, 22, 14, 1, 21, 72, 10305 }, // å
+    { 19, 15, 20, 1, 14, 72, 10377 }, // æ
+    { 11, 21, 13, 1, 14, 58, 10449 }, // ç
+    { 11, 22, 13, 1, 21, 61, 10507 }, // è
+    { 11, 22, 13, 1, 21, 61, 10568 }, // é
+    { 11, 21, 13, 1, 20, 58, 10629 }, // ê
+    { 11, 20, 13, 1, 19, 55, 10687 }, // ë
+    { 8, 21, 8, 0, 21, 42, 10742 }, // ì
+    { 8, 21, 8, 0, 21, 42, 10784 }, // í
+    { 8, 20, 8, 0, 20, 40, 10826 }, // î
+    { 10, 19, 8, -1, 19, 48, 10866 }, // ï
+    { 13, 22, 15, 1, 21, 72, 10914 }, // ð
+    { 17, 20, 17, 0, 20, 85, 10986 }, // ñ
+    { 13, 22, 15, 1, 21, 72, 11071 }, // ò
+    { 13, 22, 15, 1, 21, 72, 11143 }, // ó
+    { 13, 21, 15, 1, 20, 69, 11215 }, // ô
+    { 13, 21, 15, 1, 20, 69, 11284 }, // õ
+    { 13, 20, 15, 1, 19, 65, 11353 }, // ö
+    { 11, 13, 16, 2, 15, 36, 11418 }, // ÷
+    { 15, 15, 15, 0, 14, 57, 11454 }, // ø
+    { 17, 22, 16, 0, 21, 94, 11511 }, // ù
+    { 17, 22, 16, 0, 21, 94, 11605 }, // ú
+    { 17, 21, 16, 0, 20, 90, 11699 }, // û
+    { 17, 20, 16, 0, 19, 85, 11789 }, // ü
+    { 15, 27, 15, 0, 21, 102, 11874 }, // ý
+    { 15, 26, 16, 0, 20, 98, 11976 }, // þ
+    { 15, 25, 15, 0, 19, 94, 12074 }, // ÿ
+    { 19, 23, 19, 0, 23, 110, 12168 }, // Ā
+    { 13, 19, 14, 1, 18, 62, 12288 }, // ā
+    { 19, 24, 19, 0, 24, 114, 12350 }, // Ă
+    { 13, 21, 14, 1, 20, 69, 12464 }, // ă
+    { 19, 24, 19, 0, 18, 114, 12533 }, // Ą
+    { 13, 20, 14, 1, 14, 65, 12647 }, // ą
+    { 14, 25, 16, 1, 24, 88, 12712 }, // Ć
+    { 11, 22, 13, 1, 21, 61, 12800 }, // ć
+    { 14, 25, 16, 1, 24, 88, 12861 }, // Ĉ
+    { 11, 21, 13, 1, 20, 58, 12949 }, // ĉ
+    { 14, 25, 16, 1, 24, 88, 13007 }, // Ċ
+    { 11, 20, 13, 1, 19, 55, 13095 }, // ċ
+    { 14, 25, 16, 1, 24, 88, 13150 }, // Č
+    { 11, 22, 13, 1, 21, 61, 13238 }, // č
+    { 17, 25, 19, 1, 24, 107, 13299 }, // Ď
+    { 17, 21, 16, 1, 20, 90, 13406 }, // ď
+    { 18, 19, 19, 0, 18, 86, 13496 }, // Đ
+    { 15, 21, 16, 1, 20, 79, 13582 }, // đ
+    { 14, 23, 16, 1, 23, 81, 13661 }, // Ē
+    { 11, 19, 13, 1, 18, 53, 13742 }, // ē
+    { 14, 24, 16, 1, 24, 84, 13795 }, // Ĕ
+    { 11, 21, 13, 1, 20, 58, 13879 }, // ĕ
+    { 14, 24, 16, 1, 24, 84, 13937 }, // Ė
+    { 11, 20, 13, 1, 19, 55, 14021 }, // ė
+    { 14, 24, 16, 1, 18, 84, 14076 }, // Ę
+    { 11, 20, 13, 1, 14, 55, 14160 }, // ę
+    { 14, 24, 16, 1, 24, 84, 14215 }, // Ě
+    { 11, 22, 13, 1, 21, 61, 14336 }, // ě
+    { 16, 25, 18, 1, 24, 100, 14397 }, // Ĝ
+    { 15, 26, 15, 0, 20, 98, 14497 }, // ĝ
+    { 16, 25, 18, 1, 24, 100, 14595 }, // Ğ
+    { 15, 26, 15, 0, 20, 98, 14695 }, // ğ
+    { 16, 25, 18, 1, 24, 100, 14793 }, // Ġ
+    { 15, 25, 15, 0, 19, 94, 14893 }, // ġ
+    { 16, 25, 18, 1, 18, 100, 14987 }, // Ģ
+    { 15, 28, 15, 0, 22, 105, 15087 }, // ģ
+    { 19, 24, 21, 1, 24, 114, 15192 }, // Ĥ
+    { 18, 26, 17, -1, 26, 117, 15306 }, // ĥ
+    { 21, 18, 21, 0, 18, 95, 15423 }, // Ħ
+    { 17, 20, 17, 0, 20, 85, 15518 }, // ħ
+    { 9, 24, 9, 0, 24, 54, 15603 }, // Ĩ
+    { 9, 20, 8, 0, 20, 45, 15657 }, // ĩ
+    { 9, 23, 9, 0, 23, 52, 15702 }, // Ī
+    { 9, 18, 8, 0, 18, 41, 15754 }, // ī
+    { 9, 24, 9, 0, 24, 54, 15795 }, // Ĭ
+    { 8, 20, 8, 0, 20, 40, 15849 }, // ĭ
+    { 8, 24, 9, 1, 18, 48, 15889 }, // Į
+    { 8, 26, 8, 0, 20, 52, 15937 }, // į
+    { 8, 24, 9, 1, 24, 48, 15989 }, // İ
+    { 8, 14, 8, 0, 14, 28, 16037 }, // ı
+    { 17, 24, 18, 1, 18, 102, 16065 }, // Ĳ
+    { 14, 26, 15, 0, 20, 91, 16167 }, // ĳ
+    { 10, 30, 9, -1, 24, 75, 16258 }, // Ĵ
+    { 10, 26, 7, -2, 20, 65, 16384 }, // ĵ
+    { 18, 25, 18, 1, 18, 113, 16449 }, // Ķ
+    { 15, 27, 15, 0, 20, 102, 16562 }, // ķ
+    { 16, 15, 15, 0, 14, 60, 16664 }, // ĸ
+    { 14, 24, 15, 1, 24, 84, 16724 }, // Ĺ
+    { 8, 26, 8, 0, 26, 52, 16808 }, // ĺ
+    { 14, 25, 15, 1, 18, 88, 16860 }, // Ļ
+    { 8, 27, 8, 0, 20, 54, 16948 }, // ļ
+    { 14, 20, 15, 1, 20, 70, 17002 }, // Ľ
+    { 10, 20, 9, 0, 20, 50, 17072 }, // ľ
+    { 14, 18, 15, 1, 18, 63, 17122 }, // Ŀ
+    { 12, 20, 12, 0, 20, 60, 17185 }, // ŀ
+    { 16, 18, 15, -1, 18, 72, 17245 }, // Ł
+    { 10, 20, 8, -1, 20, 50, 17317 }, // ł
+    { 19, 25, 20, 1, 24, 119, 17367 }, // Ń
+    { 17, 21, 17, 0, 21, 90, 17486 }, // ń
+    { 19, 25, 20, 1, 18, 119, 17576 }, // Ņ
+    { 17, 21, 17, 0, 14, 90, 17695 }, // ņ
+    { 19, 25, 20, 1, 24, 119, 17785 }, // Ň
+    { 17, 21, 17, 0, 21, 90, 17904 }, // ň
+    { 23, 19, 23, 0, 19, 110, 17994 }, // ŉ
+    { 19, 23, 20, 1, 18, 110, 18104 }, // Ŋ
+    { 15, 20, 16, 0, 14, 75, 18214 }, // ŋ
+    { 18, 24, 19, 1, 23, 108, 18289 }, // Ō
+    { 13, 19, 15, 1, 18, 62, 18432 }, // ō
+    { 18, 25, 19, 1, 24, 113, 18494 }, // Ŏ
+    { 13, 21, 15, 1, 20, 69, 18607 }, // ŏ
+    { 18, 26, 19, 1, 25, 117, 18676 }, // Ő
+    { 13, 22, 15, 1, 21, 72, 18793 }, // ő
+    { 23, 19, 24, 1, 18, 110, 18865 }, // Œ
+    { 21, 15, 23, 1, 14, 79, 18975 }, // œ
+    { 17, 25, 17, 1, 24, 107, 19054 }, // Ŕ
+    { 12, 21, 12, 0, 21, 63, 19161 }, // ŕ
+    { 17, 25, 17, 1, 18, 107, 19224 }, // Ŗ
+    { 12, 21, 12, 0, 14, 63, 19331 }, // ŗ
+    { 17, 25, 17, 1, 24, 107, 19394 }, // Ř
+    { 12, 21, 12, 0, 21, 63, 19501 }, // ř
+    { 12, 25, 14, 1, 24, 75, 19564 }, // Ś
+    { 10, 22, 12, 1, 21, 55, 19639 }, // ś
+    { 12, 25, 14, 1, 24, 75, 19694 }, // Ŝ
+    { 10, 21, 12, 1, 20, 53, 19769 }, // ŝ
+    { 12, 25, 14, 1, 18, 75, 19822 }, // Ş
+    { 10, 21, 12, 1, 14, 53, 19897 }, // ş
+    { 12, 25, 14, 1, 24, 75, 19950 }, // Š
+    { 10, 22, 12, 1, 21, 55, 20025 }, // š
+    { 17, 25, 17, 0, 18, 107, 20080 }, // Ţ
+    { 10, 24, 10, 0, 17, 60, 20187 }, // ţ
+    { 17, 24, 17, 0, 24, 102, 20247 }, // Ť
+    { 10, 21, 10, 0, 20, 53, 20349 }, // ť
+    { 17, 18, 17, 0, 18, 77, 20402 }, // Ŧ
+    { 10, 18, 10, 0, 17, 45, 20480 }, // ŧ
+    { 19, 25, 19, 0, 24, 119, 20525 }, // Ũ
+    { 17, 21, 16, 0, 20, 90, 20644 }, // ũ
+    { 19, 24, 19, 0, 23, 114, 20734 }, // Ū
+    { 17, 19, 16, 0, 18, 81, 20848 }, // ū
+    { 19, 25, 19, 0, 24, 119, 20929 }, // Ŭ
+    { 17, 21, 16, 0, 20, 90, 21048 }, // ŭ
+    { 19, 26, 19, 0, 25, 124, 21138 }, // Ů
+    { 17, 22, 16, 0, 21, 94, 21262 }, // ů
+    { 19, 26, 19, 0, 25, 124, 21356 }, // Ű
+    { 17, 22, 16, 0, 21, 94, 21480 }, // ű
+    { 19, 24, 19, 0, 18, 114, 21574 }, // Ų
+    { 17, 20, 16, 0, 14, 85, 21688 }, // ų
+    { 28, 25, 28, 0, 24, 175, 21773 }, // Ŵ
+    { 22, 21, 22, 0, 20, 116, 21948 }, // ŵ
+    { 17, 24, 17, 0, 24, 102, 22064 }, // Ŷ
+    { 15, 26, 15, 0, 20, 98, 22166 }, // ŷ
+    { 17, 23, 17, 0, 23, 98, 22264 }, // Ÿ
+    { 15, 25, 15, 0, 24, 94, 22362 }, // Ź
+    { 12, 22, 13, 0, 21, 66, 22456 }, // ź
+    { 15, 25, 15, 0, 24, 94, 22528 }, // Ż
+    { 12, 20, 13, 0, 19, 60, 22622 }, // ż
+    { 15, 25, 15, 0, 24, 94, 22682 }, // Ž
+    { 12, 22, 13, 0, 21, 66, 22776 }, // ž
+    { 12, 20, 10, 0, 20, 60, 22842 }, // ſ
+    { 6, 7, 0, -4, 21, 11, 22902 }, // ̀
+    { 6, 7, 0, -2, 21, 11, 22913 }, // ́
+    { 8, 6, 0, -4, 20, 12, 22924 }, // ̂
+    { 8, 5, 0, -4, 20, 10, 22936 }, // ̃
+    { 10, 3, 0, -5, 18, 8, 22946 }, // ̄
+    { 8, 5, 0, -4, 20, 10, 22954 }, // ̆
+    { 4, 4, 0, -2, 19, 4, 22964 }, // ̇
+    { 10, 4, 0, -5, 19, 10, 22968 }, // ̈
+    { 8, 8, 0, -4, 22, 16, 22978 }, // ̉
+    { 8, 7, 0, -4, 21, 14, 22994 }, // ̊
+    { 10, 7, 0, -4, 21, 18, 23008 }, // ̋
+    { 10, 6, 0, -5, 21, 15, 23026 }, // ̌
+    { 10, 7, 0, -6, 21, 18, 23041 }, // ̏
+    { 8, 5, 0, -4, 20, 10, 23059 }, // ̑
+    { 4, 8, 0, -2, 22, 8, 23069 }, // ̒
+    { 5, 7, 0, -2, 22, 9, 23077 }, // ̓
+    { 5, 7, 0, -3, 22, 9, 23086 }, // ̔
+    { 4, 7, 0, -2, 22, 7, 23095 }, // ̕
+    { 4, 6, 0, -2, 16, 6, 23102 }, // ̛
+    { 4, 4, 0, -2, -2, 4, 23108 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 23112 }, // ̤
+    { 6, 6, 0, -3, -1, 9, 23122 }, // ̥
+    { 5, 6, 0, -3, -1, 8, 23131 }, // ̦
+    { 6, 6, 0, -3, -1, 9, 23139 }, // ̧
+    { 6, 7, 0, -3, 1, 11, 23148 }, // ̨
+    { 3, 6, 7, 2, -1, 5, 23159 }, // ̩
+    { 8, 6, 0, -4, -1, 12, 23164 }, // ̭
+    { 8, 5, 0, -4, -1, 10, 23176 }, // ̮
+    { 8, 5, 0, -4, -1, 10, 23186 }, // ̰
+    { 10, 3, 0, -5, -2, 8, 23196 }, // ̱
+    { 8, 5, 0, -4, 20, 10, 23204 }, // ͂
+    { 10, 10, 0, -5, 25, 25, 23214 }, // ̈́
+    { 5, 5, 0, -2, -1, 7, 23239 }, // ͅ
+    { 14, 24, 16, 1, 24, 84, 23246 }, // Ѐ
+    { 14, 23, 16, 1, 23, 81, 23330 }, // Ё
+    { 20, 24, 20, 0, 18, 120, 23411 }, // Ђ
+    { 13, 24, 15, 1, 24, 78, 23531 }, // Ѓ
+    { 15, 19, 17, 1, 18, 72, 23609 }, // Є
+    { 12, 19, 14, 1, 18, 57, 23681 }, // Ѕ
+    { 8, 18, 9, 1, 18, 36, 23738 }, // І
+    { 10, 23, 9, 0, 23, 58, 23774 }, // Ї
+    { 10, 24, 9, -1, 18, 60, 23832 }, // Ј
+    { 24, 19, 24, 0, 18, 114, 23892 }, // Љ
+    { 24, 19, 26, 1, 18, 114, 24006 }, // Њ
+    { 21, 18, 21, 0, 18, 95, 24120 }, // Ћ
+    { 17, 25, 18, 1, 24, 107, 24215 }, // Ќ
+    { 19, 24, 21, 1, 24, 114, 24322 }, // Ѝ
+    { 18, 25, 18, 0, 24, 113, 24436 }, // Ў
+    { 18, 24, 20, 1, 18, 108, 24576 }, // Џ
+    { 19, 18, 19, 0, 18, 86, 24684 }, // А
+    { 14, 19, 16, 1, 18, 67, 24770 }, // Б
+    { 14, 19, 15, 1, 18, 67, 24837 }, // В
+    { 13, 18, 15, 1, 18, 59, 24904 }, // Г
+    { 18, 24, 19, 0, 18, 108, 24963 }, // Д
+    { 14, 18, 16, 1, 18, 63, 25071 }, // Е
+    { 25, 19, 25, 0, 18, 119, 25134 }, // Ж
+    { 14, 19, 15, 0, 18, 67, 25253 }, // З
+    { 19, 18, 21, 1, 18, 86, 25320 }, // И
+    { 19, 24, 21, 1, 24, 114, 25406 }, // Й
+    { 17, 19, 18, 1, 18, 81, 25520 }, // К
+    { 18, 19, 19, 0, 18, 86, 25601 }, // Л
+    { 23, 18, 22, 0, 18, 104, 25687 }, // М
+    { 19, 18, 21, 1, 18, 86, 25791 }, // Н
+    { 18, 19, 19, 1, 18, 86, 25877 }, // О
+    { 19, 18, 20, 1, 18, 86, 25963 }, // П
+    { 14, 18, 15, 1, 18, 63, 26049 }, // Р
+    { 14, 19, 16, 1, 18, 67, 26112 }, // С
+    { 17, 18, 17, 0, 18, 77, 26179 }, // Т
+    { 18, 19, 18, 0, 18, 86, 26256 }, // У
+    { 18, 19, 20, 1, 18, 86, 26342 }, // Ф
+    { 18, 18, 18, 0, 18, 81, 26428 }, // Х
+    { 19, 24, 20, 1, 18, 114, 26509 }, // Ц
+    { 17, 18, 18, 0, 18, 77, 26624 }, // Ч
+    { 25, 18, 27, 1, 18, 113, 26701 }, // Ш
+    { 25, 24, 27, 1, 18, 150, 26814 }, // Щ
+    { 19, 19, 19, 0, 18, 91, 26964 }, // Ъ
+    { 22, 19, 24, 1, 18, 105, 27055 }, // Ы
+    { 14, 19, 16, 1, 18, 67, 27160 }, // Ь
+    { 15, 19, 17, 1, 18, 72, 27227 }, // Э
+    { 25, 19, 26, 1, 18, 119, 27299 }, // Ю
+    { 17, 19, 17, -1, 18, 81, 27418 }, // Я
+    { 13, 15, 14, 1, 14, 49, 27499 }, // а
+    { 13, 21, 15, 1, 20, 69, 27548 }, // б
+    { 13, 14, 14, 0, 13, 46, 27617 }, // в
+    { 12, 13, 12, 0, 13, 39, 27663 }, // г
+    { 16, 18, 16, 0, 13, 72, 27702 }, // д
+    { 11, 15, 13, 1, 14, 42, 27774 }, // е
+    { 20, 15, 20, 0, 14, 75, 27816 }, // ж
+    { 11, 15, 12, 0, 14, 42, 27891 }, // з
+    { 17, 13, 17, 0, 13, 56, 27933 }, // и
+    { 17, 19, 17, 0, 19, 81, 27989 }, // й
+    { 15, 15, 15, 0, 14, 57, 28070 }, // к
+    { 15, 14, 16, 0, 13, 53, 28127 }, // л
+    { 18, 13, 19, 1, 13, 59, 28180 }, // м
+    { 17, 13, 17, 0, 13, 56, 28239 }, // н
+    { 13, 15, 15, 1, 14, 49, 28295 }, // о
+    { 17, 13, 17, 0, 13, 56, 28344 }, // п
+    { 15, 20, 15, 0, 14, 75, 28400 }, // р
+    { 11, 15, 13, 1, 14, 42, 28475 }, // с
+    { 14, 13, 14, 0, 13, 46, 28517 }, // т
+    { 15, 19, 15, 0, 13, 72, 28563 }, // у
+    { 17, 26, 18, 1, 20, 111, 28672 }, // ф
+    { 15, 13, 15, 0, 13, 49, 28783 }, // х
+    { 17, 18, 17, 0, 13, 77, 28832 }, // ц
+    { 15, 13, 15, 0, 13, 49, 28909 }, // ч
+    { 22, 13, 22, 0, 13, 72, 28958 }, // ш
+    { 22, 18, 22, 0, 13, 99, 29030 }, // щ
+    { 16, 14, 16, 0, 13, 56, 29129 }, // ъ
+    { 20, 14, 20, 0, 13, 70, 29185 }, // ы
+    { 13, 14, 13, 0, 13, 46, 29255 }, // ь
+    { 12, 15, 13, 0, 14, 45, 29301 }, // э
+    { 21, 15, 21, 0, 14, 79, 29346 }, // ю
+    { 14, 14, 14, 0, 13, 49, 29425 }, // я
+    { 11, 22, 13, 1, 21, 61, 29474 }, // ѐ
+    { 11, 20, 13, 1, 19, 55, 29535 }, // ё
+    { 15, 26, 16, 0, 20, 98, 29590 }, // ђ
+    { 12, 21, 12, 0, 21, 63, 29688 }, // ѓ
+    { 12, 15, 13, 1, 14, 45, 29751 }, // є
+    { 10, 15, 12, 1, 14, 38, 29796 }, // ѕ
+    { 8, 20, 8, 0, 20, 40, 29834 }, // і
+    { 10, 19, 8, -1, 19, 48, 29874 }, // ї
+    { 8, 26, 7, -2, 20, 52, 29922 }, // ј
+    { 20, 14, 20, 0, 13, 70, 29974 }, // љ
+    { 21, 14, 21, 0, 13, 74, 30044 }, // њ
+    { 17, 20, 17, 0, 20, 85, 30118 }, // ћ
+    { 15, 22, 15, 0, 21, 83, 30203 }, // ќ
+    { 17, 21, 17, 0, 21, 90, 30286 }, // ѝ
+    { 15, 25, 15, 0, 19, 94, 30376 }, // ў
+    { 17, 18, 17, 0, 13, 77, 30470 }, // џ
+    { 18, 21, 18, 0, 20, 95, 30547 }, // Ѣ
+    { 15, 19, 15, 0, 18, 72, 30642 }, // ѣ
+    { 18, 19, 19, 1, 18, 86, 30720 }, // Ѳ
+    { 13, 15, 15, 1, 14, 49, 30806 }, // ѳ
+    { 19, 19, 19, 0, 18, 91, 30855 }, // Ѵ
+    { 16, 15, 15, 0, 14, 60, 30946 }, // ѵ
+    { 19, 30, 21, 1, 24, 143, 31006 }, // Ҋ
+    { 17, 24, 17, 0, 19, 102, 31149 }, // ҋ
+    { 15, 19, 16, 0, 18, 72, 31251 }, // Ҍ
+    { 13, 19, 13, 0, 18, 62, 31323 }, // ҍ
+    { 14, 18, 15, 1, 18, 63, 31385 }, // Ҏ
+    { 15, 20, 15, 0, 14, 75, 31448 }, // ҏ
+    { 13, 21, 14, 1, 21, 69, 31523 }, // Ґ
+    { 11, 16, 12, 1, 16, 44, 31592 }, // ґ
+    { 14, 18, 15, 0, 18, 63, 31636 }, // Ғ
+    { 12, 13, 12, 0, 13, 39, 31699 }, // ғ
+    { 15, 24, 17, 1, 18, 90, 31738 }, // Ҕ
+    { 14, 19, 15, 0, 13, 67, 31828 }, // ҕ
+    { 25, 24, 25, 0, 18, 150, 31895 }, // Җ
+    { 20, 19, 20, 0, 14, 95, 32045 }, // җ
+    { 14, 24, 15, 0, 18, 84, 32140 }, // Ҙ
+    { 11, 19, 12, 0, 14, 53, 32224 }, // ҙ
+    { 17, 24, 18, 1, 18, 102, 32277 }, // Қ
+    { 15, 19, 15, 0, 14, 72, 32379 }, // қ
+    { 18, 19, 19, 1, 18, 86, 32451 }, // Ҝ
+    { 15, 15, 15, 0, 14, 57, 32537 }, // ҝ
+    { 18, 19, 18, 0, 18, 86, 32594 }, // Ҟ
+    { 14, 19, 14, 0, 18, 67, 32680 }, // ҟ
+    { 21, 19, 21, 0, 18, 100, 32768 }, // Ҡ
+    { 17, 15, 17, 0, 14, 64, 32868 }, // ҡ
+    { 20, 24, 21, 1, 18, 120, 32932 }, // Ң
+    { 17, 18, 18, 0, 13, 77, 33052 }, // ң
+    { 23, 18, 24, 1, 18, 104, 33129 }, // Ҥ
+    { 19, 13, 20, 0, 13, 62, 33233 }, // ҥ
+    { 25, 24, 26, 1, 18, 150, 33295 }, // Ҧ
+    { 23, 19, 24, 0, 13, 110, 33445 }, // ҧ
+    { 19, 19, 21, 1, 18, 91, 33555 }, // Ҩ
+    { 15, 15, 16, 1, 14, 57, 33646 }, // ҩ
+    { 14, 24, 16, 1, 18, 84, 33703 }, // Ҫ
+    { 11, 19, 13, 1, 14, 53, 33787 }, // ҫ
+    { 17, 24, 17, 0, 18, 102, 33840 }, // Ҭ
+    { 14, 18, 14, 0, 13, 63, 33942 }, // ҭ
+    { 17, 18, 17, 0, 18, 77, 34005 }, // Ү
+    { 15, 19, 15, 0, 13, 72, 34082 }, // ү
+    { 17, 18, 17, 0, 18, 77, 34154 }, // Ұ
+    { 15, 19, 15, 0, 13, 72, 34231 }, // ұ
+    { 19, 24, 18, 0, 18, 114, 34303 }, // Ҳ
+    { 15, 18, 15, 0, 13, 68, 34417 }, // ҳ
+    { 23, 24, 23, 0, 18, 138, 34485 }, // Ҵ
+    { 19, 18, 20, 0, 13, 86, 34623 }, // ҵ
+    { 18, 24, 18, 0, 18, 108, 34816 }, // Ҷ
+    { 15, 18, 16, 0, 13, 68, 34924 }, // ҷ
+    { 17, 18, 18, 0, 18, 77, 34992 }, // Ҹ
+    { 15, 13, 15, 0, 13, 49, 35069 }, // ҹ
+    { 17, 18, 18, 1, 18, 77, 35118 }, // Һ
+    { 17, 20, 17, 0, 20, 85, 35195 }, // һ
+    { 20, 19, 20, 0, 18, 95, 35280 }, // Ҽ
+    { 15, 15, 16, 0, 14, 57, 35375 }, // ҽ
+    { 20, 24, 20, 0, 18, 120, 35432 }, // Ҿ
+    { 15, 19, 16, 0, 14, 72, 35552 }, // ҿ
+    { 8, 18, 9, 1, 18, 36, 35624 }, // Ӏ
+    { 25, 25, 25, 0, 24, 157, 35660 }, // Ӂ
+    { 20, 20, 20, 0, 19, 100, 35817 }, // ӂ
+    { 16, 24, 17, 1, 18, 96, 35917 }, // Ӄ
+    { 14, 20, 15, 0, 14, 70, 36013 }, // ӄ
+    { 18, 24, 19, 0, 18, 108, 36083 }, // Ӆ
+    { 15, 18, 16, 0, 13, 68, 36191 }, // ӆ
+    { 19, 24, 20, 1, 18, 114, 36259 }, // Ӈ
+    { 17, 19, 17, 0, 13, 81, 36373 }, // ӈ
+    { 19, 24, 21, 1, 18, 114, 36454 }, // Ӊ
+    { 17, 18, 17, 0, 13, 77, 36568 }, // ӊ
+    { 17, 24, 18, 0, 18, 102, 36645 }, // Ӌ
+    { 15, 18, 15, 0, 13, 68, 36747 }, // ӌ
+    { 23, 24, 22, 0, 18, 138, 36864 }, // Ӎ
+    { 18, 18, 19, 1, 13, 81, 37002 }, // ӎ
+    { 8, 20, 8, 0, 20, 40, 37083 }, // ӏ
+    { 19, 24, 19, 0, 24, 114, 37123 }, // Ӑ
+    { 13, 20, 14, 1, 19, 65, 37237 }, // ӑ
+    { 19, 23, 19, 0, 23, 110, 37302 }, // Ӓ
+    { 13, 20, 14, 1, 19, 65, 37412 }, // ӓ
+    { 24, 18, 23, -1, 18, 108, 37477 }, // Ӕ
+    { 19, 15, 20, 1, 14, 72, 37585 }, // ӕ
+    { 14, 24, 16, 1, 24, 84, 37657 }, // Ӗ
+    { 11, 20, 13, 1, 19, 55, 37741 }, // ӗ
+    { 15, 19, 17, 1, 18, 72, 37796 }, // Ә
+    { 11, 15, 13, 1, 14, 42, 37868 }, // ә
+    { 15, 24, 17, 1, 23, 90, 37910 }, // Ӛ
+    { 11, 20, 13, 1, 19, 55, 38000 }, // ӛ
+    { 25, 24, 25, 0, 23, 150, 38055 }, // Ӝ
+    { 20, 20, 20, 0, 19, 100, 38205 }, // ӝ
+    { 14, 24, 15, 0, 23, 84, 38305 }, // Ӟ
+    { 11, 20, 12, 0, 19, 55, 38389 }, // ӟ
+    { 14, 19, 14, 0, 18, 67, 38444 }, // Ӡ
+    { 12, 19, 13, 0, 13, 57, 38511 }, // ӡ
+    { 19, 23, 21, 1, 23, 110, 38568 }, // Ӣ
+    { 17, 18, 17, 0, 18, 77, 38678 }, // ӣ
+    { 19, 23, 21, 1, 23, 110, 38755 }, // Ӥ
+    { 17, 19, 17, 0, 19, 81, 38912 }, // ӥ
+    { 18, 24, 19, 1, 23, 108, 38993 }, // Ӧ
+    { 13, 20, 15, 1, 19, 65, 39101 }, // ӧ
+    { 18, 19, 19, 1, 18, 86, 39166 }, // Ө
+    { 13, 15, 15, 1, 14, 49, 39252 }, // ө
+    { 18, 24, 21, 1, 23, 108, 39301 }, // Ӫ
+    { 13, 20, 15, 1, 19, 65, 39409 }, // ӫ
+    { 15, 24, 17, 1, 23, 90, 39474 }, // Ӭ
+    { 12, 20, 13, 0, 19, 60, 39564 }, // ӭ
+    { 18, 24, 18, 0, 23, 108, 39624 }, // Ӯ
+    { 15, 24, 15, 0, 18, 90, 39732 }, // ӯ
+    { 18, 24, 18, 0, 23, 108, 39822 }, // Ӱ
+    { 15, 25, 15, 0, 19, 94, 39930 }, // ӱ
+    { 18, 26, 18, 0, 25, 117, 40024 }, // Ӳ
+    { 15, 27, 15, 0, 21, 102, 40141 }, // ӳ
+    { 17, 23, 18, 0, 23, 98, 40243 }, // Ӵ
+    { 15, 19, 16, 0, 19, 72, 40341 }, // ӵ
+    { 13, 24, 15, 1, 18, 78, 40413 }, // Ӷ
+    { 12, 18, 12, 0, 13, 54, 40491 }, // ӷ
+    { 22, 24, 24, 1, 23, 132, 40545 }, // Ӹ
+    { 20, 20, 20, 0, 19, 100, 40677 }, // ӹ
+    { 14, 24, 15, 0, 18, 84, 40777 }, // Ӻ
+    { 12, 18, 12, 0, 13, 54, 40861 }, // ӻ
+    { 18, 24, 18, 0, 18, 108, 40960 }, // Ӽ
+    { 15, 19, 15, 0, 13, 72, 41068 }, // ӽ
+    { 18, 18, 18, 0, 18, 81, 41140 }, // Ӿ
+    { 15, 13, 15, 0, 13, 49, 41221 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 41270 }, //  
+    { 0, 0, 25, 0, 0, 0, 41270 }, //  
+    { 0, 0, 13, 0, 0, 0, 41270 }, //  
+    { 0, 0, 25, 0, 0, 0, 41270 }, //  
+    { 0, 0, 8, 0, 0, 0, 41270 }, //  
+    { 0, 0, 6, 0, 0, 0, 41270 }, //  
+    { 0, 0, 4, 0, 0, 0, 41270 }, //  
+    { 0, 0, 16, 0, 0, 0, 41270 }, //  
+    { 0, 0, 7, 0, 0, 0, 41270 }, //  
+    { 0, 0, 5, 0, 0, 0, 41270 }, //  
+    { 0, 0, 1, 0, 0, 0, 41270 }, //  
+    { 0, 0, 0, 0, 0, 0, 41270 }, // ​
+    { 2, 21, 0, -1, 15, 11, 41270 }, // ‌
+    { 6, 23, 0, -3, 17, 35, 41281 }, // ‍
+    { 8, 24, 0, -4, 18, 48, 41316 }, // ‎
+    { 8, 24, 0, -4, 18, 48, 41364 }, // ‏
+    { 8, 3, 9, 1, 8, 6, 41412 }, // ‐
+    { 8, 3, 9, 1, 8, 6, 41418 }, // ‑
+    { 12, 3, 16, 2, 10, 9, 41424 }, // ‒
+    { 13, 3, 13, 0, 8, 10, 41433 }, // –
+    { 25, 3, 25, 0, 8, 19, 41443 }, // —
+    { 25, 3, 25, 0, 8, 19, 41462 }, // ―
+    { 8, 26, 13, 2, 20, 52, 41481 }, // ‖
+    { 13, 6, 13, 0, -1, 20, 41533 }, // ‗
+    { 5, 8, 6, 1, 19, 10, 41553 }, // ‘
+    { 5, 8, 6, 0, 19, 10, 41563 }, // ’
+    { 5, 9, 6, 0, 4, 12, 41573 }, // ‚
+    { 5, 8, 6, 1, 19, 10, 41585 }, // ‛
+    { 10, 8, 11, 1, 19, 20, 41595 }, // “
+    { 10, 8, 11, 0, 19, 20, 41615 }, // ”
+    { 10, 9, 11, 0, 4, 23, 41635 }, // „
+    { 10, 8, 11, 1, 19, 20, 41658 }, // ‟
+    { 12, 17, 13, 0, 18, 51, 41678 }, // †
+    { 12, 20, 13, 0, 18, 60, 41729 }, // ‡
+    { 6, 6, 8, 1, 9, 9, 41789 }, // •
+    { 9, 9, 16, 3, 13, 21, 41798 }, // ‣
+    { 5, 4, 7, 1, 3, 5, 41819 }, // ․
+    { 11, 5, 13, 1, 4, 14, 41824 }, // ‥
+    { 21, 5, 25, 2, 4, 27, 41838 }, // …
+    { 5, 4, 7, 1, 9, 5, 41865 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 41870 }, //  
+    { 0, 0, 0, 0, 0, 0, 41870 }, //  
+    { 8, 24, 0, -4, 18, 48, 41870 }, // ‪
+    { 8, 24, 0, -4, 18, 48, 41918 }, // ‫
+    { 8, 24, 0, -4, 18, 48, 41966 }, // ‬
+    { 11, 24, 0, -5, 18, 66, 42014 }, // ‭
+    { 11, 24, 0, -5, 18, 66, 42080 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 42146 }, //  
+    { 32, 21, 34, 1, 19, 168, 42146 }, // ‰
+    { 5, 9, 7, 1, 18, 12, 42314 }, // ′
+    { 10, 9, 11, 1, 18, 23, 42326 }, // ″
+    { 15, 9, 16, 1, 18, 34, 42349 }, // ‴
+    { 6, 9, 7, 0, 18, 14, 42383 }, // ‵
+    { 11, 9, 12, 0, 18, 25, 42397 }, // ‶
+    { 17, 9, 17, 0, 18, 39, 42422 }, // ‷
+    { 11, 6, 12, 1, 0, 17, 42461 }, // ‸
+    { 7, 10, 8, 0, 11, 18, 42478 }, // ‹
+    { 7, 10, 8, 1, 11, 18, 42496 }, // ›
+    { 16, 18, 16, 0, 17, 72, 42514 }, // ※
+    { 11, 20, 14, 2, 19, 55, 42586 }, // ‼
+    { 13, 3, 13, 0, 21, 10, 42641 }, // ‾
+    { 6, 3, 8, 1, 8, 5, 42651 }, // ⁃
+    { 13, 21, 5, -4, 19, 69, 42656 }, // ⁄
+    { 20, 20, 22, 1, 19, 100, 42725 }, // ⁇
+    { 17, 20, 19, 1, 19, 85, 42825 }, // ⁈
+    { 16, 20, 19, 2, 19, 80, 42910 }, // ⁉
+    { 15, 5, 25, 5, 10, 19, 43008 }, // ⁓
+    { 20, 9, 21, 1, 18, 45, 43027 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 43072 }, //  
+    { 0, 0, 0, 0, 0, 0, 43072 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 43072 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 43072 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 43072 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 43072 }, // ⁤
+    { 11, 13, 11, 0, 21, 36, 43072 }, // ⁰
+    { 11, 13, 11, 0, 21, 36, 43108 }, // ⁴
+    { 9, 13, 11, 1, 21, 30, 43144 }, // ⁵
+    { 9, 13, 11, 1, 21, 30, 43174 }, // ⁶
+    { 8, 13, 11, 2, 21, 26, 43204 }, // ⁷
+    { 9, 13, 11, 1, 21, 30, 43230 }, // ⁸
+    { 9, 13, 11, 1, 21, 30, 43260 }, // ⁹
+    { 11, 9, 14, 2, 18, 25, 43290 }, // ⁿ
+    { 11, 12, 11, 0, 8, 33, 43315 }, // ₀
+    { 8, 13, 11, 2, 9, 26, 43348 }, // ₁
+    { 9, 12, 11, 1, 8, 27, 43374 }, // ₂
+    { 9, 12, 11, 1, 8, 27, 43401 }, // ₃
+    { 11, 12, 11, 0, 8, 33, 43428 }, // ₄
+    { 9, 12, 11, 1, 8, 27, 43461 }, // ₅
+    { 9, 12, 11, 1, 8, 27, 43488 }, // ₆
+    { 8, 12, 11, 2, 8, 24, 43515 }, // ₇
+    { 9, 12, 11, 1, 8, 27, 43539 }, // ₈
+    { 9, 12, 11, 1, 8, 27, 43566 }, // ₉
+    { 13, 18, 16, 1, 18, 59, 43593 }, // ₣
+    { 14, 19, 16, 1, 18, 67, 43652 }, // ₤
+    { 31, 19, 31, 0, 18, 148, 43719 }, // ₧
+    { 15, 19, 16, 0, 18, 72, 43867 }, // €
+    { 15, 11, 25, 5, 14, 42, 43939 }, // ←
+    { 11, 17, 25, 7, 17, 47, 43981 }, // ↑
+    { 15, 11, 25, 5, 14, 42, 44028 }, // →
+    { 11, 17, 25, 7, 17, 47, 44070 }, // ↓
+    { 15, 11, 25, 5, 14, 42, 44117 }, // ↔
+    { 11, 17, 25, 7, 17, 47, 44159 }, // ↕
+    { 11, 17, 25, 7, 17, 47, 44206 }, // ↨
+    { 11, 17, 25, 7, 17, 47, 44253 }, // ↲
+    { 11, 17, 25, 7, 17, 47, 44300 }, // ↳
+    { 13, 12, 25, 6, 15, 39, 44347 }, // ↵
+    { 15, 11, 25, 5, 14, 42, 44386 }, // ⇐
+    { 11, 15, 25, 7, 16, 42, 44428 }, // ⇑
+    { 15, 11, 25, 5, 14, 42, 44470 }, // ⇒
+    { 11, 15, 25, 7, 16, 42, 44512 }, // ⇓
+    { 15, 11, 25, 5, 14, 42, 44554 }, // ⇔
+    { 17, 19, 25, 4, 18, 81, 44596 }, // ∀
+    { 13, 21, 16, 1, 20, 69, 44677 }, // ∂
+    { 11, 18, 25, 7, 18, 50, 44746 }, // ∃
+    { 19, 20, 25, 3, 19, 95, 44796 }, // ∅
+    { 16, 18, 16, 0, 18, 72, 44891 }, // ∆
+    { 17, 19, 25, 4, 18, 81, 44963 }, // ∇
+    { 17, 18, 25, 4, 18, 77, 45056 }, // ∈
+    { 17, 22, 25, 4, 19, 94, 45133 }, // ∉
+    { 17, 14, 25, 4, 16, 60, 45227 }, // ∊
+    { 17, 18, 25, 4, 18, 77, 45287 }, // ∋
+    { 17, 22, 25, 4, 19, 94, 45364 }, // ∌
+    { 17, 14, 25, 4, 16, 60, 45458 }, // ∍
+    { 19, 22, 20, 1, 18, 105, 45518 }, // ∏
+    { 15, 23, 15, 0, 18, 87, 45623 }, // ∑
+    { 11, 3, 16, 2, 10, 9, 45710 }, // −
+    { 12, 20, 12, 0, 18, 60, 45719 }, // ∕
+    { 12, 20, 13, 1, 18, 60, 45779 }, // ∖
+    { 12, 13, 16, 2, 15, 39, 45839 }, // ∗
+    { 9, 9, 16, 3, 13, 21, 45878 }, // ∘
+    { 4, 4, 16, 6, 9, 4, 45899 }, // ∙
+    { 16, 24, 16, 0, 21, 96, 45903 }, // √
+    { 13, 10, 16, 1, 13, 33, 45999 }, // ∝
+    { 16, 9, 16, 0, 12, 36, 46032 }, // ∞
+    { 16, 18, 25, 4, 18, 72, 46068 }, // ∟
+    { 18, 18, 25, 3, 18, 81, 46140 }, // ∠
+    { 3, 26, 13, 5, 20, 20, 46221 }, // ∣
+    { 8, 26, 13, 2, 20, 52, 46241 }, // ∥
+    { 17, 18, 25, 4, 18, 77, 46293 }, // ∧
+    { 17, 18, 25, 4, 18, 77, 46370 }, // ∨
+    { 15, 18, 25, 5, 18, 68, 46447 }, // ∩
+    { 15, 19, 25, 5, 18, 72, 46515 }, // ∪
+    { 14, 26, 16, 1, 20, 91, 46587 }, // ∫
+    { 16, 15, 25, 5, 14, 60, 46678 }, // ∴
+    { 16, 15, 25, 5, 14, 60, 46738 }, // ∵
+    { 4, 13, 8, 2, 15, 13, 46798 }, // ∶
+    { 16, 15, 25, 5, 14, 60, 46811 }, // ∷
+    { 15, 5, 25, 5, 10, 19, 46871 }, // ∼
+    { 15, 13, 25, 5, 15, 49, 46890 }, // ≅
+    { 12, 9, 16, 2, 13, 27, 46939 }, // ≈
+    { 15, 8, 25, 5, 11, 30, 46966 }, // ≍
+    { 11, 11, 16, 2, 14, 31, 46996 }, // ≠
+    { 15, 11, 25, 5, 13, 42, 47027 }, // ≡
+    { 12, 15, 16, 2, 15, 45, 47104 }, // ≤
+    { 12, 15, 16, 2, 15, 45, 47149 }, // ≥
+    { 21, 13, 25, 2, 15, 69, 47194 }, // ≪
+    { 21, 13, 25, 2, 15, 69, 47263 }, // ≫
+    { 17, 15, 25, 4, 16, 64, 47332 }, // ⊃
+    { 17, 23, 25, 4, 20, 98, 47396 }, // ⊄
+    { 17, 23, 25, 4, 20, 98, 47494 }, // ⊅
+    { 17, 18, 25, 4, 18, 77, 47592 }, // ⊆
+    { 17, 18, 25, 4, 18, 77, 47669 }, // ⊇
+    { 19, 19, 25, 3, 18, 91, 47746 }, // ⊕
+    { 19, 19, 25, 3, 18, 91, 47837 }, // ⊖
+    { 19, 19, 25, 3, 18, 91, 47928 }, // ⊗
+    { 19, 19, 25, 3, 18, 91, 48019 }, // ⊘
+    { 15, 18, 25, 5, 18, 68, 48110 }, // ⊥
+    { 4, 4, 16, 6, 9, 4, 48178 }, // ⋅
+    { 21, 4, 25, 2, 9, 21, 48182 }, // ⋯
+    { 25, 24, 25, 0, 21, 150, 48203 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_regularIntervals[] = {
@@ -3821,4 +2634,9 @@ static const EpdFontData bookerly_12_regular = {
     27,
     -7,
     true,
+    bookerly_12_regularBlockOffsets,
+    bookerly_12_regularDirectGlyphs,
+    bookerly_12_regularGlyphPages,
+    256,
+    bookerly_12_regularPageGlyphs,
 };
@@ -2,4260 +2,2309 @@
  * generated by fontconvert.py
  * name: bookerly_14_bold
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_14_bold 14 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_14_bold 14 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_boldBitmaps[67950] = {
-    0x1A, 0x4B, 0xF8, 0xFF, 0x8F, 0xF4, 0xFF, 0x4F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xBF,
-    0x0B, 0xF0, 0x7F, 0x07, 0xF0, 0x3F, 0x03, 0xF0, 0x10, 0x00, 0x00, 0x2F, 0x4B, 0xFC, 0xBF, 0xC7,
-    0xFC, 0x15, 0x00, 0x2F, 0x42, 0xE7, 0xF4, 0xFF, 0xBF, 0x0F, 0xEB, 0xF0, 0xFE, 0xBF, 0x0F, 0xEB,
-    0xF0, 0xFE, 0xBF, 0x0F, 0xD7, 0xF0, 0xFD, 0x7E, 0x0F, 0xD1, 0x00, 0x50, 0x00, 0x05, 0x40, 0x15,
-    0x00, 0x00, 0xFD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x2F,
-    0x80, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x5B, 0xF5, 0x7F, 0x54,
-    0x00, 0xBE, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x02, 0xAF, 0xEA,
-    0xFE, 0xA4, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xF0, 0x2F, 0x40, 0x00,
-    0x7F, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFB, 0xFB, 0xFC,
-    0x3F, 0x8B, 0x8B, 0xF0, 0xFD, 0x2E, 0x0F, 0x83, 0xF4, 0xB8, 0x14, 0x0F, 0xF7, 0xE0, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xE0, 0x60, 0x3D, 0x7F, 0xC7, 0xC0, 0xF0, 0xBF, 0x3F, 0x43, 0xC2, 0xFC, 0xFF, 0x0F, 0x0F,
-    0xE2, 0xFF, 0xBE, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x02, 0xD0, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x47, 0xF4,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0xBE, 0x02, 0xF8, 0x07, 0xE0, 0x00,
-    0x0B, 0xE0, 0x2F, 0xC0, 0xFC, 0x00, 0x00, 0xFE, 0x02, 0xF8, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x2F,
-    0x83, 0xF0, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0xBD, 0x07, 0xF9, 0x03, 0xF9, 0xBF, 0x0F, 0xC3, 0xFF,
-    0xF4, 0x1F, 0xFF, 0xC2, 0xF0, 0xBF, 0x6F, 0xC0, 0x2F, 0xD0, 0x7E, 0x0F, 0xC0, 0xFE, 0x00, 0x00,
-    0x0F, 0xC1, 0xFC, 0x0B, 0xE0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x7F, 0x00, 0x00, 0x3F, 0x02, 0xF8,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x0B, 0xD0, 0x00,
-    0x3F, 0x40, 0x0F, 0xD0, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x4B,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0xAA, 0xA4, 0x00, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x7F, 0x8F, 0xF4, 0x0B, 0xE0, 0x03,
-    0xFC, 0x1F, 0xF4, 0x1F, 0x80, 0x0F, 0xF0, 0x2F, 0xF4, 0xBE, 0x00, 0x3F, 0xC0, 0x2F, 0xFA, 0xF4,
-    0x00, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x03, 0xFF, 0x95, 0xBF,
-    0xFF, 0xE4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x96, 0xFF, 0xC0, 0x00, 0x15,
-    0x50, 0x00, 0x54, 0x00, 0x2F, 0x5F, 0xDB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF1, 0xFC, 0x7E, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40,
-    0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00,
-    0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x02, 0xFC, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3F,
-    0x80, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0x80, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xF0,
-    0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xF4, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x2F, 0xE0, 0x02, 0xF8, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xBD, 0x01, 0xD2, 0xF4, 0x0F, 0xDF, 0x80, 0x2F, 0xFD,
-    0xA4, 0x07, 0xFF, 0xE1, 0xBF, 0xEF, 0x4F, 0xEF, 0x44, 0x2E, 0x3F, 0x00, 0x10, 0xFC, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x2A, 0xBF,
-    0xEA, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x01, 0xA4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xF4, 0x0B,
-    0xF0, 0x0F, 0xD0, 0x2F, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0xE7, 0xFF, 0x3F, 0xD0, 0x50, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x0B, 0xFF, 0x00, 0xFF, 0x80, 0x2F, 0xF4,
-    0x0F, 0xF0, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0xC3, 0xFE, 0x00,
-    0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0xC3,
-    0xFE, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0x0F, 0xF4, 0x1F, 0xF4, 0x01,
-    0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x7F, 0xF0, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x06, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xF0, 0x3F, 0xF4, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x2F, 0x80,
-    0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xFA, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0xD0, 0x2F, 0xF0, 0xBD, 0x00, 0x3F, 0xC0, 0xA0, 0x00, 0xFF,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x6F, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0xA5, 0x6F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFF, 0xC2, 0xAB, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xE4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x02, 0xFD, 0xFF, 0x00, 0x00, 0x7F, 0x4F,
-    0xF0, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x1F,
-    0xD0, 0x0F, 0xF0, 0x03, 0xFE, 0xAA, 0xFF, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x0A, 0xAA, 0xBF, 0xFA, 0x90, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xAA, 0xA8, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x6F, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0xAA, 0xFF, 0xFE, 0x03,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0xFF, 0xF4, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFA, 0xA4, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0x7F, 0xF8, 0x7F, 0xC0, 0x0F, 0xFC, 0x7F,
-    0xC0, 0x07, 0xFC, 0x7F, 0xD0, 0x03, 0xFD, 0x3F, 0xD0, 0x03, 0xFC, 0x3F, 0xF0, 0x07, 0xFC, 0x1F,
-    0xF8, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xEA,
-    0xAB, 0xFC, 0xFD, 0x00, 0x2F, 0xD3, 0xF0, 0x01, 0xFF, 0x07, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xBF, 0xF0, 0x0F, 0xF4, 0x0F, 0xF8, 0x1F, 0xE0, 0x07, 0xFC, 0x1F, 0xE0, 0x07, 0xF8, 0x1F, 0xF0,
-    0x0F, 0xF4, 0x0F, 0xFD, 0x2F, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xF9, 0xBF, 0xF4, 0x1F, 0xE0, 0x1F, 0xFC, 0x3F, 0xC0, 0x0B, 0xFC, 0x3F, 0xC0,
-    0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x3F, 0xE0, 0x0B, 0xFC, 0x3F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xF9, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xF4, 0x7F, 0xF4, 0x3F, 0xE0,
-    0x0F, 0xFC, 0x3F, 0xD0, 0x0B, 0xFC, 0x3F, 0xC0, 0x07, 0xFD, 0x3F, 0xD0, 0x03, 0xFD, 0x3F, 0xE0,
-    0x03, 0xFD, 0x2F, 0xF8, 0x03, 0xFD, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x6F,
-    0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0x40, 0x06, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0xE7, 0xFF, 0x3F, 0xD0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC7, 0xFE, 0x7F, 0xF3, 0xFD, 0x05, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xF8, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x40, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xE4, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xE0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x20, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xA8, 0x7F, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x80, 0x06, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x2F, 0xEF, 0xF8, 0x04, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x06, 0xFE, 0x01, 0xBF, 0xFD, 0x07, 0xFF, 0xF8, 0x07, 0xFF,
-    0xD0, 0x07, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x1B, 0xFF,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFD,
-    0x00, 0x6F, 0xD0, 0x03, 0xF8, 0x0F, 0xE0, 0x1F, 0xFF, 0xE0, 0x0B, 0xF0, 0xBF, 0x00, 0xFD, 0x7F,
-    0xC0, 0x1F, 0xC3, 0xF8, 0x07, 0xD0, 0x3F, 0x00, 0x3F, 0x4F, 0xD0, 0x0A, 0x00, 0xFD, 0x00, 0xFD,
-    0x7F, 0x40, 0x00, 0x17, 0xF4, 0x03, 0xF6, 0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0xCB, 0xF0, 0x03,
-    0xFE, 0xBF, 0x40, 0x7F, 0x2F, 0xC0, 0x1F, 0xC0, 0xFD, 0x03, 0xF8, 0xBF, 0x00, 0xBF, 0x03, 0xF4,
-    0x2F, 0xC1, 0xFD, 0x02, 0xFF, 0xBF, 0xFF, 0xFD, 0x03, 0xF8, 0x03, 0xFF, 0xDF, 0xFF, 0xD0, 0x0F,
-    0xF0, 0x03, 0xF8, 0x1B, 0xE4, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1B, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x43, 0xFF, 0x00, 0x00,
-    0x01, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x95, 0x7F, 0xF0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x55, 0x57,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x90,
-    0x00, 0x7F, 0xF9, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x00,
-    0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x6F, 0xF5, 0xBF, 0xF0,
-    0x07, 0xFC, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x2F, 0xD0, 0x1F, 0xF0, 0x0B,
-    0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFC, 0x03, 0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x0B, 0xFC, 0x1F,
-    0xF0, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xC1, 0xBF, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x90, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xAB, 0xFD, 0x0B, 0xFD,
-    0x00, 0x3F, 0x47, 0xFD, 0x00, 0x0F, 0xD3, 0xFF, 0x00, 0x02, 0xF0, 0xFF, 0x40, 0x00, 0x10, 0x7F,
-    0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x5A, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x6F, 0xF9, 0xAF, 0xFF, 0xC0,
-    0x07, 0xFD, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0xBF, 0xE0,
-    0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xD0,
-    0x7F, 0xD0, 0x00, 0x2F, 0xF4, 0x1F, 0xF4, 0x00, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x02, 0xFF, 0x01,
-    0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0x07,
-    0xFD, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x40, 0x6F, 0xF8, 0x01, 0xBF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0xFF, 0xFD,
-    0x07, 0xFD, 0x00, 0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F, 0xD0, 0x00, 0xE0, 0x1F, 0xF4, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x3D, 0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x1B, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0xFC, 0x07, 0xFD, 0x00,
-    0xBC, 0x07, 0xFD, 0x00, 0x78, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x40, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x07, 0xFD, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6A,
-    0xA5, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xAF,
-    0xF0, 0x0B, 0xFE, 0x00, 0x0B, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x03, 0xD0,
-    0x3F, 0xD0, 0x00, 0x01, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xAA, 0xA8, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xD0,
-    0x02, 0xFF, 0xFC, 0xBF, 0xE0, 0x00, 0x0F, 0xF8, 0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFC, 0x00,
-    0x0F, 0xF8, 0x1F, 0xFF, 0x40, 0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x86, 0xFF, 0x80, 0x01,
-    0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xD0,
-    0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F,
-    0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFE, 0x55, 0x56, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x1F,
-    0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00,
-    0x07, 0xFD, 0x01, 0xBF, 0xF8, 0x00, 0x7F, 0xFE, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x06, 0xFF, 0x80, 0x07,
-    0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40,
-    0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0x90, 0x00, 0x1F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F,
-    0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xDF, 0xFF, 0xFD, 0x0F, 0xFF, 0xF0, 0x6F, 0xF4, 0x00,
-    0xFF, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xC0, 0xBF,
-    0x80, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x00, 0x07, 0xFC, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFC,
-    0x00, 0x07, 0xFC, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x3F, 0xFD, 0x01, 0xBF, 0xE4, 0x03, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xF8,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0xB0, 0x1F, 0xF4, 0x00, 0x3E, 0x07, 0xFD, 0x00, 0x2F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x02, 0xFF, 0xF8,
-    0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xEF, 0xF0, 0x0F, 0xEF, 0xE0, 0x00, 0x3F, 0x7F, 0xD0, 0x7E, 0xBF,
-    0x80, 0x00, 0xFD, 0x7F, 0x82, 0xF1, 0xFE, 0x00, 0x03, 0xF0, 0xFF, 0x0F, 0xC7, 0xFC, 0x00, 0x0F,
-    0xC3, 0xFC, 0x7E, 0x1F, 0xF0, 0x00, 0x3F, 0x0B, 0xF6, 0xF4, 0x3F, 0xC0, 0x01, 0xFC, 0x0F, 0xEF,
-    0xC0, 0xFF, 0x00, 0x07, 0xF0, 0x3F, 0xFE, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0xBF, 0xF4, 0x0F, 0xF4,
-    0x00, 0xBF, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x03, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xE0,
-    0x07, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xC0, 0x1F, 0xFE, 0x0F, 0xFF, 0xF0, 0x10, 0x03,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01, 0xBF,
-    0xD0, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFE,
-    0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80, 0x02,
-    0xFC, 0xFF, 0xE0, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC, 0x3F,
-    0x80, 0x02, 0xFC, 0x0B, 0xFF, 0x3F, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC, 0x01,
-    0xFF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02,
-    0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF,
-    0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x6A,
-    0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB,
-    0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00,
-    0x7F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00,
-    0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF4, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x6F, 0xFA,
-    0xFF, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x0F, 0xF4, 0x1F,
-    0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xD6, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xA9, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0xE9,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0xAF, 0xFF,
-    0x40, 0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x07,
-    0xFF, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x4B, 0xFC, 0x00, 0x00,
-    0x2F, 0xF4, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0x4B, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF9, 0x50, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xFA, 0xBF, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x40, 0x01,
-    0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x07,
-    0xFC, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xEF, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC3, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x01, 0xFF,
-    0x00, 0xBF, 0xF0, 0x01, 0xBF, 0xE4, 0x0F, 0xFF, 0x43, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFF, 0x07, 0xFF, 0x5B, 0xFC, 0x3F, 0xE0, 0x07, 0xF0, 0xFF, 0x40, 0x0F, 0xC3,
-    0xFD, 0x00, 0x3D, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD2, 0x80, 0x01,
-    0xFF, 0x9F, 0x80, 0x03, 0xFE, 0x7F, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x7F, 0xC7, 0xFF, 0xAB, 0xFE,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0x40, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09,
-    0x00, 0xFF, 0x80, 0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xF7, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x59, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xC7,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x01, 0xFF,
-    0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x01,
-    0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x03, 0xFF,
-    0x01, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0x80, 0x00, 0x00,
-    0x2F, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x07, 0xF4,
-    0x02, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x0B, 0xF8, 0x02, 0xFF, 0xFD, 0x1F, 0xFF, 0x80, 0x0F, 0xFC,
-    0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFF, 0x40, 0x1F, 0xFD,
-    0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x80, 0x2F, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0x3F, 0xFF,
-    0x00, 0x7F, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xFF,
-    0x80, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0xBD, 0xBF, 0xC0, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0xFC, 0x3F,
-    0xC1, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFC, 0x3F, 0xE2, 0xF8, 0x00, 0x00, 0x0F, 0xF6, 0xF8, 0x2F,
-    0xF3, 0xF4, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x07,
-    0xFF, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xDF, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xE1, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xF4,
-    0x00, 0x2F, 0xE0, 0x01, 0xFF, 0xC0, 0x0B, 0xFE, 0x40, 0x1F, 0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xEB, 0xFF, 0xFE, 0x0B, 0xFF, 0xF4, 0x7F, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x7F, 0xE0, 0x07, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x81, 0xFC,
-    0x00, 0x00, 0x2F, 0xF0, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF,
-    0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0x80, 0x0B, 0xFE, 0x0B, 0xD0, 0x07, 0xFF, 0x01,
-    0xF0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x64, 0x1F, 0xFC, 0x00, 0x3F, 0x0F, 0xFC, 0x00, 0x1F, 0xCB, 0xFE,
-    0x00, 0x0F, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x3F, 0xFE, 0x3F, 0xFD, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40,
-    0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40,
-    0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40,
-    0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0xFD, 0x3F, 0xFE, 0x2A, 0xA8, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x15, 0x00, 0x7F, 0xFA, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0,
-    0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x02,
-    0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x02, 0xFE, 0xFF,
-    0xFB, 0xFF, 0xDA, 0xAA, 0x00, 0x06, 0x90, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF4, 0x1F, 0xC0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x0B, 0xE0,
-    0x0F, 0xD0, 0x07, 0xF0, 0x2F, 0xC0, 0x03, 0xF8, 0x2F, 0x80, 0x02, 0xF8, 0xAA, 0xAA, 0xAA, 0xA7,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0xF0,
-    0x1F, 0xE0, 0x2F, 0xE0, 0x1F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF,
-    0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x05, 0x00,
-    0x00, 0x01, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x02, 0xBF, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x59,
-    0x00, 0x01, 0xFF, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xF8, 0x0F, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x3F,
-    0xF0, 0x1F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x03, 0xFE, 0x01, 0xFF,
-    0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0xAB, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x05, 0x90, 0x00, 0x0F, 0xFF, 0xE0,
-    0x07, 0xFF, 0xFF, 0x81, 0xFF, 0x9F, 0xFC, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC, 0x03, 0xF4, 0xBF, 0x80,
-    0x14, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x65, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x1F, 0xF9, 0x6F, 0xF4, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x0F, 0xF4, 0x0B,
-    0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x80, 0x0F, 0xF4, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0xFF, 0x80, 0x0F,
-    0xF4, 0x0F, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xF4, 0x0B, 0xFF, 0x02, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0xF9, 0x02, 0xFF, 0xFF, 0xBF, 0xFC, 0x0B, 0xFF, 0xC3, 0xFF, 0xC0, 0x05, 0x40, 0x14,
-    0x00, 0x00, 0x06, 0x50, 0x00, 0x1F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F,
-    0xC0, 0x3F, 0xE7, 0xF8, 0x02, 0xFE, 0xBF, 0x80, 0x2F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xF9, 0x55, 0x54, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xD7, 0xFC, 0x00, 0xFF, 0x00,
-    0xF4, 0x01, 0xFF, 0x00, 0x10, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x6B, 0xFF, 0xA9, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x94, 0x16, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xD1, 0xFF, 0x28, 0x0F, 0xF0, 0x0B, 0xF4, 0x00,
-    0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x07, 0xFF, 0xBF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0x40, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xEA, 0xAB, 0xFF, 0x43, 0xFC, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x01, 0xFF, 0x07, 0xFE,
-    0x41, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xAF, 0xA4, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1B,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0x01, 0x64, 0x00, 0x07, 0xFC, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xD0, 0x7F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x80, 0x1F,
-    0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x07, 0xFD, 0x00,
-    0xFF, 0x80, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0,
-    0x07, 0xFD, 0x00, 0xFF, 0xD0, 0xFF, 0xFF, 0x0F, 0xFF, 0xE7, 0xFF, 0xF8, 0x7F, 0xFF, 0x80, 0x00,
-    0x50, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x2F, 0xFE, 0x07, 0xFF, 0xE0, 0x1B, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
-    0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x07, 0xFF, 0x43, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0x05, 0x00, 0x03, 0xFC, 0x00, 0xBF,
-    0xE0, 0x0B, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x07, 0xFF, 0xC0,
-    0xBF, 0xFC, 0x02, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07,
-    0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC,
-    0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x07, 0xFF, 0x07, 0xFF, 0xC0, 0x7F,
-    0xF4, 0x02, 0xE4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xFF, 0xC0, 0x1F,
-    0xF0, 0x7F, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xD0, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x3F,
-    0xC0, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x7F, 0xD0, 0x00,
-    0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x80, 0x01, 0xFF,
-    0x02, 0xFF, 0x80, 0x07, 0xFD, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0x07, 0xFF, 0x87, 0xFF, 0xFC, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x14, 0x02, 0xFF, 0xD0, 0xBF, 0xFD, 0x06, 0xFF, 0xD0,
-    0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03,
-    0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD,
-    0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x07, 0xFE, 0x07, 0xFF, 0xFD, 0xBF, 0xFF, 0xD0,
-    0x00, 0x54, 0x05, 0x90, 0x00, 0x64, 0x00, 0x0B, 0xFF, 0x1F, 0xFF, 0x42, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xFF, 0xFD, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40,
-    0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFC,
-    0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x1F,
-    0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x01, 0xFF, 0x00,
-    0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0xFF,
-    0x80, 0x2F, 0xF0, 0x07, 0xFE, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0x0B, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x54, 0x05, 0x90, 0x00, 0x2F, 0xFC, 0x7F, 0xFD, 0x00, 0x7F, 0xFE,
-    0xFF, 0xFF, 0x40, 0x2B, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
-    0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F,
-    0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0,
-    0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD,
-    0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x54, 0x06, 0x40, 0x03, 0xFF, 0x8F, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0x02, 0xFF, 0x80, 0x7F,
-    0xC0, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x0F, 0xF4, 0x07, 0xFC,
-    0x02, 0xFF, 0x00, 0x7F, 0xFA, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0x07, 0xFD, 0x54, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x2A, 0xAA, 0x90, 0x00, 0x00,
-    0x00, 0x06, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x7F, 0xF6, 0xBF,
-    0xD0, 0x3F, 0xE0, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0xFF, 0x43, 0xFE, 0x00,
-    0x3F, 0xD0, 0xFF, 0x80, 0x0F, 0xF4, 0x3F, 0xE0, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0x42, 0xFF,
-    0x00, 0x3F, 0xD0, 0x7F, 0xF0, 0x7F, 0xF4, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x1F, 0xFE, 0x3F, 0xD0, 0x00, 0x10, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x1A,
-    0xAA, 0xA0, 0x00, 0x54, 0x06, 0x42, 0xFF, 0x87, 0xFC, 0x7F, 0xFC, 0xFF, 0xC2, 0xBF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xEA, 0x80, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1A, 0x50, 0x00, 0xFF, 0xFF,
-    0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFC, 0x3F, 0xC0, 0x2F, 0x0F, 0xF4, 0x06, 0x43, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xF5, 0xF0, 0x03,
-    0xFD, 0xBE, 0x00, 0xBF, 0x6F, 0xE0, 0x7F, 0xC7, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x80, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x1B,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD2, 0xBF, 0xFA, 0xA0, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x01, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F,
-    0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x43,
-    0xFF, 0xE3, 0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0x80,
-    0x0F, 0xFC, 0x01, 0xFC, 0x00, 0x1F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0x40, 0x00, 0xBF,
-    0xC2, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03, 0xFE, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x0B, 0xD0, 0x3F, 0xFF, 0x3F, 0xFF, 0x80, 0xFE, 0x03, 0xFF, 0xD0, 0xFF, 0xC0, 0x0F,
-    0xF0, 0x07, 0xF4, 0x07, 0xFC, 0x02, 0xFF, 0x40, 0xBF, 0x00, 0x3F, 0xD0, 0x3F, 0xF8, 0x0F, 0xE0,
-    0x02, 0xFE, 0x03, 0xFF, 0xC0, 0xFC, 0x00, 0x1F, 0xF0, 0x7E, 0xFC, 0x1F, 0xC0, 0x00, 0xFF, 0x0F,
-    0x9F, 0xD2, 0xF4, 0x00, 0x0B, 0xF4, 0xF4, 0xFE, 0x3F, 0x00, 0x00, 0x3F, 0x9F, 0x0B, 0xF3, 0xE0,
-    0x00, 0x03, 0xFE, 0xF0, 0x7F, 0xBD, 0x00, 0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x7F,
-    0xFD, 0x3F, 0xFF, 0x42, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x01, 0xFF, 0x43, 0xF4, 0x00, 0x07,
-    0xFC, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0B, 0xF1, 0xFF, 0x00, 0x02, 0xFD,
-    0x0F, 0xFC, 0x00, 0xBF, 0x80, 0x3F, 0xF0, 0x3F, 0xFE, 0x0F, 0xFF, 0xEB, 0xFF, 0xE1, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x47, 0xFF, 0xE7, 0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF,
-    0x80, 0x0F, 0xF0, 0x07, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xFC, 0x01, 0xFC, 0x00, 0x1F, 0xF4, 0x0F,
-    0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0x40, 0x00, 0x7F, 0xC2, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00,
-    0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1A, 0xBF, 0xF4, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x0B, 0xFA, 0xBF, 0xF8, 0x2F, 0x00, 0xFF,
-    0xC0, 0xB8, 0x0F, 0xFC, 0x00, 0x40, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0A, 0x02, 0xFF, 0x40, 0x7C, 0x1F, 0xF8, 0x03, 0xF0, 0xFF,
-    0xEA, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0xFF, 0xF0, 0x3F, 0xE9, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00,
-    0x7F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0x03,
-    0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x1B, 0xD0, 0x00, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4,
-    0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD,
-    0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD1, 0x50, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xFC,
-    0x02, 0xBF, 0xE0, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00,
-    0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x03,
-    0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xF0,
-    0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x3F, 0xFD, 0x07, 0xFF, 0x80, 0x2F,
-    0x80, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x2E, 0x3F, 0xFF, 0x47, 0xFF, 0xFB, 0xFF, 0xFE,
-    0xFC, 0x0B, 0xFF, 0xC2, 0x80, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0B, 0xFC, 0xFF, 0xCB,
-    0xFC, 0x2A, 0x00, 0x00, 0x01, 0x02, 0xF8, 0x2F, 0x82, 0xFC, 0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xFC,
-    0x2F, 0xD2, 0xFD, 0x2F, 0xD3, 0xFD, 0x3F, 0xD3, 0xFD, 0x3F, 0xC7, 0xFC, 0x29, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xF5, 0xF2, 0xFC, 0x1F, 0xD1, 0xF0, 0xFC, 0x2F, 0xC1, 0xF0, 0xA0, 0x3F, 0xC1,
-    0xF0, 0x00, 0x3F, 0x81, 0xE0, 0x00, 0x3F, 0x81, 0xE0, 0x00, 0x3F, 0x81, 0xE0, 0x00, 0x3F, 0xC2,
-    0xE0, 0x00, 0x3F, 0xD2, 0xE0, 0x00, 0x2F, 0xF6, 0xE0, 0x18, 0x0F, 0xFF, 0xFB, 0xFC, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x2F, 0xD0,
-    0x0F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x05, 0xBF, 0xD5, 0x50, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x14, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xEF, 0xFF, 0xFF,
-    0x40, 0x64, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x01, 0x50, 0x3C, 0x7F, 0xBF, 0xFE,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xF4, 0x03, 0xFD, 0x7F, 0xD0, 0x07, 0xF0, 0x0F, 0xE0, 0x0B, 0xE0, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x07, 0xE0, 0x0B, 0xF0, 0x0B, 0xE0, 0x07, 0xF4, 0x1F, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFD, 0x3E, 0x1B, 0xE0, 0xBD, 0x18, 0x00, 0x00, 0x14, 0x3F, 0xFF, 0xD0,
-    0xBF, 0xFD, 0x7F, 0xFF, 0xC0, 0xFF, 0xFD, 0x1F, 0xFE, 0x00, 0x6F, 0xF4, 0x03, 0xFE, 0x00, 0x1F,
-    0xC0, 0x02, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0x7F, 0xC0, 0xFD, 0x00,
-    0x00, 0x3F, 0xD1, 0xFC, 0x00, 0x01, 0x6F, 0xF3, 0xF9, 0x40, 0x03, 0xFF, 0xFB, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x55, 0xFF, 0x95, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F,
-    0x4F, 0xD1, 0x50, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0xBE, 0x6F, 0xF0, 0xBD, 0x01, 0xFC,
-    0x3F, 0x00, 0x3D, 0x1F, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xDF, 0xF8, 0x00, 0xF4, 0xFF, 0xD0,
-    0x2E, 0x0B, 0xFE, 0x07, 0xD0, 0x3F, 0xE0, 0xFE, 0x01, 0xFD, 0x1F, 0xF4, 0x0F, 0x81, 0xFF, 0xC2,
-    0xF0, 0x0F, 0xFD, 0x7C, 0x00, 0x7F, 0xEF, 0x00, 0x02, 0xFF, 0x8F, 0x00, 0x2F, 0xDB, 0xD0, 0x07,
-    0xF3, 0xFD, 0x03, 0xF0, 0xBF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x42, 0xF8, 0x7F, 0xC7, 0xFC, 0x7F, 0xC3, 0xFC, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x90, 0x5B, 0xE0, 0x00, 0x0F, 0x80,
-    0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x2E, 0x00, 0xB4, 0x02, 0xFF, 0x40, 0xB4, 0x0F, 0x01,
-    0xFF, 0xFC, 0x03, 0xC2, 0xD0, 0x3F, 0x07, 0xC0, 0x2C, 0x3C, 0x0B, 0xC0, 0x38, 0x01, 0xE3, 0xC0,
-    0xFC, 0x00, 0x00, 0x0E, 0x38, 0x0F, 0xC0, 0x00, 0x00, 0xF3, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0x3C,
-    0x0F, 0xC0, 0x00, 0x00, 0xE3, 0xC0, 0xFE, 0x00, 0x00, 0x1E, 0x2D, 0x07, 0xFE, 0x6C, 0x02, 0xC0,
-    0xE0, 0x2F, 0xFF, 0xC0, 0x3C, 0x0B, 0x40, 0x6F, 0xE0, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF9, 0x01, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x7F, 0xFC, 0x03, 0xF6, 0xF4, 0x0B, 0x43,
-    0xE0, 0x00, 0x1F, 0x80, 0x7F, 0xFE, 0x03, 0xE5, 0xF8, 0x1F, 0x03, 0xE0, 0x7E, 0x7F, 0xF4, 0xFF,
-    0xEF, 0xC0, 0x64, 0x14, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0x41, 0x55, 0x40, 0x00,
-    0x00, 0x0E, 0x00, 0x2C, 0x00, 0x7F, 0x00, 0xFD, 0x02, 0xFD, 0x07, 0xF8, 0x0B, 0xF4, 0x1F, 0xF0,
-    0x3F, 0xE0, 0xBF, 0xC0, 0x3F, 0xC0, 0xFF, 0x40, 0x3F, 0xE0, 0xBF, 0xC0, 0x0F, 0xF4, 0x2F, 0xE0,
-    0x03, 0xFD, 0x0B, 0xF8, 0x00, 0xBF, 0x01, 0xFD, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x47, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0xFD, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x69, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x2E, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x01, 0xD0, 0x0D, 0x3F, 0xF4, 0x2C, 0x0B, 0x07, 0x8F,
-    0x03, 0x83, 0x80, 0xE2, 0xD0, 0xB0, 0xD0, 0x3D, 0xF0, 0x2C, 0x34, 0x0F, 0xF0, 0x0B, 0x0E, 0x03,
-    0xEE, 0x02, 0xC3, 0xC1, 0xF3, 0xE0, 0xE0, 0x70, 0xFE, 0x3D, 0x74, 0x0F, 0x00, 0x00, 0x38, 0x00,
-    0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xEA, 0xF8, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x2F, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xFE, 0x0F, 0xFB, 0xFD,
-    0x7F, 0x02, 0xF9, 0xF4, 0x03, 0xFB, 0xD0, 0x0F, 0xDF, 0xC0, 0xBE, 0x3F, 0xEF, 0xF0, 0x7F, 0xFF,
-    0x40, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD2, 0xAB,
-    0xFE, 0xA9, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x97, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xFF, 0x43, 0xFE, 0xFF, 0x1F, 0xC1, 0xFD,
-    0x3E, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x02, 0xFD, 0x00, 0x2F, 0xC0,
-    0x03, 0xFE, 0xAA, 0x5F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xBF,
-    0xFF, 0x43, 0xF5, 0xFF, 0x0F, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x7F, 0xF8, 0x00,
-    0xEB, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0x1F, 0xFF, 0xF0, 0x3F, 0xFE, 0x00,
-    0x6A, 0x40, 0x00, 0x00, 0x00, 0x78, 0x0F, 0xC2, 0xFC, 0x3F, 0x8B, 0xE0, 0x78, 0x01, 0x00, 0x01,
-    0x50, 0x00, 0x14, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x02,
-    0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0xC0,
-    0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x03, 0xFE,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x00, 0xFF, 0xFF, 0xFB,
-    0xFE, 0x93, 0xFF, 0xFF, 0xCF, 0xFF, 0x4F, 0xFF, 0xFC, 0x1F, 0xF8, 0x3F, 0x85, 0x40, 0x05, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xEF, 0xD0, 0x2F, 0xFF,
-    0xE3, 0xF0, 0x0F, 0xFF, 0xF8, 0xFC, 0x07, 0xFF, 0xFE, 0x3F, 0x01, 0xFF, 0xFF, 0x8F, 0xC0, 0xBF,
-    0xFF, 0xE3, 0xF0, 0x1F, 0xFF, 0xF8, 0xFC, 0x03, 0xFF, 0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x8F, 0xC0,
-    0x0F, 0xFF, 0xE3, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F, 0x8F,
-    0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F,
-    0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFD, 0x7F,
-    0xE7, 0xFE, 0x3F, 0xD0, 0x00, 0x1A, 0x0B, 0xFC, 0x2F, 0xE0, 0xBD, 0x0F, 0xC7, 0xF0, 0x64, 0x00,
-    0x00, 0x1C, 0x00, 0x6F, 0xE0, 0x3F, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x01, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x3F, 0xFF, 0x03, 0xF9, 0xFF, 0x1F, 0x40, 0xFD, 0xBC, 0x02,
-    0xF6, 0xF0, 0x07, 0xDB, 0xD0, 0x2F, 0x5F, 0x80, 0xFC, 0x3F, 0xEF, 0xD0, 0x3F, 0xFE, 0x00, 0x16,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0x40, 0x55, 0x40, 0x00, 0x38, 0x00, 0xB4,
-    0x00, 0xBF, 0x40, 0xFE, 0x00, 0x2F, 0xD0, 0x7F, 0x80, 0x0F, 0xF8, 0x2F, 0xF0, 0x03, 0xFE, 0x0B,
-    0xFC, 0x01, 0xFF, 0x03, 0xFC, 0x03, 0xFE, 0x0B, 0xFC, 0x0B, 0xF8, 0x1F, 0xF0, 0x2F, 0xD0, 0x3F,
-    0x80, 0x7F, 0x40, 0xFE, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xAF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80, 0x0A, 0xD0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x02, 0xFD, 0x00,
-    0x0F, 0xE0, 0x00, 0x7D, 0x00, 0x7F, 0xD0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x0F, 0xFD, 0x01, 0xFF,
-    0xFF, 0x02, 0xF4, 0x03, 0xFB, 0xD0, 0x2F, 0xFF, 0xF0, 0x3F, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x1F, 0x4B, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xE0, 0xBD, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0xFE, 0xAF, 0xE9, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-    0x2A, 0xAF, 0xE9, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x01,
-    0xBF, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xAF,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x3E, 0x02, 0xFF, 0x40, 0x00, 0xFE, 0x00, 0x0F, 0xC1, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xF8,
-    0x3F, 0xEF, 0xF4, 0x00, 0xFE, 0x00, 0x3F, 0x03, 0xF0, 0x3F, 0x81, 0xFF, 0xFF, 0x07, 0xE0, 0x2F,
-    0x03, 0xF4, 0x2F, 0xFF, 0xF0, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xFA, 0xA8, 0x00,
-    0x00, 0xBF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x7E, 0x4F, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0xBF, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0x00, 0x2F, 0x40, 0x0A, 0xD0,
-    0x00, 0x07, 0xF0, 0x03, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0xBC, 0x00, 0x7F, 0xD0, 0x00,
-    0x6F, 0xE0, 0x1F, 0x80, 0x0F, 0xFD, 0x07, 0xFF, 0xFC, 0x03, 0xF0, 0x03, 0xFB, 0xD0, 0x3F, 0xFE,
-    0x00, 0x7E, 0x00, 0xBC, 0xBD, 0x00, 0x54, 0x00, 0x0F, 0xC0, 0x1F, 0x4B, 0xD0, 0x00, 0x00, 0x02,
-    0xF4, 0x03, 0xE0, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0xAF, 0xE9, 0x00, 0x00, 0x0F, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x2A, 0xAF, 0xE9, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x1A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x6F, 0xE0, 0x07,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFE, 0x40, 0x7F, 0x80, 0x00, 0xBD, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x14, 0x1F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFC,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xBF,
-    0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x43, 0xFF, 0x00, 0x00, 0x01, 0xFC,
-    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x95, 0x7F, 0xF0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x55, 0x57, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x90, 0x00, 0x7F,
-    0xF9, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0x43, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0x95, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x7F, 0x55, 0x57, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00,
-    0x0F, 0xF8, 0x01, 0xFF, 0x90, 0x00, 0x7F, 0xF9, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF,
-    0x40, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xD0, 0x00,
-    0x00, 0x0F, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xE5, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xD5, 0x55, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xF4,
-    0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE4, 0x00, 0x1F, 0xFE, 0x4B, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xB0, 0x00,
-    0x00, 0x00, 0xFF, 0xFB, 0xE0, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xD0,
-    0x00, 0x00, 0x0F, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xE5, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xD5, 0x55, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07,
-    0xF4, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE4, 0x00, 0x1F, 0xFE, 0x4B, 0xFF, 0xF4, 0x07, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0x06, 0x80, 0x69, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF7, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x3F,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF9,
-    0x57, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xF5, 0x55, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x80,
-    0x1F, 0xF9, 0x00, 0x07, 0xFF, 0x92, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xCF, 0xFF, 0xF4, 0x07, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0x6F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xDB, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x07,
-    0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x43, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xFC, 0x00, 0x00,
-    0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x95, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x55, 0x57, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x90, 0x00, 0x7F, 0xF9, 0x2F, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFB, 0xFD, 0x00, 0xBE, 0x00, 0x00, 0x02,
-    0xFC, 0xFF, 0x40, 0x1F, 0x40, 0x00, 0x00, 0xFD, 0x3F, 0xD0, 0x02, 0x40, 0x00, 0x00, 0xBF, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xAA,
-    0xA4, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xF9, 0x5B, 0xFE, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x40, 0x01, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7C, 0x00, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0x3F, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x40, 0x1F, 0xC0, 0x7F, 0xD0, 0x01, 0xBF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xAB, 0xFD, 0x0B, 0xFD, 0x00, 0x3F, 0x47, 0xFD, 0x00, 0x0F, 0xD3, 0xFF, 0x00, 0x02, 0xF0,
-    0xFF, 0x40, 0x00, 0x10, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x5A, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x50, 0x00,
-    0x00, 0x06, 0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0xFF,
-    0xFD, 0x07, 0xFD, 0x00, 0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F, 0xD0, 0x00, 0xE0, 0x1F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x3D, 0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0xFF, 0xFD, 0x07, 0xFD, 0x00,
-    0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F, 0xD0, 0x00, 0xE0, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3D,
-    0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x02, 0xFC, 0x07, 0xE0, 0x00, 0x28, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0xBD, 0x07, 0xFD, 0x00, 0x1F, 0x41, 0xFF, 0x40,
-    0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0x55, 0x40, 0x07, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x1F, 0xF4, 0x00, 0x7E, 0x07, 0xFD, 0x00, 0x3F,
-    0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xA4, 0x06,
-    0x80, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x3F, 0xD2, 0xFF, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x50,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x46, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xD0, 0x02, 0xF4, 0x1F, 0xF4, 0x00, 0x7D,
-    0x07, 0xFD, 0x00, 0x0E, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xFA, 0xAA,
-    0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xE5, 0x55, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xD0, 0x7F, 0xD0, 0x01, 0xF8, 0x1F,
-    0xF4, 0x00, 0xFE, 0x1B, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x1B, 0xF8,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x06, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0xFD, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0xC0, 0x2F, 0xF4,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x06, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x0F, 0xD2, 0xFC, 0x3F, 0x80, 0xBD, 0x19,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x06, 0xFF,
-    0x80, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40,
-    0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01,
-    0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x06, 0xFF, 0xE4, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFC, 0x1A, 0x40, 0xA4, 0x3F, 0xC3, 0xFD, 0x7F, 0xC3, 0xFD, 0x3F, 0xC2, 0xFC,
-    0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x06,
-    0xFF, 0x80, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF,
-    0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40,
-    0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x06, 0xFF, 0xE4, 0x3F,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x15, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xF9, 0xAF, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x2F, 0xFE,
-    0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xF4, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x0F,
-    0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0B, 0xFD, 0x7F, 0xFF, 0xFF, 0x40,
-    0xBF, 0xD7, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x00,
-    0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x40,
-    0x07, 0xFE, 0x00, 0x1F, 0xF4, 0x06, 0xFF, 0x80, 0x06, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xAF, 0x00, 0x00,
-    0x00, 0x07, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x83, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01, 0xBF, 0xD0,
-    0x02, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFE, 0x00,
-    0x3F, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80, 0x02, 0xFC,
-    0xFF, 0xE0, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC, 0x3F, 0x80,
-    0x02, 0xFC, 0x0B, 0xFF, 0x3F, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC, 0x01, 0xFF,
-    0xFF, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC,
-    0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x80,
-    0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC,
-    0x07, 0xFD, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x2F, 0xF7,
-    0xFF, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xBF, 0xC7,
-    0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x07,
-    0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x07, 0xFD,
-    0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x7F, 0xD0,
-    0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00,
-    0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFE, 0x00,
-    0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x80,
-    0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x2F, 0x80,
-    0x7E, 0x00, 0x00, 0x02, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA,
-    0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0xAF,
-    0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDF, 0xFC, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x00, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x1F, 0xFE, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFE, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x0E, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0xC0,
-    0x00, 0x00, 0xBE, 0xFF, 0xF0, 0x00, 0x00, 0x0E, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xF0,
-    0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x3F, 0xF1,
-    0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDF,
-    0xFC, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x1F,
-    0xF8, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x1F,
-    0xFE, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFE, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0xA8, 0x00, 0x00,
-    0x0F, 0xF4, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0x00,
-    0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0xBF,
-    0xD0, 0x03, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x0F, 0xF4,
-    0x00, 0x00, 0xFF, 0xC7, 0xFD, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xC0,
-    0x00, 0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x40,
-    0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0xFB, 0xFF, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x08, 0x00, 0x24,
-    0x1F, 0x80, 0x2F, 0x4B, 0xF8, 0x2F, 0xE0, 0xBF, 0xAF, 0xE0, 0x0B, 0xFF, 0xF0, 0x00, 0xBF, 0xF0,
-    0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x1F, 0xF0, 0xFF, 0x4B, 0xF0, 0x0F,
-    0xE0, 0xB0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x40, 0x00, 0x1F,
-    0xFF, 0xFE, 0x0B, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0xD0, 0x02,
-    0xFF, 0x40, 0x0F, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xFC,
-    0x03, 0xFD, 0x00, 0x0B, 0xFF, 0xF0, 0x1F, 0xF4, 0x00, 0xBD, 0xFF, 0xD0, 0xBF, 0xC0, 0x0B, 0xD2,
-    0xFF, 0x42, 0xFF, 0x00, 0xBD, 0x0B, 0xFD, 0x0F, 0xFC, 0x0B, 0xD0, 0x1F, 0xF4, 0x3F, 0xF0, 0xBD,
-    0x00, 0xBF, 0xD0, 0xBF, 0xDB, 0xD0, 0x02, 0xFF, 0x02, 0xFF, 0xFD, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
-    0xD0, 0x00, 0x3F, 0xD0, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xF4, 0x00,
-    0xBF, 0xFF, 0xEF, 0xFF, 0x40, 0x0B, 0xEF, 0xFF, 0xFF, 0xF4, 0x00, 0x3C, 0x1B, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xF7, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x59, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF,
-    0x40, 0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0A,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF4, 0x1F, 0xFF, 0xFD, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xD1, 0xBF, 0xF4, 0x00, 0x5F, 0xF8,
-    0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x0B, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x1A, 0x00, 0x00, 0x00, 0x2F,
-    0xE1, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xF4, 0x6F, 0xFD, 0x00, 0x17,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xF4, 0x02,
-    0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xEB, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xF4, 0x7F, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xE0,
-    0x07, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0xFD, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x07, 0xFD, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xF4, 0x6F, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x0F,
-    0xFC, 0x1F, 0xF0, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0xBF, 0xC0, 0x7F, 0xD5,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFE, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x7F, 0xE0, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0x00,
-    0x3F, 0xC0, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0x7F, 0xC2, 0xFC, 0x00,
-    0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x3F, 0xF4, 0x00, 0x1F, 0xF0, 0xBF, 0xF8, 0x00, 0x7F,
-    0xC0, 0xFF, 0xF8, 0x01, 0xFF, 0x00, 0xBF, 0xF8, 0x07, 0xFC, 0x00, 0xBF, 0xF0, 0x1F, 0xF0, 0x00,
-    0x7F, 0xD0, 0x7F, 0xC2, 0x40, 0xFF, 0x41, 0xFF, 0x2E, 0x03, 0xFC, 0x0B, 0xFC, 0xFE, 0x2F, 0xE1,
-    0xFF, 0xF3, 0xFF, 0xFF, 0x0B, 0xFF, 0xC3, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5,
-    0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80,
-    0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE,
-    0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40,
-    0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB,
-    0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x03, 0xF0,
-    0xFD, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x02, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
-    0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80,
-    0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80,
-    0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50,
-    0x01, 0x40, 0x01, 0xA4, 0x18, 0x00, 0x07, 0xFD, 0x2E, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0x4B,
-    0xFC, 0x00, 0x02, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
-    0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80,
-    0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80,
-    0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xBE, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x1F, 0xF0,
-    0xFF, 0x00, 0x0B, 0x80, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
-    0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80,
-    0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80,
-    0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x03, 0xE0,
-    0xF8, 0x00, 0x03, 0xD0, 0xB8, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0,
-    0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x16, 0x40, 0x05, 0x90, 0x00,
-    0x2F, 0xFF, 0x87, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0x5F, 0xFF, 0x57, 0xFD,
-    0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0xF3, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0x95, 0xAF,
-    0xF0, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFA, 0x92, 0xFF, 0xEB, 0xF8, 0x00,
-    0x00, 0x7F, 0xD0, 0x7F, 0x80, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF4,
-    0x00, 0x5B, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xD1, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xF4, 0x01, 0x54, 0x00, 0x05, 0x50, 0x00, 0x00, 0x05, 0x90, 0x00, 0x0F, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0x81, 0xFF, 0x9F, 0xFC, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC, 0x03, 0xF4, 0xBF, 0x80, 0x14,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F,
-    0xEB, 0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x55, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xEF, 0xC0,
-    0x01, 0xF8, 0x7E, 0x00, 0x3F, 0x02, 0xF0, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x50, 0x00, 0x1F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7,
-    0xF8, 0x02, 0xFE, 0xBF, 0x80, 0x2F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55,
-    0x54, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07,
-    0xF0, 0x0F, 0xF4, 0xFF, 0x80, 0xFF, 0x4B, 0xF4, 0x02, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF5, 0xBF,
-    0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x04,
-    0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x2F, 0x80, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFE, 0x07, 0xFF, 0xE0, 0x1B, 0xFE, 0x00, 0x3F,
-    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
-    0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x43, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFE, 0x07, 0xFF, 0xE0, 0x1B, 0xFE, 0x00, 0x3F, 0xE0,
-    0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03,
-    0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x43, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0x14, 0x00, 0x07,
-    0xF4, 0x00, 0x3F, 0xF4, 0x02, 0xFB, 0xF0, 0x1F, 0x87, 0xE0, 0xFC, 0x0B, 0xC1, 0x80, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0xBF, 0xF8, 0x07, 0xFF, 0xE0, 0x06, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x1F, 0xFD, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-    0x01, 0xFC, 0x1F, 0xCF, 0xF4, 0xFF, 0x7F, 0xD3, 0xFD, 0x6D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xF8, 0x01, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03,
-    0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x0F, 0x00, 0x00, 0xBF, 0xBE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x05,
-    0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0xBF, 0xFC, 0x3F, 0xE0,
-    0x1F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0,
-    0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xD0, 0x0B, 0xFC, 0x7F, 0xF0,
-    0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x06, 0xD0, 0x20, 0x00, 0x00, 0x1F, 0xF8, 0xB8, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x2E, 0x2F, 0xF4, 0x00, 0x00, 0x08, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x05, 0x90, 0x00, 0x2F, 0xFC, 0x7F, 0xFD, 0x00, 0x7F,
-    0xFE, 0xFF, 0xFF, 0x40, 0x2B, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE,
-    0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F,
-    0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B,
-    0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF,
-    0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B,
-    0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0x80, 0x00, 0x90, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x69, 0x05, 0x00, 0x02, 0xFF, 0x4F,
-    0x40, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xD3, 0xFF, 0x00, 0x00, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F,
-    0x80, 0x07, 0xFC, 0x7F, 0xC0, 0x07, 0xFC, 0x7F, 0xC0, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x1F,
-    0xFF, 0xF9, 0xD0, 0x1F, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x7F, 0xF8, 0x0F, 0xF4, 0x03, 0xFF, 0x07,
-    0xFC, 0x02, 0xFF, 0xC2, 0xFE, 0x02, 0xFF, 0xF4, 0xFF, 0x82, 0xF7, 0xFD, 0x3F, 0xE2, 0xF4, 0xFF,
-    0x4F, 0xFA, 0xF4, 0x3F, 0xD3, 0xFF, 0xF4, 0x0F, 0xF0, 0xBF, 0xF4, 0x07, 0xFC, 0x1F, 0xFC, 0x03,
-    0xFD, 0x03, 0xFF, 0xD7, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xF6, 0xFF, 0xFD, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F,
-    0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8,
-    0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF,
-    0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE,
-    0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC,
-    0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x1F, 0x87, 0xF0, 0x00,
-    0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x18, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC,
-    0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00,
-    0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0xFF,
-    0x4B, 0xF8, 0x00, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF,
-    0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x1F, 0xFF,
-    0x9F, 0xFF, 0xF0, 0x3F, 0xFD, 0x0F, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0xFE, 0x00, 0x3F,
-    0xF0, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0xFD, 0x00, 0x01, 0xFF, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x6A, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x64, 0x00, 0x07, 0xFD, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xE0, 0x2F, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x7F,
-    0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x7F, 0xC0, 0x0B, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x2F, 0xF0, 0x07, 0xFF,
-    0xAF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xD5, 0x40, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x2F, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x79,
-    0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xD1, 0xFF, 0xF9, 0xFF, 0xFF, 0x03, 0xFF, 0xD0, 0xFF, 0xE0, 0x03, 0xFC, 0x01,
-    0xFF, 0x80, 0x0F, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x07, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xF8,
-    0x0F, 0xD0, 0x00, 0x1F, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x00, 0xBF, 0x9F, 0xC0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x06, 0xAF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xD0, 0x00, 0x00, 0xFE, 0x55, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFD, 0x55,
-    0x5F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xE0, 0x07, 0xFE,
-    0x40, 0x01, 0xFF, 0xE4, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xF3, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0,
-    0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0xFE, 0x57, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xF0, 0x00, 0x00, 0x01,
-    0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xE5, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xD5, 0x55, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x02,
-    0xFF, 0x40, 0x07, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE4, 0x00, 0x1F, 0xFE, 0x4B, 0xFF, 0xF4,
-    0x07, 0xFF, 0xFF, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0E,
-    0x00, 0x0F, 0xE4, 0x7E, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F,
-    0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x43,
-    0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0x95, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x7F, 0x55, 0x57, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF8,
-    0x01, 0xFF, 0x90, 0x00, 0x7F, 0xF9, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x7F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40,
-    0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB,
-    0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0x90, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xAB, 0xFD, 0x0B, 0xFD, 0x00, 0x3F, 0x47, 0xFD, 0x00,
-    0x0F, 0xD3, 0xFF, 0x00, 0x02, 0xF0, 0xFF, 0x40, 0x00, 0x10, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x07, 0xFF, 0xF9, 0x5A, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8,
-    0x1F, 0xF9, 0xFF, 0xC3, 0xFD, 0x03, 0xFC, 0x7F, 0xC0, 0x3F, 0x4B, 0xF8, 0x01, 0x40, 0xFF, 0x80,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07,
-    0xFF, 0x80, 0x08, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFE, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
-    0x4B, 0xF0, 0x00, 0x3F, 0x40, 0xBC, 0x00, 0x06, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFE, 0xAF, 0xF4,
-    0x2F, 0xF4, 0x00, 0xFD, 0x1F, 0xF4, 0x00, 0x3F, 0x4F, 0xFC, 0x00, 0x0B, 0xC3, 0xFD, 0x00, 0x00,
-    0x41, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE5, 0x6B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xEF, 0xC0, 0x01, 0xF8, 0x7E, 0x00, 0x3F,
-    0x02, 0xF0, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00, 0x0F, 0xFF, 0xE0,
-    0x07, 0xFF, 0xFF, 0x81, 0xFF, 0x9F, 0xFC, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC, 0x03, 0xF4, 0xBF, 0x80,
-    0x14, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFE, 0xAF, 0xF4, 0x2F, 0xF4, 0x00, 0xFD, 0x1F, 0xF4, 0x00, 0x3F, 0x4F, 0xFC, 0x00, 0x0B,
-    0xC3, 0xFD, 0x00, 0x00, 0x41, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE5, 0x6B, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x0A, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x1B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xF8, 0x1F, 0xF9, 0xFF, 0xC3, 0xFD, 0x03, 0xFC, 0x7F, 0xC0, 0x3F, 0x4B, 0xF8,
-    0x01, 0x40, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x08, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFE, 0x00, 0x01, 0x55, 0x00, 0x00, 0x28, 0x00, 0x78, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x03, 0xFC,
-    0x7F, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFE, 0xAF, 0xF4, 0x2F, 0xF4, 0x00, 0xFD, 0x1F, 0xF4, 0x00, 0x3F, 0x4F, 0xFC, 0x00, 0x0B,
-    0xC3, 0xFD, 0x00, 0x00, 0x41, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE5, 0x6B, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x02, 0x40, 0x1D, 0x00, 0xBD, 0x07, 0xE0, 0x07, 0xF0, 0xFC, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90,
-    0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0x9F, 0xFC, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC,
-    0x03, 0xF4, 0xBF, 0x80, 0x14, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0xB0, 0x01, 0xF0, 0x00, 0x00, 0x3F,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xBF, 0xE6,
-    0xBF, 0xFF, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x1F, 0xFD, 0x01, 0xFF, 0x40,
-    0x02, 0xFF, 0x80, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x07, 0xFD, 0x00,
-    0x02, 0xFF, 0x41, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x1F, 0xF4, 0x00,
-    0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x7F, 0xD0, 0x00,
-    0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x7F, 0xE0, 0x07, 0xFD, 0x01, 0xBF, 0xE0, 0x06, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x02, 0xFF, 0xF4,
-    0x3E, 0x00, 0x01, 0xBF, 0xF4, 0x7D, 0x00, 0x00, 0x0F, 0xF4, 0x7C, 0x00, 0x00, 0x0F, 0xF4, 0xB8,
-    0x00, 0x00, 0x0F, 0xF4, 0xB4, 0x00, 0x06, 0x5F, 0xF4, 0x10, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xF9, 0x6F, 0xF4, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x0F,
-    0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xF4,
-    0x00, 0xBF, 0xF0, 0x2F, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x2F, 0xFF, 0xFB, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x54, 0x01, 0x40, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xF9, 0xAF, 0xFF, 0xC0,
-    0x01, 0xFF, 0x40, 0x2F, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xF4, 0x01, 0xFF, 0x40, 0x02, 0xFF,
-    0x80, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0B,
-    0xFD, 0x7F, 0xFF, 0xFF, 0x40, 0xBF, 0xD7, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x01, 0xFF, 0x40, 0x00,
-    0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x00,
-    0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x1F, 0xF4, 0x06, 0xFF, 0x80, 0x06, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x6B, 0xEF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x40, 0x7F, 0xD0, 0x0F, 0xF4, 0x0B, 0xFC, 0x00,
-    0xFF, 0x40, 0xFF, 0x80, 0x0F, 0xF4, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0xFF, 0x80, 0x0F, 0xF4, 0x0F,
-    0xFC, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xF4, 0x0B, 0xFF, 0x02, 0xFF, 0x40, 0x3F, 0xFF, 0xFF,
-    0xF9, 0x02, 0xFF, 0xFF, 0xBF, 0xFC, 0x0B, 0xFF, 0xC3, 0xFF, 0xC0, 0x05, 0x40, 0x14, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x1B, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0x40, 0x0B, 0xD0, 0x7F, 0xD0, 0x01, 0xF4, 0x1F, 0xF4,
-    0x00, 0x38, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x00, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x95, 0x54, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0x41, 0xFF, 0x40, 0x07, 0xE0, 0x7F, 0xD0, 0x03,
-    0xF8, 0x6F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03,
-    0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF,
-    0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x70, 0x00, 0x1F, 0xD1, 0xBC, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0xBD, 0x07, 0xFD,
-    0x00, 0x1F, 0x41, 0xFF, 0x40, 0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07,
-    0xFE, 0xAA, 0xA0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0x55, 0x40,
-    0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x1F, 0xF4, 0x00,
-    0x7E, 0x07, 0xFD, 0x00, 0x3F, 0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x70, 0x07, 0xF4, 0x2F, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB,
-    0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0xBD, 0x07, 0xFD, 0x00, 0x1F, 0x41, 0xFF, 0x40,
-    0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0x55, 0x40, 0x07, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x1F, 0xF4, 0x00, 0x7E, 0x07, 0xFD, 0x00, 0x3F,
-    0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0x40,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8,
-    0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07,
-    0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF,
-    0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F, 0xD0, 0x00, 0xE0, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x3D, 0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x50, 0x00, 0x1F, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7, 0xF8, 0x02, 0xFE, 0xBF, 0x80, 0x2F,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55, 0x54, 0xFF, 0x40, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0,
-    0x00, 0x05, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x03, 0xD0, 0x00, 0xFC, 0x03,
-    0xF4, 0x00, 0x1F, 0xD3, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0xBD, 0x07, 0xFD, 0x00, 0x1F,
-    0x41, 0xFF, 0x40, 0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0xAA,
-    0xA0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0x55, 0x40, 0x07, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x1F, 0xF4, 0x00, 0x7E, 0x07,
-    0xFD, 0x00, 0x3F, 0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x01, 0x80, 0x1D, 0x00, 0x7D, 0x07, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x1F, 0xEF, 0x40, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00,
-    0x1F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7, 0xF8, 0x02,
-    0xFE, 0xBF, 0x80, 0x2F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55, 0x54, 0xFF,
-    0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x3F,
-    0x00, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA5, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xAF, 0xF0, 0x0B,
-    0xFE, 0x00, 0x0B, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x03, 0xD0, 0x3F, 0xD0,
-    0x00, 0x01, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x02, 0xAA, 0xA8, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xD0, 0x02, 0xFF,
-    0xFC, 0xBF, 0xE0, 0x00, 0x0F, 0xF8, 0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFC, 0x00, 0x0F, 0xF8,
-    0x1F, 0xFF, 0x40, 0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00,
-    0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x16, 0x40, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xD1, 0xFF, 0x28, 0x0F,
-    0xF0, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0xFF,
-    0x40, 0x07, 0xFF, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0x40, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xEA, 0xAB, 0xFF, 0x43, 0xFC, 0x00, 0x0F, 0xF4, 0x7F, 0xC0,
-    0x01, 0xFF, 0x07, 0xFE, 0x41, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x01, 0xAF, 0xA4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x0E, 0x00, 0x00,
-    0x0F, 0xE5, 0xBE, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA5, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xAF, 0xF0, 0x0B, 0xFE, 0x00, 0x0B,
-    0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x03, 0xD0, 0x3F, 0xD0, 0x00, 0x01, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x02, 0xAA, 0xA8, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xD0, 0x02, 0xFF, 0xFC, 0xBF, 0xE0,
-    0x00, 0x0F, 0xF8, 0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0x40,
-    0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1C, 0x00, 0x02,
-    0xFD, 0x0B, 0xC0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x41, 0x64, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x1F, 0xF2, 0x80, 0xFF, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x07, 0xF8,
-    0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFE, 0xA4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xAA,
-    0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x1F, 0xF0, 0x7F, 0xE4, 0x1B, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xA5, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFA, 0xAF, 0xF0, 0x0B, 0xFE, 0x00, 0x0B, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xF0, 0x2F, 0xF0,
-    0x00, 0x03, 0xD0, 0x3F, 0xD0, 0x00, 0x01, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xAA, 0xA8, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFC, 0xBF, 0xD0, 0x02, 0xFF, 0xFC, 0xBF, 0xE0, 0x00, 0x0F, 0xF8, 0x7F, 0xF0, 0x00, 0x0F, 0xF8,
-    0x3F, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0x40, 0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
-    0x41, 0x64, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x1F, 0xF2, 0x80,
-    0xFF, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xF4, 0x0F,
-    0xF4, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xA4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xAA, 0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFF, 0x47, 0xFC,
-    0x00, 0x1F, 0xF0, 0x7F, 0xE4, 0x1B, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x6A, 0xA5, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xAF, 0xF0, 0x0B, 0xFE, 0x00, 0x0B, 0xF0, 0x1F, 0xF8,
-    0x00, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x03, 0xD0, 0x3F, 0xD0, 0x00, 0x01, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xAA,
-    0xA8, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xD0, 0x02, 0xFF, 0xFC, 0xBF, 0xE0, 0x00, 0x0F, 0xF8,
-    0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0x40, 0x0F, 0xF8, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x41, 0x64, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x1F, 0xF2,
-    0x80, 0xFF, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xF4,
-    0x0F, 0xF4, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xA4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xAA, 0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFF, 0x47,
-    0xFC, 0x00, 0x1F, 0xF0, 0x7F, 0xE4, 0x1B, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF0,
-    0x1F, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE1,
-    0xBF, 0xE0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF,
-    0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00,
-    0x7F, 0xD0, 0x07, 0xFE, 0xAA, 0xAB, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x95, 0x55, 0xBF, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F,
-    0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0,
-    0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x6F, 0xFE, 0x00, 0x1F, 0xFF, 0x8F, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x01,
-    0x64, 0x00, 0x01, 0xFF, 0x2F, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xD0, 0x7F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0,
-    0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01,
-    0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF,
-    0x40, 0x3F, 0xF4, 0x0F, 0xFF, 0xF0, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0,
-    0x1B, 0xFE, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x0A, 0xBF, 0xEA, 0xAA,
-    0xBF, 0xFA, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x5B, 0xFE, 0x55, 0x56, 0xFF, 0x54, 0x01,
-    0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xEA, 0xAA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x95, 0x55, 0xBF, 0xD0, 0x00, 0x7F,
-    0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF,
-    0x40, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x6F, 0xFE,
-    0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1A,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x1B, 0xE0, 0x00, 0x1F, 0xF7, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFA, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0x1F,
-    0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x07, 0xFD, 0x00,
-    0xFF, 0x80, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0,
-    0x07, 0xFD, 0x00, 0xFF, 0xD0, 0xFF, 0xFF, 0x0F, 0xFF, 0xE7, 0xFF, 0xF8, 0x7F, 0xFF, 0x80, 0x01,
-    0x00, 0x00, 0xFF, 0x47, 0x4B, 0xFF, 0xBF, 0x3F, 0xBF, 0xF8, 0x74, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC1, 0xBF, 0xE0, 0x01, 0xFF, 0x40,
-    0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF,
-    0x40, 0x07, 0xFD, 0x00, 0x6F, 0xFE, 0x4F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x0B, 0x80, 0x80, 0xFF,
-    0xC7, 0xC7, 0xFF, 0xFF, 0x1F, 0x1F, 0xF8, 0x14, 0x1B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xF8, 0x01, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE2, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xFC, 0x1B, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00,
-    0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0,
-    0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x06, 0xFF, 0xE4, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x02, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x1B, 0xFE, 0x00, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xF4, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x10, 0x00,
-    0x01, 0xE0, 0x03, 0xCB, 0xF4, 0x7F, 0x1F, 0xFF, 0xF4, 0x1F, 0xFF, 0x40, 0x06, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC1, 0xBF, 0xE0, 0x01, 0xFF, 0x40, 0x07,
-    0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40,
-    0x07, 0xFD, 0x00, 0x6F, 0xFE, 0x4F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x01,
-    0xCB, 0xF4, 0x2F, 0x0F, 0xFF, 0xF4, 0x0F, 0xFF, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xF8, 0x01, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F,
-    0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00,
-    0xFF, 0x80, 0x07, 0xFF, 0x40, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0x06, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF,
-    0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x3F,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0xFF, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xF0,
-    0x01, 0xFF, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2F, 0xFE,
-    0x01, 0xFF, 0xF8, 0x01, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x07,
-    0xFF, 0x40, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00,
-    0x0F, 0xE0, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC1, 0xBF, 0xE0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00,
-    0x6F, 0xFE, 0x4F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x00, 0x14, 0x02, 0xFF, 0xE0, 0x7F, 0xFE, 0x01,
-    0xBF, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x7F, 0xF4, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0x06, 0xFF, 0x80, 0x07, 0xFF, 0x90, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x07, 0xFD,
-    0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x40, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x07,
-    0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x00, 0x7F, 0xC0, 0x3F, 0xFF, 0xFC,
-    0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05,
-    0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x07, 0xFE, 0x02, 0xFD,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x14,
-    0x2F, 0xFE, 0x02, 0xFF, 0xE7, 0xFF, 0xE0, 0x7F, 0xFE, 0x1B, 0xFE, 0x01, 0xBF, 0xE0, 0x3F, 0xE0,
-    0x03, 0xFE, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
-    0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFE, 0x00,
-    0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFE, 0x07, 0xFF, 0x40, 0x3F, 0xD3, 0xFF, 0xFE, 0x03, 0xFD, 0x3F,
-    0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x01, 0xE8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xD3,
-    0xF8, 0x03, 0xF4, 0x0F, 0xC0, 0x19, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x01, 0xBF, 0xF9, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x01,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x7F, 0xF0, 0x00, 0xFE, 0xF8, 0x02, 0xF0, 0xFD, 0x07, 0xD0, 0x3E, 0x02, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x07, 0xFF, 0xC0, 0x0B, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0x7F, 0xFC,
-    0x00, 0x7F, 0xF4, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xDF, 0xFF, 0xFD, 0x0F, 0xFF, 0xF0, 0x6F, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x00, 0x1F, 0xF0, 0xBF, 0x80,
-    0x00, 0x07, 0xFC, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0x1F, 0xFC, 0x00,
-    0x00, 0x7F, 0xC1, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0xC0,
-    0x01, 0xFF, 0x00, 0x3F, 0xFD, 0x01, 0xBF, 0xE4, 0x03, 0xFF, 0xD3, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xFF, 0xC0, 0x1F, 0xF0, 0x7F, 0xFF, 0x00,
-    0x7F, 0xC0, 0x7F, 0xD0, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x1F, 0xF7,
-    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x7F, 0xD0, 0x00, 0x07, 0xFC, 0xBF, 0xC0,
-    0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x80, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x07,
-    0xFD, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0x07, 0xFF, 0x87, 0xFF, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x3F, 0xFF, 0x47, 0xFF, 0xE0,
-    0xFF, 0xFD, 0x06, 0xFF, 0x80, 0xFF, 0x80, 0x03, 0xFE, 0x0B, 0xF4, 0x00, 0x0F, 0xF8, 0x7F, 0x40,
-    0x00, 0x3F, 0xE7, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F,
-    0xF9, 0xFF, 0x40, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x03, 0xFE, 0x07,
-    0xFF, 0x00, 0x0F, 0xF8, 0x0F, 0xFF, 0x02, 0xFF, 0xFD, 0x0F, 0xFF, 0x0F, 0xFF, 0xF4, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xB0, 0x1F, 0xF4, 0x00, 0x3E, 0x07, 0xFD, 0x00, 0x2F, 0x81,
-    0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x01, 0x40, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x1F, 0xF9, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFD, 0x0B, 0xFF, 0xD0, 0x6F, 0xFD, 0x00, 0x3F, 0xD0, 0x03,
-    0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD,
-    0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00,
-    0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x7F, 0xE0, 0x7F, 0xFF, 0xDB, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xB0, 0x1F, 0xF4, 0x00, 0x3E,
-    0x07, 0xFD, 0x00, 0x2F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0xFF, 0xD0, 0xBF, 0xFD, 0x06,
-    0xFF, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F,
-    0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0,
-    0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x07, 0xFE, 0x07, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x0F, 0xD0, 0x01, 0xFC,
-    0x00, 0x3F, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC3, 0xFF, 0xFF, 0xC3, 0xF0, 0xFF, 0xFF, 0xE0, 0xF4, 0x06, 0xFF, 0x80, 0x3C, 0x00,
-    0x7F, 0xD0, 0x0E, 0x00, 0x1F, 0xF4, 0x01, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0x01, 0xFF,
-    0x40, 0x03, 0xE0, 0x7F, 0xD0, 0x02, 0xF8, 0x1F, 0xF4, 0x00, 0xFE, 0x1B, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x14, 0x05, 0x0B, 0xFF, 0x43, 0xEB, 0xFF,
-    0xD1, 0xF9, 0xBF, 0xF4, 0x7D, 0x03, 0xFD, 0x2F, 0x00, 0xFF, 0x4B, 0x80, 0x3F, 0xD2, 0xC0, 0x0F,
-    0xF4, 0x10, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x6F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x1F, 0xF4, 0x01, 0xF8, 0x07, 0xFD, 0x01, 0xFF, 0x41, 0xFF, 0x40, 0x7F, 0xD0, 0x7F, 0xD0,
-    0x0F, 0xF0, 0x1F, 0xF4, 0x01, 0xA0, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0xB0, 0x1F, 0xF4, 0x00, 0x3E, 0x07, 0xFD, 0x00, 0x2F, 0x81, 0xFF, 0x40, 0x0F, 0xE1,
-    0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x02, 0xF4, 0x03, 0xFD, 0x07, 0xFC, 0x03, 0xFD, 0x0B,
-    0xFC, 0x03, 0xFD, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x50, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x68, 0x00, 0x00,
-    0x7F, 0xEF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xB9, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0B,
-    0x00, 0x1F, 0xF4, 0x00, 0x3E, 0x00, 0x7F, 0xD0, 0x02, 0xF8, 0x01, 0xFF, 0x40, 0x0F, 0xE0, 0x1B,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0x00,
-    0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0x40, 0x1B, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x64, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFF,
-    0x80, 0x02, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x3F, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01, 0xBF, 0xD0, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0x80,
-    0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFE, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFF, 0x40,
-    0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80, 0x02, 0xFC, 0xFF, 0xE0, 0x3F, 0x80, 0x02, 0xFC,
-    0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x0B, 0xFF, 0x3F, 0x80,
-    0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0xBF,
-    0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE,
-    0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x05, 0x90, 0x00, 0x2F, 0xFC, 0x7F, 0xFD, 0x00, 0x7F, 0xFE, 0xFF,
-    0xFF, 0x40, 0x2B, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0xBF,
-    0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0,
-    0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03,
-    0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01, 0xBF, 0xD0, 0x02, 0xFF, 0xF4, 0x00, 0x3F,
-    0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFE, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFF,
-    0x40, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80, 0x02, 0xFC, 0xFF, 0xE0, 0x3F, 0x80, 0x02,
-    0xFC, 0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x0B, 0xFF, 0x3F,
-    0x80, 0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFC, 0x00,
-    0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x07,
-    0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x05, 0x90, 0x00, 0x2F, 0xFC, 0x7F, 0xFD, 0x00, 0x7F, 0xFE, 0xFF, 0xFF, 0x40,
-    0x2B, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x03,
-    0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE,
-    0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF4, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01, 0xBF, 0xD0, 0x02, 0xFF, 0xF4, 0x00, 0x3F,
-    0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFE, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFF,
-    0x40, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80, 0x02, 0xFC, 0xFF, 0xE0, 0x3F, 0x80, 0x02,
-    0xFC, 0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x0B, 0xFF, 0x3F,
-    0x80, 0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFC, 0x00,
-    0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x07,
-    0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x09, 0x00, 0xA4, 0x00, 0x00, 0x2F, 0x02, 0xF4,
-    0x00, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x05, 0x90, 0x00, 0x2F, 0xFC, 0x7F, 0xFD, 0x00, 0x7F, 0xFE, 0xFF, 0xFF, 0x40, 0x2B, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F,
-    0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0,
-    0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x15, 0x01, 0x64, 0x00, 0x0F, 0xC0, 0xBF, 0xE2, 0xFF, 0xF4, 0x02, 0xF4, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3E, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF4, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF0, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xD0, 0x01, 0xBF, 0xD0,
-    0x02, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFD, 0x00,
-    0x3F, 0x80, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0x80, 0x3F, 0x80, 0x02, 0xFC,
-    0xBF, 0xD0, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xF8, 0x3F, 0x80,
-    0x02, 0xFC, 0x0B, 0xFD, 0x3F, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x3F, 0x80, 0x02, 0xFC, 0x01, 0xFF,
-    0xBF, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC,
-    0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x40, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x80,
-    0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0xBF, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x54, 0x05, 0x90, 0x02, 0xFF,
-    0xC7, 0xFF, 0xD0, 0x7F, 0xFE, 0xFF, 0xFF, 0x42, 0xBF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0xFF,
-    0xC0, 0x3F, 0xE0, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC, 0x03, 0xFE,
-    0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC,
-    0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC, 0x2F, 0xFF, 0xC0, 0x7F, 0xC3, 0xFF, 0xFC,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2E,
-    0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xEA, 0xFF,
-    0xF4, 0x02, 0xFF, 0x40, 0x0F, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFC, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x2F,
-    0xF6, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0xBF,
-    0xDB, 0xFD, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFD,
-    0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x2F, 0xFF, 0xEF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD,
-    0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x0B, 0x00, 0x00, 0x01, 0xFD, 0x1B, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA,
-    0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0xAF,
-    0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDF, 0xFC, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x00, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x1F, 0xFE, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFE, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x03, 0x80, 0x03, 0xF8, 0x1F, 0x40, 0x02, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F,
-    0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F,
-    0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0x0B, 0xF0, 0x7F,
-    0x80, 0x00, 0x0B, 0xF8, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x03, 0xF0, 0x2F, 0x40,
-    0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0,
-    0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x7F, 0xF0,
-    0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDB,
-    0xFC, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x6F,
-    0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x3F, 0x8F, 0xD0, 0x00,
-    0x3F, 0x1F, 0xC0, 0x00, 0xBD, 0x2F, 0x00, 0x00, 0xB8, 0x2E, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF,
-    0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF,
-    0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFA, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xF4, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x01,
-    0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x90, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xFA, 0xAA, 0x40, 0xBF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x3F, 0xF5,
-    0x55, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x10,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBC, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFC, 0x0F, 0xFE,
-    0x00, 0x3F, 0xF0, 0x02, 0xFC, 0x03, 0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x90, 0x00, 0x59, 0x40, 0x00, 0x7F, 0xFF, 0x81, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xC0, 0x7F, 0xE6, 0xFF, 0xFE, 0x5F, 0xFC, 0x3F, 0xE0, 0x0F, 0xFE, 0x00, 0xFF,
-    0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xDB, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xF7, 0xFF, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFD, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xF0, 0x01, 0xFF, 0x55, 0x55, 0x4F,
-    0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF,
-    0x40, 0x01, 0x0F, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xFA, 0xBF, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x40,
-    0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00,
-    0x07, 0xFC, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xEF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x2F, 0xF0, 0x00, 0x00,
-    0x7F, 0xC3, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x01,
-    0xFF, 0x00, 0xBF, 0xF0, 0x01, 0xBF, 0xE4, 0x0F, 0xFF, 0x43, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x64, 0x2F, 0xF8, 0x7F,
-    0xC7, 0xFF, 0xCF, 0xFC, 0x2B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xA8, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x6F, 0xFA, 0xBF, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x3F,
-    0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x01, 0xFF,
-    0x00, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xEF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xF0,
-    0x01, 0xBF, 0xE4, 0x0F, 0xFF, 0x43, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x06, 0x42, 0xFF,
-    0x87, 0xFC, 0x7F, 0xFC, 0xFF, 0xC2, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEA, 0x80, 0x3F, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02,
-    0xC0, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x01, 0xBF, 0xEA, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x0F, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x1F, 0xF0,
-    0x07, 0xFC, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x0F,
-    0xFC, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFC, 0x02,
-    0xFF, 0xC0, 0x06, 0xFF, 0x90, 0x3F, 0xFD, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xE3, 0xFF, 0xFF, 0x80,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0x80, 0x0A, 0x00, 0x3F, 0x03, 0xF0, 0x02,
-    0xF8, 0xBD, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x06, 0x42, 0xFF, 0x87, 0xFC, 0x7F, 0xFC, 0xFF, 0xC2, 0xBF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xEA, 0x80, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0xFF, 0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x07, 0xFF,
-    0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x07, 0xFF, 0x5B, 0xFC, 0x3F, 0xE0, 0x07, 0xF0, 0xFF, 0x40, 0x0F,
-    0xC3, 0xFD, 0x00, 0x3D, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD2, 0x80,
-    0x01, 0xFF, 0x9F, 0x80, 0x03, 0xFE, 0x7F, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x7F, 0xC7, 0xFF, 0xAB,
-    0xFE, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x3F, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFC, 0x3F, 0xC0, 0x7F, 0x0F, 0xF0, 0x0B, 0xC3, 0xFD, 0x01, 0x90, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x7C, 0x00,
-    0xFF, 0x6F, 0x80, 0x2F, 0xDB, 0xF8, 0x1F, 0xF1, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xE0, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0x0F,
-    0xE0, 0x07, 0xF0, 0x0F, 0xC0, 0x0A, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40,
-    0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xC1, 0xFF, 0xD6, 0xFF, 0x0F, 0xF8, 0x01, 0xFC, 0x3F,
-    0xD0, 0x03, 0xF0, 0xFF, 0x40, 0x0F, 0x43, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-    0xF4, 0xA0, 0x00, 0x7F, 0xE7, 0xE0, 0x00, 0xFF, 0x9F, 0xC0, 0x03, 0xFD, 0x7F, 0x80, 0x1F, 0xF1,
-    0xFF, 0xEA, 0xFF, 0x87, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xEF, 0xD0, 0x03, 0xE1, 0xFC, 0x03,
-    0xF0, 0x1F, 0x00, 0x60, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFC, 0x3F, 0xC0, 0x2F, 0x0F, 0xF4, 0x06, 0x43, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xF5, 0xF0, 0x03, 0xFD,
-    0xBE, 0x00, 0xBF, 0x6F, 0xE0, 0x7F, 0xC7, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x80, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x1A, 0xA9, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x07, 0xFF, 0x5B, 0xFC,
-    0x3F, 0xE0, 0x07, 0xF0, 0xFF, 0x40, 0x0F, 0xC3, 0xFD, 0x00, 0x3D, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD2, 0x80, 0x01, 0xFF, 0x9F, 0x80, 0x03, 0xFE, 0x7F, 0x00, 0x0F,
-    0xF5, 0xFE, 0x00, 0x7F, 0xC7, 0xFF, 0xAB, 0xFE, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1A,
-    0x50, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFC, 0x3F, 0xC0, 0x2F, 0x0F, 0xF4,
-    0x06, 0x43, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0xBF, 0xF5, 0xF0, 0x03, 0xFD, 0xBE, 0x00, 0xBF, 0x6F, 0xE0, 0x7F, 0xC7, 0xFF, 0xFF, 0xD0, 0xBF,
-    0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xBF, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0x90, 0x00, 0x03, 0x80, 0x0B, 0x80,
-    0x2F, 0x40, 0xBE, 0x00, 0x3F, 0x8B, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0xC1, 0xFF, 0xD6, 0xFF, 0x0F, 0xF8, 0x01, 0xFC, 0x3F, 0xD0, 0x03, 0xF0, 0xFF, 0x40, 0x0F,
-    0x43, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF4, 0xA0, 0x00, 0x7F, 0xE7, 0xE0,
-    0x00, 0xFF, 0x9F, 0xC0, 0x03, 0xFD, 0x7F, 0x80, 0x1F, 0xF1, 0xFF, 0xEA, 0xFF, 0x87, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x06, 0x00, 0x38, 0x07, 0xD0, 0x3F, 0x00,
-    0xFD, 0x3F, 0x00, 0x1F, 0xEF, 0x40, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFC,
-    0x3F, 0xC0, 0x2F, 0x0F, 0xF4, 0x06, 0x43, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xF5, 0xF0, 0x03, 0xFD, 0xBE, 0x00, 0xBF, 0x6F, 0xE0, 0x7F,
-    0xC7, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-    0x40, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09, 0x00,
-    0xFF, 0x80, 0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD2,
-    0xBF, 0xFA, 0xA0, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00,
-    0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x01,
-    0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x06, 0x90,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x1C, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x1F,
-    0xD3, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x40, 0xFF, 0x80, 0xBE,
-    0x3F, 0x00, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09, 0x00, 0xFF, 0x80, 0x64, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x40, 0x1F, 0xC7, 0xC0, 0x0F, 0xF1, 0xD0, 0x07, 0xFC, 0x10, 0x01, 0xFF, 0x00, 0x06, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xF4, 0xAF, 0xFE, 0xA8, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC,
-    0x00, 0x02, 0xFF, 0x40, 0x40, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x40, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBE,
-    0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09, 0x00, 0xFF, 0x80, 0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD2, 0xBF,
-    0xFA, 0xA0, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xBF, 0xFA, 0x90, 0xFF,
-    0xFF, 0xF8, 0x16, 0xFF, 0x54, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x01, 0x01,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x2C, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xF4, 0x00, 0x00, 0x00, 0xFA,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0xC2, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xD1, 0xBF, 0xF4, 0x00, 0x5F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0xBF, 0xD0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x16,
-    0x50, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0xF0, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x7C, 0x7F, 0xE0, 0x00, 0x00, 0x14, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40,
-    0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x41, 0xFF, 0xFF, 0xDF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFD, 0x1B, 0xFF, 0x40, 0x05, 0xFF, 0x80, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F,
-    0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8,
-    0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x0D, 0x00,
-    0x00, 0x00, 0x3F, 0x96, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFD, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xD1, 0xBF,
-    0xF4, 0x00, 0x5F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0x80, 0x01,
-    0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x70, 0x00, 0x00, 0x7F, 0x42, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC,
-    0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00,
-    0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0x9B, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x3D, 0x00,
-    0x00, 0x00, 0x03, 0xF6, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF,
-    0x40, 0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00,
-    0x00, 0x1F, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x00,
-    0x0F, 0xEF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC, 0x06,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x00,
-    0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00,
-    0x00, 0x0B, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x18, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x40,
-    0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00,
-    0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F,
-    0x03, 0xC0, 0x00, 0x00, 0x01, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF,
-    0x40, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x57, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F,
-    0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFC, 0x3F, 0xF8, 0x00, 0x05, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x07, 0xF4, 0x02, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xF0, 0x0B, 0xF8, 0x02, 0xFF, 0xFD, 0x1F, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
-    0x80, 0x2F, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0xFF,
-    0xC0, 0x3F, 0xFF, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x3F,
-    0xE0, 0xBD, 0xBF, 0xC0, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0xFC, 0x3F, 0xC1, 0xFC, 0x00, 0x00, 0x2F,
-    0xF1, 0xFC, 0x3F, 0xE2, 0xF8, 0x00, 0x00, 0x0F, 0xF6, 0xF8, 0x2F, 0xF3, 0xF4, 0x00, 0x00, 0x0F,
-    0xFB, 0xF0, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x0B, 0xD0, 0x3F, 0xFF, 0x3F,
-    0xFF, 0x80, 0xFE, 0x03, 0xFF, 0xD0, 0xFF, 0xC0, 0x0F, 0xF0, 0x07, 0xF4, 0x07, 0xFC, 0x02, 0xFF,
-    0x40, 0xBF, 0x00, 0x3F, 0xD0, 0x3F, 0xF8, 0x0F, 0xE0, 0x02, 0xFE, 0x03, 0xFF, 0xC0, 0xFC, 0x00,
-    0x1F, 0xF0, 0x7E, 0xFC, 0x1F, 0xC0, 0x00, 0xFF, 0x0F, 0x9F, 0xD2, 0xF4, 0x00, 0x0B, 0xF4, 0xF4,
-    0xFE, 0x3F, 0x00, 0x00, 0x3F, 0x9F, 0x0B, 0xF3, 0xE0, 0x00, 0x03, 0xFE, 0xF0, 0x7F, 0xBD, 0x00,
-    0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0x8B, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x7D, 0x00, 0x00, 0x02, 0x40, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xAF, 0xFF, 0xF8, 0x2F, 0xFF, 0xD1, 0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x3F, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xFE, 0x07, 0xF0, 0x00,
-    0x00, 0xBF, 0xC3, 0xF4, 0x00, 0x00, 0x0F, 0xF9, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x01, 0xF8, 0x0F, 0x80,
-    0x00, 0x02, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x47, 0xFF, 0xE7, 0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF, 0x80, 0x0F, 0xF0, 0x07, 0xFE, 0x00,
-    0x3F, 0x80, 0x0F, 0xFC, 0x01, 0xFC, 0x00, 0x1F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0x40,
-    0x00, 0x7F, 0xC2, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x1A, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0xA8, 0x00, 0x00, 0x0F, 0xF0,
-    0xBF, 0x80, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x05, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xE0, 0xBF, 0xFF, 0x47, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x0F, 0xF8, 0x1F,
-    0xC0, 0x00, 0x02, 0xFF, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xE7, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x40, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC1, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0x80, 0x0B, 0xFE, 0x0B, 0xD0, 0x07,
-    0xFF, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x64, 0x1F, 0xFC, 0x00, 0x3F, 0x0F, 0xFC, 0x00, 0x1F,
-    0xCB, 0xFE, 0x00, 0x0F, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xEA, 0xFF, 0xE0, 0xBC, 0x03, 0xFF, 0x02, 0xE0, 0x3F, 0xF0, 0x01, 0x02,
-    0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x28, 0x0B, 0xFD, 0x01, 0xF0, 0x7F, 0xE0, 0x0F, 0xC3, 0xFF, 0xAA, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4, 0xBE, 0x00, 0x2F, 0xF8, 0x2F, 0x40, 0x1F, 0xFC, 0x07,
-    0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xE0, 0x01, 0x90, 0x7F, 0xF0, 0x00, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0x2F, 0xF8,
-    0x00, 0x3F, 0xCF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC2, 0xFE, 0xAF, 0xFE, 0x0B, 0xC0, 0x3F,
-    0xF0, 0x2E, 0x03, 0xFF, 0x00, 0x10, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x02, 0x80, 0xBF, 0xD0, 0x1F, 0x07, 0xFE, 0x00, 0xFC, 0x3F,
-    0xFA, 0xAF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x02, 0xE0, 0x00, 0x7E, 0x02, 0xF8, 0x00, 0x0F, 0xE2, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4, 0xBE, 0x00, 0x2F,
-    0xF8, 0x2F, 0x40, 0x1F, 0xFC, 0x07, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x01, 0x90, 0x7F, 0xF0, 0x00, 0xFC,
-    0x3F, 0xF0, 0x00, 0x7F, 0x2F, 0xF8, 0x00, 0x3F, 0xCF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x1E, 0x00, 0x1F, 0x40,
-    0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x7F, 0xBD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0xFF, 0x0B, 0xFA, 0xBF, 0xF8, 0x2F, 0x00, 0xFF, 0xC0, 0xB8, 0x0F, 0xFC, 0x00, 0x40,
-    0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0,
-    0x0A, 0x02, 0xFF, 0x40, 0x7C, 0x1F, 0xF8, 0x03, 0xF0, 0xFF, 0xEA, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0x40, 0x7F, 0xE6, 0xFD, 0x03, 0xFE, 0x01, 0xF0, 0x0F, 0xF4, 0x01, 0x00, 0x7F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x34, 0x03, 0xF4, 0x0F, 0xF0, 0x1F, 0xF0, 0x0F, 0xE0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x38,
-    0x0F, 0xD1, 0xFD, 0x3F, 0x8B, 0xE0, 0x78, 0x00, 0x00, 0x00, 0x54, 0x00, 0x2F, 0xC0, 0x07, 0xFF,
-    0x00, 0xFE, 0xFC, 0x2F, 0x4B, 0xD7, 0xE0, 0x3E, 0x24, 0x00, 0x40, 0x1A, 0x40, 0x87, 0xFE, 0x2E,
-    0xBF, 0xFF, 0xEB, 0x8B, 0xFD, 0x20, 0x1A, 0x40, 0x7F, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xE0,
-    0x10, 0x00, 0x0B, 0x80, 0x0A, 0xFF, 0x47, 0xE7, 0xFF, 0xFC, 0x1F, 0xFE, 0x00, 0x05, 0x00, 0x0A,
-    0x43, 0xFC, 0x7F, 0xD3, 0xFC, 0x1E, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF8, 0x3F, 0xC3, 0xFC,
-    0x3F, 0xC3, 0xFC, 0x1E, 0x41, 0xE4, 0x01, 0x50, 0x3F, 0xFC, 0xFE, 0xBF, 0xF8, 0x3F, 0x64, 0x3E,
-    0x01, 0xFC, 0x0F, 0xE0, 0x07, 0x80, 0x02, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3E, 0xFD, 0xB8, 0x3E,
-    0xF8, 0x2F, 0xBC, 0x2E, 0x7F, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0F, 0x40,
-    0xFC, 0x3F, 0x0B, 0xF2, 0xF8, 0x3F, 0x0F, 0xC1, 0xF8, 0x7D, 0x07, 0xC1, 0xE0, 0x04, 0x01, 0x00,
-    0x24, 0x02, 0x9F, 0xC0, 0xBD, 0xBF, 0x1F, 0x83, 0xFB, 0xF0, 0x0F, 0xFD, 0x00, 0x3F, 0x80, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1E, 0x03, 0xF0, 0xFC, 0x0B, 0xE3, 0xF8, 0x0F, 0xC3, 0xF0,
-    0x1F, 0x4B, 0xD0, 0x2D, 0x0F, 0x40, 0x10, 0x04, 0x02, 0xF9, 0x02, 0xFF, 0xFC, 0x7F, 0xBF, 0xEF,
-    0x40, 0x7F, 0x90, 0x01, 0xC0, 0x00, 0x00, 0x02, 0x80, 0xFC, 0x2F, 0x43, 0xF0, 0x7F, 0x07, 0xF0,
-    0x7F, 0x82, 0xF4, 0x05, 0x07, 0xFC, 0x3F, 0xC1, 0xFC, 0x1F, 0xC2, 0xF4, 0x3F, 0x0B, 0xC0, 0x00,
-    0x00, 0x05, 0x03, 0xFD, 0x3F, 0xC3, 0xF4, 0x3F, 0x42, 0xF8, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x3D,
-    0x3F, 0x3E, 0x7D, 0x7C, 0x78, 0x70, 0x00, 0x05, 0x02, 0xFC, 0x1F, 0xC1, 0xFC, 0x3F, 0x07, 0xD0,
-    0x60, 0x00, 0x00, 0x0A, 0x43, 0xFC, 0x7F, 0xD3, 0xFC, 0x1A, 0x40, 0x05, 0x00, 0x10, 0x3F, 0xC2,
-    0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x19, 0x00, 0xA0, 0x01, 0x90, 0x1F, 0xF8, 0x3C, 0x7C,
-    0x7C, 0x3D, 0x3C, 0x3C, 0x2F, 0xF4, 0x06, 0x80, 0x05, 0x03, 0xFC, 0x2F, 0xD0, 0xFC, 0x1F, 0xC3,
-    0xF0, 0x24, 0x00, 0x1A, 0x07, 0xFD, 0x2F, 0xE0, 0x7E, 0x0F, 0xC7, 0xF4, 0x28, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x14, 0xBE,
-    0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x15, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xC0, 0x03,
-    0xFF, 0xF0, 0x0F, 0xD2, 0xF8, 0x2F, 0x40, 0xBC, 0x19, 0x00, 0x24, 0x24, 0x00, 0x1B, 0xC0, 0x0F,
-    0xBF, 0xAB, 0xE3, 0xFF, 0xF8, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x05, 0x00, 0x43, 0xFD, 0x1D, 0xBF,
-    0xFB, 0xEB, 0xDF, 0xFD, 0x74, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF,
-    0xD0, 0x02, 0xF9, 0x02, 0xFF, 0xFC, 0x7F, 0xBF, 0xEF, 0x40, 0x7F, 0x90, 0x01, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x10, 0x3F, 0xC2, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3,
-    0xFC, 0x1A, 0x00, 0xA0, 0xBC, 0x0B, 0xC0, 0xBD, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0xFF, 0xFD,
-    0x07, 0xFD, 0x00, 0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F, 0xD0, 0x00, 0xE0, 0x1F, 0xF4, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x3D, 0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xA4, 0x06, 0x80, 0x00, 0xFF, 0x4B,
-    0xF8, 0x00, 0x3F, 0xD2, 0xFF, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x46,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xD0, 0x02, 0xF4, 0x1F, 0xF4, 0x00, 0x7D, 0x07, 0xFD, 0x00, 0x0E,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x07, 0xFF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xE5, 0x55, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xD0, 0x7F, 0xD0, 0x01, 0xF8, 0x1F, 0xF4, 0x00, 0xFE, 0x1B,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x01, 0xFF, 0x40, 0xFD, 0x00, 0x3F, 0x01, 0xFF, 0x40, 0xFC, 0x00,
-    0x3F, 0x01, 0xFF, 0x40, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xAB, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x95, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xFC,
-    0x00, 0x01, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x40,
-    0x03, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x3F,
-    0xFF, 0xF8, 0x03, 0xFD, 0x00, 0x7F, 0xFF, 0xF4, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x6B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0x6F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFD, 0x00, 0xBF, 0x01, 0xFF, 0x40, 0x2F, 0x80, 0x7F, 0xD0, 0x07, 0xE0, 0x1F, 0xF4,
-    0x01, 0xF0, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0x6F, 0xFC, 0x0B, 0xFD, 0x00, 0x2F,
-    0xC1, 0xFF, 0x40, 0x01, 0xFC, 0x2F, 0xE0, 0x00, 0x0F, 0xC3, 0xFD, 0x00, 0x00, 0xA4, 0x7F, 0xC0,
-    0x00, 0x00, 0x0B, 0xFD, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xD5, 0x55, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x3C, 0x3F, 0xF4, 0x00, 0x0B, 0xE2, 0xFF, 0xE0, 0x02, 0xFE, 0x0F, 0xFF, 0xEA, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x1A, 0xA9,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x07, 0xFF, 0x5B, 0xFC, 0x3F, 0xE0, 0x07, 0xF0,
-    0xFF, 0x40, 0x0F, 0xC3, 0xFD, 0x00, 0x3D, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xD2, 0x80, 0x01, 0xFF, 0x9F, 0x80, 0x03, 0xFE, 0x7F, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x7F,
-    0xC7, 0xFF, 0xAB, 0xFE, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x06, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF,
-    0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x01, 0xBF, 0xF9, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x1A, 0x40, 0xA4, 0x3F, 0xC3, 0xFD,
-    0x7F, 0xC3, 0xFD, 0x3F, 0xC2, 0xFC, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF,
-    0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40,
-    0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01,
-    0xFF, 0x40, 0x06, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0x90, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x1F,
-    0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x1B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x07, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xD0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0x0F, 0xC0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0x1F, 0xC0, 0x0F,
-    0xF8, 0x02, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x02, 0xFF, 0x10, 0x7F, 0x40, 0x0F, 0xF8, 0x03,
-    0xFE, 0x3D, 0xFF, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x7F, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x6F, 0xFD, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x90, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFE, 0x55, 0x57, 0xFE,
-    0x5B, 0xFF, 0x41, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x0F,
-    0xFC, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x81,
-    0xFF, 0x40, 0x00, 0xFF, 0x80, 0xBF, 0xC1, 0xBF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
-    0xC2, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0x01, 0xFF, 0x40, 0xFD, 0x00, 0x00, 0xFC, 0x07, 0xFD, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x1F, 0xF4,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x6A, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xE5, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F,
-    0xFD, 0x00, 0xBF, 0xF9, 0x00, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF4, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x90, 0x3F, 0xFF, 0xFC, 0x03, 0xFE, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xC0, 0x6F, 0xF8, 0x01, 0xFF,
-    0xF0, 0x07, 0xFC, 0x00, 0xFF, 0xB8, 0x01, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0xC0, 0x3F, 0x80,
-    0x00, 0x1F, 0xF0, 0x1F, 0xC0, 0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0xAF, 0xE0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00,
-    0x01, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00,
-    0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xBF, 0xF8, 0x03, 0xFF, 0x83,
-    0xFF, 0xFF, 0x80, 0x7F, 0xF8, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x46,
-    0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFC,
-    0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0xFF,
-    0xFF, 0x00, 0x1F, 0xF0, 0x0F, 0xFB, 0xFC, 0x00, 0x7F, 0xC0, 0xFE, 0x2F, 0xF0, 0x01, 0xFF, 0x0F,
-    0xE0, 0xBF, 0xC0, 0x07, 0xFD, 0xFE, 0x02, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x0B, 0xFC, 0x00, 0x7F,
-    0xFE, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xC0, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x00,
-    0x1F, 0xF0, 0x00, 0x0B, 0xFC, 0x01, 0xBF, 0xE4, 0x00, 0x7F, 0xF9, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x00, 0x0A, 0x00, 0x18, 0x00, 0x00, 0x0B, 0xE0, 0x1F,
-    0x80, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x7F, 0xFF, 0xEF, 0xFF, 0xF8, 0x1F, 0xFF, 0xE1, 0xFF, 0xE0, 0x00, 0xBF,
-    0xC0, 0x1F, 0xF8, 0x00, 0x2F, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xE0, 0x0B, 0xF0,
-    0x00, 0x0B, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x41, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0xFD, 0x00,
-    0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x01, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xD2, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xE1, 0xBF, 0xE0, 0x01, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x7F,
-    0xC0, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0x07, 0xFD, 0x00, 0x07,
-    0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xD0, 0x00,
-    0x7F, 0xC0, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0x07, 0xFD, 0x00,
-    0x07, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xD0,
-    0x00, 0x7F, 0xC0, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0x43, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0x95, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x7F, 0x55, 0x57, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F,
-    0xF8, 0x01, 0xFF, 0x90, 0x00, 0x7F, 0xF9, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x6F, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0xBF, 0x01, 0xFF, 0x40, 0x1F, 0x80, 0x7F, 0xD0, 0x03,
-    0xD0, 0x1F, 0xF4, 0x00, 0x50, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x02, 0xFF, 0x41, 0xFF, 0x40, 0x3F, 0xF0, 0x7F,
-    0xD0, 0x0B, 0xFC, 0x1F, 0xF4, 0x02, 0xFF, 0x07, 0xFD, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0xBF, 0xD1,
-    0xBF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x6F, 0xF5,
-    0xBF, 0xF0, 0x07, 0xFC, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x2F, 0xD0, 0x1F,
-    0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x07, 0xFC, 0x03, 0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x0B,
-    0xFC, 0x1F, 0xF0, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xC1, 0xBF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0x6F, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFD, 0x00, 0xBF, 0x01, 0xFF, 0x40, 0x2F, 0x80, 0x7F, 0xD0, 0x07, 0xE0, 0x1F, 0xF4, 0x01,
-    0xF0, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0xFF, 0xAB, 0xFF, 0x40,
-    0x00, 0x03, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0xBF,
-    0xC0, 0x00, 0x00, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
-    0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x0F,
-    0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0xC0, 0x00,
-    0x0F, 0xE0, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xF0,
-    0x01, 0xBF, 0xFE, 0xAB, 0xFF, 0xE9, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00,
-    0x00, 0x02, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x41, 0xD0,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x6F, 0xFF, 0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F,
-    0xD0, 0x00, 0xE0, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3D, 0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40,
-    0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F,
-    0xFF, 0x02, 0xFF, 0xFF, 0x80, 0xBF, 0xF0, 0x0F, 0xFF, 0x40, 0x6F, 0xF8, 0x01, 0xFF, 0xF0, 0x0B,
-    0xBF, 0xC0, 0x0F, 0xF0, 0x03, 0xFE, 0xE0, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0x00,
-    0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xFA, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFE, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF0, 0x3F, 0xF0, 0x00, 0x00,
-    0x1F, 0xF8, 0x0F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFD, 0x00, 0x00,
-    0xFF, 0xE0, 0x0F, 0xF0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xF0, 0x03, 0xFF, 0xC0, 0x0B,
-    0xFF, 0x40, 0x2F, 0xFE, 0x00, 0xFF, 0xE0, 0x2F, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0x7F, 0xF8, 0x7F,
-    0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x1A, 0xA4, 0x00, 0x01, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0x95, 0xBF, 0xE0,
-    0x3F, 0x80, 0x0F, 0xFC, 0x0F, 0xD0, 0x01, 0xFF, 0x02, 0xF0, 0x00, 0x7F, 0xC0, 0x14, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1A, 0xAF, 0xF4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x05, 0x6F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x78,
-    0x00, 0x0F, 0xFC, 0x7F, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x02, 0xFF, 0x4B, 0xFF, 0x97, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x15, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x46, 0xFF,
-    0x80, 0x01, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0x7F, 0xC0, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0xFF, 0xFF,
-    0x00, 0x1F, 0xF0, 0x0F, 0xFB, 0xFC, 0x00, 0x7F, 0xC0, 0xFE, 0x2F, 0xF0, 0x01, 0xFF, 0x0F, 0xE0,
-    0xBF, 0xC0, 0x07, 0xFD, 0xFE, 0x02, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x0B, 0xFC, 0x00, 0x7F, 0xFE,
-    0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xC0, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x1F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x01, 0xBF, 0xE4, 0x00, 0x7F, 0xF9, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x00, 0x02, 0x40, 0x09, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBD,
-    0x00, 0x00, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xD1,
-    0xBF, 0xE0, 0x00, 0x7F, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x03, 0xFF,
-    0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0x00, 0x3F,
-    0xFF, 0xC0, 0x07, 0xFC, 0x03, 0xFE, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0x8B, 0xFC, 0x00, 0x7F, 0xC3,
-    0xF8, 0x2F, 0xF0, 0x01, 0xFF, 0x7F, 0x80, 0xBF, 0xC0, 0x07, 0xFF, 0xF8, 0x02, 0xFF, 0x00, 0x1F,
-    0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0,
-    0x07, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x6F, 0xF9, 0x00, 0x1F, 0xFE, 0x4F, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x90, 0x3F, 0xFF, 0xFC, 0x03,
-    0xFE, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xC0, 0x6F, 0xF8, 0x01, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0xFF,
-    0xB8, 0x01, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xF0, 0x1F, 0xC0,
-    0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0xAF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x03, 0xFF, 0x00,
-    0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0xC0,
-    0x01, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xBF, 0xF8, 0x03, 0xFF, 0x83, 0xFF, 0xFF, 0x80, 0x7F, 0xF8,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x03, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0x00,
-    0xFF, 0xC0, 0x00, 0x07, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xD0,
-    0x0F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xC0, 0x0F, 0xFC, 0x00, 0x03, 0xF8,
-    0x00, 0xFF, 0xC0, 0x10, 0x7F, 0x40, 0x0F, 0xFC, 0x03, 0xDF, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xFD,
-    0x00, 0x2F, 0xFE, 0x4B, 0xFF, 0x80, 0x2F, 0xFF, 0xFD, 0x3F, 0xE0, 0x03, 0xFF, 0xFF, 0xD0, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x7F, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x02, 0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xEF, 0xF0,
-    0x0F, 0xEF, 0xE0, 0x00, 0x3F, 0x7F, 0xD0, 0x7E, 0xBF, 0x80, 0x00, 0xFD, 0x7F, 0x82, 0xF1, 0xFE,
-    0x00, 0x03, 0xF0, 0xFF, 0x0F, 0xC7, 0xFC, 0x00, 0x0F, 0xC3, 0xFC, 0x7E, 0x1F, 0xF0, 0x00, 0x3F,
-    0x0B, 0xF6, 0xF4, 0x3F, 0xC0, 0x01, 0xFC, 0x0F, 0xEF, 0xC0, 0xFF, 0x00, 0x07, 0xF0, 0x3F, 0xFE,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0xBF, 0xF4, 0x0F, 0xF4, 0x00, 0xBF, 0x00, 0xFF, 0xC0, 0x3F, 0xD0,
-    0x03, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xE0, 0x07, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0,
-    0x0F, 0xC0, 0x1F, 0xFE, 0x0F, 0xFF, 0xF0, 0x10, 0x03, 0xFF, 0xFF, 0x7F, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x03, 0xFF, 0xFF, 0x86, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F,
-    0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0,
-    0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFE, 0x55, 0x56, 0xFF, 0x40, 0x1F, 0xF4, 0x00,
-    0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD,
-    0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x01, 0xBF, 0xF8, 0x00, 0x7F, 0xFE, 0x3F,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0,
-    0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x7F, 0xF0,
-    0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDB,
-    0xFC, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x6F,
-    0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x06, 0xFF, 0xFA, 0xAF, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F,
-    0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00,
-    0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF,
-    0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00,
-    0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE,
-    0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x01, 0xBF, 0xF8, 0x00, 0xBF, 0xF9, 0x3F, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x00, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x6F, 0xFA, 0xFF, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x00,
-    0x7F, 0xD0, 0x7F, 0xC0, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0x01, 0xFF,
-    0x00, 0xFF, 0xC0, 0x7F, 0xD6, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x80, 0x01,
-    0xFF, 0xA9, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0xE9, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xAB, 0xFD, 0x0B, 0xFD, 0x00, 0x3F, 0x47, 0xFD, 0x00, 0x0F, 0xD3, 0xFF, 0x00, 0x02, 0xF0,
-    0xFF, 0x40, 0x00, 0x10, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x5A, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x40, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBE, 0x3F, 0x00,
-    0xFF, 0x80, 0xBD, 0x09, 0x00, 0xFF, 0x80, 0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFB, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0x2F, 0xF0, 0x07, 0xFE,
-    0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xF8, 0x02, 0xFC, 0x00, 0x02, 0xFF,
-    0x00, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x7F, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xFF,
-    0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xEF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x40, 0xFE,
-    0x00, 0x00, 0x00, 0xF4, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFE,
-    0xBF, 0xDF, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x1F, 0xF8, 0xBF, 0xC0, 0x7F, 0xC0, 0xBF, 0xCF, 0xF8,
-    0x07, 0xFC, 0x03, 0xFD, 0xFF, 0x40, 0x7F, 0xC0, 0x3F, 0xDF, 0xF8, 0x07, 0xFC, 0x03, 0xFD, 0xBF,
-    0xC0, 0x7F, 0xC0, 0x7F, 0xC7, 0xFD, 0x07, 0xFC, 0x0F, 0xF8, 0x3F, 0xF8, 0x7F, 0xC7, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xD0, 0x0F,
-    0xF4, 0x00, 0x07, 0xFF, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xDF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xE1, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0xFF,
-    0x40, 0x3F, 0xF4, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0xC0, 0x0B, 0xFE, 0x40, 0x1F, 0xFF, 0x87, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x06, 0xFF, 0x80, 0x07, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00,
-    0x7F, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF4,
-    0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x07,
-    0xFD, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xC0,
-    0x01, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x1F,
-    0xF0, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xBF, 0xF4, 0x02, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xF9,
-    0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2A,
-    0xA4, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x5F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x7F, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x06, 0xFF, 0x80, 0x6F, 0xF8, 0x02, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE,
-    0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xE0,
-    0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00,
-    0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x01,
-    0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x1F,
-    0xF0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x01, 0xFF,
-    0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xF0,
-    0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x01, 0xBF, 0xFF, 0xAB, 0xFF, 0xAF, 0xFF, 0xF9, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD7, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xF0, 0x1B, 0xFE, 0x01, 0xBF, 0xE0, 0x0B, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x1B, 0xFF, 0xFA,
-    0xBF, 0xFA, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0x80, 0x00,
-    0x03, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x90, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x0F, 0xF8,
-    0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0xFF,
-    0x80, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFD, 0xFF, 0xFF, 0xE0, 0x00,
-    0x1F, 0xFF, 0xFD, 0x1B, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFE,
-    0x40, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
-    0xFF, 0xC0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0xC0,
-    0x07, 0xFD, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD,
-    0x00, 0xFF, 0x40, 0xFF, 0xC0, 0x07, 0xFD, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x1B, 0xFF, 0xFF, 0xFD,
-    0x01, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x40, 0x1F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x02, 0xFF, 0x81,
-    0xFF, 0x40, 0x3F, 0xF0, 0x7F, 0xD0, 0x0B, 0xFC, 0x1F, 0xF4, 0x02, 0xFF, 0x07, 0xFD, 0x00, 0xFF,
-    0x81, 0xFF, 0x40, 0xBF, 0xD1, 0xBF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x9B, 0xFF, 0xE0, 0x3F, 0x80, 0x07, 0xFF, 0x03, 0xF0, 0x00, 0x1F,
-    0xF8, 0x3F, 0x00, 0x00, 0xFF, 0xC1, 0xA0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x01,
-    0xAA, 0xAB, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x55, 0x7F,
-    0xE0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0x00,
-    0x02, 0xFF, 0x4F, 0xF8, 0x00, 0xBF, 0xE0, 0xBF, 0xFA, 0xBF, 0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFC, 0x01,
-    0xBF, 0xE0, 0x02, 0xFF, 0xEB, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x7F,
-    0xC0, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x00, 0x07, 0xFE, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xEA, 0xBF,
-    0xE0, 0x00, 0x03, 0xFF, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0x07, 0xFD, 0x57, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x3F, 0xF0, 0x00,
-    0x03, 0xFE, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x2F, 0xF8, 0x00, 0x0B,
-    0xFC, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xF0,
-    0x1B, 0xFF, 0x80, 0x3F, 0xFF, 0xBF, 0xFC, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA,
-    0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x7F,
-    0xC0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x40, 0x7F, 0xC0,
-    0x00, 0xFF, 0xFA, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x00, 0xFF,
-    0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0x40, 0x7F, 0xC0, 0x0B, 0xFE, 0x01, 0xFF, 0xE4, 0x3F, 0xFC, 0x0F,
-    0xFF, 0xFE, 0x7F, 0xE0, 0x0F, 0xFF, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0,
-    0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0,
-    0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x15, 0xBC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xF0, 0x0B, 0xF4, 0x05, 0x40, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x3F, 0xC1, 0x50, 0x00, 0x7F, 0xEF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFA, 0xBF, 0xF0,
-    0xFF, 0xC0, 0x1F, 0xF8, 0xFF, 0x80, 0x0F, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0x80, 0x07, 0xFC,
-    0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xD0, 0x0F, 0xFC, 0x3F, 0xF0, 0x1F, 0xF4,
-    0x1F, 0xFE, 0xBF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x01, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFD, 0x07, 0xFC, 0x0B, 0xFC, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF, 0x00, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xD5, 0xBF, 0xD0, 0xFF, 0x00, 0xBF, 0x83, 0xFC, 0x01, 0xFF, 0x0F, 0xF0, 0x0B,
-    0xF8, 0x3F, 0xD5, 0xBF, 0xDB, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xEA, 0xFD, 0x0F, 0xF8,
-    0x0F, 0xD0, 0xFF, 0x80, 0xBC, 0x0F, 0xF8, 0x0B, 0xC0, 0xFF, 0x80, 0x10, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xD5, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0xFF,
-    0x00, 0x00, 0x1F, 0x80, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0xFF, 0x00, 0x00, 0x2F, 0x40, 0xFF, 0x00,
-    0x00, 0x3F, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0xFF, 0x00, 0x00,
-    0xBD, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x0B, 0xFD, 0x56, 0xFF, 0x90, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00,
-    0x03, 0xF8, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x00, 0x00, 0x00,
-    0xF0, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x06, 0x50, 0x00, 0x1F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7, 0xF8, 0x02, 0xFE, 0xBF, 0x80, 0x2F, 0xEF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55, 0x54, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x05,
-    0x50, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x19, 0x00, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xF4, 0x2F,
-    0xF8, 0x1F, 0xFF, 0x42, 0xFF, 0x81, 0xFF, 0xD0, 0x3F, 0xC0, 0x7F, 0xF4, 0x00, 0xBF, 0x03, 0xFC,
-    0x0F, 0xE0, 0x00, 0x02, 0xF4, 0x3F, 0xC1, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xFC, 0x3F, 0x00, 0x00,
-    0x00, 0xBF, 0xBF, 0xEF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFE, 0x7F,
-    0xD7, 0xFC, 0x00, 0x00, 0xBF, 0xC3, 0xFC, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x3F, 0xC1, 0xFF, 0x00,
-    0x03, 0xFF, 0x03, 0xFC, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xC0, 0x7F, 0xE0, 0x2F, 0xF8, 0x1F,
-    0xFF, 0x82, 0xFF, 0x87, 0xFF, 0x02, 0xFF, 0xF4, 0x0B, 0xFD, 0x05, 0x40, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x16, 0x90, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC2, 0xFD, 0x4B, 0xFD, 0x1E,
-    0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0x80, 0x01, 0x5B, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xE0, 0x01, 0xFF, 0x3F, 0x40, 0x2F, 0xF3, 0xFE,
-    0x5B, 0xFD, 0x3F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x90, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x2F, 0xFF, 0xCF, 0xFF, 0xE0, 0x7F, 0xFF, 0x07, 0xFD, 0x00, 0x3F, 0xC0,
-    0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x1F, 0xFC, 0x00, 0xFF, 0x41, 0xFF, 0xF0, 0x03, 0xFD,
-    0x2F, 0xFF, 0xC0, 0x0F, 0xF6, 0xF8, 0xFF, 0x00, 0x3F, 0xFF, 0x83, 0xFC, 0x00, 0xFF, 0xF8, 0x0F,
-    0xF0, 0x03, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x0B,
-    0xFF, 0xE0, 0x7F, 0xFF, 0x3F, 0xFF, 0x82, 0xFF, 0xFC, 0x00, 0x10, 0x00, 0x40, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x1B, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x0B, 0xFF, 0xF3, 0xFF, 0xF8, 0x1F, 0xFF, 0xC1, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFD, 0x00,
-    0x7F, 0xC0, 0x0F, 0xF4, 0x07, 0xFF, 0x00, 0x3F, 0xD0, 0x7F, 0xFC, 0x00, 0xFF, 0x4B, 0xFF, 0xF0,
-    0x03, 0xFD, 0xBE, 0x3F, 0xC0, 0x0F, 0xFF, 0xE0, 0xFF, 0x00, 0x3F, 0xFE, 0x03, 0xFC, 0x00, 0xFF,
-    0xE0, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x01, 0xFF, 0x42, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xCF, 0xFF, 0xE0, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0F, 0xFF, 0xF0, 0x1F, 0xF0,
-    0xFF, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0xFF, 0xF0, 0x0F, 0xF4, 0x1F, 0xD0, 0x00, 0xFF, 0x43,
-    0xF4, 0x00, 0x0F, 0xF4, 0x7E, 0x00, 0x00, 0xFF, 0xEF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0xFF, 0x5F, 0xF4, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x0F, 0xF4, 0x1F,
-    0xF4, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0xBF, 0xFF, 0x03, 0xFF, 0x0F, 0xFF, 0xE0, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x07, 0xF9, 0x7F, 0xE0, 0x00, 0x2F, 0x02, 0xFE, 0x00, 0x02, 0xF0, 0x2F, 0xE0, 0x00,
-    0x3F, 0x02, 0xFE, 0x00, 0x03, 0xF0, 0x2F, 0xE0, 0x00, 0x3F, 0x02, 0xFE, 0x00, 0x07, 0xE0, 0x2F,
-    0xE0, 0x00, 0xBD, 0x02, 0xFE, 0x00, 0x0F, 0xC0, 0x2F, 0xE0, 0x3A, 0xFC, 0x02, 0xFE, 0x0B, 0xFF,
-    0x40, 0x3F, 0xF4, 0xBF, 0xF0, 0x3F, 0xFF, 0xE7, 0xFC, 0x07, 0xFF, 0xFE, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x03, 0xFF, 0xEB, 0xFF, 0xE0, 0x02, 0xFF,
-    0xF4, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x40, 0xBF, 0xF8, 0x03, 0xFF, 0xF0, 0x3F, 0xFE,
-    0x00, 0xFD, 0xFC, 0x2F, 0x7F, 0x80, 0x3F, 0x7F, 0x8F, 0x8F, 0xE0, 0x0F, 0xD7, 0xFB, 0xC3, 0xF8,
-    0x03, 0xF4, 0xFF, 0xF0, 0xFE, 0x00, 0xFD, 0x2F, 0xF4, 0x3F, 0x80, 0x3F, 0x43, 0xFC, 0x0F, 0xE0,
-    0x0F, 0xD0, 0xBD, 0x03, 0xF8, 0x03, 0xF4, 0x09, 0x01, 0xFF, 0x0B, 0xFF, 0xC0, 0x03, 0xFF, 0xFB,
-    0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x2F, 0xFF, 0xCF, 0xFF,
-    0xE0, 0xBF, 0xFF, 0x07, 0xFD, 0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x03,
-    0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xEA, 0xAB, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF4,
-    0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x0B, 0xFF, 0xF0, 0x7F, 0xFF, 0x3F, 0xFF, 0xC2, 0xFF,
-    0xFC, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF,
-    0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B,
-    0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x96, 0xBF, 0xC0, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x07,
-    0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x01, 0xFF, 0x00,
-    0x3F, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xF8,
-    0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x0B, 0xFF, 0xF0, 0xBF, 0xFF, 0x3F, 0xFF, 0xC3, 0xFF,
-    0xFC, 0x00, 0x54, 0x06, 0x40, 0x03, 0xFF, 0x8F, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0x02, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC,
-    0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x0F, 0xF4, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x7F, 0xFA, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x07, 0xFD, 0x54, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x2A, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00, 0x0F, 0xFF, 0xE0,
-    0x07, 0xFF, 0xFF, 0x81, 0xFF, 0x9F, 0xFC, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC, 0x03, 0xF4, 0xBF, 0x80,
-    0x14, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFE, 0xAF, 0xFA, 0xBF, 0x3F, 0x07, 0xFC, 0x1F, 0xCF, 0xC1, 0xFF, 0x03, 0xE3, 0xF0,
-    0x7F, 0xC0, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x47, 0xFF, 0xE7, 0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF, 0x80, 0x0F, 0xF0, 0x07, 0xFE, 0x00, 0x3F,
-    0x80, 0x0F, 0xFC, 0x01, 0xFC, 0x00, 0x1F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0x40, 0x00,
-    0x7F, 0xC2, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0x40,
-    0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xEF, 0xFA, 0xFF,
-    0xC0, 0xFF, 0x82, 0xFD, 0x1F, 0xFC, 0x7F, 0xC0, 0xBF, 0x41, 0xFF, 0x2F, 0xE0, 0x2F, 0xD0, 0x3F,
-    0xDF, 0xF4, 0x0B, 0xF4, 0x0F, 0xFB, 0xFD, 0x02, 0xFD, 0x03, 0xFE, 0xFF, 0x80, 0xBF, 0x40, 0xFF,
-    0xBF, 0xE0, 0x2F, 0xD0, 0x3F, 0xD7, 0xFC, 0x0B, 0xF4, 0x1F, 0xF0, 0xFF, 0xC2, 0xFD, 0x1F, 0xF4,
-    0x1F, 0xFE, 0xFF, 0xBF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00,
-    0x02, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x7F, 0xFD, 0x3F, 0xFF,
-    0x42, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x01, 0xFF, 0x43, 0xF4, 0x00, 0x07, 0xFC, 0xFD, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0B, 0xF1, 0xFF, 0x00, 0x02, 0xFD, 0x0F, 0xFC, 0x00,
-    0xBF, 0x80, 0x3F, 0xF0, 0x3F, 0xFE, 0x0F, 0xFF, 0xEB, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0xFF, 0xFE, 0x07, 0xFE, 0x00, 0xBF, 0xC0,
-    0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x03, 0xFE,
-    0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x2F,
-    0xF0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xFA, 0xAF, 0xFD, 0x4B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF1, 0xFF, 0xFE, 0xBF,
-    0xFF, 0x1F, 0xFF, 0xD0, 0xFF, 0x80, 0x3F, 0xE0, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x3F,
-    0xD0, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x7F, 0xD0, 0x3F, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x1A, 0xA7, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x8F, 0xFF, 0x8F, 0xFF, 0xEF, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF,
-    0xF4, 0x7F, 0xD0, 0x3F, 0xD0, 0x2F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF4, 0x03, 0xFC, 0x03,
-    0xFD, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0xBF, 0x40, 0x3F, 0xC0, 0x3F, 0xD0, 0x2F, 0xD0,
-    0x0F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF4, 0x03, 0xFC, 0x03, 0xFD, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0xFF,
-    0x40, 0xBF, 0x40, 0x3F, 0xC0, 0x3F, 0xD0, 0x2F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF4, 0x03,
-    0xFE, 0xAB, 0xFE, 0xAB, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xF8, 0xFF,
-    0xFD, 0x3F, 0xFD, 0x3F, 0xFF, 0x41, 0xFF, 0x40, 0xFF, 0x40, 0xBF, 0x80, 0x0F, 0xF0, 0x0F, 0xF4,
-    0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF4, 0x00,
-    0xFF, 0x00, 0xFF, 0x40, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF,
-    0x40, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0xBF, 0x40,
-    0x0F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0xF8, 0x1F, 0xF0, 0x00, 0x02, 0xE0, 0x7F,
-    0xEA, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x3F,
-    0xD0, 0x00, 0x7F, 0xC0, 0xBF, 0x40, 0x01, 0xFF, 0x02, 0xFD, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00,
-    0x2F, 0xF5, 0xBF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFD, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xFA, 0xA4, 0x00, 0x3F, 0xD0, 0x0F, 0xFF, 0xFF, 0x80,
-    0x3F, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xD0, 0x0F, 0xF4, 0x2F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF4,
-    0x0F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF4, 0x1F, 0xF0, 0x3F, 0xD0,
-    0x0F, 0xF9, 0xBF, 0xD0, 0x7F, 0xE0, 0xBF, 0xFF, 0xFF, 0x83, 0xFF, 0xFD, 0xFF, 0xFF, 0xF9, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFF, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0xAA, 0x90, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0xFF, 0x40,
-    0xFF, 0x03, 0xFD, 0x03, 0xFC, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xE6, 0xFF, 0x8B, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xF9, 0x6F, 0xFC, 0x1E, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x55, 0x7F, 0xE0, 0x00, 0x00,
-    0xFF, 0x43, 0x80, 0x03, 0xFC, 0x3F, 0x40, 0x2F, 0xF0, 0xFF, 0x96, 0xFF, 0x03, 0xFF, 0xFF, 0xF4,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0x80, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0xF4, 0x07, 0xFE, 0x7F, 0xF8,
-    0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xFC, 0x0F, 0xF4, 0x1F, 0xF0, 0x07, 0xFD, 0x0F, 0xF4, 0x2F, 0xE0,
-    0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFE, 0x0F, 0xFA,
-    0xBF, 0xE0, 0x03, 0xFE, 0x0F, 0xF4, 0x3F, 0xF0, 0x03, 0xFD, 0x0F, 0xF4, 0x2F, 0xF0, 0x03, 0xFC,
-    0x0F, 0xF4, 0x1F, 0xF8, 0x0B, 0xF8, 0x0F, 0xF8, 0x0F, 0xFF, 0xAF, 0xF0, 0xBF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xF9, 0x2F, 0xE0, 0x0B,
-    0xF8, 0x0B, 0xF8, 0x02, 0xFE, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0xBF, 0x80, 0x0F, 0xFD, 0x2F, 0xE0,
-    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xF8, 0xBF, 0x80, 0x03, 0xFC, 0x2F,
-    0xE0, 0x02, 0xFE, 0x0B, 0xF8, 0x02, 0xFF, 0x02, 0xFF, 0x42, 0xFF, 0x43, 0xFF, 0xF9, 0xFF, 0x80,
-    0xFF, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x0F, 0xF4, 0xFF, 0x80, 0xFF, 0x4B, 0xF4,
-    0x02, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB,
-    0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x06, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xC2, 0xFF, 0x40, 0x07, 0xFE, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xD7, 0xFF,
-    0x40, 0x7F, 0xE0, 0x0F, 0xF8, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x0F, 0xFC, 0x07, 0xFD,
-    0x00, 0xBF, 0xC0, 0x7F, 0xD0, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0xBF, 0xC0, 0x7F, 0xD0, 0x0B, 0xFC,
-    0x07, 0xFD, 0x00, 0xBF, 0xC3, 0xFF, 0xFC, 0x0F, 0xF8, 0x7F, 0xFF, 0x80, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0xAF, 0xD0, 0xFF, 0x80, 0xFD, 0x0F, 0xF8,
-    0x0B, 0xC0, 0xFF, 0x80, 0xBC, 0x0F, 0xF8, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFF, 0xFD,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0x94, 0x00, 0x1F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xE1,
-    0xFF, 0x42, 0xFE, 0x3F, 0xC0, 0x0B, 0xD7, 0xF8, 0x00, 0x24, 0xBF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0xAA, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x53, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xF4, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x1A, 0x50, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFC, 0x3F, 0xC0,
-    0x2F, 0x0F, 0xF4, 0x06, 0x43, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0xBF, 0xF5, 0xF0, 0x03, 0xFD, 0xBE, 0x00, 0xBF, 0x6F, 0xE0, 0x7F, 0xC7, 0xFF,
-    0xFF, 0xD0, 0xBF, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3F, 0xE0, 0x07, 0xFF,
-    0x00, 0x7F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFE, 0x07,
-    0xFF, 0xE0, 0x1B, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x43, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xCF, 0xF4, 0xFF, 0x7F, 0xD3, 0xFD, 0x6D, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xF8, 0x01, 0xBF,
-    0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03,
-    0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xE0, 0x0B, 0xFD, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x07, 0xFF, 0xC0, 0xBF, 0xFC, 0x02, 0xFF, 0xC0, 0x07,
-    0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC,
-    0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
-    0xBF, 0x80, 0x1F, 0xF4, 0x07, 0xFF, 0x07, 0xFF, 0xC0, 0x7F, 0xF4, 0x02, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x1F, 0xE5, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0xEA, 0x90, 0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x03, 0xFE,
-    0xBF, 0xF0, 0x01, 0xF8, 0x0F, 0xF0, 0x3F, 0xD0, 0x0B, 0xD0, 0x3F, 0xC0, 0xBF, 0x40, 0x3F, 0x00,
-    0xFF, 0x02, 0xFD, 0x3A, 0xFC, 0x03, 0xFC, 0x0F, 0xF6, 0xFF, 0xD0, 0x1F, 0xF5, 0xBF, 0xCB, 0xFF,
-    0x02, 0xFF, 0xFF, 0xFD, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xE0, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF4,
-    0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0xAA, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xAF, 0xFC, 0x0F, 0xFA, 0xAA, 0xFF, 0x03, 0xFD, 0x0F, 0xF4, 0x01, 0xFF,
-    0x02, 0xFD, 0x0F, 0xF4, 0x01, 0xFF, 0x02, 0xFD, 0x0F, 0xF4, 0x01, 0xFF, 0x03, 0xFD, 0x0F, 0xF8,
-    0x02, 0xFF, 0x5B, 0xFC, 0xBF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x1A, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0xBF, 0xD0, 0x00, 0x7F, 0xEF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xD7, 0xFF, 0x80, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x40,
-    0x3F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8,
-    0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0xD0, 0xFF, 0xFF, 0x0F, 0xFF, 0xE7, 0xFF,
-    0xF8, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0xFF, 0xFF, 0x01, 0xFF, 0x0F, 0xFF, 0xE0, 0x3F, 0xF0, 0x1F, 0xF4, 0x0F, 0xFF, 0x00, 0xFF,
-    0x41, 0xFD, 0x00, 0x0F, 0xF4, 0x3F, 0x40, 0x00, 0xFF, 0x47, 0xE0, 0x00, 0x0F, 0xFE, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF5, 0xFF, 0x40, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x0F, 0xF4,
-    0x3F, 0xE0, 0x00, 0xFF, 0x41, 0xFF, 0x40, 0x0F, 0xF4, 0x0F, 0xFC, 0x0B, 0xFF, 0xF0, 0x3F, 0xF0,
-    0xFF, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0xBF, 0xFF, 0x3F, 0xFF, 0x81,
-    0xFF, 0xFC, 0x1F, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x7F, 0xF0,
-    0x03, 0xFD, 0x07, 0xFF, 0xC0, 0x0F, 0xF4, 0xBF, 0xFF, 0x00, 0x3F, 0xDB, 0xE3, 0xFC, 0x00, 0xFF,
-    0xFE, 0x0F, 0xF0, 0x03, 0xFF, 0xE0, 0x3F, 0xC0, 0x0F, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x03,
-    0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF4, 0x2F, 0xFF, 0x81, 0xFF, 0xFC, 0xFF, 0xFE, 0x0B, 0xFF, 0xF0,
-    0x00, 0x10, 0x00, 0x40, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x3F,
-    0xC3, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x2B, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD1, 0xFF, 0xF9, 0xFF, 0xFF, 0x03, 0xFF, 0xD0,
-    0xFF, 0xE0, 0x03, 0xFC, 0x01, 0xFF, 0x80, 0x0F, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x07, 0xFD,
-    0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x0F, 0xD0, 0x00, 0x1F, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0xC3, 0xF4,
-    0x00, 0x00, 0xBF, 0x9F, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xD0, 0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xE1, 0xFF, 0x80, 0x2F,
-    0xF0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0xFF,
-    0x80, 0x2F, 0xF0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x0F, 0xF8, 0x02, 0xFF,
-    0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0xFF, 0xEA, 0xBF, 0xF4, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xFE, 0x40,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x6A, 0xAB, 0xFE, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x07, 0xFC, 0x03, 0xF0, 0xFC, 0x07, 0xFC, 0x03, 0xF0, 0xF8,
-    0x07, 0xFC, 0x03, 0xE0, 0x10, 0x07, 0xFC, 0x01, 0x40, 0x00, 0x07, 0xFD, 0x50, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFD, 0x6F, 0xFD, 0x00, 0x07, 0xFC,
-    0x03, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02,
-    0xFF, 0x00, 0x07, 0xFC, 0x07, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x17, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0x5F, 0xF9, 0x7F, 0x00, 0xF4, 0x2F, 0xD0, 0x7C, 0x02, 0xD0, 0xBF, 0x41, 0xE0, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xA8, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xAB,
-    0xFE, 0x00, 0x02, 0xFD, 0x07, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x7F, 0xC0,
-    0x00, 0xFF, 0x47, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x07, 0xFD, 0x00,
-    0x03, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x7F, 0xC0, 0x00,
-    0x02, 0xFF, 0x6F, 0xFA, 0xAA, 0xAA, 0xBF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x00,
-    0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xF8, 0x00, 0x0B, 0xFC, 0x07, 0xFF, 0x80, 0x0B,
-    0xFD, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xF4, 0x2F, 0xF4, 0x3F, 0xC0, 0x0B, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0xBF,
-    0x40, 0x03, 0xFD, 0xFF, 0xAA, 0xAB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x95, 0x57, 0xFD, 0xFF,
-    0x40, 0x03, 0xFC, 0xBF, 0x80, 0x03, 0xFC, 0x7F, 0xD0, 0x0B, 0xF4, 0x3F, 0xF8, 0x2F, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x81, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x47, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFD, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0xB0, 0x0F, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xF8,
-    0x00, 0xBF, 0x40, 0x00, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x0F, 0xE0, 0x00, 0x01,
-    0xFF, 0x80, 0xBF, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x0F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xCF, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x7F,
-    0xFF, 0xD0, 0x0B, 0xFC, 0x3F, 0xFF, 0xC0, 0x1F, 0xFD, 0x0F, 0xFE, 0x00, 0x3F, 0xFC, 0x03, 0xFE,
-    0x00, 0x7F, 0xB8, 0x03, 0xFF, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0x40, 0xFD, 0x00, 0x00, 0xFF, 0x81,
-    0xFC, 0x00, 0x00, 0xBF, 0xC2, 0xF8, 0x00, 0x00, 0x3F, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0xE7, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x19, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF4, 0x1B, 0xFE, 0x00, 0x07, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x00,
-    0x0F, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x07,
-    0xFC, 0x03, 0xFE, 0xFF, 0x00, 0x07, 0xFC, 0x0F, 0xE2, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0x82, 0xFF,
-    0x00, 0x07, 0xFD, 0xFE, 0x02, 0xFF, 0x00, 0x07, 0xFF, 0xF8, 0x02, 0xFF, 0x00, 0x07, 0xFF, 0xE0,
-    0x02, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07,
-    0xFC, 0x00, 0x02, 0xFF, 0x00, 0x1B, 0xFE, 0x40, 0x07, 0xFF, 0xA0, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00,
-    0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x82, 0xFF, 0xFC, 0x3F, 0xFF, 0x42, 0xFF, 0xF8, 0x07, 0xFD, 0x00,
-    0x7F, 0xC0, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x03, 0xFC, 0x02, 0xFF, 0xC0, 0x03, 0xFC, 0x0B, 0xFF,
-    0xC0, 0x03, 0xFC, 0x2F, 0xFF, 0xC0, 0x03, 0xFC, 0xBE, 0x3F, 0xC0, 0x03, 0xFF, 0xF4, 0x3F, 0xC0,
-    0x03, 0xFF, 0xD0, 0x3F, 0xC0, 0x03, 0xFF, 0x40, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x07,
-    0xFD, 0x00, 0x7F, 0xD4, 0x3F, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0x83, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0x40, 0xBF, 0xE0, 0x1F, 0xF4, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x2F, 0xF0,
-    0x1F, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF4, 0x0B, 0xFD, 0x06, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFE, 0xFF, 0xD0, 0x3F, 0xC0, 0xBF, 0xC0, 0xFF, 0x01, 0xFF, 0x03, 0xFC, 0x07, 0xFC, 0x0F,
-    0xF0, 0x2F, 0xF0, 0x7F, 0xD6, 0xFF, 0x5F, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x6F,
-    0xFA, 0xFF, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x0F, 0xF4,
-    0x1F, 0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x71, 0xFF, 0x01, 0xFF, 0x1F, 0xFF, 0xC0, 0x7F, 0xD3, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xA5, 0xBC, 0x00, 0x7F, 0xC0,
-    0x0E, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xBF,
-    0xE9, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x54, 0x06, 0x40,
-    0x03, 0xFF, 0x8F, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFE,
-    0x02, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC,
-    0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x24, 0xBF, 0x80, 0x7F, 0xC3,
-    0xCF, 0xF4, 0x07, 0xFC, 0x2F, 0xFF, 0x00, 0x7F, 0xEA, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x07, 0xFD, 0x54, 0xF4, 0x00, 0x7F, 0xC0, 0x07, 0x80, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x2A,
-    0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xBF, 0xFF, 0xFF, 0x41, 0xFF,
-    0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE1, 0xFF, 0xEA, 0xA4, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F,
-    0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x6F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0x40, 0x2F, 0xC0, 0x1F, 0xF4, 0x02, 0xF8, 0x01, 0xFF, 0x40, 0x1F, 0x80, 0x1F, 0xF4, 0x01, 0xF0,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xEA, 0xFE, 0x03, 0xFE, 0x02, 0xF4, 0x0F, 0xF8,
-    0x07, 0xD0, 0x3F, 0xE0, 0x1F, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xAF, 0xFE, 0x90,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x40, 0x02,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0xFD, 0x00, 0x1F,
-    0xF4, 0x02, 0xF0, 0x00, 0x7F, 0xD0, 0x0B, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xFA, 0xBE, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFE, 0x56, 0xFF, 0xE0, 0x1F, 0xF4, 0x01, 0xFF, 0xC0, 0x7F, 0xD0, 0x02, 0xFF, 0x41, 0xFF,
-    0x40, 0x03, 0xFE, 0x07, 0xFD, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x3F, 0xE1, 0xBF, 0xF4, 0x00,
-    0xFF, 0xBF, 0xFF, 0xF8, 0x03, 0xFD, 0xFF, 0xFF, 0xE0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF5, 0x5B, 0xD0, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0xF0, 0x03, 0x80,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFA, 0xA9, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xF0, 0x0F, 0xFC, 0x0F, 0xF0, 0x03, 0xFE, 0x0F, 0xF0, 0x02, 0xFF, 0x0F, 0xF4, 0x02, 0xFF,
-    0xBF, 0xFF, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0x02, 0xE8, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x07, 0xFC, 0x01, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xFF, 0x02, 0xFF, 0xFF, 0x80, 0xBF, 0xF0, 0x0F, 0xFF, 0x40, 0x6F,
-    0xF8, 0x01, 0xFF, 0xF0, 0x0B, 0xBF, 0xC0, 0x0F, 0xF0, 0x03, 0xFE, 0xE0, 0x00, 0x0F, 0xE0, 0x0F,
-    0xF0, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x0F,
-    0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xAF,
-    0xFA, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x0F,
-    0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xF0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFF, 0xC0, 0x0B, 0xFF, 0x40, 0x2F, 0xFE, 0x00, 0xFF, 0xE0, 0x2F, 0xFE, 0x02, 0xFF,
-    0xFF, 0x80, 0x7F, 0xF8, 0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xF4, 0x2F, 0xF8, 0x1F, 0xFF, 0x42, 0xFF, 0x81,
-    0xFF, 0xD0, 0x3F, 0xC0, 0x7F, 0xF4, 0x00, 0xBF, 0x03, 0xFC, 0x0F, 0xE0, 0x00, 0x02, 0xF4, 0x3F,
-    0xC1, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xEF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFE, 0x7F, 0xD7, 0xFC, 0x00, 0x00, 0xBF, 0xC3,
-    0xFC, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x3F, 0xC1, 0xFF, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x0F, 0xFC,
-    0x00, 0xBF, 0xD0, 0x3F, 0xC0, 0x7F, 0xE0, 0x2F, 0xF8, 0x1F, 0xFF, 0x82, 0xFF, 0x87, 0xFF, 0x02,
-    0xFF, 0xF4, 0x0B, 0xFE, 0x05, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x01,
-    0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0x95, 0xBF, 0xE0, 0x3F, 0x80, 0x0F, 0xFC,
-    0x0F, 0xD0, 0x01, 0xFF, 0x02, 0xF0, 0x00, 0x7F, 0xC0, 0x14, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x1A, 0xAF, 0xF4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x05,
-    0x6F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x78, 0x00, 0x0F, 0xFC, 0x7F,
-    0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x02, 0xFF, 0x4B, 0xFF, 0x97, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x15, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x16, 0x90, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC2, 0xFD, 0x4B, 0xFD,
-    0x1E, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0x80, 0x01, 0x5B, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xE0, 0x01, 0xFF, 0x3F, 0x40, 0x2F, 0xF3,
-    0xFE, 0x5B, 0xFD, 0x3F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x01, 0x0B, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x90, 0x3F, 0xFF, 0xFC, 0x03, 0xFE, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xC0, 0x6F,
-    0xF8, 0x01, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0xFF, 0xB8, 0x01, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x7F,
-    0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xF0, 0x1F, 0xC0, 0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x01, 0xFF,
-    0xAF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFC,
-    0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x1F, 0xF0,
-    0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xBF, 0xF8,
-    0x03, 0xFF, 0x83, 0xFF, 0xFF, 0x80, 0x7F, 0xF8, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x14, 0x0F, 0xFF, 0xF0, 0x1F, 0xF0, 0xFF, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0xFF, 0xF0, 0x0F,
-    0xF4, 0x1F, 0xD0, 0x00, 0xFF, 0x43, 0xF4, 0x00, 0x0F, 0xF4, 0x7E, 0x00, 0x00, 0xFF, 0xEF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x5F, 0xF4, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0xFF,
-    0x43, 0xFE, 0x00, 0x0F, 0xF4, 0x1F, 0xF4, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0xBF, 0xFF, 0x03, 0xFF,
-    0x0F, 0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xF8, 0x0F, 0xFF, 0xFD, 0x00, 0xBF,
-    0xF0, 0x06, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xEB, 0x00, 0x1F, 0xF0, 0x00,
-    0xFD, 0x00, 0x00, 0x7F, 0xC7, 0x47, 0xF0, 0x00, 0x01, 0xFF, 0x1D, 0x3F, 0x40, 0x00, 0x07, 0xFC,
-    0x74, 0xFC, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x76, 0xFF, 0x00, 0x00, 0x1F, 0xF1, 0xD3, 0xFE, 0x00,
-    0x00, 0x7F, 0xC7, 0x4B, 0xFC, 0x00, 0x01, 0xFF, 0x08, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x2F,
-    0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF4, 0x01, 0xBF, 0xF8, 0x00, 0xBF, 0xF0, 0x3F, 0xFF, 0xF8,
-    0x00, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x0F, 0xFF, 0xD0, 0x0B, 0xF4, 0xFF, 0xFC, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x2F,
-    0xF8, 0x0F, 0xF0, 0x03, 0xF0, 0x00, 0xFF, 0x38, 0xBC, 0x00, 0x0F, 0xF3, 0x8F, 0x80, 0x00, 0xFF,
-    0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x3D, 0xFD, 0x00, 0x0F, 0xF3, 0x8F, 0xF0,
-    0x00, 0xFF, 0x38, 0x7F, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x2F, 0xF0, 0xBF, 0xFD,
-    0x00, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xE0, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0x00, 0x6F, 0xF8, 0x01,
-    0xFF, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xEE, 0x03, 0xFF, 0xFF, 0x87, 0xF4, 0x00, 0x3F, 0xFF, 0xF8,
-    0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xC0, 0x00, 0x01, 0xFF, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xFA,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0x1F,
-    0xF0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0xC0, 0x06,
-    0xFF, 0xE0, 0x0F, 0xFE, 0x03, 0xFF, 0xFF, 0x80, 0x7F, 0xF8, 0x3F, 0xFF, 0xF8, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x01, 0x54, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x64, 0x0B, 0xFF, 0xFD, 0x0B, 0xF8, 0x1F, 0xFF, 0xF0, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFF, 0x80,
-    0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0xFF, 0x0B, 0xD0, 0x00, 0x03, 0xFE,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x00, 0xFF, 0x0B, 0xFC,
-    0x00, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F,
-    0xFF, 0xD0, 0x7F, 0xF0, 0xBF, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x3F, 0x43, 0xFE, 0x00, 0xBF, 0xAC, 0x03, 0xF0,
-    0x3F, 0xE0, 0x0F, 0xD0, 0x00, 0x3F, 0x03, 0xFE, 0x02, 0xF8, 0x00, 0x00, 0x90, 0x3F, 0xE0, 0x7F,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0,
-    0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xF4, 0x3F, 0xFF, 0xFF, 0x02, 0xFF, 0x83, 0xFA, 0xBF,
-    0xC0, 0x7F, 0xF4, 0x3F, 0x07, 0xFC, 0x0F, 0xE0, 0x03, 0xE0, 0x7F, 0xC1, 0xFC, 0x00, 0x2E, 0x07,
-    0xFC, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xDB, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x00, 0xBF, 0xFF, 0x42, 0xFF, 0x80,
-    0x0F, 0xFF, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1B, 0xFE, 0x00,
-    0x07, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07,
-    0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF,
-    0x40, 0x07, 0xFE, 0xAA, 0xAB, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x07, 0xFE, 0x55, 0x56, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07,
-    0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF,
-    0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1B, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x0B, 0xFF, 0xF0, 0xFF, 0xFE, 0x0B, 0xFF, 0xF0, 0x1F, 0xF4, 0x00, 0xFF,
-    0x40, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFA, 0xAA, 0xFF, 0x00, 0x0F,
-    0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xF8,
-    0x00, 0xFF, 0x90, 0xBF, 0xFF, 0x07, 0xFF, 0xFC, 0xFF, 0xFF, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC6,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFE, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x42, 0xF8, 0x1F, 0xF4, 0x00,
-    0x07, 0xFD, 0x0B, 0xD0, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x2F, 0x41, 0xFF, 0x40, 0x00, 0x7F, 0xD0,
-    0x64, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0x55, 0x56,
-    0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF4,
-    0x00, 0x07, 0xFD, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xF1, 0xFF, 0x40, 0x0F, 0xFA, 0xBF, 0x0F,
-    0xF4, 0x00, 0xFF, 0x07, 0xF0, 0xFF, 0x40, 0x0F, 0xF0, 0x3E, 0x0F, 0xF4, 0x00, 0xFF, 0x03, 0xD0,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xAA, 0xAF, 0xF0, 0x00,
-    0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xBF, 0xFF, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0xBF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0xAF, 0xFF, 0x40, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xFB, 0xFF, 0x80, 0x00, 0x7F,
-    0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFD,
-    0x00, 0x0F, 0xFC, 0x07, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x7F, 0xD0,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x07, 0xFD, 0x00,
-    0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xC1, 0xBF, 0xF4, 0x01,
-    0xFF, 0xE4, 0x02, 0xFF, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x0B, 0xF8, 0xFF, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xA5, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFD, 0x05, 0x00,
-    0x00, 0xFF, 0x40, 0x2F, 0xEF, 0xFF, 0x40, 0x0F, 0xF4, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x40,
-    0x2F, 0xF9, 0x7F, 0xF0, 0x0F, 0xF4, 0x02, 0xFD, 0x00, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0xD0, 0x07,
-    0xFC, 0x0F, 0xF4, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x3F, 0xE0, 0x03, 0xFC, 0xBF, 0xFF,
-    0x0F, 0xFF, 0xC0, 0x3F, 0xCF, 0xFF, 0xE0, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x6F, 0xE4,
-    0x00, 0x07, 0xFE, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xF8, 0x0B, 0xFA, 0xFF, 0x40, 0x2F, 0xF0, 0x1F,
-    0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0x3F, 0xD0, 0x3F, 0xD0, 0x7F, 0xD0, 0x3F, 0xC0, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F,
-    0xE0, 0xBF, 0xC0, 0x7F, 0xC0, 0x3F, 0xD0, 0xBF, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F, 0xE0, 0x3F,
-    0xD0, 0x7F, 0xC0, 0x3F, 0xF0, 0x2F, 0xF0, 0xFF, 0x40, 0x2F, 0xF8, 0x0F, 0xF5, 0xFE, 0x00, 0x0F,
-    0xFE, 0x07, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xD2, 0xFF, 0xF0, 0x08, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFB, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x05, 0x90,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x15, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0x80,
-    0x3F, 0xD0, 0xFF, 0xFF, 0x81, 0xFE, 0x0B, 0xF0, 0xFF, 0x0B, 0xF4, 0x3F, 0xC2, 0xFD, 0x3F, 0xD0,
-    0xFE, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0x1F, 0xE3, 0xFD, 0x1F, 0xE0, 0x7F, 0x4F, 0xF4, 0x3F, 0xC2,
-    0xFC, 0x2F, 0xF0, 0xFF, 0x0F, 0xF0, 0x3F, 0xD0, 0xFE, 0xBF, 0x00, 0xBF, 0xD1, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xEB, 0x80, 0x6F, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x50, 0x15, 0x00, 0x00, 0x00,
-    0x6A, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xAB, 0xFD, 0x0B,
-    0xFD, 0x00, 0x3F, 0x47, 0xFD, 0x00, 0x0F, 0xD3, 0xFF, 0x00, 0x02, 0xF0, 0xFF, 0x40, 0x00, 0x10,
-    0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x5A, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x81,
-    0xFF, 0x9F, 0xFC, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC, 0x03, 0xF4, 0xBF, 0x80, 0x14, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x7C, 0x00, 0x01, 0x0B, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1A,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x40, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBE,
-    0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09, 0x00, 0xFF, 0x80, 0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xE8,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xAF, 0xFA, 0xBF, 0x3F, 0x07, 0xFC, 0x1F, 0xCF, 0xC1,
-    0xFF, 0x03, 0xE3, 0xF0, 0x7F, 0xC0, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xEB, 0xFF, 0xFE, 0x0B, 0xFF, 0xF4, 0x7F, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x7F, 0xE0, 0x07, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x81, 0xFC,
-    0x00, 0x00, 0x2F, 0xF0, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x43, 0xFF, 0xE3,
-    0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xFC,
-    0x01, 0xFC, 0x00, 0x1F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0x40, 0x00, 0xBF, 0xC2, 0xFC,
-    0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03, 0xFE, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xEB, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xF4, 0x7F, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
-    0xE0, 0x07, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x41, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0x5F,
-    0xFD, 0x54, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x43, 0xFF, 0xE3, 0xFF, 0xFC, 0x0F,
-    0xFF, 0x43, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xFC, 0x01, 0xFC, 0x00,
-    0x1F, 0xF4, 0x0F, 0xE0, 0x00, 0x3F, 0xE0, 0x3F, 0x40, 0x00, 0x7F, 0xC1, 0xFC, 0x00, 0x00, 0xFF,
-    0x0F, 0xD0, 0x00, 0x02, 0xFD, 0x3F, 0x00, 0x00, 0x03, 0xFA, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x06, 0xBF, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0xAA, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x01, 0xFF,
-    0xC0, 0xBF, 0x40, 0x00, 0x02, 0xFF, 0x87, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x7F, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xFC,
-    0x00, 0x00, 0x00, 0xFE, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0x40,
-    0x3F, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xE4, 0x01, 0xFF, 0xF9, 0x1F, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xFC, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF8, 0x7F, 0xFD, 0x3F, 0xFF, 0x42, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x01,
-    0xFF, 0x43, 0xF4, 0x00, 0x07, 0xFC, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0B,
-    0xF1, 0xFF, 0x00, 0x02, 0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0x80, 0x3F, 0xF4, 0x3F, 0xFE, 0x0F, 0xFF,
-    0xFB, 0xFF, 0xE1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFC, 0x0F, 0xD7, 0xFE, 0x7F, 0x07, 0xFF, 0x40, 0x3E, 0x0F, 0xF4, 0xBC, 0x0F,
-    0xFC, 0x00, 0xF4, 0x3F, 0xD2, 0xF0, 0x3F, 0xF0, 0x02, 0xC0, 0xFF, 0x4B, 0x40, 0xFF, 0xC0, 0x00,
-    0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x7F, 0xFE, 0x0F, 0x8B, 0xF5, 0xF0, 0x7F, 0xC0, 0x3E, 0x2F,
-    0xD3, 0xC0, 0xFF, 0x00, 0xF4, 0xBF, 0x4F, 0x03, 0xFC, 0x00, 0x42, 0xFD, 0x10, 0x0F, 0xF0, 0x00,
-    0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xFC,
-    0x00, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0xAA, 0xAB, 0xFD, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0x47, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x06, 0xFF, 0xD0, 0x0B, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x00,
-    0x1F, 0xFF, 0x9A, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0A, 0xA9, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x7F, 0xFF, 0x8B, 0xFF, 0xF1, 0xFF, 0xFD,
-    0x03, 0xFE, 0x00, 0xFF, 0x80, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x0F, 0xF4, 0x00, 0xBF,
-    0xC0, 0x3F, 0xD0, 0x01, 0xFF, 0x40, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0xF4, 0x00, 0x01, 0xAA, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFD, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xBF, 0xF4, 0x02, 0xFF,
-    0xD0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x10, 0xFF, 0xC0, 0x03, 0xFF, 0x0F, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0xF0,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x2A, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0xFF, 0xFF, 0xBF, 0xFF, 0x0F, 0xFF, 0xE0, 0xFF, 0x80, 0x2F,
-    0xF0, 0x0B, 0xF8, 0x02, 0xFF, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x0B, 0xFC, 0x72, 0xFF, 0x00, 0x7F,
-    0xCB, 0x2F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1A, 0xFA, 0xFF,
-    0x00, 0x00, 0x0B, 0x2F, 0xF0, 0x00, 0x00, 0x62, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xF5, 0x1F, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x7F,
-    0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x40, 0x07,
-    0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0x40, 0x2F, 0xFE, 0x4F,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x64,
-    0x00, 0x07, 0xFC, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x01,
-    0xFF, 0xD0, 0x7F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0,
-    0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x03, 0xFE,
-    0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0xD0, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xE7, 0xFF, 0xF8, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE5, 0xBF,
-    0xF0, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x0F, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0x0B, 0xFC,
-    0x00, 0x03, 0xFD, 0x7F, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x7F, 0x5F, 0xF4, 0x00, 0x03, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x06, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF4, 0x01, 0xAC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x05,
-    0x90, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0x43, 0xFE, 0x5F, 0xFC,
-    0x3D, 0x1F, 0xE0, 0x0F, 0xF1, 0xF4, 0xFF, 0x00, 0x3F, 0xD7, 0xE7, 0xFC, 0x00, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0x55, 0x55, 0x40, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x10, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xE5, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x0F, 0x03, 0xFD, 0x00,
-    0x07, 0xFC, 0x3F, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x7F, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x7F, 0x5F,
-    0xF4, 0x00, 0x03, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x01, 0xAC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x05, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0x43,
-    0xFE, 0x5F, 0xFC, 0x3D, 0x1F, 0xE0, 0x0F, 0xF1, 0xF4, 0xFF, 0x00, 0x3F, 0xD7, 0xE7, 0xFC, 0x00,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0x55, 0x55, 0x40,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x10, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0x06, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07,
-    0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x3F, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x90, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xFF, 0x02, 0xFF, 0xFF,
-    0x80, 0xBF, 0xF0, 0x0F, 0xFF, 0x40, 0x6F, 0xF8, 0x01, 0xFF, 0xF0, 0x0B, 0xBF, 0xC0, 0x0F, 0xF0,
-    0x03, 0xFE, 0xE0, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xF0,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xFA, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xF0,
-    0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xF0,
-    0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x07, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xF0, 0x03, 0xFF, 0xC0, 0x0B, 0xFF, 0x40, 0x2F, 0xFE,
-    0x00, 0xFF, 0xE0, 0x2F, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0x7F, 0xF8, 0x7F, 0xF8, 0x03, 0xFF, 0xFF,
-    0x80, 0x1F, 0xFE, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x10, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x90, 0x0F,
-    0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0x42, 0xFF, 0x81, 0xFF, 0xF4, 0x2F, 0xF8, 0x1F, 0xFD, 0x03, 0xFC,
-    0x07, 0xFF, 0x40, 0x0B, 0xF0, 0x3F, 0xC0, 0xFE, 0x00, 0x00, 0x2F, 0x43, 0xFC, 0x1F, 0xC0, 0x00,
-    0x00, 0xFC, 0x3F, 0xC3, 0xF0, 0x00, 0x00, 0x0B, 0xFB, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xE7, 0xFD, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xC3, 0xFE, 0x00,
-    0x00, 0xFF, 0x43, 0xFC, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x3F, 0xC0, 0xFF, 0xC0, 0x0B, 0xFD, 0x03,
-    0xFC, 0x07, 0xFE, 0x02, 0xFF, 0x81, 0xFF, 0xF8, 0x2F, 0xF8, 0x7F, 0xF0, 0x2F, 0xFF, 0x40, 0xBF,
-    0xD0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFC, 0xFF, 0xFF, 0xD0, 0x2F, 0xFC, 0x1B, 0xFE, 0x00, 0x7F, 0xFC, 0x07, 0xFC, 0x00, 0xFF, 0xAC,
-    0x07, 0xFC, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x07, 0xF0, 0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x07,
-    0xFC, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xF4, 0x07, 0xFC, 0x00,
-    0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x0B,
-    0xFC, 0x1B, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0xFF, 0xE0, 0x0F, 0xF8, 0xFF, 0xFF, 0xE0, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x01, 0xAF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x3F, 0xFF, 0xC0, 0x7F, 0xCF, 0xFF, 0xE0, 0x7F, 0xF0, 0x7F, 0xD0, 0x3F, 0xFC, 0x0F,
-    0xF4, 0x1F, 0xD0, 0x03, 0xFD, 0x0F, 0xD0, 0x00, 0xFF, 0x4B, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x6F, 0xFF, 0x00, 0xFF, 0x40, 0xBF, 0xD0, 0x3F, 0xD0, 0x0F,
-    0xF8, 0x0F, 0xF4, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x7F, 0xCB, 0xFF, 0xF0, 0x1F, 0xF3, 0xFF, 0xF8,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x2E, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x01, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFF,
-    0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x0F,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xBE, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xC0,
-    0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xC0, 0x10, 0x7F, 0x40, 0x0F, 0xFC, 0x03, 0xDF, 0xF0,
-    0x00, 0xFF, 0xC0, 0x7F, 0xFD, 0x00, 0x2F, 0xFE, 0x4B, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0x3F, 0xE0,
-    0x03, 0xFF, 0xFF, 0xE0, 0x50, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xE5, 0xFF, 0x80, 0x00, 0x2F, 0x02, 0xFE, 0x00, 0x00, 0xBC, 0x0B,
-    0xF8, 0x00, 0x03, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xC0, 0xBF, 0x80, 0x00, 0x3F, 0x02, 0xFE, 0x00,
-    0x01, 0xF8, 0x0B, 0xF8, 0x00, 0x0B, 0xD0, 0x2F, 0xE0, 0x00, 0x3F, 0x00, 0xBF, 0x80, 0x3A, 0xFC,
-    0x02, 0xFE, 0x02, 0xFF, 0xD0, 0x0F, 0xFD, 0x0B, 0xFF, 0x03, 0xFF, 0xFF, 0x1F, 0xF0, 0x1F, 0xFF,
-    0xFC, 0x05, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x86,
-    0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD,
-    0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x01,
-    0xFF, 0x40, 0x1F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFE, 0x55, 0x56, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F,
-    0xD0, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40,
-    0x1F, 0xF4, 0x00, 0x07, 0xFC, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xF0, 0x3F, 0xFF, 0xFC, 0x00, 0x7F,
-    0xC0, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0xBF, 0xFF, 0x07, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01,
-    0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFA, 0xAB, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFE,
-    0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x0B, 0xFF, 0xF0, 0x1F,
-    0xF0, 0x3F, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x7F, 0xF4, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1B, 0xFE, 0x00, 0x07, 0xFF, 0x80,
-    0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01,
-    0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFE,
-    0xAA, 0xAB, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x07, 0xFE, 0x55, 0x56, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01,
-    0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD,
-    0x00, 0x01, 0xFF, 0x40, 0x1B, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xCF, 0xFF, 0xE0, 0xBF, 0xFF, 0x07, 0xFD, 0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00,
-    0xFF, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xEA, 0xAB, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFD,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x4B, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xC1, 0xBF, 0xF4, 0x02, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xF9, 0xAF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2A, 0xA4, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF1, 0xFF,
-    0xFE, 0xBF, 0xFF, 0x1F, 0xFF, 0xD0, 0xFF, 0x80, 0x3F, 0xE0, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0xBF,
-    0x80, 0x3F, 0xD0, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x7F, 0xD0, 0x3F, 0xD0, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x1A, 0xA7, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xD0, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0xFD, 0xFF, 0x41,
-    0xFA, 0xFE, 0x00, 0x00, 0xFD, 0x7F, 0x82, 0xF1, 0xFE, 0x00, 0x00, 0xFC, 0x3F, 0xC3, 0xF1, 0xFF,
-    0x00, 0x00, 0xFC, 0x3F, 0xC7, 0xE1, 0xFF, 0x00, 0x00, 0xFC, 0x2F, 0xDB, 0xD0, 0xFF, 0x00, 0x01,
-    0xFC, 0x0F, 0xEF, 0xC0, 0xFF, 0x00, 0x01, 0xFC, 0x0F, 0xFF, 0x80, 0xFF, 0x00, 0x02, 0xFC, 0x0B,
-    0xFF, 0x40, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xFE, 0x00,
-    0xFF, 0x40, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0xFC, 0x01, 0xFF, 0xE4,
-    0x3F, 0xFF, 0xC0, 0x40, 0x0F, 0xFF, 0xFD, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF8, 0xBF, 0xFE, 0x00, 0x2F, 0xFF, 0x40, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
-    0x40, 0xBF, 0xF8, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x0F, 0xDF, 0xC2, 0xF7, 0xF8, 0x00, 0xFD,
-    0xFE, 0x3E, 0x3F, 0x80, 0x0F, 0xD7, 0xFB, 0xC3, 0xF8, 0x00, 0xFD, 0x3F, 0xFC, 0x3F, 0x80, 0x0F,
-    0xD2, 0xFF, 0x43, 0xF8, 0x00, 0xFD, 0x0F, 0xF0, 0x3F, 0x80, 0x0F, 0xD0, 0xBD, 0x03, 0xF8, 0x00,
-    0xFD, 0x02, 0x40, 0x7F, 0xD0, 0xBF, 0xFC, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xC0, 0x07, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x7F, 0xFF, 0xD0, 0x7F, 0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xD0,
-    0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03,
-    0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD,
-    0x00, 0x3F, 0xD0, 0x07, 0xFE, 0x07, 0xFF, 0xFE, 0xBF, 0xFF, 0xD0, 0x00, 0x06, 0x00, 0x18, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xF0,
-    0x00, 0x00, 0x01, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x02,
-    0xFF, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xE5, 0x5F, 0xFC, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xD5, 0x55, 0xFF, 0xC0, 0x00,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE4, 0x00, 0x1F, 0xFE,
-    0x4B, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x01, 0x00, 0x04, 0x00,
-    0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x06, 0x80, 0x69,
-    0x00, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF8,
-    0x3F, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x00, 0x02, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x0F,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xF9, 0x57, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xF5, 0x55, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xD0,
-    0x01, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xF9, 0x00, 0x07, 0xFF, 0x92, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xBE, 0x00,
-    0x1F, 0xF0, 0xFF, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x0B, 0x80, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0,
-    0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFB, 0xFD, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFC,
-    0xFF, 0x40, 0x1F, 0x40, 0x00, 0x00, 0xFD, 0x3F, 0xD0, 0x02, 0x40, 0x00, 0x00, 0xBF, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xAA, 0xA4,
-    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xF9, 0x5B, 0xFE, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x40, 0x01, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x03,
-    0xFD, 0x00, 0x3F, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x40, 0x1F, 0xC0, 0x7F, 0xD0, 0x01, 0xBF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x16, 0x40, 0x05, 0x90, 0x00, 0x2F, 0xFF, 0x87, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFE, 0x5F, 0xFF, 0x57, 0xFD, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0xF3, 0xF4, 0x0B, 0xF8,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0x95, 0xAF, 0xF0, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFA, 0x92, 0xFF, 0xEB, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0x80, 0x00, 0x0B, 0xF8, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x5B, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xD1, 0xFF, 0xF8, 0x0F, 0xFF, 0xF4, 0x01, 0x54, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x90, 0x02, 0x80, 0x00, 0xBD, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0xFE, 0x00, 0x07, 0xFE, 0xFF, 0x00,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4,
-    0x00, 0xBD, 0x07, 0xFD, 0x00, 0x1F, 0x41, 0xFF, 0x40, 0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x1F, 0xF9, 0x55, 0x40, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0xF4, 0x1F, 0xF4, 0x00, 0x7E, 0x07, 0xFD, 0x00, 0x3F, 0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0x00, 0x04, 0x00, 0xBD, 0x02, 0xF0, 0x0B, 0xE0, 0x3F,
-    0x40, 0x7F, 0x4B, 0xF0, 0x03, 0xFF, 0xFD, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE,
-    0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95,
-    0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0xAF, 0xFF, 0xC0, 0x7F, 0x40, 0x07,
-    0xFF, 0x80, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFE, 0x00, 0x00, 0xFF, 0xCF, 0xF8, 0x00, 0x03,
-    0xFD, 0x2F, 0xE0, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x0F, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x0B, 0xF9, 0xBF,
-    0xFC, 0x74, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xE5, 0x55, 0x57, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x40, 0x2F, 0xDF, 0xF4, 0x03, 0xFC, 0xBF, 0x80, 0x7F,
-    0x87, 0xFE, 0x6F, 0xF0, 0x2F, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0xA8, 0x06, 0x80, 0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x7F, 0x43,
-    0xF8, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x90, 0x00,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xEA, 0xFF, 0xFC, 0x07, 0xF4,
-    0x00, 0x7F, 0xF8, 0x0F, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0xFF, 0x80,
-    0x00, 0x3F, 0xD2, 0xFE, 0x00, 0x02, 0xFF, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x3F, 0xD2, 0xFE, 0x03, 0xFD,
-    0x2F, 0xE0, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00,
-    0x0B, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0xBF, 0x9B, 0xFF, 0xC7, 0x40, 0x0B, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x02, 0xFE, 0x55, 0x55, 0x7F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xF4, 0x02, 0xFD, 0xFF, 0x40, 0x3F, 0xCB, 0xF8, 0x07, 0xF8, 0x7F, 0xE6, 0xFF, 0x02, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x0A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40,
-    0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xFF, 0x02, 0xFF, 0xFF, 0x80, 0xBF, 0xF0,
-    0x0F, 0xFF, 0x40, 0x6F, 0xF8, 0x01, 0xFF, 0xF0, 0x0B, 0xBF, 0xC0, 0x0F, 0xF0, 0x03, 0xFE, 0xE0,
-    0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x00,
-    0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xF0, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xAF, 0xFA, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xF0, 0x7F, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x0F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xF0, 0x1F, 0xF8, 0x00,
-    0x00, 0x3F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xF0, 0x07, 0xFF, 0x00,
-    0x02, 0xFF, 0xC0, 0x0F, 0xF0, 0x03, 0xFF, 0xC0, 0x0B, 0xFF, 0x40, 0x2F, 0xFE, 0x00, 0xFF, 0xE0,
-    0x2F, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0x7F, 0xF8, 0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFE,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x79, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x90, 0x0F, 0xF0, 0x1F, 0xFF,
-    0x80, 0xFF, 0x42, 0xFF, 0x81, 0xFF, 0xF4, 0x2F, 0xF8, 0x1F, 0xFD, 0x03, 0xFC, 0x07, 0xFF, 0x40,
-    0x0B, 0xF0, 0x3F, 0xC0, 0xFE, 0x00, 0x00, 0x2F, 0x43, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x3F,
-    0xC3, 0xF0, 0x00, 0x00, 0x0B, 0xFB, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xE7, 0xFD, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xC3, 0xFE, 0x00, 0x00, 0xFF, 0x43,
-    0xFC, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x3F, 0xC0, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFC, 0x07, 0xFE,
-    0x02, 0xFF, 0x81, 0xFF, 0xF8, 0x2F, 0xF8, 0x7F, 0xF0, 0x2F, 0xFF, 0x40, 0xBF, 0xD0, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x02, 0x90, 0x1A, 0x00, 0x03, 0xFD, 0x1F, 0xE0, 0x00, 0xFF, 0x8B, 0xFC,
-    0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x01, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA,
-    0x40, 0x00, 0x1B, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x0B, 0xF9, 0x5B, 0xFE, 0x03, 0xF8,
-    0x00, 0xFF, 0xC0, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0x00, 0x07, 0xFC, 0x01, 0x40, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x01, 0xAA, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x56, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x07, 0x80, 0x00,
-    0xFF, 0xC7, 0xF0, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x2F, 0xF4, 0xBF, 0xF9, 0x7F, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0x59, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x03, 0xF0, 0x0F, 0xF4, 0xBF, 0x80, 0xFF, 0x4B, 0xF8, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x2F, 0xD4,
-    0xBF, 0xD1, 0xE0, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0x00,
-    0x07, 0xFF, 0xF8, 0x00, 0x15, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x1E, 0x00, 0x1F, 0xF3, 0xF4, 0x02,
-    0xFF, 0x3F, 0xE5, 0xBF, 0xD3, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF9, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFD, 0x2F,
-    0x80, 0x0B, 0xF8, 0x2F, 0x40, 0x1F, 0xE0, 0x0F, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x04, 0x00, 0x03, 0xFE, 0x1E,
-    0x00, 0x03, 0xFE, 0x3F, 0x80, 0x0B, 0xFC, 0x3F, 0xFA, 0xBF, 0xF8, 0x2F, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0x3F, 0x00, 0x3F, 0xC0, 0xB8, 0x03, 0xFC, 0x00, 0x80, 0x2F,
-    0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0xB0, 0x00, 0x3F, 0xC7, 0xF0, 0x02, 0xFF, 0x1F, 0xF9,
-    0x6F, 0xF4, 0x3F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF0, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFD, 0x1B, 0xFE, 0x00, 0x07,
-    0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x00,
-    0x03, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x7F,
-    0xC0, 0x3F, 0xEF, 0xF0, 0x01, 0xFF, 0x03, 0xF8, 0xBF, 0xC0, 0x07, 0xFC, 0x3F, 0x82, 0xFF, 0x00,
-    0x1F, 0xF7, 0xF8, 0x0B, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x2F, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0xBF,
-    0xC0, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
-    0x2F, 0xF0, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xE4, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF,
-    0x80, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0xBF, 0xFF, 0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x1F, 0xF4, 0x00, 0xFF, 0x00, 0x3F,
-    0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x7F, 0xF0, 0x03, 0xFD, 0x07, 0xFF, 0xC0, 0x0F, 0xF4, 0xBF,
-    0xFF, 0x00, 0x3F, 0xDB, 0xE3, 0xFC, 0x00, 0xFF, 0xFE, 0x0F, 0xF0, 0x03, 0xFF, 0xE0, 0x3F, 0xC0,
-    0x0F, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF4, 0x2F, 0xFF,
-    0x81, 0xFF, 0xFC, 0xFF, 0xFE, 0x0B, 0xFF, 0xF0, 0x00, 0x02, 0x90, 0x2A, 0x00, 0x00, 0x00, 0x3F,
-    0xD2, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x00,
-    0x01, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF4, 0x6F, 0xF8, 0x00, 0x1F,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00,
-    0x0F, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0xF0, 0x01, 0xFF,
-    0x00, 0xFF, 0xBF, 0xC0, 0x07, 0xFC, 0x0F, 0xE2, 0xFF, 0x00, 0x1F, 0xF0, 0xFE, 0x0B, 0xFC, 0x00,
-    0x7F, 0xDF, 0xE0, 0x2F, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xC0, 0x07, 0xFF, 0xE0, 0x02, 0xFF,
-    0x00, 0x1F, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x00,
-    0xBF, 0xC0, 0x1B, 0xFE, 0x40, 0x07, 0xFF, 0x93, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0x0F, 0xF0,
-    0xFF, 0x40, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x79, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0B, 0xFF, 0xF3, 0xFF,
-    0xF8, 0x1F, 0xFF, 0xC1, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x07,
-    0xFF, 0x00, 0x3F, 0xD0, 0x7F, 0xFC, 0x00, 0xFF, 0x4B, 0xFF, 0xF0, 0x03, 0xFD, 0xBE, 0x3F, 0xC0,
-    0x0F, 0xFF, 0xE0, 0xFF, 0x00, 0x3F, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0xE0, 0x0F, 0xF0, 0x03, 0xFE,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x01, 0xFF, 0x42, 0xFF, 0xF8, 0x1F, 0xFF, 0xCF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0x00, 0x00, 0x0A, 0x40, 0xA8, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x3F,
-    0xE0, 0x00, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x3F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0xC7, 0xFD, 0x00, 0x00, 0x2F,
-    0xF6, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x7F,
-    0xDF, 0xFC, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x03, 0xFF,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0,
-    0x0B, 0xFF, 0xFB, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x07, 0xFC, 0x7F,
-    0xC0, 0x07, 0xFC, 0x7F, 0xC0, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF,
-    0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B,
-    0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x07,
-    0xFD, 0x00, 0x03, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x6F, 0xFA, 0xAA, 0xAA, 0xBF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFE,
-    0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xF8, 0x00, 0x0B, 0xFC, 0x07, 0xFF,
-    0x80, 0x0B, 0xFD, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF4, 0x2F, 0xF4, 0x3F, 0xC0, 0x0B, 0xFC, 0x7F, 0x80, 0x03,
-    0xFC, 0xBF, 0x40, 0x03, 0xFD, 0xFF, 0xAA, 0xAB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x95, 0x57,
-    0xFD, 0xFF, 0x40, 0x03, 0xFC, 0xBF, 0x80, 0x03, 0xFC, 0x7F, 0xD0, 0x0B, 0xF4, 0x3F, 0xF8, 0x2F,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x0A, 0x40,
-    0xA8, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x07,
-    0xF4, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFA, 0xBF,
-    0xFD, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xF8, 0x3F, 0xE0, 0x00, 0x07,
-    0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0xAA, 0xAA, 0xAB,
-    0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x1F,
-    0xF6, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0x43, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x7F, 0xF8, 0x00, 0xBF, 0xD0, 0x0B, 0xFF, 0xFB, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x07, 0xFC, 0x7F, 0xC0, 0x07, 0xFC, 0x7F, 0xC0,
-    0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF4, 0x2F, 0xF4, 0x3F, 0xC0, 0x0B, 0xFC,
-    0x7F, 0x80, 0x03, 0xFC, 0xBF, 0x40, 0x03, 0xFD, 0xFF, 0xAA, 0xAB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0x95, 0x57, 0xFD, 0xFF, 0x40, 0x03, 0xFC, 0xBF, 0x80, 0x03, 0xFC, 0x7F, 0xD0, 0x0B, 0xF4,
-    0x3F, 0xF8, 0x2F, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x02, 0x90, 0x1A, 0x00, 0x00, 0xFF, 0x47, 0xF8, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0xBF, 0x07,
-    0xF4, 0x00, 0x01, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x9B, 0xFF, 0xE0, 0x3F, 0x80, 0x07,
-    0xFF, 0x03, 0xF0, 0x00, 0x1F, 0xF8, 0x3F, 0x00, 0x00, 0xFF, 0xC1, 0xA0, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x01, 0xAA, 0xAB, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x01, 0x55, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xD0,
-    0x00, 0x0F, 0xFC, 0x7F, 0x00, 0x02, 0xFF, 0x4F, 0xF8, 0x00, 0xBF, 0xE0, 0xBF, 0xFA, 0xBF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x81, 0xFC, 0x00, 0xFF, 0x0F, 0xF4, 0x03, 0xFC, 0x3F, 0xD0, 0x07, 0x90, 0x6D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xFF, 0x02, 0xFE, 0x5B, 0xFF, 0x07, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x15, 0x5F, 0xF8, 0x00, 0x00,
-    0x3F, 0xD0, 0xE0, 0x00, 0xFF, 0x0F, 0xD0, 0x0B, 0xFC, 0x3F, 0xE5, 0xBF, 0xC0, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFE, 0x1F, 0xFE, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xFE, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0x40, 0x00, 0x0F, 0xF4, 0x1F,
-    0xC0, 0x00, 0x02, 0xFE, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x00, 0x0B, 0xFB, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x10, 0x3F, 0x80, 0x00, 0x00, 0x3D, 0x2F, 0xC0, 0x00,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x1F, 0xFF, 0x9F, 0xFF, 0xF0, 0x3F, 0xFD, 0x0F, 0xFE, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0xF0, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x3F, 0xC0, 0x00,
-    0xFF, 0x80, 0xFD, 0x00, 0x01, 0xFF, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x0B, 0xF9,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x0D, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x68, 0x00,
-    0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x43, 0xF8, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xBF, 0xFF, 0xE0, 0x7F, 0xFF, 0x87, 0xFF, 0x80, 0x02, 0xFF, 0x00,
-    0x7F, 0xE0, 0x00, 0xBF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x80, 0x2F, 0xC0, 0x00,
-    0x2F, 0xF0, 0x0F, 0xD0, 0x00, 0x03, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x83, 0xF4, 0x00, 0x00,
-    0x0F, 0xF1, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x04,
-    0x0F, 0xE0, 0x00, 0x00, 0x0F, 0x4B, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFC,
-    0x00, 0x00, 0x79, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD1, 0xFF, 0xF9, 0xFF, 0xFF, 0x03, 0xFF, 0xD0, 0xFF, 0xE0,
-    0x03, 0xFC, 0x01, 0xFF, 0x80, 0x0F, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x07, 0xFD, 0x03, 0xFC,
-    0x00, 0x0F, 0xF8, 0x0F, 0xD0, 0x00, 0x1F, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x00,
-    0xBF, 0x9F, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0xD0, 0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0xC0, 0x00, 0x07, 0xFC,
-    0x3F, 0xD0, 0x00, 0x03, 0xF8, 0x2F, 0xD0, 0x00, 0x02, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0x60, 0x03,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFB, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0x2F, 0xF0, 0x07, 0xFE, 0x00, 0x0B,
-    0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xF8, 0x02, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0xFD,
-    0x00, 0x00, 0x3F, 0xD0, 0x7F, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0x1F, 0xC0,
-    0x00, 0x00, 0x2F, 0xEF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x40, 0xFE, 0x00, 0x00,
-    0x00, 0xF4, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x43, 0xD0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0xBE, 0x00, 0x00, 0x0F,
-    0xC3, 0xF0, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x01, 0xF0, 0xB8, 0x00, 0x00, 0x01, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x1F, 0xFF, 0x9F,
-    0xFF, 0xF0, 0x3F, 0xFD, 0x0F, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0xF0,
-    0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0xFD, 0x00, 0x01, 0xFF, 0x0B, 0xF0,
-    0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0D, 0x03, 0xFC, 0x00, 0x00,
-    0xBF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x29, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x1F,
-    0xF0, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xBF, 0xF4, 0x02, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xF9, 0xAF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2A, 0xA4, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xBE,
-    0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0xB8, 0x07, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x1F, 0xFF,
-    0xEB, 0xFF, 0xF1, 0xFF, 0xFD, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x0B, 0xF8,
-    0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x3F, 0xD0, 0x07, 0xFD, 0x03, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xAA, 0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0x6F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFD, 0x00, 0xBF, 0x01, 0xFF, 0x40, 0x2F, 0x80, 0x7F, 0xD0, 0x07, 0xE0, 0x1F, 0xF4,
-    0x01, 0xF0, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xEA,
-    0xFD, 0x0F, 0xF8, 0x0F, 0xD0, 0xFF, 0x80, 0xBC, 0x0F, 0xF8, 0x0B, 0xC0, 0xFF, 0x80, 0x10, 0x0F,
-    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0xD4, 0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x1A, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFD, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFD, 0x1B,
-    0xFE, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xC0, 0x07, 0xFD,
-    0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0xFF,
-    0x80, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0xFF, 0x40, 0xFF,
-    0xC0, 0x07, 0xFD, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x1B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE4, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x40, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x40, 0x00,
-    0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFD, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFC,
-    0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xD0, 0x0F, 0xFA, 0xA4, 0x00, 0x3F, 0xD0, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xD0, 0x0F, 0xF4, 0x2F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xD0,
-    0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF4, 0x1F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF9, 0xBF, 0xD0,
-    0x7F, 0xE0, 0xBF, 0xFF, 0xFF, 0x83, 0xFF, 0xFD, 0xFF, 0xFF, 0xF9, 0x03, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x6F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x2F, 0xC0, 0x1F, 0xF4, 0x02, 0xF8, 0x01,
-    0xFF, 0x40, 0x1F, 0x80, 0x1F, 0xF4, 0x01, 0xF0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x41, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xEA, 0xFE, 0x03, 0xFE, 0x02,
-    0xF4, 0x0F, 0xF8, 0x07, 0xD0, 0x3F, 0xE0, 0x1F, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0xAF, 0xFE, 0x90, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x02, 0x5F, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0x3F, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x07, 0xFF, 0x02,
-    0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xDF, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xE1, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xF4, 0x00, 0x2F,
-    0xE0, 0x01, 0xFF, 0xC0, 0x0B, 0xFE, 0x40, 0x0B, 0xFE, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0xBF,
-    0xFF, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xAF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x7F, 0xFD, 0x3F,
-    0xFF, 0x42, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x01, 0xFF, 0x43, 0xF4, 0x00, 0x07, 0xFC, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0B, 0xF1, 0xFF, 0x00, 0x02, 0xFD, 0x0B, 0xF8,
-    0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x3F, 0xFE, 0x01, 0xFF, 0x0B, 0xFF, 0xE0, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xC0, 0x7F,
-    0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x02, 0xFD, 0x00, 0x00,
-    0x1F, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xDF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x05, 0x6F, 0xFF, 0x95, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0xAF, 0xFF, 0xEA, 0x00,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xE1, 0xFF, 0x80,
-    0x00, 0x03, 0xFC, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x2F, 0xE0, 0x01, 0xFF,
-    0xC0, 0x0B, 0xFE, 0x40, 0x1F, 0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x7F, 0xFD, 0x3F, 0xFF, 0x42, 0xFF, 0x80,
-    0x7F, 0xE0, 0x2F, 0xD0, 0x01, 0xFF, 0x43, 0xF4, 0x00, 0x07, 0xFC, 0xFD, 0x00, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x2A, 0xFF, 0xFA, 0x80, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x15, 0xFF, 0xF5, 0x40, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x0B, 0xF1, 0xFF, 0x00, 0x02, 0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0x80, 0x3F,
-    0xF0, 0x3F, 0xFE, 0x0F, 0xFF, 0xEB, 0xFF, 0xE1, 0xFF, 0xFE, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x50, 0x57, 0x5D, 0x1F, 0x40, 0xF0, 0x3F, 0xC5, 0xA5, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x6A, 0xAB, 0xDB, 0xAA, 0xBD, 0xA0, 0x07, 0x4A, 0x01,
-    0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xC0, 0x00, 0x7E, 0xAA, 0x97,
-    0xEA, 0xAE, 0x1D, 0x00, 0x60, 0x74, 0x06, 0x00, 0xD0, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
-    0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06,
-    0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00,
-    0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x01, 0x52, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F, 0xC1, 0xFC, 0xBF,
-    0x07, 0xF2, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F, 0xC1, 0xFC, 0xBF, 0x07, 0xF2, 0xFC, 0x1F, 0xCB,
-    0xF0, 0x7F, 0x2F, 0xC1, 0xFC, 0xBF, 0x07, 0xF2, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F, 0xC1, 0xFC,
-    0xBF, 0x07, 0xF2, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F, 0xC1, 0xFC, 0xBF, 0x07, 0xF2, 0xFC, 0x1F,
-    0xCB, 0xF0, 0x7F, 0x2F, 0xC1, 0xFC, 0xBF, 0x07, 0xF2, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F, 0xC1,
-    0xFC, 0xBF, 0x07, 0xF1, 0xA8, 0x0A, 0x80, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xFF, 0xFD, 0x01, 0x00, 0xFC, 0x2F, 0x83, 0xF0, 0x7F, 0x0F, 0xE0, 0xFF, 0x0F,
-    0xF4, 0x7F, 0x81, 0x40, 0x01, 0x40, 0x7F, 0x41, 0xFF, 0x03, 0xFC, 0x0B, 0xF0, 0x2F, 0x80, 0xFC,
-    0x07, 0xE0, 0x3F, 0x00, 0x10, 0x00, 0x06, 0x80, 0xBF, 0x80, 0xFF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F,
-    0x40, 0xFC, 0x0B, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x04, 0x07, 0xF4, 0xFF, 0x8F, 0xF0, 0xFF, 0x07,
-    0xF0, 0x3F, 0x02, 0xF8, 0x0F, 0xC0, 0x14, 0x01, 0x00, 0x10, 0x0F, 0xC0, 0xFC, 0x2F, 0x82, 0xF4,
-    0x3F, 0x03, 0xF0, 0x7F, 0x0B, 0xE0, 0xFE, 0x0F, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x4F, 0xF4, 0x7F,
-    0x8B, 0xF4, 0x14, 0x01, 0x40, 0x01, 0x40, 0x10, 0x1F, 0xD2, 0xFD, 0x1F, 0xF2, 0xFE, 0x0F, 0xF0,
-    0xFF, 0x0B, 0xF0, 0xFE, 0x0B, 0xE0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F, 0x82, 0xF4, 0x3F, 0x03, 0xE0,
-    0x04, 0x01, 0x40, 0x06, 0x80, 0x78, 0x2F, 0xE3, 0xFD, 0x0F, 0xF1, 0xFF, 0x0B, 0xF0, 0xFF, 0x0B,
-    0xF0, 0xFE, 0x0B, 0xD0, 0xFD, 0x0F, 0xC1, 0xFC, 0x2F, 0x42, 0xF4, 0x3E, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x04, 0x01, 0x40, 0x7F, 0x4B, 0xF4, 0xFF, 0x8F, 0xF4, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xE0,
-    0x7F, 0x0B, 0xE0, 0x3F, 0x07, 0xF0, 0x2F, 0x83, 0xF4, 0x0F, 0xC0, 0xFC, 0x01, 0x40, 0x10, 0x00,
-    0x05, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
-    0x02, 0x91, 0xF8, 0x6C, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0x9F, 0x9B, 0xD0, 0x00,
-    0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x02, 0x90, 0xF8, 0x6C, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFE, 0x3E, 0x5F,
-    0x9B, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x3E, 0x4F, 0x9A, 0xD3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xD2, 0x90, 0xF8,
-    0x6C, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x0A, 0x80, 0xFF, 0xCB, 0xFF, 0x7F, 0xFE, 0xBF, 0xF4, 0xFF, 0x80, 0x54, 0x00,
-    0x74, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF,
-    0xFE, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x7F, 0xE7, 0xFF, 0x3F,
-    0xD0, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xCF, 0xFC, 0x2F, 0xF7, 0xFF, 0x0B, 0xFD, 0xBF,
-    0xC1, 0xFF, 0x05, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD,
-    0x00, 0x2F, 0xCB, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFE, 0x7F,
-    0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x45, 0x40, 0x00, 0x54, 0x00, 0x05, 0x00, 0x01, 0x03, 0xFD, 0x7F,
-    0xF7, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x60,
-    0x2B, 0xDB, 0x02, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00,
-    0x07, 0x40, 0x01, 0xC0, 0x00, 0x7E, 0x80, 0x97, 0xE8, 0x0E, 0x1D, 0x00, 0x60, 0x74, 0x06, 0x00,
-    0xD0, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
-    0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x2F, 0x40, 0x07, 0xAD, 0x01, 0xCA, 0x34, 0x30, 0xA0, 0xC0, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD3, 0x40, 0x00, 0x74, 0xE0, 0x00, 0x1D,
-    0x38, 0x6A, 0xAF, 0x4E, 0xEA, 0xAF, 0x4D, 0xD0, 0x1D, 0x34, 0xD0, 0x70, 0xD0, 0xD1, 0xC3, 0x40,
-    0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x40, 0x0B,
-    0x1D, 0x00, 0x2C, 0x74, 0x00, 0xB1, 0xFA, 0xA9, 0x70, 0xFA, 0xAB, 0x1C, 0x34, 0x07, 0x07, 0x0D,
-    0x07, 0x01, 0xC3, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F,
-    0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0xBF, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xF8, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x3F, 0x0B, 0xD0, 0x7F, 0x90, 0x00, 0x6F, 0x90, 0x0F, 0xE6, 0xFC, 0x3F, 0x0F, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xC2, 0xF0, 0xBF, 0x6F, 0xC0, 0x7F, 0x6F, 0xD0, 0x0B, 0xF4, 0x1F, 0x83,
-    0xF0, 0x3F, 0x83, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0xBE, 0x1F, 0xC0, 0x7F, 0x00,
-    0x00, 0x07, 0xE0, 0xBE, 0x01, 0xFC, 0x7F, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x07, 0xF1,
-    0xFC, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x87, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x2F, 0xC0, 0xBD, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x43, 0xF0, 0x3F, 0x43, 0xF4,
-    0x00, 0x07, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xF4,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x15, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x02, 0xFC, 0x03, 0xFC, 0x07,
-    0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x3F, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0xF4, 0x02, 0xFC, 0x0F, 0xD0, 0x3F, 0xC2, 0xFD, 0x07, 0xF8, 0x3F, 0xC0, 0xFF,
-    0x0B, 0xF8, 0x1F, 0xE0, 0xFF, 0x03, 0xFC, 0x1F, 0xC0, 0x3F, 0x02, 0xF4, 0x02, 0xD0, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x40, 0x78, 0x02, 0xFC,
-    0x0F, 0xD0, 0xFE, 0x03, 0xFC, 0x2F, 0xD1, 0xFE, 0x07, 0xF8, 0x3F, 0xC3, 0xFD, 0x0F, 0xF0, 0xBF,
-    0x87, 0xFC, 0x1F, 0xE0, 0xFF, 0x0B, 0xF0, 0x3F, 0xC1, 0xFC, 0x0F, 0xE0, 0x3F, 0x02, 0xF4, 0x1F,
-    0xC0, 0x2D, 0x01, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x3F,
-    0x40, 0x3F, 0xC0, 0x3F, 0xD0, 0x1F, 0xF0, 0x0B, 0xF4, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x74, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x78, 0x0F, 0xF0, 0xBF, 0x03, 0xFC, 0x2F, 0xE0, 0xBF, 0x83,
-    0xFC, 0x0F, 0xF0, 0xBF, 0x41, 0xFE, 0x0F, 0xF0, 0x2F, 0xC1, 0xFD, 0x03, 0xF4, 0x2F, 0x80, 0x38,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x07, 0x80, 0x7C, 0x0F, 0xF0,
-    0xBF, 0x03, 0xF4, 0x3F, 0xC2, 0xFE, 0x0F, 0xF0, 0xBF, 0x83, 0xFC, 0x3F, 0xD0, 0xFF, 0x0B, 0xF4,
-    0x7F, 0xC1, 0xFE, 0x0F, 0xF0, 0xBF, 0x02, 0xFC, 0x1F, 0xD0, 0xFE, 0x03, 0xF4, 0x2F, 0x81, 0xFC,
-    0x03, 0x80, 0x3C, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xEF, 0x80, 0x1F, 0xC2, 0xF8, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x0E,
-    0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x2F, 0xD0, 0x3F, 0xE0, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0,
-    0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x38, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0F,
-    0xF8, 0x03, 0xFE, 0x01, 0xFF, 0x03, 0xFE, 0x0B, 0xF8, 0x2F, 0xD0, 0x7F, 0x40, 0x7C, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x8B, 0xC0, 0x0A, 0x00, 0x3E, 0x3F, 0x02, 0xF8, 0x0F, 0xC0, 0xF8,
-    0x2F, 0x82, 0xF0, 0x03, 0xE0, 0xF0, 0xBD, 0x00, 0x1F, 0x80, 0x2F, 0x40, 0x00, 0x7E, 0x07, 0xD0,
-    0x00, 0x01, 0xF5, 0xF4, 0x00, 0x1F, 0x0B, 0xFE, 0x0F, 0x43, 0xF8, 0x2F, 0x82, 0xFC, 0x2F, 0x43,
-    0xFC, 0x1F, 0xC0, 0x50, 0xFA, 0xF0, 0x50, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x03, 0xF0, 0x50, 0xFC, 0x00, 0xFC, 0x2F, 0x83, 0xF0, 0x2F, 0x02, 0xFC, 0x0F, 0x8B, 0xD0, 0x1F,
-    0x40, 0x3E, 0x34, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x1A, 0x8B, 0xF8,
-    0x03, 0xFC, 0xFF, 0x80, 0x7F, 0xCF, 0xF4, 0x0B, 0xFC, 0xFF, 0x40, 0xBF, 0x8F, 0xF0, 0x0B, 0xF8,
-    0xFF, 0x00, 0xBF, 0x8F, 0xF0, 0x0B, 0xF4, 0xFF, 0x00, 0x7F, 0x4F, 0xF0, 0x07, 0xF4, 0xBF, 0x00,
-    0x7F, 0x4B, 0xF0, 0x03, 0xF4, 0x7F, 0x00, 0x3F, 0x47, 0xF0, 0x03, 0xF4, 0x3F, 0x00, 0x3F, 0x43,
-    0xF0, 0x02, 0xF4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0x8B, 0xFC, 0x03,
-    0xFE, 0xBF, 0xC0, 0x7F, 0xE7, 0xFC, 0x03, 0xFD, 0x15, 0x00, 0x05, 0x00, 0x55, 0x55, 0x55, 0x53,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x02, 0xFF, 0xEF, 0xFF,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x2F, 0xEF, 0xF8, 0x0F, 0xFB,
-    0xFE, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x01, 0xBF, 0x80, 0x00, 0x6F,
-    0xE0, 0x1B, 0xFF, 0xD0, 0x06, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xD0,
-    0x02, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x07,
-    0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x07, 0xFF, 0x40, 0x00, 0xBF, 0x83, 0xFF, 0xFC, 0x00,
-    0x3F, 0xE0, 0xFF, 0xFF, 0xC0, 0x0F, 0xF4, 0x2F, 0xEF, 0xF8, 0x03, 0xFD, 0x01, 0x00, 0x7F, 0x00,
-    0xFF, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x03,
-    0xFC, 0x00, 0x01, 0xBF, 0x80, 0xFF, 0x00, 0x1B, 0xFF, 0xD0, 0x3F, 0xC0, 0x1F, 0xFF, 0xE0, 0x0B,
-    0xF0, 0x07, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x1F,
-    0xC0, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x1F, 0xF4, 0x00, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x05, 0x00, 0x00, 0x05, 0x40, 0x1A, 0x40, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0xFF, 0xD0, 0x0F, 0xF8, 0x0F, 0xFF, 0xF0, 0x3F, 0xD0, 0x3F, 0xFF, 0xF0, 0xFF, 0x40,
-    0xBF, 0xBF, 0xF3, 0xFC, 0x00, 0x40, 0x1F, 0xDF, 0xF0, 0x00, 0x00, 0x1F, 0xBF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFB, 0xF0, 0x00, 0x6F, 0xFF, 0x6F,
-    0xC0, 0x07, 0xFF, 0xF8, 0x7F, 0x00, 0x1F, 0xFF, 0x41, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x7E, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x01, 0xFF,
-    0x00, 0x3F, 0xD0, 0x01, 0x50, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40,
-    0x01, 0x81, 0xFF, 0xFD, 0x01, 0xF9, 0xFF, 0xFF, 0xFF, 0xFD, 0xBD, 0x02, 0xFF, 0xFE, 0x0E, 0x00,
-    0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x3D, 0x01, 0xE0, 0x0E, 0x00, 0x2F, 0xC0, 0xFD, 0x0F, 0xE0, 0xBF, 0x00, 0xFF, 0x0B, 0xF4, 0x7F,
-    0x83, 0xFC, 0x07, 0xF8, 0x3F, 0xC3, 0xFD, 0x1F, 0xE0, 0x3F, 0xC2, 0xFE, 0x1F, 0xF0, 0xFF, 0x01,
-    0xFE, 0x0F, 0xF0, 0xBF, 0x07, 0xF8, 0x0F, 0xF0, 0x7F, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0x02, 0xF4,
-    0x1F, 0xC0, 0xFC, 0x00, 0xB4, 0x07, 0x80, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xBF, 0xD0, 0xBF, 0x03, 0xFC, 0x3F,
-    0x80, 0x7F, 0x0F, 0xD0, 0x1F, 0xD7, 0xF0, 0x03, 0xF5, 0xFC, 0x01, 0xFD, 0x7F, 0x40, 0x7F, 0x0F,
-    0xD0, 0x2F, 0xC3, 0xFC, 0x1F, 0xD0, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x1A, 0x40, 0x00,
-    0x00, 0x01, 0xB0, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFB, 0xF0,
-    0x00, 0xFC, 0xFC, 0x00, 0xBC, 0x3F, 0x00, 0x7D, 0x0F, 0xC0, 0x3F, 0x57, 0xF5, 0x0F, 0xFF, 0xFF,
-    0xD1, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xA8, 0x00, 0x06, 0xAA,
-    0x90, 0x2F, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0xFF,
-    0xFD, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x01, 0xFE, 0x0F, 0xFF, 0xF0, 0x3F,
-    0xFE, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0xD0, 0x3F, 0xF5, 0x03, 0xFD, 0x00,
-    0x2F, 0xD0, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x1F, 0xC1, 0xFE, 0xBF, 0x02, 0xF9, 0xFC, 0x0B,
-    0xF3, 0xF4, 0x3F, 0x8B, 0xFF, 0xFC, 0x0B, 0xFF, 0xC0, 0x06, 0xA4, 0x00, 0x1A, 0xAA, 0x90, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0x8F, 0x80, 0xFC, 0x3C, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00,
-    0x2F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x06, 0x40, 0x00, 0x01, 0xBE, 0x40, 0x3F, 0xFF, 0x82, 0xF8, 0x7F, 0x0F, 0xC0, 0xFC, 0x3F, 0x43,
-    0xF0, 0x7F, 0xBF, 0x40, 0x7F, 0xF4, 0x07, 0xFF, 0xF8, 0x3F, 0x0B, 0xF6, 0xF8, 0x0B, 0xEB, 0xE0,
-    0x3F, 0x5F, 0xE6, 0xFC, 0x2F, 0xFF, 0xC0, 0x06, 0x94, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0x03,
-    0xFE, 0xFF, 0x1F, 0xC0, 0xFD, 0xBF, 0x03, 0xF9, 0xFC, 0x0B, 0xE3, 0xF9, 0x7F, 0x87, 0xFF, 0xFD,
-    0x02, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x0B, 0xFC, 0x0A, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xDB, 0xF8, 0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0x47, 0xE0, 0x0F, 0x80,
-    0xFC, 0x03, 0xE0, 0x3F, 0x00, 0xF8, 0x0F, 0xC0, 0x3E, 0x03, 0xF0, 0x1F, 0xC0, 0xFD, 0x2F, 0xF8,
-    0xFF, 0xC5, 0x54, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x7F,
-    0x9B, 0xF8, 0x3F, 0xC0, 0xBF, 0x0F, 0xD0, 0x1F, 0xC7, 0xF0, 0x07, 0xF5, 0xFC, 0x00, 0xFD, 0x7F,
-    0x00, 0x7F, 0x0F, 0xD0, 0x1F, 0xC3, 0xF8, 0x0F, 0xE0, 0xBF, 0x9F, 0xF0, 0x0F, 0xFF, 0xF4, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x2F, 0xFE, 0x03, 0xFF, 0xE0,
-    0x05, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x1F, 0xF4, 0x2F, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x10, 0x00, 0x1F, 0xFE, 0x02, 0xFF,
-    0xFF, 0x1F, 0xE6, 0xFC, 0x7F, 0x07, 0xF4, 0xA4, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF, 0x80,
-    0x00, 0x10, 0x00, 0x2F, 0xFE, 0x03, 0xFF, 0xFE, 0x1F, 0x82, 0xFC, 0x28, 0x0B, 0xF0, 0x00, 0x7F,
-    0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xF4, 0x02, 0x5F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x05, 0x6F,
-    0xF8, 0x7F, 0xFF, 0x80, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x7D, 0xFC, 0x00, 0x3E, 0x3F,
-    0x00, 0x3F, 0x0F, 0xC0, 0x2F, 0x03, 0xF0, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF4, 0x15, 0x5F,
-    0xD4, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xC0, 0xFE, 0xA9, 0x03, 0xF0, 0x00, 0x0F, 0xE4, 0x00, 0x3F, 0xFE, 0x00, 0xAF, 0xFE, 0x00, 0x03,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC1, 0x57, 0xFD, 0x0F, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xFF, 0x41, 0xFF, 0x40, 0x1F, 0xE0, 0x00,
-    0xFF, 0xA4, 0x03, 0xFF, 0xFD, 0x1F, 0xEB, 0xFD, 0xBF, 0x03, 0xFA, 0xFC, 0x0B, 0xF7, 0xF0, 0x2F,
-    0x8F, 0xF5, 0xFD, 0x1F, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xE3, 0xFA, 0xBF, 0x4F, 0x41, 0xF8, 0x2C, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x00,
-    0x3F, 0x40, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1F, 0xFE, 0x01, 0xFE, 0xFF, 0x0F, 0xC0, 0xFC, 0x3F, 0x03,
-    0xF0, 0xFF, 0x1F, 0x80, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0x2F, 0xEF, 0xF1, 0xFC, 0x0F, 0xDB, 0xE0,
-    0x2F, 0xAF, 0xC0, 0xFD, 0x3F, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x2F, 0xFD, 0x02, 0xFF, 0xFD, 0x0F, 0xD2, 0xFC, 0x7F, 0x03, 0xF6, 0xFC, 0x0F, 0xE7, 0xF0, 0x2F,
-    0x8F, 0xFA, 0xFD, 0x0F, 0xFF, 0xF4, 0x01, 0x7F, 0xC0, 0x02, 0xFD, 0x00, 0x7F, 0xE0, 0x7F, 0xFE,
-    0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0x00, 0x7F, 0x03, 0xFE, 0x00, 0x3F, 0x03, 0xFE, 0x00, 0x2E, 0x03,
-    0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xAB, 0xF0, 0x03, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x17, 0xFE, 0x50, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x90,
-    0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x0B, 0xF4, 0x2F, 0xD0, 0x00, 0xFF,
-    0x00, 0xFC, 0x00, 0x1F, 0xD0, 0x0F, 0x40, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x05, 0xBF, 0xD6,
-    0xA0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0A, 0xFF, 0xEA, 0x90, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x14, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFB, 0xFF, 0xFF, 0x40, 0x64, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xEB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xFD, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x2F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0xFE, 0x54, 0x00,
-    0x6A, 0x40, 0x0B, 0xFC, 0x0B, 0xFC, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xC0, 0x2F, 0xF5, 0xFF, 0xD2,
-    0xFF, 0xFF, 0xD2, 0xFE, 0x7F, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x7F, 0x80, 0x0F, 0xD0, 0x7C, 0x02,
-    0xFF, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x90, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0xBF, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0xBF, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF4,
-    0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xF8, 0x0F, 0xD0, 0x7F, 0xFA, 0x40, 0x00, 0x1F, 0xF9,
-    0xA3, 0xE0, 0x3F, 0x4F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFD, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xF4, 0x0B, 0xE0, 0x07, 0xFC, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x0B,
-    0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x17, 0xFE, 0xAA, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x2B, 0xFE,
-    0xAA, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x17, 0xFD, 0x54, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x05, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xAA, 0xAA, 0xAA,
-    0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xD5, 0x6A, 0xAA, 0xA0, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x0F, 0xDF, 0xEF, 0xCB, 0xE3, 0xF3, 0xF8, 0xF0, 0xFC,
-    0x3C, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0xAA, 0xAA, 0xAA, 0xBF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA,
-    0xA5, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x10, 0x3C, 0x3F, 0x0F, 0x2F, 0xCF, 0xCF, 0xE3, 0xFB, 0xFB, 0xF0, 0x3F, 0xFF, 0xF0, 0x03,
-    0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xD0, 0x01, 0xC0, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xE0, 0x00, 0x2F, 0x80, 0xBF, 0xAA, 0xAA, 0xBF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x2F, 0xD5, 0x55, 0x5F, 0xE0, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x3F, 0xC0, 0x1F, 0xE0,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x1F,
-    0xDF, 0xDF, 0xC3, 0xE3, 0xF2, 0xE0, 0x20, 0xFC, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x08, 0x3F, 0x08, 0x0F, 0x8F, 0xCB, 0xC3, 0xF7, 0xF7, 0xF0,
-    0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xEF, 0xEF, 0xC0, 0x3F, 0x3F, 0x3F, 0x00, 0x30, 0xFC, 0x30, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x70, 0xFC, 0x34, 0x07, 0xF3, 0xF3, 0xF0, 0x0B, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x15, 0x5B, 0x95, 0x50,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00,
-    0x02, 0xF8, 0x00, 0x90, 0xBE, 0x00, 0xBD, 0x2F, 0x80, 0xBF, 0x4B, 0xE0, 0xBF, 0x02, 0xF4, 0xBF,
-    0x00, 0xBD, 0x7F, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x3F, 0x40, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B,
-    0xE0, 0x00, 0x02, 0xF8, 0x18, 0x00, 0xBE, 0x1F, 0x80, 0x2F, 0x87, 0xF8, 0x0B, 0xE0, 0x3F, 0x81,
-    0xF8, 0x03, 0xF8, 0x7F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xF0,
-    0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xF0, 0x00, 0xFD, 0x00, 0xBF,
-    0x00, 0x3F, 0x40, 0xBF, 0x40, 0x0F, 0xD0, 0xBE, 0x00, 0x03, 0xF4, 0xBF, 0x55, 0x55, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFD, 0x55, 0x55, 0x50, 0x2F, 0x80, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x55, 0xAA, 0xA4, 0x2F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0x55, 0x5A, 0xA9, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF8, 0xBE, 0x00, 0x03, 0xFE,
-    0x2F, 0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0x03, 0xFB, 0xE2, 0xFB, 0xF0, 0xB8, 0xF8, 0xBC, 0xB8, 0x04,
-    0x3E, 0x2F, 0x04, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC, 0x00,
-    0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC,
-    0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x6A, 0xA9, 0x55,
-    0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x02, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF8, 0x1A, 0xA9,
-    0x55, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x03,
-    0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00,
-    0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x02, 0x0F, 0x8B, 0xC2,
-    0x03, 0xE3, 0xE2, 0xF2, 0xF0, 0xFE, 0xF8, 0xBE, 0xFC, 0x0B, 0xFE, 0x2F, 0xF8, 0x00, 0xBF, 0x8B,
-    0xF8, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x02, 0xF4, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0xFE, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x02, 0xFC,
-    0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x7F,
-    0xE0, 0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x7F,
-    0xEA, 0xAA, 0xBF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF5, 0x5F, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0x01, 0xFC, 0x00, 0x00, 0x3F,
-    0xE0, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0x00, 0x00, 0x01, 0xFF, 0x2F, 0x80, 0x00, 0x00, 0x3F,
-    0xEF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xE0, 0x02,
-    0xE0, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xAF, 0xFC, 0x07,
-    0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x1F, 0xD0, 0x03, 0xF8, 0x3F, 0xC0, 0x07, 0xF4, 0x3F,
-    0xC0, 0x0B, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F,
-    0xC0, 0xBF, 0x40, 0x3F, 0xFB, 0xFE, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xF4, 0xAA, 0xAA, 0xBF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD,
-    0x15, 0x55, 0x5F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0F, 0xF4, 0x50, 0x00, 0x3F, 0xD7, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x03, 0x80, 0x00, 0x7F,
-    0xFF, 0xF8, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFA, 0xAF, 0xFF, 0x00, 0x0B,
-    0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF8, 0x02, 0xFE, 0x00, 0x02, 0xFF, 0xF0,
-    0x0F, 0xF0, 0x00, 0x2F, 0x7F, 0xD0, 0x7F, 0xC0, 0x02, 0xF4, 0xBF, 0x81, 0xFE, 0x00, 0x2F, 0x41,
-    0xFE, 0x0B, 0xF4, 0x02, 0xF4, 0x07, 0xF8, 0x2F, 0xD0, 0x2F, 0x80, 0x1F, 0xE0, 0xBF, 0x41, 0xF8,
-    0x00, 0xBF, 0x41, 0xFE, 0x1F, 0x80, 0x03, 0xFC, 0x07, 0xFD, 0xF8, 0x00, 0x0F, 0xF0, 0x0F, 0xFF,
-    0x80, 0x00, 0xBF, 0x80, 0x2F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00,
-    0xFF, 0xFE, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x2F, 0xFF, 0xF8, 0x00,
-    0x02, 0xC0, 0x05, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xF4, 0x00, 0x00,
-    0x2F, 0x8F, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x03, 0xFE, 0x00, 0x00, 0xFD,
-    0x03, 0xFF, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0x40, 0x02, 0xF8, 0x00, 0xFF, 0x80, 0x03, 0xF4, 0x00,
-    0xFF, 0xC0, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x3F, 0xE0, 0x1F, 0xD0, 0x00, 0x3F,
-    0xF0, 0x2F, 0xC0, 0x00, 0x1F, 0xF4, 0x3F, 0xEA, 0xAA, 0xAF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xAA, 0xAF, 0xFD, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x00,
-    0x3F, 0x41, 0xFF, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xE0, 0x0B, 0xFC, 0x00, 0x7F, 0x00,
-    0x0F, 0xF8, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0xC0, 0x7F, 0x00, 0x00, 0xFF,
-    0x83, 0xF8, 0x00, 0x02, 0xFF, 0x0F, 0xC0, 0x00, 0x07, 0xFC, 0xBE, 0x00, 0x00, 0x0F, 0xFB, 0xF0,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x94, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xAA,
-    0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xEA, 0xAA,
-    0xAA, 0xAA, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x40, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xF9, 0x47,
-    0xF4, 0x00, 0x2F, 0xF0, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x7F,
-    0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xAA, 0xAF, 0xFA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xAA, 0xFE, 0xAA, 0xA0, 0xFF, 0x40, 0x7F, 0x00,
-    0x00, 0x2F, 0xE0, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0xDB, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xAA, 0xA8,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xAA, 0xAA, 0xAA, 0xA0,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x0A, 0xAA, 0xAA, 0xAA, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x05, 0x55,
-    0x55, 0x6F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xF4, 0x5B, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x2F,
-    0xC0, 0x03, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0xAA, 0xBF,
-    0xEA, 0xAB, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA, 0xAF,
-    0xEA, 0xAF, 0xF0, 0x00, 0x03, 0xF4, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x02, 0xFE, 0x00, 0x00, 0x1F,
-    0xC0, 0xFF, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x80, 0x55, 0x55, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0xAA, 0xAA, 0xAA, 0xAB, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC2, 0xAA, 0xAA, 0xAA, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFA,
-    0xAF, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F,
-    0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00,
-    0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00,
-    0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4,
-    0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07,
-    0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0,
-    0x1F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF1, 0xAA, 0xAA, 0x41, 0xAA,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x07, 0xFF, 0xAA, 0xBF, 0xF8, 0x0F, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xFC, 0x00, 0x0F, 0x80, 0x2F,
-    0xF8, 0x00, 0x2D, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0A, 0x00, 0xBF, 0x80, 0x00,
-    0x7D, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x1F, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x16, 0xAA, 0xAA, 0xAA, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x1F, 0x40, 0x02, 0xD1, 0xF4, 0x78, 0x3F, 0xDF, 0x7F, 0xC2, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x47, 0xFE, 0xFB, 0xFD, 0x3F, 0x1F, 0x4F,
-    0xC0, 0x41, 0xF4, 0x10, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0x82, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC,
-    0x3F, 0xD7, 0xF8, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x54, 0x00, 0x01, 0x03, 0xFC, 0xBF,
-    0xEB, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x05, 0x54, 0x00, 0x2F, 0x80, 0x7F, 0xF8,
-    0x00, 0xFD, 0x01, 0xFF, 0xF0, 0x03, 0xF0, 0x02, 0xBF, 0xC0, 0x1F, 0x80, 0x00, 0x7F, 0x40, 0xBD,
-    0x00, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x03, 0xFC, 0x1F, 0x80, 0x00, 0x0B, 0xF0, 0xBD, 0x00, 0x00,
-    0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x00, 0xBF, 0x7D, 0x00, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0xBF, 0xD0,
-    0x1F, 0x3F, 0xFF, 0x4B, 0xF7, 0xFA, 0xFE, 0xFD, 0xBD, 0x07, 0xFE, 0x0F, 0xC0, 0x2F, 0xC0, 0xFC,
-    0x03, 0xFD, 0x0B, 0xE0, 0xBF, 0xF4, 0x7F, 0xFF, 0x5F, 0xE3, 0xFF, 0xD0, 0xBF, 0x0B, 0xE4, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x14, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x2F, 0xFF, 0x0B,
-    0xFF, 0xC3, 0xFA, 0xFE, 0xFE, 0xFD, 0xBD, 0x07, 0xFD, 0x07, 0xEB, 0xC0, 0x2F, 0xC0, 0x3E, 0xBD,
-    0x03, 0xFC, 0x03, 0xEB, 0xE0, 0xFF, 0xF0, 0xBE, 0x7F, 0xFF, 0x5F, 0xFF, 0xC2, 0xFF, 0xD0, 0xBF,
-    0xF8, 0x0B, 0xF4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA,
-    0xAA, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x15, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB,
-    0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2,
-    0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x1A, 0x80, 0x15, 0x01, 0x52, 0xFC, 0x2F, 0xCB, 0xF0,
-    0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF,
-    0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB,
-    0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC,
-    0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F,
-    0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF1, 0xA8, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80,
-    0x00, 0x00, 0x2F, 0xCF, 0xF0, 0x00, 0x00, 0x0F, 0xE1, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0x80,
-    0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0,
-    0x07, 0xF8, 0x00, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0,
-    0xBF, 0x40, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF4,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0x07, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00,
-    0x03, 0xF8, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x00, 0x7F,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x7F, 0xFA, 0xBF, 0xF4, 0x3F, 0xD0, 0x02, 0xFF, 0x0F,
-    0xE0, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0x3F,
-    0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00,
-    0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00,
-    0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03,
-    0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00,
-    0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0,
-    0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xE7,
-    0xF0, 0x00, 0x03, 0xF5, 0xFD, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0xBF, 0x0F, 0xF8, 0x00, 0xBF,
-    0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07,
-    0xFD, 0xBE, 0x00, 0x0F, 0xF4, 0x38, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1C, 0x1F, 0xF0, 0x00, 0xBE, 0x2F, 0xE0, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01,
-    0xFF, 0xAF, 0xF4, 0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x14, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4,
-    0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x64, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x06, 0x80, 0xFF, 0xC3, 0xFF, 0x0F, 0xFC, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x3F, 0xF0, 0xFF, 0xC3, 0xFF,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF,
-    0xAF, 0xF4, 0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x64, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0x07, 0xFE, 0x7F, 0xC0,
-    0x00, 0x0F, 0xF4, 0x14, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x01,
-    0x81, 0xFF, 0xFD, 0x01, 0xF9, 0xFF, 0xFF, 0xFF, 0xFD, 0xBD, 0x02, 0xFF, 0xFE, 0x0E, 0x00, 0x0B,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x03, 0xC3, 0xFF,
-    0xFF, 0x47, 0xFA, 0xFE, 0xBF, 0xFF, 0xFC, 0xBC, 0x00, 0xBF, 0xFC, 0x04, 0x00, 0x01, 0x94, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA,
-    0xAA, 0x9B, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x01, 0xFF, 0xC0, 0x2E, 0x7F, 0xFF, 0x87, 0xFF, 0xFB, 0xFF, 0xFE, 0xFC, 0x0B, 0xFF,
-    0xC2, 0x40, 0x0B, 0xD0, 0x01, 0x50, 0x00, 0x41, 0xFF, 0xC0, 0x2E, 0x7F, 0xFF, 0x87, 0xFF, 0xFB,
-    0xFF, 0xFE, 0xFC, 0x0B, 0xFF, 0xC2, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x94, 0x00,
-    0x5B, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x5A, 0xA9, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xEA, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC3, 0x90, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xBD, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x15, 0x7F, 0x55, 0x47, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xD1, 0x7F, 0x55, 0x54, 0x07, 0xD0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xF4, 0x00,
-    0xBF, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD,
-    0x04, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFF, 0x40,
-    0x0B, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x0B, 0xFC, 0x00,
-    0x7F, 0xF0, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0x80, 0x02, 0xFF,
-    0x80, 0x1F, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xE0, 0x0B, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0xBF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFD, 0x00,
-    0x2F, 0xFD, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xF8, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x07, 0xFF,
-    0x40, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x05, 0x6F, 0xD5, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x7F, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x07,
-    0xF0, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x7F,
-    0x00, 0x00, 0x1F, 0xF0, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0x9F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x55,
-    0x55, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x15, 0x55, 0x5F, 0xE0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0x6F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x2F,
-    0xF0, 0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x3F,
-    0xC0, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xFD,
-    0x00, 0x0B, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x7F, 0x95, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x2F, 0xFD, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xAA, 0xAA, 0xA4, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xAF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x40, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x6A, 0xAA, 0xAA,
-    0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFE, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0xB8, 0x2F, 0xC0, 0x0F, 0xD0, 0x2E,
-    0x01, 0xFC, 0x07, 0xD0, 0x0B, 0x80, 0x1F, 0x43, 0xE0, 0x02, 0xE0, 0x02, 0xF1, 0xF0, 0x00, 0xB8,
-    0x00, 0x3D, 0xB8, 0x00, 0x2E, 0x00, 0x0F, 0xBE, 0x00, 0x0B, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2E, 0x00, 0x0B, 0xEE, 0x00, 0x0B, 0x80,
-    0x02, 0xE7, 0xC0, 0x02, 0xE0, 0x00, 0xF4, 0xF8, 0x00, 0xB8, 0x00, 0xBC, 0x2F, 0x00, 0x2E, 0x00,
-    0x3E, 0x03, 0xF0, 0x0B, 0x80, 0x3F, 0x00, 0x3F, 0x82, 0xE0, 0xBF, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F,
-    0xC0, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x02,
-    0xF1, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xBE, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xEE, 0x00, 0x00, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0xBC,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00,
-    0x02, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x43,
-    0xEB, 0xE0, 0x02, 0xFA, 0xF1, 0xF0, 0xBE, 0x02, 0xF8, 0x3D, 0xB8, 0x0B, 0xE2, 0xF8, 0x0F, 0xBE,
-    0x00, 0xBF, 0xF8, 0x02, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x1F, 0xF8,
-    0x02, 0xFF, 0xD0, 0x0B, 0xEE, 0x02, 0xF8, 0xBD, 0x02, 0xE7, 0xC2, 0xF8, 0x0B, 0xE0, 0xF4, 0xFA,
-    0xF8, 0x00, 0xBE, 0xBC, 0x2F, 0xF8, 0x00, 0x0B, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xFE, 0xAF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x07, 0xD0,
-    0x00, 0x02, 0xFF, 0x43, 0xE0, 0x00, 0x02, 0xFA, 0xF1, 0xF0, 0x00, 0x02, 0xF8, 0x3D, 0xBC, 0x00,
-    0x02, 0xF8, 0x0F, 0xBE, 0x00, 0x02, 0xF8, 0x02, 0xFF, 0x40, 0x02, 0xF8, 0x00, 0x7F, 0xD0, 0x02,
-    0xF8, 0x00, 0x1F, 0xF8, 0x02, 0xF8, 0x00, 0x0B, 0xEE, 0x02, 0xF8, 0x00, 0x03, 0xE7, 0xC2, 0xF8,
-    0x00, 0x00, 0xF4, 0xFA, 0xF8, 0x00, 0x00, 0xBC, 0x2F, 0xF8, 0x00, 0x00, 0x3E, 0x03, 0xF8, 0x00,
-    0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x1A, 0xAA, 0xFE, 0xAA, 0x9B, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x01, 0x03, 0xFC, 0xBF, 0xEB, 0xFE, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00,
-    0x04, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xDB, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xFF, 0x40,
-    0x3F, 0xF0, 0x07, 0xFE, 0x7F, 0xC0, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x5B,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x02, 0xFC, 0x69, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xE2, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xD1, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD2,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_14_boldBitmaps[34080] = {
+    0x8D, 0x55, 0xBF, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBB, 0x8B, 0x7D, 0x52, 0xAE, 0x58, 0x17, 0xB8,
+    0x41, 0x42, 0x47, 0x8D, 0x44, 0xF6, 0x2F, 0x08, 0x7B, 0x02, 0x24, 0x0A, 0x17, 0x76, 0x91, 0x54,
+    0x14, 0xF0, 0x1F, 0xF8, 0x1F, 0x40, 0xDE, 0x13, 0x29, 0x53, 0x84, 0x06, 0x6A, 0x84, 0x8C, 0x14,
+    0x5E, 0x0A, 0x28, 0x53, 0x60, 0xEF, 0x25, 0x29, 0x52, 0xD0, 0x1C, 0xA4, 0x48, 0x41, 0x91, 0x03,
+    0x59, 0x8A, 0x64, 0x0A, 0x2F, 0xB0, 0x88, 0xB3, 0xB3, 0x77, 0xC3, 0x37, 0xFB, 0x9E, 0xED, 0xB8,
+    0xE3, 0xDE, 0xDB, 0xBB, 0xBD, 0xDD, 0xF9, 0xF1, 0xCD, 0x37, 0xB3, 0x73, 0x6F, 0x6E, 0x8D, 0x7C,
+    0x2F, 0xF0, 0xB6, 0x67, 0x25, 0x7F, 0x57, 0x79, 0x5B, 0x7A, 0x53, 0xF8, 0x0D, 0x22, 0xBD, 0x15,
+    0xDD, 0xD3, 0xB8, 0x49, 0xFA, 0xFD, 0x97, 0x81, 0x9D, 0xFA, 0xC3, 0xCF, 0xAB, 0xDB, 0x73, 0x3F,
+    0xED, 0xA9, 0x9F, 0x69, 0x87, 0xD6, 0x9A, 0x4D, 0xA2, 0xA9, 0x1C, 0x48, 0x75, 0x07, 0x94, 0x45,
+    0xD5, 0x91, 0x6E, 0x23, 0x31, 0xAE, 0x1A, 0x63, 0xF8, 0xF8, 0x1F, 0x7B, 0x8B, 0x0E, 0x0B, 0x4F,
+    0xAA, 0xDF, 0x23, 0x8A, 0x55, 0x9F, 0x7F, 0x7F, 0x3C, 0xEF, 0x3B, 0x6C, 0x55, 0xB2, 0x5D, 0x78,
+    0xDD, 0x90, 0xC5, 0x76, 0x35, 0x18, 0xA2, 0x03, 0x98, 0xB9, 0xBC, 0x6A, 0x8C, 0x1F, 0x89, 0x72,
+    0x4F, 0x54, 0x75, 0x94, 0xF3, 0x48, 0x96, 0x63, 0xF9, 0xEA, 0x55, 0x34, 0x77, 0xEF, 0xFA, 0xE9,
+    0x86, 0xBA, 0x13, 0x1E, 0xBE, 0xA1, 0xFE, 0x1D, 0x48, 0x73, 0x43, 0x86, 0x7B, 0x3C, 0x61, 0x06,
+    0x43, 0xF1, 0xF0, 0xE9, 0x4D, 0xFB, 0xB4, 0xF3, 0xCE, 0x7C, 0xF0, 0x38, 0xB2, 0x52, 0xBF, 0xF3,
+    0x21, 0x17, 0xCC, 0x3E, 0xE3, 0x19, 0x11, 0xC1, 0xEA, 0x67, 0x17, 0x56, 0xD3, 0xEB, 0xAD, 0x0B,
+    0x97, 0x6B, 0x0D, 0xE5, 0x3D, 0x95, 0xDC, 0x92, 0x25, 0x91, 0x56, 0x3D, 0x99, 0x8F, 0x42, 0x16,
+    0x09, 0x7C, 0xB4, 0xA6, 0xA1, 0xC3, 0x7C, 0x04, 0xC4, 0x6A, 0xD0, 0x5D, 0x24, 0x9A, 0xF3, 0x51,
+    0xB7, 0xF2, 0x72, 0x07, 0xB6, 0x10, 0xC3, 0x41, 0x79, 0x5A, 0x9C, 0x3A, 0xF5, 0x84, 0x43, 0xCD,
+    0x8F, 0xBD, 0xDB, 0xED, 0x74, 0xBF, 0xA7, 0x3A, 0xB8, 0x54, 0x8F, 0x62, 0x35, 0x50, 0x06, 0x69,
+    0x4B, 0x64, 0x60, 0x42, 0xC2, 0xD5, 0xED, 0x21, 0xF8, 0xC8, 0xC1, 0x08, 0x99, 0x46, 0xF5, 0xE2,
+    0x82, 0x1C, 0x22, 0x99, 0x10, 0x29, 0x20, 0x74, 0x94, 0xED, 0xD0, 0x95, 0xAB, 0xC2, 0x26, 0x81,
+    0x58, 0xDC, 0xD5, 0x29, 0x63, 0x6A, 0x1B, 0x80, 0xC8, 0x63, 0x21, 0x91, 0xF8, 0x5A, 0x62, 0xE9,
+    0x26, 0x2C, 0xBB, 0xAD, 0x5E, 0xE4, 0xDE, 0x12, 0x95, 0x48, 0x8B, 0x7D, 0xE2, 0x08, 0x56, 0x14,
+    0x8F, 0x35, 0x77, 0xF6, 0x5E, 0xA8, 0x86, 0x22, 0xD6, 0xA1, 0x6E, 0x95, 0xD7, 0xE1, 0x90, 0x4C,
+    0xA7, 0xCF, 0x02, 0x31, 0xB8, 0xEB, 0x72, 0xB9, 0x37, 0x05, 0x7F, 0xE9, 0xF8, 0xA8, 0x94, 0xFC,
+    0x8D, 0x39, 0xF3, 0x57, 0xDC, 0xD1, 0xE6, 0x0E, 0x18, 0xD2, 0x9F, 0xFC, 0xFA, 0x57, 0x74, 0xFA,
+    0xA7, 0x3F, 0xE3, 0xDE, 0xB5, 0x04, 0xE7, 0x07, 0xE8, 0x56, 0x21, 0x9B, 0xE5, 0xE1, 0x69, 0x86,
+    0xF3, 0x22, 0x22, 0x92, 0x32, 0x90, 0x03, 0x1C, 0x98, 0x54, 0x7E, 0x39, 0xB3, 0x4D, 0x31, 0x42,
+    0x28, 0x9F, 0xD2, 0x4A, 0x03, 0xA9, 0x1A, 0xCF, 0x36, 0x47, 0xC4, 0x30, 0x93, 0x0D, 0x64, 0xDA,
+    0x7C, 0xA6, 0x4A, 0x64, 0x60, 0x06, 0x0A, 0xA6, 0x85, 0x8C, 0xEE, 0x33, 0x28, 0x0C, 0x58, 0x51,
+    0x62, 0x3D, 0xCD, 0xEA, 0x1E, 0x4A, 0xA6, 0x2B, 0xC4, 0x45, 0xDD, 0x43, 0xC8, 0x35, 0x7A, 0xC8,
+    0x47, 0xBA, 0x9E, 0x00, 0x6D, 0x1C, 0x64, 0xBF, 0x04, 0xF5, 0xA2, 0xD5, 0xD3, 0x7E, 0xC9, 0xBF,
+    0xB9, 0x93, 0xED, 0x93, 0x0F, 0x6F, 0x18, 0xDA, 0x88, 0x94, 0x35, 0x69, 0x1F, 0x82, 0x28, 0xCD,
+    0xD7, 0x1E, 0x96, 0xF9, 0x39, 0xF3, 0xF4, 0x8E, 0x3B, 0x6E, 0xAF, 0xEE, 0x65, 0xFB, 0x10, 0x2F,
+    0x43, 0x19, 0x0B, 0xF9, 0x85, 0xCA, 0xAB, 0x5E, 0xB7, 0xEF, 0x25, 0x23, 0x5A, 0x88, 0x91, 0x32,
+    0x12, 0xE6, 0xED, 0x4B, 0x36, 0xFD, 0x8E, 0xB0, 0x4F, 0x02, 0x1E, 0x80, 0x05, 0x2C, 0x02, 0x26,
+    0x60, 0x13, 0xC8, 0xC0, 0x49, 0x85, 0xD8, 0x44, 0x46, 0x58, 0x4C, 0x2E, 0xE5, 0xE6, 0x95, 0x0A,
+    0x1C, 0xC6, 0x2B, 0x2A, 0xF5, 0x52, 0xE5, 0xB5, 0xCC, 0x3B, 0x68, 0x5B, 0x0E, 0xE2, 0xB7, 0x2B,
+    0xE7, 0x8A, 0x89, 0x5B, 0x1D, 0xA0, 0xC1, 0x9F, 0x83, 0xE0, 0x68, 0x06, 0x72, 0x4F, 0x66, 0x2A,
+    0x65, 0x62, 0x9F, 0x4C, 0xCB, 0x89, 0xAC, 0x54, 0x32, 0x49, 0x32, 0xA1, 0x0E, 0x19, 0xB4, 0x3A,
+    0x3B, 0x20, 0xA7, 0x51, 0xEC, 0x88, 0xC1, 0x96, 0x68, 0x73, 0xE5, 0xE1, 0x5D, 0xBC, 0x7B, 0x64,
+    0x1A, 0x47, 0x28, 0x3D, 0x48, 0x7B, 0x54, 0xE0, 0xFF, 0x79, 0xAC, 0x33, 0x3C, 0x70, 0x14, 0x68,
+    0xC9, 0x92, 0x05, 0x00, 0xCC, 0x71, 0xEC, 0xBD, 0xF1, 0x26, 0x98, 0xAE, 0x1E, 0x4D, 0xA7, 0x50,
+    0xF5, 0x2A, 0x24, 0x15, 0x02, 0x26, 0x20, 0x81, 0x6A, 0x43, 0x15, 0xB8, 0xD2, 0x58, 0x76, 0x7D,
+    0x32, 0x88, 0x42, 0x25, 0x7D, 0xB6, 0xF8, 0x0E, 0x29, 0x99, 0x0C, 0x06, 0x6C, 0x8E, 0x89, 0x63,
+    0x3C, 0x9C, 0xD4, 0x2F, 0x8F, 0xA6, 0xD7, 0xFE, 0x00, 0xF4, 0x7D, 0x2D, 0x4C, 0xA2, 0x5A, 0xC8,
+    0x75, 0xB4, 0x3B, 0x52, 0x0D, 0x09, 0x83, 0xC0, 0xBE, 0xDD, 0x0D, 0x4B, 0x07, 0x58, 0x2E, 0xE6,
+    0x64, 0xBC, 0xE4, 0xC7, 0x0F, 0x38, 0x2A, 0xE6, 0x56, 0xF1, 0x11, 0xAD, 0x5D, 0x90, 0x9A, 0x81,
+    0x62, 0x32, 0xC0, 0xA3, 0x58, 0x3C, 0x08, 0xFD, 0x2C, 0x2F, 0x08, 0x6A, 0x12, 0x76, 0xB6, 0xD1,
+    0x42, 0x06, 0x46, 0x42, 0x52, 0x05, 0x33, 0x4A, 0x4D, 0xF9, 0x62, 0x5E, 0xF0, 0x7D, 0x20, 0xE3,
+    0x67, 0x18, 0xD3, 0xF5, 0x85, 0x3B, 0xFB, 0x22, 0xA5, 0x34, 0x65, 0xEF, 0x72, 0x72, 0x1B, 0xF6,
+    0x38, 0xC0, 0x65, 0x0F, 0x59, 0xE2, 0xC5, 0xFD, 0xF3, 0xAC, 0xDA, 0x3E, 0xF5, 0x13, 0x04, 0xD2,
+    0x68, 0x39, 0xC2, 0xBB, 0xE2, 0x51, 0xF6, 0x42, 0xDA, 0xCB, 0x97, 0xAF, 0x38, 0xF9, 0x0B, 0x9E,
+    0xD1, 0xAA, 0xFA, 0x12, 0x61, 0x65, 0x17, 0x7D, 0xC9, 0x4A, 0x30, 0x28, 0x7D, 0x84, 0x81, 0x5A,
+    0xC8, 0x91, 0xBE, 0x52, 0xDA, 0x0A, 0x48, 0xA8, 0xCF, 0xF6, 0xB1, 0xCC, 0xAD, 0x11, 0xD2, 0x7B,
+    0x3B, 0xDA, 0x4E, 0x45, 0xDB, 0x95, 0xD1, 0xF6, 0xC5, 0x64, 0x70, 0x44, 0x8C, 0x2F, 0x63, 0x3D,
+    0xAA, 0x11, 0x90, 0xBC, 0xD8, 0x25, 0x07, 0x45, 0x50, 0x01, 0xA2, 0xBF, 0x41, 0x24, 0x2F, 0x30,
+    0xDC, 0xF1, 0x83, 0x38, 0x91, 0x7E, 0x86, 0xF6, 0x58, 0xB6, 0x12, 0x85, 0x6B, 0x50, 0x48, 0x60,
+    0x68, 0x05, 0x2B, 0x2C, 0x39, 0x45, 0xC2, 0x70, 0x6E, 0x25, 0x7F, 0xE7, 0x53, 0x94, 0x72, 0x8A,
+    0xFC, 0x1C, 0xA6, 0x9E, 0x25, 0xFA, 0xBE, 0x62, 0xE7, 0x55, 0x50, 0x63, 0x3D, 0xC0, 0xF5, 0x50,
+    0x8E, 0xB5, 0xBC, 0x4D, 0x7A, 0x80, 0xFB, 0x16, 0xED, 0x0B, 0x3C, 0x70, 0x57, 0x9D, 0xBA, 0x50,
+    0x0F, 0x75, 0x44, 0xEF, 0xC0, 0x28, 0x26, 0x8B, 0xE6, 0x61, 0x06, 0xCC, 0x67, 0x97, 0xD8, 0xCB,
+    0x79, 0x09, 0x33, 0x5D, 0xBB, 0xA7, 0x54, 0xA4, 0x24, 0xF2, 0xA0, 0x83, 0x0D, 0x66, 0x40, 0xE1,
+    0xF7, 0xA2, 0x57, 0x4A, 0x88, 0x93, 0x19, 0x8A, 0x49, 0x8F, 0xC5, 0x84, 0xFD, 0x58, 0x48, 0x8D,
+    0xEF, 0x4A, 0xED, 0x08, 0x40, 0x8B, 0xA6, 0x0B, 0xBC, 0x68, 0x9C, 0xEB, 0x3C, 0x49, 0x7D, 0xA3,
+    0x5A, 0x9A, 0xE5, 0xE9, 0xBA, 0x3C, 0xBC, 0xE7, 0xE0, 0x9F, 0xCE, 0xF6, 0xEF, 0x69, 0x2D, 0x1D,
+    0x7C, 0x15, 0xF1, 0x1B, 0xAF, 0xF6, 0xDF, 0x32, 0x54, 0xD2, 0x0C, 0xC6, 0x52, 0xDA, 0x41, 0x67,
+    0x9A, 0x9B, 0x17, 0x3B, 0x0F, 0x13, 0x3F, 0x0E, 0x4D, 0xE9, 0x88, 0xDC, 0x20, 0x4E, 0x25, 0x39,
+    0xF5, 0xEB, 0x43, 0x12, 0x8D, 0x23, 0xF7, 0xF6, 0xAA, 0xE3, 0x58, 0x49, 0xC4, 0xB2, 0x27, 0x2D,
+    0x16, 0xF7, 0x57, 0x8B, 0x9B, 0xB7, 0x6F, 0x37, 0xCB, 0x7E, 0x28, 0x65, 0x9C, 0xF3, 0xF9, 0x90,
+    0x2C, 0x24, 0xCE, 0x91, 0xF6, 0x75, 0x6E, 0xF1, 0x6D, 0x2A, 0xC0, 0x23, 0xBA, 0x14, 0xB5, 0xCB,
+    0xAF, 0xA4, 0x44, 0xD6, 0x21, 0x38, 0x7D, 0x32, 0x5E, 0xC3, 0x97, 0x8A, 0xF0, 0x59, 0x41, 0xAF,
+    0xB2, 0xB4, 0x3E, 0x67, 0x6E, 0x42, 0x1D, 0x95, 0xA8, 0xA6, 0x91, 0x8A, 0x41, 0xFE, 0xAB, 0x03,
+    0x30, 0x52, 0x39, 0x09, 0x4A, 0xA9, 0x4E, 0x44, 0xF9, 0x1F, 0x95, 0x55, 0xB1, 0xAE, 0xDD, 0x44,
+    0x10, 0x1D, 0xDB, 0x52, 0x2C, 0xE1, 0xC2, 0x69, 0x22, 0x8A, 0x57, 0xEC, 0x27, 0xF8, 0x0B, 0xC8,
+    0x3A, 0xA2, 0xA0, 0x48, 0x91, 0x14, 0xB9, 0x20, 0xF1, 0x09, 0x34, 0xB7, 0xA5, 0xCA, 0xDE, 0x80,
+    0x44, 0xFD, 0x1A, 0x3E, 0x01, 0x29, 0x3C, 0x8A, 0xC7, 0x07, 0x20, 0xED, 0x3E, 0xA5, 0x48, 0x41,
+    0x81, 0xA5, 0x48, 0x34, 0x14, 0x18, 0xF1, 0x1A, 0xAA, 0xB7, 0x48, 0x4E, 0xE2, 0xFB, 0xB4, 0xF6,
+    0x70, 0xCE, 0xDE, 0xFB, 0x12, 0x0A, 0x82, 0x14, 0x4B, 0x9E, 0x6B, 0xCF, 0x5D, 0xCF, 0xCE, 0x9C,
+    0x39, 0x73, 0x56, 0xE4, 0x78, 0x9D, 0xE8, 0x25, 0xAC, 0x51, 0x5D, 0x44, 0x2A, 0xC5, 0x25, 0xE2,
+    0xF6, 0xF0, 0x4A, 0xB5, 0x8A, 0x94, 0xAB, 0xD8, 0x01, 0x3F, 0xA9, 0x5C, 0x64, 0x3B, 0x54, 0x73,
+    0x3B, 0x1A, 0x1D, 0x9B, 0xE8, 0x65, 0x71, 0xC1, 0x3C, 0x9B, 0xEB, 0xC1, 0x8A, 0x7D, 0x30, 0x7C,
+    0x20, 0x0B, 0x1C, 0xBD, 0x7C, 0x38, 0x55, 0xAF, 0x12, 0x42, 0x0D, 0xED, 0xCF, 0xB1, 0x5A, 0x7D,
+    0xEF, 0xBA, 0x60, 0xC2, 0x52, 0xCD, 0x5E, 0x7C, 0x35, 0x75, 0x17, 0x4B, 0xA9, 0x5E, 0xF1, 0x5A,
+    0xE9, 0xEF, 0x58, 0x12, 0xAB, 0xF9, 0xE4, 0x52, 0x4C, 0xCC, 0x49, 0xD8, 0xF1, 0xF0, 0x83, 0xB7,
+    0x06, 0xFB, 0xAF, 0xFD, 0x49, 0x12, 0xE9, 0x90, 0xCC, 0xC0, 0x04, 0x75, 0xC6, 0x7F, 0xC5, 0xD9,
+    0x77, 0x79, 0x4D, 0x71, 0x4A, 0xEB, 0x82, 0x30, 0x5D, 0x3E, 0x9A, 0x95, 0x56, 0x53, 0x76, 0x4C,
+    0xB0, 0x9D, 0x63, 0xB4, 0xE4, 0xB1, 0xA4, 0x1E, 0xB5, 0x47, 0xD8, 0x8F, 0xB1, 0xB0, 0x48, 0x0D,
+    0x96, 0xB4, 0x63, 0x8B, 0x25, 0xF6, 0x5B, 0x17, 0xA5, 0x44, 0xF8, 0x20, 0x2D, 0xEC, 0x4E, 0xDC,
+    0xE6, 0x33, 0x14, 0x9C, 0xA4, 0x59, 0xC4, 0x0C, 0xD2, 0xCE, 0x85, 0x9E, 0x02, 0x85, 0x4E, 0x07,
+    0xA3, 0x49, 0xB5, 0x77, 0x1A, 0x65, 0xF3, 0x48, 0xAC, 0xEA, 0xC4, 0xF5, 0xFD, 0xF6, 0xA5, 0x8F,
+    0x75, 0xAA, 0x96, 0x42, 0xC5, 0xEF, 0x5C, 0xE8, 0x06, 0x13, 0x1B, 0x3A, 0x52, 0xA1, 0xC8, 0xC3,
+    0x21, 0x22, 0xF0, 0x9C, 0xE1, 0xD0, 0x7B, 0x8A, 0xDA, 0x5C, 0x68, 0x92, 0x89, 0xE5, 0x5A, 0x27,
+    0xD1, 0x27, 0x2A, 0x7A, 0xE1, 0x55, 0xFF, 0x64, 0x71, 0x8C, 0x75, 0x6C, 0xC3, 0x17, 0xA7, 0x52,
+    0x23, 0x9F, 0x36, 0x6F, 0xF1, 0xC3, 0x82, 0x44, 0xEC, 0x27, 0x8B, 0xB4, 0x2F, 0x54, 0xCA, 0x88,
+    0x45, 0xB7, 0x59, 0x70, 0x47, 0x78, 0xD2, 0xB1, 0x6E, 0xA5, 0x03, 0xB5, 0x34, 0x28, 0xBF, 0x20,
+    0x4E, 0x16, 0x0D, 0xAC, 0x75, 0xFF, 0x79, 0x44, 0xF4, 0xD4, 0xB0, 0x9F, 0x1D, 0x7B, 0x7A, 0xE7,
+    0xA1, 0xC8, 0x66, 0x23, 0x4C, 0x7E, 0xCD, 0xD5, 0xCE, 0xB2, 0xDD, 0x9F, 0x6B, 0xA8, 0x17, 0xF1,
+    0xA8, 0xB3, 0xAF, 0x51, 0xDE, 0x20, 0x7E, 0x34, 0x93, 0xB4, 0x09, 0xCE, 0x4A, 0xE1, 0x14, 0x3F,
+    0xC0, 0xD9, 0x4D, 0x70, 0x36, 0x74, 0x96, 0xD9, 0xA9, 0x01, 0x4E, 0xCB, 0x95, 0x5D, 0x84, 0xD3,
+    0xF0, 0xF3, 0xED, 0x5C, 0x60, 0xBF, 0x99, 0xCC, 0x99, 0x24, 0x63, 0xF9, 0xF6, 0xC2, 0x96, 0x68,
+    0x35, 0xFE, 0xD8, 0x22, 0x1B, 0x7C, 0xD0, 0xDD, 0xC3, 0x76, 0x0C, 0xCC, 0x10, 0x02, 0x07, 0x12,
+    0x3F, 0x7B, 0x4A, 0xBC, 0x7A, 0xE0, 0x15, 0xEA, 0x75, 0xF3, 0x90, 0xDB, 0x08, 0x56, 0x08, 0x56,
+    0x7C, 0xC4, 0x3D, 0x9E, 0x68, 0xDF, 0xFE, 0x81, 0x1D, 0x5E, 0x23, 0xCE, 0x72, 0xA0, 0x27, 0x8B,
+    0x57, 0xF6, 0x45, 0x13, 0xB8, 0xC1, 0xF4, 0x78, 0xFF, 0x84, 0xFB, 0x4B, 0xC6, 0x3C, 0xDE, 0x28,
+    0x4C, 0xE3, 0xF1, 0x1E, 0xFE, 0xE5, 0x7F, 0x73, 0x9F, 0xA0, 0xC7, 0xF8, 0x3B, 0xDF, 0xC0, 0x1F,
+    0xEC, 0x02, 0x68, 0xA3, 0x60, 0xAF, 0x58, 0xEA, 0xF5, 0x79, 0x04, 0xB0, 0x4D, 0x34, 0xB3, 0xD4,
+    0x11, 0xB8, 0x57, 0x03, 0xE6, 0xA0, 0x38, 0xD0, 0xCE, 0xBF, 0x31, 0x1A, 0xCA, 0xB3, 0xA7, 0x1A,
+    0x2A, 0x4D, 0x7E, 0x28, 0x61, 0x46, 0x50, 0x07, 0xCC, 0x6A, 0x67, 0x9B, 0x60, 0x0C, 0x52, 0x9F,
+    0x1B, 0x22, 0x5E, 0x66, 0x74, 0xBA, 0xDC, 0xED, 0xCD, 0xB1, 0xE3, 0x40, 0x2C, 0xB0, 0x9E, 0x15,
+    0x0F, 0xDF, 0xE8, 0xAE, 0xD0, 0x11, 0x49, 0xA1, 0x7C, 0x14, 0x8E, 0x07, 0x40, 0x60, 0x26, 0x82,
+    0xE1, 0x86, 0xA3, 0xFB, 0xFA, 0xEC, 0x7C, 0x21, 0x54, 0x0A, 0x37, 0xB9, 0x03, 0xB4, 0x3E, 0x7D,
+    0xF7, 0x6A, 0xBA, 0x0B, 0x3F, 0x63, 0x94, 0xAC, 0x26, 0x76, 0x5D, 0xA3, 0xD5, 0x4C, 0x1D, 0xFD,
+    0x45, 0xF5, 0x96, 0xEE, 0x88, 0xED, 0x84, 0xF5, 0x64, 0xC0, 0xBB, 0x1F, 0x0B, 0xBF, 0xB7, 0x44,
+    0x3A, 0x1E, 0xDA, 0x99, 0x48, 0x51, 0xE2, 0x86, 0xB1, 0x05, 0xF7, 0xDF, 0xEF, 0xA7, 0xD4, 0xCC,
+    0x60, 0xCA, 0x0A, 0xC0, 0xEB, 0x66, 0x08, 0x05, 0xD2, 0x09, 0x1C, 0xB8, 0x1B, 0xBA, 0xCC, 0x16,
+    0x7C, 0x59, 0x5A, 0x8D, 0x5B, 0x70, 0x29, 0x60, 0x5C, 0x7C, 0xC8, 0x23, 0x06, 0xDC, 0x61, 0x4C,
+    0x84, 0xA9, 0x13, 0x4C, 0x91, 0x91, 0x74, 0xE8, 0x16, 0x82, 0xE4, 0x76, 0x62, 0x00, 0x0A, 0x35,
+    0x28, 0xD0, 0x5D, 0x30, 0x64, 0xEC, 0x92, 0x70, 0xFC, 0xF8, 0xB9, 0x05, 0x10, 0x97, 0x95, 0xBE,
+    0x40, 0xEA, 0x6E, 0x45, 0x87, 0xAB, 0x3C, 0x73, 0x77, 0x8E, 0x5B, 0xA2, 0x51, 0x98, 0x0B, 0xD9,
+    0xCE, 0x37, 0x84, 0x7C, 0xCB, 0xBF, 0xFF, 0x77, 0xFC, 0x08, 0xC7, 0x5D, 0x92, 0xFA, 0xBF, 0x19,
+    0x9A, 0x35, 0x95, 0x6C, 0x82, 0x78, 0x80, 0x20, 0x1C, 0x46, 0xEC, 0x84, 0x4A, 0x30, 0x76, 0x9C,
+    0xA7, 0x99, 0x5A, 0xD5, 0x5C, 0xC5, 0xF6, 0x6A, 0x14, 0xEB, 0x86, 0xC7, 0xA8, 0x6A, 0x71, 0x5F,
+    0xFD, 0xBD, 0x4A, 0x15, 0xB5, 0x7D, 0x8E, 0xAC, 0x9E, 0xA5, 0xC7, 0x00, 0xCD, 0x36, 0xAF, 0x26,
+    0x1B, 0x8A, 0xD4, 0x5E, 0x05, 0x05, 0x13, 0xED, 0x0A, 0x91, 0xEA, 0x82, 0x9F, 0xA0, 0x62, 0x1E,
+    0x10, 0x59, 0x68, 0x32, 0x00, 0x45, 0x06, 0x63, 0x3D, 0xE1, 0xC1, 0x0D, 0x6D, 0x30, 0x2B, 0x00,
+    0xBC, 0x8D, 0x46, 0xBB, 0x2C, 0x6F, 0xE9, 0x06, 0x5C, 0x88, 0x43, 0xB2, 0x1A, 0x1A, 0x8A, 0xC3,
+    0x58, 0x90, 0xB0, 0x93, 0xD8, 0x1D, 0x68, 0x9B, 0xED, 0x9A, 0xAD, 0xF6, 0xB0, 0x0B, 0xE2, 0xEE,
+    0xCA, 0xA4, 0x23, 0xAD, 0x9D, 0x68, 0x4D, 0xA2, 0x6D, 0x94, 0xB6, 0x52, 0x07, 0x8B, 0x16, 0xC0,
+    0xA2, 0x3E, 0x5A, 0x9B, 0x2D, 0xCA, 0xAB, 0xD7, 0xBE, 0xD1, 0x9D, 0x25, 0xC8, 0xB0, 0x83, 0x1C,
+    0xE4, 0xE0, 0xD1, 0x41, 0xDF, 0x28, 0x70, 0x3B, 0xC9, 0xCA, 0x04, 0x89, 0xD3, 0x81, 0x1A, 0x77,
+    0x50, 0x9C, 0xAF, 0x79, 0xE8, 0x50, 0xE6, 0xDA, 0x04, 0x64, 0x4B, 0xDD, 0x82, 0x6F, 0xFE, 0x37,
+    0x1E, 0x01, 0xAF, 0x35, 0x77, 0x37, 0xD0, 0x89, 0x06, 0xF8, 0xE7, 0x2B, 0x4F, 0x09, 0x16, 0x36,
+    0xD9, 0x99, 0x82, 0xA5, 0xBB, 0x86, 0x59, 0x00, 0xD3, 0x1C, 0x18, 0x30, 0xF3, 0xB0, 0xC8, 0x43,
+    0x06, 0xD5, 0x83, 0x02, 0xCD, 0x64, 0x7F, 0xD8, 0x5E, 0x83, 0xBC, 0x89, 0xDA, 0x06, 0x8C, 0x5C,
+    0x68, 0x27, 0x13, 0xAB, 0xA5, 0x46, 0x15, 0x70, 0x80, 0x17, 0xBF, 0x6A, 0x30, 0x9C, 0x29, 0xE5,
+    0x20, 0x7E, 0x7F, 0x38, 0x5E, 0x78, 0x34, 0x81, 0x82, 0x99, 0xBE, 0x85, 0xFF, 0x2B, 0x0F, 0xEC,
+    0x51, 0x2C, 0x72, 0x35, 0x05, 0xD5, 0x82, 0x72, 0x01, 0x4D, 0x5C, 0xCF, 0xB5, 0xCF, 0xE5, 0x64,
+    0x99, 0x1C, 0x71, 0x8E, 0xD5, 0x5A, 0x2D, 0x4C, 0x35, 0xD7, 0x73, 0x9F, 0xA5, 0x4C, 0x9E, 0x55,
+    0x3C, 0x48, 0xA4, 0x52, 0x2E, 0xE8, 0x3E, 0xD3, 0x8D, 0x10, 0x8D, 0x4A, 0xA9, 0xE8, 0x76, 0xC8,
+    0x15, 0x15, 0x1A, 0xF1, 0xD6, 0xE4, 0xB3, 0xAF, 0xA3, 0x6C, 0xC0, 0xF2, 0x54, 0x23, 0xFF, 0x90,
+    0xD8, 0x65, 0x96, 0xBF, 0x3D, 0x44, 0xBD, 0xCC, 0xFB, 0xD7, 0x2C, 0x5A, 0x6E, 0xF1, 0x34, 0x78,
+    0xAF, 0xEB, 0x1F, 0x95, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xB6, 0xB5, 0xB1, 0x90, 0x8B,
+    0xA1, 0xD8, 0x4D, 0x11, 0x0A, 0xB7, 0x88, 0xC6, 0xBF, 0x00, 0xCD, 0xA0, 0x95, 0xA8, 0xB7, 0x60,
+    0x8B, 0x88, 0x76, 0x69, 0xA0, 0x08, 0xBF, 0x80, 0x71, 0x44, 0x41, 0x9B, 0x82, 0x3E, 0x0D, 0x12,
+    0x64, 0xB7, 0xE0, 0x17, 0x2C, 0x76, 0xB4, 0xC5, 0x16, 0x14, 0x18, 0x1A, 0x24, 0x1A, 0x0C, 0x0A,
+    0x0A, 0x4A, 0x8A, 0x0C, 0x8A, 0x21, 0xDE, 0xC4, 0x9E, 0xC3, 0xB9, 0xF3, 0x1E, 0x4A, 0x88, 0x84,
+    0xC2, 0xFA, 0x69, 0x3E, 0xDE, 0x7C, 0xDC, 0x8F, 0x73, 0xEF, 0x3D, 0x23, 0x87, 0x87, 0x22, 0x16,
+    0x98, 0xC5, 0x00, 0xE8, 0xE5, 0xC6, 0xD3, 0x6E, 0x91, 0x72, 0x29, 0xE0, 0x32, 0x88, 0x1D, 0xC5,
+    0xF7, 0x66, 0x96, 0x3A, 0x14, 0x2B, 0x17, 0xB9, 0x92, 0x21, 0x47, 0x2B, 0xFE, 0x11, 0xBB, 0x1A,
+    0x70, 0x52, 0x6A, 0x97, 0xA1, 0x09, 0x22, 0xFE, 0x0C, 0xC2, 0x93, 0x36, 0xF0, 0x64, 0x15, 0xB9,
+    0x28, 0x5D, 0xC8, 0xBA, 0x7B, 0x06, 0xFB, 0x40, 0x8B, 0x19, 0x18, 0xAB, 0x55, 0xF8, 0xED, 0x89,
+    0x5C, 0xBB, 0xA3, 0x17, 0xDB, 0x0E, 0x28, 0xF1, 0xFE, 0x62, 0xC7, 0x32, 0xC0, 0x99, 0xB3, 0x55,
+    0xDE, 0x36, 0x3C, 0x61, 0xA3, 0x13, 0x8F, 0x41, 0x3A, 0x04, 0x8E, 0x13, 0xF5, 0x50, 0x22, 0x7E,
+    0x68, 0x33, 0xDC, 0x6E, 0x8B, 0xE8, 0xC5, 0xFC, 0x19, 0xC5, 0x9F, 0xE3, 0x24, 0xD2, 0x80, 0xB1,
+    0xC1, 0x2A, 0xD9, 0xA1, 0x6C, 0x3E, 0xBA, 0x01, 0xBC, 0xD0, 0x39, 0xB4, 0xDF, 0x58, 0xD9, 0x76,
+    0xA7, 0xAF, 0xB1, 0x3B, 0x12, 0x76, 0x72, 0xB9, 0xEE, 0x0A, 0xEE, 0xA9, 0xE8, 0x75, 0xDB, 0xE9,
+    0x97, 0x01, 0x83, 0xC7, 0x13, 0x10, 0x0C, 0xBC, 0x8B, 0x21, 0xF3, 0x63, 0x41, 0xDF, 0x21, 0x66,
+    0x91, 0x62, 0x11, 0x22, 0x60, 0x82, 0x10, 0x4B, 0xDB, 0x5F, 0x66, 0xD9, 0xF7, 0x39, 0x5C, 0x1E,
+    0xE9, 0xAB, 0x6B, 0xA6, 0x6D, 0x34, 0xD8, 0x2F, 0x22, 0x15, 0x92, 0x31, 0xD7, 0x9D, 0xBC, 0xA8,
+    0xFE, 0x1C, 0xC8, 0x14, 0xC0, 0x41, 0xFC, 0x58, 0x6A, 0x64, 0x84, 0xE8, 0x55, 0x93, 0x34, 0x33,
+    0x35, 0x50, 0x6C, 0x16, 0x45, 0xBA, 0x81, 0xB2, 0x33, 0xB4, 0x5C, 0x28, 0x90, 0xD1, 0xFA, 0x6A,
+    0xE5, 0x82, 0x98, 0xD9, 0x52, 0x60, 0xF3, 0x07, 0x65, 0x8B, 0xFF, 0x2E, 0xA8, 0xA3, 0x1D, 0x85,
+    0xE7, 0xAA, 0x8C, 0x07, 0x47, 0x51, 0x9D, 0xAA, 0xA9, 0x9E, 0x13, 0xAE, 0x83, 0xBC, 0xF4, 0x59,
+    0x4C, 0xE5, 0x94, 0x23, 0x5A, 0x84, 0x6A, 0xCE, 0xB1, 0xD6, 0x68, 0xE9, 0x8D, 0x0F, 0x45, 0xF2,
+    0xAA, 0xA1, 0x83, 0xAE, 0x5E, 0x69, 0x06, 0x55, 0x37, 0x4C, 0xA3, 0x96, 0xFE, 0x59, 0x88, 0x77,
+    0x69, 0x74, 0x9D, 0x1A, 0xE6, 0xD1, 0xD2, 0x40, 0x3B, 0x9E, 0x76, 0xBD, 0x42, 0x1B, 0x16, 0x7B,
+    0x77, 0x49, 0x36, 0xD9, 0x5F, 0xA9, 0xD4, 0xFC, 0x35, 0x37, 0x8F, 0x27, 0x8E, 0xCF, 0x82, 0x79,
+    0x12, 0xD4, 0x9C, 0x60, 0xD4, 0x2E, 0x1A, 0x57, 0xD1, 0x63, 0x8E, 0x43, 0x41, 0x7C, 0x68, 0x32,
+    0x75, 0x6D, 0x22, 0x45, 0xF4, 0x74, 0xA4, 0x8E, 0x97, 0x8C, 0x65, 0x90, 0xCE, 0xB0, 0x5A, 0xCC,
+    0x16, 0xBD, 0xA7, 0x95, 0x83, 0x60, 0x30, 0x13, 0x71, 0xCE, 0xA9, 0xB8, 0x99, 0x3D, 0xAF, 0x77,
+    0x3F, 0x07, 0x95, 0xA9, 0xEE, 0x9B, 0x74, 0xBD, 0x0B, 0x69, 0x9A, 0x40, 0xD1, 0xA0, 0x7B, 0x5D,
+    0x30, 0xBF, 0x50, 0x55, 0xA1, 0xC9, 0x4D, 0x35, 0x96, 0x48, 0x8F, 0x19, 0xFA, 0x2A, 0xBA, 0x1A,
+    0x9F, 0x21, 0x32, 0x54, 0x1D, 0x06, 0x20, 0x24, 0x9D, 0x35, 0x96, 0x06, 0x0F, 0x11, 0x2B, 0x4C,
+    0x9E, 0x40, 0x68, 0x7E, 0x10, 0x78, 0x06, 0x8A, 0xD1, 0x5E, 0x0A, 0x3A, 0x88, 0x9B, 0xEA, 0x6D,
+    0xA0, 0x6C, 0xCD, 0x69, 0x2A, 0x40, 0x52, 0x98, 0x5C, 0xE9, 0x15, 0xE1, 0x64, 0xC0, 0x26, 0x1E,
+    0xF2, 0xAF, 0xC5, 0x86, 0xF5, 0xC1, 0xE3, 0x7A, 0x1D, 0x71, 0xE3, 0x21, 0x8B, 0x09, 0x77, 0xD9,
+    0x26, 0x56, 0xD4, 0xDA, 0xB4, 0x55, 0xAC, 0x86, 0x12, 0x99, 0x46, 0x43, 0xF2, 0x54, 0x9F, 0xFD,
+    0x46, 0x80, 0x22, 0xD7, 0x8D, 0x1B, 0x39, 0xB4, 0x5F, 0x53, 0xE5, 0xA8, 0x66, 0x0A, 0x52, 0x4F,
+    0xFD, 0x6D, 0x14, 0xF3, 0x98, 0x32, 0x58, 0xA8, 0x1A, 0x4F, 0x6C, 0x50, 0xB4, 0xAB, 0x8D, 0x6C,
+    0xEE, 0x12, 0x3F, 0xDE, 0x78, 0xEB, 0x2B, 0x26, 0x9C, 0x86, 0x5B, 0x63, 0x91, 0xD3, 0x52, 0xF5,
+    0xB8, 0xA2, 0xD2, 0x5A, 0x95, 0xFF, 0xBF, 0xAD, 0xF5, 0xF9, 0x96, 0xD9, 0x6E, 0xED, 0x89, 0x7F,
+    0xCA, 0xAA, 0xEB, 0xBB, 0x7C, 0xA9, 0x42, 0xF3, 0x8A, 0x21, 0xE2, 0x19, 0x7E, 0x3A, 0x96, 0x2B,
+    0xB7, 0x44, 0x91, 0x97, 0x9A, 0xEE, 0xDA, 0x65, 0xD3, 0x4E, 0x3F, 0x11, 0x59, 0xAC, 0x64, 0xB3,
+    0x75, 0xC5, 0x54, 0xF7, 0x65, 0x30, 0x43, 0x35, 0x56, 0xA3, 0x19, 0x4A, 0xDE, 0x2C, 0xE6, 0xA6,
+    0xCD, 0xE7, 0xE3, 0xE3, 0xE3, 0x2F, 0x89, 0xC1, 0x23, 0x6C, 0x4A, 0x4F, 0xE4, 0xE3, 0x22, 0xD4,
+    0x63, 0x33, 0xD6, 0xBD, 0xE1, 0x9F, 0xAB, 0x07, 0x29, 0x2D, 0x88, 0x92, 0xD8, 0xDF, 0x58, 0x5D,
+    0x6D, 0xD7, 0x37, 0xCE, 0xAB, 0xF1, 0xBD, 0x5C, 0x43, 0xCF, 0x70, 0xF4, 0x0D, 0x9B, 0x1F, 0x7C,
+    0xDF, 0xB5, 0xBE, 0x27, 0xD3, 0xF5, 0xDD, 0x43, 0xFC, 0xEE, 0x15, 0xD9, 0x58, 0x4F, 0xD9, 0x41,
+    0xE6, 0x64, 0x87, 0x75, 0xAC, 0x49, 0x65, 0xD5, 0x59, 0x9D, 0x64, 0x8A, 0x78, 0xFD, 0x7C, 0x72,
+    0x9D, 0x13, 0x1F, 0x55, 0xC9, 0x9C, 0x29, 0x19, 0xD4, 0xB3, 0x59, 0x13, 0x27, 0x93, 0x8D, 0xA1,
+    0x93, 0xF0, 0xCF, 0x44, 0x57, 0xA2, 0x4E, 0x86, 0x3A, 0x54, 0x4B, 0x8E, 0x13, 0x32, 0x08, 0x29,
+    0x82, 0xB7, 0x08, 0xDC, 0xDE, 0x81, 0xC8, 0xCE, 0x2D, 0xA6, 0x16, 0x49, 0x02, 0x37, 0x71, 0x7B,
+    0xB1, 0x83, 0x3D, 0x5F, 0x8A, 0xA9, 0x6B, 0x77, 0xCD, 0x9C, 0x18, 0x2E, 0x0D, 0xBD, 0x68, 0x5A,
+    0xFB, 0x59, 0x3E, 0x25, 0xE5, 0x98, 0xE4, 0xC0, 0x98, 0xEE, 0x8A, 0x1C, 0x68, 0xF9, 0x39, 0x7A,
+    0x4C, 0x08, 0xDF, 0xD0, 0x92, 0x60, 0xF1, 0xA4, 0x42, 0x4B, 0x93, 0x0F, 0xF4, 0xA5, 0xE0, 0x16,
+    0x53, 0xCF, 0xD5, 0x17, 0x37, 0xA6, 0x22, 0x72, 0x8B, 0xAF, 0xC6, 0x54, 0x2D, 0x9C, 0x90, 0x17,
+    0x26, 0xCA, 0xDF, 0x4E, 0xD2, 0x8A, 0x6E, 0x91, 0x38, 0x1D, 0x39, 0xFA, 0x82, 0xA5, 0xD9, 0x2D,
+    0x15, 0xCB, 0xB3, 0xDF, 0x71, 0xBB, 0xA4, 0xDA, 0x03, 0xBA, 0xCB, 0x02, 0xA7, 0x9D, 0x7C, 0x16,
+    0x7A, 0x7B, 0x7F, 0xCE, 0x63, 0xD7, 0x36, 0x8C, 0x42, 0xD4, 0x60, 0x5C, 0x1C, 0xBE, 0x47, 0xAD,
+    0x94, 0xCB, 0x42, 0x92, 0xFD, 0x4D, 0x9A, 0xD2, 0xCE, 0x49, 0x76, 0xD4, 0xCE, 0x0F, 0xB9, 0xC5,
+    0xB9, 0x65, 0x65, 0x74, 0x3F, 0x52, 0x93, 0x4C, 0x84, 0xE4, 0x75, 0x12, 0xAA, 0x68, 0x23, 0x20,
+    0x6A, 0xA2, 0x7C, 0x84, 0x3B, 0xAC, 0x38, 0x79, 0x75, 0xA3, 0xA6, 0x86, 0xAF, 0x22, 0x69, 0x83,
+    0xF8, 0x7D, 0x7E, 0xD5, 0xD1, 0x2A, 0x42, 0xAB, 0x51, 0xFD, 0x1E, 0x6F, 0x9A, 0x40, 0xA2, 0x25,
+    0xA1, 0xB5, 0x26, 0x94, 0xC9, 0x3B, 0x57, 0x82, 0x31, 0x6C, 0xA8, 0x3B, 0xF1, 0x85, 0x56, 0xB4,
+    0x66, 0xAD, 0x00, 0x0F, 0xF4, 0x26, 0x5F, 0x2C, 0x32, 0x43, 0xFD, 0xE0, 0x04, 0xFB, 0x0B, 0x51,
+    0xF3, 0x24, 0xC6, 0x32, 0xBE, 0xD3, 0x8D, 0xE9, 0xE1, 0x85, 0xBE, 0x61, 0x5F, 0x7F, 0xC1, 0xD3,
+    0xBB, 0xCA, 0x3C, 0xCA, 0x7A, 0x5A, 0xA8, 0x09, 0xEA, 0x52, 0xC9, 0x47, 0x73, 0x57, 0x53, 0x8B,
+    0x09, 0x91, 0x1D, 0xF1, 0x75, 0xE5, 0x0B, 0x5D, 0xEB, 0xC3, 0x40, 0x99, 0xF4, 0x71, 0x20, 0xAB,
+    0xAC, 0x8C, 0x63, 0xAD, 0xD0, 0xFB, 0xC1, 0x30, 0x5B, 0x9C, 0xFD, 0xAF, 0x25, 0x12, 0x94, 0xC1,
+    0x7D, 0xCC, 0x7E, 0x9B, 0xD6, 0xF2, 0x37, 0xA5, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xCF,
+    0xA3, 0x5D, 0x4B, 0xB8, 0x30, 0xC5, 0x22, 0x45, 0xFB, 0x0A, 0xD7, 0x04, 0x09, 0xFF, 0x01, 0x60,
+    0xAC, 0xDD, 0x82, 0x32, 0x5B, 0x2C, 0xFF, 0x20, 0x7D, 0xFE, 0x00, 0x62, 0x1C, 0x9A, 0x94, 0xA4,
+    0xA0, 0xCF, 0xD6, 0x69, 0x68, 0x69, 0xC2, 0x78, 0x37, 0x45, 0x0A, 0x1A, 0x67, 0xA3, 0xF4, 0x83,
+    0x40, 0x42, 0x24, 0x05, 0x03, 0x38, 0xC9, 0x4B, 0x32, 0xF6, 0xE1, 0x5C, 0x7B, 0x03, 0x89, 0xB2,
+    0xC0, 0x4A, 0xCC, 0x7B, 0x33, 0xB6, 0x67, 0xC6, 0xF7, 0xE3, 0x9C, 0x33, 0xD7, 0x72, 0x20, 0x36,
+    0xE4, 0x10, 0x17, 0xB3, 0x51, 0xE6, 0xB6, 0x6A, 0xEA, 0x29, 0x47, 0x58, 0x4F, 0x5C, 0x30, 0xE7,
+    0x0C, 0x39, 0xF6, 0x31, 0x59, 0x04, 0xD9, 0x12, 0x93, 0xC4, 0x87, 0x62, 0x14, 0xDB, 0x2D, 0xAF,
+    0x1E, 0xE6, 0xE8, 0x7C, 0xCA, 0xD0, 0xE5, 0x49, 0xDC, 0xBF, 0x0E, 0xBE, 0xAD, 0x86, 0x1C, 0xDC,
+    0xEE, 0x86, 0xEC, 0x27, 0x91, 0x1D, 0xBE, 0xEC, 0xA3, 0x48, 0x09, 0x5A, 0x5A, 0x83, 0x4F, 0xDC,
+    0x23, 0x52, 0x71, 0x8A, 0xFB, 0x19, 0xD3, 0x32, 0x55, 0xA3, 0xAB, 0xA2, 0x63, 0xB0, 0x9D, 0xEB,
+    0x57, 0xA0, 0xF7, 0x3C, 0xD1, 0x75, 0xF5, 0x8C, 0x7B, 0x1D, 0x22, 0x77, 0xB9, 0x9E, 0x53, 0x9E,
+    0x53, 0x91, 0x86, 0xDC, 0x31, 0xDA, 0x15, 0x32, 0xB4, 0xF9, 0x68, 0xD0, 0x82, 0xDE, 0x6E, 0x20,
+    0xE5, 0xD3, 0x9C, 0xA2, 0xEC, 0x64, 0xE8, 0xFD, 0xB8, 0x8D, 0xDE, 0x30, 0xFC, 0x8B, 0x0C, 0x39,
+    0x41, 0x19, 0x3D, 0x7A, 0x39, 0xDC, 0xBA, 0x29, 0x57, 0xA5, 0x40, 0x85, 0x3D, 0x10, 0x0C, 0xE0,
+    0x19, 0x46, 0xF9, 0x06, 0xDA, 0x3A, 0x83, 0x06, 0xC1, 0x46, 0x41, 0x5B, 0x47, 0x66, 0x60, 0x43,
+    0x91, 0x18, 0x7A, 0xB9, 0xC9, 0x34, 0x66, 0xA2, 0xE7, 0x19, 0xFF, 0x05, 0x16, 0xA7, 0x0C, 0xC9,
+    0xA2, 0x40, 0x04, 0x4A, 0xDC, 0x45, 0x9A, 0x7D, 0xD6, 0xC9, 0x8D, 0xE2, 0x26, 0xA0, 0xF9, 0x80,
+    0xAE, 0x5A, 0x75, 0xB5, 0xBC, 0xC5, 0xC1, 0xFD, 0xF7, 0xE0, 0xFB, 0x5A, 0x4D, 0xD9, 0xD9, 0xDE,
+    0xD6, 0xD7, 0x04, 0x8B, 0xC0, 0x00, 0xA1, 0x7A, 0xEE, 0x07, 0x1B, 0xCA, 0xE4, 0xBA, 0x82, 0xC8,
+    0xE5, 0x23, 0xB4, 0xB7, 0x66, 0xB9, 0x76, 0x8A, 0x66, 0x91, 0x5C, 0x2C, 0x07, 0x3B, 0xF9, 0x58,
+    0x32, 0xC5, 0x8C, 0xD9, 0xCA, 0x7B, 0x0D, 0xC9, 0xDE, 0x6E, 0x0C, 0xBE, 0x22, 0xE1, 0x8C, 0x66,
+    0x9B, 0x7D, 0xD0, 0xB0, 0x5B, 0xD7, 0x95, 0x49, 0xF9, 0xED, 0xD4, 0xDE, 0x1B, 0x37, 0xBA, 0x34,
+    0xE4, 0x49, 0xB3, 0x7D, 0x81, 0x9E, 0xAE, 0x37, 0x24, 0x6D, 0x94, 0x7C, 0x3C, 0x5C, 0x38, 0x9E,
+    0x19, 0xD7, 0x9B, 0x0A, 0xAD, 0xE4, 0x20, 0x4F, 0x97, 0x6F, 0xDF, 0xE4, 0xD4, 0xB6, 0xAE, 0x73,
+    0x23, 0xFD, 0x34, 0xEE, 0xA9, 0xEF, 0x19, 0xEC, 0x50, 0x45, 0x33, 0x16, 0x49, 0xB0, 0x4F, 0x41,
+    0xF6, 0x68, 0x19, 0x5D, 0x30, 0x63, 0xC9, 0x89, 0x3D, 0x70, 0xC2, 0x45, 0x37, 0x30, 0xD4, 0x91,
+    0x29, 0xA2, 0xA9, 0x26, 0xDB, 0xCB, 0xBB, 0xE5, 0x20, 0x62, 0x54, 0xE0, 0x60, 0xE4, 0x9C, 0x20,
+    0x90, 0x54, 0x1C, 0x45, 0xB2, 0x7B, 0xFB, 0x88, 0x99, 0xEC, 0xE1, 0x46, 0x72, 0x09, 0x27, 0x1E,
+    0xC9, 0xE0, 0x51, 0x4B, 0x06, 0x89, 0x18, 0x19, 0x3A, 0xE7, 0xE2, 0x06, 0xB1, 0x18, 0x0C, 0x2D,
+    0xCB, 0xEE, 0x81, 0x40, 0x85, 0x15, 0xB1, 0xA2, 0x0E, 0xEB, 0x72, 0xD8, 0xDE, 0xE7, 0xB1, 0xF0,
+    0x68, 0x0B, 0x86, 0xEB, 0x68, 0xDC, 0x3F, 0x61, 0x9C, 0xDF, 0x89, 0xBF, 0x16, 0xDC, 0x3D, 0x50,
+    0x6F, 0x4C, 0xEC, 0x33, 0x4D, 0x52, 0xF4, 0xC4, 0x90, 0x6C, 0xA6, 0xBC, 0x06, 0xAE, 0x00, 0xA7,
+    0xFE, 0xC5, 0x11, 0xF3, 0x21, 0x36, 0x04, 0x4C, 0xEA, 0x28, 0x6F, 0x3E, 0x8C, 0x2B, 0xA6, 0xD2,
+    0x59, 0x95, 0x5B, 0x98, 0xB1, 0x67, 0xAB, 0x53, 0x81, 0xC6, 0xA7, 0x0A, 0xCD, 0xB5, 0xB4, 0x8D,
+    0x86, 0xA6, 0x2E, 0x36, 0x90, 0x24, 0xF2, 0x06, 0xDC, 0xCC, 0x38, 0x90, 0x96, 0xE4, 0x36, 0xB2,
+    0xD5, 0xEC, 0x2C, 0x47, 0x1F, 0x3C, 0xDB, 0x3F, 0x22, 0x95, 0xBC, 0xB4, 0x65, 0xD4, 0xE3, 0xDE,
+    0x96, 0x69, 0x95, 0xA4, 0x1A, 0xCA, 0x48, 0x00, 0x6C, 0x23, 0xFE, 0x84, 0x34, 0xA1, 0xEC, 0x25,
+    0x9B, 0x98, 0x86, 0x99, 0x36, 0x67, 0x87, 0xB6, 0xD2, 0x73, 0x65, 0xE7, 0xF3, 0xDA, 0xCA, 0x6B,
+    0x2D, 0x47, 0x2A, 0x7A, 0x0B, 0x8B, 0x76, 0x32, 0xE8, 0xD1, 0x95, 0x31, 0x9F, 0x45, 0xD0, 0x78,
+    0xD2, 0x60, 0x37, 0x65, 0xC8, 0x38, 0xDF, 0xD1, 0x43, 0xFC, 0x22, 0x55, 0x1D, 0x2D, 0xDF, 0x3A,
+    0x1D, 0xA4, 0x18, 0x86, 0xC9, 0xD2, 0xDC, 0xAD, 0xE2, 0x0F, 0x05, 0x3D, 0xBA, 0x3B, 0xEA, 0xC0,
+    0xA8, 0x1F, 0xC2, 0xA0, 0x2E, 0xD3, 0x5C, 0x11, 0x1C, 0x83, 0x7C, 0xDD, 0x99, 0xC1, 0xC6, 0x8D,
+    0x96, 0x22, 0x68, 0x5D, 0xA8, 0x59, 0x21, 0xF6, 0x07, 0x42, 0x4C, 0xD6, 0x6B, 0x02, 0x3F, 0xD7,
+    0x97, 0x45, 0x02, 0xD4, 0x82, 0xA5, 0xAD, 0xE2, 0x37, 0x48, 0xA6, 0xAA, 0xF1, 0x24, 0xDC, 0x4E,
+    0x25, 0x1E, 0xE3, 0x07, 0x95, 0xDD, 0x8C, 0xC3, 0xA7, 0xF8, 0xF9, 0x2F, 0x1C, 0xF2, 0x73, 0x70,
+    0x70, 0x6F, 0xE2, 0x40, 0x31, 0xB3, 0x24, 0xBC, 0x85, 0xC3, 0x4A, 0xFD, 0x69, 0x8C, 0x1A, 0xEE,
+    0xAE, 0x1F, 0x54, 0x73, 0x2D, 0x1F, 0x78, 0x93, 0x3D, 0x7F, 0x15, 0xB5, 0x03, 0xAE, 0x93, 0x8B,
+    0xE2, 0x85, 0xDF, 0xD4, 0xCC, 0xEF, 0x5B, 0x46, 0xD4, 0x78, 0x16, 0x32, 0xBE, 0xEB, 0x98, 0x3E,
+    0xD4, 0xDE, 0x3B, 0x44, 0xEC, 0xF3, 0x6A, 0x63, 0x22, 0x1E, 0xF9, 0xBB, 0xBA, 0x59, 0x8F, 0xCF,
+    0xD2, 0xB2, 0x49, 0x10, 0xED, 0x2F, 0x39, 0x8F, 0x93, 0xE4, 0x51, 0x5C, 0x63, 0xA8, 0xD0, 0xD6,
+    0x6C, 0xA8, 0x31, 0xA3, 0x8C, 0xB3, 0x7E, 0x4D, 0x52, 0x9C, 0x3D, 0x2E, 0x0B, 0x8D, 0xEE, 0x9B,
+    0x37, 0xB3, 0x8C, 0x84, 0x12, 0xB2, 0xEE, 0xA5, 0x7C, 0x30, 0x8C, 0xF6, 0xCA, 0x3F, 0x0E, 0xF7,
+    0x0F, 0x94, 0x6D, 0x71, 0x29, 0xF3, 0x41, 0x20, 0x45, 0x14, 0xAF, 0x03, 0xEB, 0x57, 0x90, 0x51,
+    0x88, 0xC3, 0xC4, 0x4A, 0xB6, 0x7C, 0x22, 0xD0, 0x2C, 0x73, 0x41, 0xE7, 0xCE, 0xF6, 0x79, 0xDE,
+    0xD9, 0x31, 0x67, 0x75, 0x6B, 0xB5, 0xFA, 0xAE, 0xD0, 0x7E, 0x68, 0x89, 0xF1, 0x4B, 0x4C, 0x94,
+    0xF1, 0x49, 0xBB, 0x0E, 0x9A, 0xC9, 0x6E, 0x91, 0xF0, 0x7D, 0xBA, 0x4C, 0xB4, 0xB2, 0x4D, 0xFD,
+    0x65, 0xAA, 0x4F, 0xE6, 0xFF, 0xE9, 0x58, 0x3F, 0x18, 0x2D, 0xFF, 0xF7, 0xD2, 0xFB, 0x67, 0x29,
+    0x6B, 0xEA, 0xC3, 0x6B, 0x9D, 0x00, 0x17, 0x13, 0xB5, 0x89, 0x48, 0x65, 0xA7, 0xE2, 0xC9, 0xEF,
+    0xA9, 0xBA, 0x1F, 0x53, 0x7D, 0x1C, 0x8F, 0xEC, 0x31, 0xF9, 0xBA, 0x1E, 0xFE, 0xEE, 0x27, 0xEC,
+    0xA7, 0x41, 0xEA, 0xA7, 0xE1, 0x52, 0x89, 0x97, 0x69, 0x2E, 0x43, 0x5A, 0xD5, 0x0D, 0x23, 0x30,
+    0xFD, 0xDB, 0x7D, 0xD5, 0xBC, 0x82, 0x79, 0x26, 0x8E, 0xA7, 0xDE, 0x3E, 0x4E, 0x4C, 0xA6, 0xEE,
+    0x64, 0xA2, 0x20, 0xEA, 0xBE, 0x6C, 0x8C, 0x16, 0x2E, 0xFD, 0x04, 0xEA, 0x0D, 0xEB, 0x4E, 0xD4,
+    0xBA, 0x23, 0x5B, 0xFE, 0xE1, 0x01, 0x85, 0xAC, 0x1F, 0xB6, 0x66, 0xD1, 0x80, 0xA8, 0x34, 0xAA,
+    0x5E, 0x76, 0x2C, 0xD7, 0x95, 0xC4, 0x4D, 0xFD, 0x2B, 0x0D, 0x5E, 0xE5, 0xF1, 0x53, 0x07, 0x1F,
+    0xAF, 0x0E, 0x3E, 0x72, 0x7E, 0x1A, 0x2B, 0x96, 0x52, 0x33, 0xBA, 0x3E, 0x8F, 0x65, 0x28, 0xE6,
+    0x5F, 0x1E, 0x8A, 0xC8, 0x71, 0xA8, 0x3A, 0xD2, 0x1E, 0xF9, 0xF6, 0xF8, 0xC9, 0x3A, 0xDC, 0xB9,
+    0xB4, 0x7C, 0x36, 0xFF, 0x67, 0xFB, 0x13, 0xCD, 0x55, 0xBF, 0x6F, 0xDF, 0x44, 0x14, 0xFF, 0x9C,
+    0x4F, 0x60, 0xA9, 0x16, 0xB9, 0xA5, 0x45, 0xA8, 0x20, 0xBC, 0x57, 0x69, 0xBC, 0x30, 0x64, 0x48,
+    0x72, 0x86, 0x0C, 0x0C, 0x0C, 0xED, 0xD0, 0xAF, 0x18, 0x18, 0xBA, 0x74, 0x01, 0x21, 0x7D, 0x19,
+    0x18, 0x3A, 0xB4, 0x3D, 0x57, 0x88, 0x89, 0x21, 0x91, 0x50, 0xC5, 0x3F, 0xC0, 0x40, 0xCB, 0x50,
+    0x86, 0x8E, 0x49, 0x7D, 0x6D, 0x87, 0x8E, 0xB8, 0x30, 0x76, 0xE8, 0x89, 0x14, 0x21, 0x40, 0x22,
+    0x46, 0x31, 0x95, 0x43, 0x6C, 0x3F, 0xDE, 0xB3, 0x83, 0x48, 0x5B, 0x75, 0xE7, 0x24, 0xFF, 0xB8,
+    0xE7, 0xBB, 0x77, 0x9F, 0xF7, 0x79, 0x9F, 0xF7, 0x6C, 0xA9, 0x2A, 0x7B, 0x47, 0x9E, 0xFA, 0x74,
+    0xC0, 0xBC, 0xD1, 0x03, 0x52, 0x1F, 0x11, 0x6C, 0x01, 0x2A, 0x1C, 0xE0, 0x7C, 0x0F, 0xD8, 0x07,
+    0x1D, 0xD4, 0x7C, 0x6F, 0x3F, 0xD7, 0x74, 0x40, 0x95, 0x22, 0xA2, 0x02, 0x6A, 0xBC, 0x88, 0x3C,
+    0xC6, 0xE9, 0x8C, 0xAE, 0x01, 0xA0, 0xFC, 0xF0, 0xF6, 0x32, 0x3D, 0xE6, 0x6D, 0x24, 0x7B, 0xA9,
+    0x03, 0xCC, 0x8F, 0x4D, 0x6F, 0xCF, 0x1C, 0xDE, 0x30, 0x8E, 0x53, 0x47, 0x6C, 0x0F, 0xCE, 0x22,
+    0x0B, 0x28, 0x29, 0xBF, 0x3D, 0xAF, 0xB7, 0x55, 0x67, 0xB1, 0x9A, 0x06, 0x24, 0x03, 0xF4, 0xA3,
+    0x16, 0x0D, 0x55, 0x4B, 0xC9, 0x10, 0x57, 0x36, 0x0C, 0xAA, 0x4F, 0x1B, 0x73, 0x95, 0xEE, 0xD6,
+    0xA6, 0xBF, 0x04, 0xB7, 0x8B, 0x88, 0x36, 0x90, 0x3D, 0xAC, 0xE2, 0xBD, 0x5E, 0xD7, 0x25, 0x35,
+    0x09, 0xD5, 0x38, 0x59, 0x88, 0x6F, 0xFB, 0x4E, 0xEB, 0xEE, 0x77, 0xEE, 0x5E, 0xB7, 0x14, 0x05,
+    0xE0, 0x84, 0x80, 0x72, 0xC4, 0x6F, 0x76, 0xF3, 0x83, 0x00, 0x53, 0x20, 0x29, 0x74, 0x05, 0x2C,
+    0xE1, 0x56, 0x44, 0xF9, 0x2D, 0xA3, 0xA8, 0xD3, 0x77, 0x2B, 0x1B, 0xFB, 0xC5, 0x95, 0xC4, 0x2F,
+    0xAB, 0x1D, 0xCF, 0x80, 0x17, 0x96, 0x8D, 0x07, 0xF6, 0x0A, 0xC1, 0xBE, 0x22, 0xAF, 0x3B, 0x7E,
+    0x00, 0xDE, 0x3C, 0x1D, 0x0F, 0x1F, 0x47, 0x3E, 0x64, 0xE4, 0x57, 0x92, 0x7C, 0x1E, 0x92, 0x7C,
+    0x15, 0xE0, 0x23, 0x38, 0xA4, 0x2D, 0xE8, 0x7D, 0x75, 0x1B, 0x88, 0x89, 0xD7, 0x41, 0xCD, 0xF8,
+    0xFA, 0x1A, 0xAE, 0xD3, 0x4F, 0x9A, 0x64, 0x3D, 0x20, 0x2D, 0xDC, 0xA0, 0x7F, 0x6E, 0x53, 0x1D,
+    0xAE, 0xB8, 0x86, 0x76, 0xFD, 0x85, 0xE3, 0x82, 0x92, 0xFE, 0x24, 0x7A, 0x7B, 0xC6, 0xE8, 0x16,
+    0xB0, 0x08, 0x87, 0x3E, 0xEA, 0xE3, 0x36, 0x69, 0xD2, 0xDA, 0x86, 0xD2, 0x5B, 0x4F, 0xB9, 0x3C,
+    0x4D, 0x93, 0x05, 0xDD, 0x27, 0x2D, 0x4A, 0xD5, 0x23, 0xC5, 0xAA, 0x84, 0x77, 0x62, 0x36, 0x7B,
+    0x97, 0x88, 0x93, 0x46, 0x0F, 0x66, 0x33, 0xA6, 0x38, 0xE1, 0x60, 0xB6, 0xA7, 0xC7, 0x87, 0x40,
+    0x46, 0x32, 0x04, 0x05, 0xD4, 0x59, 0x20, 0xA5, 0x8A, 0x23, 0x5D, 0xC2, 0x69, 0xA8, 0xEA, 0x15,
+    0xDB, 0x2C, 0x26, 0xF1, 0x86, 0xFE, 0xAC, 0xF8, 0xA9, 0xFA, 0xAE, 0x5A, 0xAD, 0x17, 0xDF, 0x32,
+    0x75, 0xB2, 0xA0, 0xFF, 0x88, 0xEE, 0xDD, 0xD9, 0x0B, 0xE1, 0x93, 0x61, 0xF5, 0x53, 0x03, 0x2C,
+    0x73, 0x38, 0x97, 0x90, 0xFC, 0xD6, 0x02, 0x27, 0x37, 0xD9, 0x5B, 0x43, 0xB4, 0x43, 0x63, 0x62,
+    0x93, 0x1E, 0x34, 0x98, 0x83, 0xDE, 0x45, 0xFB, 0x8D, 0x3E, 0xA8, 0xCC, 0x23, 0x7F, 0xDB, 0xEE,
+    0xD6, 0x8E, 0xF2, 0xF9, 0x63, 0x39, 0x2D, 0x2B, 0x10, 0xB5, 0x47, 0x1E, 0xF1, 0x84, 0xF1, 0x87,
+    0x6F, 0x87, 0xEB, 0xCF, 0x7C, 0x4B, 0xF3, 0x51, 0x01, 0x37, 0x6E, 0x7C, 0x35, 0x2D, 0x61, 0xE0,
+    0x88, 0x06, 0xCE, 0xD1, 0xFA, 0x40, 0xE9, 0x9D, 0x7E, 0x2D, 0xAE, 0x91, 0x79, 0x89, 0xB7, 0x8A,
+    0x7A, 0x7E, 0xD3, 0xC3, 0x8D, 0xF3, 0x44, 0x96, 0xDA, 0x69, 0x59, 0x49, 0xEB, 0x7F, 0x91, 0x51,
+    0x1D, 0x4C, 0x50, 0xBC, 0xA9, 0xC5, 0xEF, 0x1D, 0x78, 0x47, 0xEA, 0x15, 0xA5, 0x54, 0xDB, 0x01,
+    0x1F, 0x89, 0xFB, 0x8B, 0xE6, 0x6E, 0x67, 0xBF, 0x08, 0x17, 0x95, 0xB0, 0x70, 0x1C, 0xA5, 0x4F,
+    0x6B, 0xD6, 0x36, 0x13, 0xDA, 0x8A, 0xBA, 0x43, 0xD2, 0xB1, 0xBE, 0xB3, 0x17, 0x98, 0xC8, 0x9B,
+    0x4E, 0xB3, 0xA9, 0xC9, 0xD8, 0x44, 0x07, 0xC3, 0x97, 0x44, 0xDF, 0xD3, 0x19, 0xEA, 0xD2, 0xD6,
+    0x7E, 0x9E, 0xBF, 0x04, 0x62, 0xF7, 0x9A, 0x95, 0x01, 0x23, 0x5A, 0x76, 0x8C, 0x5E, 0x89, 0x29,
+    0xDA, 0xC4, 0xBF, 0x23, 0xE1, 0x98, 0x38, 0x0F, 0xB5, 0xA5, 0x5D, 0x7E, 0xEE, 0xD4, 0x86, 0xDA,
+    0x8E, 0x95, 0x61, 0xB9, 0x60, 0x36, 0x7C, 0xC9, 0x86, 0x94, 0x0D, 0x9A, 0x0D, 0x1C, 0xCC, 0x86,
+    0x37, 0x6C, 0xC0, 0xD0, 0xB2, 0xC7, 0x35, 0xCB, 0x4E, 0x37, 0x3C, 0x34, 0x1B, 0xF0, 0xBC, 0x81,
+    0x09, 0x58, 0x5B, 0x61, 0x03, 0xC7, 0xA7, 0xFD, 0x74, 0x92, 0xD2, 0xBD, 0xFB, 0x65, 0xB0, 0x15,
+    0x4E, 0x26, 0x5D, 0x16, 0xB6, 0xCD, 0xFD, 0xFA, 0x02, 0xF0, 0x06, 0xE6, 0xC1, 0x0E, 0x8A, 0x25,
+    0x3F, 0x30, 0x49, 0x47, 0x6F, 0x0C, 0x20, 0xE3, 0x32, 0x81, 0xBA, 0xCE, 0xF2, 0xD3, 0xFB, 0x94,
+    0xE6, 0xFD, 0x56, 0xF4, 0xA4, 0x8E, 0x1F, 0x56, 0xD9, 0xF9, 0xA2, 0xB3, 0xBB, 0x15, 0xD3, 0xF7,
+    0xAA, 0xD0, 0x97, 0x52, 0xE0, 0xA4, 0xB3, 0x38, 0x97, 0x71, 0x0B, 0x65, 0x3E, 0x20, 0xAB, 0x5C,
+    0x61, 0x5A, 0xA1, 0x27, 0xE9, 0x14, 0xE9, 0x4E, 0x9E, 0x49, 0x9B, 0xD6, 0x59, 0x65, 0x0B, 0xC7,
+    0xDF, 0x2F, 0xA1, 0xC1, 0xB3, 0x63, 0x81, 0xAF, 0xD3, 0x8C, 0xB5, 0x85, 0x2A, 0xB9, 0xFC, 0xB8,
+    0x9D, 0xB0, 0x7B, 0x98, 0x0A, 0xEA, 0x66, 0x80, 0x12, 0x06, 0x79, 0x6A, 0xF9, 0x38, 0x86, 0x16,
+    0x87, 0x69, 0x3A, 0xF2, 0x2A, 0x15, 0x73, 0xAC, 0xE2, 0xA9, 0xAE, 0x59, 0x01, 0x3C, 0xBD, 0x2C,
+    0x34, 0x73, 0x08, 0xDE, 0xF4, 0x1C, 0x42, 0x24, 0xF2, 0xE3, 0x38, 0x2C, 0xB6, 0xB6, 0x85, 0xED,
+    0x2A, 0x7D, 0x4F, 0x92, 0xD0, 0xE9, 0x20, 0x53, 0x8B, 0xE1, 0xE6, 0xAF, 0x5C, 0x89, 0xC1, 0x90,
+    0x14, 0x7D, 0x87, 0x53, 0x32, 0x65, 0xE9, 0x49, 0x91, 0xB0, 0x50, 0xC6, 0x42, 0xE1, 0x52, 0xC5,
+    0x39, 0xDE, 0xE3, 0xF1, 0x82, 0xB1, 0x3C, 0x61, 0x4F, 0xC2, 0x84, 0xBD, 0x9B, 0xB0, 0xB3, 0x17,
+    0xC1, 0xAE, 0xEB, 0x09, 0xEC, 0xF6, 0x04, 0x56, 0x1A, 0x04, 0x4F, 0xA3, 0x66, 0x9A, 0xAE, 0x71,
+    0x5B, 0x11, 0xB0, 0x77, 0x88, 0x44, 0xA3, 0xAD, 0xDD, 0x6D, 0x78, 0x6A, 0x75, 0x6D, 0xAF, 0x12,
+    0xC5, 0x21, 0xD3, 0x0D, 0x63, 0x67, 0x87, 0xA5, 0x14, 0x4D, 0xCE, 0x2A, 0x87, 0x38, 0x8C, 0x65,
+    0x77, 0x0F, 0x8E, 0x97, 0xD9, 0xF7, 0xE3, 0x47, 0xDD, 0xC0, 0xFE, 0xFD, 0x8D, 0x2C, 0xD4, 0xD2,
+    0x68, 0xF9, 0x18, 0x29, 0x02, 0xD5, 0x4E, 0x08, 0xF5, 0x8B, 0xA0, 0x0B, 0xEE, 0x98, 0x21, 0xF0,
+    0x76, 0x2D, 0x8D, 0x80, 0x5D, 0x5D, 0x39, 0x53, 0xCB, 0x76, 0xED, 0xCB, 0xB1, 0x00, 0x25, 0x07,
+    0xAC, 0x2C, 0xBC, 0xDE, 0x8C, 0x64, 0xC4, 0xEC, 0x5C, 0x78, 0x3F, 0x45, 0x8C, 0x87, 0x79, 0x8F,
+    0xEB, 0x91, 0x77, 0xDE, 0xB8, 0x25, 0xBC, 0xCF, 0x43, 0x5A, 0x98, 0x3E, 0xE6, 0x36, 0x59, 0x33,
+    0xEF, 0x4C, 0xC3, 0x15, 0xE1, 0xFD, 0x1C, 0x3B, 0x1C, 0x79, 0xE7, 0x6C, 0x1C, 0xE5, 0xDD, 0x54,
+    0x23, 0xEF, 0xEA, 0x90, 0x77, 0x49, 0xAF, 0x34, 0xA7, 0x43, 0xDE, 0xFB, 0x43, 0xDE, 0x8B, 0xA7,
+    0x00, 0x1F, 0xCB, 0xB9, 0xFE, 0xE0, 0x02, 0x44, 0xC8, 0x63, 0x73, 0x40, 0x8E, 0xD8, 0x23, 0x96,
+    0xC3, 0x63, 0x0A, 0xAC, 0x46, 0x3B, 0xE4, 0xAE, 0x10, 0x4F, 0x97, 0x27, 0x21, 0xF9, 0xE3, 0x29,
+    0x75, 0x09, 0xB1, 0x1C, 0x3A, 0x64, 0xCD, 0xD3, 0x9A, 0x1B, 0x57, 0x30, 0xB0, 0xB1, 0x6B, 0x69,
+    0x92, 0xEC, 0xA8, 0xF1, 0x1D, 0xAF, 0xFD, 0xB7, 0x50, 0x8D, 0xE5, 0xEA, 0xFC, 0xB8, 0x44, 0x5E,
+    0xD3, 0xB1, 0x67, 0xCA, 0xEF, 0x8A, 0x0D, 0xE2, 0x31, 0x73, 0xA2, 0xC9, 0xAE, 0xF4, 0x22, 0x26,
+    0xD9, 0x6F, 0xD7, 0x49, 0x64, 0x96, 0xC8, 0x5F, 0x21, 0x48, 0xF1, 0xDB, 0x6B, 0xAE, 0xE6, 0x63,
+    0xC6, 0xE4, 0x8C, 0xBF, 0x41, 0x37, 0x7B, 0x9F, 0xA4, 0x37, 0x24, 0xD2, 0xBC, 0x60, 0x5A, 0x45,
+    0x9B, 0x70, 0xFB, 0x19, 0x55, 0x0C, 0x96, 0xEB, 0xC9, 0x49, 0xED, 0xFD, 0xBF, 0xC6, 0x3F, 0xC5,
+    0x55, 0xB1, 0x8A, 0xD4, 0x50, 0x14, 0xBD, 0x49, 0x74, 0x03, 0x06, 0x8D, 0x85, 0x5B, 0xA8, 0x45,
+    0x2C, 0x2C, 0xEC, 0xF2, 0x05, 0xFA, 0x9E, 0x08, 0x5A, 0x6C, 0xB3, 0xCD, 0x20, 0x68, 0xA1, 0x85,
+    0x8D, 0x36, 0xFB, 0x03, 0xEA, 0x1B, 0x11, 0xAC, 0x17, 0xC1, 0xDE, 0x62, 0x0B, 0x59, 0x0B, 0xFD,
+    0x01, 0x4D, 0xD0, 0xD2, 0xC2, 0xA8, 0x88, 0x85, 0x85, 0x11, 0xB4, 0x4F, 0x11, 0x31, 0xA3, 0x49,
+    0xAE, 0xE7, 0xBC, 0x99, 0xD9, 0xE9, 0x44, 0x10, 0x31, 0xEC, 0xBC, 0x79, 0xBC, 0x39, 0xF7, 0xDC,
+    0x73, 0xCF, 0xBD, 0x2F, 0x2B, 0xB2, 0x78, 0x2A, 0x2E, 0x59, 0x89, 0x25, 0x52, 0x6E, 0x5D, 0xC7,
+    0xED, 0x68, 0xB1, 0xEE, 0x97, 0xD5, 0x13, 0x6C, 0xFB, 0x1F, 0x57, 0xB8, 0x6C, 0xE4, 0xAA, 0xBD,
+    0x3F, 0x68, 0xB1, 0xE6, 0xAE, 0xC6, 0xDA, 0x17, 0x80, 0xC4, 0xB5, 0x22, 0xDE, 0x9C, 0x03, 0x30,
+    0xE8, 0x13, 0x40, 0xD2, 0x3A, 0x05, 0xC4, 0x3C, 0x70, 0x8D, 0x84, 0xAA, 0x5A, 0x4A, 0x8A, 0x75,
+    0x2A, 0x6E, 0x72, 0x51, 0x25, 0xEA, 0x25, 0x19, 0x24, 0xAB, 0x24, 0xED, 0x02, 0xDD, 0x16, 0x37,
+    0xCB, 0xB5, 0xCA, 0xB4, 0x57, 0xB5, 0x4E, 0x1B, 0xE4, 0x99, 0x32, 0xBB, 0x72, 0x4D, 0x95, 0xE9,
+    0x7B, 0x83, 0x7D, 0x5A, 0x19, 0x6C, 0x4F, 0xC9, 0x89, 0x95, 0xC2, 0x6B, 0x5E, 0x55, 0xE3, 0x55,
+    0x11, 0x17, 0xFB, 0x18, 0xE3, 0xC5, 0xEA, 0x80, 0x25, 0xF9, 0xC4, 0xD2, 0x4C, 0x0E, 0x48, 0xD0,
+    0x99, 0x8A, 0x24, 0x04, 0xBA, 0x10, 0x90, 0xA8, 0x8B, 0x00, 0x49, 0xBF, 0x5E, 0x81, 0xD8, 0x42,
+    0x91, 0x37, 0x82, 0xC0, 0x5A, 0xB2, 0xF7, 0x13, 0x40, 0x14, 0xA2, 0x6D, 0xDC, 0xC2, 0x15, 0x71,
+    0x5F, 0x50, 0xF8, 0x86, 0xB6, 0xB1, 0xAA, 0xF1, 0x32, 0x17, 0xC9, 0xB3, 0xE6, 0x29, 0xD3, 0xFC,
+    0x84, 0x05, 0xD1, 0x4F, 0x16, 0x9F, 0xC4, 0x9D, 0xB7, 0x4D, 0xFE, 0xBB, 0xC0, 0xB5, 0xE9, 0x75,
+    0x76, 0xEE, 0x2E, 0x02, 0x43, 0x65, 0xFA, 0xB8, 0x33, 0x25, 0x95, 0x1D, 0x59, 0x49, 0x3B, 0xCA,
+    0x25, 0xF6, 0xC5, 0x98, 0xC6, 0xFB, 0x5D, 0xEF, 0xF9, 0x6D, 0x58, 0x4E, 0xF8, 0x9D, 0xED, 0x4E,
+    0x5F, 0x11, 0x72, 0x9B, 0xBD, 0x8C, 0x5A, 0x02, 0xB3, 0x92, 0xED, 0x1E, 0x05, 0x90, 0x68, 0x86,
+    0x5E, 0x4A, 0xAE, 0xB4, 0x04, 0xD2, 0x3A, 0x89, 0xBF, 0x4D, 0xD0, 0x6E, 0xA4, 0x2A, 0xAA, 0x00,
+    0xD2, 0x75, 0x9A, 0xCD, 0x50, 0xF2, 0x7D, 0x1D, 0x02, 0xD5, 0xD7, 0x5E, 0x20, 0xB8, 0xD6, 0x99,
+    0x32, 0xF4, 0x46, 0xE4, 0x5B, 0x9C, 0xB9, 0xF6, 0x0C, 0x07, 0xAA, 0xA2, 0x11, 0xE9, 0x47, 0xA6,
+    0x4F, 0xE9, 0x8C, 0xEC, 0xB7, 0xFF, 0x75, 0x08, 0x17, 0x0F, 0x03, 0x58, 0xAA, 0x7A, 0xEF, 0x25,
+    0xF1, 0x75, 0xA2, 0xE1, 0x83, 0x3C, 0x47, 0x15, 0xBD, 0xDA, 0x0C, 0x19, 0x07, 0x53, 0x85, 0xF8,
+    0x2A, 0x98, 0x0C, 0x62, 0x23, 0xAF, 0xDF, 0x4C, 0x75, 0x77, 0x87, 0x7E, 0x19, 0x96, 0x0D, 0x25,
+    0xCC, 0x9C, 0xCC, 0x2E, 0x8F, 0x93, 0x39, 0x1D, 0x2D, 0xC6, 0x57, 0x25, 0x16, 0x5E, 0x65, 0xAD,
+    0xDC, 0x44, 0x4F, 0x11, 0x69, 0xC4, 0x59, 0x98, 0x9B, 0x95, 0xAE, 0x0A, 0xD8, 0x75, 0x55, 0xA2,
+    0x7A, 0xA3, 0x25, 0xBE, 0x58, 0xFB, 0x8D, 0x6D, 0x78, 0xAA, 0x25, 0xE8, 0xDA, 0x54, 0x1F, 0x0F,
+    0xA8, 0xC1, 0x5C, 0x18, 0x24, 0x7D, 0x87, 0x89, 0x68, 0x40, 0x7A, 0x98, 0x5E, 0x71, 0x9E, 0x58,
+    0xBF, 0xB7, 0x8C, 0x2D, 0xCD, 0xA1, 0x2C, 0x19, 0xD9, 0x65, 0xCC, 0x98, 0x19, 0x38, 0x89, 0xB3,
+    0x4B, 0x0D, 0xF8, 0x7B, 0x54, 0x34, 0xA0, 0x87, 0x38, 0x5A, 0xDF, 0x14, 0x4C, 0xCE, 0x3C, 0x50,
+    0x0A, 0x6E, 0x80, 0x8D, 0xC9, 0xD4, 0x2C, 0xFB, 0x80, 0xE7, 0x20, 0x4D, 0xA9, 0x17, 0xD4, 0x45,
+    0xCB, 0x22, 0xD8, 0x26, 0xBB, 0xE7, 0x18, 0xCA, 0xD5, 0x4F, 0xF8, 0xB4, 0x5B, 0x60, 0x8E, 0xC1,
+    0x7D, 0x16, 0x83, 0x5A, 0xB9, 0x4A, 0x6A, 0x14, 0x29, 0x38, 0x80, 0x88, 0xDD, 0x47, 0xE2, 0xE0,
+    0x40, 0x86, 0x3A, 0xE2, 0x71, 0xB2, 0x19, 0xD0, 0x0C, 0x20, 0x68, 0xC3, 0x69, 0x20, 0xB2, 0x3B,
+    0x6A, 0xD3, 0xCF, 0x50, 0xF7, 0x1D, 0x3C, 0x03, 0xAD, 0x5F, 0xBE, 0x92, 0x50, 0x4A, 0xD8, 0x51,
+    0x3D, 0x5B, 0x61, 0x39, 0xFD, 0x22, 0xDB, 0xF2, 0xAF, 0x73, 0x87, 0xBE, 0x4C, 0x8B, 0x4F, 0x8B,
+    0xC1, 0x72, 0x36, 0xEC, 0xE3, 0x1A, 0x6F, 0xA2, 0xAB, 0x7B, 0x79, 0x09, 0x03, 0xA9, 0xBE, 0x41,
+    0x5C, 0x0B, 0xA2, 0x67, 0x24, 0x42, 0xEE, 0x68, 0xBA, 0x60, 0x96, 0x78, 0xDC, 0x7D, 0x18, 0xD0,
+    0x6A, 0xC0, 0x24, 0x9B, 0x4D, 0xEC, 0x5C, 0xCC, 0x3C, 0x37, 0x43, 0x6E, 0xE3, 0xC0, 0xDC, 0x5B,
+    0xE8, 0x67, 0xEE, 0x5E, 0x76, 0xD0, 0x0D, 0xDD, 0xE8, 0xC4, 0xBC, 0x55, 0xF4, 0x00, 0x63, 0xB1,
+    0xB9, 0x7A, 0xB7, 0x44, 0x4B, 0x75, 0xE7, 0x39, 0x43, 0xAE, 0x0A, 0xC9, 0x71, 0x0B, 0x1C, 0x87,
+    0x56, 0x05, 0xFD, 0xD8, 0x9D, 0x62, 0x52, 0xDA, 0x80, 0x5C, 0xEE, 0xEB, 0x44, 0x56, 0x1E, 0xD8,
+    0x08, 0x21, 0x41, 0x87, 0x83, 0xF1, 0xF8, 0x42, 0x3A, 0xD3, 0x72, 0xEC, 0x1F, 0xE2, 0x9E, 0x4B,
+    0x86, 0xA4, 0xBD, 0x1C, 0xEF, 0x96, 0x6D, 0x8F, 0x78, 0x7F, 0x75, 0x4D, 0xA7, 0xB1, 0x1F, 0x55,
+    0xC4, 0xAA, 0xFD, 0xCD, 0x36, 0x28, 0x66, 0x86, 0x37, 0xC9, 0x5F, 0xA3, 0x03, 0x82, 0xF9, 0xCE,
+    0xDB, 0x48, 0x4B, 0x0C, 0xE1, 0x49, 0xF9, 0x3B, 0x3E, 0xC7, 0x71, 0x8E, 0xB4, 0x49, 0xDF, 0xE2,
+    0x7F, 0xC2, 0xB3, 0xA3, 0x4B, 0x3E, 0xC3, 0x0B, 0xD2, 0x83, 0x0F, 0x11, 0x7F, 0xF8, 0xB7, 0xA6,
+    0x5F, 0xE6, 0x51, 0xC7, 0xEC, 0x8E, 0x79, 0x39, 0xB8, 0x97, 0x83, 0x79, 0xD1, 0xEF, 0x93, 0xCD,
+    0xBF, 0x27, 0x94, 0xF5, 0xC5, 0x0D, 0xAF, 0xFD, 0x3C, 0xD6, 0xB2, 0x35, 0x7B, 0xA2, 0x25, 0x10,
+    0xF9, 0xE8, 0xCB, 0x42, 0x43, 0x2C, 0xDE, 0x7F, 0xD8, 0xA6, 0x3D, 0x9B, 0xA5, 0x25, 0xB6, 0xC9,
+    0xC0, 0xA1, 0x2C, 0x3E, 0xA0, 0x5F, 0x89, 0x3F, 0x2D, 0xCA, 0x15, 0x80, 0xD8, 0xBC, 0xA1, 0x1B,
+    0x64, 0x80, 0xAA, 0x35, 0xF2, 0x32, 0x45, 0xCB, 0x14, 0xB5, 0xFC, 0xD1, 0xF3, 0x0B, 0xCD, 0x55,
+    0xBD, 0x8E, 0xD6, 0x46, 0x14, 0xBD, 0xFE, 0xCC, 0x62, 0xC0, 0x12, 0x4E, 0x81, 0x40, 0x22, 0x48,
+    0x6E, 0xD2, 0xBB, 0x49, 0x89, 0x64, 0x43, 0x24, 0x1A, 0x1A, 0x0A, 0x28, 0xA8, 0xA8, 0x68, 0xD2,
+    0xEC, 0x1B, 0x64, 0x8C, 0x28, 0x68, 0x29, 0x78, 0x00, 0x8A, 0x14, 0x09, 0x29, 0x36, 0x2F, 0xB0,
+    0xB1, 0x25, 0x0A, 0x5A, 0x83, 0x44, 0x45, 0x81, 0xA9, 0x29, 0x76, 0x90, 0x2C, 0xF8, 0x04, 0x63,
+    0x9F, 0x9C, 0x33, 0x5F, 0x16, 0x76, 0xC5, 0x52, 0x90, 0x06, 0x5C, 0x1C, 0xD9, 0xE3, 0x99, 0x7B,
+    0xCF, 0x3D, 0xF7, 0x67, 0xCC, 0x7E, 0x30, 0x3E, 0xAB, 0xA5, 0x20, 0x66, 0xD8, 0x11, 0xEE, 0x81,
+    0x98, 0xDE, 0x9D, 0xED, 0x88, 0xA7, 0x06, 0x77, 0x85, 0x1A, 0x7D, 0x8E, 0x90, 0x63, 0x4C, 0xBA,
+    0x61, 0x85, 0xC9, 0xEA, 0x76, 0x85, 0x10, 0x71, 0x89, 0x88, 0x86, 0x38, 0xA3, 0x27, 0x06, 0x8C,
+    0xC2, 0x7A, 0x12, 0x96, 0x41, 0x98, 0x43, 0x98, 0xC2, 0x11, 0x13, 0x80, 0x68, 0x5D, 0xC4, 0x3A,
+    0x62, 0x81, 0x36, 0x5B, 0x9A, 0x1C, 0x6D, 0x8D, 0x31, 0x15, 0x0E, 0x86, 0x56, 0xBE, 0xAF, 0xFF,
+    0xC7, 0x21, 0xE9, 0x85, 0x4B, 0xA4, 0xE3, 0x09, 0x39, 0x1A, 0xE2, 0xB6, 0x5E, 0xED, 0xCC, 0x47,
+    0xA6, 0xBF, 0xDE, 0x57, 0x40, 0x3C, 0x99, 0x03, 0x33, 0x8D, 0xFE, 0x85, 0x21, 0x9F, 0xAD, 0x0E,
+    0xD9, 0x6C, 0x29, 0xEE, 0x32, 0x44, 0xE7, 0x79, 0xAE, 0x08, 0x6E, 0xB0, 0x15, 0x74, 0xB8, 0x7B,
+    0x11, 0xCC, 0xAA, 0x77, 0xFC, 0x93, 0x91, 0xBA, 0x16, 0x27, 0x2E, 0x3E, 0x59, 0xE4, 0x85, 0xDF,
+    0xC5, 0x54, 0xAF, 0xB9, 0x3D, 0x43, 0x9B, 0x8B, 0x6F, 0x37, 0x6F, 0x0C, 0x5B, 0x85, 0x35, 0xBD,
+    0xDD, 0x68, 0x3E, 0x69, 0x74, 0x21, 0x32, 0x13, 0x65, 0x37, 0x12, 0xBA, 0x69, 0xFF, 0xED, 0xA4,
+    0x7D, 0x53, 0x76, 0x75, 0x04, 0xB1, 0xA9, 0xA4, 0x58, 0x75, 0x8F, 0x66, 0xAB, 0xF6, 0x37, 0x66,
+    0xBF, 0xDD, 0xDA, 0xE7, 0x95, 0x3C, 0xE2, 0x9F, 0x92, 0x69, 0xE4, 0x1E, 0x25, 0x76, 0xD9, 0x41,
+    0x53, 0x4D, 0x06, 0x5F, 0x4E, 0x56, 0x2C, 0x45, 0xB0, 0x04, 0x8F, 0x69, 0xB6, 0x7E, 0x43, 0x0B,
+    0xF9, 0xDC, 0xF5, 0xFB, 0xEC, 0x5E, 0x92, 0x5D, 0x29, 0x76, 0x5C, 0x14, 0xE5, 0x92, 0x6E, 0xF1,
+    0x98, 0xDF, 0xF5, 0x80, 0x91, 0x14, 0xCB, 0xC5, 0x2A, 0xCF, 0xF2, 0xA0, 0xCD, 0x68, 0x98, 0x1C,
+    0xA9, 0x48, 0x72, 0x23, 0x3A, 0x6D, 0x62, 0x05, 0x9E, 0xE6, 0x37, 0xF6, 0x98, 0xDB, 0x7F, 0x40,
+    0x8B, 0xA7, 0x8B, 0xE9, 0x50, 0xE1, 0x7D, 0x0B, 0x62, 0xA7, 0x9A, 0x3F, 0x8C, 0xCA, 0x76, 0xAD,
+    0xA5, 0x73, 0xCD, 0x55, 0x64, 0xFC, 0xBF, 0xB5, 0xE9, 0x18, 0x3D, 0xC7, 0xFF, 0x54, 0x66, 0xA5,
+    0x70, 0x07, 0x55, 0xE9, 0x7B, 0xCA, 0xDE, 0x0D, 0x29, 0x7A, 0x66, 0xAD, 0x5E, 0xB3, 0x36, 0x33,
+    0x28, 0x0A, 0x3C, 0x51, 0x22, 0xDE, 0x6E, 0x38, 0x88, 0x98, 0x23, 0x31, 0x27, 0x62, 0x5C, 0x24,
+    0xDB, 0xC0, 0xE2, 0x48, 0xC1, 0x10, 0x0C, 0xBF, 0xB0, 0x22, 0x78, 0x7C, 0x6D, 0x1D, 0x1B, 0xEC,
+    0x03, 0x6D, 0x46, 0xC3, 0x2B, 0x15, 0x8A, 0x6D, 0xB1, 0xFE, 0x4F, 0xD8, 0x4F, 0x65, 0x5B, 0x5D,
+    0x5D, 0x57, 0x63, 0xB7, 0x33, 0xE6, 0xD4, 0xA9, 0xF3, 0xC6, 0x88, 0x4A, 0x34, 0x25, 0xA6, 0xD2,
+    0xE3, 0xAA, 0x2F, 0xC6, 0xBF, 0x6D, 0xDC, 0xD0, 0x3B, 0xFF, 0x3B, 0x95, 0xA5, 0x64, 0x79, 0x4F,
+    0x03, 0x2C, 0x06, 0x69, 0xC6, 0x76, 0x6D, 0x0A, 0x58, 0x14, 0x8D, 0x9E, 0xAC, 0x0B, 0xA9, 0x4A,
+    0x45, 0x2A, 0xEE, 0x62, 0xA0, 0xD7, 0x67, 0xB8, 0x0C, 0xDB, 0xCD, 0xE7, 0x22, 0xE4, 0x43, 0x39,
+    0xD5, 0x7E, 0x97, 0x11, 0x75, 0x2F, 0x78, 0x6C, 0xA5, 0x3A, 0x65, 0xD7, 0x32, 0xB4, 0x81, 0x67,
+    0x53, 0x1A, 0xA1, 0x74, 0x13, 0x19, 0xEE, 0xA1, 0xC9, 0xF7, 0xA4, 0xDD, 0xC5, 0x1F, 0x95, 0x1F,
+    0x4B, 0x6E, 0x7F, 0x4A, 0x5B, 0x1A, 0x2B, 0xAF, 0x8A, 0xFD, 0x4B, 0xFD, 0x95, 0xE2, 0xF1, 0xE3,
+    0xBB, 0x1D, 0x3F, 0x9C, 0x62, 0xC6, 0xEA, 0xF0, 0x0E, 0x74, 0x85, 0x2B, 0x18, 0x12, 0xC7, 0xF6,
+    0xA7, 0x26, 0xF4, 0x6A, 0x69, 0x50, 0xAB, 0x17, 0x5E, 0x94, 0xEB, 0xFE, 0x6B, 0x96, 0x1D, 0x83,
+    0x6F, 0x56, 0x0B, 0x53, 0xA1, 0x72, 0x29, 0x28, 0x44, 0x2F, 0x0C, 0x1A, 0x1B, 0x71, 0xAC, 0xDC,
+    0x3C, 0xD0, 0xB9, 0xF6, 0xB3, 0x20, 0x8F, 0x93, 0x04, 0x9A, 0x32, 0x65, 0x9C, 0x32, 0xB8, 0x2F,
+    0x76, 0xCD, 0x77, 0x43, 0x36, 0x8F, 0x12, 0xC6, 0x91, 0x92, 0x45, 0x39, 0x5D, 0x41, 0xCC, 0x7C,
+    0x41, 0xCA, 0xA7, 0x58, 0x23, 0x07, 0x1F, 0xC7, 0xBA, 0xC0, 0x4C, 0x43, 0x1D, 0x9E, 0x72, 0x12,
+    0xDD, 0x5A, 0x7F, 0x3D, 0xAB, 0xCF, 0x96, 0x4B, 0xAF, 0xFC, 0x75, 0x6D, 0x12, 0x87, 0x56, 0x4A,
+    0x9A, 0x3E, 0xA2, 0xA9, 0x52, 0xC5, 0xE7, 0xEC, 0x35, 0x75, 0xF4, 0xC3, 0xF3, 0x4A, 0xFD, 0x2B,
+    0xDD, 0x26, 0xB8, 0xC7, 0x18, 0x92, 0x59, 0x34, 0xAD, 0x39, 0x76, 0x88, 0x20, 0xD9, 0x71, 0x10,
+    0x3A, 0xF8, 0x0A, 0xD3, 0xF6, 0x6C, 0xE7, 0x96, 0xFF, 0x2B, 0xDE, 0x81, 0xE5, 0x2C, 0xA8, 0x32,
+    0xAB, 0xD1, 0xDC, 0x44, 0x41, 0x0D, 0x51, 0xC2, 0xA8, 0x26, 0xCB, 0x55, 0x03, 0x71, 0xEB, 0xC1,
+    0x97, 0xC7, 0xB5, 0x3F, 0x62, 0x5C, 0x47, 0x9E, 0xA1, 0xC2, 0x6B, 0x76, 0x13, 0x26, 0xC7, 0x5E,
+    0x52, 0xBA, 0xE9, 0xD7, 0x8D, 0x99, 0x57, 0x5B, 0x68, 0xAA, 0xDC, 0x51, 0x47, 0x7B, 0xF6, 0x7A,
+    0xBA, 0xB8, 0xA8, 0x3C, 0xA1, 0x88, 0x69, 0x8B, 0xB5, 0x14, 0xEF, 0x2A, 0x75, 0xB9, 0x7A, 0xE7,
+    0xD0, 0x62, 0xB5, 0x34, 0xDA, 0xAE, 0xE3, 0xB1, 0x81, 0xE2, 0x3D, 0xAB, 0x8B, 0x50, 0x73, 0xC3,
+    0x6B, 0xE2, 0x5F, 0x53, 0xBD, 0xAD, 0xB9, 0x07, 0x6C, 0xCA, 0xED, 0x90, 0xF1, 0xDE, 0xBC, 0x03,
+    0x92, 0x70, 0x7D, 0x11, 0x4A, 0x9F, 0x2E, 0x0C, 0x18, 0x97, 0xC0, 0xA9, 0xE1, 0x9E, 0x73, 0x07,
+    0x77, 0x65, 0x58, 0x9A, 0x04, 0x9B, 0x46, 0x5B, 0x29, 0x70, 0xE5, 0xE8, 0x88, 0xE7, 0x5F, 0xAD,
+    0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x7D, 0xB6, 0xF3, 0x9D, 0x23, 0xB9, 0x70, 0x73, 0x89, 0x10,
+    0x48, 0x98, 0x1E, 0x74, 0xFE, 0x07, 0xAC, 0x51, 0xCA, 0x14, 0x5C, 0x71, 0xA7, 0x14, 0x29, 0xA8,
+    0x68, 0x90, 0x90, 0x28, 0x68, 0x90, 0x10, 0xBB, 0x28, 0x45, 0xDA, 0x4F, 0x88, 0xD4, 0x34, 0xE9,
+    0xD3, 0xA6, 0xCA, 0x2E, 0xB9, 0x22, 0x25, 0x46, 0xFC, 0x81, 0x8D, 0x04, 0x02, 0xE9, 0x8A, 0x58,
+    0xCA, 0x22, 0x39, 0xDC, 0xDA, 0xC3, 0x5B, 0x1B, 0x8E, 0x04, 0x90, 0x10, 0x92, 0x57, 0x5A, 0xEF,
+    0x6A, 0xED, 0x79, 0x33, 0xFB, 0xE6, 0xCD, 0x18, 0xF8, 0x68, 0x0F, 0xB4, 0x12, 0x50, 0x88, 0x0C,
+    0x68, 0x83, 0xF6, 0x99, 0x40, 0xBB, 0x3A, 0x60, 0x86, 0x72, 0xC5, 0x08, 0xE1, 0x52, 0xC6, 0x72,
+    0x44, 0x33, 0xA8, 0x0E, 0xFA, 0x71, 0x44, 0x26, 0xF5, 0x80, 0x32, 0xAA, 0xC0, 0x23, 0x3B, 0xF2,
+    0x63, 0x19, 0x69, 0x63, 0xC7, 0x32, 0xC2, 0x0E, 0xCD, 0x00, 0xDD, 0xEB, 0xC7, 0x9D, 0xBC, 0x27,
+    0x47, 0x45, 0xAC, 0xE2, 0xDC, 0x3E, 0x95, 0xE7, 0x22, 0x95, 0x9C, 0x89, 0x07, 0xB2, 0x13, 0xA4,
+    0x91, 0xF5, 0x40, 0x31, 0x70, 0x46, 0xEE, 0x67, 0x1E, 0xE8, 0x0E, 0xA8, 0x38, 0x33, 0xAC, 0xE3,
+    0xFA, 0x31, 0x72, 0x99, 0xD0, 0x08, 0xBD, 0xFF, 0x24, 0x46, 0x19, 0xEB, 0xDA, 0x4E, 0x3B, 0x7E,
+    0xE8, 0xF0, 0xBA, 0xB8, 0x52, 0xC4, 0xB5, 0x9C, 0xF4, 0xE4, 0xAC, 0x61, 0x00, 0x7C, 0x6F, 0xCF,
+    0xE5, 0x17, 0x2D, 0x32, 0x35, 0x73, 0x13, 0xB2, 0xE3, 0xAC, 0x5B, 0x1D, 0xF9, 0xD5, 0x51, 0xC5,
+    0x59, 0x73, 0xDF, 0x1A, 0xE0, 0x4D, 0x9E, 0x5F, 0xD9, 0xD0, 0xCF, 0x8E, 0x38, 0x2A, 0x99, 0xD0,
+    0xC7, 0x3C, 0xD2, 0xDD, 0x84, 0xB2, 0x7F, 0x17, 0x79, 0x77, 0xB8, 0x99, 0x8F, 0xEC, 0xFE, 0x6B,
+    0x28, 0xA7, 0x23, 0xD4, 0x32, 0xA3, 0xBE, 0x19, 0x91, 0xE7, 0x3F, 0xE2, 0x72, 0x6C, 0xC4, 0x55,
+    0xE5, 0x1F, 0x31, 0x9F, 0xB2, 0xCC, 0xCA, 0x7C, 0xB6, 0x39, 0x3E, 0x65, 0x01, 0x5C, 0x0C, 0x28,
+    0x3C, 0x39, 0xEA, 0x1F, 0x2E, 0x6B, 0x46, 0xC9, 0x41, 0x9B, 0xED, 0xFC, 0x5C, 0xEF, 0x76, 0x7B,
+    0xAA, 0xF9, 0xAE, 0xF8, 0x5A, 0x38, 0xCE, 0xE6, 0x0F, 0xE4, 0xD6, 0xB4, 0x20, 0x3D, 0x0F, 0x55,
+    0x52, 0x29, 0xF4, 0xBD, 0x07, 0x43, 0xF6, 0x80, 0xEF, 0x88, 0x27, 0xBF, 0x7D, 0x25, 0xE7, 0x63,
+    0x8A, 0x8C, 0x31, 0x54, 0x63, 0x52, 0x23, 0xFD, 0x06, 0xDC, 0x16, 0x2B, 0x32, 0x6B, 0xB9, 0x10,
+    0xF9, 0x5E, 0xC6, 0x5A, 0x02, 0x65, 0xBB, 0x3B, 0x06, 0x88, 0x5D, 0x8B, 0xA7, 0xE1, 0x97, 0xF2,
+    0x4D, 0x54, 0xBD, 0x7A, 0x12, 0x8B, 0x60, 0xCD, 0x61, 0x3D, 0x26, 0x3B, 0x2C, 0x8B, 0x43, 0x45,
+    0x3D, 0xEB, 0x11, 0x77, 0x44, 0x62, 0xBD, 0x84, 0xEC, 0x71, 0x8D, 0xB6, 0xF7, 0x29, 0x92, 0x01,
+    0x99, 0x5D, 0xF5, 0xF8, 0x68, 0x91, 0x62, 0xB6, 0x5F, 0x2E, 0x5E, 0x01, 0x39, 0x6D, 0x5B, 0xF2,
+    0xC3, 0x00, 0x73, 0x46, 0x51, 0xBA, 0x4B, 0xF6, 0x3F, 0x24, 0x49, 0x33, 0xAC, 0x8C, 0xCD, 0xAF,
+    0xF6, 0x2C, 0x16, 0xB3, 0x36, 0xED, 0xF9, 0x98, 0xCF, 0x0C, 0xFE, 0x19, 0x63, 0x94, 0x7B, 0xA7,
+    0xEF, 0x07, 0xC0, 0x3A, 0x94, 0x33, 0xAE, 0xA8, 0x14, 0xAF, 0xC4, 0x5C, 0xA4, 0xC3, 0xE9, 0x6A,
+    0x5E, 0xAF, 0xD8, 0xCA, 0x2C, 0x25, 0x10, 0x97, 0x83, 0x0D, 0xA0, 0x49, 0x75, 0xAA, 0x5B, 0x72,
+    0x55, 0x3D, 0x73, 0xD9, 0xF8, 0x05, 0x54, 0x3E, 0x64, 0xE6, 0xEA, 0x02, 0x7B, 0x70, 0xCC, 0x1C,
+    0xFA, 0x2A, 0xB1, 0x74, 0x3B, 0x2A, 0xA7, 0x7E, 0x26, 0xA6, 0x35, 0xED, 0x82, 0x49, 0xE8, 0x17,
+    0xA7, 0x27, 0xC4, 0xA8, 0x18, 0x8A, 0xF6, 0xB8, 0x91, 0x92, 0xB7, 0xB0, 0x14, 0x16, 0x86, 0x93,
+    0x4C, 0xCA, 0xA1, 0x0E, 0x62, 0xE4, 0x66, 0xC8, 0xFB, 0xA3, 0x6D, 0x68, 0xF0, 0x24, 0x3B, 0x9F,
+    0xC0, 0xAE, 0xD5, 0x3A, 0x7C, 0xBE, 0x02, 0x66, 0x5D, 0x3B, 0x97, 0xE2, 0xDF, 0x60, 0x97, 0xF3,
+    0xC5, 0xBF, 0x3C, 0x4A, 0xB9, 0x21, 0xB3, 0x4A, 0x3D, 0x0B, 0xA0, 0x9D, 0x61, 0x27, 0xB4, 0xA8,
+    0x1D, 0xF7, 0xFF, 0xCF, 0xFC, 0x10, 0x65, 0x20, 0x4F, 0xF9, 0xC5, 0xD0, 0xDC, 0xF5, 0xB1, 0xFA,
+    0x76, 0x25, 0xE9, 0x30, 0xB5, 0x4B, 0xF1, 0x07, 0x62, 0xF8, 0x35, 0x85, 0xA3, 0x3C, 0xFE, 0xBE,
+    0x6D, 0xA6, 0x42, 0xE6, 0x5A, 0x98, 0xBC, 0x2C, 0x36, 0xDF, 0x05, 0xD1, 0x3F, 0x4C, 0x1F, 0xE7,
+    0x7E, 0xF5, 0xBE, 0x43, 0x3B, 0x67, 0xEC, 0xBA, 0xF6, 0x9F, 0x66, 0x7F, 0x6E, 0x4B, 0xE9, 0x44,
+    0xEE, 0xC8, 0xBC, 0x1A, 0xBC, 0xC3, 0xB4, 0x5B, 0x8A, 0xCE, 0x92, 0xA5, 0x36, 0xE9, 0x94, 0xE7,
+    0x9E, 0xF4, 0xA4, 0xC6, 0xB5, 0x6B, 0xD8, 0xF2, 0x65, 0x60, 0xC2, 0x42, 0xF3, 0xC2, 0x46, 0xE5,
+    0x9B, 0xA8, 0x5D, 0x15, 0xAD, 0x2B, 0x27, 0x59, 0x66, 0xF1, 0xC7, 0x5A, 0x46, 0xDB, 0x57, 0x51,
+    0x33, 0x3D, 0x6A, 0xB6, 0xA9, 0xC0, 0x4C, 0xAA, 0x57, 0x5C, 0x23, 0xCC, 0x41, 0xFF, 0x16, 0xD0,
+    0x8C, 0x0F, 0xD3, 0xAF, 0x84, 0x99, 0x3D, 0x6A, 0xE9, 0xE7, 0xEA, 0xC1, 0x1E, 0x2F, 0x8D, 0x93,
+    0x54, 0x99, 0x51, 0x4F, 0xD0, 0xCC, 0x5A, 0xF7, 0x36, 0x33, 0x67, 0x0A, 0xC6, 0xE8, 0x18, 0xB3,
+    0x4D, 0x0F, 0xFD, 0xDF, 0x0F, 0xDB, 0xB7, 0xFC, 0x8D, 0x44, 0x95, 0x1E, 0x0B, 0xE6, 0x27, 0x58,
+    0x34, 0x9D, 0xCA, 0x06, 0x96, 0x6D, 0xA4, 0x49, 0xFF, 0x95, 0xFE, 0x2F, 0x9F, 0xBB, 0xAF, 0x29,
+    0x9B, 0xC4, 0x85, 0x78, 0x5E, 0x2D, 0x28, 0x5F, 0xBF, 0x7A, 0x35, 0xF3, 0xD2, 0xD5, 0xDC, 0xE5,
+    0xD5, 0x86, 0x54, 0xB7, 0x97, 0x57, 0x5B, 0xC6, 0xA7, 0xAB, 0xA3, 0x54, 0x9B, 0x45, 0x48, 0xBD,
+    0x92, 0xD3, 0x6C, 0xEB, 0x27, 0x23, 0x1E, 0x15, 0x4A, 0x8E, 0x98, 0x15, 0xA6, 0x27, 0x2A, 0xE4,
+    0xA1, 0x36, 0xD8, 0xEF, 0x36, 0xBE, 0xCB, 0x2B, 0xE3, 0x77, 0xBD, 0x55, 0xBF, 0x8F, 0xDE, 0x44,
+    0x10, 0x1D, 0x7B, 0x73, 0x67, 0x89, 0x95, 0xB2, 0x0D, 0x87, 0x10, 0x05, 0xFE, 0x0F, 0xE2, 0x96,
+    0x26, 0x5A, 0x4B, 0x94, 0x29, 0x72, 0xCD, 0xA7, 0x94, 0x69, 0x92, 0x02, 0x1A, 0x5A, 0x90, 0x50,
+    0xD6, 0x4A, 0x0A, 0xDA, 0x2B, 0x42, 0x9D, 0x3A, 0x34, 0xB4, 0x34, 0xC4, 0x16, 0xFC, 0x03, 0x46,
+    0x51, 0x94, 0x32, 0x16, 0xBA, 0x48, 0x91, 0x28, 0xB0, 0xC0, 0x02, 0x7F, 0x68, 0xED, 0xC9, 0x7B,
+    0x7B, 0xDF, 0x25, 0xB9, 0xAB, 0x50, 0x7E, 0xAD, 0xB4, 0xFB, 0xED, 0xAD, 0x67, 0x67, 0xDE, 0x7B,
+    0x3B, 0x33, 0x27, 0x5F, 0xEC, 0x49, 0xAE, 0x57, 0x6B, 0xA3, 0x5A, 0x9B, 0x87, 0x2A, 0xD2, 0xFC,
+    0x24, 0x2F, 0xC6, 0xDE, 0x5D, 0xC9, 0x54, 0x9B, 0x42, 0x75, 0x28, 0xB7, 0xED, 0xE4, 0x07, 0x17,
+    0x43, 0x67, 0x63, 0xDB, 0x15, 0x8B, 0x72, 0x36, 0xE6, 0xE4, 0xB7, 0x2B, 0x70, 0x66, 0x63, 0x18,
+    0xDD, 0xE4, 0xD7, 0x76, 0x74, 0xAA, 0x5D, 0xAE, 0x8B, 0xC8, 0x41, 0x9D, 0xDC, 0x98, 0xA9, 0x6A,
+    0x0A, 0xDC, 0xE4, 0xCC, 0x87, 0x4B, 0x6F, 0xD7, 0x7F, 0x26, 0x92, 0x47, 0x11, 0xDF, 0x89, 0xC1,
+    0xCF, 0x07, 0xC9, 0x6F, 0x50, 0x7D, 0xAC, 0xBA, 0x1C, 0x6C, 0x36, 0x09, 0x40, 0xD9, 0xA4, 0x6F,
+    0x30, 0xC9, 0x26, 0x5C, 0xB8, 0x89, 0x13, 0xDD, 0xF6, 0xA5, 0xEA, 0x54, 0x4E, 0x61, 0x76, 0x93,
+    0xD1, 0x22, 0xE6, 0xFA, 0xCB, 0x9A, 0xEB, 0xA4, 0xB7, 0xFF, 0x5D, 0xFC, 0xEF, 0x93, 0x5E, 0xFD,
+    0x6F, 0xF2, 0x0F, 0x75, 0x72, 0x63, 0x3B, 0x15, 0xB1, 0x8C, 0x66, 0x31, 0xF0, 0x98, 0xAB, 0xAA,
+    0xFC, 0xC3, 0xC0, 0x7B, 0x87, 0xA7, 0x14, 0x2C, 0x97, 0xAA, 0xE1, 0xD2, 0x63, 0x71, 0xA3, 0x9C,
+    0xE0, 0x11, 0xF9, 0x56, 0xCE, 0x8F, 0x2A, 0x5A, 0xAD, 0xDB, 0x58, 0x6A, 0xFD, 0x55, 0xDC, 0xD7,
+    0xBA, 0x88, 0xF2, 0xFF, 0x16, 0x00, 0xE3, 0xFB, 0xE8, 0x11, 0x01, 0x44, 0x69, 0x63, 0x98, 0x65,
+    0xAF, 0xFE, 0xF0, 0xD4, 0xAD, 0xDB, 0x71, 0x04, 0x43, 0x2E, 0x2D, 0xFF, 0x4C, 0x08, 0xC6, 0xF7,
+    0x80, 0x80, 0x33, 0x5B, 0xF9, 0xC8, 0x0A, 0xAD, 0xED, 0x9F, 0x1D, 0xA0, 0x7C, 0x87, 0xC0, 0x3E,
+    0xC7, 0xF2, 0xB1, 0x1C, 0xBD, 0x73, 0xFA, 0xC1, 0x20, 0x90, 0x5E, 0x99, 0x77, 0xCB, 0xA5, 0x7C,
+    0x78, 0x4F, 0xB2, 0x7F, 0x9D, 0x32, 0x9B, 0xD2, 0xF3, 0xE1, 0x29, 0x81, 0x65, 0xE8, 0x4F, 0xCF,
+    0x87, 0x2F, 0x74, 0x29, 0xF5, 0x9E, 0x8E, 0x7E, 0x71, 0x2B, 0x72, 0xB0, 0x9C, 0x61, 0xEB, 0xC7,
+    0x62, 0x94, 0xD0, 0x23, 0x23, 0xB5, 0x59, 0x50, 0x03, 0x76, 0x44, 0x86, 0xFA, 0x5A, 0xEC, 0x16,
+    0x0F, 0xE7, 0x14, 0x7E, 0x2A, 0x25, 0x37, 0x10, 0x12, 0xED, 0x76, 0x0A, 0x17, 0x0C, 0x86, 0x2B,
+    0x02, 0x78, 0xF2, 0xA5, 0xF6, 0xA8, 0xDB, 0x95, 0xEE, 0x11, 0xDE, 0x1E, 0xCB, 0xC9, 0x5B, 0xE4,
+    0xB4, 0x06, 0x58, 0xD9, 0xD7, 0x9D, 0xA1, 0x84, 0x97, 0x9B, 0x1B, 0x82, 0x62, 0x8A, 0x2C, 0x8F,
+    0x11, 0x35, 0xA7, 0x75, 0x18, 0xAA, 0x99, 0x5C, 0x3B, 0x56, 0x1D, 0x36, 0xED, 0x99, 0x4D, 0xFA,
+    0x54, 0x87, 0xAE, 0x82, 0xF1, 0x8F, 0x0B, 0x6F, 0xB1, 0x52, 0x7B, 0x09, 0x8F, 0xEA, 0xB3, 0x9E,
+    0x33, 0x9D, 0x59, 0x73, 0x83, 0xE4, 0x3F, 0xDC, 0xDF, 0x91, 0xCE, 0x67, 0xD4, 0x84, 0x1B, 0x41,
+    0xC2, 0xFF, 0x0A, 0x8B, 0x6F, 0x8A, 0xA3, 0x73, 0xAA, 0x04, 0xFD, 0x4D, 0xB7, 0xAA, 0x46, 0x7B,
+    0x1D, 0x4C, 0xCC, 0xB4, 0x71, 0x83, 0x51, 0x09, 0x00, 0x88, 0x52, 0x75, 0xB3, 0xEB, 0xA5, 0x1C,
+    0x5B, 0xDE, 0x06, 0xE9, 0xF6, 0x1E, 0x49, 0xAD, 0x64, 0x37, 0x92, 0x30, 0xB2, 0xDC, 0x31, 0x7E,
+    0x49, 0xBD, 0x03, 0xD2, 0xCE, 0xEC, 0xD0, 0xEC, 0x03, 0x26, 0x94, 0xC3, 0x71, 0xC0, 0x46, 0x1E,
+    0xA4, 0xEA, 0xB7, 0x2C, 0x58, 0xF1, 0x4A, 0xF5, 0x94, 0xAA, 0x9C, 0x19, 0xFB, 0xB4, 0xC9, 0x34,
+    0xD5, 0x51, 0x2A, 0x9A, 0xA4, 0xB9, 0x61, 0x20, 0x3C, 0x04, 0x5F, 0xF6, 0x67, 0xC6, 0x33, 0x7F,
+    0xD1, 0xA4, 0xBC, 0x43, 0x57, 0x0B, 0x0D, 0x8B, 0xB1, 0x62, 0x96, 0x37, 0x1E, 0x26, 0xEB, 0x06,
+    0x6E, 0x2D, 0x9B, 0x03, 0xC2, 0x00, 0x67, 0xB6, 0x6C, 0xAE, 0x47, 0xB6, 0x82, 0x6A, 0x22, 0x3C,
+    0x3F, 0x14, 0x6B, 0x9D, 0xE9, 0x71, 0x0B, 0x31, 0xF5, 0x6F, 0x5D, 0xD0, 0xF2, 0x3A, 0x0B, 0x33,
+    0xB4, 0x31, 0xCC, 0xE5, 0x25, 0x96, 0x8F, 0x0E, 0x85, 0x6D, 0x0D, 0x8D, 0x49, 0xFC, 0x53, 0x6D,
+    0x7C, 0xD3, 0x76, 0x55, 0x4D, 0x91, 0x31, 0x3F, 0x41, 0x13, 0xC4, 0xBD, 0x0A, 0x33, 0xF4, 0xA1,
+    0x6B, 0x9B, 0xD0, 0x29, 0xBE, 0xB7, 0x7F, 0xE8, 0x33, 0x3C, 0xCC, 0x52, 0xAE, 0xE5, 0x94, 0x1D,
+    0x66, 0x35, 0xDB, 0x21, 0xC6, 0x65, 0xF9, 0x8C, 0x39, 0x79, 0x6D, 0xA0, 0x66, 0x44, 0x9E, 0x94,
+    0x13, 0xB9, 0xF1, 0x0A, 0xF3, 0xB4, 0x2F, 0xD3, 0x71, 0x52, 0x25, 0xE9, 0x0A, 0x02, 0xE9, 0x80,
+    0xA8, 0xEC, 0x13, 0x4A, 0xE1, 0xC9, 0x33, 0x9B, 0xC9, 0xD3, 0xF5, 0x34, 0x0C, 0x39, 0x4C, 0xCC,
+    0x6C, 0x60, 0xE2, 0x9E, 0x82, 0xA7, 0xB4, 0x48, 0x27, 0x61, 0xA1, 0x0C, 0x52, 0x3E, 0xA2, 0x14,
+    0x8A, 0x70, 0x35, 0xB2, 0xD5, 0xAC, 0x12, 0x8E, 0xA5, 0x5C, 0xAF, 0xE8, 0x04, 0xEC, 0x5E, 0xD1,
+    0x72, 0x23, 0xF1, 0xD9, 0xE6, 0xA2, 0xB8, 0xE3, 0x5B, 0x90, 0x2C, 0xC2, 0x12, 0x18, 0x0F, 0xDE,
+    0xA2, 0x00, 0x92, 0xA5, 0x54, 0xE3, 0x2D, 0x80, 0x4A, 0x1C, 0xD7, 0x44, 0x29, 0xA6, 0x03, 0x66,
+    0x41, 0x15, 0x98, 0x38, 0xF8, 0x97, 0x02, 0xD2, 0x03, 0xDB, 0x96, 0xFF, 0x1C, 0x86, 0x59, 0xB4,
+    0x2C, 0xBE, 0xC1, 0xC1, 0xC4, 0x7F, 0x1F, 0x46, 0x2A, 0x07, 0x32, 0x78, 0x25, 0x08, 0x13, 0x36,
+    0xD7, 0x94, 0x69, 0x66, 0x17, 0x96, 0xBB, 0x9B, 0x33, 0x3D, 0x92, 0xB0, 0xAD, 0x12, 0x25, 0x16,
+    0x52, 0x92, 0xB7, 0x48, 0x62, 0x3E, 0x90, 0xD3, 0xC6, 0x00, 0x67, 0x5C, 0x7D, 0x7A, 0xE2, 0x90,
+    0x3E, 0x5E, 0x78, 0x13, 0x92, 0xF1, 0x84, 0xA4, 0x83, 0x6D, 0x45, 0xD4, 0xBB, 0x8E, 0x4F, 0xFF,
+    0x36, 0xCA, 0xEB, 0x8D, 0xE7, 0xBD, 0x55, 0x2D, 0x70, 0xD4, 0x40, 0x14, 0x7E, 0x9B, 0xB4, 0x77,
+    0xA5, 0x99, 0x21, 0x15, 0xAD, 0xEA, 0x30, 0xB1, 0x75, 0xB1, 0x08, 0x86, 0x6C, 0x15, 0xA2, 0x82,
+    0x8A, 0x3B, 0x01, 0x06, 0x85, 0xA1, 0xA2, 0x48, 0x04, 0x34, 0x61, 0x98, 0x41, 0xD7, 0x54, 0x83,
+    0x2E, 0xA2, 0x08, 0x04, 0xA2, 0x9D, 0xCD, 0x70, 0x02, 0x9B, 0x0E, 0x02, 0x49, 0x0C, 0x08, 0x10,
+    0x0D, 0x33, 0x61, 0xC8, 0x0D, 0x49, 0x1E, 0xDF, 0xDB, 0xCB, 0xDD, 0x15, 0xDD, 0x96, 0x9D, 0xC9,
+    0xE6, 0xE6, 0xE5, 0xFD, 0x7C, 0xDF, 0xF7, 0xDE, 0xEE, 0x11, 0xD9, 0xB5, 0x81, 0x27, 0xC6, 0x63,
+    0x32, 0x22, 0x2E, 0xF0, 0xDE, 0x27, 0xBA, 0x46, 0xDD, 0x7A, 0xB4, 0x4F, 0x7D, 0xE6, 0xD4, 0x67,
+    0x2E, 0x7D, 0x7E, 0xD3, 0x78, 0x0D, 0x45, 0x77, 0x1A, 0xF2, 0x3F, 0x31, 0x39, 0x05, 0x6B, 0x5A,
+    0x89, 0x53, 0xA2, 0x10, 0x41, 0x5E, 0x4D, 0xE4, 0x32, 0x02, 0x58, 0x0C, 0x25, 0x0C, 0x2D, 0x91,
+    0x62, 0xA4, 0x8C, 0x1A, 0x42, 0x8A, 0xF1, 0xFD, 0xC2, 0x30, 0xD7, 0x1E, 0x73, 0x43, 0x21, 0x1E,
+    0x5A, 0xDB, 0x9E, 0x14, 0xB8, 0x4E, 0xE4, 0x54, 0xF0, 0x4A, 0xC8, 0x2F, 0x48, 0x21, 0x8B, 0x4F,
+    0xB3, 0x75, 0x0F, 0xE9, 0x5A, 0x8A, 0xB9, 0x0A, 0xC6, 0x3C, 0x6A, 0xDC, 0x3A, 0x4E, 0xA3, 0xAD,
+    0x4A, 0x69, 0x86, 0x2F, 0x42, 0xE4, 0x05, 0x7F, 0x93, 0x23, 0x7D, 0xB2, 0x14, 0x01, 0x25, 0x0A,
+    0x38, 0x08, 0x50, 0xC3, 0x8E, 0x51, 0x04, 0x60, 0x11, 0x40, 0x45, 0x5B, 0x05, 0x45, 0xFA, 0x98,
+    0x7A, 0xBA, 0xE3, 0xA5, 0x0E, 0x35, 0x05, 0xCC, 0xF8, 0xC8, 0x59, 0xD4, 0x1E, 0x95, 0x00, 0xDC,
+    0x04, 0x25, 0x45, 0x77, 0x6B, 0xF2, 0x46, 0x00, 0xB7, 0x29, 0x4C, 0x4C, 0x47, 0xCD, 0x9F, 0x52,
+    0x13, 0x81, 0xC2, 0x4A, 0xD8, 0x68, 0x54, 0x07, 0xC7, 0x80, 0xBF, 0xEE, 0x7C, 0x60, 0xE6, 0x22,
+    0x84, 0x3C, 0x64, 0xC4, 0x34, 0xC4, 0x27, 0xA5, 0x49, 0x21, 0x49, 0x54, 0x92, 0x77, 0x96, 0xAA,
+    0x6A, 0x8F, 0x22, 0xA7, 0x50, 0xC9, 0x92, 0xAD, 0xBC, 0xB8, 0x4F, 0x3E, 0xE7, 0x90, 0xF4, 0x39,
+    0xBF, 0xAA, 0xA3, 0x2C, 0xFA, 0x58, 0xBB, 0xA5, 0x49, 0x56, 0xA7, 0x7C, 0x2A, 0x2B, 0xA0, 0x68,
+    0x17, 0x57, 0xF4, 0x02, 0x7C, 0x20, 0x7C, 0x1A, 0x72, 0x3E, 0x91, 0x6B, 0x41, 0x38, 0x01, 0x15,
+    0xA0, 0x52, 0xBF, 0x11, 0xB1, 0xE7, 0x5A, 0x5D, 0x31, 0xA7, 0x65, 0x4D, 0xAE, 0x70, 0xCA, 0xED,
+    0x6B, 0x5D, 0x5F, 0x46, 0x8F, 0x36, 0xE8, 0x09, 0xF9, 0x49, 0x4C, 0x08, 0x9A, 0xF4, 0xC9, 0x22,
+    0x0A, 0xF5, 0x7F, 0xE0, 0xE3, 0xE8, 0x1B, 0x74, 0xD2, 0xCF, 0xFB, 0x45, 0x8D, 0x69, 0xB4, 0xF8,
+    0x1C, 0x64, 0x58, 0xA4, 0x0B, 0xF7, 0xE8, 0xAD, 0x92, 0x99, 0x93, 0x39, 0xF6, 0x7E, 0xD6, 0xD2,
+    0x21, 0xD9, 0x7C, 0xE9, 0x15, 0x9D, 0xCC, 0x3A, 0x35, 0x1C, 0xE0, 0x03, 0x73, 0x25, 0xDC, 0x38,
+    0x57, 0xE6, 0x9B, 0x61, 0xF4, 0xD4, 0x41, 0xCD, 0x86, 0x82, 0x46, 0xB1, 0x76, 0x38, 0x89, 0x33,
+    0x8C, 0x2F, 0xF8, 0xFA, 0x35, 0x8C, 0x0E, 0x6F, 0x82, 0x8F, 0xC9, 0x60, 0x0C, 0xC5, 0xE8, 0x89,
+    0xD1, 0x65, 0x78, 0x92, 0xF5, 0x34, 0x29, 0x8C, 0x31, 0xC2, 0x95, 0xC9, 0x7B, 0x92, 0x13, 0x90,
+    0x38, 0x73, 0x19, 0x42, 0xCF, 0xD7, 0xF6, 0x2A, 0x88, 0x96, 0xB7, 0x91, 0x0C, 0x9B, 0x32, 0xE5,
+    0x33, 0x00, 0x2B, 0x9F, 0xCA, 0xF6, 0x5E, 0xB6, 0x77, 0xD4, 0x7B, 0x50, 0xAE, 0x28, 0x51, 0xC9,
+    0x93, 0x2D, 0x18, 0xEF, 0x42, 0xED, 0xDC, 0x47, 0xE2, 0x14, 0x9B, 0x91, 0x8D, 0x93, 0x7F, 0xB7,
+    0x74, 0xBA, 0x99, 0x02, 0xED, 0x01, 0x9B, 0x31, 0xE4, 0xFC, 0xC3, 0xA9, 0xC7, 0x23, 0x48, 0x34,
+    0xC0, 0x41, 0xA0, 0x35, 0xA8, 0xED, 0x0A, 0xA4, 0x09, 0x59, 0xDA, 0x1D, 0x1F, 0x71, 0x0A, 0xE0,
+    0x61, 0x2B, 0x63, 0x1C, 0x97, 0x13, 0xB6, 0x96, 0xA8, 0xA5, 0x23, 0x4C, 0xBC, 0x26, 0x66, 0xD6,
+    0xE6, 0x33, 0x60, 0x78, 0xD6, 0x6A, 0xF9, 0x75, 0x0E, 0xE2, 0x1B, 0x16, 0xF8, 0xD9, 0x97, 0x0C,
+    0x3D, 0x4E, 0x2C, 0x61, 0x29, 0x61, 0x11, 0xE4, 0xE7, 0x08, 0xA3, 0x09, 0x88, 0x70, 0xA4, 0xE7,
+    0xCB, 0x32, 0x0F, 0x00, 0x0A, 0xDD, 0x6B, 0xE1, 0x87, 0xB9, 0x81, 0x65, 0xE7, 0xCC, 0xC6, 0x68,
+    0xB9, 0xDE, 0x5C, 0xD1, 0x38, 0xCE, 0x7C, 0x94, 0xC4, 0x27, 0xE1, 0x87, 0x4E, 0x77, 0x3F, 0xAC,
+    0x05, 0x3C, 0x3D, 0x76, 0x58, 0x0B, 0x4D, 0x87, 0xD9, 0xD4, 0x96, 0xE5, 0xA2, 0x5E, 0x95, 0xA4,
+    0x29, 0x8E, 0x40, 0x81, 0xB1, 0xA9, 0xE9, 0xFC, 0x92, 0x36, 0xFC, 0xC6, 0xD3, 0xAC, 0x63, 0x43,
+    0x7A, 0x0F, 0x1D, 0x54, 0x25, 0x08, 0xDC, 0x94, 0xE3, 0x2B, 0x74, 0x28, 0xFE, 0x7E, 0x28, 0x63,
+    0x9E, 0x61, 0xDC, 0x40, 0xEA, 0x60, 0x40, 0x68, 0xE7, 0xF4, 0x80, 0xFB, 0x08, 0xE9, 0xE7, 0x71,
+    0xE6, 0x56, 0xBB, 0xC8, 0x81, 0x14, 0x0C, 0x5D, 0x38, 0x05, 0x57, 0xA9, 0x86, 0x88, 0x59, 0xA1,
+    0x87, 0x48, 0xD6, 0x62, 0xBA, 0xAB, 0xE0, 0x97, 0x19, 0xD5, 0x6E, 0x1B, 0x27, 0xE1, 0x8F, 0xCA,
+    0x69, 0xE1, 0x7D, 0x86, 0x21, 0xE0, 0x83, 0xE1, 0xDD, 0xD2, 0x1E, 0x16, 0x68, 0xB6, 0x00, 0xFC,
+    0xA7, 0xF6, 0x14, 0xA2, 0xFC, 0x70, 0x12, 0x7E, 0x8B, 0x1E, 0x53, 0x70, 0x7A, 0x8C, 0x46, 0x61,
+    0x60, 0x22, 0xB9, 0xB9, 0x07, 0x73, 0x12, 0xD3, 0xBA, 0xA7, 0xB8, 0xC0, 0x05, 0xFB, 0x89, 0x4C,
+    0x29, 0x90, 0xB9, 0xC9, 0x0C, 0x6A, 0x7B, 0xF8, 0x5A, 0xC9, 0xCD, 0x0E, 0x37, 0xCC, 0xCD, 0x50,
+    0xCF, 0xD9, 0x65, 0x24, 0x21, 0x7B, 0x30, 0x44, 0x2F, 0x91, 0xE3, 0x4B, 0x27, 0x48, 0x4D, 0xDA,
+    0x56, 0xED, 0x97, 0x21, 0x1A, 0x90, 0xD9, 0x93, 0xBA, 0x7D, 0x71, 0x2A, 0x72, 0xF9, 0x36, 0xDD,
+    0x9F, 0x90, 0x5C, 0xFE, 0x1E, 0x5C, 0x69, 0xE5, 0xAA, 0xA9, 0xF4, 0xE6, 0x77, 0x23, 0xA4, 0xF3,
+    0x92, 0xCB, 0xEA, 0xCA, 0x55, 0xAF, 0xBF, 0xC5, 0x55, 0xB1, 0x8A, 0xD5, 0x40, 0x14, 0x3D, 0x49,
+    0xDC, 0x8D, 0xF8, 0xC0, 0x58, 0x88, 0xA8, 0xAB, 0x4C, 0x6B, 0x97, 0x2F, 0x90, 0x64, 0xB1, 0xB0,
+    0xDD, 0x62, 0x9F, 0x20, 0x36, 0x16, 0x56, 0x36, 0x7E, 0x81, 0x3B, 0xB1, 0xD1, 0x52, 0x0B, 0xED,
+    0x2D, 0x14, 0xE4, 0x59, 0xAC, 0x1F, 0xA0, 0x26, 0xE8, 0x0F, 0x44, 0xFC, 0x00, 0xB3, 0xA0, 0x08,
+    0xDB, 0xEC, 0x20, 0x01, 0xE3, 0x9A, 0x37, 0xD7, 0x73, 0x93, 0xF7, 0x64, 0x2D, 0x04, 0x51, 0x58,
+    0x07, 0xE6, 0x30, 0x99, 0xCC, 0xBD, 0x73, 0xCF, 0x99, 0x3B, 0x77, 0x00, 0x20, 0x13, 0x91, 0x0F,
+    0xEC, 0xED, 0x2D, 0x91, 0x79, 0x3C, 0x47, 0xBA, 0x2E, 0x79, 0x5C, 0xDB, 0x1A, 0x8D, 0x69, 0x01,
+    0x4E, 0x20, 0x90, 0xD9, 0x33, 0x58, 0x91, 0xDC, 0x88, 0x54, 0xB1, 0x9F, 0x6E, 0x04, 0x92, 0x03,
+    0x5C, 0x01, 0xAE, 0xB8, 0xC8, 0x15, 0xE6, 0x8E, 0xE4, 0xC9, 0x4E, 0x29, 0xF2, 0x95, 0x7E, 0xE6,
+    0xEC, 0x42, 0xA3, 0x6E, 0xEC, 0x98, 0xEB, 0x1E, 0x15, 0x90, 0x48, 0x41, 0x4F, 0x1C, 0x04, 0xC0,
+    0xEA, 0x06, 0x8C, 0x34, 0x13, 0x91, 0x3B, 0x72, 0xAD, 0xCF, 0xAA, 0xEC, 0x73, 0x17, 0xFA, 0xB2,
+    0x48, 0xF7, 0x44, 0x3C, 0x8D, 0xF7, 0xBE, 0x4D, 0x37, 0xB9, 0xC3, 0xA4, 0xE7, 0x26, 0x0D, 0x2E,
+    0xD1, 0xA5, 0x6E, 0x9C, 0x8A, 0xC3, 0x0A, 0xA7, 0x4C, 0x8E, 0xC8, 0xD1, 0x65, 0x81, 0x48, 0xEA,
+    0x61, 0x11, 0x5D, 0xD6, 0x51, 0x8D, 0x3E, 0x6A, 0x61, 0xDE, 0xB7, 0x08, 0x85, 0x71, 0xA7, 0xCB,
+    0xED, 0x17, 0x4D, 0x83, 0x22, 0x05, 0x79, 0xC7, 0x28, 0x5B, 0x86, 0xFD, 0x4A, 0xC3, 0x26, 0xD3,
+    0xA8, 0x58, 0xF0, 0x40, 0xEC, 0x67, 0x8F, 0x03, 0xEE, 0xA5, 0x4C, 0x61, 0xBE, 0x4D, 0xF3, 0x91,
+    0xFA, 0xC8, 0x54, 0x4D, 0xB6, 0x38, 0x91, 0xDD, 0x5D, 0xA8, 0xA5, 0x4C, 0xFB, 0xA0, 0x38, 0x8F,
+    0xDB, 0x71, 0x13, 0xB9, 0x1E, 0x66, 0x2F, 0x47, 0xD9, 0x20, 0xEC, 0x07, 0x7E, 0xDA, 0xFE, 0x8E,
+    0x63, 0x8B, 0x95, 0x0D, 0x1A, 0xA7, 0x05, 0x86, 0x1F, 0x0C, 0x80, 0x24, 0x22, 0xE7, 0xA9, 0x5F,
+    0x9D, 0x01, 0xC7, 0x70, 0x74, 0xC9, 0xE8, 0xE6, 0x53, 0x80, 0xDE, 0x1B, 0x90, 0x91, 0x0B, 0x65,
+    0x7F, 0xDB, 0x4D, 0x3C, 0x26, 0xCE, 0x74, 0x88, 0x5D, 0xEA, 0x10, 0xD5, 0x59, 0xCD, 0x50, 0x2C,
+    0x05, 0x47, 0xF9, 0x13, 0xA4, 0x0A, 0x67, 0xCF, 0xA4, 0x8A, 0xA4, 0x2F, 0xEB, 0x90, 0xD0, 0x20,
+    0xE9, 0xAC, 0x23, 0x64, 0x3D, 0xC1, 0xF0, 0x18, 0x3B, 0xFA, 0x94, 0x2E, 0xD4, 0x84, 0x40, 0x2A,
+    0x4A, 0x7F, 0xCA, 0x0E, 0x0D, 0xCA, 0x72, 0x90, 0x50, 0x94, 0xF0, 0x3B, 0xF5, 0xDF, 0x32, 0x05,
+    0x92, 0xEA, 0x25, 0x70, 0x3D, 0x5C, 0x04, 0xB4, 0xF2, 0xF0, 0x54, 0x4E, 0xE3, 0x5E, 0x6D, 0x2B,
+    0xFB, 0x4E, 0x2E, 0x24, 0x6E, 0xD2, 0x42, 0x60, 0x8B, 0xC4, 0xC5, 0x1D, 0x24, 0x67, 0x5E, 0x49,
+    0xE9, 0xE8, 0xB5, 0xE7, 0x19, 0xD1, 0x8F, 0xA5, 0x51, 0xD2, 0x0C, 0x87, 0xB3, 0xAB, 0x96, 0x5E,
+    0xA5, 0x77, 0x66, 0xF7, 0xB9, 0x5C, 0x62, 0x34, 0xAD, 0xAD, 0x02, 0x89, 0xFD, 0x7A, 0xD9, 0x30,
+    0x43, 0x69, 0x4E, 0x8B, 0x60, 0xFB, 0x09, 0x16, 0xFA, 0x26, 0xF9, 0x71, 0xC2, 0xA7, 0xD7, 0xAA,
+    0x01, 0x35, 0x0C, 0x99, 0x1C, 0xC0, 0x19, 0xFC, 0x1F, 0x71, 0xD8, 0x0C, 0xCE, 0x21, 0x9C, 0x4F,
+    0x2A, 0xA6, 0x39, 0x73, 0xC9, 0x6A, 0xD2, 0x9F, 0x5C, 0x06, 0x73, 0x75, 0xFD, 0x86, 0xC6, 0xC1,
+    0xD3, 0x95, 0x3E, 0x9E, 0x9B, 0x2F, 0x85, 0xA0, 0xCC, 0x47, 0x4D, 0x54, 0x9C, 0x36, 0x69, 0x61,
+    0xBF, 0x0B, 0x39, 0xF0, 0x76, 0xA4, 0xCC, 0xE9, 0x58, 0xB9, 0x78, 0x25, 0x29, 0xFE, 0x89, 0x5A,
+    0x36, 0x31, 0x77, 0x0C, 0xFC, 0xAC, 0x6C, 0x79, 0x91, 0xE4, 0x32, 0xB3, 0xCD, 0xD9, 0x8F, 0x6B,
+    0x3E, 0xE2, 0x6C, 0x91, 0x08, 0x2D, 0xCE, 0xEE, 0x6B, 0x18, 0x47, 0x74, 0xB3, 0xAC, 0xF8, 0x85,
+    0x93, 0x2D, 0x96, 0x3F, 0x0E, 0x5F, 0x97, 0xF0, 0x81, 0x1A, 0x6B, 0xD2, 0x74, 0x8B, 0xC1, 0x6A,
+    0x8D, 0x03, 0xED, 0xB0, 0x74, 0x39, 0xDC, 0x64, 0x58, 0x55, 0xC8, 0xEA, 0x65, 0x6E, 0x0F, 0x60,
+    0xD4, 0x63, 0x96, 0x2F, 0x93, 0xE2, 0x85, 0x7E, 0xB1, 0xC7, 0xCD, 0xA2, 0x3E, 0x26, 0xD5, 0x72,
+    0xA0, 0x14, 0xB7, 0x0E, 0x5B, 0xA0, 0xC9, 0x70, 0x2C, 0xA5, 0xE2, 0x44, 0x14, 0xAD, 0x21, 0xC6,
+    0x8E, 0x57, 0x9C, 0x15, 0xE7, 0xF4, 0xC1, 0x33, 0xE3, 0x3D, 0x74, 0xFA, 0x62, 0x48, 0x21, 0xB2,
+    0x43, 0x51, 0x6C, 0xA7, 0x25, 0xD2, 0xD6, 0xAC, 0x8D, 0x1C, 0xB0, 0x4A, 0x72, 0xC0, 0x7A, 0x69,
+    0xDA, 0xC5, 0xB4, 0x9F, 0x3D, 0x1F, 0xDE, 0x8D, 0xB1, 0xAE, 0x0A, 0xA7, 0x1F, 0x4D, 0xCB, 0xDF,
+    0xAE, 0x1E, 0xA6, 0x6F, 0x79, 0x16, 0xCE, 0xFB, 0x22, 0x1A, 0xA5, 0xF4, 0x0C, 0x73, 0xCC, 0x5F,
+    0xBE, 0x29, 0x64, 0x4A, 0xA1, 0x62, 0x2D, 0x3F, 0xC9, 0x9B, 0x5E, 0x35, 0x7C, 0xA9, 0xC9, 0x7D,
+    0x42, 0x8B, 0xCF, 0x10, 0x7B, 0xAE, 0xCF, 0x19, 0x61, 0x4D, 0x21, 0x38, 0x00, 0x5A, 0x36, 0x24,
+    0xB8, 0x41, 0x48, 0x85, 0x40, 0xC1, 0x14, 0xEA, 0x40, 0x6A, 0xDB, 0x70, 0x49, 0xF6, 0xA7, 0xD0,
+    0x26, 0xE2, 0xC4, 0x1B, 0xD9, 0x11, 0x3F, 0xCA, 0x91, 0x0C, 0x71, 0xBE, 0x1D, 0xF4, 0x68, 0xD6,
+    0x3C, 0x56, 0xA5, 0x18, 0xB9, 0x1C, 0x2B, 0x77, 0x67, 0xE5, 0xFE, 0x3D, 0xE5, 0x20, 0xED, 0x35,
+    0x3F, 0xBD, 0x22, 0x9B, 0xE3, 0x0F, 0xD8, 0xDD, 0xD9, 0x36, 0x5F, 0xAA, 0x41, 0x13, 0x3D, 0x1F,
+    0xC9, 0x47, 0x51, 0x46, 0x25, 0x30, 0xAA, 0x32, 0x4A, 0xB1, 0xB4, 0x18, 0x7E, 0x0C, 0xBA, 0x14,
+    0x83, 0xFE, 0x7D, 0x36, 0x0A, 0xF3, 0xAF, 0xED, 0x07, 0xB5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10,
+    0x9D, 0xB5, 0x45, 0xAC, 0xE8, 0x0A, 0xA7, 0x38, 0x0A, 0xB8, 0x62, 0x1B, 0x0A, 0x2A, 0xFC, 0x0F,
+    0xB2, 0xEE, 0x52, 0x50, 0x90, 0x7F, 0x92, 0x86, 0x7E, 0x8D, 0x28, 0x68, 0xF3, 0x13, 0xF8, 0x09,
+    0xFC, 0x02, 0xEC, 0x88, 0x22, 0x45, 0x0A, 0x2C, 0xA5, 0xA4, 0xC0, 0x90, 0x48, 0xA1, 0xB4, 0x84,
+    0xA5, 0x38, 0xC8, 0xF6, 0xE3, 0xCD, 0xFA, 0x12, 0x24, 0x14, 0xE5, 0x83, 0x08, 0x2B, 0xB7, 0x59,
+    0xED, 0x79, 0x67, 0xDE, 0xBC, 0xF7, 0x66, 0x4E, 0x96, 0x22, 0x52, 0x76, 0x22, 0x29, 0x6A, 0x91,
+    0xA7, 0xC8, 0x45, 0x92, 0x51, 0x24, 0x02, 0x5A, 0x59, 0x00, 0x85, 0x18, 0xF0, 0x85, 0x64, 0x58,
+    0x35, 0x62, 0xCF, 0xD1, 0x89, 0xE7, 0x17, 0x06, 0xBF, 0x50, 0x27, 0x93, 0xA0, 0xB0, 0x5D, 0x3C,
+    0x89, 0xAF, 0xD3, 0xDE, 0x20, 0x77, 0x0D, 0x2F, 0x5E, 0x77, 0x54, 0x03, 0x29, 0xCE, 0xD0, 0x7B,
+    0x14, 0x46, 0x04, 0x3B, 0x2F, 0x51, 0xBA, 0xB2, 0x7F, 0xED, 0x2A, 0x59, 0x3F, 0xC0, 0x4F, 0xE0,
+    0xA0, 0x6C, 0x78, 0x83, 0xEF, 0x5B, 0x26, 0xA9, 0x6F, 0xDA, 0xEE, 0x4D, 0xAF, 0x00, 0x87, 0x61,
+    0x51, 0x14, 0x38, 0x3C, 0x04, 0xAC, 0xED, 0x97, 0xAB, 0x7C, 0x0E, 0xF5, 0x48, 0xB2, 0xC9, 0xA0,
+    0x37, 0x65, 0x43, 0x28, 0x04, 0x92, 0xF6, 0xE2, 0xFE, 0xDA, 0x26, 0xC8, 0x81, 0xB7, 0x20, 0x48,
+    0x7C, 0x07, 0x8E, 0x30, 0x5E, 0xC2, 0x48, 0x43, 0xD4, 0xD5, 0x74, 0x3B, 0x82, 0xB0, 0xDD, 0xC0,
+    0x69, 0x00, 0x5E, 0x39, 0x8D, 0x43, 0x1C, 0xEB, 0x30, 0xBB, 0x11, 0x1A, 0x8B, 0x62, 0x75, 0x6D,
+    0xF2, 0x79, 0xEB, 0xBB, 0x14, 0xBD, 0x43, 0xB3, 0x25, 0xA6, 0x89, 0x8F, 0x3A, 0x6F, 0xD1, 0x59,
+    0xE4, 0x1B, 0xBB, 0x0F, 0xA2, 0x43, 0xC4, 0xB4, 0xE6, 0xA8, 0xCB, 0x52, 0x30, 0x7A, 0x6E, 0xF2,
+    0xFB, 0xD2, 0x21, 0x12, 0x03, 0x9F, 0x81, 0x0D, 0x9E, 0x8D, 0x77, 0xE1, 0xC0, 0x94, 0x17, 0x4C,
+    0x4B, 0x3F, 0xD8, 0xC2, 0x0C, 0x92, 0x36, 0xE2, 0x6A, 0x41, 0x4F, 0xBD, 0x85, 0x9E, 0xDA, 0x0D,
+    0x75, 0xD2, 0x2A, 0x55, 0x74, 0x49, 0xF0, 0x7D, 0xC0, 0xC4, 0x8C, 0x26, 0x51, 0xA7, 0x51, 0xB3,
+    0x49, 0xB2, 0x56, 0xEF, 0x6F, 0x49, 0xDA, 0xCE, 0xE9, 0xE3, 0x41, 0x1E, 0xE8, 0x1D, 0x59, 0x52,
+    0x25, 0x3F, 0x11, 0x0B, 0xB3, 0xBB, 0x6B, 0x16, 0xDF, 0x39, 0x9C, 0x04, 0x56, 0x02, 0x2F, 0x9F,
+    0x02, 0x35, 0xE9, 0xCC, 0x0E, 0xF6, 0x19, 0x69, 0x8E, 0x1B, 0x42, 0xCF, 0xD1, 0xE7, 0x04, 0xFF,
+    0x76, 0x4C, 0x2A, 0xC5, 0xD3, 0x48, 0x03, 0xBB, 0x8D, 0x84, 0x2E, 0x42, 0x7D, 0x64, 0x44, 0x1B,
+    0x51, 0x85, 0xCC, 0xF4, 0x20, 0x81, 0x76, 0x8C, 0x9B, 0xBF, 0x2B, 0xD4, 0x69, 0xA4, 0x94, 0x60,
+    0xC7, 0x04, 0x64, 0xDA, 0xB7, 0xC9, 0x44, 0xAA, 0xFF, 0x74, 0x95, 0xD0, 0x02, 0xCB, 0x6C, 0x8A,
+    0xD8, 0x7A, 0xAC, 0x74, 0xA5, 0xB5, 0x6A, 0x65, 0xA1, 0xC0, 0x5B, 0x36, 0x94, 0xC1, 0x1D, 0x63,
+    0x8A, 0x47, 0x7A, 0x94, 0xA2, 0x4A, 0xE0, 0xDB, 0x33, 0x32, 0x75, 0x22, 0x1B, 0x8A, 0x8A, 0xA7,
+    0x8E, 0x53, 0xC3, 0xFC, 0x20, 0xAE, 0x86, 0x43, 0xA2, 0x12, 0x07, 0x49, 0x8F, 0xFB, 0xB8, 0x4B,
+    0xAB, 0x27, 0xF2, 0x6C, 0x0D, 0x81, 0xCC, 0x55, 0x9E, 0x55, 0xB1, 0x3C, 0x9D, 0x23, 0xB6, 0xBD,
+    0xE7, 0x3F, 0x0A, 0x1F, 0x21, 0x30, 0x41, 0x4A, 0x22, 0xCE, 0x0F, 0x4E, 0x25, 0x12, 0x60, 0xC6,
+    0x60, 0x27, 0x2D, 0xD6, 0xB7, 0x32, 0xF5, 0x51, 0x3B, 0x26, 0xF5, 0x76, 0x94, 0x2F, 0x83, 0xCD,
+    0x72, 0x12, 0xB5, 0xA0, 0xEF, 0x88, 0xC9, 0xDF, 0xED, 0xAF, 0x2C, 0x54, 0x0E, 0xB2, 0x38, 0x50,
+    0x77, 0x79, 0xB1, 0x9E, 0x25, 0x4E, 0x7B, 0xF4, 0x2B, 0xC6, 0x14, 0xED, 0x5E, 0x27, 0xA8, 0x92,
+    0x41, 0xCA, 0x8A, 0xA8, 0xCA, 0x82, 0x77, 0xB8, 0xD8, 0x96, 0x4B, 0x32, 0x94, 0x3A, 0x23, 0x55,
+    0x25, 0x0F, 0x0A, 0x66, 0x75, 0x9E, 0x24, 0x23, 0xF9, 0x31, 0xB0, 0xA4, 0xCD, 0x1F, 0x10, 0x86,
+    0x6D, 0x29, 0x60, 0x32, 0xC4, 0xD0, 0xEB, 0x6E, 0x34, 0xE5, 0x69, 0x8C, 0x63, 0xA5, 0x66, 0x02,
+    0x9A, 0x38, 0x28, 0xFC, 0x98, 0x9F, 0xF7, 0xC1, 0xD0, 0xBA, 0x64, 0xB5, 0xEA, 0xAD, 0xAE, 0x8F,
+    0x7A, 0x55, 0x32, 0x68, 0x1E, 0x48, 0x0D, 0xE3, 0xBA, 0xD5, 0x61, 0x45, 0x39, 0x56, 0xF3, 0x6C,
+    0x96, 0xC0, 0xD7, 0xAC, 0xD0, 0x7A, 0x5C, 0x67, 0xA8, 0x6C, 0xEB, 0x59, 0x51, 0xA5, 0x6E, 0x8B,
+    0x35, 0x3B, 0xC9, 0xB2, 0xE7, 0x8A, 0x08, 0xCA, 0x2D, 0x7D, 0x48, 0xE8, 0x0A, 0x4D, 0x69, 0x3A,
+    0x50, 0x6A, 0x23, 0x6D, 0xFC, 0x18, 0x05, 0x90, 0xE0, 0x1D, 0x86, 0x64, 0x9A, 0x3D, 0x14, 0x52,
+    0x06, 0x07, 0x2C, 0x34, 0x89, 0x55, 0x83, 0x7D, 0xBC, 0x84, 0xB7, 0x79, 0x85, 0x89, 0x5C, 0xED,
+    0xA0, 0xC1, 0xC8, 0x06, 0xD1, 0x96, 0x5E, 0xB0, 0x77, 0x7B, 0x9F, 0x8B, 0x3B, 0xEB, 0xB4, 0x49,
+    0x2B, 0xB5, 0x42, 0x21, 0xE9, 0x05, 0x8B, 0x75, 0x27, 0xC4, 0xC8, 0x2E, 0x17, 0x35, 0x1A, 0xDF,
+    0x4A, 0x99, 0x99, 0x24, 0xEB, 0xDC, 0x1A, 0xD6, 0x29, 0x65, 0x66, 0x43, 0xEB, 0xD6, 0x06, 0x20,
+    0x71, 0x12, 0x4D, 0xB9, 0x5C, 0xF9, 0x6A, 0x96, 0x87, 0x43, 0x47, 0x3B, 0x74, 0xAF, 0x9F, 0x7F,
+    0xB3, 0x4C, 0x10, 0x81, 0xCC, 0xB1, 0xA5, 0x6E, 0x3E, 0xF8, 0xC0, 0x83, 0x6D, 0x1E, 0x64, 0x6F,
+    0x90, 0xA7, 0xDF, 0x4A, 0xE0, 0x1C, 0xC0, 0xC8, 0x0F, 0x34, 0x3D, 0xB3, 0xA2, 0x2A, 0x7B, 0x7B,
+    0x21, 0xFB, 0x73, 0x1B, 0x65, 0xE3, 0x02, 0xF5, 0x1E, 0x7B, 0xAB, 0x8E, 0xEF, 0xB4, 0xF8, 0xC6,
+    0xE3, 0xCB, 0xFC, 0xBB, 0xF2, 0x9F, 0x40, 0xEA, 0xF3, 0x7C, 0xAD, 0xB8, 0xAA, 0x12, 0x0C, 0x32,
+    0xAD, 0x85, 0xD9, 0x94, 0x7B, 0x3C, 0xBF, 0x01, 0xCD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x1D,
+    0x7B, 0x95, 0x98, 0xC8, 0x12, 0x4B, 0x91, 0x34, 0x04, 0xC9, 0x0D, 0x1D, 0x12, 0xFE, 0x01, 0x94,
+    0x35, 0xA4, 0xA4, 0x49, 0x91, 0x4F, 0x48, 0x41, 0x45, 0x7E, 0x00, 0x64, 0xF3, 0x07, 0xF9, 0x04,
+    0x8A, 0x7C, 0x00, 0x2D, 0x05, 0xD8, 0x52, 0x8A, 0xB4, 0x0B, 0x2D, 0x05, 0x86, 0x12, 0x8A, 0x18,
+    0xC9, 0x82, 0x03, 0xD9, 0x7E, 0xBC, 0xD9, 0x4B, 0x48, 0x4E, 0x24, 0x90, 0x26, 0x52, 0x4E, 0xD9,
+    0x17, 0xEF, 0xDC, 0xEC, 0xEE, 0xDB, 0xF7, 0xC6, 0x73, 0xB2, 0x1A, 0xC3, 0xD7, 0xE3, 0x32, 0xBC,
+    0x19, 0xC5, 0x5D, 0x06, 0x92, 0x29, 0xC1, 0x58, 0xC3, 0x8B, 0xC8, 0x96, 0xB8, 0x26, 0x1E, 0xC5,
+    0xFA, 0x68, 0x10, 0x27, 0x71, 0x21, 0x21, 0x26, 0x7C, 0x16, 0xB1, 0x07, 0xC0, 0x41, 0x07, 0xB4,
+    0xFD, 0x32, 0xAA, 0x07, 0x52, 0xFA, 0x9B, 0x92, 0xF5, 0x91, 0x24, 0xA3, 0x48, 0x04, 0x66, 0x96,
+    0xDC, 0x20, 0xEB, 0xE5, 0xDC, 0x40, 0xCA, 0x80, 0x69, 0x4B, 0x1F, 0xCF, 0x18, 0x98, 0xD6, 0x01,
+    0x94, 0x1C, 0x1F, 0x39, 0x3A, 0x59, 0x5D, 0x4A, 0xB1, 0xF9, 0x15, 0xEF, 0x7E, 0xD6, 0xFD, 0x73,
+    0x33, 0xE6, 0x82, 0xC7, 0x95, 0x7B, 0xDF, 0xD8, 0xFE, 0x16, 0xC9, 0x09, 0xF7, 0x71, 0x5E, 0x6C,
+    0x2F, 0x17, 0x4F, 0x92, 0x49, 0x32, 0xF4, 0x29, 0x46, 0x25, 0x2B, 0x0E, 0x83, 0x58, 0x4C, 0x22,
+    0xBB, 0xB3, 0xBF, 0xA8, 0x44, 0xB3, 0x64, 0x8C, 0xF0, 0x10, 0x45, 0xE9, 0x4B, 0x6F, 0x3B, 0x06,
+    0x5E, 0x9E, 0xCD, 0x78, 0x45, 0x6E, 0x1B, 0x0C, 0xE4, 0x2F, 0x50, 0xD8, 0x4F, 0x35, 0xF0, 0x83,
+    0xFC, 0x46, 0x0E, 0x88, 0xAC, 0x8A, 0xE4, 0x4C, 0xAD, 0x39, 0x76, 0x39, 0xCC, 0x85, 0x23, 0xEE,
+    0xCD, 0x98, 0x0C, 0x66, 0x4C, 0x87, 0xF9, 0x7F, 0xD9, 0x3A, 0x2F, 0x8F, 0x9C, 0xA5, 0xA4, 0xE2,
+    0x73, 0xD5, 0x8F, 0x69, 0x0B, 0xB5, 0x9D, 0xF3, 0x0E, 0x7C, 0x03, 0x2D, 0xE5, 0x47, 0xE6, 0x4F,
+    0x18, 0x3A, 0xEA, 0x18, 0xE2, 0xBA, 0x84, 0xF1, 0xA8, 0xEE, 0x75, 0x0D, 0xB3, 0x5E, 0x1F, 0x67,
+    0xA5, 0x2A, 0xF5, 0x86, 0xA8, 0xC4, 0x5C, 0x68, 0x5B, 0xD5, 0x78, 0x53, 0xF9, 0xDB, 0x20, 0xF2,
+    0x92, 0xA4, 0x28, 0x72, 0x14, 0xEB, 0x4C, 0x5F, 0xF8, 0xDB, 0x11, 0x9E, 0xCC, 0x04, 0x54, 0x31,
+    0x97, 0xA1, 0x70, 0x28, 0x6E, 0x2C, 0xE6, 0x44, 0xA8, 0xA8, 0x6F, 0x8E, 0x5E, 0x4E, 0x3E, 0x77,
+    0x02, 0xBE, 0x55, 0xD0, 0x8B, 0xCC, 0xA5, 0x21, 0xC3, 0x56, 0xF1, 0xAE, 0x2C, 0x7E, 0x1C, 0xC8,
+    0x78, 0x70, 0x68, 0x52, 0x0C, 0x29, 0xDA, 0xA8, 0xF6, 0x31, 0xB7, 0x72, 0x3C, 0x6E, 0x08, 0x38,
+    0x05, 0xE4, 0xC1, 0x55, 0x3C, 0xA2, 0x21, 0x0E, 0x68, 0x15, 0x5D, 0xAF, 0x98, 0x0D, 0x8A, 0x29,
+    0x14, 0x0D, 0x4A, 0x62, 0x04, 0x52, 0x1D, 0xA8, 0x9C, 0xA2, 0x0B, 0x68, 0x51, 0x25, 0x53, 0x91,
+    0xA2, 0x72, 0x68, 0x8D, 0xA2, 0xE7, 0x75, 0xF4, 0xEC, 0xED, 0x13, 0x12, 0x46, 0xA7, 0x56, 0xB5,
+    0xCE, 0x14, 0x5C, 0xA3, 0x74, 0xF5, 0x8B, 0x67, 0x0B, 0x5C, 0xB7, 0x97, 0xF6, 0x24, 0x1F, 0xCA,
+    0x51, 0xCA, 0x89, 0x8C, 0xEE, 0x51, 0xB9, 0xCA, 0xA0, 0x40, 0x63, 0x26, 0xA9, 0x15, 0xCA, 0xFF,
+    0x43, 0xED, 0x73, 0x1C, 0xE8, 0x7D, 0x0F, 0xD4, 0xD1, 0xEB, 0x20, 0x40, 0x1C, 0x9E, 0x6C, 0xA7,
+    0x98, 0x06, 0x13, 0x93, 0xF9, 0x73, 0xC0, 0x4C, 0xA5, 0x90, 0x95, 0x2B, 0xBB, 0xBD, 0xBE, 0x39,
+    0xAC, 0xEC, 0x50, 0x1F, 0xDA, 0x4E, 0x5C, 0x71, 0x22, 0x7D, 0x48, 0xD8, 0x53, 0x3A, 0x62, 0x19,
+    0xB4, 0x8D, 0x7E, 0x95, 0xF4, 0x5A, 0x4A, 0xF1, 0xBC, 0xD8, 0xEA, 0x50, 0x50, 0x59, 0x75, 0xAD,
+    0x0A, 0x6A, 0x45, 0xF6, 0x59, 0xF0, 0x31, 0x09, 0x66, 0x87, 0xE4, 0x97, 0x82, 0x02, 0x1A, 0x7D,
+    0x09, 0x65, 0xFA, 0x73, 0xDD, 0x2B, 0x50, 0x33, 0x09, 0xE7, 0xC7, 0xE1, 0x8C, 0x63, 0x33, 0xA5,
+    0x96, 0x53, 0x1F, 0xE5, 0x8D, 0xAC, 0x45, 0x3B, 0x54, 0xB1, 0xFE, 0x8C, 0x3E, 0xE6, 0xEB, 0x0A,
+    0x34, 0x1B, 0xBC, 0x54, 0x68, 0x8B, 0x68, 0xF4, 0xDD, 0xB4, 0xBD, 0x51, 0x1F, 0xD8, 0x07, 0x3A,
+    0x9D, 0xC4, 0x97, 0x99, 0x64, 0x33, 0xBD, 0x9B, 0x45, 0xA7, 0x4D, 0x10, 0xB0, 0x68, 0xCF, 0x33,
+    0xC1, 0x07, 0x13, 0xBA, 0x33, 0x26, 0x8C, 0x73, 0x13, 0x24, 0x98, 0x50, 0xA9, 0xD8, 0xB5, 0x0F,
+    0x26, 0x74, 0xC1, 0x84, 0x59, 0x30, 0x61, 0x9C, 0x9B, 0xE0, 0x82, 0x09, 0xF5, 0xF9, 0x26, 0x24,
+    0x0B, 0x26, 0x14, 0x27, 0xD7, 0x8E, 0xBC, 0xA2, 0xF9, 0xA5, 0x7A, 0x98, 0x50, 0x6B, 0x06, 0x41,
+    0x87, 0xA7, 0x45, 0x90, 0x3E, 0xC6, 0x21, 0xBC, 0x2A, 0xFF, 0x88, 0x12, 0xCC, 0x82, 0xF0, 0xAE,
+    0x65, 0x4F, 0x56, 0x65, 0x5D, 0x9B, 0xFC, 0xEB, 0x21, 0xA7, 0x5A, 0x14, 0x3C, 0xD5, 0x4D, 0x6B,
+    0xAA, 0x6E, 0x67, 0xDA, 0x8B, 0x8F, 0xFB, 0x5B, 0x39, 0xA8, 0xE5, 0x9C, 0xDC, 0xD7, 0x92, 0xD5,
+    0x83, 0x13, 0x55, 0x46, 0x6B, 0x68, 0xA1, 0x48, 0x6F, 0xEF, 0x87, 0x60, 0xCB, 0x52, 0xA6, 0xFB,
+    0x06, 0x5F, 0x68, 0x8A, 0xF6, 0x57, 0x6D, 0xEA, 0x68, 0x59, 0x33, 0xAC, 0x43, 0x4F, 0xCE, 0xFA,
+    0xFB, 0x58, 0x7F, 0xE0, 0x36, 0xF9, 0x77, 0x6E, 0x93, 0xB2, 0x60, 0xB9, 0xAC, 0xEC, 0x34, 0x48,
+    0xE3, 0xF2, 0x6F, 0xDC, 0xD6, 0x52, 0x34, 0xFE, 0x68, 0xD8, 0x89, 0xE9, 0x11, 0x5A, 0x9A, 0x93,
+    0xE3, 0x08, 0x45, 0xD8, 0x98, 0x5C, 0x54, 0x81, 0xB5, 0xAD, 0xD3, 0x93, 0x7F, 0x03, 0xC5, 0x55,
+    0x3D, 0x8F, 0x1C, 0x45, 0x10, 0xAD, 0x99, 0xE6, 0xB6, 0x91, 0x27, 0x68, 0x07, 0x38, 0xB1, 0x83,
+    0xFE, 0x01, 0x48, 0x4C, 0x42, 0x8A, 0x7A, 0xC4, 0xFD, 0x00, 0x1C, 0xDC, 0x06, 0x88, 0x00, 0x02,
+    0x22, 0x92, 0xFB, 0x03, 0x96, 0x7A, 0x10, 0x81, 0x43, 0x36, 0x70, 0x6E, 0x42, 0x38, 0x07, 0x4E,
+    0x09, 0xB0, 0xA7, 0xE1, 0x82, 0x0B, 0x19, 0x11, 0x90, 0x38, 0x60, 0x10, 0x08, 0xA4, 0x4B, 0xAE,
+    0x2D, 0xCD, 0xC9, 0xC3, 0xA9, 0x67, 0x8A, 0x57, 0xBD, 0xB7, 0x0B, 0x81, 0x33, 0x4E, 0x62, 0xA5,
+    0xED, 0x9A, 0xE9, 0x8F, 0xAA, 0x57, 0xAF, 0x5F, 0xD5, 0x94, 0xCC, 0x8D, 0x62, 0x6E, 0xF1, 0x6F,
+    0x68, 0xF7, 0x3B, 0x78, 0x44, 0x05, 0xE6, 0x34, 0xF3, 0x60, 0xFF, 0xEA, 0x46, 0x37, 0x98, 0xE4,
+    0x43, 0x95, 0xBA, 0xA0, 0x67, 0x96, 0x7F, 0xAB, 0xB6, 0x36, 0x68, 0xCC, 0x55, 0xC9, 0x47, 0x33,
+    0xBA, 0xA5, 0x8B, 0x86, 0x39, 0x94, 0x3C, 0x13, 0xDD, 0xD9, 0xB9, 0xD2, 0xA1, 0x22, 0x2A, 0xE6,
+    0x7B, 0x81, 0xC8, 0xF1, 0x80, 0x77, 0x19, 0xFE, 0x59, 0xA6, 0xE2, 0x04, 0x8F, 0x96, 0x17, 0xA2,
+    0x9A, 0x79, 0x24, 0xB7, 0x3C, 0xE5, 0xA6, 0x1E, 0x89, 0xA3, 0x1D, 0xC9, 0x2C, 0x26, 0x01, 0xC6,
+    0x29, 0xFC, 0xB9, 0x97, 0x00, 0x57, 0xCD, 0x5D, 0xA0, 0x92, 0x8F, 0x23, 0x51, 0xF7, 0x4B, 0xC2,
+    0xB1, 0x57, 0x4C, 0x32, 0xD9, 0x63, 0xD2, 0x4E, 0x44, 0x7C, 0x8A, 0x77, 0xD7, 0x23, 0x82, 0x8B,
+    0x76, 0xA1, 0x3A, 0x96, 0xBC, 0xC0, 0x67, 0x76, 0x4C, 0x9D, 0x04, 0x2E, 0xD6, 0x12, 0x13, 0x11,
+    0xD5, 0xA0, 0x5A, 0x35, 0xD9, 0xA6, 0x64, 0x1C, 0xE9, 0x70, 0xF6, 0xA0, 0xB9, 0xC1, 0xC4, 0xDF,
+    0x94, 0x10, 0x55, 0xFB, 0x00, 0x43, 0xF4, 0x2D, 0x55, 0x93, 0x0B, 0xA4, 0x65, 0x50, 0xB1, 0xC6,
+    0xCA, 0xA6, 0xDC, 0xF3, 0xFC, 0xD9, 0x46, 0x28, 0x61, 0xEC, 0x61, 0x9C, 0x36, 0xFC, 0x84, 0xFB,
+    0x6A, 0x26, 0x97, 0xF4, 0x4C, 0x8A, 0xBF, 0x00, 0x36, 0x1F, 0x91, 0x38, 0x30, 0xF4, 0xBB, 0xC4,
+    0x5F, 0x20, 0xF1, 0x5A, 0x12, 0x17, 0x10, 0x32, 0x29, 0xB9, 0x9D, 0x81, 0x3F, 0x17, 0xF1, 0x0E,
+    0x34, 0x13, 0xB6, 0x6B, 0x6E, 0xAB, 0x84, 0x94, 0xBB, 0x79, 0xEB, 0x18, 0x1C, 0x20, 0x47, 0x5A,
+    0xEF, 0x68, 0x37, 0x87, 0x81, 0xEC, 0x19, 0x78, 0xFA, 0xB2, 0x27, 0x67, 0x03, 0x3D, 0xAB, 0x89,
+    0xBE, 0x7D, 0x87, 0xE8, 0xF6, 0x1B, 0x37, 0x7C, 0xFD, 0x44, 0x2B, 0x66, 0xE1, 0xDF, 0x67, 0x53,
+    0xF2, 0x55, 0x07, 0x53, 0x2D, 0x40, 0x5B, 0x8E, 0x66, 0x82, 0x29, 0xA2, 0x8B, 0x30, 0xB4, 0x71,
+    0xBD, 0x18, 0xF2, 0x21, 0x1B, 0xDC, 0xB4, 0xBB, 0x3A, 0x69, 0xC4, 0x00, 0x08, 0x67, 0x93, 0xDF,
+    0x2E, 0xD7, 0x79, 0x4D, 0x76, 0xE6, 0x03, 0xB7, 0xB7, 0xC7, 0xBF, 0xAB, 0xC5, 0x19, 0x25, 0x93,
+    0x5D, 0x27, 0x95, 0x03, 0x25, 0x92, 0xA8, 0x48, 0xFD, 0xDE, 0x16, 0x04, 0x1D, 0xDC, 0xCF, 0xD9,
+    0x6D, 0xE8, 0xC3, 0x06, 0x88, 0x3E, 0x07, 0x54, 0x0F, 0x89, 0x70, 0xF0, 0x7F, 0xF0, 0xF2, 0x71,
+    0x42, 0x9A, 0x0B, 0xB1, 0x85, 0x6C, 0xC8, 0x81, 0x66, 0x1F, 0x0C, 0x78, 0xB6, 0xE0, 0x2F, 0x17,
+    0x07, 0x03, 0x2B, 0xAF, 0xD7, 0x1F, 0xC8, 0x02, 0x78, 0x27, 0xA8, 0x14, 0xB7, 0x63, 0xB8, 0x29,
+    0x0C, 0x3F, 0xC5, 0x72, 0x60, 0x7E, 0xC5, 0x1C, 0x2B, 0x8E, 0x35, 0xA4, 0x06, 0x06, 0xD6, 0x7B,
+    0x0E, 0xCA, 0x16, 0x83, 0xC2, 0x7E, 0xA8, 0x55, 0xD8, 0x67, 0x29, 0x0C, 0x79, 0xA2, 0xCD, 0x7E,
+    0xCF, 0x7A, 0x2D, 0x15, 0x02, 0xAC, 0x46, 0x7C, 0xD1, 0xF1, 0x55, 0x97, 0x48, 0x23, 0x8F, 0xA6,
+    0x00, 0x9A, 0x41, 0xC0, 0x4C, 0x64, 0xA3, 0x9A, 0x31, 0x89, 0x99, 0x82, 0x4B, 0x88, 0xC6, 0x5F,
+    0x60, 0xB0, 0x52, 0xB7, 0x5A, 0x86, 0x82, 0x6B, 0xA1, 0x45, 0xAA, 0xC0, 0x0A, 0xAB, 0x3A, 0x81,
+    0x68, 0x6C, 0xEE, 0x62, 0xD1, 0xFD, 0x6E, 0xF8, 0x50, 0x88, 0x9C, 0x70, 0xA5, 0x19, 0x04, 0xDD,
+    0xB9, 0x2E, 0x50, 0x5C, 0x95, 0x48, 0x0A, 0xE2, 0x84, 0x44, 0x9E, 0x8B, 0x6E, 0xA1, 0x83, 0xAD,
+    0x0A, 0x9A, 0x4F, 0xEB, 0xC9, 0x9F, 0xF1, 0x8F, 0xE9, 0x6D, 0x40, 0x72, 0xCB, 0xD7, 0x4A, 0xEA,
+    0x6B, 0x20, 0xB5, 0xBC, 0xC6, 0xE8, 0xDC, 0x45, 0x1A, 0x27, 0x34, 0xFF, 0x1F, 0xB9, 0x14, 0x42,
+    0xA5, 0xCA, 0x6F, 0x5E, 0xE8, 0x36, 0xBD, 0x24, 0x17, 0x77, 0xC4, 0x53, 0xBE, 0xF9, 0xA3, 0xD5,
+    0xFB, 0xFC, 0x30, 0xF9, 0xC4, 0x3F, 0x74, 0x0C, 0x3C, 0xE7, 0x2D, 0x3C, 0xBF, 0x36, 0x1B, 0x31,
+    0x1E, 0xED, 0x88, 0xC7, 0x5D, 0x5B, 0x5C, 0xE1, 0x1A, 0xE1, 0xDD, 0xA0, 0x8B, 0x60, 0xCD, 0x84,
+    0xEC, 0xF6, 0x2D, 0x4C, 0x06, 0x8D, 0xDE, 0x96, 0x24, 0x52, 0x7D, 0x86, 0x41, 0xB1, 0xC4, 0x74,
+    0x12, 0xB3, 0x1C, 0xF7, 0x5D, 0x6E, 0x7D, 0x44, 0xA2, 0xC5, 0x41, 0x68, 0x41, 0xC6, 0xDD, 0x39,
+    0x76, 0xD9, 0x68, 0x84, 0x01, 0xE2, 0x76, 0x4F, 0xCB, 0x88, 0x49, 0x9D, 0x76, 0xC9, 0x76, 0x02,
+    0x42, 0xCA, 0xC9, 0xCA, 0x20, 0xA5, 0x86, 0x49, 0xB4, 0x44, 0xEC, 0x04, 0xAB, 0x36, 0x42, 0xF2,
+    0x3A, 0x95, 0x1C, 0x56, 0xBC, 0x71, 0xB3, 0xE1, 0x45, 0xF1, 0x6F, 0xA0, 0xA5, 0xCE, 0x51, 0x8F,
+    0xA8, 0x68, 0x6F, 0x91, 0x53, 0xB1, 0x9C, 0x9E, 0x91, 0xB9, 0x68, 0x73, 0xC5, 0xC0, 0x4B, 0xB1,
+    0x05, 0xF4, 0x1F, 0x88, 0x20, 0x7A, 0x77, 0x4B, 0xAC, 0x60, 0xC0, 0x2A, 0x6F, 0xA8, 0xB8, 0x5E,
+    0xB8, 0xFB, 0x4D, 0x6E, 0x66, 0xA8, 0x3C, 0xCD, 0x1F, 0xA1, 0x9C, 0x34, 0x9A, 0x97, 0x41, 0xFB,
+    0x7E, 0xCF, 0x48, 0x0B, 0x5F, 0xA4, 0xE6, 0x7A, 0x74, 0xA5, 0x08, 0x8B, 0x4C, 0x61, 0x35, 0xFF,
+    0x84, 0xE4, 0x1F, 0xB7, 0x6A, 0xF1, 0x64, 0x2E, 0x17, 0x82, 0xD8, 0x9E, 0x2C, 0x10, 0xC1, 0x50,
+    0x23, 0xE3, 0x62, 0x57, 0x40, 0x22, 0x04, 0x9C, 0x0F, 0x22, 0x52, 0x5C, 0xAB, 0x0A, 0xFB, 0xDE,
+    0xF2, 0x48, 0x3E, 0x2A, 0x8E, 0x93, 0x0B, 0xDE, 0xC4, 0xEA, 0x74, 0x2E, 0x36, 0x10, 0x1D, 0xCA,
+    0x0F, 0x6D, 0xBD, 0x11, 0xFF, 0xF5, 0xFC, 0x80, 0xF8, 0xB8, 0xAD, 0x5F, 0x4C, 0xF6, 0x25, 0x1A,
+    0xC0, 0x75, 0x61, 0x52, 0x85, 0x4B, 0xF4, 0x43, 0xFE, 0x16, 0x39, 0x03, 0x94, 0x26, 0xDC, 0x42,
+    0xCF, 0xCE, 0x1E, 0x4F, 0xA0, 0x51, 0x09, 0xCF, 0xDF, 0xF3, 0xCF, 0x6C, 0xA6, 0x22, 0xB9, 0x5E,
+    0x49, 0x16, 0x87, 0xD2, 0x86, 0x91, 0xAA, 0xCD, 0x1F, 0x94, 0x94, 0xAF, 0x44, 0xB3, 0x7C, 0x9E,
+    0xC6, 0xAF, 0xC8, 0xFF, 0x39, 0x10, 0x3F, 0x0E, 0x6A, 0xF6, 0x2D, 0xE2, 0x9C, 0xF3, 0x43, 0x68,
+    0xBF, 0x12, 0xBA, 0xA4, 0xE1, 0x1E, 0x64, 0xD1, 0x80, 0x81, 0xEA, 0xA2, 0x57, 0xBF, 0x26, 0x15,
+    0x2D, 0x7D, 0xB2, 0x25, 0xEC, 0xEE, 0x7D, 0x12, 0x19, 0x73, 0x64, 0x84, 0x09, 0xB5, 0x19, 0x57,
+    0x87, 0x40, 0xD4, 0xA1, 0x77, 0xE7, 0xC6, 0x14, 0xA8, 0xBB, 0x44, 0x91, 0x3C, 0xA7, 0xEE, 0x78,
+    0x00, 0x31, 0xDC, 0x63, 0xE5, 0x5F, 0x4D, 0xE5, 0xA6, 0x7E, 0x7F, 0x03, 0xCD, 0x54, 0x3D, 0x8B,
+    0xD5, 0x5A, 0x14, 0x5D, 0xB9, 0x71, 0xEE, 0x45, 0xC3, 0x23, 0x16, 0x2A, 0xE8, 0x08, 0xF9, 0x03,
+    0x42, 0xDA, 0x57, 0x38, 0x9C, 0xA3, 0x03, 0xB6, 0x6F, 0x8A, 0x67, 0x21, 0x16, 0x36, 0x5A, 0x58,
+    0x8D, 0x3F, 0x40, 0x4C, 0x3A, 0x0B, 0x9B, 0xA9, 0x6C, 0x5E, 0xE1, 0x14, 0x16, 0x7E, 0x14, 0xFE,
+    0x02, 0x27, 0xD1, 0x57, 0xD8, 0xE6, 0x29, 0xD8, 0x9A, 0x42, 0x10, 0x6C, 0x8C, 0x10, 0xF5, 0x32,
+    0x24, 0x59, 0xAE, 0x9D, 0x99, 0x81, 0x51, 0x10, 0x9D, 0x79, 0x28, 0x6E, 0xC2, 0x0E, 0xE7, 0x9C,
+    0x64, 0xEF, 0xB5, 0xD7, 0xDA, 0x67, 0xE3, 0xC4, 0x7D, 0xCC, 0xC8, 0xBC, 0x20, 0x67, 0xBC, 0xD8,
+    0xB9, 0x7A, 0xD6, 0xD0, 0xC7, 0xFF, 0xF6, 0x58, 0x8A, 0x7B, 0xC0, 0x0D, 0x1E, 0x19, 0x2B, 0x14,
+    0x6C, 0xF4, 0x6E, 0x91, 0xE8, 0x3D, 0xE3, 0xF3, 0x3C, 0xE0, 0x9D, 0x3C, 0x1C, 0x32, 0xC4, 0x1F,
+    0x06, 0x64, 0xCF, 0xF8, 0x70, 0x48, 0xC8, 0x3A, 0x65, 0x8F, 0xE0, 0x3C, 0x80, 0x7B, 0x40, 0xD4,
+    0x01, 0x8B, 0x2D, 0x10, 0x57, 0x40, 0xA6, 0x65, 0x03, 0x1C, 0xD7, 0xC9, 0x89, 0x15, 0x28, 0x17,
+    0xD9, 0x30, 0xE8, 0x5C, 0x99, 0xC6, 0xED, 0x74, 0x99, 0xB5, 0xA2, 0xE7, 0x91, 0xFE, 0xCD, 0x58,
+    0xA2, 0xF8, 0xD0, 0x84, 0xFD, 0x06, 0x8A, 0xD5, 0x5A, 0x61, 0x59, 0xE9, 0x04, 0x8A, 0x78, 0xC8,
+    0x23, 0x9E, 0x23, 0x28, 0x14, 0xAF, 0x44, 0x54, 0xDB, 0x33, 0x59, 0x43, 0x98, 0x47, 0x79, 0xEA,
+    0x37, 0xE0, 0x6E, 0xD5, 0xC8, 0x06, 0xE5, 0x51, 0x12, 0x87, 0xD1, 0xA6, 0x0F, 0x7C, 0x30, 0x22,
+    0xE2, 0x13, 0xBE, 0x64, 0x3C, 0x57, 0xB6, 0x2A, 0xB4, 0xC2, 0x96, 0xA9, 0x50, 0x5C, 0x53, 0x21,
+    0x2D, 0x52, 0x76, 0x7A, 0xF7, 0x2A, 0xA8, 0x43, 0xC0, 0x76, 0x1D, 0xD9, 0x9B, 0x1A, 0xBC, 0x53,
+    0x86, 0x7D, 0x96, 0x27, 0xEF, 0xF9, 0x96, 0x37, 0xC9, 0x79, 0x44, 0xFD, 0x71, 0xDE, 0x63, 0x8A,
+    0x3F, 0x67, 0x95, 0x43, 0xEF, 0x90, 0xBC, 0xF3, 0x13, 0xC1, 0x4A, 0x4B, 0xC0, 0x8F, 0xC9, 0xF6,
+    0x59, 0xD4, 0x68, 0x8E, 0xB2, 0x5D, 0xCE, 0x33, 0xDF, 0x70, 0xD8, 0x76, 0x8F, 0x0F, 0xCA, 0x5D,
+    0x86, 0x1C, 0xF6, 0xE6, 0xA6, 0x7C, 0x6D, 0xA1, 0xFB, 0x6D, 0xB7, 0x65, 0x57, 0xB1, 0xF3, 0x49,
+    0x26, 0xE8, 0xC6, 0x24, 0x90, 0xDA, 0x72, 0xB0, 0x83, 0xBB, 0x18, 0x85, 0x72, 0x25, 0x12, 0x49,
+    0xDC, 0x61, 0x91, 0xFC, 0x8B, 0x7C, 0x5E, 0x6C, 0xAE, 0x4B, 0xCA, 0x09, 0x81, 0xA2, 0x44, 0xDA,
+    0xE0, 0xCB, 0x45, 0x1F, 0x88, 0xE5, 0xD2, 0xB1, 0x9E, 0xA9, 0xE0, 0xA3, 0x22, 0x49, 0xA2, 0x28,
+    0xDA, 0x6A, 0x89, 0xB0, 0xC1, 0xA4, 0x45, 0xA8, 0x0E, 0x58, 0x07, 0x4E, 0x62, 0xC9, 0x94, 0x11,
+    0x92, 0xE4, 0x85, 0x76, 0x22, 0x35, 0x14, 0x26, 0x23, 0x92, 0x1B, 0xD8, 0x65, 0xBF, 0x8C, 0x8B,
+    0x50, 0xF9, 0xBB, 0x31, 0x79, 0xE2, 0x93, 0x67, 0x65, 0xFC, 0xBE, 0x9A, 0x75, 0x87, 0x03, 0xEA,
+    0x53, 0xBE, 0x20, 0xDB, 0x47, 0xC3, 0xBD, 0x6F, 0x15, 0x6C, 0x0B, 0xEF, 0x33, 0x36, 0x31, 0xE7,
+    0x01, 0xE7, 0x58, 0x58, 0xD9, 0x0F, 0xF4, 0x8C, 0xC3, 0xB6, 0xDB, 0x13, 0xF4, 0xEF, 0xC8, 0x33,
+    0x29, 0x36, 0xD7, 0xD4, 0xB0, 0xC7, 0xF8, 0xF7, 0xB7, 0xE4, 0xC1, 0x61, 0xC3, 0x3A, 0xEB, 0x4E,
+    0x19, 0xE2, 0x41, 0x4A, 0x60, 0xD3, 0xA4, 0x08, 0x9F, 0x8E, 0x1D, 0xB0, 0xDD, 0xCD, 0x3B, 0xA6,
+    0xEB, 0xAE, 0xCB, 0xA1, 0xFF, 0x0B, 0xFE, 0x57, 0xB4, 0xB8, 0x34, 0x87, 0x3A, 0xD9, 0x95, 0xA1,
+    0x72, 0x11, 0x71, 0x87, 0xB0, 0x83, 0x6B, 0x10, 0x37, 0x7B, 0xD9, 0x16, 0xF6, 0x42, 0xC3, 0x44,
+    0xE3, 0xA3, 0x8A, 0x7A, 0x84, 0x62, 0xAA, 0x19, 0xBD, 0xB5, 0x83, 0x20, 0x02, 0xC7, 0x8C, 0xCF,
+    0x28, 0x57, 0xED, 0xAE, 0x69, 0x0C, 0x83, 0xDC, 0xF5, 0x4C, 0x27, 0x47, 0xA2, 0x1C, 0x5F, 0x59,
+    0xDA, 0x45, 0xF4, 0x45, 0x97, 0xD0, 0xAF, 0x76, 0x53, 0x7A, 0x91, 0xF2, 0x63, 0x6E, 0x90, 0x84,
+    0x96, 0x74, 0x4D, 0x39, 0x75, 0xF3, 0x8B, 0x2E, 0x93, 0x8E, 0xFE, 0x08, 0x0C, 0x89, 0x28, 0x88,
+    0xC7, 0x2E, 0x71, 0x96, 0xF9, 0x6B, 0xD3, 0x9C, 0x3C, 0x43, 0xBE, 0xA2, 0x12, 0xF7, 0x8B, 0xF4,
+    0x0B, 0xCC, 0xF7, 0xC9, 0xC3, 0xAE, 0x6D, 0xB5, 0x9D, 0xA8, 0x88, 0xE6, 0x48, 0x7A, 0xE3, 0xC6,
+    0x8D, 0x6C, 0x38, 0x23, 0x46, 0xF3, 0xC9, 0x74, 0x09, 0xAE, 0x60, 0x07, 0x8F, 0x4D, 0xE0, 0x2D,
+    0x4E, 0x7E, 0x32, 0x13, 0x5B, 0xAD, 0x10, 0xFB, 0x3F, 0x2C, 0xF3, 0x6D, 0x6B, 0x14, 0xF5, 0x81,
+    0x7C, 0x31, 0xB7, 0xFD, 0xE3, 0xF8, 0x4D, 0x1A, 0xE5, 0x80, 0xA5, 0x3F, 0x8D, 0x6B, 0xC2, 0x70,
+    0xD6, 0x66, 0xBF, 0x35, 0x73, 0x6C, 0x1A, 0x62, 0xE5, 0xE7, 0xD2, 0xB3, 0x30, 0xF2, 0x33, 0x02,
+    0x89, 0xFE, 0x31, 0x62, 0x4E, 0xC7, 0xB6, 0xD3, 0x2E, 0xD9, 0x70, 0xF9, 0x68, 0xFA, 0x58, 0x3D,
+    0xD2, 0x6E, 0x07, 0x87, 0xEE, 0x61, 0x95, 0xF1, 0x13, 0xA9, 0x50, 0xE7, 0x58, 0x05, 0x59, 0xFD,
+    0xBF, 0xE8, 0xD9, 0xDA, 0xCE, 0x4A, 0x01, 0x9C, 0x0C, 0x6A, 0x4B, 0x9F, 0xB6, 0x2A, 0xDC, 0x34,
+    0x8A, 0x0D, 0xA9, 0x26, 0xEC, 0x38, 0x43, 0x2E, 0x78, 0x7C, 0xD7, 0x3E, 0x03, 0xB5, 0x55, 0xBD,
+    0x8E, 0xDE, 0x44, 0x14, 0xBD, 0xF6, 0xB0, 0x31, 0xC2, 0xC5, 0xA4, 0xA0, 0x40, 0x34, 0x6E, 0x28,
+    0xA8, 0xF0, 0x1B, 0x30, 0x96, 0x90, 0xA0, 0xA0, 0xA1, 0x40, 0x42, 0xF4, 0xF4, 0xB4, 0x34, 0xE0,
+    0xE9, 0x69, 0xF6, 0x0D, 0xD2, 0x22, 0x9A, 0x7D, 0x01, 0x82, 0x9D, 0xDD, 0x92, 0x02, 0x93, 0x27,
+    0xB0, 0x00, 0x29, 0x12, 0x4D, 0x06, 0xAD, 0x45, 0xBC, 0x64, 0x3C, 0x97, 0x73, 0xC6, 0xD9, 0xC5,
+    0xBB, 0x15, 0x48, 0x89, 0x25, 0xDF, 0xF9, 0x3E, 0xCF, 0xF8, 0xDE, 0x73, 0xCE, 0xFD, 0xB1, 0x08,
+    0xAF, 0x32, 0xC1, 0xD4, 0x4F, 0xBD, 0x48, 0x53, 0x8D, 0x30, 0x66, 0x7C, 0xF1, 0xCB, 0x3E, 0xED,
+    0xB0, 0xBB, 0xC9, 0xE1, 0x6A, 0x63, 0xAD, 0xDD, 0x10, 0x1B, 0xED, 0xBE, 0x8C, 0xF7, 0xB4, 0xAB,
+    0xA2, 0xFC, 0x37, 0x93, 0x4A, 0xED, 0x8C, 0xAA, 0x9E, 0x96, 0x30, 0x51, 0x86, 0xD8, 0xAF, 0x72,
+    0xD2, 0xBD, 0x09, 0x8F, 0x85, 0xBC, 0x0E, 0xDB, 0xC8, 0x82, 0x9F, 0x9B, 0x0D, 0x88, 0x1A, 0x14,
+    0x61, 0xB5, 0xC6, 0x83, 0x7A, 0x7A, 0x1F, 0x7B, 0x6F, 0xC9, 0xE9, 0x11, 0x42, 0xA1, 0x3A, 0xF5,
+    0xFA, 0x4C, 0x15, 0xAE, 0x3E, 0xD4, 0xA9, 0xE8, 0x67, 0xA3, 0x38, 0x2F, 0x36, 0x8A, 0x89, 0xE2,
+    0x02, 0x1C, 0x88, 0x8E, 0xE2, 0xC6, 0xFF, 0xF3, 0xB8, 0x1F, 0x01, 0x10, 0x42, 0x54, 0xDA, 0xB5,
+    0x8B, 0x58, 0x80, 0x1C, 0x69, 0x23, 0x30, 0xA8, 0x42, 0x19, 0xF9, 0xBC, 0xBB, 0x89, 0x3F, 0x7F,
+    0x05, 0x55, 0x16, 0xC8, 0x62, 0x02, 0xF7, 0x7F, 0x5D, 0x81, 0xF9, 0x82, 0xC0, 0x29, 0x5C, 0x51,
+    0x74, 0xAF, 0x54, 0xAE, 0x57, 0x22, 0xC0, 0xF0, 0xAF, 0x00, 0x26, 0x0B, 0x00, 0xD2, 0x60, 0x0D,
+    0x01, 0xC0, 0xAD, 0x52, 0xE6, 0x43, 0x3E, 0x0B, 0x8C, 0xED, 0x32, 0x80, 0x48, 0xCB, 0x04, 0x21,
+    0x71, 0x9A, 0x79, 0xAE, 0xB4, 0x27, 0x2F, 0x9B, 0xB5, 0x23, 0x6B, 0x3B, 0xD2, 0xE5, 0x4D, 0xF0,
+    0x9E, 0x60, 0x1C, 0x11, 0x34, 0xEB, 0xB5, 0xCC, 0xD5, 0xBC, 0xAF, 0x4D, 0xDC, 0x57, 0xA7, 0xFB,
+    0xBA, 0x39, 0xA6, 0x4E, 0xCC, 0x92, 0x7D, 0x48, 0xE1, 0xCB, 0x63, 0x72, 0xE4, 0xFA, 0xF0, 0x52,
+    0x2D, 0xA5, 0x26, 0xA7, 0xA1, 0x5E, 0x4B, 0xDD, 0x1A, 0xF5, 0xD0, 0xA6, 0x0F, 0x26, 0x6B, 0xD4,
+    0x42, 0xAE, 0xAE, 0xD9, 0x20, 0x5B, 0xA1, 0xBE, 0x55, 0x81, 0x47, 0x1D, 0xE1, 0x1F, 0x30, 0xB8,
+    0x76, 0x83, 0xC8, 0x80, 0x6C, 0x78, 0xF4, 0x90, 0x9B, 0x1F, 0x0E, 0x23, 0xCA, 0xC2, 0x85, 0xE8,
+    0x1E, 0x01, 0x49, 0xFB, 0x67, 0x74, 0xB9, 0x38, 0xFE, 0x5A, 0xDB, 0x4B, 0x88, 0x65, 0x9F, 0x07,
+    0xFB, 0x2C, 0xB0, 0xA2, 0x82, 0x55, 0x20, 0x36, 0x3A, 0xD7, 0x3A, 0x71, 0x9D, 0x0C, 0x12, 0x23,
+    0xA5, 0x22, 0x16, 0x01, 0xAB, 0x2F, 0xB3, 0xE4, 0x30, 0x7A, 0x0B, 0xEA, 0xA7, 0xBB, 0xBC, 0x99,
+    0x4C, 0xB5, 0x6F, 0xA5, 0x4C, 0xB9, 0xFD, 0x78, 0xCA, 0x32, 0xB0, 0x5D, 0xE4, 0x1D, 0xB9, 0xC3,
+    0xB2, 0xD2, 0x58, 0x4F, 0x4E, 0x1D, 0x50, 0x22, 0x96, 0x8E, 0x36, 0x54, 0x4B, 0x15, 0x4B, 0x82,
+    0x77, 0x93, 0x5B, 0xED, 0x5C, 0xE2, 0xF9, 0x18, 0xA5, 0x09, 0xDF, 0xC4, 0x66, 0x14, 0xB5, 0x0F,
+    0x1E, 0xA3, 0x04, 0x96, 0x25, 0x41, 0x70, 0xF7, 0xA0, 0xBE, 0x9C, 0xC5, 0xA4, 0xD0, 0x3F, 0x84,
+    0xBE, 0x29, 0x03, 0x05, 0x71, 0xD2, 0x8A, 0x05, 0x21, 0xF4, 0xDE, 0x86, 0x83, 0x98, 0xD9, 0xB0,
+    0x32, 0x5A, 0x52, 0x68, 0xBF, 0xC5, 0x5E, 0xEB, 0xBF, 0x06, 0xB9, 0xEE, 0xE4, 0x08, 0xA9, 0xD7,
+    0x30, 0xE8, 0x99, 0xAE, 0xAD, 0xFE, 0xA2, 0x8B, 0x64, 0xC5, 0xB3, 0xC2, 0x08, 0xEF, 0x82, 0x65,
+    0xC0, 0x0A, 0x6F, 0x0E, 0x17, 0x94, 0xED, 0x2A, 0xB2, 0xE6, 0xC9, 0xD3, 0x71, 0x52, 0x99, 0x4C,
+    0x9C, 0x38, 0x58, 0xBD, 0xC4, 0x71, 0xFB, 0xE1, 0x70, 0x95, 0x5B, 0x84, 0xAF, 0xB3, 0x7C, 0xB3,
+    0x68, 0x35, 0x0F, 0xF6, 0x30, 0xE6, 0x79, 0xD8, 0xD5, 0x2A, 0x56, 0xEB, 0x01, 0xEA, 0xB5, 0x5B,
+    0x73, 0xE5, 0x23, 0x7D, 0xA2, 0xD1, 0xEA, 0x07, 0xC0, 0x13, 0xAA, 0x84, 0x5C, 0x83, 0x23, 0x64,
+    0x59, 0xC0, 0xD0, 0xCD, 0xAE, 0x93, 0xFE, 0x1C, 0xB1, 0xD4, 0x4E, 0x18, 0x99, 0x3D, 0x63, 0xAE,
+    0x4C, 0x26, 0xA7, 0x65, 0xBA, 0x06, 0xD3, 0x7B, 0x8E, 0x31, 0xA2, 0x0A, 0xF4, 0x28, 0xF2, 0xF6,
+    0xB0, 0x10, 0x88, 0xC7, 0x1F, 0xFC, 0x28, 0xAF, 0x72, 0xA8, 0x37, 0xBA, 0xEF, 0x78, 0x62, 0xF0,
+    0x62, 0x36, 0x37, 0xBF, 0x18, 0x76, 0x27, 0x72, 0xFF, 0xF6, 0x94, 0x3B, 0xD7, 0x34, 0xE8, 0x3C,
+    0x00, 0xD5, 0x64, 0x12, 0xDD, 0xAB, 0x00, 0x54, 0x9F, 0xF5, 0x47, 0x73, 0xAE, 0xD0, 0xAA, 0x24,
+    0x18, 0x71, 0x4F, 0x02, 0x93, 0xCC, 0xF8, 0x99, 0xF1, 0x5D, 0x45, 0xEE, 0xC8, 0x54, 0xEA, 0xEF,
+    0xB9, 0xAB, 0xF9, 0xBA, 0xCE, 0xD7, 0x01, 0xA7, 0xBD, 0xAF, 0x79, 0xA2, 0x02, 0x5C, 0x93, 0x90,
+    0xBE, 0x4F, 0x8E, 0x35, 0xA4, 0xFA, 0x08, 0xF7, 0x32, 0xA8, 0x6E, 0xAD, 0xAF, 0x53, 0x3D, 0x55,
+    0x5A, 0xB0, 0x49, 0x84, 0xC5, 0x5A, 0xEC, 0x75, 0x81, 0x1B, 0x7E, 0x86, 0x79, 0x8F, 0xC9, 0x3A,
+    0xC0, 0x64, 0xF8, 0x02, 0x6D, 0xE9, 0x10, 0xBE, 0xF9, 0x29, 0x89, 0xBD, 0x84, 0x8F, 0x15, 0x37,
+    0xDA, 0x4C, 0x0F, 0xC5, 0x9D, 0xBF, 0x39, 0xD0, 0x2E, 0xED, 0xB9, 0x62, 0x19, 0x85, 0x3B, 0x43,
+    0x3F, 0x01, 0x42, 0x6C, 0xFF, 0xD0, 0xF9, 0x07, 0xA3, 0xE5, 0xEC, 0x42, 0xC1, 0xB8, 0xCD, 0x82,
+    0x2D, 0x9F, 0xC9, 0xE9, 0xF8, 0x6E, 0xBD, 0x15, 0xA1, 0x9F, 0xED, 0x85, 0x7E, 0xAF, 0x1C, 0xDE,
+    0xED, 0x0D, 0xBD, 0xDC, 0x4D, 0xAC, 0x0D, 0x84, 0x69, 0x29, 0x16, 0x65, 0x3A, 0xC8, 0x4D, 0x30,
+    0x64, 0xF8, 0x98, 0x0C, 0x7F, 0x04, 0xE8, 0xB6, 0x6B, 0x62, 0x35, 0xD2, 0x6D, 0xBD, 0xED, 0xBD,
+    0x66, 0xF2, 0xDD, 0x81, 0xAD, 0x3F, 0x32, 0x2D, 0x4E, 0x51, 0x56, 0x11, 0x6C, 0x7B, 0x30, 0x75,
+    0x3F, 0xE3, 0xFD, 0xDF, 0xE8, 0xA3, 0xCF, 0xDF, 0x0E, 0x5E, 0xF7, 0x10, 0x9B, 0x89, 0x06, 0x33,
+    0xCB, 0x7A, 0xF1, 0x47, 0x5A, 0x88, 0x3B, 0xE3, 0xE8, 0x79, 0x3A, 0x4B, 0xF5, 0xE8, 0xC2, 0x7B,
+    0x08, 0x72, 0xBF, 0x25, 0xA5, 0x2E, 0x4F, 0x37, 0x7E, 0x84, 0x62, 0xE9, 0x87, 0xA9, 0x41, 0xE2,
+    0xA3, 0xFB, 0xFB, 0x2C, 0x28, 0xCB, 0x42, 0x93, 0xBC, 0x9C, 0xEB, 0x1F, 0x95, 0x55, 0xBF, 0x93,
+    0xD5, 0x44, 0x1C, 0xFF, 0x26, 0xE1, 0x5D, 0x66, 0xC8, 0xE8, 0x5E, 0x21, 0x05, 0xEF, 0xC6, 0x8B,
+    0xC5, 0x15, 0x16, 0x4A, 0x1A, 0x0B, 0x8B, 0xBB, 0xDB, 0x45, 0x66, 0xB4, 0xA0, 0xB9, 0x82, 0x1B,
+    0x0B, 0x1A, 0x0B, 0x2B, 0x2D, 0xCE, 0xC2, 0x82, 0xE2, 0x60, 0x03, 0x16, 0x16, 0x34, 0xAF, 0xB1,
+    0x86, 0x82, 0x42, 0xE1, 0x1F, 0xA0, 0x00, 0x92, 0xE3, 0x15, 0x94, 0xC6, 0x73, 0x1C, 0x4B, 0x22,
+    0xA0, 0xCE, 0x40, 0x41, 0xC6, 0x89, 0xE3, 0x02, 0x9B, 0x7C, 0xFD, 0x7C, 0xF3, 0x1E, 0xEF, 0x50,
+    0x87, 0x19, 0xDC, 0xC9, 0xEE, 0x26, 0xBB, 0xDF, 0xDF, 0xDF, 0xCF, 0xF7, 0x1B, 0xBA, 0x1C, 0xD6,
+    0x74, 0x2E, 0x74, 0xA4, 0xEE, 0x39, 0x0A, 0xD8, 0x11, 0xA5, 0x9E, 0x88, 0x64, 0xCE, 0x47, 0xCA,
+    0xCC, 0x31, 0xE6, 0x3E, 0x66, 0x7B, 0x8B, 0x32, 0x97, 0x99, 0xD4, 0xC7, 0xA5, 0x02, 0x49, 0xD2,
+    0x11, 0xC5, 0x4C, 0x14, 0x0D, 0xD3, 0x50, 0xC8, 0x39, 0x11, 0x97, 0x98, 0x15, 0x51, 0x51, 0x07,
+    0x13, 0xDB, 0x90, 0xD7, 0x0D, 0xD9, 0xCC, 0x91, 0xFE, 0x1E, 0xFC, 0xF7, 0x45, 0x86, 0x65, 0x9E,
+    0x89, 0x0F, 0xF2, 0x55, 0x4A, 0x8D, 0x27, 0xAD, 0x4A, 0xB2, 0x37, 0x85, 0x03, 0x13, 0xE7, 0xCB,
+    0x0B, 0xDD, 0x20, 0x3D, 0x0F, 0x96, 0xE4, 0x69, 0xE1, 0x32, 0x08, 0xBE, 0x0E, 0xA5, 0xA6, 0xA8,
+    0x28, 0x86, 0x5E, 0x5B, 0x0F, 0x6A, 0x75, 0x73, 0x38, 0x64, 0xB3, 0x9B, 0xBA, 0xA8, 0xE1, 0x87,
+    0xC5, 0x54, 0x88, 0x59, 0xBC, 0x10, 0xF1, 0x57, 0x45, 0x40, 0x8E, 0x6F, 0x63, 0x7F, 0xEB, 0xA2,
+    0x3E, 0x68, 0x54, 0x1B, 0x90, 0x2D, 0xE1, 0x26, 0xCC, 0x86, 0x09, 0x69, 0x43, 0xAF, 0xF6, 0x99,
+    0xF4, 0x26, 0x60, 0x2E, 0x21, 0x49, 0xE4, 0xBE, 0x17, 0xB5, 0xAA, 0x49, 0x1B, 0x55, 0x27, 0xF0,
+    0x96, 0xDE, 0x57, 0x3F, 0x74, 0xFA, 0x62, 0x7D, 0x06, 0xAF, 0xA7, 0x28, 0x2B, 0x11, 0x8E, 0xDE,
+    0x67, 0x27, 0x7F, 0xAE, 0x37, 0xD7, 0xC8, 0x8C, 0xCD, 0xD7, 0xFD, 0xB1, 0x82, 0x1F, 0x5D, 0xEC,
+    0xDE, 0x1A, 0x1B, 0xCB, 0x8F, 0x99, 0x0B, 0xAE, 0x97, 0x29, 0xC9, 0x0F, 0xF3, 0x47, 0xBF, 0xB3,
+    0x4F, 0x7B, 0x1A, 0xD1, 0xE1, 0x13, 0xDE, 0xFE, 0xE8, 0x57, 0x0D, 0xF8, 0xB3, 0x0B, 0x4E, 0x4F,
+    0x3D, 0x9E, 0xD5, 0xE3, 0x0F, 0x82, 0x2D, 0xED, 0xFB, 0xC2, 0xE9, 0x4F, 0x37, 0x03, 0xAF, 0xEA,
+    0x38, 0x0F, 0x71, 0xAF, 0xDA, 0xCD, 0xEE, 0xFA, 0xA6, 0xCB, 0x6E, 0x1C, 0xB3, 0x5E, 0xAC, 0xC3,
+    0x78, 0x57, 0x19, 0xAF, 0x93, 0x3F, 0x9C, 0x56, 0x7B, 0xEE, 0x6C, 0xBC, 0x57, 0x1F, 0x0A, 0x68,
+    0x2D, 0xBC, 0x54, 0xDE, 0x2C, 0xD2, 0xAF, 0x9E, 0x35, 0xAA, 0x23, 0x9D, 0xD3, 0x96, 0xD0, 0xED,
+    0xAE, 0x46, 0x8D, 0x4F, 0xEE, 0x3B, 0x35, 0x6D, 0xD2, 0x93, 0x15, 0xB8, 0x96, 0x0F, 0x85, 0x4F,
+    0x42, 0xF6, 0xB6, 0x78, 0x6C, 0xEC, 0x24, 0x40, 0xCA, 0xC2, 0xDC, 0x67, 0x27, 0x1A, 0x1B, 0x37,
+    0xF6, 0x42, 0x3B, 0x8A, 0xBD, 0xDE, 0xF3, 0xE9, 0xED, 0x56, 0x27, 0xB8, 0x19, 0x45, 0x9D, 0x9E,
+    0xB6, 0xFA, 0x03, 0xA7, 0xCA, 0x4D, 0xA2, 0x0D, 0xBD, 0x79, 0x76, 0xF7, 0xCC, 0x17, 0x34, 0x0A,
+    0x7D, 0xBA, 0xE7, 0x75, 0x5C, 0x7D, 0x42, 0x73, 0x1F, 0xC6, 0x66, 0x44, 0xCB, 0xFA, 0xB6, 0x9F,
+    0xF9, 0x70, 0x94, 0x2E, 0x07, 0x93, 0xD4, 0xAD, 0xEF, 0xEE, 0x6E, 0xAC, 0xAF, 0x67, 0xED, 0x52,
+    0x3E, 0x8A, 0x7C, 0x56, 0xF9, 0x74, 0xDA, 0xAC, 0xD1, 0x38, 0xEE, 0xB2, 0xFA, 0x9C, 0xBA, 0xD3,
+    0xBE, 0x0D, 0xD3, 0xE2, 0x2A, 0x33, 0x9A, 0xB4, 0xD1, 0x5E, 0x21, 0x6F, 0x6F, 0xDC, 0x1A, 0xC6,
+    0x11, 0x31, 0xBA, 0x40, 0xF0, 0xCB, 0x88, 0x1B, 0xB5, 0x0F, 0xCC, 0xDD, 0x38, 0x4A, 0x6B, 0x6B,
+    0xB4, 0x52, 0xAA, 0xE2, 0xDA, 0x7D, 0x76, 0xC9, 0x13, 0xDC, 0x8F, 0xE8, 0x44, 0xF7, 0x66, 0xF1,
+    0xEC, 0xD1, 0xDD, 0xEE, 0xCB, 0x2C, 0x97, 0x5C, 0x0F, 0x01, 0xAE, 0xFE, 0xE5, 0x98, 0x8C, 0xA8,
+    0xA2, 0xA4, 0x21, 0x55, 0x23, 0x41, 0xA4, 0x89, 0xDE, 0x11, 0x90, 0x2D, 0x2C, 0x1D, 0xD3, 0xE5,
+    0x1B, 0x49, 0x79, 0x33, 0xE9, 0x74, 0x3E, 0xA3, 0x7E, 0x4D, 0x62, 0x5D, 0xCF, 0x60, 0x4D, 0x45,
+    0x8B, 0xD8, 0xC8, 0x4B, 0x60, 0x16, 0xB0, 0xD4, 0x80, 0xD9, 0x5D, 0x81, 0xF2, 0x0E, 0x73, 0x07,
+    0x30, 0x66, 0xC7, 0xD9, 0xC4, 0x95, 0xAD, 0xA8, 0x4E, 0x41, 0x2D, 0xE8, 0x0C, 0xF8, 0xEA, 0xB7,
+    0x82, 0x5E, 0x83, 0xEA, 0x29, 0xE3, 0x7E, 0x7B, 0x2B, 0x40, 0x79, 0x10, 0x28, 0x08, 0x14, 0x1B,
+    0xA0, 0x48, 0xCF, 0xB3, 0x51, 0xBF, 0x14, 0xCC, 0x7F, 0x41, 0x4E, 0x87, 0x09, 0x15, 0x57, 0x96,
+    0x72, 0xE2, 0x93, 0x28, 0x95, 0x7D, 0x86, 0xB9, 0xD6, 0xD0, 0x56, 0xB0, 0x50, 0x19, 0x3D, 0x27,
+    0xFB, 0x10, 0x13, 0xAA, 0xC2, 0x16, 0x82, 0xCE, 0x42, 0xD0, 0xEB, 0x07, 0x92, 0x9F, 0x5E, 0xCD,
+    0x51, 0xA8, 0x6D, 0x20, 0xF5, 0x65, 0x7F, 0xDD, 0xA6, 0x03, 0x63, 0x4C, 0x04, 0x96, 0xC0, 0xE1,
+    0xA0, 0x5F, 0x01, 0xBF, 0x9D, 0xDB, 0xDF, 0x1C, 0xB8, 0xD3, 0xBF, 0xB0, 0x02, 0x36, 0x60, 0x99,
+    0xAD, 0x7E, 0xBE, 0xD2, 0xA0, 0x66, 0xB1, 0x5E, 0x7B, 0x20, 0x2B, 0xA3, 0xDE, 0x83, 0x41, 0x4E,
+    0xC0, 0xDF, 0x14, 0xD2, 0x3F, 0xD0, 0x1A, 0x64, 0x45, 0x63, 0xC0, 0x1A, 0xF7, 0x83, 0xEA, 0xE7,
+    0x6B, 0xCC, 0x55, 0x24, 0x0A, 0x5C, 0xD4, 0x21, 0x34, 0x6D, 0x3C, 0x34, 0x81, 0x64, 0xA8, 0xD5,
+    0x19, 0x9A, 0x51, 0xD2, 0x44, 0x9F, 0x4B, 0x0F, 0x21, 0xD8, 0x20, 0x07, 0x93, 0xB9, 0xF7, 0x21,
+    0xCE, 0xA2, 0x56, 0x0A, 0x11, 0x99, 0xE1, 0x99, 0x57, 0x34, 0xA1, 0x7F, 0x24, 0x44, 0xFA, 0x4B,
+    0x83, 0x84, 0x78, 0x5C, 0x16, 0xD0, 0x98, 0xE5, 0xB6, 0x8A, 0x91, 0x90, 0xA0, 0x99, 0xC7, 0x60,
+    0x11, 0x7F, 0x7A, 0xE9, 0x41, 0x50, 0x3C, 0x91, 0x48, 0x97, 0x34, 0x8F, 0xCD, 0x67, 0x13, 0xF1,
+    0xAF, 0x25, 0xE4, 0xA9, 0xD4, 0xFD, 0x8E, 0x87, 0x5F, 0xD9, 0x1E, 0x9B, 0xC0, 0x67, 0x35, 0xA9,
+    0x29, 0x98, 0xAE, 0xA0, 0x43, 0xA0, 0x0D, 0x6E, 0x6F, 0x09, 0x89, 0x51, 0xC2, 0xC6, 0x3F, 0x6D,
+    0x53, 0x22, 0xBE, 0xA1, 0x51, 0x0D, 0xDD, 0x71, 0x5D, 0xB7, 0x94, 0xDC, 0xE3, 0x3A, 0xEC, 0x15,
+    0x3F, 0xE4, 0x4A, 0x4B, 0x7F, 0xB2, 0xE2, 0xE0, 0x91, 0x53, 0x44, 0xE3, 0xEF, 0x40, 0xC3, 0x79,
+    0x21, 0x3D, 0xF6, 0xB4, 0xD7, 0x75, 0xDC, 0x40, 0x0C, 0x24, 0x6F, 0xA0, 0x78, 0x49, 0xF7, 0x06,
+    0x94, 0x15, 0x64, 0x37, 0x12, 0x31, 0xB4, 0xE2, 0x06, 0xD4, 0xFB, 0x79, 0xC0, 0x97, 0xF2, 0xA8,
+    0xB7, 0xA4, 0xFE, 0xEC, 0xC9, 0xDE, 0xE1, 0x6B, 0x3D, 0x50, 0x56, 0x67, 0x10, 0x19, 0x6C, 0xCF,
+    0xB1, 0x82, 0x60, 0x2C, 0x71, 0x2E, 0x38, 0x6B, 0xE1, 0xA4, 0xE4, 0xE2, 0xE5, 0xAF, 0x70, 0x5A,
+    0xB3, 0x87, 0xE9, 0x63, 0x73, 0x45, 0x4F, 0x3B, 0x3B, 0xED, 0x50, 0x1A, 0x87, 0x66, 0x7D, 0x43,
+    0x42, 0xEB, 0xF1, 0x40, 0x18, 0xC8, 0x5F, 0xF1, 0x59, 0xE2, 0x07, 0x33, 0xAE, 0x39, 0x3F, 0x1C,
+    0x2C, 0x57, 0x78, 0x22, 0x59, 0x96, 0x6E, 0xFA, 0xBF, 0x36, 0x29, 0xBD, 0xAC, 0x21, 0x00, 0x87,
+    0x8A, 0x12, 0x3F, 0x1F, 0xC4, 0x00, 0xFE, 0x95, 0x94, 0x56, 0x07, 0xD9, 0x97, 0xB2, 0x28, 0x17,
+    0xDB, 0x0A, 0x0F, 0xE0, 0x41, 0x93, 0x16, 0x68, 0x45, 0xCD, 0xCB, 0xB7, 0xB8, 0x51, 0x40, 0xFC,
+    0xB0, 0x71, 0x4D, 0x49, 0xAD, 0xA4, 0x70, 0x54, 0xA5, 0x1C, 0xD2, 0xAC, 0x4A, 0xE5, 0xA0, 0x34,
+    0xC5, 0x06, 0x13, 0x74, 0x2E, 0xDB, 0xB2, 0x35, 0x72, 0xB8, 0xC1, 0xA4, 0x9C, 0xF2, 0xB6, 0x23,
+    0xA0, 0xCD, 0x15, 0x4E, 0x4A, 0xB3, 0xD2, 0x75, 0x24, 0x7A, 0x47, 0xF4, 0xE2, 0x80, 0xEF, 0x99,
+    0x88, 0xE4, 0x7E, 0xF8, 0x75, 0xEC, 0x38, 0xDA, 0xE9, 0x06, 0xB0, 0x89, 0x3B, 0x82, 0x37, 0xC1,
+    0x3A, 0x30, 0xA8, 0xEB, 0x01, 0x86, 0x62, 0xD4, 0xE2, 0x52, 0xAA, 0x71, 0x22, 0x2D, 0x44, 0xAA,
+    0x2C, 0x1D, 0x36, 0x87, 0x46, 0xF2, 0x71, 0x7F, 0x9A, 0x8F, 0x0F, 0x9C, 0xB6, 0x1E, 0x38, 0x95,
+    0x1F, 0x38, 0x43, 0x9E, 0x71, 0xE2, 0x7F, 0x29, 0x97, 0xC5, 0x1E, 0xCA, 0xB1, 0x18, 0x7E, 0xB8,
+    0xB7, 0xC1, 0x59, 0x23, 0xBB, 0x05, 0x73, 0x4E, 0xFF, 0x19, 0x7F, 0x03, 0xC5, 0x55, 0xB1, 0x8E,
+    0xDD, 0x44, 0x14, 0xBD, 0xB6, 0xB5, 0x6B, 0x11, 0x17, 0xD3, 0xB0, 0x12, 0x0A, 0x85, 0xBF, 0x00,
+    0xF9, 0x0B, 0xD0, 0x78, 0x85, 0x44, 0x43, 0xC1, 0x16, 0x59, 0xF1, 0x0F, 0x34, 0xAF, 0xA5, 0x1B,
+    0x47, 0x94, 0x29, 0x48, 0x41, 0xC4, 0x0F, 0xA4, 0x40, 0xA4, 0xD8, 0x96, 0x02, 0x34, 0x46, 0xF9,
+    0x00, 0x1C, 0x7E, 0x80, 0x59, 0x25, 0x14, 0x54, 0x99, 0xC2, 0x11, 0x5E, 0x32, 0xF6, 0xCD, 0x39,
+    0xF3, 0x76, 0x1F, 0x1B, 0x09, 0x2A, 0x90, 0x18, 0xE9, 0x8D, 0xAD, 0xEB, 0x3B, 0xF7, 0x9E, 0xB9,
+    0xF7, 0xDC, 0xF3, 0x44, 0xF2, 0x52, 0xAC, 0x45, 0x2A, 0x3E, 0x82, 0x18, 0x3E, 0x7A, 0xB1, 0x85,
+    0xF6, 0xAB, 0x48, 0xAA, 0xD7, 0x2A, 0x4A, 0x15, 0xDB, 0xD9, 0x8C, 0xF0, 0x74, 0x13, 0xFD, 0xF1,
+    0x89, 0x8F, 0x7A, 0xFD, 0xFC, 0x05, 0x1E, 0xAD, 0xEA, 0xCA, 0x4F, 0xF9, 0x51, 0xE8, 0x6F, 0x2E,
+    0xF1, 0x93, 0xD8, 0x88, 0x4F, 0xB3, 0xF8, 0x89, 0xA7, 0x78, 0x02, 0x3F, 0x98, 0xF9, 0x09, 0x66,
+    0x71, 0xAB, 0xF8, 0x2B, 0x24, 0xDB, 0x5A, 0x4D, 0x38, 0x3B, 0x7B, 0x8D, 0x72, 0xBD, 0xEE, 0x70,
+    0x6B, 0x99, 0xAE, 0x83, 0xA3, 0xD8, 0xC4, 0x37, 0x66, 0x3A, 0xEE, 0xE5, 0xB0, 0x8A, 0x87, 0x56,
+    0x53, 0xB5, 0x19, 0x5D, 0x4B, 0x1D, 0x77, 0x4B, 0xA1, 0xB1, 0x4E, 0xA2, 0xDF, 0x17, 0x2A, 0xAE,
+    0x17, 0x37, 0xDA, 0x41, 0xDA, 0x88, 0x18, 0x75, 0x32, 0x13, 0x32, 0x5F, 0x04, 0x02, 0x4C, 0x19,
+    0xEC, 0x00, 0x63, 0x1B, 0x61, 0xAC, 0x14, 0xC6, 0xD1, 0x05, 0x78, 0x9A, 0x04, 0x63, 0xA1, 0x23,
+    0x8E, 0xDB, 0x54, 0xF8, 0xA5, 0xD2, 0x2F, 0xE1, 0xE8, 0x16, 0x14, 0xA4, 0xC1, 0x01, 0x91, 0x93,
+    0x9B, 0xBC, 0x75, 0xDE, 0xED, 0x90, 0xEB, 0x46, 0x8C, 0xA5, 0xB2, 0x26, 0x85, 0xE7, 0xBB, 0x1C,
+    0xC9, 0xED, 0x85, 0x8A, 0x8E, 0xAA, 0x2F, 0x75, 0xC3, 0xCB, 0xC7, 0x3A, 0x14, 0x3A, 0x01, 0x63,
+    0xA9, 0xC8, 0x27, 0x48, 0xE8, 0x46, 0xD1, 0x88, 0x84, 0x46, 0x47, 0x42, 0xA7, 0xD9, 0xBC, 0xA6,
+    0x79, 0xEB, 0x60, 0x36, 0xC1, 0x8F, 0xF5, 0xBA, 0xD1, 0x1B, 0x18, 0x60, 0xDE, 0x84, 0xE6, 0x20,
+    0x30, 0x6F, 0xD7, 0x41, 0x1A, 0x40, 0x7D, 0x21, 0xEE, 0x0A, 0x95, 0x40, 0x21, 0x81, 0xD5, 0xA2,
+    0x8D, 0x77, 0xE4, 0x3D, 0x91, 0x26, 0xB4, 0x83, 0x94, 0xA9, 0xC1, 0xB5, 0xED, 0x4B, 0x14, 0xB1,
+    0x56, 0x56, 0xF2, 0xA8, 0xBF, 0x8D, 0x0E, 0x15, 0x77, 0x00, 0xB7, 0xB4, 0x7A, 0x99, 0xC3, 0xB6,
+    0x8B, 0x74, 0x23, 0x6A, 0x62, 0x82, 0xD8, 0xD0, 0x30, 0x7A, 0x85, 0x43, 0x7A, 0x8A, 0xAA, 0x75,
+    0x01, 0x8D, 0xAB, 0x92, 0xE3, 0x29, 0x8F, 0x20, 0x86, 0x37, 0x2F, 0xF3, 0xF5, 0x2D, 0x52, 0x08,
+    0xBC, 0xA5, 0xA8, 0x16, 0xF8, 0xFC, 0x92, 0xC8, 0x81, 0xCC, 0x07, 0x6E, 0x86, 0x9B, 0xDC, 0x3B,
+    0xE4, 0x04, 0xB9, 0x32, 0xBF, 0x82, 0xEA, 0xA5, 0x0F, 0xB8, 0x0E, 0xD8, 0x80, 0xCB, 0x83, 0x56,
+    0x6E, 0xFC, 0xF7, 0xAF, 0xEF, 0x33, 0xF4, 0x57, 0x7A, 0x58, 0x81, 0x5F, 0x88, 0x91, 0x40, 0x09,
+    0x0F, 0x37, 0x61, 0x09, 0xCA, 0x4C, 0x35, 0x73, 0x9B, 0x4C, 0xDC, 0x5D, 0x76, 0xD3, 0xCC, 0xBE,
+    0x2D, 0xF7, 0x37, 0x65, 0x03, 0x4B, 0xD7, 0x39, 0xDE, 0x33, 0xB1, 0xCB, 0x75, 0x20, 0xFD, 0xED,
+    0x47, 0x70, 0x2C, 0x12, 0x3A, 0x83, 0x82, 0x19, 0xB8, 0xD8, 0x47, 0x2E, 0xA2, 0x26, 0x68, 0x79,
+    0x1E, 0xA1, 0x41, 0xDC, 0xF9, 0x67, 0x8A, 0xA2, 0x49, 0x03, 0xC2, 0x4F, 0x62, 0x40, 0xD1, 0x87,
+    0xE8, 0x55, 0xA7, 0x13, 0x18, 0x8F, 0x09, 0x73, 0x7B, 0xC2, 0x5B, 0xF8, 0xFE, 0x8C, 0x5F, 0xDC,
+    0xA9, 0x62, 0xD8, 0xC4, 0x63, 0x4C, 0xDA, 0xC1, 0x4D, 0xD5, 0x84, 0x29, 0x39, 0xAB, 0xF3, 0x48,
+    0xF1, 0x20, 0x22, 0xB6, 0xD9, 0xA3, 0xD4, 0x53, 0xED, 0x6D, 0x74, 0x53, 0x93, 0xDA, 0xB9, 0x54,
+    0x78, 0xE8, 0x7D, 0xED, 0xFD, 0x33, 0xAF, 0xFA, 0x7C, 0x5F, 0xD9, 0x4C, 0x58, 0xAC, 0xF3, 0x7B,
+    0x8C, 0x3E, 0x13, 0x4D, 0xBF, 0x7B, 0xE5, 0x31, 0x20, 0xD5, 0x0A, 0xBE, 0xF9, 0xC1, 0x8D, 0xDD,
+    0xD4, 0xC6, 0x86, 0x06, 0x90, 0x3E, 0xCF, 0x5F, 0x8E, 0xBE, 0xC0, 0x80, 0xE8, 0xE8, 0xA9, 0x1B,
+    0x11, 0x3D, 0x96, 0x1B, 0x89, 0x79, 0x5F, 0x45, 0x7F, 0xBA, 0x8E, 0x3E, 0x65, 0x6D, 0xB8, 0x59,
+    0x7F, 0x87, 0xBD, 0x03, 0xF6, 0x3A, 0xB4, 0x73, 0x11, 0xF7, 0xD8, 0xFB, 0xBD, 0x68, 0x70, 0xE4,
+    0xFF, 0xD1, 0x50, 0x40, 0x09, 0x38, 0x2B, 0x18, 0x82, 0x83, 0x08, 0xB0, 0x92, 0x3A, 0x34, 0x4A,
+    0x55, 0x39, 0xD6, 0x27, 0xF0, 0xAA, 0xE6, 0x5C, 0xEC, 0xA9, 0x83, 0x8F, 0xED, 0xD9, 0x09, 0xD4,
+    0x02, 0xFD, 0x89, 0x34, 0xB7, 0x23, 0xCD, 0x0E, 0x34, 0x96, 0x72, 0xA1, 0xD9, 0x4C, 0x34, 0x5B,
+    0x0C, 0x0D, 0xBA, 0x44, 0xB3, 0x09, 0x34, 0x3B, 0xD0, 0x9A, 0x4D, 0xC1, 0x2C, 0xF9, 0xED, 0x89,
+    0xFE, 0xDE, 0x31, 0xCD, 0xEA, 0xB9, 0xBF, 0x62, 0xE7, 0xED, 0x53, 0xD2, 0x44, 0x21, 0x1A, 0x18,
+    0x1F, 0xCB, 0x79, 0x0F, 0x3F, 0x90, 0x2B, 0xA7, 0x1C, 0xF2, 0x0F, 0x0E, 0xB7, 0xFE, 0x15, 0xBF,
+    0x19, 0xB7, 0x5E, 0x71, 0x85, 0x0E, 0xFD, 0xA8, 0x27, 0xDC, 0x29, 0xFC, 0x75, 0xA7, 0xEF, 0xBE,
+    0x65, 0x4D, 0x7B, 0xD4, 0x14, 0xD3, 0x7A, 0x7E, 0x76, 0xFB, 0xD6, 0x1F, 0x52, 0x00, 0xD1, 0x31,
+    0x73, 0x89, 0xAC, 0x7F, 0x30, 0x3B, 0x93, 0x5F, 0x53, 0xF0, 0xB8, 0xA7, 0x0C, 0xE9, 0x68, 0x83,
+    0x51, 0x54, 0x60, 0xF0, 0xD1, 0xA0, 0x77, 0x54, 0xB7, 0xC6, 0x8F, 0x26, 0x56, 0x5B, 0x20, 0xDB,
+    0x62, 0xCD, 0x44, 0xD1, 0x44, 0x8C, 0x2A, 0x78, 0x6D, 0x62, 0x16, 0xCB, 0x64, 0xA2, 0x65, 0x6F,
+    0xFC, 0xC5, 0x9F, 0xDB, 0x8D, 0xAA, 0x67, 0xB1, 0xDE, 0x33, 0x02, 0x5A, 0x19, 0xC9, 0x70, 0x43,
+    0x3F, 0x6A, 0x33, 0xCF, 0xE1, 0xB2, 0x96, 0x71, 0x00, 0x5A, 0x19, 0x57, 0x39, 0xD5, 0xC8, 0xA3,
+    0x63, 0x83, 0x56, 0x6E, 0x30, 0x76, 0x5B, 0x99, 0x95, 0xD0, 0x41, 0x13, 0x41, 0x92, 0x6D, 0xAF,
+    0x21, 0xC5, 0x99, 0xDC, 0x7D, 0x8C, 0xBE, 0x69, 0x64, 0x9F, 0xC4, 0x3F, 0xF2, 0xC1, 0x0E, 0x88,
+    0x0C, 0xA1, 0xC7, 0x70, 0xB9, 0xF1, 0x5D, 0x48, 0x06, 0x52, 0x45, 0xB9, 0x7B, 0x31, 0x43, 0x7C,
+    0x18, 0x1E, 0xD3, 0x78, 0xB4, 0xCB, 0xC5, 0x19, 0x99, 0xF4, 0x0B, 0x00, 0x71, 0xE8, 0xBA, 0x45,
+    0x84, 0x4F, 0xF4, 0x1B, 0x0A, 0x25, 0x93, 0xA2, 0x50, 0x27, 0x5F, 0xFF, 0x9F, 0xF2, 0x59, 0xF6,
+    0xEF, 0xB0, 0xC7, 0xFD, 0x8F, 0xD8, 0x37, 0x0A, 0x60, 0xA1, 0x3E, 0x8B, 0x5D, 0x56, 0xB2, 0x93,
+    0xB7, 0xF4, 0x9D, 0x7C, 0xB5, 0xFA, 0x1A, 0x75, 0x51, 0x7D, 0xE6, 0x83, 0xB8, 0x19, 0x78, 0x98,
+    0x21, 0x51, 0x46, 0x90, 0xC1, 0x12, 0x4F, 0x95, 0x61, 0x5A, 0xC2, 0xAC, 0x36, 0x9A, 0xED, 0x03,
+    0x98, 0x9F, 0x2E, 0xC4, 0xE3, 0x06, 0x78, 0xEB, 0x92, 0x61, 0x0E, 0x84, 0xB9, 0x64, 0x98, 0xC3,
+    0x3E, 0x08, 0xCC, 0xBB, 0x2B, 0x68, 0xD1, 0xA7, 0x8A, 0xFF, 0x2A, 0xF5, 0xBA, 0x00, 0xA6, 0xFC,
+    0x97, 0xEB, 0x0D, 0xBD, 0x55, 0x3D, 0x8F, 0xE4, 0x44, 0x10, 0x2D, 0xBB, 0xA5, 0xB5, 0xD0, 0x04,
+    0xBD, 0xC9, 0x45, 0x2B, 0xE4, 0x9C, 0xC4, 0x3F, 0xA1, 0x9D, 0x11, 0x90, 0x90, 0x2C, 0x01, 0x09,
+    0x09, 0x11, 0xC9, 0xFE, 0x83, 0x6B, 0x0B, 0x24, 0x48, 0xEF, 0x27, 0x10, 0x90, 0xB0, 0x17, 0x4C,
+    0x4A, 0xC2, 0x75, 0xA3, 0x0D, 0x26, 0x3C, 0x4B, 0x27, 0x41, 0x40, 0xB0, 0x83, 0x44, 0x42, 0xB4,
+    0x3E, 0xC9, 0x82, 0xDE, 0xA1, 0xED, 0xC7, 0xAB, 0xDE, 0xD9, 0xFB, 0x42, 0x04, 0x9C, 0x10, 0x2D,
+    0x4D, 0xBB, 0xA6, 0xA6, 0xBA, 0xFD, 0xEA, 0xD5, 0xAB, 0x1A, 0x11, 0xA9, 0x1E, 0x39, 0x64, 0xB3,
+    0x5A, 0x2C, 0x35, 0xE2, 0x45, 0xAA, 0x30, 0x35, 0x59, 0xF0, 0x5D, 0x05, 0xF1, 0xBD, 0xF8, 0xE8,
+    0x06, 0x69, 0xA7, 0x36, 0x4A, 0x93, 0xED, 0x28, 0x15, 0xB6, 0x7B, 0x11, 0x8F, 0x2C, 0xD2, 0x02,
+    0x03, 0x9D, 0xED, 0x44, 0xA7, 0x01, 0x9D, 0xD1, 0xEF, 0x19, 0x69, 0x33, 0x9D, 0x15, 0x22, 0x8F,
+    0xBB, 0x5C, 0x85, 0x64, 0xF0, 0x05, 0x03, 0x7D, 0x02, 0xF6, 0x1B, 0x1E, 0x10, 0x79, 0x20, 0x77,
+    0xCB, 0x02, 0x58, 0x84, 0x1B, 0x63, 0x03, 0x30, 0x8A, 0x99, 0x79, 0x56, 0x9C, 0x20, 0x8A, 0x99,
+    0xDE, 0x30, 0xBD, 0x9A, 0x4D, 0x31, 0x9F, 0xA8, 0x69, 0x47, 0x35, 0xB3, 0x9A, 0x6D, 0xA4, 0x69,
+    0x12, 0xCD, 0x53, 0xDF, 0xDB, 0x6C, 0xAE, 0x27, 0x9A, 0x7E, 0x91, 0x6E, 0xFD, 0x00, 0x43, 0x87,
+    0xC5, 0xED, 0x0D, 0x6F, 0xFF, 0x50, 0x5E, 0xAE, 0x16, 0x7B, 0x09, 0xE8, 0x3D, 0xA2, 0x21, 0x82,
+    0x0E, 0x84, 0x32, 0x08, 0x4F, 0x84, 0x45, 0x6A, 0x10, 0xF0, 0x2C, 0x9B, 0x9B, 0xC9, 0xDE, 0xEC,
+    0xC5, 0xF9, 0xF1, 0x61, 0x18, 0x64, 0xF1, 0x9F, 0x3F, 0x5F, 0x09, 0x04, 0x76, 0x97, 0xC5, 0x5E,
+    0xE5, 0x87, 0xCC, 0xD9, 0x6D, 0x7E, 0x9F, 0x5D, 0xAC, 0xB2, 0xBD, 0x89, 0x20, 0x30, 0xB7, 0x9A,
+    0x2C, 0x5D, 0x0C, 0xB3, 0x9D, 0x25, 0xF0, 0xFD, 0x6E, 0x34, 0xC9, 0xAC, 0x82, 0xDE, 0xEE, 0x9B,
+    0x99, 0x86, 0x1F, 0x6D, 0x6C, 0x49, 0xF1, 0x74, 0x4A, 0x30, 0x5E, 0x13, 0x50, 0x0A, 0xB9, 0xF8,
+    0x35, 0x2A, 0x07, 0x2B, 0x8D, 0x2F, 0x31, 0x54, 0xD8, 0x37, 0x0B, 0x09, 0xED, 0xDB, 0x59, 0x68,
+    0xF8, 0x51, 0xDA, 0x99, 0xDF, 0x68, 0x1C, 0xDD, 0x87, 0xCB, 0x2D, 0xDD, 0x3C, 0x40, 0x37, 0xD7,
+    0xD8, 0xAC, 0xE7, 0x1F, 0xFD, 0x73, 0xB4, 0xBA, 0x59, 0x03, 0xF1, 0x2B, 0x4B, 0xAC, 0x84, 0x63,
+    0x72, 0xFA, 0xE2, 0xCF, 0x1E, 0x89, 0x34, 0x5A, 0xBF, 0x8D, 0xD6, 0xC0, 0xE2, 0x31, 0xC6, 0xCD,
+    0xC2, 0x7A, 0xF1, 0x98, 0xD6, 0x8B, 0x7C, 0x4F, 0xBC, 0xC6, 0x66, 0xDE, 0x58, 0xE3, 0x62, 0x12,
+    0x09, 0x3F, 0xF3, 0x54, 0xF7, 0x07, 0x7F, 0x69, 0x16, 0xA2, 0xA7, 0x73, 0xA6, 0x73, 0xB7, 0xB2,
+    0x48, 0x93, 0x66, 0x33, 0xBB, 0xC4, 0xF0, 0x06, 0xC3, 0x26, 0x93, 0x5A, 0x12, 0x59, 0x2E, 0x26,
+    0xB7, 0x89, 0x39, 0x9E, 0xF7, 0x47, 0xE2, 0x8D, 0x22, 0xC0, 0xD3, 0xB2, 0x9F, 0xE0, 0xB0, 0x85,
+    0xE2, 0x24, 0x3B, 0xC4, 0x69, 0x93, 0xC2, 0x77, 0x7B, 0x85, 0x8F, 0xE1, 0xAD, 0xDD, 0x9A, 0x6C,
+    0xB8, 0x65, 0x8E, 0x2D, 0x32, 0x93, 0x0D, 0x98, 0xE4, 0xFC, 0x5C, 0x1C, 0x90, 0x34, 0xFB, 0x78,
+    0x71, 0x40, 0x6E, 0xB2, 0x81, 0x6A, 0x7B, 0xF4, 0xD1, 0xCE, 0xED, 0x64, 0x16, 0x95, 0x2B, 0x1D,
+    0x14, 0xCD, 0x8F, 0x88, 0xAD, 0x72, 0x0A, 0x2D, 0xC4, 0xB7, 0x2A, 0x69, 0x8A, 0x85, 0xD9, 0xB3,
+    0x1F, 0x48, 0x27, 0x3F, 0xE1, 0xB7, 0x52, 0x30, 0xAA, 0x76, 0xD2, 0x7C, 0x48, 0x23, 0x63, 0x23,
+    0xAF, 0x9E, 0xC9, 0xE1, 0xA2, 0x14, 0xBE, 0x4F, 0x3A, 0x9F, 0x41, 0x6A, 0xE5, 0xEF, 0x54, 0xCF,
+    0x77, 0x8C, 0x24, 0x29, 0xA2, 0x2D, 0xA2, 0x72, 0x95, 0x8E, 0xCC, 0x6D, 0x56, 0xBD, 0x70, 0x24,
+    0x7B, 0x8B, 0x16, 0xE2, 0xF6, 0x63, 0x22, 0x45, 0x2E, 0x9C, 0x75, 0xCA, 0xDB, 0x83, 0xA3, 0x5C,
+    0x9D, 0x32, 0xF5, 0xCA, 0xD6, 0x63, 0x78, 0xC2, 0xAE, 0xB8, 0xDB, 0xBE, 0x7F, 0x87, 0xDB, 0xA7,
+    0xBC, 0x54, 0xBB, 0xEA, 0xDF, 0x6C, 0x27, 0xF8, 0x55, 0xAF, 0x5E, 0x8E, 0x9B, 0xAE, 0x4E, 0x19,
+    0xFB, 0x13, 0x6B, 0x83, 0xE4, 0x13, 0x31, 0x37, 0xAB, 0x6C, 0xB4, 0x8F, 0xD8, 0x57, 0x36, 0xD5,
+    0x99, 0x05, 0x17, 0x0D, 0x1F, 0x3D, 0xB1, 0x27, 0xC7, 0x7A, 0xA2, 0xD5, 0x54, 0x6E, 0x46, 0x4D,
+    0x4C, 0xB9, 0x08, 0xBA, 0x59, 0xAD, 0x76, 0xAD, 0xC2, 0xEE, 0x99, 0xA0, 0xCC, 0x41, 0x74, 0x56,
+    0xF4, 0xDA, 0x71, 0xBD, 0x06, 0xF6, 0x2F, 0xDA, 0xDF, 0x96, 0x17, 0x6B, 0xD7, 0x13, 0x0D, 0x27,
+    0x4A, 0xA1, 0x98, 0x28, 0x08, 0x8F, 0x1B, 0x86, 0x76, 0x0D, 0xD7, 0x30, 0x2B, 0xC7, 0x4B, 0x0A,
+    0xD1, 0xC7, 0xF0, 0x34, 0xB1, 0x6C, 0x0B, 0x7B, 0x36, 0xBA, 0xEB, 0x62, 0xAA, 0xD7, 0xEF, 0x58,
+    0x3B, 0x9B, 0x5C, 0xF2, 0x3B, 0x50, 0x75, 0x3A, 0x48, 0xB8, 0x51, 0xDA, 0x67, 0x25, 0x2B, 0x65,
+    0x5F, 0x2E, 0xF4, 0x15, 0x16, 0x0A, 0xE7, 0xF2, 0x72, 0xB8, 0x4B, 0xB6, 0x06, 0xAE, 0x38, 0x17,
+    0x90, 0x1C, 0x6B, 0x9E, 0x55, 0x49, 0x18, 0xD9, 0xB7, 0x0D, 0x6A, 0x95, 0x6C, 0xF2, 0x0C, 0x0B,
+    0x9C, 0x22, 0x04, 0x9C, 0x0B, 0x54, 0x79, 0x91, 0x9F, 0x66, 0x50, 0x17, 0xE8, 0x5E, 0x1D, 0xF6,
+    0x17, 0xE2, 0x35, 0x59, 0xAB, 0x89, 0xDE, 0xCD, 0xD2, 0x51, 0x90, 0x71, 0xB3, 0xF6, 0x2D, 0xBE,
+    0x02, 0x9B, 0x1D, 0x01, 0xE3, 0x51, 0x29, 0x2A, 0x9B, 0x2B, 0x95, 0x3E, 0xDD, 0xEB, 0x09, 0x25,
+    0x5B, 0x54, 0xCB, 0xA4, 0xA9, 0x5A, 0x2A, 0x8C, 0x10, 0x3C, 0xC1, 0xF7, 0x14, 0xD9, 0x5B, 0xBB,
+    0x75, 0x88, 0xE2, 0xB6, 0xE8, 0x64, 0x2D, 0x1D, 0x96, 0x8A, 0x82, 0xC6, 0x82, 0x5E, 0xB7, 0xAA,
+    0x4C, 0x1C, 0x53, 0xF0, 0xD8, 0x42, 0xC5, 0xBB, 0x77, 0x7C, 0x50, 0xC3, 0xAC, 0x87, 0xC7, 0x04,
+    0xFC, 0x10, 0xE6, 0x1A, 0x23, 0xB5, 0xCA, 0x99, 0xEA, 0x8A, 0x00, 0xDE, 0x34, 0x3B, 0x9D, 0xB4,
+    0x15, 0x6E, 0xB7, 0xB9, 0x4C, 0xF0, 0xA8, 0xF5, 0xE2, 0xC5, 0xEF, 0x7D, 0xA3, 0xDA, 0xD6, 0x80,
+    0xA3, 0xCC, 0x5F, 0x35, 0xBB, 0xB5, 0x68, 0x60, 0x51, 0xD1, 0x63, 0x7C, 0x39, 0x0C, 0x3E, 0x41,
+    0x52, 0x4E, 0xB2, 0xC7, 0x33, 0x1D, 0x08, 0xC3, 0x45, 0xE2, 0xCB, 0x99, 0x0F, 0xA7, 0xE7, 0xAA,
+    0x89, 0x72, 0x7C, 0xB2, 0xD1, 0xA3, 0x59, 0x4A, 0xAB, 0x73, 0xCA, 0x68, 0xB3, 0xFF, 0x97, 0x3F,
+    0x93, 0xB3, 0xC7, 0xD8, 0x1E, 0x59, 0x83, 0x8E, 0x8C, 0xB2, 0xA6, 0xFB, 0x7F, 0x0A, 0xE0, 0x27,
+    0x70, 0x74, 0x92, 0x98, 0x9D, 0x0A, 0x66, 0x3A, 0x5B, 0xAB, 0xC0, 0xBF, 0xB1, 0xFE, 0xFE, 0x9A,
+    0xFF, 0xEB, 0x79, 0x86, 0x43, 0x38, 0x00, 0x5F, 0xE3, 0x75, 0x9C, 0xF9, 0x58, 0xBF, 0xE3, 0xD3,
+    0xA4, 0xE3, 0x73, 0x7E, 0xFD, 0x59, 0xDF, 0xE7, 0x33, 0xC9, 0xDF, 0xD6, 0x5F, 0x85, 0x55, 0xBD,
+    0x8E, 0xDD, 0x44, 0x14, 0x3E, 0xB6, 0xB9, 0x6B, 0x21, 0x17, 0x93, 0x22, 0x89, 0x44, 0x56, 0xC2,
+    0x8F, 0xE0, 0x9E, 0x66, 0x4C, 0xB6, 0x4C, 0xC1, 0x2D, 0x58, 0x90, 0xD8, 0x82, 0x47, 0xE0, 0x0D,
+    0x62, 0x87, 0x14, 0x94, 0xD9, 0x02, 0xD1, 0xD0, 0x50, 0xD0, 0x40, 0x5E, 0x21, 0xCB, 0xCC, 0xEE,
+    0x3E, 0x40, 0x1C, 0xA1, 0x28, 0x05, 0xCD, 0x48, 0x01, 0x25, 0xDA, 0x2D, 0xEE, 0xA0, 0x8C, 0x90,
+    0x37, 0x19, 0xFB, 0xF0, 0x9D, 0xF1, 0xDE, 0x25, 0x69, 0x82, 0xA5, 0x7B, 0x66, 0xEE, 0xFC, 0x9C,
+    0x9F, 0xEF, 0x7C, 0xE7, 0x0C, 0x11, 0xBE, 0x82, 0x99, 0x2D, 0x69, 0xE6, 0x28, 0xD3, 0x89, 0x48,
+    0xB7, 0xDC, 0x53, 0xE1, 0xD5, 0x88, 0x29, 0x61, 0x4A, 0x87, 0x32, 0xA5, 0x34, 0x25, 0xC5, 0xB3,
+    0x4C, 0x45, 0x2A, 0xB9, 0x82, 0x55, 0x33, 0x90, 0x1A, 0x8B, 0x59, 0xA6, 0x8D, 0xC7, 0x34, 0x67,
+    0x99, 0x6A, 0x87, 0xA9, 0x8A, 0x94, 0x43, 0x7D, 0x2F, 0xC2, 0x51, 0xC3, 0x3C, 0xD0, 0xDB, 0x1F,
+    0xB3, 0xA7, 0x9A, 0x27, 0xD9, 0xC3, 0xB0, 0x0B, 0x15, 0x3B, 0x3C, 0x94, 0x93, 0xEC, 0xD8, 0xF7,
+    0x0E, 0x3C, 0xB7, 0x69, 0xE0, 0xB0, 0x0C, 0x73, 0xDA, 0x2B, 0x78, 0x39, 0xC2, 0xED, 0x32, 0xF4,
+    0xEF, 0x0C, 0x69, 0xB1, 0x94, 0x23, 0xBB, 0x08, 0x33, 0xE3, 0x3F, 0xE1, 0x53, 0xA8, 0x79, 0xC6,
+    0xED, 0xB6, 0x96, 0xB8, 0xAF, 0x3E, 0x8D, 0xB8, 0x52, 0x9C, 0xDF, 0x20, 0x6E, 0x31, 0x99, 0x71,
+    0x4B, 0xD4, 0xC1, 0xF7, 0x3A, 0x6C, 0x17, 0xE0, 0x72, 0x87, 0xC0, 0x6A, 0x60, 0x50, 0x4E, 0x39,
+    0xDF, 0xE3, 0x56, 0xFB, 0x6E, 0xA8, 0x62, 0x1D, 0x72, 0x16, 0x6B, 0x58, 0x30, 0x4F, 0x0C, 0xF3,
+    0x73, 0x89, 0x5C, 0x20, 0x58, 0x54, 0x7F, 0xF5, 0x33, 0x91, 0x81, 0x31, 0xC0, 0x3D, 0x16, 0xFC,
+    0x23, 0x3B, 0xDD, 0x97, 0x5C, 0x00, 0x85, 0x51, 0x23, 0xB0, 0xE3, 0x9F, 0x92, 0x76, 0xD2, 0x2E,
+    0xFB, 0xF5, 0xE1, 0x0C, 0x4C, 0x60, 0x45, 0x82, 0xCB, 0xF6, 0x3B, 0xB7, 0x18, 0x26, 0x73, 0x02,
+    0xB4, 0x63, 0x07, 0x58, 0x3F, 0x1B, 0xC9, 0x38, 0xF3, 0xDA, 0xC4, 0x42, 0x8E, 0x54, 0x0C, 0x1F,
+    0x57, 0xFB, 0x8B, 0x95, 0x9D, 0x5F, 0x24, 0x39, 0xB8, 0x0F, 0x5C, 0xD8, 0x61, 0x2B, 0x66, 0xC6,
+    0xE5, 0x7C, 0xCE, 0xBE, 0x8C, 0xD4, 0xB9, 0x82, 0xFB, 0xCE, 0x22, 0xA7, 0x75, 0x2C, 0xA3, 0x84,
+    0xC6, 0x43, 0x67, 0x91, 0xB9, 0x72, 0x2E, 0xA1, 0x0B, 0xD6, 0x7D, 0x77, 0x66, 0x1C, 0xC8, 0x90,
+    0x80, 0x95, 0xBF, 0xE2, 0x07, 0xFE, 0x4E, 0x5F, 0xCA, 0xAE, 0xEB, 0xAC, 0xF6, 0x54, 0x5C, 0x1E,
+    0xEE, 0xE4, 0xEE, 0x48, 0x55, 0x52, 0x65, 0x81, 0x32, 0x34, 0x33, 0xEE, 0xEC, 0x82, 0x01, 0x6C,
+    0x22, 0xDC, 0x00, 0x56, 0x2C, 0x6E, 0xE4, 0xE2, 0x21, 0xBE, 0x6C, 0x7F, 0x8B, 0xF3, 0x8E, 0xE8,
+    0xD7, 0xC2, 0x39, 0x7E, 0x2D, 0xFB, 0xB8, 0x0B, 0x1A, 0x41, 0x4C, 0x57, 0x42, 0xFE, 0xA6, 0x0D,
+    0x1C, 0x31, 0x56, 0x18, 0x64, 0xA9, 0x14, 0xA1, 0x02, 0xD6, 0x1A, 0x0F, 0x21, 0x1E, 0x20, 0xA9,
+    0x38, 0x2C, 0xE7, 0xAA, 0x19, 0x99, 0xD5, 0xB0, 0x3B, 0x77, 0x0E, 0x62, 0x95, 0x0C, 0xDD, 0x5C,
+    0x03, 0xAF, 0x49, 0xF0, 0x24, 0xFD, 0x17, 0x1C, 0xEB, 0x8D, 0x6D, 0x44, 0x27, 0x94, 0xD3, 0xAD,
+    0x44, 0x20, 0x2B, 0x9A, 0x45, 0x93, 0x01, 0x34, 0xA0, 0xB4, 0x35, 0xE7, 0xFC, 0x12, 0x71, 0x4F,
+    0xF5, 0x5C, 0x87, 0x6C, 0x9D, 0x89, 0xE7, 0x1F, 0x10, 0xDD, 0x78, 0x04, 0x17, 0x22, 0xA5, 0xE4,
+    0xB1, 0xAF, 0xC2, 0xAA, 0xAD, 0x91, 0x98, 0x06, 0xCC, 0xD0, 0xC7, 0x6B, 0xEA, 0x36, 0x48, 0x3A,
+    0x38, 0x0E, 0x57, 0x3D, 0xDB, 0x7A, 0xE4, 0x5E, 0x45, 0xEE, 0x2B, 0xFC, 0xCA, 0x08, 0x2B, 0xD1,
+    0xD8, 0x2A, 0x76, 0x83, 0x8A, 0xDA, 0xD7, 0xA1, 0x9E, 0x8D, 0x24, 0xC6, 0x66, 0xC2, 0xBC, 0x55,
+    0x0B, 0x54, 0xD6, 0x52, 0x7D, 0xC0, 0x6B, 0x2A, 0x63, 0x15, 0x95, 0x57, 0x5E, 0x5B, 0x6D, 0x99,
+    0x66, 0x2C, 0x23, 0x12, 0x1E, 0xF4, 0x53, 0x33, 0x30, 0x99, 0xFB, 0xC0, 0x59, 0xF9, 0x6A, 0xC4,
+    0xDF, 0x3F, 0x80, 0x9F, 0xBE, 0xA2, 0x96, 0xA4, 0x1C, 0x64, 0xE6, 0x27, 0x7C, 0x36, 0xA1, 0xF2,
+    0x06, 0xEE, 0x1F, 0xA9, 0xB1, 0x42, 0x30, 0xD7, 0xA4, 0x7C, 0x71, 0xEA, 0xED, 0x61, 0x00, 0x0B,
+    0x07, 0xB5, 0x65, 0xBD, 0x94, 0xA7, 0x4F, 0x82, 0x9A, 0xA7, 0xC8, 0x52, 0xDD, 0x23, 0xB3, 0x8B,
+    0x68, 0x21, 0x1A, 0x11, 0x68, 0x05, 0x97, 0xE2, 0xAE, 0x88, 0x23, 0x88, 0x0C, 0x48, 0x50, 0x35,
+    0x7D, 0xC1, 0x87, 0x40, 0x8A, 0x63, 0x12, 0x1A, 0xAD, 0x23, 0xEA, 0x96, 0x8A, 0x11, 0x22, 0x1F,
+    0x1B, 0xE4, 0x3B, 0xD4, 0x30, 0xE1, 0x81, 0x1E, 0x5D, 0xA3, 0x9D, 0x35, 0xB2, 0x20, 0x81, 0xDF,
+    0xE3, 0x83, 0x88, 0x00, 0x5F, 0x8C, 0xF9, 0x6C, 0xFA, 0x66, 0xB3, 0xB8, 0xBE, 0xB9, 0xD8, 0xFF,
+    0x1C, 0xE6, 0x2B, 0xB4, 0x15, 0x10, 0x7E, 0x4F, 0xE0, 0x4F, 0xA9, 0x09, 0xB4, 0x42, 0x06, 0x25,
+    0x07, 0x1F, 0x11, 0xF8, 0x34, 0xAA, 0xD0, 0x8C, 0x35, 0xDF, 0x86, 0x92, 0x41, 0xDB, 0x2E, 0x90,
+    0x29, 0xA2, 0x72, 0x94, 0x07, 0x7D, 0x8C, 0x9B, 0xEA, 0x34, 0x6A, 0x29, 0x14, 0xB3, 0x71, 0x09,
+    0x13, 0x28, 0x2C, 0xE6, 0xEE, 0x19, 0x76, 0x0C, 0x76, 0xD0, 0x95, 0x70, 0x8C, 0x41, 0x67, 0xDC,
+    0x89, 0x64, 0x44, 0x81, 0x13, 0x6D, 0xDF, 0xF2, 0x77, 0x9C, 0x73, 0xA8, 0xA6, 0x95, 0xD8, 0x01,
+    0x6F, 0x6E, 0x1E, 0x22, 0xD7, 0x1E, 0x0A, 0x4E, 0xA6, 0x3B, 0xD3, 0xC7, 0xA4, 0x07, 0x04, 0x06,
+    0xBF, 0x50, 0xAF, 0x1E, 0xA5, 0xDF, 0x67, 0x07, 0xA8, 0x8D, 0xE6, 0x6F, 0x97, 0xB1, 0x6E, 0x9B,
+    0x57, 0xF3, 0xC1, 0x84, 0x4C, 0x20, 0xFB, 0x87, 0x74, 0x23, 0xB1, 0x1C, 0x06, 0x62, 0xC3, 0x8F,
+    0xD9, 0x75, 0xD2, 0x0E, 0xB4, 0x55, 0x21, 0x03, 0xF9, 0x86, 0x1A, 0x90, 0x7D, 0xCA, 0xBE, 0x98,
+    0x1A, 0xB6, 0xEA, 0x9F, 0x11, 0x4B, 0x7C, 0x1F, 0x4B, 0xA3, 0xF2, 0x28, 0x4A, 0x2D, 0x45, 0x29,
+    0xA7, 0xCA, 0xA9, 0x92, 0x8B, 0x1A, 0x4E, 0x45, 0x80, 0xD6, 0x4A, 0x37, 0x06, 0xE5, 0x07, 0xC4,
+    0xA5, 0x7F, 0x8F, 0xD2, 0xA0, 0xC0, 0xB8, 0xDD, 0x97, 0xEF, 0x74, 0xD2, 0x8A, 0x5F, 0x31, 0xC2,
+    0x38, 0xE6, 0x16, 0xBA, 0xA4, 0x76, 0x54, 0x28, 0x45, 0x57, 0x07, 0xF5, 0x77, 0xC4, 0xE2, 0x6F,
+    0x50, 0x8F, 0x56, 0x44, 0x7A, 0x46, 0x1C, 0xA0, 0x94, 0x47, 0x71, 0x2D, 0x7E, 0xDD, 0x96, 0x8B,
+    0x70, 0xD5, 0xB0, 0xA8, 0xBA, 0xAE, 0xD8, 0xD7, 0x9E, 0xC1, 0x3B, 0xF4, 0x06, 0x00, 0x10, 0xEA,
+    0x81, 0x78, 0x2F, 0x00, 0xB7, 0xBB, 0xB0, 0xB3, 0xB1, 0xA9, 0xB5, 0x10, 0x7F, 0x1D, 0x96, 0x1A,
+    0xE4, 0xBD, 0x19, 0x13, 0x34, 0x46, 0x69, 0xB0, 0x86, 0x0B, 0x86, 0x91, 0x5A, 0xDE, 0x8B, 0xEB,
+    0xDB, 0x66, 0x2A, 0xAA, 0xC0, 0xDF, 0xF2, 0x02, 0x39, 0x6D, 0xF2, 0x99, 0x72, 0xDF, 0x38, 0xD2,
+    0x98, 0x14, 0xDB, 0x49, 0xE9, 0x30, 0x39, 0xC2, 0x44, 0xD9, 0xC6, 0x7D, 0x12, 0xF3, 0xB9, 0x42,
+    0x3B, 0x0D, 0xC6, 0x6B, 0x7E, 0x11, 0xCB, 0x6D, 0x11, 0xCB, 0xD7, 0x48, 0xE2, 0xCE, 0xA5, 0x57,
+    0x04, 0x8D, 0x20, 0x90, 0x9D, 0xD6, 0xA0, 0x14, 0xBD, 0x9E, 0x69, 0x8A, 0x4D, 0xD7, 0xEB, 0xEE,
+    0xC1, 0x03, 0xA7, 0x9E, 0xBD, 0x39, 0x1D, 0x8B, 0xC0, 0x1E, 0x8B, 0x4D, 0xD0, 0xBD, 0xDE, 0x03,
+    0x3B, 0xD4, 0x70, 0x54, 0x60, 0xF1, 0xC3, 0x0C, 0x40, 0xA1, 0x53, 0xBC, 0x61, 0x9F, 0xA5, 0x97,
+    0xEC, 0x2A, 0x4F, 0x26, 0xE5, 0x69, 0x50, 0x21, 0x65, 0x40, 0x20, 0x12, 0x20, 0xE5, 0x6D, 0x14,
+    0x0E, 0x91, 0x3E, 0x7B, 0x78, 0xB9, 0xB4, 0x64, 0x53, 0x4E, 0xB9, 0x02, 0x8E, 0x7A, 0xC9, 0xD3,
+    0x09, 0xF2, 0xB4, 0xFA, 0x5E, 0x9E, 0x05, 0xD0, 0x03, 0xF1, 0x5F, 0x98, 0xA0, 0x1D, 0xDA, 0x34,
+    0x0A, 0xDE, 0xE0, 0xD5, 0x91, 0x97, 0x87, 0xFB, 0x62, 0x19, 0xB7, 0x8D, 0x00, 0xC8, 0xEA, 0xD9,
+    0x08, 0xC1, 0xAC, 0x34, 0xA7, 0xFF, 0x78, 0x83, 0xEF, 0xB1, 0x88, 0x92, 0x7F, 0x30, 0x60, 0x84,
+    0xF0, 0xC6, 0xA1, 0x6F, 0xE3, 0xB1, 0xF1, 0xA9, 0x1F, 0xBE, 0x67, 0x09, 0xBC, 0xF1, 0x06, 0xFE,
+    0x9C, 0xCA, 0xCB, 0xFC, 0xFF, 0xDF, 0xBF, 0xAD, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xCF,
+    0x66, 0xD7, 0x85, 0x8B, 0xA1, 0x48, 0x28, 0xB2, 0x52, 0xDC, 0x50, 0x51, 0xE0, 0x9F, 0x30, 0x4E,
+    0xB6, 0xA0, 0x48, 0xC1, 0x4A, 0x64, 0x7F, 0x02, 0xF5, 0xFE, 0x84, 0x31, 0xA4, 0xA4, 0xC8, 0x16,
+    0x40, 0x4B, 0x13, 0x09, 0xB1, 0x14, 0xFB, 0x07, 0x22, 0xC6, 0x6C, 0x8A, 0x94, 0x31, 0xA2, 0xD8,
+    0x32, 0x8E, 0x22, 0x81, 0x94, 0x14, 0xEB, 0x08, 0xAF, 0x98, 0xF7, 0x18, 0xFB, 0x70, 0xAE, 0xDF,
+    0x7B, 0x9B, 0x44, 0x42, 0x20, 0x10, 0x63, 0xBD, 0x79, 0xF3, 0x79, 0xEE, 0xD7, 0xB9, 0x77, 0xE4,
+    0xEE, 0x6E, 0x95, 0xE2, 0x3E, 0x1A, 0x0F, 0x60, 0x97, 0xBF, 0x21, 0x9B, 0x12, 0xD4, 0xAE, 0x31,
+    0x31, 0x8B, 0xE2, 0x1B, 0xD7, 0xE4, 0x6F, 0x0F, 0x74, 0x6B, 0xC8, 0x62, 0x02, 0x71, 0x2B, 0xB4,
+    0x19, 0x10, 0xC4, 0x61, 0x94, 0x6C, 0xBC, 0x2B, 0xE2, 0x1A, 0x11, 0x9E, 0x59, 0x0F, 0x0A, 0xD4,
+    0x92, 0x61, 0x12, 0xF9, 0xE0, 0xE4, 0x98, 0x4B, 0x3B, 0xC7, 0x62, 0xD0, 0xF1, 0xFC, 0x67, 0xF8,
+    0x26, 0xDA, 0xD6, 0x3E, 0x8E, 0xE9, 0xE0, 0xEB, 0x6B, 0x26, 0x88, 0xF0, 0xE0, 0xFC, 0xD7, 0x48,
+    0xCE, 0xE3, 0x2E, 0xC8, 0x3D, 0x20, 0x1A, 0xA0, 0x29, 0xD1, 0xC9, 0xF5, 0x03, 0xD1, 0xC6, 0x29,
+    0x7E, 0xE3, 0x2F, 0x4E, 0xA7, 0x2B, 0x6F, 0xB3, 0x58, 0x3C, 0xF9, 0x11, 0xE9, 0xF3, 0xDE, 0x35,
+    0x83, 0x14, 0xFD, 0x5A, 0xEA, 0x02, 0x5B, 0xC9, 0x9B, 0x85, 0x04, 0xD5, 0xAC, 0x41, 0x02, 0x0E,
+    0x44, 0x0F, 0xE0, 0x23, 0xFC, 0xAA, 0xD0, 0xFB, 0xA8, 0x4D, 0x9F, 0x4D, 0x62, 0x6B, 0x13, 0x17,
+    0x51, 0x8A, 0xC1, 0xF4, 0x62, 0x3B, 0x5B, 0x89, 0x3B, 0xE3, 0x3D, 0x98, 0x56, 0x92, 0xC9, 0x89,
+    0xA4, 0x34, 0x4E, 0x72, 0x28, 0x24, 0x15, 0x13, 0xDB, 0xAB, 0x80, 0x9A, 0x40, 0x6A, 0xA3, 0xE9,
+    0x24, 0xAD, 0x28, 0xB2, 0x04, 0x97, 0x55, 0x42, 0xA2, 0x83, 0x64, 0x39, 0xAB, 0x2B, 0x3B, 0xA2,
+    0xF2, 0x5B, 0x15, 0x3A, 0x70, 0xB8, 0x37, 0xEA, 0xA2, 0x57, 0x35, 0x4A, 0x2E, 0x4A, 0xAE, 0x8B,
+    0xA9, 0x82, 0x1E, 0x61, 0xAA, 0x44, 0x0D, 0x13, 0x5C, 0xAC, 0xD0, 0xE0, 0xF3, 0xB1, 0x88, 0xAE,
+    0xF1, 0xB7, 0x50, 0x76, 0x65, 0x6B, 0x9F, 0x0E, 0xF9, 0x60, 0xFE, 0x18, 0x93, 0x31, 0x9D, 0x50,
+    0xFB, 0x0A, 0x5E, 0x17, 0xCF, 0x63, 0x3E, 0x14, 0x3D, 0xCE, 0xC6, 0x62, 0x28, 0x26, 0xF8, 0xB0,
+    0xD0, 0xB0, 0x09, 0x83, 0x47, 0xE4, 0xE4, 0xAF, 0x04, 0xED, 0xE9, 0x4E, 0x01, 0x75, 0xC9, 0xC9,
+    0x77, 0x6B, 0xFD, 0x68, 0x9A, 0x1B, 0x2D, 0x6E, 0x33, 0xD4, 0x84, 0x5C, 0x60, 0x7F, 0xA0, 0xCB,
+    0x46, 0xB5, 0x86, 0xF6, 0x79, 0x1A, 0x92, 0x2A, 0x90, 0xEA, 0x6E, 0x35, 0x2E, 0xAF, 0x40, 0x64,
+    0xA3, 0xE1, 0xB7, 0xBD, 0x9D, 0x0C, 0x5E, 0xE2, 0x99, 0x86, 0x56, 0x71, 0xA2, 0xC5, 0x13, 0xF4,
+    0x98, 0xE8, 0x4E, 0xDF, 0x98, 0x40, 0x62, 0xD8, 0x2E, 0xA7, 0x35, 0x75, 0xD9, 0xA7, 0x7F, 0xBB,
+    0xB4, 0x3A, 0x1D, 0xEF, 0x60, 0xDB, 0x08, 0x95, 0x05, 0xF5, 0xAA, 0x2A, 0x6D, 0x55, 0xFD, 0x87,
+    0x1A, 0xB1, 0x5E, 0xB6, 0x2D, 0xC7, 0x2B, 0x4C, 0x1E, 0x05, 0x5A, 0xD4, 0x44, 0x0B, 0xD4, 0x8F,
+    0xCA, 0xB4, 0x79, 0xE4, 0xC0, 0xB5, 0xB6, 0x4D, 0x41, 0x16, 0x16, 0xEA, 0x83, 0x1B, 0xDF, 0xAA,
+    0xEA, 0xB6, 0xDD, 0xD8, 0x60, 0x3B, 0x1A, 0xC4, 0x65, 0x83, 0x71, 0x8D, 0x64, 0x49, 0xF7, 0xFB,
+    0xB8, 0xC0, 0xCF, 0xFC, 0x06, 0xBD, 0x5A, 0x76, 0xA6, 0x37, 0x74, 0x74, 0x4A, 0x2C, 0xFA, 0x0F,
+    0x82, 0xCA, 0x57, 0xB6, 0xE1, 0x46, 0xFB, 0x4F, 0x1B, 0xD3, 0xF7, 0xFC, 0xF2, 0xD9, 0x82, 0xDF,
+    0xE7, 0x7E, 0x23, 0xC3, 0xE0, 0x39, 0xBF, 0x80, 0xD1, 0xD2, 0xC9, 0xB7, 0x50, 0xF1, 0x62, 0xBD,
+    0xBE, 0xB2, 0x41, 0xF9, 0x97, 0x93, 0x13, 0x7E, 0xAD, 0x9F, 0x25, 0x3C, 0x7D, 0x43, 0x4E, 0xD9,
+    0xCC, 0xBC, 0x8E, 0x6B, 0x99, 0xF3, 0x44, 0xC2, 0xDA, 0x5D, 0x33, 0xE3, 0xE5, 0xDD, 0xB9, 0x57,
+    0xFF, 0xA6, 0x4A, 0x31, 0xF3, 0x82, 0x8E, 0xB6, 0x9A, 0x1B, 0x81, 0x49, 0x92, 0x74, 0xEE, 0xC5,
+    0xB1, 0x66, 0x45, 0xCF, 0x34, 0x61, 0x57, 0xF4, 0x74, 0x1A, 0xB9, 0x57, 0x2D, 0x40, 0x6B, 0xB3,
+    0x68, 0x06, 0x29, 0x2F, 0x7D, 0x93, 0xAB, 0x34, 0x0B, 0x25, 0xC6, 0x55, 0xE3, 0x2C, 0xC5, 0x48,
+    0xD6, 0x33, 0xFE, 0x05, 0x25, 0xBA, 0xD6, 0x28, 0x55, 0xB6, 0xFD, 0xEA, 0x81, 0xF6, 0x3C, 0x34,
+    0xF7, 0xAD, 0xAE, 0x97, 0xBD, 0xF6, 0xE6, 0x8D, 0x5E, 0xC5, 0x99, 0xA5, 0x6F, 0x5D, 0x47, 0xC3,
+    0xEE, 0x29, 0xDA, 0x32, 0xDD, 0xFA, 0x6F, 0x66, 0xD6, 0x44, 0x37, 0x92, 0x96, 0xE4, 0xD9, 0x1A,
+    0x96, 0x62, 0x4F, 0x8E, 0x69, 0x47, 0x47, 0xCC, 0xCE, 0xB6, 0xAE, 0xA1, 0x5F, 0xD3, 0x31, 0x8D,
+    0x33, 0xE0, 0x2F, 0xF8, 0x82, 0xB5, 0xC8, 0x6A, 0x36, 0x69, 0x7B, 0xEF, 0x80, 0x8C, 0x09, 0xD4,
+    0x33, 0xE6, 0xCB, 0xA3, 0x78, 0x73, 0xAE, 0x09, 0xCA, 0x04, 0xD4, 0x05, 0x71, 0x1D, 0xB7, 0x0E,
+    0x9D, 0x4E, 0xF7, 0xEB, 0x34, 0xDA, 0xAA, 0xEC, 0xF1, 0x35, 0x88, 0x3C, 0x24, 0xCA, 0xEA, 0xEB,
+    0xEB, 0x6A, 0xF1, 0x80, 0xB7, 0x79, 0xB2, 0xC6, 0xA4, 0x2E, 0x2A, 0x58, 0x18, 0x5D, 0xA0, 0xA8,
+    0xC1, 0x44, 0xD5, 0x3D, 0x1B, 0x69, 0x53, 0x97, 0x4E, 0xAA, 0xCB, 0x55, 0xBF, 0xF2, 0xDA, 0x0F,
+    0xB6, 0x4F, 0x75, 0xB7, 0x57, 0xD5, 0x8A, 0x90, 0x07, 0x13, 0x0C, 0x4E, 0x7B, 0xAF, 0x12, 0x1A,
+    0x62, 0xFA, 0x39, 0x73, 0x76, 0x0E, 0xB6, 0xC4, 0x46, 0x47, 0xDE, 0x0E, 0x66, 0x59, 0x92, 0xD6,
+    0x79, 0x48, 0xA6, 0x44, 0x73, 0x84, 0x7C, 0x19, 0xCB, 0x6E, 0xA1, 0xF5, 0xD5, 0x50, 0xA9, 0x2C,
+    0x78, 0x6A, 0x5A, 0x76, 0xC9, 0xC4, 0x13, 0x48, 0x98, 0xB8, 0xFB, 0x58, 0xAA, 0x6E, 0x3B, 0x57,
+    0x09, 0xC2, 0xEC, 0x0E, 0xEB, 0xAC, 0x67, 0x90, 0x13, 0xC6, 0x38, 0x6B, 0xAE, 0x9C, 0xF9, 0x29,
+    0xC3, 0x4C, 0x54, 0x84, 0xE2, 0xD2, 0x3F, 0x8A, 0xE9, 0xE4, 0xEA, 0xF2, 0x25, 0x25, 0x91, 0x18,
+    0x17, 0xC0, 0x84, 0xAF, 0x0E, 0x3F, 0xA6, 0x87, 0x7D, 0xA3, 0xCE, 0x7E, 0x87, 0xA1, 0xFE, 0x89,
+    0x7E, 0x9B, 0xAB, 0xE6, 0xE1, 0x7C, 0xDB, 0x65, 0xA4, 0x21, 0x85, 0xDD, 0x19, 0x92, 0xF6, 0xC3,
+    0xFF, 0x03, 0xF3, 0xDA, 0xA6, 0x38, 0x6A, 0xB8, 0x77, 0x3D, 0x07, 0xD9, 0x38, 0x3B, 0xA2, 0x27,
+    0x9C, 0x3E, 0x01, 0xED, 0xF6, 0x1D, 0x39, 0x43, 0x95, 0x4D, 0x73, 0xC0, 0xD0, 0x67, 0x38, 0x47,
+    0xE5, 0x3A, 0x13, 0x78, 0x18, 0x0D, 0x19, 0x17, 0x39, 0xE0, 0xC3, 0xC4, 0x1A, 0xF0, 0xD6, 0xE0,
+    0x11, 0x2B, 0x7C, 0xD0, 0xB8, 0x31, 0x8C, 0xAC, 0xEB, 0xEB, 0x77, 0x41, 0xD9, 0x53, 0x10, 0xD2,
+    0x71, 0x92, 0x69, 0x45, 0xDF, 0x3B, 0x5E, 0x5B, 0x71, 0x93, 0x4C, 0xE3, 0x21, 0x3F, 0x17, 0x74,
+    0x75, 0x20, 0x17, 0xA4, 0x7A, 0xCD, 0x73, 0x35, 0x66, 0x2C, 0xA6, 0x53, 0x96, 0x9D, 0xD1, 0x84,
+    0xBC, 0x41, 0xFD, 0xD0, 0x84, 0xC5, 0xD5, 0x9B, 0xF5, 0xFA, 0x6F, 0xA4, 0x01, 0x54, 0x4C, 0xCD,
+    0xDA, 0xFD, 0x92, 0x95, 0x28, 0xD0, 0x9E, 0x67, 0xB8, 0x3D, 0xD9, 0x26, 0x3F, 0x0F, 0xF2, 0x3E,
+    0x4B, 0x32, 0x49, 0xC2, 0xFD, 0xDE, 0x4C, 0x27, 0x7A, 0x21, 0x57, 0x6D, 0x7A, 0xF9, 0x84, 0xBE,
+    0xD2, 0xB2, 0x55, 0x92, 0xEA, 0xFA, 0xD6, 0xDD, 0x38, 0xD0, 0xE4, 0xE2, 0x31, 0x2C, 0xA2, 0x6D,
+    0x4A, 0x33, 0xEC, 0xEE, 0xF3, 0x15, 0xF4, 0xA8, 0x15, 0xDD, 0x51, 0x73, 0x7F, 0x49, 0x76, 0xFD,
+    0x20, 0xFE, 0xA8, 0x73, 0x8F, 0xA1, 0x45, 0xA1, 0xDE, 0x44, 0xE9, 0x3F, 0xB5, 0x3F, 0x01, 0xB5,
+    0x55, 0x3D, 0x6F, 0xE5, 0x44, 0x14, 0xBD, 0xF6, 0x90, 0xB8, 0x70, 0x31, 0x29, 0x58, 0x21, 0xD8,
+    0xC2, 0x3F, 0x00, 0x21, 0xB7, 0x88, 0x66, 0x1C, 0x28, 0xB6, 0x4D, 0x81, 0x84, 0x10, 0x05, 0xD4,
+    0x2B, 0xA1, 0xFC, 0x01, 0x24, 0x3B, 0xBB, 0x7F, 0x20, 0x05, 0xD4, 0x6C, 0x89, 0x5E, 0x0A, 0x28,
+    0x29, 0xD0, 0x8E, 0x05, 0x45, 0x0A, 0x8A, 0x35, 0x02, 0x89, 0x62, 0x1B, 0xF3, 0xA5, 0x45, 0xDB,
+    0x60, 0x21, 0x2F, 0x38, 0xD1, 0x8C, 0x2F, 0xE7, 0xCC, 0x4B, 0x76, 0x13, 0x84, 0x10, 0x0D, 0x96,
+    0x7C, 0xE4, 0x37, 0x6F, 0xE6, 0x7E, 0x9D, 0x73, 0xEF, 0xC8, 0x81, 0xB8, 0xB1, 0x50, 0x69, 0xA7,
+    0x3C, 0x4A, 0x7A, 0xB2, 0xA6, 0x5E, 0x0B, 0x1D, 0x6F, 0xAE, 0xF8, 0xC3, 0xFC, 0x03, 0x14, 0xFA,
+    0x86, 0xAE, 0x4E, 0x47, 0xEC, 0x0C, 0xD5, 0x83, 0x59, 0xDB, 0x6F, 0xE3, 0xFB, 0xF9, 0xB8, 0x3D,
+    0xBB, 0x23, 0xF5, 0x9A, 0xE9, 0x92, 0xF9, 0x51, 0xB4, 0xC3, 0x6E, 0xBB, 0xE0, 0xC0, 0xF5, 0xCF,
+    0x42, 0x1B, 0xD5, 0xBB, 0xBA, 0x72, 0xB3, 0x09, 0xE2, 0xC7, 0x32, 0x8A, 0xEB, 0xB7, 0xC7, 0xDF,
+    0x2C, 0xB4, 0xF7, 0x21, 0xD7, 0xBE, 0x08, 0xD2, 0xFE, 0x2B, 0xF8, 0xAE, 0x9A, 0x0B, 0xC5, 0xF6,
+    0x76, 0xCE, 0x7F, 0xDE, 0x1E, 0x16, 0xAB, 0xAA, 0x22, 0x4E, 0x75, 0x11, 0xA9, 0x7E, 0xC1, 0xA7,
+    0xD4, 0x70, 0x20, 0xF2, 0x85, 0x9D, 0x44, 0xCC, 0xE4, 0x1E, 0x1F, 0x8B, 0xED, 0x55, 0x67, 0x71,
+    0x66, 0xF5, 0x53, 0xB6, 0xD8, 0xC9, 0x0D, 0xE5, 0xE0, 0x7A, 0xDF, 0x38, 0xD1, 0x3C, 0xBE, 0x16,
+    0x4C, 0xB0, 0x7F, 0xE8, 0x50, 0x3D, 0xF1, 0x5F, 0x6B, 0xAE, 0x1A, 0xAB, 0x09, 0x16, 0xBB, 0x1D,
+    0x79, 0xF6, 0xA8, 0x5A, 0x9D, 0x44, 0x57, 0x8B, 0xEC, 0xAB, 0x25, 0x83, 0x0B, 0x3B, 0x5F, 0xC7,
+    0x4D, 0xC3, 0x28, 0x94, 0x27, 0xF5, 0xD3, 0x60, 0xCF, 0x37, 0x6A, 0x22, 0xD7, 0xF3, 0x2B, 0x88,
+    0x95, 0x25, 0xD7, 0x77, 0x82, 0x87, 0x35, 0x9D, 0x69, 0x53, 0xBB, 0x0B, 0x07, 0xCF, 0xE3, 0xF5,
+    0x33, 0x53, 0x19, 0x44, 0x5E, 0xD2, 0x46, 0xA4, 0x00, 0x2B, 0x08, 0x26, 0x48, 0xA9, 0x70, 0x9A,
+    0xA5, 0x25, 0x26, 0x55, 0x4D, 0x7E, 0x90, 0xF6, 0x37, 0x1D, 0x33, 0x78, 0xEA, 0x0B, 0xFD, 0x5E,
+    0xBB, 0x6A, 0x41, 0x99, 0xDB, 0xC1, 0x22, 0xB0, 0x06, 0x34, 0x45, 0x14, 0xBB, 0x9A, 0xFF, 0xBE,
+    0x34, 0xD0, 0xDF, 0x23, 0x5D, 0xDA, 0x4B, 0x9F, 0x19, 0x3C, 0x89, 0xC3, 0x5B, 0xA2, 0x4A, 0xB2,
+    0xB2, 0x6A, 0xF8, 0x27, 0x23, 0xA1, 0xCF, 0x3D, 0x4D, 0x3C, 0x03, 0x67, 0x19, 0x0E, 0x8E, 0x6E,
+    0xAA, 0x66, 0xAB, 0xA2, 0xFB, 0x11, 0xE9, 0xBA, 0x46, 0xF4, 0xD6, 0x28, 0x76, 0x0D, 0x2C, 0xCD,
+    0x24, 0xF6, 0x89, 0x72, 0x25, 0xF0, 0x2F, 0x50, 0xBD, 0xAF, 0x8D, 0x9D, 0x6D, 0x28, 0x75, 0x72,
+    0x93, 0x42, 0x16, 0x34, 0xDB, 0x6C, 0xED, 0xBD, 0x8A, 0xD7, 0xCC, 0xE4, 0x6C, 0x4A, 0xB9, 0xF0,
+    0x8B, 0x1E, 0xCB, 0x4E, 0xAE, 0x3F, 0xA8, 0xB7, 0x57, 0xA7, 0x47, 0x1A, 0xAA, 0x59, 0x54, 0xDC,
+    0x80, 0xE4, 0xB5, 0x69, 0x27, 0x13, 0xC1, 0xBD, 0x9D, 0x3D, 0x96, 0x1E, 0xFE, 0x14, 0x48, 0xC9,
+    0x64, 0x10, 0x5D, 0x6F, 0x57, 0xEE, 0x1A, 0x0D, 0x77, 0x55, 0x73, 0xCD, 0x83, 0xBA, 0x22, 0x02,
+    0xD9, 0x93, 0x06, 0x1A, 0xB0, 0xBD, 0xD8, 0xA1, 0x45, 0xBE, 0x5F, 0x05, 0x2A, 0x05, 0xB2, 0x7B,
+    0xF9, 0xD7, 0x2B, 0xDE, 0x5A, 0xFD, 0x46, 0xCF, 0x54, 0x0D, 0xAA, 0x04, 0x13, 0x88, 0xD8, 0x8E,
+    0x06, 0xAD, 0x01, 0x12, 0x60, 0xD0, 0x2E, 0x76, 0x60, 0xD9, 0x79, 0x1A, 0xA1, 0xFB, 0x8F, 0x71,
+    0x9A, 0x32, 0xCE, 0x61, 0x5D, 0x0A, 0x66, 0x67, 0x13, 0x31, 0xCC, 0xA3, 0x65, 0x7E, 0x90, 0x21,
+    0xD4, 0x05, 0xE2, 0x92, 0x2F, 0x94, 0xD9, 0xF3, 0xFF, 0xFB, 0xCD, 0xB3, 0xD4, 0x28, 0x15, 0xAB,
+    0x3F, 0x68, 0x57, 0x4F, 0x94, 0x84, 0xFC, 0xA7, 0x8F, 0xC7, 0x1E, 0x69, 0x5F, 0x3C, 0x92, 0x04,
+    0xEE, 0xE0, 0x3B, 0x5F, 0xE8, 0x9B, 0xB6, 0x59, 0xCC, 0x5D, 0xBC, 0x9B, 0xCD, 0x31, 0x69, 0x81,
+    0xDF, 0xC3, 0xF5, 0x42, 0x35, 0xB7, 0x4F, 0xD6, 0xCD, 0xBD, 0xA4, 0xCF, 0x04, 0xA1, 0x08, 0x66,
+    0x0B, 0x0B, 0x60, 0xDC, 0x2B, 0x02, 0xF8, 0x29, 0xE2, 0x01, 0xD3, 0xD1, 0x63, 0xC2, 0x82, 0x9F,
+    0x87, 0x11, 0x67, 0x51, 0x86, 0x02, 0x8D, 0x09, 0xC8, 0x9E, 0x7E, 0x41, 0x4E, 0x15, 0x95, 0xA9,
+    0x54, 0xA6, 0xB2, 0x14, 0x5B, 0xAD, 0xBC, 0xC7, 0x9A, 0xC0, 0x6D, 0x45, 0xB1, 0xBE, 0xC0, 0xA9,
+    0x52, 0x92, 0xEA, 0x7A, 0x10, 0x83, 0xAD, 0x33, 0x5B, 0xA3, 0x77, 0xEF, 0x9E, 0xB5, 0x32, 0xD7,
+    0xC3, 0x07, 0xF9, 0xE0, 0xF7, 0x47, 0x49, 0xB3, 0xA7, 0x5C, 0x3F, 0xC1, 0x2E, 0xDA, 0xF1, 0x27,
+    0x2B, 0x96, 0x10, 0x71, 0x39, 0x43, 0x20, 0xF5, 0xD0, 0xF6, 0x90, 0x55, 0x64, 0x6B, 0xD3, 0xD1,
+    0xD9, 0x25, 0x5D, 0xB7, 0x8F, 0x53, 0xA4, 0x1D, 0x7B, 0x03, 0x7A, 0xD4, 0x13, 0x1D, 0x38, 0x4C,
+    0x18, 0x98, 0xD1, 0xBB, 0xB0, 0xD3, 0x4E, 0x08, 0xC1, 0x06, 0x1C, 0xCF, 0xF5, 0xF0, 0x7C, 0xB3,
+    0xF1, 0x0F, 0x99, 0xF7, 0x9F, 0x84, 0x08, 0xF2, 0x33, 0x3D, 0x24, 0x91, 0xA7, 0xD8, 0x09, 0x85,
+    0xF6, 0x94, 0xED, 0x22, 0x65, 0x00, 0x97, 0x30, 0xE3, 0xD5, 0xC7, 0xAD, 0x61, 0xC8, 0x82, 0xC5,
+    0x7D, 0x9B, 0xC5, 0xDD, 0xF9, 0x10, 0xA7, 0x38, 0xC4, 0x74, 0x84, 0xBC, 0x66, 0xD7, 0x97, 0xA1,
+    0xED, 0x4C, 0xF0, 0x8D, 0x89, 0xBA, 0x39, 0x89, 0xC9, 0xF0, 0x47, 0x6F, 0x45, 0x6D, 0xB0, 0x86,
+    0xF5, 0x76, 0x28, 0x61, 0xB3, 0xE6, 0x38, 0xE8, 0x73, 0x9A, 0xBA, 0xB1, 0x65, 0x7F, 0xF7, 0x88,
+    0xC4, 0xE8, 0x29, 0x18, 0xB4, 0x7A, 0x0B, 0x9F, 0x1E, 0x7A, 0x16, 0xB3, 0x7E, 0x66, 0x23, 0x05,
+    0x54, 0x2F, 0xE2, 0x1B, 0xC4, 0x44, 0x76, 0xFD, 0x60, 0xD9, 0xF7, 0x1D, 0x74, 0x67, 0x94, 0x0B,
+    0x65, 0x64, 0xAB, 0xD8, 0x85, 0x1A, 0xAB, 0x7F, 0x27, 0xFF, 0xED, 0x03, 0xF6, 0xB0, 0x62, 0x07,
+    0xF2, 0xE4, 0x82, 0x61, 0xF9, 0x11, 0x3C, 0x5D, 0x55, 0x8C, 0x1D, 0x8D, 0x73, 0x45, 0xE6, 0xD9,
+    0x41, 0x8B, 0x4A, 0x05, 0xE8, 0xBF, 0x8A, 0x68, 0x18, 0x17, 0x38, 0x24, 0x3E, 0x07, 0xC5, 0x9E,
+    0x03, 0x06, 0x51, 0xEA, 0x11, 0x1D, 0x7F, 0xB9, 0x50, 0xEA, 0x90, 0x53, 0xFD, 0x68, 0xBA, 0x18,
+    0x49, 0x96, 0x2D, 0x93, 0xB4, 0x6E, 0x68, 0x3C, 0xBB, 0xE4, 0x5C, 0x76, 0x9B, 0x17, 0x29, 0xE9,
+    0x9E, 0x83, 0x24, 0x75, 0x98, 0xD8, 0x73, 0x4D, 0xF1, 0x24, 0xF7, 0x37, 0x9A, 0xEB, 0x6D, 0x0D,
+    0xF1, 0x39, 0x5D, 0x50, 0x44, 0xA7, 0x33, 0x2E, 0x1A, 0xDC, 0x09, 0x20, 0x3B, 0x89, 0x4A, 0x92,
+    0xD2, 0xE0, 0x88, 0xE8, 0x12, 0x2A, 0xD1, 0xAC, 0x44, 0xFB, 0x23, 0xD1, 0xDD, 0x01, 0xC6, 0x95,
+    0xFB, 0x75, 0x49, 0x38, 0x26, 0xEC, 0x88, 0xEB, 0x85, 0x1D, 0xE0, 0xCD, 0xB5, 0x29, 0xF4, 0x5E,
+    0xF2, 0x15, 0x92, 0xAF, 0x90, 0xFA, 0x6E, 0x96, 0xCB, 0xC1, 0x23, 0x55, 0x2A, 0x4B, 0x9D, 0xA6,
+    0x8E, 0x4B, 0x91, 0xBD, 0xC2, 0xB1, 0xB7, 0xC7, 0x5F, 0xEC, 0xDA, 0x8C, 0x70, 0xCA, 0xFB, 0x84,
+    0x4D, 0x9E, 0xAF, 0x57, 0xD3, 0x70, 0x7A, 0x47, 0x51, 0xC3, 0xD7, 0x75, 0x81, 0xDE, 0xDA, 0x9E,
+    0x77, 0x19, 0x00, 0x97, 0x97, 0xC1, 0xC8, 0x03, 0xD4, 0x84, 0xFB, 0xAE, 0x37, 0x3A, 0x13, 0x06,
+    0x42, 0x03, 0xE0, 0x75, 0xC7, 0x13, 0xDF, 0xD1, 0x40, 0x74, 0xB8, 0x0B, 0x29, 0xFE, 0xD4, 0xC8,
+    0x69, 0x24, 0x16, 0x8C, 0xAC, 0x60, 0x60, 0x45, 0x2F, 0xFF, 0xFB, 0xF3, 0x17, 0x85, 0x55, 0x31,
+    0x8F, 0xDE, 0x44, 0x10, 0x1D, 0xDB, 0xBA, 0xCF, 0x91, 0x2C, 0xB1, 0x14, 0x01, 0x29, 0x87, 0xC0,
+    0x0D, 0x15, 0x8D, 0x5B, 0x0A, 0xD0, 0x1A, 0x52, 0x50, 0x5C, 0x93, 0xE2, 0x42, 0x73, 0x45, 0x1A,
+    0xFA, 0x13, 0x12, 0x42, 0x14, 0x11, 0x36, 0xA4, 0x48, 0x99, 0x6B, 0x10, 0x7F, 0x20, 0x14, 0xA4,
+    0xB9, 0x96, 0xE2, 0x14, 0x2F, 0xA4, 0xA0, 0x8C, 0xA5, 0x48, 0xD0, 0x3A, 0x22, 0x05, 0x1C, 0x12,
+    0xD9, 0x28, 0x8B, 0x64, 0x1D, 0xB6, 0x87, 0xF7, 0xF6, 0x33, 0xC7, 0x49, 0x41, 0xE2, 0x93, 0xFC,
+    0x79, 0xBD, 0x1E, 0xCF, 0xBC, 0x79, 0x6F, 0x66, 0x56, 0x44, 0x24, 0x53, 0x75, 0x62, 0x75, 0x14,
+    0x39, 0xC4, 0x95, 0x68, 0xCD, 0x9D, 0x01, 0x3B, 0x2A, 0x52, 0x86, 0xED, 0x8E, 0x94, 0xBA, 0x60,
+    0x81, 0xBF, 0x52, 0x75, 0xC2, 0x4E, 0x37, 0x94, 0x21, 0x53, 0x2C, 0x2A, 0x5F, 0x86, 0x94, 0x0B,
+    0x8B, 0x9D, 0x62, 0xDE, 0xA8, 0xEA, 0x2D, 0x5C, 0x83, 0xA5, 0x0F, 0xFE, 0x92, 0x7D, 0x7C, 0xE8,
+    0xC5, 0x20, 0xC8, 0x06, 0x1E, 0xB3, 0x49, 0xC4, 0x78, 0x29, 0x54, 0x5B, 0xFA, 0x5C, 0x1F, 0xC5,
+    0x3A, 0x11, 0xBD, 0x57, 0x33, 0xB2, 0x59, 0xB4, 0xB7, 0xAE, 0x73, 0x70, 0x9A, 0x4D, 0xF9, 0x64,
+    0x7C, 0xE5, 0x9B, 0x9F, 0xF4, 0x86, 0xEA, 0xD8, 0xE1, 0x83, 0xF8, 0xBB, 0x7E, 0x9D, 0xF0, 0x46,
+    0x83, 0x40, 0xEE, 0xF0, 0x4C, 0x61, 0x45, 0x2C, 0xD2, 0xF4, 0x8D, 0x33, 0xA1, 0xF4, 0xD9, 0x9C,
+    0x4F, 0x1F, 0x63, 0xA3, 0x54, 0xD7, 0x3C, 0x52, 0x07, 0xC8, 0x7D, 0x0E, 0xCB, 0x44, 0xBF, 0x39,
+    0x91, 0xC6, 0xBD, 0x24, 0x25, 0x02, 0xE6, 0x13, 0x33, 0xC3, 0xD5, 0xFD, 0xB6, 0x65, 0x40, 0x01,
+    0x52, 0x64, 0x7F, 0x03, 0x0C, 0x77, 0xD4, 0x75, 0x70, 0xCD, 0x5C, 0x42, 0xBE, 0xA4, 0xDA, 0xC2,
+    0x2D, 0x62, 0x48, 0xE7, 0x1A, 0x57, 0x5C, 0x5C, 0xBC, 0xD9, 0xB5, 0xCD, 0x83, 0x87, 0x21, 0x9F,
+    0x2A, 0x04, 0x3F, 0x8D, 0x51, 0x82, 0x34, 0x40, 0x99, 0xCF, 0xFB, 0x58, 0xB8, 0xBC, 0x65, 0x18,
+    0x2C, 0x48, 0x60, 0x2B, 0x39, 0xF1, 0xBF, 0x75, 0xEF, 0x28, 0xE6, 0x00, 0x66, 0x33, 0x30, 0x54,
+    0xE2, 0x1D, 0x83, 0xF1, 0xF7, 0x18, 0x8B, 0xF7, 0xC0, 0x76, 0x3E, 0x6F, 0x99, 0x6F, 0xFA, 0x48,
+    0xFE, 0xFF, 0x3F, 0x1E, 0x2E, 0x35, 0xB8, 0x00, 0x27, 0x8C, 0x56, 0x40, 0x40, 0xA4, 0x82, 0x65,
+    0xB3, 0xBA, 0xD5, 0xD3, 0xBB, 0x76, 0x10, 0x33, 0x4A, 0x86, 0xF8, 0xC0, 0xF1, 0xC2, 0xC3, 0x2C,
+    0x95, 0x06, 0xA3, 0x73, 0x04, 0x06, 0x36, 0x74, 0xB2, 0x91, 0xDA, 0xAD, 0xD6, 0x95, 0x83, 0xC4,
+    0x23, 0x16, 0x65, 0x5B, 0x86, 0xC4, 0x6F, 0xEB, 0x01, 0x00, 0x58, 0x21, 0x19, 0x69, 0x3B, 0xDF,
+    0x79, 0x71, 0xB1, 0xD1, 0x27, 0xFF, 0x14, 0xD8, 0xB4, 0xD5, 0x0E, 0x8E, 0x7F, 0xC1, 0xF5, 0x85,
+    0x9E, 0x2E, 0xD9, 0x92, 0x06, 0x33, 0xE6, 0x3D, 0x4A, 0x87, 0x48, 0x1A, 0x90, 0x77, 0xBC, 0x1C,
+    0x11, 0x11, 0x1F, 0x89, 0xCF, 0xCC, 0x75, 0x8A, 0x4A, 0xB9, 0x08, 0x2D, 0xAA, 0xDE, 0x53, 0x9B,
+    0x1A, 0xA9, 0xCF, 0x88, 0x92, 0x7A, 0x70, 0x51, 0xB8, 0x18, 0x93, 0x6C, 0x48, 0x79, 0x76, 0xBF,
+    0x66, 0xF2, 0x03, 0x2A, 0x56, 0x7D, 0xBE, 0x7C, 0xA8, 0xA8, 0xCD, 0x04, 0xC5, 0xD0, 0xA7, 0xE4,
+    0x37, 0x5B, 0x60, 0x65, 0x46, 0xC0, 0xB3, 0x8F, 0xBB, 0x20, 0xDA, 0xE9, 0x98, 0xCD, 0xB0, 0x66,
+    0x59, 0x40, 0xDA, 0xD5, 0x49, 0x33, 0x48, 0x72, 0x4C, 0x08, 0xDA, 0x8B, 0xBC, 0xF6, 0xE4, 0x1C,
+    0xFC, 0xC0, 0xF0, 0xE5, 0x9F, 0x07, 0xBD, 0xF1, 0x99, 0xC3, 0xD5, 0xB2, 0x7C, 0xCD, 0xD9, 0xB7,
+    0x30, 0xD4, 0xDE, 0x10, 0x9F, 0x37, 0x28, 0xDA, 0x6C, 0x31, 0x3E, 0x55, 0x83, 0xDE, 0xE8, 0x94,
+    0x8D, 0xC3, 0x5A, 0x4B, 0xE1, 0x2E, 0x9B, 0xD7, 0x1E, 0x08, 0x28, 0xBD, 0x01, 0x7D, 0xD0, 0x4A,
+    0xFA, 0xAB, 0x24, 0xB1, 0x26, 0x36, 0x75, 0x0E, 0xBE, 0xD5, 0xD9, 0xC1, 0x28, 0xD3, 0xEE, 0xBC,
+    0xD1, 0xFA, 0x10, 0xCC, 0xFB, 0xA2, 0x63, 0xA8, 0x05, 0x52, 0x0D, 0xC6, 0xE7, 0xE0, 0x35, 0xF7,
+    0x08, 0x03, 0x9E, 0x32, 0x84, 0x63, 0x09, 0x09, 0x42, 0xDA, 0x9A, 0xF8, 0x8F, 0xCF, 0x96, 0x15,
+    0xA9, 0xB2, 0xFB, 0x78, 0x6F, 0x61, 0x07, 0x38, 0x2C, 0x43, 0x42, 0xB3, 0x00, 0x5C, 0xF2, 0x3B,
+    0xB4, 0xBB, 0xA5, 0x1F, 0x40, 0x52, 0xFA, 0x55, 0x49, 0x95, 0x71, 0xD4, 0x15, 0x50, 0x7D, 0xC1,
+    0x66, 0xB5, 0x10, 0x47, 0x33, 0x36, 0x23, 0xA8, 0x6F, 0x2B, 0xDD, 0x61, 0x08, 0x58, 0x6D, 0xD9,
+    0x90, 0xB5, 0x1D, 0x65, 0x5E, 0xEF, 0x27, 0xEB, 0xFD, 0xE6, 0x7A, 0x7F, 0x27, 0xA5, 0xFD, 0x15,
+    0x01, 0x03, 0xA3, 0x09, 0xD5, 0x58, 0xEA, 0xFB, 0x10, 0x1E, 0xDD, 0xDD, 0x04, 0xE9, 0xB2, 0x09,
+    0x09, 0xA4, 0xC1, 0x7E, 0x4F, 0x36, 0x1E, 0x4C, 0x96, 0xE0, 0xBB, 0xA7, 0x03, 0x19, 0x57, 0x0E,
+    0xA1, 0xA5, 0xF9, 0x19, 0x6F, 0x3A, 0xBC, 0x41, 0xDA, 0x30, 0x63, 0xB1, 0xE1, 0x1B, 0x74, 0x1F,
+    0x1D, 0x0C, 0xF4, 0xF6, 0xA5, 0xDE, 0x06, 0x51, 0xA1, 0x58, 0x22, 0xAE, 0x72, 0xB8, 0x00, 0xC6,
+    0xB8, 0x0B, 0x88, 0x72, 0xB7, 0x02, 0xDA, 0xBD, 0x0B, 0xD6, 0x15, 0xC2, 0x80, 0x9C, 0xEE, 0xAB,
+    0x6E, 0xB0, 0x2D, 0x08, 0xE9, 0x13, 0x65, 0x09, 0xB9, 0xCB, 0x52, 0x0D, 0x71, 0x1A, 0xED, 0x1E,
+    0x07, 0xF4, 0x2A, 0x59, 0xC1, 0x0C, 0xDB, 0x39, 0x9C, 0x49, 0xA3, 0x23, 0x57, 0x9F, 0x81, 0xBF,
+    0x06, 0x30, 0x2C, 0x3C, 0xEC, 0xE9, 0xD7, 0xEA, 0xD8, 0x25, 0x05, 0xD1, 0xBE, 0x72, 0x9F, 0x00,
+    0xDA, 0x6D, 0x4F, 0x73, 0x96, 0x5A, 0x60, 0x2F, 0xD6, 0x92, 0x97, 0x57, 0x8F, 0xD0, 0x60, 0x10,
+    0x53, 0x7F, 0x98, 0xF7, 0xE6, 0x37, 0xC4, 0xF6, 0xB1, 0x04, 0x9A, 0x36, 0x47, 0xF3, 0x34, 0xDA,
+    0x26, 0x07, 0x20, 0xB2, 0x7A, 0x86, 0x72, 0xB5, 0x75, 0xF5, 0x7C, 0x39, 0x98, 0xD1, 0x59, 0x75,
+    0x07, 0xD9, 0xA8, 0xEC, 0x4D, 0x49, 0x0A, 0xB4, 0x0F, 0xFA, 0x15, 0xAC, 0xEF, 0xB6, 0x71, 0xA4,
+    0x1E, 0xA1, 0x9B, 0xA0, 0xA8, 0xCE, 0xD0, 0x2B, 0xD6, 0x07, 0xC6, 0x8C, 0x7E, 0xC7, 0x09, 0x88,
+    0xBA, 0x77, 0x16, 0x1F, 0xB2, 0x28, 0x30, 0x3B, 0x39, 0x22, 0x8E, 0x07, 0x4E, 0x82, 0x89, 0x23,
+    0x88, 0x33, 0x68, 0x2A, 0xD9, 0xB0, 0x74, 0xD6, 0x80, 0x45, 0x58, 0x82, 0x51, 0x96, 0x1D, 0xFA,
+    0x07, 0xA0, 0x93, 0x0E, 0x4A, 0xDF, 0x8A, 0x9A, 0x23, 0xF9, 0x82, 0x69, 0x4B, 0xC5, 0xBE, 0xC8,
+    0xC6, 0x73, 0x6E, 0xAB, 0x7F, 0x29, 0xE5, 0x9B, 0xCB, 0x46, 0x7D, 0xE9, 0x75, 0x89, 0xC7, 0x01,
+    0xB2, 0x0C, 0x65, 0x2F, 0x7A, 0x35, 0x40, 0xB3, 0xCF, 0x41, 0xC5, 0x53, 0x47, 0x3D, 0xB1, 0xB8,
+    0xC1, 0x1D, 0x94, 0xA0, 0x5E, 0x5D, 0xB0, 0x40, 0xF3, 0xC1, 0x18, 0x63, 0x36, 0x53, 0x83, 0xCE,
+    0x23, 0x51, 0x3C, 0x02, 0xD2, 0x69, 0xA5, 0x91, 0xE3, 0x51, 0x0C, 0x55, 0x7D, 0x99, 0x71, 0x3E,
+    0xE2, 0x0C, 0x29, 0x46, 0xCE, 0x81, 0xCE, 0x6F, 0xB4, 0x45, 0x89, 0x22, 0xE5, 0xF2, 0x77, 0x8E,
+    0x72, 0x60, 0x6A, 0x7E, 0xFC, 0x80, 0x49, 0xBD, 0x8E, 0x0E, 0xC8, 0xA7, 0x4F, 0x98, 0xEA, 0x5F,
+    0x1A, 0xB3, 0x06, 0xFE, 0x24, 0x56, 0x53, 0x3E, 0x7D, 0xCA, 0xE3, 0xEC, 0xD9, 0xA3, 0x85, 0xD6,
+    0x7B, 0x13, 0xB6, 0x2F, 0xC5, 0xC4, 0xA5, 0x1A, 0xE9, 0xC4, 0x06, 0x64, 0x0E, 0xDF, 0x3C, 0x07,
+    0xD5, 0x53, 0xF7, 0xED, 0xF1, 0xB5, 0xCF, 0xBF, 0x2B, 0x98, 0x01, 0x45, 0x00, 0x85, 0x28, 0x5E,
+    0xD8, 0xA3, 0x43, 0xBC, 0xE8, 0xDB, 0x27, 0x62, 0x9E, 0xDF, 0x69, 0x31, 0x3E, 0x78, 0xB8, 0x81,
+    0x59, 0x7D, 0x77, 0xE6, 0x0E, 0x5F, 0x35, 0x18, 0x0A, 0x50, 0x18, 0xC6, 0xBE, 0x9B, 0x45, 0x1F,
+    0x6A, 0xCF, 0xB6, 0x97, 0x1D, 0x39, 0xCF, 0xC5, 0xE2, 0x80, 0x0C, 0x85, 0x4A, 0x54, 0x8F, 0xCC,
+    0xFF, 0x81, 0xDD, 0xDB, 0x81, 0xE7, 0x30, 0x10, 0x46, 0xF9, 0x20, 0x52, 0xE0, 0x2C, 0x5B, 0x62,
+    0x17, 0xFB, 0x55, 0xBF, 0x44, 0x79, 0xA4, 0x94, 0x6C, 0xE2, 0x04, 0x84, 0xB7, 0x5B, 0x01, 0x29,
+    0xBD, 0xC7, 0x12, 0xBC, 0x6C, 0x78, 0x82, 0x66, 0x51, 0x41, 0x38, 0x4B, 0x63, 0x1A, 0xC9, 0x35,
+    0xF9, 0xEF, 0xDF, 0xDF, 0xB5, 0x55, 0xBD, 0x8E, 0xDD, 0x44, 0x14, 0x3E, 0xF7, 0x5A, 0xBB, 0x06,
+    0xB9, 0x70, 0x8A, 0xA4, 0x20, 0x29, 0xFC, 0x06, 0xF8, 0x05, 0x10, 0x73, 0x09, 0x05, 0x25, 0x29,
+    0x80, 0x22, 0x0D, 0xCD, 0x56, 0x69, 0xD2, 0x50, 0x22, 0x8D, 0x57, 0x79, 0x81, 0xFB, 0x06, 0x54,
+    0x34, 0x1B, 0xA4, 0x7D, 0x01, 0x88, 0xBD, 0x14, 0x50, 0xC6, 0x40, 0x41, 0x41, 0x63, 0x29, 0x5B,
+    0x20, 0xA5, 0xC8, 0x20, 0x8C, 0xE4, 0xBD, 0x6B, 0xFB, 0xE3, 0x3B, 0x67, 0x7C, 0x6F, 0x36, 0x05,
+    0x48, 0x14, 0xB8, 0x38, 0x9E, 0x99, 0x33, 0xE7, 0xCC, 0xF9, 0xF9, 0xE6, 0x9B, 0xD5, 0x27, 0x22,
+    0x2B, 0x04, 0x91, 0x1C, 0x8D, 0xC8, 0x31, 0x44, 0x24, 0x19, 0x29, 0xF2, 0x20, 0x27, 0x19, 0xA6,
+    0x6C, 0x28, 0x10, 0x7C, 0x48, 0xC6, 0x04, 0x55, 0x1E, 0xCA, 0x46, 0x5C, 0x43, 0x2D, 0xB2, 0x56,
+    0x92, 0x19, 0x6A, 0x34, 0x8B, 0xB8, 0x5F, 0x6D, 0x69, 0xA4, 0x61, 0xDE, 0xD3, 0xB0, 0x0C, 0xE2,
+    0x1B, 0x17, 0x0A, 0xB4, 0x3E, 0xD4, 0xD8, 0xD4, 0x1D, 0xDD, 0xDD, 0x16, 0xFD, 0x56, 0x0F, 0x12,
+    0x80, 0x2B, 0x8D, 0x03, 0x42, 0x41, 0x9F, 0xE8, 0x13, 0x34, 0xEE, 0xC3, 0x59, 0xEA, 0x6F, 0x92,
+    0xE0, 0xBA, 0xBC, 0x15, 0x97, 0xCC, 0xEB, 0x41, 0x64, 0xEB, 0x3A, 0xAF, 0xA1, 0xCC, 0xB9, 0x5A,
+    0xBB, 0x6B, 0x0D, 0x89, 0xDB, 0x1B, 0x9D, 0x00, 0x51, 0xD3, 0xEB, 0xA4, 0xAB, 0x1B, 0x9D, 0x24,
+    0xB0, 0x49, 0xD9, 0xEB, 0x44, 0x74, 0x9F, 0xEB, 0x32, 0xAE, 0xA5, 0xD8, 0xBA, 0x91, 0x12, 0x9A,
+    0xA3, 0x47, 0x48, 0x51, 0x69, 0x20, 0x47, 0x1B, 0x95, 0xEF, 0x68, 0x00, 0x79, 0x4F, 0x87, 0x6B,
+    0x3C, 0xD9, 0xD5, 0x8D, 0xEF, 0x5D, 0x3A, 0xE6, 0x5D, 0xD2, 0xF9, 0x8B, 0x51, 0xDE, 0x4D, 0x47,
+    0xC7, 0x3D, 0xFE, 0x55, 0xA7, 0x5E, 0x40, 0x03, 0xFF, 0x1B, 0xA3, 0xE0, 0x2A, 0x17, 0xFC, 0x85,
+    0xFA, 0x1E, 0x73, 0x2E, 0xD0, 0xAC, 0x93, 0x1A, 0xF7, 0x59, 0x1F, 0xF4, 0xD9, 0xA4, 0x7E, 0xEF,
+    0x48, 0xFC, 0x98, 0xA4, 0xC3, 0x08, 0x74, 0x0E, 0xC3, 0xBD, 0x99, 0x5E, 0xAA, 0x74, 0x62, 0xB1,
+    0x37, 0xFF, 0x28, 0xE7, 0xB3, 0xA7, 0x94, 0xD0, 0x1A, 0x2D, 0x72, 0xFE, 0xF4, 0xB3, 0x7F, 0xD9,
+    0x6F, 0xF2, 0x1E, 0xDD, 0xE2, 0xD2, 0xCE, 0x9A, 0xA3, 0xD4, 0xB3, 0xD7, 0xD3, 0x6B, 0xB9, 0x1A,
+    0x2D, 0x9C, 0x28, 0x07, 0x93, 0x5F, 0x2C, 0x01, 0x66, 0x08, 0x98, 0x29, 0x8A, 0x5E, 0xB0, 0x61,
+    0x45, 0x21, 0x37, 0x04, 0x23, 0x58, 0xC4, 0xEE, 0xEC, 0x0D, 0x85, 0x89, 0x41, 0xB0, 0xAD, 0x91,
+    0x6A, 0x82, 0x19, 0xC6, 0x3D, 0x6E, 0xD6, 0x26, 0xF4, 0x90, 0x95, 0xF6, 0x47, 0x82, 0x8A, 0x5B,
+    0xB1, 0x1E, 0xDA, 0x40, 0x4D, 0x0B, 0xB3, 0xC2, 0xE0, 0x07, 0x54, 0x2B, 0x0E, 0x2D, 0x89, 0xFB,
+    0x03, 0x03, 0x48, 0xA7, 0xAC, 0xF5, 0xAD, 0x14, 0x7D, 0xF9, 0x01, 0xCB, 0xED, 0xDB, 0x93, 0x98,
+    0x9F, 0x14, 0xBB, 0xB3, 0x73, 0xE6, 0xE1, 0x69, 0xD3, 0x73, 0x81, 0x5F, 0x2B, 0xB1, 0x30, 0x62,
+    0x56, 0x54, 0xA9, 0x95, 0xED, 0xE5, 0x68, 0x6F, 0x65, 0xAA, 0x55, 0x3D, 0x88, 0x9F, 0x89, 0x99,
+    0x91, 0x89, 0x2C, 0x0D, 0x89, 0xC1, 0xE4, 0x20, 0x38, 0xA1, 0xC9, 0xE3, 0x0F, 0xA6, 0xBE, 0xAB,
+    0x35, 0xAB, 0x34, 0x70, 0x18, 0xDE, 0xD7, 0x61, 0xD2, 0x52, 0x1B, 0x62, 0xFE, 0x82, 0xB3, 0xF3,
+    0x10, 0xD3, 0xD6, 0x32, 0x1D, 0x86, 0x15, 0x8B, 0xA0, 0x25, 0x08, 0xE6, 0x6C, 0xE9, 0xBA, 0xA6,
+    0xA9, 0xBD, 0x33, 0x53, 0x3D, 0xED, 0x18, 0xBB, 0x73, 0xC5, 0x0F, 0xC3, 0x51, 0xC0, 0x68, 0x64,
+    0x4E, 0xCB, 0xC2, 0x58, 0x15, 0xA8, 0x0C, 0xD6, 0xD0, 0x7B, 0x53, 0x7D, 0x4D, 0x98, 0xAA, 0x9A,
+    0xA9, 0x9A, 0x9A, 0x7F, 0x53, 0xA7, 0x68, 0xCC, 0x7A, 0x8D, 0xCA, 0xAC, 0x13, 0x44, 0x6B, 0x6A,
+    0xCC, 0xBA, 0x0C, 0xD1, 0x79, 0x7D, 0x51, 0xF7, 0x2B, 0x5C, 0xAE, 0x41, 0xE4, 0x39, 0x84, 0x6C,
+    0x20, 0x08, 0x59, 0x7C, 0xD7, 0xC6, 0x6B, 0xB8, 0x84, 0x9A, 0x0F, 0x0B, 0x4E, 0xF5, 0x5A, 0xC9,
+    0x71, 0x1D, 0x2B, 0x53, 0xC6, 0x2B, 0x22, 0x65, 0xB7, 0x4F, 0x48, 0x13, 0x99, 0x14, 0x2D, 0x5A,
+    0xF9, 0x15, 0xBE, 0xD6, 0x1B, 0x9D, 0xF7, 0x86, 0x2D, 0x6C, 0xCA, 0x36, 0x4E, 0x8E, 0x6C, 0xF2,
+    0x4A, 0x51, 0xB4, 0xD6, 0xED, 0x9C, 0x5C, 0xF9, 0x60, 0xDB, 0x50, 0xE9, 0x36, 0x5E, 0x17, 0x9D,
+    0xF8, 0x06, 0x1B, 0xD7, 0x25, 0x63, 0x0D, 0x32, 0x8E, 0x7B, 0xCE, 0xB8, 0xC6, 0x24, 0x1E, 0xEC,
+    0x2D, 0x8C, 0x34, 0x06, 0x85, 0x1B, 0x31, 0x7C, 0x6E, 0xFA, 0xC2, 0x70, 0x2D, 0xCF, 0xF4, 0xEA,
+    0x3E, 0x52, 0x91, 0x41, 0xD3, 0xF1, 0x57, 0x96, 0x51, 0xF5, 0xF8, 0x92, 0xA0, 0x58, 0x13, 0xFC,
+    0xF9, 0x90, 0xED, 0x78, 0x5E, 0x28, 0x02, 0x79, 0xA6, 0x73, 0xAD, 0x23, 0xA8, 0x5C, 0xA3, 0x44,
+    0xE1, 0x0F, 0x12, 0xAF, 0xC7, 0x6D, 0xAD, 0x5A, 0x5E, 0x62, 0xEE, 0x23, 0x6B, 0x95, 0x44, 0x40,
+    0x39, 0xE4, 0x7F, 0xD1, 0xCF, 0x4C, 0x6C, 0xB3, 0x99, 0x3F, 0x23, 0xBC, 0x25, 0xB5, 0xB5, 0x32,
+    0xC3, 0x35, 0x06, 0xBD, 0xDF, 0x4C, 0xF6, 0x68, 0x4B, 0x9C, 0x47, 0xA2, 0xB9, 0x43, 0xE8, 0x67,
+    0xA8, 0x1C, 0x11, 0x73, 0x3A, 0x67, 0x01, 0x59, 0xEF, 0xBE, 0x9F, 0x5C, 0x3B, 0xA7, 0x03, 0xD2,
+    0xA1, 0x78, 0x31, 0x15, 0x9D, 0xFF, 0x98, 0x4B, 0x23, 0x7D, 0xE7, 0x81, 0xEB, 0xB5, 0xD4, 0x3F,
+    0x11, 0x5A, 0xF4, 0xF9, 0xB2, 0x7A, 0xAC, 0x7E, 0x8F, 0x1E, 0x28, 0x65, 0x3C, 0xDA, 0x2A, 0xD1,
+    0x34, 0xB9, 0x92, 0x12, 0x9E, 0x4E, 0xE4, 0x12, 0xF7, 0x11, 0xBB, 0xFA, 0x0B, 0x64, 0xCD, 0xA0,
+    0xE4, 0x96, 0xD6, 0x87, 0xDC, 0x2A, 0x64, 0x5A, 0x31, 0xC4, 0xE8, 0xE9, 0xCA, 0x78, 0xD9, 0xAC,
+    0x15, 0x60, 0x31, 0xDC, 0xA4, 0x5C, 0x75, 0xF5, 0x50, 0x91, 0xCD, 0x88, 0xD8, 0x85, 0x12, 0x2C,
+    0x4F, 0xA1, 0x14, 0x19, 0x22, 0x03, 0x94, 0xC6, 0xDA, 0x1B, 0xBB, 0x22, 0xF6, 0x31, 0x8F, 0x1C,
+    0x1D, 0x0F, 0x3E, 0xC5, 0x57, 0x23, 0xAB, 0xF5, 0xE3, 0x98, 0xF4, 0x75, 0x75, 0x5B, 0xB1, 0x41,
+    0x20, 0xD8, 0xAF, 0xB1, 0x13, 0xFC, 0x20, 0x4F, 0x60, 0xF7, 0xA8, 0x29, 0xD1, 0x09, 0x9F, 0x00,
+    0xF9, 0x52, 0x56, 0x19, 0x9F, 0x04, 0xAD, 0xD2, 0x46, 0xEE, 0x46, 0xD8, 0x28, 0x3F, 0x03, 0x37,
+    0xC4, 0x06, 0xD5, 0x33, 0x27, 0x8B, 0xF8, 0xEE, 0x6D, 0x8A, 0x13, 0x73, 0xFD, 0xDF, 0xC4, 0x31,
+    0x7E, 0x5F, 0xA8, 0x3F, 0xF2, 0x7F, 0xC4, 0xB0, 0x41, 0x62, 0x3A, 0x90, 0xDB, 0xB7, 0x2A, 0xDE,
+    0x3B, 0x60, 0xF6, 0x4F, 0x6D, 0xDA, 0x7C, 0xBE, 0xAB, 0x49, 0xEB, 0xC5, 0xF3, 0x0B, 0x24, 0x2F,
+    0x82, 0x6F, 0x7A, 0x29, 0x82, 0x72, 0xF7, 0xE2, 0x42, 0x8B, 0xBA, 0x5F, 0x58, 0xC3, 0x3A, 0xC0,
+    0xBF, 0x56, 0x56, 0x5F, 0x9E, 0x64, 0x58, 0xFC, 0x97, 0x8A, 0xCC, 0x46, 0x0E, 0x5F, 0x81, 0xB1,
+    0xC4, 0x4B, 0x65, 0x8F, 0xDE, 0xB3, 0x4F, 0x9D, 0xDE, 0x41, 0x3E, 0x30, 0x5D, 0x4A, 0x6E, 0x18,
+    0xD5, 0x0A, 0xA7, 0x5A, 0xEC, 0x30, 0xE9, 0x7B, 0xA4, 0x2F, 0x99, 0x87, 0x05, 0x55, 0xED, 0xAF,
+    0x9B, 0x31, 0x40, 0x1E, 0x9F, 0x35, 0x79, 0x63, 0xB1, 0x9C, 0xF5, 0xAD, 0x81, 0xF5, 0x6A, 0x96,
+    0xFF, 0xFB, 0xFB, 0x1B, 0xC5, 0x54, 0x3D, 0xAF, 0xDD, 0x44, 0x10, 0x1D, 0xFB, 0x2A, 0xEF, 0x4A,
+    0xB8, 0xD8, 0x57, 0x40, 0x93, 0x14, 0xEE, 0x11, 0x92, 0x7F, 0x01, 0x59, 0x93, 0x57, 0x50, 0x50,
+    0x3C, 0x0A, 0x52, 0x3F, 0x09, 0xD1, 0x23, 0xF1, 0x07, 0x7C, 0x25, 0x0A, 0x8A, 0x34, 0xA9, 0xA9,
+    0x69, 0x12, 0x90, 0xF8, 0x03, 0x4F, 0xB2, 0x03, 0x05, 0x05, 0x8D, 0x05, 0x45, 0xDA, 0xCB, 0x97,
+    0xA2, 0x28, 0x05, 0xFB, 0xA4, 0x8D, 0x64, 0xC2, 0xDA, 0x87, 0x73, 0xD6, 0x37, 0xBA, 0x01, 0x04,
+    0x82, 0x06, 0xAE, 0xAE, 0xC6, 0xE3, 0x5D, 0xCF, 0x9C, 0x99, 0x33, 0x1F, 0x66, 0x66, 0x05, 0x70,
+    0x86, 0x1F, 0x90, 0x1C, 0x1F, 0x3B, 0x17, 0x36, 0x8B, 0xF9, 0x9D, 0x4B, 0x45, 0xB2, 0x3A, 0xBA,
+    0x60, 0x7E, 0xEF, 0x5B, 0xEB, 0xBF, 0x48, 0x66, 0x70, 0xA3, 0x95, 0x4B, 0x67, 0xB6, 0x59, 0x26,
+    0x33, 0x87, 0xC1, 0xAC, 0x5E, 0x68, 0xEF, 0x03, 0x45, 0xCF, 0xB7, 0x42, 0x6F, 0x5B, 0xDE, 0x59,
+    0xBD, 0xA7, 0xE8, 0x76, 0x7C, 0xC3, 0x5D, 0x2A, 0xD8, 0x59, 0x71, 0xFF, 0x9E, 0xAD, 0xBF, 0x1A,
+    0xA9, 0xC1, 0x13, 0x2C, 0x15, 0x62, 0x37, 0xD3, 0xFD, 0x06, 0x46, 0x98, 0x6E, 0xBF, 0x0D, 0xE6,
+    0xD2, 0x86, 0xD6, 0x78, 0x83, 0x60, 0x4D, 0x98, 0x09, 0x34, 0x77, 0xF2, 0x03, 0x13, 0x1C, 0xBD,
+    0xF5, 0x20, 0xA8, 0x07, 0x82, 0x15, 0x17, 0xF3, 0x3B, 0xBC, 0xD7, 0x8D, 0x29, 0x90, 0x35, 0x88,
+    0x66, 0x69, 0xF5, 0xB9, 0xCC, 0xB1, 0xAC, 0x68, 0x7F, 0x97, 0xDC, 0x7E, 0x4D, 0xAE, 0x7B, 0xF0,
+    0x3C, 0xB9, 0xD9, 0xD3, 0xE7, 0xB3, 0x68, 0x56, 0xC9, 0xA7, 0xA3, 0x8B, 0x93, 0x7E, 0xD9, 0xD1,
+    0x19, 0x71, 0x4A, 0xFC, 0x93, 0xE4, 0x18, 0x62, 0x10, 0x22, 0x3E, 0x44, 0x2A, 0x10, 0x0A, 0xB4,
+    0x86, 0xD1, 0x45, 0x86, 0x31, 0xF4, 0x2D, 0x7D, 0x7C, 0x34, 0xC9, 0x53, 0x37, 0x28, 0x76, 0xA2,
+    0x52, 0x2A, 0xF8, 0x2A, 0xE7, 0xE1, 0x99, 0x31, 0x2F, 0x25, 0xEB, 0x9F, 0x75, 0xB9, 0xD4, 0xE2,
+    0x39, 0x34, 0xE2, 0xA4, 0xF5, 0xD1, 0xAA, 0xC9, 0xBA, 0x60, 0xFD, 0x8F, 0x05, 0x7E, 0xA9, 0x31,
+    0x79, 0xA4, 0x1E, 0xA3, 0xC8, 0x90, 0xED, 0x90, 0x99, 0x90, 0x28, 0x15, 0xA3, 0x55, 0xFB, 0xCC,
+    0x75, 0x2B, 0xF9, 0x5A, 0x8E, 0x6C, 0x83, 0xA9, 0x9B, 0x3D, 0x6E, 0x61, 0xD7, 0xED, 0x9B, 0xB1,
+    0xC0, 0x59, 0xB4, 0x6D, 0x9A, 0x45, 0x95, 0x98, 0x0D, 0x62, 0x5B, 0x2E, 0x98, 0xBD, 0x67, 0x50,
+    0xD5, 0x15, 0xC8, 0x87, 0x4B, 0xD6, 0xEF, 0x7C, 0xF4, 0x8B, 0xC3, 0xAF, 0xF8, 0x0E, 0xB9, 0x10,
+    0x72, 0x2C, 0x72, 0x49, 0x98, 0xD9, 0xA5, 0x48, 0x19, 0xEC, 0xF8, 0x03, 0x10, 0x81, 0x0D, 0x1F,
+    0x5F, 0x91, 0xF4, 0x87, 0x4B, 0xB7, 0x45, 0x7B, 0xD3, 0xC5, 0x4B, 0x7A, 0x8A, 0xFE, 0x9B, 0xE0,
+    0x43, 0x39, 0xE0, 0xAD, 0x96, 0x00, 0x44, 0x53, 0xF9, 0xC8, 0x0D, 0xAF, 0xCC, 0x8F, 0xB9, 0x82,
+    0xA2, 0xEB, 0x5F, 0x5F, 0x9D, 0x10, 0x0C, 0x8F, 0x85, 0x0C, 0xA4, 0x4D, 0x7E, 0x64, 0x4E, 0x0E,
+    0xA4, 0xAC, 0xAC, 0xD8, 0x26, 0xD3, 0x62, 0xD5, 0x68, 0x47, 0x62, 0x0E, 0xCC, 0xE4, 0xA8, 0x6B,
+    0x7C, 0x49, 0xF3, 0x6E, 0x71, 0x77, 0x9E, 0x86, 0x6E, 0xB8, 0xD9, 0x7C, 0x3B, 0xC0, 0x62, 0x7F,
+    0xBE, 0x49, 0x76, 0x6B, 0x3E, 0x65, 0x83, 0x56, 0x51, 0xFE, 0x9A, 0x51, 0xEE, 0xFA, 0x96, 0xC7,
+    0xE5, 0x6C, 0x7F, 0x38, 0xC6, 0xFD, 0x4F, 0xE7, 0xB6, 0x16, 0xFE, 0xD0, 0x4B, 0x1E, 0x61, 0x33,
+    0x57, 0xE6, 0x33, 0xE8, 0x65, 0x6E, 0xCB, 0xF0, 0x02, 0x67, 0xEC, 0x51, 0x62, 0xBF, 0x09, 0x38,
+    0xA4, 0x13, 0x8C, 0x15, 0x5A, 0xCD, 0x44, 0xD2, 0x9F, 0xE9, 0xF1, 0xCF, 0xC4, 0x31, 0xF0, 0x6C,
+    0x3D, 0xAE, 0x16, 0x9D, 0xD5, 0xF8, 0x78, 0x1D, 0x06, 0xA8, 0x84, 0x6A, 0xA6, 0x97, 0xEE, 0xE5,
+    0x21, 0x58, 0xE7, 0x61, 0x1D, 0x0D, 0x91, 0x74, 0x98, 0x8D, 0x92, 0x14, 0x1D, 0x86, 0xA3, 0xF8,
+    0x73, 0xD3, 0xAC, 0x61, 0xAE, 0xE4, 0xBC, 0xD8, 0x34, 0x25, 0x29, 0xC1, 0x1D, 0x5C, 0x61, 0xE6,
+    0xE4, 0x60, 0x57, 0x4D, 0x2C, 0x40, 0xB3, 0x27, 0xFD, 0xFD, 0xE0, 0xD9, 0x43, 0xAD, 0x42, 0x65,
+    0xC7, 0x6E, 0x59, 0x75, 0x4E, 0x41, 0x27, 0x7B, 0x16, 0x6A, 0x6D, 0x25, 0x37, 0xAB, 0xB3, 0xF9,
+    0xEA, 0x73, 0x4F, 0x57, 0xC2, 0xAC, 0x05, 0xA9, 0xA1, 0x36, 0x01, 0x96, 0xFA, 0xBE, 0x58, 0x49,
+    0xD8, 0x2A, 0xFD, 0xB9, 0xD3, 0xF8, 0x3C, 0xE8, 0x63, 0x89, 0x71, 0x4D, 0x36, 0x67, 0xFF, 0x5C,
+    0x3D, 0x95, 0xEA, 0xA8, 0x36, 0x53, 0xC0, 0xC0, 0x34, 0x3E, 0x27, 0x49, 0xA2, 0xFB, 0xC0, 0xC0,
+    0xAB, 0x31, 0xCF, 0x6D, 0xCE, 0x3A, 0x64, 0x1A, 0x56, 0x02, 0xB2, 0x9A, 0x97, 0x43, 0xAD, 0x50,
+    0x68, 0x98, 0x13, 0xAD, 0x04, 0xD6, 0x13, 0x76, 0x8F, 0x5D, 0x13, 0xAA, 0x89, 0x23, 0xDE, 0x4B,
+    0x49, 0x1F, 0xC0, 0xBA, 0xAF, 0x9B, 0xA0, 0x5E, 0xA2, 0x05, 0xC9, 0xBA, 0xFE, 0x8C, 0x2C, 0x55,
+    0x0D, 0x33, 0x78, 0x57, 0x74, 0x35, 0x79, 0x48, 0x02, 0x49, 0x5E, 0x7B, 0xCB, 0xE5, 0x27, 0xC0,
+    0xD1, 0x28, 0x7A, 0xCD, 0xC7, 0x56, 0x09, 0x5B, 0xA6, 0xE3, 0x77, 0xEA, 0xFB, 0x93, 0x4A, 0x80,
+    0x49, 0xD9, 0x32, 0x86, 0xEE, 0x69, 0x0D, 0x7D, 0xC0, 0x24, 0x3B, 0xB1, 0x49, 0xB5, 0x8E, 0xFA,
+    0x36, 0xAB, 0xEE, 0xA0, 0xDE, 0x40, 0xDB, 0x2C, 0xE7, 0x58, 0xB8, 0x38, 0x81, 0xEF, 0x95, 0xED,
+    0xCB, 0x5A, 0x34, 0x51, 0xB8, 0x74, 0x7B, 0x43, 0x84, 0x67, 0x14, 0xDA, 0xD2, 0xBD, 0x16, 0x31,
+    0x8A, 0xF7, 0x38, 0xDC, 0x7D, 0x52, 0xF4, 0x49, 0x88, 0xB1, 0xC0, 0xC8, 0x15, 0x3B, 0xB3, 0x86,
+    0x75, 0x64, 0x29, 0xBB, 0xD1, 0x4D, 0x04, 0xF4, 0x7F, 0x75, 0x34, 0xAA, 0x1A, 0x8F, 0xB8, 0x31,
+    0xB4, 0x1C, 0xEC, 0xFA, 0x27, 0x6B, 0x81, 0xDA, 0xDC, 0x6A, 0xC4, 0xC4, 0x4F, 0x5C, 0x18, 0xA4,
+    0xCB, 0x4D, 0x8E, 0xA5, 0xDE, 0x26, 0x5F, 0x25, 0x2D, 0x6B, 0x37, 0x49, 0x5E, 0x44, 0x49, 0x0D,
+    0xC0, 0xEC, 0xF3, 0x4C, 0xE6, 0x01, 0x4D, 0x6B, 0x78, 0x56, 0x4F, 0xC7, 0xC6, 0x74, 0xF3, 0x5A,
+    0x86, 0x36, 0x37, 0x6C, 0x2C, 0x3E, 0x53, 0x69, 0x54, 0x48, 0x45, 0x9C, 0x9B, 0x47, 0xE8, 0xAF,
+    0xBC, 0x4D, 0x71, 0xED, 0x6E, 0x6E, 0x46, 0xF1, 0x9E, 0x8A, 0xB3, 0xE5, 0x22, 0xBD, 0x5E, 0xEF,
+    0xDD, 0x55, 0x84, 0xF9, 0x87, 0x8F, 0x92, 0xE1, 0x5C, 0x76, 0x8D, 0x26, 0xBF, 0xC4, 0xED, 0xDB,
+    0xED, 0x56, 0xEE, 0x9D, 0xF0, 0xB8, 0x36, 0x4F, 0xE5, 0x6E, 0xE0, 0x66, 0x5E, 0xE4, 0x98, 0xE5,
+    0xB9, 0x26, 0x87, 0xFF, 0x73, 0x52, 0x3E, 0x77, 0x60, 0x33, 0x1C, 0x65, 0xBD, 0xCB, 0xD6, 0x59,
+    0x56, 0xAD, 0xFD, 0x37, 0xBF, 0xDF, 0x00, 0x8D, 0x55, 0xBD, 0x8E, 0xE4, 0x44, 0x10, 0x2E, 0x8F,
+    0xB5, 0xEB, 0xC0, 0x41, 0x6F, 0x40, 0xC4, 0x4A, 0x38, 0x21, 0x22, 0xC0, 0x39, 0xD2, 0xA9, 0x0D,
+    0x17, 0x5E, 0xC0, 0x05, 0x2C, 0x29, 0x8F, 0x70, 0x6F, 0x40, 0xFB, 0x08, 0x88, 0xE7, 0x11, 0x08,
+    0x90, 0x90, 0x6E, 0x91, 0x96, 0x07, 0x40, 0xDB, 0x06, 0x02, 0x02, 0x82, 0xEB, 0x8C, 0x80, 0x00,
+    0x9F, 0x74, 0xE8, 0x24, 0x12, 0x7A, 0x85, 0x83, 0xBE, 0xA5, 0xED, 0xE2, 0xAB, 0xB2, 0x67, 0x77,
+    0xF9, 0x3B, 0x31, 0xD2, 0x54, 0xD7, 0xB4, 0xCB, 0x55, 0x5F, 0x55, 0x7D, 0x55, 0x43, 0x74, 0xB4,
+    0x27, 0xDA, 0x71, 0x26, 0xB2, 0x9C, 0x8B, 0xFB, 0xCB, 0x47, 0xF9, 0x5E, 0x33, 0x9A, 0xAB, 0x89,
+    0xC9, 0xFE, 0xF8, 0x22, 0x13, 0xBF, 0xCF, 0xCC, 0xB9, 0x85, 0x88, 0x3B, 0x3E, 0x3B, 0xEB, 0x2A,
+    0x18, 0x92, 0x99, 0x20, 0xEC, 0x44, 0x27, 0xE4, 0x98, 0x07, 0xF2, 0xCC, 0x04, 0x6D, 0xC4, 0x83,
+    0x88, 0x07, 0xED, 0x00, 0xF1, 0x31, 0xBE, 0x45, 0x82, 0x28, 0x03, 0xC4, 0x31, 0x89, 0xC6, 0xFC,
+    0x94, 0xF9, 0x98, 0xFB, 0x6A, 0xA6, 0x66, 0x22, 0x17, 0x0A, 0xEE, 0x5E, 0xA1, 0x16, 0xFE, 0x25,
+    0x10, 0x21, 0x2E, 0x1C, 0xED, 0x8F, 0x3B, 0xF5, 0x10, 0xCD, 0xA0, 0xE7, 0xD4, 0xAC, 0x27, 0x7B,
+    0x3D, 0xC9, 0x2F, 0x7A, 0xD0, 0xD1, 0x43, 0xBA, 0xFD, 0x14, 0x7B, 0x91, 0xC7, 0x80, 0x5C, 0x00,
+    0xA5, 0x1D, 0x0D, 0xEF, 0x98, 0x7B, 0x1F, 0x0D, 0x77, 0x8F, 0x52, 0xC1, 0xB1, 0xF6, 0x83, 0x89,
+    0xE5, 0x32, 0x92, 0x19, 0x4D, 0xAC, 0x90, 0x52, 0x15, 0x4D, 0x34, 0xC8, 0xA2, 0x4C, 0x26, 0x6A,
+    0x80, 0x6C, 0xA2, 0x95, 0xC0, 0xFE, 0xE2, 0x5A, 0x03, 0xA0, 0x0A, 0x2C, 0x8E, 0xE5, 0xEC, 0x61,
+    0xB7, 0x98, 0xE8, 0x60, 0x67, 0xC4, 0x0E, 0x30, 0x1B, 0x79, 0x0F, 0x39, 0x5B, 0xF1, 0x33, 0xC3,
+    0x5C, 0xFC, 0x32, 0x8A, 0x2B, 0x71, 0x78, 0xA8, 0xB9, 0x6B, 0x17, 0x5C, 0xB6, 0x8B, 0xE0, 0x70,
+    0xC9, 0x25, 0x54, 0xA4, 0x6F, 0x96, 0x23, 0xCD, 0xAD, 0x00, 0xF4, 0x13, 0x12, 0xD5, 0x0C, 0x56,
+    0x2E, 0xE6, 0x4A, 0x8A, 0x69, 0xA2, 0x44, 0x44, 0x6F, 0x34, 0xD1, 0x8B, 0xCF, 0x6E, 0xB2, 0x7B,
+    0x53, 0x33, 0x44, 0x40, 0xEE, 0xF9, 0x3D, 0x7E, 0xCC, 0x53, 0x9B, 0x9A, 0xB9, 0xCC, 0x15, 0x77,
+    0x75, 0xB4, 0x03, 0xE0, 0xB6, 0xF7, 0xB3, 0x24, 0x91, 0xED, 0x77, 0xF0, 0x53, 0xFF, 0xB1, 0x2C,
+    0x6B, 0x02, 0xC8, 0xD3, 0xBE, 0x98, 0x01, 0xBB, 0xC6, 0x13, 0xDC, 0x31, 0xCC, 0x22, 0x20, 0xDB,
+    0x01, 0x08, 0xC5, 0x01, 0xD0, 0x3D, 0xE6, 0xD4, 0x26, 0x17, 0x5B, 0xEE, 0x7C, 0xF8, 0x40, 0x82,
+    0x69, 0x59, 0x1F, 0xA2, 0x17, 0x35, 0x1A, 0x12, 0xDA, 0x7C, 0xBA, 0x90, 0xCB, 0xA0, 0x02, 0x7F,
+    0x59, 0xE5, 0x32, 0x53, 0x95, 0x81, 0xB5, 0xCA, 0x26, 0x40, 0x20, 0x66, 0xC5, 0x9C, 0x44, 0xA0,
+    0x91, 0x10, 0x41, 0xEA, 0x1F, 0x61, 0x6C, 0x27, 0x08, 0x93, 0x44, 0xC8, 0xBB, 0xF5, 0x2A, 0x4E,
+    0xB9, 0x17, 0xA7, 0xA3, 0x49, 0x22, 0x84, 0x58, 0x8D, 0xE4, 0x6D, 0x83, 0xD4, 0x79, 0xA0, 0xE2,
+    0x82, 0xA5, 0xCF, 0xC2, 0xA4, 0x4B, 0xAD, 0xD3, 0x6B, 0x28, 0x85, 0x7B, 0xCA, 0xA3, 0x8B, 0x2E,
+    0xD8, 0x6C, 0xA6, 0x26, 0x94, 0x33, 0x02, 0xF3, 0x83, 0x11, 0x45, 0x9A, 0xC9, 0x00, 0x64, 0xB9,
+    0x3C, 0x62, 0x12, 0xEC, 0x36, 0x98, 0x64, 0xA6, 0x1D, 0x97, 0x33, 0xB9, 0x1F, 0x38, 0x36, 0xBF,
+    0xB3, 0x44, 0xA7, 0x42, 0x4A, 0xE1, 0xE1, 0xCD, 0x0E, 0x1A, 0xA8, 0xF0, 0x23, 0x9A, 0x84, 0xC6,
+    0xBF, 0xDD, 0x6F, 0xC5, 0x85, 0x17, 0xF8, 0x92, 0x36, 0x0F, 0x05, 0xD8, 0x1D, 0xC0, 0x38, 0x23,
+    0x13, 0x42, 0x40, 0x04, 0x12, 0xFE, 0x55, 0x75, 0xA2, 0x56, 0xAA, 0x5E, 0x8A, 0x6A, 0x82, 0xA8,
+    0x59, 0xD4, 0x66, 0x80, 0x5A, 0x26, 0xA8, 0x27, 0xAE, 0x33, 0xB9, 0xFC, 0x39, 0x42, 0x75, 0x33,
+    0xB5, 0xCB, 0x03, 0xEE, 0x31, 0x54, 0x76, 0x04, 0x05, 0x46, 0x54, 0xB7, 0x94, 0xB1, 0x22, 0x27,
+    0xF1, 0xEB, 0xA8, 0xDD, 0x57, 0x18, 0x8A, 0x27, 0xDE, 0x62, 0xEA, 0xAD, 0xE0, 0x6A, 0x7E, 0x01,
+    0xFB, 0xDA, 0x1D, 0xB2, 0xF8, 0xBA, 0x4E, 0x00, 0xD1, 0x82, 0xC2, 0x83, 0xEF, 0xC9, 0xE2, 0xAA,
+    0x48, 0xB8, 0xAA, 0x03, 0xAE, 0x2C, 0xF9, 0xFE, 0x9D, 0xBC, 0x43, 0x3B, 0x83, 0x99, 0x6B, 0x46,
+    0xA0, 0x06, 0x64, 0xC9, 0x47, 0x28, 0xF0, 0x28, 0xB1, 0xF0, 0xDD, 0x25, 0xA5, 0x1B, 0xC4, 0x3D,
+    0x89, 0x70, 0xB2, 0x06, 0x82, 0xE5, 0x20, 0xA9, 0x2F, 0x50, 0x3E, 0xE5, 0xBE, 0xE0, 0x11, 0xF3,
+    0x88, 0xA9, 0xC4, 0x74, 0x42, 0x71, 0x41, 0x66, 0x93, 0x3B, 0x28, 0xDB, 0xF5, 0xF5, 0x93, 0x8B,
+    0x59, 0x16, 0x01, 0x4F, 0x3A, 0x18, 0xA1, 0x5A, 0xCE, 0x3E, 0xFC, 0x6F, 0x6B, 0x5C, 0xE7, 0xC2,
+    0x27, 0x74, 0x19, 0xD3, 0x4D, 0x6E, 0xD0, 0xC5, 0x22, 0x61, 0x6B, 0x2D, 0x81, 0xF4, 0x1D, 0x08,
+    0x64, 0x70, 0xBD, 0x90, 0xC1, 0xB1, 0x0E, 0xE0, 0xFE, 0x00, 0x2D, 0x5B, 0x2C, 0x91, 0xE8, 0xB9,
+    0x02, 0x03, 0xD1, 0xDD, 0x02, 0x6B, 0x6A, 0x14, 0x22, 0xF6, 0x0D, 0x46, 0x0C, 0xC0, 0xA5, 0x4A,
+    0x64, 0xAF, 0xCF, 0xB7, 0x2B, 0x58, 0x0D, 0x37, 0x56, 0x35, 0x28, 0x10, 0x85, 0x3E, 0x83, 0x70,
+    0x0B, 0xEE, 0x74, 0x99, 0xD9, 0x71, 0xFD, 0x55, 0x38, 0xC4, 0x6B, 0x24, 0xDC, 0xE9, 0xFE, 0x30,
+    0x64, 0x00, 0xA7, 0x3B, 0x68, 0xB4, 0x9C, 0xC0, 0xF9, 0x4A, 0x77, 0xD7, 0xBA, 0xA0, 0xFE, 0x5D,
+    0x2E, 0x4F, 0xCE, 0x57, 0xD6, 0xDF, 0x48, 0x2D, 0xC6, 0xAB, 0xDF, 0xC2, 0x08, 0x54, 0xFC, 0xFC,
+    0x10, 0x4B, 0xEB, 0x22, 0xF5, 0x48, 0xDA, 0x75, 0xED, 0xBE, 0x6C, 0x25, 0x80, 0xD3, 0x1D, 0xD0,
+    0x2A, 0xB2, 0x37, 0x0E, 0xF5, 0x68, 0x51, 0x8F, 0x11, 0xF5, 0x98, 0x51, 0x3A, 0x8C, 0x0F, 0x32,
+    0x0D, 0x20, 0x13, 0x77, 0xE6, 0x6E, 0x3D, 0x7E, 0x3D, 0xDF, 0xAE, 0x60, 0x35, 0xAC, 0x56, 0x63,
+    0x09, 0x0E, 0x46, 0x69, 0xDB, 0xB7, 0xBC, 0x1C, 0x68, 0x67, 0x85, 0x70, 0x12, 0xBD, 0x94, 0x80,
+    0xE6, 0xCE, 0x32, 0x45, 0x36, 0x86, 0x67, 0xC7, 0x91, 0xF9, 0x1B, 0x8F, 0x91, 0x0A, 0xE8, 0x11,
+    0xB8, 0x6D, 0x85, 0xD0, 0xFF, 0x50, 0x5B, 0x61, 0x7C, 0xC1, 0x2F, 0x2F, 0xB2, 0xB2, 0x76, 0x20,
+    0x50, 0x1D, 0x5E, 0xDF, 0xFA, 0x5C, 0xB7, 0x98, 0xD1, 0xF4, 0xFE, 0xAE, 0xB6, 0x0B, 0x2A, 0xDF,
+    0x82, 0xDD, 0xC2, 0xBF, 0xB0, 0xCE, 0xE6, 0x36, 0x16, 0x8A, 0x4A, 0xB9, 0x4A, 0x8D, 0xEE, 0x80,
+    0xAF, 0x56, 0x4C, 0x35, 0x5F, 0xF1, 0xE2, 0xB9, 0xE1, 0x80, 0xC1, 0x18, 0xEB, 0x84, 0xEC, 0x7C,
+    0x6F, 0x43, 0x9D, 0x65, 0xDE, 0x31, 0xFC, 0xA5, 0x0E, 0x8B, 0x78, 0x7B, 0xFD, 0x8B, 0x79, 0xE3,
+    0x56, 0x29, 0x8A, 0x43, 0x76, 0x1E, 0xD7, 0x46, 0xC2, 0xF9, 0x43, 0xF2, 0xF2, 0x97, 0x55, 0x8D,
+    0x87, 0x61, 0xE8, 0x6E, 0x33, 0x4F, 0xC0, 0x15, 0x2A, 0x64, 0x60, 0xF1, 0x8E, 0xC7, 0x81, 0x7A,
+    0x61, 0x88, 0xFD, 0xAC, 0x7F, 0x3C, 0xE2, 0xE3, 0x92, 0x49, 0xF6, 0xEB, 0xCC, 0xEF, 0xCA, 0x1F,
+    0xC5, 0xEC, 0x3E, 0xB9, 0x5A, 0x74, 0xF3, 0x5E, 0xB1, 0x1C, 0xDF, 0x3F, 0x93, 0xA3, 0xFD, 0x29,
+    0x30, 0x15, 0xD9, 0xFC, 0x36, 0xE8, 0x81, 0xB5, 0x4D, 0x3B, 0x50, 0xB2, 0xE3, 0x6E, 0x97, 0x4B,
+    0xD9, 0x57, 0x65, 0x02, 0x5D, 0xE5, 0x28, 0xB0, 0x7A, 0x84, 0x68, 0xD8, 0x9B, 0xCF, 0x41, 0xD7,
+    0x4E, 0x0B, 0x8F, 0xBD, 0xB2, 0xF2, 0x62, 0x23, 0xC6, 0xC6, 0x8C, 0x8D, 0x1A, 0x1B, 0x37, 0xA8,
+    0xED, 0xEE, 0xB0, 0xE3, 0xFF, 0x7C, 0xFE, 0x04, 0xAD, 0x55, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E,
+    0xDB, 0x77, 0x67, 0x09, 0x17, 0x4B, 0x01, 0x51, 0x38, 0x0A, 0x37, 0xF4, 0xFE, 0x0F, 0xB2, 0x0B,
+    0x29, 0x53, 0x70, 0x45, 0x1E, 0xA7, 0x28, 0x45, 0x1A, 0x28, 0xA8, 0xD2, 0xD0, 0x44, 0x42, 0xB7,
+    0x8E, 0x90, 0x48, 0x41, 0xF3, 0x14, 0x91, 0x8A, 0x86, 0x22, 0x05, 0xA4, 0xB9, 0x36, 0xCD, 0xC5,
+    0x86, 0x2B, 0x52, 0x5C, 0x11, 0x27, 0x12, 0xA2, 0x3C, 0x23, 0x71, 0x80, 0xB8, 0x02, 0xC3, 0x39,
+    0xBA, 0x7D, 0xB9, 0xF5, 0x0E, 0xDF, 0xEC, 0xE3, 0x71, 0xA1, 0x41, 0x14, 0x58, 0xF2, 0x7A, 0x65,
+    0xCF, 0x8F, 0xEF, 0x9B, 0xF9, 0x76, 0x4C, 0x84, 0xAB, 0xE0, 0x96, 0xD8, 0x35, 0x81, 0x2A, 0x36,
+    0x3C, 0x64, 0xDC, 0x2A, 0x36, 0x8D, 0x23, 0xF6, 0x8A, 0x6B, 0x75, 0xF8, 0xED, 0xA9, 0xA3, 0x29,
+    0x5C, 0xD2, 0xB5, 0xFA, 0xFE, 0x6C, 0x1F, 0x5B, 0xED, 0xB1, 0x7D, 0xC6, 0x97, 0xB1, 0x55, 0x03,
+    0xB6, 0xDD, 0x5E, 0x86, 0x6D, 0x6A, 0x6C, 0xD7, 0x78, 0xD2, 0xFC, 0x84, 0xDB, 0x9C, 0xBD, 0x84,
+    0xD5, 0x35, 0x96, 0x7C, 0x90, 0xED, 0xA3, 0x98, 0xA6, 0x95, 0xF5, 0xA1, 0x2C, 0x89, 0x7C, 0xE1,
+    0x60, 0xB9, 0xB3, 0x7D, 0x36, 0x91, 0xEE, 0xFE, 0xC3, 0x92, 0x07, 0x78, 0x34, 0xDC, 0xD1, 0x06,
+    0x5D, 0x84, 0xFB, 0x0E, 0x21, 0x49, 0xE2, 0x0B, 0xC4, 0xCF, 0x02, 0x23, 0x55, 0xC6, 0x4E, 0x42,
+    0x5F, 0xA5, 0xF3, 0xEB, 0x7D, 0x59, 0xCA, 0x88, 0x80, 0xDB, 0x98, 0x52, 0x20, 0x69, 0x8E, 0x2F,
+    0x26, 0x81, 0x74, 0x28, 0x3E, 0xBA, 0x82, 0x49, 0xE2, 0x74, 0x47, 0xA4, 0x3A, 0x31, 0xB4, 0x29,
+    0x4C, 0x32, 0x87, 0xB4, 0xA4, 0x8E, 0x6E, 0x20, 0x4F, 0xC3, 0x3C, 0x20, 0x01, 0x73, 0x4F, 0xE5,
+    0x77, 0x33, 0x29, 0x17, 0xA5, 0x6C, 0xF2, 0x11, 0xA9, 0xC9, 0xFE, 0x48, 0x65, 0xB8, 0xC2, 0x63,
+    0xCE, 0xAC, 0xB9, 0x2B, 0xD9, 0x27, 0xB4, 0x46, 0xAA, 0xBD, 0x84, 0xDB, 0x92, 0xFA, 0x3D, 0x50,
+    0x2C, 0x47, 0x33, 0x5F, 0x42, 0xBA, 0xB0, 0x05, 0xCF, 0x89, 0x4A, 0x66, 0xD2, 0x47, 0x5C, 0xEB,
+    0xBA, 0x69, 0x2B, 0x63, 0x25, 0x67, 0x4B, 0x9B, 0x52, 0x3A, 0x6E, 0x2B, 0xDC, 0xB6, 0xB3, 0x6D,
+    0x53, 0xDB, 0x96, 0xF1, 0xBD, 0x39, 0xE6, 0x5F, 0x2C, 0xF3, 0x54, 0x86, 0x72, 0x4C, 0xB6, 0x12,
+    0x43, 0x1B, 0xF5, 0x87, 0x88, 0x64, 0x3F, 0x41, 0xD8, 0x94, 0x85, 0x5E, 0xEE, 0x74, 0x2B, 0x45,
+    0x7D, 0xED, 0x9C, 0xFA, 0x1B, 0xB2, 0xE4, 0xCB, 0x3E, 0x48, 0x01, 0x12, 0x40, 0x07, 0x9B, 0x58,
+    0x06, 0xCD, 0x06, 0x9E, 0xA7, 0x41, 0x5E, 0x1C, 0x88, 0xC9, 0x8E, 0x1A, 0xC1, 0x77, 0x14, 0xC3,
+    0xB2, 0x6D, 0x60, 0x12, 0x08, 0x26, 0xD9, 0x62, 0x1B, 0x65, 0x00, 0x1A, 0x98, 0x80, 0xBA, 0xA3,
+    0xFC, 0xF9, 0xCC, 0x0E, 0x84, 0x54, 0x4D, 0x97, 0xA0, 0x34, 0x5C, 0x97, 0x0B, 0x90, 0xBB, 0xCB,
+    0x53, 0xC2, 0x68, 0xBB, 0x14, 0x20, 0xA6, 0x2E, 0xFA, 0x47, 0x28, 0x3A, 0xC7, 0xBB, 0xA8, 0x6F,
+    0x9D, 0x63, 0xFA, 0x3F, 0xB8, 0xAF, 0x2E, 0x05, 0x44, 0x82, 0x91, 0x63, 0x53, 0x20, 0x61, 0x01,
+    0x48, 0xD9, 0xD9, 0x24, 0x5A, 0x4B, 0x3D, 0x9B, 0x12, 0xB6, 0x93, 0xEE, 0x52, 0x3C, 0x1A, 0xA1,
+    0x87, 0x2C, 0xD2, 0x4F, 0x91, 0x25, 0x3F, 0xB8, 0x2F, 0x44, 0xB5, 0xE0, 0x55, 0x3D, 0x22, 0xD5,
+    0x54, 0x2C, 0xAE, 0x87, 0xD9, 0x32, 0x9C, 0xD4, 0x06, 0x8F, 0x8E, 0x0C, 0x48, 0x96, 0x23, 0x7D,
+    0x8C, 0x66, 0x8B, 0x00, 0xC9, 0x1A, 0x54, 0xA5, 0x04, 0xBC, 0x44, 0xE4, 0xC0, 0x2C, 0x56, 0x5E,
+    0x73, 0x8B, 0x07, 0x4A, 0x79, 0xC1, 0xAC, 0xCF, 0x51, 0xAC, 0x3B, 0xDC, 0x47, 0x68, 0xFB, 0xE1,
+    0x06, 0x6F, 0x4F, 0x91, 0xE2, 0xC9, 0x58, 0xB8, 0x04, 0xA9, 0xEC, 0xBD, 0xDD, 0x21, 0xD9, 0xC5,
+    0x37, 0x10, 0xE5, 0x17, 0x77, 0xF9, 0x18, 0x80, 0xC1, 0x15, 0xC9, 0x5D, 0x26, 0x25, 0xAE, 0xF5,
+    0x48, 0xD7, 0x19, 0xB1, 0x71, 0x2E, 0xCE, 0x98, 0x9F, 0xB2, 0x53, 0x3C, 0x26, 0x57, 0x69, 0x7D,
+    0x8B, 0x68, 0x9E, 0xD6, 0xB4, 0x97, 0x3A, 0xAA, 0x6A, 0xE8, 0x29, 0x48, 0x30, 0xC1, 0xF9, 0x92,
+    0xD6, 0x25, 0x27, 0x0A, 0xC5, 0x4F, 0xE1, 0x3F, 0x02, 0xF5, 0x5E, 0x0E, 0xF0, 0x6F, 0xB3, 0xC9,
+    0x6A, 0x0B, 0x59, 0xE3, 0x05, 0xDC, 0x1E, 0x7C, 0x89, 0x46, 0x4D, 0x70, 0x45, 0x6F, 0x16, 0x33,
+    0x03, 0x0B, 0xC8, 0xC2, 0x08, 0x08, 0x12, 0x97, 0x1D, 0xBC, 0xD0, 0x9F, 0x22, 0xC6, 0x21, 0xEE,
+    0x53, 0x21, 0x27, 0x4A, 0xDE, 0x4B, 0x87, 0xA2, 0xD7, 0xC6, 0x5E, 0xC1, 0x60, 0x98, 0x68, 0x23,
+    0x2C, 0xD3, 0x7D, 0x00, 0xCF, 0x80, 0x63, 0xE1, 0xCA, 0xE7, 0xCD, 0xBE, 0xCF, 0x82, 0xAD, 0xAB,
+    0x63, 0x97, 0x06, 0x38, 0xFD, 0x06, 0xFC, 0x7C, 0x6F, 0xF6, 0x2E, 0x32, 0x42, 0x49, 0x79, 0xA0,
+    0x35, 0x2D, 0x5C, 0xD8, 0xA7, 0x52, 0xDA, 0x19, 0xD1, 0xE6, 0xD7, 0xB1, 0x5D, 0x06, 0x58, 0x30,
+    0x69, 0xC2, 0x2E, 0x1A, 0x6E, 0x70, 0x30, 0x07, 0x48, 0x49, 0xC4, 0x23, 0x3D, 0x52, 0x6E, 0x25,
+    0x5B, 0x7E, 0x2C, 0xC4, 0x2A, 0x01, 0x03, 0x62, 0x7C, 0x82, 0xF4, 0xFC, 0xC4, 0xA1, 0x1F, 0x55,
+    0x4F, 0xD5, 0x00, 0xDD, 0x70, 0x8D, 0x20, 0x3E, 0x36, 0x2C, 0x15, 0xA5, 0x26, 0xB1, 0x81, 0xAF,
+    0x8B, 0x50, 0xAE, 0x19, 0x00, 0xAC, 0x91, 0xBD, 0x58, 0x34, 0xFE, 0x23, 0x41, 0x83, 0xD3, 0x4A,
+    0xD5, 0xD1, 0x6C, 0xFB, 0x6F, 0x9C, 0xA6, 0x3A, 0x1C, 0x33, 0x0F, 0xB1, 0xDD, 0x09, 0x37, 0x87,
+    0x0A, 0xFC, 0x30, 0x04, 0x05, 0x23, 0x7D, 0xB5, 0x21, 0x6D, 0x41, 0x7C, 0xFD, 0x83, 0x14, 0x1B,
+    0xC3, 0x8E, 0x5E, 0x4D, 0xFE, 0x2A, 0x75, 0xF2, 0x60, 0x2E, 0x13, 0x61, 0x14, 0x21, 0x7B, 0xE2,
+    0x5F, 0xD9, 0x63, 0x10, 0x58, 0xA7, 0x60, 0x27, 0x90, 0x9B, 0x4E, 0x70, 0xC7, 0x81, 0x24, 0x54,
+    0xBC, 0x74, 0xE5, 0x0F, 0x61, 0x71, 0x20, 0x8B, 0xEE, 0xF1, 0x0A, 0x5F, 0xF5, 0xB3, 0x00, 0x99,
+    0xE1, 0x80, 0x2A, 0xA7, 0x10, 0x44, 0x84, 0x3F, 0xC9, 0x59, 0x6B, 0x11, 0x15, 0xA5, 0x4B, 0x96,
+    0xAD, 0x4D, 0xBC, 0x6A, 0x61, 0x29, 0x74, 0x8B, 0xFA, 0xE1, 0xAA, 0xD7, 0xEB, 0x9F, 0xA3, 0x80,
+    0x0E, 0x5A, 0x1D, 0x9A, 0x2F, 0xF8, 0xB1, 0x29, 0x20, 0x1E, 0x84, 0x4D, 0xC3, 0x6C, 0x66, 0x23,
+    0x2B, 0x90, 0x1B, 0xD3, 0x89, 0x8D, 0x3E, 0x70, 0xB9, 0xB3, 0x3F, 0x89, 0x50, 0xBB, 0x02, 0xA7,
+    0x44, 0x84, 0x44, 0xC9, 0xFD, 0x57, 0xE2, 0x29, 0xCA, 0xBC, 0xCC, 0x3B, 0x99, 0x11, 0xCB, 0x67,
+    0xE6, 0xAB, 0x38, 0x9F, 0xC9, 0xAC, 0xBF, 0x34, 0x41, 0x93, 0x38, 0xB6, 0x36, 0x4C, 0xEE, 0x51,
+    0xD8, 0x56, 0x43, 0xDB, 0x08, 0x56, 0x37, 0x03, 0xFE, 0x10, 0x37, 0x21, 0xEA, 0xA1, 0x68, 0x5A,
+    0x35, 0x64, 0xA1, 0x97, 0x73, 0x34, 0xE4, 0xA2, 0xB2, 0x41, 0x0D, 0xAA, 0x97, 0xE9, 0xA9, 0x86,
+    0x52, 0x02, 0x7A, 0xFC, 0x24, 0x24, 0x61, 0xB3, 0xFB, 0x22, 0xAC, 0x84, 0x1A, 0xE7, 0x11, 0x73,
+    0x2C, 0x52, 0x50, 0xD2, 0x46, 0x14, 0x05, 0x76, 0x32, 0x7F, 0xC4, 0xCF, 0x49, 0xF7, 0x11, 0x47,
+    0x86, 0x8C, 0xC4, 0x95, 0x69, 0x2B, 0x79, 0xB8, 0x2D, 0xD0, 0x32, 0x0C, 0xA7, 0xBE, 0x0A, 0x82,
+    0xC3, 0x3A, 0x2B, 0x65, 0xA8, 0xCB, 0xB0, 0x1E, 0x39, 0x25, 0x5B, 0x2B, 0xDC, 0x32, 0x83, 0x24,
+    0x99, 0x92, 0x8E, 0xA8, 0x21, 0x0E, 0xA6, 0x5B, 0xF9, 0x9C, 0xFE, 0x79, 0xBD, 0x15, 0x19, 0x22,
+    0x21, 0x54, 0xF4, 0x0E, 0xDF, 0xE6, 0xB1, 0x72, 0xE5, 0x94, 0xF9, 0x9C, 0x4D, 0x31, 0xE8, 0x56,
+    0xC4, 0x72, 0xD9, 0x0B, 0x09, 0xAF, 0xF7, 0x11, 0xA7, 0x38, 0x0B, 0x61, 0x49, 0x00, 0x3C, 0xF5,
+    0xCF, 0x13, 0x60, 0x17, 0xF8, 0x22, 0x92, 0x84, 0x19, 0x06, 0x23, 0x7C, 0x80, 0x50, 0x02, 0x00,
+    0xDD, 0x6D, 0x76, 0x95, 0xB3, 0x10, 0x95, 0x69, 0xBA, 0xD8, 0xCC, 0xAD, 0x74, 0xBE, 0x09, 0xE1,
+    0x96, 0x3D, 0xF1, 0x67, 0x9E, 0xAA, 0x6F, 0x26, 0x4A, 0xCC, 0xDA, 0x4A, 0x51, 0x86, 0xDE, 0x44,
+    0x59, 0xD0, 0xFF, 0x41, 0x26, 0x11, 0x7E, 0xA8, 0xDC, 0xE2, 0xFC, 0x0E, 0x15, 0xDA, 0x93, 0x98,
+    0x34, 0xA6, 0x85, 0x15, 0xA4, 0x8D, 0x5F, 0x26, 0x66, 0x1F, 0x5E, 0xBC, 0xC7, 0x72, 0xAE, 0xBD,
+    0xC8, 0x2C, 0xAF, 0x71, 0x4E, 0x90, 0xFF, 0x04, 0x11, 0xC6, 0x66, 0x61, 0xF1, 0xDF, 0x86, 0x30,
+    0x45, 0xA1, 0xC9, 0x35, 0x43, 0xFF, 0x7A, 0xFD, 0x09, 0xBD, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10,
+    0x1D, 0x7B, 0x73, 0x67, 0x09, 0x0B, 0x6D, 0x9A, 0x6B, 0x88, 0x14, 0xF7, 0x14, 0xF8, 0x17, 0xA0,
+    0xB5, 0xA0, 0xA0, 0x48, 0x41, 0x0A, 0x22, 0x44, 0x28, 0xA8, 0x41, 0x42, 0x57, 0x53, 0xD9, 0x07,
+    0x3F, 0x80, 0x93, 0x08, 0x15, 0x05, 0x14, 0x29, 0xE0, 0xAE, 0xA1, 0xA4, 0x62, 0x9D, 0x50, 0x5C,
+    0x89, 0x03, 0x74, 0x29, 0x62, 0x41, 0x52, 0xC7, 0x52, 0x2C, 0xB2, 0x77, 0xB1, 0xF7, 0xF1, 0x66,
+    0xBF, 0x03, 0x2E, 0x97, 0x34, 0x80, 0x84, 0xA5, 0xB5, 0xBF, 0x6F, 0x3C, 0x3B, 0x33, 0x6F, 0xDE,
+    0xEC, 0xB3, 0x88, 0x48, 0x6B, 0x26, 0x3B, 0xFB, 0x0E, 0x57, 0x42, 0x3E, 0xBE, 0x22, 0xA7, 0x57,
+    0xF6, 0xBE, 0xE4, 0x80, 0x00, 0x4B, 0xFD, 0x8B, 0xBF, 0x33, 0x9A, 0x55, 0xC4, 0xF5, 0x52, 0x04,
+    0x69, 0x21, 0x05, 0x82, 0xEC, 0xF8, 0x91, 0x0E, 0x97, 0xA5, 0x7A, 0x34, 0xE7, 0x70, 0x0F, 0xFC,
+    0xCF, 0xC0, 0x5C, 0xE2, 0x58, 0xB2, 0xB7, 0xD2, 0xF6, 0x8A, 0x1B, 0xB9, 0x62, 0x0D, 0xAC, 0x75,
+    0x57, 0x86, 0xBA, 0xA9, 0x46, 0x2B, 0x6D, 0x27, 0x12, 0x45, 0xCC, 0x22, 0x62, 0xF9, 0xB4, 0x18,
+    0xB9, 0x02, 0xBD, 0x19, 0xDD, 0xE8, 0x8B, 0x78, 0x81, 0xEB, 0x32, 0x97, 0xEB, 0xCA, 0xC5, 0x9D,
+    0xF8, 0xC0, 0xFD, 0x63, 0x01, 0x34, 0xB2, 0x73, 0x35, 0xC5, 0xF5, 0xC0, 0x6D, 0x00, 0x9F, 0x32,
+    0xBC, 0x63, 0x41, 0xDF, 0x31, 0x54, 0x57, 0x0F, 0x92, 0x33, 0x40, 0x35, 0x48, 0x46, 0xC7, 0x12,
+    0x13, 0xB3, 0xCF, 0xFC, 0x3D, 0xD1, 0x7D, 0x10, 0x41, 0x97, 0x62, 0xDB, 0xF9, 0x5B, 0x71, 0x47,
+    0x53, 0x8E, 0xEA, 0x78, 0x77, 0x76, 0x0C, 0x59, 0xD3, 0x61, 0xFB, 0x26, 0x63, 0x1A, 0xE2, 0xD4,
+    0x8A, 0x17, 0xED, 0x05, 0x4B, 0x7A, 0xE6, 0xB2, 0x00, 0x7D, 0x3C, 0x82, 0xC5, 0x7A, 0x29, 0x12,
+    0x7E, 0x53, 0x4D, 0x52, 0x2E, 0xD2, 0xF6, 0xE2, 0xA6, 0x0C, 0x0C, 0xD0, 0x17, 0x8B, 0x38, 0x48,
+    0x35, 0x19, 0xA8, 0xD9, 0x3D, 0xA4, 0xD9, 0x04, 0x4F, 0xB3, 0xFB, 0x98, 0xE6, 0xC7, 0x41, 0xBD,
+    0xD1, 0xD5, 0x34, 0x07, 0xA1, 0x19, 0x5D, 0x4E, 0x73, 0x38, 0x0D, 0x52, 0x4F, 0xDB, 0xD8, 0xCF,
+    0x70, 0x1F, 0x98, 0x1C, 0x9E, 0x00, 0x1D, 0x41, 0xA7, 0x4A, 0xC8, 0x40, 0x4F, 0x40, 0xF1, 0x99,
+    0x7A, 0x26, 0x0F, 0x87, 0x3D, 0xB6, 0x78, 0x16, 0x88, 0x1B, 0x98, 0x1D, 0x4D, 0x3B, 0x99, 0xB5,
+    0x40, 0x4F, 0x2A, 0x69, 0xBA, 0xFB, 0x1B, 0x4D, 0xD1, 0xB2, 0x9E, 0xD1, 0xF5, 0xEC, 0x35, 0x4D,
+    0xA3, 0x51, 0xAF, 0x6A, 0xAE, 0x75, 0x23, 0xA2, 0xF6, 0x29, 0xDF, 0x7F, 0x99, 0xE1, 0xDC, 0x4F,
+    0x9A, 0x00, 0x6F, 0x06, 0x65, 0x86, 0x5D, 0x94, 0xAC, 0xB9, 0xF0, 0x54, 0x3E, 0x87, 0xC5, 0x22,
+    0xB2, 0x28, 0x87, 0x79, 0x37, 0x28, 0x5B, 0xA9, 0x68, 0x22, 0x97, 0x84, 0xDC, 0x2A, 0x72, 0x49,
+    0xC8, 0x59, 0x1A, 0xCD, 0x50, 0xE4, 0xF6, 0x57, 0x35, 0x47, 0x85, 0x78, 0x6F, 0x54, 0xEF, 0x98,
+    0x90, 0x8F, 0x8A, 0x3C, 0x26, 0xE4, 0xE3, 0x69, 0x10, 0xDF, 0x5F, 0x8A, 0x4D, 0x81, 0xCF, 0x88,
+    0x16, 0x78, 0x88, 0xC8, 0x66, 0x77, 0x29, 0x71, 0x1E, 0xAA, 0x5E, 0xEC, 0x44, 0x56, 0xDD, 0x0F,
+    0x64, 0xE7, 0xA3, 0xED, 0xE1, 0x5C, 0x27, 0x80, 0x12, 0x8F, 0x10, 0x2A, 0xDC, 0x42, 0x43, 0xB0,
+    0x5A, 0x98, 0x9D, 0x0B, 0x6D, 0x49, 0x4B, 0xB0, 0x57, 0x40, 0xD3, 0xF7, 0xC4, 0x8F, 0x91, 0xA6,
+    0xA8, 0xF8, 0x47, 0x7A, 0x45, 0x0E, 0x8E, 0x9D, 0x33, 0xBC, 0xA6, 0x1B, 0x7F, 0xC4, 0xC8, 0x7E,
+    0xC9, 0x0B, 0xCD, 0xD7, 0x3A, 0x22, 0x9E, 0xB3, 0xB2, 0x3A, 0x8E, 0x00, 0x8A, 0x59, 0x64, 0x4B,
+    0x2E, 0xFE, 0x99, 0x68, 0xFB, 0x9B, 0x34, 0x1C, 0x21, 0x4D, 0xE0, 0x20, 0x38, 0xF1, 0x2B, 0x87,
+    0x8B, 0xC4, 0xB7, 0x83, 0xB8, 0xE0, 0x26, 0x0E, 0x85, 0xE5, 0x0E, 0x1C, 0x71, 0x10, 0xEB, 0xDF,
+    0x19, 0xB0, 0x5C, 0x7D, 0x4F, 0xFE, 0x5A, 0x0E, 0x61, 0x7B, 0x6F, 0x49, 0x46, 0xCE, 0xE6, 0x42,
+    0xCC, 0x06, 0x96, 0xFF, 0xF1, 0x3A, 0x31, 0x72, 0xBB, 0x8E, 0x43, 0x49, 0xD2, 0x87, 0x4D, 0xE0,
+    0x3C, 0x41, 0xDF, 0xDA, 0x1C, 0x22, 0x31, 0x73, 0xDD, 0x15, 0x4B, 0xDB, 0xEB, 0x3A, 0x73, 0x36,
+    0xE9, 0x70, 0x83, 0xF3, 0x8D, 0x8E, 0x27, 0x63, 0xAC, 0x8E, 0xFD, 0xEC, 0x46, 0x4B, 0x8F, 0x72,
+    0x61, 0x7F, 0x57, 0xE8, 0xEA, 0xCC, 0xE6, 0xC9, 0x9D, 0x0C, 0xBF, 0xB4, 0x3C, 0xE0, 0x2E, 0xFA,
+    0x89, 0x83, 0xDC, 0xE7, 0x60, 0x89, 0x3B, 0x0D, 0x83, 0x7C, 0xB0, 0x2F, 0x2C, 0x9B, 0xF9, 0x4A,
+    0x1E, 0x52, 0x92, 0x78, 0x88, 0xA1, 0x5C, 0xC5, 0x2D, 0xC5, 0xCA, 0x1A, 0x3F, 0xE1, 0x4C, 0xB4,
+    0xDA, 0x79, 0x8D, 0xCC, 0xB2, 0x76, 0x4F, 0x0E, 0x0E, 0xFC, 0x5D, 0x1E, 0x3D, 0x3C, 0xD6, 0x1B,
+    0x43, 0xB3, 0x82, 0x5D, 0x42, 0xF6, 0x47, 0xF4, 0x74, 0x13, 0xFF, 0x33, 0x87, 0x4E, 0x34, 0x87,
+    0x9B, 0x61, 0x3C, 0xD8, 0xA1, 0x14, 0x78, 0xD3, 0x36, 0x79, 0xA7, 0x39, 0x57, 0xF7, 0x5C, 0xCF,
+    0x4E, 0x6B, 0xEB, 0xCC, 0xE2, 0x1B, 0xD6, 0x7B, 0x70, 0xB8, 0xA6, 0xC0, 0x9F, 0xBF, 0xBD, 0xA2,
+    0xA1, 0x8D, 0xF6, 0x76, 0x28, 0x19, 0xB3, 0x7E, 0xBA, 0xEE, 0xFF, 0x48, 0xD5, 0xF8, 0x17, 0x55,
+    0x1B, 0x56, 0x0E, 0x98, 0xD7, 0x2B, 0xA4, 0x56, 0x6F, 0x4A, 0x55, 0xF5, 0x3C, 0xAA, 0x7C, 0xA2,
+    0x6A, 0x38, 0x43, 0x55, 0xB1, 0xA1, 0xEA, 0xC6, 0x3F, 0xA0, 0xEA, 0x5F, 0x42, 0xCE, 0xF7, 0x5F,
+    0x62, 0x15, 0x6F, 0x04, 0xB1, 0x94, 0x14, 0xF1, 0xC4, 0xFB, 0xF7, 0x09, 0xBD, 0x7E, 0x53, 0x71,
+    0x92, 0x36, 0x20, 0x18, 0x7C, 0xC1, 0x33, 0xCA, 0x54, 0x86, 0x12, 0x18, 0x1C, 0xF7, 0xDC, 0xFA,
+    0x4A, 0xC8, 0x26, 0xF9, 0x19, 0xB3, 0x83, 0xC3, 0xA8, 0xAA, 0x3C, 0xF2, 0xCC, 0x44, 0xC9, 0xAE,
+    0x11, 0xDD, 0xE6, 0x95, 0xBF, 0x3D, 0x28, 0xC7, 0xA4, 0x98, 0x02, 0xE0, 0x47, 0x7F, 0xE2, 0x17,
+    0xA3, 0x2E, 0xA5, 0xAA, 0xEE, 0xD6, 0xB5, 0x4D, 0x96, 0x6A, 0x8F, 0x67, 0xC7, 0xCE, 0x66, 0xA1,
+    0xD6, 0xEC, 0x7F, 0x78, 0x16, 0x5B, 0x4E, 0x57, 0xE6, 0xCE, 0xE3, 0xBB, 0x28, 0xD8, 0x00, 0x32,
+    0x13, 0x34, 0x9D, 0x36, 0xA7, 0xE2, 0xAB, 0x9D, 0xF7, 0xF4, 0xEF, 0xC0, 0xAC, 0x76, 0xA0, 0xA2,
+    0x3F, 0xF0, 0xBD, 0x8E, 0x84, 0x67, 0xE7, 0xB6, 0xAE, 0xAA, 0x90, 0xAD, 0x49, 0x7E, 0x1B, 0x3D,
+    0xC9, 0xFD, 0x79, 0xD9, 0x65, 0x05, 0x85, 0xCA, 0xCE, 0x1E, 0x62, 0x12, 0x8C, 0x8C, 0xAA, 0x49,
+    0x99, 0x9D, 0xF8, 0x09, 0xE1, 0x19, 0xF6, 0xAA, 0x1B, 0x8E, 0xF3, 0x39, 0x53, 0x23, 0xF2, 0x68,
+    0x29, 0x0D, 0x94, 0x77, 0xEE, 0x7A, 0x32, 0xAB, 0x30, 0xA8, 0x98, 0xD7, 0x7A, 0x33, 0x49, 0x3D,
+    0xE9, 0x2D, 0x17, 0x1D, 0xF9, 0x7A, 0xB5, 0xEE, 0x55, 0xEB, 0x07, 0x1D, 0x7D, 0x55, 0x93, 0x74,
+    0xDB, 0xD2, 0xD9, 0x4C, 0x8A, 0x6B, 0x9E, 0xAF, 0xB8, 0x05, 0xD6, 0x0A, 0x5F, 0x52, 0x9E, 0x57,
+    0xAB, 0xEA, 0x41, 0xE5, 0xE6, 0x63, 0x2A, 0x26, 0x69, 0x07, 0x7E, 0x15, 0xD1, 0xAD, 0xE4, 0xB8,
+    0x9C, 0x28, 0x9F, 0x2C, 0xA8, 0x3C, 0x5E, 0x36, 0x9F, 0x36, 0xA9, 0xF5, 0xBB, 0xD2, 0xEA, 0xF0,
+    0x2B, 0xB8, 0x4C, 0x83, 0x72, 0x0B, 0xEB, 0xEC, 0xE4, 0x45, 0xFD, 0x06, 0x7A, 0x9A, 0x8D, 0xB6,
+    0xA0, 0xD4, 0xF7, 0xE5, 0x7D, 0xF9, 0xFF, 0xAF, 0x3F, 0x00, 0x7D, 0x55, 0x31, 0x8F, 0xDE, 0x44,
+    0x10, 0x1D, 0x7B, 0xC3, 0x19, 0xC5, 0x42, 0x9B, 0x22, 0x69, 0x88, 0x84, 0x6B, 0x52, 0xE0, 0x5F,
+    0x80, 0xD6, 0x70, 0x25, 0x4D, 0x6A, 0x1A, 0x28, 0xE9, 0x52, 0x23, 0x21, 0xD6, 0xE8, 0x0A, 0xDA,
+    0x34, 0xD4, 0xA1, 0xB8, 0x2A, 0xCD, 0xB5, 0x29, 0xD0, 0xD9, 0xE8, 0x0A, 0x4A, 0x1C, 0x29, 0x3D,
+    0x8E, 0xB8, 0xEA, 0x52, 0xB0, 0x27, 0x19, 0x69, 0xBF, 0x60, 0x7B, 0x78, 0x6F, 0xEF, 0xBB, 0xBB,
+    0x2F, 0x07, 0x89, 0xA5, 0x6F, 0x76, 0x3F, 0x7B, 0x76, 0xE7, 0xBD, 0x79, 0xB3, 0xB3, 0x72, 0xBB,
+    0xFD, 0x46, 0xA4, 0x8C, 0xBE, 0x17, 0xB3, 0xD6, 0x41, 0xA4, 0xDB, 0x8F, 0x22, 0x99, 0xDC, 0x91,
+    0xEB, 0x27, 0x57, 0xFD, 0x55, 0xB5, 0xD3, 0xD1, 0xEB, 0x8F, 0xDA, 0xE6, 0x2A, 0x7E, 0x94, 0x4E,
+    0xEC, 0x2C, 0xAE, 0x15, 0x6D, 0xEB, 0x5E, 0xEA, 0x60, 0x07, 0x31, 0x4B, 0xC1, 0xE5, 0x07, 0x93,
+    0x88, 0x3D, 0x9F, 0xB1, 0x6A, 0x5D, 0xB0, 0xD6, 0x29, 0x4C, 0x49, 0x03, 0x57, 0x18, 0x78, 0xCB,
+    0x2D, 0x3B, 0xC2, 0xE7, 0x0B, 0x78, 0x17, 0x0A, 0xEF, 0x8C, 0x46, 0x1C, 0x4D, 0xF6, 0xF0, 0x2A,
+    0x66, 0xAC, 0x5B, 0xB1, 0x01, 0x0B, 0xDD, 0x09, 0x36, 0xFB, 0xB6, 0x78, 0x2C, 0x6F, 0x3E, 0x5E,
+    0x9F, 0xEB, 0x46, 0xD5, 0xE8, 0xA0, 0xA3, 0x99, 0x33, 0x6D, 0xED, 0x68, 0x80, 0x4C, 0x8A, 0xC5,
+    0xCC, 0x62, 0x23, 0x00, 0x55, 0xA1, 0xE3, 0x6A, 0xEC, 0xDB, 0x3D, 0x41, 0x54, 0x5D, 0xC9, 0x24,
+    0x05, 0x05, 0x10, 0xA0, 0x17, 0xA9, 0x46, 0x6E, 0x84, 0x9F, 0x01, 0xE7, 0xC1, 0xF5, 0x00, 0x3A,
+    0x13, 0xF2, 0x80, 0x25, 0xFC, 0x7E, 0xDC, 0xA4, 0x50, 0xEF, 0x33, 0x1B, 0x45, 0xFF, 0x29, 0xCC,
+    0x04, 0xA7, 0x62, 0x76, 0x60, 0x1B, 0xEB, 0x41, 0xF2, 0xA9, 0xC2, 0x56, 0x5F, 0x9B, 0x66, 0x07,
+    0x57, 0xAD, 0x73, 0xA5, 0xFF, 0xE8, 0x5A, 0x68, 0xF4, 0x11, 0x99, 0x29, 0x56, 0x29, 0x83, 0x68,
+    0x8F, 0x10, 0x36, 0xE6, 0x33, 0x20, 0x08, 0xF2, 0xE2, 0x06, 0xCF, 0xAC, 0x3B, 0xAC, 0xD4, 0x0A,
+    0xE0, 0xEA, 0xBF, 0x10, 0xD3, 0x10, 0x9D, 0x74, 0x34, 0x36, 0x32, 0x07, 0xC4, 0xD0, 0x00, 0xB6,
+    0x4C, 0x5D, 0x62, 0x0C, 0xEF, 0x8A, 0xC6, 0xD0, 0xC8, 0xBD, 0xEB, 0xA0, 0xE5, 0x3E, 0x96, 0x3B,
+    0xDB, 0x63, 0xC9, 0x31, 0x16, 0x9F, 0x60, 0x8B, 0xEF, 0xAB, 0x46, 0xB2, 0xF0, 0x8C, 0x5A, 0xEE,
+    0xC0, 0x2B, 0x74, 0xA9, 0xF4, 0x89, 0x06, 0xB7, 0xD8, 0x55, 0x5C, 0x5F, 0x45, 0xC1, 0x10, 0x20,
+    0x9C, 0x27, 0x7D, 0x6D, 0x17, 0xA8, 0x01, 0xB8, 0x66, 0x06, 0xB2, 0x72, 0x83, 0xF8, 0x56, 0x47,
+    0x72, 0x62, 0x78, 0x42, 0x52, 0x60, 0xCD, 0x88, 0x88, 0x5A, 0x53, 0xFF, 0x0F, 0x90, 0x6D, 0xE9,
+    0xF0, 0xDA, 0xE8, 0x42, 0xA1, 0xF1, 0xBD, 0x3C, 0x65, 0xA4, 0xBD, 0xF6, 0x63, 0x4A, 0x6B, 0x91,
+    0xFE, 0x2A, 0x10, 0xEF, 0x6A, 0x03, 0xC1, 0xDC, 0xDD, 0x15, 0xB1, 0x50, 0xB5, 0xBA, 0x78, 0x0D,
+    0xA8, 0xB0, 0x6E, 0xCA, 0x75, 0x80, 0x84, 0xAC, 0xAB, 0x94, 0xB0, 0x9B, 0xD3, 0x3A, 0x62, 0x9A,
+    0xE9, 0xE6, 0x08, 0xFA, 0xAA, 0x22, 0x52, 0xAD, 0x94, 0xEB, 0xC1, 0x21, 0x83, 0x5E, 0x08, 0x2A,
+    0x37, 0xA7, 0xF5, 0x9A, 0x72, 0xB6, 0x10, 0x0A, 0x65, 0x65, 0xAE, 0xC6, 0x63, 0xE2, 0x0A, 0x84,
+    0x25, 0xF2, 0xEC, 0x66, 0x61, 0x75, 0x5A, 0xE9, 0x2B, 0x3D, 0xD7, 0xC5, 0x46, 0xB3, 0x4A, 0xD7,
+    0xBA, 0xA1, 0x8C, 0x66, 0x91, 0xAE, 0x77, 0x03, 0x4A, 0x6B, 0x41, 0x75, 0xE8, 0x80, 0xBD, 0x90,
+    0xA8, 0xA7, 0x9E, 0x9A, 0xA5, 0x22, 0xE7, 0x64, 0x25, 0x7D, 0xFC, 0xDB, 0xC6, 0x81, 0x9F, 0xFE,
+    0x8E, 0x5F, 0x78, 0x04, 0x94, 0x05, 0x36, 0xC8, 0xB4, 0xA9, 0x5B, 0x3F, 0x14, 0x63, 0x35, 0x65,
+    0xA1, 0x48, 0x88, 0x80, 0x8D, 0x7B, 0x54, 0xC8, 0xD1, 0x5B, 0x5F, 0x64, 0xDD, 0x06, 0xB9, 0x85,
+    0x0A, 0xAA, 0x91, 0x87, 0x8A, 0x4A, 0x90, 0x13, 0xD8, 0x19, 0x6A, 0x40, 0xAE, 0x1F, 0x25, 0xE4,
+    0x48, 0xCA, 0x8A, 0x80, 0xCF, 0xF5, 0x6C, 0x61, 0xFD, 0x6B, 0xFB, 0x8B, 0x8D, 0x65, 0xAF, 0xED,
+    0x1D, 0x16, 0x13, 0x6A, 0x7E, 0x77, 0x78, 0x01, 0x9E, 0x83, 0x25, 0x5C, 0x94, 0x71, 0x46, 0x9D,
+    0xFB, 0xB4, 0x55, 0x89, 0x7A, 0xE6, 0xD1, 0xFF, 0x30, 0x3B, 0x4C, 0x87, 0xEC, 0x20, 0xA5, 0xB2,
+    0xFB, 0x2D, 0x0D, 0x7E, 0x3F, 0x0D, 0xB7, 0xE4, 0xE1, 0x8D, 0xB3, 0x08, 0x6C, 0x81, 0x59, 0x26,
+    0x4C, 0x0C, 0xF7, 0x01, 0x72, 0x4F, 0x07, 0x32, 0x80, 0x0A, 0xEF, 0x1C, 0x14, 0xFA, 0x70, 0x40,
+    0x0B, 0x48, 0xC3, 0x9A, 0xBE, 0x41, 0xEF, 0xE4, 0xA2, 0xCD, 0xC5, 0xD0, 0xBE, 0x31, 0xA4, 0x97,
+    0x05, 0x5D, 0xEE, 0x43, 0x87, 0x4C, 0x4F, 0x41, 0x7A, 0xAA, 0xC8, 0x7D, 0x6D, 0x92, 0xD4, 0xBB,
+    0x8F, 0x99, 0x6A, 0x64, 0xAB, 0x98, 0xD1, 0xDF, 0xA4, 0x60, 0x97, 0x93, 0x7C, 0xFC, 0x44, 0xFE,
+    0xE7, 0x51, 0x6D, 0x0D, 0x19, 0x34, 0x06, 0x07, 0x38, 0x52, 0x07, 0x96, 0xAE, 0xBB, 0xB4, 0xAF,
+    0x0F, 0x69, 0xE1, 0x94, 0xEC, 0xC0, 0xF7, 0x75, 0xA0, 0xB5, 0x3B, 0xB6, 0xA2, 0xDD, 0x74, 0x83,
+    0x1F, 0x3B, 0xD5, 0x03, 0xEE, 0xB6, 0x31, 0xBB, 0x80, 0xA0, 0xA3, 0xCE, 0x2C, 0x8C, 0x9E, 0x45,
+    0xC1, 0x82, 0xE8, 0xAB, 0x29, 0x8F, 0x98, 0x54, 0x2D, 0xAB, 0x22, 0x15, 0x00, 0xC5, 0x87, 0x0F,
+    0x9D, 0x83, 0x5C, 0xBD, 0xF9, 0xEF, 0x64, 0x4F, 0x4F, 0x2F, 0x7C, 0xE0, 0xCC, 0x13, 0xCE, 0xE3,
+    0x69, 0x21, 0xDF, 0x67, 0x91, 0xA5, 0x40, 0x46, 0x38, 0xB9, 0xC5, 0xE9, 0x25, 0x3B, 0xFD, 0x13,
+    0xBF, 0x1F, 0xF4, 0x6C, 0x35, 0x6B, 0x3E, 0xD9, 0x58, 0x0C, 0x6E, 0xAC, 0x58, 0x0E, 0x1E, 0xA9,
+    0x3F, 0x5A, 0x1F, 0x8B, 0x1B, 0x53, 0x75, 0xB0, 0x8C, 0xED, 0xC2, 0x96, 0xDF, 0x83, 0x27, 0x56,
+    0x7E, 0x87, 0x90, 0x93, 0xE4, 0x5F, 0xF5, 0x82, 0x8E, 0x91, 0xBC, 0xEE, 0x5E, 0x5F, 0x0B, 0x27,
+    0xBA, 0x38, 0x8D, 0x4E, 0x7B, 0x3F, 0xB3, 0x70, 0x95, 0xD9, 0x2A, 0x34, 0x67, 0x59, 0x45, 0x0F,
+    0x2C, 0xDD, 0x1F, 0x81, 0xAC, 0x67, 0xD9, 0x42, 0xDA, 0x36, 0x37, 0xE2, 0xCD, 0x53, 0x62, 0x3C,
+    0x5F, 0xD8, 0x97, 0x0C, 0x3C, 0x97, 0xD8, 0x5F, 0x1B, 0xDC, 0x03, 0xF5, 0x98, 0x69, 0x5F, 0xAE,
+    0x4D, 0x89, 0x26, 0xCA, 0xF6, 0xD4, 0xF1, 0xC4, 0x91, 0x22, 0xB5, 0xA0, 0x0F, 0x0F, 0x36, 0x9B,
+    0xC9, 0xD1, 0x92, 0x1A, 0x2E, 0xFF, 0x77, 0xED, 0x36, 0xC3, 0xD1, 0x03, 0xD2, 0xE7, 0xDA, 0xFA,
+    0xB1, 0xC6, 0xAA, 0x7D, 0xE0, 0x99, 0x09, 0x87, 0x3D, 0x9F, 0xB1, 0xD2, 0x79, 0x65, 0x9F, 0x05,
+    0x68, 0x29, 0xCF, 0x55, 0xF2, 0xA5, 0x8C, 0xE9, 0x98, 0xBB, 0x15, 0xAD, 0x4F, 0xC7, 0x92, 0x79,
+    0x74, 0x3C, 0x5D, 0xF3, 0xF6, 0xBA, 0xE2, 0x64, 0x0F, 0x41, 0x0C, 0x13, 0x5A, 0xFE, 0xFC, 0x4E,
+    0xF2, 0x26, 0x91, 0xAF, 0x6E, 0x90, 0x7F, 0xEF, 0x91, 0xFE, 0x94, 0x34, 0x08, 0x72, 0xFB, 0x48,
+    0xCF, 0xB8, 0x9A, 0x9B, 0x7B, 0xBF, 0x43, 0x7E, 0x49, 0xE4, 0xC3, 0x15, 0xF9, 0x0A, 0x77, 0xED,
+    0x6A, 0x79, 0xED, 0x0E, 0x9A, 0xEE, 0x85, 0xB7, 0x72, 0xE3, 0x95, 0xF0, 0x40, 0x5F, 0xA3, 0x7C,
+    0x91, 0xD2, 0x7B, 0xFA, 0x77, 0x03, 0xB6, 0x97, 0xDC, 0xD0, 0x0A, 0xC1, 0x2D, 0x38, 0xEC, 0xF4,
+    0x4A, 0x5F, 0xEA, 0xFA, 0xE5, 0xD3, 0xAB, 0xE7, 0x82, 0xC8, 0xBF, 0xAD, 0x55, 0x3F, 0x68, 0x1E,
+    0x37, 0x14, 0x7F, 0x3A, 0xC5, 0x3E, 0xF0, 0x51, 0xCB, 0x43, 0x0C, 0x25, 0xF4, 0xAB, 0xBA, 0xB7,
+    0x41, 0x1D, 0x3C, 0x78, 0x28, 0x9F, 0x94, 0x9A, 0x12, 0x68, 0x68, 0x6D, 0xDA, 0x98, 0x4E, 0xA5,
+    0x9E, 0x43, 0xC1, 0x19, 0x3C, 0x78, 0x08, 0xBE, 0x4B, 0x3C, 0x64, 0xF0, 0x10, 0x77, 0x0A, 0xB4,
+    0x43, 0xBD, 0x94, 0x36, 0x5F, 0x68, 0x43, 0x21, 0xAB, 0x73, 0xF7, 0xD9, 0x94, 0x42, 0x3D, 0x44,
+    0x49, 0xC6, 0x2C, 0x07, 0x85, 0xA6, 0x64, 0x89, 0x1C, 0x54, 0x7C, 0x18, 0xDD, 0xA9, 0x4F, 0xF7,
+    0x7D, 0x9F, 0x71, 0x21, 0x81, 0xD4, 0xED, 0x43, 0x3A, 0x49, 0xEF, 0xCF, 0x4F, 0x4F, 0x4F, 0x4F,
+    0xEF, 0x16, 0x3E, 0xFB, 0x9C, 0x2B, 0x23, 0x7F, 0xF9, 0x6E, 0x02, 0xB6, 0x5E, 0xDE, 0x02, 0xC5,
+    0x0A, 0x3A, 0x00, 0x33, 0x97, 0x6E, 0x3F, 0xEE, 0x6D, 0x6F, 0xC5, 0x1F, 0x12, 0xBD, 0xB5, 0x82,
+    0x82, 0x2D, 0x78, 0xD5, 0xCF, 0x80, 0x3A, 0x88, 0x43, 0x0A, 0x58, 0xEB, 0xDD, 0x7C, 0xFA, 0x53,
+    0x07, 0x96, 0x56, 0xC6, 0x41, 0x2F, 0xC1, 0x38, 0xC0, 0xAB, 0x7F, 0x90, 0x84, 0x0F, 0xD4, 0xC0,
+    0x3F, 0xE7, 0xFE, 0x88, 0x0C, 0xF6, 0x03, 0xEC, 0xCF, 0xB0, 0x2B, 0xFF, 0x22, 0x72, 0x2F, 0xE6,
+    0x4E, 0x93, 0x4F, 0x1C, 0xDF, 0x33, 0xA9, 0xE8, 0xBB, 0x3C, 0x7E, 0xFE, 0x9F, 0xA7, 0xFB, 0x3F,
+    0x4C, 0x64, 0xBD, 0x5E, 0xEF, 0xFB, 0xA1, 0x2B, 0xD9, 0x20, 0x04, 0x74, 0xB8, 0xCC, 0xBD, 0xAF,
+    0x09, 0x38, 0xB1, 0x6E, 0x52, 0x56, 0x7A, 0x66, 0xD3, 0xAB, 0x8A, 0xA8, 0xF4, 0x9C, 0xA7, 0x2E,
+    0x31, 0x22, 0x73, 0x71, 0x29, 0x61, 0x0A, 0xC6, 0xB3, 0x3C, 0xF3, 0x51, 0xE0, 0x28, 0x97, 0xE8,
+    0x2E, 0x9A, 0x9F, 0x8A, 0xAD, 0xBF, 0x61, 0x7C, 0x6C, 0x64, 0x54, 0xB1, 0xE2, 0x34, 0x81, 0x29,
+    0x56, 0x38, 0x71, 0xCD, 0x4A, 0x6A, 0xD2, 0xA4, 0x6C, 0x02, 0x94, 0xF1, 0xF3, 0x36, 0xDD, 0xB0,
+    0xA7, 0x09, 0x02, 0x4E, 0xF1, 0x87, 0x35, 0x7F, 0xDE, 0x20, 0x2F, 0x31, 0x4D, 0x52, 0xD6, 0xA8,
+    0xCC, 0x83, 0x72, 0x79, 0x8A, 0xA8, 0xF1, 0x6C, 0x55, 0xFC, 0x5E, 0xB3, 0x7D, 0x14, 0xB5, 0x52,
+    0x5D, 0xB3, 0xBE, 0x13, 0xEF, 0xDB, 0x2E, 0xD5, 0x61, 0x23, 0xF4, 0xE6, 0x02, 0xEE, 0x65, 0x03,
+    0x20, 0x2B, 0x11, 0x5C, 0xC6, 0x46, 0xAC, 0x5B, 0x44, 0x40, 0x58, 0x18, 0x53, 0x40, 0x6B, 0x00,
+    0x59, 0x40, 0xE4, 0x00, 0x78, 0x11, 0x7D, 0x55, 0x7D, 0x29, 0xBD, 0x7F, 0x84, 0xA7, 0x92, 0xDF,
+    0x7E, 0xA3, 0xA1, 0x02, 0x60, 0x19, 0x10, 0x1C, 0xF8, 0x70, 0x18, 0x68, 0x8A, 0xA3, 0x61, 0x04,
+    0x21, 0x8E, 0x20, 0x36, 0x47, 0x10, 0x4D, 0xF7, 0x8B, 0x01, 0x04, 0x1F, 0xC9, 0x00, 0x57, 0xDD,
+    0xF9, 0xAF, 0x83, 0x0C, 0x55, 0x1E, 0xA2, 0x66, 0x60, 0x92, 0x01, 0x52, 0x40, 0x41, 0xB0, 0x89,
+    0xCC, 0xEF, 0xF9, 0xB4, 0xC9, 0xAD, 0xCF, 0x2E, 0xC2, 0x0A, 0x30, 0x0B, 0xDE, 0x32, 0x6F, 0x43,
+    0xB8, 0x1B, 0xDF, 0xB0, 0x06, 0x9A, 0x90, 0x42, 0x10, 0xD5, 0xE9, 0x13, 0x2F, 0xF5, 0x02, 0x4E,
+    0x59, 0x29, 0xEF, 0x3B, 0x71, 0xE0, 0x93, 0x3A, 0xEF, 0xFB, 0x31, 0x35, 0x3D, 0xCC, 0x52, 0x56,
+    0x92, 0x1A, 0xC4, 0x5E, 0x0D, 0xBE, 0xE0, 0x87, 0x5E, 0x49, 0x13, 0x37, 0x69, 0xC1, 0x2A, 0xF0,
+    0x1F, 0x28, 0xB8, 0x08, 0x63, 0x40, 0x68, 0x9D, 0x1E, 0x20, 0xC4, 0xB1, 0x77, 0xB1, 0xF4, 0xF6,
+    0xE3, 0xE8, 0x7F, 0x78, 0x17, 0xD9, 0xCD, 0x3F, 0x27, 0x4F, 0xFA, 0x2E, 0x36, 0x41, 0xA8, 0xF8,
+    0x47, 0xF2, 0xDB, 0xCC, 0xBB, 0x5B, 0xC5, 0xBF, 0x72, 0x61, 0xF4, 0x69, 0x89, 0x3C, 0x52, 0xB0,
+    0x52, 0x42, 0x67, 0xF6, 0xD2, 0x9D, 0x8F, 0x9F, 0xDE, 0xF9, 0x48, 0x77, 0x66, 0xF4, 0x65, 0xFD,
+    0x60, 0x57, 0xE1, 0x61, 0x4F, 0xD0, 0x86, 0x98, 0xBF, 0xAA, 0xA4, 0x03, 0xEF, 0xAC, 0xC0, 0xCF,
+    0x87, 0xB7, 0x2E, 0x1F, 0xDE, 0x7E, 0x63, 0x26, 0x8E, 0x5F, 0x8B, 0xC9, 0xEE, 0x79, 0x8C, 0xDE,
+    0x89, 0xDA, 0x31, 0x22, 0x78, 0x8D, 0x77, 0xDB, 0x59, 0x5A, 0x41, 0x6C, 0xDA, 0x1B, 0xF1, 0x15,
+    0x48, 0x15, 0x66, 0xF2, 0xBC, 0x0D, 0x19, 0x82, 0x5A, 0x8E, 0x95, 0xAC, 0x75, 0x27, 0x29, 0x45,
+    0xB6, 0x36, 0xA8, 0x1C, 0x59, 0x4E, 0x5B, 0x7D, 0x68, 0xA2, 0x4A, 0xB4, 0x8F, 0x33, 0xAA, 0x92,
+    0xD2, 0x0D, 0xAA, 0x9D, 0x91, 0x89, 0x4E, 0x37, 0x61, 0x79, 0x93, 0xFD, 0xE1, 0x24, 0xF3, 0x3A,
+    0xF1, 0x25, 0xF7, 0x3B, 0x26, 0x5F, 0x2E, 0xD2, 0x65, 0x9D, 0x58, 0xBE, 0x6E, 0xE4, 0xBA, 0x09,
+    0x56, 0x8E, 0x17, 0xF7, 0x78, 0x91, 0xA2, 0x49, 0x79, 0x8F, 0xB8, 0x34, 0xEC, 0x87, 0x2F, 0x33,
+    0xDE, 0x77, 0xE8, 0x4C, 0xC0, 0x13, 0xD7, 0x0D, 0x26, 0x2A, 0x2B, 0x44, 0xB1, 0x8D, 0x9A, 0x00,
+    0x35, 0xC8, 0x39, 0x23, 0xE7, 0x6C, 0x70, 0x36, 0xF7, 0x2A, 0xC7, 0xB2, 0x80, 0xCE, 0xE6, 0x16,
+    0x72, 0x4C, 0xF7, 0x2B, 0x00, 0xD3, 0x6D, 0x3B, 0x4E, 0x65, 0xE4, 0xA8, 0x8B, 0x2B, 0x66, 0x78,
+    0x29, 0x0B, 0x09, 0x67, 0x87, 0xEC, 0x49, 0xB0, 0x91, 0x63, 0x5A, 0xEE, 0xD4, 0x71, 0x25, 0x0B,
+    0x9F, 0x54, 0xBC, 0xC4, 0xDA, 0xC1, 0x0B, 0x19, 0xD9, 0x48, 0xBF, 0x79, 0xDC, 0x9E, 0xA9, 0xD5,
+    0xA0, 0xD9, 0x50, 0x27, 0x1E, 0x34, 0xA8, 0xBC, 0x5B, 0x33, 0x93, 0x5F, 0x77, 0xA8, 0x9F, 0x18,
+    0xD9, 0xC7, 0xD0, 0xA0, 0x09, 0x2F, 0xCE, 0x92, 0x92, 0x8D, 0x4C, 0x12, 0xF4, 0x09, 0xF7, 0xD2,
+    0xDC, 0x24, 0x96, 0x56, 0xE0, 0xF0, 0x35, 0xB5, 0x6C, 0xB5, 0x8A, 0x96, 0x08, 0x53, 0xE6, 0xEB,
+    0x0E, 0x67, 0xE7, 0xB0, 0xAE, 0x88, 0x7E, 0x4D, 0xAD, 0xC8, 0x66, 0x69, 0x31, 0x32, 0xBE, 0x1B,
+    0x67, 0x57, 0x82, 0x9A, 0x95, 0x3B, 0x28, 0x47, 0x4D, 0xA9, 0x7D, 0x62, 0xD3, 0x7E, 0x58, 0x44,
+    0x8E, 0xA3, 0x1F, 0x56, 0x5C, 0x75, 0x34, 0x7B, 0x8F, 0x0C, 0x13, 0xE4, 0xF5, 0xB6, 0x46, 0xF0,
+    0x0A, 0xF8, 0xB3, 0x8C, 0xEF, 0x60, 0x55, 0xC3, 0xB8, 0x4E, 0xE2, 0xF3, 0x16, 0x5A, 0x68, 0x59,
+    0x32, 0x43, 0x1B, 0x90, 0x1A, 0xDF, 0xB8, 0x28, 0x08, 0x5E, 0xD8, 0x2C, 0xE4, 0x4A, 0x68, 0x56,
+    0xD1, 0x86, 0x78, 0xDA, 0x24, 0x95, 0xD0, 0xA9, 0xC2, 0xB8, 0xC1, 0x5B, 0xD8, 0x37, 0x30, 0xF1,
+    0xBB, 0x6D, 0x61, 0xAC, 0xC4, 0x35, 0x43, 0x4B, 0xB3, 0x8D, 0xC8, 0x42, 0xC1, 0x5A, 0xAC, 0x81,
+    0xFC, 0x65, 0x81, 0x27, 0x0D, 0x9B, 0x43, 0x91, 0x13, 0x73, 0x18, 0xA9, 0x85, 0x43, 0xB3, 0x00,
+    0x92, 0x85, 0xDB, 0x91, 0x40, 0xCD, 0x82, 0x6B, 0xAB, 0xB1, 0xC0, 0x58, 0x6D, 0x68, 0xAE, 0xBA,
+    0x33, 0x98, 0x37, 0xED, 0xA1, 0xCE, 0xA8, 0x33, 0x1B, 0x15, 0x75, 0x3E, 0x4B, 0xEF, 0xDB, 0xC4,
+    0xE1, 0x9D, 0xDD, 0x30, 0x49, 0xE5, 0x21, 0x0C, 0xD6, 0x43, 0x3A, 0x6F, 0x62, 0x9B, 0x43, 0x7A,
+    0xC1, 0x50, 0x9B, 0x62, 0xCA, 0xE1, 0x20, 0xC3, 0x1D, 0x47, 0x76, 0x6A, 0x70, 0x3C, 0xA1, 0xF8,
+    0x86, 0xA3, 0x4D, 0x5E, 0xA4, 0x4F, 0x1C, 0xAD, 0xA7, 0xB1, 0x7E, 0x2C, 0x2E, 0x2E, 0x7E, 0x3A,
+    0xFC, 0x0B, 0xE0, 0xFF, 0xE1, 0x16, 0x44, 0x38, 0xCD, 0xEB, 0x51, 0xFC, 0x68, 0x16, 0x92, 0x13,
+    0x33, 0x2B, 0x64, 0x2B, 0x66, 0x13, 0xE6, 0xA5, 0xC5, 0x9A, 0x84, 0xAE, 0x6C, 0xA3, 0x10, 0x23,
+    0x20, 0xA0, 0x2D, 0xA8, 0x81, 0xB3, 0x36, 0xE4, 0xA8, 0x81, 0x3A, 0x06, 0x14, 0x33, 0x91, 0xDA,
+    0x41, 0xC5, 0xAC, 0x43, 0x52, 0xE2, 0x12, 0x5E, 0x4E, 0x7F, 0x03, 0x7D, 0x55, 0xBF, 0x8F, 0x17,
+    0x45, 0x14, 0x7F, 0xBB, 0x9B, 0xBB, 0x4D, 0xD8, 0x84, 0xA1, 0x80, 0x98, 0x60, 0x31, 0x96, 0x8A,
+    0xC4, 0xF1, 0x0F, 0x38, 0x99, 0x25, 0x16, 0x96, 0x5C, 0x01, 0xA1, 0xBC, 0x86, 0x46, 0x2C, 0xEE,
+    0x1F, 0x10, 0x67, 0x85, 0x82, 0x82, 0x82, 0x2B, 0xEC, 0x2C, 0x24, 0x11, 0x13, 0xFD, 0x5A, 0x40,
+    0x61, 0x29, 0xEC, 0xE2, 0xC5, 0x58, 0x58, 0xB0, 0x12, 0xD1, 0x82, 0x82, 0x49, 0x8E, 0x60, 0xE2,
+    0x15, 0x8C, 0xB2, 0x87, 0x7B, 0x77, 0xB3, 0xFB, 0xFC, 0xBC, 0xBD, 0x1F, 0x1C, 0x85, 0x6E, 0xBE,
+    0x73, 0xB7, 0x3F, 0xDE, 0xBC, 0xF7, 0x79, 0x9F, 0xCF, 0x7B, 0x6F, 0x88, 0xE4, 0xCA, 0xB9, 0x4C,
+    0xB8, 0xCD, 0x38, 0x12, 0x33, 0x7E, 0x8D, 0xE5, 0x60, 0x9E, 0xF5, 0x6A, 0x7B, 0x4C, 0xC8, 0x11,
+    0x99, 0x86, 0x0A, 0x4F, 0x69, 0x47, 0xD4, 0x13, 0x9D, 0x22, 0x79, 0xA5, 0xAB, 0xA4, 0xAE, 0x68,
+    0xD9, 0xBF, 0xCE, 0xED, 0x3C, 0x07, 0xCD, 0x3E, 0xE7, 0x2E, 0xE7, 0x36, 0x65, 0x9F, 0x8C, 0x30,
+    0xA8, 0xC4, 0x4C, 0x55, 0xF2, 0xCB, 0x3C, 0xBD, 0x72, 0xE9, 0x8A, 0x72, 0x4F, 0xBA, 0xA3, 0x7C,
+    0xA0, 0x7C, 0xA4, 0x94, 0x4B, 0x62, 0xEC, 0x68, 0x68, 0x8E, 0x28, 0x29, 0x27, 0x93, 0x0F, 0x01,
+    0x87, 0xEA, 0x2B, 0x40, 0x63, 0x3D, 0xC0, 0xA8, 0x0E, 0x58, 0xB2, 0x41, 0xA0, 0xC0, 0xB2, 0xF0,
+    0xB6, 0x01, 0x10, 0x15, 0xB0, 0x29, 0x8B, 0x04, 0x18, 0x4C, 0x40, 0x61, 0x1B, 0x80, 0x28, 0x82,
+    0x60, 0x88, 0x13, 0x04, 0x41, 0xA0, 0x1B, 0x01, 0x10, 0xC4, 0x67, 0xB9, 0x1F, 0xBD, 0x68, 0x11,
+    0xBC, 0x88, 0x88, 0x9D, 0xB1, 0x38, 0xAC, 0x1B, 0x44, 0x9E, 0x2B, 0x8F, 0xC3, 0x22, 0x1D, 0x89,
+    0x5B, 0xD5, 0x2B, 0x0E, 0xB6, 0x05, 0x05, 0x5C, 0xD6, 0xF5, 0xF3, 0x48, 0xA5, 0x7E, 0x0C, 0x17,
+    0xBA, 0x46, 0x58, 0x0B, 0x7B, 0x02, 0x2E, 0x5A, 0xDE, 0x0E, 0xB4, 0xCC, 0xCB, 0x4D, 0xCE, 0xBD,
+    0x23, 0xCD, 0xA7, 0x01, 0xB5, 0x42, 0xA0, 0x48, 0xAA, 0x49, 0x03, 0x1D, 0xD9, 0x4B, 0x16, 0x9C,
+    0x7D, 0x42, 0x26, 0x64, 0x23, 0xA2, 0xE8, 0x3E, 0x61, 0xB2, 0x6D, 0xB2, 0x48, 0x47, 0x77, 0xBF,
+    0xCE, 0xCA, 0xE4, 0x53, 0x1E, 0x92, 0x4D, 0x66, 0x1E, 0xEE, 0xA4, 0x3C, 0x1E, 0xA6, 0x62, 0xF3,
+    0x20, 0x55, 0x59, 0xF5, 0x5E, 0xE2, 0x0F, 0x83, 0xFE, 0x41, 0xF9, 0x9A, 0xB8, 0xE8, 0xDC, 0x95,
+    0x98, 0xF7, 0x76, 0x75, 0xD0, 0xDE, 0xFE, 0x30, 0xEA, 0xC0, 0xC9, 0xA8, 0x42, 0x9D, 0x83, 0x0B,
+    0x97, 0xF5, 0xB6, 0xB1, 0x69, 0xA7, 0x9B, 0x48, 0xDF, 0xE5, 0xD5, 0x42, 0xDA, 0xEE, 0x3B, 0x59,
+    0x5E, 0x21, 0x46, 0x5A, 0x75, 0x5B, 0x67, 0xD1, 0x56, 0x4E, 0xB5, 0xFA, 0xF7, 0x90, 0x6D, 0xC4,
+    0x64, 0x70, 0x25, 0x1E, 0xCC, 0x6A, 0xD4, 0xAD, 0x63, 0xF0, 0xE6, 0x49, 0x18, 0x48, 0x6E, 0x53,
+    0x0A, 0x52, 0x19, 0xBF, 0x86, 0x90, 0x63, 0x8C, 0xF4, 0xBD, 0xA5, 0x4B, 0xAA, 0xB1, 0xE7, 0x37,
+    0x14, 0xF3, 0x2F, 0xCC, 0x01, 0x29, 0x4E, 0x9C, 0x7E, 0x4D, 0xF3, 0xB3, 0x15, 0xC3, 0x0D, 0x33,
+    0x9E, 0x54, 0x4B, 0xB6, 0x27, 0x86, 0xA4, 0x91, 0xF2, 0x00, 0xE2, 0x01, 0x0D, 0x2C, 0x8E, 0x74,
+    0xA2, 0x14, 0xC9, 0x52, 0x08, 0xB4, 0x91, 0x0D, 0x64, 0x5A, 0x80, 0xC9, 0x99, 0xF5, 0xBD, 0xB1,
+    0x4E, 0x37, 0x63, 0xF1, 0xBC, 0xB3, 0xD7, 0x38, 0x16, 0xDC, 0xCC, 0xDF, 0xA4, 0xE3, 0xB3, 0x15,
+    0xE6, 0x35, 0xE6, 0xEB, 0x55, 0x5C, 0x28, 0x5A, 0xF0, 0x06, 0xB7, 0xA6, 0x02, 0xA5, 0xA8, 0x3D,
+    0x5B, 0xE2, 0x3F, 0x9E, 0xE7, 0x4B, 0x4A, 0xEE, 0x96, 0x96, 0x2F, 0xF7, 0x4E, 0x35, 0xD1, 0xBE,
+    0x1F, 0x5C, 0x5D, 0x3A, 0x14, 0x5E, 0x6F, 0x8B, 0x17, 0x7D, 0xB1, 0xEE, 0xED, 0xD2, 0xD3, 0x08,
+    0x48, 0xF3, 0x9F, 0x51, 0x3A, 0x90, 0xE3, 0x6C, 0x64, 0xDD, 0x0C, 0x75, 0x86, 0x48, 0x6B, 0x9B,
+    0xEE, 0x2A, 0x0F, 0x29, 0xE0, 0xDB, 0xAA, 0x88, 0x87, 0x50, 0xE2, 0x3D, 0xBD, 0xB5, 0x53, 0x12,
+    0x8F, 0x20, 0x38, 0x97, 0xF6, 0x03, 0xAF, 0xAA, 0x98, 0x79, 0x8B, 0xDA, 0x6A, 0x4E, 0x65, 0x01,
+    0x1B, 0x4D, 0xCF, 0x3F, 0x9E, 0x3D, 0xB6, 0x28, 0x46, 0xAE, 0xA7, 0x9A, 0x1B, 0xF7, 0x39, 0x68,
+    0xAE, 0x41, 0xE1, 0x4F, 0x21, 0xDF, 0x88, 0x34, 0x38, 0x12, 0x3E, 0x57, 0x7B, 0xC8, 0xF3, 0x45,
+    0x50, 0xDC, 0x51, 0xDD, 0xED, 0xB2, 0x9E, 0xB7, 0x66, 0xCC, 0xD8, 0xCF, 0x8D, 0xA4, 0x3C, 0x1D,
+    0xFC, 0xA3, 0x3B, 0xC3, 0x7F, 0x43, 0x90, 0x23, 0xA4, 0xC7, 0x14, 0x44, 0x3C, 0x8D, 0x2E, 0xEF,
+    0x6E, 0xEA, 0x46, 0xBE, 0x07, 0x94, 0xA3, 0x92, 0x06, 0xD2, 0xCC, 0x8E, 0x63, 0xCD, 0x15, 0xCC,
+    0xC4, 0xCF, 0xA8, 0x2F, 0xC7, 0x37, 0x8B, 0x40, 0xAE, 0x34, 0x1D, 0x71, 0x97, 0x2E, 0x09, 0xC3,
+    0x54, 0xCF, 0x2D, 0xF7, 0x8E, 0x2B, 0x7E, 0xB2, 0x27, 0x75, 0x82, 0xC2, 0x44, 0x81, 0x42, 0xB9,
+    0x3A, 0xD0, 0xA5, 0x48, 0xA7, 0x2C, 0x59, 0xD5, 0x98, 0x0C, 0xD0, 0x78, 0x95, 0xB9, 0x3B, 0xB6,
+    0xF4, 0xEB, 0xA4, 0x5C, 0x14, 0xE3, 0x02, 0x2D, 0xCE, 0xCD, 0xF8, 0x8D, 0x88, 0xF7, 0x84, 0xA0,
+    0xD4, 0x2D, 0x34, 0xC4, 0x24, 0x9E, 0xB9, 0x77, 0x7E, 0x50, 0xEC, 0xCD, 0xB0, 0xE7, 0x17, 0xB5,
+    0xCB, 0xA7, 0xB9, 0xD4, 0x9E, 0xF8, 0x66, 0xC6, 0x83, 0x5E, 0x07, 0xA5, 0x5B, 0xB1, 0xF8, 0x27,
+    0x98, 0xEB, 0x1B, 0x03, 0xDA, 0x4E, 0x8F, 0x62, 0x65, 0xB9, 0x83, 0x7E, 0x5B, 0xF5, 0x99, 0xD3,
+    0xFD, 0x49, 0x94, 0xC8, 0x1D, 0x71, 0x65, 0x4B, 0x60, 0x52, 0x2F, 0xF5, 0x93, 0x4B, 0x32, 0x4F,
+    0x46, 0x16, 0xFD, 0xB2, 0xC0, 0xBA, 0x62, 0xF4, 0x85, 0x37, 0xCF, 0xFE, 0x8A, 0xEA, 0x91, 0x37,
+    0xB7, 0x9A, 0xC1, 0xEE, 0x87, 0x46, 0xF2, 0x50, 0x6C, 0x50, 0x0F, 0xA2, 0xCB, 0x5E, 0x44, 0xF5,
+    0x07, 0xE2, 0x6D, 0x01, 0x59, 0x97, 0xB8, 0x46, 0xE4, 0xF5, 0x0E, 0x75, 0xBD, 0x32, 0xA9, 0xC3,
+    0x3C, 0xD6, 0xE8, 0x22, 0x83, 0x85, 0x5E, 0x73, 0x58, 0x16, 0xEB, 0x1D, 0x2C, 0x9A, 0x16, 0x7F,
+    0x1B, 0x32, 0x10, 0x80, 0x15, 0xF6, 0xDE, 0x39, 0xEE, 0xB1, 0x22, 0xBD, 0x36, 0x2E, 0x4E, 0xCF,
+    0x39, 0x5C, 0xED, 0xBC, 0xEB, 0xF7, 0x9A, 0x17, 0x6F, 0x12, 0x54, 0x06, 0xD9, 0x75, 0x14, 0x61,
+    0x27, 0xB5, 0x8B, 0x2C, 0x74, 0xAB, 0xCA, 0x54, 0xF0, 0xC9, 0x18, 0x42, 0xE0, 0xB2, 0x90, 0x9E,
+    0x40, 0xD9, 0xD3, 0x5C, 0xFD, 0xDB, 0x0D, 0x0C, 0xCF, 0x91, 0x0E, 0xF1, 0x9F, 0x2B, 0xA2, 0xE6,
+    0xA4, 0x06, 0x36, 0xD0, 0x51, 0xCB, 0x93, 0x02, 0x1C, 0xF5, 0x36, 0x76, 0x5C, 0xA0, 0x63, 0xE5,
+    0xCB, 0x2E, 0xFF, 0x88, 0xC7, 0x9D, 0x27, 0xA0, 0x83, 0xE2, 0x3B, 0xDA, 0xAC, 0xEF, 0xDE, 0xA5,
+    0x9C, 0xF2, 0x8E, 0x59, 0x11, 0xD1, 0x3F, 0x17, 0xE4, 0xCE, 0x84, 0xA2, 0x2F, 0xFC, 0x8E, 0x30,
+    0xC6, 0xDB, 0x6A, 0x32, 0x23, 0x2E, 0xC7, 0xB3, 0x74, 0xB1, 0x2C, 0x62, 0x81, 0xC2, 0xE9, 0x21,
+    0xAD, 0xD9, 0xE0, 0x07, 0xCC, 0x0F, 0x46, 0x87, 0xCA, 0x05, 0x5B, 0x95, 0x6A, 0x3F, 0x46, 0xC1,
+    0x55, 0x28, 0x2F, 0xDB, 0xAC, 0x14, 0xC8, 0x20, 0xEF, 0xA5, 0x5E, 0x8D, 0xCC, 0x36, 0x2F, 0x43,
+    0x4D, 0x06, 0x1C, 0x26, 0x77, 0x1D, 0x25, 0xA4, 0xCC, 0x50, 0xDD, 0x15, 0x48, 0x0B, 0xA9, 0xF5,
+    0xAA, 0x75, 0x5B, 0x25, 0xE9, 0xCD, 0x2F, 0xBD, 0x3D, 0x83, 0x13, 0x02, 0x5A, 0xDF, 0xE7, 0x68,
+    0x65, 0x10, 0xBA, 0xC1, 0xEC, 0x42, 0x9D, 0xA3, 0x64, 0x71, 0x9F, 0xB9, 0x27, 0x58, 0x18, 0x29,
+    0xC2, 0x86, 0xE9, 0x0A, 0x0F, 0x1F, 0x77, 0x40, 0x46, 0xD1, 0x20, 0x12, 0x18, 0x9F, 0x55, 0xC8,
+    0x35, 0xD2, 0xDB, 0xE3, 0xAC, 0x94, 0xC9, 0x2F, 0x34, 0xD2, 0x44, 0xE3, 0x6B, 0xC3, 0x59, 0x38,
+    0xF7, 0x34, 0x1D, 0x0B, 0xA4, 0x46, 0x38, 0xC5, 0xB7, 0x36, 0x11, 0xEB, 0x54, 0xA4, 0xA0, 0x73,
+    0xBB, 0x21, 0x6E, 0x0B, 0x25, 0x42, 0x71, 0x5D, 0xEE, 0xDD, 0xCC, 0x66, 0xB3, 0xAB, 0xA0, 0x90,
+    0xCF, 0xC8, 0x3C, 0xD5, 0x0F, 0x2F, 0xCE, 0x6E, 0xE0, 0xE0, 0x22, 0x99, 0x39, 0xD3, 0x11, 0x46,
+    0x74, 0xF2, 0xE0, 0x70, 0x45, 0x89, 0x2A, 0xD4, 0x26, 0x8E, 0x17, 0x8E, 0xEA, 0xF1, 0xB3, 0x9F,
+    0xD7, 0x9E, 0xF7, 0x21, 0x2E, 0x90, 0xA5, 0xBD, 0xF9, 0x86, 0xE4, 0xFE, 0xE3, 0x61, 0xFF, 0xCA,
+    0x25, 0xF3, 0x49, 0x00, 0xB7, 0x73, 0x07, 0x08, 0xF5, 0x84, 0x41, 0x8B, 0xD8, 0x27, 0x66, 0x5F,
+    0x2D, 0x49, 0x70, 0xA9, 0x16, 0x49, 0x9C, 0xA6, 0x3E, 0xF1, 0xAF, 0x60, 0xF8, 0xFF, 0x48, 0xF1,
+    0xC8, 0x82, 0x55, 0xE6, 0xFE, 0xFD, 0xB5, 0xED, 0xED, 0x80, 0x03, 0x29, 0x93, 0xF1, 0x85, 0x93,
+    0xF8, 0x80, 0x8B, 0x36, 0x41, 0x1E, 0x2D, 0xA6, 0x01, 0xCE, 0x96, 0x06, 0x9D, 0x66, 0x2A, 0xF0,
+    0x50, 0x5F, 0x13, 0x0C, 0x4B, 0xC2, 0x83, 0x79, 0x78, 0x6E, 0xC9, 0x63, 0x8C, 0xDE, 0xC5, 0x67,
+    0x60, 0xB0, 0xE2, 0xFC, 0x5D, 0x7A, 0x63, 0x7F, 0xFF, 0xBF, 0x85, 0x55, 0x31, 0x6F, 0xDC, 0x36,
+    0x14, 0x7E, 0x27, 0xC6, 0x55, 0x10, 0x15, 0x60, 0x87, 0x1A, 0x28, 0x92, 0x41, 0x99, 0xBB, 0x28,
+    0x43, 0xD7, 0x86, 0xF2, 0x94, 0xA1, 0x43, 0x3D, 0x54, 0x4B, 0x33, 0x78, 0xCF, 0x92, 0xFE, 0x81,
+    0x54, 0x0A, 0x32, 0x64, 0xF0, 0x10, 0x0F, 0xCD, 0xDC, 0x0C, 0x19, 0x6A, 0x75, 0xB8, 0xD5, 0x43,
+    0x62, 0x0A, 0xF6, 0xD8, 0xA1, 0x87, 0x66, 0xE8, 0x90, 0x21, 0x82, 0x83, 0xA2, 0x80, 0x97, 0x10,
+    0x89, 0x82, 0xC8, 0x36, 0xA5, 0xD7, 0xEF, 0x51, 0x3E, 0xDB, 0x29, 0x0A, 0x54, 0x77, 0x24, 0x8E,
+    0x22, 0xF9, 0xF8, 0x7D, 0xDF, 0xFB, 0x1E, 0x8F, 0x2E, 0x11, 0xE9, 0x86, 0xB4, 0xA7, 0x94, 0x9B,
+    0x94, 0x87, 0xF4, 0xD5, 0xAB, 0xFD, 0xD7, 0x6F, 0xDB, 0xEB, 0xFE, 0x3A, 0x99, 0x30, 0xA3, 0x1C,
+    0x91, 0xA7, 0xCB, 0xE6, 0xB2, 0x7E, 0xF4, 0xDB, 0xFE, 0x87, 0x0F, 0xCE, 0xB0, 0x53, 0xEC, 0xC8,
+    0xB8, 0x30, 0xF3, 0x19, 0x51, 0x52, 0x11, 0xD9, 0x8A, 0x12, 0xAE, 0x88, 0xB9, 0xD1, 0x6F, 0xDE,
+    0x34, 0xC6, 0x18, 0xBA, 0xE1, 0x6F, 0x84, 0x05, 0x88, 0x20, 0x81, 0x7E, 0xF0, 0x5F, 0xC5, 0xEF,
+    0xDE, 0xB9, 0x84, 0xB9, 0x4A, 0xB8, 0x0F, 0x8B, 0xE3, 0x8E, 0x56, 0x6F, 0x3F, 0x5E, 0x67, 0xE6,
+    0x7D, 0x34, 0xCD, 0xEC, 0x89, 0x32, 0xC4, 0x69, 0x29, 0xEA, 0x89, 0x76, 0x2F, 0x0C, 0xB6, 0x76,
+    0xE9, 0x79, 0x56, 0xD9, 0x6F, 0x5A, 0x1B, 0x75, 0x96, 0x9E, 0x97, 0xCC, 0x77, 0x99, 0x5F, 0x30,
+    0x77, 0x26, 0xA7, 0x18, 0x6B, 0x4B, 0x04, 0xC3, 0x31, 0xF9, 0x47, 0x9B, 0x2E, 0x0E, 0xBE, 0xA0,
+    0xDD, 0xB4, 0xCA, 0x1E, 0xF6, 0x49, 0x6B, 0xEE, 0xF7, 0xAA, 0x47, 0x80, 0x0D, 0xE6, 0xBF, 0x19,
+    0x34, 0x62, 0x47, 0x09, 0xBE, 0x1D, 0x11, 0xBE, 0x90, 0x82, 0xE8, 0x2A, 0x9A, 0x5E, 0x10, 0xA9,
+    0x8E, 0x1C, 0x0D, 0x64, 0xC9, 0xE4, 0x36, 0xD7, 0x8B, 0x5D, 0xBC, 0xB0, 0x45, 0x31, 0x60, 0xAF,
+    0x6C, 0xE6, 0xBD, 0xA1, 0x28, 0xD6, 0x11, 0x9F, 0x22, 0xC0, 0x26, 0x83, 0xE3, 0x55, 0x43, 0xD3,
+    0x13, 0x49, 0x07, 0xCE, 0xA4, 0x7A, 0xF9, 0x21, 0x6B, 0x86, 0xA2, 0x7E, 0x9A, 0x61, 0xD7, 0x1F,
+    0x2C, 0xDB, 0xF1, 0x86, 0x7E, 0x94, 0x45, 0x16, 0xA3, 0x85, 0x74, 0xB9, 0x2D, 0xBE, 0xDF, 0x16,
+    0xC4, 0x34, 0x75, 0xB2, 0x91, 0x64, 0x59, 0xD4, 0xA2, 0x8D, 0x68, 0x2C, 0x3C, 0x00, 0x62, 0xCC,
+    0x20, 0xFF, 0x26, 0xAB, 0x93, 0x83, 0x13, 0xB7, 0xD3, 0x3F, 0xDB, 0xB9, 0x74, 0x33, 0xBB, 0x44,
+    0x7A, 0x13, 0x79, 0x3A, 0x80, 0xDA, 0xFD, 0x33, 0xA2, 0x9B, 0x19, 0xFD, 0xC7, 0x8B, 0x5B, 0xCD,
+    0x45, 0x64, 0xA0, 0x15, 0xBA, 0x3B, 0xDB, 0xC5, 0x38, 0xC3, 0xF9, 0x63, 0x2C, 0x9D, 0xBC, 0x7B,
+    0x2E, 0xCB, 0xDE, 0x0B, 0xCC, 0x87, 0x68, 0xFD, 0xD5, 0xED, 0xA2, 0x14, 0x02, 0x02, 0x48, 0xD8,
+    0xD2, 0xB3, 0x53, 0x64, 0x5F, 0xA7, 0xF4, 0xFF, 0xC7, 0x46, 0x7A, 0x73, 0x4F, 0xBD, 0x3E, 0x78,
+    0xEB, 0xC6, 0x7E, 0xD7, 0x27, 0x63, 0xD6, 0x93, 0xDD, 0x44, 0xF2, 0x0F, 0x10, 0xCD, 0xA2, 0x25,
+    0x12, 0x75, 0xE7, 0x54, 0x35, 0xBA, 0xA1, 0xA0, 0x98, 0x03, 0x3A, 0x08, 0x2E, 0xD2, 0x41, 0x79,
+    0x20, 0x88, 0x04, 0x58, 0x96, 0x13, 0xDD, 0xBB, 0x07, 0x18, 0x9D, 0x88, 0x55, 0xA1, 0xEB, 0x69,
+    0x14, 0x3C, 0xA3, 0xA8, 0xEF, 0xC5, 0x63, 0xCD, 0xA7, 0x74, 0xFE, 0xC0, 0xCD, 0x64, 0xF6, 0x19,
+    0x3F, 0xDA, 0xB2, 0x45, 0x76, 0x31, 0x56, 0x3E, 0xC2, 0x78, 0xA0, 0xF2, 0xB0, 0xB6, 0xA4, 0x25,
+    0x8A, 0x44, 0x6E, 0xC8, 0xBC, 0xDF, 0x68, 0xB1, 0x1E, 0xD9, 0x9E, 0xF1, 0x4C, 0xB6, 0xB5, 0x03,
+    0x80, 0x79, 0xC0, 0x98, 0xB1, 0x10, 0x36, 0x6F, 0x10, 0x3C, 0x81, 0x53, 0x30, 0xEE, 0x44, 0x3D,
+    0x49, 0x77, 0x12, 0xA4, 0x0A, 0xDD, 0xE7, 0xD2, 0x7D, 0xF2, 0x14, 0x26, 0xE4, 0x0A, 0x4A, 0xB6,
+    0x51, 0x9B, 0x89, 0xEB, 0xC1, 0x2C, 0xC6, 0x4A, 0x35, 0xB5, 0xE4, 0xC4, 0x63, 0x1E, 0x08, 0xE6,
+    0x3E, 0xEE, 0x95, 0xD7, 0x4E, 0xF9, 0x74, 0xA1, 0x7A, 0xD3, 0xC4, 0x9D, 0x69, 0x12, 0x67, 0x1A,
+    0x8D, 0x96, 0x2E, 0x4C, 0x23, 0x1F, 0x9B, 0x9B, 0x93, 0x11, 0x10, 0x3B, 0x52, 0xA8, 0x12, 0xA9,
+    0x30, 0x79, 0x4E, 0xCB, 0xE4, 0x5B, 0x66, 0xE0, 0xD3, 0x40, 0x62, 0xE0, 0x51, 0xCE, 0x49, 0x85,
+    0x61, 0x5D, 0xDB, 0x17, 0xA7, 0xB3, 0xAB, 0xC5, 0xC6, 0xBF, 0x67, 0xD7, 0xC9, 0xFC, 0x39, 0xD9,
+    0x56, 0xEC, 0xEB, 0x96, 0x2A, 0xDD, 0xD9, 0x52, 0x15, 0x60, 0xF5, 0x06, 0xFC, 0xE4, 0xB5, 0x3D,
+    0x9E, 0x33, 0x25, 0x03, 0xD8, 0xCB, 0x76, 0xD3, 0xC3, 0x77, 0x11, 0x3B, 0xED, 0x28, 0x2B, 0x17,
+    0x65, 0x03, 0xED, 0xEF, 0x43, 0xF3, 0xB5, 0x31, 0xE9, 0xA2, 0x2E, 0xEE, 0xB3, 0x45, 0x56, 0xA5,
+    0xAD, 0x5D, 0x43, 0x9E, 0xD6, 0xC6, 0xB4, 0x52, 0x3E, 0x1E, 0x7A, 0xD2, 0x4E, 0x03, 0xB2, 0xAD,
+    0x90, 0x68, 0xB0, 0xC7, 0x15, 0x61, 0x17, 0xC4, 0xA3, 0x1D, 0x83, 0xE0, 0x0B, 0xF2, 0x19, 0xF2,
+    0x16, 0x35, 0x2B, 0x8F, 0xCF, 0x33, 0x75, 0x25, 0xF8, 0xB0, 0x12, 0x75, 0xA5, 0x84, 0xB0, 0x88,
+    0x62, 0x58, 0x7D, 0x52, 0x5C, 0xFF, 0x0E, 0x26, 0xD9, 0x23, 0xC9, 0x8A, 0x88, 0x59, 0x2A, 0x28,
+    0x3E, 0x28, 0xA4, 0xD1, 0xCF, 0x38, 0x87, 0x25, 0xB9, 0x42, 0xDA, 0xB8, 0x41, 0x0D, 0x97, 0x0B,
+    0xDD, 0x22, 0x75, 0x29, 0x60, 0xBB, 0xAC, 0xA1, 0xB4, 0x33, 0x87, 0xF5, 0xDC, 0x4B, 0xAD, 0x4E,
+    0x9D, 0x9C, 0x22, 0x3E, 0xE7, 0x97, 0xD2, 0xFD, 0xCC, 0xF5, 0x7C, 0x00, 0x3A, 0xED, 0x2C, 0x0C,
+    0xB0, 0x06, 0x2B, 0x78, 0x44, 0xD5, 0x2D, 0x88, 0x97, 0x48, 0x5D, 0x24, 0xD0, 0x71, 0x05, 0x94,
+    0x4D, 0x09, 0x11, 0x1F, 0x00, 0x32, 0xC3, 0x61, 0xB1, 0x47, 0x65, 0xEA, 0x13, 0xC0, 0xCA, 0x04,
+    0xAA, 0x19, 0x24, 0x29, 0xC1, 0x16, 0xD5, 0x94, 0x67, 0x5A, 0x39, 0xA7, 0x05, 0x87, 0x36, 0xE2,
+    0x2F, 0xD4, 0x2A, 0x4E, 0x57, 0xFC, 0x93, 0x54, 0x70, 0x48, 0xE3, 0x92, 0x6F, 0xB8, 0x32, 0x48,
+    0x1F, 0xD7, 0x75, 0xFD, 0x40, 0x30, 0x39, 0xE9, 0x3C, 0x60, 0xD7, 0xB5, 0x96, 0x0C, 0x45, 0xC1,
+    0x5D, 0x61, 0x51, 0x12, 0xE0, 0xF3, 0x5F, 0x45, 0x91, 0xEB, 0x29, 0x51, 0xC2, 0x68, 0x86, 0x3E,
+    0xD0, 0x5A, 0x97, 0xCE, 0x9F, 0x06, 0x4F, 0x64, 0x4A, 0x6E, 0x9A, 0x50, 0x3C, 0x8D, 0x39, 0xBA,
+    0xD5, 0x51, 0xE6, 0xC0, 0x08, 0x41, 0x47, 0x29, 0xB8, 0x52, 0xB0, 0x42, 0x22, 0x48, 0x70, 0xFC,
+    0x8B, 0xAC, 0x91, 0x9B, 0x17, 0xDE, 0x1A, 0xEB, 0xB1, 0x7E, 0xC2, 0x39, 0x18, 0x67, 0x2D, 0xAE,
+    0x2C, 0x98, 0x14, 0xA9, 0xB0, 0x2F, 0x25, 0x0B, 0x3C, 0x14, 0xDF, 0x89, 0xFF, 0x38, 0xF8, 0xA4,
+    0x91, 0xC8, 0x8E, 0xD2, 0x00, 0xDF, 0x2D, 0x01, 0x10, 0xAD, 0x16, 0x05, 0xC9, 0x2D, 0xD2, 0x04,
+    0x8C, 0xD2, 0x79, 0x2D, 0x1C, 0x24, 0x73, 0xC1, 0x87, 0xC0, 0x07, 0x72, 0x1F, 0x9F, 0x59, 0xD7,
+    0x4F, 0x82, 0x18, 0xA9, 0x04, 0x52, 0xBC, 0x25, 0x94, 0xCF, 0x64, 0xA3, 0x6B, 0x72, 0x26, 0xCD,
+    0xC0, 0x7B, 0xAA, 0x6A, 0x29, 0x7B, 0x99, 0x69, 0x27, 0x34, 0x50, 0xDC, 0x86, 0x7D, 0x17, 0xA4,
+    0x0A, 0x17, 0x27, 0x5F, 0x41, 0x60, 0xBB, 0x7F, 0x2E, 0xEB, 0x97, 0x18, 0xF3, 0xD9, 0xA2, 0xAC,
+    0x5D, 0x42, 0xD7, 0xFD, 0x4A, 0x51, 0xDC, 0xF5, 0xD3, 0x69, 0x72, 0xDD, 0xC9, 0xE9, 0x5B, 0x4B,
+    0x4A, 0xC3, 0xD9, 0x0E, 0xB9, 0x2E, 0x64, 0x6A, 0x32, 0x32, 0xFE, 0x35, 0xBA, 0xDB, 0x2C, 0xF5,
+    0x6F, 0x5A, 0x48, 0x09, 0x3D, 0x61, 0x43, 0xD0, 0xC0, 0xAC, 0xAB, 0xED, 0xE1, 0xAF, 0xFE, 0x9C,
+    0xE2, 0x5E, 0x3D, 0x3F, 0x9C, 0xE3, 0x9F, 0xB2, 0x13, 0x15, 0xAC, 0xE4, 0x34, 0x6D, 0xB0, 0x53,
+    0x1D, 0x71, 0x55, 0x14, 0x92, 0x9F, 0xA5, 0x60, 0x95, 0x9A, 0x18, 0x85, 0xBF, 0x9E, 0xC9, 0x4E,
+    0xB4, 0x3A, 0x89, 0x1A, 0xCE, 0xCC, 0xCF, 0x30, 0x72, 0xA0, 0x30, 0xE5, 0x3B, 0x0F, 0xD2, 0x81,
+    0xDC, 0xC7, 0x67, 0xD6, 0xF5, 0xDC, 0x2D, 0xC5, 0x88, 0x85, 0xC5, 0x35, 0x56, 0x41, 0x31, 0x3E,
+    0x35, 0xC6, 0x11, 0xAD, 0x48, 0x60, 0x79, 0xFE, 0x01, 0xB5, 0x55, 0x3D, 0x6F, 0x1D, 0x45, 0x14,
+    0xBD, 0xBB, 0x43, 0xB2, 0x92, 0x57, 0x62, 0x53, 0xE0, 0x14, 0x16, 0xD2, 0xFE, 0x02, 0x34, 0x2D,
+    0x15, 0xBB, 0xAE, 0x28, 0x28, 0x88, 0x90, 0x53, 0xA7, 0xA1, 0xA2, 0x49, 0x4B, 0x13, 0xBD, 0x05,
+    0x7E, 0x00, 0x29, 0xE8, 0x68, 0x28, 0xC3, 0x36, 0xFE, 0x03, 0xD8, 0xB3, 0xD8, 0x05, 0x85, 0x8B,
+    0x2C, 0xA4, 0x48, 0x99, 0x87, 0x88, 0x94, 0xC2, 0xCD, 0x26, 0x5A, 0x60, 0xF3, 0x98, 0xD9, 0xCB,
+    0x39, 0xE3, 0xF7, 0x6C, 0x59, 0x91, 0x92, 0x40, 0x60, 0xF4, 0x66, 0xBC, 0x73, 0xE7, 0x7E, 0xCD,
+    0x9D, 0x73, 0xAE, 0x45, 0x30, 0x8C, 0x72, 0xDC, 0x8F, 0xEB, 0x55, 0x5D, 0xED, 0x6B, 0x9F, 0x05,
+    0x31, 0xB3, 0x94, 0xA3, 0x14, 0x93, 0x2C, 0x7A, 0xA9, 0x96, 0x89, 0xD6, 0xA2, 0xCD, 0xFF, 0x23,
+    0x2E, 0x75, 0xCA, 0xD5, 0xAB, 0x0E, 0x4E, 0x9F, 0xB6, 0xED, 0x6E, 0xDB, 0x36, 0x4C, 0x4A, 0x2A,
+    0x64, 0xB3, 0x8B, 0x39, 0x67, 0xDA, 0xBA, 0xA9, 0x08, 0x92, 0x0D, 0x85, 0x97, 0xA2, 0xB1, 0x93,
+    0xBC, 0x27, 0xD5, 0x40, 0x0D, 0x2E, 0x70, 0x21, 0xA2, 0x1D, 0x17, 0xD8, 0x25, 0xCA, 0xFB, 0x78,
+    0x1E, 0x42, 0x9E, 0xCE, 0xF8, 0x28, 0xA9, 0x45, 0x71, 0x31, 0xCA, 0x96, 0xB8, 0x46, 0xEE, 0x64,
+    0x5E, 0xCC, 0x58, 0x75, 0x52, 0x3E, 0xE0, 0x8D, 0x0B, 0x4C, 0x6F, 0xB1, 0x2C, 0xAF, 0xB7, 0x6D,
+    0x5B, 0x43, 0x31, 0x53, 0x0D, 0x0B, 0xD5, 0x5F, 0xDA, 0xF6, 0x9E, 0x48, 0x0E, 0x73, 0xE8, 0x26,
+    0x01, 0x0E, 0xF0, 0xB9, 0xA8, 0xA3, 0xFB, 0x62, 0x29, 0xE2, 0x10, 0x69, 0x12, 0xB1, 0x7D, 0x74,
+    0x9F, 0x8D, 0x67, 0x7A, 0xF3, 0xDA, 0xA4, 0x91, 0xD4, 0x5F, 0x32, 0x29, 0xCF, 0x4C, 0x92, 0x1B,
+    0x12, 0x15, 0x29, 0xA6, 0x1D, 0xB5, 0xE8, 0x86, 0x46, 0x54, 0x79, 0xCD, 0xA3, 0x70, 0x71, 0x54,
+    0xAC, 0x8F, 0xB6, 0x45, 0xB6, 0x6A, 0x49, 0x90, 0x47, 0x59, 0xA7, 0x3F, 0x8F, 0x9F, 0x57, 0x8F,
+    0x16, 0x47, 0xAA, 0x53, 0xAA, 0x93, 0x94, 0x5A, 0x97, 0xAA, 0x1F, 0xCE, 0x7F, 0x85, 0xAA, 0xFC,
+    0xB8, 0xDB, 0x1D, 0xAF, 0x41, 0x25, 0x6A, 0x7E, 0x56, 0x67, 0xCA, 0x07, 0xA8, 0xBE, 0xF4, 0x95,
+    0x6C, 0x7E, 0x0F, 0xA7, 0x52, 0x87, 0x0C, 0x35, 0xDD, 0x93, 0xC4, 0x78, 0x77, 0x3A, 0xD3, 0x3B,
+    0xC6, 0x1E, 0x66, 0xBE, 0x64, 0xFA, 0xAC, 0x12, 0x8B, 0x9C, 0xB1, 0xB6, 0xF6, 0xF2, 0xAE, 0x59,
+    0xEF, 0xCC, 0x70, 0x65, 0x0F, 0xBB, 0xC5, 0x24, 0x21, 0xD1, 0xC1, 0x0C, 0xA9, 0xEB, 0xCA, 0x06,
+    0xF9, 0x1F, 0x88, 0xCC, 0x66, 0x40, 0x49, 0xB0, 0xCB, 0x07, 0xEC, 0x8A, 0x07, 0xAC, 0xD7, 0xD7,
+    0x88, 0xE1, 0xEE, 0xF0, 0x05, 0x07, 0x22, 0x12, 0xBB, 0xFC, 0xFC, 0xF5, 0x62, 0xFC, 0x77, 0x30,
+    0x6F, 0xC8, 0x35, 0xD7, 0x97, 0x95, 0x7E, 0xF4, 0xE7, 0x6A, 0x0E, 0x07, 0xD9, 0x5C, 0x74, 0xB6,
+    0xF3, 0x26, 0xE4, 0x4B, 0x37, 0x2E, 0xF4, 0xD6, 0x6F, 0xDA, 0xBB, 0xFC, 0x71, 0x42, 0x0B, 0xA9,
+    0xA1, 0x8F, 0x80, 0xA3, 0xD5, 0x5C, 0x8F, 0x57, 0x33, 0xB5, 0x43, 0x76, 0x0A, 0xF5, 0x0F, 0x0E,
+    0x8C, 0x37, 0xA7, 0x4B, 0x1D, 0x0E, 0x61, 0xA1, 0x47, 0x30, 0x99, 0xF2, 0x91, 0xAF, 0xCB, 0xC1,
+    0x3F, 0x66, 0x24, 0x56, 0xFA, 0xCD, 0x35, 0xFF, 0xB5, 0x68, 0x06, 0x9A, 0xBE, 0x3A, 0x07, 0x18,
+    0xD1, 0x3C, 0xC8, 0x66, 0xA4, 0x11, 0xE2, 0x65, 0x2C, 0xAB, 0x52, 0x19, 0x5C, 0x58, 0x23, 0x58,
+    0x72, 0x16, 0x4F, 0x16, 0x3C, 0x33, 0x31, 0xAD, 0x8A, 0x25, 0x37, 0x2C, 0x86, 0x58, 0xBA, 0x88,
+    0x18, 0x27, 0x9A, 0x2F, 0x1B, 0x3B, 0x5A, 0x64, 0x8C, 0xDA, 0x30, 0x98, 0x46, 0x56, 0xC7, 0xB8,
+    0x3A, 0x6C, 0xDB, 0x93, 0x67, 0xDE, 0xBD, 0x7C, 0xD9, 0x69, 0xB6, 0x93, 0x4F, 0xBC, 0x3D, 0x19,
+    0x9C, 0x3D, 0xF2, 0x2E, 0x7F, 0xF6, 0xC6, 0x9F, 0x4F, 0xEF, 0xED, 0x34, 0xEB, 0xFB, 0xC6, 0xAA,
+    0xC4, 0x8B, 0x19, 0x66, 0x9C, 0x28, 0xAF, 0xA4, 0x91, 0xA6, 0x20, 0xA4, 0xD8, 0xFB, 0x84, 0xF1,
+    0xAF, 0x81, 0x2C, 0x02, 0x71, 0x8C, 0x07, 0xAC, 0x93, 0x99, 0x54, 0x72, 0x7C, 0xFB, 0xAA, 0x03,
+    0xB9, 0x40, 0x33, 0x25, 0x9D, 0x6C, 0x97, 0x4D, 0x92, 0x4D, 0xE4, 0x86, 0x92, 0x09, 0xB6, 0x77,
+    0xE4, 0x17, 0x21, 0xA2, 0xEB, 0x60, 0x84, 0xD3, 0x51, 0xE4, 0x2B, 0xA4, 0xF9, 0x98, 0x13, 0x6C,
+    0x70, 0x86, 0x1F, 0xF6, 0x4A, 0xA6, 0x22, 0x88, 0xD2, 0xA3, 0xED, 0xA0, 0x6C, 0x26, 0x78, 0x14,
+    0xA5, 0xC7, 0xB2, 0x9F, 0xD9, 0x3E, 0x48, 0x32, 0x47, 0x8F, 0x85, 0xF6, 0x4C, 0x39, 0xF6, 0x19,
+    0x16, 0xB9, 0x60, 0xCA, 0x69, 0x8C, 0x13, 0xDF, 0x78, 0xE7, 0x7B, 0x1C, 0xE8, 0x28, 0x4E, 0xB5,
+    0x59, 0xAC, 0xDC, 0x58, 0xF5, 0xA9, 0x82, 0x8E, 0xF6, 0x27, 0x78, 0xFD, 0x1D, 0xBA, 0x01, 0x84,
+    0xAF, 0xF6, 0x3B, 0x29, 0x4E, 0x21, 0x58, 0x41, 0x30, 0xBF, 0x9E, 0x20, 0xD6, 0xCD, 0xFE, 0x73,
+    0x3B, 0x0A, 0x9E, 0x30, 0x76, 0x40, 0xC3, 0x82, 0x17, 0x07, 0x68, 0xB8, 0x1F, 0x81, 0x80, 0x0E,
+    0xF4, 0xEF, 0x91, 0x66, 0x23, 0xC9, 0x4D, 0xFA, 0xDE, 0xBA, 0x8B, 0x1B, 0x06, 0x76, 0x7E, 0xC9,
+    0xC2, 0x21, 0xC0, 0xF4, 0x7E, 0x04, 0xD4, 0x7F, 0x32, 0x87, 0xC8, 0xDA, 0x77, 0x31, 0x0F, 0xED,
+    0x52, 0x10, 0x1B, 0x25, 0x42, 0xC4, 0xC7, 0x1B, 0xF0, 0xB3, 0x53, 0x9E, 0xF5, 0x6E, 0xB2, 0xDC,
+    0xB0, 0x9A, 0xC9, 0x5D, 0x79, 0xF5, 0xE0, 0x63, 0x9F, 0xE0, 0x62, 0xBA, 0x3F, 0x02, 0xE7, 0x20,
+    0x48, 0x31, 0xA2, 0x27, 0x5C, 0x39, 0x3B, 0x3C, 0x7C, 0xF1, 0xF0, 0xD3, 0xD8, 0x0F, 0x5F, 0x39,
+    0xF8, 0xF8, 0x17, 0xE9, 0xC4, 0x7F, 0x19, 0xEC, 0xD1, 0x57, 0x1B, 0x3D, 0xD6, 0xC2, 0x97, 0xFD,
+    0x85, 0x66, 0xF2, 0x5D, 0x35, 0x40, 0x98, 0x0D, 0x6F, 0x16, 0xF1, 0xA5, 0xF7, 0x68, 0xEB, 0xE4,
+    0x0B, 0x0D, 0xC9, 0x73, 0xBC, 0x59, 0x38, 0x48, 0x75, 0x7E, 0x5B, 0xF2, 0xE7, 0x17, 0x6D, 0x43,
+    0x7B, 0x73, 0x8C, 0x3E, 0xBE, 0x9A, 0x9D, 0xFA, 0x1F, 0xC4, 0xF9, 0xB7, 0x24, 0xF9, 0xE6, 0xFC,
+    0x14, 0x20, 0xD4, 0xDB, 0x98, 0x0F, 0x31, 0xC7, 0x8D, 0x70, 0x07, 0xFD, 0xE0, 0x5B, 0x08, 0xFE,
+    0xA0, 0xC3, 0x17, 0x73, 0xF9, 0x1B, 0x9D, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0x1E, 0x67,
+    0xE3, 0x62, 0x0A, 0x37, 0x6C, 0x03, 0xC5, 0x4B, 0x99, 0xEA, 0xF9, 0x17, 0x04, 0x1B, 0xB6, 0xA0,
+    0xA0, 0xD9, 0x62, 0x5F, 0x93, 0x14, 0xD4, 0xA1, 0xD9, 0x9F, 0x60, 0x0B, 0x0A, 0x4A, 0x52, 0x40,
+    0x45, 0x41, 0x93, 0x26, 0x8F, 0x62, 0x29, 0xB7, 0xD8, 0x5D, 0x5B, 0xC9, 0x1F, 0x70, 0x22, 0x21,
+    0x8A, 0x34, 0xA3, 0x50, 0xAC, 0x44, 0xA4, 0xE0, 0x48, 0x16, 0x32, 0x8B, 0xED, 0xCB, 0x39, 0x33,
+    0xEF, 0xBD, 0x5D, 0x14, 0x21, 0x01, 0xA3, 0x37, 0x33, 0x6F, 0xBE, 0xEE, 0xB9, 0xF7, 0xCC, 0xB9,
+    0xE3, 0xA8, 0x90, 0x48, 0x9B, 0x65, 0xA9, 0x5F, 0xE9, 0x9F, 0x3A, 0x8F, 0x56, 0x9F, 0x16, 0xB6,
+    0x8D, 0x0E, 0xE5, 0xA3, 0x77, 0x26, 0x05, 0x25, 0xFD, 0x46, 0x1E, 0x3C, 0x53, 0xD5, 0xAE, 0x56,
+    0x1D, 0xE4, 0xFE, 0x93, 0x42, 0xB6, 0xE5, 0xF6, 0xC9, 0xAF, 0x45, 0x8E, 0x95, 0x14, 0xF5, 0xD9,
+    0x23, 0x89, 0x7E, 0xDC, 0xAD, 0xC4, 0x38, 0x79, 0x9E, 0xA8, 0x4E, 0xA5, 0xEA, 0xCF, 0xE8, 0x24,
+    0x6D, 0xC4, 0xF4, 0xB2, 0x5F, 0xAE, 0x3E, 0x09, 0x93, 0xCF, 0xCB, 0xD5, 0x51, 0x82, 0x4D, 0x77,
+    0xC3, 0xFE, 0xFD, 0xD5, 0x6A, 0x95, 0xC1, 0xCA, 0x4B, 0xD4, 0x1E, 0xFF, 0x8F, 0xB6, 0x86, 0x2C,
+    0x26, 0x7E, 0xD7, 0x70, 0x46, 0xB7, 0xC8, 0xD1, 0x7A, 0xBD, 0x7E, 0x02, 0x6F, 0xF4, 0x18, 0xB5,
+    0xDD, 0x81, 0xCA, 0xA9, 0x48, 0xDD, 0x48, 0xDD, 0xFB, 0x9F, 0x93, 0xD2, 0x49, 0x32, 0x8B, 0x2C,
+    0x6E, 0xD6, 0x51, 0x24, 0x6B, 0x44, 0xEE, 0x60, 0xF7, 0x0D, 0xF7, 0x6E, 0x09, 0xBD, 0x93, 0xBC,
+    0x97, 0x08, 0x47, 0x65, 0x57, 0x5B, 0x49, 0x26, 0xB8, 0x50, 0x84, 0x5F, 0x0C, 0x07, 0x96, 0xBB,
+    0xE8, 0x6F, 0x46, 0xB7, 0x29, 0xC6, 0x89, 0x2D, 0xC4, 0x8E, 0x52, 0x76, 0x92, 0x4D, 0x91, 0x3A,
+    0x58, 0x49, 0xB4, 0x32, 0x5A, 0x01, 0x3B, 0x9E, 0x25, 0x83, 0x7D, 0xAD, 0xEC, 0xE4, 0x7D, 0x29,
+    0x07, 0x41, 0xE5, 0x26, 0x54, 0xAB, 0x15, 0x0C, 0x4A, 0x06, 0xF7, 0x16, 0x8D, 0x9C, 0xC3, 0xD6,
+    0xA1, 0x98, 0x2D, 0x50, 0x25, 0x4B, 0x30, 0x3A, 0x17, 0x29, 0x4E, 0x04, 0xB3, 0xC1, 0xAE, 0x18,
+    0x6D, 0x2D, 0x82, 0x42, 0x90, 0x59, 0xE7, 0x2D, 0x8F, 0x74, 0x36, 0x9B, 0xB0, 0xCB, 0x53, 0x30,
+    0x60, 0x83, 0xA8, 0x4B, 0xE0, 0x77, 0x56, 0x09, 0x60, 0x61, 0xF2, 0xBD, 0xC0, 0x36, 0xAE, 0x95,
+    0x84, 0xC6, 0x68, 0x46, 0x41, 0xA3, 0x20, 0xC5, 0xB3, 0x23, 0xE2, 0x69, 0x5E, 0x74, 0xBC, 0xC5,
+    0x30, 0x66, 0x93, 0x73, 0x3D, 0xE5, 0x64, 0x32, 0x70, 0x65, 0xF2, 0x77, 0xC3, 0xE3, 0xEA, 0x8F,
+    0x0B, 0x74, 0xF0, 0x87, 0xEC, 0xD1, 0xB0, 0xBF, 0xA1, 0x43, 0x36, 0xFE, 0x78, 0xED, 0x8F, 0xC3,
+    0xE6, 0xDE, 0xF1, 0x4F, 0x72, 0x9B, 0x48, 0x44, 0xEE, 0xD8, 0x8C, 0xE9, 0x2C, 0xB3, 0x24, 0xE0,
+    0x8B, 0x06, 0x71, 0x2F, 0x2A, 0xA9, 0x03, 0x54, 0xD2, 0x01, 0x0A, 0xE0, 0xF8, 0x4D, 0xF4, 0xA7,
+    0xA4, 0x3F, 0x79, 0x25, 0xB1, 0x7E, 0x8F, 0xDB, 0xA6, 0xE2, 0xBA, 0xE0, 0xF8, 0x07, 0x44, 0x96,
+    0x7A, 0xB5, 0x2A, 0x04, 0xCB, 0x9E, 0x3B, 0xB8, 0x45, 0x2F, 0xA3, 0xC7, 0xC1, 0x91, 0xA3, 0xEB,
+    0x08, 0x18, 0x16, 0x30, 0xF6, 0x57, 0x9F, 0x39, 0x06, 0x3F, 0xFF, 0x3D, 0xF8, 0xF2, 0xD8, 0x4B,
+    0x03, 0xC1, 0xA7, 0x0E, 0x6C, 0x26, 0x1B, 0x7C, 0x1C, 0x9D, 0x18, 0x7C, 0xCD, 0xE0, 0xF3, 0x0A,
+    0xBE, 0xA6, 0x2D, 0x7C, 0xB5, 0x5D, 0xF2, 0x6E, 0xF0, 0xE5, 0xB7, 0xC5, 0xC6, 0x05, 0x44, 0x01,
+    0x8E, 0xFA, 0x9D, 0x03, 0xA1, 0x40, 0xAD, 0x8E, 0x22, 0xFF, 0x12, 0x75, 0xCE, 0xA6, 0x22, 0x50,
+    0xED, 0xF9, 0xCC, 0xA8, 0xE2, 0x1A, 0x23, 0x33, 0x93, 0x62, 0x12, 0xC7, 0xDB, 0x86, 0x4E, 0xD6,
+    0xEB, 0xC7, 0x0B, 0xEC, 0x77, 0xE4, 0xAB, 0x8A, 0x4E, 0x74, 0xF6, 0xA6, 0x90, 0x22, 0xAB, 0x03,
+    0x42, 0x7F, 0x4D, 0x5B, 0x64, 0x64, 0xF0, 0x02, 0x64, 0x58, 0x4C, 0x19, 0x8F, 0x03, 0x1E, 0xF6,
+    0x28, 0x16, 0x29, 0x9B, 0x8D, 0xF5, 0x68, 0xDE, 0x5E, 0x60, 0xE6, 0x36, 0x37, 0x6D, 0xC7, 0xCF,
+    0xD7, 0x6B, 0x7D, 0xC1, 0x14, 0xE3, 0xC1, 0x26, 0xD3, 0xF9, 0x91, 0xEC, 0x30, 0x3E, 0x25, 0x06,
+    0x6D, 0x8D, 0x75, 0x30, 0xB8, 0xEF, 0x51, 0x66, 0x9F, 0x98, 0x03, 0xE2, 0x3C, 0xCD, 0x9A, 0xB4,
+    0x5D, 0x46, 0x63, 0xD2, 0xDA, 0x6A, 0x71, 0xE0, 0x8C, 0x33, 0x6F, 0x3B, 0xE4, 0xE1, 0xBD, 0x53,
+    0x68, 0x36, 0xBD, 0x10, 0x0B, 0xF1, 0x5F, 0x97, 0x01, 0x93, 0xF6, 0x0D, 0x27, 0x2F, 0x1B, 0xE4,
+    0x4A, 0x3F, 0x60, 0xE7, 0x59, 0x86, 0xC9, 0x0F, 0xE3, 0xCE, 0x56, 0xB9, 0xE4, 0x5F, 0xB8, 0xDA,
+    0xC7, 0x80, 0xC0, 0x7D, 0x56, 0xED, 0x1F, 0xFA, 0xC7, 0x61, 0x87, 0x39, 0x9F, 0x10, 0x53, 0x88,
+    0x29, 0xC4, 0xC4, 0xBE, 0x03, 0x04, 0x42, 0x4C, 0x21, 0x26, 0xB6, 0x5C, 0x04, 0x1A, 0x6E, 0x60,
+    0x0A, 0x31, 0x31, 0x79, 0x49, 0x16, 0x7A, 0x8E, 0x81, 0x29, 0xC4, 0x84, 0x28, 0xA8, 0x1B, 0x62,
+    0xFE, 0xF0, 0x2F, 0x30, 0x9D, 0x98, 0x11, 0xB9, 0x66, 0xF4, 0xE0, 0xB5, 0x33, 0x57, 0x6F, 0xBB,
+    0x0B, 0x33, 0xDC, 0x3B, 0xB5, 0xAF, 0x06, 0xC4, 0xC9, 0x54, 0x2B, 0xEC, 0x20, 0x65, 0x6B, 0x26,
+    0x59, 0x30, 0xEF, 0xEC, 0x1B, 0x33, 0x9C, 0x9B, 0xCB, 0xA7, 0x83, 0x75, 0xFD, 0xD5, 0x20, 0x17,
+    0x67, 0xD9, 0x00, 0x5B, 0xF1, 0x40, 0x35, 0xFE, 0x07, 0xCC, 0x96, 0x98, 0x2D, 0x31, 0x81, 0x0E,
+    0x4C, 0x01, 0xE6, 0x19, 0x1A, 0x60, 0x1A, 0x62, 0x1A, 0x8F, 0x39, 0x10, 0x13, 0xF6, 0x81, 0x29,
+    0x31, 0x30, 0x11, 0x27, 0x30, 0x85, 0x98, 0x88, 0x93, 0x0F, 0xCD, 0x3F, 0x61, 0x32, 0x55, 0x38,
+    0x2A, 0x29, 0x5D, 0xF0, 0x99, 0xF4, 0xFF, 0x67, 0xE2, 0xFD, 0xF5, 0xBC, 0xFE, 0x0E, 0x64, 0x5F,
+    0x51, 0x8D, 0xB5, 0x57, 0x6A, 0x3C, 0xD6, 0xAF, 0x67, 0x24, 0xCE, 0x9E, 0x48, 0x21, 0xB7, 0xD2,
+    0x0E, 0xC2, 0xCE, 0x5F, 0x4E, 0xA2, 0xCD, 0xE2, 0x4A, 0x8B, 0xBC, 0x4B, 0xE6, 0xB2, 0xB1, 0x7D,
+    0xC8, 0xCC, 0x50, 0xEE, 0x6C, 0x9F, 0x50, 0xD9, 0xCA, 0x13, 0xEE, 0xFA, 0x6E, 0xF9, 0x80, 0x9D,
+    0x69, 0xFC, 0xDA, 0x52, 0x22, 0xDE, 0xF8, 0xF8, 0x90, 0x23, 0x28, 0x33, 0x76, 0xFE, 0xBA, 0xC9,
+    0x16, 0x54, 0x9A, 0x39, 0xE3, 0xBF, 0x54, 0x5E, 0xFF, 0x1F, 0xEB, 0x2B, 0xE6, 0x43, 0xAA, 0xBF,
+    0x30, 0xC3, 0x95, 0x09, 0x8B, 0x4D, 0x78, 0x3A, 0xF0, 0x71, 0x53, 0x3C, 0x26, 0xF8, 0xA0, 0x75,
+    0xE8, 0x9E, 0xF3, 0x0D, 0x89, 0x83, 0xBC, 0x63, 0xFD, 0x4D, 0xFD, 0xC3, 0xE7, 0x9F, 0xBA, 0xB8,
+    0xCB, 0xFD, 0xC7, 0xEC, 0x45, 0xE7, 0xBB, 0xE0, 0x6C, 0xDC, 0x85, 0xEE, 0xDA, 0xF3, 0xBF, 0x00,
+};
+
+static const uint32_t bookerly_14_boldBlockOffsets[35] = {
+    0, 1194, 2291, 3383, 4455, 5615, 6478, 7327,
+    8154, 9013, 9847, 10649, 11464, 12238, 13228, 13965,
+    14860, 16028, 17027, 17997, 19159, 20239, 21309, 22468,
+    23492, 24439, 25512, 26697, 27738, 28779, 29835, 31098,
+    32249, 33126, 34080,
+};
+
+static const uint16_t bookerly_14_boldDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_boldGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_14_boldPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_14_boldGlyphs[] = {
@@ -4296,716 +2345,716 @@ static const EpdGlyph bookerly_14_boldGlyphs[] = {
     { 14, 9, 18, 2, 14, 32, 1897 }, // =
     { 14, 14, 18, 2, 17, 49, 1929 }, // >
     { 12, 23, 14, 1, 22, 69, 1978 }, // ?
-    { 27, 27, 29, 1, 21, 183, 2047 }, // @
-    { 23, 21, 22, 0, 21, 121, 2230 }, // A
-    { 17, 22, 19, 1, 21, 94, 2351 }, // B
-    { 17, 22, 19, 1, 21, 94, 2445 }, // C
-    { 21, 22, 23, 1, 21, 116, 2539 }, // D
-    { 17, 21, 19, 1, 21, 90, 2655 }, // E
-    { 16, 21, 17, 1, 21, 84, 2745 }, // F
-    { 20, 22, 21, 1, 21, 110, 2829 }, // G
-    { 23, 21, 25, 1, 21, 121, 2939 }, // H
-    { 11, 21, 12, 1, 21, 58, 3060 }, // I
-    { 14, 27, 11, -2, 21, 95, 3118 }, // J
-    { 21, 22, 22, 1, 21, 116, 3213 }, // K
-    { 17, 21, 18, 1, 21, 90, 3329 }, // L
-    { 27, 21, 28, 0, 21, 142, 3419 }, // M
-    { 24, 22, 23, 0, 21, 132, 3561 }, // N
-    { 21, 22, 23, 1, 21, 116, 3693 }, // O
-    { 17, 21, 18, 1, 21, 90, 3809 }, // P
-    { 22, 28, 23, 1, 21, 154, 3899 }, // Q
-    { 21, 22, 21, 1, 21, 116, 4053 }, // R
-    { 15, 22, 17, 1, 21, 83, 4169 }, // S
-    { 20, 21, 21, 0, 21, 105, 4252 }, // T
-    { 23, 22, 23, 0, 21, 127, 4357 }, // U
-    { 23, 22, 23, 0, 21, 127, 4484 }, // V
-    { 32, 22, 32, 0, 21, 176, 4611 }, // W
-    { 22, 21, 22, 0, 21, 116, 4787 }, // X
-    { 21, 21, 21, 0, 21, 111, 4903 }, // Y
-    { 17, 22, 18, 0, 21, 94, 5014 }, // Z
-    { 8, 28, 10, 1, 23, 56, 5108 }, // [
-    { 15, 23, 15, 0, 21, 87, 5164 }, // <backslash>
-    { 7, 28, 10, 1, 23, 49, 5251 }, // ]
-    { 16, 14, 18, 1, 19, 56, 5300 }, // ^
-    { 15, 4, 15, 0, -1, 15, 5356 }, // _
-    { 7, 8, 20, 6, 25, 14, 5371 }, // `
-    { 16, 17, 16, 1, 16, 68, 5385 }, // a
-    { 18, 24, 18, -1, 23, 108, 5453 }, // b
-    { 14, 17, 15, 1, 16, 60, 5561 }, // c
-    { 18, 24, 18, 1, 23, 108, 5621 }, // d
-    { 14, 17, 16, 1, 16, 60, 5729 }, // e
-    { 16, 23, 13, 0, 23, 92, 5789 }, // f
-    { 18, 23, 18, 0, 16, 104, 5881 }, // g
-    { 19, 23, 19, 0, 23, 110, 5985 }, // h
-    { 10, 23, 10, 0, 23, 58, 6095 }, // i
-    { 10, 30, 9, -2, 23, 75, 6153 }, // j
-    { 19, 24, 18, 0, 23, 114, 6228 }, // k
-    { 10, 23, 10, 0, 23, 58, 6342 }, // l
-    { 29, 16, 29, 0, 16, 116, 6400 }, // m
-    { 20, 16, 20, 0, 16, 80, 6516 }, // n
-    { 16, 17, 18, 1, 16, 68, 6596 }, // o
-    { 18, 23, 18, 0, 16, 104, 6664 }, // p
-    { 17, 23, 17, 1, 16, 98, 6768 }, // q
-    { 14, 16, 14, 0, 16, 56, 6866 }, // r
-    { 13, 17, 15, 1, 16, 56, 6922 }, // s
-    { 13, 20, 12, -1, 19, 65, 6978 }, // t
-    { 20, 17, 19, 0, 16, 85, 7043 }, // u
-    { 19, 17, 19, 0, 16, 81, 7128 }, // v
-    { 26, 17, 26, 0, 16, 111, 7209 }, // w
-    { 18, 16, 18, 0, 16, 72, 7320 }, // x
-    { 19, 23, 19, 0, 16, 110, 7392 }, // y
-    { 15, 17, 15, 0, 16, 64, 7502 }, // z
-    { 10, 29, 12, 1, 24, 73, 7566 }, // {
-    { 5, 27, 9, 2, 23, 34, 7639 }, // |
-    { 10, 29, 12, 0, 24, 73, 7673 }, // }
-    { 14, 7, 18, 2, 13, 25, 7746 }, // ~
-    { 0, 0, 6, 0, 0, 0, 7771 }, //  
-    { 6, 23, 8, 1, 16, 35, 7771 }, // ¡
-    { 16, 29, 18, 1, 23, 116, 7806 }, // ¢
-    { 18, 22, 18, 0, 21, 99, 7922 }, // £
-    { 16, 14, 18, 1, 17, 56, 8021 }, // ¤
-    { 20, 20, 18, -1, 20, 100, 8077 }, // ¥
-    { 5, 27, 9, 2, 23, 34, 8177 }, // ¦
-    { 13, 23, 15, 1, 20, 75, 8211 }, // §
-    { 12, 5, 20, 4, 23, 15, 8286 }, // ¨
-    { 22, 22, 23, 0, 21, 121, 8301 }, // ©
-    { 11, 15, 13, 1, 21, 42, 8422 }, // ª
-    { 16, 12, 17, 0, 13, 48, 8464 }, // «
-    { 14, 8, 18, 2, 14, 28, 8512 }, // ¬
-    { 9, 5, 11, 1, 10, 12, 8540 }, // ­
-    { 17, 16, 17, 0, 23, 68, 8552 }, // ®
-    { 11, 3, 20, 4, 21, 9, 8620 }, // ¯
-    { 11, 12, 15, 2, 21, 33, 8629 }, // °
-    { 14, 18, 18, 2, 17, 63, 8662 }, // ±
-    { 11, 14, 13, 1, 24, 39, 8725 }, // ²
-    { 11, 14, 13, 1, 24, 39, 8764 }, // ³
-    { 6, 8, 20, 7, 25, 12, 8803 }, // ´
-    { 19, 23, 19, 1, 16, 110, 8815 }, // µ
-    { 17, 26, 17, 0, 21, 111, 8925 }, // ¶
-    { 6, 6, 8, 1, 11, 9, 9036 }, // ·
-    { 6, 7, 20, 7, -1, 11, 9045 }, // ¸
-    { 10, 14, 13, 1, 24, 35, 9056 }, // ¹
-    { 11, 15, 13, 1, 21, 42, 9091 }, // º
-    { 16, 12, 17, 1, 13, 48, 9133 }, // »
-    { 30, 25, 31, 1, 22, 188, 9181 }, // ¼
-    { 30, 25, 31, 1, 22, 188, 9369 }, // ½
-    { 30, 25, 31, 1, 22, 188, 9557 }, // ¾
-    { 12, 23, 14, 1, 16, 69, 9745 }, // ¿
-    { 23, 29, 22, 0, 29, 167, 9814 }, // À
-    { 23, 29, 22, 0, 29, 167, 9981 }, // Á
-    { 23, 28, 22, 0, 28, 161, 10148 }, // Â
-    { 23, 28, 22, 0, 28, 161, 10309 }, // Ã
-    { 23, 27, 22, 0, 27, 156, 10470 }, // Ä
-    { 23, 29, 22, 0, 29, 167, 10626 }, // Å
-    { 29, 21, 28, -1, 21, 153, 10793 }, // Æ
-    { 17, 29, 19, 1, 21, 124, 10946 }, // Ç
-    { 17, 29, 19, 1, 29, 124, 11070 }, // È
-    { 17, 29, 19, 1, 29, 124, 11194 }, // É
-    { 17, 28, 19, 1, 28, 119, 11318 }, // Ê
-    { 17, 27, 19, 1, 27, 115, 11437 }, // Ë
-    { 11, 29, 12, 1, 29, 80, 11552 }, // Ì
-    { 11, 29, 12, 1, 29, 80, 11632 }, // Í
-    { 12, 28, 12, 0, 28, 84, 11712 }, // Î
-    { 12, 27, 12, 0, 27, 81, 11796 }, // Ï
-    { 22, 22, 23, 0, 21, 121, 11877 }, // Ð
-    { 24, 29, 23, 0, 28, 174, 11998 }, // Ñ
-    { 21, 30, 23, 1, 29, 158, 12172 }, // Ò
-    { 21, 30, 23, 1, 29, 158, 12330 }, // Ó
-    { 21, 29, 23, 1, 28, 153, 12488 }, // Ô
-    { 21, 29, 23, 1, 28, 153, 12641 }, // Õ
-    { 21, 28, 23, 1, 27, 147, 12794 }, // Ö
-    { 13, 13, 18, 3, 16, 43, 12941 }, // ×
-    { 23, 22, 23, 0, 21, 127, 12984 }, // Ø
-    { 23, 30, 23, 0, 29, 173, 13111 }, // Ù
-    { 23, 30, 23, 0, 29, 173, 13284 }, // Ú
-    { 23, 29, 23, 0, 28, 167, 13457 }, // Û
-    { 23, 28, 23, 0, 27, 161, 13624 }, // Ü
-    { 21, 29, 21, 0, 29, 153, 13785 }, // Ý
-    { 17, 21, 19, 1, 21, 90, 13938 }, // Þ
-    { 19, 24, 19, 0, 23, 114, 14028 }, // ß
-    { 16, 26, 16, 1, 25, 104, 14142 }, // à
-    { 16, 26, 16, 1, 25, 104, 14246 }, // á
-    { 16, 25, 16, 1, 24, 100, 14350 }, // â
-    { 16, 24, 16, 1, 23, 96, 14450 }, // ã
-    { 16, 24, 16, 1, 23, 96, 14546 }, // ä
-    { 16, 26, 16, 1, 25, 104, 14642 }, // å
-    { 22, 17, 24, 1, 16, 94, 14746 }, // æ
-    { 14, 24, 15, 1, 16, 84, 14840 }, // ç
-    { 14, 26, 16, 1, 25, 91, 14924 }, // è
-    { 14, 26, 16, 1, 25, 91, 15015 }, // é
-    { 14, 25, 16, 1, 24, 88, 15106 }, // ê
-    { 14, 24, 16, 1, 23, 84, 15194 }, // ë
-    { 10, 25, 10, 0, 25, 63, 15278 }, // ì
-    { 10, 25, 10, 0, 25, 63, 15341 }, // í
-    { 11, 24, 10, 0, 24, 66, 15404 }, // î
-    { 11, 23, 10, 0, 23, 64, 15470 }, // ï
-    { 16, 25, 18, 1, 24, 100, 15534 }, // ð
-    { 20, 23, 20, 0, 23, 115, 15634 }, // ñ
-    { 16, 26, 18, 1, 25, 104, 15749 }, // ò
-    { 16, 26, 18, 1, 25, 104, 15853 }, // ó
-    { 16, 25, 18, 1, 24, 100, 15957 }, // ô
-    { 16, 24, 18, 1, 23, 96, 16057 }, // õ
-    { 16, 24, 18, 1, 23, 96, 16153 }, // ö
-    { 14, 14, 18, 2, 17, 49, 16249 }, // ÷
-    { 17, 17, 18, 0, 16, 73, 16298 }, // ø
-    { 20, 26, 19, 0, 25, 130, 16371 }, // ù
-    { 20, 26, 19, 0, 25, 130, 16501 }, // ú
-    { 20, 25, 19, 0, 24, 125, 16631 }, // û
-    { 20, 24, 19, 0, 23, 120, 16756 }, // ü
-    { 19, 32, 19, 0, 25, 152, 16876 }, // ý
-    { 18, 30, 18, 0, 23, 135, 17028 }, // þ
-    { 19, 30, 19, 0, 23, 143, 17163 }, // ÿ
-    { 23, 26, 22, 0, 26, 150, 17306 }, // Ā
-    { 16, 22, 16, 1, 21, 88, 17456 }, // ā
-    { 23, 28, 22, 0, 28, 161, 17544 }, // Ă
-    { 16, 24, 16, 1, 23, 96, 17705 }, // ă
-    { 23, 28, 22, 0, 21, 161, 17801 }, // Ą
-    { 16, 23, 16, 1, 16, 92, 17962 }, // ą
-    { 17, 30, 19, 1, 29, 128, 18054 }, // Ć
-    { 14, 26, 15, 1, 25, 91, 18182 }, // ć
-    { 17, 29, 19, 1, 28, 124, 18273 }, // Ĉ
-    { 14, 25, 15, 1, 24, 88, 18397 }, // ĉ
-    { 17, 29, 19, 1, 28, 124, 18485 }, // Ċ
-    { 14, 24, 15, 1, 23, 84, 18609 }, // ċ
-    { 17, 29, 19, 1, 28, 124, 18693 }, // Č
-    { 14, 25, 15, 1, 24, 88, 18817 }, // č
-    { 21, 29, 23, 1, 28, 153, 18905 }, // Ď
-    { 20, 24, 19, 1, 23, 120, 19058 }, // ď
-    { 22, 22, 23, 0, 21, 121, 19178 }, // Đ
-    { 18, 24, 18, 1, 23, 108, 19299 }, // đ
-    { 17, 26, 19, 1, 26, 111, 19407 }, // Ē
-    { 14, 22, 16, 1, 21, 77, 19518 }, // ē
-    { 17, 28, 19, 1, 28, 119, 19595 }, // Ĕ
-    { 14, 24, 16, 1, 23, 84, 19714 }, // ĕ
-    { 17, 28, 19, 1, 28, 119, 19798 }, // Ė
-    { 14, 24, 16, 1, 23, 84, 19917 }, // ė
-    { 17, 28, 19, 1, 21, 119, 20001 }, // Ę
-    { 14, 23, 16, 1, 16, 81, 20120 }, // ę
-    { 17, 28, 19, 1, 28, 119, 20201 }, // Ě
-    { 14, 25, 16, 1, 24, 88, 20320 }, // ě
-    { 20, 29, 21, 1, 28, 145, 20408 }, // Ĝ
-    { 18, 31, 18, 0, 24, 140, 20553 }, // ĝ
-    { 20, 29, 21, 1, 28, 145, 20693 }, // Ğ
-    { 18, 30, 18, 0, 23, 135, 20838 }, // ğ
-    { 20, 29, 21, 1, 28, 145, 20973 }, // Ġ
-    { 18, 30, 18, 0, 23, 135, 21118 }, // ġ
-    { 20, 29, 21, 1, 21, 145, 21253 }, // Ģ
-    { 18, 32, 18, 0, 25, 144, 21398 }, // ģ
-    { 23, 28, 25, 1, 28, 161, 21542 }, // Ĥ
-    { 20, 30, 19, -1, 30, 150, 21703 }, // ĥ
-    { 25, 21, 25, 0, 21, 132, 21853 }, // Ħ
-    { 19, 23, 19, 0, 23, 110, 21985 }, // ħ
-    { 11, 28, 12, 1, 28, 77, 22095 }, // Ĩ
-    { 11, 23, 10, 0, 23, 64, 22172 }, // ĩ
-    { 11, 26, 12, 1, 26, 72, 22236 }, // Ī
-    { 11, 21, 10, 0, 21, 58, 22308 }, // ī
-    { 11, 28, 12, 1, 28, 77, 22366 }, // Ĭ
-    { 11, 23, 10, 0, 23, 64, 22443 }, // ĭ
-    { 11, 28, 12, 1, 21, 77, 22507 }, // Į
-    { 11, 30, 10, 0, 23, 83, 22584 }, // į
-    { 11, 28, 12, 1, 28, 77, 22667 }, // İ
-    { 10, 16, 10, 0, 16, 40, 22744 }, // ı
-    { 23, 27, 24, 1, 21, 156, 22784 }, // Ĳ
-    { 18, 30, 19, 0, 23, 135, 22940 }, // ĳ
-    { 14, 34, 11, -2, 28, 119, 23075 }, // Ĵ
-    { 12, 31, 9, -2, 24, 93, 23194 }, // ĵ
-    { 21, 29, 22, 1, 21, 153, 23287 }, // Ķ
-    { 19, 31, 18, 0, 23, 148, 23440 }, // ķ
-    { 19, 17, 19, 0, 16, 81, 23588 }, // ĸ
-    { 17, 29, 18, 1, 29, 124, 23669 }, // Ĺ
-    { 10, 30, 10, 0, 30, 75, 23793 }, // ĺ
-    { 17, 29, 18, 1, 21, 124, 23868 }, // Ļ
-    { 10, 31, 10, 0, 23, 78, 23992 }, // ļ
-    { 17, 23, 18, 1, 23, 98, 24070 }, // Ľ
-    { 13, 23, 11, 0, 23, 75, 24168 }, // ľ
-    { 17, 21, 18, 1, 21, 90, 24243 }, // Ŀ
-    { 16, 23, 16, 0, 23, 92, 24333 }, // ŀ
-    { 19, 21, 18, -1, 21, 100, 24425 }, // Ł
-    { 12, 23, 10, -1, 23, 69, 24525 }, // ł
-    { 24, 30, 23, 0, 29, 180, 24594 }, // Ń
-    { 20, 25, 20, 0, 25, 125, 24774 }, // ń
-    { 24, 29, 23, 0, 21, 174, 24899 }, // Ņ
-    { 20, 24, 20, 0, 16, 120, 25073 }, // ņ
-    { 24, 29, 23, 0, 28, 174, 25193 }, // Ň
-    { 20, 24, 20, 0, 24, 120, 25367 }, // ň
-    { 26, 21, 26, 0, 21, 137, 25487 }, // ŉ
-    { 24, 27, 23, 0, 21, 162, 25624 }, // Ŋ
-    { 18, 23, 19, 0, 16, 104, 25786 }, // ŋ
-    { 21, 27, 23, 1, 26, 142, 25890 }, // Ō
-    { 16, 22, 18, 1, 21, 88, 26032 }, // ō
-    { 21, 29, 23, 1, 28, 153, 26120 }, // Ŏ
-    { 16, 24, 18, 1, 23, 96, 26273 }, // ŏ
-    { 21, 30, 23, 1, 29, 158, 26369 }, // Ő
-    { 16, 26, 18, 1, 25, 104, 26527 }, // ő
-    { 28, 22, 29, 1, 21, 154, 26631 }, // Œ
-    { 25, 17, 26, 1, 16, 107, 26785 }, // œ
-    { 21, 30, 21, 1, 29, 158, 26892 }, // Ŕ
-    { 14, 25, 14, 0, 25, 88, 27050 }, // ŕ
-    { 21, 29, 21, 1, 21, 153, 27138 }, // Ŗ
-    { 14, 24, 14, 0, 16, 84, 27291 }, // ŗ
-    { 21, 29, 21, 1, 28, 153, 27375 }, // Ř
-    { 14, 24, 14, 0, 24, 84, 27528 }, // ř
-    { 15, 30, 17, 1, 29, 113, 27612 }, // Ś
-    { 13, 26, 15, 1, 25, 85, 27725 }, // ś
-    { 15, 29, 17, 1, 28, 109, 27810 }, // Ŝ
-    { 13, 25, 15, 1, 24, 82, 27919 }, // ŝ
-    { 15, 29, 17, 1, 21, 109, 28001 }, // Ş
-    { 13, 24, 15, 1, 16, 78, 28110 }, // ş
-    { 15, 29, 17, 1, 28, 109, 28188 }, // Š
-    { 13, 25, 15, 1, 24, 82, 28297 }, // š
-    { 20, 29, 21, 0, 21, 145, 28379 }, // Ţ
-    { 13, 27, 12, -1, 19, 88, 28524 }, // ţ
-    { 20, 28, 21, 0, 28, 140, 28612 }, // Ť
-    { 13, 25, 12, -1, 24, 82, 28752 }, // ť
-    { 20, 21, 21, 0, 21, 105, 28834 }, // Ŧ
-    { 13, 20, 12, -1, 19, 65, 28939 }, // ŧ
-    { 23, 29, 23, 0, 28, 167, 29004 }, // Ũ
-    { 20, 24, 19, 0, 23, 120, 29171 }, // ũ
-    { 23, 27, 23, 0, 26, 156, 29291 }, // Ū
-    { 20, 22, 19, 0, 21, 110, 29447 }, // ū
-    { 23, 29, 23, 0, 28, 167, 29557 }, // Ŭ
-    { 20, 24, 19, 0, 23, 120, 29724 }, // ŭ
-    { 23, 30, 23, 0, 29, 173, 29844 }, // Ů
-    { 20, 26, 19, 0, 25, 130, 30017 }, // ů
-    { 23, 30, 23, 0, 29, 173, 30147 }, // Ű
-    { 20, 26, 19, 0, 25, 130, 30320 }, // ű
-    { 23, 28, 23, 0, 21, 161, 30450 }, // Ų
-    { 20, 23, 19, 0, 16, 115, 30611 }, // ų
-    { 32, 29, 32, 0, 28, 232, 30726 }, // Ŵ
-    { 26, 25, 26, 0, 24, 163, 30958 }, // ŵ
-    { 21, 28, 21, 0, 28, 147, 31121 }, // Ŷ
-    { 19, 31, 19, 0, 24, 148, 31268 }, // ŷ
-    { 21, 27, 21, 0, 27, 142, 31416 }, // Ÿ
-    { 17, 30, 18, 0, 29, 128, 31558 }, // Ź
-    { 15, 26, 15, 0, 25, 98, 31686 }, // ź
-    { 17, 29, 18, 0, 28, 124, 31784 }, // Ż
-    { 15, 24, 15, 0, 23, 90, 31908 }, // ż
-    { 17, 29, 18, 0, 28, 124, 31998 }, // Ž
-    { 15, 25, 15, 0, 24, 94, 32122 }, // ž
-    { 15, 23, 12, 0, 23, 87, 32216 }, // ſ
-    { 7, 8, 0, -5, 25, 14, 32303 }, // ̀
-    { 6, 8, 0, -2, 25, 12, 32317 }, // ́
-    { 10, 7, 0, -5, 24, 18, 32329 }, // ̂
-    { 10, 5, 0, -5, 23, 13, 32347 }, // ̃
-    { 10, 3, 0, -5, 21, 8, 32360 }, // ̄
-    { 10, 6, 0, -5, 23, 15, 32368 }, // ̆
-    { 6, 5, 0, -3, 23, 8, 32383 }, // ̇
-    { 12, 5, 0, -6, 23, 15, 32391 }, // ̈
-    { 8, 9, 0, -4, 26, 18, 32406 }, // ̉
-    { 8, 9, 0, -4, 25, 18, 32424 }, // ̊
-    { 11, 8, 0, -4, 25, 22, 32442 }, // ̋
-    { 10, 7, 0, -5, 24, 18, 32464 }, // ̌
-    { 11, 8, 0, -7, 25, 22, 32482 }, // ̏
-    { 10, 6, 0, -5, 23, 15, 32504 }, // ̑
-    { 6, 8, 0, -3, 25, 12, 32519 }, // ̒
-    { 6, 9, 0, -2, 26, 14, 32531 }, // ̓
-    { 6, 9, 0, -4, 26, 14, 32545 }, // ̔
-    { 4, 8, 0, -2, 25, 8, 32559 }, // ̕
-    { 6, 8, 0, -3, 19, 12, 32567 }, // ̛
-    { 6, 5, 0, -3, -2, 8, 32579 }, // ̣
-    { 12, 5, 0, -6, -2, 15, 32587 }, // ̤
-    { 8, 7, 0, -4, -1, 14, 32602 }, // ̥
-    { 6, 7, 0, -3, -1, 11, 32616 }, // ̦
-    { 6, 7, 0, -3, -1, 11, 32627 }, // ̧
-    { 8, 8, 0, -4, 1, 16, 32638 }, // ̨
-    { 4, 8, 8, 2, -1, 8, 32654 }, // ̩
-    { 12, 7, 0, -6, -1, 21, 32662 }, // ̭
-    { 10, 6, 0, -5, -2, 15, 32683 }, // ̮
-    { 10, 6, 0, -5, -2, 15, 32698 }, // ̰
-    { 10, 3, 0, -5, -3, 8, 32713 }, // ̱
-    { 10, 6, 0, -5, 23, 15, 32721 }, // ͂
-    { 12, 12, 0, -6, 30, 36, 32736 }, // ̈́
-    { 6, 6, 0, -2, -2, 9, 32772 }, // ͅ
-    { 17, 29, 19, 1, 29, 124, 32781 }, // Ѐ
-    { 17, 27, 19, 1, 27, 115, 32905 }, // Ё
-    { 24, 27, 25, 0, 21, 162, 33020 }, // Ђ
-    { 17, 29, 18, 1, 29, 124, 33182 }, // Ѓ
-    { 18, 22, 20, 1, 21, 99, 33306 }, // Є
-    { 15, 22, 17, 1, 21, 83, 33405 }, // Ѕ
-    { 11, 21, 12, 1, 21, 58, 33488 }, // І
-    { 12, 27, 12, 0, 27, 81, 33546 }, // Ї
-    { 14, 27, 11, -2, 21, 95, 33627 }, // Ј
-    { 28, 22, 29, 0, 21, 154, 33722 }, // Љ
-    { 29, 22, 31, 1, 21, 160, 33876 }, // Њ
-    { 27, 21, 27, 0, 21, 142, 34036 }, // Ћ
-    { 21, 30, 22, 1, 29, 158, 34178 }, // Ќ
-    { 23, 29, 25, 1, 29, 167, 34336 }, // Ѝ
-    { 21, 29, 21, 0, 28, 153, 34503 }, // Ў
-    { 22, 28, 24, 1, 21, 154, 34656 }, // Џ
-    { 23, 21, 22, 0, 21, 121, 34810 }, // А
-    { 17, 22, 19, 1, 21, 94, 34931 }, // Б
-    { 17, 22, 19, 1, 21, 94, 35025 }, // В
-    { 17, 21, 18, 1, 21, 90, 35119 }, // Г
-    { 23, 27, 23, 0, 21, 156, 35209 }, // Д
-    { 17, 21, 19, 1, 21, 90, 35365 }, // Е
-    { 32, 22, 32, 0, 21, 176, 35455 }, // Ж
-    { 17, 22, 18, 1, 21, 94, 35631 }, // З
-    { 23, 21, 25, 1, 21, 121, 35725 }, // И
-    { 23, 28, 25, 1, 28, 161, 35846 }, // Й
-    { 21, 22, 22, 1, 21, 116, 36007 }, // К
-    { 22, 22, 22, 0, 21, 121, 36123 }, // Л
-    { 27, 21, 28, 0, 21, 142, 36244 }, // М
-    { 23, 21, 25, 1, 21, 121, 36386 }, // Н
-    { 21, 22, 23, 1, 21, 116, 36507 }, // О
-    { 23, 21, 24, 1, 21, 121, 36623 }, // П
-    { 17, 21, 18, 1, 21, 90, 36744 }, // Р
-    { 17, 22, 19, 1, 21, 94, 36834 }, // С
-    { 20, 21, 21, 0, 21, 105, 36928 }, // Т
-    { 21, 22, 21, 0, 21, 116, 37033 }, // У
-    { 22, 22, 23, 1, 21, 121, 37149 }, // Ф
-    { 22, 21, 22, 0, 21, 116, 37270 }, // Х
-    { 23, 27, 24, 1, 21, 156, 37386 }, // Ц
-    { 22, 21, 22, 0, 21, 116, 37542 }, // Ч
-    { 31, 21, 32, 1, 21, 163, 37658 }, // Ш
-    { 32, 27, 33, 1, 21, 216, 37821 }, // Щ
-    { 22, 22, 23, 0, 21, 121, 38037 }, // Ъ
-    { 28, 22, 30, 1, 21, 154, 38158 }, // Ы
-    { 17, 22, 19, 1, 21, 94, 38312 }, // Ь
-    { 18, 22, 20, 1, 21, 99, 38406 }, // Э
-    { 30, 22, 32, 1, 21, 165, 38505 }, // Ю
-    { 20, 22, 21, 0, 21, 110, 38670 }, // Я
-    { 16, 17, 16, 1, 16, 68, 38780 }, // а
-    { 16, 24, 17, 1, 23, 96, 38848 }, // б
-    { 15, 17, 17, 1, 16, 64, 38944 }, // в
-    { 14, 16, 15, 1, 16, 56, 39008 }, // г
-    { 20, 22, 20, 0, 16, 110, 39064 }, // д
-    { 14, 17, 16, 1, 16, 60, 39174 }, // е
-    { 26, 17, 26, 0, 16, 111, 39234 }, // ж
-    { 14, 17, 15, 0, 16, 60, 39345 }, // з
-    { 19, 16, 20, 1, 16, 76, 39405 }, // и
-    { 19, 23, 20, 1, 23, 110, 39481 }, // й
-    { 18, 17, 19, 1, 16, 77, 39591 }, // к
-    { 18, 17, 19, 0, 16, 77, 39668 }, // л
-    { 21, 16, 23, 1, 16, 84, 39745 }, // м
-    { 19, 16, 20, 1, 16, 76, 39829 }, // н
-    { 16, 17, 18, 1, 16, 68, 39905 }, // о
-    { 19, 16, 20, 1, 16, 76, 39973 }, // п
-    { 18, 23, 18, 0, 16, 104, 40049 }, // р
-    { 14, 17, 15, 1, 16, 60, 40153 }, // с
-    { 17, 16, 18, 0, 16, 68, 40213 }, // т
-    { 19, 23, 19, 0, 16, 110, 40281 }, // у
-    { 21, 30, 23, 1, 23, 158, 40391 }, // ф
-    { 18, 16, 18, 0, 16, 72, 40549 }, // х
-    { 19, 22, 20, 1, 16, 105, 40621 }, // ц
-    { 18, 16, 19, 0, 16, 72, 40726 }, // ч
-    { 25, 16, 27, 1, 16, 100, 40798 }, // ш
-    { 26, 22, 27, 1, 16, 143, 40898 }, // щ
-    { 19, 17, 19, 0, 16, 81, 41041 }, // ъ
-    { 24, 17, 25, 1, 16, 102, 41122 }, // ы
-    { 15, 17, 16, 1, 16, 64, 41224 }, // ь
-    { 15, 17, 16, 0, 16, 64, 41288 }, // э
-    { 24, 17, 26, 1, 16, 102, 41352 }, // ю
-    { 17, 17, 18, 0, 16, 73, 41454 }, // я
-    { 14, 26, 16, 1, 25, 91, 41527 }, // ѐ
-    { 14, 24, 16, 1, 23, 84, 41618 }, // ё
-    { 18, 30, 19, 0, 23, 135, 41702 }, // ђ
-    { 14, 25, 15, 1, 25, 88, 41837 }, // ѓ
-    { 14, 17, 16, 1, 16, 60, 41925 }, // є
-    { 13, 17, 15, 1, 16, 56, 41985 }, // ѕ
-    { 10, 23, 10, 0, 23, 58, 42041 }, // і
-    { 11, 23, 10, 0, 23, 64, 42099 }, // ї
-    { 10, 30, 9, -2, 23, 75, 42163 }, // ј
-    { 23, 17, 23, 0, 16, 98, 42238 }, // љ
-    { 24, 17, 25, 1, 16, 102, 42336 }, // њ
-    { 19, 23, 19, 0, 23, 110, 42438 }, // ћ
-    { 18, 26, 19, 1, 25, 117, 42548 }, // ќ
-    { 19, 25, 20, 1, 25, 119, 42665 }, // ѝ
-    { 19, 30, 19, 0, 23, 143, 42784 }, // ў
-    { 18, 22, 20, 1, 16, 99, 42927 }, // џ
-    { 20, 24, 22, 1, 23, 120, 43026 }, // Ѣ
-    { 19, 22, 19, 0, 21, 105, 43146 }, // ѣ
-    { 21, 22, 23, 1, 21, 116, 43251 }, // Ѳ
-    { 16, 17, 18, 1, 16, 68, 43367 }, // ѳ
-    { 23, 22, 23, 0, 21, 127, 43435 }, // Ѵ
-    { 20, 17, 19, 0, 16, 85, 43562 }, // ѵ
-    { 24, 34, 25, 1, 28, 204, 43647 }, // Ҋ
-    { 20, 29, 20, 0, 23, 145, 43851 }, // ҋ
-    { 18, 22, 19, 0, 21, 99, 43996 }, // Ҍ
-    { 15, 22, 16, 0, 21, 83, 44095 }, // ҍ
-    { 17, 21, 18, 1, 21, 90, 44178 }, // Ҏ
-    { 18, 23, 18, 0, 16, 104, 44268 }, // ҏ
-    { 15, 24, 17, 1, 24, 90, 44372 }, // Ґ
-    { 13, 19, 15, 1, 19, 62, 44462 }, // ґ
-    { 18, 21, 18, 0, 21, 95, 44524 }, // Ғ
-    { 15, 16, 16, 0, 16, 60, 44619 }, // ғ
-    { 19, 27, 21, 1, 21, 129, 44679 }, // Ҕ
-    { 16, 23, 18, 1, 16, 92, 44808 }, // ҕ
-    { 32, 27, 32, 0, 21, 216, 44900 }, // Җ
-    { 26, 22, 26, 0, 16, 143, 45116 }, // җ
-    { 17, 28, 18, 1, 21, 119, 45259 }, // Ҙ
-    { 14, 22, 15, 0, 16, 77, 45378 }, // ҙ
-    { 21, 27, 22, 1, 21, 142, 45455 }, // Қ
-    { 18, 22, 19, 1, 16, 99, 45597 }, // қ
-    { 23, 22, 23, 1, 21, 127, 45696 }, // Ҝ
-    { 18, 17, 19, 1, 16, 77, 45823 }, // ҝ
-    { 22, 22, 22, 0, 21, 121, 45900 }, // Ҟ
-    { 19, 22, 18, 0, 21, 105, 46021 }, // ҟ
-    { 26, 22, 25, 0, 21, 143, 46126 }, // Ҡ
-    { 22, 17, 22, 0, 16, 94, 46269 }, // ҡ
-    { 24, 27, 25, 1, 21, 162, 46363 }, // Ң
-    { 20, 22, 21, 1, 16, 110, 46525 }, // ң
-    { 27, 21, 29, 1, 21, 142, 46635 }, // Ҥ
-    { 22, 16, 24, 1, 16, 88, 46777 }, // ҥ
-    { 31, 27, 32, 1, 21, 210, 46865 }, // Ҧ
-    { 26, 23, 27, 1, 16, 150, 47075 }, // ҧ
-    { 24, 22, 25, 1, 21, 132, 47225 }, // Ҩ
-    { 19, 17, 20, 1, 16, 81, 47357 }, // ҩ
-    { 17, 28, 19, 1, 21, 119, 47438 }, // Ҫ
-    { 14, 22, 15, 1, 16, 77, 47557 }, // ҫ
-    { 20, 27, 21, 0, 21, 135, 47634 }, // Ҭ
-    { 17, 22, 18, 0, 16, 94, 47769 }, // ҭ
-    { 21, 21, 21, 0, 21, 111, 47863 }, // Ү
-    { 19, 23, 19, 0, 16, 110, 47974 }, // ү
-    { 21, 21, 21, 0, 21, 111, 48084 }, // Ұ
-    { 19, 23, 19, 0, 16, 110, 48195 }, // ұ
-    { 23, 27, 23, 0, 21, 156, 48305 }, // Ҳ
-    { 18, 22, 18, 0, 16, 99, 48461 }, // ҳ
-    { 27, 27, 27, 0, 21, 183, 48560 }, // Ҵ
-    { 23, 22, 23, 0, 16, 127, 48743 }, // ҵ
-    { 23, 27, 23, 0, 21, 156, 48870 }, // Ҷ
-    { 19, 22, 19, 0, 16, 105, 49026 }, // ҷ
-    { 22, 21, 22, 0, 21, 116, 49131 }, // Ҹ
-    { 18, 16, 19, 0, 16, 72, 49247 }, // ҹ
-    { 22, 21, 23, 1, 21, 116, 49319 }, // Һ
-    { 19, 23, 19, 0, 23, 110, 49435 }, // һ
-    { 24, 22, 25, 0, 21, 132, 49545 }, // Ҽ
-    { 19, 17, 19, 0, 16, 81, 49677 }, // ҽ
-    { 24, 27, 25, 0, 21, 162, 49758 }, // Ҿ
-    { 19, 22, 19, 0, 16, 105, 49920 }, // ҿ
-    { 11, 21, 12, 1, 21, 58, 50025 }, // Ӏ
-    { 32, 29, 32, 0, 28, 232, 50083 }, // Ӂ
-    { 26, 24, 26, 0, 23, 156, 50315 }, // ӂ
-    { 20, 27, 21, 1, 21, 135, 50471 }, // Ӄ
-    { 17, 23, 18, 1, 16, 98, 50606 }, // ӄ
-    { 22, 27, 22, 0, 21, 149, 50704 }, // Ӆ
-    { 19, 22, 19, 0, 16, 105, 50853 }, // ӆ
-    { 23, 27, 24, 1, 21, 156, 50958 }, // Ӈ
-    { 19, 23, 20, 1, 16, 110, 51114 }, // ӈ
-    { 24, 27, 25, 1, 21, 162, 51224 }, // Ӊ
-    { 19, 22, 20, 1, 16, 105, 51386 }, // ӊ
-    { 22, 27, 22, 0, 21, 149, 51491 }, // Ӌ
-    { 18, 22, 19, 0, 16, 99, 51640 }, // ӌ
-    { 28, 27, 28, 0, 21, 189, 51739 }, // Ӎ
-    { 22, 22, 23, 1, 16, 121, 51928 }, // ӎ
-    { 10, 23, 12, 1, 23, 58, 52049 }, // ӏ
-    { 23, 28, 22, 0, 28, 161, 52107 }, // Ӑ
-    { 16, 24, 16, 1, 23, 96, 52268 }, // ӑ
-    { 23, 27, 22, 0, 27, 156, 52364 }, // Ӓ
-    { 16, 24, 16, 1, 23, 96, 52520 }, // ӓ
-    { 29, 21, 28, -1, 21, 153, 52616 }, // Ӕ
-    { 22, 17, 24, 1, 16, 94, 52769 }, // ӕ
-    { 17, 28, 19, 1, 28, 119, 52863 }, // Ӗ
-    { 14, 24, 16, 1, 23, 84, 52982 }, // ӗ
-    { 19, 22, 20, 1, 21, 105, 53066 }, // Ә
-    { 14, 17, 16, 1, 16, 60, 53171 }, // ә
-    { 19, 28, 20, 1, 27, 133, 53231 }, // Ӛ
-    { 14, 24, 16, 1, 23, 84, 53364 }, // ӛ
-    { 32, 28, 32, 0, 27, 224, 53448 }, // Ӝ
-    { 26, 24, 26, 0, 23, 156, 53672 }, // ӝ
-    { 17, 28, 18, 1, 27, 119, 53828 }, // Ӟ
-    { 14, 24, 15, 0, 23, 84, 53947 }, // ӟ
-    { 16, 22, 17, 0, 21, 88, 54031 }, // Ӡ
-    { 15, 23, 16, 0, 16, 87, 54119 }, // ӡ
-    { 23, 26, 25, 1, 26, 150, 54206 }, // Ӣ
-    { 19, 21, 20, 1, 21, 100, 54356 }, // ӣ
-    { 23, 27, 25, 1, 27, 156, 54456 }, // Ӥ
-    { 19, 23, 20, 1, 23, 110, 54612 }, // ӥ
-    { 21, 28, 23, 1, 27, 147, 54722 }, // Ӧ
-    { 16, 24, 18, 1, 23, 96, 54869 }, // ӧ
-    { 21, 22, 23, 1, 21, 116, 54965 }, // Ө
-    { 16, 17, 18, 1, 16, 68, 55081 }, // ө
-    { 21, 28, 23, 1, 27, 147, 55149 }, // Ӫ
-    { 16, 24, 18, 1, 23, 96, 55296 }, // ӫ
-    { 18, 28, 20, 1, 27, 126, 55392 }, // Ӭ
-    { 15, 24, 16, 0, 23, 90, 55518 }, // ӭ
-    { 21, 27, 21, 0, 26, 142, 55608 }, // Ӯ
-    { 19, 28, 19, 0, 21, 133, 55750 }, // ӯ
-    { 21, 28, 21, 0, 27, 147, 55883 }, // Ӱ
-    { 19, 30, 19, 0, 23, 143, 56030 }, // ӱ
-    { 21, 30, 21, 0, 29, 158, 56173 }, // Ӳ
-    { 19, 32, 19, 0, 25, 152, 56331 }, // ӳ
-    { 22, 27, 22, 0, 27, 149, 56483 }, // Ӵ
-    { 18, 23, 19, 0, 23, 104, 56632 }, // ӵ
-    { 17, 27, 18, 1, 21, 115, 56736 }, // Ӷ
-    { 14, 22, 15, 1, 16, 77, 56851 }, // ӷ
-    { 28, 28, 30, 1, 27, 196, 56928 }, // Ӹ
-    { 24, 24, 25, 1, 23, 144, 57124 }, // ӹ
-    { 18, 27, 18, 0, 21, 122, 57268 }, // Ӻ
-    { 15, 22, 15, 0, 16, 83, 57390 }, // ӻ
-    { 22, 27, 22, 0, 21, 149, 57473 }, // Ӽ
-    { 18, 23, 18, 0, 16, 104, 57622 }, // ӽ
-    { 22, 21, 22, 0, 21, 116, 57726 }, // Ӿ
-    { 18, 16, 18, 0, 16, 72, 57842 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 57914 }, //  
-    { 0, 0, 29, 0, 0, 0, 57914 }, //  
-    { 0, 0, 15, 0, 0, 0, 57914 }, //  
-    { 0, 0, 29, 0, 0, 0, 57914 }, //  
-    { 0, 0, 10, 0, 0, 0, 57914 }, //  
-    { 0, 0, 7, 0, 0, 0, 57914 }, //  
-    { 0, 0, 5, 0, 0, 0, 57914 }, //  
-    { 0, 0, 18, 0, 0, 0, 57914 }, //  
-    { 0, 0, 8, 0, 0, 0, 57914 }, //  
-    { 0, 0, 6, 0, 0, 0, 57914 }, //  
-    { 0, 0, 1, 0, 0, 0, 57914 }, //  
-    { 0, 0, 0, 0, 0, 0, 57914 }, // ​
-    { 2, 24, 0, -1, 17, 12, 57914 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 57926 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 57965 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 58035 }, // ‏
-    { 9, 5, 11, 1, 10, 12, 58105 }, // ‐
-    { 9, 5, 11, 1, 10, 12, 58117 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 58129 }, // ‒
-    { 15, 3, 15, 0, 9, 12, 58140 }, // –
-    { 29, 3, 29, 0, 9, 22, 58152 }, // —
-    { 29, 3, 29, 0, 9, 22, 58174 }, // ―
-    { 11, 30, 15, 2, 23, 83, 58196 }, // ‖
-    { 15, 8, 15, 0, -1, 30, 58279 }, // ‗
-    { 6, 10, 7, 1, 22, 15, 58309 }, // ‘
-    { 7, 10, 7, 0, 22, 18, 58324 }, // ’
-    { 7, 10, 7, 0, 4, 18, 58342 }, // ‚
-    { 6, 10, 7, 1, 22, 15, 58360 }, // ‛
-    { 12, 10, 13, 1, 22, 30, 58375 }, // “
-    { 12, 10, 13, 0, 22, 30, 58405 }, // ”
-    { 12, 10, 13, 0, 4, 30, 58435 }, // „
-    { 12, 10, 13, 1, 22, 30, 58465 }, // ‟
-    { 14, 19, 14, 0, 21, 67, 58495 }, // †
-    { 14, 23, 14, 0, 21, 81, 58562 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 58643 }, // •
-    { 10, 10, 18, 4, 15, 25, 58656 }, // ‣
-    { 6, 6, 8, 1, 5, 9, 58681 }, // ․
-    { 13, 6, 15, 1, 5, 20, 58690 }, // ‥
-    { 25, 6, 29, 2, 5, 38, 58710 }, // …
-    { 6, 6, 8, 1, 11, 9, 58748 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 58757 }, //  
-    { 0, 0, 0, 0, 0, 0, 58757 }, //  
-    { 10, 28, 0, -5, 21, 70, 58757 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 58827 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 58897 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 58965 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 59049 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 59133 }, //  
-    { 39, 24, 40, 1, 22, 234, 59133 }, // ‰
-    { 8, 11, 8, 0, 21, 22, 59367 }, // ′
-    { 14, 11, 14, 0, 21, 39, 59389 }, // ″
-    { 20, 11, 21, 0, 21, 55, 59428 }, // ‴
-    { 8, 11, 8, 0, 21, 22, 59483 }, // ‵
-    { 13, 11, 15, 1, 21, 36, 59505 }, // ‶
-    { 19, 11, 21, 1, 21, 53, 59541 }, // ‷
-    { 13, 6, 14, 1, 0, 20, 59594 }, // ‸
-    { 9, 12, 10, 0, 13, 27, 59614 }, // ‹
-    { 8, 12, 10, 1, 13, 24, 59641 }, // ›
-    { 18, 20, 18, 0, 19, 90, 59665 }, // ※
-    { 14, 23, 17, 2, 22, 81, 59755 }, // ‼
-    { 15, 4, 15, 0, 25, 15, 59836 }, // ‾
-    { 7, 5, 9, 1, 10, 9, 59851 }, // ⁃
-    { 15, 25, 5, -5, 22, 94, 59860 }, // ⁄
-    { 25, 23, 27, 1, 22, 144, 59954 }, // ⁇
-    { 21, 23, 22, 1, 22, 121, 60098 }, // ⁈
-    { 19, 23, 22, 2, 22, 110, 60219 }, // ⁉
-    { 17, 7, 29, 6, 12, 30, 60329 }, // ⁓
-    { 27, 11, 27, 0, 21, 75, 60359 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 60434 }, //  
-    { 0, 0, 0, 0, 0, 0, 60434 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 60434 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 60434 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 60434 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 60434 }, // ⁤
-    { 13, 14, 13, 0, 24, 46, 60434 }, // ⁰
-    { 13, 14, 13, 0, 24, 46, 60480 }, // ⁴
-    { 11, 14, 13, 1, 24, 39, 60526 }, // ⁵
-    { 11, 14, 13, 1, 24, 39, 60565 }, // ⁶
-    { 11, 14, 13, 1, 24, 39, 60604 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 60643 }, // ⁸
-    { 11, 14, 13, 1, 24, 39, 60682 }, // ⁹
-    { 13, 11, 16, 2, 21, 36, 60721 }, // ⁿ
-    { 13, 15, 13, 0, 10, 49, 60757 }, // ₀
-    { 10, 14, 13, 1, 10, 35, 60806 }, // ₁
-    { 11, 14, 13, 1, 10, 39, 60841 }, // ₂
-    { 11, 15, 13, 1, 10, 42, 60880 }, // ₃
-    { 13, 15, 13, 0, 10, 49, 60922 }, // ₄
-    { 11, 14, 13, 1, 9, 39, 60971 }, // ₅
-    { 11, 15, 13, 1, 10, 42, 61010 }, // ₆
-    { 11, 14, 13, 1, 9, 39, 61052 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 61091 }, // ₈
-    { 11, 15, 13, 1, 10, 42, 61133 }, // ₉
-    { 16, 20, 18, 1, 20, 80, 61175 }, // ₣
-    { 18, 22, 18, 0, 21, 99, 61255 }, // ₤
-    { 39, 22, 39, 0, 21, 215, 61354 }, // ₧
-    { 18, 22, 18, 0, 21, 99, 61569 }, // €
-    { 19, 14, 29, 5, 17, 67, 61668 }, // ←
-    { 13, 20, 29, 8, 20, 65, 61735 }, // ↑
-    { 19, 14, 29, 5, 17, 67, 61800 }, // →
-    { 13, 20, 29, 8, 20, 65, 61867 }, // ↓
-    { 19, 14, 29, 5, 17, 67, 61932 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 61999 }, // ↕
-    { 15, 20, 29, 7, 20, 75, 62064 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 62139 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 62204 }, // ↳
-    { 17, 16, 29, 6, 18, 68, 62269 }, // ↵
-    { 19, 16, 29, 5, 18, 76, 62337 }, // ⇐
-    { 17, 18, 29, 6, 19, 77, 62413 }, // ⇑
-    { 19, 16, 29, 5, 18, 76, 62490 }, // ⇒
-    { 17, 18, 29, 6, 19, 77, 62566 }, // ⇓
-    { 19, 16, 29, 5, 18, 76, 62643 }, // ⇔
-    { 21, 22, 29, 4, 21, 116, 62719 }, // ∀
-    { 16, 24, 18, 1, 23, 96, 62835 }, // ∂
-    { 15, 21, 29, 7, 21, 79, 62931 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 63010 }, // ∅
-    { 20, 21, 20, 0, 21, 105, 63148 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 63253 }, // ∇
-    { 21, 21, 29, 4, 21, 111, 63358 }, // ∈
-    { 21, 26, 29, 4, 23, 137, 63469 }, // ∉
-    { 21, 18, 29, 4, 19, 95, 63606 }, // ∊
-    { 21, 21, 29, 4, 21, 111, 63701 }, // ∋
-    { 21, 26, 29, 4, 23, 137, 63812 }, // ∌
-    { 21, 18, 29, 4, 19, 95, 63949 }, // ∍
-    { 23, 26, 24, 1, 21, 150, 64044 }, // ∏
-    { 19, 26, 19, 0, 21, 124, 64194 }, // ∑
-    { 14, 4, 18, 2, 12, 14, 64318 }, // −
-    { 15, 23, 15, 0, 21, 87, 64332 }, // ∕
-    { 15, 23, 15, 0, 21, 87, 64419 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 64506 }, // ∗
-    { 12, 11, 18, 3, 15, 33, 64555 }, // ∘
-    { 6, 6, 18, 6, 11, 9, 64588 }, // ∙
-    { 19, 28, 18, -1, 24, 133, 64597 }, // √
-    { 14, 12, 18, 2, 15, 42, 64730 }, // ∝
-    { 18, 11, 18, 0, 15, 50, 64772 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 64822 }, // ∟
-    { 23, 21, 29, 3, 21, 121, 64922 }, // ∠
-    { 5, 30, 15, 5, 23, 38, 65043 }, // ∣
-    { 11, 30, 15, 2, 23, 83, 65081 }, // ∥
-    { 21, 21, 29, 4, 21, 111, 65164 }, // ∧
-    { 21, 21, 29, 4, 21, 111, 65275 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 65386 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 65476 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 65570 }, // ∫
-    { 19, 18, 29, 5, 17, 86, 65690 }, // ∴
-    { 19, 18, 29, 5, 17, 86, 65776 }, // ∵
-    { 7, 16, 9, 1, 18, 28, 65862 }, // ∶
-    { 19, 18, 29, 5, 17, 86, 65890 }, // ∷
-    { 17, 7, 29, 6, 12, 30, 65976 }, // ∼
-    { 17, 17, 29, 6, 18, 73, 66006 }, // ≅
-    { 14, 12, 18, 2, 16, 42, 66079 }, // ≈
-    { 17, 12, 29, 6, 14, 51, 66121 }, // ≍
-    { 14, 15, 18, 2, 17, 53, 66172 }, // ≠
-    { 17, 15, 29, 6, 16, 64, 66225 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 66289 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 66352 }, // ≥
-    { 25, 14, 29, 2, 17, 88, 66415 }, // ≪
-    { 25, 14, 29, 2, 17, 88, 66503 }, // ≫
-    { 21, 18, 29, 4, 19, 95, 66591 }, // ⊃
-    { 21, 26, 29, 4, 23, 137, 66686 }, // ⊄
-    { 21, 26, 29, 4, 23, 137, 66823 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 66960 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 67060 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 67160 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 67276 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 67392 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 67508 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 67624 }, // ⊥
-    { 6, 6, 18, 6, 11, 9, 67714 }, // ⋅
-    { 25, 6, 29, 2, 11, 38, 67723 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 67761 }, // �
+    { 27, 27, 29, 1, 21, 183, 2048 }, // @
+    { 23, 21, 22, 0, 21, 121, 2231 }, // A
+    { 17, 22, 19, 1, 21, 94, 2352 }, // B
+    { 17, 22, 19, 1, 21, 94, 2446 }, // C
+    { 21, 22, 23, 1, 21, 116, 2540 }, // D
+    { 17, 21, 19, 1, 21, 90, 2656 }, // E
+    { 16, 21, 17, 1, 21, 84, 2746 }, // F
+    { 20, 22, 21, 1, 21, 110, 2830 }, // G
+    { 23, 21, 25, 1, 21, 121, 2940 }, // H
+    { 11, 21, 12, 1, 21, 58, 3061 }, // I
+    { 14, 27, 11, -2, 21, 95, 3119 }, // J
+    { 21, 22, 22, 1, 21, 116, 3214 }, // K
+    { 17, 21, 18, 1, 21, 90, 3330 }, // L
+    { 27, 21, 28, 0, 21, 142, 3420 }, // M
+    { 24, 22, 23, 0, 21, 132, 3562 }, // N
+    { 21, 22, 23, 1, 21, 116, 3694 }, // O
+    { 17, 21, 18, 1, 21, 90, 3810 }, // P
+    { 22, 28, 23, 1, 21, 154, 3900 }, // Q
+    { 21, 22, 21, 1, 21, 116, 4096 }, // R
+    { 15, 22, 17, 1, 21, 83, 4212 }, // S
+    { 20, 21, 21, 0, 21, 105, 4295 }, // T
+    { 23, 22, 23, 0, 21, 127, 4400 }, // U
+    { 23, 22, 23, 0, 21, 127, 4527 }, // V
+    { 32, 22, 32, 0, 21, 176, 4654 }, // W
+    { 22, 21, 22, 0, 21, 116, 4830 }, // X
+    { 21, 21, 21, 0, 21, 111, 4946 }, // Y
+    { 17, 22, 18, 0, 21, 94, 5057 }, // Z
+    { 8, 28, 10, 1, 23, 56, 5151 }, // [
+    { 15, 23, 15, 0, 21, 87, 5207 }, // <backslash>
+    { 7, 28, 10, 1, 23, 49, 5294 }, // ]
+    { 16, 14, 18, 1, 19, 56, 5343 }, // ^
+    { 15, 4, 15, 0, -1, 15, 5399 }, // _
+    { 7, 8, 20, 6, 25, 14, 5414 }, // `
+    { 16, 17, 16, 1, 16, 68, 5428 }, // a
+    { 18, 24, 18, -1, 23, 108, 5496 }, // b
+    { 14, 17, 15, 1, 16, 60, 5604 }, // c
+    { 18, 24, 18, 1, 23, 108, 5664 }, // d
+    { 14, 17, 16, 1, 16, 60, 5772 }, // e
+    { 16, 23, 13, 0, 23, 92, 5832 }, // f
+    { 18, 23, 18, 0, 16, 104, 5924 }, // g
+    { 19, 23, 19, 0, 23, 110, 6028 }, // h
+    { 10, 23, 10, 0, 23, 58, 6144 }, // i
+    { 10, 30, 9, -2, 23, 75, 6202 }, // j
+    { 19, 24, 18, 0, 23, 114, 6277 }, // k
+    { 10, 23, 10, 0, 23, 58, 6391 }, // l
+    { 29, 16, 29, 0, 16, 116, 6449 }, // m
+    { 20, 16, 20, 0, 16, 80, 6565 }, // n
+    { 16, 17, 18, 1, 16, 68, 6645 }, // o
+    { 18, 23, 18, 0, 16, 104, 6713 }, // p
+    { 17, 23, 17, 1, 16, 98, 6817 }, // q
+    { 14, 16, 14, 0, 16, 56, 6915 }, // r
+    { 13, 17, 15, 1, 16, 56, 6971 }, // s
+    { 13, 20, 12, -1, 19, 65, 7027 }, // t
+    { 20, 17, 19, 0, 16, 85, 7092 }, // u
+    { 19, 17, 19, 0, 16, 81, 7177 }, // v
+    { 26, 17, 26, 0, 16, 111, 7258 }, // w
+    { 18, 16, 18, 0, 16, 72, 7369 }, // x
+    { 19, 23, 19, 0, 16, 110, 7441 }, // y
+    { 15, 17, 15, 0, 16, 64, 7551 }, // z
+    { 10, 29, 12, 1, 24, 73, 7615 }, // {
+    { 5, 27, 9, 2, 23, 34, 7688 }, // |
+    { 10, 29, 12, 0, 24, 73, 7722 }, // }
+    { 14, 7, 18, 2, 13, 25, 7795 }, // ~
+    { 0, 0, 6, 0, 0, 0, 7820 }, //  
+    { 6, 23, 8, 1, 16, 35, 7820 }, // ¡
+    { 16, 29, 18, 1, 23, 116, 7855 }, // ¢
+    { 18, 22, 18, 0, 21, 99, 7971 }, // £
+    { 16, 14, 18, 1, 17, 56, 8070 }, // ¤
+    { 20, 20, 18, -1, 20, 100, 8192 }, // ¥
+    { 5, 27, 9, 2, 23, 34, 8292 }, // ¦
+    { 13, 23, 15, 1, 20, 75, 8326 }, // §
+    { 12, 5, 20, 4, 23, 15, 8401 }, // ¨
+    { 22, 22, 23, 0, 21, 121, 8416 }, // ©
+    { 11, 15, 13, 1, 21, 42, 8537 }, // ª
+    { 16, 12, 17, 0, 13, 48, 8579 }, // «
+    { 14, 8, 18, 2, 14, 28, 8627 }, // ¬
+    { 9, 5, 11, 1, 10, 12, 8655 }, // ­
+    { 17, 16, 17, 0, 23, 68, 8667 }, // ®
+    { 11, 3, 20, 4, 21, 9, 8735 }, // ¯
+    { 11, 12, 15, 2, 21, 33, 8744 }, // °
+    { 14, 18, 18, 2, 17, 63, 8777 }, // ±
+    { 11, 14, 13, 1, 24, 39, 8840 }, // ²
+    { 11, 14, 13, 1, 24, 39, 8879 }, // ³
+    { 6, 8, 20, 7, 25, 12, 8918 }, // ´
+    { 19, 23, 19, 1, 16, 110, 8930 }, // µ
+    { 17, 26, 17, 0, 21, 111, 9040 }, // ¶
+    { 6, 6, 8, 1, 11, 9, 9151 }, // ·
+    { 6, 7, 20, 7, -1, 11, 9160 }, // ¸
+    { 10, 14, 13, 1, 24, 35, 9171 }, // ¹
+    { 11, 15, 13, 1, 21, 42, 9206 }, // º
+    { 16, 12, 17, 1, 13, 48, 9248 }, // »
+    { 30, 25, 31, 1, 22, 188, 9296 }, // ¼
+    { 30, 25, 31, 1, 22, 188, 9484 }, // ½
+    { 30, 25, 31, 1, 22, 188, 9672 }, // ¾
+    { 12, 23, 14, 1, 16, 69, 9860 }, // ¿
+    { 23, 29, 22, 0, 29, 167, 9929 }, // À
+    { 23, 29, 22, 0, 29, 167, 10240 }, // Á
+    { 23, 28, 22, 0, 28, 161, 10407 }, // Â
+    { 23, 28, 22, 0, 28, 161, 10568 }, // Ã
+    { 23, 27, 22, 0, 27, 156, 10729 }, // Ä
+    { 23, 29, 22, 0, 29, 167, 10885 }, // Å
+    { 29, 21, 28, -1, 21, 153, 11052 }, // Æ
+    { 17, 29, 19, 1, 21, 124, 11205 }, // Ç
+    { 17, 29, 19, 1, 29, 124, 11329 }, // È
+    { 17, 29, 19, 1, 29, 124, 11453 }, // É
+    { 17, 28, 19, 1, 28, 119, 11577 }, // Ê
+    { 17, 27, 19, 1, 27, 115, 11696 }, // Ë
+    { 11, 29, 12, 1, 29, 80, 11811 }, // Ì
+    { 11, 29, 12, 1, 29, 80, 11891 }, // Í
+    { 12, 28, 12, 0, 28, 84, 11971 }, // Î
+    { 12, 27, 12, 0, 27, 81, 12055 }, // Ï
+    { 22, 22, 23, 0, 21, 121, 12136 }, // Ð
+    { 24, 29, 23, 0, 28, 174, 12288 }, // Ñ
+    { 21, 30, 23, 1, 29, 158, 12462 }, // Ò
+    { 21, 30, 23, 1, 29, 158, 12620 }, // Ó
+    { 21, 29, 23, 1, 28, 153, 12778 }, // Ô
+    { 21, 29, 23, 1, 28, 153, 12931 }, // Õ
+    { 21, 28, 23, 1, 27, 147, 13084 }, // Ö
+    { 13, 13, 18, 3, 16, 43, 13231 }, // ×
+    { 23, 22, 23, 0, 21, 127, 13274 }, // Ø
+    { 23, 30, 23, 0, 29, 173, 13401 }, // Ù
+    { 23, 30, 23, 0, 29, 173, 13574 }, // Ú
+    { 23, 29, 23, 0, 28, 167, 13747 }, // Û
+    { 23, 28, 23, 0, 27, 161, 13914 }, // Ü
+    { 21, 29, 21, 0, 29, 153, 14075 }, // Ý
+    { 17, 21, 19, 1, 21, 90, 14228 }, // Þ
+    { 19, 24, 19, 0, 23, 114, 14336 }, // ß
+    { 16, 26, 16, 1, 25, 104, 14450 }, // à
+    { 16, 26, 16, 1, 25, 104, 14554 }, // á
+    { 16, 25, 16, 1, 24, 100, 14658 }, // â
+    { 16, 24, 16, 1, 23, 96, 14758 }, // ã
+    { 16, 24, 16, 1, 23, 96, 14854 }, // ä
+    { 16, 26, 16, 1, 25, 104, 14950 }, // å
+    { 22, 17, 24, 1, 16, 94, 15054 }, // æ
+    { 14, 24, 15, 1, 16, 84, 15148 }, // ç
+    { 14, 26, 16, 1, 25, 91, 15232 }, // è
+    { 14, 26, 16, 1, 25, 91, 15323 }, // é
+    { 14, 25, 16, 1, 24, 88, 15414 }, // ê
+    { 14, 24, 16, 1, 23, 84, 15502 }, // ë
+    { 10, 25, 10, 0, 25, 63, 15586 }, // ì
+    { 10, 25, 10, 0, 25, 63, 15649 }, // í
+    { 11, 24, 10, 0, 24, 66, 15712 }, // î
+    { 11, 23, 10, 0, 23, 64, 15778 }, // ï
+    { 16, 25, 18, 1, 24, 100, 15842 }, // ð
+    { 20, 23, 20, 0, 23, 115, 15942 }, // ñ
+    { 16, 26, 18, 1, 25, 104, 16057 }, // ò
+    { 16, 26, 18, 1, 25, 104, 16161 }, // ó
+    { 16, 25, 18, 1, 24, 100, 16265 }, // ô
+    { 16, 24, 18, 1, 23, 96, 16384 }, // õ
+    { 16, 24, 18, 1, 23, 96, 16480 }, // ö
+    { 14, 14, 18, 2, 17, 49, 16576 }, // ÷
+    { 17, 17, 18, 0, 16, 73, 16625 }, // ø
+    { 20, 26, 19, 0, 25, 130, 16698 }, // ù
+    { 20, 26, 19, 0, 25, 130, 16828 }, // ú
+    { 20, 25, 19, 0, 24, 125, 16958 }, // û
+    { 20, 24, 19, 0, 23, 120, 17083 }, // ü
+    { 19, 32, 19, 0, 25, 152, 17203 }, // ý
+    { 18, 30, 18, 0, 23, 135, 17355 }, // þ
+    { 19, 30, 19, 0, 23, 143, 17490 }, // ÿ
+    { 23, 26, 22, 0, 26, 150, 17633 }, // Ā
+    { 16, 22, 16, 1, 21, 88, 17783 }, // ā
+    { 23, 28, 22, 0, 28, 161, 17871 }, // Ă
+    { 16, 24, 16, 1, 23, 96, 18032 }, // ă
+    { 23, 28, 22, 0, 21, 161, 18128 }, // Ą
+    { 16, 23, 16, 1, 16, 92, 18289 }, // ą
+    { 17, 30, 19, 1, 29, 128, 18432 }, // Ć
+    { 14, 26, 15, 1, 25, 91, 18560 }, // ć
+    { 17, 29, 19, 1, 28, 124, 18651 }, // Ĉ
+    { 14, 25, 15, 1, 24, 88, 18775 }, // ĉ
+    { 17, 29, 19, 1, 28, 124, 18863 }, // Ċ
+    { 14, 24, 15, 1, 23, 84, 18987 }, // ċ
+    { 17, 29, 19, 1, 28, 124, 19071 }, // Č
+    { 14, 25, 15, 1, 24, 88, 19195 }, // č
+    { 21, 29, 23, 1, 28, 153, 19283 }, // Ď
+    { 20, 24, 19, 1, 23, 120, 19436 }, // ď
+    { 22, 22, 23, 0, 21, 121, 19556 }, // Đ
+    { 18, 24, 18, 1, 23, 108, 19677 }, // đ
+    { 17, 26, 19, 1, 26, 111, 19785 }, // Ē
+    { 14, 22, 16, 1, 21, 77, 19896 }, // ē
+    { 17, 28, 19, 1, 28, 119, 19973 }, // Ĕ
+    { 14, 24, 16, 1, 23, 84, 20092 }, // ĕ
+    { 17, 28, 19, 1, 28, 119, 20176 }, // Ė
+    { 14, 24, 16, 1, 23, 84, 20295 }, // ė
+    { 17, 28, 19, 1, 21, 119, 20480 }, // Ę
+    { 14, 23, 16, 1, 16, 81, 20599 }, // ę
+    { 17, 28, 19, 1, 28, 119, 20680 }, // Ě
+    { 14, 25, 16, 1, 24, 88, 20799 }, // ě
+    { 20, 29, 21, 1, 28, 145, 20887 }, // Ĝ
+    { 18, 31, 18, 0, 24, 140, 21032 }, // ĝ
+    { 20, 29, 21, 1, 28, 145, 21172 }, // Ğ
+    { 18, 30, 18, 0, 23, 135, 21317 }, // ğ
+    { 20, 29, 21, 1, 28, 145, 21452 }, // Ġ
+    { 18, 30, 18, 0, 23, 135, 21597 }, // ġ
+    { 20, 29, 21, 1, 21, 145, 21732 }, // Ģ
+    { 18, 32, 18, 0, 25, 144, 21877 }, // ģ
+    { 23, 28, 25, 1, 28, 161, 22021 }, // Ĥ
+    { 20, 30, 19, -1, 30, 150, 22182 }, // ĥ
+    { 25, 21, 25, 0, 21, 132, 22332 }, // Ħ
+    { 19, 23, 19, 0, 23, 110, 22528 }, // ħ
+    { 11, 28, 12, 1, 28, 77, 22638 }, // Ĩ
+    { 11, 23, 10, 0, 23, 64, 22715 }, // ĩ
+    { 11, 26, 12, 1, 26, 72, 22779 }, // Ī
+    { 11, 21, 10, 0, 21, 58, 22851 }, // ī
+    { 11, 28, 12, 1, 28, 77, 22909 }, // Ĭ
+    { 11, 23, 10, 0, 23, 64, 22986 }, // ĭ
+    { 11, 28, 12, 1, 21, 77, 23050 }, // Į
+    { 11, 30, 10, 0, 23, 83, 23127 }, // į
+    { 11, 28, 12, 1, 28, 77, 23210 }, // İ
+    { 10, 16, 10, 0, 16, 40, 23287 }, // ı
+    { 23, 27, 24, 1, 21, 156, 23327 }, // Ĳ
+    { 18, 30, 19, 0, 23, 135, 23483 }, // ĳ
+    { 14, 34, 11, -2, 28, 119, 23618 }, // Ĵ
+    { 12, 31, 9, -2, 24, 93, 23737 }, // ĵ
+    { 21, 29, 22, 1, 21, 153, 23830 }, // Ķ
+    { 19, 31, 18, 0, 23, 148, 23983 }, // ķ
+    { 19, 17, 19, 0, 16, 81, 24131 }, // ĸ
+    { 17, 29, 18, 1, 29, 124, 24212 }, // Ĺ
+    { 10, 30, 10, 0, 30, 75, 24336 }, // ĺ
+    { 17, 29, 18, 1, 21, 124, 24411 }, // Ļ
+    { 10, 31, 10, 0, 23, 78, 24576 }, // ļ
+    { 17, 23, 18, 1, 23, 98, 24654 }, // Ľ
+    { 13, 23, 11, 0, 23, 75, 24752 }, // ľ
+    { 17, 21, 18, 1, 21, 90, 24827 }, // Ŀ
+    { 16, 23, 16, 0, 23, 92, 24917 }, // ŀ
+    { 19, 21, 18, -1, 21, 100, 25009 }, // Ł
+    { 12, 23, 10, -1, 23, 69, 25109 }, // ł
+    { 24, 30, 23, 0, 29, 180, 25178 }, // Ń
+    { 20, 25, 20, 0, 25, 125, 25358 }, // ń
+    { 24, 29, 23, 0, 21, 174, 25483 }, // Ņ
+    { 20, 24, 20, 0, 16, 120, 25657 }, // ņ
+    { 24, 29, 23, 0, 28, 174, 25777 }, // Ň
+    { 20, 24, 20, 0, 24, 120, 25951 }, // ň
+    { 26, 21, 26, 0, 21, 137, 26071 }, // ŉ
+    { 24, 27, 23, 0, 21, 162, 26208 }, // Ŋ
+    { 18, 23, 19, 0, 16, 104, 26370 }, // ŋ
+    { 21, 27, 23, 1, 26, 142, 26474 }, // Ō
+    { 16, 22, 18, 1, 21, 88, 26624 }, // ō
+    { 21, 29, 23, 1, 28, 153, 26712 }, // Ŏ
+    { 16, 24, 18, 1, 23, 96, 26865 }, // ŏ
+    { 21, 30, 23, 1, 29, 158, 26961 }, // Ő
+    { 16, 26, 18, 1, 25, 104, 27119 }, // ő
+    { 28, 22, 29, 1, 21, 154, 27223 }, // Œ
+    { 25, 17, 26, 1, 16, 107, 27377 }, // œ
+    { 21, 30, 21, 1, 29, 158, 27484 }, // Ŕ
+    { 14, 25, 14, 0, 25, 88, 27642 }, // ŕ
+    { 21, 29, 21, 1, 21, 153, 27730 }, // Ŗ
+    { 14, 24, 14, 0, 16, 84, 27883 }, // ŗ
+    { 21, 29, 21, 1, 28, 153, 27967 }, // Ř
+    { 14, 24, 14, 0, 24, 84, 28120 }, // ř
+    { 15, 30, 17, 1, 29, 113, 28204 }, // Ś
+    { 13, 26, 15, 1, 25, 85, 28317 }, // ś
+    { 15, 29, 17, 1, 28, 109, 28402 }, // Ŝ
+    { 13, 25, 15, 1, 24, 82, 28511 }, // ŝ
+    { 15, 29, 17, 1, 21, 109, 28672 }, // Ş
+    { 13, 24, 15, 1, 16, 78, 28781 }, // ş
+    { 15, 29, 17, 1, 28, 109, 28859 }, // Š
+    { 13, 25, 15, 1, 24, 82, 28968 }, // š
+    { 20, 29, 21, 0, 21, 145, 29050 }, // Ţ
+    { 13, 27, 12, -1, 19, 88, 29195 }, // ţ
+    { 20, 28, 21, 0, 28, 140, 29283 }, // Ť
+    { 13, 25, 12, -1, 24, 82, 29423 }, // ť
+    { 20, 21, 21, 0, 21, 105, 29505 }, // Ŧ
+    { 13, 20, 12, -1, 19, 65, 29610 }, // ŧ
+    { 23, 29, 23, 0, 28, 167, 29675 }, // Ũ
+    { 20, 24, 19, 0, 23, 120, 29842 }, // ũ
+    { 23, 27, 23, 0, 26, 156, 29962 }, // Ū
+    { 20, 22, 19, 0, 21, 110, 30118 }, // ū
+    { 23, 29, 23, 0, 28, 167, 30228 }, // Ŭ
+    { 20, 24, 19, 0, 23, 120, 30395 }, // ŭ
+    { 23, 30, 23, 0, 29, 173, 30515 }, // Ů
+    { 20, 26, 19, 0, 25, 130, 30720 }, // ů
+    { 23, 30, 23, 0, 29, 173, 30850 }, // Ű
+    { 20, 26, 19, 0, 25, 130, 31023 }, // ű
+    { 23, 28, 23, 0, 21, 161, 31153 }, // Ų
+    { 20, 23, 19, 0, 16, 115, 31314 }, // ų
+    { 32, 29, 32, 0, 28, 232, 31429 }, // Ŵ
+    { 26, 25, 26, 0, 24, 163, 31661 }, // ŵ
+    { 21, 28, 21, 0, 28, 147, 31824 }, // Ŷ
+    { 19, 31, 19, 0, 24, 148, 31971 }, // ŷ
+    { 21, 27, 21, 0, 27, 142, 32119 }, // Ÿ
+    { 17, 30, 18, 0, 29, 128, 32261 }, // Ź
+    { 15, 26, 15, 0, 25, 98, 32389 }, // ź
+    { 17, 29, 18, 0, 28, 124, 32487 }, // Ż
+    { 15, 24, 15, 0, 23, 90, 32611 }, // ż
+    { 17, 29, 18, 0, 28, 124, 32768 }, // Ž
+    { 15, 25, 15, 0, 24, 94, 32892 }, // ž
+    { 15, 23, 12, 0, 23, 87, 32986 }, // ſ
+    { 7, 8, 0, -5, 25, 14, 33073 }, // ̀
+    { 6, 8, 0, -2, 25, 12, 33087 }, // ́
+    { 10, 7, 0, -5, 24, 18, 33099 }, // ̂
+    { 10, 5, 0, -5, 23, 13, 33117 }, // ̃
+    { 10, 3, 0, -5, 21, 8, 33130 }, // ̄
+    { 10, 6, 0, -5, 23, 15, 33138 }, // ̆
+    { 6, 5, 0, -3, 23, 8, 33153 }, // ̇
+    { 12, 5, 0, -6, 23, 15, 33161 }, // ̈
+    { 8, 9, 0, -4, 26, 18, 33176 }, // ̉
+    { 8, 9, 0, -4, 25, 18, 33194 }, // ̊
+    { 11, 8, 0, -4, 25, 22, 33212 }, // ̋
+    { 10, 7, 0, -5, 24, 18, 33234 }, // ̌
+    { 11, 8, 0, -7, 25, 22, 33252 }, // ̏
+    { 10, 6, 0, -5, 23, 15, 33274 }, // ̑
+    { 6, 8, 0, -3, 25, 12, 33289 }, // ̒
+    { 6, 9, 0, -2, 26, 14, 33301 }, // ̓
+    { 6, 9, 0, -4, 26, 14, 33315 }, // ̔
+    { 4, 8, 0, -2, 25, 8, 33329 }, // ̕
+    { 6, 8, 0, -3, 19, 12, 33337 }, // ̛
+    { 6, 5, 0, -3, -2, 8, 33349 }, // ̣
+    { 12, 5, 0, -6, -2, 15, 33357 }, // ̤
+    { 8, 7, 0, -4, -1, 14, 33372 }, // ̥
+    { 6, 7, 0, -3, -1, 11, 33386 }, // ̦
+    { 6, 7, 0, -3, -1, 11, 33397 }, // ̧
+    { 8, 8, 0, -4, 1, 16, 33408 }, // ̨
+    { 4, 8, 8, 2, -1, 8, 33424 }, // ̩
+    { 12, 7, 0, -6, -1, 21, 33432 }, // ̭
+    { 10, 6, 0, -5, -2, 15, 33453 }, // ̮
+    { 10, 6, 0, -5, -2, 15, 33468 }, // ̰
+    { 10, 3, 0, -5, -3, 8, 33483 }, // ̱
+    { 10, 6, 0, -5, 23, 15, 33491 }, // ͂
+    { 12, 12, 0, -6, 30, 36, 33506 }, // ̈́
+    { 6, 6, 0, -2, -2, 9, 33542 }, // ͅ
+    { 17, 29, 19, 1, 29, 124, 33551 }, // Ѐ
+    { 17, 27, 19, 1, 27, 115, 33675 }, // Ё
+    { 24, 27, 25, 0, 21, 162, 33790 }, // Ђ
+    { 17, 29, 18, 1, 29, 124, 33952 }, // Ѓ
+    { 18, 22, 20, 1, 21, 99, 34076 }, // Є
+    { 15, 22, 17, 1, 21, 83, 34175 }, // Ѕ
+    { 11, 21, 12, 1, 21, 58, 34258 }, // І
+    { 12, 27, 12, 0, 27, 81, 34316 }, // Ї
+    { 14, 27, 11, -2, 21, 95, 34397 }, // Ј
+    { 28, 22, 29, 0, 21, 154, 34492 }, // Љ
+    { 29, 22, 31, 1, 21, 160, 34646 }, // Њ
+    { 27, 21, 27, 0, 21, 142, 34816 }, // Ћ
+    { 21, 30, 22, 1, 29, 158, 34958 }, // Ќ
+    { 23, 29, 25, 1, 29, 167, 35116 }, // Ѝ
+    { 21, 29, 21, 0, 28, 153, 35283 }, // Ў
+    { 22, 28, 24, 1, 21, 154, 35436 }, // Џ
+    { 23, 21, 22, 0, 21, 121, 35590 }, // А
+    { 17, 22, 19, 1, 21, 94, 35711 }, // Б
+    { 17, 22, 19, 1, 21, 94, 35805 }, // В
+    { 17, 21, 18, 1, 21, 90, 35899 }, // Г
+    { 23, 27, 23, 0, 21, 156, 35989 }, // Д
+    { 17, 21, 19, 1, 21, 90, 36145 }, // Е
+    { 32, 22, 32, 0, 21, 176, 36235 }, // Ж
+    { 17, 22, 18, 1, 21, 94, 36411 }, // З
+    { 23, 21, 25, 1, 21, 121, 36505 }, // И
+    { 23, 28, 25, 1, 28, 161, 36626 }, // Й
+    { 21, 22, 22, 1, 21, 116, 36864 }, // К
+    { 22, 22, 22, 0, 21, 121, 36980 }, // Л
+    { 27, 21, 28, 0, 21, 142, 37101 }, // М
+    { 23, 21, 25, 1, 21, 121, 37243 }, // Н
+    { 21, 22, 23, 1, 21, 116, 37364 }, // О
+    { 23, 21, 24, 1, 21, 121, 37480 }, // П
+    { 17, 21, 18, 1, 21, 90, 37601 }, // Р
+    { 17, 22, 19, 1, 21, 94, 37691 }, // С
+    { 20, 21, 21, 0, 21, 105, 37785 }, // Т
+    { 21, 22, 21, 0, 21, 116, 37890 }, // У
+    { 22, 22, 23, 1, 21, 121, 38006 }, // Ф
+    { 22, 21, 22, 0, 21, 116, 38127 }, // Х
+    { 23, 27, 24, 1, 21, 156, 38243 }, // Ц
+    { 22, 21, 22, 0, 21, 116, 38399 }, // Ч
+    { 31, 21, 32, 1, 21, 163, 38515 }, // Ш
+    { 32, 27, 33, 1, 21, 216, 38678 }, // Щ
+    { 22, 22, 23, 0, 21, 121, 38912 }, // Ъ
+    { 28, 22, 30, 1, 21, 154, 39033 }, // Ы
+    { 17, 22, 19, 1, 21, 94, 39187 }, // Ь
+    { 18, 22, 20, 1, 21, 99, 39281 }, // Э
+    { 30, 22, 32, 1, 21, 165, 39380 }, // Ю
+    { 20, 22, 21, 0, 21, 110, 39545 }, // Я
+    { 16, 17, 16, 1, 16, 68, 39655 }, // а
+    { 16, 24, 17, 1, 23, 96, 39723 }, // б
+    { 15, 17, 17, 1, 16, 64, 39819 }, // в
+    { 14, 16, 15, 1, 16, 56, 39883 }, // г
+    { 20, 22, 20, 0, 16, 110, 39939 }, // д
+    { 14, 17, 16, 1, 16, 60, 40049 }, // е
+    { 26, 17, 26, 0, 16, 111, 40109 }, // ж
+    { 14, 17, 15, 0, 16, 60, 40220 }, // з
+    { 19, 16, 20, 1, 16, 76, 40280 }, // и
+    { 19, 23, 20, 1, 23, 110, 40356 }, // й
+    { 18, 17, 19, 1, 16, 77, 40466 }, // к
+    { 18, 17, 19, 0, 16, 77, 40543 }, // л
+    { 21, 16, 23, 1, 16, 84, 40620 }, // м
+    { 19, 16, 20, 1, 16, 76, 40704 }, // н
+    { 16, 17, 18, 1, 16, 68, 40780 }, // о
+    { 19, 16, 20, 1, 16, 76, 40848 }, // п
+    { 18, 23, 18, 0, 16, 104, 40960 }, // р
+    { 14, 17, 15, 1, 16, 60, 41064 }, // с
+    { 17, 16, 18, 0, 16, 68, 41124 }, // т
+    { 19, 23, 19, 0, 16, 110, 41192 }, // у
+    { 21, 30, 23, 1, 23, 158, 41302 }, // ф
+    { 18, 16, 18, 0, 16, 72, 41460 }, // х
+    { 19, 22, 20, 1, 16, 105, 41532 }, // ц
+    { 18, 16, 19, 0, 16, 72, 41637 }, // ч
+    { 25, 16, 27, 1, 16, 100, 41709 }, // ш
+    { 26, 22, 27, 1, 16, 143, 41809 }, // щ
+    { 19, 17, 19, 0, 16, 81, 41952 }, // ъ
+    { 24, 17, 25, 1, 16, 102, 42033 }, // ы
+    { 15, 17, 16, 1, 16, 64, 42135 }, // ь
+    { 15, 17, 16, 0, 16, 64, 42199 }, // э
+    { 24, 17, 26, 1, 16, 102, 42263 }, // ю
+    { 17, 17, 18, 0, 16, 73, 42365 }, // я
+    { 14, 26, 16, 1, 25, 91, 42438 }, // ѐ
+    { 14, 24, 16, 1, 23, 84, 42529 }, // ё
+    { 18, 30, 19, 0, 23, 135, 42613 }, // ђ
+    { 14, 25, 15, 1, 25, 88, 42748 }, // ѓ
+    { 14, 17, 16, 1, 16, 60, 42836 }, // є
+    { 13, 17, 15, 1, 16, 56, 42896 }, // ѕ
+    { 10, 23, 10, 0, 23, 58, 43008 }, // і
+    { 11, 23, 10, 0, 23, 64, 43066 }, // ї
+    { 10, 30, 9, -2, 23, 75, 43130 }, // ј
+    { 23, 17, 23, 0, 16, 98, 43205 }, // љ
+    { 24, 17, 25, 1, 16, 102, 43303 }, // њ
+    { 19, 23, 19, 0, 23, 110, 43405 }, // ћ
+    { 18, 26, 19, 1, 25, 117, 43515 }, // ќ
+    { 19, 25, 20, 1, 25, 119, 43632 }, // ѝ
+    { 19, 30, 19, 0, 23, 143, 43751 }, // ў
+    { 18, 22, 20, 1, 16, 99, 43894 }, // џ
+    { 20, 24, 22, 1, 23, 120, 43993 }, // Ѣ
+    { 19, 22, 19, 0, 21, 105, 44113 }, // ѣ
+    { 21, 22, 23, 1, 21, 116, 44218 }, // Ѳ
+    { 16, 17, 18, 1, 16, 68, 44334 }, // ѳ
+    { 23, 22, 23, 0, 21, 127, 44402 }, // Ѵ
+    { 20, 17, 19, 0, 16, 85, 44529 }, // ѵ
+    { 24, 34, 25, 1, 28, 204, 44614 }, // Ҋ
+    { 20, 29, 20, 0, 23, 145, 44818 }, // ҋ
+    { 18, 22, 19, 0, 21, 99, 45056 }, // Ҍ
+    { 15, 22, 16, 0, 21, 83, 45155 }, // ҍ
+    { 17, 21, 18, 1, 21, 90, 45238 }, // Ҏ
+    { 18, 23, 18, 0, 16, 104, 45328 }, // ҏ
+    { 15, 24, 17, 1, 24, 90, 45432 }, // Ґ
+    { 13, 19, 15, 1, 19, 62, 45522 }, // ґ
+    { 18, 21, 18, 0, 21, 95, 45584 }, // Ғ
+    { 15, 16, 16, 0, 16, 60, 45679 }, // ғ
+    { 19, 27, 21, 1, 21, 129, 45739 }, // Ҕ
+    { 16, 23, 18, 1, 16, 92, 45868 }, // ҕ
+    { 32, 27, 32, 0, 21, 216, 45960 }, // Җ
+    { 26, 22, 26, 0, 16, 143, 46176 }, // җ
+    { 17, 28, 18, 1, 21, 119, 46319 }, // Ҙ
+    { 14, 22, 15, 0, 16, 77, 46438 }, // ҙ
+    { 21, 27, 22, 1, 21, 142, 46515 }, // Қ
+    { 18, 22, 19, 1, 16, 99, 46657 }, // қ
+    { 23, 22, 23, 1, 21, 127, 46756 }, // Ҝ
+    { 18, 17, 19, 1, 16, 77, 46883 }, // ҝ
+    { 22, 22, 22, 0, 21, 121, 46960 }, // Ҟ
+    { 19, 22, 18, 0, 21, 105, 47104 }, // ҟ
+    { 26, 22, 25, 0, 21, 143, 47209 }, // Ҡ
+    { 22, 17, 22, 0, 16, 94, 47352 }, // ҡ
+    { 24, 27, 25, 1, 21, 162, 47446 }, // Ң
+    { 20, 22, 21, 1, 16, 110, 47608 }, // ң
+    { 27, 21, 29, 1, 21, 142, 47718 }, // Ҥ
+    { 22, 16, 24, 1, 16, 88, 47860 }, // ҥ
+    { 31, 27, 32, 1, 21, 210, 47948 }, // Ҧ
+    { 26, 23, 27, 1, 16, 150, 48158 }, // ҧ
+    { 24, 22, 25, 1, 21, 132, 48308 }, // Ҩ
+    { 19, 17, 20, 1, 16, 81, 48440 }, // ҩ
+    { 17, 28, 19, 1, 21, 119, 48521 }, // Ҫ
+    { 14, 22, 15, 1, 16, 77, 48640 }, // ҫ
+    { 20, 27, 21, 0, 21, 135, 48717 }, // Ҭ
+    { 17, 22, 18, 0, 16, 94, 48852 }, // ҭ
+    { 21, 21, 21, 0, 21, 111, 48946 }, // Ү
+    { 19, 23, 19, 0, 16, 110, 49152 }, // ү
+    { 21, 21, 21, 0, 21, 111, 49262 }, // Ұ
+    { 19, 23, 19, 0, 16, 110, 49373 }, // ұ
+    { 23, 27, 23, 0, 21, 156, 49483 }, // Ҳ
+    { 18, 22, 18, 0, 16, 99, 49639 }, // ҳ
+    { 27, 27, 27, 0, 21, 183, 49738 }, // Ҵ
+    { 23, 22, 23, 0, 16, 127, 49921 }, // ҵ
+    { 23, 27, 23, 0, 21, 156, 50048 }, // Ҷ
+    { 19, 22, 19, 0, 16, 105, 50204 }, // ҷ
+    { 22, 21, 22, 0, 21, 116, 50309 }, // Ҹ
+    { 18, 16, 19, 0, 16, 72, 50425 }, // ҹ
+    { 22, 21, 23, 1, 21, 116, 50497 }, // Һ
+    { 19, 23, 19, 0, 23, 110, 50613 }, // һ
+    { 24, 22, 25, 0, 21, 132, 50723 }, // Ҽ
+    { 19, 17, 19, 0, 16, 81, 50855 }, // ҽ
+    { 24, 27, 25, 0, 21, 162, 50936 }, // Ҿ
+    { 19, 22, 19, 0, 16, 105, 51200 }, // ҿ
+    { 11, 21, 12, 1, 21, 58, 51305 }, // Ӏ
+    { 32, 29, 32, 0, 28, 232, 51363 }, // Ӂ
+    { 26, 24, 26, 0, 23, 156, 51595 }, // ӂ
+    { 20, 27, 21, 1, 21, 135, 51751 }, // Ӄ
+    { 17, 23, 18, 1, 16, 98, 51886 }, // ӄ
+    { 22, 27, 22, 0, 21, 149, 51984 }, // Ӆ
+    { 19, 22, 19, 0, 16, 105, 52133 }, // ӆ
+    { 23, 27, 24, 1, 21, 156, 52238 }, // Ӈ
+    { 19, 23, 20, 1, 16, 110, 52394 }, // ӈ
+    { 24, 27, 25, 1, 21, 162, 52504 }, // Ӊ
+    { 19, 22, 20, 1, 16, 105, 52666 }, // ӊ
+    { 22, 27, 22, 0, 21, 149, 52771 }, // Ӌ
+    { 18, 22, 19, 0, 16, 99, 52920 }, // ӌ
+    { 28, 27, 28, 0, 21, 189, 53019 }, // Ӎ
+    { 22, 22, 23, 1, 16, 121, 53248 }, // ӎ
+    { 10, 23, 12, 1, 23, 58, 53369 }, // ӏ
+    { 23, 28, 22, 0, 28, 161, 53427 }, // Ӑ
+    { 16, 24, 16, 1, 23, 96, 53588 }, // ӑ
+    { 23, 27, 22, 0, 27, 156, 53684 }, // Ӓ
+    { 16, 24, 16, 1, 23, 96, 53840 }, // ӓ
+    { 29, 21, 28, -1, 21, 153, 53936 }, // Ӕ
+    { 22, 17, 24, 1, 16, 94, 54089 }, // ӕ
+    { 17, 28, 19, 1, 28, 119, 54183 }, // Ӗ
+    { 14, 24, 16, 1, 23, 84, 54302 }, // ӗ
+    { 19, 22, 20, 1, 21, 105, 54386 }, // Ә
+    { 14, 17, 16, 1, 16, 60, 54491 }, // ә
+    { 19, 28, 20, 1, 27, 133, 54551 }, // Ӛ
+    { 14, 24, 16, 1, 23, 84, 54684 }, // ӛ
+    { 32, 28, 32, 0, 27, 224, 54768 }, // Ӝ
+    { 26, 24, 26, 0, 23, 156, 54992 }, // ӝ
+    { 17, 28, 18, 1, 27, 119, 55148 }, // Ӟ
+    { 14, 24, 15, 0, 23, 84, 55296 }, // ӟ
+    { 16, 22, 17, 0, 21, 88, 55380 }, // Ӡ
+    { 15, 23, 16, 0, 16, 87, 55468 }, // ӡ
+    { 23, 26, 25, 1, 26, 150, 55555 }, // Ӣ
+    { 19, 21, 20, 1, 21, 100, 55705 }, // ӣ
+    { 23, 27, 25, 1, 27, 156, 55805 }, // Ӥ
+    { 19, 23, 20, 1, 23, 110, 55961 }, // ӥ
+    { 21, 28, 23, 1, 27, 147, 56071 }, // Ӧ
+    { 16, 24, 18, 1, 23, 96, 56218 }, // ӧ
+    { 21, 22, 23, 1, 21, 116, 56314 }, // Ө
+    { 16, 17, 18, 1, 16, 68, 56430 }, // ө
+    { 21, 28, 23, 1, 27, 147, 56498 }, // Ӫ
+    { 16, 24, 18, 1, 23, 96, 56645 }, // ӫ
+    { 18, 28, 20, 1, 27, 126, 56741 }, // Ӭ
+    { 15, 24, 16, 0, 23, 90, 56867 }, // ӭ
+    { 21, 27, 21, 0, 26, 142, 56957 }, // Ӯ
+    { 19, 28, 19, 0, 21, 133, 57099 }, // ӯ
+    { 21, 28, 21, 0, 27, 147, 57344 }, // Ӱ
+    { 19, 30, 19, 0, 23, 143, 57491 }, // ӱ
+    { 21, 30, 21, 0, 29, 158, 57634 }, // Ӳ
+    { 19, 32, 19, 0, 25, 152, 57792 }, // ӳ
+    { 22, 27, 22, 0, 27, 149, 57944 }, // Ӵ
+    { 18, 23, 19, 0, 23, 104, 58093 }, // ӵ
+    { 17, 27, 18, 1, 21, 115, 58197 }, // Ӷ
+    { 14, 22, 15, 1, 16, 77, 58312 }, // ӷ
+    { 28, 28, 30, 1, 27, 196, 58389 }, // Ӹ
+    { 24, 24, 25, 1, 23, 144, 58585 }, // ӹ
+    { 18, 27, 18, 0, 21, 122, 58729 }, // Ӻ
+    { 15, 22, 15, 0, 16, 83, 58851 }, // ӻ
+    { 22, 27, 22, 0, 21, 149, 58934 }, // Ӽ
+    { 18, 23, 18, 0, 16, 104, 59083 }, // ӽ
+    { 22, 21, 22, 0, 21, 116, 59187 }, // Ӿ
+    { 18, 16, 18, 0, 16, 72, 59303 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 59375 }, //  
+    { 0, 0, 29, 0, 0, 0, 59375 }, //  
+    { 0, 0, 15, 0, 0, 0, 59375 }, //  
+    { 0, 0, 29, 0, 0, 0, 59375 }, //  
+    { 0, 0, 10, 0, 0, 0, 59375 }, //  
+    { 0, 0, 7, 0, 0, 0, 59375 }, //  
+    { 0, 0, 5, 0, 0, 0, 59375 }, //  
+    { 0, 0, 18, 0, 0, 0, 59375 }, //  
+    { 0, 0, 8, 0, 0, 0, 59375 }, //  
+    { 0, 0, 6, 0, 0, 0, 59375 }, //  
+    { 0, 0, 1, 0, 0, 0, 59375 }, //  
+    { 0, 0, 0, 0, 0, 0, 59375 }, // ​
+    { 2, 24, 0, -1, 17, 12, 59375 }, // ‌
+    { 6, 26, 0, -3, 19, 39, 59392 }, // ‍
+    { 10, 28, 0, -5, 21, 70, 59431 }, // ‎
+    { 10, 28, 0, -5, 21, 70, 59501 }, // ‏
+    { 9, 5, 11, 1, 10, 12, 59571 }, // ‐
+    { 9, 5, 11, 1, 10, 12, 59583 }, // ‑
+    { 14, 3, 18, 2, 11, 11, 59595 }, // ‒
+    { 15, 3, 15, 0, 9, 12, 59606 }, // –
+    { 29, 3, 29, 0, 9, 22, 59618 }, // —
+    { 29, 3, 29, 0, 9, 22, 59640 }, // ―
+    { 11, 30, 15, 2, 23, 83, 59662 }, // ‖
+    { 15, 8, 15, 0, -1, 30, 59745 }, // ‗
+    { 6, 10, 7, 1, 22, 15, 59775 }, // ‘
+    { 7, 10, 7, 0, 22, 18, 59790 }, // ’
+    { 7, 10, 7, 0, 4, 18, 59808 }, // ‚
+    { 6, 10, 7, 1, 22, 15, 59826 }, // ‛
+    { 12, 10, 13, 1, 22, 30, 59841 }, // “
+    { 12, 10, 13, 0, 22, 30, 59871 }, // ”
+    { 12, 10, 13, 0, 4, 30, 59901 }, // „
+    { 12, 10, 13, 1, 22, 30, 59931 }, // ‟
+    { 14, 19, 14, 0, 21, 67, 59961 }, // †
+    { 14, 23, 14, 0, 21, 81, 60028 }, // ‡
+    { 7, 7, 9, 1, 11, 13, 60109 }, // •
+    { 10, 10, 18, 4, 15, 25, 60122 }, // ‣
+    { 6, 6, 8, 1, 5, 9, 60147 }, // ․
+    { 13, 6, 15, 1, 5, 20, 60156 }, // ‥
+    { 25, 6, 29, 2, 5, 38, 60176 }, // …
+    { 6, 6, 8, 1, 11, 9, 60214 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 60223 }, //  
+    { 0, 0, 0, 0, 0, 0, 60223 }, //  
+    { 10, 28, 0, -5, 21, 70, 60223 }, // ‪
+    { 10, 28, 0, -5, 21, 70, 60293 }, // ‫
+    { 10, 27, 0, -5, 20, 68, 60363 }, // ‬
+    { 12, 28, 0, -6, 21, 84, 60431 }, // ‭
+    { 12, 28, 0, -6, 21, 84, 60515 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 60599 }, //  
+    { 39, 24, 40, 1, 22, 234, 60599 }, // ‰
+    { 8, 11, 8, 0, 21, 22, 60833 }, // ′
+    { 14, 11, 14, 0, 21, 39, 60855 }, // ″
+    { 20, 11, 21, 0, 21, 55, 60894 }, // ‴
+    { 8, 11, 8, 0, 21, 22, 60949 }, // ‵
+    { 13, 11, 15, 1, 21, 36, 60971 }, // ‶
+    { 19, 11, 21, 1, 21, 53, 61007 }, // ‷
+    { 13, 6, 14, 1, 0, 20, 61060 }, // ‸
+    { 9, 12, 10, 0, 13, 27, 61080 }, // ‹
+    { 8, 12, 10, 1, 13, 24, 61107 }, // ›
+    { 18, 20, 18, 0, 19, 90, 61131 }, // ※
+    { 14, 23, 17, 2, 22, 81, 61221 }, // ‼
+    { 15, 4, 15, 0, 25, 15, 61302 }, // ‾
+    { 7, 5, 9, 1, 10, 9, 61317 }, // ⁃
+    { 15, 25, 5, -5, 22, 94, 61326 }, // ⁄
+    { 25, 23, 27, 1, 22, 144, 61440 }, // ⁇
+    { 21, 23, 22, 1, 22, 121, 61584 }, // ⁈
+    { 19, 23, 22, 2, 22, 110, 61705 }, // ⁉
+    { 17, 7, 29, 6, 12, 30, 61815 }, // ⁓
+    { 27, 11, 27, 0, 21, 75, 61845 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 61920 }, //  
+    { 0, 0, 0, 0, 0, 0, 61920 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 61920 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 61920 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 61920 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 61920 }, // ⁤
+    { 13, 14, 13, 0, 24, 46, 61920 }, // ⁰
+    { 13, 14, 13, 0, 24, 46, 61966 }, // ⁴
+    { 11, 14, 13, 1, 24, 39, 62012 }, // ⁵
+    { 11, 14, 13, 1, 24, 39, 62051 }, // ⁶
+    { 11, 14, 13, 1, 24, 39, 62090 }, // ⁷
+    { 11, 14, 13, 1, 24, 39, 62129 }, // ⁸
+    { 11, 14, 13, 1, 24, 39, 62168 }, // ⁹
+    { 13, 11, 16, 2, 21, 36, 62207 }, // ⁿ
+    { 13, 15, 13, 0, 10, 49, 62243 }, // ₀
+    { 10, 14, 13, 1, 10, 35, 62292 }, // ₁
+    { 11, 14, 13, 1, 10, 39, 62327 }, // ₂
+    { 11, 15, 13, 1, 10, 42, 62366 }, // ₃
+    { 13, 15, 13, 0, 10, 49, 62408 }, // ₄
+    { 11, 14, 13, 1, 9, 39, 62457 }, // ₅
+    { 11, 15, 13, 1, 10, 42, 62496 }, // ₆
+    { 11, 14, 13, 1, 9, 39, 62538 }, // ₇
+    { 11, 15, 13, 1, 10, 42, 62577 }, // ₈
+    { 11, 15, 13, 1, 10, 42, 62619 }, // ₉
+    { 16, 20, 18, 1, 20, 80, 62661 }, // ₣
+    { 18, 22, 18, 0, 21, 99, 62741 }, // ₤
+    { 39, 22, 39, 0, 21, 215, 62840 }, // ₧
+    { 18, 22, 18, 0, 21, 99, 63055 }, // €
+    { 19, 14, 29, 5, 17, 67, 63154 }, // ←
+    { 13, 20, 29, 8, 20, 65, 63221 }, // ↑
+    { 19, 14, 29, 5, 17, 67, 63286 }, // →
+    { 13, 20, 29, 8, 20, 65, 63353 }, // ↓
+    { 19, 14, 29, 5, 17, 67, 63418 }, // ↔
+    { 13, 20, 29, 8, 20, 65, 63488 }, // ↕
+    { 15, 20, 29, 7, 20, 75, 63553 }, // ↨
+    { 13, 20, 29, 8, 20, 65, 63628 }, // ↲
+    { 13, 20, 29, 8, 20, 65, 63693 }, // ↳
+    { 17, 16, 29, 6, 18, 68, 63758 }, // ↵
+    { 19, 16, 29, 5, 18, 76, 63826 }, // ⇐
+    { 17, 18, 29, 6, 19, 77, 63902 }, // ⇑
+    { 19, 16, 29, 5, 18, 76, 63979 }, // ⇒
+    { 17, 18, 29, 6, 19, 77, 64055 }, // ⇓
+    { 19, 16, 29, 5, 18, 76, 64132 }, // ⇔
+    { 21, 22, 29, 4, 21, 116, 64208 }, // ∀
+    { 16, 24, 18, 1, 23, 96, 64324 }, // ∂
+    { 15, 21, 29, 7, 21, 79, 64420 }, // ∃
+    { 23, 24, 29, 3, 22, 138, 64499 }, // ∅
+    { 20, 21, 20, 0, 21, 105, 64637 }, // ∆
+    { 19, 22, 29, 5, 21, 105, 64742 }, // ∇
+    { 21, 21, 29, 4, 21, 111, 64847 }, // ∈
+    { 21, 26, 29, 4, 23, 137, 64958 }, // ∉
+    { 21, 18, 29, 4, 19, 95, 65095 }, // ∊
+    { 21, 21, 29, 4, 21, 111, 65190 }, // ∋
+    { 21, 26, 29, 4, 23, 137, 65301 }, // ∌
+    { 21, 18, 29, 4, 19, 95, 65438 }, // ∍
+    { 23, 26, 24, 1, 21, 150, 65536 }, // ∏
+    { 19, 26, 19, 0, 21, 124, 65686 }, // ∑
+    { 14, 4, 18, 2, 12, 14, 65810 }, // −
+    { 15, 23, 15, 0, 21, 87, 65824 }, // ∕
+    { 15, 23, 15, 0, 21, 87, 65911 }, // ∖
+    { 14, 14, 18, 2, 17, 49, 65998 }, // ∗
+    { 12, 11, 18, 3, 15, 33, 66047 }, // ∘
+    { 6, 6, 18, 6, 11, 9, 66080 }, // ∙
+    { 19, 28, 18, -1, 24, 133, 66089 }, // √
+    { 14, 12, 18, 2, 15, 42, 66222 }, // ∝
+    { 18, 11, 18, 0, 15, 50, 66264 }, // ∞
+    { 19, 21, 29, 5, 21, 100, 66314 }, // ∟
+    { 23, 21, 29, 3, 21, 121, 66414 }, // ∠
+    { 5, 30, 15, 5, 23, 38, 66535 }, // ∣
+    { 11, 30, 15, 2, 23, 83, 66573 }, // ∥
+    { 21, 21, 29, 4, 21, 111, 66656 }, // ∧
+    { 21, 21, 29, 4, 21, 111, 66767 }, // ∨
+    { 17, 21, 29, 6, 21, 90, 66878 }, // ∩
+    { 17, 22, 29, 6, 21, 94, 66968 }, // ∪
+    { 16, 30, 18, 1, 23, 120, 67062 }, // ∫
+    { 19, 18, 29, 5, 17, 86, 67182 }, // ∴
+    { 19, 18, 29, 5, 17, 86, 67268 }, // ∵
+    { 7, 16, 9, 1, 18, 28, 67354 }, // ∶
+    { 19, 18, 29, 5, 17, 86, 67382 }, // ∷
+    { 17, 7, 29, 6, 12, 30, 67468 }, // ∼
+    { 17, 17, 29, 6, 18, 73, 67498 }, // ≅
+    { 14, 12, 18, 2, 16, 42, 67584 }, // ≈
+    { 17, 12, 29, 6, 14, 51, 67626 }, // ≍
+    { 14, 15, 18, 2, 17, 53, 67677 }, // ≠
+    { 17, 15, 29, 6, 16, 64, 67730 }, // ≡
+    { 14, 18, 18, 2, 18, 63, 67794 }, // ≤
+    { 14, 18, 18, 2, 18, 63, 67857 }, // ≥
+    { 25, 14, 29, 2, 17, 88, 67920 }, // ≪
+    { 25, 14, 29, 2, 17, 88, 68008 }, // ≫
+    { 21, 18, 29, 4, 19, 95, 68096 }, // ⊃
+    { 21, 26, 29, 4, 23, 137, 68191 }, // ⊄
+    { 21, 26, 29, 4, 23, 137, 68328 }, // ⊅
+    { 19, 21, 29, 5, 21, 100, 68465 }, // ⊆
+    { 19, 21, 29, 5, 21, 100, 68565 }, // ⊇
+    { 21, 22, 29, 4, 21, 116, 68665 }, // ⊕
+    { 21, 22, 29, 4, 21, 116, 68781 }, // ⊖
+    { 21, 22, 29, 4, 21, 116, 68897 }, // ⊗
+    { 21, 22, 29, 4, 21, 116, 69013 }, // ⊘
+    { 17, 21, 29, 6, 21, 90, 69129 }, // ⊥
+    { 6, 6, 18, 6, 11, 9, 69219 }, // ⋅
+    { 25, 6, 29, 2, 11, 38, 69228 }, // ⋯
+    { 27, 28, 29, 1, 24, 189, 69266 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_boldIntervals[] = {
@@ -5084,4 +3133,9 @@ static const EpdFontData bookerly_14_bold = {
     31,
     -8,
     true,
+    bookerly_14_boldBlockOffsets,
+    bookerly_14_boldDirectGlyphs,
+    bookerly_14_boldGlyphPages,
+    256,
+    bookerly_14_boldPageGlyphs,
 };
@@ -2,4449 +2,2493 @@
  * generated by fontconvert.py
  * name: bookerly_14_bolditalic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_14_bolditalic 14 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_14_bolditalic 14 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_bolditalicBitmaps[70972] = {
-    0x00, 0x1A, 0x40, 0x2F, 0xD0, 0x0F, 0xF0, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x80,
-    0x1F, 0xD0, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xF8, 0x00, 0x3D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x1F,
-    0xC0, 0x01, 0x40, 0x00, 0x02, 0xD0, 0xB8, 0x3F, 0x4F, 0xD2, 0xFC, 0x7F, 0x0B, 0xF2, 0xFC, 0x3F,
-    0x8B, 0xE0, 0xFD, 0x3F, 0x43, 0xF0, 0xFC, 0x0F, 0x83, 0xF0, 0x7D, 0x0F, 0x80, 0x40, 0x10, 0x00,
-    0x00, 0x05, 0x50, 0x15, 0x00, 0x00, 0xFD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x01, 0xFC,
-    0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x5B, 0xF5, 0x7F, 0x54, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x02, 0xAF, 0xEA, 0xFE, 0xA4, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0xFE, 0x3E, 0xFD, 0x02, 0xF8, 0x3C, 0xBE, 0x03, 0xF4, 0x78, 0x3D, 0x03, 0xFC,
-    0xB4, 0x38, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x2D, 0x0B, 0x8F, 0xF0, 0xBE, 0x0F,
-    0x0B, 0xF0, 0xFF, 0x0F, 0x0B, 0xF0, 0xBF, 0x5E, 0x1F, 0xD0, 0x3F, 0xFE, 0xBF, 0xC0, 0x1F, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0x0B, 0xF5, 0xFC, 0x00, 0x3F, 0x80, 0x01, 0xFC,
-    0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x3F,
-    0x40, 0x00, 0x7F, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0xFC, 0x00, 0x00, 0x7F,
-    0x03, 0xF4, 0x3F, 0x00, 0xA9, 0x07, 0xF4, 0xBF, 0x0B, 0xD0, 0xBF, 0xFC, 0x3F, 0xFF, 0xC1, 0xF8,
-    0x3F, 0xEF, 0xE0, 0xBF, 0xE0, 0x3F, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x07, 0xF0,
-    0x00, 0x02, 0xF4, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x7E, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x0F, 0xC0,
-    0x3F, 0x40, 0xFE, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x3F, 0x83, 0xF8,
-    0x00, 0x1F, 0xC0, 0x02, 0xFE, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3E, 0x00,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x7F,
-    0x40, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x0C, 0x00, 0x1F, 0xDF, 0xE0, 0x00, 0xBD,
-    0x00, 0x1F, 0xFE, 0x00, 0x6F, 0xFC, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xF4, 0x02, 0xFF, 0xE0, 0x3F,
-    0xFE, 0x00, 0x0B, 0xFB, 0xF0, 0x3E, 0xFC, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x82,
-    0xFC, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0xFF, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0xBF, 0xCF, 0xD0, 0x00,
-    0x7F, 0x40, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x02, 0xFF, 0xFD, 0x1F, 0xFF, 0xF4, 0x00, 0x05,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x02, 0xD0, 0xFD, 0x2F, 0xC2, 0xFC,
-    0x3F, 0x83, 0xF4, 0x3F, 0x03, 0xE0, 0x7D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xBD, 0x01, 0xE2, 0xF4, 0x0F, 0xDB, 0x80, 0x2F,
-    0xFD, 0xA4, 0x07, 0xFF, 0xE1, 0xBF, 0xEF, 0x8F, 0xEF, 0x40, 0x2E, 0x2F, 0x00, 0x10, 0xBC, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x2A,
-    0xBF, 0xEA, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0x3F, 0x40, 0x3F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x06, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xC7, 0xFC, 0x7F, 0x41,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x2F, 0xE0, 0x03, 0xFD, 0x07, 0xFC,
-    0x00, 0x3F, 0xE0, 0xFF, 0x40, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x3F, 0xD2, 0xFE, 0x00, 0x03, 0xFD,
-    0x3F, 0xD0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00,
-    0x0F, 0xF4, 0xBF, 0xC0, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x0B, 0xFC, 0x03,
-    0xFF, 0x02, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x02, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0,
-    0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0,
-    0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0,
-    0x00, 0x6F, 0xFE, 0x41, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0x41, 0xFF,
-    0x80, 0xFF, 0x00, 0x3F, 0xE0, 0x3F, 0x00, 0x0F, 0xF8, 0x01, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x41, 0xFF, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x0F,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x2E, 0xAF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF,
-    0xF8, 0x06, 0xAF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x1F, 0xDB, 0xF0, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x1F, 0xD0, 0xFD, 0x00, 0x1F, 0xD0,
-    0x7F, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x1F, 0xD0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x7F, 0xD5, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x02, 0xFD, 0x55, 0x50, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x16, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x1F, 0xFE, 0x40, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0xA8, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFD, 0x07, 0xFF, 0x00, 0xBF, 0x80, 0x0F,
-    0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0xBF,
-    0x80, 0x1F, 0xF0, 0x07, 0xFD, 0x03, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xAA, 0xAF, 0xFC, 0x7F, 0x00, 0x1F, 0xF0, 0xBD, 0x00,
-    0x7F, 0xC0, 0x3C, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xAF, 0xF8, 0x02,
-    0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4,
-    0x02, 0xFF, 0x4F, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFD, 0xFF, 0xD0, 0x0F, 0xF8, 0x0B, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x43, 0xFC, 0x00,
-    0x2F, 0xD0, 0xFF, 0x00, 0x0B, 0xF4, 0x3F, 0xE0, 0x0B, 0xFC, 0x0B, 0xFF, 0xAF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xD0, 0x7F, 0xD0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF,
-    0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x0F, 0xF4, 0x01, 0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xBF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x02, 0xFE, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7F, 0x40, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00, 0x0B, 0xF0, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFD, 0x00,
-    0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xE4, 0x00, 0xBF, 0xE0, 0x00,
-    0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x20, 0x7F, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA,
-    0xA8, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x80, 0x06, 0xFF, 0x80, 0x07,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x2F, 0xFF, 0x43, 0xFF, 0xFC, 0x3F, 0xBF, 0xD2, 0x40, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF5, 0x00,
-    0x7F, 0xF4, 0x03, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x07, 0xF8, 0x00, 0xBF,
-    0x80, 0x0B, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xEF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x7F, 0x40, 0x1F, 0x86, 0x80, 0xFE, 0x03, 0xF8, 0x03,
-    0xFF, 0xFF, 0x02, 0xF8, 0x2F, 0xC0, 0x3F, 0xEF, 0xF8, 0x07, 0xE0, 0xFD, 0x02, 0xFC, 0x0F, 0xC0,
-    0x2F, 0x87, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x2F, 0x80, 0xBF, 0x00, 0xF8, 0x03, 0xF4, 0xFD,
-    0x03, 0xF4, 0x0B, 0xD0, 0x0F, 0xC3, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x0F, 0xC0, 0x3F, 0x02,
-    0xFC, 0x07, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0xF0, 0x7F, 0x40, 0xFC, 0x03, 0xFF, 0xF7, 0xEF, 0xF8,
-    0x03, 0xF4, 0x0B, 0xFF, 0x1F, 0xFF, 0x40, 0x0F, 0xE0, 0x0B, 0xE0, 0x2F, 0xD0, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0xFF, 0xE5, 0x05, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD,
-    0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00,
-    0x0B, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFD, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3A, 0xFF, 0x4B, 0xFE, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00,
-    0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0x0F, 0xF4,
-    0x0F, 0xF0, 0x00, 0x3F, 0xFA, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xD0, 0x3F, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x1F,
-    0xF0, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x1F, 0xFA, 0xAF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xAA, 0xFE, 0x00, 0xFF, 0xE0, 0x02, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0xD0, 0x00,
-    0x3E, 0x02, 0xFE, 0x00, 0x00, 0x50, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x60, 0x2F, 0xFC, 0x00, 0x0B,
-    0xC0, 0x3F, 0xFE, 0x56, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x94, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0xFF, 0x9B, 0xFF, 0xE0, 0x00,
-    0x0F, 0xF0, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x02, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x03, 0xFC, 0x00, 0x03, 0xFD,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xBF,
-    0xC0, 0x0F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F,
-    0xE0, 0x02, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00,
-    0x1F, 0x40, 0x00, 0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04,
-    0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4,
-    0x00, 0x1F, 0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x07, 0xFF, 0xAA, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xF8, 0x00,
-    0x07, 0xFC, 0x00, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFA,
-    0xA9, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD4, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00,
-    0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0xAB, 0xFD, 0x00, 0xFF,
-    0xD0, 0x00, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0xF4, 0x0B, 0xFC, 0x00,
-    0x00, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x01, 0xAA, 0xAA, 0x3F, 0xE0, 0x02, 0xFF, 0xFE, 0x3F, 0xF0, 0x01, 0xBF, 0xFC,
-    0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x0F,
-    0xFF, 0x40, 0x1F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xD0, 0x7F,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00,
-    0x00, 0x0B, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xEF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x3F,
-    0xF8, 0x00, 0x01, 0xFF, 0x90, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x90, 0x07, 0xFC,
-    0x00, 0x3E, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x0F, 0xF8, 0x00, 0xFD, 0x01, 0xFF, 0xEB, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xE0, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x0F, 0xEF, 0xC0, 0x00, 0x0B, 0xDB, 0xF0, 0x2F, 0x7F,
-    0xC0, 0x00, 0x0F, 0xCB, 0xF0, 0x3E, 0x3F, 0xC0, 0x00, 0x0F, 0xC7, 0xF4, 0xFC, 0x3F, 0xC0, 0x00,
-    0x2F, 0x83, 0xF9, 0xF8, 0x3F, 0xC0, 0x00, 0x3F, 0x43, 0xFB, 0xF0, 0x3F, 0x80, 0x00, 0x3F, 0x03,
-    0xFF, 0xE0, 0x7F, 0x80, 0x00, 0x7E, 0x02, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0xFD, 0x02, 0xFF, 0x40,
-    0x7F, 0x80, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0xBF, 0x40,
-    0x02, 0xF8, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x50, 0x01, 0xFF, 0xD0, 0x3F, 0xFF,
-    0x40, 0x00, 0x1F, 0xFF, 0xF4, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF4, 0x00,
-    0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x02,
-    0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x3F,
-    0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7, 0xFD, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0xFF, 0x82, 0xF8,
-    0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00, 0x00, 0xBE, 0x03, 0xFE, 0x3F, 0x00, 0x00, 0x3F, 0x40,
-    0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xF8, 0x00,
-    0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0x90, 0x01,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x07, 0xFD,
-    0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x00, 0x1F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x83,
-    0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFB, 0xFE, 0x6F, 0xFC, 0x00, 0x03,
-    0xFC, 0x0B, 0xFD, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x0B, 0xF8,
-    0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x7F,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xEA, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x0B,
-    0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x3F,
-    0xF0, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x00, 0x7F,
-    0xD0, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40,
-    0x7F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x03, 0xAF, 0xF4, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x00,
-    0xFF, 0x40, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x0B,
-    0xFC, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xD0,
-    0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x1F, 0xFC,
-    0x00, 0x1F, 0xF9, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x3F, 0xFD, 0x3F, 0xFF, 0xF0, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xC0, 0x0F, 0xC0,
-    0x1F, 0xF0, 0x03, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0xF4, 0x00, 0xBF, 0xC0, 0x7D, 0x00, 0x1F, 0xF0, 0x2F, 0x80, 0x07, 0xFC, 0x0F, 0xF4,
-    0x03, 0xFE, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0xFF, 0xAB, 0xFC, 0x3F, 0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF,
-    0x01, 0xF4, 0x3E, 0x02, 0xFE, 0x02, 0xF0, 0x18, 0x03, 0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xE0,
-    0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xF8,
-    0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF,
-    0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F,
-    0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x07,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xC3, 0xFF, 0xFE, 0x00, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xF4, 0x00,
-    0x00, 0x01, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x07,
-    0xC0, 0x1F, 0xFF, 0xDF, 0xFF, 0xF8, 0x03, 0xF0, 0x07, 0xFF, 0xF0, 0x7F, 0xE0, 0x01, 0xFD, 0x00,
-    0x2F, 0xE0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x07, 0xF0,
-    0x00, 0xBF, 0x80, 0x3F, 0xF4, 0x03, 0xF8, 0x00, 0x2F, 0xE0, 0x1F, 0xFD, 0x01, 0xFC, 0x00, 0x0B,
-    0xF8, 0x0F, 0xFF, 0x80, 0xFE, 0x00, 0x01, 0xFE, 0x07, 0xEF, 0xE0, 0x7F, 0x00, 0x00, 0x7F, 0x83,
-    0xF3, 0xF8, 0x3F, 0x80, 0x00, 0x0F, 0xE1, 0xF8, 0xBE, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0xFC, 0x2F,
-    0x8F, 0xE0, 0x00, 0x00, 0xFF, 0x7E, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xEF, 0x41, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFF,
-    0x00, 0xBF, 0x40, 0x00, 0x01, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xF0,
-    0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xFF, 0xD0, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC1,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40,
-    0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x4F,
-    0xE0, 0x00, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x7F, 0xAA, 0xAF, 0xFD, 0x02, 0xF8, 0x00, 0xBF, 0xE0, 0x0B, 0xC0, 0x07, 0xFE, 0x00, 0x1F,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x64, 0x00, 0xBF, 0xD0, 0x03, 0xF0, 0x0B, 0xFE,
-    0x00, 0x1F, 0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0x03, 0xFF, 0xAA, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0xAA, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xFC, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFC, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBD,
-    0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF4, 0x1F, 0xC0, 0x07, 0xF0,
-    0x0F, 0xD0, 0x0B, 0xE0, 0x0B, 0xE0, 0x0F, 0xD0, 0x07, 0xF0, 0x2F, 0xC0, 0x03, 0xF8, 0x2F, 0x80,
-    0x02, 0xF8, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0xBD, 0x0F, 0xF0, 0x7F, 0xC1, 0xFD, 0x03, 0xF0, 0x08, 0x00, 0x01, 0x50,
-    0x05, 0x00, 0x07, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFE, 0x7F, 0xF0, 0x03, 0xFC,
-    0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0x40,
-    0x3F, 0xC3, 0xEF, 0xEB, 0x8F, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F,
-    0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x05, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0xFE, 0x01, 0x40, 0x01, 0xFC, 0x2F, 0xF4, 0x01, 0xFC, 0xFF, 0xFC, 0x02, 0xFA,
-    0xFF, 0xFC, 0x03, 0xFB, 0xC3, 0xFD, 0x03, 0xFF, 0x02, 0xFD, 0x07, 0xFD, 0x03, 0xFC, 0x0B, 0xFC,
-    0x03, 0xFC, 0x0F, 0xF4, 0x03, 0xFC, 0x0F, 0xF0, 0x07, 0xF8, 0x0F, 0xE0, 0x0F, 0xF0, 0x2F, 0xD0,
-    0x1F, 0xE0, 0x3F, 0xD0, 0x3F, 0xC0, 0x3F, 0xFA, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x00, 0x7E, 0xBF,
-    0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xD0, 0x07, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFE, 0x03, 0xFC, 0x07, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x28, 0x3F, 0xF0, 0x7F,
-    0x0F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x16, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x05, 0x43, 0xF8,
-    0x00, 0x1F, 0xFE, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0F, 0xF0, 0x0F,
-    0xE0, 0x0B, 0xF4, 0x03, 0xF4, 0x03, 0xFC, 0x01, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00,
-    0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F, 0xF4, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0xFF,
-    0x0F, 0xBF, 0xAE, 0x3F, 0xFF, 0xCF, 0xFF, 0x8B, 0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x40,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x1F,
-    0xD2, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xC0, 0xBF, 0x02, 0xFC, 0x2F, 0xC0,
-    0x3F, 0xEF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE4, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x3F, 0xC0,
-    0x7F, 0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xF0, 0xBD, 0x00, 0x00, 0x00, 0xFE, 0x02, 0x40, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xAF, 0xFA, 0x90, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x2F,
-    0x4B, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0xFE, 0x50, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x9B,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFA, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x2F, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0xFF,
-    0x00, 0x02, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x16, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x05, 0x40, 0x01, 0xFD, 0x1F, 0xF8, 0x00, 0xBF,
-    0x2F, 0xFF, 0x00, 0x2F, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0x4B, 0xF0, 0x03, 0xFF, 0x43, 0xFC, 0x01,
-    0xFF, 0x80, 0xFE, 0x00, 0xBF, 0xC0, 0x7F, 0x40, 0x3F, 0xD0, 0x2F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x07, 0xF8, 0x03, 0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0xFF, 0x40, 0xBF, 0x5D, 0x3F, 0xC0, 0x3F,
-    0xFF, 0x4F, 0xF0, 0x0F, 0xFF, 0x87, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x0F, 0xF4, 0x07, 0xFD, 0x00, 0xFF, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x2F, 0xF8, 0x3F, 0xFF, 0x05, 0xBF, 0x80, 0x1F, 0xD0, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00,
-    0xBF, 0x40, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFD, 0x74, 0xBF, 0xFD, 0x2F, 0xFE, 0x07,
-    0xFD, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x5F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x24, 0x0B, 0xF4, 0x00, 0x7E, 0x6F, 0xE0, 0x00,
-    0xBF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0x6F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x50, 0x01, 0xFC, 0x2F, 0xF0, 0x07, 0xF3,
-    0xFF, 0xE0, 0x2F, 0xBE, 0x7F, 0xC0, 0xFF, 0xD0, 0xBE, 0x03, 0xFD, 0x03, 0xF4, 0x1F, 0xE0, 0x2F,
-    0xC0, 0xBF, 0x02, 0xFC, 0x03, 0xFE, 0xFF, 0x80, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xBF, 0x40, 0x02,
-    0xFC, 0xBF, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x3F, 0xC1, 0xFF, 0xE4, 0xFE, 0x02, 0xFF, 0xE7, 0xF4,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x40, 0x00, 0x05, 0x01, 0xFF, 0xE0, 0xFF, 0xFC, 0x16, 0xFE, 0x00,
-    0x7F, 0x40, 0x2F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF8, 0x02, 0xFD,
-    0x00, 0xFF, 0x6C, 0x3F, 0xFF, 0x0F, 0xFF, 0x82, 0xFF, 0x40, 0x04, 0x00, 0x00, 0x54, 0x00, 0x50,
-    0x00, 0x50, 0x07, 0xFF, 0x42, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0xC0, 0x5B,
-    0xF7, 0xFF, 0xF7, 0xFF, 0xF4, 0x01, 0xFF, 0xE1, 0xFF, 0xD2, 0xFC, 0x00, 0x7F, 0xF0, 0xBF, 0xE0,
-    0xFF, 0x00, 0x2F, 0xF0, 0x3F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x1F, 0xE0, 0x03, 0xFC,
-    0x07, 0xFC, 0x0B, 0xF4, 0x01, 0xFE, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0xFE,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F, 0x40, 0x0F, 0xF0, 0x1F, 0xE0, 0x2F, 0xD7, 0x47, 0xF8, 0x0B,
-    0xF4, 0x0B, 0xFF, 0xD2, 0xFD, 0x02, 0xFC, 0x02, 0xFF, 0xF0, 0xFF, 0x00, 0xFE, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x01, 0xFF, 0xE0, 0xBF, 0xD0,
-    0x3F, 0xFE, 0x3F, 0xFF, 0x01, 0x6F, 0xEF, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0xFF, 0x00, 0x1F, 0xFC,
-    0x0F, 0xE0, 0x02, 0xFF, 0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0x7F, 0x80, 0x7F, 0x80, 0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF2, 0xC1, 0xFE, 0x00, 0xFF, 0xFC, 0x2F, 0xD0, 0x0F, 0xFF, 0x43, 0xFC, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0xBF, 0xDB, 0xFD, 0x07, 0xF8, 0x0B, 0xFC, 0x3F, 0xC0, 0x1F, 0xF1, 0xFE, 0x00, 0x3F, 0xCB, 0xF4,
-    0x00, 0xFF, 0x3F, 0xC0, 0x07, 0xF8, 0xFF, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x07,
-    0xF8, 0x3F, 0xD0, 0x7F, 0xC0, 0xBF, 0xEB, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x40, 0x02, 0xFF, 0xC1, 0xFF, 0x80, 0x0F, 0xFF,
-    0x5F, 0xFF, 0x40, 0x16, 0xFE, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0x47, 0xF8, 0x00, 0x2F, 0xF4, 0x1F,
-    0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x0B, 0xF4, 0x00,
-    0x7F, 0x40, 0x3F, 0xC0, 0x02, 0xFC, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0x80,
-    0xBF, 0x80, 0x01, 0xFF, 0xEF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xF4, 0x00,
-    0x00, 0xFE, 0x04, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xAA, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x07,
-    0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x40,
-    0xBF, 0x40, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD,
-    0x00, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xC3, 0xEF, 0xC0, 0x0F, 0xFF, 0xE7, 0xF0, 0x02, 0xFF, 0xF2,
-    0xF8, 0x00, 0x3F, 0xE0, 0xFE, 0x00, 0x00, 0x40, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x02, 0xAA, 0xA8, 0x00, 0x00, 0x14, 0x01, 0x40, 0x7F, 0xF8, 0x3F, 0xC3, 0xFF, 0xE3, 0xFF, 0x05,
-    0x7F, 0x6F, 0xFC, 0x00, 0xFD, 0xFE, 0xD0, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xD5, 0xFC, 0x02, 0xFC,
-    0x02, 0x40, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x01, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFF, 0xAF,
-    0xD0, 0x2F, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x06, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC2,
-    0xAF, 0xFA, 0x90, 0x0B, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x01, 0xC0, 0x3F, 0xD6, 0xF4,
-    0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x05, 0x01, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01,
-    0xFC, 0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F,
-    0x80, 0x0B, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD,
-    0x0B, 0xFF, 0x04, 0x2F, 0xC2, 0xF7, 0xF7, 0xC2, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF,
-    0x00, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0xBF, 0xD0,
-    0x3F, 0xD7, 0xFF, 0xC0, 0xFF, 0x9A, 0xFF, 0x01, 0xFF, 0x03, 0xFD, 0x03, 0xF8, 0x07, 0xF4, 0x1F,
-    0xD0, 0x1F, 0xE0, 0x7F, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0xFE, 0x0F, 0xC0, 0x03, 0xFC, 0xBE, 0x00,
-    0x0B, 0xF3, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x05, 0x02,
-    0xFF, 0x01, 0xFD, 0x03, 0xFC, 0xBF, 0xF8, 0x0F, 0xF0, 0x2F, 0xD5, 0xBF, 0xC0, 0xBF, 0x01, 0xFE,
-    0x03, 0xFC, 0x07, 0xF4, 0x0F, 0xD0, 0x1F, 0xD0, 0x7F, 0x80, 0xFC, 0x00, 0xFD, 0x0B, 0xF8, 0x1F,
-    0xC0, 0x0F, 0xE0, 0xFF, 0xC2, 0xF4, 0x00, 0xFE, 0x1F, 0xFC, 0x3F, 0x00, 0x0B, 0xE3, 0xFF, 0xC7,
-    0xE0, 0x00, 0xBF, 0x7D, 0xFC, 0xFC, 0x00, 0x07, 0xFF, 0x8F, 0xEF, 0x40, 0x00, 0x7F, 0xF0, 0xFF,
-    0xE0, 0x00, 0x07, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x00, 0x03, 0xE0, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x40, 0x1F, 0xF4, 0x03,
-    0xFE, 0x07, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xFD, 0x2F, 0xFD, 0x00, 0x1F, 0xE7, 0xE0, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00, 0x25, 0xBE,
-    0x3F, 0xC0, 0x03, 0xFF, 0xC2, 0xFF, 0xF8, 0x7F, 0xF0, 0x1F, 0xFF, 0x43, 0xFC, 0x00, 0xBF, 0xD0,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00,
-    0x1F, 0xFF, 0x02, 0xFE, 0x00, 0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00,
-    0x7F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F,
-    0x83, 0xF4, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08,
-    0x01, 0xFD, 0x00, 0x00, 0x2F, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x07, 0xFF, 0x47, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFD, 0x07, 0xD0, 0x7F, 0xD0, 0x1F, 0x00, 0xFD, 0x00, 0x14,
-    0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0xB4, 0x0F, 0xF9, 0x47, 0xF0, 0xFF, 0xFF, 0xFF, 0xC7, 0xFB, 0xFF, 0xFD,
-    0x0F, 0xC1, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0xFF, 0xF0, 0x00, 0xBF, 0xE8, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0xFF, 0xF0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01,
-    0xFC, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0x2B, 0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xD0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x02,
-    0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0x80,
-    0x2E, 0x3F, 0xFF, 0x47, 0xFF, 0xFB, 0xFF, 0xFE, 0xFC, 0x0B, 0xFF, 0xC2, 0x80, 0x1B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0B,
-    0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0x80,
-    0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x02, 0xFD, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x7F, 0x90, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xBD, 0xFC, 0x0B, 0xF8, 0xB8, 0x14, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC0, 0xF0,
-    0x00, 0x3F, 0xC1, 0xF0, 0x00, 0x3F, 0x82, 0xE0, 0x00, 0x3F, 0x83, 0xD0, 0x00, 0x3F, 0x83, 0xC0,
-    0x00, 0x3F, 0xC7, 0xC0, 0xB0, 0x2F, 0xFB, 0x87, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x2F,
-    0xC0, 0x1E, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xBF, 0xEA, 0xA4, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x53, 0xF8, 0x00, 0x16, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xD1, 0xBF, 0xFF, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0xB8,
-    0x05, 0x50, 0x7C, 0x0B, 0xEB, 0xFF, 0xEF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x47, 0xFC,
-    0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x03, 0xF4, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x0B, 0xFF, 0xBF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xBD, 0x1F, 0xE4, 0x7E, 0x02, 0x00, 0x00, 0x01, 0x80, 0x7F, 0xFF, 0xC1, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x6F, 0xFD, 0x00, 0xBF, 0xE0, 0x0F, 0xF8, 0x00, 0xBF, 0x00, 0x07, 0xFC, 0x01,
-    0xFD, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x02, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x1F, 0xC0,
-    0x00, 0x1A, 0xFF, 0x3F, 0xE8, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x7F, 0xF9, 0x54, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03,
-    0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F,
-    0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x07, 0xFA, 0xFF, 0x00, 0x3F, 0x00, 0xFC,
-    0x03, 0xFC, 0x02, 0xE0, 0x1F, 0xF4, 0x00, 0x00, 0xF3, 0xF4, 0x00, 0x03, 0xC7, 0xF4, 0x00, 0x0F,
-    0x07, 0xF8, 0x00, 0x3E, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFC, 0x00, 0xFD, 0x03, 0xF4, 0x01, 0xFE,
-    0x03, 0xE0, 0x01, 0xFF, 0x0B, 0xC0, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0x78, 0x00, 0x00, 0xFE,
-    0xD0, 0x3C, 0x01, 0xFF, 0x03, 0xF0, 0x07, 0xF8, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7D, 0xBF, 0x0F, 0xFF,
-    0xF1, 0xFD, 0x78, 0x0B, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0x90, 0x5B, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x2E,
-    0x00, 0xB4, 0x02, 0xFF, 0x40, 0xB4, 0x0F, 0x01, 0xFF, 0xFC, 0x03, 0xC2, 0xD0, 0x3F, 0x07, 0xC0,
-    0x2C, 0x3C, 0x0B, 0xC0, 0x38, 0x01, 0xE3, 0xC0, 0xFC, 0x00, 0x00, 0x0E, 0x38, 0x0F, 0xC0, 0x00,
-    0x00, 0xF3, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0x3C, 0x0F, 0xC0, 0x00, 0x00, 0xE3, 0xC0, 0xFE, 0x00,
-    0x00, 0x1E, 0x2D, 0x07, 0xFE, 0x6C, 0x02, 0xC0, 0xE0, 0x2F, 0xFF, 0xC0, 0x3C, 0x0B, 0x40, 0x6F,
-    0xE0, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF9,
-    0x01, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x19,
-    0x14, 0x01, 0xFF, 0xFC, 0x07, 0xFB, 0xF8, 0x0F, 0xC1, 0xF0, 0x1F, 0x42, 0xF0, 0x2F, 0x03, 0xE0,
-    0x3E, 0x0B, 0xD0, 0x3F, 0x1F, 0xC9, 0x3F, 0xFF, 0xFD, 0x1F, 0xF3, 0xF8, 0x05, 0x40, 0x50, 0x00,
-    0x00, 0x10, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xE0, 0x15, 0x54, 0x00, 0x00, 0x1E, 0x00, 0x38, 0x00,
-    0xBF, 0x01, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x1F, 0xF0, 0x3F, 0xD0, 0x7F, 0xC0, 0xFF, 0x40, 0xBF,
-    0x41, 0xFE, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x0F, 0xE0, 0x3F, 0xC0, 0x07,
-    0xF4, 0x0F, 0xE0, 0x00, 0xF4, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x47, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x69, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x2E, 0x00, 0x2E,
-    0x00, 0x2D, 0x00, 0x01, 0xD0, 0x0D, 0x3F, 0xF4, 0x2C, 0x0B, 0x07, 0x8F, 0x03, 0x83, 0x80, 0xE2,
-    0xD0, 0xB0, 0xD0, 0x3D, 0xF0, 0x2C, 0x34, 0x0F, 0xF0, 0x0B, 0x0E, 0x03, 0xEE, 0x02, 0xC3, 0xC1,
-    0xF3, 0xE0, 0xE0, 0x70, 0xFE, 0x3D, 0x74, 0x0F, 0x00, 0x00, 0x38, 0x00, 0xF4, 0x00, 0x7C, 0x00,
-    0x0B, 0xEA, 0xF8, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x3F, 0xFF, 0xDB, 0xFF, 0xFD, 0xBF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xFE, 0x0F, 0xFB, 0xFD, 0x7F, 0x02, 0xF9, 0xF4, 0x03,
-    0xFB, 0xD0, 0x0F, 0xDF, 0xC0, 0xBE, 0x3F, 0xEF, 0xF0, 0x7F, 0xFF, 0x40, 0x6F, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD2, 0xAB, 0xFE, 0xA9, 0x00, 0x2F, 0x80,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x97, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE0, 0x01, 0xFF, 0xFC, 0x03, 0xFA, 0xFE, 0x07, 0xD0, 0x7E, 0x02, 0x40, 0xBE, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x0F, 0xFF, 0xC0,
-    0xBE, 0x7F, 0x42, 0xC0, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0xF8, 0x00, 0xFB, 0xF4,
-    0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x01, 0xFC, 0x2A, 0xFF, 0xD0, 0xFF, 0xF8, 0x00, 0x69, 0x00,
-    0x00, 0x01, 0x00, 0x3D, 0x0F, 0xE1, 0xFD, 0x3F, 0x8B, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x50, 0x00, 0x1F, 0xD0, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x7F, 0x40,
-    0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x01,
-    0xFE, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x5F, 0xFF, 0x0D, 0x03, 0xFF,
-    0xFF, 0x7F, 0xFD, 0x03, 0xFF, 0xFD, 0x2F, 0xF8, 0x07, 0xEF, 0xF4, 0x0F, 0xE0, 0x0B, 0xE0, 0x40,
-    0x01, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFF, 0x9F, 0x40, 0x00, 0x7F, 0xFF, 0x4F, 0x00, 0x00, 0xFF, 0xFF, 0x5F, 0x00, 0x01, 0xFF,
-    0xFF, 0x2E, 0x00, 0x02, 0xFF, 0xFF, 0x3E, 0x00, 0x02, 0xFF, 0xFE, 0x3D, 0x00, 0x02, 0xFF, 0xFD,
-    0x3C, 0x00, 0x02, 0xFF, 0xFC, 0x7C, 0x00, 0x01, 0xFF, 0xFC, 0xB8, 0x00, 0x00, 0xFF, 0xFC, 0xF8,
-    0x00, 0x00, 0x2E, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00,
-    0x00, 0x01, 0xF2, 0xF0, 0x00, 0x00, 0x02, 0xE3, 0xE0, 0x00, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x00,
-    0x03, 0xC7, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x00, 0x0F, 0xBF, 0x00, 0x00, 0x70, 0x3F,
-    0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x0F, 0xEB, 0xFF, 0xFD, 0x7E, 0x00, 0x00, 0x06, 0x80, 0x7F, 0xC0, 0x7F, 0x00,
-    0xF8, 0x0B, 0xC1, 0xFC, 0x06, 0x40, 0x00, 0x00, 0x1B, 0x41, 0xBF, 0xE0, 0xBF, 0xF4, 0x05, 0xFC,
-    0x00, 0x7F, 0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0x80,
-    0x7F, 0xFD, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0xBF, 0xF4, 0x02, 0xF9, 0xFC,
-    0x07, 0xE0, 0xBC, 0x0F, 0xC0, 0xBC, 0x1F, 0x80, 0xFC, 0x1F, 0x41, 0xF8, 0x1F, 0x43, 0xF4, 0x0F,
-    0xDF, 0xE0, 0x07, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x00, 0x10, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xD0, 0x15, 0x50, 0x00, 0x02, 0xD0, 0x07, 0x80, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x2F, 0xD0, 0x3F,
-    0x80, 0x03, 0xFD, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x0F, 0xF0, 0x2F, 0xD0, 0x0B, 0xF8,
-    0x1F, 0xF0, 0x0B, 0xF8, 0x1F, 0xF0, 0x0B, 0xF4, 0x1F, 0xE0, 0x0B, 0xF4, 0x1F, 0xE0, 0x01, 0xE0,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0,
-    0x00, 0xF8, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x0F,
-    0xF4, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0x42, 0xFF, 0xF4, 0x02, 0xF4, 0x00, 0xFA, 0xF0,
-    0x3F, 0xFF, 0x00, 0x7E, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC3, 0xE0, 0x00,
-    0x00, 0x03, 0xF4, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x15, 0x5F, 0xD4, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0xBF, 0xD0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0xFF, 0x40, 0x1F, 0x80,
-    0x01, 0xF8, 0x0F, 0xE6, 0xFC, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0xF4, 0x0F, 0xC2, 0xFF, 0xF4, 0x0F,
-    0xC0, 0x05, 0x01, 0xF8, 0x3F, 0xFF, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x95,
-    0x50, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD3, 0xF4,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x70, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x3A, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x02, 0xF4, 0x00,
-    0x3F, 0x80, 0x00, 0xBD, 0x00, 0x7D, 0x00, 0x0F, 0xF4, 0x00, 0x6F, 0xC0, 0x0F, 0x80, 0x03, 0xFF,
-    0x4B, 0xFF, 0xF0, 0x03, 0xF0, 0x00, 0xFA, 0xF0, 0xBF, 0xF8, 0x00, 0xBD, 0x00, 0x3E, 0x3F, 0x01,
-    0x50, 0x00, 0x1F, 0x80, 0x0F, 0xC3, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x7D, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x15, 0x5F, 0xD4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0xC0, 0x15, 0xFC, 0x00, 0x1F, 0x80, 0x07,
-    0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x14,
-    0xBF, 0xAF, 0xC3, 0xFF, 0xFC, 0x2F, 0xFF, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00,
-    0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x00,
-    0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE,
-    0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0B,
-    0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFC,
-    0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x78, 0x00, 0x00, 0x00,
-    0xBF, 0xFB, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x00,
-    0x02, 0xFD, 0x55, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x07, 0xF5, 0x55, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xC0, 0x02, 0xFC, 0x00, 0x01,
-    0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFE, 0x47, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x6F, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x90, 0x29, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x00,
-    0xBE, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xFD, 0x00, 0x00,
-    0x01, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x55, 0x7F, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFD, 0x55, 0x5B,
-    0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
-    0x02, 0xFF, 0x91, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xDB, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xAF, 0x40,
-    0x00, 0x00, 0x00, 0xB4, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xEB,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0x00,
-    0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x0B,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD,
-    0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0xAB, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x7F, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2F,
-    0x8B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0xFE, 0x5A, 0x90, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x40, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x00,
-    0x0B, 0x80, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3E, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x02,
-    0xF8, 0x00, 0x2F, 0xD0, 0x01, 0xBF, 0xEA, 0xFF, 0xD0, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xAA, 0xFE, 0x00, 0xFF, 0xE0, 0x02,
-    0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x3E, 0x02, 0xFE, 0x00, 0x00, 0x50, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x60, 0x2F, 0xFC, 0x00, 0x0B, 0xC0, 0x3F, 0xFE, 0x56, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xBD, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFA,
-    0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0xC0,
-    0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x5A,
-    0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00, 0x0B,
-    0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E,
-    0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00,
-    0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF2, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0x2F, 0x00, 0x00, 0x02, 0xD0, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00,
-    0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF,
-    0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE,
-    0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x06, 0x80, 0x64, 0x00, 0x00, 0x07, 0xF4, 0xBF, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00,
-    0xBE, 0x0F, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xAA, 0xBF, 0x80, 0x00, 0x3F, 0xC0, 0x07, 0xE0, 0x00, 0x1F, 0xF0, 0x01, 0xF4, 0x00, 0x07, 0xFC,
-    0x00, 0x78, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE5,
-    0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x40, 0x00, 0x1F, 0xF0, 0x00,
-    0xB8, 0x00, 0x0B, 0xF8, 0x00, 0x3E, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xEB, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x2F, 0xC0, 0x7D, 0x00, 0x1E,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0x80, 0x68, 0x00, 0x0F,
-    0xE1, 0xFD, 0x00, 0x2F, 0xE3, 0xFD, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x6A, 0x94, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0xFF, 0x9B, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x07,
-    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x02, 0xFE, 0x00,
-    0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xC2, 0xFF, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x0F, 0xF4,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x02, 0xFE,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFB,
-    0xE0, 0x00, 0x00, 0x00, 0x3E, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x01, 0xFF,
-    0xE0, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x0B, 0xE0,
-    0x00, 0x07, 0xFF, 0xF0, 0x03, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0xFF,
-    0xC0, 0x7F, 0x00, 0x00, 0x3F, 0x5F, 0xF4, 0x2F, 0xC0, 0x00, 0x1F, 0xC3, 0xFE, 0x0B, 0xE0, 0x00,
-    0x0B, 0xF0, 0x7F, 0xC3, 0xF4, 0x00, 0x02, 0xF8, 0x0F, 0xF8, 0xFC, 0x00, 0x00, 0xFD, 0x02, 0xFF,
-    0x7F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0xE0, 0x00, 0x0B,
-    0xF0, 0x00, 0xFF, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFE, 0x40, 0x07, 0xFF,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC,
-    0x00, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFA,
-    0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00,
-    0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC, 0x00, 0x00,
-    0x7F, 0xD3, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xCF, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0xFC,
-    0x00, 0x00, 0x0B, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFA, 0xFF, 0xF0,
-    0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0x2F, 0xF4,
-    0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0x7F, 0xD3,
-    0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3C, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0x00, 0x00,
-    0x03, 0xF7, 0xFF, 0x40, 0x00, 0x00, 0x70, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xEB, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x2F, 0xF8, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x7F, 0xD0,
-    0x00, 0x07, 0xFE, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x7F, 0xD3, 0xFF, 0x00,
-    0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x0F, 0xFC, 0x00,
-    0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x01,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x02, 0x90, 0x00, 0x00, 0x1F,
-    0xD3, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x10,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xAF, 0xFF, 0x00, 0x0F, 0xFD, 0x00,
-    0xBF, 0xE0, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00,
-    0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x3F, 0xF0, 0x00, 0x01,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x24, 0x1F, 0x80,
-    0x2F, 0x4B, 0xF8, 0x2F, 0xE0, 0xBF, 0xAF, 0xE0, 0x0B, 0xFF, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0x1F,
-    0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x1F, 0xF0, 0xFF, 0x4B, 0xF0, 0x0F, 0xE0, 0xB0,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9,
-    0x00, 0x34, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x02, 0xFF, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x7E,
-    0x3F, 0xE0, 0x0B, 0xFC, 0x01, 0xF8, 0x3F, 0xD0, 0x0F, 0xF8, 0x07, 0xE0, 0x3F, 0xD0, 0x0F, 0xF8,
-    0x1F, 0x80, 0x7F, 0xD0, 0x0F, 0xF8, 0x7D, 0x00, 0xBF, 0xC0, 0x0F, 0xFA, 0xF4, 0x00, 0xFF, 0x80,
-    0x0F, 0xFF, 0xD0, 0x01, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0xBC, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xE0, 0x00,
-    0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00,
-    0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00,
-    0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0,
-    0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x07, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00,
-    0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00,
-    0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF,
-    0x41, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0xBC, 0x00, 0x00, 0x02, 0xE0, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00,
-    0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00,
-    0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0,
-    0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x06, 0x80, 0x00, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xC0, 0x00,
-    0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F,
-    0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02,
-    0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
-    0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41,
-    0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40,
-    0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x4F,
-    0xE0, 0x00, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x1B, 0xFD, 0x00, 0x0F, 0xF4, 0x0F, 0xFC, 0x00, 0x3F, 0xC0,
-    0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xF4,
-    0x00, 0xFF, 0x40, 0xFF, 0x80, 0x03, 0xFD, 0x6F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0xBF,
-    0xFF, 0x90, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x81, 0xFE, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-    0x1F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40,
-    0x02, 0xFE, 0x00, 0x00, 0xBF, 0x04, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x1F, 0x01, 0xFC, 0x00, 0x00,
-    0xFE, 0x3F, 0xFB, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFC, 0x0F, 0xFF, 0x40,
-    0x00, 0x03, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x2E, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x9F,
-    0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x1F, 0xE0,
-    0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x40, 0x3F,
-    0xC0, 0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F, 0xF8,
-    0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x9F, 0xFC,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x1F, 0xE0, 0x0F,
-    0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x40, 0x3F, 0xC0,
-    0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F, 0xF8, 0x0F,
-    0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x07, 0xF0,
-    0x1F, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07,
-    0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02,
-    0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xF0,
-    0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xC3, 0xEF,
-    0xEB, 0x8F, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xD0, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x08, 0x00, 0x01, 0xFF, 0x4B, 0x80, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3C, 0x3F, 0xF0, 0x00, 0x06, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x14, 0x00, 0x1F, 0xFD, 0xBF, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x1F, 0xF9,
-    0xFF, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x03, 0xF8, 0x03, 0xFC, 0x01, 0xFD, 0x01, 0xFE,
-    0x00, 0xFF, 0x00, 0xBF, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F, 0xF4, 0x03,
-    0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0F, 0xBF, 0xAE, 0x3F, 0xFF, 0xCF, 0xFF, 0x8B, 0xFF, 0xC3, 0xFF,
-    0x80, 0xFF, 0x80, 0x7F, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x2F, 0x40, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x07, 0x80, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x14, 0x00, 0x1F, 0xFD, 0xBF, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x1F, 0xF9, 0xFF, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x03, 0xF8,
-    0x03, 0xFC, 0x01, 0xFD, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F,
-    0xE0, 0x0F, 0xF0, 0x1F, 0xF4, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0F, 0xBF, 0xAE, 0x3F, 0xFF,
-    0xCF, 0xFF, 0x8B, 0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0x43, 0xD0,
-    0x00, 0x03, 0xC0, 0xB4, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0x9F, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F,
-    0xC0, 0x1F, 0xD0, 0x1F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00,
-    0xFF, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF,
-    0xF8, 0xBF, 0xFC, 0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x15, 0x00, 0x00, 0x3F, 0xFE, 0x0B, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xE6, 0xFF, 0xD3, 0xFC, 0x03, 0xFC, 0x01, 0xFC, 0x0B, 0xF0, 0x2F, 0xD0, 0x0F, 0xD0, 0x3F,
-    0x80, 0xFF, 0x00, 0x7F, 0x02, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x2F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFB,
-    0xF8, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xFC, 0x07, 0xFF, 0x90, 0x00, 0x0F, 0xF0, 0x3F,
-    0xF8, 0x00, 0xB0, 0x3F, 0xC3, 0xEF, 0xF0, 0x1F, 0xC0, 0xFF, 0xFF, 0x2F, 0xFF, 0xFE, 0x02, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xD0, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xFC, 0x07,
-    0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x28, 0x3F, 0xF0, 0x7F, 0x0F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0x40, 0x1F, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x19, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x0B, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x01, 0xFD, 0x2F, 0xC0, 0x3F, 0x01, 0xFC, 0x0F,
-    0xE0, 0x3F, 0x80, 0xFC, 0x0B, 0xF0, 0x2F, 0xC2, 0xFC, 0x03, 0xFE, 0xFF, 0x00, 0x3F, 0xFF, 0x40,
-    0x03, 0xFE, 0x40, 0x00, 0x3F, 0x80, 0x0B, 0x03, 0xFC, 0x07, 0xF0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFD, 0x2F, 0xC0, 0x0F, 0xC0, 0x7F, 0x00, 0xFE, 0x03,
-    0xF8, 0x03, 0xF0, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC, 0x00, 0xFF, 0xBF, 0xC0, 0x03, 0xFF, 0xF4, 0x00,
-    0x0F, 0xF9, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0x00, 0xFF, 0x01, 0xFC, 0x02, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBD, 0xFC, 0x00, 0x1F, 0x83, 0xE0, 0x07, 0xE0, 0x2E,
-    0x00, 0x24, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F,
-    0xFF, 0xC0, 0x1F, 0xD2, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xC0, 0xBF, 0x02,
-    0xFC, 0x2F, 0xC0, 0x3F, 0xEF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE4, 0x00, 0x03, 0xF8, 0x00,
-    0xB0, 0x3F, 0xC0, 0x7F, 0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x03, 0xFC, 0xBF, 0x40, 0x0F,
-    0xE2, 0xFC, 0x00, 0x2D, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xD2, 0xFC, 0x00, 0xFC, 0x07, 0xF0,
-    0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x02, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x0F, 0xFB, 0xFC, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0xFF, 0x90, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x0F, 0xD0, 0x0F, 0xF0, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x3E, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x50, 0x2F, 0xF8, 0xFF, 0xFC, 0x5B, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x2F,
-    0xD0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x40, 0xBF, 0x5D, 0xBF, 0xFD, 0xBF, 0xF8, 0x7F, 0xD0, 0x04,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x80, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00,
-    0xBE, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xFF, 0x80, 0x3F,
-    0xFF, 0x00, 0x5B, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00,
-    0xBF, 0x40, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x02, 0xFD, 0x74, 0x0B, 0xFF, 0xD0,
-    0x2F, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x01, 0xFE, 0x00, 0x1F,
-    0xFC, 0x00, 0xFD, 0xF8, 0x0F, 0xC2, 0xF0, 0xFD, 0x03, 0xD1, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0xC0, 0x16, 0xFE, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0xFF, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00,
-    0xBF, 0x5D, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x03, 0xE1, 0xFD, 0x3F, 0xCB, 0xF0, 0xFE, 0x0A, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0xF0, 0x05, 0xBF, 0x80, 0x01, 0xFD, 0x00, 0x0B,
-    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x07,
-    0xF4, 0x00, 0x2F, 0xD7, 0x40, 0xBF, 0xFD, 0x02, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x70, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0B, 0x8F, 0xE0, 0x00, 0x01, 0x07, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFD, 0x07, 0xFC, 0x0F, 0xF4, 0x03, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x2F, 0xD0, 0x03, 0xFC,
-    0x3F, 0xC0, 0x03, 0xF8, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0,
-    0x3F, 0xE0, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x08, 0x00, 0x00, 0x7F, 0xD2, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x00, 0xF0, 0xFF, 0xC0, 0x00, 0x05, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x00, 0x1F, 0xFE, 0x0B, 0xFD, 0x03, 0xFF, 0xE3, 0xFF,
-    0xF0, 0x16, 0xFE, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x0F, 0xF0, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0x2F,
-    0xF0, 0x1F, 0xD0, 0x03, 0xFE, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF8, 0x07, 0xF8,
-    0x00, 0xBF, 0x40, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x2C, 0x1F, 0xE0,
-    0x0F, 0xFF, 0xC2, 0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x02, 0xFF, 0x6F,
-    0xF4, 0x1F, 0xE0, 0x2F, 0xF0, 0xFF, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0xFF, 0x2F, 0xD0, 0x03, 0xFC,
-    0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0xBF, 0x4F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x1F, 0xE0, 0xFF,
-    0x41, 0xFF, 0x02, 0xFF, 0xAF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xF0, 0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0,
-    0x03, 0xFC, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x3F, 0x01,
-    0xF0, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0x00, 0xBF, 0xDB, 0xFD, 0x07, 0xF8, 0x0B, 0xFC, 0x3F, 0xC0, 0x1F, 0xF1, 0xFE,
-    0x00, 0x3F, 0xCB, 0xF4, 0x00, 0xFF, 0x3F, 0xC0, 0x07, 0xF8, 0xFF, 0x00, 0x2F, 0xD3, 0xFC, 0x00,
-    0xFF, 0x0F, 0xF0, 0x07, 0xF8, 0x3F, 0xD0, 0x7F, 0xC0, 0xBF, 0xEB, 0xFC, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x08, 0x00, 0x03, 0xFD, 0x2E,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0x4F, 0xFC, 0x00, 0x06, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF0,
-    0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x03, 0xFC,
-    0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7D,
-    0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x07, 0x80, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF0,
-    0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x03, 0xFC,
-    0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x40, 0x10, 0x00, 0x07,
-    0xFF, 0xF2, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x00, 0x7F, 0x80, 0x7F,
-    0xC0, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0xFC, 0x00, 0xBF, 0x07, 0xDF, 0xF0, 0x03,
-    0xFC, 0x7C, 0x3F, 0x80, 0x0F, 0xFB, 0xC1, 0xFD, 0x00, 0x3F, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0x80,
-    0x7F, 0x80, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xFE, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0x4B, 0xFF, 0x80, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
-    0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB,
-    0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF,
-    0x03, 0xFF, 0xE0, 0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F,
-    0x7F, 0x7C, 0x2F, 0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x0B, 0xE1, 0xF8, 0x00, 0x01, 0xF8, 0x0B, 0x80, 0x00,
-    0x09, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x01, 0xFF, 0xD0, 0x0F,
-    0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x2F,
-    0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x0B, 0xF0, 0x0F, 0xF4,
-    0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD, 0x0B, 0xFF, 0x04, 0x2F, 0xC2,
-    0xF7, 0xF7, 0xC2, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0x80,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x0F,
-    0xF2, 0xFD, 0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x0B, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0,
-    0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F,
-    0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0x02, 0xFE, 0x00, 0x16, 0xFF,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0x81,
-    0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x2F, 0xC7, 0xF0,
-    0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xAF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x05, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xFD, 0x01, 0x40, 0x00, 0x07, 0xF0, 0xBF, 0xD0, 0x00, 0x2F, 0xCF, 0xFF,
-    0xC0, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x03, 0xFB, 0xC3, 0xFC, 0x00, 0x1F, 0xFC, 0x0F, 0xF0, 0x00,
-    0x7F, 0xD0, 0x3F, 0xC0, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x1F, 0xD0, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
-    0x00, 0xFF, 0xEB, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xEF, 0xF8, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x01, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x82, 0xF4, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00,
-    0x00, 0x3F, 0x87, 0xF4, 0x00, 0x00, 0x1E, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF,
-    0x02, 0xFE, 0x00, 0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41,
-    0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4,
-    0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD,
-    0x00, 0x00, 0x2F, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBE, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x8F, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x01,
-    0xFE, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xD5, 0x5F, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0x55, 0x56, 0xFE, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xE4,
-    0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xF6, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
-    0x9F, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x1F,
-    0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x40,
-    0x3F, 0xC0, 0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F,
-    0xF8, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x28, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x1F,
-    0xE0, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x55, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xF5, 0x55, 0x6F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0xC0, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFE, 0x47,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x6F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x03, 0x40, 0x00, 0xFE, 0x0B, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x14, 0x00, 0x1F, 0xFD,
-    0xBF, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x1F, 0xF9, 0xFF, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4,
-    0x03, 0xF8, 0x03, 0xFC, 0x01, 0xFD, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x7F, 0xC0, 0x3F,
-    0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F, 0xF4, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0F, 0xBF, 0xAE,
-    0x3F, 0xFF, 0xCF, 0xFF, 0x8B, 0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x40, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80,
-    0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00,
-    0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40,
-    0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD,
-    0x00, 0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xC3, 0xEF, 0xEB, 0x8F, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0,
-    0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x00, 0x40, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xAA, 0xFE, 0x00, 0xFF, 0xE0,
-    0x02, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x3E, 0x02, 0xFE, 0x00, 0x00, 0x50,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x60, 0x2F, 0xFC, 0x00, 0x0B, 0xC0, 0x3F, 0xFE, 0x56, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xF0, 0x1C, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x0A, 0x00, 0xFF, 0xC1, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x02, 0xFC,
-    0x0B, 0xC0, 0x00, 0x0B, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xAA, 0xFE, 0x00, 0xFF,
-    0xE0, 0x02, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x3E, 0x02, 0xFE, 0x00, 0x00,
-    0x50, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x60, 0x2F, 0xFC, 0x00, 0x0B, 0xC0, 0x3F, 0xFE, 0x56, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0xBD, 0xFC, 0x00, 0x1F, 0x83, 0xE0, 0x07, 0xE0, 0x2E, 0x00, 0x24, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x03, 0xFC,
-    0x07, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0xA0, 0x3F, 0xF0, 0x7F, 0x03, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xEA, 0xBF,
-    0x80, 0x3F, 0xF8, 0x00, 0xBD, 0x02, 0xFF, 0x00, 0x03, 0xF0, 0x0F, 0xF4, 0x00, 0x0F, 0x80, 0xBF,
-    0x80, 0x00, 0x14, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x18, 0x0B, 0xFF, 0x00, 0x02, 0xF0, 0x0F, 0xFF,
-    0x95, 0xBF, 0x80, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xE0,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x0F, 0xF0, 0x1C, 0x0B, 0xF0, 0x00,
-    0x03, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0xA0, 0xFF, 0xC1, 0xFC, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xB8, 0x00, 0x00,
-    0xBD, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0xAB, 0xF8,
-    0x00, 0xFF, 0xE0, 0x02, 0xF4, 0x02, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xE0, 0x0B,
-    0xF8, 0x00, 0x01, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0x80, 0x2F, 0xFC, 0x00, 0x0B,
-    0xC0, 0x0F, 0xFF, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x03, 0xE0, 0x02, 0xF0, 0x3F, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xF0, 0x1C, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x0A, 0x00, 0xFF, 0xC1, 0xFC, 0x03, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8,
-    0xBE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x94, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0xFF, 0x9B, 0xFF, 0xE0, 0x00, 0x0F,
-    0xF0, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x02,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0xC0,
-    0x0F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0,
-    0x02, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xF8, 0x3E, 0x00, 0x00, 0x0F, 0xFF,
-    0xC7, 0xE0, 0x00, 0x00, 0x5B, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x15, 0x0F, 0xE0, 0x40, 0x00, 0x1F, 0xFE,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x3F, 0x80, 0x00, 0x0B, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xE0,
-    0x0F, 0xF0, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x03, 0xFC,
-    0x07, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xD0, 0x00, 0x03, 0xFC, 0x3E, 0xFE, 0xB8, 0x00, 0x3F,
-    0xFF, 0xCF, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x94, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0xFF, 0x9B, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x07, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xC2, 0xFF, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x02, 0xFE, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x6F,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF9, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFE,
-    0xFF, 0xC0, 0x00, 0xFF, 0x40, 0xFE, 0x00, 0x07, 0xF8, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0x1F, 0xC0,
-    0x01, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0xFF,
-    0x01, 0xFF, 0x40, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0x0F, 0xF0, 0xFB, 0xFA, 0xE0, 0x3F, 0xFF, 0xCF,
-    0xFF, 0x80, 0xBF, 0xFC, 0x3F, 0xF8, 0x00, 0xFF, 0x80, 0x7F, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0xAA, 0xFE, 0x00,
-    0x00, 0xFF, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xC0, 0x07, 0xD0, 0x00, 0x1F, 0xF0, 0x01, 0xE0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x96, 0xA4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x7F, 0xC0, 0x02, 0xE0, 0x00, 0x2F,
-    0xE0, 0x00, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xFD, 0x00, 0x07, 0xFF, 0xAF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFD, 0x2F, 0xC0, 0x0F, 0xC0, 0x7F, 0x00, 0xFE,
-    0x03, 0xF8, 0x03, 0xF0, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC, 0x00, 0xFF, 0xBF, 0xC0, 0x03, 0xFF, 0xF4,
-    0x00, 0x0F, 0xF9, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0x00, 0xFF, 0x01, 0xFC, 0x02, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x03, 0xD0, 0x0B, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x7D,
-    0x00, 0x01, 0xFF, 0x00, 0x1E, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xF9, 0x6A, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x10, 0x00,
-    0x07, 0xFC, 0x00, 0x2E, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x40, 0x0F, 0xD0, 0x00,
-    0x7F, 0xFA, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0xB8, 0x01, 0xC0, 0x03, 0xF8, 0x6F, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xD2, 0xFC, 0x00, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80,
-    0x3F, 0x02, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x0F, 0xFB, 0xFC, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xFF,
-    0x90, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xEA, 0xAF, 0xE0, 0x00, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x7D, 0x00, 0x01, 0xFF,
-    0x00, 0x1E, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF9,
-    0x6A, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x10, 0x00, 0x07, 0xFC, 0x00,
-    0x2E, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F, 0xFA, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x01,
-    0xFD, 0x2F, 0xC0, 0x3F, 0x01, 0xFC, 0x0F, 0xE0, 0x3F, 0x80, 0xFC, 0x0B, 0xF0, 0x2F, 0xC2, 0xFC,
-    0x03, 0xFE, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xFE, 0x40, 0x00, 0x3F, 0x80, 0x0B, 0x03, 0xFC,
-    0x07, 0xF0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0x80, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40,
-    0x00, 0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01,
-    0xFF, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F,
-    0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xD2,
-    0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xC0, 0xBF, 0x02, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xEF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE4, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x3F, 0xC0, 0x7F,
-    0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0B, 0x80, 0x00,
-    0x02, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F,
-    0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00,
-    0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x03, 0xE0, 0x02, 0xF0, 0x3F, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFD, 0x2F, 0xC0, 0x0F, 0xC0,
-    0x7F, 0x00, 0xFE, 0x03, 0xF8, 0x03, 0xF0, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC, 0x00, 0xFF, 0xBF, 0xC0,
-    0x03, 0xFF, 0xF4, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0x00, 0xFF, 0x01, 0xFC, 0x02,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0xF8, 0x00, 0x00, 0x78,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0xAB, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0xFC,
-    0x02, 0xFF, 0x00, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x40, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x01, 0xAA, 0xAA, 0x3F, 0xE0, 0x02, 0xFF, 0xFE, 0x3F, 0xF0, 0x01, 0xBF, 0xFC, 0x3F, 0xF0, 0x00,
-    0x0F, 0xF4, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0x40, 0x1F,
-    0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x47, 0xD0, 0x00, 0x00,
-    0xBD, 0x03, 0xD0, 0x00, 0x00, 0x24, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0xFE,
-    0x50, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00,
-    0x00, 0xBF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x9B, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0xFA, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x2F,
-    0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x34, 0x00, 0x00, 0x2F, 0x92, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0xAB, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0xFC, 0x02, 0xFF, 0x00, 0x00,
-    0xFC, 0x03, 0xFD, 0x00, 0x00, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xAA, 0xAA, 0x3F,
-    0xE0, 0x02, 0xFF, 0xFE, 0x3F, 0xF0, 0x01, 0xBF, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xF4,
-    0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0x40, 0x1F, 0xE0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x3D, 0x00, 0x70, 0x00, 0x00, 0x3F, 0x46, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0xFE, 0x50, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x9B, 0xF8,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x0F,
-    0xFA, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x2F, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00,
-    0x02, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00,
-    0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0xAB, 0xFD, 0x00, 0xFF,
-    0xD0, 0x00, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0xF4, 0x0B, 0xFC, 0x00,
-    0x00, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x01, 0xAA, 0xAA, 0x3F, 0xE0, 0x02, 0xFF, 0xFE, 0x3F, 0xF0, 0x01, 0xBF, 0xFC,
-    0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x0F,
-    0xFF, 0x40, 0x1F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0xFE, 0x50, 0x00,
-    0x7F, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0xBF,
-    0x02, 0xFD, 0x00, 0x00, 0x3F, 0x9B, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0xFA, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x2F, 0xFC, 0x00,
-    0xFF, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0xA9, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE,
-    0xAB, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x00,
-    0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xAA, 0xAA, 0x3F, 0xE0, 0x02, 0xFF, 0xFE, 0x3F,
-    0xF0, 0x01, 0xBF, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xFC,
-    0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0x40, 0x1F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0xFE, 0x50,
-    0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00,
-    0xBF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x9B, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0xFA, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x2F, 0xFC,
-    0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F,
-    0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x02, 0xFD, 0xFC, 0x00, 0x02, 0xF8, 0x1F, 0x40, 0x00, 0xF4, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x5B, 0xFC,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xE0, 0x15, 0x00, 0x07, 0xF4, 0x7F, 0xE0, 0x02, 0xFC, 0xBF, 0xFC, 0x00, 0xBF, 0xBF, 0xFF, 0x40,
-    0x3F, 0xFD, 0x2F, 0xC0, 0x0F, 0xFD, 0x0F, 0xF0, 0x07, 0xFE, 0x03, 0xF8, 0x02, 0xFF, 0x01, 0xFD,
-    0x00, 0xFF, 0x40, 0xBF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xE0, 0x0B, 0xF4, 0x07,
-    0xF4, 0x03, 0xFD, 0x02, 0xFD, 0x74, 0xFF, 0x00, 0xFF, 0xFD, 0x3F, 0xC0, 0x3F, 0xFE, 0x1F, 0xD0,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xAF, 0xFA, 0xAA, 0xAF, 0xFA, 0x40,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x17, 0xFF, 0x55, 0x57, 0xFE, 0x50, 0x00, 0x0F, 0xF4,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x16, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0xF4, 0x00, 0xBF, 0x1F, 0xFF, 0x00,
-    0x3F, 0xDF, 0xFF, 0xD0, 0x0F, 0xEF, 0x8F, 0xF0, 0x03, 0xFF, 0x43, 0xFC, 0x01, 0xFF, 0x80, 0xFF,
-    0x00, 0xBF, 0xC0, 0x7F, 0x80, 0x3F, 0xE0, 0x2F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xFC, 0x03,
-    0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0xBF, 0x5D, 0x3F, 0xC0, 0x3F, 0xFF, 0x4F, 0xF0,
-    0x0F, 0xFF, 0x87, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x07, 0xF8, 0x2C, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0x6F, 0xFC, 0x00, 0x0D, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x01, 0xA0, 0x14, 0x0F, 0xFC,
-    0x3C, 0x1F, 0xFF, 0xFC, 0x2E, 0x2F, 0xF4, 0x08, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x5B, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80,
-    0x00, 0x7F, 0x40, 0x00, 0xBF, 0x5D, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xF8, 0x00, 0x7F, 0xD0, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF,
-    0xE1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xFF, 0x80, 0x3F, 0xFF,
-    0x00, 0x5B, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF,
-    0x40, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x02, 0xFD, 0x74, 0x0B, 0xFF, 0xD0, 0x2F,
-    0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x0F, 0x80, 0x1C,
-    0x00, 0x0F, 0xD1, 0xBC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x01, 0x00, 0x04, 0x3C, 0x00, 0xA1, 0xFD, 0x1F,
-    0x43, 0xFF, 0xFC, 0x07, 0xFF, 0x80, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2F, 0xF8,
-    0x03, 0xFF, 0xF0, 0x05, 0xBF, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
-    0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xD7, 0x40, 0xBF,
-    0xFD, 0x02, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xF4, 0x07, 0xFD, 0x00, 0xFF, 0x00, 0x19,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xF8, 0x3F, 0xFF, 0x05, 0xBF, 0x80, 0x1F, 0xD0, 0x0B, 0xF0,
-    0x03, 0xFC, 0x00, 0xFE, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFD, 0x74,
-    0xBF, 0xFD, 0x2F, 0xFE, 0x07, 0xFD, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0x0F, 0xC0, 0x03,
-    0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFD, 0x00,
-    0x00, 0x50, 0x2F, 0xF8, 0xFF, 0xFC, 0x5B, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0,
-    0x2F, 0xD0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x40, 0xBF, 0x5D, 0xBF, 0xFD, 0xBF, 0xF8, 0x7F, 0xD0,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0x80, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0F,
-    0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x1F, 0xC0, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x1F,
-    0xE0, 0x01, 0x90, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x05, 0x40, 0x2F,
-    0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF0, 0x3F, 0xFE, 0x05, 0xBF, 0x80, 0x5B, 0xF4, 0x01, 0xFD, 0x00,
-    0x2F, 0xD0, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x0F, 0xF0,
-    0x0B, 0xF4, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x07, 0xF4,
-    0x00, 0x3F, 0xC0, 0x2F, 0xD7, 0x41, 0xFE, 0x00, 0xBF, 0xFD, 0x0B, 0xF4, 0x02, 0xFF, 0xE0, 0x3F,
-    0xC0, 0x07, 0xFD, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xAF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x02, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xF8,
-    0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x0B, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0D, 0x07,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x00, 0x0A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x07,
-    0xE0, 0x2E, 0x00, 0x00, 0x24, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x24, 0x0B, 0xF4, 0x00,
-    0x07, 0xE6, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x1B, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8,
-    0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x01,
-    0xFF, 0x90, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0x6F, 0xF0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x50, 0x01,
-    0xFC, 0x2F, 0xF0, 0x07, 0xF3, 0xFF, 0xE0, 0x2F, 0xBE, 0x7F, 0xC0, 0xFF, 0xD0, 0xBE, 0x03, 0xFD,
-    0x03, 0xF4, 0x1F, 0xE0, 0x2F, 0xC0, 0xBF, 0x02, 0xFC, 0x03, 0xFE, 0xFF, 0x80, 0x0F, 0xFF, 0xD0,
-    0x00, 0x7F, 0xBF, 0x40, 0x02, 0xFC, 0xBF, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x3F, 0xC1, 0xFF, 0xE4,
-    0xFE, 0x02, 0xFF, 0xE7, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x14, 0x1F, 0xFD, 0x01, 0xFE, 0x3F, 0xFE,
-    0x0B, 0xFF, 0x16, 0xFD, 0x1F, 0xFE, 0x01, 0xFC, 0x7F, 0x58, 0x01, 0xFC, 0xF8, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x0B, 0xF3,
-    0xF4, 0x00, 0x0F, 0xF1, 0xFC, 0x04, 0x0F, 0xE0, 0xFF, 0x5E, 0x1F, 0xD0, 0xBF, 0xFD, 0x2F, 0xD0,
-    0x3F, 0xF8, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x01, 0x90, 0x07, 0xFC, 0x00, 0x3E, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x0F, 0xF8, 0x00, 0xFD, 0x01,
-    0xFF, 0xEB, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xE0, 0x01, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x05, 0xBF, 0x80, 0x00, 0x7F,
-    0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xDB, 0x00, 0x3F, 0xFF,
-    0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x90, 0x07, 0xFC,
-    0x00, 0x3E, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x0F, 0xF8, 0x00, 0xFD, 0x01, 0xFF, 0xEB, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x1F, 0xFE, 0x03, 0xFF, 0xF0, 0x16, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0,
-    0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x0B, 0xF4, 0x00, 0xFF, 0x6C, 0x0F,
-    0xFF, 0xC0, 0xFF, 0xF8, 0x0B, 0xFD, 0x00, 0x04, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xD0,
-    0x00, 0xFC, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xFC, 0x7E, 0x00, 0x3F,
-    0xFF, 0xF2, 0xF0, 0x00, 0x1F, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0xD0, 0x3C, 0x00, 0x01, 0xFF, 0x00,
-    0x50, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x90, 0x01, 0xFF, 0x00, 0x0F,
-    0x80, 0x0B, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0xE0, 0x03, 0xF4, 0x01, 0xFF, 0xEB, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x01, 0x40, 0x7F, 0xF8, 0x3E,
-    0x0F, 0xFF, 0xC7, 0xE0, 0x5B, 0xF8, 0xBD, 0x00, 0x7F, 0x4F, 0xC0, 0x0B, 0xF0, 0xF4, 0x00, 0xFF,
-    0x0F, 0x00, 0x0F, 0xF0, 0x40, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0xB0, 0x00, 0x3F,
-    0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x7C, 0x00, 0x0F, 0xF4, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x01, 0xFF, 0x00,
-    0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xA0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x19, 0x00, 0x1F, 0xF0, 0x00, 0xF8, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x03, 0xFE,
-    0x00, 0x3F, 0x40, 0x1F, 0xFE, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x5B, 0xF8, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x0F, 0x80, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x7F, 0xC0, 0x7F,
-    0x43, 0xF4, 0x0B, 0xF0, 0x14, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x03, 0xFD, 0xB0, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x86, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xF9, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0xFB, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x90, 0x07, 0xFC, 0x00, 0x3E, 0x00, 0xBF, 0xC0,
-    0x07, 0xE0, 0x0F, 0xF8, 0x00, 0xFD, 0x01, 0xFF, 0xEB, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x40, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0x6F, 0xE0,
-    0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0xBF, 0xBC, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0x3F, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF6, 0xC0,
-    0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF,
-    0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF,
-    0xE0, 0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0x00,
-    0x00, 0x3F, 0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7, 0xFD, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0xFF,
-    0x82, 0xF8, 0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00, 0x00, 0xBE, 0x03, 0xFE, 0x3F, 0x00, 0x00,
-    0x3F, 0x40, 0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x02, 0xFF,
-    0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F,
-    0x90, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x05, 0x00, 0x1F, 0xFE, 0x0B, 0xFD, 0x03, 0xFF, 0xE3, 0xFF, 0xF0, 0x16, 0xFE,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x0F, 0xF0, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0x2F, 0xF0, 0x1F, 0xD0,
-    0x03, 0xFE, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0xBF, 0x40,
-    0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x2C, 0x1F, 0xE0, 0x0F, 0xFF, 0xC2,
-    0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF4,
-    0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-    0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0x00, 0x00,
-    0x3F, 0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7, 0xFD, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0xFF, 0x82,
-    0xF8, 0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00, 0x00, 0xBE, 0x03, 0xFE, 0x3F, 0x00, 0x00, 0x3F,
-    0x40, 0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xF8,
-    0x00, 0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0x90,
-    0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x01, 0xFF, 0xE0, 0xBF, 0xD0, 0x3F, 0xFE, 0x3F, 0xFF,
-    0x01, 0x6F, 0xEF, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0xFF, 0x00, 0x1F, 0xFC, 0x0F, 0xE0, 0x02, 0xFF,
-    0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x7F, 0x80,
-    0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF2, 0xC1, 0xFE, 0x00,
-    0xFF, 0xFC, 0x2F, 0xD0, 0x0F, 0xFF, 0x43, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xC0, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xF0,
-    0x00, 0x03, 0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x3F, 0x00, 0x00, 0x3F, 0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7, 0xFD, 0x0B, 0xF0, 0x00,
-    0x07, 0xF0, 0xFF, 0x82, 0xF8, 0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00, 0x00, 0xBE, 0x03, 0xFE,
-    0x3F, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x07,
-    0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x7F, 0x90, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xFF,
-    0x40, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x00, 0x1F, 0xFE, 0x0B, 0xFD, 0x03, 0xFF, 0xE3, 0xFF,
-    0xF0, 0x16, 0xFE, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x0F, 0xF0, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0x2F,
-    0xF0, 0x1F, 0xD0, 0x03, 0xFE, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF8, 0x07, 0xF8,
-    0x00, 0xBF, 0x40, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x2C, 0x1F, 0xE0,
-    0x0F, 0xFF, 0xC2, 0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x50, 0x01, 0x50, 0x07, 0xF0, 0xBF, 0xE0, 0xBF, 0xD0, 0x3E, 0x0F,
-    0xFF, 0x8F, 0xFF, 0xC0, 0x00, 0x15, 0xFE, 0xBF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC3, 0xFC, 0x00,
-    0x00, 0x1F, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0x40, 0x00, 0x03, 0xFE, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0x80, 0x00, 0x02, 0xFD, 0x01,
-    0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xCB, 0x00, 0x00, 0xFF,
-    0x00, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xC0, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F,
-    0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x3F, 0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7,
-    0xFD, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0xFF, 0x82, 0xF8, 0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00,
-    0x00, 0xBE, 0x03, 0xFE, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F,
-    0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0x90, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F,
-    0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x50, 0x1F, 0xFE, 0x0B, 0xFD, 0x3F, 0xFE, 0x3F, 0xFF, 0x16, 0xFE, 0xFF, 0xFF, 0x01, 0xFF,
-    0xF0, 0xFF, 0x01, 0xFF, 0xC0, 0xFE, 0x02, 0xFF, 0x01, 0xFD, 0x03, 0xFE, 0x02, 0xFD, 0x03, 0xFC,
-    0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x0B, 0xF4, 0x07, 0xF8, 0x0F, 0xF0, 0x0B, 0xF4, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x1F, 0xE0, 0x0F, 0xF0, 0x2F, 0xD0, 0x1F, 0xD0, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x80, 0xFF, 0x00, 0x02, 0xF6, 0xFD, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xAE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0xBF, 0xFC, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x3F,
-    0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x47, 0xFD,
-    0x00, 0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xC0,
-    0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xE0,
-    0x1F, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B, 0xFC,
-    0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8,
-    0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0,
-    0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x28, 0x00, 0x00, 0x07, 0xF4, 0x7D, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xEB, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x2F, 0xF8, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x7F,
-    0xD0, 0x00, 0x07, 0xFE, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x7F, 0xD3, 0xFF,
-    0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x0F, 0xFC,
-    0x00, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x0F, 0xFE,
-    0x01, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xC0,
-    0x0D, 0x00, 0x0B, 0xE0, 0xBC, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0xF0, 0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x03,
-    0xFC, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x2C, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xC7, 0xFD, 0x00,
-    0x00, 0x7F, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x7F, 0x40, 0x00, 0x00, 0xD0, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xEB, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x1F,
-    0xF4, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x82, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xF0, 0x00, 0x01,
-    0xFF, 0x43, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x80, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x03, 0xF8, 0xFE, 0x00,
-    0x02, 0xF8, 0xBF, 0x00, 0x01, 0xF8, 0x7F, 0x00, 0x00, 0xF8, 0x2E, 0x00, 0x00, 0x04, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0x6F, 0xF4, 0x01, 0xFE, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0x80,
-    0x0F, 0xF0, 0x2F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF4, 0x1F, 0xF0, 0x02, 0xFF, 0xAF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x6B, 0xFE, 0xAA, 0xFD, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0x00,
-    0x2F, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xD0, 0x02, 0xD0,
-    0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x01, 0xFF, 0x56, 0xA0, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x03,
-    0xD0, 0x2F, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xBF, 0xFF, 0xD7, 0xFF, 0xFC, 0x02,
-    0xFF, 0x6F, 0xFF, 0xD3, 0xFC, 0x07, 0xF8, 0x0B, 0xFF, 0x02, 0xFC, 0x0F, 0xF0, 0x07, 0xFD, 0x03,
-    0xF8, 0x1F, 0xE0, 0x03, 0xFC, 0x0B, 0xF0, 0x2F, 0xD0, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC0, 0x07,
-    0xFA, 0xFE, 0x00, 0x3F, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF4, 0x00, 0xB0, 0x3F, 0xD0, 0x7F, 0xFC, 0x07, 0xF0, 0x2F, 0xFA, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A,
-    0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xAF, 0xF4,
-    0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0x80,
-    0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x07,
-    0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x1F, 0xFC, 0x00, 0x1F, 0xF9, 0x02, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xD0, 0x3F, 0xFD, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x01, 0xFF, 0xE0, 0xFF, 0x0F, 0xFF, 0x8F, 0xFC, 0x15, 0xFD,
-    0xBF, 0xF0, 0x03, 0xF7, 0xFB, 0x40, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xAF, 0xF4, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x00,
-    0x7F, 0x80, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x03,
-    0xFC, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0x01, 0xFF,
-    0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x1F, 0xFC, 0x00, 0x1F, 0xF9,
-    0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x3F, 0xFD, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x07, 0xFF, 0x83, 0xFC,
-    0x0F, 0xFF, 0x8F, 0xFC, 0x05, 0x7F, 0x6F, 0xFC, 0x00, 0x3F, 0x7F, 0xB4, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x03, 0xAF, 0xF4, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x00,
-    0xFF, 0x40, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x0B,
-    0xFC, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xD0,
-    0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x1F, 0xFC,
-    0x00, 0x1F, 0xF9, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x3F, 0xFD, 0x3F, 0xFF, 0xF0, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xE0, 0x02, 0xF0,
-    0x3F, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x01, 0xFF, 0xE0, 0xFF, 0x0F,
-    0xFF, 0x8F, 0xFC, 0x15, 0xFD, 0xBF, 0xF0, 0x03, 0xF7, 0xFB, 0x40, 0x1F, 0xFD, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xC0, 0x0F, 0xC0,
-    0x1F, 0xF0, 0x03, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0xF4, 0x00, 0xBF, 0xC0, 0x7D, 0x00, 0x1F, 0xF0, 0x2F, 0x80, 0x07, 0xFC, 0x0F, 0xF4,
-    0x03, 0xFE, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xF0, 0x01, 0xFD, 0x5F, 0xC0, 0x0B, 0xF0, 0x09, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x1F,
-    0x00, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x03, 0xFF, 0xAF, 0xD0, 0x0B, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x02, 0xFD, 0x07, 0xD0,
-    0x00, 0x78, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xC0,
-    0x0F, 0xC0, 0x1F, 0xF0, 0x03, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0xF4, 0x00, 0xBF, 0xC0, 0x7D, 0x00, 0x1F, 0xF0, 0x2F, 0x80, 0x07, 0xFC,
-    0x0F, 0xF4, 0x03, 0xFE, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0xFC, 0x07, 0xC0, 0x01, 0x80, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x7F, 0x57, 0xF0, 0x02, 0xFC, 0x02, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x07, 0xC0, 0x3F,
-    0xC0, 0x3F, 0xC0, 0xFF, 0x00, 0xFF, 0xEB, 0xF4, 0x02, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xC0, 0x0F, 0xC0, 0x1F, 0xF0,
-    0x03, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0xF4, 0x00, 0xBF, 0xC0, 0x7D, 0x00, 0x1F, 0xF0, 0x2F, 0x80, 0x07, 0xFC, 0x0F, 0xF4, 0x03, 0xFE,
-    0x03, 0xFF, 0xEF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xD5, 0xFC, 0x02, 0xFC,
-    0x02, 0x40, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x01, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFF, 0xAF,
-    0xD0, 0x2F, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xBC, 0x00, 0x07, 0xE0,
-    0x3F, 0x80, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x5B, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x1F,
-    0xF0, 0x03, 0xF0, 0x01, 0xFF, 0x00, 0x3D, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0x40, 0x0B, 0xFC, 0x01, 0xF4, 0x00, 0x7F, 0xC0,
-    0x2F, 0x80, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xFE, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0xBC, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xFD, 0x5F, 0xC0, 0x02,
-    0xFC, 0x02, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0xFF, 0x00, 0x3F, 0xFA, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFA, 0xFF, 0xAB, 0xFC, 0x3F, 0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF, 0x01,
-    0xF4, 0x3E, 0x02, 0xFE, 0x02, 0xF0, 0x18, 0x03, 0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD,
-    0x00, 0x06, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC2, 0xAF, 0xFA, 0x90, 0x0B, 0xF4, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x01, 0xC0, 0x3F, 0xD6, 0xF4, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x40, 0x00, 0x01, 0x90, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x0B, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0xFF, 0xAB, 0xFC, 0x3F, 0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF,
-    0x01, 0xF4, 0x3E, 0x02, 0xFE, 0x02, 0xF0, 0x18, 0x03, 0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0x2E, 0x00, 0x03, 0xF8, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1B,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x0A, 0xBF, 0xEA, 0x40, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x07, 0x00, 0x0F, 0xF5, 0xBD, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0xFF, 0xAB, 0xFC, 0x3F,
-    0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF, 0x01, 0xF4, 0x3E, 0x02, 0xFE, 0x02, 0xF0, 0x18, 0x03,
-    0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD,
-    0x00, 0x06, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC2, 0xAF, 0xFA, 0x90, 0x0B, 0xF4, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x01, 0xC0, 0x3F, 0xD6, 0xF4, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x3C, 0x00,
-    0x00, 0x00, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xD0, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x07, 0xFE, 0x00, 0x07,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x80, 0x00,
-    0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0x0F, 0xE0, 0x02, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0, 0x03, 0xFD, 0x00,
-    0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xC0,
-    0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF4, 0x1B, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x04, 0x00, 0x00, 0x7F, 0xC3, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x00, 0xF0, 0xFF, 0x80, 0x00, 0x05, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0,
-    0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F,
-    0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x07, 0xFE, 0x00,
-    0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x80,
-    0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xF0,
-    0x00, 0x0F, 0xE0, 0x02, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0, 0x03, 0xFD,
-    0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF4, 0x1B, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F,
-    0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8,
-    0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0,
-    0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0,
-    0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
-    0x0F, 0x40, 0x1C, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD,
-    0x07, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xF8,
-    0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x02, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x2F,
-    0xD0, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF4, 0x1B,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0xF8,
-    0x01, 0xC0, 0x00, 0x0F, 0xD1, 0xBC, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00,
-    0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02,
-    0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF,
-    0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC,
-    0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0x00,
-    0x00, 0x00, 0x03, 0xEB, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00,
-    0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00,
-    0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF,
-    0x41, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0xF0,
-    0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
-    0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB,
-    0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xB4, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0,
-    0x00, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
-    0x00, 0x02, 0x80, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F,
-    0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B,
-    0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00,
-    0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00,
-    0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0xA0, 0x00, 0x00, 0xBD,
-    0x1F, 0x40, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x03, 0xF4, 0xFE, 0x00, 0x00, 0xBD, 0x2F, 0x80, 0x00,
-    0x0F, 0x43, 0xD0, 0x00, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F,
-    0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8,
-    0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0,
-    0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0,
-    0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00,
-    0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00,
-    0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x01, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF,
-    0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC,
-    0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x0B, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00,
-    0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD, 0x0B, 0xFF, 0x04, 0x2F, 0xC2, 0xF7, 0xF7, 0xC2, 0xFF, 0xFC,
-    0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x40, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x07,
-    0xC0, 0x1F, 0xFF, 0xDF, 0xFF, 0xF8, 0x03, 0xF0, 0x07, 0xFF, 0xF0, 0x7F, 0xE0, 0x01, 0xFD, 0x00,
-    0x2F, 0xE0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x07, 0xF0,
-    0x00, 0xBF, 0x80, 0x3F, 0xF4, 0x03, 0xF8, 0x00, 0x2F, 0xE0, 0x1F, 0xFD, 0x01, 0xFC, 0x00, 0x0B,
-    0xF8, 0x0F, 0xFF, 0x80, 0xFE, 0x00, 0x01, 0xFE, 0x07, 0xEF, 0xE0, 0x7F, 0x00, 0x00, 0x7F, 0x83,
-    0xF3, 0xF8, 0x3F, 0x80, 0x00, 0x0F, 0xE1, 0xF8, 0xBE, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0xFC, 0x2F,
-    0x8F, 0xE0, 0x00, 0x00, 0xFF, 0x7E, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xEF, 0x41, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0xF4, 0x00, 0x00, 0x01, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x01, 0x40, 0x05, 0x02, 0xFF, 0x01, 0xFD, 0x03, 0xFC, 0xBF, 0xF8, 0x0F, 0xF0,
-    0x2F, 0xD5, 0xBF, 0xC0, 0xBF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF4, 0x0F, 0xD0, 0x1F, 0xD0, 0x7F,
-    0x80, 0xFC, 0x00, 0xFD, 0x0B, 0xF8, 0x1F, 0xC0, 0x0F, 0xE0, 0xFF, 0xC2, 0xF4, 0x00, 0xFE, 0x1F,
-    0xFC, 0x3F, 0x00, 0x0B, 0xE3, 0xFF, 0xC7, 0xE0, 0x00, 0xBF, 0x7D, 0xFC, 0xFC, 0x00, 0x07, 0xFF,
-    0x8F, 0xEF, 0x40, 0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x7F,
-    0x40, 0xFF, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xD0, 0x00, 0x00,
-    0x78, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x0F, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xFC,
-    0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xFC,
-    0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x4F, 0xE0, 0x00, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xC3,
-    0xE0, 0x00, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x00, 0x18, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0x02, 0xFE, 0x00,
-    0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00,
-    0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x2F,
-    0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD, 0x00, 0x00, 0x2F,
-    0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x1A, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x7F,
-    0x8F, 0xF4, 0x00, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0,
-    0xFF, 0xFD, 0x03, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xF4, 0x03,
-    0xFC, 0x00, 0x02, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0xFE,
-    0x00, 0x00, 0x02, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xAA, 0xAF, 0xFD, 0x02, 0xF8, 0x00, 0xBF, 0xE0, 0x0B,
-    0xC0, 0x07, 0xFE, 0x00, 0x1F, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x64, 0x00, 0xBF,
-    0xD0, 0x03, 0xF0, 0x0B, 0xFE, 0x00, 0x1F, 0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0x03, 0xFF, 0xAA, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x1F, 0xFD, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-    0xF4, 0x1F, 0x41, 0xFF, 0x40, 0x7C, 0x03, 0xF4, 0x00, 0x50, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x02, 0xD0, 0x3F,
-    0xE5, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0x1F, 0xEF, 0xFF, 0xF4, 0x3F, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xEA, 0xAB, 0xFF, 0x40, 0xBE, 0x00, 0x2F, 0xF8, 0x02, 0xF0, 0x01, 0xFF, 0x80,
-    0x07, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x19, 0x00, 0x2F, 0xF4, 0x00, 0xFC, 0x02,
-    0xFF, 0x80, 0x07, 0xF0, 0x1F, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0xEA, 0xBF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x01, 0xFF, 0xD1, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x41, 0xF4, 0x1F, 0xF4, 0x07, 0xC0, 0x3F, 0x40, 0x05, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x80, 0x2D, 0x03, 0xFE, 0x51, 0xFC, 0x3F, 0xFF, 0xFF, 0xF1, 0xFE, 0xFF, 0xFF, 0x43, 0xF0,
-    0x7F, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x1F, 0x00,
-    0x00, 0x3E, 0x02, 0xF8, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xAA, 0xAF, 0xFD, 0x02,
-    0xF8, 0x00, 0xBF, 0xE0, 0x0B, 0xC0, 0x07, 0xFE, 0x00, 0x1F, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x64, 0x00, 0xBF, 0xD0, 0x03, 0xF0, 0x0B, 0xFE, 0x00, 0x1F, 0xC0, 0x7F, 0xE0, 0x00,
-    0xFF, 0x03, 0xFF, 0xAA, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xE0, 0x02, 0xF0, 0x3F,
-    0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x1F, 0xFD, 0x1F, 0xC0, 0xFF,
-    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0x41, 0xFF, 0x40, 0x7C, 0x03, 0xF4, 0x00, 0x50, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF8, 0x02, 0xD0, 0x3F, 0xE5, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0x1F, 0xEF, 0xFF, 0xF4, 0x3F,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0xBD, 0x00, 0x00, 0x00,
-    0xFE, 0x02, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x4B, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x03,
-    0xF0, 0x0F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x1F, 0x40, 0x08, 0x01, 0x40, 0x3D, 0x0B, 0xE1, 0xFD,
-    0x3F, 0x8B, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0xFE,
-    0xF8, 0x0F, 0xC3, 0xF0, 0xFC, 0x03, 0xC1, 0x80, 0x05, 0x00, 0x0A, 0x80, 0x83, 0xFE, 0x1F, 0xBF,
-    0xFF, 0xFF, 0x4B, 0xFC, 0x20, 0x2E, 0x00, 0x3F, 0xFF, 0xDB, 0xFF, 0xFD, 0xBF, 0xFF, 0xC0, 0x04,
-    0x00, 0x07, 0xC0, 0x0E, 0xBF, 0x47, 0xD7, 0xFF, 0xF8, 0x1F, 0xFE, 0x00, 0x15, 0x00, 0x06, 0x42,
-    0xFC, 0x3F, 0xC3, 0xF8, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7E, 0xBF, 0x0F, 0xFF, 0xF0, 0xFD,
-    0x78, 0x0B, 0x40, 0x00, 0x50, 0x07, 0xFF, 0x43, 0xFB, 0xF1, 0xF0, 0xFC, 0x14, 0x3E, 0x00, 0x7E,
-    0x00, 0xFD, 0x00, 0x3D, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xFD, 0x78, 0x2E,
-    0xB4, 0x1E, 0xB8, 0x3D, 0x7F, 0xFC, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x30,
-    0x03, 0xF0, 0xFC, 0x0B, 0xE2, 0xFC, 0x1F, 0xC7, 0xF0, 0x3F, 0x0F, 0xC0, 0xBC, 0x1F, 0x00, 0x10,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0xC3, 0xD0, 0xBD, 0x0F, 0xCB, 0xD0, 0x1F, 0xFE, 0x00,
-    0x3F, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x00, 0x08, 0x08, 0x0F, 0x0F, 0x87, 0xD3, 0xF0, 0xFC,
-    0xBC, 0x1F, 0x0F, 0x83, 0xD1, 0xE0, 0x20, 0x20, 0x00, 0x64, 0x00, 0xBF, 0xF8, 0x3F, 0xFF, 0xCB,
-    0xD0, 0xFD, 0xA0, 0x03, 0xC0, 0x00, 0x10, 0x00, 0x90, 0x7C, 0x0F, 0x43, 0xF0, 0x7E, 0x0B, 0xE0,
-    0xBF, 0x03, 0xE0, 0x01, 0x40, 0x3F, 0xC0, 0x7F, 0x40, 0xFC, 0x07, 0xF0, 0x2F, 0x01, 0xF8, 0x0F,
-    0x80, 0x00, 0x00, 0x01, 0x41, 0xFD, 0x3F, 0x87, 0xF0, 0x7E, 0x03, 0xE0, 0x3F, 0x00, 0xF4, 0x00,
-    0x00, 0x0B, 0x43, 0xF1, 0xF8, 0xBC, 0x3E, 0x0F, 0x03, 0x80, 0x00, 0x01, 0x40, 0xFD, 0x0F, 0xD0,
-    0xFC, 0x3F, 0x47, 0xD0, 0x60, 0x00, 0x06, 0x42, 0xFC, 0x3F, 0xC3, 0xF8, 0x19, 0x00, 0x04, 0x00,
-    0x43, 0xF0, 0xBE, 0xBF, 0x0F, 0xFF, 0xF0, 0xFD, 0x24, 0x06, 0x00, 0x01, 0x90, 0x0F, 0xF8, 0x3D,
-    0x3C, 0x3C, 0x2C, 0x3C, 0x3C, 0x2F, 0xF4, 0x06, 0x40, 0x02, 0x41, 0xFC, 0x0F, 0xC0, 0xFC, 0x1F,
-    0x07, 0xD0, 0x50, 0x00, 0x01, 0x90, 0x1F, 0xE0, 0x1F, 0xC0, 0x3E, 0x03, 0xF0, 0x7F, 0x01, 0x90,
-    0x00, 0x01, 0x40, 0xE0, 0x3C, 0x0B, 0x80, 0xF8, 0x0F, 0xFE, 0x7F, 0xC0, 0x00, 0x05, 0x47, 0xE2,
-    0xF8, 0xFD, 0x3F, 0x1F, 0xCB, 0xE1, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xFC, 0x00,
-    0xFF, 0xFC, 0x0F, 0xD2, 0xF4, 0xFD, 0x03, 0xE1, 0x40, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0x01,
-    0x7D, 0x01, 0xDB, 0xFA, 0xFC, 0x3F, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x40, 0x42,
-    0xFD, 0x0F, 0x7F, 0xFB, 0xFF, 0x8F, 0xFD, 0x70, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xDB, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xC0, 0x00, 0x54, 0x00, 0xBF, 0xF8, 0x2F, 0xFF, 0xD7, 0xD0, 0xBE, 0xA0, 0x03,
-    0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x0F,
-    0xD0, 0x00, 0xFC, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x43, 0xF1, 0xFE, 0x3F, 0xC7, 0xF0,
-    0xFE, 0x06, 0x00, 0x90, 0x3E, 0x07, 0xD0, 0xBD, 0x0B, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00,
-    0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0,
-    0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x06, 0x80, 0x64, 0x00, 0x00, 0x07, 0xF4, 0xBF,
-    0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0xBE, 0x0F, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xAA, 0xBF, 0x80, 0x00, 0x3F, 0xC0, 0x07, 0xE0,
-    0x00, 0x1F, 0xF0, 0x01, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x78, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE5, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0xB8, 0x00, 0x0B, 0xF8, 0x00, 0x3E, 0x00, 0x03,
-    0xFD, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xEB, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xFF, 0xAB, 0xFC, 0x3F, 0x01, 0xFF, 0x02, 0xF8, 0x3F, 0x02, 0xFE,
-    0x02, 0xF4, 0x3E, 0x03, 0xFD, 0x02, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00,
-    0x2F, 0xE0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x01, 0xBF,
-    0xD0, 0x03, 0xFC, 0x0F, 0xFF, 0xFC, 0x03, 0xFC, 0x1F, 0xFF, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xD0, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xAB, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0xFC, 0x00, 0x07, 0xFC, 0x00, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD4,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xAA, 0xFD, 0x00,
-    0xFF, 0xC0, 0x03, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xC0, 0xBF, 0xC0, 0x00, 0x3D, 0x03, 0xFD, 0x00,
-    0x00, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD6, 0xA9, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE5, 0x55, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x10, 0x0F, 0xFC, 0x00, 0x01, 0xF0, 0x1F, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0xFD, 0x06,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xFF, 0xF4, 0x02, 0xFF, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xC0, 0x0F, 0xC0, 0x1F,
-    0xF0, 0x03, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0xF4, 0x00, 0xBF, 0xC0, 0x7D, 0x00, 0x1F, 0xF0, 0x2F, 0x80, 0x07, 0xFC, 0x0F, 0xF4, 0x03,
-    0xFE, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x02, 0x80, 0x68, 0x00, 0x0F, 0xE1, 0xFD, 0x00, 0x2F, 0xE3, 0xFD, 0x00, 0x1F,
-    0xC2, 0xF8, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xD0, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x02, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0xFD, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFC, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xF8, 0x07, 0xFC, 0x0B, 0xFD, 0x00, 0x03, 0xF0, 0x07, 0xFC, 0x03,
-    0xFE, 0x00, 0x0B, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0x0F, 0xC0, 0x0F, 0xF4, 0x02, 0xFE, 0x00,
-    0x3F, 0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x3D, 0xFF, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x7F, 0xFD, 0x00,
-    0x7F, 0xFA, 0xBF, 0xF0, 0x7F, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xD0, 0x0B, 0xFF, 0xFF,
-    0xF9, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xBF, 0xFA,
-    0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x03,
-    0xFC, 0x00, 0x2F, 0xE0, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x02, 0xFE, 0x00, 0xBF, 0x80,
-    0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xBF,
-    0xEA, 0xFF, 0xC0, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xAF, 0xFA, 0xBF, 0xC0, 0x3F,
-    0x01, 0xFF, 0x02, 0xF8, 0x03, 0xF0, 0x2F, 0xE0, 0x2F, 0x40, 0x3E, 0x03, 0xFD, 0x02, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xDB, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x02, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x1F,
-    0xF0, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x01, 0xBF, 0xD0, 0x07,
-    0xFE, 0x40, 0xFF, 0xFF, 0xC7, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA4, 0x00, 0x3F, 0xFF, 0xF0, 0x0B, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x2F, 0xFE, 0x00,
-    0x07, 0xFE, 0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFC, 0x01, 0xFD, 0x18, 0x00, 0x07, 0xFC, 0x03, 0xF4,
-    0x00, 0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xF4,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x80,
-    0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x90, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFF, 0xF4, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xF4,
-    0x07, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x0B, 0xF1, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xE0, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x14, 0x00, 0x30, 0x00,
-    0x00, 0x1F, 0x40, 0x3C, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x0F, 0xFF, 0xD3, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x1F,
-    0xF8, 0x00, 0x2F, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0x1F,
-    0xF0, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x42, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x10, 0x0F, 0xD0, 0x00, 0x00, 0x1E, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F,
-    0xC0, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x03, 0xFE,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0xEA, 0xAF, 0xFE, 0x40, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0B,
-    0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFC,
-    0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFE, 0xAB, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xF8,
-    0x00, 0x07, 0xF8, 0x01, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0xA4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xD0, 0x2F, 0xF4, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x7F, 0xC0,
-    0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x01, 0xFF, 0xAA, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3A,
-    0xFF, 0x4B, 0xFE, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0x80,
-    0x3F, 0x80, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xFA, 0xFF, 0x00,
-    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0x3F, 0xF4, 0x00, 0xFF,
-    0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x0F,
-    0xF0, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x1F, 0xFA, 0xAF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xAB, 0xFD, 0x00, 0x03, 0xFD,
-    0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xF8, 0x00, 0x0B, 0xF8, 0x00,
-    0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0xD4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xA6, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0xD0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x3F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x02, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x02,
-    0xFE, 0x00, 0x01, 0xBF, 0xEA, 0xAA, 0xFF, 0xD4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x03,
-    0xF4, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFA, 0xAB, 0xF8,
-    0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0xC0, 0x07, 0x80,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x5A, 0x90, 0x00,
-    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00,
-    0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x7F, 0xFF,
-    0x40, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x02, 0xFD, 0x00, 0xFF, 0xFC, 0x00, 0x04, 0x7F, 0x00, 0xBF,
-    0x00, 0xBF, 0x09, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F,
-    0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC2,
-    0xFC, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xFF, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x87, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x7F,
-    0xF0, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0xBF,
-    0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x0B, 0xFE, 0x00, 0x2F,
-    0xF0, 0x03, 0xFF, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xF9, 0x5F,
-    0xFC, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0x7D, 0x00, 0x3F, 0xC0, 0x0E, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xAF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
-    0x2C, 0x00, 0x0F, 0xF8, 0x2F, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x07, 0xFE, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0xBF,
-    0xC0, 0x00, 0x01, 0xFF, 0x0B, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x0B, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xD0,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80,
-    0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFF,
-    0xC0, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xC0, 0xBF, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x0B, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0xFF,
-    0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x40,
-    0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x2F,
-    0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x3F, 0xFF, 0xF0, 0x0B, 0xFD, 0x00, 0x3F, 0xFF, 0xE0,
-    0x2F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFC, 0x01, 0xFD, 0x18, 0x00, 0x07,
-    0xFC, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0x80, 0x00,
-    0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x00,
-    0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x90, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xA6, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xF8, 0x00, 0x00,
-    0x02, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x00, 0x0F, 0x7F,
-    0xC0, 0x03, 0xFD, 0x00, 0x07, 0xFF, 0xD0, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD,
-    0x00, 0x3F, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x0F, 0xEF, 0xC0, 0x00,
-    0x0B, 0xDB, 0xF0, 0x2F, 0x7F, 0xC0, 0x00, 0x0F, 0xCB, 0xF0, 0x3E, 0x3F, 0xC0, 0x00, 0x0F, 0xC7,
-    0xF4, 0xFC, 0x3F, 0xC0, 0x00, 0x2F, 0x83, 0xF9, 0xF8, 0x3F, 0xC0, 0x00, 0x3F, 0x43, 0xFB, 0xF0,
-    0x3F, 0x80, 0x00, 0x3F, 0x03, 0xFF, 0xE0, 0x7F, 0x80, 0x00, 0x7E, 0x02, 0xFF, 0xC0, 0x7F, 0x80,
-    0x00, 0xFD, 0x02, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x01, 0xFC,
-    0x00, 0xFD, 0x00, 0xBF, 0x40, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x50,
-    0x01, 0xFF, 0xD0, 0x3F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xF4, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80,
-    0x00, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xF9,
-    0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC,
-    0x00, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0x03, 0xFD,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF,
-    0x40, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x01, 0xFF,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x90, 0x07, 0xFF, 0x40, 0x01, 0xFF,
-    0xFF, 0x87, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x5A, 0xA4,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFB, 0xFE, 0x6F, 0xFC,
-    0x00, 0x03, 0xFC, 0x0B, 0xFD, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00,
-    0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F,
-    0xF0, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xEA,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xAA, 0xFE, 0x00, 0xFF, 0xE0, 0x02, 0xF4, 0x0B, 0xFC, 0x00,
-    0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x3E, 0x02, 0xFE, 0x00, 0x00, 0x50, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x60, 0x2F, 0xFC, 0x00, 0x0B, 0xC0, 0x3F, 0xFE, 0x56, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0xFF,
-    0xAB, 0xFC, 0x3F, 0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF, 0x01, 0xF4, 0x3E, 0x02, 0xFE, 0x02,
-    0xF0, 0x18, 0x03, 0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xD3, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x1F, 0xF8, 0x00, 0x2F, 0xD0, 0x03, 0xFE, 0x00, 0x0F,
-    0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xF4,
-    0x00, 0x00, 0xBF, 0x42, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x10, 0x0F, 0xD0, 0x00, 0x00,
-    0x1E, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xAF, 0xFB,
-    0xFF, 0x00, 0xBF, 0xC1, 0xFE, 0x0F, 0xF8, 0x1F, 0xF0, 0x2F, 0xD0, 0x7F, 0xC3, 0xFD, 0x03, 0xFC,
-    0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC3, 0xFC, 0x07, 0xF8, 0x07, 0xFC, 0x3F, 0xC0, 0x7F,
-    0x40, 0xFF, 0x43, 0xFD, 0x0B, 0xF0, 0x2F, 0xF0, 0x2F, 0xF4, 0xFF, 0x1F, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x05,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x00,
-    0xBF, 0x40, 0x00, 0x01, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xF0, 0x00,
-    0x02, 0xFE, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xFF, 0xD0, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC1, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0xEA, 0xAF, 0xFE, 0x40, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xE3, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xF0, 0x1F, 0xF8, 0x01, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x0F,
-    0xF4, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xBF,
-    0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xF9, 0x6F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xA5, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFE, 0x00,
-    0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x0B, 0xF8,
-    0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x1F,
-    0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x03,
-    0xFD, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0,
-    0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xFA, 0xAB, 0xFE, 0xAA, 0xFF, 0x90, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xFF, 0xFE, 0x3F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80,
-    0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x0B, 0xF8, 0x02, 0xFE,
-    0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x07,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFD, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF4,
-    0x03, 0xFD, 0x00, 0x00, 0x1F, 0xFA, 0xAB, 0xFE, 0xAA, 0xFF, 0x94, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFA, 0xFF, 0xD0,
-    0x00, 0x3F, 0x02, 0xFE, 0x00, 0x00, 0xFC, 0x0F, 0xF4, 0x00, 0x03, 0xE0, 0x3F, 0xC0, 0x00, 0x06,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFA, 0x90, 0x00, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x2F, 0xF4, 0x00, 0x7F, 0x80, 0x2F,
-    0xF0, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x02, 0xFE, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x01,
-    0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xFE, 0xAF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xEA,
-    0x40, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0xFF,
-    0xF0, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x7F,
-    0xC0, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0x03,
-    0xFE, 0x00, 0x00, 0x1F, 0xFA, 0xBF, 0xF8, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFA,
-    0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0x2F, 0xF4,
-    0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0xBF,
-    0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x1F, 0xFA, 0xAF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x40, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x95, 0xBF, 0xF0, 0x00, 0xFC,
-    0x00, 0xBF, 0xE0, 0x07, 0xD0, 0x00, 0xFF, 0xC0, 0x0F, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x05, 0x55, 0x7F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x07, 0xFD, 0x01, 0xC0, 0x00, 0x3F, 0xF0, 0x2F, 0x80, 0x02, 0xFF, 0x40, 0xFF, 0x40, 0x2F, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00,
-    0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x00, 0x03, 0xFC, 0x0B,
-    0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xF8, 0x2F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF9, 0xBF,
-    0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xE0, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0xBF,
-    0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x7F,
-    0xD0, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0x80, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x3F,
-    0xF8, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xE5, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x03, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x0F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x02,
-    0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0xE0, 0x00, 0x00,
-    0x0B, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x9B, 0xFD, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0xF9,
-    0x00, 0x1F, 0xFE, 0x07, 0xFF, 0xFD, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xF0, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0,
-    0x07, 0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F,
-    0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07,
-    0xFD, 0x00, 0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xC3, 0xEF, 0xEB, 0x8F, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF,
-    0xF0, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x81, 0x50, 0x00, 0x03, 0xF2, 0xFF, 0xD0, 0x00, 0xBE, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0x6F, 0xF8, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x2F, 0xF0, 0x03, 0xFC, 0x03,
-    0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x02, 0xFF, 0xAF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0x42, 0xFC, 0x03, 0xF0, 0x07, 0xF0,
-    0x3F, 0x40, 0x3F, 0x81, 0xFC, 0x07, 0xFC, 0x0B, 0xFB, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xD0, 0xFE,
-    0x40, 0x7F, 0xC3, 0xF4, 0x00, 0xFF, 0x0F, 0xE0, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0xD7,
-    0xFD, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x3F, 0x96, 0xFD, 0x0F, 0x00, 0x7F, 0x40, 0x00, 0x3F,
-    0xD0, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x03, 0xFE, 0x00,
-    0x01, 0xFE, 0x00, 0x34, 0x7F, 0x80, 0x7F, 0x1F, 0xFA, 0xFF, 0x43, 0xFF, 0xFF, 0x40, 0x2F, 0xFE,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-    0xE0, 0x02, 0xE0, 0x2F, 0xF4, 0x00, 0x40, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xAF,
-    0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x2F, 0xC0, 0x07,
-    0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xE0, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x3F, 0xD0, 0xBF, 0x40, 0x2F, 0xFB, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0,
-    0x1F, 0xD2, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xC0, 0xBF, 0x02, 0xFC, 0x2F,
-    0xC0, 0x3F, 0xEF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE4, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x3F,
-    0xC0, 0x7F, 0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05, 0x40, 0x0B, 0xFD, 0x02, 0xF4, 0x07, 0xFE, 0x03, 0xFF,
-    0xF0, 0x3F, 0x02, 0xFF, 0xF0, 0xBF, 0xFF, 0x43, 0xF0, 0x7F, 0xFE, 0x0F, 0x43, 0xF8, 0xBE, 0x0F,
-    0xC0, 0x40, 0x50, 0x2F, 0x9F, 0xD3, 0xF0, 0x00, 0x00, 0x02, 0xFB, 0xFC, 0xBE, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xE3, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x5F, 0xC0, 0x20, 0x30,
-    0x3F, 0x07, 0xE1, 0xFE, 0x1F, 0x4B, 0xFF, 0xD0, 0xBD, 0x0F, 0xFF, 0xF0, 0xFF, 0xF8, 0x0F, 0xC0,
-    0xFF, 0xFC, 0x07, 0xFD, 0x00, 0xF8, 0x03, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x03, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0x96, 0xFD, 0x03, 0x80,
-    0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x00,
-    0x01, 0x5B, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x90, 0x03, 0xFC, 0x2F, 0x00, 0x7F, 0x83, 0xFD, 0x6F,
-    0xF0, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05,
-    0x01, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01, 0xFC,
-    0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0x80,
-    0x0B, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD, 0x0B,
-    0xFF, 0x04, 0x2F, 0xC2, 0xF7, 0xF7, 0xC2, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF, 0x00,
-    0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x0B, 0x80, 0x1D, 0x00, 0x00, 0xFC, 0x03, 0xC0, 0x00, 0x0F, 0xE6, 0xF8, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x05, 0x01, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01,
-    0xFC, 0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F,
-    0x80, 0x0B, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD,
-    0x0B, 0xFF, 0x04, 0x2F, 0xC2, 0xF7, 0xF7, 0xC2, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF,
-    0x00, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x14, 0x07, 0xFF,
-    0x80, 0x7F, 0xC3, 0xFF, 0xE0, 0xBF, 0xF0, 0x5B, 0xF4, 0xBF, 0xF8, 0x01, 0xFC, 0x7F, 0x40, 0x00,
-    0x7F, 0x3F, 0x00, 0x00, 0x2F, 0xAF, 0x00, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x3F, 0xC7, 0xF4, 0x10, 0x0F, 0xF0, 0xFF,
-    0x2E, 0x07, 0xF8, 0x1F, 0xFF, 0x42, 0xFD, 0x03, 0xFF, 0xC0, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x2F, 0x9F, 0xF0, 0x00, 0x01, 0xF8, 0x3F, 0xC0, 0x00, 0x0B, 0xC0, 0xFE, 0x00,
-    0x00, 0x3E, 0x07, 0xF4, 0x00, 0x01, 0xF4, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x3E,
-    0x07, 0xF4, 0x00, 0x02, 0xF4, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0xFF, 0x00, 0x29, 0xBE, 0x03, 0xFC,
-    0xB0, 0xFF, 0xF0, 0x0F, 0xFF, 0xC3, 0xFF, 0x40, 0x3F, 0xFD, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xBF, 0x43,
-    0xEF, 0xD0, 0x00, 0x0F, 0x6F, 0x8B, 0xCF, 0xC0, 0x00, 0x1F, 0x5F, 0x8F, 0x5F, 0xC0, 0x00, 0x1F,
-    0x1F, 0xEF, 0x2F, 0xC0, 0x00, 0x2F, 0x1F, 0xFD, 0x2F, 0x80, 0x00, 0x3E, 0x0F, 0xFC, 0x3F, 0x40,
-    0x00, 0x3D, 0x0F, 0xF4, 0x3F, 0x40, 0x00, 0xBC, 0x0F, 0xF0, 0x3F, 0x08, 0x24, 0xFC, 0x0F, 0xE0,
-    0x7F, 0x7C, 0x3F, 0xF4, 0x0F, 0xC0, 0x7F, 0xFC, 0x3F, 0xF0, 0x0F, 0xC0, 0x7F, 0xF0, 0x3F, 0xC0,
-    0x09, 0x00, 0x3F, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x0B, 0xF4, 0x3F, 0xFF, 0x00, 0xBF, 0x41, 0x6F, 0xE0, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0xFF,
-    0x00, 0x1F, 0xD0, 0x1F, 0xE0, 0x02, 0xFC, 0x02, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xAA, 0xBF, 0x80, 0x0B, 0xF4, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0xBF, 0x00,
-    0x0F, 0xF0, 0x0F, 0xF2, 0xC1, 0xFE, 0x00, 0xFF, 0xFC, 0x2F, 0xD0, 0x0F, 0xFF, 0x43, 0xFC, 0x00,
-    0xBF, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0xBF, 0xDB, 0xFD, 0x07, 0xF8, 0x0B, 0xFC, 0x3F, 0xC0, 0x1F, 0xF1, 0xFE, 0x00,
-    0x3F, 0xCB, 0xF4, 0x00, 0xFF, 0x3F, 0xC0, 0x07, 0xF8, 0xFF, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0xFF,
-    0x0F, 0xF0, 0x07, 0xF8, 0x3F, 0xD0, 0x7F, 0xC0, 0xBF, 0xEB, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x01, 0xFF, 0xE0, 0xBF, 0xD0,
-    0x3F, 0xFE, 0x3F, 0xFF, 0x01, 0x6F, 0xEF, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0xFF, 0x00, 0x1F, 0xFC,
-    0x0F, 0xE0, 0x02, 0xFF, 0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0x7F, 0x80, 0x7F, 0x80, 0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF2, 0xC1, 0xFE, 0x00, 0xFF, 0xFC, 0x2F, 0xD0, 0x0F, 0xFF, 0x43, 0xFC, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x50, 0x05, 0x40, 0x02, 0xFF, 0xC1, 0xFF, 0x80, 0x0F, 0xFF,
-    0x5F, 0xFF, 0x40, 0x16, 0xFE, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0x47, 0xF8, 0x00, 0x2F, 0xF4, 0x1F,
-    0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x0B, 0xF4, 0x00,
-    0x7F, 0x40, 0x3F, 0xC0, 0x02, 0xFC, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0x80,
-    0xBF, 0x80, 0x01, 0xFF, 0xEF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xF4, 0x00,
-    0x00, 0xFE, 0x04, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xAA, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xD0, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x03,
-    0xFC, 0x07, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x28, 0x3F, 0xF0, 0x7F, 0x0F, 0xFF, 0xFF, 0x41,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x50,
-    0x07, 0xFF, 0x42, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0xC0, 0x5B, 0xF7, 0xFF,
-    0xF7, 0xFF, 0xF4, 0x01, 0xFF, 0xE1, 0xFF, 0xD2, 0xFC, 0x00, 0x7F, 0xF0, 0xBF, 0xE0, 0xFF, 0x00,
-    0x2F, 0xF0, 0x3F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x1F, 0xE0, 0x03, 0xFC, 0x07, 0xFC,
-    0x0B, 0xF4, 0x01, 0xFE, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0xFE, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x7F, 0x40, 0x0F, 0xF0, 0x1F, 0xE0, 0x2F, 0xD7, 0x47, 0xF8, 0x0B, 0xF4, 0x0B,
-    0xFF, 0xD2, 0xFD, 0x02, 0xFC, 0x02, 0xFF, 0xF0, 0xFF, 0x00, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00,
-    0x1F, 0xFF, 0x02, 0xFE, 0x00, 0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00,
-    0x7F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F,
-    0x83, 0xF4, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08,
-    0x01, 0xFD, 0x00, 0x00, 0x2F, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0xBE, 0x00, 0x00, 0x03, 0xF0,
-    0x18, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xBF, 0xEF, 0xF8, 0x0B,
-    0xFC, 0x2F, 0x83, 0xFD, 0x0F, 0xF0, 0x3F, 0x41, 0xFE, 0x2F, 0xD0, 0x3F, 0x40, 0xFF, 0x3F, 0xC0,
-    0x3F, 0x00, 0xFF, 0x3F, 0xC0, 0x7F, 0x00, 0xFE, 0x3F, 0xC0, 0x7F, 0x01, 0xFD, 0x3F, 0xC0, 0xBE,
-    0x03, 0xFC, 0x3F, 0xD0, 0xFD, 0x0B, 0xF8, 0x1F, 0xF0, 0xFD, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0E, 0x0B, 0xE0, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x05, 0x40, 0x1F, 0xF4, 0x03, 0xFE, 0x07, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xFD, 0x2F, 0xFD,
-    0x00, 0x1F, 0xE7, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x02, 0xFB, 0xF8, 0x00, 0x25, 0xBE, 0x3F, 0xC0, 0x03, 0xFF, 0xC2, 0xFF, 0xF8, 0x7F, 0xF0, 0x1F,
-    0xFF, 0x43, 0xFC, 0x00, 0xBF, 0xD0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x01,
-    0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01, 0xFC, 0x02,
-    0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x0B,
-    0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD, 0x0B, 0xFF,
-    0x04, 0x2F, 0xC2, 0xF7, 0xF3, 0xD2, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF, 0x80, 0xFF,
-    0x80, 0x3E, 0xB8, 0x00, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x14,
-    0x00, 0x00, 0x06, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0xD0, 0x1F, 0xE0, 0x5B, 0xF0, 0x0B, 0xF0, 0x02,
-    0xFC, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0xBF, 0x80, 0x0F, 0xE0, 0x7F, 0xD0,
-    0x03, 0xFE, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x06, 0xE4, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xD7, 0x40, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x14, 0x1F, 0xFC, 0x01,
-    0xFD, 0x03, 0xF8, 0x3F, 0xFD, 0x03, 0xFC, 0x0B, 0xF0, 0x16, 0xFD, 0x03, 0xF8, 0x0F, 0xF0, 0x01,
-    0xFC, 0x03, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0x03, 0xF8, 0x0B, 0xF0, 0x1F,
-    0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x3F, 0xC0, 0x0B, 0xF0, 0x1F, 0xD0, 0x3F, 0x80, 0x0F, 0xF0, 0x3F,
-    0xC0, 0xBF, 0x80, 0x0F, 0xD0, 0xBF, 0xC1, 0xFF, 0x40, 0x1F, 0xC1, 0xFF, 0x43, 0xFF, 0x44, 0x2F,
-    0xC7, 0xFF, 0x4F, 0x7F, 0xAE, 0x2F, 0xFF, 0x7F, 0xFE, 0x3F, 0xFD, 0x2F, 0xFE, 0x3F, 0xF8, 0x3F,
-    0xF8, 0x0F, 0xF4, 0x1F, 0xE0, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x04, 0x00, 0x14, 0x1F, 0xFC, 0x01, 0xFD, 0x03, 0xF8, 0x3F, 0xFD, 0x03, 0xFC, 0x0B, 0xF0, 0x16,
-    0xFD, 0x03, 0xF8, 0x0F, 0xF0, 0x01, 0xFC, 0x03, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF0, 0x0F,
-    0xD0, 0x03, 0xF8, 0x0B, 0xF0, 0x1F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x3F, 0xC0, 0x0B, 0xF0, 0x1F,
-    0xD0, 0x3F, 0x80, 0x0F, 0xF0, 0x3F, 0xC0, 0xBF, 0x80, 0x0F, 0xD0, 0xBF, 0xC1, 0xFF, 0x40, 0x1F,
-    0xC1, 0xFF, 0x43, 0xFF, 0x48, 0x2F, 0xC7, 0xFF, 0x4F, 0x7F, 0x6E, 0x2F, 0xFF, 0x7F, 0xFE, 0x3F,
-    0xFD, 0x2F, 0xFE, 0x3F, 0xF8, 0x3F, 0xFC, 0x0F, 0xF4, 0x1F, 0xE0, 0x2F, 0x7C, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x01, 0x54, 0x00, 0x40, 0x0B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0x55, 0x7F,
-    0x40, 0x3E, 0x00, 0xFC, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x09, 0x1F, 0xDA, 0x40, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0xFF, 0xEF, 0xF8, 0x01, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x02, 0xFC, 0x02,
-    0xFC, 0x02, 0xFC, 0x03, 0xF8, 0x01, 0xFE, 0x6F, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFC,
-    0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xC1, 0x6F, 0xD0, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x7F,
-    0x80, 0x3F, 0xC0, 0x00, 0x0B, 0xF4, 0x03, 0xF9, 0xA8, 0x00, 0xFF, 0x00, 0x7F, 0xFF, 0xF4, 0x0F,
-    0xF0, 0x0B, 0xFE, 0xFF, 0xC1, 0xFE, 0x00, 0xFE, 0x01, 0xFD, 0x1F, 0xD0, 0x0F, 0xE0, 0x0F, 0xD2,
-    0xFC, 0x00, 0xFD, 0x00, 0xFD, 0x3F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC3, 0xFC, 0xF0, 0xFF, 0x5B, 0xF4,
-    0x7F, 0xFF, 0x0B, 0xFF, 0xFD, 0x07, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0x6F, 0xD0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF9, 0xA9, 0x00, 0x7F, 0xFF, 0xF8, 0x0B,
-    0xFE, 0xFF, 0xD0, 0xFE, 0x00, 0xFE, 0x0F, 0xE0, 0x0B, 0xE0, 0xFD, 0x00, 0xFE, 0x0F, 0xD0, 0x1F,
-    0xD0, 0xFF, 0x9B, 0xF8, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xFE, 0x5F, 0xF8, 0x03, 0xC0,
-    0x0F, 0xF0, 0x04, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0xAA, 0xBF, 0xC0, 0x00, 0x01, 0xFD, 0x02, 0x40, 0x0B, 0xF0, 0x2F, 0x00, 0x7F, 0x80,
-    0xFF, 0x5B, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x54, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x0B, 0xFF, 0xFD,
-    0x05, 0xBF, 0x80, 0xBF, 0xEF, 0xFC, 0x01, 0xFE, 0x07, 0xF8, 0x0F, 0xF0, 0x07, 0xF4, 0x3F, 0xC0,
-    0x2F, 0xC0, 0x2F, 0xC1, 0xFD, 0x00, 0xBF, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFC, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xF0, 0x1F, 0xFA, 0xFE, 0x00, 0x3F, 0x80, 0xBF, 0x43, 0xF8, 0x01, 0xFD, 0x03, 0xFC,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xD0, 0xFF, 0x40, 0x7F, 0x80, 0xBF, 0xFF, 0xF4, 0x02,
-    0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xE0, 0x01, 0xFE,
-    0x47, 0xF4, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x03,
-    0xFD, 0x1F, 0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0xFE, 0x00,
-    0x02, 0xF8, 0x3F, 0x44, 0x62, 0xFC, 0x1F, 0xDB, 0x6F, 0xFD, 0x0B, 0xFF, 0xCF, 0xFE, 0x02, 0xFF,
-    0xD2, 0xFD, 0x00, 0x7F, 0x80, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x0B, 0xFF,
-    0x40, 0x07, 0xFF, 0xFC, 0x01, 0xFD, 0x2F, 0xC0, 0x3F, 0x01, 0xFC, 0x0F, 0xE0, 0x3F, 0x80, 0xFC,
-    0x0B, 0xF0, 0x2F, 0xC2, 0xFC, 0x03, 0xFE, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xFE, 0x40, 0x00,
-    0x3F, 0x80, 0x0B, 0x03, 0xFC, 0x07, 0xF0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x03, 0xFC, 0xBF,
-    0x40, 0x0F, 0xE2, 0xFC, 0x00, 0x2D, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xD2, 0xFC, 0x00, 0xFC,
-    0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x02, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x0F, 0xFB, 0xFC,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0xFF, 0x90, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x0F, 0xF0, 0x1F, 0xC0,
-    0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x05, 0xBF, 0xC0, 0x00, 0x00,
-    0x7F, 0x81, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x01,
-    0xFD, 0x01, 0x40, 0x02, 0xFC, 0x2F, 0xF0, 0x03, 0xFC, 0xFF, 0xF8, 0x03, 0xFB, 0xFF, 0xFC, 0x03,
-    0xFF, 0xC3, 0xFC, 0x07, 0xFF, 0x03, 0xFC, 0x0B, 0xFD, 0x03, 0xFC, 0x0F, 0xF8, 0x03, 0xFC, 0x0F,
-    0xF4, 0x03, 0xFC, 0x1F, 0xF0, 0x03, 0xFC, 0x2F, 0xE0, 0x03, 0xF8, 0x3F, 0xD0, 0x07, 0xF4, 0x3F,
-    0xC0, 0x0B, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x7F, 0x40, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x3F, 0x80, 0x01, 0x00, 0xFF, 0x00, 0x07, 0xD2, 0xFC, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xF0, 0x0F, 0xE5, 0xBF, 0x40, 0xF0, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00,
-    0x2F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x0D,
-    0x07, 0xF8, 0x07, 0xF0, 0x7F, 0xEB, 0xFD, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xE0, 0x2F, 0xFA, 0xFD,
-    0x07, 0xF8, 0x02, 0x80, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xF0, 0x03, 0xFD, 0x55, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x30, 0x3F, 0xD0, 0x2F, 0x82,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xD5, 0xFC, 0x02, 0xFC, 0x02, 0x40,
-    0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0x01, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFF, 0xAF, 0xD0, 0x2F,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xF4, 0x07, 0xFD, 0x00, 0xFF, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xF8, 0x3F, 0xFF,
-    0x05, 0xBF, 0x80, 0x1F, 0xD0, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0xBF, 0x40, 0x3F, 0xC0,
-    0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFD, 0x74, 0xBF, 0xFD, 0x2F, 0xFE, 0x07, 0xFD, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x03, 0xE1, 0xFD, 0x3F, 0xCB, 0xF0, 0xFE, 0x0A, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0xF0, 0x05, 0xBF, 0x80, 0x01, 0xFD,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
-    0x00, 0x07, 0xF4, 0x00, 0x2F, 0xD7, 0x40, 0xBF, 0xFD, 0x02, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x5F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x24, 0x0B, 0xF4, 0x00, 0x7E, 0x6F, 0xE0, 0x00, 0xBF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x7F,
-    0x80, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0xBF, 0x2A, 0x40, 0x00, 0x07, 0xD0, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0xFF, 0xEF, 0xF8,
-    0x00, 0x0F, 0x81, 0xFC, 0x03, 0xFC, 0x00, 0x2F, 0x42, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x02, 0xFC,
-    0x02, 0xFC, 0x29, 0xBE, 0x02, 0xFC, 0x03, 0xF4, 0x3F, 0xFC, 0x02, 0xFE, 0x6F, 0xF0, 0x3F, 0xF4,
-    0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0x02, 0xFD, 0x00,
-    0x01, 0x6F, 0xE0, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x3F, 0x80,
-    0x00, 0x02, 0xFC, 0x07, 0xF5, 0xA8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xC0, 0x7F, 0xAA, 0xFE, 0x01, 0xFD, 0x0B, 0xF4, 0x0F, 0xD0, 0x0F, 0xD0, 0xFF, 0x00, 0xFD,
-    0x00, 0xFD, 0x0F, 0xF0, 0x0F, 0xD0, 0x2F, 0xC1, 0xFE, 0x00, 0xFF, 0x5B, 0xF4, 0x2F, 0xD0, 0x07,
-    0xFF, 0xFD, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x16, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0x81, 0x40, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x40, 0x00, 0xBF, 0x07, 0xFD, 0x00, 0x3F, 0xCB, 0xFF, 0xC0, 0x0F, 0xEB, 0xFF,
-    0xF0, 0x03, 0xFF, 0xC3, 0xFC, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0xBF, 0xD0, 0x7F, 0x40, 0x3F, 0xE0,
-    0x2F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x07, 0xFC, 0x03, 0xF8, 0x02, 0xFE, 0x01, 0xFD, 0x00, 0xFF,
-    0x40, 0xBF, 0x5D, 0x3F, 0xC0, 0x3F, 0xFF, 0x4F, 0xF0, 0x0F, 0xFF, 0x87, 0xF4, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x05, 0x01, 0xFF,
-    0xE0, 0x1F, 0xF0, 0xFF, 0xF8, 0x2F, 0xFC, 0x16, 0xFD, 0x2F, 0xFE, 0x00, 0x7F, 0x1F, 0xD0, 0x00,
-    0x1F, 0xCF, 0xC0, 0x00, 0x0B, 0xEB, 0xC0, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x0F, 0xF1, 0xFD, 0x04, 0x03, 0xFC, 0x3F,
-    0xCB, 0x81, 0xFE, 0x07, 0xFF, 0xD0, 0xBF, 0x40, 0xFF, 0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50,
-    0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0,
-    0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00,
-    0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF,
-    0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F,
-    0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x1F, 0x00, 0x38, 0x00, 0x00, 0x3F, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0xDB,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0x02, 0xFE, 0x00,
-    0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00,
-    0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x2F,
-    0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD, 0x00, 0x00, 0x2F,
-    0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x01, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF,
-    0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC,
-    0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x0B, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00,
-    0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD, 0x0B, 0xFF, 0x04, 0x2F, 0xC2, 0xF7, 0xF7, 0xC2, 0xFF, 0xFC,
-    0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF, 0x00, 0xFF, 0x8B, 0x3F, 0x80, 0x00, 0x41, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x03, 0xFA, 0xBF, 0xEA, 0xFC, 0x0F, 0xC2, 0xFE, 0x03, 0xE0, 0x3D, 0x0B, 0xF4, 0x0F,
-    0x40, 0xB0, 0x3F, 0xC0, 0x38, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x94, 0x00, 0x00,
-    0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFC, 0x07, 0xFF, 0x00, 0x0F, 0xF0,
-    0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0xAA, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x01, 0xFF, 0xE0,
-    0xBF, 0xC0, 0x00, 0x3F, 0xFE, 0x3F, 0xFD, 0x00, 0x01, 0x6F, 0xEF, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xF1, 0xFD, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xC0, 0x00, 0x02, 0xFF, 0x02, 0xFC, 0x69, 0x00, 0x3F,
-    0xE0, 0x3F, 0xFF, 0xFC, 0x03, 0xFC, 0x03, 0xFF, 0xBF, 0xD0, 0x7F, 0x80, 0x7F, 0x00, 0xFF, 0x0B,
-    0xF4, 0x0B, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xBF, 0x00, 0xFE, 0x0F, 0xF0, 0x0B, 0xF0, 0x1F, 0xD1,
-    0xFE, 0x00, 0xBF, 0x9B, 0xF8, 0x2F, 0xD0, 0x03, 0xFF, 0xFE, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x0B, 0xFE,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x3F, 0xE0, 0x00, 0x03, 0xFD,
-    0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x8B, 0xFE, 0xAA, 0xAA, 0xBF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x83,
-    0xFE, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x40, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0xBF, 0xD7, 0xFD, 0x07, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x0F,
-    0xF1, 0xFD, 0x00, 0x3F, 0xCB, 0xFE, 0xAA, 0xFF, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xAA, 0xBF, 0xD3,
-    0xF8, 0x00, 0xFF, 0x0F, 0xE0, 0x07, 0xF8, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0xEB, 0xFC, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0xFF,
-    0xFC, 0x03, 0xFD, 0x00, 0x0B, 0xF9, 0xD0, 0x0F, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xE0, 0x03,
-    0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xFC,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x47, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0x40, 0x7F, 0xF4,
-    0x00, 0x7F, 0xC3, 0xFF, 0xE0, 0x03, 0xFF, 0x05, 0xBF, 0xC0, 0x3F, 0xFC, 0x01, 0xFF, 0x02, 0xFC,
-    0x00, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0xFD, 0x00, 0x00, 0x3F, 0xC7, 0xE0, 0x00, 0x00,
-    0xFF, 0x3F, 0x00, 0x00, 0x03, 0xFA, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00,
-    0x02, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xC0,
-    0xBF, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x0B, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x0B, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xFD, 0x40,
-    0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x0B, 0x80, 0x1D, 0x00, 0x00, 0xFC, 0x03, 0xC0, 0x00, 0x0F, 0xE6, 0xF8, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x01,
-    0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01, 0xFC, 0x02,
-    0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x0B,
-    0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD, 0x0B, 0xFE,
-    0x18, 0x2F, 0xC2, 0xF7, 0xE7, 0xC2, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF, 0xC0, 0xFF,
-    0x80, 0x3F, 0xF4, 0x00, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xAF, 0xFA, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00,
-    0x17, 0xFE, 0x54, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0x90, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0x2F, 0xF4, 0x00, 0xFF, 0x00, 0x3F,
-    0xE0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x03,
-    0xFD, 0x00, 0xBF, 0xC0, 0x1F, 0xFA, 0xAF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x03, 0xFF, 0xC0, 0x02, 0xFF, 0xF0,
-    0x00, 0x17, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-    0x80, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x9A, 0x90, 0x1F, 0xFF,
-    0xFE, 0x0B, 0xFE, 0xFF, 0xD3, 0xF8, 0x03, 0xF8, 0xFE, 0x00, 0xBE, 0x3F, 0x40, 0x3F, 0x8F, 0xD0,
-    0x1F, 0xD3, 0xFE, 0x6F, 0xE0, 0xBF, 0xFF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFB,
-    0xFE, 0x6F, 0xFC, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x07, 0xFC,
-    0x01, 0xFE, 0x00, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0x0F, 0xF5, 0xE3, 0xFC, 0x00, 0x0F, 0xF0, 0xF7,
-    0xF8, 0x00, 0x1F, 0xF0, 0xBF, 0xF0, 0x00, 0x2F, 0xFB, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0xFA, 0x6F, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0x00, 0x00, 0x7F, 0xC0, 0x04, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x40, 0x02, 0xFF, 0xC1,
-    0xFF, 0x80, 0x0F, 0xFF, 0x5F, 0xFF, 0x40, 0x16, 0xFE, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0x47, 0xF8,
-    0x00, 0x2F, 0xF4, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x1F,
-    0xE0, 0x0B, 0xF4, 0x00, 0x7F, 0x44, 0x2F, 0xC0, 0x02, 0xFC, 0xB4, 0xFE, 0x00, 0x0F, 0xF1, 0xF7,
-    0xF0, 0x00, 0x3F, 0x83, 0xFF, 0x40, 0x01, 0xFF, 0x9F, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xEF, 0xFE, 0x00, 0x00, 0xFE, 0x04, 0x3C, 0x00, 0x07, 0xF8, 0x00, 0xB4, 0x00, 0x2F, 0xD0,
-    0x01, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x02, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xAA, 0xA4, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x01, 0xAF, 0xF9,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x71,
-    0xFE, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0xAB, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD4, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x7F,
-    0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x7F, 0x96, 0xFD, 0x0D, 0x00, 0x7F, 0x40, 0x10, 0x2F, 0xC0, 0x1E,
-    0x3F, 0xE0, 0x03, 0xFF, 0xE0, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x03, 0xFD, 0x7C, 0x01, 0xFE,
-    0x05, 0x14, 0x7F, 0x80, 0x2F, 0x1F, 0xFA, 0xBF, 0xC3, 0xFF, 0xFF, 0xC0, 0x2F, 0xFE, 0x40, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xAB, 0xFC, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0x01,
-    0xF8, 0x00, 0x07, 0xFC, 0x01, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xE0, 0x1F, 0xF8, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x7F,
-    0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x01, 0xFF, 0x90,
-    0x0B, 0xF8, 0x1F, 0xFF, 0xF4, 0x0F, 0xF0, 0x3F, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0x81, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x80, 0xFC, 0x01, 0xFD, 0x02, 0xF0, 0x0B, 0xF0, 0x0B,
-    0x40, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x14, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0xFF, 0x07, 0xFE, 0x03, 0xFC, 0x03, 0xFC, 0x1F, 0xE0, 0x0B, 0xF0, 0x7F, 0x40, 0x2F, 0xC2, 0xFC,
-    0x00, 0xBF, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0xF4, 0x2F, 0xC0, 0x07, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xE4, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFE, 0x00,
-    0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0x40, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x02, 0xFD, 0x00,
-    0xFF, 0xFC, 0x00, 0x04, 0x7F, 0x00, 0xBF, 0x00, 0xBF, 0x09, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0xC0,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xF4,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xFF,
-    0x5F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x87, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC2,
-    0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x3F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xF0,
-    0x07, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xF0, 0x0B, 0xFE, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x05, 0x00, 0x01, 0x00, 0x05, 0x40, 0x0B, 0xFD, 0x02, 0xF4, 0x07, 0xFE, 0x03, 0xFF, 0xF0,
-    0x3F, 0x02, 0xFF, 0xF0, 0xBF, 0xFF, 0x43, 0xF0, 0x7F, 0xFE, 0x0F, 0x43, 0xF8, 0xBE, 0x0F, 0xC0,
-    0x40, 0x50, 0x2F, 0x9F, 0xD3, 0xF0, 0x00, 0x00, 0x02, 0xFB, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xDF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xE3, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x5F, 0xC0, 0x20, 0x30, 0x3F,
-    0x07, 0xE1, 0xFE, 0x1F, 0x4B, 0xFF, 0xD0, 0xBD, 0x0F, 0xFF, 0xF0, 0xFF, 0xF8, 0x0F, 0xC0, 0xFF,
-    0xFF, 0x07, 0xFD, 0x00, 0xF8, 0x03, 0xF9, 0xF0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x6A, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xF9, 0x5F, 0xFC,
-    0x00, 0xFC, 0x01, 0xFF, 0x00, 0x7D, 0x00, 0x3F, 0xC0, 0x0E, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xAF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x2C,
-    0x00, 0x0F, 0xF8, 0x2F, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x07, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x90,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x03, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0x96, 0xFD,
-    0x03, 0x80, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0x3F,
-    0xFE, 0x00, 0x01, 0x5B, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x90, 0x03, 0xFC, 0x2F, 0x00, 0x7F, 0x83,
-    0xFD, 0x6F, 0xF0, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x06, 0x2F, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x3F,
-    0xFC, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x24, 0x00, 0x07, 0xFC,
-    0x07, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x2F, 0x40, 0x00, 0x00,
-    0x0F, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x00,
-    0xBF, 0x80, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x90, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x54, 0x00, 0x14, 0x07, 0xFF, 0x80, 0x7F, 0xC3, 0xFF, 0xE0, 0xBF, 0xF0, 0x5B, 0xF4,
-    0xBF, 0xF8, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x7F, 0x3F, 0x00, 0x00, 0x2F, 0xAF, 0x00, 0x00, 0x0F,
-    0xEF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00,
-    0x3F, 0xC7, 0xF4, 0x10, 0x0F, 0xF0, 0xFF, 0x2E, 0x07, 0xF8, 0x1F, 0xFF, 0x82, 0xFD, 0x03, 0xFF,
-    0xD0, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0xFD, 0x00,
-    0xBF, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x46, 0x00, 0x01,
-    0xFF, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x9D, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0xDB, 0x1F, 0x80,
-    0x00, 0x00, 0x0F, 0xF2, 0xCF, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0xFB, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD7, 0x6F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF2, 0xC7, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0xF0, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x14,
-    0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0x00,
-    0x1F, 0xF9, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0x40, 0x7F, 0xF8,
-    0x00, 0x3F, 0xC3, 0xFF, 0xE0, 0x03, 0xFF, 0x05, 0xBF, 0x80, 0x3F, 0xF8, 0x01, 0xFD, 0x02, 0xF4,
-    0x00, 0x07, 0xF3, 0x8F, 0x40, 0x00, 0x2F, 0xCD, 0xF4, 0x00, 0x00, 0xFF, 0xBB, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xDE, 0x7E, 0x00, 0x00, 0xBF, 0x74, 0xFC, 0x00, 0x03, 0xFD, 0xD3,
-    0xF4, 0x10, 0x0F, 0xF0, 0x0B, 0xF2, 0xE0, 0x7F, 0x80, 0x0F, 0xFF, 0x42, 0xFD, 0x00, 0x3F, 0xFC,
-    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4,
-    0x00, 0x3F, 0xFF, 0xF0, 0x0B, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x2F, 0xFE, 0x00, 0x07, 0xFE, 0x00,
-    0xBF, 0xFC, 0x00, 0x03, 0xFC, 0x01, 0xFD, 0x18, 0x00, 0xAB, 0xFE, 0x83, 0xF4, 0x00, 0x00, 0xFF,
-    0xFF, 0x8B, 0xD0, 0x00, 0x00, 0x5F, 0xF9, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xF9, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x00,
-    0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x90, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xF4, 0x07,
-    0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x14, 0x2F, 0xFF, 0xC1, 0xFD, 0x2F, 0xFF,
-    0x8B, 0xFE, 0x02, 0xFC, 0x2F, 0xFD, 0x02, 0xF8, 0x7F, 0x00, 0x03, 0xF4, 0xF8, 0x00, 0x03, 0xF3,
-    0xE0, 0x00, 0x07, 0xFB, 0xD0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F, 0xFB, 0xF0, 0x00, 0x0F, 0xF3,
-    0xF8, 0x00, 0x1F, 0xE2, 0xFC, 0x04, 0x2F, 0xD1, 0xFE, 0x3D, 0x2F, 0xD0, 0xFF, 0xFC, 0x3F, 0xC0,
-    0x7F, 0xF4, 0x3F, 0x80, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x03, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xF0, 0xBF, 0xAF, 0xFD,
-    0x00, 0xFF, 0xF8, 0x3F, 0x02, 0xFE, 0x00, 0xFE, 0x08, 0x0F, 0xC0, 0xFF, 0x40, 0xBE, 0x00, 0x03,
-    0xE0, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x60, 0x1F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x2F,
-    0x40, 0x00, 0x00, 0x02, 0xFF, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xE0,
-    0x00, 0x00, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0x40, 0x00, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x40, 0x2F, 0xFF, 0xD0, 0x3F, 0xC2, 0xFF, 0xFF,
-    0x03, 0xFF, 0x4F, 0x82, 0xFC, 0x3F, 0xFC, 0x3E, 0x0F, 0xE3, 0xF8, 0x00, 0xFC, 0x3F, 0x6F, 0x40,
-    0x00, 0x91, 0xFD, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xFD, 0x00, 0x00, 0x1F, 0xD3, 0xF8, 0x04, 0x00, 0xBF, 0x0B,
-    0xF5, 0xF0, 0x03, 0xFC, 0x0F, 0xFF, 0xC0, 0x0F, 0xF0, 0x2F, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F,
-    0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x0B, 0xF4, 0x3F, 0xFF, 0x00, 0xBF, 0x41, 0x6F, 0xE0, 0x0F, 0xF0, 0x01, 0xFE,
-    0x00, 0xFF, 0x00, 0x1F, 0xD0, 0x1F, 0xE0, 0x02, 0xFC, 0x02, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xAA, 0xBF, 0x80, 0x0B, 0xF4, 0x07, 0xF4, 0x00, 0xFF, 0x00,
-    0xBF, 0x08, 0x0F, 0xF0, 0x0F, 0xF2, 0xE1, 0xFE, 0x00, 0xFF, 0xFC, 0x2F, 0xD0, 0x0F, 0xFF, 0xC3,
-    0xFC, 0x00, 0xBF, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xAB, 0xFC, 0x00, 0x03,
-    0xFD, 0x00, 0x03, 0xFC, 0x0B, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x2F, 0x40, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0x80, 0xBC, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0x01, 0x80, 0x00, 0x0F, 0xF4,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xF9,
-    0x00, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xFF, 0x43, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xFF, 0x05, 0xBF, 0x80, 0x3F, 0xD5, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x03, 0xE0, 0x07,
-    0xF4, 0x07, 0xF8, 0x7F, 0x00, 0x2F, 0xC0, 0x2F, 0xD1, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xEA, 0xAF, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0x40,
-    0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF2, 0xC0, 0x00, 0x7F, 0x80, 0x3F,
-    0xFF, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0xAF,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xBF,
-    0x90, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x02, 0xFE, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x0F, 0xF4, 0x3F,
-    0xFF, 0xE0, 0xBF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x41, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x00, 0x1F, 0xFE, 0x0B, 0xFD,
-    0x00, 0x00, 0x3F, 0xFE, 0x3F, 0xFF, 0x00, 0x00, 0x16, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xF1, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC1, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x02, 0xFE, 0x69, 0x00,
-    0x03, 0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xF8, 0x03, 0xFC,
-    0x0B, 0xF8, 0x0B, 0xF4, 0x07, 0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0x0B, 0xF4, 0x02, 0xFC, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x02, 0xFC, 0x1F, 0xE0, 0x0F, 0xF0, 0x02, 0xFC, 0x2F, 0xD0, 0x1F, 0xE0, 0x02, 0xFC,
-    0x3F, 0xC0, 0x1F, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xE0, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x80, 0x00,
-    0x00, 0x00, 0x05, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFE,
-    0x00, 0xFF, 0x9F, 0xF0, 0x0B, 0xFC, 0x02, 0xFC, 0x07, 0xF8, 0x0F, 0xF4, 0x03, 0xF4, 0x03, 0xF8,
-    0x1F, 0xF0, 0x0B, 0xF0, 0x03, 0xF8, 0x2F, 0xE0, 0x0F, 0xF0, 0x03, 0xF8, 0x3F, 0xD0, 0x0F, 0xE0,
-    0x07, 0xF4, 0x3F, 0xD0, 0x0F, 0xE0, 0x0B, 0xF0, 0x3F, 0xD0, 0x1F, 0xE0, 0x0F, 0xF0, 0x3F, 0xD0,
-    0x0F, 0xE0, 0x1F, 0xD0, 0x3F, 0xE0, 0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xF0, 0x0F, 0xF0, 0xBF, 0x40,
-    0x1F, 0xF4, 0x07, 0xF9, 0xFD, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFB, 0xFF,
-    0xF5, 0x6D, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xEB, 0xFF, 0xE0, 0x00, 0x00,
-    0x10, 0x00, 0x04, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xF4,
-    0x05, 0x40, 0x00, 0xFF, 0x01, 0xFF, 0xD0, 0x0B, 0xF0, 0x2F, 0xFF, 0xC0, 0x3F, 0x41, 0xFC, 0x3F,
-    0x81, 0xFC, 0x0F, 0xC0, 0xBE, 0x0F, 0xE0, 0x3F, 0x02, 0xF8, 0x3F, 0x41, 0xFC, 0x0F, 0xD0, 0xFD,
-    0x07, 0xE0, 0x3F, 0x03, 0xF8, 0x1F, 0xC2, 0xF8, 0x0F, 0xF0, 0x3F, 0x0F, 0xC0, 0x2F, 0xC0, 0xFE,
-    0xFC, 0x00, 0x7F, 0xD1, 0xFF, 0xC0, 0x40, 0xBF, 0xFF, 0xFF, 0xAF, 0x00, 0x7F, 0xFE, 0xFF, 0xF4,
-    0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xAA, 0xFE, 0x00, 0xFF, 0xE0, 0x02, 0xF4, 0x0B, 0xFC, 0x00,
-    0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x3E, 0x02, 0xFE, 0x00, 0x00, 0x50, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x60, 0x2F, 0xFC, 0x00, 0x0B, 0xC0, 0x3F, 0xFE, 0x56, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xD0, 0x07, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFE, 0x03, 0xFC, 0x07, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x28, 0x3F, 0xF0, 0x7F,
-    0x0F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00,
-    0x01, 0x8B, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0xFF,
-    0xAB, 0xFC, 0x3F, 0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF, 0x01, 0xF4, 0x3E, 0x02, 0xFE, 0x02,
-    0xF0, 0x18, 0x03, 0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x50, 0x01, 0xFF, 0xD0, 0xBF, 0x80,
-    0xFF, 0xC0, 0x3F, 0xFE, 0x3F, 0xFC, 0x7F, 0xFC, 0x01, 0x6F, 0xDF, 0xFF, 0xDF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xE1, 0xFF, 0xD2, 0xFC, 0x00, 0x1F, 0xFC, 0x2F, 0xF8, 0x3F, 0xC0, 0x02, 0xFF, 0x03, 0xFF,
-    0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x07, 0xFC, 0x0B, 0xF4, 0x00,
-    0x7F, 0x80, 0xBF, 0x40, 0xFF, 0x00, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0xFF,
-    0x01, 0xFD, 0x14, 0x0F, 0xF0, 0x1F, 0xE0, 0x2F, 0xE7, 0xC1, 0xFE, 0x02, 0xFD, 0x02, 0xFF, 0xF8,
-    0x2F, 0xD0, 0x2F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x03, 0xF8, 0x01, 0xFD, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF,
-    0x40, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFF,
-    0x4F, 0xE0, 0x00, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0xBF, 0xD0, 0x3F, 0xD7, 0xFF, 0xC0, 0xFF, 0x9A, 0xFF,
-    0x01, 0xFE, 0x02, 0xFD, 0x03, 0xF8, 0x07, 0xF4, 0x1F, 0xD0, 0x1F, 0xE0, 0x7F, 0x00, 0x3F, 0x82,
-    0xF8, 0x00, 0xFE, 0x0F, 0xC0, 0x02, 0xFC, 0xBD, 0x00, 0x0B, 0xF3, 0xE0, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xFE,
-    0x40, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x0F, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x07,
-    0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x03,
-    0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x4F, 0xE0, 0x00, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xBF, 0xFE, 0x90, 0x00, 0x02, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x16, 0xFF, 0x54, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0xBF, 0xD0, 0x3F,
-    0xD7, 0xFF, 0xC0, 0xFF, 0x9A, 0xFF, 0x01, 0xFE, 0x02, 0xFD, 0x03, 0xF8, 0x07, 0xF4, 0x1F, 0xD0,
-    0x1F, 0xE0, 0x7F, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0xFE, 0x0F, 0xC0, 0x02, 0xFC, 0xBD, 0x00, 0x0B,
-    0xF3, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x01, 0xAF, 0xFE,
-    0x90, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0xAA, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x01,
-    0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x1F,
-    0xF9, 0x00, 0x2F, 0xFF, 0xD0, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xC1, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x05, 0x00, 0x05, 0x40, 0x1F, 0xF4, 0x03, 0xFE, 0x07, 0xFF, 0xC0, 0xFF, 0xE0,
-    0x7F, 0xFD, 0x2F, 0xFD, 0x00, 0x1F, 0xE7, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFB, 0xF8, 0x20, 0x25, 0xBE, 0x3F, 0xDF, 0x83, 0xFF, 0xC2, 0xFF,
-    0xF4, 0x7F, 0xF0, 0x0F, 0xFF, 0x03, 0xFC, 0x00, 0xBE, 0xF0, 0x04, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x02, 0xF9, 0xFF, 0x6F, 0x80, 0xFF, 0xC0,
-    0x0F, 0xC3, 0xFC, 0x3D, 0x03, 0xFD, 0x00, 0x3E, 0x1F, 0xE1, 0xF0, 0x0F, 0xF0, 0x00, 0xB4, 0x7F,
-    0x47, 0x80, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0xAA, 0xAF, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
-    0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x3D, 0x2F, 0xFF, 0xCB,
-    0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF8, 0x0F, 0xF8, 0x03, 0xEB, 0x80, 0x04, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xE3, 0xFF, 0xFD, 0x2F, 0xFF, 0xF0, 0x1F, 0xF8, 0x01, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xE0,
-    0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00,
-    0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xF9, 0x6F, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xA5, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0xD0, 0x1F,
-    0xE0, 0x5B, 0xF0, 0x0B, 0xF0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x3F, 0x80,
-    0xBF, 0x80, 0x0F, 0xE0, 0x7F, 0xD0, 0x03, 0xFE, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x06,
-    0xE4, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x48, 0x00, 0x00, 0x2F, 0xDB, 0xC0, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xD1,
-    0xFF, 0xFF, 0x40, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x83, 0x83, 0xFD, 0x00, 0x0F, 0xF8,
-    0x78, 0x7F, 0xC0, 0x00, 0xBF, 0xCB, 0x4B, 0xFC, 0x00, 0x0B, 0xFE, 0xF9, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0x5F, 0xF0, 0x00, 0x00,
-    0x02, 0xD2, 0xFF, 0x00, 0x00, 0x00, 0x2D, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0x83, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x3F, 0xC3, 0xFF,
-    0xC0, 0x0F, 0xF0, 0x5B, 0xF0, 0x07, 0xF4, 0x02, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00,
-    0x3F, 0x4D, 0x3F, 0xC0, 0x0F, 0xD7, 0x5F, 0xE0, 0x03, 0xFE, 0xEF, 0xF4, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x06, 0xFC, 0xFF, 0x00, 0x00, 0x0E, 0x3F, 0x80, 0x00, 0x03, 0x5F, 0xE7, 0x80, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0xBF, 0x90, 0x00, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0x2F,
-    0xE0, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x01, 0xFF,
-    0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x1F, 0xF9,
-    0x01, 0xFF, 0xD0, 0x7F, 0xFF, 0xD3, 0xFF, 0xFE, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0x40, 0x00, 0x05,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x16, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x05, 0x40,
-    0x01, 0xFD, 0x1F, 0xF8, 0x00, 0xBF, 0x2F, 0xFF, 0x00, 0x2F, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0x4B,
-    0xF0, 0x03, 0xFF, 0x43, 0xFC, 0x01, 0xFF, 0x80, 0xFE, 0x00, 0xBF, 0xC0, 0x7F, 0x40, 0x3F, 0xD0,
-    0x2F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0xFF,
-    0x40, 0xBF, 0x5D, 0x3F, 0xC0, 0x3F, 0xFF, 0x4F, 0xF0, 0x0F, 0xFF, 0x87, 0xF4, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x16, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xAF, 0xFD, 0x1F, 0x42, 0xFF, 0x00, 0x3F, 0xF7,
-    0xE0, 0x7F, 0xC0, 0x01, 0xFF, 0xFD, 0x0F, 0xF4, 0x00, 0x1F, 0xFF, 0xD1, 0xFF, 0x00, 0x02, 0xFE,
-    0xFE, 0x3F, 0xD0, 0x00, 0x2F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xA0, 0x00, 0x7F, 0xE0, 0x00,
-    0x2F, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x0B,
-    0xE0, 0x3F, 0x4B, 0x87, 0xF0, 0x1F, 0xC7, 0xC3, 0xF8, 0x0F, 0xE2, 0xF0, 0xFD, 0x1F, 0xE0, 0x7E,
-    0x7F, 0xBF, 0xD0, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x74,
-    0x00, 0xBF, 0x80, 0xBE, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xAF, 0xFD, 0x1F, 0x42, 0xFF, 0x00,
-    0x3F, 0xF7, 0xE0, 0x7F, 0xC0, 0x01, 0xFF, 0xFD, 0x0F, 0xF4, 0x00, 0x1F, 0xFF, 0xD1, 0xFF, 0x00,
-    0x02, 0xFE, 0xFE, 0x3F, 0xD0, 0x00, 0x2F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xA0, 0x00, 0x7F,
-    0xE0, 0x00, 0x2F, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0F, 0xE1,
-    0xFE, 0x00, 0x0B, 0xE0, 0x3F, 0x4B, 0x87, 0xF0, 0x1F, 0xC7, 0xC3, 0xF8, 0x0F, 0xE2, 0xF0, 0xFD,
-    0x1F, 0xE0, 0x7E, 0x7F, 0xBF, 0xD0, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x74, 0x00, 0xBF, 0x80, 0xBE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xC0,
-    0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x02, 0xFD, 0x00, 0xFF, 0xFC,
-    0x00, 0x04, 0x7F, 0x00, 0xBF, 0x00, 0xBF, 0x09, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0xC0, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xF4, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xC2, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xFF, 0x5F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFC, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0x80,
-    0x7F, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x07, 0xF4,
-    0x02, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xF0, 0x0B, 0xFE, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05, 0x40,
-    0x0B, 0xFD, 0x02, 0xF4, 0x07, 0xFE, 0x03, 0xFF, 0xF0, 0x3F, 0x02, 0xFF, 0xF0, 0xBF, 0xFF, 0x43,
-    0xF0, 0x7F, 0xFE, 0x0F, 0x43, 0xF8, 0xBE, 0x0F, 0xC0, 0x40, 0x50, 0x2F, 0x9F, 0xD3, 0xF0, 0x00,
-    0x00, 0x02, 0xFB, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xE3, 0xFD, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x3F, 0x5F, 0xC0, 0x20, 0x30, 0x3F, 0x07, 0xE1, 0xFE, 0x1F, 0x4B, 0xFF, 0xD0,
-    0xBD, 0x0F, 0xFF, 0xF0, 0xFF, 0xF8, 0x0F, 0xC0, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0xF8, 0x03, 0xFE,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x3F,
-    0xFF, 0xF0, 0x0B, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x2F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xFC,
-    0x00, 0x03, 0xFC, 0x01, 0xFD, 0x18, 0x00, 0x07, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x0F,
-    0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xFB, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xE0, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x03,
-    0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x00, 0xFF,
-    0x40, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x90, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x03, 0xFC, 0x00,
-    0x3F, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x02, 0xD0, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x14, 0x07, 0xFF,
-    0x80, 0x3F, 0xC3, 0xFF, 0xE0, 0x3F, 0xF0, 0x5B, 0xF8, 0x2F, 0xF8, 0x01, 0xFD, 0x1F, 0x80, 0x00,
-    0x7F, 0x0F, 0xC0, 0x00, 0x2F, 0xC7, 0xD0, 0x00, 0x0F, 0xF2, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x46, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xE0, 0x07,
-    0xF4, 0x07, 0xF8, 0x01, 0xFD, 0x02, 0xFD, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07, 0x81, 0xFD, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x7F, 0xA6, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x1F,
-    0xF0, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x2F, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x00, 0x0F, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x07, 0xFF, 0xD0, 0x06,
-    0xFF, 0x90, 0x01, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xFF, 0xFF, 0x80, 0x01,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0x9F, 0xF0, 0x00, 0x01, 0xF8, 0x3F, 0xC0, 0x00, 0x0B, 0xC0,
-    0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF4, 0x00, 0x01, 0xF4, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0xFE, 0x00,
-    0x00, 0x3E, 0x07, 0xF4, 0x00, 0x02, 0xF4, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0xFF, 0x08, 0x29, 0xBE,
-    0x03, 0xFC, 0xF8, 0xFF, 0xF0, 0x0F, 0xFF, 0xD3, 0xFF, 0x40, 0x3F, 0xFF, 0x0F, 0xF4, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF,
-    0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80,
-    0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x2F, 0xD3, 0xFF, 0xF0,
-    0x0B, 0xF4, 0x5B, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x2F,
-    0xC0, 0x2F, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFE, 0xAA, 0xFF, 0x00,
-    0xBF, 0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC,
-    0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x07, 0x83, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x0B, 0xF4, 0x3F, 0xFF, 0x00, 0xBF, 0x41, 0x6F, 0xE0, 0x0F, 0xF0,
-    0x01, 0xFE, 0x00, 0xFF, 0x00, 0x1F, 0xD0, 0x1F, 0xE0, 0x02, 0xFC, 0x02, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xAA, 0xBF, 0x80, 0x0B, 0xF4, 0x07, 0xF4, 0x00,
-    0xFF, 0x00, 0xBF, 0x08, 0x0F, 0xF0, 0x0F, 0xF3, 0xE1, 0xFE, 0x00, 0xFF, 0xFD, 0x2F, 0xD0, 0x0F,
-    0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xE3, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xF0, 0x1F, 0xF8, 0x01, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF4,
-    0x00, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0,
-    0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xF9, 0x6F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xA5, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0xD0, 0x1F, 0xE0, 0x5B, 0xF0, 0x0B, 0xF0,
-    0x02, 0xFC, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0xBF, 0x80, 0x0F, 0xE0, 0x7F,
-    0xD0, 0x03, 0xFE, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x06, 0xE4, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x0F, 0xEF, 0xC0, 0x00, 0x0B,
-    0xDB, 0xF0, 0x2F, 0x7F, 0xC0, 0x00, 0x0F, 0xCB, 0xF0, 0x3E, 0x3F, 0xC0, 0x00, 0x0F, 0xC7, 0xF4,
-    0xFC, 0x3F, 0xC0, 0x00, 0x2F, 0x83, 0xF9, 0xF8, 0x3F, 0xC0, 0x00, 0x3F, 0x43, 0xFB, 0xF0, 0x3F,
-    0x80, 0x00, 0x3F, 0x03, 0xFF, 0xE0, 0x7F, 0x80, 0x00, 0x7E, 0x02, 0xFF, 0xC0, 0x7F, 0x80, 0x00,
-    0xFD, 0x02, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00,
-    0xFD, 0x00, 0xBF, 0x40, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x50, 0x01,
-    0xFF, 0xD4, 0x3F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40,
-    0x00, 0xBF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x02,
-    0xFF, 0xE0, 0x00, 0x0F, 0xBF, 0x43, 0xEF, 0xD0, 0x00, 0x0F, 0x6F, 0x8B, 0xCF, 0xC0, 0x00, 0x1F,
-    0x5F, 0x8F, 0x5F, 0xC0, 0x00, 0x1F, 0x1F, 0xEF, 0x2F, 0xC0, 0x00, 0x2F, 0x1F, 0xFD, 0x2F, 0x80,
-    0x00, 0x3E, 0x0F, 0xFC, 0x3F, 0x40, 0x00, 0x3D, 0x0F, 0xF4, 0x3F, 0x40, 0x00, 0xBC, 0x0F, 0xF0,
-    0x3F, 0x08, 0x24, 0xFC, 0x0F, 0xE0, 0x7F, 0x7E, 0x3F, 0xF4, 0x0F, 0xC0, 0x7F, 0xFD, 0x3F, 0xF0,
-    0x0F, 0xC0, 0x7F, 0xFC, 0x3F, 0xC0, 0x09, 0x00, 0x3F, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x15,
-    0x55, 0x40, 0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFE, 0x40, 0x07, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0x00,
-    0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x0B,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD,
-    0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0x7C, 0x00, 0xE0, 0x00, 0x3F, 0x00, 0xF4, 0x00, 0x0F, 0xF6, 0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07, 0xFF, 0x6F,
-    0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00,
-    0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xC3, 0xEF, 0xEB, 0x8F,
-    0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xD0, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x29, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x1F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xFD, 0x00, 0x00, 0x01, 0xFC,
-    0x07, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x55, 0x7F, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFD, 0x55, 0x5B, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x02, 0xFF,
-    0x91, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xDB, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x2F, 0x40, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x07,
-    0x80, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x14, 0x00,
-    0x1F, 0xFD, 0xBF, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x1F, 0xF9, 0xFF, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0B, 0xF4, 0x03, 0xF8, 0x03, 0xFC, 0x01, 0xFD, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x7F,
-    0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F, 0xF4, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0F,
-    0xBF, 0xAE, 0x3F, 0xFF, 0xCF, 0xFF, 0x8B, 0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x40, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0xAB, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x40,
-    0x0F, 0x40, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2F, 0x8B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFE, 0x5A, 0x90,
-    0x00, 0x00, 0x00, 0xFD, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x40, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x0B, 0x80, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3E, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x2F,
-    0xD0, 0x01, 0xBF, 0xEA, 0xFF, 0xD0, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0x80, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x15, 0x00, 0x00, 0x3F, 0xFE, 0x0B,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xE6, 0xFF, 0xD3, 0xFC, 0x03, 0xFC, 0x01,
-    0xFC, 0x0B, 0xF0, 0x2F, 0xD0, 0x0F, 0xD0, 0x3F, 0x80, 0xFF, 0x00, 0x7F, 0x02, 0xFC, 0x07, 0xF8,
-    0x03, 0xFC, 0x2F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFB, 0xF8, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x40, 0x03,
-    0xFC, 0x07, 0xFF, 0x90, 0x00, 0x0F, 0xF0, 0x3F, 0xF8, 0x00, 0xB0, 0x3F, 0xC3, 0xEF, 0xF0, 0x1F,
-    0xC0, 0xFF, 0xFF, 0x2F, 0xFF, 0xFE, 0x02, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
-    0x40, 0x07, 0x00, 0x00, 0x01, 0xF4, 0x03, 0xC0, 0x00, 0x00, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00,
-    0x1F, 0x40, 0x00, 0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04,
-    0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4,
-    0x00, 0x1F, 0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xE0, 0x07, 0x40, 0x0F, 0xC0, 0x3C,
-    0x00, 0x3F, 0x9B, 0xE0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0x4B, 0xF0, 0x03, 0xF0,
-    0x1F, 0xC0, 0x3F, 0x80, 0xFE, 0x00, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0, 0xBF, 0x00, 0x3F, 0xEF, 0xF0,
-    0x00, 0xFF, 0xFD, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x0F, 0xE0, 0x02, 0xC0, 0x3F, 0xC0, 0x7F, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE6,
-    0xFF, 0xF0, 0x03, 0xF4, 0x00, 0x7F, 0xE0, 0x0B, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0x00,
-    0xFF, 0x87, 0xFC, 0x00, 0x07, 0xFC, 0x2F, 0xE0, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x02, 0xFF, 0x01,
-    0xFF, 0x40, 0x7F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x07, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0x40, 0xFF, 0x5B, 0xFC, 0x0F, 0x40, 0x2F, 0xC0, 0x90, 0x02, 0xFC, 0x00, 0x02, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFC, 0x02, 0xFF, 0x6F, 0xC0, 0xBF, 0x43, 0xF8, 0x2F, 0xC0, 0x7F, 0x43, 0xF4,
-    0x0F, 0xF0, 0x7F, 0x02, 0xFD, 0x07, 0xF9, 0xBF, 0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x1A, 0x00, 0x00, 0x0F, 0xE1, 0xFD, 0x00, 0x00, 0xBF,
-    0x8F, 0xF0, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFE, 0x6F, 0xFF, 0x00, 0x3F, 0x40, 0x07, 0xFE, 0x00, 0xB0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x03, 0xFE, 0x0B, 0xFC, 0x00, 0x2F,
-    0xF0, 0x1F, 0xF4, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xBC,
-    0x00, 0xFF, 0x2F, 0xD0, 0x0F, 0xE2, 0xFC, 0x00, 0xB4, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x0F, 0xF5, 0xBF, 0xC0,
-    0xF4, 0x02, 0xFC, 0x09, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x2F, 0xF6,
-    0xFC, 0x0B, 0xF4, 0x3F, 0x82, 0xFC, 0x07, 0xF4, 0x3F, 0x40, 0xFF, 0x07, 0xF0, 0x2F, 0xD0, 0x7F,
-    0x9B, 0xF8, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x68, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x7F, 0xD0, 0x0F, 0xFF, 0xE0, 0x0F, 0xFC, 0x00,
-    0x2F, 0xFC, 0x07, 0xFF, 0xF4, 0x0F, 0xFF, 0x40, 0x07, 0xFF, 0x80, 0x2F, 0xD0, 0x0F, 0xFF, 0xC0,
-    0x00, 0x47, 0xF0, 0x0B, 0xF0, 0x0B, 0xF0, 0x90, 0x00, 0x00, 0xBD, 0x03, 0xFC, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0xFE, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x42, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x2F, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x9F, 0xF5, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x7F, 0x47, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xC0, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xF8, 0x07,
-    0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0x40,
-    0x2F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x2F, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0xBF, 0xFF,
-    0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x54, 0x00, 0xBF, 0xD0, 0x2F, 0x40, 0x7F, 0xE0, 0x3F,
-    0xFF, 0x03, 0xF0, 0x2F, 0xFF, 0x0B, 0xFF, 0xF4, 0x3F, 0x07, 0xFF, 0xE0, 0xF4, 0x3F, 0x8B, 0xE0,
-    0xFC, 0x04, 0x05, 0x02, 0xF9, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0xCB, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF6, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xC3, 0xF5, 0xFC, 0x02, 0x03,
-    0x03, 0xF0, 0x7E, 0x1F, 0xE1, 0xF4, 0xBF, 0xFD, 0x0B, 0xD0, 0xFF, 0xFF, 0x0F, 0xFF, 0x80, 0xFC,
-    0x0F, 0xFF, 0xC0, 0x7F, 0xD0, 0x0F, 0x80, 0x3F, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x90, 0x29, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x1F, 0xF0, 0x00, 0x3F, 0x43,
-    0xF4, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0x95, 0xFF, 0xC0, 0x0F, 0xC0, 0x1F, 0xF0, 0x07,
-    0xD0, 0x03, 0xFC, 0x00, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x2A, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x02, 0xC0, 0x00, 0xFF, 0x82, 0xF0, 0x00,
-    0x3F, 0xC0, 0xFF, 0x00, 0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFF, 0x90, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x03,
-    0xFC, 0xBF, 0x40, 0x0F, 0xE2, 0xFC, 0x00, 0x2D, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0x96, 0xFD,
-    0x00, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x15, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x90, 0x03, 0xFC, 0x0B, 0xC0,
-    0x1F, 0xE0, 0x3F, 0xD6, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xAB, 0xFE, 0x00, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0x80, 0x2F, 0xE0, 0x00, 0xF0, 0x0B, 0xF8,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0xB4, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x07, 0xFC, 0x03, 0xFD, 0x01,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x01, 0xFE, 0x00, 0x1F, 0x00, 0x3F, 0x80, 0x00,
-    0x40, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x01, 0xC0, 0x00, 0x7F, 0x40, 0x7E, 0x00, 0x0F, 0xF0, 0x0B, 0xF8, 0x07, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x02, 0xFE, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x2F, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF3, 0xFC, 0x2F, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0xBF, 0xE4, 0x00, 0x1F, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
-    0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB,
-    0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x68, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
-    0x40, 0x7F, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0xCF, 0xF0, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0xD0,
-    0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0,
-    0x00, 0x01, 0xFF, 0x90, 0x02, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xE0, 0xBF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0x43, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x00,
-    0x0F, 0xF2, 0xFD, 0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x0B, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF,
-    0xE0, 0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0,
-    0x1F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C,
-    0x2F, 0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x02, 0x90, 0x00, 0x00, 0x1F, 0xD3, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0xFF, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xAF, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xE0, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x1F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF,
-    0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x0B, 0xFD,
-    0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7D, 0x00, 0x0F, 0xF1,
-    0xFE, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x07, 0x80, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0x6F,
-    0xF4, 0x07, 0xF8, 0x0B, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x2F, 0xD0, 0x03,
-    0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F,
-    0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x1F,
-    0xF4, 0x00, 0x00, 0xFF, 0x8B, 0xFE, 0xAA, 0xAA, 0xBF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x83, 0xFE,
-    0x00, 0x00, 0x7F, 0xD0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
-    0x40, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0x00, 0xBF, 0xD7, 0xFD, 0x07, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF1,
-    0xFD, 0x00, 0x3F, 0xCB, 0xFE, 0xAA, 0xFF, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xAA, 0xBF, 0xD3, 0xF8,
-    0x00, 0xFF, 0x0F, 0xE0, 0x07, 0xF8, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0xEB, 0xFC, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x02, 0x90, 0x00, 0x00,
-    0x1F, 0xD3, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00,
-    0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xAF, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0xBF, 0xE0, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x43, 0xFE, 0x00,
-    0x00, 0x3F, 0xD1, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0xBF, 0xEA, 0xAA, 0xAB, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x03,
-    0xFF, 0x00, 0x3F, 0xF4, 0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x7D, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x07, 0x80, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0x5F, 0xF4, 0x07, 0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC,
-    0x1F, 0xD0, 0x03, 0xFC, 0x2F, 0xFA, 0xAB, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xEA, 0xAF, 0xF4,
-    0x3F, 0x80, 0x0F, 0xF0, 0x3F, 0x80, 0x1F, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xFA, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x0A,
-    0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00,
-    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xA4, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xF9, 0x5B, 0xFF, 0x00, 0x0F, 0xC0, 0x0B, 0xFE,
-    0x00, 0x7D, 0x00, 0x0F, 0xFC, 0x00, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x55, 0x57, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x15, 0x56, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x1C, 0x00, 0x03, 0xFF, 0x02, 0xF8, 0x00, 0x2F, 0xF4, 0x0F, 0xF4, 0x02, 0xFF, 0x80, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x07, 0xF4, 0xFF, 0x00, 0x2F, 0xC3, 0xF8,
-    0x00, 0x29, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0x97, 0xFE, 0x00, 0xF0, 0x03, 0xFC, 0x01, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2A, 0xAF,
-    0xF0, 0x00, 0x00, 0x7F, 0x40, 0x90, 0x02, 0xFC, 0x0B, 0xC0, 0x1F, 0xE0, 0x3F, 0xD6, 0xFF, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x03, 0xFF, 0xF4,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x80, 0x03, 0xF4, 0x00,
-    0x2F, 0xE0, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00,
-    0x2F, 0xD0, 0xBF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x00, 0x00,
-    0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x04, 0x03, 0xF4, 0x00, 0x00, 0x07, 0x87,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0x02,
-    0xFE, 0x00, 0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41, 0xFD,
-    0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x06, 0x40, 0x00, 0x00, 0x7F, 0x4B, 0xF0, 0x00,
-    0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xD0, 0x3F, 0xFF, 0x01, 0xFF, 0x80, 0x02, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0xFD, 0x00, 0x0B,
-    0xF8, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x40, 0x00, 0x0B,
-    0xF4, 0x2F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xCF, 0xD0, 0x00, 0x00, 0x0B,
-    0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xE1, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x82, 0xF4, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0x3F, 0x87, 0xF4, 0x00, 0x00, 0x1E, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50,
-    0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0x02, 0xFE, 0x00, 0x16, 0xFF, 0x01, 0xFF, 0x00,
-    0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00,
-    0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x2F,
-    0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xAF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x02, 0xD0, 0x00, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0xC7, 0xFE, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0xFE, 0x07, 0xF4, 0x00, 0x00, 0x28,
-    0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xD3, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x1F, 0xF8, 0x00, 0x2F, 0xD0, 0x03, 0xFE, 0x00,
-    0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x03,
-    0xF4, 0x00, 0x00, 0xBF, 0x42, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x10, 0x0F, 0xD0, 0x00,
-    0x00, 0x1E, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x18, 0x00, 0x00, 0x01, 0xF8, 0x3E, 0x00, 0x00, 0x03, 0xF8, 0xFE,
-    0x00, 0x00, 0x0B, 0xE2, 0xFC, 0x00, 0x00, 0x1F, 0x87, 0xF0, 0x00, 0x00, 0x3E, 0x0B, 0x80, 0x00,
-    0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B,
-    0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0x02, 0xFE, 0x00, 0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF,
-    0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82,
-    0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0,
-    0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x0A,
-    0x40, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0xFC,
-    0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x3F, 0xFF, 0xD2, 0xFF, 0xFF, 0x01, 0xFF, 0x80, 0x1F, 0xFD,
-    0x00, 0x3F, 0xC0, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x3F, 0xC0,
-    0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00,
-    0x0B, 0xFF, 0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x1A, 0x5B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x3F, 0x00, 0x01, 0xFE, 0x2F, 0xC0, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x0A, 0x41, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0xFF,
-    0x0F, 0xFF, 0x40, 0x7F, 0x81, 0x6F, 0xC0, 0x2F, 0xC0, 0x0B, 0xF0, 0x0F, 0xF0, 0x03, 0xF8, 0x03,
-    0xF8, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x3F, 0x81, 0xFF, 0x40, 0x0F, 0xFB, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x1B, 0x93, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x5D, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x07, 0xFF, 0xAB, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xFF,
-    0xF0, 0x3F, 0x96, 0xFD, 0x0F, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xF0, 0x00, 0xBF,
-    0xE0, 0x02, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x20, 0x7F, 0x80,
-    0x3E, 0x1F, 0xFA, 0xBF, 0x43, 0xFF, 0xFF, 0xC0, 0x2F, 0xF9, 0xF0, 0x00, 0x10, 0x7D, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0xA4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xEF, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFD, 0x03, 0xFE, 0x02,
-    0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x3F,
-    0xD0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x02, 0xFE, 0x0B, 0xFC,
-    0x00, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0xAB, 0xFF, 0x81, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF9, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x3E, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x00, 0x00,
-    0x29, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xC3, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x16,
-    0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40,
-    0x3F, 0x9A, 0x80, 0x0F, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0xFF, 0x00, 0xBF, 0xEF, 0xFC, 0x1F, 0xE0,
-    0x0F, 0xE0, 0x1F, 0xD1, 0xFD, 0x00, 0xFE, 0x00, 0xFD, 0x2F, 0xC0, 0x0F, 0xD0, 0x0F, 0xD3, 0xFC,
-    0x00, 0xFD, 0x02, 0xFC, 0x3F, 0xCF, 0x0F, 0xF5, 0xBF, 0x47, 0xFF, 0xF0, 0xBF, 0xFF, 0xD0, 0x7F,
-    0xFC, 0x01, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xAB, 0xFD,
-    0x00, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xF8, 0x00,
-    0x0B, 0xF8, 0x00, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD4, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x04, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0x90, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x7F, 0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x7F, 0x96, 0xFD,
-    0x0D, 0x00, 0x7F, 0x40, 0x10, 0x2F, 0xC0, 0x1E, 0x3F, 0xE0, 0x03, 0xFF, 0xE0, 0x02, 0xFF, 0xC0,
-    0x03, 0xFF, 0xD0, 0x03, 0xFD, 0x7C, 0x01, 0xFE, 0x05, 0x14, 0x7F, 0x80, 0x2F, 0x1F, 0xFA, 0xBF,
-    0xC3, 0xFF, 0xFF, 0xF4, 0x2F, 0xFE, 0xBC, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0x47,
-    0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x0B, 0xFE,
-    0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFF, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0x87, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0,
-    0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xFF, 0xD0,
-    0x07, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x05, 0x40, 0x1F, 0xF4, 0x03, 0xFE, 0x07, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xFD, 0x2F, 0xFD, 0x00,
-    0x1F, 0xE7, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02,
-    0xFB, 0xF8, 0x00, 0x25, 0xBE, 0x3F, 0xC0, 0x03, 0xFF, 0xC2, 0xFD, 0x00, 0x7F, 0xF0, 0x0F, 0xF0,
-    0x03, 0xFC, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x01, 0xE0, 0x7F, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFF,
-    0x00, 0xBF, 0x40, 0x00, 0x01, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x6F, 0xFF, 0x55,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0x6F, 0xFE, 0x55, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xF0,
-    0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xFF, 0xD0, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC1,
-    0xFF, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x05, 0x40, 0x1F, 0xF4, 0x03, 0xFE, 0x07, 0xFF, 0xC0, 0xFF,
-    0xE0, 0x7F, 0xFD, 0x2F, 0xFD, 0x00, 0x0F, 0xE7, 0xE0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x0A, 0xBF, 0xEA, 0x90, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x05, 0x7F, 0xE5, 0x40,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0x25, 0xBE, 0x3F, 0xC0, 0x03, 0xFF, 0xC2,
-    0xFF, 0xF8, 0x7F, 0xF0, 0x1F, 0xFF, 0x43, 0xFC, 0x00, 0xBF, 0xD0, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x50, 0x57, 0x5D, 0x1F,
-    0x40, 0xF0, 0x3F, 0xC5, 0xA5, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x6A, 0xAB, 0xDB,
-    0xAA, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x07, 0x40,
-    0x01, 0xC0, 0x00, 0x7E, 0xAA, 0x97, 0xEA, 0xAE, 0x1D, 0x00, 0x60, 0x74, 0x06, 0x00, 0xD0, 0x60,
-    0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
-    0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06,
-    0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x01, 0x52, 0xFC,
-    0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F,
-    0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2,
-    0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF,
-    0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B,
-    0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF1, 0xA8, 0x1A, 0x80, 0xAA,
-    0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x10, 0x07,
-    0xD0, 0x7F, 0x03, 0xF0, 0x2F, 0x80, 0xFD, 0x07, 0xF0, 0x1F, 0xD0, 0x7F, 0x80, 0x50, 0x00, 0x00,
-    0x50, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xF8, 0x03, 0xF0, 0x0B, 0xE0, 0x0F, 0xC0, 0x3F,
-    0x00, 0x04, 0x00, 0x02, 0xD0, 0x3F, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xE0, 0x3F, 0x02, 0xF8, 0x1F,
-    0xC0, 0xB8, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x47, 0xFC, 0x1F, 0xD0, 0x3F, 0x40, 0xFE, 0x01,
-    0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x02, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x7D, 0x07, 0xE0, 0x7F, 0x07,
-    0xF0, 0x3F, 0x03, 0xF4, 0x2F, 0x81, 0xFC, 0x0F, 0xD0, 0xFD, 0x07, 0xF0, 0x7F, 0x41, 0xFD, 0x1F,
-    0xD0, 0x7F, 0x83, 0xF8, 0x05, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF8, 0x03,
-    0xFC, 0x3F, 0xC0, 0x2F, 0xC2, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0x43, 0xF4, 0x07, 0xF0, 0x7F,
-    0x00, 0xFC, 0x0F, 0xD0, 0x2F, 0x42, 0xF4, 0x01, 0x80, 0x19, 0x00, 0x02, 0xD0, 0x68, 0x03, 0xFC,
-    0x3F, 0xC0, 0xBF, 0x0F, 0xF0, 0x2F, 0xC2, 0xFC, 0x0B, 0xE0, 0xFD, 0x03, 0xF0, 0x7F, 0x02, 0xF8,
-    0x3F, 0x41, 0xFC, 0x2F, 0x80, 0xB8, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x0F,
-    0xF4, 0xFF, 0x07, 0xFC, 0x7F, 0x81, 0xFD, 0x2F, 0xC0, 0x3F, 0x47, 0xF0, 0x0F, 0xE0, 0xFD, 0x01,
-    0xFC, 0x2F, 0x80, 0x2F, 0x43, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0x2C, 0x03, 0x80, 0x00, 0x01, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x40, 0x05, 0x07, 0xC0,
-    0x57, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0xA5, 0x3D, 0x1A, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x05, 0x07,
-    0xC0, 0x50, 0x7F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFD, 0x0A, 0x53, 0xD1, 0xA0, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x02,
-    0x90, 0xF0, 0x58, 0x0F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0x50, 0xF8, 0x14, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x0A, 0x90, 0xFF, 0xDB, 0xFF, 0xBF, 0xFD, 0xFF, 0xF1, 0xFF, 0x40, 0x50, 0x00, 0x74,
-    0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFE,
-    0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x7F, 0xE7, 0xFF, 0x3F, 0xD0,
-    0x50, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x1F, 0xC7, 0xFC, 0x0F, 0xF2, 0xFF, 0x07, 0xFC, 0xBF, 0x41,
-    0xFD, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xBD, 0x00,
-    0x0F, 0xC7, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF6, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x7F, 0x40,
-    0x0F, 0xF0, 0x00, 0xFE, 0x05, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x01, 0x03, 0xFD, 0x7F, 0xF7,
-    0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x60, 0x2B,
-    0xDB, 0x02, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x07,
-    0x40, 0x01, 0xC0, 0x00, 0x7E, 0x80, 0x97, 0xE8, 0x0E, 0x1D, 0x00, 0x60, 0x74, 0x06, 0x00, 0xD0,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
-    0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
-    0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x2F, 0x40, 0x07, 0xAD, 0x01, 0xCA, 0x34, 0x30, 0xA0, 0xC0, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD3, 0x40, 0x00, 0x74, 0xE0, 0x00, 0x1D, 0x38,
-    0x6A, 0xAF, 0x4E, 0xEA, 0xAF, 0x4D, 0xD0, 0x1D, 0x34, 0xD0, 0x70, 0xD0, 0xD1, 0xC3, 0x40, 0xD0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x40, 0x0B, 0x1D,
-    0x00, 0x2C, 0x74, 0x00, 0xB1, 0xFA, 0xA9, 0x70, 0xFA, 0xAB, 0x1C, 0x34, 0x07, 0x07, 0x0D, 0x07,
-    0x01, 0xC3, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF5, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F,
-    0x43, 0xF0, 0x0A, 0x90, 0x00, 0x06, 0xA0, 0x1F, 0xD2, 0xFC, 0x2F, 0x42, 0xFF, 0xF0, 0x01, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xC1, 0xF8, 0x3F, 0xEF, 0xE0, 0x2F, 0xEF, 0xF0, 0x2F, 0xF8, 0x0F, 0xC2, 0xFC,
-    0x2F, 0xC1, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x7F, 0x0F, 0xE0, 0x3F, 0x40, 0x00,
-    0x0B, 0xD0, 0xBF, 0x01, 0xFC, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x7E, 0x03, 0xF8, 0x0B, 0xF1, 0xFC,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x3F, 0x8B, 0xF0, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x3F,
-    0x40, 0xFC, 0x2F, 0x80, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0xFE, 0x0F, 0xE0, 0xBF, 0x0B, 0xF0, 0x00,
-    0x1F, 0xC0, 0x02, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFF, 0xE0, 0x02,
-    0xFF, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xA4, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x2F, 0x80, 0xFE, 0x0B, 0xF4, 0x3F,
-    0xC1, 0xFD, 0x0F, 0xE0, 0x3F, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0B,
-    0x40, 0x2F, 0x83, 0xF4, 0x0F, 0xE1, 0xFD, 0x0B, 0xF4, 0xFF, 0x03, 0xFC, 0x7F, 0x81, 0xFD, 0x2F,
-    0xC0, 0xFE, 0x0F, 0xD0, 0x3F, 0x07, 0xE0, 0x0B, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0x0E, 0x00, 0xB4, 0x02, 0xF8, 0x1F, 0xC0, 0xFD, 0x03, 0xF8, 0x3F,
-    0xC1, 0xFD, 0x0B, 0xF4, 0x3F, 0x83, 0xFC, 0x0F, 0xF0, 0xBF, 0x07, 0xF4, 0x1F, 0xD0, 0xFE, 0x0B,
-    0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xD0, 0x3F, 0x02, 0xF4, 0x1F, 0x80, 0x2C, 0x01, 0xE0, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0x7F, 0x40,
-    0xFE, 0x01, 0xFC, 0x02, 0xF4, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x2C, 0x07,
-    0xF0, 0x3F, 0x41, 0xFD, 0x0F, 0xF0, 0x3F, 0xC2, 0xFC, 0x07, 0xF4, 0x3F, 0x80, 0xFE, 0x0B, 0xF0,
-    0x1F, 0xC0, 0xFD, 0x02, 0xF4, 0x1F, 0xC0, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0xB0, 0x07, 0x40, 0x7F, 0x03, 0xF4, 0x2F, 0x80, 0x7F, 0x43, 0xFC, 0x2F,
-    0xC0, 0x3F, 0xC2, 0xFC, 0x1F, 0xE0, 0x1F, 0xD0, 0xFE, 0x0F, 0xF0, 0x0F, 0xE0, 0xBF, 0x07, 0xF4,
-    0x07, 0xF0, 0x3F, 0x42, 0xFC, 0x02, 0xF4, 0x1F, 0xC0, 0xFC, 0x00, 0xF0, 0x0B, 0x40, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xEF,
-    0x80, 0x1F, 0xC2, 0xF8, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x1E, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x7F,
-    0xC0, 0x7F, 0xC0, 0x2F, 0xD0, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0,
-    0x03, 0xFC, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x8B, 0xC0, 0x0A, 0x00, 0x3E, 0x3F, 0x02, 0xF8, 0x0F, 0xC0, 0xF8,
-    0x2F, 0x82, 0xF0, 0x03, 0xE0, 0xF0, 0xBD, 0x00, 0x1F, 0x80, 0x2F, 0x40, 0x00, 0x7E, 0x07, 0xD0,
-    0x00, 0x01, 0xF5, 0xF4, 0x00, 0x1F, 0x0B, 0xFE, 0x0F, 0x43, 0xF8, 0x2F, 0x82, 0xFC, 0x2F, 0x43,
-    0xFC, 0x1F, 0xC0, 0x50, 0xFA, 0xF0, 0x50, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x03, 0xF0, 0x50, 0xFC, 0x00, 0xFC, 0x2F, 0x83, 0xF0, 0x2F, 0x02, 0xFC, 0x0F, 0x8B, 0xD0, 0x1F,
-    0x40, 0x3E, 0x34, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x1A, 0x40,
-    0x2F, 0xD0, 0x2F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF8, 0x0B, 0xF8, 0x03, 0xFD, 0x03, 0xFD,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x1F, 0xD0, 0x1F, 0xD0, 0x07, 0xF0, 0x0B,
-    0xF0, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0xFE, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x04,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x02, 0xF4, 0x01, 0xFF, 0x01, 0xFE, 0x00,
-    0xBF, 0x80, 0xBF, 0x80, 0x1F, 0xC0, 0x2F, 0xC0, 0x01, 0x40, 0x01, 0x40, 0x00, 0x55, 0x55, 0x55,
-    0x53, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x02, 0xFF, 0xDF,
-    0xFF, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x0B,
-    0xFD, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x3F, 0xBF, 0xD0, 0xFE,
-    0xFF, 0x49, 0x03, 0xF4, 0x24, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0xFD,
-    0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xD4, 0x00, 0x7F, 0x50,
-    0x07, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00,
-    0xBF, 0x80, 0x02, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x01, 0x40, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xA0, 0x2F, 0xF4, 0x00, 0x3F, 0xC2, 0xFF, 0xF4, 0x02, 0xFE, 0x0F, 0xFF,
-    0xF0, 0x0F, 0xF0, 0x3F, 0xBF, 0xD0, 0x7F, 0xC0, 0x90, 0x3F, 0x41, 0xFE, 0x00, 0x00, 0xFD, 0x0B,
-    0xF0, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00,
-    0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x01, 0xFD, 0x40,
-    0x0B, 0xD0, 0x07, 0xFF, 0x40, 0x2F, 0x00, 0x0F, 0xF8, 0x00, 0xBC, 0x00, 0x05, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x2E, 0x00, 0x1F, 0xE0, 0x03, 0xFD, 0x00, 0xBF,
-    0x80, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xFE, 0x00, 0x0F, 0xF0, 0x7F, 0xFF, 0x00, 0xBF, 0x82, 0xFF,
-    0xFD, 0x03, 0xFD, 0x0B, 0xEB, 0xFC, 0x0F, 0xF0, 0x08, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0x1F, 0xC1,
-    0xFD, 0x00, 0x00, 0xBD, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0xBE, 0x00,
-    0x0B, 0xF0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x3F, 0x54,
-    0x00, 0xF8, 0x00, 0xFF, 0xF0, 0x03, 0xD0, 0x02, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x0F,
-    0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x01, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0x40, 0x01, 0x81, 0xFF, 0xFD, 0x01, 0xF9, 0xFF, 0xFF, 0xFF, 0xFD, 0xBD, 0x02, 0xFF,
-    0xFE, 0x0E, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0xE0, 0x0B, 0x40, 0x74, 0x02, 0xF8, 0x1F, 0xC0, 0xFD, 0x0B, 0xE0, 0x3F, 0x83,
-    0xFC, 0x1F, 0xD0, 0xFE, 0x0B, 0xF4, 0x3F, 0x83, 0xFC, 0x2F, 0xD0, 0xFF, 0x0B, 0xF0, 0x7F, 0x43,
-    0xFC, 0x1F, 0xD0, 0xFE, 0x0B, 0xF0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFD, 0x0F, 0xE0, 0x3F, 0x02,
-    0xF4, 0x1F, 0x80, 0xFC, 0x02, 0xC0, 0x1E, 0x00, 0xF0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x3F, 0xFF, 0x40, 0x3F, 0xDF, 0xF0, 0x2F, 0x81, 0xFC, 0x0F,
-    0xC0, 0x3F, 0x0B, 0xF0, 0x0F, 0xC3, 0xF4, 0x07, 0xF0, 0xFC, 0x02, 0xFC, 0x3F, 0x00, 0xFD, 0x0F,
-    0xC0, 0x7F, 0x03, 0xF4, 0x3F, 0x40, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0x40, 0x00, 0x65, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3E, 0xBC,
-    0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x1F, 0x40, 0x3F, 0x0B, 0xC0, 0x3F, 0xAB, 0xFA, 0x1F, 0xFF, 0xFF,
-    0xC1, 0xAA, 0xBF, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x2A,
-    0xAA, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x03, 0xE0, 0x00, 0x01, 0xF9, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x16, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x01,
-    0xFE, 0x00, 0xAB, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0x02, 0xB8, 0x00,
-    0x3F, 0xFE, 0x01, 0xFF, 0x90, 0x07, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xFF, 0x40, 0x3F, 0xFF,
-    0xE0, 0x7D, 0x07, 0xF0, 0xBD, 0x03, 0xF0, 0xBD, 0x03, 0xF0, 0xBE, 0x07, 0xF0, 0x3F, 0xAF, 0xD0,
-    0x1F, 0xFF, 0x40, 0x01, 0x94, 0x00, 0x1A, 0xAA, 0xA0, 0xFF, 0xFF, 0xE3, 0xFA, 0xBF, 0x5F, 0x02,
-    0xF8, 0x74, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x3F,
-    0x40, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x6F, 0x80,
-    0x0F, 0xFF, 0xD0, 0xFD, 0x1F, 0xC3, 0xF0, 0x3F, 0x0F, 0xC2, 0xF4, 0x2F, 0xEF, 0x80, 0x3F, 0xF4,
-    0x07, 0xEB, 0xF0, 0x7E, 0x0B, 0xE3, 0xF0, 0x1F, 0xCF, 0xC0, 0xBE, 0x2F, 0xEB, 0xF0, 0x3F, 0xFF,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0x90, 0x01, 0xFF, 0xFC, 0x03, 0xF5, 0xFD, 0x0B, 0xD0, 0x7E,
-    0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x3E, 0x0B, 0xE0, 0xBE, 0x03, 0xFF, 0xFC, 0x00, 0xAF, 0xF8, 0x00,
-    0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x2B, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x42, 0xFE, 0x3F, 0xCA, 0xF7, 0xFF, 0x03, 0xFC, 0xFC, 0x1F, 0xC3, 0xE0, 0xBD, 0x0F, 0x43, 0xF0,
-    0x7C, 0x0F, 0x82, 0xF2, 0x7D, 0x0F, 0xFE, 0xF0, 0x3F, 0xC5, 0x40, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xD2, 0xFC, 0x0F, 0xD0, 0x7F, 0x07, 0xF0, 0x0F,
-    0xC2, 0xF8, 0x07, 0xF0, 0xFD, 0x01, 0xFC, 0x3F, 0x00, 0xBE, 0x0F, 0xC0, 0x3F, 0x43, 0xF4, 0x2F,
-    0xC0, 0xFE, 0x2F, 0xC0, 0x2F, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE0, 0xBF, 0xF4, 0x1F, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x02, 0xF4,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x3F, 0xFF, 0x4F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0xFD, 0x07, 0xF4, 0xBE, 0x07, 0xC0, 0x7E, 0x01, 0x00, 0xFD,
-    0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0xEA, 0xA8, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x7F, 0xFF,
-    0x03, 0xE0, 0xBD, 0x06, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x07, 0xF8, 0x00, 0xFF, 0xF0, 0x02, 0x5F,
-    0xD0, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xF0, 0xFF, 0xFF, 0x02, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xF0, 0x00,
-    0x2F, 0xFC, 0x00, 0x1F, 0x7F, 0x00, 0x1F, 0x4F, 0x80, 0x1F, 0x47, 0xD0, 0x1F, 0x42, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xD5, 0x40, 0x03, 0xD0, 0x00, 0x02, 0xFE, 0x40,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC,
-    0x00, 0x06, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xF9, 0x03, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xD5, 0x00,
-    0x3F, 0xFF, 0xC0, 0x7F, 0x9F, 0xF0, 0xBD, 0x03, 0xF0, 0xBD, 0x03, 0xF0, 0xBD, 0x03, 0xF0, 0x7F,
-    0x0B, 0xE0, 0x3F, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xE7, 0xD5, 0x7F, 0x1F, 0x03, 0xF4, 0x10, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFD,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xBF, 0x83, 0xF0, 0x3F, 0x0F, 0xC1, 0xF8,
-    0x3F, 0x4F, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xD0, 0x2F, 0x5F, 0xD2, 0xF4, 0x1F, 0xCF, 0xC0, 0x7F,
-    0x3F, 0x43, 0xF8, 0x7F, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0xBF, 0xF0, 0x02, 0xFF, 0xFC, 0x07, 0xE0, 0xBE, 0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x3F, 0x0F, 0xD0,
-    0x7E, 0x0B, 0xFA, 0xFD, 0x02, 0xFF, 0xFC, 0x00, 0x17, 0xF4, 0x00, 0x0B, 0xE0, 0x01, 0xBF, 0xC0,
-    0x7F, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xF9, 0xAA, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xBF, 0xEA, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x95, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0x94, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0F, 0xFB, 0xFF,
-    0x00, 0x00, 0xBF, 0x42, 0xFC, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0xC0, 0x1E, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x04, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xBF, 0xEA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xAB, 0xFE, 0xA9, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x53, 0xF8,
-    0x00, 0x16, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xD1, 0xBF, 0xFF,
-    0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4F, 0xF0, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0x15, 0x00, 0x03, 0xFC, 0x03, 0xFD,
-    0x1F, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0xCF, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x07,
-    0xFE, 0xFF, 0xF0, 0x1F, 0xF5, 0x02, 0xF4, 0x1C, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x2F,
-    0xC0, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x1F, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xF0, 0x01, 0xFE,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x83, 0x4E, 0x03,
-    0xF8, 0x07, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFA, 0xF8, 0x3F, 0x47, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0x1F, 0xFF, 0xE0, 0xBF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x7D,
-    0x00, 0x0B, 0xF8, 0x00, 0xBC, 0x00, 0x1F, 0xE0, 0x00, 0x74, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02,
-    0xBF, 0xEB, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0xFF, 0x95, 0x50, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x10, 0x00, 0x7F, 0xF4, 0x01,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xAA, 0xAA,
-    0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xD5, 0x6A, 0xAA, 0xA0,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x0F, 0xDF, 0xEF, 0xCB, 0xE3, 0xF3, 0xF8, 0xF0,
-    0xFC, 0x3C, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0xAA, 0xAA, 0xAA, 0xBF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A,
-    0xAA, 0xA5, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x10, 0x3C, 0x3F, 0x0F, 0x2F, 0xCF, 0xCF, 0xE3, 0xFB, 0xFB, 0xF0, 0x3F, 0xFF, 0xF0,
-    0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xD0, 0x01, 0xC0, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
-    0x0F, 0xE0, 0x00, 0x2F, 0x80, 0xBF, 0xAA, 0xAA, 0xBF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x2F, 0xD5, 0x55, 0x5F, 0xE0, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x3F, 0xC0, 0x1F,
-    0xE0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD,
-    0x1F, 0xDF, 0xDF, 0xC3, 0xE3, 0xF2, 0xE0, 0x20, 0xFC, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x08, 0x3F, 0x08, 0x0F, 0x8F, 0xCB, 0xC3, 0xF7, 0xF7,
-    0xF0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xEF, 0xEF, 0xC0, 0x3F, 0x3F, 0x3F, 0x00, 0x30, 0xFC, 0x30, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x70, 0xFC, 0x34, 0x07, 0xF3, 0xF3, 0xF0, 0x0B, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x15, 0x5B, 0x95,
-    0x50, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0,
-    0x00, 0x02, 0xF8, 0x00, 0x90, 0xBE, 0x00, 0xBD, 0x2F, 0x80, 0xBF, 0x4B, 0xE0, 0xBF, 0x02, 0xF4,
-    0xBF, 0x00, 0xBD, 0x7F, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x3F, 0x40, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x40, 0x00, 0xBE, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x18, 0x00, 0xBE, 0x1F, 0x80, 0x2F, 0x87, 0xF8, 0x0B, 0xE0, 0x3F,
-    0x81, 0xF8, 0x03, 0xF8, 0x7F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xF0, 0x00, 0xFD, 0x00,
-    0xBF, 0x00, 0x3F, 0x40, 0xBF, 0x40, 0x0F, 0xD0, 0xBE, 0x00, 0x03, 0xF4, 0xBF, 0x55, 0x55, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFD, 0x55, 0x55, 0x50, 0x2F, 0x80, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x55, 0xAA, 0xA4, 0x2F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0x55, 0x5A, 0xA9, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF8, 0xBE, 0x00, 0x03,
-    0xFE, 0x2F, 0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0x03, 0xFB, 0xE2, 0xFB, 0xF0, 0xB8, 0xF8, 0xBC, 0xB8,
-    0x04, 0x3E, 0x2F, 0x04, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC,
-    0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8,
-    0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x6A, 0xA9,
-    0x55, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF8, 0x1A,
-    0xA9, 0x55, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00,
-    0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0x8B, 0xC0,
-    0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x02, 0x0F, 0x8B,
-    0xC2, 0x03, 0xE3, 0xE2, 0xF2, 0xF0, 0xFE, 0xF8, 0xBE, 0xFC, 0x0B, 0xFE, 0x2F, 0xF8, 0x00, 0xBF,
-    0x8B, 0xF8, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x02, 0xF4, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0xFE, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x02,
-    0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x00, 0x0F, 0xE0,
-    0x7F, 0xE0, 0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0xFD, 0x00,
-    0x7F, 0xEA, 0xAA, 0xBF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF5, 0x5F, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0x00, 0x00, 0x01, 0xFF, 0x2F, 0x80, 0x00, 0x00,
-    0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xE0,
-    0x02, 0xE0, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xAF, 0xFC,
-    0x07, 0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x1F, 0xD0, 0x03, 0xF8, 0x3F, 0xC0, 0x07, 0xF4,
-    0x3F, 0xC0, 0x0B, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x3F, 0xC0, 0xBF, 0x40, 0x3F, 0xFB, 0xFE, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0xAA, 0xAA, 0xBF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xFD, 0x15, 0x55, 0x5F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xF4, 0x50, 0x00, 0x3F, 0xD7, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x03, 0x80, 0x00,
-    0x7F, 0xFF, 0xF8, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFA, 0xAF, 0xFF, 0x00,
-    0x0B, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF8, 0x02, 0xFE, 0x00, 0x02, 0xFF,
-    0xF0, 0x0F, 0xF0, 0x00, 0x2F, 0x7F, 0xD0, 0x7F, 0xC0, 0x02, 0xF4, 0xBF, 0x81, 0xFE, 0x00, 0x2F,
-    0x41, 0xFE, 0x0B, 0xF4, 0x02, 0xF4, 0x07, 0xF8, 0x2F, 0xD0, 0x2F, 0x80, 0x1F, 0xE0, 0xBF, 0x41,
-    0xF8, 0x00, 0xBF, 0x41, 0xFE, 0x1F, 0x80, 0x03, 0xFC, 0x07, 0xFD, 0xF8, 0x00, 0x0F, 0xF0, 0x0F,
-    0xFF, 0x80, 0x00, 0xBF, 0x80, 0x2F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0,
-    0x00, 0xFF, 0xFE, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x2F, 0xFF, 0xF8,
-    0x00, 0x02, 0xC0, 0x05, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xF4, 0x00,
-    0x00, 0x2F, 0x8F, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x03, 0xFE, 0x00, 0x00,
-    0xFD, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0x40, 0x02, 0xF8, 0x00, 0xFF, 0x80, 0x03, 0xF4,
-    0x00, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x3F, 0xE0, 0x1F, 0xD0, 0x00,
-    0x3F, 0xF0, 0x2F, 0xC0, 0x00, 0x1F, 0xF4, 0x3F, 0xEA, 0xAA, 0xAF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xAA, 0xAF, 0xFD, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0xBF, 0xC0,
-    0x00, 0x3F, 0x41, 0xFF, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xE0, 0x0B, 0xFC, 0x00, 0x7F,
-    0x00, 0x0F, 0xF8, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0xC0, 0x7F, 0x00, 0x00,
-    0xFF, 0x83, 0xF8, 0x00, 0x02, 0xFF, 0x0F, 0xC0, 0x00, 0x07, 0xFC, 0xBE, 0x00, 0x00, 0x0F, 0xFB,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x94, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFA,
-    0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xEA,
-    0xAA, 0xAA, 0xAA, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x40, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xF9,
-    0x47, 0xF4, 0x00, 0x2F, 0xF0, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0B, 0xF8, 0x00,
-    0x7F, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xAA, 0xAF, 0xFA, 0xA8, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xAA, 0xFE, 0xAA, 0xA0, 0xFF, 0x40, 0x7F,
-    0x00, 0x00, 0x2F, 0xE0, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0xDB, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xAA,
-    0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xAA, 0xAA, 0xAA,
-    0xA0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0xAA, 0xAA, 0xAA, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x05,
-    0x55, 0x55, 0x6F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xF4, 0x5B, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xE0, 0x00,
-    0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0xAA,
-    0xBF, 0xEA, 0xAB, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA,
-    0xAF, 0xEA, 0xAF, 0xF0, 0x00, 0x03, 0xF4, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x02, 0xFE, 0x00, 0x00,
-    0x1F, 0xC0, 0xFF, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x80, 0x55, 0x55, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0xAA, 0xAA, 0xAA, 0xAB, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF,
-    0xFA, 0xAF, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00,
-    0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE,
-    0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00,
-    0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F,
-    0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80,
-    0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F,
-    0xE0, 0x1F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF1, 0xAA, 0xAA, 0x41,
-    0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x07, 0xFF, 0xAA, 0xBF, 0xF8, 0x0F, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xFC, 0x00, 0x0F, 0x80,
-    0x2F, 0xF8, 0x00, 0x2D, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0A, 0x00, 0xBF, 0x80,
-    0x00, 0x7D, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x1F, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x16, 0xAA, 0xAA, 0xAA, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40,
-    0x02, 0xD1, 0xF4, 0x78, 0x3F, 0xDF, 0x7F, 0xC2, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x47, 0xFE, 0xFB, 0xFD, 0x3F, 0x1F, 0x4F, 0xC0, 0x41, 0xF4, 0x10,
-    0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8,
-    0x3F, 0x82, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0xD7, 0xF8, 0x1F,
-    0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x54, 0x00, 0x01, 0x03, 0xFC, 0xBF, 0xEB, 0xFE, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x05, 0x54, 0x00, 0x2F, 0x80, 0x7F, 0xF8, 0x00, 0xFD, 0x01, 0xFF,
-    0xF0, 0x03, 0xF0, 0x02, 0xBF, 0xC0, 0x1F, 0x80, 0x00, 0x7F, 0x40, 0xBD, 0x00, 0x00, 0xFE, 0x03,
-    0xF0, 0x00, 0x03, 0xFC, 0x1F, 0x80, 0x00, 0x0B, 0xF0, 0xBD, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00,
-    0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x00, 0xBF, 0x7D, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0xBF, 0xD0, 0x1F, 0x3F, 0xFF, 0x4B,
-    0xF7, 0xFA, 0xFE, 0xFD, 0xBD, 0x07, 0xFE, 0x0F, 0xC0, 0x2F, 0xC0, 0xFC, 0x03, 0xFD, 0x0B, 0xE0,
-    0xBF, 0xF4, 0x7F, 0xFF, 0x5F, 0xE3, 0xFF, 0xD0, 0xBF, 0x0B, 0xE4, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x14, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x2F, 0xFF, 0x0B, 0xFF, 0xC3, 0xFA, 0xFE,
-    0xFE, 0xFD, 0xBD, 0x07, 0xFD, 0x07, 0xEB, 0xC0, 0x2F, 0xC0, 0x3E, 0xBD, 0x03, 0xFC, 0x03, 0xEB,
-    0xE0, 0xFF, 0xF0, 0xBE, 0x7F, 0xFF, 0x5F, 0xFF, 0xC2, 0xFF, 0xD0, 0xBF, 0xF8, 0x0B, 0xF4, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0xAA, 0x80, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x15,
-    0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F,
-    0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB,
-    0xF2, 0xFC, 0xBF, 0x1A, 0x80, 0x15, 0x01, 0x52, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC,
-    0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F,
-    0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2,
-    0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC,
-    0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F,
-    0xC2, 0xFC, 0xBF, 0x0B, 0xF1, 0xA8, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xCF,
-    0xF0, 0x00, 0x00, 0x0F, 0xE1, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0B,
-    0xF0, 0x00, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x07,
-    0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x07, 0xF8, 0x00, 0x07,
-    0xF8, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0xBF, 0x40, 0x00, 0x03,
-    0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xC2, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF4, 0x0B, 0xF0, 0x00, 0x03,
-    0xFC, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3F,
-    0x80, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x07, 0xF8,
-    0x00, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFA, 0xBF, 0xF4, 0x3F, 0xD0, 0x02, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xC7,
-    0xF0, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F,
-    0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00,
-    0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0,
-    0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00,
-    0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC,
-    0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x03, 0xF5,
-    0xFD, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0xBF, 0x0F, 0xF8, 0x00, 0xBF, 0xC1, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x90, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFD, 0xBE, 0x00, 0x0F,
-    0xF4, 0x38, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x1C, 0x1F, 0xF0, 0x00, 0xBE, 0x2F, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4, 0x00,
-    0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x14, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0x07, 0xFE, 0x7F,
-    0xC0, 0x00, 0x0F, 0xF4, 0x64, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x50, 0x0F, 0xE0, 0xFF, 0x83, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x3F, 0xC2, 0xFF, 0x0B, 0xF8, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4,
-    0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x64, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F,
-    0xF4, 0x14, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x01, 0x81, 0xFF,
-    0xFD, 0x01, 0xF9, 0xFF, 0xFF, 0xFF, 0xFD, 0xBD, 0x02, 0xFF, 0xFE, 0x0E, 0x00, 0x0B, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x03, 0xC3, 0xFF, 0xFF, 0x47,
-    0xFA, 0xFE, 0xBF, 0xFF, 0xFC, 0xBC, 0x00, 0xBF, 0xFC, 0x04, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0x9B,
-    0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x01, 0xFF, 0xC0, 0x2E, 0x7F, 0xFF, 0x87, 0xFF, 0xFB, 0xFF, 0xFE, 0xFC, 0x0B, 0xFF, 0xC2, 0x40,
-    0x0B, 0xD0, 0x01, 0x50, 0x00, 0x41, 0xFF, 0xC0, 0x2E, 0x7F, 0xFF, 0x87, 0xFF, 0xFB, 0xFF, 0xFE,
-    0xFC, 0x0B, 0xFF, 0xC2, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x94, 0x00, 0x5B, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x5A, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xEA, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0x90, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xBD, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x00,
-    0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x15, 0x7F, 0x55, 0x47, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xD1, 0x7F, 0x55, 0x54, 0x07, 0xD0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA,
-    0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xF4,
-    0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x04, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFF, 0x40, 0x0B, 0xFF,
-    0x40, 0x0B, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xF0,
-    0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x1F,
-    0xFE, 0x00, 0x03, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x0B,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x2E, 0x00,
-    0x00, 0x03, 0xFE, 0x40, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xF4, 0x07, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x2F,
-    0xF0, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x2F, 0xFD,
-    0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xF8, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x40, 0x00,
-    0x2F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x05, 0x6F, 0xD5, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0x00,
-    0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00,
-    0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0x00, 0x00,
-    0x1F, 0xF0, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0x9F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x55, 0x55, 0x40,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x15, 0x55, 0x5F, 0xE0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0x6F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x2F, 0xF0, 0x00,
-    0x07, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xFD, 0x00, 0x0B,
-    0xF0, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF9, 0x00, 0x05, 0x7F, 0x95, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x2F, 0xFD, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xAA, 0xAA, 0xA4, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xAF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x6A, 0xAA, 0xAA, 0xFF, 0xD2,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0xB8, 0x2F, 0xC0, 0x0F, 0xD0, 0x2E, 0x01, 0xFC,
-    0x07, 0xD0, 0x0B, 0x80, 0x1F, 0x43, 0xE0, 0x02, 0xE0, 0x02, 0xF1, 0xF0, 0x00, 0xB8, 0x00, 0x3D,
-    0xB8, 0x00, 0x2E, 0x00, 0x0F, 0xBE, 0x00, 0x0B, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2E, 0x00, 0x0B, 0xEE, 0x00, 0x0B, 0x80, 0x02, 0xE7,
-    0xC0, 0x02, 0xE0, 0x00, 0xF4, 0xF8, 0x00, 0xB8, 0x00, 0xBC, 0x2F, 0x00, 0x2E, 0x00, 0x3E, 0x03,
-    0xF0, 0x0B, 0x80, 0x3F, 0x00, 0x3F, 0x82, 0xE0, 0xBF, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F,
-    0xD0, 0x00, 0x01, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x02, 0xF1, 0xF0,
-    0x00, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xEE, 0x00,
-    0x00, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x2F, 0x00,
-    0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x02, 0xFF,
-    0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xF8, 0x00, 0x0F, 0xE0,
-    0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x43, 0xEB, 0xE0,
-    0x02, 0xFA, 0xF1, 0xF0, 0xBE, 0x02, 0xF8, 0x3D, 0xB8, 0x0B, 0xE2, 0xF8, 0x0F, 0xBE, 0x00, 0xBF,
-    0xF8, 0x02, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x1F, 0xF8, 0x02, 0xFF,
-    0xD0, 0x0B, 0xEE, 0x02, 0xF8, 0xBD, 0x02, 0xE7, 0xC2, 0xF8, 0x0B, 0xE0, 0xF4, 0xFA, 0xF8, 0x00,
-    0xBE, 0xBC, 0x2F, 0xF8, 0x00, 0x0B, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00,
-    0xBF, 0x00, 0x02, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF,
-    0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x07, 0xD0, 0x00, 0x02,
-    0xFF, 0x43, 0xE0, 0x00, 0x02, 0xFA, 0xF1, 0xF0, 0x00, 0x02, 0xF8, 0x3D, 0xBC, 0x00, 0x02, 0xF8,
-    0x0F, 0xBE, 0x00, 0x02, 0xF8, 0x02, 0xFF, 0x40, 0x02, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xF8, 0x00,
-    0x1F, 0xF8, 0x02, 0xF8, 0x00, 0x0B, 0xEE, 0x02, 0xF8, 0x00, 0x03, 0xE7, 0xC2, 0xF8, 0x00, 0x00,
-    0xF4, 0xFA, 0xF8, 0x00, 0x00, 0xBC, 0x2F, 0xF8, 0x00, 0x00, 0x3E, 0x03, 0xF8, 0x00, 0x00, 0x7F,
-    0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x1A, 0xAA,
-    0xFE, 0xAA, 0x9B, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x01, 0x03, 0xFC, 0xBF, 0xEB, 0xFE, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00, 0x04, 0x0F,
-    0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xDB, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xFF, 0x40, 0x3F, 0xF0,
-    0x07, 0xFE, 0x7F, 0xC0, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x5B, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x02,
-    0xFC, 0x69, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xE2, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xE3, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD2, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_14_bolditalicBitmaps[37016] = {
+    0x8D, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0x3D, 0xB6, 0xD9, 0xB8, 0x18, 0xA4, 0xD9, 0x82, 0x20,
+    0x91, 0xC6, 0x3D, 0x12, 0x71, 0x9B, 0x22, 0xC9, 0x4C, 0x94, 0x07, 0x48, 0x0A, 0xB6, 0x42, 0xE2,
+    0x15, 0xB6, 0x4D, 0x93, 0xD8, 0x22, 0x25, 0x45, 0x78, 0x88, 0x14, 0x40, 0xB3, 0x14, 0x14, 0x14,
+    0xEC, 0x7A, 0x48, 0x8A, 0x94, 0x71, 0x12, 0x21, 0x8A, 0x14, 0x18, 0x44, 0x95, 0x66, 0x2D, 0x34,
+    0x91, 0x0C, 0x8C, 0x7D, 0x39, 0xD7, 0xDE, 0x90, 0x6F, 0x05, 0x05, 0xA3, 0xEF, 0xFA, 0x9B, 0x3F,
+    0x9F, 0xFB, 0x77, 0xEE, 0x35, 0x2E, 0xF9, 0xBA, 0xB7, 0xA3, 0x99, 0x8A, 0x19, 0x02, 0xD7, 0x56,
+    0x7D, 0x39, 0xE6, 0x09, 0x27, 0x70, 0xDE, 0x86, 0x62, 0xC4, 0x84, 0x6B, 0x78, 0x07, 0x40, 0x16,
+    0x33, 0x41, 0xD7, 0x56, 0x21, 0xF3, 0xC8, 0xFB, 0xEF, 0xDC, 0xAD, 0xE7, 0xA9, 0x31, 0xBF, 0x27,
+    0xF7, 0xF9, 0x30, 0xBB, 0x9B, 0x63, 0xB2, 0xF7, 0xC7, 0xBB, 0xB6, 0xF5, 0xFB, 0xC0, 0xDE, 0xED,
+    0x8B, 0xC0, 0x5C, 0x0E, 0xB0, 0xE1, 0x18, 0x59, 0xB2, 0x01, 0x75, 0x9B, 0x20, 0x1C, 0x96, 0x32,
+    0x7C, 0xF2, 0xBA, 0xF9, 0x18, 0x27, 0x04, 0x36, 0xFD, 0x3D, 0x20, 0x99, 0x3E, 0x3F, 0x7A, 0xB5,
+    0x3C, 0xEC, 0x78, 0x64, 0x28, 0x63, 0x31, 0xD6, 0x1E, 0xAE, 0x88, 0x28, 0x07, 0x07, 0x1C, 0x97,
+    0x23, 0x76, 0x46, 0x19, 0x00, 0xD3, 0x02, 0xD6, 0x03, 0x15, 0xA7, 0x32, 0xC0, 0x49, 0xC2, 0x72,
+    0x7D, 0xCE, 0xA7, 0xAB, 0x27, 0x45, 0xBC, 0x73, 0xAD, 0x48, 0xDF, 0x5E, 0xC9, 0x65, 0x44, 0x46,
+    0x41, 0x97, 0x80, 0x5A, 0x3C, 0x4A, 0x09, 0x94, 0xF1, 0x23, 0xF3, 0x60, 0x3C, 0xB1, 0x66, 0x14,
+    0x4A, 0xF7, 0x69, 0xD5, 0xBB, 0xA5, 0x0B, 0x95, 0x2C, 0xC8, 0xE5, 0x37, 0xE0, 0x0E, 0xE1, 0x23,
+    0x85, 0xAF, 0x65, 0x94, 0x7C, 0xE0, 0xBF, 0xDF, 0xD5, 0x8D, 0x2B, 0x40, 0x33, 0x80, 0x06, 0xD5,
+    0xD2, 0x62, 0x86, 0x79, 0x9D, 0x18, 0x2D, 0xFA, 0xD7, 0x9B, 0x91, 0x93, 0x19, 0x09, 0xC5, 0x68,
+    0x7B, 0xE7, 0xD1, 0xD0, 0x2B, 0xBD, 0x58, 0x05, 0xEA, 0x6F, 0x8A, 0xE8, 0xF0, 0x55, 0x19, 0x3B,
+    0xD3, 0x77, 0xC9, 0xC9, 0x0F, 0x93, 0x3B, 0x1D, 0xBA, 0xC1, 0xD1, 0x02, 0xBA, 0x11, 0x12, 0xE1,
+    0xF2, 0x58, 0x87, 0x06, 0xB8, 0x57, 0x4C, 0x04, 0xB2, 0xC1, 0xF9, 0x05, 0x45, 0x2C, 0x22, 0xE3,
+    0xC6, 0x1C, 0xDC, 0x9F, 0x50, 0x85, 0x7C, 0x11, 0x6E, 0xC1, 0x52, 0xEF, 0x75, 0xE0, 0x12, 0xCD,
+    0x6A, 0x77, 0x0D, 0xAB, 0x92, 0x3E, 0x45, 0xF8, 0x28, 0xE6, 0x86, 0xA7, 0x46, 0x63, 0x08, 0xDA,
+    0xA2, 0x87, 0xE1, 0x9E, 0x3E, 0x1F, 0x25, 0xBC, 0x8B, 0xEA, 0xE7, 0x01, 0xC7, 0xA8, 0x16, 0x1C,
+    0x26, 0x34, 0xA3, 0x91, 0x98, 0xCB, 0xE0, 0x16, 0x98, 0xBF, 0xC6, 0xEB, 0x09, 0xF5, 0xE3, 0x89,
+    0x2E, 0xB8, 0xCF, 0x52, 0x1E, 0xD1, 0x78, 0x61, 0x82, 0x3A, 0x74, 0x4F, 0x7B, 0xCE, 0x1D, 0xC3,
+    0xD7, 0x04, 0x4B, 0x7C, 0xF7, 0xC7, 0x21, 0x6D, 0xD0, 0x34, 0x2E, 0x3E, 0x97, 0xB9, 0x92, 0x88,
+    0x3D, 0x68, 0xB8, 0x39, 0xF6, 0x7C, 0xDE, 0xCF, 0xF5, 0xA3, 0xE4, 0xEE, 0x47, 0x57, 0x0C, 0x77,
+    0xB3, 0x7F, 0x32, 0xA6, 0x5E, 0xED, 0xFC, 0xB8, 0x2C, 0x23, 0x8A, 0x84, 0x6C, 0x66, 0x86, 0x88,
+    0xD9, 0xD2, 0x46, 0xDD, 0x25, 0xE9, 0xB0, 0xAC, 0x6B, 0x3B, 0xE8, 0xB9, 0x1E, 0x56, 0x3D, 0x8A,
+    0x89, 0xBE, 0x6D, 0xB3, 0xB4, 0x9E, 0x96, 0xDC, 0xB8, 0x4B, 0x7D, 0x67, 0xDE, 0x7F, 0xA3, 0x3E,
+    0xAE, 0x57, 0xF4, 0xA0, 0x0E, 0x2B, 0x08, 0xE1, 0x68, 0xF8, 0xFA, 0xAE, 0x0B, 0x2B, 0x72, 0x7D,
+    0xEE, 0x8F, 0x30, 0x0C, 0xA8, 0x6A, 0xA0, 0xAE, 0x6C, 0xDB, 0xE0, 0x3B, 0x6A, 0x92, 0xEA, 0x1F,
+    0x57, 0xFB, 0xD4, 0x18, 0x8F, 0x6C, 0x8B, 0xF5, 0xFE, 0x71, 0xF6, 0x6B, 0xB4, 0x2F, 0xDB, 0x7A,
+    0x7E, 0x58, 0xCA, 0x2F, 0xDD, 0xE9, 0x83, 0x53, 0x7F, 0xB9, 0xC6, 0xFE, 0xF7, 0x6F, 0x58, 0x92,
+    0xAB, 0xF2, 0x76, 0xE7, 0xAF, 0x11, 0xF9, 0x49, 0x64, 0xFE, 0xB0, 0x7B, 0xD5, 0x9E, 0x3F, 0xCB,
+    0x1E, 0xEA, 0xFD, 0xBA, 0xAD, 0x46, 0x2A, 0x61, 0xC5, 0x79, 0x17, 0xEA, 0xE0, 0xC2, 0x05, 0xC5,
+    0x31, 0x92, 0x44, 0x9E, 0xCA, 0x9A, 0xD0, 0x2C, 0xB9, 0x27, 0xA9, 0xB9, 0xA1, 0xDB, 0xB4, 0x69,
+    0x75, 0xD2, 0xF6, 0x9B, 0x6B, 0x0C, 0xE0, 0xEA, 0x9B, 0x5A, 0x4E, 0x2A, 0xAE, 0x8E, 0xA8, 0xBF,
+    0xFF, 0xEF, 0xA2, 0xDB, 0xB9, 0xB8, 0xC3, 0x71, 0xB3, 0x56, 0x0A, 0x99, 0x26, 0x32, 0x41, 0x9E,
+    0x49, 0xA8, 0x87, 0x62, 0x2E, 0x49, 0x89, 0x41, 0x7C, 0xB1, 0x54, 0x24, 0xF9, 0x73, 0x32, 0x73,
+    0x76, 0x3D, 0xDC, 0x0B, 0x72, 0x3D, 0x35, 0x64, 0xC5, 0x93, 0x04, 0x1B, 0xBB, 0x00, 0xD1, 0x7B,
+    0x7D, 0x13, 0x4C, 0x2A, 0x24, 0x17, 0x56, 0x08, 0x29, 0xC3, 0x5A, 0x27, 0x37, 0xB4, 0xA6, 0xDE,
+    0xE8, 0xA8, 0x49, 0x9A, 0xD1, 0xCA, 0x54, 0xC8, 0xCC, 0x02, 0xF5, 0xE0, 0x8B, 0x35, 0x39, 0x31,
+    0x11, 0x95, 0x6B, 0xE8, 0xDA, 0xAD, 0xEB, 0x72, 0x77, 0x7D, 0xB8, 0xDC, 0x10, 0x89, 0xB2, 0x05,
+    0x45, 0x5D, 0x98, 0x08, 0x2B, 0x3D, 0x25, 0xE5, 0x72, 0x43, 0x5A, 0x86, 0x90, 0xAD, 0xC2, 0x4E,
+    0x99, 0x27, 0x0C, 0x8F, 0x54, 0xFC, 0x99, 0xB4, 0x67, 0x42, 0x2A, 0x70, 0xBF, 0x60, 0x46, 0x09,
+    0x0D, 0x33, 0x1F, 0x1C, 0x68, 0xB3, 0x79, 0xAC, 0xFD, 0xA8, 0x51, 0x3B, 0x77, 0x91, 0x83, 0x22,
+    0x67, 0x44, 0x66, 0x21, 0xBB, 0x60, 0x95, 0x0D, 0x30, 0xD3, 0x26, 0xB5, 0xDE, 0x48, 0x5A, 0x6C,
+    0x01, 0x97, 0x8F, 0x38, 0x51, 0x33, 0x95, 0x62, 0xEA, 0x08, 0x6A, 0xA5, 0xD4, 0x74, 0xE1, 0x48,
+    0x26, 0x42, 0x44, 0xB6, 0xA6, 0x2F, 0xDE, 0xFA, 0x8E, 0x2D, 0xDE, 0x0C, 0x23, 0x2A, 0x02, 0x55,
+    0x34, 0xA3, 0x52, 0x5A, 0x13, 0xA8, 0x7A, 0x39, 0xA2, 0x7A, 0xC1, 0x42, 0xEF, 0x67, 0x4A, 0x43,
+    0xA9, 0x43, 0xD5, 0xDB, 0xA1, 0xA2, 0x79, 0xA7, 0x94, 0x3F, 0x29, 0xF3, 0xC5, 0x83, 0xE6, 0xC7,
+    0x95, 0xAD, 0x6B, 0x4E, 0x95, 0xC3, 0x4A, 0x79, 0x8D, 0xB4, 0xD6, 0x63, 0x60, 0xE2, 0xC6, 0x7C,
+    0x3E, 0xB8, 0xBD, 0x6E, 0xAE, 0xC9, 0xE5, 0x2D, 0x4B, 0xCF, 0x98, 0x4D, 0x8F, 0xF7, 0xB5, 0x44,
+    0xCD, 0xA2, 0xEF, 0xF0, 0xA8, 0x1E, 0x36, 0x67, 0x34, 0x14, 0xE5, 0x6A, 0x03, 0x4D, 0x55, 0x98,
+    0xB3, 0x56, 0xB8, 0x3B, 0x0E, 0x09, 0xD3, 0xD0, 0x46, 0xF5, 0xA5, 0x5A, 0x3C, 0x49, 0xA2, 0x3E,
+    0xB7, 0x6B, 0x2B, 0x84, 0x5D, 0xBE, 0xE4, 0x82, 0x6C, 0xE1, 0xEB, 0x43, 0x39, 0x97, 0xFA, 0x7D,
+    0xB0, 0xD1, 0x44, 0x88, 0x17, 0x6F, 0xA3, 0xE5, 0x44, 0xBF, 0x18, 0x63, 0x39, 0x33, 0x33, 0xBC,
+    0xD3, 0x9E, 0xE7, 0x04, 0xED, 0x9E, 0x68, 0xFF, 0xC2, 0x93, 0xD9, 0x7D, 0x7D, 0x94, 0xE8, 0xF9,
+    0x78, 0xCC, 0x4E, 0x73, 0x55, 0x9D, 0xD0, 0x5C, 0xDA, 0x69, 0x8B, 0x6B, 0xA3, 0xF5, 0xBD, 0xA5,
+    0xD0, 0xA4, 0xB7, 0xDB, 0x64, 0xE2, 0x7A, 0xD4, 0xA9, 0x39, 0x78, 0xDB, 0x11, 0xB8, 0x13, 0xD7,
+    0x44, 0x16, 0x72, 0x34, 0xE5, 0x0B, 0xD1, 0xE8, 0x60, 0x70, 0xAD, 0x1D, 0xF9, 0x99, 0x63, 0xCF,
+    0xBB, 0xA5, 0xA9, 0x61, 0x0B, 0x62, 0x50, 0x4A, 0xFA, 0x6C, 0x66, 0xE9, 0xED, 0x64, 0x12, 0xDB,
+    0x87, 0xDC, 0x64, 0x1F, 0xEC, 0x05, 0x26, 0xBA, 0xC1, 0x24, 0x23, 0x47, 0xFA, 0xDD, 0x4A, 0xBC,
+    0x15, 0x77, 0xD1, 0xB5, 0x50, 0x48, 0x1F, 0x55, 0xB1, 0xB2, 0xBE, 0x37, 0x9B, 0x96, 0x8A, 0xF8,
+    0xAB, 0x32, 0x4E, 0x22, 0xBB, 0x87, 0x04, 0xD7, 0x97, 0x7A, 0xA7, 0x56, 0xD7, 0x6B, 0xCD, 0x81,
+    0x86, 0x7C, 0x0D, 0x5F, 0xC7, 0xF0, 0x35, 0x13, 0xB2, 0x6E, 0xA6, 0x1D, 0x4C, 0x4C, 0xAD, 0xC9,
+    0xD9, 0xDF, 0xF0, 0x8F, 0xF3, 0xA5, 0x58, 0xD8, 0x1B, 0x6E, 0x9F, 0x6B, 0xF2, 0x6C, 0x11, 0x4D,
+    0x68, 0xFC, 0x7B, 0x9B, 0x09, 0x3D, 0xBD, 0x26, 0x9D, 0x59, 0xE3, 0x7B, 0xF8, 0xD7, 0x38, 0x01,
+    0xCB, 0x91, 0xB6, 0x90, 0x97, 0xB3, 0xFE, 0x77, 0xFA, 0xF8, 0x00, 0xFF, 0x3D, 0xFE, 0x06, 0x8D,
+    0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xDB, 0xB9, 0xB8, 0x70, 0xB1, 0x0D, 0xD4, 0xE6, 0x1F,
+    0xB8, 0xA7, 0xB8, 0xB5, 0x94, 0x92, 0x26, 0xCD, 0x81, 0x94, 0x8A, 0x9A, 0x1F, 0x11, 0x5B, 0x20,
+    0x41, 0xFB, 0x0A, 0x3A, 0x5A, 0x0A, 0xF2, 0x52, 0xD0, 0x52, 0xC5, 0x46, 0x29, 0x28, 0x68, 0x2C,
+    0x04, 0x4A, 0x41, 0xC1, 0x4A, 0x40, 0x13, 0x8A, 0xDB, 0xC2, 0x27, 0x7C, 0x97, 0xB5, 0x87, 0xEF,
+    0x1B, 0xBF, 0x97, 0x5C, 0x89, 0xF5, 0xBC, 0xEB, 0xE7, 0xDD, 0x99, 0xF9, 0xBE, 0x6F, 0x66, 0xC7,
+    0x22, 0xBC, 0x7E, 0x10, 0x19, 0x46, 0x19, 0x66, 0x19, 0xFE, 0x92, 0x21, 0x48, 0x17, 0xA4, 0xDC,
+    0x44, 0xEA, 0xFB, 0x77, 0xC2, 0xDD, 0x8B, 0x7C, 0xD0, 0xA9, 0xBE, 0x52, 0x5D, 0x31, 0x4D, 0x66,
+    0x2A, 0xF9, 0xF1, 0xF8, 0xDD, 0xE9, 0xE5, 0xFB, 0x57, 0x57, 0x2D, 0xDE, 0x64, 0x41, 0xC4, 0x07,
+    0xC9, 0xF5, 0x7C, 0x4F, 0xB8, 0x47, 0x29, 0x56, 0x4C, 0xFD, 0x43, 0xED, 0x4B, 0xED, 0x0B, 0xED,
+    0xA5, 0x81, 0xBB, 0xDE, 0x5C, 0x0C, 0x53, 0xA3, 0x8F, 0x34, 0xF9, 0xE1, 0x97, 0x76, 0x15, 0x37,
+    0x49, 0x12, 0xDF, 0xBA, 0xA9, 0x98, 0x65, 0x15, 0x2F, 0xE5, 0x8D, 0x74, 0x73, 0xB1, 0xC9, 0x05,
+    0x77, 0x36, 0x6D, 0xB9, 0xC8, 0xD0, 0x57, 0x51, 0xDE, 0x93, 0x77, 0xD7, 0x43, 0xDD, 0x10, 0x37,
+    0x53, 0xC3, 0xD4, 0xE9, 0x35, 0x82, 0x56, 0x78, 0xD3, 0x4D, 0xD8, 0x0A, 0x28, 0x63, 0x35, 0x63,
+    0x93, 0x6F, 0xBB, 0xB6, 0xFE, 0xB2, 0xDF, 0x8A, 0xA5, 0x50, 0xCD, 0x97, 0x66, 0xF4, 0xD7, 0x4B,
+    0x19, 0xD6, 0x3C, 0xB9, 0xB1, 0xF9, 0x2A, 0xBA, 0xD1, 0xCB, 0x8B, 0xA6, 0x1F, 0x64, 0x29, 0xE6,
+    0xB5, 0x98, 0xAB, 0xC9, 0xBD, 0xDC, 0xDF, 0x61, 0xC8, 0x53, 0x19, 0xBD, 0xAC, 0x4D, 0xEC, 0xDA,
+    0x54, 0xE8, 0xBF, 0xD7, 0xD8, 0x52, 0x69, 0xAD, 0xAD, 0x0B, 0x55, 0x68, 0x26, 0x69, 0x46, 0x03,
+    0xD1, 0xED, 0x5C, 0x40, 0x4C, 0x0E, 0x98, 0xFE, 0xBE, 0x60, 0x6C, 0x40, 0x4A, 0x5C, 0x53, 0xA5,
+    0x30, 0x17, 0xCF, 0xDA, 0x13, 0x60, 0x9B, 0x95, 0x43, 0x95, 0xCC, 0x98, 0x08, 0x0B, 0x93, 0xB4,
+    0xA1, 0x9D, 0x24, 0x2E, 0x56, 0x7F, 0x9A, 0x31, 0xD8, 0x4A, 0x31, 0x23, 0x92, 0xD4, 0x23, 0xA3,
+    0xAC, 0xB4, 0xAC, 0x6E, 0x3E, 0xC1, 0xA2, 0x57, 0x8D, 0xB0, 0x23, 0xF1, 0xFA, 0xB7, 0x2B, 0x58,
+    0x6E, 0xD0, 0x58, 0x60, 0x50, 0x26, 0xE9, 0x46, 0x69, 0x6E, 0x6B, 0x9D, 0x2A, 0x5D, 0x07, 0x6D,
+    0x3D, 0x36, 0xCA, 0x93, 0x6F, 0x21, 0xB6, 0x6E, 0xE2, 0x60, 0x21, 0x1F, 0xEA, 0x47, 0x9B, 0x14,
+    0x09, 0x3B, 0xEB, 0xE8, 0x22, 0xF0, 0xFB, 0x3E, 0x5F, 0x33, 0x24, 0x60, 0xC6, 0x3F, 0x7F, 0xA7,
+    0x14, 0x74, 0x91, 0x8A, 0x83, 0x9F, 0xFC, 0x8C, 0xA0, 0x3E, 0x14, 0x09, 0x92, 0xD6, 0x31, 0xDF,
+    0x30, 0xB9, 0x88, 0x8C, 0xE2, 0xDF, 0xDD, 0xF7, 0xA9, 0x84, 0xBF, 0x1E, 0x58, 0xC2, 0xDB, 0x8C,
+    0x3C, 0x43, 0x61, 0x10, 0xD5, 0x80, 0x85, 0x4A, 0x8F, 0x9B, 0x68, 0xC8, 0x67, 0x70, 0x85, 0x9C,
+    0x93, 0x5C, 0xC2, 0x5E, 0x1E, 0x3B, 0x72, 0x06, 0x48, 0x22, 0x16, 0x71, 0xA4, 0xEA, 0xE9, 0x00,
+    0xA5, 0x02, 0x4A, 0x7C, 0xB5, 0x8A, 0x7C, 0xDA, 0x24, 0xA9, 0x46, 0xBF, 0x7D, 0xBC, 0xD1, 0x55,
+    0xE4, 0x40, 0x39, 0xA1, 0x45, 0x66, 0xA5, 0xF6, 0xD9, 0xD7, 0xB2, 0x43, 0xA4, 0x08, 0x8B, 0x5C,
+    0xEA, 0x37, 0x00, 0xE1, 0x62, 0x49, 0xF4, 0x52, 0x2F, 0xA0, 0x06, 0x7F, 0x08, 0x07, 0x96, 0x08,
+    0xDC, 0x4D, 0x20, 0x00, 0xD4, 0x88, 0xDA, 0x8D, 0x40, 0x53, 0x92, 0x0E, 0x4A, 0x1F, 0x50, 0xDC,
+    0x22, 0xBB, 0x0D, 0xB8, 0x07, 0x18, 0x00, 0x8F, 0x0F, 0x95, 0x0A, 0xA9, 0x8D, 0xA5, 0x29, 0x8C,
+    0xE1, 0x20, 0xF7, 0x2F, 0xCA, 0x38, 0x32, 0x70, 0x94, 0xFA, 0xEE, 0x39, 0x30, 0x24, 0x79, 0x6A,
+    0x3E, 0x50, 0x7B, 0x63, 0x89, 0x0A, 0x27, 0x1D, 0xA3, 0x59, 0x6C, 0x4F, 0x0E, 0xBB, 0x9E, 0x60,
+    0x90, 0x4E, 0x44, 0xF7, 0x95, 0x24, 0x0F, 0x68, 0x53, 0x01, 0x47, 0x5F, 0x04, 0xA0, 0x44, 0xDD,
+    0xD7, 0xDB, 0x90, 0x58, 0x34, 0xCA, 0x04, 0xEB, 0xA9, 0x68, 0xF8, 0xBC, 0x72, 0x00, 0x6E, 0x3D,
+    0x1A, 0x0F, 0x63, 0xB0, 0x70, 0x88, 0x52, 0x2D, 0x67, 0x97, 0x36, 0xD4, 0xB4, 0x6B, 0xA8, 0x96,
+    0xBF, 0x43, 0x32, 0x3C, 0x4B, 0xCB, 0x8F, 0x27, 0xC5, 0x79, 0xDA, 0xF7, 0x52, 0xCD, 0xF4, 0x57,
+    0xEE, 0xB5, 0x52, 0xB2, 0x4A, 0xB4, 0x1A, 0x1D, 0xF6, 0xC4, 0x6F, 0xD2, 0x6C, 0xCF, 0x51, 0x6D,
+    0x38, 0x91, 0xCC, 0x51, 0x42, 0x44, 0x61, 0x12, 0xA5, 0xDD, 0x43, 0x44, 0xFA, 0xDC, 0x87, 0xEC,
+    0x78, 0x84, 0x6C, 0xBA, 0xE1, 0x69, 0x48, 0x78, 0xE7, 0x66, 0x54, 0x8C, 0x8B, 0x68, 0x1B, 0x2E,
+    0x3A, 0x6D, 0xEB, 0x60, 0x12, 0xF2, 0x88, 0xA2, 0x2A, 0xF5, 0x16, 0x36, 0xF7, 0x0E, 0x30, 0x5E,
+    0xEE, 0x42, 0x16, 0x08, 0x99, 0x69, 0x8F, 0x1F, 0xD9, 0x15, 0xC9, 0x62, 0x30, 0x0C, 0x40, 0x23,
+    0x51, 0x48, 0x0B, 0x1A, 0x01, 0xF9, 0x31, 0xBE, 0x7F, 0x7D, 0x04, 0x0D, 0xBA, 0x54, 0xAB, 0x01,
+    0x8A, 0xEB, 0x83, 0x31, 0x05, 0x75, 0xFC, 0x0A, 0x93, 0x87, 0xF6, 0x4D, 0xDC, 0x1B, 0x5C, 0x4F,
+    0x7B, 0xB2, 0xA8, 0x6F, 0x71, 0x36, 0x20, 0xE3, 0x56, 0x99, 0xA4, 0xB3, 0x9D, 0x8E, 0x1D, 0xCA,
+    0x04, 0x1C, 0xF0, 0x6A, 0xFD, 0x0A, 0xE0, 0x2D, 0x36, 0xD9, 0xBB, 0x65, 0x57, 0x11, 0x8F, 0xF4,
+    0xCA, 0xDC, 0x32, 0xC6, 0xBA, 0xEB, 0x00, 0xEF, 0x2C, 0xEA, 0x7A, 0xA5, 0x53, 0x7A, 0x3C, 0x73,
+    0x1B, 0x50, 0x8F, 0xF4, 0x08, 0x97, 0x93, 0x18, 0xFC, 0x3D, 0x3F, 0xCC, 0x45, 0x66, 0x87, 0x9C,
+    0x79, 0xB3, 0xF4, 0x30, 0xD1, 0x74, 0xBD, 0x0B, 0xCB, 0x36, 0x40, 0xEF, 0x86, 0xE1, 0xDE, 0x39,
+    0x39, 0x6F, 0xCF, 0xCE, 0xFF, 0x26, 0xAC, 0x39, 0xD0, 0x40, 0x54, 0x62, 0xA2, 0xC9, 0xB1, 0x7D,
+    0x27, 0x2E, 0xA8, 0x19, 0xA2, 0xC0, 0xBA, 0xD9, 0x68, 0x0A, 0x5D, 0x8C, 0x04, 0x63, 0x95, 0x89,
+    0xC1, 0xAA, 0x85, 0x7D, 0xC5, 0xDD, 0x18, 0xBA, 0x37, 0x8B, 0x95, 0x0F, 0x2B, 0xB4, 0x31, 0x59,
+    0xD0, 0x28, 0x39, 0xBE, 0xB2, 0x13, 0xFA, 0x52, 0x0D, 0x0D, 0x6B, 0x67, 0xE8, 0x07, 0x13, 0xC1,
+    0x2F, 0x00, 0x73, 0xC0, 0x57, 0xA2, 0xD6, 0xB9, 0xD4, 0x11, 0x01, 0x99, 0x40, 0x5C, 0x0F, 0x76,
+    0x04, 0x46, 0xDF, 0x14, 0xC6, 0x87, 0x65, 0xE7, 0x44, 0x3A, 0x46, 0x95, 0x2C, 0x4D, 0x0F, 0x3D,
+    0xF1, 0x36, 0x92, 0xFE, 0xBC, 0xCF, 0x8F, 0xD9, 0x01, 0xFB, 0x2E, 0xA1, 0x6F, 0x19, 0x40, 0x76,
+    0xCD, 0xF4, 0x1F, 0xFD, 0x91, 0xB9, 0xF6, 0x96, 0xF6, 0xB7, 0x07, 0x11, 0x67, 0x9B, 0x6D, 0x2D,
+    0x08, 0x58, 0xE2, 0xA3, 0xB3, 0x7F, 0x73, 0x42, 0xC1, 0x34, 0x6A, 0xAC, 0x30, 0x95, 0x1A, 0xDD,
+    0xF5, 0x28, 0xD5, 0xEF, 0xB1, 0xA1, 0x5E, 0x3F, 0xC7, 0x4B, 0x64, 0xC0, 0xFD, 0x34, 0x27, 0x4C,
+    0xCD, 0x17, 0xB7, 0x0B, 0x26, 0xFF, 0xE8, 0x4D, 0xF4, 0xBD, 0xF8, 0x42, 0x03, 0xE4, 0x78, 0x8A,
+    0x6F, 0x16, 0xA6, 0x35, 0xD7, 0x16, 0x53, 0x82, 0xDC, 0x43, 0x9F, 0x25, 0x34, 0xDF, 0xA1, 0xCD,
+    0x17, 0x9C, 0xBC, 0x81, 0x9F, 0xA2, 0xC7, 0xC8, 0xAA, 0x47, 0xDE, 0xC0, 0x7C, 0xD0, 0xB3, 0x5E,
+    0xA6, 0x3A, 0xD5, 0x08, 0x8E, 0xAD, 0x63, 0x96, 0x6E, 0x11, 0x74, 0x6F, 0x87, 0x66, 0xC2, 0x66,
+    0x1D, 0x72, 0xEA, 0x45, 0x4F, 0xC2, 0xBE, 0x8C, 0xBD, 0x43, 0xAC, 0x81, 0xE5, 0xD5, 0xCA, 0xBE,
+    0x1D, 0xF5, 0xF3, 0x45, 0x72, 0x64, 0x05, 0xCB, 0x2F, 0x8A, 0x8D, 0xCB, 0xED, 0xF0, 0x07, 0x96,
+    0x47, 0xA7, 0x5C, 0xCE, 0x95, 0xCB, 0xE2, 0xB1, 0xBC, 0xA1, 0xEA, 0x21, 0xE5, 0x01, 0xC5, 0x9A,
+    0x31, 0xC5, 0x81, 0xFE, 0xCA, 0xBD, 0xF2, 0x5A, 0xF9, 0x7F, 0xD7, 0x7F, 0x9D, 0x55, 0x31, 0x8E,
+    0xE5, 0x44, 0x10, 0x2D, 0xBB, 0x99, 0x35, 0x92, 0x83, 0xDE, 0x90, 0xCC, 0x29, 0x99, 0x6F, 0x40,
+    0xFF, 0x11, 0x07, 0x60, 0x02, 0x44, 0x40, 0x4C, 0x44, 0x32, 0x27, 0x60, 0x6C, 0x69, 0x03, 0x02,
+    0x82, 0xDD, 0x80, 0x23, 0x20, 0x21, 0x7D, 0x82, 0x39, 0xC1, 0x62, 0xAF, 0xE6, 0x02, 0x96, 0x38,
+    0xC0, 0x1A, 0x44, 0xC4, 0x06, 0xBF, 0xA5, 0xF5, 0x0A, 0x33, 0xD3, 0xED, 0xE2, 0xBD, 0xF2, 0x0C,
+    0x23, 0x96, 0x8C, 0xAF, 0x3F, 0x3D, 0x56, 0x77, 0xBB, 0xEA, 0xBD, 0x57, 0xAF, 0xEA, 0x8B, 0x3C,
+    0xF9, 0x41, 0x44, 0x3A, 0x5D, 0x44, 0x54, 0xF5, 0x50, 0xE8, 0xAD, 0x46, 0xD1, 0xA9, 0xDE, 0x44,
+    0x47, 0x7C, 0x87, 0x49, 0xDA, 0x25, 0x44, 0xA9, 0x72, 0xB3, 0x48, 0xA1, 0xDF, 0x25, 0xDC, 0xFD,
+    0x45, 0x45, 0x9A, 0x05, 0xC7, 0x75, 0xC6, 0x89, 0x53, 0x8F, 0x4D, 0x7D, 0x86, 0xCD, 0x61, 0xC2,
+    0x66, 0x88, 0xED, 0x8A, 0xC5, 0x69, 0xDF, 0x2D, 0x32, 0x28, 0x02, 0xD7, 0x8A, 0x90, 0x72, 0xA9,
+    0x2F, 0x90, 0xE8, 0xA9, 0xF0, 0xF3, 0x25, 0x72, 0xB6, 0xAA, 0x13, 0x53, 0x2E, 0x72, 0xB7, 0x5D,
+    0x26, 0x71, 0xA9, 0xCE, 0x52, 0x25, 0xB7, 0xED, 0x4B, 0xBD, 0xBA, 0x2C, 0x7E, 0xA9, 0x92, 0xF8,
+    0xE8, 0x57, 0x69, 0x62, 0x17, 0xF9, 0x46, 0x2F, 0x41, 0xB3, 0x48, 0xF8, 0xE3, 0x80, 0x65, 0x24,
+    0x70, 0x2E, 0x43, 0x8F, 0x05, 0x67, 0x00, 0x38, 0x01, 0x9A, 0x02, 0x4F, 0xE0, 0x22, 0x3B, 0x39,
+    0xB0, 0x8B, 0xB2, 0xD3, 0x93, 0x9D, 0xDF, 0x4E, 0x70, 0x67, 0x28, 0x46, 0x51, 0x8C, 0xA3, 0x18,
+    0xC9, 0xBE, 0x26, 0xCB, 0xC9, 0x19, 0x4D, 0x31, 0x9E, 0x62, 0x44, 0xC5, 0x98, 0xF6, 0xCE, 0xA8,
+    0x8A, 0x71, 0x15, 0x23, 0x8B, 0xB3, 0x03, 0xD8, 0x22, 0x11, 0x83, 0x83, 0xEF, 0x4C, 0x54, 0x1B,
+    0x40, 0x4A, 0x65, 0xAB, 0xB4, 0xF6, 0xAF, 0x50, 0xFD, 0x5E, 0xEC, 0x02, 0x42, 0x00, 0xA8, 0x12,
+    0xFD, 0xA5, 0xAD, 0x72, 0x76, 0xAF, 0x4B, 0x4D, 0x49, 0x3C, 0xC1, 0xBA, 0xEB, 0x05, 0xAC, 0x5D,
+    0x02, 0xAE, 0x42, 0x05, 0xE0, 0xBB, 0x3E, 0x00, 0xEB, 0xEC, 0x23, 0x94, 0xA9, 0x29, 0x19, 0xE4,
+    0x29, 0xF4, 0x1A, 0xA0, 0x06, 0x5D, 0xC9, 0x19, 0xC9, 0xFD, 0x3B, 0x10, 0x73, 0x09, 0x17, 0x0B,
+    0xAD, 0x78, 0xD2, 0x13, 0xE7, 0xD4, 0x24, 0x69, 0xFE, 0x2A, 0x75, 0xEC, 0x74, 0x0A, 0x19, 0x17,
+    0x4B, 0x02, 0x90, 0x0F, 0xF0, 0xF7, 0xF5, 0x05, 0x61, 0xF5, 0x25, 0xD2, 0x96, 0xFA, 0x45, 0x16,
+    0x95, 0x00, 0x55, 0xFD, 0xD8, 0x44, 0x37, 0x55, 0x1B, 0x75, 0x8B, 0x2C, 0x56, 0x2F, 0x25, 0x25,
+    0x6D, 0x09, 0x96, 0xC9, 0x6A, 0x15, 0x94, 0x77, 0xFC, 0x06, 0xA5, 0x69, 0xFB, 0x2A, 0xF9, 0xC5,
+    0x6D, 0x4E, 0x4F, 0xCA, 0x8A, 0xE3, 0x26, 0x6A, 0x24, 0xC6, 0x1B, 0x1F, 0x72, 0xC9, 0xE0, 0xAA,
+    0xA9, 0xBD, 0xD5, 0x9F, 0x52, 0x28, 0xB4, 0x48, 0xA1, 0xD4, 0x62, 0xF9, 0xA4, 0xDC, 0xCA, 0xF8,
+    0x91, 0xCB, 0x45, 0x0F, 0xC0, 0x94, 0x8A, 0x0B, 0xB5, 0x17, 0x54, 0x1C, 0xCB, 0xC2, 0x85, 0x95,
+    0x6B, 0xB8, 0xB4, 0xD4, 0x34, 0xD8, 0x32, 0x51, 0xDD, 0xDF, 0x19, 0x39, 0x73, 0x49, 0xF7, 0x89,
+    0x9C, 0x2A, 0xBE, 0x41, 0xE7, 0xA0, 0x53, 0x37, 0xA3, 0x82, 0x15, 0x35, 0x02, 0x48, 0x08, 0x57,
+    0xAF, 0x52, 0x2F, 0xD4, 0x70, 0x60, 0x48, 0x1F, 0x21, 0xA8, 0x6C, 0xD2, 0x46, 0x69, 0x26, 0xB8,
+    0xAD, 0xCC, 0x0C, 0xDA, 0x8E, 0xCE, 0x5E, 0x80, 0xA7, 0x02, 0x28, 0x49, 0x1D, 0x11, 0x03, 0x17,
+    0x2B, 0x3D, 0x47, 0xB9, 0x83, 0x92, 0xB6, 0x32, 0x65, 0xA9, 0xD4, 0x45, 0x2E, 0xE4, 0xE1, 0x83,
+    0x42, 0x06, 0xBD, 0xC1, 0xAE, 0x66, 0xD8, 0x07, 0x19, 0x61, 0x5E, 0x04, 0xA2, 0x71, 0x59, 0x30,
+    0x68, 0x8A, 0xA0, 0x15, 0x5B, 0x0C, 0x91, 0x71, 0x52, 0x24, 0x32, 0xF3, 0x20, 0xD3, 0x4E, 0x03,
+    0x0D, 0xFA, 0x29, 0xCE, 0x8A, 0xAD, 0x85, 0xB6, 0x6E, 0x35, 0x01, 0xEE, 0x8C, 0xA8, 0x15, 0x69,
+    0x58, 0xCC, 0x39, 0x34, 0x89, 0xCB, 0x26, 0xE8, 0x2C, 0xEF, 0x7D, 0x5A, 0x5D, 0xAA, 0xB1, 0xD1,
+    0xD7, 0xBA, 0xBA, 0x58, 0x69, 0xEC, 0xE6, 0x22, 0xD3, 0x27, 0x2B, 0x08, 0xFB, 0x08, 0x7E, 0x90,
+    0x22, 0xC2, 0x09, 0x61, 0x71, 0x2B, 0xF6, 0x9B, 0x8C, 0xFC, 0xF5, 0xEA, 0xB5, 0xDF, 0x90, 0xB4,
+    0x3A, 0xCD, 0x1D, 0x10, 0x3C, 0x7B, 0xBB, 0x02, 0x9A, 0xFF, 0x75, 0xFD, 0xB9, 0x19, 0x81, 0x30,
+    0xB5, 0xCF, 0x91, 0x45, 0xAF, 0xEA, 0x3F, 0xA1, 0x7D, 0x38, 0x9D, 0x93, 0xBB, 0x87, 0x7D, 0x12,
+    0xD9, 0x4F, 0x0D, 0xF9, 0x0F, 0x48, 0xC5, 0xDC, 0x26, 0x2B, 0x8B, 0xC7, 0x86, 0x44, 0x62, 0x3F,
+    0xBD, 0x0F, 0x0F, 0x44, 0x26, 0xD8, 0x22, 0xE8, 0x08, 0xF5, 0xD0, 0x78, 0xD0, 0x1A, 0x3D, 0x34,
+    0xB0, 0x1B, 0x0B, 0x32, 0xD2, 0x6F, 0x49, 0xB1, 0x7B, 0xBD, 0x73, 0x66, 0x33, 0x5B, 0x02, 0x6B,
+    0x37, 0x3C, 0xDB, 0x1A, 0x6C, 0x67, 0x63, 0x46, 0xB7, 0xF2, 0x8E, 0x8F, 0xEC, 0xFD, 0x30, 0xD2,
+    0x12, 0x03, 0x2D, 0x52, 0x6E, 0xB0, 0x38, 0xA4, 0x40, 0xAA, 0x3E, 0xE8, 0x2B, 0x76, 0xFB, 0x6E,
+    0xBF, 0x85, 0xB5, 0x49, 0x1E, 0xCE, 0xA7, 0x08, 0x04, 0xDA, 0x03, 0x32, 0xD0, 0x42, 0x0A, 0x72,
+    0x25, 0x60, 0xFD, 0x8C, 0xC5, 0x78, 0x13, 0xE9, 0x22, 0x1B, 0x16, 0x44, 0xD4, 0xD0, 0x86, 0x66,
+    0xCD, 0x62, 0xAF, 0x44, 0xFF, 0x60, 0x41, 0xF3, 0x66, 0xCD, 0x9E, 0x0E, 0xBC, 0xF9, 0xE8, 0x41,
+    0x9A, 0x50, 0x47, 0x6B, 0xDF, 0xEE, 0x78, 0x9D, 0xCB, 0x55, 0x86, 0xB9, 0x1E, 0xD1, 0x47, 0x8D,
+    0x74, 0x16, 0x9C, 0x11, 0xEC, 0x01, 0xEF, 0x62, 0x76, 0x70, 0xDC, 0xDC, 0x53, 0x64, 0x85, 0xC1,
+    0xF8, 0x2B, 0xCC, 0x16, 0x17, 0xA1, 0x52, 0x33, 0xC2, 0xC4, 0x70, 0xF4, 0x51, 0x17, 0xC6, 0x1B,
+    0x31, 0xFE, 0xB6, 0x7F, 0x92, 0xC0, 0xD3, 0xA8, 0x21, 0xDE, 0xC5, 0x16, 0xF0, 0x53, 0x46, 0xB8,
+    0xA7, 0xE4, 0xE4, 0x83, 0xC1, 0x38, 0x8A, 0x84, 0xFE, 0x7D, 0x38, 0x4E, 0x76, 0xEC, 0x38, 0x24,
+    0x0E, 0x02, 0x2F, 0x40, 0x31, 0x6B, 0xAD, 0x7F, 0x1F, 0x63, 0x7A, 0x86, 0x2C, 0xE5, 0x11, 0x53,
+    0xD6, 0x5C, 0xC6, 0x7D, 0xDC, 0xAF, 0x1F, 0x9F, 0xF0, 0xCA, 0x9E, 0x82, 0x31, 0x98, 0xF3, 0xF1,
+    0x69, 0xB4, 0xA7, 0x6D, 0x8F, 0xB4, 0xD8, 0x13, 0xD4, 0x2D, 0x2E, 0x0C, 0xEC, 0xB0, 0x83, 0xFD,
+    0x2F, 0xB0, 0xFF, 0x8D, 0x9B, 0x60, 0x21, 0x41, 0x79, 0x84, 0x8E, 0x4F, 0x5E, 0xEC, 0xBB, 0x98,
+    0xD6, 0x12, 0xD2, 0xFE, 0xF7, 0xF2, 0x0A, 0x50, 0x83, 0x14, 0x6B, 0x38, 0xB8, 0xA5, 0x19, 0xAB,
+    0xE8, 0xA7, 0x7A, 0xAE, 0x67, 0x8F, 0x4E, 0x40, 0x9F, 0xAF, 0x6D, 0x5F, 0xAE, 0xC7, 0xE3, 0xF1,
+    0x47, 0x08, 0x7B, 0x52, 0x35, 0xCF, 0x89, 0xEB, 0x5F, 0xC2, 0x54, 0xAF, 0xB2, 0x8B, 0x1F, 0x02,
+    0xF7, 0x19, 0xFA, 0xFE, 0x72, 0xAC, 0x30, 0xCB, 0xAB, 0xAD, 0x8B, 0x2E, 0xB9, 0x84, 0x29, 0x81,
+    0x0E, 0x97, 0xEE, 0x80, 0x39, 0x3C, 0xB6, 0x18, 0x90, 0xFC, 0x69, 0xB2, 0xF1, 0x8C, 0x2A, 0x1D,
+    0xC2, 0xCD, 0xE9, 0xCD, 0x73, 0x7D, 0xAB, 0xBF, 0x69, 0xC4, 0x04, 0x9A, 0xD1, 0xF8, 0x87, 0xFB,
+    0xB1, 0x5E, 0x41, 0x00, 0xF4, 0x8E, 0x9C, 0xD1, 0x3F, 0xDD, 0xC1, 0x48, 0x70, 0x24, 0xC8, 0x56,
+    0x1C, 0x8A, 0xD4, 0x2E, 0x45, 0xD2, 0x54, 0xDE, 0x6A, 0x72, 0x77, 0x37, 0xD9, 0x69, 0x99, 0xAB,
+    0x8C, 0x1F, 0x43, 0xE4, 0xC3, 0x4C, 0x4D, 0x3E, 0x56, 0xAB, 0xC7, 0xC4, 0x6F, 0xA7, 0x66, 0x0E,
+    0x13, 0xDC, 0x7E, 0x0B, 0x63, 0xA1, 0x8B, 0xAE, 0x06, 0xD8, 0xB0, 0x60, 0x82, 0xCF, 0xD9, 0x90,
+    0x95, 0xA6, 0x4A, 0x37, 0x60, 0xA1, 0x92, 0xD0, 0x0E, 0xBD, 0x05, 0x7F, 0xFB, 0x68, 0xEE, 0x55,
+    0xF9, 0x38, 0xC4, 0x0E, 0x1E, 0x3A, 0x87, 0x2B, 0xD9, 0x59, 0x4F, 0x1F, 0x3B, 0xF3, 0x6F, 0x9D,
+    0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0xB6, 0x6F, 0x31, 0x92, 0x8B, 0xA1, 0x08, 0x91, 0x10,
+    0xC5, 0x34, 0x50, 0xFB, 0x27, 0xCC, 0x40, 0x8A, 0x2B, 0x52, 0xB0, 0x45, 0x3A, 0x84, 0xF2, 0x07,
+    0x90, 0xB6, 0xA1, 0x85, 0x31, 0xA1, 0xA0, 0xA0, 0x80, 0x1A, 0x1A, 0x4A, 0x92, 0x82, 0x50, 0xD0,
+    0x72, 0x33, 0x77, 0x57, 0xA4, 0xA0, 0x88, 0x15, 0x14, 0x52, 0x50, 0x60, 0x44, 0xA4, 0x14, 0x14,
+    0x3B, 0x24, 0x96, 0x6E, 0x92, 0x8C, 0xFD, 0xF8, 0x9E, 0xBD, 0x57, 0xA5, 0x63, 0xA5, 0xDB, 0x5B,
+    0x7B, 0xE6, 0xBD, 0x79, 0xEF, 0xFB, 0xBE, 0xF7, 0x0D, 0x11, 0x6D, 0x88, 0x0A, 0x1E, 0x88, 0x38,
+    0x13, 0x5D, 0x9D, 0x89, 0xC8, 0x59, 0xA2, 0x36, 0x10, 0xA9, 0x48, 0x9B, 0x6B, 0x89, 0xF4, 0x3C,
+    0x91, 0x66, 0x26, 0xFD, 0x9C, 0x83, 0x8A, 0x6A, 0x68, 0xC6, 0x6A, 0xAC, 0x72, 0x91, 0x8B, 0x99,
+    0x98, 0x3C, 0xB9, 0x60, 0x82, 0x19, 0x54, 0xD4, 0x78, 0xA9, 0x26, 0x62, 0xE5, 0x7F, 0x34, 0x7C,
+    0x9F, 0xBF, 0xE2, 0x73, 0xEE, 0xB8, 0x73, 0xB6, 0x20, 0xF9, 0xDC, 0x20, 0xF2, 0x23, 0x39, 0x0E,
+    0xFA, 0x41, 0xAE, 0xA2, 0x0E, 0x73, 0x95, 0x54, 0xF0, 0x65, 0x6E, 0x83, 0xD9, 0xC7, 0x8A, 0x47,
+    0x32, 0x8F, 0xA9, 0x4A, 0xF4, 0x93, 0x09, 0xAE, 0x64, 0x1E, 0x14, 0xDE, 0xB8, 0x44, 0xF4, 0xC6,
+    0x12, 0x4C, 0xB7, 0xE5, 0xCB, 0xA3, 0x3E, 0x32, 0x52, 0x69, 0x13, 0x7F, 0xC1, 0xCF, 0xB9, 0x94,
+    0x3A, 0x7B, 0xFC, 0xAA, 0x64, 0x85, 0x0C, 0x4A, 0xA6, 0x1D, 0x27, 0xD9, 0xC4, 0x96, 0xCA, 0xBB,
+    0x2F, 0xBE, 0xC1, 0x0B, 0x96, 0x25, 0x8D, 0x20, 0x2A, 0xA4, 0xB7, 0x57, 0x02, 0xEA, 0xB4, 0xE4,
+    0x46, 0x2A, 0x6A, 0x46, 0xBA, 0x0C, 0x40, 0xEB, 0xAF, 0x06, 0x74, 0xA6, 0xC3, 0xE3, 0x75, 0x2C,
+    0x55, 0x3C, 0x2F, 0xB5, 0x74, 0x12, 0xDA, 0x2D, 0x25, 0xBE, 0x89, 0x0C, 0xA8, 0x3C, 0x93, 0x92,
+    0x2F, 0xD3, 0xCF, 0x5B, 0xE0, 0xE8, 0xB1, 0x4C, 0xCB, 0x17, 0xB2, 0xFA, 0x72, 0x42, 0xCC, 0x77,
+    0x38, 0x4F, 0x33, 0x72, 0xD6, 0x13, 0xAD, 0x30, 0x93, 0x93, 0x0C, 0x06, 0xEF, 0x0B, 0x8F, 0x8C,
+    0xEA, 0x85, 0xF4, 0xDE, 0xB5, 0x19, 0x31, 0x15, 0xF0, 0x24, 0x84, 0x71, 0x57, 0x67, 0x80, 0xC7,
+    0x51, 0x88, 0xE8, 0xB0, 0xEF, 0x31, 0x1D, 0x78, 0x8B, 0x07, 0xDE, 0xF8, 0x90, 0x47, 0xAA, 0x95,
+    0xE2, 0xAB, 0xB4, 0xB1, 0xC5, 0xA4, 0x13, 0xF9, 0x96, 0xA9, 0xDD, 0x73, 0xAF, 0xF8, 0x3A, 0x70,
+    0xBE, 0x96, 0x0B, 0xEE, 0x66, 0xF2, 0xC1, 0x59, 0xD3, 0xB7, 0x42, 0x67, 0xAC, 0x53, 0x95, 0xCA,
+    0xA9, 0xC0, 0x21, 0xD6, 0x7F, 0x04, 0x2A, 0xF9, 0x83, 0xA8, 0xF8, 0xCB, 0xB1, 0x00, 0x84, 0x74,
+    0xB4, 0x60, 0x11, 0xD4, 0x58, 0x4B, 0x21, 0x6F, 0x09, 0x26, 0xB6, 0x4D, 0x86, 0x37, 0xBE, 0xD3,
+    0x7D, 0x13, 0x81, 0x0A, 0x72, 0x59, 0x13, 0xD4, 0x50, 0x8F, 0xE5, 0xF4, 0x89, 0x9F, 0xDA, 0x19,
+    0x3B, 0x0F, 0xA4, 0x11, 0x9D, 0x08, 0x24, 0x82, 0x16, 0x49, 0x13, 0x44, 0xDF, 0xAF, 0xAF, 0x8B,
+    0x2D, 0xC0, 0x88, 0x6B, 0xF1, 0x37, 0xE3, 0x5A, 0xAF, 0xFC, 0x09, 0x4B, 0x52, 0xBF, 0x80, 0x22,
+    0xDC, 0x08, 0xDC, 0xD2, 0x93, 0x90, 0xC3, 0x2B, 0x33, 0x28, 0x93, 0xCA, 0xBC, 0xF0, 0xF1, 0x0E,
+    0xE8, 0xFA, 0x6C, 0x37, 0x90, 0xE7, 0x00, 0x68, 0x88, 0xDE, 0x3E, 0x60, 0xA2, 0x79, 0x81, 0xA4,
+    0xD8, 0xC5, 0x25, 0x5A, 0x76, 0x4B, 0x72, 0xD3, 0x6D, 0x8B, 0xDC, 0xC6, 0xFA, 0x19, 0x0F, 0xED,
+    0x89, 0x0B, 0xDC, 0x9F, 0x54, 0x53, 0x35, 0xEA, 0xA1, 0x15, 0x15, 0x56, 0x33, 0x77, 0x0A, 0xA4,
+    0x38, 0x6F, 0xCB, 0xEC, 0xB1, 0x9F, 0xAD, 0x39, 0xE5, 0xC7, 0x73, 0xC9, 0x4F, 0x00, 0x04, 0xF2,
+    0x5A, 0xDA, 0x60, 0x46, 0x38, 0x63, 0x3E, 0x9C, 0x15, 0xDC, 0x2A, 0x91, 0xFF, 0xD2, 0x7A, 0xAC,
+    0x12, 0xAA, 0xF2, 0xB4, 0xA0, 0x90, 0x84, 0xAC, 0x8F, 0x0D, 0x2B, 0xBE, 0xC5, 0xF6, 0x48, 0x64,
+    0xBF, 0xA5, 0x6D, 0xCD, 0xEF, 0xCF, 0x15, 0x57, 0xFC, 0x37, 0xDF, 0xE3, 0xF0, 0xE1, 0x05, 0x5F,
+    0x30, 0x92, 0xFE, 0xC5, 0x0F, 0x40, 0x69, 0xF4, 0x03, 0xE8, 0x89, 0x26, 0x22, 0x7A, 0xC4, 0x0C,
+    0x0D, 0x55, 0xAE, 0x73, 0x33, 0x16, 0x73, 0x39, 0xA1, 0x45, 0x6F, 0x19, 0x00, 0x83, 0x13, 0xD0,
+    0x25, 0x8B, 0xED, 0xA3, 0xE3, 0xD4, 0x8C, 0x0D, 0x3F, 0x98, 0xCA, 0x5C, 0x72, 0x94, 0x45, 0xD7,
+    0x2F, 0x88, 0x2E, 0x13, 0xB6, 0x45, 0x89, 0xBE, 0x37, 0xB3, 0xE1, 0x62, 0xB7, 0xE7, 0x58, 0xC8,
+    0x0E, 0x9D, 0xD5, 0x50, 0x32, 0x0A, 0x34, 0xE8, 0xB4, 0xCA, 0x48, 0xEA, 0x3A, 0xD7, 0x21, 0xC9,
+    0x08, 0x38, 0x19, 0x9D, 0xAA, 0xA7, 0xA7, 0x98, 0xE3, 0xDC, 0x42, 0x20, 0xD7, 0xF2, 0x2A, 0x66,
+    0xBB, 0xCE, 0x2B, 0x40, 0x6D, 0x30, 0xF6, 0xFE, 0x8F, 0xA9, 0x4E, 0x4D, 0x36, 0x41, 0xFF, 0x8B,
+    0x5A, 0x7E, 0x45, 0x9C, 0x09, 0x75, 0x42, 0xD5, 0xBF, 0x41, 0xA1, 0x22, 0x1F, 0xD3, 0xBB, 0xE0,
+    0xFF, 0xC1, 0x03, 0x88, 0xF0, 0x50, 0xF1, 0x95, 0x85, 0xE2, 0x8D, 0x2D, 0xF9, 0x54, 0x50, 0xBD,
+    0xC9, 0xF6, 0xEA, 0x8C, 0x79, 0xA9, 0xF9, 0x38, 0x51, 0x0B, 0xC4, 0x89, 0x83, 0xEB, 0x16, 0xFC,
+    0x34, 0xBC, 0x04, 0x78, 0x9A, 0x50, 0xCA, 0x93, 0x88, 0x11, 0x34, 0xF9, 0xAE, 0xE0, 0x7D, 0x92,
+    0xA3, 0x3B, 0x32, 0x7B, 0x8C, 0xE4, 0x7C, 0x74, 0x98, 0xD2, 0x65, 0x12, 0x85, 0x8D, 0x86, 0xA1,
+    0x24, 0x39, 0xAE, 0xBC, 0x73, 0x7B, 0x15, 0xD4, 0x06, 0xE9, 0x77, 0xA1, 0x66, 0xEE, 0xEB, 0xD9,
+    0x45, 0xE9, 0x13, 0x44, 0x2C, 0xFE, 0x64, 0x85, 0x24, 0x14, 0x8F, 0xE4, 0x2A, 0x01, 0x5D, 0xF0,
+    0x03, 0x3D, 0x9A, 0xF3, 0x7D, 0x50, 0xFC, 0x24, 0x96, 0xFC, 0x34, 0x01, 0x1A, 0x4C, 0xB3, 0x35,
+    0x68, 0x5B, 0x07, 0x31, 0x97, 0x75, 0xDC, 0x1B, 0xE8, 0x41, 0xC1, 0x4D, 0xCA, 0x3B, 0x3F, 0xA0,
+    0xA7, 0xC2, 0xBA, 0x64, 0xCE, 0x41, 0xE1, 0xC6, 0xED, 0x32, 0x4D, 0x73, 0x5F, 0x63, 0x3E, 0x5A,
+    0x54, 0xE5, 0x03, 0x55, 0xF3, 0x2A, 0x31, 0x51, 0xDB, 0x74, 0x50, 0x5B, 0x58, 0xDC, 0x63, 0x75,
+    0x94, 0x1B, 0x90, 0x7A, 0x5A, 0xBC, 0xEF, 0x61, 0x06, 0x71, 0x98, 0x3C, 0x8C, 0x05, 0x06, 0x1D,
+    0xAD, 0x18, 0x1C, 0xE4, 0x07, 0x3C, 0x16, 0xA8, 0xCF, 0x04, 0x94, 0x76, 0xB7, 0x6F, 0x65, 0xF3,
+    0xB4, 0x0E, 0x5F, 0x13, 0x48, 0x0D, 0xD2, 0x3D, 0x12, 0xBF, 0xC6, 0x90, 0x15, 0x9F, 0xC1, 0xD6,
+    0x90, 0x16, 0xCE, 0x20, 0x50, 0xE0, 0x1C, 0x00, 0x2A, 0xCF, 0x48, 0xC4, 0x45, 0x30, 0xBF, 0x8F,
+    0x8A, 0x73, 0x05, 0xFD, 0xBB, 0x71, 0x21, 0x72, 0x2B, 0xC2, 0xED, 0x91, 0x1B, 0x60, 0x14, 0xBB,
+    0x5E, 0x0F, 0x85, 0x20, 0x03, 0xD7, 0x3D, 0x88, 0xC1, 0x42, 0x0C, 0x51, 0x81, 0x54, 0xC8, 0x5C,
+    0x0D, 0x26, 0x16, 0x53, 0xC3, 0x47, 0xED, 0xD9, 0xC5, 0xC5, 0x19, 0x67, 0x9F, 0x5B, 0xAE, 0xA1,
+    0x12, 0xF1, 0x3D, 0xBB, 0xCC, 0x7E, 0x61, 0xA1, 0xAF, 0x47, 0x1C, 0xF8, 0x5B, 0xEC, 0xC7, 0xFC,
+    0xA4, 0x7A, 0xD4, 0xC8, 0xE9, 0xC8, 0xDC, 0x4A, 0x34, 0x2B, 0xE4, 0x3C, 0xA1, 0xE6, 0x59, 0xA4,
+    0x96, 0x17, 0xBB, 0x87, 0xD7, 0x2C, 0xCC, 0xE9, 0xD5, 0x22, 0x25, 0x7E, 0x23, 0x62, 0xAC, 0xB2,
+    0x4F, 0x2A, 0xB6, 0x0F, 0x7D, 0xF0, 0xC5, 0x0C, 0x4E, 0x46, 0xD5, 0xEB, 0xDE, 0x75, 0xC0, 0xB5,
+    0x49, 0x1A, 0x63, 0xC4, 0x67, 0x23, 0xCD, 0x3A, 0x1B, 0x6A, 0x30, 0x32, 0x98, 0xF0, 0x4F, 0x73,
+    0x06, 0xBF, 0x5F, 0xEF, 0x2D, 0x06, 0x06, 0xFE, 0x5F, 0x4F, 0x2A, 0xCB, 0x2D, 0x25, 0xD6, 0x32,
+    0x34, 0xE1, 0xD2, 0x6D, 0x36, 0xB4, 0xB1, 0xB8, 0x84, 0xE6, 0x1A, 0xF5, 0x0D, 0x6E, 0x6A, 0x71,
+    0x6B, 0x3D, 0x91, 0x6B, 0x0D, 0x05, 0xD4, 0xA2, 0x1A, 0xC0, 0xBE, 0xDA, 0x90, 0x11, 0xBF, 0x11,
+    0x4F, 0x7A, 0x99, 0xE8, 0xDD, 0x13, 0x20, 0xC1, 0x67, 0x9C, 0x5C, 0xD4, 0xCB, 0x00, 0xF4, 0x47,
+    0x6B, 0x36, 0xCC, 0x2D, 0x35, 0x53, 0x25, 0x57, 0x5F, 0x39, 0xC3, 0x5F, 0xC5, 0x06, 0xBC, 0x05,
+    0xA7, 0xEE, 0x3D, 0xB1, 0xF1, 0xCF, 0x51, 0x81, 0x34, 0x4D, 0xE6, 0x0B, 0x00, 0xDD, 0xDE, 0x43,
+    0xCA, 0xF6, 0x3E, 0x0E, 0xD0, 0x7F, 0x76, 0xAB, 0x05, 0x91, 0x96, 0xA3, 0xB4, 0xE8, 0x56, 0xC7,
+    0xCB, 0xCB, 0xC6, 0x11, 0xBD, 0x2E, 0x16, 0xD6, 0xDE, 0x1D, 0xE5, 0xFA, 0x10, 0x8F, 0x93, 0x8B,
+    0xA4, 0x91, 0xEB, 0x09, 0x73, 0x03, 0xA7, 0x38, 0x8E, 0xB8, 0xBC, 0x4E, 0x99, 0xA7, 0xBA, 0x77,
+    0xBD, 0xA6, 0x89, 0xAE, 0x28, 0x64, 0x15, 0x55, 0x61, 0xCF, 0x7C, 0xF9, 0xEF, 0x67, 0xF5, 0xFC,
+    0x38, 0x32, 0xF3, 0xBD, 0x97, 0x3C, 0xA9, 0x53, 0xB9, 0x12, 0x8F, 0xE8, 0xFF, 0x7D, 0xFE, 0x03,
+    0xA5, 0x55, 0x31, 0x6C, 0xD6, 0x46, 0x14, 0x7E, 0xF6, 0x29, 0x78, 0x38, 0xC1, 0x75, 0x20, 0x48,
+    0x25, 0x52, 0xBC, 0xD3, 0x10, 0x2F, 0x1D, 0x50, 0x95, 0xE4, 0x9C, 0x74, 0xC8, 0xD8, 0x48, 0x6D,
+    0xA6, 0x0E, 0x59, 0xBA, 0x20, 0x55, 0x0A, 0x43, 0x07, 0x06, 0xC0, 0x16, 0x0C, 0x1D, 0x3A, 0x34,
+    0x1B, 0x63, 0x3B, 0x74, 0x29, 0x5D, 0x18, 0x32, 0x64, 0x48, 0xE2, 0x0B, 0x19, 0x50, 0x27, 0x8E,
+    0xB6, 0x5B, 0x07, 0xAE, 0x85, 0x01, 0x81, 0x54, 0x4C, 0x73, 0x83, 0xC3, 0x6F, 0xFB, 0xF5, 0x3B,
+    0x9B, 0x08, 0xC4, 0xC0, 0x52, 0xEB, 0x7F, 0x67, 0xFF, 0xE7, 0xBB, 0xF7, 0xBE, 0x7B, 0xDF, 0xF7,
+    0x9E, 0x89, 0x70, 0x15, 0x86, 0xB8, 0xA6, 0xEA, 0x29, 0xE9, 0x9C, 0x52, 0x43, 0xD2, 0x91, 0xF0,
+    0x44, 0x1D, 0x85, 0xFF, 0xCA, 0x50, 0x52, 0x93, 0x68, 0x48, 0xB6, 0x24, 0x5A, 0xAC, 0x2D, 0x49,
+    0xD6, 0x14, 0xE1, 0x69, 0x1F, 0xEF, 0x69, 0x58, 0x6F, 0x49, 0x8C, 0x53, 0x37, 0x88, 0x32, 0xAC,
+    0xE7, 0xC1, 0x9F, 0x7C, 0x42, 0xC3, 0xD5, 0xC1, 0x07, 0x5E, 0x66, 0x65, 0xDC, 0xC0, 0x21, 0x56,
+    0x16, 0x21, 0x02, 0x66, 0x2D, 0xB5, 0xD8, 0x7E, 0x32, 0xAB, 0x43, 0x9C, 0xFD, 0x93, 0xD9, 0x61,
+    0x03, 0x50, 0x4C, 0x8F, 0x3E, 0x22, 0xCE, 0x83, 0xCB, 0x8F, 0x7A, 0x04, 0x28, 0x87, 0x80, 0x00,
+    0x38, 0x06, 0x1C, 0x31, 0xC2, 0x63, 0xEC, 0x07, 0x4C, 0x69, 0x1D, 0x70, 0x8A, 0x6E, 0x40, 0xDB,
+    0x9D, 0x60, 0x4C, 0xDE, 0x60, 0x0E, 0x67, 0x8C, 0xD9, 0x11, 0x7E, 0xD9, 0x16, 0x5C, 0xE7, 0xF0,
+    0x5E, 0xCE, 0x6B, 0x5E, 0xE5, 0x09, 0xF7, 0xAD, 0xE4, 0x7B, 0xE5, 0x8C, 0x1B, 0x83, 0x86, 0x2D,
+    0xDA, 0xC2, 0x4F, 0x96, 0x0F, 0x7F, 0xE3, 0x80, 0x52, 0x38, 0x44, 0x7D, 0x7D, 0x80, 0x80, 0xD2,
+    0xE0, 0x7D, 0x51, 0x4A, 0x4F, 0x8C, 0xD0, 0x71, 0x47, 0x17, 0xF2, 0x11, 0x32, 0x49, 0x43, 0xA4,
+    0x4A, 0x18, 0x26, 0x52, 0xFC, 0xCF, 0xE0, 0xA2, 0xD8, 0xA2, 0x94, 0x1B, 0xAA, 0xB8, 0x15, 0xBC,
+    0xD7, 0xCA, 0x66, 0xE7, 0xAC, 0x72, 0x1E, 0x3E, 0xE0, 0xF8, 0x00, 0x76, 0xD3, 0x91, 0xBE, 0x65,
+    0x61, 0x86, 0xF4, 0x7D, 0x73, 0x37, 0x9B, 0x7C, 0x5B, 0x2B, 0x66, 0x9B, 0x30, 0x13, 0x55, 0x4F,
+    0x06, 0x17, 0x34, 0x0F, 0x5B, 0x82, 0x2D, 0xC2, 0xAE, 0xC1, 0x76, 0x61, 0x6B, 0x74, 0x72, 0x9D,
+    0x42, 0xA2, 0x88, 0x31, 0xA8, 0x49, 0xD8, 0x13, 0x23, 0x13, 0x3E, 0xC1, 0x41, 0xCD, 0x2C, 0x11,
+    0x92, 0x47, 0x09, 0x92, 0x44, 0x1A, 0xC8, 0x32, 0x0E, 0x2C, 0xC1, 0x71, 0x5C, 0x3D, 0xFB, 0x09,
+    0x5B, 0x30, 0x0D, 0x92, 0x81, 0xD4, 0x62, 0xA8, 0x60, 0x9F, 0x37, 0x74, 0x4E, 0x60, 0x41, 0x9B,
+    0x62, 0xA8, 0x8B, 0x87, 0x15, 0xD3, 0x57, 0x63, 0x56, 0x88, 0xF2, 0x9D, 0xA9, 0xB5, 0x6B, 0xF2,
+    0x39, 0xBF, 0xB0, 0x70, 0x53, 0x13, 0xAF, 0xB6, 0xE0, 0x00, 0x59, 0xF5, 0xE0, 0x44, 0x53, 0x5A,
+    0x8A, 0x1A, 0xFC, 0xE8, 0xBC, 0x22, 0xC9, 0x55, 0x0D, 0xF4, 0x6C, 0xF6, 0xD2, 0x27, 0x37, 0x62,
+    0x6C, 0x2E, 0x0B, 0x3E, 0xE0, 0xB6, 0xE2, 0x43, 0x6E, 0x37, 0x3B, 0xAA, 0x9C, 0x42, 0x32, 0x28,
+    0x69, 0xA3, 0x40, 0x17, 0xE2, 0xC7, 0x1D, 0xC4, 0x45, 0x0C, 0xC2, 0xCE, 0xB3, 0x7E, 0x1A, 0x40,
+    0xB6, 0x34, 0x55, 0x1C, 0x7F, 0x01, 0xBC, 0xF5, 0x80, 0xB9, 0x46, 0xFE, 0x40, 0xDC, 0x70, 0x04,
+    0xD2, 0x25, 0x0D, 0x82, 0x04, 0x81, 0x20, 0x32, 0xC5, 0x5A, 0x2C, 0x69, 0xDE, 0xAF, 0xBA, 0xB7,
+    0xAF, 0xF8, 0xC7, 0xF7, 0xA9, 0xAE, 0x2A, 0xE1, 0xCD, 0x24, 0xAF, 0x18, 0x8B, 0x5A, 0xD1, 0xC6,
+    0x2E, 0x45, 0xEE, 0x8E, 0x3C, 0x89, 0xFB, 0x9E, 0x54, 0xD2, 0xD0, 0x12, 0x88, 0xDF, 0x83, 0x75,
+    0xC2, 0x47, 0xBD, 0x70, 0x11, 0x83, 0x70, 0x06, 0xD1, 0xFD, 0x55, 0x98, 0x5D, 0x88, 0x58, 0xD4,
+    0x49, 0xA3, 0x5C, 0x66, 0x34, 0x80, 0x69, 0x50, 0x72, 0x6E, 0xA0, 0x29, 0xAE, 0xAF, 0x57, 0x8A,
+    0x5F, 0x76, 0x57, 0x25, 0x98, 0x9A, 0x0E, 0x62, 0x29, 0x86, 0x03, 0x6D, 0x7D, 0xE9, 0x82, 0x5C,
+    0x64, 0x29, 0x6C, 0x20, 0x79, 0x3B, 0xE6, 0x7C, 0x5B, 0x45, 0x10, 0xCA, 0x3D, 0xAB, 0x13, 0x33,
+    0xB7, 0x20, 0xCD, 0xA5, 0xE8, 0xB1, 0xC1, 0x11, 0xCF, 0x5C, 0x82, 0xDE, 0xE9, 0xA8, 0xC4, 0xA3,
+    0x5A, 0x08, 0x8F, 0x8F, 0x0D, 0x98, 0x9D, 0xBD, 0x98, 0xF4, 0x5F, 0xC7, 0xC6, 0x01, 0xF2, 0x82,
+    0xCC, 0x37, 0x9D, 0xCC, 0x21, 0x90, 0xD8, 0x91, 0x0F, 0x0A, 0x11, 0xC7, 0x11, 0x94, 0x9F, 0x70,
+    0x50, 0x40, 0xB4, 0x8E, 0xE1, 0xC3, 0xB3, 0xF0, 0x9C, 0x4C, 0x1A, 0x75, 0x50, 0xA7, 0x2B, 0x75,
+    0x26, 0xDC, 0x92, 0xB4, 0x3A, 0xFD, 0x55, 0x73, 0x97, 0x1E, 0x35, 0x53, 0x39, 0x80, 0x7E, 0x90,
+    0xB1, 0x07, 0xB0, 0x69, 0xA4, 0x7E, 0x96, 0x2E, 0x51, 0x15, 0x75, 0xA2, 0x95, 0x3E, 0xAD, 0xB5,
+    0x2D, 0x0C, 0xE7, 0xD5, 0x72, 0x4F, 0x7C, 0x13, 0x99, 0xC1, 0xB3, 0x72, 0xDA, 0x24, 0x5E, 0x21,
+    0x54, 0x3C, 0xD4, 0xCD, 0xF4, 0xFA, 0xFA, 0x2A, 0x73, 0x57, 0x30, 0x3F, 0x5C, 0x5F, 0x47, 0xC2,
+    0x51, 0xAD, 0xB4, 0x37, 0xDE, 0x2E, 0xE3, 0xC6, 0x2D, 0xF3, 0x83, 0x40, 0x15, 0xA0, 0xAC, 0x05,
+    0xD6, 0x2C, 0x4E, 0x3B, 0x4F, 0x17, 0x29, 0xB2, 0xA7, 0xB5, 0x9F, 0x93, 0xC9, 0xF7, 0xE2, 0x56,
+    0xF9, 0xB7, 0xBD, 0x6B, 0x17, 0xEB, 0xB9, 0x8F, 0x55, 0x2D, 0xCF, 0x88, 0x7F, 0xE2, 0xC3, 0x83,
+    0x23, 0xE7, 0xAE, 0xF4, 0x8B, 0xDF, 0x28, 0x02, 0x16, 0x0F, 0xDD, 0xCB, 0x67, 0xE0, 0xF9, 0xFC,
+    0x16, 0xF2, 0xFA, 0x27, 0x77, 0x15, 0x07, 0x35, 0xC8, 0x8E, 0xB8, 0x57, 0x93, 0xAE, 0x88, 0x8F,
+    0xBD, 0x98, 0x58, 0xF5, 0xC8, 0xEC, 0xEB, 0x17, 0x75, 0xC1, 0xF9, 0xE6, 0xD0, 0x88, 0xD0, 0x37,
+    0x20, 0x85, 0x37, 0xB7, 0x64, 0xC4, 0xF8, 0xDB, 0x2F, 0xFD, 0xCF, 0xEF, 0xBC, 0x4B, 0x87, 0x0A,
+    0xBE, 0x70, 0xE7, 0xCE, 0xED, 0x71, 0x49, 0xA8, 0x08, 0x9A, 0x71, 0x81, 0x8B, 0x57, 0x7D, 0x62,
+    0x6F, 0xC4, 0xF9, 0x7E, 0xE8, 0x0C, 0x10, 0x0E, 0x74, 0x5A, 0x85, 0xB2, 0x41, 0xD1, 0x80, 0x64,
+    0xCD, 0xA1, 0xB8, 0x68, 0xB3, 0x54, 0x6C, 0xF6, 0x8B, 0x15, 0x73, 0x9D, 0x06, 0xD9, 0xE9, 0x86,
+    0x26, 0x9E, 0x42, 0x11, 0xE6, 0x51, 0x7B, 0x81, 0x2D, 0x14, 0x7A, 0x39, 0x94, 0xD1, 0xA2, 0xFA,
+    0xAB, 0xD3, 0xDF, 0xB9, 0xED, 0x31, 0x11, 0x6B, 0x70, 0x82, 0x1C, 0x6A, 0x93, 0xC1, 0x97, 0x81,
+    0xBC, 0x8B, 0x32, 0x0C, 0x39, 0x34, 0x5E, 0xE1, 0x86, 0x02, 0xAD, 0x68, 0x1C, 0x90, 0x79, 0x8A,
+    0xFA, 0xA8, 0xC7, 0x20, 0x7A, 0x8A, 0x79, 0x83, 0x4F, 0xA3, 0x4E, 0x8B, 0x4E, 0x70, 0x97, 0x35,
+    0xC9, 0x0B, 0x30, 0x21, 0x5D, 0x1E, 0x91, 0x0A, 0x64, 0x28, 0x7B, 0x52, 0xD2, 0x99, 0x79, 0x5D,
+    0xF8, 0xF4, 0xC9, 0x5B, 0x15, 0xB0, 0x09, 0x22, 0xB0, 0x19, 0x27, 0xE0, 0x1F, 0x72, 0x08, 0xF1,
+    0xB3, 0xD0, 0x3C, 0x36, 0x50, 0x4F, 0x3C, 0x0F, 0xCF, 0xBC, 0x84, 0xA1, 0x5F, 0xC4, 0xD0, 0x2D,
+    0x60, 0x68, 0xAF, 0xE1, 0x45, 0xBB, 0x83, 0x25, 0x2D, 0xB2, 0x34, 0xDF, 0x84, 0xD3, 0x7A, 0x94,
+    0x25, 0xBD, 0xC4, 0x10, 0xFD, 0x8B, 0x21, 0x7E, 0x8C, 0xA0, 0xE2, 0x77, 0xC4, 0x13, 0xF7, 0x11,
+    0x4A, 0x3E, 0x40, 0x26, 0x15, 0x20, 0x5F, 0xD1, 0xE0, 0xBB, 0xEA, 0x51, 0xA4, 0xDA, 0x9D, 0x84,
+    0x9E, 0x52, 0xCF, 0xB9, 0x43, 0xFF, 0x3E, 0x55, 0x16, 0xA6, 0xA0, 0x46, 0x1E, 0xB4, 0xA7, 0xB0,
+    0x7A, 0x66, 0xB9, 0x72, 0x95, 0x9F, 0x42, 0x4B, 0x45, 0x1B, 0x91, 0x16, 0x09, 0x1C, 0x1F, 0x8B,
+    0x2E, 0x54, 0x10, 0x56, 0xE7, 0x54, 0xF9, 0xF8, 0xB8, 0x4D, 0xDC, 0xAE, 0x32, 0xBB, 0x69, 0xD9,
+    0xA6, 0xCB, 0x4D, 0xFA, 0xA9, 0x57, 0x8F, 0x5C, 0x82, 0xF7, 0x10, 0x6B, 0x10, 0x2E, 0x48, 0xB7,
+    0xD3, 0x6B, 0x14, 0xDB, 0xA4, 0x44, 0x75, 0x36, 0x94, 0x59, 0x5D, 0x8A, 0x4E, 0x36, 0x14, 0xA4,
+    0xAB, 0xEA, 0xCC, 0xCA, 0x26, 0xAD, 0x07, 0xF3, 0xA9, 0x0B, 0x16, 0x39, 0x61, 0xE9, 0xDD, 0x2B,
+    0xB2, 0xA3, 0x14, 0xF0, 0xC1, 0xA8, 0x70, 0x5E, 0x34, 0x26, 0x89, 0x2E, 0x19, 0xBE, 0x22, 0x40,
+    0x15, 0x66, 0x01, 0x2C, 0xF4, 0x94, 0x60, 0x61, 0x36, 0x88, 0x5C, 0x87, 0x9C, 0x0F, 0x5F, 0xC4,
+    0x06, 0xC0, 0x23, 0xB4, 0x9E, 0x32, 0x2D, 0x31, 0xAB, 0x3C, 0x84, 0xA5, 0x8C, 0xE0, 0x15, 0xF6,
+    0xE8, 0x92, 0xAF, 0x6A, 0xCD, 0xF8, 0x8A, 0x2C, 0x8D, 0xCB, 0xD5, 0x61, 0xC8, 0x9A, 0x17, 0xF5,
+    0x75, 0x0A, 0x5F, 0xA8, 0xD0, 0xF3, 0xA0, 0x2C, 0x15, 0x1A, 0x34, 0x22, 0x4D, 0x6F, 0xFC, 0x31,
+    0xB6, 0xEE, 0x66, 0x24, 0x11, 0x90, 0xE2, 0xFA, 0x75, 0x0A, 0xE9, 0x7F, 0x5F, 0xFF, 0x01, 0xCD,
+    0x55, 0xBF, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBD, 0x4B, 0x7C, 0x52, 0x4E, 0xCA, 0x52, 0x10, 0x89,
+    0x20, 0xA4, 0x6B, 0xD2, 0xD0, 0x70, 0x3D, 0x85, 0xF7, 0x89, 0x86, 0x82, 0xC6, 0xCD, 0x03, 0x09,
+    0x0A, 0x52, 0xD0, 0x9B, 0x92, 0x26, 0xB9, 0xED, 0x69, 0x4C, 0xC1, 0x7F, 0x40, 0x03, 0x29, 0x42,
+    0x41, 0x41, 0x63, 0xEF, 0x29, 0xFE, 0x03, 0x38, 0x29, 0xA1, 0xA2, 0x79, 0x52, 0x24, 0x0A, 0x28,
+    0xB8, 0xE2, 0x2C, 0x8E, 0xE4, 0xEE, 0x26, 0xDF, 0x37, 0xE7, 0xC4, 0x26, 0x05, 0xAD, 0x59, 0xD9,
+    0xEB, 0xE7, 0x99, 0x9D, 0x99, 0x6F, 0xBE, 0xF9, 0xF1, 0x44, 0x2E, 0x4E, 0x89, 0xDF, 0x6A, 0x23,
+    0x32, 0x89, 0xA4, 0x51, 0x24, 0x44, 0x29, 0x15, 0xD2, 0x5E, 0x24, 0xEF, 0xC5, 0x41, 0x2A, 0x0D,
+    0xA4, 0x78, 0x50, 0xEE, 0xF8, 0x23, 0x72, 0xBC, 0x4A, 0x7D, 0x2B, 0x41, 0x52, 0x07, 0xBB, 0xB2,
+    0x0B, 0xBA, 0xA9, 0xA2, 0x1B, 0xFD, 0xEF, 0x53, 0x36, 0x42, 0x3A, 0xF8, 0x47, 0x3A, 0xF8, 0xF6,
+    0xBA, 0x1B, 0x83, 0x66, 0x83, 0x39, 0x90, 0xFB, 0x88, 0xD2, 0x99, 0x55, 0x41, 0xD7, 0x83, 0x64,
+    0x74, 0x72, 0x22, 0x32, 0x33, 0x7E, 0x2B, 0xCD, 0xB7, 0x07, 0x94, 0x7A, 0x45, 0xF0, 0x05, 0x50,
+    0x14, 0xD1, 0xDA, 0x15, 0xE1, 0x1B, 0xF2, 0xFA, 0xC9, 0xA0, 0x49, 0xED, 0x8A, 0x0C, 0xEF, 0xFD,
+    0x4E, 0xFC, 0xE3, 0xD5, 0xE3, 0x97, 0xF5, 0x1A, 0x0E, 0xD8, 0x3D, 0xC2, 0xED, 0x4D, 0x02, 0x44,
+    0x92, 0x6B, 0x34, 0xE9, 0xFB, 0x33, 0x01, 0x8C, 0x52, 0xEC, 0x00, 0x0B, 0x99, 0x1E, 0xCB, 0x3D,
+    0xF1, 0x83, 0x1C, 0xB6, 0x3E, 0xE6, 0xFA, 0x91, 0xF6, 0xB0, 0x7A, 0xD6, 0x83, 0x85, 0x63, 0xD9,
+    0x0F, 0xEE, 0x40, 0xAA, 0xE8, 0x4F, 0x77, 0xF4, 0x95, 0xF7, 0xF7, 0x84, 0x48, 0x55, 0x11, 0xA2,
+    0x8E, 0x00, 0x69, 0x69, 0xDC, 0xFA, 0xFC, 0xC9, 0xCA, 0xC5, 0xCA, 0x1B, 0x69, 0x84, 0x07, 0x3B,
+    0xD7, 0xD6, 0x3F, 0x8E, 0x56, 0xA1, 0xCB, 0x27, 0xA3, 0x18, 0x52, 0x3F, 0x66, 0xDA, 0xDE, 0xC2,
+    0xBF, 0xB1, 0xE8, 0x81, 0x37, 0x49, 0xDD, 0xC2, 0xE4, 0x04, 0xCC, 0xBE, 0x99, 0x1E, 0x9E, 0xEA,
+    0x54, 0x6B, 0x6C, 0xBA, 0x4B, 0x99, 0xDE, 0xB4, 0xBB, 0xB1, 0xA4, 0x95, 0x2E, 0x72, 0xBB, 0x5D,
+    0x32, 0xF9, 0x5B, 0x17, 0x0F, 0xF7, 0x28, 0x16, 0xB5, 0x8A, 0x4E, 0x66, 0x33, 0xD8, 0x6B, 0x3A,
+    0xAB, 0x13, 0xC0, 0xC9, 0x44, 0x65, 0xF9, 0xD4, 0x2A, 0x6A, 0xE5, 0x1D, 0xEA, 0x8E, 0xD4, 0x37,
+    0xD1, 0x52, 0x83, 0xEE, 0xEC, 0x93, 0x89, 0x84, 0x6A, 0x0F, 0x3B, 0x85, 0x65, 0xF5, 0xEB, 0x16,
+    0x96, 0x0B, 0x22, 0xB3, 0x1F, 0x8A, 0x49, 0x9A, 0x56, 0xEA, 0x7F, 0x2A, 0xED, 0x4A, 0x9D, 0x93,
+    0x6E, 0x82, 0xF6, 0x17, 0xF1, 0x7F, 0x94, 0xB5, 0x27, 0x5E, 0xE2, 0x0C, 0x23, 0xC3, 0x2F, 0x94,
+    0xDE, 0x90, 0xFF, 0x0D, 0xCC, 0x7A, 0x25, 0xD2, 0x3E, 0xF2, 0xCE, 0x47, 0xB6, 0x5F, 0x88, 0x8C,
+    0xF6, 0x9D, 0xC4, 0xAB, 0x87, 0x69, 0xBD, 0x5E, 0x0E, 0x5F, 0xE1, 0x4E, 0xCF, 0xD9, 0x7B, 0x7F,
+    0x93, 0xCD, 0xB2, 0x18, 0x5E, 0x9B, 0x00, 0x77, 0xC4, 0x3B, 0xB4, 0xAF, 0xD2, 0xA9, 0x66, 0x43,
+    0xCC, 0x77, 0xE5, 0x5F, 0x1C, 0xD3, 0x40, 0x65, 0x36, 0x52, 0x59, 0x3D, 0x22, 0xCC, 0xB9, 0x84,
+    0xB2, 0xE8, 0xAB, 0x1D, 0xC7, 0x19, 0xCA, 0x6C, 0xDE, 0x72, 0x76, 0xAC, 0xA7, 0x01, 0x70, 0x90,
+    0xE2, 0x6C, 0x7B, 0xB8, 0x63, 0x23, 0xA7, 0x16, 0xAD, 0xE9, 0x54, 0xAA, 0x5E, 0xCA, 0xE5, 0x43,
+    0x1D, 0x32, 0xD5, 0x43, 0xED, 0x3C, 0x1F, 0xBA, 0xA3, 0x77, 0x49, 0xC1, 0x29, 0x1D, 0x6A, 0x65,
+    0x79, 0x07, 0xEB, 0xF3, 0x4B, 0x43, 0xFA, 0x85, 0xB5, 0x82, 0x91, 0xCE, 0x21, 0x95, 0x62, 0x6D,
+    0x08, 0x02, 0xCC, 0x9E, 0xB3, 0x2D, 0xFC, 0x2F, 0x54, 0x9E, 0x10, 0x60, 0xD1, 0xB3, 0x93, 0xC3,
+    0x07, 0x50, 0xBA, 0xA9, 0x80, 0xD2, 0x77, 0xB4, 0x4C, 0x5B, 0x90, 0x43, 0xDA, 0x8C, 0xC1, 0x59,
+    0xDC, 0xBC, 0xFD, 0x6C, 0xE4, 0x9C, 0xD7, 0x3D, 0x66, 0x06, 0xCC, 0x81, 0xBE, 0x4C, 0xBF, 0x81,
+    0x26, 0xE9, 0x6F, 0x3A, 0xE4, 0x6A, 0x1C, 0x5C, 0xB7, 0xD1, 0x50, 0xC6, 0xAC, 0x1E, 0xF2, 0xF3,
+    0x4F, 0xEF, 0x31, 0x66, 0xF7, 0x33, 0x49, 0xF9, 0x93, 0x62, 0x3F, 0xBF, 0x7A, 0x77, 0xE5, 0x13,
+    0x03, 0xE8, 0xDC, 0x23, 0x00, 0xAC, 0x2B, 0xFC, 0x66, 0x79, 0x30, 0x19, 0x82, 0x5D, 0x6E, 0x05,
+    0x6C, 0x36, 0x1E, 0x10, 0xB3, 0xB3, 0x49, 0xEE, 0x10, 0xD2, 0xD7, 0x66, 0xEB, 0xA6, 0x10, 0xD7,
+    0x51, 0x5B, 0x3E, 0x3D, 0xB2, 0xAA, 0x2A, 0x96, 0x1B, 0xA8, 0x09, 0x2C, 0x0F, 0xC8, 0x31, 0x57,
+    0x85, 0xEA, 0x68, 0x2E, 0x09, 0x0A, 0x5B, 0x69, 0x84, 0xB8, 0x8C, 0xE8, 0x17, 0x6C, 0xA2, 0x7D,
+    0x2E, 0x4A, 0xDF, 0x63, 0x2F, 0xD6, 0x9D, 0x4B, 0x7F, 0x68, 0x57, 0x28, 0x8C, 0x01, 0x21, 0x68,
+    0xD4, 0xD5, 0x6E, 0xEF, 0x7B, 0xB6, 0x15, 0x4C, 0x01, 0x31, 0x96, 0xFA, 0xC3, 0x22, 0x8A, 0x8D,
+    0x09, 0x96, 0x7C, 0x1B, 0x3A, 0xD9, 0xCF, 0x30, 0xD6, 0x07, 0x9E, 0x6C, 0x35, 0xED, 0x79, 0xFF,
+    0x79, 0x06, 0x0F, 0x84, 0xCD, 0x94, 0x72, 0x3D, 0xE7, 0xFA, 0x6E, 0x8D, 0xAF, 0x87, 0x36, 0x2C,
+    0x1F, 0x2F, 0x74, 0xD5, 0xF3, 0x22, 0x28, 0xB0, 0xE8, 0xC8, 0xFE, 0xDB, 0x2F, 0x2B, 0xE0, 0x8E,
+    0x59, 0x28, 0x26, 0x58, 0x43, 0x6E, 0xDD, 0x7E, 0xE3, 0xDF, 0xEB, 0x7E, 0xFD, 0xA2, 0x10, 0x5B,
+    0x8E, 0xA5, 0xAD, 0x95, 0xDA, 0xF6, 0xE4, 0xDD, 0xCB, 0x53, 0xE1, 0xC9, 0x28, 0x2B, 0xD1, 0x4B,
+    0xF5, 0xEC, 0xC1, 0x28, 0xC8, 0xF6, 0xBE, 0x35, 0xF2, 0x86, 0x2D, 0x13, 0xA5, 0x26, 0x40, 0x03,
+    0x9E, 0x93, 0x3D, 0x67, 0xD9, 0x26, 0x12, 0x17, 0x2E, 0x34, 0x13, 0xD6, 0xB4, 0x33, 0xBA, 0x52,
+    0x44, 0x21, 0xB0, 0xBD, 0x07, 0xA9, 0x96, 0x34, 0x91, 0x4C, 0x92, 0xA4, 0xD6, 0xCE, 0xE7, 0xE7,
+    0x1D, 0x39, 0xC7, 0x2C, 0x8D, 0x25, 0xCF, 0x14, 0x12, 0xEB, 0x72, 0x5B, 0xAE, 0x16, 0xD8, 0x7F,
+    0x9E, 0x17, 0xC5, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0x3D, 0xB6, 0xA3, 0x98, 0xE0, 0xC2, 0x69,
+    0x09, 0x28, 0x93, 0x82, 0x82, 0xCE, 0x0D, 0x25, 0xCA, 0x58, 0xA2, 0x4C, 0x01, 0x35, 0x0D, 0x14,
+    0x14, 0x28, 0x4D, 0x52, 0xD2, 0x24, 0xB6, 0x44, 0x99, 0x66, 0x8B, 0x74, 0xB4, 0x69, 0x92, 0x14,
+    0xA1, 0xA4, 0x40, 0xD8, 0x4A, 0x7E, 0x00, 0x46, 0xF9, 0x03, 0x46, 0x40, 0x95, 0xC6, 0x44, 0x96,
+    0x32, 0x59, 0x6C, 0xDF, 0x9C, 0x33, 0xDE, 0xCD, 0xBE, 0x48, 0x34, 0x48, 0xA0, 0x58, 0xFB, 0xAE,
+    0xDE, 0x7A, 0xE6, 0xDE, 0x73, 0xEE, 0xB9, 0x1F, 0x0F, 0xD8, 0x9F, 0x7C, 0x90, 0x59, 0x68, 0x0A,
+    0xEB, 0x69, 0x9E, 0x07, 0xA0, 0x9C, 0x2A, 0x20, 0x1D, 0xD2, 0x1A, 0x67, 0x4F, 0x69, 0x66, 0x7D,
+    0x46, 0x33, 0xC1, 0x1D, 0x3F, 0x0C, 0xC8, 0x16, 0xDC, 0x46, 0x62, 0x70, 0x35, 0x9A, 0x3E, 0x6F,
+    0x51, 0x8D, 0xBA, 0x34, 0xD3, 0x64, 0xDB, 0x17, 0x47, 0x3C, 0x31, 0x06, 0xEA, 0x8C, 0x81, 0xFD,
+    0xD9, 0xC9, 0x82, 0x73, 0xF2, 0x29, 0x5A, 0x74, 0x6D, 0x36, 0xC2, 0x0F, 0xD9, 0x0C, 0xB7, 0x75,
+    0x0B, 0x1A, 0x06, 0x86, 0xA7, 0x11, 0xE4, 0xF9, 0xF6, 0x6B, 0x52, 0x9A, 0x3B, 0x3A, 0xAC, 0x9E,
+    0x9C, 0x7E, 0x2E, 0xC9, 0xF1, 0x1C, 0x0E, 0xD9, 0x80, 0x57, 0x97, 0xE8, 0xC0, 0x78, 0x0F, 0xBA,
+    0x16, 0xBE, 0xCF, 0x47, 0xB8, 0x29, 0x99, 0x95, 0xCB, 0xB7, 0x48, 0xB7, 0x78, 0x49, 0x2E, 0xFE,
+    0xCF, 0xFB, 0x80, 0x33, 0x6B, 0x99, 0x20, 0x33, 0xCC, 0x0E, 0x4E, 0x7A, 0xC6, 0x74, 0x13, 0x7E,
+    0x44, 0x11, 0x70, 0x95, 0x60, 0xF0, 0x75, 0x62, 0xCF, 0xAC, 0xCF, 0x95, 0xA6, 0x72, 0x9D, 0x77,
+    0xB0, 0x0F, 0xF8, 0x59, 0x11, 0x5D, 0x73, 0xC3, 0x1E, 0xFC, 0xAB, 0x03, 0x2A, 0x43, 0x16, 0x79,
+    0xF4, 0x0A, 0x41, 0xF1, 0x40, 0x45, 0x90, 0xF2, 0x62, 0x49, 0x09, 0x3C, 0xB9, 0xDB, 0xAE, 0xB0,
+    0x24, 0x22, 0xB0, 0x2E, 0x11, 0x15, 0x5D, 0x1F, 0x23, 0xB9, 0x95, 0x41, 0x37, 0xE6, 0x32, 0x9F,
+    0x06, 0xA4, 0x47, 0xD5, 0x46, 0xA4, 0x6E, 0x42, 0xCE, 0xDB, 0xEF, 0xE1, 0x7F, 0x03, 0x63, 0xF9,
+    0xD0, 0x0C, 0x8C, 0x47, 0xE1, 0xFE, 0x5A, 0x50, 0xF5, 0xB7, 0x70, 0x19, 0x1F, 0xBD, 0x86, 0xD3,
+    0x45, 0xCF, 0x92, 0x8B, 0x8C, 0x42, 0xB1, 0x82, 0x31, 0x7A, 0xB1, 0xEC, 0x80, 0x2A, 0xAB, 0x38,
+    0x08, 0x42, 0x88, 0x22, 0xA0, 0x0F, 0x39, 0x09, 0x92, 0x65, 0x66, 0xE8, 0x81, 0xF2, 0x87, 0x1D,
+    0x33, 0x6D, 0xBF, 0x41, 0xF9, 0xDB, 0x8A, 0xEA, 0xF7, 0x15, 0xEE, 0x71, 0x40, 0x72, 0x50, 0xD5,
+    0xFF, 0x1A, 0x2B, 0xB9, 0x7E, 0x57, 0x4D, 0xCD, 0x7F, 0x55, 0x4A, 0x56, 0xD8, 0xBE, 0xB7, 0x91,
+    0x11, 0x72, 0x8B, 0x7D, 0x1B, 0x14, 0xC8, 0x7A, 0xAA, 0x42, 0x10, 0xC6, 0x69, 0x06, 0x82, 0x66,
+    0x6B, 0xC5, 0x26, 0x69, 0x1E, 0xF3, 0x3E, 0xDF, 0xB2, 0x67, 0xBA, 0x9E, 0xB0, 0x44, 0xDF, 0x7D,
+    0x26, 0x36, 0x33, 0x1D, 0x4A, 0x3A, 0x8C, 0x85, 0x41, 0x7D, 0x12, 0x9B, 0x65, 0x50, 0x3F, 0x1E,
+    0x9D, 0x55, 0xE9, 0xF3, 0xBD, 0x56, 0xB9, 0x92, 0xEB, 0xFE, 0x56, 0xFF, 0x5F, 0x65, 0x29, 0xC9,
+    0x26, 0x9F, 0xF1, 0x4F, 0x0F, 0xD9, 0x35, 0xD6, 0x7A, 0x22, 0xD8, 0x90, 0x90, 0x64, 0x57, 0xC3,
+    0x2F, 0x70, 0x3D, 0xA7, 0xAE, 0x2D, 0x46, 0xE2, 0x4C, 0x1C, 0x94, 0xD4, 0x56, 0x50, 0x8A, 0x8D,
+    0xFC, 0x98, 0xF8, 0x97, 0x73, 0xD5, 0xC3, 0x3D, 0xD9, 0x78, 0x5C, 0x4C, 0xCD, 0x13, 0x1E, 0x87,
+    0x32, 0xF0, 0x78, 0x4D, 0x4D, 0xC7, 0x94, 0x80, 0xC7, 0x7D, 0x61, 0x3A, 0x06, 0xE5, 0xC8, 0x02,
+    0xAA, 0x05, 0xC9, 0x56, 0xE7, 0xE2, 0xCD, 0x84, 0x5A, 0xC5, 0x73, 0x9A, 0x7E, 0x56, 0xE1, 0xF5,
+    0xF3, 0x6E, 0xDC, 0x09, 0xE2, 0x9A, 0xC4, 0x19, 0xA9, 0x82, 0x5E, 0x74, 0xFA, 0x9A, 0xB4, 0xA7,
+    0x97, 0xCE, 0xDF, 0xA3, 0x69, 0xA4, 0xB1, 0x26, 0x36, 0xB1, 0x63, 0x56, 0xCD, 0x86, 0x62, 0xA3,
+    0x9C, 0xFC, 0xEB, 0x06, 0x54, 0xB3, 0x57, 0xE7, 0xBA, 0x99, 0x51, 0xEE, 0x90, 0x54, 0xF3, 0x94,
+    0x35, 0x75, 0x33, 0x8F, 0x8B, 0x95, 0x27, 0x99, 0x51, 0x41, 0xD8, 0x77, 0xEA, 0xF0, 0x81, 0x2F,
+    0xFD, 0x44, 0x18, 0xCF, 0x89, 0x6B, 0x9B, 0x99, 0x3B, 0x83, 0x81, 0x0B, 0xED, 0x19, 0xDC, 0x88,
+    0x9A, 0x5E, 0x3C, 0x54, 0xEA, 0x26, 0xF6, 0x59, 0xDC, 0xE9, 0xD1, 0x43, 0x63, 0x29, 0x76, 0xF7,
+    0xF0, 0xF6, 0xD9, 0x55, 0xD1, 0x48, 0xBC, 0xCA, 0x64, 0x7E, 0x51, 0x97, 0xB6, 0x6A, 0xE1, 0xFA,
+    0xC2, 0xDB, 0x64, 0x17, 0xEB, 0x5B, 0xCC, 0x9F, 0x68, 0x7D, 0x69, 0xAB, 0xBE, 0x90, 0x76, 0x37,
+    0xFD, 0x1B, 0x0B, 0x15, 0x97, 0x8E, 0x24, 0x2A, 0x5B, 0x99, 0xD3, 0xA2, 0x2D, 0xF1, 0x4C, 0xEB,
+    0xBE, 0xAE, 0x42, 0x66, 0x7C, 0x93, 0xD2, 0x23, 0xC2, 0xB9, 0x99, 0xDB, 0x22, 0xDF, 0x98, 0x64,
+    0x62, 0x9F, 0x9D, 0xB2, 0xAB, 0xC4, 0xAE, 0x5C, 0xC4, 0x6E, 0x23, 0xBB, 0xD4, 0x3E, 0xE5, 0x4B,
+    0x26, 0x33, 0xD2, 0x94, 0x1B, 0x87, 0x32, 0x8D, 0x33, 0xA2, 0xD1, 0x42, 0xD2, 0xC5, 0x72, 0xED,
+    0xD8, 0x97, 0x52, 0x82, 0xBA, 0xA7, 0x1A, 0xF0, 0x49, 0x53, 0x1F, 0xC4, 0xE9, 0xE2, 0x59, 0x3B,
+    0x5E, 0xAF, 0x45, 0x99, 0xD8, 0xA5, 0x12, 0x73, 0xF6, 0xC8, 0x50, 0xAE, 0xE8, 0x46, 0x82, 0x94,
+    0x4B, 0xB1, 0x9E, 0x20, 0x35, 0xBF, 0xF2, 0x86, 0x0B, 0xDC, 0x01, 0xB9, 0x14, 0xDA, 0x89, 0x75,
+    0x22, 0xE6, 0x27, 0x11, 0x0B, 0x7C, 0x59, 0xAC, 0xF4, 0x51, 0x1E, 0x2D, 0xF3, 0xF1, 0x21, 0xB7,
+    0xBA, 0x88, 0xBF, 0x36, 0x54, 0x8C, 0x35, 0xB1, 0x97, 0x27, 0x2A, 0xBD, 0x83, 0x0F, 0x5D, 0x5B,
+    0x5D, 0x0B, 0xD5, 0xD8, 0x3D, 0xE2, 0x84, 0x4F, 0xDA, 0xC0, 0xDA, 0x14, 0x56, 0x3B, 0x9B, 0xDD,
+    0x64, 0xD7, 0xA6, 0x72, 0xFC, 0x01, 0xE3, 0xA1, 0x6E, 0xC9, 0x7D, 0x7C, 0xAC, 0x8A, 0x4E, 0x0B,
+    0x4E, 0x7E, 0x1E, 0x49, 0x93, 0x75, 0x99, 0x89, 0xB5, 0x17, 0x35, 0x95, 0x82, 0x03, 0x7F, 0x3D,
+    0x38, 0xDD, 0xDC, 0x2A, 0xB7, 0xB9, 0x3B, 0x96, 0x24, 0xF8, 0xA1, 0x0C, 0xF9, 0x28, 0xEB, 0xDA,
+    0x86, 0xF6, 0x96, 0x76, 0xCD, 0xF1, 0xCC, 0xC1, 0x2C, 0xB5, 0x04, 0xEA, 0xD2, 0x6A, 0x52, 0x2D,
+    0xE2, 0xB6, 0x61, 0x21, 0x9A, 0x58, 0x58, 0xAA, 0xE8, 0x23, 0xE5, 0x9F, 0xDE, 0xB7, 0x3F, 0x80,
+    0x2B, 0x6F, 0x0E, 0xC7, 0xBF, 0x79, 0x5E, 0x01, 0xCD, 0x55, 0xB1, 0xAE, 0xDD, 0x44, 0x10, 0x9D,
+    0xB5, 0x5F, 0xE2, 0x28, 0x2E, 0x36, 0x05, 0x14, 0x88, 0x62, 0x29, 0x53, 0xC5, 0x3F, 0x10, 0xB1,
+    0x1B, 0x51, 0x52, 0x90, 0x22, 0x1F, 0x40, 0x89, 0x68, 0xC2, 0x1F, 0x78, 0xA9, 0x53, 0xC0, 0x1F,
+    0x40, 0x91, 0x1A, 0xA5, 0xA0, 0x44, 0xB2, 0xC5, 0xFB, 0x00, 0x56, 0xA2, 0xA4, 0xB1, 0x02, 0xA2,
+    0x79, 0x45, 0x56, 0xC2, 0x85, 0x93, 0xAC, 0x3D, 0x9C, 0xB3, 0xF7, 0x25, 0x79, 0xB4, 0x28, 0x88,
+    0xD8, 0xD6, 0x14, 0xF6, 0xEE, 0x9C, 0x33, 0x67, 0xCE, 0xAC, 0x45, 0xEA, 0xD5, 0xD5, 0xB8, 0x33,
+    0xD8, 0x8D, 0x71, 0x5A, 0x6A, 0x0C, 0x8C, 0x9F, 0xCB, 0x95, 0xAB, 0x55, 0xC5, 0xE3, 0x75, 0xF1,
+    0x9A, 0xC6, 0x45, 0xC6, 0xD4, 0x15, 0x69, 0x8B, 0x4C, 0xB3, 0x8C, 0xB1, 0xDF, 0xA4, 0x5F, 0x45,
+    0x83, 0x4C, 0x62, 0x33, 0x1E, 0xA3, 0x22, 0x87, 0x0C, 0x59, 0x5C, 0x6A, 0x0F, 0x69, 0x76, 0xF1,
+    0x49, 0x86, 0xB9, 0xAD, 0x1B, 0xC6, 0x59, 0x7C, 0xC4, 0xDE, 0x3E, 0x23, 0x07, 0x16, 0x76, 0x7A,
+    0x6F, 0x4A, 0xE2, 0x55, 0x01, 0xAF, 0x0A, 0x26, 0x8D, 0x1E, 0xC4, 0xBB, 0x7F, 0x15, 0xFC, 0x2B,
+    0x86, 0x21, 0x22, 0x38, 0xB2, 0xEC, 0x91, 0x1F, 0xEB, 0x48, 0xF2, 0x03, 0x79, 0x57, 0x48, 0x3A,
+    0xD2, 0xE9, 0x28, 0xA5, 0xD1, 0x4C, 0x0D, 0x87, 0x19, 0x9C, 0xE7, 0x9F, 0xB0, 0x78, 0x69, 0xC2,
+    0xFF, 0x4E, 0xF2, 0x8B, 0xEB, 0x90, 0xCF, 0x3D, 0xE5, 0xEB, 0xDD, 0x93, 0xD9, 0x39, 0x95, 0x0C,
+    0x67, 0xEF, 0x8A, 0x7C, 0x2D, 0x25, 0xEA, 0x29, 0x9C, 0x2D, 0x6C, 0x36, 0x85, 0x74, 0x2B, 0xFB,
+    0x7C, 0x55, 0x3B, 0xB1, 0xBA, 0x7A, 0x3D, 0xD7, 0x62, 0x35, 0xF9, 0x2C, 0x13, 0x51, 0x7C, 0x04,
+    0x2D, 0x94, 0x34, 0x2C, 0x6E, 0x06, 0xBA, 0x4D, 0x00, 0xF9, 0x0C, 0x36, 0x1E, 0x2E, 0x32, 0x4B,
+    0x62, 0x4A, 0x5D, 0x5F, 0x59, 0xA7, 0x2D, 0xB5, 0x41, 0xD5, 0xE4, 0xF4, 0x93, 0xA7, 0xDF, 0x2D,
+    0x3F, 0xF7, 0x07, 0x80, 0x3C, 0x57, 0x5A, 0x2D, 0xAF, 0xF1, 0x54, 0x13, 0x72, 0x1C, 0xDC, 0x83,
+    0xE5, 0x2D, 0xD7, 0x38, 0x56, 0x30, 0xE2, 0x5D, 0x73, 0x7C, 0xB8, 0x63, 0x2F, 0xF8, 0xFA, 0xD9,
+    0x51, 0x90, 0x71, 0xEE, 0x4B, 0x73, 0x20, 0xA7, 0xA5, 0x52, 0x1A, 0xDB, 0xFD, 0xE1, 0x86, 0xE5,
+    0x14, 0x4D, 0xBF, 0xC5, 0xE6, 0x4B, 0x12, 0x1D, 0xF3, 0x55, 0x24, 0x5E, 0x5F, 0x56, 0xDF, 0x50,
+    0x1A, 0x19, 0x98, 0x59, 0xA6, 0xAF, 0xB9, 0xF0, 0xC0, 0x2D, 0x4D, 0xE1, 0x6C, 0xB6, 0x9B, 0x01,
+    0xA1, 0x6E, 0x6D, 0x57, 0x2A, 0xD4, 0x83, 0xB1, 0xCD, 0x2E, 0x32, 0x7A, 0x92, 0x5F, 0x6A, 0xDE,
+    0xC4, 0x9A, 0x86, 0x19, 0xBD, 0x02, 0x1B, 0x48, 0x03, 0x59, 0x38, 0xD1, 0x63, 0xA0, 0x25, 0xA7,
+    0x00, 0x5A, 0x32, 0x9D, 0x19, 0x44, 0x75, 0xCC, 0x76, 0xF8, 0x97, 0x9B, 0x98, 0x1D, 0xBD, 0x06,
+    0x88, 0x05, 0x43, 0x08, 0x13, 0x08, 0x85, 0x2C, 0x67, 0x1D, 0xA9, 0xDD, 0xB1, 0x54, 0xCE, 0xEB,
+    0x5C, 0x63, 0xED, 0xCE, 0x1F, 0xFF, 0x9C, 0x48, 0xA2, 0x3B, 0xB0, 0x69, 0xF7, 0x0A, 0x0D, 0x8D,
+    0xB8, 0xE3, 0xC6, 0xE5, 0x8A, 0x07, 0x26, 0x18, 0xFD, 0x0D, 0xB2, 0xE8, 0x66, 0xF4, 0xBB, 0x22,
+    0x8A, 0x7B, 0x0A, 0x3E, 0x42, 0xAB, 0xE4, 0x16, 0x9B, 0xFB, 0xDC, 0x95, 0xB6, 0x40, 0x14, 0x35,
+    0x6C, 0x9F, 0x26, 0x9B, 0x5F, 0xBE, 0xF8, 0x5D, 0x8B, 0x6E, 0x53, 0xF1, 0x9B, 0xDD, 0x40, 0xE2,
+    0xD6, 0x29, 0xD3, 0x47, 0x4C, 0xCF, 0x4A, 0x13, 0x6B, 0x86, 0x12, 0xEC, 0x2B, 0xA1, 0xF2, 0x15,
+    0x63, 0xBC, 0x35, 0xB8, 0x9B, 0xF1, 0x64, 0x08, 0x1E, 0x32, 0xDD, 0x45, 0x92, 0x6E, 0xD9, 0x80,
+    0xE8, 0x44, 0xBE, 0x6F, 0x4E, 0x48, 0xE6, 0xFE, 0x35, 0xF4, 0xEB, 0xE1, 0xDC, 0xA9, 0x2E, 0xDD,
+    0x31, 0x66, 0x64, 0x2D, 0xF0, 0x3F, 0x32, 0x43, 0xED, 0x11, 0x80, 0x03, 0xDC, 0x60, 0xB3, 0xDD,
+    0xDA, 0x02, 0xED, 0x31, 0x51, 0xC1, 0x9F, 0x3F, 0xBB, 0xF8, 0x46, 0xFF, 0xD2, 0xA7, 0x9A, 0x31,
+    0x5B, 0x8B, 0x4B, 0x72, 0xF2, 0xF4, 0xE3, 0x1B, 0xB0, 0xD5, 0xA7, 0xB1, 0x9A, 0xEC, 0x2E, 0x7A,
+    0x76, 0xBD, 0x59, 0xDE, 0x14, 0x74, 0x2D, 0xBC, 0x27, 0x6E, 0x9F, 0xE8, 0x9F, 0xE8, 0x9E, 0xEB,
+    0x8C, 0x8C, 0xB9, 0x5F, 0x5B, 0x64, 0x35, 0xBB, 0x21, 0xD8, 0x04, 0xBF, 0xA1, 0xD5, 0xA8, 0xCD,
+    0xAD, 0xB0, 0x3D, 0xA0, 0xEC, 0xF4, 0x83, 0xD7, 0x5F, 0xF4, 0x11, 0x06, 0x24, 0x6A, 0x1C, 0x83,
+    0x79, 0x9D, 0x6C, 0x1B, 0x02, 0x1A, 0xBF, 0x88, 0x7F, 0x94, 0xA5, 0x8B, 0x8F, 0xFF, 0x23, 0x14,
+    0x57, 0x87, 0x07, 0xD2, 0x7D, 0x82, 0xA1, 0x99, 0x7F, 0x14, 0x59, 0xEF, 0xA2, 0x73, 0xF4, 0xF1,
+    0xFE, 0xB6, 0xBB, 0xF4, 0x40, 0xDE, 0x87, 0x01, 0x8F, 0x5E, 0x03, 0xDA, 0xA0, 0x50, 0xFE, 0x4F,
+    0xFD, 0x15, 0x3B, 0x4D, 0xE9, 0xF3, 0x90, 0x6C, 0xF2, 0x11, 0xAF, 0x9A, 0xD2, 0xA1, 0x8E, 0x81,
+    0xFD, 0x80, 0xD9, 0x01, 0xA5, 0x01, 0x2D, 0xC1, 0x24, 0x62, 0x70, 0x36, 0x79, 0x82, 0xAE, 0x64,
+    0x37, 0xAB, 0x0E, 0x7A, 0x34, 0x9A, 0x71, 0xE4, 0x01, 0x76, 0x84, 0xFF, 0x83, 0x9C, 0x9D, 0x10,
+    0x1A, 0x4D, 0x9D, 0x62, 0xC3, 0x81, 0x5D, 0x0D, 0x67, 0xA6, 0xFE, 0x18, 0x71, 0xD2, 0xC0, 0x84,
+    0x3C, 0x47, 0x54, 0x6E, 0xFB, 0x3C, 0x5A, 0xD5, 0x7B, 0xC8, 0xEC, 0xF0, 0xF5, 0x56, 0xFD, 0x1F,
+    0x0D, 0x8B, 0x70, 0xC2, 0x3E, 0xAE, 0x03, 0x32, 0xBD, 0xF9, 0x45, 0x3D, 0x81, 0x40, 0x11, 0x33,
+    0x77, 0x32, 0x31, 0xCF, 0x60, 0xFC, 0x1B, 0x4C, 0xB8, 0x6C, 0x83, 0xD4, 0x52, 0xA0, 0xFA, 0x30,
+    0x7B, 0x53, 0xEC, 0xE2, 0x23, 0x4B, 0xF9, 0x19, 0x5A, 0x28, 0xC7, 0x8F, 0x27, 0x8F, 0x8F, 0x3D,
+    0x98, 0x64, 0xF0, 0x65, 0x29, 0x1D, 0x0E, 0x24, 0x23, 0xFF, 0xF6, 0xFA, 0x1B, 0xB5, 0x55, 0xBD,
+    0xB2, 0xD6, 0x54, 0x14, 0x5D, 0xC9, 0xE1, 0x33, 0x78, 0x53, 0x1C, 0x0A, 0xB8, 0x85, 0x4D, 0x28,
+    0x6C, 0x9C, 0x41, 0xCE, 0x0B, 0x38, 0x9E, 0x60, 0x6B, 0xC1, 0x57, 0x48, 0xC5, 0x30, 0xE3, 0x1B,
+    0x60, 0x61, 0x79, 0x31, 0x51, 0x1E, 0x40, 0x1F, 0x82, 0x1E, 0x5F, 0x00, 0x13, 0xBF, 0x86, 0xE2,
+    0x16, 0x44, 0x2C, 0x28, 0x2C, 0x08, 0x62, 0x67, 0xE1, 0x81, 0xC9, 0x0C, 0x51, 0x4E, 0xB2, 0x5D,
+    0x3B, 0xF9, 0x3E, 0xB9, 0x0F, 0x70, 0x3D, 0x77, 0xF2, 0xE5, 0xEF, 0x66, 0xED, 0xBD, 0xD7, 0x5E,
+    0x7B, 0x1D, 0x00, 0x25, 0x90, 0xB7, 0x40, 0x05, 0x98, 0x08, 0x38, 0x5E, 0xF2, 0x64, 0x78, 0xBA,
+    0x80, 0x65, 0x25, 0x5B, 0xA0, 0x19, 0x50, 0x48, 0x48, 0x26, 0xD7, 0xDA, 0xB6, 0xC2, 0x6C, 0x46,
+    0x13, 0x5C, 0xEB, 0x76, 0x11, 0xD2, 0xB4, 0x46, 0x06, 0xD8, 0xBF, 0x01, 0x5F, 0xE7, 0x90, 0x24,
+    0xA6, 0x22, 0xBD, 0x91, 0x09, 0x99, 0xD4, 0x0B, 0x36, 0xF0, 0x11, 0x60, 0x03, 0x0C, 0xEF, 0x1F,
+    0x45, 0x14, 0xF7, 0xFB, 0xAC, 0xBF, 0x8E, 0x0F, 0xD7, 0x57, 0xF8, 0x62, 0xC1, 0xAE, 0xA4, 0x2D,
+    0x9E, 0x46, 0x13, 0x8A, 0x96, 0xD0, 0xB6, 0x6D, 0xD2, 0xE8, 0x5A, 0xFF, 0x57, 0x50, 0x64, 0xFF,
+    0x07, 0xCC, 0x88, 0x1F, 0x7D, 0x5B, 0x29, 0xB0, 0xE5, 0x93, 0x6A, 0x04, 0x2E, 0xAD, 0xA9, 0xE1,
+    0x9B, 0xBC, 0x35, 0xB1, 0x29, 0xED, 0xEF, 0x11, 0x1F, 0x9B, 0x1A, 0x87, 0x75, 0x85, 0x25, 0x49,
+    0x99, 0x88, 0x80, 0xB0, 0x88, 0x59, 0xB0, 0xBD, 0xAF, 0x7D, 0x1A, 0x15, 0xD7, 0xBE, 0x8D, 0xF0,
+    0x52, 0x42, 0x7E, 0x58, 0x80, 0x2D, 0x83, 0x3A, 0x99, 0xF9, 0xA8, 0x5B, 0x90, 0x97, 0xA2, 0x4D,
+    0x6D, 0x3B, 0x1B, 0xB2, 0x31, 0x99, 0xF0, 0x29, 0x2E, 0xF2, 0xC1, 0xD6, 0x8D, 0x12, 0x6F, 0x8F,
+    0xD9, 0x90, 0x07, 0x4B, 0x30, 0xD7, 0xF9, 0xD6, 0xD7, 0x55, 0xD9, 0xDC, 0x69, 0xA6, 0x66, 0xAC,
+    0x3A, 0xFD, 0xA8, 0x84, 0xE9, 0xE0, 0x6A, 0x7E, 0x62, 0x7B, 0xFC, 0x84, 0xB4, 0xDB, 0xB3, 0x57,
+    0xA6, 0x52, 0x7B, 0xC1, 0xED, 0x11, 0x45, 0x87, 0x46, 0x39, 0xE6, 0xFB, 0xA6, 0x5C, 0xCF, 0x55,
+    0x99, 0x4E, 0x5F, 0xE7, 0xD2, 0xB9, 0x19, 0x55, 0xB7, 0x54, 0xF5, 0x01, 0x92, 0x19, 0x45, 0xC4,
+    0x34, 0xDA, 0x5D, 0x98, 0xCC, 0x2F, 0xF5, 0x46, 0x51, 0xB6, 0x68, 0x58, 0x7B, 0x7B, 0x3C, 0x23,
+    0x1B, 0xB4, 0x45, 0xA2, 0xB9, 0xBB, 0x6E, 0x3D, 0x2B, 0xEE, 0x9D, 0x54, 0x86, 0x5C, 0xEA, 0x62,
+    0xD8, 0x77, 0xCD, 0x99, 0x17, 0x93, 0x3F, 0x0D, 0xF3, 0x51, 0xDA, 0xAF, 0x79, 0x5C, 0x86, 0x1B,
+    0x8D, 0x84, 0x4D, 0xA3, 0x19, 0xE6, 0x01, 0xBE, 0xC5, 0x8C, 0x7C, 0x58, 0xCF, 0x0A, 0xFA, 0xAC,
+    0x6C, 0xA6, 0x54, 0xFA, 0x6C, 0x42, 0xB2, 0x67, 0x31, 0x09, 0x5F, 0xB1, 0x8B, 0x03, 0x52, 0x52,
+    0x03, 0x76, 0x2F, 0x93, 0x16, 0xF9, 0xF7, 0x3D, 0x92, 0x2C, 0x90, 0xA2, 0x81, 0x14, 0x8F, 0xEC,
+    0x5C, 0x24, 0xCD, 0xD1, 0x4C, 0x59, 0xB4, 0x83, 0x89, 0x45, 0x6F, 0xA2, 0xEB, 0x4C, 0xF4, 0xAD,
+    0x19, 0x7D, 0x9B, 0x0D, 0xBE, 0xB5, 0xC1, 0xB7, 0x45, 0xE7, 0xFB, 0x8A, 0x2C, 0x4B, 0x69, 0x29,
+    0x0C, 0x06, 0xD9, 0xD3, 0xFC, 0x80, 0xD4, 0x56, 0x4F, 0x7B, 0xE8, 0x53, 0x04, 0xA2, 0x6F, 0x0E,
+    0xD9, 0xEA, 0xDA, 0x94, 0x1B, 0x14, 0x73, 0x3E, 0x19, 0x79, 0x29, 0xE1, 0x78, 0xD6, 0x66, 0x8A,
+    0x0D, 0x89, 0xB4, 0x33, 0x5C, 0x28, 0x3A, 0x33, 0xA7, 0x6C, 0x64, 0xCB, 0x28, 0x63, 0x36, 0x92,
+    0x50, 0xAA, 0x80, 0xBD, 0x21, 0x23, 0x72, 0xAD, 0x20, 0x57, 0xBB, 0x09, 0xC2, 0xF0, 0x39, 0x5B,
+    0x7A, 0x10, 0x72, 0xC6, 0xC3, 0xF3, 0x98, 0x81, 0x94, 0x01, 0xF9, 0x39, 0x92, 0x81, 0xF7, 0xF5,
+    0x41, 0xE6, 0x89, 0x44, 0x38, 0xA1, 0x82, 0xEF, 0x0E, 0x45, 0xEF, 0x82, 0xA0, 0x7A, 0x3C, 0x42,
+    0xB4, 0x1E, 0xC6, 0x7E, 0x19, 0xD1, 0xDC, 0x0C, 0x5A, 0x5A, 0xD1, 0xCB, 0x0D, 0x49, 0xE5, 0x21,
+    0xF5, 0x29, 0x6B, 0x35, 0xDB, 0x05, 0xE1, 0x2A, 0x8F, 0x13, 0x1E, 0x7B, 0x6C, 0x92, 0x0A, 0x4B,
+    0xE6, 0xEC, 0xBB, 0x92, 0x54, 0xEE, 0x05, 0xEB, 0x6C, 0x24, 0x68, 0x90, 0x6C, 0xCC, 0x23, 0x65,
+    0x76, 0x86, 0xB5, 0x8C, 0xAC, 0xE5, 0x07, 0xD6, 0x7A, 0xDF, 0x91, 0xB5, 0x7F, 0x84, 0xFC, 0xC4,
+    0x35, 0xCE, 0x65, 0xC5, 0x38, 0x62, 0xBE, 0xD4, 0x6F, 0x2E, 0x94, 0xFF, 0x23, 0x64, 0x81, 0x2C,
+    0x24, 0x01, 0x5F, 0xA6, 0xFF, 0x45, 0xA8, 0x84, 0x2F, 0x05, 0xCD, 0x6F, 0x93, 0x06, 0x20, 0xD0,
+    0x2B, 0xCA, 0xFB, 0x74, 0x80, 0x28, 0xBE, 0xC0, 0xFD, 0xCA, 0xB1, 0x55, 0x75, 0x2B, 0x7C, 0xF3,
+    0x27, 0x6F, 0x34, 0xA3, 0x71, 0x8F, 0xCE, 0x9E, 0x98, 0xE9, 0x3A, 0x43, 0xCE, 0xB0, 0x37, 0x23,
+    0xDE, 0x3B, 0xDB, 0x91, 0xF3, 0xC8, 0x5E, 0xA7, 0x2B, 0xDC, 0x83, 0x65, 0x4E, 0xF6, 0x15, 0x5D,
+    0xA2, 0x7E, 0x70, 0xAE, 0xF8, 0xC9, 0xCA, 0x3D, 0x55, 0xAD, 0x66, 0x76, 0xB4, 0xC0, 0x56, 0x22,
+    0xCF, 0x44, 0xA6, 0x2B, 0xB7, 0x6E, 0x2D, 0x9E, 0x53, 0xD4, 0xCB, 0x3B, 0xFE, 0xCB, 0xD2, 0xFD,
+    0x4D, 0x79, 0x89, 0xCA, 0x7E, 0x1D, 0x18, 0x96, 0xBC, 0x4D, 0x55, 0x40, 0x55, 0x57, 0x74, 0x15,
+    0xC3, 0x9E, 0x77, 0x9E, 0x4D, 0xCF, 0x9E, 0xB3, 0xEB, 0x27, 0xBE, 0xB6, 0x6F, 0x7F, 0x9E, 0xE0,
+    0xA3, 0x6A, 0xAC, 0xAE, 0x6A, 0x13, 0x33, 0x4E, 0xF0, 0xDC, 0x70, 0x16, 0x19, 0xDF, 0x7E, 0xCE,
+    0xF9, 0xB8, 0xBA, 0xF7, 0x34, 0xAE, 0x6B, 0x2A, 0x37, 0x65, 0xAE, 0x29, 0x57, 0x5B, 0xD5, 0x61,
+    0xE7, 0x54, 0xAE, 0xB3, 0xBC, 0xCA, 0x9B, 0x57, 0x05, 0x45, 0x6A, 0xE8, 0x6A, 0xE1, 0x78, 0xD2,
+    0xA9, 0x6F, 0x5D, 0x97, 0x46, 0xB3, 0x57, 0xF5, 0xA0, 0xAA, 0x66, 0xA3, 0x69, 0x50, 0x81, 0x8E,
+    0xAB, 0xD9, 0x34, 0xE1, 0xB3, 0xE8, 0xAA, 0x13, 0x27, 0xA7, 0xB2, 0x93, 0x50, 0x05, 0x3B, 0x72,
+    0xFA, 0xF7, 0xE2, 0x56, 0xEF, 0xC8, 0xA9, 0x8C, 0x44, 0x83, 0xB1, 0x36, 0x9D, 0xF1, 0xC5, 0xC9,
+    0x57, 0xFD, 0x95, 0xFF, 0x47, 0xD0, 0xA3, 0x43, 0x71, 0xCA, 0xBE, 0xE3, 0x06, 0x92, 0xBF, 0x18,
+    0x91, 0x8C, 0x4C, 0xE3, 0xFD, 0x83, 0x43, 0x6F, 0xB1, 0x49, 0x84, 0x5E, 0xEA, 0x67, 0xEE, 0x0D,
+    0x77, 0xBB, 0xA2, 0xE7, 0x06, 0x31, 0xD1, 0xC1, 0xBC, 0x32, 0x1C, 0xE9, 0x7F, 0x55, 0x4D, 0x4B,
+    0xA5, 0x36, 0x13, 0x36, 0xB2, 0xF7, 0xDC, 0x62, 0x72, 0xB9, 0xE0, 0x76, 0x6F, 0xDE, 0xEC, 0x24,
+    0x36, 0xD1, 0x49, 0xC6, 0x79, 0xAE, 0x7D, 0xFD, 0x8E, 0x59, 0xDC, 0xE3, 0x66, 0x65, 0x5F, 0xD3,
+    0xA5, 0xB8, 0x19, 0x21, 0xBF, 0x71, 0xD6, 0x30, 0xCE, 0x97, 0xD1, 0xC5, 0x17, 0x52, 0x65, 0xD1,
+    0xA8, 0x4E, 0xAC, 0x5E, 0x15, 0xDD, 0xDE, 0x43, 0xF0, 0x09, 0xCE, 0xAE, 0x2D, 0xFF, 0xE8, 0x54,
+    0x13, 0xF5, 0x9B, 0xCE, 0x38, 0xD6, 0x6A, 0xD8, 0x7A, 0x1A, 0x4D, 0x75, 0x83, 0x6E, 0xE0, 0xBF,
+    0x55, 0xBD, 0x7D, 0xC7, 0x11, 0xF3, 0xF7, 0x09, 0xE5, 0x1E, 0x13, 0xCA, 0x3D, 0x21, 0x54, 0xF1,
+    0xBC, 0x56, 0xC9, 0x2B, 0xF0, 0xA4, 0x3F, 0x6A, 0x56, 0x45, 0xD8, 0x37, 0x50, 0x77, 0xE4, 0x8B,
+    0x34, 0x6B, 0xB8, 0x87, 0xFC, 0xC8, 0x73, 0x30, 0x40, 0x16, 0x49, 0x72, 0x8F, 0xF3, 0x5B, 0xFF,
+    0x02, 0xBD, 0x54, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0xB0, 0x31, 0xE0, 0xC2, 0x29, 0x22,
+    0x14, 0x24, 0x94, 0x69, 0x28, 0xA0, 0x61, 0xFE, 0x41, 0xC6, 0x54, 0x69, 0xB7, 0xD8, 0x85, 0x12,
+    0x8A, 0xF4, 0xDB, 0xA6, 0xB3, 0x49, 0x0A, 0x0A, 0x8A, 0xD0, 0x50, 0x43, 0x41, 0xC3, 0x22, 0x41,
+    0x4B, 0xB3, 0xB1, 0xC3, 0x16, 0x29, 0x28, 0xD6, 0x4D, 0xAA, 0x14, 0x58, 0x6C, 0xAA, 0xA4, 0x58,
+    0x4B, 0x71, 0x90, 0x43, 0xC6, 0xBE, 0x9C, 0x33, 0xEF, 0x3D, 0x27, 0x94, 0x48, 0x08, 0x3F, 0xC9,
+    0x1F, 0x6F, 0x66, 0xEE, 0xBD, 0xE7, 0x9C, 0x7B, 0xAE, 0xC8, 0x81, 0x88, 0x54, 0x93, 0x88, 0xD1,
+    0x41, 0x64, 0xAF, 0xA9, 0x45, 0xD2, 0x19, 0x7F, 0xE5, 0xF8, 0x12, 0xDF, 0xE2, 0x36, 0x27, 0xA5,
+    0x64, 0x43, 0xD3, 0x89, 0x3B, 0xD3, 0x56, 0x16, 0x55, 0x31, 0x2F, 0x4F, 0x83, 0xD8, 0x50, 0x0C,
+    0x52, 0x75, 0xBE, 0x4D, 0x17, 0x51, 0x29, 0x06, 0x13, 0xB0, 0xDD, 0x76, 0x09, 0xBF, 0xF2, 0x31,
+    0x9B, 0xF0, 0x55, 0xB5, 0xA2, 0x4F, 0x03, 0x22, 0x6B, 0x27, 0xF6, 0x02, 0x39, 0x1A, 0x84, 0xC3,
+    0x3E, 0xC1, 0x76, 0x66, 0x45, 0xAE, 0x5C, 0x7B, 0xBC, 0x60, 0x3D, 0x39, 0x3E, 0x96, 0xF5, 0x2A,
+    0x6E, 0x8F, 0x48, 0xFE, 0x00, 0x27, 0xFC, 0x97, 0x78, 0xBB, 0x96, 0x7E, 0x2D, 0xAF, 0x5D, 0xFB,
+    0xF8, 0xE5, 0xB3, 0x99, 0xC5, 0x2A, 0x72, 0xBF, 0xA3, 0x89, 0x22, 0x72, 0xB9, 0x20, 0xCE, 0xC7,
+    0xA8, 0xDC, 0x7F, 0x81, 0x04, 0xFE, 0x36, 0xCF, 0xDE, 0xC1, 0x59, 0xF7, 0x00, 0xA9, 0xDC, 0x59,
+    0x27, 0x62, 0x7F, 0x47, 0x3E, 0x8B, 0xBD, 0x62, 0x09, 0xD0, 0x4E, 0xBC, 0xAD, 0x28, 0x2B, 0x91,
+    0x37, 0x13, 0xFC, 0xEF, 0x7E, 0x66, 0x6A, 0x00, 0x15, 0xBF, 0x90, 0x86, 0x3E, 0xA6, 0xCC, 0x94,
+    0x47, 0x9C, 0xF2, 0x4C, 0xC3, 0xC5, 0x7F, 0x5C, 0xEF, 0xCA, 0x0E, 0x97, 0x38, 0x06, 0x4C, 0x80,
+    0x07, 0x20, 0xB4, 0xC4, 0xFD, 0x1E, 0xA3, 0x98, 0x67, 0x5C, 0x74, 0x77, 0xB1, 0x98, 0x04, 0x87,
+    0xE3, 0x45, 0xD7, 0x60, 0xB1, 0x02, 0x59, 0x62, 0x46, 0x9E, 0x74, 0x0F, 0x3F, 0xC3, 0xA2, 0x2A,
+    0x62, 0x17, 0xB8, 0x97, 0x52, 0x1D, 0x7E, 0xB2, 0x88, 0x99, 0x24, 0x0F, 0x82, 0x03, 0x76, 0x88,
+    0x20, 0x1F, 0x57, 0x5A, 0x3A, 0xFD, 0x13, 0xC5, 0x70, 0x63, 0xA6, 0x91, 0x5B, 0x89, 0x1F, 0xEB,
+    0x75, 0x90, 0x94, 0x89, 0x3E, 0xC2, 0x7E, 0x9D, 0x12, 0xFD, 0x36, 0x40, 0x0D, 0x05, 0x3B, 0xBE,
+    0xA6, 0x38, 0xB6, 0x2F, 0x86, 0x7C, 0xC8, 0x82, 0x09, 0x06, 0x32, 0x25, 0x5A, 0xFA, 0x56, 0xBB,
+    0x62, 0x78, 0xF9, 0xD7, 0xB9, 0x06, 0x9D, 0x9A, 0xE0, 0xA7, 0x62, 0xCA, 0x46, 0xB9, 0xBC, 0x89,
+    0xC4, 0xF2, 0xC5, 0xCA, 0x07, 0x64, 0xE7, 0x46, 0x47, 0x58, 0x4B, 0x04, 0x17, 0x29, 0x39, 0x78,
+    0x95, 0x31, 0x89, 0xEA, 0x44, 0x16, 0x53, 0x95, 0x1D, 0xBF, 0xA2, 0x23, 0xF9, 0xBB, 0xE0, 0x6E,
+    0xCF, 0xC5, 0x74, 0x8A, 0xDC, 0xFF, 0x4A, 0x2A, 0xE6, 0x1C, 0x8B, 0xD9, 0x60, 0xB1, 0xE8, 0x51,
+    0x04, 0x5A, 0xEE, 0x50, 0xC9, 0x18, 0x10, 0x91, 0x84, 0x51, 0xB2, 0xE7, 0x87, 0x47, 0xBD, 0xF8,
+    0x5A, 0x9A, 0x36, 0x0D, 0xC8, 0x49, 0xA5, 0xF2, 0xE5, 0x86, 0x8E, 0xA9, 0xEA, 0x11, 0x6A, 0xC6,
+    0xC6, 0x84, 0xF9, 0x06, 0x53, 0xCA, 0x92, 0xB7, 0x90, 0xA6, 0x43, 0x72, 0x14, 0xB9, 0xB7, 0x2D,
+    0x6A, 0xAF, 0xBC, 0x82, 0x3A, 0x1A, 0x08, 0xAE, 0xB5, 0x7D, 0xA1, 0x6D, 0x31, 0x00, 0xFA, 0x68,
+    0x26, 0x13, 0x92, 0x39, 0xF6, 0x68, 0x23, 0x55, 0xEB, 0x5B, 0x0F, 0x46, 0x2C, 0x14, 0x28, 0x40,
+    0x69, 0xD1, 0xFC, 0xE4, 0xF5, 0x4C, 0xBF, 0xD2, 0x53, 0xAD, 0xB5, 0xAE, 0xCA, 0x64, 0x13, 0xE9,
+    0x52, 0xE4, 0x21, 0x02, 0xCB, 0xA3, 0xC6, 0x15, 0x81, 0x99, 0xA8, 0xB1, 0xA3, 0x5F, 0x24, 0x70,
+    0x31, 0x3F, 0xE7, 0x62, 0x45, 0xDF, 0x98, 0xD1, 0xB1, 0xDF, 0x5A, 0x36, 0xF8, 0xCC, 0x93, 0xF9,
+    0xF3, 0x4F, 0xD9, 0x94, 0x0A, 0x8B, 0x41, 0x30, 0xBA, 0xE1, 0xE1, 0x21, 0x4E, 0x2E, 0xE4, 0x0B,
+    0x07, 0xB2, 0x80, 0x5A, 0xC4, 0xBD, 0xB0, 0xDA, 0xE5, 0x3A, 0x37, 0x90, 0x85, 0x5E, 0x94, 0x34,
+    0x12, 0x7D, 0x5D, 0x22, 0xCE, 0x68, 0x8B, 0x2E, 0x12, 0x1D, 0x8B, 0xF0, 0xDD, 0x8E, 0xFD, 0xFD,
+    0x3D, 0x74, 0xC2, 0x51, 0x9B, 0xA9, 0xF6, 0xD9, 0x52, 0xC1, 0x87, 0x26, 0xC0, 0xC1, 0x84, 0x58,
+    0x95, 0x15, 0x64, 0x77, 0xAD, 0x05, 0xF6, 0x02, 0xC8, 0x33, 0x14, 0x63, 0x10, 0xFD, 0xF4, 0xE2,
+    0xE9, 0x5D, 0x7D, 0xA6, 0x7F, 0xE8, 0xA0, 0xBD, 0xEF, 0x21, 0x42, 0x99, 0x30, 0x15, 0x73, 0x4C,
+    0xDB, 0x8C, 0xE0, 0x43, 0xD8, 0x9D, 0xAF, 0x5D, 0x19, 0x6F, 0xF7, 0xB6, 0xCE, 0x49, 0xD9, 0x72,
+    0xEE, 0x31, 0xBE, 0x6E, 0xEE, 0xD6, 0x2F, 0xFD, 0xC0, 0xBF, 0x01, 0xAE, 0x01, 0xE5, 0xB9, 0x1E,
+    0xA3, 0x82, 0x3E, 0x1D, 0x41, 0x59, 0xD1, 0xA2, 0xD8, 0xEB, 0xB0, 0xAA, 0xEC, 0x17, 0xA4, 0xAE,
+    0x6A, 0xB7, 0x8D, 0x52, 0x10, 0x89, 0x67, 0x6A, 0x46, 0x33, 0xBA, 0xCD, 0xFB, 0xB9, 0x0B, 0x92,
+    0xB7, 0x7E, 0x81, 0x01, 0x1A, 0x52, 0xD6, 0xB0, 0xC7, 0x39, 0x23, 0x24, 0x29, 0x77, 0x8D, 0x09,
+    0xC9, 0x69, 0xD9, 0x68, 0x1D, 0xBC, 0xE2, 0x61, 0xF0, 0x78, 0x63, 0x47, 0x09, 0xBC, 0x32, 0x42,
+    0x7A, 0xBA, 0xA0, 0x2E, 0x86, 0xF7, 0x38, 0x78, 0xE0, 0x25, 0xA1, 0x2C, 0xBA, 0x39, 0xC5, 0x09,
+    0xE4, 0xDB, 0xB7, 0x45, 0xEF, 0x07, 0xCE, 0x27, 0x1A, 0x3C, 0xD3, 0x7A, 0xDB, 0xF4, 0x9B, 0x28,
+    0xAC, 0xD5, 0x8E, 0xEC, 0x78, 0x8E, 0x90, 0xDF, 0x06, 0x49, 0x03, 0xD2, 0xE6, 0xE5, 0x5B, 0xFF,
+    0x37, 0xE0, 0x0F, 0x63, 0xB9, 0x06, 0xE5, 0x9D, 0x60, 0xEE, 0xDE, 0xE9, 0xB3, 0xFE, 0x23, 0x79,
+    0x7F, 0x5B, 0xE9, 0x41, 0x84, 0x5A, 0x69, 0x6B, 0x95, 0x0A, 0x13, 0x69, 0xD1, 0xC7, 0x11, 0x0E,
+    0x5B, 0x11, 0xE8, 0xE6, 0xF1, 0x9D, 0x1F, 0x2A, 0xE2, 0xB4, 0xF0, 0x16, 0xA7, 0xFD, 0xE5, 0x15,
+    0xA6, 0xA1, 0xEC, 0x24, 0x26, 0xB6, 0x78, 0xCA, 0x7A, 0x93, 0x95, 0x82, 0xE3, 0x92, 0xF3, 0x6E,
+    0x84, 0xBD, 0x00, 0x4D, 0x9F, 0x34, 0xB5, 0x9F, 0xE4, 0x04, 0x50, 0xCC, 0x00, 0x60, 0x45, 0x8D,
+    0x1E, 0xBE, 0x62, 0xE6, 0xDD, 0x1C, 0x6D, 0x56, 0x4C, 0xEC, 0x22, 0x3F, 0xAC, 0x30, 0x4B, 0xB9,
+    0x9A, 0x2B, 0x7A, 0xB8, 0xD0, 0x6F, 0x9A, 0xDA, 0xD1, 0xE4, 0x8E, 0x23, 0xCB, 0xC6, 0x09, 0xB1,
+    0xCF, 0x44, 0x98, 0x31, 0xF0, 0xBA, 0xEB, 0x85, 0x73, 0xE1, 0xFB, 0x35, 0x3D, 0xE6, 0xBC, 0x96,
+    0x90, 0x11, 0xD8, 0xA0, 0x22, 0x9C, 0x02, 0x11, 0x09, 0x4D, 0x23, 0x2C, 0x72, 0x02, 0x64, 0x50,
+    0xD0, 0xEB, 0x4C, 0x01, 0x09, 0x6C, 0xD5, 0xEF, 0x96, 0xFC, 0x22, 0x72, 0x62, 0x38, 0xCD, 0x6D,
+    0xC7, 0xD9, 0xBD, 0xF3, 0xEF, 0xC6, 0x4B, 0x3B, 0x01, 0x23, 0xBC, 0x1C, 0xC3, 0x52, 0xDC, 0xF2,
+    0xE3, 0x14, 0x15, 0x8C, 0xF8, 0x00, 0xCB, 0xF4, 0xF9, 0x04, 0x05, 0xA2, 0x84, 0x11, 0x60, 0x1C,
+    0xEE, 0x11, 0x57, 0xD4, 0xD0, 0xBF, 0xFA, 0x1C, 0x25, 0xA9, 0xA3, 0x88, 0x11, 0x22, 0xC2, 0x29,
+    0x3B, 0x23, 0x6C, 0x55, 0xDC, 0x60, 0x64, 0x4D, 0xA6, 0x4F, 0x07, 0x2F, 0xD9, 0xF9, 0x80, 0x59,
+    0xB7, 0x69, 0x2E, 0x57, 0xAE, 0x62, 0xFC, 0x37, 0x6D, 0xFB, 0xEF, 0xAE, 0xBF, 0x01, 0xC5, 0x55,
+    0x21, 0x93, 0xDC, 0x36, 0x18, 0x7D, 0xB6, 0xD2, 0x31, 0x30, 0xD0, 0x81, 0x1E, 0xAD, 0x48, 0x41,
+    0x50, 0xFC, 0x07, 0x32, 0x27, 0xB3, 0xC2, 0x06, 0x14, 0xB5, 0xA4, 0xB4, 0x21, 0xA1, 0x21, 0xA9,
+    0xFD, 0x13, 0x02, 0x32, 0x25, 0x01, 0x25, 0x21, 0xB9, 0x80, 0x14, 0x86, 0xA4, 0xD6, 0x84, 0x14,
+    0x76, 0xA7, 0xFD, 0x01, 0xF5, 0x4C, 0x83, 0x4A, 0x2A, 0xB0, 0xC0, 0x77, 0x91, 0xAD, 0xBE, 0xA7,
+    0xBD, 0xED, 0xDD, 0x94, 0x25, 0xD3, 0x69, 0x35, 0xBB, 0x1A, 0xAF, 0x25, 0x7D, 0x7A, 0xEF, 0x7B,
+    0xEF, 0xFB, 0x16, 0x28, 0xA3, 0x0E, 0xCD, 0x0E, 0xF0, 0x75, 0xE2, 0xE3, 0xF2, 0x23, 0x5F, 0xD8,
+    0x3C, 0x72, 0xF6, 0xB3, 0x16, 0x17, 0x5C, 0x8D, 0xEA, 0xFE, 0x13, 0xA0, 0xCD, 0x79, 0x81, 0xC9,
+    0x9A, 0xCF, 0xF2, 0xD3, 0x3C, 0xC3, 0xC6, 0x26, 0xA3, 0xCA, 0x70, 0x0B, 0x5C, 0x44, 0x0E, 0xF5,
+    0x86, 0x26, 0xC1, 0xEF, 0x30, 0xEC, 0x4C, 0x82, 0x59, 0x31, 0x04, 0x7E, 0xDA, 0xA4, 0xB7, 0xD3,
+    0x88, 0x29, 0xD8, 0x3D, 0xEC, 0x82, 0xC3, 0x99, 0xC8, 0x3B, 0x78, 0xC0, 0xF2, 0xC0, 0xDC, 0x66,
+    0x34, 0x8C, 0x1B, 0x34, 0xED, 0xC0, 0xE9, 0x31, 0xFE, 0x1E, 0x1F, 0x55, 0x3D, 0x30, 0x2C, 0x67,
+    0x42, 0xF6, 0x13, 0x51, 0x7D, 0xB5, 0xBC, 0xE6, 0xDB, 0xE1, 0xF3, 0x40, 0x40, 0x71, 0xCF, 0xC7,
+    0x6C, 0x81, 0x53, 0x3B, 0xF7, 0x70, 0xDB, 0x0A, 0xC5, 0x09, 0x8C, 0xFF, 0x3D, 0xF9, 0xF8, 0xE0,
+    0x47, 0xB4, 0x7B, 0xC3, 0x4D, 0x19, 0x03, 0xE0, 0x66, 0x1B, 0x51, 0x27, 0x5E, 0xAE, 0xA5, 0x19,
+    0x26, 0x35, 0xAB, 0x1E, 0x79, 0xA5, 0x49, 0x67, 0xDB, 0x2B, 0xF8, 0xFC, 0x73, 0x1E, 0xEB, 0x1C,
+    0x45, 0x6D, 0x69, 0x78, 0xEC, 0xD6, 0x07, 0x92, 0x5F, 0x49, 0xBE, 0x23, 0x90, 0xE1, 0x0D, 0xF7,
+    0xF3, 0x6D, 0xFE, 0x60, 0xF2, 0xFC, 0xBA, 0x4D, 0x24, 0xC9, 0xA7, 0x7A, 0x20, 0x51, 0x86, 0x9E,
+    0x11, 0x78, 0x3F, 0xB7, 0x4B, 0xA7, 0x11, 0xCD, 0x05, 0x59, 0xE4, 0x1C, 0x61, 0x37, 0x52, 0xCF,
+    0x3D, 0x71, 0x2C, 0xE4, 0xEC, 0x83, 0x0B, 0xD5, 0xC6, 0xFB, 0xDA, 0xBD, 0x70, 0x89, 0x70, 0xAE,
+    0x72, 0x6F, 0x92, 0x5D, 0x89, 0xFD, 0xDD, 0xE5, 0x5C, 0xD8, 0x4E, 0xC9, 0x13, 0xD3, 0xC8, 0xA0,
+    0x27, 0xE5, 0x42, 0x4B, 0x7E, 0x87, 0xD0, 0xBC, 0xA4, 0xC7, 0x3F, 0x86, 0xF8, 0x47, 0x41, 0xA4,
+    0xA4, 0xDB, 0xF9, 0xA6, 0xBC, 0xBA, 0x91, 0x12, 0xD3, 0x42, 0x2E, 0x56, 0x33, 0x5A, 0x19, 0x86,
+    0xEC, 0x05, 0xF8, 0xBB, 0x67, 0xC4, 0x9A, 0xB9, 0xA7, 0x53, 0x34, 0x7B, 0x63, 0x05, 0x15, 0x57,
+    0x42, 0x3D, 0xA3, 0x9B, 0xE9, 0x30, 0xA6, 0x65, 0xE5, 0x8D, 0x2F, 0x19, 0x4A, 0x59, 0xB0, 0x25,
+    0x0B, 0x3C, 0x44, 0xB8, 0x39, 0x18, 0x05, 0x38, 0x7A, 0xF0, 0x1E, 0x30, 0xED, 0xB9, 0x2B, 0x56,
+    0x6B, 0x17, 0x6C, 0x18, 0xB0, 0x99, 0xC5, 0xC4, 0x2E, 0x74, 0x6F, 0x98, 0xE1, 0x89, 0x7B, 0x99,
+    0xE0, 0x0B, 0xA5, 0xA4, 0x25, 0xD3, 0x54, 0x33, 0x49, 0x26, 0x2B, 0x34, 0xFD, 0x5C, 0x98, 0x54,
+    0xD2, 0xD3, 0xEC, 0x5A, 0x3E, 0xAE, 0x84, 0x4D, 0xB9, 0x83, 0x28, 0x8D, 0x57, 0x79, 0xBE, 0x1E,
+    0x9E, 0x18, 0x20, 0x20, 0xB4, 0xEF, 0x1F, 0x2F, 0x25, 0x75, 0xB5, 0x48, 0xDC, 0x47, 0xD2, 0xEE,
+    0x13, 0xC8, 0xCB, 0x90, 0xD2, 0xA4, 0x75, 0x71, 0xBF, 0x57, 0xBA, 0x66, 0xD4, 0xCA, 0x0C, 0xF2,
+    0xF5, 0x4A, 0x64, 0x46, 0x79, 0xE6, 0x0E, 0xA4, 0xF3, 0x48, 0x5D, 0x2C, 0xAD, 0x71, 0x49, 0xF0,
+    0x25, 0x7D, 0x9C, 0x56, 0xF9, 0xEB, 0x04, 0xAF, 0xAA, 0x60, 0x96, 0x07, 0xF4, 0x57, 0xE4, 0x97,
+    0x20, 0xAF, 0x92, 0x7E, 0x2A, 0xCB, 0xF5, 0xDC, 0x0C, 0xF7, 0x4B, 0x42, 0x6A, 0xA2, 0x9D, 0xFD,
+    0xC8, 0x32, 0xAD, 0x13, 0xB9, 0xBF, 0xA3, 0xA0, 0x54, 0x87, 0x4E, 0x31, 0x0B, 0x7E, 0xB0, 0xD1,
+    0x85, 0x8E, 0x89, 0xF2, 0x4C, 0xDC, 0xB0, 0x1C, 0x5D, 0x7B, 0x90, 0x93, 0x0C, 0x69, 0x00, 0xE5,
+    0x3E, 0xE9, 0x77, 0x11, 0xE0, 0xD6, 0xFF, 0x43, 0x16, 0xB7, 0xB9, 0x71, 0xD6, 0x0E, 0x74, 0x3C,
+    0xF4, 0xEC, 0xDA, 0xE4, 0xBD, 0xA8, 0x36, 0x39, 0x49, 0x57, 0x5F, 0x25, 0x31, 0x4D, 0x6D, 0xA4,
+    0xAC, 0x66, 0xCB, 0x22, 0x6A, 0xB6, 0x5E, 0xAA, 0xB2, 0x5E, 0xA3, 0x78, 0x66, 0x6D, 0x1E, 0xE5,
+    0xA2, 0x2B, 0x92, 0xB9, 0x38, 0x45, 0x98, 0xDC, 0xE5, 0x8B, 0x45, 0x54, 0xBF, 0x2D, 0x55, 0xD6,
+    0xCB, 0x9A, 0xA3, 0x6C, 0x06, 0xD9, 0x8C, 0x49, 0xD8, 0xBE, 0x7C, 0x2C, 0x63, 0x33, 0x49, 0x93,
+    0x2A, 0xCA, 0x5F, 0xAF, 0x24, 0xA6, 0x85, 0x67, 0x5A, 0x56, 0xEA, 0x68, 0x66, 0xD2, 0x62, 0x09,
+    0xB9, 0x6D, 0x4A, 0xF4, 0x70, 0xCE, 0x25, 0x49, 0x12, 0xC6, 0x95, 0xA9, 0x5C, 0x2A, 0xF2, 0x4D,
+    0x2C, 0x86, 0xD6, 0xEC, 0xE2, 0x11, 0xCE, 0x17, 0xC5, 0xA6, 0x43, 0x0E, 0x14, 0xCE, 0x50, 0x1A,
+    0xBA, 0xD4, 0x86, 0x49, 0xBA, 0xF9, 0x3F, 0xA3, 0x4C, 0xEA, 0xDF, 0x16, 0xD9, 0x7C, 0x18, 0xE4,
+    0x51, 0x55, 0xDC, 0xB0, 0x96, 0xD0, 0x2C, 0x09, 0xDC, 0x65, 0x54, 0x66, 0x67, 0x60, 0xA7, 0x5A,
+    0x6F, 0xCA, 0xD4, 0xF4, 0x84, 0x56, 0xEF, 0x9D, 0xD6, 0x9C, 0x7A, 0x9F, 0xCC, 0xCB, 0xAE, 0x22,
+    0x7D, 0xC3, 0xCD, 0x8D, 0xFF, 0x61, 0x36, 0x38, 0x1E, 0x9A, 0xB9, 0x8E, 0x1E, 0xCD, 0xEF, 0x6C,
+    0x3F, 0x74, 0xAF, 0xE3, 0xE9, 0x8E, 0x4B, 0x27, 0xFF, 0x52, 0xC9, 0x1E, 0xC6, 0x9D, 0x92, 0xE5,
+    0x51, 0xC5, 0x4A, 0x88, 0xF6, 0xD7, 0xA8, 0x2E, 0x48, 0xD4, 0x0F, 0xF1, 0xF5, 0xD1, 0x42, 0xCF,
+    0x7B, 0x91, 0x58, 0xD4, 0xA6, 0x37, 0x74, 0xDB, 0x8B, 0x15, 0x2C, 0x06, 0x06, 0x04, 0x92, 0xBA,
+    0xCE, 0x9E, 0x7F, 0x42, 0xE8, 0x0B, 0xB7, 0x22, 0x94, 0x3F, 0x4C, 0xD5, 0xF9, 0x39, 0xFB, 0x70,
+    0xDE, 0xF8, 0xC4, 0x46, 0x48, 0x0A, 0x7B, 0x4F, 0x40, 0xD1, 0x25, 0x4E, 0x36, 0xF7, 0x6E, 0x2E,
+    0x3D, 0xB9, 0x2A, 0xC5, 0xD1, 0x65, 0x02, 0xC5, 0xC7, 0xE5, 0xBA, 0x6F, 0x0E, 0x7D, 0x4C, 0x80,
+    0x78, 0xAF, 0xFD, 0x8D, 0x02, 0x74, 0x9F, 0x51, 0x99, 0xD7, 0x86, 0xD3, 0xA7, 0xC7, 0x12, 0xC6,
+    0x29, 0x1F, 0x6A, 0x15, 0x80, 0xD5, 0xE4, 0x77, 0xDB, 0x3D, 0xE2, 0x9E, 0x08, 0x14, 0x65, 0x62,
+    0x80, 0x49, 0x22, 0xFB, 0xA7, 0xE4, 0xE2, 0xD4, 0xF5, 0xF4, 0x7F, 0x84, 0x4E, 0x72, 0x0E, 0xA5,
+    0xB6, 0xF8, 0xBE, 0x9A, 0x48, 0xDC, 0x5E, 0x32, 0x51, 0xC3, 0xD8, 0x31, 0x69, 0x6A, 0xA2, 0x59,
+    0xDE, 0xC8, 0x63, 0x53, 0xE4, 0x88, 0xEA, 0x9B, 0xAC, 0x86, 0xE9, 0x2D, 0xDE, 0x6B, 0xFC, 0x05,
+    0xC5, 0x54, 0x3D, 0x6F, 0xD5, 0x40, 0x10, 0x9C, 0xB3, 0x93, 0x38, 0x92, 0x85, 0x2E, 0x45, 0x02,
+    0x14, 0x08, 0xB7, 0x14, 0x08, 0x37, 0x94, 0x89, 0xCE, 0x52, 0x24, 0x5A, 0x5E, 0x01, 0xA2, 0x88,
+    0x10, 0x3F, 0x01, 0x0A, 0x6A, 0xEC, 0x8E, 0x12, 0x89, 0x96, 0x26, 0x94, 0x84, 0x22, 0x7F, 0x00,
+    0xE9, 0xDE, 0x4F, 0x30, 0x15, 0x25, 0x46, 0xA2, 0xA2, 0xC1, 0x85, 0x0B, 0x27, 0x3A, 0x7B, 0x99,
+    0xB5, 0x5F, 0xF8, 0xAA, 0x10, 0x52, 0x92, 0x93, 0xDF, 0xDA, 0xEF, 0xEC, 0x9B, 0x9B, 0x9D, 0xDD,
+    0x39, 0x60, 0x1D, 0x1C, 0x19, 0xEE, 0x02, 0xF9, 0xEB, 0x96, 0x4F, 0x52, 0x03, 0xA9, 0x14, 0x9C,
+    0x7C, 0x80, 0xD5, 0x58, 0x7F, 0xC7, 0xBF, 0x5E, 0x7A, 0xCE, 0xCB, 0x88, 0x7C, 0x7C, 0x3F, 0x80,
+    0x5F, 0x85, 0x48, 0x80, 0x10, 0x0F, 0x40, 0x97, 0x06, 0xA0, 0xB0, 0x9D, 0x02, 0x11, 0x02, 0x6E,
+    0x0E, 0xE6, 0xE8, 0xC8, 0x35, 0x91, 0x8C, 0x7C, 0xF2, 0x81, 0x73, 0xB6, 0x73, 0x1D, 0x6C, 0x9B,
+    0x05, 0x06, 0x2B, 0x45, 0xD6, 0x24, 0x22, 0x52, 0x1B, 0x86, 0x25, 0x72, 0x39, 0xE1, 0x9A, 0x6D,
+    0xDD, 0x6D, 0x13, 0x5B, 0xC0, 0x1E, 0x9E, 0x11, 0xE2, 0x5E, 0xC3, 0xC0, 0xB7, 0xB0, 0xA3, 0xBE,
+    0x59, 0x9C, 0x11, 0xDA, 0x21, 0x9F, 0x48, 0x84, 0x40, 0x1A, 0x5C, 0x3D, 0x2E, 0x50, 0x16, 0x9E,
+    0x1C, 0x31, 0x05, 0xF2, 0xF2, 0x11, 0x79, 0xB9, 0x37, 0xFD, 0x2A, 0xA1, 0x84, 0xFF, 0x90, 0x13,
+    0x08, 0x65, 0xA5, 0xDC, 0x38, 0x6F, 0xBC, 0x54, 0xB0, 0xA7, 0xD2, 0x71, 0x2A, 0x0F, 0x5C, 0xC3,
+    0x4C, 0x04, 0x5C, 0x26, 0x55, 0x12, 0x50, 0x8A, 0xB4, 0x5C, 0xCA, 0x4F, 0x8C, 0xFF, 0x3A, 0xED,
+    0xB9, 0xA6, 0xE1, 0x85, 0x06, 0xC2, 0xC3, 0x28, 0x21, 0x13, 0xF0, 0xFB, 0xB8, 0x58, 0x99, 0x70,
+    0x4B, 0x83, 0xE6, 0xA5, 0xA9, 0x22, 0x56, 0x2E, 0xA6, 0xF9, 0x83, 0xD0, 0x25, 0xC8, 0x74, 0xB1,
+    0x1A, 0x4C, 0x12, 0x8C, 0x3F, 0x83, 0xB2, 0x87, 0xEA, 0x90, 0x28, 0xEA, 0x46, 0x31, 0x89, 0xB0,
+    0xA1, 0x61, 0x4F, 0x43, 0xAF, 0x0A, 0xE9, 0x9B, 0xF8, 0x57, 0x50, 0x22, 0x51, 0x7B, 0x99, 0x7D,
+    0xB5, 0x1A, 0xF1, 0x5C, 0x3A, 0x37, 0xDD, 0x62, 0xC5, 0x26, 0xE6, 0x13, 0x45, 0x4E, 0xBA, 0x4C,
+    0x33, 0xB9, 0x89, 0xEB, 0xF8, 0x6B, 0x50, 0x0D, 0x5E, 0xB1, 0x48, 0x4C, 0xAD, 0x8D, 0x54, 0xBC,
+    0x74, 0x37, 0x6D, 0x05, 0x8A, 0xAB, 0xFA, 0x96, 0x4B, 0xF8, 0x0A, 0xD1, 0x88, 0x98, 0x02, 0x51,
+    0x75, 0x15, 0xDE, 0x7D, 0x3B, 0xF2, 0x4B, 0xA8, 0x96, 0xA2, 0x4E, 0x17, 0x16, 0x4B, 0xB7, 0x75,
+    0xDC, 0x92, 0xB6, 0xE7, 0xC5, 0xF5, 0xC9, 0x0C, 0x91, 0x13, 0xC2, 0x4F, 0x10, 0x5C, 0xAF, 0xE5,
+    0xCB, 0x4E, 0x90, 0x9F, 0x20, 0x91, 0x31, 0x95, 0x81, 0xCE, 0xEC, 0x1C, 0xB3, 0x81, 0x39, 0x84,
+    0x6E, 0x41, 0xE5, 0x6A, 0xE6, 0x19, 0x10, 0xF5, 0x24, 0xDC, 0x45, 0xCB, 0x99, 0x24, 0x0B, 0x95,
+    0xB0, 0x6A, 0xB1, 0x7E, 0x79, 0x10, 0x56, 0xCE, 0xF1, 0xCC, 0xC8, 0xA9, 0xAF, 0x9B, 0x1D, 0xE6,
+    0x57, 0x36, 0x51, 0xF0, 0x01, 0xDE, 0x4B, 0xE1, 0x86, 0x7C, 0x69, 0x07, 0xDB, 0x26, 0x63, 0xDC,
+    0x47, 0x62, 0xA8, 0x1A, 0xF5, 0x77, 0x4B, 0xB7, 0xCC, 0x1A, 0xDB, 0xA4, 0x5D, 0xD2, 0xC5, 0x43,
+    0x34, 0x3C, 0x17, 0xC8, 0xC0, 0xC9, 0x31, 0xAB, 0xA7, 0x02, 0x6C, 0xFD, 0x83, 0x22, 0xD1, 0xF1,
+    0xE9, 0xD1, 0xF1, 0x69, 0x91, 0x69, 0xDA, 0x23, 0xAE, 0xC9, 0xC3, 0x47, 0x2C, 0xEE, 0x79, 0x29,
+    0xC2, 0x33, 0xD5, 0xE8, 0x9D, 0x4D, 0x84, 0xAB, 0x32, 0x77, 0x07, 0x71, 0x8B, 0x48, 0xFB, 0x37,
+    0xD6, 0x26, 0x19, 0xD2, 0x0E, 0x3E, 0x13, 0xB8, 0xCF, 0x52, 0xDB, 0xEF, 0xAF, 0xDA, 0x58, 0xF6,
+    0x03, 0xC9, 0x0A, 0xC1, 0xCB, 0xCA, 0x35, 0x14, 0xA1, 0xA5, 0x08, 0x81, 0x22, 0x0C, 0x2A, 0x02,
+    0xFC, 0x63, 0xE6, 0x2B, 0xF7, 0x69, 0x86, 0x97, 0x9D, 0xD1, 0xD3, 0x79, 0x6D, 0x3E, 0x0F, 0x93,
+    0xFE, 0x36, 0x9B, 0x35, 0x20, 0x7B, 0x1A, 0x70, 0x25, 0xFD, 0xD3, 0xFE, 0x64, 0x03, 0xA5, 0x93,
+    0x90, 0x81, 0x52, 0xD5, 0xBE, 0xD0, 0x34, 0xD4, 0x82, 0xB6, 0x9F, 0xFA, 0x81, 0xF6, 0x9A, 0x8D,
+    0x98, 0xEB, 0x49, 0x5B, 0xCF, 0x3F, 0x36, 0x8D, 0xE6, 0xA8, 0x49, 0x1A, 0x96, 0x34, 0xA3, 0x1C,
+    0x0A, 0x65, 0x0E, 0xB7, 0x6D, 0xD8, 0xCD, 0x24, 0xDC, 0xC9, 0xBB, 0xCD, 0xB4, 0x5A, 0x6D, 0xB2,
+    0x40, 0xDE, 0x6B, 0x9E, 0x07, 0x3D, 0x0B, 0x89, 0xB4, 0x55, 0x44, 0xDB, 0x20, 0xAF, 0xB5, 0xBE,
+    0xAE, 0xA2, 0x7F, 0xC8, 0x1D, 0x7E, 0x80, 0xEF, 0x51, 0xD6, 0x13, 0xED, 0x74, 0x32, 0x98, 0xFE,
+    0xFA, 0xF3, 0xE4, 0x6B, 0xA5, 0x2B, 0xE5, 0x8B, 0x96, 0x54, 0x87, 0xA1, 0xF8, 0x95, 0x13, 0xE5,
+    0x99, 0xD5, 0xF4, 0x32, 0xC1, 0x49, 0xD3, 0x17, 0xF3, 0xBD, 0x2C, 0xD8, 0x55, 0xA9, 0xD4, 0xF9,
+    0xA8, 0x24, 0xB5, 0x9F, 0x0C, 0xA9, 0xDA, 0xEA, 0x06, 0xEC, 0xC7, 0x0F, 0x44, 0x6A, 0xD9, 0xDC,
+    0xCB, 0xB3, 0x83, 0xF7, 0x5C, 0xC4, 0xC5, 0xDA, 0x2E, 0xDE, 0x0E, 0xD9, 0xBE, 0x84, 0x84, 0x3D,
+    0xBB, 0x98, 0x9D, 0x93, 0xF7, 0xB4, 0xCD, 0xBA, 0xAF, 0xD8, 0x02, 0x54, 0x96, 0x82, 0x8E, 0x60,
+    0xDF, 0x4C, 0x77, 0x8A, 0x9D, 0x7F, 0x2A, 0xFC, 0x10, 0x49, 0x43, 0x0F, 0x18, 0xFC, 0xE7, 0xF8,
+    0x01, 0xBD, 0x55, 0xB1, 0xAE, 0xDD, 0x44, 0x10, 0x9D, 0xB5, 0x73, 0x31, 0x8A, 0x85, 0x96, 0x22,
+    0x8A, 0x14, 0x51, 0xB8, 0x49, 0x43, 0x13, 0xFF, 0x40, 0xC8, 0x2E, 0x5F, 0xC0, 0x2D, 0x28, 0x90,
+    0x9E, 0x42, 0x45, 0x89, 0x44, 0x43, 0xF9, 0x84, 0x2D, 0xE5, 0x07, 0xDE, 0x27, 0xA4, 0xA0, 0xA1,
+    0x82, 0x96, 0x22, 0xCF, 0x8E, 0x28, 0x68, 0xDD, 0xA5, 0xA0, 0xD9, 0x22, 0x82, 0x82, 0x22, 0x26,
+    0x31, 0xD2, 0x4A, 0x59, 0x7B, 0x38, 0x33, 0xEB, 0xFB, 0xDE, 0xFD, 0x02, 0xAC, 0x27, 0x3F, 0xDF,
+    0xBD, 0x73, 0x67, 0xCE, 0x9C, 0x73, 0x66, 0x4C, 0x84, 0x8B, 0x79, 0x2A, 0x99, 0xC9, 0xF0, 0x48,
+    0xE5, 0x4A, 0x64, 0x67, 0xA2, 0x6E, 0xA4, 0x82, 0xF1, 0x18, 0x89, 0xDC, 0x84, 0x08, 0xA2, 0x2A,
+    0x11, 0xB5, 0x01, 0x8F, 0x5E, 0x83, 0x1A, 0x04, 0x0D, 0x08, 0xDA, 0xF0, 0xB8, 0x52, 0xC5, 0x1B,
+    0x39, 0x5E, 0xF0, 0xEC, 0xC9, 0xE0, 0x1B, 0xDB, 0x23, 0x85, 0x64, 0x9E, 0x91, 0x95, 0xF6, 0xCB,
+    0x8E, 0x76, 0xA9, 0x56, 0xE4, 0x7A, 0x80, 0x0F, 0xC6, 0xB7, 0xD1, 0xF1, 0x61, 0xE8, 0x9B, 0xA9,
+    0x9E, 0xCB, 0x44, 0x1B, 0x0D, 0xDE, 0x8D, 0x36, 0x54, 0x4B, 0xB1, 0x7E, 0x3F, 0xAC, 0xED, 0x86,
+    0xC8, 0x4B, 0x7A, 0x4C, 0x8F, 0xF0, 0xB3, 0x92, 0x7B, 0x37, 0x9E, 0xB2, 0xD0, 0x0B, 0x60, 0x01,
+    0xAC, 0x16, 0xB0, 0xAE, 0xE9, 0xFC, 0x12, 0x00, 0x8C, 0x1E, 0xBA, 0x39, 0xA3, 0x4C, 0x37, 0x28,
+    0x4B, 0xA0, 0xB4, 0x40, 0x87, 0x2C, 0x02, 0xA7, 0x3E, 0x75, 0xE5, 0x73, 0x57, 0x12, 0xD4, 0xA3,
+    0x07, 0x6F, 0x98, 0x7B, 0xCB, 0xE8, 0xEE, 0xD8, 0x46, 0x4E, 0x17, 0xB1, 0x5A, 0xEA, 0xD9, 0xCE,
+    0x36, 0xB4, 0x93, 0x1B, 0x5D, 0xDF, 0xF9, 0xE1, 0xE9, 0xB0, 0x0E, 0xB1, 0x9B, 0xEE, 0xDC, 0xD4,
+    0x04, 0x75, 0x28, 0x09, 0xF6, 0x84, 0x01, 0x10, 0x68, 0xB8, 0x17, 0x7A, 0xA4, 0x36, 0x68, 0x6C,
+    0x32, 0x93, 0x48, 0x0E, 0x32, 0x95, 0xDA, 0x98, 0x71, 0x4C, 0x72, 0x0C, 0x26, 0x8A, 0x4C, 0xAC,
+    0x00, 0x02, 0xB7, 0x3B, 0x26, 0x9C, 0x21, 0xB6, 0xCA, 0xF0, 0xDB, 0xDC, 0x01, 0xD2, 0x82, 0x6A,
+    0x25, 0x7E, 0x95, 0xCC, 0x52, 0x0E, 0xC7, 0x68, 0x59, 0xCE, 0x28, 0x8B, 0x46, 0xC5, 0x88, 0x38,
+    0x84, 0xBC, 0x49, 0x72, 0x34, 0xB0, 0x90, 0x66, 0x38, 0xCA, 0x07, 0xF3, 0xD3, 0x2D, 0x51, 0x89,
+    0x1A, 0x48, 0x81, 0x52, 0xDD, 0x84, 0x2A, 0x4C, 0x4D, 0x30, 0x57, 0x2A, 0x0A, 0xAE, 0x7B, 0x74,
+    0x80, 0x32, 0x15, 0x3F, 0xE3, 0xD9, 0x6D, 0x90, 0xE7, 0x62, 0x31, 0x2B, 0xB8, 0xAE, 0x67, 0x1A,
+    0x40, 0x9F, 0x0A, 0x65, 0xE7, 0x7A, 0xA1, 0x0E, 0x92, 0x14, 0xAB, 0x7E, 0xAA, 0x16, 0x7C, 0xD3,
+    0xBE, 0xFA, 0x1C, 0x88, 0xD6, 0x7A, 0x29, 0x38, 0xB8, 0x51, 0x65, 0x36, 0xAA, 0x13, 0xB5, 0x70,
+    0x89, 0x81, 0x00, 0xEE, 0x67, 0x31, 0x83, 0x08, 0x23, 0x46, 0x29, 0x7E, 0x3D, 0x53, 0xAE, 0x16,
+    0xA0, 0xD2, 0x29, 0x0D, 0x40, 0x5E, 0x46, 0x61, 0x2A, 0x38, 0x9C, 0xFB, 0x0F, 0xCF, 0x05, 0x6E,
+    0xA5, 0x15, 0x07, 0x4F, 0x89, 0x56, 0xA4, 0xAA, 0x2A, 0x25, 0x4A, 0xB7, 0x12, 0xA6, 0x4C, 0x2A,
+    0xC5, 0xF9, 0x26, 0x02, 0xE4, 0x9B, 0x58, 0x57, 0x09, 0x26, 0xB5, 0x92, 0xD0, 0x2F, 0x04, 0x12,
+    0x29, 0x63, 0x92, 0x4E, 0x8D, 0x2A, 0x39, 0x3F, 0x92, 0x4C, 0xEA, 0x66, 0xC7, 0x41, 0x6E, 0xF8,
+    0xF2, 0xEE, 0x8F, 0x19, 0xC2, 0xA7, 0x3B, 0xD5, 0x85, 0xFC, 0xEC, 0x5A, 0x24, 0x7A, 0x16, 0xA8,
+    0x0A, 0x8F, 0x88, 0x1E, 0x52, 0x9F, 0x43, 0xCC, 0x11, 0x30, 0x58, 0xF2, 0x21, 0xEE, 0xC0, 0x27,
+    0x6D, 0xE4, 0xA1, 0x41, 0xBA, 0x62, 0xCD, 0x9C, 0x64, 0xD0, 0xAE, 0xCF, 0x6E, 0x86, 0xFB, 0xCF,
+    0xE3, 0x80, 0xB3, 0x48, 0x19, 0xEB, 0x43, 0x90, 0x5D, 0xFD, 0xB9, 0x65, 0x39, 0x2B, 0xC9, 0xF9,
+    0xC9, 0xEB, 0x73, 0xCF, 0xCF, 0x3A, 0x7A, 0x81, 0x13, 0x55, 0x9B, 0x34, 0x58, 0xA6, 0x3C, 0xAD,
+    0xD2, 0x44, 0x95, 0xA4, 0xF7, 0x3A, 0x76, 0xA8, 0x62, 0xFF, 0x15, 0xBA, 0xEC, 0x7B, 0x29, 0xD6,
+    0x48, 0x5F, 0xA0, 0x53, 0xEA, 0xB9, 0x37, 0x72, 0xE2, 0x5E, 0x69, 0xB9, 0xDF, 0x58, 0xB9, 0x91,
+    0xE6, 0x86, 0x7E, 0xD0, 0x69, 0x77, 0x11, 0x9D, 0x5C, 0x35, 0x1B, 0x7E, 0xB4, 0x54, 0x3C, 0xA2,
+    0xA0, 0x51, 0xCA, 0x48, 0x86, 0xE0, 0x03, 0x4F, 0x7B, 0x37, 0x32, 0xDE, 0xB7, 0xF7, 0xD6, 0xEF,
+    0x93, 0x8A, 0xEB, 0xB9, 0xDC, 0x0E, 0x52, 0x14, 0xE9, 0x12, 0x99, 0xEF, 0x64, 0x28, 0x7A, 0xED,
+    0x4F, 0x1A, 0x76, 0xFD, 0xD1, 0xA4, 0x76, 0xAE, 0xDE, 0x71, 0x68, 0xAF, 0x51, 0x7A, 0xBA, 0x2E,
+    0xD7, 0x72, 0x69, 0x42, 0x3B, 0x0E, 0x45, 0x2A, 0x37, 0x19, 0x48, 0x4C, 0xCB, 0xE0, 0x8B, 0x34,
+    0x20, 0x1E, 0x78, 0x5E, 0xF2, 0xEB, 0xAD, 0xE0, 0xBF, 0x16, 0xD5, 0xCB, 0x4B, 0x66, 0x02, 0xA5,
+    0xE5, 0x92, 0x6D, 0xF4, 0x19, 0x1E, 0x81, 0x5B, 0x7D, 0xF3, 0x25, 0xDD, 0x6B, 0x56, 0xB3, 0xB9,
+    0xAD, 0xE6, 0xFB, 0x6B, 0xB3, 0x99, 0xD4, 0x7D, 0x65, 0x52, 0x84, 0x76, 0x01, 0x1E, 0xC4, 0x56,
+    0xC0, 0xFF, 0xEA, 0xFD, 0x4C, 0xF5, 0xBB, 0x85, 0xEC, 0x3F, 0xE9, 0x8E, 0x0D, 0xFC, 0x75, 0x33,
+    0x61, 0xF7, 0x4C, 0x2E, 0xBA, 0x51, 0xB4, 0xBA, 0xB9, 0x4A, 0xF4, 0x53, 0x44, 0xD2, 0x15, 0x49,
+    0x03, 0x50, 0x37, 0x28, 0x87, 0xA1, 0x39, 0x8B, 0xC0, 0x02, 0xCD, 0xDE, 0xEC, 0xC2, 0xEE, 0x4A,
+    0xF1, 0x98, 0x9A, 0x72, 0xE8, 0x77, 0x3B, 0xF2, 0xEE, 0x46, 0x19, 0x7B, 0x72, 0xA7, 0x38, 0x37,
+    0x9A, 0x2B, 0xC4, 0x3D, 0x81, 0x1F, 0xAB, 0x80, 0x0D, 0xB1, 0x1A, 0xFE, 0x9B, 0x5F, 0x32, 0x33,
+    0x16, 0x24, 0xEF, 0xDB, 0xF3, 0x52, 0x32, 0x75, 0xC9, 0x70, 0x30, 0x59, 0xFD, 0x03, 0xBC, 0x00,
+    0x6A, 0x46, 0x8C, 0x28, 0x75, 0x1E, 0xC3, 0x29, 0xC9, 0x31, 0x73, 0x9B, 0x18, 0x0C, 0x1E, 0x90,
+    0xBF, 0x48, 0x18, 0x4D, 0x4C, 0x2E, 0x68, 0xB6, 0x41, 0xCC, 0x87, 0x9D, 0xE9, 0xFE, 0x00, 0x4A,
+    0x72, 0x1B, 0xB5, 0x0B, 0x06, 0xF4, 0x7F, 0xC1, 0x4E, 0xDF, 0xEC, 0x1E, 0x31, 0x92, 0xB0, 0xC1,
+    0x43, 0x31, 0xEF, 0xEE, 0xB8, 0xAB, 0x03, 0xE3, 0x9B, 0xAD, 0xE4, 0xF9, 0x3E, 0x2C, 0x36, 0xC1,
+    0x15, 0xBA, 0x65, 0xBA, 0x1E, 0xB6, 0x67, 0x41, 0x7E, 0x7B, 0x1A, 0xF7, 0xD3, 0x6F, 0xD1, 0x36,
+    0xC7, 0x7A, 0x85, 0x03, 0x8D, 0xC7, 0x32, 0xB3, 0x93, 0xDC, 0x7C, 0x39, 0xD1, 0x31, 0xD7, 0x93,
+    0x7F, 0xE5, 0x9C, 0xDF, 0x38, 0x9C, 0x7E, 0x40, 0x6B, 0x6F, 0xB1, 0x8B, 0x23, 0x5E, 0x4A, 0x6E,
+    0x7A, 0x2C, 0x73, 0x7E, 0xCC, 0xBD, 0xE9, 0x4E, 0xD0, 0x4D, 0x92, 0x4E, 0x6B, 0x42, 0x56, 0x82,
+    0xEE, 0x15, 0xED, 0x59, 0xBA, 0x43, 0xB8, 0xED, 0xEB, 0x44, 0x48, 0x13, 0xCA, 0x45, 0xDA, 0x1B,
+    0x3B, 0x66, 0x00, 0x66, 0x9D, 0x6F, 0xE3, 0xBB, 0xF8, 0xC4, 0xF2, 0xEF, 0xE1, 0x22, 0xBE, 0xA0,
+    0xEE, 0x8B, 0xB1, 0x9E, 0x81, 0xD0, 0x02, 0xB8, 0x97, 0x9D, 0xD7, 0xEA, 0x3C, 0xCA, 0x18, 0x03,
+    0xBD, 0xE8, 0x54, 0xCF, 0xCA, 0x24, 0xE4, 0x38, 0x7D, 0xBD, 0xFE, 0x22, 0x82, 0x88, 0x17, 0xA1,
+    0x08, 0x7D, 0x7C, 0xFB, 0x62, 0x19, 0xB3, 0x2E, 0x3A, 0x6D, 0xCA, 0xB5, 0x02, 0x14, 0x61, 0xF0,
+    0x26, 0xB8, 0x04, 0x40, 0xEC, 0x0D, 0xBC, 0x96, 0x26, 0x00, 0x64, 0x02, 0xC0, 0xE7, 0xAA, 0xCA,
+    0xA9, 0x9F, 0x07, 0x12, 0x1E, 0x55, 0x16, 0xF4, 0xE3, 0x40, 0xF1, 0x90, 0x2A, 0x60, 0x0E, 0x67,
+    0xBA, 0xE0, 0xFA, 0x0F, 0xCD, 0x55, 0xBF, 0x8E, 0xD7, 0x46, 0x10, 0x9E, 0xF5, 0x72, 0x5A, 0x81,
+    0x85, 0x96, 0xE2, 0x42, 0x01, 0x85, 0x29, 0x53, 0x44, 0xF2, 0x1B, 0xDC, 0x5A, 0xBA, 0x22, 0x65,
+    0x28, 0xE8, 0x78, 0x88, 0x6B, 0x69, 0x90, 0xAD, 0x14, 0x69, 0x28, 0xB8, 0x47, 0x48, 0x9B, 0x26,
+    0xCA, 0x03, 0x20, 0x76, 0xE1, 0x4A, 0x1A, 0x4B, 0x14, 0x94, 0x59, 0x91, 0x74, 0x29, 0x58, 0x21,
+    0x0B, 0x19, 0x58, 0xEF, 0xF0, 0xCD, 0xFE, 0xEE, 0xC7, 0x41, 0x44, 0x99, 0x48, 0xB7, 0xB2, 0x47,
+    0xF6, 0xCE, 0x78, 0xFE, 0x7C, 0xFB, 0xCD, 0x98, 0x0E, 0x88, 0xC6, 0x95, 0x2C, 0x07, 0xBA, 0xBF,
+    0xE2, 0x71, 0xA0, 0x36, 0x11, 0x31, 0x91, 0x4D, 0xA4, 0x0A, 0x51, 0x3F, 0x93, 0xCE, 0x76, 0x72,
+    0x67, 0x59, 0xAF, 0x63, 0x18, 0x8F, 0x97, 0x36, 0x1D, 0x56, 0x75, 0xFC, 0xAC, 0xDE, 0xFE, 0x20,
+    0xC7, 0xA4, 0x39, 0x52, 0xBF, 0x10, 0xDD, 0xA0, 0xDD, 0xD2, 0x0C, 0x2B, 0xC7, 0x70, 0x36, 0x46,
+    0xBC, 0x6D, 0xD8, 0x1A, 0x03, 0x91, 0xC9, 0x78, 0xF0, 0xBF, 0xC0, 0x81, 0xA8, 0xF8, 0x3D, 0x51,
+    0x87, 0xB0, 0x2D, 0xCB, 0x0D, 0xBB, 0x8F, 0x62, 0xE7, 0x82, 0x3A, 0x85, 0xDD, 0x11, 0xF9, 0x60,
+    0xA2, 0x5D, 0x69, 0x53, 0xFC, 0x0F, 0x3F, 0x63, 0xE6, 0xD5, 0xB1, 0x78, 0x55, 0x83, 0xE2, 0xA8,
+    0x39, 0xA9, 0x93, 0x48, 0xDD, 0x4C, 0x7D, 0xC0, 0x17, 0x72, 0x8D, 0x13, 0xF9, 0x27, 0xC4, 0x2B,
+    0xF1, 0xA4, 0x0B, 0xF5, 0x1B, 0xB9, 0x8C, 0xE4, 0x49, 0xAF, 0x64, 0x56, 0x6A, 0x17, 0xB2, 0xEF,
+    0x02, 0xEA, 0xB4, 0x3C, 0xB5, 0x88, 0x32, 0xD0, 0xC5, 0xBA, 0x56, 0x65, 0x17, 0x44, 0xF6, 0x49,
+    0x24, 0x20, 0x91, 0x44, 0xA2, 0xC8, 0xAB, 0xF4, 0xAF, 0xE5, 0x0A, 0x75, 0x1C, 0xE1, 0xCA, 0xF0,
+    0x22, 0x96, 0x00, 0xC1, 0x32, 0x99, 0x24, 0x18, 0x34, 0x2B, 0x29, 0xCE, 0x84, 0x00, 0x9E, 0x07,
+    0x07, 0x5B, 0x9F, 0xE0, 0xD7, 0xBE, 0xDA, 0x00, 0xAB, 0x49, 0xFC, 0xF3, 0x4A, 0x4D, 0xEE, 0x12,
+    0xD4, 0x4F, 0x75, 0x11, 0xF5, 0xE0, 0xFF, 0x84, 0x3A, 0x08, 0x1A, 0x26, 0x35, 0x2C, 0x6A, 0x72,
+    0x50, 0x97, 0x8A, 0xC9, 0x78, 0xAA, 0x38, 0x28, 0x2E, 0x92, 0x09, 0xFC, 0x99, 0xA5, 0xC6, 0xDF,
+    0xA5, 0x7E, 0x07, 0x77, 0x2B, 0x29, 0xEF, 0x20, 0x23, 0x49, 0x80, 0x48, 0xE0, 0xB5, 0x5F, 0xE4,
+    0x7A, 0x30, 0x1C, 0x50, 0x57, 0xDA, 0x4D, 0xF3, 0x5F, 0x9C, 0x6E, 0x16, 0xC0, 0xD7, 0xB1, 0x4D,
+    0xF0, 0x0A, 0x80, 0x52, 0x37, 0xEB, 0x22, 0xF1, 0x82, 0x0B, 0x66, 0x05, 0x46, 0x7E, 0xF0, 0x83,
+    0x4D, 0x38, 0x79, 0x26, 0xFE, 0xA1, 0x43, 0x85, 0xCF, 0x37, 0xE2, 0xC5, 0x85, 0x56, 0xD0, 0xB8,
+    0x72, 0x99, 0xCA, 0x57, 0xA7, 0xF2, 0xA4, 0xB6, 0x5D, 0x42, 0x93, 0x48, 0x3B, 0x8B, 0x34, 0xF1,
+    0x42, 0xEE, 0x8C, 0xE8, 0x1E, 0xDD, 0x05, 0x5F, 0xFC, 0xEC, 0x8A, 0x63, 0x75, 0xF2, 0x06, 0xBC,
+    0xE1, 0x04, 0x18, 0xB2, 0x8D, 0x0D, 0xC3, 0x83, 0x8B, 0x7D, 0xD0, 0x19, 0x3C, 0x19, 0xA7, 0x71,
+    0x6A, 0x17, 0xF0, 0x04, 0xD5, 0x83, 0xFE, 0xF6, 0xED, 0xB3, 0x42, 0x9C, 0xFB, 0xD9, 0xF2, 0x71,
+    0x26, 0x3F, 0xED, 0x22, 0x1F, 0xEE, 0x23, 0x6D, 0x7B, 0xF8, 0x25, 0xA9, 0x23, 0xDC, 0xCD, 0x17,
+    0xA8, 0x37, 0xC1, 0x88, 0x4D, 0x96, 0x5E, 0xA2, 0xFE, 0x51, 0xAC, 0xFD, 0x10, 0x2F, 0x28, 0x55,
+    0xB5, 0x97, 0x8F, 0x52, 0x58, 0x0F, 0x34, 0xBE, 0x0A, 0x60, 0x91, 0x83, 0xAB, 0x86, 0x91, 0xA7,
+    0x15, 0x8B, 0xA7, 0x02, 0xE7, 0xF0, 0x3F, 0x50, 0xEA, 0xD7, 0x7A, 0x74, 0xB5, 0xE7, 0x5C, 0xED,
+    0x3F, 0x5F, 0x87, 0x47, 0x6D, 0x3F, 0x5B, 0x37, 0x0A, 0x8E, 0xEF, 0xAE, 0x49, 0x1E, 0x27, 0x78,
+    0x64, 0xF9, 0x31, 0x06, 0xD5, 0x77, 0xC5, 0xB3, 0x00, 0x7A, 0x86, 0x34, 0xE5, 0x18, 0xF1, 0xD1,
+    0x8C, 0xC1, 0x55, 0x03, 0x53, 0x0D, 0x86, 0x51, 0x03, 0x52, 0x34, 0x9B, 0x10, 0xC4, 0x26, 0x39,
+    0x05, 0x24, 0xF4, 0x42, 0xE6, 0x1A, 0x80, 0x34, 0xAB, 0x66, 0x99, 0x1A, 0x6D, 0x65, 0x8F, 0xBA,
+    0x2C, 0x67, 0xA0, 0xA4, 0x75, 0x9B, 0xA1, 0x54, 0x5E, 0x57, 0x14, 0xA0, 0x92, 0xB1, 0x54, 0xA5,
+    0xFA, 0xED, 0x9C, 0xCA, 0x82, 0xBC, 0x30, 0x59, 0x80, 0x17, 0x22, 0x0B, 0xEE, 0xC2, 0x63, 0x54,
+    0xBF, 0x09, 0x8D, 0x51, 0x5D, 0x6E, 0x17, 0xB3, 0xA2, 0xEC, 0x45, 0xB0, 0x00, 0xE6, 0xA9, 0x9F,
+    0xBB, 0xD9, 0x05, 0xCC, 0xC9, 0x8A, 0x31, 0xA0, 0x9A, 0x98, 0x9A, 0x77, 0x1B, 0x0A, 0x5B, 0x77,
+    0xBC, 0xFC, 0x5D, 0x42, 0x38, 0x79, 0xEA, 0xB1, 0x45, 0x86, 0xB7, 0xAF, 0xD8, 0x59, 0x83, 0x77,
+    0xB2, 0x89, 0x01, 0x3C, 0xD3, 0x58, 0x3C, 0xAA, 0x59, 0x1A, 0x9E, 0x5C, 0x22, 0x97, 0x30, 0xF5,
+    0xDB, 0xCD, 0x66, 0x00, 0xF4, 0x23, 0x2C, 0xC6, 0xD7, 0x28, 0xB0, 0x5B, 0x70, 0x4C, 0x66, 0x83,
+    0xBA, 0xE1, 0x9F, 0x50, 0x17, 0x9F, 0xC9, 0xCF, 0x20, 0x62, 0xB3, 0x5F, 0xB0, 0x69, 0x73, 0x5B,
+    0x20, 0x88, 0x63, 0xB7, 0x21, 0x22, 0x1C, 0x37, 0x0C, 0x74, 0xE9, 0x36, 0xFF, 0xBD, 0x1F, 0x34,
+    0x06, 0xEF, 0x16, 0x8A, 0x56, 0xF6, 0xF7, 0xEB, 0x9E, 0x64, 0x11, 0x80, 0x0B, 0x20, 0x3D, 0x41,
+    0x8D, 0x6D, 0xB6, 0xC9, 0xE4, 0x2E, 0x6A, 0x74, 0xA9, 0xCE, 0xC2, 0x38, 0x10, 0x0B, 0xE4, 0xB2,
+    0xC9, 0x85, 0x2E, 0xBA, 0x79, 0x0C, 0xFD, 0x07, 0xB4, 0x32, 0x5C, 0x34, 0x52, 0x9B, 0xF4, 0x2E,
+    0xBC, 0xDF, 0x90, 0x09, 0xF9, 0x3D, 0x42, 0x2C, 0x0F, 0xF1, 0x2E, 0x3F, 0x14, 0xD0, 0xF9, 0xDC,
+    0xFD, 0xF9, 0xBA, 0x85, 0xC9, 0xA1, 0xA4, 0x54, 0x2D, 0xC9, 0x19, 0xFC, 0x7E, 0x82, 0xE6, 0xA1,
+    0x07, 0x71, 0xB0, 0xD3, 0xE0, 0x40, 0xFC, 0x8C, 0x3C, 0xBA, 0x65, 0x9C, 0xC9, 0x14, 0xFC, 0x31,
+    0x54, 0xAD, 0x72, 0x7C, 0x09, 0x5F, 0xBD, 0x94, 0x6E, 0x33, 0xAA, 0xD4, 0xC5, 0x4A, 0xE0, 0x63,
+    0x6C, 0x72, 0xF0, 0x11, 0xC2, 0x16, 0xC5, 0x33, 0x4A, 0x15, 0xFA, 0x31, 0xCC, 0x94, 0x2F, 0xC3,
+    0xBE, 0xF9, 0xA4, 0xBB, 0x4C, 0xB8, 0x4E, 0x6D, 0x7C, 0x42, 0x42, 0xC0, 0xDA, 0x7B, 0x87, 0xFF,
+    0x61, 0xE1, 0xDF, 0x5E, 0x9F, 0x00, 0xC5, 0x54, 0xB1, 0x8E, 0xE5, 0x34, 0x14, 0x3D, 0x8E, 0x99,
+    0xF1, 0x42, 0x0A, 0xD3, 0x6C, 0x89, 0x42, 0xB1, 0x15, 0x42, 0xE4, 0x0F, 0x36, 0x91, 0xF8, 0x81,
+    0x29, 0x46, 0x8B, 0x44, 0x43, 0x43, 0xC5, 0x16, 0x43, 0xB9, 0x0D, 0x72, 0x04, 0x1F, 0x00, 0x9F,
+    0xB0, 0x05, 0x05, 0xA2, 0x79, 0x14, 0xB4, 0x28, 0x96, 0x28, 0x68, 0x23, 0x21, 0x44, 0x1B, 0x41,
+    0xB9, 0x05, 0x2E, 0x82, 0xC8, 0xCE, 0x3A, 0xB9, 0x9C, 0xEB, 0xCC, 0xCC, 0x7E, 0x00, 0x5A, 0xD6,
+    0x7A, 0xCE, 0xB3, 0xEC, 0x6B, 0xDF, 0x73, 0xEE, 0x3D, 0xF7, 0x02, 0xC7, 0x70, 0xFD, 0xFB, 0x40,
+    0x95, 0xFD, 0x0C, 0xC8, 0x2F, 0x1B, 0x10, 0xFE, 0x90, 0x1E, 0x7E, 0x0E, 0x3D, 0x30, 0x55, 0xFD,
+    0x8D, 0x11, 0xCE, 0xBF, 0xE5, 0xA7, 0x11, 0x9E, 0x7B, 0x91, 0x05, 0x4E, 0x9E, 0x49, 0x84, 0x4C,
+    0xF5, 0x8E, 0x2E, 0xF1, 0x57, 0x6F, 0xA8, 0xA4, 0xE7, 0x56, 0xB3, 0x34, 0x0B, 0x8C, 0x7C, 0x29,
+    0xB4, 0x5E, 0x78, 0x64, 0xE4, 0x43, 0x2E, 0x5B, 0x5D, 0x5A, 0xB1, 0x5C, 0x76, 0x33, 0x97, 0xF5,
+    0xA6, 0x4B, 0x89, 0xED, 0xAA, 0xD7, 0x65, 0x6E, 0x36, 0xD4, 0x22, 0xF4, 0xDB, 0x0A, 0xDF, 0xC0,
+    0x95, 0x7C, 0x43, 0x6F, 0x6F, 0xDC, 0xFA, 0xC6, 0x5B, 0x66, 0x80, 0x9D, 0x33, 0xEC, 0xBA, 0xA3,
+    0x5A, 0x47, 0x98, 0x35, 0x00, 0xEB, 0x07, 0x34, 0x31, 0x37, 0x16, 0xF7, 0x41, 0x4F, 0x99, 0x18,
+    0x24, 0x56, 0x72, 0xB5, 0x98, 0xBD, 0x12, 0x08, 0x42, 0x0C, 0x83, 0x4F, 0xED, 0x64, 0xB3, 0x4F,
+    0x66, 0xB7, 0x19, 0x63, 0x2F, 0xE8, 0x62, 0x17, 0x9B, 0xD9, 0x2F, 0x4D, 0xAA, 0xE4, 0x44, 0xEC,
+    0x92, 0x78, 0x8D, 0xE4, 0xCF, 0xCA, 0x43, 0xE6, 0xB2, 0xFC, 0x11, 0x87, 0x70, 0x73, 0xD4, 0xBF,
+    0x15, 0xE3, 0xFE, 0x78, 0xFF, 0x7E, 0x23, 0x4E, 0x23, 0x68, 0x31, 0x4E, 0x18, 0x87, 0x3A, 0x86,
+    0x09, 0xDD, 0x54, 0x4D, 0xC4, 0xEF, 0x93, 0x92, 0x05, 0xDF, 0x47, 0x9D, 0x89, 0xE3, 0xD1, 0x53,
+    0xBB, 0x83, 0x77, 0x33, 0xC8, 0xA8, 0x13, 0x86, 0x68, 0x82, 0x5F, 0xA0, 0xD3, 0xD1, 0x86, 0x87,
+    0x86, 0xE7, 0xA4, 0x4F, 0x3C, 0x76, 0xD2, 0x18, 0xC4, 0x6A, 0xB1, 0x32, 0x34, 0x09, 0x59, 0x5D,
+    0xEE, 0x27, 0x29, 0xE1, 0x10, 0x19, 0x0E, 0x20, 0xB1, 0x10, 0x2C, 0xE3, 0x12, 0x67, 0x3D, 0xF3,
+    0xD0, 0x8F, 0x0B, 0x2D, 0x7F, 0x97, 0x4C, 0xB6, 0xF2, 0x6B, 0x76, 0x6B, 0x2D, 0x4C, 0x61, 0x72,
+    0x9B, 0x5D, 0x9B, 0xD9, 0xE6, 0x5A, 0x49, 0xAF, 0xCA, 0xD4, 0x5D, 0xD3, 0x7D, 0xAC, 0x99, 0xB2,
+    0x2E, 0x7A, 0x7A, 0x25, 0xF7, 0x05, 0x3F, 0x74, 0x53, 0xC8, 0x2E, 0xB5, 0xD7, 0x4A, 0xD2, 0xCB,
+    0x73, 0x46, 0xDE, 0xCA, 0x14, 0x56, 0xE0, 0x6D, 0x18, 0xBC, 0x1C, 0x9F, 0xEB, 0xE7, 0x27, 0x8D,
+    0x0A, 0x89, 0x30, 0x7F, 0x51, 0xC1, 0xAB, 0x24, 0x3E, 0xBD, 0x33, 0xF9, 0x98, 0xBA, 0xA8, 0x55,
+    0x11, 0x5E, 0xF3, 0x67, 0x4F, 0x4B, 0x60, 0xA2, 0xB3, 0xDB, 0x78, 0x45, 0xD9, 0x87, 0x81, 0xDC,
+    0xDB, 0x99, 0x11, 0xF2, 0x0B, 0x63, 0xC3, 0x13, 0x0D, 0xD0, 0x29, 0x6B, 0x78, 0xE8, 0x4E, 0x83,
+    0x0F, 0xFF, 0x37, 0x71, 0xD9, 0x4C, 0x43, 0x23, 0x1A, 0x9F, 0x71, 0xA0, 0xA3, 0x6E, 0x6A, 0x32,
+    0x9A, 0xE7, 0x95, 0xC4, 0x20, 0x53, 0xB7, 0xD1, 0x90, 0x19, 0xBD, 0x15, 0x05, 0x21, 0xD4, 0x03,
+    0x95, 0x8A, 0x12, 0xF3, 0x96, 0xB0, 0x34, 0xAC, 0xF1, 0x4E, 0x32, 0x17, 0x67, 0x46, 0x66, 0xF1,
+    0xF2, 0x75, 0xBE, 0xBF, 0x8D, 0xC9, 0xFE, 0xF3, 0xA2, 0xA7, 0xC0, 0x30, 0xCE, 0xD0, 0x37, 0xBC,
+    0xFA, 0x8D, 0x25, 0x05, 0xF5, 0x52, 0x96, 0x54, 0x0A, 0x1C, 0x77, 0xDB, 0xE9, 0x75, 0x31, 0x7A,
+    0xAA, 0x0B, 0xD5, 0x04, 0x3A, 0xF2, 0x82, 0x57, 0x20, 0x76, 0xD6, 0xE2, 0x4C, 0x1A, 0x7D, 0xAD,
+    0x06, 0xEA, 0xF3, 0xC2, 0xC9, 0x57, 0x59, 0x59, 0x9D, 0x85, 0xAB, 0x8C, 0x2E, 0xFC, 0x88, 0xB0,
+    0x14, 0x5A, 0x18, 0x95, 0xC4, 0x50, 0x88, 0x28, 0xAF, 0x6A, 0x3B, 0x22, 0xA3, 0x53, 0x89, 0x29,
+    0xCF, 0x22, 0xEE, 0xFE, 0x78, 0xBB, 0xD6, 0xC9, 0x2B, 0x9E, 0x57, 0x1E, 0x72, 0xFF, 0xDD, 0x97,
+    0x29, 0x7F, 0x47, 0x37, 0x28, 0xEE, 0x1E, 0x26, 0x87, 0x52, 0x08, 0x0A, 0xA5, 0x00, 0x7D, 0xF8,
+    0x7A, 0x93, 0x0E, 0x3C, 0xB1, 0x73, 0x95, 0x3A, 0xB8, 0x3F, 0xF9, 0x70, 0xE9, 0x2F, 0x7C, 0xAB,
+    0x57, 0xCD, 0xFE, 0xF7, 0xA4, 0x97, 0x61, 0x55, 0x57, 0x8A, 0x4D, 0x45, 0xB5, 0x1D, 0x0E, 0xEE,
+    0x3A, 0xE0, 0x67, 0x17, 0x44, 0x2A, 0x03, 0x3B, 0xCC, 0x52, 0xC9, 0x23, 0x36, 0x03, 0x74, 0xEC,
+    0x2F, 0x3E, 0x36, 0xC9, 0x4E, 0xAE, 0x94, 0x73, 0xD2, 0x68, 0x0D, 0x74, 0xA7, 0xD7, 0xB5, 0x56,
+    0x94, 0x6C, 0x2D, 0x60, 0xA5, 0xC6, 0x2F, 0xD0, 0xA4, 0x76, 0x70, 0xD9, 0x2F, 0x76, 0xB7, 0xF2,
+    0x97, 0x68, 0x99, 0xD3, 0x72, 0x3B, 0xC4, 0xCC, 0xC1, 0x4C, 0xB8, 0x58, 0xF8, 0x54, 0xBC, 0xDE,
+    0x10, 0xD4, 0x76, 0x48, 0xFA, 0x66, 0x18, 0x75, 0xBF, 0xB2, 0xF2, 0x93, 0xD9, 0x3E, 0x89, 0x75,
+    0x7A, 0x53, 0x9B, 0x4A, 0xC9, 0xBD, 0xFA, 0xD5, 0x79, 0xE8, 0xA0, 0x21, 0x30, 0xB1, 0xD9, 0xCA,
+    0x69, 0xAA, 0xD9, 0x79, 0x9C, 0x4C, 0x77, 0x01, 0xE2, 0x23, 0x2B, 0x8A, 0x4E, 0x0C, 0x53, 0x67,
+    0xB6, 0x40, 0x9D, 0xB8, 0x09, 0x4F, 0x0E, 0xF5, 0xBD, 0x6A, 0x86, 0xEF, 0x1D, 0xB2, 0x6C, 0x29,
+    0x85, 0x6B, 0x0A, 0xE7, 0x67, 0xF6, 0x3A, 0x17, 0xCD, 0x70, 0xEF, 0xB6, 0xAD, 0x21, 0x28, 0xDA,
+    0x8C, 0xF0, 0x51, 0xAA, 0x72, 0xD5, 0x6B, 0xBF, 0x6C, 0x35, 0x69, 0xF9, 0x98, 0xBA, 0x6E, 0x93,
+    0x8B, 0xDA, 0xD3, 0xC8, 0xF0, 0x19, 0x21, 0xCA, 0xA0, 0x3C, 0x0E, 0x71, 0xBC, 0x52, 0xEC, 0xDF,
+    0xE1, 0xA8, 0xB0, 0x52, 0x8C, 0x1A, 0xC2, 0x8C, 0x92, 0xA5, 0x9B, 0x36, 0x78, 0x59, 0x32, 0x13,
+    0x24, 0x36, 0xBF, 0x65, 0x85, 0xCE, 0xC4, 0x54, 0xF4, 0xA4, 0x12, 0x55, 0xE4, 0x45, 0x81, 0x26,
+    0xF9, 0x44, 0xE0, 0x9A, 0x96, 0x56, 0x8D, 0xB7, 0x82, 0xFB, 0xFC, 0x28, 0xD9, 0x73, 0xC5, 0x56,
+    0xAA, 0xD2, 0x91, 0xCF, 0x03, 0xFC, 0x3F, 0xE3, 0x5F, 0xCD, 0x55, 0x3B, 0x6E, 0xD5, 0x40, 0x14,
+    0x3D, 0xE3, 0x21, 0xB1, 0x84, 0x0B, 0xA7, 0x40, 0x08, 0x29, 0x48, 0xDE, 0x01, 0x6E, 0x29, 0x92,
+    0xD8, 0x84, 0x05, 0x90, 0x82, 0x8E, 0x82, 0x9E, 0x35, 0x44, 0xB2, 0x97, 0x90, 0x45, 0x50, 0x20,
+    0x51, 0xB0, 0x81, 0x20, 0x8F, 0x42, 0x99, 0x66, 0x68, 0xA8, 0x5D, 0x50, 0x41, 0xC1, 0x48, 0x18,
+    0xC9, 0x0A, 0x1E, 0x5F, 0xCE, 0xF5, 0x7B, 0x81, 0x20, 0x84, 0x50, 0x24, 0x12, 0x65, 0xF4, 0xDE,
+    0xC8, 0x6F, 0xDE, 0x9D, 0x7B, 0xCF, 0x39, 0xF7, 0x63, 0x40, 0xD7, 0x43, 0x1C, 0x23, 0xED, 0xAB,
+    0x16, 0xD5, 0x13, 0x0F, 0x23, 0x03, 0x90, 0x46, 0x1E, 0x97, 0x58, 0xAF, 0x17, 0x07, 0x40, 0x23,
+    0x3D, 0x4A, 0x91, 0x3A, 0x8B, 0xCF, 0x06, 0x08, 0x2A, 0x14, 0xC1, 0x06, 0x23, 0xD8, 0x45, 0x31,
+    0xD2, 0x44, 0x02, 0x90, 0xD1, 0x84, 0x36, 0x0E, 0xE8, 0x44, 0x8F, 0x78, 0x9E, 0x88, 0xCB, 0xEB,
+    0x6C, 0x32, 0x03, 0x1A, 0x57, 0xB6, 0xE9, 0x64, 0x23, 0xA4, 0xAD, 0x66, 0x09, 0x89, 0xC8, 0xC4,
+    0x7F, 0x35, 0xCC, 0xD6, 0x3A, 0x4A, 0x4E, 0x14, 0xC5, 0xE3, 0x80, 0xFC, 0xD4, 0xD3, 0x55, 0x0D,
+    0x3B, 0x03, 0x66, 0xBA, 0x60, 0xF0, 0x14, 0x28, 0xA4, 0x25, 0x12, 0x67, 0xE2, 0x73, 0x97, 0x4C,
+    0x49, 0x4D, 0x77, 0x74, 0xD2, 0xAE, 0xC2, 0x57, 0xB4, 0xCD, 0x66, 0x3D, 0x40, 0xA1, 0x08, 0x1D,
+    0xBF, 0x67, 0x91, 0x80, 0x46, 0xA4, 0xE2, 0x81, 0x5B, 0xE7, 0x71, 0x44, 0x24, 0x16, 0xDC, 0xA6,
+    0xF2, 0x4C, 0x5E, 0x4F, 0x95, 0x11, 0x33, 0x55, 0x89, 0x98, 0x61, 0x2F, 0x99, 0x93, 0x70, 0xCF,
+    0x46, 0xD3, 0xC2, 0x6A, 0xDC, 0x54, 0xB7, 0x4C, 0xB7, 0x5C, 0x29, 0xE6, 0x83, 0x6E, 0x0C, 0x44,
+    0xEA, 0xAA, 0x0E, 0xC9, 0xA2, 0x5A, 0x36, 0x3A, 0x47, 0xF7, 0x51, 0x3D, 0x47, 0xDD, 0xA6, 0x73,
+    0xDD, 0x5E, 0xF1, 0x6B, 0x54, 0x0A, 0x34, 0xBA, 0xED, 0xE9, 0xB6, 0xF8, 0x54, 0x4F, 0x9B, 0xB5,
+    0xFE, 0xCC, 0x1C, 0xF2, 0x1E, 0xE9, 0x88, 0x24, 0x62, 0x53, 0x84, 0xD8, 0x4E, 0xDE, 0x9C, 0x1D,
+    0xD1, 0x40, 0xA9, 0xF1, 0x6A, 0xE5, 0x50, 0xF4, 0x7A, 0x41, 0x11, 0x89, 0x71, 0xD5, 0x87, 0x81,
+    0x01, 0x2C, 0x63, 0x34, 0x74, 0x52, 0xC3, 0x1C, 0xC1, 0x90, 0x73, 0xE1, 0x60, 0x7B, 0xD8, 0x80,
+    0x34, 0xE8, 0xD1, 0x7A, 0xD9, 0x36, 0x6B, 0x91, 0x7A, 0x26, 0xD6, 0x0E, 0x11, 0xAB, 0xCC, 0xA2,
+    0x73, 0x17, 0x53, 0x7B, 0xBD, 0x82, 0x10, 0x0E, 0x2B, 0x07, 0xE0, 0xED, 0xD4, 0xA1, 0x7C, 0x00,
+    0x3B, 0x06, 0xE5, 0x87, 0xAE, 0xC6, 0xB6, 0xD2, 0x92, 0x70, 0xBB, 0xFB, 0x54, 0x27, 0x71, 0xE5,
+    0x9C, 0xE4, 0x55, 0x03, 0xAA, 0x83, 0xD2, 0x2F, 0x8F, 0x76, 0x4A, 0x91, 0x7F, 0x7B, 0x8B, 0x8A,
+    0x09, 0x17, 0x21, 0x23, 0x7F, 0xA1, 0x7E, 0x2E, 0x43, 0x83, 0xF5, 0x17, 0xA0, 0xF1, 0x2E, 0x49,
+    0xE3, 0x1F, 0xF9, 0xCA, 0x44, 0xF6, 0x45, 0xDC, 0xDF, 0xF3, 0xB5, 0x2E, 0xC3, 0x74, 0xDC, 0xD1,
+    0x0E, 0xF9, 0x42, 0x82, 0x65, 0x43, 0x7A, 0xC6, 0xCF, 0xF8, 0x63, 0x91, 0x64, 0x25, 0x5F, 0x65,
+    0xB6, 0x12, 0xD3, 0x59, 0x5B, 0xB2, 0x71, 0x94, 0x84, 0xFA, 0x33, 0x7C, 0xD7, 0x52, 0x33, 0x22,
+    0xCF, 0x82, 0xCA, 0x22, 0x0A, 0x3D, 0xEF, 0x59, 0xF9, 0x26, 0x2A, 0xF6, 0xD2, 0x13, 0x4E, 0x32,
+    0xA9, 0x80, 0x95, 0x23, 0x5D, 0x3B, 0xEA, 0xDD, 0x4E, 0x7D, 0xD0, 0xB0, 0x19, 0xB6, 0xA3, 0x72,
+    0x67, 0xE3, 0x10, 0xBF, 0xD7, 0x9E, 0x55, 0xBA, 0x1B, 0x4B, 0x50, 0xF3, 0x92, 0x00, 0x9B, 0x77,
+    0x7E, 0x45, 0x3A, 0xD0, 0x66, 0x63, 0xD3, 0xFF, 0xC2, 0x44, 0xA3, 0x83, 0x82, 0x4D, 0x6C, 0xA5,
+    0xCF, 0xC3, 0xDD, 0xC8, 0xDA, 0x2B, 0x5C, 0xE9, 0x93, 0xC9, 0x6A, 0x30, 0xC6, 0x1A, 0x14, 0x1B,
+    0xA4, 0xCE, 0x03, 0x03, 0x11, 0x39, 0x0A, 0xDF, 0x85, 0xFD, 0xA9, 0x6C, 0x0E, 0x4B, 0x39, 0x95,
+    0x13, 0x09, 0x4D, 0xC8, 0x47, 0xC2, 0x59, 0x35, 0xA3, 0xE8, 0xB0, 0x28, 0x54, 0x58, 0xC3, 0xD1,
+    0x72, 0x33, 0x04, 0xC8, 0x74, 0x6E, 0x29, 0xB0, 0x5C, 0x1F, 0xAE, 0x86, 0xF7, 0x96, 0x56, 0x42,
+    0x5E, 0xDF, 0xE7, 0x63, 0x2C, 0x5A, 0xAD, 0x2D, 0xAD, 0xBC, 0x6A, 0x89, 0x77, 0xE7, 0x06, 0xD4,
+    0x80, 0xC2, 0x1C, 0x0D, 0x25, 0x78, 0x7F, 0xBC, 0x1A, 0xE6, 0x89, 0x26, 0xCA, 0xD4, 0x57, 0xA1,
+    0x85, 0x39, 0x58, 0x2A, 0x41, 0xA7, 0xD2, 0x9E, 0x8E, 0xC9, 0xD4, 0xA9, 0x16, 0x87, 0x85, 0xCE,
+    0xAF, 0xCF, 0x8A, 0xA9, 0xFC, 0x4D, 0x16, 0x62, 0xE6, 0xA7, 0x92, 0xBE, 0x12, 0xDF, 0xF4, 0x68,
+    0xBC, 0x52, 0x9B, 0x74, 0xAA, 0x35, 0x6D, 0x36, 0xEA, 0xA4, 0x64, 0x21, 0x75, 0xDA, 0xCF, 0xB9,
+    0xBE, 0x9E, 0x30, 0xA3, 0xE4, 0x88, 0xF1, 0x7C, 0x99, 0xB0, 0x63, 0xD9, 0xD1, 0xA5, 0xB3, 0xCB,
+    0x05, 0xD5, 0x91, 0x2F, 0x24, 0x15, 0xAF, 0xF1, 0x34, 0x4C, 0xE5, 0x51, 0xE7, 0x29, 0xF7, 0x2A,
+    0xFB, 0xCB, 0x7B, 0x65, 0x69, 0xC9, 0x83, 0x9F, 0xA9, 0xD0, 0xB1, 0x61, 0xBE, 0x13, 0xDC, 0x6E,
+    0x4E, 0x18, 0x8A, 0x72, 0xA7, 0x50, 0x3C, 0x7E, 0x3D, 0xD0, 0xFF, 0xBB, 0x32, 0xD7, 0xB0, 0x7E,
+    0x00, 0xBD, 0x54, 0xBD, 0x8E, 0xDD, 0x44, 0x14, 0xFE, 0x6C, 0xE7, 0xCA, 0x48, 0x16, 0x9A, 0x14,
+    0x51, 0x04, 0x14, 0x4C, 0x43, 0x81, 0x90, 0x56, 0xF3, 0x06, 0xCC, 0x2C, 0x79, 0x00, 0x96, 0x77,
+    0xA0, 0xA7, 0xA5, 0x08, 0xB1, 0x21, 0x05, 0xE5, 0xBE, 0xC2, 0x16, 0x54, 0xA1, 0x48, 0x43, 0x99,
+    0xC4, 0xA3, 0x4D, 0x91, 0x82, 0x02, 0x23, 0x44, 0x1D, 0x23, 0xA0, 0x49, 0x8A, 0x1D, 0x84, 0xA5,
+    0x75, 0x61, 0xFB, 0xF0, 0x1D, 0xDF, 0x7B, 0xB3, 0x77, 0xB7, 0x27, 0xD6, 0xDD, 0x19, 0x6B, 0x3D,
+    0xE7, 0x7C, 0x3F, 0xE7, 0xCC, 0x01, 0xB6, 0xCF, 0x87, 0xF8, 0x09, 0x28, 0x93, 0x8B, 0xC8, 0xC5,
+    0x8C, 0x80, 0x7C, 0x3F, 0x03, 0xBE, 0x59, 0x80, 0xBC, 0x79, 0x17, 0x07, 0x4F, 0x21, 0xC2, 0x9F,
+    0x97, 0xDE, 0x4B, 0x57, 0xF7, 0xA8, 0xBB, 0x72, 0x42, 0x31, 0xA1, 0x8D, 0xA8, 0x9B, 0x6A, 0x44,
+    0x35, 0x40, 0x02, 0x5A, 0x98, 0xC4, 0x5F, 0x26, 0xC0, 0x02, 0x97, 0x60, 0xBB, 0x62, 0x41, 0x3E,
+    0xC3, 0x77, 0x70, 0xB1, 0x58, 0x03, 0xEA, 0xC8, 0xF4, 0x8C, 0xAD, 0x12, 0x73, 0xF0, 0x60, 0x29,
+    0xC7, 0x6D, 0x07, 0x2F, 0xA2, 0xE0, 0x42, 0xF0, 0x5C, 0x16, 0xC5, 0x3B, 0xB9, 0x42, 0x0E, 0x67,
+    0xC0, 0x53, 0x1B, 0x60, 0x7E, 0x1B, 0x50, 0x0C, 0xFC, 0xFA, 0xD4, 0x35, 0x30, 0xF7, 0x3A, 0x20,
+    0xDC, 0xD9, 0x1E, 0xD9, 0xF0, 0xBC, 0x9D, 0x41, 0x86, 0xBD, 0x49, 0x77, 0xE7, 0x6C, 0x81, 0x8D,
+    0xAE, 0xCB, 0x27, 0xE2, 0xF9, 0xE8, 0x63, 0x39, 0x94, 0x23, 0xB9, 0x49, 0x30, 0xC9, 0x26, 0x2C,
+    0x85, 0x90, 0x58, 0x9B, 0x3E, 0x9B, 0x5C, 0x7D, 0xDF, 0xC9, 0xCF, 0x72, 0x2E, 0xA9, 0x4E, 0x66,
+    0x2C, 0x46, 0xDC, 0x7A, 0x1B, 0x6A, 0xA3, 0xAA, 0x1D, 0x90, 0x1D, 0xAA, 0x7D, 0xA0, 0x8B, 0x69,
+    0xB8, 0xE4, 0x49, 0x5F, 0x7D, 0x58, 0x49, 0x44, 0xAE, 0x84, 0xDB, 0x3F, 0x27, 0xD8, 0x64, 0xD2,
+    0x99, 0xE4, 0x17, 0x48, 0xF6, 0x55, 0x67, 0xFB, 0x6C, 0x22, 0x9C, 0xA3, 0xC2, 0x42, 0xA5, 0xD6,
+    0x81, 0xE4, 0x92, 0x21, 0x37, 0x22, 0x99, 0xDE, 0xA7, 0x6C, 0xAE, 0xE4, 0x96, 0x3B, 0xBF, 0xBC,
+    0x3C, 0x97, 0xA9, 0x9D, 0x9C, 0x94, 0x02, 0x69, 0x7C, 0x44, 0x80, 0x82, 0x1C, 0xF1, 0xAF, 0x54,
+    0x84, 0x27, 0xFA, 0x42, 0x11, 0x70, 0x1D, 0x6E, 0x3C, 0x4F, 0xB6, 0x5B, 0x1B, 0xB7, 0xDB, 0xB4,
+    0xDD, 0xBC, 0x12, 0xA5, 0x8F, 0x2B, 0xD5, 0x23, 0x7C, 0x74, 0x33, 0xCA, 0xC9, 0x50, 0x46, 0x2B,
+    0x2F, 0x65, 0x2C, 0x52, 0x49, 0x73, 0xFB, 0x8C, 0x2C, 0x7B, 0xB6, 0x97, 0x56, 0x80, 0x1E, 0xD1,
+    0xCE, 0x84, 0xB6, 0xF1, 0x03, 0x2D, 0x77, 0xBD, 0x9D, 0x33, 0x1A, 0x34, 0x1A, 0x61, 0xD7, 0x65,
+    0x4B, 0x79, 0xD1, 0xD7, 0x40, 0xFD, 0xF0, 0xDF, 0x91, 0x28, 0xE6, 0x8F, 0xF1, 0x99, 0x8D, 0x34,
+    0x72, 0x72, 0xA7, 0x3D, 0xFB, 0xE3, 0x41, 0x75, 0x49, 0x4C, 0x7F, 0x71, 0xAC, 0xDD, 0x62, 0x24,
+    0xD6, 0x93, 0x3A, 0xD8, 0x59, 0xF5, 0xB0, 0x4D, 0x5B, 0x0D, 0x6B, 0x69, 0x50, 0x6A, 0xE5, 0x01,
+    0x02, 0x9B, 0x6B, 0xA2, 0xB2, 0x33, 0x5D, 0x6B, 0x15, 0x60, 0x66, 0xF5, 0x58, 0x13, 0x62, 0x72,
+    0xAB, 0xE7, 0x03, 0xBF, 0x37, 0x9B, 0xFD, 0xC9, 0x90, 0x85, 0x4D, 0x2E, 0xD9, 0x5C, 0x4C, 0xED,
+    0x68, 0x92, 0xFB, 0xBD, 0x8D, 0x6D, 0xB6, 0x14, 0x53, 0x39, 0x98, 0xCE, 0x76, 0x75, 0x33, 0x61,
+    0xAE, 0x46, 0x1B, 0x4D, 0x2F, 0xE7, 0x03, 0x16, 0x3B, 0x79, 0x54, 0x7F, 0xCA, 0x8B, 0x1E, 0xED,
+    0x37, 0xD3, 0x44, 0x3B, 0x4F, 0x2F, 0x02, 0xEA, 0x24, 0x3D, 0xCA, 0xD9, 0x90, 0x65, 0x1D, 0x48,
+    0xAE, 0xE8, 0xAB, 0x78, 0xDD, 0xA9, 0x6C, 0x2D, 0xAE, 0x12, 0xCE, 0x44, 0xD1, 0x67, 0x6A, 0xCF,
+    0xE7, 0x92, 0x94, 0xBF, 0xC6, 0xD9, 0xC1, 0x39, 0x23, 0x83, 0x97, 0xE7, 0x32, 0x19, 0xE9, 0xBC,
+    0x5A, 0xA7, 0xF2, 0x1A, 0xC6, 0x51, 0x23, 0x0D, 0x54, 0x87, 0x54, 0xA6, 0x7C, 0x4E, 0x93, 0xDC,
+    0xEB, 0xA4, 0xAD, 0xA3, 0xB2, 0x34, 0x25, 0xAC, 0x42, 0x14, 0x5A, 0x39, 0x6D, 0x54, 0xFA, 0xA4,
+    0xDA, 0x7D, 0xAF, 0x49, 0xF5, 0x73, 0xB5, 0x10, 0xDC, 0xEB, 0x49, 0x23, 0xDB, 0xF2, 0xE2, 0x93,
+    0x3D, 0xA7, 0x5C, 0x1B, 0xB0, 0x7C, 0xCD, 0xCC, 0xF6, 0x39, 0x03, 0x7C, 0xC6, 0xA4, 0xEF, 0xA1,
+    0x79, 0xD3, 0x8D, 0x27, 0xA8, 0xE6, 0x62, 0x86, 0x95, 0x7C, 0xC1, 0x5D, 0x6D, 0x3A, 0xB4, 0x81,
+    0xA5, 0xA8, 0x8F, 0x75, 0x86, 0x7C, 0xCB, 0x6C, 0xFE, 0x3B, 0x82, 0xFB, 0x87, 0x4C, 0xEE, 0x5E,
+    0x30, 0xD6, 0xFD, 0xA2, 0xA9, 0x5E, 0x32, 0x81, 0x55, 0x2A, 0x76, 0xDE, 0xD3, 0xB3, 0xCA, 0x56,
+    0xEB, 0x05, 0xEA, 0x7F, 0x87, 0x45, 0x83, 0x7B, 0x3C, 0x28, 0x2D, 0xFE, 0xCB, 0x6B, 0x71, 0xAB,
+    0x7E, 0x85, 0x3C, 0xFB, 0x40, 0xFB, 0xCE, 0x32, 0x4B, 0x7D, 0xCA, 0xEF, 0xF6, 0x5C, 0x83, 0xC3,
+    0xED, 0x43, 0x47, 0x45, 0xEE, 0xC9, 0xC4, 0x40, 0x99, 0x79, 0xCD, 0x79, 0x77, 0xEA, 0xC8, 0x26,
+    0x33, 0x03, 0x0D, 0xC8, 0x97, 0x4C, 0x29, 0xC5, 0x59, 0x95, 0xEB, 0x80, 0x5B, 0x5A, 0x45, 0x95,
+    0xD5, 0xDE, 0xB5, 0x02, 0xCD, 0x9E, 0xC5, 0xCA, 0x67, 0xBD, 0x78, 0xC5, 0xB2, 0x37, 0x03, 0xED,
+    0x5F, 0xEB, 0x5C, 0x08, 0x8A, 0x71, 0x50, 0xC6, 0x8F, 0xF5, 0xF6, 0xA4, 0xDD, 0x25, 0x59, 0x25,
+    0x69, 0x9E, 0x3C, 0x5C, 0x9F, 0x9D, 0x12, 0x0D, 0x97, 0x50, 0x3F, 0x7A, 0x3C, 0xE7, 0x9C, 0x45,
+    0x6C, 0x84, 0x92, 0x43, 0x8A, 0x1D, 0xA2, 0x5F, 0x15, 0x76, 0x7D, 0x61, 0x90, 0x1B, 0x77, 0x4C,
+    0xAC, 0x56, 0x43, 0x81, 0xD8, 0x3E, 0x5F, 0xA2, 0xED, 0x8A, 0x54, 0xE9, 0x58, 0xE3, 0x34, 0xE2,
+    0x68, 0x7A, 0x24, 0x83, 0xE6, 0x8B, 0x4E, 0xB6, 0xF3, 0x63, 0x7D, 0x18, 0xAD, 0xFD, 0x55, 0x6F,
+    0xCB, 0xCD, 0x91, 0x0E, 0x6E, 0xC5, 0x15, 0xD5, 0x93, 0x2C, 0xD8, 0xD9, 0x46, 0xC6, 0x95, 0x1C,
+    0x40, 0xF6, 0x58, 0xC2, 0xFD, 0x62, 0xC0, 0x09, 0x67, 0x4D, 0xA1, 0x66, 0x37, 0x28, 0xC6, 0xDD,
+    0x96, 0x77, 0xFE, 0x6F, 0xFB, 0x9C, 0x07, 0xED, 0x05, 0x1B, 0xAF, 0x54, 0x3A, 0xB7, 0x77, 0x08,
+    0xE0, 0xEC, 0xDD, 0x76, 0xD2, 0xEA, 0x8F, 0x8D, 0x37, 0x2F, 0x3F, 0xA3, 0x92, 0x0A, 0xEE, 0xEC,
+    0xAB, 0x1F, 0x25, 0x3C, 0xA3, 0xA0, 0x9C, 0x23, 0xB2, 0xE1, 0x40, 0x38, 0x10, 0xC4, 0x97, 0x4E,
+    0x7B, 0x4F, 0x2B, 0xDE, 0xEF, 0xA6, 0xCF, 0xD6, 0x02, 0xBC, 0xAF, 0x57, 0x78, 0xCA, 0x19, 0x91,
+    0xD8, 0x1B, 0x3E, 0xCA, 0xAB, 0x76, 0xD6, 0x7C, 0xA9, 0xE2, 0xD2, 0x5C, 0x99, 0xAE, 0x64, 0x6D,
+    0xAF, 0x2D, 0x07, 0xFC, 0xF0, 0x06, 0x7D, 0x83, 0x3B, 0x99, 0xFC, 0xCA, 0x7B, 0xC2, 0xB1, 0x23,
+    0x72, 0x3C, 0x58, 0x4E, 0x22, 0x1F, 0x36, 0xAB, 0xC0, 0x70, 0x25, 0x50, 0xB7, 0xA3, 0x62, 0xF9,
+    0x82, 0x9D, 0x22, 0xFF, 0x2C, 0xEC, 0x99, 0x54, 0xAB, 0xEF, 0xBB, 0x24, 0x15, 0x2B, 0x83, 0x4F,
+    0x59, 0x27, 0x2C, 0x3A, 0xEA, 0xD6, 0x9B, 0xB9, 0x76, 0xC8, 0xF0, 0xF6, 0x8B, 0xFA, 0x3F, 0x3D,
+    0xFF, 0x01, 0xA5, 0x55, 0xBF, 0x73, 0xDE, 0x44, 0x10, 0xDD, 0x93, 0xE2, 0x4F, 0x1E, 0x34, 0xC3,
+    0xA5, 0x80, 0x02, 0x0A, 0x2E, 0x05, 0x25, 0x63, 0x51, 0x50, 0xDA, 0x3E, 0x25, 0x2E, 0x5C, 0xA4,
+    0x71, 0x01, 0x14, 0x54, 0x29, 0x52, 0x30, 0x54, 0x94, 0x2E, 0x12, 0x4B, 0x33, 0x29, 0x52, 0x50,
+    0xE0, 0x3F, 0x21, 0x0D, 0x45, 0x92, 0x36, 0x45, 0x0A, 0x3B, 0x12, 0xB8, 0x48, 0xE1, 0x46, 0xFC,
+    0x18, 0x52, 0xA4, 0x91, 0x93, 0x49, 0x03, 0x45, 0x2E, 0x33, 0x2A, 0x84, 0x73, 0xA7, 0xE5, 0xED,
+    0x29, 0x1F, 0x36, 0x0C, 0x43, 0xC3, 0xCD, 0x78, 0x7D, 0xF6, 0xDE, 0xED, 0xEE, 0x7B, 0xFB, 0xF6,
+    0x44, 0x84, 0xB5, 0x9B, 0xF6, 0x89, 0xB3, 0x94, 0x3D, 0x77, 0xA4, 0x99, 0xC8, 0x0C, 0x44, 0x45,
+    0x4D, 0x74, 0x91, 0xE2, 0xDA, 0x51, 0xA5, 0x09, 0xA6, 0x65, 0xE6, 0x8C, 0x79, 0x30, 0x97, 0xB9,
+    0xBC, 0x91, 0x0E, 0xB4, 0x63, 0x4B, 0xC2, 0x2F, 0xB2, 0x35, 0xA5, 0xE3, 0x9B, 0x5F, 0x49, 0x67,
+    0x5F, 0x98, 0x23, 0x1C, 0x34, 0x2F, 0x79, 0xB0, 0x19, 0xFF, 0x15, 0xE3, 0xAE, 0x98, 0xC6, 0xC3,
+    0x58, 0xEE, 0x89, 0x72, 0x77, 0x88, 0xED, 0x94, 0x94, 0xC8, 0xD3, 0x61, 0x97, 0x8A, 0x87, 0x6C,
+    0x0B, 0x93, 0x8D, 0xF1, 0x28, 0x3C, 0xA4, 0x9D, 0x6C, 0x99, 0x96, 0x5B, 0x35, 0xC9, 0xF6, 0xDF,
+    0x2F, 0x54, 0x72, 0x21, 0x1F, 0xFE, 0xFB, 0x42, 0x8D, 0x22, 0xA9, 0xB8, 0x0A, 0x57, 0xCA, 0x53,
+    0xAC, 0xA5, 0x96, 0x5C, 0x75, 0x2C, 0xF1, 0x93, 0xD4, 0x69, 0x57, 0xF4, 0xA6, 0x35, 0xE5, 0xAA,
+    0x2A, 0x37, 0xF2, 0x93, 0x60, 0xBF, 0xE9, 0x1F, 0xC0, 0xF1, 0x3E, 0x25, 0x13, 0x19, 0x4F, 0xD3,
+    0xA8, 0x8F, 0x9C, 0x4F, 0xBF, 0xAF, 0x57, 0xE8, 0xAD, 0xFA, 0xD6, 0x64, 0x1A, 0xE6, 0xAB, 0xFE,
+    0xD2, 0x1A, 0xA2, 0x3C, 0xE5, 0xD0, 0x70, 0x7B, 0x81, 0xB2, 0xF6, 0xED, 0x66, 0xFB, 0x09, 0x8F,
+    0x66, 0xA2, 0x77, 0x69, 0x71, 0xC5, 0xDB, 0xA3, 0x71, 0x0D, 0x01, 0x12, 0xB7, 0xD7, 0x68, 0x76,
+    0x61, 0x37, 0x2F, 0x69, 0x27, 0xE3, 0xAD, 0xD7, 0xAF, 0x9C, 0x7F, 0x67, 0x93, 0xF6, 0x28, 0xD0,
+    0x06, 0x2D, 0x62, 0xB5, 0xA3, 0x0D, 0xBB, 0x6B, 0x0F, 0x3E, 0x78, 0xB8, 0x51, 0x79, 0xD3, 0xC7,
+    0x72, 0x54, 0xFB, 0x71, 0xEA, 0x7C, 0xFE, 0xCC, 0x9B, 0xC7, 0xCE, 0xEA, 0xF6, 0xC0, 0xD0, 0xC5,
+    0x55, 0xF9, 0xBF, 0xCB, 0x8F, 0xBA, 0x43, 0x7D, 0xDC, 0x21, 0x87, 0xED, 0xA9, 0x12, 0x82, 0x57,
+    0x57, 0xB5, 0xBE, 0xFD, 0xB3, 0xF3, 0x07, 0x46, 0xDF, 0xFA, 0xB1, 0xBF, 0x74, 0x89, 0xAE, 0x53,
+    0x33, 0x5A, 0x3E, 0xEE, 0xC2, 0x9D, 0xB4, 0x85, 0x7F, 0xFF, 0x86, 0xDE, 0x72, 0x7B, 0x79, 0xDF,
+    0xA4, 0xBD, 0x2A, 0x6D, 0x5B, 0x95, 0x3E, 0x73, 0x85, 0x1A, 0x35, 0x70, 0xAB, 0xCB, 0xC1, 0xDE,
+    0x76, 0x7B, 0x69, 0x6F, 0x09, 0xDC, 0xE5, 0x5B, 0xAF, 0xC6, 0x83, 0x4D, 0x9D, 0xD6, 0xA4, 0xCA,
+    0xA0, 0x3B, 0x6F, 0xB7, 0xBB, 0x6B, 0x6F, 0x70, 0xBC, 0x47, 0x17, 0x68, 0xCB, 0x3D, 0x8A, 0x38,
+    0x3E, 0x5C, 0x90, 0xDA, 0xD7, 0xE3, 0xC6, 0xFA, 0xFA, 0x47, 0xEB, 0xEB, 0xC5, 0xB0, 0x28, 0x93,
+    0xCB, 0x5E, 0xB7, 0xDE, 0x64, 0xDD, 0x0E, 0x1C, 0x06, 0x14, 0x6E, 0xA6, 0xAE, 0x52, 0xFB, 0x88,
+    0xD2, 0xAF, 0xE7, 0xF5, 0xA8, 0xA7, 0xAA, 0xA5, 0x95, 0xED, 0x67, 0x63, 0xB0, 0xE6, 0xF8, 0x64,
+    0x47, 0x50, 0x04, 0xD2, 0x9E, 0xD8, 0xEB, 0x9F, 0x86, 0x90, 0x9E, 0x94, 0x4A, 0x48, 0xAA, 0xD5,
+    0x4D, 0xF5, 0xF4, 0xD4, 0x5B, 0x2E, 0x63, 0x43, 0x56, 0xCA, 0x2B, 0x41, 0x57, 0xAF, 0xF9, 0xDB,
+    0xF0, 0x35, 0x84, 0x36, 0x93, 0x5C, 0x71, 0x4B, 0x9F, 0x02, 0x5B, 0xC1, 0x4F, 0xBA, 0x47, 0x33,
+    0x36, 0x69, 0x6D, 0x07, 0xB1, 0x2A, 0x4F, 0xBA, 0x23, 0x4F, 0x89, 0x48, 0xA2, 0xD8, 0x7A, 0x35,
+    0xD9, 0xC7, 0x6E, 0x5A, 0xD0, 0xFE, 0x66, 0xD6, 0x1D, 0xE6, 0x3E, 0xAA, 0x23, 0xAE, 0xE8, 0x47,
+    0x7A, 0x91, 0x8C, 0xE8, 0x22, 0x3F, 0x93, 0x08, 0x5D, 0xA3, 0x73, 0x4B, 0x43, 0xC5, 0x6D, 0x0A,
+    0xE3, 0xC8, 0x9C, 0xDE, 0x1F, 0x45, 0x40, 0x7B, 0xA4, 0x98, 0x4C, 0x49, 0x55, 0x9B, 0xD5, 0x54,
+    0x48, 0x9B, 0xB4, 0x08, 0x2E, 0x9D, 0xBE, 0x00, 0x54, 0x66, 0xE8, 0xB0, 0x61, 0xC8, 0xCC, 0x9E,
+    0x79, 0x3C, 0x58, 0xC3, 0x9D, 0xBC, 0x86, 0xC8, 0xD2, 0x9E, 0x6C, 0x87, 0x81, 0x31, 0x13, 0xE6,
+    0xA0, 0x42, 0x60, 0x60, 0x62, 0x96, 0xC2, 0x16, 0xF5, 0x75, 0xC8, 0x78, 0x68, 0x70, 0x21, 0x88,
+    0xA4, 0x1F, 0x01, 0x09, 0x2E, 0x96, 0xE7, 0xCB, 0xC1, 0x51, 0x1F, 0x2F, 0x20, 0xDE, 0x3D, 0x10,
+    0x64, 0xDB, 0xAC, 0x27, 0xE3, 0xD4, 0x40, 0x99, 0xA7, 0x5D, 0x51, 0xA8, 0x1C, 0x92, 0x2B, 0xF6,
+    0x05, 0x86, 0xCD, 0x30, 0xA4, 0x9D, 0x03, 0x01, 0xAA, 0x3B, 0xF3, 0xB4, 0x88, 0x69, 0x1C, 0x3D,
+    0xA4, 0x7C, 0xA4, 0x4D, 0x24, 0x23, 0x5B, 0x2A, 0xFE, 0x9D, 0xDB, 0x4C, 0x60, 0x0A, 0xD6, 0x61,
+    0x4E, 0x66, 0x24, 0x5B, 0x21, 0xC6, 0x9E, 0xF2, 0x7D, 0x6F, 0x15, 0x27, 0xA3, 0x4D, 0xA6, 0x64,
+    0xD8, 0x4C, 0x43, 0xD2, 0xCF, 0xB3, 0x14, 0x4D, 0x36, 0x4D, 0xA5, 0xA4, 0x91, 0x67, 0x03, 0xF5,
+    0x69, 0x97, 0x7B, 0x24, 0x40, 0x60, 0x98, 0x09, 0x14, 0xA1, 0x2C, 0xDB, 0x89, 0x69, 0xD3, 0xA0,
+    0x9A, 0x2E, 0xF5, 0x9A, 0x7D, 0xEA, 0x0D, 0xFB, 0x7C, 0x5C, 0xCE, 0x28, 0xA8, 0x57, 0x1D, 0x00,
+    0x21, 0xBD, 0x8C, 0xE5, 0x78, 0x36, 0x90, 0x71, 0xDD, 0x91, 0x2C, 0xF1, 0x1C, 0x8C, 0xE2, 0x8E,
+    0x66, 0x40, 0xC9, 0xDF, 0xC8, 0x01, 0x2F, 0xD3, 0x6C, 0x32, 0xBE, 0x1F, 0x04, 0x98, 0x17, 0x5A,
+    0xA2, 0x19, 0x05, 0xAC, 0x9B, 0xFB, 0x11, 0x13, 0x9A, 0x65, 0xB4, 0xB9, 0x51, 0xB6, 0x5B, 0x3E,
+    0x24, 0x95, 0x98, 0x46, 0x8C, 0x3C, 0x0B, 0x8A, 0x7F, 0x11, 0x22, 0xA4, 0x9F, 0x1C, 0x1F, 0x9B,
+    0x95, 0xEF, 0x50, 0x89, 0xD0, 0x0A, 0x5E, 0x6A, 0xC3, 0xF7, 0x02, 0x41, 0x1F, 0x4E, 0x8F, 0xA4,
+    0x5B, 0x5C, 0xDA, 0x40, 0x52, 0x2A, 0x63, 0xEC, 0xE6, 0xD7, 0xBB, 0x82, 0x66, 0x14, 0x4E, 0x5A,
+    0xB4, 0xE3, 0xB3, 0x99, 0x7E, 0xA9, 0xFB, 0x22, 0x54, 0xAF, 0x9C, 0x11, 0xAD, 0xDA, 0xB0, 0x60,
+    0x91, 0xC1, 0x28, 0x06, 0x72, 0x92, 0x67, 0x71, 0x6E, 0xF9, 0x57, 0x3B, 0xA2, 0xA6, 0x3A, 0x41,
+    0x3B, 0x12, 0xFE, 0x1C, 0x69, 0xC8, 0xA2, 0x36, 0xDD, 0x82, 0xD3, 0x2E, 0x13, 0xF0, 0xA0, 0x1B,
+    0xE7, 0x6B, 0x4A, 0xA4, 0xB0, 0x02, 0x39, 0x48, 0x68, 0xCB, 0x19, 0x23, 0xDC, 0xB4, 0x37, 0x01,
+    0xB0, 0xA8, 0x33, 0xAF, 0x87, 0x74, 0x4A, 0xF9, 0x25, 0x43, 0x93, 0x8C, 0x93, 0x61, 0x19, 0x3D,
+    0x6A, 0xA9, 0x4B, 0xA3, 0x90, 0x5A, 0xA1, 0x2A, 0xB2, 0x02, 0xEC, 0x09, 0xCB, 0x3B, 0x34, 0x13,
+    0x82, 0x6D, 0x26, 0xB1, 0xFB, 0x58, 0xBA, 0x1C, 0x12, 0x64, 0x80, 0x29, 0x3A, 0x33, 0x01, 0x3C,
+    0x08, 0xDF, 0x83, 0x4C, 0xED, 0x97, 0xA4, 0x4F, 0x02, 0x15, 0xCF, 0xD1, 0xF3, 0x1F, 0x46, 0x52,
+    0xE7, 0x54, 0x2B, 0x07, 0x2C, 0x6A, 0xCD, 0xA4, 0xB1, 0x61, 0x56, 0x8C, 0x44, 0x85, 0x46, 0x62,
+    0x22, 0x69, 0x89, 0xE4, 0x96, 0xD0, 0x92, 0x49, 0x12, 0xCB, 0x8F, 0xF4, 0x41, 0xDA, 0x00, 0x19,
+    0x48, 0xC3, 0x0D, 0xC0, 0xD9, 0xA5, 0x32, 0x65, 0xC4, 0xFA, 0x59, 0x2B, 0x67, 0x62, 0x88, 0xBD,
+    0x95, 0x16, 0x2A, 0x79, 0xFA, 0xA3, 0xB4, 0x62, 0x57, 0x85, 0x75, 0x49, 0x38, 0xB7, 0x5C, 0x54,
+    0x25, 0x65, 0xCC, 0x2A, 0x90, 0x24, 0x82, 0x38, 0x56, 0x12, 0x8F, 0xAB, 0xE5, 0x5F, 0x1D, 0x7C,
+    0x5A, 0x08, 0x8B, 0x9F, 0xAA, 0xC8, 0xDC, 0xBD, 0x7F, 0xCE, 0x62, 0xCC, 0xCF, 0xD1, 0x67, 0x7E,
+    0x6B, 0x24, 0x19, 0x54, 0x20, 0xB2, 0xC5, 0x67, 0x52, 0xCE, 0x16, 0xF5, 0x3C, 0x71, 0xF3, 0xC7,
+    0xC8, 0xC6, 0xD8, 0xB4, 0x97, 0xB0, 0x7C, 0x07, 0x03, 0xCA, 0x47, 0x60, 0x1F, 0x35, 0x92, 0x8C,
+    0x99, 0xCF, 0x21, 0x59, 0x97, 0x79, 0x60, 0xC9, 0xFB, 0x7C, 0x04, 0xC5, 0xBA, 0xD5, 0x83, 0x4C,
+    0x4D, 0xAD, 0x31, 0x4B, 0x1B, 0x78, 0x73, 0x30, 0x57, 0x55, 0xA0, 0xEA, 0xB4, 0x71, 0xD5, 0x20,
+    0xC3, 0xDA, 0xDA, 0x0E, 0x53, 0xF7, 0x07, 0x1E, 0x89, 0xFF, 0xBD, 0xFE, 0x04, 0xA5, 0x55, 0xBD,
+    0xAA, 0xDE, 0x46, 0x10, 0x1D, 0x49, 0xE1, 0x0A, 0x23, 0x88, 0x5C, 0xA4, 0x48, 0x15, 0x35, 0x2E,
+    0x03, 0x4A, 0x6D, 0x82, 0x57, 0xB8, 0x4D, 0x9B, 0x10, 0x70, 0xE3, 0xDA, 0x79, 0x86, 0x38, 0x52,
+    0x97, 0xF6, 0x3E, 0x84, 0x71, 0x71, 0x6F, 0x71, 0x5F, 0x20, 0xB0, 0xB2, 0x1B, 0xB7, 0x02, 0x27,
+    0x55, 0x9A, 0x85, 0x74, 0xB7, 0x89, 0x02, 0x32, 0xE8, 0xFB, 0xBC, 0xD2, 0xE4, 0x9C, 0xD9, 0xEF,
+    0xFE, 0x38, 0x6D, 0x84, 0x58, 0x21, 0xED, 0xEE, 0xEC, 0x99, 0x33, 0x67, 0x8E, 0x44, 0xD2, 0x55,
+    0x6B, 0x74, 0x3A, 0x4B, 0xA1, 0x5B, 0xAD, 0x8B, 0x48, 0xB3, 0x8A, 0x9F, 0x44, 0x8A, 0x28, 0x6D,
+    0x10, 0xC9, 0x54, 0x2A, 0x7C, 0x94, 0x7E, 0xC0, 0x07, 0x91, 0x76, 0x12, 0xE5, 0x96, 0x59, 0xFA,
+    0x11, 0x6B, 0xF6, 0x0B, 0x7F, 0x3C, 0xC7, 0x1A, 0x5E, 0x9D, 0x78, 0x3E, 0x56, 0x71, 0x21, 0xD3,
+    0x5C, 0xD3, 0x1A, 0x17, 0x2C, 0x4E, 0xB5, 0x22, 0x4E, 0xBD, 0xE4, 0xBB, 0x78, 0xC6, 0x51, 0x71,
+    0x13, 0x3E, 0xF8, 0x91, 0x67, 0x5D, 0xEB, 0xD8, 0xEB, 0x1B, 0xEC, 0x1C, 0x81, 0x42, 0x75, 0xEF,
+    0xE4, 0xFE, 0x65, 0xB1, 0xC7, 0x16, 0x43, 0x2C, 0xF4, 0xEA, 0xE8, 0x47, 0x87, 0xE0, 0x6B, 0x31,
+    0xB7, 0xA1, 0xED, 0x9E, 0x14, 0x5B, 0x3E, 0x8B, 0x38, 0x20, 0x11, 0x43, 0x27, 0xFD, 0x9F, 0xBB,
+    0x48, 0x85, 0xB5, 0x22, 0xD8, 0x31, 0xF3, 0x48, 0x65, 0x0A, 0xCD, 0xCC, 0x5B, 0x05, 0x00, 0xF0,
+    0x74, 0x13, 0x9E, 0xD8, 0x00, 0x10, 0x7E, 0x2A, 0xF7, 0x4E, 0xF5, 0x9D, 0xC6, 0x46, 0x57, 0xAF,
+    0xE3, 0xDD, 0xC1, 0x95, 0x8D, 0x8E, 0x43, 0xAE, 0xC4, 0xD4, 0xEC, 0xF6, 0x21, 0x70, 0x7C, 0xF4,
+    0x09, 0xC6, 0x57, 0x02, 0xE4, 0xD5, 0x86, 0x31, 0xB4, 0xBB, 0x94, 0x48, 0x32, 0x22, 0x7C, 0xB6,
+    0x7D, 0x29, 0x65, 0x2C, 0x40, 0x5E, 0x19, 0x6B, 0x10, 0x5A, 0xAD, 0xCD, 0x00, 0xE6, 0x16, 0x86,
+    0xAC, 0x8F, 0x84, 0xDB, 0xA8, 0x51, 0xFA, 0x71, 0xB3, 0xB8, 0x0C, 0xEF, 0x26, 0xB2, 0xEB, 0xC6,
+    0x1E, 0x2B, 0x41, 0x1E, 0xE0, 0xF8, 0x81, 0x55, 0xD0, 0x0E, 0xB0, 0x33, 0x3D, 0xAF, 0x23, 0x36,
+    0x2D, 0xA5, 0xF2, 0xC0, 0xCC, 0x50, 0xC9, 0xC3, 0x3B, 0x1C, 0xF9, 0x60, 0x8F, 0x26, 0x65, 0xD1,
+    0x4F, 0xF6, 0xF0, 0x06, 0x98, 0x85, 0xE3, 0x75, 0x26, 0xFF, 0xBD, 0xC0, 0x2E, 0xEE, 0x42, 0xB5,
+    0xD0, 0x1D, 0x47, 0x0C, 0xB8, 0xA5, 0xD8, 0x78, 0x93, 0xAA, 0x76, 0x26, 0x90, 0x02, 0xC4, 0x80,
+    0x32, 0xB7, 0x13, 0x7F, 0x49, 0x91, 0xB8, 0xD1, 0xFB, 0x11, 0xCB, 0xAB, 0x7F, 0x00, 0xB8, 0x8A,
+    0x5A, 0x21, 0x13, 0x60, 0x22, 0x3B, 0x08, 0x03, 0x64, 0x85, 0x4E, 0x2C, 0x49, 0xB3, 0x31, 0x0A,
+    0x2A, 0x8D, 0x44, 0x20, 0x17, 0xDE, 0xD2, 0x1C, 0xA4, 0x3D, 0x48, 0xA9, 0x7B, 0xA5, 0xE4, 0x6C,
+    0xA1, 0xF8, 0x78, 0x21, 0x9D, 0x2F, 0xE4, 0x1B, 0xCC, 0x77, 0xDF, 0x52, 0x61, 0x3D, 0x89, 0x27,
+    0x1D, 0xAD, 0x11, 0xFF, 0xFD, 0x7D, 0xD0, 0x95, 0xC6, 0x5A, 0xDF, 0xEB, 0x56, 0xE8, 0x0C, 0x09,
+    0xB5, 0x13, 0xC2, 0x82, 0x62, 0x3F, 0x54, 0xAC, 0x73, 0x09, 0x2D, 0x1B, 0xEF, 0xFE, 0x29, 0x11,
+    0x84, 0x48, 0x75, 0x90, 0x63, 0xDF, 0x1B, 0xE9, 0x54, 0x8B, 0x71, 0x67, 0xE5, 0x6E, 0x31, 0x3C,
+    0x64, 0x7D, 0xBE, 0x6A, 0x02, 0x03, 0x07, 0xCE, 0x86, 0x1B, 0xFE, 0xB2, 0xFB, 0xA7, 0x82, 0x24,
+    0xF4, 0x0A, 0xCB, 0xAC, 0x20, 0xA9, 0x0F, 0x27, 0xAA, 0x6A, 0xE3, 0x08, 0x2A, 0x43, 0xA1, 0xAD,
+    0x67, 0xA0, 0x71, 0x63, 0x0A, 0xE5, 0xC4, 0x21, 0xFC, 0x4A, 0x12, 0xC0, 0x01, 0xC4, 0x58, 0xAD,
+    0xA6, 0x21, 0x32, 0x94, 0x76, 0xBA, 0xDB, 0x9D, 0xF3, 0xA7, 0x3B, 0x33, 0xBD, 0xBE, 0xDA, 0x3B,
+    0xD3, 0x3F, 0x69, 0x62, 0x1B, 0x00, 0xC2, 0x9A, 0x64, 0x69, 0xA5, 0x2F, 0x12, 0x6F, 0x4F, 0x6C,
+    0x2C, 0x53, 0x81, 0x7F, 0x4E, 0x5D, 0x73, 0x42, 0x7C, 0x66, 0xEB, 0xD4, 0x28, 0x4B, 0x0D, 0xB2,
+    0x58, 0x1E, 0x5C, 0xDB, 0x7A, 0xCA, 0x25, 0x72, 0xB2, 0xFA, 0x8B, 0x93, 0x3D, 0xD8, 0x93, 0x62,
+    0xA1, 0x52, 0x1A, 0x53, 0xE0, 0xC6, 0x9D, 0xD5, 0x87, 0x1F, 0xAD, 0xB6, 0xE6, 0x10, 0x8A, 0x9D,
+    0xCD, 0x1F, 0x3F, 0x60, 0xE7, 0x6E, 0xC9, 0xCC, 0x04, 0x0E, 0x27, 0x68, 0x0F, 0x8D, 0x4E, 0x28,
+    0xA7, 0xD7, 0xEE, 0xA6, 0x9A, 0xDC, 0x62, 0xB8, 0x23, 0x3A, 0xE2, 0x92, 0x0D, 0x21, 0x91, 0xAB,
+    0x57, 0x29, 0xD7, 0x2C, 0x24, 0x53, 0x61, 0xFE, 0x52, 0xEF, 0xAF, 0x58, 0x15, 0x30, 0x82, 0x2E,
+    0x0F, 0xC8, 0xBC, 0x45, 0xFA, 0x63, 0x0D, 0x1F, 0x19, 0x41, 0x56, 0xCF, 0xC1, 0x0F, 0x58, 0xA9,
+    0x5D, 0x0B, 0xCD, 0x5F, 0xE8, 0x88, 0xB5, 0x3B, 0x03, 0x87, 0x9B, 0xBA, 0x3C, 0x43, 0x00, 0x8F,
+    0x6F, 0x35, 0xF0, 0xC9, 0x63, 0xFD, 0x8E, 0xCD, 0x8D, 0x93, 0x9A, 0x99, 0x16, 0x34, 0xB8, 0x21,
+    0xDF, 0x32, 0x70, 0xBD, 0xE0, 0xCD, 0x1D, 0x69, 0x07, 0xF0, 0xA8, 0xCA, 0x8C, 0x6A, 0x72, 0x0B,
+    0xBD, 0x88, 0x1E, 0xE5, 0x87, 0x66, 0x36, 0x7B, 0xAA, 0x67, 0x14, 0x06, 0x6F, 0xC7, 0xAB, 0x58,
+    0x22, 0xDE, 0x70, 0xFF, 0xA0, 0x53, 0x5A, 0x7B, 0x1A, 0x4A, 0xBD, 0xB4, 0x3E, 0xB1, 0xB4, 0x4E,
+    0xB9, 0x01, 0x2C, 0x5D, 0xE7, 0x26, 0x37, 0x6A, 0xDF, 0x0A, 0x9B, 0x7C, 0x83, 0x7A, 0x48, 0x76,
+    0x45, 0xF7, 0xA4, 0x22, 0x50, 0x9C, 0x81, 0x26, 0xF7, 0xFB, 0xC9, 0x0D, 0x9C, 0x59, 0xC2, 0xDD,
+    0x51, 0xE4, 0xDB, 0x9C, 0x4C, 0xFA, 0xD7, 0x5C, 0x59, 0x8F, 0x8C, 0x51, 0x32, 0x33, 0xC9, 0x57,
+    0x2A, 0x4B, 0xB6, 0xDC, 0x9C, 0x43, 0x3C, 0x6A, 0xDD, 0x0E, 0x9C, 0xAE, 0x47, 0x4E, 0x97, 0x33,
+    0xA7, 0x0B, 0x9A, 0xAE, 0x64, 0x91, 0x8A, 0x43, 0x41, 0xCD, 0x52, 0x92, 0xEE, 0x3A, 0x4E, 0x83,
+    0x1C, 0x74, 0xBD, 0xBF, 0xBE, 0x00, 0x02, 0x73, 0x71, 0xE9, 0x93, 0xE1, 0x62, 0x5D, 0x1D, 0x92,
+    0x20, 0xF2, 0xC5, 0x02, 0xFC, 0x86, 0x53, 0x5E, 0x4A, 0xCB, 0xAC, 0xA4, 0x42, 0xB0, 0x72, 0xB8,
+    0xFD, 0x7F, 0x24, 0x03, 0x01, 0xCA, 0xE6, 0x78, 0xB9, 0xB2, 0xD2, 0xBF, 0x98, 0xE9, 0x76, 0x48,
+    0x13, 0xAB, 0xD8, 0x12, 0x89, 0x93, 0x62, 0x7F, 0x76, 0x9E, 0xF8, 0x47, 0xBD, 0xE2, 0x89, 0x94,
+    0x34, 0x13, 0xE5, 0x33, 0xFB, 0xD7, 0x0C, 0xEC, 0x01, 0xAA, 0x00, 0x0D, 0xDC, 0xEC, 0x30, 0x52,
+    0xE2, 0x31, 0x26, 0x70, 0xE4, 0x99, 0x1D, 0xF9, 0x42, 0xCA, 0xCD, 0x5C, 0x66, 0xCC, 0xF9, 0xEB,
+    0xE8, 0xE0, 0x47, 0xFD, 0x9A, 0xE3, 0x13, 0x62, 0xF4, 0xC8, 0xCE, 0x3F, 0x80, 0x6A, 0x27, 0x98,
+    0x28, 0x17, 0xAF, 0x75, 0x30, 0x0F, 0x77, 0xE5, 0xD2, 0xB2, 0x19, 0xAA, 0xB7, 0x91, 0x36, 0x2C,
+    0xD9, 0x41, 0x9F, 0x8F, 0xC9, 0xFF, 0x52, 0x7D, 0xF5, 0xEF, 0x44, 0xBD, 0xFF, 0x75, 0xE9, 0xB9,
+    0xD0, 0xBF, 0x8D, 0x56, 0xC2, 0x7E, 0x54, 0xFB, 0xB7, 0xF4, 0xC1, 0x0D, 0x66, 0xCB, 0x73, 0x1D,
+    0x08, 0xB9, 0x9F, 0x4B, 0xFE, 0x5C, 0xC4, 0xCF, 0x38, 0x9A, 0x1D, 0xBD, 0x54, 0xF8, 0x09, 0xEC,
+    0xA8, 0x76, 0xA1, 0x54, 0xAC, 0x74, 0xB7, 0x8D, 0xF8, 0x53, 0x07, 0xBD, 0x99, 0x3C, 0x43, 0x71,
+    0x78, 0x0E, 0xAD, 0x20, 0xD1, 0x97, 0x28, 0xC5, 0xE7, 0x56, 0x08, 0x3A, 0x02, 0x4A, 0x91, 0x5F,
+    0xAD, 0xE6, 0x9D, 0x62, 0x0D, 0xD4, 0x6C, 0x27, 0x69, 0xB8, 0xF0, 0xB5, 0xD4, 0x6B, 0x0B, 0x82,
+    0xEA, 0xB9, 0xDC, 0x8B, 0x54, 0x21, 0x36, 0xDF, 0x01, 0xC1, 0x3B, 0xF9, 0x3F, 0xD7, 0xBF, 0xCD,
+    0x54, 0x3D, 0x8E, 0xDE, 0x36, 0x10, 0x1D, 0x4A, 0xC8, 0xAA, 0x50, 0x21, 0x97, 0x06, 0x82, 0x44,
+    0x47, 0xD0, 0x05, 0x02, 0x53, 0x88, 0x2F, 0xE0, 0xC2, 0x49, 0x91, 0x2A, 0x37, 0xD8, 0x1B, 0x44,
+    0x02, 0x5C, 0xB8, 0x48, 0xB3, 0x87, 0x58, 0x04, 0xB0, 0x5D, 0xF8, 0x06, 0xA1, 0x0C, 0x17, 0x29,
+    0xD2, 0x08, 0x70, 0x99, 0x22, 0x2A, 0x52, 0xB9, 0x09, 0x03, 0xA8, 0xD0, 0xEE, 0x52, 0x1C, 0xBF,
+    0x37, 0xFA, 0x76, 0x9D, 0x35, 0xE0, 0x22, 0x5D, 0xB4, 0x5C, 0x52, 0x1F, 0x29, 0xCE, 0xCF, 0x7B,
+    0x6F, 0x46, 0xE4, 0x78, 0x54, 0x27, 0x8C, 0x52, 0xB5, 0xD4, 0x2C, 0x4E, 0x47, 0x0C, 0x29, 0x77,
+    0x0E, 0x69, 0xA3, 0x74, 0x51, 0x64, 0xC0, 0xE9, 0x24, 0x45, 0x16, 0x9F, 0x45, 0x9A, 0xB5, 0xD2,
+    0x55, 0xC4, 0x4F, 0x21, 0x4C, 0xF8, 0xBC, 0xFE, 0x47, 0x45, 0xEA, 0xA4, 0x75, 0xC2, 0x9E, 0x46,
+    0xBF, 0xC0, 0x60, 0x16, 0xED, 0xA5, 0xD4, 0xB9, 0xC4, 0x5E, 0xBB, 0xD3, 0x8A, 0xE0, 0xDB, 0x00,
+    0xB3, 0x99, 0x43, 0xDA, 0x2B, 0xE9, 0xAE, 0xA4, 0xD2, 0x5C, 0xEB, 0x8E, 0x4B, 0x2B, 0xEE, 0x1D,
+    0xA1, 0xF4, 0xF8, 0x77, 0x7D, 0xC5, 0xD7, 0x4E, 0xBE, 0xE1, 0x92, 0x2B, 0x18, 0x94, 0x42, 0x55,
+    0x6C, 0x99, 0xED, 0xB3, 0xA7, 0xF2, 0xE9, 0xF3, 0x3F, 0xCA, 0xE1, 0x92, 0x26, 0x6A, 0xEE, 0x2D,
+    0x5D, 0x96, 0x2A, 0x4B, 0x48, 0x52, 0x26, 0xB7, 0x3F, 0x94, 0x2A, 0x95, 0x70, 0x5A, 0xA5, 0x06,
+    0x59, 0xD4, 0x5B, 0x3B, 0x32, 0x0E, 0x8F, 0x1B, 0xCD, 0x35, 0x7C, 0x48, 0xAB, 0x9C, 0xBB, 0x1B,
+    0x84, 0x2C, 0x7E, 0xC9, 0x9C, 0x67, 0x66, 0xED, 0xA7, 0x61, 0x64, 0xF8, 0x7E, 0x42, 0x04, 0x63,
+    0xC7, 0xD8, 0x7A, 0x44, 0xE3, 0xF4, 0xA2, 0x49, 0xB8, 0x84, 0x4C, 0xE8, 0xD0, 0x29, 0xB1, 0x93,
+    0x07, 0x77, 0x88, 0x78, 0x05, 0x20, 0x38, 0x57, 0xC5, 0x8D, 0xE1, 0x17, 0xA5, 0xB7, 0x69, 0x80,
+    0x8D, 0x2A, 0x32, 0x97, 0x62, 0xAB, 0x37, 0x7C, 0x95, 0x4A, 0x73, 0x27, 0x74, 0xD4, 0x8E, 0x3C,
+    0x6E, 0x66, 0xA2, 0x55, 0xC6, 0x66, 0xE3, 0x47, 0x76, 0x9C, 0xEC, 0xF8, 0x57, 0xE1, 0xB1, 0x37,
+    0x30, 0xFD, 0x88, 0xE3, 0x06, 0x90, 0xEE, 0x40, 0x60, 0x3E, 0xD3, 0x0B, 0xA7, 0x73, 0x43, 0x1C,
+    0xE6, 0x0A, 0x4C, 0xB9, 0xFB, 0xDC, 0x34, 0x60, 0x6D, 0xC8, 0x58, 0x16, 0x41, 0x8A, 0x85, 0x2E,
+    0xA4, 0x11, 0x0B, 0xF9, 0x28, 0x01, 0x15, 0x96, 0x4A, 0x63, 0xF3, 0xF7, 0x24, 0xF5, 0x1F, 0xB1,
+    0x83, 0x93, 0xE6, 0xF7, 0xF8, 0x08, 0xD9, 0x36, 0xBF, 0xAD, 0x09, 0x4B, 0xF7, 0xEC, 0x6A, 0xC3,
+    0xE2, 0x1F, 0xDF, 0x44, 0x3F, 0x8A, 0x2F, 0x75, 0x01, 0x1E, 0x3F, 0x15, 0x4A, 0x58, 0xF6, 0x42,
+    0x7B, 0x2C, 0xC9, 0x29, 0xA0, 0x71, 0x49, 0x76, 0x09, 0x7D, 0xB1, 0x21, 0xE0, 0xD0, 0x57, 0x9B,
+    0x3C, 0x41, 0x54, 0x1E, 0xB8, 0x00, 0xA4, 0x80, 0x0C, 0xBA, 0x5B, 0x86, 0x3E, 0x2F, 0x97, 0x64,
+    0x72, 0x69, 0x4D, 0x2E, 0xE4, 0xBA, 0x38, 0xB8, 0x6E, 0x56, 0x0E, 0xF1, 0xEF, 0x5F, 0x9A, 0x5C,
+    0x94, 0x6A, 0xAC, 0x31, 0x6F, 0x64, 0x0A, 0x49, 0x93, 0x12, 0x93, 0x4B, 0x02, 0xBB, 0x77, 0x8A,
+    0xFB, 0x28, 0x97, 0xFD, 0x73, 0x72, 0x39, 0xBB, 0xC4, 0x34, 0x50, 0x8A, 0xB0, 0xD6, 0x3B, 0xBD,
+    0xC6, 0xAE, 0xCE, 0x35, 0xB4, 0x37, 0x61, 0x84, 0x59, 0xBA, 0xD5, 0x47, 0xA9, 0xF6, 0x76, 0x85,
+    0xDB, 0x9F, 0x61, 0x7A, 0x78, 0x07, 0xD7, 0xED, 0x8A, 0xE3, 0x7A, 0xC7, 0x49, 0xA9, 0xD0, 0x80,
+    0xE8, 0x33, 0x6C, 0x86, 0x19, 0x9B, 0x3E, 0x76, 0x1B, 0xA6, 0x52, 0xC7, 0x61, 0x95, 0xA0, 0x30,
+    0x8C, 0x30, 0xE1, 0xE8, 0x5C, 0x2F, 0xEE, 0x89, 0x03, 0x17, 0xF1, 0xEC, 0x26, 0x12, 0x5C, 0x1B,
+    0xF2, 0x2B, 0x72, 0xB1, 0x5B, 0x96, 0xC8, 0x5C, 0xA9, 0xD2, 0x43, 0xF2, 0x63, 0xA1, 0x96, 0xBF,
+    0xD5, 0x44, 0x7F, 0xAA, 0x27, 0xD0, 0x81, 0x6D, 0xA6, 0x8A, 0xED, 0x60, 0xD0, 0x51, 0x2E, 0xD8,
+    0x06, 0x08, 0xB7, 0x37, 0x27, 0xC7, 0x9B, 0x9B, 0x40, 0xB1, 0xD0, 0x6A, 0xC5, 0xF4, 0xF4, 0x39,
+    0xE0, 0xF6, 0x64, 0x83, 0x75, 0xFC, 0xC3, 0x25, 0x39, 0xC1, 0xAB, 0x32, 0xD0, 0x9B, 0x7C, 0xCE,
+    0x3A, 0x41, 0xE1, 0xA0, 0x4C, 0xF2, 0x31, 0xD5, 0x9B, 0xC5, 0x04, 0x8B, 0x0D, 0xF5, 0xD8, 0xC6,
+    0x21, 0xF2, 0x06, 0x54, 0x80, 0xD8, 0x41, 0x47, 0x6F, 0x3E, 0x2D, 0x64, 0x86, 0x4A, 0x62, 0x31,
+    0x39, 0x5A, 0xB7, 0x6A, 0xF2, 0x56, 0x52, 0x72, 0xF6, 0xC2, 0x3A, 0xC8, 0x4C, 0x44, 0xC6, 0x5A,
+    0x5F, 0x02, 0xDE, 0xA5, 0x58, 0x51, 0xEC, 0xCD, 0x04, 0xEE, 0x1E, 0x81, 0x64, 0x79, 0xC2, 0xCC,
+    0xCD, 0x0E, 0xF3, 0x15, 0xA2, 0x6A, 0x29, 0x93, 0x08, 0x80, 0xC5, 0x2D, 0x78, 0xFC, 0xB1, 0x4B,
+    0x52, 0x4F, 0x3E, 0x7F, 0x9F, 0x69, 0x2A, 0x72, 0x22, 0x7D, 0x33, 0x9B, 0xD6, 0x9D, 0xD8, 0x81,
+    0x2B, 0xAB, 0x2E, 0x75, 0xD7, 0xFA, 0x2A, 0x79, 0xA7, 0x2E, 0xF9, 0x42, 0xDD, 0x0A, 0x37, 0x45,
+    0x7C, 0x58, 0xEE, 0x6E, 0x34, 0x99, 0x19, 0x7A, 0xC2, 0x86, 0x63, 0xD0, 0x19, 0xF2, 0xC8, 0x52,
+    0x0C, 0x5F, 0x21, 0x68, 0xA7, 0x00, 0xA8, 0x2E, 0x09, 0x7F, 0xD1, 0xF2, 0xCE, 0x29, 0x9D, 0x1C,
+    0xD5, 0x9A, 0x1A, 0x7D, 0xA7, 0x3B, 0x2A, 0xA8, 0x05, 0xC8, 0x33, 0xE0, 0x42, 0x5F, 0x09, 0x63,
+    0x4D, 0xFD, 0x56, 0x90, 0x86, 0x35, 0x9B, 0xF0, 0x2D, 0xF5, 0xB8, 0x60, 0x2A, 0x13, 0x4B, 0x39,
+    0x0C, 0xD6, 0x69, 0x4C, 0x01, 0xFD, 0x29, 0x3D, 0xE9, 0x30, 0x3D, 0x60, 0x53, 0xFA, 0xBA, 0x5D,
+    0x68, 0x78, 0xE1, 0x29, 0x7D, 0x0F, 0xF4, 0xED, 0xEE, 0x1A, 0xCA, 0x6C, 0x5E, 0xF1, 0xFA, 0x25,
+    0x4D, 0xA1, 0xC6, 0x70, 0x18, 0xA0, 0xAC, 0x8A, 0x22, 0x2A, 0xF4, 0xF5, 0x0D, 0xAA, 0xF0, 0x4D,
+    0x6E, 0xB6, 0x36, 0x76, 0xF3, 0xF0, 0x76, 0x47, 0x04, 0xA8, 0x5F, 0xFC, 0xBD, 0x4D, 0xD5, 0x56,
+    0xE1, 0x75, 0xE8, 0xF5, 0xF1, 0x5E, 0xC7, 0x2E, 0x76, 0xAB, 0xB6, 0x89, 0xB4, 0xB3, 0xF8, 0x94,
+    0xAD, 0xEE, 0x9C, 0xEE, 0x0C, 0x97, 0xC2, 0x3C, 0x98, 0x42, 0xBE, 0xF8, 0xEE, 0xE9, 0xBF, 0xDA,
+    0xD9, 0xAC, 0x6C, 0x74, 0x13, 0x50, 0x40, 0x7D, 0x00, 0x15, 0xB0, 0x82, 0x08, 0x80, 0x2F, 0x83,
+    0xD1, 0xE7, 0xC6, 0xDF, 0x9F, 0x86, 0x18, 0x45, 0x20, 0x6D, 0x96, 0x5B, 0x22, 0xA5, 0xB5, 0xD9,
+    0xDB, 0x4E, 0xB6, 0xE4, 0x37, 0xEB, 0x87, 0xD1, 0x3A, 0xDA, 0x44, 0x9C, 0x03, 0x71, 0x87, 0x12,
+    0x58, 0xA7, 0x74, 0x35, 0x7A, 0x7D, 0xA3, 0xDA, 0x7F, 0x2C, 0x17, 0x22, 0x8F, 0x96, 0x4E, 0xF5,
+    0x0D, 0xCB, 0xA9, 0x5F, 0x34, 0xD6, 0x28, 0xDC, 0x51, 0x2E, 0xA4, 0x2C, 0x8C, 0xA7, 0x76, 0x61,
+    0x3D, 0xE1, 0xB6, 0x19, 0x04, 0x2B, 0x97, 0xFA, 0xE8, 0x16, 0x6C, 0x13, 0xC7, 0x4D, 0x7F, 0x77,
+    0x33, 0xDE, 0xBF, 0xE9, 0xF4, 0xFD, 0xEB, 0xDC, 0x5B, 0x9F, 0xD1, 0xA3, 0x44, 0x8F, 0xC6, 0x65,
+    0xA8, 0x4B, 0x4B, 0xCA, 0xC4, 0x6D, 0xF6, 0xA3, 0xB3, 0x08, 0x8B, 0xE3, 0xFC, 0x2B, 0xF9, 0x4F,
+    0xCF, 0x07, 0x95, 0x55, 0xB1, 0x8E, 0xE5, 0x44, 0x10, 0x6C, 0xDB, 0xF7, 0xCE, 0x81, 0x03, 0x13,
+    0x10, 0x91, 0x98, 0x0F, 0x40, 0x1A, 0x02, 0xF2, 0x19, 0xB1, 0x21, 0xC9, 0x06, 0xB7, 0x11, 0x01,
+    0x39, 0xC9, 0xFB, 0x02, 0x34, 0x3E, 0xF1, 0x01, 0x6C, 0x00, 0x24, 0x04, 0x24, 0x90, 0x40, 0xB0,
+    0xFC, 0x00, 0xEB, 0xD1, 0xDD, 0x0F, 0x58, 0x10, 0x10, 0x62, 0xB8, 0x25, 0x81, 0xE0, 0x46, 0x60,
+    0xE9, 0xBC, 0x6F, 0xC7, 0x6E, 0xAA, 0xFC, 0xBC, 0x70, 0x2B, 0xC1, 0x22, 0x2C, 0xF9, 0x8D, 0xFC,
+    0x3C, 0x3D, 0x5D, 0x5D, 0x55, 0xDD, 0x16, 0xC1, 0x55, 0x6B, 0xF2, 0xFA, 0x4C, 0x67, 0xA3, 0xB1,
+    0x99, 0x32, 0xED, 0x8B, 0x24, 0x66, 0xC8, 0x54, 0xEA, 0x51, 0xBA, 0xF6, 0xAF, 0x87, 0x49, 0xBA,
+    0x90, 0xAB, 0xD8, 0x41, 0xBA, 0xEB, 0xFD, 0x88, 0x20, 0x4D, 0x22, 0xAA, 0x2A, 0x92, 0x7D, 0xD9,
+    0xB5, 0x38, 0x06, 0x6F, 0x84, 0x31, 0x22, 0x25, 0xDE, 0x08, 0x62, 0xF8, 0xD3, 0xE3, 0x91, 0x9B,
+    0x0A, 0x55, 0x6E, 0xDA, 0xAE, 0x5A, 0x47, 0x5D, 0xAC, 0x86, 0x82, 0xA9, 0x1B, 0x1D, 0xA4, 0x19,
+    0x8B, 0x45, 0xB0, 0x03, 0xE9, 0x90, 0x23, 0x30, 0xDA, 0x86, 0x3A, 0x8A, 0xF8, 0xB6, 0x89, 0x3C,
+    0xCF, 0xF4, 0xD5, 0x94, 0x2F, 0x88, 0x8C, 0xC5, 0x2C, 0xEA, 0x5E, 0xDE, 0xE8, 0x43, 0x83, 0x8D,
+    0x5D, 0xDB, 0x0C, 0xD5, 0x04, 0x18, 0x7D, 0x35, 0xE6, 0xF3, 0xBD, 0x1B, 0xCD, 0xB6, 0xB1, 0x1E,
+    0xB1, 0x45, 0x9A, 0xC3, 0xD7, 0xCB, 0x57, 0x7A, 0x2E, 0x5E, 0x79, 0xCD, 0x62, 0xD7, 0x55, 0xE5,
+    0x3E, 0xB4, 0xD3, 0xBF, 0xA3, 0x1D, 0xEE, 0xA0, 0x1D, 0xEF, 0x01, 0x51, 0xDE, 0xA2, 0x5D, 0xFE,
+    0x37, 0xDA, 0x8F, 0x37, 0xB4, 0x7A, 0x8B, 0x36, 0x6C, 0x48, 0x87, 0xE3, 0x5A, 0xC6, 0xE3, 0x9A,
+    0xA5, 0xAD, 0x84, 0x0F, 0xB6, 0xD5, 0x6C, 0x6B, 0xB9, 0x89, 0x81, 0xF0, 0x98, 0x21, 0xDE, 0x55,
+    0x07, 0x48, 0x65, 0x09, 0x25, 0x41, 0xC3, 0x62, 0x00, 0x86, 0x87, 0x42, 0x12, 0x88, 0x52, 0xCC,
+    0xE1, 0x9C, 0x62, 0x4F, 0x94, 0x31, 0x49, 0x13, 0xCD, 0x88, 0x52, 0x4D, 0x04, 0xCF, 0x3E, 0xD4,
+    0x2C, 0x00, 0xE5, 0x8F, 0xC0, 0xDC, 0x85, 0x66, 0xB9, 0x98, 0xB1, 0x49, 0xFB, 0x46, 0xF5, 0x4A,
+    0xEE, 0x5E, 0xF8, 0x97, 0x37, 0x5E, 0xF3, 0x1C, 0xD4, 0xD8, 0xE2, 0x0E, 0xAC, 0x59, 0xD6, 0xD2,
+    0x22, 0x79, 0x20, 0x89, 0xB8, 0x83, 0x50, 0xC4, 0x23, 0x35, 0x42, 0xF7, 0x89, 0xFD, 0xD5, 0x81,
+    0x05, 0x44, 0x10, 0xB1, 0x48, 0xB5, 0xE8, 0x6A, 0x0C, 0xDB, 0xDB, 0xC1, 0xA0, 0x6C, 0x12, 0xB6,
+    0x12, 0x98, 0xE9, 0xF1, 0xB0, 0x32, 0xDD, 0xF2, 0xD7, 0x21, 0xC7, 0x8C, 0xBF, 0x17, 0xD2, 0xD7,
+    0x4D, 0xCD, 0x4C, 0x4B, 0xEA, 0x89, 0x2E, 0x2C, 0xFF, 0xDC, 0xE8, 0xF8, 0x0F, 0x38, 0x8B, 0xD5,
+    0xD9, 0xF4, 0x2C, 0xE1, 0xAD, 0xD8, 0x56, 0x60, 0x44, 0x75, 0x74, 0xB9, 0x05, 0x27, 0x00, 0x33,
+    0x4A, 0x45, 0x62, 0x6C, 0x0F, 0x4E, 0xD8, 0x1E, 0xD8, 0x0E, 0x2B, 0x46, 0x20, 0xEF, 0xDA, 0x55,
+    0x55, 0x70, 0x72, 0xB8, 0x48, 0xCC, 0xD8, 0x22, 0xDD, 0x26, 0x90, 0x64, 0xEF, 0xBB, 0xB5, 0x14,
+    0x36, 0xD2, 0x28, 0xF6, 0x93, 0x2E, 0x0A, 0x02, 0x87, 0x12, 0x0C, 0x85, 0xFA, 0xD8, 0x3C, 0xE5,
+    0x96, 0x6A, 0x77, 0xE6, 0x7B, 0xEA, 0xED, 0x32, 0xDA, 0x33, 0x3B, 0xDB, 0x13, 0x0B, 0x15, 0x2F,
+    0xE7, 0x2C, 0x88, 0x8D, 0xA6, 0xCD, 0xD5, 0xA9, 0x33, 0x13, 0x79, 0x6F, 0x4B, 0x9E, 0x97, 0x2B,
+    0x63, 0x5F, 0xBD, 0x2D, 0xE8, 0xB5, 0x73, 0x2A, 0x1D, 0x4B, 0x54, 0x8C, 0x75, 0xB0, 0xF4, 0x4B,
+    0x09, 0x07, 0x1F, 0x90, 0xBF, 0x48, 0x85, 0x3A, 0x0B, 0xC9, 0x53, 0x95, 0xC8, 0x73, 0x49, 0xFD,
+    0xEB, 0x24, 0xD5, 0x64, 0xA2, 0xF0, 0xAF, 0x11, 0x8D, 0xCD, 0xF5, 0xBA, 0xEB, 0xD7, 0x95, 0xC1,
+    0x58, 0x1B, 0xAE, 0x35, 0xA7, 0x03, 0xE8, 0xAD, 0x49, 0x00, 0xD6, 0x06, 0xA5, 0x04, 0xAC, 0x08,
+    0xF5, 0x81, 0xA8, 0x7B, 0xB0, 0x60, 0x23, 0xD1, 0x76, 0xCE, 0x4E, 0x25, 0x45, 0x3F, 0x5F, 0x47,
+    0x47, 0xA3, 0x63, 0x49, 0x36, 0x00, 0x4B, 0xBA, 0xC5, 0x1D, 0x39, 0x71, 0x7F, 0x6B, 0xB0, 0xE7,
+    0xF1, 0xC8, 0xB1, 0x20, 0xE2, 0x17, 0xC8, 0x50, 0x4F, 0xD4, 0xA1, 0x63, 0x97, 0x81, 0x5A, 0xCF,
+    0x94, 0x34, 0x87, 0x89, 0xD4, 0xC2, 0x47, 0xD8, 0x55, 0xBA, 0xB5, 0x69, 0xBD, 0xD2, 0xB0, 0x4B,
+    0x07, 0xA2, 0xAB, 0x08, 0x43, 0x88, 0x5D, 0xFD, 0x35, 0xD1, 0x46, 0x36, 0x40, 0xC2, 0xCF, 0xE6,
+    0x9C, 0x06, 0x18, 0x9A, 0x6B, 0x69, 0x96, 0x92, 0x0D, 0xDF, 0x63, 0xF2, 0xC9, 0x2B, 0x9B, 0x2E,
+    0xA7, 0x3B, 0xBC, 0xDC, 0x07, 0x82, 0x2B, 0x17, 0x1F, 0x41, 0x4F, 0xC2, 0xFE, 0x85, 0xFE, 0x72,
+    0xBE, 0xB5, 0xC1, 0xA0, 0x2D, 0xEB, 0x48, 0x38, 0xD0, 0x47, 0xC9, 0xDD, 0xD3, 0xE7, 0xBF, 0x7D,
+    0xA4, 0x7F, 0xE8, 0xCF, 0x1A, 0x41, 0xED, 0xD0, 0xF4, 0xF2, 0x52, 0x19, 0xF2, 0x86, 0x10, 0x35,
+    0x04, 0x49, 0x94, 0xDB, 0xAD, 0xB5, 0x9A, 0xAB, 0xAD, 0x43, 0xE9, 0x2C, 0xF3, 0xF8, 0x54, 0x8A,
+    0xDF, 0xE1, 0xB8, 0x4B, 0xC0, 0xAF, 0x75, 0x8F, 0x09, 0xDC, 0xFA, 0x60, 0x98, 0x18, 0xD0, 0x82,
+    0x0D, 0x05, 0x2B, 0xF7, 0x8E, 0x03, 0x06, 0xE6, 0x5E, 0x68, 0x78, 0x0C, 0xE2, 0x0B, 0x8E, 0x60,
+    0x88, 0x6C, 0x40, 0x82, 0x3C, 0x58, 0x53, 0x9D, 0xE1, 0x49, 0x1D, 0xA7, 0xAD, 0x7F, 0x3B, 0x15,
+    0xB1, 0x8C, 0xD6, 0xD9, 0xC7, 0xA9, 0x4C, 0xD5, 0x8D, 0xF6, 0x90, 0xBC, 0x5F, 0x9C, 0x7F, 0x0A,
+    0x8F, 0xD6, 0x43, 0x31, 0xF1, 0xDC, 0xEE, 0x87, 0x99, 0x4E, 0xCF, 0xC8, 0x17, 0x9D, 0xB2, 0x3B,
+    0x05, 0xE9, 0xCE, 0x6B, 0xB4, 0x9F, 0xCE, 0x35, 0x12, 0xB2, 0xD9, 0x3C, 0xC4, 0x19, 0x72, 0xB6,
+    0xAC, 0x43, 0xF7, 0x20, 0xF9, 0x5B, 0xBE, 0xF5, 0xCD, 0x01, 0xBD, 0x03, 0xBF, 0x21, 0x33, 0x49,
+    0x7B, 0xF8, 0x05, 0x49, 0x6F, 0x51, 0xDD, 0x90, 0x0F, 0x68, 0x02, 0xC7, 0x71, 0xC5, 0xCE, 0x2C,
+    0x8E, 0x77, 0x85, 0xD2, 0xBD, 0xA2, 0x2D, 0x2F, 0x12, 0xC9, 0x64, 0x15, 0x0D, 0xBA, 0xC4, 0x84,
+    0x12, 0x30, 0xAA, 0x91, 0x75, 0xE1, 0x1E, 0xC8, 0x2C, 0x3C, 0xE4, 0xCC, 0xCD, 0x82, 0xCA, 0x38,
+    0x69, 0xFA, 0xCD, 0xC1, 0x8F, 0xC0, 0x20, 0xE6, 0x8D, 0x86, 0xE6, 0x3B, 0x94, 0xD5, 0x84, 0x05,
+    0x62, 0x86, 0x2E, 0xC7, 0x09, 0xF6, 0x79, 0x2C, 0xD8, 0x3D, 0x57, 0xD0, 0x57, 0xBE, 0x81, 0xBA,
+    0x39, 0x40, 0x60, 0x5A, 0x8B, 0x9F, 0x8E, 0xD8, 0x76, 0x92, 0xC9, 0xCE, 0x55, 0x73, 0x3E, 0x96,
+    0x4B, 0x81, 0xCA, 0x72, 0x8D, 0x9D, 0x9E, 0x44, 0xBF, 0xD4, 0x27, 0xD3, 0x65, 0x1D, 0xDC, 0xA9,
+    0xF9, 0xFC, 0x7B, 0x08, 0x91, 0xDF, 0xA4, 0x4B, 0x4A, 0xA1, 0x3F, 0x06, 0x39, 0x8E, 0x38, 0x78,
+    0x65, 0xBF, 0xB6, 0xD8, 0xB3, 0x99, 0x0F, 0xC9, 0xBE, 0x17, 0x5E, 0x7F, 0xD3, 0x96, 0x3F, 0x2D,
+    0xCD, 0x3B, 0xDA, 0x7F, 0x5B, 0x43, 0x6A, 0x60, 0x50, 0x5A, 0x80, 0x9F, 0x82, 0x07, 0xB7, 0x4D,
+    0xFD, 0x08, 0xD1, 0x98, 0x83, 0x1A, 0xC0, 0x61, 0xD1, 0xD6, 0xFD, 0x3A, 0x80, 0xBD, 0xE3, 0x67,
+    0xD0, 0x82, 0xBF, 0x77, 0x39, 0xC6, 0xC2, 0x39, 0x8A, 0x17, 0xFF, 0xE1, 0xBC, 0x8F, 0x16, 0x99,
+    0xBA, 0xF9, 0x08, 0xF5, 0x54, 0x76, 0xD8, 0x06, 0x2E, 0x60, 0xB5, 0x6C, 0xDF, 0x37, 0x43, 0x46,
+    0xDF, 0x19, 0x1A, 0x20, 0xAD, 0x06, 0xF0, 0x6D, 0x45, 0xB3, 0x2B, 0x3F, 0xC6, 0x83, 0x8D, 0xD9,
+    0x5C, 0xE9, 0x03, 0xF3, 0xE4, 0xC5, 0x8B, 0x27, 0x9A, 0xBA, 0x64, 0x14, 0xBD, 0x85, 0x01, 0xD3,
+    0xDE, 0x31, 0xDF, 0x7F, 0x5E, 0x7F, 0x02, 0xAD, 0x54, 0xB1, 0x8E, 0x1D, 0x35, 0x14, 0xBD, 0x33,
+    0xF3, 0x36, 0x93, 0x30, 0x12, 0x4E, 0xB1, 0x8A, 0x90, 0x10, 0x72, 0x03, 0x12, 0x34, 0xF8, 0x0B,
+    0x58, 0xCF, 0x66, 0x91, 0x42, 0xC7, 0x16, 0x49, 0xB5, 0xC5, 0xFE, 0x01, 0xFB, 0x03, 0x91, 0x3C,
+    0x90, 0x92, 0x02, 0x7A, 0x0A, 0x28, 0x49, 0x0A, 0x42, 0x49, 0x11, 0x65, 0xBC, 0xD9, 0x62, 0x0B,
+    0x8A, 0x58, 0xA1, 0x88, 0x04, 0x05, 0x83, 0x88, 0xA0, 0xA0, 0x78, 0x06, 0x46, 0xDA, 0x09, 0xD8,
+    0x73, 0x39, 0x77, 0xDE, 0x06, 0x90, 0xE8, 0x80, 0xF7, 0x76, 0xBC, 0xE3, 0x67, 0xFB, 0xFA, 0xDC,
+    0x73, 0xCF, 0xB9, 0x44, 0x9B, 0x4F, 0x47, 0x4D, 0xF7, 0x12, 0x51, 0xAA, 0x3C, 0xA9, 0x1F, 0x26,
+    0x22, 0x9E, 0x89, 0x8A, 0xFB, 0xE7, 0x8B, 0xFB, 0xB4, 0x55, 0x70, 0x50, 0xD1, 0xCE, 0xC4, 0xC5,
+    0x51, 0xD0, 0x43, 0x91, 0xCA, 0x4C, 0xC6, 0x5B, 0x5F, 0xA5, 0x2A, 0x91, 0x6B, 0x5D, 0xD7, 0x44,
+    0x35, 0x62, 0x91, 0x49, 0x0D, 0x36, 0x16, 0xB9, 0xE1, 0x95, 0x79, 0x70, 0x76, 0xF6, 0x80, 0x53,
+    0x9F, 0x0C, 0xD7, 0x4C, 0xDC, 0xD9, 0x8E, 0x5A, 0x09, 0x76, 0x9D, 0xB6, 0x6B, 0xEE, 0xDC, 0x09,
+    0x0F, 0x7D, 0x3C, 0x18, 0xFB, 0xA9, 0x48, 0xAE, 0x25, 0x67, 0x89, 0xCC, 0x5D, 0x22, 0xB5, 0xF6,
+    0x54, 0x71, 0xA4, 0x82, 0x33, 0x51, 0x6F, 0x3C, 0xD9, 0xD3, 0xF1, 0xB2, 0x8A, 0xFC, 0x7A, 0x3D,
+    0x69, 0xBE, 0x9A, 0x2B, 0xF6, 0x4C, 0xAE, 0x03, 0xB4, 0x05, 0xD7, 0x8D, 0x7D, 0x9C, 0x62, 0x39,
+    0x81, 0xDD, 0xE6, 0x63, 0x1C, 0x9B, 0xAC, 0xA7, 0xC6, 0x03, 0xFB, 0x4E, 0x3D, 0x52, 0x31, 0x22,
+    0x80, 0x7A, 0x36, 0x2B, 0x37, 0x33, 0xA6, 0xD7, 0xEE, 0x57, 0xE9, 0x73, 0x8E, 0x8A, 0x4F, 0xB8,
+    0xB5, 0x59, 0x60, 0x23, 0x20, 0x5D, 0x46, 0x50, 0xE4, 0xD9, 0x52, 0x9F, 0xC8, 0xE2, 0x37, 0x40,
+    0x8E, 0xA4, 0xB8, 0xE4, 0x81, 0x54, 0xBF, 0xB7, 0x0E, 0xA4, 0x8E, 0xDE, 0x7F, 0xE8, 0x49, 0x1F,
+    0x7E, 0x70, 0x88, 0x51, 0xAF, 0x11, 0xCC, 0xE8, 0x6C, 0x3A, 0xDA, 0x51, 0xC9, 0xB6, 0xF4, 0x86,
+    0x1A, 0x31, 0xDE, 0x03, 0x47, 0x17, 0x5F, 0x4E, 0x6A, 0x70, 0x37, 0xED, 0xA8, 0xBC, 0x4B, 0x36,
+    0x62, 0x8C, 0xD6, 0x5F, 0x22, 0xDB, 0xAD, 0x70, 0xCB, 0x4A, 0xF2, 0x47, 0x76, 0x43, 0x33, 0x5A,
+    0xA6, 0x7E, 0xF7, 0x68, 0x50, 0xB1, 0x00, 0xAB, 0xA4, 0xC1, 0x6A, 0x29, 0xAC, 0x5A, 0x66, 0x5F,
+    0x31, 0x83, 0xD5, 0x3B, 0x7D, 0xD7, 0x8C, 0x00, 0x8E, 0x7D, 0xA4, 0xA2, 0xFA, 0xE5, 0x18, 0xFB,
+    0x92, 0x09, 0x8A, 0xF7, 0x12, 0xF5, 0x1F, 0x22, 0x58, 0xBB, 0xB0, 0x49, 0x8E, 0xA9, 0x01, 0xDC,
+    0xFE, 0x9B, 0x5C, 0x4F, 0x4D, 0xB2, 0x5E, 0xFF, 0x3C, 0x93, 0xFD, 0x12, 0xE7, 0xAC, 0xAF, 0x27,
+    0x26, 0xF3, 0x55, 0x22, 0x56, 0xB1, 0x9E, 0x6C, 0x70, 0xBE, 0xFF, 0x09, 0x13, 0x30, 0xD6, 0xA3,
+    0xC4, 0xDB, 0xCB, 0xF1, 0x7D, 0x80, 0xE9, 0x83, 0x9D, 0x2D, 0x2A, 0xBB, 0xE6, 0x58, 0x70, 0x04,
+    0x18, 0x64, 0x50, 0x72, 0x01, 0x30, 0x83, 0x39, 0x2F, 0x71, 0x87, 0x12, 0x8F, 0x8D, 0x80, 0xE1,
+    0x7F, 0x82, 0xE9, 0x36, 0x60, 0x8A, 0xFD, 0xAD, 0xB6, 0xE4, 0x63, 0xEE, 0x14, 0x1F, 0x72, 0x7B,
+    0x65, 0x86, 0x86, 0x6A, 0xBE, 0x36, 0x91, 0x19, 0xF5, 0x40, 0xEC, 0x5D, 0x57, 0x25, 0xE4, 0xAA,
+    0x91, 0x3B, 0x24, 0x63, 0x7D, 0x29, 0x33, 0xC4, 0x8A, 0xE0, 0xA6, 0xEF, 0x0A, 0x5E, 0x4F, 0x92,
+    0x47, 0x47, 0x76, 0x3D, 0x12, 0xCD, 0x60, 0xAA, 0x06, 0x48, 0x32, 0x01, 0x03, 0xE3, 0x69, 0xF8,
+    0x13, 0x5A, 0xB0, 0x97, 0x77, 0x6E, 0xD3, 0x46, 0x48, 0x25, 0x87, 0x9A, 0x53, 0xCD, 0x73, 0x95,
+    0xEA, 0x32, 0xE1, 0x10, 0x34, 0xD3, 0x12, 0x24, 0x80, 0x98, 0x00, 0x8D, 0x63, 0xAF, 0xDA, 0xE8,
+    0x14, 0xF3, 0x2E, 0x73, 0xAB, 0xE7, 0xA5, 0xC8, 0x92, 0x32, 0xED, 0xD7, 0x7C, 0x75, 0xAE, 0xB8,
+    0xE2, 0xEF, 0xF9, 0x94, 0xFD, 0xC1, 0x19, 0x9F, 0xF1, 0x58, 0xF0, 0x77, 0xFC, 0x08, 0x99, 0xC6,
+    0x7E, 0x00, 0x69, 0xD1, 0xA2, 0x6A, 0x6A, 0x54, 0x51, 0x0F, 0x08, 0x9E, 0x9A, 0xB1, 0x98, 0xCB,
+    0x8C, 0x98, 0x7D, 0xCB, 0xB8, 0xC6, 0x42, 0xFA, 0xAE, 0x95, 0x45, 0xF3, 0xF8, 0xDA, 0x04, 0x62,
+    0xF8, 0x51, 0x46, 0xF5, 0x84, 0xBB, 0x99, 0x9C, 0x20, 0xDE, 0x28, 0x14, 0x37, 0x51, 0x93, 0xAB,
+    0x4C, 0x9A, 0xCB, 0x99, 0xAE, 0x88, 0x3F, 0x10, 0x01, 0x40, 0xDC, 0x2E, 0x14, 0x6B, 0xDF, 0x05,
+    0x46, 0xFB, 0x1E, 0xB2, 0xB4, 0xB7, 0x90, 0xB2, 0x39, 0x8D, 0x18, 0x1E, 0xE2, 0xB4, 0xFE, 0x16,
+    0x8C, 0x6A, 0x49, 0x5A, 0x67, 0x19, 0x84, 0x07, 0x8D, 0x45, 0x49, 0x0D, 0x67, 0x89, 0x2E, 0x16,
+    0x22, 0xF8, 0xBB, 0x38, 0x64, 0x41, 0x08, 0xC1, 0x97, 0xE0, 0x67, 0xD8, 0x98, 0x15, 0x2A, 0xC6,
+    0x5A, 0xA2, 0x8D, 0x87, 0xCB, 0x0C, 0x13, 0x57, 0xF1, 0x85, 0xF3, 0x75, 0x15, 0xCE, 0x07, 0x90,
+    0x06, 0xD7, 0x31, 0xA3, 0xCE, 0xFD, 0x1A, 0xB2, 0x31, 0xB7, 0x32, 0xB4, 0xBB, 0x3B, 0x9B, 0x60,
+    0x5B, 0x08, 0xC7, 0x8A, 0x7A, 0x1C, 0xCD, 0x18, 0x8A, 0x6C, 0x3D, 0x1C, 0x63, 0x43, 0x6E, 0x26,
+    0x1D, 0xB3, 0x89, 0x28, 0x12, 0xFB, 0x92, 0x25, 0xFA, 0x8B, 0x0C, 0x1D, 0x96, 0x02, 0xAF, 0x1A,
+    0x65, 0x00, 0xC6, 0xE7, 0xE5, 0x1E, 0x31, 0xE5, 0x26, 0x81, 0xFA, 0x89, 0x60, 0xDA, 0x82, 0xB1,
+    0xF4, 0x58, 0xCD, 0x35, 0xFC, 0x3B, 0xB8, 0x6C, 0x40, 0xC8, 0x8F, 0xD8, 0xC6, 0x93, 0x00, 0x91,
+    0xBC, 0x82, 0x20, 0x95, 0x17, 0x44, 0x50, 0xF8, 0xA5, 0xFC, 0x7D, 0xA2, 0x57, 0xEE, 0xA3, 0xBF,
+    0xF0, 0x03, 0x9E, 0x5C, 0xD4, 0x8B, 0xCC, 0xC2, 0xEA, 0x3F, 0x75, 0xA3, 0x5F, 0x1F, 0x3D, 0xEB,
+    0x46, 0x1D, 0x77, 0x3B, 0x5F, 0x40, 0xB1, 0x4A, 0x84, 0x2B, 0x4C, 0x29, 0xC0, 0x2D, 0x47, 0x31,
+    0x26, 0x26, 0xCF, 0xB5, 0x62, 0x8D, 0x0B, 0x68, 0x0E, 0x27, 0x8C, 0xE8, 0x07, 0xB1, 0x89, 0xA5,
+    0x04, 0x9E, 0xA5, 0xF0, 0x50, 0x2A, 0xDC, 0x1D, 0xAA, 0x19, 0xDD, 0xA1, 0x87, 0x4B, 0x2F, 0x3C,
+    0x11, 0xEE, 0xD1, 0xC1, 0xC8, 0x3C, 0x46, 0x40, 0x0E, 0x68, 0x46, 0xC8, 0x4C, 0x34, 0x50, 0x2C,
+    0x58, 0x57, 0xB4, 0xAD, 0x53, 0x91, 0xAB, 0xC9, 0x42, 0x3E, 0x4D, 0xBC, 0x82, 0x37, 0x58, 0x3E,
+    0x55, 0x23, 0x2C, 0x96, 0xEA, 0xA8, 0x42, 0x35, 0x35, 0x51, 0xFB, 0x1A, 0x73, 0xEB, 0xF1, 0x16,
+    0x6C, 0x87, 0xD4, 0x3C, 0xAE, 0x09, 0xFD, 0x31, 0x54, 0x7B, 0xCC, 0x7B, 0xFC, 0xA6, 0x39, 0xE5,
+    0xB7, 0xDD, 0x67, 0x86, 0xDD, 0x6C, 0xB3, 0x99, 0xED, 0x64, 0x27, 0x05, 0x4F, 0xE9, 0xF0, 0xA7,
+    0xCC, 0xFE, 0x8F, 0x5B, 0xDE, 0x5A, 0x6E, 0x79, 0xE7, 0x6F, 0xB7, 0x24, 0xB9, 0xC5, 0xDC, 0x5C,
+    0x6E, 0xB9, 0xB7, 0x70, 0x9F, 0xFE, 0x1A, 0x8B, 0x65, 0x54, 0x22, 0x4B, 0xBA, 0xD0, 0x15, 0xD7,
+    0xA9, 0x85, 0x30, 0x06, 0x83, 0xC7, 0xDE, 0x70, 0xED, 0x0E, 0x36, 0xD9, 0x3A, 0xD2, 0x25, 0xFD,
+    0x35, 0x1C, 0x09, 0xB2, 0x60, 0x6F, 0xE0, 0x49, 0x30, 0x3D, 0x1E, 0xF9, 0x56, 0x53, 0x31, 0x1F,
+    0xC5, 0xC5, 0xD1, 0x66, 0xDE, 0x34, 0x90, 0xEB, 0xB4, 0xF4, 0x46, 0x2A, 0x93, 0x28, 0xDA, 0x1E,
+    0x1F, 0x81, 0xCD, 0x24, 0xC6, 0x76, 0x9D, 0xF4, 0xF5, 0xB1, 0x7A, 0xFA, 0x29, 0x3C, 0xED, 0x18,
+    0xB6, 0x6C, 0x66, 0x46, 0x0B, 0x9A, 0x8B, 0xAC, 0x83, 0x1A, 0x14, 0x7C, 0x9B, 0x09, 0x3A, 0x55,
+    0xC1, 0x9C, 0xA4, 0xC8, 0x07, 0xA3, 0xE3, 0x86, 0x33, 0xD4, 0x06, 0xD3, 0xDB, 0x81, 0x56, 0xE7,
+    0xFD, 0x42, 0x62, 0x23, 0x32, 0x44, 0x43, 0x12, 0x15, 0x31, 0xAB, 0xA7, 0xB7, 0x11, 0x6F, 0x42,
+    0xB4, 0x80, 0x68, 0x6A, 0x68, 0x86, 0x8C, 0x7F, 0x41, 0x07, 0xFE, 0x68, 0x6A, 0xA0, 0x70, 0xCD,
+    0xED, 0x72, 0x5A, 0x4C, 0x85, 0x6A, 0x6B, 0x3C, 0xF3, 0xE1, 0x54, 0x79, 0x15, 0x57, 0x8B, 0x19,
+    0xA5, 0xF5, 0xA6, 0x25, 0xBF, 0x3B, 0xBD, 0xA7, 0x22, 0x97, 0x6D, 0x13, 0x0D, 0xE0, 0xF2, 0x41,
+    0x42, 0x13, 0xEF, 0x4A, 0x1E, 0x9F, 0x35, 0x1D, 0xFC, 0xB9, 0x89, 0x1C, 0xBA, 0x0E, 0x0C, 0x94,
+    0xB7, 0xFA, 0xAE, 0x5F, 0xA3, 0xFF, 0xD5, 0x28, 0x53, 0x3D, 0x5A, 0x6F, 0xBC, 0x39, 0xCE, 0xE8,
+    0xF3, 0xCC, 0xA2, 0x35, 0x70, 0x82, 0xDE, 0xF2, 0xDB, 0x22, 0xB7, 0xBD, 0x09, 0x65, 0x4D, 0xD2,
+    0x26, 0x51, 0xB0, 0xC0, 0x10, 0x77, 0xCF, 0x23, 0xF4, 0x8E, 0x8E, 0x86, 0x0A, 0xF3, 0x62, 0xFA,
+    0xCB, 0xF4, 0xAF, 0x3F, 0x7F, 0x00, 0x9D, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0x7B, 0xEF,
+    0x30, 0xC2, 0x42, 0x9B, 0x22, 0x39, 0x09, 0x28, 0xB6, 0x49, 0x03, 0x02, 0x2D, 0x65, 0x1A, 0xD8,
+    0x4D, 0x84, 0x44, 0x49, 0x8A, 0x5C, 0x85, 0x10, 0x12, 0x1D, 0xD5, 0x35, 0x94, 0x28, 0xF6, 0x25,
+    0x05, 0x45, 0x1A, 0x0A, 0x3A, 0x1A, 0x8A, 0x14, 0xE8, 0x6B, 0x72, 0x3F, 0x20, 0xC4, 0xE6, 0x28,
+    0x28, 0xAE, 0x88, 0x09, 0x42, 0x29, 0x52, 0x60, 0x10, 0x34, 0x5C, 0x91, 0x8D, 0x64, 0x14, 0xE7,
+    0xB2, 0xBB, 0xC3, 0x9B, 0xCF, 0xDF, 0x97, 0x1F, 0x80, 0xEF, 0xD6, 0xBE, 0xB3, 0xD7, 0x33, 0x6F,
+    0xDE, 0xBC, 0x37, 0x26, 0xBA, 0xB0, 0x4F, 0x05, 0x73, 0x5F, 0x32, 0x8F, 0x45, 0xFE, 0x70, 0x22,
+    0x2E, 0x23, 0x39, 0xCF, 0xA4, 0x07, 0xE7, 0x55, 0x32, 0x3D, 0x75, 0x1C, 0xA8, 0xE6, 0x48, 0x6A,
+    0xCA, 0x54, 0xCE, 0xEE, 0x83, 0xCF, 0xA2, 0x79, 0x74, 0x90, 0x6A, 0xBE, 0x9F, 0x4B, 0x7E, 0x90,
+    0xA8, 0x69, 0x77, 0xA8, 0xA0, 0xE5, 0x38, 0x22, 0x32, 0x2D, 0x15, 0x89, 0x48, 0x07, 0x22, 0xD7,
+    0x13, 0xDD, 0x25, 0x2A, 0xFC, 0xFA, 0xD9, 0xAE, 0x47, 0x14, 0x5F, 0x71, 0x2C, 0x92, 0xED, 0x5D,
+    0x11, 0xF5, 0xE8, 0xDA, 0x58, 0x07, 0x7B, 0x1C, 0x55, 0x66, 0x72, 0xEC, 0x55, 0xF6, 0xE4, 0xDA,
+    0x5A, 0xC5, 0x2A, 0x58, 0xCE, 0xC4, 0xB2, 0xB9, 0x7D, 0x11, 0xFA, 0x7A, 0xDD, 0xAB, 0xD8, 0x79,
+    0xFD, 0x67, 0xA4, 0x77, 0x54, 0x4B, 0xDB, 0xE3, 0x02, 0x49, 0x54, 0x14, 0x40, 0xE6, 0x41, 0x24,
+    0xBC, 0x2A, 0x61, 0x5D, 0x19, 0xCB, 0x68, 0x7B, 0xFD, 0x3C, 0x4A, 0x5C, 0xE2, 0xAF, 0x49, 0xCD,
+    0x74, 0xA4, 0x83, 0xE9, 0x25, 0xB0, 0xE3, 0x81, 0x9A, 0x99, 0x68, 0x47, 0x40, 0x11, 0x55, 0xDC,
+    0x93, 0xC6, 0xDA, 0xED, 0x00, 0xB7, 0x39, 0xF4, 0x86, 0x79, 0xC0, 0xEA, 0x29, 0x03, 0x7A, 0x2A,
+    0x3C, 0x22, 0x05, 0x15, 0x79, 0x56, 0xCF, 0x39, 0x2A, 0xFE, 0x29, 0x56, 0xAC, 0x62, 0x9D, 0x54,
+    0xD4, 0x33, 0xD6, 0xA4, 0xA2, 0xC1, 0x53, 0x3B, 0xAA, 0xD9, 0x0D, 0xD5, 0xE4, 0xFA, 0x3A, 0xB8,
+    0x5E, 0x87, 0xC6, 0x9B, 0x91, 0xC8, 0x22, 0xA0, 0x6B, 0x0B, 0x62, 0xAA, 0x80, 0x4D, 0xF3, 0xB4,
+    0xCE, 0x53, 0x3E, 0x13, 0xDC, 0x52, 0x16, 0xB8, 0x01, 0xBD, 0x2A, 0x12, 0x75, 0x20, 0x0C, 0x9B,
+    0xC3, 0x8B, 0xB2, 0xD0, 0x93, 0x0E, 0xD4, 0x72, 0xD0, 0x7F, 0x77, 0x3E, 0x54, 0x13, 0x11, 0xEA,
+    0x68, 0x02, 0xD9, 0x99, 0x6C, 0x22, 0x9D, 0x48, 0x01, 0x5D, 0xD3, 0xBE, 0x5A, 0xCD, 0x55, 0x68,
+    0x4E, 0x93, 0x02, 0x59, 0xF5, 0x96, 0xAC, 0x7D, 0x6C, 0x8E, 0xE8, 0xDA, 0x68, 0xCF, 0x52, 0x35,
+    0x97, 0x2D, 0x76, 0x9A, 0x81, 0xD0, 0x5F, 0x54, 0x1E, 0x54, 0xDA, 0x07, 0x26, 0x49, 0xFA, 0xAE,
+    0x1B, 0xEC, 0x0D, 0x46, 0x06, 0x6C, 0x76, 0xE8, 0xD8, 0x39, 0x79, 0xF7, 0x1A, 0xB4, 0x30, 0x23,
+    0x6F, 0x6F, 0x7E, 0x03, 0x85, 0xA5, 0x77, 0xF2, 0x62, 0x0B, 0xDC, 0xA8, 0x44, 0x70, 0x8E, 0xF8,
+    0xB7, 0x08, 0x1A, 0x45, 0xB2, 0xE2, 0x3B, 0x83, 0x95, 0xCD, 0x69, 0xA1, 0x52, 0x4A, 0xD0, 0x53,
+    0x95, 0x50, 0xEE, 0x6B, 0x52, 0xA0, 0xB7, 0xB3, 0xE3, 0xDD, 0xAE, 0x35, 0x43, 0x0D, 0x86, 0xC0,
+    0x66, 0xE7, 0x41, 0xCD, 0x58, 0x4D, 0x65, 0xFA, 0xA2, 0x4B, 0x36, 0x63, 0xE7, 0x3A, 0xA5, 0x55,
+    0x7F, 0x24, 0x77, 0x12, 0xF2, 0x2B, 0xE5, 0xB8, 0xD4, 0x7E, 0x1E, 0x55, 0x2A, 0x0E, 0x78, 0x15,
+    0x42, 0xAA, 0x83, 0xC8, 0x28, 0x53, 0x3D, 0x2D, 0x57, 0x50, 0x61, 0x1F, 0xFA, 0x2E, 0x95, 0x3C,
+    0x22, 0x40, 0xF1, 0x82, 0xB0, 0x7B, 0x04, 0x64, 0x44, 0x0A, 0xAB, 0x04, 0x20, 0xFA, 0x6E, 0xB9,
+    0x5D, 0x5C, 0x05, 0xE8, 0x80, 0xA2, 0x40, 0xED, 0xA7, 0x61, 0x91, 0xA5, 0xAC, 0x75, 0x7B, 0x86,
+    0x4D, 0x8B, 0xD6, 0x6D, 0x12, 0x3A, 0xB1, 0x17, 0x5A, 0x45, 0x08, 0x59, 0xA2, 0x62, 0x58, 0x41,
+    0xA8, 0xBA, 0x88, 0xEC, 0xD7, 0x0F, 0x46, 0x70, 0xDA, 0x83, 0x1B, 0xA2, 0x37, 0xFE, 0x5A, 0x9A,
+    0x24, 0xC2, 0xAE, 0xA1, 0x26, 0xBC, 0x8F, 0x27, 0x00, 0x21, 0x21, 0x8A, 0xD9, 0xE1, 0x7E, 0x19,
+    0x1A, 0xDC, 0x50, 0x63, 0xF7, 0x96, 0xA7, 0x6A, 0x00, 0xCD, 0x60, 0x87, 0x1F, 0xCF, 0xA4, 0x0F,
+    0x23, 0x02, 0xDA, 0x2B, 0xB1, 0x00, 0xEB, 0x22, 0xD3, 0x37, 0xEF, 0x95, 0x51, 0x4D, 0x2E, 0x96,
+    0xF9, 0x20, 0x38, 0xB8, 0x8F, 0x7B, 0x70, 0x6E, 0xD3, 0x1A, 0xBC, 0x97, 0x86, 0xE0, 0xCA, 0x23,
+    0xF0, 0x3A, 0x46, 0x61, 0xC5, 0xC1, 0x08, 0xB8, 0x45, 0x16, 0xD1, 0x98, 0x01, 0xA8, 0xCB, 0x58,
+    0xFD, 0xFB, 0x3D, 0x9E, 0x31, 0x4F, 0x10, 0x41, 0xE6, 0xBE, 0x59, 0xE5, 0x22, 0xD5, 0x93, 0x1E,
+    0xF4, 0xC0, 0x94, 0x28, 0xE9, 0xA0, 0x07, 0xFB, 0x23, 0xEC, 0xF4, 0xF1, 0x64, 0x87, 0x8A, 0x21,
+    0x5C, 0x32, 0x59, 0xA2, 0x6F, 0xE4, 0xBF, 0xA6, 0x06, 0x12, 0xA0, 0x3D, 0xA9, 0x1B, 0xFA, 0xAF,
+    0x10, 0x0A, 0x7E, 0x8A, 0xE2, 0x19, 0x21, 0xC1, 0x53, 0x07, 0xA6, 0xDD, 0x09, 0xF7, 0xFA, 0x14,
+    0xFA, 0x81, 0x03, 0x0A, 0xEE, 0xD1, 0xCD, 0xA1, 0xF1, 0x6E, 0x84, 0xC9, 0x26, 0x1D, 0xAA, 0xA8,
+    0xE6, 0x12, 0x69, 0x21, 0xD2, 0xEE, 0x13, 0xD7, 0x3B, 0xFE, 0x08, 0xAA, 0xFA, 0x0A, 0x51, 0xFC,
+    0x46, 0x1A, 0xE8, 0x02, 0xBD, 0x4F, 0x0B, 0xDD, 0x7A, 0x5C, 0x5A, 0x50, 0xE1, 0x5A, 0x48, 0xCB,
+    0xCF, 0x6D, 0x9D, 0xBC, 0x2B, 0x85, 0x06, 0x9E, 0x6D, 0xDC, 0x83, 0x3E, 0xA8, 0x81, 0x6A, 0xCD,
+    0xFD, 0x9E, 0xEA, 0x53, 0x98, 0xE4, 0xF9, 0x06, 0x65, 0x83, 0x98, 0xF6, 0x04, 0x6C, 0x3E, 0x49,
+    0x3B, 0x2A, 0xBA, 0x93, 0xC3, 0x5C, 0xF1, 0xD0, 0x79, 0x86, 0x22, 0xA5, 0xA7, 0xE4, 0x37, 0x7A,
+    0x78, 0x9B, 0x96, 0x0C, 0xEB, 0x8E, 0x0A, 0x5B, 0xEB, 0xBC, 0x64, 0xB7, 0x68, 0x96, 0xE2, 0xAF,
+    0x1A, 0x60, 0x56, 0x3C, 0xEA, 0xB0, 0x97, 0x8A, 0x0C, 0x37, 0xDA, 0xA1, 0x94, 0xFE, 0xA0, 0x86,
+    0xBE, 0x9A, 0xAA, 0x19, 0xC6, 0x64, 0x8F, 0xB9, 0x11, 0x28, 0x43, 0x59, 0x66, 0xE8, 0xC2, 0x95,
+    0x68, 0x9B, 0x2F, 0x2D, 0x9F, 0xF0, 0x31, 0x87, 0x26, 0x60, 0x06, 0xCC, 0x1B, 0xF1, 0x6F, 0x8E,
+    0x8B, 0xE8, 0x0B, 0x5D, 0x82, 0x20, 0x08, 0x9E, 0x75, 0x8F, 0x80, 0xDA, 0x8A, 0x34, 0x5E, 0x7A,
+    0xB6, 0xDD, 0x70, 0x15, 0x3F, 0x18, 0x1F, 0x89, 0x0C, 0x97, 0x19, 0xA4, 0x17, 0x2C, 0x18, 0xC5,
+    0xCD, 0x97, 0xD1, 0x74, 0x77, 0x08, 0xA8, 0xEE, 0x06, 0x98, 0x77, 0x37, 0x11, 0xC0, 0xFE, 0x2C,
+    0x01, 0xEE, 0x43, 0x61, 0xE6, 0x77, 0x48, 0xCB, 0x48, 0x8B, 0x8C, 0x68, 0xC3, 0xCC, 0x72, 0x92,
+    0x79, 0x21, 0xEA, 0x25, 0x68, 0xED, 0x65, 0xD1, 0xAB, 0xBD, 0x33, 0x6D, 0xB4, 0xE8, 0xA4, 0xC7,
+    0xF5, 0xB8, 0x64, 0x04, 0xB1, 0x03, 0x3C, 0x0B, 0x11, 0x14, 0x07, 0x83, 0x19, 0x8B, 0x08, 0x25,
+    0x61, 0x06, 0x63, 0xA0, 0xA2, 0xD6, 0xC6, 0x37, 0x6D, 0x1D, 0x34, 0xA4, 0x07, 0x28, 0x98, 0x9E,
+    0x01, 0xF2, 0xE1, 0x1D, 0x7B, 0xFC, 0xF4, 0xE9, 0x31, 0xC7, 0x2E, 0x5A, 0xAE, 0x98, 0xF8, 0x16,
+    0xA4, 0x76, 0x39, 0x6C, 0x08, 0x54, 0x12, 0xF6, 0x07, 0x5A, 0x5C, 0xB3, 0x66, 0xF3, 0xF5, 0xD5,
+    0x6D, 0x54, 0x21, 0x4E, 0xE8, 0xE6, 0x85, 0x73, 0x4C, 0x50, 0xF4, 0x05, 0x27, 0x75, 0xD6, 0xFD,
+    0x13, 0xF5, 0x71, 0x56, 0xE3, 0x7B, 0x50, 0xA5, 0x3F, 0x72, 0xFD, 0xA5, 0xC5, 0x62, 0x55, 0xFE,
+    0x46, 0xC8, 0x01, 0x4E, 0xEC, 0xF2, 0x98, 0xFA, 0xC8, 0x8E, 0xF1, 0x44, 0x0D, 0x24, 0x05, 0x66,
+    0xDC, 0x20, 0x90, 0x50, 0x9E, 0x9E, 0x4B, 0x5E, 0x71, 0x8B, 0x58, 0x98, 0x0A, 0xBC, 0xE5, 0xF1,
+    0x3C, 0xF2, 0x42, 0x2E, 0x98, 0xD9, 0x2E, 0x3B, 0xF1, 0xC5, 0x63, 0x1E, 0x71, 0xE3, 0x09, 0x48,
+    0x30, 0x11, 0x53, 0xB5, 0xC4, 0x67, 0xEC, 0x73, 0x72, 0xA3, 0xC3, 0xD0, 0xC6, 0xD8, 0x86, 0x5A,
+    0xDB, 0x86, 0xB8, 0x9E, 0xEA, 0x50, 0x07, 0x46, 0x5B, 0xB3, 0xC6, 0x1F, 0xE6, 0x17, 0xE8, 0xF8,
+    0xDB, 0xD9, 0x0E, 0x8A, 0xC5, 0x51, 0x5A, 0xF4, 0x2A, 0xB2, 0x40, 0xBF, 0x6E, 0x0B, 0xAB, 0x3C,
+    0x2D, 0xE0, 0x0A, 0x3E, 0x83, 0x4B, 0xB8, 0xAF, 0xC1, 0x60, 0x8F, 0x5F, 0x64, 0x35, 0x93, 0x1B,
+    0x09, 0x9F, 0x47, 0xD9, 0x71, 0x2B, 0xAF, 0x56, 0xDD, 0xAF, 0x2C, 0x1E, 0x94, 0x53, 0x72, 0x32,
+    0x25, 0x35, 0x88, 0xE0, 0x9B, 0xD2, 0xD7, 0x01, 0xEF, 0xB8, 0x60, 0x31, 0xC0, 0xE0, 0x1E, 0xDF,
+    0x4C, 0x20, 0x0A, 0x81, 0x6B, 0x99, 0x09, 0x74, 0x80, 0x6F, 0xD3, 0xD6, 0x01, 0xD7, 0x24, 0xA3,
+    0xDC, 0xA7, 0xEE, 0x21, 0x06, 0x37, 0xD4, 0xDD, 0x43, 0xE5, 0x70, 0x5E, 0x5E, 0x31, 0x0C, 0x3E,
+    0x33, 0x92, 0xCC, 0xC4, 0x18, 0xA1, 0xB3, 0xE8, 0xB3, 0x3B, 0x8D, 0x32, 0x2D, 0xD6, 0x8C, 0x9F,
+    0xA7, 0xFF, 0x7B, 0xFC, 0x07, 0x95, 0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0x9E, 0xB5, 0xEF, 0x61,
+    0x21, 0x0B, 0x9C, 0x22, 0x22, 0x08, 0x09, 0xCC, 0x0F, 0x40, 0x5A, 0x7E, 0x40, 0xC4, 0x5A, 0x0A,
+    0x52, 0x0A, 0x9A, 0x2B, 0x52, 0xA5, 0xB9, 0x1A, 0x9A, 0x13, 0x1D, 0x05, 0xB0, 0x46, 0x14, 0x94,
+    0x5C, 0x45, 0x41, 0x13, 0x8A, 0x34, 0x24, 0xC5, 0x35, 0x29, 0xE1, 0xBC, 0xB9, 0x2B, 0x68, 0x2D,
+    0x5D, 0x7A, 0x8C, 0x82, 0xA0, 0xCC, 0x46, 0x32, 0x3A, 0xBF, 0xBB, 0xF5, 0x0E, 0xDF, 0xAC, 0xDF,
+    0xBB, 0xBB, 0xD0, 0x61, 0xBD, 0x37, 0xCF, 0xCF, 0xDE, 0x9D, 0xF9, 0xE6, 0x9B, 0x6F, 0x66, 0x89,
+    0x88, 0x5E, 0x6B, 0x99, 0x9D, 0xE2, 0x13, 0x8E, 0x54, 0xB3, 0xE2, 0x96, 0x38, 0xE4, 0x33, 0x95,
+    0xEB, 0xBE, 0x9A, 0xC8, 0x36, 0xA4, 0x87, 0x3C, 0x10, 0x59, 0x57, 0x39, 0x22, 0xA6, 0x23, 0xA2,
+    0x3C, 0xE4, 0x9E, 0xA8, 0xF2, 0xBA, 0x25, 0xD2, 0x3D, 0xDE, 0x91, 0xBD, 0x3B, 0x10, 0xA9, 0x68,
+    0x70, 0x9B, 0xAF, 0x27, 0xD8, 0xEA, 0x02, 0x8B, 0xC9, 0x44, 0x18, 0xEA, 0xB0, 0x98, 0xC4, 0xAD,
+    0xEC, 0x94, 0x07, 0xD5, 0x40, 0x97, 0xD7, 0x3D, 0x52, 0x8D, 0x1D, 0xC9, 0x9E, 0xF0, 0x90, 0xF3,
+    0xAA, 0x73, 0x26, 0x28, 0xCE, 0x02, 0x16, 0x22, 0x5A, 0xE5, 0x67, 0xF8, 0xF8, 0x0D, 0xAB, 0x19,
+    0x9E, 0xF3, 0x73, 0x09, 0x2A, 0x6E, 0x8C, 0x78, 0xE1, 0x1E, 0x8F, 0x18, 0x37, 0xA5, 0xB8, 0xAF,
+    0x5B, 0xBA, 0x76, 0x35, 0x12, 0xB0, 0x29, 0xE4, 0x56, 0xD3, 0x6D, 0xF9, 0x89, 0x85, 0xC4, 0xCC,
+    0x58, 0x36, 0xE0, 0xA7, 0xDF, 0xC4, 0xFE, 0xEF, 0x05, 0x1E, 0xF0, 0xC9, 0x99, 0x73, 0x70, 0x01,
+    0xC8, 0x82, 0x1A, 0x54, 0xE0, 0x43, 0xB5, 0x27, 0xED, 0x85, 0x86, 0x9C, 0x1D, 0x65, 0x31, 0xE5,
+    0x56, 0x8D, 0x05, 0x8F, 0xC0, 0xE3, 0xBA, 0xCE, 0x61, 0x79, 0xF9, 0x12, 0xEE, 0xCB, 0xC0, 0x25,
+    0xF0, 0x19, 0xF6, 0x46, 0x80, 0x47, 0xE2, 0x06, 0x38, 0x7B, 0xC9, 0xBC, 0x9E, 0xC5, 0x0B, 0x61,
+    0x6D, 0x07, 0xB7, 0x51, 0x3E, 0x54, 0xAF, 0x49, 0xCF, 0x4D, 0xC1, 0xB1, 0x04, 0x36, 0xC3, 0xA3,
+    0xE1, 0x44, 0xD1, 0x96, 0x23, 0x93, 0xAC, 0x5A, 0x9E, 0x15, 0x0B, 0x6C, 0xBD, 0x60, 0xFD, 0xE2,
+    0x0A, 0x76, 0x4B, 0x65, 0xFB, 0x2E, 0x51, 0xC8, 0xC1, 0xD9, 0x5F, 0x53, 0x8A, 0x4A, 0xEA, 0x68,
+    0xF3, 0x72, 0x97, 0x56, 0x8A, 0xFB, 0xCA, 0x03, 0x30, 0xAB, 0xFD, 0xBE, 0x1E, 0x54, 0xC8, 0x66,
+    0xD2, 0xCE, 0x38, 0xD4, 0x31, 0xA0, 0xC0, 0xB6, 0x2D, 0x7D, 0x35, 0xE2, 0x25, 0x23, 0xAA, 0xF1,
+    0x6A, 0x2E, 0xE3, 0xDB, 0xFA, 0xF8, 0xEC, 0xEF, 0x63, 0x0E, 0x5D, 0xD0, 0x5C, 0x80, 0x93, 0xD6,
+    0x8C, 0x20, 0x55, 0x02, 0xE7, 0x82, 0xE1, 0x17, 0x61, 0x5C, 0x88, 0xEC, 0x5F, 0xE1, 0xAE, 0x47,
+    0xA2, 0xBC, 0x29, 0xB5, 0xE4, 0x9B, 0x1D, 0x9E, 0x1F, 0xA0, 0x62, 0x20, 0xE0, 0x56, 0xBC, 0x27,
+    0x6C, 0x49, 0x42, 0x78, 0xA4, 0x18, 0xAC, 0x21, 0xDF, 0x89, 0x4C, 0xAF, 0x11, 0x98, 0x8C, 0x28,
+    0xAC, 0x6B, 0x6B, 0x0F, 0x5E, 0xBB, 0xB6, 0xF2, 0xE0, 0xBB, 0x73, 0xF5, 0xF9, 0x61, 0x28, 0x98,
+    0x11, 0x9B, 0x79, 0x2B, 0x98, 0x4F, 0x11, 0xC1, 0x65, 0xEC, 0xE9, 0x16, 0xDC, 0x23, 0x49, 0x0B,
+    0xE6, 0x80, 0x9B, 0xDB, 0x62, 0x24, 0xA8, 0x06, 0xAE, 0xC8, 0xFC, 0x78, 0x50, 0x83, 0xCD, 0xC8,
+    0xA7, 0x53, 0x3E, 0x45, 0x3A, 0x32, 0x8D, 0xF9, 0xBE, 0xAF, 0x4F, 0xE3, 0xFE, 0xD0, 0xF1, 0x50,
+    0x00, 0xE3, 0x8E, 0x38, 0xBA, 0xFF, 0x10, 0x3C, 0x0A, 0x62, 0x16, 0x2C, 0x17, 0x71, 0x5F, 0x24,
+    0x57, 0xCC, 0x54, 0x04, 0x40, 0x28, 0x82, 0x8A, 0x54, 0x4E, 0xB8, 0xAB, 0xFE, 0x79, 0x1E, 0x20,
+    0xC3, 0xB3, 0x09, 0x85, 0x83, 0x8C, 0xF5, 0x05, 0x52, 0x33, 0xC2, 0xAE, 0x39, 0xDF, 0x97, 0xBA,
+    0x57, 0x22, 0x08, 0x38, 0xEC, 0x44, 0x7E, 0x92, 0xB6, 0x12, 0x69, 0xD5, 0x9C, 0x04, 0x20, 0x45,
+    0x53, 0xBB, 0xAB, 0x26, 0xE3, 0xA7, 0xDC, 0x56, 0xBC, 0xC7, 0xCD, 0x5B, 0x11, 0x7B, 0x0B, 0xBE,
+    0x3B, 0x91, 0x1E, 0xA1, 0x04, 0x76, 0xB6, 0xCD, 0x25, 0x56, 0x3D, 0x94, 0x68, 0x81, 0x8F, 0xB5,
+    0xCB, 0xC2, 0x13, 0x04, 0x7D, 0x79, 0xE6, 0xC9, 0x7C, 0xCB, 0x8D, 0xE2, 0x07, 0x41, 0x78, 0x72,
+    0x64, 0x5E, 0x20, 0x66, 0xDC, 0xB9, 0x4D, 0xC5, 0x44, 0x4F, 0xD0, 0x73, 0xAA, 0xA5, 0x24, 0x7D,
+    0xFE, 0x29, 0x69, 0x96, 0xB2, 0x47, 0x3F, 0x6F, 0x18, 0x4A, 0xD9, 0xD5, 0x97, 0xD2, 0xF9, 0x5A,
+    0xCC, 0x0C, 0x30, 0x40, 0x93, 0x4C, 0xC1, 0x8F, 0x1E, 0x26, 0x3D, 0x23, 0xCB, 0xAD, 0x29, 0x53,
+    0xC7, 0x4A, 0x75, 0xAA, 0xD4, 0x4B, 0x62, 0x44, 0xEB, 0x24, 0x0A, 0x46, 0x8D, 0xC4, 0x48, 0x3B,
+    0x5B, 0x31, 0x9D, 0xBB, 0x4C, 0xF5, 0xD9, 0x2B, 0xA9, 0xA6, 0xAB, 0xC4, 0x5B, 0x19, 0x0B, 0x08,
+    0xAE, 0x26, 0x94, 0xDE, 0x75, 0x1C, 0xD4, 0xE1, 0x7A, 0x71, 0xC0, 0x8B, 0x2C, 0x44, 0xDA, 0x18,
+    0x2B, 0x10, 0x61, 0x8A, 0x87, 0x37, 0x9F, 0x47, 0x92, 0xA2, 0x56, 0x50, 0x0A, 0xF4, 0xB0, 0xE4,
+    0xB0, 0xC8, 0x9F, 0x41, 0x58, 0x32, 0x05, 0x3F, 0x4E, 0x7D, 0x18, 0x04, 0x72, 0x32, 0x93, 0xE0,
+    0x1E, 0xAE, 0x70, 0x43, 0x7B, 0x1E, 0xCB, 0x44, 0x2B, 0xFF, 0x0B, 0xF7, 0x6A, 0x97, 0x2C, 0x37,
+    0xD8, 0x6C, 0x7F, 0x98, 0xDF, 0x00, 0xB0, 0x1B, 0xDA, 0xBD, 0x07, 0x41, 0xF2, 0x90, 0xC9, 0x24,
+    0xE8, 0xF3, 0xF9, 0x4B, 0x15, 0x57, 0x37, 0x6D, 0xAB, 0xEB, 0xF3, 0xEE, 0x04, 0x19, 0xE9, 0xD8,
+    0xD0, 0x8D, 0x6B, 0x00, 0xE7, 0x2D, 0xB1, 0x8F, 0x45, 0x43, 0x4A, 0xB0, 0xA9, 0x49, 0x8C, 0xBF,
+    0x4E, 0xEC, 0x85, 0xF4, 0xBA, 0x08, 0x4E, 0x0B, 0x4C, 0x33, 0xD4, 0x22, 0x7E, 0x0C, 0x0A, 0xE3,
+    0x90, 0x8A, 0x15, 0xD3, 0xB5, 0x30, 0xDC, 0x60, 0x23, 0x1F, 0x94, 0x53, 0xCD, 0x23, 0x5A, 0x96,
+    0x7D, 0xAA, 0x88, 0xEE, 0x97, 0x2C, 0xF2, 0x6F, 0x58, 0x46, 0x60, 0x90, 0xCA, 0xE3, 0x79, 0x16,
+    0x9B, 0x2D, 0x88, 0xA7, 0xD0, 0x31, 0xD9, 0x36, 0xA8, 0x39, 0xF3, 0xA5, 0x2F, 0x1B, 0xC9, 0x3B,
+    0xDE, 0x04, 0xA8, 0x28, 0x01, 0x89, 0x8B, 0x28, 0xCD, 0x0E, 0x9D, 0x79, 0xDB, 0xE8, 0x63, 0x04,
+    0xAB, 0x86, 0x6C, 0x5B, 0x0A, 0x50, 0x37, 0xD1, 0xA8, 0x5D, 0x81, 0x54, 0x2A, 0x88, 0xA9, 0xFC,
+    0x33, 0x9D, 0x09, 0x4B, 0xBF, 0xA1, 0x27, 0x64, 0x86, 0xA1, 0xE9, 0x9C, 0xB0, 0x04, 0x99, 0x4E,
+    0x28, 0x1C, 0x20, 0xEC, 0x58, 0xEA, 0xA8, 0x7B, 0x1D, 0x50, 0x7A, 0xE3, 0xAC, 0x2C, 0x9E, 0x30,
+    0x3D, 0x12, 0x9C, 0x62, 0xD4, 0x02, 0xAC, 0x3C, 0x0E, 0x69, 0x2C, 0xAB, 0x35, 0xEF, 0xB9, 0x65,
+    0x42, 0x2C, 0x8D, 0xCC, 0x2F, 0x16, 0xC1, 0x74, 0xDF, 0x8D, 0x56, 0x16, 0x76, 0xC7, 0x21, 0xA5,
+    0x69, 0x1D, 0xA7, 0x03, 0xC2, 0x0E, 0xA6, 0xB5, 0xD8, 0x69, 0x7D, 0x35, 0x08, 0x7B, 0xD6, 0x17,
+    0x63, 0xC6, 0x72, 0x90, 0x20, 0x34, 0x6A, 0xCB, 0x23, 0xD2, 0x2F, 0x91, 0x99, 0xCF, 0x31, 0x43,
+    0xBA, 0x21, 0xCD, 0x7B, 0x2A, 0x46, 0xBA, 0x3E, 0x2C, 0x37, 0xDA, 0xBF, 0x9A, 0x97, 0x98, 0x91,
+    0xCB, 0x6F, 0x06, 0x30, 0x2B, 0x52, 0xB4, 0x6A, 0xCA, 0x39, 0x1B, 0xC1, 0x0C, 0x46, 0x35, 0xE4,
+    0xD7, 0xF1, 0x1D, 0x6F, 0x63, 0x75, 0x67, 0x3A, 0xAA, 0x5C, 0xB3, 0xAB, 0x1F, 0x9C, 0x0A, 0xC3,
+    0x17, 0x41, 0xC6, 0xA8, 0xE6, 0xDF, 0x5D, 0x12, 0x98, 0xB8, 0x36, 0xFB, 0xE0, 0x88, 0x8A, 0xE7,
+    0xB3, 0xFC, 0x09, 0x66, 0xCF, 0xBD, 0xFF, 0xA1, 0x29, 0xFE, 0x88, 0xF5, 0x27, 0xDC, 0xFF, 0x5A,
+    0xB1, 0xE7, 0xA9, 0xC2, 0x19, 0x02, 0xDA, 0xA6, 0x7C, 0xED, 0x77, 0xAE, 0xE2, 0xCB, 0x91, 0x79,
+    0x39, 0xD0, 0x8B, 0xF4, 0x67, 0x39, 0x0D, 0xE9, 0x1D, 0x7C, 0x3F, 0x6B, 0x50, 0xD2, 0x28, 0xC3,
+    0x72, 0xC8, 0xD7, 0x7B, 0x50, 0x38, 0x86, 0xF1, 0x57, 0x10, 0xC7, 0x9B, 0x49, 0xDA, 0xA2, 0x23,
+    0x88, 0x23, 0x3B, 0xDC, 0xCC, 0x76, 0x23, 0xD5, 0xAF, 0xE7, 0x8D, 0xA0, 0xCD, 0xF0, 0x01, 0x55,
+    0x93, 0x46, 0x77, 0x54, 0x5E, 0xB2, 0x11, 0x25, 0xB0, 0x74, 0xD4, 0x5A, 0x9A, 0x10, 0x8B, 0x3E,
+    0x12, 0x01, 0xB6, 0x72, 0x0A, 0x61, 0x03, 0x2A, 0x50, 0x1F, 0x5C, 0x4D, 0xED, 0x7F, 0x01, 0x7D,
+    0x95, 0x3F, 0x8F, 0xDE, 0x44, 0x10, 0xC6, 0xC7, 0xDE, 0xBB, 0x6C, 0x24, 0x17, 0x9B, 0x22, 0x42,
+    0x74, 0x6E, 0x68, 0x68, 0xD8, 0x4F, 0x40, 0xD6, 0x01, 0x89, 0x16, 0x8A, 0x50, 0xA5, 0x80, 0x12,
+    0x0A, 0xB8, 0x26, 0x25, 0x60, 0x2B, 0x29, 0x53, 0x70, 0x34, 0x74, 0x88, 0x14, 0xA9, 0x92, 0xE2,
+    0x3E, 0x00, 0x51, 0xEC, 0x23, 0x45, 0x2A, 0x84, 0xA3, 0x08, 0x51, 0x20, 0x21, 0x03, 0x5D, 0x28,
+    0xB2, 0xDC, 0xF9, 0xA4, 0x3D, 0x6E, 0xBD, 0xC3, 0x33, 0xEB, 0xF7, 0x25, 0x44, 0x27, 0x61, 0xD9,
+    0xF3, 0xBE, 0xB2, 0xBD, 0xB3, 0xCF, 0xFC, 0xE6, 0x8F, 0xA9, 0xB8, 0x46, 0x8A, 0xE7, 0x82, 0x79,
+    0x70, 0x5F, 0x2F, 0xAA, 0x33, 0x23, 0x15, 0x91, 0xA8, 0x6D, 0x0A, 0x1E, 0xC9, 0x25, 0x2A, 0xAE,
+    0x07, 0x22, 0x37, 0xEC, 0xAB, 0x68, 0xA9, 0xBD, 0xB5, 0xEC, 0x79, 0xC7, 0x91, 0xFA, 0x85, 0xA8,
+    0x26, 0x22, 0x4F, 0x17, 0x2C, 0x11, 0x7B, 0xAA, 0xB0, 0x64, 0x97, 0xF2, 0x51, 0xDC, 0x21, 0xC7,
+    0xDE, 0x44, 0xD8, 0xC9, 0x45, 0xD2, 0x89, 0xB0, 0x40, 0xC5, 0x32, 0xBE, 0x46, 0x3A, 0x6A, 0x4F,
+    0xB0, 0x66, 0x20, 0xAA, 0x82, 0x6D, 0x88, 0xCC, 0x7C, 0x05, 0x4B, 0xCC, 0x09, 0x96, 0x53, 0xCD,
+    0x62, 0x2D, 0xC3, 0x37, 0xB9, 0x29, 0x89, 0x1D, 0x59, 0xEC, 0xD0, 0x77, 0x10, 0x34, 0x38, 0xAC,
+    0xEA, 0x3B, 0x3B, 0x61, 0xC3, 0xA6, 0x9E, 0xA9, 0xE0, 0x7D, 0x6C, 0x52, 0xF3, 0xAC, 0x59, 0x36,
+    0x2C, 0x78, 0x90, 0xDD, 0x5D, 0x97, 0x2D, 0xBD, 0xB0, 0x9F, 0x67, 0xFB, 0x59, 0xB6, 0x37, 0x88,
+    0xAE, 0xD1, 0x65, 0xCD, 0x5D, 0xFB, 0x88, 0xA7, 0xDE, 0x5F, 0x9F, 0xFB, 0x50, 0xC4, 0xB6, 0xA1,
+    0x16, 0xAF, 0xDA, 0x03, 0x08, 0x79, 0x3E, 0x00, 0x86, 0x87, 0x6F, 0x88, 0xE8, 0xED, 0x40, 0xEE,
+    0xF1, 0x7C, 0xC9, 0x78, 0x7E, 0x43, 0x87, 0x9A, 0x6F, 0x2E, 0x8A, 0x21, 0xA8, 0x9D, 0xE1, 0x28,
+    0xAB, 0xC6, 0x56, 0x1A, 0x6A, 0x4A, 0xDC, 0xD0, 0x80, 0x44, 0x77, 0x57, 0x00, 0xAF, 0x93, 0x11,
+    0x44, 0xA3, 0x82, 0x93, 0x3E, 0x10, 0xA4, 0xF6, 0x02, 0x80, 0xDA, 0x77, 0xE0, 0x37, 0x8B, 0x6A,
+    0xBF, 0x91, 0xD8, 0xED, 0x2F, 0x35, 0x3C, 0x98, 0xA3, 0x1F, 0x21, 0x5C, 0x2D, 0x67, 0x23, 0xD0,
+    0x31, 0xF6, 0xC6, 0xC6, 0x07, 0x39, 0xF8, 0x9F, 0xF7, 0x06, 0x79, 0xFC, 0x18, 0xAE, 0x55, 0xF4,
+    0x20, 0x51, 0xA4, 0xCB, 0x16, 0x6F, 0xF5, 0x8D, 0x8E, 0xC2, 0x86, 0xB8, 0xA3, 0xFA, 0x94, 0xEC,
+    0x4C, 0x2D, 0x0F, 0x8A, 0x1B, 0x40, 0x00, 0xB7, 0x9C, 0x02, 0x92, 0x38, 0x8B, 0xA6, 0x0D, 0xE4,
+    0x10, 0xA8, 0xE2, 0xDD, 0xBE, 0x73, 0xA1, 0x58, 0xA0, 0x54, 0x1F, 0x7F, 0xD9, 0x90, 0xFD, 0x01,
+    0x92, 0xF9, 0x3B, 0x89, 0x95, 0x1B, 0xAA, 0x7F, 0xFD, 0x02, 0x4E, 0x6F, 0x40, 0xE3, 0xF2, 0x54,
+    0xA2, 0xAD, 0x8E, 0xA6, 0xB6, 0x33, 0xFC, 0xD6, 0x42, 0x2E, 0x1A, 0xBF, 0x12, 0xBD, 0xB4, 0x86,
+    0x76, 0x57, 0x48, 0x57, 0x8B, 0xA4, 0xD6, 0x26, 0x49, 0x6D, 0x8E, 0xAC, 0x58, 0x5E, 0xA5, 0xFB,
+    0xE9, 0x96, 0xF8, 0xE4, 0xDB, 0x10, 0xF8, 0xC1, 0xA9, 0xA0, 0x31, 0xB3, 0x84, 0x6A, 0x4E, 0x1F,
+    0xBC, 0x48, 0xED, 0xD9, 0xF9, 0xD4, 0xB6, 0xE7, 0x53, 0xEB, 0xCF, 0xA7, 0xB6, 0xA1, 0x7F, 0x35,
+    0x00, 0x21, 0xF8, 0xAE, 0x17, 0xB5, 0xB8, 0x1E, 0xE2, 0x4A, 0x74, 0xD9, 0xF2, 0xE1, 0x62, 0xF9,
+    0x76, 0x2A, 0xA3, 0x5D, 0xCA, 0xD0, 0x92, 0x9A, 0x03, 0xA9, 0xE3, 0x89, 0x34, 0xC0, 0x56, 0x3C,
+    0x91, 0x39, 0xF3, 0x64, 0x8E, 0x91, 0x8E, 0xDF, 0xE3, 0x8E, 0x7D, 0x92, 0xDE, 0xB4, 0x23, 0x47,
+    0x6C, 0x3F, 0xBB, 0x4E, 0x98, 0x6E, 0x8E, 0x8F, 0x00, 0x24, 0x15, 0x7C, 0xC8, 0xCC, 0x05, 0xFB,
+    0xFE, 0x60, 0x21, 0x0E, 0xAE, 0x4C, 0x94, 0x2E, 0x9A, 0x81, 0x9B, 0x87, 0xA4, 0x26, 0x2C, 0x21,
+    0xFA, 0xB0, 0xF6, 0x12, 0x9B, 0x8E, 0x92, 0xC6, 0x92, 0xF7, 0x84, 0x10, 0xB3, 0xB8, 0x71, 0xCF,
+    0xA5, 0x10, 0x6A, 0xC9, 0x16, 0x2A, 0xBC, 0x46, 0x40, 0x2A, 0x29, 0x89, 0x9D, 0x9B, 0xBE, 0x91,
+    0x78, 0x11, 0x1D, 0x1E, 0x2B, 0x20, 0xA8, 0x17, 0x6A, 0xC7, 0xDC, 0x2A, 0x0B, 0x42, 0x0D, 0x92,
+    0xCD, 0x35, 0x75, 0xC5, 0xFB, 0x48, 0x9D, 0xE5, 0xD1, 0x7D, 0xCF, 0xAC, 0xF8, 0xDD, 0x9B, 0xD1,
+    0xC5, 0x2B, 0xE6, 0x8F, 0x40, 0xD1, 0xED, 0x35, 0xF4, 0xD5, 0x02, 0xCC, 0x95, 0xD4, 0xBA, 0x13,
+    0x2A, 0xCC, 0x52, 0x7B, 0xD2, 0x8D, 0x4F, 0xC3, 0x0E, 0xF5, 0xD5, 0x89, 0x57, 0xD1, 0xF0, 0x60,
+    0xBC, 0x45, 0xBD, 0x35, 0x6E, 0xA0, 0xFF, 0x1E, 0x68, 0x71, 0x96, 0x4A, 0x81, 0x57, 0xF4, 0x35,
+    0x77, 0x38, 0x91, 0x73, 0x29, 0x4D, 0x48, 0x92, 0x13, 0x99, 0x40, 0x1A, 0x08, 0x01, 0x8B, 0x40,
+    0x33, 0xCB, 0x49, 0xEE, 0xD9, 0xBD, 0x7E, 0x90, 0xD2, 0x94, 0xBD, 0x2A, 0x58, 0x99, 0x07, 0x93,
+    0xD4, 0x1F, 0x82, 0x92, 0x13, 0xEB, 0xF5, 0xEA, 0xC2, 0xC2, 0x45, 0x9F, 0x5D, 0x60, 0xBD, 0x12,
+    0x55, 0x28, 0xCF, 0x53, 0xD2, 0x9C, 0xB0, 0x0E, 0x82, 0x67, 0x97, 0xEB, 0x00, 0xAE, 0x57, 0xE4,
+    0xED, 0x9A, 0xD1, 0x90, 0x7F, 0xAA, 0xF5, 0x9E, 0xA5, 0x6D, 0xA7, 0xA2, 0x84, 0xB1, 0xED, 0x54,
+    0x61, 0x15, 0xF5, 0x57, 0xF7, 0x26, 0xE3, 0x0B, 0xCC, 0x12, 0xAA, 0xC7, 0x7A, 0x2A, 0x63, 0x29,
+    0x45, 0x98, 0x83, 0x41, 0xA0, 0xF7, 0xFA, 0xAE, 0x9A, 0xF5, 0x8C, 0x87, 0xFD, 0x45, 0xE3, 0xCD,
+    0xD1, 0x6F, 0x32, 0x73, 0xEC, 0x68, 0xF8, 0x11, 0xFA, 0x50, 0x3A, 0xBF, 0x12, 0x10, 0xB2, 0xB5,
+    0x4C, 0x9E, 0x22, 0xE7, 0x03, 0xD7, 0x85, 0xEE, 0x65, 0x34, 0x1B, 0x36, 0x90, 0x9A, 0xE1, 0xDC,
+    0x8F, 0x2B, 0x9D, 0x6A, 0x5A, 0xF1, 0x20, 0xD9, 0x99, 0xCF, 0x83, 0x15, 0x50, 0xD1, 0x6D, 0x09,
+    0x6D, 0x10, 0x6D, 0x19, 0x6D, 0x21, 0x6D, 0x29, 0x6D, 0x30, 0x6D, 0x39, 0x6D, 0x41, 0x6D, 0x48,
+    0x6D, 0x51, 0x6D, 0x58, 0xAD, 0xB0, 0x16, 0x5A, 0x69, 0xF9, 0x95, 0x02, 0x48, 0x85, 0x92, 0xF9,
+    0x6D, 0xF4, 0x1E, 0xE7, 0x5E, 0xFE, 0x29, 0x0A, 0x0A, 0x35, 0xE9, 0x59, 0xA3, 0xD4, 0xED, 0x60,
+    0x9F, 0x20, 0x78, 0xD9, 0x3B, 0xF3, 0xA0, 0xFA, 0xD9, 0xC1, 0x24, 0x73, 0xA2, 0x6D, 0xF2, 0xE0,
+    0x45, 0xD8, 0x80, 0x32, 0x50, 0xDB, 0x81, 0x24, 0xC0, 0x31, 0x64, 0xFB, 0x32, 0xE5, 0xA6, 0x6A,
+    0x5E, 0xAA, 0x8F, 0xAD, 0x0F, 0xC6, 0x2B, 0x08, 0xE7, 0xEF, 0x03, 0x11, 0x06, 0xDD, 0x52, 0x1B,
+    0x62, 0x44, 0x2F, 0x20, 0x64, 0xBD, 0x80, 0x60, 0xE4, 0x36, 0x08, 0xB4, 0x43, 0xEE, 0xE5, 0x92,
+    0xFB, 0x7D, 0xE9, 0x4F, 0xC3, 0xEB, 0x17, 0xC1, 0xF1, 0x3A, 0x91, 0x90, 0x16, 0x0C, 0x2B, 0x99,
+    0x5A, 0x20, 0x1C, 0xC9, 0x4E, 0x25, 0x8B, 0x33, 0xEE, 0x70, 0xA7, 0xEF, 0xE0, 0x2C, 0x37, 0x04,
+    0xEE, 0xB4, 0x43, 0x1D, 0xF0, 0x6E, 0x99, 0x34, 0xC7, 0x1A, 0x8D, 0x01, 0x02, 0x53, 0xCF, 0xC3,
+    0xA6, 0x8C, 0xCB, 0xB4, 0xCA, 0xCC, 0x62, 0x48, 0x5F, 0xE5, 0x75, 0xC8, 0x67, 0x48, 0x10, 0xBF,
+    0x79, 0x9A, 0x25, 0x5E, 0xA3, 0xF7, 0xF0, 0x5E, 0xAA, 0x84, 0x63, 0x42, 0xD0, 0xF4, 0x4A, 0x92,
+    0xC8, 0x0A, 0xFE, 0x2B, 0xDB, 0xC3, 0x24, 0x6D, 0x5B, 0xA6, 0x8F, 0xA5, 0x3B, 0x25, 0xED, 0x11,
+    0xD6, 0xEB, 0x80, 0x5C, 0x07, 0x14, 0x12, 0x7E, 0x31, 0x05, 0xE7, 0x12, 0x16, 0x9C, 0x62, 0x3D,
+    0x89, 0xB5, 0xB9, 0xEC, 0xD0, 0xC0, 0xA3, 0xCA, 0xF5, 0xAA, 0xE6, 0x5C, 0xB4, 0x7E, 0x5B, 0xCE,
+    0xC5, 0x24, 0x83, 0x52, 0xE5, 0x02, 0x28, 0x73, 0xFA, 0xE9, 0x53, 0x91, 0xB2, 0x7B, 0x27, 0x0F,
+    0x2D, 0xB9, 0x61, 0x78, 0x5F, 0xF0, 0x61, 0xAA, 0xA1, 0x20, 0x90, 0x8B, 0x09, 0x51, 0xF3, 0xB7,
+    0xBE, 0x42, 0x8A, 0x74, 0x30, 0xB3, 0x9A, 0x55, 0xA8, 0x7D, 0xE5, 0x55, 0xB0, 0xD8, 0x51, 0x05,
+    0x37, 0x1A, 0x24, 0x58, 0x6C, 0xE5, 0xDD, 0x28, 0x2A, 0xE4, 0x7F, 0x3D, 0x3A, 0xF9, 0x37, 0x58,
+    0x68, 0xEB, 0xF1, 0x1D, 0xD4, 0xA7, 0x0B, 0x19, 0x7C, 0x99, 0x30, 0xED, 0xF8, 0x8C, 0x4F, 0x3E,
+    0xC9, 0x45, 0x28, 0xC3, 0xF3, 0x4F, 0x0C, 0x3D, 0xCC, 0xCC, 0x1D, 0xFA, 0xFF, 0xE3, 0x1F, 0xBD,
+    0x55, 0x31, 0x6F, 0x1E, 0x45, 0x10, 0x9D, 0xDB, 0xC3, 0x3E, 0x89, 0x93, 0xD8, 0x26, 0x8A, 0x10,
+    0x14, 0x4B, 0x83, 0x44, 0x83, 0xEE, 0x0F, 0x60, 0xEF, 0x05, 0x8A, 0x20, 0x21, 0x84, 0x8B, 0x88,
+    0x26, 0x85, 0x29, 0xE9, 0xDC, 0xA6, 0x88, 0xB4, 0x07, 0x2E, 0x28, 0x68, 0x5C, 0x53, 0x9B, 0x02,
+    0x53, 0xB8, 0xA1, 0xC5, 0xB7, 0x89, 0xCB, 0x34, 0x97, 0x34, 0x29, 0x28, 0x7C, 0x11, 0x96, 0x5C,
+    0xA4, 0x60, 0x25, 0xAE, 0x38, 0xC3, 0xDE, 0x0E, 0x6F, 0xF6, 0xFB, 0x3E, 0x47, 0xA2, 0xA0, 0x01,
+    0x71, 0x96, 0xC6, 0xDF, 0xEE, 0xED, 0xCE, 0xCC, 0x7B, 0xF3, 0x66, 0x8E, 0x8A, 0x63, 0x22, 0xEA,
+    0x47, 0x22, 0x3D, 0x6D, 0xB5, 0xC4, 0x05, 0x0F, 0x75, 0x68, 0xD8, 0xDB, 0x3B, 0xD1, 0x7E, 0x15,
+    0xB5, 0x3F, 0xD3, 0xA3, 0x55, 0x33, 0x56, 0x7A, 0x58, 0xAA, 0xD1, 0x96, 0xB3, 0x79, 0x3C, 0xEB,
+    0x60, 0xB5, 0x6F, 0x7C, 0x8A, 0xE4, 0x9E, 0xB2, 0x6F, 0x7B, 0xE6, 0x53, 0x72, 0x89, 0x27, 0xDA,
+    0xA2, 0x5B, 0x70, 0xB6, 0xFD, 0x03, 0x91, 0x62, 0x1E, 0x08, 0x2F, 0xBA, 0x9A, 0x4F, 0x12, 0xF1,
+    0xA8, 0xA6, 0x3A, 0x92, 0xF6, 0x76, 0xA0, 0x5D, 0x95, 0x88, 0xF6, 0xF4, 0x84, 0x83, 0xCE, 0xCB,
+    0x41, 0xFC, 0xD0, 0x11, 0xC6, 0x22, 0x07, 0x62, 0x6C, 0x95, 0x79, 0x6B, 0x21, 0xFA, 0xA2, 0x89,
+    0x54, 0x7B, 0x9B, 0x3E, 0x4F, 0xE2, 0x2A, 0x88, 0x21, 0x3A, 0xE0, 0x23, 0x1C, 0x91, 0xB3, 0xBA,
+    0x83, 0xD9, 0x95, 0x4B, 0x93, 0x5C, 0xC2, 0xAA, 0xBA, 0x24, 0x79, 0xEE, 0xC1, 0xEB, 0x50, 0x71,
+    0xAC, 0x38, 0x95, 0xB1, 0x52, 0x70, 0x8E, 0x90, 0x7D, 0x4B, 0xD6, 0x93, 0x0E, 0x54, 0x62, 0xCD,
+    0xF4, 0x9E, 0x0D, 0x4E, 0x33, 0xDF, 0x61, 0x6E, 0x0D, 0xDE, 0x3E, 0x84, 0x3B, 0x2A, 0xBE, 0xF5,
+    0x84, 0x30, 0x4D, 0x40, 0x82, 0xB4, 0x7A, 0x70, 0x84, 0x17, 0x03, 0x13, 0x9B, 0x3F, 0xF8, 0xC7,
+    0x68, 0x0B, 0x2E, 0xA2, 0x55, 0x5C, 0x4C, 0x80, 0xA1, 0xC2, 0x9B, 0xE5, 0x52, 0x74, 0xD9, 0x21,
+    0x55, 0x62, 0x6A, 0x31, 0x7A, 0x16, 0x23, 0xF8, 0x10, 0x8C, 0xC8, 0x88, 0x69, 0xC6, 0x0D, 0x40,
+    0x30, 0x80, 0x5C, 0x2E, 0xB3, 0x67, 0x31, 0x88, 0x4D, 0xC5, 0x22, 0x46, 0xEE, 0x2A, 0xB9, 0xAB,
+    0xC2, 0x8D, 0x19, 0x32, 0x9A, 0x3D, 0xDA, 0x43, 0x59, 0xFA, 0x0E, 0x55, 0x49, 0x36, 0xBA, 0x58,
+    0x1C, 0x5C, 0xF0, 0x05, 0x0F, 0x05, 0xBF, 0xE0, 0x67, 0x91, 0x4C, 0x6C, 0x66, 0xEB, 0x15, 0x97,
+    0x8C, 0x44, 0xEC, 0x60, 0xBD, 0xEB, 0x80, 0x3A, 0xD6, 0x13, 0xB9, 0xAE, 0x6F, 0x99, 0xEA, 0x49,
+    0x07, 0x3D, 0x02, 0x32, 0x17, 0xCB, 0x2D, 0x1D, 0xCC, 0xD8, 0x5C, 0x3D, 0x4A, 0x6A, 0x51, 0x3C,
+    0x37, 0x43, 0xE3, 0x1B, 0xFE, 0x28, 0x96, 0x73, 0xB1, 0x48, 0x38, 0x2A, 0x4C, 0x2B, 0xFF, 0xD4,
+    0x94, 0xB1, 0x37, 0x79, 0x51, 0xE6, 0x37, 0x6A, 0xC9, 0x5B, 0xAF, 0x6F, 0x58, 0x99, 0x2C, 0x9F,
+    0x73, 0xD4, 0x3C, 0x58, 0x94, 0xA5, 0x03, 0x78, 0xDB, 0x11, 0xB7, 0x20, 0xB8, 0x19, 0x8D, 0x07,
+    0x23, 0x1A, 0x99, 0xF3, 0x67, 0x00, 0xDC, 0xBC, 0x0C, 0x52, 0x9C, 0xB0, 0x2E, 0x13, 0x19, 0x41,
+    0x98, 0x19, 0x2B, 0xA4, 0xCC, 0xB8, 0xBC, 0x61, 0x26, 0x53, 0x56, 0x27, 0x04, 0xB5, 0x72, 0x52,
+    0x73, 0x3E, 0xD4, 0x16, 0x6D, 0x3F, 0xD8, 0xE7, 0xEC, 0xF9, 0x3B, 0x2E, 0x90, 0x76, 0x39, 0x57,
+    0x93, 0x19, 0xCC, 0xE8, 0xC8, 0x7E, 0x3D, 0x53, 0xD2, 0x5E, 0xC5, 0x9F, 0xA9, 0xFE, 0x7D, 0x24,
+    0x03, 0x77, 0x2E, 0xC0, 0x6B, 0x4B, 0x15, 0xAE, 0x23, 0x0B, 0xEA, 0x11, 0x09, 0xE1, 0x24, 0x17,
+    0x87, 0x0A, 0xC1, 0x35, 0x38, 0x57, 0x27, 0xC7, 0xF4, 0x6F, 0x51, 0xA8, 0x3E, 0x1D, 0x89, 0xC4,
+    0xE1, 0xFC, 0x36, 0xDF, 0xFB, 0xCF, 0x51, 0x4C, 0x82, 0xA2, 0x38, 0x4D, 0x47, 0xD0, 0x08, 0x72,
+    0xFE, 0x67, 0x14, 0x12, 0x68, 0xC0, 0x8E, 0x85, 0xF3, 0x05, 0x91, 0x45, 0x61, 0xE8, 0x20, 0xC8,
+    0x1D, 0x5A, 0x95, 0xAA, 0xF1, 0x37, 0xB9, 0xD7, 0x2E, 0xB2, 0xFA, 0xA4, 0x4B, 0x48, 0x04, 0xBF,
+    0x6E, 0x3A, 0xA8, 0x27, 0xBB, 0xC8, 0x3B, 0x49, 0x2A, 0x52, 0xCE, 0x72, 0x46, 0x07, 0x69, 0x4E,
+    0xEB, 0x05, 0x53, 0x2F, 0x1A, 0x46, 0xD7, 0x9A, 0x6B, 0x6A, 0x24, 0x94, 0xB7, 0xFC, 0x88, 0xA5,
+    0x51, 0xC1, 0x4B, 0xF7, 0x4A, 0x28, 0x36, 0x27, 0xB3, 0x9B, 0xED, 0x4E, 0xB6, 0x1F, 0x10, 0x26,
+    0xC2, 0x56, 0x6B, 0xA6, 0x32, 0x55, 0xC8, 0x6E, 0x74, 0x4B, 0xB3, 0x90, 0xB9, 0x82, 0x4B, 0x61,
+    0xAE, 0xE2, 0x75, 0x3B, 0x64, 0x6D, 0xA1, 0x02, 0x20, 0x0B, 0x8B, 0x3F, 0xE7, 0x77, 0xDE, 0x3D,
+    0xB3, 0x17, 0x87, 0xFC, 0x98, 0x27, 0x17, 0xB4, 0x88, 0xFA, 0x2C, 0xBC, 0x86, 0x44, 0x37, 0xC2,
+    0x94, 0x68, 0x22, 0xCA, 0x7C, 0xED, 0x2D, 0x7A, 0xD5, 0xA8, 0x11, 0x44, 0x38, 0xCC, 0x09, 0x66,
+    0x75, 0xCD, 0x07, 0xE8, 0x16, 0x7D, 0x1E, 0x77, 0xCA, 0x85, 0x76, 0xCD, 0x8B, 0x80, 0x56, 0xFC,
+    0xC9, 0xDD, 0xED, 0x50, 0x5A, 0x8C, 0x03, 0x51, 0x1E, 0x36, 0xEA, 0x59, 0x10, 0x4A, 0x0A, 0x45,
+    0x92, 0x91, 0x80, 0x4E, 0xC9, 0x6D, 0x8C, 0x3D, 0x33, 0xE6, 0x0D, 0x94, 0x15, 0xD4, 0xC3, 0x85,
+    0x6C, 0x48, 0x37, 0x83, 0x55, 0x27, 0xC2, 0x10, 0x3A, 0x50, 0xAB, 0x93, 0xD3, 0xD4, 0x56, 0x2C,
+    0x0F, 0x98, 0x95, 0x21, 0xB1, 0x4A, 0x65, 0x5C, 0x95, 0x25, 0xB3, 0x42, 0xAB, 0xBD, 0x6A, 0xB5,
+    0x67, 0x56, 0xC9, 0x3E, 0x10, 0x8D, 0x08, 0x07, 0x42, 0xA3, 0x96, 0x1F, 0x9B, 0x67, 0x0B, 0xA3,
+    0xC7, 0x2C, 0x84, 0x66, 0x1E, 0x75, 0xB8, 0xBD, 0x20, 0x31, 0xE3, 0x9B, 0x41, 0x45, 0x69, 0x6D,
+    0x6F, 0x7D, 0x35, 0x55, 0x33, 0xEA, 0xC1, 0x2D, 0xFA, 0x38, 0x50, 0x42, 0x9D, 0xCD, 0xD0, 0x87,
+    0x0F, 0x63, 0xE3, 0x76, 0x1A, 0x7E, 0x02, 0xCA, 0x82, 0x9B, 0xF5, 0x5C, 0xBE, 0xEC, 0x40, 0x58,
+    0x1E, 0x43, 0x7E, 0x9D, 0x81, 0x90, 0x96, 0x27, 0xD1, 0xF1, 0x86, 0xAE, 0xE8, 0xF8, 0x57, 0x5E,
+    0x1A, 0x0E, 0x66, 0xC6, 0x70, 0x81, 0xFF, 0x66, 0x04, 0x2F, 0x90, 0x6F, 0xDF, 0xDD, 0x2C, 0x10,
+    0x0B, 0x83, 0x45, 0x84, 0xDD, 0x5F, 0x1F, 0x4C, 0x99, 0x63, 0xC9, 0x19, 0xCC, 0x14, 0xDF, 0xFF,
+    0x4D, 0xF2, 0xD5, 0x4D, 0x4B, 0x17, 0x7C, 0x29, 0xC5, 0x85, 0x72, 0x4B, 0xF9, 0x08, 0x00, 0x69,
+    0xA0, 0x95, 0x84, 0xD7, 0x64, 0x64, 0xA1, 0x68, 0x61, 0xA7, 0x44, 0x7A, 0xF8, 0x62, 0x6C, 0xA3,
+    0xE7, 0xCE, 0x19, 0xED, 0x70, 0x3F, 0xD4, 0x21, 0x63, 0x4D, 0xF8, 0xB3, 0x5D, 0xDF, 0xE9, 0xD1,
+    0x0D, 0x65, 0xCA, 0xA3, 0x3F, 0xD2, 0xF6, 0xA5, 0xA8, 0xD4, 0x7D, 0x0C, 0x34, 0xBF, 0x08, 0x6D,
+    0xC3, 0xAA, 0x23, 0xDD, 0x43, 0xC1, 0xB7, 0x06, 0x2B, 0xC2, 0x90, 0x49, 0x9A, 0x27, 0xCC, 0x97,
+    0x2B, 0xAC, 0x48, 0x43, 0x8B, 0x38, 0x9E, 0x22, 0x27, 0x37, 0x2A, 0x6E, 0xF1, 0x12, 0x5C, 0x38,
+    0x8F, 0x22, 0xD6, 0x32, 0x32, 0xA9, 0x3F, 0x3C, 0x5C, 0x80, 0xF6, 0x01, 0x6A, 0xDB, 0x3F, 0xF9,
+    0x04, 0x1F, 0x9D, 0x74, 0x8D, 0x26, 0x40, 0x49, 0xA7, 0x35, 0x5C, 0x3A, 0xD8, 0x17, 0xC5, 0x3D,
+    0x93, 0x9F, 0xEF, 0x0B, 0x68, 0x75, 0x98, 0x07, 0xA2, 0x15, 0x7E, 0xDF, 0x5E, 0x68, 0xDD, 0xE8,
+    0x2A, 0xB7, 0xC5, 0x0D, 0x22, 0xAF, 0xC3, 0xFD, 0x50, 0x4D, 0x2A, 0x42, 0xAA, 0xF8, 0x08, 0x92,
+    0xFD, 0xD4, 0x7A, 0xFD, 0x7C, 0x7F, 0x2C, 0xD3, 0x6F, 0xD3, 0x0A, 0x51, 0x84, 0xC3, 0x37, 0x30,
+    0x74, 0xCA, 0xFD, 0xAB, 0x0E, 0x9C, 0x8D, 0x20, 0x2F, 0xAC, 0x58, 0x2D, 0xE8, 0xFF, 0x79, 0xFE,
+    0x02, 0xBD, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x9D, 0xB5, 0x73, 0x67, 0xD0, 0x57, 0x6C, 0x8A,
+    0x28, 0xA2, 0x33, 0x05, 0x0D, 0x05, 0x5A, 0x7E, 0x41, 0xD6, 0xE2, 0x24, 0x9A, 0x2B, 0xB8, 0x22,
+    0x54, 0x11, 0x4A, 0x4B, 0x47, 0x43, 0x41, 0x03, 0x36, 0xA2, 0x48, 0xFB, 0xFD, 0x83, 0x50, 0x20,
+    0x8A, 0x34, 0x34, 0xB4, 0x9C, 0x57, 0x49, 0x91, 0xD6, 0xD1, 0x15, 0x94, 0x38, 0x40, 0x45, 0xC3,
+    0x82, 0x2C, 0xE1, 0x53, 0x6C, 0x0F, 0xEF, 0xED, 0x7E, 0x77, 0x5C, 0x8D, 0x10, 0xD6, 0xF7, 0x8D,
+    0xED, 0xF5, 0x78, 0x76, 0xE6, 0xCD, 0x9B, 0x67, 0x11, 0x1E, 0x56, 0x57, 0x91, 0x52, 0x15, 0x97,
+    0xF5, 0x0C, 0x53, 0xAE, 0x5C, 0xE5, 0xAD, 0xB4, 0x01, 0xC6, 0x8D, 0x74, 0xBA, 0xEC, 0xF7, 0x74,
+    0xDA, 0xF0, 0x44, 0x75, 0x90, 0x76, 0x80, 0xAF, 0x1B, 0x8B, 0x4D, 0xEC, 0x24, 0x7D, 0x57, 0x2E,
+    0xE2, 0x07, 0xA3, 0xD7, 0x37, 0x6E, 0xC4, 0x4D, 0x7D, 0x69, 0x74, 0x68, 0xF5, 0x42, 0x37, 0xAF,
+    0x7F, 0xA8, 0x36, 0x72, 0x24, 0x62, 0x34, 0x22, 0xC2, 0x22, 0x72, 0x97, 0x1B, 0xB4, 0x1D, 0xC2,
+    0x0F, 0x88, 0x8E, 0xC5, 0x72, 0x3E, 0x6A, 0xCC, 0x8A, 0xA8, 0xBD, 0x53, 0x71, 0xBF, 0xEB, 0x60,
+    0xF5, 0x34, 0x96, 0x7A, 0xB2, 0x18, 0xED, 0x36, 0xE9, 0x43, 0xDB, 0xF8, 0xC1, 0x05, 0x1B, 0x6D,
+    0xAC, 0xE6, 0x72, 0x2E, 0x56, 0xB3, 0x8A, 0x36, 0xFD, 0x47, 0x3E, 0x78, 0xFD, 0x20, 0x5A, 0x7D,
+    0x34, 0x19, 0xEC, 0x20, 0xB7, 0x98, 0xF6, 0xDD, 0x3D, 0xD3, 0x56, 0xE4, 0x5D, 0xAB, 0x06, 0xD9,
+    0x6D, 0xDF, 0xAD, 0xF5, 0x7B, 0x2A, 0xFE, 0xAF, 0xB1, 0x0D, 0x46, 0x57, 0x24, 0x59, 0xEB, 0x0B,
+    0x95, 0x62, 0xDB, 0xFC, 0x20, 0xEE, 0x47, 0x14, 0xA4, 0x8B, 0xA3, 0x0D, 0xB4, 0x28, 0x81, 0x65,
+    0xDB, 0x85, 0xA1, 0xD2, 0xE5, 0x0E, 0x97, 0x5F, 0x4B, 0x3B, 0x8A, 0x03, 0x04, 0x9D, 0x8B, 0x0C,
+    0x8B, 0xA5, 0x9E, 0x98, 0x19, 0xDD, 0xB0, 0xAD, 0xDC, 0xA6, 0xB3, 0xB9, 0x2F, 0x52, 0x69, 0x07,
+    0x44, 0x27, 0xB1, 0x2F, 0x37, 0xD9, 0x8D, 0xFE, 0xF4, 0x51, 0xAC, 0x9F, 0x3F, 0x9B, 0xED, 0xCF,
+    0x71, 0xAD, 0xC7, 0x2F, 0xDA, 0x1E, 0x55, 0xC1, 0xA1, 0x07, 0xC4, 0xC5, 0x22, 0x9F, 0x02, 0xAC,
+    0x73, 0x06, 0xCB, 0xF0, 0x3B, 0x02, 0x7F, 0x26, 0xFF, 0x4B, 0x05, 0xEE, 0x50, 0xC1, 0x76, 0x55,
+    0x41, 0x91, 0x9C, 0x1D, 0x9D, 0x8B, 0x29, 0x5D, 0xD2, 0x14, 0x91, 0xF6, 0x9D, 0x94, 0x53, 0xF3,
+    0xEF, 0x4B, 0xC4, 0x8A, 0x14, 0xD7, 0x25, 0x72, 0xA7, 0x7B, 0xCC, 0x0F, 0x11, 0x4B, 0x6E, 0xC8,
+    0x4D, 0xDE, 0x92, 0x7C, 0x80, 0x5C, 0x04, 0xC3, 0xA0, 0x6A, 0x12, 0x91, 0xCC, 0x00, 0x0B, 0x0B,
+    0xBC, 0x6B, 0x41, 0x4E, 0x54, 0x4B, 0x66, 0x56, 0x4B, 0xA6, 0x25, 0x3A, 0x4E, 0xA7, 0x3A, 0xA6,
+    0x32, 0x41, 0x46, 0xA9, 0x57, 0xA4, 0xB7, 0x89, 0xD7, 0x29, 0x87, 0x33, 0xF9, 0x74, 0x5B, 0x86,
+    0x74, 0xFE, 0x3C, 0xED, 0xC5, 0x3A, 0x53, 0xB9, 0xF0, 0xCD, 0x67, 0xE9, 0xE7, 0x83, 0xFF, 0x99,
+    0xDC, 0x38, 0x8E, 0x3B, 0xDA, 0x8F, 0xB9, 0x1F, 0x82, 0x6A, 0x28, 0x34, 0xB4, 0x2A, 0xA0, 0x70,
+    0x3F, 0x15, 0x2B, 0x69, 0x7C, 0xAB, 0x95, 0x5E, 0xFA, 0xD7, 0x01, 0xF0, 0xE0, 0x43, 0x4B, 0xE7,
+    0xD9, 0x8E, 0x9E, 0x67, 0x5F, 0x4D, 0x9E, 0x88, 0xED, 0x9E, 0x2E, 0x35, 0xCF, 0xE6, 0x52, 0x1F,
+    0x86, 0x5C, 0x20, 0xDB, 0x9A, 0xCE, 0x69, 0x6F, 0x30, 0xB7, 0xA7, 0x43, 0xFF, 0x74, 0xB1, 0x63,
+    0x9A, 0x39, 0x2D, 0xF9, 0xA0, 0x1D, 0x7C, 0xC7, 0xF9, 0x68, 0x47, 0x3B, 0x10, 0x85, 0x3E, 0x56,
+    0x13, 0x61, 0xE8, 0x23, 0x4A, 0xF6, 0x23, 0xB2, 0xD8, 0xE1, 0xB7, 0x89, 0xC3, 0x90, 0x60, 0x68,
+    0xBA, 0x43, 0x7F, 0x6E, 0xA6, 0x2F, 0x77, 0x68, 0x62, 0xC9, 0x2A, 0xBC, 0x7C, 0x9F, 0x66, 0x3B,
+    0x25, 0x59, 0x6B, 0x4A, 0xC5, 0xED, 0xAF, 0x3D, 0x8F, 0xF0, 0xE6, 0x51, 0xB3, 0x5B, 0x8B, 0xA9,
+    0xDA, 0x4A, 0x8D, 0xBE, 0xD0, 0xD8, 0xEB, 0x49, 0x6C, 0x37, 0x7B, 0x32, 0x9F, 0xDB, 0xD0, 0x9C,
+    0xB9, 0xC7, 0x17, 0x48, 0xA2, 0x78, 0xB5, 0x9C, 0x27, 0x66, 0xFE, 0x14, 0x92, 0x66, 0x30, 0x51,
+    0xFF, 0x09, 0xA3, 0x55, 0xBF, 0xAC, 0xBC, 0x59, 0xFC, 0xC3, 0xF0, 0xE6, 0xBB, 0xBE, 0x7A, 0xB9,
+    0xD5, 0xA7, 0x3A, 0xFC, 0x60, 0x35, 0xEA, 0x6C, 0x83, 0x2E, 0xD5, 0x2A, 0x73, 0xB9, 0xE5, 0xF1,
+    0x3C, 0x1C, 0xDF, 0xA0, 0x4B, 0x71, 0x87, 0x5A, 0x74, 0x74, 0x9B, 0x54, 0x98, 0xF1, 0x45, 0xCA,
+    0xC5, 0xAC, 0x6F, 0x00, 0xEE, 0x72, 0x62, 0x93, 0x2D, 0x9A, 0xB6, 0x9B, 0x1D, 0xD2, 0xB7, 0x13,
+    0x41, 0xB5, 0xAF, 0xB6, 0x94, 0x3C, 0xF4, 0x87, 0x04, 0x46, 0x3E, 0x7E, 0xAC, 0x17, 0xB2, 0x02,
+    0x61, 0xC4, 0x07, 0x6C, 0x00, 0xF8, 0x68, 0xFB, 0x8E, 0x64, 0xD0, 0x06, 0x50, 0x19, 0xDD, 0xC3,
+    0xD6, 0x3A, 0x51, 0xA3, 0x14, 0xE2, 0x91, 0x34, 0x2F, 0x53, 0x1C, 0x78, 0x17, 0x43, 0x1F, 0xAE,
+    0xE4, 0x8F, 0x40, 0x72, 0x1E, 0x88, 0xD7, 0x7D, 0xB9, 0x03, 0x9E, 0xFB, 0x67, 0x3A, 0xFA, 0xF8,
+    0x60, 0x76, 0x33, 0xA4, 0xA9, 0x93, 0xD6, 0x06, 0x71, 0xCF, 0x07, 0xB1, 0x7F, 0x46, 0x38, 0x6F,
+    0x70, 0x25, 0x17, 0xDE, 0x07, 0xDF, 0x82, 0x0F, 0x76, 0xAC, 0xA6, 0x0A, 0x7E, 0x60, 0x46, 0xDB,
+    0x40, 0xFD, 0x10, 0x76, 0x97, 0x74, 0x0D, 0x21, 0x17, 0xA9, 0xBE, 0x5C, 0xD3, 0x2B, 0x69, 0x30,
+    0x8E, 0x7F, 0xFD, 0x07, 0x06, 0xCF, 0xA9, 0x65, 0x51, 0xA4, 0x45, 0xFB, 0x2D, 0x37, 0xB7, 0x81,
+    0xC2, 0x5B, 0x45, 0xF2, 0xBA, 0x98, 0x77, 0x4C, 0x6A, 0x49, 0xAA, 0xEC, 0x93, 0x2C, 0xD7, 0x1D,
+    0x1F, 0xDB, 0xC1, 0x31, 0x7A, 0xE4, 0x58, 0x14, 0x73, 0x99, 0x07, 0x8B, 0x8F, 0xCF, 0x93, 0x6C,
+    0x7B, 0xE1, 0x63, 0xDF, 0xE1, 0xB1, 0x05, 0x26, 0x1C, 0x8B, 0xE1, 0x58, 0xF7, 0x86, 0xBA, 0x0A,
+    0x21, 0x19, 0x2A, 0x0C, 0x29, 0xC9, 0x52, 0x27, 0x26, 0x24, 0xE6, 0x61, 0x47, 0xDA, 0xF2, 0x86,
+    0x95, 0xB4, 0x2E, 0x1F, 0x9E, 0x11, 0x70, 0x4C, 0x24, 0x3F, 0x15, 0xEE, 0x71, 0x14, 0x33, 0x7B,
+    0xA8, 0x52, 0x40, 0x39, 0xF7, 0xAA, 0x49, 0xCC, 0x04, 0xDD, 0xB0, 0x57, 0x77, 0x45, 0xBE, 0xD3,
+    0xD7, 0xDE, 0x3E, 0x2F, 0x97, 0x59, 0xA1, 0xCD, 0x17, 0xDA, 0x78, 0x05, 0xE4, 0x89, 0x2E, 0xD5,
+    0x90, 0x0A, 0x01, 0x28, 0xEC, 0x81, 0x25, 0xD6, 0x9F, 0x5D, 0xCB, 0xCB, 0x41, 0x02, 0x02, 0x7E,
+    0x68, 0x49, 0x86, 0xB8, 0x63, 0x43, 0x50, 0x00, 0xA7, 0x02, 0x88, 0xD4, 0x59, 0x11, 0x40, 0x78,
+    0xB4, 0x98, 0xBD, 0x46, 0x60, 0xB6, 0xD3, 0xFF, 0xF6, 0x04, 0x9D, 0x34, 0x14, 0x41, 0x00, 0x0F,
+    0x4B, 0xB9, 0x18, 0xB3, 0x62, 0x34, 0x49, 0x29, 0x96, 0xA4, 0x1B, 0x78, 0xDF, 0x65, 0xBD, 0x40,
+    0x08, 0xBC, 0x9F, 0x04, 0xE4, 0x92, 0x42, 0x43, 0xE1, 0x40, 0x64, 0x68, 0x07, 0xC9, 0x73, 0xCD,
+    0x92, 0xFC, 0x15, 0xB4, 0xF9, 0xB3, 0xD8, 0xA6, 0xE1, 0x35, 0x9A, 0x1C, 0x32, 0x53, 0x24, 0x4B,
+    0xA2, 0xBB, 0x00, 0x9B, 0xA7, 0x07, 0x33, 0x28, 0x0C, 0xA9, 0x00, 0x05, 0xDA, 0xCE, 0x05, 0x47,
+    0xB4, 0x23, 0x07, 0xC5, 0x6C, 0x4F, 0x54, 0x7A, 0x2C, 0x7A, 0x2E, 0xE6, 0xAF, 0xD8, 0x02, 0xAA,
+    0x64, 0xDF, 0xAC, 0xBC, 0x1C, 0x73, 0x00, 0x58, 0x7D, 0x85, 0x41, 0x20, 0x56, 0xFC, 0xDF, 0xA4,
+    0xCA, 0x7F, 0x7D, 0xFC, 0x0D, 0xB5, 0x55, 0xBF, 0x6F, 0xDF, 0x44, 0x14, 0x7F, 0xE7, 0x4B, 0xE2,
+    0x82, 0x87, 0xEB, 0xD0, 0x4E, 0x20, 0x6E, 0xE9, 0xC2, 0xE4, 0x95, 0x81, 0xE6, 0x0C, 0x1D, 0x59,
+    0x32, 0x10, 0x21, 0xD1, 0xA1, 0x0B, 0x7B, 0xFE, 0x01, 0x1A, 0x9F, 0xC4, 0x98, 0xA1, 0x61, 0x66,
+    0x61, 0x80, 0xA5, 0x95, 0x10, 0x7F, 0x40, 0xD5, 0xB3, 0x94, 0x81, 0x81, 0x21, 0x96, 0x80, 0xA9,
+    0x8B, 0xA1, 0x15, 0x43, 0x19, 0x72, 0x52, 0x5D, 0xE4, 0x2F, 0x39, 0xFB, 0xF1, 0x79, 0xE7, 0x34,
+    0x0D, 0x7F, 0x00, 0x96, 0x73, 0xF7, 0x8D, 0xCF, 0xF7, 0xEE, 0x7D, 0x7E, 0xBC, 0x67, 0xA2, 0xF5,
+    0x62, 0xEE, 0x70, 0x6B, 0x66, 0xCD, 0x0B, 0x29, 0xF6, 0xB8, 0x49, 0xCF, 0xA4, 0x13, 0x91, 0x8D,
+    0x72, 0x53, 0xDB, 0x51, 0xF0, 0x54, 0x2C, 0xA4, 0x17, 0x22, 0x33, 0xCA, 0x4D, 0xEE, 0xC5, 0xC3,
+    0xD0, 0xE1, 0x75, 0x5C, 0x44, 0x15, 0xC6, 0x09, 0xCF, 0x06, 0x72, 0x3D, 0x02, 0x36, 0x72, 0x63,
+    0x7F, 0xB9, 0x86, 0xA8, 0x11, 0x22, 0xE4, 0x10, 0xD8, 0x8F, 0xC8, 0x64, 0x37, 0x54, 0x6F, 0xA8,
+    0xE4, 0x05, 0xFB, 0xC8, 0xF1, 0xE8, 0x64, 0x33, 0x2E, 0xD3, 0xE7, 0xE9, 0x49, 0x1E, 0xCB, 0x98,
+    0x27, 0x97, 0xC7, 0x62, 0xCC, 0xD3, 0xDB, 0x32, 0x7C, 0x4A, 0x38, 0x76, 0xA8, 0xB0, 0x8B, 0xC2,
+    0x47, 0x07, 0x83, 0x89, 0x6A, 0x21, 0x26, 0xDB, 0xDB, 0xA1, 0x48, 0xC5, 0x8C, 0x78, 0x19, 0x4C,
+    0xA2, 0xF6, 0x61, 0xF0, 0xD5, 0x58, 0x8E, 0x58, 0x0C, 0xD7, 0x4C, 0x34, 0x2F, 0x7F, 0xC7, 0x7B,
+    0x73, 0xDD, 0x1B, 0x3E, 0x49, 0x14, 0x90, 0x1A, 0xD9, 0x86, 0x48, 0xCB, 0x31, 0xF7, 0xE5, 0x70,
+    0x8F, 0xB8, 0x03, 0x7E, 0x6C, 0xAD, 0xB4, 0x18, 0x4E, 0x2D, 0x3F, 0xC3, 0x06, 0x8E, 0x76, 0x52,
+    0xDC, 0x03, 0x4F, 0x3D, 0x28, 0x16, 0xF0, 0xC1, 0x5F, 0xFE, 0x33, 0x01, 0x59, 0xC1, 0x82, 0x3C,
+    0x6C, 0x0E, 0xC0, 0x8C, 0x1C, 0x4C, 0x99, 0x13, 0xF5, 0x3D, 0x00, 0x67, 0x4E, 0x32, 0x67, 0x94,
+    0xD9, 0x40, 0xE6, 0x79, 0xE8, 0x33, 0x67, 0x38, 0x9D, 0x41, 0x36, 0x2D, 0x97, 0x40, 0x4D, 0x87,
+    0x41, 0x67, 0x1A, 0x32, 0xFC, 0x0F, 0x64, 0xB8, 0x41, 0xB4, 0xC3, 0x8D, 0x3B, 0x61, 0x40, 0xBC,
+    0x1B, 0xAB, 0x58, 0x24, 0x1C, 0x2F, 0x98, 0x9D, 0x0F, 0xDE, 0x0C, 0x6D, 0xAF, 0x17, 0x8E, 0x14,
+    0x70, 0xF2, 0xCE, 0x73, 0x09, 0xD5, 0x02, 0x56, 0x8D, 0x18, 0x06, 0x21, 0x6A, 0x1C, 0x5A, 0xE3,
+    0x20, 0x33, 0x5C, 0x40, 0x15, 0xA6, 0x6F, 0x0B, 0x76, 0x61, 0xB5, 0xA1, 0xCB, 0xCB, 0x20, 0xA7,
+    0x76, 0xC1, 0x34, 0x10, 0x02, 0x15, 0x3C, 0x14, 0x78, 0x80, 0x49, 0x73, 0x87, 0x2C, 0x63, 0x85,
+    0xA9, 0xE4, 0x68, 0xCE, 0x3A, 0xAA, 0x9E, 0xC6, 0x1A, 0x8E, 0x30, 0x3F, 0xC7, 0x5D, 0x87, 0xE9,
+    0xA7, 0x31, 0x61, 0xAA, 0xBF, 0xDA, 0x4C, 0x98, 0xDC, 0x9D, 0xF3, 0xE8, 0x3C, 0x39, 0xCD, 0x43,
+    0xEB, 0xE9, 0xB0, 0xE0, 0x0E, 0xD3, 0x5C, 0x70, 0x83, 0x29, 0x01, 0x7B, 0xF0, 0x2A, 0xD1, 0x4C,
+    0xA1, 0x29, 0x26, 0x82, 0x08, 0x4D, 0x39, 0xD1, 0x9E, 0xE2, 0x5F, 0x1D, 0xFC, 0x62, 0x39, 0x05,
+    0x96, 0x64, 0x53, 0xCE, 0x47, 0xAF, 0x8A, 0x57, 0xAB, 0x0B, 0x32, 0x2F, 0xE0, 0x68, 0x4D, 0xF8,
+    0xFE, 0x9A, 0xF2, 0xB7, 0x60, 0x72, 0x8F, 0xB6, 0x1B, 0x11, 0xD3, 0x41, 0x66, 0x26, 0xD0, 0x60,
+    0x18, 0x49, 0x93, 0x09, 0x77, 0xCE, 0x7A, 0x32, 0x07, 0x47, 0xA7, 0x1D, 0xD9, 0x7B, 0x0F, 0xEE,
+    0x61, 0xB4, 0x67, 0x35, 0xD2, 0xB4, 0x73, 0xED, 0x69, 0xD7, 0x24, 0x44, 0xBA, 0x6D, 0x46, 0x8C,
+    0x8F, 0x4D, 0x74, 0xD7, 0x6E, 0x25, 0xD0, 0x78, 0xE8, 0x46, 0xD3, 0xB5, 0xB3, 0x8B, 0x18, 0x01,
+    0xE9, 0x2D, 0x72, 0x49, 0xAC, 0xA0, 0x72, 0x22, 0x99, 0x3B, 0x2A, 0xB3, 0x32, 0xE2, 0x14, 0xA2,
+    0xF7, 0x72, 0x0E, 0x78, 0xE3, 0xE6, 0x7E, 0x53, 0x89, 0xDD, 0xA0, 0x24, 0x14, 0xAF, 0xF0, 0x3A,
+    0x67, 0xEE, 0x61, 0x4B, 0xB8, 0x92, 0x60, 0x49, 0x02, 0x33, 0x52, 0x4E, 0x20, 0x01, 0x76, 0xA4,
+    0xB0, 0x4A, 0x83, 0xB7, 0xEC, 0x40, 0x0A, 0xCB, 0x48, 0xAC, 0x5C, 0x9A, 0x92, 0x67, 0xA9, 0xC5,
+    0x1C, 0x56, 0xE1, 0x6F, 0x9B, 0xDE, 0xC5, 0xF8, 0x58, 0x8C, 0xA0, 0x27, 0xEB, 0x45, 0xA2, 0x29,
+    0x0B, 0x25, 0x24, 0xA8, 0x2B, 0xD2, 0xED, 0xE4, 0xDF, 0x9C, 0xE9, 0xCA, 0xE4, 0xB5, 0x92, 0xB2,
+    0x16, 0x93, 0x51, 0x9D, 0x4D, 0x98, 0x64, 0xB1, 0x7A, 0x26, 0x8B, 0xAD, 0x30, 0xAA, 0x47, 0xF1,
+    0x87, 0x15, 0x71, 0xA0, 0x86, 0x14, 0xF0, 0xAB, 0xCF, 0xB0, 0x88, 0xD2, 0x89, 0x62, 0x49, 0xEC,
+    0xB4, 0xBF, 0xED, 0x63, 0xE7, 0x02, 0x07, 0x88, 0x04, 0xB0, 0x2E, 0x14, 0xAF, 0x37, 0x96, 0xFB,
+    0x8A, 0xE7, 0x00, 0x33, 0x72, 0xBC, 0x38, 0x1C, 0x1E, 0xFA, 0x92, 0x50, 0xF7, 0x04, 0xF3, 0xFF,
+    0x2D, 0xC6, 0x41, 0x9C, 0x77, 0x9E, 0xAF, 0x6B, 0x6A, 0x6F, 0x1B, 0xA6, 0x39, 0xE8, 0x4A, 0xE6,
+    0xA1, 0x5C, 0xDA, 0xA8, 0x61, 0x5C, 0xD0, 0x21, 0xD6, 0x6D, 0xE1, 0x08, 0xD7, 0xD5, 0x9D, 0x8D,
+    0xA8, 0xCC, 0x49, 0xA7, 0x12, 0x69, 0x68, 0x31, 0xF9, 0xD9, 0x5F, 0x0F, 0xF8, 0x25, 0xFF, 0xC1,
+    0x91, 0x07, 0x37, 0x80, 0xBE, 0x15, 0xA7, 0x3A, 0x7E, 0x5F, 0xC0, 0x9C, 0x08, 0x02, 0xB6, 0x19,
+    0x81, 0xCB, 0x34, 0x5D, 0x7F, 0x43, 0xC3, 0x17, 0x59, 0x9B, 0x9C, 0x57, 0x10, 0x16, 0xCB, 0x4C,
+    0x94, 0x9B, 0x25, 0xC9, 0xF3, 0xCC, 0xDC, 0xA9, 0x2C, 0x3E, 0x81, 0x18, 0x68, 0x2E, 0x41, 0xD6,
+    0x3E, 0xC6, 0xA2, 0x4A, 0x30, 0x21, 0x5A, 0x8F, 0xEC, 0x0C, 0xFB, 0x6D, 0x97, 0x09, 0xC8, 0x5C,
+    0xCC, 0x10, 0x67, 0xFF, 0xEE, 0x24, 0xB5, 0x83, 0x16, 0x16, 0xA4, 0x0F, 0x96, 0x82, 0xF0, 0x6B,
+    0xAC, 0x04, 0x7E, 0xCA, 0xA3, 0x66, 0xBE, 0x38, 0x7B, 0xAA, 0xD1, 0xF3, 0xA0, 0xA6, 0x3B, 0x02,
+    0x59, 0xFE, 0xBB, 0x37, 0x49, 0x6D, 0x37, 0x37, 0xC8, 0xCE, 0x01, 0xEE, 0x66, 0x6F, 0x37, 0xDC,
+    0x01, 0x6D, 0xAC, 0x46, 0x0D, 0xC4, 0x6A, 0xCE, 0x7D, 0x2B, 0x20, 0xAA, 0xEB, 0x1C, 0xDA, 0x98,
+    0x1D, 0x75, 0x32, 0xA0, 0xC1, 0x84, 0x1F, 0x1C, 0x9F, 0xF2, 0x11, 0x9F, 0xB0, 0x67, 0xDF, 0x36,
+    0x8A, 0xFE, 0x73, 0x05, 0xCE, 0x26, 0xB9, 0xE8, 0xBC, 0x48, 0x6A, 0x79, 0x94, 0xB2, 0xDC, 0x83,
+    0x96, 0x56, 0xE3, 0xDA, 0xC6, 0x00, 0x77, 0xF1, 0x2A, 0xD1, 0x2D, 0xA1, 0xEC, 0x28, 0x13, 0xA2,
+    0x92, 0xF3, 0x6B, 0x1D, 0x2D, 0x9F, 0x1F, 0x63, 0x9E, 0xAB, 0xDC, 0x78, 0xCC, 0xE0, 0x72, 0xB9,
+    0x85, 0xD5, 0x3D, 0x25, 0xAF, 0x8D, 0xB8, 0x15, 0x07, 0xA0, 0x83, 0x4F, 0x78, 0x5C, 0xA1, 0x9A,
+    0x3B, 0x98, 0x77, 0x97, 0x8A, 0x04, 0x76, 0x51, 0xB7, 0x75, 0xAF, 0xC2, 0x0B, 0xEE, 0x4B, 0x08,
+    0xC4, 0xB9, 0x7F, 0xFB, 0xB5, 0xFB, 0xA3, 0x31, 0xDF, 0xC4, 0xF9, 0x68, 0xEA, 0xB0, 0xB2, 0xAC,
+    0xB4, 0x7F, 0xF2, 0x2F, 0x50, 0x5C, 0xA5, 0x2A, 0xA2, 0xEB, 0xF6, 0xCE, 0xE3, 0x51, 0x01, 0xB6,
+    0x75, 0xAA, 0x45, 0xF9, 0x73, 0x09, 0xCF, 0xDC, 0x40, 0x7C, 0x3E, 0x46, 0x68, 0x37, 0xD1, 0x8F,
+    0xD0, 0x3F, 0x5A, 0x7C, 0x8E, 0x6A, 0x5E, 0x0A, 0x8E, 0x0E, 0x5D, 0x77, 0xA1, 0x16, 0xB1, 0x9B,
+    0xD7, 0x5D, 0x79, 0x4B, 0xAC, 0x5F, 0x4A, 0x55, 0x6A, 0x90, 0xB0, 0xC8, 0x47, 0xA2, 0x16, 0x2F,
+    0x4A, 0xD1, 0x0B, 0xDB, 0x57, 0x99, 0x32, 0xBC, 0x7E, 0x0A, 0xB0, 0x6E, 0xFF, 0x79, 0x34, 0x49,
+    0x09, 0x1E, 0x4A, 0x03, 0x46, 0xDB, 0x87, 0x92, 0x1E, 0x1D, 0xFC, 0x75, 0x6B, 0xD6, 0xC2, 0x8A,
+    0xCA, 0x28, 0xA4, 0x8D, 0x5E, 0x69, 0xDA, 0xD8, 0xB3, 0x25, 0x7B, 0x2A, 0x29, 0x6E, 0x2D, 0xDF,
+    0x37, 0x34, 0x26, 0xBB, 0x04, 0xA9, 0xF7, 0x0C, 0x9E, 0xF9, 0xF2, 0x4C, 0xAF, 0x86, 0xB2, 0x31,
+    0xDD, 0x87, 0xE4, 0xBE, 0xC1, 0xE7, 0x00, 0xD5, 0x7F, 0xE0, 0xD7, 0x05, 0x7C, 0xB1, 0xEA, 0x19,
+    0xEC, 0x62, 0xD3, 0x27, 0x51, 0x03, 0xA0, 0xF3, 0x0B, 0x81, 0x95, 0x0A, 0x2E, 0x74, 0x67, 0x11,
+    0x5F, 0x25, 0x64, 0xD0, 0x40, 0x8D, 0x02, 0x56, 0x68, 0x91, 0xC2, 0x24, 0xBC, 0x28, 0x81, 0x74,
+    0x9D, 0xFE, 0xB7, 0xEB, 0x5F, 0xB5, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0xBD, 0xF6, 0xEC, 0x66,
+    0x04, 0x23, 0x31, 0x29, 0x80, 0x22, 0x8D, 0xEB, 0x20, 0xA1, 0x79, 0x84, 0x31, 0xD9, 0x22, 0x05,
+    0x05, 0x29, 0x42, 0xC5, 0x0B, 0x44, 0x34, 0xFB, 0x02, 0x64, 0x6D, 0xA5, 0xA1, 0xA0, 0xE0, 0x6B,
+    0xA0, 0xA1, 0x80, 0x22, 0x1D, 0x05, 0x14, 0x29, 0x03, 0x33, 0xD9, 0x2D, 0x52, 0xA4, 0xC0, 0x28,
+    0x12, 0x2D, 0x0E, 0x8A, 0xA8, 0x67, 0xC1, 0x1B, 0xCD, 0xC2, 0xD8, 0x97, 0x73, 0xBD, 0x3F, 0x5F,
+    0x14, 0x51, 0x21, 0x31, 0xEB, 0xCF, 0x5E, 0xCF, 0x78, 0xEE, 0xCF, 0x39, 0xE7, 0xDE, 0x21, 0xFA,
+    0xB8, 0x25, 0xEA, 0x78, 0x24, 0xC3, 0x9C, 0x28, 0xFC, 0xCE, 0x49, 0x4D, 0xD4, 0x8D, 0x86, 0x88,
+    0x23, 0x51, 0xC5, 0x44, 0xA4, 0x66, 0xDC, 0xEC, 0x84, 0x9B, 0x1F, 0x18, 0xE3, 0x7D, 0xFC, 0x8A,
+    0xC7, 0xED, 0x18, 0xAB, 0xFC, 0x69, 0x21, 0x5D, 0xDC, 0x48, 0x7E, 0x0C, 0xB1, 0xE6, 0x8A, 0xDB,
+    0x2E, 0x29, 0xAC, 0x91, 0x66, 0x18, 0xAD, 0x39, 0x63, 0xDB, 0x55, 0xFC, 0x68, 0xF7, 0x16, 0xA6,
+    0x06, 0x2C, 0xB5, 0xFC, 0x51, 0xB1, 0xAD, 0x8B, 0x9B, 0xBA, 0x60, 0x1D, 0x7B, 0x4A, 0xCD, 0xFB,
+    0x31, 0xEC, 0x65, 0x17, 0xBB, 0xBD, 0xC9, 0xA6, 0xAE, 0x9E, 0xF5, 0x69, 0xE8, 0x3D, 0x0F, 0x04,
+    0x0B, 0xD4, 0xCA, 0xE6, 0x6F, 0xAE, 0x21, 0x82, 0x67, 0x88, 0x23, 0x7C, 0x9E, 0xA8, 0x2A, 0xAE,
+    0xC7, 0xFC, 0x6A, 0x15, 0xE3, 0xCA, 0x7D, 0x82, 0xE5, 0x05, 0x6B, 0xF0, 0x6A, 0x96, 0x7D, 0x26,
+    0xDF, 0xEA, 0x85, 0xBE, 0x27, 0x5B, 0xB0, 0xDA, 0xA4, 0x35, 0x6E, 0xDC, 0xB8, 0x95, 0x54, 0x2C,
+    0x62, 0x9B, 0xF0, 0x25, 0x1F, 0x49, 0x2A, 0x58, 0xB5, 0xB9, 0x8B, 0xD4, 0x1D, 0x2E, 0xA4, 0x16,
+    0x53, 0xC8, 0xA5, 0x66, 0xD2, 0xB0, 0x20, 0x60, 0x74, 0x62, 0xD4, 0x31, 0x7C, 0x55, 0xE7, 0xAE,
+    0xF4, 0xF8, 0x90, 0xD8, 0x0D, 0xF6, 0xB7, 0x42, 0x0F, 0xDE, 0xA0, 0x8B, 0xF1, 0x21, 0x00, 0x9C,
+    0xB1, 0x65, 0xB2, 0x27, 0x21, 0x4E, 0x75, 0x79, 0x8D, 0x5C, 0x24, 0x07, 0x5B, 0x1C, 0xDD, 0x8B,
+    0x62, 0x26, 0x7F, 0xAF, 0xE8, 0xC9, 0xB7, 0xAC, 0x93, 0x1B, 0xBA, 0xAF, 0xB2, 0xE2, 0x99, 0x2C,
+    0x2C, 0xEF, 0x9C, 0xED, 0x96, 0xD4, 0x64, 0x2C, 0xCD, 0xB0, 0x3E, 0x25, 0x43, 0x19, 0xCD, 0x61,
+    0x3E, 0x5B, 0xB8, 0x4C, 0x74, 0x1D, 0x77, 0xD6, 0x94, 0x37, 0xD4, 0x0D, 0x96, 0x47, 0x64, 0xE8,
+    0x8A, 0x86, 0x63, 0x6E, 0x35, 0xF7, 0x08, 0x0C, 0x9C, 0xDD, 0x4C, 0x06, 0x7F, 0x1B, 0xA2, 0x1F,
+    0x54, 0xD1, 0x62, 0xCA, 0xF6, 0x8B, 0x92, 0xA7, 0x4A, 0xDD, 0x0D, 0x21, 0x91, 0x1E, 0xBA, 0x47,
+    0xAB, 0xE9, 0xE6, 0xEB, 0x13, 0x41, 0x88, 0x00, 0xC9, 0xB2, 0x3E, 0x17, 0x16, 0xCE, 0xC9, 0xE4,
+    0xEE, 0xA6, 0x7C, 0x68, 0x8A, 0x8B, 0xC2, 0xBF, 0x2E, 0x36, 0x79, 0x2C, 0xE8, 0x45, 0x65, 0x9D,
+    0x05, 0x6C, 0x5A, 0x04, 0x4D, 0x3C, 0xBB, 0xD6, 0x25, 0x28, 0x87, 0xDC, 0xA0, 0x16, 0xD8, 0x69,
+    0x03, 0x53, 0x18, 0x6B, 0xC1, 0xAF, 0x37, 0xF9, 0x3C, 0xC3, 0x97, 0xC2, 0xB7, 0x8F, 0xC4, 0x6E,
+    0x5D, 0x7C, 0x2F, 0xA4, 0x3C, 0x96, 0x97, 0x6A, 0xBC, 0x4E, 0xAF, 0x8C, 0x5B, 0xD8, 0x72, 0x9B,
+    0xC2, 0xE0, 0xDA, 0x6E, 0xF4, 0xAC, 0x92, 0x63, 0xC3, 0x93, 0xD7, 0x3C, 0x4E, 0xFE, 0xB3, 0xB1,
+    0xEC, 0xEC, 0xD6, 0xA7, 0xB3, 0xC7, 0x67, 0x2E, 0x3C, 0x81, 0x3C, 0x6A, 0x9E, 0x25, 0x09, 0xBF,
+    0x86, 0xAE, 0x5E, 0xB0, 0xBC, 0x1C, 0xF8, 0x5F, 0xF1, 0x62, 0x8F, 0x4E, 0x4A, 0xAD, 0x54, 0x3A,
+    0x68, 0x9E, 0x4D, 0x61, 0x36, 0x90, 0xAE, 0xE5, 0xBE, 0x00, 0x22, 0x40, 0xD7, 0xFB, 0xF1, 0x4C,
+    0x58, 0x08, 0x60, 0x73, 0x5D, 0x22, 0x8A, 0x24, 0x62, 0xF0, 0x7B, 0x13, 0xC8, 0xBE, 0xBA, 0x15,
+    0x56, 0x80, 0x04, 0x05, 0x1E, 0xFF, 0x05, 0x47, 0x1B, 0x9B, 0xA4, 0x07, 0x55, 0x08, 0x53, 0x42,
+    0x14, 0x92, 0x80, 0x74, 0xDE, 0x81, 0x40, 0x40, 0x05, 0x41, 0xD9, 0x52, 0x2F, 0x20, 0xD1, 0x02,
+    0x23, 0xB5, 0xD4, 0xB0, 0x78, 0x0F, 0x16, 0x01, 0xA1, 0xA4, 0xC1, 0x69, 0x2D, 0x08, 0xC7, 0x60,
+    0xE6, 0xCD, 0xF3, 0x44, 0x0F, 0x4C, 0x54, 0x25, 0xB4, 0x22, 0xA7, 0x77, 0xEB, 0xFE, 0x65, 0x3D,
+    0x79, 0x21, 0x14, 0x30, 0x7E, 0x39, 0xD3, 0x88, 0x7A, 0xA4, 0x26, 0x52, 0x35, 0xAF, 0xD6, 0x91,
+    0x03, 0xBD, 0x25, 0xAE, 0x99, 0x36, 0xAA, 0x98, 0xD8, 0x8C, 0xFE, 0x17, 0xA6, 0xB5, 0x76, 0xE7,
+    0x4B, 0x4D, 0x49, 0xF1, 0x2D, 0x52, 0x0F, 0xC9, 0xF2, 0xB7, 0x0B, 0x15, 0xC4, 0x6A, 0x7B, 0xD4,
+    0x68, 0x02, 0x29, 0x54, 0x0B, 0xD9, 0x1D, 0x2C, 0x34, 0x30, 0xAC, 0xB0, 0x11, 0xDE, 0x00, 0x97,
+    0x99, 0xCF, 0x0B, 0x05, 0xE5, 0xFE, 0x00, 0x61, 0xFB, 0x5E, 0x17, 0x35, 0xA3, 0x9E, 0x11, 0xFB,
+    0x58, 0xA1, 0x68, 0xCE, 0x8B, 0xB9, 0xDD, 0xBA, 0x28, 0xE2, 0x22, 0x42, 0x3E, 0x99, 0x72, 0xB5,
+    0x50, 0x43, 0xE0, 0xB5, 0xB5, 0x20, 0x45, 0xC9, 0x87, 0x82, 0x91, 0xC8, 0xC6, 0x48, 0x05, 0x05,
+    0x79, 0xDB, 0x97, 0xE9, 0x20, 0x3C, 0x95, 0xF3, 0x35, 0x55, 0x2A, 0x14, 0x5F, 0x7B, 0x40, 0x16,
+    0xA1, 0x69, 0x29, 0x22, 0x6E, 0x2B, 0xA1, 0xB2, 0xFA, 0xF1, 0x0C, 0x0F, 0x96, 0xCD, 0x30, 0xB1,
+    0x0A, 0xB4, 0xE1, 0x89, 0xFE, 0x75, 0x00, 0x7B, 0x81, 0xDF, 0x32, 0xE8, 0xCD, 0xD0, 0xA9, 0x5C,
+    0xD2, 0xB1, 0xA4, 0x69, 0x81, 0x22, 0xB8, 0xAC, 0x64, 0x55, 0xA4, 0x4D, 0x92, 0x84, 0x1F, 0x1A,
+    0x21, 0x8A, 0xEB, 0x85, 0x45, 0xDE, 0xEE, 0x31, 0xE2, 0x71, 0x7F, 0x16, 0x68, 0x19, 0x0E, 0x23,
+    0x5C, 0x2A, 0xCE, 0xD2, 0xF5, 0xA0, 0x68, 0x8B, 0xB9, 0x6E, 0x12, 0x2B, 0x90, 0xB5, 0x40, 0x07,
+    0x76, 0x85, 0xE0, 0xEE, 0x39, 0x85, 0xE7, 0x88, 0x28, 0x3B, 0x04, 0xC5, 0x3C, 0xAC, 0xFA, 0x33,
+    0x62, 0x5C, 0xFE, 0xB3, 0x9C, 0xB7, 0xD1, 0xED, 0x42, 0xD2, 0xCD, 0x4C, 0x08, 0x71, 0xB4, 0xE9,
+    0xED, 0x59, 0x90, 0x8A, 0x6E, 0xA8, 0x0B, 0x50, 0x00, 0xCC, 0x51, 0x4F, 0x28, 0xAA, 0x40, 0xE2,
+    0x0A, 0x0A, 0x5C, 0x14, 0x53, 0x33, 0x84, 0x74, 0xA3, 0xB8, 0xEE, 0x13, 0xC7, 0x4F, 0xF8, 0x90,
+    0x53, 0x97, 0x6C, 0x56, 0x17, 0xE5, 0x44, 0x77, 0x5E, 0x17, 0x0A, 0xCC, 0x24, 0x88, 0x92, 0x3F,
+    0x5A, 0x4B, 0x78, 0xB1, 0x6B, 0xF3, 0x68, 0x77, 0x5E, 0x45, 0x66, 0x85, 0x04, 0x7E, 0x38, 0x79,
+    0xA8, 0xAF, 0xC9, 0x72, 0x09, 0xCB, 0xB8, 0x00, 0x49, 0xBD, 0xA6, 0x4F, 0x5E, 0xD2, 0x1F, 0x95,
+    0x74, 0x5B, 0xB4, 0x6F, 0x54, 0x36, 0x84, 0xF5, 0x77, 0x91, 0xDE, 0x19, 0xA4, 0x7D, 0x86, 0x9F,
+    0x12, 0x10, 0x14, 0x8C, 0x25, 0x7D, 0x24, 0x01, 0x54, 0xFD, 0x2C, 0xFC, 0x41, 0x90, 0x72, 0x42,
+    0xA0, 0x6F, 0x8A, 0xB0, 0xBC, 0x1C, 0x02, 0x98, 0xDB, 0xD4, 0x10, 0x39, 0x8E, 0x94, 0xB0, 0xB6,
+    0xFB, 0x3D, 0xE6, 0x8B, 0x60, 0xEE, 0x1A, 0x20, 0xF3, 0x07, 0x74, 0x3C, 0xA3, 0x41, 0x9A, 0xF7,
+    0xC6, 0xFF, 0x0B, 0xA2, 0x6B, 0x35, 0x8A, 0xAC, 0x79, 0x8A, 0x0C, 0x6C, 0x62, 0x51, 0xA3, 0x07,
+    0x62, 0x57, 0xAB, 0x4B, 0x6F, 0x72, 0xE4, 0x41, 0xBE, 0xAD, 0x74, 0xBE, 0x09, 0x1C, 0x7E, 0x07,
+    0x71, 0xCC, 0x68, 0x5C, 0x68, 0xA7, 0xB6, 0xA0, 0x0E, 0x6A, 0x04, 0x0D, 0x86, 0x7F, 0xC6, 0x17,
+    0x4D, 0x46, 0xEA, 0x7A, 0xF6, 0x38, 0x75, 0xF8, 0x03, 0x18, 0x0C, 0x4F, 0xB1, 0xE2, 0x93, 0x50,
+    0x9C, 0x31, 0x69, 0x66, 0xEC, 0x51, 0x5C, 0x73, 0x8F, 0x98, 0x7C, 0xD6, 0xDC, 0xE2, 0x18, 0xC5,
+    0x36, 0x39, 0x8A, 0xE8, 0x0A, 0x9F, 0xD2, 0xF6, 0xEC, 0x40, 0xFF, 0xBD, 0x4B, 0xF6, 0x18, 0x6D,
+    0xF2, 0x78, 0x26, 0xDD, 0xDF, 0xDF, 0x26, 0x7F, 0x5B, 0x94, 0x0D, 0x95, 0x72, 0xC2, 0x41, 0x88,
+    0x4C, 0x0D, 0xFA, 0xAD, 0x2E, 0xCD, 0xA8, 0x0A, 0xDA, 0x2A, 0x3A, 0x93, 0xCE, 0x3E, 0xE2, 0x14,
+    0x89, 0xD2, 0x85, 0x51, 0xEE, 0x43, 0x17, 0xDD, 0x5F, 0xAB, 0xD8, 0x11, 0xE8, 0xB8, 0xED, 0x26,
+    0xFF, 0x69, 0xFC, 0x03, 0xC5, 0x55, 0xBF, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0x7B, 0xC3, 0x19, 0x9D,
+    0x8B, 0xBD, 0x22, 0x44, 0x28, 0x41, 0x31, 0x25, 0xD0, 0xF8, 0x3F, 0xB8, 0x75, 0x92, 0x92, 0x22,
+    0x29, 0xF8, 0x51, 0x44, 0x88, 0x86, 0x02, 0xD1, 0xA4, 0xA5, 0x39, 0xD9, 0x97, 0x14, 0x57, 0xD0,
+    0x44, 0x42, 0x0A, 0x6D, 0x8A, 0xAB, 0xEE, 0x8A, 0xFB, 0x07, 0x90, 0xD6, 0x12, 0xC5, 0x57, 0x50,
+    0x60, 0x38, 0x09, 0xCA, 0x18, 0x44, 0x15, 0x9A, 0x8D, 0x64, 0x09, 0xDF, 0x61, 0x7B, 0x78, 0xCF,
+    0xFE, 0xBE, 0xCB, 0x01, 0x1D, 0x4D, 0xF6, 0x4E, 0xA3, 0xCF, 0xF6, 0xEC, 0x9B, 0xF7, 0x66, 0x67,
+    0x66, 0x45, 0xB6, 0x0E, 0x45, 0xA4, 0xD4, 0x4E, 0x44, 0x55, 0x8B, 0x48, 0xCF, 0x35, 0x88, 0xD6,
+    0xE9, 0x04, 0x83, 0x7F, 0x5F, 0x4B, 0xD6, 0xB9, 0x56, 0xCC, 0x98, 0xD1, 0xE3, 0xAB, 0xE9, 0xE8,
+    0xC8, 0x9F, 0xC2, 0x51, 0x3B, 0x9A, 0x11, 0x5F, 0x62, 0xB5, 0x3D, 0xBE, 0x3C, 0x9A, 0x80, 0xD2,
+    0x60, 0x8F, 0x0B, 0x79, 0x07, 0x63, 0xB4, 0x28, 0x3B, 0xF1, 0x70, 0x94, 0x54, 0x01, 0x29, 0x0F,
+    0xF4, 0x31, 0x02, 0xED, 0x08, 0xD7, 0x07, 0x8C, 0xC8, 0xF7, 0xE2, 0x7F, 0x19, 0x93, 0xDE, 0x0C,
+    0xAE, 0xB6, 0x2F, 0x46, 0x71, 0xDF, 0x4F, 0x47, 0xEA, 0x54, 0x7B, 0x45, 0x90, 0x5E, 0xD4, 0xB6,
+    0x49, 0xEF, 0x6A, 0x57, 0xFB, 0x3F, 0x06, 0x90, 0xAB, 0xC5, 0x23, 0xD0, 0x55, 0xEE, 0xBF, 0x1E,
+    0x03, 0x2B, 0x3B, 0x1D, 0x44, 0x6C, 0x50, 0x11, 0xD3, 0xBB, 0x02, 0xD0, 0x91, 0x6C, 0xD6, 0x17,
+    0x78, 0x4C, 0xA0, 0x46, 0x2C, 0xE3, 0x67, 0x7A, 0xA2, 0x62, 0x07, 0xF1, 0x2D, 0x8C, 0x1D, 0xD2,
+    0x41, 0x22, 0xBD, 0x03, 0xBA, 0xEE, 0x47, 0x7A, 0xF4, 0xFE, 0xF9, 0xD1, 0xF1, 0xE8, 0x28, 0xE7,
+    0x2E, 0xCD, 0x29, 0xBE, 0xE4, 0x41, 0x2B, 0x7C, 0x81, 0xBA, 0x64, 0xC4, 0x1E, 0xA3, 0xB1, 0x16,
+    0x46, 0xC5, 0x75, 0x89, 0x16, 0x29, 0xD3, 0x44, 0x61, 0x22, 0x5B, 0x7A, 0x86, 0x60, 0x17, 0x61,
+    0x4D, 0xD8, 0x13, 0xFB, 0x62, 0x12, 0x4A, 0x49, 0xAA, 0xC3, 0x0B, 0x36, 0x94, 0x9B, 0x91, 0xBE,
+    0x86, 0x58, 0x3F, 0xED, 0xA8, 0xD7, 0x06, 0x33, 0x64, 0x8D, 0x19, 0xF2, 0xF3, 0xE3, 0x81, 0x82,
+    0xDD, 0xF3, 0x93, 0xCE, 0x55, 0x36, 0xB8, 0x2A, 0x6B, 0xA9, 0x38, 0x3F, 0x07, 0x63, 0x1D, 0x90,
+    0xDC, 0x76, 0x2D, 0xF9, 0x70, 0x9B, 0x62, 0xC9, 0x7A, 0x85, 0x2C, 0x8C, 0x59, 0x2D, 0x52, 0x5C,
+    0x59, 0xE3, 0x5F, 0x3B, 0x64, 0x00, 0x5D, 0x4E, 0xD0, 0x9C, 0xDD, 0xC7, 0x5E, 0x1E, 0xE0, 0x1E,
+    0x45, 0x07, 0xC9, 0x02, 0x0F, 0xB8, 0x81, 0x01, 0xEF, 0x0F, 0x3F, 0x1E, 0x99, 0x19, 0x26, 0x45,
+    0x1B, 0x79, 0xE3, 0x23, 0x6C, 0xA2, 0x17, 0x1D, 0xDE, 0xA2, 0xCE, 0x5E, 0xF2, 0xCE, 0x76, 0xB1,
+    0x56, 0x64, 0x85, 0x43, 0xC2, 0x96, 0x1C, 0x8E, 0x12, 0x15, 0xEB, 0x58, 0xDF, 0xDA, 0x2A, 0xE9,
+    0x54, 0xF2, 0xEF, 0x7A, 0x79, 0x37, 0xA9, 0x2E, 0x4B, 0x74, 0x4A, 0x64, 0x71, 0xDF, 0x4C, 0x02,
+    0x75, 0x11, 0xD8, 0xE2, 0x5D, 0x1D, 0xEB, 0xA2, 0xE4, 0xBD, 0x13, 0x3C, 0x96, 0xC5, 0xE3, 0x78,
+    0x48, 0x6B, 0x68, 0xFC, 0x59, 0x41, 0xB6, 0x15, 0x3F, 0x8A, 0xCC, 0x2A, 0x14, 0x09, 0x47, 0xB8,
+    0x40, 0x21, 0x9D, 0xFC, 0x6B, 0x01, 0xC3, 0xB0, 0xE0, 0x0A, 0x1D, 0x92, 0x49, 0xD2, 0x4E, 0xB4,
+    0x32, 0x9D, 0xE4, 0x6D, 0x3C, 0x48, 0x32, 0x44, 0x60, 0xAF, 0x02, 0x9C, 0xBC, 0xF1, 0x38, 0xF5,
+    0xDE, 0x11, 0x8D, 0xF5, 0x90, 0x3F, 0xAB, 0x59, 0x05, 0x35, 0x9F, 0xA9, 0xDE, 0x31, 0x0F, 0x29,
+    0xCC, 0x15, 0x6C, 0x96, 0xE4, 0xA0, 0x27, 0x70, 0xCF, 0xAF, 0x34, 0xD9, 0x1C, 0x75, 0xAD, 0x32,
+    0x23, 0x11, 0x47, 0x93, 0xD3, 0xBC, 0x5C, 0xF7, 0xF0, 0x97, 0x8E, 0x66, 0x84, 0x47, 0x3C, 0xC9,
+    0x35, 0x8D, 0x90, 0x3F, 0x5F, 0xB0, 0xF4, 0x6F, 0x81, 0x81, 0xDB, 0x07, 0x17, 0xF7, 0x10, 0x70,
+    0xEE, 0x11, 0xE0, 0xF2, 0x15, 0x01, 0x7E, 0x40, 0xEC, 0xEC, 0x59, 0x45, 0x50, 0x22, 0x8F, 0x34,
+    0x73, 0x40, 0x02, 0x3B, 0xB2, 0x2B, 0x45, 0x5E, 0x8F, 0x28, 0xE0, 0xA4, 0x63, 0x54, 0xBC, 0x72,
+    0x13, 0xA9, 0xB6, 0x73, 0xC8, 0xCF, 0xB7, 0x40, 0xAA, 0x7C, 0x9F, 0x50, 0x2C, 0xF8, 0xB4, 0x25,
+    0xC2, 0xC5, 0xD1, 0xCF, 0xCB, 0x6B, 0x8D, 0x56, 0xD4, 0xC6, 0x81, 0x4F, 0x15, 0xA3, 0x8F, 0x5A,
+    0xE4, 0x23, 0xED, 0xC5, 0xA3, 0xD0, 0x89, 0x8E, 0x8A, 0x2A, 0x90, 0xB6, 0xBC, 0x96, 0x68, 0xB2,
+    0x84, 0x27, 0xA7, 0xF4, 0x4F, 0x40, 0x46, 0xB3, 0x3C, 0xD7, 0x6D, 0xAA, 0x00, 0x19, 0x45, 0x3D,
+    0x23, 0x42, 0xF4, 0x2B, 0x29, 0x78, 0x9A, 0x99, 0x4C, 0xC2, 0xA8, 0xEB, 0xEE, 0x5D, 0x96, 0x7D,
+    0xD8, 0xAD, 0x8B, 0xD1, 0x1D, 0xE0, 0xD7, 0x4D, 0xB6, 0xE4, 0x2B, 0x4D, 0xD4, 0xB2, 0xBE, 0x8C,
+    0x01, 0xE3, 0x0D, 0x8B, 0x62, 0x85, 0x8F, 0x7A, 0x00, 0xFF, 0x29, 0x81, 0xFF, 0x3B, 0xD2, 0x5C,
+    0x72, 0x4B, 0x75, 0xB0, 0x7A, 0xAA, 0xA3, 0xD1, 0x80, 0x20, 0x79, 0x63, 0xD0, 0xB6, 0x8D, 0xF8,
+    0x2A, 0x65, 0xBF, 0x24, 0x41, 0xCC, 0xC0, 0x22, 0xF1, 0xB7, 0x81, 0x93, 0xB5, 0x30, 0x66, 0x20,
+    0x1F, 0x5F, 0xCA, 0x9A, 0x1E, 0xC6, 0x1B, 0x2B, 0x87, 0xAC, 0x90, 0x56, 0xD9, 0xC1, 0x66, 0xB9,
+    0x99, 0xB5, 0x04, 0x6E, 0xF9, 0xB5, 0xDD, 0xF4, 0x5C, 0xF4, 0x8F, 0x4A, 0x7E, 0xFA, 0x26, 0xDE,
+    0xF4, 0xBB, 0x1C, 0x59, 0x20, 0x97, 0xFE, 0x46, 0xF8, 0x03, 0xE8, 0xDB, 0x4D, 0xA1, 0xFB, 0x6A,
+    0xF4, 0x0A, 0xB3, 0xF7, 0xD9, 0x36, 0x04, 0xF9, 0xB9, 0x67, 0x57, 0x9C, 0xAB, 0xCD, 0xF0, 0x9F,
+    0x32, 0x53, 0x5D, 0xE9, 0xE4, 0xF4, 0x27, 0x65, 0x99, 0x21, 0x02, 0x9A, 0x7B, 0x22, 0x3E, 0x66,
+    0x62, 0xFF, 0xF2, 0xA1, 0xC2, 0x7C, 0xCD, 0x03, 0xF2, 0x99, 0xEA, 0x13, 0x24, 0x49, 0x39, 0xB8,
+    0xED, 0x7C, 0x03, 0x5C, 0xBF, 0x4F, 0x42, 0x66, 0x92, 0x65, 0x14, 0x81, 0x51, 0xBD, 0x21, 0x38,
+    0xF3, 0x2D, 0x97, 0xAE, 0xEB, 0x97, 0x68, 0x51, 0xE7, 0x50, 0xAE, 0x48, 0x6E, 0x79, 0x37, 0xC8,
+    0xF6, 0xAD, 0xF6, 0x72, 0x6D, 0xC9, 0x8D, 0x11, 0xB7, 0x03, 0x6E, 0x98, 0xFD, 0x07, 0x75, 0x5E,
+    0xA7, 0x01, 0xE3, 0xB4, 0x37, 0xBD, 0x4C, 0xA0, 0xE0, 0xF6, 0xB5, 0xB0, 0x7F, 0x29, 0xE7, 0x4E,
+    0x90, 0x1B, 0x5F, 0x03, 0x2C, 0x9A, 0x4F, 0xEE, 0x13, 0x42, 0xF3, 0x42, 0xA8, 0x50, 0xF4, 0xC5,
+    0x7A, 0xEA, 0x30, 0x35, 0xAA, 0xD3, 0x62, 0x12, 0x3D, 0x1E, 0x71, 0xCF, 0x09, 0x87, 0xCA, 0x62,
+    0x7A, 0x36, 0x51, 0x10, 0x3B, 0xB7, 0x47, 0xD8, 0x70, 0xCD, 0xE7, 0x8C, 0x92, 0x8F, 0x6B, 0x2E,
+    0x72, 0x4B, 0xE3, 0xE7, 0x51, 0x53, 0xB1, 0xAB, 0x7E, 0xE7, 0x39, 0xF0, 0x94, 0x68, 0x70, 0xD8,
+    0x34, 0xDD, 0x7C, 0x45, 0xB0, 0x97, 0xB8, 0x2D, 0xA1, 0xF3, 0x3C, 0x40, 0x5F, 0xBB, 0x87, 0xBB,
+    0xB1, 0x80, 0x78, 0xF7, 0x64, 0xB4, 0x18, 0x91, 0x84, 0x2D, 0x03, 0x6E, 0xAB, 0x58, 0x1B, 0x94,
+    0x19, 0xF2, 0x15, 0x4D, 0xF2, 0x76, 0x59, 0xED, 0x66, 0xE7, 0xFE, 0x0E, 0xB2, 0x99, 0x9F, 0x05,
+    0xD9, 0xD9, 0x03, 0x0F, 0xF4, 0x74, 0x43, 0x44, 0x0C, 0x44, 0x79, 0x2A, 0xFF, 0x6F, 0xFD, 0x0D,
+    0xAD, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0xE3, 0xF3, 0x4A, 0x3E, 0x91, 0x71, 0x61,
+    0x90, 0x88, 0x64, 0xB6, 0xA2, 0x40, 0x20, 0x6D, 0x43, 0x4B, 0x66, 0x8D, 0x0B, 0x4B, 0x34, 0x9C,
+    0x80, 0x28, 0x08, 0x09, 0xC9, 0x65, 0x44, 0x43, 0xE3, 0x12, 0x3C, 0xEB, 0x50, 0xD0, 0xBA, 0x22,
+    0x12, 0xD5, 0x15, 0x44, 0x20, 0x5B, 0xA2, 0x4E, 0x41, 0xB2, 0x1B, 0x47, 0x28, 0x05, 0x45, 0x36,
+    0x82, 0xCE, 0x05, 0x5B, 0x80, 0x82, 0xD2, 0x64, 0x12, 0x2D, 0x64, 0x1D, 0x66, 0xF7, 0xF1, 0xBD,
+    0xB9, 0xCB, 0x0F, 0x24, 0x11, 0x51, 0x60, 0x74, 0x33, 0x77, 0xFB, 0x76, 0xE6, 0xBD, 0xEF, 0xFB,
+    0xE6, 0xBD, 0x77, 0x44, 0x14, 0x17, 0xA7, 0x49, 0x86, 0xF9, 0xBC, 0x95, 0xAF, 0x78, 0x30, 0xB5,
+    0x7C, 0x27, 0xEE, 0x62, 0x30, 0x47, 0x94, 0xD3, 0x23, 0x43, 0x73, 0x1F, 0xA6, 0x61, 0x17, 0x66,
+    0xDA, 0x11, 0xA5, 0x1E, 0x3E, 0x2A, 0xCC, 0x9A, 0x22, 0xC6, 0x1E, 0xCC, 0x04, 0xE6, 0x04, 0xE6,
+    0x0C, 0x1E, 0xB3, 0x26, 0x98, 0x88, 0x0B, 0x52, 0xC3, 0x57, 0xA4, 0x7A, 0x9C, 0x60, 0xA6, 0xD4,
+    0x11, 0x95, 0x37, 0x99, 0x6C, 0x05, 0x93, 0x1A, 0xE2, 0x01, 0xCE, 0x5D, 0xE2, 0x75, 0x2B, 0xCE,
+    0x52, 0x37, 0x73, 0x66, 0x2F, 0xE1, 0xE4, 0xB8, 0x8B, 0x87, 0xB1, 0xC4, 0xA8, 0x61, 0x6E, 0x60,
+    0xDE, 0xE7, 0x1D, 0xAE, 0xC9, 0x32, 0xB7, 0x86, 0x1B, 0xC5, 0x7C, 0x14, 0x33, 0xFF, 0x13, 0x6B,
+    0xEC, 0x4E, 0x60, 0xB5, 0x6F, 0x23, 0xCA, 0xD8, 0xC1, 0x37, 0xBD, 0x92, 0x14, 0x0F, 0xBF, 0x1F,
+    0xC9, 0x81, 0x14, 0x2F, 0xB2, 0xCB, 0xDC, 0x90, 0xF2, 0x2F, 0xF4, 0x12, 0x37, 0xAB, 0x00, 0x5D,
+    0x21, 0x56, 0x99, 0x9B, 0x2F, 0x0B, 0xE0, 0x81, 0x63, 0x06, 0x4C, 0x9F, 0x36, 0xBA, 0x49, 0xAF,
+    0xF5, 0x34, 0x50, 0x9F, 0x55, 0xBA, 0xD6, 0x3F, 0x7A, 0xEA, 0x63, 0x6F, 0xAE, 0xEA, 0xDF, 0xCB,
+    0x0D, 0x76, 0x25, 0xD7, 0xD6, 0x47, 0xC0, 0x02, 0x7F, 0x0F, 0x80, 0x18, 0xE6, 0x61, 0xB6, 0x24,
+    0xBC, 0xDF, 0x0B, 0x71, 0x2F, 0xA2, 0x84, 0xA5, 0x03, 0x2B, 0x6A, 0x48, 0xD8, 0x82, 0x36, 0x11,
+    0x58, 0x38, 0x6C, 0x03, 0x14, 0x02, 0xC5, 0xA0, 0xE5, 0x4C, 0x54, 0xD1, 0x07, 0x70, 0xAA, 0x99,
+    0x80, 0x20, 0xFF, 0x93, 0xC8, 0x37, 0x04, 0xEF, 0x12, 0x24, 0xBD, 0xB7, 0x2C, 0x18, 0x2C, 0x59,
+    0x2F, 0xC7, 0x3A, 0x31, 0xED, 0x0A, 0xC9, 0x09, 0x54, 0xCA, 0xE1, 0xDA, 0x7E, 0xD1, 0x3F, 0x47,
+    0x36, 0x5F, 0xCE, 0xAA, 0x97, 0x0C, 0x14, 0x6B, 0x62, 0xAE, 0x14, 0xD7, 0xAA, 0xFF, 0x24, 0x1A,
+    0x46, 0x2B, 0xB6, 0xC8, 0xD2, 0xBB, 0xE5, 0x65, 0xC8, 0x99, 0x0D, 0xDF, 0xD1, 0x32, 0x9C, 0x8D,
+    0xAB, 0x78, 0xA3, 0x21, 0xB9, 0x62, 0x47, 0x51, 0xFE, 0x80, 0x4F, 0x8D, 0x98, 0x86, 0x2B, 0xDC,
+    0xFF, 0x78, 0x10, 0x88, 0x0A, 0xDA, 0xE4, 0xC0, 0x14, 0x49, 0x58, 0x0E, 0x69, 0x64, 0x7F, 0x0E,
+    0xF0, 0x05, 0x6B, 0x90, 0x17, 0xF4, 0x7C, 0x80, 0x18, 0x56, 0x13, 0x2C, 0x83, 0x20, 0x57, 0x9D,
+    0xEC, 0xD1, 0x4E, 0xF8, 0x99, 0x4A, 0x48, 0x97, 0xA2, 0x04, 0xF2, 0x60, 0xDC, 0x52, 0xC6, 0x35,
+    0x52, 0x08, 0xA1, 0x54, 0x38, 0x16, 0x87, 0x55, 0x09, 0xAF, 0x63, 0x49, 0x1B, 0xFC, 0x4B, 0x94,
+    0x2C, 0x44, 0x19, 0x1F, 0x09, 0x53, 0x5C, 0x68, 0xDA, 0xAA, 0x21, 0x01, 0xBA, 0xC6, 0xF6, 0xD0,
+    0x21, 0xBD, 0x2E, 0x79, 0x27, 0x79, 0xC8, 0x73, 0x3D, 0xE3, 0x20, 0x8E, 0x93, 0x24, 0xC6, 0xC3,
+    0x9F, 0x1D, 0xBD, 0x7C, 0xD1, 0x40, 0x86, 0x83, 0x9E, 0xAC, 0xD3, 0x0E, 0x91, 0x98, 0x16, 0x68,
+    0xE6, 0x1E, 0x9C, 0x55, 0x4B, 0x51, 0x63, 0x03, 0x6B, 0x8A, 0x19, 0xD6, 0xC5, 0x5F, 0xE8, 0x59,
+    0x95, 0x18, 0x7D, 0xCC, 0x27, 0x43, 0xD6, 0xB3, 0xFC, 0x1E, 0x4E, 0xFE, 0xBB, 0x12, 0x69, 0x50,
+    0x22, 0x3D, 0x12, 0x25, 0x98, 0x0B, 0xC3, 0x97, 0x24, 0xC5, 0x1F, 0x65, 0xA9, 0x85, 0x65, 0xD9,
+    0x49, 0x02, 0x11, 0x2D, 0x95, 0x37, 0x76, 0x23, 0x06, 0xA6, 0x91, 0xFD, 0x35, 0x9F, 0xB3, 0x6C,
+    0xEF, 0xB1, 0xE4, 0xCE, 0xBA, 0x94, 0xD7, 0x3D, 0x95, 0xF5, 0x82, 0x84, 0xFE, 0x60, 0xEF, 0xFE,
+    0x98, 0x4E, 0x4E, 0x7D, 0x98, 0xE6, 0xCE, 0x7C, 0x7F, 0x6E, 0x89, 0xA6, 0x4F, 0xFE, 0x84, 0xE6,
+    0x90, 0xD3, 0x2A, 0xD1, 0xEB, 0x1F, 0xED, 0x1F, 0xEE, 0x5D, 0x98, 0x26, 0x6F, 0x45, 0xF5, 0x74,
+    0x0B, 0x2F, 0xA6, 0xF4, 0xB4, 0xCB, 0x6C, 0xAC, 0xC2, 0x4F, 0x54, 0xD1, 0xF6, 0xDE, 0xD9, 0x1B,
+    0xDF, 0xAE, 0xD2, 0xE6, 0xD6, 0x22, 0xD5, 0x9B, 0xB4, 0x48, 0xF4, 0xF4, 0x8B, 0xDC, 0x3B, 0x7B,
+    0xE6, 0xAB, 0x1C, 0x52, 0xE3, 0xE1, 0x07, 0xBE, 0x3F, 0x1C, 0xE6, 0x1D, 0xCC, 0x9B, 0x2C, 0x65,
+    0xFC, 0xB8, 0xE1, 0x1F, 0x6F, 0x7D, 0x3E, 0x7A, 0xC7, 0x67, 0x3F, 0xB8, 0x32, 0x3B, 0xF0, 0xE5,
+    0xF8, 0xF6, 0x7F, 0xFE, 0x79, 0xEB, 0x9B, 0xE3, 0x05, 0x64, 0xFE, 0x7A, 0x0E, 0x65, 0xDE, 0x87,
+    0xD4, 0xFC, 0xB1, 0x94, 0x1B, 0x5B, 0x4E, 0x6A, 0xAB, 0x5C, 0x56, 0xF4, 0x89, 0x4B, 0x6B, 0x5B,
+    0x4C, 0x88, 0x26, 0xCA, 0x2B, 0x1F, 0x7B, 0xD5, 0x29, 0x37, 0x6E, 0x74, 0x65, 0x90, 0x9B, 0x71,
+    0x6D, 0xAA, 0x32, 0xF6, 0xE3, 0xC6, 0xC4, 0x5D, 0x5A, 0x9D, 0x0F, 0x69, 0xCF, 0x1B, 0x3E, 0xAD,
+    0x4D, 0x3E, 0x44, 0x3E, 0x6E, 0x95, 0x8B, 0x2B, 0x5A, 0x8E, 0xE8, 0xD3, 0xA4, 0xB1, 0x89, 0x33,
+    0xAA, 0xCD, 0x76, 0xBC, 0xAE, 0xE1, 0xD2, 0xAE, 0xF5, 0xF0, 0xFA, 0x59, 0x37, 0xA2, 0xF7, 0x42,
+    0xE8, 0xEC, 0x0C, 0x9A, 0x1C, 0xBA, 0xDD, 0x01, 0x02, 0x64, 0x95, 0x59, 0x6F, 0xB1, 0x85, 0xB0,
+    0x35, 0x7B, 0xB3, 0x8D, 0x8A, 0x17, 0x11, 0xE7, 0xB4, 0xBC, 0x2E, 0xB5, 0xC3, 0x8E, 0x71, 0xD3,
+    0x2B, 0x67, 0xE3, 0xCE, 0xAC, 0xF9, 0xAC, 0x38, 0xAF, 0x03, 0xF8, 0x11, 0x4D, 0x74, 0xCB, 0x89,
+    0xB7, 0x3B, 0xE8, 0x86, 0x66, 0xC3, 0xE9, 0xA6, 0x8F, 0xF0, 0x36, 0x5B, 0x77, 0xCA, 0x19, 0x7A,
+    0x4D, 0x15, 0xD2, 0x35, 0xA4, 0x80, 0x70, 0x1F, 0x28, 0xA1, 0x34, 0x1F, 0x25, 0xD5, 0x29, 0xE6,
+    0xBB, 0x60, 0x7A, 0xEE, 0x8D, 0xE3, 0xA4, 0x91, 0x47, 0x15, 0x3A, 0x34, 0xA1, 0x17, 0xD2, 0x36,
+    0xE0, 0x20, 0x59, 0x51, 0x42, 0x2E, 0xEC, 0xDF, 0x96, 0x00, 0x2B, 0xA1, 0xFE, 0x28, 0xAD, 0xC2,
+    0xF9, 0xA8, 0x25, 0x38, 0x98, 0xA0, 0xE1, 0x9F, 0x81, 0x87, 0xA5, 0x77, 0xAF, 0x4D, 0xE1, 0x92,
+    0xE8, 0xC2, 0x6C, 0x93, 0xC6, 0xA6, 0x13, 0x14, 0xEF, 0xBA, 0xF7, 0xB5, 0x74, 0x3A, 0xE6, 0x6A,
+    0xD2, 0xAD, 0x90, 0x42, 0x5D, 0xA4, 0x00, 0x3B, 0xCC, 0xFA, 0x86, 0xB4, 0xFB, 0xA5, 0x5D, 0x3E,
+    0xE4, 0xB2, 0xE7, 0x5B, 0x9C, 0x4F, 0x68, 0x4B, 0x7A, 0x2F, 0xB7, 0x9A, 0x5B, 0xB9, 0x85, 0x81,
+    0x07, 0x3D, 0x60, 0xEF, 0xA2, 0x34, 0x9B, 0xDE, 0x5E, 0x67, 0x53, 0x4F, 0x24, 0xAB, 0x9A, 0xF4,
+    0x8A, 0xD7, 0xB7, 0xC1, 0xB4, 0x5C, 0xEB, 0x47, 0x82, 0x6A, 0x56, 0x04, 0x0D, 0x62, 0xEB, 0x2B,
+    0x28, 0xA5, 0x42, 0xFF, 0x81, 0x3E, 0xD0, 0xA8, 0xDE, 0xE6, 0xE8, 0x5D, 0xC3, 0x08, 0xD7, 0x06,
+    0x71, 0x22, 0x3C, 0xDF, 0xE1, 0xF9, 0xBF, 0xE9, 0xAC, 0x60, 0x36, 0x5F, 0x3D, 0x8C, 0xFF, 0x87,
+    0x82, 0x29, 0xCE, 0xFE, 0x76, 0xEC, 0x99, 0x0B, 0xE6, 0x6F, 0xE3, 0x2F, 0x9D, 0x55, 0xBF, 0x8F,
+    0xDC, 0x44, 0x14, 0x7E, 0xB6, 0x49, 0x8C, 0x32, 0x22, 0x43, 0x11, 0x10, 0x0A, 0x5C, 0x86, 0x82,
+    0x0A, 0x02, 0x43, 0x71, 0x45, 0x0A, 0xD8, 0x99, 0xE4, 0x0A, 0x44, 0x01, 0x9C, 0x04, 0xA9, 0xD3,
+    0x84, 0x86, 0x86, 0x14, 0x57, 0x50, 0x90, 0xB3, 0x93, 0x94, 0x69, 0xB6, 0xC8, 0x1F, 0x70, 0x05,
+    0x05, 0xD9, 0x08, 0x5D, 0x90, 0x28, 0x28, 0x72, 0x6B, 0xDF, 0x9D, 0x10, 0x52, 0x1A, 0xCC, 0x8F,
+    0x3E, 0x46, 0xE9, 0x92, 0xE2, 0x06, 0x34, 0x11, 0xCE, 0x69, 0xEC, 0xC7, 0x37, 0xBE, 0xCB, 0x05,
+    0x25, 0x15, 0x59, 0x7B, 0xAD, 0xD9, 0x9D, 0x79, 0xBF, 0xBE, 0xF7, 0x7D, 0xCF, 0x34, 0x25, 0x6D,
+    0xF3, 0xEF, 0x92, 0xDB, 0x8B, 0xEF, 0xAE, 0xD5, 0x47, 0x88, 0xD6, 0xE8, 0xFF, 0x3E, 0xC6, 0x4F,
+    0xF2, 0xBB, 0xA5, 0x95, 0x96, 0x16, 0x4E, 0x7D, 0xB1, 0xFE, 0xF1, 0xBD, 0xF5, 0x8F, 0x9A, 0x85,
+    0xC5, 0xE6, 0x42, 0xF3, 0xEB, 0xB6, 0x6D, 0x88, 0x9E, 0xE1, 0xDE, 0xF7, 0xF9, 0xB3, 0x15, 0x0B,
+    0x74, 0x72, 0x85, 0xBE, 0xDF, 0xBD, 0x7E, 0x61, 0xF7, 0xC6, 0x6B, 0x8B, 0x79, 0xFE, 0x42, 0x9E,
+    0x6C, 0x7F, 0x40, 0x94, 0x3F, 0xD3, 0xFD, 0xC4, 0xE7, 0xE8, 0xF8, 0xCC, 0x07, 0xA2, 0x62, 0x5C,
+    0x55, 0x03, 0x65, 0x3E, 0x2E, 0xC4, 0x83, 0x40, 0xA6, 0x8C, 0xAB, 0x22, 0xF3, 0x69, 0x88, 0x8B,
+    0xAC, 0x93, 0x8D, 0xAC, 0xE3, 0x4A, 0xD6, 0xC6, 0xF6, 0xE3, 0xF9, 0x82, 0x82, 0x68, 0xC7, 0x3C,
+    0x43, 0xEE, 0xCC, 0x9E, 0x33, 0x67, 0x96, 0xDC, 0x91, 0x29, 0x1D, 0x5E, 0x53, 0xBF, 0x05, 0x7D,
+    0x86, 0x5D, 0xC2, 0xDE, 0xF0, 0x66, 0x67, 0x76, 0x5A, 0xBD, 0xE3, 0x74, 0x27, 0xB7, 0x82, 0xDE,
+    0x0C, 0xD1, 0x11, 0x1E, 0x85, 0x6C, 0x8D, 0x25, 0xD1, 0x54, 0x49, 0x30, 0x04, 0x97, 0xAB, 0x59,
+    0x27, 0xFE, 0x0A, 0x99, 0xA3, 0xCC, 0xC9, 0xC6, 0x5C, 0x75, 0xAA, 0x26, 0x63, 0x8D, 0x0D, 0xBA,
+    0xEC, 0x29, 0xED, 0x68, 0x90, 0x6D, 0x25, 0x1C, 0xA9, 0x3A, 0x1D, 0x98, 0x98, 0x09, 0x26, 0x19,
+    0xB7, 0x29, 0xE3, 0x7C, 0x4B, 0xC9, 0x37, 0x44, 0xD7, 0x89, 0xD2, 0xC7, 0xD5, 0xE5, 0x56, 0x97,
+    0x83, 0xF0, 0x66, 0xB3, 0x47, 0x18, 0xBA, 0xB9, 0xFF, 0xEF, 0x8A, 0xB0, 0xFA, 0x8A, 0x97, 0x7F,
+    0xF6, 0xC2, 0x73, 0x16, 0x8A, 0x4B, 0xBD, 0xAE, 0x07, 0x04, 0xCB, 0x5B, 0x41, 0xEE, 0xC0, 0x34,
+    0x69, 0x8E, 0xD2, 0x0F, 0x69, 0xA7, 0xEA, 0x3E, 0xEB, 0x60, 0x0F, 0x27, 0x57, 0x82, 0x74, 0x55,
+    0xEE, 0x55, 0x33, 0x08, 0x67, 0x2E, 0x05, 0x58, 0xA4, 0x5E, 0x95, 0x27, 0x93, 0x56, 0x3E, 0xB2,
+    0xF9, 0x2A, 0x77, 0xAA, 0x31, 0x75, 0x61, 0x87, 0x24, 0xA4, 0x3E, 0xAB, 0xF7, 0x72, 0x28, 0x4F,
+    0x02, 0x91, 0xD3, 0xBD, 0x74, 0x66, 0x2B, 0xE4, 0xDE, 0x20, 0x21, 0x54, 0xD5, 0xC3, 0xB6, 0x7E,
+    0x2F, 0x3D, 0x68, 0xF3, 0x09, 0xBA, 0x99, 0x5B, 0x20, 0xAD, 0xCB, 0x62, 0x29, 0xE8, 0x1A, 0x47,
+    0x55, 0x8B, 0x48, 0xD2, 0xA1, 0xE0, 0xDC, 0xC3, 0xC1, 0x99, 0x10, 0x2D, 0x02, 0x39, 0x61, 0x4F,
+    0xED, 0x99, 0xBC, 0x42, 0xA4, 0x4A, 0x52, 0x1D, 0xA9, 0x9D, 0x52, 0x6D, 0x75, 0xB2, 0xD6, 0x25,
+    0xDC, 0xC0, 0xB6, 0x2E, 0x70, 0xE9, 0x46, 0x76, 0xC4, 0x24, 0xDB, 0xA4, 0x27, 0x69, 0x81, 0x4A,
+    0x03, 0x20, 0x53, 0xAC, 0x3D, 0x15, 0x75, 0x16, 0xA8, 0x2A, 0x75, 0x2B, 0x3C, 0xFE, 0x38, 0x11,
+    0x7D, 0xBD, 0x8E, 0xEF, 0x55, 0x30, 0x7F, 0x62, 0x52, 0x38, 0xEA, 0xF4, 0x65, 0x97, 0xB5, 0x6E,
+    0x03, 0xFE, 0xB5, 0xA5, 0xD5, 0xBC, 0xA1, 0xE4, 0x81, 0x27, 0x25, 0x06, 0xB9, 0x84, 0xAD, 0xA0,
+    0x97, 0x82, 0xAA, 0x97, 0x77, 0xDD, 0x32, 0x19, 0x74, 0x11, 0x5C, 0x40, 0xB3, 0x96, 0x03, 0x05,
+    0x7D, 0xC5, 0xE9, 0x34, 0xC8, 0xAB, 0x8D, 0xB2, 0x93, 0x45, 0x20, 0xB8, 0x57, 0xFF, 0x71, 0x7B,
+    0xDC, 0xEA, 0x06, 0xE9, 0x38, 0xE9, 0x44, 0x27, 0xBA, 0xAC, 0xCF, 0x7A, 0x24, 0xC6, 0x60, 0x97,
+    0x29, 0x55, 0xA3, 0x9A, 0xDC, 0x09, 0x97, 0x06, 0x50, 0x6C, 0x4E, 0x43, 0x6C, 0x36, 0x3C, 0xCA,
+    0x3A, 0x43, 0x02, 0xD4, 0xE1, 0x7A, 0x9F, 0x2E, 0xD2, 0x73, 0xB8, 0xC6, 0x9E, 0xF8, 0xD4, 0x27,
+    0x9C, 0x0C, 0x48, 0xBE, 0x2A, 0x55, 0xAD, 0xEB, 0xC4, 0x26, 0x96, 0xCE, 0x9E, 0x3D, 0xFB, 0x29,
+    0x33, 0xEF, 0xE0, 0x3B, 0x9B, 0xCD, 0xAE, 0x53, 0xCA, 0x77, 0xB8, 0xE8, 0x9F, 0xA0, 0x78, 0x15,
+    0xF9, 0x1B, 0x89, 0x1D, 0x39, 0x0D, 0x22, 0x01, 0xBB, 0x98, 0x5E, 0x3C, 0x26, 0x62, 0x13, 0x56,
+    0xE3, 0x7E, 0xEC, 0xBE, 0x1E, 0xE3, 0x44, 0x8E, 0x47, 0xF2, 0x87, 0x47, 0xFB, 0xF3, 0x91, 0xD8,
+    0xD1, 0xDE, 0x46, 0x21, 0xC4, 0x83, 0xB0, 0x4F, 0xA2, 0x7D, 0x1E, 0xF9, 0xFF, 0x98, 0x74, 0x29,
+    0x5B, 0xD1, 0xA7, 0xEC, 0x05, 0x37, 0xCC, 0x19, 0x07, 0x53, 0x35, 0x03, 0x7F, 0x98, 0xF9, 0x37,
+    0x64, 0x13, 0xD9, 0xEA, 0xC9, 0x44, 0xB7, 0x70, 0xD3, 0x3F, 0xF5, 0x88, 0x1B, 0xEA, 0x0F, 0x2A,
+    0x96, 0x73, 0xB6, 0x0A, 0x20, 0x95, 0xD9, 0x40, 0x87, 0x88, 0x8E, 0xED, 0x3B, 0xF6, 0x48, 0x05,
+    0xC5, 0xE7, 0x1D, 0xEA, 0x4F, 0x87, 0x98, 0x40, 0x45, 0xA8, 0xFF, 0xD0, 0xDE, 0xEE, 0x9A, 0x86,
+    0xEB, 0x2D, 0xF6, 0xE9, 0x20, 0x19, 0x50, 0x23, 0x6C, 0x51, 0x4F, 0xCD, 0x69, 0x28, 0xBB, 0x17,
+    0x51, 0x4E, 0x26, 0x2A, 0x29, 0xAA, 0x3B, 0xA6, 0x60, 0x81, 0x30, 0x88, 0x80, 0x90, 0x49, 0x97,
+    0xF4, 0x56, 0x34, 0x88, 0xA8, 0x09, 0x8C, 0xB9, 0x05, 0x77, 0xC9, 0x41, 0xBC, 0x77, 0x48, 0xB5,
+    0xE8, 0x56, 0x55, 0x4A, 0x74, 0x08, 0xD0, 0x21, 0xDA, 0xB1, 0xB1, 0xA5, 0xD8, 0xED, 0x31, 0x34,
+    0xA4, 0x2B, 0x98, 0xAA, 0xCB, 0x8C, 0x96, 0x8A, 0xFB, 0x90, 0xC7, 0xF3, 0x20, 0x2A, 0x28, 0xB9,
+    0x09, 0x58, 0x36, 0x80, 0x96, 0x70, 0x63, 0x8E, 0x73, 0x2C, 0x10, 0x6D, 0x8E, 0xC6, 0x02, 0x2B,
+    0x43, 0xE6, 0x33, 0xF4, 0x95, 0x5D, 0xD6, 0xA4, 0x1C, 0x1B, 0xBB, 0xBC, 0xDF, 0x5B, 0x9A, 0x90,
+    0x72, 0x23, 0x33, 0xA5, 0x4B, 0x22, 0x42, 0x88, 0xF6, 0xE2, 0x3E, 0xA8, 0x33, 0x9B, 0x5C, 0xE2,
+    0x3E, 0x79, 0x88, 0x1E, 0xF7, 0x1B, 0x29, 0x0F, 0x47, 0x49, 0x3C, 0xFC, 0xEF, 0x18, 0x5B, 0xA0,
+    0x56, 0xD8, 0x95, 0x51, 0xAE, 0xA2, 0x85, 0x52, 0xA3, 0x48, 0xA3, 0x62, 0x75, 0xC3, 0xC2, 0x41,
+    0x51, 0xA3, 0x68, 0x8B, 0x2C, 0xEE, 0x63, 0x12, 0x44, 0xDD, 0x86, 0xB4, 0x3E, 0x01, 0x31, 0x1D,
+    0x78, 0x78, 0x15, 0x99, 0xB1, 0x35, 0x77, 0x9C, 0x86, 0xB4, 0x6B, 0x23, 0x9C, 0xDC, 0x86, 0xEC,
+    0x40, 0x4B, 0x8C, 0x25, 0x8C, 0xA9, 0xCC, 0x1B, 0x5B, 0x71, 0x29, 0xD9, 0xD2, 0xE7, 0xF1, 0xF8,
+    0xDB, 0x23, 0x93, 0x0C, 0x44, 0xE5, 0x68, 0x72, 0x8B, 0x26, 0x13, 0x9A, 0x28, 0x6B, 0x44, 0x6D,
+    0x6E, 0xEC, 0x2A, 0xE6, 0xCD, 0x59, 0x35, 0x25, 0x85, 0xB9, 0x56, 0x53, 0x82, 0xF2, 0xDE, 0x9C,
+    0x91, 0xE2, 0x5A, 0x72, 0x1B, 0x87, 0x14, 0xF2, 0xAE, 0x3C, 0xBD, 0x8C, 0xD9, 0x05, 0x42, 0x00,
+    0x63, 0xF4, 0x1C, 0x4D, 0xBD, 0x01, 0x3D, 0x60, 0xC2, 0x5D, 0x8B, 0xB8, 0xFF, 0x48, 0x66, 0x48,
+    0x78, 0x9A, 0x7B, 0x00, 0x36, 0x26, 0xC5, 0xED, 0xC5, 0xDC, 0x6D, 0x64, 0xF1, 0x9E, 0x03, 0xE1,
+    0xF5, 0x46, 0xB1, 0x4D, 0xAE, 0xD1, 0xF1, 0xD9, 0x1A, 0xF3, 0xDD, 0xDD, 0xEA, 0x5C, 0xDA, 0xAD,
+    0x80, 0xCD, 0x21, 0x3A, 0x9C, 0x47, 0x96, 0x42, 0xE8, 0xE3, 0x0F, 0x10, 0xEA, 0x3C, 0x1C, 0x7E,
+    0x89, 0xB4, 0x9B, 0x5E, 0x6D, 0x3B, 0x23, 0xB7, 0xBC, 0xDE, 0x29, 0x8D, 0xCF, 0xEF, 0xBB, 0x55,
+    0x71, 0xD7, 0xA9, 0x5F, 0xEA, 0xB9, 0xBE, 0xEF, 0x0C, 0xD3, 0x21, 0x74, 0x54, 0x4F, 0x13, 0x0E,
+    0xD9, 0x83, 0x5E, 0x34, 0xAB, 0x00, 0x40, 0xD6, 0x13, 0xD1, 0xCE, 0xC1, 0x5F, 0x5A, 0xEF, 0xA2,
+    0x4F, 0xDD, 0xBC, 0xC5, 0x54, 0x78, 0x7A, 0x29, 0x56, 0x7F, 0x66, 0x30, 0xB7, 0xFF, 0xC1, 0xEC,
+    0x0C, 0x6A, 0xBB, 0xDD, 0x90, 0x4B, 0xEE, 0x6B, 0x79, 0xF9, 0xEF, 0x8B, 0x72, 0x70, 0xE6, 0x27,
+    0x7B, 0x7E, 0x44, 0x53, 0x0C, 0xA8, 0xB8, 0xC5, 0xFC, 0x97, 0x4D, 0x91, 0x3B, 0xB9, 0xD5, 0xE5,
+    0xAE, 0x8F, 0x13, 0x7E, 0x0E, 0xCF, 0x4B, 0x1E, 0xF3, 0x56, 0xD7, 0x9A, 0xEB, 0x84, 0xCB, 0x03,
+    0xF4, 0x2B, 0xAF, 0xD0, 0x73, 0xA8, 0x52, 0xB4, 0x00, 0x65, 0x5C, 0x96, 0x68, 0x25, 0x7F, 0xC2,
+    0xE3, 0x18, 0x29, 0x7C, 0xCA, 0x7D, 0xEE, 0xE7, 0x79, 0xBD, 0x9A, 0xD0, 0xF8, 0x2A, 0xC0, 0x6B,
+    0x07, 0x84, 0xEC, 0xC7, 0xDC, 0xEE, 0x7D, 0x6B, 0x38, 0x68, 0x8E, 0x42, 0x04, 0x91, 0x0B, 0xCE,
+    0xDA, 0x8D, 0xC3, 0x29, 0x5E, 0x13, 0x65, 0x1E, 0x89, 0x96, 0x9E, 0x6B, 0xE2, 0xA4, 0xEC, 0x41,
+    0x2F, 0xE6, 0x94, 0xA7, 0x4F, 0xBD, 0x04, 0xE9, 0x5F, 0xB5, 0x55, 0x3D, 0x6C, 0xDD, 0x54, 0x14,
+    0x3E, 0xB6, 0x43, 0x5D, 0xC9, 0x48, 0x37, 0x03, 0x05, 0x54, 0x10, 0xCE, 0x8C, 0x90, 0x9C, 0x81,
+    0xB1, 0xE4, 0x5A, 0x65, 0xC8, 0x80, 0x44, 0x22, 0xA1, 0xB7, 0xC0, 0x90, 0x85, 0xA9, 0x0B, 0x0C,
+    0xAC, 0xA9, 0x8D, 0x3A, 0x74, 0xC8, 0x00, 0x03, 0x9D, 0xDB, 0x01, 0x86, 0x3C, 0x16, 0xC6, 0x0C,
+    0xC9, 0xBB, 0xA6, 0x19, 0x3B, 0xC4, 0x14, 0x65, 0x8E, 0x95, 0x20, 0x55, 0x2A, 0x43, 0xAE, 0x1A,
+    0x47, 0x75, 0x1B, 0xDB, 0x87, 0xEF, 0x5C, 0xBF, 0x57, 0xBD, 0x48, 0x15, 0x4C, 0x5C, 0xD9, 0x47,
+    0xF7, 0xE7, 0xDC, 0x73, 0xBF, 0xFB, 0x9D, 0x9F, 0x4B, 0x84, 0x96, 0xE4, 0x94, 0x94, 0x94, 0x58,
+    0x4A, 0x5A, 0x8A, 0x33, 0x8A, 0xD7, 0xF2, 0x78, 0xB5, 0x8C, 0x6F, 0x5A, 0xC5, 0xBC, 0xCF, 0x6C,
+    0x29, 0xCE, 0x29, 0x2A, 0xC8, 0xB7, 0x44, 0x19, 0x53, 0xC2, 0x85, 0x3A, 0x4C, 0x83, 0x92, 0xFC,
+    0x3E, 0x25, 0x6E, 0x88, 0x4C, 0x4A, 0xAA, 0xA4, 0xA0, 0x26, 0xAF, 0xA5, 0x2B, 0x1D, 0x71, 0x47,
+    0x49, 0x43, 0xB3, 0x16, 0x75, 0x64, 0x5E, 0x04, 0x1D, 0x45, 0x15, 0xC5, 0x87, 0xA4, 0xB9, 0xC8,
+    0xEE, 0xDB, 0xBD, 0x60, 0xFA, 0x65, 0x51, 0x85, 0x99, 0xA8, 0x77, 0x18, 0xB8, 0x66, 0x7E, 0x72,
+    0x98, 0xC5, 0x41, 0xBD, 0x98, 0xA4, 0x5E, 0x43, 0xAA, 0x20, 0xB7, 0x4D, 0x53, 0xE0, 0x06, 0x2B,
+    0x33, 0x93, 0x3E, 0xE7, 0x99, 0xB9, 0x63, 0xB5, 0xFA, 0xBD, 0xD1, 0x6B, 0x45, 0xD6, 0x7A, 0x5C,
+    0x26, 0x1B, 0x8F, 0xEB, 0xF8, 0xA0, 0xC8, 0xF4, 0xA7, 0x4D, 0x86, 0xD5, 0xDA, 0xE9, 0x79, 0x80,
+    0x66, 0x7D, 0x6E, 0xC3, 0x6A, 0xA2, 0x0A, 0x2D, 0x5F, 0x79, 0x3B, 0x7A, 0xD9, 0x61, 0x86, 0xDE,
+    0xA9, 0x61, 0xD9, 0x33, 0x45, 0xD6, 0x93, 0xAE, 0x68, 0x38, 0x1E, 0xD3, 0x5A, 0xC4, 0x7B, 0x22,
+    0x82, 0x96, 0x5A, 0x0A, 0x5B, 0x6A, 0x44, 0x58, 0x8A, 0xE4, 0x42, 0x4A, 0xCC, 0xAA, 0x17, 0x63,
+    0xA2, 0x98, 0x59, 0x76, 0x00, 0xB7, 0xDB, 0xAD, 0x0B, 0x80, 0x32, 0x4F, 0x89, 0x42, 0x99, 0xF7,
+    0xF8, 0x1E, 0xE6, 0x38, 0x95, 0xDE, 0x4F, 0xA2, 0xD6, 0x42, 0x43, 0xC4, 0xB4, 0x5D, 0x91, 0x25,
+    0x03, 0xA1, 0x2E, 0xA0, 0x6D, 0x6E, 0xE2, 0xB0, 0x26, 0xAC, 0x28, 0x29, 0x3E, 0x20, 0x12, 0x26,
+    0xA2, 0x7A, 0x41, 0x0C, 0x59, 0x41, 0x53, 0x50, 0xD8, 0x38, 0xDB, 0x0F, 0x04, 0x60, 0x41, 0xBF,
+    0xF6, 0xDB, 0x38, 0xBD, 0x84, 0x96, 0xC1, 0xFF, 0x45, 0x43, 0x6F, 0x07, 0x0C, 0xB8, 0xC0, 0xC3,
+    0x36, 0xFB, 0xC3, 0x30, 0x7D, 0x4D, 0x97, 0x9A, 0x67, 0x38, 0x1F, 0x3A, 0xD0, 0x18, 0x7A, 0xB0,
+    0xDA, 0x0D, 0x53, 0x6B, 0x56, 0xDB, 0x41, 0x8D, 0x3D, 0x1E, 0x3A, 0xB1, 0x55, 0x16, 0x54, 0xE3,
+    0xC8, 0x9E, 0x38, 0x70, 0x5E, 0xD4, 0x65, 0x6C, 0x75, 0x4A, 0xD7, 0x40, 0x49, 0xD0, 0xC5, 0xA0,
+    0x1A, 0x34, 0x15, 0x7C, 0xC0, 0xAD, 0xE2, 0x22, 0xEC, 0xD9, 0xC6, 0xE7, 0x7E, 0xFD, 0x3E, 0xEE,
+    0x53, 0x03, 0x7C, 0x52, 0x90, 0xE2, 0xBF, 0x00, 0x50, 0xEC, 0x09, 0x15, 0x2D, 0xA9, 0x0E, 0x46,
+    0x49, 0x56, 0x12, 0xEB, 0xE1, 0x7A, 0x20, 0x96, 0x4C, 0x8E, 0x68, 0x23, 0x7D, 0xE7, 0x73, 0x5C,
+    0x1C, 0x31, 0x14, 0xF0, 0xCB, 0x46, 0xAF, 0x0A, 0x75, 0x9A, 0x63, 0xAE, 0x0C, 0x57, 0x70, 0x71,
+    0x3A, 0x75, 0xE2, 0xE5, 0xDB, 0x34, 0x53, 0xEE, 0x0D, 0xB8, 0x0F, 0x38, 0xDD, 0x14, 0xC7, 0xEC,
+    0x52, 0x5C, 0xD1, 0x77, 0x53, 0x27, 0xFC, 0xDD, 0x52, 0x24, 0xFE, 0x7B, 0x83, 0xEF, 0xAD, 0x3B,
+    0x08, 0xC2, 0x9B, 0xA3, 0xB2, 0x1C, 0x86, 0xCE, 0x31, 0x64, 0x0A, 0x5A, 0xA4, 0xAC, 0xF6, 0xEC,
+    0xB0, 0xAC, 0x84, 0x5B, 0xCF, 0xF1, 0xE2, 0xCD, 0x0E, 0xFB, 0x4D, 0x5C, 0x21, 0xFC, 0x20, 0xBC,
+    0xA7, 0x9D, 0xF1, 0x78, 0x7C, 0x17, 0x3C, 0xF2, 0x1A, 0xFE, 0x2E, 0x3E, 0xBC, 0x35, 0x7E, 0x90,
+    0x08, 0x57, 0x72, 0x19, 0x72, 0xBD, 0x8F, 0xE6, 0xD1, 0x82, 0x47, 0x85, 0xFB, 0x23, 0x5B, 0xC0,
+    0xD5, 0xD1, 0xE9, 0xA3, 0x93, 0xB3, 0xC6, 0xB6, 0x37, 0x10, 0xCE, 0xB2, 0x12, 0xC0, 0xA0, 0xC4,
+    0xC5, 0xEB, 0x07, 0xAF, 0x5A, 0x28, 0x3E, 0xD3, 0x22, 0xB2, 0xA1, 0x07, 0x08, 0xC6, 0x61, 0x10,
+    0x97, 0xB7, 0x1F, 0x8E, 0x7F, 0xD9, 0x90, 0xC3, 0x05, 0x78, 0x2C, 0x91, 0xE8, 0x32, 0xA9, 0xBA,
+    0x84, 0xE1, 0xDF, 0x4F, 0x6A, 0x17, 0x6F, 0x68, 0x95, 0x1C, 0x1C, 0x9C, 0x5C, 0x5C, 0x58, 0xCD,
+    0x36, 0x10, 0xAE, 0x40, 0xFF, 0x9C, 0x89, 0xD2, 0xC3, 0x3D, 0xCA, 0xB8, 0x00, 0x7B, 0xBA, 0x50,
+    0x88, 0xD3, 0x1C, 0x3C, 0x98, 0x2D, 0xC1, 0xB0, 0x21, 0x3C, 0x24, 0x87, 0xA3, 0x8D, 0x0A, 0x05,
+    0x64, 0x82, 0xE5, 0x58, 0xB2, 0x15, 0xC6, 0x97, 0x69, 0x69, 0xBA, 0x7B, 0x61, 0xC6, 0x43, 0xCC,
+    0x45, 0x0C, 0xD2, 0x8E, 0x8E, 0xF6, 0x4F, 0x9E, 0x55, 0x4B, 0xED, 0xD2, 0x25, 0x40, 0x57, 0xF5,
+    0x55, 0xF5, 0xC3, 0xA3, 0xFD, 0xE7, 0xCF, 0x5F, 0x61, 0xB0, 0x6E, 0x65, 0x11, 0xCC, 0xE7, 0x12,
+    0x2F, 0x70, 0x6A, 0x4E, 0x70, 0x92, 0x3A, 0x3D, 0x2D, 0xB4, 0xD6, 0xB4, 0xDC, 0x2E, 0x3B, 0x05,
+    0x89, 0x55, 0x18, 0xFA, 0xB6, 0xFD, 0x38, 0x3C, 0x3B, 0xB3, 0xF0, 0x7C, 0x1E, 0xA1, 0x22, 0x89,
+    0x72, 0x58, 0xD3, 0xB5, 0xAF, 0xEE, 0xAD, 0xB3, 0xAB, 0x60, 0xAC, 0x24, 0x26, 0xA4, 0xCC, 0xA1,
+    0x9E, 0xF8, 0x08, 0xA2, 0xC9, 0xDC, 0xE0, 0xC7, 0x09, 0xED, 0xE1, 0x52, 0x9F, 0x55, 0xC6, 0xAF,
+    0x0D, 0xED, 0x65, 0xCC, 0xDF, 0x30, 0xFF, 0xC9, 0x5C, 0x23, 0xEA, 0x25, 0xFB, 0xC0, 0x7C, 0x88,
+    0x63, 0xD2, 0x4B, 0x9B, 0xE6, 0x07, 0xEF, 0xD2, 0x24, 0xCE, 0x93, 0xBB, 0x0D, 0x8A, 0xD9, 0xF7,
+    0x4D, 0x80, 0x02, 0x24, 0xC4, 0x3C, 0x91, 0xB8, 0x0A, 0xAD, 0x44, 0x4E, 0x84, 0x48, 0xAE, 0x1D,
+    0x15, 0x44, 0xD7, 0xC5, 0x29, 0x70, 0x19, 0xAA, 0xA5, 0x85, 0xDB, 0x0C, 0xE9, 0xD4, 0xA4, 0xAA,
+    0x9C, 0x60, 0xC2, 0x8C, 0x46, 0x5D, 0x36, 0x65, 0xF5, 0x61, 0x37, 0x1A, 0xAD, 0xC3, 0x3E, 0xF9,
+    0xED, 0xB4, 0xBE, 0x04, 0xC5, 0xAC, 0xFA, 0xB9, 0xA4, 0xC4, 0xEF, 0xD2, 0x53, 0x62, 0xC3, 0xEF,
+    0x46, 0xE3, 0x9F, 0x11, 0xC7, 0xFC, 0xD8, 0x39, 0x45, 0x02, 0xE5, 0xB6, 0x28, 0x19, 0x8C, 0x4A,
+    0x11, 0xA9, 0x19, 0x7D, 0xB9, 0x2D, 0x88, 0x69, 0x10, 0x2E, 0xAF, 0x45, 0x4D, 0xFC, 0x8C, 0x4C,
+    0x47, 0xBA, 0xC9, 0x3D, 0x00, 0xA2, 0x4F, 0x40, 0xFF, 0x16, 0x07, 0x17, 0xC7, 0x17, 0x76, 0xA7,
+    0xD9, 0xDD, 0x59, 0x58, 0x49, 0x16, 0x48, 0x6D, 0xC1, 0x4F, 0xC7, 0x60, 0xBB, 0xD9, 0x25, 0x5A,
+    0x49, 0xE8, 0x35, 0x13, 0xAB, 0xC5, 0x3C, 0x32, 0x57, 0x9C, 0x20, 0x6E, 0x6D, 0x8F, 0x7A, 0x29,
+    0x3C, 0x7D, 0x28, 0x42, 0xE6, 0xF6, 0x44, 0xED, 0x5C, 0x60, 0x4A, 0x10, 0x37, 0xD7, 0xB7, 0x47,
+    0x12, 0xD7, 0xC2, 0xA7, 0xB0, 0x49, 0xC8, 0xE5, 0x01, 0xD9, 0x27, 0x31, 0xFD, 0xF7, 0xB1, 0xBE,
+    0xDA, 0x7A, 0x18, 0x9C, 0x1C, 0x3F, 0xB3, 0x7D, 0x33, 0x69, 0xA3, 0x1E, 0x8F, 0x8E, 0xD9, 0x82,
+    0xF3, 0x8F, 0xE5, 0x49, 0xC2, 0xEF, 0x6A, 0xF6, 0xCE, 0x2C, 0x8C, 0x97, 0x03, 0x30, 0x66, 0x81,
+    0x0E, 0x84, 0x0B, 0x75, 0x46, 0x6A, 0x02, 0xFB, 0x02, 0x2C, 0x41, 0x82, 0x6F, 0x6E, 0x02, 0x46,
+    0x2D, 0x64, 0xE5, 0x10, 0x8D, 0xD4, 0xB2, 0x9C, 0x7A, 0x61, 0xBF, 0x95, 0x18, 0x2B, 0xDE, 0x9C,
+    0x4F, 0x6C, 0xC9, 0xA0, 0x7D, 0x14, 0x13, 0x55, 0x65, 0x15, 0xBC, 0xAB, 0xE4, 0xB9, 0xF0, 0x59,
+    0xD2, 0x30, 0x7B, 0x3A, 0x36, 0x52, 0x4D, 0x38, 0x17, 0xCB, 0x05, 0xE9, 0xF3, 0x8D, 0x0A, 0xFA,
+    0xF2, 0x36, 0xB2, 0x27, 0xDB, 0x2A, 0xA4, 0x6A, 0xD4, 0x6A, 0x29, 0xC8, 0x72, 0x61, 0x7D, 0x0A,
+    0xE3, 0x11, 0x22, 0x05, 0x63, 0xA9, 0x77, 0x5A, 0xDC, 0x3D, 0xBC, 0x87, 0x4E, 0xBC, 0x45, 0xFF,
+    0x77, 0xFB, 0x07, 0xB5, 0x55, 0x3D, 0x6F, 0xDC, 0x46, 0x10, 0x9D, 0xE3, 0x42, 0x26, 0x20, 0x16,
+    0xAB, 0x22, 0x4A, 0xE3, 0x82, 0x7D, 0x80, 0x80, 0xFF, 0x20, 0xCB, 0xAB, 0x5C, 0xA4, 0xB0, 0x0A,
+    0x5D, 0x95, 0x42, 0xBD, 0x9B, 0xB4, 0x69, 0x0C, 0x32, 0xF1, 0x0F, 0xB0, 0x8A, 0xA4, 0x8E, 0x8B,
+    0x14, 0xC1, 0xA6, 0xB8, 0x5F, 0x20, 0x2F, 0x21, 0xFD, 0x00, 0x33, 0x51, 0xE1, 0xC2, 0x85, 0x09,
+    0x24, 0x69, 0xA4, 0x66, 0x03, 0x10, 0x08, 0x25, 0x2D, 0x39, 0x79, 0xB3, 0xBC, 0x3B, 0x59, 0xA9,
+    0x9C, 0x22, 0x94, 0xB8, 0xC0, 0x72, 0xBE, 0xDE, 0x7B, 0x33, 0xBB, 0x47, 0x8F, 0x7E, 0x22, 0xAA,
+    0xB8, 0x5E, 0x30, 0x77, 0x49, 0x57, 0x78, 0x22, 0x3D, 0x10, 0xA5, 0x81, 0x48, 0xCD, 0x6F, 0x76,
+    0x17, 0x60, 0x0F, 0x09, 0xAF, 0x43, 0x3A, 0xA8, 0xA0, 0xBD, 0x0A, 0x79, 0xAB, 0x06, 0xD3, 0xA4,
+    0xBD, 0x69, 0x32, 0x6F, 0x1A, 0x8D, 0x37, 0x6F, 0x4D, 0x23, 0x7F, 0xAE, 0x34, 0x77, 0x13, 0x69,
+    0xEE, 0x49, 0x71, 0x4D, 0x74, 0x40, 0xF1, 0x61, 0xE6, 0x0B, 0xBC, 0x4F, 0x99, 0x47, 0xA4, 0xEF,
+    0x89, 0x4C, 0x8B, 0x8F, 0x25, 0xA9, 0xB8, 0xB5, 0xD6, 0x5D, 0x6E, 0xAC, 0x87, 0xAB, 0x93, 0x7F,
+    0x5B, 0x8F, 0xC8, 0xBC, 0x85, 0xF5, 0x04, 0xD6, 0x8A, 0xD9, 0xD3, 0xE6, 0x79, 0x76, 0xAA, 0x6A,
+    0xC0, 0x1A, 0x0C, 0x65, 0x2C, 0x9F, 0xDD, 0xED, 0x9A, 0x29, 0x1B, 0x29, 0x0B, 0x12, 0x6E, 0x86,
+    0x64, 0xA2, 0x84, 0xBD, 0xF6, 0x54, 0x54, 0x6D, 0xD5, 0x24, 0xBD, 0xFB, 0x76, 0xA2, 0x62, 0x39,
+    0x65, 0x7D, 0xD2, 0xA7, 0x43, 0xD1, 0x16, 0x75, 0xDE, 0xB9, 0xE5, 0x40, 0x6E, 0x39, 0xE5, 0xB5,
+    0x0A, 0xE9, 0x38, 0x90, 0xF6, 0x1A, 0x90, 0x5D, 0x5D, 0x0C, 0xC2, 0xDE, 0x20, 0x65, 0x4B, 0x3C,
+    0x39, 0x61, 0xC3, 0xDC, 0x52, 0x28, 0x78, 0xA0, 0xA4, 0xD9, 0xFB, 0x81, 0x76, 0xCF, 0xBE, 0x2C,
+    0x0E, 0x34, 0x17, 0xDC, 0x40, 0x2A, 0x38, 0x51, 0xCA, 0x1D, 0x01, 0x91, 0xA8, 0xF8, 0x06, 0x4C,
+    0x8A, 0x97, 0xD0, 0xD0, 0x88, 0x98, 0x95, 0x9A, 0x88, 0x46, 0xC5, 0x44, 0x61, 0xC1, 0x65, 0x32,
+    0x10, 0xD7, 0xAA, 0x27, 0x6E, 0x52, 0x4F, 0x55, 0xAB, 0x3B, 0x32, 0x5D, 0x0E, 0xD8, 0xBE, 0x68,
+    0x28, 0xEF, 0xCD, 0x95, 0x5D, 0x07, 0x90, 0xE5, 0x79, 0x91, 0x2A, 0xE8, 0x0E, 0xF3, 0x3B, 0x59,
+    0x7E, 0x64, 0xBB, 0x1E, 0x81, 0x4E, 0x7B, 0xD7, 0x90, 0x59, 0x72, 0x9D, 0x04, 0x64, 0xD5, 0x1D,
+    0x88, 0x57, 0x68, 0x5D, 0x22, 0xD0, 0x75, 0x4B, 0x55, 0x53, 0x41, 0xC4, 0x17, 0x80, 0xCC, 0xBA,
+    0x01, 0xA1, 0xD7, 0x40, 0x74, 0x07, 0x58, 0x85, 0x40, 0x35, 0xA3, 0x34, 0xC5, 0x4B, 0xDA, 0x7A,
+    0xEE, 0x33, 0xED, 0xDD, 0xD3, 0x72, 0xCC, 0x4D, 0x22, 0xA2, 0x2A, 0xA9, 0xAE, 0xF8, 0x7B, 0x42,
+    0x92, 0xD8, 0xC6, 0x2D, 0x5F, 0x32, 0x48, 0x42, 0xFA, 0xD6, 0x5A, 0xFB, 0x42, 0x30, 0x79, 0x59,
+    0x02, 0x60, 0x5B, 0xAB, 0xA5, 0x43, 0x10, 0x7F, 0xEB, 0x94, 0x45, 0xF8, 0xFC, 0xE7, 0x6A, 0x55,
+    0xEA, 0xB9, 0x51, 0xC2, 0x68, 0x81, 0x35, 0xD2, 0x3A, 0x92, 0x25, 0x6C, 0x92, 0x67, 0x62, 0x2A,
+    0xE0, 0x45, 0x06, 0x4B, 0x63, 0x6E, 0x9E, 0xF4, 0x54, 0x78, 0x30, 0x42, 0xD2, 0x89, 0xB2, 0x01,
+    0x04, 0x81, 0x15, 0x12, 0x41, 0x82, 0xDB, 0x9F, 0xC5, 0x87, 0x25, 0x27, 0x5F, 0x4C, 0x76, 0xB2,
+    0xAF, 0xB8, 0x04, 0xE3, 0xA2, 0x33, 0x35, 0x9C, 0x20, 0x00, 0xB9, 0x77, 0xD2, 0x05, 0x1E, 0x57,
+    0xC7, 0x32, 0x7F, 0x1C, 0xE7, 0xA4, 0x91, 0xCC, 0x9E, 0xF2, 0x08, 0xDF, 0x6F, 0x01, 0x10, 0x1D,
+    0xAE, 0x56, 0x68, 0x1D, 0xEC, 0x11, 0xA3, 0x2C, 0x41, 0x0B, 0x07, 0xE9, 0x5C, 0x9C, 0x43, 0xE0,
+    0x03, 0xB9, 0x87, 0x35, 0xAD, 0x7D, 0x15, 0xC5, 0xC8, 0x25, 0x91, 0xE2, 0x53, 0xA1, 0xBC, 0x93,
+    0x8D, 0x1E, 0x4B, 0x4D, 0x5A, 0x80, 0x77, 0xAC, 0x80, 0xA0, 0x81, 0xC4, 0xD2, 0xCD, 0x68, 0xA0,
+    0xB8, 0x8B, 0x71, 0x1F, 0x48, 0x35, 0xC4, 0x3A, 0xFB, 0x48, 0xEC, 0x2E, 0xEE, 0x65, 0xFD, 0x0C,
+    0x7B, 0xDE, 0x39, 0x15, 0xDD, 0x16, 0xBA, 0x1E, 0xF6, 0x56, 0xAB, 0xAF, 0xC3, 0x5C, 0x8D, 0x25,
+    0x3D, 0xAA, 0x9F, 0x6E, 0x29, 0x8D, 0xBB, 0x08, 0x98, 0x6A, 0x31, 0xCD, 0x83, 0xEC, 0x29, 0xED,
+    0xBF, 0x42, 0xBA, 0x09, 0x13, 0x07, 0x29, 0xA1, 0x27, 0xC6, 0x10, 0x34, 0x60, 0xF5, 0xD6, 0x5D,
+    0xFD, 0x12, 0xEE, 0x29, 0x9E, 0xDB, 0xF5, 0xD5, 0xDA, 0xC3, 0x2E, 0x2A, 0x38, 0xE9, 0x69, 0xDE,
+    0x20, 0x52, 0xDD, 0x70, 0xBD, 0x5A, 0x49, 0x7F, 0xB6, 0x82, 0xD5, 0x6A, 0x66, 0x44, 0x22, 0xFB,
+    0x3C, 0x4E, 0x74, 0x38, 0x8B, 0x1A, 0x6B, 0x96, 0x3B, 0x8C, 0x1C, 0x29, 0xCC, 0xFD, 0x2E, 0xA3,
+    0x74, 0x20, 0xF7, 0xB0, 0xA6, 0xB5, 0x6B, 0xBF, 0x15, 0x23, 0x15, 0x16, 0x8F, 0x59, 0x45, 0xC5,
+    0x78, 0x33, 0x18, 0x37, 0xB4, 0x27, 0x89, 0xE7, 0x27, 0x9A, 0xF8, 0x4D, 0x5C, 0x1F, 0x31, 0xEE,
+    0x80, 0x16, 0x31, 0xD0, 0x34, 0xEF, 0xE5, 0x1A, 0xAB, 0x70, 0xA4, 0x3A, 0x1C, 0x37, 0x1C, 0xB6,
+    0xFF, 0xE7, 0x73, 0xCE, 0x43, 0xC6, 0x01, 0xAA, 0x3A, 0xFE, 0xCB, 0xDA, 0xA5, 0xB5, 0x75, 0x44,
+    0x25, 0x7C, 0x96, 0x78, 0xA7, 0x94, 0xAD, 0x1B, 0xF4, 0x48, 0xA9, 0xD7, 0x98, 0x62, 0xB9, 0x5A,
+    0x3E, 0x97, 0x9B, 0x85, 0xE6, 0xA5, 0x12, 0xB9, 0xA2, 0x24, 0x1C, 0x2F, 0x91, 0xAD, 0x78, 0x72,
+    0xFF, 0xC5, 0x23, 0x14, 0x27, 0x4B, 0x3E, 0xE3, 0xCE, 0xDC, 0x97, 0x2E, 0x3D, 0x4F, 0xA5, 0x5F,
+    0x68, 0x6B, 0x7E, 0xB9, 0x95, 0x2C, 0xC8, 0x81, 0xE9, 0x3E, 0x85, 0x6E, 0x22, 0x68, 0x3A, 0x5F,
+    0x93, 0xBF, 0x61, 0x56, 0x25, 0x51, 0x4D, 0x71, 0xD6, 0xA5, 0x2F, 0x19, 0x72, 0xA5, 0xB8, 0x92,
+    0xD4, 0xB0, 0x39, 0x71, 0xA2, 0xAD, 0x13, 0x14, 0xE5, 0x47, 0x3A, 0x9A, 0x0F, 0x1C, 0x17, 0xE5,
+    0x66, 0xBC, 0x24, 0x1A, 0x08, 0x93, 0x30, 0x07, 0x48, 0x70, 0xDE, 0x7D, 0xB4, 0x69, 0xBC, 0x37,
+    0xE9, 0x8D, 0x09, 0x83, 0xB3, 0x5F, 0xD2, 0x02, 0x00, 0xF2, 0x32, 0xF9, 0xB5, 0xFF, 0xC6, 0xBC,
+    0xAF, 0xCE, 0x31, 0xDC, 0x09, 0xE6, 0x3B, 0xE7, 0x32, 0x67, 0x7E, 0x32, 0xDD, 0x8D, 0x26, 0x7F,
+    0xDA, 0x2C, 0xFB, 0x03, 0xB8, 0x44, 0xCF, 0x67, 0x25, 0xEE, 0x5D, 0xF4, 0xC2, 0x7C, 0x17, 0x0C,
+    0x6D, 0xFF, 0xDF, 0x0E, 0x39, 0xFB, 0x14, 0xF2, 0x1E, 0xD3, 0x42, 0x05, 0x77, 0x3D, 0xC5, 0xD3,
+    0x40, 0xD8, 0xA2, 0x60, 0xB7, 0xE1, 0x43, 0x42, 0x30, 0x15, 0x99, 0x8B, 0x87, 0xBB, 0x7A, 0xB3,
+    0x53, 0x7E, 0xEF, 0x18, 0xBB, 0x6A, 0xA0, 0x71, 0x81, 0xA3, 0xED, 0x13, 0xD7, 0xE4, 0xF8, 0xE1,
+    0x29, 0xCF, 0x70, 0x84, 0x14, 0x0E, 0x47, 0xC0, 0x2E, 0xF3, 0xD8, 0xE9, 0x4B, 0xC4, 0x99, 0x97,
+    0xA8, 0xE1, 0x9E, 0x4B, 0x33, 0xBD, 0x0C, 0x27, 0x76, 0xD9, 0xAE, 0x91, 0xB1, 0xFE, 0x27, 0x78,
+    0x8F, 0xE8, 0xC0, 0xB5, 0xB9, 0xE1, 0x2F, 0xFF, 0xBE, 0x9D, 0xC6, 0xB3, 0x74, 0xD2, 0x4D, 0xD1,
+    0x04, 0x35, 0x66, 0x9D, 0xEB, 0x2B, 0x3E, 0xF9, 0x9D, 0x5B, 0x97, 0xFD, 0xB1, 0x88, 0xBF, 0x74,
+    0x25, 0xFC, 0x51, 0xB0, 0x2F, 0x38, 0xE3, 0x8B, 0xDB, 0x49, 0xBC, 0xC7, 0xF4, 0x1A, 0xEE, 0x5F,
+    0x9C, 0xA9, 0xA0, 0xAE, 0x3B, 0xF6, 0xAF, 0x11, 0xC1, 0xE7, 0x08, 0x19, 0xB2, 0x7E, 0x31, 0xD2,
+    0x7F, 0x7F, 0xFE, 0x01, 0xAD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x1D, 0xDB, 0x09, 0x96, 0xB0,
+    0x84, 0x9B, 0xA4, 0x09, 0x48, 0x47, 0x49, 0x15, 0xB7, 0x74, 0x36, 0x15, 0x2D, 0x42, 0xB8, 0x81,
+    0x96, 0x3E, 0x9F, 0x60, 0xA3, 0x14, 0xB4, 0x29, 0xD2, 0x51, 0xD0, 0x50, 0x90, 0x34, 0xA1, 0xA4,
+    0x20, 0xD9, 0x23, 0x29, 0x28, 0x52, 0x60, 0x0A, 0x44, 0x41, 0x63, 0x24, 0x24, 0x24, 0x68, 0x8E,
+    0xC8, 0xA0, 0x4B, 0xB0, 0x3D, 0xBC, 0xB7, 0x3E, 0xDF, 0x45, 0x44, 0x4A, 0x08, 0x61, 0xCF, 0xBB,
+    0xDA, 0x9B, 0xDD, 0x7D, 0x6F, 0x66, 0x76, 0x76, 0x46, 0x04, 0xAD, 0x41, 0xF7, 0x2A, 0x0C, 0x61,
+    0x81, 0x21, 0x4E, 0x2E, 0x22, 0x6A, 0x37, 0x37, 0x37, 0x57, 0x15, 0x2D, 0x44, 0xAF, 0x63, 0x0C,
+    0x23, 0xE9, 0x9B, 0x9B, 0x73, 0x1C, 0x0C, 0x39, 0x2A, 0x37, 0x87, 0x63, 0x3B, 0xA5, 0x38, 0xA8,
+    0x39, 0xCD, 0xB8, 0xE6, 0x11, 0x56, 0xE2, 0x92, 0xD3, 0x96, 0xD3, 0x88, 0x10, 0x8E, 0x72, 0x1A,
+    0x56, 0x7F, 0x1C, 0x36, 0x3C, 0xE1, 0x93, 0x35, 0x27, 0x99, 0x7A, 0xDA, 0xF3, 0xEA, 0x68, 0x31,
+    0xDA, 0x3F, 0xA8, 0xCD, 0xE9, 0xC3, 0x52, 0xBE, 0xE8, 0xDC, 0xAD, 0xA3, 0xFD, 0x91, 0x89, 0x76,
+    0x6B, 0x13, 0x1C, 0x5C, 0x78, 0xFA, 0xFD, 0xF9, 0x52, 0x3E, 0xB1, 0xD7, 0x7A, 0xC5, 0x1A, 0xE6,
+    0x51, 0x63, 0x47, 0x69, 0x92, 0xF2, 0x7F, 0x6C, 0xB0, 0x27, 0x7A, 0x0B, 0xBB, 0xC2, 0x4F, 0xB0,
+    0xD6, 0xAF, 0xE2, 0x5C, 0xBC, 0x3A, 0x18, 0x89, 0xD3, 0x3A, 0x30, 0xD9, 0x48, 0x3C, 0xC4, 0xE7,
+    0x57, 0x12, 0x15, 0xA2, 0x12, 0x8E, 0x24, 0x1A, 0xFA, 0x63, 0xF1, 0xC7, 0x2E, 0x0E, 0x2B, 0x7E,
+    0x90, 0x9B, 0x04, 0x27, 0xB0, 0x4D, 0x74, 0x42, 0x06, 0xB0, 0x78, 0xB7, 0xE1, 0x04, 0xD2, 0xA0,
+    0x02, 0x98, 0x57, 0x03, 0x0C, 0x1F, 0xFE, 0x2B, 0x38, 0x04, 0x24, 0x4A, 0xC4, 0x68, 0x88, 0xCD,
+    0xDE, 0x18, 0x88, 0xA2, 0x44, 0x1C, 0x14, 0xE0, 0xF4, 0xEA, 0x0C, 0x3A, 0x1A, 0x22, 0x86, 0x5A,
+    0x50, 0x65, 0x7A, 0x3D, 0xA3, 0x93, 0x43, 0xAA, 0xEC, 0x5A, 0x1E, 0x7B, 0xC7, 0x4B, 0x1B, 0x58,
+    0xD0, 0x4A, 0x8C, 0x6A, 0x9E, 0x1D, 0x99, 0x2A, 0x2E, 0x5C, 0x0D, 0x4B, 0x89, 0xDE, 0x00, 0xF5,
+    0x07, 0xF6, 0x36, 0x06, 0x1B, 0xB7, 0x86, 0x12, 0x7E, 0x83, 0xE0, 0x08, 0x82, 0xF6, 0xEF, 0x04,
+    0xD6, 0x6F, 0xD1, 0xF9, 0xCF, 0x51, 0xF0, 0x85, 0xDC, 0x8D, 0x38, 0x0D, 0x50, 0x0C, 0x42, 0xC3,
+    0xBC, 0x46, 0x04, 0x0C, 0x07, 0x0A, 0x53, 0x0C, 0x02, 0xCC, 0x49, 0x89, 0x7D, 0x79, 0x0D, 0x16,
+    0x36, 0x30, 0x0D, 0xEE, 0x68, 0x76, 0x10, 0x4C, 0x37, 0x6D, 0x40, 0xFD, 0x97, 0x0E, 0x6F, 0x0D,
+    0x46, 0x72, 0x0D, 0x7D, 0x27, 0x2A, 0x05, 0xDC, 0x70, 0x11, 0x18, 0x3F, 0xF7, 0xC1, 0xEF, 0x33,
+    0x72, 0x63, 0xFA, 0x14, 0x4B, 0x50, 0x81, 0x21, 0xBD, 0x26, 0x67, 0x37, 0x5E, 0xF6, 0x3E, 0x0C,
+    0xD3, 0xAD, 0x0A, 0x71, 0x8E, 0x07, 0x12, 0x56, 0x0B, 0x22, 0xF3, 0xDD, 0xE2, 0xCE, 0xC9, 0xC5,
+    0x87, 0x20, 0x4D, 0xCE, 0x86, 0xE5, 0xE5, 0xCF, 0xD4, 0x71, 0xF9, 0xCE, 0x9C, 0x3B, 0x18, 0xEE,
+    0x84, 0xA5, 0xAE, 0x36, 0x41, 0x39, 0xDB, 0xE9, 0x24, 0xF1, 0xAE, 0x06, 0xE3, 0x41, 0x1F, 0xD5,
+    0xFF, 0xCC, 0x79, 0xAA, 0x25, 0x9B, 0x89, 0xF3, 0x48, 0x1B, 0xE7, 0x10, 0xB7, 0xD6, 0x6C, 0xBB,
+    0xDA, 0x5E, 0x91, 0xE0, 0x70, 0x96, 0x38, 0xB4, 0xF0, 0xF6, 0x54, 0x6F, 0x1F, 0xB5, 0x46, 0xEB,
+    0x57, 0x62, 0xEA, 0x39, 0x71, 0xD6, 0xA7, 0xAB, 0x08, 0x43, 0x5D, 0x41, 0xFF, 0x80, 0x5E, 0xF5,
+    0xC2, 0x25, 0x64, 0x84, 0x27, 0x10, 0xFC, 0x24, 0xE0, 0xC4, 0x0E, 0x50, 0x0F, 0x97, 0x33, 0x7D,
+    0xAC, 0xBF, 0xB4, 0xAD, 0x03, 0xDD, 0x4D, 0x82, 0x02, 0x36, 0xDF, 0x3A, 0x21, 0xB4, 0xCF, 0x69,
+    0x5D, 0x1E, 0xEC, 0x31, 0x89, 0x00, 0x7D, 0x2C, 0xF7, 0x37, 0x66, 0xE6, 0x5D, 0xDA, 0xFA, 0x9A,
+    0xC4, 0x93, 0x04, 0xB7, 0xB7, 0x26, 0xCE, 0x8B, 0xE9, 0x8A, 0x87, 0x93, 0xDB, 0x3E, 0xF8, 0x32,
+    0xAB, 0x4C, 0x23, 0xE1, 0x50, 0xDC, 0x4A, 0x16, 0xB3, 0xF4, 0x76, 0x27, 0x7C, 0x97, 0xA5, 0xF7,
+    0x7C, 0x6C, 0xBA, 0xD1, 0xED, 0x5F, 0x4C, 0xD3, 0x34, 0x02, 0xCA, 0x47, 0x2A, 0x8E, 0xF9, 0xBD,
+    0x1E, 0x28, 0xE8, 0x15, 0xC7, 0x19, 0xED, 0x99, 0x1D, 0x58, 0xB4, 0xD1, 0xDB, 0x5A, 0xCC, 0xDC,
+    0xFA, 0xD2, 0x26, 0x41, 0x53, 0xD9, 0xAF, 0x94, 0xAC, 0x84, 0x73, 0x11, 0x8B, 0xC7, 0x7B, 0x6D,
+    0x9F, 0x95, 0x5C, 0xE7, 0xBD, 0xCF, 0xD4, 0x9B, 0x13, 0x6A, 0x27, 0x71, 0x25, 0x0E, 0x8E, 0xCA,
+    0xB4, 0x17, 0x78, 0x1C, 0x50, 0x21, 0xE9, 0x3E, 0xA6, 0xAE, 0xE5, 0xA9, 0xF5, 0xC7, 0xAD, 0xEB,
+    0x2F, 0xA7, 0x94, 0x20, 0x61, 0x9A, 0xCB, 0x90, 0xA6, 0x1A, 0x26, 0x39, 0x53, 0xF9, 0x9A, 0xBB,
+    0x9A, 0x83, 0x1B, 0x09, 0x3C, 0x02, 0xBE, 0xE6, 0x41, 0x63, 0x75, 0x61, 0x3E, 0xC9, 0xC6, 0xDC,
+    0x84, 0x1E, 0xE0, 0x61, 0xFA, 0xC8, 0x48, 0xB5, 0x2D, 0x0A, 0xDB, 0x8C, 0x3E, 0x71, 0x7B, 0xA2,
+    0x5C, 0x96, 0x99, 0xFF, 0x13, 0xA6, 0xF9, 0x0E, 0xB6, 0xC3, 0x65, 0x30, 0x04, 0x2D, 0x73, 0x3E,
+    0xEB, 0x02, 0x91, 0x6B, 0x2A, 0x1B, 0x35, 0xD8, 0x65, 0x5D, 0x30, 0xC6, 0x06, 0xD1, 0xD2, 0x87,
+    0xDE, 0x51, 0xCE, 0x12, 0x05, 0xC8, 0x85, 0xCE, 0xDB, 0x4C, 0x6D, 0x4A, 0x93, 0x50, 0x22, 0x84,
+    0x25, 0x82, 0xC5, 0x63, 0x50, 0x4F, 0x4B, 0xCA, 0x80, 0xEF, 0xC1, 0xAB, 0x27, 0xC1, 0x2A, 0x4C,
+    0x9C, 0xDD, 0xCB, 0xEE, 0x9E, 0x8B, 0x2D, 0x4C, 0x41, 0x57, 0x62, 0xEC, 0x71, 0x41, 0x1C, 0x1C,
+    0xCA, 0x7C, 0x9A, 0x4E, 0x6E, 0x88, 0x0F, 0xC8, 0xB1, 0xC7, 0x4D, 0x9F, 0x2C, 0xE7, 0x57, 0xDE,
+    0xCB, 0x25, 0x32, 0x91, 0x79, 0x64, 0x8B, 0x62, 0xD8, 0x4A, 0x2B, 0x3E, 0xFC, 0x45, 0xC0, 0x88,
+    0xB9, 0x19, 0xC9, 0x13, 0xD9, 0x7E, 0x04, 0x2A, 0x90, 0xE3, 0x6B, 0xA8, 0x4F, 0x46, 0x7D, 0x58,
+    0x17, 0xF4, 0x29, 0x6E, 0xDB, 0x56, 0xD2, 0x4E, 0xF1, 0xAB, 0x64, 0x16, 0x93, 0xA6, 0x49, 0x97,
+    0x32, 0x6D, 0x41, 0x0D, 0x6C, 0x8D, 0x7C, 0x26, 0xE7, 0x6C, 0xBF, 0x01, 0x9D, 0x93, 0xB1, 0x8E,
+    0xD3, 0x40, 0x10, 0x86, 0xFF, 0xEC, 0x12, 0xB9, 0xD8, 0xC2, 0xD5, 0x35, 0x34, 0xE1, 0x09, 0xE2,
+    0x27, 0x38, 0x1C, 0x91, 0x92, 0x86, 0x82, 0xAB, 0x28, 0xA8, 0xA1, 0xB9, 0x47, 0x70, 0x04, 0x0F,
+    0x00, 0x0D, 0x15, 0x2D, 0x55, 0x28, 0xAE, 0x4D, 0x71, 0xC4, 0x16, 0x4F, 0x60, 0xAE, 0xA5, 0x59,
+    0x1D, 0x45, 0x8A, 0x93, 0x8E, 0x3D, 0x29, 0xC5, 0x12, 0xD9, 0x1E, 0xFE, 0x59, 0x9F, 0x38, 0x1A,
+    0x24, 0x60, 0xE5, 0xCC, 0x66, 0xC7, 0xB3, 0xF3, 0xCD, 0xAC, 0xFF, 0x05, 0xF0, 0x14, 0x1C, 0xA2,
+    0xA6, 0x5C, 0xD0, 0x14, 0x0D, 0x8E, 0x4E, 0x9E, 0x7B, 0xE4, 0x22, 0xC3, 0xC2, 0x8A, 0x48, 0x07,
+    0x1A, 0x69, 0x80, 0xEA, 0xB4, 0xD3, 0xD7, 0xB2, 0x40, 0xEE, 0x8B, 0x80, 0x2C, 0xD8, 0x0E, 0x7C,
+    0xB8, 0xB5, 0x47, 0xD9, 0xA0, 0x46, 0x1E, 0x50, 0xAE, 0xB2, 0x0E, 0x79, 0x6B, 0x7B, 0xB8, 0x90,
+    0x89, 0x6E, 0x97, 0xB4, 0x1D, 0xA5, 0xC8, 0x0F, 0x4C, 0xAB, 0x77, 0x44, 0xCC, 0x98, 0x8B, 0x29,
+    0x68, 0xEC, 0x5E, 0xB1, 0xA9, 0x80, 0x71, 0x9C, 0x8A, 0xF8, 0x82, 0xE1, 0xAF, 0xF9, 0x1B, 0x8A,
+    0x9E, 0xC1, 0xA4, 0x21, 0x8B, 0x5A, 0x57, 0x4B, 0x53, 0x73, 0x65, 0x06, 0xFE, 0x21, 0x85, 0x39,
+    0xD4, 0x3F, 0x1B, 0xD6, 0xEB, 0x0F, 0x33, 0xC6, 0x7B, 0x56, 0x2C, 0xAB, 0xC9, 0x99, 0x0C, 0x29,
+    0xD5, 0x09, 0xC7, 0x52, 0xD1, 0x6F, 0x34, 0x17, 0xF1, 0xA2, 0xD1, 0x30, 0xDA, 0x96, 0x93, 0x5B,
+    0x4E, 0x00, 0xA6, 0xA2, 0x95, 0x54, 0xCD, 0x6D, 0xF6, 0x49, 0xCA, 0x9E, 0x80, 0xEA, 0x57, 0xBC,
+    0xEB, 0x5E, 0xAE, 0xD7, 0x72, 0xC1, 0xF0, 0x5E, 0x37, 0x36, 0x85, 0x0C, 0x6F, 0xF1, 0x8B, 0xF1,
+    0x58, 0x19, 0x9A, 0xAB, 0xAB, 0xC7, 0x84, 0x47, 0x89, 0xC2, 0x34, 0x4E, 0x91, 0xB9, 0xDF, 0x14,
+    0x4D, 0xDE, 0xCE, 0x27, 0x5D, 0xD6, 0xBA, 0xD5, 0x6C, 0xE9, 0x8D, 0x37, 0x37, 0x01, 0x1B, 0x1C,
+    0x6F, 0x30, 0x47, 0xBE, 0x85, 0x5B, 0x19, 0xB9, 0x1B, 0x91, 0x4E, 0x77, 0xAD, 0xCE, 0x5D, 0x63,
+    0x3C, 0xF6, 0x91, 0x91, 0xE7, 0x05, 0x9D, 0x0F, 0x6D, 0x70, 0xAB, 0x12, 0xE5, 0x2B, 0x5F, 0xA7,
+    0x1E, 0xD8, 0xB8, 0xF4, 0x24, 0x1D, 0x3D, 0xD1, 0x42, 0xEE, 0x98, 0xC3, 0x99, 0x32, 0xA1, 0x4C,
+    0x28, 0x93, 0x71, 0x4B, 0x36, 0xA2, 0x4C, 0x28, 0x93, 0x21, 0xDB, 0xF1, 0x18, 0x7E, 0x63, 0x42,
+    0x99, 0x74, 0xEE, 0xF4, 0x14, 0xF6, 0xBA, 0x26, 0x13, 0xCA, 0xA4, 0x28, 0xF8, 0x4D, 0xA1, 0xCC,
+    0x8F, 0x7F, 0xC1, 0xF4, 0x30, 0x5D, 0x36, 0xD0, 0xBD, 0xBC, 0xF2, 0xE6, 0x70, 0x13, 0xB6, 0x26,
+    0x1E, 0x6F, 0xDC, 0x65, 0x64, 0x9F, 0x75, 0x34, 0xB2, 0x70, 0x11, 0x55, 0x6B, 0x7A, 0xCC, 0xB8,
+    0x68, 0xDD, 0xB5, 0x89, 0x9F, 0xCC, 0xEE, 0x73, 0x74, 0x7E, 0x7F, 0x88, 0xD8, 0x9E, 0x17, 0x91,
+    0xB9, 0x6C, 0x54, 0x35, 0xFE, 0x03, 0xB3, 0x55, 0x66, 0xAB, 0x4C, 0xD2, 0xC9, 0x04, 0x99, 0xE7,
+    0x34, 0x64, 0x1A, 0x65, 0x9A, 0xC4, 0x8C, 0xCA, 0x64, 0x7E, 0x32, 0x61, 0xC9, 0x64, 0x9F, 0x64,
+    0x42, 0x99, 0xEC, 0x93, 0xA6, 0xFA, 0x13, 0x93, 0x63, 0xA2, 0xAB, 0x4A, 0xA5, 0xCB, 0xF3, 0xCC,
+    0xF6, 0xFF, 0xE3, 0xB8, 0xBF, 0x1E, 0xD6, 0xEF, 0x79, 0xD8, 0x07, 0x55, 0x63, 0x9D, 0x94, 0x6A,
+    0xBB, 0xFA, 0x6A, 0xE0, 0xC5, 0x99, 0x02, 0x0B, 0xDC, 0xCB, 0x03, 0x85, 0x5D, 0x7E, 0xED, 0x21,
+    0xCD, 0xEC, 0x20, 0x8B, 0x32, 0x64, 0x43, 0xD5, 0xB8, 0xFD, 0x78, 0x33, 0xC7, 0xF1, 0x20, 0x59,
+    0xE3, 0xD3, 0x94, 0xE4, 0xC9, 0x72, 0xD3, 0x34, 0x7F, 0xA6, 0x93, 0x69, 0xD2, 0xBB, 0x39, 0x26,
+    0xFA, 0xC5, 0xBB, 0x17, 0xBA, 0xA2, 0x32, 0xAD, 0x4F, 0x9F, 0x5B, 0x4F, 0x8B, 0x2A, 0x2D, 0xBC,
+    0x2E, 0x42, 0x9D, 0xF4, 0xFF, 0x48, 0x2E, 0xF5, 0x3E, 0xE4, 0xF2, 0x4D, 0x6F, 0xB8, 0xE8, 0x85,
+    0x65, 0x50, 0xB0, 0xD2, 0x51, 0xBC, 0xB0, 0x0C, 0xA3, 0xA2, 0xAD, 0x7C, 0xE1, 0x02, 0x76, 0x94,
+    0xB7, 0x95, 0xEF, 0x5A, 0x92, 0xED, 0x72, 0x55, 0x94, 0x0D, 0xA5, 0xF2, 0xED, 0x45, 0x48, 0xD3,
+    0x58, 0xAC, 0x0D, 0xE3, 0x74, 0x57, 0xF9, 0x4F,
+};
+
+static const uint32_t bookerly_14_bolditalicBlockOffsets[37] = {
+    0, 1135, 2236, 3343, 4576, 5807, 6658, 7560,
+    8381, 9409, 10446, 11376, 12129, 13188, 14054, 14921,
+    15649, 16642, 17805, 18863, 19858, 20935, 22134, 23381,
+    24543, 25695, 26769, 27813, 28965, 30100, 31120, 32156,
+    33401, 34515, 35556, 36428, 37016,
+};
+
+static const uint16_t bookerly_14_bolditalicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_bolditalicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_14_bolditalicPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
@@ -4481,720 +2525,720 @@ static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
     { 18, 22, 18, -1, 21, 99, 1836 }, // 9
     { 8, 17, 9, 1, 16, 34, 1935 }, // :
     { 11, 21, 9, -2, 16, 58, 1969 }, // ;
-    { 14, 14, 18, 2, 17, 49, 2027 }, // <
-    { 14, 9, 18, 2, 14, 32, 2076 }, // =
-    { 14, 14, 18, 2, 17, 49, 2108 }, // >
-    { 10, 23, 12, 2, 22, 58, 2157 }, // ?
-    { 27, 27, 29, 1, 21, 183, 2215 }, // @
-    { 23, 21, 21, -2, 21, 121, 2398 }, // A
-    { 19, 22, 18, -2, 21, 105, 2519 }, // B
-    { 19, 22, 19, 0, 21, 105, 2624 }, // C
-    { 22, 22, 21, -1, 21, 121, 2729 }, // D
-    { 21, 21, 18, -2, 21, 111, 2850 }, // E
-    { 20, 21, 17, -2, 21, 105, 2961 }, // F
-    { 20, 22, 21, 0, 21, 110, 3066 }, // G
-    { 27, 21, 23, -2, 21, 142, 3176 }, // H
-    { 15, 21, 12, -2, 21, 79, 3318 }, // I
-    { 19, 27, 11, -6, 21, 129, 3397 }, // J
-    { 24, 22, 21, -2, 21, 132, 3526 }, // K
-    { 18, 21, 17, -2, 21, 95, 3658 }, // L
-    { 28, 21, 26, -2, 21, 147, 3753 }, // M
-    { 25, 22, 22, -1, 21, 138, 3900 }, // N
-    { 21, 22, 21, 0, 21, 116, 4038 }, // O
-    { 20, 21, 18, -2, 21, 105, 4154 }, // P
-    { 25, 28, 22, 0, 21, 175, 4259 }, // Q
-    { 21, 22, 20, -2, 21, 116, 4434 }, // R
-    { 17, 22, 16, -1, 21, 94, 4550 }, // S
-    { 20, 21, 19, 1, 21, 105, 4644 }, // T
-    { 22, 22, 23, 2, 21, 121, 4749 }, // U
-    { 23, 22, 21, 1, 21, 127, 4870 }, // V
-    { 29, 22, 29, 2, 21, 160, 4997 }, // W
-    { 24, 21, 19, -3, 21, 126, 5157 }, // X
-    { 21, 21, 19, 1, 21, 111, 5283 }, // Y
-    { 19, 22, 18, -1, 21, 105, 5394 }, // Z
-    { 14, 28, 10, -2, 23, 98, 5499 }, // [
-    { 13, 23, 15, 1, 21, 75, 5597 }, // <backslash>
-    { 14, 28, 10, -2, 23, 98, 5672 }, // ]
-    { 16, 14, 18, 1, 19, 56, 5770 }, // ^
-    { 15, 4, 15, 0, -1, 15, 5826 }, // _
-    { 6, 8, 18, 6, 25, 12, 5841 }, // `
-    { 17, 17, 17, 0, 16, 73, 5853 }, // a
-    { 16, 24, 16, 0, 23, 96, 5926 }, // b
-    { 13, 17, 13, 0, 16, 56, 6022 }, // c
-    { 17, 24, 17, 0, 23, 102, 6078 }, // d
-    { 14, 17, 14, 0, 16, 60, 6180 }, // e
-    { 22, 30, 12, -6, 23, 165, 6240 }, // f
-    { 20, 23, 15, -2, 16, 115, 6405 }, // g
-    { 17, 24, 17, 0, 23, 102, 6520 }, // h
-    { 9, 24, 9, 1, 23, 54, 6622 }, // i
-    { 16, 30, 9, -6, 23, 120, 6676 }, // j
-    { 15, 24, 15, 0, 23, 90, 6796 }, // k
-    { 9, 24, 9, 0, 23, 54, 6886 }, // l
-    { 25, 17, 25, 0, 16, 107, 6940 }, // m
-    { 18, 17, 18, 0, 16, 77, 7047 }, // n
-    { 15, 17, 16, 0, 16, 64, 7124 }, // o
-    { 19, 23, 17, -3, 16, 110, 7188 }, // p
-    { 17, 23, 16, 0, 16, 98, 7298 }, // q
-    { 15, 16, 14, 0, 16, 60, 7396 }, // r
-    { 14, 17, 13, -1, 16, 60, 7456 }, // s
-    { 13, 20, 12, 0, 19, 65, 7516 }, // t
-    { 18, 17, 18, 0, 16, 77, 7581 }, // u
-    { 15, 17, 15, 0, 16, 64, 7658 }, // v
-    { 22, 17, 22, 0, 16, 94, 7722 }, // w
-    { 18, 17, 17, -1, 16, 77, 7816 }, // x
-    { 20, 23, 15, -5, 16, 115, 7893 }, // y
-    { 15, 17, 14, -1, 16, 64, 8008 }, // z
-    { 13, 29, 12, 1, 24, 95, 8072 }, // {
-    { 10, 27, 9, -1, 23, 68, 8167 }, // |
-    { 13, 29, 12, -2, 24, 95, 8235 }, // }
-    { 14, 7, 18, 2, 13, 25, 8330 }, // ~
-    { 0, 0, 6, 0, 0, 0, 8355 }, //  
-    { 10, 23, 10, -1, 16, 58, 8355 }, // ¡
-    { 16, 29, 18, 1, 23, 116, 8413 }, // ¢
-    { 19, 22, 18, -1, 21, 105, 8529 }, // £
-    { 18, 14, 18, 0, 17, 63, 8634 }, // ¤
-    { 20, 20, 18, 1, 20, 100, 8697 }, // ¥
-    { 10, 27, 9, -1, 23, 68, 8797 }, // ¦
-    { 15, 23, 15, -1, 20, 87, 8865 }, // §
-    { 10, 5, 18, 4, 23, 13, 8952 }, // ¨
-    { 22, 22, 23, 0, 21, 121, 8965 }, // ©
-    { 12, 15, 13, 1, 21, 45, 9086 }, // ª
-    { 16, 12, 18, 1, 13, 48, 9131 }, // «
-    { 14, 8, 18, 2, 14, 28, 9179 }, // ¬
-    { 10, 5, 11, 1, 10, 13, 9207 }, // ­
-    { 17, 16, 17, 0, 23, 68, 9220 }, // ®
-    { 10, 3, 18, 4, 21, 8, 9288 }, // ¯
-    { 11, 12, 15, 2, 21, 33, 9296 }, // °
-    { 14, 18, 18, 2, 17, 63, 9329 }, // ±
-    { 12, 14, 13, 0, 24, 42, 9392 }, // ²
-    { 11, 14, 13, 1, 24, 39, 9434 }, // ³
-    { 6, 8, 18, 6, 25, 12, 9473 }, // ´
-    { 20, 23, 18, -2, 16, 115, 9485 }, // µ
-    { 20, 26, 18, -1, 21, 130, 9600 }, // ¶
-    { 5, 6, 9, 2, 11, 8, 9730 }, // ·
-    { 7, 7, 18, 6, -1, 13, 9738 }, // ¸
-    { 9, 14, 13, 1, 24, 32, 9751 }, // ¹
-    { 12, 15, 13, 1, 21, 45, 9783 }, // º
-    { 17, 12, 18, 0, 13, 51, 9828 }, // »
-    { 30, 24, 31, 1, 22, 180, 9879 }, // ¼
-    { 30, 24, 31, 1, 22, 180, 10059 }, // ½
-    { 30, 24, 31, 1, 22, 180, 10239 }, // ¾
-    { 10, 23, 12, 0, 16, 58, 10419 }, // ¿
-    { 23, 29, 21, -2, 29, 167, 10477 }, // À
-    { 23, 29, 21, -2, 29, 167, 10644 }, // Á
-    { 23, 29, 21, -2, 29, 167, 10811 }, // Â
-    { 23, 28, 21, -2, 28, 161, 10978 }, // Ã
-    { 23, 27, 21, -2, 27, 156, 11139 }, // Ä
-    { 23, 29, 21, -2, 29, 167, 11295 }, // Å
-    { 31, 21, 27, -3, 21, 163, 11462 }, // Æ
-    { 19, 29, 19, 0, 21, 138, 11625 }, // Ç
-    { 21, 29, 18, -2, 29, 153, 11763 }, // È
-    { 21, 29, 18, -2, 29, 153, 11916 }, // É
-    { 21, 29, 18, -2, 29, 153, 12069 }, // Ê
-    { 21, 27, 18, -2, 27, 142, 12222 }, // Ë
-    { 15, 29, 12, -2, 29, 109, 12364 }, // Ì
-    { 15, 29, 12, -2, 29, 109, 12473 }, // Í
-    { 16, 29, 12, -2, 29, 116, 12582 }, // Î
-    { 16, 27, 12, -2, 27, 108, 12698 }, // Ï
-    { 22, 22, 21, -1, 21, 121, 12806 }, // Ð
-    { 25, 29, 22, -1, 28, 182, 12927 }, // Ñ
-    { 21, 30, 21, 0, 29, 158, 13109 }, // Ò
-    { 21, 30, 21, 0, 29, 158, 13267 }, // Ó
-    { 21, 30, 21, 0, 29, 158, 13425 }, // Ô
-    { 21, 29, 21, 0, 28, 153, 13583 }, // Õ
-    { 21, 28, 21, 0, 27, 147, 13736 }, // Ö
-    { 13, 13, 18, 3, 16, 43, 13883 }, // ×
-    { 24, 23, 21, -1, 22, 138, 13926 }, // Ø
-    { 22, 30, 23, 2, 29, 165, 14064 }, // Ù
-    { 22, 30, 23, 2, 29, 165, 14229 }, // Ú
-    { 22, 30, 23, 2, 29, 165, 14394 }, // Û
-    { 22, 28, 23, 2, 27, 154, 14559 }, // Ü
-    { 21, 29, 19, 1, 29, 153, 14713 }, // Ý
-    { 19, 21, 17, -2, 21, 100, 14866 }, // Þ
-    { 24, 30, 19, -6, 23, 180, 14966 }, // ß
-    { 17, 26, 17, 0, 25, 111, 15146 }, // à
-    { 17, 26, 17, 0, 25, 111, 15257 }, // á
-    { 17, 25, 17, 0, 24, 107, 15368 }, // â
-    { 17, 24, 17, 0, 23, 102, 15475 }, // ã
-    { 17, 24, 17, 0, 23, 102, 15577 }, // ä
-    { 17, 26, 17, 0, 25, 111, 15679 }, // å
-    { 23, 17, 23, 0, 16, 98, 15790 }, // æ
-    { 13, 24, 13, 0, 16, 78, 15888 }, // ç
-    { 14, 26, 14, 0, 25, 91, 15966 }, // è
-    { 15, 26, 14, 0, 25, 98, 16057 }, // é
-    { 14, 25, 14, 0, 24, 88, 16155 }, // ê
-    { 15, 24, 14, 0, 23, 90, 16243 }, // ë
-    { 8, 26, 9, 1, 25, 52, 16333 }, // ì
-    { 11, 26, 9, 1, 25, 72, 16385 }, // í
-    { 11, 25, 9, 1, 24, 69, 16457 }, // î
-    { 11, 24, 9, 1, 23, 66, 16526 }, // ï
-    { 16, 25, 16, 0, 24, 100, 16592 }, // ð
-    { 18, 24, 18, 0, 23, 108, 16692 }, // ñ
-    { 15, 26, 16, 0, 25, 98, 16800 }, // ò
-    { 16, 26, 16, 0, 25, 104, 16898 }, // ó
-    { 15, 25, 16, 0, 24, 94, 17002 }, // ô
-    { 16, 24, 16, 0, 23, 96, 17096 }, // õ
-    { 16, 24, 16, 0, 23, 96, 17192 }, // ö
-    { 14, 14, 18, 2, 17, 49, 17288 }, // ÷
-    { 19, 17, 16, -2, 16, 81, 17337 }, // ø
-    { 18, 26, 18, 0, 25, 117, 17418 }, // ù
-    { 18, 26, 18, 0, 25, 117, 17535 }, // ú
-    { 18, 25, 18, 0, 24, 113, 17652 }, // û
-    { 18, 24, 18, 0, 23, 108, 17765 }, // ü
-    { 20, 32, 15, -5, 25, 160, 17873 }, // ý
-    { 19, 30, 16, -3, 23, 143, 18033 }, // þ
-    { 20, 30, 15, -5, 23, 150, 18176 }, // ÿ
-    { 23, 26, 21, -2, 26, 150, 18326 }, // Ā
-    { 17, 22, 17, 0, 21, 94, 18476 }, // ā
-    { 23, 28, 21, -2, 28, 161, 18570 }, // Ă
-    { 17, 24, 17, 0, 23, 102, 18731 }, // ă
-    { 23, 28, 21, -2, 21, 161, 18833 }, // Ą
-    { 17, 23, 17, 0, 16, 98, 18994 }, // ą
-    { 19, 30, 19, 0, 29, 143, 19092 }, // Ć
-    { 15, 26, 13, 0, 25, 98, 19235 }, // ć
-    { 19, 30, 19, 0, 29, 143, 19333 }, // Ĉ
-    { 14, 25, 13, 0, 24, 88, 19476 }, // ĉ
-    { 19, 29, 19, 0, 28, 138, 19564 }, // Ċ
-    { 13, 24, 13, 0, 23, 78, 19702 }, // ċ
-    { 20, 30, 19, 0, 29, 150, 19780 }, // Č
-    { 15, 26, 13, 0, 25, 98, 19930 }, // č
-    { 22, 30, 21, -1, 29, 165, 20028 }, // Ď
-    { 22, 24, 18, 0, 23, 132, 20193 }, // ď
-    { 22, 22, 21, -1, 21, 121, 20325 }, // Đ
-    { 19, 24, 17, 0, 23, 114, 20446 }, // đ
-    { 21, 26, 18, -2, 26, 137, 20560 }, // Ē
-    { 15, 22, 14, 0, 21, 83, 20697 }, // ē
-    { 21, 28, 18, -2, 28, 147, 20780 }, // Ĕ
-    { 15, 24, 14, 0, 23, 90, 20927 }, // ĕ
-    { 21, 28, 18, -2, 28, 147, 21017 }, // Ė
-    { 14, 24, 14, 0, 23, 84, 21164 }, // ė
-    { 21, 28, 18, -2, 21, 147, 21248 }, // Ę
-    { 14, 23, 14, 0, 16, 81, 21395 }, // ę
-    { 21, 29, 18, -2, 29, 153, 21476 }, // Ě
-    { 15, 26, 14, 0, 25, 98, 21629 }, // ě
-    { 20, 30, 21, 0, 29, 150, 21727 }, // Ĝ
-    { 20, 31, 15, -2, 24, 155, 21877 }, // ĝ
-    { 20, 29, 21, 0, 28, 145, 22032 }, // Ğ
-    { 20, 30, 15, -2, 23, 150, 22177 }, // ğ
-    { 20, 29, 21, 0, 28, 145, 22327 }, // Ġ
-    { 20, 30, 15, -2, 23, 150, 22472 }, // ġ
-    { 20, 29, 21, 0, 21, 145, 22622 }, // Ģ
-    { 20, 32, 15, -2, 25, 160, 22767 }, // ģ
-    { 27, 29, 23, -2, 29, 196, 22927 }, // Ĥ
-    { 17, 31, 17, 0, 30, 132, 23123 }, // ĥ
-    { 27, 21, 23, -2, 21, 142, 23255 }, // Ħ
-    { 17, 24, 17, 0, 23, 102, 23397 }, // ħ
-    { 16, 28, 12, -2, 28, 112, 23499 }, // Ĩ
-    { 12, 24, 9, 1, 23, 72, 23611 }, // ĩ
-    { 16, 26, 12, -2, 26, 104, 23683 }, // Ī
-    { 11, 22, 9, 1, 21, 61, 23787 }, // ī
-    { 16, 28, 12, -2, 28, 112, 23848 }, // Ĭ
-    { 11, 24, 9, 1, 23, 66, 23960 }, // ĭ
-    { 15, 28, 12, -2, 21, 105, 24026 }, // Į
-    { 9, 30, 9, 1, 23, 68, 24131 }, // į
-    { 15, 28, 12, -2, 28, 105, 24199 }, // İ
-    { 8, 17, 9, 1, 16, 34, 24304 }, // ı
-    { 27, 27, 23, -2, 21, 183, 24338 }, // Ĳ
-    { 19, 30, 19, 1, 23, 143, 24521 }, // ĳ
-    { 20, 35, 11, -6, 29, 175, 24664 }, // Ĵ
-    { 18, 31, 9, -6, 24, 140, 24839 }, // ĵ
-    { 24, 29, 21, -2, 21, 174, 24979 }, // Ķ
-    { 15, 31, 15, 0, 23, 117, 25153 }, // ķ
-    { 16, 17, 17, 0, 16, 68, 25270 }, // ĸ
-    { 18, 29, 17, -2, 29, 131, 25338 }, // Ĺ
-    { 12, 31, 9, 0, 30, 93, 25469 }, // ĺ
-    { 18, 29, 17, -2, 21, 131, 25562 }, // Ļ
-    { 10, 31, 9, -1, 23, 78, 25693 }, // ļ
-    { 19, 23, 17, -2, 23, 110, 25771 }, // Ľ
-    { 14, 24, 10, 0, 23, 84, 25881 }, // ľ
-    { 19, 21, 17, -2, 21, 100, 25965 }, // Ŀ
-    { 14, 24, 12, 0, 23, 84, 26065 }, // ŀ
-    { 18, 21, 17, -2, 21, 95, 26149 }, // Ł
-    { 12, 24, 9, -1, 23, 72, 26244 }, // ł
-    { 25, 30, 22, -1, 29, 188, 26316 }, // Ń
-    { 18, 26, 18, 0, 25, 117, 26504 }, // ń
-    { 25, 29, 22, -1, 21, 182, 26621 }, // Ņ
-    { 18, 24, 18, 0, 16, 108, 26803 }, // ņ
-    { 25, 30, 22, -1, 29, 188, 26911 }, // Ň
-    { 18, 26, 18, 0, 25, 117, 27099 }, // ň
-    { 23, 23, 24, 1, 22, 133, 27216 }, // ŉ
-    { 25, 27, 22, -1, 21, 169, 27349 }, // Ŋ
-    { 16, 23, 17, 0, 16, 92, 27518 }, // ŋ
-    { 21, 27, 21, 0, 26, 142, 27610 }, // Ō
-    { 16, 22, 16, 0, 21, 88, 27752 }, // ō
-    { 21, 29, 21, 0, 28, 153, 27840 }, // Ŏ
-    { 16, 24, 16, 0, 23, 96, 27993 }, // ŏ
-    { 22, 30, 21, 0, 29, 165, 28089 }, // Ő
-    { 17, 26, 16, 0, 25, 111, 28254 }, // ő
-    { 29, 22, 29, 0, 21, 160, 28365 }, // Œ
-    { 24, 17, 24, 0, 16, 102, 28525 }, // œ
-    { 21, 30, 20, -2, 29, 158, 28627 }, // Ŕ
-    { 15, 25, 14, 0, 25, 94, 28785 }, // ŕ
-    { 21, 29, 20, -2, 21, 153, 28879 }, // Ŗ
-    { 16, 24, 14, -1, 16, 96, 29032 }, // ŗ
-    { 21, 30, 20, -2, 29, 158, 29128 }, // Ř
-    { 15, 25, 14, 0, 25, 94, 29286 }, // ř
-    { 17, 30, 16, -1, 29, 128, 29380 }, // Ś
-    { 15, 26, 13, -1, 25, 98, 29508 }, // ś
-    { 17, 30, 16, -1, 29, 128, 29606 }, // Ŝ
-    { 15, 25, 13, -1, 24, 94, 29734 }, // ŝ
-    { 17, 29, 16, -1, 21, 124, 29828 }, // Ş
-    { 14, 24, 13, -1, 16, 84, 29952 }, // ş
-    { 18, 30, 16, -1, 29, 135, 30036 }, // Š
-    { 16, 26, 13, -1, 25, 104, 30171 }, // š
-    { 20, 29, 19, 1, 21, 145, 30275 }, // Ţ
-    { 13, 27, 12, 0, 19, 88, 30420 }, // ţ
-    { 20, 29, 19, 1, 29, 145, 30508 }, // Ť
-    { 15, 25, 12, 0, 24, 94, 30653 }, // ť
-    { 20, 21, 19, 1, 21, 105, 30747 }, // Ŧ
-    { 13, 20, 12, 0, 19, 65, 30852 }, // ŧ
-    { 22, 29, 23, 2, 28, 160, 30917 }, // Ũ
-    { 18, 24, 18, 0, 23, 108, 31077 }, // ũ
-    { 22, 27, 23, 2, 26, 149, 31185 }, // Ū
-    { 18, 22, 18, 0, 21, 99, 31334 }, // ū
-    { 22, 29, 23, 2, 28, 160, 31433 }, // Ŭ
-    { 18, 24, 18, 0, 23, 108, 31593 }, // ŭ
-    { 22, 30, 23, 2, 29, 165, 31701 }, // Ů
-    { 18, 26, 18, 0, 25, 117, 31866 }, // ů
-    { 22, 30, 23, 2, 29, 165, 31983 }, // Ű
-    { 18, 26, 18, 0, 25, 117, 32148 }, // ű
-    { 22, 28, 23, 2, 21, 154, 32265 }, // Ų
-    { 18, 23, 18, 0, 16, 104, 32419 }, // ų
-    { 29, 30, 29, 2, 29, 218, 32523 }, // Ŵ
-    { 22, 25, 22, 0, 24, 138, 32741 }, // ŵ
-    { 21, 29, 19, 1, 29, 153, 32879 }, // Ŷ
-    { 20, 31, 15, -5, 24, 155, 33032 }, // ŷ
-    { 21, 27, 19, 1, 27, 142, 33187 }, // Ÿ
-    { 19, 30, 18, -1, 29, 143, 33329 }, // Ź
-    { 15, 26, 14, -1, 25, 98, 33472 }, // ź
-    { 19, 29, 18, -1, 28, 138, 33570 }, // Ż
-    { 15, 24, 14, -1, 23, 90, 33708 }, // ż
-    { 19, 30, 18, -1, 29, 143, 33798 }, // Ž
-    { 15, 26, 14, -1, 25, 98, 33941 }, // ž
-    { 22, 30, 12, -6, 23, 165, 34039 }, // ſ
-    { 7, 8, 0, -5, 25, 14, 34204 }, // ̀
-    { 6, 8, 0, -2, 25, 12, 34218 }, // ́
-    { 11, 7, 0, -6, 24, 20, 34230 }, // ̂
-    { 10, 5, 0, -5, 23, 13, 34250 }, // ̃
-    { 10, 3, 0, -5, 21, 8, 34263 }, // ̄
-    { 10, 6, 0, -5, 23, 15, 34271 }, // ̆
-    { 6, 5, 0, -3, 23, 8, 34286 }, // ̇
-    { 10, 5, 0, -5, 23, 13, 34294 }, // ̈
-    { 9, 9, 0, -4, 26, 21, 34307 }, // ̉
-    { 8, 9, 0, -4, 25, 18, 34328 }, // ̊
-    { 12, 8, 0, -5, 25, 24, 34346 }, // ̋
-    { 11, 8, 0, -5, 25, 22, 34370 }, // ̌
-    { 9, 7, 0, -6, 24, 16, 34392 }, // ̏
-    { 10, 6, 0, -5, 23, 15, 34408 }, // ̑
-    { 6, 8, 0, -3, 25, 12, 34423 }, // ̒
-    { 7, 9, 0, -3, 26, 16, 34435 }, // ̓
-    { 6, 9, 0, -4, 26, 14, 34451 }, // ̔
-    { 5, 8, 0, -3, 25, 10, 34465 }, // ̕
-    { 6, 7, 0, -3, 19, 11, 34475 }, // ̛
-    { 6, 5, 0, -3, -2, 8, 34486 }, // ̣
-    { 10, 5, 0, -5, -2, 13, 34494 }, // ̤
-    { 8, 7, 0, -4, -1, 14, 34507 }, // ̥
-    { 6, 7, 0, -3, -1, 11, 34521 }, // ̦
-    { 7, 7, 0, -4, -1, 13, 34532 }, // ̧
-    { 6, 8, 0, -3, 1, 12, 34545 }, // ̨
-    { 5, 8, 8, -1, -1, 10, 34557 }, // ̩
-    { 11, 7, 0, -6, -1, 20, 34567 }, // ̭
-    { 10, 7, 0, -5, -1, 18, 34587 }, // ̮
-    { 10, 6, 0, -5, -2, 15, 34605 }, // ̰
-    { 10, 3, 0, -5, -3, 8, 34620 }, // ̱
-    { 10, 6, 0, -5, 23, 15, 34628 }, // ͂
-    { 11, 12, 0, -6, 30, 33, 34643 }, // ̈́
-    { 6, 6, 0, -2, -2, 9, 34676 }, // ͅ
-    { 21, 29, 18, -2, 29, 153, 34685 }, // Ѐ
-    { 21, 27, 18, -2, 27, 142, 34838 }, // Ё
-    { 20, 27, 22, 1, 21, 135, 34980 }, // Ђ
-    { 20, 29, 17, -2, 29, 145, 35115 }, // Ѓ
-    { 19, 22, 19, 0, 21, 105, 35260 }, // Є
-    { 17, 22, 16, -1, 21, 94, 35365 }, // Ѕ
-    { 15, 21, 12, -2, 21, 79, 35459 }, // І
-    { 16, 27, 12, -2, 27, 108, 35538 }, // Ї
-    { 19, 27, 11, -6, 21, 129, 35646 }, // Ј
-    { 28, 22, 27, -2, 21, 154, 35775 }, // Љ
-    { 29, 22, 28, -2, 21, 160, 35929 }, // Њ
-    { 22, 21, 25, 1, 21, 116, 36089 }, // Ћ
-    { 24, 30, 20, -2, 29, 180, 36205 }, // Ќ
-    { 27, 29, 23, -2, 29, 196, 36385 }, // Ѝ
-    { 21, 30, 19, 1, 29, 158, 36581 }, // Ў
-    { 26, 28, 22, -2, 21, 182, 36739 }, // Џ
-    { 23, 21, 21, -2, 21, 121, 36921 }, // А
-    { 20, 22, 18, -2, 21, 110, 37042 }, // Б
-    { 19, 22, 18, -2, 21, 105, 37152 }, // В
-    { 20, 21, 17, -2, 21, 105, 37257 }, // Г
-    { 25, 27, 22, -2, 21, 169, 37362 }, // Д
-    { 21, 21, 18, -2, 21, 111, 37531 }, // Е
-    { 33, 22, 28, -3, 21, 182, 37642 }, // Ж
-    { 17, 22, 17, -1, 21, 94, 37824 }, // З
-    { 27, 21, 23, -2, 21, 142, 37918 }, // И
-    { 27, 29, 23, -2, 29, 196, 38060 }, // Й
-    { 24, 22, 20, -2, 21, 132, 38256 }, // К
-    { 25, 22, 21, -2, 21, 138, 38388 }, // Л
-    { 28, 21, 26, -2, 21, 147, 38526 }, // М
-    { 27, 21, 23, -2, 21, 142, 38673 }, // Н
-    { 21, 22, 21, 0, 21, 116, 38815 }, // О
-    { 26, 21, 23, -2, 21, 137, 38931 }, // П
-    { 20, 21, 18, -2, 21, 105, 39068 }, // Р
-    { 19, 22, 19, 0, 21, 105, 39173 }, // С
-    { 20, 21, 19, 1, 21, 105, 39278 }, // Т
-    { 21, 22, 19, 1, 21, 116, 39383 }, // У
-    { 22, 22, 22, 0, 21, 121, 39499 }, // Ф
-    { 24, 21, 19, -3, 21, 126, 39620 }, // Х
-    { 26, 27, 22, -2, 21, 176, 39746 }, // Ц
-    { 21, 21, 21, 1, 21, 111, 39922 }, // Ч
-    { 33, 21, 29, -2, 21, 174, 40033 }, // Ш
-    { 33, 27, 29, -2, 21, 223, 40207 }, // Щ
-    { 19, 22, 21, 1, 21, 105, 40430 }, // Ъ
-    { 31, 22, 27, -2, 21, 171, 40535 }, // Ы
-    { 19, 22, 18, -2, 21, 105, 40706 }, // Ь
-    { 19, 22, 18, -1, 21, 105, 40811 }, // Э
-    { 32, 22, 30, -2, 21, 176, 40916 }, // Ю
-    { 23, 22, 19, -2, 21, 127, 41092 }, // Я
-    { 17, 17, 17, 0, 16, 73, 41219 }, // а
-    { 18, 25, 16, 0, 24, 113, 41292 }, // б
-    { 15, 17, 15, 0, 16, 64, 41405 }, // в
-    { 13, 17, 13, 0, 16, 56, 41469 }, // г
-    { 16, 24, 16, 0, 23, 96, 41525 }, // д
-    { 14, 17, 14, 0, 16, 60, 41621 }, // е
-    { 26, 17, 26, 0, 16, 111, 41681 }, // ж
-    { 14, 17, 13, -1, 16, 60, 41792 }, // з
-    { 18, 17, 18, 0, 16, 77, 41852 }, // и
-    { 18, 25, 18, 0, 24, 113, 41929 }, // й
-    { 17, 17, 17, 0, 16, 73, 42042 }, // к
-    { 19, 17, 18, -1, 16, 81, 42115 }, // л
-    { 24, 17, 23, -1, 16, 102, 42196 }, // м
-    { 18, 17, 18, 0, 16, 77, 42298 }, // н
-    { 15, 17, 16, 0, 16, 64, 42375 }, // о
-    { 18, 17, 18, 0, 16, 77, 42439 }, // п
-    { 19, 23, 17, -3, 16, 110, 42516 }, // р
-    { 13, 17, 13, 0, 16, 56, 42626 }, // с
-    { 25, 17, 25, 0, 16, 107, 42682 }, // т
-    { 20, 23, 15, -5, 16, 115, 42789 }, // у
-    { 20, 30, 21, 0, 23, 150, 42904 }, // ф
-    { 18, 17, 17, -1, 16, 77, 43054 }, // х
-    { 18, 22, 18, 0, 16, 99, 43131 }, // ц
-    { 17, 17, 18, 0, 16, 73, 43230 }, // ч
-    { 24, 17, 24, 0, 16, 102, 43303 }, // ш
-    { 24, 22, 24, 0, 16, 132, 43405 }, // щ
-    { 16, 17, 16, 0, 16, 68, 43537 }, // ъ
-    { 22, 17, 23, 0, 16, 94, 43605 }, // ы
-    { 14, 17, 15, 0, 16, 60, 43699 }, // ь
-    { 15, 17, 14, -1, 16, 64, 43759 }, // э
-    { 23, 17, 23, 0, 16, 98, 43823 }, // ю
-    { 17, 17, 17, 0, 16, 73, 43921 }, // я
-    { 14, 26, 14, 0, 25, 91, 43994 }, // ѐ
-    { 15, 24, 14, 0, 23, 90, 44085 }, // ё
-    { 16, 30, 17, 0, 23, 120, 44175 }, // ђ
-    { 14, 26, 13, 0, 25, 91, 44295 }, // ѓ
-    { 14, 17, 14, 0, 16, 60, 44386 }, // є
-    { 14, 17, 13, -1, 16, 60, 44446 }, // ѕ
-    { 9, 24, 9, 1, 23, 54, 44506 }, // і
-    { 11, 24, 9, 1, 23, 66, 44560 }, // ї
-    { 16, 30, 9, -6, 23, 120, 44626 }, // ј
-    { 24, 17, 23, -1, 16, 102, 44746 }, // љ
-    { 22, 17, 22, 0, 16, 94, 44848 }, // њ
-    { 17, 24, 17, 0, 23, 102, 44942 }, // ћ
-    { 17, 26, 17, 0, 25, 111, 45044 }, // ќ
-    { 18, 26, 18, 0, 25, 117, 45155 }, // ѝ
-    { 20, 31, 15, -5, 24, 155, 45272 }, // ў
-    { 18, 22, 18, 0, 16, 99, 45427 }, // џ
-    { 19, 24, 21, 1, 23, 114, 45526 }, // Ѣ
-    { 22, 17, 23, 0, 16, 94, 45640 }, // ѣ
-    { 21, 22, 21, 0, 21, 116, 45734 }, // Ѳ
-    { 15, 17, 16, 0, 16, 64, 45850 }, // ѳ
-    { 23, 22, 22, 1, 21, 127, 45914 }, // Ѵ
-    { 19, 17, 17, -1, 16, 81, 46041 }, // ѵ
-    { 27, 35, 24, -2, 29, 237, 46122 }, // Ҋ
-    { 18, 30, 18, 0, 24, 135, 46359 }, // ҋ
-    { 19, 22, 18, -2, 21, 105, 46494 }, // Ҍ
-    { 13, 22, 15, 1, 21, 72, 46599 }, // ҍ
-    { 20, 21, 18, -2, 21, 105, 46671 }, // Ҏ
-    { 19, 23, 17, -3, 16, 110, 46776 }, // ҏ
-    { 20, 25, 17, -2, 25, 125, 46886 }, // Ґ
-    { 15, 21, 14, 0, 20, 79, 47011 }, // ґ
-    { 20, 21, 17, -2, 21, 105, 47090 }, // Ғ
-    { 13, 17, 13, 0, 16, 56, 47195 }, // ғ
-    { 20, 27, 19, -2, 21, 135, 47251 }, // Ҕ
-    { 15, 23, 16, 0, 16, 87, 47386 }, // ҕ
-    { 33, 27, 28, -3, 21, 223, 47473 }, // Җ
-    { 26, 22, 26, 0, 16, 143, 47696 }, // җ
-    { 17, 27, 17, -1, 21, 115, 47839 }, // Ҙ
-    { 14, 22, 13, -1, 16, 77, 47954 }, // ҙ
-    { 24, 27, 20, -2, 21, 162, 48031 }, // Қ
-    { 17, 22, 17, 0, 16, 94, 48193 }, // қ
-    { 25, 22, 21, -2, 21, 138, 48287 }, // Ҝ
-    { 19, 17, 19, 0, 16, 81, 48425 }, // ҝ
-    { 24, 22, 20, -2, 21, 132, 48506 }, // Ҟ
-    { 16, 23, 16, 0, 22, 92, 48638 }, // ҟ
-    { 25, 22, 24, 1, 21, 138, 48730 }, // Ҡ
-    { 19, 17, 19, 0, 16, 81, 48868 }, // ҡ
-    { 27, 27, 23, -2, 21, 183, 48949 }, // Ң
-    { 18, 22, 19, 0, 16, 99, 49132 }, // ң
-    { 31, 21, 27, -2, 21, 163, 49231 }, // Ҥ
-    { 23, 17, 22, 0, 16, 98, 49394 }, // ҥ
-    { 31, 27, 30, -2, 21, 210, 49492 }, // Ҧ
-    { 24, 23, 24, 0, 16, 138, 49702 }, // ҧ
-    { 24, 22, 24, 0, 21, 132, 49840 }, // Ҩ
-    { 19, 17, 19, 0, 16, 81, 49972 }, // ҩ
-    { 19, 27, 19, 0, 21, 129, 50053 }, // Ҫ
-    { 13, 22, 13, 0, 16, 72, 50182 }, // ҫ
-    { 20, 27, 19, 1, 21, 135, 50254 }, // Ҭ
-    { 26, 22, 26, 0, 16, 143, 50389 }, // ҭ
-    { 21, 21, 19, 1, 21, 111, 50532 }, // Ү
-    { 15, 23, 15, 0, 16, 87, 50643 }, // ү
-    { 21, 21, 19, 1, 21, 111, 50730 }, // Ұ
-    { 15, 23, 15, 0, 16, 87, 50841 }, // ұ
-    { 24, 27, 19, -3, 21, 162, 50928 }, // Ҳ
-    { 18, 22, 17, -1, 16, 99, 51090 }, // ҳ
-    { 27, 27, 27, 1, 21, 183, 51189 }, // Ҵ
-    { 18, 27, 18, 0, 21, 122, 51372 }, // ҵ
-    { 21, 27, 21, 1, 21, 142, 51494 }, // Ҷ
-    { 17, 22, 18, 0, 16, 94, 51636 }, // ҷ
-    { 22, 21, 21, 1, 21, 116, 51730 }, // Ҹ
-    { 17, 17, 18, 0, 16, 73, 51846 }, // ҹ
-    { 21, 21, 21, -2, 21, 111, 51919 }, // Һ
-    { 17, 24, 17, 0, 23, 102, 52030 }, // һ
-    { 22, 22, 24, 1, 21, 121, 52132 }, // Ҽ
-    { 17, 17, 17, 0, 16, 73, 52253 }, // ҽ
-    { 22, 28, 24, 1, 21, 154, 52326 }, // Ҿ
-    { 17, 22, 17, 0, 16, 94, 52480 }, // ҿ
-    { 15, 21, 12, -2, 21, 79, 52574 }, // Ӏ
-    { 33, 30, 28, -3, 29, 248, 52653 }, // Ӂ
-    { 26, 25, 26, 0, 24, 163, 52901 }, // ӂ
-    { 24, 27, 21, -2, 21, 162, 53064 }, // Ӄ
-    { 17, 23, 17, 0, 16, 98, 53226 }, // ӄ
-    { 25, 27, 21, -2, 21, 169, 53324 }, // Ӆ
-    { 19, 22, 18, -1, 16, 105, 53493 }, // ӆ
-    { 27, 27, 23, -2, 21, 183, 53598 }, // Ӈ
-    { 17, 23, 17, 0, 16, 98, 53781 }, // ӈ
-    { 27, 27, 23, -2, 21, 183, 53879 }, // Ӊ
-    { 18, 22, 18, 0, 16, 99, 54062 }, // ӊ
-    { 21, 27, 21, 1, 21, 142, 54161 }, // Ӌ
-    { 17, 22, 17, 0, 16, 94, 54303 }, // ӌ
-    { 28, 27, 27, -2, 21, 189, 54397 }, // Ӎ
-    { 24, 22, 23, -1, 16, 132, 54586 }, // ӎ
-    { 14, 23, 11, -1, 23, 81, 54718 }, // ӏ
-    { 23, 29, 21, -2, 29, 167, 54799 }, // Ӑ
-    { 17, 25, 17, 0, 24, 107, 54966 }, // ӑ
-    { 23, 27, 21, -2, 27, 156, 55073 }, // Ӓ
-    { 17, 24, 17, 0, 23, 102, 55229 }, // ӓ
-    { 31, 21, 27, -3, 21, 163, 55331 }, // Ӕ
-    { 23, 17, 23, 0, 16, 98, 55494 }, // ӕ
-    { 21, 29, 18, -2, 29, 153, 55592 }, // Ӗ
-    { 15, 25, 14, 0, 24, 94, 55745 }, // ӗ
-    { 19, 22, 19, 0, 21, 105, 55839 }, // Ә
-    { 14, 17, 14, 0, 16, 60, 55944 }, // ә
-    { 19, 28, 19, 0, 27, 133, 56004 }, // Ӛ
-    { 14, 24, 14, 0, 23, 84, 56137 }, // ӛ
-    { 33, 28, 28, -3, 27, 231, 56221 }, // Ӝ
-    { 26, 24, 26, 0, 23, 156, 56452 }, // ӝ
-    { 17, 28, 17, -1, 27, 119, 56608 }, // Ӟ
-    { 15, 24, 13, -1, 23, 90, 56727 }, // ӟ
-    { 18, 22, 16, -1, 21, 99, 56817 }, // Ӡ
-    { 18, 23, 15, -2, 16, 104, 56916 }, // ӡ
-    { 27, 26, 23, -2, 26, 176, 57020 }, // Ӣ
-    { 18, 22, 18, 0, 21, 99, 57196 }, // ӣ
-    { 27, 27, 23, -2, 27, 183, 57295 }, // Ӥ
-    { 18, 24, 18, 0, 23, 108, 57478 }, // ӥ
-    { 21, 28, 21, 0, 27, 147, 57586 }, // Ӧ
-    { 16, 24, 16, 0, 23, 96, 57733 }, // ӧ
-    { 21, 22, 21, 0, 21, 116, 57829 }, // Ө
-    { 15, 17, 16, 0, 16, 64, 57945 }, // ө
-    { 21, 28, 21, 0, 27, 147, 58009 }, // Ӫ
-    { 16, 24, 16, 0, 23, 96, 58156 }, // ӫ
-    { 19, 28, 18, -1, 27, 133, 58252 }, // Ӭ
-    { 15, 24, 14, -1, 23, 90, 58385 }, // ӭ
-    { 21, 27, 19, 1, 26, 142, 58475 }, // Ӯ
-    { 20, 28, 15, -5, 21, 140, 58617 }, // ӯ
-    { 21, 28, 19, 1, 27, 147, 58757 }, // Ӱ
-    { 20, 30, 15, -5, 23, 150, 58904 }, // ӱ
-    { 21, 30, 19, 1, 29, 158, 59054 }, // Ӳ
-    { 20, 32, 15, -5, 25, 160, 59212 }, // ӳ
-    { 21, 27, 21, 1, 27, 142, 59372 }, // Ӵ
-    { 17, 24, 18, 0, 23, 102, 59514 }, // ӵ
-    { 20, 27, 17, -2, 21, 135, 59616 }, // Ӷ
-    { 13, 22, 13, 0, 16, 72, 59751 }, // ӷ
-    { 31, 28, 27, -2, 27, 217, 59823 }, // Ӹ
-    { 22, 24, 23, 0, 23, 132, 60040 }, // ӹ
-    { 20, 27, 17, -2, 21, 135, 60172 }, // Ӻ
-    { 13, 22, 13, 0, 16, 72, 60307 }, // ӻ
-    { 24, 27, 19, -3, 21, 162, 60379 }, // Ӽ
-    { 18, 23, 17, -1, 16, 104, 60541 }, // ӽ
-    { 24, 21, 19, -3, 21, 126, 60645 }, // Ӿ
-    { 18, 17, 17, -1, 16, 77, 60771 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 60848 }, //  
-    { 0, 0, 29, 0, 0, 0, 60848 }, //  
-    { 0, 0, 15, 0, 0, 0, 60848 }, //  
-    { 0, 0, 29, 0, 0, 0, 60848 }, //  
-    { 0, 0, 10, 0, 0, 0, 60848 }, //  
-    { 0, 0, 7, 0, 0, 0, 60848 }, //  
-    { 0, 0, 5, 0, 0, 0, 60848 }, //  
-    { 0, 0, 18, 0, 0, 0, 60848 }, //  
-    { 0, 0, 9, 0, 0, 0, 60848 }, //  
-    { 0, 0, 6, 0, 0, 0, 60848 }, //  
-    { 0, 0, 1, 0, 0, 0, 60848 }, //  
-    { 0, 0, 0, 0, 0, 0, 60848 }, // ​
-    { 2, 24, 0, -1, 17, 12, 60848 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 60860 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 60899 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 60969 }, // ‏
-    { 10, 5, 11, 1, 10, 13, 61039 }, // ‐
-    { 10, 5, 11, 1, 10, 13, 61052 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 61065 }, // ‒
-    { 15, 3, 15, 0, 9, 12, 61076 }, // –
-    { 29, 3, 29, 0, 9, 22, 61088 }, // —
-    { 29, 3, 29, 0, 9, 22, 61110 }, // ―
-    { 11, 30, 15, 2, 23, 83, 61132 }, // ‖
-    { 15, 8, 15, 0, -1, 30, 61215 }, // ‗
-    { 7, 10, 9, 2, 22, 18, 61245 }, // ‘
-    { 8, 10, 9, 1, 22, 20, 61263 }, // ’
-    { 7, 10, 9, 0, 4, 18, 61283 }, // ‚
-    { 7, 10, 9, 1, 22, 18, 61301 }, // ‛
-    { 13, 10, 15, 2, 22, 33, 61319 }, // “
-    { 14, 10, 15, 1, 22, 35, 61352 }, // ”
-    { 13, 10, 15, 0, 4, 33, 61387 }, // „
-    { 13, 10, 15, 1, 22, 33, 61420 }, // ‟
-    { 13, 19, 14, 1, 21, 62, 61453 }, // †
-    { 15, 23, 14, -1, 21, 87, 61515 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 61602 }, // •
-    { 10, 10, 18, 4, 15, 25, 61615 }, // ‣
-    { 6, 6, 8, 1, 5, 9, 61640 }, // ․
-    { 13, 6, 15, 1, 5, 20, 61649 }, // ‥
-    { 25, 6, 29, 2, 5, 38, 61669 }, // …
-    { 6, 6, 8, 1, 11, 9, 61707 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 61716 }, //  
-    { 0, 0, 0, 0, 0, 0, 61716 }, //  
-    { 10, 28, 0, -5, 21, 70, 61716 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 61786 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 61856 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 61924 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 62008 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 62092 }, //  
-    { 39, 24, 41, 1, 22, 234, 62092 }, // ‰
-    { 7, 11, 7, 0, 21, 20, 62326 }, // ′
-    { 13, 11, 13, 0, 21, 36, 62346 }, // ″
-    { 20, 11, 20, 0, 21, 55, 62382 }, // ‴
-    { 7, 11, 7, 0, 21, 20, 62437 }, // ‵
-    { 13, 11, 14, 0, 21, 36, 62457 }, // ‶
-    { 20, 11, 20, 0, 21, 55, 62493 }, // ‷
-    { 13, 6, 14, 1, 0, 20, 62548 }, // ‸
-    { 9, 12, 10, 1, 13, 27, 62568 }, // ‹
-    { 10, 12, 10, 0, 13, 30, 62595 }, // ›
-    { 18, 20, 18, 0, 19, 90, 62625 }, // ※
-    { 17, 23, 18, 1, 22, 98, 62715 }, // ‼
-    { 15, 4, 15, 0, 25, 15, 62813 }, // ‾
-    { 7, 5, 9, 1, 10, 9, 62828 }, // ⁃
-    { 19, 24, 8, -5, 22, 114, 62837 }, // ⁄
-    { 21, 23, 23, 2, 22, 121, 62951 }, // ⁇
-    { 19, 23, 20, 2, 22, 110, 63072 }, // ⁈
-    { 19, 23, 20, 1, 22, 110, 63182 }, // ⁉
-    { 17, 7, 29, 6, 12, 30, 63292 }, // ⁓
-    { 26, 11, 26, 0, 21, 72, 63322 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 63394 }, //  
-    { 0, 0, 0, 0, 0, 0, 63394 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 63394 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 63394 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 63394 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 63394 }, // ⁤
-    { 13, 14, 13, 0, 24, 46, 63394 }, // ⁰
-    { 13, 14, 13, 0, 24, 46, 63440 }, // ⁴
-    { 13, 14, 13, 0, 24, 46, 63486 }, // ⁵
-    { 12, 14, 13, 1, 24, 42, 63532 }, // ⁶
-    { 11, 14, 13, 2, 24, 39, 63574 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 63613 }, // ⁸
-    { 12, 14, 13, 0, 24, 42, 63652 }, // ⁹
-    { 11, 11, 16, 3, 21, 31, 63694 }, // ⁿ
-    { 13, 15, 13, 0, 10, 49, 63725 }, // ₀
-    { 9, 14, 13, 1, 10, 32, 63774 }, // ₁
-    { 12, 14, 13, 0, 10, 42, 63806 }, // ₂
-    { 11, 15, 13, 1, 10, 42, 63848 }, // ₃
-    { 13, 14, 13, 0, 10, 46, 63890 }, // ₄
-    { 13, 14, 13, 0, 9, 46, 63936 }, // ₅
-    { 12, 15, 13, 1, 10, 45, 63982 }, // ₆
-    { 11, 14, 13, 2, 9, 39, 64027 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 64066 }, // ₈
-    { 12, 15, 13, 0, 10, 45, 64108 }, // ₉
-    { 20, 20, 18, -1, 20, 100, 64153 }, // ₣
-    { 19, 22, 18, -1, 21, 105, 64253 }, // ₤
-    { 38, 22, 39, 0, 21, 209, 64358 }, // ₧
-    { 20, 22, 18, -1, 21, 110, 64567 }, // €
-    { 19, 14, 29, 5, 17, 67, 64677 }, // ←
-    { 13, 20, 29, 8, 20, 65, 64744 }, // ↑
-    { 19, 14, 29, 5, 17, 67, 64809 }, // →
-    { 13, 20, 29, 8, 20, 65, 64876 }, // ↓
-    { 19, 14, 29, 5, 17, 67, 64941 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 65008 }, // ↕
-    { 15, 20, 29, 7, 20, 75, 65073 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 65148 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 65213 }, // ↳
-    { 17, 16, 29, 6, 18, 68, 65278 }, // ↵
-    { 19, 16, 29, 5, 18, 76, 65346 }, // ⇐
-    { 17, 18, 29, 6, 19, 77, 65422 }, // ⇑
-    { 19, 16, 29, 5, 18, 76, 65499 }, // ⇒
-    { 17, 18, 29, 6, 19, 77, 65575 }, // ⇓
-    { 19, 16, 29, 5, 18, 76, 65652 }, // ⇔
-    { 21, 22, 29, 4, 21, 116, 65728 }, // ∀
-    { 16, 24, 18, 1, 23, 96, 65844 }, // ∂
-    { 15, 21, 29, 7, 21, 79, 65940 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 66019 }, // ∅
-    { 20, 21, 20, 0, 21, 105, 66157 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 66262 }, // ∇
-    { 21, 21, 29, 4, 21, 111, 66367 }, // ∈
-    { 21, 26, 29, 4, 23, 137, 66478 }, // ∉
-    { 21, 18, 29, 4, 19, 95, 66615 }, // ∊
-    { 21, 21, 29, 4, 21, 111, 66710 }, // ∋
-    { 21, 26, 29, 4, 23, 137, 66821 }, // ∌
-    { 21, 18, 29, 4, 19, 95, 66958 }, // ∍
-    { 23, 26, 24, 1, 21, 150, 67053 }, // ∏
-    { 19, 26, 19, 0, 21, 124, 67203 }, // ∑
-    { 14, 4, 18, 2, 12, 14, 67327 }, // −
-    { 17, 23, 15, -1, 21, 98, 67341 }, // ∕
-    { 15, 23, 15, 0, 21, 87, 67439 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 67526 }, // ∗
-    { 12, 11, 18, 3, 15, 33, 67575 }, // ∘
-    { 6, 6, 18, 6, 11, 9, 67608 }, // ∙
-    { 19, 28, 18, -1, 24, 133, 67617 }, // √
-    { 14, 12, 18, 2, 15, 42, 67750 }, // ∝
-    { 18, 11, 18, 0, 15, 50, 67792 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 67842 }, // ∟
-    { 23, 21, 29, 3, 21, 121, 67942 }, // ∠
-    { 5, 30, 15, 5, 23, 38, 68063 }, // ∣
-    { 11, 30, 15, 2, 23, 83, 68101 }, // ∥
-    { 21, 21, 29, 4, 21, 111, 68184 }, // ∧
-    { 21, 21, 29, 4, 21, 111, 68295 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 68406 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 68496 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 68590 }, // ∫
-    { 19, 18, 29, 5, 17, 86, 68710 }, // ∴
-    { 19, 18, 29, 5, 17, 86, 68796 }, // ∵
-    { 7, 17, 9, 1, 18, 30, 68882 }, // ∶
-    { 19, 18, 29, 5, 17, 86, 68912 }, // ∷
-    { 17, 7, 29, 6, 12, 30, 68998 }, // ∼
-    { 17, 17, 29, 6, 18, 73, 69028 }, // ≅
-    { 14, 12, 18, 2, 16, 42, 69101 }, // ≈
-    { 17, 12, 29, 6, 14, 51, 69143 }, // ≍
-    { 14, 15, 18, 2, 17, 53, 69194 }, // ≠
-    { 17, 15, 29, 6, 16, 64, 69247 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 69311 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 69374 }, // ≥
-    { 25, 14, 29, 2, 17, 88, 69437 }, // ≪
-    { 25, 14, 29, 2, 17, 88, 69525 }, // ≫
-    { 21, 18, 29, 4, 19, 95, 69613 }, // ⊃
-    { 21, 26, 29, 4, 23, 137, 69708 }, // ⊄
-    { 21, 26, 29, 4, 23, 137, 69845 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 69982 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 70082 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 70182 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 70298 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 70414 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 70530 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 70646 }, // ⊥
-    { 6, 6, 18, 6, 11, 9, 70736 }, // ⋅
-    { 25, 6, 29, 2, 11, 38, 70745 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 70783 }, // �
+    { 14, 14, 18, 2, 17, 49, 2048 }, // <
+    { 14, 9, 18, 2, 14, 32, 2097 }, // =
+    { 14, 14, 18, 2, 17, 49, 2129 }, // >
+    { 10, 23, 12, 2, 22, 58, 2178 }, // ?
+    { 27, 27, 29, 1, 21, 183, 2236 }, // @
+    { 23, 21, 21, -2, 21, 121, 2419 }, // A
+    { 19, 22, 18, -2, 21, 105, 2540 }, // B
+    { 19, 22, 19, 0, 21, 105, 2645 }, // C
+    { 22, 22, 21, -1, 21, 121, 2750 }, // D
+    { 21, 21, 18, -2, 21, 111, 2871 }, // E
+    { 20, 21, 17, -2, 21, 105, 2982 }, // F
+    { 20, 22, 21, 0, 21, 110, 3087 }, // G
+    { 27, 21, 23, -2, 21, 142, 3197 }, // H
+    { 15, 21, 12, -2, 21, 79, 3339 }, // I
+    { 19, 27, 11, -6, 21, 129, 3418 }, // J
+    { 24, 22, 21, -2, 21, 132, 3547 }, // K
+    { 18, 21, 17, -2, 21, 95, 3679 }, // L
+    { 28, 21, 26, -2, 21, 147, 3774 }, // M
+    { 25, 22, 22, -1, 21, 138, 3921 }, // N
+    { 21, 22, 21, 0, 21, 116, 4096 }, // O
+    { 20, 21, 18, -2, 21, 105, 4212 }, // P
+    { 25, 28, 22, 0, 21, 175, 4317 }, // Q
+    { 21, 22, 20, -2, 21, 116, 4492 }, // R
+    { 17, 22, 16, -1, 21, 94, 4608 }, // S
+    { 20, 21, 19, 1, 21, 105, 4702 }, // T
+    { 22, 22, 23, 2, 21, 121, 4807 }, // U
+    { 23, 22, 21, 1, 21, 127, 4928 }, // V
+    { 29, 22, 29, 2, 21, 160, 5055 }, // W
+    { 24, 21, 19, -3, 21, 126, 5215 }, // X
+    { 21, 21, 19, 1, 21, 111, 5341 }, // Y
+    { 19, 22, 18, -1, 21, 105, 5452 }, // Z
+    { 14, 28, 10, -2, 23, 98, 5557 }, // [
+    { 13, 23, 15, 1, 21, 75, 5655 }, // <backslash>
+    { 14, 28, 10, -2, 23, 98, 5730 }, // ]
+    { 16, 14, 18, 1, 19, 56, 5828 }, // ^
+    { 15, 4, 15, 0, -1, 15, 5884 }, // _
+    { 6, 8, 18, 6, 25, 12, 5899 }, // `
+    { 17, 17, 17, 0, 16, 73, 5911 }, // a
+    { 16, 24, 16, 0, 23, 96, 5984 }, // b
+    { 13, 17, 13, 0, 16, 56, 6080 }, // c
+    { 17, 24, 17, 0, 23, 102, 6144 }, // d
+    { 14, 17, 14, 0, 16, 60, 6246 }, // e
+    { 22, 30, 12, -6, 23, 165, 6306 }, // f
+    { 20, 23, 15, -2, 16, 115, 6471 }, // g
+    { 17, 24, 17, 0, 23, 102, 6586 }, // h
+    { 9, 24, 9, 1, 23, 54, 6688 }, // i
+    { 16, 30, 9, -6, 23, 120, 6742 }, // j
+    { 15, 24, 15, 0, 23, 90, 6862 }, // k
+    { 9, 24, 9, 0, 23, 54, 6952 }, // l
+    { 25, 17, 25, 0, 16, 107, 7006 }, // m
+    { 18, 17, 18, 0, 16, 77, 7113 }, // n
+    { 15, 17, 16, 0, 16, 64, 7190 }, // o
+    { 19, 23, 17, -3, 16, 110, 7254 }, // p
+    { 17, 23, 16, 0, 16, 98, 7364 }, // q
+    { 15, 16, 14, 0, 16, 60, 7462 }, // r
+    { 14, 17, 13, -1, 16, 60, 7522 }, // s
+    { 13, 20, 12, 0, 19, 65, 7582 }, // t
+    { 18, 17, 18, 0, 16, 77, 7647 }, // u
+    { 15, 17, 15, 0, 16, 64, 7724 }, // v
+    { 22, 17, 22, 0, 16, 94, 7788 }, // w
+    { 18, 17, 17, -1, 16, 77, 7882 }, // x
+    { 20, 23, 15, -5, 16, 115, 7959 }, // y
+    { 15, 17, 14, -1, 16, 64, 8074 }, // z
+    { 13, 29, 12, 1, 24, 95, 8192 }, // {
+    { 10, 27, 9, -1, 23, 68, 8287 }, // |
+    { 13, 29, 12, -2, 24, 95, 8355 }, // }
+    { 14, 7, 18, 2, 13, 25, 8450 }, // ~
+    { 0, 0, 6, 0, 0, 0, 8475 }, //  
+    { 10, 23, 10, -1, 16, 58, 8475 }, // ¡
+    { 16, 29, 18, 1, 23, 116, 8533 }, // ¢
+    { 19, 22, 18, -1, 21, 105, 8649 }, // £
+    { 18, 14, 18, 0, 17, 63, 8754 }, // ¤
+    { 20, 20, 18, 1, 20, 100, 8817 }, // ¥
+    { 10, 27, 9, -1, 23, 68, 8917 }, // ¦
+    { 15, 23, 15, -1, 20, 87, 8985 }, // §
+    { 10, 5, 18, 4, 23, 13, 9072 }, // ¨
+    { 22, 22, 23, 0, 21, 121, 9085 }, // ©
+    { 12, 15, 13, 1, 21, 45, 9206 }, // ª
+    { 16, 12, 18, 1, 13, 48, 9251 }, // «
+    { 14, 8, 18, 2, 14, 28, 9299 }, // ¬
+    { 10, 5, 11, 1, 10, 13, 9327 }, // ­
+    { 17, 16, 17, 0, 23, 68, 9340 }, // ®
+    { 10, 3, 18, 4, 21, 8, 9408 }, // ¯
+    { 11, 12, 15, 2, 21, 33, 9416 }, // °
+    { 14, 18, 18, 2, 17, 63, 9449 }, // ±
+    { 12, 14, 13, 0, 24, 42, 9512 }, // ²
+    { 11, 14, 13, 1, 24, 39, 9554 }, // ³
+    { 6, 8, 18, 6, 25, 12, 9593 }, // ´
+    { 20, 23, 18, -2, 16, 115, 9605 }, // µ
+    { 20, 26, 18, -1, 21, 130, 9720 }, // ¶
+    { 5, 6, 9, 2, 11, 8, 9850 }, // ·
+    { 7, 7, 18, 6, -1, 13, 9858 }, // ¸
+    { 9, 14, 13, 1, 24, 32, 9871 }, // ¹
+    { 12, 15, 13, 1, 21, 45, 9903 }, // º
+    { 17, 12, 18, 0, 13, 51, 9948 }, // »
+    { 30, 24, 31, 1, 22, 180, 9999 }, // ¼
+    { 30, 24, 31, 1, 22, 180, 10240 }, // ½
+    { 30, 24, 31, 1, 22, 180, 10420 }, // ¾
+    { 10, 23, 12, 0, 16, 58, 10600 }, // ¿
+    { 23, 29, 21, -2, 29, 167, 10658 }, // À
+    { 23, 29, 21, -2, 29, 167, 10825 }, // Á
+    { 23, 29, 21, -2, 29, 167, 10992 }, // Â
+    { 23, 28, 21, -2, 28, 161, 11159 }, // Ã
+    { 23, 27, 21, -2, 27, 156, 11320 }, // Ä
+    { 23, 29, 21, -2, 29, 167, 11476 }, // Å
+    { 31, 21, 27, -3, 21, 163, 11643 }, // Æ
+    { 19, 29, 19, 0, 21, 138, 11806 }, // Ç
+    { 21, 29, 18, -2, 29, 153, 11944 }, // È
+    { 21, 29, 18, -2, 29, 153, 12097 }, // É
+    { 21, 29, 18, -2, 29, 153, 12288 }, // Ê
+    { 21, 27, 18, -2, 27, 142, 12441 }, // Ë
+    { 15, 29, 12, -2, 29, 109, 12583 }, // Ì
+    { 15, 29, 12, -2, 29, 109, 12692 }, // Í
+    { 16, 29, 12, -2, 29, 116, 12801 }, // Î
+    { 16, 27, 12, -2, 27, 108, 12917 }, // Ï
+    { 22, 22, 21, -1, 21, 121, 13025 }, // Ð
+    { 25, 29, 22, -1, 28, 182, 13146 }, // Ñ
+    { 21, 30, 21, 0, 29, 158, 13328 }, // Ò
+    { 21, 30, 21, 0, 29, 158, 13486 }, // Ó
+    { 21, 30, 21, 0, 29, 158, 13644 }, // Ô
+    { 21, 29, 21, 0, 28, 153, 13802 }, // Õ
+    { 21, 28, 21, 0, 27, 147, 13955 }, // Ö
+    { 13, 13, 18, 3, 16, 43, 14102 }, // ×
+    { 24, 23, 21, -1, 22, 138, 14145 }, // Ø
+    { 22, 30, 23, 2, 29, 165, 14336 }, // Ù
+    { 22, 30, 23, 2, 29, 165, 14501 }, // Ú
+    { 22, 30, 23, 2, 29, 165, 14666 }, // Û
+    { 22, 28, 23, 2, 27, 154, 14831 }, // Ü
+    { 21, 29, 19, 1, 29, 153, 14985 }, // Ý
+    { 19, 21, 17, -2, 21, 100, 15138 }, // Þ
+    { 24, 30, 19, -6, 23, 180, 15238 }, // ß
+    { 17, 26, 17, 0, 25, 111, 15418 }, // à
+    { 17, 26, 17, 0, 25, 111, 15529 }, // á
+    { 17, 25, 17, 0, 24, 107, 15640 }, // â
+    { 17, 24, 17, 0, 23, 102, 15747 }, // ã
+    { 17, 24, 17, 0, 23, 102, 15849 }, // ä
+    { 17, 26, 17, 0, 25, 111, 15951 }, // å
+    { 23, 17, 23, 0, 16, 98, 16062 }, // æ
+    { 13, 24, 13, 0, 16, 78, 16160 }, // ç
+    { 14, 26, 14, 0, 25, 91, 16238 }, // è
+    { 15, 26, 14, 0, 25, 98, 16384 }, // é
+    { 14, 25, 14, 0, 24, 88, 16482 }, // ê
+    { 15, 24, 14, 0, 23, 90, 16570 }, // ë
+    { 8, 26, 9, 1, 25, 52, 16660 }, // ì
+    { 11, 26, 9, 1, 25, 72, 16712 }, // í
+    { 11, 25, 9, 1, 24, 69, 16784 }, // î
+    { 11, 24, 9, 1, 23, 66, 16853 }, // ï
+    { 16, 25, 16, 0, 24, 100, 16919 }, // ð
+    { 18, 24, 18, 0, 23, 108, 17019 }, // ñ
+    { 15, 26, 16, 0, 25, 98, 17127 }, // ò
+    { 16, 26, 16, 0, 25, 104, 17225 }, // ó
+    { 15, 25, 16, 0, 24, 94, 17329 }, // ô
+    { 16, 24, 16, 0, 23, 96, 17423 }, // õ
+    { 16, 24, 16, 0, 23, 96, 17519 }, // ö
+    { 14, 14, 18, 2, 17, 49, 17615 }, // ÷
+    { 19, 17, 16, -2, 16, 81, 17664 }, // ø
+    { 18, 26, 18, 0, 25, 117, 17745 }, // ù
+    { 18, 26, 18, 0, 25, 117, 17862 }, // ú
+    { 18, 25, 18, 0, 24, 113, 17979 }, // û
+    { 18, 24, 18, 0, 23, 108, 18092 }, // ü
+    { 20, 32, 15, -5, 25, 160, 18200 }, // ý
+    { 19, 30, 16, -3, 23, 143, 18432 }, // þ
+    { 20, 30, 15, -5, 23, 150, 18575 }, // ÿ
+    { 23, 26, 21, -2, 26, 150, 18725 }, // Ā
+    { 17, 22, 17, 0, 21, 94, 18875 }, // ā
+    { 23, 28, 21, -2, 28, 161, 18969 }, // Ă
+    { 17, 24, 17, 0, 23, 102, 19130 }, // ă
+    { 23, 28, 21, -2, 21, 161, 19232 }, // Ą
+    { 17, 23, 17, 0, 16, 98, 19393 }, // ą
+    { 19, 30, 19, 0, 29, 143, 19491 }, // Ć
+    { 15, 26, 13, 0, 25, 98, 19634 }, // ć
+    { 19, 30, 19, 0, 29, 143, 19732 }, // Ĉ
+    { 14, 25, 13, 0, 24, 88, 19875 }, // ĉ
+    { 19, 29, 19, 0, 28, 138, 19963 }, // Ċ
+    { 13, 24, 13, 0, 23, 78, 20101 }, // ċ
+    { 20, 30, 19, 0, 29, 150, 20179 }, // Č
+    { 15, 26, 13, 0, 25, 98, 20329 }, // č
+    { 22, 30, 21, -1, 29, 165, 20480 }, // Ď
+    { 22, 24, 18, 0, 23, 132, 20645 }, // ď
+    { 22, 22, 21, -1, 21, 121, 20777 }, // Đ
+    { 19, 24, 17, 0, 23, 114, 20898 }, // đ
+    { 21, 26, 18, -2, 26, 137, 21012 }, // Ē
+    { 15, 22, 14, 0, 21, 83, 21149 }, // ē
+    { 21, 28, 18, -2, 28, 147, 21232 }, // Ĕ
+    { 15, 24, 14, 0, 23, 90, 21379 }, // ĕ
+    { 21, 28, 18, -2, 28, 147, 21469 }, // Ė
+    { 14, 24, 14, 0, 23, 84, 21616 }, // ė
+    { 21, 28, 18, -2, 21, 147, 21700 }, // Ę
+    { 14, 23, 14, 0, 16, 81, 21847 }, // ę
+    { 21, 29, 18, -2, 29, 153, 21928 }, // Ě
+    { 15, 26, 14, 0, 25, 98, 22081 }, // ě
+    { 20, 30, 21, 0, 29, 150, 22179 }, // Ĝ
+    { 20, 31, 15, -2, 24, 155, 22329 }, // ĝ
+    { 20, 29, 21, 0, 28, 145, 22528 }, // Ğ
+    { 20, 30, 15, -2, 23, 150, 22673 }, // ğ
+    { 20, 29, 21, 0, 28, 145, 22823 }, // Ġ
+    { 20, 30, 15, -2, 23, 150, 22968 }, // ġ
+    { 20, 29, 21, 0, 21, 145, 23118 }, // Ģ
+    { 20, 32, 15, -2, 25, 160, 23263 }, // ģ
+    { 27, 29, 23, -2, 29, 196, 23423 }, // Ĥ
+    { 17, 31, 17, 0, 30, 132, 23619 }, // ĥ
+    { 27, 21, 23, -2, 21, 142, 23751 }, // Ħ
+    { 17, 24, 17, 0, 23, 102, 23893 }, // ħ
+    { 16, 28, 12, -2, 28, 112, 23995 }, // Ĩ
+    { 12, 24, 9, 1, 23, 72, 24107 }, // ĩ
+    { 16, 26, 12, -2, 26, 104, 24179 }, // Ī
+    { 11, 22, 9, 1, 21, 61, 24283 }, // ī
+    { 16, 28, 12, -2, 28, 112, 24344 }, // Ĭ
+    { 11, 24, 9, 1, 23, 66, 24456 }, // ĭ
+    { 15, 28, 12, -2, 21, 105, 24576 }, // Į
+    { 9, 30, 9, 1, 23, 68, 24681 }, // į
+    { 15, 28, 12, -2, 28, 105, 24749 }, // İ
+    { 8, 17, 9, 1, 16, 34, 24854 }, // ı
+    { 27, 27, 23, -2, 21, 183, 24888 }, // Ĳ
+    { 19, 30, 19, 1, 23, 143, 25071 }, // ĳ
+    { 20, 35, 11, -6, 29, 175, 25214 }, // Ĵ
+    { 18, 31, 9, -6, 24, 140, 25389 }, // ĵ
+    { 24, 29, 21, -2, 21, 174, 25529 }, // Ķ
+    { 15, 31, 15, 0, 23, 117, 25703 }, // ķ
+    { 16, 17, 17, 0, 16, 68, 25820 }, // ĸ
+    { 18, 29, 17, -2, 29, 131, 25888 }, // Ĺ
+    { 12, 31, 9, 0, 30, 93, 26019 }, // ĺ
+    { 18, 29, 17, -2, 21, 131, 26112 }, // Ļ
+    { 10, 31, 9, -1, 23, 78, 26243 }, // ļ
+    { 19, 23, 17, -2, 23, 110, 26321 }, // Ľ
+    { 14, 24, 10, 0, 23, 84, 26431 }, // ľ
+    { 19, 21, 17, -2, 21, 100, 26515 }, // Ŀ
+    { 14, 24, 12, 0, 23, 84, 26624 }, // ŀ
+    { 18, 21, 17, -2, 21, 95, 26708 }, // Ł
+    { 12, 24, 9, -1, 23, 72, 26803 }, // ł
+    { 25, 30, 22, -1, 29, 188, 26875 }, // Ń
+    { 18, 26, 18, 0, 25, 117, 27063 }, // ń
+    { 25, 29, 22, -1, 21, 182, 27180 }, // Ņ
+    { 18, 24, 18, 0, 16, 108, 27362 }, // ņ
+    { 25, 30, 22, -1, 29, 188, 27470 }, // Ň
+    { 18, 26, 18, 0, 25, 117, 27658 }, // ň
+    { 23, 23, 24, 1, 22, 133, 27775 }, // ŉ
+    { 25, 27, 22, -1, 21, 169, 27908 }, // Ŋ
+    { 16, 23, 17, 0, 16, 92, 28077 }, // ŋ
+    { 21, 27, 21, 0, 26, 142, 28169 }, // Ō
+    { 16, 22, 16, 0, 21, 88, 28311 }, // ō
+    { 21, 29, 21, 0, 28, 153, 28399 }, // Ŏ
+    { 16, 24, 16, 0, 23, 96, 28552 }, // ŏ
+    { 22, 30, 21, 0, 29, 165, 28672 }, // Ő
+    { 17, 26, 16, 0, 25, 111, 28837 }, // ő
+    { 29, 22, 29, 0, 21, 160, 28948 }, // Œ
+    { 24, 17, 24, 0, 16, 102, 29108 }, // œ
+    { 21, 30, 20, -2, 29, 158, 29210 }, // Ŕ
+    { 15, 25, 14, 0, 25, 94, 29368 }, // ŕ
+    { 21, 29, 20, -2, 21, 153, 29462 }, // Ŗ
+    { 16, 24, 14, -1, 16, 96, 29615 }, // ŗ
+    { 21, 30, 20, -2, 29, 158, 29711 }, // Ř
+    { 15, 25, 14, 0, 25, 94, 29869 }, // ř
+    { 17, 30, 16, -1, 29, 128, 29963 }, // Ś
+    { 15, 26, 13, -1, 25, 98, 30091 }, // ś
+    { 17, 30, 16, -1, 29, 128, 30189 }, // Ŝ
+    { 15, 25, 13, -1, 24, 94, 30317 }, // ŝ
+    { 17, 29, 16, -1, 21, 124, 30411 }, // Ş
+    { 14, 24, 13, -1, 16, 84, 30535 }, // ş
+    { 18, 30, 16, -1, 29, 135, 30720 }, // Š
+    { 16, 26, 13, -1, 25, 104, 30855 }, // š
+    { 20, 29, 19, 1, 21, 145, 30959 }, // Ţ
+    { 13, 27, 12, 0, 19, 88, 31104 }, // ţ
+    { 20, 29, 19, 1, 29, 145, 31192 }, // Ť
+    { 15, 25, 12, 0, 24, 94, 31337 }, // ť
+    { 20, 21, 19, 1, 21, 105, 31431 }, // Ŧ
+    { 13, 20, 12, 0, 19, 65, 31536 }, // ŧ
+    { 22, 29, 23, 2, 28, 160, 31601 }, // Ũ
+    { 18, 24, 18, 0, 23, 108, 31761 }, // ũ
+    { 22, 27, 23, 2, 26, 149, 31869 }, // Ū
+    { 18, 22, 18, 0, 21, 99, 32018 }, // ū
+    { 22, 29, 23, 2, 28, 160, 32117 }, // Ŭ
+    { 18, 24, 18, 0, 23, 108, 32277 }, // ŭ
+    { 22, 30, 23, 2, 29, 165, 32385 }, // Ů
+    { 18, 26, 18, 0, 25, 117, 32550 }, // ů
+    { 22, 30, 23, 2, 29, 165, 32768 }, // Ű
+    { 18, 26, 18, 0, 25, 117, 32933 }, // ű
+    { 22, 28, 23, 2, 21, 154, 33050 }, // Ų
+    { 18, 23, 18, 0, 16, 104, 33204 }, // ų
+    { 29, 30, 29, 2, 29, 218, 33308 }, // Ŵ
+    { 22, 25, 22, 0, 24, 138, 33526 }, // ŵ
+    { 21, 29, 19, 1, 29, 153, 33664 }, // Ŷ
+    { 20, 31, 15, -5, 24, 155, 33817 }, // ŷ
+    { 21, 27, 19, 1, 27, 142, 33972 }, // Ÿ
+    { 19, 30, 18, -1, 29, 143, 34114 }, // Ź
+    { 15, 26, 14, -1, 25, 98, 34257 }, // ź
+    { 19, 29, 18, -1, 28, 138, 34355 }, // Ż
+    { 15, 24, 14, -1, 23, 90, 34493 }, // ż
+    { 19, 30, 18, -1, 29, 143, 34583 }, // Ž
+    { 15, 26, 14, -1, 25, 98, 34816 }, // ž
+    { 22, 30, 12, -6, 23, 165, 34914 }, // ſ
+    { 7, 8, 0, -5, 25, 14, 35079 }, // ̀
+    { 6, 8, 0, -2, 25, 12, 35093 }, // ́
+    { 11, 7, 0, -6, 24, 20, 35105 }, // ̂
+    { 10, 5, 0, -5, 23, 13, 35125 }, // ̃
+    { 10, 3, 0, -5, 21, 8, 35138 }, // ̄
+    { 10, 6, 0, -5, 23, 15, 35146 }, // ̆
+    { 6, 5, 0, -3, 23, 8, 35161 }, // ̇
+    { 10, 5, 0, -5, 23, 13, 35169 }, // ̈
+    { 9, 9, 0, -4, 26, 21, 35182 }, // ̉
+    { 8, 9, 0, -4, 25, 18, 35203 }, // ̊
+    { 12, 8, 0, -5, 25, 24, 35221 }, // ̋
+    { 11, 8, 0, -5, 25, 22, 35245 }, // ̌
+    { 9, 7, 0, -6, 24, 16, 35267 }, // ̏
+    { 10, 6, 0, -5, 23, 15, 35283 }, // ̑
+    { 6, 8, 0, -3, 25, 12, 35298 }, // ̒
+    { 7, 9, 0, -3, 26, 16, 35310 }, // ̓
+    { 6, 9, 0, -4, 26, 14, 35326 }, // ̔
+    { 5, 8, 0, -3, 25, 10, 35340 }, // ̕
+    { 6, 7, 0, -3, 19, 11, 35350 }, // ̛
+    { 6, 5, 0, -3, -2, 8, 35361 }, // ̣
+    { 10, 5, 0, -5, -2, 13, 35369 }, // ̤
+    { 8, 7, 0, -4, -1, 14, 35382 }, // ̥
+    { 6, 7, 0, -3, -1, 11, 35396 }, // ̦
+    { 7, 7, 0, -4, -1, 13, 35407 }, // ̧
+    { 6, 8, 0, -3, 1, 12, 35420 }, // ̨
+    { 5, 8, 8, -1, -1, 10, 35432 }, // ̩
+    { 11, 7, 0, -6, -1, 20, 35442 }, // ̭
+    { 10, 7, 0, -5, -1, 18, 35462 }, // ̮
+    { 10, 6, 0, -5, -2, 15, 35480 }, // ̰
+    { 10, 3, 0, -5, -3, 8, 35495 }, // ̱
+    { 10, 6, 0, -5, 23, 15, 35503 }, // ͂
+    { 11, 12, 0, -6, 30, 33, 35518 }, // ̈́
+    { 6, 6, 0, -2, -2, 9, 35551 }, // ͅ
+    { 21, 29, 18, -2, 29, 153, 35560 }, // Ѐ
+    { 21, 27, 18, -2, 27, 142, 35713 }, // Ё
+    { 20, 27, 22, 1, 21, 135, 35855 }, // Ђ
+    { 20, 29, 17, -2, 29, 145, 35990 }, // Ѓ
+    { 19, 22, 19, 0, 21, 105, 36135 }, // Є
+    { 17, 22, 16, -1, 21, 94, 36240 }, // Ѕ
+    { 15, 21, 12, -2, 21, 79, 36334 }, // І
+    { 16, 27, 12, -2, 27, 108, 36413 }, // Ї
+    { 19, 27, 11, -6, 21, 129, 36521 }, // Ј
+    { 28, 22, 27, -2, 21, 154, 36650 }, // Љ
+    { 29, 22, 28, -2, 21, 160, 36864 }, // Њ
+    { 22, 21, 25, 1, 21, 116, 37024 }, // Ћ
+    { 24, 30, 20, -2, 29, 180, 37140 }, // Ќ
+    { 27, 29, 23, -2, 29, 196, 37320 }, // Ѝ
+    { 21, 30, 19, 1, 29, 158, 37516 }, // Ў
+    { 26, 28, 22, -2, 21, 182, 37674 }, // Џ
+    { 23, 21, 21, -2, 21, 121, 37856 }, // А
+    { 20, 22, 18, -2, 21, 110, 37977 }, // Б
+    { 19, 22, 18, -2, 21, 105, 38087 }, // В
+    { 20, 21, 17, -2, 21, 105, 38192 }, // Г
+    { 25, 27, 22, -2, 21, 169, 38297 }, // Д
+    { 21, 21, 18, -2, 21, 111, 38466 }, // Е
+    { 33, 22, 28, -3, 21, 182, 38577 }, // Ж
+    { 17, 22, 17, -1, 21, 94, 38759 }, // З
+    { 27, 21, 23, -2, 21, 142, 38912 }, // И
+    { 27, 29, 23, -2, 29, 196, 39054 }, // Й
+    { 24, 22, 20, -2, 21, 132, 39250 }, // К
+    { 25, 22, 21, -2, 21, 138, 39382 }, // Л
+    { 28, 21, 26, -2, 21, 147, 39520 }, // М
+    { 27, 21, 23, -2, 21, 142, 39667 }, // Н
+    { 21, 22, 21, 0, 21, 116, 39809 }, // О
+    { 26, 21, 23, -2, 21, 137, 39925 }, // П
+    { 20, 21, 18, -2, 21, 105, 40062 }, // Р
+    { 19, 22, 19, 0, 21, 105, 40167 }, // С
+    { 20, 21, 19, 1, 21, 105, 40272 }, // Т
+    { 21, 22, 19, 1, 21, 116, 40377 }, // У
+    { 22, 22, 22, 0, 21, 121, 40493 }, // Ф
+    { 24, 21, 19, -3, 21, 126, 40614 }, // Х
+    { 26, 27, 22, -2, 21, 176, 40740 }, // Ц
+    { 21, 21, 21, 1, 21, 111, 40960 }, // Ч
+    { 33, 21, 29, -2, 21, 174, 41071 }, // Ш
+    { 33, 27, 29, -2, 21, 223, 41245 }, // Щ
+    { 19, 22, 21, 1, 21, 105, 41468 }, // Ъ
+    { 31, 22, 27, -2, 21, 171, 41573 }, // Ы
+    { 19, 22, 18, -2, 21, 105, 41744 }, // Ь
+    { 19, 22, 18, -1, 21, 105, 41849 }, // Э
+    { 32, 22, 30, -2, 21, 176, 41954 }, // Ю
+    { 23, 22, 19, -2, 21, 127, 42130 }, // Я
+    { 17, 17, 17, 0, 16, 73, 42257 }, // а
+    { 18, 25, 16, 0, 24, 113, 42330 }, // б
+    { 15, 17, 15, 0, 16, 64, 42443 }, // в
+    { 13, 17, 13, 0, 16, 56, 42507 }, // г
+    { 16, 24, 16, 0, 23, 96, 42563 }, // д
+    { 14, 17, 14, 0, 16, 60, 42659 }, // е
+    { 26, 17, 26, 0, 16, 111, 42719 }, // ж
+    { 14, 17, 13, -1, 16, 60, 42830 }, // з
+    { 18, 17, 18, 0, 16, 77, 42890 }, // и
+    { 18, 25, 18, 0, 24, 113, 43008 }, // й
+    { 17, 17, 17, 0, 16, 73, 43121 }, // к
+    { 19, 17, 18, -1, 16, 81, 43194 }, // л
+    { 24, 17, 23, -1, 16, 102, 43275 }, // м
+    { 18, 17, 18, 0, 16, 77, 43377 }, // н
+    { 15, 17, 16, 0, 16, 64, 43454 }, // о
+    { 18, 17, 18, 0, 16, 77, 43518 }, // п
+    { 19, 23, 17, -3, 16, 110, 43595 }, // р
+    { 13, 17, 13, 0, 16, 56, 43705 }, // с
+    { 25, 17, 25, 0, 16, 107, 43761 }, // т
+    { 20, 23, 15, -5, 16, 115, 43868 }, // у
+    { 20, 30, 21, 0, 23, 150, 43983 }, // ф
+    { 18, 17, 17, -1, 16, 77, 44133 }, // х
+    { 18, 22, 18, 0, 16, 99, 44210 }, // ц
+    { 17, 17, 18, 0, 16, 73, 44309 }, // ч
+    { 24, 17, 24, 0, 16, 102, 44382 }, // ш
+    { 24, 22, 24, 0, 16, 132, 44484 }, // щ
+    { 16, 17, 16, 0, 16, 68, 44616 }, // ъ
+    { 22, 17, 23, 0, 16, 94, 44684 }, // ы
+    { 14, 17, 15, 0, 16, 60, 44778 }, // ь
+    { 15, 17, 14, -1, 16, 64, 44838 }, // э
+    { 23, 17, 23, 0, 16, 98, 44902 }, // ю
+    { 17, 17, 17, 0, 16, 73, 45056 }, // я
+    { 14, 26, 14, 0, 25, 91, 45129 }, // ѐ
+    { 15, 24, 14, 0, 23, 90, 45220 }, // ё
+    { 16, 30, 17, 0, 23, 120, 45310 }, // ђ
+    { 14, 26, 13, 0, 25, 91, 45430 }, // ѓ
+    { 14, 17, 14, 0, 16, 60, 45521 }, // є
+    { 14, 17, 13, -1, 16, 60, 45581 }, // ѕ
+    { 9, 24, 9, 1, 23, 54, 45641 }, // і
+    { 11, 24, 9, 1, 23, 66, 45695 }, // ї
+    { 16, 30, 9, -6, 23, 120, 45761 }, // ј
+    { 24, 17, 23, -1, 16, 102, 45881 }, // љ
+    { 22, 17, 22, 0, 16, 94, 45983 }, // њ
+    { 17, 24, 17, 0, 23, 102, 46077 }, // ћ
+    { 17, 26, 17, 0, 25, 111, 46179 }, // ќ
+    { 18, 26, 18, 0, 25, 117, 46290 }, // ѝ
+    { 20, 31, 15, -5, 24, 155, 46407 }, // ў
+    { 18, 22, 18, 0, 16, 99, 46562 }, // џ
+    { 19, 24, 21, 1, 23, 114, 46661 }, // Ѣ
+    { 22, 17, 23, 0, 16, 94, 46775 }, // ѣ
+    { 21, 22, 21, 0, 21, 116, 46869 }, // Ѳ
+    { 15, 17, 16, 0, 16, 64, 46985 }, // ѳ
+    { 23, 22, 22, 1, 21, 127, 47104 }, // Ѵ
+    { 19, 17, 17, -1, 16, 81, 47231 }, // ѵ
+    { 27, 35, 24, -2, 29, 237, 47312 }, // Ҋ
+    { 18, 30, 18, 0, 24, 135, 47549 }, // ҋ
+    { 19, 22, 18, -2, 21, 105, 47684 }, // Ҍ
+    { 13, 22, 15, 1, 21, 72, 47789 }, // ҍ
+    { 20, 21, 18, -2, 21, 105, 47861 }, // Ҏ
+    { 19, 23, 17, -3, 16, 110, 47966 }, // ҏ
+    { 20, 25, 17, -2, 25, 125, 48076 }, // Ґ
+    { 15, 21, 14, 0, 20, 79, 48201 }, // ґ
+    { 20, 21, 17, -2, 21, 105, 48280 }, // Ғ
+    { 13, 17, 13, 0, 16, 56, 48385 }, // ғ
+    { 20, 27, 19, -2, 21, 135, 48441 }, // Ҕ
+    { 15, 23, 16, 0, 16, 87, 48576 }, // ҕ
+    { 33, 27, 28, -3, 21, 223, 48663 }, // Җ
+    { 26, 22, 26, 0, 16, 143, 48886 }, // җ
+    { 17, 27, 17, -1, 21, 115, 49029 }, // Ҙ
+    { 14, 22, 13, -1, 16, 77, 49152 }, // ҙ
+    { 24, 27, 20, -2, 21, 162, 49229 }, // Қ
+    { 17, 22, 17, 0, 16, 94, 49391 }, // қ
+    { 25, 22, 21, -2, 21, 138, 49485 }, // Ҝ
+    { 19, 17, 19, 0, 16, 81, 49623 }, // ҝ
+    { 24, 22, 20, -2, 21, 132, 49704 }, // Ҟ
+    { 16, 23, 16, 0, 22, 92, 49836 }, // ҟ
+    { 25, 22, 24, 1, 21, 138, 49928 }, // Ҡ
+    { 19, 17, 19, 0, 16, 81, 50066 }, // ҡ
+    { 27, 27, 23, -2, 21, 183, 50147 }, // Ң
+    { 18, 22, 19, 0, 16, 99, 50330 }, // ң
+    { 31, 21, 27, -2, 21, 163, 50429 }, // Ҥ
+    { 23, 17, 22, 0, 16, 98, 50592 }, // ҥ
+    { 31, 27, 30, -2, 21, 210, 50690 }, // Ҧ
+    { 24, 23, 24, 0, 16, 138, 50900 }, // ҧ
+    { 24, 22, 24, 0, 21, 132, 51038 }, // Ҩ
+    { 19, 17, 19, 0, 16, 81, 51200 }, // ҩ
+    { 19, 27, 19, 0, 21, 129, 51281 }, // Ҫ
+    { 13, 22, 13, 0, 16, 72, 51410 }, // ҫ
+    { 20, 27, 19, 1, 21, 135, 51482 }, // Ҭ
+    { 26, 22, 26, 0, 16, 143, 51617 }, // ҭ
+    { 21, 21, 19, 1, 21, 111, 51760 }, // Ү
+    { 15, 23, 15, 0, 16, 87, 51871 }, // ү
+    { 21, 21, 19, 1, 21, 111, 51958 }, // Ұ
+    { 15, 23, 15, 0, 16, 87, 52069 }, // ұ
+    { 24, 27, 19, -3, 21, 162, 52156 }, // Ҳ
+    { 18, 22, 17, -1, 16, 99, 52318 }, // ҳ
+    { 27, 27, 27, 1, 21, 183, 52417 }, // Ҵ
+    { 18, 27, 18, 0, 21, 122, 52600 }, // ҵ
+    { 21, 27, 21, 1, 21, 142, 52722 }, // Ҷ
+    { 17, 22, 18, 0, 16, 94, 52864 }, // ҷ
+    { 22, 21, 21, 1, 21, 116, 52958 }, // Ҹ
+    { 17, 17, 18, 0, 16, 73, 53074 }, // ҹ
+    { 21, 21, 21, -2, 21, 111, 53248 }, // Һ
+    { 17, 24, 17, 0, 23, 102, 53359 }, // һ
+    { 22, 22, 24, 1, 21, 121, 53461 }, // Ҽ
+    { 17, 17, 17, 0, 16, 73, 53582 }, // ҽ
+    { 22, 28, 24, 1, 21, 154, 53655 }, // Ҿ
+    { 17, 22, 17, 0, 16, 94, 53809 }, // ҿ
+    { 15, 21, 12, -2, 21, 79, 53903 }, // Ӏ
+    { 33, 30, 28, -3, 29, 248, 53982 }, // Ӂ
+    { 26, 25, 26, 0, 24, 163, 54230 }, // ӂ
+    { 24, 27, 21, -2, 21, 162, 54393 }, // Ӄ
+    { 17, 23, 17, 0, 16, 98, 54555 }, // ӄ
+    { 25, 27, 21, -2, 21, 169, 54653 }, // Ӆ
+    { 19, 22, 18, -1, 16, 105, 54822 }, // ӆ
+    { 27, 27, 23, -2, 21, 183, 54927 }, // Ӈ
+    { 17, 23, 17, 0, 16, 98, 55110 }, // ӈ
+    { 27, 27, 23, -2, 21, 183, 55296 }, // Ӊ
+    { 18, 22, 18, 0, 16, 99, 55479 }, // ӊ
+    { 21, 27, 21, 1, 21, 142, 55578 }, // Ӌ
+    { 17, 22, 17, 0, 16, 94, 55720 }, // ӌ
+    { 28, 27, 27, -2, 21, 189, 55814 }, // Ӎ
+    { 24, 22, 23, -1, 16, 132, 56003 }, // ӎ
+    { 14, 23, 11, -1, 23, 81, 56135 }, // ӏ
+    { 23, 29, 21, -2, 29, 167, 56216 }, // Ӑ
+    { 17, 25, 17, 0, 24, 107, 56383 }, // ӑ
+    { 23, 27, 21, -2, 27, 156, 56490 }, // Ӓ
+    { 17, 24, 17, 0, 23, 102, 56646 }, // ӓ
+    { 31, 21, 27, -3, 21, 163, 56748 }, // Ӕ
+    { 23, 17, 23, 0, 16, 98, 56911 }, // ӕ
+    { 21, 29, 18, -2, 29, 153, 57009 }, // Ӗ
+    { 15, 25, 14, 0, 24, 94, 57162 }, // ӗ
+    { 19, 22, 19, 0, 21, 105, 57344 }, // Ә
+    { 14, 17, 14, 0, 16, 60, 57449 }, // ә
+    { 19, 28, 19, 0, 27, 133, 57509 }, // Ӛ
+    { 14, 24, 14, 0, 23, 84, 57642 }, // ӛ
+    { 33, 28, 28, -3, 27, 231, 57726 }, // Ӝ
+    { 26, 24, 26, 0, 23, 156, 57957 }, // ӝ
+    { 17, 28, 17, -1, 27, 119, 58113 }, // Ӟ
+    { 15, 24, 13, -1, 23, 90, 58232 }, // ӟ
+    { 18, 22, 16, -1, 21, 99, 58322 }, // Ӡ
+    { 18, 23, 15, -2, 16, 104, 58421 }, // ӡ
+    { 27, 26, 23, -2, 26, 176, 58525 }, // Ӣ
+    { 18, 22, 18, 0, 21, 99, 58701 }, // ӣ
+    { 27, 27, 23, -2, 27, 183, 58800 }, // Ӥ
+    { 18, 24, 18, 0, 23, 108, 58983 }, // ӥ
+    { 21, 28, 21, 0, 27, 147, 59091 }, // Ӧ
+    { 16, 24, 16, 0, 23, 96, 59238 }, // ӧ
+    { 21, 22, 21, 0, 21, 116, 59392 }, // Ө
+    { 15, 17, 16, 0, 16, 64, 59508 }, // ө
+    { 21, 28, 21, 0, 27, 147, 59572 }, // Ӫ
+    { 16, 24, 16, 0, 23, 96, 59719 }, // ӫ
+    { 19, 28, 18, -1, 27, 133, 59815 }, // Ӭ
+    { 15, 24, 14, -1, 23, 90, 59948 }, // ӭ
+    { 21, 27, 19, 1, 26, 142, 60038 }, // Ӯ
+    { 20, 28, 15, -5, 21, 140, 60180 }, // ӯ
+    { 21, 28, 19, 1, 27, 147, 60320 }, // Ӱ
+    { 20, 30, 15, -5, 23, 150, 60467 }, // ӱ
+    { 21, 30, 19, 1, 29, 158, 60617 }, // Ӳ
+    { 20, 32, 15, -5, 25, 160, 60775 }, // ӳ
+    { 21, 27, 21, 1, 27, 142, 60935 }, // Ӵ
+    { 17, 24, 18, 0, 23, 102, 61077 }, // ӵ
+    { 20, 27, 17, -2, 21, 135, 61179 }, // Ӷ
+    { 13, 22, 13, 0, 16, 72, 61314 }, // ӷ
+    { 31, 28, 27, -2, 27, 217, 61440 }, // Ӹ
+    { 22, 24, 23, 0, 23, 132, 61657 }, // ӹ
+    { 20, 27, 17, -2, 21, 135, 61789 }, // Ӻ
+    { 13, 22, 13, 0, 16, 72, 61924 }, // ӻ
+    { 24, 27, 19, -3, 21, 162, 61996 }, // Ӽ
+    { 18, 23, 17, -1, 16, 104, 62158 }, // ӽ
+    { 24, 21, 19, -3, 21, 126, 62262 }, // Ӿ
+    { 18, 17, 17, -1, 16, 77, 62388 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 62465 }, //  
+    { 0, 0, 29, 0, 0, 0, 62465 }, //  
+    { 0, 0, 15, 0, 0, 0, 62465 }, //  
+    { 0, 0, 29, 0, 0, 0, 62465 }, //  
+    { 0, 0, 10, 0, 0, 0, 62465 }, //  
+    { 0, 0, 7, 0, 0, 0, 62465 }, //  
+    { 0, 0, 5, 0, 0, 0, 62465 }, //  
+    { 0, 0, 18, 0, 0, 0, 62465 }, //  
+    { 0, 0, 9, 0, 0, 0, 62465 }, //  
+    { 0, 0, 6, 0, 0, 0, 62465 }, //  
+    { 0, 0, 1, 0, 0, 0, 62465 }, //  
+    { 0, 0, 0, 0, 0, 0, 62465 }, // ​
+    { 2, 24, 0, -1, 17, 12, 62465 }, // ‌
+    { 6, 26, 0, -3, 19, 39, 62477 }, // ‍
+    { 10, 28, 0, -5, 21, 70, 62516 }, // ‎
+    { 10, 28, 0, -5, 21, 70, 62586 }, // ‏
+    { 10, 5, 11, 1, 10, 13, 62656 }, // ‐
+    { 10, 5, 11, 1, 10, 13, 62669 }, // ‑
+    { 14, 3, 18, 2, 11, 11, 62682 }, // ‒
+    { 15, 3, 15, 0, 9, 12, 62693 }, // –
+    { 29, 3, 29, 0, 9, 22, 62705 }, // —
+    { 29, 3, 29, 0, 9, 22, 62727 }, // ―
+    { 11, 30, 15, 2, 23, 83, 62749 }, // ‖
+    { 15, 8, 15, 0, -1, 30, 62832 }, // ‗
+    { 7, 10, 9, 2, 22, 18, 62862 }, // ‘
+    { 8, 10, 9, 1, 22, 20, 62880 }, // ’
+    { 7, 10, 9, 0, 4, 18, 62900 }, // ‚
+    { 7, 10, 9, 1, 22, 18, 62918 }, // ‛
+    { 13, 10, 15, 2, 22, 33, 62936 }, // “
+    { 14, 10, 15, 1, 22, 35, 62969 }, // ”
+    { 13, 10, 15, 0, 4, 33, 63004 }, // „
+    { 13, 10, 15, 1, 22, 33, 63037 }, // ‟
+    { 13, 19, 14, 1, 21, 62, 63070 }, // †
+    { 15, 23, 14, -1, 21, 87, 63132 }, // ‡
+    { 7, 7, 9, 1, 11, 13, 63219 }, // •
+    { 10, 10, 18, 4, 15, 25, 63232 }, // ‣
+    { 6, 6, 8, 1, 5, 9, 63257 }, // ․
+    { 13, 6, 15, 1, 5, 20, 63266 }, // ‥
+    { 25, 6, 29, 2, 5, 38, 63286 }, // …
+    { 6, 6, 8, 1, 11, 9, 63324 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 63333 }, //  
+    { 0, 0, 0, 0, 0, 0, 63333 }, //  
+    { 10, 28, 0, -5, 21, 70, 63333 }, // ‪
+    { 10, 28, 0, -5, 21, 70, 63403 }, // ‫
+    { 10, 27, 0, -5, 20, 68, 63488 }, // ‬
+    { 12, 28, 0, -6, 21, 84, 63556 }, // ‭
+    { 12, 28, 0, -6, 21, 84, 63640 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 63724 }, //  
+    { 39, 24, 41, 1, 22, 234, 63724 }, // ‰
+    { 7, 11, 7, 0, 21, 20, 63958 }, // ′
+    { 13, 11, 13, 0, 21, 36, 63978 }, // ″
+    { 20, 11, 20, 0, 21, 55, 64014 }, // ‴
+    { 7, 11, 7, 0, 21, 20, 64069 }, // ‵
+    { 13, 11, 14, 0, 21, 36, 64089 }, // ‶
+    { 20, 11, 20, 0, 21, 55, 64125 }, // ‷
+    { 13, 6, 14, 1, 0, 20, 64180 }, // ‸
+    { 9, 12, 10, 1, 13, 27, 64200 }, // ‹
+    { 10, 12, 10, 0, 13, 30, 64227 }, // ›
+    { 18, 20, 18, 0, 19, 90, 64257 }, // ※
+    { 17, 23, 18, 1, 22, 98, 64347 }, // ‼
+    { 15, 4, 15, 0, 25, 15, 64445 }, // ‾
+    { 7, 5, 9, 1, 10, 9, 64460 }, // ⁃
+    { 19, 24, 8, -5, 22, 114, 64469 }, // ⁄
+    { 21, 23, 23, 2, 22, 121, 64583 }, // ⁇
+    { 19, 23, 20, 2, 22, 110, 64704 }, // ⁈
+    { 19, 23, 20, 1, 22, 110, 64814 }, // ⁉
+    { 17, 7, 29, 6, 12, 30, 64924 }, // ⁓
+    { 26, 11, 26, 0, 21, 72, 64954 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 65026 }, //  
+    { 0, 0, 0, 0, 0, 0, 65026 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 65026 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 65026 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 65026 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 65026 }, // ⁤
+    { 13, 14, 13, 0, 24, 46, 65026 }, // ⁰
+    { 13, 14, 13, 0, 24, 46, 65072 }, // ⁴
+    { 13, 14, 13, 0, 24, 46, 65118 }, // ⁵
+    { 12, 14, 13, 1, 24, 42, 65164 }, // ⁶
+    { 11, 14, 13, 2, 24, 39, 65206 }, // ⁷
+    { 11, 14, 13, 1, 24, 39, 65245 }, // ⁸
+    { 12, 14, 13, 0, 24, 42, 65284 }, // ⁹
+    { 11, 11, 16, 3, 21, 31, 65326 }, // ⁿ
+    { 13, 15, 13, 0, 10, 49, 65357 }, // ₀
+    { 9, 14, 13, 1, 10, 32, 65406 }, // ₁
+    { 12, 14, 13, 0, 10, 42, 65438 }, // ₂
+    { 11, 15, 13, 1, 10, 42, 65480 }, // ₃
+    { 13, 14, 13, 0, 10, 46, 65536 }, // ₄
+    { 13, 14, 13, 0, 9, 46, 65582 }, // ₅
+    { 12, 15, 13, 1, 10, 45, 65628 }, // ₆
+    { 11, 14, 13, 2, 9, 39, 65673 }, // ₇
+    { 11, 15, 13, 1, 10, 42, 65712 }, // ₈
+    { 12, 15, 13, 0, 10, 45, 65754 }, // ₉
+    { 20, 20, 18, -1, 20, 100, 65799 }, // ₣
+    { 19, 22, 18, -1, 21, 105, 65899 }, // ₤
+    { 38, 22, 39, 0, 21, 209, 66004 }, // ₧
+    { 20, 22, 18, -1, 21, 110, 66213 }, // €
+    { 19, 14, 29, 5, 17, 67, 66323 }, // ←
+    { 13, 20, 29, 8, 20, 65, 66390 }, // ↑
+    { 19, 14, 29, 5, 17, 67, 66455 }, // →
+    { 13, 20, 29, 8, 20, 65, 66522 }, // ↓
+    { 19, 14, 29, 5, 17, 67, 66587 }, // ↔
+    { 13, 20, 29, 8, 20, 65, 66654 }, // ↕
+    { 15, 20, 29, 7, 20, 75, 66719 }, // ↨
+    { 13, 20, 29, 8, 20, 65, 66794 }, // ↲
+    { 13, 20, 29, 8, 20, 65, 66859 }, // ↳
+    { 17, 16, 29, 6, 18, 68, 66924 }, // ↵
+    { 19, 16, 29, 5, 18, 76, 66992 }, // ⇐
+    { 17, 18, 29, 6, 19, 77, 67068 }, // ⇑
+    { 19, 16, 29, 5, 18, 76, 67145 }, // ⇒
+    { 17, 18, 29, 6, 19, 77, 67221 }, // ⇓
+    { 19, 16, 29, 5, 18, 76, 67298 }, // ⇔
+    { 21, 22, 29, 4, 21, 116, 67374 }, // ∀
+    { 16, 24, 18, 1, 23, 96, 67584 }, // ∂
+    { 15, 21, 29, 7, 21, 79, 67680 }, // ∃
+    { 23, 24, 29, 3, 22, 138, 67759 }, // ∅
+    { 20, 21, 20, 0, 21, 105, 67897 }, // ∆
+    { 19, 22, 29, 5, 21, 105, 68002 }, // ∇
+    { 21, 21, 29, 4, 21, 111, 68107 }, // ∈
+    { 21, 26, 29, 4, 23, 137, 68218 }, // ∉
+    { 21, 18, 29, 4, 19, 95, 68355 }, // ∊
+    { 21, 21, 29, 4, 21, 111, 68450 }, // ∋
+    { 21, 26, 29, 4, 23, 137, 68561 }, // ∌
+    { 21, 18, 29, 4, 19, 95, 68698 }, // ∍
+    { 23, 26, 24, 1, 21, 150, 68793 }, // ∏
+    { 19, 26, 19, 0, 21, 124, 68943 }, // ∑
+    { 14, 4, 18, 2, 12, 14, 69067 }, // −
+    { 17, 23, 15, -1, 21, 98, 69081 }, // ∕
+    { 15, 23, 15, 0, 21, 87, 69179 }, // ∖
+    { 14, 14, 18, 2, 17, 49, 69266 }, // ∗
+    { 12, 11, 18, 3, 15, 33, 69315 }, // ∘
+    { 6, 6, 18, 6, 11, 9, 69348 }, // ∙
+    { 19, 28, 18, -1, 24, 133, 69357 }, // √
+    { 14, 12, 18, 2, 15, 42, 69490 }, // ∝
+    { 18, 11, 18, 0, 15, 50, 69532 }, // ∞
+    { 19, 21, 29, 5, 21, 100, 69632 }, // ∟
+    { 23, 21, 29, 3, 21, 121, 69732 }, // ∠
+    { 5, 30, 15, 5, 23, 38, 69853 }, // ∣
+    { 11, 30, 15, 2, 23, 83, 69891 }, // ∥
+    { 21, 21, 29, 4, 21, 111, 69974 }, // ∧
+    { 21, 21, 29, 4, 21, 111, 70085 }, // ∨
+    { 17, 21, 29, 6, 21, 90, 70196 }, // ∩
+    { 17, 22, 29, 6, 21, 94, 70286 }, // ∪
+    { 16, 30, 18, 1, 23, 120, 70380 }, // ∫
+    { 19, 18, 29, 5, 17, 86, 70500 }, // ∴
+    { 19, 18, 29, 5, 17, 86, 70586 }, // ∵
+    { 7, 17, 9, 1, 18, 30, 70672 }, // ∶
+    { 19, 18, 29, 5, 17, 86, 70702 }, // ∷
+    { 17, 7, 29, 6, 12, 30, 70788 }, // ∼
+    { 17, 17, 29, 6, 18, 73, 70818 }, // ≅
+    { 14, 12, 18, 2, 16, 42, 70891 }, // ≈
+    { 17, 12, 29, 6, 14, 51, 70933 }, // ≍
+    { 14, 15, 18, 2, 17, 53, 70984 }, // ≠
+    { 17, 15, 29, 6, 16, 64, 71037 }, // ≡
+    { 14, 18, 18, 2, 18, 63, 71101 }, // ≤
+    { 14, 18, 18, 2, 18, 63, 71164 }, // ≥
+    { 25, 14, 29, 2, 17, 88, 71227 }, // ≪
+    { 25, 14, 29, 2, 17, 88, 71315 }, // ≫
+    { 21, 18, 29, 4, 19, 95, 71403 }, // ⊃
+    { 21, 26, 29, 4, 23, 137, 71498 }, // ⊄
+    { 21, 26, 29, 4, 23, 137, 71680 }, // ⊅
+    { 19, 21, 29, 5, 21, 100, 71817 }, // ⊆
+    { 19, 21, 29, 5, 21, 100, 71917 }, // ⊇
+    { 21, 22, 29, 4, 21, 116, 72017 }, // ⊕
+    { 21, 22, 29, 4, 21, 116, 72133 }, // ⊖
+    { 21, 22, 29, 4, 21, 116, 72249 }, // ⊗
+    { 21, 22, 29, 4, 21, 116, 72365 }, // ⊘
+    { 17, 21, 29, 6, 21, 90, 72481 }, // ⊥
+    { 6, 6, 18, 6, 11, 9, 72571 }, // ⋅
+    { 25, 6, 29, 2, 11, 38, 72580 }, // ⋯
+    { 27, 28, 29, 1, 24, 189, 72618 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_bolditalicIntervals[] = {
@@ -5273,4 +3317,9 @@ static const EpdFontData bookerly_14_bolditalic = {
     31,
     -8,
     true,
+    bookerly_14_bolditalicBlockOffsets,
+    bookerly_14_bolditalicDirectGlyphs,
+    bookerly_14_bolditalicGlyphPages,
+    256,
+    bookerly_14_bolditalicPageGlyphs,
 };
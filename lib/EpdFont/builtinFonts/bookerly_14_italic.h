@@ -2,4123 +2,2310 @@
  * generated by fontconvert.py
  * name: bookerly_14_italic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_14_italic 14 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_14_italic 14 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_italicBitmaps[65749] = {
-    0x00, 0x05, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x00,
-    0x0F, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x02, 0xC0, 0x00,
-    0xF0, 0x00, 0x3C, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0x0F,
-    0xC0, 0x01, 0x40, 0x00, 0x02, 0x40, 0x90, 0xF4, 0x3D, 0x1F, 0x07, 0xC2, 0xF0, 0xBC, 0x2E, 0x0B,
-    0x83, 0xD0, 0xF4, 0x3C, 0x0F, 0x03, 0x80, 0xE0, 0x34, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x38, 0x00, 0x00, 0xB4, 0x07, 0x40, 0x00, 0x0F, 0x00,
-    0xB0, 0x00, 0xAA, 0xFA, 0xAF, 0xA9, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xD0, 0x2E, 0x00, 0x00,
-    0x2C, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x38, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0xB8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x06, 0xAF, 0xAA, 0xFA, 0xA0, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x1E,
-    0x01, 0xE0, 0x00, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x7F, 0xBF, 0xFC, 0x00, 0xF8, 0x38,
-    0xBD, 0x02, 0xF0, 0x74, 0x3E, 0x03, 0xE0, 0xB0, 0x3D, 0x03, 0xF0, 0xF0, 0x00, 0x02, 0xF8, 0xE0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x07, 0x6F, 0xC0, 0x10, 0x0B, 0x0B, 0xE0, 0xB4, 0x0F, 0x07, 0xE0, 0xF8, 0x0E, 0x07,
-    0xE0, 0xFC, 0x1D, 0x0B, 0xD0, 0xBF, 0x6C, 0x2F, 0x80, 0x3F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0xAF, 0x40, 0x00,
-    0xF8, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x7C, 0x00, 0x07, 0xC0,
-    0x0F, 0x00, 0x3D, 0x00, 0x02, 0xD0, 0x07, 0xC0, 0x2E, 0x00, 0x00, 0xF4, 0x01, 0xE0, 0x1F, 0x00,
-    0x00, 0x3C, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x7C, 0x0F, 0x40, 0x6E, 0x02, 0xE0, 0x3D,
-    0x0B, 0x80, 0xFF, 0xF0, 0x7E, 0xBD, 0x07, 0xC0, 0xF8, 0x2E, 0x07, 0xFD, 0x03, 0xC0, 0xB8, 0x07,
-    0xC0, 0x00, 0x02, 0xD0, 0x3C, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x3C, 0x00, 0x01, 0xF0,
-    0x0F, 0x40, 0x1F, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0xF4, 0x03, 0xC0,
-    0x00, 0xBC, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0xD6, 0xF0, 0x00, 0x3E, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xD0,
-    0x00, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x04, 0x00, 0x2F, 0x7E,
-    0x00, 0x00, 0x34, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xD0, 0x0B, 0xF0, 0x00, 0x1B, 0xFE, 0x01, 0xFB,
-    0xD0, 0x1B, 0xFF, 0x80, 0x0F, 0x0F, 0x81, 0xFF, 0xC0, 0x00, 0xF4, 0x2F, 0x07, 0x4F, 0x00, 0x07,
-    0x80, 0x3E, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0xBD, 0x02, 0xD0, 0x00, 0xF4, 0x00, 0xFC, 0x0F, 0x00,
-    0x03, 0xD0, 0x01, 0xFD, 0xF4, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xD0, 0x07, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xD0, 0xBF, 0xF5, 0x00, 0x01, 0x40,
-    0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x02, 0x43, 0xD1, 0xF0, 0xBC, 0x2E, 0x0F,
-    0x43, 0xC0, 0xE0, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x07, 0xE0, 0x00,
-    0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00,
-    0x3D, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x1C, 0x3E, 0x03, 0xF3, 0xC0, 0x1F, 0xB4, 0x50, 0x1F, 0xFF,
-    0x0B, 0xF5, 0xF3, 0xF3, 0x80, 0x2C, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x60, 0x0F, 0xE0, 0x1F,
-    0x80, 0x7D, 0x02, 0xF0, 0x0F, 0x40, 0xF8, 0x0F, 0x80, 0x64, 0x00, 0x6A, 0xAA, 0x7F, 0xFF, 0xEB,
-    0xFF, 0xF4, 0x06, 0x0B, 0xE3, 0xF8, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x02, 0xFD, 0x5B, 0xF4, 0x00, 0x7E, 0x00,
-    0x2F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0xFC, 0x0B,
-    0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x01,
-    0xF8, 0x3F, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0xD0, 0x2F, 0xC0,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFC, 0x02, 0xFF, 0xF8, 0x00, 0xAB, 0xF4, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x57, 0xFC, 0x00, 0xFC,
-    0x00, 0x7F, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x0E, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xAA, 0x42, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0x96, 0xFD, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0xF0, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x1B, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x04, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1B, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0x9F, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x0F, 0xC3,
-    0xE0, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0,
-    0x0F, 0x80, 0x0F, 0xC0, 0x03, 0xE0, 0x0B, 0xD0, 0x01, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x3F, 0xAA, 0xA8, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x6F, 0xF4,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0xE4, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07,
-    0xF5, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0xBD, 0x00, 0x3F, 0xC0,
-    0x3F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x07, 0xE0, 0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xEA, 0xAB, 0xFC, 0x2F, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x0B, 0xC0, 0x3C,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0x40, 0xFD, 0x00,
-    0xFC, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0xBC, 0x01, 0xF8, 0x01, 0xF8, 0x00,
-    0xFE, 0x07, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03,
-    0xF4, 0x7F, 0xC0, 0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x03, 0xF0, 0x7E,
-    0x00, 0x03, 0xE0, 0x7F, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x3F, 0x80, 0x2F, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFD, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F,
-    0xC0, 0x2F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x2F, 0xC0, 0x03, 0xE0, 0x03, 0xFE, 0x6B, 0xF4, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x01,
-    0x69, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0xFC, 0x02, 0xFC, 0x02, 0xF8, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x2F, 0x80, 0x3F,
-    0x80, 0x3F, 0x00, 0x04, 0x00, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00,
-    0xF8, 0x00, 0x3E, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x10, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xCA, 0xAA,
-    0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xF2, 0xAA,
-    0xAA, 0xA8, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x01,
-    0xFF, 0x40, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x02, 0xA4, 0x00, 0xFF, 0xF0, 0x2F, 0xFF, 0xC1, 0x90, 0xBD, 0x00, 0x03, 0xD0,
-    0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x00, 0xF8,
-    0x00, 0x2E, 0x00, 0x03, 0xFA, 0x00, 0x2F, 0xE0, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xAF, 0xE0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x1F, 0x40, 0x06, 0xE0, 0x90, 0x2F, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0x40, 0x7C,
-    0x0B, 0xC0, 0x0F, 0x82, 0xFC, 0x01, 0xF0, 0x3D, 0x00, 0xBC, 0x02, 0xE0, 0x07, 0xC1, 0xF0, 0x07,
-    0xC0, 0x0B, 0x40, 0x1F, 0x0B, 0x80, 0x2F, 0x00, 0x3C, 0x00, 0xB8, 0x3D, 0x00, 0xF4, 0x01, 0xF0,
-    0x03, 0xD0, 0xF4, 0x03, 0xC0, 0x0F, 0x80, 0x2F, 0x03, 0xC0, 0x1F, 0x00, 0xBD, 0x00, 0xF4, 0x1F,
-    0x00, 0x7C, 0x07, 0xB4, 0x0F, 0x80, 0x3D, 0x00, 0xF8, 0xB6, 0xE6, 0xF8, 0x00, 0xF4, 0x03, 0xFF,
-    0x4B, 0xFF, 0x40, 0x03, 0xE0, 0x03, 0xE4, 0x0B, 0x90, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x3E,
-    0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE5, 0x57,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8, 0x00, 0x03, 0xE0, 0x00,
-    0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00,
-    0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xEA, 0xFF, 0x40, 0x00, 0x7D, 0x01, 0xFC,
-    0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x01, 0xF4,
-    0x00, 0xFC, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x02, 0xFA, 0xAF, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x03, 0xE5, 0x6F, 0xF0, 0x00, 0x7D, 0x00, 0x2F, 0x80, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0xBC, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x1F, 0x40, 0x03, 0xF0, 0x02,
-    0xF0, 0x01, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xF4, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x00, 0xB8, 0x0F, 0xC0, 0x00, 0x0B,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x03, 0xFC, 0x00,
-    0x02, 0xD0, 0x1F, 0xF9, 0x56, 0xFC, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xAF, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x1F, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0xF8,
-    0x00, 0x00, 0x7E, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0,
-    0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x7D, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0x40, 0x1B, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x01, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x2F, 0x40,
-    0x17, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x7C, 0x00, 0x0B,
-    0xC0, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x34, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xD0, 0x02, 0xF8, 0x02, 0xF8,
-    0x00, 0x03, 0xD0, 0x1F, 0x80, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x38, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x55, 0x54, 0xBC, 0x00, 0x07, 0xFF, 0xF2, 0xF0, 0x00, 0x05, 0xBF, 0x0B, 0xD0, 0x00,
-    0x00, 0xF8, 0x2F, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xFF, 0x00, 0x00, 0xBC,
-    0x00, 0xFF, 0x90, 0x1B, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD5, 0x55,
-    0x5B, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xFC, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07,
-    0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xFE,
-    0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x06,
-    0xFF, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xD0,
-    0xBD, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x06, 0xFF, 0x90, 0x1F,
-    0xF8, 0x00, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x4F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF4, 0xBE, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFF, 0xE0,
-    0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x0D, 0x00, 0xF8, 0x00, 0x0B, 0x40, 0x7D, 0x00, 0x03, 0xC0, 0x2F, 0x40, 0x17, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x2F, 0xFE, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFB, 0xC0, 0x00, 0x01, 0xFB, 0xC0,
-    0x02, 0xEB, 0xC0, 0x00, 0x02, 0xE7, 0xD0, 0x07, 0xCB, 0xC0, 0x00, 0x03, 0xD3, 0xD0, 0x0F, 0x4F,
-    0xC0, 0x00, 0x07, 0xC3, 0xE0, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xC3, 0xE0, 0x3D, 0x0F, 0x80, 0x00,
-    0x0F, 0x42, 0xF0, 0x78, 0x0F, 0x80, 0x00, 0x0F, 0x02, 0xF0, 0xF0, 0x0F, 0x80, 0x00, 0x2F, 0x01,
-    0xF2, 0xE0, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0xF7, 0xC0, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0xFF, 0x40,
-    0x1F, 0x40, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0xB8, 0x00, 0xBD, 0x00, 0x1F, 0x00,
-    0x00, 0xF4, 0x00, 0x78, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x10, 0x00, 0x2F, 0x00, 0x1B, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x2F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x2F,
-    0x2F, 0x40, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0xBD, 0x02, 0xF0,
-    0x00, 0x00, 0xF0, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x2F, 0x00,
-    0x7E, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC7, 0xC0, 0x00, 0x03, 0xD0, 0x01, 0xFA, 0xE0, 0x00,
-    0x00, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00,
-    0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFA,
-    0xFF, 0x80, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3E, 0x00,
-    0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x02, 0xF0, 0x02,
-    0xF4, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4,
-    0x00, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0xE0, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xAF, 0xF0, 0x00, 0x01, 0xF4, 0x0B, 0xF0, 0x00, 0x0B,
-    0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x03,
-    0xF0, 0x00, 0x1F, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x02, 0xF8, 0x00, 0x03, 0xF5, 0xBF, 0x80, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7E, 0xBF, 0x00, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x00, 0x0B, 0xC0,
-    0xFC, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xF4, 0x00, 0x07, 0xD0, 0x07, 0xF0,
-    0x00, 0x2F, 0x00, 0x0B, 0xF0, 0x0B, 0xFF, 0xD0, 0x0B, 0xF4, 0xBF, 0xFF, 0x80, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFA, 0xFF, 0x80,
-    0xBD, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0xF0, 0x1F, 0x80, 0x03, 0xC0, 0x7E, 0x00, 0x08, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x02, 0x40, 0x00, 0xFC, 0x1E, 0x00, 0x02, 0xF0,
-    0xBC, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x3E, 0x0B, 0xE0, 0x07, 0xF0, 0x1F, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x2F, 0x00, 0x7C, 0x78, 0x03, 0xF0, 0x07, 0x8B, 0x40, 0x3E,
-    0x00, 0x74, 0x70, 0x07, 0xD0, 0x06, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFC, 0x2F, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x00,
-    0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0x40, 0x00,
-    0x0B, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00,
-    0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xE0, 0x1B, 0xE0, 0x00, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC7, 0xFF, 0x90, 0x06, 0xFF, 0x80, 0x3F,
-    0x00, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x7E,
-    0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0xFC,
-    0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x01, 0xF4,
-    0x1F, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0x03, 0xE3,
-    0xE0, 0x00, 0x00, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0xB0, 0x00,
-    0xFF, 0xFD, 0x2F, 0xFE, 0x00, 0x1F, 0x00, 0x0B, 0xFF, 0x40, 0x7E, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0x80, 0x07, 0xE0, 0x00, 0x7F, 0x40, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xF4, 0x00, 0x3E, 0x00,
-    0x03, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0xF8, 0x00, 0xF8, 0x00, 0x03,
-    0xF0, 0x07, 0xCF, 0x80, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0xFC, 0x02, 0xE0, 0x00, 0x03, 0xF0,
-    0x1F, 0x0B, 0xC0, 0x3C, 0x00, 0x00, 0x3F, 0x03, 0xE0, 0xBC, 0x0B, 0x80, 0x00, 0x02, 0xF0, 0x3C,
-    0x07, 0xC0, 0xF0, 0x00, 0x00, 0x2F, 0x0B, 0x80, 0x7C, 0x2E, 0x00, 0x00, 0x02, 0xF0, 0xF0, 0x07,
-    0xD3, 0xC0, 0x00, 0x00, 0x1F, 0x2E, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x03, 0xDF,
-    0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x1F, 0xFE, 0x40, 0x6F, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x3E,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1B, 0xFF, 0x40, 0x1F, 0xFF, 0x80,
-    0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD,
-    0x2F, 0xFE, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01,
-    0xF8, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0x40, 0x01,
-    0xFC, 0x01, 0xE0, 0x00, 0x3F, 0x00, 0x2D, 0x00, 0x0F, 0xC0, 0x00, 0x80, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xB0, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x02, 0xF0,
-    0x3F, 0x80, 0x55, 0x7E, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03,
-    0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0xAA, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0,
-    0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x6A, 0x40, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xF9, 0xF0,
-    0x00, 0x0F, 0x0F, 0x40, 0x02, 0xE0, 0xB8, 0x00, 0x3D, 0x07, 0xC0, 0x07, 0xC0, 0x3D, 0x00, 0xF8,
-    0x02, 0xF0, 0x0F, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0xF8, 0x3D, 0x00, 0x07, 0xC2, 0x80, 0x00, 0x28,
-    0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x00, 0x00, 0x03, 0x80, 0xBD,
-    0x07, 0xF0, 0x1F, 0x80, 0x7C, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4,
-    0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0,
-    0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00,
-    0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C,
-    0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x1F, 0xD0, 0x03, 0xD2,
-    0xFF, 0xC0, 0x0F, 0x2E, 0x6F, 0x80, 0x7E, 0xD0, 0x3F, 0x02, 0xFE, 0x00, 0xFC, 0x0F, 0xF0, 0x03,
-    0xF0, 0x3F, 0x00, 0x0F, 0x81, 0xF8, 0x00, 0x3D, 0x0B, 0xC0, 0x01, 0xF0, 0x2F, 0x00, 0x0F, 0xC0,
-    0xF8, 0x00, 0x7D, 0x07, 0xD0, 0x03, 0xE0, 0x2F, 0x80, 0x7F, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xDF,
-    0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03,
-    0xF5, 0x7C, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x34, 0x7F, 0x46, 0xF0,
-    0x3F, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x1A, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xF6, 0xF0, 0x00, 0x7F, 0xFF,
-    0xE0, 0x01, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x1F, 0x00, 0x0B,
-    0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x1F, 0x40, 0x7C, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F,
-    0x00, 0xBC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F,
-    0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E, 0x1F, 0x00, 0x7D, 0x3E, 0x01, 0xF8, 0x3D, 0x0B,
-    0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x28,
-    0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x1E,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x20, 0x0F,
-    0x80, 0x00, 0x00, 0xBE, 0x6F, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x2B, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xEF, 0xFF,
-    0x40, 0x02, 0xF4, 0x0F, 0x50, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x03,
-    0xE0, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x6F, 0xF4, 0x00, 0x1F, 0x80,
-    0x0B, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x1F, 0x80, 0x00, 0x7E,
-    0x00, 0x3F, 0xE5, 0x5F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x0A, 0xFA, 0x40, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xF8, 0x0B, 0xF0, 0x00, 0x3D, 0x1F, 0xFE, 0x00, 0x0F, 0x1F, 0x9F, 0xC0, 0x07,
-    0xCF, 0x03, 0xF0, 0x02, 0xEF, 0x00, 0xF8, 0x00, 0xFF, 0x40, 0x3D, 0x00, 0x3F, 0x80, 0x1F, 0x00,
-    0x1F, 0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x7C,
-    0x00, 0x7D, 0x00, 0x2F, 0x1C, 0x2F, 0x00, 0x0F, 0xEF, 0x0B, 0xC0, 0x03, 0xFF, 0x03, 0xE0, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x02, 0xFC, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x1F, 0xFD, 0x00, 0x1F, 0x00, 0x0B,
-    0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF0,
-    0x00, 0xF8, 0x70, 0x3E, 0xBC, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x80, 0xF4,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x0A, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0xBF, 0x80, 0x2E, 0x3F, 0xFD,
-    0x03, 0xEF, 0x43, 0xD0, 0x3F, 0xC0, 0x3D, 0x07, 0xF0, 0x0B, 0xC0, 0xBC, 0x01, 0xF4, 0x0B, 0x81,
-    0xFD, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x2F, 0x0F, 0x80, 0x03,
-    0xE0, 0xBE, 0x00, 0x3D, 0x03, 0xFC, 0x07, 0xD0, 0x0F, 0xFE, 0xBC, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x10, 0x00, 0x14, 0x0F, 0xFD, 0x1A, 0xFD, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xF4, 0x01,
-    0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F,
-    0x40, 0x2F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x3D, 0x28, 0x7E, 0xF4, 0xBF, 0xE0, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xD0, 0x0B, 0xE0, 0xBF, 0xF0, 0xBF,
-    0xF0, 0x7F, 0xF4, 0x03, 0xE2, 0xF7, 0xF1, 0xF6, 0xF4, 0x03, 0xDB, 0x82, 0xE7, 0xC1, 0xF4, 0x03,
-    0xEE, 0x02, 0xEF, 0x01, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xF4, 0x03,
-    0xE0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xD0, 0x07, 0xC0, 0x1F, 0x80, 0x0F,
-    0xC0, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x2F, 0x00, 0x1F, 0x00, 0x0F, 0x4A, 0x3E,
-    0x00, 0x2F, 0x00, 0x1F, 0x7E, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0xF8, 0x7C, 0x00, 0x3D, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xE0, 0xBF,
-    0xF0, 0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4, 0x03, 0xDB, 0x81, 0xF4, 0x03, 0xEE, 0x01, 0xF0, 0x07,
-    0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0, 0x0F, 0xE0, 0x03, 0xD0, 0x0F, 0xC0, 0x07, 0xC0, 0x1F,
-    0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0F, 0x4A, 0x3E, 0x00, 0x1F, 0xBE, 0x3D,
-    0x00, 0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4, 0x00, 0x7E,
-    0x3F, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC, 0xFC, 0x00,
-    0x0F, 0x8F, 0xC0, 0x02, 0xF4, 0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0B, 0xF0,
-    0x02, 0xFF, 0x87, 0xFF, 0xC0, 0x00, 0xF8, 0xF5, 0xFC, 0x00, 0x0F, 0x7C, 0x0B, 0xD0, 0x00, 0xFF,
-    0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x07, 0xD0, 0x02, 0xFC, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xBC, 0x00,
-    0x7D, 0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xBF, 0xF4, 0x00, 0x02,
-    0xF0, 0x10, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x6A, 0xAA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xD2, 0xD0, 0x0B, 0xFF, 0xFF, 0x00, 0xFD, 0x0B, 0xF8, 0x0B, 0xC0,
-    0x07, 0xD0, 0x3D, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xE0, 0x7C, 0x00, 0x1F,
-    0x42, 0xF0, 0x00, 0xFC, 0x0B, 0xC0, 0x07, 0xF0, 0x3F, 0x00, 0x3F, 0x80, 0xFC, 0x03, 0xFD, 0x02,
-    0xF8, 0x7C, 0xF0, 0x07, 0xFF, 0xD3, 0xC0, 0x0B, 0xF8, 0x1F, 0x00, 0x01, 0x00, 0xB8, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x06, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x7E, 0xBF, 0xF1, 0xFF, 0x02,
-    0xE3, 0xFE, 0x03, 0xDB, 0x40, 0x03, 0xEE, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03,
-    0xE0, 0x7C, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x74, 0x01, 0xF0, 0xBE, 0x03, 0xE0,
-    0x7F, 0xFF, 0xC0, 0x1F, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x7C, 0x00, 0x06, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0xF4,
-    0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xD0, 0x00,
-    0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x10, 0x0F, 0x80, 0xB4, 0x0F, 0xD7, 0xF0, 0x0F, 0xFF, 0xC0, 0x07,
-    0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00,
-    0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03,
-    0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F,
-    0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1F,
-    0x87, 0xFE, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xBC, 0x02, 0xF0, 0x02, 0xF0, 0x07, 0xD0, 0x0B, 0xC0,
-    0x0F, 0x80, 0x3D, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0xB8, 0x0F, 0x80, 0x02, 0xF0, 0x7C, 0x00, 0x07,
-    0xC3, 0xD0, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0xFC, 0x00, 0xFC, 0x7F, 0xE0, 0x0B, 0xD0, 0x0B, 0xE0, 0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x02,
-    0xF4, 0x03, 0xF0, 0x03, 0xE0, 0x0F, 0x40, 0x3F, 0x00, 0x3D, 0x00, 0xF8, 0x07, 0xF4, 0x07, 0xC0,
-    0x0F, 0xC0, 0xBF, 0x40, 0xF8, 0x00, 0xBC, 0x0F, 0xF8, 0x0F, 0x00, 0x07, 0xC1, 0xEB, 0x82, 0xE0,
-    0x00, 0x3C, 0x3C, 0x7C, 0x3C, 0x00, 0x03, 0xC7, 0x87, 0xCB, 0x80, 0x00, 0x3D, 0xF0, 0x3D, 0xF0,
-    0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xFC,
-    0x07, 0xFF, 0x00, 0x7F, 0xC0, 0x65, 0xF8, 0x1F, 0x98, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0x7D,
-    0xB8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0x00, 0x3C, 0x2F,
-    0x00, 0x02, 0x5F, 0x41, 0xF9, 0x60, 0x3F, 0xE0, 0x0F, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0,
-    0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00,
-    0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81,
-    0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00,
-    0x07, 0xAD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x90, 0x3C, 0x0F, 0xFF, 0xD7, 0xD0, 0xFA, 0xFF, 0xF8, 0x1D, 0x00, 0xBE, 0x00, 0xC0, 0x0F,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x03, 0x07, 0xFF, 0xA5, 0xF4, 0xFF, 0xFF, 0xFF,
-    0x4B, 0x46, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x00, 0x0B,
-    0xD0, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x02, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x07,
-    0x80, 0x0B, 0x40, 0x0F, 0x40, 0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x3C,
-    0x00, 0x7C, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x3E,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01,
-    0xF8, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x2F,
-    0xF0, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x0D, 0x3F, 0xFF, 0x43, 0xE7,
-    0xD2, 0xFF, 0xFC, 0x74, 0x02, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x0F, 0xC0, 0x07,
-    0xF0, 0x01, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1D,
-    0x00, 0x0B, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0,
-    0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x01, 0xFE, 0x40, 0x02, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0x1E,
-    0x1D, 0x0F, 0xC1, 0xD0, 0x02, 0xF0, 0x2C, 0x00, 0x3E, 0x03, 0xC0, 0x03, 0xD0, 0x38, 0x00, 0x7C,
-    0x07, 0x40, 0x0B, 0xC0, 0xB0, 0x00, 0xBC, 0x0F, 0x00, 0x07, 0xD0, 0xE0, 0x04, 0x3F, 0x1D, 0x07,
-    0xC2, 0xFF, 0xD7, 0xF4, 0x0B, 0xFF, 0xFC, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x0B, 0xD0, 0xBD, 0x00, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x03,
-    0xC0, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x0A, 0xFE, 0xAA, 0x80, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xAF, 0x95, 0x56, 0xB4, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0x96, 0xBF, 0xFE, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x2D, 0x03, 0xD2, 0xFF, 0x8F, 0x80, 0x0F, 0xFE, 0xFF, 0xD0, 0x00,
-    0x7D, 0x01, 0xF4, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x1E, 0x00, 0x0F,
-    0x40, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x03, 0xFD, 0x5F, 0xD0, 0x02, 0xFB,
-    0xFF, 0xEF, 0x40, 0xB8, 0x0A, 0x90, 0x3C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xFF, 0x01, 0xFF,
-    0xF9, 0xFF, 0xF8, 0x07, 0xFF, 0xD0, 0xFE, 0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x1F, 0x40, 0x03,
-    0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x00, 0x3F, 0x03,
-    0xD0, 0x00, 0x19, 0xFD, 0x3F, 0x64, 0x00, 0x7F, 0xFA, 0xFF, 0xD0, 0x00, 0x56, 0xFF, 0x55, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x0B, 0x40, 0x0F,
-    0x40, 0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x14,
-    0x00, 0x00, 0x06, 0xF8, 0x00, 0x0B, 0xFF, 0xD0, 0x0F, 0x41, 0xF8, 0x0F, 0x40, 0x2E, 0x0F, 0xD0,
-    0x07, 0x47, 0xBC, 0x00, 0x02, 0xCB, 0x80, 0x00, 0xF0, 0xF8, 0x00, 0x3C, 0x0B, 0xC0, 0x0B, 0x00,
-    0xBD, 0x01, 0xF0, 0x07, 0xD0, 0x3F, 0x00, 0x7C, 0x03, 0xF4, 0x0F, 0x40, 0x2F, 0x42, 0xD0, 0x01,
-    0xF4, 0x74, 0x00, 0x1F, 0x2D, 0x00, 0x01, 0xEB, 0x09, 0x00, 0x3F, 0x8F, 0x80, 0x0F, 0xD3, 0xF0,
-    0x07, 0xE0, 0xBF, 0x9B, 0xE0, 0x0B, 0xFF, 0xD0, 0x00, 0x15, 0x00, 0x00, 0x18, 0x01, 0x47, 0xE0,
-    0xBE, 0xBE, 0x0F, 0xD7, 0x80, 0xB8, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0x90, 0x5B, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x00,
-    0x2E, 0x00, 0xB4, 0x01, 0xBE, 0x40, 0xB4, 0x0F, 0x00, 0xFF, 0xF8, 0x03, 0xC2, 0xD0, 0x3D, 0x03,
-    0x80, 0x2C, 0x3C, 0x07, 0x80, 0x34, 0x01, 0xE3, 0xC0, 0xB4, 0x00, 0x00, 0x0E, 0x38, 0x0F, 0x00,
-    0x00, 0x00, 0xF3, 0x80, 0xF0, 0x00, 0x00, 0x0F, 0x3C, 0x0F, 0x40, 0x00, 0x00, 0xE3, 0xC0, 0xBC,
-    0x00, 0x00, 0x1E, 0x2D, 0x03, 0xE4, 0x18, 0x02, 0xC0, 0xE0, 0x1F, 0xFF, 0xC0, 0x3C, 0x0B, 0x40,
-    0x1A, 0x90, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03,
-    0xF9, 0x01, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x07, 0xFF, 0xC0, 0x7D, 0x7E, 0x03, 0xD0, 0xB4, 0x1E, 0x03, 0xC0, 0xB4, 0x0F, 0x03,
-    0xC0, 0xB8, 0x0F, 0x07, 0xD1, 0x3E, 0xBB, 0xB4, 0xBF, 0x4F, 0xC0, 0x50, 0x14, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x00, 0x00, 0x18, 0x01, 0x80, 0x0B, 0xC0, 0xBC, 0x03, 0xF0, 0x3F,
-    0x00, 0xFC, 0x1F, 0xC0, 0x7F, 0x07, 0xF0, 0x0F, 0xD0, 0xFC, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF0,
-    0x3E, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x90, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x7F, 0xFF, 0xEB, 0xFF, 0xF4, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x01, 0xD0, 0x0D,
-    0x3F, 0xF4, 0x2C, 0x0B, 0x03, 0x8F, 0x03, 0x83, 0x80, 0xE2, 0xC0, 0xB0, 0xD0, 0x3D, 0xE0, 0x2C,
-    0x34, 0x0F, 0xF0, 0x0B, 0x0E, 0x03, 0x8E, 0x02, 0xC3, 0xC0, 0xE1, 0xE0, 0xE0, 0x70, 0xFE, 0x1D,
-    0x74, 0x0F, 0x00, 0x00, 0x38, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xEA, 0xF8, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x2A, 0xAA, 0x47, 0xFF, 0xFC, 0x2A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0xFF, 0xFD, 0x0B, 0x80, 0xBC, 0x3C, 0x00, 0xF4, 0xF0, 0x03, 0xD3, 0xD0, 0x0F, 0x0B, 0xC0, 0xBC,
-    0x0F, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x2A, 0xAF, 0xAA, 0x8F, 0xFF, 0xFF, 0xF0,
-    0x55, 0xF5, 0x54, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x6F, 0x80, 0x0F, 0xFF, 0xC0, 0xBD, 0x1F, 0x43, 0xC0, 0x3D, 0x04, 0x00, 0xF0, 0x00,
-    0x0F, 0x80, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x2F,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x40, 0x3F, 0xFD, 0x0B, 0x82, 0xE0,
-    0x60, 0x1E, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x02, 0xFF, 0x00, 0x2A, 0xF8, 0x00, 0x07, 0xC0, 0x00,
-    0x7C, 0x00, 0x0F, 0x81, 0x5B, 0xE0, 0xBF, 0xF4, 0x01, 0x94, 0x00, 0x00, 0x40, 0x3E, 0x0B, 0xD1,
-    0xF8, 0x3E, 0x0B, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x3D, 0x00,
-    0x07, 0xD0, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x03, 0xE0,
-    0x00, 0xF4, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0xF8,
-    0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x0B, 0xF4, 0x00, 0x1F, 0xE0, 0xBA, 0xE6, 0xC0, 0xBF, 0xFF, 0xC7, 0xFE, 0x02, 0xDF, 0xF8,
-    0x0F, 0xD0, 0x0F, 0x01, 0x00, 0x04, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xCB, 0x00, 0x00, 0x7F, 0xFF, 0x3C, 0x00,
-    0x03, 0xFF, 0xF8, 0xF0, 0x00, 0x1F, 0xFF, 0xD3, 0x80, 0x00, 0xBF, 0xFF, 0x1D, 0x00, 0x03, 0xFF,
-    0xFC, 0xB0, 0x00, 0x0F, 0xFF, 0xF3, 0xC0, 0x00, 0x2F, 0xFF, 0x8F, 0x00, 0x00, 0x7F, 0xFD, 0x38,
-    0x00, 0x00, 0xFF, 0xF1, 0xD0, 0x00, 0x00, 0xBB, 0xCB, 0x00, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00,
-    0x00, 0x38, 0xF0, 0x00, 0x00, 0x01, 0xD3, 0x80, 0x00, 0x00, 0x0B, 0x1D, 0x00, 0x00, 0x00, 0x3C,
-    0xB0, 0x00, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0x00, 0x07, 0x5D, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00,
-    0x01, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xBE, 0x50, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0xDB, 0xF1, 0xF4, 0x00, 0x00, 0x06, 0x41, 0xFE, 0x03, 0xE0,
-    0x3D, 0x0B, 0x87, 0xE0, 0x50, 0x00, 0x00, 0x1D, 0x07, 0xFD, 0x0B, 0xFC, 0x00, 0x7C, 0x00, 0xBC,
-    0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x1B, 0xF4, 0x7F, 0xFC,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xFF, 0x80, 0x2F, 0x5F, 0x40, 0xF0, 0x2E, 0x0B, 0x80, 0xB8,
-    0x3D, 0x03, 0xE0, 0xF0, 0x0F, 0x03, 0xC0, 0xBC, 0x0F, 0x8B, 0xC0, 0x1F, 0xFC, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x02, 0x00, 0x60, 0x00, 0x3C, 0x07, 0xC0,
-    0x01, 0xF0, 0x2F, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x7F, 0x0B, 0xE0, 0x03, 0xF0, 0x7F, 0x00, 0xFD,
-    0x0F, 0xD0, 0x3F, 0x43, 0xF0, 0x0B, 0xC0, 0xFC, 0x02, 0xF0, 0x3E, 0x00, 0x24, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x6D,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x06, 0xBC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0xFC, 0x02, 0xE0, 0x00,
-    0x0F, 0x40, 0x03, 0xFC, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0x0F, 0x7C, 0x1F, 0xF8, 0x00, 0x7C, 0x00,
-    0x3D, 0x78, 0x7F, 0xFC, 0x00, 0xF0, 0x00, 0xF4, 0xB4, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0xF0,
-    0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x40, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x3D, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x06, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x1F, 0xF4, 0x01, 0xF0,
-    0x00, 0x0F, 0x00, 0xBF, 0xFC, 0x02, 0xE0, 0x00, 0x3C, 0x02, 0xF4, 0x3E, 0x03, 0xD0, 0x00, 0xB4,
-    0x03, 0xC0, 0x2E, 0x1F, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x7F, 0xFC, 0x03, 0xC0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0x42, 0xE0,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x01, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x57, 0xF0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0x00, 0x0F, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0x40, 0x0F, 0x00, 0x03, 0xDF, 0x16, 0xBF,
-    0x80, 0x0B, 0x40, 0x03, 0xD7, 0x8B, 0xFE, 0x40, 0x07, 0xC0, 0x03, 0xD2, 0xD0, 0x50, 0x00, 0x03,
-    0xC0, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x3C, 0x00, 0x00, 0x02, 0xE0, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x07, 0xF8, 0x00, 0xAF, 0xC0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xBD,
-    0x00, 0x1F, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7D, 0x02, 0x43, 0xFF, 0xF8,
-    0x0F, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4,
-    0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E,
-    0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E,
-    0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9, 0x00, 0x06, 0xFF, 0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00,
-    0x3E, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9,
-    0x00, 0x06, 0xFF, 0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00,
-    0x00, 0x07, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xC0,
-    0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x7D,
-    0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x03,
-    0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFA, 0xAA,
-    0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9, 0x00, 0x06, 0xFF, 0xD7, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00,
-    0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0,
-    0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01,
-    0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xD0, 0x1B, 0xF9, 0x00, 0x06, 0xFF, 0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x00, 0x00,
-    0xBC, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8,
-    0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F,
-    0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xF5, 0xF0, 0x00, 0x00, 0x00, 0x1D, 0x07, 0x40, 0x00, 0x00, 0x02, 0xD0, 0xB4, 0x00, 0x00, 0x00,
-    0x1F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8,
-    0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F,
-    0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x80, 0x03, 0x80, 0x00, 0x00,
-    0x03, 0xD7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F, 0x05, 0x50, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x56, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x55, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x0F, 0x80, 0x00, 0x80, 0x00, 0x2E, 0x00, 0x07, 0xD0, 0x00, 0xB4, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x6F, 0x00, 0x2F, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x01, 0xFC, 0x02, 0xF8, 0x00,
-    0x07, 0xC0, 0x7E, 0x00, 0x00, 0xB8, 0x0F, 0xC0, 0x00, 0x0B, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x03, 0xFC, 0x00, 0x02, 0xD0, 0x1F, 0xF9, 0x56, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0,
-    0x01, 0xF4, 0x00, 0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00,
-    0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60,
-    0x00, 0x3E, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x3F, 0x02, 0xE0,
-    0x00, 0x02, 0xE0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00,
-    0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0x0B,
-    0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x40, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x1F, 0x41, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0xBC, 0x00,
-    0x0F, 0x00, 0x03, 0xF0, 0x00, 0x34, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x04, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x18, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0x02,
-    0xF4, 0x01, 0x7E, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x1B, 0xFE, 0x40, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0xBC, 0x00, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x02, 0xF6, 0xF4, 0x00, 0x2F, 0x02, 0xF0, 0x01, 0xE0,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x01, 0xBF, 0xE4,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0xFC, 0x0F, 0xC0, 0x07, 0xF0, 0x7F, 0x00,
-    0x0F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xAF, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x1F, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x02, 0xF8, 0x00,
-    0x7D, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xFF,
-    0xFF, 0xF8, 0x01, 0xF8, 0x3F, 0xFF, 0xFD, 0x00, 0x7E, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x2F,
-    0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8,
-    0x00, 0x03, 0xF4, 0x00, 0x7D, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x40, 0x1B, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE7, 0xC0,
-    0x00, 0x00, 0x00, 0x3D, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xEF, 0x40, 0x03, 0xE0, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0xBD, 0x00,
-    0x3C, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x0F, 0x42, 0xF4, 0x0B, 0xC0, 0x00, 0x03,
-    0xC0, 0x3E, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xBC, 0x01, 0xF8, 0x3C,
-    0x00, 0x00, 0x3E, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x07, 0xEB, 0x80, 0x00, 0x03, 0xC0,
-    0x00, 0xFF, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00,
-    0x01, 0xBF, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4,
-    0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00,
-    0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F,
-    0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03,
-    0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00,
-    0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00,
-    0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00,
-    0x02, 0xD0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00,
-    0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC,
-    0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD,
-    0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40,
-    0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x43,
-    0x40, 0x00, 0x00, 0xFF, 0xDB, 0x80, 0x00, 0x01, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8,
-    0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00,
-    0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F,
-    0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01, 0xFC,
-    0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00,
-    0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x3F, 0x00, 0xBC, 0x0F, 0xC2, 0xF0,
-    0x03, 0xEB, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0xC3, 0xE0, 0x2F,
-    0x00, 0xF8, 0x7C, 0x00, 0x3D, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x55, 0x00, 0x10, 0x00, 0x00,
-    0x7F, 0xFF, 0x82, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xEE, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xE0, 0x00,
-    0x2F, 0x80, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0xFC,
-    0x00, 0xBD, 0x00, 0x03, 0xE3, 0xF0, 0x03, 0xF0, 0x00, 0x3D, 0x0F, 0xC0, 0x1F, 0x80, 0x03, 0xD0,
-    0x3F, 0x00, 0xBD, 0x00, 0x3D, 0x00, 0xFC, 0x02, 0xF4, 0x03, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x7D,
-    0x00, 0x1F, 0x80, 0x3F, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0xFD, 0x7C, 0x00, 0x03, 0xF0, 0x02, 0xFF,
-    0xC0, 0x00, 0x2F, 0x40, 0x07, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xEF, 0xFF, 0xFF, 0x80, 0x00, 0x3C, 0x1B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x7D,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F,
-    0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x02,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00,
-    0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x7D,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F,
-    0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x02,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00,
-    0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x0F, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x7D,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F,
-    0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x02,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00,
-    0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x1F, 0xC1,
-    0xFC, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFC, 0x2F, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0xBC,
-    0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x03,
-    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xE0, 0x1B, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x2F, 0xFE,
-    0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00,
-    0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x0B, 0xC0,
-    0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xEB, 0xFF, 0x00, 0x00, 0xF4, 0x02,
-    0xF8, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x03,
-    0xE0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x07, 0xF0, 0x00, 0xBC, 0x06, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF9, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x2E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x3D,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xE0,
-    0x03, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x08, 0x00, 0x7C, 0x00,
-    0x00, 0xF4, 0xF8, 0x03, 0xD0, 0x00, 0x07, 0xC3, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x9B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07,
-    0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F,
-    0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E,
-    0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07,
-    0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F,
-    0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE,
-    0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xEF,
-    0xC0, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x3C, 0x00, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F,
-    0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F,
-    0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE,
-    0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F,
-    0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x70, 0x00, 0x1F, 0xFD,
-    0xF0, 0x00, 0x2D, 0x3F, 0xE0, 0x00, 0x18, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F,
-    0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F,
-    0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE,
-    0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F,
-    0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0x2F, 0x83, 0xF4, 0x00, 0x3F, 0x43,
-    0xF0, 0x00, 0x2E, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07,
-    0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F,
-    0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE,
-    0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x0B, 0x43,
-    0xC0, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x0B, 0xDB, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F,
-    0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F,
-    0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE,
-    0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F,
-    0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x41, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0xFB, 0xF0, 0x0B, 0xE0, 0x2F, 0xD0, 0x3D, 0x07, 0xE0, 0x03, 0xD0, 0x0F, 0x43,
-    0xE0, 0x02, 0xF0, 0x0B, 0xC2, 0xF0, 0x00, 0xF4, 0x0B, 0xD0, 0xF8, 0x00, 0xBC, 0x1F, 0xD0, 0x7D,
-    0x00, 0x3F, 0x7F, 0xC0, 0x2F, 0x00, 0x2F, 0xFE, 0x40, 0x0B, 0xC0, 0x0F, 0xF4, 0x00, 0x03, 0xF0,
-    0x0F, 0xF8, 0x00, 0x00, 0xFC, 0x0B, 0x7F, 0x00, 0x1D, 0x2F, 0x9B, 0x8F, 0xE0, 0x6F, 0x07, 0xFF,
-    0xC1, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x1F, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF5, 0x7C, 0x0B, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBD, 0x00, 0x34, 0x7F, 0x46, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00,
-    0x40, 0x00, 0x01, 0x90, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xE0,
-    0x00, 0x1F, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E, 0x1F, 0x00,
-    0x7D, 0x3E, 0x01, 0xF8, 0x3D, 0x0B, 0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x0B, 0xEF, 0xD0, 0x0F, 0x80, 0xF8, 0x0B, 0x80, 0x3E, 0x07, 0xC0, 0x1F, 0x43,
-    0xE0, 0x1F, 0x80, 0xF4, 0x2F, 0x80, 0x7D, 0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x1F, 0x81, 0xBD, 0x03, 0xFF, 0xFD, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3E,
-    0xFC, 0x00, 0x3E, 0x1F, 0x00, 0x2F, 0x02, 0xD0, 0x0E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xEF, 0xD0, 0x0F, 0x80, 0xF8, 0x0B, 0x80, 0x3E, 0x07, 0xC0,
-    0x1F, 0x43, 0xE0, 0x1F, 0x80, 0xF4, 0x2F, 0x80, 0x7D, 0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x1F, 0x81, 0xBD, 0x03, 0xFF, 0xFD, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x0B, 0xD0, 0xFC, 0x00, 0xFD, 0x1F,
-    0xC0, 0x0B, 0x40, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0xBE, 0xFD, 0x00, 0x3E, 0x03, 0xE0, 0x0B, 0x80, 0x3E, 0x01, 0xF0, 0x07, 0xD0,
-    0x3E, 0x01, 0xF8, 0x03, 0xD0, 0xBE, 0x00, 0x7D, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x00, 0xFD, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x07, 0xE0, 0x6F, 0x40, 0x3F, 0xFF, 0xD0, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0B, 0xD0, 0x07, 0xF0, 0x01,
-    0xF8, 0x00, 0x7D, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x7F, 0xF4, 0x01, 0xF0, 0x02,
-    0xF0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x40, 0x2F, 0x00, 0x3E,
-    0x1C, 0x3E, 0xBC, 0x7F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07, 0xC0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-    0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00,
-    0x3E, 0x1C, 0x00, 0xFA, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x07, 0xFC, 0x00, 0x7D, 0xF4, 0x03, 0xD2, 0xF0, 0x3D, 0x03, 0xC1, 0xD0,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x7C, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01,
-    0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x1C, 0x00, 0xFA, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x3F, 0x03, 0xF1, 0xFC, 0x2F, 0x83, 0xC0, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-    0x40, 0x00, 0xBC, 0x00, 0x03, 0xE1, 0xC0, 0x0F, 0xAF, 0x00, 0x7F, 0xF0, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x40, 0x00, 0x3F, 0x0F, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x78, 0x7C, 0x00, 0x00, 0x40,
-    0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0xF7, 0xC0, 0x07, 0xFF, 0xFF, 0x40, 0x7E, 0x01, 0xFD,
-    0x03, 0xE0, 0x02, 0xF8, 0x3F, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x3D, 0x3F,
-    0x00, 0x01, 0xF0, 0xFC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x0F, 0xC0, 0x01, 0xF0, 0x3F, 0x00,
-    0x0F, 0x80, 0xBE, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x70, 0x00, 0x1F, 0xFD, 0xF0, 0x00, 0x3D, 0x3F,
-    0xE0, 0x00, 0x18, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x1F, 0xE0, 0xBF, 0xF0, 0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4, 0x03, 0xDB, 0x81,
-    0xF4, 0x03, 0xEE, 0x01, 0xF0, 0x07, 0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0, 0x0F, 0xE0, 0x03,
-    0xD0, 0x0F, 0xC0, 0x07, 0xC0, 0x1F, 0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0F,
-    0x4A, 0x3E, 0x00, 0x1F, 0xBE, 0x3D, 0x00, 0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4,
-    0x00, 0x7E, 0x3F, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC,
-    0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x02, 0xF4, 0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF,
-    0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40,
-    0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xE7, 0xD0, 0x00,
-    0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC, 0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x02, 0xF4, 0xBD,
-    0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2E, 0xBC, 0x00,
-    0x0B, 0xC3, 0xD0, 0x01, 0xF0, 0x2E, 0x00, 0x3C, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4,
-    0x00, 0x7E, 0x3F, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC,
-    0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x02, 0xF4, 0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF,
-    0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x2F, 0xC1,
-    0xC0, 0x01, 0xFF, 0xDF, 0x00, 0x0B, 0x4F, 0xF8, 0x00, 0x18, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x3F,
-    0x41, 0xFC, 0x03, 0xF0, 0x02, 0xF4, 0x1F, 0x40, 0x07, 0xE0, 0xFC, 0x00, 0x0F, 0x87, 0xD0, 0x00,
-    0x7D, 0x2F, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x0F, 0xC0, 0x02, 0xF4,
-    0x2F, 0x40, 0x1F, 0x80, 0x7F, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x50, 0x00, 0xBE, 0x0B, 0xD0, 0x03, 0xF4, 0x3F, 0x40, 0x0B,
-    0x80, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x7F, 0x00, 0xFC, 0x00, 0xBD, 0x07, 0xD0, 0x01, 0xF8,
-    0x3F, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x7D, 0x2F, 0x00, 0x02, 0xF0, 0xFC,
-    0x00, 0x0F, 0x83, 0xF0, 0x00, 0xBD, 0x0B, 0xD0, 0x07, 0xE0, 0x1F, 0xC0, 0x7F, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x0B, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD1, 0xD0, 0x00, 0x3F, 0xFF, 0xEF, 0x00, 0x03, 0xF4, 0x1F, 0xE0, 0x00, 0x3F, 0x00, 0x3F, 0x40,
-    0x01, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xC0, 0x3E, 0xF8, 0x00, 0x7D, 0x03, 0xD7, 0xD0, 0x02, 0xF0,
-    0x7C, 0x1F, 0x40, 0x0B, 0xC7, 0xC0, 0xBC, 0x00, 0x3F, 0xB8, 0x03, 0xF0, 0x00, 0xFF, 0x80, 0x2F,
-    0x40, 0x02, 0xF8, 0x01, 0xF8, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02,
-    0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F,
-    0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF,
-    0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01,
-    0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B,
-    0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB,
-    0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFB,
-    0xC0, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x2C, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01,
-    0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03,
-    0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F,
-    0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B,
-    0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x50, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x2F, 0x83,
-    0xF4, 0x00, 0x1E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01,
-    0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B,
-    0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB,
-    0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF,
-    0xC0, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D,
-    0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F,
-    0x81, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00,
-    0x00, 0x07, 0xAD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1A, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x7F, 0x40, 0x00, 0x3D, 0x2F, 0xFD, 0x00, 0x03, 0xCF, 0x9B, 0xE0, 0x00,
-    0x7E, 0xD0, 0x3F, 0x00, 0x0B, 0xF8, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xE0, 0x01, 0xF8, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3D,
-    0x00, 0x1F, 0x40, 0x03, 0xC0, 0x03, 0xE0, 0x00, 0x7E, 0x01, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0xFB, 0xFF, 0x40, 0x00, 0x0F, 0x41, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x02,
-    0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x02, 0xF8,
-    0x3F, 0x40, 0x00, 0x1E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0xBD, 0x00,
-    0x3E, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00,
-    0x0F, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0xB8, 0x3D,
-    0x00, 0x00, 0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00,
-    0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00,
-    0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9, 0x00, 0x06, 0xFF,
-    0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x0A, 0xAA, 0x90, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0A,
-    0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80,
-    0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00,
-    0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F,
-    0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x60, 0x00, 0x00, 0x07, 0xE0, 0x2D, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0,
-    0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3E,
-    0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9, 0x00,
-    0x06, 0xFF, 0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x24,
-    0x00, 0x1F, 0x40, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0,
-    0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0,
-    0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00,
-    0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0,
-    0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00,
-    0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00,
-    0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD,
-    0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8,
-    0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00,
-    0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00,
-    0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0,
-    0x1F, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x1F, 0xC0,
-    0x2F, 0x80, 0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0B, 0x80, 0xFC, 0x00, 0x00, 0xB0, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x40, 0x3F, 0xC0, 0x00, 0x2D, 0x01, 0xFF,
-    0x95, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xD5, 0xF0, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xBD, 0x00, 0x34, 0x1F, 0xD1, 0xBC, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0x40, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0B, 0x80, 0xFC, 0x00,
-    0x00, 0xB0, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x40, 0x3F,
-    0xC0, 0x00, 0x2D, 0x01, 0xFF, 0x95, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x3E, 0xFC, 0x00, 0x3E, 0x1F, 0x00, 0x2F, 0x02, 0xD0, 0x0E, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xD5, 0xF0, 0x0B, 0xC0, 0x00,
-    0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x34, 0x1F, 0xD1, 0xBC, 0x03, 0xFF, 0xFC,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x7C, 0x07, 0xE0,
-    0x00, 0x0B, 0x80, 0xFC, 0x00, 0x00, 0xB0, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x40, 0x3F, 0xC0, 0x00, 0x2D, 0x01, 0xFF, 0x95, 0x6F, 0xC0, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x03,
-    0xF4, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF5, 0x7C, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xBD, 0x00, 0x34, 0x7F, 0x46, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x90, 0x02, 0xD0, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40,
-    0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0B, 0x80, 0xFC, 0x00, 0x00, 0xB0, 0x2F,
-    0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x40, 0x3F, 0xC0, 0x00, 0x2D,
-    0x01, 0xFF, 0x95, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x80, 0x7D, 0x00, 0x7C, 0x0F, 0x40, 0x03, 0xE3,
-    0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0x57, 0xC0, 0x0B, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x34, 0x07, 0xF4, 0x6F, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x38,
-    0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0xBD, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0xBF, 0xFC, 0x00,
-    0x00, 0x7D, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40,
-    0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x01, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x01,
-    0xF4, 0x00, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x80, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0x0F, 0xD0, 0x01, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xBD,
-    0x00, 0x6F, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x01, 0x40, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x7C, 0x00, 0x00, 0x1A, 0xFD, 0x2D, 0x00, 0x00,
-    0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0x6F, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xF8, 0x2F, 0xE0, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x00, 0xF8, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x07,
-    0xD0, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x00, 0xFB, 0x87, 0x00, 0x0B, 0xE5, 0xF2, 0xE7, 0xC0, 0x01, 0xFF, 0xF4, 0xBF,
-    0xC0, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xAF, 0xFF, 0x00, 0x00, 0x1F, 0x40,
-    0x1F, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00,
-    0x02, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00,
-    0x03, 0xF0, 0xFF, 0xFF, 0xF8, 0x01, 0xF8, 0x3F, 0xFF, 0xFD, 0x00, 0x7E, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0x40, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x7D, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x40, 0x1B, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1A, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x56, 0xF9,
-    0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x06, 0x91, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFD,
-    0x7F, 0xE0, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xBC, 0x00,
-    0x3E, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x07,
-    0xF0, 0x00, 0xBC, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x3E, 0xE1, 0xC0, 0xBE, 0x5F, 0x2E, 0x7C, 0x07,
-    0xFF, 0xD2, 0xFF, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x1B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xC0, 0x00, 0xFC, 0x00,
-    0x0D, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x01, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x06,
-    0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x1F, 0x40, 0x01, 0xF0, 0x00, 0xBD, 0x00, 0x5F, 0x80, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2A, 0xAA, 0x40, 0x2F, 0xFF, 0xF0,
-    0x06, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x02, 0xFB, 0xF4, 0x03, 0xE0, 0x3E, 0x02, 0xE0, 0x0F, 0x81, 0xF0, 0x07, 0xD0, 0xF8, 0x07, 0xE0,
-    0x3D, 0x0B, 0xE0, 0x1F, 0x7F, 0xD0, 0x0B, 0xFF, 0x40, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x00, 0x0A, 0x07, 0xE0, 0x6F, 0x40, 0xFF, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x2E, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x10, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E,
-    0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0C, 0x00, 0xBC, 0x07,
-    0xC0, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xEF, 0xD0, 0x03, 0xE0, 0x3E, 0x00, 0xB8, 0x03, 0xE0,
-    0x1F, 0x00, 0x7D, 0x03, 0xE0, 0x1F, 0x80, 0x3D, 0x0B, 0xE0, 0x07, 0xDF, 0xF4, 0x00, 0xBF, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0x80, 0x7E, 0x06, 0xF4, 0x03,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x02,
-    0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x1F,
-    0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E,
-    0x1F, 0x00, 0x7D, 0x3E, 0x01, 0xF8, 0x3D, 0x0B, 0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFE,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF,
-    0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x80,
-    0x00, 0xF8, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x17, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E, 0x1F, 0x00, 0x7D, 0x3E, 0x01, 0xF8, 0x3D, 0x0B,
-    0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x28,
-    0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0xB4, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0,
-    0x01, 0xF4, 0x00, 0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x80, 0x7D, 0x00, 0x7C, 0x0F, 0x40, 0x03, 0xE3,
-    0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBE, 0xFD, 0x00, 0x3E, 0x03, 0xE0, 0x0B, 0x80, 0x3E,
-    0x01, 0xF0, 0x07, 0xD0, 0x3E, 0x01, 0xF8, 0x03, 0xD0, 0xBE, 0x00, 0x7D, 0xFF, 0x40, 0x0B, 0xFF,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x07, 0xE0, 0x6F, 0x40,
-    0x3F, 0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x00,
-    0xBD, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xF9, 0x00, 0x6F, 0x40,
-    0x3F, 0x40, 0x00, 0x3C, 0x02, 0xF4, 0x00, 0x00, 0xF0, 0x1F, 0x80, 0x00, 0x07, 0x40, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x05, 0x55, 0x4F, 0xC0, 0x00, 0xBF, 0xFE, 0x3F, 0x00, 0x00, 0x5B, 0xE0, 0xFC,
-    0x00, 0x00, 0x1F, 0x43, 0xF4, 0x00, 0x00, 0xBC, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00,
-    0x0F, 0x80, 0x1F, 0xF8, 0x05, 0xBD, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0xBC,
-    0x0B, 0x40, 0x00, 0x03, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xEF, 0xFF, 0x40, 0x02, 0xF4, 0x0F, 0x50, 0x00, 0x0F,
-    0x40, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x3F,
-    0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0x6F, 0xF4, 0x00, 0x1F, 0x80, 0x0B, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xF0,
-    0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x3F, 0xE5, 0x5F, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x00, 0x0A, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x03, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xF9, 0x00, 0x6F, 0x40, 0x3F, 0x40,
-    0x00, 0x3C, 0x02, 0xF4, 0x00, 0x00, 0xF0, 0x1F, 0x80, 0x00, 0x07, 0x40, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x05, 0x55, 0x4F, 0xC0, 0x00, 0xBF, 0xFE, 0x3F, 0x00, 0x00, 0x5B, 0xE0, 0xFC, 0x00, 0x00,
-    0x1F, 0x43, 0xF4, 0x00, 0x00, 0xBC, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x0F, 0x80,
-    0x1F, 0xF8, 0x05, 0xBD, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xC0, 0x00, 0x02, 0xF0,
-    0x1F, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x0B,
-    0xFB, 0xFF, 0xD0, 0x00, 0xBD, 0x03, 0xD4, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x3D,
-    0x00, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0xDB, 0xFD, 0x00,
-    0x07, 0xE0, 0x02, 0xFE, 0x00, 0x3E, 0x00, 0x01, 0xFC, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x07, 0xE0,
-    0x00, 0x1F, 0x80, 0x0F, 0xF9, 0x57, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xBE, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x03, 0xF9, 0x00, 0x6F, 0x40, 0x3F, 0x40, 0x00, 0x3C, 0x02, 0xF4, 0x00, 0x00, 0xF0,
-    0x1F, 0x80, 0x00, 0x07, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x05, 0x55, 0x4F, 0xC0, 0x00, 0xBF,
-    0xFE, 0x3F, 0x00, 0x00, 0x5B, 0xE0, 0xFC, 0x00, 0x00, 0x1F, 0x43, 0xF4, 0x00, 0x00, 0xBC, 0x0B,
-    0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x0F, 0x80, 0x1F, 0xF8, 0x05, 0xBD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xFE, 0x00, 0x02, 0xFE, 0xFF, 0xF4, 0x00, 0x2F, 0x40, 0xF5, 0x00, 0x00, 0xF4, 0x03, 0xE0,
-    0x00, 0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x0F, 0xF6, 0xFF, 0x40, 0x01, 0xF8, 0x00, 0xBF, 0x80, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x7D, 0x00,
-    0x00, 0xBC, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x03, 0xFE, 0x55, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xAF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0F, 0xE4, 0x01, 0xBD, 0x00, 0xFD, 0x00, 0x00, 0xF0, 0x0B, 0xD0,
-    0x00, 0x03, 0xC0, 0x7E, 0x00, 0x00, 0x1D, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x15, 0x55, 0x3F,
-    0x00, 0x02, 0xFF, 0xF8, 0xFC, 0x00, 0x01, 0x6F, 0x83, 0xF0, 0x00, 0x00, 0x7D, 0x0F, 0xD0, 0x00,
-    0x02, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x3E, 0x00, 0x7F, 0xE0, 0x16, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xBF, 0xFD, 0x00, 0x0B, 0xD0, 0x3D, 0x40, 0x00, 0x3D,
-    0x00, 0xF8, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0xFC,
-    0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x03, 0xFD, 0xBF, 0xD0, 0x00, 0x7E, 0x00, 0x2F, 0xE0, 0x03, 0xE0, 0x00, 0x1F, 0xC0,
-    0x1F, 0x40, 0x00, 0x2F, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0x95, 0x7F, 0xC0, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x2B, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF,
-    0x80, 0x1B, 0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x55, 0x55,
-    0x6F, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xFF, 0xF0, 0x01, 0xBF, 0xF8,
-    0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xA0, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xAF, 0xC0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0xF4, 0x7F, 0xF8, 0x00,
-    0x3C, 0x7E, 0x7F, 0x00, 0x1F, 0x3C, 0x0F, 0xC0, 0x0B, 0xBC, 0x03, 0xE0, 0x03, 0xFD, 0x00, 0xF4,
-    0x00, 0xFE, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x0F, 0xC0, 0x03,
-    0xD0, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xF4, 0x00, 0xBC, 0x70, 0xBC, 0x00, 0x3F, 0xBC, 0x2F, 0x00,
-    0x0F, 0xFC, 0x0F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD5, 0x55, 0x5B, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFE, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xFE, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x5B, 0xD5, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x06, 0xA0, 0x00, 0x3D, 0x0F, 0xFE, 0x00, 0x1F, 0x0F, 0xFF, 0xC0, 0x07, 0xCF,
-    0x43, 0xE0, 0x02, 0xEF, 0x40, 0xF8, 0x00, 0xFF, 0x40, 0x3D, 0x00, 0x3F, 0x80, 0x1F, 0x00, 0x1F,
-    0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x7C, 0x00,
-    0x7D, 0x00, 0x2F, 0x1C, 0x2F, 0x00, 0x0F, 0xEF, 0x0B, 0xC0, 0x03, 0xFF, 0x03, 0xE0, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0x00, 0x2F, 0xF9, 0xF0,
-    0x03, 0xDB, 0xFD, 0x00, 0x34, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x0F, 0xE0, 0xE0, 0xFF, 0xDB, 0x83,
-    0xCB, 0xFC, 0x0D, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x01,
-    0xFF, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x87, 0x00, 0x3E, 0xBC,
-    0x01, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x90, 0x03, 0xFF, 0xFE,
-    0x00, 0x1A, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x0B, 0xFF, 0xF4, 0x00, 0x06, 0xAA, 0xA0, 0x3F, 0xFF, 0xE0, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x1F, 0xFD, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00,
-    0x2F, 0x00, 0x00, 0xF8, 0x70, 0x03, 0xEB, 0xC0, 0x1F, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xC0, 0x03, 0xF0, 0x1F, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x30,
-    0xF8, 0x07, 0x82, 0xFF, 0xFC, 0x02, 0xFF, 0x80, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF0, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x87,
-    0x00, 0x3E, 0xBC, 0x01, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x06, 0xFF, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x02, 0xFC,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x1F, 0xFD, 0x00, 0x1F, 0x00,
-    0x0B, 0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02,
-    0xF0, 0x00, 0xF8, 0x70, 0x3E, 0xBC, 0x1F, 0xFC, 0x03, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E,
-    0x00, 0x0B, 0x80, 0x02, 0xFE, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x1B, 0xFE, 0x40, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x7F, 0xF4, 0x01, 0xF0, 0x02, 0xF0,
-    0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x40, 0x2F, 0x00, 0x3E, 0x1C,
-    0x3E, 0xBC, 0x7F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x42, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x01, 0xBF, 0xE4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x7D, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4,
-    0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xC0, 0x00,
-    0xBF, 0xFF, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0,
-    0x06, 0xFD, 0x07, 0xFF, 0x40, 0xFF, 0xD0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x07, 0xC0,
-    0x03, 0xE0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0xFC, 0x00,
-    0x0F, 0x40, 0x0F, 0x80, 0x01, 0xF0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x03,
-    0xE1, 0xC0, 0x3D, 0x00, 0x3E, 0xBC, 0x07, 0xC0, 0x07, 0xFF, 0x00, 0xBC, 0x00, 0x3F, 0x80, 0x0F,
-    0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x80, 0xBC, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x01, 0xF5, 0xF8, 0x00, 0x00, 0x2F, 0x41, 0xF0, 0x00, 0x00, 0xF0, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07,
-    0x42, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0xF0, 0x00, 0x0B, 0x40,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF0, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x60, 0x3D, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xC0, 0x06, 0xFF, 0x90, 0x1F, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00,
-    0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x2F,
-    0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0A, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0xBF, 0x80, 0x2E, 0x3F,
-    0xFD, 0x03, 0xEF, 0x43, 0xD0, 0x3F, 0xC0, 0x3D, 0x07, 0xF0, 0x0B, 0xC0, 0xBC, 0x01, 0xF4, 0x0B,
-    0x81, 0xFD, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x2F, 0x0F, 0x80,
-    0x03, 0xE0, 0xBE, 0x00, 0x3D, 0x03, 0xFC, 0x07, 0xD0, 0x0F, 0xFE, 0xBC, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x2F, 0x8B, 0xFE, 0x03, 0xFF, 0x00, 0xF8, 0x3F, 0xB8, 0x03, 0xD3, 0xE0, 0x00, 0x0F, 0x2D,
-    0x00, 0x00, 0x7D, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3E, 0xF8, 0x00,
-    0x01, 0xF5, 0xF0, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x2F, 0x0B, 0xC0, 0x60, 0xF8, 0x0F, 0xDB, 0x83,
-    0xD0, 0x1F, 0xFC, 0x1F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xF9, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x34, 0x03, 0xE0, 0x00,
-    0x2D, 0x01, 0xF4, 0x00, 0x0F, 0x00, 0xBD, 0x00, 0x5F, 0xC2, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0xF0, 0x0B, 0xFE, 0x07, 0xFE, 0x40, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0F, 0xFD, 0x01, 0xAF, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0,
-    0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07,
-    0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00,
-    0x03, 0xE0, 0x00, 0x3D, 0x28, 0x07, 0xEF, 0x40, 0xBF, 0xE0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x0D, 0x00, 0xF8, 0x00, 0x0B, 0x40, 0x7D, 0x00, 0x03, 0xC0, 0x2F, 0x40, 0x17,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0F,
-    0xFD, 0x01, 0xAF, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00,
-    0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x28, 0x07, 0xEF,
-    0x40, 0xBF, 0xE0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0B, 0xFF, 0xF4, 0xBC, 0x00, 0x6F, 0xF9, 0x0B,
-    0x40, 0x00, 0x7D, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x0D, 0x00, 0x00, 0xFC, 0x00, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x34, 0x00, 0xF8, 0x00, 0x0B, 0x40,
-    0x1F, 0x40, 0x00, 0xF0, 0x02, 0xF4, 0x01, 0x7F, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x03, 0xD0, 0x01, 0x40, 0xF0, 0x3F, 0xF4, 0x7C, 0x1A,
-    0xFD, 0x2D, 0x00, 0x2F, 0x0F, 0x00, 0x0F, 0xC3, 0x40, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x4A, 0x00, 0x07, 0xEF, 0x40, 0x02, 0xFF, 0x80, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x28, 0x00, 0x1F, 0x40, 0x0F, 0xD0,
-    0x02, 0xF0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x34, 0x00,
-    0xF8, 0x00, 0x0B, 0x40, 0x1F, 0x40, 0x00, 0xF0, 0x02, 0xF4, 0x01, 0x7F, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xFD, 0x00, 0x1A, 0xFD, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x14, 0x07, 0xC0, 0xFD, 0x0B, 0xC0, 0xFD, 0x0F, 0xC0, 0xF8,
-    0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D,
-    0x28, 0x00, 0x7E, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x04, 0x00,
-    0x00, 0x1F, 0x5F, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x0A, 0x6F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x0D, 0x00, 0xF8, 0x00, 0x0B, 0x40, 0x7D, 0x00, 0x03, 0xC0, 0x2F, 0x40, 0x17, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x03, 0xFF, 0x40, 0x1A, 0xFD,
-    0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xFA, 0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xDF,
-    0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0xA0, 0x07,
-    0xEF, 0x40, 0x2F, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x3F, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xEF, 0x40, 0x03,
-    0xE0, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x3C, 0x00, 0x00, 0x3E,
-    0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x0F, 0x42, 0xF4, 0x0B, 0xC0, 0x00, 0x03, 0xC0, 0x3E, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xBC, 0x01, 0xF8, 0x3C, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x07, 0xEB, 0x80, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xE0, 0x00,
-    0x01, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xBF, 0xE0, 0x00,
-    0xBF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xE0, 0xBF, 0xF0, 0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4,
-    0x03, 0xDB, 0x81, 0xF4, 0x03, 0xEE, 0x01, 0xF0, 0x07, 0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0,
-    0x0F, 0xE0, 0x03, 0xD0, 0x0F, 0xC0, 0x07, 0xC0, 0x1F, 0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x0F, 0x4A, 0x3E, 0x00, 0x1F, 0xBE, 0x3D, 0x00, 0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF,
-    0xC0, 0x02, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0xF8, 0x00,
-    0x00, 0x7C, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0xF0,
-    0x07, 0xC0, 0x00, 0x03, 0xD0, 0xBD, 0x02, 0xF0, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0xF8, 0x00, 0x00,
-    0x7C, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x7E, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC7,
-    0xC0, 0x00, 0x03, 0xD0, 0x01, 0xFA, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x2F, 0xC0,
-    0x00, 0x7F, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x1F, 0xE0, 0xBF, 0xF0, 0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4, 0x03, 0xDB, 0x81, 0xF4, 0x03, 0xEE,
-    0x01, 0xF0, 0x07, 0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0, 0x0F, 0xE0, 0x03, 0xD0, 0x0F, 0xC0,
-    0x07, 0xC0, 0x1F, 0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0F, 0x4A, 0x3E, 0x00,
-    0x1F, 0xBE, 0x3D, 0x00, 0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x3F, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xEF, 0x40, 0x03,
-    0xE0, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x3C, 0x00, 0x00, 0x3E,
-    0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x0F, 0x42, 0xF4, 0x0B, 0xC0, 0x00, 0x03, 0xC0, 0x3E, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xBC, 0x01, 0xF8, 0x3C, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x07, 0xEB, 0x80, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xE0, 0x00,
-    0x01, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xBF, 0xE0, 0x00,
-    0xBF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x0E, 0x00, 0xF4, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x0B, 0x8F, 0x80,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xE0, 0xBF, 0xF0, 0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4,
-    0x03, 0xDB, 0x81, 0xF4, 0x03, 0xEE, 0x01, 0xF0, 0x07, 0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0,
-    0x0F, 0xE0, 0x03, 0xD0, 0x0F, 0xC0, 0x07, 0xC0, 0x1F, 0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x0F, 0x4A, 0x3E, 0x00, 0x1F, 0xBE, 0x3D, 0x00, 0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2F, 0xE0, 0x1F, 0xF0, 0xF4, 0x2F,
-    0xFC, 0x2F, 0xFD, 0x00, 0x00, 0x2E, 0x2F, 0x6F, 0x40, 0x00, 0x0F, 0xAE, 0x03, 0xD0, 0x00, 0x03,
-    0xEE, 0x01, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x2F,
-    0x80, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x01, 0xF4,
-    0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x3D, 0x2C, 0x00, 0x3E, 0x00, 0x1F, 0xBE, 0x00, 0x0F, 0x40,
-    0x07, 0xFE, 0x00, 0x07, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x3D, 0x00, 0x00,
-    0x2F, 0x2F, 0x40, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0xBD, 0x02,
-    0xF0, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x2F,
-    0x00, 0x3E, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xC7, 0xC0, 0x00, 0x03, 0xD0, 0x01, 0xFA, 0xE0,
-    0x00, 0x00, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x7F, 0x8B, 0xFF, 0x0B,
-    0xFF, 0x40, 0xF8, 0xBD, 0xBD, 0x03, 0xDB, 0x81, 0xF4, 0x0F, 0xB8, 0x07, 0xC0, 0x7F, 0xC0, 0x2F,
-    0x02, 0xFC, 0x00, 0xF8, 0x0F, 0xE0, 0x03, 0xD0, 0x3F, 0x00, 0x1F, 0x01, 0xF8, 0x00, 0xBC, 0x07,
-    0xC0, 0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xD0, 0x02, 0xF0, 0x1F, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x80, 0xBC,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00,
-    0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x90, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xAA, 0xAA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F,
-    0xFF, 0xD0, 0x03, 0xF4, 0x1F, 0xC0, 0x3F, 0x00, 0x2F, 0x41, 0xF4, 0x00, 0x7E, 0x0F, 0xC0, 0x00,
-    0xF8, 0x7D, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE0,
-    0xFC, 0x00, 0x2F, 0x42, 0xF4, 0x01, 0xF8, 0x07, 0xF0, 0x1F, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-    0x80, 0x00, 0x00, 0xF8, 0x0B, 0x40, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8,
-    0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00,
-    0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F,
-    0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x90,
-    0x01, 0xF4, 0x0F, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0x41,
-    0xFC, 0x03, 0xF0, 0x02, 0xF4, 0x1F, 0x40, 0x07, 0xE0, 0xFC, 0x00, 0x0F, 0x87, 0xD0, 0x00, 0x7D,
-    0x2F, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x0F, 0xC0, 0x02, 0xF4, 0x2F,
-    0x40, 0x1F, 0x80, 0x7F, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0xC0, 0x00, 0x00, 0x7F,
-    0x02, 0xF4, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0xFE, 0x03,
-    0xF4, 0x00, 0x00, 0x24, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x3F,
-    0xC0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0x3F,
-    0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x01, 0xF8,
-    0x3F, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x7F, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x07, 0xF0, 0xFC,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x1F, 0xC0,
-    0x0F, 0xC0, 0x0B, 0xD0, 0x1F, 0x40, 0x07, 0xE0, 0x3F, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0,
-    0xBC, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x2F, 0x40,
-    0xBD, 0x00, 0x7E, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0xF8, 0x00, 0x3D, 0x01,
-    0xFD, 0x00, 0x07, 0xD0, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x03, 0x80, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x50, 0x07, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x2F, 0x40,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x80,
-    0x7F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0x00, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x01, 0xFE, 0x00,
-    0x1F, 0x80, 0x17, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x1B, 0xF8, 0x00, 0xFF, 0xFF, 0x4B, 0xEF, 0xE0, 0x3F, 0x41, 0xFF, 0xE0, 0x3F, 0x0F,
-    0xC0, 0x0B, 0xF8, 0x03, 0xE1, 0xF4, 0x00, 0x7F, 0x00, 0x7D, 0x3F, 0x00, 0x03, 0xE0, 0x1F, 0xC7,
-    0xD0, 0x00, 0x7D, 0x0B, 0xE0, 0xBC, 0x00, 0x07, 0xDB, 0xF4, 0x0B, 0xC0, 0x00, 0xBF, 0xF4, 0x00,
-    0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7F, 0xC0, 0x02,
-    0x87, 0xF0, 0x1F, 0xFF, 0x06, 0xF4, 0x3F, 0xFF, 0xE3, 0xFF, 0xFD, 0x00, 0xBF, 0xF4, 0x0F, 0xFE,
-    0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xEB, 0xFC, 0x00, 0x00, 0x7D, 0x02, 0xFC, 0x00, 0x02, 0xF0, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x07,
-    0xC0, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x6F, 0xE0, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x1F, 0xAF, 0xC0, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0x0B, 0xC0,
-    0x02, 0xFC, 0x02, 0xFF, 0xF4, 0x02, 0xFD, 0x2F, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x1F, 0x8B, 0xFF, 0x1F, 0xF0, 0x0B, 0x8F, 0xF8, 0x03, 0xDB, 0x40, 0x00, 0xFB, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xAF, 0xF0, 0x00, 0x01, 0xF4,
-    0x0B, 0xF0, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC,
-    0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x02, 0xF8, 0x00, 0x03,
-    0xF5, 0xBF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7E, 0xBF, 0x00, 0x00, 0x02, 0xF0, 0x7D,
-    0x00, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xF4, 0x00,
-    0x07, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x0B, 0xF0, 0x0B, 0xFF, 0xD0, 0x0B, 0xF4, 0xBF, 0xFF,
-    0x80, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x7E,
-    0x0B, 0xFF, 0x1F, 0xF0, 0x02, 0xE3, 0xFE, 0x00, 0x3D, 0xB4, 0x00, 0x03, 0xEE, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x03, 0x80, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x2F, 0xBD, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xEB, 0xFC, 0x00, 0x00, 0x7D, 0x02,
-    0xFC, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00,
-    0x01, 0xF4, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xBE, 0x00, 0x00, 0xFD,
-    0x6F, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xAF, 0xC0, 0x00, 0x00, 0xBC, 0x1F, 0x40,
-    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x01,
-    0xF4, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x02, 0xFF, 0xF4, 0x02, 0xFD, 0x2F, 0xFF, 0xE0,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x40, 0x0B, 0x40, 0xBC, 0x00, 0xB8,
-    0x2F, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x07, 0xE0, 0xBF, 0xF1, 0xFF, 0x00, 0x2E, 0x3F,
-    0xE0, 0x03, 0xDB, 0x40, 0x00, 0x3E, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x02, 0xFE, 0xBF,
-    0xE0, 0x2F, 0x40, 0x0F, 0x40, 0xF8, 0x00, 0x3C, 0x07, 0xE0, 0x00, 0xF0, 0x1F, 0x80, 0x02, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x90, 0x00, 0x3F, 0x07, 0x80, 0x00,
-    0xBC, 0x2F, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x0F, 0x82, 0xF8, 0x01, 0xFC, 0x07, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0x81, 0xF0, 0x07,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x74, 0x01, 0xF0, 0x2F, 0x80, 0xF8, 0x07,
-    0xFF, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x0F, 0xC0, 0xB8, 0x00, 0xB8, 0x00,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x02, 0xFE, 0xBF, 0xE0,
-    0x2F, 0x40, 0x0F, 0x40, 0xF8, 0x00, 0x3C, 0x07, 0xE0, 0x00, 0xF0, 0x1F, 0x80, 0x02, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x90, 0x00, 0x3F, 0x07, 0x80, 0x00, 0xBC,
-    0x2F, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x0F, 0x82, 0xF8, 0x01, 0xFC, 0x07, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x3E, 0xFC, 0x00, 0x3E, 0x1F, 0x00, 0x2F, 0x02, 0xD0, 0x0E, 0x00, 0x30, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0x81, 0xF0, 0x07, 0xC0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x74, 0x01, 0xF0, 0x2F, 0x80, 0xF8, 0x07, 0xFF,
-    0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF,
-    0x80, 0x0B, 0xFA, 0xFF, 0x80, 0xBD, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0xF0, 0x1F, 0x80, 0x03, 0xC0,
-    0x7E, 0x00, 0x08, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x02, 0x40, 0x00,
-    0xFC, 0x1E, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x3E, 0x0B, 0xE0, 0x07, 0xF0,
-    0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03,
-    0xE0, 0x7C, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x74, 0x01, 0xF0, 0xBE, 0x03, 0xE0,
-    0x7F, 0xFF, 0xC0, 0x1F, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x01, 0x90, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x2D, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0xBF, 0xAF, 0xF8, 0x02, 0xF4, 0x00, 0xF4, 0x03, 0xE0, 0x00, 0xF0, 0x07, 0xE0,
-    0x00, 0xF0, 0x07, 0xE0, 0x00, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xC0, 0x24, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00,
-    0x0F, 0x80, 0xBE, 0x00, 0x7F, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x80, 0x7D, 0x00, 0x7C, 0x0F, 0x40, 0x03, 0xE3, 0xD0,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x3E, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x74, 0x01, 0xF0, 0x0B, 0xE0, 0x3E, 0x00, 0x7F,
-    0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x2F, 0x00, 0x7C, 0x78, 0x03, 0xF0, 0x07,
-    0x8B, 0x40, 0x3E, 0x00, 0x74, 0x70, 0x07, 0xD0, 0x06, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01,
-    0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x06, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00,
-    0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x10, 0x0F, 0x80, 0xB4, 0x0F, 0xD7, 0xF0,
-    0x0F, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x01, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x1D, 0x00, 0x00, 0xF4, 0x0B, 0xD0, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0xF0, 0x07, 0xC7,
-    0x80, 0x3F, 0x00, 0x78, 0xB4, 0x03, 0xE0, 0x07, 0x47, 0x00, 0x7D, 0x00, 0x60, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x02, 0x8B, 0x00,
-    0x02, 0xE3, 0x80, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xBF, 0xFF, 0x43, 0xFF, 0xFF, 0xC0,
-    0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x40, 0x0F, 0x80, 0xB4,
-    0x03, 0xF5, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x2F, 0x00, 0x7C,
-    0x78, 0x03, 0xF0, 0x07, 0x8B, 0x40, 0x3E, 0x00, 0x74, 0x70, 0x07, 0xD0, 0x06, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x06, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00,
-    0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x5B, 0xE5,
-    0x50, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x10, 0x0F, 0x80, 0xB4, 0x0F, 0xD7, 0xF0,
-    0x0F, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x34, 0x00, 0x00, 0x00, 0xFF, 0xDB, 0x80, 0x00, 0x00, 0x1F, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF, 0xE0,
-    0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0,
-    0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C,
-    0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0x80, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x01,
-    0xF8, 0x00, 0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x34, 0x00, 0x0F, 0xFD, 0xF4, 0x00, 0x2E, 0x3F, 0xF0, 0x00, 0x1C, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00,
-    0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03,
-    0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F,
-    0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2,
-    0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0,
-    0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8,
-    0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xC0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0x90, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0,
-    0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00,
-    0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0xF8, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x7D, 0x00,
-    0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80,
-    0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x02, 0xF0,
-    0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x02,
-    0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x18, 0x00, 0x0F,
-    0x40, 0xB4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0,
-    0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00,
-    0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x1D,
-    0x00, 0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x2F, 0xFE, 0x00,
-    0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00,
-    0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0,
-    0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0x80, 0x02, 0xF4,
-    0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x03,
-    0xF4, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xE0, 0x1B, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x07, 0x42, 0xD0, 0x00, 0x0B, 0x42, 0xC0, 0x00,
-    0x07, 0xDB, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03,
-    0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F,
-    0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F,
-    0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x70, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0x40,
-    0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0x00,
-    0x00, 0x02, 0x40, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x2F, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03,
-    0xE0, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00,
-    0x7C, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0x40, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xE0,
-    0x1B, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x1D, 0x00, 0x01, 0xF8, 0x3F,
-    0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x18, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8,
-    0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0,
-    0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80,
-    0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC,
-    0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFC, 0x2F, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0xBC,
-    0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x03,
-    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x00,
-    0x3F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0xE0, 0x1B, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0,
-    0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00,
-    0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x0B, 0xF0, 0x00, 0x40, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0x00, 0x0F,
-    0xFF, 0xD2, 0xFF, 0xE0, 0x01, 0xF0, 0x00, 0xBF, 0xF4, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xF8,
-    0x00, 0x7E, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xE0, 0x00,
-    0x3E, 0x00, 0x1F, 0xF8, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xEF, 0x80, 0x0F, 0x80, 0x00, 0x3F,
-    0x00, 0x7C, 0xF8, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0x8F, 0xC0, 0x2E, 0x00, 0x00, 0x3F, 0x01,
-    0xF0, 0xBC, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x3E, 0x0B, 0xC0, 0xB8, 0x00, 0x00, 0x2F, 0x03, 0xC0,
-    0x7C, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0xB8, 0x07, 0xC2, 0xE0, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x7D,
-    0x3C, 0x00, 0x00, 0x01, 0xF2, 0xE0, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x3D, 0xF4,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x00, 0x00,
-    0x3D, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x00, 0x01, 0xD0, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x7F,
-    0xE0, 0x0B, 0xD0, 0x0B, 0xE0, 0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x02, 0xF4, 0x03, 0xF0, 0x03, 0xE0,
-    0x0F, 0x40, 0x3F, 0x00, 0x3D, 0x00, 0xF8, 0x07, 0xF4, 0x07, 0xC0, 0x0F, 0xC0, 0xBF, 0x40, 0xF8,
-    0x00, 0xBC, 0x0F, 0xF8, 0x0F, 0x00, 0x07, 0xC1, 0xEB, 0x82, 0xE0, 0x00, 0x3C, 0x3C, 0x7C, 0x3C,
-    0x00, 0x03, 0xC7, 0x87, 0xCB, 0x80, 0x00, 0x3D, 0xF0, 0x3D, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x00, 0x00, 0x07, 0x80, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x2F,
-    0xFE, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF8,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x0B,
-    0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFB, 0xC0,
-    0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x02, 0xC0, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0,
-    0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0,
-    0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00,
-    0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00,
-    0x03, 0xF4, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0xFF, 0xFD, 0x2F, 0xFE, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x01, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00,
-    0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xF4,
-    0x00, 0x1F, 0xC0, 0x1E, 0x00, 0x03, 0xF0, 0x02, 0xD0, 0x00, 0xFC, 0x00, 0x08, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00,
-    0x2F, 0x03, 0xF8, 0x05, 0x57, 0xE0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x3C, 0x0F, 0xFF, 0xD7, 0xD0, 0xFA, 0xFF, 0xF8, 0x1D, 0x00,
-    0xBE, 0x00, 0xC0, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x03, 0x07, 0xFF, 0xA5,
-    0xF4, 0xFF, 0xFF, 0xFF, 0x4B, 0x46, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xF4, 0x00, 0x1F, 0xC0, 0x1E, 0x00,
-    0x03, 0xF0, 0x02, 0xD0, 0x00, 0xFC, 0x00, 0x08, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x0B, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x2F, 0x03, 0xF8, 0x05, 0x57,
-    0xE0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x3C, 0x0F, 0xFF, 0xD7, 0xD0, 0xFA,
-    0xFF, 0xF8, 0x1D, 0x00, 0xBE, 0x00, 0xC0, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40,
-    0x03, 0x07, 0xFF, 0xA5, 0xF4, 0xFF, 0xFF, 0xFF, 0x4B, 0x46, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x02, 0x80, 0x07, 0x40, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xF4, 0x00,
-    0x1F, 0xC0, 0x1E, 0x00, 0x03, 0xF0, 0x02, 0xD0, 0x00, 0xFC, 0x00, 0x08, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x2F,
-    0x03, 0xF8, 0x05, 0x57, 0xE0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x80, 0x3D, 0x00, 0x3C, 0x0F, 0x40, 0x03, 0xE3,
-    0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x90, 0x3C, 0x0F, 0xFF, 0xD7, 0xD0, 0xFA, 0xFF, 0xF8, 0x1D, 0x00, 0xBE,
-    0x00, 0xC0, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x03, 0x07, 0xFF, 0xA5, 0xF4,
-    0xFF, 0xFF, 0xFF, 0x4B, 0x46, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xB8, 0x0E, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x20, 0x0F, 0x80,
-    0x00, 0x00, 0xBE, 0x6F, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0xFC, 0x0B, 0xF0, 0x2F, 0x40, 0x7C, 0x01, 0xC0, 0x00, 0x00, 0x40, 0x2E,
-    0x07, 0xE0, 0xF8, 0x3E, 0x0B, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0x80,
-    0x2F, 0xBC, 0x07, 0xC3, 0xE1, 0xF4, 0x1F, 0x2C, 0x00, 0x90, 0x01, 0x00, 0x01, 0xFD, 0x0D, 0x3F,
-    0xF7, 0xD7, 0x8F, 0xFC, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x47, 0xFF, 0xFD, 0x2A, 0xAA,
-    0x80, 0x00, 0x00, 0x03, 0xC0, 0x06, 0x3E, 0x02, 0xD3, 0xFF, 0xF8, 0x0F, 0xFD, 0x00, 0x05, 0x00,
-    0x2D, 0xBF, 0xFE, 0xB8, 0x08, 0x01, 0x87, 0xF0, 0x7E, 0xBE, 0x0F, 0xD7, 0x80, 0x78, 0x00, 0x00,
-    0x07, 0xF8, 0x2F, 0xBE, 0x3C, 0x2E, 0x24, 0x3D, 0x00, 0xF8, 0x07, 0xE0, 0x0B, 0x40, 0x07, 0x00,
-    0x07, 0xE0, 0x1F, 0xFC, 0x3C, 0x2D, 0x78, 0x2D, 0x78, 0x2D, 0x7D, 0xBC, 0x2F, 0xF0, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0x41, 0xE0, 0x7E, 0x0F, 0xC3, 0xF0, 0xFD, 0x3F, 0x0B, 0xD1, 0xF0, 0x7D,
-    0x06, 0x00, 0xC0, 0x00, 0x10, 0x01, 0x0F, 0x00, 0xB8, 0xF4, 0x2E, 0x07, 0xCB, 0xC0, 0x3F, 0xF0,
-    0x01, 0xFC, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x07, 0x47, 0xC3, 0xE0, 0xF8, 0xBC, 0x2F,
-    0x0F, 0x03, 0xC2, 0xD0, 0x70, 0x34, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7F, 0xF0, 0x2F, 0xFF, 0xC7,
-    0x80, 0xBC, 0x90, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x3D, 0x0F, 0x42, 0xF0, 0x3D, 0x07, 0xD0,
-    0x7E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0x00,
-    0xF8, 0x0B, 0x80, 0x14, 0x00, 0x00, 0x00, 0xBC, 0x2F, 0x83, 0xF0, 0x3D, 0x03, 0xD0, 0x2E, 0x00,
-    0xF0, 0x01, 0x00, 0x2C, 0x3E, 0x3D, 0x7C, 0xB8, 0xB0, 0xA0, 0x00, 0x00, 0x00, 0xBD, 0x0B, 0xD0,
-    0xFC, 0x2F, 0x03, 0xC0, 0x10, 0x00, 0x04, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E,
-    0xBF, 0x0F, 0xE7, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0F, 0xF4, 0x2C, 0x3C, 0x3C, 0x2C,
-    0x3C, 0x38, 0x1F, 0xF0, 0x06, 0x40, 0x01, 0x00, 0xFC, 0x0F, 0xC0, 0xF8, 0x1F, 0x03, 0xC0, 0x50,
-    0x00, 0x06, 0x41, 0xFE, 0x02, 0xF0, 0x3D, 0x0B, 0xC7, 0xE0, 0x64, 0x00, 0x01, 0x00, 0xE0, 0x3C,
-    0x07, 0x40, 0xF4, 0x0B, 0xF9, 0x3F, 0x80, 0x00, 0x05, 0x03, 0xD0, 0xF0, 0x7C, 0x2E, 0x0F, 0x82,
-    0x80, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0x00, 0x2F, 0xBE, 0x02, 0xF4, 0xBC, 0x2F, 0x00, 0xF4, 0x50,
-    0x00, 0x40, 0x00, 0x00, 0x03, 0x40, 0x08, 0xBC, 0x03, 0xC7, 0xFF, 0xF4, 0x2F, 0xFD, 0x00, 0x15,
-    0x00, 0x06, 0x80, 0x82, 0xFE, 0x1D, 0x7E, 0xFB, 0xD7, 0x4B, 0xF8, 0x10, 0x19, 0x00, 0x3F, 0xFF,
-    0xC7, 0xFF, 0xFC, 0x05, 0x55, 0x40, 0x00, 0x10, 0x00, 0x7F, 0xF0, 0x2F, 0xFF, 0xC7, 0x80, 0xBC,
-    0x90, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xF0,
-    0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x40, 0x64, 0x7F, 0x07, 0xF2, 0xFC, 0x2F,
-    0xC3, 0x80, 0x78, 0x00, 0x3D, 0x03, 0xC0, 0x7C, 0x07, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x1F,
-    0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x01, 0xF4,
-    0x00, 0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0xBF, 0x00,
-    0x00, 0x1F, 0x41, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x40, 0x07,
-    0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x00, 0x34, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x04, 0x00, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x18, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x7D,
-    0x00, 0x07, 0xC0, 0x02, 0xF4, 0x01, 0x7E, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xC0, 0x3F, 0x00, 0x7C, 0x78, 0x03, 0xE0, 0x07, 0x8B, 0x40, 0x7D, 0x00, 0x74, 0x10, 0x0B, 0xC0,
-    0x05, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0xAE, 0x40, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0xAB, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x03, 0xE0, 0x00,
-    0x7E, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x07, 0xD1, 0xBF, 0xF4, 0x00, 0xBC, 0x3F, 0xFF, 0x80, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x50, 0x0F, 0xC0, 0x00, 0x0F,
-    0xAB, 0xF4, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x2F,
-    0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x02, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0x00, 0x00,
-    0xF8, 0x00, 0x14, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xF4, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x00, 0xB8, 0x0F, 0xC0, 0x00, 0x0B,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x55, 0x40, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x2D, 0x03, 0xFC, 0x00,
-    0x0B, 0xE0, 0x1F, 0xF4, 0x07, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFA, 0xFF, 0x80,
-    0xBD, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0xF0, 0x1F, 0x80, 0x03, 0xC0, 0x7E, 0x00, 0x08, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x02, 0x40, 0x00, 0xFC, 0x1E, 0x00, 0x02, 0xF0,
-    0xBC, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x3E, 0x0B, 0xE0, 0x07, 0xF0, 0x1F, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x06, 0xFF,
-    0x90, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x50,
-    0x00, 0xFC, 0x0F, 0xC0, 0x07, 0xF0, 0x7F, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xD0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x01, 0xD0, 0xBD, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xEA, 0x90, 0x00, 0x00, 0x0B, 0x80, 0x2F, 0xFF, 0xF8, 0x00,
-    0x00, 0x3D, 0x00, 0xFD, 0x5B, 0xFC, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xF4, 0x00, 0x0F, 0x40,
-    0x1F, 0x40, 0x07, 0xE0, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x02, 0xF0, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x41, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0xC3, 0xEF,
-    0x80, 0x01, 0xF4, 0x02, 0xFC, 0x1F, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0x80, 0x07, 0xFF,
-    0xFF, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFC, 0x0B, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x55, 0x57, 0xFA, 0x50, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xEA, 0xAA, 0xFE, 0x5B, 0xFC, 0x00, 0x7E, 0x00, 0x02, 0xF0,
-    0x02, 0xF8, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x07, 0xD0, 0x00,
-    0x2F, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x01, 0xFD, 0x0B, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0x00, 0xFC,
-    0x01, 0xF0, 0x78, 0x03, 0xE0, 0x07, 0x82, 0xD0, 0x1F, 0x40, 0x1D, 0x01, 0x00, 0xBC, 0x00, 0x50,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x6F, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xF9, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00,
-    0x1F, 0x80, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x06, 0xFF, 0xD0, 0x2F, 0xFD, 0x3F, 0xFF,
-    0x42, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00,
-    0xBF, 0xFF, 0x00, 0x7F, 0xC0, 0x06, 0xFF, 0x90, 0x1F, 0xFC, 0x00, 0x07, 0xD0, 0x07, 0xE6, 0x80,
-    0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0x80, 0x00,
-    0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0x5F, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0xFC, 0x00,
-    0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x00, 0x03,
-    0xF4, 0x00, 0x2F, 0xFF, 0x80, 0x2F, 0xD0, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x0B,
-    0xFF, 0x80, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x3D, 0xFC,
-    0x00, 0x00, 0x7D, 0x00, 0x3D, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x3D, 0x1F, 0x80, 0x00, 0x0F, 0xC0,
-    0x3D, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x7C, 0x02, 0xF0, 0x00, 0x01, 0xF4, 0x7C, 0x00, 0xFC, 0x00,
-    0x00, 0xBD, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xFC, 0x00,
-    0x0B, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xFF, 0xF0, 0x01, 0xBF, 0xF8, 0x02, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0A, 0x00, 0x00, 0x0B, 0x80, 0x0E,
-    0x00, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0x0F, 0xE6, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0xBF, 0xFE, 0x2F, 0xFD, 0x00, 0x6F, 0xF8, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x01,
-    0xF0, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0x00, 0x7D, 0x0F, 0x00,
-    0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10,
-    0x3D, 0x00, 0x00, 0x00, 0xB9, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x01, 0xFF, 0xFD, 0x00, 0x6F, 0xF9, 0x01, 0xBF, 0xE4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4,
-    0x00, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07,
-    0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA,
-    0xAA, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40,
-    0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7D, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x3C, 0x00,
-    0x0F, 0xC0, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xFA, 0xA4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xF5, 0x5F, 0xF0, 0x00, 0x7D, 0x00, 0x2F, 0x80, 0x0B,
-    0xD0, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x0F,
-    0x80, 0x1F, 0x40, 0x03, 0xF0, 0x02, 0xF4, 0x01, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xEA, 0xFF, 0x40, 0x00, 0x7D, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x7D, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x2F, 0x00,
-    0x02, 0xFA, 0xAF, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x03, 0xE5, 0x6F, 0xF0, 0x00, 0x7D, 0x00,
-    0x2F, 0x80, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0xF8, 0x00, 0x1F, 0x80, 0x1F, 0x40, 0x03, 0xF0, 0x02, 0xF0, 0x01, 0xFD, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x2C, 0x00, 0x03, 0xE0, 0x00, 0x50,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE4,
-    0x00, 0x00, 0x03, 0xC0, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x78, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x02,
-    0xF0, 0x00, 0x00, 0x07, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x2E,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
-    0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0x40, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x40, 0x00,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x80, 0x00, 0xF8, 0x00, 0x0F,
-    0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x17, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x01, 0xFF, 0x00, 0x3F,
-    0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xFE, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0x00, 0x09, 0xBD, 0x00, 0x3D,
-    0x00, 0x7E, 0x68, 0x00, 0x00, 0xB8, 0x01, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0xC0,
-    0x3D, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF8, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x43, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0x5F, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD7, 0xF6, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x7D, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xC0, 0x2F, 0x40, 0x00,
-    0x00, 0x7F, 0x40, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xF4, 0x00, 0xBE, 0x00, 0x00,
-    0x7F, 0x80, 0x07, 0xC0, 0x00, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xF0, 0x02, 0xFD, 0x00, 0x7F,
-    0x80, 0x0F, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0xBC, 0x00, 0xFC, 0x03, 0xD0,
-    0x02, 0xF4, 0x0F, 0x00, 0x07, 0xD0, 0x18, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x15, 0xFD, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0A, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x05, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x0B, 0xD3, 0xF0,
-    0x00, 0x7F, 0x0B, 0xF0, 0x0B, 0xF0, 0x0F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x06,
-    0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0B,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3E,
-    0x00, 0x0F, 0x7F, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0x4F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0x47, 0xE0,
-    0x00, 0x03, 0xF0, 0x0F, 0x41, 0xF4, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x1F,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0x5F, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xEF, 0x00, 0x07, 0xD0, 0x00,
-    0x03, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xFE, 0x00, 0xBF,
-    0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x01, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x0B, 0xF5, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x7F, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0x4F, 0x80,
-    0x00, 0x0B, 0xC0, 0x0F, 0x47, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x41, 0xF4, 0x00, 0x00, 0xF8, 0x1F,
-    0x00, 0xBC, 0x00, 0x00, 0x7D, 0x1F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x5F, 0x00, 0x0F, 0x80, 0x00,
-    0x0B, 0xEF, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF,
-    0xFC, 0x00, 0x6F, 0xFE, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x0B, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x6F, 0xF9, 0x01, 0xFF, 0xC0, 0x00, 0x7D, 0x00,
-    0x7E, 0x68, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0,
-    0xB8, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xC0, 0x00, 0x00, 0x02, 0xF5,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0x00, 0x7D,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0xE0, 0x00, 0x02,
-    0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0xBF, 0xFF, 0xC0, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40,
-    0x7D, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0x80, 0x3F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0x40, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x02, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x41, 0xF4, 0x00, 0x3E, 0x00, 0x03, 0xEF, 0x80, 0x01,
-    0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xFD, 0x00, 0x3F, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x2F, 0xFE, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFB, 0xC0, 0x00, 0x01, 0xFB, 0xC0, 0x02, 0xEB, 0xC0, 0x00, 0x02,
-    0xE7, 0xD0, 0x07, 0xCB, 0xC0, 0x00, 0x03, 0xD3, 0xD0, 0x0F, 0x4F, 0xC0, 0x00, 0x07, 0xC3, 0xE0,
-    0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xC3, 0xE0, 0x3D, 0x0F, 0x80, 0x00, 0x0F, 0x42, 0xF0, 0x78, 0x0F,
-    0x80, 0x00, 0x0F, 0x02, 0xF0, 0xF0, 0x0F, 0x80, 0x00, 0x2F, 0x01, 0xF2, 0xE0, 0x0F, 0x80, 0x00,
-    0x3E, 0x00, 0xF7, 0xC0, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0xFF, 0x40, 0x1F, 0x40, 0x00, 0x7C, 0x00,
-    0xFF, 0x00, 0x1F, 0x40, 0x00, 0xB8, 0x00, 0xBD, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x78, 0x00,
-    0x2F, 0x00, 0x01, 0xF0, 0x00, 0x10, 0x00, 0x2F, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00,
-    0x0B, 0xD5, 0x55, 0x5B, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0xAA, 0xAA,
-    0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B,
-    0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0xFC,
-    0x00, 0x6F, 0xFE, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02,
-    0xF8, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02,
-    0xF4, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80,
-    0x3F, 0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x1F,
-    0x80, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xF4, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFD,
-    0x00, 0xBF, 0xFF, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFA, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x00, 0xFC,
-    0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0F, 0xC0,
-    0x02, 0xF0, 0x02, 0xF4, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE,
-    0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x00,
-    0xB8, 0x0F, 0xC0, 0x00, 0x0B, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x04, 0x03, 0xFC, 0x00, 0x02, 0xD0, 0x1F, 0xF9, 0x56, 0xFC, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x2F, 0x00, 0x7C, 0x78, 0x03, 0xF0, 0x07, 0x8B,
-    0x40, 0x3E, 0x00, 0x74, 0x70, 0x07, 0xD0, 0x06, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xBF,
-    0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0xBF, 0xFE, 0x2F, 0xFD, 0x00, 0x6F, 0xF8, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x1F,
-    0x00, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00,
-    0x00, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0x00, 0x7D, 0x0F, 0x00, 0x00, 0x00,
-    0x3E, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x3D, 0x00,
-    0x00, 0x00, 0xB9, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x2F, 0xEB, 0xFA, 0xFF, 0x00, 0x3F, 0x80, 0xF8, 0x0B, 0xE0, 0x2F, 0x40, 0x3D, 0x00, 0xFC,
-    0x1F, 0x80, 0x1F, 0x40, 0x2F, 0x0B, 0xC0, 0x07, 0xC0, 0x0B, 0xC3, 0xF0, 0x02, 0xF0, 0x02, 0xF0,
-    0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x3F, 0x00, 0x3D, 0x00, 0x3E, 0x0F, 0xC0, 0x1F, 0x00, 0x3F, 0x02,
-    0xF8, 0x07, 0xC0, 0x3F, 0x40, 0x3F, 0xD2, 0xF1, 0xBF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x06, 0xBF, 0x94, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x1F, 0xFE, 0x40, 0x6F, 0xF4, 0x00, 0x01, 0xF8, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1B, 0xFF, 0x40, 0x1F,
-    0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x01, 0xFF, 0xFD, 0x00, 0x6F, 0xF9, 0x01, 0xBF, 0xE4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4,
-    0x00, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x81, 0xFF, 0xFC, 0x2F, 0xFD, 0x01, 0xBF, 0xE4, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0,
-    0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00,
-    0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x07, 0xF4, 0x06, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFA, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x3F, 0xFE,
-    0x0F, 0xFF, 0xD0, 0x06, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xF9, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00,
-    0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3E,
-    0x00, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x00,
-    0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x40, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xF8, 0x3F, 0xFE, 0x0F, 0xFF, 0xD0, 0x06, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xF9, 0x00, 0x01, 0xF4,
-    0x00, 0x7D, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00,
-    0xF4, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x2F,
-    0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xE0,
-    0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x7C, 0x00,
-    0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D,
-    0x00, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x78, 0x03, 0xE0, 0x00, 0x0B, 0x40,
-    0x7D, 0x00, 0x00, 0x70, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xFE, 0xA5, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xF5, 0x5B, 0xF4, 0x00, 0x3F,
-    0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x00, 0xFC,
-    0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0xFC, 0x01, 0xFE, 0x01, 0xBF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xC0, 0x06, 0xFF, 0x90, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xEA, 0x90,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x00, 0xFD, 0x5B, 0xF8, 0x02,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x3F, 0x00,
-    0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x07, 0xD0, 0x00, 0x00,
-    0xF8, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x2F, 0x40,
-    0x2F, 0xC0, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x81, 0xBF, 0xF8, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x0B, 0xEA, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x57, 0xFC, 0x00, 0x7D,
-    0x00, 0x2F, 0x80, 0x2F, 0x40, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0xF8, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x1F, 0xD0, 0xBF, 0xFF, 0xFF, 0xD0,
-    0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x0B, 0xC0, 0x07, 0xF4, 0x02, 0xE0, 0x00, 0x7F, 0x00, 0xF0,
-    0x00, 0x0F, 0xD0, 0x2C, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xEA, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x50, 0x00, 0x03, 0xF0, 0x78, 0x00, 0x03,
-    0xF4, 0x3F, 0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x0B, 0xF8, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x06, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0x90, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x40,
-    0x0F, 0xE0, 0x07, 0xF8, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x07, 0xD0,
-    0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD5, 0x7E, 0x00, 0x00, 0x03, 0xF0,
-    0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xF8, 0x00, 0xFE, 0xAF, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x7D,
-    0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x2F,
-    0x40, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x00,
-    0x01, 0xF8, 0x00, 0x7D, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x2F, 0x00, 0x07, 0xF8, 0x02, 0xFC,
-    0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xF4, 0x0B, 0xC0, 0x00, 0x07, 0xF0, 0x02,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x02, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0xAF, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0xC0,
-    0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x3D, 0x00,
-    0x00, 0x2F, 0x80, 0x1F, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xC0, 0x01, 0xFF, 0xC0, 0x2F, 0xFE, 0x00,
-    0x3F, 0x80, 0x2F, 0xFF, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F,
-    0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC,
-    0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE,
-    0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x0F, 0xF9, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0B, 0x8B, 0xFE, 0x00, 0x0F, 0xBF, 0xFF, 0x80, 0x1F, 0xF4, 0x1F, 0xC0, 0x3F,
-    0xC0, 0x0B, 0xD0, 0x3F, 0x40, 0x07, 0xD0, 0x7F, 0x00, 0x07, 0xD0, 0x7D, 0x00, 0x07, 0xD0, 0x7C,
-    0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x1F, 0x40, 0x7D, 0x00, 0x3F, 0x00, 0x3F,
-    0x01, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x0B, 0xFB, 0xF4, 0x0B, 0xC0, 0x3E, 0x0B, 0xC0, 0x0F, 0x83,
-    0xC0, 0x07, 0xC2, 0xE0, 0x07, 0xD0, 0xF4, 0x6F, 0xD0, 0x7F, 0xFF, 0xFD, 0x2F, 0x40, 0x0F, 0xCF,
-    0xC0, 0x01, 0xF3, 0xF0, 0x00, 0xBC, 0xBC, 0x00, 0x3E, 0x1F, 0x80, 0x3F, 0x03, 0xFE, 0xFF, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0xFC,
-    0x0F, 0x80, 0xBE, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xE0, 0x00,
-    0xBE, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x04, 0x3F, 0x00, 0x1C, 0x3F, 0x40,
-    0xBC, 0x2F, 0xFF, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xFF,
-    0x80, 0x03, 0xFA, 0xFF, 0x00, 0x34, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE7, 0xF0, 0x0B, 0xFF, 0xFF, 0x03, 0xF4, 0x1F,
-    0xE0, 0xFC, 0x00, 0x3E, 0x1F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3D, 0x7D, 0x00, 0x07, 0xCB, 0xC0,
-    0x00, 0xBC, 0xBC, 0x00, 0x0F, 0x8F, 0xC0, 0x01, 0xF0, 0xFC, 0x00, 0x3E, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x7F, 0x02, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E, 0x1F, 0x00, 0x7D,
-    0x3E, 0x01, 0xF8, 0x3D, 0x0B, 0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xBC, 0x00, 0x28, 0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x02, 0xD0, 0x02, 0xFC, 0x03, 0xFF,
-    0xC0, 0x3C, 0x00, 0xFF, 0xD0, 0xB9, 0xBD, 0x07, 0xC0, 0x3E, 0x6C, 0x0E, 0x03, 0xE0, 0xF8, 0x0F,
-    0x40, 0x00, 0x00, 0x2E, 0x3F, 0x42, 0xD0, 0x00, 0x00, 0x01, 0xE7, 0xF0, 0x7C, 0x00, 0x00, 0x00,
-    0x2E, 0xDF, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF9, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x2E, 0xEF,
-    0x00, 0x00, 0x00, 0x07, 0xC3, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x0F, 0x00, 0x00, 0x00,
-    0x2D, 0x03, 0xD0, 0xF4, 0x07, 0x06, 0x5B, 0x80, 0x7C, 0x0F, 0xC2, 0xF0, 0xFF, 0xE0, 0x0B, 0x40,
-    0xBF, 0xFC, 0x0B, 0xF4, 0x00, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0xFD, 0x0B, 0x80, 0x3F, 0x09, 0x00, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x2B, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x7D, 0x10, 0x00, 0x7D, 0xB4, 0x00, 0xBC, 0xFC, 0x02, 0xF8, 0xBF, 0xFF, 0xE0, 0x2F, 0xFF, 0x40,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02,
-    0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B,
-    0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F,
-    0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F,
-    0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x0B, 0x00, 0x2C, 0x00, 0x1F, 0x00, 0x78, 0x00, 0x2F, 0x41, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF,
-    0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03,
-    0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F,
-    0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F,
-    0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x1F, 0xCB, 0xFE, 0x01, 0xFF, 0x40, 0xF8, 0x1F, 0xAC, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x0F,
-    0x00, 0x00, 0x7C, 0xF0, 0x00, 0x02, 0xEB, 0x40, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x3F, 0xBC, 0x00,
-    0x01, 0xF4, 0xF4, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x2F, 0x03, 0xE0, 0x60, 0xF8, 0x0F, 0xDB, 0x83,
-    0xD0, 0x0F, 0xFC, 0x1F, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0xF0,
-    0x3F, 0x00, 0x00, 0x2D, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x78, 0x07, 0xC0, 0x00,
-    0x0B, 0x40, 0xBC, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x1F,
-    0x00, 0x00, 0x7C, 0x02, 0xF0, 0xD3, 0xEF, 0x80, 0x2F, 0x7C, 0x3F, 0xF0, 0x03, 0xFF, 0x43, 0xFC,
-    0x00, 0x2F, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x03, 0xF4, 0x02, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x0E,
-    0xF4, 0x03, 0xAD, 0x00, 0x01, 0xDB, 0x80, 0xF3, 0xD0, 0x00, 0x2C, 0x7C, 0x1E, 0x3C, 0x00, 0x02,
-    0xC3, 0xC3, 0xC7, 0xC0, 0x00, 0x3C, 0x3C, 0x74, 0xB8, 0x00, 0x03, 0x83, 0xCF, 0x0B, 0x80, 0x00,
-    0x74, 0x3E, 0xD0, 0xF4, 0x00, 0x0F, 0x03, 0xFC, 0x0F, 0x00, 0x00, 0xE0, 0x3F, 0x40, 0xF0, 0xAA,
-    0x7D, 0x03, 0xF0, 0x0F, 0xBD, 0xFF, 0xC0, 0x3D, 0x00, 0xFF, 0x8B, 0xF0, 0x01, 0x40, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xB4, 0xBF, 0xF0,
-    0x00, 0xF8, 0x02, 0xF0, 0x00, 0xF4, 0x03, 0xE0, 0x01, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07, 0xC0,
-    0x03, 0xE0, 0x0B, 0xD5, 0x57, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x5B, 0xC0, 0x0F, 0x40,
-    0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0F, 0x4B, 0x3E, 0x00, 0x1F, 0xBE, 0x3D, 0x00,
-    0x1F, 0xF8, 0x7C, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4, 0x00, 0x7E, 0x3F,
-    0x00, 0x03, 0xE7, 0xD0, 0x00, 0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC, 0xFC, 0x00, 0x0F,
-    0x8F, 0xC0, 0x02, 0xF4, 0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xE0, 0xBF, 0xF0,
-    0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4, 0x03, 0xDB, 0x81, 0xF4, 0x03, 0xEE, 0x01, 0xF0, 0x07, 0xFC,
-    0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0, 0x0F, 0xE0, 0x03, 0xD0, 0x0F, 0xC0, 0x07, 0xC0, 0x1F, 0x80,
-    0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0F, 0x4A, 0x3E, 0x00, 0x1F, 0xBE, 0x3D, 0x00,
-    0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x0B, 0xF0, 0x02, 0xFF, 0x87, 0xFF, 0xC0, 0x00, 0xF8, 0xF5, 0xFC, 0x00, 0x0F, 0x7C, 0x0B,
-    0xD0, 0x00, 0xFF, 0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x07, 0xD0, 0x02, 0xFC, 0x00, 0x7C, 0x00, 0x2F,
-    0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0xF0,
-    0x00, 0xBC, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xBF,
-    0xF4, 0x00, 0x02, 0xF0, 0x10, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x6A, 0xAA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF5, 0x7C, 0x0B, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x34, 0x7F, 0x46, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F,
-    0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xD0, 0x0B,
-    0xE0, 0xBF, 0xF0, 0xBF, 0xF0, 0x7F, 0xF4, 0x03, 0xE2, 0xF7, 0xF1, 0xF6, 0xF4, 0x03, 0xDB, 0x82,
-    0xE7, 0xC1, 0xF4, 0x03, 0xEE, 0x02, 0xEF, 0x01, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x02, 0xF0, 0x0B,
-    0xF0, 0x03, 0xF4, 0x03, 0xE0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xD0, 0x07,
-    0xC0, 0x1F, 0x80, 0x0F, 0xC0, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x2F, 0x00, 0x1F,
-    0x00, 0x0F, 0x4A, 0x3E, 0x00, 0x2F, 0x00, 0x1F, 0x7E, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0xF8, 0x7C,
-    0x00, 0x3D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03, 0xE0,
-    0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00,
-    0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B, 0x87,
-    0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFB,
-    0xF0, 0x00, 0x00, 0xB8, 0x0D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x03, 0xF9, 0x7C, 0x6F, 0xC0, 0xFC, 0x0B, 0xC0, 0xBD, 0x2F, 0x00, 0xB8, 0x03, 0xE3, 0xE0, 0x0F,
-    0x40, 0x3F, 0x7C, 0x00, 0xF4, 0x03, 0xFB, 0xC0, 0x0F, 0x00, 0x3E, 0xFC, 0x01, 0xF0, 0x03, 0xDF,
-    0xC0, 0x1F, 0x00, 0x7C, 0xBC, 0x02, 0xE0, 0x0F, 0x87, 0xE0, 0x3E, 0x03, 0xF0, 0x3F, 0x83, 0xD2,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x07, 0x87, 0xD0, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x01, 0xFC, 0x07, 0xFF, 0x00, 0x7F, 0xC0, 0x65, 0xF8, 0x1F, 0x98, 0x00, 0x0F, 0xC3, 0xD0,
-    0x00, 0x00, 0x7D, 0xB8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xF3, 0xF0, 0x00,
-    0x00, 0x3C, 0x2F, 0x00, 0x02, 0x5F, 0x41, 0xF9, 0x60, 0x3F, 0xE0, 0x0F, 0xFF, 0x03, 0xF8, 0x00,
-    0x7F, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0x0B,
-    0xFF, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x07, 0xD0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xBC,
-    0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x0B, 0xC0, 0x03, 0xD0, 0x03,
-    0xF0, 0x01, 0xF0, 0x02, 0xF8, 0x00, 0xBC, 0x01, 0xFD, 0x00, 0x2F, 0x01, 0xEB, 0x4F, 0x0F, 0xD2,
-    0xF3, 0xEF, 0x42, 0xFF, 0xF0, 0xFF, 0xC0, 0x3F, 0xE0, 0x2E, 0xB0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0xB0, 0xFF, 0xE0, 0x03,
-    0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F,
-    0xC0, 0x0B, 0xC0, 0x2F, 0x80, 0x07, 0xF6, 0xFF, 0x40, 0x03, 0xFF, 0xDF, 0x40, 0x00, 0x54, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x1C, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x07, 0xC0, 0x0B, 0x8B, 0xFF, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0xF8, 0x02, 0xF0,
-    0x03, 0xF0, 0x07, 0xD0, 0x0F, 0xC0, 0x0F, 0x80, 0x2F, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0xB8, 0x00,
-    0xF4, 0x02, 0xF0, 0x03, 0xD0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0xFC,
-    0x00, 0xF8, 0x01, 0xF0, 0x07, 0xE0, 0x0F, 0xD0, 0x0B, 0xC0, 0x3F, 0x40, 0x7F, 0x00, 0x3F, 0x03,
-    0xFD, 0x07, 0x7C, 0x24, 0xFC, 0x7C, 0xF8, 0x78, 0xF7, 0xD2, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07,
-    0xFC, 0x07, 0xF8, 0x0F, 0xD0, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x07, 0xC0, 0x0B, 0x8B, 0xFF, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0xF8,
-    0x02, 0xF0, 0x03, 0xF0, 0x07, 0xD0, 0x0F, 0xC0, 0x0F, 0x80, 0x2F, 0x00, 0x3E, 0x00, 0x3D, 0x00,
-    0xB8, 0x00, 0xF4, 0x02, 0xF0, 0x03, 0xD0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3F, 0x00, 0x3D,
-    0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF0, 0x07, 0xE0, 0x0F, 0xD0, 0x0B, 0xC0, 0x3F, 0x40, 0x7F, 0x00,
-    0x3F, 0x03, 0xFD, 0x07, 0x7C, 0x38, 0xFC, 0x7C, 0xF8, 0x78, 0xF7, 0xC2, 0xFF, 0xD3, 0xFF, 0xC3,
-    0xFF, 0x07, 0xFC, 0x07, 0xF8, 0x0F, 0x7C, 0x01, 0x00, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0x0F, 0x40, 0x0F, 0x80, 0xF0, 0x03, 0xD0, 0x0B, 0x40, 0xF0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x01, 0xFA, 0xBF, 0xC0, 0x3D, 0x00, 0xBC, 0x03, 0xC0, 0x07,
-    0xD0, 0x7C, 0x00, 0x7C, 0x07, 0xC0, 0x0B, 0xC0, 0x3D, 0x01, 0xF4, 0x03, 0xFA, 0xFD, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xB4,
-    0xFF, 0xE0, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x0B,
-    0xC0, 0x00, 0x03, 0xF0, 0x0F, 0x85, 0x40, 0x03, 0xE0, 0x0F, 0xFF, 0xF4, 0x03, 0xD0, 0x1F, 0xE6,
-    0xFD, 0x07, 0xC0, 0x2F, 0x00, 0x7E, 0x0B, 0xC0, 0x2E, 0x00, 0x3E, 0x0F, 0x80, 0x3D, 0x00, 0x3D,
-    0x0F, 0x40, 0x3E, 0x00, 0x7C, 0x1F, 0x4A, 0x3F, 0x01, 0xF8, 0x1F, 0x7D, 0x1F, 0xEB, 0xE0, 0x2F,
-    0xF8, 0x0B, 0xFF, 0x40, 0x1F, 0xD0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D,
-    0x15, 0x00, 0x1F, 0xFF, 0xF8, 0x07, 0xF9, 0xBF, 0x42, 0xE0, 0x03, 0xE0, 0xF4, 0x00, 0xF8, 0x3D,
-    0x00, 0x3E, 0x0F, 0x40, 0x0F, 0x43, 0xE0, 0x0F, 0x80, 0xBF, 0xAF, 0xC0, 0x0B, 0xFF, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0x41, 0xFC,
-    0x0E, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x55, 0x7E, 0x00, 0xBF, 0xFF,
-    0x80, 0x05, 0x57, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x78, 0x00, 0x7D, 0x2F, 0x00, 0x7E,
-    0x07, 0xFE, 0xFE, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x0B, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x0F, 0xC0, 0x2F, 0x81, 0xFC,
-    0x03, 0xE0, 0x2F, 0x40, 0x2F, 0x40, 0xF4, 0x0F, 0x80, 0x07, 0xD0, 0x7C, 0x0B, 0xC0, 0x00, 0xF4,
-    0x2F, 0x57, 0xE0, 0x00, 0x3D, 0x0F, 0xFF, 0xF4, 0x00, 0x1F, 0x43, 0xE5, 0xFC, 0x00, 0x0B, 0xC1,
-    0xF4, 0x2F, 0x00, 0x03, 0xE0, 0x7C, 0x0B, 0xC0, 0x02, 0xF0, 0x2F, 0x01, 0xF4, 0x01, 0xF8, 0x0F,
-    0x80, 0x3F, 0x01, 0xF8, 0x03, 0xD0, 0x0B, 0xFF, 0xF8, 0x01, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0x40,
-    0xF8, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0xF0, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0xBE, 0x02,
-    0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0B, 0xEB, 0xC0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x2F, 0x0B,
-    0xC0, 0x00, 0x7C, 0x0F, 0x8A, 0x35, 0xF8, 0x0F, 0xBE, 0x3F, 0xF0, 0x0F, 0xF8, 0x3F, 0x80, 0x0F,
-    0xD0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E, 0x1F, 0x00, 0x7D, 0x3E,
-    0x01, 0xF8, 0x3D, 0x0B, 0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xBC, 0x00, 0x28, 0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x14, 0x01, 0x40, 0x0B, 0xD0, 0xFC, 0x00, 0xFD, 0x1F, 0xC0, 0x0B, 0x40, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBE, 0xFD, 0x00,
-    0x3E, 0x03, 0xE0, 0x0B, 0x80, 0x3E, 0x01, 0xF0, 0x07, 0xD0, 0x3E, 0x01, 0xF8, 0x03, 0xD0, 0xBE,
-    0x00, 0x7D, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x28, 0x07, 0xE0, 0x6F, 0x40, 0x3F, 0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x3E, 0x05, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0x6B, 0xEA, 0xA4, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x03, 0xD0, 0x6F, 0x00, 0x1F, 0x0B, 0xFF, 0x00, 0x7C, 0xFE, 0xFD, 0x02, 0xEB,
-    0x81, 0xF4, 0x0F, 0xF4, 0x07, 0xE0, 0x3F, 0x80, 0x0F, 0x81, 0xFC, 0x00, 0x7D, 0x0B, 0xD0, 0x01,
-    0xF4, 0x3F, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0xFC, 0x2F, 0x00, 0x03, 0xE0,
-    0xBC, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x10, 0x0F, 0x80, 0x01, 0xF5, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x06, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x3E, 0x02, 0xF8, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x2F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x10, 0x3E, 0x00, 0x2C, 0x0F, 0xD0, 0x2F, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xFF, 0x03, 0xF5, 0x6E,
-    0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0xAA, 0xC0, 0x7F, 0xFF, 0xC0, 0xBC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x2C, 0x7F, 0x42, 0xF8, 0x3F, 0xFF,
-    0xD0, 0x0F, 0xFE, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC,
-    0x03, 0xE0, 0x7C, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x74, 0x01, 0xF0, 0xBE, 0x03,
-    0xE0, 0x7F, 0xFF, 0xC0, 0x1F, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07,
-    0xF0, 0x02, 0xFC, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x1F, 0xFD,
-    0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80,
-    0x07, 0xD0, 0x02, 0xF0, 0x00, 0xF8, 0x70, 0x3E, 0xBC, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x10, 0x3F, 0x03, 0xF1, 0xFC, 0x2F, 0x83, 0xC0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8,
-    0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC,
-    0x00, 0x03, 0xE1, 0xC0, 0x0F, 0xAF, 0x00, 0x7F, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xAF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F,
-    0x00, 0x01, 0x80, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x6E, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x2D, 0x03,
-    0xC0, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x78, 0x0B, 0xEF, 0xE0, 0x00, 0x0B, 0x40,
-    0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x0F, 0x40, 0xBD, 0x00, 0x1F, 0x01, 0xF0, 0x03, 0xD0, 0x03, 0xD0,
-    0x1F, 0x00, 0x3D, 0x00, 0x7C, 0x02, 0xF0, 0x07, 0xC3, 0xEF, 0x80, 0x1F, 0x40, 0xF8, 0x3F, 0xF0,
-    0x00, 0xFE, 0xBF, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0x00, 0x0B, 0xFF, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x01,
-    0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0xF4, 0x00,
-    0x02, 0xF5, 0x5B, 0xEF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3E, 0x55, 0xF8, 0x07, 0xE0, 0xF4,
-    0x03, 0xE0, 0x0F, 0x87, 0xC0, 0x0F, 0x40, 0x3E, 0x2F, 0x00, 0x3D, 0x00, 0xF4, 0xF8, 0x00, 0xFC,
-    0x0B, 0xC3, 0xD0, 0x02, 0xFE, 0xFC, 0x1F, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x3E, 0x05, 0x40, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x6B, 0xEA, 0xA4, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x01, 0xF8, 0x00, 0x1F, 0x07, 0xFF, 0x80, 0x07,
-    0xC7, 0xEB, 0xE0, 0x02, 0xE7, 0xC0, 0xF8, 0x00, 0xF7, 0xC0, 0x3D, 0x00, 0x3F, 0xC0, 0x1F, 0x00,
-    0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xF0, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x7C,
-    0x00, 0x7D, 0x00, 0x2F, 0x1C, 0x2F, 0x00, 0x0F, 0xEF, 0x0B, 0xC0, 0x03, 0xFF, 0x03, 0xE0, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xCB, 0xFE, 0x01, 0xFF, 0x40,
-    0xF8, 0x1F, 0xAC, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x7C, 0xF0, 0x00, 0x02, 0xEB,
-    0x40, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x01, 0xF4, 0xF4, 0x00, 0x07, 0xC2, 0xF0,
-    0x00, 0x2F, 0x03, 0xE0, 0x60, 0xF8, 0x0F, 0xDB, 0x83, 0xD0, 0x0F, 0xFC, 0x1F, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8,
-    0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0,
-    0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80,
-    0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC,
-    0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0xB0, 0x02, 0xC0, 0x00, 0x1F, 0x00, 0x78, 0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03,
-    0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8,
-    0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B,
-    0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8,
-    0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0,
-    0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80,
-    0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC,
-    0x0F, 0xF8, 0x8B, 0xE0, 0x00, 0x41, 0xC0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x80,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0A, 0xAB,
-    0xFA, 0xAA, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0x9B, 0xE5, 0x6F, 0x03, 0xC0, 0x7D, 0x01, 0xE0,
-    0x3C, 0x0B, 0xC0, 0x2C, 0x01, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF9,
-    0x54, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xFA, 0xAF, 0xF4, 0x00, 0x3F, 0x00, 0x1F, 0xC0,
-    0x03, 0xE0, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0xBC, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0xBE, 0x01, 0xBF, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F,
-    0xC0, 0x00, 0xBF, 0xF0, 0xBF, 0xE0, 0x00, 0x03, 0xE3, 0xE7, 0xE0, 0x00, 0x03, 0xDB, 0x43, 0xD0,
-    0x00, 0x03, 0xED, 0x03, 0xC0, 0x00, 0x07, 0xF8, 0x07, 0xC0, 0x00, 0x0B, 0xF0, 0x0B, 0xEF, 0xE0,
-    0x0F, 0xD0, 0x0F, 0xFF, 0xFC, 0x0F, 0xC0, 0x0F, 0x40, 0xBD, 0x1F, 0x80, 0x1F, 0x00, 0x3D, 0x1F,
-    0x00, 0x1F, 0x00, 0x3D, 0x2F, 0x00, 0x2F, 0x00, 0x7C, 0x3E, 0x00, 0x1F, 0x40, 0xF8, 0x3D, 0x00,
-    0x0F, 0xEB, 0xF0, 0x7C, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F,
-    0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xBE, 0xAA, 0xAA, 0xAA, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00,
-    0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00,
-    0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x3F, 0x40, 0xBD, 0x0B, 0xC0, 0x03, 0xE1, 0xF4, 0x00, 0x3F,
-    0x3E, 0x00, 0x02, 0xF3, 0xE5, 0x55, 0x7F, 0xBF, 0xFF, 0xFF, 0xEB, 0xD5, 0x55, 0x7D, 0xF8, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0xF8, 0xBC, 0x00, 0x3F, 0x07, 0xE0, 0x0F, 0xC0, 0x3F, 0xFF, 0xF0, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1F, 0xFF, 0xE0, 0x00,
-    0x3F, 0xC2, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x2F, 0x80, 0x00, 0x2F, 0xAC, 0x07, 0xE0, 0x00, 0x1F,
-    0x40, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xE0,
-    0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x7C, 0x00,
-    0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0x80, 0x00,
-    0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x00, 0x02, 0xF2, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBE, 0x00, 0x00, 0xFC, 0xBF, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0x00, 0x0F, 0xEC, 0x02, 0xF0, 0x02,
-    0xF0, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0x0F, 0x42, 0xD0, 0x00, 0x00,
-    0xF4, 0x78, 0x00, 0x00, 0x0F, 0x4F, 0x00, 0x00, 0x00, 0xF6, 0xD0, 0x00, 0x00, 0x0F, 0x7C, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x0B, 0xF5, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x7F, 0x00, 0x00, 0x1F, 0x40, 0x0F,
-    0x4F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0x47, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x41, 0xF4, 0x00, 0x00,
-    0xF8, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x1F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x5F, 0x00, 0x0F,
-    0x80, 0x00, 0x0B, 0xEF, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xFE, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xB0, 0x02, 0xC0,
-    0x00, 0x7C, 0x01, 0xE0, 0x00, 0x2F, 0x41, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFC, 0x00, 0x1F, 0x0B, 0xFF, 0x00,
-    0x0F, 0x80, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3D,
-    0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xF0, 0x01,
-    0xF0, 0x02, 0xF8, 0x00, 0xBC, 0x01, 0xFE, 0x00, 0x2F, 0x01, 0xEB, 0x4B, 0x0F, 0xD2, 0xF3, 0xEB,
-    0xC2, 0xFF, 0xF0, 0xFF, 0xE0, 0x3F, 0xE0, 0x2F, 0xF4, 0x00, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x90, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xEA, 0x90, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFD, 0x57, 0xFC, 0x00, 0x7D, 0x00, 0x2F, 0x80, 0x2F, 0x40, 0x03, 0xF0, 0x0B,
-    0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x0F, 0xC0,
-    0x2F, 0x40, 0x1F, 0xD0, 0xBF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x68, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x5B, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x3D, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x15, 0x00, 0x0F, 0xFF, 0xFC, 0x03, 0xF9, 0xBF, 0x81, 0xF0,
-    0x03, 0xF0, 0xBC, 0x00, 0x7C, 0x2E, 0x00, 0x2F, 0x0F, 0x80, 0x0F, 0x82, 0xF0, 0x0B, 0xC0, 0x7F,
-    0xAF, 0xD0, 0x07, 0xFF, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x07, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFA, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x07, 0xE0,
-    0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF8, 0x10, 0x7D, 0x00, 0x1F, 0x4F,
-    0x0F, 0xC0, 0x02, 0xF0, 0x7A, 0xF4, 0x00, 0x3F, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFE, 0xF0, 0x00, 0x0B, 0xD0, 0x0B, 0x40, 0x00, 0xBC, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x01,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0B,
-    0xF0, 0x02, 0xFF, 0x87, 0xFF, 0xC0, 0x00, 0xF8, 0xF5, 0xFC, 0x00, 0x0F, 0x7C, 0x0B, 0xD0, 0x00,
-    0xFF, 0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x07, 0xD0, 0x02, 0xFC, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x0B,
-    0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x1C, 0x1F, 0x40, 0x07, 0xC1, 0xE3, 0xF0, 0x00, 0xBC,
-    0x0F, 0xBC, 0x00, 0x0F, 0xD0, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xBF, 0xFD, 0x00,
-    0x02, 0xF0, 0x10, 0xF0, 0x00, 0x2E, 0x00, 0x0B, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x6A, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E,
-    0x01, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x51, 0xF0, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0x3F, 0x00, 0x0B, 0x80, 0x00, 0xF8, 0x00, 0x2C, 0x00, 0x07, 0xE0, 0x00, 0x50, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF4, 0x03, 0xFF, 0xFC, 0x0F, 0x80, 0xBE, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x02, 0xC1,
-    0xF8, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0x82, 0xC0, 0x3F, 0x00, 0x04,
-    0x3F, 0x00, 0x1C, 0x3F, 0x40, 0xBC, 0x2F, 0xFF, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x7D, 0x00,
-    0x3D, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x0F, 0x80, 0x01, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF1, 0xAA, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x03, 0xFE, 0xAF, 0xF8, 0x00, 0x7E, 0x00, 0x2F, 0xC0, 0x0B, 0xD0, 0x00, 0xFD, 0x00, 0xBC,
-    0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x00, 0xBD,
-    0x02, 0xF0, 0x00, 0x0F, 0xC2, 0xFF, 0xF4, 0x00, 0xFC, 0xBF, 0xFF, 0x40, 0x1F, 0x40, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x80, 0x1F, 0xC0, 0x00, 0x1F, 0xAF, 0xF0, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF4,
-    0x03, 0xF0, 0x1F, 0x00, 0x3E, 0x00, 0xE0, 0x03, 0xD0, 0x04, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xFD, 0xBF, 0xD0, 0x0F, 0xFF, 0xFF, 0x40, 0xFE, 0x56, 0xFC, 0x1F, 0x00, 0x0F, 0xD2,
-    0xF0, 0x00, 0xBD, 0x3E, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x7D, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x01, 0x00, 0x7D, 0x00, 0xBD, 0x6F, 0x40, 0x0B,
-    0xFF, 0xD0, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x01, 0xFF,
-    0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xFE, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0x00, 0x09, 0xBD,
-    0x00, 0x3D, 0x00, 0x7E, 0x68, 0x00, 0x00, 0xB8, 0x01, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xF0,
-    0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x43, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2F,
-    0x5F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD7, 0xF6,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x7D, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xC0, 0x2F,
-    0x40, 0x00, 0x00, 0x7F, 0x40, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xF4, 0x00, 0xBE,
-    0x00, 0x00, 0x7F, 0x80, 0x07, 0xC0, 0x00, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xF0, 0x02, 0xFE,
-    0x00, 0x7F, 0x80, 0x0F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x02, 0xD0, 0x02, 0xFC, 0x03, 0xFF, 0xC0, 0x3C, 0x00, 0xFF, 0xD0, 0xB9, 0xBD, 0x07, 0xC0,
-    0x3E, 0x6C, 0x0E, 0x03, 0xE0, 0xF8, 0x0F, 0x40, 0x00, 0x00, 0x2E, 0x3F, 0x42, 0xD0, 0x00, 0x00,
-    0x01, 0xE7, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x2E, 0xDF, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF9, 0xF3,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x2E, 0xEF, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xFC, 0xF0, 0x00, 0x00,
-    0x00, 0xF0, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0xF4, 0x0B, 0x06, 0x5B, 0x80, 0x7C,
-    0x0F, 0xC2, 0xF0, 0xFF, 0xE0, 0x0B, 0x40, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0xF0, 0x03, 0xFD, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x54, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0xBC, 0x00, 0xFC, 0x03, 0xD0, 0x02, 0xF4, 0x0F, 0x00, 0x07, 0xD0, 0x18, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x15, 0xFD, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x0A, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x05,
-    0x00, 0x00, 0xF8, 0x78, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x7F, 0x0B, 0xF0, 0x0B, 0xF4, 0x0F, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x07, 0x6F, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x03, 0xFF, 0xFD, 0x0B, 0x80, 0x3F, 0x09, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0xBC, 0x00, 0x2B, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7D, 0x10, 0x00,
-    0x7D, 0xB4, 0x00, 0xBC, 0xFC, 0x02, 0xF8, 0xBF, 0xFF, 0xE0, 0x2F, 0xFE, 0x40, 0x00, 0x7C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x1E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x0B, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x6F, 0xF9, 0x01, 0xFF, 0xC0,
-    0x00, 0x7D, 0x00, 0x7E, 0x68, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0xC0, 0xB8, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xC0, 0x00,
-    0x00, 0x02, 0xF5, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF6, 0xF8, 0x00,
-    0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0B,
-    0xE0, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0xFF, 0xC0,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xCB, 0xFE, 0x01, 0xFF, 0x40,
-    0xF8, 0x1F, 0xAC, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x7C, 0xF0, 0x00, 0x02, 0xEB,
-    0x40, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x01, 0xF4, 0xF4, 0x00, 0x07, 0xC2, 0xF0,
-    0x00, 0x2F, 0x07, 0xD0, 0x74, 0xF8, 0x0F, 0xD7, 0xC3, 0xD0, 0x1F, 0xFF, 0x1F, 0x00, 0x2F, 0x6C,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0xFF, 0xFC,
-    0x00, 0x2F, 0xF0, 0x06, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x99, 0x00, 0x0B,
-    0xC0, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0xD0, 0xF4, 0x00, 0x00,
-    0x03, 0xD7, 0x4B, 0x40, 0x00, 0x00, 0x1F, 0x2C, 0x78, 0x00, 0x00, 0x00, 0xBC, 0xF7, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x9E, 0xBC, 0x00, 0x00, 0x00, 0x7D, 0x74, 0xF8,
-    0x00, 0x00, 0x02, 0xF2, 0xC2, 0xF0, 0x00, 0x00, 0x0B, 0xCB, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x14,
-    0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0x2F,
-    0x00, 0x00, 0x7F, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xBF, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xCB, 0xFE,
-    0x00, 0x1F, 0xF0, 0x0F, 0x80, 0x1F, 0xAC, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0xF3, 0x4F, 0x00, 0x00,
-    0x7C, 0xDB, 0x40, 0x00, 0x2F, 0x77, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xDE, 0x7C, 0x00,
-    0x01, 0xF3, 0x4F, 0x40, 0x00, 0x7C, 0xC2, 0xF0, 0x00, 0x2E, 0x00, 0x3D, 0x06, 0x0F, 0x80, 0x0F,
-    0xD7, 0x83, 0xD0, 0x01, 0xFF, 0xC1, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x0B, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x6F, 0xF9, 0x01, 0xFF, 0xC0,
-    0x00, 0x7D, 0x00, 0x7E, 0x68, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0xFF, 0xC3, 0xE0, 0x00,
-    0x02, 0xFF, 0xF8, 0xB8, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xC0, 0x00,
-    0x00, 0x02, 0xF5, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF6, 0xF8, 0x00,
-    0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0B,
-    0xE0, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0xBF, 0xFF, 0xC0,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x5B, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xFF,
-    0xF0, 0x2F, 0x0A, 0xFE, 0x83, 0xFD, 0x02, 0xE0, 0x3E, 0xB0, 0x0F, 0x43, 0xC0, 0x00, 0x3C, 0x3C,
-    0x00, 0x01, 0xF3, 0xC0, 0x00, 0x0B, 0xAD, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xFE, 0xF0, 0x00,
-    0x07, 0xD3, 0xD0, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0xBC, 0x0F, 0x81, 0x83, 0xE0, 0x2F, 0x6E, 0x0F,
-    0x40, 0x3F, 0xF0, 0x7C, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x43, 0xFF, 0xFF, 0xF8, 0x02, 0xFE, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xE7, 0xC0, 0x3F, 0x00, 0x3F,
-    0x5C, 0x78, 0x03, 0xE0, 0x0B, 0xC0, 0x0B, 0x40, 0x7D, 0x02, 0xF0, 0x00, 0x70, 0x0B, 0xC0, 0x7C,
-    0x00, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x7C,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x07,
-    0xE0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0,
-    0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xF8,
-    0x00, 0x2F, 0xC0, 0x01, 0xBF, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xC7, 0xFF, 0xF0, 0x1F,
-    0xF7, 0xC0, 0x78, 0x1F, 0xAC, 0xF0, 0x2D, 0x1F, 0x40, 0x2D, 0x0F, 0x0F, 0x00, 0x00, 0x03, 0xCF,
-    0x00, 0x00, 0x01, 0xEB, 0x80, 0x00, 0x00, 0xBB, 0xF0, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x0F,
-    0x4F, 0x80, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x02, 0xF0, 0x3E, 0x06, 0x00, 0xF8, 0x0B, 0xE7, 0x80,
-    0x3D, 0x00, 0xFF, 0xC0, 0x1F, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0,
-    0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD5, 0x55, 0x5B, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xFF, 0x40, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2D, 0x0B, 0xFF,
-    0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00,
-    0x7C, 0x00, 0x3E, 0x00, 0x2F, 0x55, 0x5F, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xE5, 0x56, 0xF0,
-    0x00, 0xF4, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x4B, 0x0F, 0x80, 0x07,
-    0xDB, 0xC3, 0xD0, 0x01, 0xFF, 0xD1, 0xF0, 0x00, 0x3F, 0x74, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0,
-    0x7C, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x0F, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x07, 0x80,
-    0x00, 0xFC, 0x00, 0x00, 0xBC, 0x01, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD5, 0x55, 0x5B, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x6F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xF8, 0xBF, 0xF0, 0x00, 0xFF, 0xFF, 0x02, 0xF0, 0x00, 0xF4,
-    0x1F, 0x03, 0xE0, 0x01, 0xF0, 0x3D, 0x03, 0xD0, 0x02, 0xF0, 0xFC, 0x07, 0xC0, 0x03, 0xE0, 0x10,
-    0x0B, 0xD5, 0x57, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x95, 0x5B, 0xC0, 0x00, 0x0F,
-    0x40, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x0F, 0x4B, 0x00, 0x3E, 0x00,
-    0x1F, 0xBE, 0x00, 0x3D, 0x00, 0x1F, 0xF8, 0x00, 0x7C, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC1, 0xBA, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0xFE, 0xFF, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0xFE, 0xAF, 0xF4, 0x00, 0x7D, 0x00, 0x01,
-    0xF8, 0x00, 0x2F, 0xC0, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00,
-    0x0F, 0xC0, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC2, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0x00, 0xF8, 0xBF, 0xFF, 0x02, 0xFF, 0xFC, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x7F, 0x80, 0x00, 0x0B, 0xFF, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xF8,
-    0xBD, 0xBD, 0x00, 0x00, 0x03, 0xDB, 0x81, 0xF4, 0x00, 0x00, 0x0F, 0xB8, 0x07, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x2F, 0x05, 0x40, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x0F, 0xE0, 0x03, 0xFF, 0xBF,
-    0xD0, 0x3F, 0x00, 0x1F, 0x80, 0x2F, 0xC1, 0xF8, 0x00, 0xBC, 0x00, 0x3F, 0x07, 0xC0, 0x03, 0xF0,
-    0x00, 0xBD, 0x2F, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0xF8, 0x00, 0x3D, 0x00, 0x07, 0xD3, 0xD0, 0x01,
-    0xF0, 0x00, 0x2F, 0x1F, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x20, 0x0B, 0xC0,
-    0x00, 0x00, 0x02, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE4,
-    0x01, 0x40, 0x00, 0x0F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xF4, 0x01, 0xF9, 0xBF, 0x00, 0xFE, 0x00,
-    0x7E, 0x02, 0xF4, 0x1F, 0xC0, 0x0F, 0xC0, 0x1F, 0x83, 0xF4, 0x01, 0xF4, 0x00, 0xF8, 0x3F, 0x00,
-    0x3F, 0x00, 0x0F, 0x87, 0xE0, 0x03, 0xE0, 0x01, 0xF8, 0xBD, 0x00, 0x7E, 0x00, 0x1F, 0x4B, 0xD0,
-    0x07, 0xD0, 0x02, 0xF0, 0xFD, 0x00, 0x7D, 0x00, 0x3F, 0x0F, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0xBE,
-    0x00, 0x7E, 0x00, 0xFC, 0x07, 0xF0, 0x03, 0xF0, 0x2F, 0x40, 0x3F, 0x00, 0x2F, 0x07, 0xE0, 0x02,
-    0xFC, 0x00, 0xFE, 0xF8, 0x00, 0x0F, 0xF4, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE5, 0x6C,
-    0x00, 0x7F, 0xFF, 0x6F, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x6F, 0x40, 0x0F, 0x80, 0xFF, 0xF4, 0x0F, 0x80, 0xB8, 0x2F,
-    0x0B, 0xC0, 0x7C, 0x07, 0xC3, 0xD0, 0x3E, 0x01, 0xF1, 0xF0, 0x0F, 0x40, 0x7C, 0xBC, 0x03, 0xD0,
-    0x2F, 0x2F, 0x01, 0xF0, 0x0F, 0x8F, 0xC0, 0x3C, 0x07, 0xC2, 0xF0, 0x0F, 0x43, 0xD0, 0x7E, 0x02,
-    0xF3, 0xF0, 0x0F, 0xD0, 0x3F, 0xE0, 0x01, 0xFF, 0xAF, 0xF4, 0x24, 0x0B, 0xFF, 0xBF, 0xF8, 0x00,
-    0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xF4, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x00, 0xB8, 0x0F,
-    0xC0, 0x00, 0x0B, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04,
-    0x03, 0xFC, 0x00, 0x02, 0xD0, 0x1F, 0xF9, 0x56, 0xFC, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x02, 0x9B, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xFC, 0x03, 0xF5, 0x7C, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xBD, 0x00, 0x74, 0x7F, 0x46, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x2E, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x2F,
-    0x00, 0x7C, 0x78, 0x03, 0xF0, 0x07, 0x8B, 0x40, 0x3E, 0x00, 0x74, 0x70, 0x07, 0xD0, 0x06, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x07, 0xF4, 0x02, 0xF8, 0x0B, 0xFF, 0x0B, 0xFF, 0x07, 0xFF, 0x40, 0x0F, 0x8B, 0xDF,
-    0xC7, 0xDB, 0xD0, 0x03, 0xDB, 0x82, 0xE7, 0xC1, 0xF4, 0x00, 0xFB, 0x80, 0xBB, 0xC0, 0x7C, 0x00,
-    0x7F, 0xC0, 0x3F, 0xC0, 0x2F, 0x00, 0x2F, 0xC0, 0x0F, 0xD0, 0x0F, 0x80, 0x0F, 0xE0, 0x07, 0xF0,
-    0x03, 0xD0, 0x03, 0xF0, 0x02, 0xF4, 0x01, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x7C,
-    0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x0F, 0x4F, 0x0F, 0x80, 0x0B, 0xC0, 0x07,
-    0xDB, 0x83, 0xD0, 0x03, 0xE0, 0x01, 0xFF, 0xD1, 0xF0, 0x00, 0xF4, 0x00, 0x3E, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x2F, 0xFE,
-    0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00,
-    0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x0B, 0xC0,
-    0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x1F, 0x87, 0xFE, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xBC, 0x02, 0xF0, 0x02, 0xF0,
-    0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0x80, 0x3D, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0xFC, 0x0F, 0x80, 0x02,
-    0xF0, 0x7C, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01,
-    0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x2F, 0xFE,
-    0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00,
-    0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x0F, 0x80,
-    0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x02, 0xAF, 0xFA, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x1F, 0x87, 0xFE, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xBC, 0x02, 0xF0, 0x02, 0xF0,
-    0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0x80, 0x3D, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x02,
-    0xF0, 0x7C, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x57, 0xF9, 0x40, 0x03, 0xFF, 0xFE, 0x00, 0x05, 0xBD, 0x50, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01,
-    0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFE, 0x40, 0x6F, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1B, 0xFF, 0x40, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xFC, 0x07,
-    0xFF, 0x00, 0x7F, 0xC0, 0x65, 0xF8, 0x1F, 0x98, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0x7D, 0xB8,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xF3, 0xE0, 0x20, 0x00, 0x3C, 0x2F, 0x0B,
-    0x42, 0x5F, 0x41, 0xFB, 0xF0, 0x3F, 0xE0, 0x0F, 0xFF, 0x03, 0xF8, 0x00, 0x7D, 0xF0, 0x04, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0x90, 0x7C, 0x1F, 0x03, 0xC0,
-    0x2F, 0x00, 0x1E, 0x0B, 0xC0, 0xF0, 0x0B, 0xC0, 0x0B, 0x43, 0xF0, 0x3C, 0x03, 0xE0, 0x01, 0xC0,
-    0xF8, 0x0C, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x0A, 0xAA, 0x90, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xC2,
-    0xFF, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x2F,
-    0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0xF4, 0x00,
-    0xFC, 0x00, 0x7C, 0x00, 0xBE, 0x00, 0x2F, 0x00, 0x7F, 0x40, 0x0B, 0xC0, 0x7A, 0xD3, 0xC3, 0xF4,
-    0xBC, 0xFB, 0xD0, 0xBF, 0xFC, 0x3F, 0xF0, 0x0F, 0xF8, 0x0B, 0xAC, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x2F,
-    0xFD, 0x01, 0xBF, 0xE4, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0xD0,
-    0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00,
-    0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x07, 0xF4, 0x06, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFA, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0xB0, 0xFF, 0xE0, 0x03, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xD0,
-    0x07, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xC0, 0x2F, 0x80, 0x07, 0xF6, 0xFF, 0x40,
-    0x03, 0xFF, 0xDF, 0x40, 0x00, 0x54, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x1D,
-    0x00, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0x78, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x2F, 0xFD,
-    0x01, 0xBF, 0xE4, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00,
-    0x3F, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0xD0, 0x7D, 0x00, 0x0F, 0xC1, 0xD0, 0xBD,
-    0x00, 0x0B, 0xD2, 0xC0, 0xBC, 0x00, 0x07, 0xF7, 0xC6, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0x42, 0xF0, 0x00, 0x00, 0x0B, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0x03, 0xF0, 0x00, 0x00, 0x05, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0xB0, 0xFF, 0xE0, 0x03, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xD0, 0x03,
-    0xD0, 0x07, 0xC0, 0x07, 0xC0, 0x0B, 0xC7, 0x0F, 0xC0, 0x0B, 0xCB, 0x2F, 0x80, 0x07, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xDF, 0x40, 0x00, 0x2D, 0x1F, 0x00, 0x00, 0x1C, 0x2F, 0x00, 0x00, 0x2C, 0x3E,
-    0x1C, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x46, 0xA8, 0x00, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xAB, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x02,
-    0xF4, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x0F, 0x80, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x0B, 0xFF, 0x80, 0x7F, 0xF8,
-    0xBF, 0xFF, 0x03, 0xFF, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x6B, 0xF0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xF0, 0x00, 0x3D, 0x1F, 0xFE, 0x00,
-    0x0F, 0x1F, 0x9F, 0xC0, 0x07, 0xCF, 0x03, 0xF0, 0x02, 0xEF, 0x00, 0xF8, 0x00, 0xFF, 0x40, 0x3D,
-    0x00, 0x3F, 0x80, 0x1F, 0x00, 0x1F, 0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x03, 0xE0, 0x03, 0xF0, 0x00,
-    0xF4, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x2F, 0x1C, 0x2F, 0x00, 0x0F, 0xEF, 0x0B, 0xC0,
-    0x03, 0xFF, 0x03, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0xFD,
-    0x0E, 0x01, 0xF8, 0x00, 0x1F, 0x8F, 0x00, 0xFC, 0x00, 0x03, 0xFB, 0xC0, 0xBC, 0x00, 0x00, 0xFE,
-    0xF0, 0x3E, 0x00, 0x00, 0x3E, 0x7D, 0x2F, 0x00, 0x00, 0x1F, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xF9, 0x55, 0x55, 0x50, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x1C, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0x02, 0xFE, 0x55, 0xBF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xBE, 0xFE, 0x00, 0x03, 0xE0, 0x3F, 0x00,
-    0x0B, 0x80, 0x3F, 0x2D, 0x1F, 0x00, 0x7D, 0x7C, 0x3E, 0x01, 0xFC, 0x7C, 0x3D, 0x0B, 0xE0, 0x3E,
-    0xBE, 0xBF, 0x40, 0x2F, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x2C, 0x00, 0x7F, 0x46, 0xF8, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0xFD, 0x0E, 0x01, 0xF8, 0x00, 0x1F, 0x8F, 0x00, 0xFC,
-    0x00, 0x03, 0xFB, 0xC0, 0xBC, 0x00, 0x00, 0xFE, 0xF0, 0x3E, 0x00, 0x00, 0x3E, 0x7D, 0x2F, 0x00,
-    0x00, 0x1F, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xF9, 0x55,
-    0x55, 0x50, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1C, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x00, 0x02, 0xFE, 0x55, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0xBE, 0xFE, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x0B, 0x80, 0x3F, 0x2D, 0x1F, 0x00, 0x7D, 0x7C, 0x3E,
-    0x01, 0xFC, 0x7C, 0x3D, 0x0B, 0xE0, 0x3E, 0xBE, 0xBF, 0x40, 0x2F, 0xFF, 0xF4, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x2C, 0x00, 0x7F, 0x46, 0xF8, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x06, 0xFF, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE6, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x01, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F,
-    0xC0, 0x07, 0xFE, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0x00, 0x09, 0xBD, 0x00, 0x3D, 0x00, 0x7E, 0x68,
-    0x00, 0x00, 0xB8, 0x01, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0xC0, 0x3D, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x43, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0x5F, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD7, 0xF6, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x7D, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xC0, 0x2F, 0x40, 0x00, 0x00, 0x7F, 0x40,
-    0x3E, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x80, 0x07,
-    0xC0, 0x00, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xF0, 0x02, 0xFD, 0x00, 0x7F, 0x80, 0x0F, 0xFF,
-    0xC0, 0x02, 0xFC, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x02, 0xD0, 0x02, 0xFC, 0x03, 0xFF, 0xC0,
-    0x3C, 0x00, 0xFF, 0xD0, 0xB9, 0xBD, 0x07, 0xC0, 0x3E, 0x6C, 0x0E, 0x03, 0xE0, 0xF8, 0x0F, 0x40,
-    0x00, 0x00, 0x2E, 0x3F, 0x42, 0xD0, 0x00, 0x00, 0x01, 0xE7, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x2E,
-    0xDF, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF9, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x2E, 0xEF, 0x00,
-    0x00, 0x00, 0x07, 0xC3, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x2D,
-    0x03, 0xD0, 0xF4, 0x07, 0x06, 0x5B, 0x80, 0x7C, 0x0F, 0xC2, 0xF0, 0xFF, 0xE0, 0x0B, 0x40, 0xBF,
-    0xFC, 0x0B, 0xF4, 0x00, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x0B, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x6F, 0xF9, 0x01, 0xFF, 0xC0,
-    0x00, 0x7D, 0x00, 0x7F, 0x68, 0x00, 0x0B, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xC0, 0x00,
-    0x00, 0x02, 0xFA, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF5, 0x6F, 0xF0,
-    0x00, 0x00, 0x7D, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x0B,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x00,
-    0x7E, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xE0, 0x02, 0xFF, 0xF8, 0x00, 0xBD, 0x00, 0xBF, 0xFF, 0xC0,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x10,
-    0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xEB, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0x8B, 0xFE, 0x01, 0xFF, 0x00,
-    0xF8, 0x0F, 0xB8, 0x03, 0xD0, 0xF4, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x7C, 0x3C, 0x00, 0x02, 0xF1,
-    0xE0, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xF4, 0x03, 0xF4, 0x07, 0xC0, 0x03,
-    0xF0, 0x2E, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x2F, 0x03, 0xD0, 0x00, 0xBC, 0x1F, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x40, 0x2F, 0x00, 0x0F,
-    0x97, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x2E, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xE0,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x00, 0x01,
-    0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00,
-    0x01, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x7D,
-    0x00, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x41, 0xF4, 0x00,
-    0x3E, 0x00, 0x03, 0xEF, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0x80,
-    0x07, 0xFF, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x2D,
-    0x03, 0xE0, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x78, 0x07, 0xC0, 0x00, 0x0B, 0x40, 0xBC, 0x00,
-    0x00, 0xF0, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x1F, 0x44, 0x00, 0x7C, 0x02,
-    0xF0, 0xE3, 0xEF, 0x40, 0x2F, 0x7E, 0x3F, 0xF0, 0x03, 0xFF, 0xD3, 0xFC, 0x00, 0x2F, 0xBC, 0x04,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x0B, 0xD5, 0x55, 0x5B, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xFE, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0xBF, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0xBF, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xDB, 0xFF, 0x00, 0x0F, 0x80, 0xBC,
-    0x00, 0x3D, 0x03, 0xE0, 0x01, 0xF0, 0x0F, 0x40, 0x0B, 0xC0, 0x7C, 0x00, 0x3E, 0x02, 0xF5, 0x55,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xD0, 0x3E, 0x55, 0x6F, 0x00, 0xF4, 0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0,
-    0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x3C, 0x03, 0xD0, 0x01, 0xF0, 0x1F, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x20, 0x3D, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x0F, 0x80, 0x00, 0x0B, 0xD5, 0x55, 0x5B, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xFE, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xFE, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2D, 0x0B, 0xFF, 0x00, 0x0F, 0x80,
-    0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x3E,
-    0x00, 0x2F, 0x55, 0x5F, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xE5, 0x56, 0xF0, 0x00, 0xF4, 0x00,
-    0xBC, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x4F, 0x0F, 0x80, 0x03, 0xDB, 0xC3, 0xD0,
-    0x00, 0xFF, 0xE1, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x2F, 0xFD, 0x01, 0xBF, 0xE4,
-    0x03, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x07,
-    0xC0, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0B, 0xD0,
-    0x00, 0xBC, 0x00, 0x07, 0xF4, 0x06, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFA,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x01, 0xBF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x02, 0xCF,
-    0xFE, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0xF8, 0x03, 0xD0, 0x03, 0xD0, 0x1F, 0x00, 0x1F, 0x00, 0xBC,
-    0x00, 0xFC, 0x02, 0xF0, 0x0B, 0xE0, 0x07, 0xF6, 0xFF, 0x40, 0x0F, 0xFF, 0x7D, 0x00, 0x05, 0x41,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1B, 0xD0,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFB, 0xC0, 0x00, 0x01,
-    0xFB, 0xC0, 0x02, 0xEB, 0xC0, 0x00, 0x02, 0xE7, 0xD0, 0x07, 0xCB, 0xC0, 0x00, 0x03, 0xD3, 0xD0,
-    0x0F, 0x4F, 0xC0, 0x00, 0x07, 0xC3, 0xE0, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xC3, 0xE0, 0x3D, 0x0F,
-    0x80, 0x00, 0x0F, 0x43, 0xF0, 0x78, 0x0F, 0x80, 0x00, 0x0F, 0x02, 0xF0, 0xF0, 0x0F, 0x80, 0x00,
-    0x2F, 0x01, 0xF2, 0xE0, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0xF7, 0xC0, 0x0F, 0x40, 0x00, 0x3D, 0x00,
-    0xFF, 0x40, 0x1F, 0x40, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0xB8, 0x00, 0xBD, 0x00,
-    0x1F, 0x00, 0x00, 0xF4, 0x00, 0x78, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x10, 0x00, 0x2F, 0x00,
-    0x1B, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xF4, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x03, 0xF4, 0x02, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x0E,
-    0xF4, 0x03, 0xAD, 0x00, 0x01, 0xDB, 0x80, 0xF3, 0xD0, 0x00, 0x2C, 0x7C, 0x1E, 0x3C, 0x00, 0x02,
-    0xC3, 0xC3, 0xC7, 0xC0, 0x00, 0x3C, 0x3C, 0x74, 0xB8, 0x00, 0x03, 0x83, 0xCF, 0x0B, 0x80, 0x00,
-    0x74, 0x3E, 0xD0, 0xF4, 0x00, 0x0F, 0x03, 0xFC, 0x0F, 0x04, 0x00, 0xE0, 0x3F, 0x40, 0xF0, 0xFA,
-    0x7D, 0x03, 0xF0, 0x0F, 0x6F, 0xFF, 0xC0, 0x3D, 0x00, 0xFF, 0xEB, 0xF0, 0x01, 0x40, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x06, 0xFF, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x70, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0xFC,
-    0x02, 0xD0, 0x00, 0x00, 0x0B, 0xE5, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00,
-    0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00,
-    0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD,
-    0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x0A, 0x00, 0x28, 0x00, 0x2F, 0x00, 0x74, 0x00, 0x3F, 0x01, 0xF0,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0,
-    0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40,
-    0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C,
-    0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0xFE,
-    0x00, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D,
-    0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xAA, 0xAA, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F,
-    0x40, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F,
-    0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x50, 0x00, 0x2F, 0x83, 0xF4, 0x00, 0x3F, 0x43,
-    0xF0, 0x00, 0x2E, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07,
-    0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F,
-    0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE,
-    0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x80, 0x03, 0x80, 0x00, 0x00, 0x03,
-    0xD7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F, 0x05, 0x50, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xF8, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x56, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x55, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x0F, 0x80, 0x00, 0x80, 0x00, 0x2E, 0x00, 0x07, 0xD0, 0x00, 0xB4, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x6F, 0x00, 0x2F, 0xF8, 0x02, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x41, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFB, 0xF0, 0x0B, 0xE0, 0x2F, 0xD0, 0x3D, 0x07,
-    0xE0, 0x03, 0xD0, 0x0F, 0x43, 0xE0, 0x02, 0xF0, 0x0B, 0xC2, 0xF0, 0x00, 0xF4, 0x0B, 0xD0, 0xF8,
-    0x00, 0xBC, 0x1F, 0xD0, 0x7D, 0x00, 0x3F, 0x7F, 0xC0, 0x2F, 0x00, 0x2F, 0xFE, 0x40, 0x0B, 0xC0,
-    0x0F, 0xF4, 0x00, 0x03, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0xFC, 0x0B, 0x7F, 0x00, 0x1D, 0x2F, 0x9B,
-    0x8F, 0xE0, 0x6F, 0x07, 0xFF, 0xC1, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x1F, 0xFD, 0x00, 0x01, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xC0, 0x00, 0x03,
-    0xC0, 0x0B, 0x00, 0x00, 0x2F, 0x00, 0x78, 0x00, 0x00, 0x7F, 0x5B, 0xC0, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xC0,
-    0x00, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x01, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00,
-    0x2F, 0x40, 0x17, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x28, 0x00, 0xD0, 0x0F, 0x80, 0x2C, 0x00, 0xFC, 0x0B, 0x80,
-    0x07, 0xFF, 0xE0, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0xBE, 0xFD, 0x00, 0x3E, 0x03, 0xE0, 0x0B, 0x80, 0x3E, 0x01, 0xF0, 0x07, 0xD0, 0x3E,
-    0x01, 0xF8, 0x03, 0xD0, 0xBE, 0x00, 0x7D, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x07, 0xE0, 0x6F, 0x40, 0x3F, 0xFF, 0xD0, 0x01, 0xFF,
-    0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x03, 0x80, 0x00, 0x3F, 0x00, 0x10, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x05, 0x55, 0x55, 0x5F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xAA, 0xAA, 0xBF,
-    0x43, 0xE0, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x7C, 0x00,
-    0x01, 0xF8, 0x07, 0xD0, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x1F, 0xFF, 0xF0, 0x0F, 0x80, 0xFD, 0x07, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF8,
-    0x00, 0x1B, 0xFE, 0x00, 0x7F, 0x9F, 0x40, 0xFE, 0x07, 0xC0, 0xFC, 0x02, 0xF0, 0xFC, 0x01, 0xF4,
-    0x3D, 0x00, 0xFC, 0x0F, 0x80, 0xFC, 0x03, 0xFB, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0xBE, 0x0B, 0xE0, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x00,
-    0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x03, 0x80,
-    0x00, 0x3F, 0x00, 0x10, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x05, 0x55, 0x55, 0x5F, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xAA, 0xAA, 0xBF, 0x43, 0xE0, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x00, 0x3E, 0x07,
-    0xC0, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x01, 0xF8, 0x07, 0xD0, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x2F,
-    0x80, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x01, 0x40, 0x0F, 0xD0, 0xFC, 0x00, 0xFC, 0x1F, 0xC0, 0x0B, 0x40, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x3E,
-    0x03, 0xF4, 0x07, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x6F, 0xF8,
-    0x00, 0x7F, 0x9F, 0x40, 0x3F, 0x81, 0xF0, 0x0F, 0xC0, 0x2F, 0x03, 0xF0, 0x07, 0xD0, 0x3D, 0x00,
-    0xFC, 0x03, 0xE0, 0x3F, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x7F,
-    0xE0, 0x0B, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x9B, 0xD0, 0x03, 0xD0, 0x07, 0xE6, 0x80, 0x00, 0x0B,
-    0x80, 0x1F, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x2E,
-    0x03, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x3D, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE2, 0xF5, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xF8,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBC, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xE0, 0x03,
-    0xF0, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0x40, 0x0B, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x7C, 0x00, 0x0F,
-    0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xFF, 0x00, 0x2F, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x2F,
-    0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x02, 0xD0, 0x02, 0xFC, 0x03, 0xFF, 0xC0,
-    0x3C, 0x00, 0xFF, 0xD0, 0xB9, 0xBD, 0x07, 0xC0, 0x3E, 0x6C, 0x0E, 0x03, 0xE0, 0xF8, 0x0F, 0x40,
-    0x00, 0x00, 0x2E, 0x3F, 0x42, 0xD0, 0x00, 0x00, 0x01, 0xE7, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x2E,
-    0xDF, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF9, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x2E, 0xEF, 0x00,
-    0x00, 0x00, 0x07, 0xC3, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x2D,
-    0x03, 0xD0, 0xF4, 0x07, 0x06, 0x5B, 0x80, 0x7C, 0x0F, 0xC2, 0xF0, 0xFF, 0xE0, 0x0B, 0x40, 0xBF,
-    0xFC, 0x0B, 0xF4, 0x00, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x50, 0x00, 0xBE, 0x0B, 0xE0, 0x03, 0xF4, 0x3F, 0x40, 0x0F, 0xC0, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xC0, 0x0F, 0xC0, 0x3D, 0x00, 0x2F, 0x40, 0xF0, 0x00, 0x7D, 0x01, 0x80, 0x01, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x01, 0x5F, 0xD0, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0xAF, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x50, 0x00,
-    0x0F, 0x87, 0x80, 0x00, 0xBD, 0x3F, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0xBF, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x0F, 0xC0, 0xFC, 0x00,
-    0xFC, 0x1F, 0xC0, 0x0F, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0xB8, 0x03, 0xF0, 0x09, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xBE, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x7D, 0x01, 0x00, 0x07, 0xD0, 0xB4, 0x00, 0xBC, 0x0F, 0xC0, 0x2F, 0x80, 0xBF, 0xFF,
-    0xE0, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xC0, 0x01, 0xF8, 0x00, 0xB4, 0x00, 0x7E, 0x00,
-    0x0F, 0x00, 0x1F, 0x80, 0x00, 0x50, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x40, 0x00, 0x0F,
-    0xC0, 0x2D, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x2E, 0x00, 0x0B, 0xD0, 0x0F, 0x00, 0x07, 0xD0, 0x03, 0x40, 0x07,
-    0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x07, 0xD0, 0x0D, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x02, 0xF4, 0x01, 0xFF, 0x9B, 0xF4,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA8, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xDF, 0xC0, 0x00, 0x07, 0xD0, 0x03, 0xD3,
-    0xE0, 0x00, 0x02, 0xF0, 0x03, 0xD1, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x3E,
-    0x07, 0xC0, 0x2F, 0x00, 0x00, 0x1F, 0x47, 0xC0, 0x0F, 0xC0, 0x00, 0x0B, 0xD7, 0xC0, 0x03, 0xE0,
-    0x00, 0x02, 0xFB, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x2F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x2F, 0xFF, 0x00, 0x1B, 0xFF, 0x80, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0xAA,
-    0x90, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01,
-    0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03,
-    0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F,
-    0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B,
-    0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x6F, 0xF9, 0x00, 0x2F, 0xFE, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0xF7, 0xF0, 0x00, 0x01, 0xF4, 0x00,
-    0xF4, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0xF4, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xF4, 0x1F, 0x40, 0x00,
-    0x0F, 0x81, 0xF0, 0x0B, 0xC0, 0x00, 0x07, 0xD1, 0xF0, 0x03, 0xF0, 0x00, 0x02, 0xF5, 0xF0, 0x00,
-    0xF8, 0x00, 0x00, 0xBE, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8,
-    0x00, 0x0B, 0xFF, 0xC0, 0x06, 0xFF, 0xE0, 0x0B, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x06,
-    0x00, 0x50, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x2F, 0x83, 0xF4, 0x00, 0x1E, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0,
-    0x00, 0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0,
-    0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00,
-    0x2F, 0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF,
-    0x0F, 0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
-    0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03,
-    0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00,
-    0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00,
-    0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x50, 0x00, 0xBE, 0x0B, 0xD0, 0x03, 0xF4,
-    0x3F, 0x40, 0x0B, 0x80, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x7F, 0x00, 0xFC, 0x00, 0xBD, 0x07,
-    0xD0, 0x01, 0xF8, 0x3F, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x7D, 0x2F, 0x00,
-    0x02, 0xF0, 0xFC, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0xBD, 0x0B, 0xD0, 0x07, 0xE0, 0x1F, 0xC0, 0x7F,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F,
-    0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xBE, 0xAA, 0xAA, 0xAA, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00,
-    0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00,
-    0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x3F, 0x40, 0xBD, 0x0B, 0xC0, 0x03, 0xE1, 0xF4, 0x00, 0x3F,
-    0x3E, 0x00, 0x02, 0xF3, 0xE5, 0x55, 0x7F, 0xBF, 0xFF, 0xFF, 0xEB, 0xD5, 0x55, 0x7D, 0xF8, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0xF8, 0xBC, 0x00, 0x3F, 0x07, 0xE0, 0x0F, 0xC0, 0x3F, 0xFF, 0xF0, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01, 0xFC, 0x1F,
-    0xC0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07, 0xE0,
-    0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x00, 0xBC, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBE, 0xAA, 0xAA, 0xAA,
-    0xFC, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x1F,
-    0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x50, 0x00, 0x7E, 0x0B, 0xE0, 0x02, 0xF8, 0x3F, 0x40, 0x07,
-    0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xD0, 0x2F, 0x40, 0xBC, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0xFC,
-    0x3E, 0x00, 0x02, 0xF0, 0xF9, 0x55, 0x5F, 0xCB, 0xFF, 0xFF, 0xFE, 0x2F, 0x55, 0x55, 0xF4, 0xF8,
-    0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x0B, 0xC0, 0x03, 0xF0, 0x1F, 0x80, 0x3F, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x03,
-    0xF4, 0x3F, 0x40, 0x01, 0xFD, 0x1F, 0xD0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBC, 0x00, 0x7F, 0x40, 0x2E, 0x00, 0x07, 0xF0, 0x0F, 0x00, 0x00, 0xFD, 0x02, 0xC0, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x07, 0xFE, 0xAF, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xBD, 0x05, 0x00, 0x00, 0x3F, 0x07, 0x80, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x3F, 0x80,
-    0xBF, 0x00, 0xBF, 0x80, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x14, 0x01, 0x40, 0x3F, 0x03, 0xF0, 0x1F, 0xC2, 0xFC, 0x03, 0xD0, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x02, 0xFF, 0xFD, 0x02, 0xF4,
-    0x1F, 0xC0, 0xE0, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x05, 0x57, 0xE0, 0x0B,
-    0xFF, 0xF8, 0x00, 0x55, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC7, 0x80, 0x07, 0xD2, 0xF0,
-    0x07, 0xE0, 0x7F, 0xEF, 0xE0, 0x0B, 0xFF, 0xD0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA8,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0xBF, 0xFE, 0x2F,
-    0xFD, 0x00, 0x6F, 0xF8, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xF0,
-    0x00, 0x3D, 0x00, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x03,
-    0xD0, 0x00, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0x00, 0x7D, 0x0F, 0x00, 0x00, 0x00, 0x3E, 0x2D, 0x00,
-    0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x3D, 0x00, 0x00, 0x00, 0xB9,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xAA, 0xAA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0x40, 0x0F, 0xC0, 0x1F, 0xFC, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x3E,
-    0x00, 0x03, 0xF0, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x0F,
-    0x40, 0xF0, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x00, 0xB8, 0x78, 0x00,
-    0x00, 0x07, 0x8F, 0x00, 0x00, 0x00, 0x7A, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x10,
-    0x1F, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0x0B, 0xE0, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0xFD, 0x00,
-    0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0xBF, 0xFE, 0x2F, 0xFD, 0x00, 0x6F, 0xF8, 0x07, 0xE0,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x02, 0xF4, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x07, 0xC0,
-    0x00, 0x00, 0x7D, 0x0F, 0x00, 0x00, 0x00, 0x3E, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x10, 0x3D, 0x00, 0x00, 0x00, 0xB9, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x05, 0x00, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x1E, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00,
-    0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00,
-    0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F,
-    0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B, 0x87, 0x80, 0x00, 0x00,
-    0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x01, 0xF4,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x28, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00,
-    0x00, 0xFF, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x2F, 0xE0, 0x00, 0x0F, 0xD0, 0x7E, 0x00, 0x00, 0x0D,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0xBF, 0xFE, 0x2F, 0xFD, 0x00, 0x6F, 0xF8, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x1F,
-    0x00, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00,
-    0x00, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0x00, 0x7D, 0x0F, 0x00, 0x00, 0x00,
-    0x3E, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x3D, 0x00,
-    0x00, 0x00, 0xB9, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x1D, 0x00,
-    0x00, 0x1F, 0x83, 0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x2F, 0x07,
-    0xD0, 0x00, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x03,
-    0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00,
-    0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B, 0x87, 0x80,
-    0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01,
-    0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0xBF,
-    0x00, 0x00, 0x07, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x2F, 0xFD, 0x01, 0xBF, 0xE4, 0x03,
-    0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x07, 0xC0,
-    0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00,
-    0xBC, 0x00, 0x07, 0xF4, 0x06, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFA, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x3D, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0xB0, 0xFF, 0xE0, 0x03, 0xF0, 0x03, 0xE0, 0x03,
-    0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xC0, 0x2F,
-    0x80, 0x07, 0xF6, 0xFF, 0x40, 0x03, 0xFF, 0xDF, 0x40, 0x00, 0x54, 0x1F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x1C, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x06,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0x00,
-    0x0B, 0x80, 0x00, 0xF8, 0x00, 0x2C, 0x00, 0x03, 0xE0, 0x00, 0x50, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0xFC, 0x0F,
-    0x80, 0xBE, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0xBE,
-    0x00, 0x07, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x38, 0x3F, 0x01, 0xF4,
-    0x3F, 0xFF, 0xF0, 0x0B, 0xFD, 0xF0, 0x00, 0x40, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-    0x02, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x82, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0xA9, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD5, 0xBF, 0x80, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x02, 0xF4, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x07,
-    0xD0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x1B, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x03, 0xF4,
-    0x3F, 0x00, 0x00, 0x02, 0xE0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xB4, 0xFF, 0xE0, 0x00, 0x00, 0xF4,
-    0x03, 0xD0, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x0F,
-    0x85, 0x40, 0x03, 0xE0, 0x0F, 0xFF, 0xF4, 0x03, 0xD0, 0x1F, 0xE6, 0xFD, 0x07, 0xC0, 0x2F, 0x00,
-    0x7E, 0x0B, 0xC0, 0x2E, 0x00, 0x3E, 0x0F, 0x80, 0x3D, 0x00, 0x3D, 0x0F, 0x40, 0x3E, 0x00, 0x7C,
-    0x1F, 0x4A, 0x3F, 0x01, 0xF8, 0x1F, 0x7D, 0x1F, 0xEB, 0xE0, 0x2F, 0xF8, 0x0B, 0xFF, 0x40, 0x1F,
-    0xD0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x3F,
-    0x00, 0x0B, 0x80, 0x00, 0xF8, 0x00, 0x2C, 0x00, 0x07, 0xE0, 0x00, 0x50, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xA7, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0xFC,
-    0x0F, 0x80, 0xBE, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x02, 0xC1, 0xF8, 0x00, 0xFF, 0xE0, 0x00,
-    0xBF, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0x82, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x18, 0x3F, 0x40,
-    0xBC, 0x2F, 0xFF, 0xFC, 0x0B, 0xFF, 0x7C, 0x00, 0x10, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4,
-    0x00, 0x7B, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x1F, 0xFE, 0x40, 0x6F, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x00,
-    0x3E, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1B, 0xFF, 0x40, 0x02, 0xF0,
-    0x00, 0x3F, 0xFF, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xAF, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x01, 0xFC, 0x07, 0xFF, 0x00, 0x7F, 0xC0, 0x65, 0xF8, 0x1F, 0x98, 0x00, 0x0F, 0xC3,
-    0xD0, 0x00, 0x00, 0x7D, 0xB8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xF3, 0xE0,
-    0x00, 0x00, 0x3C, 0x2F, 0x00, 0x02, 0x5F, 0x41, 0xF4, 0x00, 0x3F, 0xE0, 0x0F, 0xC0, 0x03, 0xF8,
-    0x00, 0xBC, 0x00, 0x04, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x40, 0x7C, 0x00, 0x00, 0x2F, 0x5F, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFE, 0x40, 0x6F, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0x4B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1B, 0xFF, 0x40, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xFC, 0x07, 0xFF, 0x00, 0x7F, 0xC0, 0x65,
-    0xF8, 0x1F, 0x98, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0x7D, 0xB8, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x7F, 0xD5, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x00, 0x3C, 0x2F, 0x00, 0x02, 0x5F, 0x41, 0xF9, 0x60,
-    0x3F, 0xE0, 0x0F, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x50, 0x57, 0x5D, 0x1F, 0x40, 0xF0,
-    0x3F, 0xC5, 0xA5, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x6A, 0xAB, 0xDB, 0xAA, 0xBD,
-    0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xC0,
-    0x00, 0x7E, 0xAA, 0x97, 0xEA, 0xAE, 0x1D, 0x00, 0x60, 0x74, 0x06, 0x00, 0xD0, 0x60, 0x00, 0x06,
-    0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00,
-    0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x6A, 0xAA, 0x7F,
-    0xFF, 0xEB, 0xFF, 0xF4, 0x6A, 0xAA, 0x7F, 0xFF, 0xEB, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xEB, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA,
-    0xAA, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x14, 0x01,
-    0x43, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3,
-    0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0,
-    0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E,
-    0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E,
-    0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE2, 0x90, 0x29, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF,
-    0xE5, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0xC0, 0x3C, 0x03, 0xE0, 0x1F, 0x00, 0xFC, 0x03, 0xF0,
-    0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x06, 0x80, 0xFD, 0x0F, 0xD0, 0xBC, 0x0F, 0xC0, 0xF0, 0x2E,
-    0x07, 0xC0, 0xA0, 0x00, 0x01, 0x40, 0xFD, 0x0F, 0xD0, 0xBD, 0x0F, 0xC0, 0xF4, 0x2F, 0x03, 0xC0,
-    0xF0, 0x00, 0x00, 0x04, 0x0F, 0xDB, 0xF2, 0xF4, 0x7D, 0x0F, 0x42, 0xE0, 0x3C, 0x07, 0x80, 0x00,
-    0x00, 0x10, 0x00, 0x01, 0xF0, 0x1E, 0x03, 0xC0, 0x7C, 0x0F, 0x80, 0xF4, 0x1F, 0x02, 0xF0, 0x3F,
-    0x03, 0xE0, 0x3F, 0x07, 0xE0, 0x7F, 0x0B, 0xF0, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x10, 0x0F, 0xD1, 0xFC, 0x0F, 0xD0, 0xFD, 0x0B, 0xD0, 0xFC, 0x0F, 0xC0, 0xF8, 0x0F, 0x41, 0xF0,
-    0x2F, 0x03, 0xE0, 0x3C, 0x07, 0xC0, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x14, 0x0F,
-    0xD1, 0xFC, 0x0F, 0xD0, 0xFD, 0x0B, 0xD0, 0xFC, 0x0F, 0xC0, 0xF8, 0x0F, 0x41, 0xF0, 0x2F, 0x03,
-    0xE0, 0x3C, 0x07, 0xC0, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0xFD, 0x1F, 0xCB,
-    0xF0, 0xBE, 0x2F, 0x43, 0xF0, 0x7D, 0x0B, 0xC0, 0xF4, 0x1F, 0x02, 0xE0, 0x3E, 0x03, 0xC0, 0x7C,
-    0x07, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x43, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC,
-    0x14, 0x2C, 0x05, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x04, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC,
-    0x05, 0x0F, 0x41, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x10, 0x3C, 0x05, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFD, 0x04,
-    0x0B, 0x40, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x1F, 0xFC, 0x7F, 0xF0, 0xFF, 0x40,
-    0x50, 0x00, 0x74, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFE, 0xFF, 0xFE, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x05, 0x03, 0xFC, 0x3F, 0xC3,
-    0xF8, 0x05, 0x00, 0x0A, 0x00, 0x18, 0x3F, 0x40, 0xBE, 0x7F, 0x40, 0xFE, 0x7E, 0x00, 0xFC, 0x14,
-    0x00, 0x10, 0x06, 0x00, 0x00, 0x90, 0x00, 0x19, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x7F, 0x3F, 0x40,
-    0x0B, 0xF0, 0x00, 0xFF, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFD, 0x04, 0x00, 0x01, 0x00, 0x00, 0x10,
-    0x1F, 0x43, 0xFC, 0x3F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34,
-    0x60, 0x2B, 0xDB, 0x02, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x07, 0x40, 0x01, 0xC0, 0x00, 0x7E, 0x80, 0x97, 0xE8, 0x0E, 0x1D, 0x00, 0x60, 0x74, 0x06,
-    0x00, 0xD0, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00,
-    0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x2F, 0x40, 0x07, 0xAD, 0x01, 0xCA, 0x34, 0x30, 0xA0, 0xC0, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD3, 0x40, 0x00, 0x74, 0xE0, 0x00,
-    0x1D, 0x38, 0x6A, 0xAF, 0x4E, 0xEA, 0xAF, 0x4D, 0xD0, 0x1D, 0x34, 0xD0, 0x70, 0xD0, 0xD1, 0xC3,
-    0x40, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x40,
-    0x0B, 0x1D, 0x00, 0x2C, 0x74, 0x00, 0xB1, 0xFA, 0xA9, 0x70, 0xFA, 0xAB, 0x1C, 0x34, 0x07, 0x07,
-    0x0D, 0x07, 0x01, 0xC3, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x01, 0xF0,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x01, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x03, 0xD0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0xF4, 0x06, 0xE0, 0x00, 0x0A,
-    0x90, 0xB8, 0x0F, 0x42, 0xE0, 0x3F, 0xFC, 0x00, 0xBF, 0xF8, 0x7E, 0xBD, 0x07, 0xC0, 0xF8, 0x2E,
-    0x02, 0xF0, 0x7C, 0x1F, 0xF4, 0x0F, 0x02, 0xE0, 0x1F, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x2D, 0x03,
-    0xC0, 0x0F, 0x0B, 0x80, 0x2E, 0x00, 0x00, 0xB8, 0x0B, 0x80, 0x0F, 0x0F, 0x00, 0x2D, 0x00, 0x01,
-    0xF0, 0x0F, 0x40, 0x1F, 0x1F, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x2E, 0x1F, 0x00, 0x3C,
-    0x00, 0x0B, 0x80, 0x0F, 0x40, 0x3C, 0x1F, 0x00, 0xB8, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0xB8, 0x1F,
-    0x00, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0xD6, 0xF0, 0x0F, 0x9B, 0xD0, 0x00, 0xF8, 0x00, 0x02, 0xFF,
-    0x80, 0x07, 0xFF, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0xE0, 0xBD, 0x0F, 0xC2, 0xF4, 0x3E,
-    0x07, 0xC0, 0xF4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x34, 0x07, 0xE0, 0xBC, 0x0B, 0xD0,
-    0xFC, 0x0F, 0xC2, 0xF8, 0x2F, 0x43, 0xF0, 0x3E, 0x07, 0xD0, 0x7C, 0x0F, 0x80, 0xF4, 0x0F, 0x00,
-    0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0D, 0x02, 0xC0, 0x7E, 0x0B, 0xC0, 0xFC,
-    0x2F, 0x43, 0xF0, 0x7E, 0x0F, 0xC2, 0xF8, 0x3F, 0x0B, 0xD0, 0xFC, 0x1F, 0x83, 0xE0, 0x7D, 0x0B,
-    0xC1, 0xF0, 0x3E, 0x03, 0xD0, 0xF4, 0x0F, 0x01, 0xE0, 0x04, 0x01, 0x00, 0x20, 0x00, 0x00, 0x07,
-    0x40, 0xFC, 0x0F, 0xD0, 0x7F, 0x03, 0xF0, 0x0F, 0x80, 0x7C, 0x02, 0xD0, 0x08, 0x00, 0x00, 0x00,
-    0x74, 0x02, 0xC0, 0xFC, 0x0B, 0xC0, 0xFD, 0x07, 0xE0, 0x7F, 0x03, 0xF0, 0x3F, 0x01, 0xF8, 0x0F,
-    0x80, 0xFC, 0x07, 0xC0, 0x3D, 0x02, 0xD0, 0x1E, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x0B, 0x00, 0xB0, 0x0F, 0xC0, 0xBC, 0x07, 0xE0, 0x3F, 0x41, 0xF8, 0x0F, 0xC0, 0x7F, 0x03,
-    0xF0, 0x2F, 0x40, 0xFC, 0x07, 0xE0, 0x3F, 0x00, 0xF8, 0x0F, 0xC0, 0x7D, 0x01, 0xF0, 0x0F, 0x40,
-    0xF8, 0x02, 0xD0, 0x1E, 0x00, 0xF0, 0x02, 0x00, 0x10, 0x01, 0x40, 0x00, 0x18, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x1F, 0xB8, 0x00, 0x1F, 0x0B, 0x80, 0x1F, 0x00, 0xB8, 0x0F, 0x40, 0x0B, 0x80, 0x00,
-    0x18, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0xC0, 0x7F, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0F,
-    0x80, 0x03, 0xC0, 0x00, 0x90, 0x02, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x7F,
-    0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x0F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0x40, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x1E, 0x2D, 0x00, 0xF0, 0x07, 0x80, 0xB4, 0x1F, 0x40, 0xE0,
-    0x02, 0xC0, 0xA0, 0x38, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0xF0,
-    0xF0, 0x00, 0x0A, 0x03, 0xFC, 0x0A, 0x01, 0xF8, 0x0F, 0x01, 0xF4, 0x0F, 0x42, 0xF8, 0x0F, 0x00,
-    0x00, 0xB5, 0xE0, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x07, 0x40, 0x1D, 0x00, 0x01, 0xE0, 0x50,
-    0x74, 0x00, 0x78, 0x1F, 0x42, 0xD0, 0x0E, 0x01, 0xF4, 0x0B, 0x43, 0x80, 0x05, 0x00, 0x2C, 0x70,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x3E, 0x00, 0x3E,
-    0x00, 0xBD, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF4, 0x02, 0xF0,
-    0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xC0,
-    0x07, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x0B, 0x80, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x00, 0x0F, 0x00,
-    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x7E, 0x00,
-    0x14, 0x00, 0x14, 0x00, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x00,
-    0x6A, 0xA3, 0xFF, 0xDB, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xA4, 0x00, 0x06, 0xA0, 0x03, 0xFF, 0xC0, 0x0B, 0xFF, 0x82, 0xFF, 0xFC, 0x03,
-    0xFF, 0xF4, 0x64, 0x2F, 0x40, 0xE0, 0x7F, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00,
-    0x01, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00,
-    0x7C, 0x00, 0x3E, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x00, 0xBC,
-    0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0xE8, 0x00, 0x1F, 0xA4, 0x02, 0xFE, 0x00, 0x03, 0xFC,
-    0x00, 0x29, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x07, 0xD0, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00,
-    0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0A, 0x90, 0x00, 0x0B, 0xC0,
-    0xFF, 0xF0, 0x00, 0x3F, 0x0B, 0xFF, 0xF0, 0x02, 0xF4, 0x19, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x0F,
-    0x40, 0x3F, 0x00, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0x0F, 0x00, 0x0F,
-    0x80, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0xE0, 0x03, 0xFA, 0x00, 0x07, 0x40, 0x0B, 0xF8, 0x00,
-    0x1D, 0x00, 0x0A, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0x40,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2A, 0x40, 0x00, 0xBD,
-    0x01, 0xFF, 0xF0, 0x00, 0xFC, 0x02, 0xFF, 0xF8, 0x00, 0xF8, 0x02, 0x90, 0xBC, 0x01, 0xF4, 0x00,
-    0x00, 0x3C, 0x02, 0xF0, 0x00, 0x00, 0x3C, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x01,
-    0xF4, 0x03, 0xC0, 0x00, 0x07, 0xD0, 0x07, 0xC0, 0x00, 0x1F, 0x40, 0x07, 0x80, 0x00, 0x7D, 0x00,
-    0x0B, 0x40, 0x01, 0xF4, 0x00, 0x0B, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x03, 0xE9, 0x00, 0x0F,
-    0x00, 0x03, 0xFD, 0x00, 0x08, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x0B,
-    0xD0, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xC2,
-    0xFA, 0xFF, 0x97, 0xE0, 0xF0, 0x06, 0xFF, 0xE0, 0x10, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0xD0, 0x2C, 0x03, 0x80, 0x7E, 0x0B, 0xC0, 0xFC, 0x1F, 0x42, 0xF4,
-    0x3F, 0x07, 0xE0, 0xFD, 0x0F, 0xC2, 0xF8, 0x3F, 0x03, 0xF0, 0xBD, 0x0F, 0xC1, 0xF8, 0x2F, 0x43,
-    0xE0, 0x7D, 0x0B, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x3D, 0x0B, 0xC0, 0xF4, 0x0F, 0x01, 0xE0, 0x3D,
-    0x00, 0x40, 0x10, 0x02, 0x00, 0x10, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xFF, 0xC0, 0xBD, 0x2F, 0x43,
-    0xD0, 0x3E, 0x2E, 0x00, 0xB8, 0xF4, 0x03, 0xE7, 0xC0, 0x0F, 0x6E, 0x00, 0x3C, 0xB8, 0x01, 0xF2,
-    0xE0, 0x0F, 0x4B, 0xC0, 0xBC, 0x1F, 0x9B, 0xC0, 0x2F, 0xFC, 0x00, 0x19, 0x40, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xB8, 0x00, 0x3C, 0xB4, 0x00, 0xF0, 0xF0,
-    0x03, 0xD0, 0xF0, 0x0F, 0x41, 0xF0, 0x3F, 0xAB, 0xF9, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x03, 0xFF, 0xE0, 0x1F, 0xAA,
-    0x00, 0xB4, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x06, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x1F, 0x00, 0x01, 0xF4, 0x05, 0xBF, 0x80, 0xBF, 0xF4, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x01, 0xB8, 0x00, 0x1F, 0xF9, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xFE,
-    0x00, 0x2F, 0xAF, 0xD0, 0x3D, 0x02, 0xF0, 0x3C, 0x01, 0xF0, 0x3C, 0x01, 0xF0, 0x3D, 0x03, 0xD0,
-    0x2F, 0x5F, 0xC0, 0x0B, 0xFE, 0x00, 0x01, 0x50, 0x00, 0x2A, 0xAA, 0x47, 0xFF, 0xFD, 0xB9, 0x5B,
-    0xCF, 0x00, 0xF0, 0x50, 0x3D, 0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x0B, 0x80, 0x01,
-    0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x07,
-    0xEF, 0xC0, 0x7C, 0x0F, 0x42, 0xD0, 0x3D, 0x0B, 0x81, 0xF0, 0x0F, 0xAF, 0x00, 0x2F, 0xF0, 0x03,
-    0xD7, 0xE0, 0x3D, 0x07, 0xC1, 0xF0, 0x0F, 0x47, 0xC0, 0x3C, 0x0F, 0x87, 0xE0, 0x2F, 0xFE, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x1F, 0x90, 0x00, 0xFF, 0xF8, 0x03, 0xE0, 0x7C, 0x07, 0xC0, 0x3D, 0x07,
-    0x80, 0x2D, 0x0B, 0xC0, 0x3D, 0x07, 0xD0, 0x7C, 0x02, 0xFF, 0xFC, 0x00, 0x19, 0xF4, 0x00, 0x03,
-    0xE0, 0x00, 0x1F, 0xC0, 0x01, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x2F, 0x81, 0xF7, 0xFE, 0x03, 0xE8, 0x78, 0x0F, 0xC2, 0xD0, 0x7C, 0x0F, 0x02, 0xE0, 0x3C,
-    0x0F, 0x41, 0xE0, 0x3C, 0x0B, 0xB4, 0xF0, 0x3F, 0x81, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x3F, 0xBF, 0x03, 0xE0, 0x3D, 0x1F, 0x00, 0xF8, 0xF4, 0x02, 0xE3, 0xC0, 0x0F, 0x9F,
-    0x00, 0x3D, 0xB8, 0x01, 0xF2, 0xE0, 0x0B, 0xCB, 0x80, 0x3D, 0x1F, 0x03, 0xE0, 0x3F, 0xFE, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0xFD, 0x05, 0xBC, 0x00, 0x7C,
-    0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x2F, 0xFC,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xBF, 0x03, 0xE0, 0x3D, 0x0E, 0x00, 0xF4,
-    0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00,
-    0x0F, 0x80, 0x00, 0xFF, 0xFF, 0xD1, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xEB,
-    0xE0, 0xB0, 0x2E, 0x00, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x3F, 0xF4, 0x01, 0x0B, 0xC0,
-    0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x02, 0xF4, 0x6B, 0xFD, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x1E, 0xB8, 0x00, 0x78,
-    0xF4, 0x01, 0xF0, 0xF0, 0x07, 0xC0, 0xF0, 0x1F, 0x01, 0xE0, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFC,
-    0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x40, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xD0, 0x2E,
-    0x00, 0x00, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xC0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x1B, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0x90, 0x01, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0x94, 0x00, 0x1F, 0xFF, 0x80, 0x2E, 0x57, 0xE0, 0x3C, 0x01, 0xF0, 0x3C, 0x01, 0xF0, 0x3C, 0x02,
-    0xE0, 0x3E, 0x03, 0xD0, 0x1F, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD7,
-    0xFF, 0xFD, 0xB0, 0x0B, 0x8E, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x02, 0xE0, 0x00, 0x7C,
-    0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x3E, 0x6F, 0x02, 0xE0, 0x3D, 0x0B, 0x40, 0xF0, 0x1F, 0x0B,
-    0x80, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x1F, 0x0F, 0xC0, 0xF0, 0x0F, 0x47, 0x80, 0x3D, 0x1F, 0x01,
-    0xF0, 0x3F, 0xAF, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7F, 0xF0,
-    0x01, 0xFA, 0xFC, 0x03, 0xD0, 0x3C, 0x07, 0xC0, 0x3D, 0x0B, 0x80, 0x3D, 0x07, 0xC0, 0x3D, 0x03,
-    0xF9, 0xBC, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x1B, 0xFD,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFD,
-    0x00, 0x07, 0xE5, 0x57, 0xD0, 0x00, 0x7D, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0xFC,
-    0x00, 0x10, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x95, 0x64, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xAA, 0xA0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x5B, 0xE5, 0x40, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x0B, 0xD0, 0xBD, 0x00, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0x1F,
-    0x00, 0x04, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xAF, 0xAA, 0xA0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x5F, 0x85, 0x50, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x17, 0xF5, 0x55, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xAF, 0x95, 0x56, 0xB4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0x96, 0xBF, 0xFE, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0xBC, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x0F, 0x80, 0xB4, 0x00, 0x01, 0x50, 0x00, 0xFC, 0x00, 0xBC, 0x2F, 0xFF, 0xC0,
-    0xBF, 0xE0, 0x03, 0xE0, 0x1F, 0xD2, 0xFF, 0xFD, 0x0B, 0x9B, 0x80, 0x0F, 0xEF, 0xFC, 0x00, 0x7C,
-    0x00, 0x3C, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x0F, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xF4, 0x00, 0x3E, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x03, 0xF4, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x0B,
-    0xC0, 0x00, 0x00, 0x2E, 0x02, 0x10, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0xF0, 0x1E,
-    0x0B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC3, 0xFA, 0xF0, 0xBF, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x50, 0x7D, 0x00,
-    0x03, 0xF4, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0x38, 0x00, 0x1F, 0x40, 0x00, 0x10, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x55, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0xFD, 0x55,
-    0x50, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x2A, 0xFE, 0xAA, 0x80,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x10, 0x00, 0x2F, 0xE4, 0x06, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF8, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x0B, 0x9D, 0xB8, 0x0B, 0x87, 0x4F, 0x81,
-    0xC1, 0xD0, 0xD0, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x2E, 0x2F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x0B, 0x07, 0x43, 0x42, 0xF1, 0xD3,
-    0xE0, 0x2F, 0x77, 0xE0, 0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3D,
-    0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0x07, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xF4, 0x00, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x3C,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0x5D, 0x7C, 0x0F, 0x87, 0x4B, 0xC0, 0x81, 0xD0, 0x80, 0x00, 0x74,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x1D,
-    0x00, 0x06, 0x07, 0x42, 0x43, 0xE1, 0xD2, 0xF0, 0x3E, 0x76, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0x9D, 0xBC, 0x0F, 0x87, 0x4B, 0xC1, 0x81, 0xD0, 0x90, 0x00,
-    0x74, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x60, 0x74, 0x24, 0x3E,
-    0x1D, 0x2F, 0x03, 0xE7, 0x6F, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x1F,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x00, 0x34, 0x0F, 0x00, 0x3E, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x2E, 0x00, 0x3C,
-    0x2F, 0x55, 0x5F, 0x0F, 0xFF, 0xFF, 0xC2, 0xF5, 0x55, 0x50, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3C, 0x0B, 0x00, 0x0F, 0x03, 0xE0, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x02,
-    0xE0, 0x3D, 0x55, 0x7E, 0x0F, 0xFF, 0xFF, 0xC1, 0x55, 0x57, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x01, 0x00, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x7C, 0x01, 0xF4, 0x00, 0x1F,
-    0x00, 0xF4, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA,
-    0xAA, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF,
-    0xEB, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0x8B, 0x80,
-    0x0F, 0xE2, 0xFC, 0x0F, 0xF8, 0xBF, 0xC7, 0x9E, 0x2D, 0xB4, 0x47, 0x8B, 0x44, 0x01, 0xE2, 0xD0,
-    0x00, 0x78, 0xB4, 0x00, 0x2E, 0x2D, 0x00, 0x0B, 0x8B, 0x40, 0x02, 0xE2, 0xE0, 0x00, 0xB8, 0xB8,
-    0x00, 0x2E, 0x2E, 0x00, 0x0B, 0x8B, 0x80, 0x02, 0xE2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0xB8, 0xB8,
-    0x00, 0x2E, 0x2E, 0x00, 0x0B, 0x8B, 0x80, 0x02, 0xE2, 0xE0, 0x00, 0xB8, 0xB8, 0x00, 0x2E, 0x2D,
-    0x00, 0x07, 0x8B, 0x40, 0x01, 0xE2, 0xD0, 0x00, 0x78, 0xB4, 0x01, 0x1E, 0x2D, 0x11, 0xE7, 0x8B,
-    0x6D, 0x2F, 0xE2, 0xFE, 0x02, 0xF8, 0xBE, 0x00, 0x2E, 0x2E, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x40, 0x00, 0x07,
-    0xD0, 0x1F, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x1C,
-    0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x03, 0xE7, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x07, 0xD0,
-    0x3F, 0x00, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x00, 0xF8, 0x01, 0xFE, 0xAA, 0xAF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0B, 0xF5, 0x56, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x3E,
-    0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00,
-    0x03, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xFF, 0xC0, 0x03, 0xFA, 0xFF, 0x00, 0x34, 0x01, 0xF8, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE7,
-    0xF0, 0x0B, 0xFF, 0xFF, 0x03, 0xF4, 0x1F, 0xF0, 0xBC, 0x00, 0x3E, 0x1F, 0x40, 0x03, 0xE3, 0xF0,
-    0x00, 0x3D, 0x3D, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0xBC, 0xBC, 0x00, 0x0F, 0x8B, 0xC0, 0x01, 0xF0,
-    0xBC, 0x00, 0x3E, 0x0B, 0xD0, 0x07, 0xC0, 0x7F, 0x01, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFC, 0x54,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC5, 0x54, 0x07, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF5,
-    0x55, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x03, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x3F, 0x00, 0x07, 0xFF, 0xFF, 0xFB,
-    0xF0, 0x00, 0xBF, 0x90, 0x07, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0xF4, 0x01, 0xF8, 0x00, 0x02, 0xF7, 0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x0F, 0xC0, 0x3E, 0x00,
-    0x02, 0xF4, 0x2F, 0x01, 0xF8, 0x00, 0x1F, 0x40, 0x7D, 0x07, 0xD0, 0x01, 0xF4, 0x01, 0xF4, 0x1F,
-    0x40, 0x1F, 0x40, 0x07, 0xD0, 0x7D, 0x01, 0xF4, 0x00, 0x2F, 0x41, 0xF8, 0x1F, 0x40, 0x00, 0xBC,
-    0x03, 0xF0, 0xF8, 0x00, 0x03, 0xF0, 0x0B, 0xDF, 0x80, 0x00, 0x2F, 0x40, 0x1F, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0xD0, 0x06, 0xFE, 0x00, 0x0F, 0xAF, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFC, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xC0, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x3F, 0x00,
-    0x00, 0x00, 0xB8, 0xBD, 0x00, 0x00, 0x03, 0xD1, 0xF8, 0x00, 0x00, 0x1F, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x0B, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0xC0, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0x00,
-    0xBE, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x0B, 0xE0,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3F, 0x42, 0xF4, 0x00, 0x00, 0xBE, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x07, 0xD0,
-    0x3F, 0x00, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x07, 0xC0, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x3E,
-    0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00,
-    0x03, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0xBF, 0x94, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFD, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x55, 0x55, 0x00, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x42,
-    0xF0, 0x00, 0x7F, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x3C, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xD0, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x0F, 0x80,
-    0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0xBD, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0x01,
-    0xFD, 0x3D, 0x00, 0x00, 0x01, 0xFF, 0xF5, 0x55, 0x50, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xE5, 0x55, 0x55, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x15,
-    0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xE1, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0xAA, 0xAA, 0x90, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0xFD, 0x01, 0x55, 0x55, 0xBF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xE0, 0x5B, 0xF8, 0x00, 0x0B, 0xC0,
-    0x03, 0xF4, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x0F,
-    0xC0, 0x00, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x7D, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x01, 0xF0,
-    0x03, 0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x80, 0x00, 0x0B, 0x80, 0xFC, 0x00, 0x00, 0x1F, 0x1F, 0xD0,
-    0x15, 0x55, 0x7F, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0x55, 0x55, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x55, 0x55, 0x50, 0x2F, 0x4B, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xAA, 0xAA, 0xAF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x1A, 0xAA, 0xAA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0xBF, 0x90, 0x00, 0x6F, 0xE4, 0xBF, 0xFF, 0x80,
-    0x3F, 0xFF, 0xC6, 0xAA, 0xA0, 0x02, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0xFC, 0x07, 0xF4, 0x00, 0x07, 0xC0, 0x2F,
-    0xC0, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0x02, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x1C, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x3C, 0x2F, 0x80, 0x00, 0x1B, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0,
-    0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03,
-    0xD0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00,
-    0x02, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF4,
-    0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x01, 0x80, 0xF0, 0x14, 0x3F, 0x4F, 0x0F, 0xC0, 0xBE, 0xFB, 0xE0, 0x00, 0xFF,
-    0xF4, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFF, 0xFD, 0x02, 0xF8, 0xF2, 0xFC, 0x2D, 0x0F, 0x07, 0x80,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x2F,
-    0xAF, 0xC7, 0xC0, 0x3D, 0xB8, 0x02, 0xEB, 0x40, 0x1E, 0xB8, 0x02, 0xE7, 0xD0, 0x7C, 0x2F, 0xFF,
-    0x40, 0x6F, 0x80, 0x1F, 0x43, 0xFC, 0x3F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x05, 0x55, 0x00, 0x0F, 0x80, 0xFF,
-    0xF0, 0x01, 0xF0, 0x0F, 0xFF, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x3D,
-    0x00, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0x03,
-    0xF1, 0xF0, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x2E, 0x2F, 0xFE,
-    0x0B, 0xD7, 0xD1, 0xF9, 0xE0, 0xB4, 0x03, 0xFC, 0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x01, 0xF4, 0x0B,
-    0x80, 0x7F, 0xC0, 0x7F, 0xAF, 0x1F, 0x82, 0xFF, 0xC0, 0x7E, 0x01, 0x50, 0x00, 0x90, 0x02, 0xF8,
-    0x00, 0xBE, 0x00, 0xFF, 0xF0, 0x7F, 0xFC, 0x3E, 0x0B, 0x8F, 0x47, 0xD7, 0xC0, 0x3F, 0xC0, 0x2E,
-    0x78, 0x00, 0xF4, 0x01, 0xE7, 0x80, 0x1F, 0x80, 0x1E, 0x7C, 0x03, 0xFE, 0x03, 0xD3, 0xFA, 0xF0,
-    0xFE, 0xFC, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xEA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA,
-    0xAA, 0xAA, 0xA4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x14, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x29, 0x54, 0x05, 0x2F, 0x07,
-    0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F,
-    0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C,
-    0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2,
-    0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x1A, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0xBC,
-    0x00, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00,
-    0x07, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x07, 0xC0,
-    0x00, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x0F,
-    0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x3E,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD2, 0xF0, 0x00,
-    0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x3F,
-    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03,
-    0xE0, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x3E, 0x01,
-    0xF0, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x02, 0xF2, 0xF0, 0x00,
-    0x00, 0x07, 0xCF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x7F, 0x40, 0x07, 0xF4, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00,
-    0x0B, 0xC7, 0xD0, 0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF,
-    0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F,
-    0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0,
-    0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA,
-    0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00,
-    0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xE7, 0xC0, 0x00,
-    0x00, 0xF5, 0xF4, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x2F, 0x0F, 0xD0, 0x00, 0x1F, 0xC1, 0xFE,
-    0x00, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x02, 0xF0, 0x3C,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3C, 0x0F, 0xC0, 0x00, 0x7F, 0xAF, 0x40, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0xFE, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F,
-    0xE0, 0x00, 0x02, 0xFC, 0x05, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x40, 0xFE, 0x00,
-    0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x09, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x7F, 0x0F, 0xF0, 0xFD,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x3F, 0x0B, 0xF0, 0xBE,
-    0x02, 0x40, 0x05, 0x00, 0x00, 0x00, 0x40, 0xFE, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x00, 0xFF,
-    0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x09, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40,
-    0xFE, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x05, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xC2, 0xFA, 0xFF, 0x97, 0xE0,
-    0xF0, 0x06, 0xFF, 0xE0, 0x10, 0x00, 0x06, 0x40, 0x00, 0x01, 0xA8, 0x00, 0x05, 0x03, 0xFF, 0xF4,
-    0x03, 0xC3, 0xF5, 0xBF, 0xEB, 0xD0, 0xE0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0x05,
-    0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55, 0x50, 0x02, 0x90, 0x00, 0x41, 0xFF, 0xD0, 0x2E,
-    0x3F, 0xBF, 0xDB, 0xD7, 0xC0, 0xBF, 0xF8, 0x20, 0x00, 0xBD, 0x00, 0x29, 0x00, 0x04, 0x1F, 0xFD,
-    0x02, 0xD3, 0xFF, 0xFD, 0xBD, 0x7C, 0x0B, 0xFF, 0xC3, 0x00, 0x1B, 0xE0, 0x10, 0x00, 0x00, 0x01,
-    0x0F, 0xFA, 0xAA, 0xBF, 0xC2, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x6A, 0xA5, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBF, 0xA9, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3E, 0x95,
-    0x55, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x3C, 0x05, 0x55, 0x6F,
-    0x53, 0xFF, 0xFF, 0xFC, 0xAA, 0xAF, 0xAA, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x01, 0x57, 0xD5,
-    0x54, 0xFF, 0xFF, 0xFF, 0x2B, 0xFA, 0xAA, 0x80, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xAA,
-    0xA0, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x3F,
-    0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xBF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x02, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x01,
-    0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0x80, 0x00,
-    0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x2F,
-    0xE0, 0x00, 0x02, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFE, 0x00, 0x00, 0x2F,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x0B, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0xBF, 0x80, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFE, 0x00,
-    0x1F, 0xF4, 0x00, 0xBF, 0x80, 0x07, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x7D, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x40, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x06, 0xAA, 0xAA, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xAA, 0xAA, 0xAB, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x80, 0x1A, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x1A,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xAA, 0xFE, 0xA9, 0x1F, 0xD0, 0x03, 0xD0,
-    0x00, 0xFD, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0xBC,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x0F,
-    0x00, 0x00, 0x3F, 0x40, 0xBC, 0x00, 0x00, 0x3F, 0x43, 0xE0, 0x00, 0x00, 0x7F, 0xEF, 0xAA, 0xAA,
-    0x40, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFA, 0xAA, 0xA4, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x1A, 0xAA, 0xAF, 0xBF, 0xD0, 0x00, 0x00, 0xB8, 0x1F, 0xD0, 0x00, 0x03, 0xD0,
-    0x1F, 0xC0, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x00, 0xF8,
-    0x00, 0x0F, 0x00, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x0F,
-    0x00, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xBF, 0x06, 0xAB, 0xFA, 0xAF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x6A, 0xFE, 0xAA, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x82, 0xFE, 0x40, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x15, 0x55,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xE6, 0xE6, 0xF8, 0x00, 0x0F, 0x80, 0x74, 0x0B, 0xC0, 0x0F, 0x40, 0x1D, 0x00, 0x7C,
-    0x07, 0x80, 0x07, 0x40, 0x0B, 0x43, 0xC0, 0x01, 0xD0, 0x00, 0xF1, 0xD0, 0x00, 0x74, 0x00, 0x2D,
-    0xB0, 0x00, 0x1D, 0x00, 0x03, 0xBC, 0x00, 0x07, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1D, 0x00, 0x03, 0xEC, 0x00, 0x07, 0x40, 0x00, 0xE7,
-    0x40, 0x01, 0xD0, 0x00, 0x74, 0xF0, 0x00, 0x74, 0x00, 0x3C, 0x2E, 0x00, 0x1D, 0x00, 0x2E, 0x03,
-    0xD0, 0x07, 0x40, 0x1F, 0x00, 0x3E, 0x01, 0xD0, 0x2F, 0x00, 0x02, 0xF9, 0xB9, 0xBE, 0x00, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE5, 0x16, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F,
-    0x40, 0x00, 0x00, 0x7C, 0x07, 0x80, 0x00, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x00, 0x00, 0xF1, 0xD0,
-    0x00, 0x00, 0x00, 0x2D, 0xB0, 0x00, 0x00, 0x00, 0x03, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xEC, 0x00,
-    0x00, 0x00, 0x00, 0xE7, 0x40, 0x00, 0x00, 0x00, 0x74, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x2E, 0x00,
-    0x00, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF9,
-    0x01, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE5, 0x16, 0xF8, 0x00, 0x0F, 0x80,
-    0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xBC, 0x00, 0x01, 0xFB, 0x43, 0xC7, 0xC0,
-    0x01, 0xF4, 0xF1, 0xD0, 0x7C, 0x01, 0xF4, 0x1D, 0xB0, 0x07, 0xC1, 0xF4, 0x03, 0xBC, 0x00, 0x7D,
-    0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFB,
-    0xC0, 0x03, 0xEC, 0x01, 0xF0, 0x7C, 0x00, 0xE7, 0x41, 0xF0, 0x07, 0xC0, 0x74, 0xF1, 0xF0, 0x00,
-    0x7C, 0x3C, 0x2E, 0xF0, 0x00, 0x07, 0xEE, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00,
-    0x2F, 0x00, 0x02, 0xF9, 0x01, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE5, 0x16,
-    0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x01, 0xFC, 0x07, 0x80, 0x00, 0x01,
-    0xFB, 0x43, 0xC0, 0x00, 0x01, 0xF4, 0xF1, 0xD0, 0x00, 0x01, 0xF4, 0x1D, 0xB0, 0x00, 0x01, 0xF4,
-    0x03, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00,
-    0x0F, 0xF0, 0x01, 0xF4, 0x00, 0x03, 0xEC, 0x01, 0xF4, 0x00, 0x00, 0xE7, 0x41, 0xF4, 0x00, 0x00,
-    0x74, 0xF1, 0xF4, 0x00, 0x00, 0x3C, 0x2E, 0xF4, 0x00, 0x00, 0x2E, 0x03, 0xF4, 0x00, 0x00, 0x1F,
-    0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF9, 0x01, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x06, 0xAA, 0xBF, 0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0A, 0x43, 0xFC, 0x3F, 0xC2, 0xF8, 0x00, 0x00, 0x0A, 0x00, 0x01, 0xA0, 0x00, 0x29, 0x0F, 0xF0,
-    0x01, 0xFD, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0xFD, 0x00, 0x0F, 0xC0, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x5B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x69, 0x02, 0xE0, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xE2,
-    0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xE3, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_14_italicBitmaps[34081] = {
+    0x95, 0x55, 0x3D, 0x73, 0xE4, 0x44, 0x10, 0x7D, 0x23, 0xD9, 0x16, 0x55, 0x2A, 0x3C, 0x17, 0x1C,
+    0x91, 0xE1, 0x94, 0x12, 0x1C, 0xAB, 0xC4, 0x81, 0x83, 0x5D, 0x4B, 0x85, 0x7F, 0xC0, 0x39, 0x71,
+    0x11, 0x90, 0x10, 0x90, 0xF0, 0x51, 0xE7, 0x84, 0x80, 0xC0, 0x5E, 0x89, 0x22, 0x24, 0x21, 0x22,
+    0xE5, 0x42, 0x6E, 0x2F, 0xB0, 0x03, 0x07, 0x0E, 0x6C, 0x76, 0xCA, 0x64, 0x44, 0x22, 0x21, 0x56,
+    0x15, 0x44, 0x90, 0xA8, 0xF0, 0x98, 0x52, 0x1D, 0xDA, 0x1D, 0x5E, 0xCF, 0xD8, 0xC7, 0x9E, 0x33,
+    0x54, 0x1A, 0x7B, 0x34, 0xD3, 0xD3, 0xFD, 0xDE, 0xEB, 0xEE, 0x59, 0xAC, 0x43, 0xD7, 0x69, 0x13,
+    0x77, 0xE8, 0x71, 0x8C, 0x9C, 0x1F, 0x71, 0x83, 0x0E, 0x47, 0x78, 0x84, 0xB4, 0x8C, 0x0C, 0xA7,
+    0x63, 0xBC, 0x01, 0xFF, 0x5C, 0xA0, 0x28, 0xB5, 0x51, 0x25, 0xA2, 0xF2, 0x5B, 0x3B, 0xC9, 0x92,
+    0xAB, 0xEE, 0x62, 0x94, 0x7E, 0xDD, 0xD8, 0xB1, 0x8E, 0xEB, 0x76, 0xFB, 0xCD, 0x60, 0x84, 0x71,
+    0x6C, 0x90, 0xD4, 0x3B, 0xC0, 0x59, 0x52, 0x42, 0xE3, 0x14, 0xB3, 0x97, 0x27, 0xCF, 0xB5, 0x73,
+    0xAE, 0x89, 0x9A, 0x11, 0xF0, 0x98, 0x3E, 0x63, 0x33, 0x06, 0x76, 0x68, 0x97, 0xD6, 0xE7, 0x28,
+    0xB8, 0xB5, 0x71, 0x32, 0x7B, 0xF9, 0x0C, 0x9D, 0x06, 0x1E, 0xA9, 0x16, 0x51, 0xF3, 0x5E, 0x70,
+    0xB3, 0xF2, 0xA4, 0x1C, 0xDC, 0xC6, 0x26, 0xC7, 0x53, 0x7E, 0xBA, 0x06, 0xD5, 0x7C, 0x40, 0xBF,
+    0x73, 0x19, 0x75, 0x5F, 0xEC, 0xC6, 0xED, 0xE9, 0x24, 0xEE, 0x3A, 0x44, 0x7D, 0x0B, 0x70, 0x0B,
+    0x15, 0xFF, 0xEB, 0x05, 0x10, 0xBB, 0x12, 0xC9, 0xA1, 0x79, 0x90, 0xA6, 0xED, 0x99, 0x4E, 0xDA,
+    0x7E, 0x33, 0x69, 0x87, 0x77, 0xD2, 0x66, 0xFE, 0x79, 0x5E, 0x17, 0x6E, 0x89, 0xC4, 0x59, 0xE0,
+    0x4B, 0xBA, 0x3C, 0xE5, 0xE8, 0xC2, 0x88, 0x78, 0x94, 0x1C, 0x57, 0x1E, 0x55, 0x23, 0xA3, 0x9D,
+    0x45, 0x76, 0x52, 0x52, 0xA5, 0x8C, 0x16, 0x17, 0xD0, 0xE5, 0x11, 0x45, 0x4A, 0x8C, 0xC6, 0x84,
+    0x80, 0x13, 0x43, 0x6A, 0x56, 0xB5, 0x19, 0x81, 0xC3, 0x12, 0x28, 0xB7, 0x75, 0xF9, 0x34, 0x6A,
+    0x27, 0x69, 0xED, 0xBA, 0xE9, 0x65, 0x62, 0xFA, 0x51, 0xB2, 0x88, 0xCD, 0x79, 0x62, 0x68, 0x3D,
+    0x66, 0x9C, 0xA8, 0x1D, 0xD1, 0x54, 0x75, 0xBA, 0xE4, 0x19, 0x1B, 0x37, 0x69, 0x8D, 0x73, 0xFE,
+    0x37, 0x74, 0x3D, 0x62, 0x00, 0xBA, 0xFE, 0xB5, 0xC3, 0x2E, 0x30, 0x6F, 0x85, 0xF7, 0xEB, 0x80,
+    0xF8, 0xCC, 0x65, 0x21, 0x73, 0xF2, 0xD7, 0xEE, 0x8A, 0x3E, 0x54, 0x52, 0x44, 0x23, 0x77, 0xD5,
+    0x65, 0xB2, 0x70, 0xD5, 0x61, 0x0D, 0xF9, 0x14, 0xD8, 0xC6, 0xBC, 0x46, 0xD2, 0xA4, 0x1D, 0xB6,
+    0x96, 0xEA, 0x9F, 0x66, 0xCB, 0xD5, 0x5A, 0x7F, 0xE5, 0x0C, 0x6C, 0x9E, 0x3C, 0x61, 0xA6, 0x76,
+    0x09, 0x63, 0x82, 0xCB, 0xA8, 0x21, 0xC1, 0x41, 0x23, 0x6E, 0xD4, 0xC2, 0x82, 0x69, 0x76, 0x64,
+    0xDD, 0x24, 0x4B, 0x20, 0x67, 0x82, 0x38, 0x77, 0xCD, 0xFC, 0x46, 0x70, 0x1C, 0xF6, 0x12, 0x7F,
+    0xBD, 0x8C, 0xF6, 0x7E, 0x61, 0xFE, 0xF5, 0x9E, 0x69, 0xB7, 0x03, 0x24, 0x26, 0x36, 0x69, 0x19,
+    0x08, 0xA9, 0x91, 0x97, 0x4C, 0x89, 0x26, 0x6E, 0x89, 0x07, 0x54, 0x8D, 0x8C, 0x30, 0x12, 0x5D,
+    0x98, 0x7D, 0xBF, 0xC4, 0xEF, 0x1C, 0x62, 0x28, 0x1F, 0x63, 0xBF, 0x13, 0x85, 0x65, 0x5D, 0xFB,
+    0x35, 0xEE, 0xF2, 0x34, 0xB1, 0x41, 0x85, 0x00, 0xEF, 0x42, 0x04, 0xE1, 0x2E, 0xFD, 0x8A, 0xA9,
+    0x95, 0x92, 0x94, 0xA3, 0xBB, 0xDE, 0x75, 0xBE, 0xF2, 0x8E, 0xFC, 0xE2, 0xC4, 0xBB, 0xEB, 0xC5,
+    0x1B, 0x3D, 0x31, 0x54, 0x56, 0xCA, 0x5A, 0x2F, 0x38, 0xF3, 0x52, 0x0E, 0x3F, 0x08, 0xC8, 0x9B,
+    0xB7, 0x77, 0xE3, 0x6B, 0x93, 0x9D, 0xED, 0x67, 0x2E, 0xBD, 0xB9, 0xBE, 0xAE, 0x1F, 0x8F, 0xE5,
+    0x40, 0xD8, 0xA4, 0xFA, 0x52, 0x8A, 0xB7, 0x20, 0xC1, 0x4A, 0xBE, 0x76, 0x6E, 0x10, 0x3F, 0xAF,
+    0xED, 0xAC, 0xD3, 0xF4, 0x23, 0xDD, 0x66, 0xF5, 0x71, 0xC4, 0x9C, 0xF6, 0xBA, 0xFE, 0x18, 0x9F,
+    0xCE, 0x2A, 0xF7, 0xA7, 0xB3, 0x1B, 0xE9, 0x6F, 0xFD, 0xB0, 0x26, 0xAE, 0x46, 0xB7, 0x45, 0x4C,
+    0x0A, 0x22, 0x8F, 0xF0, 0xF0, 0x44, 0x7C, 0xE9, 0x49, 0xFE, 0x88, 0x56, 0x1C, 0x0B, 0x03, 0x6F,
+    0x98, 0xDE, 0x37, 0xB4, 0xF7, 0x0C, 0x25, 0xD3, 0x14, 0x6E, 0xB5, 0x3E, 0x12, 0x29, 0x79, 0xD6,
+    0x76, 0xB4, 0xF8, 0xD0, 0x62, 0x8A, 0xDC, 0x68, 0x83, 0x81, 0xED, 0xAD, 0x0D, 0x6B, 0x61, 0xA0,
+    0x08, 0xDA, 0x0C, 0x9C, 0x64, 0x35, 0xF4, 0x95, 0x85, 0xEA, 0x0B, 0x86, 0xDB, 0xA3, 0x40, 0x1D,
+    0x27, 0x53, 0x6F, 0x57, 0x20, 0xB2, 0x71, 0xCF, 0xB3, 0x59, 0x93, 0x1B, 0x38, 0xC7, 0x8E, 0xE4,
+    0x00, 0xEE, 0x62, 0x1C, 0x21, 0x1B, 0x22, 0xD7, 0xE3, 0x85, 0x15, 0x50, 0xB1, 0x17, 0x57, 0xD2,
+    0xEE, 0x33, 0xCF, 0x68, 0xA4, 0x47, 0xA1, 0xC9, 0xA1, 0xF0, 0x2F, 0xC3, 0x5E, 0xB2, 0x7C, 0xBA,
+    0xCA, 0x75, 0xE1, 0x3C, 0x2B, 0x48, 0x39, 0x67, 0xD4, 0xF2, 0x83, 0x01, 0x03, 0x2A, 0xFA, 0xD3,
+    0x66, 0x53, 0xFC, 0x40, 0x11, 0x19, 0xD8, 0xB6, 0xF8, 0x51, 0x4A, 0x7C, 0x65, 0x2C, 0xC3, 0x50,
+    0xDC, 0x8B, 0x58, 0x4B, 0x31, 0x75, 0x88, 0x97, 0xB3, 0xD9, 0xFB, 0x2C, 0x4D, 0x53, 0x39, 0xE9,
+    0x78, 0xDF, 0xA8, 0x9C, 0x64, 0xCC, 0x4D, 0xF5, 0xDD, 0x82, 0x8E, 0xA7, 0x94, 0x95, 0xB1, 0x19,
+    0xDC, 0xFB, 0x4D, 0xE8, 0xBF, 0xAA, 0xB1, 0xE5, 0xA4, 0xA2, 0x1B, 0xAC, 0xB1, 0x1F, 0xBC, 0x9F,
+    0x48, 0x7C, 0x71, 0x9E, 0x92, 0x62, 0x65, 0x64, 0xBF, 0x22, 0xB7, 0x82, 0x25, 0xAF, 0xFE, 0x6B,
+    0x37, 0xB2, 0x82, 0x96, 0x3B, 0xC5, 0x86, 0x7B, 0x45, 0x7F, 0xCF, 0xF1, 0x0D, 0xA9, 0xFE, 0xC4,
+    0xF6, 0x34, 0xD2, 0x2F, 0x42, 0x82, 0xB7, 0xA7, 0xD1, 0xB5, 0x36, 0x71, 0x9B, 0x36, 0xCA, 0xA6,
+    0x04, 0xF7, 0xB7, 0x93, 0x5A, 0x09, 0x09, 0x6F, 0x42, 0x2C, 0x29, 0x3B, 0x91, 0x85, 0x48, 0x17,
+    0x44, 0x32, 0xA0, 0x98, 0xFD, 0xC0, 0x9B, 0x37, 0xAC, 0xDF, 0xF2, 0x57, 0x5E, 0x73, 0x3F, 0x11,
+    0x63, 0x9E, 0xCE, 0xCC, 0x2D, 0x08, 0x0E, 0x96, 0x2E, 0x55, 0x63, 0x82, 0x29, 0xA5, 0xC5, 0x9C,
+    0xAD, 0x3C, 0xA7, 0x26, 0x6B, 0x2B, 0x97, 0x03, 0xFB, 0xCE, 0xFD, 0x8E, 0x74, 0x71, 0x0B, 0xB8,
+    0x0D, 0x43, 0x18, 0x26, 0x37, 0xFB, 0xDC, 0xA3, 0xF8, 0xEE, 0x64, 0xA0, 0x32, 0x05, 0x93, 0x1D,
+    0x77, 0xBE, 0x42, 0x5A, 0x82, 0xEA, 0x7D, 0xF6, 0x93, 0x56, 0xF3, 0xF7, 0x40, 0x0D, 0x54, 0x27,
+    0xE7, 0x05, 0xE9, 0x93, 0xAF, 0x7C, 0x65, 0xB9, 0x9E, 0xE5, 0x3F, 0xE8, 0x3F, 0x5E, 0x0C, 0x39,
+    0x8F, 0x4D, 0x98, 0xEF, 0xB1, 0x47, 0x23, 0xF0, 0xFB, 0x20, 0xA3, 0x07, 0x58, 0x7B, 0x80, 0xC2,
+    0x46, 0xB2, 0x25, 0xCA, 0xEB, 0x26, 0x70, 0x28, 0xCA, 0x40, 0x5E, 0xEE, 0xAC, 0x57, 0x88, 0x43,
+    0xDE, 0x7A, 0x54, 0xA5, 0xCF, 0x9B, 0xB2, 0x38, 0xA6, 0x52, 0x17, 0xAA, 0x57, 0x3D, 0x96, 0xEC,
+    0xD5, 0x4A, 0xEE, 0x1F, 0x3A, 0x9B, 0x2F, 0x99, 0xB1, 0x8A, 0x05, 0xAD, 0x1B, 0xA2, 0xEC, 0xA6,
+    0x0C, 0xC8, 0xD1, 0x56, 0xF4, 0x5E, 0xD4, 0x45, 0x9D, 0xFB, 0x1B, 0x9D, 0x60, 0x1F, 0xBE, 0x12,
+    0xC2, 0x4A, 0xA5, 0xD5, 0x58, 0x24, 0xD6, 0x57, 0xDA, 0xD4, 0x27, 0x29, 0xB2, 0x04, 0x79, 0x49,
+    0xB0, 0x39, 0x17, 0xB9, 0xC0, 0x7C, 0xC5, 0xCB, 0xCF, 0x2C, 0xC3, 0x0C, 0x50, 0x9F, 0x48, 0xF9,
+    0x55, 0x2B, 0x83, 0x37, 0x6D, 0xC4, 0x2C, 0x1C, 0xB2, 0xFC, 0xAA, 0xFE, 0xAE, 0xD3, 0x1E, 0x62,
+    0x88, 0x06, 0x72, 0xDB, 0x5F, 0xBD, 0x93, 0x37, 0x48, 0x9C, 0x38, 0x84, 0x17, 0xAD, 0x06, 0xF2,
+    0xA5, 0xC5, 0xFA, 0xBD, 0x8B, 0x9B, 0x56, 0xEC, 0xAD, 0xAC, 0x26, 0xC9, 0x5C, 0xFA, 0xBA, 0xA7,
+    0x14, 0x1B, 0x77, 0x9D, 0x75, 0xC6, 0x70, 0x46, 0xD2, 0x17, 0x5E, 0x26, 0x3E, 0x26, 0x9C, 0x84,
+    0x23, 0xBD, 0x1B, 0x43, 0xB8, 0x15, 0x1E, 0x1C, 0x1C, 0x1C, 0xF0, 0x97, 0xF3, 0xE7, 0xD9, 0xEC,
+    0x59, 0x38, 0xFA, 0xD6, 0xC1, 0xC1, 0x13, 0xE7, 0xFE, 0x9A, 0xB1, 0x98, 0xFE, 0xD7, 0xF3, 0x2F,
+    0x8D, 0x55, 0x3D, 0x6F, 0xE4, 0x44, 0x18, 0x7E, 0xC6, 0x26, 0x71, 0x61, 0x21, 0xD3, 0x20, 0x8A,
+    0x14, 0xFE, 0x07, 0xB8, 0xA1, 0xA0, 0xB8, 0xDD, 0x1D, 0xD1, 0x5E, 0xC1, 0x15, 0x17, 0x90, 0xE0,
+    0x47, 0xA4, 0xBD, 0x62, 0x37, 0xB1, 0xE0, 0x0F, 0xEC, 0x8F, 0xB8, 0x86, 0x34, 0x69, 0x10, 0x4A,
+    0x91, 0x65, 0xE7, 0x74, 0x05, 0x05, 0x8D, 0x25, 0x44, 0xEF, 0x82, 0x03, 0x09, 0x0A, 0x46, 0x27,
+    0x4B, 0x98, 0x64, 0x76, 0x87, 0xE7, 0x99, 0xDD, 0xE4, 0x42, 0x4E, 0x48, 0x58, 0xF6, 0xD8, 0x9E,
+    0x77, 0xE6, 0xFD, 0x78, 0xDE, 0xE7, 0x7D, 0x07, 0x80, 0xE9, 0x80, 0x19, 0x9F, 0xB5, 0x1E, 0xC7,
+    0xA7, 0x4D, 0x4F, 0x16, 0x60, 0xA2, 0xE5, 0x9D, 0xA5, 0x1B, 0xB5, 0x05, 0x78, 0x67, 0xCF, 0x11,
+    0x7D, 0x13, 0x5F, 0x2C, 0x57, 0xC8, 0x3B, 0x4C, 0x90, 0x3B, 0x0C, 0x98, 0xA2, 0x6A, 0x8B, 0x1E,
+    0x23, 0x3E, 0x44, 0x7E, 0x8D, 0xA6, 0xC7, 0x73, 0xA4, 0x6B, 0x86, 0xC2, 0xE3, 0x14, 0xC6, 0xEA,
+    0xE7, 0x8B, 0x6F, 0x34, 0x36, 0x31, 0xD2, 0x4E, 0xB9, 0x3D, 0xBE, 0xE8, 0x61, 0xB6, 0xFC, 0xEA,
+    0xD1, 0xD0, 0x60, 0xE9, 0xCC, 0x40, 0x69, 0xD5, 0xD6, 0xF6, 0xB0, 0x5F, 0x36, 0x54, 0x15, 0xA3,
+    0x9D, 0x97, 0xAE, 0xFA, 0x2A, 0x18, 0x3F, 0xC1, 0x55, 0xD6, 0x17, 0x2F, 0x7C, 0xE1, 0x4A, 0x5B,
+    0x97, 0x6D, 0x83, 0x47, 0xB8, 0x9C, 0x60, 0x30, 0x3E, 0xEF, 0x86, 0xDC, 0x55, 0x6D, 0x93, 0xBB,
+    0x1A, 0x2B, 0x0C, 0x35, 0xE6, 0xC5, 0xB7, 0x55, 0x3B, 0xC1, 0xF8, 0xDD, 0xAF, 0x23, 0x86, 0x3C,
+    0x3E, 0x8E, 0x36, 0xEF, 0xF3, 0x5F, 0xCA, 0x25, 0xF5, 0x27, 0x87, 0xEA, 0x36, 0xBD, 0x64, 0xF1,
+    0xBD, 0x14, 0xF5, 0x91, 0x4B, 0x2E, 0x05, 0x4E, 0x1E, 0xC5, 0x6D, 0xF2, 0xF3, 0xE9, 0xCE, 0x77,
+    0x1C, 0x68, 0xC8, 0xBD, 0xC6, 0x33, 0x0D, 0x95, 0x1C, 0xCC, 0xFE, 0x94, 0x86, 0x47, 0x5A, 0x5F,
+    0x3D, 0xE6, 0x5E, 0xE3, 0xAF, 0xF8, 0x39, 0x29, 0x14, 0x93, 0x9B, 0xF2, 0xD3, 0xE7, 0x3D, 0x08,
+    0xC3, 0x8C, 0x5B, 0x5F, 0x7D, 0xCE, 0xCD, 0x31, 0x0A, 0xBB, 0xF3, 0xF3, 0x11, 0x14, 0xD0, 0x3C,
+    0x97, 0x07, 0x54, 0x16, 0x95, 0xCB, 0x28, 0xDD, 0x98, 0xF5, 0x12, 0x27, 0x9B, 0xB3, 0x88, 0x5A,
+    0xB0, 0x1C, 0x5B, 0x14, 0xC2, 0x27, 0xFE, 0xCE, 0x4D, 0x0B, 0x13, 0xA8, 0xB3, 0xEC, 0xB8, 0x7E,
+    0x41, 0x60, 0x12, 0x42, 0x01, 0x35, 0x1A, 0x64, 0xD7, 0x17, 0x0E, 0xB3, 0x48, 0x95, 0xAF, 0x4E,
+    0x3C, 0x85, 0x0D, 0x85, 0x14, 0x5D, 0x51, 0x69, 0xA5, 0x8F, 0x91, 0x86, 0x6A, 0x9B, 0xFB, 0xCC,
+    0x9B, 0x4D, 0x26, 0x07, 0xD6, 0xFB, 0xD0, 0x14, 0x95, 0x55, 0xC0, 0x83, 0x82, 0x76, 0xE5, 0x60,
+    0x42, 0x36, 0xA2, 0x70, 0xA7, 0xC0, 0x25, 0x77, 0x96, 0xD9, 0x90, 0x92, 0x06, 0xF9, 0x0A, 0x2A,
+    0xC6, 0x0E, 0xB7, 0xAB, 0xDB, 0x8F, 0x15, 0x52, 0xC2, 0x12, 0x20, 0xEF, 0xE4, 0x01, 0x59, 0x57,
+    0xFF, 0xFD, 0x59, 0xC0, 0x59, 0x64, 0x22, 0xD7, 0x7C, 0x04, 0x2A, 0xF0, 0xFE, 0x13, 0x02, 0xAD,
+    0x30, 0xAA, 0x78, 0x11, 0xF9, 0x69, 0x6B, 0xAF, 0xED, 0x51, 0x60, 0x56, 0x1D, 0xBD, 0xA3, 0xCD,
+    0x53, 0xE9, 0xA8, 0x05, 0x03, 0x25, 0xB9, 0xA7, 0xC4, 0x8C, 0x94, 0x70, 0x9E, 0x56, 0x1B, 0xDB,
+    0xEC, 0x25, 0x45, 0x4F, 0x09, 0x6F, 0x86, 0x3A, 0x50, 0xC2, 0xA1, 0xB1, 0x47, 0x03, 0xD6, 0x31,
+    0xF6, 0xB8, 0x17, 0x54, 0xBA, 0x14, 0x69, 0x77, 0xC8, 0x01, 0x04, 0x6A, 0x2E, 0x8B, 0x9E, 0xB1,
+    0xE4, 0x56, 0x6A, 0x77, 0x01, 0x89, 0xC2, 0x0C, 0xC6, 0x22, 0x8F, 0xB1, 0xA5, 0x77, 0x1B, 0xD9,
+    0xE3, 0xC6, 0xE1, 0x36, 0xBE, 0x19, 0x4C, 0xCB, 0xE5, 0x15, 0x98, 0xCF, 0x39, 0x4D, 0x7D, 0xD0,
+    0x97, 0xD2, 0xB7, 0xDE, 0x11, 0x44, 0xAB, 0x22, 0x37, 0x9D, 0x10, 0x3A, 0x3A, 0x23, 0x13, 0xB9,
+    0xE0, 0xFE, 0x88, 0xD9, 0xA1, 0x6C, 0xDC, 0x5B, 0x50, 0x5E, 0x99, 0x9D, 0x41, 0x56, 0xF6, 0x20,
+    0x76, 0x7B, 0x10, 0x2B, 0xF7, 0x60, 0x5D, 0xC6, 0x24, 0x52, 0x7D, 0x22, 0xE7, 0xC1, 0x13, 0xE9,
+    0xDF, 0xA6, 0x38, 0xD0, 0x74, 0xD9, 0x48, 0x98, 0xF2, 0x8E, 0x94, 0xA9, 0x68, 0x03, 0x1F, 0x27,
+    0x25, 0xCA, 0x4D, 0x52, 0x20, 0xC2, 0xD1, 0x41, 0x1C, 0x3F, 0xBD, 0x22, 0x65, 0x5E, 0x7B, 0x1C,
+    0xAC, 0xB5, 0x60, 0x24, 0xB3, 0x8B, 0x8E, 0xAB, 0x1A, 0xC2, 0x4D, 0x93, 0x71, 0x79, 0xE4, 0x4D,
+    0xA2, 0xE0, 0x5A, 0xFC, 0x32, 0x6F, 0xD0, 0x6A, 0xA2, 0xAB, 0x62, 0x7F, 0x18, 0x97, 0x19, 0xA1,
+    0x4C, 0x89, 0x10, 0x04, 0x84, 0x49, 0xA9, 0x18, 0x44, 0x52, 0x79, 0x3C, 0x4D, 0x26, 0x25, 0x6E,
+    0x51, 0xFE, 0x7C, 0xFC, 0x65, 0xAF, 0xA0, 0x18, 0x1A, 0xB6, 0xE7, 0xE7, 0x21, 0xA1, 0x37, 0x4B,
+    0x6E, 0x48, 0xEC, 0xE4, 0x14, 0x77, 0x0B, 0xCE, 0x31, 0xED, 0x5E, 0xEC, 0xC4, 0x2A, 0x6B, 0xAC,
+    0x03, 0x4E, 0xB6, 0xF4, 0x82, 0xC8, 0xEC, 0x6B, 0x50, 0xC9, 0x5A, 0x4A, 0x77, 0x62, 0x40, 0xB2,
+    0x38, 0xC5, 0xBD, 0xFF, 0x11, 0x3B, 0x2E, 0x3C, 0xF8, 0x27, 0x5E, 0x1B, 0xEA, 0xB1, 0x77, 0x71,
+    0x74, 0x38, 0x54, 0x6C, 0xCA, 0x81, 0x50, 0x49, 0xF0, 0x87, 0x3D, 0x56, 0x6F, 0x4D, 0x4E, 0xF7,
+    0x4D, 0xA0, 0x7C, 0x6B, 0xD2, 0xEE, 0x38, 0x90, 0x0A, 0x7E, 0x4C, 0xF9, 0x32, 0xDD, 0x6A, 0x47,
+    0xEB, 0x7A, 0x73, 0xAF, 0x2D, 0x28, 0x69, 0xA1, 0x8E, 0x8E, 0xCE, 0xD7, 0xA3, 0xA0, 0x3A, 0xD5,
+    0x46, 0x55, 0xC5, 0x2C, 0xD5, 0x47, 0x20, 0xC5, 0x89, 0xA3, 0xF4, 0xD6, 0x9F, 0xA6, 0xA2, 0x49,
+    0xFC, 0x4B, 0x39, 0xAE, 0x2E, 0xE4, 0xF6, 0x62, 0x96, 0x48, 0xF7, 0x7D, 0x62, 0x9D, 0x54, 0xCF,
+    0x8C, 0xC6, 0x91, 0x1D, 0x97, 0xCE, 0xB2, 0xAC, 0x18, 0x64, 0xBE, 0x21, 0x17, 0xFA, 0x5C, 0x88,
+    0xB9, 0x7C, 0x9B, 0xCC, 0xDA, 0xFB, 0x01, 0x2F, 0x1F, 0x78, 0xFC, 0x9F, 0x61, 0x2C, 0x76, 0x3C,
+    0xB9, 0x9D, 0x7C, 0x97, 0x93, 0xA5, 0x65, 0x25, 0x39, 0xB2, 0xDB, 0x93, 0xD8, 0xC3, 0x1B, 0x72,
+    0x27, 0x7E, 0xB7, 0x68, 0xB6, 0xD4, 0xDF, 0x62, 0xC6, 0xDD, 0x74, 0x5A, 0x27, 0x02, 0x5F, 0x37,
+    0x0E, 0xE6, 0xC6, 0x65, 0x7F, 0x38, 0x64, 0xBF, 0x75, 0xC5, 0x8F, 0xCC, 0xC8, 0x4F, 0x5D, 0xC5,
+    0xF0, 0x8A, 0x97, 0x7D, 0x2D, 0xEA, 0xBC, 0xEC, 0x27, 0xC4, 0xBA, 0xFA, 0xC4, 0x3F, 0xD3, 0x2B,
+    0xF3, 0x9E, 0xAF, 0xC6, 0xBC, 0xEE, 0xF9, 0x9A, 0xE2, 0x2F, 0xC7, 0x86, 0x37, 0x41, 0xB4, 0xF4,
+    0x6E, 0x4E, 0x62, 0xF2, 0x75, 0x49, 0xAC, 0x6A, 0xF0, 0xE8, 0x78, 0xC6, 0x60, 0x8D, 0x67, 0xE3,
+    0x68, 0x70, 0xC4, 0x38, 0x4D, 0xEC, 0x67, 0x64, 0x6E, 0x11, 0xFD, 0x6D, 0x7E, 0x07, 0x16, 0xAA,
+    0xCB, 0x54, 0x16, 0x16, 0x8D, 0x63, 0x31, 0xA0, 0x54, 0xCB, 0x22, 0xA2, 0x29, 0x81, 0x37, 0x6A,
+    0x28, 0x98, 0x07, 0xEA, 0x47, 0xD3, 0x58, 0x8A, 0xAB, 0xAF, 0xBD, 0xC4, 0xDD, 0x4A, 0x62, 0xFA,
+    0x21, 0x71, 0xE6, 0x25, 0xC6, 0xA9, 0xC4, 0x6D, 0xF5, 0x83, 0xC4, 0xE6, 0x9A, 0x29, 0xF3, 0x29,
+    0xCC, 0x39, 0x8A, 0x4D, 0x62, 0x16, 0x2D, 0x9F, 0x8C, 0xB2, 0xC2, 0x86, 0x9C, 0x3A, 0xC6, 0x6D,
+    0xD3, 0x7C, 0xA2, 0xAC, 0x6F, 0x53, 0x5B, 0x23, 0x24, 0xB6, 0xF2, 0xAA, 0xCD, 0x81, 0x47, 0x9E,
+    0x09, 0xAA, 0xE9, 0x20, 0x84, 0x83, 0xD2, 0x1A, 0xD4, 0x50, 0xC2, 0xEA, 0x6E, 0x20, 0xB4, 0x66,
+    0x0C, 0x4A, 0xF7, 0x46, 0xF8, 0xAF, 0xC4, 0xBC, 0x33, 0x51, 0x70, 0x66, 0xD5, 0x00, 0xFB, 0x22,
+    0xA8, 0xE3, 0xF7, 0xFB, 0xF6, 0xB9, 0x3B, 0x28, 0xEF, 0x4E, 0x81, 0x6B, 0xA6, 0x61, 0x01, 0x9D,
+    0x02, 0xB4, 0x14, 0xD2, 0x29, 0x9B, 0xF7, 0xEC, 0x93, 0x0B, 0x22, 0xA8, 0xF3, 0x83, 0x95, 0x26,
+    0xEA, 0xE4, 0xAA, 0xEF, 0x33, 0x36, 0xC3, 0xFF, 0xD7, 0x67, 0xFE, 0x75, 0xFD, 0x03, 0x9D, 0x55,
+    0xBF, 0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xB6, 0x49, 0x8C, 0x34, 0x85, 0x1B, 0x68, 0x08, 0xCA, 0x50,
+    0x46, 0x42, 0x9C, 0x1B, 0xCA, 0xDB, 0xB5, 0x45, 0x41, 0x43, 0x43, 0xC1, 0xD5, 0xF4, 0x50, 0x1C,
+    0x05, 0x05, 0xC5, 0xFE, 0x18, 0x2A, 0x0A, 0x9A, 0xFC, 0x17, 0x48, 0xD7, 0x90, 0x82, 0xE2, 0x8A,
+    0xBD, 0x5B, 0x2B, 0x4D, 0x4A, 0x2C, 0xF8, 0x03, 0x62, 0x09, 0xA5, 0x85, 0x29, 0x1C, 0x70, 0x90,
+    0x77, 0x87, 0xF7, 0xC6, 0xBE, 0x28, 0x39, 0x41, 0xC3, 0x6A, 0x6F, 0x6E, 0x67, 0x3D, 0xDF, 0xF7,
+    0xBD, 0xF7, 0xBE, 0xF7, 0xCD, 0x02, 0x77, 0x6A, 0x00, 0x69, 0x38, 0x70, 0xB5, 0x21, 0x34, 0xC0,
+    0xBE, 0x2E, 0x3A, 0xA4, 0x03, 0xB2, 0x1E, 0xB9, 0x47, 0x32, 0xA0, 0xE0, 0x97, 0x23, 0xCA, 0x5A,
+    0x6B, 0x05, 0xAD, 0x9B, 0xB8, 0x5E, 0xC5, 0x75, 0x17, 0xD7, 0x11, 0x3A, 0xC9, 0x35, 0xF3, 0xF3,
+    0xCA, 0xA7, 0x0C, 0xDC, 0x02, 0xA5, 0x43, 0x55, 0xE3, 0x9A, 0xDB, 0x2E, 0x1F, 0x80, 0x3C, 0x84,
+    0x96, 0x87, 0xC3, 0x0B, 0xC6, 0xA1, 0x6C, 0xB5, 0xE6, 0x2A, 0x0E, 0x6C, 0x7B, 0xAD, 0x26, 0x3C,
+    0x8B, 0x9B, 0x88, 0x28, 0x0D, 0x83, 0x36, 0x09, 0x6B, 0x9F, 0xD5, 0x0C, 0x0A, 0x1D, 0x8A, 0xF0,
+    0x23, 0x51, 0xF5, 0xC6, 0xC3, 0x34, 0x2C, 0x50, 0xA1, 0x04, 0x06, 0xA2, 0xC8, 0x5B, 0x16, 0xB5,
+    0x82, 0xB9, 0x13, 0xF8, 0xE7, 0x7B, 0xC7, 0xA3, 0x1D, 0xB0, 0xD9, 0x33, 0x8D, 0x5F, 0x33, 0x71,
+    0x43, 0x60, 0x15, 0x51, 0x62, 0x10, 0xB5, 0x96, 0xE4, 0x4A, 0x18, 0x6F, 0x42, 0x6B, 0xFA, 0x7D,
+    0x70, 0x79, 0xAC, 0xC4, 0xD7, 0x67, 0x2A, 0xEE, 0xCC, 0xDF, 0xC1, 0x5D, 0x61, 0x91, 0x75, 0xF0,
+    0xD6, 0x65, 0xCD, 0x06, 0x6F, 0x26, 0xE2, 0x45, 0x50, 0xD9, 0x91, 0x7F, 0xA1, 0x26, 0x36, 0x07,
+    0xF0, 0x3F, 0xF6, 0x69, 0x8D, 0xF1, 0x3E, 0x8B, 0xEC, 0x60, 0x1E, 0x7B, 0x2C, 0x4D, 0x97, 0x7B,
+    0x4A, 0x59, 0x1B, 0x95, 0xFF, 0x74, 0x4A, 0x9A, 0x85, 0x10, 0xC6, 0x8A, 0xCB, 0x93, 0xA6, 0xC4,
+    0xEA, 0x9B, 0xCC, 0xE7, 0xDF, 0xD7, 0x4B, 0x7C, 0xFD, 0x55, 0xDE, 0xDE, 0x45, 0x14, 0x52, 0x22,
+    0x4B, 0x39, 0x14, 0xCC, 0x9A, 0x48, 0x89, 0x12, 0x51, 0x47, 0x44, 0xCD, 0x89, 0x03, 0x58, 0x4B,
+    0x9E, 0xF9, 0x5C, 0xB2, 0x27, 0x94, 0x2A, 0xB4, 0xB8, 0xC9, 0x3F, 0x20, 0x8C, 0xE5, 0x11, 0xE6,
+    0xA8, 0xF3, 0x56, 0x01, 0x89, 0x57, 0xA3, 0x4A, 0x52, 0xD5, 0x8E, 0x7D, 0x5A, 0xA8, 0x4A, 0xDE,
+    0x50, 0x2E, 0xAC, 0x60, 0x6B, 0x18, 0x97, 0xF6, 0x12, 0x8F, 0x95, 0x8A, 0x9A, 0xA5, 0x18, 0x50,
+    0x29, 0x80, 0x1F, 0x19, 0x50, 0xE9, 0x14, 0x95, 0xB2, 0x0E, 0x65, 0x77, 0x8F, 0xF5, 0x83, 0x9A,
+    0x91, 0x4E, 0x8D, 0x9B, 0x69, 0xF1, 0x74, 0x68, 0x6C, 0x78, 0x12, 0x1E, 0xDE, 0x0D, 0x2E, 0xC6,
+    0x9A, 0x96, 0x0C, 0x88, 0x9F, 0x38, 0x37, 0xCA, 0x52, 0xB8, 0xD4, 0x2B, 0x61, 0x3F, 0x7B, 0xA5,
+    0x24, 0x0A, 0x3E, 0xAC, 0x44, 0xD2, 0x32, 0x7E, 0x21, 0xBE, 0xC5, 0x77, 0x64, 0x95, 0xFD, 0x26,
+    0x8E, 0x57, 0x62, 0x5C, 0x8A, 0x7F, 0x2E, 0x35, 0x92, 0x68, 0x8D, 0x0A, 0xB7, 0x5E, 0x39, 0xA1,
+    0x3C, 0x42, 0x38, 0x90, 0xB0, 0xA5, 0x63, 0xEA, 0x8D, 0x80, 0x16, 0x2E, 0xEF, 0xB0, 0xAD, 0x23,
+    0xED, 0xA2, 0xC7, 0x92, 0xE5, 0x13, 0xF6, 0x55, 0x1E, 0x59, 0x0E, 0xA4, 0x49, 0xD1, 0x7F, 0x76,
+    0x56, 0xD9, 0x86, 0x31, 0xED, 0xB8, 0xB5, 0xA6, 0x39, 0xE5, 0x36, 0xEB, 0x76, 0xC6, 0xB1, 0x7D,
+    0xA7, 0x79, 0xC3, 0xE2, 0xA5, 0x71, 0xAB, 0x13, 0x59, 0xC6, 0xE7, 0xBF, 0x12, 0x95, 0x3D, 0xC1,
+    0x62, 0x45, 0x1C, 0x7F, 0x35, 0xD9, 0x53, 0xF6, 0xDA, 0x0E, 0xA8, 0x84, 0x30, 0x44, 0x2B, 0xA0,
+    0x68, 0x51, 0x4D, 0x0D, 0x49, 0xFB, 0xDB, 0x18, 0x25, 0x0D, 0x4D, 0x6C, 0x8F, 0xF5, 0x79, 0xAF,
+    0xE1, 0xB0, 0x71, 0x80, 0x96, 0x7C, 0xB0, 0x51, 0x07, 0x54, 0x57, 0x33, 0xF7, 0x89, 0xE2, 0x8B,
+    0x3F, 0x70, 0xC3, 0x58, 0x4C, 0xD4, 0xE7, 0x68, 0xC7, 0x32, 0x7E, 0xB3, 0xD2, 0xBC, 0x25, 0x5E,
+    0x2A, 0xE4, 0xAD, 0x95, 0x5E, 0x4E, 0x76, 0x59, 0x82, 0x7C, 0x99, 0x92, 0xEA, 0xDE, 0x0B, 0xB5,
+    0x65, 0x03, 0xF4, 0x6E, 0x62, 0xED, 0x4A, 0xB5, 0xA9, 0xCE, 0xB6, 0xE7, 0xD3, 0xC2, 0x65, 0xEA,
+    0x6C, 0xA2, 0x31, 0xC1, 0x28, 0x73, 0xED, 0x54, 0x7B, 0x29, 0x2F, 0x55, 0x6A, 0x82, 0x8D, 0x0E,
+    0x54, 0x45, 0x23, 0x72, 0xA6, 0xBD, 0x31, 0x5A, 0x74, 0xA5, 0x3A, 0x14, 0xD1, 0x47, 0x4B, 0xC6,
+    0x91, 0x2C, 0xC2, 0xCD, 0xB4, 0x98, 0x40, 0x8E, 0xF4, 0x75, 0x6B, 0xEB, 0x64, 0x4C, 0xE4, 0x9A,
+    0x0F, 0x14, 0xE5, 0x22, 0x0B, 0xA5, 0xE5, 0xF8, 0xEB, 0x1E, 0x99, 0xCC, 0x5D, 0x4D, 0x9A, 0x4D,
+    0x6A, 0x5D, 0x2B, 0x6D, 0x83, 0x47, 0x42, 0x28, 0x05, 0x7D, 0xE5, 0xCE, 0x36, 0xBC, 0x1E, 0x42,
+    0xC3, 0x41, 0x19, 0xE7, 0xF4, 0x23, 0x0A, 0xBE, 0xE5, 0x68, 0x9C, 0xC8, 0xC1, 0x38, 0x95, 0x2D,
+    0x71, 0x09, 0x39, 0x2A, 0x5A, 0x96, 0xFE, 0x52, 0x37, 0x69, 0xF2, 0x68, 0x6E, 0xB6, 0xB2, 0xA8,
+    0x5F, 0x8B, 0x58, 0xC4, 0x08, 0x52, 0xDF, 0x37, 0xB8, 0xA8, 0xB5, 0xE5, 0xF7, 0x85, 0x3C, 0xAF,
+    0xF3, 0x8C, 0x4A, 0xE3, 0xAC, 0x28, 0xE1, 0x65, 0xCC, 0xBF, 0x88, 0xC1, 0x3C, 0xC1, 0x5C, 0x3A,
+    0xD1, 0xEA, 0x04, 0xA6, 0x13, 0xAB, 0x78, 0xE2, 0x8D, 0x19, 0xD8, 0x6B, 0x38, 0x5E, 0x05, 0xD1,
+    0x48, 0xB5, 0x5B, 0x38, 0xFE, 0x0D, 0x79, 0x16, 0x83, 0xD8, 0xB4, 0x2F, 0xA8, 0xEF, 0x1D, 0xE8,
+    0xDE, 0x95, 0xA3, 0x74, 0x23, 0xBE, 0xA0, 0x2C, 0x45, 0x9D, 0x76, 0x97, 0x58, 0xE4, 0x4D, 0xDE,
+    0x2C, 0x30, 0xA4, 0xBE, 0x40, 0xF1, 0x91, 0xC7, 0xB0, 0x40, 0xFE, 0xD8, 0xE1, 0xC1, 0xC5, 0xC5,
+    0xC5, 0x0F, 0x94, 0xEB, 0xD9, 0xD9, 0xD9, 0x19, 0x6D, 0xE3, 0xAE, 0x78, 0xED, 0xB8, 0x15, 0x26,
+    0x03, 0xC0, 0xF6, 0x3F, 0x61, 0x1F, 0x7C, 0x3A, 0x94, 0x1D, 0xEF, 0xBA, 0x96, 0xC3, 0xC1, 0x9B,
+    0xC7, 0x34, 0x4B, 0x02, 0x5B, 0xB3, 0x9B, 0x3B, 0xF6, 0x62, 0xC7, 0xEB, 0x79, 0xC4, 0x11, 0x63,
+    0xF6, 0xFB, 0xBB, 0xD7, 0x9F, 0x9F, 0xAC, 0xB6, 0x87, 0xD2, 0x97, 0x9D, 0x6D, 0x12, 0xC5, 0xBF,
+    0x8D, 0x48, 0xF0, 0x4B, 0x3F, 0x59, 0x41, 0xBE, 0x25, 0xEE, 0xBC, 0x89, 0x84, 0x70, 0x69, 0xDB,
+    0xEC, 0x97, 0xD0, 0x14, 0x27, 0xE7, 0x6E, 0xD3, 0x56, 0x29, 0x73, 0x14, 0x3E, 0xA3, 0x43, 0x8B,
+    0x6F, 0x07, 0x2C, 0x4C, 0x93, 0xF8, 0x92, 0x2E, 0x18, 0xB0, 0xE6, 0xAD, 0xDC, 0x95, 0x6E, 0x4B,
+    0x87, 0xF8, 0xEC, 0x29, 0x2F, 0xCE, 0x64, 0x06, 0xA7, 0xDB, 0x2A, 0x7B, 0xBE, 0x62, 0x66, 0x1B,
+    0x73, 0xBF, 0xEC, 0xD1, 0x18, 0xDF, 0x57, 0xF8, 0x70, 0xFB, 0xB1, 0xA7, 0x89, 0x0B, 0x0A, 0x21,
+    0xE7, 0xE1, 0x2D, 0xC2, 0xE1, 0xE7, 0x77, 0x34, 0x75, 0xBB, 0xF9, 0x6F, 0x98, 0x30, 0x51, 0x49,
+    0xF3, 0xA7, 0xE7, 0xA5, 0xDD, 0x25, 0xAF, 0x90, 0xB5, 0x33, 0xD9, 0x05, 0xC9, 0xAE, 0x66, 0xB2,
+    0xBB, 0xFF, 0x22, 0x3B, 0x41, 0xBA, 0x3E, 0x64, 0xDD, 0xD2, 0xB8, 0xA5, 0xC5, 0x7A, 0x99, 0x0C,
+    0x0B, 0xD3, 0xAD, 0x43, 0xBD, 0xEF, 0x71, 0x88, 0x90, 0x76, 0x78, 0xB0, 0xB9, 0xDB, 0xF3, 0xC6,
+    0xB5, 0xC7, 0x19, 0xD2, 0x64, 0xD0, 0x43, 0x9C, 0x36, 0xA1, 0xB9, 0x1F, 0xA1, 0xCC, 0x77, 0x75,
+    0xA6, 0x19, 0x92, 0x5A, 0x38, 0x67, 0x77, 0xB3, 0xF8, 0xCB, 0x1A, 0x07, 0xA9, 0x50, 0xAC, 0xC5,
+    0x3C, 0x4D, 0x51, 0x57, 0xB1, 0x9F, 0x6E, 0xF7, 0x48, 0x6B, 0x5A, 0xE2, 0x80, 0xF5, 0x98, 0x73,
+    0xA6, 0xFE, 0xE6, 0xD7, 0xE0, 0x65, 0xE2, 0xF7, 0x94, 0xEE, 0xFA, 0x9C, 0xBB, 0xBD, 0x86, 0xE5,
+    0xFD, 0x87, 0xF8, 0x1F, 0xAF, 0x7F, 0x00, 0xB5, 0x55, 0x3D, 0xAF, 0xDC, 0x44, 0x14, 0x3D, 0xE3,
+    0x89, 0x32, 0x52, 0x46, 0x68, 0x5E, 0x11, 0x1A, 0xE0, 0x31, 0x6D, 0x0A, 0x12, 0xB7, 0x29, 0x76,
+    0xD7, 0x0E, 0x91, 0x40, 0x22, 0x0D, 0xFF, 0x20, 0x34, 0x34, 0x20, 0x01, 0x45, 0x0A, 0x8A, 0x7D,
+    0xBB, 0x4E, 0x9A, 0x57, 0x92, 0x92, 0x0E, 0x1A, 0x9A, 0x48, 0x7C, 0x14, 0x14, 0x8B, 0xB4, 0x79,
+    0x3B, 0x81, 0x82, 0x82, 0x22, 0x26, 0x14, 0x29, 0xD2, 0x58, 0x20, 0x94, 0x22, 0x52, 0xDE, 0x04,
+    0x0C, 0x38, 0x91, 0xF7, 0x0D, 0xE7, 0x7A, 0xDF, 0x26, 0xE1, 0x07, 0x60, 0x79, 0x77, 0xBD, 0xF6,
+    0xCC, 0xB9, 0xE7, 0xDC, 0x7B, 0xEE, 0x35, 0x20, 0x87, 0x5A, 0xA5, 0x06, 0xF9, 0x61, 0x2A, 0xB3,
+    0xD6, 0xBD, 0x0D, 0x57, 0x4E, 0x80, 0x25, 0x5A, 0xE8, 0x46, 0x07, 0xB8, 0xAA, 0x00, 0x72, 0x1D,
+    0x81, 0xE2, 0x88, 0x4B, 0xF3, 0xEB, 0x5C, 0xCE, 0x3F, 0xF0, 0x25, 0xBF, 0xE6, 0x15, 0x90, 0x71,
+    0x2F, 0xD2, 0x87, 0x2D, 0x7C, 0x65, 0x3B, 0x74, 0x30, 0xD1, 0xD4, 0xB0, 0xC1, 0x57, 0x98, 0xA1,
+    0xF8, 0xFD, 0x72, 0x44, 0x91, 0xB8, 0xF1, 0xD4, 0x13, 0x59, 0xFF, 0x22, 0x3F, 0x29, 0x00, 0xEF,
+    0x0B, 0xC2, 0x92, 0x1F, 0x46, 0x62, 0x3C, 0xC0, 0xF0, 0x66, 0x26, 0x37, 0x3B, 0x1B, 0x31, 0xF6,
+    0x47, 0x70, 0xFE, 0xB3, 0x60, 0x6E, 0xEB, 0x98, 0x1D, 0x12, 0x32, 0x95, 0x63, 0x14, 0x95, 0x87,
+    0x0F, 0x36, 0xD8, 0x9A, 0xB4, 0x22, 0xD9, 0x75, 0x98, 0x62, 0x0F, 0xF9, 0x2B, 0x39, 0xDC, 0xA1,
+    0x0D, 0x3A, 0xE9, 0x06, 0x42, 0xF0, 0x84, 0x08, 0x72, 0xC1, 0xC4, 0xAC, 0xC7, 0x19, 0x6C, 0x8E,
+    0x97, 0xA3, 0x5F, 0xC3, 0x93, 0x94, 0x6E, 0x54, 0xCB, 0xB8, 0x05, 0x55, 0x99, 0x9A, 0xF1, 0xBA,
+    0x8F, 0x26, 0x4B, 0xDF, 0xEB, 0x0E, 0xDB, 0x43, 0x74, 0xE6, 0xE4, 0x42, 0x24, 0xF5, 0x39, 0x9E,
+    0x3F, 0xBE, 0x0E, 0x30, 0x69, 0xC3, 0x5A, 0x16, 0x39, 0x2A, 0x1F, 0x6F, 0x52, 0x61, 0xC3, 0x46,
+    0x47, 0xBB, 0x91, 0x91, 0xF3, 0xB2, 0xE7, 0xA2, 0x9A, 0x39, 0x7A, 0x76, 0x99, 0x43, 0x55, 0x2D,
+    0x5C, 0xAA, 0x50, 0x30, 0xDA, 0x07, 0x92, 0x8C, 0xD3, 0xC0, 0xAA, 0xC1, 0xA9, 0x03, 0x6E, 0xE3,
+    0x82, 0xE9, 0x06, 0xA8, 0x1B, 0xF2, 0xA1, 0xE2, 0xAA, 0x3A, 0x57, 0xAC, 0xF5, 0xE1, 0xC5, 0xBA,
+    0x08, 0x63, 0x13, 0x6D, 0x58, 0xAA, 0xD6, 0x5E, 0x5D, 0x83, 0xA9, 0x74, 0x47, 0x50, 0x7F, 0x44,
+    0xE4, 0xAE, 0xD2, 0xCD, 0x01, 0xC6, 0xBA, 0x37, 0xB5, 0x3B, 0xA2, 0x26, 0x62, 0xEC, 0xE0, 0xB4,
+    0x5B, 0xBF, 0xB4, 0x26, 0xC7, 0x9E, 0x40, 0xAD, 0x8A, 0x59, 0x64, 0xB2, 0x6A, 0xC3, 0xB4, 0xB9,
+    0xE0, 0x2A, 0x5F, 0xE6, 0x94, 0x3E, 0xC1, 0xF8, 0xCC, 0xAC, 0x5D, 0x35, 0xF3, 0x72, 0x2B, 0x2D,
+    0x6F, 0x7C, 0x6D, 0x9B, 0x55, 0x5C, 0xC5, 0x79, 0xAB, 0x7F, 0xFD, 0xE7, 0xD1, 0xDF, 0xAD, 0xBE,
+    0x77, 0xED, 0xFE, 0xAD, 0x56, 0x3F, 0xCC, 0x0E, 0x55, 0x34, 0xBD, 0xEE, 0xB3, 0x68, 0xA3, 0x6E,
+    0x75, 0xE3, 0x1A, 0x13, 0x75, 0xED, 0x58, 0x04, 0xC3, 0x02, 0xF3, 0x37, 0x78, 0xD2, 0x75, 0x55,
+    0x4E, 0xA9, 0xEE, 0xAD, 0x09, 0x55, 0xFA, 0xD9, 0x98, 0x11, 0xF2, 0x6E, 0xCA, 0xEC, 0xF8, 0xFA,
+    0x59, 0xFA, 0x18, 0x43, 0x22, 0x10, 0x5F, 0xD0, 0xAF, 0x12, 0x5B, 0x90, 0x07, 0x5C, 0xA2, 0x0A,
+    0xA6, 0x20, 0x0E, 0x78, 0x44, 0x13, 0x2C, 0x7F, 0x40, 0x04, 0xE2, 0x3C, 0x43, 0x51, 0xA9, 0x46,
+    0x4A, 0x65, 0x71, 0xA1, 0x67, 0xE4, 0x9F, 0x5B, 0xCC, 0x0A, 0xE8, 0xFB, 0x35, 0xF6, 0x96, 0x30,
+    0xF7, 0x02, 0x96, 0x3D, 0xDC, 0x27, 0x21, 0x6B, 0x6F, 0x62, 0x66, 0xA2, 0x0F, 0x45, 0x8A, 0x58,
+    0xB1, 0x24, 0x5B, 0x95, 0x96, 0xCE, 0xCA, 0xD2, 0x3E, 0xDD, 0xD7, 0xFD, 0xC5, 0x95, 0x53, 0x4B,
+    0x2C, 0xFA, 0xC7, 0xD7, 0x34, 0x42, 0xCF, 0xEC, 0xE7, 0x62, 0x0F, 0x3A, 0x42, 0x78, 0x97, 0x46,
+    0x2E, 0x97, 0x7C, 0xEC, 0xEA, 0xBC, 0x62, 0xCC, 0x06, 0x9E, 0x58, 0x59, 0xDC, 0x01, 0xCE, 0x61,
+    0x53, 0x50, 0xA9, 0x3E, 0x08, 0x02, 0x9D, 0x18, 0xE5, 0xBD, 0x1B, 0x5B, 0x92, 0xF3, 0x3B, 0xB5,
+    0x4D, 0x09, 0x6B, 0xC6, 0x0B, 0xA6, 0x26, 0x18, 0x6D, 0xB6, 0x94, 0x5A, 0x51, 0xC9, 0xEB, 0x11,
+    0x3D, 0xEF, 0xC6, 0x82, 0x6E, 0xEE, 0xF5, 0x3A, 0xEB, 0xA6, 0xD1, 0xA4, 0x5F, 0x82, 0xED, 0x3C,
+    0x14, 0x16, 0x84, 0x6A, 0x36, 0xDD, 0x40, 0xE8, 0x8C, 0x46, 0x48, 0x3D, 0x4E, 0xDE, 0xF8, 0x7C,
+    0x93, 0xBD, 0xD9, 0xEA, 0x51, 0xCA, 0x7E, 0x3B, 0xD2, 0xF7, 0x4A, 0xFD, 0x10, 0xBA, 0x67, 0x97,
+    0xC1, 0x36, 0xF4, 0xB9, 0x18, 0x91, 0xAD, 0x98, 0x0F, 0x16, 0xE4, 0xB9, 0xB7, 0x61, 0xE1, 0xD9,
+    0x34, 0x3D, 0x63, 0xD2, 0x90, 0x34, 0x97, 0x26, 0x77, 0x3A, 0x7A, 0x15, 0xE0, 0x1B, 0x71, 0x6F,
+    0x16, 0xAF, 0xA8, 0x78, 0xA0, 0x9B, 0x79, 0x0A, 0x6C, 0x0C, 0x49, 0xD1, 0xA9, 0x41, 0xD8, 0x58,
+    0x6C, 0x78, 0x32, 0xAD, 0x8B, 0x24, 0xFE, 0xA1, 0xA1, 0x95, 0xAC, 0x15, 0x5A, 0x54, 0x4C, 0x1C,
+    0xA2, 0xD9, 0xB0, 0xE3, 0xAA, 0x6F, 0xDD, 0xDD, 0xE8, 0x52, 0x30, 0xEB, 0x6D, 0x7A, 0xF3, 0x88,
+    0xE9, 0x8A, 0xC9, 0xCB, 0xA2, 0x6A, 0x75, 0x54, 0xAC, 0x29, 0x9D, 0xC7, 0x46, 0x65, 0x4A, 0xC5,
+    0x2D, 0x81, 0x1E, 0x61, 0x65, 0x73, 0x56, 0x76, 0x5E, 0xE5, 0xEA, 0xC1, 0x9B, 0xC5, 0xA5, 0xDB,
+    0x5F, 0xE5, 0xC9, 0xF5, 0xAE, 0xA3, 0x88, 0xE3, 0x0A, 0xCD, 0xE1, 0xF7, 0x8F, 0xE8, 0xCF, 0x1E,
+    0xCB, 0x8C, 0xC6, 0x35, 0x35, 0xB7, 0x55, 0x34, 0x13, 0x39, 0x2C, 0x5C, 0x95, 0xC5, 0x29, 0xCC,
+    0x0F, 0x35, 0x3C, 0x69, 0x4E, 0xD8, 0x74, 0xE9, 0xB8, 0x0D, 0x9F, 0xEB, 0x50, 0xD5, 0x73, 0x6F,
+    0x3F, 0x6F, 0x2C, 0xCD, 0x2C, 0x36, 0x9F, 0x65, 0xE4, 0x42, 0x77, 0x95, 0x05, 0x85, 0x75, 0xA6,
+    0x35, 0x6C, 0x82, 0x55, 0xD9, 0xB1, 0x1A, 0x9D, 0x83, 0xB9, 0xF5, 0xE0, 0x5A, 0x83, 0xD1, 0x68,
+    0x3A, 0x82, 0xFE, 0x71, 0xFF, 0xA7, 0x0A, 0xE3, 0x38, 0xA6, 0x52, 0x7A, 0x9D, 0x83, 0x8E, 0x3B,
+    0xA8, 0x98, 0xC3, 0xEF, 0xB9, 0xC3, 0x36, 0xAA, 0xE7, 0x00, 0x98, 0x87, 0x77, 0x3B, 0xFF, 0x29,
+    0x1C, 0xA9, 0x60, 0x4F, 0x4A, 0x26, 0x33, 0x41, 0x26, 0x86, 0x92, 0x21, 0x52, 0xF0, 0xC2, 0x32,
+    0x2B, 0xEA, 0x4F, 0x72, 0x1B, 0xE5, 0xC8, 0x2E, 0x5F, 0x78, 0xFC, 0x4E, 0xD1, 0xB8, 0xC4, 0x11,
+    0x33, 0x2F, 0x4F, 0x3C, 0x05, 0x3B, 0xD9, 0xA2, 0x57, 0x29, 0x50, 0xFC, 0x4D, 0x12, 0x65, 0x8F,
+    0x36, 0x10, 0x92, 0x54, 0xCD, 0x82, 0x96, 0x84, 0x6D, 0x29, 0xCC, 0x5D, 0x25, 0xC8, 0x82, 0x35,
+    0xB1, 0xFB, 0x1C, 0x36, 0x1F, 0xF3, 0x8F, 0xF9, 0x92, 0x7B, 0x57, 0xFC, 0x63, 0xE3, 0x66, 0xB2,
+    0x0C, 0x53, 0x98, 0xB5, 0x51, 0x1C, 0x6B, 0x98, 0xF3, 0x86, 0x91, 0x11, 0x78, 0x6E, 0x1B, 0xA6,
+    0xB8, 0x3E, 0x72, 0xE9, 0x6E, 0xFD, 0x24, 0x75, 0xBB, 0x38, 0x00, 0xE5, 0x0F, 0x33, 0x76, 0x39,
+    0xCC, 0x28, 0x0E, 0x1B, 0x19, 0x5E, 0x7B, 0x82, 0xA1, 0x4D, 0xFA, 0xA2, 0x4D, 0x29, 0x5D, 0x7A,
+    0x43, 0x66, 0x79, 0xB9, 0xCD, 0xA6, 0xE9, 0xC5, 0x8D, 0x44, 0x1B, 0x0D, 0xE3, 0xE9, 0xE9, 0xB9,
+    0x18, 0xCE, 0x28, 0xEE, 0x67, 0x7C, 0x02, 0x91, 0x01, 0x93, 0x25, 0xEE, 0xA8, 0x64, 0x87, 0xDF,
+    0x9A, 0x69, 0x34, 0x9C, 0x93, 0xC1, 0x1F, 0x76, 0x68, 0x63, 0xCF, 0x27, 0x63, 0xDE, 0x1C, 0x11,
+    0x67, 0x41, 0x83, 0xD1, 0x2B, 0xAA, 0xC9, 0x1A, 0x49, 0xB6, 0x09, 0xA6, 0xB2, 0x25, 0x9D, 0x32,
+    0x2C, 0x3A, 0x7B, 0xBC, 0xE8, 0xF4, 0x46, 0x48, 0xA9, 0x52, 0x29, 0x40, 0x0B, 0x64, 0x8D, 0x84,
+    0x98, 0xFE, 0xE7, 0xB7, 0x42, 0x5E, 0x32, 0x81, 0x2C, 0x81, 0x17, 0xD7, 0x92, 0x8B, 0x17, 0xA2,
+    0xD4, 0x67, 0x86, 0xCB, 0x85, 0xDC, 0x9A, 0x08, 0x8B, 0xEF, 0x36, 0x89, 0x59, 0x95, 0x2F, 0x14,
+    0xE9, 0xE2, 0xFD, 0x3B, 0xA9, 0xBF, 0x92, 0x11, 0x58, 0x95, 0x7C, 0x6D, 0xC8, 0x3B, 0x83, 0x69,
+    0xDC, 0x91, 0xE7, 0x25, 0x1A, 0x9C, 0xC7, 0x2E, 0x6C, 0xC9, 0x8D, 0x71, 0x98, 0x0E, 0x6C, 0x61,
+    0x79, 0x63, 0xF4, 0x8C, 0x93, 0xD3, 0xCD, 0xD9, 0xB1, 0x6B, 0x19, 0x5E, 0x94, 0x8A, 0x57, 0x28,
+    0xD5, 0x54, 0x50, 0x47, 0x65, 0xC6, 0x29, 0x9D, 0x52, 0x2C, 0x5E, 0xDD, 0x75, 0xB7, 0xB8, 0xE7,
+    0x35, 0x4C, 0x34, 0xFB, 0xE0, 0x3C, 0xA6, 0xA6, 0xB4, 0xE1, 0x1B, 0xFA, 0x8F, 0xBD, 0xD4, 0x9C,
+    0x28, 0x76, 0xCD, 0xF7, 0xE9, 0x6E, 0x6B, 0xD9, 0x6B, 0xFE, 0x31, 0xEB, 0xCB, 0x92, 0x94, 0x92,
+    0x55, 0xF1, 0xB4, 0x22, 0xEA, 0x59, 0x08, 0xAF, 0xFF, 0xF9, 0xF8, 0x17, 0xB5, 0x55, 0x3D, 0x90,
+    0x14, 0x45, 0x18, 0xFD, 0x7A, 0x1A, 0x98, 0x92, 0x2E, 0xE9, 0xE4, 0xB0, 0xF8, 0xF1, 0x6E, 0x12,
+    0xA2, 0xAB, 0xBB, 0xDB, 0x84, 0x80, 0x60, 0x66, 0x67, 0x80, 0x80, 0xD0, 0x0B, 0x04, 0x03, 0xCA,
+    0x82, 0xC0, 0xC8, 0x2A, 0xC5, 0x80, 0x80, 0x60, 0xCF, 0x1D, 0x35, 0x30, 0xA0, 0xCA, 0xBB, 0x40,
+    0x4D, 0x4C, 0x8C, 0x2F, 0x39, 0x82, 0x0D, 0xB6, 0x64, 0xEF, 0xB6, 0x4B, 0x03, 0x03, 0x02, 0x1A,
+    0x08, 0x08, 0x0C, 0x18, 0xC0, 0x32, 0x90, 0xC0, 0xA6, 0x18, 0xAB, 0x06, 0x9C, 0xDD, 0xF6, 0x7D,
+    0xBD, 0x1C, 0x7A, 0x5A, 0x86, 0xCE, 0xD6, 0xF6, 0xF4, 0x4C, 0x77, 0x7F, 0xFD, 0xBE, 0xF7, 0xBD,
+    0xD7, 0x43, 0x14, 0xAE, 0x03, 0x1E, 0xCD, 0x18, 0x8D, 0xB2, 0xDB, 0x44, 0x3D, 0xAA, 0x49, 0x56,
+    0xD2, 0x50, 0x42, 0xFB, 0x88, 0x46, 0x18, 0x92, 0x15, 0x9A, 0xA4, 0x20, 0x3A, 0x38, 0xDD, 0x2C,
+    0x31, 0x71, 0x8A, 0xA7, 0x12, 0xAF, 0xD6, 0x78, 0xCC, 0xA1, 0xD1, 0xBB, 0x4F, 0x11, 0x9E, 0xA2,
+    0xAD, 0xAF, 0x2E, 0x0C, 0xB4, 0xF7, 0xDE, 0xE4, 0x5F, 0x8F, 0xA7, 0xF4, 0x2D, 0xED, 0x5E, 0xA7,
+    0x88, 0x96, 0xE5, 0x5D, 0xBF, 0x5E, 0xEA, 0xA9, 0xB7, 0xB4, 0x26, 0x6A, 0xD2, 0x85, 0x2E, 0x85,
+    0xA3, 0x21, 0x2D, 0xA0, 0x1B, 0x55, 0xE8, 0x76, 0xA8, 0x4B, 0x72, 0x72, 0xC9, 0x46, 0x7F, 0xF8,
+    0xDF, 0x8A, 0xE1, 0xC1, 0x8D, 0x54, 0x10, 0x09, 0xEA, 0x7B, 0xE1, 0x9F, 0xFB, 0x26, 0xF6, 0x76,
+    0x4A, 0x51, 0x2D, 0x1A, 0x80, 0xC1, 0xBE, 0x0D, 0x29, 0xA3, 0x01, 0xB3, 0x04, 0xC6, 0x5C, 0x5A,
+    0x3A, 0x3A, 0xC9, 0xDF, 0xA3, 0xFE, 0x0B, 0xC4, 0xBE, 0xE0, 0xCF, 0x13, 0xC5, 0x35, 0x60, 0x7A,
+    0x5F, 0x51, 0xEE, 0x91, 0x1A, 0x76, 0x43, 0x7E, 0x06, 0x4D, 0xCE, 0x58, 0x1A, 0xFC, 0xAF, 0x20,
+    0x8F, 0xD8, 0xB7, 0x01, 0x5B, 0x42, 0x2B, 0x94, 0x51, 0x8A, 0xDF, 0x35, 0xC0, 0xA9, 0xC9, 0x09,
+    0xF7, 0x0A, 0x37, 0x1D, 0x28, 0x54, 0x01, 0xA8, 0x7F, 0x9B, 0xD4, 0xA3, 0x39, 0xBC, 0x06, 0x00,
+    0x6F, 0xF5, 0xE9, 0x46, 0x17, 0x2B, 0xDA, 0xC6, 0xE7, 0x46, 0x14, 0xDD, 0x2A, 0xC9, 0x35, 0x94,
+    0x2A, 0xA3, 0x68, 0x5B, 0xB8, 0xD8, 0xE6, 0xD4, 0x93, 0xB5, 0x2E, 0x3A, 0x67, 0xAC, 0xA8, 0xAF,
+    0x52, 0xB2, 0x4C, 0xE2, 0xC9, 0x6B, 0x94, 0x83, 0x81, 0x7B, 0x2E, 0xAE, 0xC6, 0xDF, 0x54, 0x58,
+    0x4F, 0x87, 0x89, 0x8E, 0x88, 0x73, 0xD5, 0xCE, 0x8E, 0xBE, 0x5F, 0x0E, 0x89, 0x0E, 0x83, 0x67,
+    0x24, 0x0C, 0xCA, 0xF3, 0x8D, 0x8B, 0x15, 0x53, 0xAB, 0x4A, 0x24, 0x87, 0xAD, 0x07, 0x62, 0xA7,
+    0x18, 0x68, 0xF2, 0x8D, 0xFC, 0xDE, 0x66, 0xB2, 0x5C, 0x4A, 0xE3, 0xF2, 0xA4, 0x78, 0x6C, 0x06,
+    0x44, 0x87, 0x4E, 0x69, 0x2C, 0x7A, 0x56, 0x02, 0xB3, 0x4E, 0x35, 0x02, 0x3C, 0x36, 0xE0, 0x64,
+    0x61, 0x59, 0xFE, 0x7C, 0x24, 0x32, 0x55, 0xE2, 0x4D, 0xAA, 0x8A, 0x63, 0x1B, 0xAA, 0xC8, 0x50,
+    0x9D, 0x0A, 0xD9, 0xA1, 0xAA, 0xF2, 0xB9, 0xD8, 0xE1, 0xF4, 0xC1, 0x01, 0x09, 0xB0, 0x85, 0x84,
+    0x62, 0x6F, 0xD6, 0x3E, 0x96, 0x76, 0xB0, 0x20, 0xCD, 0x40, 0x4B, 0x33, 0xD4, 0xF1, 0x9D, 0xEE,
+    0xCD, 0xC1, 0xF8, 0x2D, 0xB3, 0x3A, 0xC7, 0xB4, 0xF9, 0x47, 0x3C, 0xF9, 0x88, 0x28, 0x95, 0x19,
+    0x49, 0x97, 0x53, 0x9B, 0x98, 0x7E, 0xEC, 0xB4, 0x6D, 0x69, 0xA2, 0x8D, 0x74, 0x5D, 0xD2, 0x9F,
+    0xD4, 0x94, 0xC6, 0x86, 0x36, 0xDE, 0xA4, 0x30, 0xDF, 0xDF, 0xF6, 0x1E, 0x88, 0x52, 0x80, 0x82,
+    0x4E, 0x40, 0x3D, 0x53, 0xFA, 0xFE, 0x66, 0xDF, 0x3F, 0xF1, 0x35, 0x89, 0x55, 0xAE, 0x8E, 0x45,
+    0x5A, 0x2B, 0x04, 0x5A, 0xEC, 0xEB, 0x79, 0xBD, 0xA4, 0xE4, 0xBA, 0xFC, 0xAC, 0x7C, 0x64, 0x6E,
+    0xD8, 0xAC, 0x5A, 0x3A, 0xA9, 0x9D, 0x3A, 0x24, 0xBF, 0x88, 0x7E, 0x30, 0x0F, 0xAB, 0xEA, 0xA3,
+    0xE9, 0xFC, 0x55, 0xCD, 0x0A, 0xAA, 0x41, 0xBD, 0xFA, 0x15, 0xD5, 0x3B, 0xB6, 0x41, 0x8B, 0x9B,
+    0xE7, 0x7C, 0xBB, 0xB8, 0xC9, 0xDA, 0x53, 0x13, 0xF2, 0x13, 0x55, 0x8E, 0x52, 0xAA, 0x9D, 0xBC,
+    0x67, 0x35, 0x20, 0x6A, 0x6F, 0x54, 0x13, 0xCA, 0xB7, 0x07, 0x40, 0x4A, 0x8B, 0x5B, 0x9B, 0xEB,
+    0x00, 0x76, 0xFE, 0xF7, 0xB7, 0xF7, 0x8E, 0xCC, 0xBD, 0xAC, 0xB6, 0xF4, 0xBE, 0xF5, 0x2C, 0x99,
+    0x2B, 0x25, 0x62, 0x6C, 0x27, 0x67, 0x4D, 0xB6, 0x0F, 0xE3, 0x28, 0xC4, 0x88, 0x1B, 0x16, 0x1F,
+    0x64, 0xDE, 0xF1, 0x35, 0x14, 0xCE, 0xF3, 0x3F, 0x2C, 0xF2, 0x89, 0xFA, 0xB4, 0xBA, 0xBC, 0x80,
+    0x40, 0xA2, 0x8E, 0x3C, 0x2D, 0x36, 0x04, 0x16, 0x7A, 0xE0, 0xE3, 0x62, 0x35, 0xAE, 0xC5, 0x97,
+    0x44, 0x45, 0x57, 0xDD, 0x69, 0xBA, 0xAA, 0x58, 0x7D, 0xB9, 0xC5, 0x10, 0x32, 0x8A, 0x2D, 0xA2,
+    0x24, 0x04, 0x01, 0x8F, 0x58, 0xF3, 0x5C, 0x16, 0x5D, 0x60, 0x5D, 0x06, 0x0F, 0x88, 0x99, 0xB8,
+    0x51, 0xF6, 0x9C, 0x7D, 0xD7, 0xE2, 0x27, 0x9D, 0xAA, 0x29, 0xA9, 0xBE, 0xFB, 0xC5, 0x8C, 0xFD,
+    0x8F, 0xD3, 0xE8, 0x41, 0xA3, 0xAD, 0x16, 0x30, 0x68, 0xCA, 0xF5, 0x73, 0xFF, 0xD2, 0xB6, 0x2C,
+    0x69, 0xCF, 0x25, 0xC6, 0x00, 0xDB, 0xF7, 0x13, 0x28, 0xF6, 0x16, 0xCB, 0x2B, 0x45, 0x9A, 0x0D,
+    0xF6, 0xF7, 0xF7, 0xD8, 0xD0, 0xF3, 0x78, 0x6A, 0x6F, 0x90, 0xF6, 0xCF, 0x0C, 0x12, 0x5B, 0xC7,
+    0x84, 0x09, 0xCC, 0xEA, 0x9F, 0x42, 0x76, 0x37, 0x6F, 0xB1, 0xBF, 0x79, 0x97, 0x53, 0xD8, 0x45,
+    0x60, 0x3A, 0xA9, 0x79, 0x26, 0xF5, 0x06, 0xB1, 0xCC, 0x20, 0xA1, 0x77, 0xD1, 0xC9, 0x1C, 0x09,
+    0x64, 0x4E, 0x9D, 0x1D, 0xA4, 0xD8, 0xB7, 0xBB, 0xBB, 0x26, 0xC9, 0x4F, 0x4F, 0xA1, 0xB6, 0x03,
+    0xA7, 0xA7, 0xB2, 0xCA, 0xD4, 0xE7, 0x15, 0x06, 0xE7, 0xE3, 0x89, 0x6A, 0x41, 0xCE, 0x68, 0xD7,
+    0x66, 0x51, 0x25, 0xED, 0xF1, 0xBA, 0xCF, 0x36, 0xDC, 0x4F, 0xC2, 0x97, 0x9D, 0x4B, 0x85, 0x5B,
+    0x51, 0xE5, 0x30, 0x93, 0x95, 0x83, 0x0A, 0x47, 0xFA, 0xBA, 0x49, 0x5A, 0xDA, 0xCF, 0xAE, 0xE8,
+    0xF8, 0x87, 0x90, 0x60, 0x44, 0x97, 0x59, 0x66, 0xC2, 0x75, 0x40, 0x5E, 0x43, 0x7D, 0x55, 0x49,
+    0xD7, 0x87, 0x06, 0x6D, 0x7E, 0xD6, 0x29, 0xD3, 0x46, 0x50, 0xE2, 0x89, 0xB8, 0xD8, 0x93, 0xFD,
+    0x09, 0xA2, 0x0F, 0x88, 0x4F, 0x36, 0xE8, 0x84, 0xB0, 0xED, 0x81, 0xD1, 0xEC, 0x50, 0xEB, 0xCD,
+    0x68, 0x1B, 0xB2, 0xFF, 0x03, 0x6F, 0x59, 0x18, 0xE6, 0x17, 0xA8, 0x38, 0x68, 0xCD, 0xF0, 0x87,
+    0x3C, 0x5A, 0xB8, 0x46, 0x17, 0xB2, 0x95, 0xAC, 0x57, 0xDD, 0x4B, 0x1A, 0xAC, 0xCC, 0xAE, 0x01,
+    0xB3, 0xA3, 0x1A, 0xF6, 0x93, 0x56, 0x5A, 0xC7, 0xA1, 0x74, 0xE1, 0x38, 0x54, 0xCE, 0x46, 0xC9,
+    0x66, 0x37, 0x04, 0x8D, 0x6C, 0x38, 0x17, 0x11, 0x27, 0xB6, 0xB3, 0xDB, 0x3F, 0x8A, 0xF3, 0xEA,
+    0xB2, 0x01, 0x27, 0x26, 0x33, 0x4E, 0x4C, 0x66, 0x9C, 0x6C, 0xE7, 0x1E, 0xDB, 0x3F, 0xC0, 0xEA,
+    0xCD, 0x70, 0xBA, 0x80, 0x93, 0x8F, 0x05, 0x74, 0xE3, 0x32, 0xA9, 0x81, 0x53, 0xD3, 0x98, 0x71,
+    0xA6, 0x51, 0xDD, 0xC5, 0xC0, 0x40, 0x9A, 0x95, 0xA4, 0x61, 0x65, 0x64, 0xFD, 0x56, 0xCE, 0x92,
+    0x44, 0x28, 0x06, 0x82, 0x50, 0x50, 0x1D, 0x87, 0xEA, 0x86, 0x30, 0x7C, 0x34, 0x82, 0x0D, 0x66,
+    0x42, 0x71, 0xFD, 0x1B, 0x66, 0x23, 0x81, 0x47, 0xE7, 0xFF, 0x03, 0x26, 0x49, 0xCC, 0x6C, 0xC2,
+    0x22, 0xED, 0xCB, 0x80, 0xF7, 0x4C, 0x15, 0x54, 0x58, 0x0C, 0x03, 0x7F, 0xAC, 0x4A, 0xF4, 0xC4,
+    0x28, 0xEC, 0x22, 0x7D, 0x78, 0x41, 0xEF, 0x80, 0x4F, 0xC6, 0xDC, 0xC3, 0x71, 0x2F, 0xF9, 0xA8,
+    0xD7, 0x24, 0x5B, 0xE8, 0x1B, 0xB7, 0x07, 0x6F, 0x8C, 0x4B, 0x55, 0xC8, 0xFB, 0xD7, 0xA7, 0xB0,
+    0x80, 0xBC, 0x6B, 0x57, 0x41, 0x53, 0xE0, 0x94, 0xA9, 0x4D, 0xF9, 0xD4, 0x92, 0x7C, 0x92, 0x63,
+    0x0B, 0x0F, 0x78, 0xBC, 0x05, 0x48, 0x0D, 0x42, 0x77, 0xB3, 0x4F, 0x14, 0xE6, 0x2C, 0xED, 0xC5,
+    0x58, 0xE0, 0x83, 0xA4, 0x2D, 0x9C, 0x23, 0xF8, 0xE9, 0x28, 0xC5, 0x0D, 0x6D, 0xB1, 0x2B, 0x13,
+    0x76, 0x5E, 0x4D, 0xDB, 0xE8, 0x04, 0x2C, 0xB0, 0xDC, 0x5A, 0x74, 0xD6, 0x37, 0xDA, 0x53, 0xA7,
+    0x0C, 0xEB, 0x70, 0x2D, 0x87, 0x2C, 0xC3, 0xF1, 0xD1, 0xA9, 0x42, 0x1B, 0x4A, 0x36, 0xF7, 0x57,
+    0xF8, 0x60, 0xE5, 0x60, 0xB7, 0x38, 0x7C, 0x29, 0x3C, 0xAF, 0x5B, 0x09, 0xD6, 0xBB, 0xCD, 0x4E,
+    0xAC, 0x19, 0x55, 0xC2, 0x9C, 0x4A, 0xCB, 0x5F, 0xC6, 0x11, 0xEB, 0x4D, 0x33, 0xE3, 0xC8, 0x05,
+    0x2B, 0xBA, 0xE7, 0xFB, 0x78, 0xF6, 0x7C, 0x12, 0xBE, 0xD8, 0xDC, 0x2A, 0x31, 0x20, 0xD8, 0xF2,
+    0x5C, 0x19, 0x64, 0xD7, 0x82, 0x1D, 0xA0, 0x3F, 0xFE, 0x1C, 0xDF, 0xE6, 0xFB, 0xDE, 0x09, 0x3F,
+    0xA1, 0xFF, 0xE3, 0xFA, 0x13, 0xC5, 0x55, 0xBB, 0x6E, 0xDB, 0x40, 0x10, 0xDC, 0x3B, 0x5A, 0x66,
+    0xC1, 0x82, 0x2E, 0x5C, 0x04, 0x30, 0x02, 0x36, 0xA9, 0xCD, 0x26, 0xA5, 0x25, 0x31, 0x75, 0x1A,
+    0x37, 0x76, 0x4A, 0xE7, 0x0F, 0xD4, 0xA6, 0xB1, 0xC5, 0x3F, 0x88, 0xBF, 0xC3, 0x4D, 0x1A, 0x17,
+    0x29, 0x28, 0x90, 0x7F, 0x10, 0x76, 0x2E, 0x43, 0x04, 0x49, 0x1D, 0x02, 0x61, 0x02, 0x2A, 0xA0,
+    0x7C, 0x99, 0xD9, 0x93, 0x6C, 0xCB, 0x75, 0x60, 0x1F, 0xA0, 0x13, 0xA9, 0xDB, 0xC7, 0xEC, 0xCE,
+    0xEC, 0x49, 0x44, 0x64, 0x07, 0x1F, 0x09, 0x2B, 0x6C, 0xC1, 0x80, 0xCD, 0xBA, 0x0C, 0x7B, 0x99,
+    0x63, 0x1B, 0xC9, 0xFD, 0x3A, 0xE6, 0x36, 0x55, 0xD3, 0x96, 0xBB, 0x5A, 0x1D, 0xF6, 0xF4, 0xFA,
+    0x42, 0xDF, 0xAE, 0xC0, 0x96, 0x44, 0x78, 0x0C, 0xEA, 0x73, 0x3C, 0x16, 0x41, 0x23, 0x12, 0xCB,
+    0x04, 0x01, 0x9B, 0x00, 0x1E, 0x93, 0x93, 0x39, 0xDE, 0x9D, 0xEB, 0xC4, 0xFC, 0xBD, 0xFA, 0x94,
+    0xE3, 0xC0, 0xF4, 0x02, 0xF3, 0xB8, 0x92, 0x4E, 0x64, 0x90, 0x14, 0xA7, 0xF5, 0xC1, 0x52, 0x76,
+    0xDD, 0x8D, 0x6B, 0x8D, 0x5B, 0x21, 0x84, 0x61, 0x0A, 0x59, 0x69, 0x62, 0xE6, 0x8C, 0x3F, 0x22,
+    0x7A, 0xD8, 0x8C, 0x99, 0x4D, 0xAA, 0xE7, 0x44, 0xA6, 0x2B, 0xA9, 0x6A, 0x84, 0x74, 0x0C, 0xF9,
+    0xD9, 0x11, 0x99, 0x4F, 0xFF, 0xAC, 0x3D, 0x33, 0xD9, 0x3E, 0xE2, 0x5C, 0x84, 0x8C, 0xD3, 0xDC,
+    0x32, 0x64, 0x54, 0x6D, 0x63, 0x52, 0x4E, 0x03, 0x85, 0x33, 0xE7, 0x16, 0x77, 0xE4, 0xFC, 0x27,
+    0xE9, 0x3E, 0x22, 0xFD, 0xF1, 0x5B, 0x38, 0x98, 0x96, 0xC8, 0xC6, 0x21, 0x0A, 0x8C, 0x2A, 0xC0,
+    0x91, 0x96, 0xC8, 0x0E, 0x59, 0x4B, 0xF0, 0xE3, 0x1D, 0x9C, 0x9D, 0x43, 0x2D, 0xC9, 0xD5, 0x55,
+    0x2F, 0x38, 0x48, 0x72, 0x29, 0x08, 0x27, 0xCE, 0x80, 0xCC, 0xE2, 0x74, 0x65, 0xCA, 0x4B, 0x99,
+    0xAD, 0xE6, 0x4E, 0x12, 0x57, 0x6F, 0x72, 0x86, 0x84, 0x23, 0xBF, 0x99, 0xF9, 0x65, 0x88, 0x46,
+    0xD8, 0xFA, 0x9A, 0xD5, 0x9F, 0xF1, 0xD7, 0xB2, 0xBA, 0x6B, 0xD7, 0x73, 0xE0, 0x5B, 0xAF, 0x00,
+    0x5E, 0x08, 0x23, 0x33, 0x76, 0x1C, 0x91, 0x07, 0xA1, 0xD4, 0x42, 0x07, 0x4A, 0x70, 0xF8, 0x35,
+    0x0F, 0x00, 0x22, 0xB8, 0x51, 0x07, 0xFB, 0x4D, 0x11, 0x5A, 0xC5, 0x01, 0x38, 0xD3, 0x11, 0xC1,
+    0x77, 0xB1, 0x23, 0xC4, 0x3E, 0x54, 0x91, 0x2C, 0x4E, 0x7D, 0x15, 0xFA, 0x9B, 0x8C, 0x4F, 0xB4,
+    0x9C, 0xB1, 0xC4, 0xB9, 0xE4, 0x80, 0x0A, 0xEC, 0xD7, 0x20, 0x10, 0x70, 0x8E, 0x24, 0x21, 0xBA,
+    0x99, 0xA4, 0xBD, 0x25, 0xEE, 0xE9, 0x2D, 0x81, 0xB0, 0x23, 0x23, 0xB4, 0x29, 0x05, 0x96, 0x14,
+    0xAF, 0x51, 0x67, 0x06, 0xDB, 0x63, 0x4E, 0x2F, 0x20, 0x37, 0x08, 0x20, 0xB2, 0xDD, 0x5A, 0x5C,
+    0x2C, 0x5D, 0x28, 0x1F, 0xA5, 0xBA, 0xD8, 0x3C, 0x2C, 0xF8, 0xD0, 0xF8, 0x36, 0xEE, 0x60, 0xB2,
+    0x6D, 0x9D, 0x2C, 0x4F, 0x07, 0xC0, 0x01, 0x0F, 0x25, 0xB9, 0xD8, 0x63, 0x01, 0x54, 0xA4, 0xC3,
+    0x67, 0x97, 0x58, 0xD3, 0xF5, 0x45, 0xA0, 0xED, 0x7F, 0xA5, 0x3D, 0xD1, 0xCB, 0xE1, 0x03, 0x2D,
+    0x59, 0x45, 0x38, 0x6C, 0x9E, 0x3C, 0x59, 0xEB, 0x55, 0xA2, 0x61, 0xA6, 0x24, 0xE6, 0x73, 0xD4,
+    0xA2, 0x25, 0x01, 0x61, 0x4D, 0x21, 0xA3, 0x1B, 0xF4, 0xAB, 0x35, 0xFA, 0x1E, 0x89, 0x69, 0xD8,
+    0xE7, 0x8C, 0xA4, 0x78, 0x8C, 0x56, 0x47, 0xBB, 0x92, 0xF7, 0x30, 0x0F, 0x2A, 0xD3, 0x21, 0x42,
+    0x54, 0x8F, 0xB4, 0x15, 0x15, 0x0A, 0x77, 0x9A, 0x81, 0x30, 0x63, 0x8A, 0x86, 0x8D, 0x9D, 0xA3,
+    0xAA, 0x90, 0x61, 0xF7, 0xE5, 0x29, 0x41, 0x30, 0x5B, 0xC0, 0x40, 0x53, 0x74, 0x3E, 0xF8, 0x05,
+    0x8F, 0xA9, 0x6D, 0x38, 0xA9, 0xD9, 0xD3, 0x81, 0xD8, 0x41, 0x27, 0xCC, 0x40, 0xFA, 0xDB, 0x12,
+    0xC3, 0xF3, 0xA6, 0x7B, 0x74, 0xE3, 0xC0, 0x6C, 0x45, 0xFD, 0xB6, 0x92, 0x64, 0x60, 0xB2, 0x80,
+    0x74, 0x41, 0xE6, 0x6B, 0x8A, 0x4E, 0x14, 0x84, 0x51, 0x65, 0x57, 0xA0, 0x75, 0xEA, 0x7A, 0x82,
+    0xA8, 0x85, 0x97, 0x85, 0xA4, 0xD9, 0x5A, 0x3B, 0x30, 0x7F, 0x41, 0xF3, 0x16, 0x15, 0x84, 0x95,
+    0xED, 0xCC, 0x05, 0x8B, 0x6A, 0xA3, 0xB5, 0x24, 0x61, 0x50, 0x01, 0x01, 0xDC, 0x6B, 0xFD, 0xB2,
+    0xF7, 0x95, 0x67, 0x07, 0xB7, 0x19, 0x75, 0x98, 0x6A, 0x11, 0xD4, 0x50, 0x2F, 0x0F, 0xDE, 0x1B,
+    0xCD, 0xBD, 0x78, 0xF4, 0x5E, 0xE0, 0xFF, 0xA6, 0xB3, 0xFE, 0x52, 0xCD, 0x38, 0xC2, 0x92, 0x34,
+    0x12, 0x0F, 0x12, 0x2C, 0x37, 0x0A, 0x5C, 0x07, 0xDF, 0x75, 0x97, 0xDA, 0xBC, 0x42, 0xBD, 0x31,
+    0x2F, 0x04, 0xC9, 0x08, 0xA9, 0xD7, 0xEB, 0xC4, 0xF7, 0x76, 0xE1, 0xD5, 0xBF, 0x75, 0x9C, 0xBA,
+    0x2C, 0xD2, 0x89, 0x06, 0x83, 0x18, 0x21, 0xCC, 0x99, 0xD8, 0x3F, 0x98, 0x2A, 0xDB, 0x9A, 0xC6,
+    0xE6, 0x0F, 0x72, 0x98, 0xF2, 0xBB, 0x22, 0x26, 0x11, 0x4C, 0x32, 0xF5, 0xA4, 0x31, 0x2E, 0x47,
+    0x63, 0xF0, 0xB3, 0x96, 0x64, 0x9A, 0x66, 0x63, 0x34, 0xF1, 0x4D, 0x45, 0x56, 0xAB, 0xA3, 0x5A,
+    0xF3, 0x0E, 0x3B, 0x16, 0x90, 0x14, 0xB6, 0x73, 0xA0, 0xE8, 0xB7, 0xF9, 0xA9, 0x65, 0xB6, 0xF4,
+    0x31, 0x0A, 0x0F, 0x7C, 0x3B, 0xC6, 0x56, 0xCE, 0x07, 0x46, 0xF9, 0x1D, 0xB0, 0x72, 0x25, 0xBE,
+    0x9A, 0xFF, 0xB1, 0xFE, 0x01, 0xCD, 0x55, 0xBB, 0x6E, 0x14, 0x31, 0x14, 0x3D, 0x63, 0x13, 0x8D,
+    0xC4, 0x14, 0x4E, 0x01, 0x55, 0x8A, 0x69, 0xA8, 0x99, 0x86, 0x32, 0xBB, 0x1E, 0xC1, 0x0F, 0xA4,
+    0xE1, 0x5F, 0x28, 0x36, 0xD9, 0x11, 0x5F, 0xC0, 0x9F, 0xD0, 0x52, 0x6C, 0xB2, 0x43, 0xF8, 0x81,
+    0xE9, 0x69, 0x46, 0xA2, 0xA0, 0x88, 0x44, 0x2C, 0x65, 0x8B, 0x41, 0xF2, 0xAE, 0x73, 0xCE, 0x24,
+    0x9B, 0x07, 0xD0, 0xC2, 0x62, 0x8D, 0xAE, 0x3C, 0xBE, 0xB6, 0xEF, 0xF1, 0xF1, 0x3D, 0xD7, 0xC0,
+    0xF3, 0x23, 0xA0, 0x4C, 0xA9, 0x83, 0x4B, 0x1F, 0x13, 0xBB, 0x75, 0x19, 0x50, 0xB4, 0x48, 0xB0,
+    0x01, 0xAE, 0xC3, 0x00, 0x33, 0xE0, 0x18, 0x98, 0xD3, 0x03, 0xD7, 0xD2, 0x63, 0x43, 0x4A, 0x43,
+    0x36, 0xF8, 0xB4, 0xC6, 0x89, 0x3C, 0x55, 0x5D, 0xDD, 0x7A, 0xF2, 0x9E, 0x6B, 0xF8, 0x0D, 0xB0,
+    0x2B, 0x7A, 0x68, 0xAA, 0xFA, 0x60, 0x85, 0x65, 0x4A, 0x3D, 0xCD, 0xA6, 0xC6, 0x2F, 0xED, 0xAC,
+    0x90, 0x5D, 0x7E, 0x6F, 0x69, 0x27, 0xF3, 0x9E, 0xF6, 0x69, 0xD1, 0xE3, 0x4F, 0x6D, 0xD9, 0xC1,
+    0x27, 0x14, 0x03, 0x8A, 0x35, 0x7F, 0x80, 0x43, 0x86, 0xED, 0x51, 0x02, 0x2E, 0x0A, 0xAC, 0xBD,
+    0xAC, 0x6D, 0x8F, 0xEC, 0x2A, 0x60, 0x05, 0x2C, 0x4E, 0xE5, 0x9E, 0xBA, 0x56, 0xEE, 0xD7, 0x2B,
+    0xB9, 0xDB, 0xA9, 0xDC, 0xA1, 0x68, 0xE5, 0xCE, 0x06, 0xB9, 0xE1, 0xE5, 0xAE, 0xF3, 0x8B, 0x86,
+    0x6E, 0x24, 0xB9, 0x51, 0xCA, 0x0D, 0x1B, 0x91, 0x2D, 0x09, 0x18, 0x59, 0x8A, 0x70, 0xCD, 0x3D,
+    0x88, 0x7D, 0x99, 0x77, 0x32, 0x1B, 0x99, 0xB9, 0x60, 0x17, 0x41, 0xDD, 0xA3, 0xED, 0x94, 0x3D,
+    0xF6, 0x4C, 0xDA, 0x8C, 0x8C, 0xB6, 0x58, 0xD6, 0x2E, 0x18, 0x91, 0x91, 0x73, 0xFB, 0xE8, 0x38,
+    0x3F, 0x92, 0x2A, 0x44, 0xCF, 0x99, 0xF1, 0x44, 0xE6, 0xF4, 0xCE, 0x44, 0x20, 0x1B, 0x68, 0xCC,
+    0x8A, 0x27, 0xB4, 0x81, 0x63, 0x45, 0x37, 0xE7, 0x3E, 0x8D, 0xAF, 0xC5, 0x7D, 0x9F, 0x47, 0xE4,
+    0xE2, 0x11, 0x4B, 0x05, 0xCF, 0x6E, 0xB8, 0xCC, 0x64, 0xCA, 0x91, 0x20, 0x0E, 0xE4, 0xF2, 0x94,
+    0x22, 0xF0, 0x19, 0x76, 0x04, 0x48, 0x44, 0xF0, 0xDA, 0xC9, 0x2C, 0x17, 0xC1, 0x6B, 0xDF, 0x81,
+    0x14, 0x9A, 0xCE, 0xD6, 0xBB, 0x01, 0xA4, 0xE6, 0xDF, 0xB0, 0x9F, 0xBE, 0x36, 0x4C, 0x10, 0x26,
+    0x38, 0xDA, 0xF5, 0xA3, 0xD4, 0xFA, 0xB7, 0x80, 0xF6, 0x79, 0x65, 0x59, 0x2C, 0x5B, 0x98, 0x58,
+    0xD1, 0x84, 0x6A, 0x87, 0x58, 0x28, 0x93, 0x43, 0x8F, 0x85, 0x3B, 0x0F, 0xF6, 0x42, 0x82, 0xC7,
+    0x19, 0x83, 0x37, 0xC5, 0x97, 0xBE, 0xC2, 0x30, 0xC3, 0x64, 0x1F, 0x4F, 0x38, 0xE7, 0xAD, 0xD2,
+    0x7E, 0x9E, 0xDE, 0x77, 0xC2, 0xF4, 0x03, 0x66, 0x0D, 0x0A, 0xB5, 0x6A, 0xE0, 0xEB, 0x8C, 0xD0,
+    0x12, 0x85, 0x8F, 0x69, 0xC4, 0x29, 0xEC, 0xB7, 0x40, 0xE5, 0x4F, 0xA8, 0xBA, 0xC6, 0x76, 0x9E,
+    0x03, 0x13, 0x44, 0xB3, 0xB2, 0x9D, 0x0D, 0xAE, 0x3D, 0x16, 0x8E, 0xBC, 0xE3, 0xE0, 0x7A, 0x46,
+    0x70, 0x86, 0x67, 0xAB, 0x6A, 0x22, 0xE2, 0x0E, 0x8E, 0x9B, 0xF1, 0xA4, 0xC2, 0x57, 0x5C, 0xA6,
+    0xD4, 0xE0, 0xF0, 0x20, 0x8D, 0x25, 0xA0, 0xBE, 0x97, 0x5C, 0x3E, 0x6A, 0xF0, 0x6C, 0xEC, 0x46,
+    0xDC, 0x89, 0x6E, 0xEF, 0x11, 0x75, 0x3E, 0x35, 0x2E, 0x9D, 0xAB, 0xD0, 0xA8, 0x08, 0x51, 0xCC,
+    0x53, 0x29, 0x83, 0xCC, 0x99, 0xA0, 0x22, 0x35, 0x1D, 0xCB, 0x44, 0x07, 0xAE, 0x9F, 0x49, 0xD4,
+    0x79, 0x9B, 0x31, 0x4D, 0x3F, 0x41, 0xA5, 0xAB, 0xE1, 0x14, 0x16, 0x0E, 0xAF, 0x05, 0x5C, 0xCB,
+    0x3F, 0xAF, 0x05, 0xEC, 0xE6, 0xED, 0xCD, 0x39, 0xCD, 0x26, 0x63, 0x78, 0x27, 0x7C, 0xA8, 0xD2,
+    0x87, 0x07, 0xC1, 0x47, 0x05, 0x66, 0x61, 0x2B, 0x41, 0x8C, 0x55, 0x6C, 0xD4, 0x60, 0x56, 0xFF,
+    0x0F, 0xF8, 0xC6, 0xCA, 0xE4, 0xEB, 0xAD, 0x22, 0xED, 0x95, 0xA0, 0x46, 0x55, 0xB5, 0x97, 0x78,
+    0xB5, 0x7B, 0x7C, 0x92, 0x03, 0xCA, 0xCF, 0x4A, 0x5C, 0xE9, 0x01, 0x95, 0x09, 0xBF, 0xD5, 0x7E,
+    0x9B, 0x06, 0xA4, 0x58, 0x6D, 0x50, 0x6C, 0x6E, 0x63, 0x8C, 0xC5, 0x9A, 0x02, 0xA8, 0xC0, 0xA4,
+    0xE2, 0xDF, 0x82, 0xCF, 0x87, 0x12, 0x91, 0xE1, 0x06, 0xE1, 0xE3, 0x4B, 0x55, 0x34, 0x86, 0xF8,
+    0x06, 0x4E, 0x61, 0x91, 0xBF, 0x39, 0x90, 0xD7, 0x02, 0x3D, 0x50, 0xBD, 0xBA, 0x33, 0xD5, 0xA9,
+    0xB2, 0xE1, 0x33, 0x72, 0xC0, 0xDB, 0xE2, 0x8B, 0x26, 0xE5, 0xFD, 0x7C, 0x50, 0xCC, 0x95, 0xFC,
+    0x24, 0x89, 0x17, 0x29, 0xC5, 0x38, 0x25, 0x9E, 0x17, 0xF2, 0x17, 0x8F, 0x59, 0x6B, 0xD3, 0x9A,
+    0xD0, 0xE6, 0x2B, 0xBD, 0x96, 0x8D, 0x55, 0x14, 0x9E, 0x97, 0x80, 0xA2, 0xF8, 0x59, 0x30, 0x16,
+    0xA6, 0x64, 0x6E, 0x7C, 0x6D, 0x50, 0x4A, 0xAA, 0x6E, 0xD8, 0x66, 0x70, 0xD1, 0xC9, 0xE8, 0x15,
+    0x71, 0xA3, 0x51, 0x9A, 0x97, 0xBA, 0x2A, 0x15, 0x05, 0x23, 0x44, 0x4E, 0xE6, 0xAF, 0xB6, 0x6B,
+    0xAD, 0x55, 0x3D, 0xAF, 0xDC, 0x44, 0x14, 0x3D, 0xF6, 0x28, 0x6F, 0x22, 0x59, 0x30, 0x29, 0x52,
+    0x20, 0xF1, 0x90, 0x29, 0x29, 0x60, 0x4D, 0x41, 0xC9, 0xDA, 0x8E, 0x9E, 0x94, 0x02, 0x9A, 0xFC,
+    0x03, 0x7A, 0x9A, 0x47, 0x99, 0x62, 0x3F, 0x1C, 0xBD, 0x1F, 0x10, 0xFA, 0x34, 0xFC, 0x03, 0x28,
+    0x52, 0xEE, 0xDB, 0x9D, 0x24, 0x7F, 0x60, 0xA0, 0x7D, 0x8D, 0xA1, 0xA1, 0x40, 0x4A, 0x06, 0x69,
+    0x00, 0x07, 0xEC, 0x1D, 0xCE, 0x5D, 0x67, 0xB3, 0x4F, 0xA2, 0x42, 0x6F, 0xAD, 0xF5, 0xD8, 0x3B,
+    0x63, 0x9F, 0x7B, 0xE6, 0xDE, 0x73, 0x8F, 0x01, 0x1E, 0x59, 0xF4, 0xC0, 0x79, 0xC7, 0xBB, 0x99,
+    0xFC, 0x73, 0x1C, 0x62, 0x6C, 0x60, 0x7E, 0x8B, 0x40, 0x48, 0x3B, 0xE4, 0x30, 0x36, 0xF5, 0x58,
+    0xA1, 0x42, 0x66, 0x55, 0x8B, 0x1E, 0x73, 0xE4, 0x75, 0x66, 0x35, 0xE7, 0x4E, 0x7A, 0x98, 0x38,
+    0xF0, 0x85, 0xD7, 0xE0, 0x1C, 0xC0, 0xE7, 0x90, 0xC6, 0x16, 0xD8, 0x44, 0x8C, 0xC7, 0xD7, 0x32,
+    0x14, 0x91, 0x6B, 0xEA, 0xF5, 0x46, 0x6E, 0xF9, 0x36, 0x92, 0x80, 0x00, 0x41, 0xB3, 0x40, 0x89,
+    0xC9, 0x6E, 0xC2, 0xCB, 0x84, 0xE1, 0x13, 0x15, 0x9E, 0x72, 0xEC, 0x74, 0xC3, 0x57, 0xDC, 0x94,
+    0xB7, 0x39, 0x43, 0x02, 0x2B, 0x52, 0x81, 0x6A, 0x15, 0x47, 0xD3, 0x28, 0xBE, 0x3E, 0x87, 0xF2,
+    0x48, 0xBC, 0x30, 0xCE, 0xAC, 0x44, 0x2F, 0x6F, 0xCB, 0x0E, 0x42, 0xA7, 0x1C, 0xF4, 0x0B, 0x61,
+    0x55, 0xA4, 0x91, 0x01, 0x7A, 0xDC, 0x11, 0x24, 0xEC, 0x90, 0x18, 0x0A, 0xB2, 0x55, 0xF3, 0xC4,
+    0x4A, 0xA8, 0x41, 0x66, 0x27, 0x0D, 0xF6, 0x47, 0x26, 0x4B, 0x5C, 0x31, 0x7C, 0x9C, 0xE8, 0x8C,
+    0xCA, 0xF3, 0xF4, 0xED, 0x32, 0xF2, 0xF0, 0x94, 0x5B, 0xF3, 0x69, 0x57, 0xB4, 0xDA, 0x69, 0x67,
+    0x1A, 0x6D, 0x0B, 0x46, 0x2F, 0x49, 0x49, 0x92, 0x22, 0x39, 0x5A, 0x61, 0xC9, 0x90, 0x5B, 0xF4,
+    0xEA, 0xE5, 0xE9, 0xFA, 0xAB, 0xC9, 0x6C, 0x39, 0x14, 0xBE, 0x68, 0x73, 0x9B, 0x8C, 0x08, 0xF5,
+    0xC8, 0x45, 0xD2, 0x2C, 0x09, 0x93, 0xFD, 0x85, 0x71, 0xFA, 0x78, 0x31, 0x76, 0x49, 0x64, 0x51,
+    0x6A, 0xA8, 0x57, 0x16, 0xD9, 0x0B, 0xC7, 0x4C, 0xB4, 0xF8, 0x1C, 0xEE, 0x78, 0x31, 0xC8, 0x37,
+    0xF3, 0xDF, 0x20, 0x1F, 0x3C, 0x3E, 0xA9, 0x5A, 0xBC, 0x97, 0x1F, 0x72, 0x78, 0x0C, 0xFC, 0x5B,
+    0x78, 0x80, 0xE2, 0x22, 0xA0, 0x3A, 0xF3, 0x98, 0xA4, 0xEE, 0xA8, 0xD8, 0x58, 0x8B, 0x46, 0x1B,
+    0xE8, 0x0B, 0xE6, 0xE6, 0xEC, 0xCD, 0x79, 0xD5, 0x40, 0x6D, 0xB9, 0xF6, 0xE0, 0x88, 0x35, 0x48,
+    0xE3, 0xBD, 0x58, 0xEB, 0x18, 0xFF, 0xF1, 0x59, 0x5B, 0xB8, 0xA9, 0x6E, 0x95, 0x33, 0x67, 0x6D,
+    0xEA, 0xB3, 0xE7, 0x1E, 0x21, 0x73, 0x1D, 0x56, 0xB9, 0x9B, 0xA3, 0x5A, 0x12, 0xBA, 0xD8, 0xB2,
+    0xA1, 0x4C, 0xA0, 0xE6, 0x0C, 0xD5, 0xD9, 0x67, 0x4B, 0x7C, 0x50, 0x3C, 0x79, 0xDC, 0x9E, 0xEB,
+    0xF8, 0x2C, 0x46, 0xC4, 0x26, 0x1F, 0xA8, 0x5B, 0xD1, 0xF1, 0x8E, 0x5C, 0x87, 0xD8, 0xAB, 0x3F,
+    0x66, 0xA2, 0x7A, 0xE9, 0x1F, 0x11, 0xD1, 0x6C, 0x27, 0xD5, 0x7E, 0xF7, 0xBB, 0xC4, 0x67, 0xCB,
+    0xFB, 0xBE, 0x8A, 0xD6, 0x0C, 0x52, 0xA8, 0xE4, 0x5B, 0x68, 0x82, 0x76, 0x22, 0x34, 0xCA, 0x80,
+    0x95, 0xBA, 0x3B, 0xE2, 0x7C, 0x0C, 0x2C, 0xA8, 0x94, 0x5A, 0x14, 0xCF, 0xBE, 0xC6, 0x77, 0x78,
+    0x8B, 0xBF, 0x1E, 0x54, 0x5B, 0x66, 0x4D, 0x99, 0x63, 0x5E, 0x26, 0xDD, 0x34, 0x6B, 0xE7, 0xB1,
+    0xDE, 0x04, 0x0C, 0x3B, 0xFC, 0x15, 0x3E, 0x5A, 0x9C, 0x84, 0x2A, 0xBA, 0x7C, 0x3B, 0x0A, 0xF7,
+    0x16, 0x35, 0x6D, 0xA5, 0x5F, 0xD2, 0x20, 0x9D, 0x2C, 0xAD, 0xFC, 0xE1, 0x3E, 0x09, 0x7A, 0x8B,
+    0xEC, 0x15, 0x13, 0xD8, 0x11, 0x4D, 0xDB, 0xFC, 0xAC, 0xCD, 0x9B, 0x50, 0x34, 0x84, 0x2B, 0x06,
+    0xE9, 0x32, 0x69, 0x32, 0xE2, 0xE5, 0x8F, 0x2E, 0x15, 0x3B, 0x76, 0xD9, 0x1D, 0x3A, 0x41, 0xA8,
+    0x39, 0x94, 0x3D, 0x48, 0xA2, 0x48, 0xDD, 0xBB, 0xF8, 0xF4, 0x26, 0x88, 0x77, 0x93, 0x3A, 0x73,
+    0x3D, 0x86, 0xDC, 0x66, 0x75, 0xB8, 0x26, 0xA6, 0x84, 0x42, 0x58, 0x0F, 0x28, 0x55, 0x4B, 0xB4,
+    0xC4, 0x6B, 0xC7, 0xED, 0x2A, 0xB7, 0x06, 0xE1, 0x32, 0xF6, 0xCF, 0x30, 0xDA, 0x01, 0xF1, 0x74,
+    0x7B, 0x5E, 0x73, 0xCB, 0x89, 0x98, 0xDB, 0x8E, 0xA2, 0x6A, 0x32, 0xA7, 0x7D, 0xD2, 0xD1, 0x87,
+    0xDE, 0x91, 0xFF, 0xEF, 0xFB, 0x65, 0x48, 0x7C, 0xEA, 0x15, 0x15, 0xC3, 0x5A, 0x5A, 0xD3, 0xE4,
+    0x75, 0x81, 0xF2, 0xB4, 0x5C, 0x2D, 0x7D, 0xD5, 0x8C, 0x3D, 0xA3, 0x2D, 0x85, 0x43, 0x82, 0x85,
+    0xF8, 0x56, 0xFA, 0x86, 0xC2, 0xB9, 0xD5, 0x8C, 0x34, 0x13, 0xEF, 0x34, 0x0D, 0xD1, 0xE4, 0x6A,
+    0x59, 0x56, 0x66, 0x92, 0x15, 0x2E, 0x4F, 0xF1, 0xB7, 0xD7, 0x11, 0xA6, 0xDD, 0x53, 0xBE, 0x84,
+    0xA6, 0x05, 0x07, 0xF5, 0x93, 0x9F, 0xAA, 0x67, 0xEE, 0xE4, 0xFF, 0x83, 0x24, 0xF5, 0x9D, 0x4A,
+    0xFD, 0xDE, 0x17, 0x17, 0xF6, 0xE1, 0x1E, 0x93, 0x3E, 0xBE, 0x0C, 0x42, 0xAF, 0x10, 0xA1, 0x68,
+    0x27, 0xD7, 0x5E, 0x44, 0x41, 0x8F, 0x5A, 0x41, 0xFD, 0x6C, 0xCD, 0xF7, 0x58, 0x7A, 0x6C, 0x0F,
+    0x89, 0xD3, 0xDC, 0x4E, 0x65, 0x78, 0xFA, 0x9D, 0xD9, 0xB0, 0x28, 0x78, 0x48, 0x11, 0xD6, 0xCC,
+    0x37, 0xF7, 0x56, 0xFC, 0x45, 0x3E, 0xB1, 0x5E, 0x24, 0xD4, 0x51, 0xDA, 0x55, 0xD0, 0x6D, 0x07,
+    0xF3, 0xA5, 0xC5, 0xB4, 0xE2, 0x6A, 0x4F, 0x4B, 0xF2, 0x28, 0x8D, 0x4D, 0x7C, 0x45, 0xB6, 0x6B,
+    0xE6, 0x50, 0x3E, 0x38, 0xD4, 0xD7, 0xA8, 0xF0, 0x6B, 0xDE, 0x32, 0xFD, 0xAF, 0xB7, 0xB0, 0xC7,
+    0xDA, 0x8D, 0xDF, 0x04, 0xF5, 0xCB, 0x9F, 0x41, 0x5D, 0x3D, 0x0A, 0xEA, 0x25, 0xCB, 0xD6, 0xB3,
+    0xAB, 0x98, 0x79, 0x23, 0x2D, 0x66, 0x29, 0x8A, 0x26, 0xB3, 0xFC, 0x6C, 0x35, 0x05, 0xCC, 0x17,
+    0x25, 0xF2, 0xF5, 0x94, 0x9A, 0x9E, 0x21, 0x3F, 0xF8, 0xC8, 0x0F, 0x63, 0x5D, 0xD7, 0xA3, 0xCB,
+    0x33, 0x43, 0x07, 0x93, 0x4F, 0xA2, 0x23, 0x9D, 0xBA, 0xBA, 0xD7, 0x1B, 0x9B, 0xFD, 0x18, 0xB0,
+    0x60, 0xC5, 0x7E, 0x75, 0x98, 0xAF, 0xA0, 0xAF, 0x2C, 0x56, 0xFC, 0xE0, 0x3D, 0xB6, 0x69, 0xB8,
+    0xC4, 0x42, 0xFB, 0xDC, 0x56, 0xFC, 0x76, 0x0A, 0xEF, 0x7A, 0x6F, 0x8A, 0xD3, 0x9D, 0xB5, 0x73,
+    0x47, 0x72, 0xC7, 0xF4, 0xEC, 0x0D, 0xE5, 0x46, 0xB8, 0x23, 0x4B, 0xD6, 0x77, 0xB2, 0x12, 0x37,
+    0x4F, 0xFC, 0xE4, 0x9A, 0x99, 0xDF, 0x04, 0xF7, 0x5F, 0xC5, 0x55, 0xBF, 0x8F, 0x1C, 0x35, 0x14,
+    0xFE, 0x66, 0x0C, 0x37, 0xD2, 0x8D, 0x84, 0x29, 0x11, 0x44, 0x98, 0x82, 0x92, 0x3B, 0x37, 0x94,
+    0xD9, 0x9D, 0x49, 0x45, 0x91, 0x82, 0x2B, 0x40, 0x94, 0xE4, 0x3F, 0x48, 0x4B, 0xB1, 0x77, 0x33,
+    0x28, 0x45, 0xDA, 0x6B, 0xA8, 0x68, 0x28, 0x28, 0xD0, 0x4A, 0xFC, 0x28, 0x52, 0xA4, 0xD8, 0xBD,
+    0x35, 0xA4, 0xA0, 0x3C, 0xA7, 0x40, 0x29, 0x19, 0x0A, 0x2A, 0x24, 0x62, 0x89, 0x29, 0x06, 0xB2,
+    0x7B, 0xE6, 0x7B, 0xDE, 0xBD, 0xD3, 0x40, 0xBD, 0x02, 0x4B, 0xB6, 0x3C, 0x1E, 0xFB, 0xBD, 0xF7,
+    0x7D, 0xFE, 0xDE, 0x33, 0x50, 0x03, 0xF6, 0x7B, 0x97, 0xC5, 0x9F, 0x51, 0xBE, 0x3F, 0xE0, 0x35,
+    0xD3, 0x62, 0xD4, 0xCC, 0x06, 0x2A, 0x6E, 0x50, 0xDD, 0x59, 0xAB, 0x90, 0xF7, 0xA6, 0x2E, 0xBA,
+    0x35, 0xF4, 0x43, 0x8F, 0x53, 0x8B, 0xAC, 0x5F, 0xA0, 0x7C, 0x12, 0x30, 0xD5, 0x2E, 0xEF, 0x6D,
+    0x6D, 0xDA, 0x26, 0x5B, 0x23, 0x46, 0x87, 0x55, 0x0F, 0xBC, 0xCA, 0xB3, 0x07, 0x38, 0xC1, 0x45,
+    0xE9, 0x55, 0x5F, 0xD5, 0x65, 0xFB, 0x68, 0x6C, 0xB5, 0x88, 0x35, 0x77, 0xD6, 0xDA, 0x37, 0x58,
+    0x63, 0x59, 0xF8, 0x6C, 0xA8, 0xA0, 0x7E, 0xE9, 0x61, 0xEE, 0x3A, 0xB1, 0x9C, 0x07, 0x3A, 0x79,
+    0x10, 0xB0, 0x2C, 0x7D, 0xD1, 0x19, 0xD7, 0xA0, 0x8A, 0x01, 0x76, 0x03, 0xBC, 0x24, 0x87, 0x39,
+    0x30, 0xC6, 0x32, 0x30, 0x80, 0x9D, 0x39, 0x1D, 0xE3, 0x1F, 0x31, 0xAE, 0x77, 0x5F, 0x79, 0x8B,
+    0x7C, 0x00, 0x2E, 0x80, 0xC3, 0x6B, 0x7F, 0x59, 0x7C, 0xEA, 0x69, 0xE4, 0x39, 0x54, 0x6F, 0x3A,
+    0x54, 0xA8, 0xEA, 0xAC, 0x57, 0x57, 0xD0, 0x6E, 0x3A, 0xE0, 0x54, 0x3D, 0xF3, 0x79, 0x98, 0x99,
+    0xBA, 0xFC, 0xD1, 0x2D, 0x50, 0x3D, 0x56, 0x01, 0xB1, 0xB5, 0x75, 0x3E, 0x64, 0x03, 0x34, 0xBD,
+    0x67, 0x62, 0x59, 0x97, 0x8C, 0x78, 0x14, 0x3F, 0x3F, 0xB4, 0x03, 0xCA, 0x8E, 0xEE, 0x24, 0x8A,
+    0x05, 0xFB, 0xAD, 0x9B, 0xDF, 0x36, 0x60, 0xB6, 0x0A, 0x18, 0xF2, 0x40, 0x37, 0x21, 0x0B, 0xAA,
+    0xCB, 0x83, 0xF2, 0xAA, 0x2B, 0x9D, 0xF2, 0xDA, 0x95, 0x4E, 0xD7, 0xDA, 0x19, 0xD8, 0xD6, 0xA2,
+    0x69, 0x6D, 0xF6, 0xDB, 0x7B, 0xD5, 0xDD, 0xCB, 0x6F, 0x6C, 0xD4, 0x6B, 0x3D, 0xD0, 0xE0, 0xD6,
+    0x0F, 0xC7, 0x9C, 0xC6, 0x4B, 0x9F, 0xC0, 0x62, 0xCA, 0xA5, 0xC7, 0xEC, 0x27, 0xFB, 0xF4, 0xC1,
+    0x56, 0xB1, 0xAF, 0xC8, 0xD7, 0x0B, 0x87, 0xE2, 0x49, 0x07, 0x93, 0x05, 0xBC, 0x83, 0xF3, 0xBD,
+    0xF9, 0x10, 0x05, 0x98, 0x1F, 0x06, 0xD8, 0x07, 0x3D, 0xDE, 0x14, 0x3C, 0xD8, 0x67, 0xFC, 0xA2,
+    0x86, 0x64, 0x74, 0x89, 0x2D, 0x4B, 0xAA, 0xDB, 0xD1, 0xF4, 0xF2, 0xC8, 0xD1, 0x41, 0x8F, 0x75,
+    0x16, 0x1D, 0x4F, 0x2D, 0x49, 0xA3, 0xEA, 0x94, 0x08, 0x60, 0x42, 0x8D, 0x15, 0x0E, 0xBA, 0xE6,
+    0xEE, 0x5E, 0xF3, 0x32, 0x3F, 0x0D, 0x3C, 0x39, 0x21, 0xE1, 0x0F, 0x69, 0xE7, 0x13, 0x7E, 0x14,
+    0x5F, 0x6F, 0xA9, 0x11, 0xA1, 0x01, 0xA2, 0x2D, 0x43, 0xAF, 0xCA, 0x23, 0x13, 0xD9, 0x35, 0x5C,
+    0x28, 0xAE, 0xB8, 0x78, 0xBC, 0x75, 0xF2, 0x01, 0x3B, 0x95, 0x8F, 0xD7, 0x65, 0x63, 0xC9, 0x09,
+    0x06, 0xD1, 0x25, 0x4F, 0x64, 0x72, 0xDC, 0xA6, 0x48, 0x9B, 0x1A, 0x13, 0xAA, 0x58, 0x5D, 0x7E,
+    0xDE, 0xE1, 0xCC, 0x57, 0x28, 0x07, 0xD1, 0x1A, 0xA3, 0xD1, 0x4E, 0x75, 0x54, 0xDB, 0x84, 0xFB,
+    0x08, 0x9F, 0xA4, 0x70, 0x6A, 0x6A, 0xC5, 0x55, 0x9C, 0x31, 0xA7, 0xCA, 0x18, 0x81, 0x17, 0x14,
+    0xA0, 0xBE, 0x33, 0xB2, 0x97, 0xC0, 0x9E, 0xC9, 0x1D, 0xD2, 0x71, 0x3E, 0xFF, 0x52, 0xC2, 0xB8,
+    0x47, 0xE0, 0xC2, 0x77, 0x3E, 0x54, 0xF5, 0xBF, 0x09, 0xFF, 0x8F, 0x98, 0xC8, 0xE7, 0x5F, 0x71,
+    0x6C, 0x84, 0x8C, 0xED, 0x74, 0xDC, 0x4E, 0xAE, 0x35, 0x87, 0x42, 0x6C, 0x21, 0x25, 0xD5, 0xB1,
+    0x50, 0xA5, 0x2E, 0x85, 0xB4, 0x5E, 0xF2, 0xC8, 0x08, 0x7F, 0xCA, 0x9F, 0x4A, 0x5A, 0x09, 0x48,
+    0x2D, 0xEA, 0xCF, 0x3B, 0xF2, 0x82, 0xE9, 0x87, 0x4D, 0xCA, 0xF6, 0x1E, 0xD9, 0x5F, 0xF3, 0x6F,
+    0x5B, 0xFE, 0x20, 0x6D, 0xDC, 0xCE, 0x5C, 0xEC, 0x25, 0x34, 0xF2, 0xA2, 0xFD, 0x1B, 0x7F, 0xE2,
+    0x20, 0x3E, 0x8B, 0x21, 0x63, 0xDD, 0x3A, 0x9C, 0x9F, 0xC3, 0xB2, 0x78, 0x1C, 0xCE, 0xBF, 0xF8,
+    0x47, 0x20, 0xA6, 0x7F, 0x84, 0x55, 0x0C, 0xF9, 0x60, 0xBB, 0xC2, 0x17, 0x5E, 0xB7, 0x85, 0x13,
+    0xEE, 0xA7, 0xD0, 0xED, 0x29, 0xE1, 0xB1, 0x0E, 0x30, 0xA5, 0xA5, 0x38, 0x5D, 0x61, 0xAD, 0x7E,
+    0xBF, 0x75, 0xF1, 0xF1, 0xF1, 0xAC, 0xD9, 0xD8, 0x60, 0xA5, 0x1E, 0x8C, 0xCC, 0xDC, 0xC6, 0x3D,
+    0x42, 0xE9, 0x8E, 0xD2, 0x2D, 0x48, 0xDD, 0x8C, 0x5E, 0xAA, 0xCD, 0xC9, 0xFF, 0x88, 0x58, 0xDA,
+    0x2B, 0x78, 0x9B, 0x20, 0x02, 0xCF, 0xF9, 0x54, 0x6A, 0x47, 0x65, 0x63, 0x0F, 0xC8, 0x53, 0x72,
+    0xA9, 0x84, 0xA6, 0x49, 0xD5, 0x57, 0x0A, 0x60, 0xFE, 0x5C, 0xE0, 0xDF, 0x16, 0x75, 0x68, 0x16,
+    0x71, 0xCA, 0x54, 0x80, 0x4D, 0x0A, 0x8F, 0x64, 0x1C, 0x08, 0x02, 0xEC, 0x58, 0xA8, 0x50, 0xBF,
+    0x7E, 0xC4, 0xC3, 0x91, 0xF5, 0x1F, 0x66, 0x3E, 0x1F, 0x44, 0xC8, 0x4C, 0xDE, 0x85, 0xA0, 0x61,
+    0xC2, 0xF0, 0x31, 0xE1, 0xDF, 0x4D, 0xB6, 0x3A, 0xC7, 0xFD, 0x4D, 0x13, 0x61, 0x12, 0xA5, 0x4A,
+    0x06, 0x24, 0x9F, 0x13, 0x5C, 0x8B, 0x1F, 0x95, 0xF0, 0x88, 0xAB, 0x7D, 0xDD, 0x2B, 0xD5, 0x8F,
+    0xA3, 0x74, 0xAB, 0xC0, 0x4C, 0xD0, 0xD1, 0x89, 0xF5, 0xD7, 0x4F, 0x88, 0x0C, 0x82, 0x74, 0x55,
+    0x6F, 0xFF, 0x98, 0x6E, 0x5B, 0xA6, 0x6F, 0x0A, 0x40, 0x4E, 0x44, 0xB9, 0x3C, 0x16, 0xAB, 0xDA,
+    0x38, 0xDB, 0x62, 0x56, 0x74, 0x28, 0x5B, 0x32, 0xF2, 0x9D, 0xAD, 0x77, 0x84, 0x09, 0x11, 0x42,
+    0x49, 0x7A, 0x2F, 0x52, 0x99, 0x48, 0x13, 0x59, 0xB9, 0xD8, 0x49, 0xA4, 0xAE, 0x1C, 0x8E, 0xB2,
+    0xF8, 0xD9, 0x7D, 0x57, 0xC4, 0x48, 0x03, 0xEC, 0x5B, 0xDF, 0xC2, 0xBB, 0x72, 0x62, 0x87, 0x2F,
+    0x8E, 0x64, 0x1E, 0x37, 0xBF, 0x75, 0xF3, 0x20, 0xF1, 0x31, 0x8B, 0x4E, 0xFF, 0x14, 0x68, 0x94,
+    0xD9, 0x2C, 0xF4, 0xF4, 0x09, 0x84, 0x4D, 0x0F, 0x95, 0x38, 0x5F, 0xE2, 0x5D, 0xF3, 0x74, 0xA1,
+    0x18, 0x5F, 0xD5, 0x8F, 0x02, 0xFF, 0x1B, 0xBD, 0x55, 0x3D, 0x8F, 0xE3, 0x54, 0x14, 0x3D, 0xCF,
+    0x86, 0x3C, 0x69, 0x0D, 0x78, 0x0B, 0x10, 0xD2, 0x2E, 0x92, 0x1B, 0x0A, 0x84, 0xB4, 0x63, 0x0A,
+    0x0A, 0x0A, 0x26, 0x7E, 0x15, 0x35, 0x05, 0x1F, 0xE5, 0xF2, 0x0F, 0xD2, 0x50, 0x26, 0x1B, 0x53,
+    0xD1, 0x2E, 0x05, 0xFF, 0x80, 0x02, 0x4D, 0xC3, 0x14, 0x14, 0x5B, 0x24, 0x93, 0x27, 0xF1, 0x07,
+    0x0C, 0x12, 0x35, 0x46, 0x08, 0x51, 0x62, 0xAD, 0x8C, 0xE4, 0xD5, 0x3A, 0x79, 0x9C, 0xF3, 0xF2,
+    0x31, 0x03, 0x12, 0x0D, 0xD2, 0xAE, 0x15, 0x3F, 0x65, 0xE6, 0x5E, 0xDF, 0x7B, 0xCF, 0xC7, 0x75,
+    0x00, 0x7C, 0x08, 0xA0, 0xAA, 0x81, 0x7C, 0x0B, 0xA4, 0x8F, 0x7B, 0x60, 0xCC, 0x6A, 0x9C, 0xE1,
+    0x4D, 0xEC, 0xAF, 0x8F, 0x80, 0x24, 0x04, 0xC7, 0x7B, 0xC4, 0xC6, 0x15, 0xBE, 0xAC, 0x31, 0xB7,
+    0x2D, 0xB2, 0x7A, 0x04, 0x2E, 0x4B, 0xC7, 0x67, 0x3A, 0x66, 0x4D, 0x79, 0xDB, 0x86, 0xC7, 0x8A,
+    0x77, 0xE6, 0x8F, 0x5F, 0xF4, 0x9F, 0x2B, 0x85, 0x98, 0xE3, 0x2A, 0x8F, 0x7B, 0x26, 0x7C, 0x3D,
+    0xF3, 0x36, 0x04, 0x16, 0xE0, 0x0D, 0x73, 0x68, 0x82, 0x07, 0x9C, 0xA1, 0xC1, 0x74, 0xC4, 0xB4,
+    0x40, 0x99, 0x34, 0xAF, 0xE0, 0x9D, 0x43, 0xC0, 0xEE, 0x90, 0x07, 0x9F, 0xFF, 0xDC, 0xB1, 0xA8,
+    0xF5, 0x48, 0xF9, 0x10, 0x47, 0x9C, 0x03, 0x25, 0x27, 0xF6, 0xB1, 0xF9, 0x1A, 0xEF, 0x16, 0x3F,
+    0xAE, 0x52, 0xCE, 0x57, 0x31, 0xE4, 0x8E, 0x25, 0x95, 0x11, 0x1B, 0x63, 0xA3, 0x2F, 0x35, 0x6E,
+    0x5C, 0xCF, 0x01, 0xD4, 0x25, 0xD2, 0x5E, 0x29, 0x69, 0x73, 0xDD, 0xB6, 0x18, 0x10, 0xC6, 0xF4,
+    0xAF, 0x39, 0x6B, 0x15, 0xB1, 0xFC, 0x79, 0x84, 0xC2, 0xAA, 0x63, 0xFC, 0x10, 0xC9, 0xF2, 0x83,
+    0xAE, 0x22, 0xDE, 0xED, 0x1E, 0xC8, 0xC3, 0xA4, 0x41, 0xE1, 0x14, 0xAF, 0xD8, 0x2F, 0x70, 0x84,
+    0x42, 0x83, 0x3D, 0x7A, 0x8E, 0x38, 0xE0, 0x6C, 0xBD, 0xC0, 0x3C, 0x77, 0xE9, 0x6F, 0x8D, 0x00,
+    0x60, 0xC7, 0x9E, 0x27, 0x32, 0x4D, 0xA8, 0x21, 0xE2, 0x3F, 0xF5, 0xAC, 0x6B, 0xBA, 0xD8, 0x4B,
+    0x88, 0xE7, 0xFB, 0x46, 0x63, 0x14, 0x49, 0xB8, 0x6C, 0x3F, 0x03, 0x81, 0x21, 0x34, 0x07, 0x89,
+    0xDE, 0xC0, 0x7B, 0x0A, 0x52, 0x78, 0x33, 0x2C, 0xA4, 0xD6, 0x9A, 0x47, 0xBA, 0x55, 0xE8, 0xFC,
+    0x44, 0xD8, 0xC7, 0x4C, 0x5D, 0x12, 0x20, 0xAA, 0xDD, 0x86, 0xB5, 0x16, 0x58, 0x7A, 0xCA, 0x9A,
+    0x8E, 0xAA, 0x5A, 0x39, 0x9A, 0x21, 0x6B, 0xCD, 0x00, 0x33, 0x32, 0x82, 0x6A, 0x6F, 0x09, 0x46,
+    0x6C, 0xCB, 0x88, 0x19, 0x4C, 0xAF, 0xCE, 0xEB, 0x43, 0xA4, 0xA8, 0x19, 0xC9, 0x3D, 0x23, 0x79,
+    0xC3, 0x48, 0xDE, 0x30, 0x32, 0x6B, 0xC8, 0x5C, 0xA8, 0x79, 0x3C, 0xB9, 0xE9, 0x8E, 0x5B, 0x3A,
+    0x84, 0xC2, 0x38, 0x22, 0xAA, 0x7A, 0x82, 0xB9, 0xB3, 0xBD, 0xA7, 0x19, 0x73, 0xF1, 0xF6, 0x83,
+    0x78, 0x6D, 0x95, 0xD3, 0xEB, 0x98, 0xCB, 0x61, 0x33, 0x51, 0x41, 0x2E, 0xCC, 0x50, 0xB2, 0x75,
+    0xAF, 0xD6, 0x83, 0x22, 0x73, 0xB5, 0x9E, 0x22, 0xAF, 0x91, 0x3B, 0x4A, 0x60, 0x3D, 0x05, 0x49,
+    0x3A, 0x0E, 0x4C, 0x09, 0x76, 0x9A, 0xEC, 0xE9, 0x97, 0xC8, 0x7E, 0x7F, 0xFC, 0x87, 0x37, 0xA1,
+    0xDF, 0x10, 0x5B, 0x5B, 0xF8, 0x93, 0x85, 0x5F, 0xE3, 0x66, 0x16, 0x81, 0x84, 0xE5, 0xE1, 0xBB,
+    0xC0, 0xAF, 0x8E, 0xDA, 0x93, 0xD4, 0x20, 0x51, 0x39, 0xFE, 0x80, 0x64, 0x10, 0xEE, 0x25, 0x23,
+    0x04, 0x96, 0x69, 0x19, 0x42, 0x18, 0xCC, 0x50, 0x85, 0x2D, 0xF7, 0x89, 0x91, 0xD2, 0x95, 0x87,
+    0x08, 0x19, 0xE9, 0xF4, 0xD8, 0x20, 0x53, 0x2E, 0x74, 0x94, 0xEE, 0x6E, 0x8F, 0x8D, 0xB4, 0xDE,
+    0x84, 0xDD, 0xF5, 0xCE, 0xE0, 0x55, 0xDE, 0xD2, 0xE8, 0x8E, 0x94, 0xB0, 0x07, 0xAF, 0x64, 0x94,
+    0x18, 0x9F, 0x3C, 0x61, 0x1A, 0x6D, 0x3B, 0xF9, 0x8A, 0xA5, 0xC2, 0x0E, 0x66, 0xBB, 0x6C, 0x09,
+    0x6D, 0xCB, 0x0E, 0xD6, 0x53, 0xFA, 0x55, 0xC4, 0x99, 0x8A, 0xDC, 0x39, 0x81, 0x65, 0xDE, 0x76,
+    0x11, 0x64, 0xEE, 0xA7, 0xBF, 0xFA, 0xAB, 0xFB, 0x67, 0x73, 0x1B, 0x7E, 0x0A, 0x7B, 0x84, 0xB7,
+    0x63, 0xAB, 0xB7, 0x2F, 0x1E, 0xB2, 0x17, 0xC5, 0x4D, 0x2E, 0xBE, 0xC5, 0x3F, 0xAF, 0x8C, 0xB2,
+    0xB8, 0xBB, 0x72, 0xB5, 0x6D, 0x58, 0x9A, 0x92, 0x7B, 0x7A, 0xE9, 0xE5, 0x3D, 0xED, 0xB9, 0xDC,
+    0x27, 0xCB, 0x90, 0x48, 0xFE, 0x15, 0xC4, 0x63, 0xE8, 0x49, 0xFD, 0xD1, 0xD4, 0x5A, 0x7C, 0xA6,
+    0x4F, 0x94, 0xFE, 0x3E, 0xD9, 0x61, 0x85, 0x35, 0xEE, 0xD7, 0x25, 0xEB, 0x49, 0xEF, 0x4E, 0xAD,
+    0x5D, 0x19, 0xBA, 0xC9, 0xC5, 0x37, 0xD7, 0x2D, 0xE9, 0xE4, 0xE4, 0x69, 0x9F, 0xB6, 0xD3, 0xA4,
+    0xCD, 0xBF, 0xE8, 0x6C, 0x33, 0xD8, 0xF6, 0x3C, 0x6B, 0x8B, 0x65, 0x93, 0x05, 0x97, 0xF6, 0xD1,
+    0xCA, 0x25, 0x6E, 0xD9, 0x76, 0xE6, 0x38, 0x5A, 0xC1, 0x9E, 0xB7, 0x4F, 0x8F, 0x5E, 0x1A, 0xBD,
+    0x98, 0xCE, 0x34, 0x36, 0x6B, 0xE7, 0x3B, 0x55, 0xBB, 0x41, 0xA9, 0x68, 0xEE, 0x0D, 0x0F, 0xCF,
+    0xA9, 0x0B, 0x4E, 0xCD, 0xA1, 0xE8, 0xC5, 0x26, 0xEE, 0x25, 0x86, 0xE3, 0x72, 0x96, 0xAA, 0x28,
+    0x41, 0x52, 0x71, 0x52, 0x08, 0xE4, 0x3A, 0x82, 0x44, 0x5C, 0xA2, 0xCF, 0x98, 0x9E, 0x7A, 0x92,
+    0x5B, 0x10, 0xE4, 0x8B, 0x83, 0x80, 0x78, 0x22, 0x0A, 0xFB, 0xB7, 0xA4, 0x7B, 0x09, 0x2B, 0xCB,
+    0xDD, 0x25, 0x57, 0xE3, 0x5E, 0xC4, 0xD3, 0x1B, 0x27, 0xFB, 0xB3, 0x21, 0x2A, 0x3C, 0x4A, 0xDB,
+    0x02, 0x0B, 0x1E, 0x35, 0x61, 0xD9, 0x5F, 0x28, 0x7E, 0x5C, 0x02, 0xE1, 0xCA, 0x7C, 0x52, 0x3F,
+    0x98, 0xF4, 0x29, 0x7D, 0x23, 0x60, 0x2F, 0x9C, 0x9E, 0x8E, 0xBD, 0x4B, 0x99, 0x40, 0x6D, 0x4C,
+    0xFB, 0x2F, 0x95, 0x9E, 0x39, 0xB0, 0xFF, 0x78, 0x87, 0x5E, 0x6D, 0x09, 0x28, 0xAB, 0xF9, 0x53,
+    0xB1, 0x98, 0x9A, 0x81, 0x70, 0x16, 0xC1, 0x11, 0xCD, 0x36, 0x82, 0x59, 0xE1, 0x2D, 0x62, 0xA9,
+    0x42, 0x23, 0x28, 0x07, 0x15, 0x54, 0xB3, 0x99, 0xA8, 0x66, 0x34, 0x27, 0x17, 0xA2, 0xA3, 0x43,
+    0x53, 0x17, 0x67, 0x8C, 0x9E, 0x2A, 0x5C, 0x74, 0xBA, 0xD3, 0x8C, 0xDC, 0x55, 0x32, 0xA1, 0x9F,
+    0x24, 0x24, 0xFD, 0xF1, 0x8D, 0x59, 0xC1, 0xD4, 0x4C, 0xCF, 0x05, 0x89, 0x4B, 0xED, 0x5E, 0x6F,
+    0xE5, 0x51, 0x31, 0x30, 0x2A, 0x45, 0xA0, 0xBE, 0x57, 0x31, 0xE5, 0x16, 0xEA, 0x59, 0x09, 0xDE,
+    0xD2, 0xFD, 0x8F, 0xB9, 0x49, 0x12, 0xDF, 0x1C, 0x9F, 0x83, 0x43, 0xEA, 0xC3, 0x79, 0x36, 0x0E,
+    0xCF, 0xE8, 0xFA, 0x1B, 0xC5, 0x55, 0xB1, 0x8E, 0xE4, 0x44, 0x10, 0x7D, 0x76, 0xB3, 0x6B, 0xE9,
+    0x8C, 0xD4, 0x97, 0x1C, 0xC9, 0x81, 0x9C, 0x10, 0x20, 0x81, 0xE4, 0x84, 0x70, 0x66, 0xDC, 0xD2,
+    0x7D, 0x00, 0x17, 0xDC, 0x88, 0x60, 0x03, 0xC8, 0x09, 0x86, 0x80, 0x70, 0x67, 0xC7, 0x12, 0x01,
+    0xE9, 0x26, 0xE4, 0x17, 0x10, 0x2D, 0xC1, 0x25, 0x84, 0x9E, 0x71, 0xFF, 0xC1, 0x39, 0xE0, 0x44,
+    0x40, 0x62, 0x89, 0x25, 0x20, 0x5A, 0x07, 0x3E, 0xE4, 0xBD, 0xF3, 0xB8, 0x79, 0xD5, 0xF6, 0x0C,
+    0xBB, 0x84, 0x04, 0x60, 0x69, 0xAD, 0xF5, 0xB8, 0xAB, 0xEA, 0xBD, 0x57, 0xAF, 0xCA, 0xC0, 0x87,
+    0xF8, 0x09, 0x41, 0xA3, 0x2D, 0x54, 0xD3, 0x03, 0x91, 0xCB, 0x81, 0xB8, 0x03, 0x6F, 0xFC, 0xE7,
+    0x78, 0x95, 0xCE, 0xB5, 0x01, 0x6F, 0x16, 0x6B, 0x24, 0x08, 0x1B, 0xCC, 0xC0, 0x88, 0x0A, 0x0B,
+    0x79, 0x29, 0xA7, 0xA3, 0x8A, 0xB7, 0x14, 0x0F, 0x01, 0xE7, 0x6A, 0x28, 0xE7, 0x0C, 0x12, 0x49,
+    0xB0, 0xE5, 0x1F, 0x8F, 0x43, 0x8E, 0x7F, 0xC9, 0xE3, 0xCA, 0x06, 0x2D, 0x33, 0xC4, 0xD5, 0x49,
+    0x17, 0x3A, 0xE6, 0x4B, 0x79, 0x93, 0x1C, 0x26, 0xCA, 0xD7, 0x38, 0xD7, 0x46, 0xFD, 0x56, 0x21,
+    0x61, 0xC2, 0x81, 0x61, 0x47, 0x00, 0x01, 0x41, 0xED, 0xF6, 0x58, 0xA8, 0x3A, 0xCE, 0x17, 0x41,
+    0x13, 0x55, 0x8B, 0xA0, 0x53, 0xD5, 0x0E, 0x6B, 0x67, 0x62, 0x16, 0xDA, 0xFB, 0xEC, 0x28, 0xF0,
+    0x51, 0x54, 0xAF, 0x4C, 0xE6, 0xAA, 0x80, 0x10, 0x60, 0x7C, 0xE8, 0x53, 0x61, 0x22, 0xF5, 0x4B,
+    0xDE, 0xE2, 0x5F, 0xF8, 0xFB, 0x36, 0xB2, 0x88, 0xF2, 0x07, 0x87, 0xDC, 0xCF, 0x98, 0xBE, 0xE4,
+    0x79, 0x02, 0xA9, 0xD4, 0x2D, 0x18, 0x6F, 0x30, 0x0B, 0x5B, 0xA0, 0x21, 0xFE, 0xC8, 0xF4, 0xC2,
+    0xAD, 0x16, 0x6E, 0x92, 0x4F, 0x9E, 0x54, 0x83, 0x93, 0xE5, 0x67, 0x16, 0xE5, 0x90, 0x01, 0x67,
+    0x35, 0x7F, 0x4A, 0x9E, 0xF0, 0x78, 0xC1, 0x2A, 0xAA, 0xD1, 0x35, 0x74, 0x9E, 0x74, 0x27, 0x5B,
+    0xC9, 0xD7, 0x20, 0x76, 0xB7, 0x13, 0x86, 0x89, 0x88, 0x48, 0xA5, 0x79, 0x1A, 0x6F, 0x09, 0x47,
+    0x7F, 0x27, 0xA8, 0x63, 0x03, 0x95, 0xBF, 0x7B, 0x47, 0xEB, 0x11, 0xCE, 0x8D, 0x33, 0x61, 0xAB,
+    0x9F, 0x42, 0x9B, 0x85, 0x50, 0x6B, 0xA1, 0x6A, 0x65, 0x99, 0x9C, 0x45, 0x53, 0x42, 0x40, 0x36,
+    0x08, 0xA8, 0x4B, 0x1E, 0x17, 0x76, 0x89, 0xA0, 0xDB, 0x50, 0xB0, 0x50, 0xA8, 0xBB, 0x15, 0x35,
+    0xCE, 0xD9, 0xC5, 0x0E, 0x11, 0xD5, 0x42, 0x6C, 0xC9, 0xE5, 0x02, 0xD9, 0xEF, 0x5F, 0x34, 0xC8,
+    0x1C, 0x03, 0x1F, 0xBC, 0x31, 0xC7, 0x6A, 0x95, 0xA2, 0x30, 0xF6, 0x9C, 0x39, 0xD8, 0x5D, 0xA4,
+    0x42, 0xF1, 0x04, 0xFF, 0x8B, 0x3A, 0xDF, 0xC0, 0xD2, 0x2B, 0x89, 0x98, 0x50, 0x9A, 0x25, 0xBE,
+    0x08, 0xCC, 0x1D, 0x61, 0xB0, 0x72, 0x1D, 0xE2, 0xB7, 0xAE, 0xC2, 0x56, 0xFD, 0x0C, 0x55, 0xE9,
+    0x9C, 0x8E, 0x9B, 0x8B, 0xFF, 0x98, 0xBC, 0xA6, 0x05, 0x62, 0xCB, 0x7A, 0xDA, 0x3B, 0xF8, 0x9A,
+    0xC7, 0xCF, 0x0F, 0xBE, 0x4C, 0x04, 0x62, 0x49, 0xED, 0xB3, 0x5F, 0xF7, 0xC4, 0x1B, 0x0E, 0x34,
+    0x62, 0xD0, 0xD3, 0x88, 0x61, 0x43, 0xF4, 0x49, 0xAE, 0x6F, 0x3F, 0xEF, 0x19, 0xC7, 0xC0, 0x70,
+    0x77, 0x79, 0xAC, 0x46, 0x9F, 0x30, 0x82, 0x00, 0x02, 0x4F, 0xAC, 0xBA, 0x8B, 0xE4, 0xBF, 0x13,
+    0xE6, 0x13, 0x89, 0x15, 0xC7, 0x24, 0x02, 0x67, 0x8E, 0x7F, 0x5E, 0x8F, 0xD9, 0xCF, 0x70, 0x70,
+    0x2D, 0x2B, 0xBD, 0x06, 0x5A, 0x55, 0x53, 0x05, 0x6D, 0x48, 0x70, 0x46, 0x61, 0x58, 0x34, 0x6C,
+    0x58, 0x4F, 0x89, 0x2B, 0x42, 0x49, 0x9A, 0x88, 0xA8, 0x92, 0x2E, 0x12, 0x2B, 0xA6, 0xF4, 0x82,
+    0xFE, 0xD3, 0x19, 0xFA, 0xB2, 0xCC, 0x29, 0xE7, 0x86, 0xE3, 0x8D, 0x82, 0x4F, 0x51, 0xAD, 0x86,
+    0xA5, 0x93, 0x39, 0x66, 0xE0, 0x8B, 0x1F, 0xBC, 0x51, 0x88, 0xE7, 0x54, 0x34, 0xE2, 0x1A, 0x30,
+    0xFA, 0x3A, 0xD8, 0xCA, 0xDC, 0x35, 0x71, 0xC5, 0x91, 0xBE, 0x00, 0x3E, 0x50, 0xDE, 0x86, 0x87,
+    0x91, 0x57, 0xD3, 0xC8, 0x3F, 0x5A, 0x66, 0xB4, 0x64, 0xD7, 0x23, 0x58, 0x7D, 0xCB, 0x9F, 0xD6,
+    0xBA, 0x22, 0xA0, 0x94, 0x3E, 0xB6, 0x59, 0x4E, 0x8C, 0x9B, 0xFA, 0xBD, 0x16, 0x7E, 0xAD, 0xA4,
+    0xEE, 0x7A, 0xEA, 0xB6, 0x37, 0x5F, 0x7F, 0x58, 0x1B, 0xB1, 0xB0, 0x9E, 0x1D, 0xF4, 0x7F, 0x67,
+    0xF2, 0x2C, 0x0E, 0xDD, 0x3D, 0x68, 0x12, 0x4C, 0xF5, 0xD8, 0x30, 0x4C, 0x10, 0x8E, 0xD7, 0x08,
+    0xBA, 0xDC, 0x73, 0xE9, 0xCC, 0x0D, 0x4F, 0x77, 0xCC, 0xCC, 0x6C, 0x3A, 0xD7, 0x20, 0x04, 0x56,
+    0x2A, 0x24, 0xD0, 0x89, 0x1E, 0x3B, 0x33, 0xE5, 0x5C, 0x4B, 0x4E, 0x99, 0xB0, 0x98, 0xB1, 0x6A,
+    0x5F, 0x56, 0x1C, 0x9F, 0xB4, 0xA6, 0xB8, 0x89, 0xE5, 0xA8, 0xA5, 0x7C, 0xA2, 0x48, 0xEE, 0xFB,
+    0x8D, 0xE5, 0xBA, 0x63, 0xE0, 0xC7, 0x7F, 0x8C, 0xB8, 0xBC, 0x5B, 0xBD, 0x5D, 0xB8, 0xB3, 0x24,
+    0x4F, 0xF8, 0x5A, 0xD2, 0x86, 0xAD, 0xC8, 0x8E, 0x26, 0xC8, 0xEF, 0xF7, 0xAE, 0x74, 0x1C, 0xC7,
+    0xFC, 0xF1, 0x60, 0xA4, 0xCA, 0xDA, 0x63, 0x4F, 0x49, 0x23, 0x17, 0x26, 0x34, 0xAE, 0xEF, 0x9E,
+    0x5F, 0xAF, 0xBD, 0x47, 0xC4, 0x45, 0x90, 0x2E, 0x97, 0xAB, 0x5C, 0xAC, 0xCA, 0x21, 0x50, 0x6F,
+    0xAE, 0x7E, 0x6C, 0xFC, 0x4A, 0xE9, 0x3D, 0xE3, 0x85, 0x8F, 0x26, 0x3C, 0x99, 0x04, 0xBE, 0xAE,
+    0x25, 0x5A, 0x7A, 0x2D, 0x14, 0xE5, 0x75, 0xE8, 0x9A, 0xA0, 0xE4, 0xDA, 0xED, 0x21, 0x3B, 0x40,
+    0xFA, 0x19, 0xEC, 0x47, 0xA0, 0x01, 0x3B, 0xC4, 0x6D, 0x03, 0x3C, 0x3F, 0x40, 0x7C, 0x26, 0xA6,
+    0xE1, 0xCB, 0x17, 0x76, 0x6A, 0x44, 0x37, 0x29, 0x9D, 0x4C, 0x4D, 0x51, 0x35, 0xDB, 0xD8, 0x6E,
+    0x3A, 0xCC, 0x2E, 0x36, 0x48, 0x66, 0xDA, 0xC6, 0x05, 0x37, 0xD4, 0x9E, 0x8B, 0x6A, 0x60, 0x6B,
+    0x36, 0x84, 0x92, 0x1A, 0x4A, 0x6C, 0x55, 0xA5, 0xEA, 0xA0, 0x21, 0x8C, 0xE2, 0xEB, 0x02, 0x59,
+    0x91, 0x42, 0xF7, 0x3A, 0x57, 0x92, 0xED, 0xE1, 0x41, 0x86, 0xD4, 0x59, 0xED, 0xEA, 0x53, 0x77,
+    0x29, 0xCB, 0x6B, 0xC2, 0x6F, 0x05, 0x3F, 0x9D, 0x41, 0x6F, 0x64, 0x72, 0x6F, 0x84, 0x5E, 0x36,
+    0xD2, 0xCB, 0x11, 0xBF, 0x5A, 0x9E, 0xF9, 0xAF, 0x0C, 0x7D, 0x8F, 0xE1, 0xEA, 0x8A, 0x0C, 0x2F,
+    0x46, 0xF9, 0xC6, 0xD7, 0x47, 0xF9, 0x5A, 0x0F, 0xBC, 0xC0, 0x3D, 0x75, 0xCB, 0x1E, 0xAB, 0x61,
+    0x12, 0x1F, 0x78, 0x44, 0x04, 0xD2, 0xAB, 0xAF, 0x84, 0x65, 0x31, 0x3A, 0x48, 0xC9, 0x47, 0xE9,
+    0xEC, 0x95, 0x99, 0xA8, 0x9F, 0x3E, 0xC7, 0x5C, 0x0F, 0x48, 0xB4, 0xB3, 0xD1, 0xCB, 0x27, 0x75,
+    0x78, 0x63, 0xD8, 0x7C, 0x33, 0x47, 0x96, 0x27, 0x34, 0x44, 0x6C, 0x63, 0x72, 0x64, 0xB5, 0x96,
+    0xB5, 0xCE, 0x59, 0x29, 0x7D, 0x9F, 0x2C, 0x6F, 0x62, 0xAB, 0x1C, 0x39, 0x0C, 0x7F, 0xDB, 0x76,
+    0x17, 0x23, 0xBD, 0x6D, 0x14, 0x77, 0xD0, 0xA7, 0xE9, 0xFD, 0x8F, 0xAB, 0x21, 0x79, 0xBF, 0xAA,
+    0x8A, 0xD1, 0xC5, 0xBD, 0xC7, 0x29, 0xBD, 0x4B, 0xC7, 0x59, 0x5A, 0x8C, 0x9B, 0x6C, 0x3B, 0x6A,
+    0x7F, 0xEF, 0x75, 0x2A, 0x1F, 0xC1, 0x16, 0xFF, 0xF2, 0xFA, 0x0B, 0xA5, 0x55, 0xB1, 0x8E, 0xDB,
+    0x46, 0x14, 0x7C, 0xCB, 0x0D, 0x6E, 0x01, 0x13, 0xC6, 0xBA, 0xB8, 0x20, 0x40, 0xCE, 0xF0, 0xB6,
+    0x07, 0x24, 0x0E, 0x53, 0xA4, 0x8C, 0x44, 0xDA, 0xF9, 0x00, 0xE7, 0x0F, 0xEC, 0x3F, 0xB0, 0x8B,
+    0x94, 0x96, 0x8F, 0x89, 0x8B, 0x14, 0x69, 0xFC, 0x09, 0xA9, 0xAF, 0x71, 0xEB, 0x00, 0xD4, 0x89,
+    0x70, 0xCA, 0x34, 0x44, 0x5C, 0xBA, 0x61, 0x80, 0x74, 0x29, 0xBC, 0x08, 0x64, 0x80, 0x06, 0x28,
+    0x6E, 0x66, 0x96, 0x94, 0x74, 0x52, 0x97, 0x84, 0x3A, 0x91, 0xB7, 0x8F, 0xBB, 0xB3, 0x33, 0xF3,
+    0xDE, 0x5B, 0x49, 0x21, 0xB6, 0x6D, 0xC3, 0xDB, 0xE7, 0xBF, 0xF5, 0x37, 0xD3, 0x46, 0xA6, 0xEB,
+    0xCC, 0xAB, 0xD0, 0x88, 0x13, 0xA9, 0x44, 0xB7, 0xE2, 0x0A, 0x3E, 0xBD, 0xD8, 0x52, 0x16, 0x92,
+    0xE0, 0xF9, 0xA3, 0xCC, 0x2B, 0x15, 0x6A, 0xDD, 0xC5, 0xC9, 0x9F, 0x5E, 0xBE, 0xD0, 0x61, 0xE0,
+    0x43, 0xF6, 0xD7, 0x2A, 0x14, 0x27, 0xE1, 0x85, 0x98, 0x86, 0x18, 0x62, 0x6B, 0x91, 0x5E, 0x08,
+    0xA0, 0xD6, 0x22, 0x99, 0x10, 0x4D, 0xE6, 0x12, 0x5F, 0x2F, 0x45, 0xD2, 0xE3, 0xD7, 0x59, 0x28,
+    0xD2, 0xB0, 0x96, 0x93, 0xCB, 0x9F, 0xF3, 0xD0, 0x5E, 0x5E, 0x6E, 0x41, 0xD5, 0x4A, 0xDC, 0x46,
+    0x94, 0xE7, 0x82, 0x39, 0xE7, 0xE2, 0x99, 0x8B, 0x74, 0xC4, 0xC1, 0xAA, 0xEE, 0x89, 0xFE, 0xAB,
+    0x76, 0xBD, 0xE4, 0xE5, 0x8E, 0xC6, 0x77, 0x52, 0x6B, 0xEF, 0xC4, 0x04, 0xAC, 0x19, 0x00, 0x50,
+    0x5C, 0x27, 0xA8, 0x56, 0x7F, 0x0A, 0x14, 0x51, 0x52, 0x64, 0x08, 0x28, 0x60, 0x45, 0x52, 0x40,
+    0x23, 0x23, 0x88, 0xA7, 0x7A, 0x72, 0xDC, 0x4E, 0x02, 0x6B, 0x92, 0xC4, 0xCE, 0x09, 0x18, 0x66,
+    0x21, 0x7A, 0xF6, 0xB9, 0x7C, 0xD9, 0x99, 0x1F, 0x42, 0x9F, 0x84, 0x52, 0xBE, 0xFD, 0x0F, 0x16,
+    0x0A, 0x25, 0x37, 0x34, 0x0C, 0x13, 0x01, 0x4D, 0x7B, 0xFA, 0xB8, 0xD7, 0x7E, 0xDC, 0x45, 0xAE,
+    0xD9, 0xF1, 0x18, 0x4A, 0x36, 0x14, 0x23, 0x56, 0xF8, 0x97, 0x16, 0x91, 0xF4, 0xAA, 0x15, 0xEB,
+    0x27, 0x64, 0x5B, 0x1B, 0x9F, 0xF4, 0x72, 0xBE, 0xCB, 0x2D, 0x3C, 0x74, 0x40, 0xD1, 0x2D, 0x84,
+    0x54, 0x50, 0x6D, 0x4B, 0xD3, 0x80, 0x53, 0xF7, 0x64, 0x5E, 0xB9, 0x5E, 0xF7, 0xF2, 0x35, 0x3E,
+    0x77, 0x24, 0x2D, 0x93, 0xA1, 0xCC, 0xEB, 0x2D, 0x3F, 0x28, 0x71, 0x8D, 0xA4, 0x00, 0x5D, 0x1F,
+    0xA6, 0xF9, 0x6C, 0x28, 0x26, 0x22, 0xF6, 0x88, 0x18, 0xC7, 0x6D, 0x74, 0x6B, 0x79, 0x34, 0xAE,
+    0x68, 0x5E, 0x12, 0x36, 0x91, 0xCE, 0xC5, 0x5A, 0xF9, 0xC4, 0xEB, 0xD6, 0x34, 0x69, 0x6D, 0x6B,
+    0x5B, 0xBA, 0x22, 0x93, 0xF9, 0xED, 0x79, 0x75, 0xE1, 0xAF, 0x25, 0x72, 0x15, 0xEE, 0x87, 0x5E,
+    0x1E, 0x7F, 0x60, 0xCE, 0x90, 0xA0, 0xD1, 0x96, 0x11, 0x33, 0xDF, 0xDD, 0xCB, 0xC9, 0xB1, 0x71,
+    0xFB, 0x2A, 0x66, 0x74, 0xB4, 0xB1, 0x27, 0x27, 0xD5, 0x91, 0xC9, 0xB4, 0x7F, 0x74, 0x78, 0xA4,
+    0x3B, 0x92, 0x32, 0x2D, 0x83, 0xE8, 0x01, 0x14, 0x1F, 0xF0, 0xA0, 0xCC, 0xC6, 0xED, 0x5D, 0xAC,
+    0x19, 0xD6, 0x46, 0xD2, 0x90, 0xB0, 0x0E, 0xCC, 0x59, 0x32, 0x26, 0xFE, 0x74, 0xCB, 0x0F, 0x48,
+    0x95, 0x5C, 0xC0, 0xA2, 0xD4, 0x2B, 0x7A, 0x7D, 0x43, 0x0E, 0xAE, 0x33, 0x7F, 0xB2, 0x31, 0xA1,
+    0x08, 0x0D, 0x8A, 0x77, 0x06, 0x72, 0x06, 0xEE, 0x63, 0xC1, 0x02, 0xCC, 0xA1, 0xA3, 0x03, 0x15,
+    0x8B, 0xED, 0x94, 0x07, 0x8F, 0x0C, 0x1F, 0xDD, 0xEA, 0x3F, 0xEA, 0x19, 0x4A, 0xC4, 0xD4, 0x26,
+    0x30, 0x47, 0x25, 0xB9, 0x90, 0x79, 0xAC, 0x4C, 0x8D, 0xBD, 0xCB, 0x8A, 0x35, 0x43, 0x22, 0x48,
+    0x51, 0x3A, 0xB6, 0xDE, 0x47, 0xEC, 0x91, 0x9E, 0x9C, 0x71, 0x53, 0xEF, 0xC1, 0x33, 0xBB, 0x07,
+    0x85, 0x5E, 0x95, 0x87, 0x29, 0x43, 0x23, 0x11, 0x6A, 0x2E, 0x13, 0x26, 0xFB, 0x2F, 0x2A, 0xA4,
+    0x4F, 0xB1, 0x7E, 0x46, 0xD5, 0xD5, 0x28, 0x2C, 0x3A, 0x2B, 0xF2, 0x8C, 0xB2, 0x0F, 0xA7, 0xD3,
+    0x09, 0xB6, 0x4B, 0x64, 0xB5, 0x5F, 0x8C, 0x91, 0xB9, 0xCF, 0x4E, 0x46, 0x3B, 0xC8, 0x05, 0x97,
+    0x7C, 0x7C, 0x8D, 0x00, 0x57, 0x66, 0x40, 0x75, 0xA8, 0x0A, 0x07, 0x64, 0x5B, 0xC0, 0xF6, 0xE2,
+    0x7C, 0x3F, 0xE1, 0x33, 0x3F, 0x2A, 0x88, 0xA8, 0xEC, 0xB9, 0x08, 0x4A, 0x98, 0xA7, 0xDB, 0x60,
+    0x39, 0x9A, 0xA0, 0xFC, 0xC4, 0x92, 0x98, 0x16, 0x94, 0x4D, 0x3D, 0x31, 0x5E, 0x8F, 0x2F, 0x1E,
+    0xCD, 0xF0, 0x0E, 0x8D, 0x6F, 0xD9, 0xFC, 0xBF, 0xEC, 0x76, 0x48, 0x42, 0xEF, 0x42, 0x8D, 0x7E,
+    0x73, 0x1D, 0x1D, 0x78, 0x46, 0x4D, 0x69, 0x4B, 0x98, 0x25, 0x75, 0xD8, 0x86, 0x7B, 0x46, 0x23,
+    0x1F, 0x50, 0xEB, 0xB2, 0x8B, 0x79, 0xE7, 0xBF, 0xF6, 0x25, 0x8D, 0x59, 0xC4, 0x72, 0x58, 0x5F,
+    0x45, 0x33, 0x58, 0x14, 0xB9, 0xE2, 0xBD, 0x43, 0x9B, 0xC1, 0x0F, 0xB4, 0x10, 0x73, 0xB8, 0x91,
+    0x34, 0xB4, 0x7A, 0x80, 0xE1, 0x35, 0xEE, 0xBC, 0x8A, 0xED, 0x09, 0xE4, 0xEA, 0xAD, 0x11, 0xA3,
+    0x87, 0x91, 0xF7, 0x28, 0x6F, 0x9A, 0x71, 0x1A, 0x7B, 0xF8, 0xC6, 0xD5, 0xE8, 0xEF, 0xD3, 0xD1,
+    0xF4, 0x2E, 0x8A, 0x54, 0x7E, 0x55, 0x7E, 0x91, 0x6F, 0xF4, 0xBB, 0x6F, 0x9A, 0xBC, 0x9E, 0x19,
+    0x9F, 0xD6, 0x95, 0x5A, 0xA7, 0xDF, 0x6F, 0x04, 0x87, 0x30, 0x74, 0xAA, 0xBF, 0xBD, 0x64, 0xB6,
+    0xD4, 0xED, 0x95, 0xCC, 0x74, 0x6F, 0x1A, 0x3B, 0xA0, 0x7E, 0x80, 0x71, 0x8B, 0x98, 0x28, 0x72,
+    0xA6, 0x9D, 0xDE, 0xBD, 0x12, 0x34, 0xF9, 0xEE, 0x44, 0x5C, 0x95, 0xD9, 0x4F, 0x83, 0x0E, 0xD2,
+    0xE5, 0xAF, 0xF4, 0x1B, 0x1C, 0x1E, 0x77, 0x21, 0xB2, 0x81, 0x4F, 0xD8, 0x91, 0x1D, 0x04, 0x9B,
+    0xDE, 0x7B, 0x31, 0xBF, 0xB6, 0x92, 0xA5, 0xF5, 0xA3, 0xCE, 0xBE, 0x7D, 0xDE, 0xB8, 0xDE, 0x49,
+    0xB6, 0x2D, 0x2C, 0xA2, 0x00, 0x50, 0x0D, 0xF4, 0x09, 0xDF, 0x0F, 0x18, 0x1F, 0xFD, 0x1C, 0x08,
+    0x0F, 0x0A, 0xB6, 0xE6, 0x3E, 0xAD, 0x7E, 0x92, 0xBF, 0x38, 0xCA, 0x75, 0x2C, 0xCA, 0xE5, 0x3E,
+    0xF8, 0x15, 0x82, 0x77, 0x11, 0xB4, 0x08, 0x3E, 0x7C, 0x1D, 0x42, 0xF8, 0x1D, 0xDF, 0x78, 0xBC,
+    0xDD, 0xC1, 0x31, 0x97, 0x0E, 0x66, 0x28, 0x4E, 0x47, 0xEB, 0xEC, 0x46, 0xBD, 0x6C, 0x90, 0x78,
+    0xCB, 0xA6, 0xB2, 0x05, 0xEA, 0x83, 0xCD, 0x84, 0x96, 0x83, 0xC1, 0x53, 0xD4, 0x15, 0x68, 0xF3,
+    0x3C, 0x46, 0xCF, 0xCD, 0xBB, 0x62, 0xD5, 0x9A, 0xFD, 0x81, 0xC6, 0xE3, 0x9C, 0xA7, 0x70, 0x2C,
+    0xFF, 0x74, 0x4B, 0xB1, 0x9F, 0x7A, 0xE5, 0x20, 0xB8, 0xE3, 0xBD, 0x0F, 0xDE, 0x44, 0x30, 0x2D,
+    0x16, 0xA2, 0xEB, 0xAC, 0xF8, 0xC4, 0xAF, 0x42, 0x58, 0xE3, 0xDB, 0x8F, 0xC8, 0xE4, 0xE7, 0xCA,
+    0xC3, 0xE2, 0x8C, 0xF9, 0xFE, 0xBF, 0xC4, 0x91, 0xC0, 0x9E, 0x04, 0x30, 0x89, 0x69, 0xBD, 0x25,
+    0xFF, 0xEE, 0xFA, 0x07, 0xCD, 0x55, 0xB1, 0x8E, 0x1C, 0x45, 0x10, 0x7D, 0x3D, 0x6D, 0x33, 0xD2,
+    0x8D, 0x4C, 0x13, 0x58, 0x42, 0x72, 0xC0, 0x24, 0x04, 0x0E, 0xCC, 0x75, 0x42, 0xE8, 0xDB, 0x69,
+    0x1C, 0x42, 0xC2, 0x1F, 0xF0, 0x09, 0xFE, 0x81, 0xBD, 0x9B, 0x41, 0x84, 0x04, 0xF8, 0x13, 0x1C,
+    0x5F, 0x40, 0xEC, 0x60, 0x97, 0x69, 0x89, 0x80, 0x74, 0x44, 0x4A, 0xC0, 0x88, 0xD4, 0x92, 0xAF,
+    0x25, 0x5A, 0x68, 0x30, 0xB3, 0xDB, 0xBC, 0xEA, 0xB9, 0xF5, 0x1E, 0x0E, 0x2C, 0x21, 0x1D, 0x12,
+    0x2D, 0x75, 0xED, 0xEC, 0x54, 0x77, 0xD7, 0xAB, 0x57, 0xAF, 0x6B, 0x00, 0x28, 0x70, 0x3C, 0xE6,
+    0x2C, 0x7D, 0x95, 0xE2, 0x06, 0x4F, 0xFF, 0xAC, 0x1C, 0xCE, 0x11, 0x50, 0xF9, 0x7B, 0xC0, 0x0C,
+    0x07, 0xE3, 0xE9, 0x9D, 0x38, 0x6B, 0x07, 0x14, 0x81, 0x0F, 0x0D, 0xA7, 0x1E, 0x69, 0xCE, 0x39,
+    0xAB, 0x81, 0x66, 0xC3, 0xC9, 0x75, 0x9F, 0x72, 0x5D, 0xE5, 0xB8, 0x2E, 0x14, 0x51, 0xB5, 0x45,
+    0x4A, 0x69, 0xE8, 0x53, 0x9A, 0xE9, 0x3C, 0xE1, 0x8E, 0x41, 0xB9, 0xD0, 0xC4, 0xF5, 0x83, 0xDD,
+    0x27, 0xB0, 0x06, 0xE6, 0x47, 0x27, 0x67, 0x44, 0x60, 0x0D, 0x58, 0x6E, 0xEF, 0xB8, 0x02, 0x2A,
+    0xE4, 0xC3, 0x9A, 0xFC, 0xBF, 0x1C, 0x72, 0x3C, 0xEE, 0x5F, 0xF1, 0xFF, 0xE7, 0x28, 0xAF, 0x5C,
+    0x91, 0x3A, 0xB4, 0x0E, 0x6F, 0x06, 0x31, 0x83, 0x98, 0x0F, 0x58, 0x04, 0xEA, 0xBC, 0x60, 0x11,
+    0xCC, 0x0F, 0x89, 0xD9, 0x0C, 0x45, 0x28, 0x66, 0x9E, 0x68, 0xBB, 0x7F, 0x87, 0xF9, 0x3E, 0xCC,
+    0x0E, 0x0F, 0x76, 0x79, 0xE1, 0x9C, 0x19, 0x88, 0x02, 0x8F, 0x88, 0x78, 0x8E, 0x1E, 0xEE, 0x97,
+    0x7E, 0x57, 0xF9, 0x9D, 0xF1, 0x13, 0x91, 0x72, 0xBB, 0xCD, 0xA8, 0x09, 0xF4, 0xEC, 0x21, 0x2E,
+    0x22, 0xFA, 0xF1, 0x26, 0x4E, 0x9B, 0x06, 0xBC, 0x97, 0x9E, 0x2D, 0x1C, 0x0A, 0x4A, 0x1D, 0xAE,
+    0x91, 0xAE, 0xEE, 0xF0, 0xE5, 0x57, 0x92, 0x08, 0xF3, 0x67, 0xB0, 0x8A, 0x2F, 0x2D, 0x7F, 0x4F,
+    0x9E, 0x1E, 0x57, 0xDE, 0xCB, 0x10, 0xCF, 0xA1, 0xBD, 0x75, 0x1F, 0x06, 0xA2, 0x8B, 0x0B, 0x42,
+    0xE5, 0x74, 0x72, 0x44, 0x48, 0x48, 0x4C, 0x64, 0x25, 0x00, 0x4B, 0x2F, 0x40, 0x5E, 0x0F, 0x7A,
+    0x8F, 0x7A, 0x60, 0xDA, 0x6D, 0xD0, 0xBF, 0x76, 0xCC, 0xF9, 0xB8, 0xE4, 0x39, 0x59, 0xB4, 0xD3,
+    0x11, 0xDC, 0x9D, 0x6C, 0x4F, 0xB3, 0x6D, 0x3B, 0xB1, 0x49, 0xC8, 0xC3, 0x3E, 0x2F, 0xF8, 0x18,
+    0x6F, 0x8D, 0x7E, 0x40, 0x93, 0x50, 0x11, 0x10, 0x41, 0xF6, 0x59, 0x3A, 0x76, 0x44, 0x4D, 0x2A,
+    0x67, 0x81, 0xAB, 0xAF, 0xA4, 0xAA, 0xEA, 0xF7, 0x20, 0x85, 0xDD, 0x6C, 0xC5, 0xBD, 0x32, 0x5E,
+    0xDC, 0x4F, 0xA2, 0xB8, 0xFD, 0x4A, 0xDC, 0xA1, 0xF2, 0xE2, 0x56, 0x93, 0xB8, 0xD1, 0x88, 0xDB,
+    0x95, 0x2F, 0x49, 0x80, 0x47, 0x12, 0x37, 0x6A, 0x71, 0x43, 0xCF, 0x50, 0xE4, 0xB1, 0x87, 0x62,
+    0xB6, 0xA6, 0xBB, 0x81, 0xC2, 0x89, 0x9C, 0x16, 0x7E, 0xAC, 0x5B, 0x6A, 0x1A, 0x97, 0xD7, 0x07,
+    0xC2, 0xC7, 0x7A, 0xEC, 0x43, 0x1F, 0xF5, 0x6F, 0x7F, 0x44, 0xFD, 0xCB, 0xD7, 0x51, 0xBF, 0x52,
+    0xA1, 0x9C, 0x8B, 0x50, 0x05, 0x3D, 0x9A, 0x51, 0x0F, 0xC6, 0x97, 0xBE, 0xEE, 0x2A, 0x22, 0x33,
+    0x9D, 0xA5, 0xB6, 0x56, 0xA8, 0x7F, 0x38, 0x43, 0x3D, 0xAD, 0x49, 0xDB, 0x8D, 0x38, 0x36, 0xC2,
+    0x24, 0x5F, 0xEC, 0x51, 0x24, 0x56, 0xD8, 0xC3, 0x40, 0x52, 0x27, 0xC9, 0x3A, 0x65, 0x69, 0xFE,
+    0x35, 0x88, 0x2E, 0xD6, 0x33, 0xCE, 0xB8, 0xD6, 0x3A, 0xBA, 0xCD, 0x37, 0x41, 0xDC, 0xC3, 0x56,
+    0xDC, 0xC1, 0x74, 0xE2, 0x2E, 0x82, 0xB8, 0x71, 0x21, 0xEE, 0xCE, 0xFC, 0x24, 0x6E, 0xF5, 0x9A,
+    0x5A, 0x0C, 0x68, 0xC4, 0x8D, 0x72, 0x97, 0x6F, 0x40, 0xA2, 0x92, 0x27, 0x89, 0xD2, 0xA6, 0xE5,
+    0x7A, 0x2D, 0x43, 0x2D, 0x59, 0xCD, 0xD9, 0x36, 0xD9, 0x2E, 0x5C, 0x94, 0xFE, 0x68, 0x95, 0xBB,
+    0xB5, 0xCC, 0xEF, 0x5E, 0x87, 0xB1, 0xD7, 0xF3, 0xF1, 0x4D, 0x72, 0x4F, 0xF0, 0x51, 0xBE, 0xFC,
+    0xC2, 0x3A, 0xB6, 0xD9, 0x9A, 0xAB, 0xBC, 0x2D, 0x65, 0x5B, 0xFF, 0x3F, 0xF5, 0xF2, 0x01, 0xDE,
+    0x67, 0x00, 0x43, 0xCD, 0x54, 0xDF, 0x71, 0xDB, 0x9E, 0x8D, 0x4C, 0xF8, 0x7C, 0x7E, 0x6B, 0x7A,
+    0xC9, 0xFC, 0x6B, 0xA1, 0x09, 0xBB, 0x7C, 0x9E, 0x3B, 0x74, 0x21, 0xD1, 0xE9, 0xD2, 0x36, 0x11,
+    0x18, 0x25, 0x44, 0x3B, 0xCB, 0xFD, 0x3E, 0xB5, 0xBC, 0xE0, 0xE6, 0x7B, 0x7A, 0x25, 0x14, 0x11,
+    0x4B, 0x9B, 0x69, 0xE5, 0x86, 0xDA, 0xCE, 0x48, 0xD3, 0x15, 0x15, 0x8D, 0xDC, 0xA7, 0xA2, 0x48,
+    0x6C, 0x83, 0xB3, 0x47, 0x90, 0xA0, 0x92, 0xF9, 0x5E, 0x8A, 0xBE, 0xFF, 0x07, 0xCD, 0xB7, 0x2A,
+    0xD4, 0x55, 0x16, 0x6A, 0xF5, 0x4E, 0xA1, 0x46, 0xD4, 0x5D, 0x16, 0xEA, 0x22, 0x9A, 0x9C, 0x1F,
+    0x5E, 0x88, 0x19, 0xD7, 0xB9, 0x95, 0x64, 0xBD, 0x9A, 0x45, 0xB5, 0x5F, 0x1E, 0xC4, 0xD0, 0xB5,
+    0xDF, 0xA6, 0x2A, 0xB9, 0x69, 0xBB, 0x15, 0x92, 0xCD, 0x8B, 0xD2, 0xB7, 0xDE, 0xB2, 0x14, 0x93,
+    0x70, 0xDC, 0xA0, 0x56, 0x13, 0x36, 0xA5, 0xA7, 0xBC, 0x98, 0xE6, 0x84, 0xB5, 0x66, 0xEF, 0xAE,
+    0x73, 0x25, 0xD7, 0x0B, 0x87, 0x64, 0xA6, 0xDB, 0xB0, 0x57, 0xB2, 0xCB, 0xF1, 0xE4, 0xD3, 0x2C,
+    0xC9, 0xCB, 0x4B, 0x51, 0x1F, 0xD3, 0x5E, 0x9E, 0x8E, 0xE3, 0x2E, 0xC3, 0x16, 0x89, 0x3C, 0xD5,
+    0x89, 0x1B, 0x7A, 0x67, 0x42, 0x31, 0xB1, 0x46, 0x25, 0x15, 0x33, 0x4B, 0x69, 0x66, 0x29, 0xD2,
+    0x2C, 0x52, 0x9F, 0x2F, 0xC4, 0x6C, 0xDF, 0x18, 0xE9, 0xAD, 0x13, 0x4D, 0x11, 0x77, 0xD2, 0x80,
+    0xB7, 0xF2, 0xC5, 0x68, 0x79, 0x4E, 0xD7, 0x38, 0xD6, 0xA8, 0x1E, 0xCB, 0x19, 0x65, 0xA2, 0xF2,
+    0xD0, 0xEF, 0x0F, 0xB5, 0x3F, 0xB9, 0x7C, 0x46, 0x3A, 0xFC, 0x5B, 0x18, 0x54, 0x12, 0xF9, 0x0F,
+    0x3A, 0xD6, 0x9E, 0x1F, 0xA0, 0xCF, 0x22, 0x7B, 0x80, 0xC7, 0x74, 0x8E, 0xF2, 0x67, 0x6A, 0xF6,
+    0x0B, 0x8F, 0x4D, 0xC3, 0x22, 0xCF, 0xB0, 0x4F, 0xA2, 0x9A, 0xCA, 0x50, 0x7B, 0x43, 0xE1, 0x92,
+    0x9F, 0xE5, 0xAB, 0xFC, 0xDF, 0x8F, 0xBF, 0x01, 0xBD, 0x55, 0x3D, 0x8F, 0xE4, 0x34, 0x18, 0x7E,
+    0x62, 0x73, 0x1B, 0x90, 0x25, 0xB2, 0x05, 0x27, 0x0A, 0x24, 0x4C, 0x41, 0x41, 0x03, 0xA1, 0xA0,
+    0xA0, 0xD8, 0x9D, 0xF8, 0xAA, 0x2B, 0x68, 0xB6, 0x80, 0xDF, 0x41, 0x43, 0xC9, 0x4E, 0x02, 0x14,
+    0x57, 0x50, 0xB0, 0xFF, 0xE4, 0x1A, 0x8A, 0x2D, 0x66, 0x2E, 0xD1, 0x51, 0xD0, 0xA6, 0xA3, 0xB8,
+    0xC6, 0xE8, 0x4A, 0xA4, 0x3B, 0x23, 0x19, 0x29, 0x82, 0x4C, 0xCC, 0xF3, 0x7A, 0x66, 0xF6, 0xA6,
+    0x47, 0x87, 0xB5, 0x6B, 0x4D, 0x62, 0xFB, 0xF5, 0xF3, 0x65, 0x07, 0xC8, 0x2D, 0x14, 0x1D, 0x30,
+    0x19, 0x07, 0xA4, 0x85, 0x8F, 0xCD, 0xC4, 0xAE, 0x70, 0x38, 0xB4, 0x7B, 0x57, 0x80, 0x92, 0x01,
+    0x9B, 0xD2, 0x80, 0xDE, 0x55, 0x41, 0x4D, 0xD0, 0xB1, 0xF4, 0x28, 0xE6, 0x6A, 0x00, 0xE6, 0x9A,
+    0x53, 0xE7, 0x86, 0x33, 0xE7, 0xB5, 0x74, 0xDB, 0xBB, 0x6E, 0x66, 0x99, 0x89, 0x9D, 0x8A, 0x3B,
+    0x40, 0x07, 0xBE, 0x33, 0x63, 0xCB, 0x3A, 0x5D, 0xE3, 0xD0, 0xC2, 0xFA, 0x72, 0x46, 0x99, 0x92,
+    0x07, 0xFA, 0xE5, 0x74, 0xC7, 0xCF, 0x71, 0x53, 0xC4, 0x0A, 0x3A, 0x45, 0x0E, 0xBB, 0x13, 0x24,
+    0xB0, 0x3B, 0xBE, 0xDD, 0xA1, 0x79, 0x30, 0xEB, 0xA0, 0xA2, 0x75, 0xA5, 0x9F, 0x51, 0x3D, 0x1A,
+    0x71, 0x5D, 0xA3, 0x88, 0x1B, 0x98, 0x5F, 0x02, 0x56, 0xD5, 0xA0, 0x62, 0xED, 0x6C, 0xD7, 0x16,
+    0x33, 0x32, 0xE0, 0x08, 0x9C, 0xDF, 0x55, 0xC0, 0x67, 0x05, 0x21, 0xB7, 0x8A, 0x2F, 0xFB, 0x1F,
+    0x88, 0x2A, 0x3D, 0x24, 0xBE, 0x45, 0xF3, 0xF1, 0x43, 0x8C, 0xA7, 0x8C, 0xD1, 0xA7, 0x0E, 0x45,
+    0x4A, 0x33, 0x14, 0x37, 0x1C, 0x32, 0xE5, 0x82, 0xC2, 0xB4, 0xE0, 0x82, 0x6A, 0xD8, 0x0A, 0xA1,
+    0xCC, 0xD9, 0x52, 0xBB, 0xC6, 0x70, 0x6D, 0xF5, 0x34, 0xCA, 0xCB, 0x4C, 0x5A, 0x46, 0xB6, 0x15,
+    0x5F, 0x36, 0xB2, 0x53, 0xED, 0x32, 0x6B, 0x3E, 0xDB, 0xA1, 0x58, 0xD0, 0x0E, 0x22, 0x65, 0x77,
+    0xA0, 0x8D, 0xAB, 0x3B, 0x6C, 0xE1, 0x63, 0x4A, 0xB5, 0x46, 0xC9, 0x1A, 0x15, 0xA9, 0xD4, 0xE5,
+    0x80, 0x8F, 0xCE, 0x70, 0xCA, 0x9E, 0x8C, 0x9C, 0x8E, 0x76, 0xA8, 0x06, 0x33, 0x0A, 0xFD, 0x06,
+    0xDA, 0x5F, 0xA3, 0x1C, 0x37, 0xF9, 0xDF, 0x0C, 0x5C, 0xD8, 0xCD, 0xDC, 0x6F, 0x8B, 0x35, 0x44,
+    0x80, 0x26, 0x05, 0x18, 0x6A, 0x88, 0x57, 0x1A, 0xE2, 0x2C, 0x25, 0x11, 0x5D, 0xFA, 0xE4, 0x6C,
+    0xC4, 0x84, 0xCB, 0x62, 0xC7, 0xF5, 0x08, 0x74, 0xB3, 0x86, 0x66, 0x01, 0xE1, 0x48, 0x7F, 0x75,
+    0x20, 0x01, 0x12, 0x93, 0x74, 0x00, 0xD7, 0xB8, 0xE2, 0x24, 0x45, 0x4D, 0x69, 0x78, 0x45, 0x1B,
+    0x38, 0x69, 0x25, 0x8C, 0x21, 0xBA, 0x90, 0x1C, 0x47, 0x51, 0x77, 0x2C, 0x81, 0xAE, 0x95, 0x12,
+    0x06, 0x0B, 0xE1, 0xE1, 0x82, 0x94, 0x6D, 0xF7, 0x6E, 0x28, 0xF6, 0x3B, 0x52, 0x58, 0x51, 0x15,
+    0xF7, 0x4E, 0x20, 0x15, 0x69, 0x7C, 0x6F, 0x22, 0xA2, 0x2F, 0x5E, 0xFA, 0xE6, 0x41, 0xF2, 0x0D,
+    0xE9, 0x4D, 0xFA, 0xF7, 0x48, 0xB1, 0xAF, 0x85, 0xA1, 0xFD, 0x95, 0x16, 0x1B, 0x4F, 0x92, 0xCF,
+    0xA2, 0xC9, 0x8E, 0xCE, 0xB2, 0x1F, 0x9D, 0x66, 0x9D, 0x2D, 0xF5, 0x54, 0x8F, 0x82, 0x4D, 0x67,
+    0xB1, 0x49, 0xCF, 0x09, 0xAB, 0x8F, 0xD5, 0x22, 0xAA, 0xBE, 0xB1, 0x2F, 0x2D, 0xDD, 0x46, 0xD4,
+    0x0B, 0x12, 0x63, 0x6E, 0xDA, 0x88, 0xCF, 0x37, 0xC7, 0xAD, 0xEF, 0x53, 0xFE, 0x36, 0xD1, 0xDD,
+    0xF4, 0x07, 0x8B, 0x5D, 0xB3, 0xA2, 0x0A, 0xA4, 0x44, 0x04, 0x03, 0xD9, 0x49, 0xAE, 0xB8, 0x59,
+    0x49, 0xB9, 0xF9, 0xFB, 0x09, 0xB0, 0xFB, 0x9A, 0xB2, 0x70, 0x3A, 0xEC, 0x63, 0xE6, 0x68, 0x63,
+    0x1D, 0xA7, 0x8B, 0x44, 0xC3, 0x5A, 0xC4, 0xD8, 0x71, 0x3A, 0x55, 0x37, 0x04, 0xA6, 0x52, 0x54,
+    0xBB, 0x3A, 0xF9, 0x62, 0x39, 0x6C, 0x44, 0x38, 0xF4, 0x93, 0xA5, 0xF9, 0xA7, 0xA8, 0x19, 0xE1,
+    0x7C, 0x70, 0x18, 0x32, 0x93, 0xFD, 0x31, 0xD9, 0x60, 0x7E, 0x9A, 0xF4, 0x33, 0x87, 0x7F, 0x3A,
+    0xE6, 0x8D, 0x49, 0x81, 0xD9, 0x3B, 0x90, 0xA5, 0x17, 0x55, 0xE9, 0x03, 0xE5, 0x24, 0x20, 0xB6,
+    0xAF, 0x9C, 0x84, 0xD3, 0xD3, 0x87, 0xC7, 0xAC, 0x15, 0x0D, 0x6D, 0x66, 0x28, 0xE8, 0x56, 0x2D,
+    0x0B, 0x24, 0x0E, 0x5C, 0x6A, 0x99, 0x04, 0x6C, 0x24, 0xBA, 0x7F, 0xF5, 0x1D, 0xA7, 0xF2, 0xA4,
+    0xAD, 0x7B, 0xAA, 0x10, 0x58, 0x4F, 0xB2, 0x82, 0x46, 0x9C, 0x9B, 0x98, 0xFE, 0x72, 0x2C, 0x99,
+    0x37, 0x98, 0x60, 0xD2, 0x68, 0x22, 0xA3, 0x5F, 0x4E, 0x87, 0xA3, 0x20, 0x5D, 0x2B, 0x1D, 0xA7,
+    0xCB, 0xF6, 0x64, 0x2E, 0xAA, 0x86, 0xE3, 0x18, 0x5B, 0xED, 0xD7, 0x86, 0xF0, 0xD5, 0xF3, 0x05,
+    0x97, 0x3F, 0x43, 0xBF, 0x80, 0xE0, 0x67, 0x3D, 0xD1, 0x4B, 0x2E, 0x08, 0x51, 0x4B, 0x74, 0xDA,
+    0xC7, 0xC5, 0x67, 0x3A, 0xD2, 0xCE, 0xF7, 0xC3, 0x73, 0x66, 0x26, 0x15, 0x2F, 0x0E, 0x35, 0x8B,
+    0x41, 0x13, 0x6E, 0x47, 0x49, 0xED, 0x43, 0xC9, 0x94, 0x5C, 0x26, 0xD9, 0xB5, 0xCB, 0xFF, 0xDB,
+    0xB5, 0xF3, 0xC2, 0x19, 0xB7, 0xC1, 0x2D, 0x8F, 0xC5, 0x6F, 0x3C, 0x1C, 0x94, 0x9E, 0x67, 0xF0,
+    0xEC, 0x98, 0x5C, 0xB5, 0x94, 0xBE, 0xFF, 0x33, 0xE1, 0x93, 0xC6, 0x8B, 0x71, 0x2B, 0x6E, 0x32,
+    0x67, 0xB5, 0xE8, 0xDC, 0x91, 0x56, 0xCC, 0xD6, 0x09, 0x6B, 0x92, 0x2F, 0xC7, 0x23, 0x71, 0xCD,
+    0x5F, 0xBD, 0x83, 0x9D, 0x20, 0x5B, 0x1D, 0x95, 0xBC, 0x2F, 0x97, 0xAC, 0x57, 0x4B, 0xEF, 0x6B,
+    0x57, 0xB9, 0x09, 0x17, 0x3C, 0x84, 0xC1, 0x76, 0x2A, 0x3B, 0x20, 0xD9, 0x95, 0x5B, 0x23, 0xC9,
+    0x52, 0xBF, 0x57, 0xA4, 0x1E, 0x6E, 0xD0, 0x94, 0x1D, 0x36, 0x35, 0x19, 0x6D, 0x50, 0x7D, 0x3F,
+    0x15, 0x33, 0xAF, 0xD4, 0x51, 0x09, 0xD9, 0x77, 0x0E, 0x06, 0xEA, 0x1C, 0x3B, 0x5E, 0x44, 0x02,
+    0xE6, 0x24, 0x76, 0x28, 0x17, 0x86, 0x62, 0xA8, 0xBE, 0x0B, 0x0C, 0xA6, 0x8C, 0xF1, 0x5A, 0x36,
+    0x5C, 0xD7, 0xD3, 0xBD, 0x29, 0x9F, 0x7C, 0x33, 0x7C, 0x53, 0x84, 0xBA, 0x9B, 0x4A, 0x1E, 0xD8,
+    0x36, 0x1E, 0x6E, 0x11, 0x01, 0x4B, 0xCC, 0xD5, 0x2E, 0xDF, 0xF0, 0xD5, 0x70, 0x8B, 0xDB, 0xC3,
+    0xD5, 0xF9, 0x1A, 0xE0, 0xB3, 0xAD, 0xF3, 0xDC, 0xD5, 0x8C, 0x15, 0xF3, 0xAC, 0xC6, 0xB7, 0xF1,
+    0xE9, 0x7F, 0x82, 0xFF, 0xA5, 0x24, 0xA7, 0x33, 0x7F, 0xA7, 0x6E, 0x8B, 0x4B, 0x9D, 0x01, 0x6A,
+    0xE6, 0xE0, 0x4D, 0x26, 0x00, 0x5A, 0xBE, 0x53, 0xE4, 0xA6, 0x09, 0x56, 0x65, 0xB0, 0x5C, 0xD2,
+    0x2B, 0x87, 0xF9, 0xFD, 0x0C, 0xD0, 0x3C, 0xE5, 0x07, 0xC6, 0xF8, 0x92, 0xB7, 0x4D, 0x72, 0x46,
+    0xCE, 0x13, 0x73, 0x28, 0x1F, 0xCF, 0x7A, 0xCC, 0x19, 0x97, 0x04, 0x8B, 0xD5, 0xDB, 0x57, 0x5F,
+    0x33, 0x3A, 0x9C, 0x66, 0xED, 0xBF, 0x25, 0x46, 0xBA, 0xCF, 0xA3, 0xA6, 0x96, 0x0C, 0xD1, 0xFA,
+    0xFD, 0x45, 0x40, 0x84, 0x4F, 0xB4, 0x6F, 0xD3, 0x20, 0xB7, 0x3B, 0x0F, 0xF5, 0x4D, 0x06, 0xBF,
+    0x91, 0x53, 0xC3, 0x13, 0xC3, 0x8F, 0xCB, 0x5B, 0x78, 0x7D, 0xED, 0x5F, 0xCD, 0x55, 0xBF, 0x4F,
+    0x14, 0x41, 0x18, 0x7D, 0xBB, 0x13, 0xD9, 0xC8, 0x86, 0x8C, 0x05, 0x85, 0x06, 0x71, 0x1B, 0x5B,
+    0xD9, 0x86, 0x52, 0x98, 0x0D, 0x14, 0x14, 0x36, 0x14, 0x76, 0x36, 0xFE, 0x09, 0x14, 0x14, 0x57,
+    0x1C, 0x32, 0xD6, 0x34, 0xFC, 0x09, 0xD6, 0x14, 0xDA, 0x50, 0x50, 0x9C, 0xDC, 0x04, 0x0A, 0x4A,
+    0xB7, 0xA3, 0xA0, 0xD9, 0x84, 0x58, 0xD9, 0x4C, 0xB1, 0x26, 0x67, 0x72, 0x77, 0xE3, 0xFB, 0x76,
+    0xF7, 0x94, 0xC4, 0x68, 0x2C, 0x30, 0x38, 0xB9, 0x1F, 0x3B, 0xC7, 0xF7, 0xBD, 0xEF, 0xBD, 0x37,
+    0xF3, 0x7D, 0xE0, 0x3E, 0x9E, 0x21, 0xC3, 0x18, 0xFA, 0xDC, 0x23, 0x09, 0x16, 0xF1, 0x14, 0xC0,
+    0x09, 0xDA, 0xF5, 0x12, 0xC8, 0x42, 0x85, 0xE1, 0x87, 0x51, 0x5C, 0xA3, 0x56, 0x15, 0x7C, 0xD2,
+    0xBE, 0x6D, 0xE2, 0x01, 0x35, 0x61, 0x08, 0x53, 0x60, 0x6A, 0x20, 0x95, 0xBC, 0x50, 0x00, 0xB9,
+    0x7B, 0x0A, 0xED, 0x7A, 0x48, 0xDD, 0xA0, 0x79, 0x6B, 0x7B, 0x8A, 0x7D, 0xEC, 0x87, 0x09, 0x52,
+    0x42, 0x61, 0xB1, 0x01, 0x2E, 0x12, 0xBB, 0x87, 0xBE, 0x2E, 0xD4, 0x75, 0x89, 0x6C, 0x04, 0x30,
+    0x39, 0xB6, 0x5D, 0x51, 0x44, 0xC4, 0x0C, 0x63, 0xAC, 0x27, 0x2E, 0x71, 0xC0, 0x1E, 0x0B, 0x11,
+    0x3F, 0x67, 0xEE, 0xD0, 0x21, 0x62, 0xA4, 0x62, 0xED, 0x1C, 0xBB, 0x91, 0x4F, 0xAB, 0x75, 0x02,
+    0xBB, 0x28, 0x94, 0x44, 0x6C, 0x73, 0x55, 0x08, 0x61, 0x6C, 0xF8, 0x71, 0xE1, 0x72, 0xF4, 0x7B,
+    0xCA, 0x27, 0x07, 0xC5, 0x3A, 0x76, 0x77, 0x92, 0x72, 0x0E, 0xF8, 0xC8, 0x00, 0x4D, 0x48, 0xCA,
+    0xE5, 0x03, 0xEB, 0x45, 0x04, 0x26, 0x54, 0x0B, 0x09, 0x23, 0x0F, 0x2C, 0x23, 0x25, 0x49, 0xBD,
+    0x8D, 0x8B, 0x86, 0x54, 0x69, 0xA4, 0x42, 0x43, 0xED, 0x90, 0x1F, 0xFB, 0x92, 0x39, 0x83, 0x88,
+    0x99, 0x19, 0x51, 0x01, 0x1E, 0x35, 0x01, 0xF3, 0xC0, 0x0A, 0xB0, 0x06, 0xF4, 0x31, 0x17, 0x26,
+    0x86, 0x32, 0xF8, 0xB7, 0x1A, 0x91, 0x97, 0x40, 0x82, 0xAB, 0x12, 0x09, 0x5F, 0x8E, 0xF8, 0x0F,
+    0xB4, 0x3D, 0xD6, 0x97, 0x5E, 0x07, 0x97, 0x4C, 0x84, 0x7F, 0x64, 0xA1, 0x7D, 0x43, 0xC9, 0x4B,
+    0x58, 0x5E, 0x34, 0x5E, 0xCD, 0x63, 0x99, 0x00, 0x69, 0x89, 0xF4, 0x8C, 0x95, 0x8C, 0x30, 0x0A,
+    0xFC, 0x59, 0x9C, 0x99, 0x2D, 0x91, 0x7B, 0x2E, 0xBA, 0xFB, 0xB1, 0x4F, 0x2E, 0xAC, 0x41, 0xEF,
+    0x58, 0x55, 0xC9, 0x16, 0x65, 0xBC, 0x46, 0x5A, 0xCE, 0xE4, 0x4A, 0x82, 0xF0, 0xCC, 0x8A, 0x96,
+    0x74, 0x2B, 0x57, 0x1E, 0xD6, 0x05, 0x4F, 0xE2, 0x06, 0x5D, 0xDC, 0x12, 0xE5, 0xAA, 0x30, 0xE9,
+    0xE0, 0x63, 0x27, 0x0A, 0xF0, 0x1C, 0x78, 0x82, 0xF8, 0x00, 0xF1, 0xB5, 0x95, 0x6D, 0x9F, 0xCE,
+    0x84, 0xCD, 0x10, 0x9C, 0x38, 0xD6, 0xEC, 0xC5, 0x48, 0x3A, 0x42, 0xEA, 0xD1, 0x6C, 0x5F, 0x50,
+    0xA2, 0xFA, 0x3A, 0x96, 0xD3, 0xCC, 0xEA, 0xBF, 0x3B, 0xA3, 0xC1, 0x8D, 0x33, 0x52, 0x61, 0xDA,
+    0x79, 0xFF, 0xD7, 0x67, 0xF4, 0x47, 0xFF, 0x87, 0xC1, 0xBF, 0xFA, 0xBC, 0xFD, 0x3B, 0xFF, 0xBB,
+    0xA5, 0xEA, 0x55, 0xB9, 0xC9, 0x57, 0x3C, 0xDB, 0xCC, 0x48, 0x49, 0x37, 0xC1, 0x2F, 0xCB, 0x04,
+    0xAB, 0xC3, 0x99, 0xB4, 0x46, 0x45, 0x5A, 0x44, 0xA7, 0x87, 0x19, 0xD8, 0x18, 0xAC, 0xB2, 0x27,
+    0x8E, 0x92, 0x1A, 0x8D, 0x18, 0x0B, 0x0F, 0x7A, 0x92, 0x38, 0xB1, 0xE4, 0x44, 0xCE, 0x54, 0x5B,
+    0x31, 0xBF, 0x16, 0x21, 0x99, 0x48, 0xE2, 0xCE, 0x48, 0x02, 0x1F, 0xC9, 0xCA, 0x14, 0xBC, 0x4B,
+    0xF1, 0x34, 0x3A, 0xA5, 0x09, 0x41, 0x5A, 0x2B, 0x0F, 0x72, 0xE3, 0xEE, 0xB5, 0x55, 0xC9, 0x31,
+    0xF1, 0xAB, 0xD0, 0x93, 0x1A, 0x2B, 0xA4, 0xF6, 0x58, 0xDB, 0x9B, 0x9C, 0x72, 0x8F, 0xFE, 0xD0,
+    0x63, 0x14, 0xFB, 0xA8, 0x56, 0x3E, 0xF2, 0xAA, 0x8A, 0xBD, 0x2A, 0x55, 0x95, 0x3A, 0x55, 0x6A,
+    0x97, 0x3A, 0x5D, 0x68, 0x97, 0x21, 0xB7, 0x39, 0x2F, 0x70, 0x1E, 0x7D, 0xD9, 0x32, 0x2F, 0x3E,
+    0xBD, 0xCF, 0x83, 0x1E, 0xEB, 0x51, 0x5A, 0xB5, 0xF2, 0x8F, 0x8E, 0xC4, 0xFC, 0x50, 0xCF, 0x1E,
+    0xFF, 0x07, 0xD1, 0xF3, 0x47, 0x87, 0x9C, 0x41, 0x9E, 0xDF, 0xEF, 0x6E, 0x57, 0x6C, 0xB3, 0x34,
+    0x1E, 0x4A, 0x5B, 0xA4, 0x85, 0x94, 0x96, 0x6B, 0x65, 0xA4, 0x45, 0xBA, 0x21, 0x75, 0xB7, 0x87,
+    0xDD, 0xB1, 0xD3, 0xC5, 0x71, 0x43, 0x2D, 0x91, 0xD9, 0xBA, 0x78, 0x8B, 0xFA, 0xA3, 0x6D, 0x74,
+    0xE3, 0x1B, 0x6B, 0x6B, 0x32, 0x01, 0xDE, 0x8A, 0xFE, 0xDE, 0xB2, 0xB4, 0xC0, 0xA5, 0x34, 0x96,
+    0x74, 0xEC, 0xCF, 0x92, 0x2A, 0x8C, 0xD8, 0xC6, 0xF9, 0x54, 0x06, 0x7D, 0x2B, 0xA7, 0x12, 0x2B,
+    0xDE, 0x48, 0x6F, 0xB2, 0xA3, 0xB8, 0x1B, 0x48, 0xDF, 0xB1, 0x75, 0xA9, 0x6C, 0x24, 0x56, 0x70,
+    0xD0, 0xA4, 0x96, 0xFF, 0x37, 0xB8, 0x93, 0xC9, 0x50, 0xB4, 0xDE, 0x19, 0x49, 0x50, 0xCD, 0x2C,
+    0x34, 0x12, 0xC5, 0xD9, 0x9E, 0x59, 0x4E, 0xF7, 0x25, 0x56, 0x0F, 0xAC, 0x81, 0x38, 0x7C, 0x93,
+    0x7A, 0x0D, 0x3B, 0x81, 0x8F, 0x03, 0xDD, 0x3D, 0x67, 0xCF, 0x6E, 0x70, 0x06, 0x6E, 0x10, 0xFE,
+    0xCA, 0xF1, 0xB7, 0x1F, 0xCC, 0x6E, 0xE9, 0x22, 0x60, 0x01, 0x3B, 0xD2, 0x5D, 0x3C, 0xB4, 0x78,
+    0xAA, 0x49, 0x3A, 0x6C, 0xF2, 0x3C, 0x8D, 0x65, 0xEF, 0xC7, 0xC5, 0xC2, 0xCD, 0xDB, 0x70, 0x37,
+    0x46, 0xFC, 0xAB, 0xF5, 0x1D, 0xBD, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xF6, 0x70, 0x37,
+    0x81, 0x11, 0x0C, 0x25, 0x52, 0x94, 0x98, 0x82, 0x2A, 0xE2, 0xCE, 0x14, 0x94, 0xBB, 0x6B, 0x57,
+    0xA4, 0x48, 0x43, 0xC7, 0xCF, 0xA0, 0xBD, 0xC2, 0x77, 0x6B, 0x68, 0xAE, 0xCC, 0xFD, 0x09, 0x9A,
+    0x48, 0x20, 0x0A, 0x8A, 0x2D, 0xF6, 0x6E, 0x87, 0x50, 0x50, 0x50, 0x60, 0x41, 0x71, 0xED, 0x20,
+    0xE8, 0x52, 0x30, 0x02, 0x4B, 0x19, 0x81, 0xF7, 0x86, 0xF7, 0x79, 0x77, 0x2F, 0xA7, 0xA4, 0x0C,
+    0x3A, 0xAF, 0x76, 0xEC, 0xB1, 0x67, 0xDE, 0xF7, 0xBD, 0xF7, 0xBD, 0x99, 0x01, 0xE4, 0xFA, 0xEE,
+    0x1E, 0xB2, 0x58, 0x41, 0x85, 0x01, 0xF6, 0x69, 0x8F, 0x52, 0x77, 0x78, 0x4F, 0x61, 0x77, 0x95,
+    0x01, 0xCD, 0x2A, 0x20, 0xE6, 0x21, 0xEB, 0x55, 0xC8, 0x82, 0xF2, 0x79, 0x50, 0x9D, 0xF2, 0xC6,
+    0xA9, 0xCE, 0x3A, 0xE3, 0x6C, 0x6D, 0x5D, 0x81, 0xB2, 0x2D, 0x31, 0x6F, 0xCB, 0xEC, 0xD9, 0xC3,
+    0xEA, 0xD1, 0xCF, 0xDF, 0x94, 0xC9, 0x0E, 0x36, 0x1A, 0x8F, 0x7A, 0x0B, 0xA2, 0x52, 0x44, 0x1A,
+    0xCA, 0x2B, 0x98, 0x2B, 0x54, 0x40, 0x01, 0xE5, 0x91, 0x05, 0x9C, 0x10, 0x1E, 0x0C, 0xC7, 0xDE,
+    0x12, 0x98, 0xC2, 0x3A, 0x68, 0x87, 0x08, 0x34, 0x28, 0x6A, 0x98, 0x36, 0xEF, 0xC1, 0x5E, 0x09,
+    0xD8, 0x5A, 0x05, 0x99, 0x50, 0xC9, 0x04, 0x3E, 0xAA, 0x4E, 0x1E, 0x1B, 0xA8, 0x5E, 0x06, 0x96,
+    0xFE, 0xAE, 0x07, 0x12, 0x63, 0x20, 0x4F, 0x83, 0xC4, 0x3B, 0x96, 0xC6, 0x4A, 0x74, 0x4E, 0x12,
+    0x12, 0xD2, 0x64, 0xC9, 0xB1, 0x35, 0x3D, 0x6E, 0x5C, 0xAF, 0xC1, 0x2E, 0xA0, 0x56, 0x04, 0xB4,
+    0x44, 0xB9, 0xCF, 0xFF, 0xA1, 0xA0, 0xFD, 0xC1, 0x7E, 0xD8, 0x61, 0x7F, 0xBA, 0xB9, 0x55, 0x1B,
+    0x11, 0xEC, 0x7A, 0xA3, 0xC4, 0xDF, 0x9B, 0xEF, 0xD1, 0xB6, 0x72, 0x3B, 0xC0, 0xC7, 0x78, 0xF9,
+    0x9A, 0xA7, 0xD6, 0xC0, 0xA6, 0x5F, 0x92, 0x67, 0xF2, 0xAB, 0x5E, 0x7B, 0x81, 0x88, 0x14, 0x4B,
+    0x93, 0x2D, 0xD8, 0x4D, 0x35, 0x05, 0x9B, 0xA1, 0x88, 0xA2, 0x40, 0x50, 0x7F, 0xB6, 0xC4, 0xAA,
+    0xD0, 0x44, 0x0E, 0x57, 0xC1, 0x3E, 0x76, 0x4C, 0xA5, 0xCA, 0xC2, 0x92, 0xD9, 0xA9, 0x30, 0x33,
+    0x6E, 0xC1, 0xC4, 0x94, 0x6B, 0x98, 0x68, 0x1E, 0x16, 0xFA, 0x29, 0xA5, 0x2A, 0x2D, 0x8E, 0x27,
+    0x14, 0xE4, 0x2F, 0xAF, 0x2E, 0x49, 0xA1, 0x68, 0x30, 0xED, 0x45, 0x9F, 0x56, 0x25, 0x8C, 0x0C,
+    0xAA, 0x8E, 0xF7, 0x35, 0x94, 0x88, 0xC9, 0xA2, 0x94, 0xF5, 0x2B, 0x49, 0x6E, 0xDE, 0xE9, 0x51,
+    0xED, 0xE7, 0x32, 0x7A, 0x2A, 0x1A, 0xDB, 0x96, 0xEC, 0xB2, 0x6E, 0xFF, 0xE6, 0xC0, 0x6C, 0x00,
+    0x7F, 0x73, 0x6F, 0x3A, 0xE3, 0x2B, 0xA6, 0x7D, 0x92, 0x53, 0x69, 0xE5, 0x6D, 0x5D, 0xB1, 0xE2,
+    0x51, 0xF7, 0xDA, 0x59, 0xB7, 0xAA, 0x23, 0x96, 0x36, 0x5A, 0xE8, 0xEF, 0x9F, 0x7D, 0xE9, 0x31,
+    0x99, 0x34, 0x13, 0xA8, 0x1F, 0x4F, 0x7F, 0x6A, 0x31, 0x0D, 0x53, 0xB2, 0x1A, 0x24, 0x93, 0x8A,
+    0x33, 0x58, 0x79, 0x11, 0x7D, 0x07, 0x2D, 0x39, 0x18, 0x11, 0xB4, 0x64, 0xED, 0x71, 0x7E, 0x4E,
+    0x8A, 0x3D, 0xF3, 0xD0, 0xED, 0x5B, 0x37, 0x12, 0xA8, 0x92, 0x4B, 0x6B, 0x7A, 0x6F, 0xCE, 0xB8,
+    0xCC, 0x50, 0x89, 0x8D, 0xB2, 0x28, 0x8E, 0x1B, 0x32, 0xD2, 0x5E, 0x52, 0x4C, 0x50, 0x26, 0x0E,
+    0x2C, 0x38, 0xBA, 0x38, 0x17, 0x1E, 0x71, 0x07, 0x6C, 0x84, 0x9B, 0x7C, 0x14, 0x1D, 0x84, 0xA0,
+    0x0C, 0xA9, 0xB7, 0x96, 0xCA, 0xC5, 0x72, 0x56, 0x9A, 0x5D, 0x28, 0x19, 0x2C, 0x36, 0xFC, 0x97,
+    0x83, 0x9B, 0x19, 0x87, 0xB2, 0x26, 0xB9, 0x7B, 0xF3, 0x45, 0x32, 0xFB, 0x3D, 0xA3, 0x26, 0xC7,
+    0xB5, 0x71, 0x4E, 0x2D, 0x94, 0x67, 0x70, 0xD1, 0x21, 0x0F, 0x34, 0xBE, 0xAD, 0x59, 0xAA, 0x9E,
+    0x75, 0xB2, 0x5F, 0x30, 0xF4, 0x62, 0x4A, 0xAC, 0x53, 0xC6, 0x3B, 0x62, 0x47, 0x7F, 0xCD, 0xB9,
+    0xAB, 0x76, 0x9B, 0xD4, 0xB0, 0x4D, 0x82, 0xCB, 0x20, 0x13, 0x0A, 0x73, 0xBE, 0xD0, 0x57, 0x5B,
+    0x13, 0x8A, 0xF3, 0xF6, 0xF8, 0xAD, 0xA7, 0x6B, 0x74, 0x98, 0xF3, 0xC9, 0xCF, 0x5E, 0x2E, 0xDE,
+    0x2D, 0x49, 0xF2, 0x86, 0xBC, 0x20, 0x54, 0x26, 0xB9, 0xC9, 0xEA, 0xAB, 0xCE, 0xF8, 0xE2, 0xA6,
+    0x99, 0x56, 0x29, 0x75, 0x36, 0xA5, 0x35, 0xA3, 0x16, 0xEE, 0x3E, 0xFD, 0x9A, 0x77, 0x64, 0x77,
+    0x67, 0x5C, 0x34, 0x12, 0x27, 0x17, 0xA0, 0xF9, 0x36, 0x94, 0x0A, 0xA3, 0x2B, 0x37, 0xDE, 0x33,
+    0x7E, 0xB4, 0x96, 0x11, 0xCD, 0x83, 0x78, 0x54, 0xC5, 0xBD, 0xCF, 0xFC, 0x3C, 0xA5, 0x41, 0xA5,
+    0x94, 0x76, 0x1E, 0xA1, 0x10, 0x08, 0x63, 0x5D, 0x88, 0x26, 0xD4, 0x28, 0x6A, 0xFE, 0x42, 0x86,
+    0xB3, 0x89, 0x4D, 0x97, 0xDD, 0x3F, 0x29, 0xDE, 0xC3, 0x05, 0xE8, 0x43, 0xD6, 0x01, 0xA2, 0x42,
+    0x39, 0x12, 0x94, 0xBD, 0xE3, 0x58, 0xB8, 0x29, 0x9D, 0xBE, 0xEA, 0x89, 0xFA, 0xE8, 0x93, 0xC4,
+    0xA8, 0xD7, 0xF9, 0x2F, 0x85, 0xB8, 0x24, 0x39, 0xEC, 0x76, 0x1B, 0xDC, 0x22, 0xB5, 0x6F, 0xC7,
+    0xAD, 0x45, 0x87, 0x91, 0x13, 0x5E, 0x9F, 0x53, 0xDE, 0xEA, 0x1A, 0xD3, 0x5C, 0xF6, 0x90, 0xA5,
+    0x94, 0x50, 0xB2, 0x73, 0xBB, 0x0D, 0xF4, 0x96, 0x38, 0xA1, 0xD6, 0xED, 0x14, 0x13, 0x6E, 0xF7,
+    0xBF, 0x77, 0xB2, 0xBF, 0x91, 0x01, 0xF3, 0xFA, 0x9F, 0xCA, 0x05, 0xB3, 0x1E, 0xAD, 0xCF, 0x66,
+    0xF1, 0xCE, 0x96, 0x98, 0x00, 0xC8, 0x32, 0x82, 0x1C, 0x43, 0xAF, 0xB8, 0x7A, 0xAC, 0x69, 0x71,
+    0x7D, 0x80, 0xC8, 0xEA, 0xC6, 0xEC, 0xFA, 0x7C, 0x69, 0x76, 0x1E, 0xC0, 0xE8, 0x76, 0x39, 0x57,
+    0xC4, 0x61, 0x5B, 0xCC, 0xB1, 0xF1, 0x02, 0x4C, 0xB8, 0xF7, 0x05, 0xEE, 0xE2, 0x73, 0x51, 0x50,
+    0xBC, 0x72, 0xF7, 0x4C, 0x26, 0xE8, 0x7A, 0x30, 0xA1, 0xAC, 0x9B, 0x8C, 0x03, 0xEA, 0x43, 0xED,
+    0xE3, 0xCC, 0xB4, 0xEF, 0x62, 0x33, 0x77, 0xD5, 0x96, 0x4B, 0xFD, 0xC3, 0x6F, 0x7D, 0xF1, 0x21,
+    0xCE, 0x32, 0x64, 0xEB, 0xB7, 0xAB, 0xE7, 0x97, 0x8F, 0x87, 0x8F, 0x24, 0x83, 0x07, 0x4F, 0x1E,
+    0xA6, 0xF5, 0x83, 0x27, 0x04, 0x54, 0x6E, 0x7F, 0x96, 0xFF, 0x9A, 0x22, 0x8F, 0x96, 0x3D, 0x1C,
+    0xAC, 0xAE, 0x16, 0x77, 0xB2, 0xD3, 0x70, 0x72, 0x61, 0x2F, 0xDB, 0x23, 0xA2, 0xC7, 0xF2, 0x62,
+    0x72, 0xF8, 0x81, 0x6C, 0xB1, 0xDE, 0xD4, 0x9A, 0xE7, 0x46, 0x31, 0x4C, 0x0E, 0x8E, 0xF8, 0x3B,
+    0x5E, 0x96, 0x61, 0xDC, 0x39, 0xF1, 0x1F, 0x75, 0x55, 0x31, 0x6F, 0xDB, 0x46, 0x14, 0x7E, 0xE4,
+    0x45, 0x62, 0x8A, 0x1B, 0x4E, 0x83, 0x0B, 0xB4, 0x08, 0x52, 0xFE, 0x01, 0xD7, 0xB7, 0x64, 0xE8,
+    0x20, 0x89, 0x74, 0x96, 0x0E, 0x5D, 0x34, 0x34, 0xE8, 0xD0, 0xA1, 0x1D, 0xBC, 0xBB, 0x43, 0x07,
+    0x0F, 0xB2, 0x74, 0x75, 0xC7, 0x2E, 0xFE, 0x09, 0x9D, 0x1B, 0xA0, 0xE8, 0x90, 0xC1, 0x03, 0x1D,
+    0x1D, 0xE2, 0xC1, 0x43, 0x16, 0x66, 0xEA, 0xCA, 0xA1, 0x68, 0x81, 0x2C, 0x3D, 0x14, 0x1C, 0xE8,
+    0xF4, 0xA4, 0xEB, 0xF7, 0x8E, 0x71, 0x6C, 0x39, 0x28, 0x01, 0x9D, 0x78, 0xC7, 0xE3, 0xBB, 0xEF,
+    0xFB, 0xDE, 0xF7, 0x1E, 0x89, 0x48, 0xEE, 0x37, 0x0B, 0x75, 0xE1, 0xD6, 0x85, 0x7C, 0xE5, 0x8E,
+    0x87, 0x64, 0x69, 0x94, 0x28, 0x3A, 0x6B, 0xF7, 0xB2, 0x97, 0xB6, 0x70, 0x89, 0xA7, 0x61, 0x49,
+    0x44, 0x2A, 0xFB, 0xFC, 0xA2, 0xE9, 0x2A, 0xAD, 0xC4, 0x8B, 0xFA, 0xBB, 0x47, 0x58, 0x18, 0xD1,
+    0xD2, 0xE9, 0x70, 0x69, 0xAA, 0x53, 0x61, 0x31, 0x2D, 0x27, 0xEA, 0xB1, 0x9B, 0x64, 0xF5, 0x42,
+    0x38, 0xCC, 0x28, 0x37, 0x4B, 0xF2, 0xA2, 0x51, 0xD4, 0x49, 0xB3, 0x83, 0x79, 0xA5, 0x7F, 0x74,
+    0x13, 0x51, 0xEF, 0x91, 0x4B, 0x68, 0x77, 0x3A, 0x99, 0x9F, 0xFD, 0xF6, 0x33, 0x56, 0xCF, 0x65,
+    0xED, 0xB5, 0xB0, 0x23, 0xBA, 0xB7, 0x0C, 0x6B, 0xCC, 0x85, 0x5B, 0xAC, 0xD4, 0x5F, 0xB6, 0xC2,
+    0x6D, 0x52, 0xAA, 0x76, 0x77, 0x3C, 0xDE, 0x1D, 0x7F, 0x96, 0xBB, 0x61, 0x99, 0x90, 0x57, 0xB6,
+    0xCB, 0x85, 0x9D, 0xD1, 0x70, 0x7F, 0x93, 0xBA, 0x89, 0xBC, 0x6C, 0x0E, 0x28, 0xA1, 0x66, 0x9C,
+    0x95, 0xAD, 0xBC, 0x2A, 0x0C, 0x0D, 0x44, 0xED, 0xE6, 0x7B, 0xEA, 0xC4, 0x90, 0xA6, 0x34, 0x90,
+    0x7E, 0x9E, 0xB6, 0x95, 0xA6, 0x76, 0x46, 0x00, 0x2F, 0xCA, 0xFB, 0x95, 0xB8, 0x0C, 0xAD, 0x5E,
+    0xD3, 0x87, 0x34, 0x34, 0x27, 0x9B, 0x87, 0x8B, 0x7F, 0x7F, 0xFF, 0xA2, 0x1B, 0x7D, 0x4C, 0x45,
+    0xB8, 0x0C, 0x7E, 0xF0, 0xA4, 0xBC, 0xCB, 0x86, 0x4E, 0x29, 0xAB, 0xA9, 0xA0, 0xD4, 0x51, 0x4E,
+    0xC4, 0x8C, 0x86, 0xE5, 0xC1, 0x32, 0xFB, 0xC7, 0xEB, 0x0B, 0x73, 0x44, 0x13, 0x61, 0xE7, 0x99,
+    0xD7, 0x58, 0xBD, 0xC7, 0x7B, 0x8F, 0xF0, 0x4B, 0x3D, 0x86, 0xCC, 0x5F, 0xDF, 0xD1, 0x8C, 0x6E,
+    0xAE, 0x55, 0x08, 0x6D, 0x82, 0xC1, 0xD2, 0x31, 0xA2, 0x21, 0xE4, 0x98, 0x94, 0xA5, 0x9A, 0xA6,
+    0xFC, 0xB0, 0xE3, 0xF7, 0x6A, 0x0C, 0x1A, 0x18, 0x28, 0x84, 0x86, 0x44, 0x08, 0x25, 0xF4, 0x63,
+    0x79, 0x38, 0x1C, 0x1F, 0x8E, 0xED, 0xDF, 0x62, 0xBB, 0xB0, 0x49, 0x8B, 0x08, 0xB2, 0x1E, 0x74,
+    0x69, 0x40, 0x3C, 0x8D, 0x21, 0x82, 0x28, 0x29, 0x81, 0x3E, 0x24, 0xDD, 0x0A, 0xCA, 0xEF, 0xB7,
+    0xB4, 0x7D, 0x61, 0xDB, 0x9A, 0x0E, 0x43, 0x00, 0x97, 0x32, 0xB3, 0x54, 0x91, 0x82, 0xD0, 0xF4,
+    0x88, 0x14, 0x9F, 0xC1, 0x20, 0x12, 0x7E, 0x43, 0x5A, 0x90, 0x29, 0x42, 0xC7, 0x20, 0x6A, 0xCA,
+    0x1A, 0x7E, 0x91, 0x13, 0x5F, 0xC5, 0xBC, 0xD0, 0x47, 0xBC, 0xDD, 0x81, 0x41, 0x66, 0xD3, 0x36,
+    0x59, 0x30, 0x29, 0x27, 0x19, 0x44, 0x3C, 0x02, 0x98, 0x83, 0x2F, 0x30, 0x5C, 0xDA, 0x82, 0xE6,
+    0x47, 0xA2, 0xC9, 0x7E, 0x2A, 0x8F, 0xE9, 0xFB, 0x91, 0xB4, 0x03, 0x22, 0x16, 0x84, 0xCF, 0x4A,
+    0xBA, 0x5F, 0x41, 0x0C, 0xEC, 0xD2, 0xCD, 0x53, 0x0F, 0x71, 0x55, 0x2D, 0x1A, 0x5A, 0x20, 0xA4,
+    0x70, 0x92, 0xC5, 0xAE, 0x70, 0x03, 0x16, 0x53, 0x68, 0x92, 0xBD, 0x5A, 0xB5, 0x54, 0x15, 0xC1,
+    0x60, 0xDE, 0xC3, 0x2B, 0xA0, 0x29, 0x26, 0xEA, 0x29, 0x26, 0x01, 0x11, 0xB3, 0xAB, 0x9E, 0x1C,
+    0x43, 0xCC, 0x59, 0x27, 0xF6, 0xCF, 0x12, 0xA8, 0x33, 0x56, 0x74, 0x87, 0xFE, 0x47, 0x7F, 0xCD,
+    0x82, 0x42, 0x01, 0x9B, 0x36, 0x08, 0x29, 0x59, 0xFF, 0x9D, 0x6B, 0xFD, 0xA9, 0x87, 0x2A, 0x98,
+    0x7A, 0x5E, 0xDE, 0xD1, 0x7F, 0x4B, 0x29, 0x2C, 0xB3, 0x50, 0x3A, 0xF0, 0x56, 0x1A, 0xCC, 0xF8,
+    0xB6, 0x65, 0x6A, 0x56, 0xB6, 0x89, 0x4F, 0x81, 0xDF, 0x2E, 0x88, 0xCE, 0x38, 0x25, 0xE9, 0x5B,
+    0xF0, 0x08, 0x0B, 0x9B, 0xB1, 0xCD, 0xA1, 0x9A, 0x89, 0xAA, 0x72, 0x9C, 0x78, 0x86, 0x44, 0x98,
+    0x72, 0x49, 0xF4, 0xA9, 0xF0, 0xB8, 0xCF, 0x5B, 0xF8, 0x68, 0xC9, 0x26, 0x58, 0xE1, 0xD7, 0x53,
+    0xF9, 0x12, 0xDC, 0x82, 0x91, 0x6F, 0x82, 0x39, 0x87, 0xFB, 0x1A, 0x72, 0xB9, 0x11, 0x38, 0xE2,
+    0x3E, 0xAA, 0x93, 0x04, 0x98, 0x8B, 0x0D, 0xE7, 0xA0, 0x04, 0x2C, 0xE8, 0xCC, 0x6F, 0xAD, 0xD2,
+    0x92, 0xFC, 0x27, 0x40, 0x5F, 0x91, 0x7C, 0xE1, 0x68, 0x2A, 0x9B, 0xCC, 0xB1, 0xF4, 0x92, 0x21,
+    0xCF, 0xAE, 0x7D, 0x51, 0x0F, 0xC3, 0x29, 0x53, 0x05, 0x12, 0x2E, 0x5B, 0x1F, 0x49, 0xDE, 0xCC,
+    0x41, 0xF1, 0x38, 0xBA, 0x60, 0x7B, 0x8E, 0xE8, 0xEB, 0x1E, 0xDB, 0x00, 0xA1, 0x60, 0xBC, 0xCC,
+    0x2D, 0x91, 0xE0, 0x6E, 0xDB, 0x73, 0x35, 0x1D, 0x5E, 0xF5, 0x3A, 0x56, 0xD1, 0x40, 0x51, 0xC4,
+    0x69, 0x2F, 0x21, 0x33, 0x2F, 0x7A, 0xF3, 0xB3, 0xF6, 0xFA, 0xD6, 0x26, 0x13, 0xCF, 0x60, 0xD5,
+    0x57, 0x2C, 0x55, 0x7B, 0x3B, 0xE0, 0x10, 0xBF, 0xB8, 0x83, 0x5F, 0x8A, 0x89, 0xF1, 0x6F, 0xC5,
+    0x7D, 0x6F, 0x71, 0x1A, 0x7B, 0x10, 0x4E, 0x7A, 0x6F, 0xB1, 0xEC, 0x8F, 0x8F, 0x6D, 0xAA, 0x8B,
+    0xFE, 0x4E, 0x6A, 0x24, 0x61, 0x05, 0x05, 0xF3, 0x75, 0x2F, 0xF5, 0xBB, 0x8B, 0x6D, 0x0D, 0xBD,
+    0x64, 0x88, 0xDD, 0x29, 0x6D, 0x62, 0xC5, 0x28, 0x38, 0x1B, 0xD7, 0x38, 0x86, 0x4D, 0x5C, 0xF4,
+    0x86, 0x34, 0xB1, 0x98, 0x27, 0xD4, 0xC6, 0xB5, 0xEC, 0xF5, 0x29, 0xAF, 0x69, 0x36, 0xC9, 0x84,
+    0xD6, 0x5F, 0x7B, 0xAC, 0x89, 0x46, 0xB4, 0x78, 0x17, 0x25, 0xD8, 0xD0, 0x1C, 0x1C, 0x95, 0x11,
+    0x4D, 0xEA, 0xA2, 0x25, 0xE1, 0x46, 0x87, 0xAA, 0x9D, 0x92, 0xBA, 0xF8, 0xDB, 0x24, 0x6D, 0xEA,
+    0xF3, 0x68, 0x00, 0x53, 0x98, 0x8C, 0xCF, 0x1F, 0x6D, 0x55, 0x73, 0x1A, 0xBC, 0x44, 0x29, 0x0F,
+    0x83, 0xC9, 0x37, 0x51, 0x4D, 0x66, 0x23, 0x6D, 0x24, 0x57, 0xF4, 0x94, 0x7C, 0xD4, 0x02, 0x36,
+    0xD1, 0x3D, 0x61, 0xE6, 0x7E, 0xFE, 0xE4, 0xAB, 0x37, 0xB3, 0x48, 0x08, 0xA0, 0xD4, 0xEB, 0x5F,
+    0x36, 0x00, 0xB5, 0x80, 0x34, 0x69, 0x07, 0x87, 0x2A, 0x8B, 0x12, 0xE4, 0x10, 0x0A, 0xE5, 0x8B,
+    0x90, 0x05, 0x97, 0xA0, 0xA5, 0x0E, 0x61, 0x18, 0x1D, 0xC2, 0xF8, 0x64, 0x2D, 0x63, 0xC3, 0xA9,
+    0x57, 0x01, 0xBD, 0xE7, 0x8F, 0x2D, 0x48, 0x1C, 0x34, 0x76, 0x80, 0x1C, 0xFB, 0x1C, 0x57, 0xFF,
+    0x49, 0x9D, 0x97, 0x0F, 0x13, 0x68, 0x3B, 0xEB, 0x85, 0x8E, 0xC2, 0x2D, 0x0E, 0x3B, 0x4A, 0xB0,
+    0x8B, 0xE4, 0x55, 0xC6, 0x67, 0x40, 0x88, 0x0E, 0x49, 0xC2, 0x1F, 0x44, 0x28, 0x63, 0x5D, 0x4A,
+    0x00, 0xE1, 0xCE, 0x60, 0xA8, 0x43, 0xB2, 0xF5, 0xBA, 0x08, 0x8F, 0x7B, 0x0B, 0xC4, 0x46, 0x2B,
+    0xCD, 0xBB, 0x26, 0xCB, 0x7D, 0x8F, 0x36, 0x5C, 0xA4, 0x1F, 0xDC, 0x46, 0x72, 0x00, 0x5F, 0xD2,
+    0xD2, 0xC2, 0xD6, 0x39, 0x8B, 0x90, 0xFD, 0xC9, 0x95, 0xD6, 0xB1, 0xF7, 0x58, 0x1E, 0xCF, 0x01,
+    0xD4, 0x0F, 0x8E, 0x65, 0x1B, 0xB3, 0xA7, 0xBE, 0xE1, 0x8F, 0x43, 0x60, 0x80, 0xC5, 0x61, 0x74,
+    0x50, 0x54, 0x8A, 0x7B, 0x9F, 0xB4, 0x6C, 0x2B, 0x2E, 0x65, 0x80, 0x41, 0x8A, 0x21, 0xCA, 0x73,
+    0xB6, 0x3E, 0x72, 0xA8, 0x83, 0xD1, 0xB5, 0x04, 0x8D, 0xD5, 0xCD, 0xB9, 0x65, 0x1C, 0x9F, 0xC5,
+    0xB1, 0x30, 0x11, 0x6B, 0x5F, 0x0E, 0x3A, 0x4E, 0xB6, 0x3E, 0x07, 0x7D, 0x4B, 0x42, 0xAB, 0x35,
+    0x0F, 0x36, 0xA8, 0x47, 0xC3, 0x7E, 0x2F, 0x62, 0x59, 0x61, 0x33, 0x8E, 0xD2, 0x35, 0x6B, 0x56,
+    0xC4, 0x7A, 0x9B, 0x78, 0x2E, 0x87, 0xC9, 0x94, 0x1F, 0x4F, 0x72, 0x7E, 0x8C, 0x4F, 0x2C, 0x32,
+    0x3B, 0x87, 0x5A, 0x49, 0x3B, 0xE7, 0xCC, 0x9E, 0xCF, 0x39, 0xF5, 0xBA, 0xE2, 0x44, 0x2B, 0xCF,
+    0x86, 0x17, 0x1D, 0x5B, 0x3E, 0xE9, 0xA2, 0xE9, 0x2B, 0xB6, 0x7D, 0x1A, 0x5C, 0xB2, 0xC2, 0x37,
+    0xC3, 0x53, 0xD8, 0xDC, 0x41, 0xF2, 0x1F, 0xC5, 0x55, 0x3D, 0x8F, 0xE4, 0x44, 0x10, 0xAD, 0xB6,
+    0xC5, 0x5A, 0x5C, 0x4B, 0xF4, 0x04, 0x20, 0x40, 0x04, 0xFE, 0x03, 0xDC, 0xF9, 0x0F, 0xCC, 0x87,
+    0xE1, 0x02, 0x02, 0x82, 0x23, 0x00, 0x11, 0x2E, 0x21, 0xD9, 0xA4, 0x1B, 0x8C, 0x77, 0x2C, 0xF1,
+    0x07, 0xF6, 0x27, 0x10, 0x10, 0x5D, 0x02, 0x01, 0xC1, 0x22, 0xCD, 0xE1, 0x96, 0x2E, 0x24, 0xB1,
+    0x74, 0x01, 0xA9, 0x83, 0x3B, 0x90, 0x20, 0xD8, 0x16, 0xF2, 0x1E, 0x86, 0xF3, 0xB8, 0x79, 0xAF,
+    0x86, 0xBD, 0xDB, 0x3D, 0x48, 0x11, 0x23, 0x6D, 0x59, 0xEB, 0xEA, 0xAE, 0x57, 0xF5, 0xEA, 0x55,
+    0x59, 0x84, 0x3F, 0x53, 0xDE, 0x12, 0xB1, 0xF5, 0x6B, 0x22, 0xAE, 0x9E, 0xC3, 0xFC, 0x34, 0x88,
+    0xA4, 0xB1, 0x85, 0xE7, 0x75, 0xB9, 0xF6, 0x5B, 0xC5, 0xB2, 0x99, 0x8A, 0xBD, 0xAC, 0x87, 0xAC,
+    0x13, 0xE7, 0xD3, 0x20, 0xB9, 0xC0, 0x2C, 0x24, 0xE9, 0x65, 0x27, 0x32, 0x98, 0x20, 0x32, 0xA6,
+    0xB8, 0xB6, 0xCB, 0xBC, 0x48, 0xE5, 0x70, 0x65, 0x79, 0x9B, 0xF7, 0x36, 0x30, 0x05, 0x9C, 0xE2,
+    0x18, 0xD3, 0x79, 0x1A, 0xFC, 0xCD, 0x16, 0x30, 0xDF, 0x01, 0x4B, 0x62, 0x07, 0xD3, 0x94, 0x72,
+    0xF3, 0xD7, 0x44, 0x13, 0x81, 0xF6, 0x87, 0x69, 0x1E, 0x4B, 0xD6, 0x4A, 0x5E, 0x8A, 0xF5, 0x52,
+    0x68, 0x80, 0xD5, 0x73, 0x5B, 0xCB, 0x52, 0xE8, 0xAA, 0x84, 0x2E, 0xA4, 0x81, 0x97, 0xA3, 0xF0,
+    0x25, 0x02, 0x57, 0x62, 0x7A, 0x91, 0x07, 0x4C, 0x10, 0xAE, 0x84, 0xF9, 0x31, 0x63, 0xB8, 0xD2,
+    0x8E, 0x2E, 0x44, 0x85, 0x8B, 0x51, 0x63, 0x04, 0x54, 0xA3, 0x56, 0xEF, 0x3F, 0xB7, 0xBD, 0xDA,
+    0x70, 0xCD, 0xB6, 0xD7, 0x73, 0x7C, 0x85, 0x26, 0x55, 0xC7, 0x96, 0xC6, 0xF1, 0x7C, 0x72, 0x51,
+    0xC3, 0xCE, 0x19, 0xC0, 0x7D, 0x88, 0x6A, 0x4D, 0x40, 0x5E, 0xB2, 0x00, 0x1A, 0xB0, 0x96, 0x0C,
+    0x04, 0x78, 0xB9, 0xC3, 0x54, 0xD3, 0x27, 0x9F, 0xE2, 0x32, 0x70, 0x4B, 0xC9, 0xEF, 0xDF, 0xD7,
+    0xBC, 0xF2, 0x9A, 0x65, 0x8C, 0xE2, 0x4A, 0xD4, 0xC8, 0x9C, 0xF7, 0xA6, 0x39, 0x93, 0xF5, 0x7E,
+    0x1B, 0x25, 0x8F, 0x07, 0x70, 0x1B, 0xE3, 0x24, 0xEB, 0x08, 0xDA, 0x2A, 0xD0, 0x6F, 0x7D, 0xEA,
+    0x71, 0x7E, 0x8E, 0xE3, 0x46, 0xCB, 0x26, 0x1F, 0x92, 0xFC, 0xF9, 0x15, 0x5B, 0x86, 0x82, 0x2F,
+    0x8F, 0x03, 0xCE, 0x15, 0xB5, 0x6D, 0x71, 0x6A, 0x87, 0x53, 0x8E, 0xC7, 0x07, 0x70, 0x97, 0x97,
+    0x69, 0x48, 0x7A, 0xB3, 0x4F, 0x98, 0x40, 0x13, 0xA7, 0xAB, 0x0E, 0x7C, 0x52, 0x4A, 0x16, 0x81,
+    0x15, 0x7F, 0x41, 0x5E, 0x95, 0x19, 0x01, 0xA1, 0x97, 0x2B, 0xDC, 0xB1, 0x1E, 0xC4, 0x8D, 0x68,
+    0x7D, 0x01, 0x88, 0xAF, 0xD1, 0x84, 0x88, 0xAC, 0x9F, 0xAC, 0xFF, 0x86, 0xF0, 0x37, 0x21, 0xF2,
+    0x03, 0x44, 0xF8, 0x27, 0x04, 0x69, 0xC2, 0xAB, 0xF6, 0x08, 0x86, 0xAD, 0xD8, 0x01, 0x03, 0xC5,
+    0xAE, 0xA0, 0x43, 0xDC, 0x7C, 0x97, 0x44, 0x7C, 0xA4, 0x75, 0x90, 0x8C, 0x03, 0xC3, 0x8E, 0xAC,
+    0x56, 0xBC, 0x48, 0x92, 0x2D, 0x65, 0xB4, 0x62, 0x1C, 0x56, 0x4C, 0x6E, 0x29, 0x00, 0x50, 0xD3,
+    0x51, 0x39, 0xF5, 0x0B, 0x98, 0x6D, 0x04, 0x09, 0xB4, 0x8F, 0x11, 0xC7, 0x33, 0x64, 0xE6, 0xF5,
+    0x64, 0xB9, 0x52, 0x21, 0xB2, 0x21, 0xB9, 0x50, 0x8B, 0xB7, 0x85, 0x4A, 0x9D, 0x2B, 0xE2, 0x89,
+    0xF6, 0xBF, 0x67, 0x70, 0x13, 0xA8, 0xA2, 0xB4, 0x65, 0x2F, 0x32, 0xED, 0x88, 0x2B, 0x0F, 0x0D,
+    0xA4, 0xD8, 0x37, 0xC4, 0x36, 0xC3, 0x95, 0x8A, 0x26, 0x10, 0xC2, 0x92, 0x98, 0xE7, 0xA9, 0xC6,
+    0xAB, 0xD4, 0x6E, 0xE4, 0x1C, 0xF6, 0x5C, 0xBE, 0x85, 0xFD, 0x46, 0x3E, 0x83, 0xFD, 0xF2, 0x5F,
+    0x58, 0xD8, 0x30, 0x0C, 0x59, 0x48, 0x4B, 0x2D, 0x8B, 0x30, 0x57, 0x2C, 0x94, 0x98, 0x49, 0xD4,
+    0xE5, 0x28, 0xD1, 0xD3, 0x97, 0x58, 0x30, 0x35, 0xFB, 0xC9, 0x4C, 0x36, 0x52, 0x94, 0x6F, 0x76,
+    0x96, 0xF1, 0x1A, 0x2D, 0xFC, 0x6D, 0x9D, 0xF0, 0x33, 0x13, 0x91, 0x98, 0x6C, 0x7D, 0x36, 0x49,
+    0xD3, 0x65, 0x51, 0x5E, 0x7D, 0x80, 0x92, 0x4F, 0x3F, 0x47, 0x4A, 0x26, 0x28, 0x79, 0xC1, 0x7A,
+    0x72, 0x90, 0x74, 0x2B, 0x05, 0x4D, 0xFD, 0x50, 0xA8, 0xD4, 0xEE, 0xB6, 0xAA, 0xEE, 0x3B, 0xC5,
+    0x31, 0xD3, 0x30, 0x1A, 0x13, 0x0C, 0xFC, 0xF8, 0x54, 0x27, 0x63, 0xEF, 0xBE, 0xA0, 0xDB, 0x76,
+    0x95, 0x06, 0x69, 0x4C, 0xE0, 0x78, 0x67, 0x08, 0x56, 0xE0, 0xF8, 0xB6, 0x5C, 0xB2, 0x45, 0xD9,
+    0x00, 0x22, 0xBF, 0xC7, 0xBF, 0x35, 0x16, 0xC3, 0x5E, 0xEC, 0x20, 0x4D, 0x48, 0xF6, 0xF8, 0xD7,
+    0x45, 0x9F, 0x8C, 0x32, 0xBB, 0xEA, 0x94, 0xF9, 0x18, 0x6C, 0x4C, 0x50, 0xF9, 0x84, 0x72, 0xB1,
+    0x49, 0x92, 0x9E, 0x25, 0xBD, 0x85, 0xEE, 0xE8, 0x34, 0x42, 0x82, 0x6F, 0xEC, 0x41, 0x42, 0x27,
+    0xB7, 0xD8, 0xE4, 0x1C, 0x80, 0x98, 0x15, 0x59, 0x61, 0x06, 0x87, 0x13, 0xB1, 0x8F, 0x82, 0x6C,
+    0x6D, 0xB0, 0xC1, 0x41, 0x68, 0x96, 0x83, 0xF2, 0x42, 0x6A, 0x45, 0xF4, 0x2E, 0x76, 0x47, 0xF1,
+    0x2C, 0xC1, 0xC5, 0x9C, 0x73, 0x45, 0xE2, 0x6C, 0x47, 0x5D, 0xD9, 0x5E, 0x87, 0x4D, 0x77, 0x86,
+    0xDB, 0x92, 0x6D, 0x77, 0xAF, 0x86, 0xDB, 0x7D, 0x40, 0xB7, 0x7B, 0x0F, 0xEE, 0x21, 0xA7, 0x24,
+    0xAA, 0x9C, 0xB5, 0x14, 0xC7, 0xD4, 0xA1, 0xBD, 0x20, 0xD7, 0x69, 0xD4, 0x26, 0x4C, 0xAA, 0xD1,
+    0x53, 0x55, 0x63, 0xA1, 0x32, 0x6D, 0x46, 0x59, 0x83, 0x67, 0x52, 0x7E, 0x4D, 0x88, 0x33, 0xE3,
+    0x55, 0x08, 0x41, 0x5B, 0x46, 0x21, 0xD8, 0xCB, 0x41, 0x17, 0x5D, 0x7F, 0xD8, 0xC2, 0x2F, 0xED,
+    0xBF, 0xFF, 0x3D, 0xEB, 0x23, 0xF0, 0x18, 0xB2, 0x91, 0x2B, 0x38, 0x7A, 0xE8, 0x18, 0x72, 0x01,
+    0x42, 0xCD, 0x2D, 0xDF, 0x71, 0x01, 0x53, 0xD1, 0x03, 0x9B, 0x93, 0xDF, 0x45, 0x65, 0xC9, 0x65,
+    0xAF, 0x1F, 0x09, 0x8A, 0xE7, 0x29, 0xEB, 0xAA, 0x28, 0x05, 0xDB, 0x52, 0xAB, 0x3B, 0x0E, 0xB0,
+    0xF3, 0x45, 0xCD, 0x69, 0x1D, 0x99, 0x2E, 0xCA, 0xE0, 0xB8, 0x97, 0x49, 0x1C, 0x12, 0x6E, 0x5E,
+    0x6F, 0xC3, 0x8D, 0xE2, 0xA1, 0x75, 0x54, 0x6D, 0x75, 0x21, 0x27, 0x1D, 0x41, 0x5D, 0xC9, 0x99,
+    0x9A, 0x73, 0xFE, 0x0E, 0x2A, 0xB3, 0x35, 0x07, 0x78, 0x71, 0x18, 0x51, 0x5D, 0xAE, 0x75, 0xA1,
+    0x2F, 0x46, 0xBE, 0xD0, 0x14, 0x4B, 0x0A, 0x64, 0xC3, 0x61, 0x4C, 0x3B, 0x5E, 0x2C, 0x48, 0x22,
+    0xC8, 0x59, 0x4A, 0x7A, 0x51, 0x63, 0xDE, 0xF2, 0x51, 0xB6, 0x7B, 0x59, 0xD5, 0x19, 0x96, 0xD8,
+    0xEC, 0x06, 0xBE, 0x05, 0x07, 0xC5, 0x24, 0x47, 0x78, 0xAC, 0x00, 0x80, 0xFA, 0x1B, 0xAF, 0x8F,
+    0x67, 0x5E, 0xCC, 0x33, 0x9F, 0xFC, 0xEA, 0x25, 0xF9, 0xB9, 0xCD, 0x7E, 0xF0, 0x92, 0x3E, 0x6A,
+    0xDD, 0x3D, 0x2F, 0xD9, 0xC3, 0x2E, 0x67, 0x87, 0x1E, 0x76, 0x0B, 0x64, 0xEB, 0xDE, 0x0F, 0x27,
+    0x7C, 0x24, 0x21, 0xE0, 0x51, 0x98, 0xDF, 0x3A, 0xFD, 0x52, 0xFD, 0xEE, 0xB1, 0xD5, 0x17, 0x12,
+    0x4B, 0xB4, 0x73, 0x23, 0x91, 0x5D, 0x3D, 0xC7, 0xF7, 0x29, 0xE7, 0xA6, 0x39, 0x41, 0x76, 0xF8,
+    0x84, 0xCE, 0xF0, 0x78, 0x67, 0xE2, 0xA4, 0x75, 0xE4, 0x32, 0x8B, 0x41, 0xFE, 0xBB, 0xDF, 0x5F,
+    0xB5, 0x55, 0xB1, 0x8E, 0xE4, 0x44, 0x10, 0x2D, 0xDB, 0x77, 0xE3, 0xC0, 0x81, 0x2F, 0x07, 0xC9,
+    0x5F, 0x80, 0xFC, 0x05, 0x33, 0xDD, 0xF9, 0x25, 0x24, 0x0B, 0xC1, 0x7E, 0xC4, 0x6E, 0x40, 0x70,
+    0xC1, 0xCC, 0xAE, 0x2F, 0x26, 0xD9, 0x80, 0x5F, 0x20, 0xB9, 0x98, 0xE0, 0x90, 0x66, 0xE4, 0x96,
+    0x2E, 0x20, 0xB5, 0x90, 0xC8, 0x1D, 0x10, 0x41, 0x80, 0x91, 0x8C, 0xE4, 0x5D, 0xB5, 0xDD, 0xBC,
+    0x57, 0xED, 0x19, 0x8E, 0xD3, 0x21, 0x21, 0x21, 0xAC, 0x9D, 0x9E, 0x9D, 0xAE, 0xEA, 0xAA, 0x57,
+    0xAF, 0x5E, 0xB5, 0x45, 0xF4, 0xA9, 0x83, 0x2B, 0x43, 0xBF, 0x09, 0x0F, 0x69, 0xE8, 0xA5, 0xB2,
+    0x52, 0x3A, 0x29, 0x9C, 0x64, 0xBD, 0x64, 0x83, 0x24, 0xA3, 0x88, 0x17, 0x39, 0x8A, 0xEC, 0x44,
+    0x8C, 0xA8, 0xB9, 0x91, 0xE2, 0xA7, 0xAB, 0x6B, 0x98, 0x43, 0x08, 0x30, 0x2F, 0x6F, 0xDE, 0xC0,
+    0xE3, 0x4E, 0xCD, 0x75, 0x34, 0x3B, 0xC9, 0x3B, 0x9E, 0x4E, 0x61, 0x9E, 0xF4, 0xF4, 0x21, 0x9A,
+    0x85, 0xE6, 0xD6, 0xCB, 0xCD, 0x22, 0x6D, 0x10, 0x13, 0x1A, 0xA4, 0x7F, 0xFE, 0xB9, 0x48, 0x1A,
+    0x16, 0xC4, 0x0E, 0xC1, 0x49, 0x6B, 0xCB, 0x21, 0x9D, 0x24, 0x1B, 0xF3, 0x5E, 0x12, 0x0F, 0x28,
+    0xE2, 0x11, 0x54, 0x3C, 0x4E, 0x8B, 0xBF, 0xE3, 0x72, 0xBA, 0x2C, 0x48, 0x9B, 0x4C, 0x58, 0xD2,
+    0x71, 0x16, 0xA4, 0xC3, 0x5E, 0xD1, 0xDD, 0x23, 0x4E, 0x63, 0xAC, 0xDC, 0x4B, 0xD5, 0xE7, 0x5E,
+    0xF2, 0x80, 0x9A, 0xA4, 0x45, 0x74, 0x49, 0xAC, 0x9C, 0x9F, 0x16, 0xC8, 0x67, 0xB9, 0x51, 0xFC,
+    0xC8, 0x53, 0x29, 0xE4, 0x58, 0x39, 0x21, 0x3A, 0x62, 0x05, 0xD0, 0x9D, 0xD6, 0x7B, 0x50, 0xDC,
+    0x27, 0x2D, 0x20, 0xF2, 0xE0, 0xB5, 0x9E, 0x89, 0x9B, 0xE4, 0xE7, 0x28, 0xE9, 0xC0, 0x4D, 0x14,
+    0x8C, 0xCD, 0x48, 0x1A, 0xD8, 0xC3, 0x26, 0x58, 0xA8, 0x83, 0xDC, 0xCF, 0x48, 0x98, 0x20, 0xA1,
+    0xC8, 0x95, 0x25, 0xA2, 0x4E, 0xC2, 0x13, 0x4A, 0x3F, 0xE0, 0x4C, 0xE1, 0x90, 0xDF, 0x23, 0x68,
+    0xD9, 0x64, 0x7D, 0x32, 0x61, 0xAF, 0xB2, 0xA5, 0x4B, 0x07, 0x30, 0x67, 0x92, 0x99, 0x14, 0xA3,
+    0x94, 0xC5, 0xA2, 0x30, 0xD1, 0xEC, 0x04, 0xA7, 0xA9, 0x89, 0x4C, 0xF3, 0xA6, 0x61, 0x62, 0x41,
+    0xDC, 0x96, 0xE7, 0x96, 0xDD, 0x1C, 0xF1, 0x09, 0xAE, 0x18, 0x13, 0x0F, 0x22, 0x73, 0x07, 0xD2,
+    0xDE, 0xB2, 0xA5, 0x6C, 0x06, 0x6B, 0x20, 0x36, 0x2D, 0x80, 0x45, 0xC7, 0xA0, 0xFA, 0x0F, 0x29,
+    0x2D, 0x68, 0x02, 0x85, 0xCF, 0x32, 0x2F, 0x69, 0x57, 0x3D, 0x7E, 0xE1, 0xE5, 0x9E, 0xAD, 0x51,
+    0x02, 0x5F, 0x44, 0xF2, 0xD8, 0x76, 0x6F, 0xB0, 0xFC, 0xE0, 0x6A, 0xD9, 0xBF, 0xCA, 0x86, 0xFC,
+    0x6B, 0xBB, 0x93, 0xAF, 0x6E, 0xF3, 0x6E, 0x13, 0x83, 0x28, 0x44, 0x2F, 0x4A, 0xA1, 0x12, 0x44,
+    0xFE, 0x94, 0x9D, 0x8F, 0xA4, 0x67, 0x0F, 0x5B, 0x50, 0x63, 0x42, 0xB7, 0x36, 0xC7, 0x04, 0xDB,
+    0x2E, 0x35, 0xDA, 0x33, 0x81, 0x9A, 0xD2, 0xE1, 0x5C, 0xC5, 0xC3, 0x5B, 0xAA, 0x09, 0x60, 0xA7,
+    0x84, 0x64, 0x67, 0xF0, 0x3E, 0xE6, 0x08, 0x70, 0x28, 0x71, 0x64, 0xF7, 0x19, 0xCF, 0xED, 0x99,
+    0x89, 0x59, 0xCA, 0xEE, 0x8C, 0x82, 0xC6, 0x17, 0x5B, 0x2C, 0xDF, 0x93, 0x32, 0x4A, 0x01, 0x02,
+    0xBB, 0xC8, 0x80, 0xA9, 0x00, 0x63, 0xE1, 0xCE, 0x8E, 0xBF, 0xAB, 0x07, 0xFC, 0x64, 0x7F, 0xEA,
+    0x5F, 0x9F, 0x20, 0xCF, 0x66, 0x2A, 0xFA, 0xDA, 0x6E, 0xC5, 0x57, 0x4D, 0x65, 0x6B, 0xB4, 0xCA,
+    0x15, 0xEF, 0x06, 0xF4, 0x66, 0x98, 0xD0, 0x01, 0x28, 0x72, 0x2B, 0xBB, 0xD2, 0x55, 0x62, 0xD2,
+    0x29, 0x77, 0xC6, 0x9A, 0x1F, 0x7F, 0x6F, 0x2D, 0xC8, 0x01, 0x55, 0x9B, 0xF6, 0x1B, 0x46, 0x93,
+    0x73, 0x91, 0x26, 0xB0, 0x39, 0x57, 0x7F, 0x65, 0xC6, 0xC8, 0x41, 0x0F, 0xD5, 0x62, 0x6F, 0x46,
+    0x48, 0x58, 0x7B, 0xE9, 0x15, 0xC2, 0x9D, 0xF6, 0xD6, 0x28, 0x47, 0xD5, 0x4B, 0x2D, 0xE1, 0x37,
+    0x1E, 0xC8, 0xBD, 0x52, 0x3F, 0x6A, 0xC8, 0x49, 0x43, 0xE8, 0xCE, 0x9E, 0x23, 0x91, 0x0C, 0xE4,
+    0x35, 0xEF, 0xA0, 0x63, 0x70, 0xCE, 0xC2, 0x77, 0x94, 0x75, 0x94, 0xE4, 0x27, 0xC1, 0x56, 0xA1,
+    0x31, 0xFC, 0x73, 0x17, 0xF9, 0x53, 0x8D, 0x37, 0x8F, 0x49, 0xFB, 0x33, 0x25, 0x8A, 0xEC, 0xC5,
+    0xFB, 0xC2, 0xFF, 0x98, 0xFC, 0x8F, 0xDA, 0x3B, 0xAF, 0x3C, 0x4D, 0x6C, 0x1F, 0xFB, 0x7A, 0xD2,
+    0x01, 0xFF, 0x40, 0xFE, 0x3D, 0x4D, 0x88, 0x0A, 0x53, 0x41, 0xF9, 0x93, 0x10, 0xCE, 0x5B, 0x88,
+    0x8C, 0xEB, 0xBA, 0xD5, 0x75, 0xAF, 0xEB, 0x2B, 0x5D, 0xBF, 0xD3, 0xF5, 0xF6, 0xDC, 0x96, 0xD7,
+    0xC1, 0xD7, 0x33, 0xE0, 0xB1, 0xF9, 0x16, 0x21, 0x6B, 0x46, 0x34, 0x10, 0x33, 0xF2, 0x03, 0xEB,
+    0x81, 0x20, 0x4F, 0x8C, 0x7F, 0x94, 0x7C, 0xDC, 0x78, 0x6A, 0x92, 0x53, 0xF0, 0x44, 0x7E, 0x88,
+    0x26, 0xAA, 0x2D, 0x2E, 0xBD, 0x72, 0x73, 0x6E, 0x05, 0x2E, 0x1F, 0x78, 0xCF, 0x97, 0x4E, 0x60,
+    0x7C, 0xCC, 0x52, 0x86, 0x6E, 0x13, 0x9A, 0xB6, 0xAF, 0x1F, 0x09, 0xFE, 0x10, 0x19, 0x41, 0x1C,
+    0xAD, 0x5A, 0x25, 0x88, 0xCA, 0x38, 0xA3, 0x02, 0xDD, 0x8D, 0x91, 0x98, 0xBC, 0x8B, 0xB3, 0x5F,
+    0xEB, 0x65, 0x39, 0x80, 0x00, 0x65, 0x0D, 0xE9, 0x94, 0x1F, 0x3A, 0x10, 0xCA, 0x9E, 0x32, 0xF8,
+    0x87, 0x60, 0x1A, 0x82, 0xFC, 0x5A, 0x75, 0x28, 0xC8, 0x52, 0xF0, 0x91, 0xAD, 0x30, 0xFE, 0x27,
+    0x88, 0xDB, 0xFF, 0x13, 0xE2, 0xDA, 0xD0, 0xE0, 0xD7, 0x0B, 0xA1, 0x8F, 0xDF, 0xD5, 0xAA, 0xEF,
+    0xFD, 0x0A, 0x7B, 0xDD, 0x2E, 0xD6, 0xED, 0x4F, 0x2F, 0xD7, 0x07, 0x70, 0x20, 0x06, 0x66, 0x06,
+    0xDD, 0xC7, 0xE1, 0xC2, 0x22, 0xC1, 0xED, 0xE5, 0x32, 0xD2, 0xC1, 0x5D, 0xBE, 0xE5, 0xFB, 0x60,
+    0x96, 0xF4, 0x8F, 0x6B, 0xDC, 0x84, 0x52, 0x39, 0x85, 0xCF, 0xE6, 0x03, 0xB3, 0x87, 0x5F, 0xE9,
+    0x70, 0x4D, 0x8E, 0xE2, 0x93, 0x25, 0x01, 0x18, 0x8B, 0x80, 0xEF, 0xCD, 0xB5, 0x4E, 0x18, 0x04,
+    0x13, 0x1C, 0xDE, 0x6A, 0x00, 0xDD, 0x28, 0x36, 0x13, 0x25, 0x40, 0x8A, 0x50, 0x60, 0x1C, 0x10,
+    0xD5, 0xF1, 0x2E, 0x66, 0x3E, 0xFB, 0xFC, 0xF2, 0xA0, 0x3E, 0x88, 0x4A, 0xD9, 0xCC, 0xD7, 0x13,
+    0x15, 0x75, 0x80, 0xC9, 0x2B, 0x0F, 0x9D, 0xC6, 0x49, 0xC6, 0x18, 0xE7, 0x44, 0x9F, 0x09, 0x77,
+    0x80, 0xFA, 0x54, 0x8D, 0xFA, 0xD4, 0x2C, 0x0D, 0xB0, 0x5E, 0xB7, 0x13, 0xBE, 0x16, 0x59, 0xC5,
+    0xFF, 0x37, 0x70, 0x44, 0xA6, 0x29, 0x89, 0x49, 0x95, 0xEA, 0xD7, 0x6B, 0x48, 0x37, 0x01, 0x22,
+    0xE3, 0xFB, 0x70, 0xFE, 0xD2, 0x23, 0x6E, 0xDD, 0xD4, 0x36, 0x1B, 0xE0, 0xE9, 0xE1, 0x69, 0x90,
+    0xAF, 0x6C, 0x38, 0x03, 0xB5, 0xAD, 0x3A, 0xA4, 0xC1, 0xE7, 0x83, 0xEA, 0xFF, 0xDD, 0xF3, 0x27,
+    0xAD, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xBB, 0x13, 0x79, 0x82, 0x46, 0x64, 0xF2, 0x03,
+    0x50, 0xA6, 0x45, 0x22, 0x78, 0x9B, 0x94, 0xBE, 0xDB, 0x0D, 0x48, 0x20, 0x91, 0x86, 0x02, 0x44,
+    0x91, 0x02, 0x6A, 0x84, 0x94, 0x26, 0x85, 0x8B, 0x3D, 0xDF, 0x06, 0x17, 0x2E, 0x52, 0x40, 0xC3,
+    0x9F, 0x88, 0x08, 0x69, 0x52, 0x18, 0xE9, 0x7C, 0xB7, 0x24, 0x05, 0x45, 0x8A, 0x4C, 0x40, 0xA9,
+    0x5C, 0x64, 0x14, 0x90, 0x2C, 0x25, 0x52, 0x32, 0x28, 0x13, 0x58, 0x93, 0xBD, 0x1B, 0xDE, 0x9C,
+    0x89, 0xCF, 0x12, 0x2D, 0xAB, 0xDB, 0xB5, 0x6F, 0x77, 0xF6, 0x7B, 0xDF, 0x7B, 0xF3, 0xBE, 0x77,
+    0xC0, 0x27, 0x40, 0x11, 0x03, 0x4C, 0x8C, 0x8D, 0x6A, 0x65, 0xC8, 0x1D, 0xC6, 0xF0, 0xD0, 0xF6,
+    0x3C, 0xF2, 0x0E, 0xC0, 0x16, 0x4F, 0xD3, 0x00, 0xD2, 0x21, 0xC6, 0x0E, 0xE3, 0x27, 0x73, 0xDE,
+    0x28, 0x79, 0xEA, 0x16, 0x50, 0xF6, 0x63, 0x08, 0xBF, 0x09, 0x11, 0x4A, 0x88, 0x4E, 0x79, 0xD5,
+    0x71, 0x51, 0x80, 0x8A, 0x16, 0x38, 0x85, 0x7F, 0x8F, 0x4F, 0x13, 0x80, 0x5D, 0xE3, 0xCB, 0x6B,
+    0xF1, 0x5B, 0x15, 0x63, 0x0B, 0x53, 0x69, 0x27, 0x3B, 0xA8, 0x56, 0x59, 0x82, 0x09, 0x2F, 0x2D,
+    0x94, 0x43, 0x2F, 0x1C, 0xB2, 0x0E, 0xC3, 0xCC, 0x27, 0x00, 0x53, 0xF5, 0x09, 0x43, 0x3D, 0x64,
+    0x03, 0xC2, 0x8B, 0x18, 0x2B, 0xA0, 0xC3, 0xE2, 0x16, 0x51, 0x87, 0x18, 0xE5, 0x5C, 0x63, 0xAA,
+    0xA2, 0x9A, 0x20, 0x55, 0x69, 0x8B, 0x0A, 0xC2, 0xB1, 0x8E, 0x03, 0x1F, 0x74, 0xE8, 0x53, 0x9D,
+    0x11, 0xCA, 0x26, 0xEB, 0x51, 0x40, 0x76, 0x79, 0x8F, 0xD9, 0x1C, 0x33, 0x76, 0x30, 0x8B, 0x95,
+    0x8C, 0x6E, 0xD9, 0x56, 0x86, 0xE3, 0x23, 0x8B, 0xBC, 0x27, 0xD3, 0x45, 0x05, 0xD5, 0x42, 0x7A,
+    0x56, 0x59, 0x16, 0xE2, 0x67, 0x90, 0xF0, 0x4C, 0xC5, 0x56, 0x64, 0x4B, 0x45, 0x12, 0x70, 0xF9,
+    0x84, 0x4F, 0x44, 0x4C, 0x42, 0x4C, 0x6F, 0xF1, 0x32, 0x50, 0xA9, 0x29, 0xC1, 0x27, 0x45, 0x7A,
+    0xC7, 0x54, 0x7C, 0xA7, 0x68, 0x0C, 0xB2, 0x31, 0x5B, 0xCB, 0x62, 0x5B, 0x2C, 0xD8, 0x4A, 0x11,
+    0xDB, 0x13, 0x88, 0x26, 0xDC, 0x66, 0x2F, 0x3E, 0xEF, 0x0A, 0x27, 0xAD, 0xB4, 0xBA, 0x91, 0x6D,
+    0x41, 0x26, 0x43, 0xE8, 0x66, 0xC4, 0x02, 0x13, 0x0A, 0x30, 0xA1, 0x34, 0x3D, 0x16, 0x94, 0xE5,
+    0xD9, 0x5B, 0xD3, 0xCF, 0xD7, 0xEB, 0xF1, 0xBC, 0xF0, 0x85, 0x33, 0xAF, 0xAB, 0xAC, 0xF1, 0x9C,
+    0x11, 0x67, 0x81, 0x9C, 0xBC, 0xF4, 0x61, 0x6A, 0x33, 0xF5, 0x8B, 0x24, 0x9F, 0x48, 0x7B, 0x73,
+    0x7D, 0x01, 0x3D, 0x8B, 0x8D, 0x09, 0xA6, 0x2D, 0xA9, 0x74, 0x59, 0x49, 0x3B, 0x86, 0xB4, 0x23,
+    0x9E, 0x35, 0xB1, 0x26, 0xA4, 0x54, 0x13, 0x8B, 0x3A, 0xA1, 0xA4, 0x50, 0x26, 0x7A, 0x6A, 0xC0,
+    0x9D, 0x3E, 0x7B, 0x04, 0x90, 0xC7, 0x4A, 0xBD, 0xA2, 0x1C, 0x43, 0xD5, 0xEA, 0xED, 0x56, 0xDE,
+    0x61, 0xA3, 0xE1, 0x8A, 0x1D, 0xC7, 0x79, 0x51, 0xE9, 0xFB, 0x6D, 0xF6, 0xC2, 0x63, 0x32, 0xC1,
+    0xD0, 0x34, 0xA5, 0x58, 0x44, 0x94, 0x14, 0xA3, 0x3A, 0x7A, 0x6F, 0x1C, 0x44, 0xEC, 0x75, 0x33,
+    0x3D, 0x9D, 0x1A, 0x1A, 0xA5, 0x9D, 0x30, 0x0E, 0x53, 0xC8, 0x90, 0x6C, 0x54, 0xE2, 0x54, 0x89,
+    0xB7, 0xCA, 0x6A, 0x52, 0x44, 0xAF, 0xB8, 0xA5, 0xC4, 0xCA, 0x2A, 0xFA, 0xA5, 0x11, 0x7F, 0x47,
+    0x5C, 0x48, 0x86, 0x4B, 0xB6, 0x1A, 0x91, 0x81, 0x4B, 0x84, 0xD4, 0x01, 0x57, 0x45, 0x11, 0x8C,
+    0xEB, 0x09, 0x05, 0xF1, 0x9B, 0xC3, 0x80, 0xFD, 0xDF, 0x6B, 0x13, 0xB6, 0xFE, 0xA6, 0xCD, 0x3C,
+    0xEF, 0x27, 0x03, 0x8C, 0xF3, 0x90, 0x36, 0x44, 0x2D, 0x56, 0x0A, 0x77, 0x98, 0xCE, 0x85, 0x1B,
+    0xAA, 0x86, 0x2F, 0x8E, 0x86, 0x59, 0x37, 0x50, 0x6E, 0x14, 0xAB, 0x59, 0x00, 0x5B, 0xA5, 0xB5,
+    0x26, 0x78, 0x7B, 0x6B, 0x2D, 0x94, 0xD1, 0x9A, 0xC5, 0x71, 0xEB, 0x14, 0x2D, 0xE4, 0x36, 0xEF,
+    0x45, 0x6C, 0x37, 0x10, 0xED, 0x8F, 0x7B, 0xB2, 0x1D, 0x7E, 0x75, 0x46, 0xB8, 0x4E, 0x73, 0xC1,
+    0x7A, 0xF9, 0x1E, 0x5D, 0x9D, 0x1D, 0xF8, 0x9A, 0xEB, 0xD6, 0x1F, 0xA5, 0x99, 0xC8, 0x0F, 0xA9,
+    0x02, 0xFD, 0xB0, 0xFE, 0x9C, 0x57, 0x79, 0xB7, 0x4F, 0x5F, 0x7C, 0xA9, 0x79, 0x7D, 0x57, 0xD8,
+    0x20, 0xD7, 0x2E, 0x37, 0xB5, 0xBE, 0xE3, 0xA3, 0x53, 0xD5, 0xAC, 0x57, 0x01, 0x5E, 0xCC, 0x71,
+    0xE2, 0x48, 0x42, 0xCD, 0x55, 0x53, 0xBE, 0x41, 0xDB, 0x24, 0xAD, 0x26, 0x78, 0xC7, 0x61, 0xE6,
+    0xC1, 0xBD, 0xC0, 0xE8, 0x2C, 0x46, 0xB7, 0x31, 0xE9, 0xF3, 0x6E, 0x16, 0x5D, 0x41, 0xA1, 0x8E,
+    0x3A, 0x2C, 0x3C, 0x6A, 0xAE, 0xA0, 0x0B, 0xB3, 0x20, 0x7C, 0xE6, 0x85, 0xCB, 0xBD, 0xB0, 0xC2,
+    0xA9, 0x56, 0x58, 0xCE, 0x4A, 0xAB, 0x2B, 0xDD, 0x1A, 0x7A, 0xAF, 0xC0, 0xB8, 0x29, 0xB2, 0xA7,
+    0x1F, 0x96, 0x97, 0xEE, 0xFF, 0x50, 0x44, 0xDD, 0xEB, 0x8E, 0xF3, 0x75, 0x4C, 0x12, 0xA7, 0xA1,
+    0x70, 0x1E, 0x06, 0x9B, 0x28, 0x2E, 0x72, 0xD4, 0x39, 0x91, 0xF9, 0xE1, 0xF1, 0xC3, 0xFF, 0x03,
+    0x63, 0xD6, 0x98, 0x7B, 0x8B, 0x2C, 0x56, 0x9D, 0xF9, 0x5E, 0x3C, 0x20, 0x02, 0x25, 0xA9, 0x39,
+    0x52, 0x4F, 0x39, 0x46, 0x53, 0xEA, 0x35, 0x41, 0x16, 0x02, 0xE4, 0x1D, 0x8F, 0x42, 0xB8, 0x2F,
+    0x3A, 0xBD, 0xBF, 0x6D, 0x75, 0x6F, 0x96, 0x31, 0xB3, 0x52, 0x87, 0x5E, 0x28, 0x49, 0x5C, 0x71,
+    0x15, 0x45, 0x4D, 0x92, 0x3A, 0xFA, 0x9A, 0xA3, 0xB5, 0xC9, 0x41, 0x54, 0x69, 0xF2, 0xBD, 0x6E,
+    0x70, 0x0E, 0x01, 0xC2, 0x1A, 0xD6, 0xCF, 0xFD, 0xAF, 0xCF, 0x9B, 0xA2, 0x2E, 0x99, 0x15, 0xEF,
+    0x73, 0xEC, 0xDB, 0x53, 0xAB, 0x5A, 0x8C, 0x25, 0x11, 0x72, 0x8E, 0x77, 0x04, 0x3F, 0x85, 0xC3,
+    0x99, 0x20, 0x6E, 0x22, 0xDB, 0x6F, 0x5E, 0x58, 0x9C, 0xAF, 0xCF, 0x6D, 0x20, 0xBF, 0x7B, 0xF7,
+    0xE7, 0x16, 0x1B, 0x1B, 0x57, 0x77, 0x21, 0xB6, 0xEF, 0xAB, 0x06, 0x57, 0x87, 0x36, 0x40, 0x8B,
+    0x9E, 0x8D, 0xBB, 0xB2, 0xF2, 0x37, 0x46, 0xC2, 0xEB, 0xBD, 0x48, 0xF4, 0x78, 0xDD, 0x67, 0x95,
+    0xB6, 0x38, 0x29, 0xD7, 0xED, 0x23, 0xB9, 0x10, 0x84, 0xA3, 0x5C, 0x36, 0xF7, 0xB2, 0xA5, 0x5C,
+    0x0F, 0x3F, 0x73, 0x3A, 0x46, 0xAB, 0xBF, 0xBB, 0x4C, 0xC9, 0x14, 0x25, 0xD3, 0x94, 0x4C, 0x5F,
+    0x62, 0x98, 0x4C, 0x07, 0x74, 0x67, 0x0D, 0xED, 0x56, 0xF9, 0x63, 0x99, 0x9B, 0x55, 0x79, 0xB1,
+    0xA7, 0xC0, 0x0F, 0x02, 0xB6, 0x98, 0xA6, 0x07, 0x16, 0xA3, 0x09, 0xE4, 0x3E, 0xAD, 0xDE, 0x27,
+    0xAB, 0xE7, 0x61, 0x0F, 0x5B, 0xD2, 0x73, 0x96, 0x39, 0xA7, 0x74, 0xF1, 0x6B, 0xA9, 0x19, 0x09,
+    0x6E, 0xE6, 0x67, 0x41, 0x3C, 0xFE, 0x33, 0x88, 0xFD, 0x6B, 0x41, 0x3C, 0xCB, 0xBC, 0xEC, 0x73,
+    0xAF, 0xB8, 0x71, 0xDA, 0xA5, 0x2D, 0x93, 0xAD, 0x69, 0x8E, 0xF1, 0x3F, 0x5A, 0xE1, 0x1B, 0x7B,
+    0x42, 0x20, 0xE5, 0xF3, 0xB8, 0x43, 0x23, 0x74, 0x2F, 0x89, 0x56, 0x33, 0x97, 0x23, 0xA7, 0xD0,
+    0x30, 0x9A, 0x98, 0x9D, 0x35, 0x52, 0x36, 0x09, 0xBF, 0x4C, 0x43, 0x53, 0xC9, 0xF4, 0xEF, 0x84,
+    0x8F, 0xB5, 0x2D, 0x1A, 0xA4, 0xD4, 0x34, 0xEC, 0x27, 0xF7, 0x9C, 0xE5, 0x75, 0xD6, 0x12, 0xA9,
+    0xEC, 0x20, 0x15, 0xB5, 0x29, 0x25, 0xD9, 0xE9, 0x97, 0x37, 0x56, 0x33, 0x19, 0x7B, 0xF1, 0xB2,
+    0x66, 0x5E, 0x9A, 0xA5, 0xE5, 0xB9, 0xAC, 0x4E, 0xC6, 0x4F, 0x03, 0xC9, 0xCF, 0x1E, 0x2E, 0x8C,
+    0x3F, 0xF0, 0x65, 0x6C, 0xF5, 0x2A, 0x4E, 0x12, 0x41, 0xAB, 0x12, 0x45, 0xCF, 0x81, 0x79, 0xFC,
+    0xD7, 0x1F, 0x89, 0xE6, 0xD7, 0x07, 0x3F, 0x91, 0x68, 0xFE, 0x3C, 0x51, 0x15, 0x47, 0x64, 0x43,
+    0xA2, 0x2B, 0xFD, 0xD2, 0xA3, 0x36, 0x51, 0x4E, 0x5E, 0x25, 0xE9, 0x2A, 0xD1, 0x36, 0x4B, 0xE2,
+    0xFC, 0xBB, 0x35, 0x20, 0x6C, 0x41, 0xF2, 0x83, 0x93, 0xF4, 0x99, 0xA6, 0x01, 0x3D, 0x93, 0x9A,
+    0x0E, 0xDE, 0xE3, 0x02, 0xFE, 0x96, 0x38, 0x46, 0xD5, 0x00, 0x69, 0x2B, 0x59, 0x62, 0x17, 0x08,
+    0x74, 0x82, 0xBE, 0x46, 0x2B, 0xEE, 0xB2, 0x67, 0xB5, 0x43, 0xA7, 0x6E, 0xF2, 0x8B, 0xBC, 0xB9,
+    0x34, 0x3B, 0xEF, 0xA4, 0xD1, 0xEF, 0x13, 0xC5, 0x6A, 0xA9, 0x40, 0x96, 0x91, 0xF7, 0x98, 0x37,
+    0x64, 0x4A, 0xA4, 0xF5, 0x13, 0x48, 0x8A, 0xD4, 0xF2, 0x57, 0xA9, 0xD0, 0x9B, 0xAC, 0x88, 0xA3,
+    0xBC, 0x3E, 0x16, 0x6E, 0x2D, 0xFE, 0xBE, 0xFC, 0x21, 0x12, 0x87, 0xF5, 0x95, 0xB6, 0x57, 0xED,
+    0x5E, 0x81, 0x5D, 0xA6, 0x9E, 0xAE, 0xCA, 0x9A, 0xF6, 0x7A, 0xD5, 0x6A, 0x0C, 0x7B, 0x7A, 0xEC,
+    0x11, 0x99, 0xD5, 0x93, 0xDC, 0xE9, 0x1D, 0xC7, 0xDF, 0x9D, 0x72, 0xFB, 0x97, 0x9E, 0xFB, 0xB0,
+    0x40, 0x36, 0x4B, 0x68, 0x29, 0x9F, 0x54, 0x1A, 0x25, 0xB6, 0x70, 0x96, 0x08, 0x72, 0xC7, 0xA6,
+    0xB0, 0x41, 0x8A, 0xE2, 0xFF, 0x1C, 0xFF, 0x00, 0xAD, 0x55, 0x3D, 0x8F, 0x1C, 0x45, 0x10, 0x7D,
+    0x3D, 0x6D, 0xDF, 0x58, 0x1A, 0x89, 0xBE, 0xC0, 0x44, 0xB6, 0xD4, 0x04, 0x04, 0x0E, 0x8C, 0x3B,
+    0x42, 0x22, 0xF0, 0xEE, 0xB4, 0xED, 0xC0, 0x12, 0x04, 0x10, 0x60, 0x39, 0x20, 0xC0, 0x09, 0x91,
+    0x25, 0x9B, 0x80, 0xE0, 0x82, 0xDD, 0xDB, 0x39, 0x59, 0x08, 0x09, 0xFE, 0x00, 0xA1, 0x03, 0x22,
+    0x84, 0xB0, 0x03, 0x02, 0x07, 0xEB, 0xDD, 0xC6, 0x17, 0x10, 0x10, 0x30, 0x98, 0x90, 0x80, 0x41,
+    0xE2, 0x43, 0xE2, 0x82, 0x6B, 0xE4, 0x31, 0x6E, 0x5B, 0xB3, 0xDB, 0xBC, 0x9E, 0xDD, 0xF5, 0x39,
+    0x20, 0x64, 0x6E, 0x66, 0xD5, 0xD7, 0x1F, 0x55, 0xAF, 0x5E, 0xBD, 0xAA, 0x06, 0xF8, 0x14, 0x8D,
+    0xE8, 0xF2, 0x88, 0x89, 0xFB, 0x20, 0xE8, 0xCF, 0xA1, 0xF6, 0x6B, 0x60, 0x7C, 0x0F, 0x90, 0x91,
+    0x6B, 0xC6, 0x01, 0x22, 0x70, 0x50, 0x72, 0x50, 0x2C, 0xF8, 0xCF, 0x23, 0x0F, 0x9C, 0x37, 0xC8,
+    0xDE, 0xBF, 0xF0, 0xF4, 0x5A, 0xD9, 0xA8, 0x28, 0x03, 0x26, 0xF6, 0x18, 0xD6, 0x4F, 0xD1, 0x41,
+    0x17, 0x11, 0xAA, 0x2A, 0x5C, 0x5E, 0x67, 0x5E, 0x78, 0x04, 0x4C, 0x31, 0xC0, 0x10, 0x06, 0xCA,
+    0x2A, 0x57, 0x38, 0x59, 0x4B, 0x4E, 0x67, 0x9C, 0x16, 0x0B, 0x18, 0x71, 0xF0, 0xB6, 0x7A, 0xF8,
+    0xE8, 0xF0, 0x62, 0xF4, 0xD1, 0x95, 0xCD, 0xB9, 0xBB, 0x34, 0x71, 0x9E, 0x9F, 0xB2, 0xF4, 0x4F,
+    0x1C, 0x3C, 0x0F, 0xD9, 0x72, 0xE2, 0x9D, 0xDE, 0xBA, 0x69, 0x70, 0x37, 0x36, 0xD2, 0xCB, 0x86,
+    0x7F, 0xB5, 0xAC, 0x73, 0x97, 0xD3, 0x62, 0xB2, 0x6A, 0xAA, 0xFC, 0x9F, 0x68, 0x65, 0xFC, 0xC5,
+    0xE2, 0x5D, 0x9D, 0x76, 0xF2, 0x1B, 0x9E, 0xE6, 0x37, 0x25, 0x74, 0x1A, 0x29, 0x2B, 0x60, 0x03,
+    0x72, 0x9E, 0x4E, 0x7D, 0x16, 0x51, 0x62, 0x4C, 0x6C, 0x21, 0xF3, 0xD2, 0xE7, 0xB5, 0x72, 0xAA,
+    0x32, 0x84, 0x39, 0xC0, 0x3D, 0xB4, 0x9C, 0xA2, 0x6D, 0x55, 0x69, 0xEE, 0x19, 0xA0, 0x43, 0x10,
+    0x3E, 0x6F, 0x54, 0x5D, 0xB8, 0xD2, 0x4E, 0x50, 0xCA, 0x45, 0x3E, 0x7A, 0xB5, 0x1B, 0x85, 0x9D,
+    0x27, 0x0F, 0xE3, 0x4F, 0x71, 0x7F, 0x99, 0x77, 0x79, 0x50, 0xB5, 0x80, 0xD8, 0x90, 0xF0, 0xBF,
+    0x78, 0x78, 0xA3, 0xF7, 0xF0, 0x20, 0x79, 0x88, 0xBD, 0x87, 0x51, 0xEF, 0xC1, 0x27, 0xFB, 0xD2,
+    0xA5, 0x5F, 0xD5, 0xFB, 0xBA, 0xD7, 0x0F, 0xFB, 0x89, 0x93, 0xE9, 0x47, 0xC4, 0xE8, 0x27, 0x31,
+    0x92, 0xEC, 0x8A, 0x3E, 0x0A, 0xEB, 0x7B, 0x46, 0x55, 0x6C, 0xC4, 0xB3, 0xB9, 0x1B, 0x60, 0x2A,
+    0x99, 0x98, 0x11, 0x46, 0x89, 0xB8, 0x81, 0x68, 0xE5, 0xB3, 0x05, 0xD7, 0x80, 0xE3, 0x6B, 0xE4,
+    0x37, 0x49, 0xFA, 0x37, 0xB1, 0x01, 0x5A, 0xD2, 0x4F, 0x4C, 0x0E, 0x99, 0x2F, 0x1C, 0xA4, 0x57,
+    0x1F, 0x5B, 0xC9, 0x6C, 0x73, 0x5A, 0xFF, 0xB1, 0xC8, 0x9D, 0xC1, 0x6E, 0xE1, 0xCE, 0x61, 0xA8,
+    0xAA, 0x01, 0x06, 0xCA, 0x0E, 0x31, 0xD2, 0x6F, 0x96, 0x22, 0xE8, 0xB1, 0x3E, 0x68, 0x4C, 0x28,
+    0xA2, 0xD5, 0xF5, 0x3A, 0x67, 0xD8, 0x5A, 0x50, 0x4A, 0x36, 0x61, 0x4E, 0xD9, 0x24, 0xDC, 0xC1,
+    0xCB, 0xD0, 0x31, 0xE4, 0x4F, 0xE7, 0x17, 0x99, 0xC6, 0x16, 0x81, 0xEA, 0x20, 0xDA, 0x4B, 0x8D,
+    0xAA, 0xE6, 0x77, 0x1C, 0x8F, 0xAE, 0xE2, 0x00, 0x4E, 0x51, 0x1F, 0xB1, 0x36, 0x17, 0xBA, 0x97,
+    0xA0, 0x79, 0x9E, 0xA0, 0x02, 0xAE, 0xEC, 0x62, 0x1E, 0xAB, 0xE3, 0x57, 0x6B, 0xE2, 0x02, 0xBA,
+    0x1D, 0x8C, 0x89, 0x24, 0x5F, 0x2E, 0x31, 0xA7, 0x36, 0xED, 0x91, 0x08, 0x8B, 0x05, 0x55, 0xC8,
+    0xD3, 0xCA, 0x99, 0xBD, 0x4E, 0x36, 0xC6, 0x1A, 0xDB, 0xAA, 0x8A, 0x91, 0x33, 0x98, 0xD6, 0x5C,
+    0x6D, 0x08, 0x3A, 0xB6, 0xD0, 0x97, 0x7E, 0xE7, 0xD6, 0x6F, 0x5B, 0x43, 0xEB, 0x5C, 0xC9, 0xBC,
+    0x11, 0xAD, 0x08, 0xAA, 0x62, 0x24, 0xA4, 0x2E, 0x32, 0x29, 0x98, 0x27, 0xF5, 0xF5, 0x99, 0x15,
+    0xF3, 0x8E, 0x54, 0x75, 0x28, 0x6D, 0xC0, 0x08, 0x2D, 0x13, 0xEB, 0xD1, 0x71, 0xC7, 0x2C, 0x6B,
+    0x50, 0xC6, 0x1A, 0xC5, 0x81, 0x83, 0xBA, 0xEC, 0x60, 0xE8, 0x62, 0xA4, 0x3E, 0x7D, 0x3D, 0xA8,
+    0x59, 0xE9, 0x55, 0x28, 0x2B, 0x55, 0x6F, 0x94, 0x77, 0x16, 0xD8, 0xA5, 0x16, 0x6D, 0xCA, 0x57,
+    0x8A, 0xE7, 0xF6, 0x7A, 0x5E, 0x07, 0xCC, 0x16, 0xB2, 0x19, 0x16, 0xD5, 0x50, 0x63, 0x3C, 0x14,
+    0x61, 0x50, 0x34, 0xE3, 0x68, 0xE9, 0x9B, 0x51, 0x75, 0xA0, 0xAB, 0x33, 0xBB, 0x5B, 0x2D, 0x9D,
+    0xE8, 0x65, 0x1F, 0xE5, 0x49, 0x61, 0x8B, 0xBA, 0xC3, 0x42, 0xBB, 0xC2, 0xB6, 0x38, 0x7A, 0x44,
+    0xAC, 0x68, 0x08, 0x43, 0xD9, 0xD0, 0x12, 0xB3, 0x57, 0x0F, 0x53, 0x20, 0x33, 0xD0, 0x56, 0xE2,
+    0x75, 0xB1, 0x12, 0x0A, 0xAD, 0xE5, 0xCD, 0x4D, 0x4B, 0x73, 0x22, 0x65, 0x3A, 0xB1, 0xF6, 0x32,
+    0x57, 0xE8, 0xE7, 0x3A, 0x39, 0x25, 0x7A, 0x0C, 0x8F, 0x5B, 0x13, 0x23, 0xAE, 0xFF, 0xF5, 0x45,
+    0x5F, 0x48, 0x21, 0x15, 0xE3, 0xCD, 0xBE, 0xB0, 0x47, 0xCB, 0x45, 0x76, 0xB0, 0xD7, 0xAA, 0x36,
+    0x6F, 0x18, 0xD8, 0x5E, 0x87, 0x71, 0x51, 0x8B, 0xB6, 0x44, 0x5E, 0x07, 0x98, 0xBC, 0x46, 0x97,
+    0xA8, 0x9C, 0x92, 0xD8, 0x86, 0x6E, 0xFA, 0x18, 0x93, 0x81, 0x16, 0xDB, 0xAA, 0x12, 0x8F, 0x3B,
+    0xE4, 0x04, 0xB8, 0xF5, 0x5B, 0x82, 0x4A, 0x4A, 0xF2, 0xA4, 0xAB, 0xF4, 0xA6, 0x54, 0xF2, 0x7D,
+    0x65, 0x13, 0x86, 0x26, 0xC9, 0xD1, 0x0D, 0xB3, 0x70, 0x82, 0xE5, 0x02, 0x63, 0x61, 0x2A, 0xF6,
+    0x18, 0xCC, 0x20, 0xBA, 0xBE, 0x19, 0x75, 0xD8, 0x1E, 0xE2, 0xAC, 0xAA, 0x8D, 0x24, 0x48, 0xC3,
+    0xA8, 0xB6, 0xD7, 0xE7, 0x16, 0x14, 0x87, 0x7C, 0x7C, 0xA3, 0xA8, 0xC0, 0x1E, 0x30, 0x60, 0x1C,
+    0x5F, 0xBA, 0x49, 0x74, 0xD3, 0x9E, 0x43, 0xBE, 0xF7, 0x71, 0x76, 0x72, 0x31, 0x30, 0x6E, 0xB5,
+    0xDC, 0x88, 0x85, 0xCC, 0x47, 0xEA, 0x83, 0xE5, 0xC0, 0x10, 0x52, 0xAB, 0xC9, 0x96, 0xA9, 0x7C,
+    0xA1, 0x9B, 0x15, 0xB0, 0x8F, 0x84, 0x9F, 0xC9, 0x86, 0x46, 0xF4, 0x46, 0x5F, 0xCA, 0xE5, 0x3E,
+    0xEB, 0x70, 0x66, 0x8D, 0xF5, 0x94, 0xE7, 0x8A, 0x26, 0x6B, 0xB2, 0x11, 0x49, 0x13, 0x25, 0x92,
+    0xCC, 0x18, 0x51, 0xF8, 0x70, 0x38, 0xD5, 0x9D, 0x4C, 0xBD, 0x53, 0xD8, 0xED, 0x52, 0xFE, 0xDD,
+    0x99, 0x5B, 0x6E, 0x67, 0x13, 0xE2, 0x56, 0x87, 0x49, 0x9B, 0x18, 0x30, 0x89, 0x5E, 0xBA, 0x36,
+    0x09, 0x21, 0xF9, 0xA2, 0xD2, 0xA7, 0x90, 0xBF, 0x3A, 0x75, 0x07, 0x13, 0x8F, 0xE5, 0x0B, 0xC9,
+    0x25, 0x9E, 0xBE, 0x1D, 0x73, 0x4E, 0xDC, 0xC6, 0x8B, 0xCF, 0x1D, 0x82, 0x4F, 0xCD, 0x7A, 0xBA,
+    0xDA, 0xA4, 0xAA, 0x3E, 0x78, 0xB1, 0x49, 0x66, 0x9F, 0x80, 0xE4, 0xAB, 0xCF, 0x45, 0xB7, 0xEA,
+    0xAC, 0xFA, 0x68, 0x68, 0x20, 0xAA, 0x96, 0xD2, 0xAE, 0x50, 0x12, 0xED, 0x0D, 0x7B, 0x64, 0x78,
+    0xDE, 0x77, 0x7E, 0x2A, 0x07, 0xC5, 0x5E, 0x6A, 0x3C, 0x3E, 0xD9, 0x7A, 0x2D, 0x75, 0x1F, 0xE9,
+    0x46, 0x1C, 0xEE, 0x14, 0x87, 0x0D, 0x0A, 0x1B, 0xA3, 0x83, 0x57, 0xF6, 0x3E, 0xB4, 0xF0, 0xA9,
+    0x2D, 0x6B, 0xBA, 0x1F, 0x65, 0x3E, 0xDF, 0x3F, 0xAC, 0xB4, 0x0D, 0x6C, 0xBF, 0xCB, 0xB9, 0x64,
+    0x70, 0xB1, 0x3A, 0x86, 0xE7, 0x4D, 0x72, 0xEE, 0x0A, 0x50, 0x4F, 0xC4, 0x39, 0x25, 0x50, 0x0A,
+    0x96, 0xC5, 0xC3, 0x36, 0xD2, 0x57, 0x56, 0xF6, 0xF8, 0xBD, 0x43, 0xF6, 0x1A, 0x36, 0xB2, 0xE1,
+    0x95, 0x90, 0x37, 0x2D, 0x1B, 0xCF, 0x27, 0x8E, 0xAB, 0x86, 0xDB, 0xDB, 0x80, 0xAE, 0xD8, 0xAF,
+    0xB3, 0x65, 0xA7, 0x91, 0x11, 0x72, 0x9F, 0x7C, 0xCA, 0x17, 0xC4, 0xD0, 0xEB, 0x37, 0xB1, 0x90,
+    0x04, 0x9C, 0xF1, 0x78, 0xAF, 0xE0, 0xA4, 0xAE, 0x24, 0x61, 0x0C, 0xA8, 0x1D, 0x4D, 0x05, 0xE6,
+    0xDF, 0x1D, 0x34, 0xD9, 0x9F, 0x2E, 0xE0, 0x09, 0xFB, 0x61, 0xE9, 0x34, 0x34, 0xFB, 0x6E, 0x91,
+    0x2E, 0x15, 0x4F, 0xE7, 0x1D, 0x21, 0x8C, 0x61, 0x4E, 0xF3, 0xBE, 0x3A, 0x64, 0x56, 0x23, 0x73,
+    0xB2, 0x5C, 0xE9, 0xB5, 0xC7, 0x6E, 0x56, 0xF7, 0x61, 0xAA, 0x23, 0xD2, 0x97, 0x13, 0xC0, 0x89,
+    0x23, 0xBA, 0x2A, 0xFD, 0xFD, 0x52, 0x44, 0x1B, 0xF4, 0x57, 0xF2, 0x47, 0x0F, 0xC5, 0x06, 0x3D,
+    0xA2, 0x88, 0x0E, 0x58, 0xEF, 0x33, 0xF2, 0x38, 0x85, 0x68, 0x99, 0xF3, 0x07, 0x1E, 0x46, 0x36,
+    0xD7, 0x82, 0xFA, 0xF9, 0x56, 0xAD, 0x18, 0x85, 0xAE, 0x9E, 0x1B, 0xC8, 0xED, 0xCA, 0x72, 0xC1,
+    0xBA, 0xC9, 0xDA, 0x75, 0x2C, 0xA7, 0x9F, 0x2F, 0x1B, 0x8F, 0xD1, 0xDC, 0xA7, 0xFB, 0x84, 0x8D,
+    0x9B, 0x97, 0xA8, 0x6C, 0xD2, 0x35, 0x92, 0xB8, 0x93, 0x75, 0xBA, 0x04, 0xD3, 0x05, 0xAB, 0x59,
+    0x2C, 0x06, 0x93, 0x8A, 0x37, 0xEB, 0xE5, 0xF2, 0xAD, 0x1F, 0xBE, 0x36, 0x51, 0x75, 0x2A, 0xD0,
+    0xA0, 0xC5, 0x7F, 0x3C, 0xFF, 0x02, 0x6D, 0x55, 0xBF, 0x73, 0xDC, 0x44, 0x18, 0x7D, 0xD2, 0x9A,
+    0x28, 0x93, 0x2D, 0xD6, 0x05, 0x14, 0x30, 0x19, 0xD4, 0x52, 0x04, 0xAB, 0xA1, 0xF4, 0x9D, 0x64,
+    0x52, 0xA4, 0x48, 0xE1, 0x30, 0x83, 0xA1, 0xA0, 0xA0, 0x65, 0x68, 0xDC, 0x7A, 0x98, 0xBB, 0x9C,
+    0x42, 0x93, 0x82, 0xC6, 0x3D, 0xFF, 0xC1, 0xF1, 0xC3, 0x14, 0x14, 0x29, 0x74, 0x96, 0x62, 0xFE,
+    0x80, 0x68, 0xC2, 0x50, 0xD1, 0x2C, 0x13, 0x32, 0xCC, 0x60, 0x98, 0x2C, 0x44, 0x61, 0x14, 0x8F,
+    0x7C, 0xCB, 0xFB, 0xA4, 0xB3, 0x63, 0x32, 0x68, 0xAC, 0xF5, 0x49, 0xBB, 0xDA, 0xEF, 0x7B, 0xEF,
+    0x7D, 0xDF, 0x5B, 0x60, 0xB8, 0x2E, 0x03, 0xDF, 0x85, 0x15, 0x62, 0xEC, 0x21, 0x6C, 0x62, 0xC0,
+    0xF8, 0x0A, 0x48, 0xF6, 0x71, 0x7E, 0x5D, 0x6A, 0xD0, 0x05, 0xBE, 0xD2, 0x16, 0x0B, 0x8C, 0xA1,
+    0xAC, 0xB2, 0x48, 0x31, 0x42, 0xE8, 0xA2, 0x0A, 0x26, 0xBB, 0x07, 0x34, 0x86, 0x5F, 0xDD, 0x71,
+    0xC0, 0xBD, 0x11, 0xA0, 0xEF, 0xE6, 0xC0, 0x1E, 0x1F, 0xA2, 0x6F, 0xF8, 0x6D, 0xC9, 0x07, 0xCD,
+    0x07, 0x74, 0xBC, 0xE3, 0x0C, 0x50, 0x35, 0x82, 0xA0, 0x01, 0x66, 0x7C, 0x11, 0x2D, 0xF9, 0x72,
+    0xE3, 0x2C, 0x4C, 0xE2, 0x30, 0x29, 0x1D, 0xDA, 0xD0, 0x05, 0x8D, 0x72, 0x81, 0x53, 0x36, 0x74,
+    0xAA, 0x56, 0x56, 0x57, 0xAA, 0x36, 0x95, 0xAE, 0x4C, 0x66, 0xAA, 0x18, 0x49, 0x9E, 0x60, 0x96,
+    0x27, 0xC1, 0xF1, 0x8D, 0xF4, 0xE6, 0x83, 0x6F, 0x13, 0x6F, 0x3A, 0xD3, 0x7E, 0x61, 0xB1, 0xC5,
+    0x9C, 0x09, 0x02, 0x8A, 0x77, 0xC4, 0x98, 0x29, 0x37, 0x7C, 0x95, 0xF7, 0x1B, 0xF3, 0x1C, 0xA1,
+    0x6F, 0x39, 0xD9, 0x48, 0x08, 0xE0, 0xCA, 0x57, 0x27, 0xF3, 0xC0, 0x7B, 0xEF, 0x92, 0x2F, 0x1F,
+    0xEF, 0xAA, 0x6A, 0x1A, 0xD8, 0x4D, 0x5D, 0x5D, 0x0B, 0x32, 0xC9, 0xCF, 0xF0, 0x63, 0x3C, 0x7F,
+    0x9F, 0x89, 0xFA, 0x53, 0x84, 0x27, 0x07, 0x0D, 0xB7, 0x89, 0x2B, 0x35, 0xE0, 0x8E, 0xEA, 0xA8,
+    0xE6, 0x8F, 0x82, 0xAB, 0x4C, 0x15, 0xB4, 0x68, 0x71, 0x18, 0x94, 0xDE, 0xE7, 0xA9, 0xF7, 0xD9,
+    0x0B, 0xAE, 0x12, 0x1B, 0x57, 0x28, 0x5D, 0x69, 0xA1, 0x1E, 0xFD, 0xC6, 0xE1, 0xE7, 0xEB, 0x35,
+    0xD4, 0x9F, 0xCC, 0x2A, 0x6A, 0xC9, 0x96, 0x76, 0xFA, 0x89, 0x35, 0xB5, 0xF1, 0x1D, 0x37, 0xC9,
+    0x16, 0x71, 0x1E, 0x63, 0x14, 0x93, 0xF9, 0x51, 0xC2, 0xD4, 0x26, 0x63, 0x12, 0xD4, 0x8E, 0x60,
+    0x8E, 0xDD, 0x04, 0xCA, 0x13, 0x04, 0xD6, 0x79, 0xBF, 0x72, 0x0B, 0x08, 0xFC, 0x52, 0x92, 0xA2,
+    0x30, 0x65, 0x66, 0x5C, 0xD8, 0x42, 0x35, 0x91, 0x45, 0xD0, 0x49, 0xC2, 0x5D, 0xC2, 0xF0, 0x9D,
+    0xE0, 0x2D, 0x6E, 0xCB, 0xC0, 0x9C, 0x7C, 0x77, 0x38, 0x9F, 0xCF, 0x3B, 0x81, 0xD4, 0x76, 0x02,
+    0x9D, 0x83, 0x72, 0x0B, 0x2A, 0x51, 0xCF, 0xB8, 0x4F, 0x9E, 0x66, 0x98, 0x21, 0xB6, 0x51, 0x87,
+    0xC8, 0x7B, 0x4B, 0x91, 0x44, 0x87, 0x60, 0x85, 0x20, 0x28, 0x6B, 0x94, 0x84, 0x95, 0x2D, 0x48,
+    0xFC, 0x2F, 0xA4, 0x60, 0x8C, 0xF0, 0xE9, 0xE3, 0x9D, 0x19, 0xF7, 0x3D, 0xFE, 0x69, 0x67, 0xDA,
+    0x42, 0x3F, 0xA8, 0xD0, 0x16, 0x48, 0x23, 0x6B, 0xAA, 0xD4, 0x3B, 0x94, 0xED, 0x90, 0x28, 0xAF,
+    0xD7, 0x63, 0x6E, 0x97, 0x1E, 0xC9, 0xE0, 0x92, 0x1C, 0xC9, 0xD7, 0xCC, 0x92, 0xA2, 0xB7, 0x30,
+    0x39, 0xA9, 0x94, 0x72, 0x11, 0x36, 0x29, 0x30, 0x2B, 0xA2, 0xE0, 0x6B, 0x4E, 0x4E, 0xA4, 0x24,
+    0xC6, 0x92, 0x29, 0x8B, 0x08, 0x63, 0x4D, 0xD8, 0xE6, 0x07, 0x11, 0xF3, 0x6F, 0x26, 0x86, 0x89,
+    0x94, 0x4E, 0xCC, 0x12, 0x83, 0x12, 0x34, 0x90, 0x44, 0x7B, 0x6D, 0x5F, 0x5C, 0xC1, 0x21, 0xE1,
+    0xB3, 0x6E, 0xD2, 0x2A, 0x85, 0xF9, 0x23, 0x74, 0xA1, 0x23, 0xA1, 0x13, 0x04, 0x4E, 0x8A, 0xF2,
+    0xDD, 0x9A, 0xD5, 0xB9, 0xC7, 0x1F, 0xDB, 0x5C, 0xF9, 0x0F, 0x1F, 0x0C, 0xE3, 0xC1, 0x8B, 0xD6,
+    0x76, 0x55, 0x94, 0x3A, 0xC3, 0x4B, 0xD7, 0x7A, 0x20, 0x75, 0x30, 0x81, 0xEB, 0x63, 0x7D, 0x2F,
+    0x6B, 0x9E, 0xB5, 0x32, 0x51, 0x36, 0x7D, 0xC0, 0x97, 0x3F, 0x48, 0x7C, 0x65, 0xBC, 0xBD, 0xE4,
+    0xF7, 0x43, 0xDF, 0xC3, 0xA5, 0x2A, 0x9A, 0x7F, 0x54, 0xDF, 0x41, 0x37, 0x12, 0xC5, 0x30, 0xD0,
+    0x18, 0x46, 0xC8, 0xCF, 0xCC, 0x76, 0xCE, 0x69, 0x73, 0x43, 0xA6, 0xCD, 0x16, 0xA7, 0xDB, 0x98,
+    0x5C, 0x60, 0x1A, 0x0B, 0xAE, 0xE4, 0x63, 0xA1, 0x4A, 0x3F, 0x61, 0xB5, 0xB1, 0x04, 0xFA, 0xA2,
+    0x5D, 0x0A, 0x55, 0xB8, 0xDD, 0xC3, 0x66, 0xFD, 0x72, 0xBA, 0xEC, 0xB0, 0xBB, 0xA4, 0x46, 0x48,
+    0xA5, 0x53, 0x45, 0x55, 0x19, 0x95, 0xA4, 0x4B, 0x6E, 0xFB, 0x94, 0x9A, 0x0B, 0xE3, 0x3B, 0xE7,
+    0x89, 0x86, 0x43, 0xA7, 0x4F, 0x02, 0x8B, 0x64, 0xCB, 0x31, 0x80, 0xFB, 0x4F, 0xA3, 0x5F, 0xE9,
+    0x10, 0x6B, 0xCF, 0x08, 0xBA, 0x8A, 0x6A, 0xE9, 0x40, 0x2A, 0x54, 0xB0, 0xD1, 0xC7, 0x8C, 0xCB,
+    0xE6, 0xCB, 0xA5, 0x11, 0xE5, 0x35, 0xEB, 0xAF, 0x08, 0x96, 0x60, 0x0F, 0xDE, 0x34, 0x0F, 0x9F,
+    0x1E, 0x1F, 0x79, 0xE7, 0x6D, 0x6A, 0x93, 0x06, 0x19, 0x84, 0xDD, 0xB7, 0x85, 0xDD, 0xD5, 0x1D,
+    0x5D, 0x6C, 0x0D, 0x5F, 0x83, 0x24, 0x0D, 0x36, 0x40, 0x82, 0x30, 0x23, 0x5D, 0x89, 0xF4, 0xE6,
+    0x78, 0xE5, 0x0D, 0xFA, 0xF7, 0x7D, 0x26, 0x45, 0x50, 0xA7, 0x1F, 0x76, 0x98, 0x4A, 0xAB, 0x67,
+    0xCA, 0x71, 0x65, 0x47, 0x6C, 0x69, 0x5F, 0x45, 0x53, 0x92, 0x9B, 0x64, 0x71, 0xCD, 0x62, 0xE4,
+    0xBD, 0x1C, 0x76, 0x0F, 0x3E, 0xE9, 0xDB, 0xE5, 0x23, 0x3A, 0x8B, 0x78, 0x10, 0x98, 0xB2, 0xF2,
+    0x1D, 0xBC, 0x17, 0xB3, 0x11, 0x15, 0x99, 0xD5, 0xC6, 0x6B, 0xF4, 0xB5, 0x4E, 0x3D, 0x2F, 0xEF,
+    0x38, 0xE5, 0x0A, 0x4C, 0x36, 0x90, 0x98, 0xDC, 0x7C, 0xCE, 0xDD, 0x67, 0x07, 0x75, 0xC4, 0xAF,
+    0xD7, 0x64, 0xA7, 0x9D, 0x4C, 0x3A, 0xA2, 0x86, 0x3F, 0xE1, 0x9B, 0x29, 0x85, 0x23, 0x13, 0x96,
+    0xFF, 0xA8, 0x5D, 0xAE, 0x6C, 0xD0, 0xAE, 0x4F, 0x11, 0x6F, 0x9B, 0x2A, 0x74, 0x9F, 0xB1, 0x2F,
+    0xD4, 0xA9, 0x24, 0x4B, 0x18, 0x4B, 0xCA, 0x5C, 0xB3, 0x8C, 0x0A, 0x6C, 0x32, 0x3D, 0xF6, 0x51,
+    0xBB, 0xC2, 0x23, 0x62, 0xF4, 0xE6, 0x53, 0x0E, 0x42, 0x89, 0x56, 0xAD, 0x76, 0xA1, 0xBF, 0xCB,
+    0xE7, 0xF6, 0x19, 0xEB, 0x62, 0x42, 0xED, 0x3C, 0x23, 0xC5, 0x34, 0x97, 0xB0, 0x63, 0xA2, 0x49,
+    0x46, 0x96, 0x85, 0xF8, 0xD1, 0xD5, 0x38, 0x8B, 0xEE, 0x3F, 0x72, 0x28, 0x0C, 0x2D, 0xA7, 0xA6,
+    0x8F, 0x4A, 0xAB, 0xC6, 0x25, 0x8D, 0xC9, 0xAD, 0x3B, 0xBA, 0xA6, 0xEE, 0xD1, 0x11, 0xEB, 0x50,
+    0x00, 0xCA, 0x53, 0xED, 0x4F, 0xE7, 0xAB, 0x30, 0x6F, 0xC9, 0x20, 0xA5, 0x20, 0x5E, 0xC8, 0x35,
+    0xE4, 0xCB, 0x89, 0x5B, 0x55, 0x8C, 0xB5, 0x2A, 0x92, 0xDE, 0xEC, 0xFA, 0x56, 0x92, 0x74, 0xA3,
+    0x7A, 0xB0, 0xC7, 0xA1, 0x27, 0x94, 0x5D, 0x21, 0xA0, 0xE1, 0x5D, 0x5C, 0x2E, 0x42, 0x89, 0x79,
+    0xF7, 0xF2, 0xF5, 0xC8, 0x12, 0xDF, 0x17, 0x5C, 0x20, 0xB2, 0x0E, 0x21, 0xDF, 0x64, 0x1C, 0xFA,
+    0x82, 0x95, 0xDD, 0xE4, 0xCB, 0x8D, 0x61, 0xBB, 0xD1, 0xE0, 0xCD, 0x94, 0x82, 0x36, 0x20, 0x22,
+    0x99, 0x0C, 0xEF, 0x91, 0x38, 0x96, 0xF7, 0x8C, 0x39, 0x9E, 0xD5, 0x49, 0x48, 0xF7, 0xAA, 0x2F,
+    0x71, 0x90, 0x38, 0x05, 0xE3, 0x84, 0x22, 0x3D, 0x5D, 0xA1, 0xC5, 0x35, 0x50, 0x8B, 0x5B, 0x43,
+    0x5A, 0x85, 0x74, 0x31, 0xE3, 0xF7, 0x6A, 0x0D, 0x98, 0xCE, 0xD2, 0xFA, 0x1F, 0x4C, 0xBA, 0x37,
+    0xB9, 0xDE, 0x51, 0x79, 0xCD, 0x1A, 0x56, 0x87, 0xC9, 0x0F, 0x2F, 0x0B, 0x9C, 0x69, 0x78, 0xBF,
+    0x05, 0xA7, 0x4B, 0x6E, 0xC5, 0x7A, 0xA0, 0x87, 0xAC, 0xA5, 0xB8, 0x9A, 0x66, 0x05, 0x81, 0x69,
+    0x1A, 0xFB, 0xCA, 0xD8, 0xB4, 0xA7, 0x03, 0xEF, 0x8A, 0x02, 0x53, 0x22, 0xA1, 0x44, 0x2C, 0x4A,
+    0x51, 0x3B, 0xBF, 0xA8, 0xF6, 0x5F, 0xF3, 0x8C, 0x2D, 0xC9, 0xAA, 0x5B, 0x1E, 0xB4, 0x6C, 0xD8,
+    0xA4, 0xA2, 0x2E, 0xA7, 0x02, 0x82, 0xC7, 0x17, 0x89, 0xA4, 0x73, 0xD6, 0x5C, 0xB7, 0x20, 0x22,
+    0x73, 0x44, 0xB5, 0xBA, 0xD2, 0x67, 0xFD, 0x89, 0x28, 0x0C, 0x12, 0x42, 0xCE, 0x93, 0x23, 0x3E,
+    0x70, 0x34, 0x7B, 0xEE, 0xA8, 0x7F, 0x15, 0x6E, 0xFD, 0x75, 0xEF, 0x79, 0x16, 0xC6, 0xCC, 0xD4,
+    0xAA, 0x7A, 0x4D, 0xD8, 0x13, 0x88, 0xA7, 0x25, 0x8F, 0x10, 0x9F, 0x2D, 0x3F, 0xE8, 0x62, 0x98,
+    0x87, 0x0E, 0x0B, 0x9E, 0x4E, 0x3F, 0x32, 0xB5, 0xCD, 0x7E, 0xB6, 0xEB, 0xB9, 0xA5, 0xC9, 0x72,
+    0xD3, 0xC5, 0x6E, 0xA6, 0xC9, 0xD0, 0xC5, 0xD3, 0xFC, 0xFC, 0xFA, 0x17, 0xDD, 0x55, 0xBF, 0x6F,
+    0x1C, 0x45, 0x14, 0x7E, 0xBB, 0x43, 0xBC, 0x4A, 0x46, 0x62, 0x5C, 0x04, 0x09, 0x1A, 0xE6, 0x0F,
+    0x00, 0xDF, 0xFE, 0x03, 0xF6, 0xED, 0x0A, 0x97, 0x29, 0xDC, 0x10, 0x28, 0x8C, 0x14, 0x4A, 0x8A,
+    0x88, 0x50, 0x58, 0xC2, 0xC5, 0xDD, 0x79, 0x91, 0xFF, 0x81, 0x34, 0x14, 0x34, 0x54, 0x54, 0x51,
+    0x90, 0x28, 0x52, 0x04, 0x71, 0xC9, 0x0E, 0x76, 0x41, 0x91, 0x82, 0x45, 0x51, 0xE4, 0x22, 0x12,
+    0x6C, 0x83, 0x5C, 0xA4, 0x60, 0x84, 0x37, 0xC9, 0x44, 0xBA, 0xBB, 0xC7, 0xF7, 0x66, 0xD7, 0x49,
+    0x2A, 0x2A, 0x2A, 0x56, 0xBE, 0x9B, 0x9D, 0x9B, 0x79, 0x3F, 0xBE, 0xEF, 0x7B, 0xEF, 0x99, 0xDE,
+    0x21, 0x3C, 0xC9, 0xCD, 0x84, 0xA9, 0x60, 0x3A, 0x70, 0xD9, 0x8A, 0xEA, 0x36, 0x63, 0xBA, 0x78,
+    0x8F, 0xB6, 0x68, 0xF6, 0x19, 0xD1, 0xDD, 0xC4, 0x67, 0x0D, 0xAE, 0x78, 0xED, 0xB6, 0xB0, 0xA4,
+    0x6D, 0xA1, 0x5A, 0xAC, 0xCA, 0x85, 0x5C, 0x2C, 0xF5, 0x76, 0xE3, 0x65, 0x1D, 0xE5, 0xD7, 0x4A,
+    0x71, 0xC4, 0xBC, 0x90, 0xAD, 0x39, 0x79, 0xD6, 0xC9, 0xBA, 0x34, 0x87, 0x72, 0xAC, 0xDB, 0x69,
+    0x74, 0x52, 0x27, 0xDE, 0x38, 0xA2, 0x0C, 0xCE, 0x72, 0x5C, 0x3F, 0x28, 0xC7, 0x54, 0x60, 0x1B,
+    0xA8, 0xA3, 0xFB, 0xD8, 0x56, 0x99, 0xA3, 0x25, 0xE9, 0x40, 0xB5, 0x4F, 0x57, 0xD8, 0x1A, 0x76,
+    0x29, 0xD3, 0x7A, 0xCC, 0x30, 0xBA, 0x45, 0xDC, 0xB6, 0x5F, 0x6D, 0xBF, 0xD0, 0xA4, 0x5F, 0xD2,
+    0xA6, 0x5F, 0x33, 0x3A, 0x7F, 0x74, 0x97, 0x36, 0xE9, 0x42, 0xB1, 0xDB, 0x24, 0x6E, 0x7E, 0xBC,
+    0x97, 0xB9, 0xF1, 0xF5, 0x37, 0x55, 0x1B, 0x0C, 0xC2, 0x8E, 0x8A, 0x0F, 0x70, 0x3D, 0x39, 0xF5,
+    0x62, 0x3C, 0xFA, 0xC3, 0x56, 0xB0, 0x7F, 0x71, 0x26, 0x79, 0x16, 0xA3, 0xBF, 0xC4, 0xC9, 0xF1,
+    0x42, 0x36, 0xBE, 0x30, 0xF8, 0xDE, 0x50, 0x4D, 0xA7, 0xD7, 0x76, 0xAB, 0x89, 0x39, 0xF2, 0xDC,
+    0xEA, 0xB2, 0x5E, 0xEA, 0x8E, 0xBC, 0x5A, 0xF6, 0x01, 0x47, 0x7D, 0xF4, 0xF6, 0xB5, 0x8D, 0x8A,
+    0x27, 0x69, 0x88, 0x9B, 0x37, 0x10, 0xE7, 0x43, 0x4A, 0x79, 0x45, 0x16, 0x9F, 0x39, 0x2D, 0x54,
+    0x93, 0x76, 0x86, 0xB2, 0xE6, 0xED, 0x88, 0x00, 0xA0, 0x74, 0x43, 0x6F, 0x2D, 0x49, 0x71, 0x4B,
+    0x97, 0xF0, 0x21, 0x0B, 0x6B, 0x49, 0xA8, 0xB8, 0x40, 0x14, 0xF6, 0x49, 0x3F, 0xF4, 0x74, 0xA0,
+    0xBD, 0xEE, 0x0C, 0x73, 0xA9, 0x19, 0x87, 0x53, 0x98, 0xDD, 0x89, 0x80, 0xB3, 0x1B, 0x44, 0x39,
+    0x58, 0x9E, 0x95, 0x3D, 0xE2, 0x83, 0x4E, 0xF1, 0x52, 0x57, 0xC5, 0x45, 0x82, 0x32, 0x63, 0x42,
+    0xB4, 0xF7, 0x5A, 0x30, 0x19, 0xA9, 0x9B, 0xAE, 0xD3, 0xF4, 0x0E, 0xCD, 0x17, 0x69, 0xA8, 0xB9,
+    0xCD, 0x57, 0xA5, 0xF0, 0xB6, 0x29, 0x7F, 0xEF, 0x06, 0xB2, 0x9E, 0x2E, 0xF4, 0x2E, 0xD6, 0x10,
+    0xC2, 0x67, 0x0B, 0xBA, 0xF1, 0x22, 0x61, 0x87, 0x48, 0xD0, 0x5F, 0x3B, 0x83, 0x6C, 0x16, 0x42,
+    0xBB, 0x71, 0x77, 0x71, 0x27, 0x48, 0xDE, 0x76, 0x1B, 0x2A, 0xA6, 0x4F, 0x45, 0x62, 0x54, 0x0D,
+    0x30, 0x3F, 0x13, 0xB8, 0x53, 0xD1, 0x56, 0x37, 0x33, 0xBC, 0xCE, 0x95, 0x17, 0x83, 0x1C, 0xB6,
+    0x41, 0x50, 0xDA, 0x52, 0xB7, 0x94, 0x7A, 0x2A, 0xCA, 0x94, 0x03, 0xB4, 0xAD, 0xD9, 0xE9, 0xA8,
+    0xA8, 0x75, 0x22, 0x6E, 0x78, 0x29, 0x69, 0x12, 0xAB, 0x69, 0x23, 0xBE, 0xBA, 0x98, 0x54, 0x5D,
+    0xD9, 0x07, 0xAB, 0x84, 0xCB, 0x60, 0x6F, 0xAB, 0xDF, 0x3C, 0x19, 0x88, 0x32, 0xF1, 0x94, 0x3E,
+    0x29, 0xC9, 0xA0, 0x66, 0x8A, 0x39, 0x25, 0x5D, 0x47, 0xD9, 0x91, 0xA7, 0x3C, 0x6B, 0xF6, 0x82,
+    0x39, 0x39, 0x6E, 0x2C, 0x5B, 0xCA, 0xAF, 0x8B, 0x82, 0x52, 0xA7, 0xC8, 0x43, 0x12, 0x92, 0x74,
+    0x88, 0x2E, 0xF7, 0x54, 0x7D, 0x9A, 0xA2, 0x4C, 0x73, 0xBF, 0xC6, 0x55, 0xCA, 0x2E, 0xE9, 0x28,
+    0xFF, 0x06, 0x40, 0x25, 0x74, 0x11, 0x2F, 0x87, 0x06, 0xC8, 0xD4, 0xC9, 0x15, 0xB0, 0x62, 0xDF,
+    0xDF, 0x17, 0xEB, 0xE7, 0xB0, 0x55, 0x50, 0x10, 0x5E, 0xBE, 0x9D, 0x0B, 0xD4, 0x3D, 0xA4, 0x9C,
+    0xFE, 0x8D, 0xA8, 0xA4, 0x1F, 0x08, 0x39, 0xE3, 0xCB, 0xE2, 0x3E, 0x88, 0x76, 0xA8, 0xF4, 0xA2,
+    0x14, 0x0D, 0x0E, 0x48, 0x43, 0xD2, 0x1A, 0x60, 0x2B, 0x62, 0x7A, 0xF5, 0xA0, 0xC0, 0x01, 0x09,
+    0xBC, 0x9B, 0x0A, 0x98, 0x1A, 0x44, 0x3C, 0xDB, 0x01, 0xA8, 0xC7, 0x30, 0xFA, 0xB2, 0x22, 0x03,
+    0x1B, 0xF5, 0xFB, 0x84, 0x92, 0xB3, 0x1D, 0xC8, 0x84, 0x08, 0x23, 0xDA, 0x5A, 0x33, 0x95, 0x39,
+    0x39, 0x6C, 0x12, 0xFE, 0xD9, 0xF7, 0x8C, 0xD1, 0xBF, 0xEA, 0x95, 0xF3, 0x31, 0xD8, 0xE6, 0xF0,
+    0x5F, 0xE9, 0xB5, 0x8C, 0x7A, 0xF9, 0x3E, 0x68, 0xF2, 0x1D, 0x9C, 0xE0, 0x7D, 0xD7, 0xF5, 0x15,
+    0x1F, 0x62, 0xC9, 0x2B, 0xF6, 0xF9, 0xA5, 0xD5, 0xE1, 0x32, 0x6D, 0xC7, 0x3F, 0x18, 0x44, 0xDB,
+    0xDC, 0x04, 0x00, 0x47, 0xFA, 0x7B, 0x50, 0x83, 0x1B, 0x2B, 0x4F, 0xD9, 0xC3, 0x86, 0xAC, 0x76,
+    0x34, 0x37, 0x5F, 0x1D, 0xB6, 0xF9, 0xE7, 0xA6, 0x2C, 0xD0, 0x7F, 0xB3, 0x97, 0x58, 0xD2, 0x6D,
+    0x96, 0xCA, 0x28, 0x40, 0x32, 0x9F, 0xBA, 0x82, 0x8A, 0x4F, 0xF6, 0x55, 0xAB, 0x9D, 0x2E, 0xA7,
+    0x48, 0xE3, 0x0B, 0xED, 0xA4, 0x57, 0x17, 0xD2, 0xBD, 0xE6, 0x48, 0xBA, 0x2D, 0xC8, 0xDE, 0xB2,
+    0xB4, 0xEE, 0x53, 0x29, 0xA4, 0x22, 0xC3, 0xAF, 0xCA, 0x63, 0x9A, 0xD0, 0x0C, 0x82, 0x42, 0x04,
+    0x01, 0x37, 0x97, 0xB1, 0x62, 0x9C, 0x80, 0x0B, 0x94, 0xBB, 0xA4, 0x5E, 0x92, 0xCC, 0xB9, 0x46,
+    0x85, 0xA1, 0x39, 0xA5, 0xDB, 0xD9, 0x99, 0x5F, 0xD8, 0xDB, 0xE7, 0x6E, 0xDF, 0xDE, 0xF6, 0x1B,
+    0xB6, 0xDC, 0x90, 0x12, 0x53, 0xBF, 0x02, 0xE9, 0x13, 0xB8, 0xFF, 0xC9, 0xC7, 0x22, 0x23, 0xB3,
+    0x53, 0xC5, 0x2A, 0x4B, 0xFD, 0x78, 0x8D, 0x82, 0x3E, 0xAD, 0xB6, 0x88, 0x9D, 0x7D, 0x5D, 0x0D,
+    0x3C, 0x39, 0x7C, 0x71, 0xBB, 0xC6, 0x37, 0x53, 0x88, 0x68, 0x4B, 0x29, 0x39, 0x20, 0x46, 0x7D,
+    0x20, 0x03, 0xC9, 0x6A, 0x11, 0x0B, 0x71, 0x2C, 0x75, 0x16, 0x8F, 0x2B, 0xD2, 0x8F, 0xAE, 0xEE,
+    0xE2, 0x98, 0x99, 0x71, 0xBC, 0xBA, 0x75, 0x0B, 0x37, 0x66, 0xF1, 0x38, 0xEF, 0x8F, 0x9D, 0x94,
+    0x13, 0xAC, 0xD3, 0x2E, 0x32, 0x3D, 0x8F, 0x03, 0x40, 0x8E, 0x49, 0x8E, 0x6B, 0x68, 0xCF, 0x65,
+    0x1D, 0x31, 0xC5, 0xD9, 0xD3, 0x6B, 0xD4, 0xCF, 0xCA, 0x71, 0xFC, 0x36, 0xFD, 0x50, 0xEA, 0xD3,
+    0xEC, 0x87, 0x16, 0x3A, 0x6F, 0x43, 0x33, 0xEC, 0xB5, 0x53, 0x8D, 0x6A, 0x51, 0xF7, 0x1D, 0x1C,
+    0x4F, 0x60, 0x90, 0x5F, 0xBD, 0x86, 0xA1, 0x0B, 0x7E, 0xFE, 0xFC, 0xE8, 0xB5, 0x1F, 0xC9, 0x5C,
+    0x31, 0x55, 0xF6, 0xF8, 0x18, 0xF5, 0x87, 0x06, 0x2C, 0xF6, 0x86, 0x06, 0xD5, 0xD5, 0x30, 0xF9,
+    0x90, 0x9A, 0xA4, 0xD7, 0x0F, 0xEA, 0x57, 0x3C, 0x70, 0x13, 0x89, 0x00, 0xB0, 0xC8, 0xC4, 0xA4,
+    0xA7, 0xC2, 0xF4, 0x5C, 0x64, 0x55, 0x24, 0x23, 0xA9, 0x06, 0x36, 0x06, 0xB6, 0x06, 0x3E, 0xCE,
+    0x09, 0x19, 0x18, 0x19, 0x28, 0x19, 0x38, 0x19, 0x48, 0x39, 0x67, 0x65, 0xA0, 0x65, 0xE0, 0x65,
+    0x20, 0x26, 0x32, 0x83, 0x76, 0x8D, 0xD4, 0x54, 0xE7, 0x59, 0x79, 0xAA, 0x03, 0x06, 0x22, 0x33,
+    0x4A, 0xAA, 0xB3, 0x82, 0x7C, 0x0B, 0xF3, 0xD8, 0x2F, 0x32, 0xA7, 0xDA, 0x75, 0xFD, 0xE8, 0xE3,
+    0x86, 0x24, 0x6B, 0x32, 0x5F, 0xA3, 0xB6, 0x4D, 0x89, 0x30, 0x56, 0x7C, 0x09, 0x7E, 0x64, 0x69,
+    0xEF, 0xE3, 0x3F, 0xA2, 0x0D, 0xA0, 0xC4, 0xB4, 0xF4, 0xBF, 0x79, 0xFE, 0x01, 0xA5, 0x55, 0x31,
+    0x8C, 0xDC, 0x44, 0x14, 0xFD, 0xB6, 0xB3, 0x19, 0x29, 0x46, 0x1A, 0x0A, 0xA8, 0x88, 0x32, 0x29,
+    0x68, 0xC9, 0xB4, 0x14, 0x97, 0xB5, 0x49, 0x24, 0x9A, 0x14, 0x49, 0x05, 0x25, 0x15, 0x1D, 0xD2,
+    0x5D, 0x91, 0x22, 0x42, 0xDE, 0x5D, 0x87, 0x14, 0x29, 0x52, 0x90, 0x12, 0x89, 0x86, 0x82, 0xEA,
+    0x84, 0x74, 0x0D, 0xC5, 0x09, 0x76, 0xE3, 0xB9, 0x4B, 0x91, 0x76, 0x50, 0xCA, 0x2B, 0x70, 0x71,
+    0x88, 0x92, 0x41, 0x99, 0x48, 0xBE, 0x9C, 0x6F, 0x87, 0xF7, 0xC7, 0xDE, 0x70, 0x11, 0x12, 0x42,
+    0xC2, 0xF2, 0xCE, 0xCC, 0x7A, 0xC6, 0xFF, 0xBF, 0xF7, 0xE6, 0xFD, 0x31, 0xD1, 0x70, 0xE5, 0x01,
+    0x97, 0x21, 0xDA, 0x46, 0x77, 0x8C, 0xFF, 0x33, 0x4A, 0x1D, 0x3F, 0x36, 0x54, 0xF0, 0x74, 0x4F,
+    0x19, 0xFF, 0x95, 0x35, 0x4D, 0xD1, 0x25, 0x1D, 0x09, 0x8B, 0x5E, 0x95, 0xB4, 0x44, 0x87, 0x95,
+    0xF2, 0xE0, 0x27, 0xE2, 0x95, 0xEB, 0xB0, 0xA6, 0xAC, 0x25, 0xB5, 0xDE, 0xF3, 0x08, 0x81, 0x75,
+    0xDA, 0xE4, 0x96, 0x34, 0x07, 0x88, 0x21, 0xA4, 0x91, 0x86, 0x43, 0x2C, 0x29, 0x86, 0x90, 0x06,
+    0x21, 0x56, 0x98, 0xE5, 0x10, 0x86, 0xE4, 0x61, 0x70, 0x39, 0x50, 0x74, 0x4D, 0x48, 0x43, 0x4F,
+    0xBA, 0x8C, 0xD0, 0x62, 0x66, 0x5C, 0xAB, 0xD8, 0xD6, 0xBA, 0xE6, 0x4E, 0xEF, 0xB5, 0xDC, 0xA5,
+    0xC1, 0x0F, 0xF0, 0x8F, 0x47, 0x1E, 0xD4, 0xD4, 0x8B, 0x1A, 0x6C, 0xF2, 0x80, 0x97, 0xBB, 0x15,
+    0xDE, 0xC9, 0x8E, 0xEE, 0x63, 0x8D, 0xDC, 0x17, 0x60, 0xB7, 0x30, 0x7A, 0x52, 0xA6, 0x3D, 0x85,
+    0x60, 0x65, 0x9B, 0x85, 0xC6, 0x16, 0xA4, 0x6A, 0x7D, 0xD0, 0x01, 0x4F, 0x21, 0x0C, 0x12, 0xAD,
+    0x34, 0x38, 0x26, 0xBE, 0xA3, 0xEB, 0x24, 0x9E, 0xDB, 0xC4, 0x91, 0x56, 0xAC, 0xC1, 0x32, 0xE2,
+    0x88, 0x19, 0x55, 0x39, 0xE8, 0x41, 0x74, 0x15, 0x13, 0x94, 0xBE, 0x3C, 0x8B, 0xEA, 0x61, 0x48,
+    0x97, 0xBE, 0xE7, 0xA9, 0x77, 0x79, 0x81, 0xE6, 0x05, 0xFA, 0x38, 0x29, 0x89, 0xF3, 0xD4, 0x99,
+    0x4F, 0x4E, 0x1A, 0x5A, 0xD3, 0x3C, 0xF5, 0x0A, 0x0A, 0xA8, 0x07, 0x3E, 0xF1, 0xD4, 0x15, 0x50,
+    0x4C, 0x3E, 0x6C, 0xB3, 0x36, 0xE9, 0x56, 0x34, 0x27, 0x75, 0xCB, 0x0A, 0x9B, 0xBA, 0x33, 0x08,
+    0x57, 0x48, 0x0C, 0x85, 0x7D, 0x82, 0xA7, 0xBD, 0x70, 0x99, 0xD3, 0x65, 0x41, 0x5A, 0xB4, 0x40,
+    0xBE, 0xEE, 0x48, 0x7A, 0xB1, 0x86, 0xD8, 0x21, 0xFC, 0xF6, 0x05, 0x2D, 0xC2, 0x76, 0x20, 0xBA,
+    0x40, 0x13, 0xA4, 0xBB, 0x43, 0x24, 0x00, 0x46, 0xDA, 0xED, 0x52, 0xD6, 0xC1, 0xCB, 0x7A, 0x5F,
+    0xE7, 0xA6, 0x12, 0x4F, 0xED, 0x34, 0xF9, 0xD3, 0xC9, 0xB2, 0x5A, 0x66, 0x56, 0xEB, 0xC4, 0xC9,
+    0xAF, 0xCD, 0x96, 0x38, 0x74, 0xF2, 0xA6, 0x9D, 0xA7, 0x2F, 0x9C, 0xB4, 0x45, 0x9B, 0x84, 0x3D,
+    0xFF, 0x7E, 0x1E, 0x9A, 0x0E, 0x81, 0x10, 0x84, 0x26, 0x68, 0x34, 0x84, 0x55, 0x70, 0x44, 0xEE,
+    0x93, 0x3E, 0xC5, 0x5E, 0x99, 0x39, 0xD1, 0x3E, 0xB6, 0x28, 0x4F, 0x59, 0xF0, 0x62, 0x23, 0xC7,
+    0x6C, 0xF0, 0x08, 0x45, 0x85, 0xE2, 0x80, 0x77, 0x29, 0xE7, 0xA9, 0x05, 0x70, 0x65, 0x3D, 0xA5,
+    0x56, 0x9D, 0x7C, 0xD2, 0x03, 0x28, 0x30, 0x37, 0xF8, 0x41, 0x59, 0xA8, 0xC6, 0x2B, 0xB7, 0xD0,
+    0x7F, 0x8B, 0x41, 0xE1, 0xA3, 0xA3, 0x86, 0x4B, 0x75, 0xD4, 0xF4, 0xD9, 0xCB, 0x0A, 0xB1, 0x14,
+    0xB1, 0x53, 0xB0, 0xBC, 0x8A, 0xE1, 0xFB, 0x78, 0xAF, 0xE8, 0xEE, 0xE2, 0x63, 0x57, 0x04, 0x23,
+    0x41, 0xF5, 0x5E, 0x0C, 0xF2, 0x21, 0x5D, 0xF3, 0xA4, 0x5B, 0x9A, 0x8C, 0x76, 0x81, 0x83, 0x7B,
+    0xA8, 0x13, 0x9E, 0x19, 0x4D, 0xD5, 0xBD, 0xCC, 0x89, 0x47, 0xE5, 0x94, 0xEE, 0xEE, 0x08, 0x7B,
+    0x71, 0x40, 0x27, 0xCD, 0xB8, 0x81, 0x70, 0x33, 0x25, 0x4C, 0x47, 0x6F, 0x5C, 0xF6, 0x4F, 0x5E,
+    0x58, 0x97, 0x34, 0x51, 0xEE, 0xD7, 0xF3, 0xEC, 0x7C, 0x40, 0x22, 0x36, 0x14, 0xFD, 0xC8, 0x83,
+    0x8D, 0xF7, 0x28, 0xEF, 0x84, 0x4F, 0x3B, 0x76, 0x9F, 0x08, 0xA5, 0x7C, 0xF4, 0xEB, 0xB3, 0x23,
+    0x9B, 0x1D, 0x7D, 0xF5, 0xFB, 0x81, 0xA7, 0xD3, 0xFA, 0x67, 0x53, 0xC1, 0x7F, 0x05, 0x40, 0x69,
+    0x23, 0xAD, 0xAC, 0x65, 0x8B, 0x9D, 0xB5, 0x99, 0x4B, 0x7D, 0xE2, 0x40, 0xBF, 0x07, 0xC7, 0x0A,
+    0x6C, 0xA7, 0x40, 0xA3, 0x48, 0xDE, 0x96, 0x75, 0x6E, 0xC4, 0xD1, 0x03, 0x0B, 0x77, 0x84, 0x5F,
+    0x1C, 0x79, 0x9A, 0xEE, 0xC4, 0x14, 0x1F, 0xC4, 0x56, 0x46, 0xAE, 0x11, 0x0A, 0x25, 0xB1, 0x3E,
+    0xD2, 0xA1, 0x10, 0xDE, 0x1E, 0x80, 0x40, 0xA0, 0x70, 0xA6, 0xD7, 0xB4, 0xF0, 0x5C, 0x74, 0x35,
+    0x9A, 0x82, 0x35, 0x66, 0x19, 0x99, 0xF1, 0x92, 0x49, 0x4E, 0x99, 0x60, 0xA1, 0x58, 0xF4, 0x28,
+    0x0B, 0x6F, 0x41, 0x1E, 0x8B, 0xDE, 0x6E, 0xD8, 0x47, 0xA9, 0x58, 0xA6, 0xC1, 0xF6, 0x3A, 0x56,
+    0x1C, 0xD6, 0xC9, 0x30, 0xEE, 0xD7, 0x82, 0xD4, 0xC3, 0x35, 0x62, 0x03, 0x7D, 0xEA, 0x52, 0x27,
+    0x6C, 0x6E, 0x64, 0x0D, 0x12, 0xC0, 0xD4, 0xCB, 0x3A, 0x75, 0x15, 0xC1, 0x7F, 0xA4, 0xAE, 0x11,
+    0xCD, 0x11, 0x39, 0x0C, 0x32, 0x33, 0xF8, 0x2A, 0x1E, 0x1B, 0x31, 0xF6, 0xF5, 0x61, 0x17, 0x16,
+    0x3D, 0x25, 0xBB, 0xDF, 0xD1, 0x7F, 0xC2, 0xBF, 0x8A, 0xF8, 0xF9, 0xE5, 0x82, 0x31, 0x29, 0x76,
+    0x9F, 0xC4, 0xF3, 0x74, 0xEF, 0x55, 0xCD, 0x06, 0x30, 0x1B, 0xE8, 0xFF, 0x03, 0xFF, 0xF2, 0x4D,
+    0xFC, 0xD3, 0x01, 0xFF, 0xA7, 0x27, 0x65, 0x06, 0x2B, 0x4F, 0x56, 0x77, 0xFE, 0x15, 0x3F, 0x17,
+    0x10, 0x18, 0xE0, 0x20, 0x2C, 0xB7, 0x3D, 0x23, 0xE7, 0xFC, 0x7D, 0x3C, 0x3C, 0xE7, 0xC4, 0xB9,
+    0x8B, 0x68, 0x33, 0x75, 0x2B, 0x02, 0xFC, 0x83, 0x5F, 0x10, 0x7D, 0xDC, 0x52, 0x3F, 0xF8, 0x88,
+    0x36, 0x87, 0x08, 0x55, 0xF3, 0xB8, 0xC7, 0x6C, 0x3D, 0x61, 0x55, 0xCD, 0x39, 0x99, 0xD6, 0x94,
+    0x44, 0x3B, 0x9E, 0xCB, 0xEF, 0x85, 0x52, 0x85, 0xBA, 0xE0, 0xDB, 0xD0, 0x86, 0xF5, 0x68, 0x11,
+    0x15, 0xC1, 0x5C, 0x39, 0x67, 0x9D, 0xCB, 0xA3, 0x55, 0xDB, 0xA4, 0x17, 0x01, 0x8E, 0xFC, 0xBC,
+    0x53, 0xDF, 0x90, 0x04, 0x4B, 0x9A, 0xED, 0x73, 0xF5, 0x70, 0x62, 0x33, 0x56, 0x64, 0x81, 0x41,
+    0x8E, 0x42, 0x4B, 0x5E, 0xB4, 0x57, 0x69, 0x4B, 0xE7, 0x37, 0x3E, 0xFB, 0xE8, 0xD4, 0x15, 0xAD,
+    0x0C, 0x59, 0x47, 0x33, 0x77, 0x01, 0x49, 0x38, 0x54, 0xFC, 0x32, 0xB0, 0xB4, 0xED, 0x58, 0x58,
+    0x93, 0x51, 0x03, 0xEC, 0xC4, 0x5A, 0x41, 0x87, 0x10, 0x6E, 0x84, 0xC7, 0x95, 0xCA, 0xE0, 0xFD,
+    0x2B, 0xB9, 0x71, 0xB9, 0xC9, 0x6F, 0xBA, 0x2D, 0x18, 0xDB, 0x74, 0x6F, 0xB1, 0x18, 0xB3, 0x78,
+    0xEB, 0x78, 0xC3, 0x76, 0x80, 0x0F, 0x71, 0x58, 0x1F, 0x1F, 0xEF, 0x59, 0x74, 0xCB, 0x30, 0x2D,
+    0xDF, 0x9C, 0x66, 0xDD, 0xAB, 0x73, 0xD3, 0x0D, 0x52, 0xAD, 0x63, 0x3B, 0x28, 0x11, 0xBF, 0x52,
+    0xC3, 0x97, 0x6C, 0x38, 0xA2, 0x5E, 0xD7, 0x4F, 0x6C, 0x53, 0xA8, 0x79, 0x69, 0xF7, 0x31, 0x09,
+    0x7C, 0x6C, 0x68, 0x77, 0x97, 0xCE, 0x5F, 0x69, 0x20, 0x71, 0x18, 0x4C, 0xD6, 0xA6, 0x0E, 0x59,
+    0xB8, 0x36, 0xB9, 0x32, 0x65, 0xC9, 0x75, 0x19, 0xCB, 0x96, 0x6B, 0xB2, 0xC7, 0xE3, 0x27, 0x78,
+    0xBC, 0x28, 0x73, 0xF3, 0xE5, 0xF3, 0xA7, 0x7E, 0x79, 0x6A, 0x9B, 0xBE, 0x70, 0xB2, 0xCB, 0x7F,
+    0x18, 0x93, 0xC4, 0x12, 0xF5, 0xE3, 0x89, 0xC1, 0x9F, 0x8A, 0x77, 0x36, 0x06, 0xBF, 0x1F, 0x7A,
+    0x7D, 0x96, 0x34, 0xC7, 0xD8, 0x40, 0x55, 0x82, 0x8E, 0x66, 0xB4, 0x05, 0x9F, 0x2A, 0x53, 0x56,
+    0x61, 0xC6, 0x44, 0x57, 0x5C, 0x8B, 0x4B, 0x12, 0xFE, 0x62, 0xCF, 0x62, 0x42, 0xAB, 0xE6, 0x95,
+    0xDF, 0x30, 0xCA, 0xFE, 0x6E, 0xDA, 0x0D, 0xD7, 0x58, 0xB5, 0x7C, 0x5E, 0x61, 0x35, 0x45, 0xB3,
+    0x8D, 0x87, 0x59, 0xCC, 0x4F, 0xFB, 0x34, 0x1E, 0x59, 0xB4, 0x33, 0xD2, 0xFC, 0x0B, 0xBD, 0x55,
+    0x3D, 0x8F, 0x1C, 0x45, 0x10, 0xAD, 0x99, 0x3E, 0x5F, 0x0B, 0xB5, 0xE4, 0x76, 0x42, 0x80, 0x30,
+    0x0C, 0x01, 0xA1, 0x6F, 0xE7, 0x0F, 0xDC, 0xEE, 0x0C, 0x36, 0x72, 0x0A, 0x01, 0x17, 0x39, 0x20,
+    0xB5, 0x04, 0xD2, 0xA5, 0x0E, 0xF6, 0x63, 0x10, 0x21, 0x01, 0x97, 0x11, 0x92, 0x22, 0x93, 0x38,
+    0xB4, 0xA5, 0xDD, 0x9B, 0xC6, 0x96, 0x4C, 0x40, 0xC0, 0x08, 0x84, 0x08, 0x3D, 0x12, 0x08, 0x02,
+    0x82, 0x6D, 0xC4, 0x60, 0xE6, 0xCC, 0xCC, 0x36, 0xAF, 0x6A, 0xD6, 0xBE, 0xE5, 0x23, 0x40, 0x42,
+    0x62, 0x4E, 0xDD, 0xA7, 0xFE, 0xAA, 0x7A, 0xF5, 0xEA, 0x55, 0x2D, 0x11, 0x51, 0x5A, 0xD3, 0x9D,
+    0x50, 0x2B, 0xAF, 0x6A, 0xFC, 0x55, 0xAA, 0xD2, 0x4E, 0x3B, 0xE3, 0x2C, 0x46, 0x5A, 0xE8, 0xC7,
+    0x21, 0x57, 0xE1, 0x51, 0x4E, 0x6F, 0x25, 0x7C, 0x13, 0x63, 0xF2, 0x12, 0xC6, 0x94, 0x28, 0x6B,
+    0x31, 0x6E, 0x61, 0x83, 0xC7, 0x74, 0x3B, 0x1A, 0x22, 0x5D, 0x13, 0x45, 0x24, 0x5F, 0x16, 0xDE,
+    0x0B, 0x5D, 0xDA, 0x47, 0xE5, 0xF7, 0xCA, 0x53, 0x92, 0xAB, 0x1A, 0x06, 0x74, 0x45, 0x19, 0x69,
+    0x47, 0x13, 0x32, 0xAE, 0x9A, 0x91, 0xFD, 0xAC, 0x5A, 0x91, 0xF9, 0xCA, 0x2D, 0x49, 0xFF, 0xF6,
+    0xB0, 0x23, 0x15, 0x02, 0xCC, 0x96, 0x4F, 0xD8, 0xCE, 0x55, 0x4F, 0x64, 0xF0, 0x90, 0x2C, 0x4F,
+    0x17, 0xF0, 0x9A, 0xF8, 0x35, 0x36, 0x1D, 0xA6, 0xB2, 0x23, 0xDC, 0xEE, 0xC5, 0xCF, 0x3F, 0x06,
+    0xF0, 0x39, 0x02, 0xF8, 0x02, 0x01, 0x84, 0x90, 0xC7, 0x1C, 0xC0, 0x01, 0x02, 0xB8, 0x8C, 0x00,
+    0xAE, 0x4C, 0x2E, 0x23, 0x80, 0x25, 0xD0, 0xC1, 0x6A, 0x56, 0x10, 0xED, 0x0D, 0x60, 0x63, 0x36,
+    0xB6, 0x1F, 0x4E, 0x80, 0xBE, 0x79, 0xEA, 0x24, 0xE3, 0x03, 0x00, 0x22, 0x71, 0x9E, 0x5C, 0xFF,
+    0x04, 0x7E, 0x71, 0x4D, 0x85, 0x4F, 0x3B, 0xB2, 0x15, 0x60, 0xCD, 0xC8, 0x54, 0x71, 0x83, 0xB0,
+    0x70, 0xBD, 0xC3, 0x75, 0xDC, 0x6B, 0xC9, 0x16, 0x80, 0x39, 0xC3, 0x66, 0xEC, 0x4D, 0x28, 0x16,
+    0x6D, 0x19, 0x54, 0xF0, 0xF4, 0x3C, 0x2C, 0x04, 0x18, 0x7D, 0x07, 0x6E, 0x69, 0xC9, 0x44, 0x62,
+    0xD8, 0x9C, 0x98, 0x0C, 0xDC, 0x64, 0x47, 0xC6, 0xD3, 0x38, 0xD9, 0x90, 0x4D, 0x3E, 0x76, 0xFA,
+    0x4B, 0xE5, 0xE3, 0x35, 0x8C, 0x85, 0x7C, 0x0C, 0x94, 0x09, 0x25, 0x48, 0x87, 0xA9, 0x10, 0x9F,
+    0x07, 0xC9, 0x2D, 0xC8, 0x86, 0x03, 0x84, 0x63, 0xD7, 0xC6, 0xA9, 0x00, 0xB7, 0x1B, 0xDA, 0x46,
+    0x72, 0x01, 0x26, 0x69, 0x81, 0x65, 0x14, 0xE0, 0x35, 0xEA, 0xA9, 0xBF, 0x18, 0xB5, 0x94, 0x7C,
+    0x08, 0x7C, 0xEA, 0x77, 0xF0, 0x4C, 0x1B, 0x0F, 0xCF, 0x93, 0x19, 0xA8, 0x48, 0xDE, 0x08, 0xF8,
+    0x5C, 0x89, 0xC9, 0xC7, 0x67, 0x47, 0x47, 0x6F, 0xD2, 0x4A, 0xE8, 0x64, 0x0B, 0x86, 0x99, 0x8E,
+    0x99, 0x09, 0x5A, 0x80, 0x38, 0x84, 0xCB, 0x01, 0x6D, 0x8E, 0x4A, 0x4E, 0xEB, 0x86, 0xE9, 0x62,
+    0x5E, 0xB6, 0x89, 0xC6, 0xF7, 0x22, 0x96, 0xA7, 0x1B, 0x10, 0x90, 0x91, 0x29, 0x32, 0x90, 0x3D,
+    0x9B, 0x4E, 0xA2, 0x6E, 0x3A, 0x36, 0xF5, 0xE4, 0xB4, 0xCC, 0xD3, 0xD0, 0x30, 0x94, 0x21, 0xF0,
+    0x25, 0x5D, 0xA1, 0xC5, 0xF5, 0x16, 0x76, 0x2A, 0xB2, 0x8C, 0x3B, 0xFF, 0xDF, 0x71, 0xB3, 0x48,
+    0x87, 0x3C, 0x0B, 0x22, 0x1A, 0xF1, 0x64, 0x44, 0x06, 0x8E, 0x76, 0xBF, 0xFF, 0x12, 0x16, 0x9B,
+    0xF7, 0xDB, 0xC1, 0xFE, 0x18, 0x59, 0x31, 0x08, 0x36, 0x54, 0xAC, 0xB4, 0x24, 0x67, 0xDD, 0xB0,
+    0xBA, 0x3B, 0x91, 0xC3, 0xF9, 0x1A, 0x5E, 0x67, 0x12, 0xD0, 0x9F, 0xD7, 0x90, 0x5F, 0x0F, 0x05,
+    0xE6, 0xBB, 0x08, 0xF7, 0xE8, 0x55, 0xF9, 0xDF, 0x44, 0x6C, 0x1F, 0x48, 0xAD, 0x2C, 0xED, 0x0F,
+    0x12, 0x1D, 0x25, 0x61, 0xB8, 0x16, 0xED, 0x3E, 0x7A, 0x41, 0x76, 0x4E, 0xA2, 0x00, 0xB0, 0xB4,
+    0x70, 0x7A, 0x43, 0x65, 0xAD, 0x03, 0x3D, 0xB7, 0xA2, 0x31, 0xCD, 0x6F, 0x12, 0xDD, 0x8D, 0xBC,
+    0x54, 0x9A, 0x37, 0x6E, 0xCC, 0x9C, 0xD4, 0x99, 0x14, 0x80, 0x72, 0x6D, 0x2A, 0x44, 0x5D, 0xAB,
+    0xBC, 0xB0, 0x96, 0xBE, 0xCD, 0x56, 0x91, 0xB0, 0x4E, 0x5C, 0x7E, 0xFB, 0x58, 0x7C, 0xF6, 0xF6,
+    0x7D, 0x3E, 0x36, 0xF5, 0x4C, 0x8C, 0x94, 0x91, 0xB7, 0x20, 0x55, 0xC3, 0x18, 0x67, 0x68, 0x91,
+    0x4F, 0xB8, 0xAE, 0x74, 0x0B, 0x7E, 0x4E, 0xB1, 0x2C, 0xA0, 0xFF, 0x9E, 0x4C, 0x4B, 0xA5, 0x8F,
+    0x7B, 0x2C, 0x6D, 0x70, 0x71, 0x47, 0x97, 0xE8, 0x6F, 0xDF, 0x2B, 0xEC, 0xCA, 0x69, 0x92, 0x56,
+    0xE3, 0x25, 0x89, 0x87, 0x43, 0x97, 0x91, 0xD0, 0x8E, 0x8B, 0xBF, 0xDC, 0x37, 0x4D, 0x5C, 0xC5,
+    0x9D, 0x0A, 0xEE, 0x90, 0x42, 0x75, 0x6F, 0xA5, 0xDD, 0xE4, 0xDD, 0x8B, 0xAA, 0x6E, 0xB9, 0xE4,
+    0x46, 0xD9, 0x55, 0x20, 0x8B, 0x7E, 0xF4, 0xDC, 0xB3, 0x46, 0x8F, 0x12, 0x3C, 0x8D, 0xCF, 0x7E,
+    0x61, 0x9B, 0xD9, 0x68, 0xCD, 0x96, 0x1F, 0x74, 0x92, 0xB8, 0x8C, 0xB9, 0x3C, 0x50, 0x55, 0xA3,
+    0xF7, 0x6F, 0x14, 0x53, 0x7B, 0xDF, 0x87, 0xDA, 0xE4, 0x65, 0x67, 0x1A, 0xF2, 0xAA, 0xDF, 0xF5,
+    0xB5, 0x9F, 0x9B, 0xE0, 0x75, 0x47, 0xC7, 0x67, 0x11, 0x6A, 0x7C, 0x46, 0x8B, 0x9B, 0xC8, 0x1C,
+    0x9B, 0xED, 0x98, 0x38, 0xCB, 0xF2, 0xA5, 0x96, 0x3B, 0x68, 0x72, 0x8D, 0xAB, 0xFD, 0x49, 0x2F,
+    0xB8, 0xB9, 0x85, 0xFD, 0x7A, 0xEC, 0x39, 0xB7, 0x99, 0x63, 0xE5, 0xF6, 0xAC, 0x22, 0x53, 0xE3,
+    0x01, 0x8B, 0xB7, 0x25, 0x69, 0x9B, 0x34, 0xE7, 0xF6, 0xA0, 0x6B, 0x56, 0xEE, 0x0A, 0xD9, 0x77,
+    0xD6, 0x3D, 0x6D, 0x4B, 0xD2, 0xA0, 0x2E, 0xB1, 0xE4, 0xED, 0x4F, 0xBC, 0x96, 0x7E, 0x18, 0x9F,
+    0x6D, 0x41, 0x95, 0x45, 0xF2, 0xC1, 0x06, 0x39, 0x6E, 0xED, 0x5D, 0x84, 0x40, 0x56, 0x17, 0x34,
+    0x3D, 0xA4, 0xF8, 0x67, 0xD8, 0x5F, 0xB3, 0x4C, 0xBB, 0xA8, 0x51, 0x8D, 0x76, 0xCA, 0x8F, 0xE0,
+    0xB0, 0xA5, 0x54, 0x55, 0xB4, 0x4C, 0xA4, 0x15, 0xD9, 0x42, 0xDA, 0x39, 0xDC, 0xE7, 0x68, 0x31,
+    0x1F, 0x35, 0x2C, 0x13, 0x1A, 0x9D, 0x3C, 0x0B, 0x17, 0x6D, 0x3A, 0xD4, 0x64, 0x02, 0xFB, 0x8B,
+    0x6B, 0xBE, 0x6D, 0x73, 0xE8, 0x93, 0x0E, 0xF9, 0xF1, 0x90, 0x6E, 0x54, 0x0B, 0x36, 0xC6, 0x0C,
+    0x73, 0x10, 0x93, 0x29, 0x52, 0xD9, 0xE8, 0x78, 0x43, 0x58, 0xC9, 0x13, 0x71, 0x33, 0x63, 0xD1,
+    0xF2, 0xC3, 0x94, 0xE3, 0x7E, 0xAD, 0x41, 0x25, 0xA8, 0x75, 0xC1, 0xB5, 0xDF, 0x71, 0x3F, 0xC8,
+    0xD0, 0xC2, 0x5B, 0xD6, 0x83, 0x74, 0x64, 0xE9, 0x9A, 0x52, 0x12, 0xE0, 0x72, 0xD0, 0x3D, 0x4F,
+    0xFA, 0x3C, 0x15, 0x65, 0x3B, 0x48, 0xC2, 0xDC, 0xF7, 0x9C, 0x41, 0xCE, 0x5F, 0x0D, 0xE5, 0x42,
+    0xC7, 0xB7, 0xA0, 0x34, 0x93, 0x23, 0x15, 0x1E, 0x88, 0x5F, 0xC6, 0x43, 0x55, 0x25, 0xAF, 0xD3,
+    0x34, 0xF6, 0xDF, 0xAD, 0xF3, 0x74, 0x9E, 0x79, 0x15, 0xBE, 0xEE, 0x28, 0x5D, 0xEE, 0x31, 0xD6,
+    0x6D, 0xD9, 0x1E, 0x88, 0xEA, 0x31, 0xDD, 0xD9, 0xCD, 0x76, 0x8A, 0x1C, 0x84, 0x1A, 0x15, 0x1C,
+    0x83, 0x05, 0x24, 0x08, 0xB0, 0xB9, 0x4E, 0x6B, 0xC6, 0xC5, 0x4D, 0xA5, 0x93, 0x86, 0x30, 0x91,
+    0xF4, 0x6C, 0x8F, 0xBF, 0x39, 0xBA, 0x51, 0x0B, 0x6D, 0x38, 0xDE, 0xDC, 0xBE, 0x8D, 0x1B, 0x73,
+    0x39, 0x46, 0x45, 0x00, 0x0C, 0x5E, 0x83, 0x22, 0xBC, 0xE6, 0xC6, 0xD5, 0x8A, 0x81, 0xD9, 0x70,
+    0x2C, 0xB9, 0xC0, 0x6F, 0x1D, 0x8E, 0xCB, 0x30, 0xFC, 0x4C, 0x6C, 0x53, 0xCF, 0x37, 0xD0, 0x4F,
+    0xE4, 0x27, 0x6A, 0x5E, 0x9E, 0x97, 0xFA, 0xB3, 0xF4, 0xFF, 0xAB, 0xEF, 0x0F, 0xBD, 0x55, 0xBF,
+    0x6F, 0x23, 0x45, 0x18, 0x7D, 0xBB, 0x7B, 0xC9, 0x4A, 0xAC, 0xC4, 0xA4, 0x00, 0x51, 0x04, 0x58,
+    0xCA, 0x14, 0xB9, 0x6C, 0x43, 0x69, 0x7B, 0xF7, 0x94, 0x92, 0xE2, 0xAE, 0xF1, 0x51, 0x5C, 0x91,
+    0x3F, 0xC1, 0x14, 0x29, 0x52, 0xD8, 0xF1, 0xA2, 0xFB, 0x03, 0x48, 0x4F, 0x43, 0x6D, 0x89, 0xEE,
+    0x8A, 0x2B, 0x7C, 0xF1, 0x40, 0x0A, 0x0A, 0x8A, 0x1B, 0x09, 0x21, 0x8A, 0x14, 0x0C, 0xE8, 0x22,
+    0x8A, 0x93, 0x60, 0x05, 0x06, 0x96, 0xCB, 0xDA, 0xC3, 0xFB, 0x66, 0xED, 0xFC, 0xA0, 0x42, 0x42,
+    0x62, 0x24, 0xCF, 0xD8, 0x9E, 0x9D, 0xF9, 0xDE, 0x7B, 0xDF, 0xFB, 0xBE, 0x05, 0x80, 0x99, 0x0E,
+    0xCF, 0x1D, 0x54, 0x39, 0x45, 0x37, 0xB2, 0x41, 0xA5, 0x8A, 0x44, 0x0F, 0xD1, 0x0B, 0x7F, 0xEF,
+    0xD7, 0xCA, 0x39, 0xD3, 0xEB, 0x0F, 0x30, 0xC7, 0x34, 0xD6, 0x91, 0xCD, 0xA0, 0x8A, 0x1A, 0x9D,
+    0xC8, 0x04, 0x55, 0x8A, 0xA4, 0x04, 0xBA, 0x3C, 0x5D, 0x01, 0x89, 0xC6, 0x7B, 0x5D, 0x04, 0xCE,
+    0x22, 0x76, 0xFC, 0x75, 0x82, 0xF5, 0xC8, 0x9C, 0x56, 0xCE, 0x6E, 0xBA, 0x93, 0x90, 0x7B, 0x69,
+    0x01, 0xA5, 0xE5, 0xD9, 0xC8, 0x22, 0xAA, 0x10, 0xCC, 0x81, 0x06, 0x98, 0x02, 0x3D, 0x20, 0x87,
+    0xDF, 0x2E, 0x91, 0x7C, 0xDB, 0x7F, 0xC4, 0x6D, 0xE7, 0x1C, 0xB7, 0x97, 0x93, 0x09, 0x9F, 0x38,
+    0xF6, 0xDB, 0x59, 0xBB, 0xAD, 0x11, 0x1B, 0x39, 0x1D, 0x72, 0xBB, 0xF6, 0xA7, 0x47, 0xED, 0x36,
+    0x64, 0x7B, 0xD6, 0x60, 0xB0, 0xC4, 0xCC, 0x21, 0x77, 0x5A, 0xE2, 0x27, 0x46, 0x66, 0x3E, 0xCE,
+    0x11, 0xFA, 0x59, 0xA2, 0x72, 0xB4, 0xF3, 0xFB, 0x2D, 0xCA, 0xA4, 0xC1, 0xDD, 0x44, 0x04, 0x48,
+    0x74, 0x64, 0x44, 0x01, 0xE1, 0x0B, 0x4A, 0x80, 0xAC, 0x7F, 0x50, 0x8A, 0x06, 0xD1, 0xC5, 0xC3,
+    0x1B, 0x7F, 0x42, 0xDD, 0x57, 0x65, 0x74, 0x7E, 0x66, 0xE0, 0x7E, 0xA8, 0x90, 0xCB, 0x5D, 0x1D,
+    0x7E, 0xEE, 0xF2, 0xA3, 0x56, 0x9F, 0xB8, 0xB8, 0xD2, 0x80, 0x58, 0x3E, 0x76, 0x4D, 0xB6, 0x08,
+    0x66, 0x2F, 0x08, 0x24, 0x2D, 0xC8, 0x3E, 0x13, 0x12, 0x39, 0x62, 0xCD, 0xDB, 0xC8, 0x68, 0x24,
+    0xBA, 0x3C, 0x13, 0xB0, 0x53, 0xC4, 0xF3, 0xCD, 0x46, 0xE8, 0x93, 0xDB, 0xEC, 0xD5, 0x7C, 0x0D,
+    0x3B, 0xBA, 0x9E, 0xAC, 0xDC, 0x2E, 0xB4, 0x78, 0x10, 0x01, 0x09, 0x53, 0xF3, 0xC5, 0xEA, 0xAF,
+    0x58, 0xAF, 0xA7, 0x44, 0xE2, 0x27, 0x12, 0x7D, 0x73, 0x85, 0x62, 0x56, 0x86, 0xCF, 0x97, 0x0C,
+    0x5A, 0xA3, 0x26, 0x49, 0x93, 0x22, 0x65, 0xB4, 0x26, 0xAC, 0x12, 0x1B, 0xFF, 0xE1, 0x0A, 0xE5,
+    0x46, 0xD8, 0xB8, 0xD7, 0xA6, 0x52, 0xF2, 0x21, 0x02, 0x6D, 0x53, 0x68, 0xE7, 0x55, 0x27, 0x6D,
+    0x04, 0xB6, 0xBD, 0x75, 0x17, 0xB7, 0x46, 0xE2, 0x4A, 0x64, 0x4B, 0x84, 0x5C, 0x72, 0x62, 0xA6,
+    0xEC, 0x33, 0xED, 0x97, 0x4B, 0x8D, 0xE0, 0x52, 0x87, 0x2F, 0x35, 0xC2, 0x9F, 0x4C, 0xFC, 0x35,
+    0xB3, 0xFE, 0x8D, 0x51, 0xF7, 0x99, 0xBE, 0x33, 0x9B, 0x8A, 0x0D, 0xCE, 0x6C, 0x97, 0x37, 0xAB,
+    0xFD, 0xEA, 0x48, 0x96, 0xB0, 0xAA, 0xB8, 0x64, 0xC1, 0xAF, 0x96, 0x4B, 0x0F, 0x7F, 0x6A, 0x55,
+    0xD0, 0x5C, 0xAE, 0xA0, 0x29, 0x86, 0x70, 0xE2, 0x8D, 0xA7, 0x54, 0x28, 0x15, 0x5C, 0x47, 0x94,
+    0x8F, 0x29, 0xDA, 0xE2, 0xB2, 0xBD, 0x14, 0x09, 0xE6, 0xB9, 0x13, 0x11, 0xDA, 0x94, 0xB6, 0xB9,
+    0x5E, 0x25, 0xDE, 0x63, 0x87, 0x37, 0x87, 0x8C, 0x61, 0xBB, 0x7C, 0xB6, 0x86, 0x5E, 0x23, 0x9A,
+    0x8B, 0x31, 0x79, 0xDC, 0x21, 0xB3, 0x78, 0x7D, 0x1E, 0x7D, 0x8E, 0xE0, 0xBC, 0xFC, 0xCD, 0x60,
+    0x77, 0xF8, 0x6E, 0x07, 0xE1, 0xD9, 0xD9, 0x57, 0x1A, 0x9D, 0xCE, 0xE1, 0x53, 0x44, 0x8F, 0x9F,
+    0xD3, 0xEF, 0x87, 0x3D, 0x33, 0x87, 0x8A, 0x1A, 0x75, 0x07, 0x36, 0x2F, 0xAA, 0x57, 0xA3, 0xA8,
+    0x52, 0x03, 0xA7, 0x09, 0xF4, 0x65, 0x15, 0x14, 0xAA, 0xF1, 0x00, 0xBC, 0xF1, 0x9E, 0xC8, 0x94,
+    0x5E, 0xFF, 0x3E, 0xC4, 0xCD, 0x9A, 0xD8, 0xA4, 0x5A, 0xA4, 0x24, 0xA5, 0x50, 0x79, 0x1B, 0xF7,
+    0xF0, 0xEF, 0x7F, 0xC7, 0xAE, 0x4C, 0x5C, 0x75, 0x75, 0xDD, 0x1D, 0x7C, 0x24, 0x39, 0x17, 0xD3,
+    0x35, 0x21, 0x59, 0x27, 0x17, 0xB5, 0x04, 0x59, 0xC8, 0xDE, 0x1B, 0xD7, 0x51, 0x37, 0xAE, 0xC5,
+    0x19, 0x7B, 0x65, 0xBC, 0xB7, 0x7E, 0x11, 0x7D, 0x3A, 0x82, 0x5B, 0x7D, 0x20, 0x76, 0xAA, 0x58,
+    0x4F, 0xE8, 0x8A, 0x97, 0x12, 0x2D, 0x2E, 0xA8, 0xC4, 0x6E, 0x7B, 0x52, 0x5F, 0xD1, 0xC5, 0x87,
+    0x3C, 0xCC, 0xB2, 0x2C, 0x90, 0x4E, 0x26, 0xB5, 0xF8, 0x30, 0x2D, 0xA5, 0xFC, 0x1A, 0xF6, 0x04,
+    0xFA, 0x57, 0x6C, 0x4A, 0x8B, 0x9F, 0x60, 0xB0, 0x18, 0x33, 0x5F, 0xCE, 0x5C, 0xC1, 0x7B, 0x0D,
+    0x3B, 0x4C, 0xC0, 0x21, 0x72, 0x26, 0x2D, 0xA5, 0x31, 0xC2, 0xBF, 0xAE, 0x51, 0xA5, 0xF3, 0x27,
+    0xAC, 0xD6, 0x2A, 0xAC, 0x33, 0x1B, 0x9B, 0xD8, 0xA8, 0x32, 0xD6, 0x99, 0x0F, 0xAD, 0xCA, 0x11,
+    0x19, 0x4F, 0x19, 0x79, 0x4A, 0xBC, 0x0D, 0x96, 0x68, 0xA2, 0x9F, 0xDF, 0x3E, 0x3D, 0xD8, 0x1B,
+    0x8E, 0x17, 0x59, 0x95, 0xD9, 0x54, 0x07, 0xFE, 0x82, 0xA0, 0x10, 0x8E, 0xC7, 0x31, 0x61, 0x2A,
+    0x4B, 0x37, 0x60, 0x9A, 0xE8, 0xDB, 0x06, 0xFD, 0xFF, 0x89, 0x6F, 0xE0, 0x01, 0xB2, 0xC7, 0x73,
+    0xE4, 0xFB, 0x15, 0xF6, 0x42, 0x73, 0x0B, 0xCD, 0x7F, 0x26, 0xBC, 0x1E, 0xD2, 0x21, 0xA5, 0x15,
+    0x0C, 0x7C, 0xA3, 0x94, 0x16, 0x26, 0xBD, 0x98, 0xED, 0x57, 0x8C, 0x10, 0x7D, 0x5F, 0x46, 0x24,
+    0x18, 0x7D, 0xE7, 0x83, 0x87, 0x3F, 0xAE, 0xFA, 0xDF, 0xD4, 0x2B, 0x56, 0xE5, 0x1B, 0x0F, 0xA4,
+    0xC0, 0x95, 0x13, 0xFA, 0xB5, 0xEF, 0x1E, 0x78, 0xF6, 0xB0, 0x55, 0xC8, 0xFF, 0x87, 0x6E, 0xDF,
+    0x4B, 0xD5, 0x95, 0xFA, 0x29, 0x29, 0x03, 0x75, 0x79, 0xC2, 0x1C, 0x92, 0x6A, 0x47, 0x4C, 0xCD,
+    0x26, 0x8B, 0xAC, 0x0E, 0x45, 0x93, 0x7C, 0x29, 0x40, 0xD6, 0x92, 0x87, 0xEE, 0x9E, 0x2B, 0x62,
+    0xE7, 0x2E, 0xD9, 0x55, 0x32, 0xD3, 0x8D, 0x6D, 0x64, 0xD4, 0xBE, 0x65, 0x8F, 0xF9, 0x92, 0xDD,
+    0x33, 0x31, 0x35, 0xA6, 0xA9, 0x19, 0x21, 0x1F, 0x93, 0x73, 0xB6, 0xE4, 0x5B, 0x86, 0xB9, 0x60,
+    0x05, 0xD1, 0xAF, 0x4D, 0x32, 0xC6, 0x3B, 0xD9, 0xA7, 0x9F, 0xD8, 0x41, 0xEC, 0xBE, 0x70, 0x0E,
+    0xAE, 0x4C, 0x17, 0x20, 0xE1, 0xAD, 0x2B, 0xBE, 0x5B, 0xA0, 0xF9, 0x75, 0x22, 0xB5, 0x7C, 0x44,
+    0x9C, 0x8F, 0x18, 0x72, 0x26, 0x46, 0x7F, 0xF3, 0x86, 0x26, 0x82, 0xC8, 0x6C, 0x72, 0x92, 0x2E,
+    0x3F, 0x94, 0x72, 0x61, 0x77, 0x46, 0x54, 0x48, 0x05, 0xB5, 0x8D, 0x33, 0x95, 0xB6, 0x38, 0x45,
+    0x21, 0xF2, 0xB1, 0xEB, 0x08, 0xF5, 0x63, 0x39, 0x38, 0x5F, 0xF5, 0x53, 0x3E, 0x1E, 0x94, 0x7C,
+    0x5C, 0x09, 0xE5, 0x21, 0xDF, 0x39, 0x6F, 0xD9, 0x44, 0xEE, 0x9B, 0xB9, 0x56, 0x18, 0x6F, 0xE8,
+    0x1D, 0x30, 0x6F, 0xBB, 0xC4, 0x5C, 0xC6, 0x4C, 0xC1, 0xF6, 0x8B, 0x75, 0xF8, 0x80, 0x57, 0x9E,
+    0x2E, 0xD0, 0x8B, 0x6C, 0x52, 0xF6, 0x82, 0x2A, 0x36, 0xBD, 0x80, 0xAD, 0xF6, 0x14, 0x23, 0x57,
+    0x24, 0x74, 0x0F, 0x63, 0xB1, 0xEF, 0x31, 0xFA, 0x4E, 0x6C, 0x07, 0x45, 0xEE, 0x8C, 0xBC, 0x2F,
+    0xE1, 0xDF, 0x13, 0x7D, 0x39, 0xBC, 0x14, 0x97, 0x35, 0xC8, 0x0B, 0x65, 0x99, 0xBC, 0x9C, 0x8C,
+    0x03, 0xC1, 0x2D, 0x67, 0xD0, 0x5C, 0x7D, 0xD9, 0xE8, 0xF7, 0x0F, 0x34, 0x21, 0x35, 0xD9, 0x64,
+    0x32, 0xDB, 0xB7, 0xCC, 0x09, 0xDF, 0x7F, 0xBD, 0x58, 0xDE, 0xAB, 0x43, 0x1E, 0x20, 0xEC, 0x31,
+    0xAF, 0xC8, 0xCA, 0x80, 0x52, 0x40, 0xF0, 0xE1, 0xB6, 0x6F, 0xFE, 0x39, 0xFE, 0x06, 0xCD, 0x55,
+    0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xC6, 0xC3, 0x65, 0x04, 0x16, 0x4C, 0x8A, 0x20, 0x81, 0x22,
+    0xE1, 0x1E, 0x29, 0xE7, 0x96, 0x22, 0x77, 0xB6, 0x92, 0x22, 0x45, 0x9A, 0x6B, 0xAE, 0xA2, 0x48,
+    0x8F, 0x90, 0xEE, 0x0F, 0xDC, 0x66, 0x1D, 0x52, 0xD0, 0xA6, 0x4F, 0x01, 0x25, 0xDA, 0x02, 0x9A,
+    0x2B, 0x40, 0xDA, 0x5D, 0x8F, 0xC2, 0x0F, 0xC8, 0x44, 0x08, 0x51, 0xC6, 0xA0, 0x00, 0x45, 0x0A,
+    0x46, 0x8A, 0x23, 0x1C, 0x65, 0x76, 0x87, 0xEF, 0x79, 0x2F, 0x77, 0x17, 0x71, 0x45, 0x0A, 0x0A,
+    0x2C, 0xAD, 0x67, 0xED, 0xF7, 0xE6, 0xCD, 0xFB, 0xBE, 0xF7, 0xBD, 0x67, 0x00, 0x30, 0x6B, 0x14,
+    0x29, 0xD8, 0x66, 0x65, 0x50, 0x34, 0xD0, 0x1D, 0xD4, 0x80, 0xCB, 0x6B, 0x4C, 0xBF, 0xAA, 0xD7,
+    0xC6, 0xC5, 0x2C, 0x44, 0xD5, 0xEF, 0x20, 0xDA, 0x26, 0xEA, 0x97, 0x11, 0x55, 0x0F, 0xD4, 0xDC,
+    0xA4, 0xEA, 0x4B, 0xC0, 0x32, 0xEF, 0x60, 0xBB, 0x35, 0x68, 0x75, 0x38, 0xBD, 0xF6, 0x69, 0x4E,
+    0x7C, 0x9B, 0x12, 0xFD, 0x6B, 0xDB, 0xE9, 0x06, 0x15, 0x2E, 0x4A, 0x58, 0x60, 0x74, 0x8C, 0x27,
+    0x7F, 0xB6, 0xF6, 0xF7, 0x6F, 0xB9, 0x44, 0xC7, 0x72, 0x36, 0x6B, 0xAF, 0x77, 0xC8, 0xC2, 0x04,
+    0xD8, 0x35, 0x0E, 0xB9, 0x3B, 0xE4, 0x06, 0xE3, 0x31, 0x65, 0x88, 0xB2, 0x51, 0x29, 0x79, 0x98,
+    0xD4, 0x31, 0xB2, 0x9C, 0x70, 0x49, 0xD5, 0xD6, 0x47, 0xC4, 0xC2, 0xE5, 0x75, 0x7F, 0xE6, 0x64,
+    0x95, 0xC4, 0x13, 0xBB, 0xBA, 0x1F, 0xB1, 0x80, 0x27, 0x72, 0x39, 0x18, 0x04, 0x4C, 0x75, 0x27,
+    0x58, 0x57, 0xEA, 0x60, 0x3C, 0xD1, 0xE8, 0xAE, 0x42, 0xD5, 0x3A, 0x30, 0xEA, 0x08, 0xE7, 0x18,
+    0x10, 0xAF, 0xEA, 0xFA, 0x18, 0x50, 0xAD, 0xAC, 0x97, 0x55, 0x77, 0xBB, 0xF8, 0xD7, 0xA5, 0xEE,
+    0xC9, 0xFD, 0x43, 0x14, 0x41, 0xA7, 0x60, 0x22, 0xA6, 0x5D, 0x4E, 0xBE, 0x02, 0xEE, 0x7B, 0xED,
+    0xCD, 0x1F, 0x0D, 0xF2, 0xA6, 0xC0, 0x44, 0x30, 0x62, 0xAE, 0x25, 0xCA, 0xB6, 0x0E, 0x63, 0x94,
+    0xAB, 0xF6, 0x8B, 0x20, 0xEB, 0xD1, 0x8E, 0x95, 0x25, 0xFB, 0xED, 0xF9, 0x78, 0x56, 0x91, 0xD2,
+    0x48, 0xDF, 0x6A, 0x7A, 0x20, 0xB9, 0x58, 0x3F, 0x54, 0xF2, 0xB8, 0x34, 0x5E, 0x82, 0xE4, 0xA1,
+    0x18, 0x09, 0x9B, 0x62, 0x9E, 0xD1, 0xDD, 0xF4, 0xBA, 0xD3, 0x8C, 0x32, 0x6D, 0x6C, 0x4D, 0xFA,
+    0xCD, 0x80, 0x43, 0xEE, 0x40, 0xDB, 0xE4, 0x09, 0xA5, 0xE7, 0x23, 0x49, 0x2F, 0x9D, 0x3A, 0x4D,
+    0x76, 0xEF, 0x83, 0x11, 0x96, 0x91, 0x93, 0x4D, 0x58, 0xCA, 0xC3, 0x27, 0xA6, 0xC1, 0x79, 0x57,
+    0xDE, 0x67, 0x3E, 0x8B, 0x3A, 0xB9, 0xAB, 0x24, 0xE6, 0x87, 0x85, 0x71, 0xBB, 0x9F, 0xBF, 0xA7,
+    0xBB, 0xC1, 0x32, 0xAB, 0xED, 0xEA, 0x1A, 0x91, 0xA8, 0x3F, 0xC3, 0xA1, 0xE0, 0x79, 0x2C, 0xE4,
+    0x66, 0x2F, 0x9E, 0x49, 0xCC, 0x6A, 0xFB, 0x2F, 0x89, 0xFC, 0x63, 0x94, 0x87, 0x50, 0x09, 0xB2,
+    0x2B, 0xDA, 0xF7, 0xE6, 0xC2, 0xA7, 0xCD, 0xA1, 0x7D, 0x10, 0x52, 0x97, 0xD7, 0x6D, 0xCC, 0x7B,
+    0x04, 0xBD, 0x3A, 0x39, 0x68, 0x0B, 0x7B, 0x22, 0x1E, 0xDD, 0x53, 0x1E, 0x2E, 0x9E, 0xBC, 0x7E,
+    0xBF, 0x46, 0x99, 0x3A, 0x56, 0xB0, 0xCB, 0x9D, 0x75, 0x3B, 0x28, 0xEB, 0x80, 0x89, 0x6A, 0x54,
+    0xD8, 0xC8, 0x65, 0x01, 0x75, 0xCB, 0xA3, 0xA2, 0xB2, 0xBE, 0x5B, 0x4B, 0x85, 0x30, 0x4A, 0x4A,
+    0x87, 0x3D, 0xD8, 0x2F, 0x1B, 0x2C, 0x2A, 0xC2, 0x6B, 0xD1, 0x52, 0x76, 0x3D, 0x5A, 0x1A, 0xDF,
+    0x3A, 0x16, 0x8A, 0x1B, 0x85, 0x62, 0xEB, 0x70, 0x06, 0xA9, 0x49, 0xB5, 0x4E, 0x2B, 0x7C, 0xAF,
+    0xC3, 0xDB, 0x28, 0xA5, 0xCA, 0xC0, 0x1C, 0x19, 0xC9, 0x69, 0xE9, 0x55, 0xF0, 0xAC, 0x89, 0x82,
+    0xF1, 0x47, 0x98, 0x53, 0x32, 0x4D, 0x9B, 0xBA, 0x2C, 0xF5, 0xAF, 0x84, 0x42, 0xEF, 0x44, 0x75,
+    0x57, 0xCC, 0xD2, 0x38, 0x26, 0x70, 0x84, 0xDB, 0x2C, 0x34, 0x09, 0xD9, 0x33, 0xDD, 0x26, 0x23,
+    0xBE, 0x60, 0xC2, 0x4F, 0x44, 0x8E, 0x9D, 0x14, 0x8E, 0xFB, 0xD4, 0xA9, 0xE4, 0x19, 0xC6, 0xBA,
+    0x2B, 0x74, 0x64, 0x15, 0x29, 0xC2, 0xA6, 0xF4, 0x4A, 0x32, 0x36, 0x72, 0xC2, 0x78, 0x04, 0xDB,
+    0x01, 0x53, 0x4A, 0x62, 0x1B, 0xB9, 0xB7, 0xCC, 0x42, 0xD7, 0x12, 0x58, 0x7E, 0xFA, 0xCC, 0x2F,
+    0x4B, 0x74, 0x6D, 0xFB, 0x51, 0x18, 0x1B, 0xAB, 0xA8, 0x1D, 0xA2, 0x33, 0xCB, 0xE2, 0x18, 0xFF,
+    0x2E, 0x99, 0xC9, 0x7D, 0xD6, 0xAB, 0x74, 0xBF, 0xA7, 0xC4, 0xE8, 0xF9, 0xD9, 0x08, 0x20, 0x9B,
+    0x7D, 0x33, 0x76, 0x8A, 0xEC, 0xC7, 0xC7, 0xB3, 0x73, 0x95, 0x90, 0x27, 0x2A, 0x7B, 0x50, 0xED,
+    0x13, 0xB4, 0x03, 0x43, 0x31, 0x12, 0x3B, 0x13, 0xD9, 0x20, 0xE9, 0x67, 0xA4, 0xB6, 0x22, 0x07,
+    0x72, 0x8E, 0x7E, 0xEC, 0x24, 0xC1, 0x9F, 0xA4, 0x71, 0xF5, 0x23, 0x31, 0x6B, 0xBF, 0x69, 0x60,
+    0x92, 0x5A, 0xDC, 0x60, 0x11, 0x91, 0xFF, 0xE2, 0x98, 0x6E, 0xF6, 0xD2, 0x29, 0x66, 0x40, 0x9D,
+    0x2F, 0xB8, 0xBB, 0x11, 0xCE, 0xC9, 0x98, 0x98, 0x9D, 0xA0, 0x29, 0x13, 0x2E, 0xA7, 0xA6, 0x4C,
+    0xCE, 0x0A, 0x63, 0xEF, 0xCC, 0xEE, 0xC9, 0x44, 0xE2, 0xFA, 0xF5, 0xD9, 0xA4, 0xCA, 0x80, 0x43,
+    0x96, 0x67, 0xC8, 0x82, 0xEA, 0x75, 0x50, 0x41, 0x77, 0x3C, 0xD4, 0x6B, 0x6A, 0x45, 0x7B, 0xEB,
+    0xA8, 0x18, 0x96, 0xBA, 0x40, 0xD9, 0x94, 0xEC, 0x8D, 0x52, 0x3D, 0xBD, 0x51, 0xDD, 0x7C, 0xF8,
+    0x6D, 0x99, 0x6C, 0xB4, 0x03, 0xFB, 0xA4, 0x3E, 0xED, 0x71, 0x15, 0xA5, 0xC0, 0x58, 0x5B, 0xE1,
+    0xAC, 0xCC, 0xC2, 0x79, 0x04, 0x64, 0xEC, 0x22, 0x16, 0xF9, 0xE0, 0x05, 0xCA, 0x35, 0x24, 0xF3,
+    0x28, 0x02, 0xC1, 0x52, 0xA0, 0xA3, 0x95, 0x0A, 0x0A, 0x16, 0x66, 0xFE, 0x77, 0x10, 0x73, 0x3F,
+    0x88, 0xB9, 0xBF, 0x2D, 0xE6, 0xBE, 0xA0, 0xF9, 0x4E, 0x20, 0x30, 0xF3, 0x28, 0x08, 0x71, 0xCF,
+    0x83, 0x54, 0x66, 0x19, 0x64, 0x24, 0x54, 0x81, 0xA2, 0xE6, 0xCC, 0x14, 0xDC, 0xAC, 0xD9, 0x86,
+    0x57, 0x9A, 0xF3, 0xE4, 0x2E, 0x50, 0xF5, 0x23, 0xED, 0xC0, 0x05, 0xB6, 0x47, 0xF1, 0x60, 0x40,
+    0x79, 0xB7, 0xC7, 0x47, 0x59, 0xF7, 0xDF, 0x92, 0x70, 0x51, 0x1D, 0x53, 0x90, 0xC5, 0x92, 0xB7,
+    0x50, 0xBE, 0x06, 0x7C, 0x6B, 0x4F, 0xC0, 0xAF, 0x8F, 0x87, 0x52, 0x5B, 0xDB, 0xC0, 0xAA, 0x73,
+    0x9C, 0xF2, 0xAB, 0x30, 0x0E, 0xF9, 0xC8, 0xF4, 0x11, 0x65, 0x3E, 0x45, 0x51, 0x79, 0x5C, 0x9C,
+    0xDC, 0xA2, 0x88, 0x9F, 0xB7, 0xAC, 0x5F, 0x49, 0x53, 0xF2, 0x5D, 0xEE, 0xA7, 0x52, 0xE6, 0xAA,
+    0xA6, 0x44, 0x8B, 0x8E, 0x73, 0xD2, 0x24, 0x29, 0x6F, 0xBB, 0x1E, 0x4B, 0x81, 0x0D, 0xCE, 0x65,
+    0xEE, 0x65, 0x0C, 0xE4, 0xCD, 0x11, 0x5E, 0xEF, 0x4F, 0xF6, 0x01, 0x87, 0xFC, 0x94, 0xCC, 0x2F,
+    0x8C, 0x57, 0x1C, 0x89, 0xFA, 0x57, 0xEA, 0xF8, 0xA6, 0xC3, 0xA4, 0x64, 0xD6, 0x11, 0xF6, 0x6E,
+    0xC0, 0x22, 0xF7, 0xA6, 0x2B, 0x1C, 0xBF, 0x11, 0x94, 0x4B, 0x79, 0xDC, 0xF3, 0x1B, 0x10, 0xEA,
+    0x8D, 0x40, 0xCC, 0x05, 0xC4, 0xBC, 0x95, 0x2F, 0xD0, 0x72, 0x36, 0x9B, 0x09, 0x08, 0x6C, 0x40,
+    0xC4, 0x37, 0x01, 0xF1, 0xEA, 0x7B, 0xD0, 0x72, 0x00, 0x27, 0xFA, 0x2C, 0x58, 0x06, 0x66, 0x59,
+    0xED, 0x22, 0x7B, 0xF6, 0xFB, 0xFE, 0x94, 0x71, 0x9F, 0xFE, 0xBC, 0x3F, 0x61, 0x79, 0x1F, 0x3A,
+    0x0C, 0x73, 0x0E, 0xE1, 0xCE, 0x3A, 0x49, 0x95, 0x5D, 0xC5, 0x0F, 0xE2, 0xFF, 0xE0, 0xFA, 0x07,
+    0xC5, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0x6C, 0xE7, 0x76, 0x22, 0x8D, 0xD0, 0x5C, 0x91,
+    0x8E, 0x1F, 0x6E, 0x29, 0xC8, 0x99, 0x32, 0xCD, 0x79, 0x46, 0xA2, 0x4B, 0xB5, 0x05, 0x27, 0x4A,
+    0xF2, 0x1F, 0x5C, 0x1B, 0xA1, 0xEC, 0xAD, 0x43, 0x84, 0x28, 0xF9, 0x27, 0x28, 0xC8, 0x4A, 0x08,
+    0x8A, 0x14, 0x87, 0xB4, 0xBB, 0xB6, 0x42, 0x41, 0x41, 0x63, 0x21, 0x51, 0x33, 0x45, 0x94, 0x26,
+    0x05, 0x2E, 0x2C, 0xE4, 0xA0, 0xD9, 0x1D, 0xBE, 0xE7, 0xBD, 0xD5, 0x2D, 0x87, 0xE8, 0x10, 0x99,
+    0x3D, 0xBF, 0x93, 0x67, 0xDE, 0xCC, 0xFB, 0xDE, 0xF7, 0xDE, 0x7C, 0x06, 0x8E, 0x13, 0x20, 0x09,
+    0x79, 0x83, 0x34, 0x14, 0x34, 0x5D, 0x81, 0xC3, 0x71, 0x34, 0xE5, 0x6A, 0xDC, 0x02, 0x79, 0x8C,
+    0x0D, 0x6A, 0x67, 0xBA, 0x74, 0x40, 0xD6, 0x2B, 0xCF, 0x3D, 0xA6, 0x01, 0x42, 0xE1, 0x68, 0x2C,
+    0x3D, 0x97, 0x17, 0x62, 0xEA, 0x18, 0x63, 0x58, 0x2F, 0x16, 0x8B, 0x10, 0xF8, 0x3A, 0xD0, 0xA4,
+    0x3D, 0x4D, 0xD6, 0xAD, 0x00, 0xDD, 0xCE, 0x79, 0x4E, 0x65, 0x1D, 0xE6, 0xC8, 0xBD, 0x0A, 0x50,
+    0x31, 0x7A, 0xA0, 0xE6, 0xE9, 0x48, 0x24, 0xD8, 0x04, 0x53, 0x5C, 0x68, 0x9F, 0x0E, 0xD6, 0xA9,
+    0xEA, 0xF2, 0x10, 0xC6, 0x24, 0x3A, 0xD4, 0xB1, 0x32, 0x6D, 0xE1, 0x96, 0x28, 0x55, 0x8B, 0x50,
+    0x12, 0xEA, 0xEB, 0xB3, 0x4F, 0x7F, 0x8E, 0x71, 0x5B, 0x9C, 0x9D, 0xF5, 0x03, 0xF4, 0x8F, 0x1D,
+    0x4A, 0xDD, 0x64, 0x1D, 0x23, 0xC0, 0xC6, 0x0E, 0xC5, 0xF6, 0xEA, 0xD8, 0xC4, 0xDD, 0x21, 0x64,
+    0xEB, 0x92, 0x4D, 0xDE, 0xA2, 0xCC, 0xFC, 0x41, 0x76, 0x0E, 0x69, 0x8C, 0x2E, 0x89, 0x71, 0xC0,
+    0x12, 0x73, 0x77, 0x02, 0xD5, 0x19, 0x60, 0x93, 0x36, 0x28, 0x2A, 0x80, 0x59, 0x22, 0x19, 0xE8,
+    0x77, 0x01, 0x13, 0x63, 0xA5, 0xB6, 0xDF, 0xB5, 0x92, 0x0A, 0x27, 0x24, 0xB9, 0xD5, 0x11, 0x60,
+    0x55, 0x05, 0xFB, 0x51, 0x07, 0x5B, 0xD5, 0xA8, 0x2B, 0x3A, 0x11, 0xE6, 0x86, 0x6B, 0x24, 0x05,
+    0x77, 0x12, 0x67, 0x89, 0xE6, 0x79, 0xC8, 0xDA, 0x7B, 0xD7, 0x21, 0x93, 0xBA, 0x4D, 0xE3, 0x26,
+    0xED, 0xF3, 0xC6, 0x27, 0x3D, 0x50, 0x02, 0xA6, 0x3A, 0xFA, 0xC4, 0x6B, 0x22, 0x38, 0x9B, 0x01,
+    0x64, 0xDF, 0xFC, 0x54, 0xA9, 0x5F, 0x3A, 0xE5, 0xE7, 0xBF, 0x73, 0xB6, 0xC5, 0x2D, 0x6E, 0x4A,
+    0x17, 0xDF, 0x90, 0xBE, 0x28, 0x6C, 0x2E, 0xBE, 0xC6, 0x8D, 0x61, 0xA3, 0xAB, 0xB7, 0xC5, 0x06,
+    0xE7, 0x03, 0xF1, 0x1A, 0x12, 0x80, 0x5C, 0x40, 0x9E, 0x92, 0x79, 0x26, 0x85, 0x21, 0x21, 0x60,
+    0x62, 0x60, 0x71, 0x14, 0x0B, 0x36, 0x63, 0x7E, 0x28, 0xEF, 0xCA, 0xBE, 0x47, 0x34, 0x85, 0x64,
+    0x63, 0x5A, 0x31, 0x8D, 0x18, 0x3E, 0xC7, 0xA7, 0x34, 0x3F, 0x48, 0xDA, 0x52, 0x1D, 0xD6, 0xFC,
+    0x3A, 0xD4, 0xE2, 0xA9, 0x34, 0x02, 0xB7, 0x2C, 0x16, 0x37, 0x40, 0x9C, 0x3B, 0xD3, 0xE4, 0x01,
+    0x6B, 0x16, 0x99, 0x04, 0x97, 0xFC, 0x65, 0x1D, 0x63, 0x16, 0x60, 0x90, 0x5E, 0x57, 0x30, 0x8E,
+    0xBB, 0x86, 0x9C, 0x59, 0x3C, 0x61, 0xB0, 0xCB, 0x87, 0x24, 0xF7, 0x2B, 0x6E, 0xFB, 0x8C, 0x2F,
+    0x5A, 0x42, 0xD5, 0x57, 0x08, 0x84, 0x13, 0x42, 0xC7, 0x71, 0xEE, 0xD8, 0x1E, 0x9C, 0x98, 0x13,
+    0x43, 0xEA, 0xF7, 0x65, 0x84, 0xF6, 0x6B, 0xC1, 0xBB, 0x11, 0xDA, 0x86, 0x37, 0xC8, 0xC4, 0x03,
+    0x16, 0x3F, 0x7F, 0x3E, 0x40, 0x7A, 0x15, 0xEF, 0xA5, 0xFE, 0xEF, 0x40, 0x26, 0x3D, 0x42, 0x12,
+    0x1B, 0xED, 0xB1, 0x12, 0x26, 0x3C, 0x29, 0xB1, 0x02, 0xA3, 0x63, 0x5C, 0xE3, 0xD8, 0xD9, 0x3D,
+    0x8F, 0x37, 0x8F, 0x19, 0xF1, 0x92, 0x21, 0xF4, 0x97, 0xEC, 0xB5, 0x87, 0x7C, 0x51, 0xDF, 0x4A,
+    0x14, 0xBE, 0xE8, 0x7D, 0x8F, 0x91, 0x05, 0x10, 0x70, 0x22, 0xB4, 0xCC, 0x39, 0xA1, 0xE4, 0xAE,
+    0x9C, 0x1C, 0x44, 0x52, 0x78, 0x9F, 0xD0, 0x1D, 0x97, 0xA2, 0x5C, 0xA8, 0x50, 0x30, 0xF1, 0x96,
+    0x37, 0xF1, 0x2D, 0x3C, 0x78, 0x33, 0xC4, 0x8C, 0xE3, 0xD9, 0xBB, 0x84, 0xFE, 0xA4, 0x63, 0x8C,
+    0xB0, 0x93, 0x88, 0x82, 0x57, 0x36, 0xA9, 0x3E, 0xFC, 0x9F, 0x19, 0x72, 0xBC, 0x3B, 0xAA, 0xB3,
+    0xE2, 0xCD, 0xFE, 0x52, 0xED, 0xEC, 0x9F, 0x0D, 0xF3, 0x38, 0x86, 0x62, 0x93, 0xD4, 0x2F, 0x84,
+    0x12, 0x47, 0x10, 0x05, 0xDD, 0x88, 0x84, 0x28, 0x4A, 0xE8, 0x06, 0x33, 0xC9, 0x79, 0xC5, 0xA6,
+    0x26, 0x4D, 0xAA, 0x9F, 0x04, 0x64, 0x22, 0x15, 0xA8, 0xFF, 0x94, 0x36, 0x4D, 0x05, 0x43, 0x76,
+    0x6D, 0x84, 0x0A, 0x25, 0x3C, 0x69, 0xE1, 0xA9, 0x16, 0xD9, 0x8B, 0x6C, 0xD4, 0x23, 0xAA, 0x1A,
+    0x85, 0x00, 0x73, 0x45, 0xC6, 0xB3, 0xE6, 0x30, 0x3E, 0xAB, 0xF5, 0x7D, 0xF4, 0xBC, 0x29, 0xCC,
+    0x3F, 0x6B, 0xB3, 0x56, 0x35, 0xAA, 0xD1, 0x8D, 0xE1, 0x53, 0x54, 0xEA, 0x8F, 0xE8, 0xB2, 0xF8,
+    0x9B, 0xC3, 0xC7, 0x39, 0x46, 0x5D, 0x40, 0xF9, 0x0E, 0x1F, 0x96, 0xCB, 0x32, 0x9A, 0x25, 0x07,
+    0xB7, 0x76, 0x87, 0x50, 0xC1, 0x62, 0x3B, 0xA1, 0x91, 0xCB, 0xB3, 0x64, 0x70, 0xE2, 0xB2, 0xE0,
+    0x9D, 0x1B, 0xF0, 0x81, 0x80, 0x9A, 0x8E, 0x1C, 0x49, 0x9D, 0x77, 0x38, 0x0D, 0xB7, 0x42, 0xA8,
+    0x48, 0xFB, 0x3D, 0x56, 0xD1, 0x6F, 0x0C, 0x7B, 0xF8, 0x22, 0xE9, 0x3A, 0x72, 0xB1, 0x8E, 0xED,
+    0x7E, 0x51, 0xA8, 0xCE, 0xDA, 0xAB, 0xF2, 0x63, 0xD4, 0xB3, 0x7D, 0x26, 0xF3, 0x3E, 0x8B, 0xC1,
+    0x54, 0xEB, 0xDB, 0x22, 0x66, 0x33, 0x11, 0xCC, 0xDC, 0x53, 0x08, 0x54, 0x4F, 0xAD, 0x97, 0xCD,
+    0x16, 0xF7, 0x6C, 0xD2, 0x53, 0x91, 0xF5, 0xA6, 0x83, 0xC8, 0xC0, 0xF8, 0x97, 0x4A, 0x23, 0x92,
+    0x9B, 0x9D, 0x50, 0x8E, 0x64, 0x7C, 0x3E, 0x5E, 0x68, 0xE3, 0xA5, 0x82, 0x84, 0x6A, 0xF1, 0x2F,
+    0x83, 0xFA, 0x49, 0x66, 0x03, 0xCE, 0x5F, 0x13, 0xE2, 0x30, 0x4A, 0x86, 0x24, 0xB6, 0xDC, 0xE5,
+    0x60, 0x47, 0xBD, 0x1E, 0x7B, 0x95, 0x79, 0x4B, 0x51, 0x98, 0xE2, 0xDE, 0x67, 0xFD, 0x74, 0xE7,
+    0xC3, 0xEC, 0xC8, 0x80, 0xF9, 0xB5, 0xAE, 0x0A, 0x49, 0x3A, 0xEB, 0xE8, 0x4E, 0x3A, 0x56, 0xBB,
+    0x73, 0x72, 0x37, 0x9E, 0xA3, 0xA5, 0x61, 0x4C, 0x95, 0x75, 0xA3, 0x4F, 0x32, 0x8C, 0x3E, 0x69,
+    0xA0, 0x8F, 0x66, 0x17, 0xBC, 0x1D, 0x2B, 0xFE, 0xF3, 0x46, 0xE4, 0x70, 0x3F, 0xA6, 0xCC, 0x67,
+    0x54, 0x04, 0x7E, 0x6E, 0x44, 0xB6, 0xEE, 0xDE, 0x84, 0x7E, 0x4E, 0x0A, 0x9F, 0xC9, 0x9D, 0xE9,
+    0xA5, 0x67, 0xA5, 0xD9, 0xD3, 0x8E, 0xF0, 0x18, 0xFF, 0x0B, 0x76, 0x9F, 0x89, 0x9C, 0xCE, 0x5F,
+    0x6E, 0x54, 0x53, 0xF0, 0x3B, 0xD8, 0x9C, 0xA0, 0x34, 0xD5, 0x29, 0x4E, 0x8D, 0x2B, 0xF1, 0x28,
+    0xBF, 0x6F, 0x93, 0x21, 0x9F, 0xE5, 0xAF, 0x7C, 0x31, 0xE8, 0xE8, 0xF8, 0x25, 0x9B, 0xE2, 0x3F,
+    0x18, 0x7F, 0x01, 0xAD, 0x55, 0xCD, 0x6B, 0x24, 0x45, 0x14, 0xFF, 0xF5, 0xF4, 0xCC, 0xB4, 0x6C,
+    0xA3, 0x95, 0x43, 0x0E, 0x8A, 0x8E, 0x75, 0x16, 0xB3, 0x19, 0x0F, 0x39, 0x78, 0x98, 0xA4, 0x2B,
+    0xE6, 0x20, 0x28, 0x4A, 0x40, 0x83, 0x20, 0xC8, 0xE6, 0xE2, 0x25, 0x17, 0xF7, 0x90, 0xC3, 0x82,
+    0x93, 0x4C, 0xA3, 0xFF, 0x40, 0x6E, 0x2B, 0x78, 0x99, 0x8B, 0xAC, 0x66, 0xD1, 0x20, 0xEC, 0x21,
+    0x87, 0x7C, 0x54, 0x08, 0x22, 0xE8, 0xA5, 0x17, 0xD1, 0x4B, 0x2E, 0x8D, 0x1F, 0x20, 0xD9, 0xC3,
+    0x96, 0xDA, 0x60, 0x1B, 0x7A, 0xA6, 0xFC, 0x55, 0xF5, 0xB8, 0xAB, 0xB8, 0xE2, 0x6E, 0xF4, 0x51,
+    0xFD, 0xA6, 0xBA, 0xDF, 0x57, 0xBD, 0x37, 0xBF, 0xF7, 0x0A, 0x20, 0x35, 0xAC, 0xB5, 0x59, 0x9B,
+    0x0C, 0x41, 0x81, 0x3D, 0xC4, 0xBA, 0x61, 0x90, 0x20, 0x4E, 0x51, 0x62, 0x06, 0x51, 0x8E, 0x65,
+    0x48, 0x45, 0xB5, 0x3D, 0x3E, 0xD6, 0x96, 0x88, 0xA8, 0x0D, 0x6C, 0x38, 0xC3, 0x82, 0x2C, 0xD6,
+    0x64, 0x89, 0xF3, 0x53, 0xF2, 0x89, 0x28, 0x42, 0xD7, 0x7D, 0xB6, 0x39, 0x70, 0x68, 0x0D, 0xB7,
+    0xA1, 0xD3, 0x10, 0x4E, 0xE3, 0x0A, 0x9F, 0x6B, 0xD4, 0x08, 0xC7, 0x4E, 0x23, 0x47, 0x4D, 0x83,
+    0x22, 0xB4, 0x95, 0x48, 0x0F, 0x1E, 0xC2, 0x02, 0xFD, 0x36, 0x8E, 0x4A, 0xD0, 0xF6, 0x90, 0x71,
+    0x52, 0xF1, 0x8E, 0x4E, 0x9C, 0xF3, 0x47, 0x13, 0xB5, 0xD7, 0xB5, 0x55, 0x6C, 0xFB, 0x98, 0xEA,
+    0x01, 0x5C, 0x37, 0xF0, 0xB6, 0xC1, 0x61, 0x8A, 0xE9, 0x89, 0x0F, 0x74, 0xAD, 0xB6, 0x23, 0xC8,
+    0xB1, 0x7A, 0xAB, 0x40, 0x50, 0xFA, 0x13, 0x57, 0xCE, 0x1F, 0x36, 0xFD, 0xB9, 0x92, 0xD0, 0x45,
+    0x93, 0x2F, 0xFA, 0xA3, 0xDC, 0x76, 0x06, 0x51, 0xE5, 0x78, 0xE8, 0x52, 0x40, 0x5C, 0x7A, 0x17,
+    0xFE, 0x4B, 0x7F, 0x93, 0x2C, 0x30, 0x89, 0x4F, 0x46, 0xA6, 0x54, 0x4F, 0x05, 0xAD, 0x16, 0x5C,
+    0x25, 0xE8, 0x32, 0x34, 0x78, 0xDC, 0x2A, 0x57, 0x21, 0x9B, 0x06, 0xDE, 0x78, 0xC2, 0x5D, 0xA6,
+    0xCD, 0x3A, 0xCA, 0x8E, 0x8B, 0x22, 0xAD, 0x8F, 0xF2, 0xFD, 0xE4, 0x7C, 0x71, 0x1E, 0x54, 0x91,
+    0xC5, 0x40, 0xBF, 0x59, 0xCA, 0xF7, 0x20, 0x8E, 0x5D, 0x09, 0x77, 0x19, 0xDF, 0x69, 0x75, 0xA9,
+    0x1F, 0xF8, 0x53, 0x72, 0x13, 0x8F, 0xF8, 0xF2, 0x0B, 0xFD, 0xF4, 0xBA, 0x68, 0x5C, 0x5A, 0x2C,
+    0x90, 0xE4, 0x42, 0x87, 0x25, 0xCB, 0xDF, 0xAC, 0xAB, 0x3B, 0x3F, 0x29, 0xA9, 0xEA, 0xD3, 0xF2,
+    0x92, 0xE2, 0xDF, 0x97, 0xFD, 0xA9, 0x98, 0xE7, 0xAD, 0x44, 0x6C, 0x69, 0xE4, 0x78, 0xF5, 0x60,
+    0x95, 0x90, 0x36, 0x4D, 0xDC, 0xD2, 0xFF, 0x9E, 0x65, 0x86, 0xC0, 0xE1, 0xA7, 0x35, 0xF8, 0xFA,
+    0x6F, 0x59, 0xFE, 0xB6, 0xCA, 0x2C, 0x2D, 0xB3, 0x1C, 0xA8, 0xA6, 0xF3, 0xF3, 0xFA, 0xF6, 0x1D,
+    0x1A, 0x2E, 0xBF, 0xF6, 0x86, 0x54, 0x26, 0xF9, 0xEC, 0x83, 0x0B, 0x18, 0xFE, 0xF3, 0xF2, 0x89,
+    0x28, 0x74, 0x80, 0xB9, 0xB5, 0xEB, 0x27, 0xDB, 0xFB, 0xC3, 0xE8, 0x85, 0x20, 0x1B, 0xAE, 0x53,
+    0x30, 0xC4, 0xFD, 0xB2, 0x9A, 0x3A, 0xF4, 0x13, 0x68, 0x6C, 0x6E, 0x5F, 0x3D, 0xFD, 0xA4, 0x83,
+    0xD5, 0xF5, 0x36, 0xB2, 0x55, 0xB4, 0x81, 0xFB, 0x67, 0x58, 0xDB, 0x1E, 0xD8, 0x5B, 0xB6, 0x98,
+    0xFC, 0x1C, 0x5A, 0x72, 0xEB, 0x20, 0x8F, 0x95, 0x95, 0x95, 0x57, 0xD8, 0x68, 0xA7, 0xCC, 0x4B,
+    0xAD, 0xD4, 0x34, 0xB0, 0x9E, 0xCE, 0xEA, 0x6C, 0x3F, 0xBC, 0xF7, 0xD7, 0xE9, 0x60, 0x29, 0x5F,
+    0x58, 0x08, 0xBF, 0xFB, 0xAF, 0xEC, 0xDB, 0xAD, 0xA7, 0xE8, 0xEE, 0x1A, 0x3D, 0xFF, 0xC0, 0x20,
+    0xF0, 0x1D, 0x6D, 0x7F, 0xE5, 0x53, 0xC3, 0x67, 0x2A, 0xD2, 0xBD, 0x30, 0x97, 0xA8, 0x42, 0x23,
+    0x5D, 0xE7, 0xA1, 0x9D, 0x8E, 0x44, 0xB6, 0x27, 0xB4, 0x99, 0x8D, 0xF4, 0x10, 0x81, 0xE2, 0xDB,
+    0xBE, 0xD0, 0x45, 0x37, 0xD4, 0x84, 0x7B, 0x53, 0x9C, 0xFC, 0x5C, 0x6C, 0x88, 0xE7, 0xF2, 0x5E,
+    0x44, 0x70, 0x4C, 0x11, 0x2A, 0x4F, 0x86, 0xBA, 0x2F, 0xD2, 0x42, 0x36, 0x0C, 0x51, 0x96, 0x44,
+    0xF9, 0x20, 0x36, 0x49, 0xE4, 0x1A, 0x23, 0x50, 0x53, 0xE2, 0x66, 0x25, 0xB2, 0x51, 0x9C, 0x55,
+    0x42, 0x97, 0x62, 0xD1, 0x74, 0x43, 0x9A, 0xE9, 0xC2, 0x8F, 0x85, 0x40, 0x4D, 0xDF, 0x53, 0x6A,
+    0xBC, 0xB4, 0x09, 0x35, 0x92, 0x5F, 0x9A, 0x83, 0xEE, 0x92, 0xD9, 0x88, 0x35, 0x9D, 0xE7, 0x0B,
+    0x0C, 0x13, 0xA5, 0x57, 0x6A, 0x53, 0x87, 0x43, 0x07, 0xEC, 0x79, 0x3F, 0x63, 0x42, 0xBD, 0x64,
+    0xED, 0x4F, 0x44, 0xF1, 0xF4, 0x4C, 0xAB, 0x7E, 0xF7, 0x9D, 0xB9, 0x5B, 0xCB, 0x15, 0x22, 0x8D,
+    0xC6, 0x1D, 0x7D, 0x70, 0xB4, 0xB9, 0xD1, 0xE5, 0x3A, 0x62, 0xBE, 0x6E, 0xAA, 0x5E, 0x53, 0x58,
+    0x7B, 0x44, 0xFB, 0x96, 0x58, 0x54, 0xA0, 0xA6, 0x84, 0x0F, 0xE0, 0xB4, 0x32, 0x0E, 0x9F, 0x16,
+    0xC5, 0x39, 0x5B, 0xA5, 0x19, 0x2B, 0x85, 0xC2, 0xBB, 0x74, 0xFE, 0x39, 0xF1, 0x82, 0x65, 0x3F,
+    0xCB, 0xDE, 0xB5, 0xB2, 0x1A, 0x18, 0xAB, 0x96, 0xB1, 0x0E, 0x51, 0xC0, 0x16, 0xC2, 0x16, 0xD6,
+    0xDE, 0xB6, 0x63, 0x3B, 0x16, 0x63, 0x8C, 0x1D, 0x40, 0x5A, 0x61, 0x95, 0x1C, 0x97, 0x2D, 0x62,
+    0x8E, 0x73, 0xED, 0x60, 0xA0, 0xC6, 0x9B, 0xA8, 0xA6, 0x31, 0x45, 0xC9, 0x16, 0x1E, 0x4B, 0x52,
+    0x86, 0x1B, 0x24, 0x2A, 0x36, 0xB0, 0x89, 0xEB, 0xB4, 0x51, 0x13, 0x01, 0xAB, 0x2B, 0x97, 0xAA,
+    0xE4, 0xA8, 0xB8, 0x0B, 0xF2, 0xD5, 0xA7, 0x4F, 0x1A, 0xFF, 0x03, 0xC8, 0xD3, 0xAB, 0x3F, 0x3E,
+    0x72, 0x4E, 0x90, 0xF3, 0xB4, 0x5D, 0x15, 0x7D, 0x1C, 0x7C, 0x31, 0xF7, 0xCC, 0x50, 0x3F, 0xD0,
+    0x11, 0xFE, 0x60, 0x9E, 0x82, 0xAF, 0x14, 0xD6, 0x73, 0x74, 0x9E, 0x5D, 0xDB, 0x79, 0xF9, 0x74,
+    0xE7, 0xA5, 0xAC, 0x33, 0x97, 0x5D, 0xCE, 0x6E, 0x1E, 0x2B, 0x8E, 0x8E, 0x73, 0xAC, 0x89, 0xCF,
+    0xCF, 0x55, 0xDC, 0xC1, 0xCC, 0x3A, 0x3E, 0x3D, 0xFB, 0xE8, 0xF2, 0xD9, 0xF5, 0x27, 0xE6, 0xA2,
+    0xE8, 0xE1, 0x28, 0x38, 0x7E, 0x9E, 0xD5, 0x3B, 0xD7, 0xFA, 0x2B, 0xB5, 0x7D, 0x08, 0xAB, 0xDC,
+    0x9F, 0x4F, 0xF1, 0xAD, 0xCC, 0x4F, 0x57, 0x10, 0x98, 0xFE, 0x8E, 0xC4, 0x7C, 0x60, 0xFC, 0x6D,
+    0x80, 0x3E, 0x4C, 0xE8, 0xCF, 0x74, 0x23, 0x30, 0xBC, 0x4E, 0x49, 0x45, 0xC0, 0xEE, 0x72, 0x44,
+    0x41, 0xCF, 0x6F, 0x0A, 0x36, 0x41, 0x3B, 0xC7, 0x85, 0xAD, 0x5D, 0x36, 0x52, 0x52, 0xE1, 0xB0,
+    0xDC, 0xDC, 0x8F, 0x74, 0x39, 0xDB, 0x30, 0x7D, 0x59, 0x88, 0x46, 0x2E, 0x43, 0x4D, 0x68, 0x5E,
+    0x0C, 0xB5, 0x88, 0xD3, 0x59, 0x02, 0x39, 0x4E, 0x85, 0xC0, 0x45, 0x82, 0x4E, 0x28, 0x29, 0x89,
+    0xDA, 0x30, 0x13, 0x6A, 0x56, 0xF2, 0x4A, 0xA4, 0x40, 0xF5, 0x24, 0x91, 0xDE, 0xE5, 0x76, 0x57,
+    0x12, 0xBB, 0x7D, 0x44, 0xDF, 0x18, 0xF1, 0x7E, 0x46, 0xB4, 0x37, 0x6C, 0x1A, 0x59, 0x8F, 0x67,
+    0x5E, 0x98, 0xAF, 0xDE, 0x4D, 0xE5, 0x77, 0xD5, 0x54, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66,
+    0xD6, 0xF6, 0x46, 0x1E, 0xF0, 0xB8, 0x40, 0x82, 0x28, 0x8A, 0x97, 0x12, 0xA2, 0xC4, 0xDB, 0x50,
+    0xA4, 0xB8, 0xBB, 0xDD, 0x38, 0x45, 0x0A, 0x1A, 0x17, 0x98, 0x14, 0x29, 0xD2, 0xA4, 0x40, 0x41,
+    0x02, 0x8A, 0x14, 0x2E, 0xCE, 0xB9, 0x0D, 0x08, 0xD1, 0x21, 0x17, 0x04, 0x0A, 0x0A, 0x22, 0x61,
+    0x09, 0xC9, 0x14, 0x4E, 0x61, 0xA4, 0x43, 0xBA, 0xC3, 0x13, 0xB7, 0x14, 0x2C, 0x55, 0x0A, 0x9A,
+    0x91, 0x50, 0x44, 0x10, 0x05, 0x23, 0xB4, 0x88, 0x4D, 0xB4, 0x77, 0xC3, 0x37, 0x7B, 0x3E, 0x02,
+    0x3F, 0x81, 0x79, 0x37, 0x73, 0x9A, 0xDD, 0xB7, 0xF3, 0xDE, 0xFB, 0xBE, 0xEF, 0x0D, 0x70, 0x31,
+    0xB6, 0x63, 0x7D, 0x5C, 0xF5, 0x62, 0x53, 0x09, 0x70, 0x44, 0xC5, 0x6B, 0xB1, 0x1D, 0xA9, 0xB2,
+    0xD1, 0xC7, 0x75, 0x7A, 0xD9, 0xF5, 0xE2, 0xB2, 0xAF, 0x8B, 0x4A, 0x63, 0x75, 0x01, 0xED, 0xB0,
+    0xCF, 0x4B, 0x73, 0x5B, 0x99, 0x86, 0xEF, 0x6E, 0xD3, 0x25, 0xA3, 0x67, 0xF2, 0x81, 0xDD, 0x51,
+    0x0F, 0x5C, 0x2F, 0x2A, 0x2B, 0x2D, 0xEC, 0x82, 0xC0, 0xCB, 0x40, 0x9C, 0x37, 0xBA, 0x1C, 0x44,
+    0x4E, 0x17, 0x7D, 0x59, 0x9E, 0xE2, 0x77, 0xB7, 0xA4, 0x69, 0x94, 0x99, 0xC4, 0x96, 0x0F, 0x33,
+    0x51, 0xEB, 0xA2, 0x89, 0x4D, 0x57, 0x96, 0x6B, 0x28, 0xDA, 0x83, 0x45, 0xA9, 0x70, 0x5F, 0x9B,
+    0x51, 0x6C, 0xB3, 0x4B, 0xB5, 0x36, 0x74, 0x4A, 0xF3, 0x86, 0x1B, 0x70, 0xB3, 0x23, 0x9C, 0xCE,
+    0xEB, 0xE0, 0xEB, 0x24, 0x56, 0x45, 0x8E, 0x97, 0x80, 0xA4, 0x40, 0x32, 0x44, 0xA2, 0x8A, 0x04,
+    0x43, 0x9D, 0xAB, 0x82, 0xCF, 0x46, 0x8C, 0x66, 0x06, 0x98, 0xD0, 0x32, 0xE8, 0x22, 0x32, 0xD8,
+    0x95, 0x80, 0x43, 0x82, 0xC8, 0x61, 0x00, 0x6D, 0x74, 0xA9, 0x4B, 0x65, 0x94, 0x91, 0x39, 0x56,
+    0x19, 0xF2, 0x4A, 0x0E, 0xAC, 0x5D, 0x80, 0x8B, 0x8B, 0xC3, 0x24, 0xB7, 0xD2, 0xDC, 0xBB, 0x08,
+    0x05, 0x0D, 0x74, 0xF8, 0x25, 0x9C, 0xC3, 0x72, 0xD4, 0x2C, 0x33, 0x51, 0x51, 0xE9, 0x8D, 0x9A,
+    0x8F, 0xBF, 0xB1, 0xC0, 0x85, 0xB8, 0x60, 0x65, 0x67, 0x21, 0xEC, 0xE6, 0x2D, 0x6C, 0x27, 0x1B,
+    0xE5, 0x8A, 0xA8, 0xD4, 0xE5, 0x62, 0x11, 0xE7, 0xDF, 0xE3, 0x81, 0xBB, 0x2D, 0x40, 0x8B, 0xB4,
+    0x1E, 0x6D, 0x4C, 0x6B, 0x68, 0xB5, 0xA8, 0x45, 0x25, 0x5D, 0xB0, 0xC8, 0xD2, 0x4A, 0x9A, 0x89,
+    0x4C, 0x1C, 0xAC, 0x50, 0x85, 0xCA, 0x69, 0x0C, 0x3B, 0xB3, 0x15, 0x9C, 0xC2, 0x29, 0xCC, 0x47,
+    0x4A, 0xCB, 0xF2, 0x8C, 0xE5, 0xDC, 0xC6, 0x0B, 0xB4, 0xFD, 0xFD, 0xFD, 0xAF, 0xBC, 0xF7, 0x8F,
+    0xB6, 0xB6, 0xB6, 0x70, 0xF3, 0x4B, 0xFF, 0x93, 0xCF, 0xE7, 0x9E, 0xCF, 0x05, 0xE6, 0x98, 0x20,
+    0x46, 0x9C, 0x49, 0xD8, 0x94, 0x5C, 0x86, 0xF3, 0x0D, 0x0B, 0xC2, 0x21, 0xE7, 0xDA, 0x7C, 0xE3,
+    0x38, 0xD7, 0x39, 0xE3, 0xF9, 0xA6, 0xCB, 0x49, 0x14, 0x21, 0xE6, 0x1B, 0xCD, 0x8D, 0x0C, 0x9B,
+    0xF3, 0xF3, 0x18, 0x72, 0x0F, 0x4B, 0xF7, 0x22, 0x6F, 0x94, 0x7F, 0xDF, 0x37, 0x91, 0xAF, 0x6E,
+    0xA4, 0xB9, 0x1D, 0x84, 0x40, 0x3C, 0xA4, 0x0A, 0x1F, 0x76, 0x42, 0x44, 0x7E, 0xDB, 0x67, 0xF5,
+    0xB3, 0x65, 0xCC, 0xC4, 0x99, 0x52, 0x2F, 0x2C, 0x0C, 0xD7, 0x81, 0x7E, 0x8C, 0x64, 0x4F, 0x4E,
+    0x11, 0x35, 0x78, 0x15, 0x78, 0x0B, 0xCF, 0x06, 0x39, 0x8A, 0x4B, 0xD1, 0x20, 0xAA, 0xC3, 0x37,
+    0x0D, 0x41, 0xC4, 0x89, 0xE2, 0x36, 0x97, 0x77, 0xA1, 0x8C, 0x77, 0xC8, 0x94, 0x77, 0xB2, 0x3A,
+    0xAD, 0x4A, 0x6D, 0xA0, 0x09, 0x0B, 0x63, 0x55, 0xCC, 0x3E, 0x0E, 0xBB, 0x14, 0xA8, 0x19, 0x9D,
+    0xB4, 0x97, 0xA2, 0x0E, 0x50, 0x16, 0x8C, 0xC6, 0xFA, 0x6D, 0xF4, 0x94, 0x8C, 0xA9, 0x1A, 0x67,
+    0xB1, 0x9C, 0x63, 0xF3, 0x59, 0x3C, 0x9E, 0xD1, 0xA3, 0x2A, 0x24, 0xE9, 0x81, 0x2A, 0x29, 0xAA,
+    0x85, 0x96, 0x3B, 0x8E, 0x1E, 0xCE, 0xE5, 0x18, 0x0B, 0x06, 0x6C, 0xA4, 0xAF, 0x51, 0xCB, 0xDD,
+    0x91, 0x60, 0x9C, 0x4E, 0x40, 0xA3, 0x13, 0x40, 0xEE, 0xB3, 0x66, 0x51, 0x11, 0xC7, 0xB8, 0x64,
+    0xEC, 0x24, 0xA7, 0x28, 0x76, 0xA0, 0x72, 0x3A, 0xA9, 0x00, 0x87, 0x46, 0xF4, 0x6B, 0x58, 0x26,
+    0x81, 0xC9, 0xBD, 0x7F, 0x95, 0x98, 0x06, 0x8A, 0xB2, 0x5C, 0xB1, 0x12, 0x86, 0x24, 0x9F, 0xA1,
+    0xE1, 0xDE, 0x20, 0xB0, 0xDE, 0x46, 0xC7, 0x4F, 0xFD, 0x67, 0xD6, 0x2D, 0x79, 0xBB, 0x8A, 0xA5,
+    0x39, 0xAB, 0x2B, 0x28, 0xCF, 0x47, 0x45, 0x68, 0xB6, 0x64, 0xA3, 0xCA, 0x62, 0x3B, 0x09, 0xFD,
+    0x16, 0xB9, 0xB1, 0x7E, 0xC0, 0xCE, 0x64, 0xCB, 0x99, 0x3A, 0x89, 0x6C, 0x57, 0x99, 0xD0, 0x75,
+    0x5D, 0xE4, 0xAB, 0x32, 0xC8, 0x3A, 0x2D, 0x94, 0x37, 0xE3, 0xF4, 0x72, 0xD9, 0x5B, 0xC7, 0xB0,
+    0x8A, 0x7E, 0x31, 0xFA, 0x1D, 0x74, 0x86, 0xE2, 0x0F, 0xAB, 0x5F, 0x37, 0xA3, 0xE4, 0x73, 0x93,
+    0x36, 0x38, 0x1D, 0x02, 0xBC, 0x12, 0x40, 0x26, 0x0D, 0x7A, 0x88, 0xCE, 0x21, 0xE5, 0x1E, 0x95,
+    0x4E, 0x5F, 0x72, 0xD9, 0xD7, 0x4F, 0x32, 0x3F, 0x09, 0x1A, 0x09, 0xE5, 0x15, 0x21, 0x8B, 0x9B,
+    0x7B, 0x91, 0xB7, 0xC9, 0x3E, 0xF5, 0xC3, 0xDA, 0x92, 0x1A, 0x4B, 0x75, 0xE0, 0x9A, 0xAF, 0x13,
+    0x82, 0xB0, 0x78, 0x54, 0x1C, 0x55, 0xA1, 0x06, 0x08, 0x76, 0xE3, 0x13, 0x4C, 0x03, 0x8F, 0x8A,
+    0x84, 0x4C, 0x91, 0x1E, 0x94, 0x5D, 0xE9, 0x3A, 0x22, 0xFC, 0xBA, 0x51, 0x99, 0x5E, 0x37, 0x6A,
+    0x0A, 0xB1, 0x89, 0x73, 0xFB, 0x57, 0xFC, 0xE4, 0xDB, 0x6B, 0x3F, 0xC0, 0x6D, 0x76, 0x29, 0x39,
+    0x9E, 0x75, 0xF2, 0xD7, 0x0B, 0x42, 0xDA, 0x6E, 0x41, 0x49, 0x8B, 0xF8, 0x77, 0xD3, 0xD7, 0x1B,
+    0x65, 0x57, 0xDD, 0x71, 0xFA, 0x00, 0xA9, 0x8B, 0x1E, 0xDA, 0x6E, 0xFC, 0xC0, 0xE9, 0x2B, 0xA6,
+    0xA3, 0x3F, 0xB2, 0xE9, 0x14, 0x8B, 0x2C, 0x22, 0xD9, 0x85, 0xAF, 0x23, 0xDB, 0xE7, 0x4D, 0x12,
+    0x17, 0x17, 0x14, 0xD7, 0xB2, 0x2F, 0x3D, 0x0B, 0xAC, 0x02, 0xD2, 0x89, 0x11, 0x53, 0x64, 0xD5,
+    0x8C, 0x54, 0x31, 0x49, 0xEF, 0xFC, 0x35, 0x8D, 0x1E, 0x6F, 0xEB, 0x63, 0x5E, 0x68, 0xD2, 0x76,
+    0xF4, 0x25, 0xDB, 0x51, 0x87, 0x2E, 0xBB, 0x83, 0x1B, 0xAD, 0xB8, 0x7D, 0x9E, 0x1D, 0x11, 0xCD,
+    0x04, 0x75, 0x25, 0x7F, 0x36, 0xFA, 0x0B, 0x74, 0x03, 0x68, 0xEA, 0xFB, 0xA2, 0x4B, 0x90, 0xB3,
+    0x29, 0x06, 0xE5, 0x09, 0x2B, 0xDF, 0xE9, 0xC9, 0xE2, 0x88, 0xF2, 0x1E, 0x52, 0x7C, 0x15, 0x9C,
+    0x70, 0x92, 0x3D, 0x9D, 0x36, 0x83, 0x7A, 0x76, 0xCA, 0x20, 0x9C, 0xB2, 0xC2, 0x37, 0x2C, 0xA6,
+    0x4B, 0x85, 0x04, 0x69, 0x18, 0x6A, 0x93, 0x82, 0xF4, 0xFE, 0x47, 0x3F, 0x6D, 0xB5, 0xD7, 0xC4,
+    0xBF, 0xD9, 0xFB, 0xEB, 0x90, 0x96, 0xE7, 0x0C, 0x98, 0xA3, 0xA0, 0x4B, 0x9F, 0x7E, 0xB2, 0x7A,
+    0x7B, 0x12, 0x4F, 0xFF, 0x11, 0x4C, 0x1F, 0xB2, 0x41, 0x5C, 0x63, 0x6D, 0x88, 0xED, 0x4A, 0x38,
+    0x2A, 0xDD, 0x25, 0xC2, 0x92, 0xA0, 0x94, 0x45, 0x06, 0x82, 0xF8, 0xCB, 0x03, 0x04, 0xBE, 0x5C,
+    0x0F, 0x6D, 0xCC, 0xDE, 0x51, 0x93, 0xC0, 0x2B, 0x5A, 0x82, 0x52, 0x36, 0xF0, 0x19, 0xFF, 0x2C,
+    0x73, 0xC4, 0xBC, 0x19, 0x77, 0xA9, 0xF7, 0x20, 0xD2, 0x4F, 0x90, 0xF8, 0x62, 0xFD, 0xAA, 0x9D,
+    0x11, 0xD4, 0x91, 0x96, 0xD7, 0x37, 0x9F, 0xD0, 0x85, 0x23, 0xF3, 0x0F, 0xFD, 0xE4, 0xBE, 0xFA,
+    0xB8, 0x6D, 0x6A, 0x9D, 0xB7, 0x79, 0xF2, 0x2F, 0x50, 0xC5, 0x98, 0xB7, 0xE6, 0x17, 0x82, 0xCF,
+    0x7B, 0xEF, 0x4A, 0x2A, 0x30, 0x77, 0xBC, 0x88, 0xD3, 0x0A, 0xDE, 0x24, 0xDA, 0x90, 0x23, 0x62,
+    0x26, 0x5C, 0x76, 0x90, 0xA7, 0xB6, 0xF5, 0x23, 0xA3, 0x03, 0x27, 0x9E, 0x36, 0x51, 0xD9, 0x21,
+    0x53, 0xAA, 0xE8, 0x72, 0x8D, 0x9E, 0x8C, 0x98, 0x78, 0x50, 0x12, 0x21, 0x4A, 0xF3, 0x33, 0x13,
+    0xA4, 0xB3, 0x34, 0x33, 0xEF, 0xCB, 0xD8, 0x53, 0x83, 0xF1, 0xA3, 0xAB, 0x01, 0xBC, 0x0E, 0x61,
+    0x61, 0x2D, 0x0D, 0xB5, 0x1D, 0xAE, 0x24, 0x04, 0x98, 0x93, 0xBB, 0x37, 0x18, 0xDC, 0x17, 0xC8,
+    0xF6, 0xEF, 0xCD, 0xAE, 0xBD, 0x1D, 0xCE, 0x6B, 0x8F, 0x72, 0x68, 0x5F, 0xB5, 0xAD, 0x7D, 0xE2,
+    0x17, 0x34, 0x42, 0xB7, 0x98, 0x70, 0xCD, 0xC7, 0x92, 0xE7, 0x72, 0xC4, 0x45, 0x95, 0xE3, 0x80,
+    0x70, 0x90, 0x4A, 0x2B, 0xE6, 0x85, 0x16, 0xB8, 0xF6, 0x38, 0x79, 0xC0, 0x73, 0xB5, 0xF7, 0x26,
+    0xA8, 0x19, 0xE2, 0xFA, 0x87, 0x9B, 0xB3, 0xDD, 0x8B, 0x7F, 0x6E, 0xCD, 0x2E, 0xC6, 0x36, 0x5E,
+    0xB8, 0x0F, 0xE4, 0xC1, 0xDD, 0x37, 0x0F, 0xF9, 0xCE, 0x9B, 0xEC, 0xD3, 0xA3, 0xE9, 0x7F, 0xBA,
+    0xFD, 0x7F, 0x31, 0xFE, 0x06, 0x8D, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0xC7, 0x78,
+    0x25, 0x56, 0x62, 0x02, 0x82, 0x0A, 0xE2, 0x6D, 0xA8, 0x90, 0x7C, 0xDB, 0xB8, 0xA0, 0x38, 0xDF,
+    0x6E, 0x1C, 0x24, 0x0A, 0x8A, 0xB8, 0xF0, 0x41, 0x85, 0xC8, 0x3F, 0x80, 0x42, 0x11, 0x01, 0xC5,
+    0x5D, 0xBC, 0xA6, 0x49, 0x71, 0x8D, 0x0B, 0x3A, 0x14, 0xFE, 0x80, 0x6B, 0xD2, 0xB8, 0x70, 0x71,
+    0xF1, 0xAD, 0x89, 0x50, 0x4A, 0x96, 0x50, 0xA4, 0x64, 0x31, 0x48, 0x2E, 0x28, 0x58, 0xD0, 0x9A,
+    0x6C, 0xC2, 0xDE, 0x0D, 0xDF, 0x9B, 0xBD, 0xBD, 0xD8, 0x49, 0x93, 0x91, 0xE7, 0x3C, 0xF3, 0x66,
+    0xE6, 0x7B, 0x3F, 0xBE, 0xF7, 0xDE, 0x02, 0xED, 0x98, 0x9A, 0x7D, 0xFB, 0x5F, 0x1B, 0x53, 0xD8,
+    0xC5, 0x1B, 0x85, 0x9F, 0x37, 0x92, 0x54, 0xA7, 0x76, 0x11, 0x21, 0x6C, 0xEE, 0x56, 0x98, 0x28,
+    0x11, 0x79, 0x99, 0x5B, 0xAC, 0x89, 0x20, 0x84, 0x4E, 0x0E, 0xE0, 0x6C, 0xA3, 0xC6, 0x24, 0x34,
+    0xE9, 0x34, 0x57, 0x79, 0xF0, 0xD0, 0xCC, 0xFC, 0xEF, 0x12, 0xFD, 0x57, 0x8D, 0x01, 0xBA, 0xC0,
+    0xEE, 0x3C, 0x76, 0x73, 0xA7, 0x80, 0x5B, 0x12, 0x31, 0x56, 0x05, 0x04, 0xB4, 0x0B, 0xAF, 0x44,
+    0x0F, 0xA0, 0x5C, 0x95, 0x0E, 0x4F, 0xBC, 0x14, 0xAA, 0xF0, 0x79, 0xD2, 0x71, 0x2F, 0x79, 0xA9,
+    0xA8, 0xAB, 0x06, 0xC5, 0x9A, 0x6F, 0x32, 0x28, 0x73, 0xFF, 0x69, 0x31, 0x35, 0x09, 0xBC, 0xCA,
+    0x9B, 0xE3, 0xF9, 0xE1, 0x4C, 0x2B, 0x20, 0x30, 0x3C, 0x30, 0xDB, 0x43, 0x62, 0x11, 0x99, 0xF8,
+    0xEF, 0x23, 0x88, 0x71, 0x49, 0x14, 0x00, 0xC3, 0xFE, 0x0E, 0x7C, 0xF1, 0xED, 0x95, 0x59, 0x7F,
+    0x5B, 0x5C, 0xA0, 0xD5, 0xC6, 0xA4, 0x78, 0x6F, 0x3E, 0x4E, 0x9A, 0x2D, 0x8D, 0xE7, 0x98, 0xC9,
+    0xCF, 0x2E, 0xF8, 0x2C, 0xFC, 0x63, 0x35, 0x97, 0x70, 0xA4, 0x70, 0x04, 0x18, 0x0E, 0x44, 0x0A,
+    0x6C, 0x72, 0xF6, 0x16, 0xB3, 0xD3, 0xC0, 0x98, 0x3F, 0x39, 0xAB, 0x43, 0x6E, 0x7C, 0x82, 0x41,
+    0x16, 0x3A, 0xE6, 0x4F, 0xDC, 0x58, 0x47, 0xA1, 0x5F, 0x51, 0x7B, 0xE2, 0xDF, 0x39, 0xF4, 0x6F,
+    0x5F, 0xDB, 0x3B, 0xCE, 0x32, 0xDC, 0x04, 0x2E, 0xD3, 0xDF, 0x18, 0x4E, 0x06, 0x1C, 0x00, 0xEB,
+    0xF6, 0x9A, 0x9B, 0xDB, 0xD7, 0x9D, 0xE5, 0x06, 0x0B, 0xC5, 0x4E, 0x61, 0xC3, 0x0C, 0xB8, 0xB2,
+    0xE8, 0x2C, 0x75, 0x2E, 0xB4, 0xB5, 0x73, 0xC0, 0xB9, 0xD2, 0xEA, 0x7C, 0x01, 0xAC, 0x51, 0xB3,
+    0xD0, 0x69, 0x0D, 0xF0, 0xBD, 0xAB, 0x5B, 0x7F, 0xFF, 0x92, 0x87, 0x5F, 0xE5, 0xAE, 0xC9, 0x11,
+    0xE6, 0x4B, 0x9D, 0x1C, 0x2A, 0xD5, 0x40, 0x49, 0xC8, 0x4D, 0x6A, 0xA7, 0x3B, 0xDE, 0x7D, 0x2A,
+    0x34, 0x11, 0x67, 0x41, 0xA6, 0x06, 0x2A, 0x43, 0x40, 0x2F, 0x49, 0x56, 0x17, 0x4D, 0xC6, 0x88,
+    0x66, 0x46, 0x5D, 0xD7, 0x8C, 0x5A, 0xAA, 0x3F, 0x1D, 0xE8, 0xDB, 0x1F, 0xA5, 0x7B, 0x59, 0x72,
+    0xD1, 0x55, 0xBB, 0x59, 0xF5, 0xB6, 0xAE, 0xFE, 0xF6, 0xB0, 0xE8, 0x7D, 0x59, 0x28, 0x32, 0x12,
+    0x91, 0xFD, 0xC2, 0xC6, 0x76, 0xC5, 0x9A, 0xBA, 0x00, 0xB8, 0x33, 0x21, 0xC0, 0xF1, 0x5E, 0xB6,
+    0x7F, 0x01, 0xE0, 0xFA, 0xCD, 0x77, 0x7B, 0x97, 0x43, 0x75, 0x7A, 0x03, 0xE1, 0x1C, 0xEE, 0x5C,
+    0xDC, 0x0B, 0x8C, 0x79, 0x64, 0x4C, 0xD9, 0xDA, 0xCD, 0x1C, 0x92, 0x68, 0x31, 0x14, 0x5A, 0x9C,
+    0x80, 0x58, 0xD7, 0xC5, 0x86, 0x46, 0x4F, 0xA5, 0x1D, 0x14, 0x1D, 0x74, 0xC3, 0xFE, 0x67, 0xE4,
+    0xF5, 0x87, 0xB3, 0xFE, 0x76, 0xD8, 0x04, 0x54, 0xFE, 0x2D, 0xB8, 0x12, 0xE2, 0x96, 0x8F, 0xCE,
+    0x23, 0xF8, 0xD0, 0x2A, 0xB7, 0x08, 0x6E, 0xBE, 0xD9, 0xBF, 0x45, 0x80, 0xE3, 0xFE, 0x27, 0x39,
+    0x54, 0xFB, 0x87, 0xEB, 0x0B, 0x80, 0x57, 0xAD, 0x0D, 0x0E, 0x8D, 0xA0, 0x19, 0x03, 0x66, 0x75,
+    0xC0, 0x28, 0xAA, 0x94, 0xF6, 0x15, 0x8C, 0x5D, 0x1D, 0x8D, 0xC7, 0x63, 0xB9, 0x6E, 0xF3, 0xC7,
+    0x2E, 0xBA, 0xE7, 0x33, 0xF9, 0x35, 0x31, 0x21, 0x69, 0x26, 0xF3, 0xD5, 0x8C, 0x84, 0x69, 0xAE,
+    0x2D, 0x31, 0x42, 0xFB, 0x37, 0x9C, 0xB9, 0xE4, 0x9D, 0x95, 0x6C, 0xB4, 0xEF, 0x56, 0x96, 0x69,
+    0x36, 0x4A, 0xF4, 0x49, 0xAD, 0xAB, 0xE9, 0x83, 0xEF, 0xD7, 0x0F, 0x3E, 0x1C, 0x7D, 0xE0, 0x9C,
+    0x64, 0xF8, 0xFA, 0x00, 0x9D, 0x75, 0x9E, 0xC4, 0xEE, 0x49, 0x8E, 0xC3, 0x43, 0x74, 0x3A, 0x72,
+    0x4D, 0x36, 0xCB, 0xE1, 0x4A, 0x41, 0x4F, 0x6C, 0xE2, 0x4C, 0x99, 0x57, 0xA2, 0xA9, 0x4D, 0xE5,
+    0x0E, 0x05, 0x73, 0x0A, 0xE6, 0x8B, 0x84, 0x97, 0xE9, 0x2D, 0x9E, 0xC5, 0xF1, 0x45, 0x3C, 0xD9,
+    0xAC, 0xC3, 0x1B, 0xC5, 0x8D, 0x5A, 0x67, 0x6D, 0xFD, 0xF5, 0xD3, 0xD1, 0xE7, 0xE1, 0xC9, 0xDC,
+    0xAD, 0x8E, 0xE4, 0x5A, 0xC3, 0xD8, 0xB3, 0xF1, 0x85, 0x62, 0x62, 0x65, 0x2C, 0xD3, 0x81, 0x74,
+    0x05, 0x2A, 0x85, 0x24, 0x98, 0xC4, 0x5C, 0x4B, 0x05, 0x0D, 0x18, 0x66, 0xA6, 0x02, 0xC3, 0x46,
+    0x2A, 0x48, 0xAC, 0x8E, 0x49, 0xEB, 0x3B, 0xC8, 0xCE, 0xD9, 0xCD, 0x12, 0x50, 0xA7, 0xC2, 0xE1,
+    0x35, 0x4A, 0xEB, 0x90, 0x0D, 0x22, 0x8B, 0x84, 0xD1, 0x7B, 0xAC, 0x6A, 0x67, 0x3E, 0xBE, 0x9B,
+    0x5A, 0x54, 0xFF, 0xEC, 0xE3, 0x92, 0xC9, 0xC9, 0x6C, 0x8D, 0x62, 0x06, 0xFE, 0x96, 0x64, 0x48,
+    0xCD, 0x18, 0xBB, 0x25, 0xCB, 0x59, 0xFD, 0xC3, 0x9D, 0xFE, 0x89, 0xFA, 0x02, 0xE9, 0x01, 0x91,
+    0x84, 0x65, 0x2A, 0x45, 0x57, 0x2E, 0xAA, 0x0F, 0x4E, 0x4C, 0x32, 0x52, 0xF5, 0xD4, 0x60, 0xC3,
+    0xA1, 0x42, 0xE9, 0x50, 0xC3, 0x86, 0xBD, 0x1E, 0xFC, 0xD3, 0x82, 0x44, 0xA9, 0x32, 0x28, 0x26,
+    0xE8, 0x05, 0xB1, 0xFA, 0xBD, 0xC0, 0xE6, 0x26, 0xBC, 0x07, 0x29, 0x26, 0x13, 0xE8, 0x51, 0xEA,
+    0x88, 0xDC, 0xCF, 0xBC, 0x74, 0xD7, 0x29, 0x95, 0x99, 0xC1, 0x5F, 0xB6, 0xAF, 0xD0, 0x16, 0x71,
+    0xBD, 0xC3, 0xCE, 0x2A, 0x85, 0x23, 0x45, 0x50, 0xC3, 0x6E, 0x7E, 0xDC, 0xF1, 0x1E, 0x1B, 0x33,
+    0x13, 0xCB, 0x9F, 0x3B, 0xE1, 0xE6, 0xAC, 0x7F, 0xC5, 0x34, 0xA3, 0xCD, 0x59, 0xBC, 0x15, 0x33,
+    0x8E, 0xA1, 0x29, 0x23, 0x78, 0xC6, 0xFC, 0x57, 0x60, 0xBA, 0xEF, 0x19, 0x78, 0xAC, 0xAB, 0x4A,
+    0x1E, 0x85, 0x25, 0x8D, 0x76, 0x1F, 0xE7, 0x7C, 0x1C, 0xEA, 0xB4, 0x47, 0xA7, 0x43, 0x0A, 0x82,
+    0x78, 0xE8, 0x65, 0x0E, 0xDB, 0x6E, 0x10, 0x07, 0xB1, 0x97, 0x0D, 0xE9, 0x6D, 0x78, 0xA5, 0x22,
+    0x15, 0x13, 0x55, 0x54, 0xD2, 0x86, 0x7F, 0x4D, 0x10, 0xC6, 0x41, 0x25, 0xAA, 0xC3, 0x14, 0x41,
+    0x06, 0x93, 0xAD, 0xCE, 0xA1, 0xEF, 0x1A, 0xB6, 0xE3, 0x3A, 0x60, 0xEF, 0x71, 0x52, 0x67, 0xE7,
+    0x19, 0x13, 0xD2, 0x77, 0x24, 0x38, 0xD0, 0xD2, 0x0E, 0x76, 0x19, 0x22, 0x25, 0x29, 0xA4, 0x23,
+    0x49, 0x23, 0xB2, 0xA1, 0x7E, 0x96, 0x1E, 0x2D, 0xAE, 0x54, 0x7E, 0x46, 0x32, 0x03, 0x5A, 0x23,
+    0xD6, 0x95, 0x38, 0x92, 0x80, 0xD6, 0x0C, 0xA5, 0x92, 0x92, 0xF1, 0xC5, 0x4E, 0x9D, 0x92, 0x97,
+    0x68, 0x8B, 0x04, 0x1C, 0x69, 0x5B, 0x35, 0xA6, 0xFD, 0x2E, 0x89, 0xDF, 0xB6, 0x13, 0xE9, 0x8B,
+    0x7C, 0xCF, 0x84, 0xEF, 0x9A, 0xB8, 0xD4, 0x10, 0x11, 0x04, 0x2F, 0xF2, 0xED, 0xBF, 0x34, 0xDF,
+    0x76, 0xBC, 0xCD, 0x42, 0xF3, 0xA4, 0x0E, 0xA6, 0xDF, 0x42, 0x82, 0x69, 0x09, 0x68, 0x1A, 0xB0,
+    0xFD, 0x22, 0x0E, 0xDB, 0x27, 0x52, 0xA7, 0xE6, 0x06, 0xE7, 0x6C, 0xD8, 0xC6, 0x40, 0xDC, 0x84,
+    0x9F, 0xB5, 0x57, 0x03, 0x59, 0x05, 0x4F, 0xFA, 0x7D, 0x69, 0x56, 0x73, 0xAC, 0x36, 0x9D, 0xDB,
+    0x8E, 0x6E, 0x83, 0xE9, 0x4C, 0x29, 0xDF, 0xA5, 0xDC, 0x7F, 0xB2, 0x55, 0xF0, 0x03, 0xA4, 0x13,
+    0x42, 0x74, 0xE9, 0x17, 0x2D, 0x67, 0xF2, 0x27, 0x5E, 0xC6, 0x5D, 0x10, 0xF3, 0x26, 0xAB, 0xD1,
+    0xFC, 0x2B, 0x1A, 0x1F, 0x65, 0x3C, 0x0B, 0x12, 0x66, 0x71, 0x24, 0x1F, 0xA5, 0x7B, 0xAD, 0x8F,
+    0xCE, 0x8C, 0x3B, 0xC7, 0xB0, 0xBD, 0x39, 0xD2, 0x2B, 0x04, 0x35, 0xB1, 0xDF, 0x0F, 0xFB, 0x71,
+    0x7A, 0xF3, 0x7C, 0xB7, 0xF9, 0x1F, 0xB5, 0x55, 0x3D, 0x93, 0xDC, 0x44, 0x10, 0x6D, 0x49, 0xAC,
+    0x15, 0x28, 0x10, 0x81, 0x2F, 0xB1, 0x29, 0x4F, 0x4C, 0xC0, 0x4D, 0x42, 0xB8, 0x1F, 0xA2, 0x08,
+    0x08, 0x08, 0xB8, 0xC0, 0x8A, 0x48, 0x89, 0x48, 0x2E, 0x25, 0xD8, 0xF3, 0x4E, 0xF1, 0x07, 0xD8,
+    0x7F, 0x80, 0x03, 0x07, 0xA0, 0x64, 0x13, 0x07, 0x17, 0xAC, 0xBD, 0x73, 0xE5, 0x2A, 0x1C, 0x10,
+    0x20, 0x9B, 0xE0, 0x52, 0x51, 0x05, 0x75, 0x55, 0x38, 0x40, 0x5C, 0xC9, 0xC5, 0x9E, 0xD1, 0x6A,
+    0x78, 0x6F, 0x56, 0x2A, 0x0A, 0x07, 0x7C, 0xD8, 0x85, 0xAA, 0x7A, 0x56, 0xEA, 0xEE, 0xE9, 0xE9,
+    0x7E, 0xFD, 0xA6, 0x57, 0x6E, 0x3A, 0xD7, 0xC4, 0xCE, 0xB9, 0x6A, 0xF3, 0x53, 0x9E, 0xC7, 0x8D,
+    0x88, 0xCC, 0x20, 0xB2, 0x85, 0xC4, 0xD5, 0x41, 0x7E, 0x5B, 0xC3, 0xB6, 0x5D, 0x60, 0xF9, 0x81,
+    0xB6, 0xA8, 0xC6, 0x92, 0x94, 0x58, 0xD2, 0x0A, 0x8B, 0xEA, 0x8A, 0x62, 0x99, 0xC0, 0x68, 0x82,
+    0x4F, 0x8B, 0xAF, 0xB9, 0x2F, 0x74, 0xEE, 0x4A, 0xA8, 0xC9, 0x44, 0x46, 0x1B, 0xC3, 0x70, 0xD9,
+    0x10, 0xF3, 0x0E, 0x97, 0x16, 0x12, 0x30, 0x54, 0x7C, 0x0E, 0x2F, 0xF7, 0x25, 0x64, 0x37, 0xA8,
+    0x7C, 0x60, 0xBA, 0x06, 0x3C, 0x3E, 0xB5, 0x78, 0xD9, 0x05, 0x79, 0xBE, 0x29, 0x91, 0x44, 0x2B,
+    0x1B, 0xD7, 0x31, 0x14, 0x2D, 0x5C, 0xA6, 0x10, 0xE8, 0x97, 0xD0, 0xBB, 0x46, 0xA2, 0xEA, 0xE3,
+    0xAD, 0x24, 0x36, 0x6A, 0x60, 0x44, 0x92, 0x13, 0x24, 0x2F, 0x6B, 0x86, 0xA8, 0x45, 0x65, 0x51,
+    0x25, 0x27, 0x2C, 0xE1, 0x8A, 0x27, 0x56, 0x30, 0xAA, 0x0C, 0xC6, 0x07, 0x12, 0xD4, 0x70, 0x8D,
+    0x4A, 0x65, 0x24, 0x31, 0xC8, 0x4B, 0xA9, 0xF2, 0x20, 0x5F, 0xEC, 0x50, 0x82, 0x2B, 0x13, 0x06,
+    0x45, 0xBD, 0xCC, 0x28, 0x61, 0x19, 0x23, 0x11, 0x84, 0x58, 0xD2, 0xD8, 0x20, 0xA7, 0x63, 0x5F,
+    0xC2, 0x9F, 0x90, 0xD8, 0x3C, 0x3F, 0xD2, 0x1F, 0xC2, 0xD8, 0x11, 0x30, 0x6F, 0xFC, 0x4B, 0x31,
+    0xFA, 0xAC, 0x28, 0x56, 0xAD, 0x87, 0xEA, 0x46, 0x51, 0x1C, 0xED, 0xEB, 0xE0, 0xA7, 0xDB, 0x31,
+    0xB3, 0x2E, 0x83, 0xA7, 0x36, 0x88, 0x05, 0x6F, 0xBC, 0xAA, 0xFF, 0xF9, 0x75, 0xB3, 0x94, 0xE3,
+    0x1F, 0x37, 0xCE, 0xCC, 0xDC, 0x37, 0xC5, 0xDD, 0xB0, 0xF8, 0x8A, 0xD9, 0x04, 0xEC, 0x34, 0xB3,
+    0x37, 0x1D, 0xDA, 0x84, 0xDA, 0x62, 0xAB, 0xAD, 0x8C, 0xC5, 0x49, 0x98, 0x45, 0xAC, 0x41, 0xA1,
+    0x21, 0xB2, 0x61, 0xC9, 0xBE, 0x3D, 0xAC, 0xEF, 0x61, 0xDF, 0xA7, 0xB0, 0xE9, 0xFB, 0xCB, 0x0F,
+    0x8F, 0xC8, 0x03, 0x6E, 0x30, 0xF2, 0x96, 0x47, 0x18, 0xE0, 0x8E, 0xB5, 0x91, 0x9B, 0x8F, 0x10,
+    0xBD, 0x9D, 0xF1, 0x88, 0xA2, 0x28, 0xEE, 0xE2, 0x17, 0xEF, 0x76, 0x8F, 0xC5, 0x61, 0xDF, 0xD7,
+    0x14, 0x60, 0xC7, 0x76, 0x8F, 0x7C, 0xC8, 0x40, 0x94, 0x53, 0xC8, 0x1C, 0x32, 0x21, 0x92, 0xBD,
+    0x63, 0xF2, 0xB2, 0x63, 0xF3, 0x92, 0xA3, 0xA2, 0x23, 0x18, 0x13, 0x90, 0x35, 0xF7, 0xD1, 0x6C,
+    0x89, 0x2C, 0x77, 0x29, 0x6F, 0x3E, 0xF5, 0x8A, 0x92, 0x8A, 0xD4, 0x2B, 0xE6, 0x3C, 0x2A, 0xAC,
+    0x18, 0x13, 0xBB, 0x90, 0xCE, 0x98, 0x21, 0xF7, 0xBB, 0x02, 0xDF, 0x7F, 0xA6, 0x92, 0x4A, 0x60,
+    0xEA, 0xEB, 0xB3, 0x8F, 0x52, 0xFB, 0xF0, 0xF7, 0x4A, 0xD0, 0xE8, 0x78, 0x27, 0xB1, 0xDB, 0x85,
+    0xDB, 0xCB, 0xF6, 0x9D, 0x34, 0x36, 0x7B, 0x97, 0x7D, 0xD2, 0xB2, 0xA9, 0xF4, 0xEA, 0xB1, 0x9D,
+    0x9C, 0x86, 0xCF, 0xB2, 0x5B, 0xA7, 0xE1, 0x45, 0x39, 0xD7, 0x2E, 0x3B, 0x36, 0xEA, 0xFD, 0x76,
+    0x76, 0xC6, 0x5C, 0x83, 0xA3, 0x9E, 0xC5, 0x9E, 0x29, 0xEB, 0xBE, 0x76, 0x5F, 0x86, 0x1E, 0x78,
+    0xC5, 0x3A, 0x58, 0xA4, 0xAC, 0x47, 0x39, 0xCC, 0xAE, 0x0E, 0xEA, 0xD4, 0xC1, 0x1C, 0x36, 0xE0,
+    0x74, 0x6A, 0x26, 0x6C, 0x14, 0x8A, 0xB2, 0x68, 0xC8, 0x09, 0xB2, 0x8E, 0x7E, 0xC5, 0x26, 0x8D,
+    0xDC, 0x83, 0xDF, 0x10, 0x33, 0xE5, 0x5D, 0xDB, 0xD8, 0x9E, 0xA7, 0xB3, 0x21, 0xE6, 0x1B, 0x7B,
+    0xC0, 0x17, 0xD9, 0xA1, 0xEE, 0x92, 0xF3, 0x27, 0x57, 0xD5, 0xFD, 0xA8, 0x4D, 0x81, 0x4A, 0x1D,
+    0x34, 0x89, 0x59, 0xD8, 0xC5, 0x4A, 0x7D, 0xEE, 0xEC, 0x1D, 0x64, 0xB7, 0x0C, 0xB7, 0x68, 0xB0,
+    0xAB, 0x17, 0xED, 0x34, 0xF9, 0xE2, 0x83, 0x73, 0x3B, 0xB3, 0x87, 0x9F, 0x49, 0x13, 0x5C, 0x18,
+    0x65, 0x6E, 0xCD, 0xA3, 0x2E, 0xFA, 0xFE, 0x45, 0xDD, 0xB5, 0x69, 0x1B, 0x39, 0x39, 0x90, 0x91,
+    0xBF, 0x9A, 0x41, 0x3D, 0xE4, 0x4B, 0xF0, 0x7D, 0x27, 0x5E, 0x53, 0xF5, 0x33, 0x88, 0xA2, 0xC8,
+    0x1A, 0xDE, 0x92, 0x5A, 0x86, 0xE7, 0x5D, 0x19, 0x86, 0x8A, 0x36, 0x03, 0x33, 0x53, 0x3B, 0xB0,
+    0x32, 0xE1, 0x6C, 0x8A, 0xEB, 0x61, 0x89, 0x9A, 0x81, 0xB3, 0xA1, 0x9F, 0x3E, 0xED, 0x30, 0x87,
+    0x84, 0x93, 0xC7, 0x73, 0x58, 0x16, 0x3E, 0x20, 0x4E, 0xBB, 0x47, 0x7A, 0xEE, 0x78, 0x0D, 0x5C,
+    0x76, 0x7D, 0xFA, 0x37, 0xCF, 0xDB, 0xB7, 0x47, 0x3A, 0xFE, 0xF6, 0xEC, 0xB2, 0x9E, 0xAF, 0xD5,
+    0xAB, 0xBD, 0xDC, 0x08, 0xCD, 0xBE, 0x1A, 0xDF, 0x16, 0x3F, 0x50, 0xD9, 0xAD, 0xE8, 0x17, 0x60,
+    0xA9, 0x48, 0x8C, 0xED, 0x9A, 0xF4, 0x46, 0xF6, 0x9A, 0x1E, 0x5B, 0xE0, 0x13, 0x5B, 0x70, 0x44,
+    0x93, 0x1F, 0x5B, 0x39, 0x21, 0x60, 0xBC, 0xD5, 0x60, 0x3F, 0x06, 0x60, 0x99, 0x80, 0xB8, 0x16,
+    0xDB, 0xD4, 0x7B, 0xD8, 0x31, 0x25, 0x1A, 0xEB, 0x69, 0x3F, 0x58, 0xFD, 0x3C, 0x8F, 0x9F, 0x92,
+    0x1C, 0x24, 0xDB, 0x16, 0x41, 0x70, 0xB9, 0x89, 0xE0, 0x84, 0x84, 0x6B, 0xC1, 0x20, 0xC0, 0x3D,
+    0xC5, 0x14, 0x85, 0x7B, 0x62, 0x11, 0x49, 0x65, 0xD8, 0x3B, 0x65, 0x0F, 0xE6, 0x8C, 0xD4, 0xC0,
+    0x2F, 0xBC, 0xC4, 0x57, 0xFC, 0x9D, 0xE9, 0x89, 0xA5, 0xEB, 0x61, 0xB8, 0xF3, 0xEB, 0xDA, 0x3D,
+    0xCE, 0xC7, 0x86, 0x33, 0x32, 0x5B, 0x64, 0x71, 0x83, 0xDE, 0xCC, 0x70, 0x4A, 0xF2, 0xB8, 0x94,
+    0xE0, 0x39, 0x3C, 0x27, 0x28, 0x25, 0x5D, 0xA1, 0x9C, 0x67, 0x88, 0xF6, 0x02, 0x8A, 0xE9, 0xBF,
+    0x53, 0x78, 0x84, 0xF4, 0x7F, 0xDF, 0x47, 0xC5, 0x05, 0x14, 0xCF, 0x51, 0xFE, 0x09, 0x4A, 0xD1,
+    0x20, 0x86, 0x3A, 0xEB, 0x44, 0x5B, 0xB0, 0xA9, 0xC4, 0x7F, 0x86, 0x91, 0x20, 0x67, 0xEC, 0x6B,
+    0x4B, 0x24, 0x8E, 0x0A, 0xBA, 0x1D, 0x70, 0x1C, 0x03, 0x01, 0xFE, 0xEF, 0xF5, 0x52, 0xBE, 0xBE,
+    0xF0, 0x2F, 0x0D, 0x70, 0x8E, 0x01, 0xE2, 0x62, 0x95, 0xC9, 0x6C, 0xB7, 0x3F, 0x51, 0xE4, 0xCD,
+    0x81, 0x98, 0xAA, 0xF2, 0x97, 0x11, 0xCB, 0x27, 0xF2, 0xCF, 0xCF, 0x88, 0xF3, 0x0C, 0xF3, 0x59,
+    0x3F, 0x42, 0xCE, 0x0E, 0x9C, 0x09, 0xDB, 0x51, 0x3F, 0xE2, 0x5E, 0xE9, 0xF9, 0x03, 0x9D, 0x55,
+    0xBF, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0x63, 0x67, 0xCF, 0xE2, 0x5C, 0x38, 0x05, 0x47, 0x71, 0xE8,
+    0xE4, 0xB4, 0x01, 0xB1, 0x6E, 0x29, 0x4E, 0xB7, 0x3E, 0xF6, 0x1F, 0x40, 0xE2, 0x56, 0x14, 0xFC,
+    0x05, 0xA4, 0x49, 0xB3, 0x05, 0xC5, 0x9E, 0xD6, 0xC0, 0x3F, 0x90, 0x06, 0xD1, 0xA6, 0x00, 0x94,
+    0x4C, 0x8A, 0x4D, 0x19, 0xA4, 0x4B, 0xEC, 0xBB, 0x2B, 0x68, 0x0D, 0x08, 0x51, 0xD0, 0x58, 0x20,
+    0x72, 0x05, 0x11, 0x99, 0x95, 0x8C, 0xB4, 0xD9, 0xEC, 0xEE, 0xF0, 0x7D, 0xB3, 0xDE, 0xB3, 0x82,
+    0x10, 0x3F, 0x32, 0x5A, 0xCF, 0xEC, 0xBC, 0x79, 0xEF, 0x7D, 0xEF, 0xC7, 0x37, 0x76, 0x47, 0x44,
+    0xD2, 0x95, 0x48, 0x7C, 0xBE, 0x10, 0xB1, 0x51, 0x25, 0xDE, 0xE2, 0x15, 0x11, 0x95, 0xCA, 0xBF,
+    0x8F, 0x57, 0xF1, 0xF8, 0x35, 0xA6, 0xB8, 0xC2, 0x34, 0xA6, 0xC9, 0x55, 0x7A, 0x1B, 0x47, 0x66,
+    0xB9, 0xD5, 0x3A, 0x48, 0x7B, 0xA1, 0x79, 0xE4, 0xA5, 0x9D, 0x97, 0x05, 0xEA, 0x50, 0x0B, 0x86,
+    0x49, 0x6B, 0xE8, 0x44, 0x72, 0x24, 0xE2, 0xD9, 0xCA, 0x3F, 0x9B, 0xDB, 0xCF, 0x2B, 0xB3, 0x65,
+    0xAB, 0xAB, 0x02, 0x54, 0x75, 0x47, 0x3A, 0xBE, 0xAD, 0xFD, 0xF3, 0x3F, 0xF2, 0xDF, 0xCA, 0x4A,
+    0xD9, 0x12, 0xAA, 0xAD, 0x2F, 0xAD, 0xF5, 0x9D, 0x9E, 0xB5, 0xB6, 0x33, 0x18, 0x0C, 0x2E, 0x91,
+    0xDF, 0x80, 0x34, 0x82, 0xF0, 0x14, 0xC2, 0x77, 0xBD, 0x5B, 0x72, 0x68, 0xCB, 0x6E, 0x2F, 0xFF,
+    0xE9, 0xC7, 0x22, 0x9F, 0x5D, 0x93, 0x87, 0x72, 0x5D, 0xAE, 0xC4, 0x4B, 0xEF, 0x7B, 0xBB, 0x7C,
+    0x38, 0x0A, 0xED, 0xB9, 0xBC, 0x0E, 0x1C, 0x51, 0xD1, 0x5C, 0xE7, 0x67, 0xB0, 0xA9, 0xD4, 0x8D,
+    0x2F, 0x5B, 0xF7, 0xBB, 0xF9, 0x5D, 0x81, 0x70, 0x71, 0xF0, 0xD9, 0x60, 0xD2, 0x88, 0xAE, 0x89,
+    0xEC, 0x77, 0x06, 0x37, 0xDF, 0x83, 0x54, 0x4F, 0xB4, 0x84, 0xA9, 0xF8, 0x85, 0x7A, 0xFF, 0x87,
+    0x23, 0xA8, 0xBD, 0x39, 0xD7, 0x99, 0x11, 0x79, 0xFB, 0x6F, 0xA2, 0xD8, 0x38, 0xDC, 0x86, 0xF0,
+    0x53, 0x08, 0x0D, 0x84, 0x47, 0x1B, 0xA1, 0x07, 0xE1, 0x6D, 0xC2, 0xEC, 0x40, 0xDA, 0xC8, 0x86,
+    0x68, 0x40, 0x21, 0xE3, 0x4A, 0xC6, 0x25, 0x7F, 0xBD, 0x52, 0xFC, 0xA5, 0x48, 0xC8, 0x67, 0xB6,
+    0x7E, 0x62, 0x3E, 0xD9, 0xBA, 0x45, 0x1C, 0x28, 0xC3, 0x39, 0x7C, 0xE0, 0x9F, 0x42, 0x8D, 0x60,
+    0x20, 0x39, 0x4E, 0x6D, 0x26, 0xAA, 0x79, 0xBC, 0x85, 0xA8, 0x3C, 0xC3, 0xBF, 0xF5, 0x4F, 0x12,
+    0x1C, 0xB7, 0xDD, 0x6A, 0xCD, 0xDD, 0xF8, 0x48, 0xBC, 0x42, 0x62, 0x23, 0x79, 0x1A, 0xAC, 0x24,
+    0xA9, 0x95, 0x4D, 0x81, 0x39, 0x2E, 0xBD, 0x95, 0x44, 0xB5, 0x8C, 0x33, 0xFA, 0xB7, 0xA9, 0xC4,
+    0xB5, 0xE4, 0x85, 0x04, 0x4B, 0x49, 0xD0, 0x45, 0xA7, 0x82, 0x7D, 0xC0, 0xDE, 0x8A, 0xAA, 0xD7,
+    0x64, 0x59, 0xBB, 0xAB, 0x58, 0x28, 0x1C, 0xC3, 0xCC, 0xF9, 0x63, 0x70, 0x30, 0x83, 0x1D, 0x3C,
+    0x4B, 0x68, 0x5C, 0xB2, 0x05, 0xBC, 0xC7, 0x0D, 0x0A, 0x3D, 0x53, 0x03, 0xAA, 0x08, 0xF5, 0x58,
+    0xFC, 0x6A, 0xE3, 0x6B, 0x6C, 0xE7, 0xA9, 0xC7, 0x12, 0x6E, 0x69, 0x3D, 0x21, 0x48, 0xE0, 0x26,
+    0x14, 0x5E, 0xC2, 0x82, 0xE4, 0xA5, 0xDA, 0x01, 0xCB, 0x30, 0xA3, 0xBC, 0x64, 0x6E, 0xDC, 0x31,
+    0xB5, 0xE4, 0x54, 0xEB, 0x7B, 0xCB, 0x10, 0xD6, 0xD9, 0xAE, 0xD6, 0xB7, 0xE8, 0xEE, 0x0A, 0xA7,
+    0x07, 0x64, 0x3E, 0x35, 0xE3, 0x66, 0xB7, 0x6B, 0x6D, 0xC9, 0xE6, 0x7D, 0x6C, 0xF5, 0xEA, 0x6E,
+    0x5C, 0xE2, 0x6C, 0x89, 0x33, 0x04, 0x71, 0x02, 0xFF, 0xD8, 0x61, 0x11, 0xCF, 0x60, 0x09, 0x78,
+    0x16, 0x65, 0x11, 0x40, 0xD2, 0x13, 0x4C, 0x7D, 0xC4, 0x39, 0x7E, 0xAA, 0x75, 0x8A, 0x7A, 0xAE,
+    0x24, 0x98, 0xEB, 0x2F, 0x24, 0xA2, 0xCF, 0x11, 0x11, 0x78, 0xAD, 0xA2, 0xB4, 0xB9, 0x69, 0xCD,
+    0x5D, 0x89, 0xFF, 0x82, 0xAF, 0xAC, 0x5D, 0x0A, 0x23, 0x2C, 0x76, 0xF5, 0x24, 0x87, 0xEC, 0x41,
+    0x8C, 0xDE, 0x97, 0x31, 0xBA, 0x81, 0xAA, 0x02, 0xF1, 0x98, 0x9A, 0x33, 0x78, 0x0D, 0x2E, 0xA3,
+    0x59, 0x70, 0xC7, 0x68, 0xF2, 0xAD, 0x7B, 0xF3, 0x49, 0x9D, 0x10, 0xFA, 0xC6, 0x4A, 0xA7, 0x0D,
+    0xE2, 0x0B, 0xF8, 0x9D, 0x96, 0xDD, 0x39, 0xE8, 0x0E, 0x5D, 0xFB, 0xC9, 0x0A, 0x81, 0xC4, 0xAC,
+    0x1D, 0x6B, 0x14, 0x54, 0x9B, 0x22, 0x9E, 0x30, 0xC6, 0x7A, 0x53, 0xC4, 0x88, 0x0A, 0xE4, 0x8C,
+    0xE3, 0x16, 0xF9, 0x62, 0xB3, 0x98, 0x48, 0x6A, 0xC3, 0x6F, 0xB0, 0x77, 0xC0, 0xC8, 0x57, 0x74,
+    0x3A, 0x73, 0xCC, 0xA6, 0x12, 0x45, 0xF4, 0x79, 0xD3, 0x05, 0xD3, 0xBA, 0x22, 0xC4, 0x31, 0xB5,
+    0x2E, 0xFB, 0xE4, 0x50, 0x19, 0x43, 0x08, 0x55, 0x65, 0x69, 0x68, 0x12, 0xD6, 0x63, 0x67, 0x73,
+    0x2F, 0x14, 0xEF, 0x8D, 0x73, 0x9F, 0xAF, 0xBD, 0xEE, 0x38, 0x14, 0x30, 0x2E, 0x7C, 0xFC, 0x18,
+    0x45, 0xC9, 0x86, 0x61, 0x11, 0xA5, 0x7B, 0x32, 0x0A, 0xB2, 0x20, 0x0D, 0xFB, 0x05, 0xAE, 0xC2,
+    0xB4, 0xC4, 0x65, 0x7A, 0xEB, 0xBE, 0xEC, 0x89, 0x8F, 0x76, 0xA5, 0xBC, 0xCF, 0x9B, 0x61, 0x28,
+    0x7C, 0x42, 0xE1, 0x45, 0x0A, 0xCD, 0xA1, 0x81, 0xE6, 0x7E, 0x17, 0xC2, 0xAE, 0x5F, 0x06, 0x69,
+    0x2C, 0x07, 0xAA, 0x4C, 0xC4, 0x7B, 0xF6, 0xF5, 0x23, 0x84, 0x86, 0x28, 0x80, 0xE6, 0x12, 0x6D,
+    0x31, 0x7F, 0x7D, 0x8D, 0x98, 0x42, 0x4C, 0x21, 0x26, 0x44, 0x7D, 0xE6, 0x36, 0x65, 0x36, 0xC0,
+    0x14, 0x62, 0x62, 0xBC, 0x80, 0x29, 0xC4, 0xC4, 0xB8, 0x60, 0xB6, 0x43, 0xEE, 0x81, 0x29, 0xC4,
+    0x64, 0xFF, 0x0F, 0x78, 0x79, 0xBC, 0x67, 0xEA, 0x3F, 0x60, 0x16, 0x20, 0x75, 0x70, 0x22, 0xEA,
+    0x79, 0xFF, 0x9B, 0x42, 0xD5, 0xD3, 0x72, 0xA4, 0xEA, 0xBD, 0xFB, 0xC1, 0x69, 0x0D, 0xCC, 0x63,
+    0x23, 0x96, 0x94, 0xE8, 0x15, 0xE0, 0x7D, 0x64, 0xD4, 0xF3, 0xC2, 0x7F, 0xA2, 0xCC, 0x48, 0x2E,
+    0x0E, 0x4D, 0x50, 0x0C, 0xA7, 0x46, 0x46, 0xFB, 0x5D, 0x23, 0xC1, 0xEF, 0x3E, 0xE0, 0xC7, 0xFF,
+    0x07, 0x33, 0x25, 0x66, 0x46, 0x4C, 0xA0, 0x03, 0x53, 0x88, 0x89, 0x09, 0x98, 0xA0, 0x8A, 0xE5,
+    0x04, 0xCC, 0x9A, 0x98, 0x35, 0xF2, 0x24, 0x7D, 0x2E, 0x0E, 0x31, 0x0D, 0xA7, 0x35, 0xF3, 0xAC,
+    0x99, 0x67, 0xFD, 0x0F, 0x79, 0x4A, 0xC3, 0x80, 0x5E, 0x43, 0x13, 0x06, 0xF8, 0x72, 0x82, 0x2D,
+    0x9D, 0xEB, 0xAF, 0xC8, 0x46, 0x32, 0x25, 0xDB, 0xEE, 0x2F, 0x7A, 0x67, 0x20, 0xDA, 0xB6, 0xA8,
+    0xDB, 0x72, 0x1D, 0xD1, 0x2D, 0xDD, 0xF7, 0x27, 0xCF, 0xF0, 0x6D, 0x83, 0x95, 0x7B, 0x57, 0xB4,
+    0x6F, 0x78, 0x26, 0x5E, 0xB9, 0x25, 0xA9, 0xD6, 0x3C, 0x76, 0x4B, 0xF7, 0x03, 0x2E, 0x5E, 0xE1,
+    0xCE, 0xBA, 0xA2, 0xB0, 0x78, 0x8B, 0x0F, 0xB9, 0x03, 0x25, 0xFD, 0xCA, 0xD1, 0x1D, 0xDF, 0x33,
+    0x6C, 0x16, 0x49, 0xE5, 0xDE, 0x51, 0xB9, 0xBB, 0x60, 0xEF, 0xD8, 0x9F, 0x11, 0x47, 0x1A, 0xD9,
+    0x5F, 0x70, 0xAD, 0x41, 0x06, 0xDF, 0x5A, 0x28, 0x19, 0xDF, 0x2E, 0x40, 0x71, 0xF1, 0xA1, 0x06,
+    0x5A, 0xF8, 0xF6, 0x5B, 0x6C, 0xB0, 0x38, 0x8E, 0xF8, 0xF6, 0xA9, 0x25, 0x53, 0x16, 0x91, 0x23,
+    0x8C, 0x61, 0x72, 0xE2, 0x7F, 0x67, 0xDC, 0x62, 0x5D, 0x68, 0x2E, 0x4F, 0x2C, 0x6D, 0xE4, 0x7F,
+    0x02,
+};
+
+static const uint32_t bookerly_14_italicBlockOffsets[34] = {
+    0, 1152, 2254, 3351, 4572, 5813, 6565, 7264,
+    8185, 9079, 10004, 11019, 11988, 12856, 13852, 14613,
+    15527, 16679, 17696, 18656, 19912, 21158, 22380, 23453,
+    24574, 25645, 26734, 27792, 28755, 29735, 30965, 32102,
+    33054, 34081,
+};
+
+static const uint16_t bookerly_14_italicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_italicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_14_italicPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_14_italicGlyphs[] = {
@@ -4157,718 +2344,718 @@ static const EpdGlyph bookerly_14_italicGlyphs[] = {
     { 10, 20, 9, -1, 15, 50, 1877 }, // ;
     { 14, 14, 18, 2, 17, 49, 1927 }, // <
     { 13, 8, 18, 3, 14, 26, 1976 }, // =
-    { 14, 14, 18, 2, 17, 49, 2002 }, // >
-    { 10, 22, 12, 2, 21, 55, 2051 }, // ?
-    { 27, 26, 28, 1, 20, 176, 2106 }, // @
-    { 22, 21, 21, -2, 21, 116, 2282 }, // A
-    { 18, 22, 18, -1, 21, 99, 2398 }, // B
-    { 18, 22, 19, 1, 21, 99, 2497 }, // C
-    { 21, 22, 21, -1, 21, 116, 2596 }, // D
-    { 19, 21, 18, -1, 21, 100, 2712 }, // E
-    { 18, 21, 16, -1, 21, 95, 2812 }, // F
-    { 19, 22, 21, 1, 21, 105, 2907 }, // G
-    { 25, 21, 23, -1, 21, 132, 3012 }, // H
-    { 13, 21, 11, -1, 21, 69, 3144 }, // I
-    { 17, 27, 10, -5, 21, 115, 3213 }, // J
-    { 23, 22, 20, -1, 21, 127, 3328 }, // K
-    { 17, 21, 17, -1, 21, 90, 3455 }, // L
-    { 28, 21, 26, -2, 21, 147, 3545 }, // M
-    { 25, 22, 22, -1, 21, 138, 3692 }, // N
-    { 20, 22, 21, 1, 21, 110, 3830 }, // O
-    { 18, 21, 17, -1, 21, 95, 3940 }, // P
-    { 24, 28, 21, 1, 21, 168, 4035 }, // Q
-    { 19, 22, 19, -1, 21, 105, 4203 }, // R
-    { 15, 22, 15, 0, 21, 83, 4308 }, // S
-    { 18, 21, 19, 2, 21, 95, 4391 }, // T
-    { 22, 22, 22, 2, 21, 121, 4486 }, // U
-    { 21, 22, 21, 2, 21, 116, 4607 }, // V
-    { 30, 22, 30, 2, 21, 165, 4723 }, // W
-    { 24, 21, 19, -3, 21, 126, 4888 }, // X
-    { 20, 21, 19, 1, 21, 105, 5014 }, // Y
-    { 18, 22, 17, -1, 21, 99, 5119 }, // Z
-    { 12, 28, 9, -1, 23, 84, 5218 }, // [
-    { 12, 23, 14, 1, 21, 69, 5302 }, // <backslash>
-    { 12, 28, 9, -1, 23, 84, 5371 }, // ]
-    { 14, 14, 18, 2, 19, 49, 5455 }, // ^
-    { 15, 3, 15, 0, -1, 12, 5504 }, // _
-    { 6, 8, 18, 6, 24, 12, 5516 }, // `
-    { 16, 17, 17, 1, 16, 68, 5528 }, // a
-    { 15, 24, 16, 0, 23, 90, 5596 }, // b
-    { 12, 17, 13, 1, 16, 51, 5686 }, // c
-    { 16, 24, 17, 1, 23, 96, 5737 }, // d
-    { 12, 17, 14, 1, 16, 51, 5833 }, // e
-    { 20, 30, 12, -5, 23, 150, 5884 }, // f
-    { 19, 23, 14, -3, 16, 110, 6034 }, // g
-    { 17, 24, 17, 0, 23, 102, 6144 }, // h
-    { 9, 24, 9, 1, 23, 54, 6246 }, // i
-    { 15, 30, 8, -6, 23, 113, 6300 }, // j
-    { 14, 24, 15, 1, 23, 84, 6413 }, // k
-    { 8, 24, 9, 1, 23, 48, 6497 }, // l
-    { 24, 17, 26, 1, 16, 102, 6545 }, // m
-    { 16, 17, 18, 1, 16, 68, 6647 }, // n
-    { 14, 17, 16, 1, 16, 60, 6715 }, // o
-    { 18, 23, 17, -2, 16, 104, 6775 }, // p
-    { 15, 23, 16, 1, 16, 87, 6879 }, // q
-    { 12, 16, 12, 1, 16, 48, 6966 }, // r
-    { 12, 17, 12, 0, 16, 51, 7014 }, // s
-    { 12, 20, 11, 0, 19, 60, 7065 }, // t
-    { 16, 17, 18, 1, 16, 68, 7125 }, // u
-    { 15, 17, 15, 0, 16, 64, 7193 }, // v
-    { 22, 17, 22, 0, 16, 94, 7257 }, // w
-    { 18, 17, 16, -1, 16, 77, 7351 }, // x
-    { 18, 23, 16, -3, 16, 104, 7428 }, // y
-    { 14, 17, 14, 0, 16, 60, 7532 }, // z
-    { 12, 29, 11, 1, 24, 87, 7592 }, // {
-    { 8, 27, 8, 0, 23, 54, 7679 }, // |
-    { 11, 29, 11, -1, 24, 80, 7733 }, // }
-    { 14, 6, 18, 2, 13, 21, 7813 }, // ~
-    { 0, 0, 6, 0, 0, 0, 7834 }, //  
-    { 9, 23, 9, -1, 16, 52, 7834 }, // ¡
-    { 14, 29, 18, 2, 23, 102, 7886 }, // ¢
-    { 19, 22, 18, -1, 21, 105, 7988 }, // £
-    { 18, 14, 18, 0, 17, 63, 8093 }, // ¤
-    { 19, 20, 18, 1, 20, 95, 8156 }, // ¥
-    { 8, 27, 8, 0, 23, 54, 8251 }, // ¦
-    { 13, 23, 14, 0, 20, 75, 8305 }, // §
-    { 10, 4, 18, 4, 22, 10, 8380 }, // ¨
-    { 22, 22, 23, 0, 21, 121, 8390 }, // ©
-    { 11, 14, 13, 1, 21, 39, 8511 }, // ª
-    { 14, 11, 15, 1, 13, 39, 8550 }, // «
-    { 13, 8, 18, 3, 14, 26, 8589 }, // ¬
-    { 9, 3, 11, 1, 9, 7, 8615 }, // ­
-    { 17, 16, 17, 0, 23, 68, 8622 }, // ®
-    { 10, 3, 18, 4, 21, 8, 8690 }, // ¯
-    { 11, 11, 15, 2, 21, 31, 8698 }, // °
-    { 13, 17, 18, 3, 17, 56, 8729 }, // ±
-    { 11, 14, 13, 1, 24, 39, 8785 }, // ²
-    { 10, 14, 13, 1, 24, 35, 8824 }, // ³
-    { 6, 7, 18, 6, 24, 11, 8859 }, // ´
-    { 19, 24, 17, -1, 16, 114, 8870 }, // µ
-    { 19, 26, 17, -1, 21, 124, 8984 }, // ¶
-    { 5, 5, 9, 2, 10, 7, 9108 }, // ·
-    { 6, 7, 18, 6, -1, 11, 9115 }, // ¸
-    { 8, 14, 13, 2, 24, 28, 9126 }, // ¹
-    { 11, 14, 13, 1, 21, 39, 9154 }, // º
-    { 14, 11, 15, 0, 13, 39, 9193 }, // »
-    { 28, 24, 31, 2, 22, 168, 9232 }, // ¼
-    { 28, 24, 31, 2, 22, 168, 9400 }, // ½
-    { 29, 24, 31, 1, 22, 174, 9568 }, // ¾
-    { 10, 22, 12, 0, 16, 55, 9742 }, // ¿
-    { 22, 28, 21, -2, 28, 154, 9797 }, // À
-    { 22, 28, 21, -2, 28, 154, 9951 }, // Á
-    { 22, 28, 21, -2, 28, 154, 10105 }, // Â
-    { 22, 28, 21, -2, 28, 154, 10259 }, // Ã
-    { 22, 27, 21, -2, 27, 149, 10413 }, // Ä
-    { 22, 29, 21, -2, 29, 160, 10562 }, // Å
-    { 29, 21, 26, -3, 21, 153, 10722 }, // Æ
-    { 18, 29, 19, 1, 21, 131, 10875 }, // Ç
-    { 19, 28, 18, -1, 28, 133, 11006 }, // È
-    { 19, 28, 18, -1, 28, 133, 11139 }, // É
-    { 19, 28, 18, -1, 28, 133, 11272 }, // Ê
-    { 19, 27, 18, -1, 27, 129, 11405 }, // Ë
-    { 13, 28, 11, -1, 28, 91, 11534 }, // Ì
-    { 14, 28, 11, -1, 28, 98, 11625 }, // Í
-    { 15, 28, 11, -1, 28, 105, 11723 }, // Î
-    { 15, 27, 11, -1, 27, 102, 11828 }, // Ï
-    { 21, 22, 21, -1, 21, 116, 11930 }, // Ð
-    { 25, 29, 22, -1, 28, 182, 12046 }, // Ñ
-    { 20, 29, 21, 1, 28, 145, 12228 }, // Ò
-    { 20, 29, 21, 1, 28, 145, 12373 }, // Ó
-    { 20, 29, 21, 1, 28, 145, 12518 }, // Ô
-    { 20, 29, 21, 1, 28, 145, 12663 }, // Õ
-    { 20, 28, 21, 1, 27, 140, 12808 }, // Ö
-    { 12, 12, 18, 3, 16, 36, 12948 }, // ×
-    { 23, 22, 21, -1, 21, 127, 12984 }, // Ø
-    { 22, 29, 22, 2, 28, 160, 13111 }, // Ù
-    { 22, 29, 22, 2, 28, 160, 13271 }, // Ú
-    { 22, 29, 22, 2, 28, 160, 13431 }, // Û
-    { 22, 28, 22, 2, 27, 154, 13591 }, // Ü
-    { 20, 28, 19, 1, 28, 140, 13745 }, // Ý
-    { 18, 21, 17, -1, 21, 95, 13885 }, // Þ
-    { 23, 30, 19, -5, 23, 173, 13980 }, // ß
-    { 16, 25, 17, 1, 24, 100, 14153 }, // à
-    { 16, 25, 17, 1, 24, 100, 14253 }, // á
-    { 16, 25, 17, 1, 24, 100, 14353 }, // â
-    { 16, 24, 17, 1, 23, 96, 14453 }, // ã
-    { 16, 23, 17, 1, 22, 92, 14549 }, // ä
-    { 16, 25, 17, 1, 24, 100, 14641 }, // å
-    { 21, 17, 22, 1, 16, 90, 14741 }, // æ
-    { 12, 24, 13, 1, 16, 72, 14831 }, // ç
-    { 12, 25, 14, 1, 24, 75, 14903 }, // è
-    { 13, 25, 14, 1, 24, 82, 14978 }, // é
-    { 13, 25, 14, 1, 24, 82, 15060 }, // ê
-    { 14, 23, 14, 1, 22, 81, 15142 }, // ë
-    { 8, 25, 10, 1, 24, 50, 15223 }, // ì
-    { 11, 25, 10, 1, 24, 69, 15273 }, // í
-    { 11, 25, 10, 1, 24, 69, 15342 }, // î
-    { 11, 23, 10, 1, 22, 64, 15411 }, // ï
-    { 15, 25, 16, 0, 24, 94, 15475 }, // ð
-    { 16, 24, 18, 1, 23, 96, 15569 }, // ñ
-    { 14, 25, 16, 1, 24, 88, 15665 }, // ò
-    { 14, 25, 16, 1, 24, 88, 15753 }, // ó
-    { 14, 25, 16, 1, 24, 88, 15841 }, // ô
-    { 15, 24, 16, 1, 23, 90, 15929 }, // õ
-    { 15, 23, 16, 1, 22, 87, 16019 }, // ö
-    { 13, 14, 18, 3, 17, 46, 16106 }, // ÷
-    { 19, 17, 16, -2, 16, 81, 16152 }, // ø
-    { 16, 25, 18, 1, 24, 100, 16233 }, // ù
-    { 16, 25, 18, 1, 24, 100, 16333 }, // ú
-    { 16, 25, 18, 1, 24, 100, 16433 }, // û
-    { 16, 23, 18, 1, 22, 92, 16533 }, // ü
-    { 18, 31, 16, -3, 24, 140, 16625 }, // ý
-    { 18, 30, 16, -3, 23, 135, 16765 }, // þ
-    { 18, 29, 16, -3, 22, 131, 16900 }, // ÿ
-    { 22, 26, 21, -2, 26, 143, 17031 }, // Ā
-    { 16, 22, 17, 1, 21, 88, 17174 }, // ā
-    { 22, 28, 21, -2, 28, 154, 17262 }, // Ă
-    { 16, 24, 17, 1, 23, 96, 17416 }, // ă
-    { 22, 28, 21, -2, 21, 154, 17512 }, // Ą
-    { 16, 23, 17, 1, 16, 92, 17666 }, // ą
-    { 18, 29, 19, 1, 28, 131, 17758 }, // Ć
-    { 13, 25, 13, 1, 24, 82, 17889 }, // ć
-    { 18, 29, 19, 1, 28, 131, 17971 }, // Ĉ
-    { 13, 25, 13, 1, 24, 82, 18102 }, // ĉ
-    { 18, 29, 19, 1, 28, 131, 18184 }, // Ċ
-    { 12, 23, 13, 1, 22, 69, 18315 }, // ċ
-    { 18, 29, 19, 1, 28, 131, 18384 }, // Č
-    { 14, 25, 13, 1, 24, 88, 18515 }, // č
-    { 21, 29, 21, -1, 28, 153, 18603 }, // Ď
-    { 21, 26, 18, 1, 25, 137, 18756 }, // ď
-    { 21, 22, 21, -1, 21, 116, 18893 }, // Đ
-    { 18, 24, 17, 1, 23, 108, 19009 }, // đ
-    { 19, 26, 18, -1, 26, 124, 19117 }, // Ē
-    { 13, 22, 14, 1, 21, 72, 19241 }, // ē
-    { 19, 28, 18, -1, 28, 133, 19313 }, // Ĕ
-    { 14, 24, 14, 1, 23, 84, 19446 }, // ĕ
-    { 19, 28, 18, -1, 28, 133, 19530 }, // Ė
-    { 12, 23, 14, 1, 22, 69, 19663 }, // ė
-    { 19, 28, 18, -1, 21, 133, 19732 }, // Ę
-    { 12, 23, 14, 1, 16, 69, 19865 }, // ę
-    { 19, 28, 18, -1, 28, 133, 19934 }, // Ě
-    { 14, 25, 14, 1, 24, 88, 20067 }, // ě
-    { 19, 29, 21, 1, 28, 138, 20155 }, // Ĝ
-    { 19, 31, 14, -3, 24, 148, 20293 }, // ĝ
-    { 19, 29, 21, 1, 28, 138, 20441 }, // Ğ
-    { 19, 30, 14, -3, 23, 143, 20579 }, // ğ
-    { 19, 29, 21, 1, 28, 138, 20722 }, // Ġ
-    { 19, 29, 14, -3, 22, 138, 20860 }, // ġ
-    { 19, 29, 21, 1, 21, 138, 20998 }, // Ģ
-    { 19, 32, 14, -3, 25, 152, 21136 }, // ģ
-    { 25, 28, 23, -1, 28, 175, 21288 }, // Ĥ
-    { 17, 31, 17, 0, 30, 132, 21463 }, // ĥ
-    { 25, 21, 23, -1, 21, 132, 21595 }, // Ħ
-    { 17, 24, 17, 0, 23, 102, 21727 }, // ħ
-    { 14, 28, 11, -1, 28, 98, 21829 }, // Ĩ
-    { 11, 24, 10, 1, 23, 66, 21927 }, // ĩ
-    { 14, 26, 11, -1, 26, 91, 21993 }, // Ī
-    { 11, 22, 10, 1, 21, 61, 22084 }, // ī
-    { 15, 28, 11, -1, 28, 105, 22145 }, // Ĭ
-    { 11, 24, 10, 1, 23, 66, 22250 }, // ĭ
-    { 13, 28, 11, -1, 21, 91, 22316 }, // Į
-    { 9, 30, 9, 1, 23, 68, 22407 }, // į
-    { 13, 28, 11, -1, 28, 91, 22475 }, // İ
-    { 8, 17, 9, 1, 16, 34, 22566 }, // ı
-    { 24, 27, 21, -1, 21, 162, 22600 }, // Ĳ
-    { 18, 30, 18, 1, 23, 135, 22762 }, // ĳ
-    { 19, 34, 10, -5, 28, 162, 22897 }, // Ĵ
-    { 17, 31, 8, -6, 24, 132, 23059 }, // ĵ
-    { 23, 29, 20, -1, 21, 167, 23191 }, // Ķ
-    { 14, 31, 15, 1, 23, 109, 23358 }, // ķ
-    { 15, 17, 16, 1, 16, 64, 23467 }, // ĸ
-    { 17, 28, 17, -1, 28, 119, 23531 }, // Ĺ
-    { 10, 31, 9, 1, 30, 78, 23650 }, // ĺ
-    { 17, 29, 17, -1, 21, 124, 23728 }, // Ļ
-    { 10, 31, 9, -1, 23, 78, 23852 }, // ļ
-    { 18, 23, 17, -1, 23, 104, 23930 }, // Ľ
-    { 13, 26, 10, 1, 25, 85, 24034 }, // ľ
-    { 18, 21, 17, -1, 21, 95, 24119 }, // Ŀ
-    { 12, 24, 12, 1, 23, 72, 24214 }, // ŀ
-    { 17, 21, 17, -1, 21, 90, 24286 }, // Ł
-    { 11, 24, 9, -1, 23, 66, 24376 }, // ł
-    { 25, 29, 22, -1, 28, 182, 24442 }, // Ń
-    { 16, 25, 18, 1, 24, 100, 24624 }, // ń
-    { 25, 29, 22, -1, 21, 182, 24724 }, // Ņ
-    { 16, 24, 18, 1, 16, 96, 24906 }, // ņ
-    { 25, 29, 22, -1, 28, 182, 25002 }, // Ň
-    { 16, 25, 18, 1, 24, 100, 25184 }, // ň
-    { 21, 23, 24, 2, 22, 121, 25284 }, // ŉ
-    { 25, 27, 22, -1, 21, 169, 25405 }, // Ŋ
-    { 15, 23, 17, 1, 16, 87, 25574 }, // ŋ
-    { 20, 27, 21, 1, 26, 135, 25661 }, // Ō
-    { 15, 22, 16, 1, 21, 83, 25796 }, // ō
-    { 20, 29, 21, 1, 28, 145, 25879 }, // Ŏ
-    { 15, 24, 16, 1, 23, 90, 26024 }, // ŏ
-    { 21, 30, 21, 1, 29, 158, 26114 }, // Ő
-    { 16, 25, 16, 1, 24, 100, 26272 }, // ő
-    { 27, 22, 28, 1, 21, 149, 26372 }, // Œ
-    { 22, 17, 24, 1, 16, 94, 26521 }, // œ
-    { 19, 29, 19, -1, 28, 138, 26615 }, // Ŕ
-    { 13, 24, 12, 1, 24, 78, 26753 }, // ŕ
-    { 19, 29, 19, -1, 21, 138, 26831 }, // Ŗ
-    { 14, 24, 12, -1, 16, 84, 26969 }, // ŗ
-    { 19, 29, 19, -1, 28, 138, 27053 }, // Ř
-    { 14, 24, 12, 1, 24, 84, 27191 }, // ř
-    { 15, 29, 15, 0, 28, 109, 27275 }, // Ś
-    { 13, 25, 12, 0, 24, 82, 27384 }, // ś
-    { 15, 29, 15, 0, 28, 109, 27466 }, // Ŝ
-    { 13, 25, 12, 0, 24, 82, 27575 }, // ŝ
-    { 15, 29, 15, 0, 21, 109, 27657 }, // Ş
-    { 12, 24, 12, 0, 16, 72, 27766 }, // ş
-    { 16, 29, 15, 0, 28, 116, 27838 }, // Š
-    { 14, 25, 12, 0, 24, 88, 27954 }, // š
-    { 18, 29, 19, 2, 21, 131, 28042 }, // Ţ
-    { 12, 27, 11, 0, 19, 81, 28173 }, // ţ
-    { 18, 28, 19, 2, 28, 126, 28254 }, // Ť
-    { 13, 25, 11, 0, 24, 82, 28380 }, // ť
-    { 18, 21, 19, 2, 21, 95, 28462 }, // Ŧ
-    { 12, 20, 11, 0, 19, 60, 28557 }, // ŧ
-    { 22, 29, 22, 2, 28, 160, 28617 }, // Ũ
-    { 16, 24, 18, 1, 23, 96, 28777 }, // ũ
-    { 22, 27, 22, 2, 26, 149, 28873 }, // Ū
-    { 16, 22, 18, 1, 21, 88, 29022 }, // ū
-    { 22, 29, 22, 2, 28, 160, 29110 }, // Ŭ
-    { 16, 24, 18, 1, 23, 96, 29270 }, // ŭ
-    { 22, 30, 22, 2, 29, 165, 29366 }, // Ů
-    { 16, 25, 18, 1, 24, 100, 29531 }, // ů
-    { 22, 30, 22, 2, 29, 165, 29631 }, // Ű
-    { 16, 25, 18, 1, 24, 100, 29796 }, // ű
-    { 22, 28, 22, 2, 21, 154, 29896 }, // Ų
-    { 16, 23, 18, 1, 16, 92, 30050 }, // ų
-    { 30, 29, 30, 2, 28, 218, 30142 }, // Ŵ
-    { 22, 25, 22, 0, 24, 138, 30360 }, // ŵ
-    { 20, 28, 19, 1, 28, 140, 30498 }, // Ŷ
-    { 18, 31, 16, -3, 24, 140, 30638 }, // ŷ
-    { 20, 27, 19, 1, 27, 135, 30778 }, // Ÿ
-    { 18, 29, 17, -1, 28, 131, 30913 }, // Ź
-    { 14, 25, 14, 0, 24, 88, 31044 }, // ź
-    { 18, 29, 17, -1, 28, 131, 31132 }, // Ż
-    { 14, 23, 14, 0, 22, 81, 31263 }, // ż
-    { 18, 29, 17, -1, 28, 131, 31344 }, // Ž
-    { 14, 25, 14, 0, 24, 88, 31475 }, // ž
-    { 20, 30, 12, -5, 23, 150, 31563 }, // ſ
-    { 6, 8, 0, -4, 24, 12, 31713 }, // ̀
-    { 6, 7, 0, -2, 24, 11, 31725 }, // ́
-    { 10, 7, 0, -6, 24, 18, 31736 }, // ̂
-    { 10, 6, 0, -5, 23, 15, 31754 }, // ̃
-    { 10, 3, 0, -5, 21, 8, 31769 }, // ̄
-    { 10, 6, 0, -5, 23, 15, 31777 }, // ̆
-    { 4, 4, 0, -2, 22, 4, 31792 }, // ̇
-    { 10, 4, 0, -5, 22, 10, 31796 }, // ̈
-    { 8, 9, 0, -4, 26, 18, 31806 }, // ̉
-    { 8, 8, 0, -4, 24, 16, 31824 }, // ̊
-    { 11, 7, 0, -5, 24, 20, 31840 }, // ̋
-    { 10, 7, 0, -4, 24, 18, 31860 }, // ̌
-    { 9, 8, 0, -6, 24, 18, 31878 }, // ̏
-    { 10, 6, 0, -5, 23, 15, 31896 }, // ̑
-    { 6, 9, 0, -3, 25, 14, 31911 }, // ̒
-    { 7, 9, 0, -3, 26, 16, 31925 }, // ̓
-    { 6, 9, 0, -4, 26, 14, 31941 }, // ̔
-    { 4, 8, 0, -2, 25, 8, 31955 }, // ̕
-    { 6, 7, 0, -3, 19, 11, 31963 }, // ̛
-    { 4, 5, 0, -2, -2, 5, 31974 }, // ̣
-    { 10, 5, 0, -5, -2, 13, 31979 }, // ̤
-    { 8, 7, 0, -4, -1, 14, 31992 }, // ̥
-    { 6, 7, 0, -3, -1, 11, 32006 }, // ̦
-    { 6, 7, 0, -3, -1, 11, 32017 }, // ̧
-    { 6, 8, 0, -3, 1, 12, 32028 }, // ̨
-    { 5, 7, 8, -1, -1, 9, 32040 }, // ̩
-    { 11, 6, 0, -6, -2, 17, 32049 }, // ̭
-    { 10, 6, 0, -5, -1, 15, 32066 }, // ̮
-    { 10, 5, 0, -5, -2, 13, 32081 }, // ̰
-    { 10, 3, 0, -5, -3, 8, 32094 }, // ̱
-    { 10, 6, 0, -5, 23, 15, 32102 }, // ͂
-    { 11, 11, 0, -6, 29, 31, 32117 }, // ̈́
-    { 6, 5, 0, -2, -2, 8, 32148 }, // ͅ
-    { 19, 28, 18, -1, 28, 133, 32156 }, // Ѐ
-    { 19, 27, 18, -1, 27, 129, 32289 }, // Ё
-    { 18, 27, 22, 2, 21, 122, 32418 }, // Ђ
-    { 19, 28, 16, -1, 28, 133, 32540 }, // Ѓ
-    { 18, 22, 19, 1, 21, 99, 32673 }, // Є
-    { 15, 22, 15, 0, 21, 83, 32772 }, // Ѕ
-    { 13, 21, 11, -1, 21, 69, 32855 }, // І
-    { 15, 27, 11, -1, 27, 102, 32924 }, // Ї
-    { 17, 27, 10, -5, 21, 115, 33026 }, // Ј
-    { 27, 22, 26, -2, 21, 149, 33141 }, // Љ
-    { 27, 22, 27, -1, 21, 149, 33290 }, // Њ
-    { 19, 21, 23, 2, 21, 100, 33439 }, // Ћ
-    { 22, 29, 20, -1, 28, 160, 33539 }, // Ќ
-    { 25, 28, 23, -1, 28, 175, 33699 }, // Ѝ
-    { 20, 30, 18, 1, 29, 150, 33874 }, // Ў
-    { 24, 28, 22, -1, 21, 168, 34024 }, // Џ
-    { 22, 21, 21, -2, 21, 116, 34192 }, // А
-    { 18, 22, 17, -1, 21, 99, 34308 }, // Б
-    { 18, 22, 18, -1, 21, 99, 34407 }, // В
-    { 19, 21, 16, -1, 21, 100, 34506 }, // Г
-    { 24, 27, 21, -2, 21, 162, 34606 }, // Д
-    { 19, 21, 18, -1, 21, 100, 34768 }, // Е
-    { 31, 22, 28, -2, 21, 171, 34868 }, // Ж
-    { 15, 22, 16, 0, 21, 83, 35039 }, // З
-    { 25, 21, 23, -1, 21, 132, 35122 }, // И
-    { 25, 29, 23, -1, 29, 182, 35254 }, // Й
-    { 22, 22, 20, -1, 21, 121, 35436 }, // К
-    { 23, 22, 20, -2, 21, 127, 35557 }, // Л
-    { 28, 21, 26, -2, 21, 147, 35684 }, // М
-    { 25, 21, 23, -1, 21, 132, 35831 }, // Н
-    { 20, 22, 21, 1, 21, 110, 35963 }, // О
-    { 24, 21, 22, -1, 21, 126, 36073 }, // П
-    { 18, 21, 17, -1, 21, 95, 36199 }, // Р
-    { 18, 22, 19, 1, 21, 99, 36294 }, // С
-    { 18, 21, 19, 2, 21, 95, 36393 }, // Т
-    { 20, 22, 18, 1, 21, 110, 36488 }, // У
-    { 21, 22, 21, 0, 21, 116, 36598 }, // Ф
-    { 24, 21, 19, -3, 21, 126, 36714 }, // Х
-    { 24, 27, 22, -1, 21, 162, 36840 }, // Ц
-    { 20, 21, 20, 1, 21, 105, 37002 }, // Ч
-    { 31, 21, 29, -1, 21, 163, 37107 }, // Ш
-    { 31, 27, 29, -1, 21, 210, 37270 }, // Щ
-    { 18, 22, 20, 2, 21, 99, 37480 }, // Ъ
-    { 29, 22, 26, -1, 21, 160, 37579 }, // Ы
-    { 17, 22, 17, -1, 21, 94, 37739 }, // Ь
-    { 17, 22, 18, 0, 21, 94, 37833 }, // Э
-    { 29, 22, 29, -1, 21, 160, 37927 }, // Ю
-    { 21, 22, 19, -2, 21, 116, 38087 }, // Я
-    { 16, 17, 17, 1, 16, 68, 38203 }, // а
-    { 16, 24, 16, 1, 23, 96, 38271 }, // б
-    { 13, 17, 15, 1, 16, 56, 38367 }, // в
-    { 12, 17, 13, 0, 16, 51, 38423 }, // г
-    { 14, 24, 16, 1, 23, 84, 38474 }, // д
-    { 12, 17, 14, 1, 16, 51, 38558 }, // е
-    { 26, 17, 26, 0, 16, 111, 38609 }, // ж
-    { 12, 17, 13, 0, 16, 51, 38720 }, // з
-    { 16, 17, 18, 1, 16, 68, 38771 }, // и
-    { 16, 25, 18, 1, 24, 100, 38839 }, // й
-    { 15, 17, 16, 1, 16, 64, 38939 }, // к
-    { 18, 17, 18, -1, 16, 77, 39003 }, // л
-    { 22, 17, 22, 0, 16, 94, 39080 }, // м
-    { 16, 17, 18, 1, 16, 68, 39174 }, // н
-    { 14, 17, 16, 1, 16, 60, 39242 }, // о
-    { 16, 17, 18, 1, 16, 68, 39302 }, // п
-    { 18, 23, 17, -2, 16, 104, 39370 }, // р
-    { 12, 17, 13, 1, 16, 51, 39474 }, // с
-    { 24, 17, 26, 1, 16, 102, 39525 }, // т
-    { 18, 23, 16, -3, 16, 104, 39627 }, // у
-    { 18, 30, 20, 1, 23, 135, 39731 }, // ф
-    { 18, 17, 16, -1, 16, 77, 39866 }, // х
-    { 17, 22, 18, 1, 16, 94, 39943 }, // ц
-    { 16, 17, 17, 1, 16, 68, 40037 }, // ч
-    { 23, 17, 24, 1, 16, 98, 40105 }, // ш
-    { 23, 22, 25, 1, 16, 127, 40203 }, // щ
-    { 14, 17, 15, 1, 16, 60, 40330 }, // ъ
-    { 20, 17, 22, 1, 16, 85, 40390 }, // ы
-    { 13, 17, 14, 0, 16, 56, 40475 }, // ь
-    { 13, 17, 14, 0, 16, 56, 40531 }, // э
-    { 21, 17, 23, 1, 16, 90, 40587 }, // ю
-    { 16, 16, 16, -1, 15, 64, 40677 }, // я
-    { 12, 25, 14, 1, 24, 75, 40741 }, // ѐ
-    { 14, 23, 14, 1, 22, 81, 40816 }, // ё
-    { 15, 30, 16, 0, 23, 113, 40897 }, // ђ
-    { 13, 25, 13, 0, 24, 82, 41010 }, // ѓ
-    { 12, 17, 14, 1, 16, 51, 41092 }, // є
-    { 12, 17, 12, 0, 16, 51, 41143 }, // ѕ
-    { 9, 24, 9, 1, 23, 54, 41194 }, // і
-    { 11, 23, 9, 1, 22, 64, 41248 }, // ї
-    { 15, 30, 8, -6, 23, 113, 41312 }, // ј
-    { 22, 17, 21, -1, 16, 94, 41425 }, // љ
-    { 19, 17, 21, 1, 16, 81, 41519 }, // њ
-    { 17, 24, 17, 0, 23, 102, 41600 }, // ћ
-    { 15, 25, 16, 1, 24, 94, 41702 }, // ќ
-    { 16, 25, 18, 1, 24, 100, 41796 }, // ѝ
-    { 18, 31, 16, -3, 24, 140, 41896 }, // ў
-    { 16, 22, 18, 1, 16, 88, 42036 }, // џ
-    { 18, 24, 19, 1, 23, 108, 42124 }, // Ѣ
-    { 20, 17, 21, 1, 16, 85, 42232 }, // ѣ
-    { 20, 22, 21, 1, 21, 110, 42317 }, // Ѳ
-    { 14, 17, 16, 1, 16, 60, 42427 }, // ѳ
-    { 21, 22, 21, 2, 21, 116, 42487 }, // Ѵ
-    { 18, 17, 16, 0, 16, 77, 42603 }, // ѵ
-    { 25, 35, 23, -1, 29, 219, 42680 }, // Ҋ
-    { 17, 30, 18, 1, 24, 128, 42899 }, // ҋ
-    { 17, 22, 17, -1, 21, 94, 43027 }, // Ҍ
-    { 13, 22, 14, 1, 21, 72, 43121 }, // ҍ
-    { 18, 21, 17, -1, 21, 95, 43193 }, // Ҏ
-    { 18, 23, 17, -2, 16, 104, 43288 }, // ҏ
-    { 19, 24, 16, -1, 24, 114, 43392 }, // Ґ
-    { 14, 20, 13, 0, 19, 70, 43506 }, // ґ
-    { 19, 21, 16, -1, 21, 100, 43576 }, // Ғ
-    { 12, 17, 13, 0, 16, 51, 43676 }, // ғ
-    { 18, 27, 17, -1, 21, 122, 43727 }, // Ҕ
-    { 14, 22, 15, 1, 15, 77, 43849 }, // ҕ
-    { 31, 27, 28, -2, 21, 210, 43926 }, // Җ
-    { 26, 22, 26, 0, 16, 143, 44136 }, // җ
-    { 15, 27, 16, 0, 21, 102, 44279 }, // Ҙ
-    { 12, 22, 13, 0, 16, 66, 44381 }, // ҙ
-    { 22, 27, 20, -1, 21, 149, 44447 }, // Қ
-    { 15, 22, 16, 1, 16, 83, 44596 }, // қ
-    { 23, 22, 21, -1, 21, 127, 44679 }, // Ҝ
-    { 17, 17, 18, 1, 16, 73, 44806 }, // ҝ
-    { 22, 22, 20, -1, 21, 121, 44879 }, // Ҟ
-    { 15, 22, 16, 1, 21, 83, 45000 }, // ҟ
-    { 22, 22, 23, 2, 21, 121, 45083 }, // Ҡ
-    { 17, 17, 18, 1, 16, 73, 45204 }, // ҡ
-    { 25, 27, 23, -1, 21, 169, 45277 }, // Ң
-    { 17, 22, 18, 1, 16, 94, 45446 }, // ң
-    { 29, 21, 27, -1, 21, 153, 45540 }, // Ҥ
-    { 20, 17, 21, 1, 16, 85, 45693 }, // ҥ
-    { 30, 27, 30, -1, 21, 203, 45778 }, // Ҧ
-    { 23, 23, 24, 1, 16, 133, 45981 }, // ҧ
-    { 22, 22, 23, 1, 21, 121, 46114 }, // Ҩ
-    { 17, 17, 19, 1, 16, 73, 46235 }, // ҩ
-    { 18, 27, 19, 1, 21, 122, 46308 }, // Ҫ
-    { 12, 22, 13, 1, 16, 66, 46430 }, // ҫ
-    { 18, 27, 19, 2, 21, 122, 46496 }, // Ҭ
-    { 25, 22, 26, 1, 16, 138, 46618 }, // ҭ
-    { 20, 21, 19, 1, 21, 105, 46756 }, // Ү
-    { 15, 23, 15, 0, 16, 87, 46861 }, // ү
-    { 20, 21, 19, 1, 21, 105, 46948 }, // Ұ
-    { 15, 23, 15, 0, 16, 87, 47053 }, // ұ
-    { 24, 27, 19, -3, 21, 162, 47140 }, // Ҳ
-    { 18, 22, 16, -1, 16, 99, 47302 }, // ҳ
-    { 25, 27, 25, 1, 21, 169, 47401 }, // Ҵ
-    { 17, 27, 18, 1, 21, 115, 47570 }, // ҵ
-    { 20, 27, 20, 1, 21, 135, 47685 }, // Ҷ
-    { 16, 22, 17, 1, 16, 88, 47820 }, // ҷ
-    { 20, 21, 20, 1, 21, 105, 47908 }, // Ҹ
-    { 16, 17, 17, 1, 16, 68, 48013 }, // ҹ
-    { 19, 21, 19, -1, 21, 100, 48081 }, // Һ
-    { 17, 24, 17, 0, 23, 102, 48181 }, // һ
-    { 21, 22, 23, 1, 21, 116, 48283 }, // Ҽ
-    { 16, 17, 17, 0, 16, 68, 48399 }, // ҽ
-    { 21, 28, 23, 1, 21, 147, 48467 }, // Ҿ
-    { 16, 22, 17, 0, 16, 88, 48614 }, // ҿ
-    { 13, 21, 11, -1, 21, 69, 48702 }, // Ӏ
-    { 31, 30, 28, -2, 29, 233, 48771 }, // Ӂ
-    { 26, 25, 26, 0, 24, 163, 49004 }, // ӂ
-    { 22, 27, 20, -1, 21, 149, 49167 }, // Ӄ
-    { 15, 23, 16, 1, 16, 87, 49316 }, // ӄ
-    { 23, 27, 20, -2, 21, 156, 49403 }, // Ӆ
-    { 18, 22, 18, -1, 16, 99, 49559 }, // ӆ
-    { 25, 27, 23, -1, 21, 169, 49658 }, // Ӈ
-    { 15, 23, 17, 1, 16, 87, 49827 }, // ӈ
-    { 25, 27, 23, -1, 21, 169, 49914 }, // Ӊ
-    { 17, 22, 18, 1, 16, 94, 50083 }, // ӊ
-    { 20, 27, 20, 1, 21, 135, 50177 }, // Ӌ
-    { 15, 22, 16, 1, 16, 83, 50312 }, // ӌ
-    { 28, 27, 26, -2, 21, 189, 50395 }, // Ӎ
-    { 22, 22, 22, 0, 16, 121, 50584 }, // ӎ
-    { 13, 23, 9, -1, 23, 75, 50705 }, // ӏ
-    { 22, 29, 21, -2, 29, 160, 50780 }, // Ӑ
-    { 16, 25, 17, 1, 24, 100, 50940 }, // ӑ
-    { 22, 27, 21, -2, 27, 149, 51040 }, // Ӓ
-    { 16, 23, 17, 1, 22, 92, 51189 }, // ӓ
-    { 29, 21, 26, -3, 21, 153, 51281 }, // Ӕ
-    { 21, 17, 22, 1, 16, 90, 51434 }, // ӕ
-    { 19, 29, 18, -1, 29, 138, 51524 }, // Ӗ
-    { 14, 25, 14, 1, 24, 88, 51662 }, // ӗ
-    { 18, 22, 18, 0, 21, 99, 51750 }, // Ә
-    { 13, 17, 14, 0, 16, 56, 51849 }, // ә
-    { 18, 28, 18, 0, 27, 126, 51905 }, // Ӛ
-    { 14, 23, 14, 0, 22, 81, 52031 }, // ӛ
-    { 31, 28, 28, -2, 27, 217, 52112 }, // Ӝ
-    { 26, 23, 26, 0, 22, 150, 52329 }, // ӝ
-    { 15, 28, 16, 0, 27, 105, 52479 }, // Ӟ
-    { 14, 23, 13, 0, 22, 81, 52584 }, // ӟ
-    { 18, 22, 17, -1, 21, 99, 52665 }, // Ӡ
-    { 17, 22, 15, -2, 15, 94, 52764 }, // ӡ
-    { 25, 26, 23, -1, 26, 163, 52858 }, // Ӣ
-    { 16, 22, 18, 1, 21, 88, 53021 }, // ӣ
-    { 25, 27, 23, -1, 27, 169, 53109 }, // Ӥ
-    { 16, 23, 18, 1, 22, 92, 53278 }, // ӥ
-    { 20, 28, 21, 1, 27, 140, 53370 }, // Ӧ
-    { 15, 23, 16, 1, 22, 87, 53510 }, // ӧ
-    { 20, 22, 21, 1, 21, 110, 53597 }, // Ө
-    { 14, 17, 16, 1, 16, 60, 53707 }, // ө
-    { 20, 28, 21, 1, 27, 140, 53767 }, // Ӫ
-    { 15, 23, 16, 1, 22, 87, 53907 }, // ӫ
-    { 17, 28, 18, 0, 27, 119, 53994 }, // Ӭ
-    { 13, 23, 14, 0, 22, 75, 54113 }, // ӭ
-    { 20, 27, 18, 1, 26, 135, 54188 }, // Ӯ
-    { 18, 28, 16, -3, 21, 126, 54323 }, // ӯ
-    { 20, 28, 18, 1, 27, 140, 54449 }, // Ӱ
-    { 18, 29, 16, -3, 22, 131, 54589 }, // ӱ
-    { 20, 30, 18, 1, 29, 150, 54720 }, // Ӳ
-    { 18, 31, 16, -3, 24, 140, 54870 }, // ӳ
-    { 20, 27, 20, 1, 27, 135, 55010 }, // Ӵ
-    { 16, 23, 17, 1, 22, 92, 55145 }, // ӵ
-    { 19, 27, 16, -1, 21, 129, 55237 }, // Ӷ
-    { 12, 22, 13, 0, 16, 66, 55366 }, // ӷ
-    { 29, 28, 26, -1, 27, 203, 55432 }, // Ӹ
-    { 20, 23, 22, 1, 22, 115, 55635 }, // ӹ
-    { 19, 27, 16, -1, 21, 129, 55750 }, // Ӻ
-    { 12, 22, 13, 0, 16, 66, 55879 }, // ӻ
-    { 24, 27, 19, -3, 21, 162, 55945 }, // Ӽ
-    { 18, 23, 16, -1, 16, 104, 56107 }, // ӽ
-    { 24, 21, 19, -3, 21, 126, 56211 }, // Ӿ
-    { 18, 17, 16, -1, 16, 77, 56337 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 56414 }, //  
-    { 0, 0, 29, 0, 0, 0, 56414 }, //  
-    { 0, 0, 15, 0, 0, 0, 56414 }, //  
-    { 0, 0, 29, 0, 0, 0, 56414 }, //  
-    { 0, 0, 10, 0, 0, 0, 56414 }, //  
-    { 0, 0, 7, 0, 0, 0, 56414 }, //  
-    { 0, 0, 5, 0, 0, 0, 56414 }, //  
-    { 0, 0, 18, 0, 0, 0, 56414 }, //  
-    { 0, 0, 8, 0, 0, 0, 56414 }, //  
-    { 0, 0, 6, 0, 0, 0, 56414 }, //  
-    { 0, 0, 1, 0, 0, 0, 56414 }, //  
-    { 0, 0, 0, 0, 0, 0, 56414 }, // ​
-    { 2, 24, 0, -1, 17, 12, 56414 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 56426 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 56465 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 56535 }, // ‏
-    { 9, 3, 11, 1, 9, 7, 56605 }, // ‐
-    { 9, 3, 11, 1, 9, 7, 56612 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 56619 }, // ‒
-    { 15, 3, 15, 0, 9, 12, 56630 }, // –
-    { 29, 3, 29, 0, 9, 22, 56642 }, // —
-    { 29, 3, 29, 0, 9, 22, 56664 }, // ―
-    { 10, 30, 15, 2, 23, 75, 56686 }, // ‖
-    { 15, 7, 15, 0, -1, 27, 56761 }, // ‗
-    { 7, 10, 9, 2, 22, 18, 56788 }, // ‘
-    { 6, 9, 9, 2, 22, 14, 56806 }, // ’
-    { 6, 10, 9, 1, 4, 15, 56820 }, // ‚
-    { 5, 10, 7, 1, 22, 13, 56835 }, // ‛
-    { 12, 10, 15, 2, 22, 30, 56848 }, // “
-    { 12, 10, 15, 2, 22, 30, 56878 }, // ”
-    { 12, 10, 15, 1, 4, 30, 56908 }, // „
-    { 11, 10, 13, 1, 22, 28, 56938 }, // ‟
-    { 13, 19, 14, 1, 21, 62, 56966 }, // †
-    { 14, 23, 14, 0, 21, 81, 57028 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 57109 }, // •
-    { 10, 10, 18, 4, 15, 25, 57122 }, // ‣
-    { 6, 5, 8, 1, 4, 8, 57147 }, // ․
-    { 12, 5, 15, 1, 4, 15, 57155 }, // ‥
-    { 24, 5, 29, 2, 4, 30, 57170 }, // …
-    { 6, 4, 8, 1, 10, 6, 57200 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 57206 }, //  
-    { 0, 0, 0, 0, 0, 0, 57206 }, //  
-    { 10, 28, 0, -5, 21, 70, 57206 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 57276 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 57346 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 57414 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 57498 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 57582 }, //  
-    { 36, 24, 40, 2, 22, 216, 57582 }, // ‰
-    { 6, 10, 8, 1, 21, 15, 57798 }, // ′
-    { 12, 10, 13, 1, 21, 30, 57813 }, // ″
-    { 17, 10, 19, 1, 21, 43, 57843 }, // ‴
-    { 6, 10, 8, 1, 21, 15, 57886 }, // ‵
-    { 12, 10, 14, 1, 21, 30, 57901 }, // ‶
-    { 19, 10, 20, 1, 21, 48, 57931 }, // ‷
-    { 13, 6, 14, 1, 0, 20, 57979 }, // ‸
-    { 8, 11, 9, 1, 13, 22, 57999 }, // ‹
-    { 9, 11, 9, 0, 13, 25, 58021 }, // ›
-    { 18, 20, 18, 0, 19, 90, 58046 }, // ※
-    { 16, 23, 17, 1, 22, 92, 58136 }, // ‼
-    { 15, 3, 15, 0, 24, 12, 58228 }, // ‾
-    { 7, 3, 9, 1, 9, 6, 58240 }, // ⁃
-    { 18, 24, 7, -6, 22, 108, 58246 }, // ⁄
-    { 21, 22, 24, 2, 21, 116, 58354 }, // ⁇
-    { 19, 23, 20, 2, 22, 110, 58470 }, // ⁈
-    { 20, 23, 21, 1, 22, 115, 58580 }, // ⁉
-    { 17, 5, 29, 6, 11, 22, 58695 }, // ⁓
-    { 23, 10, 25, 1, 21, 58, 58717 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 58775 }, //  
-    { 0, 0, 0, 0, 0, 0, 58775 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 58775 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 58775 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 58775 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 58775 }, // ⁤
-    { 11, 14, 13, 1, 24, 39, 58775 }, // ⁰
-    { 12, 14, 13, 0, 24, 42, 58814 }, // ⁴
-    { 11, 14, 13, 1, 24, 39, 58856 }, // ⁵
-    { 12, 14, 13, 1, 24, 42, 58895 }, // ⁶
-    { 10, 14, 13, 3, 24, 35, 58937 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 58972 }, // ⁸
-    { 12, 14, 13, 0, 24, 42, 59011 }, // ⁹
-    { 11, 11, 16, 3, 21, 31, 59053 }, // ⁿ
-    { 11, 15, 13, 1, 10, 42, 59084 }, // ₀
-    { 8, 14, 13, 2, 10, 28, 59126 }, // ₁
-    { 11, 14, 13, 1, 10, 39, 59154 }, // ₂
-    { 10, 15, 13, 1, 10, 38, 59193 }, // ₃
-    { 12, 14, 13, 0, 10, 42, 59231 }, // ₄
-    { 11, 14, 13, 1, 9, 39, 59273 }, // ₅
-    { 12, 15, 13, 1, 10, 45, 59312 }, // ₆
-    { 10, 14, 13, 3, 9, 35, 59357 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 59392 }, // ₈
-    { 12, 15, 13, 0, 10, 45, 59434 }, // ₉
-    { 18, 20, 18, 0, 20, 90, 59479 }, // ₣
-    { 19, 22, 18, -1, 21, 105, 59569 }, // ₤
-    { 35, 22, 36, 0, 21, 193, 59674 }, // ₧
-    { 20, 22, 18, -1, 21, 110, 59867 }, // €
-    { 17, 12, 29, 6, 16, 51, 59977 }, // ←
-    { 13, 20, 29, 8, 20, 65, 60028 }, // ↑
-    { 17, 12, 29, 6, 16, 51, 60093 }, // →
-    { 13, 20, 29, 8, 20, 65, 60144 }, // ↓
-    { 18, 12, 29, 5, 16, 54, 60209 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 60263 }, // ↕
-    { 13, 20, 29, 8, 20, 65, 60328 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 60393 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 60458 }, // ↳
-    { 17, 14, 29, 6, 17, 60, 60523 }, // ↵
-    { 17, 14, 29, 6, 17, 60, 60583 }, // ⇐
-    { 13, 18, 29, 8, 19, 59, 60643 }, // ⇑
-    { 17, 14, 29, 6, 17, 60, 60702 }, // ⇒
-    { 13, 18, 29, 8, 19, 59, 60762 }, // ⇓
-    { 19, 14, 29, 5, 17, 67, 60821 }, // ⇔
-    { 19, 22, 29, 5, 21, 105, 60888 }, // ∀
-    { 14, 24, 18, 2, 23, 84, 60993 }, // ∂
-    { 13, 21, 29, 8, 21, 69, 61077 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 61146 }, // ∅
-    { 19, 21, 19, 0, 21, 100, 61284 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 61384 }, // ∇
-    { 19, 21, 29, 5, 21, 100, 61489 }, // ∈
-    { 19, 26, 29, 5, 23, 124, 61589 }, // ∉
-    { 19, 16, 29, 5, 18, 76, 61713 }, // ∊
-    { 19, 21, 29, 5, 21, 100, 61789 }, // ∋
-    { 19, 26, 29, 5, 23, 124, 61889 }, // ∌
-    { 19, 16, 29, 5, 18, 76, 62013 }, // ∍
-    { 22, 26, 23, 1, 21, 143, 62089 }, // ∏
-    { 18, 26, 18, 0, 21, 117, 62232 }, // ∑
-    { 13, 3, 18, 3, 11, 10, 62349 }, // −
-    { 17, 23, 14, -1, 21, 98, 62359 }, // ∕
-    { 11, 23, 14, 2, 21, 64, 62457 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 62521 }, // ∗
-    { 10, 10, 18, 4, 15, 25, 62570 }, // ∘
-    { 6, 4, 18, 6, 10, 6, 62595 }, // ∙
-    { 18, 28, 18, 0, 24, 126, 62601 }, // √
-    { 14, 11, 18, 2, 15, 39, 62727 }, // ∝
-    { 18, 10, 18, 0, 14, 45, 62766 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 62811 }, // ∟
-    { 21, 21, 29, 3, 21, 111, 62911 }, // ∠
-    { 4, 30, 15, 5, 23, 30, 63022 }, // ∣
-    { 9, 30, 15, 3, 23, 68, 63052 }, // ∥
-    { 19, 21, 29, 5, 21, 100, 63120 }, // ∧
-    { 19, 21, 29, 5, 21, 100, 63220 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 63320 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 63410 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 63504 }, // ∫
-    { 19, 17, 29, 5, 16, 81, 63624 }, // ∴
-    { 19, 17, 29, 5, 16, 81, 63705 }, // ∵
-    { 6, 16, 9, 1, 18, 24, 63786 }, // ∶
-    { 19, 17, 29, 5, 16, 81, 63810 }, // ∷
-    { 17, 5, 29, 6, 11, 22, 63891 }, // ∼
-    { 17, 15, 29, 6, 17, 64, 63913 }, // ≅
-    { 14, 10, 18, 2, 15, 35, 63977 }, // ≈
-    { 17, 10, 29, 6, 13, 43, 64012 }, // ≍
-    { 13, 13, 18, 3, 16, 43, 64055 }, // ≠
-    { 17, 13, 29, 6, 15, 56, 64098 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 64154 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 64217 }, // ≥
-    { 23, 14, 29, 3, 17, 81, 64280 }, // ≪
-    { 23, 14, 29, 3, 17, 81, 64361 }, // ≫
-    { 19, 16, 29, 5, 18, 76, 64442 }, // ⊃
-    { 19, 26, 29, 5, 23, 124, 64518 }, // ⊄
-    { 19, 26, 29, 5, 23, 124, 64642 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 64766 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 64866 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 64966 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 65082 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 65198 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 65314 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 65430 }, // ⊥
-    { 6, 5, 18, 6, 10, 8, 65520 }, // ⋅
-    { 25, 5, 29, 2, 10, 32, 65528 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 65560 }, // �
+    { 14, 14, 18, 2, 17, 49, 2048 }, // >
+    { 10, 22, 12, 2, 21, 55, 2097 }, // ?
+    { 27, 26, 28, 1, 20, 176, 2152 }, // @
+    { 22, 21, 21, -2, 21, 116, 2328 }, // A
+    { 18, 22, 18, -1, 21, 99, 2444 }, // B
+    { 18, 22, 19, 1, 21, 99, 2543 }, // C
+    { 21, 22, 21, -1, 21, 116, 2642 }, // D
+    { 19, 21, 18, -1, 21, 100, 2758 }, // E
+    { 18, 21, 16, -1, 21, 95, 2858 }, // F
+    { 19, 22, 21, 1, 21, 105, 2953 }, // G
+    { 25, 21, 23, -1, 21, 132, 3058 }, // H
+    { 13, 21, 11, -1, 21, 69, 3190 }, // I
+    { 17, 27, 10, -5, 21, 115, 3259 }, // J
+    { 23, 22, 20, -1, 21, 127, 3374 }, // K
+    { 17, 21, 17, -1, 21, 90, 3501 }, // L
+    { 28, 21, 26, -2, 21, 147, 3591 }, // M
+    { 25, 22, 22, -1, 21, 138, 3738 }, // N
+    { 20, 22, 21, 1, 21, 110, 3876 }, // O
+    { 18, 21, 17, -1, 21, 95, 3986 }, // P
+    { 24, 28, 21, 1, 21, 168, 4096 }, // Q
+    { 19, 22, 19, -1, 21, 105, 4264 }, // R
+    { 15, 22, 15, 0, 21, 83, 4369 }, // S
+    { 18, 21, 19, 2, 21, 95, 4452 }, // T
+    { 22, 22, 22, 2, 21, 121, 4547 }, // U
+    { 21, 22, 21, 2, 21, 116, 4668 }, // V
+    { 30, 22, 30, 2, 21, 165, 4784 }, // W
+    { 24, 21, 19, -3, 21, 126, 4949 }, // X
+    { 20, 21, 19, 1, 21, 105, 5075 }, // Y
+    { 18, 22, 17, -1, 21, 99, 5180 }, // Z
+    { 12, 28, 9, -1, 23, 84, 5279 }, // [
+    { 12, 23, 14, 1, 21, 69, 5363 }, // <backslash>
+    { 12, 28, 9, -1, 23, 84, 5432 }, // ]
+    { 14, 14, 18, 2, 19, 49, 5516 }, // ^
+    { 15, 3, 15, 0, -1, 12, 5565 }, // _
+    { 6, 8, 18, 6, 24, 12, 5577 }, // `
+    { 16, 17, 17, 1, 16, 68, 5589 }, // a
+    { 15, 24, 16, 0, 23, 90, 5657 }, // b
+    { 12, 17, 13, 1, 16, 51, 5747 }, // c
+    { 16, 24, 17, 1, 23, 96, 5798 }, // d
+    { 12, 17, 14, 1, 16, 51, 5894 }, // e
+    { 20, 30, 12, -5, 23, 150, 5945 }, // f
+    { 19, 23, 14, -3, 16, 110, 6144 }, // g
+    { 17, 24, 17, 0, 23, 102, 6254 }, // h
+    { 9, 24, 9, 1, 23, 54, 6356 }, // i
+    { 15, 30, 8, -6, 23, 113, 6410 }, // j
+    { 14, 24, 15, 1, 23, 84, 6523 }, // k
+    { 8, 24, 9, 1, 23, 48, 6607 }, // l
+    { 24, 17, 26, 1, 16, 102, 6655 }, // m
+    { 16, 17, 18, 1, 16, 68, 6757 }, // n
+    { 14, 17, 16, 1, 16, 60, 6825 }, // o
+    { 18, 23, 17, -2, 16, 104, 6885 }, // p
+    { 15, 23, 16, 1, 16, 87, 6989 }, // q
+    { 12, 16, 12, 1, 16, 48, 7076 }, // r
+    { 12, 17, 12, 0, 16, 51, 7124 }, // s
+    { 12, 20, 11, 0, 19, 60, 7175 }, // t
+    { 16, 17, 18, 1, 16, 68, 7235 }, // u
+    { 15, 17, 15, 0, 16, 64, 7303 }, // v
+    { 22, 17, 22, 0, 16, 94, 7367 }, // w
+    { 18, 17, 16, -1, 16, 77, 7461 }, // x
+    { 18, 23, 16, -3, 16, 104, 7538 }, // y
+    { 14, 17, 14, 0, 16, 60, 7642 }, // z
+    { 12, 29, 11, 1, 24, 87, 7702 }, // {
+    { 8, 27, 8, 0, 23, 54, 7789 }, // |
+    { 11, 29, 11, -1, 24, 80, 7843 }, // }
+    { 14, 6, 18, 2, 13, 21, 7923 }, // ~
+    { 0, 0, 6, 0, 0, 0, 7944 }, //  
+    { 9, 23, 9, -1, 16, 52, 7944 }, // ¡
+    { 14, 29, 18, 2, 23, 102, 7996 }, // ¢
+    { 19, 22, 18, -1, 21, 105, 8192 }, // £
+    { 18, 14, 18, 0, 17, 63, 8297 }, // ¤
+    { 19, 20, 18, 1, 20, 95, 8360 }, // ¥
+    { 8, 27, 8, 0, 23, 54, 8455 }, // ¦
+    { 13, 23, 14, 0, 20, 75, 8509 }, // §
+    { 10, 4, 18, 4, 22, 10, 8584 }, // ¨
+    { 22, 22, 23, 0, 21, 121, 8594 }, // ©
+    { 11, 14, 13, 1, 21, 39, 8715 }, // ª
+    { 14, 11, 15, 1, 13, 39, 8754 }, // «
+    { 13, 8, 18, 3, 14, 26, 8793 }, // ¬
+    { 9, 3, 11, 1, 9, 7, 8819 }, // ­
+    { 17, 16, 17, 0, 23, 68, 8826 }, // ®
+    { 10, 3, 18, 4, 21, 8, 8894 }, // ¯
+    { 11, 11, 15, 2, 21, 31, 8902 }, // °
+    { 13, 17, 18, 3, 17, 56, 8933 }, // ±
+    { 11, 14, 13, 1, 24, 39, 8989 }, // ²
+    { 10, 14, 13, 1, 24, 35, 9028 }, // ³
+    { 6, 7, 18, 6, 24, 11, 9063 }, // ´
+    { 19, 24, 17, -1, 16, 114, 9074 }, // µ
+    { 19, 26, 17, -1, 21, 124, 9188 }, // ¶
+    { 5, 5, 9, 2, 10, 7, 9312 }, // ·
+    { 6, 7, 18, 6, -1, 11, 9319 }, // ¸
+    { 8, 14, 13, 2, 24, 28, 9330 }, // ¹
+    { 11, 14, 13, 1, 21, 39, 9358 }, // º
+    { 14, 11, 15, 0, 13, 39, 9397 }, // »
+    { 28, 24, 31, 2, 22, 168, 9436 }, // ¼
+    { 28, 24, 31, 2, 22, 168, 9604 }, // ½
+    { 29, 24, 31, 1, 22, 174, 9772 }, // ¾
+    { 10, 22, 12, 0, 16, 55, 9946 }, // ¿
+    { 22, 28, 21, -2, 28, 154, 10001 }, // À
+    { 22, 28, 21, -2, 28, 154, 10240 }, // Á
+    { 22, 28, 21, -2, 28, 154, 10394 }, // Â
+    { 22, 28, 21, -2, 28, 154, 10548 }, // Ã
+    { 22, 27, 21, -2, 27, 149, 10702 }, // Ä
+    { 22, 29, 21, -2, 29, 160, 10851 }, // Å
+    { 29, 21, 26, -3, 21, 153, 11011 }, // Æ
+    { 18, 29, 19, 1, 21, 131, 11164 }, // Ç
+    { 19, 28, 18, -1, 28, 133, 11295 }, // È
+    { 19, 28, 18, -1, 28, 133, 11428 }, // É
+    { 19, 28, 18, -1, 28, 133, 11561 }, // Ê
+    { 19, 27, 18, -1, 27, 129, 11694 }, // Ë
+    { 13, 28, 11, -1, 28, 91, 11823 }, // Ì
+    { 14, 28, 11, -1, 28, 98, 11914 }, // Í
+    { 15, 28, 11, -1, 28, 105, 12012 }, // Î
+    { 15, 27, 11, -1, 27, 102, 12117 }, // Ï
+    { 21, 22, 21, -1, 21, 116, 12288 }, // Ð
+    { 25, 29, 22, -1, 28, 182, 12404 }, // Ñ
+    { 20, 29, 21, 1, 28, 145, 12586 }, // Ò
+    { 20, 29, 21, 1, 28, 145, 12731 }, // Ó
+    { 20, 29, 21, 1, 28, 145, 12876 }, // Ô
+    { 20, 29, 21, 1, 28, 145, 13021 }, // Õ
+    { 20, 28, 21, 1, 27, 140, 13166 }, // Ö
+    { 12, 12, 18, 3, 16, 36, 13306 }, // ×
+    { 23, 22, 21, -1, 21, 127, 13342 }, // Ø
+    { 22, 29, 22, 2, 28, 160, 13469 }, // Ù
+    { 22, 29, 22, 2, 28, 160, 13629 }, // Ú
+    { 22, 29, 22, 2, 28, 160, 13789 }, // Û
+    { 22, 28, 22, 2, 27, 154, 13949 }, // Ü
+    { 20, 28, 19, 1, 28, 140, 14103 }, // Ý
+    { 18, 21, 17, -1, 21, 95, 14336 }, // Þ
+    { 23, 30, 19, -5, 23, 173, 14431 }, // ß
+    { 16, 25, 17, 1, 24, 100, 14604 }, // à
+    { 16, 25, 17, 1, 24, 100, 14704 }, // á
+    { 16, 25, 17, 1, 24, 100, 14804 }, // â
+    { 16, 24, 17, 1, 23, 96, 14904 }, // ã
+    { 16, 23, 17, 1, 22, 92, 15000 }, // ä
+    { 16, 25, 17, 1, 24, 100, 15092 }, // å
+    { 21, 17, 22, 1, 16, 90, 15192 }, // æ
+    { 12, 24, 13, 1, 16, 72, 15282 }, // ç
+    { 12, 25, 14, 1, 24, 75, 15354 }, // è
+    { 13, 25, 14, 1, 24, 82, 15429 }, // é
+    { 13, 25, 14, 1, 24, 82, 15511 }, // ê
+    { 14, 23, 14, 1, 22, 81, 15593 }, // ë
+    { 8, 25, 10, 1, 24, 50, 15674 }, // ì
+    { 11, 25, 10, 1, 24, 69, 15724 }, // í
+    { 11, 25, 10, 1, 24, 69, 15793 }, // î
+    { 11, 23, 10, 1, 22, 64, 15862 }, // ï
+    { 15, 25, 16, 0, 24, 94, 15926 }, // ð
+    { 16, 24, 18, 1, 23, 96, 16020 }, // ñ
+    { 14, 25, 16, 1, 24, 88, 16116 }, // ò
+    { 14, 25, 16, 1, 24, 88, 16204 }, // ó
+    { 14, 25, 16, 1, 24, 88, 16292 }, // ô
+    { 15, 24, 16, 1, 23, 90, 16384 }, // õ
+    { 15, 23, 16, 1, 22, 87, 16474 }, // ö
+    { 13, 14, 18, 3, 17, 46, 16561 }, // ÷
+    { 19, 17, 16, -2, 16, 81, 16607 }, // ø
+    { 16, 25, 18, 1, 24, 100, 16688 }, // ù
+    { 16, 25, 18, 1, 24, 100, 16788 }, // ú
+    { 16, 25, 18, 1, 24, 100, 16888 }, // û
+    { 16, 23, 18, 1, 22, 92, 16988 }, // ü
+    { 18, 31, 16, -3, 24, 140, 17080 }, // ý
+    { 18, 30, 16, -3, 23, 135, 17220 }, // þ
+    { 18, 29, 16, -3, 22, 131, 17355 }, // ÿ
+    { 22, 26, 21, -2, 26, 143, 17486 }, // Ā
+    { 16, 22, 17, 1, 21, 88, 17629 }, // ā
+    { 22, 28, 21, -2, 28, 154, 17717 }, // Ă
+    { 16, 24, 17, 1, 23, 96, 17871 }, // ă
+    { 22, 28, 21, -2, 21, 154, 17967 }, // Ą
+    { 16, 23, 17, 1, 16, 92, 18121 }, // ą
+    { 18, 29, 19, 1, 28, 131, 18213 }, // Ć
+    { 13, 25, 13, 1, 24, 82, 18344 }, // ć
+    { 18, 29, 19, 1, 28, 131, 18432 }, // Ĉ
+    { 13, 25, 13, 1, 24, 82, 18563 }, // ĉ
+    { 18, 29, 19, 1, 28, 131, 18645 }, // Ċ
+    { 12, 23, 13, 1, 22, 69, 18776 }, // ċ
+    { 18, 29, 19, 1, 28, 131, 18845 }, // Č
+    { 14, 25, 13, 1, 24, 88, 18976 }, // č
+    { 21, 29, 21, -1, 28, 153, 19064 }, // Ď
+    { 21, 26, 18, 1, 25, 137, 19217 }, // ď
+    { 21, 22, 21, -1, 21, 116, 19354 }, // Đ
+    { 18, 24, 17, 1, 23, 108, 19470 }, // đ
+    { 19, 26, 18, -1, 26, 124, 19578 }, // Ē
+    { 13, 22, 14, 1, 21, 72, 19702 }, // ē
+    { 19, 28, 18, -1, 28, 133, 19774 }, // Ĕ
+    { 14, 24, 14, 1, 23, 84, 19907 }, // ĕ
+    { 19, 28, 18, -1, 28, 133, 19991 }, // Ė
+    { 12, 23, 14, 1, 22, 69, 20124 }, // ė
+    { 19, 28, 18, -1, 21, 133, 20193 }, // Ę
+    { 12, 23, 14, 1, 16, 69, 20326 }, // ę
+    { 19, 28, 18, -1, 28, 133, 20480 }, // Ě
+    { 14, 25, 14, 1, 24, 88, 20613 }, // ě
+    { 19, 29, 21, 1, 28, 138, 20701 }, // Ĝ
+    { 19, 31, 14, -3, 24, 148, 20839 }, // ĝ
+    { 19, 29, 21, 1, 28, 138, 20987 }, // Ğ
+    { 19, 30, 14, -3, 23, 143, 21125 }, // ğ
+    { 19, 29, 21, 1, 28, 138, 21268 }, // Ġ
+    { 19, 29, 14, -3, 22, 138, 21406 }, // ġ
+    { 19, 29, 21, 1, 21, 138, 21544 }, // Ģ
+    { 19, 32, 14, -3, 25, 152, 21682 }, // ģ
+    { 25, 28, 23, -1, 28, 175, 21834 }, // Ĥ
+    { 17, 31, 17, 0, 30, 132, 22009 }, // ĥ
+    { 25, 21, 23, -1, 21, 132, 22141 }, // Ħ
+    { 17, 24, 17, 0, 23, 102, 22273 }, // ħ
+    { 14, 28, 11, -1, 28, 98, 22375 }, // Ĩ
+    { 11, 24, 10, 1, 23, 66, 22528 }, // ĩ
+    { 14, 26, 11, -1, 26, 91, 22594 }, // Ī
+    { 11, 22, 10, 1, 21, 61, 22685 }, // ī
+    { 15, 28, 11, -1, 28, 105, 22746 }, // Ĭ
+    { 11, 24, 10, 1, 23, 66, 22851 }, // ĭ
+    { 13, 28, 11, -1, 21, 91, 22917 }, // Į
+    { 9, 30, 9, 1, 23, 68, 23008 }, // į
+    { 13, 28, 11, -1, 28, 91, 23076 }, // İ
+    { 8, 17, 9, 1, 16, 34, 23167 }, // ı
+    { 24, 27, 21, -1, 21, 162, 23201 }, // Ĳ
+    { 18, 30, 18, 1, 23, 135, 23363 }, // ĳ
+    { 19, 34, 10, -5, 28, 162, 23498 }, // Ĵ
+    { 17, 31, 8, -6, 24, 132, 23660 }, // ĵ
+    { 23, 29, 20, -1, 21, 167, 23792 }, // Ķ
+    { 14, 31, 15, 1, 23, 109, 23959 }, // ķ
+    { 15, 17, 16, 1, 16, 64, 24068 }, // ĸ
+    { 17, 28, 17, -1, 28, 119, 24132 }, // Ĺ
+    { 10, 31, 9, 1, 30, 78, 24251 }, // ĺ
+    { 17, 29, 17, -1, 21, 124, 24329 }, // Ļ
+    { 10, 31, 9, -1, 23, 78, 24453 }, // ļ
+    { 18, 23, 17, -1, 23, 104, 24576 }, // Ľ
+    { 13, 26, 10, 1, 25, 85, 24680 }, // ľ
+    { 18, 21, 17, -1, 21, 95, 24765 }, // Ŀ
+    { 12, 24, 12, 1, 23, 72, 24860 }, // ŀ
+    { 17, 21, 17, -1, 21, 90, 24932 }, // Ł
+    { 11, 24, 9, -1, 23, 66, 25022 }, // ł
+    { 25, 29, 22, -1, 28, 182, 25088 }, // Ń
+    { 16, 25, 18, 1, 24, 100, 25270 }, // ń
+    { 25, 29, 22, -1, 21, 182, 25370 }, // Ņ
+    { 16, 24, 18, 1, 16, 96, 25552 }, // ņ
+    { 25, 29, 22, -1, 28, 182, 25648 }, // Ň
+    { 16, 25, 18, 1, 24, 100, 25830 }, // ň
+    { 21, 23, 24, 2, 22, 121, 25930 }, // ŉ
+    { 25, 27, 22, -1, 21, 169, 26051 }, // Ŋ
+    { 15, 23, 17, 1, 16, 87, 26220 }, // ŋ
+    { 20, 27, 21, 1, 26, 135, 26307 }, // Ō
+    { 15, 22, 16, 1, 21, 83, 26442 }, // ō
+    { 20, 29, 21, 1, 28, 145, 26624 }, // Ŏ
+    { 15, 24, 16, 1, 23, 90, 26769 }, // ŏ
+    { 21, 30, 21, 1, 29, 158, 26859 }, // Ő
+    { 16, 25, 16, 1, 24, 100, 27017 }, // ő
+    { 27, 22, 28, 1, 21, 149, 27117 }, // Œ
+    { 22, 17, 24, 1, 16, 94, 27266 }, // œ
+    { 19, 29, 19, -1, 28, 138, 27360 }, // Ŕ
+    { 13, 24, 12, 1, 24, 78, 27498 }, // ŕ
+    { 19, 29, 19, -1, 21, 138, 27576 }, // Ŗ
+    { 14, 24, 12, -1, 16, 84, 27714 }, // ŗ
+    { 19, 29, 19, -1, 28, 138, 27798 }, // Ř
+    { 14, 24, 12, 1, 24, 84, 27936 }, // ř
+    { 15, 29, 15, 0, 28, 109, 28020 }, // Ś
+    { 13, 25, 12, 0, 24, 82, 28129 }, // ś
+    { 15, 29, 15, 0, 28, 109, 28211 }, // Ŝ
+    { 13, 25, 12, 0, 24, 82, 28320 }, // ŝ
+    { 15, 29, 15, 0, 21, 109, 28402 }, // Ş
+    { 12, 24, 12, 0, 16, 72, 28511 }, // ş
+    { 16, 29, 15, 0, 28, 116, 28672 }, // Š
+    { 14, 25, 12, 0, 24, 88, 28788 }, // š
+    { 18, 29, 19, 2, 21, 131, 28876 }, // Ţ
+    { 12, 27, 11, 0, 19, 81, 29007 }, // ţ
+    { 18, 28, 19, 2, 28, 126, 29088 }, // Ť
+    { 13, 25, 11, 0, 24, 82, 29214 }, // ť
+    { 18, 21, 19, 2, 21, 95, 29296 }, // Ŧ
+    { 12, 20, 11, 0, 19, 60, 29391 }, // ŧ
+    { 22, 29, 22, 2, 28, 160, 29451 }, // Ũ
+    { 16, 24, 18, 1, 23, 96, 29611 }, // ũ
+    { 22, 27, 22, 2, 26, 149, 29707 }, // Ū
+    { 16, 22, 18, 1, 21, 88, 29856 }, // ū
+    { 22, 29, 22, 2, 28, 160, 29944 }, // Ŭ
+    { 16, 24, 18, 1, 23, 96, 30104 }, // ŭ
+    { 22, 30, 22, 2, 29, 165, 30200 }, // Ů
+    { 16, 25, 18, 1, 24, 100, 30365 }, // ů
+    { 22, 30, 22, 2, 29, 165, 30465 }, // Ű
+    { 16, 25, 18, 1, 24, 100, 30720 }, // ű
+    { 22, 28, 22, 2, 21, 154, 30820 }, // Ų
+    { 16, 23, 18, 1, 16, 92, 30974 }, // ų
+    { 30, 29, 30, 2, 28, 218, 31066 }, // Ŵ
+    { 22, 25, 22, 0, 24, 138, 31284 }, // ŵ
+    { 20, 28, 19, 1, 28, 140, 31422 }, // Ŷ
+    { 18, 31, 16, -3, 24, 140, 31562 }, // ŷ
+    { 20, 27, 19, 1, 27, 135, 31702 }, // Ÿ
+    { 18, 29, 17, -1, 28, 131, 31837 }, // Ź
+    { 14, 25, 14, 0, 24, 88, 31968 }, // ź
+    { 18, 29, 17, -1, 28, 131, 32056 }, // Ż
+    { 14, 23, 14, 0, 22, 81, 32187 }, // ż
+    { 18, 29, 17, -1, 28, 131, 32268 }, // Ž
+    { 14, 25, 14, 0, 24, 88, 32399 }, // ž
+    { 20, 30, 12, -5, 23, 150, 32487 }, // ſ
+    { 6, 8, 0, -4, 24, 12, 32637 }, // ̀
+    { 6, 7, 0, -2, 24, 11, 32649 }, // ́
+    { 10, 7, 0, -6, 24, 18, 32660 }, // ̂
+    { 10, 6, 0, -5, 23, 15, 32678 }, // ̃
+    { 10, 3, 0, -5, 21, 8, 32693 }, // ̄
+    { 10, 6, 0, -5, 23, 15, 32701 }, // ̆
+    { 4, 4, 0, -2, 22, 4, 32716 }, // ̇
+    { 10, 4, 0, -5, 22, 10, 32720 }, // ̈
+    { 8, 9, 0, -4, 26, 18, 32730 }, // ̉
+    { 8, 8, 0, -4, 24, 16, 32748 }, // ̊
+    { 11, 7, 0, -5, 24, 20, 32768 }, // ̋
+    { 10, 7, 0, -4, 24, 18, 32788 }, // ̌
+    { 9, 8, 0, -6, 24, 18, 32806 }, // ̏
+    { 10, 6, 0, -5, 23, 15, 32824 }, // ̑
+    { 6, 9, 0, -3, 25, 14, 32839 }, // ̒
+    { 7, 9, 0, -3, 26, 16, 32853 }, // ̓
+    { 6, 9, 0, -4, 26, 14, 32869 }, // ̔
+    { 4, 8, 0, -2, 25, 8, 32883 }, // ̕
+    { 6, 7, 0, -3, 19, 11, 32891 }, // ̛
+    { 4, 5, 0, -2, -2, 5, 32902 }, // ̣
+    { 10, 5, 0, -5, -2, 13, 32907 }, // ̤
+    { 8, 7, 0, -4, -1, 14, 32920 }, // ̥
+    { 6, 7, 0, -3, -1, 11, 32934 }, // ̦
+    { 6, 7, 0, -3, -1, 11, 32945 }, // ̧
+    { 6, 8, 0, -3, 1, 12, 32956 }, // ̨
+    { 5, 7, 8, -1, -1, 9, 32968 }, // ̩
+    { 11, 6, 0, -6, -2, 17, 32977 }, // ̭
+    { 10, 6, 0, -5, -1, 15, 32994 }, // ̮
+    { 10, 5, 0, -5, -2, 13, 33009 }, // ̰
+    { 10, 3, 0, -5, -3, 8, 33022 }, // ̱
+    { 10, 6, 0, -5, 23, 15, 33030 }, // ͂
+    { 11, 11, 0, -6, 29, 31, 33045 }, // ̈́
+    { 6, 5, 0, -2, -2, 8, 33076 }, // ͅ
+    { 19, 28, 18, -1, 28, 133, 33084 }, // Ѐ
+    { 19, 27, 18, -1, 27, 129, 33217 }, // Ё
+    { 18, 27, 22, 2, 21, 122, 33346 }, // Ђ
+    { 19, 28, 16, -1, 28, 133, 33468 }, // Ѓ
+    { 18, 22, 19, 1, 21, 99, 33601 }, // Є
+    { 15, 22, 15, 0, 21, 83, 33700 }, // Ѕ
+    { 13, 21, 11, -1, 21, 69, 33783 }, // І
+    { 15, 27, 11, -1, 27, 102, 33852 }, // Ї
+    { 17, 27, 10, -5, 21, 115, 33954 }, // Ј
+    { 27, 22, 26, -2, 21, 149, 34069 }, // Љ
+    { 27, 22, 27, -1, 21, 149, 34218 }, // Њ
+    { 19, 21, 23, 2, 21, 100, 34367 }, // Ћ
+    { 22, 29, 20, -1, 28, 160, 34467 }, // Ќ
+    { 25, 28, 23, -1, 28, 175, 34627 }, // Ѝ
+    { 20, 30, 18, 1, 29, 150, 34816 }, // Ў
+    { 24, 28, 22, -1, 21, 168, 34966 }, // Џ
+    { 22, 21, 21, -2, 21, 116, 35134 }, // А
+    { 18, 22, 17, -1, 21, 99, 35250 }, // Б
+    { 18, 22, 18, -1, 21, 99, 35349 }, // В
+    { 19, 21, 16, -1, 21, 100, 35448 }, // Г
+    { 24, 27, 21, -2, 21, 162, 35548 }, // Д
+    { 19, 21, 18, -1, 21, 100, 35710 }, // Е
+    { 31, 22, 28, -2, 21, 171, 35810 }, // Ж
+    { 15, 22, 16, 0, 21, 83, 35981 }, // З
+    { 25, 21, 23, -1, 21, 132, 36064 }, // И
+    { 25, 29, 23, -1, 29, 182, 36196 }, // Й
+    { 22, 22, 20, -1, 21, 121, 36378 }, // К
+    { 23, 22, 20, -2, 21, 127, 36499 }, // Л
+    { 28, 21, 26, -2, 21, 147, 36626 }, // М
+    { 25, 21, 23, -1, 21, 132, 36864 }, // Н
+    { 20, 22, 21, 1, 21, 110, 36996 }, // О
+    { 24, 21, 22, -1, 21, 126, 37106 }, // П
+    { 18, 21, 17, -1, 21, 95, 37232 }, // Р
+    { 18, 22, 19, 1, 21, 99, 37327 }, // С
+    { 18, 21, 19, 2, 21, 95, 37426 }, // Т
+    { 20, 22, 18, 1, 21, 110, 37521 }, // У
+    { 21, 22, 21, 0, 21, 116, 37631 }, // Ф
+    { 24, 21, 19, -3, 21, 126, 37747 }, // Х
+    { 24, 27, 22, -1, 21, 162, 37873 }, // Ц
+    { 20, 21, 20, 1, 21, 105, 38035 }, // Ч
+    { 31, 21, 29, -1, 21, 163, 38140 }, // Ш
+    { 31, 27, 29, -1, 21, 210, 38303 }, // Щ
+    { 18, 22, 20, 2, 21, 99, 38513 }, // Ъ
+    { 29, 22, 26, -1, 21, 160, 38612 }, // Ы
+    { 17, 22, 17, -1, 21, 94, 38772 }, // Ь
+    { 17, 22, 18, 0, 21, 94, 38912 }, // Э
+    { 29, 22, 29, -1, 21, 160, 39006 }, // Ю
+    { 21, 22, 19, -2, 21, 116, 39166 }, // Я
+    { 16, 17, 17, 1, 16, 68, 39282 }, // а
+    { 16, 24, 16, 1, 23, 96, 39350 }, // б
+    { 13, 17, 15, 1, 16, 56, 39446 }, // в
+    { 12, 17, 13, 0, 16, 51, 39502 }, // г
+    { 14, 24, 16, 1, 23, 84, 39553 }, // д
+    { 12, 17, 14, 1, 16, 51, 39637 }, // е
+    { 26, 17, 26, 0, 16, 111, 39688 }, // ж
+    { 12, 17, 13, 0, 16, 51, 39799 }, // з
+    { 16, 17, 18, 1, 16, 68, 39850 }, // и
+    { 16, 25, 18, 1, 24, 100, 39918 }, // й
+    { 15, 17, 16, 1, 16, 64, 40018 }, // к
+    { 18, 17, 18, -1, 16, 77, 40082 }, // л
+    { 22, 17, 22, 0, 16, 94, 40159 }, // м
+    { 16, 17, 18, 1, 16, 68, 40253 }, // н
+    { 14, 17, 16, 1, 16, 60, 40321 }, // о
+    { 16, 17, 18, 1, 16, 68, 40381 }, // п
+    { 18, 23, 17, -2, 16, 104, 40449 }, // р
+    { 12, 17, 13, 1, 16, 51, 40553 }, // с
+    { 24, 17, 26, 1, 16, 102, 40604 }, // т
+    { 18, 23, 16, -3, 16, 104, 40706 }, // у
+    { 18, 30, 20, 1, 23, 135, 40810 }, // ф
+    { 18, 17, 16, -1, 16, 77, 40960 }, // х
+    { 17, 22, 18, 1, 16, 94, 41037 }, // ц
+    { 16, 17, 17, 1, 16, 68, 41131 }, // ч
+    { 23, 17, 24, 1, 16, 98, 41199 }, // ш
+    { 23, 22, 25, 1, 16, 127, 41297 }, // щ
+    { 14, 17, 15, 1, 16, 60, 41424 }, // ъ
+    { 20, 17, 22, 1, 16, 85, 41484 }, // ы
+    { 13, 17, 14, 0, 16, 56, 41569 }, // ь
+    { 13, 17, 14, 0, 16, 56, 41625 }, // э
+    { 21, 17, 23, 1, 16, 90, 41681 }, // ю
+    { 16, 16, 16, -1, 15, 64, 41771 }, // я
+    { 12, 25, 14, 1, 24, 75, 41835 }, // ѐ
+    { 14, 23, 14, 1, 22, 81, 41910 }, // ё
+    { 15, 30, 16, 0, 23, 113, 41991 }, // ђ
+    { 13, 25, 13, 0, 24, 82, 42104 }, // ѓ
+    { 12, 17, 14, 1, 16, 51, 42186 }, // є
+    { 12, 17, 12, 0, 16, 51, 42237 }, // ѕ
+    { 9, 24, 9, 1, 23, 54, 42288 }, // і
+    { 11, 23, 9, 1, 22, 64, 42342 }, // ї
+    { 15, 30, 8, -6, 23, 113, 42406 }, // ј
+    { 22, 17, 21, -1, 16, 94, 42519 }, // љ
+    { 19, 17, 21, 1, 16, 81, 42613 }, // њ
+    { 17, 24, 17, 0, 23, 102, 42694 }, // ћ
+    { 15, 25, 16, 1, 24, 94, 42796 }, // ќ
+    { 16, 25, 18, 1, 24, 100, 42890 }, // ѝ
+    { 18, 31, 16, -3, 24, 140, 43008 }, // ў
+    { 16, 22, 18, 1, 16, 88, 43148 }, // џ
+    { 18, 24, 19, 1, 23, 108, 43236 }, // Ѣ
+    { 20, 17, 21, 1, 16, 85, 43344 }, // ѣ
+    { 20, 22, 21, 1, 21, 110, 43429 }, // Ѳ
+    { 14, 17, 16, 1, 16, 60, 43539 }, // ѳ
+    { 21, 22, 21, 2, 21, 116, 43599 }, // Ѵ
+    { 18, 17, 16, 0, 16, 77, 43715 }, // ѵ
+    { 25, 35, 23, -1, 29, 219, 43792 }, // Ҋ
+    { 17, 30, 18, 1, 24, 128, 44011 }, // ҋ
+    { 17, 22, 17, -1, 21, 94, 44139 }, // Ҍ
+    { 13, 22, 14, 1, 21, 72, 44233 }, // ҍ
+    { 18, 21, 17, -1, 21, 95, 44305 }, // Ҏ
+    { 18, 23, 17, -2, 16, 104, 44400 }, // ҏ
+    { 19, 24, 16, -1, 24, 114, 44504 }, // Ґ
+    { 14, 20, 13, 0, 19, 70, 44618 }, // ґ
+    { 19, 21, 16, -1, 21, 100, 44688 }, // Ғ
+    { 12, 17, 13, 0, 16, 51, 44788 }, // ғ
+    { 18, 27, 17, -1, 21, 122, 44839 }, // Ҕ
+    { 14, 22, 15, 1, 15, 77, 44961 }, // ҕ
+    { 31, 27, 28, -2, 21, 210, 45056 }, // Җ
+    { 26, 22, 26, 0, 16, 143, 45266 }, // җ
+    { 15, 27, 16, 0, 21, 102, 45409 }, // Ҙ
+    { 12, 22, 13, 0, 16, 66, 45511 }, // ҙ
+    { 22, 27, 20, -1, 21, 149, 45577 }, // Қ
+    { 15, 22, 16, 1, 16, 83, 45726 }, // қ
+    { 23, 22, 21, -1, 21, 127, 45809 }, // Ҝ
+    { 17, 17, 18, 1, 16, 73, 45936 }, // ҝ
+    { 22, 22, 20, -1, 21, 121, 46009 }, // Ҟ
+    { 15, 22, 16, 1, 21, 83, 46130 }, // ҟ
+    { 22, 22, 23, 2, 21, 121, 46213 }, // Ҡ
+    { 17, 17, 18, 1, 16, 73, 46334 }, // ҡ
+    { 25, 27, 23, -1, 21, 169, 46407 }, // Ң
+    { 17, 22, 18, 1, 16, 94, 46576 }, // ң
+    { 29, 21, 27, -1, 21, 153, 46670 }, // Ҥ
+    { 20, 17, 21, 1, 16, 85, 46823 }, // ҥ
+    { 30, 27, 30, -1, 21, 203, 47104 }, // Ҧ
+    { 23, 23, 24, 1, 16, 133, 47307 }, // ҧ
+    { 22, 22, 23, 1, 21, 121, 47440 }, // Ҩ
+    { 17, 17, 19, 1, 16, 73, 47561 }, // ҩ
+    { 18, 27, 19, 1, 21, 122, 47634 }, // Ҫ
+    { 12, 22, 13, 1, 16, 66, 47756 }, // ҫ
+    { 18, 27, 19, 2, 21, 122, 47822 }, // Ҭ
+    { 25, 22, 26, 1, 16, 138, 47944 }, // ҭ
+    { 20, 21, 19, 1, 21, 105, 48082 }, // Ү
+    { 15, 23, 15, 0, 16, 87, 48187 }, // ү
+    { 20, 21, 19, 1, 21, 105, 48274 }, // Ұ
+    { 15, 23, 15, 0, 16, 87, 48379 }, // ұ
+    { 24, 27, 19, -3, 21, 162, 48466 }, // Ҳ
+    { 18, 22, 16, -1, 16, 99, 48628 }, // ҳ
+    { 25, 27, 25, 1, 21, 169, 48727 }, // Ҵ
+    { 17, 27, 18, 1, 21, 115, 48896 }, // ҵ
+    { 20, 27, 20, 1, 21, 135, 49011 }, // Ҷ
+    { 16, 22, 17, 1, 16, 88, 49152 }, // ҷ
+    { 20, 21, 20, 1, 21, 105, 49240 }, // Ҹ
+    { 16, 17, 17, 1, 16, 68, 49345 }, // ҹ
+    { 19, 21, 19, -1, 21, 100, 49413 }, // Һ
+    { 17, 24, 17, 0, 23, 102, 49513 }, // һ
+    { 21, 22, 23, 1, 21, 116, 49615 }, // Ҽ
+    { 16, 17, 17, 0, 16, 68, 49731 }, // ҽ
+    { 21, 28, 23, 1, 21, 147, 49799 }, // Ҿ
+    { 16, 22, 17, 0, 16, 88, 49946 }, // ҿ
+    { 13, 21, 11, -1, 21, 69, 50034 }, // Ӏ
+    { 31, 30, 28, -2, 29, 233, 50103 }, // Ӂ
+    { 26, 25, 26, 0, 24, 163, 50336 }, // ӂ
+    { 22, 27, 20, -1, 21, 149, 50499 }, // Ӄ
+    { 15, 23, 16, 1, 16, 87, 50648 }, // ӄ
+    { 23, 27, 20, -2, 21, 156, 50735 }, // Ӆ
+    { 18, 22, 18, -1, 16, 99, 50891 }, // ӆ
+    { 25, 27, 23, -1, 21, 169, 50990 }, // Ӈ
+    { 15, 23, 17, 1, 16, 87, 51200 }, // ӈ
+    { 25, 27, 23, -1, 21, 169, 51287 }, // Ӊ
+    { 17, 22, 18, 1, 16, 94, 51456 }, // ӊ
+    { 20, 27, 20, 1, 21, 135, 51550 }, // Ӌ
+    { 15, 22, 16, 1, 16, 83, 51685 }, // ӌ
+    { 28, 27, 26, -2, 21, 189, 51768 }, // Ӎ
+    { 22, 22, 22, 0, 16, 121, 51957 }, // ӎ
+    { 13, 23, 9, -1, 23, 75, 52078 }, // ӏ
+    { 22, 29, 21, -2, 29, 160, 52153 }, // Ӑ
+    { 16, 25, 17, 1, 24, 100, 52313 }, // ӑ
+    { 22, 27, 21, -2, 27, 149, 52413 }, // Ӓ
+    { 16, 23, 17, 1, 22, 92, 52562 }, // ӓ
+    { 29, 21, 26, -3, 21, 153, 52654 }, // Ӕ
+    { 21, 17, 22, 1, 16, 90, 52807 }, // ӕ
+    { 19, 29, 18, -1, 29, 138, 52897 }, // Ӗ
+    { 14, 25, 14, 1, 24, 88, 53035 }, // ӗ
+    { 18, 22, 18, 0, 21, 99, 53123 }, // Ә
+    { 13, 17, 14, 0, 16, 56, 53248 }, // ә
+    { 18, 28, 18, 0, 27, 126, 53304 }, // Ӛ
+    { 14, 23, 14, 0, 22, 81, 53430 }, // ӛ
+    { 31, 28, 28, -2, 27, 217, 53511 }, // Ӝ
+    { 26, 23, 26, 0, 22, 150, 53728 }, // ӝ
+    { 15, 28, 16, 0, 27, 105, 53878 }, // Ӟ
+    { 14, 23, 13, 0, 22, 81, 53983 }, // ӟ
+    { 18, 22, 17, -1, 21, 99, 54064 }, // Ӡ
+    { 17, 22, 15, -2, 15, 94, 54163 }, // ӡ
+    { 25, 26, 23, -1, 26, 163, 54257 }, // Ӣ
+    { 16, 22, 18, 1, 21, 88, 54420 }, // ӣ
+    { 25, 27, 23, -1, 27, 169, 54508 }, // Ӥ
+    { 16, 23, 18, 1, 22, 92, 54677 }, // ӥ
+    { 20, 28, 21, 1, 27, 140, 54769 }, // Ӧ
+    { 15, 23, 16, 1, 22, 87, 54909 }, // ӧ
+    { 20, 22, 21, 1, 21, 110, 54996 }, // Ө
+    { 14, 17, 16, 1, 16, 60, 55106 }, // ө
+    { 20, 28, 21, 1, 27, 140, 55296 }, // Ӫ
+    { 15, 23, 16, 1, 22, 87, 55436 }, // ӫ
+    { 17, 28, 18, 0, 27, 119, 55523 }, // Ӭ
+    { 13, 23, 14, 0, 22, 75, 55642 }, // ӭ
+    { 20, 27, 18, 1, 26, 135, 55717 }, // Ӯ
+    { 18, 28, 16, -3, 21, 126, 55852 }, // ӯ
+    { 20, 28, 18, 1, 27, 140, 55978 }, // Ӱ
+    { 18, 29, 16, -3, 22, 131, 56118 }, // ӱ
+    { 20, 30, 18, 1, 29, 150, 56249 }, // Ӳ
+    { 18, 31, 16, -3, 24, 140, 56399 }, // ӳ
+    { 20, 27, 20, 1, 27, 135, 56539 }, // Ӵ
+    { 16, 23, 17, 1, 22, 92, 56674 }, // ӵ
+    { 19, 27, 16, -1, 21, 129, 56766 }, // Ӷ
+    { 12, 22, 13, 0, 16, 66, 56895 }, // ӷ
+    { 29, 28, 26, -1, 27, 203, 56961 }, // Ӹ
+    { 20, 23, 22, 1, 22, 115, 57164 }, // ӹ
+    { 19, 27, 16, -1, 21, 129, 57344 }, // Ӻ
+    { 12, 22, 13, 0, 16, 66, 57473 }, // ӻ
+    { 24, 27, 19, -3, 21, 162, 57539 }, // Ӽ
+    { 18, 23, 16, -1, 16, 104, 57701 }, // ӽ
+    { 24, 21, 19, -3, 21, 126, 57805 }, // Ӿ
+    { 18, 17, 16, -1, 16, 77, 57931 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 58008 }, //  
+    { 0, 0, 29, 0, 0, 0, 58008 }, //  
+    { 0, 0, 15, 0, 0, 0, 58008 }, //  
+    { 0, 0, 29, 0, 0, 0, 58008 }, //  
+    { 0, 0, 10, 0, 0, 0, 58008 }, //  
+    { 0, 0, 7, 0, 0, 0, 58008 }, //  
+    { 0, 0, 5, 0, 0, 0, 58008 }, //  
+    { 0, 0, 18, 0, 0, 0, 58008 }, //  
+    { 0, 0, 8, 0, 0, 0, 58008 }, //  
+    { 0, 0, 6, 0, 0, 0, 58008 }, //  
+    { 0, 0, 1, 0, 0, 0, 58008 }, //  
+    { 0, 0, 0, 0, 0, 0, 58008 }, // ​
+    { 2, 24, 0, -1, 17, 12, 58008 }, // ‌
+    { 6, 26, 0, -3, 19, 39, 58020 }, // ‍
+    { 10, 28, 0, -5, 21, 70, 58059 }, // ‎
+    { 10, 28, 0, -5, 21, 70, 58129 }, // ‏
+    { 9, 3, 11, 1, 9, 7, 58199 }, // ‐
+    { 9, 3, 11, 1, 9, 7, 58206 }, // ‑
+    { 14, 3, 18, 2, 11, 11, 58213 }, // ‒
+    { 15, 3, 15, 0, 9, 12, 58224 }, // –
+    { 29, 3, 29, 0, 9, 22, 58236 }, // —
+    { 29, 3, 29, 0, 9, 22, 58258 }, // ―
+    { 10, 30, 15, 2, 23, 75, 58280 }, // ‖
+    { 15, 7, 15, 0, -1, 27, 58355 }, // ‗
+    { 7, 10, 9, 2, 22, 18, 58382 }, // ‘
+    { 6, 9, 9, 2, 22, 14, 58400 }, // ’
+    { 6, 10, 9, 1, 4, 15, 58414 }, // ‚
+    { 5, 10, 7, 1, 22, 13, 58429 }, // ‛
+    { 12, 10, 15, 2, 22, 30, 58442 }, // “
+    { 12, 10, 15, 2, 22, 30, 58472 }, // ”
+    { 12, 10, 15, 1, 4, 30, 58502 }, // „
+    { 11, 10, 13, 1, 22, 28, 58532 }, // ‟
+    { 13, 19, 14, 1, 21, 62, 58560 }, // †
+    { 14, 23, 14, 0, 21, 81, 58622 }, // ‡
+    { 7, 7, 9, 1, 11, 13, 58703 }, // •
+    { 10, 10, 18, 4, 15, 25, 58716 }, // ‣
+    { 6, 5, 8, 1, 4, 8, 58741 }, // ․
+    { 12, 5, 15, 1, 4, 15, 58749 }, // ‥
+    { 24, 5, 29, 2, 4, 30, 58764 }, // …
+    { 6, 4, 8, 1, 10, 6, 58794 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 58800 }, //  
+    { 0, 0, 0, 0, 0, 0, 58800 }, //  
+    { 10, 28, 0, -5, 21, 70, 58800 }, // ‪
+    { 10, 28, 0, -5, 21, 70, 58870 }, // ‫
+    { 10, 27, 0, -5, 20, 68, 58940 }, // ‬
+    { 12, 28, 0, -6, 21, 84, 59008 }, // ‭
+    { 12, 28, 0, -6, 21, 84, 59092 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 59176 }, //  
+    { 36, 24, 40, 2, 22, 216, 59176 }, // ‰
+    { 6, 10, 8, 1, 21, 15, 59392 }, // ′
+    { 12, 10, 13, 1, 21, 30, 59407 }, // ″
+    { 17, 10, 19, 1, 21, 43, 59437 }, // ‴
+    { 6, 10, 8, 1, 21, 15, 59480 }, // ‵
+    { 12, 10, 14, 1, 21, 30, 59495 }, // ‶
+    { 19, 10, 20, 1, 21, 48, 59525 }, // ‷
+    { 13, 6, 14, 1, 0, 20, 59573 }, // ‸
+    { 8, 11, 9, 1, 13, 22, 59593 }, // ‹
+    { 9, 11, 9, 0, 13, 25, 59615 }, // ›
+    { 18, 20, 18, 0, 19, 90, 59640 }, // ※
+    { 16, 23, 17, 1, 22, 92, 59730 }, // ‼
+    { 15, 3, 15, 0, 24, 12, 59822 }, // ‾
+    { 7, 3, 9, 1, 9, 6, 59834 }, // ⁃
+    { 18, 24, 7, -6, 22, 108, 59840 }, // ⁄
+    { 21, 22, 24, 2, 21, 116, 59948 }, // ⁇
+    { 19, 23, 20, 2, 22, 110, 60064 }, // ⁈
+    { 20, 23, 21, 1, 22, 115, 60174 }, // ⁉
+    { 17, 5, 29, 6, 11, 22, 60289 }, // ⁓
+    { 23, 10, 25, 1, 21, 58, 60311 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 60369 }, //  
+    { 0, 0, 0, 0, 0, 0, 60369 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 60369 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 60369 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 60369 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 60369 }, // ⁤
+    { 11, 14, 13, 1, 24, 39, 60369 }, // ⁰
+    { 12, 14, 13, 0, 24, 42, 60408 }, // ⁴
+    { 11, 14, 13, 1, 24, 39, 60450 }, // ⁵
+    { 12, 14, 13, 1, 24, 42, 60489 }, // ⁶
+    { 10, 14, 13, 3, 24, 35, 60531 }, // ⁷
+    { 11, 14, 13, 1, 24, 39, 60566 }, // ⁸
+    { 12, 14, 13, 0, 24, 42, 60605 }, // ⁹
+    { 11, 11, 16, 3, 21, 31, 60647 }, // ⁿ
+    { 11, 15, 13, 1, 10, 42, 60678 }, // ₀
+    { 8, 14, 13, 2, 10, 28, 60720 }, // ₁
+    { 11, 14, 13, 1, 10, 39, 60748 }, // ₂
+    { 10, 15, 13, 1, 10, 38, 60787 }, // ₃
+    { 12, 14, 13, 0, 10, 42, 60825 }, // ₄
+    { 11, 14, 13, 1, 9, 39, 60867 }, // ₅
+    { 12, 15, 13, 1, 10, 45, 60906 }, // ₆
+    { 10, 14, 13, 3, 9, 35, 60951 }, // ₇
+    { 11, 15, 13, 1, 10, 42, 60986 }, // ₈
+    { 12, 15, 13, 0, 10, 45, 61028 }, // ₉
+    { 18, 20, 18, 0, 20, 90, 61073 }, // ₣
+    { 19, 22, 18, -1, 21, 105, 61163 }, // ₤
+    { 35, 22, 36, 0, 21, 193, 61440 }, // ₧
+    { 20, 22, 18, -1, 21, 110, 61633 }, // €
+    { 17, 12, 29, 6, 16, 51, 61743 }, // ←
+    { 13, 20, 29, 8, 20, 65, 61794 }, // ↑
+    { 17, 12, 29, 6, 16, 51, 61859 }, // →
+    { 13, 20, 29, 8, 20, 65, 61910 }, // ↓
+    { 18, 12, 29, 5, 16, 54, 61975 }, // ↔
+    { 13, 20, 29, 8, 20, 65, 62029 }, // ↕
+    { 13, 20, 29, 8, 20, 65, 62094 }, // ↨
+    { 13, 20, 29, 8, 20, 65, 62159 }, // ↲
+    { 13, 20, 29, 8, 20, 65, 62224 }, // ↳
+    { 17, 14, 29, 6, 17, 60, 62289 }, // ↵
+    { 17, 14, 29, 6, 17, 60, 62349 }, // ⇐
+    { 13, 18, 29, 8, 19, 59, 62409 }, // ⇑
+    { 17, 14, 29, 6, 17, 60, 62468 }, // ⇒
+    { 13, 18, 29, 8, 19, 59, 62528 }, // ⇓
+    { 19, 14, 29, 5, 17, 67, 62587 }, // ⇔
+    { 19, 22, 29, 5, 21, 105, 62654 }, // ∀
+    { 14, 24, 18, 2, 23, 84, 62759 }, // ∂
+    { 13, 21, 29, 8, 21, 69, 62843 }, // ∃
+    { 23, 24, 29, 3, 22, 138, 62912 }, // ∅
+    { 19, 21, 19, 0, 21, 100, 63050 }, // ∆
+    { 19, 22, 29, 5, 21, 105, 63150 }, // ∇
+    { 19, 21, 29, 5, 21, 100, 63255 }, // ∈
+    { 19, 26, 29, 5, 23, 124, 63355 }, // ∉
+    { 19, 16, 29, 5, 18, 76, 63488 }, // ∊
+    { 19, 21, 29, 5, 21, 100, 63564 }, // ∋
+    { 19, 26, 29, 5, 23, 124, 63664 }, // ∌
+    { 19, 16, 29, 5, 18, 76, 63788 }, // ∍
+    { 22, 26, 23, 1, 21, 143, 63864 }, // ∏
+    { 18, 26, 18, 0, 21, 117, 64007 }, // ∑
+    { 13, 3, 18, 3, 11, 10, 64124 }, // −
+    { 17, 23, 14, -1, 21, 98, 64134 }, // ∕
+    { 11, 23, 14, 2, 21, 64, 64232 }, // ∖
+    { 14, 14, 18, 2, 17, 49, 64296 }, // ∗
+    { 10, 10, 18, 4, 15, 25, 64345 }, // ∘
+    { 6, 4, 18, 6, 10, 6, 64370 }, // ∙
+    { 18, 28, 18, 0, 24, 126, 64376 }, // √
+    { 14, 11, 18, 2, 15, 39, 64502 }, // ∝
+    { 18, 10, 18, 0, 14, 45, 64541 }, // ∞
+    { 19, 21, 29, 5, 21, 100, 64586 }, // ∟
+    { 21, 21, 29, 3, 21, 111, 64686 }, // ∠
+    { 4, 30, 15, 5, 23, 30, 64797 }, // ∣
+    { 9, 30, 15, 3, 23, 68, 64827 }, // ∥
+    { 19, 21, 29, 5, 21, 100, 64895 }, // ∧
+    { 19, 21, 29, 5, 21, 100, 64995 }, // ∨
+    { 17, 21, 29, 6, 21, 90, 65095 }, // ∩
+    { 17, 22, 29, 6, 21, 94, 65185 }, // ∪
+    { 16, 30, 18, 1, 23, 120, 65279 }, // ∫
+    { 19, 17, 29, 5, 16, 81, 65399 }, // ∴
+    { 19, 17, 29, 5, 16, 81, 65536 }, // ∵
+    { 6, 16, 9, 1, 18, 24, 65617 }, // ∶
+    { 19, 17, 29, 5, 16, 81, 65641 }, // ∷
+    { 17, 5, 29, 6, 11, 22, 65722 }, // ∼
+    { 17, 15, 29, 6, 17, 64, 65744 }, // ≅
+    { 14, 10, 18, 2, 15, 35, 65808 }, // ≈
+    { 17, 10, 29, 6, 13, 43, 65843 }, // ≍
+    { 13, 13, 18, 3, 16, 43, 65886 }, // ≠
+    { 17, 13, 29, 6, 15, 56, 65929 }, // ≡
+    { 14, 18, 18, 2, 18, 63, 65985 }, // ≤
+    { 14, 18, 18, 2, 18, 63, 66048 }, // ≥
+    { 23, 14, 29, 3, 17, 81, 66111 }, // ≪
+    { 23, 14, 29, 3, 17, 81, 66192 }, // ≫
+    { 19, 16, 29, 5, 18, 76, 66273 }, // ⊃
+    { 19, 26, 29, 5, 23, 124, 66349 }, // ⊄
+    { 19, 26, 29, 5, 23, 124, 66473 }, // ⊅
+    { 19, 21, 29, 5, 21, 100, 66597 }, // ⊆
+    { 19, 21, 29, 5, 21, 100, 66697 }, // ⊇
+    { 21, 22, 29, 4, 21, 116, 66797 }, // ⊕
+    { 21, 22, 29, 4, 21, 116, 66913 }, // ⊖
+    { 21, 22, 29, 4, 21, 116, 67029 }, // ⊗
+    { 21, 22, 29, 4, 21, 116, 67145 }, // ⊘
+    { 17, 21, 29, 6, 21, 90, 67261 }, // ⊥
+    { 6, 5, 18, 6, 10, 8, 67351 }, // ⋅
+    { 25, 5, 29, 2, 10, 32, 67359 }, // ⋯
+    { 27, 28, 29, 1, 24, 189, 67391 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_italicIntervals[] = {
@@ -4947,4 +3134,9 @@ static const EpdFontData bookerly_14_italic = {
     31,
     -8,
     true,
+    bookerly_14_italicBlockOffsets,
+    bookerly_14_italicDirectGlyphs,
+    bookerly_14_italicGlyphPages,
+    256,
+    bookerly_14_italicPageGlyphs,
 };
@@ -2,3985 +2,2158 @@
  * generated by fontconvert.py
  * name: bookerly_14_regular
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_14_regular 14 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_14_regular 14 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_regularBitmaps[63550] = {
-    0x1A, 0x1F, 0xCB, 0xE2, 0xF4, 0xBD, 0x2F, 0x4B, 0xC2, 0xF0, 0xBC, 0x2F, 0x07, 0xC1, 0xF0, 0x7C,
-    0x0F, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xBF, 0x5F, 0xC1, 0x40, 0x18, 0x06, 0x1F,
-    0x07, 0xCB, 0xC2, 0xF1, 0xF0, 0xBC, 0x7C, 0x1F, 0x1F, 0x07, 0xC7, 0xC1, 0xF1, 0xF0, 0x7C, 0x34,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x38, 0x00,
-    0x00, 0xB4, 0x07, 0x40, 0x00, 0x0F, 0x00, 0xB0, 0x00, 0xAA, 0xFA, 0xAF, 0xA9, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x02, 0xD0, 0x2E, 0x00, 0x00, 0x2C, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,
-    0x38, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x06, 0xAF, 0xAA, 0xFA,
-    0xA0, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x3C,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x03, 0x80, 0x00, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xFF,
-    0x80, 0xBD, 0x38, 0xFD, 0x0F, 0x43, 0x43, 0xE1, 0xF0, 0x34, 0x3D, 0x1F, 0x03, 0x41, 0x41, 0xF8,
-    0x74, 0x00, 0x0F, 0xFB, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x0B, 0x2F, 0xC0, 0x40, 0xB0, 0x7D, 0x3C, 0x0B, 0x03, 0xE7, 0xC0, 0xB0, 0x3D, 0x7E, 0x0F,
-    0x07, 0xC3, 0xF8, 0xF1, 0xF8, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x1F, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0xB8,
-    0x00, 0x03, 0xE0, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x02, 0xD0, 0x00, 0x03, 0xC0,
-    0x0B, 0x80, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0xB8, 0x0F, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x81, 0xE0,
-    0x00, 0x00, 0x3D, 0x00, 0xF4, 0x3C, 0x07, 0xF8, 0x02, 0xF0, 0x2F, 0x07, 0x43, 0xFF, 0xF0, 0x0F,
-    0xEF, 0xD0, 0xF0, 0xBC, 0x0F, 0x80, 0x3F, 0xF0, 0x2C, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x07, 0x81,
-    0xF0, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x2F, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x02, 0xF0, 0x03, 0xD0,
-    0x00, 0x03, 0xC0, 0x2F, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x1F, 0x00,
-    0x0F, 0x40, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x0B, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xE0,
-    0x7E, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x00, 0x00, 0xF8,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x0B,
-    0xC1, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x15, 0x54, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xD0, 0x0F,
-    0x9F, 0xC0, 0x6F, 0xE8, 0x03, 0xF0, 0xBE, 0x00, 0x7C, 0x00, 0x3E, 0x03, 0xF8, 0x07, 0xC0, 0x07,
-    0xD0, 0x0F, 0xE0, 0x7C, 0x00, 0x7D, 0x00, 0x3F, 0x87, 0xC0, 0x07, 0xE0, 0x00, 0xFF, 0xF4, 0x00,
-    0x3F, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x0F, 0xFE, 0x40, 0x0B, 0xFE, 0xAF, 0xFB, 0xFF,
-    0x90, 0x1F, 0xFF, 0xF8, 0x0B, 0xFD, 0x00, 0x05, 0x50, 0x00, 0x05, 0x00, 0x18, 0x7C, 0xBC, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x34, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x01, 0xF4, 0x00, 0xF4, 0x00, 0xF8,
-    0x00, 0xBC, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x00,
-    0xF8, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF4,
-    0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3D,
-    0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0x1C, 0x3E, 0x03, 0xF3, 0xC0, 0x1F, 0xF4, 0x50, 0x1F, 0xFF, 0x0B,
-    0xF5, 0xF3, 0xF3, 0x80, 0x2C, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x1F, 0xC0, 0x3F, 0x40,
-    0xFC, 0x03, 0xF0, 0x1F, 0x40, 0xFC, 0x07, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x7F, 0xFF,
-    0xEB, 0xFF, 0xF4, 0x05, 0x03, 0xFC, 0x3F, 0xC3, 0xF8, 0x05, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x01, 0xFF,
-    0xFF, 0xC0, 0x07, 0xF9, 0x5F, 0xF0, 0x0F, 0xD0, 0x03, 0xF8, 0x2F, 0x80, 0x01, 0xFC, 0x3F, 0x00,
-    0x00, 0xFD, 0x3F, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x7E, 0xBD, 0x00,
-    0x00, 0x7F, 0xBD, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x7E, 0xBE, 0x00, 0x00, 0xBE, 0x7E, 0x00,
-    0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x2F, 0xC0, 0x03, 0xF0, 0x0F, 0xE0,
-    0x0F, 0xE0, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x1B, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x03, 0xF8, 0x1B, 0xF4, 0x7E, 0x00, 0x3F, 0x8B, 0xC0,
-    0x01, 0xFC, 0xBC, 0x00, 0x1F, 0xC1, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBF, 0xAA, 0xAA, 0xAB,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0xFF, 0xFF,
-    0xD0, 0xFE, 0x42, 0xFC, 0x7D, 0x00, 0x3F, 0x0E, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0xD1, 0xAF, 0xFF, 0xD0, 0x3F, 0xFF, 0x40, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x2F, 0x6F, 0x00, 0x00, 0x7E, 0x2F, 0x00, 0x00,
-    0xFC, 0x2F, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x3F,
-    0x00, 0x2F, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x05,
-    0x55, 0x6F, 0x54, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x03, 0xFA,
-    0xAA, 0x80, 0x7D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x6A, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x6B, 0xFF, 0xF0, 0x07, 0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x0F, 0xFF, 0x90, 0x07, 0xFE, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x55, 0x40,
-    0x03, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x0B, 0xD0, 0x03, 0xFC, 0xBD, 0x00, 0x0F, 0xDF, 0xD0,
-    0x00, 0xBE, 0xBD, 0x00, 0x07, 0xEB, 0xE0, 0x00, 0x7E, 0x7F, 0x00, 0x07, 0xE3, 0xF4, 0x00, 0xFD,
-    0x2F, 0xD0, 0x2F, 0xC0, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x0F, 0x40, 0x01, 0xF8, 0x3C, 0x00, 0x0F,
-    0xC0, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0xFD, 0x07, 0xFC, 0x2F, 0x40, 0x0F, 0xC3, 0xF0,
-    0x00, 0xBC, 0x3F, 0x00, 0x0B, 0xC2, 0xF8, 0x00, 0xF8, 0x0F, 0xF0, 0x3F, 0x00, 0x3F, 0xEF, 0xC0,
-    0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xD0, 0x0F, 0xD0, 0xFF, 0x83, 0xF0, 0x02, 0xFD, 0x7E, 0x00,
-    0x0B, 0xEB, 0xD0, 0x00, 0x7F, 0xBD, 0x00, 0x03, 0xEB, 0xE0, 0x00, 0xBD, 0x3F, 0x80, 0x2F, 0xC1,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFD, 0x5F, 0xF0, 0x1F, 0x80, 0x0F, 0xE0, 0xFD, 0x00, 0x1F,
-    0xC3, 0xF0, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xBD, 0x3F, 0x00, 0x02, 0xF8, 0xBE, 0x00, 0x0B, 0xE1,
-    0xFD, 0x00, 0x2F, 0x42, 0xFF, 0x96, 0xFD, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x6A, 0xAF, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFF,
-    0x40, 0x05, 0xBF, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFC,
-    0x3F, 0xC3, 0xF8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3F,
-    0xC3, 0xFC, 0x3F, 0x80, 0x50, 0x00, 0x40, 0x1F, 0xC0, 0xBF, 0x41, 0xFC, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x07, 0xF0, 0x0F, 0xD0, 0x3F, 0x00,
-    0xFC, 0x07, 0xD0, 0x3F, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x10, 0x55, 0x55, 0x55, 0x3F, 0xFF,
-    0xFF, 0xCA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x4F, 0xFF,
-    0xFF, 0xF2, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02,
-    0xFC, 0x00, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xD0, 0x20, 0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
-    0x1F, 0xC0, 0x2F, 0xFE, 0x07, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-    0x3F, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x01,
-    0xB9, 0x00, 0x0F, 0x81, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0xBC, 0x2F, 0x00, 0x7D, 0x0F, 0xC0, 0x07,
-    0xC3, 0xE0, 0x0B, 0x40, 0x7C, 0x00, 0x7C, 0x7D, 0x00, 0x10, 0x07, 0xC0, 0x03, 0xD7, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x3C, 0xBC, 0x00, 0x0B, 0xFF, 0xC0, 0x07, 0xCB, 0xC0, 0x03, 0xF9, 0xBC, 0x00,
-    0xBC, 0xBC, 0x00, 0xF8, 0x07, 0xC0, 0x0F, 0x47, 0xC0, 0x0F, 0x40, 0x7D, 0x02, 0xF0, 0x7D, 0x00,
-    0xFC, 0x1F, 0xF5, 0xFC, 0x03, 0xE0, 0x0B, 0xFF, 0xAF, 0xFF, 0x00, 0x3F, 0x00, 0x1F, 0xD0, 0x6E,
-    0x40, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x1B, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00,
-    0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF,
-    0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00,
-    0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x15, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x7F, 0xFA, 0xBF, 0xE0, 0x03,
-    0xF0, 0x07, 0xF0, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0xF8, 0x03,
-    0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xFA, 0x5B, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFA, 0xAF, 0xFC, 0x03, 0xF0, 0x01, 0xFD, 0x03, 0xF0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0xFE, 0x03, 0xF0, 0x07, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x0B, 0xF4, 0x01, 0xF4, 0x07, 0xE0, 0x00, 0x3D,
-    0x03, 0xF0, 0x00, 0x0F, 0x42, 0xF4, 0x00, 0x02, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x56, 0xB4, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFA, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xF0, 0x00,
-    0x1F, 0xE0, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x01,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0xFD,
-    0x03, 0xF0, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x03, 0xF0,
-    0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x06, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x2D, 0x00, 0xFC, 0x00, 0x07,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x15,
-    0x54, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x18, 0x03, 0xF0, 0x00, 0x0F, 0x00,
-    0xFC, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x16, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x7E,
-    0x03, 0xF0, 0x00, 0xB8, 0x0F, 0xC0, 0x01, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
-    0x80, 0x02, 0xF0, 0x07, 0xF0, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x0F, 0x02, 0xF4, 0x00, 0x00,
-    0x38, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x55, 0x55, 0xBE, 0x00, 0x07, 0xFF, 0xFA, 0xFC, 0x00,
-    0x06, 0xBF, 0xC7, 0xF0, 0x00, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0x01, 0xF8, 0x3F, 0xC0, 0x00, 0x07,
-    0xE0, 0x7F, 0xC0, 0x00, 0x1F, 0x80, 0x7F, 0xE4, 0x01, 0xBE, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xD0, 0x00, 0xFF, 0xF9, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40,
-    0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xD5, 0x55,
-    0x57, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xF0,
-    0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE7, 0xFF, 0xE0, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xBF, 0xFD, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0x80, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x7F, 0xFF, 0x47, 0xFF, 0xE0,
-    0x07, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x03, 0xF1, 0xFC,
-    0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x07, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xE0, 0xFF, 0xFF, 0x40, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2C, 0x03, 0xF0, 0x00, 0x0F, 0x00,
-    0xFC, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x17, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x07, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBB, 0xE0, 0x00, 0x7F,
-    0xF0, 0x00, 0x0F, 0x7F, 0x00, 0x0B, 0x7F, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0xF2, 0xF0, 0x00, 0x0F,
-    0x1F, 0x40, 0x1F, 0x2F, 0x00, 0x00, 0xF0, 0xFC, 0x02, 0xD2, 0xF0, 0x00, 0x0F, 0x0B, 0xC0, 0x3C,
-    0x1F, 0x00, 0x01, 0xF0, 0x7D, 0x07, 0x81, 0xF4, 0x00, 0x1F, 0x03, 0xE0, 0xB4, 0x1F, 0x40, 0x01,
-    0xF0, 0x2F, 0x0F, 0x00, 0xF4, 0x00, 0x2E, 0x00, 0xF5, 0xE0, 0x0F, 0x80, 0x02, 0xE0, 0x0F, 0xBD,
-    0x00, 0xF8, 0x00, 0x3E, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x03, 0xD0, 0x03, 0xF8, 0x00, 0xFC, 0x00,
-    0x3D, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x02, 0xFF, 0xE0, 0x04,
-    0x00, 0xBF, 0xFD, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x03, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xC0, 0x03, 0xDB, 0xE0, 0x00, 0x3C,
-    0x00, 0x3D, 0x3F, 0x40, 0x03, 0xC0, 0x03, 0xD1, 0xFC, 0x00, 0x3C, 0x00, 0x3D, 0x0B, 0xE0, 0x03,
-    0xC0, 0x03, 0xD0, 0x3F, 0x40, 0x3C, 0x00, 0x3D, 0x01, 0xFC, 0x03, 0xC0, 0x03, 0xD0, 0x0B, 0xF0,
-    0x3C, 0x00, 0x3D, 0x00, 0x3F, 0x43, 0xC0, 0x03, 0xD0, 0x00, 0xFC, 0x3C, 0x00, 0x3D, 0x00, 0x07,
-    0xF3, 0xC0, 0x03, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xD0, 0x00,
-    0x07, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0xBF, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x07, 0xF8, 0x07, 0xF0, 0x00,
-    0x00, 0xBF, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00,
-    0x0B, 0xE0, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x01,
-    0xFC, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x7F,
-    0xFA, 0xBF, 0xF4, 0x03, 0xF0, 0x07, 0xFC, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03,
-    0xF0, 0x1B, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF9, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xD0, 0x02, 0xFF,
-    0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x00, 0x00,
-    0xFE, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00,
-    0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xFD,
-    0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0xBF, 0xF0, 0x00, 0x03,
-    0xF0, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07,
-    0xF0, 0x00, 0x03, 0xF5, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x1F, 0xD0, 0x00,
-    0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x2F,
-    0xFF, 0x40, 0x3F, 0xE0, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x05,
-    0x50, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xC1, 0xFD, 0x00, 0xFC, 0x2F, 0x40, 0x0B, 0xC3,
-    0xF0, 0x00, 0x7C, 0x3F, 0x00, 0x07, 0x43, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x10,
-    0x00, 0x0F, 0xDB, 0x80, 0x00, 0xBD, 0xBC, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xFC, 0xBF, 0x00, 0x3F,
-    0x8B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0x3F, 0x40, 0x3E, 0xF4, 0x03, 0xF4,
-    0x03, 0xDF, 0x00, 0x3F, 0x40, 0x2D, 0x70, 0x03, 0xF4, 0x02, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x00,
-    0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x80,
-    0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF7, 0xFF, 0xE4,
-    0x01, 0xBF, 0xE4, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00,
-    0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x00, 0x02, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x0F,
-    0x40, 0x00, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x01, 0x40, 0x01, 0xFF, 0xFE, 0x2F, 0xFF, 0x80, 0x03, 0xE0, 0x00, 0xBF, 0xF8, 0x03,
-    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0x80, 0x00,
-    0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0x00, 0x00,
-    0xBE, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x7D, 0x00, 0x3D, 0x00, 0x00,
-    0x3F, 0x00, 0x3C, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x40, 0x7C, 0x3F, 0x00, 0xBC, 0x00, 0x00,
-    0x1F, 0x80, 0xB8, 0x1F, 0x40, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x0F, 0x81, 0xF0, 0x00, 0x00,
-    0x0B, 0xC1, 0xF0, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x07, 0xD2, 0xE0, 0x07, 0xD3, 0xE0, 0x00, 0x00,
-    0x03, 0xF3, 0xD0, 0x03, 0xE3, 0xC0, 0x00, 0x00, 0x02, 0xF7, 0xC0, 0x03, 0xF7, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xC1, 0xFF, 0xF8, 0x01, 0xBF, 0xD0, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xD0,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0xFD, 0x00,
-    0x00, 0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x80,
-    0x00, 0x7E, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xF8, 0x01, 0xBF, 0xFE,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE,
-    0x7F, 0xFE, 0x00, 0x6F, 0xF8, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00,
-    0xFD, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F,
-    0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x07, 0xF4, 0x7C,
-    0x00, 0x0F, 0xE0, 0x78, 0x00, 0x1F, 0xC0, 0x24, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1C, 0x0F,
-    0xC0, 0x00, 0x3C, 0x3F, 0x40, 0x00, 0x7C, 0xBF, 0x00, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0xFD, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80,
-    0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8,
-    0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xFF, 0xD6,
-    0xA8, 0xB8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x50, 0x7F, 0xE7, 0xFF, 0x02,
-    0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0,
-    0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
-    0x02, 0xF0, 0x2F, 0x7F, 0xF2, 0xA9, 0x00, 0x05, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0xF9, 0xF0, 0x00, 0x0F, 0x0F, 0x40, 0x02, 0xE0, 0xB8, 0x00, 0x3D,
-    0x07, 0xC0, 0x07, 0xC0, 0x3D, 0x00, 0xF8, 0x02, 0xF0, 0x0F, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0xF8,
-    0x3D, 0x00, 0x07, 0xC2, 0x80, 0x00, 0x28, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xE5, 0x55,
-    0x55, 0x55, 0x00, 0x08, 0x00, 0xF4, 0x03, 0xF0, 0x0B, 0xF0, 0x07, 0xF0, 0x07, 0xD0, 0x02, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F,
-    0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F,
-    0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x01, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x50, 0x00, 0x01, 0xF4, 0xBF, 0xF4, 0x00, 0x1F, 0xBF, 0xFF, 0xD0, 0x01, 0xFF, 0x91,
-    0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x01, 0xF4, 0x00, 0x1F, 0xC0, 0x1F, 0x40, 0x00, 0xFC, 0x01,
-    0xF4, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00,
-    0xFC, 0x01, 0xF4, 0x00, 0x1F, 0x80, 0x1F, 0x40, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFD, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x03, 0x87,
-    0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xF8,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x05, 0x0F, 0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xFD,
-    0x00, 0x7F, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0xFC,
-    0x0B, 0xE0, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0xD0, 0x2F, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFE, 0x1F, 0xF8, 0x00, 0x54, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x7F, 0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x2F, 0xAB, 0xF0, 0x07, 0xD0, 0x1D,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1B, 0xFF,
-    0xFD, 0x07, 0xFF, 0xFF, 0xD0, 0x16, 0xF9, 0x54, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x1F, 0x80, 0x2F, 0x44, 0x0B, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF4, 0x1F, 0xD0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x3E, 0xFF,
-    0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0x55, 0x40, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3,
-    0xE0, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0xE5, 0x6F, 0xF0, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x40, 0x00, 0x03, 0xF1, 0xFF, 0xF4, 0x00,
-    0x0F, 0xEF, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x1F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xD3, 0xFF, 0xF0,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x0B, 0xF4, 0x02, 0xFC, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x03, 0xFF, 0xC0, 0x17, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x1F, 0xC0, 0x2F, 0xD0, 0x7F, 0xD0, 0x0A, 0x40,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0xFF, 0x80, 0x3F, 0x01, 0xFF, 0xF4, 0x03, 0xF0,
-    0x07, 0xF4, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00, 0x3F, 0x0B,
-    0xE0, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x01,
-    0xFF, 0xE0, 0x1F, 0xF4, 0x3F, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x0B,
-    0xFC, 0x07, 0xFF, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B,
-    0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x07, 0xFF, 0xE7, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x50, 0x00, 0x02, 0xFC, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x07,
-    0xFF, 0x7F, 0xFF, 0xCB, 0xFF, 0xFC, 0x00, 0x6F, 0xFE, 0x07, 0xFF, 0xD0, 0xBF, 0x40, 0x01, 0xFC,
-    0x00, 0x7F, 0x80, 0x0B, 0xE0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xBF, 0xF4, 0x0B, 0xFF, 0x01, 0xFF, 0xF0, 0xFF, 0xFD,
-    0x0B, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xC2, 0xFF, 0xE0, 0x07, 0xFF,
-    0x7F, 0xFF, 0xD0, 0x06, 0xFF, 0xE0, 0x7F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00,
-    0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40,
-    0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4,
-    0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x01, 0xBF, 0xF4, 0x0B, 0xFF, 0x8F, 0xFF, 0xD0, 0x7F,
-    0xFF, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F,
-    0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01,
-    0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0xF4, 0x7F, 0xF8, 0x0B, 0xFE, 0xBF,
-    0xFF, 0xC0, 0x6F, 0xFD, 0x1B, 0xF8, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x3F,
-    0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x07, 0xD0,
-    0x3F, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0xBF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x06, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00,
-    0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC,
-    0x07, 0xD0, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x0B, 0xF0, 0x0F, 0xF4,
-    0x1F, 0xFC, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x0B, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0x01, 0x02, 0xFC, 0x1F, 0xF7,
-    0xFF, 0x2F, 0xFC, 0x6F, 0xEF, 0xAE, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x14, 0x00,
-    0x02, 0xFF, 0xF8, 0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC, 0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x10, 0x2F,
-    0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFC, 0x38, 0x00,
-    0x7D, 0x3C, 0x00, 0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x01, 0x54, 0x00,
-    0x00, 0xA0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xF8, 0x57, 0xF5, 0x50, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F, 0x80, 0x03,
-    0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00,
-    0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04, 0x00, 0x7F, 0xFE, 0x03,
-    0xFF, 0xC7, 0xFF, 0xD0, 0x2F, 0xF8, 0x0F, 0xD0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x1F, 0x40, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3D,
-    0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x1F, 0x5F, 0x00, 0x00, 0x00,
-    0xFA, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0xB0, 0x03, 0xFF, 0xD3, 0xFF, 0xD0, 0x0F, 0x40,
-    0x2F, 0xFC, 0x0F, 0xD0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x2F, 0xC0, 0x07, 0xD0, 0x03,
-    0xF0, 0x03, 0xFD, 0x00, 0xBC, 0x00, 0x2F, 0x40, 0x7F, 0xE0, 0x0F, 0x80, 0x01, 0xF8, 0x0B, 0xAF,
-    0x00, 0xF0, 0x00, 0x0F, 0xC0, 0xF1, 0xF4, 0x2F, 0x00, 0x00, 0xBC, 0x1F, 0x0F, 0x83, 0xD0, 0x00,
-    0x03, 0xD2, 0xD0, 0xBC, 0x3C, 0x00, 0x00, 0x3F, 0x3C, 0x07, 0xD7, 0x80, 0x00, 0x02, 0xF7, 0x80,
-    0x3E, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x07,
-    0xFF, 0x8F, 0xFF, 0x41, 0xFF, 0xD0, 0x7F, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x7E,
-    0x0B, 0x80, 0x00, 0x0B, 0xD7, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x03, 0xDF, 0xC0, 0x00, 0x03, 0xD1, 0xFC, 0x00, 0x03, 0xE0, 0x2F, 0x80,
-    0x03, 0xF0, 0x03, 0xF4, 0x0B, 0xFE, 0x01, 0xFF, 0xDB, 0xFF, 0xD1, 0xFF, 0xF8, 0x7F, 0xFE, 0x03,
-    0xFF, 0xC7, 0xFF, 0xD0, 0x2F, 0xF8, 0x0F, 0xD0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3D,
-    0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x1F, 0x5F, 0x00, 0x00, 0x00,
-    0xFA, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xE8, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFD, 0x1F, 0x40, 0x2F, 0x81, 0xD0, 0x07, 0xF0, 0x1C, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0xE0, 0xBE, 0x00, 0x1E, 0x1F, 0x80, 0x03, 0xE3, 0xFF, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0xE0, 0x3F,
-    0x00, 0x0F, 0x80, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0xBC,
-    0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x0B, 0xE0, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF0,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40,
-    0x03, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x6E, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x14, 0x00, 0x00, 0x0F, 0xE4, 0x03, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x7D,
-    0x00, 0x0F, 0x40, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xE0,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0x80,
-    0x03, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x1F, 0x40,
-    0x1F, 0xC0, 0xBF, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x0D, 0x3F, 0xFF,
-    0x43, 0xE7, 0xD2, 0xFF, 0xFC, 0x74, 0x02, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x04, 0x0F, 0xD7, 0xF4,
-    0xFC, 0x04, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3D, 0x0F, 0x43, 0xD0, 0xF4, 0x3D,
-    0x1F, 0x87, 0xE1, 0xF8, 0xBE, 0x2F, 0x8F, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0x7F, 0x90, 0x00, 0x2F, 0xFF, 0xF4, 0x03, 0xFA, 0xDB, 0xF0, 0x2F, 0x07, 0x0B, 0xC0, 0xF4,
-    0x1C, 0x1E, 0x0B, 0xC0, 0xB0, 0x00, 0x3F, 0x02, 0xC0, 0x00, 0xFC, 0x0B, 0x00, 0x03, 0xF0, 0x2C,
-    0x00, 0x0F, 0xC0, 0xB0, 0x00, 0x3F, 0x02, 0xC0, 0x00, 0xBD, 0x0F, 0x00, 0x01, 0xFC, 0x3C, 0x00,
-    0x03, 0xFE, 0xF1, 0x7C, 0x03, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x0B, 0xD0, 0xBE, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x3E,
-    0x00, 0x04, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1A, 0xFE,
-    0xAB, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x58, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xBF, 0xFF, 0xFC, 0x18, 0x00, 0x05, 0x50, 0x10, 0x00,
-    0x00, 0x04, 0x78, 0x01, 0x40, 0x2D, 0x2E, 0x2F, 0xFD, 0xB8, 0x0B, 0xFE, 0xBF, 0xE0, 0x03, 0xE0,
-    0x0B, 0xC0, 0x03, 0xC0, 0x03, 0xD0, 0x07, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x03, 0xD0, 0x07, 0xC0,
-    0x03, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x03, 0xF9, 0x6F, 0xD0, 0x1F, 0xBF, 0xFE, 0xF4, 0x7C, 0x06,
-    0x90, 0x3D, 0x20, 0x00, 0x00, 0x08, 0x7F, 0xFE, 0x00, 0x2F, 0xF8, 0x7F, 0xFD, 0x00, 0x3F, 0xF8,
-    0x0B, 0xF0, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x1F, 0x00, 0x00,
-    0xBD, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x80, 0xF4, 0x00, 0x00, 0x5F,
-    0xC1, 0xF5, 0x40, 0x01, 0xFF, 0xE3, 0xFF, 0x40, 0x00, 0x57, 0xFB, 0x95, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x14, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0x00, 0xBC, 0x0B, 0xD0, 0x7C,
-    0x00, 0xF0, 0x3F, 0x00, 0x14, 0x1F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xDF, 0xF4, 0x00, 0xF0,
-    0xBF, 0x80, 0x2D, 0x07, 0xFC, 0x07, 0xC0, 0x1F, 0xC0, 0xFC, 0x00, 0xF8, 0x0F, 0xE0, 0x0F, 0x00,
-    0xFF, 0x42, 0xD0, 0x0B, 0xF8, 0x74, 0x00, 0x2F, 0xAD, 0x00, 0x01, 0xFF, 0x41, 0x00, 0x1F, 0xC3,
-    0xC0, 0x03, 0xE1, 0xF4, 0x02, 0xF0, 0x7F, 0x96, 0xF0, 0x0B, 0xFF, 0xE0, 0x00, 0x1A, 0x40, 0x00,
-    0x09, 0x00, 0x50, 0xFD, 0x0F, 0xE3, 0xF4, 0x3F, 0x8B, 0x80, 0x7C, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x90, 0x5B, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x00, 0x00, 0x2E, 0x00, 0xB4, 0x01, 0xBE, 0x40, 0xB4, 0x0F, 0x00, 0xFF, 0xF8,
-    0x03, 0xC2, 0xD0, 0x3D, 0x03, 0x80, 0x2C, 0x3C, 0x07, 0x80, 0x34, 0x01, 0xE3, 0xC0, 0xB4, 0x00,
-    0x00, 0x0E, 0x38, 0x0F, 0x00, 0x00, 0x00, 0xF3, 0x80, 0xF0, 0x00, 0x00, 0x0F, 0x3C, 0x0F, 0x40,
-    0x00, 0x00, 0xE3, 0xC0, 0xBC, 0x00, 0x00, 0x1E, 0x2D, 0x03, 0xE4, 0x18, 0x02, 0xC0, 0xE0, 0x1F,
-    0xFF, 0xC0, 0x3C, 0x0B, 0x40, 0x1A, 0x90, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0xF4,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xF9, 0x01, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x00, 0x50, 0x00, 0x2F, 0xF8, 0x02, 0xF0, 0xF0, 0x0B, 0x43, 0xD0, 0x00,
-    0x0F, 0x40, 0x2F, 0xFD, 0x02, 0xF4, 0xF4, 0x0F, 0x03, 0xD0, 0x3E, 0x1F, 0xD0, 0x7F, 0xDF, 0xC0,
-    0x14, 0x04, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x24, 0x00, 0x50, 0x03,
-    0xD0, 0x0B, 0x80, 0x7E, 0x00, 0xFC, 0x07, 0xE0, 0x1F, 0xC0, 0xBF, 0x01, 0xFC, 0x03, 0xF4, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x1F, 0xC0, 0x0B, 0xD0, 0x1F, 0x80, 0x0B, 0xD0, 0x1F, 0x80, 0x07, 0xC0, 0x0F,
-    0x40, 0x03, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x6A,
-    0xAA, 0x7F, 0xFF, 0xEB, 0xFF, 0xF4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x2E,
-    0x00, 0x2E, 0x00, 0x2D, 0x00, 0x01, 0xD0, 0x0D, 0x3F, 0xF4, 0x2C, 0x0B, 0x03, 0x8F, 0x03, 0x83,
-    0x80, 0xE2, 0xC0, 0xB0, 0xD0, 0x3D, 0xE0, 0x2C, 0x34, 0x0F, 0xF0, 0x0B, 0x0E, 0x03, 0x8E, 0x02,
-    0xC3, 0xC0, 0xE1, 0xE0, 0xE0, 0x70, 0xFE, 0x1D, 0x74, 0x0F, 0x00, 0x00, 0x38, 0x00, 0xF4, 0x00,
-    0x7C, 0x00, 0x0B, 0xEA, 0xF8, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x6A, 0xAA, 0x8F, 0xFF, 0xFD, 0xAA,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xFD, 0x0B, 0x80, 0xBC, 0x3C, 0x00, 0xF4,
-    0xF0, 0x03, 0xD3, 0xD0, 0x0F, 0x0B, 0xC0, 0xBC, 0x0F, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C,
-    0x00, 0x2A, 0xAF, 0xAA, 0x8F, 0xFF, 0xFF, 0xF0, 0x55, 0xF5, 0x54, 0x00, 0x3C, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xBE, 0x00, 0x3F, 0xFF, 0x42, 0xF4,
-    0x7F, 0x0F, 0x40, 0xBC, 0x1C, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x1F, 0xFF, 0xCF, 0x81, 0xF5, 0x80, 0x3D, 0x00, 0x2F, 0x00, 0x7F, 0x00, 0xFF, 0xD0,
-    0x2A, 0xFD, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF5, 0x5B, 0xF8, 0xFF, 0xF4, 0x0A, 0x90, 0x00,
-    0x01, 0x00, 0x3D, 0x0F, 0xD2, 0xF8, 0x3F, 0x0B, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x7D, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x0B,
-    0xC0, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x01, 0xFD,
-    0x00, 0xBF, 0x00, 0x2F, 0xE0, 0x0B, 0xFC, 0x0B, 0xEF, 0x40, 0xBF, 0xFF, 0xF8, 0xFF, 0xDB, 0x9F,
-    0xFE, 0x0B, 0xFC, 0xBC, 0x15, 0x00, 0x14, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x03, 0xFF,
-    0xF3, 0xC0, 0x2F, 0xFF, 0x8F, 0x00, 0xFF, 0xFE, 0x3C, 0x07, 0xFF, 0xF8, 0xF0, 0x1F, 0xFF, 0xE3,
-    0xC0, 0x7F, 0xFF, 0x8F, 0x00, 0xFF, 0xFE, 0x3C, 0x03, 0xFF, 0xF8, 0xF0, 0x03, 0xFF, 0xE3, 0xC0,
-    0x07, 0xFF, 0x8F, 0x00, 0x02, 0xEE, 0x3C, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0xE3, 0xC0, 0x00,
-    0x03, 0x8F, 0x00, 0x00, 0x0E, 0x3C, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0x03,
-    0x8F, 0x00, 0x00, 0x0E, 0x3C, 0x00, 0x00, 0x38, 0xD0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xFC, 0x3F, 0xC1, 0xF4, 0x19, 0x0B, 0xFC, 0x1B, 0xC0,
-    0x7C, 0x0F, 0x87, 0xE0, 0x24, 0x00, 0x00, 0x60, 0x06, 0xFC, 0x07, 0xFF, 0x00, 0x0B, 0xC0, 0x01,
-    0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x1B,
-    0xE4, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1F, 0xFE, 0x00, 0xF9, 0xBE, 0x0F, 0x80,
-    0x7C, 0x3C, 0x00, 0xF4, 0xF0, 0x03, 0xD3, 0xD0, 0x0F, 0x4F, 0x80, 0x7C, 0x2F, 0x87, 0xE0, 0x2F,
-    0xFE, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x20, 0x00, 0x90,
-    0x00, 0xF4, 0x02, 0xE0, 0x00, 0xF8, 0x03, 0xF0, 0x01, 0xF8, 0x03, 0xF0, 0x01, 0xFC, 0x03, 0xF0,
-    0x03, 0xF4, 0x0B, 0xE0, 0x2F, 0xC0, 0x7F, 0x41, 0xFC, 0x03, 0xF4, 0x0F, 0xC0, 0x3F, 0x00, 0xF8,
-    0x02, 0xF0, 0x03, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x02, 0xE0, 0x01, 0xF0, 0x00,
-    0x0B, 0x00, 0x0B, 0xE0, 0x01, 0xF0, 0x00, 0x1E, 0x00, 0x1F, 0xE0, 0x01, 0xF0, 0x00, 0x3C, 0x00,
-    0x3F, 0xE0, 0x1B, 0xFE, 0x00, 0x78, 0x00, 0xFA, 0xE0, 0x3F, 0xFF, 0x40, 0xF0, 0x02, 0xF2, 0xE0,
-    0x00, 0x00, 0x02, 0xD0, 0x07, 0xC2, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x42, 0xE0, 0x00, 0x00,
-    0x0F, 0x40, 0x3F, 0xAB, 0xF9, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x3C, 0x00,
-    0x05, 0x57, 0xE5, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0xB0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0x40, 0x7F, 0xD0, 0x01, 0xF0, 0x00, 0x1E, 0x03, 0xFF, 0xF8, 0x01, 0xF0, 0x00, 0x3C,
-    0x0B, 0xC0, 0xFC, 0x01, 0xF0, 0x00, 0x78, 0x0B, 0x80, 0x7C, 0x1B, 0xFE, 0x00, 0xF0, 0x02, 0x40,
-    0xBC, 0x3F, 0xFF, 0x42, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x02, 0x5B, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00,
-    0x00, 0xF8, 0x00, 0xB0, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x78, 0x00, 0x3F, 0xC0, 0x00, 0x2F,
-    0x00, 0x3C, 0x00, 0x3F, 0xF0, 0x1A, 0xFF, 0x40, 0x1E, 0x00, 0x2F, 0x7C, 0x0F, 0xFF, 0x40, 0x0F,
-    0x00, 0x1F, 0x1F, 0x00, 0x54, 0x00, 0x0B, 0x40, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x0F,
-    0x81, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x07, 0xEA, 0xBE, 0x80, 0x00, 0x01, 0xF0, 0x01, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x15, 0x5B, 0xD4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x2F,
-    0x00, 0x0B, 0xFC, 0x02, 0xFF, 0xF0, 0x2F, 0xFE, 0x00, 0xFD, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x02, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xF4, 0x01,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5,
-    0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC,
-    0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC,
-    0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9,
-    0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x00,
-    0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0xF0, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA,
-    0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x43, 0x80, 0x00, 0x00, 0x0F,
-    0xFE, 0xBC, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xC0, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00,
-    0x00, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00,
-    0x1F, 0xC0, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x05, 0x00,
-    0x10, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x01, 0xF8,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-    0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xD6,
-    0xE0, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x6E, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-    0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x02,
-    0xE7, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x1F, 0x80, 0x02, 0xC0, 0x00, 0x00, 0xB8, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x1F, 0x85, 0x54, 0x00, 0x00, 0x0F, 0x40, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBC, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE5, 0x5B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFA, 0xAA, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x09, 0x00, 0xBC,
-    0x00, 0x07, 0xE0, 0x00, 0x3C, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0xBE,
-    0x01, 0x5F, 0x87, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x55, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x0B, 0xF4, 0x01,
-    0xF4, 0x07, 0xE0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x0F, 0x42, 0xF4, 0x00, 0x02, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x56,
-    0xB4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03,
-    0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0,
-    0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00,
-    0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00,
-    0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x78, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00,
-    0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C,
-    0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x50, 0x05, 0x00, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x07, 0xD0,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x02, 0xD0,
-    0x0F, 0xC0, 0x00, 0x70, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC1, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x80, 0x3F,
-    0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x01, 0x6F, 0x0B, 0xFF, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x10, 0x00, 0x2F, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x80, 0x06, 0xFC, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0xFF, 0x80, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x02, 0xFF,
-    0xF7, 0xFF, 0xFE, 0x00, 0x01, 0x00, 0x03, 0xD0, 0x07, 0xF8, 0x0F, 0xFC, 0x0F, 0xE4, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0xFF, 0x80, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x02, 0xFF, 0xF7,
-    0xFF, 0xFE, 0x00, 0x14, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xF8, 0x02, 0xF2, 0xF8, 0x2F, 0x02, 0xF0,
-    0xF0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x7F, 0xFE, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFD, 0x0F, 0xFF, 0xF8, 0x14,
-    0x00, 0x51, 0xFC, 0x0F, 0xDB, 0xF0, 0x7F, 0x4F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0x43, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xEB, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0xC0, 0x00,
-    0xFC, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xE0, 0x03,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xFF,
-    0xFF, 0xE0, 0x03, 0xF4, 0xFF, 0xFF, 0xF8, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xFC,
-    0x00, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x1B, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x43, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0xBC, 0x00, 0x00, 0x00,
-    0xF6, 0xFF, 0xC0, 0x00, 0x00, 0x0A, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF6,
-    0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xC0,
-    0x03, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x3D, 0xBE, 0x00, 0x03, 0xC0, 0x03, 0xD3, 0xF4, 0x00, 0x3C,
-    0x00, 0x3D, 0x1F, 0xC0, 0x03, 0xC0, 0x03, 0xD0, 0xBE, 0x00, 0x3C, 0x00, 0x3D, 0x03, 0xF4, 0x03,
-    0xC0, 0x03, 0xD0, 0x1F, 0xC0, 0x3C, 0x00, 0x3D, 0x00, 0xBF, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xF4,
-    0x3C, 0x00, 0x3D, 0x00, 0x0F, 0xC3, 0xC0, 0x03, 0xD0, 0x00, 0x7F, 0x3C, 0x00, 0x3D, 0x00, 0x03,
-    0xFF, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0x00,
-    0x02, 0xFC, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE,
-    0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00,
-    0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00,
-    0x03, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00,
-    0x2F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07,
-    0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x02, 0xFF,
-    0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F,
-    0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x03, 0x80, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFE, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F,
-    0xC0, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0,
-    0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0,
-    0x00, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0,
-    0x00, 0x07, 0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0xDB, 0xC0, 0x00, 0x00, 0x7D, 0xBF, 0xE0, 0x00, 0x00, 0x0D,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x69, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xF0, 0x00, 0x3F, 0xD0,
-    0x02, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00,
-    0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0x40, 0x0B,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xFC, 0x1F,
-    0xD0, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFB, 0xFF,
-    0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x0B,
-    0xF0, 0x2F, 0x80, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x07,
-    0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F,
-    0xCB, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBE,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x07, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x3F, 0x00, 0xBC, 0x0F, 0xC2,
-    0xF0, 0x03, 0xEB, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0xC3, 0xE0,
-    0x2F, 0x00, 0xF8, 0x7C, 0x00, 0x3D, 0x10, 0x00, 0x04, 0x00, 0x00, 0x16, 0x90, 0x00, 0x40, 0x00,
-    0x7F, 0xFF, 0xF4, 0x1E, 0x00, 0x2F, 0xFE, 0xFF, 0xFB, 0xC0, 0x0F, 0xF4, 0x00, 0xBF, 0xF0, 0x02,
-    0xFC, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xE0, 0x00, 0x0B, 0xFF, 0x80,
-    0xFC, 0x00, 0x02, 0xF2, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0x1F, 0xC1, 0xFC, 0x00, 0x2F, 0x01, 0xFC,
-    0x2F, 0x80, 0x0B, 0xC0, 0x0F, 0xC2, 0xF8, 0x02, 0xF0, 0x00, 0xFC, 0x2F, 0xC0, 0xBC, 0x00, 0x0F,
-    0xC1, 0xFC, 0x2F, 0x00, 0x01, 0xFC, 0x1F, 0xDB, 0xC0, 0x00, 0x2F, 0x80, 0xFF, 0xF0, 0x00, 0x03,
-    0xF4, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0x40, 0x0B,
-    0xF4, 0x02, 0xF7, 0xFF, 0xFF, 0xFD, 0x00, 0x3C, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0xBC,
-    0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF8, 0x01, 0xBF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0xBC,
-    0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF8, 0x01, 0xBF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0xBC,
-    0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF8, 0x01, 0xBF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0,
-    0x7F, 0x40, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE,
-    0x00, 0x0B, 0xFF, 0x80, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x02, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x80, 0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE, 0x7F, 0xFE, 0x00, 0x6F, 0xF8, 0x03, 0xF4,
-    0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00,
-    0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xE3, 0xE0,
-    0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x6F, 0xF9, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x03, 0xFA, 0xBF, 0xF0, 0x03, 0xF0, 0x03, 0xFC, 0x03, 0xF0, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x7E,
-    0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x01, 0xFC,
-    0x03, 0xF0, 0x0B, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF9, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x1F, 0xEB, 0xFD, 0x00, 0x07, 0xE0, 0x07, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x0F, 0x00, 0x00, 0x2F, 0x01,
-    0xF4, 0x00, 0x02, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x00, 0xFF, 0x40, 0x02, 0xF0, 0x03, 0xFE, 0x00,
-    0x2F, 0x00, 0x0F, 0xF8, 0x02, 0xF0, 0x00, 0x2F, 0xD0, 0x2F, 0x00, 0x00, 0xBE, 0x02, 0xF0, 0x00,
-    0x03, 0xE0, 0x2F, 0x0E, 0x00, 0x3E, 0x02, 0xF0, 0xF0, 0x07, 0xC1, 0xFF, 0x0F, 0xEA, 0xF8, 0x3F,
-    0xF0, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF,
-    0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F,
-    0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF,
-    0xC3, 0xFC, 0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F,
-    0xD0, 0x2F, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x5F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F,
-    0xC0, 0xBD, 0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC,
-    0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x3E, 0xF8, 0x00, 0x03, 0xF1, 0xF4, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0xF0, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F,
-    0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0,
-    0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD,
-    0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xE0, 0x00, 0xFF, 0xD7, 0xC0, 0x03, 0xC7, 0xFF,
-    0x00, 0x0A, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x01, 0xFF, 0xF4, 0x00, 0x3F, 0xEF, 0xF0, 0x03, 0xF4, 0x0B, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x1D,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x17, 0xF0, 0x00, 0xBF, 0xFF, 0xC0, 0x1F, 0xFE,
-    0xBF, 0x00, 0xFD, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0x7F, 0x00, 0xFF,
-    0x40, 0xFF, 0xFF, 0xBF, 0xF0, 0xFF, 0xF0, 0xFF, 0x00, 0x54, 0x00, 0x40, 0x06, 0x00, 0x24, 0x00,
-    0x7F, 0x03, 0xF0, 0x01, 0xFC, 0x1F, 0xD0, 0x02, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0xFD, 0x02,
-    0xF8, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x05, 0xFC,
-    0x00, 0x2F, 0xFF, 0xF0, 0x07, 0xFF, 0xAF, 0xC0, 0x3F, 0x40, 0x3F, 0x02, 0xF4, 0x00, 0xFC, 0x0B,
-    0xD0, 0x03, 0xF0, 0x1F, 0xC0, 0x3F, 0xD0, 0x3F, 0xFF, 0xEF, 0xFC, 0x3F, 0xFC, 0x3F, 0xC0, 0x15,
-    0x00, 0x10, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0xF0,
-    0x3C, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x0F, 0x9B, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80,
-    0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00,
-    0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x01,
-    0x00, 0x00, 0x05, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xD0, 0x0F, 0xFB, 0xF9, 0xFF,
-    0xFF, 0x43, 0xF4, 0x0B, 0xFD, 0x01, 0xFC, 0x3F, 0x00, 0x3F, 0x80, 0x0F, 0xC1, 0xD0, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x00, 0x3F, 0x01, 0x5F, 0xD0, 0x00, 0x6B, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF,
-    0xFA, 0x95, 0x01, 0xFE, 0x53, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x02,
-    0xF4, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x0B, 0xFF, 0x40, 0x18, 0x3F, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xC0, 0xFF, 0xF4, 0x0F, 0xFF, 0xF0, 0x01, 0x50, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F, 0x4F,
-    0x80, 0x03, 0x87, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF, 0xF8,
-    0x0B, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF,
-    0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-    0x7F, 0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFB, 0xD0, 0x01, 0xF4,
-    0xFC, 0x00, 0xF8, 0x0F, 0x40, 0x78, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0,
-    0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00,
-    0x15, 0x40, 0x00, 0x01, 0x40, 0x14, 0x03, 0xF8, 0x2F, 0xC0, 0xFE, 0x0B, 0xF0, 0x1F, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xFE,
-    0x07, 0xE0, 0x0F, 0xD3, 0xF0, 0x01, 0xF9, 0xF4, 0x00, 0x3F, 0xBD, 0x00, 0x0F, 0xEF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xFF, 0x80, 0x19, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x80, 0x01, 0x54, 0x00, 0x14, 0x00,
-    0x03, 0xD0, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x7F, 0xF4, 0x00, 0x7F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x1B, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0x00, 0xF4, 0x00,
-    0x2F, 0x40, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x2E, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x40, 0x7F, 0xF4, 0x00, 0x7F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x1B, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0xF0,
-    0x2F, 0x0F, 0x87, 0xD0, 0x7C, 0xB4, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x7F,
-    0xF4, 0x00, 0x7F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4,
-    0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x1B, 0xFF, 0x83,
-    0xFF, 0xFC, 0x09, 0x00, 0x50, 0xFD, 0x0F, 0xE3, 0xF4, 0x3F, 0x8B, 0x80, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x1F, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7D,
-    0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40, 0x06, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x3C, 0x00, 0x0F, 0xD7, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x1E, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x02, 0xFF, 0x8F, 0x40, 0x3F, 0xFF, 0xFF, 0x03, 0xF4, 0x07, 0xFC, 0x2F, 0x00, 0x03, 0xF4,
-    0xF8, 0x00, 0x0B, 0xE7, 0xD0, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x03, 0xFB, 0xD0, 0x00, 0x0F, 0xAF, 0xC0, 0x00, 0x7D, 0x3F, 0x40, 0x03, 0xF0, 0xBF, 0x40,
-    0x2F, 0x40, 0xFF, 0xEF, 0xF8, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x81, 0xC0, 0x00, 0x02, 0xFF, 0xDF, 0x40, 0x00, 0x0B, 0x8F, 0xFD, 0x00,
-    0x00, 0x1C, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x0B, 0xF0, 0xBF, 0xF8, 0x01, 0xFF, 0xDF, 0xFF, 0xF4, 0x01, 0xBF, 0xF8, 0x1F,
-    0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x00,
-    0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0,
-    0x00, 0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F,
-    0x40, 0x6F, 0xFD, 0x02, 0xFF, 0xE3, 0xFF, 0xF4, 0x1F, 0xFF, 0xC0, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E,
-    0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD,
-    0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F,
-    0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F,
-    0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F,
-    0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x3E, 0xFC, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x02, 0xD0, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC,
-    0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF,
-    0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0B, 0x00, 0x03,
-    0xFF, 0x9F, 0x00, 0x03, 0xD7, 0xFF, 0x00, 0x01, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC,
-    0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF,
-    0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x01, 0x90, 0x05, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x07,
-    0xF4, 0x3F, 0x40, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F,
-    0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F,
-    0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE1, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0,
-    0x1F, 0xF0, 0x0F, 0xC0, 0x02, 0xFD, 0x03, 0xE0, 0x02, 0xFF, 0x82, 0xF4, 0x02, 0xF3, 0xF0, 0xBC,
-    0x02, 0xF0, 0xFC, 0x3F, 0x02, 0xF0, 0x3F, 0x0F, 0xC2, 0xF0, 0x0F, 0xC2, 0xF6, 0xF0, 0x03, 0xF0,
-    0xBF, 0xF0, 0x00, 0xF8, 0x0F, 0xF0, 0x00, 0xBC, 0x03, 0xFC, 0x00, 0xBE, 0x02, 0xFF, 0xFA, 0xFE,
-    0x00, 0xF2, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8,
-    0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07,
-    0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00,
-    0x3E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0,
-    0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8,
-    0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F,
-    0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00,
-    0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F,
-    0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00,
-    0x00, 0xF8, 0x0F, 0x40, 0x00, 0x07, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F,
-    0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00,
-    0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04, 0x00, 0x00,
-    0x14, 0x01, 0x40, 0x00, 0x03, 0xF8, 0x2F, 0x80, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x1F, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0xBF, 0x80, 0xBF, 0xF0, 0x0B, 0xFE, 0x00, 0x6F, 0x80, 0x02, 0xF8, 0x00, 0x3E,
-    0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01,
-    0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00,
-    0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFE, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xBF, 0xF4, 0x01, 0xFF, 0xF4, 0xBF, 0xD0, 0x00, 0x54, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x7F, 0xFD, 0x02, 0xFF, 0x80, 0xFD,
-    0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x01, 0xF0,
-    0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x3F,
-    0x0F, 0x40, 0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x14, 0x00, 0x02, 0xF1, 0xFF, 0xF0, 0x00,
-    0xBE, 0xFF, 0xFF, 0x00, 0x2F, 0xF4, 0x2F, 0xF0, 0x0B, 0xE0, 0x01, 0xFD, 0x02, 0xF0, 0x00, 0x2F,
-    0x80, 0xBC, 0x00, 0x07, 0xE0, 0x2F, 0x00, 0x01, 0xFC, 0x0B, 0xC0, 0x00, 0x3F, 0x02, 0xF0, 0x00,
-    0x1F, 0x80, 0xBC, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x01, 0xF8, 0x02, 0xF4,
-    0x01, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x60, 0x06, 0x40, 0x00, 0x1F, 0xC0,
-    0xFC, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x7F, 0xFD, 0x02,
-    0xFF, 0x80, 0xFD, 0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x02,
-    0xF4, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0xBC,
-    0x00, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03,
-    0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0,
-    0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x0A, 0xAA, 0xA8, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x03, 0xFE, 0xFF, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0xFC, 0x00, 0xF8,
-    0x01, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x7F, 0x00, 0x0B, 0xFF, 0xFC, 0x01,
-    0xFF, 0xEB, 0xF0, 0x0F, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0xFC, 0x07, 0xF0,
-    0x0F, 0xF4, 0x0F, 0xFF, 0xFB, 0xFF, 0x0F, 0xFF, 0x0F, 0xF0, 0x05, 0x40, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x7C, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00,
-    0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9, 0x00,
-    0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x70, 0x00,
-    0xF8, 0x07, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0xEF, 0xF0, 0x03, 0xF4, 0x0B,
-    0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x1D, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x17, 0xF0,
-    0x00, 0xBF, 0xFF, 0xC0, 0x1F, 0xFE, 0xBF, 0x00, 0xFD, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xF0, 0x2F,
-    0x40, 0x0F, 0xC0, 0x7F, 0x00, 0xFF, 0x40, 0xFF, 0xFF, 0xBF, 0xF0, 0xFF, 0xF0, 0xFF, 0x00, 0x54,
-    0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0x3F, 0x00, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xC0, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02,
-    0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xFE, 0xAA, 0xAF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x3E, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA,
-    0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD,
-    0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x0B, 0x80, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xD0,
-    0x07, 0xD0, 0x1F, 0x80, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x3D, 0x0B, 0xD0, 0x00, 0x0B, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xE5,
-    0x5A, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xD0, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xFE, 0x00,
-    0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x03, 0x87, 0xD0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xF8, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F,
-    0x5F, 0xC0, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x0B, 0x40, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xD0, 0x07, 0xD0,
-    0x1F, 0x80, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x3D, 0x0B, 0xD0, 0x00, 0x0B, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xE5, 0x5A, 0xD0,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0xF4, 0xBC, 0x00, 0xF8, 0x0F,
-    0x80, 0x38, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF,
-    0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x03, 0x87, 0xD0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xD0, 0x07, 0xD0, 0x1F, 0x80,
-    0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x3D, 0x0B, 0xD0, 0x00, 0x0B, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xE5, 0x5A, 0xD0, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0B,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x03, 0xF0, 0x0F, 0xD2, 0xF0, 0x01, 0xF4, 0xF8,
-    0x00, 0x38, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x90, 0x05, 0x0F, 0xFF, 0xFF, 0x80,
-    0xBF, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x1F, 0x40, 0x7E, 0x00, 0x03,
-    0xF4, 0x7E, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x2F, 0xD0, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x3D, 0x0B, 0xD0, 0x00,
-    0x0B, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0xE5, 0x5A, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x01, 0x00, 0x04, 0x02, 0xE0, 0x0F, 0x80, 0x3D, 0x0B, 0xC0, 0x0B, 0xD7, 0xC0, 0x00,
-    0xBF, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x03, 0x87,
-    0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xF8,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x80, 0x00, 0x90, 0x00, 0x01, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0xFD,
-    0x1F, 0x80, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFA, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xE0,
-    0x03, 0xF0, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x03, 0xF0,
-    0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x01, 0xF8, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x2F,
-    0xC0, 0x03, 0xF0, 0x06, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0x7F, 0xF0, 0x3C, 0x00,
-    0x00, 0xBF, 0xF0, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0xB8, 0x00, 0x00,
-    0x03, 0xF0, 0xB0, 0x00, 0x00, 0x03, 0xF0, 0xB0, 0x00, 0x01, 0x43, 0xF0, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0xBE,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xE1, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x40, 0x00, 0x00, 0x05, 0x55,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xEB, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x01,
-    0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xE0, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xD3, 0xFF, 0xFF, 0xE0, 0x03, 0xF4, 0xFF, 0xFF, 0xF8, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x1B, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x1A, 0xBF, 0xA0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x1A, 0xA7, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0x9A, 0xFF, 0x00,
-    0x7E, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x3F,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0xFC, 0x0B, 0xE0, 0x00,
-    0x3F, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0xD0, 0x2F, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFE, 0x1F, 0xF8, 0x00, 0x54, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x1A, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0xFC, 0x00,
-    0x0B, 0x40, 0x3F, 0x00, 0x01, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x05, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x06,
-    0x00, 0xFC, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x05, 0xBC, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xAA, 0xA9, 0x02, 0xFF, 0xFF, 0x80, 0x6A, 0xAA, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0xF8,
-    0x1F, 0x80, 0x3F, 0x4F, 0xC0, 0x07, 0xE7, 0xD0, 0x00, 0xFE, 0xF4, 0x00, 0x3F, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x03, 0xFE, 0x00, 0x64, 0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0xFE, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x60, 0x00, 0x2F, 0x40, 0x78, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00,
-    0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60,
-    0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x02, 0x40, 0xBD, 0x02, 0xD0, 0x0F,
-    0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x81, 0xF8, 0x03, 0xF4, 0xFC, 0x00, 0x7E, 0x7D, 0x00, 0x0F, 0xEF,
-    0x40, 0x03, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x43, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xE0,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00,
-    0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00,
-    0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xFE, 0x07, 0xE0, 0x0F, 0xD3, 0xF0, 0x01, 0xF9, 0xF4, 0x00,
-    0x3F, 0xBD, 0x00, 0x0F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x19, 0x0F, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFF, 0x80, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x2D, 0x00, 0xFC, 0x00, 0x07, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x15, 0x54, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x18, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00,
-    0x03, 0xC0, 0x3F, 0x00, 0x16, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB,
-    0xD0, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8,
-    0x00, 0x16, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0x80, 0x00, 0xF8, 0x03, 0xF0, 0x00,
-    0x1F, 0x83, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00,
-    0x0F, 0x00, 0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0x00,
-    0x04, 0x02, 0xD0, 0x0F, 0x40, 0x7D, 0x0F, 0x80, 0x0B, 0xCB, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F,
-    0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0xBC, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x3C, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x1F, 0xE0, 0x00, 0xBC, 0x01, 0xFC, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0xBD, 0x00,
-    0x00, 0x0E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x15, 0x55, 0x6F, 0x80, 0x01, 0xFF, 0xFE, 0xBF,
-    0x00, 0x01, 0xAF, 0xF1, 0xFC, 0x00, 0x00, 0x1F, 0x83, 0xF4, 0x00, 0x00, 0x7E, 0x0F, 0xF0, 0x00,
-    0x01, 0xF8, 0x1F, 0xF0, 0x00, 0x07, 0xE0, 0x1F, 0xF9, 0x00, 0x6F, 0x80, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBE, 0xF4, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00,
-    0x3E, 0x03, 0xE0, 0x00, 0x0E, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x1F, 0x80, 0x2F, 0x44, 0x0B, 0xC0, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF4,
-    0x1F, 0xD0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x3E, 0xFF, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF9, 0x55, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0x80, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x03,
-    0xF0, 0x3F, 0xE5, 0x6F, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x00, 0xF8, 0x03, 0xC0, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xE0,
-    0x00, 0xBC, 0x01, 0xFC, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0xBD, 0x00, 0x00, 0x0E,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x15, 0x55, 0x6F, 0x80, 0x01, 0xFF, 0xFE, 0xBF, 0x00, 0x01,
-    0xAF, 0xF1, 0xFC, 0x00, 0x00, 0x1F, 0x83, 0xF4, 0x00, 0x00, 0x7E, 0x0F, 0xF0, 0x00, 0x01, 0xF8,
-    0x1F, 0xF0, 0x00, 0x07, 0xE0, 0x1F, 0xF9, 0x00, 0x6F, 0x80, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0xA0,
-    0x00, 0x1F, 0x40, 0xB8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x7E, 0x00, 0xBD, 0x10, 0x2F, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x7F, 0x40, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0xFB, 0xFE, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xE5, 0x55,
-    0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x3E, 0x00, 0x01, 0xFC, 0x3F, 0x00,
-    0x00, 0x3F, 0x0F, 0x80, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x0F, 0xC0, 0xFF, 0x95, 0xBF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x6B, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0xBC, 0x01, 0xFC, 0x00, 0x01,
-    0xF0, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0xBD, 0x00, 0x00, 0x0E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x15, 0x55, 0x6F, 0x80, 0x01, 0xFF, 0xFE, 0xBF, 0x00, 0x01, 0xAF, 0xF1, 0xFC, 0x00, 0x00, 0x1F,
-    0x83, 0xF4, 0x00, 0x00, 0x7E, 0x0F, 0xF0, 0x00, 0x01, 0xF8, 0x1F, 0xF0, 0x00, 0x07, 0xE0, 0x1F,
-    0xF9, 0x00, 0x6F, 0x80, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0x41, 0xF8, 0x02, 0xF4, 0x40, 0xBC, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x41,
-    0xFD, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x03, 0xEF, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x95, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0xF8, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x3F,
-    0x03, 0xFE, 0x56, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xAF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x02,
-    0xF0, 0x07, 0xF0, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x0F, 0x02, 0xF4, 0x00, 0x00, 0x38, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x55, 0x55, 0xBE, 0x00, 0x07, 0xFF, 0xFA, 0xFC, 0x00, 0x06, 0xBF,
-    0xC7, 0xF0, 0x00, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0x01, 0xF8, 0x3F, 0xC0, 0x00, 0x07, 0xE0, 0x7F,
-    0xC0, 0x00, 0x1F, 0x80, 0x7F, 0xE4, 0x01, 0xBE, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFD, 0x07, 0xE0, 0x0B, 0xD1, 0x02,
-    0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x03, 0xF0,
-    0x00, 0xFD, 0x07, 0xF4, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x0F, 0xBF, 0xE0, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x55, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0xFE, 0x03, 0xE0, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xF8, 0x00, 0x00, 0xF8, 0x3F,
-    0x00, 0x00, 0xFC, 0x0F, 0xF9, 0x5B, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xBE, 0x90, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x1F, 0xFF, 0xF1, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0x40, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF5, 0x55, 0x55,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x3F, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFC, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xCB, 0xD0, 0x00, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x00, 0x28, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x40, 0x00, 0x00, 0xFC, 0x7F, 0xFD,
-    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x7F, 0x80, 0x00, 0xFE, 0x00, 0x1F, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x07, 0xFF, 0xC0,
-    0x2F, 0xFD, 0x0F, 0xFF, 0xC0, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0x40, 0x03, 0xFF, 0xE4, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFD, 0x55,
-    0x55, 0x7F, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x00, 0x02, 0xBF, 0xA9, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x2A, 0x90, 0x00,
-    0x0F, 0xCB, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x2F, 0xC0, 0x03, 0xF4,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xD3, 0xFF, 0xF0,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x43, 0x83, 0xFF, 0x9F, 0x0F, 0x6F, 0xFC, 0x28, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x7F, 0xFE, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFD, 0x0F, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xF8, 0x2C, 0xBF, 0xE7, 0xDF, 0x4F, 0xFC, 0x70, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4,
-    0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC2,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x07, 0xFF, 0xE0,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x0B, 0xFF, 0xD0, 0xFF,
-    0xFF, 0x80, 0x6A, 0xAA, 0x8F, 0xFF, 0xFC, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01,
-    0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xC3, 0xE0, 0x0F, 0x0F,
-    0xFF, 0xF8, 0x0B, 0xFF, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x7F, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xBF,
-    0xFD, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0x00, 0x0C, 0xFC, 0x03, 0xC7, 0xFF, 0xF8, 0x1F, 0xFE,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xE7, 0xFF, 0xE0, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xBF, 0xFD, 0xFF, 0xFF, 0x80, 0xB8, 0x00,
-    0xF8, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x03, 0xFF, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01,
-    0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x40, 0x1F,
-    0xD0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0xFF, 0x80, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x02, 0xFF, 0xF7, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x7F, 0xF4, 0x00, 0x7F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x1B, 0xFF, 0x83, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8B, 0xFF, 0xFC, 0x7F, 0xFE, 0x07, 0xFF, 0xE4, 0x03, 0xF0,
-    0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00,
-    0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F,
-    0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40,
-    0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03,
-    0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x2F, 0xFF,
-    0x40, 0x3F, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFD, 0x07, 0xF8,
-    0x01, 0xFE, 0x03, 0xF8, 0x01, 0xFD, 0x01, 0xA0, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x06, 0xFC, 0x7F, 0xF4, 0x1F, 0xFC, 0x07, 0xF4,
-    0x01, 0xFC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4,
-    0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4,
-    0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x1B, 0xFF, 0x80, 0xBC, 0x3F, 0xFF,
-    0xC0, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xF2, 0xF4, 0x02, 0xF0, 0x2F, 0x00, 0xF0,
-    0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x7E, 0xF4, 0x03, 0xE2, 0xF0, 0x2F, 0x03, 0xE0, 0xE0, 0x03,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x5F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x0B, 0xF4, 0x01, 0xFF, 0x40, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x7F, 0xFF, 0x47, 0xFF, 0xE0,
-    0x07, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x03, 0xF1, 0xFC,
-    0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x07, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xE0, 0xFF, 0xFF, 0x40, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x2F, 0xFF, 0x80, 0x3F, 0x01, 0xFF, 0xF4, 0x03, 0xF0, 0x07, 0xF4, 0x00, 0x3F, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x3F,
-    0x80, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0xE0, 0x1F, 0xF4, 0x3F,
-    0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x41, 0xFF,
-    0xFC, 0x7F, 0xF4, 0x1F, 0xFF, 0x80, 0x7F, 0x40, 0x3F, 0x40, 0x01, 0xF4, 0x0F, 0xD0, 0x00, 0x1F,
-    0x43, 0xF0, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x1F, 0x6F, 0xC0, 0x00, 0x01, 0xF4, 0xFF, 0x00, 0x00, 0x1F, 0x43, 0xFC, 0x00, 0x01, 0xF4,
-    0x0F, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0xC0, 0x0B, 0xFE, 0x00, 0xFF, 0x83, 0xFF, 0xF4, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xB0, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x1F, 0x00,
-    0xFC, 0x00, 0x5F, 0xC2, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x0B, 0xF0, 0x2F, 0xFC, 0x3F, 0xE4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xF0,
-    0x1F, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00,
-    0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x1F, 0xFF, 0x9F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x2C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x17,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0B, 0xFC,
-    0x07, 0xFF, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x07, 0xFF, 0xE7, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xF4, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xFF,
-    0xFF, 0x0F, 0x80, 0x7F, 0xFE, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x34, 0x00,
-    0x0F, 0xC0, 0x04, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xC0, 0x3F,
-    0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x7C, 0x03, 0xF0, 0x01, 0x7F, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x50, 0x10, 0x2F, 0xF0, 0x3D, 0x7F, 0xF0, 0x3E, 0x03, 0xF0, 0x3D,
-    0x02, 0xF0, 0x3C, 0x02, 0xF0, 0x78, 0x02, 0xF0, 0x70, 0x02, 0xF0, 0x10, 0x02, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x02, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0x80, 0x03, 0xF0, 0x03, 0xFC, 0x00,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x01, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2C, 0x03, 0xF0, 0x00,
-    0x0F, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x17, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x50, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x06, 0x40, 0x2F, 0x00, 0xFD, 0x02, 0xF0, 0x1F,
-    0xD0, 0x2F, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x80, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0xB4, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2C,
-    0x00, 0x3F, 0x00, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x01, 0x7F, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC,
-    0x20, 0x02, 0xF7, 0xD0, 0x0B, 0xFD, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0xF0, 0x03, 0xFF,
-    0xC0, 0x0E, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00,
-    0xBC, 0x00, 0x1F, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF6, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x03,
-    0xFE, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
-    0x3D, 0xBE, 0x00, 0x03, 0xC0, 0x03, 0xD3, 0xF4, 0x00, 0x3C, 0x00, 0x3D, 0x1F, 0xC0, 0x03, 0xC0,
-    0x03, 0xD0, 0xBE, 0x00, 0x3C, 0x00, 0x3D, 0x03, 0xF4, 0x03, 0xC0, 0x03, 0xD0, 0x1F, 0xC0, 0x3C,
-    0x00, 0x3D, 0x00, 0xBF, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xF4, 0x3C, 0x00, 0x3D, 0x00, 0x0F, 0xC3,
-    0xC0, 0x03, 0xD0, 0x00, 0x7F, 0x3C, 0x00, 0x3D, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xD0, 0x00, 0x0F,
-    0xFC, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0x00, 0x02, 0xFC, 0x0F, 0xFF, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x2F, 0xC2, 0xFF, 0xE0, 0x07, 0xFF, 0x7F, 0xFF, 0xD0, 0x06, 0xFF, 0xE0, 0x7F,
-    0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00,
-    0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x40,
-    0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD,
-    0x01, 0xBF, 0xF4, 0x0B, 0xFF, 0x8F, 0xFF, 0xD0, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x03, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xC0, 0x03, 0xDB, 0xE0, 0x00, 0x3C,
-    0x00, 0x3D, 0x3F, 0x40, 0x03, 0xC0, 0x03, 0xD1, 0xFC, 0x00, 0x3C, 0x00, 0x3D, 0x0B, 0xE0, 0x03,
-    0xC0, 0x03, 0xD0, 0x3F, 0x40, 0x3C, 0x00, 0x3D, 0x01, 0xFC, 0x03, 0xC0, 0x03, 0xD0, 0x0B, 0xF0,
-    0x3C, 0x00, 0x3D, 0x00, 0x3F, 0x43, 0xC0, 0x03, 0xD0, 0x00, 0xFC, 0x3C, 0x00, 0x3D, 0x00, 0x07,
-    0xF3, 0xC0, 0x03, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xD0, 0x00,
-    0x07, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F,
-    0xC2, 0xFF, 0xE0, 0x07, 0xFF, 0x7F, 0xFF, 0xD0, 0x06, 0xFF, 0xE0, 0x7F, 0xC0, 0x01, 0xFC, 0x00,
-    0x3F, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0,
-    0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D,
-    0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x01, 0xBF, 0xF4, 0x0B,
-    0xFF, 0x8F, 0xFF, 0xD0, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18,
-    0x00, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xBD,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF6, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xC0, 0x03, 0xFF,
-    0xC0, 0x00, 0x3C, 0x00, 0x3D, 0xBE, 0x00, 0x03, 0xC0, 0x03, 0xD3, 0xF4, 0x00, 0x3C, 0x00, 0x3D,
-    0x1F, 0xC0, 0x03, 0xC0, 0x03, 0xD0, 0xBE, 0x00, 0x3C, 0x00, 0x3D, 0x03, 0xF4, 0x03, 0xC0, 0x03,
-    0xD0, 0x1F, 0xC0, 0x3C, 0x00, 0x3D, 0x00, 0xBF, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xF4, 0x3C, 0x00,
-    0x3D, 0x00, 0x0F, 0xC3, 0xC0, 0x03, 0xD0, 0x00, 0x7F, 0x3C, 0x00, 0x3D, 0x00, 0x03, 0xFF, 0xC0,
-    0x03, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0x00, 0x02, 0xFC,
-    0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x10,
-    0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xC2, 0xFF, 0xE0, 0x07, 0xFF, 0x7F, 0xFF, 0xD0,
-    0x06, 0xFF, 0xE0, 0x7F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F,
-    0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00,
-    0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40,
-    0x07, 0xD0, 0x00, 0xBD, 0x01, 0xBF, 0xF4, 0x0B, 0xFF, 0x8F, 0xFF, 0xD0, 0x7F, 0xFF, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x14, 0x00, 0x01, 0xF0, 0x06, 0xF8, 0x3F,
-    0xFD, 0x00, 0x3C, 0x01, 0xFF, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x7F, 0x80, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0xD0,
-    0x00, 0x03, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xC0, 0x03, 0xDB,
-    0xD0, 0x00, 0x3C, 0x00, 0x3D, 0x3F, 0x00, 0x03, 0xC0, 0x03, 0xD1, 0xFC, 0x00, 0x3C, 0x00, 0x3D,
-    0x0B, 0xD0, 0x03, 0xC0, 0x03, 0xD0, 0x3F, 0x00, 0x3C, 0x00, 0x3D, 0x01, 0xFC, 0x03, 0xC0, 0x03,
-    0xD0, 0x0B, 0xE0, 0x3C, 0x00, 0x3D, 0x00, 0x3F, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0xFC, 0x3C, 0x00,
-    0x3D, 0x00, 0x07, 0xE3, 0xC0, 0x03, 0xD0, 0x00, 0x3F, 0x7C, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xC0,
-    0x03, 0xD0, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0x40, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x1F,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xFC, 0x2F, 0xFE, 0x07, 0xFF, 0x7F, 0xFF, 0xD0, 0x6F,
-    0xFE, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x02, 0xF4,
-    0x07, 0xD0, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x7D, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x02,
-    0xF4, 0x07, 0xD0, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x7D, 0x00, 0x0B, 0xD0, 0xBF, 0xF4,
-    0x02, 0xF4, 0xFF, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x01, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x16, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xEF, 0xFF, 0x00, 0x03, 0xFD,
-    0x00, 0x2F, 0xF0, 0x02, 0xFC, 0x00, 0x01, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xBE, 0x00,
-    0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x80, 0x00,
-    0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xF4, 0x00,
-    0xBF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x01, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00,
-    0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE,
-    0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x07, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x69, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xF0, 0x00, 0x3F,
-    0xD0, 0x02, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF8, 0x00,
-    0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0x40,
-    0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x03, 0x00, 0x03, 0xF0, 0x0F, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F,
-    0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F,
-    0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x2C, 0x00, 0x00, 0x03,
-    0xF0, 0x2F, 0x40, 0x00, 0x07, 0xF8, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x3F, 0xC0, 0x00, 0x07, 0xE0,
-    0x3F, 0x40, 0x00, 0x00, 0xD0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xBF, 0xFC, 0x00, 0x0F, 0xF4, 0x00,
-    0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x07, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x00,
-    0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x00,
-    0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFE, 0x00, 0x00, 0x03,
-    0xF4, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xD0, 0x02, 0xFD,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0xA0, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F,
-    0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01,
-    0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xE4, 0x03, 0xF0, 0x00, 0x3D, 0x07,
-    0xF4, 0x00, 0x3F, 0x00, 0x03, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2C, 0x2F, 0x80, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x03, 0xF0, 0x55, 0x40, 0xBE, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x0B, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x05, 0x1F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xF0, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x1F, 0x03, 0xFE, 0x40, 0x3F, 0x00, 0x17,
-    0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0xBF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0xBF, 0xFC, 0x02, 0xF4, 0x3F, 0x00, 0x0B,
-    0xFD, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x2F, 0x80, 0x03, 0xF2,
-    0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x3F, 0x40, 0x00, 0x7D,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0xF4, 0x01, 0x80, 0xFF, 0xEF, 0xF2, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0xBF, 0xF0,
-    0x00, 0x03, 0xF0, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00,
-    0x03, 0xF0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x07, 0xF0, 0x00, 0x03, 0xF5, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFA,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x1F,
-    0xD0, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x40, 0x2F, 0xFF, 0x40, 0x3F, 0xE0, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFC, 0x1F,
-    0xF7, 0xFF, 0x2F, 0xFC, 0x6F, 0xEF, 0xAE, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x15,
-    0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x07,
-    0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xBD,
-    0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00,
-    0x03, 0xF5, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0,
-    0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x2F, 0xFF, 0x40,
-    0x3F, 0xE0, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x02, 0xFC, 0x1F, 0xF7, 0xFF, 0x2F, 0xFC, 0x6F, 0xEF, 0xAE, 0x01, 0xFE, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xBF, 0xFE, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x00, 0x06,
-    0x40, 0x00, 0x0B, 0xC0, 0x1F, 0x40, 0x00, 0x03, 0xF4, 0xBD, 0x00, 0x00, 0x00, 0xFE, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0xBF, 0xF0, 0x00, 0x03,
-    0xF0, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07,
-    0xF0, 0x00, 0x03, 0xF5, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x1F, 0xD0, 0x00,
-    0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x2F,
-    0xFF, 0x40, 0x3F, 0xE0, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x04, 0x03, 0xC0, 0x1F, 0x00, 0xBC, 0x0F, 0x40, 0x0F, 0xCF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFC, 0x1F, 0xF7, 0xFF,
-    0x2F, 0xFC, 0x6F, 0xEF, 0xAE, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07,
-    0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFC, 0x1F,
-    0xD0, 0x0F, 0xC2, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x74, 0x3F, 0xC0, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0x00, 0xFD, 0xB8, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xBD,
-    0xBC, 0x00, 0x0F, 0xCB, 0xF0, 0x03, 0xF8, 0xBF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F,
-    0x40, 0x00, 0x3C, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xF8,
-    0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC, 0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x10, 0x2F, 0xE0, 0x00, 0x0F,
-    0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFC, 0x38, 0x00, 0x7D, 0x3C, 0x00,
-    0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x01, 0x54, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xCF, 0xD0, 0x03, 0xF0, 0x2F, 0x00, 0x78,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFC,
-    0x1F, 0xD0, 0x0F, 0xC2, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x74, 0x3F, 0xC0,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0x00, 0xFD, 0xB8, 0x00, 0x0B, 0xDB, 0xC0, 0x00,
-    0xBD, 0xBC, 0x00, 0x0F, 0xCB, 0xF0, 0x03, 0xF8, 0xBF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFB, 0xD0, 0x03,
-    0xD3, 0xF0, 0x0F, 0x80, 0xF4, 0x1E, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF,
-    0xF8, 0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC, 0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x10, 0x2F, 0xE0, 0x00,
-    0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFC, 0x38, 0x00, 0x7D, 0x3C,
-    0x00, 0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x01, 0x54, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xC1, 0xFD, 0x00, 0xFC, 0x2F, 0x40, 0x0B, 0xC3,
-    0xF0, 0x00, 0x7C, 0x3F, 0x00, 0x07, 0x43, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x10,
-    0x00, 0x0F, 0xDB, 0x80, 0x00, 0xBD, 0xBC, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xFC, 0xBF, 0x00, 0x3F,
-    0x8B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x54, 0x00, 0x00, 0x09, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x17, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xF8, 0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC,
-    0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x10, 0x2F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-    0x7F, 0xF8, 0x00, 0x02, 0xFC, 0x38, 0x00, 0x7D, 0x3C, 0x00, 0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB,
-    0xF4, 0x2F, 0xFF, 0xD0, 0x01, 0x54, 0x00, 0x00, 0x64, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x6F, 0x80,
-    0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0A, 0x00,
-    0xF8, 0x03, 0xF0, 0x07, 0xE0, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFC, 0x1F,
-    0xD0, 0x0F, 0xC2, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x74, 0x3F, 0xC0, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0x00, 0xFD, 0xB8, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xBD,
-    0xBC, 0x00, 0x0F, 0xCB, 0xF0, 0x03, 0xF8, 0xBF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x40, 0x00, 0x04, 0x00, 0x10, 0x2E, 0x00, 0xF8, 0x1F, 0x43, 0xF0, 0x0B, 0xCB, 0xC0, 0x03, 0xFF,
-    0x40, 0x00, 0xFE, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xF8,
-    0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC, 0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x10, 0x2F, 0xE0, 0x00, 0x0F,
-    0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFC, 0x38, 0x00, 0x7D, 0x3C, 0x00,
-    0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0x3F, 0x40, 0x3E, 0xF4,
-    0x03, 0xF4, 0x03, 0xDF, 0x00, 0x3F, 0x40, 0x2D, 0x70, 0x03, 0xF4, 0x02, 0x80, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xF8, 0x57, 0xF5, 0x50, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x19, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x1B, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x80, 0x00, 0x90, 0x00, 0x1F, 0x40, 0x7E, 0x00, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0x03,
-    0xFB, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0x03,
-    0xF4, 0x03, 0xEF, 0x40, 0x3F, 0x40, 0x3D, 0xF0, 0x03, 0xF4, 0x02, 0xD7, 0x00, 0x3F, 0x40, 0x28,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0xA1,
-    0xD0, 0x03, 0xE1, 0xC0, 0x03, 0xE0, 0x40, 0x03, 0xE0, 0x00, 0x1B, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8,
-    0x57, 0xF5, 0x50, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0x3F, 0x40, 0x3E, 0xF4, 0x03, 0xF4, 0x03,
-    0xDF, 0x00, 0x3F, 0x40, 0x2D, 0x70, 0x03, 0xF4, 0x02, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x06, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xA0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x57, 0xF5, 0x50, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x57, 0xF5, 0x50, 0xBF, 0xFF, 0xF0, 0x17, 0xF5, 0x50,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x3D, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0x81, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00,
-    0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00,
-    0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4,
-    0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B,
-    0xF8, 0x01, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x0B,
-    0xFF, 0x7D, 0x00, 0x00, 0x2E, 0x3F, 0xF4, 0x00, 0x00, 0x30, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFE, 0x02,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0,
-    0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F,
-    0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0xFF, 0xD0, 0x07, 0xFF,
-    0xD2, 0xFF, 0x40, 0x01, 0x50, 0x01, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0,
-    0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4,
-    0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF8, 0x01, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x90,
-    0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x2F, 0xE0, 0x2F, 0xFC, 0x02,
-    0xFF, 0x80, 0x1B, 0xE0, 0x00, 0xBE, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0,
-    0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E,
-    0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02,
-    0xF8, 0x00, 0x3F, 0x80, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0xEF, 0xFD, 0x00, 0x7F, 0xFD, 0x2F, 0xF4,
-    0x00, 0x15, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00,
-    0x00, 0x07, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00,
-    0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00,
-    0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4,
-    0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B,
-    0xF8, 0x01, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x02, 0x40, 0x00, 0x0B,
-    0xD0, 0x2D, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFE, 0x02,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0,
-    0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F,
-    0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0xFF, 0xD0, 0x07, 0xFF,
-    0xD2, 0xFF, 0x40, 0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xF5, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0,
-    0x3C, 0x00, 0x00, 0x00, 0x0F, 0x9B, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE,
-    0x00, 0x0B, 0xFF, 0x80, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x02, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x80, 0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xE0, 0xF4, 0x00, 0x00, 0x0B, 0x42, 0xE0, 0x00, 0x00,
-    0x2E, 0x0B, 0x40, 0x00, 0x00, 0x7D, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0,
-    0x06, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E,
-    0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01,
-    0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00,
-    0x0F, 0xE0, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05,
-    0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x01, 0xFE, 0x0B, 0xF0, 0x00, 0x00,
-    0x3F, 0x02, 0xF8, 0x00, 0x00, 0x03, 0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE, 0x00, 0x0B, 0xFF, 0x80,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0xBF, 0x80, 0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x07, 0x81,
-    0xE0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x00, 0x0F, 0x83, 0xE0, 0x00,
-    0x00, 0x7C, 0x2F, 0x00, 0x00, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F,
-    0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00,
-    0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE, 0x00, 0x0B, 0xFF, 0x80,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0xBF, 0x80, 0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x7E,
-    0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03,
-    0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
-    0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFB, 0xFF,
-    0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x01, 0x40, 0x01, 0xFF, 0xFE, 0x2F,
-    0xFF, 0x80, 0x03, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x01,
-    0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x40, 0x00,
-    0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x3E, 0x7D, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x00, 0x3C, 0x3F, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x40, 0x7C, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0xB8, 0x1F, 0x40, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0xF4, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0x0B, 0xC1, 0xF0, 0x0F, 0xC2, 0xF0, 0x00, 0x00,
-    0x07, 0xD2, 0xE0, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xD0, 0x03, 0xE3, 0xC0, 0x00, 0x00,
-    0x02, 0xF7, 0xC0, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x0B, 0x00, 0x3F, 0xFD,
-    0x3F, 0xFD, 0x00, 0xF4, 0x02, 0xFF, 0xC0, 0xFD, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x07, 0xE0, 0x02,
-    0xFC, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x3F, 0xD0, 0x0B, 0xC0, 0x02, 0xF4, 0x07, 0xFE, 0x00, 0xF8,
-    0x00, 0x1F, 0x80, 0xBA, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x0F, 0x1F, 0x42, 0xF0, 0x00, 0x0B, 0xC1,
-    0xF0, 0xF8, 0x3D, 0x00, 0x00, 0x3D, 0x2D, 0x0B, 0xC3, 0xC0, 0x00, 0x03, 0xF3, 0xC0, 0x7D, 0x78,
-    0x00, 0x00, 0x2F, 0x78, 0x03, 0xEF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xD7, 0xF0, 0x00, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x00, 0x2D, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE, 0x7F,
-    0xFE, 0x00, 0x6F, 0xF8, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFD,
-    0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC1,
-    0xF0, 0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFB, 0xE0, 0x00,
-    0x00, 0x3E, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0xF0, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x7F, 0xFD, 0x02, 0xFF, 0x80,
-    0xFD, 0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x01,
-    0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00,
-    0x3F, 0x0F, 0x40, 0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00,
-    0x3F, 0x43, 0xF8, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0,
-    0xBF, 0xFE, 0x7F, 0xFE, 0x00, 0x6F, 0xF8, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F,
-    0x80, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00,
-    0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x07, 0xF4, 0x7C, 0x00, 0x0F,
-    0xE0, 0x78, 0x00, 0x1F, 0xC0, 0x24, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1C, 0x0F, 0xC0, 0x00,
-    0x3C, 0x3F, 0x40, 0x00, 0x7C, 0xBF, 0x00, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xD1, 0xF4, 0x02, 0xF8, 0x1D,
-    0x00, 0x7F, 0x01, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x0E, 0x0B, 0xE0, 0x01, 0xE1, 0xF8,
-    0x00, 0x3E, 0x3F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x07, 0xF4, 0x7C, 0x00, 0x0F, 0xE0, 0x78, 0x00, 0x1F,
-    0xC0, 0x24, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1C, 0x0F, 0xC0, 0x00, 0x3C, 0x3F, 0x40, 0x00,
-    0x7C, 0xBF, 0x00, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
-    0xD1, 0xF4, 0x02, 0xF8, 0x1D, 0x00, 0x7F, 0x01, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x0E,
-    0x0B, 0xE0, 0x01, 0xE1, 0xF8, 0x00, 0x3E, 0x3F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x06, 0x40, 0x0B, 0xC0, 0x2F, 0x40, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0xFE,
-    0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x07, 0xF4, 0x7C, 0x00,
-    0x0F, 0xE0, 0x78, 0x00, 0x1F, 0xC0, 0x24, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1C, 0x0F, 0xC0,
-    0x00, 0x3C, 0x3F, 0x40, 0x00, 0x7C, 0xBF, 0x00, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3C, 0x02, 0xF0, 0x03, 0xE0, 0x7C,
-    0x00, 0x1F, 0x8F, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xD1, 0xF4, 0x02, 0xF8,
-    0x1D, 0x00, 0x7F, 0x01, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x0E, 0x0B, 0xE0, 0x01, 0xE1,
-    0xF8, 0x00, 0x3E, 0x3F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x69, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x2F, 0xAB, 0xF0, 0x07, 0xD0, 0x1D, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x08,
-    0x00, 0xF8, 0x03, 0xF4, 0x07, 0xF0, 0x07, 0xF0, 0x03, 0xE0, 0x01, 0x00, 0x00, 0x40, 0x3E, 0x07,
-    0xF0, 0xFC, 0x3F, 0x47, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xFE, 0x00, 0xBE,
-    0xF4, 0x1F, 0x4F, 0xC3, 0xE0, 0x3D, 0x78, 0x00, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x0D, 0x7F, 0xF7,
-    0xEB, 0x8F, 0xFD, 0x30, 0x2F, 0x80, 0x00, 0x00, 0x2A, 0xAA, 0x9B, 0xFF, 0xFE, 0x6A, 0xAA, 0x80,
-    0x00, 0x00, 0x07, 0x40, 0x09, 0xBD, 0x02, 0xD3, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x05, 0x00, 0x3D,
-    0xFF, 0xFF, 0x7D, 0x14, 0x01, 0x4F, 0xE0, 0xBF, 0xFE, 0x0B, 0xF7, 0xC0, 0x3D, 0x00, 0x00, 0x1F,
-    0xF4, 0x7F, 0xFD, 0xB8, 0x2F, 0x74, 0x2E, 0x00, 0x7C, 0x06, 0xF0, 0x07, 0x80, 0x03, 0x40, 0x0B,
-    0xE0, 0x3F, 0xFC, 0x78, 0x3D, 0xB4, 0x1E, 0xB8, 0x1E, 0x7D, 0x7C, 0x2F, 0xF4, 0x01, 0x40, 0x01,
-    0x00, 0x40, 0x1E, 0x07, 0x80, 0xFC, 0x3F, 0x07, 0xD1, 0xF4, 0x3E, 0x0F, 0x81, 0xF0, 0x7C, 0x03,
-    0x00, 0xC0, 0x00, 0x10, 0x00, 0x4B, 0x40, 0x3D, 0x7D, 0x0F, 0x82, 0xF2, 0xF0, 0x0F, 0xFD, 0x00,
-    0x3F, 0x80, 0x00, 0xA0, 0x00, 0x04, 0x01, 0x00, 0xB4, 0x2D, 0x03, 0xF0, 0xFC, 0x07, 0xD1, 0xF4,
-    0x0B, 0xC2, 0xF0, 0x0F, 0x43, 0xD0, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3F, 0xFF,
-    0xC7, 0x80, 0xBE, 0xB0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x7C, 0x0F, 0x03, 0xE0, 0x3D, 0x07,
-    0xE0, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x3E, 0x0F, 0x83, 0xD2, 0xF0, 0xF0,
-    0x20, 0x00, 0x00, 0x0F, 0xCB, 0xF2, 0xF0, 0xBC, 0x1F, 0x03, 0xE0, 0x3C, 0x02, 0x00, 0x28, 0x3E,
-    0x3E, 0x3D, 0x3C, 0x34, 0x30, 0x00, 0x04, 0x0F, 0xC3, 0xF0, 0xF8, 0xBC, 0x3C, 0x08, 0x00, 0x14,
-    0xBF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0xFE, 0x0B, 0xFB, 0xD0, 0x7E, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x1F, 0xF4, 0x3C, 0x3C, 0x38, 0x2C, 0x3C, 0x3C, 0x1F, 0xF4, 0x01, 0x40, 0x05,
-    0x0B, 0xE0, 0xFC, 0x3F, 0x0F, 0x4F, 0x81, 0x40, 0x19, 0x03, 0xFC, 0x1B, 0xE0, 0x3D, 0x0F, 0xC3,
-    0xF0, 0x14, 0x00, 0x00, 0x40, 0x7C, 0x07, 0xC0, 0x3E, 0x00, 0xFC, 0x02, 0xFF, 0xC2, 0xFE, 0x00,
-    0x00, 0x14, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x28, 0x00, 0xB4, 0x00, 0x3F, 0xE0, 0x0B, 0xEF, 0x41,
-    0xF4, 0xBC, 0x3D, 0x02, 0xD1, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x09, 0xBC, 0x01, 0xE7, 0xFA,
-    0xFC, 0x1F, 0xFF, 0x40, 0x1A, 0x40, 0x1A, 0x40, 0x83, 0xFD, 0x1D, 0xBE, 0xFF, 0xE7, 0x47, 0xFC,
-    0x10, 0x0A, 0x00, 0x7F, 0xFF, 0xEB, 0xFF, 0xFD, 0x15, 0x55, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x3F, 0xFF, 0xC7, 0x80, 0xBE, 0xB0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0xE0,
-    0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0xA0, 0x3F, 0x82, 0xFC, 0x3F, 0x82, 0xFC, 0x1F, 0x00, 0xF4, 0x3C, 0x07, 0xC0, 0x7C, 0x03,
-    0xFD, 0x2F, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00,
-    0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00,
-    0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x50, 0x05, 0x00, 0x00, 0xBE,
-    0x07, 0xF0, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x00, 0xFC, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x02, 0xD0, 0x0F, 0xC0, 0x00, 0x70, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0x55, 0x40, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x3C,
-    0x03, 0xF0, 0x01, 0x6F, 0x0B, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0x80, 0x3F,
-    0x00, 0x7C, 0x00, 0xF4, 0x03, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x70, 0x03,
-    0xF0, 0x02, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x6B, 0xA4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xAA, 0xFF, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x06, 0xFF, 0xF4, 0x00, 0xFC, 0x00, 0xFF, 0xFF, 0x40, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x3D, 0x03,
-    0xF0, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xC0, 0x3F, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x0B, 0xE0, 0x00,
-    0x1F, 0x01, 0xFC, 0x00, 0x01, 0xF0, 0x2F, 0x40, 0x00, 0x0F, 0x03, 0xF0, 0x00, 0x00, 0x40, 0x7E,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x01, 0x40, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x10, 0x3F, 0x80, 0x00, 0x07, 0x81, 0xFE, 0x00, 0x00, 0xFC, 0x0B, 0xF8, 0x00, 0x7F,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xC1, 0xFD, 0x00, 0xFC, 0x2F, 0x40, 0x0B, 0xC3,
-    0xF0, 0x00, 0x7C, 0x3F, 0x00, 0x07, 0x43, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x10,
-    0x00, 0x0F, 0xDB, 0x80, 0x00, 0xBD, 0xBC, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xFC, 0xBF, 0x00, 0x3F,
-    0x8B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE7,
-    0xFF, 0xE0, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xBF, 0xFD, 0xFF, 0xFF, 0x80, 0x14, 0x00, 0x51, 0xFC, 0x0F,
-    0xDB, 0xF0, 0x7F, 0x4F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x1F, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x2F, 0xFF, 0x43, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0xFF, 0xF8, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFC,
-    0x00, 0x2F, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0B, 0xFF, 0xE9, 0x00, 0x00, 0x03, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xC0, 0x0B, 0xE5, 0x6F, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xD0,
-    0x02, 0xF8, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x20, 0xBC,
-    0x00, 0x0B, 0xD0, 0x02, 0xF8, 0x7F, 0xF8, 0x00, 0x0B, 0xD0, 0x1F, 0xF0, 0xBF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0x80, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF5, 0x55, 0x57, 0xF5, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xF8, 0x2F, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x40,
-    0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xF8, 0x03, 0xF0,
-    0x07, 0xC0, 0x00, 0xF4, 0x03, 0xF0, 0x03, 0xC0, 0x00, 0xF0, 0x03, 0xF0, 0x03, 0xC0, 0x00, 0x70,
-    0x03, 0xF0, 0x02, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF1, 0xAE, 0x90, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE,
-    0xAA, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x6F, 0xFF,
-    0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0x42, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0xBF, 0xFF, 0x80, 0x1F, 0xC0, 0x7F, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xF0, 0x00, 0xFE, 0xC0,
-    0x03, 0xF0, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xD0, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x03,
-    0xF0, 0x0F, 0x00, 0x00, 0x03, 0xF0, 0x2E, 0x00, 0x00, 0x03, 0xF5, 0x7C, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x03, 0xF6, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x1F,
-    0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0x40, 0x2F, 0xE0,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xF7, 0xFF, 0xD0, 0x00, 0xBF,
-    0xF8, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xCF, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0x3F, 0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x3F,
-    0x00, 0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0xC0, 0x03, 0xF3, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFC,
-    0x00, 0x0F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xEF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x01,
-    0xF4, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x96, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0x9F, 0xFF, 0x90, 0x06, 0xFF, 0x80, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x0B, 0xE0,
-    0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x03, 0xF0,
-    0x01, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x00, 0x01, 0xF8,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xEB, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xF7, 0xFF, 0xD0, 0x03, 0xFF, 0xE0, 0x0F, 0xC0, 0x00,
-    0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x40, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x00,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x00, 0x0F,
-    0xD0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00,
-    0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC,
-    0x00, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA,
-    0xAF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00,
-    0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0xB4, 0x00, 0xFC, 0x00, 0x2C, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xD5, 0x6F, 0xF0, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x2F,
-    0xC0, 0x3F, 0x00, 0x6F, 0xC0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x7F, 0xFA, 0xBF, 0xE0, 0x03, 0xF0,
-    0x07, 0xF0, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0xF8, 0x03, 0xF0,
-    0x01, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xFA, 0x5B, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xFA,
-    0xAF, 0xFC, 0x03, 0xF0, 0x01, 0xFD, 0x03, 0xF0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x3F, 0x03, 0xF0,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0xFE, 0x03, 0xF0, 0x07, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0xF4, 0x0F, 0xC0, 0x03,
-    0xD0, 0x3F, 0x00, 0x0B, 0x00, 0xFC, 0x00, 0x14, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0x80, 0x00, 0x01,
-    0xF0, 0x07, 0xE0, 0x00, 0x00, 0xB8, 0x01, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x7E, 0x00, 0x00, 0x0F,
-    0x40, 0x1F, 0x80, 0x00, 0x03, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x7E, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x00, 0x03, 0xC0,
-    0x01, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x3C, 0x00,
-    0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x2F, 0x80, 0x01, 0xBE, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xC0, 0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00,
-    0x01, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x0B, 0x00, 0x00, 0x00,
-    0x03, 0xC1, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x2D, 0x00, 0xFC, 0x00, 0x07,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x15,
-    0x54, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x18, 0x03, 0xF0, 0x00, 0x0F, 0x00,
-    0xFC, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x16, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0x00,
-    0xBF, 0xC0, 0x2F, 0xFE, 0x00, 0x7F, 0xC0, 0x2F, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0xB0, 0x00, 0x1F,
-    0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x03,
-    0xF0, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0x80, 0xFC, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0x5F, 0xD6, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF9, 0xFE, 0x6F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xBF,
-    0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x0F,
-    0xC0, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0xD0, 0x0B, 0xFF, 0xE0,
-    0x0F, 0xF4, 0x3F, 0xD0, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0x85, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x1A, 0x90, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xFF, 0xAF, 0xFC, 0x0F, 0xD0, 0x03, 0xF4,
-    0x3E, 0x00, 0x0B, 0xE0, 0xF4, 0x00, 0x1F, 0x82, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x55, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x78, 0x00, 0x03,
-    0xF7, 0xF0, 0x00, 0x0F, 0xCF, 0xF4, 0x00, 0xFE, 0x1F, 0xFE, 0xBF, 0xE0, 0x0F, 0xFF, 0xFD, 0x00,
-    0x01, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x7F,
-    0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0xFC,
-    0x00, 0x3F, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x02, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFE, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x01, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x5B, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xF7, 0xFF, 0xD0, 0x00, 0xBF, 0xF8, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xCF, 0xC0,
-    0x03, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0x3F, 0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0x00, 0xFC,
-    0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0xC0, 0x03, 0xF3, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-    0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xEF, 0xFF, 0xF4, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0xFF, 0x80, 0x1F, 0xC0, 0x7F, 0xFE, 0x00, 0x3F,
-    0xD0, 0x03, 0xF0, 0x00, 0xFE, 0xC0, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xD0, 0x00,
-    0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x0F, 0x00, 0x00, 0x03, 0xF0, 0x2E, 0x00, 0x00, 0x03,
-    0xF5, 0x7C, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF6, 0xBE, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x7F,
-    0x80, 0x2F, 0xFF, 0x40, 0x2F, 0xE0, 0xFF, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0B, 0xC0, 0x2F, 0x80, 0x00, 0x02, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0xB8, 0x01, 0xF8, 0x00,
-    0x00, 0x2E, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x00, 0x03, 0xD0, 0x07, 0xE0, 0x00,
-    0x00, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x00,
-    0x0B, 0xC0, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x7E, 0x00, 0x00,
-    0xBC, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x08, 0x2F, 0x00, 0x01, 0xF8, 0x07, 0xFF,
-    0x80, 0x00, 0x7E, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x7F, 0x80, 0x01, 0xFF, 0xFF, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-    0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBB,
-    0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0x7F, 0x00, 0x0B, 0x7F, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0xF2,
-    0xF0, 0x00, 0x0F, 0x1F, 0x40, 0x1F, 0x2F, 0x00, 0x00, 0xF0, 0xFC, 0x02, 0xD2, 0xF0, 0x00, 0x0F,
-    0x0B, 0xC0, 0x3C, 0x1F, 0x00, 0x01, 0xF0, 0x7D, 0x07, 0x81, 0xF4, 0x00, 0x1F, 0x03, 0xE0, 0xB4,
-    0x1F, 0x40, 0x01, 0xF0, 0x2F, 0x0F, 0x00, 0xF4, 0x00, 0x2E, 0x00, 0xF5, 0xE0, 0x0F, 0x80, 0x02,
-    0xE0, 0x0F, 0xBD, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x03, 0xD0, 0x03, 0xF8,
-    0x00, 0xFC, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x02,
-    0xFF, 0xE0, 0x04, 0x00, 0xBF, 0xFD, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xD0, 0x00, 0xFF, 0xF9, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x0F, 0xD5, 0x55, 0x57, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F,
-    0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xF8,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xBF, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x07, 0xF8,
-    0x07, 0xF0, 0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2,
-    0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC7,
-    0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x03,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x80,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00,
-    0x01, 0xF8, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xC0, 0x00, 0x55,
-    0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x7F, 0xFA, 0xBF, 0xF4, 0x03, 0xF0, 0x07, 0xFC, 0x03, 0xF0,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0,
-    0x00, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x1B, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xF9, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xF4, 0x01, 0xF4, 0x07, 0xE0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x0F, 0x42, 0xF4, 0x00, 0x02, 0xC0,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xF9, 0x56, 0xB4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0x3F,
-    0x40, 0x3E, 0xF4, 0x03, 0xF4, 0x03, 0xDF, 0x00, 0x3F, 0x40, 0x2D, 0x70, 0x03, 0xF4, 0x02, 0x80,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE7, 0xFF, 0xE4, 0x01, 0xBF, 0xE0, 0x0F,
-    0xC0, 0x00, 0x0B, 0xC0, 0x02, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x0B,
-    0xE0, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x80, 0x3E, 0x00, 0x00, 0x03,
-    0xF0, 0x1F, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x00, 0x01,
-    0xFA, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x5F,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF,
-    0xEF, 0xFD, 0x00, 0xFE, 0x03, 0xF0, 0x2F, 0xD0, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x7F, 0x00, 0x3F,
-    0x00, 0x3F, 0xAF, 0x40, 0x0F, 0xC0, 0x07, 0xEF, 0xD0, 0x03, 0xF0, 0x01, 0xFF, 0xF4, 0x00, 0xFC,
-    0x00, 0x7E, 0xBE, 0x00, 0x3F, 0x00, 0x2F, 0x9F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC2, 0xFC, 0x03, 0xF0,
-    0x1F, 0xD0, 0x2F, 0xE5, 0xFD, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x6F, 0xE5,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xC1, 0xFF, 0xF8, 0x01, 0xBF, 0xD0, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xD0,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0xFD, 0x00,
-    0x00, 0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x80,
-    0x00, 0x7E, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xF8, 0x01, 0xBF, 0xFE,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x07, 0xFF,
-    0xFC, 0x7F, 0xFD, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x03,
-    0xF4, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x07, 0xF4, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x82, 0xFF, 0xFD, 0x2F, 0xFE, 0x01, 0xFF, 0xF4, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03,
-    0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x02, 0xF4,
-    0x00, 0x1F, 0xC0, 0x02, 0xF4, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x54, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC1, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xE7, 0xFF, 0x90, 0x3F, 0xFD, 0x03, 0xFF, 0xE0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x7F, 0xFF, 0x47, 0xFF, 0xF8, 0x7F, 0xF9, 0x03, 0xFF,
-    0xD0, 0x3F, 0xFE, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x03, 0xE0, 0x0B, 0xD0, 0x00, 0x00, 0xF4, 0x02, 0xF4,
-    0x00, 0x00, 0x3C, 0x00, 0xBD, 0x00, 0x00, 0x07, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xE5, 0x6F, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00,
-    0x3F, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x40,
-    0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x2F, 0x40, 0x03, 0xFF, 0xFF,
-    0xE0, 0x02, 0xF4, 0x00, 0x3F, 0x55, 0xBF, 0xC0, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xFD, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x2F,
-    0x40, 0x03, 0xF0, 0x07, 0xF8, 0x02, 0xF4, 0x02, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xFE, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x6F, 0xF4, 0x03, 0xF0,
-    0x00, 0xBF, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x6F, 0xC0, 0xBF, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x02, 0xF4, 0x00, 0xBF, 0xC0, 0x2F, 0x00, 0x01, 0xFE, 0x02,
-    0xE0, 0x00, 0x0B, 0xF0, 0x1D, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x01, 0x55, 0x56, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x40, 0x00, 0x03,
-    0xF0, 0x3C, 0x00, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x1F, 0xC0, 0xBF, 0x80, 0x0B, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xFC,
-    0x00, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x0F,
-    0xC0, 0x2F, 0x80, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x57,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x03, 0xF4,
-    0x03, 0xF0, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xF8, 0x01, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x3F, 0x80, 0x1F, 0x40,
-    0x00, 0xBE, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x00,
-    0xFC, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x00, 0x2F,
-    0xE4, 0x2F, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xF0,
-    0x1F, 0x40, 0x00, 0x0B, 0xE0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0x3F, 0x80, 0x1F,
-    0x40, 0x00, 0xBF, 0x00, 0x1F, 0x40, 0x02, 0xFC, 0x00, 0x1F, 0x80, 0x0B, 0xF4, 0x01, 0xFF, 0xFC,
-    0x3F, 0xD0, 0x07, 0xFF, 0xFC, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03,
-    0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF,
-    0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x56, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xE0, 0x16, 0x40, 0x3F, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0xBF, 0xF4, 0x07,
-    0xEF, 0xFF, 0xF8, 0x2F, 0xF4, 0x0B, 0xF8, 0xBE, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x0F, 0xDF, 0xC0,
-    0x00, 0x1F, 0xAF, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x07, 0xE7, 0xF0, 0x00,
-    0x2F, 0x4F, 0xD0, 0x00, 0xFC, 0x1F, 0xD0, 0x0F, 0xD0, 0x2F, 0xFB, 0xFE, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x05, 0x50, 0x00, 0xBF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0x0B, 0xC0, 0x2F, 0x80, 0x7C,
-    0x00, 0xFC, 0x07, 0xC0, 0x0B, 0xC0, 0x7C, 0x00, 0xF8, 0x07, 0xEA, 0xAF, 0x00, 0x7F, 0xFF, 0xF4,
-    0x07, 0xD0, 0x6F, 0xC0, 0x7C, 0x00, 0x7E, 0x07, 0xC0, 0x03, 0xE0, 0x7C, 0x00, 0x3E, 0x07, 0xC0,
-    0x0F, 0xC2, 0xFF, 0xAF, 0xF4, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xD0, 0xBE, 0x05, 0xF0, 0x1F, 0x40, 0x3C, 0x07, 0xD0, 0x0F, 0x01, 0xF4, 0x02, 0x80,
-    0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00,
-    0x0F, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0xF8, 0x00, 0x02, 0xD0, 0x0F,
-    0x80, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x0F, 0x80, 0x00, 0x78, 0x00, 0xF8, 0x00, 0x0F,
-    0x40, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xE3, 0xE0, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x00, 0x3D, 0x2C, 0x00,
-    0x00, 0x02, 0xC2, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB,
-    0xD0, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8,
-    0x00, 0x15, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x2F, 0x80, 0x7F, 0xFC, 0x07, 0xF0,
-    0x2F, 0xE0, 0x7F, 0xF4, 0x1F, 0xF0, 0x01, 0xF4, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x7C, 0x0B, 0xC0,
-    0xB8, 0x00, 0x00, 0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x00, 0x0F, 0x0B, 0xC2, 0xE0, 0x00, 0x00, 0x0B,
-    0x9B, 0xD7, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x4B, 0xC3, 0xF0, 0x00,
-    0x00, 0x3E, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0xFC, 0x00, 0x01, 0xF8, 0x0B, 0xC0,
-    0x7E, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x3F, 0x40, 0x0F, 0xD0, 0x2F, 0xE4, 0x0F, 0xD0, 0x7F, 0x80,
-    0xBF, 0xFC, 0x07, 0xF8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0xFF, 0xFF, 0xE0, 0x78, 0x01, 0xFC, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xD0, 0x01, 0xAB, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x3E, 0x2C, 0x00, 0x1F, 0x8F, 0xC0, 0x0F, 0xC2, 0xFF, 0xBF, 0xD0, 0x2F, 0xFF, 0xD0, 0x00, 0x55,
-    0x00, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xFB, 0xFF, 0x80, 0x3F, 0xFD, 0x0B, 0xD0, 0x00, 0x3E, 0x00,
-    0x7D, 0x00, 0x0F, 0xD0, 0x07, 0xD0, 0x03, 0xFD, 0x00, 0x7D, 0x00, 0xFB, 0xD0, 0x07, 0xD0, 0x3D,
-    0x3D, 0x00, 0x7D, 0x0F, 0x43, 0xD0, 0x07, 0xD3, 0xD0, 0x3D, 0x00, 0x7E, 0xF4, 0x03, 0xD0, 0x07,
-    0xFC, 0x00, 0x3D, 0x00, 0x7F, 0x00, 0x03, 0xD0, 0x07, 0xD0, 0x00, 0x3D, 0x02, 0xFF, 0x80, 0x1F,
-    0xFE, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x00, 0x74, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x03, 0xFA, 0xFD, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x3F, 0xFF, 0xBF, 0xF8, 0x03, 0xFF, 0xD0, 0xBD,
-    0x00, 0x03, 0xE0, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x7D, 0x00, 0x3F, 0xD0, 0x07, 0xD0, 0x0F, 0xBD,
-    0x00, 0x7D, 0x03, 0xD3, 0xD0, 0x07, 0xD0, 0xF4, 0x3D, 0x00, 0x7D, 0x3D, 0x03, 0xD0, 0x07, 0xEF,
-    0x40, 0x3D, 0x00, 0x7F, 0xC0, 0x03, 0xD0, 0x07, 0xF0, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x03, 0xD0,
-    0x2F, 0xF8, 0x01, 0xFF, 0xEF, 0xFF, 0xD0, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x10, 0xBF, 0xFC, 0x02,
-    0xF8, 0xBF, 0xF8, 0x0B, 0xF8, 0x0B, 0xD0, 0x1F, 0x40, 0x07, 0xD0, 0x3D, 0x00, 0x07, 0xD0, 0x78,
-    0x00, 0x07, 0xD0, 0xF0, 0x00, 0x07, 0xE7, 0xD0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xD2, 0xF4,
-    0x00, 0x07, 0xD0, 0xFC, 0x00, 0x07, 0xD0, 0x7E, 0x00, 0x07, 0xD0, 0x3F, 0x40, 0x07, 0xD0, 0x0F,
-    0xC0, 0x2F, 0xF8, 0x07, 0xF0, 0xFF, 0xFD, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x02, 0xFF, 0xFF,
-    0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xD0, 0x01, 0xF0, 0x2F, 0x40, 0x00, 0x3C, 0x07, 0xD0, 0x00, 0x0F,
-    0x01, 0xF4, 0x00, 0x07, 0x80, 0x7D, 0x00, 0x01, 0xE0, 0x1F, 0x40, 0x00, 0xB4, 0x07, 0xD0, 0x00,
-    0x3C, 0x01, 0xF4, 0x00, 0x0F, 0x00, 0x7D, 0x00, 0x07, 0x80, 0x1F, 0x40, 0x03, 0xD0, 0x07, 0xD0,
-    0x3B, 0xF0, 0x01, 0xF4, 0x1F, 0xF4, 0x02, 0xFF, 0xE7, 0xF4, 0x03, 0xFF, 0xFC, 0x50, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xC0, 0x01, 0xFF,
-    0x00, 0x1E, 0xF4, 0x00, 0xFB, 0xC0, 0x07, 0xAF, 0x00, 0x76, 0xF0, 0x01, 0xE3, 0xD0, 0x3C, 0xBC,
-    0x00, 0x78, 0xBC, 0x1E, 0x2F, 0x00, 0x1E, 0x0F, 0x4F, 0x0B, 0xC0, 0x07, 0x82, 0xE7, 0x82, 0xF0,
-    0x01, 0xE0, 0x7F, 0xC0, 0xBC, 0x00, 0x78, 0x0F, 0xE0, 0x2F, 0x00, 0x1E, 0x01, 0xF0, 0x0B, 0xC0,
-    0x07, 0x80, 0x38, 0x02, 0xF0, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x8B, 0xFF, 0xC0, 0x03, 0xFF, 0xF0,
-    0xBF, 0xFD, 0x07, 0xFF, 0xF2, 0xFF, 0xF0, 0x1F, 0xFF, 0x40, 0xBE, 0x00, 0x07, 0xE0, 0x01, 0xF4,
-    0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x01, 0xF8, 0x00, 0x7E, 0x55, 0x5B,
-    0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xE5, 0x55, 0xBE, 0x00, 0x1F, 0x40, 0x01, 0xF8, 0x00,
-    0x7D, 0x00, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0xBF, 0xF4,
-    0x0B, 0xFF, 0x8F, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8,
-    0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC,
-    0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0,
-    0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xFF, 0xF9, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x07, 0xD0,
-    0x00, 0xBD, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x7D, 0x00, 0x0B, 0xD0,
-    0x07, 0xD0, 0x00, 0xBD, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x7D, 0x00,
-    0x0B, 0xD0, 0x07, 0xD0, 0x00, 0xBD, 0x02, 0xFF, 0xD0, 0x2F, 0xFD, 0xFF, 0xFD, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x05, 0x00, 0x06, 0xF4, 0x7F, 0xF8, 0x0B, 0xFE, 0xBF, 0xFF, 0xC0, 0x6F, 0xFD, 0x1B,
-    0xF8, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x02, 0xF8, 0x0F, 0xC0,
-    0x00, 0x7E, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x02, 0xF0, 0x0F,
-    0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x06, 0xAA, 0xA4,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0xFD, 0x2F,
-    0x00, 0x1F, 0x4F, 0x80, 0x03, 0x87, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF9, 0x00, 0x50,
-    0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0xCF, 0x96, 0xF9, 0x5F, 0x3C, 0x07, 0xD0, 0x3C, 0xF0, 0x1F, 0x40, 0xF2, 0xC0, 0x7D, 0x03,
-    0x40, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x03, 0xFF, 0xC7, 0xFF, 0xD0, 0x2F, 0xF8, 0x0F, 0xD0, 0x00, 0x3E,
-    0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x00, 0xFC,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xF4, 0x00,
-    0x00, 0x1F, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x70, 0x7E, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xE4, 0xBC, 0x2F, 0xE0, 0x2F, 0x40, 0xBC,
-    0x03, 0xF4, 0x3E, 0x00, 0xBC, 0x01, 0xFC, 0xBD, 0x00, 0xBC, 0x00, 0xFC, 0xBC, 0x00, 0xBC, 0x00,
-    0xBC, 0xFC, 0x00, 0xBC, 0x00, 0xBC, 0xFC, 0x00, 0xBC, 0x00, 0xBC, 0xBD, 0x00, 0xBC, 0x00, 0xFC,
-    0x7E, 0x00, 0xBC, 0x00, 0xF8, 0x3F, 0x40, 0xBC, 0x03, 0xF0, 0x1F, 0xE4, 0xBC, 0x1F, 0xD0, 0x07,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0xAA, 0x90, 0x00, 0x3F, 0xFE, 0x07, 0xFF,
-    0x8F, 0xFF, 0x41, 0xFF, 0xD0, 0x7F, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x7E, 0x0B,
-    0x80, 0x00, 0x0B, 0xD7, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x03, 0xDF, 0xC0, 0x00, 0x03, 0xD1, 0xFC, 0x00, 0x03, 0xE0, 0x2F, 0x80, 0x03,
-    0xF0, 0x03, 0xF4, 0x0B, 0xFE, 0x01, 0xFF, 0xDB, 0xFF, 0xD1, 0xFF, 0xF8, 0xBF, 0xFD, 0x0B, 0xFF,
-    0xD2, 0xFF, 0xE0, 0x2F, 0xFE, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x07,
-    0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00,
-    0x3F, 0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x0F, 0xC0,
-    0x01, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x1F, 0xFF, 0x6F, 0xFE, 0x07, 0xFF, 0x80, 0xBD, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x0B,
-    0xC0, 0x0B, 0xD0, 0x02, 0xF0, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x7E, 0x00, 0x2F, 0x00, 0x0F, 0xF5,
-    0x6F, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0xA5, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF8,
-    0x7F, 0xFC, 0x3F, 0xF8, 0x3F, 0xFD, 0x7F, 0xF8, 0x3F, 0xF4, 0x3F, 0xF8, 0x0B, 0xD0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFC, 0x3F, 0xF8, 0x3F, 0xFD,
-    0x1F, 0xFE, 0x0F, 0xFD, 0x0F, 0xFE, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x1F, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x01, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x00,
-    0x7C, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x01, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x1F,
-    0x00, 0x2F, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0x95, 0xF8, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x00, 0xF0,
-    0x0F, 0x80, 0x00, 0x18, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xFC,
-    0x00, 0x0F, 0x80, 0x2F, 0x40, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x3E, 0x00,
-    0x7D, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x1F, 0xFF, 0xDB, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00,
-    0x00, 0x0F, 0xC0, 0x07, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x7F, 0xFF, 0xF4, 0x0F, 0xC0, 0x07, 0xD0,
-    0x0F, 0xC0, 0xFC, 0x00, 0x7D, 0x00, 0x7D, 0x0F, 0xC0, 0x07, 0xD0, 0x07, 0xD0, 0xFC, 0x00, 0x7D,
-    0x00, 0x7C, 0x0F, 0xC0, 0x07, 0xD0, 0x1F, 0xC0, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x7F, 0xFC, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x7F, 0xEF, 0xF8, 0x07, 0xD0, 0x0F, 0xD0, 0x7D, 0x00, 0x3D, 0x07, 0xD0, 0x03,
-    0xD0, 0x7D, 0x00, 0x7D, 0x07, 0xD0, 0x0F, 0xC2, 0xFF, 0xBF, 0xF4, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC1, 0xE0, 0x07, 0xF8, 0x10,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x02, 0xAA, 0xBE, 0x00, 0xFF, 0xFF, 0x80,
-    0x15, 0x57, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0xB0, 0x00, 0x3F, 0x3F, 0x00, 0x2F, 0x4B,
-    0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02,
-    0xFF, 0xF4, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x02, 0xF4, 0x03, 0xF4, 0x07,
-    0xF0, 0x07, 0xD0, 0x1F, 0x40, 0x0B, 0xE0, 0x1F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7D, 0x03, 0xF0,
-    0x00, 0x3F, 0x01, 0xF9, 0x6F, 0x80, 0x00, 0xBC, 0x07, 0xFF, 0xFE, 0x00, 0x02, 0xF4, 0x1F, 0xAA,
-    0xF8, 0x00, 0x0B, 0xC0, 0x7D, 0x03, 0xF0, 0x00, 0x2F, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x07,
-    0xD0, 0x2F, 0x40, 0x07, 0xD0, 0x1F, 0x40, 0x7F, 0x40, 0x3F, 0x02, 0xFF, 0xD0, 0xBF, 0xEB, 0xF0,
-    0x3F, 0xFF, 0x40, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x1A, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xF8, 0x02, 0xF4, 0x07, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x03, 0xD0, 0x07, 0xC0,
-    0x03, 0xE0, 0x07, 0xC0, 0x03, 0xF8, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x3F, 0x07, 0xC0, 0x00, 0x7D, 0x07, 0xC0, 0x00, 0xFC, 0x07, 0xC0, 0x02, 0xF0, 0x07, 0xC0,
-    0x0B, 0xE0, 0x6F, 0xFD, 0x2F, 0x80, 0xFF, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xE0,
-    0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x01, 0x40,
-    0x14, 0x03, 0xF8, 0x2F, 0xC0, 0xFE, 0x0B, 0xF0, 0x1F, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xFE, 0x07, 0xE0, 0x0F, 0xD3, 0xF0,
-    0x01, 0xF9, 0xF4, 0x00, 0x3F, 0xBD, 0x00, 0x0F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x19, 0x0F,
-    0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x80, 0x01, 0x54, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x02, 0xBF, 0xAA, 0xA0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x1F, 0xE4, 0x00, 0x3F, 0x7F, 0xFF, 0x40, 0x0F, 0xFF, 0xAF, 0xF0, 0x03, 0xFC, 0x00, 0xFE,
-    0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xFD, 0x03, 0xF0, 0x00,
-    0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0,
-    0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x0F, 0xC3, 0xFF, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF4, 0x2F, 0x81, 0x7C,
-    0x07, 0xD0, 0x0F, 0x01, 0xF4, 0x03, 0xC0, 0x7D, 0x00, 0xA0, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00,
-    0x02, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x7F, 0xAF,
-    0xF8, 0x3E, 0x00, 0x7F, 0x3F, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x4B, 0xC0, 0x00, 0x02, 0xF5, 0x55,
-    0x40, 0xFF, 0xFF, 0xE0, 0x3F, 0xAA, 0xA0, 0x0B, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x60, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x14, 0x00, 0x02, 0xFF, 0xF8, 0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC, 0x3E, 0x00, 0x3C, 0x3F, 0x00,
-    0x10, 0x2F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFC,
-    0x38, 0x00, 0x7D, 0x3C, 0x00, 0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x01, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01,
-    0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x09, 0x00, 0x50, 0xFD,
-    0x0F, 0xE3, 0xF4, 0x3F, 0x8B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x40, 0x1F, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00,
-    0x01, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0,
-    0x00, 0x1F, 0x40, 0x06, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xF4,
-    0x02, 0xFC, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0xC0,
-    0x17, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x3E, 0x00, 0x2F, 0x40, 0x1F, 0xC0, 0x2F, 0xD0, 0x7F, 0xD0, 0x0A, 0x40, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x03,
-    0xC0, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x78, 0x07, 0xD0, 0x00, 0x00,
-    0x01, 0xE0, 0x1F, 0xFF, 0xF4, 0x00, 0x0B, 0x40, 0x7F, 0xAF, 0xF4, 0x00, 0x3C, 0x01, 0xF4, 0x07,
-    0xF0, 0x00, 0xF0, 0x07, 0xD0, 0x0B, 0xC0, 0x07, 0x80, 0x1F, 0x40, 0x1F, 0x00, 0x3D, 0x00, 0x7D,
-    0x00, 0xBC, 0x3B, 0xF0, 0x01, 0xF4, 0x07, 0xE1, 0xFF, 0x40, 0x2F, 0xFB, 0xFF, 0x07, 0xF4, 0x03,
-    0xFF, 0xFF, 0xD0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x0B, 0xFF, 0xC0, 0x02, 0xFF,
-    0xE0, 0x3F, 0xFE, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x55, 0x5F, 0xFF,
-    0xE4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xE5, 0x55, 0xFC, 0x03, 0xF4, 0x1F, 0x40, 0x03,
-    0xF0, 0x03, 0xE0, 0x7D, 0x00, 0x0F, 0xC0, 0x0F, 0x81, 0xF4, 0x00, 0x3F, 0x00, 0x3E, 0x07, 0xD0,
-    0x00, 0xFC, 0x03, 0xF0, 0xBF, 0xF4, 0x1F, 0xFF, 0xFF, 0x4F, 0xFF, 0xD0, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x02, 0xBF, 0xAA, 0xA0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC1, 0xBF, 0x40, 0x00, 0x3F, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFA, 0xFF, 0x40, 0x03, 0xFD,
-    0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xD3, 0xFF, 0xF0,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xBF, 0xFC, 0x02, 0xF8, 0xBF, 0xF8, 0x0B, 0xF8, 0x0B,
-    0xD0, 0x1F, 0x40, 0x07, 0xD0, 0x3D, 0x00, 0x07, 0xD0, 0x78, 0x00, 0x07, 0xD0, 0xF0, 0x00, 0x07,
-    0xE7, 0xD0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xD2, 0xF4, 0x00, 0x07, 0xD0, 0xFC, 0x00, 0x07,
-    0xD0, 0x7E, 0x00, 0x07, 0xD0, 0x3F, 0x40, 0x07, 0xD0, 0x0F, 0xC0, 0x2F, 0xF8, 0x07, 0xF0, 0xFF,
-    0xFD, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xBF, 0xF8, 0x03, 0xFF, 0xD0, 0xBD, 0x00, 0x03, 0xE0, 0x07, 0xD0, 0x00,
-    0xFD, 0x00, 0x7D, 0x00, 0x3F, 0xD0, 0x07, 0xD0, 0x0F, 0xBD, 0x00, 0x7D, 0x03, 0xD3, 0xD0, 0x07,
-    0xD0, 0xF4, 0x3D, 0x00, 0x7D, 0x3D, 0x03, 0xD0, 0x07, 0xEF, 0x40, 0x3D, 0x00, 0x7F, 0xC0, 0x03,
-    0xD0, 0x07, 0xF0, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x2F, 0xF8, 0x01, 0xFF, 0xEF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0x00, 0xE0, 0x03, 0x80, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x02, 0xF4, 0x0B, 0xC0,
-    0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x1B, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x7F, 0xFD, 0x02, 0xFF, 0x80, 0xFD, 0x00, 0x03, 0xE0,
-    0x07, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x01, 0xF0, 0x00, 0x0F, 0xC0,
-    0x2F, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x3F, 0x0F, 0x40, 0x00,
-    0x01, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x07, 0x07, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x0B, 0xFF, 0xDB, 0xFF, 0x80, 0xBF, 0xF8, 0x0B,
-    0xD0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x0F,
-    0xC0, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x7D,
-    0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0xFC,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2A, 0xAB, 0xFA, 0xAA, 0x80, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xE5, 0x7F, 0x55, 0xBC, 0x01, 0xE0, 0x0F, 0xC0, 0x0F, 0x00, 0x74,
-    0x03, 0xF0, 0x03, 0xC0, 0x08, 0x00, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD5, 0x50, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x03,
-    0xF0, 0x07, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xF0, 0x3E, 0x03, 0xC0, 0xF0, 0x3E, 0x03, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3E, 0x00, 0xBE, 0x00,
-    0x3E, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0xBD, 0x02,
-    0xFF, 0xEF, 0xF8, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0xBF, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0,
-    0x0B, 0xF0, 0x00, 0x07, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0,
-    0xFC, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F,
-    0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F,
-    0x00, 0x03, 0xF4, 0x3D, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0xFC, 0xBD, 0x55, 0x55, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xFD, 0x55, 0x55, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0xF8, 0x3F,
-    0x00, 0x02, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4B, 0xFF, 0xFC, 0x00, 0x07, 0xFD, 0x7F, 0xFE,
-    0x40, 0x00, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0xAC, 0x03, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-    0xC0, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x00,
-    0x7F, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x00,
-    0x00, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0x40, 0x00,
-    0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x07, 0xFF, 0xE0, 0x00, 0xFD, 0x7F, 0xFD, 0x00, 0x3F, 0xE0, 0xFD, 0x00, 0x0B, 0xED, 0x07, 0xE0,
-    0x00, 0xF4, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x02, 0xF4, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x3C, 0x00,
-    0x00, 0xFC, 0x0B, 0x80, 0x00, 0x07, 0xD0, 0xF4, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x02, 0xF2,
-    0xE0, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF9, 0x6F, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xF1, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0xFC, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x03, 0xF0,
-    0x00, 0x3F, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x00, 0x03, 0xF3, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x02, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0x3F, 0xFF, 0xD0, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x74, 0x01,
-    0xE0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x0F, 0xEB, 0xF4, 0x00,
-    0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0xFF, 0xFC, 0xBF, 0xF8, 0x03, 0xFF, 0xD0, 0x2F, 0x40, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x0F,
-    0xD0, 0x01, 0xF4, 0x00, 0xFF, 0x40, 0x07, 0xD0, 0x0F, 0xBD, 0x00, 0x1F, 0x40, 0xF4, 0xF4, 0x00,
-    0x7D, 0x0F, 0x43, 0xD0, 0x01, 0xF4, 0xF4, 0x0F, 0x40, 0x07, 0xEF, 0x40, 0x3D, 0x00, 0x1F, 0xF0,
-    0x00, 0xF4, 0x00, 0x7F, 0x00, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0x0F, 0x40, 0x2F, 0xF8, 0x01, 0xFF,
-    0xE3, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE9, 0x00, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xD5, 0x6F, 0xF4, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x02, 0xFC, 0x00, 0xFC, 0x01, 0xBF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0xFA, 0xFF, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0xFC, 0x00,
-    0xBC, 0x03, 0xF0, 0x01, 0xF0, 0x0F, 0xC0, 0x0B, 0xC0, 0x3F, 0x00, 0x7E, 0x07, 0xFF, 0xBF, 0xF0,
-    0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x7F, 0xFA, 0xBF, 0xF4, 0x03, 0xF0, 0x07, 0xFC, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBD,
-    0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x50, 0xBD, 0x03, 0xF0, 0xF0, 0xFC, 0x03, 0xF0, 0xB9, 0xF8,
-    0x03, 0xF0, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFB, 0xC0, 0x03, 0xF0, 0x02, 0xD0,
-    0x03, 0xF0, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x06, 0xF4, 0x7F, 0xF8, 0x0B, 0xFE, 0xBF, 0xFF, 0xC0, 0x6F, 0xFD, 0x1B, 0xF8, 0x03, 0xF4, 0x00,
-    0xBF, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x7E, 0x03, 0xF0,
-    0x00, 0x1F, 0x80, 0xFC, 0x04, 0x07, 0xD0, 0x3F, 0x07, 0x82, 0xF0, 0x0F, 0xC0, 0xF4, 0xFC, 0x03,
-    0xF0, 0x0F, 0xBD, 0x00, 0xFD, 0x02, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xF0, 0x00, 0x78, 0x00, 0xFC, 0x00, 0x0A, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x07, 0xF5, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x06, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7E, 0xBF, 0xFF, 0xFF,
-    0xF5, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x7C, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xC0, 0x7E, 0x00, 0x50, 0x1F,
-    0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07,
-    0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x0B,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0xFC,
-    0x00, 0x2C, 0x00, 0xFC, 0x00, 0x14, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF,
-    0xD0, 0xBE, 0x05, 0xF0, 0x1F, 0x40, 0x3C, 0x07, 0xD0, 0x0F, 0x01, 0xF4, 0x02, 0x85, 0xBE, 0x54,
-    0x03, 0xFF, 0xFF, 0x00, 0x5B, 0xE5, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x07, 0xD0, 0x00, 0x0B, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00,
-    0xF4, 0x00, 0x3F, 0x00, 0x0B, 0x00, 0x03, 0xF0, 0x00, 0x50, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x6B, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xAA, 0xFF,
-    0xD0, 0x03, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F,
-    0xC2, 0xFF, 0xF4, 0x00, 0xFC, 0xFF, 0xFF, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x02, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xC0, 0x0B, 0xE0, 0x17,
-    0xC0, 0x07, 0xD0, 0x03, 0x80, 0x07, 0xD0, 0x01, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xEB, 0xFE,
-    0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x07, 0xE0, 0x1B, 0xF0, 0x07, 0xD0, 0x02, 0xF8, 0x07, 0xD0, 0x00,
-    0xFC, 0x07, 0xD0, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0xFC, 0x2F, 0xFD, 0x00, 0xBC, 0xFF, 0xFE, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x02, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0x00, 0xBF, 0xC0, 0x2F, 0xFE,
-    0x00, 0x7F, 0xC0, 0x2F, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0xB0, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xF0, 0x0F, 0x80, 0x00,
-    0x00, 0x0B, 0x80, 0xFC, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0x5F, 0xD6, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF9,
-    0xFE, 0x6F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0,
-    0xBE, 0x00, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0xFC, 0x01, 0xFC,
-    0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xF4, 0x00,
-    0x3F, 0xC0, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0xD0, 0x0B, 0xFF, 0xE0, 0x0F, 0xF4, 0x3F, 0xD0,
-    0x07, 0xFF, 0xF8, 0x00, 0xFF, 0x85, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x2F, 0x80, 0x7F, 0xFC, 0x07, 0xF0, 0x2F, 0xE0, 0x7F,
-    0xF4, 0x1F, 0xF0, 0x01, 0xF4, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0xB8, 0x00, 0x00,
-    0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x00, 0x0F, 0x0B, 0xC2, 0xE0, 0x00, 0x00, 0x0B, 0x9B, 0xD7, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x4B, 0xC3, 0xF0, 0x00, 0x00, 0x3E, 0x0B,
-    0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0xFC, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x7E, 0x00, 0x03,
-    0xF0, 0x0B, 0xC0, 0x3F, 0x40, 0x0F, 0xD0, 0x2F, 0xE4, 0x0F, 0xD0, 0x7F, 0x80, 0xBF, 0xFC, 0x07,
-    0xFC, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xFF, 0xAF, 0xFC,
-    0x0F, 0xD0, 0x03, 0xF4, 0x3E, 0x00, 0x0B, 0xE0, 0xF4, 0x00, 0x1F, 0x82, 0xC0, 0x00, 0x7E, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x55, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0xBE, 0x78, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x0F, 0xCF, 0xF4, 0x00, 0xFE, 0x1F, 0xFE, 0xBF, 0xE0,
-    0x0F, 0xFF, 0xFD, 0x00, 0x01, 0x6F, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0xD7, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x78, 0x01, 0xFC, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xD0, 0x01, 0xAB, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x3E, 0x2C, 0x00, 0x1F, 0x8F, 0xC0, 0x0F, 0xC2, 0xFF, 0xBF, 0xD0, 0x2F, 0xFF, 0xD0, 0x00,
-    0x5F, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x0F, 0xBC, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0xFF, 0x80, 0x1F, 0xC0, 0x7F, 0xFE, 0x00,
-    0x3F, 0xD0, 0x03, 0xF0, 0x00, 0xFE, 0xC0, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xD0,
-    0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x0F, 0x00, 0x00, 0x03, 0xF0, 0x2E, 0x00, 0x00,
-    0x03, 0xF5, 0x7C, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF6, 0xBE, 0x00, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0x80, 0x2F, 0xFF, 0x40, 0x2F, 0xE0, 0xFF, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10, 0xBF, 0xFC,
-    0x02, 0xF8, 0xBF, 0xF8, 0x0B, 0xF8, 0x0B, 0xD0, 0x1F, 0x40, 0x07, 0xD0, 0x3D, 0x00, 0x07, 0xD0,
-    0x78, 0x00, 0x07, 0xD0, 0xF0, 0x00, 0x07, 0xE7, 0xD0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xD2,
-    0xF4, 0x00, 0x07, 0xD0, 0xFC, 0x00, 0x07, 0xD0, 0x7E, 0x00, 0x07, 0xD0, 0x3F, 0x40, 0x07, 0xD0,
-    0x0F, 0xC0, 0x2F, 0xF8, 0x07, 0xF0, 0xFF, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x2F, 0xFF, 0xE0, 0x02, 0xFC, 0x07, 0xFF, 0xE0, 0x01,
-    0xFF, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0xC0, 0x03, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x3D,
-    0x00, 0x00, 0x3F, 0x1C, 0x1F, 0x00, 0x00, 0x0F, 0xCB, 0x4B, 0x40, 0x00, 0x03, 0xF2, 0xD3, 0xC0,
-    0x00, 0x00, 0xFD, 0xBA, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xDB, 0xBF, 0x00,
-    0x00, 0x03, 0xF2, 0xD7, 0xE0, 0x00, 0x00, 0xFC, 0xB4, 0xFD, 0x00, 0x00, 0x3F, 0x2D, 0x1F, 0xC0,
-    0x00, 0x0F, 0xC1, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0xFD, 0x00, 0x1F, 0xE0, 0xFF, 0xFF, 0x40, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2F, 0xFF, 0x00, 0x3F, 0x0B, 0xFF,
-    0x80, 0x3F, 0xC0, 0x2F, 0x00, 0x1F, 0x10, 0x07, 0xC0, 0x0F, 0x00, 0x01, 0xF2, 0xC7, 0x80, 0x00,
-    0x7C, 0xB3, 0xC0, 0x00, 0x1F, 0x7E, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xF2, 0xCF, 0x80,
-    0x00, 0x7C, 0xB2, 0xF0, 0x00, 0x1F, 0x2C, 0x3E, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x01, 0xF0, 0x01,
-    0xFC, 0x02, 0xFF, 0x80, 0x2F, 0xC3, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0xBF, 0xFF, 0x80, 0x1F, 0xC0, 0x7F, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xF0,
-    0x00, 0xFE, 0xC0, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0x43, 0xD0, 0x00, 0xFF, 0xFF, 0x4B,
-    0xC0, 0x00, 0x03, 0xF0, 0x0F, 0x00, 0x00, 0x03, 0xF0, 0x2E, 0x00, 0x00, 0x03, 0xF5, 0x7C, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF6, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x80, 0x2F, 0xFF,
-    0x40, 0x2F, 0xE0, 0xFF, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x50, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x10, 0x7F, 0xFF, 0x41, 0xFC, 0x7F, 0xFF, 0x47, 0xFC, 0x03, 0xF0, 0x0F,
-    0x84, 0x03, 0xF0, 0x2E, 0x00, 0x03, 0xF0, 0x3C, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x03, 0xF6, 0xF0,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x03, 0xF0, 0x2F, 0x80, 0x03, 0xF0, 0x0F, 0xD0, 0x1F, 0xFD, 0x07, 0xF4, 0x3F, 0xFF, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBE,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFC, 0x3E, 0x01, 0xFC, 0x00, 0x7F, 0xA0, 0xF4, 0x07, 0xF0, 0x03,
-    0xE0, 0x03, 0xC0, 0x1F, 0xC0, 0x1F, 0x00, 0x07, 0x00, 0x7F, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xFC,
-    0x0B, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xD6, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x00,
-    0x0F, 0xF0, 0x00, 0x1B, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x0B, 0xFF, 0xFE, 0x01, 0xFC, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xCF, 0x97, 0xF0, 0x0F, 0x84, 0xF0, 0x3F, 0x02, 0xE0, 0x0F, 0x03, 0xF0, 0x3C, 0x00, 0xB0,
-    0x3F, 0x0F, 0x40, 0x00, 0x03, 0xF6, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xF1, 0xF8,
-    0x00, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x03,
-    0xF0, 0x0F, 0xD0, 0x01, 0xFF, 0xE0, 0x7F, 0x40, 0x3F, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xD0, 0x00,
-    0xFF, 0xF9, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03,
-    0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xD5, 0x55, 0x57, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02,
-    0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00,
-    0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xBF, 0xFD, 0x07,
-    0xFF, 0xF2, 0xFF, 0xF0, 0x1F, 0xFF, 0x40, 0xBE, 0x00, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x1F, 0x80,
-    0x07, 0xD0, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x01, 0xF8, 0x00, 0x7E, 0x55, 0x5B, 0xE0, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x07, 0xE5, 0x55, 0xBE, 0x00, 0x1F, 0x40, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x07,
-    0xE0, 0x01, 0xF4, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0xDF,
-    0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x03, 0xF0, 0x00, 0x00,
-    0xBD, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x07, 0x80, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x1C,
-    0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD5,
-    0x55, 0x57, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFD, 0x07, 0xFF, 0xFF, 0xAF, 0xFF, 0x01, 0xFF, 0xFF, 0xE0, 0xBE, 0x00, 0x07, 0xE5, 0xB8, 0x1F,
-    0x40, 0x01, 0xF8, 0x1E, 0x07, 0xD0, 0x00, 0x7E, 0x07, 0x41, 0xF4, 0x00, 0x1F, 0x81, 0xC0, 0x7E,
-    0x55, 0x5B, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xE5, 0x55, 0xBE, 0x00, 0x01, 0xF4,
-    0x00, 0x1F, 0x80, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x01, 0xF8, 0x00, 0x07, 0xD0,
-    0x00, 0x7E, 0x00, 0x0B, 0xFF, 0x40, 0xBF, 0xF8, 0x0F, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x02, 0xFA, 0xBA, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0xEA, 0xFF, 0xE0, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x02,
-    0xF4, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x2F, 0x40,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0xBF, 0xFD, 0x01, 0xFF, 0xFC, 0x00, 0xFC, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x65, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0xFF, 0xFC, 0x00,
-    0x7D, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x07, 0xD0, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x7D, 0x00, 0x0B,
-    0xD0, 0x01, 0xFC, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x0F, 0xD0, 0x7D, 0x00, 0x0B, 0xD0, 0x00, 0xBD,
-    0x07, 0xD0, 0x00, 0xBD, 0x00, 0x07, 0xD2, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x7D, 0xFF, 0xFD, 0x07,
-    0xFF, 0xD0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4,
-    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x01,
-    0xA4, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xF0, 0x07, 0xE6, 0xF8, 0x00, 0x3F, 0x00,
-    0x3E, 0x02, 0xF4, 0x01, 0xF8, 0x02, 0xF0, 0x03, 0xE0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x3F,
-    0x00, 0x3E, 0x00, 0x3F, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0xBC, 0x0B, 0xE0, 0x07, 0xE0, 0x02, 0xF0,
-    0x2F, 0x80, 0x1F, 0x80, 0x0F, 0xC0, 0xBE, 0x00, 0x3E, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0xFC, 0x00,
-    0xF8, 0x07, 0xF0, 0x03, 0xF0, 0x07, 0xD0, 0x0F, 0xD0, 0x07, 0xD0, 0x2F, 0x00, 0x2F, 0xC0, 0x0F,
-    0xC0, 0xF4, 0x00, 0x3F, 0xC0, 0x1F, 0x8F, 0x80, 0x00, 0x3F, 0xD0, 0x2F, 0xF8, 0x00, 0x00, 0x3F,
-    0xFA, 0xBF, 0xE5, 0x5C, 0x00, 0x1F, 0xFF, 0xEB, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x03, 0xF4, 0x1B, 0x80, 0x00, 0xF8, 0x0F,
-    0xBF, 0x40, 0x2F, 0x03, 0xE0, 0xBC, 0x03, 0xD0, 0x7C, 0x07, 0xD0, 0x7C, 0x0B, 0xC0, 0x3E, 0x0B,
-    0xC0, 0xFC, 0x03, 0xE0, 0xFC, 0x0F, 0x80, 0x3E, 0x0F, 0xC0, 0xFC, 0x03, 0xD0, 0xBC, 0x0B, 0xC0,
-    0x3C, 0x07, 0xD0, 0x7C, 0x0B, 0xC0, 0x3F, 0x03, 0xE0, 0xF4, 0x02, 0xF8, 0x1F, 0x7E, 0x00, 0x0B,
-    0xF5, 0xBF, 0xC1, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x54, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x0B, 0xF4, 0x01, 0xF4, 0x07, 0xE0,
-    0x00, 0x3D, 0x03, 0xF0, 0x00, 0x0F, 0x42, 0xF4, 0x00, 0x02, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x56, 0xB4, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x35, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F,
-    0x4F, 0x80, 0x03, 0x87, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xF8, 0x00, 0x0B, 0x90, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x0F, 0xBD,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0x3F, 0x40, 0x3E, 0xF4, 0x03, 0xF4, 0x03, 0xDF, 0x00,
-    0x3F, 0x40, 0x2D, 0x70, 0x03, 0xF4, 0x02, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x06, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0x96, 0xF9, 0x5F, 0x3C, 0x07, 0xD0,
-    0x3C, 0xF0, 0x1F, 0x40, 0xF2, 0xC0, 0x7D, 0x03, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE, 0x7F, 0xFE, 0x00, 0x6F, 0xF8,
-    0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x00,
-    0x7F, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x0B,
-    0xE3, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x03, 0xFF, 0xC7, 0xFF,
-    0xD0, 0x2F, 0xF8, 0x0F, 0xD0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8,
-    0x00, 0x2F, 0x40, 0x1F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x7E,
-    0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x1F, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0xE0, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x02, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE, 0x7F, 0xFE, 0x00, 0x6F, 0xF8, 0x03, 0xF4, 0x00, 0x0B,
-    0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x3D, 0x00,
-    0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF0, 0x00, 0x00, 0x0B, 0xD2, 0xE0, 0x00, 0x00,
-    0x03, 0xF3, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x03, 0xFF, 0xC7, 0xFF, 0xD0, 0x2F, 0xF8, 0x0F,
-    0xD0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x1F,
-    0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x03,
-    0xF0, 0xF4, 0x00, 0x00, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0xFA, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x05, 0x7F, 0xD4, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x6F, 0x54, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x02, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xC1, 0xFF, 0xF8, 0x01, 0xBF, 0xD0, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xBF,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x0B, 0xC0, 0x00, 0x00, 0x1F,
-    0xC7, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF4,
-    0xFD, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00,
-    0x3F, 0x80, 0x00, 0x7E, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xF8, 0x01,
-    0xBF, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x3F, 0xFE, 0x07, 0xFF, 0x8F, 0xFF, 0x41, 0xFF, 0xD0,
-    0x7F, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x7E, 0x0B, 0x80, 0x00, 0x0B, 0xD7, 0xC0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xDF,
-    0xC0, 0x00, 0x03, 0xD1, 0xFC, 0x00, 0x03, 0xE0, 0x2F, 0x80, 0x03, 0xF0, 0x03, 0xF4, 0x0B, 0xFE,
-    0x01, 0xFF, 0xEB, 0xFF, 0xD1, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFD, 0x02, 0xFF, 0x93, 0xE0, 0xBD, 0x0F, 0x40, 0x2F, 0x80, 0xF4, 0x2F, 0x43, 0xD0, 0x0B, 0xE0,
-    0x3C, 0x0B, 0xD0, 0xB0, 0x02, 0xF8, 0x07, 0x02, 0xF4, 0x28, 0x00, 0xBE, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF8, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00,
-    0x0B, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x02,
-    0xF8, 0x00, 0x03, 0xF9, 0x00, 0x01, 0xBE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0x03, 0xC2, 0xF4, 0x78, 0x0F, 0xC0, 0x0F, 0x0B, 0xD0, 0xE0, 0x3F,
-    0x00, 0x38, 0x2F, 0x43, 0x40, 0xFC, 0x00, 0x00, 0xBD, 0x04, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xBD,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x82, 0xFF, 0xFD, 0x2F, 0xFE, 0x01,
-    0xFF, 0xF4, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x1F,
-    0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x02, 0xF4, 0x00, 0x1F, 0xC0, 0x02, 0xF4, 0x00, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x54, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xBF, 0xFC, 0x1F, 0xFF, 0x4B, 0xFF,
-    0x81, 0xFF, 0xE0, 0x0B, 0xD0, 0x02, 0xF0, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x02, 0xF0,
-    0x00, 0xBD, 0x00, 0x2F, 0x00, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x3F, 0xD5, 0xBF, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x01, 0x69, 0x6F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x82, 0xFF, 0xFD, 0x2F, 0xFE, 0x01, 0xFF, 0xF4, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00,
-    0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x02, 0xF4, 0x00, 0x1F,
-    0xC0, 0x02, 0xF4, 0x2C, 0x1F, 0xC0, 0x01, 0xFC, 0x2C, 0x1F, 0xC0, 0x00, 0xFF, 0x6C, 0x1F, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7D, 0x1F, 0xC0, 0x00,
-    0x00, 0x2C, 0x1F, 0xC0, 0x00, 0x00, 0x2C, 0x1F, 0xC0, 0x00, 0x00, 0x18, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x0B,
-    0xFF, 0xFD, 0xBF, 0xFC, 0x1F, 0xFF, 0x6F, 0xFE, 0x07, 0xFF, 0x80, 0xBD, 0x00, 0x2F, 0x00, 0x2F,
-    0x40, 0x0B, 0xC0, 0x0B, 0xD0, 0x02, 0xF0, 0x02, 0xF4, 0x60, 0xBC, 0x00, 0x7E, 0x1C, 0x2F, 0x00,
-    0x0F, 0xFB, 0xAF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0xF9, 0xBC, 0x00, 0x00, 0x1C, 0x2F,
-    0x00, 0x00, 0x07, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF1, 0xAE, 0x90, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0xAA, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0,
-    0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00,
-    0x1F, 0x80, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x1F,
-    0x80, 0x2F, 0xFF, 0x00, 0xBF, 0xFC, 0xFF, 0xFF, 0x42, 0xFF, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x40,
-    0x00, 0x03, 0xF1, 0xFF, 0xF4, 0x00, 0x0F, 0xEF, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x1F, 0xE0, 0x00,
-    0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7F,
-    0xFC, 0x02, 0xFF, 0xD3, 0xFF, 0xF0, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x0B, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x24, 0x2F, 0x80, 0x00, 0x1F, 0xC2, 0xC0, 0xFC, 0x00, 0x00,
-    0x3F, 0x0F, 0x07, 0xE0, 0x00, 0x00, 0xFD, 0x3D, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x5F, 0xE5, 0x55, 0x55, 0x54, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF9, 0x55, 0xAE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x40, 0xF8, 0x02, 0xF4, 0x2C, 0x2F, 0x00, 0x0F, 0xC3, 0xC3,
-    0xE0, 0x00, 0xFC, 0x3D, 0x7E, 0x00, 0x0F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x18, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0x00, 0x07, 0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xE0, 0x24, 0x2F, 0x80, 0x00, 0x1F, 0xC2, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0x0F, 0x07, 0xE0,
-    0x00, 0x00, 0xFD, 0x3D, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x5F, 0xE5, 0x55, 0x55, 0x54, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9,
-    0x55, 0xAE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x40,
-    0xF8, 0x02, 0xF4, 0x2C, 0x2F, 0x00, 0x0F, 0xC3, 0xC3, 0xE0, 0x00, 0xFC, 0x3D, 0x7E, 0x00, 0x0F,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x18,
-    0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE7, 0xFF, 0xE0, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xBF,
-    0xFD, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x57, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0xF0,
-    0x07, 0xFF, 0xF8, 0x02, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0x00, 0xBF, 0xD0, 0x03,
-    0xF0, 0x00, 0xFE, 0xC0, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xF0, 0x1F, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0xFC, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x7F, 0x5B, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF9, 0xBD, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x0F,
-    0xC0, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00,
-    0xFE, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x02, 0xFD,
-    0x00, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x3F, 0xD0, 0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0x03, 0xFE, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x02, 0xC0, 0x0B, 0x40, 0x00, 0x00, 0x07, 0xD0,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x2B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x2F, 0x80, 0x7F, 0xFC, 0x07, 0xF0, 0x2F, 0xE0, 0x7F, 0xF4, 0x1F, 0xF0, 0x01, 0xF4, 0x0B,
-    0xC0, 0x3E, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0xB8, 0x00, 0x00, 0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x00,
-    0x0F, 0x0B, 0xC2, 0xE0, 0x00, 0x00, 0x0B, 0x9B, 0xD7, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0x4B, 0xC3, 0xF0, 0x00, 0x00, 0x3E, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x0B,
-    0xC0, 0xFC, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x7E, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x3F, 0x40, 0x0F,
-    0xD0, 0x2F, 0xE4, 0x0F, 0xD0, 0x7F, 0x80, 0xBF, 0xFC, 0x07, 0xF8, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x01, 0x42, 0xFF, 0xFE, 0x00, 0x3F, 0xC7, 0xFF, 0xE0, 0x03, 0xFF, 0x00,
-    0xFC, 0x00, 0x3F, 0xAC, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0x3F, 0x00,
-    0xF4, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x0F, 0xDB, 0xF9, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xAB, 0xFF, 0x80, 0x03, 0xF0, 0x01, 0xFF, 0x40, 0x0F,
-    0xC0, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00,
-    0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0xBD, 0x0B, 0xFF, 0xD0, 0x03, 0xF0,
-    0xFF, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xF0, 0x0B, 0xEB, 0xFF, 0x80, 0xBF, 0x82, 0xF4, 0x07,
-    0xD0, 0x07, 0xD0, 0x3C, 0x00, 0x1F, 0x42, 0xE0, 0x00, 0x7D, 0x0F, 0x00, 0x01, 0xF9, 0xF9, 0x00,
-    0x07, 0xFF, 0xFF, 0x40, 0x1F, 0x96, 0xFF, 0x40, 0x7D, 0x00, 0x7F, 0x01, 0xF4, 0x00, 0xBD, 0x07,
-    0xD0, 0x01, 0xF8, 0x1F, 0x40, 0x03, 0xF2, 0xFF, 0x80, 0x0F, 0xBF, 0xFF, 0x40, 0x3E, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xC0, 0x2F, 0x80, 0x00, 0x02,
-    0xE0, 0x07, 0xE0, 0x00, 0x00, 0xB8, 0x01, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x7E, 0x00, 0x00, 0x0F,
-    0x80, 0x1F, 0x80, 0x00, 0x03, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x3C,
-    0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x00, 0x03, 0xE0,
-    0x01, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00,
-    0x07, 0xE0, 0x08, 0x2F, 0x00, 0x01, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0x7E, 0x02, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFD, 0x7F, 0x80, 0x01, 0xFF, 0xFF, 0x45, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x1F, 0x02, 0xF4, 0x00, 0x00, 0xF0, 0x1F, 0x40, 0x00, 0x0F, 0x01, 0xF4, 0x00, 0x01, 0xE0,
-    0x1F, 0x40, 0x00, 0x1E, 0x01, 0xF4, 0x00, 0x02, 0xD0, 0x1F, 0x40, 0x00, 0x3C, 0x01, 0xF4, 0x00,
-    0x03, 0xC0, 0x1F, 0x40, 0x00, 0x78, 0x01, 0xF4, 0x00, 0x0F, 0x40, 0x1F, 0x40, 0x3B, 0xF0, 0x01,
-    0xF4, 0x07, 0xFD, 0x00, 0xBF, 0xF8, 0x7F, 0x40, 0x3F, 0xFF, 0xC1, 0x40, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x7F,
-    0xFF, 0xC7, 0xFF, 0xD0, 0x00, 0xFF, 0xF9, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00,
-    0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xD5, 0x55, 0x57, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xD0, 0x00, 0x3F, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40,
-    0x00, 0x00, 0xBF, 0xFD, 0x07, 0xFF, 0xF2, 0xFF, 0xF0, 0x1F, 0xFF, 0x40, 0xBE, 0x00, 0x07, 0xE0,
-    0x01, 0xF4, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x01, 0xF8, 0x00, 0x7E,
-    0x55, 0x5B, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xE5, 0x55, 0xBE, 0x00, 0x1F, 0x40, 0x01,
-    0xF8, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x7E, 0x00,
-    0xBF, 0xF4, 0x01, 0xF8, 0x0F, 0xFF, 0xE0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xD0, 0x00, 0xFF, 0xF9, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F,
-    0xD5, 0x55, 0x57, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00,
-    0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xFC, 0xFF, 0xFF,
-    0x40, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0xBF, 0xFD, 0x07, 0xFF, 0xF2, 0xFF, 0xF0, 0x1F, 0xFF,
-    0x40, 0xBE, 0x00, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0x1F,
-    0x40, 0x01, 0xF8, 0x00, 0x7E, 0x55, 0x5B, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xE5, 0x55,
-    0xBE, 0x00, 0x1F, 0x40, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x1F, 0x80,
-    0x07, 0xD0, 0x00, 0x7E, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x8F, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x82, 0xFF, 0xFD, 0x2F, 0xFE, 0x01, 0xFF, 0xF4, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03,
-    0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x02, 0xF4,
-    0x00, 0x1F, 0xC0, 0x02, 0xF4, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x54, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0xBF, 0xFC, 0x1F, 0xFF, 0x6F, 0xFE, 0x07, 0xFF, 0x80, 0xBD, 0x00, 0x2F, 0x00, 0x2F,
-    0x40, 0x0B, 0xC0, 0x0B, 0xD0, 0x02, 0xF0, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x7E, 0x00, 0x2F, 0x00,
-    0x0F, 0xF5, 0x6F, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0xA5, 0xBC, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x00,
-    0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBB, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0x7F, 0x00,
-    0x0B, 0x7F, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0xF2, 0xF0, 0x00, 0x0F, 0x1F, 0x40, 0x1F, 0x2F, 0x00,
-    0x00, 0xF0, 0xFC, 0x02, 0xD2, 0xF0, 0x00, 0x0F, 0x0B, 0xC0, 0x3C, 0x1F, 0x00, 0x01, 0xF0, 0x7D,
-    0x07, 0x81, 0xF4, 0x00, 0x1F, 0x03, 0xE0, 0xB4, 0x1F, 0x40, 0x01, 0xF0, 0x2F, 0x0F, 0x00, 0xF4,
-    0x00, 0x2E, 0x00, 0xF5, 0xE0, 0x0F, 0x80, 0x02, 0xE0, 0x0F, 0xBD, 0x00, 0xF8, 0x00, 0x3E, 0x00,
-    0xBF, 0xC0, 0x0F, 0xC0, 0x03, 0xD0, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x02, 0xFF, 0xE0, 0x04, 0x00, 0xBF, 0xFE, 0xBF, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x3F, 0xF0, 0x00, 0x07,
-    0xFE, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x1E, 0xF4, 0x00, 0xFB,
-    0xC0, 0x07, 0xAF, 0x00, 0x76, 0xF0, 0x01, 0xE3, 0xD0, 0x3C, 0xBC, 0x00, 0x78, 0xBC, 0x1E, 0x2F,
-    0x00, 0x1E, 0x0F, 0x4F, 0x0B, 0xC0, 0x07, 0x82, 0xE7, 0x82, 0xF0, 0x01, 0xE0, 0x7F, 0xC0, 0xBC,
-    0x00, 0x78, 0x0F, 0xE0, 0x2F, 0x00, 0x1E, 0x01, 0xF0, 0x0B, 0xC0, 0x07, 0x80, 0x38, 0x02, 0xF0,
-    0x0B, 0xFE, 0x00, 0x02, 0xFF, 0xDB, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF2,
-    0xFF, 0xE0, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x07, 0xFF, 0xE7, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00,
-    0x02, 0xFD, 0x5F, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC,
-    0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9,
-    0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x0A, 0x00, 0x38, 0x00, 0xBC, 0x00, 0xF4,
-    0x01, 0xF4, 0x0B, 0xD0, 0x03, 0xFE, 0xFE, 0x00, 0x01, 0xBE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0xFD, 0x02, 0xF8, 0x03, 0xF0,
-    0x03, 0xE0, 0x07, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x2F, 0xFF,
-    0xF0, 0x07, 0xFF, 0xAF, 0xC0, 0x3F, 0x40, 0x3F, 0x02, 0xF4, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xF0,
-    0x1F, 0xC0, 0x3F, 0xD0, 0x3F, 0xFF, 0xEF, 0xFC, 0x3F, 0xFC, 0x3F, 0xC0, 0x15, 0x00, 0x10, 0x00,
-    0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00,
-    0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F,
-    0x00, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0,
-    0xFC, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE,
-    0xAA, 0xAF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E,
-    0x00, 0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x06, 0x00, 0x24, 0x00, 0x7F, 0x03, 0xF0, 0x01, 0xFC, 0x1F, 0xD0,
-    0x02, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0xFD, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0x40,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x07, 0xFF, 0xAF,
-    0xC0, 0x3F, 0x40, 0x3F, 0x02, 0xF4, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xF0, 0x1F, 0xC0, 0x3F, 0xD0,
-    0x3F, 0xFF, 0xEF, 0xFC, 0x3F, 0xFC, 0x3F, 0xC0, 0x15, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE7, 0xE0, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x1F, 0x80, 0x02, 0xC0, 0x00, 0x00, 0xB8, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0x85, 0x54, 0x00,
-    0x00, 0x0F, 0x40, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBC, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE5,
-    0x5B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFA, 0xAA, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x09, 0x00, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0x3C, 0x03,
-    0xE0, 0x00, 0x1F, 0x80, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0xBE, 0x01, 0x5F, 0x87, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0x00, 0x01, 0x40, 0x00,
-    0x1F, 0xFE, 0x03, 0xFF, 0xD0, 0x0F, 0xFB, 0xF9, 0xFF, 0xFF, 0x43, 0xF4, 0x0B, 0xFD, 0x01, 0xFC,
-    0x3F, 0x00, 0x3F, 0x80, 0x0F, 0xC1, 0xD0, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x01, 0x5F,
-    0xD0, 0x00, 0x6B, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFA, 0x95, 0x01, 0xFE, 0x53, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0xC0,
-    0x00, 0x07, 0xF0, 0x0B, 0xFF, 0x40, 0x18, 0x3F, 0xFF, 0xF7, 0xFF, 0xFF, 0xC0, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xF0, 0x01, 0x50, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0xF0,
-    0x00, 0x3E, 0x00, 0x7D, 0x00, 0x0F, 0xE5, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x55, 0x50,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0,
-    0x00, 0x0F, 0x00, 0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x07,
-    0x40, 0x1D, 0x03, 0xE0, 0x0B, 0xC0, 0xFC, 0x03, 0xF0, 0x1F, 0xEB, 0xF4, 0x00, 0x6F, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xFE, 0x07, 0xE0, 0x0F, 0xD3,
-    0xF0, 0x01, 0xF9, 0xF4, 0x00, 0x3F, 0xBD, 0x00, 0x0F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x19,
-    0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x80, 0x01, 0x54, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xF4, 0x00, 0x7F, 0xC0, 0x7C, 0x00, 0x00, 0xFF,
-    0x02, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x15, 0x55, 0x55, 0x5F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xD0, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00,
-    0x01, 0xF8, 0x7E, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x2F, 0xD0, 0x02, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC1, 0xE0, 0x03, 0xF8, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xD5, 0x55,
-    0xFB, 0xF0, 0x00, 0x3E, 0xBD, 0x00, 0x2F, 0x1F, 0xC0, 0x1F, 0x82, 0xFE, 0xAF, 0xC0, 0x2F, 0xFF,
-    0x80, 0x00, 0x55, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x02, 0xFC,
-    0x1F, 0xD0, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x94, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xF4, 0x00,
-    0x7F, 0xC0, 0x7C, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x15, 0x55, 0x55,
-    0x5F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xD0, 0x00, 0x00, 0xFC, 0xBD,
-    0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x0B,
-    0xE0, 0x2F, 0xD0, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x01,
-    0x69, 0x00, 0x00, 0x05, 0x00, 0x50, 0x0B, 0xE0, 0x7F, 0x03, 0xFC, 0x2F, 0xC0, 0x7C, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xFC,
-    0x1E, 0x00, 0x3F, 0x81, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0x55, 0x5F, 0xBF, 0x00, 0x03, 0xEB, 0xD0, 0x02,
-    0xF1, 0xFC, 0x01, 0xF8, 0x2F, 0xEA, 0xFC, 0x02, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x2F, 0xC0, 0x1F, 0xFF, 0xE0, 0x0B, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0xE0, 0x07, 0xFC, 0x02,
-    0xFF, 0x40, 0x0F, 0xC0, 0x03, 0xFB, 0x00, 0x01, 0xF0, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xB8, 0x0F,
-    0xC0, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF5, 0xFD, 0x6F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE6, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0x43, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x0B, 0xE0, 0x00, 0x00,
-    0x0F, 0xD0, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xF0,
-    0x03, 0xF0, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0x3F,
-    0x00, 0x0B, 0xF4, 0x03, 0xFD, 0x00, 0xBF, 0xFE, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x7F, 0xFF, 0x80,
-    0x0F, 0xF8, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x2F, 0x80, 0x7F, 0xFC, 0x07, 0xF0, 0x2F, 0xE0, 0x7F, 0xF4, 0x1F, 0xF0, 0x01,
-    0xF4, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0xB8, 0x00, 0x00, 0x2D, 0x0B, 0xC0, 0xF0,
-    0x00, 0x00, 0x0F, 0x0B, 0xC2, 0xE0, 0x00, 0x00, 0x0B, 0x9B, 0xD7, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x4B, 0xC3, 0xF0, 0x00, 0x00, 0x3E, 0x0B, 0xC1, 0xF4, 0x00, 0x00,
-    0xBC, 0x0B, 0xC0, 0xFC, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x7E, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x3F,
-    0x40, 0x0F, 0xD0, 0x2F, 0xE4, 0x0F, 0xD0, 0x7F, 0x80, 0xBF, 0xFC, 0x07, 0xF8, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x01, 0x40, 0x04, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0xBF, 0x07, 0xF4, 0x01, 0xF8,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFA, 0xFF, 0xC0, 0xFD, 0x00, 0x3F, 0x43, 0xE0, 0x00, 0xBE, 0x0F, 0x40, 0x01, 0xF8,
-    0x2C, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x05, 0x5F, 0xC0, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x0B, 0xE7, 0x80, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFC, 0xFF, 0x40, 0x0F,
-    0xE1, 0xFF, 0xEB, 0xFE, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x16, 0x50, 0x00, 0x02, 0x40, 0x14, 0x03,
-    0xF4, 0x3F, 0x40, 0xFD, 0x0F, 0xE0, 0x2E, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x0B, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x07, 0x80, 0x1F, 0xC0, 0x40, 0x03, 0xF0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x1A, 0xBD, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xE2, 0xC0, 0x01, 0xF8, 0xFC, 0x00, 0xFC, 0x2F, 0xFB, 0xFD,
-    0x02, 0xFF, 0xFD, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x0F, 0x80, 0x02, 0xF8, 0x0F, 0x00, 0x07, 0xE0, 0x0F, 0x00, 0x1F, 0x80, 0x09,
-    0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x02, 0xF8, 0x3F,
-    0x80, 0x0B, 0xF0, 0x2F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x50, 0x00, 0x2F,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x2F, 0x83, 0xC0, 0x07, 0xE0, 0x38, 0x01, 0xF8,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x6B, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC2, 0x40, 0x01, 0xF8, 0x7D, 0x00,
-    0x3F, 0x03, 0xFE, 0xBF, 0xD0, 0x1F, 0xFF, 0xF0, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x1F, 0xFF, 0xF7, 0xFF, 0xD0, 0x00, 0xBF, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xF0,
-    0x00, 0x3F, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xCF, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0x3F,
-    0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0x00, 0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0xC0, 0x03,
-    0xF3, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xEF, 0xFF, 0xF4, 0x01, 0xFF, 0xFE, 0x00, 0x2A, 0xAA, 0x90, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x6A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xFB, 0xFF, 0x80, 0x3F, 0xFD, 0x0B,
-    0xD0, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x07, 0xD0, 0x03, 0xFD, 0x00, 0x7D, 0x00, 0xFB,
-    0xD0, 0x07, 0xD0, 0x3D, 0x3D, 0x00, 0x7D, 0x0F, 0x43, 0xD0, 0x07, 0xD3, 0xD0, 0x3D, 0x00, 0x7E,
-    0xF4, 0x03, 0xD0, 0x07, 0xFC, 0x00, 0x3D, 0x00, 0x7F, 0x00, 0x03, 0xD0, 0x07, 0xD0, 0x00, 0x3D,
-    0x02, 0xFF, 0x80, 0x1F, 0xFE, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x00, 0x01, 0x40, 0x14, 0x00, 0x00,
-    0x00, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x7F, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0xFC, 0x00, 0x3F, 0x00, 0x3F,
-    0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0xFC, 0x00, 0x3F, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0xFC,
-    0x00, 0xFC, 0x00, 0x3F, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x00, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0xBF, 0xFE, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0x00,
-    0x14, 0x01, 0x40, 0x00, 0x0B, 0xE0, 0xBF, 0x00, 0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x07, 0xC0, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xBF, 0xF8, 0x03, 0xFF, 0xD0, 0xBD, 0x00, 0x03, 0xE0, 0x07, 0xD0, 0x00, 0xFD,
-    0x00, 0x7D, 0x00, 0x3F, 0xD0, 0x07, 0xD0, 0x0F, 0xBD, 0x00, 0x7D, 0x03, 0xD3, 0xD0, 0x07, 0xD0,
-    0xF4, 0x3D, 0x00, 0x7D, 0x3D, 0x03, 0xD0, 0x07, 0xEF, 0x40, 0x3D, 0x00, 0x7F, 0xC0, 0x03, 0xD0,
-    0x07, 0xF0, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x2F, 0xF8, 0x01, 0xFF, 0xEF, 0xFF, 0xD0,
-    0x3F, 0xFF, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xFC, 0x1F,
-    0xD0, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFB, 0xFF,
-    0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x0B,
-    0xF0, 0x2F, 0x80, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x07,
-    0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F,
-    0xCB, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBE,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x07, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x01, 0x90, 0x05, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x07, 0xF4, 0x3F,
-    0x40, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03,
-    0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00,
-    0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03,
-    0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0xBF, 0xFC,
-    0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x07, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x7F,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x2F, 0x80, 0x00, 0x00, 0x1F, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3D, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00,
-    0xFC, 0xBD, 0x55, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0x55, 0x55, 0xFC, 0xBD, 0x00, 0x00,
-    0xFC, 0xBE, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x02, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF,
-    0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x0B,
-    0xF0, 0x3F, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xEB, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x07, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x01, 0x90, 0x05, 0x00,
-    0x03, 0xF0, 0x3F, 0x40, 0x07, 0xF4, 0x3F, 0x40, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3D, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0xFC,
-    0xBD, 0x55, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0x55, 0x55, 0xFC, 0xBD, 0x00, 0x00, 0xFC,
-    0xBE, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x02, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x7F, 0x03, 0xF4,
-    0x00, 0x0B, 0xF0, 0x3F, 0x40, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x02, 0xF4, 0x00, 0xBF, 0xC0, 0x2F, 0x00, 0x01, 0xFE, 0x02, 0xE0, 0x00, 0x0B, 0xF0, 0x1D, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0x55, 0x56, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x40, 0x00, 0x03, 0xF0, 0x3C, 0x00, 0x00, 0xBE, 0x0B,
-    0xD0, 0x00, 0x1F, 0xC0, 0xBF, 0x80, 0x0B, 0xF4, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x09, 0x00, 0x50, 0x0F, 0xD0, 0xFE, 0x03, 0xF4, 0x3F, 0x80,
-    0xB8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x2F, 0xFF, 0x80,
-    0x3F, 0xFF, 0xFC, 0x1E, 0x00, 0x7F, 0x81, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F,
-    0x80, 0x2A, 0xAB, 0xE0, 0x0F, 0xFF, 0xF8, 0x01, 0x55, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07,
-    0xC7, 0x00, 0x03, 0xF3, 0xF0, 0x02, 0xF4, 0xBF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6A, 0xAA, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xF9, 0xFF, 0xF9, 0x00, 0x6F, 0xF8, 0x03, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0xBE, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x02, 0xF8, 0x00, 0x3E, 0x00,
-    0x00, 0x3F, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xC0, 0x00,
-    0x00, 0x1F, 0x83, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xB8, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD7, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xAA, 0xAA, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x03, 0xFF, 0xC7, 0xFF,
-    0xD0, 0x2F, 0xF8, 0x0F, 0xD0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8,
-    0x00, 0x2F, 0x40, 0x1F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x1F, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0xE0, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x70, 0x7E, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x14, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x7F, 0xFE, 0x40, 0x1B, 0xFE, 0x00, 0xFC, 0x00, 0x00,
-    0xBC, 0x00, 0x2F, 0x80, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0xBE, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x02, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x01, 0xF0,
-    0x00, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xAE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF5, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x06, 0x40, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0x00, 0x0F, 0x40,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xE0, 0x3F, 0xFC, 0x7F, 0xFD, 0x02, 0xFF, 0x80, 0xFD, 0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00,
-    0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00,
-    0xBC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x01, 0xF5, 0xF0,
-    0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x07, 0x07, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x6E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x0D, 0x00, 0x00, 0x02,
-    0xF4, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x02, 0xF4,
-    0x0F, 0xC0, 0x00, 0x00, 0xA0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE7, 0xFF, 0xE4, 0x01, 0xBF, 0xE0, 0x0F, 0xC0, 0x00,
-    0x0B, 0xC0, 0x02, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xE0, 0x00,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x80, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x1F,
-    0x00, 0x00, 0x00, 0x7E, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x00, 0x01, 0xFA, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x5F, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x0B, 0xD2, 0xF4, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x00, 0x24, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x7F, 0xFD,
-    0x02, 0xFF, 0x80, 0xFD, 0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80,
-    0x02, 0xF4, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x03, 0xE0,
-    0xBC, 0x00, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0x07, 0xE0, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x50, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x00, 0x2F, 0x41, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x82, 0xFF, 0xFD, 0x2F, 0xFE, 0x01, 0xFF, 0xF4, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03,
-    0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x02, 0xF4,
-    0x00, 0x1F, 0xC0, 0x02, 0xF4, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x54, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x50, 0x06, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x2F, 0xC1, 0xFC,
-    0x00, 0x03, 0xD0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x7F, 0xFD, 0xBF, 0xF8, 0x1F, 0xFE, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0xBD,
-    0x00, 0x2F, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x0B, 0xD0, 0x02, 0xF0, 0x01, 0xF8, 0x00, 0xBC, 0x00,
-    0x3F, 0xD5, 0xBF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x16, 0x96, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x00,
-    0x7E, 0x03, 0xF0, 0x00, 0xF4, 0x0F, 0xC0, 0x03, 0xD0, 0x3F, 0x00, 0x0B, 0x00, 0xFC, 0x00, 0x14,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xD0, 0xBE,
-    0x05, 0xF0, 0x1F, 0x40, 0x3C, 0x07, 0xD0, 0x0F, 0x01, 0xF4, 0x02, 0x80, 0x7D, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07,
-    0xE0, 0x00, 0x0B, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0xFC, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F,
-    0xFF, 0x90, 0x00, 0x2F, 0x40, 0x03, 0xFF, 0xFF, 0xE0, 0x02, 0xF4, 0x00, 0x3F, 0x55, 0xBF, 0xC0,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0xFD, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x03,
-    0xF0, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x7E,
-    0x02, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x2F, 0x40, 0x03, 0xF0, 0x07, 0xF8, 0x02, 0xF4, 0x02,
-    0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x14, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0xFE, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xFF, 0xFD, 0xBF,
-    0xFD, 0x00, 0x1F, 0xFF, 0x80, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00,
-    0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x0F, 0xC0,
-    0x07, 0xFF, 0xFF, 0x40, 0xFC, 0x00, 0x7D, 0x00, 0xFC, 0x0F, 0xC0, 0x07, 0xD0, 0x07, 0xD0, 0xFC,
-    0x00, 0x7D, 0x00, 0x7D, 0x0F, 0xC0, 0x07, 0xD0, 0x07, 0xC0, 0xFC, 0x00, 0x7D, 0x01, 0xFC, 0x0F,
-    0xC0, 0x2F, 0xFF, 0xFF, 0x07, 0xFF, 0xCF, 0xFF, 0xFF, 0x80, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x2C, 0x00, 0xFC,
-    0x00, 0x14, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x1D, 0xBD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xD0, 0xBE, 0x05, 0xF0, 0x1F, 0x40, 0x3C, 0x07, 0xD0, 0x0F, 0x01, 0xF4,
-    0x02, 0x85, 0xBE, 0x54, 0x03, 0xFF, 0xFF, 0x00, 0x5B, 0xE5, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xFF, 0x90, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xC1, 0xFF, 0xF8,
-    0x01, 0xBF, 0xD0, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0xFD, 0x00, 0x00, 0x00, 0xF8, 0x1F,
-    0xC0, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x07,
-    0xF4, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xD0, 0xFF, 0xFF, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x3F, 0xFE, 0x07, 0xFF, 0x8F, 0xFF, 0x41, 0xFF, 0xD0, 0x7F, 0x00, 0x0F, 0x80, 0x07, 0xF0,
-    0x0F, 0x80, 0x00, 0x7E, 0x0B, 0x80, 0x00, 0x0B, 0xD7, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xDF, 0xC0, 0x00, 0x03, 0xD1, 0xFC, 0x00,
-    0x03, 0xE0, 0x2F, 0x80, 0x03, 0xF0, 0x03, 0xF4, 0x0B, 0xFE, 0x00, 0x3F, 0x0B, 0xFF, 0xD0, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xC1, 0xFF, 0xF8, 0x01, 0xBF, 0xD0, 0x07,
-    0xF4, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x00,
-    0xFD, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x00, 0x02, 0xFB, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xAB, 0xFF, 0xAA, 0x40, 0x00, 0x02,
-    0xFB, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0xFD, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0xFC,
-    0x02, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0xBF, 0x00, 0xBF, 0xF8, 0x01, 0xBF, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0xFE,
-    0x07, 0xFF, 0x8F, 0xFF, 0x41, 0xFF, 0xD0, 0x7F, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00,
-    0x7E, 0x0B, 0x80, 0x00, 0x0B, 0xD7, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x01, 0x5B, 0xFE, 0x50, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x03, 0xD1, 0xF8, 0x00, 0x03, 0xE0, 0x2F,
-    0x80, 0x03, 0xF0, 0x03, 0xF4, 0x0B, 0xFE, 0x01, 0xFF, 0xDB, 0xFF, 0xD1, 0xFF, 0xF8, 0x5A, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x50, 0x57, 0x5D, 0x1F, 0x40, 0xF0,
-    0x3F, 0xC5, 0xA5, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x6A, 0xAB, 0xDB, 0xAA, 0xBD,
-    0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xC0,
-    0x00, 0x7E, 0xAA, 0x97, 0xEA, 0xAE, 0x1D, 0x00, 0x60, 0x74, 0x06, 0x00, 0xD0, 0x60, 0x00, 0x06,
-    0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00,
-    0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x6A, 0xAA, 0x7F,
-    0xFF, 0xEB, 0xFF, 0xF4, 0x6A, 0xAA, 0x7F, 0xFF, 0xEB, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xEB, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA,
-    0xAA, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x14, 0x01,
-    0x43, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3,
-    0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0,
-    0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E,
-    0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E,
-    0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE2, 0x90, 0x29, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF,
-    0xE5, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xE0, 0xF0, 0xB8, 0x3D, 0x1F, 0x4B, 0xD1, 0xFC, 0x3F, 0x00,
-    0x00, 0x01, 0x01, 0xFC, 0x0F, 0xD0, 0xBD, 0x07, 0xD0, 0xBC, 0x0F, 0x41, 0xF0, 0x3C, 0x00, 0x00,
-    0x01, 0x01, 0xFC, 0x0F, 0xD0, 0xBD, 0x07, 0xD0, 0xBC, 0x0F, 0x41, 0xF0, 0x3C, 0x00, 0x00, 0x04,
-    0x0F, 0xDB, 0xF2, 0xF4, 0x7D, 0x0F, 0x42, 0xE0, 0x3C, 0x07, 0x80, 0x00, 0x01, 0x00, 0x10, 0x1E,
-    0x02, 0xD0, 0xF0, 0x1F, 0x0B, 0x80, 0xF4, 0x3D, 0x07, 0xC1, 0xF4, 0x2F, 0x0B, 0xD0, 0xFD, 0x1F,
-    0xC2, 0xFC, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x1F, 0xC2, 0xFC, 0x0F, 0xD0,
-    0xFC, 0x0B, 0xD0, 0xBD, 0x07, 0xD0, 0xBC, 0x0B, 0xC0, 0xF8, 0x0F, 0x40, 0xF4, 0x1F, 0x02, 0xE0,
-    0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x1F, 0xC2, 0xFC, 0x0F, 0xD0, 0xFC, 0x0B,
-    0xD0, 0xBD, 0x07, 0xD0, 0xBC, 0x0B, 0xC0, 0xF8, 0x0F, 0x40, 0xF0, 0x1F, 0x02, 0xE0, 0x3C, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0xFD, 0x1F, 0xCB, 0xF0, 0xBE, 0x2F, 0x43, 0xF0, 0x7D,
-    0x0B, 0xC0, 0xF4, 0x1F, 0x02, 0xE0, 0x3E, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0x78, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0x40, 0x01, 0x40, 0xF4, 0x04, 0x3F, 0xEF, 0xBF, 0xD3, 0xFF, 0xFF, 0xFD, 0x25, 0x0F, 0x41, 0x80,
-    0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x0F, 0x40, 0x01, 0x40, 0xF4, 0x04, 0x3F, 0xEF, 0xBF, 0xD3, 0xFF, 0xFF, 0xFD, 0x25,
-    0x0F, 0x41, 0x80, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xF8, 0x00, 0x15, 0x0F, 0x41, 0x83, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD1, 0x40,
-    0xF4, 0x14, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x47, 0xFF, 0x2F, 0xFD, 0x7F, 0xF0, 0xFF, 0x80, 0x50,
-    0x00, 0x74, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE,
-    0xFF, 0xFE, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x05, 0x03, 0xFC, 0x3F, 0xC3, 0xF8,
-    0x05, 0x00, 0x05, 0x00, 0x14, 0x3F, 0x80, 0xFF, 0x7F, 0x80, 0xFF, 0x3F, 0x40, 0xFE, 0x04, 0x00,
-    0x10, 0x05, 0x00, 0x00, 0x50, 0x00, 0x14, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xC3, 0xFC, 0x00,
-    0xBF, 0x80, 0x0F, 0xF0, 0xFE, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x04, 0x00, 0x00, 0x40, 0x00, 0x14,
-    0x00, 0x1F, 0x43, 0xFC, 0x3F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00,
-    0x34, 0x60, 0x2B, 0xDB, 0x02, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1D, 0x00, 0x07, 0x40, 0x01, 0xC0, 0x00, 0x7E, 0x80, 0x97, 0xE8, 0x0E, 0x1D, 0x00, 0x60, 0x74,
-    0x06, 0x00, 0xD0, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06,
-    0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00,
-    0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x90, 0x00, 0x2F, 0x40, 0x07, 0xAD, 0x01, 0xCA, 0x34, 0x30, 0xA0, 0xC0,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD3, 0x40, 0x00, 0x74, 0xE0,
-    0x00, 0x1D, 0x38, 0x6A, 0xAF, 0x4E, 0xEA, 0xAF, 0x4D, 0xD0, 0x1D, 0x34, 0xD0, 0x70, 0xD0, 0xD1,
-    0xC3, 0x40, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7,
-    0x40, 0x0B, 0x1D, 0x00, 0x2C, 0x74, 0x00, 0xB1, 0xFA, 0xA9, 0x70, 0xFA, 0xAB, 0x1C, 0x34, 0x07,
-    0x07, 0x0D, 0x07, 0x01, 0xC3, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x0F, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x0B, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xB8, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0xF4, 0x3C, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x02, 0xF0, 0x2F, 0x07, 0x43, 0xFF, 0xF0, 0x03, 0xFF,
-    0xF0, 0x0F, 0xEF, 0xD0, 0xF0, 0xBC, 0x0F, 0x80, 0xFC, 0x1F, 0x40, 0x3F, 0xF0, 0x2C, 0x0F, 0x40,
-    0xBC, 0x0F, 0x00, 0xBC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x03, 0xC2, 0xF0, 0x07, 0xC0, 0x00, 0x00,
-    0xF0, 0x2F, 0x00, 0x3D, 0x2E, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x02, 0xF0, 0x03, 0xD3, 0xE0, 0x07,
-    0xC0, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0x3C, 0x2E, 0x00, 0x7C, 0x00, 0x00, 0xB4, 0x01, 0xF0, 0x07,
-    0xC2, 0xF0, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0xF8, 0x1F, 0x40, 0xF4, 0x00, 0x03, 0xD0,
-    0x00, 0xBE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x80,
-    0x00, 0x0B, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0xE0, 0xBD, 0x0F, 0xC2, 0xF4, 0x3E, 0x07, 0xC0, 0xF4,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x34, 0x07, 0xE0, 0xBC, 0x0B, 0xD0, 0xFC, 0x0F, 0xC2,
-    0xF8, 0x2F, 0x43, 0xF0, 0x3E, 0x07, 0xD0, 0x7C, 0x0F, 0x80, 0xF4, 0x0F, 0x00, 0x10, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0D, 0x02, 0xC0, 0x7E, 0x0B, 0xC0, 0xFC, 0x2F, 0x43, 0xF0,
-    0x7E, 0x0F, 0xC2, 0xF8, 0x3F, 0x0B, 0xD0, 0xFC, 0x1F, 0x83, 0xE0, 0x7D, 0x0B, 0xC1, 0xF0, 0x3E,
-    0x03, 0xD0, 0xF4, 0x0F, 0x01, 0xE0, 0x04, 0x01, 0x00, 0x20, 0x00, 0x00, 0x07, 0x40, 0xFC, 0x0F,
-    0xD0, 0x7F, 0x03, 0xF0, 0x0F, 0x80, 0x7C, 0x02, 0xD0, 0x08, 0x00, 0x00, 0x00, 0x74, 0x02, 0xC0,
-    0xFC, 0x0B, 0xC0, 0xFD, 0x07, 0xE0, 0x7F, 0x03, 0xF0, 0x3F, 0x01, 0xF8, 0x0F, 0x80, 0xFC, 0x07,
-    0xC0, 0x3D, 0x02, 0xD0, 0x1E, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x0B, 0x00,
-    0xB0, 0x0F, 0xC0, 0xBC, 0x07, 0xE0, 0x3F, 0x41, 0xF8, 0x0F, 0xC0, 0x7F, 0x03, 0xF0, 0x2F, 0x40,
-    0xFC, 0x07, 0xE0, 0x3F, 0x00, 0xF8, 0x0F, 0xC0, 0x7D, 0x01, 0xF0, 0x0F, 0x40, 0xF8, 0x02, 0xD0,
-    0x1E, 0x00, 0xF0, 0x02, 0x00, 0x10, 0x01, 0x40, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F,
-    0xB8, 0x00, 0x1F, 0x0B, 0x80, 0x1F, 0x00, 0xB8, 0x0F, 0x40, 0x0B, 0x80, 0x00, 0x24, 0x03, 0xD0,
-    0x7E, 0x07, 0xE0, 0xBF, 0x03, 0xF4, 0x0B, 0xE0, 0x0B, 0xD0, 0x0B, 0xD0, 0x07, 0xC0, 0x03, 0x40,
-    0x20, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x07, 0xF0,
-    0x0F, 0xC0, 0x3E, 0x00, 0x34, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x1E, 0x2D,
-    0x00, 0xF0, 0x07, 0x80, 0xB4, 0x1F, 0x40, 0xE0, 0x02, 0xC0, 0xA0, 0x38, 0x00, 0x0B, 0x00, 0x0F,
-    0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x0A, 0x03, 0xFC, 0x0A, 0x01, 0xF8,
-    0x0F, 0x01, 0xF4, 0x0F, 0x42, 0xF8, 0x0F, 0x00, 0x00, 0xB5, 0xE0, 0x00, 0x00, 0x2D, 0x07, 0x80,
-    0x00, 0x07, 0x40, 0x1D, 0x00, 0x01, 0xE0, 0x50, 0x74, 0x00, 0x78, 0x1F, 0x42, 0xD0, 0x0E, 0x01,
-    0xF4, 0x0B, 0x43, 0x80, 0x05, 0x00, 0x2C, 0x70, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x1A, 0x1F, 0xC0, 0x1F, 0x8B, 0xE0, 0x0B, 0xE2, 0xF4, 0x03, 0xF4, 0xBD, 0x00, 0xFD,
-    0x2F, 0x40, 0x2F, 0x0B, 0xC0, 0x0B, 0xC2, 0xF0, 0x02, 0xF0, 0xBC, 0x00, 0xBC, 0x2F, 0x00, 0x2F,
-    0x07, 0xC0, 0x0B, 0xC1, 0xF0, 0x01, 0xF0, 0x7C, 0x00, 0x7C, 0x0F, 0x00, 0x0F, 0x03, 0xC0, 0x03,
-    0xC0, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0xFC, 0x01,
-    0xFC, 0xBF, 0x40, 0xBF, 0x1F, 0xC0, 0x1F, 0xC1, 0x40, 0x01, 0x40, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF,
-    0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x00, 0x6A, 0xA3, 0xFF, 0xDB, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0xBF, 0x80, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x2F, 0xFF, 0xD0, 0x2F, 0xFF, 0xD0, 0x20, 0x1F,
-    0xC0, 0x20, 0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x2F, 0xFE, 0x00, 0x1F, 0xFE, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x1F,
-    0xF9, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x90, 0xBF, 0x80, 0x00, 0x2F, 0x8B, 0xFF, 0xD0, 0x00, 0xFD, 0x2F, 0xFF, 0xD0, 0x03, 0xF4, 0x20,
-    0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x3C,
-    0x03, 0xF0, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x2F, 0x00, 0x2F, 0xFE, 0x00, 0xBC,
-    0x07, 0xFF, 0xE0, 0x02, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0xF0,
-    0x00, 0x00, 0x7C, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0xF8, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x0B, 0xF0,
-    0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x14, 0x00, 0x00, 0x14, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0xBF, 0x80, 0x0B, 0xE0, 0x0B, 0xFF, 0xD0, 0x2F, 0x40, 0x3F, 0xFF, 0xD0, 0xBD, 0x00, 0x50,
-    0x1F, 0xC2, 0xF4, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x3C,
-    0xBC, 0x00, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x00, 0x1F, 0xC7, 0xC0, 0x00, 0x2F, 0xFD, 0x1F, 0x00,
-    0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x1F, 0xF8, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0x03, 0xC0, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x10, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xBF, 0x40, 0x0F, 0xE0, 0x01, 0xFC, 0x00,
-    0x3F, 0x40, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x03,
-    0xC2, 0xFA, 0xFF, 0x97, 0xE0, 0xF0, 0x06, 0xFF, 0xE0, 0x10, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xD0, 0x2C, 0x03, 0x80, 0x7E, 0x0B, 0xC0, 0xFC, 0x1F, 0x42,
-    0xF4, 0x3F, 0x07, 0xE0, 0xFD, 0x0F, 0xC2, 0xF8, 0x3F, 0x03, 0xF0, 0xBD, 0x0F, 0xC1, 0xF8, 0x2F,
-    0x43, 0xE0, 0x7D, 0x0B, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x3D, 0x0B, 0xC0, 0xF4, 0x0F, 0x01, 0xE0,
-    0x3D, 0x00, 0x40, 0x10, 0x02, 0x00, 0x50, 0x00, 0x01, 0xBE, 0x00, 0x3F, 0xFF, 0x43, 0xF4, 0x7F,
-    0x1F, 0x40, 0x3E, 0xBC, 0x00, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x2F, 0xF8, 0x00,
-    0xFF, 0xF0, 0x03, 0xE7, 0xD0, 0x2F, 0x0F, 0xE6, 0xF8, 0x1F, 0xFF, 0x80, 0x06, 0x90, 0x00, 0x00,
-    0x06, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x02, 0xEB, 0x80, 0x1F, 0x2E, 0x00,
-    0xF0, 0xB8, 0x0F, 0x42, 0xE0, 0xBD, 0x5F, 0xD6, 0xFF, 0xFF, 0xF2, 0xAA, 0xFE, 0x40, 0x02, 0xE0,
-    0x00, 0x0B, 0x80, 0x00, 0x19, 0x00, 0x02, 0xAA, 0x80, 0x7F, 0xFC, 0x07, 0xEA, 0x80, 0xB4, 0x00,
-    0x0B, 0x90, 0x00, 0xFF, 0xE0, 0x06, 0xBF, 0xC0, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00,
-    0x0B, 0xC1, 0x5B, 0xF4, 0x3F, 0xFD, 0x01, 0xA5, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0xFF, 0x80, 0x2F,
-    0x80, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0xBF, 0xFD, 0x03, 0xFF, 0xFE, 0x0F, 0x40, 0xBC, 0x3D,
-    0x00, 0xF4, 0xF4, 0x03, 0xD3, 0xF0, 0x1F, 0x47, 0xF5, 0xFC, 0x0B, 0xFF, 0xC0, 0x01, 0xA4, 0x00,
-    0x2A, 0xAA, 0x87, 0xFF, 0xFE, 0x7A, 0xAB, 0xDB, 0x00, 0xB8, 0x20, 0x1F, 0x00, 0x03, 0xD0, 0x00,
-    0xB8, 0x00, 0x0F, 0x00, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0B, 0x80,
-    0x00, 0x20, 0x00, 0x01, 0xBE, 0x00, 0x2F, 0xFF, 0x01, 0xF0, 0x3E, 0x0B, 0x80, 0x7C, 0x1F, 0x03,
-    0xE0, 0x3F, 0xBE, 0x00, 0x3F, 0xF0, 0x03, 0xFB, 0xF4, 0x2E, 0x03, 0xF0, 0xF0, 0x07, 0xC3, 0xC0,
-    0x1F, 0x0F, 0xD1, 0xF8, 0x1F, 0xFF, 0x80, 0x06, 0x90, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xFF, 0x02,
-    0xF4, 0x7E, 0x0F, 0x40, 0x7C, 0x3D, 0x00, 0xF4, 0xF8, 0x03, 0xD2, 0xF4, 0x1F, 0x43, 0xFF, 0xFC,
-    0x01, 0xBF, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF8, 0x00, 0x6F, 0xC0, 0x2F, 0xF8, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xF4, 0x07, 0xFF, 0xBF, 0x00, 0x3E, 0x03, 0xD0, 0x0F, 0x40,
-    0xF8, 0x03, 0xD0, 0x3E, 0x00, 0xF4, 0x0F, 0x80, 0x3D, 0x03, 0xE0, 0x0F, 0x40, 0xF8, 0x1F, 0xF8,
-    0xBF, 0xC1, 0x54, 0x15, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xFE, 0x0F, 0xC0, 0xBD,
-    0x7C, 0x00, 0xFA, 0xF0, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x03,
-    0xEB, 0xC0, 0x0F, 0x5F, 0x80, 0xFC, 0x2F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x07, 0xFF, 0x00, 0xAF, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07,
-    0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x2F, 0xFF, 0x4F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x01, 0xFE, 0xFE, 0x0F, 0x80, 0xFC, 0x3D, 0x02, 0xF0, 0x10, 0x0F, 0x80,
-    0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xE5, 0x54,
-    0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0x80, 0x00, 0x40, 0x0B, 0xFF, 0x4B, 0xEB, 0xF3, 0xC0, 0x3D, 0x10,
-    0x0F, 0x00, 0x0F, 0x80, 0x7F, 0x80, 0x3F, 0xFC, 0x04, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0xF8, 0x01,
-    0xFC, 0xAF, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8,
-    0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x80, 0x0F, 0x6E, 0x00, 0xB8, 0xB8, 0x07, 0xC2, 0xE0, 0x3C, 0x0B,
-    0x83, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xC0, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x7F, 0xFC, 0x0B, 0x80, 0x00, 0xB4, 0x00, 0x0B, 0xE4, 0x00, 0xFF,
-    0xF4, 0x00, 0x6F, 0xC0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x1F, 0xC2, 0xBF, 0xF0,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0x7E, 0x90, 0x03, 0xFF, 0xFC, 0x0F, 0x96, 0xFC, 0x3C, 0x01, 0xF4, 0xF4, 0x03,
-    0xD3, 0xE0, 0x0F, 0x4F, 0xD0, 0xBC, 0x0F, 0xFF, 0xE0, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xD7, 0xFF, 0xFE, 0xB4, 0x07, 0xC7, 0x00, 0xF4, 0x10, 0x2E, 0x00, 0x07, 0xC0, 0x00, 0xF8,
-    0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0xFE, 0x00, 0xF9, 0xBD, 0x0B, 0xC0, 0xBC, 0x2E, 0x02, 0xE0,
-    0x7E, 0x0F, 0x40, 0x7F, 0xF4, 0x00, 0xFF, 0xD0, 0x1F, 0x5F, 0xE0, 0xF4, 0x0B, 0xC3, 0xC0, 0x0F,
-    0x0F, 0x40, 0x7C, 0x2F, 0xAB, 0xD0, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1F,
-    0xFD, 0x01, 0xFE, 0xFD, 0x0F, 0x80, 0xFC, 0x3D, 0x01, 0xF0, 0xF4, 0x03, 0xD3, 0xF0, 0x0F, 0x47,
-    0xFA, 0xBC, 0x07, 0xFF, 0xF0, 0x01, 0x5F, 0x80, 0x00, 0xBC, 0x00, 0x0B, 0xD0, 0x16, 0xFD, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0x95,
-    0x5B, 0xC0, 0xBD, 0x00, 0x1F, 0x02, 0xF4, 0x00, 0x38, 0x0B, 0xD0, 0x00, 0x40, 0x2F, 0x40, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x2F, 0xEA, 0xA8, 0x00,
-    0xBD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xAF, 0xFA, 0x40, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0B, 0xD0,
-    0xBE, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x0A, 0xBE, 0xAA, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xFC, 0x05, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2A, 0xF9, 0x55, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x58, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xBF, 0xFF, 0xFC, 0x18, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x3E, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x7D, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x6F, 0xFF,
-    0xC0, 0x7F, 0xF4, 0x01, 0xF8, 0x0B, 0xF4, 0xFF, 0xFF, 0xC2, 0xF9, 0xBC, 0x01, 0xFF, 0xFF, 0xD0,
-    0x07, 0xC0, 0x03, 0xC0, 0x38, 0x01, 0xFF, 0xF9, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x10, 0x01, 0xF8,
-    0x00, 0x00, 0x07, 0xC0, 0x03, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xFF, 0x80,
-    0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x01, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x02, 0x40, 0x7C, 0x01, 0xF8, 0x00, 0x00, 0x07,
-    0xD0, 0x03, 0x80, 0x7C, 0x1F, 0xFF, 0xD0, 0x00, 0x03, 0xFA, 0x93, 0xD6, 0xF4, 0x3F, 0xFF, 0xE0,
-    0x00, 0x02, 0xFF, 0xC3, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0x91,
-    0xBC, 0x00, 0x1F, 0xC0, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x38, 0x00, 0xBD, 0x00, 0x02, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x17, 0xF5, 0x55, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x06, 0xBF, 0xAA, 0x90, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xE4, 0x05, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xB8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0B,
-    0xFF, 0x80, 0x0B, 0x9D, 0xB8, 0x0B, 0x87, 0x4F, 0x81, 0xC1, 0xD0, 0xD0, 0x00, 0x74, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0xFF, 0xFF, 0xFF, 0xEB,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x1D, 0x00, 0x0B, 0x07, 0x43, 0x42, 0xF1, 0xD3, 0xE0, 0x2F, 0x77, 0xE0, 0x02, 0xFF, 0xE0,
-    0x00, 0x2F, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0x07,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF4, 0x00, 0x00, 0x7C, 0x03, 0xD0,
-    0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0x5D, 0x7C,
-    0x0F, 0x87, 0x4B, 0xC0, 0x81, 0xD0, 0x80, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x06, 0x07, 0x42, 0x43, 0xE1, 0xD2,
-    0xF0, 0x3E, 0x76, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0x9D,
-    0xBC, 0x0F, 0x87, 0x4B, 0xC1, 0x81, 0xD0, 0x90, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x01, 0xD0, 0x00, 0x60, 0x74, 0x24, 0x3E, 0x1D, 0x2F, 0x03, 0xE7, 0x6F, 0x00, 0x2F,
-    0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x34, 0x0F, 0x00,
-    0x3E, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x2E, 0x00, 0x3C, 0x2F, 0x55, 0x5F, 0x0F, 0xFF, 0xFF, 0xC2,
-    0xF5, 0x55, 0x50, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x0B, 0x00,
-    0x0F, 0x03, 0xE0, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x02, 0xE0, 0x3D, 0x55, 0x7E, 0x0F, 0xFF, 0xFF,
-    0xC1, 0x55, 0x57, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0x00, 0x01,
-    0xF0, 0x01, 0xF0, 0x00, 0x7C, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0xF4, 0x00,
-    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAA, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xEB, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0x8B, 0x80, 0x0F, 0xE2, 0xFC, 0x0F, 0xF8, 0xBF, 0xC7,
-    0x9E, 0x2D, 0xB4, 0x47, 0x8B, 0x44, 0x01, 0xE2, 0xD0, 0x00, 0x78, 0xB4, 0x00, 0x2E, 0x2D, 0x00,
-    0x0B, 0x8B, 0x40, 0x02, 0xE2, 0xE0, 0x00, 0xB8, 0xB8, 0x00, 0x2E, 0x2E, 0x00, 0x0B, 0x8B, 0x80,
-    0x02, 0xE2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xBF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0xBF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0xB8, 0xB8, 0x00, 0x2E, 0x2E, 0x00, 0x0B, 0x8B, 0x80,
-    0x02, 0xE2, 0xE0, 0x00, 0xB8, 0xB8, 0x00, 0x2E, 0x2D, 0x00, 0x07, 0x8B, 0x40, 0x01, 0xE2, 0xD0,
-    0x00, 0x78, 0xB4, 0x01, 0x1E, 0x2D, 0x11, 0xE7, 0x8B, 0x6D, 0x2F, 0xE2, 0xFE, 0x02, 0xF8, 0xBE,
-    0x00, 0x2E, 0x2E, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x40, 0x00, 0x07, 0xD0, 0x1F, 0x40, 0x00, 0x7C, 0x00, 0x0F,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x0F,
-    0x40, 0x00, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00,
-    0x07, 0xC0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x1C, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x2F, 0x4F,
-    0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xBD, 0x00,
-    0x00, 0xF8, 0x01, 0xFE, 0xAA, 0xAF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xF5, 0x56, 0xF4,
-    0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00,
-    0xFC, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF,
-    0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xFF,
-    0xC0, 0x03, 0xFA, 0xFF, 0x00, 0x34, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE7, 0xF0, 0x0B, 0xFF, 0xFF, 0x03, 0xF4, 0x1F,
-    0xF0, 0xBC, 0x00, 0x3E, 0x1F, 0x40, 0x03, 0xE3, 0xF0, 0x00, 0x3D, 0x3D, 0x00, 0x07, 0xC7, 0xC0,
-    0x00, 0xBC, 0xBC, 0x00, 0x0F, 0x8B, 0xC0, 0x01, 0xF0, 0xBC, 0x00, 0x3E, 0x0B, 0xD0, 0x07, 0xC0,
-    0x7F, 0x01, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFC, 0x54, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC5, 0x54, 0x07, 0xF7, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF5, 0x55, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x03, 0x40, 0x00,
-    0x2F, 0xFF, 0xF4, 0x3F, 0x00, 0x07, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0xBF, 0x90, 0x07, 0xFF, 0x00,
-    0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xF4, 0x01, 0xF8, 0x00, 0x02, 0xF7,
-    0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x0F, 0xC0, 0x3E, 0x00, 0x02, 0xF4, 0x2F, 0x01, 0xF8, 0x00, 0x1F,
-    0x40, 0x7D, 0x07, 0xD0, 0x01, 0xF4, 0x01, 0xF4, 0x1F, 0x40, 0x1F, 0x40, 0x07, 0xD0, 0x7D, 0x01,
-    0xF4, 0x00, 0x2F, 0x41, 0xF8, 0x1F, 0x40, 0x00, 0xBC, 0x03, 0xF0, 0xF8, 0x00, 0x03, 0xF0, 0x0B,
-    0xDF, 0x80, 0x00, 0x2F, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xD0,
-    0x00, 0xFF, 0xD0, 0x06, 0xFE, 0x00, 0x0F, 0xAF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x1F, 0xFF, 0xF8,
-    0x00, 0x01, 0xC0, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0xB8, 0xBD, 0x00, 0x00, 0x03,
-    0xD1, 0xF8, 0x00, 0x00, 0x1F, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x07, 0xC0, 0x1F,
-    0xC0, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0x00, 0xBE, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00,
-    0x3E, 0x00, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3D, 0x00,
-    0x00, 0x3F, 0x42, 0xF4, 0x00, 0x00, 0xBE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xFD, 0x00,
-    0x00, 0xF8, 0x01, 0xFC, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xF4,
-    0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00,
-    0xFC, 0x0B, 0x80, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF,
-    0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0x94, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0xF9, 0x55, 0x55, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xBF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x42, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0x80, 0x03,
-    0xF0, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00,
-    0x3C, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xD0, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0xBD,
-    0x01, 0xF0, 0x00, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0x01, 0xFD, 0x3D, 0x00, 0x00, 0x01, 0xFF, 0xF5,
-    0x55, 0x50, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xE5, 0x55, 0x55, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x15, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xAA, 0xAA, 0x90, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x80, 0x01, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x01, 0x55, 0x55, 0xBF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x03, 0xE0, 0x5B, 0xF8, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x0F, 0x00, 0x03, 0xF0,
-    0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x1F, 0x40, 0x03,
-    0xE0, 0x00, 0x7D, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3D, 0x00,
-    0x1F, 0x40, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x80,
-    0x00, 0x0B, 0x80, 0xFC, 0x00, 0x00, 0x1F, 0x1F, 0xD0, 0x15, 0x55, 0x7F, 0xFD, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x01,
-    0x55, 0x55, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x55, 0x55, 0x50, 0x2F, 0x4B, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0xC1, 0xAA, 0xAA, 0xAF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x1A, 0xAA, 0xAA,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0xBF, 0x90, 0x00, 0x6F, 0xE4, 0xBF, 0xFF, 0x80, 0x3F, 0xFF, 0xC6, 0xAA, 0xA0, 0x02, 0xAA,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xFE,
-    0x00, 0x00, 0xFC, 0x07, 0xF4, 0x00, 0x07, 0xC0, 0x2F, 0xC0, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0x02,
-    0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1C, 0x03, 0xF0, 0x00, 0x03, 0xD0,
-    0xFC, 0x00, 0x00, 0x3C, 0x2F, 0x80, 0x00, 0x1B, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x01, 0x80, 0xF0, 0x14, 0x3F, 0x4F, 0x0F, 0xC0, 0xBE, 0xFB, 0xE0, 0x00, 0xFF, 0xF4, 0x00, 0x07,
-    0xFD, 0x00, 0x07, 0xFF, 0xFD, 0x02, 0xF8, 0xF2, 0xFC, 0x2D, 0x0F, 0x07, 0x80, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x2F, 0xAF, 0xC7, 0xC0,
-    0x3D, 0xB8, 0x02, 0xEB, 0x40, 0x1E, 0xB8, 0x02, 0xE7, 0xD0, 0x7C, 0x2F, 0xFF, 0x40, 0x6F, 0x80,
-    0x1F, 0x43, 0xFC, 0x3F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x05, 0x55, 0x00, 0x0F, 0x80, 0xFF, 0xF0, 0x01, 0xF0,
-    0x0F, 0xFF, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00, 0xFC,
-    0x07, 0xC0, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0x03, 0xF1, 0xF0, 0x00,
-    0x00, 0x2F, 0x2E, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x2E, 0x2F, 0xFE, 0x0B, 0xD7, 0xD1,
-    0xF9, 0xE0, 0xB4, 0x03, 0xFC, 0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x01, 0xF4, 0x0B, 0x80, 0x7F, 0xC0,
-    0x7F, 0xAF, 0x1F, 0x82, 0xFF, 0xC0, 0x7E, 0x01, 0x50, 0x00, 0x90, 0x02, 0xF8, 0x00, 0xBE, 0x00,
-    0xFF, 0xF0, 0x7F, 0xFC, 0x3E, 0x0B, 0x8F, 0x47, 0xD7, 0xC0, 0x3F, 0xC0, 0x2E, 0x78, 0x00, 0xF4,
-    0x01, 0xE7, 0x80, 0x1F, 0x80, 0x1E, 0x7C, 0x03, 0xFE, 0x03, 0xD3, 0xFA, 0xF0, 0xFE, 0xFC, 0x0F,
-    0xFC, 0x03, 0xFF, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xAA,
-    0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xAA, 0xA4,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x14, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x29, 0x54, 0x05, 0x2F, 0x07, 0xCB, 0xC1, 0xF2,
-    0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB,
-    0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F,
-    0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC,
-    0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x1A, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xEF, 0x40, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x03,
-    0xD0, 0xF4, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x0F,
-    0x80, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00,
-    0x3F, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x3E, 0x00,
-    0x00, 0x1F, 0x41, 0xF4, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x00, 0x2F, 0x07,
-    0xD0, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x3D, 0x00,
-    0x00, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x01, 0xF4,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x00,
-    0x7C, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0x07, 0xCF,
-    0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0x40, 0x7F, 0x40, 0x07, 0xF4, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x0B, 0xC7, 0xD0,
-    0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E,
-    0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00,
-    0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00,
-    0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x00, 0xF5, 0xF4,
-    0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x2F, 0x0F, 0xD0, 0x00, 0x1F, 0xC1, 0xFE, 0x00, 0x2F, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x02, 0xF0, 0x3C, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3C, 0x0F, 0xC0, 0x00, 0x7F, 0xAF, 0x40, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x01, 0x40, 0xFE, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02,
-    0xFC, 0x05, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x40, 0xFE, 0x00, 0x00, 0x1F, 0xC3,
-    0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x09, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xF9, 0xFD, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3F, 0x6F, 0xE7, 0xF4, 0x64, 0x05, 0x00, 0x00, 0x00, 0x40,
-    0xFE, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x09, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0xFE, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x00,
-    0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x54, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x03, 0xC2, 0xFA, 0xFF, 0x97, 0xE0, 0xF0, 0x06, 0xFF, 0xE0, 0x10, 0x00, 0x06,
-    0x40, 0x00, 0x01, 0xA8, 0x00, 0x05, 0x03, 0xFF, 0xF4, 0x03, 0xC3, 0xF5, 0xBF, 0xEB, 0xD0, 0xE0,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55,
-    0x55, 0x50, 0x02, 0x90, 0x00, 0x41, 0xFF, 0xD0, 0x2E, 0x3F, 0xBF, 0xDB, 0xD7, 0xC0, 0xBF, 0xF8,
-    0x20, 0x00, 0xBD, 0x00, 0x29, 0x00, 0x04, 0x1F, 0xFD, 0x02, 0xD3, 0xFF, 0xFD, 0xBD, 0x7C, 0x0B,
-    0xFF, 0x83, 0x00, 0x1B, 0xE0, 0x10, 0x00, 0x00, 0x01, 0x0F, 0xFA, 0xAA, 0xBF, 0xC2, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x01, 0x6A, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xBF, 0xA9, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3E, 0x95, 0x55, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x3C, 0x05, 0x55, 0x6F, 0x53, 0xFF, 0xFF, 0xFC, 0xAA, 0xAF, 0xAA,
-    0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x01, 0x57, 0xD5, 0x54, 0xFF, 0xFF, 0xFF, 0x2B, 0xFA, 0xAA,
-    0x80, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55,
-    0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
-    0xE0, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x01,
-    0xBF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x02, 0xC0, 0x00, 0x1F, 0xF0,
-    0x00, 0xBF, 0x40, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x7F, 0xD0,
-    0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x1F,
-    0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x0B, 0xF8,
-    0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x0B, 0xF8, 0x00,
-    0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFD, 0x00, 0x00,
-    0x2F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFE,
-    0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0x80, 0x07, 0xFD,
-    0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x06, 0xAA, 0xAA, 0xAF,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xC1, 0xAA, 0xAA, 0xAB, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x1A, 0xAA, 0xAA, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x81, 0xFF, 0xAA, 0xFE, 0xA9, 0x1F, 0xD0, 0x03, 0xD0, 0x00, 0xFD, 0x00, 0x1F, 0x00, 0x03, 0xE0,
-    0x00, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0xBC,
-    0x00, 0x07, 0xD0, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x3F, 0x40, 0xBC, 0x00, 0x00,
-    0x3F, 0x43, 0xE0, 0x00, 0x00, 0x7F, 0xEF, 0xAA, 0xAA, 0x40, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x07,
-    0xFA, 0xAA, 0xA4, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x1A, 0xAA, 0xAF, 0xBF,
-    0xD0, 0x00, 0x00, 0xB8, 0x1F, 0xD0, 0x00, 0x03, 0xD0, 0x1F, 0xC0, 0x00, 0x1F, 0x00, 0x2F, 0x00,
-    0x00, 0xBC, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x07, 0xE0, 0x00, 0xBC,
-    0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xBF,
-    0x06, 0xAB, 0xFA, 0xAF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x6A, 0xFE, 0xAA, 0x40, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x82, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
-    0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE6, 0xE6, 0xF8, 0x00, 0x0F,
-    0x80, 0x74, 0x0B, 0xC0, 0x0F, 0x40, 0x1D, 0x00, 0x7C, 0x07, 0x80, 0x07, 0x40, 0x0B, 0x43, 0xC0,
-    0x01, 0xD0, 0x00, 0xF1, 0xD0, 0x00, 0x74, 0x00, 0x2D, 0xB0, 0x00, 0x1D, 0x00, 0x03, 0xBC, 0x00,
-    0x07, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x1D, 0x00, 0x03, 0xEC, 0x00, 0x07, 0x40, 0x00, 0xE7, 0x40, 0x01, 0xD0, 0x00, 0x74, 0xF0, 0x00,
-    0x74, 0x00, 0x3C, 0x2E, 0x00, 0x1D, 0x00, 0x2E, 0x03, 0xD0, 0x07, 0x40, 0x1F, 0x00, 0x3E, 0x01,
-    0xD0, 0x2F, 0x00, 0x02, 0xF9, 0xB9, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE5,
-    0x16, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x07, 0x80, 0x00,
-    0x00, 0x0B, 0x43, 0xC0, 0x00, 0x00, 0x00, 0xF1, 0xD0, 0x00, 0x00, 0x00, 0x2D, 0xB0, 0x00, 0x00,
-    0x00, 0x03, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x40, 0x00, 0x00,
-    0x00, 0x74, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x00,
-    0x1F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF9, 0x01, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x0B, 0xE5, 0x16, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0x01,
-    0xFC, 0x07, 0xBC, 0x00, 0x01, 0xFB, 0x43, 0xC7, 0xC0, 0x01, 0xF4, 0xF1, 0xD0, 0x7C, 0x01, 0xF4,
-    0x1D, 0xB0, 0x07, 0xC1, 0xF4, 0x03, 0xBC, 0x00, 0x7D, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00,
-    0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFB, 0xC0, 0x03, 0xEC, 0x01, 0xF0, 0x7C, 0x00,
-    0xE7, 0x41, 0xF0, 0x07, 0xC0, 0x74, 0xF1, 0xF0, 0x00, 0x7C, 0x3C, 0x2E, 0xF0, 0x00, 0x07, 0xEE,
-    0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF9, 0x01, 0xBE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE5, 0x16, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0,
-    0x0F, 0x40, 0x00, 0x01, 0xFC, 0x07, 0x80, 0x00, 0x01, 0xFB, 0x43, 0xC0, 0x00, 0x01, 0xF4, 0xF1,
-    0xD0, 0x00, 0x01, 0xF4, 0x1D, 0xB0, 0x00, 0x01, 0xF4, 0x03, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0xFF,
-    0x00, 0x01, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00, 0x0F, 0xF0, 0x01, 0xF4, 0x00, 0x03, 0xEC,
-    0x01, 0xF4, 0x00, 0x00, 0xE7, 0x41, 0xF4, 0x00, 0x00, 0x74, 0xF1, 0xF4, 0x00, 0x00, 0x3C, 0x2E,
-    0xF4, 0x00, 0x00, 0x2E, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x02,
-    0xF9, 0x01, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x06, 0xAA, 0xBF, 0xAA, 0xA6,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0x43, 0xFC, 0x3F, 0xC2, 0xF8, 0x00,
-    0x00, 0x0A, 0x00, 0x01, 0xA0, 0x00, 0x29, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x2F, 0xC3, 0xFC, 0x00,
-    0xBF, 0x80, 0x0F, 0xF0, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x5B,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x02, 0xFC, 0x69, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xE2, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xD1, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD2,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_14_regularBitmaps[31664] = {
+    0x8D, 0x55, 0xBF, 0x8F, 0x1C, 0x35, 0x14, 0xFE, 0x66, 0xCC, 0x9E, 0x8B, 0x11, 0x38, 0x45, 0x22,
+    0x45, 0x1C, 0x62, 0xF8, 0x03, 0x8E, 0x4C, 0x93, 0x22, 0xC5, 0x5E, 0xEC, 0x24, 0x05, 0x05, 0x45,
+    0xAE, 0xC8, 0xD6, 0xE9, 0x83, 0xC4, 0x35, 0x94, 0xFB, 0x63, 0x22, 0x0A, 0x0A, 0x9A, 0xAB, 0x68,
+    0x49, 0x09, 0x9B, 0xE2, 0x52, 0xA4, 0x08, 0xD2, 0xFE, 0xF0, 0xE5, 0x0A, 0x24, 0xD2, 0x0C, 0xA2,
+    0xA0, 0x64, 0x02, 0x05, 0x48, 0x57, 0xC4, 0xE1, 0x26, 0xD2, 0x24, 0x99, 0x59, 0xF3, 0x79, 0xF6,
+    0x72, 0xB9, 0x74, 0x8C, 0xEC, 0xF1, 0xF8, 0xD9, 0x7E, 0x7E, 0xEF, 0x7B, 0xDF, 0x7B, 0xF3, 0x61,
+    0xFA, 0xE4, 0xCF, 0x6A, 0x9E, 0x7D, 0xFE, 0xD8, 0xCD, 0x32, 0x79, 0xE0, 0x86, 0x4A, 0x58, 0x07,
+    0xC0, 0x34, 0xCB, 0xDB, 0x07, 0xE6, 0xE2, 0x46, 0x2A, 0x9F, 0x3C, 0x7E, 0xEE, 0x66, 0xC3, 0x34,
+    0x95, 0x3F, 0x1F, 0x3C, 0x77, 0xC3, 0xCB, 0xEF, 0x63, 0xFD, 0xF4, 0x85, 0x85, 0xCC, 0xAF, 0x00,
+    0x0F, 0xA5, 0x81, 0xC2, 0x03, 0x4C, 0x5F, 0xED, 0xFF, 0xA8, 0xBC, 0xF7, 0x45, 0x5C, 0x5C, 0x02,
+    0xB6, 0x62, 0x0B, 0x61, 0xFB, 0xC0, 0x15, 0xEE, 0x4B, 0xF2, 0x47, 0xD0, 0x5C, 0xDA, 0xD8, 0x9F,
+    0xBE, 0xBA, 0x07, 0xA7, 0x80, 0x8F, 0xA3, 0x12, 0x71, 0xF1, 0xE9, 0x5A, 0xCD, 0xDB, 0x87, 0xFB,
+    0xC3, 0x9C, 0x5A, 0x45, 0x8E, 0x0D, 0xBF, 0x17, 0x7B, 0x9F, 0xCF, 0xAF, 0xB4, 0xEA, 0xC6, 0x8D,
+    0xA7, 0xEE, 0xF2, 0x76, 0x2A, 0xAE, 0x5D, 0xAB, 0xBF, 0x82, 0x7A, 0x6D, 0xA0, 0x6B, 0x60, 0x19,
+    0xBA, 0x43, 0x92, 0x59, 0xF3, 0x60, 0xD4, 0x4F, 0xC4, 0xDF, 0xF6, 0xC1, 0xF6, 0x58, 0xC9, 0xC3,
+    0xFA, 0x79, 0x9D, 0xFA, 0x15, 0xB2, 0x55, 0xB0, 0x0B, 0xA0, 0x37, 0x67, 0x86, 0x9D, 0x33, 0xB7,
+    0xA1, 0x40, 0xE4, 0x0D, 0x52, 0xAA, 0x69, 0x21, 0x0A, 0xA4, 0xB1, 0xC3, 0x23, 0x88, 0x52, 0x19,
+    0xEE, 0xDC, 0x46, 0x1D, 0x17, 0xB4, 0x26, 0xC9, 0x69, 0xD4, 0x10, 0x8F, 0x28, 0x12, 0x85, 0xBA,
+    0x5B, 0x86, 0x95, 0xAA, 0x2F, 0xEB, 0xD8, 0x65, 0xF2, 0x86, 0x77, 0xEA, 0x59, 0xE1, 0x66, 0x2A,
+    0xD7, 0x6E, 0x4B, 0x99, 0x19, 0x20, 0xEF, 0xBA, 0xE0, 0x80, 0xCB, 0xB8, 0x0B, 0x97, 0x62, 0x27,
+    0x82, 0x8A, 0x2C, 0xF8, 0xF5, 0x30, 0x72, 0xD2, 0xF2, 0x2E, 0x65, 0xEA, 0x70, 0xD7, 0x62, 0x02,
+    0xDE, 0x15, 0x7B, 0x82, 0x03, 0x44, 0x06, 0xEF, 0x3C, 0x19, 0x6F, 0x41, 0xCA, 0x35, 0xC8, 0x72,
+    0xCC, 0xCF, 0x46, 0x50, 0xA0, 0x72, 0xC2, 0x8A, 0x9A, 0x67, 0xF9, 0x39, 0x0C, 0x52, 0x1A, 0x8E,
+    0xE4, 0x20, 0xE7, 0x7B, 0x85, 0x0B, 0xB7, 0x30, 0x71, 0x89, 0x2F, 0xD4, 0xF7, 0x76, 0xF7, 0x1F,
+    0xE1, 0x16, 0x34, 0xF9, 0xAA, 0xA8, 0xA5, 0x95, 0x85, 0x2A, 0x87, 0x18, 0x41, 0x7F, 0x63, 0x65,
+    0x09, 0x5F, 0x41, 0xF3, 0x52, 0xC4, 0x2D, 0xD4, 0xCA, 0x24, 0xAB, 0xFD, 0xD7, 0x7E, 0x2F, 0xF5,
+    0x75, 0xD2, 0xA2, 0xB7, 0x83, 0x1E, 0x2E, 0x0E, 0x67, 0xC3, 0xF0, 0x5C, 0xA6, 0xCA, 0xC8, 0x46,
+    0x15, 0x2A, 0xD4, 0x98, 0x85, 0xD3, 0x34, 0x3B, 0xB1, 0xB4, 0xA2, 0xE2, 0x24, 0x43, 0x62, 0x89,
+    0xD4, 0x0C, 0xA9, 0x91, 0x05, 0x37, 0x68, 0x70, 0x68, 0x90, 0x19, 0xE1, 0x30, 0xA1, 0xC5, 0x18,
+    0x43, 0x52, 0x01, 0x09, 0xA0, 0x69, 0x24, 0x28, 0x4D, 0x73, 0x8E, 0x5C, 0xD0, 0xA0, 0x4E, 0x15,
+    0x26, 0x89, 0xE5, 0xF9, 0xB7, 0x2F, 0xCA, 0x2A, 0x62, 0xC3, 0xAD, 0xDB, 0x50, 0x36, 0x72, 0xB8,
+    0x4A, 0x11, 0xEF, 0xB8, 0xD8, 0xC1, 0x11, 0x17, 0x1F, 0x5D, 0x15, 0xC7, 0x36, 0xAD, 0x76, 0x52,
+    0x9F, 0xBC, 0x38, 0x3E, 0xCE, 0xB7, 0xFA, 0x8C, 0x12, 0xCE, 0x75, 0x8B, 0x6A, 0x4D, 0x19, 0xD7,
+    0x91, 0x47, 0x81, 0x0C, 0x3C, 0xF6, 0xBE, 0x09, 0xF0, 0xBF, 0xB3, 0xD2, 0x0B, 0xB1, 0x4F, 0xAD,
+    0x36, 0x8D, 0x70, 0xA9, 0x69, 0xA4, 0xE5, 0x06, 0xDC, 0x99, 0x4E, 0xFC, 0x91, 0xAF, 0x7A, 0xA2,
+    0xD1, 0x87, 0x75, 0xD8, 0x91, 0x06, 0x6C, 0xC1, 0x38, 0xC5, 0x04, 0xBC, 0x02, 0x2D, 0x0B, 0x8A,
+    0x4E, 0xA5, 0x21, 0x0C, 0xEE, 0x8D, 0x34, 0xA3, 0xD4, 0x9C, 0x48, 0x69, 0x31, 0xA3, 0x79, 0x22,
+    0x8D, 0x4E, 0xC3, 0xD8, 0x92, 0x5F, 0xDE, 0xCA, 0x97, 0xB7, 0x9D, 0x2A, 0x44, 0x9D, 0xE5, 0x51,
+    0x43, 0x44, 0x5A, 0xF6, 0x39, 0xA3, 0xBA, 0x58, 0x00, 0xE3, 0x39, 0x30, 0x99, 0xAF, 0xC7, 0x31,
+    0xE7, 0x0B, 0xCA, 0xE7, 0x64, 0x06, 0xF7, 0x45, 0x75, 0x66, 0x85, 0x53, 0xA5, 0x2A, 0x25, 0x93,
+    0x00, 0xBE, 0xA5, 0x0F, 0x6B, 0x9A, 0x24, 0xD4, 0xCA, 0x74, 0x0A, 0x2D, 0x20, 0xFC, 0xBF, 0x9A,
+    0xD9, 0xF4, 0xAD, 0x0E, 0x3A, 0x80, 0x4D, 0x6F, 0x12, 0xBF, 0x12, 0xF5, 0x66, 0x35, 0x86, 0xFE,
+    0xD6, 0x46, 0x0D, 0x03, 0x79, 0x60, 0xA2, 0x86, 0xF6, 0x9A, 0x10, 0x01, 0x70, 0x57, 0x96, 0x23,
+    0x61, 0x82, 0x32, 0xC1, 0x16, 0xA7, 0x13, 0xC2, 0xB1, 0x9C, 0x4E, 0xEF, 0x33, 0x8D, 0x99, 0xCA,
+    0x45, 0xD0, 0xB4, 0xDB, 0x82, 0x5F, 0xAB, 0xEB, 0x0D, 0x09, 0xF2, 0x01, 0x92, 0x22, 0x9C, 0xA6,
+    0x1E, 0x36, 0x49, 0x3A, 0xF8, 0x5C, 0x32, 0x0E, 0x98, 0x10, 0x39, 0x17, 0x78, 0x40, 0x6E, 0x40,
+    0xE7, 0xC8, 0x2C, 0x96, 0xBF, 0xEE, 0xFB, 0x42, 0x7B, 0x13, 0xDD, 0x3A, 0x45, 0x8A, 0x9D, 0xDE,
+    0xD0, 0x2F, 0x08, 0x76, 0xF5, 0x8C, 0xA2, 0x5D, 0x42, 0x42, 0x79, 0x93, 0x81, 0xA9, 0x46, 0x8A,
+    0x65, 0x0C, 0x42, 0x46, 0x67, 0x32, 0xCC, 0x69, 0x29, 0xCD, 0x58, 0x4D, 0xD8, 0x7B, 0x83, 0xDD,
+    0x5B, 0xEB, 0xF3, 0x67, 0xFB, 0x05, 0xAA, 0xF1, 0xB9, 0xF6, 0x8D, 0x78, 0x35, 0xCD, 0x47, 0x08,
+    0x51, 0x62, 0x42, 0x04, 0x13, 0x43, 0xD5, 0x48, 0x7C, 0x8D, 0x3B, 0xBE, 0xEC, 0x92, 0x5F, 0xD0,
+    0xC7, 0xD4, 0x12, 0xED, 0xCE, 0x4F, 0x51, 0x75, 0x76, 0x2C, 0xED, 0x17, 0xDE, 0x49, 0x26, 0x4B,
+    0xEF, 0x4D, 0xB9, 0xD8, 0x6C, 0xC8, 0xAC, 0x3D, 0xB9, 0x42, 0xB4, 0xA2, 0x23, 0x2C, 0x2C, 0x45,
+    0x70, 0x13, 0x7A, 0x60, 0xC2, 0x45, 0x34, 0x24, 0x29, 0x44, 0x33, 0x87, 0xFA, 0x83, 0x99, 0x3D,
+    0x87, 0x3C, 0x62, 0x12, 0x30, 0x15, 0xFE, 0xAA, 0xD0, 0x66, 0x45, 0x66, 0xBD, 0x77, 0x31, 0xEF,
+    0xA4, 0xBF, 0xA9, 0xF7, 0x25, 0x4D, 0xFF, 0x8D, 0x5D, 0x99, 0xA8, 0xEE, 0x93, 0xED, 0x8E, 0xFE,
+    0x74, 0xCC, 0x62, 0x9C, 0x98, 0x1E, 0x94, 0x80, 0x49, 0xD6, 0x45, 0x82, 0x79, 0x13, 0x80, 0x0B,
+    0xF8, 0x31, 0x36, 0xE1, 0x33, 0x48, 0xC9, 0x45, 0xE6, 0x07, 0x4E, 0xF8, 0x0F, 0xE9, 0x73, 0xDA,
+    0x80, 0x56, 0x36, 0x99, 0x51, 0x87, 0xCC, 0x4B, 0x8D, 0xE4, 0x71, 0x8D, 0x5A, 0x39, 0x0D, 0xFD,
+    0xCC, 0xC2, 0x3B, 0xC6, 0xA2, 0x50, 0x85, 0xFF, 0xDA, 0xC5, 0xED, 0x18, 0xC9, 0x51, 0x11, 0x28,
+    0x27, 0x68, 0xE2, 0x5C, 0xE7, 0xD9, 0x81, 0x0F, 0x9E, 0x76, 0xB6, 0x85, 0x27, 0x22, 0x2C, 0xDA,
+    0x57, 0xA2, 0xBD, 0xED, 0xD2, 0x5C, 0x95, 0x2D, 0x52, 0x6A, 0xD4, 0x37, 0x2D, 0xF7, 0x92, 0x0E,
+    0x0B, 0x24, 0x4F, 0x5B, 0x64, 0xD7, 0xFD, 0x77, 0x2D, 0x2B, 0xB3, 0xC3, 0x9D, 0x7D, 0xDB, 0xD1,
+    0x25, 0x18, 0x48, 0x50, 0x64, 0x15, 0x20, 0xED, 0x2D, 0xAB, 0xC0, 0xFC, 0x2E, 0xE3, 0xDE, 0x66,
+    0xD6, 0xC9, 0xB3, 0xA3, 0x0F, 0x1B, 0x9D, 0xEF, 0xC0, 0xA4, 0x76, 0x79, 0xAD, 0x79, 0xA7, 0xEE,
+    0x9D, 0x97, 0xCC, 0x12, 0x8D, 0x46, 0x16, 0x3A, 0x72, 0xEA, 0x74, 0xE5, 0x61, 0x08, 0x07, 0x96,
+    0xC5, 0x49, 0x23, 0x83, 0x44, 0xB8, 0x91, 0x3D, 0x79, 0xD3, 0x89, 0x4B, 0x42, 0x4C, 0xCE, 0x0D,
+    0x06, 0x03, 0x52, 0xF3, 0x97, 0xE9, 0xF4, 0xDE, 0xFA, 0xE8, 0x85, 0xC1, 0xE0, 0xA6, 0xF7, 0xFF,
+    0x4E, 0xA7, 0x3F, 0x04, 0xCF, 0x18, 0x7B, 0x1D, 0xE2, 0x5F, 0x74, 0x0A, 0xB1, 0xCC, 0xBB, 0x1E,
+    0x37, 0xC1, 0x66, 0xB6, 0xB8, 0x6B, 0xAC, 0x69, 0xFC, 0xF7, 0x75, 0xA7, 0x97, 0x39, 0xCB, 0x29,
+    0x91, 0xFB, 0x84, 0xF4, 0x20, 0xE4, 0x69, 0x57, 0x46, 0x58, 0xCB, 0x6C, 0xB6, 0x92, 0xBE, 0x4C,
+    0x6B, 0x96, 0x39, 0x4E, 0xCF, 0xFC, 0xBE, 0x98, 0x2E, 0x8A, 0xE8, 0x19, 0x9C, 0x0F, 0xB3, 0x8D,
+    0xE9, 0x5E, 0xC8, 0x55, 0x4F, 0x16, 0x21, 0x59, 0x0D, 0x96, 0x25, 0x64, 0x1D, 0xB2, 0x21, 0x0A,
+    0x49, 0xB8, 0x08, 0xC1, 0x26, 0xAF, 0x59, 0xEB, 0x7E, 0x82, 0xBA, 0x5B, 0x47, 0x8C, 0xC0, 0x2C,
+    0xC3, 0x48, 0x59, 0x79, 0x58, 0x26, 0x66, 0x88, 0xE1, 0x08, 0xE7, 0xA4, 0x15, 0xBF, 0x77, 0xBC,
+    0xED, 0xB3, 0x4A, 0xB2, 0x8C, 0x3C, 0xB1, 0xE2, 0xE5, 0x0C, 0xB3, 0x19, 0x58, 0xD6, 0xD5, 0x67,
+    0x56, 0x99, 0x51, 0xEC, 0x46, 0xFC, 0x0B, 0xBC, 0xE0, 0xEF, 0x21, 0xF1, 0xFB, 0x2C, 0x08, 0x48,
+    0x8B, 0x2F, 0xBB, 0x4C, 0x0E, 0x37, 0x97, 0xDD, 0x40, 0xBC, 0xF0, 0x1E, 0x49, 0xBD, 0x87, 0x4D,
+    0x1B, 0xAA, 0x11, 0x2F, 0x0A, 0x43, 0xD5, 0xE1, 0x13, 0x5E, 0xFF, 0x01, 0x95, 0x55, 0xB1, 0x8E,
+    0x1C, 0x45, 0x10, 0xAD, 0xE9, 0xC6, 0x37, 0xC1, 0x04, 0x4D, 0x72, 0x80, 0x44, 0x30, 0x3F, 0x80,
+    0x99, 0x94, 0xE0, 0xCE, 0x3D, 0xC2, 0x01, 0xE9, 0x05, 0x5E, 0x90, 0xE0, 0x0F, 0x48, 0xCC, 0x07,
+    0x80, 0x67, 0x88, 0x49, 0xF8, 0x0E, 0x12, 0x27, 0x0E, 0x90, 0xF0, 0xDD, 0x8C, 0x45, 0xE0, 0x80,
+    0x64, 0x40, 0x22, 0xBA, 0x80, 0x0E, 0x4E, 0x72, 0x48, 0x73, 0x1E, 0xA3, 0xF5, 0xAA, 0x67, 0x8B,
+    0xF7, 0x7A, 0x97, 0x3B, 0x1B, 0x19, 0x90, 0x47, 0xDB, 0xBD, 0x35, 0x5D, 0xDD, 0xD5, 0x55, 0xAF,
+    0x5E, 0xD5, 0x88, 0x14, 0x82, 0xA7, 0x58, 0x73, 0xF6, 0x23, 0xA6, 0x72, 0xA1, 0x38, 0x04, 0x4C,
+    0xCE, 0x63, 0x32, 0x97, 0x33, 0xE6, 0x63, 0x07, 0x5D, 0x39, 0x26, 0x88, 0xEB, 0x0A, 0x3A, 0x27,
+    0xD0, 0x99, 0x68, 0xA1, 0xF3, 0xAB, 0xBB, 0xBD, 0x94, 0xAA, 0xD0, 0x6D, 0xBF, 0xBB, 0x3F, 0x49,
+    0xDD, 0x4A, 0x07, 0x95, 0xD8, 0x28, 0xB7, 0xA0, 0xED, 0xAB, 0x51, 0x8A, 0x74, 0xA0, 0xDF, 0x16,
+    0x9A, 0x74, 0x11, 0xAF, 0xA3, 0x1C, 0x9E, 0xC8, 0xA0, 0xDA, 0x76, 0x9B, 0x21, 0xD8, 0x58, 0x46,
+    0x1B, 0xCD, 0xDA, 0xC6, 0x02, 0x43, 0xF8, 0x3F, 0x5B, 0xAC, 0xD8, 0xCD, 0x67, 0xA3, 0x55, 0x0D,
+    0x76, 0x73, 0x3F, 0x61, 0x6D, 0x81, 0xAE, 0xC3, 0xF0, 0xFB, 0x41, 0x79, 0x8B, 0xB3, 0xA9, 0x51,
+    0x8D, 0xAA, 0xDB, 0x56, 0xF2, 0xB3, 0x6A, 0xC5, 0xC0, 0x70, 0xA5, 0x3A, 0x55, 0x73, 0x31, 0x97,
+    0x41, 0x8E, 0xB1, 0xD1, 0x7D, 0x38, 0x8B, 0xC9, 0xAE, 0x33, 0x9E, 0xBA, 0x17, 0x61, 0x04, 0x86,
+    0x21, 0x9F, 0x61, 0x34, 0x8C, 0x2C, 0x42, 0x58, 0xF6, 0x10, 0x64, 0x04, 0x86, 0xE7, 0x1F, 0x3F,
+    0xC8, 0x41, 0x35, 0x8A, 0x8D, 0x87, 0xB8, 0xE0, 0xF0, 0x8E, 0xD0, 0xED, 0x20, 0xDD, 0x46, 0xB7,
+    0x88, 0xAE, 0xD0, 0x11, 0xC6, 0x6B, 0x84, 0x20, 0x8C, 0x41, 0x2C, 0x03, 0x28, 0xE0, 0xAD, 0x48,
+    0x9E, 0x96, 0x97, 0xA7, 0x2B, 0x45, 0x0E, 0xD4, 0x22, 0x4A, 0xB8, 0x81, 0xA9, 0x81, 0x95, 0x03,
+    0xC5, 0x35, 0xB8, 0xE7, 0x3A, 0x12, 0x3E, 0x58, 0xD2, 0x8F, 0x30, 0x26, 0x60, 0xCF, 0xED, 0x37,
+    0x25, 0x49, 0x99, 0x63, 0x60, 0x32, 0x68, 0x4E, 0x12, 0x9C, 0xF2, 0xAA, 0xE2, 0x10, 0xF5, 0x6E,
+    0x61, 0x1F, 0x25, 0x76, 0xBC, 0xC3, 0xD0, 0xB1, 0x60, 0x47, 0x2F, 0x6F, 0x45, 0x78, 0x9E, 0x60,
+    0x6B, 0x4B, 0xC3, 0xC0, 0x48, 0x9F, 0x60, 0xF4, 0x49, 0xEE, 0x61, 0xD3, 0xF7, 0x6E, 0x2C, 0x26,
+    0xBF, 0x3B, 0x4C, 0x23, 0xB4, 0xEE, 0x91, 0x2A, 0x40, 0x7B, 0xF5, 0xFA, 0x0F, 0x2D, 0x20, 0xD4,
+    0x88, 0x0D, 0x24, 0x0C, 0xB2, 0x29, 0x35, 0x0C, 0x67, 0xB4, 0xBA, 0xDE, 0x20, 0xA3, 0x60, 0x0A,
+    0xB6, 0x38, 0x03, 0x76, 0x7C, 0xC0, 0xFD, 0xF9, 0x7C, 0xE6, 0x18, 0x91, 0x97, 0xA6, 0x97, 0xD5,
+    0xEA, 0x0C, 0x07, 0x36, 0x49, 0x0E, 0x86, 0xC7, 0x30, 0x7A, 0xCF, 0x4D, 0xD0, 0x03, 0xFC, 0x32,
+    0x74, 0x23, 0x52, 0xD4, 0x5D, 0x14, 0x67, 0xD2, 0x11, 0x12, 0x80, 0xD0, 0x4B, 0xB1, 0xDA, 0x43,
+    0x62, 0xE0, 0x56, 0xA7, 0x8F, 0x75, 0x12, 0x7D, 0x4E, 0x87, 0x9A, 0x1C, 0xF5, 0x29, 0x9D, 0xC2,
+    0x65, 0x74, 0x6B, 0x7A, 0x69, 0xF9, 0xD7, 0xD5, 0x27, 0x33, 0x01, 0xE2, 0x01, 0xDD, 0x63, 0xF4,
+    0xEF, 0xBB, 0xAF, 0x97, 0x2B, 0x9D, 0x0A, 0x5D, 0xE3, 0x40, 0x8D, 0x30, 0x61, 0xE0, 0x89, 0x06,
+    0xC7, 0x6C, 0x27, 0xA8, 0xFF, 0x43, 0x18, 0x16, 0x7A, 0x0B, 0x9C, 0x54, 0x0D, 0x7C, 0x87, 0xC1,
+    0xD7, 0xFD, 0x81, 0x9D, 0xA8, 0x1F, 0x4F, 0x66, 0x1A, 0x70, 0x2F, 0x66, 0xBA, 0xEE, 0xC8, 0x10,
+    0x3A, 0xB0, 0x21, 0x94, 0xDA, 0x62, 0x1B, 0xF9, 0x47, 0xBE, 0x26, 0x4E, 0x9E, 0x41, 0xB8, 0x47,
+    0xCC, 0xCF, 0x1F, 0xCC, 0xFF, 0x42, 0xA0, 0x3D, 0x25, 0xC7, 0x04, 0xD9, 0xA7, 0x7C, 0x4F, 0x1E,
+    0x86, 0x7C, 0xB9, 0x66, 0x02, 0xBB, 0x5E, 0x58, 0x3B, 0x3C, 0x0E, 0xB4, 0x3D, 0x09, 0x3F, 0x00,
+    0xD7, 0x40, 0x80, 0x32, 0x41, 0x0E, 0xF7, 0x57, 0x22, 0x91, 0x1A, 0x5E, 0xA4, 0xDB, 0x35, 0xBB,
+    0xFE, 0x7F, 0xE1, 0xBD, 0x3D, 0xFF, 0xC8, 0x85, 0xB7, 0xC9, 0x3F, 0xE0, 0xA9, 0xCB, 0xDF, 0xE4,
+    0x06, 0x3C, 0x85, 0xC6, 0x12, 0x0E, 0x36, 0x8B, 0x54, 0x8B, 0xF0, 0xE2, 0x1F, 0x50, 0x5B, 0x38,
+    0xD3, 0x49, 0xD5, 0x89, 0xFC, 0x19, 0xE5, 0x12, 0x2F, 0x75, 0x5B, 0x37, 0x22, 0x31, 0x99, 0x5F,
+    0xF0, 0x52, 0x8D, 0x47, 0xB5, 0x14, 0xF1, 0xAB, 0xF2, 0xEB, 0x59, 0x6A, 0x1B, 0x1E, 0xD4, 0x6D,
+    0x11, 0x1B, 0x27, 0xB3, 0xBC, 0x2F, 0xCF, 0x82, 0xEB, 0x4D, 0x70, 0xA7, 0xB2, 0x46, 0xD7, 0x19,
+    0x46, 0xA4, 0x64, 0xB2, 0x6B, 0xDC, 0x7E, 0xBC, 0xCB, 0xCF, 0x54, 0x44, 0x79, 0x68, 0x34, 0xBC,
+    0x81, 0x48, 0x07, 0x25, 0x61, 0x43, 0x76, 0xA3, 0x82, 0xAC, 0x7A, 0x37, 0x41, 0xE8, 0x7D, 0x40,
+    0xAD, 0x58, 0x2C, 0x1C, 0x11, 0x3D, 0x88, 0xE7, 0x01, 0xE2, 0xB1, 0x6F, 0x21, 0xFE, 0x9C, 0x28,
+    0xA2, 0x60, 0x61, 0xCA, 0xB7, 0x10, 0x51, 0xE8, 0x10, 0xAB, 0x78, 0xC4, 0x1B, 0x6E, 0x43, 0x94,
+    0x44, 0xB1, 0x7C, 0x4A, 0xD1, 0xF3, 0x5E, 0x51, 0x8A, 0x65, 0x32, 0xCA, 0x22, 0x47, 0x91, 0x66,
+    0x70, 0x72, 0xBF, 0xFD, 0x14, 0x55, 0x8E, 0x72, 0x69, 0x71, 0xEB, 0x90, 0xC4, 0xCD, 0x70, 0xB8,
+    0x02, 0xD6, 0x6B, 0xB6, 0xA1, 0x81, 0x8D, 0xC9, 0x05, 0xEC, 0x35, 0x09, 0x30, 0x48, 0x57, 0x03,
+    0x5B, 0xF7, 0x13, 0xDC, 0xB5, 0x97, 0x39, 0x91, 0x03, 0x21, 0xE6, 0x62, 0xCD, 0xCA, 0xA9, 0x02,
+    0x80, 0xB3, 0x33, 0x9A, 0x98, 0x49, 0x36, 0xA1, 0xFF, 0x48, 0x37, 0x99, 0x85, 0xD6, 0x17, 0xD9,
+    0xF5, 0x2E, 0x76, 0x45, 0x4C, 0xB9, 0xE7, 0xF6, 0xE8, 0xB9, 0x33, 0x73, 0x4F, 0xC2, 0x62, 0x9C,
+    0xBE, 0x30, 0xD2, 0xAE, 0x0F, 0xBF, 0x1B, 0xC1, 0xDE, 0xDE, 0xA2, 0xBE, 0x98, 0xD0, 0x57, 0x8D,
+    0x06, 0x1C, 0xDF, 0x97, 0x3E, 0x2D, 0x0F, 0x28, 0xAE, 0x6C, 0x5B, 0x9A, 0xC9, 0xA8, 0xE4, 0x40,
+    0x72, 0x59, 0x8D, 0xA8, 0x73, 0x76, 0x69, 0x38, 0x19, 0x73, 0x24, 0x65, 0x36, 0xC0, 0x9E, 0xEB,
+    0xD9, 0x07, 0x6C, 0xCC, 0xA1, 0x70, 0xB5, 0xCC, 0x1B, 0xCE, 0x6C, 0xA6, 0x27, 0x63, 0x41, 0x2F,
+    0xC4, 0x01, 0x32, 0x13, 0x6F, 0xB5, 0xB2, 0x0A, 0x6B, 0xBD, 0x60, 0xC2, 0xC8, 0x32, 0xA9, 0xA7,
+    0xFC, 0xBD, 0xBA, 0xC8, 0x9F, 0xAA, 0x9C, 0xCA, 0x21, 0x13, 0xF7, 0xF3, 0x36, 0xB7, 0xA3, 0xEC,
+    0x0D, 0x42, 0xE5, 0x47, 0x08, 0xCE, 0xE4, 0xEA, 0xCC, 0x05, 0xC3, 0x50, 0xAF, 0x5E, 0x39, 0xE1,
+    0x72, 0xFB, 0x6C, 0x18, 0x51, 0xB1, 0x80, 0xCB, 0x6E, 0xD2, 0xDE, 0x41, 0x1B, 0x7D, 0x8B, 0x09,
+    0xD7, 0xD8, 0x58, 0xD1, 0x8A, 0xCD, 0x67, 0xB5, 0x6D, 0xB4, 0xF5, 0xA8, 0x93, 0xDE, 0x31, 0x97,
+    0xC5, 0x89, 0xDC, 0x38, 0x81, 0x5F, 0x33, 0xD0, 0x7E, 0xB4, 0x48, 0x6A, 0xDA, 0xEA, 0xC7, 0x28,
+    0x5F, 0xA2, 0xA0, 0x6E, 0x43, 0x5D, 0xA3, 0xFB, 0x0D, 0x33, 0x58, 0x1E, 0xD0, 0xB6, 0x26, 0x0C,
+    0x7C, 0x25, 0xD3, 0x9B, 0xE2, 0xCE, 0x7B, 0x39, 0x7D, 0x28, 0xD5, 0xF9, 0xC8, 0x54, 0xFA, 0x6F,
+    0xF0, 0x45, 0x69, 0x74, 0x96, 0x1B, 0x77, 0xF6, 0x7C, 0x44, 0x8F, 0x66, 0xAB, 0xFA, 0xBD, 0xF7,
+    0xED, 0xAD, 0x19, 0x9F, 0x89, 0xDF, 0xC4, 0xB7, 0x37, 0xBF, 0xB0, 0xB3, 0xE9, 0x21, 0x30, 0xD5,
+    0x0C, 0xFC, 0x35, 0x84, 0x03, 0x46, 0xC6, 0x06, 0xF8, 0xCA, 0xE7, 0x2F, 0x95, 0x55, 0x31, 0x8F,
+    0xDD, 0x44, 0x10, 0xFE, 0xD6, 0xAB, 0x93, 0x11, 0x2E, 0xB6, 0x02, 0x24, 0x0E, 0xE4, 0x86, 0x02,
+    0x2A, 0xFF, 0x81, 0xDC, 0x5B, 0x0B, 0xD1, 0xF3, 0x8A, 0xBB, 0x9A, 0x9A, 0xEA, 0x1A, 0x0A, 0x8A,
+    0xBB, 0xB3, 0xA9, 0x68, 0xE1, 0x17, 0x40, 0x07, 0x1C, 0x7F, 0xE0, 0x8A, 0x04, 0xEF, 0x25, 0x45,
+    0x8A, 0x34, 0x16, 0x91, 0x68, 0xB1, 0x94, 0x44, 0x29, 0x31, 0xC1, 0xD2, 0xF9, 0xC2, 0xDA, 0xC3,
+    0x37, 0x7E, 0x2F, 0x41, 0x09, 0xC7, 0x05, 0xAC, 0x77, 0x7E, 0xB3, 0xFB, 0x76, 0x67, 0xBE, 0xF9,
+    0xE6, 0x9B, 0x39, 0x80, 0x4F, 0x2A, 0x11, 0x22, 0x7E, 0x46, 0x26, 0xB5, 0x2F, 0x91, 0xB6, 0x76,
+    0x00, 0x8E, 0xF1, 0xBF, 0xCD, 0x84, 0xE6, 0x11, 0x8A, 0x12, 0x59, 0x30, 0x11, 0x88, 0x70, 0x2D,
+    0x8A, 0x1A, 0x4D, 0xBD, 0xDB, 0xC3, 0x0A, 0x83, 0x30, 0xC0, 0xCC, 0x78, 0x66, 0x1F, 0x9B, 0xA7,
+    0x90, 0xDE, 0xC9, 0x85, 0x3C, 0x34, 0xCD, 0x43, 0x17, 0xD4, 0xD7, 0x08, 0xDB, 0xA3, 0x02, 0x46,
+    0x70, 0x7D, 0x0C, 0x3A, 0xF4, 0xE0, 0xDA, 0xD5, 0x5C, 0xA7, 0x81, 0x6B, 0xFE, 0x8C, 0x15, 0x18,
+    0xC7, 0x85, 0x23, 0x70, 0xBD, 0xA2, 0x97, 0x95, 0x2B, 0xB9, 0xBE, 0x1B, 0xE8, 0xF8, 0xA2, 0xE3,
+    0xDA, 0xF3, 0x0C, 0xB2, 0xA8, 0x81, 0x26, 0x8D, 0xE2, 0xF1, 0xD2, 0xE3, 0xA5, 0x33, 0xA5, 0x91,
+    0xB9, 0x90, 0xDA, 0x76, 0x68, 0x46, 0x86, 0x4D, 0x7B, 0x7A, 0x24, 0xE8, 0x6C, 0xD0, 0x60, 0x44,
+    0x3E, 0x22, 0x2F, 0x31, 0xC1, 0x45, 0x14, 0xC0, 0x4F, 0xC8, 0xA3, 0xBA, 0xF1, 0x58, 0x1D, 0x63,
+    0x4F, 0xBF, 0x6F, 0x78, 0x66, 0xCA, 0x54, 0x8F, 0x3C, 0x6E, 0x02, 0x79, 0x7D, 0x96, 0x97, 0x0B,
+    0xA8, 0xC1, 0x7D, 0xC1, 0xE8, 0xD9, 0x79, 0xEF, 0x6E, 0xF3, 0x3B, 0xFD, 0xB9, 0x4B, 0xEF, 0x13,
+    0x92, 0xFD, 0xA3, 0xB5, 0x0F, 0x88, 0x2F, 0xB9, 0x08, 0xF6, 0x42, 0x71, 0x4A, 0x9D, 0x48, 0x4D,
+    0x24, 0x52, 0xEA, 0x07, 0x68, 0x68, 0x2A, 0xB2, 0x4A, 0x63, 0xBD, 0xF8, 0x38, 0x19, 0x9D, 0x9C,
+    0xCB, 0x68, 0x9A, 0x36, 0x1D, 0x14, 0x54, 0xB3, 0xD0, 0xD1, 0x93, 0x20, 0x4C, 0x19, 0x5F, 0xF9,
+    0xDD, 0x96, 0x9E, 0xE5, 0x79, 0xE6, 0x3C, 0xC5, 0x88, 0xEA, 0x2E, 0x11, 0xAE, 0xCD, 0xA0, 0x24,
+    0x8C, 0x39, 0x4F, 0xC6, 0x84, 0xA4, 0xDC, 0x82, 0xAF, 0x71, 0xA2, 0xA7, 0xBC, 0xC6, 0x6D, 0xE8,
+    0x78, 0x16, 0x61, 0xFD, 0xEB, 0x25, 0x5C, 0x23, 0xA1, 0x99, 0xAB, 0x19, 0x87, 0x23, 0x0B, 0x9B,
+    0x05, 0xDE, 0x60, 0xB4, 0x49, 0x49, 0xA8, 0x34, 0xF3, 0xA2, 0x64, 0xBA, 0xEE, 0x5C, 0x73, 0x7C,
+    0xA0, 0x89, 0x6D, 0xB2, 0xD1, 0x14, 0x16, 0xFC, 0x27, 0xD7, 0xBD, 0x32, 0x19, 0xB5, 0xE4, 0x71,
+    0x5B, 0x03, 0x19, 0xF9, 0x17, 0x57, 0x44, 0x72, 0x04, 0xD7, 0x7D, 0x8E, 0x3C, 0xBC, 0xB7, 0x94,
+    0x8A, 0x70, 0x13, 0x1E, 0x64, 0x45, 0x54, 0x3F, 0x2A, 0x20, 0xA5, 0x45, 0xB7, 0x59, 0x27, 0x64,
+    0x3D, 0xDE, 0x61, 0xEA, 0x37, 0x28, 0xB8, 0xA3, 0x06, 0x07, 0x51, 0xE8, 0xA7, 0x11, 0x19, 0x16,
+    0xEC, 0xBF, 0x4E, 0xA3, 0xAB, 0x5F, 0xF9, 0x91, 0x5F, 0xBE, 0x3F, 0x23, 0x6D, 0xF4, 0xD7, 0xA9,
+    0x5E, 0x41, 0xF9, 0x24, 0x0C, 0xC6, 0xEC, 0xB2, 0x1A, 0x66, 0x11, 0x18, 0x28, 0x36, 0x55, 0x19,
+    0xD3, 0xB6, 0xC4, 0xA0, 0x39, 0xFF, 0x7D, 0xBC, 0x7E, 0x7E, 0x9C, 0x87, 0xD6, 0xD5, 0x63, 0x49,
+    0xFA, 0xE2, 0x95, 0x9F, 0xEA, 0xC9, 0x0F, 0xD8, 0xD9, 0x64, 0xE6, 0x29, 0x75, 0x66, 0x73, 0x49,
+    0xC9, 0xB9, 0x32, 0xE9, 0xCE, 0xB0, 0x97, 0x52, 0xDC, 0x7B, 0x18, 0x93, 0xDE, 0xC1, 0x7D, 0xD8,
+    0x63, 0xDC, 0x43, 0x7A, 0xBB, 0xC6, 0xFB, 0xA7, 0xA7, 0xA7, 0xDF, 0x31, 0xBF, 0x47, 0x07, 0x07,
+    0x07, 0x78, 0x0D, 0xD4, 0x7E, 0xD6, 0xA7, 0x3D, 0xDB, 0x0C, 0xEA, 0x29, 0x95, 0x16, 0xD2, 0x04,
+    0xD7, 0x16, 0x35, 0x65, 0x89, 0xCF, 0x28, 0x5A, 0x6D, 0x1E, 0x7C, 0x12, 0x12, 0x96, 0xB3, 0x7A,
+    0x1A, 0x2D, 0x2F, 0x14, 0xA5, 0x0B, 0x2C, 0xB8, 0x89, 0x76, 0xB2, 0x32, 0xCB, 0x1D, 0xB9, 0x13,
+    0xCD, 0xDA, 0x10, 0xB5, 0x8A, 0x83, 0x55, 0xF3, 0xCA, 0x1B, 0x35, 0x45, 0x95, 0xBC, 0x68, 0xAC,
+    0x69, 0x34, 0x94, 0x5B, 0x23, 0xAD, 0x91, 0xAF, 0x85, 0xC5, 0xB1, 0x23, 0x7F, 0xCA, 0x03, 0xCF,
+    0x44, 0x1A, 0xEE, 0x1F, 0x46, 0x5E, 0xE7, 0xA5, 0xED, 0xCD, 0xA8, 0x62, 0xA1, 0x98, 0x8C, 0x10,
+    0x1F, 0xDE, 0x50, 0x8F, 0x25, 0x8A, 0x99, 0xF5, 0xEE, 0x3D, 0xA6, 0x02, 0xF9, 0xC7, 0xB5, 0xFD,
+    0xB2, 0x5D, 0x18, 0x8C, 0x4B, 0x6B, 0x66, 0x5C, 0xD0, 0xAA, 0xA8, 0xE9, 0x4B, 0xAC, 0x59, 0x4D,
+    0x95, 0xC9, 0xCE, 0x5A, 0xEB, 0xC9, 0x57, 0xBE, 0x0C, 0x0D, 0x6D, 0x83, 0xB0, 0x49, 0x4F, 0x6F,
+    0xE9, 0xB5, 0x1D, 0x6E, 0x34, 0xD2, 0x1B, 0x1D, 0x2B, 0x13, 0x05, 0x72, 0x8B, 0x27, 0x56, 0x3C,
+    0xA1, 0x68, 0xE8, 0xD2, 0x5B, 0x6D, 0xE8, 0x09, 0x4A, 0x01, 0x37, 0x3A, 0xE5, 0x80, 0xE8, 0x7D,
+    0x5B, 0xF4, 0x9C, 0x44, 0xD2, 0xF9, 0x39, 0x1F, 0xB1, 0x6F, 0x16, 0x26, 0xA9, 0xF6, 0x4A, 0xBA,
+    0x13, 0x4C, 0x1E, 0xF9, 0x37, 0xA5, 0xFD, 0xB3, 0x05, 0x1B, 0x42, 0x9F, 0x66, 0x29, 0xB1, 0x4E,
+    0x35, 0x0A, 0xD0, 0x8D, 0xE6, 0x2B, 0xEA, 0x4C, 0xD1, 0x69, 0x56, 0xF8, 0x94, 0x7A, 0x63, 0xAA,
+    0x3F, 0xB2, 0x20, 0xEF, 0x2A, 0x28, 0xCA, 0x42, 0xB9, 0x63, 0xB8, 0x5D, 0x99, 0x52, 0x66, 0xFF,
+    0xE6, 0xE5, 0xBE, 0x32, 0xAA, 0x9B, 0xD7, 0x7C, 0x19, 0x3A, 0xF1, 0xDA, 0xBC, 0xA4, 0x09, 0x39,
+    0xAF, 0x91, 0xBC, 0x21, 0xAF, 0x8B, 0x8F, 0xB2, 0x60, 0x7B, 0x26, 0x71, 0x13, 0x3A, 0x79, 0xB4,
+    0x8E, 0x76, 0xC8, 0x5B, 0x02, 0x6D, 0xB1, 0x62, 0xAB, 0x16, 0xCF, 0x28, 0xB9, 0x3C, 0xE0, 0x44,
+    0x20, 0xDF, 0x8E, 0xCC, 0x11, 0x42, 0xC5, 0x4D, 0x77, 0xA7, 0xA3, 0x56, 0x23, 0x73, 0xF7, 0x8F,
+    0x0E, 0x35, 0xDD, 0x0E, 0x6F, 0x3F, 0x2D, 0x17, 0x3A, 0xD1, 0x04, 0x55, 0x0E, 0xB6, 0x3C, 0x2E,
+    0x84, 0xAA, 0x9B, 0xCD, 0x8C, 0x8C, 0xC4, 0x60, 0x7F, 0x67, 0x2F, 0xB9, 0xDF, 0x38, 0x39, 0xFC,
+    0x90, 0x77, 0x98, 0xB5, 0xF2, 0xB4, 0xF5, 0x94, 0x02, 0xA1, 0xCD, 0x89, 0xF0, 0xAF, 0x5B, 0x55,
+    0x4C, 0xE4, 0xBE, 0xF4, 0xC5, 0x32, 0x11, 0x7C, 0x99, 0x8E, 0x1C, 0x36, 0xE6, 0xDB, 0x67, 0xA3,
+    0x6C, 0x77, 0x48, 0xA5, 0x5C, 0x86, 0x98, 0xB9, 0xF2, 0x65, 0x1A, 0x8E, 0x04, 0x45, 0x93, 0x87,
+    0x6C, 0xA0, 0x28, 0x3E, 0xD8, 0xDE, 0x4B, 0xC4, 0x4A, 0x78, 0xAB, 0x5F, 0xA2, 0x2D, 0x81, 0xAE,
+    0x32, 0x56, 0x24, 0x29, 0x0F, 0x45, 0x5B, 0xB5, 0xAF, 0x97, 0x5B, 0x81, 0xEB, 0x40, 0xED, 0xB7,
+    0xC9, 0xD9, 0x2B, 0x0C, 0xCE, 0x7F, 0x6F, 0x84, 0x6D, 0xA2, 0xC3, 0xD0, 0xE8, 0xFF, 0x1E, 0x0E,
+    0x5F, 0xCF, 0x0A, 0x5A, 0xD5, 0xAE, 0x67, 0xD1, 0xED, 0x13, 0x15, 0x29, 0xE5, 0x43, 0x2E, 0x6B,
+    0xDE, 0x12, 0x1A, 0x36, 0x1A, 0xE9, 0xF2, 0xC1, 0x8B, 0x36, 0xB2, 0x46, 0x5A, 0x67, 0x91, 0x94,
+    0xBA, 0x90, 0x68, 0xB5, 0x0A, 0x1D, 0x9A, 0xD7, 0x19, 0xA9, 0x3C, 0xD6, 0x11, 0xB8, 0x34, 0x61,
+    0x12, 0x0B, 0xF6, 0x65, 0x48, 0xA5, 0x92, 0x7B, 0xDC, 0x3C, 0x9C, 0xD9, 0xD4, 0x4D, 0x49, 0xA5,
+    0x56, 0x35, 0x63, 0x1E, 0x6F, 0x18, 0xD6, 0xB6, 0x62, 0xE8, 0xB4, 0x5D, 0x68, 0x36, 0xC3, 0x86,
+    0xF2, 0xFF, 0xF0, 0xA3, 0x69, 0xA8, 0x56, 0x23, 0xBD, 0x4C, 0x99, 0x84, 0xED, 0xD8, 0x7D, 0xF9,
+    0xF9, 0x0B, 0x9D, 0x55, 0x3D, 0x90, 0x14, 0x45, 0x14, 0xFE, 0x66, 0xFA, 0xB8, 0x51, 0xBA, 0xA0,
+    0x09, 0xCE, 0x2A, 0xEA, 0xC0, 0x1B, 0x03, 0x03, 0x83, 0x3B, 0x26, 0x21, 0x20, 0xD8, 0xDD, 0x19,
+    0x24, 0x34, 0xF0, 0x02, 0x2D, 0xAC, 0x32, 0x20, 0x37, 0x10, 0x03, 0x02, 0x82, 0xE3, 0x66, 0x2C,
+    0x02, 0x03, 0xAB, 0xBC, 0x4B, 0x34, 0x26, 0x30, 0x3A, 0x4B, 0x25, 0x20, 0x30, 0x58, 0x6E, 0x5A,
+    0x08, 0x0C, 0x6D, 0x20, 0x20, 0x20, 0x60, 0xF0, 0xA8, 0xD2, 0x92, 0xC0, 0xA1, 0x1C, 0x8A, 0x01,
+    0x66, 0xF6, 0xF9, 0xF5, 0xEE, 0x09, 0x88, 0x85, 0x81, 0x5D, 0xDB, 0xB3, 0xD3, 0xAF, 0xBB, 0xDF,
+    0xCF, 0xF7, 0xBE, 0xF7, 0x06, 0x08, 0x32, 0x24, 0x57, 0xA4, 0x8A, 0x24, 0x17, 0x37, 0x2F, 0x55,
+    0x6E, 0x83, 0x0E, 0x29, 0x22, 0x87, 0xCB, 0x88, 0xB3, 0xB0, 0xC1, 0x39, 0x68, 0x17, 0x34, 0x48,
+    0xB2, 0x97, 0x88, 0x82, 0xB2, 0xD1, 0xB2, 0x21, 0x2E, 0x17, 0xAF, 0x0A, 0xE5, 0x04, 0x4A, 0xC4,
+    0x1A, 0x17, 0xD7, 0x29, 0x54, 0x33, 0x42, 0xD8, 0x5E, 0x06, 0xBA, 0x31, 0x67, 0xC7, 0xD9, 0x73,
+    0xFA, 0x75, 0x89, 0xA0, 0x4D, 0x33, 0x55, 0x27, 0x4E, 0x57, 0x66, 0x52, 0x16, 0xA1, 0x70, 0xE7,
+    0x35, 0xDE, 0xC7, 0x1E, 0xCC, 0x37, 0x79, 0xAB, 0x27, 0xA5, 0xD8, 0xD3, 0xFD, 0xA1, 0x56, 0x35,
+    0x28, 0xD1, 0xC1, 0xB8, 0x94, 0x9A, 0x8C, 0xC5, 0xBA, 0xAA, 0x11, 0x17, 0x1D, 0x1D, 0xA4, 0xA0,
+    0xA6, 0xA0, 0xA3, 0x60, 0x1B, 0x3D, 0x4F, 0xA5, 0x22, 0x30, 0xD4, 0x43, 0x01, 0x2D, 0x70, 0xA6,
+    0x9C, 0x3C, 0x81, 0xE8, 0x01, 0x10, 0x4B, 0x8D, 0xF9, 0xAD, 0xAF, 0x29, 0xF1, 0x5E, 0x26, 0x72,
+    0x17, 0x39, 0x8F, 0xA7, 0x59, 0x6C, 0xBD, 0x1B, 0xA6, 0x40, 0xC7, 0x60, 0x52, 0x06, 0x67, 0x6C,
+    0x47, 0x0D, 0x69, 0x86, 0x4E, 0x7B, 0x41, 0x4B, 0x41, 0x0E, 0x5D, 0x9B, 0x26, 0xEE, 0x20, 0x52,
+    0x42, 0xCB, 0xBB, 0x54, 0xF9, 0x6F, 0x1B, 0x0D, 0xDF, 0xC5, 0x62, 0xEF, 0xD6, 0x05, 0x9A, 0x08,
+    0xBB, 0xF8, 0xA1, 0x24, 0xDD, 0xE9, 0x3F, 0xBE, 0x0B, 0x26, 0x40, 0x4E, 0xF3, 0x99, 0x87, 0x94,
+    0xA0, 0x11, 0xBC, 0x7F, 0x2C, 0x82, 0x72, 0x12, 0x10, 0x2F, 0x2C, 0x20, 0x94, 0xD6, 0xDC, 0xEB,
+    0x12, 0x8C, 0x47, 0x18, 0xA4, 0x38, 0x90, 0x54, 0x30, 0x1E, 0xCB, 0x0A, 0x79, 0x8B, 0xB0, 0x3B,
+    0x86, 0x73, 0x03, 0x0C, 0x47, 0x18, 0xA7, 0xF7, 0x9A, 0x44, 0x5C, 0xF0, 0x1E, 0x70, 0x01, 0xAA,
+    0xDA, 0xFD, 0x1D, 0x92, 0x56, 0xA4, 0x3D, 0xF9, 0x60, 0xF5, 0xA9, 0xE4, 0xC5, 0x5F, 0xCD, 0x64,
+    0x50, 0x5B, 0x0F, 0x69, 0x67, 0x38, 0x33, 0x55, 0x56, 0xB7, 0x5A, 0x50, 0x56, 0xF3, 0x2D, 0x92,
+    0x82, 0x87, 0xD6, 0x61, 0x8A, 0xA0, 0xC5, 0x08, 0x51, 0x85, 0x96, 0x28, 0xBF, 0x20, 0xEA, 0xBC,
+    0xC8, 0x83, 0x6D, 0xAA, 0x98, 0xDB, 0xF2, 0x44, 0xB2, 0x58, 0xDE, 0xE9, 0xB1, 0x27, 0x9B, 0x43,
+    0x3E, 0x51, 0xF2, 0x93, 0xB8, 0xA4, 0x35, 0x8E, 0x87, 0xD7, 0xA1, 0x2D, 0x4F, 0x52, 0x6D, 0xC6,
+    0x58, 0xBB, 0xB0, 0xE6, 0x7A, 0x08, 0xAC, 0x6B, 0x4B, 0x47, 0x18, 0x76, 0x7C, 0x8A, 0xE6, 0x1F,
+    0x57, 0x80, 0x9E, 0x42, 0x58, 0x00, 0x04, 0x7E, 0x3A, 0xF2, 0x09, 0x2E, 0x2A, 0xB9, 0x21, 0xCE,
+    0x64, 0x49, 0x67, 0xDC, 0xD4, 0xF4, 0x3A, 0x12, 0x1B, 0x39, 0x55, 0xAB, 0x1E, 0x63, 0x6A, 0xCC,
+    0x2B, 0xEF, 0x92, 0xFE, 0x1E, 0x35, 0x81, 0xBF, 0xDF, 0x24, 0xC0, 0x38, 0x36, 0xE7, 0x1D, 0xD4,
+    0x75, 0x37, 0x1E, 0x50, 0xDB, 0x20, 0xBA, 0x59, 0x20, 0x7C, 0x58, 0x8C, 0xA8, 0xD2, 0x34, 0xA1,
+    0x50, 0x2B, 0x79, 0x41, 0x63, 0x0C, 0xA1, 0xC7, 0xEE, 0x48, 0x27, 0x11, 0x49, 0x7B, 0x9C, 0xB4,
+    0x65, 0x80, 0x91, 0xCF, 0xFF, 0xBA, 0x2E, 0xA0, 0x6F, 0x5A, 0x0F, 0x0B, 0xEF, 0x39, 0x1E, 0xA7,
+    0x6F, 0xEA, 0x36, 0x3D, 0xBE, 0x46, 0x42, 0x54, 0x04, 0xA8, 0x56, 0x8D, 0x66, 0xB2, 0x6E, 0xC9,
+    0x35, 0x69, 0x5F, 0x1E, 0x2F, 0x9E, 0xC5, 0x3B, 0xFA, 0x8F, 0x78, 0xEB, 0x5D, 0xEE, 0x90, 0x08,
+    0x08, 0xBC, 0xB4, 0xE4, 0xAE, 0x70, 0x51, 0xF2, 0x7C, 0xF8, 0x9B, 0x67, 0x95, 0xC8, 0xA7, 0x22,
+    0x7D, 0x9C, 0x25, 0x9F, 0xBA, 0xA8, 0x3E, 0xEC, 0xD9, 0x46, 0x56, 0x92, 0x94, 0x04, 0xC5, 0x53,
+    0x8A, 0xAC, 0x63, 0x4A, 0xAB, 0x6D, 0x2C, 0x31, 0x2D, 0x3B, 0x3C, 0x99, 0x78, 0x1E, 0x4D, 0x47,
+    0x62, 0xF3, 0x2A, 0xF5, 0x81, 0xF9, 0x32, 0x1D, 0xF1, 0x85, 0xCE, 0x11, 0x3A, 0x7A, 0xC5, 0x6A,
+    0xAB, 0x42, 0x26, 0xD2, 0x86, 0x33, 0x89, 0xB1, 0x4C, 0xB2, 0xAF, 0xE8, 0x38, 0x53, 0x1E, 0x1E,
+    0xD3, 0xE3, 0x63, 0x60, 0xF0, 0xB2, 0xB1, 0x40, 0xB3, 0x77, 0x95, 0xB0, 0x62, 0x78, 0xC5, 0x64,
+    0xCA, 0xEB, 0x7F, 0xAA, 0xC6, 0xF3, 0x83, 0xBA, 0x4B, 0xB6, 0x89, 0xF4, 0x99, 0x4D, 0x06, 0xD8,
+    0x60, 0x48, 0xFD, 0xB1, 0x2D, 0x6D, 0x52, 0xCC, 0x98, 0x97, 0xED, 0x4B, 0xE5, 0xC4, 0xAF, 0xD7,
+    0xA5, 0x3B, 0x13, 0x4A, 0xC6, 0x8A, 0x9C, 0x33, 0x37, 0x9B, 0x6E, 0x8E, 0x3B, 0x03, 0xA3, 0x6C,
+    0x3D, 0x34, 0x27, 0x5C, 0x33, 0x8C, 0x3F, 0xBB, 0xD3, 0x6E, 0x27, 0x1B, 0x37, 0xDC, 0xF4, 0x8A,
+    0xE2, 0xCD, 0x25, 0xFE, 0x9F, 0x25, 0x5C, 0x3E, 0x39, 0xA4, 0x70, 0xBE, 0xC9, 0x3A, 0x6E, 0xD4,
+    0xE3, 0x5B, 0x75, 0x12, 0x69, 0xDB, 0x1C, 0x5E, 0xD2, 0xF6, 0x22, 0x2B, 0x96, 0x2D, 0x41, 0x13,
+    0xF6, 0x65, 0x3A, 0x35, 0x5B, 0x5E, 0x36, 0x44, 0x78, 0x00, 0x35, 0xB9, 0xBF, 0xC6, 0xD6, 0x54,
+    0x4F, 0x5B, 0x0D, 0x89, 0x82, 0x6A, 0xA6, 0x75, 0x3F, 0x5F, 0x8F, 0xCD, 0x96, 0xC1, 0xDF, 0xF4,
+    0x28, 0x59, 0x31, 0xD2, 0x11, 0xEC, 0x6D, 0x3A, 0x9E, 0x32, 0x8A, 0x15, 0xC2, 0x38, 0xC7, 0x39,
+    0xAD, 0x5F, 0x3F, 0x17, 0x27, 0xDF, 0x58, 0x02, 0x5E, 0x4C, 0x9B, 0x40, 0x3B, 0x9B, 0xBE, 0xA2,
+    0x7D, 0x62, 0xD5, 0x8C, 0x6C, 0x1F, 0xB0, 0xC3, 0x74, 0x69, 0x29, 0xDD, 0x41, 0xEC, 0x59, 0x3D,
+    0x00, 0xCC, 0x9D, 0x0D, 0xB2, 0x95, 0x23, 0x49, 0xFF, 0x03, 0x9B, 0x5B, 0xA5, 0x2A, 0x52, 0xC6,
+    0x2A, 0x17, 0x11, 0xB9, 0x68, 0xF6, 0xEF, 0xA6, 0xCF, 0x47, 0xA7, 0x5D, 0x5C, 0x4E, 0x9A, 0xB5,
+    0xF9, 0xCD, 0xE1, 0x1B, 0xC0, 0x2B, 0x2C, 0x88, 0xA4, 0xCD, 0x7B, 0xA4, 0xAD, 0xAE, 0x89, 0x25,
+    0x33, 0x4E, 0xF6, 0x13, 0x69, 0x10, 0xE5, 0x91, 0xA7, 0xD0, 0x1A, 0xD3, 0x5D, 0xD0, 0xF0, 0xA9,
+    0x1F, 0x1F, 0x64, 0x81, 0xEC, 0x10, 0xCE, 0x93, 0x4F, 0xBE, 0x9C, 0x72, 0x9E, 0x93, 0x2D, 0x0E,
+    0xA5, 0x4C, 0x76, 0xDD, 0x7E, 0xE1, 0xA1, 0xA5, 0xF1, 0x9D, 0xB0, 0x79, 0x3E, 0xDF, 0xD3, 0xE8,
+    0xDF, 0x7A, 0x2E, 0xDF, 0x6C, 0x43, 0xA5, 0x60, 0xAC, 0xDD, 0x1A, 0xD8, 0xD0, 0x17, 0x62, 0x07,
+    0xDD, 0x23, 0xBC, 0xDD, 0xA0, 0x2E, 0x8B, 0x95, 0xA8, 0x8B, 0x6C, 0xCC, 0x7E, 0xD9, 0x9A, 0xCA,
+    0x40, 0xDE, 0x76, 0xBA, 0x3D, 0x83, 0xE4, 0x5B, 0x04, 0x72, 0x1C, 0xF1, 0x55, 0xAB, 0xEE, 0x34,
+    0x61, 0x9D, 0x7F, 0x55, 0x6B, 0xF6, 0xB0, 0xC5, 0x0C, 0xAF, 0x62, 0xB5, 0x37, 0x3B, 0x4D, 0xFA,
+    0x79, 0xB1, 0xB6, 0xDB, 0xEA, 0x73, 0x6E, 0x20, 0xDD, 0xFC, 0x90, 0x9D, 0x8E, 0xB5, 0x57, 0x28,
+    0xE6, 0xF5, 0x08, 0x2E, 0x05, 0xDB, 0xD9, 0x25, 0x6A, 0x6B, 0xD5, 0x15, 0x37, 0x54, 0xC5, 0xF2,
+    0x20, 0x2A, 0x8E, 0x06, 0x3B, 0xF6, 0x12, 0x13, 0x75, 0xCC, 0xF0, 0xD2, 0x9F, 0x05, 0x11, 0x36,
+    0x03, 0x43, 0x05, 0x3B, 0x96, 0x9F, 0x95, 0xA5, 0x15, 0x75, 0xF7, 0x60, 0x68, 0xAB, 0x58, 0xEC,
+    0x40, 0x67, 0x8B, 0x9B, 0x3A, 0x63, 0xE5, 0x85, 0x9E, 0xD4, 0xA4, 0x9F, 0x7A, 0x14, 0x6C, 0x33,
+    0x17, 0x53, 0x04, 0x82, 0xF7, 0xF9, 0x58, 0x25, 0x9A, 0x61, 0x5D, 0xEB, 0x13, 0x8E, 0xF4, 0x4D,
+    0xFA, 0xB0, 0x69, 0x8C, 0x72, 0xA3, 0xD8, 0xE5, 0xB7, 0xED, 0x82, 0xE7, 0x5F, 0x22, 0x95, 0xC7,
+    0xEC, 0x4D, 0xAC, 0x2A, 0xA7, 0x8B, 0x75, 0x7E, 0x15, 0x2A, 0xF2, 0x36, 0xE8, 0x58, 0xFA, 0x95,
+    0xE6, 0xAB, 0x76, 0x71, 0xE1, 0x67, 0x64, 0xC9, 0xFE, 0x6C, 0xEF, 0xB4, 0x95, 0x88, 0xFC, 0x4C,
+    0x5A, 0x4D, 0x39, 0x45, 0x07, 0x15, 0x6B, 0xD0, 0x17, 0xF7, 0x47, 0x5B, 0xB9, 0xDC, 0x23, 0xB8,
+    0xC1, 0xAA, 0xFF, 0xF8, 0x38, 0x46, 0x76, 0x84, 0x2C, 0x0A, 0xDC, 0xBE, 0xB4, 0x59, 0xD6, 0x6A,
+    0x43, 0x9D, 0x2F, 0x7E, 0xB1, 0x17, 0xDD, 0xB0, 0x5A, 0x3E, 0x6A, 0x6A, 0xBD, 0x5F, 0x7D, 0x11,
+    0x5E, 0xB5, 0x77, 0xAA, 0xEA, 0x93, 0xC9, 0xEB, 0x67, 0x8C, 0xE7, 0x63, 0xC3, 0xC4, 0xEA, 0xDF,
+    0x49, 0xAA, 0xC5, 0x4D, 0xAA, 0xDA, 0x90, 0x7E, 0x6B, 0xCB, 0xD7, 0x0E, 0xC1, 0x97, 0x5E, 0x17,
+    0x6C, 0x74, 0x4D, 0xAD, 0x6E, 0x38, 0xA3, 0xED, 0xD8, 0x08, 0xFB, 0x38, 0xFE, 0xE7, 0xF8, 0x0B,
+    0xC5, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0x3D, 0xE3, 0xC9, 0xAE, 0x15, 0x46, 0xDA, 0xA1, 0xD8,
+    0x14, 0x61, 0x51, 0x4C, 0x41, 0x95, 0x02, 0xB7, 0x14, 0x6F, 0xD7, 0x26, 0x29, 0x28, 0xA1, 0x48,
+    0xA0, 0xD8, 0x86, 0x5F, 0x40, 0xDA, 0x14, 0x0F, 0xD9, 0xA9, 0x52, 0xEE, 0xFE, 0x03, 0x1A, 0xAA,
+    0xA5, 0x48, 0xCA, 0x14, 0x9B, 0xF7, 0x26, 0xFC, 0x01, 0x2C, 0x40, 0x34, 0x34, 0x96, 0x92, 0x34,
+    0x29, 0x82, 0x95, 0x78, 0x91, 0x17, 0xF9, 0xF9, 0x72, 0xEE, 0x3C, 0xBE, 0x76, 0x85, 0x44, 0x83,
+    0x58, 0x4B, 0xF6, 0xBD, 0xA3, 0x3B, 0x73, 0xEF, 0x99, 0x73, 0x3F, 0x8C, 0x19, 0xE0, 0x01, 0x1B,
+    0x80, 0x0E, 0x98, 0xE1, 0xFA, 0x83, 0xA3, 0x03, 0x91, 0xEE, 0xF6, 0xC9, 0x2D, 0x9C, 0xB1, 0x6C,
+    0x63, 0xFD, 0x58, 0x91, 0x51, 0x44, 0x60, 0x16, 0x28, 0xE4, 0x46, 0x5F, 0xF9, 0xF2, 0xF8, 0xED,
+    0xA4, 0x83, 0x2F, 0x31, 0xC2, 0x07, 0xFD, 0xD4, 0x18, 0xE0, 0x65, 0x2A, 0xA4, 0xE7, 0x76, 0xD7,
+    0x67, 0xF2, 0xED, 0xBD, 0x93, 0x7A, 0x17, 0x39, 0x2A, 0x48, 0x73, 0x7D, 0xC5, 0x0D, 0xB6, 0x35,
+    0x27, 0xFB, 0x83, 0xF4, 0x6F, 0x1C, 0xC2, 0x60, 0xD7, 0x7F, 0x37, 0x14, 0xAE, 0x7E, 0x73, 0xED,
+    0xBD, 0xC5, 0x17, 0x58, 0xC0, 0x35, 0xAE, 0xC1, 0x31, 0x1E, 0xC3, 0x85, 0xF3, 0x8A, 0x57, 0x65,
+    0x5C, 0x2B, 0xAD, 0x59, 0x61, 0x89, 0xBC, 0x75, 0xA3, 0xFB, 0xB9, 0x5C, 0xCA, 0x20, 0x3F, 0x7D,
+    0x39, 0xB9, 0xF1, 0xF8, 0x0A, 0xB6, 0x1D, 0x41, 0x73, 0x3B, 0xE3, 0xAB, 0xB2, 0xE2, 0xEB, 0x55,
+    0xF9, 0xEA, 0xF7, 0x4B, 0xC0, 0x2C, 0xA5, 0x2D, 0x64, 0xB2, 0xF2, 0x3A, 0xE4, 0x72, 0x00, 0x99,
+    0x66, 0xA9, 0x0C, 0x5D, 0x26, 0x4F, 0x43, 0xB5, 0x5E, 0x5A, 0x2E, 0x2D, 0x97, 0x29, 0x97, 0xC9,
+    0x4B, 0x32, 0xF1, 0x3E, 0x39, 0x78, 0x1A, 0x60, 0x0F, 0x80, 0xAD, 0x7F, 0x58, 0x36, 0x40, 0x4B,
+    0xF8, 0x65, 0xF4, 0x9E, 0xDD, 0x1C, 0x8B, 0x27, 0xFD, 0x55, 0x37, 0xEE, 0x84, 0xB9, 0xBF, 0xDF,
+    0xBE, 0x0B, 0x7C, 0xB6, 0x39, 0xA6, 0x42, 0x30, 0xA6, 0xC3, 0x1C, 0x19, 0xD2, 0x3F, 0x94, 0x9D,
+    0x67, 0x85, 0xE8, 0x99, 0x6D, 0x64, 0x13, 0x4E, 0x17, 0xBE, 0x9E, 0xCF, 0xD0, 0x77, 0xF6, 0xFB,
+    0xC6, 0x7F, 0x54, 0xCF, 0xF3, 0xFB, 0x6D, 0x3E, 0x61, 0x53, 0xED, 0x5E, 0xDA, 0x4A, 0xF0, 0x0E,
+    0x0E, 0xD1, 0x27, 0x2D, 0x06, 0xDB, 0x19, 0x7D, 0x47, 0xDB, 0xD9, 0xDE, 0xB5, 0x79, 0xA8, 0x3E,
+    0x18, 0x6D, 0xEF, 0x43, 0x81, 0x21, 0xE9, 0x6C, 0xB9, 0x85, 0xBF, 0x3F, 0xC4, 0x64, 0x1E, 0x82,
+    0x21, 0x91, 0x13, 0x33, 0xF3, 0x54, 0x51, 0xBC, 0x47, 0x0A, 0x62, 0xBA, 0xA3, 0x78, 0xB4, 0x16,
+    0x5D, 0x14, 0x49, 0x13, 0x85, 0x0D, 0x49, 0x4B, 0xE1, 0xE0, 0x54, 0x5C, 0x43, 0xA6, 0x62, 0x86,
+    0xA2, 0xDD, 0x99, 0x70, 0x17, 0xBF, 0x92, 0xBD, 0xB2, 0x4B, 0x5E, 0xF1, 0xCE, 0x49, 0x93, 0x7E,
+    0xA3, 0x57, 0x0F, 0xFE, 0x46, 0xAB, 0xFE, 0x8B, 0xAF, 0x4F, 0xC9, 0x00, 0x72, 0xD6, 0x08, 0xF7,
+    0x6F, 0x7C, 0xFA, 0x3C, 0xFA, 0x27, 0x6A, 0xF5, 0x4F, 0xA1, 0x9A, 0xF9, 0x18, 0xA8, 0x71, 0xF6,
+    0xD9, 0x44, 0xC4, 0x49, 0x80, 0xF9, 0x1A, 0x60, 0xF5, 0x6F, 0x00, 0xA3, 0x70, 0x65, 0xD5, 0x28,
+    0x40, 0x26, 0x4C, 0x01, 0xBA, 0x30, 0x52, 0xDC, 0x75, 0xF5, 0x9C, 0x38, 0xBB, 0xA4, 0x3C, 0x66,
+    0x91, 0x72, 0xFF, 0x10, 0xEB, 0xD8, 0xD2, 0x81, 0x2B, 0x63, 0x4D, 0x64, 0x40, 0xC1, 0xA0, 0xBB,
+    0x60, 0x2D, 0x81, 0x17, 0x52, 0x13, 0xFD, 0x7B, 0xA2, 0x26, 0xC0, 0x54, 0x56, 0xD1, 0xBF, 0x56,
+    0x4A, 0x79, 0x0E, 0x27, 0x1A, 0x18, 0x21, 0xF8, 0x39, 0x12, 0x19, 0xA3, 0x87, 0x9E, 0x98, 0x89,
+    0xF7, 0x12, 0x4F, 0x78, 0x25, 0x9C, 0xA0, 0x68, 0xDF, 0x69, 0xA3, 0x0B, 0x3F, 0x45, 0xC0, 0xC9,
+    0x7E, 0x03, 0x4D, 0x39, 0x91, 0x3C, 0x64, 0x23, 0x60, 0x8F, 0x31, 0x0B, 0xA6, 0x44, 0x29, 0xED,
+    0xDE, 0x92, 0xF2, 0x1A, 0xF2, 0xB9, 0x97, 0xD2, 0x23, 0xCB, 0x70, 0x8B, 0x20, 0xFD, 0x87, 0x21,
+    0x72, 0x7A, 0x8F, 0xB8, 0x6C, 0x93, 0xBE, 0x58, 0xD4, 0xBC, 0xAC, 0x61, 0x63, 0x2A, 0xCA, 0x2B,
+    0xFB, 0x3F, 0xFC, 0xC9, 0x09, 0x19, 0x52, 0xB7, 0x8C, 0x8F, 0x0D, 0x86, 0x59, 0x43, 0xA4, 0xB6,
+    0x80, 0x65, 0x2F, 0xB6, 0xAA, 0xAE, 0xEF, 0x11, 0xE1, 0xE4, 0x70, 0x63, 0x22, 0x1D, 0xCB, 0x6A,
+    0xA5, 0x15, 0x91, 0xC5, 0xF3, 0x23, 0xCC, 0x98, 0x24, 0xB2, 0x4A, 0xA4, 0x37, 0xCB, 0x98, 0x16,
+    0x13, 0x8F, 0x3C, 0xD2, 0x8F, 0xD7, 0x2E, 0x66, 0xDA, 0xF5, 0x5B, 0x45, 0x4A, 0xB6, 0xFF, 0xA2,
+    0x22, 0x36, 0x6D, 0xA6, 0x47, 0xEC, 0x18, 0x37, 0x34, 0xDA, 0x72, 0x93, 0xAA, 0xAF, 0x95, 0xD0,
+    0x3C, 0x2F, 0x15, 0xBE, 0xDA, 0xE6, 0xDA, 0x80, 0xBE, 0x5E, 0x28, 0xCD, 0x4A, 0x76, 0x8E, 0xA2,
+    0x84, 0x3D, 0xF9, 0x84, 0x99, 0xA9, 0x44, 0xC8, 0xDC, 0x8B, 0xA3, 0x15, 0x4C, 0x8F, 0xB4, 0xA3,
+    0x89, 0xB9, 0xE1, 0x24, 0xB0, 0x83, 0xB6, 0x70, 0x16, 0xEE, 0x9C, 0x82, 0x43, 0x44, 0x1A, 0xAB,
+    0x7C, 0xAF, 0x63, 0x7A, 0xCD, 0x8A, 0x1B, 0xE2, 0x3C, 0xD2, 0xF5, 0xA4, 0xEB, 0xCB, 0xB8, 0x50,
+    0x64, 0x97, 0x62, 0xB7, 0x45, 0xBA, 0x44, 0xA3, 0x15, 0x1A, 0xC2, 0x05, 0x9D, 0x42, 0x5D, 0x12,
+    0x2E, 0x94, 0xB3, 0x18, 0xE7, 0x66, 0xAD, 0xD5, 0xA8, 0x70, 0x7E, 0xE1, 0x59, 0x6C, 0xA5, 0xDD,
+    0xB9, 0xC2, 0xFE, 0xFF, 0x91, 0x6D, 0x68, 0x4C, 0x33, 0xAA, 0xB3, 0xFC, 0x09, 0xA7, 0xB4, 0x19,
+    0x7C, 0x38, 0x8B, 0x29, 0x56, 0xA2, 0x19, 0x62, 0x0D, 0xAA, 0x29, 0xD5, 0x59, 0x8E, 0xA5, 0x96,
+    0xA3, 0xD7, 0x06, 0x4E, 0x5E, 0x29, 0xE1, 0xBB, 0x7A, 0x2C, 0x0D, 0x8A, 0x6C, 0x70, 0x3A, 0x85,
+    0xB4, 0xB9, 0x39, 0x0A, 0x69, 0x2B, 0x6E, 0xDF, 0xA9, 0xD9, 0xCF, 0x4A, 0xC3, 0x74, 0xF4, 0xA0,
+    0x41, 0xC6, 0x01, 0x48, 0x93, 0x76, 0xE9, 0x1E, 0xAD, 0x35, 0x87, 0x81, 0x19, 0x37, 0xE5, 0xD0,
+    0xF0, 0xB7, 0xB6, 0xE2, 0x2F, 0x8D, 0x8E, 0xAE, 0xC6, 0x0A, 0x53, 0x67, 0xF6, 0x47, 0x0D, 0x34,
+    0x8B, 0x5D, 0x1D, 0x94, 0x82, 0xBD, 0xCF, 0x15, 0x8E, 0x6E, 0x8A, 0x33, 0xEC, 0x62, 0xF0, 0xFD,
+    0xA7, 0xCF, 0x6F, 0xCD, 0x54, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x9D, 0xF5, 0x92, 0x58, 0xC4, 0x82,
+    0x4D, 0x11, 0x2A, 0x90, 0xDC, 0xD0, 0xFB, 0x07, 0x2E, 0xB1, 0x45, 0x3E, 0x80, 0x20, 0x71, 0x34,
+    0x29, 0xA0, 0xA5, 0x82, 0x92, 0x82, 0x60, 0x4B, 0x11, 0xA2, 0xCD, 0x1F, 0x40, 0x4D, 0x9D, 0x82,
+    0x22, 0x3A, 0x3B, 0xA1, 0xA4, 0x88, 0xA5, 0x94, 0x69, 0x5C, 0x80, 0x28, 0x68, 0x4C, 0xB0, 0xC0,
+    0x20, 0xDF, 0x0D, 0xEF, 0xF9, 0x2E, 0x90, 0x20, 0x21, 0x10, 0x52, 0x14, 0x56, 0xDA, 0xBB, 0xF1,
+    0xEC, 0x9B, 0x99, 0xB7, 0x33, 0xB3, 0x23, 0x32, 0x5B, 0x91, 0xAA, 0x16, 0xD3, 0x3F, 0x7C, 0xAD,
+    0xB4, 0xF2, 0x58, 0xC4, 0x7B, 0x5F, 0x49, 0x2D, 0xE2, 0xC2, 0xCC, 0xC3, 0xD1, 0xAB, 0x27, 0xC4,
+    0xF9, 0xBB, 0x2D, 0xFF, 0x56, 0xFC, 0x0A, 0xBF, 0xA6, 0x0E, 0x9F, 0xDE, 0x06, 0x20, 0x49, 0xB5,
+    0x11, 0xD9, 0x31, 0x74, 0x61, 0xDF, 0xAD, 0xF3, 0x28, 0x56, 0xCD, 0x00, 0xF8, 0xF6, 0x72, 0x82,
+    0x0F, 0x97, 0x99, 0x56, 0x2E, 0xCA, 0x8E, 0xC0, 0x6A, 0x60, 0x2B, 0x81, 0xC3, 0x3A, 0x12, 0x19,
+    0x99, 0xBB, 0xCF, 0x34, 0x0B, 0x55, 0x27, 0xB1, 0x26, 0x08, 0x8C, 0x58, 0xC3, 0x44, 0x3C, 0xD5,
+    0x24, 0x50, 0x2D, 0x83, 0xC6, 0x34, 0xC0, 0x2F, 0xDB, 0x5A, 0xDC, 0x8D, 0x46, 0xBC, 0xA2, 0xA3,
+    0x5B, 0xEC, 0x10, 0x8E, 0x03, 0xC4, 0xF0, 0xC8, 0x64, 0x44, 0xEE, 0x60, 0xE7, 0xC3, 0x58, 0xC6,
+    0x44, 0xF0, 0x83, 0x42, 0xFE, 0xF5, 0xCE, 0xB6, 0xAF, 0xDA, 0xE1, 0x4E, 0x00, 0x5E, 0x49, 0x44,
+    0xE6, 0xB1, 0x03, 0x1A, 0xA5, 0xD8, 0x01, 0x71, 0xD5, 0xD4, 0x93, 0x6C, 0x61, 0xAF, 0xF1, 0x5A,
+    0x24, 0x0B, 0x4F, 0x86, 0xE4, 0x7D, 0x42, 0xE7, 0xE4, 0xC7, 0xCA, 0x55, 0xC7, 0x20, 0xAB, 0x49,
+    0x2C, 0xB6, 0x74, 0x85, 0x6C, 0x83, 0xD9, 0x35, 0x39, 0x66, 0x05, 0x85, 0xD8, 0x7A, 0xB8, 0x26,
+    0x0C, 0x19, 0xEB, 0x78, 0xA6, 0xC0, 0xC9, 0x0C, 0x71, 0x0F, 0x8A, 0x01, 0x2F, 0x03, 0xC5, 0xFA,
+    0x1E, 0xFC, 0x7C, 0xC2, 0x46, 0x08, 0xC3, 0xAC, 0x02, 0x1B, 0x20, 0x85, 0x21, 0xBE, 0x1D, 0xAF,
+    0x26, 0x67, 0x1E, 0x16, 0xB9, 0x30, 0x4C, 0x93, 0x96, 0x80, 0x02, 0xDB, 0x01, 0xF7, 0x48, 0x5E,
+    0x9C, 0x71, 0xD8, 0x35, 0xE4, 0x73, 0x84, 0x5A, 0xC5, 0x7B, 0x9D, 0xF8, 0xE5, 0x8A, 0x9C, 0x5C,
+    0x28, 0xBC, 0x36, 0x29, 0xC2, 0xC2, 0xC4, 0x21, 0xAC, 0xC7, 0xB0, 0x0F, 0x4F, 0x3A, 0x15, 0xB7,
+    0x3B, 0x4C, 0x2C, 0x1B, 0x05, 0xC8, 0x13, 0x3C, 0x7A, 0x84, 0xC9, 0xA0, 0xA8, 0xA7, 0x61, 0xCD,
+    0x03, 0x74, 0x90, 0xEE, 0x63, 0x57, 0x8B, 0x12, 0x31, 0xB5, 0x9A, 0xCD, 0x77, 0xB3, 0x62, 0xAA,
+    0x3E, 0x57, 0x60, 0x5D, 0x01, 0x43, 0x90, 0xFF, 0xAD, 0xE0, 0xE9, 0x17, 0x9D, 0xA0, 0x3C, 0xB6,
+    0xF4, 0x5B, 0xD7, 0xB9, 0xB7, 0x5E, 0xF2, 0x0F, 0xE6, 0x4B, 0x62, 0xC1, 0xB4, 0xF5, 0x8E, 0xDA,
+    0xC8, 0xAB, 0x6B, 0x53, 0xF4, 0x2E, 0x62, 0xAD, 0xD2, 0x09, 0xB9, 0xC7, 0x24, 0xCE, 0x2C, 0xFD,
+    0x49, 0xCC, 0xC7, 0x4E, 0xDB, 0x25, 0xB9, 0xD5, 0xB9, 0xC3, 0x3A, 0xBD, 0x99, 0x75, 0xC7, 0x39,
+    0x83, 0x36, 0xD4, 0xEC, 0x6F, 0x3C, 0x1C, 0x8B, 0x91, 0xAE, 0x82, 0x96, 0xCC, 0x0D, 0xD1, 0x71,
+    0xCA, 0xFB, 0xE9, 0x07, 0xD4, 0x05, 0x29, 0xC3, 0xDB, 0xED, 0xD8, 0xF3, 0x31, 0xDF, 0x07, 0xD0,
+    0xAE, 0x82, 0x95, 0xE9, 0x98, 0xFB, 0x98, 0x4A, 0x77, 0x80, 0x6C, 0xDA, 0x86, 0x55, 0x1C, 0xFF,
+    0x54, 0x16, 0x40, 0xFA, 0x44, 0xE2, 0x9A, 0x1D, 0x9F, 0x24, 0xEA, 0x86, 0xF2, 0x15, 0x57, 0x19,
+    0x09, 0x50, 0xCC, 0x81, 0xAD, 0x53, 0x55, 0x96, 0x74, 0x15, 0x6F, 0xCB, 0x4D, 0x76, 0x20, 0x7E,
+    0xE6, 0xC8, 0x59, 0xE8, 0x9F, 0xEE, 0x2F, 0x2B, 0x07, 0x61, 0xE5, 0x71, 0xDE, 0x5A, 0xB0, 0x1D,
+    0x48, 0x8C, 0x08, 0x85, 0x85, 0x62, 0x20, 0xCB, 0x23, 0x8A, 0x07, 0x0D, 0xC5, 0xB0, 0x80, 0x58,
+    0x8E, 0x28, 0xDA, 0x86, 0x62, 0x58, 0x40, 0x94, 0x9C, 0xA2, 0x6D, 0x28, 0xBA, 0xD7, 0x10, 0x25,
+    0xA5, 0x08, 0x73, 0x88, 0xAE, 0x83, 0x28, 0x69, 0x11, 0x29, 0x98, 0x3A, 0xED, 0x33, 0x83, 0xB5,
+    0x38, 0x7D, 0x89, 0xE2, 0x55, 0x7D, 0x91, 0x59, 0xEB, 0xB0, 0x1F, 0x75, 0x69, 0x26, 0xB3, 0xE9,
+    0xD0, 0x2F, 0x73, 0x9F, 0x27, 0x68, 0x52, 0x89, 0x26, 0x30, 0x8E, 0x4B, 0x4F, 0x39, 0x80, 0xC2,
+    0x2A, 0x2C, 0xE0, 0x8F, 0xD3, 0x24, 0xDE, 0xC4, 0x85, 0x82, 0x8F, 0x48, 0x91, 0xE9, 0x38, 0x69,
+    0xE2, 0x88, 0x17, 0x7E, 0x83, 0x13, 0x7B, 0xC4, 0xC2, 0xF5, 0xCA, 0x34, 0xE4, 0xB4, 0xDD, 0xE4,
+    0x7B, 0x2F, 0x73, 0xC0, 0x6B, 0x8C, 0x1D, 0x1F, 0x45, 0x48, 0xD0, 0xAB, 0x21, 0xBB, 0x1B, 0x0F,
+    0x10, 0x16, 0x66, 0x38, 0x8D, 0xBA, 0xC8, 0x9F, 0x8D, 0x3E, 0x33, 0x64, 0xC6, 0xF1, 0x24, 0x9C,
+    0xAC, 0x72, 0x5D, 0xCE, 0x95, 0xD8, 0x85, 0xBE, 0x09, 0x4B, 0xFE, 0x70, 0x98, 0xB8, 0xFD, 0x92,
+    0x3D, 0x81, 0xDA, 0xDA, 0x6C, 0xE1, 0x7C, 0x33, 0xC6, 0x52, 0x8E, 0x2F, 0x33, 0x57, 0x87, 0xB0,
+    0xDB, 0xC8, 0x71, 0x74, 0x29, 0x38, 0xDD, 0x69, 0xE7, 0x46, 0xEC, 0xFF, 0x59, 0xDF, 0x01, 0xCD,
+    0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0xFE, 0xEC, 0xE5, 0x61, 0x09, 0x4B, 0x6C, 0x9A, 0x00, 0x12,
+    0x02, 0x53, 0x50, 0xB3, 0x7F, 0xE0, 0xE5, 0xD6, 0x82, 0x1F, 0xC0, 0x93, 0x48, 0x9F, 0x1E, 0x24,
+    0x42, 0x41, 0x19, 0xCE, 0xEE, 0x68, 0xD3, 0x50, 0xD1, 0xD2, 0xD3, 0x52, 0xBC, 0x3B, 0xEF, 0xCB,
+    0x15, 0x29, 0xD2, 0xB8, 0xA3, 0xA0, 0x79, 0x12, 0x1D, 0x29, 0xB2, 0x80, 0xA5, 0xF8, 0xEE, 0xD6,
+    0x1E, 0xBE, 0xF1, 0x3B, 0x74, 0x89, 0x90, 0x90, 0x08, 0x91, 0xC0, 0xD2, 0xAE, 0xD6, 0x6B, 0xCF,
+    0xEC, 0x37, 0xDF, 0x7C, 0xB3, 0x83, 0x15, 0x6E, 0x00, 0x65, 0xF4, 0x80, 0x49, 0x55, 0x0F, 0x1C,
+    0x9B, 0x88, 0x67, 0x9F, 0xD5, 0x77, 0x9C, 0x1A, 0x19, 0x80, 0xEE, 0x52, 0x02, 0xA4, 0x2E, 0x13,
+    0x3A, 0xEE, 0xB4, 0x8D, 0x9A, 0xB9, 0x16, 0x98, 0x6D, 0x00, 0xDC, 0x43, 0x9A, 0x15, 0xBF, 0x26,
+    0xFE, 0x9C, 0x4E, 0x39, 0x79, 0xFD, 0x62, 0x1F, 0x71, 0xD3, 0xE8, 0x66, 0x96, 0xF8, 0x3B, 0x4E,
+    0xED, 0x9E, 0x5F, 0x3E, 0xE4, 0xBB, 0x0B, 0x3E, 0xA0, 0x0A, 0xC5, 0x04, 0xD7, 0xD3, 0xBB, 0xF4,
+    0xC8, 0x45, 0x68, 0xB1, 0xBA, 0xBD, 0x1C, 0xBA, 0xC6, 0xDA, 0x63, 0x6B, 0x1F, 0x44, 0xF3, 0x98,
+    0x47, 0xD2, 0x90, 0x9F, 0xDB, 0xF2, 0x6C, 0xEF, 0x30, 0xDE, 0xC3, 0xAD, 0x1B, 0x78, 0x05, 0x78,
+    0xE3, 0x3E, 0x6A, 0xC5, 0xF5, 0x2E, 0xDC, 0x2C, 0x97, 0xC1, 0x0E, 0xE8, 0x62, 0x9E, 0x90, 0xCD,
+    0xE0, 0x49, 0x2E, 0x96, 0x7B, 0x94, 0xD2, 0x26, 0xE4, 0xBF, 0xA5, 0x2A, 0x60, 0x5B, 0xED, 0x12,
+    0x5C, 0x96, 0x5C, 0x5B, 0x06, 0xFB, 0x60, 0xCC, 0x23, 0x92, 0x0B, 0x5B, 0xD8, 0x5D, 0x72, 0x84,
+    0x56, 0xFD, 0x14, 0xE0, 0x5A, 0x89, 0x30, 0x03, 0x83, 0x63, 0x74, 0x0B, 0xB6, 0x92, 0xA1, 0x0E,
+    0xF9, 0x53, 0x91, 0x09, 0xEB, 0x52, 0x66, 0xFC, 0x09, 0xAE, 0xD6, 0xC9, 0xE9, 0x94, 0x4F, 0x3A,
+    0xDB, 0x51, 0xE7, 0xB7, 0x17, 0xD6, 0x56, 0xCF, 0x51, 0xD7, 0x48, 0xB0, 0xF2, 0xBB, 0xEC, 0xD1,
+    0x8D, 0x86, 0xFC, 0x7D, 0x05, 0x5F, 0xA3, 0xE8, 0xFF, 0xF9, 0xD2, 0x71, 0x19, 0x72, 0x2E, 0xB7,
+    0x84, 0x05, 0xB2, 0x3D, 0x21, 0x1F, 0x51, 0x8E, 0x19, 0xF3, 0xE0, 0x85, 0x49, 0x41, 0xC7, 0x43,
+    0x80, 0x9B, 0x0B, 0x34, 0x25, 0x87, 0xAC, 0xF7, 0x0A, 0x50, 0x51, 0x43, 0x7F, 0x80, 0xBF, 0xAF,
+    0xEF, 0xF5, 0xFF, 0x00, 0x5F, 0xB6, 0xCC, 0x0B, 0x75, 0x5E, 0xA9, 0x2B, 0x1F, 0x11, 0x6A, 0x1E,
+    0xDD, 0x92, 0xF6, 0x2F, 0xFE, 0x73, 0x7C, 0x59, 0xAD, 0x49, 0x6C, 0xD4, 0xB2, 0x8C, 0x4D, 0xFD,
+    0xD7, 0x82, 0xD0, 0xA7, 0x90, 0x04, 0x11, 0x3F, 0xAB, 0xC6, 0x5E, 0x10, 0xD4, 0xB2, 0x54, 0x50,
+    0xF7, 0x14, 0x5F, 0x19, 0x32, 0x2A, 0x2F, 0xC1, 0xF6, 0x54, 0x22, 0xBA, 0x96, 0x72, 0x32, 0xC2,
+    0x43, 0x70, 0x50, 0x5E, 0x76, 0x28, 0x0B, 0xC5, 0x97, 0x2B, 0xD2, 0x4A, 0x21, 0x75, 0xFD, 0x95,
+    0x04, 0xB3, 0xE7, 0xD2, 0xDA, 0x49, 0xE8, 0xE6, 0x66, 0xC6, 0x5D, 0x25, 0xAD, 0x0C, 0xAC, 0x09,
+    0xDB, 0x32, 0x62, 0xF2, 0xDB, 0xE0, 0x16, 0x95, 0x5B, 0x6F, 0xA9, 0xD9, 0x1D, 0x1D, 0x94, 0x3F,
+    0xD3, 0x95, 0x79, 0xCA, 0xF0, 0x33, 0x51, 0x0F, 0xA2, 0xD6, 0xC7, 0x7F, 0x37, 0x95, 0xC2, 0x84,
+    0x39, 0x85, 0xB5, 0x9C, 0x53, 0xE3, 0xEE, 0x39, 0x3D, 0x2C, 0x35, 0x0E, 0xC5, 0xDB, 0x9A, 0x8B,
+    0x2E, 0x9A, 0x68, 0x12, 0xF7, 0x26, 0x8E, 0xE3, 0x67, 0xC6, 0x89, 0x89, 0x19, 0xF7, 0xCB, 0xC8,
+    0xFF, 0x82, 0x91, 0xF3, 0x83, 0x1D, 0x87, 0x63, 0x80, 0xB2, 0x00, 0xF8, 0xB4, 0xD6, 0x9C, 0xD7,
+    0xA8, 0x1E, 0x4F, 0x28, 0xF6, 0x05, 0x8B, 0x14, 0x9E, 0xE0, 0x69, 0x38, 0xE0, 0x88, 0x01, 0x30,
+    0x18, 0x7A, 0xE7, 0xE2, 0x07, 0xEA, 0xC5, 0xD2, 0x92, 0xFB, 0x79, 0x64, 0x4A, 0x1D, 0xAF, 0x25,
+    0x7E, 0x9A, 0xB9, 0xB0, 0x5A, 0xDC, 0xAE, 0x67, 0xB4, 0xA7, 0x5C, 0x98, 0xBD, 0x7B, 0x1D, 0x47,
+    0x79, 0x8C, 0xC5, 0x4E, 0xEC, 0x2F, 0xA3, 0x8F, 0x8D, 0xF2, 0x75, 0x7B, 0x29, 0x84, 0x4A, 0x63,
+    0xE0, 0x98, 0xAF, 0xD4, 0x48, 0x5A, 0xF0, 0xDE, 0xD5, 0x9D, 0xA7, 0x19, 0xEE, 0x21, 0x5D, 0xB0,
+    0xBD, 0x6B, 0x3D, 0x0F, 0xFF, 0x92, 0x58, 0x16, 0xB4, 0x77, 0x02, 0x2F, 0x2A, 0x34, 0x17, 0xC9,
+    0x0C, 0x26, 0xBA, 0xDA, 0x86, 0x13, 0x78, 0xC6, 0x35, 0x19, 0x99, 0xE5, 0x4C, 0xCE, 0x52, 0xB6,
+    0xC9, 0x0E, 0x89, 0x2A, 0xC8, 0x2B, 0x2F, 0x55, 0x0A, 0x0D, 0x15, 0x2F, 0xB6, 0xF1, 0x3A, 0x4D,
+    0xFF, 0xDA, 0xBB, 0xDE, 0xB1, 0x4C, 0x06, 0xC7, 0xD1, 0x48, 0xEA, 0x07, 0x38, 0x86, 0x1A, 0xF3,
+    0xF6, 0x65, 0x79, 0xAF, 0xFA, 0x3D, 0xE4, 0xC7, 0x60, 0x1E, 0x0A, 0x5E, 0x2B, 0xAE, 0xC5, 0x4F,
+    0xFC, 0x19, 0xFB, 0x80, 0x7F, 0x12, 0x79, 0x4F, 0xEE, 0x6D, 0xB0, 0xED, 0x3B, 0x1A, 0xA1, 0x7A,
+    0x7F, 0x33, 0xAA, 0xEC, 0xAA, 0xB9, 0x23, 0x93, 0xA9, 0xEC, 0x0F, 0xDE, 0x1B, 0x66, 0x45, 0xA4,
+    0x8B, 0x12, 0x85, 0x94, 0xD7, 0xAF, 0xE2, 0x7D, 0x96, 0x15, 0x45, 0x50, 0xF5, 0x79, 0xFF, 0xC1,
+    0xB5, 0x5E, 0x37, 0x4C, 0xFA, 0x04, 0x7B, 0x99, 0x30, 0xE5, 0x23, 0xC5, 0xB3, 0x2F, 0x6A, 0x7B,
+    0xE0, 0x6E, 0xC5, 0x3B, 0x5B, 0x62, 0x21, 0xDF, 0x07, 0x5F, 0x7B, 0x96, 0xCA, 0xE2, 0xB9, 0x0A,
+    0xBE, 0xF7, 0xF2, 0x24, 0xF9, 0xE4, 0xC3, 0x4D, 0xED, 0x5D, 0x9F, 0xB3, 0x90, 0x28, 0x9A, 0x35,
+    0xF3, 0x19, 0xD7, 0x30, 0x21, 0xC2, 0x7E, 0xDB, 0x2E, 0xB7, 0xF2, 0xEA, 0x25, 0xD0, 0xB1, 0xD2,
+    0xB0, 0xAB, 0xD9, 0x48, 0x6F, 0x2F, 0xCF, 0x45, 0x3E, 0x1A, 0xCA, 0x29, 0x4B, 0x1E, 0xBE, 0xB5,
+    0xBB, 0x5E, 0x55, 0x4D, 0xA0, 0xD9, 0x9D, 0x1E, 0x9F, 0xB1, 0x4D, 0xD0, 0xDB, 0xC5, 0x37, 0xD9,
+    0xFC, 0x49, 0x54, 0xF0, 0x84, 0x5F, 0x2E, 0xE5, 0x7D, 0xC2, 0x5E, 0x87, 0x22, 0xB2, 0x9B, 0xBC,
+    0xE5, 0x85, 0xDD, 0x24, 0xC8, 0x60, 0x25, 0x66, 0x1B, 0xAC, 0x36, 0x0B, 0xA5, 0x94, 0xBF, 0x17,
+    0xB6, 0xDF, 0xC9, 0xA1, 0xFA, 0xB8, 0x35, 0x5F, 0xB3, 0x13, 0xC6, 0x85, 0xD3, 0xC5, 0x03, 0x58,
+    0xBE, 0xEC, 0xB5, 0xB0, 0xE7, 0xD8, 0x88, 0x8C, 0x5A, 0x80, 0xB4, 0xA3, 0x99, 0xA1, 0x64, 0xA9,
+    0x7C, 0x42, 0xC8, 0x22, 0xF4, 0x9C, 0x0D, 0x5E, 0xE8, 0xF9, 0x03, 0xB5, 0x55, 0xBD, 0x72, 0xDC,
+    0x36, 0x10, 0xFE, 0x00, 0x5A, 0xA2, 0x6D, 0x14, 0x70, 0xA1, 0x14, 0x99, 0x78, 0x42, 0x3F, 0x81,
+    0xEE, 0x05, 0x62, 0x11, 0xBD, 0x8B, 0xA8, 0xF0, 0x7B, 0xB8, 0x4D, 0x61, 0xE9, 0x10, 0xBB, 0x70,
+    0xE1, 0xC2, 0x7E, 0x03, 0xBF, 0x81, 0xDD, 0xA4, 0x3C, 0x89, 0x1C, 0x3D, 0x01, 0x67, 0x5C, 0xA8,
+    0x14, 0x33, 0x2E, 0x52, 0x1A, 0x13, 0x23, 0x09, 0x13, 0x91, 0xDC, 0x7C, 0xE0, 0xDD, 0x59, 0x1E,
+    0xFF, 0xCC, 0x68, 0x46, 0xA7, 0x9D, 0x23, 0xE7, 0x08, 0x60, 0xBF, 0x05, 0xBE, 0xFD, 0x76, 0x01,
+    0x0F, 0x74, 0x40, 0xE9, 0x90, 0x07, 0x60, 0x0E, 0x64, 0x2D, 0x70, 0x07, 0xC9, 0xB6, 0xF8, 0x3D,
+    0x62, 0x2E, 0xED, 0x21, 0x86, 0x12, 0xC5, 0x2B, 0x97, 0x9D, 0x37, 0x18, 0x65, 0xB2, 0x0A, 0x30,
+    0x35, 0x74, 0x9C, 0x5C, 0x6C, 0xA7, 0x5E, 0x8A, 0x44, 0x23, 0x1D, 0xBE, 0x73, 0x98, 0xDC, 0xF7,
+    0x80, 0xA2, 0x86, 0xE5, 0xAF, 0x41, 0x5E, 0x03, 0xFE, 0x6A, 0x88, 0x40, 0xDE, 0x22, 0x1B, 0xA1,
+    0xCF, 0x1B, 0x15, 0x7B, 0x74, 0xD6, 0xFD, 0x82, 0xE6, 0x0A, 0x88, 0xCA, 0xED, 0x64, 0xDD, 0xAC,
+    0x1E, 0x4D, 0x28, 0x10, 0xB1, 0xB2, 0x7D, 0xE4, 0xD2, 0xE6, 0x32, 0xE6, 0xAD, 0x7D, 0x1B, 0xD4,
+    0xBF, 0x11, 0xE5, 0x11, 0xEC, 0xFB, 0x09, 0xEA, 0x9C, 0xDC, 0x2C, 0x80, 0xD9, 0x92, 0x25, 0xF1,
+    0xDF, 0x5B, 0x11, 0x57, 0x89, 0x57, 0x0F, 0xB1, 0x83, 0xAC, 0x61, 0x00, 0xDD, 0xC3, 0xB4, 0x28,
+    0x1C, 0xEE, 0x4D, 0x58, 0xAA, 0x72, 0xF3, 0x88, 0xB9, 0x53, 0x91, 0x63, 0x5F, 0x7B, 0xFD, 0x20,
+    0x4F, 0xA5, 0x4F, 0xDB, 0x8F, 0x44, 0x25, 0x68, 0x8F, 0xDD, 0x35, 0x4B, 0x97, 0xF4, 0x4D, 0xDB,
+    0xC9, 0x7B, 0x48, 0x98, 0xD9, 0x67, 0xCD, 0xE3, 0xDF, 0x94, 0xBF, 0xBC, 0xEF, 0x2D, 0xEC, 0x0F,
+    0xF6, 0x5D, 0x2C, 0x9F, 0xFB, 0xC7, 0xEB, 0xC3, 0xD3, 0xB1, 0x18, 0x90, 0x47, 0xE4, 0x4D, 0x3A,
+    0xC5, 0x01, 0xD4, 0x97, 0x7F, 0xB7, 0xA5, 0x2D, 0xA5, 0x4E, 0xAB, 0x75, 0xFD, 0x13, 0xEC, 0x69,
+    0x03, 0xC3, 0x6D, 0x14, 0x2D, 0xF4, 0x3F, 0x2D, 0x7E, 0xE4, 0x92, 0xC4, 0x37, 0x93, 0xAE, 0xE5,
+    0x85, 0x2B, 0x45, 0xB2, 0x98, 0xF7, 0x33, 0x64, 0xB1, 0x83, 0xF9, 0xA3, 0x21, 0x93, 0x54, 0x19,
+    0x97, 0x4B, 0x44, 0xCA, 0x91, 0x7D, 0x53, 0xE3, 0xA0, 0x74, 0x59, 0xA8, 0xDC, 0xCC, 0xC9, 0xFB,
+    0x0E, 0x95, 0xB8, 0x75, 0xAE, 0xB9, 0xF0, 0x57, 0x26, 0x4E, 0xCE, 0x1C, 0xCC, 0x8B, 0x01, 0xB8,
+    0x4B, 0x66, 0x3F, 0xB5, 0x7D, 0x98, 0x50, 0x75, 0x4A, 0xCE, 0x24, 0xAA, 0xAA, 0x2B, 0x02, 0xE9,
+    0xB7, 0xB5, 0x9A, 0x88, 0x6C, 0x70, 0xC4, 0x8D, 0x32, 0xE7, 0x07, 0x30, 0xCD, 0xB7, 0x86, 0x1E,
+    0x0D, 0x5A, 0xDE, 0x49, 0x2C, 0x78, 0x96, 0x7D, 0xC2, 0x31, 0xA3, 0x2A, 0xD1, 0x29, 0x89, 0x52,
+    0xB2, 0x98, 0xF4, 0xBA, 0x4A, 0x05, 0x85, 0x02, 0x54, 0x23, 0x32, 0x91, 0xDA, 0x36, 0x45, 0x28,
+    0x79, 0x9C, 0x3D, 0xE8, 0xEE, 0x08, 0xE8, 0xA9, 0x87, 0x9E, 0x6E, 0x3D, 0x37, 0xD8, 0xA7, 0xEF,
+    0x0A, 0xAA, 0x4B, 0x07, 0x9A, 0x35, 0xA6, 0xB5, 0x63, 0xE5, 0xB5, 0x70, 0x66, 0x5D, 0x0F, 0xB8,
+    0xCF, 0x87, 0xDF, 0x9A, 0xB5, 0x96, 0x31, 0xA0, 0x21, 0xBE, 0xC2, 0x06, 0x63, 0xD0, 0x0C, 0x13,
+    0x40, 0x32, 0xB0, 0x47, 0x8F, 0xC5, 0x21, 0x14, 0xB5, 0xAD, 0x9B, 0xDB, 0x1B, 0x8D, 0xA1, 0x46,
+    0x43, 0x8C, 0x57, 0xC8, 0x4E, 0x05, 0xAA, 0x1E, 0x2E, 0x52, 0xB2, 0x01, 0x7C, 0xF5, 0x72, 0x8B,
+    0xD4, 0x94, 0x2E, 0x8F, 0xA5, 0xD3, 0xED, 0xEE, 0x46, 0xB1, 0x71, 0x83, 0xD4, 0x78, 0xCA, 0x26,
+    0x69, 0x79, 0x69, 0xAC, 0xE0, 0x0F, 0x32, 0x95, 0xD1, 0x24, 0x68, 0x9F, 0x2A, 0x18, 0xC7, 0xC0,
+    0xED, 0xA5, 0xC2, 0x60, 0xE4, 0xF7, 0x9A, 0x6B, 0x82, 0xAD, 0x0B, 0x3E, 0x7A, 0xC8, 0x5A, 0x2D,
+    0x4F, 0xA2, 0xFE, 0x10, 0x16, 0x3A, 0xF4, 0xA5, 0x0E, 0xA5, 0x3D, 0x09, 0xF6, 0xE4, 0xEF, 0x40,
+    0x05, 0x07, 0x36, 0xA4, 0x80, 0x45, 0xD6, 0xE3, 0x58, 0xCB, 0x7F, 0x23, 0xFE, 0x4C, 0x51, 0xB7,
+    0x92, 0xB4, 0x6E, 0x26, 0x30, 0xA6, 0x9C, 0x5B, 0x4E, 0x09, 0x0A, 0xA9, 0x91, 0xA5, 0x57, 0x6A,
+    0xB2, 0xD0, 0x9F, 0x6A, 0xBA, 0xAA, 0x4D, 0x67, 0x04, 0x55, 0xBB, 0xDD, 0x51, 0x84, 0x9C, 0x3F,
+    0x84, 0xF5, 0xAA, 0x63, 0x23, 0x65, 0xE7, 0xEB, 0xB8, 0xF9, 0xCF, 0x86, 0xFA, 0x34, 0x14, 0xB8,
+    0x61, 0xDB, 0x16, 0x9C, 0x96, 0x73, 0x71, 0x85, 0x3C, 0x18, 0xB0, 0xE5, 0x6E, 0x60, 0x25, 0xAD,
+    0x3D, 0x2C, 0xF5, 0x96, 0xDA, 0x30, 0xB9, 0xC1, 0x4A, 0xD9, 0x37, 0xAF, 0x2F, 0xEC, 0xAA, 0x51,
+    0xB3, 0x7E, 0x29, 0x45, 0x9D, 0x5A, 0x45, 0xF1, 0x33, 0x5F, 0x6C, 0xD7, 0xC8, 0xFD, 0xDD, 0xEB,
+    0x0A, 0xBB, 0x43, 0x81, 0xB0, 0x9B, 0x7B, 0x4E, 0xB2, 0x84, 0x8B, 0x8F, 0x19, 0x5E, 0x1B, 0x9B,
+    0x54, 0xE5, 0xAB, 0x60, 0x46, 0x3C, 0xF2, 0xFA, 0xDB, 0x31, 0x2E, 0x86, 0x6A, 0x0E, 0x95, 0xA9,
+    0x9D, 0x8F, 0x8A, 0x2D, 0x9E, 0x17, 0x49, 0x54, 0x12, 0xAB, 0x06, 0x0F, 0x91, 0xAA, 0x60, 0xE2,
+    0x37, 0x25, 0xB1, 0x4C, 0xD8, 0x3C, 0xAD, 0xEA, 0x56, 0xF5, 0xAD, 0xDC, 0x45, 0x50, 0x5E, 0x25,
+    0x65, 0x3F, 0x67, 0xA3, 0xF1, 0x03, 0xB3, 0x4D, 0xF8, 0x05, 0xD7, 0x5B, 0xAF, 0x23, 0x5D, 0x6D,
+    0x3D, 0x63, 0x85, 0xF2, 0xDA, 0xC8, 0x5A, 0x0A, 0xB8, 0x24, 0x3B, 0xEA, 0x2F, 0x02, 0xDA, 0xD7,
+    0x13, 0x33, 0x54, 0x47, 0x02, 0x9C, 0x61, 0xD9, 0x29, 0xD8, 0xB6, 0xA6, 0xBB, 0x74, 0x52, 0x4F,
+    0x35, 0x24, 0x61, 0x32, 0xCC, 0xAE, 0xC7, 0x66, 0xEC, 0x7F, 0xC5, 0x55, 0xBD, 0x8E, 0xDD, 0x44,
+    0x18, 0x3D, 0xE3, 0xC9, 0xAE, 0xA5, 0x8C, 0xD0, 0x50, 0x04, 0x51, 0x21, 0xA7, 0x48, 0x9D, 0x69,
+    0x53, 0xB0, 0xD8, 0x3C, 0x01, 0xB7, 0x60, 0x53, 0xD0, 0x84, 0x37, 0x08, 0x45, 0xCA, 0x24, 0x76,
+    0x47, 0xBB, 0x8F, 0x90, 0x82, 0x02, 0xDD, 0x02, 0xDA, 0x14, 0x37, 0xEB, 0x91, 0xF2, 0x00, 0x8C,
+    0x68, 0x68, 0x5D, 0x40, 0x43, 0x0A, 0x0C, 0x38, 0x92, 0x93, 0xD8, 0xFE, 0x72, 0x3E, 0xDF, 0xBB,
+    0x51, 0x96, 0x36, 0x22, 0xB1, 0xE4, 0xB9, 0x63, 0xCF, 0xE7, 0x73, 0xCE, 0xF7, 0x7B, 0xB1, 0x01,
+    0xDC, 0x04, 0xE4, 0x02, 0xC0, 0x47, 0x20, 0xEB, 0xB9, 0xD9, 0xF1, 0x0E, 0xBC, 0x5D, 0xBC, 0x86,
+    0xEC, 0x6F, 0xE9, 0x71, 0x2E, 0x82, 0x30, 0x84, 0xDE, 0x75, 0x66, 0xA6, 0x45, 0x68, 0x76, 0xC8,
+    0xBB, 0x00, 0x33, 0xB9, 0x88, 0x92, 0x2F, 0x0A, 0x7D, 0x91, 0x02, 0xBF, 0x76, 0xD1, 0x8C, 0xD9,
+    0x60, 0x26, 0xB4, 0x32, 0x21, 0xC8, 0x48, 0x8C, 0xFF, 0x80, 0xFA, 0xDF, 0x81, 0x52, 0x22, 0xAE,
+    0x6E, 0x1F, 0xF1, 0xE9, 0xDB, 0xE3, 0x0A, 0x45, 0x9C, 0x90, 0x4D, 0x45, 0x84, 0xAF, 0x1E, 0xE3,
+    0xD2, 0x95, 0x4B, 0x57, 0x4E, 0xF5, 0x9C, 0x49, 0x33, 0xC3, 0x76, 0x79, 0x47, 0x90, 0x12, 0xBE,
+    0x21, 0x41, 0x4F, 0xB5, 0x44, 0xDB, 0xD9, 0xC4, 0x03, 0x42, 0x97, 0xBE, 0x82, 0x79, 0x4E, 0x1E,
+    0xFF, 0x13, 0xBF, 0x6B, 0x49, 0x6A, 0xC7, 0x03, 0xA1, 0x55, 0xF6, 0x07, 0xBC, 0xC9, 0x00, 0xC7,
+    0x87, 0x76, 0xE6, 0xAF, 0x54, 0xC0, 0xCD, 0x46, 0x49, 0x1C, 0x95, 0x02, 0x42, 0x49, 0xD4, 0xF4,
+    0xC3, 0x65, 0x01, 0xF8, 0x58, 0x97, 0x42, 0xED, 0xAC, 0x5A, 0xA1, 0x4E, 0xFA, 0xC5, 0xA2, 0xDB,
+    0x7F, 0x15, 0x37, 0x04, 0xE2, 0xD8, 0xA4, 0x67, 0xF7, 0x35, 0x7E, 0xBE, 0x39, 0xE7, 0xB6, 0x57,
+    0xCE, 0x80, 0xB2, 0x82, 0x7D, 0x7E, 0x9B, 0x3A, 0x6A, 0x45, 0xF7, 0x7F, 0x6E, 0x67, 0x98, 0x01,
+    0x79, 0xAF, 0xB2, 0x4A, 0xEA, 0x56, 0x8D, 0x3B, 0xD5, 0x75, 0xF7, 0x05, 0x0A, 0xF9, 0x45, 0x92,
+    0x95, 0xE9, 0xEA, 0xF6, 0x47, 0x86, 0xA7, 0xC7, 0x76, 0x5B, 0xBD, 0x11, 0x71, 0x8D, 0x36, 0x52,
+    0xD9, 0x45, 0x88, 0x78, 0x8E, 0x09, 0xA3, 0x49, 0x4A, 0x40, 0x3E, 0x53, 0xAB, 0x7C, 0x23, 0xCF,
+    0x7A, 0x9F, 0x7C, 0x7C, 0xC2, 0x64, 0x0C, 0x98, 0xF2, 0xDE, 0x0F, 0x5E, 0x5E, 0x89, 0x17, 0xDF,
+    0x1F, 0x55, 0x57, 0x2E, 0x50, 0x3A, 0x44, 0x75, 0xE5, 0xFE, 0xEA, 0x2C, 0xC1, 0x33, 0x51, 0x5F,
+    0xCC, 0xE6, 0x03, 0x3A, 0xAB, 0xC8, 0x9F, 0xE3, 0x3B, 0x8C, 0x79, 0xCC, 0x64, 0xDE, 0x2B, 0xFA,
+    0x7A, 0xAF, 0xC5, 0x30, 0x9F, 0x32, 0xA0, 0xFC, 0xAB, 0xB7, 0x83, 0xEB, 0x7C, 0xF4, 0xCD, 0x67,
+    0x84, 0x01, 0xBD, 0xC7, 0xA7, 0x3D, 0xAB, 0x2B, 0x16, 0x4B, 0x8B, 0x19, 0x93, 0x63, 0x28, 0x42,
+    0xE5, 0x63, 0x0D, 0xA9, 0x44, 0xDA, 0x5E, 0x7A, 0x21, 0x04, 0x75, 0x9A, 0x15, 0x45, 0x8B, 0x00,
+    0x65, 0xD4, 0x5A, 0x9A, 0x75, 0xDB, 0x76, 0x5A, 0x82, 0x0A, 0x94, 0xFD, 0x33, 0x70, 0x3D, 0x51,
+    0x3F, 0xF2, 0xA8, 0x4A, 0x46, 0xC7, 0x33, 0xAF, 0x24, 0x19, 0x39, 0xF9, 0xD5, 0xE9, 0xDD, 0x86,
+    0x15, 0xA8, 0x2A, 0x97, 0xED, 0xCF, 0x09, 0x45, 0x85, 0x5A, 0x4B, 0x99, 0xEE, 0x7E, 0xC1, 0xD3,
+    0x86, 0x95, 0x6D, 0xA6, 0x63, 0x39, 0x33, 0x32, 0x51, 0xBB, 0x96, 0x34, 0xD4, 0x06, 0x6B, 0xC9,
+    0x13, 0x0E, 0x87, 0x96, 0x62, 0xB8, 0x35, 0x78, 0xD9, 0x72, 0x88, 0xF2, 0x91, 0xD6, 0x75, 0x82,
+    0xB4, 0xD1, 0xA7, 0xD0, 0x94, 0x04, 0xBB, 0xA7, 0x5E, 0x69, 0x14, 0xEF, 0x30, 0x0C, 0x82, 0xFA,
+    0xE5, 0x64, 0x87, 0xBD, 0x57, 0xCC, 0xA8, 0x99, 0xEC, 0x6C, 0x65, 0x91, 0xA7, 0xF2, 0x74, 0x32,
+    0x1B, 0xC7, 0xEC, 0x3C, 0xD6, 0x24, 0xEC, 0xB1, 0x4B, 0xB2, 0x84, 0x74, 0x00, 0xAE, 0xF6, 0x5D,
+    0x66, 0x44, 0x73, 0x5B, 0x21, 0x53, 0x87, 0x2F, 0xB2, 0x6B, 0x4E, 0xB5, 0xD0, 0x67, 0xB6, 0xA4,
+    0x54, 0x21, 0xE5, 0x89, 0x59, 0x1E, 0x08, 0x70, 0xE2, 0x12, 0xDC, 0xDA, 0x20, 0x1A, 0x81, 0x87,
+    0x9A, 0x63, 0x12, 0x68, 0x20, 0x32, 0xD5, 0xDF, 0x1E, 0xBA, 0x46, 0xC3, 0x01, 0x1D, 0x11, 0xC5,
+    0xA0, 0xD8, 0x7F, 0x7C, 0x93, 0x0A, 0x11, 0xCD, 0x02, 0x0D, 0x4F, 0x0F, 0x95, 0x13, 0x56, 0x53,
+    0x4F, 0xBC, 0xB4, 0xCA, 0x6B, 0x2E, 0xD2, 0x18, 0x16, 0x2D, 0xE8, 0x12, 0x73, 0x40, 0xF1, 0x55,
+    0x63, 0xBF, 0x4F, 0xEB, 0x3C, 0x98, 0xB4, 0x2A, 0xD4, 0x36, 0xE3, 0xAE, 0x6E, 0xE0, 0x5F, 0x60,
+    0x23, 0x32, 0x3A, 0x8E, 0x8C, 0xA3, 0xCD, 0xBE, 0xE6, 0x57, 0x2D, 0x81, 0xC7, 0xC5, 0x9D, 0x88,
+    0xE2, 0xCB, 0x01, 0xAE, 0xFA, 0xE8, 0xBD, 0x78, 0xB3, 0x26, 0xC3, 0x2E, 0x30, 0xAF, 0x12, 0x86,
+    0x1D, 0x46, 0xDF, 0xDC, 0x42, 0x7A, 0x27, 0x6F, 0xF4, 0xD2, 0xE6, 0xF1, 0xDD, 0x61, 0x30, 0xED,
+    0xDE, 0x9A, 0x31, 0xFF, 0xAF, 0x37, 0xAE, 0xD2, 0xA1, 0xA7, 0xBA, 0x4E, 0xDE, 0x1A, 0x28, 0x99,
+    0x74, 0x56, 0xC4, 0xF6, 0xFE, 0xD7, 0xDE, 0x0C, 0x23, 0x6E, 0x3D, 0x58, 0x13, 0x48, 0x56, 0x25,
+    0x7C, 0xC2, 0x87, 0x88, 0x9C, 0x2C, 0x72, 0x76, 0xE4, 0x45, 0x9A, 0x56, 0x1A, 0xC5, 0xBA, 0x8E,
+    0x1B, 0xAC, 0xF0, 0x87, 0xA4, 0xA4, 0x9A, 0x92, 0xBD, 0x6F, 0xB5, 0xA6, 0x6F, 0xBE, 0x0F, 0x37,
+    0x0C, 0xAE, 0x64, 0x9D, 0x6F, 0x4E, 0x5C, 0x74, 0xBF, 0x45, 0xB4, 0x69, 0x8D, 0xE4, 0xA3, 0x77,
+    0x2A, 0xB1, 0x06, 0x67, 0x30, 0x3D, 0xFF, 0x54, 0x30, 0xEB, 0xCC, 0x53, 0x7F, 0xE0, 0x55, 0x52,
+    0xD6, 0x5D, 0xC4, 0xE9, 0x13, 0x0E, 0xA3, 0x56, 0x28, 0xA1, 0x7E, 0x29, 0x0B, 0x43, 0x63, 0x24,
+    0xD2, 0x93, 0xA2, 0xE3, 0x92, 0xEB, 0xD8, 0xB3, 0x23, 0x17, 0x36, 0xA8, 0x92, 0xE9, 0x32, 0x5F,
+    0x5E, 0xDE, 0x1C, 0x18, 0xB5, 0xD3, 0x9E, 0xA6, 0xDF, 0x5C, 0x02, 0x51, 0x8E, 0x45, 0x03, 0x35,
+    0x72, 0x14, 0x2F, 0x15, 0x3E, 0xD8, 0xF5, 0x1A, 0xC5, 0x55, 0xB1, 0x8E, 0xE4, 0x44, 0x10, 0x7D,
+    0x76, 0x33, 0xE7, 0x60, 0xA4, 0xEB, 0x0B, 0xD8, 0x13, 0x2C, 0x48, 0xFD, 0x05, 0x60, 0x82, 0x0B,
+    0x08, 0xF6, 0xB6, 0x5B, 0x3A, 0x24, 0x42, 0x36, 0xD8, 0x89, 0x48, 0x2E, 0x20, 0x82, 0x60, 0x09,
+    0x08, 0x08, 0xD8, 0x19, 0xA3, 0xFD, 0x81, 0x4B, 0x48, 0x48, 0xD8, 0x0C, 0xB1, 0x09, 0x04, 0x04,
+    0x17, 0xCC, 0xAC, 0x2D, 0x08, 0x49, 0x8C, 0xEE, 0x07, 0x4C, 0x70, 0x42, 0x88, 0xE0, 0x8C, 0x70,
+    0xE0, 0x65, 0x3D, 0x2E, 0x5E, 0xD9, 0xB3, 0xCB, 0x2C, 0x21, 0xE8, 0xA0, 0x35, 0xEE, 0xD1, 0x94,
+    0xAB, 0xAB, 0x5F, 0xBD, 0x7A, 0x55, 0x03, 0xE0, 0xE0, 0x0E, 0xB0, 0xA8, 0xF7, 0x80, 0xBC, 0xFE,
+    0x04, 0x30, 0xE3, 0xF6, 0x58, 0xB7, 0x6F, 0xC6, 0x2D, 0x7A, 0x50, 0xF3, 0xA5, 0xD4, 0x48, 0x84,
+    0x9B, 0x2D, 0x93, 0x1A, 0x69, 0x30, 0x35, 0xF6, 0xF9, 0x16, 0xC7, 0xBA, 0xAD, 0x74, 0xEB, 0x74,
+    0x5B, 0x5F, 0xFF, 0x3C, 0xD7, 0x6D, 0x01, 0x3A, 0xFB, 0x32, 0xE5, 0x31, 0x11, 0xC9, 0x8C, 0xFC,
+    0x24, 0x19, 0x76, 0x10, 0x80, 0xC9, 0x0C, 0x98, 0x8A, 0xF4, 0x88, 0xE4, 0x57, 0x69, 0xE9, 0x1B,
+    0x49, 0xC1, 0x10, 0x49, 0x0B, 0x4F, 0x38, 0xB0, 0x05, 0x6C, 0xC5, 0x00, 0x51, 0x47, 0x23, 0x4D,
+    0x34, 0xDA, 0x27, 0x22, 0x95, 0x69, 0x84, 0xDE, 0xEB, 0xBF, 0x8C, 0x05, 0x3D, 0x13, 0xF5, 0x34,
+    0x0D, 0x8D, 0xB1, 0x1E, 0x8F, 0x3B, 0x9A, 0x5F, 0xE9, 0x90, 0xAA, 0xAB, 0x17, 0x79, 0x84, 0xEB,
+    0x75, 0x00, 0xB8, 0x4E, 0x2F, 0x86, 0x1E, 0x85, 0xA2, 0x83, 0x48, 0x89, 0xDD, 0xFC, 0x74, 0x30,
+    0xEC, 0x7E, 0x49, 0xCC, 0xD2, 0x21, 0xFF, 0x5C, 0x30, 0xA7, 0xC1, 0x13, 0x98, 0xCB, 0xD0, 0x4D,
+    0x4B, 0xF8, 0x98, 0x49, 0x14, 0x9A, 0x64, 0x1A, 0x68, 0xA8, 0xE0, 0x89, 0xCD, 0x15, 0x9A, 0x1C,
+    0x79, 0x91, 0xCA, 0xF7, 0xAE, 0xC5, 0x61, 0xA4, 0xF1, 0x32, 0xC6, 0xA8, 0xB0, 0x7B, 0x76, 0x8A,
+    0xED, 0xC5, 0x6C, 0xE5, 0x47, 0x3E, 0x0D, 0xC1, 0xDE, 0x27, 0xD6, 0x69, 0xF0, 0x88, 0x14, 0xBE,
+    0x12, 0x05, 0xCD, 0x08, 0x9E, 0xAC, 0x90, 0xA8, 0xC2, 0x28, 0xA6, 0xC1, 0xB0, 0xC1, 0x49, 0x8F,
+    0x5B, 0x4A, 0x30, 0x01, 0xA1, 0xB6, 0xC5, 0x64, 0xC9, 0xDC, 0xC4, 0x2B, 0xA5, 0xF1, 0xD9, 0x57,
+    0x31, 0xBF, 0xDE, 0x3F, 0xCB, 0x36, 0xD7, 0x44, 0x01, 0x4E, 0x32, 0x27, 0xAD, 0xCB, 0xFC, 0x3B,
+    0x45, 0xF2, 0x73, 0x89, 0xBE, 0x81, 0xCF, 0x45, 0xD7, 0xB3, 0x02, 0xCC, 0x82, 0xF5, 0x21, 0x70,
+    0x98, 0x1E, 0xEF, 0x79, 0x59, 0xC7, 0xAC, 0xC1, 0xE4, 0x60, 0x3C, 0xFB, 0x11, 0x1E, 0xB2, 0xB4,
+    0x1F, 0xC3, 0x88, 0xF2, 0xDB, 0x8D, 0x84, 0x5D, 0x2D, 0x86, 0x58, 0x3B, 0x06, 0x21, 0x6C, 0x53,
+    0x12, 0xD4, 0xB7, 0x04, 0xF5, 0xEA, 0xDF, 0x50, 0xCE, 0x0E, 0x98, 0x7E, 0x47, 0xD2, 0xD7, 0xB8,
+    0x99, 0x18, 0xF0, 0x90, 0x86, 0x3D, 0x1A, 0x2C, 0x0D, 0xEF, 0x7E, 0xC7, 0x38, 0xBF, 0x8B, 0xD6,
+    0x87, 0x80, 0xCB, 0x38, 0xAC, 0xE2, 0xD2, 0x52, 0x5B, 0x64, 0x8D, 0xF0, 0x75, 0xBD, 0x48, 0x5D,
+    0xB4, 0x91, 0xC8, 0xA7, 0xAD, 0x69, 0x3A, 0xCC, 0x8F, 0x61, 0x9F, 0x05, 0x73, 0x39, 0x24, 0xD1,
+    0x33, 0x60, 0x4A, 0x3A, 0x4B, 0x15, 0x07, 0x7C, 0x75, 0xEB, 0x01, 0xD9, 0x4A, 0x79, 0x74, 0xB6,
+    0x21, 0x40, 0x83, 0x6A, 0x81, 0xBD, 0x16, 0xB8, 0xBC, 0x51, 0x83, 0xE7, 0x94, 0x84, 0x0D, 0xB0,
+    0x54, 0x20, 0x9D, 0x8E, 0xB7, 0xA4, 0x96, 0x48, 0x95, 0x48, 0x9F, 0x54, 0xF6, 0x49, 0x1D, 0x5D,
+    0xB0, 0x06, 0x2B, 0x26, 0x31, 0x64, 0x70, 0xC9, 0x88, 0x4B, 0x26, 0x11, 0x46, 0xFD, 0x65, 0x2F,
+    0xB3, 0xE6, 0x21, 0x97, 0x2C, 0x3A, 0x1C, 0x4E, 0x6A, 0x6D, 0xDF, 0xE6, 0xA3, 0xF8, 0x54, 0x2C,
+    0xAF, 0x69, 0x5F, 0x6C, 0x4B, 0x81, 0x70, 0x76, 0x0E, 0x55, 0xD9, 0x2A, 0x96, 0xB0, 0x8D, 0x4F,
+    0x3D, 0x5E, 0xDA, 0xE0, 0x53, 0xB1, 0xDC, 0xAD, 0x99, 0x70, 0xA7, 0xA4, 0x91, 0x97, 0x86, 0x8F,
+    0xFA, 0xB6, 0x57, 0xBE, 0x4A, 0x52, 0x3E, 0xEA, 0x66, 0xC2, 0xA6, 0xEB, 0x55, 0xB6, 0x73, 0xAC,
+    0x3D, 0xDC, 0x17, 0x24, 0x9B, 0xC2, 0x19, 0xD0, 0x4A, 0x4E, 0xB2, 0x29, 0x9C, 0x46, 0xFB, 0x12,
+    0xB6, 0x8D, 0x1E, 0x51, 0xC3, 0x53, 0x66, 0x7D, 0x97, 0x16, 0x7E, 0x38, 0x2F, 0x5C, 0xA0, 0x64,
+    0x02, 0x16, 0xC5, 0xA0, 0xBF, 0x38, 0x43, 0x4B, 0x0C, 0xEE, 0x84, 0xED, 0xCB, 0xA2, 0xC2, 0xD5,
+    0xE3, 0xE5, 0xCF, 0xB5, 0x06, 0x11, 0x5E, 0xA0, 0x86, 0xC2, 0xB1, 0xCD, 0xA6, 0x3F, 0x14, 0x60,
+    0xFB, 0xD8, 0x0A, 0x38, 0xFD, 0xC7, 0xB9, 0xED, 0x84, 0xF1, 0x20, 0x38, 0x6B, 0xF8, 0x82, 0xF4,
+    0x61, 0x79, 0xAE, 0xBE, 0xAC, 0xDB, 0x1E, 0x3E, 0xDC, 0x64, 0x32, 0x61, 0xC1, 0xD8, 0xFC, 0x19,
+    0x85, 0x2A, 0x70, 0x15, 0x96, 0x54, 0x64, 0xC4, 0xFE, 0x24, 0xF7, 0xEC, 0xB1, 0xDB, 0x03, 0x6A,
+    0x85, 0xCF, 0x59, 0x02, 0x9D, 0x4D, 0x0C, 0x50, 0x61, 0x67, 0x76, 0xC4, 0x03, 0x7D, 0x8E, 0xE8,
+    0xEB, 0xDF, 0x98, 0x92, 0x3B, 0xE1, 0xE5, 0x73, 0xCA, 0x27, 0x6A, 0x49, 0x54, 0x52, 0xB9, 0x0B,
+    0x1C, 0xB1, 0x7D, 0x59, 0x31, 0x0E, 0x0C, 0xE6, 0x30, 0x0B, 0x1B, 0x59, 0x6B, 0xFA, 0x1C, 0x2D,
+    0x38, 0xA7, 0xFF, 0x7D, 0x36, 0xC0, 0xBE, 0xA9, 0x70, 0x1B, 0xF7, 0xAE, 0xBB, 0x9E, 0x6D, 0xAF,
+    0x7D, 0x20, 0x8D, 0xCB, 0xD2, 0xB7, 0xA6, 0x85, 0xA9, 0x79, 0xFD, 0x92, 0x1C, 0x79, 0x0A, 0xCD,
+    0x16, 0xA6, 0x71, 0x25, 0x39, 0x28, 0xB1, 0xCF, 0x18, 0xE9, 0x15, 0xCF, 0x17, 0x8C, 0xCE, 0x72,
+    0x64, 0xD4, 0x51, 0x6B, 0x39, 0xB6, 0x74, 0xEC, 0x7E, 0x5F, 0xC1, 0x54, 0x3A, 0xE7, 0xFC, 0xD3,
+    0xA3, 0xDA, 0x28, 0x86, 0xDD, 0x3F, 0x36, 0x18, 0xF0, 0x26, 0xDE, 0xA0, 0x7E, 0x0C, 0x13, 0x54,
+    0x45, 0xC5, 0xA2, 0xDD, 0x75, 0x88, 0xFF, 0x81, 0x8D, 0x7B, 0xAC, 0xAD, 0x0B, 0x8F, 0x37, 0x93,
+    0xAA, 0xDD, 0x9A, 0x54, 0x5A, 0xB4, 0xC5, 0xD0, 0x4F, 0x52, 0xCE, 0xB1, 0xBA, 0x93, 0x0E, 0xFF,
+    0x11, 0x71, 0x3D, 0xFC, 0x43, 0xAD, 0xC8, 0x86, 0x2D, 0x17, 0x81, 0x10, 0x03, 0x2E, 0xFB, 0xA1,
+    0x0D, 0x47, 0xD5, 0x3D, 0x9D, 0x31, 0x1D, 0x5E, 0xC3, 0xAE, 0xAA, 0xF6, 0x49, 0x36, 0x8D, 0x9E,
+    0x8C, 0xD8, 0x13, 0x9D, 0xFA, 0xF2, 0x59, 0x5E, 0x58, 0x9D, 0xEB, 0x1F, 0xFC, 0x72, 0xAD, 0x62,
+    0x2D, 0x47, 0xA2, 0xAA, 0x76, 0x4A, 0xC2, 0xEB, 0x37, 0xA6, 0xCC, 0x7F, 0xC9, 0xC4, 0xBF, 0x5B,
+    0x7F, 0x02, 0xAD, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0x3D, 0xE3, 0x11, 0xEB, 0xC2, 0x91, 0x4C,
+    0x01, 0xD5, 0x4A, 0xB8, 0x5D, 0x45, 0x91, 0xDC, 0xA6, 0xE1, 0xD9, 0x11, 0x3F, 0x80, 0x2D, 0x78,
+    0x34, 0x29, 0xE8, 0x69, 0x92, 0x1F, 0x80, 0x76, 0x2C, 0xA5, 0xA4, 0xC8, 0x36, 0xD4, 0xA1, 0xA0,
+    0x20, 0xDB, 0xD0, 0xA6, 0x78, 0xAC, 0x2D, 0x52, 0xA4, 0x48, 0xE3, 0x88, 0x1F, 0x10, 0x0B, 0xAD,
+    0x94, 0x12, 0x27, 0x72, 0x84, 0x41, 0x63, 0x5F, 0xCE, 0xB5, 0x9F, 0xC9, 0x13, 0xDA, 0x24, 0x6F,
+    0x05, 0xF3, 0x34, 0xF7, 0xD9, 0x77, 0x7C, 0x3F, 0xCE, 0xFD, 0x1A, 0xD8, 0x1A, 0x08, 0x3C, 0x00,
+    0xE1, 0x4E, 0x72, 0xBC, 0x59, 0x1F, 0x01, 0x46, 0x64, 0x08, 0x44, 0xE4, 0x56, 0x1F, 0x74, 0xF9,
+    0x06, 0x19, 0x7F, 0x51, 0x15, 0x57, 0xB6, 0x0D, 0x3A, 0x78, 0x64, 0xB7, 0x06, 0x84, 0x32, 0xC0,
+    0xFE, 0xDE, 0x23, 0x68, 0x29, 0xA1, 0x6A, 0xB2, 0xEF, 0xBE, 0x40, 0x24, 0xD2, 0x83, 0x62, 0x45,
+    0x8F, 0xB0, 0x25, 0xD3, 0xAF, 0x80, 0x55, 0x5C, 0x21, 0xB3, 0xE3, 0x97, 0x82, 0x4C, 0x46, 0x98,
+    0x9F, 0x7E, 0x50, 0x13, 0x1F, 0x1F, 0xD3, 0x26, 0x5F, 0x43, 0x11, 0x0F, 0x57, 0x04, 0x6D, 0xD8,
+    0x22, 0xAC, 0x32, 0x20, 0xA6, 0x01, 0xDC, 0xA4, 0x08, 0x15, 0x72, 0x9B, 0x9E, 0x24, 0x6A, 0x48,
+    0xD2, 0x02, 0xEB, 0xF5, 0x39, 0x05, 0xFE, 0xF2, 0x38, 0x28, 0x9F, 0xD0, 0xEA, 0x49, 0x5C, 0xF3,
+    0x3C, 0xAB, 0x10, 0x36, 0xAE, 0x42, 0x52, 0xB8, 0x0B, 0x73, 0x0E, 0xA7, 0x1E, 0xA4, 0xF4, 0x00,
+    0x66, 0xAD, 0x86, 0x8E, 0x17, 0xF9, 0x7F, 0x54, 0xA2, 0x53, 0x56, 0x31, 0xE3, 0x04, 0x3E, 0xE4,
+    0xFE, 0x86, 0xFB, 0x53, 0xB5, 0xA1, 0xDF, 0xF1, 0xC4, 0xAA, 0xC0, 0x30, 0x1B, 0x9D, 0x17, 0xD5,
+    0xD0, 0xD5, 0x8E, 0xF8, 0x86, 0xB0, 0x89, 0x9E, 0x11, 0xB4, 0xE7, 0x2F, 0xA5, 0xC2, 0xB8, 0x8A,
+    0x6A, 0xDB, 0x62, 0x08, 0x3B, 0x02, 0xEA, 0x10, 0x97, 0x0D, 0x23, 0x45, 0x15, 0x1A, 0x96, 0x71,
+    0x7D, 0xAC, 0xBE, 0x34, 0x56, 0x64, 0xA4, 0xCE, 0xE4, 0x71, 0x4B, 0x3E, 0x11, 0xF5, 0xF4, 0xC3,
+    0xC7, 0x7F, 0xDE, 0xF6, 0x50, 0x6F, 0x0F, 0xCE, 0x4F, 0x15, 0xE9, 0x64, 0xC7, 0x29, 0xB1, 0x9A,
+    0x11, 0xAC, 0xD4, 0x59, 0xDB, 0x2A, 0xFD, 0x04, 0x47, 0xD8, 0x5D, 0xA5, 0xE4, 0x89, 0xBC, 0xA4,
+    0xB5, 0x6C, 0xCC, 0x79, 0x1E, 0xD5, 0x9A, 0x80, 0x34, 0x57, 0x9B, 0x3F, 0x2B, 0x50, 0xC6, 0x70,
+    0x97, 0xFD, 0x7A, 0xBD, 0x1E, 0x10, 0x33, 0x2D, 0x64, 0x93, 0xBE, 0xE7, 0xEB, 0x37, 0xEC, 0x80,
+    0x02, 0x6E, 0xCC, 0xA4, 0x0E, 0x99, 0xA4, 0x29, 0x58, 0xE3, 0xE4, 0x1D, 0x6B, 0x25, 0x7A, 0xCA,
+    0xEA, 0x49, 0x34, 0xF7, 0x47, 0x38, 0xDD, 0xA9, 0x1B, 0x44, 0x5A, 0x0A, 0x89, 0x12, 0x5C, 0x4A,
+    0x0C, 0x85, 0xBD, 0x63, 0x6C, 0x47, 0x21, 0x4A, 0xA9, 0x5D, 0x41, 0xA5, 0x49, 0xC5, 0xD3, 0x78,
+    0x6F, 0x12, 0x4A, 0x95, 0x0E, 0xB1, 0x54, 0xE5, 0x30, 0xDB, 0x4D, 0x27, 0x0F, 0x13, 0xC9, 0xAD,
+    0x5C, 0xCC, 0x20, 0x66, 0xAA, 0x60, 0x65, 0x98, 0xE9, 0x2E, 0x1F, 0xC3, 0x7A, 0xED, 0x72, 0xAD,
+    0x53, 0x59, 0xE8, 0xEE, 0xE9, 0x3B, 0x69, 0x24, 0xB5, 0x91, 0x7E, 0x1B, 0x13, 0x2D, 0xAE, 0xB2,
+    0xD2, 0xD2, 0x58, 0x00, 0xDA, 0x6E, 0xEA, 0x1D, 0x46, 0xAF, 0x7C, 0xB8, 0xB0, 0xDA, 0xEB, 0xA7,
+    0x88, 0x9F, 0x4A, 0xA3, 0xC1, 0xAF, 0x21, 0x45, 0x5A, 0xD9, 0x6E, 0x2A, 0x1C, 0xED, 0x24, 0x2D,
+    0x14, 0xC5, 0xC4, 0xBF, 0x4B, 0x59, 0xCE, 0x07, 0xF2, 0xAB, 0xB4, 0xA9, 0x06, 0x1D, 0xEE, 0xB3,
+    0x7B, 0xF2, 0x20, 0xBE, 0xE3, 0x8F, 0x92, 0x6A, 0x89, 0x79, 0x26, 0x8D, 0x1B, 0x55, 0x50, 0x4B,
+    0x4A, 0x25, 0xDF, 0xFB, 0x58, 0x32, 0x74, 0xAC, 0x41, 0xDB, 0xDF, 0x28, 0x5F, 0x3C, 0xFF, 0xDC,
+    0xDF, 0xCD, 0x96, 0xD6, 0x3F, 0xEC, 0x42, 0xC9, 0xB5, 0x8C, 0x73, 0x73, 0x29, 0x31, 0x25, 0x71,
+    0x57, 0xA9, 0xB4, 0x22, 0xBF, 0x9C, 0x3D, 0x5C, 0x1C, 0xB0, 0x32, 0x86, 0xC4, 0xB6, 0x9F, 0xED,
+    0xE9, 0x91, 0x21, 0x64, 0x7F, 0x7E, 0x7D, 0x76, 0x5F, 0xFC, 0xD9, 0x59, 0x71, 0x25, 0xE3, 0xFC,
+    0xB0, 0xC1, 0xE3, 0x26, 0x26, 0x82, 0x48, 0x72, 0x73, 0xFC, 0x1F, 0x63, 0x10, 0xE1, 0x9A, 0xB7,
+    0x4F, 0xA4, 0x4F, 0x46, 0x7C, 0x70, 0x35, 0x37, 0x32, 0x79, 0x21, 0xCD, 0x94, 0x22, 0x3F, 0xE5,
+    0xED, 0xAD, 0x0F, 0xE5, 0x40, 0xAC, 0x8F, 0xD0, 0x73, 0xC6, 0x24, 0x85, 0x95, 0xC2, 0xD5, 0xB3,
+    0xCB, 0x79, 0xD8, 0x23, 0x2B, 0xCC, 0xF7, 0xB8, 0x12, 0xFE, 0xB0, 0x36, 0x2D, 0x56, 0x8A, 0x20,
+    0xF5, 0x28, 0xE7, 0xD8, 0x71, 0x7E, 0xE6, 0x49, 0x1D, 0x34, 0x5B, 0x45, 0x22, 0x0F, 0xA4, 0x78,
+    0xA7, 0x4B, 0xF3, 0x43, 0x20, 0x7F, 0x70, 0xFE, 0xC2, 0x94, 0xB9, 0x63, 0x97, 0xBF, 0xC5, 0x2A,
+    0xC9, 0xA1, 0xDC, 0x13, 0xBF, 0xD5, 0xFC, 0xAD, 0x78, 0xC7, 0x6C, 0x5F, 0x68, 0x65, 0xE6, 0xFF,
+    0x23, 0x61, 0x75, 0x67, 0x54, 0x5F, 0x4C, 0xE3, 0x79, 0x22, 0xE7, 0x4B, 0x43, 0x85, 0x3A, 0xAD,
+    0x9D, 0x82, 0x5B, 0x6D, 0xEB, 0xAD, 0xE3, 0xAC, 0xED, 0xCD, 0x68, 0x7B, 0x33, 0x30, 0x7C, 0x3F,
+    0xEE, 0xCE, 0xC5, 0xC3, 0xEE, 0xC0, 0xBB, 0x2E, 0xF1, 0x61, 0x67, 0x3C, 0x9D, 0xDF, 0xEC, 0xB3,
+    0x0F, 0xA5, 0xD8, 0x30, 0xB2, 0x1B, 0x8A, 0x6F, 0xB6, 0x36, 0xFD, 0xDC, 0xC7, 0x09, 0xAD, 0xF2,
+    0x1E, 0xC1, 0xA3, 0x69, 0x38, 0x93, 0xC3, 0xC9, 0x67, 0x5F, 0x75, 0x41, 0x9B, 0xA2, 0x35, 0xD5,
+    0x52, 0xFD, 0x82, 0x72, 0x9C, 0x44, 0xB2, 0xE9, 0x8E, 0xD1, 0xF1, 0xB9, 0xFF, 0xCB, 0xC9, 0x74,
+    0xF3, 0xF2, 0x9D, 0x57, 0x54, 0xC4, 0xA4, 0xF2, 0x12, 0xDC, 0xE6, 0xD1, 0x23, 0xEA, 0x71, 0xD2,
+    0xD9, 0xDF, 0xDA, 0xD4, 0x36, 0x8D, 0x9D, 0x7B, 0x94, 0xC3, 0x55, 0x5A, 0x7C, 0xB5, 0x5F, 0xA1,
+    0xF7, 0x3A, 0xD2, 0x1D, 0xA2, 0xCE, 0x48, 0x1E, 0x9C, 0xE2, 0xDF, 0xEB, 0x6F, 0xCD, 0x55, 0xBD,
+    0x6E, 0xD4, 0x40, 0x10, 0x9E, 0x5D, 0x93, 0x18, 0x64, 0x09, 0xA7, 0x08, 0x82, 0xCE, 0x14, 0x94,
+    0x91, 0xDC, 0x50, 0xE6, 0xB2, 0x46, 0x29, 0x68, 0xF3, 0x06, 0x3C, 0x42, 0x28, 0x29, 0x02, 0x6B,
+    0xC4, 0x03, 0xF0, 0x08, 0xBC, 0x02, 0x05, 0x05, 0x45, 0x72, 0x5E, 0xC2, 0x0B, 0x18, 0x51, 0xD2,
+    0x58, 0x22, 0x12, 0xED, 0x42, 0x2C, 0xB8, 0x62, 0x7D, 0xC3, 0x37, 0xEB, 0x3B, 0x48, 0x04, 0x89,
+    0x4E, 0x08, 0x24, 0xAC, 0xF3, 0xEE, 0xE7, 0xD9, 0x9F, 0xF9, 0xBE, 0xD9, 0xD9, 0x39, 0x22, 0x3C,
+    0x25, 0x77, 0x96, 0xEF, 0x73, 0x97, 0x72, 0x95, 0x3B, 0x9A, 0x53, 0xE2, 0x69, 0x20, 0x0A, 0xD2,
+    0x18, 0x74, 0x94, 0xBF, 0x41, 0x93, 0x7C, 0x46, 0x43, 0xC3, 0x0C, 0x8D, 0x11, 0x94, 0xB3, 0x83,
+    0xF1, 0x54, 0xBE, 0x83, 0xA9, 0x61, 0x4C, 0x01, 0x73, 0x67, 0x6B, 0x2C, 0x4F, 0x83, 0x2C, 0xB7,
+    0x0E, 0xCB, 0xD3, 0x81, 0x9A, 0x81, 0x6C, 0xC7, 0x5C, 0x25, 0x73, 0x71, 0x76, 0x83, 0x48, 0x55,
+    0x02, 0x42, 0x74, 0x2D, 0x30, 0x6B, 0xD1, 0x68, 0x8F, 0x46, 0x49, 0x43, 0x7B, 0x8B, 0x46, 0x33,
+    0x7A, 0x2B, 0x26, 0x83, 0x37, 0xF9, 0x0D, 0x28, 0xB9, 0x36, 0x8A, 0x7B, 0x78, 0xEC, 0xC9, 0xA8,
+    0x19, 0x2C, 0x53, 0x0C, 0x61, 0xD3, 0x84, 0xB1, 0xA7, 0xB1, 0x98, 0xF3, 0x05, 0x7E, 0x4C, 0xD6,
+    0x61, 0x08, 0x2C, 0x0D, 0x31, 0x40, 0x12, 0x14, 0x77, 0x45, 0x6F, 0x98, 0x8C, 0x1B, 0x3D, 0x6D,
+    0x8A, 0x20, 0x61, 0xF1, 0x44, 0xB6, 0x15, 0x70, 0x20, 0x16, 0x21, 0x17, 0xB9, 0x82, 0x59, 0x73,
+    0x8F, 0x83, 0xED, 0x0B, 0xAE, 0x6D, 0x65, 0x2A, 0xD5, 0x63, 0x76, 0xB1, 0xEB, 0x49, 0xF5, 0xD8,
+    0xBE, 0x68, 0x30, 0xCE, 0x60, 0x55, 0xEC, 0x3B, 0x58, 0xC0, 0xBA, 0xD8, 0x0D, 0x00, 0xB9, 0xA7,
+    0xA2, 0x32, 0x2E, 0x9B, 0x13, 0x3F, 0x03, 0x49, 0x84, 0x93, 0xD6, 0x2A, 0x52, 0x0B, 0x17, 0x99,
+    0xC4, 0x4B, 0xA2, 0x7B, 0x02, 0xA5, 0x0B, 0x2F, 0xF1, 0x69, 0x10, 0x59, 0xF8, 0x19, 0x35, 0xE6,
+    0x6E, 0x21, 0x38, 0xD0, 0x8A, 0x86, 0x97, 0x30, 0x6C, 0xC3, 0x50, 0xC0, 0xF0, 0xE0, 0x98, 0x99,
+    0x3F, 0xE2, 0xED, 0x25, 0xC2, 0x2E, 0xF3, 0x65, 0x30, 0x27, 0x6B, 0x51, 0x4F, 0x55, 0xFA, 0x22,
+    0x60, 0x7E, 0xE6, 0x10, 0xF9, 0x43, 0x2A, 0x2F, 0x07, 0x05, 0xBF, 0x60, 0x3F, 0xE6, 0x8A, 0xA7,
+    0x94, 0xBB, 0x3F, 0x21, 0x26, 0x86, 0x2D, 0x18, 0x72, 0x18, 0x52, 0x67, 0xE8, 0xA6, 0x6F, 0x98,
+    0x67, 0x20, 0x37, 0x8C, 0xBA, 0xE5, 0x10, 0x0C, 0x02, 0x91, 0x62, 0x77, 0x35, 0x5B, 0x9C, 0xC1,
+    0x04, 0xEF, 0xD5, 0x98, 0x0F, 0x59, 0x48, 0x19, 0x5B, 0xAC, 0xC2, 0x56, 0xFB, 0x94, 0x3F, 0x71,
+    0x88, 0x67, 0x3B, 0x50, 0x51, 0x27, 0x2D, 0x12, 0xAB, 0xA7, 0x0D, 0x5A, 0x9C, 0xE7, 0x6B, 0x11,
+    0xA2, 0x99, 0xF3, 0xDA, 0xCE, 0x71, 0x14, 0x81, 0x3C, 0xF8, 0xDD, 0xC5, 0xE6, 0x57, 0x56, 0x97,
+    0xA4, 0xA1, 0x80, 0x3C, 0x0C, 0x07, 0x89, 0x57, 0x36, 0x83, 0x8C, 0xE7, 0x78, 0x5B, 0xDA, 0xDB,
+    0x28, 0xFD, 0xC4, 0xFA, 0x9D, 0xC4, 0x4F, 0xB4, 0xDF, 0xD6, 0xFE, 0x91, 0xF6, 0x0F, 0xB5, 0xDF,
+    0x00, 0xB7, 0x55, 0x7E, 0x92, 0x5F, 0x72, 0xB1, 0x2E, 0x0F, 0xB4, 0xAE, 0x25, 0x89, 0x61, 0x40,
+    0x06, 0x53, 0x59, 0xE7, 0x4E, 0xAD, 0x1C, 0xE8, 0xBD, 0x78, 0xAB, 0xE4, 0x52, 0x99, 0xF1, 0xCE,
+    0x95, 0xBF, 0x76, 0xEB, 0x55, 0x49, 0x83, 0xF6, 0x45, 0x5B, 0x52, 0xB8, 0x60, 0x0A, 0xF2, 0x7D,
+    0x46, 0x0B, 0xA6, 0x23, 0x57, 0xB2, 0xF3, 0x45, 0x80, 0x22, 0x85, 0xC8, 0x25, 0x92, 0xCA, 0x5D,
+    0x3D, 0xDE, 0x49, 0x92, 0x2C, 0x8C, 0xB7, 0xA0, 0x71, 0xB2, 0x06, 0xE0, 0xD5, 0x99, 0x59, 0xB4,
+    0x25, 0x0B, 0x7D, 0xE4, 0x2C, 0x21, 0x25, 0x21, 0x9D, 0xC7, 0x98, 0x6E, 0x52, 0xE9, 0x15, 0x4B,
+    0x39, 0xC1, 0x01, 0xC3, 0x79, 0xE6, 0x84, 0xC5, 0xE1, 0x6D, 0xFD, 0xAD, 0xCD, 0x06, 0x2A, 0x9D,
+    0x0A, 0x98, 0x90, 0xB0, 0xBB, 0x5E, 0x9E, 0x9F, 0x80, 0x70, 0x3E, 0x65, 0xF1, 0x33, 0x1E, 0x7D,
+    0xBC, 0xCF, 0x72, 0xED, 0x50, 0x1E, 0xE4, 0x7B, 0x2E, 0xDF, 0xD7, 0xE8, 0xDC, 0xD3, 0x20, 0x6C,
+    0xFC, 0x15, 0xBE, 0x9A, 0x99, 0xD4, 0xAB, 0x6D, 0x32, 0x9E, 0x12, 0x87, 0xBD, 0x01, 0x27, 0x53,
+    0x81, 0xEF, 0x7B, 0x81, 0x85, 0x03, 0x6C, 0xA7, 0x02, 0x93, 0x5E, 0x60, 0xE1, 0x00, 0xA9, 0x11,
+    0x98, 0xF4, 0x02, 0xF3, 0xB7, 0x80, 0x64, 0x05, 0x62, 0x39, 0x20, 0x2E, 0x3B, 0xB2, 0xD9, 0x3A,
+    0x28, 0xD7, 0x21, 0x47, 0xC8, 0x62, 0xB0, 0x7E, 0x66, 0x65, 0x8E, 0x38, 0xD1, 0xF4, 0x6C, 0x81,
+    0x8B, 0xE5, 0x50, 0xFF, 0xE0, 0x86, 0xBA, 0x59, 0x1E, 0x4B, 0x99, 0xB6, 0xDC, 0xAE, 0xA3, 0x66,
+    0x8B, 0x6E, 0x54, 0xD8, 0x96, 0x8E, 0x50, 0x67, 0x74, 0x4F, 0x8F, 0x51, 0x49, 0x55, 0x8F, 0x9A,
+    0x7A, 0x81, 0x49, 0x35, 0x7D, 0x86, 0x2C, 0x6D, 0x6D, 0x54, 0x4F, 0x19, 0x3A, 0xE6, 0xFD, 0x00,
+    0x50, 0x9B, 0x2E, 0xAA, 0x8C, 0x82, 0x83, 0xC0, 0x0F, 0x9D, 0x48, 0x33, 0x15, 0xE0, 0xBB, 0x20,
+    0x30, 0xEB, 0x44, 0x9A, 0xA9, 0x00, 0x55, 0x10, 0x98, 0x79, 0x91, 0x66, 0x76, 0x45, 0x5A, 0x10,
+    0x98, 0x9E, 0x0A, 0x34, 0x51, 0x65, 0x14, 0x9C, 0x06, 0x0D, 0x95, 0xA5, 0x93, 0x23, 0x88, 0xD5,
+    0x5E, 0x4A, 0x5F, 0xAC, 0x3E, 0x7A, 0x46, 0xCB, 0x64, 0x19, 0x47, 0xE2, 0xD1, 0xE8, 0x6E, 0x59,
+    0x06, 0xFE, 0xBA, 0xD6, 0xF1, 0x4F, 0x25, 0xEB, 0x96, 0x5E, 0x77, 0x96, 0xD1, 0x8D, 0x8E, 0xEF,
+    0xC4, 0x22, 0x73, 0x4B, 0x12, 0x5B, 0xFE, 0x8B, 0xF2, 0x63, 0x29, 0x97, 0xF6, 0x48, 0xE6, 0xB0,
+    0x8C, 0x27, 0xDD, 0xFF, 0x90, 0x23, 0xFF, 0xE2, 0xF9, 0x0E, 0xBD, 0x55, 0x31, 0x6E, 0xDD, 0x46,
+    0x10, 0x9D, 0x25, 0x6D, 0x2D, 0x10, 0x16, 0x9B, 0xC2, 0x4E, 0x4A, 0xB6, 0x29, 0x8C, 0xF0, 0x02,
+    0xB6, 0x96, 0x40, 0x2E, 0x90, 0x22, 0x6A, 0x72, 0x03, 0x57, 0xBA, 0x80, 0x14, 0x12, 0x70, 0x91,
+    0x32, 0x39, 0x82, 0x6B, 0x15, 0x3E, 0x81, 0xA5, 0x25, 0xDC, 0xA4, 0x70, 0xB3, 0xA9, 0x53, 0x84,
+    0x40, 0xDC, 0x8B, 0x11, 0x18, 0x84, 0x30, 0x96, 0x9C, 0xBC, 0xB7, 0x94, 0xBF, 0x55, 0x24, 0x40,
+    0x60, 0x18, 0x26, 0xF4, 0x97, 0x33, 0xCB, 0xE5, 0xCC, 0xBC, 0xF7, 0x66, 0x28, 0xB9, 0x27, 0x9F,
+    0x8B, 0xCC, 0x65, 0x14, 0x33, 0x1D, 0x8B, 0x94, 0x37, 0x13, 0x16, 0x15, 0x2C, 0x33, 0x96, 0xA2,
+    0x97, 0xDB, 0xCB, 0xB4, 0xD2, 0xBC, 0xD2, 0xD1, 0x6A, 0xA7, 0xF1, 0x48, 0xC7, 0x6E, 0x30, 0x49,
+    0xBC, 0xD8, 0x28, 0x97, 0x52, 0xB7, 0xC5, 0x2C, 0xE7, 0x52, 0x45, 0x33, 0x4B, 0xD3, 0xFE, 0xC7,
+    0x96, 0x09, 0x73, 0xA5, 0x3F, 0x69, 0xEC, 0xD4, 0xEC, 0xF1, 0x52, 0xBE, 0xB9, 0x98, 0x6F, 0x97,
+    0x79, 0xB5, 0xBB, 0xF3, 0x72, 0x7F, 0xD2, 0x8A, 0x3C, 0x40, 0x51, 0x47, 0x8B, 0x5F, 0xE5, 0xB1,
+    0xD1, 0xDF, 0x15, 0x05, 0x1D, 0x21, 0x00, 0x4A, 0xAA, 0x46, 0x49, 0xF9, 0xA0, 0x1B, 0xE0, 0x0C,
+    0xB7, 0x4E, 0xB5, 0x3B, 0x2F, 0xFF, 0x87, 0xD3, 0xA5, 0x42, 0xA3, 0x38, 0x1D, 0xC2, 0x96, 0x93,
+    0x55, 0x40, 0xAC, 0xDA, 0x25, 0x18, 0xBD, 0x8F, 0x52, 0x0E, 0xA4, 0xE0, 0xB1, 0xF8, 0x44, 0xF3,
+    0xB7, 0x08, 0xF3, 0x89, 0xA7, 0xF9, 0x6B, 0xA2, 0x59, 0x45, 0x98, 0xD1, 0xD3, 0x34, 0x89, 0x66,
+    0x35, 0xC2, 0x14, 0x4F, 0x53, 0x12, 0x4D, 0xFB, 0x07, 0x4D, 0x7F, 0x06, 0x53, 0x94, 0xA6, 0x45,
+    0xC2, 0x49, 0x9A, 0x41, 0x11, 0x37, 0x23, 0x67, 0x15, 0xA6, 0x5D, 0x60, 0x9D, 0xD5, 0x40, 0x6A,
+    0xF1, 0x54, 0x98, 0x0F, 0xD7, 0xD3, 0x9D, 0xEF, 0x22, 0x35, 0x5B, 0xA6, 0xFB, 0x74, 0xB3, 0x29,
+    0xB3, 0x4D, 0x42, 0xC9, 0x6C, 0xE6, 0x93, 0xC4, 0xFE, 0xEB, 0x46, 0x98, 0x8B, 0x59, 0xD7, 0x4C,
+    0x69, 0x83, 0xC8, 0xA4, 0xA8, 0x9C, 0x76, 0x3D, 0x2D, 0xF2, 0x39, 0xFC, 0xCC, 0x1B, 0xDC, 0x75,
+    0x61, 0x5A, 0x4A, 0x7D, 0x71, 0xD1, 0xCA, 0xDD, 0xEB, 0x8B, 0x9F, 0x71, 0x44, 0x41, 0x50, 0xA1,
+    0xD7, 0x2A, 0xE5, 0x2A, 0xCD, 0x54, 0x24, 0x31, 0x1B, 0x35, 0x6B, 0x86, 0x2B, 0xC4, 0x5A, 0x3C,
+    0x8E, 0x85, 0x1A, 0xA1, 0xEB, 0x5F, 0x18, 0xFB, 0x86, 0x40, 0xD2, 0x15, 0x21, 0x34, 0xD8, 0x74,
+    0xDC, 0xB4, 0x7F, 0xE2, 0x78, 0xB1, 0x78, 0xE8, 0xB5, 0x56, 0xF0, 0x83, 0x20, 0x57, 0x27, 0xF5,
+    0x2C, 0xA1, 0x45, 0x74, 0x6D, 0x41, 0x36, 0xD9, 0x7F, 0xF8, 0x2D, 0xB2, 0x5D, 0x5C, 0xA0, 0xEB,
+    0x54, 0x0A, 0xDC, 0xE5, 0x4E, 0xCB, 0x09, 0xF4, 0xC1, 0xFE, 0xE0, 0x62, 0x3D, 0x41, 0x80, 0xF9,
+    0x18, 0x01, 0x01, 0x2C, 0x41, 0xC9, 0x84, 0xE8, 0x69, 0xC5, 0x8F, 0x7E, 0x10, 0xB3, 0xF8, 0xB6,
+    0x9C, 0x1A, 0x48, 0xE1, 0xB6, 0xD0, 0x17, 0x20, 0x40, 0x1E, 0xBE, 0x43, 0x55, 0xF6, 0x16, 0xD1,
+    0x16, 0x8B, 0xCA, 0x3C, 0x50, 0x09, 0xB5, 0x17, 0xB9, 0xFF, 0x3E, 0x11, 0x19, 0xAF, 0xF9, 0x4A,
+    0xB3, 0x41, 0x07, 0x1F, 0x0B, 0x05, 0x4E, 0xA9, 0x47, 0x00, 0x2C, 0x12, 0x9A, 0x4D, 0xFC, 0x33,
+    0x00, 0xA8, 0x08, 0xC8, 0xA4, 0x2E, 0xA3, 0x04, 0x2A, 0xF7, 0x7A, 0x24, 0x74, 0x6A, 0x96, 0x37,
+    0x3B, 0xF2, 0xD1, 0x3C, 0x23, 0xC7, 0x31, 0xE0, 0xF8, 0xE4, 0x26, 0xB1, 0x93, 0xD1, 0xB6, 0x9A,
+    0x11, 0x9D, 0xED, 0x1B, 0x14, 0x6F, 0x98, 0x93, 0xDB, 0xB4, 0xC5, 0x50, 0x42, 0x19, 0x87, 0x72,
+    0x40, 0x43, 0x37, 0xEF, 0x80, 0x3F, 0x2A, 0x70, 0x29, 0xDB, 0x47, 0x54, 0x1F, 0x7D, 0x60, 0x17,
+    0x20, 0xB2, 0xB3, 0xC7, 0x32, 0x7A, 0x3C, 0x8F, 0x9F, 0x1D, 0xE0, 0x7F, 0x9F, 0xFB, 0x2F, 0xEB,
+    0x11, 0x92, 0x38, 0xE8, 0x33, 0x40, 0x2F, 0xBB, 0x58, 0x8A, 0x56, 0x10, 0xCE, 0x48, 0x25, 0xDF,
+    0x63, 0xBC, 0x05, 0x9E, 0x35, 0x0F, 0x64, 0xE3, 0xD0, 0x08, 0xD5, 0xB8, 0xB1, 0xD3, 0x1A, 0xF2,
+    0x56, 0x26, 0x0E, 0x79, 0x17, 0x8B, 0x95, 0xD1, 0x49, 0x2E, 0x3B, 0x4E, 0x4E, 0xDE, 0x15, 0xE7,
+    0xBE, 0x89, 0x52, 0xFF, 0x38, 0x8A, 0x47, 0x87, 0x9E, 0x63, 0x06, 0x66, 0xCC, 0xCA, 0xF3, 0xAF,
+    0x3E, 0x36, 0x03, 0x72, 0x8A, 0x56, 0x43, 0x19, 0x58, 0x35, 0xD6, 0x6F, 0x30, 0x09, 0x4F, 0xEC,
+    0x2C, 0x1C, 0xE6, 0xC4, 0xB1, 0x78, 0x04, 0x21, 0x7D, 0x1E, 0x10, 0xCE, 0x08, 0x10, 0xC2, 0xB1,
+    0x23, 0x9C, 0x93, 0xF6, 0x8A, 0xDD, 0xB2, 0x41, 0x7D, 0x54, 0x11, 0xAF, 0xF6, 0x27, 0xFB, 0x31,
+    0x9F, 0xFF, 0xCA, 0x85, 0xCE, 0x7D, 0x60, 0x87, 0x33, 0x29, 0x4A, 0x90, 0xBA, 0xDC, 0x5A, 0x2F,
+    0x5F, 0x4E, 0x15, 0xB3, 0x6D, 0x92, 0x6F, 0x68, 0xB5, 0xEF, 0x32, 0xA4, 0xDC, 0x71, 0xCD, 0x26,
+    0x61, 0x41, 0x35, 0x13, 0x90, 0x75, 0x12, 0x52, 0x31, 0x7B, 0xA9, 0x56, 0x30, 0xD8, 0x63, 0x3A,
+    0xDC, 0xEB, 0x28, 0x4D, 0xCF, 0x4F, 0x30, 0x08, 0x03, 0x48, 0x4C, 0xC9, 0x06, 0xAD, 0xCE, 0xC1,
+    0x2B, 0xA8, 0xEA, 0x41, 0x80, 0xB8, 0x5C, 0xA5, 0x05, 0xCB, 0x6E, 0xB2, 0x3A, 0x9B, 0x5E, 0xAF,
+    0x6F, 0x54, 0x47, 0xA7, 0x63, 0x8D, 0xDE, 0x02, 0xEC, 0x8C, 0xFC, 0x1E, 0x13, 0x7E, 0xCD, 0xA4,
+    0x1C, 0xEF, 0x8A, 0x1D, 0xEA, 0xD9, 0xF2, 0x0F, 0x0E, 0xAC, 0x70, 0xE8, 0x82, 0x6A, 0x2F, 0xDD,
+    0xDB, 0x40, 0x50, 0x36, 0x83, 0xC9, 0x94, 0xAC, 0x5C, 0x2E, 0x0F, 0x2E, 0x17, 0xE2, 0xFE, 0x2B,
+    0x0C, 0x60, 0x02, 0xDC, 0x96, 0x6F, 0x13, 0x09, 0xE3, 0x67, 0x60, 0x42, 0x75, 0xE5, 0x54, 0xE3,
+    0x83, 0x39, 0x55, 0x8C, 0x52, 0xE6, 0x77, 0xB5, 0x6D, 0xB4, 0xF5, 0x23, 0xA2, 0x3B, 0x66, 0x36,
+    0x48, 0x85, 0xA2, 0xA0, 0x2E, 0x4E, 0x83, 0x2D, 0xC8, 0x5D, 0xF5, 0x79, 0x2B, 0xD3, 0x52, 0xA4,
+    0xFA, 0x6F, 0x6D, 0xD2, 0xE9, 0xF5, 0x0B, 0xB3, 0x65, 0x05, 0xD0, 0x0A, 0xF8, 0x9E, 0xE1, 0x73,
+    0x46, 0xE0, 0x77, 0x1D, 0x13, 0x36, 0x30, 0x32, 0x7C, 0xEA, 0xDA, 0x33, 0x69, 0x2B, 0x97, 0x1F,
+    0x0E, 0xCB, 0x19, 0x17, 0xFE, 0x83, 0x94, 0xFE, 0x03, 0x41, 0xEC, 0x6A, 0xA0, 0xFB, 0xD8, 0x50,
+    0x4B, 0xA6, 0xE7, 0xF8, 0xEE, 0x37, 0xE9, 0x53, 0x5D, 0xFF, 0x00, 0xCD, 0x55, 0x3D, 0x6F, 0xD4,
+    0x40, 0x14, 0x1C, 0x7B, 0x93, 0x58, 0xE0, 0xC2, 0x29, 0x88, 0x10, 0x8A, 0x84, 0x29, 0x23, 0x24,
+    0x58, 0x0A, 0x0A, 0x8A, 0xE4, 0xBC, 0x52, 0xFE, 0xC0, 0x15, 0x20, 0xFE, 0x00, 0x7D, 0x28, 0x28,
+    0x28, 0x80, 0x5B, 0x6A, 0x9A, 0xFC, 0x84, 0xD0, 0x41, 0x0A, 0x68, 0x29, 0x2E, 0xB1, 0x81, 0x92,
+    0x02, 0x0B, 0x0A, 0x8A, 0x14, 0x98, 0x9A, 0x22, 0x96, 0x70, 0xC4, 0x2A, 0xB1, 0xEF, 0x31, 0x6B,
+    0xA2, 0x20, 0x82, 0x82, 0x48, 0x04, 0x12, 0x2B, 0xFB, 0x69, 0xFD, 0x64, 0xEF, 0x9B, 0x79, 0x1F,
+    0xE3, 0x10, 0x33, 0x06, 0x71, 0x91, 0x1A, 0xA8, 0x66, 0x03, 0xC0, 0xA4, 0xA1, 0xC9, 0x2A, 0x9A,
+    0xD8, 0x62, 0x7F, 0xCD, 0x0D, 0x81, 0x5C, 0xC4, 0x62, 0xB4, 0x9B, 0xD7, 0x50, 0x75, 0xE4, 0x68,
+    0xD0, 0x7A, 0xD3, 0x79, 0xB3, 0x71, 0xF0, 0xE8, 0x4D, 0xC4, 0x57, 0x76, 0xF2, 0x02, 0x4A, 0x3A,
+    0x40, 0xED, 0xB6, 0x34, 0xF5, 0xA6, 0x37, 0x19, 0x63, 0xD4, 0x69, 0x49, 0x13, 0xFB, 0x53, 0x54,
+    0xFF, 0xAD, 0x18, 0x2D, 0x26, 0xAB, 0x78, 0x7A, 0xC2, 0x37, 0x11, 0x30, 0xD4, 0x94, 0x2A, 0x52,
+    0x8C, 0x13, 0x93, 0xBC, 0xB5, 0x81, 0x14, 0x48, 0x0B, 0x04, 0xAB, 0xDF, 0x81, 0x04, 0x61, 0x9B,
+    0x7E, 0x15, 0xDD, 0xAE, 0x6C, 0x3F, 0x0B, 0x26, 0xC0, 0x08, 0x20, 0xEE, 0xA8, 0x44, 0x40, 0xD0,
+    0xF7, 0x7F, 0x7E, 0x08, 0xF2, 0x49, 0x20, 0xFC, 0x1A, 0x53, 0x40, 0x54, 0x20, 0xEC, 0x10, 0x90,
+    0x40, 0x66, 0x11, 0xEE, 0x93, 0xBA, 0x41, 0x87, 0x98, 0x91, 0xB4, 0x69, 0x99, 0xBC, 0x6A, 0x30,
+    0xCE, 0x10, 0xBD, 0xAE, 0x71, 0x27, 0x63, 0x34, 0x61, 0x46, 0x78, 0xA7, 0x0C, 0xA1, 0xC9, 0x41,
+    0x3B, 0x86, 0x7A, 0x09, 0x74, 0x2F, 0x10, 0x6F, 0x15, 0xD8, 0x18, 0x23, 0x79, 0x53, 0x2B, 0x97,
+    0xCB, 0x24, 0xE4, 0x09, 0xB8, 0x61, 0x78, 0x9A, 0x41, 0x58, 0x81, 0xCC, 0x93, 0x02, 0xDA, 0x60,
+    0x11, 0xB8, 0xD0, 0x07, 0x39, 0x83, 0x50, 0x5C, 0xF2, 0xB9, 0xD5, 0x18, 0x0F, 0xB0, 0x98, 0x61,
+    0x56, 0x57, 0x48, 0x26, 0x4C, 0x4D, 0x85, 0x91, 0x43, 0xD8, 0x5E, 0xC3, 0xFD, 0x45, 0x2C, 0x0D,
+    0x18, 0xFD, 0x73, 0xA3, 0xA5, 0x0C, 0xAE, 0x93, 0x23, 0x2F, 0x06, 0xCD, 0x1A, 0x24, 0x6F, 0x4B,
+    0x55, 0x6B, 0xDC, 0xC5, 0xDA, 0x3F, 0x00, 0x0C, 0x3C, 0x00, 0xC4, 0x86, 0x7B, 0xA5, 0x7A, 0x5F,
+    0x27, 0xB6, 0x39, 0x8F, 0xAB, 0x27, 0x04, 0x3C, 0x3D, 0x44, 0x2A, 0x4D, 0x24, 0xF2, 0xB2, 0x43,
+    0xAB, 0x4D, 0x4C, 0x50, 0xF7, 0x88, 0x6D, 0x99, 0xE5, 0x4C, 0x59, 0x8A, 0xBC, 0x21, 0xBE, 0x8A,
+    0xC7, 0x96, 0xBC, 0x2D, 0xA2, 0x76, 0x16, 0xC9, 0x96, 0xF5, 0xA0, 0x3C, 0xB6, 0x36, 0x47, 0xF6,
+    0x48, 0xA4, 0xD2, 0xD2, 0x60, 0x9A, 0x87, 0x9D, 0x62, 0xA3, 0x90, 0xC1, 0x59, 0x36, 0xE0, 0x80,
+    0x2D, 0xC8, 0x2E, 0x6A, 0x3C, 0xA8, 0x13, 0x01, 0xBB, 0x45, 0x82, 0xC0, 0x8A, 0x45, 0x62, 0xA0,
+    0xC1, 0xDE, 0xC4, 0x10, 0xD3, 0x38, 0x0D, 0xC7, 0x1E, 0xAD, 0x5A, 0x82, 0x66, 0x96, 0x8A, 0xBE,
+    0x5D, 0xFE, 0x76, 0x7A, 0xA7, 0x30, 0x7B, 0x19, 0x2E, 0x5D, 0xAE, 0xE3, 0x37, 0x85, 0xA2, 0x8B,
+    0x1F, 0x2E, 0x9C, 0xB4, 0x1F, 0xFC, 0x24, 0x8A, 0xC8, 0x84, 0xB7, 0x6C, 0xDB, 0xCC, 0x0C, 0x1A,
+    0xD5, 0xA8, 0x8F, 0xC8, 0xCC, 0xA5, 0xDB, 0xAA, 0x09, 0xD9, 0xD2, 0xAC, 0xA6, 0xEA, 0x87, 0xF6,
+    0x18, 0x9B, 0x19, 0x3F, 0x9B, 0xC2, 0x92, 0x7C, 0x1F, 0x2B, 0x3F, 0x5E, 0x4C, 0x45, 0xDF, 0x78,
+    0x3E, 0xE9, 0x80, 0x43, 0x3F, 0x5E, 0x08, 0x7D, 0xAF, 0xAC, 0x41, 0x55, 0xFB, 0xD7, 0xBC, 0x38,
+    0x11, 0x77, 0x73, 0x67, 0x78, 0xE0, 0x39, 0x7C, 0xD5, 0x3E, 0x80, 0x9F, 0x7D, 0x71, 0x98, 0x33,
+    0x38, 0xD7, 0x9F, 0x3C, 0xCF, 0xA9, 0x2F, 0xFD, 0x70, 0x64, 0x7D, 0x35, 0x2D, 0x56, 0x39, 0xAC,
+    0x6C, 0xC0, 0x2E, 0xB5, 0x50, 0x7B, 0x2C, 0x76, 0xE2, 0x03, 0x6A, 0xFC, 0x58, 0xB9, 0xA7, 0xEB,
+    0x79, 0x3B, 0xD2, 0xDD, 0x36, 0x99, 0x59, 0xAA, 0x49, 0xF7, 0x03, 0x19, 0x2C, 0x1C, 0x9F, 0x6E,
+    0xBF, 0x59, 0x21, 0xDD, 0xC4, 0xF3, 0xF6, 0xAB, 0x06, 0x1A, 0x6F, 0x83, 0x1A, 0x8F, 0x4B, 0xF5,
+    0xA9, 0x50, 0x95, 0x39, 0x09, 0xBB, 0x63, 0x15, 0xC7, 0xE7, 0x3B, 0xEE, 0x45, 0xF1, 0x4F, 0x8B,
+    0xF3, 0xDB, 0xC4, 0x73, 0x9F, 0x4B, 0x7D, 0xF6, 0xC0, 0xF3, 0x2B, 0x34, 0xAE, 0xB4, 0x64, 0x72,
+    0x95, 0x3C, 0xE7, 0x76, 0x89, 0xDA, 0x8D, 0xF0, 0x61, 0x8B, 0x5F, 0xD6, 0x48, 0x8A, 0x44, 0xBE,
+    0xB0, 0x07, 0x73, 0xA7, 0x7A, 0xF1, 0xCC, 0xBC, 0x90, 0x1E, 0x7F, 0x4B, 0xE5, 0x8B, 0x8A, 0x90,
+    0xDB, 0xB1, 0x17, 0x6D, 0x56, 0xBB, 0x43, 0xE8, 0x10, 0xBB, 0x20, 0x27, 0xB9, 0x5E, 0x8C, 0x73,
+    0xF1, 0x7F, 0x96, 0x03, 0x74, 0x90, 0xC8, 0x27, 0x90, 0xD2, 0x7D, 0x99, 0x7A, 0x87, 0x2B, 0xDA,
+    0x1E, 0x42, 0xA6, 0xEB, 0x90, 0x43, 0x55, 0x68, 0x17, 0x6C, 0x22, 0xAE, 0xD8, 0x95, 0xA9, 0x25,
+    0xD5, 0x07, 0x48, 0x6C, 0xE0, 0x28, 0x10, 0xD1, 0x61, 0x57, 0xE6, 0x5D, 0x2D, 0xB4, 0x55, 0x2E,
+    0x9A, 0x20, 0x62, 0x61, 0xCA, 0x48, 0xDE, 0x89, 0x09, 0x86, 0x94, 0x55, 0x4E, 0xA7, 0xCF, 0xB2,
+    0xF8, 0x34, 0xAC, 0x3F, 0xFD, 0x4F, 0xD2, 0x70, 0x71, 0x7D, 0x15, 0xBD, 0x6C, 0xCC, 0xAC, 0x3F,
+    0x39, 0x84, 0x27, 0x14, 0xE8, 0x4A, 0xB7, 0x54, 0xCD, 0xF9, 0x0A, 0x9B, 0x47, 0x72, 0xFE, 0xE1,
+    0xAA, 0xBD, 0xAB, 0x60, 0xAC, 0xCC, 0x8E, 0x28, 0x28, 0xB2, 0xDD, 0x61, 0xD4, 0xE9, 0x06, 0x73,
+    0x98, 0xC5, 0x51, 0xEB, 0x1B, 0xC5, 0x95, 0xBD, 0x6E, 0xD4, 0x40, 0x14, 0x85, 0xAF, 0x6D, 0xC0,
+    0xC5, 0x14, 0x43, 0x01, 0x15, 0x48, 0x6E, 0x28, 0x68, 0x82, 0x29, 0x52, 0x50, 0x24, 0x3B, 0x03,
+    0x94, 0x34, 0x29, 0xA0, 0xE7, 0x0D, 0x68, 0x53, 0xEC, 0x66, 0x1D, 0xF1, 0x02, 0xF4, 0xBC, 0x03,
+    0x15, 0x05, 0x42, 0x21, 0x36, 0xF0, 0x02, 0x16, 0x14, 0xB4, 0x96, 0x78, 0x00, 0x2C, 0xE1, 0x08,
+    0x4B, 0xB1, 0x7D, 0x39, 0xC7, 0x4E, 0xC2, 0x12, 0x50, 0x24, 0x10, 0x3F, 0xA3, 0xC4, 0x33, 0x3B,
+    0xDE, 0x99, 0x7B, 0xEE, 0x77, 0x7F, 0x56, 0x64, 0x1C, 0xB7, 0xE4, 0xA6, 0x48, 0x5C, 0x25, 0x58,
+    0x3A, 0x2D, 0xF1, 0xCC, 0x1B, 0x6E, 0xDF, 0x97, 0xD5, 0xB1, 0xD4, 0xC2, 0xEA, 0x67, 0xAD, 0x24,
+    0x6F, 0x23, 0xBC, 0x5E, 0x88, 0xF3, 0x12, 0x97, 0xBF, 0xBE, 0x4C, 0xB1, 0x2C, 0x42, 0x2C, 0xF7,
+    0x24, 0x29, 0xC4, 0x16, 0xD2, 0x4B, 0xD8, 0x8A, 0x69, 0x83, 0x9C, 0xD6, 0xB5, 0x80, 0x75, 0x18,
+    0x11, 0xB9, 0xEC, 0x8F, 0x0C, 0x07, 0x65, 0xE8, 0xC5, 0x94, 0x6B, 0x22, 0x56, 0x6B, 0x91, 0x64,
+    0xE0, 0x9E, 0x5F, 0x51, 0x96, 0xD6, 0xE1, 0x10, 0x6A, 0x91, 0xB6, 0xC1, 0xBE, 0x98, 0x4A, 0x5A,
+    0x49, 0xB2, 0xA8, 0x92, 0x1D, 0xB1, 0x59, 0xD0, 0xCA, 0x0C, 0x8E, 0x9D, 0xDA, 0x72, 0xDC, 0xEA,
+    0x24, 0xCD, 0xA2, 0x36, 0x1E, 0x24, 0xD6, 0x41, 0xCB, 0x58, 0xDF, 0xA9, 0x0F, 0xB6, 0x02, 0xDC,
+    0x76, 0x81, 0x57, 0x47, 0xCA, 0x8B, 0x0F, 0xF6, 0xF0, 0xB0, 0x11, 0x24, 0x49, 0xBD, 0xC1, 0xE5,
+    0xD3, 0x8C, 0x20, 0xEA, 0x55, 0x38, 0xB1, 0x76, 0xA2, 0xEA, 0x06, 0x31, 0x9A, 0xFD, 0x26, 0x91,
+    0x71, 0x49, 0x22, 0x73, 0xC2, 0x31, 0x45, 0xD0, 0x09, 0xE4, 0xD9, 0x12, 0x0A, 0x25, 0xCF, 0xAE,
+    0xD4, 0x50, 0x03, 0x23, 0x30, 0x30, 0x7A, 0x4E, 0xC3, 0x00, 0x06, 0x58, 0xD8, 0x0B, 0x2A, 0x1C,
+    0x33, 0x77, 0xC0, 0xEB, 0x86, 0x81, 0xEE, 0xC5, 0x9C, 0xC1, 0x63, 0x04, 0x2F, 0x1D, 0xC9, 0xCB,
+    0x0B, 0xD3, 0x1A, 0x95, 0xBC, 0xBA, 0xD0, 0xD2, 0xE1, 0xB3, 0xB0, 0xCC, 0x26, 0x2C, 0xD8, 0xAA,
+    0x65, 0x5F, 0x6C, 0x95, 0xE0, 0xB5, 0x1E, 0xAA, 0x4F, 0xF4, 0x5E, 0x2F, 0xE7, 0xFD, 0xB9, 0x13,
+    0xDE, 0xEB, 0x01, 0x88, 0xD8, 0xE2, 0x15, 0x30, 0xB5, 0x69, 0x21, 0xC1, 0x60, 0x40, 0xC4, 0x51,
+    0x53, 0xE4, 0xAF, 0xAF, 0xA6, 0xCC, 0x7F, 0x61, 0x23, 0xFE, 0x22, 0x2C, 0xEF, 0x02, 0x89, 0x43,
+    0x72, 0x05, 0x0D, 0x64, 0xDA, 0xC7, 0xF8, 0x34, 0x4F, 0xF1, 0x85, 0xEC, 0xE1, 0x8A, 0xBC, 0x3F,
+    0xCE, 0xE6, 0x9F, 0xFB, 0xBB, 0xA4, 0x55, 0xC3, 0xFC, 0x14, 0x66, 0x04, 0xAB, 0x09, 0x83, 0x55,
+    0x22, 0xE1, 0x20, 0x7F, 0xC5, 0x55, 0xC3, 0x12, 0x78, 0xC1, 0x12, 0x61, 0x9A, 0x59, 0x7E, 0x72,
+    0xB4, 0x9D, 0x96, 0xC7, 0xB6, 0x8E, 0x6B, 0xD3, 0xD4, 0xD3, 0x9C, 0x74, 0xD3, 0xBC, 0xB3, 0x9C,
+    0x5E, 0xB7, 0xE3, 0x21, 0x09, 0xCB, 0xC8, 0xCB, 0x0F, 0xC3, 0x69, 0x15, 0xF8, 0x40, 0x87, 0x54,
+    0x29, 0x09, 0xAD, 0xA6, 0x95, 0xB8, 0x86, 0x5F, 0xE0, 0x60, 0x1A, 0x9A, 0x03, 0x0C, 0x08, 0xF2,
+    0xE8, 0x1A, 0x16, 0x25, 0x2C, 0x90, 0x88, 0xFB, 0x1D, 0x0E, 0xCA, 0x6C, 0x21, 0x9B, 0x9C, 0x37,
+    0x1C, 0xE0, 0x81, 0xDE, 0xDC, 0xA1, 0xC5, 0xC0, 0x8F, 0x17, 0x89, 0x6F, 0x88, 0xA6, 0xB1, 0xBB,
+    0x50, 0x64, 0x5E, 0xD7, 0xF6, 0x0D, 0xE6, 0xF8, 0x5D, 0x15, 0xBF, 0x47, 0x5A, 0x44, 0x9F, 0xCB,
+    0xE8, 0x23, 0xB0, 0x85, 0x5F, 0x8A, 0xE8, 0x0B, 0xE6, 0x40, 0xB3, 0x50, 0x29, 0x50, 0x3D, 0xFF,
+    0x80, 0x0E, 0xCB, 0xB1, 0xFF, 0xD1, 0xD6, 0x8F, 0x23, 0x1D, 0x9D, 0x88, 0x27, 0x1F, 0x0F, 0x47,
+    0x97, 0xD3, 0x84, 0x7B, 0x71, 0xC1, 0x62, 0x94, 0xE7, 0x61, 0xF6, 0xFD, 0x81, 0x58, 0x2B, 0x23,
+    0xAE, 0x77, 0xBD, 0x34, 0x68, 0x5A, 0xFD, 0xC8, 0x3E, 0xAE, 0xC2, 0x8E, 0xC1, 0x17, 0x57, 0x1A,
+    0xF4, 0x46, 0x74, 0x25, 0xC6, 0xE4, 0x65, 0x6D, 0x11, 0x7C, 0x9B, 0xDC, 0xA9, 0xA9, 0xBA, 0x85,
+    0x73, 0x9B, 0x6B, 0xE6, 0x6D, 0x01, 0xC9, 0xC5, 0x62, 0x1B, 0x66, 0xB6, 0xA3, 0x4F, 0x9E, 0x3A,
+    0x53, 0x58, 0xB5, 0xB5, 0x30, 0xE0, 0x3B, 0x4C, 0x95, 0x93, 0x31, 0x36, 0x01, 0x8A, 0x0E, 0xD9,
+    0x56, 0xE3, 0x0F, 0xEC, 0x9E, 0xB7, 0xC1, 0x62, 0x4D, 0xD6, 0x57, 0x73, 0x43, 0x8B, 0x7C, 0x58,
+    0x0E, 0xF2, 0x88, 0x7D, 0x1D, 0xE6, 0x3B, 0x62, 0xEE, 0xC9, 0x76, 0x49, 0xA0, 0xA9, 0x07, 0x45,
+    0xFB, 0x9A, 0xE8, 0x3E, 0x92, 0xD7, 0x04, 0x89, 0x1E, 0x8E, 0x58, 0x76, 0xCE, 0x7A, 0x18, 0x45,
+    0x6A, 0xA4, 0xDA, 0x1D, 0x07, 0x97, 0x5B, 0xEC, 0x5A, 0x87, 0xB8, 0x68, 0x96, 0x30, 0xBF, 0x71,
+    0x77, 0x1D, 0x65, 0xAB, 0x70, 0x5C, 0xB7, 0xEC, 0x11, 0x81, 0x5E, 0x88, 0x05, 0x11, 0x74, 0x90,
+    0x13, 0x36, 0x01, 0x93, 0x00, 0x92, 0xF6, 0x90, 0x76, 0x51, 0xB5, 0xC7, 0xE2, 0xF6, 0x12, 0x1C,
+    0xD0, 0xF3, 0x67, 0x63, 0x7E, 0xB3, 0x19, 0x91, 0x3D, 0x33, 0x93, 0x51, 0x58, 0x30, 0xF3, 0x8A,
+    0x29, 0x0B, 0xF3, 0x9E, 0x52, 0x20, 0xF9, 0xC6, 0x68, 0xE9, 0x9C, 0x6C, 0xE1, 0xFC, 0x5D, 0x7C,
+    0x7D, 0xC9, 0x87, 0x0B, 0x9B, 0xD3, 0x41, 0xFD, 0x37, 0x48, 0xD8, 0x35, 0x66, 0x38, 0x39, 0x4C,
+    0x54, 0xDC, 0x93, 0x6F, 0x6D, 0x7B, 0xAC, 0x04, 0x6D, 0xF1, 0xDF, 0xA1, 0x1E, 0x9B, 0x39, 0xEA,
+    0x70, 0x1B, 0xEE, 0x5C, 0x1B, 0x11, 0xF6, 0xD3, 0x0F, 0x40, 0x4C, 0xE7, 0x11, 0x6D, 0x74, 0x06,
+    0x26, 0x27, 0xB7, 0x89, 0x00, 0x0E, 0x5F, 0x45, 0x1F, 0xD8, 0x40, 0x27, 0x99, 0xE7, 0xF2, 0xA0,
+    0x53, 0xDC, 0x93, 0xAB, 0x36, 0x3F, 0xC9, 0x5D, 0xF9, 0x0A, 0xB5, 0x55, 0x3D, 0x70, 0xDC, 0x44,
+    0x14, 0xFE, 0x24, 0xD9, 0x56, 0x12, 0x01, 0xEB, 0xC2, 0x2E, 0xF8, 0xB1, 0x95, 0x82, 0x22, 0xC3,
+    0x04, 0x94, 0x82, 0x82, 0xE2, 0xEE, 0xB4, 0x8C, 0x8B, 0x14, 0x14, 0x36, 0x33, 0xB8, 0xA2, 0xA1,
+    0x05, 0x0A, 0x53, 0x50, 0xB8, 0x38, 0x47, 0x72, 0x52, 0x52, 0x24, 0x3D, 0x4D, 0x0A, 0x2A, 0xD3,
+    0x50, 0xB8, 0x70, 0x61, 0xDF, 0x29, 0x76, 0x41, 0x41, 0x81, 0x1C, 0x4A, 0x37, 0xA2, 0x60, 0x3C,
+    0x4C, 0x0A, 0x76, 0x82, 0x66, 0x72, 0x81, 0xD5, 0x2D, 0xDF, 0xD3, 0xD9, 0x89, 0x13, 0x42, 0x66,
+    0x02, 0x83, 0xEE, 0x74, 0xBB, 0xF7, 0xF4, 0xF6, 0x7B, 0x7F, 0xDF, 0x7B, 0x02, 0x66, 0x81, 0xB0,
+    0x00, 0x2C, 0x90, 0xE4, 0x08, 0x2B, 0x60, 0x04, 0x4C, 0xE3, 0xF4, 0x72, 0x6E, 0x14, 0x3B, 0x77,
+    0x58, 0xFB, 0xA3, 0x05, 0x64, 0x5E, 0xA1, 0x0A, 0x04, 0x35, 0xB0, 0x07, 0xC4, 0x54, 0x36, 0xED,
+    0xB1, 0x54, 0xBF, 0x12, 0x55, 0xDE, 0xCF, 0x23, 0xF4, 0x52, 0xE7, 0xEE, 0x3A, 0x67, 0x1F, 0x1D,
+    0x8E, 0x88, 0x1B, 0x13, 0x31, 0x2E, 0xB9, 0xCF, 0x71, 0xF6, 0xA2, 0xEA, 0x88, 0xB7, 0xED, 0x21,
+    0xAC, 0xFB, 0x50, 0xD5, 0x3A, 0xE2, 0xE2, 0x4D, 0xA4, 0x7C, 0xD2, 0x00, 0x3E, 0x5D, 0x10, 0x70,
+    0x55, 0xB6, 0x4E, 0x21, 0x9B, 0x88, 0x03, 0x8A, 0x23, 0x83, 0x37, 0xE8, 0x44, 0x27, 0xD5, 0xE8,
+    0x0F, 0xB1, 0x6A, 0x1D, 0x71, 0x86, 0xCE, 0xD5, 0x13, 0x7B, 0x39, 0xBC, 0x66, 0x62, 0x6E, 0xE7,
+    0xAC, 0xB1, 0x7F, 0x1B, 0x84, 0x8F, 0x19, 0x1D, 0x15, 0x89, 0x0E, 0x0C, 0x75, 0xC7, 0x3C, 0x92,
+    0x56, 0x4F, 0x04, 0xF2, 0xBF, 0x04, 0x81, 0x29, 0x74, 0x7C, 0x13, 0x54, 0x7D, 0xC4, 0x37, 0x35,
+    0xB2, 0x0A, 0x3E, 0x7D, 0x99, 0xD1, 0xFF, 0xBD, 0x20, 0x9F, 0x02, 0xC3, 0x06, 0xC9, 0xB7, 0x26,
+    0x2C, 0x17, 0x44, 0x4D, 0x31, 0x5B, 0x3C, 0x1A, 0xEB, 0x17, 0x5B, 0x3C, 0x82, 0xA4, 0xAE, 0xC2,
+    0x39, 0x8C, 0x82, 0x3A, 0x34, 0x21, 0x5D, 0xF5, 0x00, 0xDD, 0x0B, 0x8D, 0x4D, 0xAF, 0x16, 0x17,
+    0xC5, 0x52, 0x9C, 0x07, 0x63, 0x0C, 0xEA, 0x78, 0xF9, 0xA0, 0xEA, 0xAE, 0x83, 0xF1, 0x07, 0xF6,
+    0xE5, 0xEC, 0xC1, 0xBD, 0x9B, 0xCD, 0x15, 0x49, 0xC4, 0x5B, 0x5B, 0x5F, 0xBB, 0xF1, 0x67, 0x5B,
+    0xDC, 0x85, 0xFA, 0xFC, 0x9E, 0xFF, 0x93, 0xB3, 0x6A, 0x4C, 0xC6, 0x75, 0x9D, 0xDB, 0x98, 0xF3,
+    0x96, 0xAB, 0xE1, 0x38, 0x7A, 0x50, 0x74, 0x09, 0x52, 0x67, 0xCD, 0x4E, 0xF2, 0xE5, 0x3B, 0xE8,
+    0xCF, 0x98, 0x30, 0x0F, 0x74, 0x54, 0xA5, 0x76, 0xBD, 0xBB, 0xBD, 0xB8, 0xB3, 0xB8, 0xD1, 0x4F,
+    0x6A, 0x4F, 0x7B, 0xD0, 0x8B, 0x61, 0x6E, 0xD3, 0xF0, 0xB0, 0xEE, 0xA9, 0x4D, 0xD3, 0x0F, 0x50,
+    0x90, 0xCB, 0x1F, 0xE8, 0xEE, 0x86, 0xBA, 0x7E, 0xDF, 0x28, 0x3A, 0x99, 0xE3, 0x36, 0xA6, 0x3C,
+    0x6C, 0xBF, 0x1D, 0x18, 0x4B, 0xAD, 0x68, 0xDF, 0xA8, 0xA5, 0xF2, 0xA5, 0x40, 0x3C, 0x1C, 0x56,
+    0xA9, 0xFB, 0x3E, 0x1F, 0x7C, 0xE7, 0xD1, 0x39, 0xE8, 0xBE, 0x0A, 0xAA, 0x6E, 0x58, 0xA5, 0x52,
+    0x32, 0xA8, 0x83, 0x51, 0x4F, 0xDD, 0xB8, 0x6B, 0x0C, 0x43, 0x51, 0x3F, 0xDC, 0x37, 0xBB, 0x71,
+    0x50, 0x75, 0x7C, 0x5C, 0xEA, 0xF5, 0xBA, 0x9D, 0x77, 0xAF, 0x60, 0x4A, 0x1D, 0x98, 0xD1, 0x6E,
+    0xE7, 0x1C, 0xE6, 0x86, 0x6E, 0x20, 0x9C, 0x2B, 0xAF, 0x8D, 0xA3, 0x3F, 0xCB, 0x6B, 0xDC, 0x7A,
+    0x3A, 0xAE, 0x3B, 0x9D, 0xF7, 0x2E, 0x77, 0x3A, 0x31, 0xFD, 0x9B, 0x8E, 0x2A, 0x9B, 0xAA, 0xE5,
+    0x4D, 0xFD, 0x6A, 0x60, 0x5F, 0xAF, 0xBA, 0x3C, 0x36, 0x27, 0xA6, 0xC2, 0xA2, 0x07, 0xEB, 0xBB,
+    0xFD, 0x31, 0x30, 0xD7, 0x97, 0xEB, 0x12, 0xB6, 0xC9, 0xAB, 0xE8, 0xB7, 0xF7, 0xEB, 0xDD, 0xAE,
+    0x7F, 0xC8, 0xEA, 0x23, 0xC0, 0xF9, 0x5D, 0xEF, 0xF8, 0x0F, 0x1B, 0x3B, 0xFD, 0x1A, 0x3F, 0x37,
+    0x9A, 0x85, 0x81, 0x3B, 0xBE, 0x6A, 0x67, 0x2F, 0x20, 0x73, 0xF7, 0x5C, 0x33, 0xBF, 0xAA, 0x9F,
+    0x8E, 0xC0, 0xCB, 0x11, 0x54, 0x08, 0x4B, 0x90, 0x0E, 0x31, 0x70, 0x59, 0x42, 0xBC, 0x80, 0xDB,
+    0xE9, 0x75, 0xCB, 0x6F, 0x8C, 0xBA, 0x13, 0x16, 0xFD, 0xA0, 0x49, 0x34, 0x56, 0xF8, 0xA0, 0x27,
+    0x41, 0x92, 0x29, 0x9E, 0x93, 0x12, 0x48, 0xC8, 0x8F, 0xDB, 0x1D, 0xA4, 0x61, 0x43, 0x7E, 0x39,
+    0x9D, 0x22, 0x28, 0x89, 0xB6, 0x1D, 0x90, 0xAB, 0xC2, 0x96, 0x96, 0xD6, 0x14, 0x20, 0x30, 0xAB,
+    0x2B, 0x10, 0x52, 0xA5, 0xAE, 0x39, 0x11, 0x00, 0xA7, 0x1A, 0x9F, 0x08, 0xAD, 0x29, 0x50, 0x14,
+    0x7C, 0xBC, 0x4F, 0x9C, 0xDF, 0x85, 0xDB, 0x58, 0xA1, 0x85, 0x01, 0xD9, 0x99, 0xEE, 0x5B, 0x7A,
+    0xD9, 0x7B, 0x62, 0x12, 0xF8, 0xD4, 0xA8, 0x33, 0x9A, 0xE5, 0x11, 0x45, 0xB3, 0xBE, 0x98, 0xFD,
+    0xE2, 0x2C, 0x28, 0xD4, 0x9D, 0x55, 0x1D, 0x38, 0x67, 0x20, 0x3D, 0xF2, 0xD8, 0x8F, 0x56, 0xC3,
+    0xCB, 0x29, 0x30, 0x13, 0xB3, 0xDE, 0x5A, 0x44, 0xB0, 0x1F, 0x79, 0x57, 0x93, 0x79, 0xE0, 0x04,
+    0x96, 0x3F, 0xAE, 0x54, 0x54, 0xEB, 0xA3, 0x0E, 0x4C, 0x50, 0x28, 0x42, 0x74, 0xC4, 0x82, 0x7F,
+    0x02, 0x3F, 0x81, 0x42, 0xFA, 0xF9, 0x37, 0xDC, 0xB6, 0x6D, 0x98, 0x6E, 0xB9, 0x52, 0xA4, 0x4E,
+    0x14, 0xD8, 0xB1, 0xDC, 0xC6, 0x85, 0xE8, 0x5A, 0xD9, 0xAA, 0xB3, 0xDB, 0x19, 0xEA, 0x5B, 0xDA,
+    0xD0, 0x4A, 0xE6, 0x82, 0xDF, 0xF6, 0x70, 0x0B, 0x2A, 0x7D, 0x8F, 0x48, 0xD2, 0x9B, 0x35, 0xF2,
+    0xE4, 0xE1, 0xA4, 0xB7, 0xDB, 0xF9, 0xCA, 0xA1, 0xE8, 0x0B, 0xF6, 0x2D, 0xB4, 0x15, 0x79, 0x94,
+    0xFA, 0x87, 0xE2, 0x7A, 0xCA, 0xFE, 0xB1, 0xE8, 0x12, 0xBD, 0x56, 0x85, 0x5F, 0xA4, 0x2C, 0x8F,
+    0x9D, 0xF8, 0x28, 0x61, 0xA7, 0x93, 0xBC, 0x3C, 0xFB, 0xAF, 0xDF, 0x96, 0x45, 0xA2, 0x59, 0x95,
+    0xFA, 0xBA, 0x5B, 0x02, 0xCA, 0x46, 0x08, 0x4D, 0x54, 0x21, 0xF6, 0x98, 0x2D, 0x43, 0x12, 0x28,
+    0xD1, 0xD6, 0xC2, 0xD8, 0xB0, 0xF2, 0x34, 0x55, 0xC6, 0x92, 0xA9, 0x12, 0x2D, 0x9D, 0x25, 0x73,
+    0xD9, 0x49, 0x4E, 0x66, 0xD9, 0x42, 0xE1, 0x26, 0x99, 0x6A, 0x19, 0x47, 0x56, 0x24, 0x52, 0x82,
+    0x35, 0x96, 0x13, 0xF3, 0xF4, 0x7A, 0x7A, 0x05, 0xB1, 0xAB, 0x43, 0xE7, 0xEE, 0xB0, 0x72, 0x89,
+    0x8E, 0x0E, 0x0C, 0xFA, 0x29, 0xC2, 0x25, 0x2B, 0xAD, 0xCB, 0x68, 0x38, 0x29, 0x9C, 0x84, 0x59,
+    0xF2, 0x26, 0x8C, 0x9D, 0x85, 0x3A, 0xCA, 0xB1, 0xB7, 0x8B, 0xE8, 0xA8, 0x80, 0x1D, 0x22, 0xFD,
+    0x8A, 0xB1, 0x26, 0xCC, 0xDE, 0xF4, 0x47, 0xED, 0x28, 0x3D, 0x76, 0x95, 0x2A, 0x68, 0x95, 0x11,
+    0xE0, 0x39, 0x9B, 0x61, 0xE3, 0x5C, 0x3E, 0x87, 0x0F, 0xAD, 0x3A, 0x32, 0xD9, 0x72, 0xFE, 0xE8,
+    0x65, 0xA3, 0x64, 0x2E, 0xE6, 0x4F, 0x57, 0xE7, 0x79, 0xDB, 0xC4, 0x2D, 0x31, 0x72, 0xB4, 0x35,
+    0xF7, 0x19, 0x15, 0xE5, 0x2F, 0xFA, 0xE5, 0xCC, 0xE5, 0x50, 0x24, 0xDA, 0x40, 0xA6, 0x74, 0x62,
+    0x44, 0x70, 0x7A, 0x91, 0xD2, 0x6E, 0xB2, 0x48, 0xE5, 0x7D, 0xD3, 0xF2, 0xC1, 0xAF, 0xA2, 0xBF,
+    0x2F, 0xC1, 0xC9, 0x52, 0x9E, 0x2E, 0xEE, 0x57, 0x2E, 0x05, 0x6B, 0x52, 0xF0, 0xD5, 0x1C, 0xFD,
+    0xB2, 0x66, 0xF8, 0x26, 0x8D, 0x4A, 0x4E, 0x27, 0x95, 0x53, 0x45, 0xDA, 0xA4, 0x5D, 0x12, 0xB4,
+    0x4B, 0xAF, 0x5D, 0x2E, 0x32, 0xB1, 0x54, 0xC9, 0x46, 0x5C, 0x62, 0x33, 0x34, 0x52, 0xF9, 0x22,
+    0xCB, 0x7D, 0x31, 0x3F, 0x8F, 0x7F, 0xBC, 0xFE, 0x02, 0xC5, 0x55, 0x3D, 0x8F, 0xDC, 0x36, 0x10,
+    0x1D, 0x89, 0x8E, 0x55, 0xA8, 0xA0, 0x0B, 0x3B, 0x08, 0xDC, 0xE8, 0x0F, 0xC4, 0xA7, 0x3F, 0xE0,
+    0x33, 0x85, 0x34, 0x69, 0xAF, 0xC8, 0x21, 0x85, 0x0B, 0x57, 0xAE, 0xD7, 0xA5, 0x8B, 0xB3, 0x25,
+    0x04, 0x70, 0xED, 0xAD, 0xDC, 0xA6, 0xBF, 0x22, 0x97, 0x22, 0x85, 0x9B, 0xAC, 0x98, 0x5F, 0x60,
+    0x35, 0x49, 0x2D, 0x20, 0x45, 0x0A, 0x17, 0x96, 0x13, 0x39, 0x96, 0x0F, 0x5C, 0x4D, 0xDE, 0xA3,
+    0xF6, 0xBE, 0x82, 0x04, 0x30, 0x90, 0x22, 0x82, 0x76, 0xC8, 0x9D, 0x25, 0x67, 0x1E, 0xDF, 0x0C,
+    0xDF, 0x8A, 0xC4, 0xA7, 0xD5, 0xAA, 0xD5, 0x46, 0xEA, 0x2D, 0x5F, 0x31, 0x03, 0xDF, 0x8F, 0x1A,
+    0xDE, 0x1D, 0x7E, 0xFD, 0xEE, 0x40, 0x8C, 0xF2, 0x59, 0x2F, 0xC3, 0x18, 0x7F, 0x4B, 0xC3, 0xB2,
+    0x64, 0xB3, 0x0C, 0x4F, 0xAF, 0x0C, 0x3B, 0xE7, 0xB2, 0x24, 0x9F, 0x4A, 0xAD, 0x4A, 0xD5, 0x5E,
+    0x09, 0x62, 0x96, 0x2B, 0x4F, 0x8B, 0x80, 0x9D, 0x68, 0xB4, 0x93, 0x19, 0x32, 0x2F, 0x08, 0x6F,
+    0xBC, 0x0C, 0xD1, 0x3E, 0x42, 0x1E, 0x89, 0x60, 0x2E, 0xEC, 0xDB, 0xEF, 0xD6, 0x42, 0x40, 0x01,
+    0x76, 0x3E, 0xD6, 0xE8, 0x77, 0x15, 0x6D, 0xD9, 0xD0, 0x16, 0x8B, 0xF5, 0xFF, 0x60, 0x57, 0x2A,
+    0x6D, 0x40, 0xB2, 0x2F, 0xB8, 0x59, 0x6E, 0xE0, 0x93, 0x30, 0x66, 0x3E, 0xC2, 0xD4, 0x3D, 0xBE,
+    0x45, 0x70, 0xCD, 0x05, 0xBA, 0x04, 0xF8, 0x9A, 0xC2, 0xD7, 0xB3, 0xB8, 0x0E, 0x21, 0x66, 0x6F,
+    0x86, 0x84, 0x47, 0x32, 0x1D, 0xCF, 0xC5, 0xB0, 0x96, 0xF9, 0xF7, 0x48, 0xD4, 0x11, 0x51, 0x11,
+    0xD4, 0x9F, 0x1B, 0xFA, 0x1C, 0x4D, 0xCC, 0x6C, 0x7B, 0xEE, 0x58, 0x38, 0x23, 0x90, 0x99, 0xA6,
+    0x6E, 0x48, 0x0A, 0x29, 0xC9, 0x89, 0x45, 0x0E, 0x90, 0x8B, 0xCF, 0x7E, 0x3C, 0x63, 0x74, 0x95,
+    0x63, 0xB4, 0x1D, 0xED, 0xB5, 0xBF, 0x91, 0x56, 0x15, 0xFA, 0x1E, 0x8C, 0xB5, 0x13, 0x49, 0x09,
+    0x82, 0x64, 0xD6, 0x33, 0x45, 0x9C, 0x2A, 0xA7, 0x8E, 0x53, 0xFB, 0xCA, 0x33, 0x35, 0xA7, 0x81,
+    0x0B, 0x1C, 0xD7, 0x5A, 0x8F, 0xE9, 0x1F, 0x03, 0xA7, 0x81, 0xDB, 0x34, 0x46, 0xF0, 0x4B, 0x84,
+    0xB3, 0x60, 0x40, 0x97, 0xEB, 0x1B, 0x1D, 0x93, 0xB3, 0x82, 0x19, 0x8F, 0xDA, 0x24, 0x63, 0x8A,
+    0x25, 0xEE, 0xC5, 0xC4, 0xB3, 0x4E, 0x24, 0xA8, 0xBA, 0x8A, 0xCB, 0x3B, 0xFD, 0x56, 0xD7, 0xD7,
+    0xB5, 0x41, 0x90, 0x52, 0xF2, 0x5E, 0x6C, 0x83, 0x88, 0x60, 0xAA, 0x6C, 0x0C, 0x69, 0x20, 0xDF,
+    0x1B, 0x99, 0x98, 0x01, 0x7C, 0x25, 0xD3, 0x3D, 0xEC, 0x72, 0xE0, 0x50, 0xB2, 0xD7, 0xA4, 0x5D,
+    0x3D, 0x4C, 0xD1, 0x9F, 0x17, 0xFB, 0x25, 0xCD, 0x11, 0x69, 0x79, 0x02, 0x63, 0x09, 0xC5, 0x44,
+    0x3C, 0x37, 0xCF, 0x73, 0x96, 0xDA, 0x45, 0x2E, 0x8C, 0xF6, 0x16, 0x67, 0x60, 0x99, 0xCC, 0x88,
+    0x9C, 0xB2, 0xE5, 0x41, 0x5C, 0xF5, 0x1F, 0x9C, 0x95, 0xD4, 0x15, 0xFB, 0x73, 0x8E, 0x6D, 0x4F,
+    0x82, 0xCE, 0x81, 0xC5, 0x02, 0xED, 0xD1, 0xE4, 0x64, 0x20, 0xE9, 0x2E, 0xB5, 0x0C, 0x0D, 0xB9,
+    0x21, 0xA7, 0x38, 0xD8, 0x36, 0x32, 0xC3, 0x33, 0x59, 0xA4, 0x91, 0xF4, 0x77, 0x96, 0x75, 0x9F,
+    0xB1, 0x32, 0xCF, 0x30, 0x13, 0x58, 0x12, 0x4B, 0x08, 0xE9, 0x80, 0xD4, 0xE2, 0x0E, 0x57, 0x8D,
+    0x64, 0xB1, 0xBF, 0xE7, 0xE3, 0x93, 0x4E, 0x0A, 0xC0, 0xC0, 0x4F, 0x4C, 0x0C, 0xB6, 0x5C, 0x03,
+    0x32, 0x93, 0x70, 0x5D, 0xD7, 0x89, 0x06, 0x05, 0xC8, 0x48, 0x19, 0x58, 0xD0, 0x19, 0x7B, 0xB4,
+    0xB1, 0x3E, 0xEB, 0xB1, 0xF2, 0x07, 0x20, 0xFC, 0x9C, 0x31, 0x23, 0xE8, 0x88, 0x79, 0x3E, 0xAE,
+    0xB0, 0x5A, 0xC5, 0xFE, 0xBC, 0x62, 0x37, 0xB6, 0xC2, 0xE2, 0x3B, 0x49, 0x47, 0xAC, 0xF8, 0x91,
+    0x0D, 0x03, 0x47, 0x09, 0xC7, 0xCA, 0xE3, 0xCC, 0x1E, 0xF1, 0x76, 0xA5, 0xBD, 0x75, 0xC0, 0x4B,
+    0x5A, 0xD5, 0xA7, 0x2D, 0x02, 0x67, 0xD8, 0x9A, 0xA2, 0xE9, 0x12, 0x36, 0x1E, 0x47, 0xDE, 0xD6,
+    0xC1, 0x9C, 0xDE, 0x47, 0x1B, 0x69, 0x6F, 0x4E, 0x4F, 0x70, 0xE5, 0x93, 0x2D, 0xFB, 0x9B, 0x11,
+    0x77, 0x1F, 0xCE, 0x67, 0xEC, 0x0D, 0x40, 0x39, 0x5C, 0x04, 0x96, 0x14, 0x80, 0x7F, 0x23, 0xE8,
+    0x10, 0x75, 0x03, 0x40, 0x4C, 0xE7, 0x24, 0x07, 0x8E, 0x9B, 0x44, 0x4C, 0xE4, 0x6E, 0xE1, 0xFA,
+    0xDF, 0xBF, 0xE6, 0x3A, 0x88, 0x2E, 0x1C, 0xB0, 0x75, 0xA8, 0x23, 0x26, 0x8A, 0x49, 0xE6, 0x21,
+    0x04, 0xC9, 0x90, 0x81, 0xDC, 0x97, 0x2C, 0xC7, 0x9E, 0x3C, 0xC5, 0xA6, 0x8A, 0xEA, 0xD0, 0xD1,
+    0x39, 0xD0, 0x79, 0x44, 0xE7, 0x1E, 0x25, 0xC3, 0x36, 0x70, 0x1A, 0x0F, 0x27, 0x5A, 0x14, 0xCE,
+    0x89, 0xCE, 0xBB, 0x02, 0xA7, 0x63, 0x35, 0xCB, 0x26, 0xD9, 0x44, 0x95, 0xDA, 0xD6, 0xB4, 0xCF,
+    0x91, 0x30, 0xFF, 0x95, 0x8A, 0x31, 0xB2, 0xD2, 0xFB, 0xBC, 0xB5, 0x36, 0x67, 0x77, 0xFC, 0x44,
+    0x28, 0x8F, 0x76, 0x25, 0xD1, 0x2F, 0x09, 0xC5, 0x46, 0x4D, 0x93, 0x3B, 0x40, 0x9E, 0x5D, 0x2D,
+    0x49, 0xB8, 0xF5, 0xD5, 0x52, 0x12, 0xF0, 0xBB, 0x38, 0x44, 0xCE, 0x56, 0x7C, 0x06, 0x87, 0x85,
+    0xC3, 0xA0, 0x24, 0x9F, 0x0E, 0xA8, 0x40, 0x60, 0x27, 0xEE, 0x2E, 0xDC, 0x8D, 0x34, 0xF0, 0x62,
+    0xB6, 0xD2, 0xFA, 0x72, 0x96, 0xDA, 0x97, 0x6C, 0x59, 0xF7, 0xBD, 0x14, 0xD8, 0x5D, 0x22, 0x38,
+    0xAE, 0x42, 0x81, 0x65, 0x77, 0x21, 0x3E, 0xB8, 0x56, 0x79, 0x13, 0x32, 0xC2, 0x1A, 0x9C, 0x61,
+    0x9F, 0x16, 0x0F, 0x7E, 0x61, 0x2E, 0xB4, 0x0B, 0xB1, 0x9B, 0x0F, 0xF3, 0x0A, 0x31, 0xD3, 0xD1,
+    0x2D, 0x08, 0xAC, 0x87, 0x7C, 0x09, 0x4A, 0x68, 0xB1, 0x16, 0x4D, 0x92, 0x00, 0x53, 0x8D, 0xB0,
+    0xAE, 0xC1, 0x8B, 0xEE, 0x1A, 0xD1, 0xD6, 0x6C, 0x9F, 0xCA, 0x75, 0x39, 0xAE, 0xDC, 0xE8, 0xBA,
+    0x0C, 0x71, 0xF4, 0x59, 0xC4, 0xF5, 0x49, 0x25, 0xB7, 0xD7, 0x38, 0xF9, 0x94, 0xEA, 0x49, 0xC0,
+    0x65, 0x1A, 0xEF, 0x41, 0x03, 0x46, 0x29, 0xBE, 0xF1, 0xE4, 0x94, 0xDA, 0x01, 0x3C, 0x87, 0xE0,
+    0x41, 0xA1, 0x0C, 0xA8, 0x9C, 0x14, 0x74, 0x21, 0x11, 0xA4, 0x5B, 0x36, 0x8F, 0xC5, 0xBC, 0xC7,
+    0xA1, 0x5F, 0x8D, 0x32, 0x17, 0x73, 0xDB, 0x5B, 0xB4, 0x77, 0xF2, 0x70, 0x57, 0xD9, 0x9C, 0x52,
+    0xA4, 0xF8, 0xF3, 0xCA, 0xA3, 0xB6, 0x5C, 0xD2, 0xAA, 0x08, 0xC7, 0x72, 0x6A, 0xA2, 0xF0, 0x05,
+    0x4E, 0x1D, 0x17, 0x58, 0xDC, 0x2F, 0xC7, 0x81, 0x0A, 0x88, 0xA9, 0x8B, 0x6A, 0xE7, 0x39, 0x1D,
+    0x38, 0x0D, 0x97, 0xA5, 0x53, 0x42, 0xAA, 0xA3, 0xB4, 0xB8, 0xEB, 0xD0, 0xD6, 0x7E, 0x97, 0x75,
+    0xA4, 0x5E, 0x15, 0x4D, 0x89, 0xC3, 0xCD, 0xF7, 0x07, 0x76, 0xEC, 0xB4, 0x88, 0xF5, 0xFF, 0xAD,
+    0xC6, 0x1F, 0xFD, 0xFC, 0x05, 0xBD, 0x54, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0x3D, 0x33, 0x43, 0x30,
+    0x92, 0x8B, 0xA9, 0xA8, 0x28, 0xFC, 0x05, 0xAC, 0x5B, 0x8A, 0x64, 0x6D, 0xD1, 0xD0, 0xA6, 0xC8,
+    0x82, 0x44, 0xC3, 0x27, 0x84, 0x0F, 0x08, 0x6B, 0xC3, 0x17, 0xF0, 0x07, 0x7C, 0x02, 0xCD, 0x16,
+    0x48, 0x64, 0x63, 0x07, 0x8A, 0x14, 0x34, 0x16, 0x12, 0x35, 0x2E, 0x88, 0x28, 0x77, 0x14, 0x4D,
+    0x22, 0x6F, 0x34, 0xF3, 0x2E, 0xE7, 0xCE, 0x7B, 0xBB, 0x0B, 0x08, 0x84, 0x90, 0x56, 0xB1, 0xE4,
+    0xEB, 0x99, 0xEB, 0x3B, 0x33, 0xE7, 0x9E, 0x7B, 0xEE, 0x00, 0x30, 0x98, 0x64, 0x6C, 0xE6, 0x61,
+    0x87, 0x6E, 0x71, 0x01, 0xBB, 0xD9, 0x05, 0x13, 0xE0, 0x82, 0x5B, 0x68, 0xEA, 0x99, 0xC6, 0x83,
+    0xE6, 0x88, 0xE6, 0xE5, 0x23, 0x1A, 0x49, 0x34, 0xAF, 0x9E, 0xA8, 0xAF, 0x53, 0xD3, 0x94, 0x90,
+    0x55, 0x57, 0xE8, 0x32, 0x9B, 0xA0, 0xBB, 0xA8, 0x19, 0xC6, 0x56, 0xFA, 0x76, 0x15, 0xE9, 0x6B,
+    0xAE, 0x01, 0xEE, 0xA3, 0x3C, 0x8D, 0x88, 0x2C, 0x95, 0x1A, 0xD4, 0x73, 0x3B, 0xC2, 0xAE, 0xD5,
+    0x0A, 0x7C, 0x67, 0x36, 0xE0, 0x08, 0xA7, 0x80, 0x1F, 0x9B, 0x11, 0x6E, 0x51, 0x67, 0x54, 0xE7,
+    0x5D, 0x75, 0x36, 0xA0, 0xB3, 0x9E, 0xE9, 0x74, 0xAB, 0x3A, 0xA3, 0x3A, 0x1F, 0xAB, 0xF3, 0x18,
+    0xD5, 0xFA, 0x4E, 0x0B, 0xB3, 0x55, 0x32, 0xE2, 0xD4, 0xCA, 0x6C, 0x24, 0x0D, 0xA3, 0x11, 0xB9,
+    0xD3, 0xE3, 0xE6, 0x91, 0x0D, 0x46, 0x42, 0x25, 0x33, 0xDA, 0x8C, 0x3A, 0xC3, 0xED, 0x80, 0xEF,
+    0x57, 0x0C, 0x01, 0x7E, 0x40, 0x3D, 0x00, 0xAF, 0x02, 0x5E, 0x70, 0xD2, 0xF4, 0x4D, 0x0B, 0x84,
+    0x64, 0x7F, 0xE6, 0xA4, 0x9E, 0xEF, 0x36, 0x30, 0xE1, 0x8B, 0xEA, 0xCB, 0x88, 0xC6, 0xAD, 0x67,
+    0x4D, 0x6F, 0x42, 0xEB, 0x79, 0xF6, 0x11, 0x5E, 0xAE, 0x7E, 0xB4, 0xAB, 0x3F, 0xC7, 0x46, 0x00,
+    0xD3, 0xEC, 0x67, 0xB7, 0xB8, 0x0D, 0x09, 0xF7, 0xD0, 0x41, 0x27, 0xA4, 0xF0, 0xB1, 0x95, 0xF5,
+    0x2D, 0x4C, 0x79, 0x12, 0xCD, 0x79, 0x2D, 0x30, 0xAC, 0x64, 0x0C, 0xF2, 0x8C, 0xA9, 0xCB, 0x25,
+    0xA3, 0xD1, 0xF6, 0xE4, 0x09, 0xE7, 0x5C, 0x02, 0x1B, 0xB9, 0x14, 0xF5, 0xF2, 0x17, 0xF7, 0x2F,
+    0x27, 0x9F, 0xD0, 0x5D, 0xB8, 0xA2, 0x91, 0xFF, 0x88, 0xBE, 0x71, 0xD7, 0xB2, 0x18, 0xD9, 0xB8,
+    0xA0, 0x11, 0xFE, 0xFA, 0x94, 0x4C, 0x90, 0xF0, 0x1E, 0xB5, 0x4C, 0x09, 0x3E, 0x12, 0x70, 0x1D,
+    0x50, 0x6D, 0x15, 0xFF, 0x4D, 0x96, 0x6C, 0xFA, 0x95, 0xDB, 0xD8, 0x44, 0x1A, 0x30, 0xB0, 0x9E,
+    0xF0, 0x3F, 0x11, 0xAE, 0x7B, 0xC1, 0x3F, 0x48, 0x13, 0x4D, 0xA7, 0xCE, 0xE6, 0x19, 0xC3, 0xEB,
+    0x95, 0xC4, 0xB9, 0xD8, 0xF2, 0xA8, 0xE4, 0x12, 0x4C, 0xC2, 0xB0, 0xD8, 0xAC, 0xBB, 0x67, 0x02,
+    0x11, 0x5D, 0x71, 0x72, 0xC5, 0x7B, 0xAD, 0x90, 0xF3, 0x40, 0xB3, 0xEB, 0x89, 0xAA, 0x1D, 0x09,
+    0x93, 0xB5, 0xE3, 0xB0, 0xB9, 0xAD, 0xA1, 0x95, 0xC8, 0x72, 0x33, 0xB5, 0x8E, 0x95, 0x3D, 0xB9,
+    0x4F, 0x29, 0xCB, 0x38, 0xBC, 0x9E, 0xA2, 0x0B, 0x55, 0x62, 0x80, 0xBE, 0xE7, 0x7F, 0x7A, 0x39,
+    0xB7, 0x9B, 0x0B, 0xEF, 0x05, 0xC7, 0x38, 0xC7, 0x12, 0x28, 0x71, 0xFF, 0xF4, 0xB6, 0xD4, 0x92,
+    0x70, 0xCB, 0x92, 0x8D, 0x55, 0x05, 0xB3, 0x04, 0x75, 0x34, 0x91, 0x02, 0xBC, 0xC7, 0x00, 0xFF,
+    0x61, 0x84, 0x9D, 0x55, 0xD5, 0x9D, 0x2A, 0x7A, 0x54, 0x62, 0xC8, 0xA0, 0xA6, 0xCF, 0xCE, 0x00,
+    0xE9, 0x81, 0x92, 0x8B, 0xAC, 0x11, 0x3A, 0xD1, 0xC1, 0x74, 0xF9, 0xF1, 0x19, 0x89, 0x4A, 0x7B,
+    0x9E, 0xDE, 0xED, 0xAF, 0x49, 0xDA, 0x29, 0x51, 0x17, 0x63, 0xD7, 0x1F, 0x47, 0x17, 0xDD, 0xAF,
+    0xE8, 0xFA, 0xF7, 0x3F, 0x77, 0xD1, 0x8E, 0x1C, 0x28, 0xD9, 0xBA, 0xC7, 0xFF, 0x18, 0xBC, 0xAD,
+    0xA5, 0x50, 0xC5, 0x94, 0xA7, 0x95, 0xE0, 0xE5, 0x77, 0xF9, 0xCD, 0x4C, 0x2B, 0xF5, 0x51, 0xCF,
+    0xC4, 0xE8, 0x56, 0xA2, 0xB6, 0x41, 0x21, 0x13, 0x47, 0xC2, 0x23, 0xAD, 0xCD, 0x71, 0xE9, 0x65,
+    0x2E, 0x38, 0xF5, 0xCC, 0xC6, 0xFF, 0x48, 0xD0, 0xE6, 0xB5, 0x8A, 0xB6, 0xD3, 0x3C, 0x2A, 0xCD,
+    0x0C, 0xA5, 0x8B, 0x8F, 0x4A, 0x0F, 0xF3, 0xF5, 0x9F, 0xE9, 0x81, 0x24, 0x8A, 0xA7, 0xA9, 0xB9,
+    0x53, 0xCE, 0xAB, 0x34, 0x37, 0x43, 0x6A, 0xF7, 0x44, 0xEE, 0x17, 0xB5, 0x54, 0x00, 0x21, 0x5D,
+    0x64, 0xEC, 0x5C, 0x68, 0x97, 0x8C, 0x64, 0x28, 0xB6, 0x0E, 0xDD, 0xB7, 0xBD, 0x9F, 0xAB, 0x0B,
+    0xDE, 0x3B, 0x46, 0x22, 0x23, 0x4F, 0x9F, 0xD0, 0xD9, 0x7E, 0xC3, 0x76, 0xF2, 0x3F, 0xB0, 0x56,
+    0xCD, 0xD2, 0x3E, 0xCF, 0x0F, 0xA9, 0x64, 0x56, 0x0B, 0xE6, 0xE1, 0xF3, 0xAB, 0x3D, 0x4D, 0x2E,
+    0x82, 0x66, 0xAE, 0xE6, 0xE4, 0xC1, 0x41, 0x6C, 0x5E, 0x36, 0x2F, 0x4F, 0x65, 0x33, 0xD3, 0x52,
+    0xB1, 0x5B, 0x7B, 0x4C, 0xBC, 0x48, 0xE0, 0x03, 0x93, 0x46, 0xAE, 0x8B, 0x7C, 0x17, 0xED, 0xBF,
+    0x9B, 0x94, 0x94, 0x33, 0x27, 0xA5, 0x29, 0x39, 0x37, 0x51, 0x4B, 0xB4, 0xA9, 0xD0, 0x13, 0xEF,
+    0x30, 0xB6, 0x53, 0xC7, 0xEB, 0x44, 0xA3, 0x58, 0xE1, 0x09, 0x13, 0x37, 0x66, 0x99, 0x20, 0x25,
+    0x55, 0x2D, 0x5B, 0xAC, 0x78, 0xCF, 0x64, 0x74, 0x3B, 0x0D, 0xE8, 0xB4, 0x05, 0x5D, 0xBC, 0xB5,
+    0x61, 0xE4, 0xC1, 0x56, 0x55, 0x91, 0xD4, 0xEC, 0x6B, 0x59, 0xD8, 0xD7, 0x4C, 0xF4, 0xE2, 0xD3,
+    0x04, 0xCA, 0xF0, 0x03, 0x35, 0x6E, 0xAF, 0xA5, 0x4E, 0xBE, 0x92, 0xDC, 0xEE, 0xC8, 0x25, 0x37,
+    0x68, 0xE6, 0xBF, 0x19, 0x7B, 0x6D, 0xD8, 0xB5, 0xCC, 0x53, 0xD4, 0x4C, 0xAA, 0xF2, 0xA6, 0x48,
+    0xFD, 0x81, 0xE6, 0x8E, 0x7F, 0x33, 0x7A, 0x73, 0x31, 0xEB, 0x8C, 0x2B, 0x59, 0x3D, 0x95, 0xDC,
+    0x50, 0x58, 0x5F, 0x77, 0xD9, 0x89, 0x4A, 0x2B, 0xE9, 0xBD, 0x17, 0x88, 0x5F, 0xFB, 0x0C, 0xC5,
+    0x51, 0xC6, 0x1D, 0x6E, 0xFD, 0xA7, 0x52, 0x35, 0x28, 0x74, 0xBD, 0x5F, 0x64, 0xFF, 0x8C, 0xD7,
+    0x97, 0x4E, 0x18, 0xE4, 0x23, 0xD9, 0x86, 0x4B, 0x27, 0x4B, 0x29, 0xCE, 0xD5, 0xEA, 0x37, 0x64,
+    0xB4, 0x84, 0x55, 0xB0, 0x7B, 0x54, 0xE9, 0x80, 0x6E, 0xDE, 0x83, 0x4B, 0x07, 0xAD, 0x1E, 0xA6,
+    0xDB, 0x01, 0xF2, 0x01, 0xFB, 0xD9, 0xFE, 0xE3, 0xF0, 0xE6, 0x9E, 0x3F, 0x00, 0x8D, 0x55, 0xBF,
+    0x6F, 0xE5, 0x44, 0x10, 0x9E, 0xB5, 0x2F, 0xB7, 0xC5, 0x16, 0x7B, 0xC5, 0x85, 0x06, 0x88, 0xFF,
+    0x81, 0x43, 0x6E, 0x91, 0xC8, 0x7B, 0xB6, 0x44, 0x49, 0x91, 0x57, 0x90, 0xA3, 0xA0, 0xE0, 0x4F,
+    0x48, 0x73, 0x42, 0x29, 0x92, 0x67, 0xEB, 0x1A, 0x0A, 0x8A, 0x4B, 0x4F, 0x41, 0x43, 0x05, 0x45,
+    0x1A, 0x0A, 0x8A, 0xE4, 0xED, 0x92, 0xFC, 0x03, 0x2B, 0x4E, 0x88, 0x12, 0x4B, 0x97, 0x53, 0x24,
+    0x28, 0x62, 0x81, 0x91, 0x9C, 0xCB, 0xDA, 0xC3, 0x37, 0x7E, 0x77, 0x81, 0xD3, 0x09, 0x09, 0x4B,
+    0xB6, 0x76, 0xC7, 0xB3, 0xF3, 0xE3, 0x9B, 0x6F, 0x66, 0x89, 0xF0, 0xE4, 0xCC, 0x2D, 0x59, 0xE6,
+    0x0B, 0x4A, 0x1B, 0x13, 0x88, 0xBA, 0xA4, 0x23, 0xDA, 0xA6, 0x53, 0x22, 0x4D, 0x79, 0x09, 0x05,
+    0x11, 0x92, 0x08, 0x89, 0xDC, 0x78, 0x34, 0x1D, 0x80, 0xF0, 0xF9, 0x5E, 0x2B, 0x42, 0x47, 0xD0,
+    0xB4, 0x1E, 0x9A, 0x69, 0x2B, 0x9A, 0x51, 0x84, 0x85, 0x08, 0xF3, 0x1A, 0xC2, 0xCA, 0x93, 0x63,
+    0xF6, 0x54, 0xF1, 0x28, 0xA6, 0x6E, 0x1F, 0xC3, 0x3D, 0x69, 0x8E, 0xD5, 0x48, 0x54, 0x8C, 0x65,
+    0x21, 0x61, 0x88, 0x81, 0x97, 0x87, 0xFF, 0x6B, 0xC3, 0x47, 0xB2, 0x61, 0x6E, 0x64, 0xB3, 0xEB,
+    0xFC, 0xF4, 0x67, 0x98, 0xD4, 0x74, 0x33, 0x6D, 0x8A, 0x69, 0x93, 0xB6, 0xD3, 0x66, 0x39, 0x6D,
+    0x6C, 0x90, 0x8D, 0xEE, 0x93, 0x2E, 0x61, 0x1E, 0x13, 0x8E, 0xF8, 0x22, 0x1E, 0xFF, 0x4F, 0x30,
+    0x39, 0x37, 0x08, 0xA6, 0x21, 0xC9, 0x83, 0xC4, 0x17, 0xB2, 0xA0, 0xC9, 0xF5, 0xAD, 0x80, 0x91,
+    0x78, 0xC1, 0x5C, 0xDA, 0x9F, 0xF7, 0x3A, 0x08, 0x1C, 0x34, 0xAC, 0x2F, 0x10, 0x14, 0x34, 0x4E,
+    0xC5, 0x2F, 0x04, 0x39, 0x04, 0x7B, 0x5E, 0xD2, 0xE5, 0xDB, 0x6C, 0x37, 0x17, 0x04, 0x5F, 0x9D,
+    0x60, 0x26, 0x41, 0x23, 0x64, 0x52, 0x63, 0xD2, 0x90, 0x69, 0xDF, 0x85, 0x07, 0x28, 0x25, 0x3D,
+    0xB4, 0x32, 0xAF, 0x76, 0x1F, 0x46, 0x71, 0xE0, 0x91, 0x5D, 0x9C, 0x24, 0x44, 0xAA, 0x9F, 0x92,
+    0x2F, 0x11, 0xC1, 0x36, 0xD1, 0x0A, 0xE0, 0x66, 0xDE, 0xD5, 0xA6, 0x83, 0xCA, 0x00, 0x00, 0x01,
+    0x9D, 0xFA, 0x78, 0xED, 0x65, 0xA3, 0x84, 0x83, 0x00, 0xA4, 0x6B, 0xCD, 0x41, 0x89, 0x05, 0xEB,
+    0x15, 0x92, 0xF4, 0x02, 0x0F, 0xA5, 0x11, 0xC1, 0xAD, 0x10, 0x07, 0x70, 0x46, 0x52, 0xB6, 0xB1,
+    0x1E, 0xB5, 0x51, 0x31, 0x6D, 0x6D, 0x90, 0x34, 0x87, 0x4F, 0x5A, 0xC9, 0xB4, 0x10, 0xC7, 0x90,
+    0x49, 0x75, 0x49, 0x7E, 0x7A, 0xF9, 0x19, 0xD3, 0x6E, 0xFA, 0x49, 0x70, 0xA7, 0xE5, 0xA4, 0xA7,
+    0x14, 0x08, 0xA4, 0x3D, 0x0C, 0xC0, 0xAC, 0x2B, 0xF1, 0x01, 0xC6, 0xBD, 0x1A, 0xC8, 0x0D, 0x24,
+    0x91, 0x01, 0x25, 0xCD, 0xFD, 0xAB, 0xB8, 0x5E, 0x3E, 0xCA, 0x49, 0x50, 0x42, 0xB2, 0xA2, 0xCE,
+    0x4A, 0x44, 0x93, 0xC9, 0xC1, 0x37, 0x3F, 0x95, 0x7C, 0xF2, 0x0B, 0xF0, 0xCE, 0xC0, 0x0E, 0x29,
+    0xF9, 0xA4, 0x2D, 0x64, 0xA6, 0xC1, 0xC7, 0x7A, 0x7C, 0x26, 0x03, 0x0E, 0x7A, 0x09, 0x4E, 0x00,
+    0x0E, 0xC5, 0xB1, 0x08, 0xE0, 0xD2, 0xE6, 0xDA, 0x25, 0xC2, 0x04, 0x14, 0xEC, 0x3C, 0xEA, 0x5E,
+    0x17, 0x34, 0xA7, 0x47, 0x14, 0xD7, 0x45, 0xFC, 0xCC, 0x83, 0x00, 0x54, 0xBD, 0x88, 0x92, 0x40,
+    0x5E, 0x5A, 0x7F, 0x4A, 0x05, 0x50, 0x18, 0x52, 0x1E, 0xF9, 0x9C, 0xCF, 0xA3, 0x5A, 0x28, 0xB1,
+    0x70, 0x8F, 0xE8, 0xE1, 0x5A, 0x93, 0xFB, 0xB4, 0x79, 0x4B, 0xC8, 0xA9, 0x80, 0x81, 0x01, 0x1C,
+    0x73, 0xFC, 0xEE, 0x5C, 0xA7, 0xAF, 0xB8, 0xCF, 0x3B, 0xD3, 0xAF, 0x48, 0xFF, 0x89, 0xD6, 0xF9,
+    0xD5, 0x53, 0x76, 0x4C, 0xB4, 0x3C, 0x25, 0x75, 0x0D, 0x56, 0x5F, 0xB6, 0x94, 0xEF, 0xA0, 0x11,
+    0xB2, 0x80, 0x08, 0x6E, 0x46, 0xCA, 0x10, 0xCE, 0xC6, 0x02, 0xC5, 0xE9, 0x90, 0x52, 0x6B, 0x80,
+    0xFD, 0x01, 0x45, 0xED, 0x8D, 0x3F, 0xA0, 0x5E, 0xFF, 0x76, 0x2C, 0xF4, 0xD0, 0x61, 0x0F, 0xBB,
+    0xA5, 0xF6, 0x69, 0x73, 0x40, 0x73, 0xED, 0xED, 0x19, 0x1F, 0x77, 0xBC, 0x06, 0x11, 0x7C, 0xDA,
+    0x63, 0x0E, 0xAB, 0x0D, 0xA0, 0xB0, 0xAD, 0x83, 0x55, 0x5D, 0x52, 0x1F, 0x92, 0xC0, 0xA4, 0xC3,
+    0x14, 0xD8, 0xED, 0xC6, 0x70, 0x63, 0x81, 0x32, 0x42, 0x67, 0x9F, 0xCB, 0x69, 0x2B, 0x99, 0xB7,
+    0xB6, 0xC6, 0xA2, 0x5F, 0x2F, 0xB6, 0xB0, 0x48, 0x02, 0x16, 0x33, 0x2C, 0x52, 0x8F, 0xC5, 0x3E,
+    0x16, 0xB6, 0xB4, 0x75, 0xD2, 0x52, 0x94, 0x93, 0x03, 0x48, 0xC8, 0xCF, 0xD0, 0x0B, 0xF3, 0x19,
+    0x50, 0x7B, 0x0A, 0x82, 0xCC, 0x1E, 0x80, 0xA5, 0x67, 0xC8, 0xFE, 0x1D, 0x7A, 0x85, 0x70, 0x25,
+    0x0D, 0xD4, 0x2C, 0x69, 0x28, 0x28, 0xFB, 0xBA, 0x4C, 0x6F, 0x02, 0x8D, 0x3C, 0x3D, 0x6E, 0xC2,
+    0x49, 0x66, 0x45, 0x45, 0x42, 0x8A, 0x23, 0x96, 0xAC, 0x7B, 0xDA, 0x2C, 0xE9, 0x8E, 0x9C, 0x2D,
+    0xF3, 0xBA, 0x8A, 0xBA, 0xCD, 0x9B, 0xAA, 0xCB, 0x5A, 0xD5, 0x19, 0x0F, 0x44, 0x0F, 0x8C, 0xFF,
+    0x81, 0xE8, 0x3D, 0xE3, 0x85, 0x85, 0xE6, 0x0C, 0xAE, 0xCD, 0x57, 0xBF, 0xC0, 0x9D, 0x95, 0xB9,
+    0x41, 0xD9, 0x47, 0xE7, 0x90, 0xCF, 0xCD, 0x8F, 0xB0, 0x79, 0x62, 0x7C, 0x44, 0x57, 0x18, 0xBF,
+    0x44, 0x3D, 0x8D, 0x2F, 0x4A, 0x00, 0x7C, 0x61, 0x43, 0x55, 0xBB, 0xA8, 0xFB, 0xFB, 0x62, 0x7F,
+    0x21, 0xD1, 0xB9, 0x11, 0x1C, 0x6C, 0xF6, 0x55, 0xBC, 0x23, 0x74, 0x47, 0x3C, 0x69, 0x50, 0xDF,
+    0x05, 0x2A, 0x86, 0xA9, 0xAD, 0xA4, 0xAB, 0xE6, 0x0F, 0x28, 0x7B, 0x22, 0x28, 0xBB, 0x20, 0x7D,
+    0xB3, 0x8B, 0x33, 0x31, 0xE5, 0x1B, 0xAE, 0x8B, 0x01, 0x5D, 0x36, 0x07, 0xA4, 0x36, 0xE8, 0x90,
+    0x0E, 0x58, 0xDC, 0x60, 0x31, 0x9B, 0xD1, 0xA1, 0xFD, 0x30, 0xE8, 0xA7, 0x61, 0x46, 0xCB, 0x2E,
+    0x0D, 0x3A, 0x02, 0xBF, 0x0A, 0x66, 0x01, 0xFA, 0x2C, 0xE1, 0x3A, 0x1B, 0x19, 0x24, 0x6A, 0xE9,
+    0x91, 0x6A, 0xC8, 0xD6, 0xF9, 0xD4, 0x3D, 0x94, 0xBE, 0x80, 0xBF, 0xBB, 0xD7, 0xFF, 0x1E, 0x79,
+    0x68, 0x31, 0xD7, 0xA7, 0x1C, 0x4E, 0x31, 0x69, 0x71, 0x54, 0xCC, 0x83, 0xB9, 0xC1, 0x9E, 0xD2,
+    0x21, 0x90, 0xD6, 0xA1, 0x83, 0x9F, 0x19, 0xAC, 0x5E, 0x95, 0x33, 0xE9, 0xDD, 0xA0, 0x5B, 0xF8,
+    0x39, 0x84, 0x9F, 0xBC, 0x57, 0x7C, 0xC5, 0xA1, 0x90, 0xCE, 0xBC, 0xE7, 0x62, 0xD2, 0xBB, 0xDE,
+    0xF4, 0x26, 0x64, 0x25, 0x62, 0x43, 0xE5, 0xF7, 0xF1, 0xB6, 0x20, 0x5E, 0x98, 0xA6, 0x98, 0xFE,
+    0xA9, 0xC3, 0x3E, 0xE2, 0x5D, 0xE2, 0x2D, 0xA0, 0x83, 0xAE, 0xED, 0x75, 0xCB, 0x03, 0x7A, 0x94,
+    0xE8, 0xBE, 0x54, 0xB9, 0x06, 0xAB, 0x82, 0x42, 0x13, 0x10, 0x28, 0x45, 0xE0, 0x14, 0x69, 0x90,
+    0x4A, 0x49, 0x8F, 0x7D, 0x0F, 0xC1, 0x36, 0x04, 0x16, 0x9E, 0x35, 0x5A, 0x4D, 0xB2, 0xFC, 0x00,
+    0xB5, 0xCA, 0x30, 0x3E, 0x2F, 0x31, 0x7B, 0xE2, 0x42, 0x66, 0x23, 0xDC, 0x8D, 0x76, 0xA4, 0x94,
+    0x31, 0xE1, 0x15, 0xD3, 0x56, 0x47, 0x37, 0x5E, 0x1F, 0xD3, 0xE7, 0xAD, 0x7A, 0x16, 0xB6, 0x4F,
+    0x68, 0xFF, 0x64, 0x2B, 0xA7, 0x2D, 0xBB, 0x63, 0xBC, 0x7E, 0x7C, 0xF9, 0xB8, 0x55, 0x4D, 0xE5,
+    0x21, 0xB4, 0x0D, 0x84, 0x0A, 0x95, 0xD3, 0xF5, 0xFB, 0x49, 0x6B, 0x46, 0x50, 0xF5, 0x4B, 0x99,
+    0x78, 0xAD, 0x1B, 0x34, 0xFF, 0xC1, 0x6D, 0xC6, 0x25, 0x5A, 0xAA, 0x81, 0xF3, 0xAC, 0x46, 0x14,
+    0x4B, 0xF0, 0x1A, 0xD5, 0x5A, 0xEE, 0x7E, 0xDA, 0x28, 0x89, 0x59, 0x3F, 0xDF, 0x5D, 0xAD, 0x45,
+    0x87, 0xAF, 0x69, 0x39, 0x50, 0xEC, 0x09, 0x37, 0x15, 0xD0, 0x51, 0xE5, 0x54, 0x7E, 0x4C, 0x48,
+    0xB4, 0x7F, 0xD6, 0xE2, 0x26, 0xE8, 0xE6, 0x18, 0xB1, 0xB8, 0xCB, 0xE2, 0x09, 0x5E, 0xB4, 0x43,
+    0x04, 0x06, 0x51, 0xF6, 0x0E, 0x4C, 0x28, 0x70, 0x31, 0xE4, 0xC1, 0x34, 0x76, 0x74, 0x75, 0x82,
+    0xD1, 0x25, 0x3C, 0x05, 0x32, 0xFC, 0x3B, 0xDE, 0x6B, 0xD3, 0xE0, 0x12, 0x3B, 0xC4, 0x9D, 0x06,
+    0x27, 0xFF, 0x6B, 0x91, 0x70, 0xC8, 0x07, 0x1E, 0xA6, 0x9B, 0x64, 0x83, 0xEE, 0x76, 0x55, 0x6F,
+    0x46, 0xC7, 0x7E, 0x6F, 0x78, 0xBB, 0x4F, 0xBB, 0xF5, 0x95, 0x11, 0x70, 0x65, 0xF4, 0x18, 0xAC,
+    0x4B, 0x10, 0x24, 0xAB, 0xA5, 0x46, 0x10, 0xC8, 0xA4, 0x15, 0xC6, 0xAC, 0xC0, 0x08, 0x27, 0x97,
+    0x00, 0xA8, 0x3F, 0xBC, 0x79, 0x0F, 0xE9, 0xBF, 0xC0, 0x5F, 0xB0, 0xEC, 0xEE, 0xB7, 0xDF, 0xD0,
+    0x94, 0x69, 0x3E, 0x42, 0x19, 0x39, 0x0E, 0x39, 0x65, 0x3B, 0x75, 0xFA, 0x45, 0x80, 0xA9, 0xE9,
+    0x48, 0x31, 0xDD, 0xD9, 0x18, 0x8F, 0x54, 0xA1, 0xF7, 0xAF, 0x69, 0x81, 0x61, 0x20, 0x5D, 0xB8,
+    0xB1, 0xA0, 0xD7, 0x9F, 0xBF, 0x01, 0x9D, 0x55, 0xBF, 0x73, 0xDD, 0x44, 0x10, 0x5E, 0xE9, 0xC6,
+    0xB9, 0x21, 0x2A, 0xE4, 0x22, 0x19, 0x7E, 0xCD, 0xA0, 0x9A, 0x26, 0x6A, 0x28, 0x98, 0xC1, 0x7E,
+    0x77, 0xD4, 0x29, 0x70, 0x81, 0x87, 0xD2, 0xFC, 0x07, 0xA6, 0xA4, 0xF0, 0x7B, 0x52, 0x6A, 0x8A,
+    0xA4, 0x81, 0x16, 0x37, 0x34, 0x6E, 0xC2, 0x1F, 0xF0, 0x1C, 0x1D, 0x50, 0x50, 0x72, 0x81, 0x82,
+    0x22, 0x05, 0x62, 0x30, 0x95, 0x0B, 0xDF, 0x80, 0x32, 0x73, 0xC6, 0x7A, 0x6F, 0xF9, 0xF6, 0xF4,
+    0x0C, 0x19, 0x26, 0x19, 0x18, 0xF4, 0x9E, 0x4E, 0xA7, 0xBD, 0xDB, 0xD5, 0xEE, 0xB7, 0xDF, 0xEE,
+    0x75, 0xCC, 0xBF, 0x33, 0xF3, 0x77, 0x9F, 0x5D, 0x1E, 0xEC, 0x68, 0xBF, 0x13, 0x2A, 0xFB, 0x9B,
+    0x9B, 0x2B, 0x9B, 0x0D, 0x44, 0xDA, 0x13, 0x55, 0x96, 0x68, 0x4E, 0xF4, 0xCC, 0xEB, 0x0D, 0x0E,
+    0xD4, 0xB0, 0xA7, 0x66, 0xAD, 0xF8, 0x5B, 0xF6, 0x75, 0x2C, 0x3D, 0xCD, 0x68, 0x41, 0x85, 0x53,
+    0x81, 0x22, 0xD5, 0xB6, 0x22, 0x1A, 0xF3, 0x80, 0xF7, 0x5D, 0xA2, 0x59, 0xE1, 0x48, 0x05, 0x28,
+    0x57, 0x07, 0x44, 0xF4, 0x47, 0x4F, 0x54, 0x8C, 0x98, 0x98, 0x96, 0x08, 0x5B, 0xB0, 0x8E, 0x5B,
+    0x3B, 0x0C, 0xD8, 0xF2, 0xD1, 0x82, 0xA8, 0x64, 0xAC, 0x30, 0xB6, 0xDD, 0xC0, 0x8D, 0xEB, 0x16,
+    0x6D, 0x34, 0x2A, 0x19, 0x68, 0xF9, 0x82, 0xA1, 0xE6, 0x48, 0x39, 0xA2, 0x68, 0xCB, 0xB3, 0x65,
+    0xDD, 0xD7, 0x76, 0xA9, 0x86, 0x19, 0x2D, 0xB3, 0xF1, 0x14, 0xAB, 0xE3, 0x12, 0xC3, 0x72, 0xFC,
+    0x6B, 0x48, 0xB2, 0x05, 0x86, 0x68, 0xB0, 0x2F, 0x54, 0x67, 0xCB, 0xCA, 0x6B, 0xE8, 0x5A, 0x44,
+    0x35, 0xBC, 0xE0, 0x1B, 0xA7, 0x24, 0xAE, 0xC1, 0xA5, 0x9B, 0x27, 0x0F, 0xC8, 0xAC, 0x35, 0xDF,
+    0xE7, 0x77, 0xD9, 0x37, 0x54, 0xB6, 0x3A, 0x94, 0x2D, 0x2D, 0x8A, 0x96, 0x8A, 0x1F, 0x11, 0x46,
+    0x87, 0x1B, 0x70, 0x90, 0x86, 0xB7, 0xEA, 0x27, 0x84, 0xFE, 0x78, 0x24, 0xD5, 0xD7, 0xAD, 0x0A,
+    0x6A, 0x28, 0xD6, 0x19, 0x3F, 0xE1, 0xC7, 0x1C, 0xBB, 0x55, 0xC1, 0xDF, 0x73, 0x5F, 0xAF, 0x61,
+    0xB6, 0x74, 0x40, 0xD6, 0x08, 0xB4, 0x23, 0xB0, 0x05, 0x80, 0xF3, 0x7F, 0x13, 0x75, 0x70, 0xF5,
+    0x3E, 0x6E, 0x16, 0xBF, 0x04, 0x94, 0x84, 0xA3, 0x06, 0x6C, 0xF4, 0x86, 0x88, 0xDE, 0x4A, 0xB8,
+    0x75, 0x63, 0xC5, 0x87, 0xF0, 0xB3, 0x3D, 0xA5, 0x1A, 0x29, 0x29, 0x5C, 0xE1, 0xF3, 0x90, 0x0F,
+    0x88, 0x66, 0x01, 0x41, 0xF9, 0xF4, 0xD0, 0x11, 0x23, 0x8F, 0x5B, 0x5F, 0x24, 0xF4, 0x04, 0x64,
+    0x37, 0x59, 0x2A, 0x90, 0xD9, 0x82, 0x63, 0x33, 0x9A, 0x68, 0x56, 0x4D, 0x34, 0x83, 0x89, 0x85,
+    0x87, 0xBA, 0xD3, 0xEE, 0x7F, 0x8D, 0x49, 0xB7, 0x16, 0x7F, 0x57, 0x9C, 0xC6, 0xC9, 0x72, 0xB5,
+    0x2E, 0x57, 0xA5, 0x00, 0x20, 0xC9, 0xA9, 0xC4, 0x47, 0x9A, 0x14, 0xB2, 0x00, 0x3F, 0x03, 0x1D,
+    0xFD, 0xA7, 0x85, 0x64, 0xBC, 0x48, 0x76, 0x13, 0x24, 0x1C, 0xE8, 0x1A, 0x15, 0xA2, 0x3B, 0x69,
+    0x2C, 0x04, 0x18, 0xCA, 0x3C, 0xFD, 0x8D, 0x0D, 0xD0, 0xE1, 0x91, 0x0C, 0xAF, 0xA8, 0xFC, 0x34,
+    0x92, 0x72, 0xE0, 0xA0, 0x24, 0xF1, 0x15, 0x25, 0x94, 0x03, 0x87, 0xC8, 0x5C, 0x8C, 0xC8, 0x6C,
+    0x6D, 0x55, 0x0F, 0x51, 0xC4, 0x6F, 0x26, 0x39, 0x68, 0x0D, 0x68, 0xC6, 0xB6, 0xE6, 0xF5, 0x64,
+    0x63, 0x4D, 0x15, 0xF2, 0xE9, 0x33, 0x06, 0x40, 0xF2, 0x4D, 0x54, 0x49, 0xE9, 0xF4, 0x33, 0x53,
+    0x7C, 0x60, 0x14, 0x4E, 0x89, 0xB4, 0x74, 0x22, 0x9D, 0xCB, 0x54, 0x7B, 0x99, 0x1E, 0xC9, 0xB4,
+    0x72, 0x23, 0x58, 0x1B, 0x9A, 0x91, 0x39, 0x96, 0xEC, 0xAF, 0xED, 0xA6, 0x1C, 0xF8, 0x54, 0x77,
+    0x7A, 0xF3, 0xC0, 0x47, 0x9B, 0x8B, 0x08, 0x3B, 0x7E, 0x4E, 0xBB, 0xDA, 0x2B, 0x3C, 0xE6, 0x78,
+    0xFB, 0x9A, 0xBB, 0x01, 0xBA, 0x9B, 0x52, 0xC9, 0x39, 0x2A, 0xE6, 0xAF, 0x7A, 0x1D, 0xB7, 0xC1,
+    0x16, 0x31, 0x91, 0xC5, 0xFC, 0xE4, 0x91, 0xC4, 0x74, 0xFB, 0x83, 0x3E, 0xD5, 0xF0, 0xF2, 0x4B,
+    0x32, 0x88, 0xE3, 0x2E, 0x02, 0xE9, 0xD8, 0x66, 0xEF, 0x27, 0xCD, 0xCC, 0xE6, 0x3C, 0xE0, 0x5F,
+    0x70, 0x6B, 0x30, 0x19, 0xD4, 0xA0, 0x03, 0x9C, 0xB3, 0x45, 0x5F, 0x59, 0x20, 0x81, 0x76, 0x10,
+    0xC8, 0x64, 0x97, 0x87, 0x2D, 0x2D, 0xC5, 0x91, 0x7C, 0xA8, 0x4E, 0x22, 0x08, 0x23, 0xE2, 0x3A,
+    0x43, 0x78, 0x34, 0x6A, 0x5F, 0x5B, 0xD1, 0x68, 0xAC, 0xC9, 0xD9, 0x77, 0xE7, 0xC1, 0xB0, 0x6D,
+    0x12, 0x43, 0x6F, 0xA3, 0x7F, 0xBC, 0x06, 0x24, 0x3A, 0x8E, 0xF9, 0xA0, 0x9D, 0xEA, 0x71, 0xFB,
+    0xCD, 0x33, 0x6A, 0x61, 0xA1, 0x03, 0xAC, 0x8E, 0x0C, 0xE6, 0x73, 0x2D, 0xA6, 0x5C, 0x1E, 0x90,
+    0xF1, 0xFE, 0x70, 0x55, 0xB7, 0xBC, 0xBE, 0x2D, 0x36, 0x90, 0x42, 0x84, 0x68, 0x2C, 0x69, 0xE4,
+    0xB7, 0x41, 0x65, 0x21, 0x51, 0xDB, 0xC9, 0xF3, 0x2D, 0xBC, 0x03, 0x19, 0xEE, 0x17, 0xB4, 0x32,
+    0x54, 0x7D, 0x6E, 0xD5, 0x95, 0xA7, 0x75, 0xA2, 0x02, 0x77, 0x89, 0xD4, 0xE0, 0xBC, 0xA8, 0x94,
+    0x31, 0x7B, 0xC0, 0x12, 0x61, 0x14, 0x8F, 0x32, 0x7B, 0x4B, 0xC5, 0xDA, 0xAD, 0x8B, 0x50, 0x49,
+    0xE3, 0x99, 0xAE, 0x3D, 0xA0, 0xDC, 0x23, 0x3E, 0xDD, 0x97, 0x3F, 0x84, 0xEC, 0x12, 0x05, 0x87,
+    0xF2, 0xBC, 0x48, 0xA6, 0xAE, 0x42, 0xEA, 0x03, 0xF5, 0xE4, 0x01, 0xB7, 0xAF, 0x96, 0x09, 0xBF,
+    0x56, 0xF0, 0xDB, 0x9B, 0x1A, 0x94, 0x96, 0x68, 0x01, 0x05, 0x29, 0x69, 0x76, 0x88, 0x2A, 0xEF,
+    0x4E, 0x8E, 0x27, 0x81, 0x90, 0x72, 0xAC, 0xCE, 0xC8, 0x34, 0x6C, 0x4B, 0x7E, 0x18, 0xD4, 0x48,
+    0x6B, 0xA9, 0x6D, 0x67, 0xB0, 0x86, 0x1D, 0x2B, 0xC1, 0x11, 0x40, 0x17, 0xDE, 0xC0, 0x5D, 0x08,
+    0x4E, 0x45, 0xA0, 0xD9, 0x95, 0xDF, 0x70, 0x48, 0xDA, 0x71, 0xD3, 0x82, 0x0C, 0x25, 0x27, 0xA8,
+    0x69, 0x29, 0x03, 0x66, 0x74, 0x07, 0x73, 0xB2, 0xC9, 0xB7, 0x26, 0x01, 0x84, 0xC5, 0x12, 0xE1,
+    0x5D, 0x87, 0x04, 0xBE, 0x3E, 0x41, 0xD4, 0xF5, 0xBD, 0x23, 0x70, 0x25, 0x1B, 0x94, 0x9B, 0xD3,
+    0x31, 0x3A, 0x38, 0x48, 0x25, 0x5C, 0x98, 0xA7, 0x76, 0x3E, 0xBD, 0x4C, 0xD4, 0x11, 0x2A, 0x40,
+    0xA9, 0x6D, 0x1E, 0xC6, 0x19, 0x35, 0x86, 0x8A, 0xFB, 0x96, 0xEE, 0x02, 0xC3, 0xA7, 0xFB, 0x96,
+    0xB9, 0x37, 0x27, 0xC7, 0x02, 0x68, 0x4C, 0x7E, 0x94, 0x91, 0x3E, 0x04, 0xF3, 0x04, 0xD0, 0xAD,
+    0xBD, 0x0D, 0xF9, 0xCA, 0xF3, 0xB1, 0xA6, 0xE5, 0x8C, 0x76, 0x0C, 0x6D, 0xD7, 0x3D, 0xA1, 0xBE,
+    0x15, 0x7A, 0x66, 0x83, 0xD6, 0x3C, 0xBE, 0x4D, 0xF3, 0x1D, 0xDA, 0x45, 0x4F, 0x36, 0xE7, 0x43,
+    0x8D, 0xA2, 0x49, 0xC4, 0x33, 0x56, 0x47, 0x1C, 0x05, 0xD9, 0xF1, 0xB5, 0xBF, 0xAF, 0x0F, 0x9A,
+    0xAD, 0x1E, 0xE0, 0x56, 0xF6, 0xDC, 0x21, 0xEB, 0xA2, 0x61, 0xF7, 0x12, 0xED, 0xAD, 0xCA, 0x5F,
+    0x06, 0xF3, 0x49, 0x7B, 0x74, 0xAD, 0x98, 0x75, 0xB6, 0x5A, 0x11, 0x34, 0x11, 0x0D, 0x62, 0x9A,
+    0x4B, 0x48, 0xFF, 0x9C, 0xDE, 0x40, 0x04, 0x02, 0x1A, 0x80, 0x2F, 0x86, 0x7C, 0xA4, 0x37, 0x37,
+    0xBA, 0x39, 0x2B, 0x76, 0x2F, 0x07, 0x64, 0xC4, 0x20, 0x5F, 0xEA, 0xF9, 0x93, 0x99, 0x9C, 0x6B,
+    0xAE, 0xF6, 0x8D, 0xBF, 0x69, 0xA7, 0x93, 0x06, 0x55, 0x0A, 0x5A, 0x53, 0x16, 0x24, 0x21, 0x82,
+    0x2C, 0x30, 0x11, 0x54, 0xE9, 0x63, 0xA9, 0xD9, 0xAC, 0xAF, 0x70, 0x98, 0x14, 0xB6, 0x79, 0x38,
+    0xD0, 0x4E, 0x86, 0x7A, 0xA2, 0x20, 0xDD, 0x4A, 0xB7, 0x15, 0x8E, 0xC7, 0x5D, 0x78, 0xB5, 0x7C,
+    0x27, 0x40, 0xFC, 0x33, 0xFA, 0xC9, 0x15, 0xEB, 0x01, 0xD8, 0xFB, 0xAD, 0x4D, 0xE3, 0x2E, 0xC0,
+    0x1D, 0xB8, 0xBA, 0xA6, 0x74, 0x3C, 0x50, 0xEA, 0xFC, 0x53, 0xEB, 0x9F, 0x8E, 0x03, 0x5A, 0xEC,
+    0x1F, 0xF0, 0x59, 0x26, 0xBC, 0x8C, 0xFA, 0xD7, 0xFD, 0x51, 0x0D, 0x22, 0x56, 0xBD, 0x1C, 0x13,
+    0xE5, 0x3D, 0xD9, 0x3D, 0x93, 0xDD, 0x2A, 0x74, 0x03, 0x78, 0xF8, 0x1E, 0x7B, 0xE6, 0x9E, 0x5E,
+    0x7C, 0xFD, 0x09, 0xA5, 0x55, 0xBD, 0x8E, 0xE4, 0x44, 0x10, 0x2E, 0x77, 0x2F, 0xDB, 0x27, 0x2C,
+    0xD1, 0x04, 0x5C, 0x74, 0x81, 0x73, 0x24, 0xE4, 0x17, 0xB8, 0xD9, 0xB6, 0x44, 0x48, 0x32, 0xC9,
+    0x24, 0x3C, 0x02, 0x01, 0x4B, 0x70, 0xC1, 0x05, 0x37, 0x63, 0x8B, 0x27, 0xE0, 0x11, 0x08, 0x88,
+    0x16, 0x44, 0x8E, 0x34, 0x73, 0x6E, 0x22, 0x02, 0x12, 0x8B, 0x13, 0xD1, 0x25, 0x46, 0x80, 0x00,
+    0x21, 0xB4, 0xE6, 0xE8, 0x15, 0xBE, 0x3D, 0x7B, 0x8A, 0xAF, 0xDA, 0x9E, 0xB9, 0x91, 0x20, 0x38,
+    0x09, 0x8F, 0xBA, 0xA7, 0xBB, 0xBA, 0x5D, 0x3F, 0x5F, 0x7D, 0x55, 0xA6, 0x25, 0x11, 0xD5, 0x9E,
+    0xC8, 0x30, 0x16, 0x34, 0x60, 0xE8, 0x40, 0x94, 0x30, 0x0F, 0xA4, 0xEA, 0xAB, 0x4F, 0x67, 0x51,
+    0x87, 0xC9, 0x7E, 0x5D, 0x17, 0xE4, 0x1C, 0x7B, 0xE2, 0x5B, 0x2E, 0xF4, 0x48, 0x35, 0x59, 0x8F,
+    0x63, 0x27, 0xC7, 0x03, 0xD6, 0xF8, 0x73, 0xFF, 0x25, 0x2A, 0x07, 0xC5, 0x4F, 0xB8, 0xCB, 0xB9,
+    0x20, 0x3A, 0x83, 0xA2, 0x0B, 0x8C, 0x72, 0x32, 0x26, 0x8A, 0x0D, 0xAC, 0x2B, 0x3A, 0x3C, 0x6F,
+    0xD6, 0x83, 0xEA, 0xEB, 0x3E, 0xED, 0xD3, 0x26, 0x2B, 0x4C, 0xB3, 0x20, 0xD3, 0x3C, 0xC4, 0xE8,
+    0xC8, 0xFC, 0xD2, 0xC0, 0xC9, 0x96, 0xCC, 0x77, 0x01, 0xFB, 0x01, 0x63, 0x83, 0xE1, 0x70, 0xC7,
+    0xFA, 0xBC, 0x37, 0x1D, 0x8F, 0xC9, 0x88, 0xF7, 0xDF, 0xA2, 0x3B, 0xE2, 0x70, 0x8B, 0xC9, 0xC1,
+    0x5E, 0x94, 0x99, 0xE8, 0x7E, 0x15, 0x4F, 0x8F, 0x4F, 0xCA, 0xDE, 0x71, 0xDD, 0x6B, 0x6E, 0x76,
+    0xB8, 0x6E, 0x1A, 0x1A, 0x69, 0x4D, 0xAE, 0x81, 0xBA, 0x1D, 0xAD, 0xF5, 0x13, 0x2C, 0xC2, 0x82,
+    0xD6, 0x0B, 0xDD, 0x98, 0xEB, 0x62, 0x41, 0xA5, 0xC7, 0xA2, 0x23, 0x48, 0x48, 0x37, 0x79, 0x9F,
+    0xF0, 0x35, 0x37, 0x8E, 0xA9, 0xD5, 0x15, 0xE5, 0x90, 0xAA, 0x90, 0x7A, 0xB2, 0x2F, 0x7A, 0xA2,
+    0x7B, 0xBF, 0xBE, 0x34, 0x01, 0x77, 0xDD, 0x50, 0x8E, 0x8A, 0xAB, 0x51, 0x4C, 0xB4, 0xB4, 0x15,
+    0x80, 0x2A, 0x15, 0x92, 0x0E, 0xD8, 0xE4, 0x44, 0x5B, 0xDD, 0xE0, 0x60, 0x0B, 0x57, 0x6D, 0x41,
+    0xC9, 0x0D, 0xDC, 0xB4, 0x5F, 0xCE, 0xF9, 0xD0, 0xD0, 0x05, 0xD5, 0x73, 0x28, 0x8F, 0x24, 0x80,
+    0x82, 0x0C, 0x74, 0x10, 0xE3, 0xC4, 0xEE, 0x21, 0xF8, 0x50, 0x6C, 0xD4, 0x63, 0xCA, 0x4F, 0xB9,
+    0x02, 0x62, 0x0D, 0x00, 0x5D, 0x43, 0xAF, 0x79, 0xC5, 0x85, 0x62, 0xE6, 0x11, 0x03, 0x98, 0x8A,
+    0x9D, 0x44, 0x40, 0xCA, 0x44, 0xA5, 0x2C, 0xDE, 0x90, 0x85, 0x70, 0xE3, 0x83, 0x2B, 0xA0, 0x98,
+    0x71, 0x23, 0x78, 0x8A, 0x0C, 0xF9, 0xA5, 0xB7, 0x3F, 0xBF, 0xBD, 0xAA, 0x32, 0xBC, 0xD9, 0x99,
+    0x9F, 0xCB, 0xD5, 0x36, 0x69, 0xAD, 0xB7, 0xF4, 0x40, 0x77, 0xDA, 0xDF, 0x81, 0xFE, 0xE2, 0x70,
+    0xF3, 0x7B, 0xBC, 0xAF, 0x45, 0x3D, 0xE1, 0xAA, 0x08, 0xB3, 0x76, 0xA2, 0x47, 0x64, 0x45, 0xE4,
+    0xC7, 0xC4, 0x14, 0xEB, 0x55, 0x8F, 0x7F, 0x33, 0x20, 0x29, 0x1C, 0xA7, 0x9F, 0x66, 0x04, 0xEF,
+    0x02, 0x44, 0x84, 0x9A, 0xEE, 0x67, 0xDA, 0xCC, 0xA3, 0x66, 0xF6, 0xD0, 0xE9, 0xBB, 0x0B, 0x2D,
+    0xA3, 0x3A, 0x9E, 0x39, 0x38, 0xEA, 0xA0, 0xE2, 0x82, 0x1E, 0x63, 0xB8, 0x79, 0xC8, 0x6F, 0xA7,
+    0xF8, 0xBA, 0x87, 0xE6, 0x4F, 0x26, 0xC5, 0xEF, 0x17, 0x92, 0x1E, 0x30, 0x32, 0xDD, 0xD7, 0x70,
+    0x24, 0x00, 0xF3, 0x14, 0x1C, 0xEB, 0x85, 0x2A, 0xA5, 0x54, 0x80, 0x6D, 0x41, 0x4F, 0x35, 0x08,
+    0x4F, 0xCB, 0x1C, 0xD4, 0xC9, 0xBE, 0x15, 0xA8, 0x9E, 0xC9, 0x34, 0x3C, 0x16, 0x4B, 0x39, 0x80,
+    0xC8, 0xBE, 0xC1, 0xF5, 0xB4, 0x1D, 0x85, 0xC8, 0xD8, 0xAB, 0x41, 0x0F, 0x94, 0x0C, 0x54, 0x36,
+    0x6A, 0x14, 0xED, 0x90, 0xE7, 0x92, 0x2D, 0x5A, 0x15, 0x02, 0x30, 0xA6, 0x7A, 0x2F, 0x88, 0x78,
+    0xDB, 0x64, 0x1D, 0x22, 0x07, 0xC1, 0x92, 0x1E, 0xD9, 0x1F, 0x76, 0xAB, 0xD5, 0x20, 0x8A, 0x47,
+    0xFC, 0xEF, 0xB0, 0x87, 0x81, 0xDE, 0x91, 0xEA, 0xF2, 0x26, 0x6D, 0xED, 0xBE, 0xAE, 0x94, 0xA8,
+    0xBA, 0x5B, 0x44, 0xCF, 0xCF, 0xDF, 0x43, 0x7C, 0x66, 0x2C, 0xF7, 0x05, 0x81, 0x82, 0xB0, 0xF0,
+    0x05, 0xA8, 0x02, 0x92, 0x64, 0x9E, 0xB6, 0x33, 0xA8, 0xA0, 0x42, 0x90, 0x12, 0xCB, 0xC5, 0x2F,
+    0x29, 0xB1, 0x1C, 0x0C, 0x86, 0x4A, 0xA9, 0x34, 0xEB, 0x71, 0x8B, 0x76, 0x20, 0x13, 0xE9, 0x1F,
+    0xBA, 0x18, 0x88, 0xF8, 0xF6, 0xB7, 0x24, 0xD8, 0x0E, 0x91, 0x51, 0x52, 0x28, 0x26, 0xD0, 0x21,
+    0xE3, 0xF3, 0x93, 0x48, 0xF1, 0x8D, 0xE5, 0x48, 0x0E, 0xF1, 0xA6, 0x7F, 0x80, 0x89, 0x41, 0x52,
+    0x0A, 0xEA, 0x83, 0xC4, 0xB6, 0xBA, 0x0F, 0xDB, 0x69, 0x85, 0x8A, 0xC4, 0x8B, 0x17, 0xA0, 0x91,
+    0x7A, 0x86, 0xBC, 0x5B, 0xE1, 0x2D, 0xFB, 0x59, 0xDD, 0xA9, 0x36, 0x3C, 0x0B, 0x61, 0x75, 0xD2,
+    0x2B, 0x1C, 0xE9, 0xE7, 0x97, 0xD2, 0x04, 0x22, 0x56, 0xA7, 0x35, 0x1A, 0xDD, 0xE1, 0x22, 0xE3,
+    0x3F, 0x39, 0x50, 0xBE, 0x17, 0x0D, 0x91, 0x40, 0x13, 0x6D, 0xF4, 0xC4, 0x20, 0x21, 0x93, 0xE6,
+    0xD8, 0x76, 0x5C, 0x8C, 0x57, 0xC4, 0x4E, 0x38, 0xA6, 0x3B, 0xB9, 0xED, 0xE4, 0xFC, 0xAF, 0xD8,
+    0x8F, 0x38, 0x52, 0x4F, 0x08, 0x47, 0x3C, 0x2B, 0x99, 0x10, 0xD3, 0x41, 0xC1, 0x42, 0xCD, 0xE0,
+    0x8F, 0xE1, 0x88, 0x82, 0x54, 0xDA, 0x54, 0x80, 0x00, 0x4E, 0x26, 0xED, 0x65, 0x7E, 0x27, 0x0A,
+    0x3E, 0x22, 0x7A, 0x90, 0xB4, 0x40, 0x5D, 0xAA, 0xDE, 0x8B, 0x57, 0xBF, 0x23, 0x8A, 0xF3, 0xE7,
+    0x27, 0x6E, 0xE7, 0x4C, 0x3C, 0xC4, 0xF6, 0x92, 0x17, 0x50, 0x80, 0xA2, 0x6B, 0x92, 0x40, 0x5C,
+    0xC4, 0xFE, 0x92, 0x15, 0x21, 0xD0, 0xDA, 0xBE, 0x0B, 0x51, 0xB0, 0x45, 0x6C, 0x30, 0x59, 0x07,
+    0x3C, 0x4B, 0x34, 0x17, 0xDC, 0xB2, 0x85, 0x74, 0x98, 0x1F, 0x39, 0x58, 0xC1, 0x2E, 0x12, 0x5B,
+    0x12, 0x4A, 0xA9, 0x64, 0xE6, 0xBE, 0xEC, 0xDA, 0xA3, 0x1D, 0xC5, 0x7B, 0xA9, 0xCF, 0x6A, 0xAA,
+    0xCC, 0xD8, 0x53, 0x85, 0xD6, 0x8E, 0xC3, 0x4B, 0x09, 0x02, 0xFF, 0x4D, 0x8A, 0x70, 0x44, 0x4D,
+    0x5E, 0x06, 0x48, 0x72, 0x1F, 0x61, 0x44, 0xA9, 0xA1, 0x79, 0xD2, 0x2E, 0x62, 0x80, 0x22, 0x84,
+    0x24, 0xA9, 0x63, 0x71, 0xB9, 0x63, 0xA1, 0x2C, 0x63, 0x3B, 0x8A, 0x5F, 0x87, 0xB9, 0x5F, 0x5B,
+    0xD9, 0xEE, 0x61, 0xB3, 0x3F, 0x6C, 0x63, 0x66, 0x67, 0xCB, 0x16, 0xDF, 0x06, 0x41, 0x7C, 0x40,
+    0x73, 0xEB, 0x12, 0x24, 0x20, 0x05, 0x3E, 0x1B, 0xC3, 0x75, 0xE7, 0x84, 0xC4, 0xF2, 0xAC, 0x96,
+    0x62, 0xA3, 0x2A, 0x6F, 0xEB, 0x20, 0x45, 0x2F, 0x9F, 0x0A, 0x8C, 0xDD, 0x34, 0x96, 0x18, 0x1D,
+    0xF6, 0x5F, 0xF5, 0xBA, 0x73, 0x9D, 0x14, 0x8B, 0xE6, 0x17, 0xF8, 0x8E, 0xA8, 0x06, 0xE7, 0x91,
+    0xCC, 0xA7, 0x23, 0x47, 0xE0, 0x1C, 0x41, 0x7A, 0x8D, 0xCE, 0x43, 0xD9, 0xA3, 0x9A, 0xD9, 0x5F,
+    0x8E, 0xF7, 0x7A, 0x94, 0x70, 0x2D, 0x61, 0xA1, 0x42, 0x54, 0x0F, 0x17, 0x37, 0xB8, 0x9D, 0x55,
+    0xC3, 0x19, 0xBE, 0x18, 0xE6, 0x63, 0x78, 0x15, 0x60, 0x02, 0x89, 0x40, 0x6F, 0x06, 0x54, 0x0C,
+    0x80, 0x58, 0xBE, 0x55, 0x0F, 0xF1, 0xCA, 0xEB, 0x31, 0x1A, 0x89, 0xCA, 0xDC, 0x08, 0xB2, 0x1D,
+    0x9D, 0x5F, 0x7D, 0x76, 0xC8, 0xBA, 0x6A, 0x62, 0x1F, 0xA6, 0x0D, 0x02, 0xB8, 0x41, 0xC5, 0x42,
+    0x7D, 0x72, 0x82, 0xCB, 0x11, 0x88, 0x57, 0xD9, 0x2A, 0x10, 0xCD, 0xB1, 0x94, 0xE0, 0xD9, 0xC4,
+    0x2E, 0x2C, 0x1F, 0x41, 0x6F, 0x0E, 0x5F, 0x36, 0xB4, 0xCC, 0x2A, 0xE1, 0x60, 0x02, 0xEE, 0x6D,
+    0xE0, 0xC6, 0xBF, 0x37, 0x29, 0xB7, 0x76, 0xA2, 0xEA, 0xFF, 0x79, 0xFE, 0x01, 0xCD, 0x55, 0xBF,
+    0x8F, 0x1D, 0x35, 0x10, 0x1E, 0xAF, 0x73, 0xB2, 0x90, 0x0B, 0x5F, 0x71, 0x12, 0x12, 0x89, 0xE4,
+    0x86, 0xF2, 0x8E, 0xA5, 0xA0, 0xA0, 0xB8, 0xBB, 0x5D, 0x94, 0x82, 0xE2, 0x9A, 0x2B, 0x38, 0x51,
+    0xA4, 0xC8, 0x1F, 0x40, 0x91, 0xF6, 0x8A, 0xCB, 0xDB, 0x15, 0x22, 0x35, 0x74, 0x14, 0x34, 0x14,
+    0x54, 0x50, 0x10, 0x41, 0x8A, 0x08, 0x3D, 0xDE, 0x3A, 0x49, 0x91, 0x82, 0xE2, 0x2C, 0x10, 0x49,
+    0x41, 0xC1, 0x16, 0x89, 0x28, 0x68, 0xCC, 0x69, 0x81, 0x3D, 0xC9, 0x6F, 0xCD, 0x37, 0x7E, 0xF7,
+    0x43, 0x91, 0x80, 0x8A, 0x82, 0xD3, 0xCD, 0xBC, 0xB5, 0x3D, 0xB6, 0x67, 0xBE, 0xF9, 0x66, 0x4C,
+    0x44, 0x54, 0xA6, 0x34, 0x59, 0x08, 0x45, 0x9A, 0x41, 0x76, 0xCE, 0x64, 0x13, 0xB2, 0x01, 0x21,
+    0x96, 0x2A, 0x2D, 0xB3, 0x9C, 0x8F, 0xFF, 0x4E, 0x74, 0x0A, 0xB0, 0x09, 0xD4, 0xA5, 0x74, 0x2B,
+    0x25, 0xBF, 0x58, 0x0B, 0xB6, 0xDE, 0x56, 0xDE, 0x88, 0xA1, 0xB8, 0xB3, 0x78, 0x47, 0xA6, 0x44,
+    0x37, 0x9E, 0xD7, 0x62, 0x20, 0xBA, 0x4D, 0x64, 0x6B, 0x52, 0x1E, 0x3B, 0x7A, 0x93, 0x78, 0x37,
+    0x6F, 0x4E, 0xA9, 0x6D, 0x52, 0x1A, 0xA9, 0xC2, 0xA2, 0x0C, 0x34, 0xE0, 0x43, 0x13, 0x3E, 0xF6,
+    0xF1, 0x41, 0xFC, 0x01, 0x2F, 0xDE, 0xFB, 0x8C, 0x70, 0x0E, 0x96, 0x3E, 0x4F, 0x5E, 0x06, 0x91,
+    0xB0, 0x24, 0x47, 0x2C, 0x59, 0x07, 0x9B, 0x88, 0x0F, 0x73, 0xF1, 0xF1, 0x10, 0x66, 0x31, 0xA5,
+    0xDA, 0xB4, 0x44, 0xC5, 0xC0, 0x9B, 0x21, 0xC6, 0xE3, 0x26, 0x0C, 0x1A, 0x44, 0x52, 0x9C, 0x12,
+    0xBB, 0xEA, 0x58, 0x74, 0xFF, 0xB2, 0x53, 0x5E, 0xB6, 0xCA, 0x0B, 0xF6, 0x8B, 0xD4, 0xAF, 0x13,
+    0x29, 0xC4, 0xA0, 0xFA, 0xAB, 0x41, 0xF9, 0x62, 0xC4, 0x5C, 0x3C, 0x97, 0x72, 0x49, 0xF3, 0x0C,
+    0xD6, 0x2A, 0xF0, 0x71, 0x75, 0x3C, 0xFB, 0x67, 0x1D, 0xC2, 0xC0, 0xF0, 0x19, 0x89, 0x9A, 0x63,
+    0x5A, 0x2F, 0xA2, 0x80, 0x65, 0x47, 0x9D, 0x2B, 0x27, 0x6A, 0x5C, 0x09, 0x8F, 0xA8, 0xBA, 0x4B,
+    0x16, 0xBE, 0x94, 0xD8, 0xD2, 0x1B, 0x67, 0x61, 0xB6, 0x2D, 0x03, 0x3B, 0xA9, 0xDB, 0xA8, 0x1C,
+    0x86, 0xA1, 0x92, 0xF0, 0x80, 0xEC, 0xCD, 0x27, 0x1C, 0xB2, 0x62, 0x48, 0x60, 0x7B, 0x3A, 0xDD,
+    0xAA, 0xF9, 0xA6, 0x2A, 0x03, 0x11, 0x8D, 0x5B, 0xE0, 0x67, 0x89, 0x9D, 0xB0, 0xED, 0x28, 0x0A,
+    0xB8, 0xD2, 0xE0, 0xD8, 0xAA, 0xC5, 0xBF, 0x71, 0x0A, 0x10, 0x39, 0x58, 0x76, 0x75, 0xE5, 0x19,
+    0xE4, 0xA1, 0xF2, 0x0A, 0xE7, 0xA4, 0x3B, 0xD9, 0x2F, 0x15, 0x32, 0xE4, 0xB4, 0x42, 0x9E, 0x76,
+    0x57, 0x3F, 0x3A, 0xAF, 0x51, 0xE1, 0x57, 0xC3, 0xD7, 0xAF, 0xB0, 0xAE, 0xCB, 0xB6, 0x89, 0x2A,
+    0x94, 0x7D, 0x33, 0xD8, 0x20, 0x06, 0xED, 0x60, 0x7C, 0xA4, 0xDD, 0x7D, 0xA2, 0x2D, 0xED, 0x70,
+    0x8C, 0xD1, 0x0F, 0x7B, 0x6C, 0xFD, 0xE4, 0x29, 0x3C, 0x37, 0x00, 0x12, 0x7E, 0xEF, 0x3D, 0xC2,
+    0xFC, 0xAE, 0x7E, 0x00, 0x50, 0xE6, 0xDA, 0x45, 0x12, 0xA3, 0x76, 0x33, 0xE0, 0xA3, 0x5D, 0x55,
+    0x1B, 0x5F, 0x3E, 0x33, 0xBE, 0x69, 0xBB, 0xA8, 0xE2, 0xC6, 0xA5, 0x0B, 0xF3, 0xAC, 0xEF, 0x67,
+    0x7D, 0x98, 0xF5, 0x1B, 0x2B, 0x27, 0xE8, 0x95, 0x8F, 0x40, 0xCF, 0xB1, 0x48, 0x5F, 0x46, 0xE3,
+    0xE5, 0xB0, 0x4B, 0xBA, 0x1F, 0xC8, 0xBE, 0xEF, 0x40, 0x54, 0x2A, 0xF8, 0xFA, 0x96, 0x0E, 0x22,
+    0x30, 0xEA, 0x71, 0x39, 0x27, 0x20, 0xAC, 0x52, 0x5C, 0x02, 0xCE, 0xC5, 0x21, 0xC9, 0x3F, 0xC1,
+    0x83, 0xE3, 0x81, 0x26, 0x3B, 0x75, 0x20, 0xDA, 0x92, 0xC4, 0x2D, 0x2C, 0xBC, 0xB6, 0xBA, 0xEA,
+    0x69, 0x8F, 0x7D, 0x70, 0x1D, 0xEE, 0xD3, 0x1A, 0x30, 0x9C, 0x28, 0xA5, 0xFE, 0x50, 0xC4, 0x2B,
+    0x4C, 0x14, 0xED, 0x48, 0x7A, 0xF1, 0x85, 0xA7, 0x6A, 0x99, 0xD3, 0x2A, 0x90, 0x83, 0xDD, 0x4D,
+    0xB2, 0x1F, 0x3A, 0xF0, 0xAA, 0xF3, 0x65, 0xF2, 0x74, 0xB3, 0xCE, 0x50, 0xDD, 0x23, 0x33, 0x27,
+    0x09, 0xAB, 0x1C, 0x0E, 0x09, 0x50, 0xAA, 0xB5, 0xAE, 0x99, 0xA8, 0x02, 0x41, 0x69, 0x42, 0x12,
+    0x44, 0x40, 0xF0, 0x48, 0x29, 0x23, 0x00, 0x65, 0x98, 0x2B, 0xF0, 0x41, 0xFE, 0x7E, 0x04, 0xC5,
+    0xEC, 0x97, 0x7F, 0x2C, 0x78, 0xAE, 0x62, 0x65, 0xB3, 0x49, 0xCF, 0x3B, 0x78, 0x5B, 0x11, 0x99,
+    0x58, 0x13, 0xAB, 0xA6, 0x2D, 0x53, 0x5D, 0xF6, 0x60, 0xB4, 0x8E, 0x17, 0xC8, 0xCD, 0x2F, 0xD4,
+    0x11, 0xAB, 0x37, 0x59, 0xBD, 0xCA, 0xCC, 0xEB, 0x62, 0x31, 0x76, 0xA3, 0x1E, 0xB5, 0xB7, 0xB5,
+    0xF2, 0x3B, 0x20, 0xF5, 0x21, 0x24, 0x90, 0xFA, 0xC5, 0x67, 0xB8, 0xD4, 0xF7, 0x03, 0xC6, 0x80,
+    0xCE, 0xCF, 0x20, 0x15, 0x6C, 0x8C, 0x2B, 0x47, 0x15, 0xD2, 0xB2, 0x98, 0xCE, 0x28, 0xC1, 0xB2,
+    0x03, 0xD9, 0x82, 0x5C, 0x3B, 0x4B, 0x07, 0xF8, 0x90, 0xFA, 0x22, 0xE2, 0x04, 0xD4, 0x9E, 0x71,
+    0x39, 0x3E, 0xBE, 0x9A, 0x3B, 0x06, 0x55, 0xD7, 0xC0, 0x66, 0xF3, 0xDD, 0x5E, 0x4D, 0xF2, 0xE4,
+    0x07, 0x30, 0x61, 0xF9, 0x4D, 0xCF, 0x8D, 0x03, 0xD0, 0x99, 0x9F, 0x3A, 0x04, 0x77, 0x02, 0xC8,
+    0x29, 0xDE, 0x03, 0x56, 0xD5, 0x16, 0xE2, 0x34, 0x0F, 0xE4, 0x98, 0x03, 0xE3, 0xED, 0x3A, 0x30,
+    0xEC, 0xA8, 0x95, 0x25, 0x59, 0x8E, 0x51, 0xB0, 0x17, 0x9C, 0x17, 0xC4, 0x52, 0xA2, 0xCC, 0x75,
+    0x6A, 0x2B, 0x57, 0x92, 0x5D, 0x57, 0xCE, 0x90, 0x38, 0x79, 0xDC, 0xD2, 0xD1, 0xD7, 0x8E, 0xEC,
+    0x8C, 0x93, 0x08, 0x8A, 0x9D, 0x1C, 0x63, 0xE2, 0x2B, 0xF4, 0x81, 0xCD, 0x5D, 0x82, 0x85, 0x13,
+    0x41, 0xC4, 0x22, 0xB5, 0xE5, 0xA3, 0x14, 0x24, 0x03, 0xB5, 0xF1, 0xCF, 0xB9, 0x49, 0xE9, 0xBA,
+    0x87, 0xDA, 0xFB, 0x2F, 0x73, 0xB3, 0x2F, 0xF6, 0x41, 0x42, 0x90, 0xB1, 0x09, 0xAB, 0xCE, 0x70,
+    0x26, 0xEB, 0x4D, 0x7A, 0x2B, 0x36, 0xE9, 0x6D, 0x34, 0x28, 0xF3, 0x01, 0xDF, 0x24, 0xC3, 0x36,
+    0x64, 0xC0, 0x35, 0x38, 0x11, 0x0C, 0x96, 0xBF, 0x31, 0x24, 0xF3, 0x7C, 0xA3, 0x0C, 0x65, 0xCB,
+    0xF5, 0x6D, 0x97, 0x6A, 0xA8, 0x92, 0x58, 0x9E, 0x87, 0xB1, 0x56, 0x24, 0x78, 0xB6, 0x40, 0xB5,
+    0x79, 0x1D, 0x77, 0x51, 0xF8, 0xCD, 0xA7, 0x83, 0x0A, 0xB2, 0x97, 0xCE, 0xA2, 0x9D, 0x28, 0xE0,
+    0x89, 0xCA, 0x13, 0x11, 0x64, 0x43, 0xA1, 0x6F, 0x73, 0x27, 0x79, 0xC2, 0x1C, 0x6F, 0x12, 0xB8,
+    0x2F, 0x96, 0x5D, 0xAE, 0xFF, 0x19, 0x4F, 0x3B, 0x3E, 0xB2, 0x61, 0x22, 0x01, 0xAC, 0x91, 0xA7,
+    0xE5, 0xC0, 0xD3, 0x8A, 0x1B, 0x24, 0x99, 0x40, 0x57, 0x93, 0x33, 0x0C, 0x10, 0x99, 0x21, 0x5F,
+    0xCC, 0x0D, 0x42, 0xE8, 0x34, 0x09, 0xF4, 0x55, 0xDF, 0x1C, 0x7F, 0x8C, 0x20, 0x42, 0x55, 0xF4,
+    0x86, 0xA3, 0xB8, 0x5B, 0x99, 0x3A, 0x87, 0x81, 0x8C, 0x53, 0x8E, 0x03, 0x49, 0xF3, 0x2B, 0xE8,
+    0xAA, 0x82, 0xA3, 0x32, 0x5E, 0xA4, 0xBE, 0xA9, 0x11, 0x0A, 0xE7, 0x56, 0x9C, 0x75, 0x1B, 0x54,
+    0x65, 0x93, 0x1E, 0xA3, 0x9E, 0xD2, 0x29, 0x7B, 0x52, 0x72, 0xEB, 0xA7, 0x6F, 0x99, 0x5B, 0xC5,
+    0x90, 0x2B, 0xD1, 0xBF, 0x30, 0xFD, 0xE3, 0xC1, 0xBB, 0x98, 0xC6, 0x5B, 0xC1, 0x39, 0x03, 0xDE,
+    0xFF, 0x6E, 0x7D, 0x39, 0xAD, 0x13, 0x6E, 0xE7, 0xE7, 0xC0, 0xA6, 0x1C, 0x8B, 0xC9, 0x5D, 0xAE,
+    0xBC, 0xEC, 0x3E, 0x22, 0xF7, 0x44, 0xD9, 0xB2, 0x7E, 0x09, 0x34, 0x54, 0xE9, 0x24, 0x05, 0x9B,
+    0xEA, 0x05, 0xA9, 0x1E, 0x6F, 0x96, 0xC5, 0xD3, 0x80, 0xA6, 0x63, 0x6B, 0x74, 0x82, 0xD9, 0xC1,
+    0x0D, 0xD0, 0x1F, 0xCF, 0x95, 0x7A, 0x7E, 0xB0, 0x58, 0x4D, 0xDD, 0x7E, 0xC1, 0xAA, 0x1B, 0x74,
+    0xFA, 0x19, 0xB1, 0x32, 0xE2, 0xFC, 0xD8, 0x11, 0x67, 0x84, 0x24, 0x37, 0x77, 0xC3, 0xA3, 0x4D,
+    0xFA, 0xDF, 0xFC, 0xFD, 0x05, 0xB5, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0xF6, 0x28, 0x4C,
+    0x31, 0x42, 0xD3, 0x00, 0x0D, 0x08, 0xB7, 0x34, 0xC8, 0x15, 0xDD, 0xDD, 0xDA, 0x81, 0x1F, 0xC0,
+    0x15, 0x39, 0x28, 0x40, 0x4A, 0x45, 0x9D, 0x14, 0x14, 0x14, 0x77, 0xB7, 0x43, 0x45, 0x99, 0x48,
+    0x48, 0xD4, 0x29, 0xA8, 0x68, 0xA0, 0xA0, 0x40, 0x68, 0x6F, 0xED, 0xAB, 0x52, 0x66, 0x12, 0x25,
+    0xA2, 0x8C, 0x25, 0x38, 0x0A, 0x28, 0xB0, 0x88, 0x11, 0x73, 0x27, 0xEF, 0x0E, 0xDF, 0x37, 0xDE,
+    0x4D, 0xA2, 0x03, 0x21, 0x9D, 0x04, 0x5E, 0xAD, 0xED, 0x99, 0x37, 0x6F, 0xE6, 0x7B, 0xDF, 0xFB,
+    0xDE, 0xB3, 0x08, 0xAF, 0x3C, 0xAE, 0x64, 0x1E, 0xE3, 0xDD, 0xE8, 0x25, 0xC6, 0x28, 0xA3, 0x48,
+    0x59, 0x2F, 0x54, 0x2F, 0x72, 0x9C, 0xF5, 0xB6, 0x95, 0x7C, 0xD0, 0xAE, 0x12, 0x31, 0xFE, 0xB5,
+    0xC9, 0x24, 0xC9, 0x24, 0x62, 0x1F, 0xED, 0xBF, 0x3F, 0x88, 0x54, 0xF0, 0xF1, 0x42, 0xCF, 0xF8,
+    0xCC, 0x44, 0x2F, 0x98, 0xE8, 0x25, 0x17, 0xBC, 0x9E, 0x37, 0x99, 0xE8, 0xB3, 0x18, 0xE0, 0x5B,
+    0x17, 0xB1, 0x97, 0x66, 0xA5, 0x63, 0xFC, 0x3A, 0x66, 0x31, 0x76, 0x4B, 0xD1, 0xA7, 0xDF, 0x15,
+    0x75, 0x16, 0x5E, 0xD7, 0x5E, 0x8E, 0xF4, 0xD5, 0x41, 0x8A, 0x4F, 0xDB, 0xA3, 0xFD, 0x0F, 0x3A,
+    0x29, 0x22, 0x1C, 0xF4, 0xE9, 0xFE, 0x52, 0x32, 0x4C, 0x3A, 0x39, 0x14, 0x8D, 0x49, 0xAC, 0x14,
+    0xAE, 0xC4, 0x8E, 0x75, 0x13, 0x6C, 0xEC, 0xE6, 0x51, 0x36, 0x57, 0x49, 0x64, 0xAD, 0x68, 0x3E,
+    0x6E, 0xA7, 0xF3, 0x01, 0x86, 0x68, 0x08, 0x0D, 0xD8, 0x88, 0x86, 0x70, 0x80, 0xED, 0x1F, 0x8C,
+    0xE7, 0xDF, 0xD7, 0x34, 0x36, 0xA0, 0x88, 0xC6, 0x5F, 0x62, 0x97, 0x8C, 0x6A, 0x35, 0x79, 0x56,
+    0x2E, 0x79, 0xEA, 0x7E, 0xF2, 0x1C, 0x27, 0xCF, 0xAA, 0x4E, 0x46, 0xDB, 0x26, 0xA3, 0xEA, 0x9B,
+    0x55, 0x16, 0x47, 0x19, 0x11, 0x26, 0xE8, 0xAD, 0x36, 0xB0, 0xEA, 0xF4, 0x80, 0x5F, 0x7A, 0xF8,
+    0x69, 0xB2, 0xE3, 0x5D, 0xC7, 0x69, 0xB4, 0xAC, 0x71, 0x2E, 0xC8, 0x40, 0x50, 0x11, 0xE7, 0x8B,
+    0xE9, 0x12, 0xC8, 0xC3, 0x04, 0x0E, 0xD1, 0x6E, 0x07, 0x1F, 0xA5, 0x01, 0x4E, 0x38, 0xE4, 0xCA,
+    0x1E, 0x83, 0xA6, 0xAE, 0x1C, 0x2D, 0xD9, 0x98, 0x96, 0x59, 0x9F, 0x7C, 0x8E, 0xD3, 0x40, 0x3F,
+    0x88, 0xBE, 0xC4, 0xDA, 0x08, 0xB6, 0xBD, 0x99, 0x4E, 0x5A, 0x3C, 0x87, 0x25, 0x1B, 0xD2, 0x60,
+    0x82, 0x59, 0x24, 0xFB, 0x3C, 0x4D, 0xE5, 0x3F, 0xE1, 0xF6, 0x4A, 0x9A, 0x5D, 0x11, 0xE5, 0x59,
+    0xF6, 0x25, 0x4C, 0x32, 0x0F, 0x88, 0x50, 0xFF, 0x1C, 0xE0, 0x31, 0xCB, 0x87, 0x2C, 0xE4, 0xBD,
+    0xEA, 0x6C, 0xCB, 0x1F, 0x26, 0xA4, 0xCA, 0x02, 0x52, 0xB3, 0x30, 0x9D, 0xEE, 0xF2, 0xBE, 0x74,
+    0x85, 0xB3, 0xED, 0x32, 0x4D, 0x83, 0x0F, 0x09, 0xBA, 0x87, 0xAB, 0xB7, 0x5E, 0xFB, 0x52, 0x4A,
+    0x78, 0x80, 0xD0, 0xB6, 0xB8, 0xE5, 0xA4, 0xF2, 0x65, 0x00, 0x84, 0xF3, 0xE6, 0xF4, 0x43, 0x24,
+    0xFC, 0x57, 0xF2, 0xB1, 0x87, 0x9F, 0x64, 0x35, 0xCF, 0x45, 0x82, 0x86, 0x57, 0x9D, 0x04, 0xDB,
+    0xD4, 0xA5, 0xEA, 0x16, 0xCA, 0x1F, 0x68, 0x7F, 0x60, 0xDA, 0x99, 0x69, 0x47, 0xD5, 0x8D, 0xD6,
+    0xCD, 0x2C, 0x5E, 0xFC, 0xC2, 0xB4, 0x3B, 0x69, 0xBE, 0x52, 0xDD, 0x90, 0x87, 0x02, 0xDA, 0xF8,
+    0xA3, 0x39, 0x71, 0x49, 0x3F, 0x2F, 0xD7, 0xD7, 0x10, 0xC1, 0x7E, 0x0D, 0xE9, 0xC7, 0x1A, 0x9C,
+    0x79, 0x33, 0x64, 0x03, 0x74, 0xB4, 0x8B, 0xFC, 0xD9, 0xB7, 0x07, 0xC9, 0xDB, 0x71, 0x43, 0x01,
+    0x14, 0x46, 0xDE, 0x25, 0x0F, 0x4C, 0x08, 0x53, 0x04, 0x92, 0x34, 0xA4, 0x2C, 0xE4, 0xA0, 0xE2,
+    0x80, 0x2F, 0xCD, 0xD9, 0x7B, 0xDF, 0x62, 0x9F, 0x11, 0x6A, 0x0B, 0x53, 0x6E, 0x35, 0x4C, 0x19,
+    0xD6, 0xBD, 0x85, 0xB1, 0x1D, 0x37, 0x1B, 0x00, 0x7F, 0xB9, 0x46, 0xC5, 0xF4, 0x95, 0xAC, 0x4A,
+    0x29, 0xDE, 0x75, 0xEA, 0x33, 0x2F, 0x79, 0x9F, 0x4A, 0x64, 0xAA, 0x88, 0x9C, 0x6F, 0x4E, 0xEC,
+    0x99, 0xEC, 0x01, 0xA8, 0xC1, 0x6E, 0xE6, 0xB6, 0x64, 0x00, 0xF0, 0x89, 0x58, 0x48, 0x69, 0x2D,
+    0xF2, 0xD2, 0xA4, 0x1F, 0x6A, 0x62, 0x4D, 0x4D, 0xFF, 0xE6, 0xAA, 0x7A, 0x36, 0xA8, 0x41, 0x3D,
+    0x86, 0xEE, 0xDE, 0xBC, 0xA9, 0x86, 0x1C, 0xFC, 0x51, 0xC4, 0x49, 0xD7, 0x97, 0x78, 0x79, 0x81,
+    0x1A, 0xA3, 0xDC, 0xA6, 0x5A, 0x48, 0xD2, 0x38, 0xC0, 0x5F, 0x51, 0x16, 0x3B, 0x14, 0x80, 0xA3,
+    0x1E, 0x9F, 0xE0, 0xCC, 0x7B, 0x5F, 0x9C, 0x5D, 0x07, 0xB9, 0x3B, 0x7D, 0x51, 0xFF, 0xDE, 0x1E,
+    0xAA, 0x9A, 0x9A, 0x81, 0xB8, 0x50, 0x87, 0x54, 0xA4, 0x3C, 0x1D, 0x3A, 0x6C, 0x3A, 0xA0, 0xB7,
+    0x60, 0x4F, 0x0B, 0x22, 0x67, 0xD8, 0x04, 0xA6, 0x9C, 0xAC, 0xC9, 0xD3, 0xAB, 0x89, 0x6D, 0xB3,
+    0x9E, 0xAF, 0xE5, 0x46, 0x00, 0x0A, 0xD3, 0x82, 0x01, 0xAC, 0x5D, 0x49, 0x49, 0x71, 0xED, 0xA6,
+    0x5E, 0x04, 0xEF, 0x13, 0x90, 0x64, 0x7E, 0xC4, 0x3E, 0xEA, 0x4F, 0x12, 0x1B, 0x59, 0x3D, 0xA9,
+    0xC4, 0x8F, 0xFE, 0xED, 0x66, 0x52, 0x36, 0x90, 0x96, 0xF9, 0x5A, 0xB1, 0xBF, 0x95, 0x01, 0x85,
+    0x36, 0x63, 0x9B, 0x68, 0x91, 0xE9, 0x80, 0xBD, 0x0B, 0x70, 0x8F, 0x04, 0x98, 0x16, 0x27, 0x1D,
+    0x99, 0x16, 0x52, 0x06, 0xC0, 0xE2, 0x3A, 0x7C, 0xCF, 0x71, 0x98, 0x49, 0x32, 0x00, 0x72, 0xE6,
+    0x88, 0x88, 0x2E, 0xBC, 0x54, 0x7B, 0xEC, 0x7F, 0x90, 0xD1, 0x57, 0x77, 0x2E, 0x11, 0x4B, 0xCB,
+    0x58, 0x1E, 0x30, 0x96, 0x27, 0xDB, 0x58, 0xC0, 0x2B, 0x6F, 0xEB, 0xFF, 0x2C, 0x96, 0x5D, 0xBD,
+    0x8D, 0xC5, 0x32, 0x16, 0x36, 0x0C, 0xC4, 0x72, 0x65, 0xFE, 0x90, 0x29, 0xF6, 0x72, 0xE5, 0xC6,
+    0xB5, 0xBF, 0xC5, 0x52, 0x5F, 0x88, 0xC5, 0x46, 0x34, 0xD2, 0x93, 0x18, 0xB2, 0xC6, 0xEB, 0x81,
+    0xA9, 0x6D, 0x18, 0x8C, 0x65, 0xAB, 0x93, 0x15, 0xA8, 0x92, 0xE2, 0xAE, 0xE7, 0xC7, 0x83, 0x82,
+    0xA9, 0xB8, 0x83, 0xA6, 0x9A, 0x54, 0x4C, 0x5F, 0x94, 0x9E, 0x2A, 0x60, 0x65, 0x84, 0xA2, 0x25,
+    0xAC, 0x91, 0xA2, 0x02, 0x93, 0x47, 0x5C, 0xC5, 0x86, 0x2A, 0x0D, 0x36, 0x86, 0x80, 0x85, 0xCD,
+    0x79, 0x53, 0x52, 0xC2, 0x1A, 0x49, 0x2A, 0x11, 0xCB, 0x04, 0xE7, 0xA9, 0x21, 0xDD, 0xAC, 0xD6,
+    0x3A, 0xDE, 0x8A, 0x57, 0xA3, 0x9F, 0x03, 0x00, 0x5A, 0x2D, 0x76, 0x31, 0x4E, 0xCC, 0x0F, 0xB0,
+    0x36, 0xED, 0xD4, 0x3B, 0x19, 0x9C, 0x7A, 0x8C, 0x90, 0xEF, 0x8F, 0xA2, 0xBA, 0xD2, 0xA9, 0x5E,
+    0x0D, 0x66, 0x9D, 0xA1, 0x75, 0xDC, 0x8F, 0xDB, 0x52, 0xA6, 0x02, 0x73, 0x82, 0xFD, 0x18, 0xFF,
+    0x17, 0x9F, 0xE9, 0x8F, 0x5F, 0x88, 0x50, 0xC6, 0x7B, 0xE8, 0xB1, 0x79, 0xFC, 0xBC, 0x3B, 0xB6,
+    0x75, 0xE9, 0x86, 0xF2, 0x1D, 0x6F, 0xBA, 0x1D, 0xE3, 0xBF, 0xC9, 0x83, 0xCE, 0x87, 0x37, 0x58,
+    0xFA, 0x28, 0x8A, 0xD2, 0xB1, 0xB6, 0xD1, 0x0F, 0x58, 0xA9, 0x21, 0x7D, 0x3A, 0x2E, 0x67, 0x50,
+    0x67, 0x92, 0x2D, 0x53, 0xED, 0xB2, 0xFD, 0xF2, 0x72, 0xB2, 0xAD, 0xB5, 0x6D, 0xE7, 0x3D, 0x98,
+    0xD8, 0x4F, 0x77, 0x35, 0x7D, 0x1E, 0xEE, 0xC8, 0xFF, 0x73, 0xFD, 0x05, 0xC5, 0x55, 0x31, 0x8F,
+    0xDC, 0x54, 0x10, 0x1E, 0xDB, 0x39, 0x8C, 0xF4, 0x84, 0x1E, 0x42, 0x20, 0x45, 0x22, 0xF0, 0x28,
+    0xE8, 0x38, 0xE2, 0x86, 0x02, 0x89, 0xBB, 0xF3, 0xD3, 0x21, 0xAA, 0x34, 0x14, 0x39, 0x21, 0x41,
+    0x01, 0x2D, 0x12, 0x52, 0xDA, 0x2B, 0x72, 0x6B, 0x13, 0xFE, 0x40, 0x2A, 0x9A, 0xFC, 0x03, 0x40,
+    0xA1, 0xA1, 0x48, 0xB1, 0x1B, 0xBF, 0xDC, 0x15, 0xB4, 0x96, 0x10, 0xA2, 0xA0, 0x71, 0x11, 0x94,
+    0x82, 0x02, 0x83, 0x5C, 0xEC, 0x0A, 0xEF, 0x0E, 0xDF, 0xF7, 0xB2, 0xBB, 0x28, 0x11, 0x2B, 0x51,
+    0x20, 0x61, 0xDD, 0x7E, 0x37, 0x37, 0xFB, 0x3C, 0x33, 0xDF, 0xBC, 0x6F, 0xE6, 0x4A, 0xD5, 0x2F,
+    0xB4, 0x55, 0x55, 0xBB, 0xCA, 0xCE, 0x87, 0x53, 0x1B, 0xAC, 0x69, 0xBB, 0x52, 0xDE, 0x2E, 0xDE,
+    0xF5, 0xA3, 0xC8, 0xEC, 0x52, 0xD6, 0x4B, 0x3A, 0x88, 0x0D, 0x62, 0x5A, 0x29, 0x45, 0x0A, 0x2F,
+    0x74, 0xCB, 0x3F, 0xB9, 0x9F, 0x41, 0x14, 0xAD, 0x4B, 0xA2, 0xF0, 0x19, 0x09, 0x69, 0x4F, 0x34,
+    0x35, 0xF1, 0x95, 0xE8, 0x7E, 0x4B, 0xFE, 0x7E, 0x4A, 0xBD, 0xA5, 0xCB, 0x62, 0x95, 0xE8, 0x90,
+    0x0D, 0xE2, 0xC2, 0x53, 0x90, 0x6E, 0x21, 0x19, 0x01, 0xA2, 0x84, 0x46, 0x35, 0x88, 0x23, 0xC8,
+    0x75, 0xFC, 0x29, 0xB2, 0x0B, 0x52, 0x5D, 0x21, 0xF1, 0xE3, 0x5A, 0x26, 0x84, 0x23, 0xC2, 0xE1,
+    0x16, 0xF6, 0x09, 0x57, 0x9A, 0xD1, 0xE9, 0x35, 0xFD, 0x5C, 0x3B, 0xD3, 0xA2, 0xD4, 0x99, 0x14,
+    0xB2, 0x35, 0xF2, 0x0E, 0x46, 0xF9, 0x63, 0x23, 0xA2, 0xDA, 0x4B, 0xF2, 0xE9, 0x8D, 0x0D, 0x9D,
+    0x62, 0x6D, 0xA4, 0x3A, 0x17, 0xD4, 0x13, 0xD6, 0x5C, 0x0D, 0x8D, 0x53, 0x7C, 0xF2, 0xFA, 0x49,
+    0x9A, 0xFF, 0x8A, 0xE5, 0x3E, 0x59, 0xEE, 0x93, 0xE5, 0x67, 0x4F, 0xB2, 0x3C, 0x23, 0x99, 0xFD,
+    0x2D, 0x5C, 0x7E, 0x9A, 0xE5, 0x92, 0x2C, 0x97, 0xE4, 0x71, 0x63, 0x95, 0x6B, 0xCD, 0xCA, 0x0B,
+    0x6F, 0x02, 0x69, 0xA4, 0xC3, 0x27, 0x53, 0x99, 0x5C, 0x29, 0xC4, 0xFE, 0xF9, 0x6D, 0x88, 0x2C,
+    0xF6, 0x16, 0x53, 0x90, 0x06, 0x81, 0x9C, 0xD5, 0x92, 0x84, 0xD1, 0x16, 0x9F, 0x79, 0x2C, 0xB4,
+    0x51, 0x54, 0x5E, 0xA1, 0x6D, 0xBC, 0xDF, 0x1D, 0xF0, 0xFB, 0xDD, 0xDB, 0x92, 0xA9, 0x8E, 0x92,
+    0xAD, 0xBE, 0x52, 0xFA, 0x4A, 0x0F, 0x28, 0x6A, 0x80, 0xDB, 0x0D, 0x85, 0x4A, 0x33, 0xAA, 0x1E,
+    0xE3, 0xBD, 0xF7, 0x99, 0x08, 0xC9, 0x73, 0xDD, 0x88, 0x24, 0x06, 0xB6, 0x64, 0x54, 0x46, 0x57,
+    0xE2, 0x91, 0x46, 0x21, 0xAF, 0xDF, 0x50, 0x71, 0x39, 0xB8, 0x4E, 0x56, 0x6C, 0x16, 0x6C, 0x9E,
+    0x1A, 0xF1, 0x0B, 0xF6, 0x08, 0x7B, 0x97, 0xAB, 0x1A, 0x53, 0xFD, 0x41, 0xFB, 0x42, 0x3D, 0xC2,
+    0x7D, 0x48, 0x28, 0x10, 0x0E, 0x19, 0x1B, 0x60, 0xE5, 0x4D, 0xCF, 0xD3, 0xB6, 0x7B, 0xBD, 0xA8,
+    0xC5, 0x9D, 0x07, 0x94, 0x50, 0xDA, 0xBC, 0x13, 0x59, 0x1E, 0x42, 0xC7, 0x59, 0x4F, 0x01, 0xEB,
+    0x79, 0x44, 0xF9, 0xF8, 0x97, 0x93, 0x93, 0xEB, 0xA0, 0xC8, 0xBA, 0xEE, 0x47, 0x3D, 0x47, 0x55,
+    0xE7, 0x51, 0xD5, 0x36, 0xA2, 0x8B, 0x58, 0x2C, 0x4E, 0xEE, 0x32, 0x0D, 0xF3, 0xBC, 0x4C, 0xE5,
+    0x89, 0x9C, 0x10, 0xF6, 0x3C, 0x5B, 0x5C, 0x23, 0xB7, 0x8A, 0x9F, 0xE3, 0x9A, 0x71, 0x19, 0x17,
+    0x17, 0x9D, 0x8C, 0x87, 0x13, 0x18, 0x48, 0x31, 0x1A, 0x4E, 0x4D, 0xD4, 0xCE, 0x8C, 0x91, 0x3B,
+    0xB6, 0x01, 0x2F, 0xA5, 0x2B, 0x7F, 0x59, 0x2C, 0xBE, 0x42, 0x50, 0xF8, 0xF6, 0xD8, 0xB6, 0xFF,
+    0x8D, 0x4B, 0xB2, 0xA4, 0x3F, 0xEB, 0xE2, 0xC9, 0x7A, 0x3B, 0x42, 0xF2, 0x5D, 0xC4, 0xF0, 0x5F,
+    0x12, 0x8D, 0xE1, 0x07, 0xE6, 0xF1, 0xEB, 0x04, 0x86, 0xE1, 0x5F, 0x8B, 0x73, 0xF4, 0x48, 0xBB,
+    0x78, 0xC5, 0x63, 0xBC, 0xF7, 0x9D, 0x46, 0xB3, 0x64, 0xB8, 0xCD, 0x93, 0x87, 0xB8, 0x7E, 0xD2,
+    0x3E, 0xEA, 0x4C, 0xAA, 0x0F, 0xA2, 0xD8, 0x73, 0xB2, 0x5B, 0xD7, 0xBD, 0x79, 0xF6, 0x22, 0xA2,
+    0xA7, 0xB9, 0xCE, 0x53, 0x68, 0x48, 0x9A, 0x79, 0x02, 0x68, 0xF1, 0xE2, 0x2A, 0xC8, 0x4D, 0xC4,
+    0x9E, 0xB2, 0xC0, 0x12, 0xA6, 0x48, 0x6F, 0x03, 0x37, 0xCA, 0xD5, 0xAC, 0x77, 0xEC, 0x4D, 0x18,
+    0x63, 0xC1, 0x67, 0xD5, 0x47, 0x71, 0x34, 0x95, 0x5C, 0xC4, 0x3E, 0x5A, 0x90, 0xAB, 0x69, 0x47,
+    0xCA, 0x3B, 0xEB, 0xCB, 0x14, 0xB9, 0xB3, 0xC1, 0x06, 0x10, 0x4F, 0xC7, 0xAC, 0x47, 0xEF, 0xB1,
+    0xDA, 0x46, 0xE8, 0x1B, 0x3F, 0xA5, 0xB8, 0x16, 0x3B, 0xCE, 0x86, 0x74, 0x29, 0xEA, 0x0B, 0xAC,
+    0xD2, 0x56, 0xBD, 0xD3, 0x2E, 0x5B, 0xBD, 0x14, 0xEB, 0x02, 0xA6, 0xC1, 0x20, 0x49, 0xDE, 0xB2,
+    0x49, 0x59, 0xE7, 0x6A, 0x76, 0x2F, 0x8E, 0xD1, 0x1B, 0x0F, 0x37, 0x1C, 0x2E, 0x45, 0x0A, 0x45,
+    0x5D, 0x8D, 0x79, 0x5F, 0x74, 0xD5, 0xE0, 0xFA, 0x64, 0x30, 0xAC, 0xF4, 0xA6, 0x09, 0xF7, 0x44,
+    0xDE, 0x34, 0x01, 0x5D, 0xB0, 0xE6, 0x1C, 0xE5, 0x99, 0x3B, 0x3F, 0xA1, 0x2A, 0x1B, 0xB7, 0x8C,
+    0xBB, 0x76, 0x01, 0xFF, 0x91, 0x79, 0x80, 0xAE, 0x4C, 0x0D, 0x74, 0x94, 0xCC, 0x4D, 0x98, 0xA0,
+    0x64, 0x83, 0x5A, 0x6D, 0x5B, 0x3C, 0xB4, 0x6D, 0x55, 0x37, 0x63, 0x3E, 0x7F, 0x91, 0xF1, 0x29,
+    0xC6, 0xE4, 0x18, 0xD2, 0x28, 0xBF, 0x47, 0x7D, 0xCA, 0xA6, 0x7F, 0x93, 0xF5, 0x58, 0x27, 0x36,
+    0x38, 0x0F, 0x22, 0x08, 0x32, 0xA2, 0xC6, 0xAC, 0x47, 0xA3, 0xEC, 0xCF, 0x0B, 0x5E, 0x1D, 0x66,
+    0x51, 0xBF, 0x56, 0x6C, 0x83, 0x44, 0xBD, 0xE5, 0x2E, 0x2F, 0x39, 0xFC, 0x58, 0x23, 0x03, 0xBA,
+    0x6B, 0x70, 0xAD, 0xD8, 0x5A, 0x70, 0xCD, 0xB0, 0x8F, 0x28, 0x5B, 0x1F, 0xF7, 0xC1, 0xFD, 0xCD,
+    0x76, 0xA0, 0x50, 0xCC, 0x40, 0x51, 0xC2, 0x28, 0x6E, 0x47, 0xA6, 0x2F, 0x68, 0x6F, 0x7E, 0xD5,
+    0xBA, 0xB9, 0x35, 0xE4, 0x6D, 0xDE, 0x1E, 0x88, 0x3B, 0xEE, 0xE4, 0xCC, 0x4A, 0xB2, 0x58, 0x50,
+    0x84, 0xDE, 0x7D, 0xA9, 0xFE, 0x4C, 0xAA, 0x64, 0x90, 0x59, 0xDE, 0x26, 0x73, 0xE7, 0xB3, 0x3F,
+    0xB4, 0xB6, 0x8D, 0x7A, 0xF4, 0x02, 0xCE, 0xB8, 0xAE, 0x91, 0x30, 0xE5, 0x18, 0xD5, 0x52, 0xCE,
+    0xD7, 0xFF, 0x25, 0xE4, 0xF1, 0xED, 0x69, 0x9B, 0x13, 0x70, 0x0A, 0x83, 0x95, 0x76, 0x54, 0xEB,
+    0xBD, 0x04, 0x67, 0xAE, 0xF2, 0x94, 0xAD, 0xD1, 0xFA, 0xAC, 0xA5, 0x73, 0xA0, 0xF3, 0x80, 0x4E,
+    0x87, 0x35, 0x87, 0xE3, 0x70, 0x66, 0x1D, 0x9D, 0x03, 0x9D, 0x53, 0x3A, 0x8F, 0x20, 0xF6, 0x67,
+    0x0B, 0x74, 0x14, 0xEB, 0x59, 0x26, 0xA9, 0x86, 0x44, 0x97, 0x55, 0x9D, 0xA8, 0xBE, 0xE7, 0xD7,
+    0x7B, 0x2F, 0x4E, 0x56, 0x12, 0xE5, 0x19, 0x55, 0x79, 0x40, 0x78, 0x0E, 0xCB, 0x1D, 0x3A, 0x8E,
+    0x73, 0xE8, 0x58, 0x66, 0x8F, 0xDE, 0x5A, 0x94, 0x9E, 0x74, 0x30, 0x5E, 0x85, 0x91, 0xB6, 0x30,
+    0x0E, 0x60, 0x64, 0x6C, 0xFB, 0x29, 0x0C, 0xEB, 0x9D, 0x7F, 0x07, 0x37, 0x9E, 0x2F, 0xA1, 0xDD,
+    0xCA, 0x97, 0xFA, 0x00, 0x29, 0xA8, 0x77, 0x6A, 0x34, 0xED, 0xD6, 0xA1, 0x33, 0x2A, 0xF5, 0xF9,
+    0x48, 0xF5, 0x2F, 0xBD, 0x55, 0x31, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBD, 0xC5, 0x59, 0xC1, 0x15,
+    0x4B, 0x83, 0x04, 0x12, 0xF8, 0x1A, 0xEA, 0x5C, 0x43, 0x91, 0xC2, 0xC9, 0x9E, 0xC4, 0x0F, 0x20,
+    0x12, 0x7E, 0x50, 0xB8, 0x08, 0x3D, 0x85, 0x3B, 0x94, 0x22, 0xF6, 0x1D, 0x96, 0x10, 0x25, 0x69,
+    0xE8, 0x69, 0x68, 0xDC, 0x98, 0x22, 0x05, 0x12, 0xCF, 0xEF, 0xAD, 0x69, 0x28, 0x39, 0x81, 0xA8,
+    0x68, 0x4E, 0x42, 0x96, 0x25, 0x28, 0xB2, 0x72, 0xCE, 0x70, 0x8E, 0xEF, 0x6E, 0xF8, 0x66, 0xDF,
+    0x7B, 0x36, 0x46, 0x42, 0x29, 0x2C, 0xB1, 0x92, 0xC7, 0xBB, 0xF3, 0x76, 0x76, 0x66, 0xBE, 0xF9,
+    0x66, 0x8E, 0x08, 0x2B, 0xE1, 0x81, 0x4A, 0xFE, 0x81, 0x6B, 0xE2, 0x73, 0xEA, 0x89, 0xF2, 0x42,
+    0x07, 0xA2, 0x43, 0xB2, 0x9E, 0x92, 0x96, 0x1C, 0x51, 0x5A, 0x5F, 0x53, 0xFF, 0x32, 0xF9, 0x10,
+    0x6A, 0x66, 0x31, 0xC0, 0x7A, 0xC1, 0xED, 0x2B, 0x75, 0x0A, 0x03, 0x07, 0x93, 0x42, 0x7E, 0x27,
+    0x92, 0xDF, 0x89, 0xB2, 0x42, 0x64, 0x54, 0x64, 0x35, 0xC4, 0x7C, 0x90, 0xED, 0xAC, 0x90, 0x9D,
+    0xE1, 0x53, 0x0E, 0x19, 0x17, 0x33, 0x32, 0x8D, 0x6A, 0x29, 0xAB, 0x4C, 0x4D, 0xBB, 0xB0, 0x50,
+    0x1D, 0xED, 0x4E, 0xB6, 0x1A, 0x05, 0xE7, 0x95, 0x39, 0x9E, 0xCC, 0x16, 0xAA, 0x9D, 0x6B, 0xB7,
+    0xE6, 0xAD, 0xEA, 0x2C, 0x37, 0x46, 0xDE, 0xCC, 0xC5, 0xC7, 0x74, 0xE5, 0xD2, 0xE1, 0x64, 0x3A,
+    0x1C, 0xB8, 0x42, 0x54, 0x5F, 0xD1, 0x62, 0xFD, 0x8F, 0x20, 0x28, 0xEE, 0x61, 0x90, 0x71, 0xCC,
+    0xDF, 0x56, 0x22, 0x1F, 0x45, 0x40, 0x9A, 0xA8, 0x88, 0xE1, 0x3C, 0x14, 0xA1, 0xFC, 0x8D, 0x41,
+    0x48, 0xF9, 0x0B, 0x6E, 0x4A, 0x5E, 0x61, 0xAC, 0x05, 0x8E, 0x4C, 0x4E, 0xDF, 0xC8, 0xA9, 0xA2,
+    0xCB, 0xE5, 0x78, 0x8F, 0x87, 0x7C, 0x54, 0xDC, 0x6A, 0x98, 0xFB, 0x7F, 0x89, 0xE4, 0x52, 0xA8,
+    0x1E, 0x82, 0x58, 0xC4, 0x9C, 0xD9, 0x53, 0x26, 0x82, 0x36, 0x71, 0x24, 0xFA, 0x2F, 0x21, 0xD8,
+    0x92, 0x8D, 0x42, 0xFC, 0xA7, 0xA2, 0x37, 0x97, 0x22, 0x46, 0x91, 0x54, 0x34, 0xEF, 0x33, 0xDE,
+    0x1E, 0x0D, 0x57, 0x87, 0x94, 0x03, 0xB9, 0xD4, 0xA7, 0x75, 0x12, 0xE0, 0x73, 0x8A, 0x44, 0x72,
+    0xB2, 0x67, 0xDB, 0x70, 0x0B, 0xCC, 0xD6, 0xBE, 0x96, 0x4A, 0xE6, 0xCB, 0x77, 0x12, 0x80, 0x28,
+    0xBC, 0x4A, 0xB9, 0x23, 0x15, 0x96, 0x48, 0x0A, 0x84, 0x5A, 0x9E, 0x6E, 0xE8, 0x9F, 0x4B, 0xAE,
+    0x70, 0x30, 0x88, 0x37, 0x1F, 0x28, 0x1D, 0x48, 0x8F, 0x44, 0xDF, 0x35, 0x54, 0x06, 0xB2, 0x25,
+    0xA5, 0x25, 0xD1, 0x9F, 0x81, 0x4E, 0x71, 0xC8, 0x8A, 0x0C, 0xCF, 0x87, 0x3E, 0xF9, 0x09, 0x87,
+    0xD4, 0x6F, 0x64, 0x78, 0x79, 0xC7, 0x7C, 0x8A, 0xEC, 0x75, 0xF3, 0x04, 0x28, 0x87, 0xDC, 0x52,
+    0x4B, 0xB7, 0xE9, 0xAC, 0xB1, 0x55, 0xD2, 0xD8, 0x43, 0xEA, 0xE8, 0x1E, 0xCD, 0xBD, 0xF5, 0xBA,
+    0xD6, 0x1D, 0x60, 0xBE, 0x8B, 0x4A, 0xCB, 0x01, 0xF1, 0x4C, 0x13, 0x6E, 0x5E, 0xA2, 0xF9, 0x38,
+    0x47, 0x05, 0x32, 0x5E, 0x84, 0x73, 0x18, 0xA5, 0xF5, 0xB1, 0xC2, 0x6D, 0x3C, 0xE4, 0x51, 0xC6,
+    0x90, 0x89, 0xDE, 0x21, 0x17, 0xC8, 0x8C, 0x76, 0x04, 0x43, 0x8B, 0xD2, 0x2B, 0xA6, 0xF5, 0x96,
+    0x2E, 0xBC, 0x39, 0xA0, 0x4F, 0x82, 0xFA, 0xAD, 0xDE, 0x98, 0xD2, 0xC3, 0xE9, 0x7A, 0x4E, 0xEB,
+    0xF6, 0xBD, 0xD4, 0x9B, 0xBD, 0x93, 0xBD, 0xA0, 0x9A, 0xD2, 0x43, 0x69, 0x1B, 0x28, 0x55, 0x80,
+    0xB2, 0xBA, 0x93, 0x84, 0x74, 0x04, 0xEC, 0xBF, 0xB2, 0xD7, 0x1C, 0x5D, 0x08, 0x66, 0x88, 0x72,
+    0xC5, 0x2F, 0x13, 0x31, 0xF7, 0x2B, 0x64, 0x32, 0x70, 0xAC, 0x49, 0x3D, 0xC0, 0x9C, 0x22, 0x96,
+    0x17, 0x6C, 0x0C, 0x9F, 0x70, 0xBF, 0x6C, 0x9A, 0x46, 0x08, 0xE5, 0xE4, 0xE1, 0x64, 0x78, 0x80,
+    0xAD, 0x89, 0xDE, 0xD4, 0xFD, 0x2B, 0xD0, 0x5F, 0x8D, 0xEF, 0x8B, 0x3B, 0x1D, 0x8D, 0xCA, 0xC8,
+    0x80, 0x51, 0xB6, 0xCF, 0xA4, 0x5E, 0xB9, 0x34, 0xA7, 0xAE, 0xE5, 0xB7, 0x47, 0x82, 0x89, 0xAD,
+    0x66, 0xD8, 0x06, 0xE9, 0x9B, 0x5C, 0x5A, 0x55, 0x9F, 0x7D, 0x80, 0x5E, 0x2D, 0x85, 0x65, 0xF6,
+    0xF7, 0xFD, 0x41, 0x10, 0x33, 0x41, 0x00, 0x73, 0xD2, 0x2F, 0xC0, 0x7B, 0x2A, 0x1C, 0xDB, 0x3E,
+    0x47, 0x0E, 0x3F, 0x72, 0xAD, 0xB9, 0x7F, 0x85, 0xEE, 0x40, 0xD7, 0xAA, 0x36, 0xAD, 0xF5, 0x38,
+    0x92, 0x9A, 0x2D, 0x49, 0x8E, 0x98, 0xCA, 0x81, 0xEC, 0x45, 0x4F, 0x43, 0xD2, 0xE9, 0xA0, 0x1B,
+    0x53, 0x88, 0x3F, 0x34, 0xE5, 0x5A, 0x4F, 0xB9, 0xF0, 0xE2, 0xC0, 0xBB, 0xC2, 0x81, 0x70, 0x3D,
+    0x2C, 0x43, 0xE6, 0x5D, 0xED, 0xF8, 0x69, 0xEF, 0x7A, 0xE7, 0x5F, 0x93, 0x2C, 0xD6, 0x44, 0xA8,
+    0x5E, 0x6C, 0xF2, 0x23, 0x50, 0x19, 0xE3, 0xC5, 0x5F, 0xA3, 0x17, 0xA9, 0x28, 0xBA, 0xD8, 0x4D,
+    0x91, 0xDD, 0x71, 0x94, 0xCD, 0xA5, 0xEA, 0xD6, 0x09, 0x5A, 0xA7, 0x02, 0xCE, 0x5D, 0x31, 0x33,
+    0x5E, 0x12, 0xEE, 0xD2, 0x46, 0xEA, 0xE1, 0x84, 0xC6, 0x68, 0x33, 0x72, 0x93, 0xED, 0x0A, 0x10,
+    0x0A, 0xBA, 0xE3, 0xFE, 0x41, 0x2D, 0xB3, 0xB1, 0x14, 0x86, 0x03, 0x0C, 0x20, 0xEC, 0x2A, 0x10,
+    0x5E, 0xF5, 0xB7, 0xF8, 0xB1, 0x0C, 0x90, 0x01, 0x1D, 0xEB, 0x6F, 0xD1, 0xDB, 0x54, 0xEA, 0xA0,
+    0xFA, 0xAC, 0x4E, 0xEA, 0xDB, 0x57, 0x91, 0xDC, 0x34, 0xD7, 0xD5, 0xCA, 0x39, 0x76, 0xB7, 0xFC,
+    0x13, 0xFA, 0x74, 0xD2, 0x5D, 0xC9, 0x49, 0x43, 0x28, 0x8E, 0xCD, 0x2A, 0xE1, 0xCF, 0xB7, 0xBB,
+    0x91, 0x4E, 0x47, 0x31, 0xEB, 0x7B, 0x46, 0x72, 0x55, 0x21, 0xFB, 0x6C, 0x13, 0x17, 0x8A, 0x52,
+    0xC8, 0x30, 0x55, 0xF2, 0x84, 0x3E, 0xDE, 0x6A, 0xE2, 0x90, 0x91, 0x99, 0xAB, 0x9E, 0xEF, 0x8F,
+    0x71, 0xF2, 0x01, 0xAB, 0x97, 0x51, 0x2B, 0x58, 0x6D, 0xA0, 0x96, 0x78, 0x30, 0xA0, 0xAE, 0x33,
+    0xF5, 0xE0, 0x73, 0xAE, 0x30, 0x56, 0x46, 0xC7, 0x05, 0xC7, 0x8E, 0x27, 0x55, 0x50, 0x36, 0x6A,
+    0xAE, 0xED, 0xC5, 0x39, 0xF3, 0xBB, 0x6D, 0x3A, 0xA8, 0xDE, 0x01, 0x0F, 0x7B, 0x84, 0xE0, 0xA5,
+    0x9F, 0x9C, 0x02, 0xF9, 0x3E, 0x66, 0x1E, 0x12, 0xE6, 0xE7, 0x5F, 0xAA, 0xF1, 0xFD, 0x20, 0xC9,
+    0xC6, 0x79, 0x8B, 0x1C, 0x71, 0x23, 0xF7, 0x60, 0x4D, 0xCA, 0xC5, 0xEB, 0x8E, 0xFF, 0x42, 0x3C,
+    0xDC, 0x5A, 0x0E, 0x60, 0xE9, 0xDA, 0x92, 0xA8, 0x2D, 0x09, 0xC2, 0x3B, 0x64, 0x8F, 0xE7, 0x28,
+    0x18, 0x2F, 0x10, 0x5C, 0x2D, 0x8C, 0xB9, 0x21, 0x93, 0x11, 0x0F, 0xC6, 0xD5, 0x80, 0xF1, 0x09,
+    0x7C, 0xBE, 0x19, 0xA7, 0xA9, 0x5B, 0xF6, 0xB1, 0x0E, 0x93, 0xFB, 0x24, 0x65, 0x73, 0x28, 0xCB,
+    0x42, 0xB1, 0x9C, 0xB7, 0xB8, 0xF1, 0x11, 0x14, 0x1B, 0x50, 0x58, 0x28, 0xB6, 0xBE, 0xC7, 0x3B,
+    0xCF, 0xF0, 0xD7, 0x99, 0xE2, 0x2D, 0x8D, 0x8E, 0xEB, 0x01, 0xFE, 0x1F, 0x2D, 0x6D, 0x3F, 0x5E,
+    0x96, 0xCD, 0xE0, 0x8B, 0xC5, 0xA3, 0x69, 0xEC, 0xCF, 0x41, 0x9D, 0xE3, 0x8B, 0x81, 0x4F, 0xC7,
+    0x53, 0xF9, 0xBC, 0xF0, 0x45, 0x88, 0x3D, 0x8C, 0x66, 0x01, 0xFB, 0x89, 0xAB, 0x37, 0x2C, 0x02,
+    0x9A, 0x73, 0xA5, 0x36, 0xE9, 0x26, 0xEB, 0x6F, 0xB5, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE,
+    0xEC, 0xC9, 0xC5, 0x42, 0x53, 0x4C, 0x8A, 0x3B, 0x8A, 0x14, 0x71, 0x8F, 0x20, 0x6E, 0x29, 0xD8,
+    0x1B, 0x8B, 0x2B, 0x69, 0xB6, 0x60, 0x1B, 0x9A, 0xAB, 0x81, 0x82, 0x3F, 0x70, 0x77, 0x36, 0xE4,
+    0x0F, 0xA4, 0xA0, 0xA3, 0xA0, 0x49, 0x01, 0xD7, 0xD0, 0xA6, 0xC8, 0xC6, 0x93, 0x50, 0x50, 0x5C,
+    0xC1, 0x48, 0x11, 0x4A, 0x41, 0x63, 0x10, 0x02, 0x89, 0x14, 0x71, 0xC0, 0x28, 0x16, 0x3B, 0xF6,
+    0xF0, 0x3D, 0x6F, 0x4E, 0x09, 0x97, 0xB4, 0xB1, 0x76, 0xC7, 0xCF, 0xEB, 0x79, 0x6F, 0xBE, 0xEF,
+    0xBD, 0xEF, 0xBD, 0xC5, 0xE5, 0x2F, 0x81, 0x22, 0x0E, 0x30, 0x31, 0xF6, 0xAA, 0x47, 0xE5, 0x8E,
+    0x80, 0x98, 0x02, 0xB4, 0xF9, 0xC2, 0x01, 0x49, 0xA0, 0x61, 0x68, 0x60, 0xDC, 0x5B, 0xAD, 0x0E,
+    0x1F, 0xC6, 0x18, 0xC7, 0x86, 0xCB, 0xCF, 0x1E, 0x08, 0x6B, 0xBE, 0x3A, 0xF3, 0x48, 0x86, 0x13,
+    0xC0, 0xD2, 0x45, 0xB7, 0x85, 0x4F, 0x03, 0x62, 0x9C, 0x90, 0xC6, 0x58, 0x22, 0xF9, 0x98, 0x7E,
+    0xBB, 0x48, 0xE2, 0xA0, 0x62, 0xBC, 0xD7, 0xAA, 0xE1, 0x0A, 0x2C, 0x90, 0xB5, 0x74, 0xA5, 0x43,
+    0x15, 0xE3, 0x63, 0x46, 0xFA, 0x69, 0xB5, 0xE9, 0xB0, 0xBF, 0x46, 0x91, 0xBB, 0xFC, 0x8B, 0xE9,
+    0x3B, 0x57, 0xC4, 0x1A, 0x2B, 0xFA, 0x2D, 0x93, 0x12, 0xB9, 0x1B, 0x91, 0x86, 0xDC, 0xC3, 0xD4,
+    0x82, 0xE3, 0xFC, 0x7A, 0xFD, 0xA8, 0x77, 0xB0, 0xD4, 0x6D, 0xA5, 0x42, 0xE1, 0x8E, 0x94, 0x7F,
+    0x76, 0xAA, 0xE0, 0x89, 0xB5, 0x8D, 0xE1, 0x1A, 0xEC, 0xE7, 0x50, 0x1D, 0x70, 0x32, 0x1F, 0xA2,
+    0x9E, 0xD2, 0x55, 0x4E, 0x58, 0x1D, 0x36, 0x50, 0x8F, 0x7C, 0xFA, 0x24, 0x24, 0x43, 0xF1, 0x67,
+    0x48, 0x89, 0x70, 0x67, 0x29, 0x8E, 0xCC, 0x01, 0x2F, 0xD5, 0xD9, 0x5A, 0x9E, 0x46, 0xD3, 0xCA,
+    0xA3, 0x4D, 0x7B, 0x5C, 0xBC, 0xE6, 0x7D, 0x09, 0x29, 0xE4, 0xB1, 0xD5, 0x9D, 0x66, 0x88, 0x36,
+    0xE3, 0x52, 0x1A, 0xA7, 0x36, 0x48, 0x3A, 0xD5, 0xA5, 0x3C, 0x75, 0x1F, 0x21, 0xE1, 0x4D, 0x39,
+    0x8B, 0x81, 0xDB, 0x6F, 0x1B, 0xA1, 0x0F, 0xA3, 0xBA, 0x85, 0x38, 0xFF, 0x33, 0x7E, 0x26, 0x41,
+    0x98, 0x5C, 0x39, 0xCC, 0x7E, 0xFD, 0xFB, 0x9C, 0x93, 0x83, 0xCE, 0xCE, 0x19, 0x09, 0x9A, 0x67,
+    0x1B, 0x6F, 0x31, 0x02, 0xBA, 0x33, 0x2E, 0x77, 0xC8, 0x18, 0x56, 0x0D, 0xE0, 0x27, 0xA0, 0x2A,
+    0x55, 0x60, 0x89, 0x74, 0xAF, 0x46, 0x34, 0x13, 0xE2, 0xC1, 0xC8, 0x40, 0xB5, 0x19, 0x3E, 0x9C,
+    0xD1, 0x71, 0xBD, 0xB9, 0x23, 0x44, 0x7A, 0x5B, 0xCE, 0x2B, 0x4F, 0x48, 0xDB, 0x6B, 0xFF, 0xA7,
+    0x70, 0x49, 0x96, 0xB2, 0xA8, 0xAB, 0x90, 0x75, 0x45, 0x5B, 0xF5, 0x79, 0x97, 0xF4, 0xDA, 0xED,
+    0x03, 0x47, 0xDA, 0xDD, 0x06, 0xDE, 0xD1, 0x8E, 0xD8, 0x8D, 0xBE, 0x4F, 0x1C, 0xFA, 0xAB, 0x87,
+    0x2C, 0x11, 0x8B, 0xC8, 0x35, 0xFF, 0xE0, 0x7B, 0xA1, 0xA6, 0xEF, 0x11, 0xEE, 0x1D, 0xED, 0x02,
+    0xCB, 0xA3, 0xDD, 0x09, 0x73, 0xA6, 0x9D, 0x2D, 0x8D, 0x2F, 0x7E, 0x33, 0xBE, 0xAA, 0x9B, 0x90,
+    0x0D, 0x73, 0x8A, 0xA8, 0x8D, 0x4B, 0x14, 0x47, 0x40, 0x93, 0xF5, 0xC9, 0x30, 0x17, 0x7A, 0x5B,
+    0xA2, 0x6F, 0xA5, 0x84, 0x75, 0xF1, 0x6F, 0xA4, 0x70, 0xEC, 0x41, 0x8B, 0xBB, 0xA6, 0x4C, 0x86,
+    0xB7, 0x67, 0xC9, 0x15, 0x7C, 0xCF, 0x82, 0x1C, 0x3A, 0x54, 0x13, 0xE5, 0x12, 0xB9, 0x3B, 0x8A,
+    0x40, 0xC8, 0x81, 0x69, 0xD4, 0x7F, 0xD4, 0x54, 0x24, 0xD5, 0xC1, 0x64, 0xFF, 0x12, 0x1F, 0x91,
+    0x7B, 0xF4, 0x78, 0x73, 0x89, 0xB4, 0xDC, 0x15, 0xBA, 0xAC, 0xD9, 0xF5, 0xA4, 0x3D, 0x3F, 0x66,
+    0x09, 0x1D, 0x5B, 0x13, 0xA7, 0xAC, 0xCE, 0x5D, 0x29, 0x42, 0xB8, 0x03, 0x2C, 0x70, 0x75, 0x0D,
+    0x45, 0x27, 0xD1, 0x5E, 0x5E, 0x43, 0xFD, 0xEA, 0x92, 0x21, 0x20, 0x14, 0x9B, 0x31, 0x8D, 0xE3,
+    0x56, 0x08, 0x33, 0xD9, 0xC0, 0xEF, 0x68, 0xEA, 0x74, 0x30, 0x84, 0x65, 0xB8, 0xF5, 0x0D, 0xD1,
+    0x51, 0x32, 0x60, 0x96, 0x94, 0x99, 0x64, 0x13, 0x25, 0x97, 0x77, 0x5B, 0x60, 0xD2, 0x2A, 0xCF,
+    0xBF, 0xEF, 0xF1, 0x37, 0x5B, 0xEB, 0xAE, 0x20, 0xBC, 0x8C, 0x82, 0xC5, 0xDE, 0x92, 0x9D, 0x10,
+    0x6F, 0x30, 0xEC, 0x3E, 0x8A, 0x1B, 0x2E, 0x6B, 0xDF, 0x95, 0x48, 0x4C, 0xB7, 0xA9, 0xE7, 0x78,
+    0x77, 0x25, 0x5C, 0x89, 0x4F, 0xB9, 0x55, 0xF7, 0xDB, 0xE6, 0x08, 0xDB, 0xD6, 0x90, 0xDB, 0x7D,
+    0x66, 0xE7, 0x98, 0x4D, 0x30, 0x35, 0x3E, 0x8F, 0x1D, 0xAE, 0xDE, 0x22, 0x08, 0x89, 0x8A, 0x26,
+    0x92, 0xEC, 0xE5, 0xD3, 0x6F, 0x5E, 0x52, 0x28, 0xDF, 0x94, 0x79, 0x7C, 0x4A, 0x84, 0xCD, 0x20,
+    0xF1, 0x45, 0x2E, 0x0C, 0x47, 0x73, 0x56, 0x0E, 0xA2, 0x98, 0x56, 0x4C, 0xF3, 0x23, 0x4D, 0xD5,
+    0x89, 0x19, 0x64, 0x83, 0x95, 0xBD, 0xC6, 0xD1, 0xFC, 0xBB, 0x13, 0x33, 0x88, 0x5B, 0x9C, 0x23,
+    0xB8, 0x6D, 0x84, 0xF3, 0x60, 0x45, 0x2C, 0x35, 0x47, 0x43, 0x9F, 0x10, 0xCA, 0x5B, 0xA7, 0x37,
+    0x99, 0x6C, 0x42, 0xFA, 0xE4, 0xB4, 0xBE, 0x00, 0x24, 0xA8, 0xB8, 0x61, 0x3F, 0x8E, 0xDA, 0x93,
+    0xEF, 0x31, 0x55, 0x9D, 0x79, 0xCA, 0xF6, 0x18, 0x1B, 0x1A, 0x8B, 0x05, 0x8E, 0xCD, 0x81, 0xCF,
+    0x1E, 0xF8, 0x05, 0x4E, 0x7A, 0xE5, 0xB3, 0xC0, 0x02, 0x55, 0xA0, 0xE1, 0xB1, 0x48, 0x63, 0x9D,
+    0x4F, 0x71, 0x54, 0x64, 0x9C, 0x94, 0xA2, 0xA7, 0x29, 0x93, 0xCC, 0xB7, 0x0D, 0xCD, 0x75, 0xD6,
+    0xBE, 0x44, 0x59, 0x0B, 0x94, 0x58, 0x8D, 0x34, 0xEA, 0x73, 0xB6, 0x5B, 0xAC, 0x56, 0x4C, 0x23,
+    0xA6, 0x9A, 0x89, 0x07, 0x31, 0xAD, 0x6C, 0x60, 0xAB, 0x31, 0xAF, 0x9D, 0x98, 0x41, 0xF6, 0xDA,
+    0x99, 0xAD, 0x13, 0xB3, 0x13, 0x33, 0xBC, 0x98, 0x3A, 0xB0, 0xC7, 0x7B, 0x36, 0x5C, 0x94, 0xDC,
+    0xB6, 0xD8, 0xE5, 0xA4, 0xD1, 0x82, 0x66, 0xD2, 0x1D, 0x32, 0xB7, 0xB8, 0x88, 0xC6, 0xD9, 0xC8,
+    0xE4, 0x47, 0x4F, 0xBD, 0xB5, 0xE4, 0x23, 0x9C, 0x2D, 0x89, 0x99, 0x35, 0x8E, 0xD5, 0x03, 0x1A,
+    0x3D, 0xC9, 0x2F, 0x48, 0xF5, 0x71, 0x49, 0xCE, 0x8E, 0x46, 0x47, 0xF2, 0xC7, 0x24, 0x5F, 0x0C,
+    0x09, 0xF3, 0xEA, 0x6D, 0xE4, 0x7C, 0xBB, 0x22, 0x03, 0x80, 0x00, 0x94, 0x8C, 0x57, 0x9C, 0x08,
+    0x8A, 0x17, 0xAE, 0x9D, 0x5B, 0xF3, 0x0C, 0xA1, 0x62, 0x9A, 0x0D, 0x51, 0xB3, 0x20, 0xEC, 0x35,
+    0xFE, 0x52, 0x57, 0xE2, 0x56, 0xB0, 0x14, 0x93, 0x68, 0xA8, 0xF8, 0x81, 0x6E, 0xD9, 0x93, 0x59,
+    0x9A, 0x77, 0x65, 0xDC, 0xC8, 0x1B, 0x73, 0x26, 0xD3, 0x49, 0x7E, 0x4C, 0x02, 0xB7, 0xB3, 0x07,
+    0x99, 0x52, 0xFB, 0x7E, 0x10, 0xF5, 0xB1, 0xD4, 0xB9, 0xCB, 0x46, 0x14, 0x5E, 0x26, 0x94, 0x9F,
+    0xBB, 0x95, 0xA7, 0x71, 0xB2, 0x24, 0x1C, 0x2D, 0x14, 0x49, 0x99, 0xB1, 0xDB, 0xD2, 0xF6, 0xFA,
+    0x73, 0x28, 0x4C, 0x86, 0xCC, 0x22, 0xFE, 0x83, 0x38, 0xE3, 0x73, 0x42, 0x56, 0xFD, 0x3E, 0xBB,
+    0x80, 0x53, 0x3C, 0xB0, 0xED, 0x82, 0x24, 0x72, 0xDC, 0x4E, 0xF5, 0xD0, 0xB0, 0x8D, 0x2C, 0x1B,
+    0xB2, 0xF0, 0xBA, 0x35, 0x53, 0x53, 0x4B, 0xE3, 0x61, 0x8F, 0xFE, 0xF8, 0x88, 0x4B, 0x26, 0xC3,
+    0x5D, 0x4F, 0x0D, 0x85, 0xC7, 0x64, 0x3B, 0xC9, 0xED, 0x20, 0x85, 0xAF, 0xE4, 0x6F, 0xC3, 0xB4,
+    0x0C, 0x94, 0xCE, 0x78, 0x2B, 0x21, 0x91, 0x9F, 0x71, 0xA2, 0xC7, 0xBF, 0x64, 0x79, 0xC6, 0x4C,
+    0x86, 0x94, 0xD0, 0xD5, 0xED, 0x28, 0xAD, 0xCA, 0xE7, 0x34, 0xB0, 0x8C, 0x6C, 0xF7, 0xCA, 0xA7,
+    0xA3, 0x44, 0x1F, 0xB7, 0xFF, 0x4A, 0xC0, 0xAA, 0x7C, 0x35, 0xEE, 0x05, 0xF1, 0x09, 0xE6, 0xF5,
+    0x6A, 0x15, 0x24, 0xF0, 0xC8, 0xFB, 0x7A, 0x9B, 0xBA, 0xC1, 0x22, 0x7D, 0x05, 0xEE, 0xD7, 0x7C,
+    0xFD, 0x07, 0xBD, 0x55, 0x3D, 0x8F, 0xE4, 0x44, 0x10, 0x7D, 0x6E, 0x6B, 0xD6, 0x3A, 0x59, 0xA7,
+    0x26, 0xD8, 0x23, 0x41, 0x9C, 0x13, 0x22, 0x24, 0x70, 0x42, 0xB8, 0x37, 0x6D, 0xFE, 0xC1, 0x06,
+    0xB7, 0xA4, 0x47, 0x4C, 0xC0, 0x11, 0x10, 0xB2, 0x33, 0xBE, 0xE3, 0x0F, 0x5C, 0x44, 0x4C, 0x40,
+    0xB4, 0x48, 0xC4, 0x1B, 0xCC, 0xAE, 0x8D, 0x08, 0x36, 0x20, 0xC0, 0x42, 0x42, 0xA4, 0x1D, 0x20,
+    0x11, 0x90, 0x58, 0x87, 0x4F, 0xF2, 0x9D, 0xDA, 0x2E, 0x5E, 0xF5, 0xCC, 0xB2, 0x1F, 0xE2, 0x48,
+    0x90, 0x70, 0x50, 0xE3, 0xEA, 0x2E, 0x77, 0xBD, 0xAA, 0x7A, 0xFD, 0x06, 0x0B, 0xBC, 0x01, 0xE4,
+    0xBD, 0x03, 0xD2, 0x50, 0x74, 0xC0, 0x2A, 0xED, 0x71, 0xFD, 0x59, 0x7C, 0x43, 0xB3, 0x96, 0x01,
+    0x68, 0xFE, 0x90, 0x16, 0x52, 0xE5, 0x01, 0x0D, 0x57, 0xEA, 0x35, 0x90, 0xF5, 0xAE, 0x02, 0x66,
+    0xDB, 0x02, 0xE5, 0x05, 0x3F, 0xCB, 0x9E, 0x8F, 0x40, 0x12, 0x1A, 0xE1, 0x53, 0xAA, 0xF9, 0xD1,
+    0xF3, 0xD8, 0xE7, 0x41, 0x17, 0x19, 0x8E, 0x73, 0xCB, 0x04, 0xCE, 0xD0, 0x2F, 0x5B, 0xD7, 0xA2,
+    0x68, 0xB3, 0x09, 0x65, 0xC7, 0xD3, 0xA5, 0x83, 0x11, 0xA9, 0x99, 0xED, 0x21, 0x63, 0x9F, 0x2D,
+    0x90, 0xF2, 0xE4, 0x6C, 0x70, 0x95, 0xF1, 0xEF, 0x5F, 0x41, 0x49, 0x98, 0xAC, 0x99, 0x91, 0x8A,
+    0xB4, 0xB6, 0x2B, 0x08, 0x39, 0x1D, 0x1E, 0x20, 0x19, 0x37, 0x40, 0x38, 0x3B, 0x3A, 0x0A, 0xCC,
+    0x17, 0x26, 0xFE, 0x9E, 0xD1, 0x3F, 0x07, 0x46, 0x07, 0xD3, 0x97, 0x5D, 0xEE, 0xED, 0xDC, 0xD4,
+    0x46, 0x26, 0xE0, 0x5E, 0xC5, 0x23, 0x16, 0xC4, 0x9E, 0x0E, 0x5A, 0x71, 0x85, 0xE5, 0x8D, 0x5A,
+    0xEF, 0x1D, 0x6E, 0x0B, 0x25, 0x72, 0x6F, 0x06, 0x34, 0x6D, 0x89, 0x64, 0x36, 0x9E, 0xA1, 0x6F,
+    0x13, 0x35, 0x73, 0x1B, 0x56, 0x47, 0xD0, 0xC9, 0xD1, 0x47, 0x01, 0x8E, 0x20, 0x08, 0x24, 0xC4,
+    0x15, 0x42, 0xD3, 0xAD, 0xB2, 0xAA, 0x08, 0xFC, 0x80, 0x75, 0xE6, 0x1D, 0x57, 0x9B, 0x3A, 0x1F,
+    0x18, 0x32, 0x21, 0x97, 0x99, 0x11, 0xAC, 0xEC, 0x0E, 0x0E, 0x6D, 0x37, 0xA7, 0x83, 0xAB, 0x4F,
+    0xB3, 0xF6, 0xB2, 0xA8, 0x43, 0x26, 0xAC, 0x9D, 0x84, 0xFB, 0x58, 0x3F, 0x81, 0x02, 0x22, 0xFE,
+    0xA2, 0x7E, 0xF7, 0x5B, 0x6F, 0x65, 0x4C, 0x8E, 0x56, 0x74, 0x2A, 0x64, 0x17, 0x48, 0xFF, 0xEC,
+    0xCD, 0xD0, 0xC8, 0x90, 0x13, 0x21, 0x0B, 0x41, 0xA6, 0x15, 0xB1, 0x69, 0x7C, 0xFD, 0xE4, 0xA4,
+    0xC6, 0xAD, 0x27, 0x97, 0x90, 0xCA, 0x4B, 0x79, 0x89, 0xC7, 0x23, 0x8F, 0x34, 0x3D, 0xB4, 0x21,
+    0xE0, 0xA0, 0x36, 0x5A, 0xC5, 0x92, 0xF5, 0xA0, 0x60, 0x94, 0xB7, 0xFC, 0x32, 0x28, 0x96, 0xE2,
+    0x4B, 0x1D, 0x55, 0xAF, 0xFD, 0x58, 0x9D, 0xD2, 0x58, 0xAD, 0x2C, 0x99, 0xF5, 0x2C, 0x17, 0x0F,
+    0xD4, 0x14, 0x1A, 0x98, 0xFE, 0xCA, 0x19, 0x42, 0xBC, 0x6E, 0xF8, 0xDD, 0x50, 0x80, 0x13, 0x42,
+    0xB0, 0xDA, 0x8D, 0x93, 0x93, 0xEA, 0x26, 0x92, 0xF5, 0x9C, 0xCA, 0x85, 0x74, 0xE5, 0xC8, 0xD9,
+    0x2F, 0xB1, 0x42, 0xDE, 0x12, 0xD0, 0xC8, 0x5E, 0x31, 0x7F, 0x20, 0xB0, 0xBC, 0x7D, 0x00, 0x2C,
+    0xF3, 0x96, 0xC9, 0xC9, 0xB1, 0xE2, 0x11, 0x3F, 0x79, 0xC5, 0x73, 0x73, 0xCD, 0xEF, 0x98, 0xD4,
+    0x28, 0xA4, 0xE5, 0x2E, 0x39, 0x18, 0xF2, 0x19, 0x5B, 0x62, 0x95, 0x2B, 0x8A, 0x61, 0xCF, 0x6F,
+    0x89, 0xB1, 0x4F, 0x60, 0x43, 0x59, 0x2B, 0x19, 0x19, 0xEF, 0x92, 0xE1, 0x76, 0x43, 0xD8, 0x29,
+    0xC8, 0xBC, 0x9E, 0xAB, 0xB7, 0x66, 0xF0, 0xE8, 0x0D, 0x18, 0xBC, 0xD4, 0x76, 0x97, 0x1C, 0x17,
+    0xD8, 0x06, 0xDB, 0x32, 0x81, 0x19, 0x53, 0xAF, 0x9F, 0x2B, 0x97, 0xBD, 0x8E, 0x34, 0x1C, 0xE8,
+    0x80, 0xBF, 0xA3, 0x49, 0x25, 0x56, 0xA3, 0x6D, 0x50, 0xBE, 0xC3, 0xC4, 0xE2, 0x15, 0xDC, 0x0B,
+    0x4D, 0xE6, 0x34, 0xDA, 0xAA, 0xC1, 0xA1, 0x9A, 0x8F, 0xF7, 0x2A, 0x52, 0x20, 0xC0, 0x04, 0xD2,
+    0xC3, 0x56, 0xA7, 0x37, 0xD1, 0x64, 0xE2, 0x5D, 0x58, 0x4F, 0x46, 0xEA, 0x09, 0xA9, 0xCF, 0x3C,
+    0xF1, 0x38, 0x82, 0x30, 0x03, 0x0F, 0xB4, 0xE4, 0x1D, 0x36, 0x69, 0xC7, 0x0D, 0x32, 0xDB, 0x59,
+    0x92, 0xF6, 0x05, 0xD3, 0x58, 0x05, 0xD1, 0xE8, 0x00, 0x22, 0xD5, 0x14, 0x91, 0x22, 0xF8, 0x42,
+    0xD3, 0x92, 0x20, 0x3C, 0x03, 0xC2, 0x1D, 0xAB, 0x23, 0xFB, 0xF4, 0x5A, 0xAA, 0xA4, 0xBD, 0x4B,
+    0xB0, 0x03, 0x31, 0x13, 0x8A, 0xDF, 0x5E, 0xF2, 0xE8, 0xE2, 0xEB, 0xF4, 0xFA, 0xA8, 0x4A, 0xE9,
+    0xAD, 0xFC, 0x2E, 0xBF, 0x25, 0x8D, 0xE7, 0x66, 0xDE, 0x92, 0x26, 0x4C, 0xA0, 0x77, 0x88, 0x34,
+    0xE1, 0xC0, 0xD8, 0x35, 0xE6, 0x2A, 0xEB, 0xA5, 0xD2, 0xA4, 0x50, 0x9A, 0x28, 0x77, 0xEC, 0x0F,
+    0x4A, 0xFE, 0x57, 0x91, 0x0D, 0xDA, 0x8B, 0x2C, 0x76, 0x40, 0x67, 0x87, 0x78, 0x71, 0x35, 0xD0,
+    0x3E, 0xAA, 0xB4, 0x7D, 0xDA, 0xB9, 0x68, 0x16, 0x57, 0x49, 0x0F, 0x2C, 0x27, 0xFD, 0x33, 0xFB,
+    0x17, 0x48, 0xB2, 0x52, 0x49, 0xD0, 0xD1, 0x79, 0xE7, 0xCE, 0xFF, 0xDC, 0xA9, 0x85, 0xCE, 0xCC,
+    0x3D, 0x21, 0x6C, 0xF7, 0x54, 0xC5, 0xE9, 0xC3, 0xF1, 0x36, 0x7D, 0x9C, 0x3C, 0x95, 0xA9, 0x9C,
+    0x13, 0x19, 0xA8, 0x1D, 0x45, 0x7B, 0xCB, 0x98, 0xBF, 0x4D, 0x12, 0x54, 0x0E, 0x44, 0x0D, 0x55,
+    0x90, 0x12, 0xA7, 0x06, 0x0F, 0x55, 0x22, 0xF0, 0x3A, 0x13, 0xB5, 0x29, 0xA7, 0x39, 0xDC, 0x23,
+    0xEE, 0x8C, 0x94, 0xFC, 0x3E, 0xB0, 0x11, 0xEF, 0xDD, 0xE2, 0x6F, 0xBF, 0x9E, 0x9A, 0xB1, 0x98,
+    0x99, 0x66, 0x43, 0x89, 0x28, 0x79, 0x83, 0xF2, 0x36, 0xEF, 0x4C, 0x4F, 0xE9, 0x61, 0x4F, 0x7E,
+    0x69, 0xA2, 0x2E, 0xE2, 0xCD, 0xAF, 0x74, 0x0C, 0x9B, 0x5D, 0xE1, 0xB9, 0x2A, 0x33, 0x25, 0xA2,
+    0x8C, 0xF7, 0x95, 0x77, 0x80, 0x13, 0xA6, 0xCE, 0x86, 0xA8, 0xF2, 0x24, 0x41, 0xDA, 0x39, 0xE4,
+    0x1C, 0xD7, 0xBE, 0xEA, 0x8E, 0x72, 0xC2, 0x6D, 0xA7, 0xF7, 0x7A, 0x37, 0x97, 0x1E, 0x2A, 0xD7,
+    0x97, 0x5B, 0x7A, 0x3D, 0xF5, 0x66, 0xDE, 0xA7, 0xFB, 0x01, 0xB4, 0xE8, 0xC7, 0xDC, 0x3E, 0x5F,
+    0xF4, 0x45, 0x75, 0x90, 0x75, 0x36, 0x19, 0x4C, 0x7D, 0xBC, 0x95, 0xB0, 0x0E, 0x7A, 0x2B, 0x77,
+    0x0E, 0x55, 0x55, 0x7C, 0x14, 0x0C, 0x9E, 0x43, 0x22, 0xE9, 0x6D, 0xFA, 0x1C, 0xB8, 0xBB, 0xAB,
+    0x76, 0x3F, 0xAA, 0x8A, 0xED, 0xCE, 0xD5, 0x99, 0xF4, 0x4A, 0x33, 0xFF, 0x19, 0xFE, 0xE9, 0xC9,
+    0x39, 0xCB, 0x4C, 0xC2, 0x9A, 0xD3, 0x74, 0x73, 0xE5, 0xA2, 0x0C, 0x2B, 0x5E, 0xF6, 0xE9, 0x5F,
+    0x1C, 0x79, 0xA6, 0xCE, 0x56, 0xE8, 0xDD, 0x11, 0xA5, 0x5E, 0x77, 0xA6, 0x18, 0x96, 0xF9, 0xE8,
+    0xB8, 0xE8, 0xA4, 0x7D, 0x74, 0x56, 0xD1, 0xB1, 0x9D, 0x3A, 0xD9, 0x68, 0x06, 0x76, 0x72, 0x36,
+    0xC2, 0x7F, 0x9C, 0x99, 0xFF, 0x18, 0x97, 0x4A, 0x6E, 0x54, 0x85, 0x88, 0xD6, 0x2B, 0x72, 0x25,
+    0xD7, 0x95, 0xC8, 0x5F, 0x87, 0xEB, 0x13, 0x99, 0x9A, 0x89, 0xCC, 0xA8, 0xCF, 0xB4, 0x2A, 0xF6,
+    0x85, 0x7D, 0x3C, 0xBE, 0x7A, 0x5D, 0x4B, 0xC7, 0x57, 0x0A, 0xBB, 0xAE, 0x06, 0x5D, 0xCD, 0x3A,
+    0x7D, 0x3D, 0x8E, 0xAF, 0x94, 0x94, 0xE3, 0x84, 0xAB, 0xFC, 0x93, 0xCA, 0xE4, 0x27, 0xCE, 0x52,
+    0xC9, 0xF3, 0x1F, 0x9E, 0xBF, 0x00, 0xAD, 0x54, 0x31, 0x4C, 0x26, 0x45, 0x14, 0xFE, 0x76, 0xE7,
+    0x87, 0x49, 0xDC, 0xE8, 0x50, 0xFC, 0x76, 0xFE, 0x6E, 0x65, 0x61, 0x44, 0x7E, 0x0B, 0x8A, 0x2B,
+    0x7E, 0xD8, 0x41, 0x8A, 0x4B, 0x34, 0x1A, 0x12, 0x25, 0x26, 0x5E, 0x4C, 0xA8, 0x69, 0xBC, 0x82,
+    0xC2, 0x02, 0xF8, 0xF7, 0x72, 0xB1, 0x96, 0xEE, 0x5A, 0x1A, 0xA3, 0x42, 0xF4, 0x62, 0x62, 0x41,
+    0x01, 0xFC, 0x0B, 0xC4, 0x5C, 0xA2, 0x85, 0x43, 0x28, 0x2C, 0x28, 0xDC, 0xA8, 0x97, 0x18, 0xAE,
+    0x60, 0x62, 0x26, 0x71, 0x83, 0xFB, 0xEF, 0xF3, 0xCD, 0xFE, 0x80, 0x84, 0x3B, 0xC9, 0x89, 0xBE,
+    0xCC, 0x9B, 0xDD, 0x79, 0xEF, 0xCD, 0xF7, 0xDE, 0x37, 0xFB, 0x76, 0x00, 0xA0, 0x4D, 0x54, 0xC5,
+    0xAC, 0x28, 0xB1, 0xCC, 0x3A, 0x71, 0xAA, 0xA3, 0xAC, 0x4D, 0x56, 0x78, 0x4D, 0xA8, 0x5F, 0xEB,
+    0xD9, 0xFA, 0x49, 0x1A, 0x51, 0xC1, 0x31, 0x7E, 0xF1, 0x2A, 0xEB, 0xD8, 0x40, 0x5B, 0x5B, 0x9C,
+    0xA0, 0x60, 0xA7, 0x41, 0x8F, 0xE8, 0x43, 0x22, 0xB3, 0x3D, 0x64, 0x63, 0xDD, 0x91, 0x46, 0x05,
+    0x2E, 0xFC, 0x78, 0xFB, 0x5D, 0x41, 0x84, 0x5B, 0x0F, 0x75, 0xE0, 0x80, 0x25, 0x20, 0xD6, 0x90,
+    0x86, 0x91, 0x56, 0x94, 0x07, 0x52, 0x40, 0x68, 0x00, 0x8B, 0xB8, 0x84, 0xE0, 0x75, 0x13, 0x03,
+    0x51, 0x54, 0x28, 0xDA, 0xA1, 0x22, 0xE8, 0x19, 0xE9, 0xFC, 0x9E, 0x1E, 0x54, 0x0A, 0x65, 0x55,
+    0x06, 0xF4, 0x23, 0x9E, 0xE2, 0x07, 0xBC, 0x2D, 0xA4, 0x9C, 0x63, 0x13, 0xCB, 0x13, 0x47, 0x01,
+    0x82, 0xE0, 0x8D, 0xBC, 0x0E, 0x1C, 0x33, 0x41, 0x11, 0x73, 0x64, 0x19, 0x32, 0xEE, 0x16, 0x92,
+    0x94, 0xB9, 0x73, 0x54, 0x02, 0xC6, 0xEA, 0x15, 0x50, 0x86, 0xCB, 0x0A, 0x0B, 0x9F, 0x2C, 0xA9,
+    0x33, 0x66, 0x1E, 0xC5, 0xE3, 0x49, 0x8F, 0x47, 0x1E, 0x2F, 0xCE, 0x91, 0x54, 0x92, 0x3E, 0xA1,
+    0x29, 0x32, 0x5D, 0x2E, 0x40, 0x5A, 0x2E, 0x62, 0x39, 0x4A, 0x11, 0xFD, 0xC8, 0xD1, 0x3D, 0x56,
+    0xC5, 0x55, 0x48, 0xC6, 0x17, 0x3F, 0x65, 0x10, 0xFB, 0xCC, 0x21, 0x6F, 0xA7, 0xC2, 0x0A, 0x17,
+    0x55, 0x48, 0x22, 0x32, 0x35, 0x9E, 0x3F, 0x2F, 0x66, 0xE0, 0x69, 0x23, 0x64, 0x6C, 0x9F, 0xD4,
+    0x1F, 0xD8, 0xF0, 0xAF, 0x57, 0x72, 0xCD, 0x2F, 0x71, 0xFD, 0xF3, 0x8C, 0x6B, 0xFD, 0x25, 0xC3,
+    0x75, 0x5A, 0xD3, 0x03, 0xE3, 0x65, 0xAE, 0x9B, 0x97, 0xB9, 0x06, 0xBD, 0x8A, 0xB9, 0x12, 0xA5,
+    0x57, 0x93, 0x61, 0x5C, 0x13, 0xDC, 0xAA, 0x66, 0x20, 0x7E, 0xF0, 0x64, 0x8A, 0x0B, 0x64, 0x02,
+    0x3A, 0xA4, 0x7D, 0x2A, 0xDE, 0x5F, 0x3B, 0x97, 0xD5, 0x99, 0xF7, 0x3E, 0x88, 0xB5, 0x4D, 0xBE,
+    0xFD, 0xF4, 0x19, 0xAC, 0xFE, 0xF3, 0xF0, 0x22, 0x35, 0x5A, 0xC0, 0xF8, 0xFC, 0xFA, 0xE1, 0xDA,
+    0xD6, 0xAA, 0x7C, 0x23, 0x30, 0xAB, 0x0B, 0xEC, 0x58, 0xC5, 0xD3, 0x4E, 0x03, 0x69, 0x31, 0x4E,
+    0x90, 0x61, 0x79, 0xED, 0xDE, 0xD1, 0x57, 0x2D, 0xCC, 0x2D, 0x0C, 0xC3, 0xCC, 0x61, 0x18, 0x78,
+    0xFA, 0x09, 0xF3, 0x6B, 0x5D, 0x7A, 0x44, 0xEE, 0xF4, 0xC1, 0xCD, 0xFA, 0xC8, 0x9F, 0x24, 0xCB,
+    0xEC, 0xEC, 0xEC, 0x3B, 0x44, 0x74, 0xC4, 0xBC, 0xF4, 0xEC, 0x40, 0xBA, 0x54, 0xCB, 0xC9, 0x80,
+    0xED, 0xE7, 0x4F, 0xB6, 0x36, 0x83, 0xE9, 0x7C, 0x72, 0x52, 0xFC, 0xF2, 0x5F, 0xA7, 0x9F, 0x57,
+    0x5E, 0x66, 0xB8, 0xCF, 0x18, 0xF9, 0x21, 0x27, 0xF1, 0x15, 0xF1, 0xEB, 0x1F, 0xAC, 0xFE, 0x93,
+    0x23, 0x08, 0x72, 0xBB, 0x31, 0x11, 0xBF, 0xB9, 0x5F, 0x26, 0x7E, 0x51, 0x2A, 0xB3, 0x25, 0xCD,
+    0xA6, 0x9A, 0xB2, 0x9D, 0xC7, 0x96, 0x0D, 0x75, 0xF8, 0xBB, 0x5B, 0x52, 0xAF, 0xE7, 0x1D, 0x99,
+    0x22, 0xC0, 0xC8, 0x8B, 0xA1, 0xB1, 0x71, 0x94, 0xBA, 0x09, 0xB9, 0xE3, 0xDA, 0x91, 0xE9, 0xC7,
+    0xBB, 0x65, 0x22, 0x7C, 0x7B, 0xB3, 0x8F, 0xDF, 0x95, 0x29, 0xA3, 0x7A, 0x77, 0x94, 0x15, 0x4A,
+    0xBB, 0x38, 0xCC, 0x3B, 0x22, 0xAB, 0xBD, 0x33, 0x8F, 0x79, 0xED, 0xB9, 0xB7, 0x01, 0xDD, 0x8F,
+    0xBF, 0xB7, 0xDB, 0xED, 0x69, 0xBB, 0x14, 0x65, 0x7E, 0xD7, 0xA4, 0xC8, 0x16, 0x65, 0xFA, 0x91,
+    0x2F, 0x76, 0x88, 0x77, 0x73, 0x0F, 0xC6, 0x29, 0x77, 0x24, 0xB7, 0xB6, 0x0E, 0xB4, 0x6B, 0x24,
+    0xC7, 0xBD, 0x03, 0xA2, 0xFE, 0x4B, 0x6A, 0x2A, 0x85, 0xF3, 0x46, 0x5C, 0x7A, 0xF8, 0xC8, 0xF4,
+    0xFC, 0x71, 0x0A, 0xA1, 0xAE, 0x82, 0x48, 0x2F, 0x6C, 0x7A, 0x5E, 0x4D, 0xDD, 0x65, 0x5F, 0x42,
+    0xB4, 0xAF, 0x5D, 0xF3, 0x82, 0xCF, 0xA3, 0x0C, 0x31, 0x3C, 0x7A, 0x37, 0xA9, 0xDD, 0xEF, 0x5A,
+    0x4A, 0x67, 0xB0, 0x00, 0xE5, 0xF8, 0xE7, 0x56, 0xE4, 0x88, 0x8E, 0xA9, 0xA2, 0x4A, 0x55, 0xA8,
+    0x7C, 0x7F, 0x0C, 0x89, 0x32, 0xD9, 0x2B, 0x86, 0x38, 0x7B, 0x33, 0x49, 0xA9, 0x9B, 0x52, 0xA2,
+    0xAB, 0x06, 0x46, 0xB8, 0x98, 0x19, 0x34, 0x55, 0x1E, 0xF4, 0xD1, 0xDE, 0x2B, 0xD1, 0x4B, 0x95,
+    0xAD, 0x10, 0x67, 0x61, 0xD9, 0x00, 0x34, 0x5F, 0x57, 0xF1, 0x74, 0x99, 0xEC, 0xB8, 0xBF, 0xBB,
+    0x7C, 0xEE, 0x95, 0xC3, 0xF0, 0x7F, 0xE8, 0xF2, 0xF4, 0xDE, 0x6F, 0xCF, 0x5D, 0xB3, 0xCB, 0xB1,
+    0x82, 0xB6, 0x96, 0x5F, 0x06, 0xDF, 0x8D, 0xBF, 0xB6, 0x9A, 0xFD, 0xAB, 0x12, 0xCE, 0xA6, 0x5A,
+    0x82, 0x03, 0x8D, 0x85, 0x1C, 0xAD, 0x1B, 0xF3, 0xF7, 0xDF, 0x3E, 0xBA, 0xFF, 0x96, 0x69, 0x8D,
+    0x9B, 0xDB, 0x66, 0x7F, 0x4F, 0xF3, 0x55, 0x74, 0x8D, 0x71, 0x8A, 0xF9, 0x40, 0x47, 0x2D, 0x8C,
+    0x2E, 0xE0, 0xEB, 0x93, 0x2F, 0x6E, 0x9F, 0xAC, 0xBF, 0x30, 0x2E, 0xE5, 0xB3, 0x32, 0xD8, 0xBB,
+    0xC9, 0xA7, 0x77, 0xAD, 0x71, 0x49, 0xEA, 0x3C, 0x01, 0x69, 0xC4, 0xF5, 0xB2, 0xD7, 0x87, 0xA8,
+    0x4D, 0x31, 0xDF, 0xBA, 0x1B, 0xFE, 0x45, 0xE4, 0x4A, 0xAB, 0xDA, 0x37, 0x81, 0x22, 0xAC, 0x7D,
+    0x22, 0x8B, 0xD2, 0x4E, 0x6D, 0x5A, 0xC4, 0xC6, 0xC0, 0x27, 0x8C, 0xBA, 0x93, 0x9F, 0x46, 0xB9,
+    0x8E, 0x2C, 0x10, 0xB9, 0xD0, 0xB6, 0xE5, 0x34, 0x59, 0x41, 0x56, 0x1D, 0x1B, 0xBB, 0xA9, 0xD2,
+    0x32, 0xD6, 0x89, 0x1D, 0x55, 0x7A, 0x53, 0xF1, 0x75, 0x0B, 0x79, 0xC7, 0x8A, 0x5D, 0x2B, 0xF9,
+    0xE7, 0xB0, 0x6D, 0x4C, 0x8C, 0x31, 0x14, 0xC6, 0x42, 0x2B, 0x0E, 0x72, 0x36, 0x89, 0xAC, 0x8D,
+    0x4E, 0x6D, 0xFA, 0x26, 0xB0, 0x72, 0xD7, 0xF2, 0x85, 0x1E, 0x73, 0x53, 0x17, 0xB1, 0x76, 0xBE,
+    0xBC, 0xED, 0x2E, 0xAA, 0x2E, 0xB8, 0xBC, 0x90, 0x32, 0x41, 0x7C, 0x19, 0x33, 0x03, 0xED, 0xC7,
+    0x05, 0xB9, 0x21, 0xF3, 0x2D, 0xB5, 0xEB, 0x26, 0x65, 0xE6, 0x82, 0xBA, 0xC0, 0x74, 0x5C, 0xE6,
+    0x9B, 0x91, 0x29, 0xD5, 0x6E, 0xC1, 0x3F, 0xE1, 0xA4, 0x34, 0x8B, 0x2A, 0x75, 0x0A, 0x23, 0x0D,
+    0x3C, 0x2E, 0x7F, 0x01, 0xB5, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0xC7, 0xF1, 0xA2,
+    0x8C, 0xC8, 0x5C, 0x41, 0x50, 0x08, 0x22, 0xE3, 0x82, 0x86, 0x28, 0xF1, 0x36, 0x14, 0x2E, 0x7C,
+    0xB7, 0x83, 0x5D, 0xA4, 0x48, 0x11, 0x17, 0xB1, 0x84, 0x94, 0xC2, 0x3D, 0x05, 0xA1, 0x48, 0x81,
+    0xD0, 0xF9, 0x6E, 0xA4, 0x14, 0x14, 0x69, 0x2C, 0x21, 0xA0, 0x8D, 0x04, 0x08, 0xE4, 0x14, 0xA1,
+    0x30, 0xD2, 0x15, 0x77, 0xBE, 0xB1, 0x53, 0xA4, 0xA0, 0x59, 0x40, 0x0A, 0x45, 0x9A, 0x11, 0x22,
+    0x20, 0xC5, 0xCD, 0x28, 0x2C, 0xD2, 0xDA, 0xEC, 0xDD, 0xF0, 0x66, 0xCF, 0xB6, 0x80, 0x9E, 0xD1,
+    0x2B, 0xDE, 0xCC, 0xBD, 0x7D, 0xDF, 0x7B, 0xDF, 0xFB, 0x39, 0x80, 0x8E, 0x7B, 0x39, 0xB1, 0x3D,
+    0x61, 0xEB, 0x6C, 0xD5, 0xF7, 0xE4, 0x7E, 0x95, 0x8B, 0xA2, 0x56, 0x77, 0xDD, 0xA6, 0xD8, 0xF3,
+    0x1D, 0x5E, 0x94, 0x92, 0xB9, 0x39, 0x86, 0x05, 0x20, 0xD5, 0xB5, 0x2C, 0xFA, 0xDC, 0x4B, 0xD3,
+    0x4D, 0x8A, 0x97, 0xE8, 0xBB, 0x3B, 0x89, 0xAD, 0x85, 0x9D, 0xA4, 0x8E, 0x1E, 0x73, 0x56, 0x49,
+    0x53, 0xA7, 0xB6, 0x9D, 0x14, 0x97, 0x60, 0xE6, 0xA2, 0x5B, 0x56, 0x08, 0x7C, 0x2B, 0xED, 0x30,
+    0x75, 0xF9, 0x3B, 0x95, 0xB4, 0x64, 0x94, 0xE9, 0x9A, 0x2E, 0xA0, 0xCB, 0x26, 0xF3, 0x52, 0x57,
+    0xD1, 0xD6, 0x27, 0x68, 0x31, 0x8D, 0x0B, 0x80, 0x32, 0x50, 0x03, 0x28, 0x61, 0x14, 0x06, 0x52,
+    0x0B, 0x83, 0x37, 0x79, 0xD1, 0x4B, 0xDD, 0x98, 0x97, 0xC2, 0x89, 0x42, 0x14, 0xA9, 0xE5, 0x7A,
+    0x01, 0x6D, 0x48, 0x93, 0x3A, 0x56, 0x63, 0x92, 0xD4, 0xA9, 0x97, 0xB6, 0x83, 0xB7, 0xD1, 0x22,
+    0xB4, 0x6B, 0x1A, 0xB8, 0x74, 0x15, 0x3E, 0x35, 0x3B, 0x4A, 0xBB, 0xC4, 0xDE, 0x5F, 0x82, 0x80,
+    0x04, 0x96, 0xB9, 0x05, 0xBC, 0xC7, 0x59, 0x5E, 0x9F, 0xA5, 0x18, 0x59, 0x29, 0x57, 0x2A, 0x7A,
+    0xFE, 0xCE, 0x01, 0x57, 0x53, 0x43, 0x49, 0xBD, 0x01, 0xE6, 0xD6, 0xEE, 0xE0, 0x43, 0xB5, 0x52,
+    0x9C, 0x63, 0xA5, 0x58, 0x35, 0x67, 0x70, 0xE5, 0x03, 0x72, 0x78, 0x3F, 0xE6, 0x70, 0x11, 0x17,
+    0x95, 0x55, 0xF7, 0x9C, 0xF8, 0xA5, 0xE4, 0xE5, 0x08, 0x93, 0x4C, 0x67, 0xC2, 0x8A, 0x7D, 0x9F,
+    0xF8, 0x21, 0x86, 0x19, 0xB2, 0xD4, 0x12, 0x4B, 0xCC, 0x77, 0xD1, 0x95, 0x90, 0xDC, 0x72, 0xEB,
+    0xE1, 0x31, 0x3B, 0x1A, 0xBA, 0x66, 0xF5, 0x58, 0x8F, 0xC9, 0xC1, 0x9E, 0x66, 0x7A, 0x7B, 0x7B,
+    0xFB, 0xEB, 0x10, 0xC2, 0xB3, 0xF5, 0xF5, 0x75, 0xBC, 0xF7, 0x45, 0x78, 0x1A, 0xF4, 0xCC, 0x8E,
+    0x19, 0x40, 0x92, 0x3E, 0x04, 0x62, 0xA8, 0x8B, 0xF4, 0x44, 0x2E, 0x04, 0xBD, 0x2C, 0x03, 0x49,
+    0x01, 0x9C, 0x9B, 0xBD, 0x50, 0xB0, 0x27, 0x2F, 0x14, 0x3F, 0x76, 0xE8, 0x85, 0xCC, 0xDB, 0xE4,
+    0xC0, 0xCD, 0x5E, 0x06, 0x33, 0x07, 0x0C, 0x27, 0x67, 0x6C, 0x48, 0x44, 0x28, 0x48, 0xB2, 0x46,
+    0x16, 0x94, 0x25, 0x21, 0x02, 0xA3, 0x28, 0x44, 0x59, 0x6E, 0xC4, 0x47, 0xA1, 0x5F, 0x94, 0xCD,
+    0xA6, 0x50, 0xD3, 0x34, 0x38, 0x1E, 0x9C, 0xAA, 0xA0, 0x0E, 0xD1, 0x03, 0x3A, 0xC7, 0x06, 0xE4,
+    0x3D, 0xB1, 0xF8, 0xCF, 0x99, 0x43, 0x52, 0x45, 0x91, 0x0E, 0xD2, 0x23, 0xD7, 0xC8, 0x0D, 0x5E,
+    0x41, 0x14, 0x3A, 0xC9, 0x16, 0xC5, 0x90, 0xDD, 0x0B, 0x05, 0x31, 0x17, 0x0A, 0x5E, 0x12, 0xBA,
+    0x8C, 0xF8, 0x79, 0xC4, 0xAE, 0x63, 0x71, 0xA2, 0x63, 0xD9, 0x00, 0x83, 0xA0, 0x87, 0x84, 0x9C,
+    0x78, 0x02, 0x4E, 0x6D, 0x2F, 0x9A, 0xD0, 0xAF, 0xDD, 0xA6, 0x7E, 0xFF, 0x86, 0x24, 0x38, 0x56,
+    0x13, 0xA0, 0xF0, 0x84, 0x97, 0xD9, 0x06, 0xEE, 0x62, 0xA4, 0xB2, 0x8E, 0x09, 0xBB, 0x98, 0xAF,
+    0xCE, 0x43, 0x31, 0xC2, 0x9A, 0xDA, 0x2F, 0x89, 0x9C, 0xEB, 0xE4, 0x22, 0xCB, 0xC8, 0x60, 0x99,
+    0x48, 0x66, 0x2F, 0xC8, 0x9B, 0x7A, 0x6C, 0x91, 0x4D, 0x14, 0x08, 0xAF, 0x0B, 0xC2, 0xF3, 0xD8,
+    0x8C, 0xE9, 0x79, 0x22, 0x92, 0xFF, 0x33, 0x45, 0x4D, 0xBD, 0x25, 0x2D, 0x2F, 0x31, 0xD6, 0x32,
+    0x36, 0x5D, 0x4E, 0x85, 0x6C, 0x72, 0xBB, 0x49, 0xC9, 0x11, 0x4B, 0xFB, 0x47, 0xE1, 0x73, 0xE7,
+    0xE7, 0x83, 0x6B, 0x61, 0xFE, 0xB8, 0x9E, 0x54, 0xAF, 0xE2, 0x0A, 0x37, 0x71, 0xA0, 0xD4, 0x4A,
+    0x99, 0xA7, 0x6E, 0x12, 0x67, 0x8A, 0xFB, 0x91, 0xDC, 0xAB, 0xB2, 0x55, 0x1A, 0x2B, 0x5B, 0x29,
+    0xEE, 0xDA, 0xC2, 0xC6, 0xC9, 0x6A, 0x43, 0xB7, 0x12, 0xAC, 0x81, 0xED, 0x22, 0x0F, 0xAB, 0x65,
+    0x5F, 0xE9, 0xCE, 0x10, 0xC4, 0x41, 0x30, 0x62, 0x8A, 0xAC, 0x42, 0xF0, 0xFC, 0xF7, 0x22, 0x93,
+    0xBF, 0x55, 0x2A, 0x98, 0xF9, 0x2D, 0x60, 0xDE, 0x50, 0x41, 0x78, 0x85, 0xDC, 0x25, 0x07, 0x46,
+    0x2D, 0xC2, 0x0F, 0xE4, 0x8A, 0x1B, 0x6D, 0x3C, 0x09, 0xE1, 0xC5, 0xF6, 0x54, 0x27, 0x44, 0x89,
+    0xC1, 0x6B, 0x48, 0xB6, 0x4D, 0xBF, 0x4E, 0x9F, 0x9B, 0x1D, 0x88, 0x2D, 0xF2, 0x36, 0x3F, 0xB6,
+    0x31, 0xBD, 0x82, 0x9A, 0x45, 0xEC, 0xDD, 0x2A, 0xF3, 0x09, 0xFB, 0x8A, 0x1A, 0xAC, 0x60, 0xC1,
+    0x64, 0x26, 0x29, 0xE3, 0xDC, 0x8D, 0x27, 0x3C, 0x4C, 0xA5, 0x1E, 0xB6, 0x51, 0x96, 0xFC, 0x27,
+    0xAF, 0xAE, 0xFD, 0x59, 0x8B, 0x60, 0xD9, 0x97, 0xB8, 0xBC, 0xFD, 0x71, 0x98, 0x7E, 0xF4, 0xE0,
+    0x29, 0x06, 0x0B, 0x2A, 0x7A, 0x18, 0x10, 0x41, 0x89, 0x27, 0x47, 0xD4, 0x7B, 0x83, 0x08, 0xB6,
+    0x10, 0x43, 0xCF, 0x02, 0xF3, 0x1D, 0x61, 0xBA, 0x94, 0x57, 0x4E, 0x89, 0x78, 0xFE, 0x57, 0xB9,
+    0xC8, 0xBD, 0x4F, 0x1F, 0x59, 0x25, 0x7F, 0x38, 0x0E, 0x9D, 0x4D, 0x28, 0xC3, 0xA4, 0xEC, 0x49,
+    0xDD, 0x25, 0x94, 0x8A, 0xFF, 0x58, 0xAA, 0xD5, 0x50, 0xB3, 0x31, 0xF5, 0x9D, 0x66, 0x15, 0x6E,
+    0x5B, 0xCA, 0xF6, 0xAD, 0x86, 0x3F, 0xF1, 0x7D, 0x99, 0x86, 0x31, 0x68, 0xF7, 0xD0, 0x8A, 0xE0,
+    0x45, 0x07, 0xA5, 0x34, 0x6D, 0xEE, 0xE8, 0xA2, 0xAA, 0xF1, 0xDE, 0xCD, 0xF3, 0x6B, 0x64, 0xA3,
+    0xA6, 0x8C, 0x02, 0xB6, 0xA3, 0x2E, 0x8E, 0xFC, 0x29, 0x59, 0x63, 0xC7, 0x0F, 0xAC, 0xDC, 0x30,
+    0x75, 0x16, 0xA2, 0xB7, 0xD9, 0xE9, 0xA6, 0x01, 0x0F, 0x2D, 0xF3, 0xA0, 0x3A, 0x53, 0xD4, 0xA7,
+    0x4A, 0x16, 0x6E, 0x50, 0x5B, 0x12, 0xDA, 0x94, 0x4D, 0xA7, 0xB4, 0xBA, 0xDA, 0x89, 0x6F, 0xD1,
+    0x54, 0x74, 0x91, 0x16, 0x44, 0x71, 0xEA, 0x88, 0x31, 0xF1, 0xEC, 0x66, 0x1E, 0xAA, 0x7E, 0x30,
+    0xD0, 0x22, 0x5C, 0x3F, 0xF8, 0xC3, 0xB6, 0x5B, 0x34, 0xE5, 0xA6, 0x6F, 0xF2, 0x7A, 0x4E, 0x69,
+    0xEE, 0x50, 0xB1, 0xFA, 0xE1, 0xE4, 0x14, 0xA9, 0x13, 0xC7, 0x40, 0x39, 0x04, 0x23, 0xDF, 0xC7,
+    0x60, 0x90, 0xEE, 0xBB, 0x65, 0x71, 0x37, 0x84, 0x83, 0x10, 0xEC, 0xAC, 0x30, 0x71, 0xB4, 0xA9,
+    0xE3, 0x6C, 0xBF, 0xA6, 0x0B, 0xD5, 0xE6, 0x57, 0x84, 0x92, 0x12, 0x27, 0x36, 0x9B, 0xDA, 0xA8,
+    0xFD, 0xB1, 0xCF, 0x4F, 0x9C, 0xF5, 0xAD, 0x2C, 0x69, 0x42, 0x68, 0x34, 0x7A, 0x5B, 0x3C, 0xD4,
+    0xF2, 0xB3, 0x7A, 0x99, 0xC5, 0xDA, 0x38, 0x79, 0xA3, 0x18, 0xCA, 0xE0, 0xE4, 0xA4, 0xB1, 0x0A,
+    0x3F, 0x87, 0xE9, 0x4E, 0xFA, 0x18, 0x65, 0x6B, 0x31, 0x96, 0x84, 0xF0, 0x41, 0x71, 0x2D, 0xCF,
+    0xCA, 0x93, 0x36, 0x1D, 0xD9, 0xA2, 0x14, 0x71, 0x38, 0x12, 0x76, 0xB8, 0x98, 0x38, 0xA2, 0xBF,
+    0x5F, 0x22, 0x14, 0x6A, 0xC3, 0x95, 0xE2, 0x91, 0x95, 0x54, 0x8D, 0xEC, 0x41, 0x91, 0x35, 0xCE,
+    0xC8, 0x52, 0x4D, 0xD8, 0x74, 0x12, 0xC9, 0x60, 0x3E, 0xF6, 0x81, 0xBC, 0x76, 0x44, 0x13, 0xE9,
+    0xD9, 0x86, 0xA1, 0xED, 0x24, 0x8A, 0x57, 0x27, 0x71, 0xA5, 0xD0, 0xC9, 0x42, 0xA8, 0x68, 0x95,
+    0xF9, 0xEC, 0xD3, 0x5B, 0x76, 0x04, 0x45, 0x3D, 0xB4, 0x24, 0x0A, 0xE8, 0x8C, 0xF0, 0x46, 0x34,
+    0x17, 0x87, 0xEB, 0xB4, 0x75, 0xA8, 0xB9, 0x9E, 0x7F, 0xD3, 0x5C, 0x69, 0x02, 0x1F, 0x1E, 0x69,
+    0x1E, 0x02, 0xB0, 0x3B, 0xBB, 0x92, 0x31, 0x95, 0x0F, 0x32, 0x9C, 0x66, 0xEB, 0x40, 0x49, 0xD2,
+    0xFB, 0x6E, 0xB3, 0x1C, 0x32, 0x5C, 0x45, 0x4E, 0x9B, 0x85, 0x16, 0x0F, 0x95, 0x01, 0x67, 0x77,
+    0xB7, 0x8D, 0x22, 0x87, 0x71, 0x45, 0xA2, 0x3E, 0x43, 0x7D, 0x14, 0x70, 0xF9, 0x70, 0x1D, 0x8C,
+    0x5C, 0x51, 0x33, 0xC6, 0x8C, 0x63, 0xD5, 0xDE, 0xED, 0x87, 0x50, 0xE7, 0xE3, 0x50, 0x5F, 0xC0,
+    0x99, 0xB5, 0xD3, 0x09, 0x7E, 0x3D, 0x4C, 0x67, 0x83, 0x49, 0x5F, 0xCD, 0xD6, 0xC8, 0x7C, 0x95,
+    0xD4, 0xB3, 0xCD, 0x5B, 0x61, 0x72, 0xA2, 0xF4, 0x4E, 0x94, 0x0E, 0xB3, 0xC7, 0x0A, 0x3F, 0x56,
+    0x36, 0x4F, 0x94, 0xFA, 0x36, 0xD5, 0xAE, 0x64, 0x95, 0x28, 0x43, 0xD8, 0x3F, 0x1C, 0xB2, 0x10,
+    0xE2, 0x7F, 0x92, 0x5D, 0x62, 0xE1, 0x90, 0x08, 0xE7, 0x45, 0x8B, 0x6C, 0xA2, 0x52, 0x61, 0xA6,
+    0xD0, 0x80, 0xCD, 0x14, 0x64, 0xE5, 0xB1, 0xC2, 0xEA, 0x99, 0x92, 0xE8, 0x6E, 0xA3, 0x14, 0x9C,
+    0xA6, 0x86, 0xFA, 0x90, 0x1F, 0x7D, 0xF2, 0xA4, 0xCC, 0x83, 0xA3, 0xA5, 0xF2, 0xA8, 0x69, 0xCB,
+    0xB8, 0xD2, 0xCE, 0xE3, 0x7F, 0x3F, 0x7F, 0x03, 0x8D, 0x55, 0x3D, 0x6C, 0xE4, 0x44, 0x14, 0x7E,
+    0x63, 0xE7, 0x62, 0x09, 0x4B, 0x0C, 0x48, 0x9C, 0x28, 0xE0, 0x70, 0x43, 0xBB, 0xEB, 0x26, 0x05,
+    0xC5, 0x66, 0x3D, 0x97, 0x43, 0xA2, 0xA0, 0x38, 0x8A, 0x18, 0x2A, 0xC4, 0xD5, 0x48, 0xE8, 0x28,
+    0x4E, 0x40, 0x91, 0x1F, 0x87, 0xE6, 0x8A, 0x6D, 0x82, 0x44, 0x7B, 0x50, 0xB3, 0xCD, 0x35, 0x29,
+    0x52, 0x6C, 0x62, 0x07, 0x84, 0xAE, 0x64, 0x80, 0x22, 0x25, 0xBE, 0x70, 0x28, 0x05, 0x8D, 0x41,
+    0x0E, 0xE7, 0x80, 0xD7, 0xC3, 0xF7, 0xC6, 0xF6, 0x5E, 0x72, 0xD7, 0xDC, 0x68, 0x9F, 0xD7, 0x33,
+    0x9E, 0x79, 0x3F, 0xDF, 0xF7, 0xDE, 0x1B, 0x22, 0x1E, 0x8E, 0x79, 0x44, 0xC2, 0x18, 0x4D, 0xE9,
+    0x57, 0x33, 0x0A, 0x32, 0x37, 0x73, 0x0B, 0x7A, 0x8B, 0x0E, 0xC8, 0x21, 0x99, 0xE1, 0xEB, 0x79,
+    0xAC, 0x5C, 0x63, 0x2A, 0x7A, 0xF5, 0x2C, 0x26, 0x8A, 0xB0, 0x7F, 0xDB, 0x18, 0x5A, 0x4E, 0xA7,
+    0xBB, 0xE4, 0x94, 0x98, 0x05, 0x09, 0x1E, 0x35, 0xC4, 0x2F, 0xF0, 0x88, 0x1E, 0x5D, 0xC9, 0xC8,
+    0x98, 0x1A, 0x0A, 0x1B, 0x4C, 0x71, 0xE2, 0x25, 0xFC, 0xAD, 0x42, 0xC6, 0x9D, 0x0C, 0x21, 0xA1,
+    0x31, 0xE6, 0x4F, 0x48, 0xB5, 0xCF, 0xE7, 0x58, 0x01, 0xBF, 0x48, 0x85, 0x87, 0xB2, 0x2E, 0xF1,
+    0xA2, 0x5F, 0x91, 0x6F, 0x12, 0xFF, 0xDE, 0xBE, 0x7F, 0xF7, 0xE6, 0xCE, 0x91, 0xD6, 0x74, 0x87,
+    0xE8, 0x1A, 0x91, 0xA7, 0x48, 0x68, 0xA2, 0x3D, 0xA2, 0x81, 0xDD, 0xE6, 0xE4, 0xF6, 0xF4, 0x70,
+    0x31, 0xE1, 0x21, 0x58, 0xD8, 0x9F, 0x90, 0xE3, 0xE3, 0x97, 0xE1, 0xC2, 0x66, 0x67, 0xAD, 0x97,
+    0x0D, 0xC8, 0x52, 0x6F, 0xF3, 0x19, 0x65, 0xAD, 0x99, 0xCE, 0xA6, 0x75, 0xC0, 0xF7, 0x6E, 0xAC,
+    0xFD, 0xF5, 0x6B, 0x1E, 0x7E, 0x9E, 0x3B, 0x26, 0xA7, 0x30, 0x5F, 0xD8, 0xC4, 0x70, 0x33, 0x49,
+    0x54, 0x42, 0xE5, 0x2A, 0xAC, 0x23, 0x1C, 0xEF, 0x07, 0x18, 0x34, 0x11, 0xA4, 0x00, 0x54, 0x1B,
+    0xAE, 0xA6, 0x00, 0x51, 0xFA, 0x19, 0x8D, 0xA8, 0x68, 0x4F, 0xC0, 0x32, 0x40, 0x96, 0x35, 0x49,
+    0x93, 0xC9, 0x0F, 0x37, 0xE4, 0xDD, 0x77, 0xB3, 0x1D, 0x9D, 0x5C, 0x0E, 0xD5, 0x4E, 0x96, 0xBD,
+    0xB5, 0x1B, 0x0F, 0x7F, 0x29, 0xC6, 0x9F, 0x15, 0xAE, 0x29, 0x28, 0x2A, 0x08, 0x24, 0x31, 0xB6,
+    0x4B, 0xD6, 0xD5, 0x4E, 0xC1, 0xBD, 0x19, 0x14, 0x1C, 0xED, 0xE8, 0xDD, 0x4B, 0x0A, 0x6E, 0xDD,
+    0x79, 0x73, 0x7C, 0x2D, 0x74, 0x4F, 0x6F, 0x53, 0xD8, 0x90, 0xD3, 0x70, 0x78, 0x81, 0x31, 0xC7,
+    0xC6, 0x94, 0xBD, 0xDF, 0x5E, 0x66, 0xD1, 0x02, 0x14, 0x92, 0x83, 0x20, 0xF6, 0x6E, 0x44, 0x2B,
+    0x92, 0xC6, 0x6E, 0x36, 0xA4, 0x62, 0x48, 0xA3, 0x30, 0xFE, 0x48, 0x1A, 0xF3, 0xFD, 0x59, 0xFC,
+    0x5E, 0xD8, 0x02, 0xCA, 0x7F, 0x1D, 0x57, 0x4C, 0xDC, 0xE2, 0xD0, 0x45, 0x0D, 0x3E, 0x49, 0x37,
+    0xB7, 0x1A, 0x9C, 0x7C, 0x35, 0xDE, 0x82, 0x82, 0xA3, 0xF8, 0x83, 0x9C, 0xDC, 0xFE, 0x47, 0xB7,
+    0x3A, 0x05, 0x2F, 0x58, 0x1F, 0x04, 0x9C, 0x80, 0x1B, 0x1B, 0xA2, 0x04, 0x4C, 0x25, 0xB4, 0xC0,
+    0xBF, 0x02, 0xD8, 0xD5, 0xD1, 0x74, 0x3A, 0xE5, 0xED, 0x36, 0x7F, 0xEC, 0xCB, 0x88, 0x2E, 0x8C,
+    0x17, 0xD9, 0x85, 0xA4, 0x15, 0x1F, 0xFB, 0x27, 0xCC, 0x34, 0xDE, 0x2D, 0x31, 0x4C, 0xFB, 0x97,
+    0x90, 0x9C, 0xF3, 0xCE, 0xAE, 0xAC, 0xF4, 0xE7, 0x96, 0x16, 0x69, 0x36, 0x49, 0xE4, 0x49, 0x2D,
+    0xAB, 0xF4, 0xC1, 0x37, 0x83, 0xBD, 0x77, 0x26, 0x6F, 0x8B, 0x13, 0x4D, 0x5F, 0xEC, 0xD1, 0x70,
+    0x80, 0x2F, 0xCA, 0x39, 0xC9, 0x69, 0x7F, 0x9F, 0x86, 0x43, 0xDE, 0xC6, 0x93, 0xC5, 0x70, 0x10,
+    0x26, 0xCD, 0x6C, 0xE2, 0xA4, 0xC8, 0x2B, 0xB6, 0xD4, 0xA7, 0xF2, 0x10, 0x0B, 0x0D, 0x16, 0x9A,
+    0x2E, 0xE1, 0x59, 0xBC, 0xEE, 0x98, 0x52, 0x97, 0xF5, 0xF1, 0x64, 0x40, 0xDE, 0x44, 0xB5, 0x66,
+    0xC5, 0x1B, 0x83, 0x97, 0x4F, 0x27, 0x9F, 0x84, 0x27, 0x8D, 0x53, 0x1D, 0xF2, 0xB6, 0x96, 0xB1,
+    0x27, 0xE3, 0x53, 0x17, 0x89, 0xA5, 0x03, 0x05, 0xBA, 0x24, 0x57, 0xA6, 0x21, 0x4E, 0x30, 0xC6,
+    0x5C, 0x72, 0x05, 0x6D, 0x00, 0x66, 0xA4, 0x02, 0xD7, 0xA0, 0x64, 0x62, 0xA5, 0x02, 0xAD, 0xAF,
+    0x93, 0xBE, 0xE0, 0x37, 0x4A, 0xC0, 0x3D, 0x65, 0x0E, 0x6F, 0x62, 0xB5, 0x0E, 0x13, 0xA8, 0x8B,
+    0x98, 0xD1, 0x03, 0xA2, 0x4A, 0x34, 0xD3, 0xFB, 0x99, 0xD5, 0xEA, 0x9F, 0xBD, 0x5F, 0x22, 0x39,
+    0x91, 0xAD, 0x91, 0x02, 0xF0, 0x5B, 0x9C, 0x21, 0x35, 0x30, 0x76, 0x4A, 0x94, 0xB3, 0xFB, 0x37,
+    0x66, 0xF2, 0x27, 0xD8, 0x0B, 0xB8, 0xF6, 0x23, 0x86, 0x25, 0xE5, 0xA2, 0x2B, 0xBB, 0xEA, 0x23,
+    0xA1, 0x40, 0x46, 0xE6, 0xFE, 0x6B, 0x68, 0x45, 0xC0, 0x20, 0xD4, 0xD0, 0x66, 0xCB, 0xDE, 0x98,
+    0xFC, 0xD3, 0x02, 0x44, 0xB9, 0x65, 0x50, 0xCC, 0x68, 0x1C, 0x28, 0xF7, 0xF7, 0x82, 0x56, 0x57,
+    0xC9, 0x7B, 0x90, 0xD1, 0x6C, 0x46, 0x72, 0x92, 0x09, 0x5E, 0xF7, 0xB5, 0x97, 0x6D, 0x8B, 0xD2,
+    0x35, 0x73, 0xF2, 0x9B, 0xDE, 0xF7, 0xD0, 0x16, 0x71, 0xBD, 0xCE, 0x8D, 0x08, 0x85, 0xC3, 0x45,
+    0x50, 0xDB, 0xAE, 0x24, 0x7F, 0x5C, 0xF7, 0x1E, 0x1B, 0x33, 0x67, 0xCF, 0x9F, 0xFA, 0x82, 0xC9,
+    0x59, 0x7C, 0xDD, 0xB4, 0xA3, 0xCF, 0x59, 0xBA, 0xAA, 0x80, 0x63, 0x68, 0xCA, 0x88, 0x3C, 0x63,
+    0xFE, 0x2B, 0x28, 0xDD, 0xF5, 0x0C, 0x79, 0xA8, 0xAB, 0x8A, 0x0F, 0x85, 0x25, 0x9C, 0x76, 0x1E,
+    0xE7, 0x38, 0x1C, 0xCA, 0x6C, 0x8C, 0xA0, 0x43, 0x2C, 0x04, 0x6A, 0xD3, 0xD3, 0xA2, 0x14, 0x65,
+    0xA0, 0x02, 0xE5, 0xE9, 0x4D, 0x44, 0x1B, 0x5E, 0xAF, 0x40, 0xC5, 0xCC, 0x2D, 0x2A, 0x98, 0xF4,
+    0x7F, 0x4B, 0x28, 0x54, 0x41, 0xC5, 0xA6, 0xC3, 0x8C, 0x02, 0x4D, 0x46, 0x2F, 0x37, 0x24, 0xEF,
+    0x73, 0x77, 0xAD, 0x03, 0xF4, 0x1E, 0x91, 0x89, 0xF5, 0x27, 0x4C, 0x70, 0xDF, 0x61, 0x70, 0x48,
+    0x72, 0x3B, 0xD8, 0x06, 0x44, 0x2E, 0xA7, 0x90, 0xE4, 0x2E, 0xBB, 0x0F, 0x36, 0xDC, 0x9F, 0xF1,
+    0x31, 0xE0, 0x50, 0x2A, 0x5F, 0x83, 0xCC, 0x00, 0xDE, 0xB0, 0x77, 0x25, 0x1D, 0x32, 0xA0, 0x35,
+    0xA0, 0x74, 0xB9, 0x64, 0x7C, 0xF6, 0x53, 0x66, 0xE0, 0x25, 0x5A, 0x03, 0x01, 0x87, 0xD2, 0x56,
+    0x0D, 0xB7, 0x1D, 0x6B, 0x86, 0xE3, 0xB6, 0x9D, 0x48, 0x5E, 0xE6, 0x7B, 0xCE, 0x7C, 0xD7, 0xD0,
+    0x0B, 0x0B, 0x11, 0x94, 0xD0, 0xB3, 0x7C, 0xFB, 0xCF, 0xCD, 0xB7, 0x1D, 0xAF, 0xA1, 0xD0, 0x3C,
+    0xAE, 0x83, 0xF4, 0x6B, 0x62, 0x30, 0xDB, 0x0B, 0xC3, 0x36, 0x60, 0xBE, 0x4B, 0x38, 0x03, 0xDA,
+    0x23, 0x5C, 0xA7, 0xE6, 0x36, 0x64, 0xBE, 0xD9, 0x63, 0xC0, 0x61, 0x92, 0xAF, 0xFB, 0xAD, 0x01,
+    0xBF, 0x05, 0xE7, 0x71, 0xCC, 0xCD, 0xAA, 0xA1, 0xE5, 0xB6, 0x73, 0xDB, 0x31, 0x6A, 0x75, 0x8A,
+    0x14, 0xEB, 0xB8, 0x8C, 0x2A, 0xFF, 0x7C, 0xAD, 0xA0, 0x6D, 0xD4, 0x3F, 0x54, 0x8C, 0x10, 0x17,
+    0x3C, 0x47, 0xF2, 0x27, 0x9E, 0xC6, 0x2C, 0x50, 0xD8, 0x89, 0x6A, 0x34, 0xFF, 0xB0, 0xC5, 0x63,
+    0x8D, 0x6F, 0x41, 0x82, 0x2C, 0x8E, 0xF8, 0x52, 0x3A, 0xE8, 0x63, 0x14, 0x73, 0xCC, 0x84, 0x41,
+    0x7B, 0x13, 0xDC, 0x2B, 0x58, 0x6B, 0x62, 0xEF, 0x0F, 0x7B, 0x39, 0xBD, 0xD2, 0x85, 0x56, 0x72,
+    0x68, 0x79, 0xFA, 0x47, 0x1C, 0x7B, 0x65, 0x17, 0x1A, 0xB1, 0x53, 0x5E, 0x7E, 0x35, 0x5E, 0xE7,
+    0xF2, 0xAF, 0x70, 0xCE, 0x3C, 0x2C, 0x2F, 0x07, 0xC3, 0x50, 0x05, 0xCD, 0x74, 0xBA, 0xCB, 0x31,
+    0x27, 0xE2, 0xE3, 0xE9, 0x77, 0xED, 0xA5, 0x6B, 0xCE, 0x2D, 0x0A, 0x80, 0xF4, 0x4A, 0xCA, 0x56,
+    0x22, 0xD5, 0xEB, 0xDC, 0xA2, 0xEE, 0x4A, 0xB5, 0x50, 0x79, 0xC7, 0xEC, 0xF9, 0xB7, 0x8C, 0xD5,
+    0x02, 0x3D, 0xDD, 0x6D, 0x6D, 0x93, 0x07, 0x70, 0x89, 0xB9, 0x88, 0xE3, 0x54, 0x87, 0x5C, 0xF6,
+    0x80, 0x45, 0xD1, 0x73, 0x8D, 0xFF, 0x01, 0xB5, 0x55, 0xBF, 0x6F, 0xD4, 0x30, 0x14, 0x7E, 0x49,
+    0x68, 0x23, 0x94, 0x21, 0x1D, 0xDA, 0x81, 0x82, 0xF0, 0xCC, 0x40, 0xBD, 0x30, 0xF6, 0x2E, 0x41,
+    0x0C, 0x0C, 0x0C, 0x74, 0xE0, 0x26, 0x56, 0xF6, 0xAE, 0x0C, 0x57, 0x62, 0xF1, 0x0F, 0x70, 0x1B,
+    0x6B, 0x87, 0x0E, 0x28, 0xCB, 0x2D, 0x0C, 0x1D, 0xAE, 0xD4, 0x47, 0x25, 0x18, 0x18, 0x08, 0x30,
+    0xB0, 0x66, 0x40, 0xAA, 0x04, 0x03, 0xA1, 0x0A, 0x22, 0x2D, 0xC9, 0x99, 0xEF, 0xF9, 0x12, 0x31,
+    0x20, 0xA0, 0x80, 0xB0, 0x14, 0x9F, 0xFD, 0x7E, 0xF9, 0x7B, 0xEF, 0x7D, 0xF6, 0x11, 0x61, 0x84,
+    0x3C, 0xF5, 0xF1, 0x49, 0x63, 0x46, 0xB4, 0x6F, 0x4C, 0x49, 0x5E, 0x7E, 0xBB, 0xA2, 0x40, 0x7B,
+    0x25, 0x94, 0x5E, 0x41, 0x3D, 0xF2, 0x73, 0x9A, 0x50, 0xA8, 0xA9, 0x20, 0x11, 0x7B, 0x39, 0x6D,
+    0x25, 0xC6, 0x98, 0x63, 0x7C, 0x26, 0x87, 0x52, 0xC4, 0x50, 0xEE, 0x91, 0x53, 0xC0, 0xD4, 0xCB,
+    0x84, 0xA2, 0x40, 0xD5, 0x44, 0x42, 0x64, 0x2B, 0x83, 0xA4, 0x71, 0x61, 0x94, 0x05, 0x1C, 0x94,
+    0xA0, 0xC4, 0x14, 0x28, 0x4C, 0x0B, 0x44, 0x08, 0x31, 0x62, 0x65, 0xE9, 0x0C, 0x06, 0x9B, 0xAC,
+    0xF5, 0xAD, 0x49, 0xC1, 0x26, 0x7A, 0x30, 0xD8, 0x90, 0x37, 0xA0, 0x9C, 0x49, 0x33, 0x77, 0xF5,
+    0xD9, 0x35, 0xC2, 0xE7, 0x54, 0x8C, 0x74, 0x9A, 0xA6, 0xE3, 0x1A, 0x51, 0x8D, 0x5A, 0x4D, 0xD3,
+    0x0D, 0xB2, 0x83, 0xB7, 0xA6, 0x61, 0x64, 0xB3, 0x18, 0x96, 0x52, 0x21, 0x16, 0xAC, 0xB1, 0x14,
+    0xFF, 0x79, 0xB9, 0x3F, 0xA2, 0xCD, 0x77, 0xFB, 0x46, 0x45, 0xE6, 0x59, 0xBA, 0xED, 0xA6, 0x8F,
+    0x18, 0x8D, 0x03, 0x1C, 0x15, 0xA3, 0x57, 0x33, 0xA2, 0x1A, 0xB9, 0xF9, 0x5A, 0x6A, 0x5A, 0x27,
+    0x43, 0x6E, 0xEC, 0x71, 0x0E, 0x42, 0x63, 0xDA, 0xE7, 0x94, 0x79, 0x17, 0x72, 0x7E, 0x4F, 0x78,
+    0x01, 0xB1, 0xCB, 0x19, 0xDF, 0x6B, 0x37, 0xB6, 0x22, 0x7B, 0xEC, 0xA0, 0xE8, 0x82, 0xAD, 0x30,
+    0x8A, 0xBB, 0x2E, 0x15, 0x9D, 0x3F, 0x40, 0xF4, 0x3A, 0xE2, 0x23, 0xD2, 0x34, 0xDD, 0xC6, 0x2F,
+    0xD6, 0xDA, 0x96, 0x42, 0xC0, 0x55, 0xE1, 0x44, 0x72, 0x73, 0x22, 0x04, 0x9B, 0x10, 0xDA, 0xF4,
+    0x5D, 0x8A, 0x0E, 0xA2, 0x93, 0xAD, 0x54, 0x42, 0x1A, 0xB7, 0x52, 0x07, 0xD2, 0xDD, 0x4E, 0xEA,
+    0x90, 0xDD, 0xC0, 0x8B, 0xED, 0x87, 0xD6, 0xCC, 0x2D, 0xAC, 0x36, 0xD0, 0x36, 0x00, 0x48, 0x03,
+    0x3F, 0xAA, 0xAC, 0x39, 0x37, 0x77, 0x62, 0xD9, 0xD4, 0x99, 0x2B, 0x1B, 0xAF, 0x35, 0xDF, 0xE0,
+    0x9E, 0xB3, 0x53, 0x48, 0x8E, 0x2A, 0x96, 0xA3, 0x9B, 0xA1, 0x7E, 0xF2, 0x35, 0x27, 0x34, 0xD7,
+    0x6F, 0xC8, 0x37, 0x8D, 0x5B, 0x1D, 0xD5, 0x97, 0x43, 0x5F, 0xCD, 0x4D, 0xAC, 0x25, 0xCA, 0x93,
+    0xCB, 0xF1, 0x73, 0xDD, 0xDB, 0x75, 0x3F, 0xC4, 0x17, 0x77, 0xDD, 0xC3, 0x6C, 0x28, 0x4D, 0xBC,
+    0xA9, 0xC4, 0xB5, 0x3A, 0x9A, 0x72, 0x89, 0x9C, 0x8D, 0x96, 0xB9, 0x96, 0x1D, 0x13, 0xB2, 0x67,
+    0xDA, 0x84, 0x19, 0xD0, 0xBC, 0x72, 0x3D, 0x9A, 0x83, 0xA4, 0xC9, 0xC2, 0x00, 0x6A, 0x53, 0x38,
+    0x45, 0x68, 0xA0, 0x76, 0x4B, 0xC0, 0x0C, 0x55, 0x8F, 0x9B, 0xA3, 0x81, 0x10, 0x49, 0x6C, 0x21,
+    0x41, 0xEF, 0x13, 0x9C, 0xE4, 0x1A, 0x62, 0x7F, 0x41, 0xCC, 0xB0, 0x66, 0x10, 0xBA, 0xE5, 0x66,
+    0xD4, 0xC5, 0x3C, 0x33, 0x27, 0x5C, 0x12, 0xAF, 0xC9, 0x59, 0xF0, 0xF6, 0xD5, 0x71, 0xFE, 0xD8,
+    0xAB, 0x43, 0x14, 0xAA, 0x70, 0xCA, 0x40, 0x25, 0x3A, 0x19, 0x8B, 0xFB, 0x46, 0xDF, 0x03, 0xBA,
+    0x91, 0x5B, 0xA1, 0xA9, 0xA6, 0x48, 0xEA, 0x7E, 0xF0, 0xE0, 0xFA, 0x5B, 0x1D, 0xE9, 0xB5, 0xBB,
+    0x54, 0x3A, 0x87, 0x4A, 0xA8, 0x8B, 0x43, 0x6F, 0xE6, 0xBD, 0x39, 0x29, 0x66, 0x75, 0x58, 0x7B,
+    0x86, 0x56, 0x68, 0x21, 0xB6, 0xB4, 0x29, 0x3A, 0xBC, 0x82, 0xB7, 0xC3, 0x7F, 0x17, 0xBD, 0x07,
+    0x39, 0x04, 0x33, 0x85, 0x6F, 0x46, 0x41, 0xDD, 0xB8, 0x42, 0x6D, 0x46, 0xB8, 0x28, 0x1D, 0x1B,
+    0x43, 0xDD, 0x31, 0x31, 0xC8, 0xD9, 0xB5, 0xE8, 0x26, 0xAF, 0xEC, 0x78, 0xEA, 0x72, 0x45, 0x1C,
+    0x9E, 0xC8, 0x4E, 0x0D, 0xB5, 0xBC, 0xA5, 0xC4, 0x06, 0xC4, 0x69, 0x3B, 0x4C, 0xC9, 0x86, 0xA9,
+    0x6F, 0xE2, 0xE5, 0xFE, 0x2F, 0xC6, 0xA5, 0x5B, 0x0B, 0xD2, 0x7F, 0x31, 0x3D, 0x2A, 0x86, 0x13,
+    0xF1, 0x77, 0x8B, 0x55, 0x57, 0xCD, 0xB3, 0xB1, 0x6D, 0x09, 0xF3, 0xB6, 0x5B, 0xDE, 0x47, 0xD4,
+    0x52, 0x30, 0x31, 0xAA, 0x09, 0x13, 0x13, 0xE8, 0x25, 0x5B, 0x54, 0xA8, 0x8F, 0xAF, 0xC1, 0x11,
+    0xC9, 0xFC, 0xA8, 0x68, 0x8B, 0x0B, 0xC6, 0x37, 0x19, 0xB4, 0xC6, 0xA3, 0x97, 0x81, 0xA7, 0xA1,
+    0x86, 0x9B, 0xB8, 0x0A, 0x8F, 0x3E, 0x57, 0x63, 0x82, 0x9D, 0x53, 0xDA, 0x23, 0x90, 0xBD, 0xFF,
+    0x9A, 0xC9, 0xC1, 0x64, 0xAB, 0xEC, 0x45, 0x92, 0x5C, 0xC1, 0x1E, 0x13, 0xAE, 0x06, 0x83, 0x50,
+    0xEE, 0x3E, 0xB8, 0x0F, 0xF3, 0x40, 0x23, 0x92, 0x88, 0xE1, 0xDB, 0xE7, 0x1E, 0x0C, 0x39, 0x52,
+    0x09, 0x3B, 0xF7, 0x08, 0x3B, 0xFF, 0xA5, 0x6A, 0x89, 0x25, 0x19, 0x74, 0x14, 0xB7, 0xA5, 0x5C,
+    0xDC, 0xE1, 0x37, 0xB1, 0xE4, 0x77, 0x31, 0x4E, 0x62, 0xBF, 0x44, 0x6F, 0x22, 0x9C, 0x12, 0x3C,
+    0xCF, 0xC8, 0xF9, 0xCC, 0xF7, 0x88, 0x2F, 0xD7, 0x18, 0xE9, 0x7C, 0x40, 0xB4, 0x13, 0xBE, 0x7D,
+    0xA7, 0x13, 0xD8, 0x0A, 0xC9, 0x3F, 0xF7, 0x63, 0xC1, 0x21, 0x04, 0x9F, 0x91, 0xFE, 0x16, 0x52,
+    0x91, 0x20, 0x86, 0x98, 0xCE, 0x48, 0x6A, 0xB0, 0x29, 0xC3, 0xFF, 0x04, 0xAE, 0xF7, 0x80, 0x63,
+    0x2F, 0x8E, 0x00, 0x1C, 0x19, 0xCC, 0x1A, 0xD4, 0x71, 0xDD, 0xDE, 0x7E, 0xBF, 0xFB, 0xB2, 0x7F,
+    0xFF, 0x82, 0xCC, 0x3E, 0x20, 0xEB, 0x28, 0x62, 0x32, 0x8E, 0x29, 0x6A, 0xE6, 0x27, 0x12, 0x2D,
+    0x75, 0xC4, 0x14, 0xB9, 0xBD, 0x8C, 0x98, 0xEE, 0xD0, 0xEF, 0x07, 0x9E, 0x21, 0x27, 0xC6, 0x9B,
+    0x2C, 0x0F, 0x80, 0xD9, 0x80, 0x33, 0x6E, 0x6D, 0x45, 0xFC, 0x3C, 0xB1, 0x5C, 0x7C, 0x97, 0x9F,
+    0x65, 0xF9, 0x29, 0x42, 0x2E, 0xFF, 0x88, 0x84, 0xC1, 0x85, 0x2F, 0x8E, 0x9B, 0x73, 0x9D, 0xCD,
+    0x52, 0xB4, 0x79, 0x58, 0xDE, 0xF9, 0xEB, 0x43, 0x7E, 0x86, 0x9A, 0x6E, 0x81, 0x56, 0x26, 0xF7,
+    0x9E, 0x9E, 0x98, 0x87, 0x79, 0xB1, 0x68, 0xF2, 0x25, 0x5A, 0x3C, 0x0D, 0xE4, 0xF9, 0xF8, 0x06,
+    0x9D, 0x54, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0x63, 0xE7, 0xCE, 0xD2, 0xB9, 0x70, 0x0A, 0x8E,
+    0xE2, 0xD0, 0xC9, 0x69, 0x03, 0x62, 0xDD, 0x52, 0x9C, 0x6E, 0x7D, 0xEC, 0x1F, 0x40, 0x4A, 0x56,
+    0x29, 0xF8, 0x05, 0xA4, 0x49, 0xB3, 0x05, 0xC5, 0x9E, 0xD6, 0x90, 0x3F, 0x90, 0x86, 0x3E, 0x05,
+    0xA0, 0x64, 0x52, 0x6C, 0xCA, 0x44, 0xBA, 0x60, 0x5F, 0xAE, 0x48, 0x6B, 0x88, 0xA2, 0x14, 0x34,
+    0x16, 0x88, 0x5C, 0x41, 0x44, 0x66, 0x25, 0x23, 0x6D, 0x36, 0xDE, 0x1D, 0xBE, 0x6F, 0xCE, 0xBE,
+    0x4D, 0x24, 0x84, 0x00, 0x6B, 0x3D, 0xB3, 0xF3, 0xCD, 0x7B, 0xEF, 0x7B, 0xEF, 0xCD, 0x37, 0x56,
+    0x77, 0x64, 0xC3, 0xB7, 0xB5, 0x7F, 0xF2, 0x67, 0xFE, 0x7B, 0x59, 0x29, 0x5B, 0x8A, 0x28, 0x39,
+    0x7F, 0xB4, 0xD6, 0x77, 0xFA, 0xD6, 0xDA, 0x8D, 0xE1, 0x70, 0x98, 0x76, 0xE0, 0x87, 0x40, 0x23,
+    0x80, 0xC7, 0x00, 0x3F, 0xF3, 0x6E, 0xC9, 0x81, 0x2D, 0x7B, 0xFD, 0xFC, 0xE7, 0xE7, 0x45, 0x3E,
+    0xBF, 0x24, 0x8F, 0xE4, 0xB2, 0x5C, 0x88, 0x97, 0xDE, 0x53, 0xBB, 0x7C, 0x34, 0x0E, 0xED, 0x4D,
+    0xF9, 0xA0, 0xBA, 0x88, 0x90, 0xD1, 0x42, 0xE7, 0x8F, 0xE1, 0x53, 0xA9, 0xEB, 0xDF, 0xAD, 0xC3,
+    0xEF, 0xE4, 0x77, 0x05, 0x60, 0xB3, 0xFF, 0xCD, 0x70, 0xDA, 0x42, 0x97, 0x44, 0xF6, 0x36, 0x86,
+    0x37, 0xAE, 0x00, 0xD5, 0x53, 0x2D, 0x61, 0x2A, 0x7E, 0xA1, 0xAE, 0x3D, 0xBB, 0x0A, 0xB3, 0x8F,
+    0x16, 0x3A, 0x33, 0x22, 0x9F, 0xFC, 0x4D, 0x16, 0x5D, 0xC0, 0x2D, 0x80, 0x37, 0x01, 0x1A, 0x80,
+    0x57, 0x3B, 0xD0, 0x03, 0x78, 0x9B, 0x34, 0xDB, 0x40, 0x5B, 0x6C, 0x24, 0x32, 0x29, 0x64, 0x52,
+    0xC9, 0xA4, 0xE4, 0xAF, 0x5F, 0x8A, 0xBF, 0x14, 0x09, 0xF9, 0xCE, 0xCF, 0xDE, 0x98, 0x6F, 0x26,
+    0x72, 0xB1, 0xF5, 0x40, 0x1B, 0x4E, 0x10, 0x03, 0xFF, 0x14, 0x7A, 0x04, 0x07, 0xC9, 0xB1, 0x6B,
+    0x33, 0x51, 0xED, 0xEB, 0x35, 0xA2, 0xF2, 0x0C, 0xFF, 0xCE, 0x7E, 0x92, 0x60, 0xFB, 0xBC, 0x67,
+    0x6F, 0xB9, 0xBB, 0xE7, 0x4B, 0xF1, 0x0A, 0x89, 0x8D, 0xE4, 0x69, 0xB0, 0x92, 0xA4, 0x56, 0x36,
+    0x05, 0xE7, 0xA4, 0xF4, 0x56, 0x12, 0xD5, 0x32, 0xC9, 0x18, 0xDF, 0xA6, 0x12, 0xD7, 0x92, 0x17,
+    0x12, 0x2C, 0x25, 0xA9, 0xC4, 0x73, 0x26, 0x58, 0xC3, 0x41, 0x12, 0x51, 0xB5, 0x8B, 0xD3, 0x12,
+    0x54, 0x6C, 0x14, 0xB6, 0xE1, 0xE6, 0xE2, 0x31, 0x39, 0xB8, 0xC1, 0x0F, 0x91, 0x25, 0x34, 0xAE,
+    0xD8, 0x02, 0xD1, 0xE3, 0x96, 0x85, 0x91, 0x69, 0x01, 0x53, 0xA4, 0x7A, 0x28, 0x7E, 0xD5, 0xC5,
+    0x9A, 0xD8, 0x45, 0xEA, 0xB1, 0x85, 0x9B, 0x5A, 0x4F, 0x49, 0x12, 0xB8, 0x01, 0x8D, 0x97, 0xB0,
+    0xC0, 0x10, 0xD3, 0x6C, 0x9F, 0x6D, 0x98, 0x13, 0x2F, 0x59, 0x1B, 0x57, 0x2C, 0x2D, 0x39, 0xD6,
+    0xFA, 0xDE, 0x32, 0x84, 0x77, 0xB6, 0xA3, 0xF5, 0x2D, 0x86, 0xBB, 0xC0, 0xE1, 0x01, 0x5E, 0x9F,
+    0x96, 0x71, 0xBB, 0xDA, 0xB1, 0xB6, 0xE4, 0xE1, 0x7D, 0x65, 0xF5, 0xEA, 0x6E, 0x5C, 0x62, 0x6F,
+    0x89, 0x3D, 0x24, 0x71, 0x84, 0xF8, 0x58, 0x61, 0x12, 0xCF, 0x60, 0x0A, 0xB8, 0x17, 0x65, 0x11,
+    0x48, 0xD2, 0x23, 0x0C, 0x03, 0xE4, 0x39, 0x79, 0xA5, 0x75, 0x8A, 0x7E, 0xAE, 0x24, 0x58, 0xE8,
+    0x6F, 0x25, 0x62, 0xCC, 0x31, 0x19, 0xB0, 0x27, 0x11, 0xD3, 0x7B, 0xCF, 0x55, 0xA2, 0xD2, 0xB7,
+    0x18, 0x3B, 0x7E, 0x65, 0xED, 0x52, 0x98, 0x61, 0xB1, 0xA3, 0xA7, 0x39, 0xB0, 0x07, 0x31, 0xCE,
+    0xBE, 0x8C, 0x71, 0x1A, 0xE8, 0x2A, 0x18, 0x0F, 0x69, 0x39, 0x47, 0xD4, 0xE0, 0x3C, 0x9B, 0x86,
+    0x2B, 0x66, 0x93, 0x6F, 0xDE, 0x5B, 0x4C, 0xEB, 0x84, 0xD4, 0xD7, 0x57, 0x3A, 0x6D, 0x19, 0xDF,
+    0xE1, 0xDF, 0x58, 0xAB, 0x3B, 0x87, 0xDC, 0x61, 0x6B, 0xBF, 0x5E, 0x21, 0x91, 0x98, 0xBD, 0x63,
+    0x8F, 0x82, 0xAA, 0x6B, 0xE2, 0x11, 0x73, 0xAC, 0xBB, 0x26, 0x46, 0x34, 0xA0, 0x66, 0x9C, 0xB6,
+    0xA8, 0x17, 0x9B, 0xC5, 0x64, 0x52, 0x9D, 0xBE, 0xA1, 0xDE, 0x21, 0x33, 0x5F, 0x31, 0xE8, 0xDC,
+    0x29, 0x9B, 0x46, 0x84, 0x18, 0xF3, 0x86, 0x4B, 0x66, 0x1D, 0x8A, 0x14, 0x87, 0xB4, 0x3A, 0x3F,
+    0x27, 0xC7, 0xCA, 0x1C, 0x42, 0x98, 0x2A, 0x4B, 0x47, 0x93, 0xB0, 0x1F, 0xDB, 0xDD, 0xBD, 0x50,
+    0xBC, 0x37, 0x2E, 0x7C, 0x7E, 0x16, 0x75, 0xDB, 0xB1, 0x40, 0x71, 0xE1, 0x8B, 0x17, 0x68, 0x4A,
+    0x36, 0x0A, 0x8B, 0x28, 0xDD, 0x95, 0x71, 0x90, 0x05, 0x69, 0x38, 0x28, 0x70, 0x15, 0x66, 0x25,
+    0x2E, 0xD3, 0xC7, 0xF7, 0x65, 0x57, 0x7C, 0x1C, 0x57, 0xCA, 0xFB, 0xDC, 0x3D, 0x86, 0xE0, 0x4B,
+    0x82, 0xA7, 0x29, 0x2C, 0x47, 0x06, 0x96, 0x7B, 0x3D, 0x80, 0x3D, 0xBF, 0x0C, 0xD2, 0x58, 0xF6,
+    0x55, 0x99, 0x88, 0xF7, 0xFA, 0xE1, 0x0F, 0x48, 0x0D, 0x59, 0x80, 0xCD, 0x15, 0xBA, 0xE6, 0xFC,
+    0xED, 0x7D, 0x72, 0x0A, 0x39, 0x85, 0x9C, 0x80, 0x06, 0xAC, 0x6D, 0xC6, 0x6A, 0xC0, 0x29, 0xE4,
+    0xC4, 0xF3, 0x0E, 0xA7, 0x90, 0x13, 0xCF, 0x29, 0xAB, 0x1D, 0x71, 0x0D, 0x4E, 0x21, 0x27, 0xCF,
+    0x7F, 0x9F, 0x97, 0xC7, 0x7B, 0xAD, 0xFE, 0x05, 0x67, 0x01, 0x51, 0x07, 0x47, 0xA2, 0xDE, 0x0C,
+    0x9E, 0x14, 0xAA, 0x9E, 0x95, 0x63, 0x55, 0xEF, 0xDE, 0x0F, 0x8E, 0x6B, 0x70, 0x1E, 0x1A, 0xB1,
+    0x94, 0x44, 0xBF, 0x80, 0xEE, 0x23, 0xA3, 0xDE, 0x14, 0xFE, 0x4B, 0x65, 0xC6, 0x72, 0x7A, 0x60,
+    0x82, 0x62, 0x34, 0x33, 0x32, 0xDE, 0xEB, 0x19, 0x09, 0xFE, 0xF0, 0x41, 0x3F, 0xF9, 0x2F, 0x9C,
+    0x29, 0x39, 0x33, 0x72, 0x82, 0x1D, 0x9C, 0x42, 0x4E, 0x0C, 0xE0, 0x84, 0x54, 0x2C, 0x07, 0x70,
+    0xD6, 0xE4, 0xAC, 0x51, 0x27, 0xE5, 0x73, 0x7A, 0x80, 0x61, 0x34, 0xAB, 0x59, 0x67, 0xCD, 0x3A,
+    0xEB, 0x7F, 0xA8, 0x53, 0x5A, 0x05, 0xF4, 0x5B, 0x99, 0x30, 0xC1, 0xFF, 0x07, 0x6C, 0xEA, 0x5C,
+    0x7F, 0x4F, 0x35, 0x52, 0x29, 0xD9, 0xD6, 0xA0, 0xE9, 0x3F, 0x86, 0xD0, 0xB6, 0x44, 0xDD, 0x96,
+    0xCB, 0xC8, 0x0E, 0x9F, 0x96, 0x93, 0x06, 0xDF, 0x98, 0xC8, 0x2C, 0xE1, 0xE5, 0xBE, 0x15, 0xEB,
+    0x2F, 0x3C, 0x0B, 0xAF, 0xDC, 0x94, 0x54, 0x67, 0x3A, 0x76, 0x53, 0xEF, 0x73, 0x4E, 0x5E, 0xE1,
+    0xF6, 0x7A, 0xA2, 0x30, 0x79, 0xCD, 0x17, 0x5C, 0x41, 0x92, 0x7E, 0xE5, 0xE4, 0x1E, 0x55, 0x5C,
+    0x34, 0x49, 0xE5, 0xBE, 0x51, 0xB9, 0xBB, 0x60, 0x9F, 0xDA, 0x5F, 0x90, 0x47, 0x1A, 0xD9, 0x5F,
+    0x71, 0xAD, 0x21, 0x06, 0xDF, 0x5A, 0x18, 0x19, 0xDF, 0x36, 0x90, 0xB8, 0xF8, 0x30, 0x83, 0x2C,
+    0x7C, 0xFB, 0x23, 0x16, 0x98, 0x9C, 0x46, 0x7C, 0xFB, 0xCA, 0x52, 0x29, 0x4D, 0xE4, 0x04, 0x63,
+    0x58, 0x9C, 0xF8, 0x3F, 0x19, 0x37, 0x59, 0x97, 0x9A, 0xAB, 0x13, 0xD3, 0x3A, 0xF3, 0xBF, 0x00,
+};
+
+static const uint32_t bookerly_14_regularBlockOffsets[33] = {
+    0, 1260, 2316, 3378, 4624, 5507, 6239, 7131,
+    7930, 8776, 9698, 10541, 11354, 12251, 13045, 13850,
+    14905, 15861, 16749, 17974, 19107, 20189, 21285, 22300,
+    23299, 24312, 25410, 26438, 27396, 28680, 29799, 30704,
+    31664,
+};
+
+static const uint16_t bookerly_14_regularDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_regularGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_14_regularPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_14_regularGlyphs[] = {
@@ -4022,715 +2195,715 @@ static const EpdGlyph bookerly_14_regularGlyphs[] = {
     { 14, 14, 18, 2, 17, 49, 1765 }, // >
     { 11, 23, 14, 2, 22, 64, 1814 }, // ?
     { 26, 26, 28, 1, 20, 169, 1878 }, // @
-    { 22, 21, 22, 0, 21, 116, 2047 }, // A
-    { 16, 22, 18, 1, 21, 88, 2163 }, // B
-    { 17, 22, 19, 1, 21, 94, 2251 }, // C
-    { 20, 22, 22, 1, 21, 110, 2345 }, // D
-    { 17, 21, 18, 1, 21, 90, 2455 }, // E
-    { 15, 21, 17, 1, 21, 79, 2545 }, // F
-    { 19, 22, 21, 1, 21, 105, 2624 }, // G
-    { 23, 21, 24, 1, 21, 121, 2729 }, // H
-    { 9, 21, 11, 1, 21, 48, 2850 }, // I
-    { 12, 27, 11, -2, 21, 81, 2898 }, // J
-    { 21, 22, 21, 1, 21, 116, 2979 }, // K
-    { 17, 21, 17, 1, 21, 90, 3095 }, // L
-    { 26, 21, 26, 0, 21, 137, 3185 }, // M
-    { 22, 22, 24, 1, 21, 121, 3322 }, // N
-    { 21, 22, 23, 1, 21, 116, 3443 }, // O
-    { 16, 21, 17, 1, 21, 84, 3559 }, // P
-    { 22, 27, 23, 1, 21, 149, 3643 }, // Q
-    { 20, 22, 20, 1, 21, 110, 3792 }, // R
-    { 14, 22, 16, 1, 21, 77, 3902 }, // S
-    { 18, 21, 20, 1, 21, 95, 3979 }, // T
-    { 22, 22, 22, 0, 21, 121, 4074 }, // U
-    { 21, 22, 21, 0, 21, 116, 4195 }, // V
-    { 32, 22, 32, 0, 21, 176, 4311 }, // W
-    { 21, 21, 21, 0, 21, 111, 4487 }, // X
-    { 20, 21, 20, 0, 21, 105, 4598 }, // Y
-    { 16, 22, 17, 1, 21, 88, 4703 }, // Z
-    { 6, 28, 9, 2, 23, 42, 4791 }, // [
-    { 13, 23, 14, 1, 21, 75, 4833 }, // <backslash>
-    { 6, 28, 9, 1, 23, 42, 4908 }, // ]
-    { 14, 14, 18, 2, 19, 49, 4950 }, // ^
-    { 15, 3, 15, 0, -1, 12, 4999 }, // _
-    { 7, 7, 19, 6, 24, 13, 5011 }, // `
-    { 15, 17, 16, 1, 16, 64, 5024 }, // a
-    { 18, 24, 17, -1, 23, 108, 5088 }, // b
-    { 13, 17, 15, 1, 16, 56, 5196 }, // c
-    { 17, 24, 18, 1, 23, 102, 5252 }, // d
-    { 13, 17, 15, 1, 16, 56, 5354 }, // e
-    { 14, 23, 12, 0, 23, 81, 5410 }, // f
-    { 17, 23, 17, 0, 16, 98, 5491 }, // g
-    { 19, 23, 19, 0, 23, 110, 5589 }, // h
-    { 10, 23, 10, 0, 23, 58, 5699 }, // i
-    { 9, 30, 8, -2, 23, 68, 5757 }, // j
-    { 18, 24, 18, 0, 23, 108, 5825 }, // k
-    { 9, 23, 9, 0, 23, 52, 5933 }, // l
-    { 29, 16, 29, 0, 16, 116, 5985 }, // m
-    { 19, 16, 19, 0, 16, 76, 6101 }, // n
-    { 16, 17, 17, 1, 16, 68, 6177 }, // o
-    { 17, 23, 18, 0, 16, 98, 6245 }, // p
-    { 17, 23, 17, 1, 16, 98, 6343 }, // q
-    { 13, 16, 13, 0, 16, 52, 6441 }, // r
-    { 12, 17, 14, 1, 16, 51, 6493 }, // s
-    { 12, 20, 12, 0, 19, 60, 6544 }, // t
-    { 19, 17, 19, 0, 16, 81, 6604 }, // u
-    { 18, 16, 17, 0, 15, 72, 6685 }, // v
-    { 26, 16, 26, 0, 15, 104, 6757 }, // w
-    { 17, 15, 17, 0, 15, 64, 6861 }, // x
-    { 18, 22, 17, 0, 15, 99, 6925 }, // y
-    { 14, 16, 15, 0, 15, 56, 7024 }, // z
-    { 9, 29, 11, 2, 24, 66, 7080 }, // {
-    { 4, 27, 8, 2, 23, 27, 7146 }, // |
-    { 9, 29, 11, 0, 24, 66, 7173 }, // }
-    { 14, 6, 18, 2, 13, 21, 7239 }, // ~
-    { 0, 0, 6, 0, 0, 0, 7260 }, //  
-    { 5, 23, 8, 1, 16, 29, 7260 }, // ¡
-    { 15, 29, 18, 1, 23, 109, 7289 }, // ¢
-    { 16, 22, 18, 1, 21, 88, 7398 }, // £
-    { 16, 14, 18, 1, 17, 56, 7486 }, // ¤
-    { 20, 20, 18, -1, 20, 100, 7542 }, // ¥
-    { 4, 27, 8, 2, 23, 27, 7642 }, // ¦
-    { 13, 23, 15, 1, 20, 75, 7669 }, // §
-    { 11, 4, 19, 4, 22, 11, 7744 }, // ¨
-    { 22, 22, 23, 0, 21, 121, 7755 }, // ©
-    { 11, 14, 13, 1, 21, 39, 7876 }, // ª
-    { 15, 11, 15, 1, 13, 42, 7915 }, // «
-    { 13, 8, 18, 3, 14, 26, 7957 }, // ¬
-    { 9, 3, 11, 1, 9, 7, 7983 }, // ­
-    { 17, 16, 17, 0, 23, 68, 7990 }, // ®
-    { 10, 3, 19, 5, 21, 8, 8058 }, // ¯
-    { 11, 11, 15, 2, 21, 31, 8066 }, // °
-    { 13, 17, 18, 3, 17, 56, 8097 }, // ±
-    { 11, 14, 13, 1, 24, 39, 8153 }, // ²
-    { 9, 14, 13, 2, 24, 32, 8192 }, // ³
-    { 6, 7, 19, 7, 24, 11, 8224 }, // ´
-    { 18, 23, 19, 2, 16, 104, 8235 }, // µ
-    { 15, 26, 16, 0, 21, 98, 8339 }, // ¶
-    { 6, 4, 8, 1, 10, 6, 8437 }, // ·
-    { 6, 7, 19, 7, -1, 11, 8443 }, // ¸
-    { 9, 14, 13, 2, 24, 32, 8454 }, // ¹
-    { 11, 14, 13, 1, 21, 39, 8486 }, // º
-    { 15, 11, 15, 1, 13, 42, 8525 }, // »
-    { 28, 24, 31, 2, 22, 168, 8567 }, // ¼
-    { 28, 24, 31, 2, 22, 168, 8735 }, // ½
-    { 29, 24, 31, 2, 22, 174, 8903 }, // ¾
-    { 11, 23, 14, 1, 16, 64, 9077 }, // ¿
-    { 22, 28, 22, 0, 28, 154, 9141 }, // À
-    { 22, 28, 22, 0, 28, 154, 9295 }, // Á
-    { 22, 28, 22, 0, 28, 154, 9449 }, // Â
-    { 22, 28, 22, 0, 28, 154, 9603 }, // Ã
-    { 22, 27, 22, 0, 27, 149, 9757 }, // Ä
-    { 22, 29, 22, 0, 29, 160, 9906 }, // Å
-    { 27, 21, 27, -1, 21, 142, 10066 }, // Æ
-    { 17, 29, 19, 1, 21, 124, 10208 }, // Ç
-    { 17, 28, 18, 1, 28, 119, 10332 }, // È
-    { 17, 28, 18, 1, 28, 119, 10451 }, // É
-    { 17, 28, 18, 1, 28, 119, 10570 }, // Ê
-    { 17, 27, 18, 1, 27, 115, 10689 }, // Ë
-    { 9, 28, 11, 1, 28, 63, 10804 }, // Ì
-    { 9, 28, 11, 1, 28, 63, 10867 }, // Í
-    { 11, 28, 11, 0, 28, 77, 10930 }, // Î
-    { 11, 27, 11, 0, 27, 75, 11007 }, // Ï
-    { 21, 22, 22, 0, 21, 116, 11082 }, // Ð
-    { 22, 29, 24, 1, 28, 160, 11198 }, // Ñ
-    { 21, 29, 23, 1, 28, 153, 11358 }, // Ò
-    { 21, 29, 23, 1, 28, 153, 11511 }, // Ó
-    { 21, 29, 23, 1, 28, 153, 11664 }, // Ô
-    { 21, 29, 23, 1, 28, 153, 11817 }, // Õ
-    { 21, 28, 23, 1, 27, 147, 11970 }, // Ö
-    { 12, 12, 18, 3, 16, 36, 12117 }, // ×
-    { 22, 22, 23, 0, 21, 121, 12153 }, // Ø
-    { 22, 29, 22, 0, 28, 160, 12274 }, // Ù
-    { 22, 29, 22, 0, 28, 160, 12434 }, // Ú
-    { 22, 29, 22, 0, 28, 160, 12594 }, // Û
-    { 22, 28, 22, 0, 27, 154, 12754 }, // Ü
-    { 20, 28, 20, 0, 28, 140, 12908 }, // Ý
-    { 16, 21, 18, 1, 21, 84, 13048 }, // Þ
-    { 18, 24, 19, 0, 23, 108, 13132 }, // ß
-    { 15, 25, 16, 1, 24, 94, 13240 }, // à
-    { 15, 25, 16, 1, 24, 94, 13334 }, // á
-    { 15, 25, 16, 1, 24, 94, 13428 }, // â
-    { 15, 24, 16, 1, 23, 90, 13522 }, // ã
-    { 15, 23, 16, 1, 22, 87, 13612 }, // ä
-    { 15, 25, 16, 1, 24, 94, 13699 }, // å
-    { 22, 17, 24, 1, 16, 94, 13793 }, // æ
-    { 13, 24, 15, 1, 16, 78, 13887 }, // ç
-    { 13, 25, 15, 1, 24, 82, 13965 }, // è
-    { 13, 25, 15, 1, 24, 82, 14047 }, // é
-    { 13, 25, 15, 1, 24, 82, 14129 }, // ê
-    { 13, 23, 15, 1, 22, 75, 14211 }, // ë
-    { 10, 24, 10, 0, 24, 60, 14286 }, // ì
-    { 10, 24, 10, 0, 24, 60, 14346 }, // í
-    { 10, 24, 10, 0, 24, 60, 14406 }, // î
-    { 11, 22, 10, -1, 22, 61, 14466 }, // ï
-    { 15, 25, 17, 1, 24, 94, 14527 }, // ð
-    { 19, 23, 19, 0, 23, 110, 14621 }, // ñ
-    { 16, 25, 17, 1, 24, 100, 14731 }, // ò
-    { 16, 25, 17, 1, 24, 100, 14831 }, // ó
-    { 16, 25, 17, 1, 24, 100, 14931 }, // ô
-    { 16, 24, 17, 1, 23, 96, 15031 }, // õ
-    { 16, 23, 17, 1, 22, 92, 15127 }, // ö
-    { 13, 14, 18, 3, 17, 46, 15219 }, // ÷
-    { 17, 17, 17, 0, 16, 73, 15265 }, // ø
-    { 19, 25, 19, 0, 24, 119, 15338 }, // ù
-    { 19, 25, 19, 0, 24, 119, 15457 }, // ú
-    { 19, 25, 19, 0, 24, 119, 15576 }, // û
-    { 19, 23, 19, 0, 22, 110, 15695 }, // ü
-    { 18, 31, 17, 0, 24, 140, 15805 }, // ý
-    { 17, 30, 18, 0, 23, 128, 15945 }, // þ
-    { 18, 29, 17, 0, 22, 131, 16073 }, // ÿ
-    { 22, 26, 22, 0, 26, 143, 16204 }, // Ā
-    { 15, 22, 16, 1, 21, 83, 16347 }, // ā
-    { 22, 28, 22, 0, 28, 154, 16430 }, // Ă
-    { 15, 24, 16, 1, 23, 90, 16584 }, // ă
-    { 22, 28, 22, 0, 21, 154, 16674 }, // Ą
-    { 15, 23, 16, 1, 16, 87, 16828 }, // ą
-    { 17, 29, 19, 1, 28, 124, 16915 }, // Ć
-    { 13, 25, 15, 1, 24, 82, 17039 }, // ć
-    { 17, 29, 19, 1, 28, 124, 17121 }, // Ĉ
-    { 13, 25, 15, 1, 24, 82, 17245 }, // ĉ
-    { 17, 29, 19, 1, 28, 124, 17327 }, // Ċ
-    { 13, 23, 15, 1, 22, 75, 17451 }, // ċ
-    { 17, 29, 19, 1, 28, 124, 17526 }, // Č
-    { 13, 25, 15, 1, 24, 82, 17650 }, // č
-    { 20, 29, 22, 1, 28, 145, 17732 }, // Ď
-    { 20, 24, 19, 1, 23, 120, 17877 }, // ď
-    { 21, 22, 22, 0, 21, 116, 17997 }, // Đ
-    { 17, 24, 18, 1, 23, 102, 18113 }, // đ
-    { 17, 26, 18, 1, 26, 111, 18215 }, // Ē
-    { 13, 22, 15, 1, 21, 72, 18326 }, // ē
-    { 17, 28, 18, 1, 28, 119, 18398 }, // Ĕ
-    { 13, 24, 15, 1, 23, 78, 18517 }, // ĕ
-    { 17, 28, 18, 1, 28, 119, 18595 }, // Ė
-    { 13, 23, 15, 1, 22, 75, 18714 }, // ė
-    { 17, 28, 18, 1, 21, 119, 18789 }, // Ę
-    { 13, 23, 15, 1, 16, 75, 18908 }, // ę
-    { 17, 28, 18, 1, 28, 119, 18983 }, // Ě
-    { 13, 25, 15, 1, 24, 82, 19102 }, // ě
-    { 19, 29, 21, 1, 28, 138, 19184 }, // Ĝ
-    { 17, 31, 17, 0, 24, 132, 19322 }, // ĝ
-    { 19, 29, 21, 1, 28, 138, 19454 }, // Ğ
-    { 17, 30, 17, 0, 23, 128, 19592 }, // ğ
-    { 19, 29, 21, 1, 28, 138, 19720 }, // Ġ
-    { 17, 29, 17, 0, 22, 124, 19858 }, // ġ
-    { 19, 29, 21, 1, 21, 138, 19982 }, // Ģ
-    { 17, 32, 17, 0, 25, 136, 20120 }, // ģ
-    { 23, 28, 24, 1, 28, 161, 20256 }, // Ĥ
-    { 20, 30, 19, -1, 30, 150, 20417 }, // ĥ
-    { 24, 21, 24, 0, 21, 126, 20567 }, // Ħ
-    { 19, 23, 19, 0, 23, 110, 20693 }, // ħ
-    { 11, 28, 11, 0, 28, 77, 20803 }, // Ĩ
-    { 10, 23, 10, 0, 23, 58, 20880 }, // ĩ
-    { 11, 26, 11, 0, 26, 72, 20938 }, // Ī
-    { 10, 21, 10, 0, 21, 53, 21010 }, // ī
-    { 11, 28, 11, 0, 28, 77, 21063 }, // Ĭ
-    { 10, 23, 10, 0, 23, 58, 21140 }, // ĭ
-    { 9, 28, 11, 1, 21, 63, 21198 }, // Į
-    { 10, 30, 10, 0, 23, 75, 21261 }, // į
-    { 9, 28, 11, 1, 28, 63, 21336 }, // İ
-    { 10, 16, 10, 0, 16, 40, 21399 }, // ı
-    { 20, 27, 21, 1, 21, 135, 21439 }, // Ĳ
-    { 16, 30, 18, 0, 23, 120, 21574 }, // ĳ
-    { 13, 34, 11, -2, 28, 111, 21694 }, // Ĵ
-    { 11, 31, 8, -2, 24, 86, 21805 }, // ĵ
-    { 21, 29, 21, 1, 21, 153, 21891 }, // Ķ
-    { 18, 31, 18, 0, 23, 140, 22044 }, // ķ
-    { 18, 17, 18, 0, 16, 77, 22184 }, // ĸ
-    { 17, 28, 17, 1, 28, 119, 22261 }, // Ĺ
-    { 9, 30, 9, 0, 30, 68, 22380 }, // ĺ
-    { 17, 29, 17, 1, 21, 124, 22448 }, // Ļ
-    { 9, 31, 9, 0, 23, 70, 22572 }, // ļ
-    { 17, 23, 17, 1, 23, 98, 22642 }, // Ľ
-    { 12, 23, 10, 0, 23, 69, 22740 }, // ľ
-    { 17, 21, 17, 1, 21, 90, 22809 }, // Ŀ
-    { 14, 23, 14, 0, 23, 81, 22899 }, // ŀ
-    { 19, 21, 17, -1, 21, 100, 22980 }, // Ł
-    { 11, 23, 9, -1, 23, 64, 23080 }, // ł
-    { 22, 29, 24, 1, 28, 160, 23144 }, // Ń
-    { 19, 24, 19, 0, 24, 114, 23304 }, // ń
-    { 22, 29, 24, 1, 21, 160, 23418 }, // Ņ
-    { 19, 24, 19, 0, 16, 114, 23578 }, // ņ
-    { 22, 29, 24, 1, 28, 160, 23692 }, // Ň
-    { 19, 24, 19, 0, 24, 114, 23852 }, // ň
-    { 26, 22, 26, 0, 22, 143, 23966 }, // ŉ
-    { 22, 27, 24, 1, 21, 149, 24109 }, // Ŋ
-    { 17, 23, 19, 0, 16, 98, 24258 }, // ŋ
-    { 21, 27, 23, 1, 26, 142, 24356 }, // Ō
-    { 16, 22, 17, 1, 21, 88, 24498 }, // ō
-    { 21, 29, 23, 1, 28, 153, 24586 }, // Ŏ
-    { 16, 24, 17, 1, 23, 96, 24739 }, // ŏ
-    { 21, 30, 23, 1, 29, 158, 24835 }, // Ő
-    { 16, 25, 17, 1, 24, 100, 24993 }, // ő
-    { 26, 22, 28, 1, 21, 143, 25093 }, // Œ
-    { 25, 17, 26, 1, 16, 107, 25236 }, // œ
-    { 20, 29, 20, 1, 28, 145, 25343 }, // Ŕ
-    { 13, 24, 13, 0, 24, 78, 25488 }, // ŕ
-    { 20, 29, 20, 1, 21, 145, 25566 }, // Ŗ
-    { 13, 24, 13, 0, 16, 78, 25711 }, // ŗ
-    { 20, 29, 20, 1, 28, 145, 25789 }, // Ř
-    { 13, 24, 13, 0, 24, 78, 25934 }, // ř
-    { 14, 29, 16, 1, 28, 102, 26012 }, // Ś
-    { 12, 25, 14, 1, 24, 75, 26114 }, // ś
-    { 14, 29, 16, 1, 28, 102, 26189 }, // Ŝ
-    { 12, 25, 14, 1, 24, 75, 26291 }, // ŝ
-    { 14, 29, 16, 1, 21, 102, 26366 }, // Ş
-    { 12, 24, 14, 1, 16, 72, 26468 }, // ş
-    { 14, 29, 16, 1, 28, 102, 26540 }, // Š
-    { 12, 25, 14, 1, 24, 75, 26642 }, // š
-    { 18, 29, 20, 1, 21, 131, 26717 }, // Ţ
-    { 12, 27, 12, 0, 19, 81, 26848 }, // ţ
-    { 18, 28, 20, 1, 28, 126, 26929 }, // Ť
-    { 12, 25, 12, 0, 24, 75, 27055 }, // ť
-    { 18, 21, 20, 1, 21, 95, 27130 }, // Ŧ
-    { 12, 20, 12, 0, 19, 60, 27225 }, // ŧ
-    { 22, 29, 22, 0, 28, 160, 27285 }, // Ũ
-    { 19, 24, 19, 0, 23, 114, 27445 }, // ũ
-    { 22, 27, 22, 0, 26, 149, 27559 }, // Ū
-    { 19, 22, 19, 0, 21, 105, 27708 }, // ū
-    { 22, 29, 22, 0, 28, 160, 27813 }, // Ŭ
-    { 19, 24, 19, 0, 23, 114, 27973 }, // ŭ
-    { 22, 30, 22, 0, 29, 165, 28087 }, // Ů
-    { 19, 25, 19, 0, 24, 119, 28252 }, // ů
-    { 22, 30, 22, 0, 29, 165, 28371 }, // Ű
-    { 19, 25, 19, 0, 24, 119, 28536 }, // ű
-    { 22, 28, 22, 0, 21, 154, 28655 }, // Ų
-    { 19, 23, 19, 0, 16, 110, 28809 }, // ų
-    { 32, 29, 32, 0, 28, 232, 28919 }, // Ŵ
-    { 26, 25, 26, 0, 24, 163, 29151 }, // ŵ
-    { 20, 28, 20, 0, 28, 140, 29314 }, // Ŷ
-    { 18, 31, 17, 0, 24, 140, 29454 }, // ŷ
-    { 20, 27, 20, 0, 27, 135, 29594 }, // Ÿ
-    { 16, 29, 17, 1, 28, 116, 29729 }, // Ź
-    { 14, 25, 15, 0, 24, 88, 29845 }, // ź
-    { 16, 29, 17, 1, 28, 116, 29933 }, // Ż
-    { 14, 23, 15, 0, 22, 81, 30049 }, // ż
-    { 16, 29, 17, 1, 28, 116, 30130 }, // Ž
-    { 14, 25, 15, 0, 24, 88, 30246 }, // ž
-    { 14, 23, 12, 0, 23, 81, 30334 }, // ſ
-    { 7, 7, 0, -5, 24, 13, 30415 }, // ̀
-    { 6, 7, 0, -2, 24, 11, 30428 }, // ́
-    { 10, 7, 0, -5, 24, 18, 30439 }, // ̂
-    { 10, 6, 0, -5, 23, 15, 30457 }, // ̃
-    { 10, 3, 0, -5, 21, 8, 30472 }, // ̄
-    { 10, 6, 0, -5, 23, 15, 30480 }, // ̆
-    { 4, 4, 0, -2, 22, 4, 30495 }, // ̇
-    { 10, 4, 0, -5, 22, 10, 30499 }, // ̈
-    { 8, 9, 0, -4, 26, 18, 30509 }, // ̉
-    { 8, 8, 0, -4, 24, 16, 30527 }, // ̊
-    { 11, 7, 0, -4, 24, 20, 30543 }, // ̋
-    { 10, 7, 0, -5, 24, 18, 30563 }, // ̌
-    { 11, 7, 0, -7, 24, 20, 30581 }, // ̏
-    { 10, 6, 0, -5, 23, 15, 30601 }, // ̑
-    { 6, 9, 0, -3, 25, 14, 30616 }, // ̒
-    { 5, 9, 0, -2, 26, 12, 30630 }, // ̓
-    { 5, 9, 0, -3, 26, 12, 30642 }, // ̔
-    { 4, 8, 0, -2, 25, 8, 30654 }, // ̕
-    { 5, 7, 0, -2, 19, 9, 30662 }, // ̛
-    { 4, 5, 0, -2, -2, 5, 30671 }, // ̣
-    { 10, 5, 0, -5, -2, 13, 30676 }, // ̤
-    { 8, 7, 0, -4, -1, 14, 30689 }, // ̥
-    { 5, 7, 0, -3, -1, 9, 30703 }, // ̦
-    { 6, 7, 0, -3, -1, 11, 30712 }, // ̧
-    { 7, 8, 0, -3, 1, 14, 30723 }, // ̨
-    { 4, 7, 8, 2, -1, 7, 30737 }, // ̩
-    { 10, 6, 0, -5, -2, 15, 30744 }, // ̭
-    { 10, 6, 0, -5, -1, 15, 30759 }, // ̮
-    { 10, 5, 0, -5, -2, 13, 30774 }, // ̰
-    { 10, 3, 0, -5, -3, 8, 30787 }, // ̱
-    { 10, 6, 0, -5, 23, 15, 30795 }, // ͂
-    { 12, 11, 0, -6, 29, 33, 30810 }, // ̈́
-    { 6, 5, 0, -2, -2, 8, 30843 }, // ͅ
-    { 17, 28, 18, 1, 28, 119, 30851 }, // Ѐ
-    { 17, 27, 18, 1, 27, 115, 30970 }, // Ё
-    { 22, 27, 23, 1, 21, 149, 31085 }, // Ђ
-    { 15, 28, 17, 1, 28, 105, 31234 }, // Ѓ
-    { 18, 22, 19, 1, 21, 99, 31339 }, // Є
-    { 14, 22, 16, 1, 21, 77, 31438 }, // Ѕ
-    { 9, 21, 11, 1, 21, 48, 31515 }, // І
-    { 11, 27, 11, 0, 27, 75, 31563 }, // Ї
-    { 12, 27, 11, -2, 21, 81, 31638 }, // Ј
-    { 28, 22, 28, 0, 21, 154, 31719 }, // Љ
-    { 28, 22, 30, 1, 21, 154, 31873 }, // Њ
-    { 24, 21, 25, 1, 21, 126, 32027 }, // Ћ
-    { 20, 29, 21, 1, 28, 145, 32153 }, // Ќ
-    { 22, 28, 24, 1, 28, 154, 32298 }, // Ѝ
-    { 21, 29, 21, 0, 28, 153, 32452 }, // Ў
-    { 21, 28, 23, 1, 21, 147, 32605 }, // Џ
-    { 22, 21, 22, 0, 21, 116, 32752 }, // А
-    { 17, 22, 18, 1, 21, 94, 32868 }, // Б
-    { 16, 22, 18, 1, 21, 88, 32962 }, // В
-    { 15, 21, 17, 1, 21, 79, 33050 }, // Г
-    { 21, 27, 22, 0, 21, 142, 33129 }, // Д
-    { 17, 21, 18, 1, 21, 90, 33271 }, // Е
-    { 29, 22, 29, 0, 21, 160, 33361 }, // Ж
-    { 15, 22, 17, 1, 21, 83, 33521 }, // З
-    { 22, 21, 24, 1, 21, 116, 33604 }, // И
-    { 22, 28, 24, 1, 28, 154, 33720 }, // Й
-    { 20, 22, 21, 1, 21, 110, 33874 }, // К
-    { 21, 22, 22, 0, 21, 116, 33984 }, // Л
-    { 26, 21, 26, 0, 21, 137, 34100 }, // М
-    { 23, 21, 24, 1, 21, 121, 34237 }, // Н
-    { 21, 22, 23, 1, 21, 116, 34358 }, // О
-    { 22, 21, 23, 1, 21, 116, 34474 }, // П
-    { 16, 21, 17, 1, 21, 84, 34590 }, // Р
-    { 17, 22, 19, 1, 21, 94, 34674 }, // С
-    { 18, 21, 20, 1, 21, 95, 34768 }, // Т
-    { 21, 22, 21, 0, 21, 116, 34863 }, // У
-    { 21, 22, 23, 1, 21, 116, 34979 }, // Ф
-    { 21, 21, 21, 0, 21, 111, 35095 }, // Х
-    { 22, 27, 23, 1, 21, 149, 35206 }, // Ц
-    { 20, 21, 21, 0, 21, 105, 35355 }, // Ч
-    { 29, 21, 31, 1, 21, 153, 35460 }, // Ш
-    { 30, 27, 31, 1, 21, 203, 35613 }, // Щ
-    { 21, 22, 22, 1, 21, 116, 35816 }, // Ъ
-    { 26, 22, 27, 1, 21, 143, 35932 }, // Ы
-    { 17, 22, 18, 1, 21, 94, 36075 }, // Ь
-    { 18, 22, 19, 1, 21, 99, 36169 }, // Э
-    { 29, 22, 31, 1, 21, 160, 36268 }, // Ю
-    { 20, 22, 19, -1, 21, 110, 36428 }, // Я
-    { 15, 17, 16, 1, 16, 64, 36538 }, // а
-    { 15, 24, 17, 1, 23, 90, 36602 }, // б
-    { 14, 16, 16, 1, 15, 56, 36692 }, // в
-    { 13, 15, 14, 1, 15, 49, 36748 }, // г
-    { 18, 21, 19, 0, 15, 95, 36797 }, // д
-    { 13, 17, 15, 1, 16, 56, 36892 }, // е
-    { 24, 17, 23, 0, 16, 102, 36948 }, // ж
-    { 13, 17, 14, 0, 16, 56, 37050 }, // з
-    { 18, 15, 20, 1, 15, 68, 37106 }, // и
-    { 18, 22, 20, 1, 22, 99, 37174 }, // й
-    { 16, 17, 17, 1, 16, 68, 37273 }, // к
-    { 17, 16, 18, 0, 15, 68, 37341 }, // л
-    { 21, 15, 22, 1, 15, 79, 37409 }, // м
-    { 19, 15, 20, 1, 15, 72, 37488 }, // н
-    { 16, 17, 17, 1, 16, 68, 37560 }, // о
-    { 18, 15, 20, 1, 15, 68, 37628 }, // п
-    { 17, 23, 18, 0, 16, 98, 37696 }, // р
-    { 13, 17, 15, 1, 16, 56, 37794 }, // с
-    { 15, 15, 16, 1, 15, 57, 37850 }, // т
-    { 18, 22, 17, 0, 15, 99, 37907 }, // у
-    { 20, 30, 21, 1, 23, 150, 38006 }, // ф
-    { 17, 15, 17, 0, 15, 64, 38156 }, // х
-    { 19, 21, 20, 1, 15, 100, 38220 }, // ц
-    { 17, 15, 18, 0, 15, 64, 38320 }, // ч
-    { 24, 15, 26, 1, 15, 90, 38384 }, // ш
-    { 25, 21, 26, 1, 15, 132, 38474 }, // щ
-    { 17, 16, 19, 1, 15, 68, 38606 }, // ъ
-    { 22, 16, 24, 1, 15, 88, 38674 }, // ы
-    { 14, 16, 16, 1, 15, 56, 38762 }, // ь
-    { 13, 17, 15, 1, 16, 56, 38818 }, // э
-    { 23, 17, 24, 1, 16, 98, 38874 }, // ю
-    { 16, 16, 17, 0, 15, 64, 38972 }, // я
-    { 13, 25, 15, 1, 24, 82, 39036 }, // ѐ
-    { 13, 23, 15, 1, 22, 75, 39118 }, // ё
-    { 17, 30, 18, 0, 23, 128, 39193 }, // ђ
-    { 13, 24, 14, 1, 24, 78, 39321 }, // ѓ
-    { 13, 17, 15, 1, 16, 56, 39399 }, // є
-    { 12, 17, 14, 1, 16, 51, 39455 }, // ѕ
-    { 10, 23, 10, 0, 23, 58, 39506 }, // і
-    { 11, 22, 10, -1, 22, 61, 39564 }, // ї
-    { 9, 30, 8, -2, 23, 68, 39625 }, // ј
-    { 23, 16, 23, 0, 15, 92, 39693 }, // љ
-    { 23, 16, 25, 1, 15, 92, 39785 }, // њ
-    { 19, 23, 19, 0, 23, 110, 39877 }, // ћ
-    { 16, 25, 17, 1, 24, 100, 39987 }, // ќ
-    { 18, 24, 20, 1, 24, 108, 40087 }, // ѝ
-    { 18, 29, 17, 0, 22, 131, 40195 }, // ў
-    { 18, 21, 20, 1, 15, 95, 40326 }, // џ
-    { 21, 24, 21, 0, 23, 126, 40421 }, // Ѣ
-    { 16, 22, 18, 1, 21, 88, 40547 }, // ѣ
-    { 21, 22, 23, 1, 21, 116, 40635 }, // Ѳ
-    { 16, 17, 17, 1, 16, 68, 40751 }, // ѳ
-    { 22, 22, 22, 0, 21, 121, 40819 }, // Ѵ
-    { 18, 17, 18, 0, 16, 77, 40940 }, // ѵ
-    { 23, 34, 24, 1, 28, 196, 41017 }, // Ҋ
-    { 19, 28, 20, 1, 22, 133, 41213 }, // ҋ
-    { 18, 22, 18, 0, 21, 99, 41346 }, // Ҍ
-    { 15, 22, 15, 0, 21, 83, 41445 }, // ҍ
-    { 16, 21, 17, 1, 21, 84, 41528 }, // Ҏ
-    { 17, 23, 18, 0, 16, 98, 41612 }, // ҏ
-    { 15, 24, 16, 1, 24, 90, 41710 }, // Ґ
-    { 13, 19, 14, 1, 19, 62, 41800 }, // ґ
-    { 16, 21, 17, 0, 21, 84, 41862 }, // Ғ
-    { 13, 15, 14, 1, 15, 49, 41946 }, // ғ
-    { 18, 27, 19, 1, 21, 122, 41995 }, // Ҕ
-    { 16, 22, 18, 1, 15, 88, 42117 }, // ҕ
-    { 29, 27, 29, 0, 21, 196, 42205 }, // Җ
-    { 24, 22, 23, 0, 16, 132, 42401 }, // җ
-    { 15, 27, 17, 1, 21, 102, 42533 }, // Ҙ
-    { 13, 22, 14, 0, 16, 72, 42635 }, // ҙ
-    { 20, 27, 21, 1, 21, 135, 42707 }, // Қ
-    { 16, 22, 17, 1, 16, 88, 42842 }, // қ
-    { 21, 22, 22, 1, 21, 116, 42930 }, // Ҝ
-    { 17, 17, 18, 1, 16, 73, 43046 }, // ҝ
-    { 20, 22, 21, 1, 21, 110, 43119 }, // Ҟ
-    { 16, 22, 16, 0, 21, 88, 43229 }, // ҟ
-    { 23, 22, 24, 1, 21, 127, 43317 }, // Ҡ
-    { 18, 17, 19, 1, 16, 77, 43444 }, // ҡ
-    { 23, 27, 24, 1, 21, 156, 43521 }, // Ң
-    { 19, 21, 20, 1, 15, 100, 43677 }, // ң
-    { 27, 21, 28, 1, 21, 142, 43777 }, // Ҥ
-    { 21, 15, 23, 1, 15, 79, 43919 }, // ҥ
-    { 29, 27, 30, 1, 21, 196, 43998 }, // Ҧ
-    { 26, 22, 28, 1, 15, 143, 44194 }, // ҧ
-    { 23, 22, 24, 1, 21, 127, 44337 }, // Ҩ
-    { 18, 17, 19, 1, 16, 77, 44464 }, // ҩ
-    { 17, 27, 19, 1, 21, 115, 44541 }, // Ҫ
-    { 13, 22, 15, 1, 16, 72, 44656 }, // ҫ
-    { 18, 27, 20, 1, 21, 122, 44728 }, // Ҭ
-    { 15, 21, 16, 1, 15, 79, 44850 }, // ҭ
-    { 20, 21, 20, 0, 21, 105, 44929 }, // Ү
-    { 18, 22, 17, 0, 15, 99, 45034 }, // ү
-    { 20, 21, 20, 0, 21, 105, 45133 }, // Ұ
-    { 18, 22, 17, 0, 15, 99, 45238 }, // ұ
-    { 21, 27, 21, 0, 21, 142, 45337 }, // Ҳ
-    { 17, 21, 17, 0, 15, 90, 45479 }, // ҳ
-    { 25, 27, 26, 1, 21, 169, 45569 }, // Ҵ
-    { 23, 21, 23, 0, 15, 121, 45738 }, // ҵ
-    { 20, 27, 21, 0, 21, 135, 45859 }, // Ҷ
-    { 18, 21, 18, 0, 15, 95, 45994 }, // ҷ
-    { 20, 21, 21, 0, 21, 105, 46089 }, // Ҹ
-    { 17, 15, 18, 0, 15, 64, 46194 }, // ҹ
-    { 20, 21, 21, 1, 21, 105, 46258 }, // Һ
-    { 19, 23, 19, 0, 23, 110, 46363 }, // һ
-    { 23, 22, 24, 0, 21, 127, 46473 }, // Ҽ
-    { 18, 17, 18, 0, 16, 77, 46600 }, // ҽ
-    { 23, 27, 24, 0, 21, 156, 46677 }, // Ҿ
-    { 18, 22, 18, 0, 16, 99, 46833 }, // ҿ
-    { 9, 21, 11, 1, 21, 48, 46932 }, // Ӏ
-    { 29, 29, 29, 0, 28, 211, 46980 }, // Ӂ
-    { 24, 23, 23, 0, 22, 138, 47191 }, // ӂ
-    { 19, 27, 20, 1, 21, 129, 47329 }, // Ӄ
-    { 15, 23, 17, 1, 16, 87, 47458 }, // ӄ
-    { 21, 27, 22, 0, 21, 142, 47545 }, // Ӆ
-    { 18, 21, 18, 0, 15, 95, 47687 }, // ӆ
-    { 23, 27, 24, 1, 21, 156, 47782 }, // Ӈ
-    { 19, 22, 20, 1, 15, 105, 47938 }, // ӈ
-    { 23, 27, 24, 1, 21, 156, 48043 }, // Ӊ
-    { 19, 21, 20, 1, 15, 100, 48199 }, // ӊ
-    { 20, 27, 21, 0, 21, 135, 48299 }, // Ӌ
-    { 17, 21, 18, 0, 15, 90, 48434 }, // ӌ
-    { 26, 27, 26, 0, 21, 176, 48524 }, // Ӎ
-    { 21, 21, 22, 1, 15, 111, 48700 }, // ӎ
-    { 9, 23, 9, 0, 23, 52, 48811 }, // ӏ
-    { 22, 28, 22, 0, 28, 154, 48863 }, // Ӑ
-    { 15, 23, 16, 1, 22, 87, 49017 }, // ӑ
-    { 22, 27, 22, 0, 27, 149, 49104 }, // Ӓ
-    { 15, 23, 16, 1, 22, 87, 49253 }, // ӓ
-    { 27, 21, 27, -1, 21, 142, 49340 }, // Ӕ
-    { 22, 17, 24, 1, 16, 94, 49482 }, // ӕ
-    { 17, 28, 18, 1, 28, 119, 49576 }, // Ӗ
-    { 13, 23, 15, 1, 22, 75, 49695 }, // ӗ
-    { 18, 22, 20, 1, 21, 99, 49770 }, // Ә
-    { 13, 17, 15, 1, 16, 56, 49869 }, // ә
-    { 18, 28, 20, 1, 27, 126, 49925 }, // Ӛ
-    { 13, 23, 15, 1, 22, 75, 50051 }, // ӛ
-    { 29, 28, 29, 0, 27, 203, 50126 }, // Ӝ
-    { 24, 23, 23, 0, 22, 138, 50329 }, // ӝ
-    { 15, 28, 17, 1, 27, 105, 50467 }, // Ӟ
-    { 13, 23, 14, 0, 22, 75, 50572 }, // ӟ
-    { 16, 22, 17, 0, 21, 88, 50647 }, // Ӡ
-    { 14, 22, 15, 0, 15, 77, 50735 }, // ӡ
-    { 22, 26, 24, 1, 26, 143, 50812 }, // Ӣ
-    { 18, 21, 20, 1, 21, 95, 50955 }, // ӣ
-    { 22, 27, 24, 1, 27, 149, 51050 }, // Ӥ
-    { 18, 22, 20, 1, 22, 99, 51199 }, // ӥ
-    { 21, 28, 23, 1, 27, 147, 51298 }, // Ӧ
-    { 16, 23, 17, 1, 22, 92, 51445 }, // ӧ
-    { 21, 22, 23, 1, 21, 116, 51537 }, // Ө
-    { 16, 17, 17, 1, 16, 68, 51653 }, // ө
-    { 21, 28, 24, 1, 27, 147, 51721 }, // Ӫ
-    { 16, 23, 17, 1, 22, 92, 51868 }, // ӫ
-    { 18, 28, 19, 1, 27, 126, 51960 }, // Ӭ
-    { 13, 23, 15, 1, 22, 75, 52086 }, // ӭ
-    { 21, 27, 21, 0, 26, 142, 52161 }, // Ӯ
-    { 18, 28, 17, 0, 21, 126, 52303 }, // ӯ
-    { 21, 28, 21, 0, 27, 147, 52429 }, // Ӱ
-    { 18, 29, 17, 0, 22, 131, 52576 }, // ӱ
-    { 21, 30, 21, 0, 29, 158, 52707 }, // Ӳ
-    { 18, 31, 17, 0, 24, 140, 52865 }, // ӳ
-    { 20, 27, 21, 0, 27, 135, 53005 }, // Ӵ
-    { 17, 22, 18, 0, 22, 94, 53140 }, // ӵ
-    { 15, 27, 17, 1, 21, 102, 53234 }, // Ӷ
-    { 13, 21, 14, 1, 15, 69, 53336 }, // ӷ
-    { 26, 28, 28, 1, 27, 182, 53405 }, // Ӹ
-    { 22, 23, 24, 1, 22, 127, 53587 }, // ӹ
-    { 16, 27, 17, 0, 21, 108, 53714 }, // Ӻ
-    { 13, 21, 14, 1, 15, 69, 53822 }, // ӻ
-    { 21, 27, 20, 0, 21, 142, 53891 }, // Ӽ
-    { 17, 22, 17, 0, 15, 94, 54033 }, // ӽ
-    { 21, 21, 21, 0, 21, 111, 54127 }, // Ӿ
-    { 17, 15, 17, 0, 15, 64, 54238 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 54302 }, //  
-    { 0, 0, 29, 0, 0, 0, 54302 }, //  
-    { 0, 0, 15, 0, 0, 0, 54302 }, //  
-    { 0, 0, 29, 0, 0, 0, 54302 }, //  
-    { 0, 0, 10, 0, 0, 0, 54302 }, //  
-    { 0, 0, 7, 0, 0, 0, 54302 }, //  
-    { 0, 0, 5, 0, 0, 0, 54302 }, //  
-    { 0, 0, 18, 0, 0, 0, 54302 }, //  
-    { 0, 0, 8, 0, 0, 0, 54302 }, //  
-    { 0, 0, 6, 0, 0, 0, 54302 }, //  
-    { 0, 0, 1, 0, 0, 0, 54302 }, //  
-    { 0, 0, 0, 0, 0, 0, 54302 }, // ​
-    { 2, 24, 0, -1, 17, 12, 54302 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 54314 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 54353 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 54423 }, // ‏
-    { 9, 3, 11, 1, 9, 7, 54493 }, // ‐
-    { 9, 3, 11, 1, 9, 7, 54500 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 54507 }, // ‒
-    { 15, 3, 15, 0, 9, 12, 54518 }, // –
-    { 29, 3, 29, 0, 9, 22, 54530 }, // —
-    { 29, 3, 29, 0, 9, 22, 54552 }, // ―
-    { 10, 30, 15, 2, 23, 75, 54574 }, // ‖
-    { 15, 7, 15, 0, -1, 27, 54649 }, // ‗
-    { 5, 10, 7, 1, 22, 13, 54676 }, // ‘
-    { 6, 10, 7, 0, 22, 15, 54689 }, // ’
-    { 6, 10, 7, 0, 4, 15, 54704 }, // ‚
-    { 5, 10, 7, 1, 22, 13, 54719 }, // ‛
-    { 11, 10, 13, 1, 22, 28, 54732 }, // “
-    { 12, 10, 13, 0, 22, 30, 54760 }, // ”
-    { 12, 10, 13, 0, 4, 30, 54790 }, // „
-    { 11, 10, 13, 1, 22, 28, 54820 }, // ‟
-    { 14, 19, 15, 0, 21, 67, 54848 }, // †
-    { 14, 23, 15, 0, 21, 81, 54915 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 54996 }, // •
-    { 10, 10, 18, 4, 15, 25, 55009 }, // ‣
-    { 6, 5, 8, 1, 4, 8, 55034 }, // ․
-    { 12, 5, 15, 1, 4, 15, 55042 }, // ‥
-    { 25, 5, 29, 2, 4, 32, 55057 }, // …
-    { 6, 4, 8, 1, 10, 6, 55089 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 55095 }, //  
-    { 0, 0, 0, 0, 0, 0, 55095 }, //  
-    { 10, 28, 0, -5, 21, 70, 55095 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 55165 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 55235 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 55303 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 55387 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 55471 }, //  
-    { 38, 24, 40, 1, 22, 228, 55471 }, // ‰
-    { 6, 10, 8, 1, 21, 15, 55699 }, // ′
-    { 12, 10, 13, 1, 21, 30, 55714 }, // ″
-    { 17, 10, 19, 1, 21, 43, 55744 }, // ‴
-    { 6, 10, 8, 1, 21, 15, 55787 }, // ‵
-    { 12, 10, 14, 1, 21, 30, 55802 }, // ‶
-    { 19, 10, 20, 1, 21, 48, 55832 }, // ‷
-    { 13, 6, 14, 1, 0, 20, 55880 }, // ‸
-    { 7, 11, 9, 1, 13, 20, 55900 }, // ‹
-    { 8, 11, 9, 1, 13, 22, 55920 }, // ›
-    { 18, 20, 18, 0, 19, 90, 55942 }, // ※
-    { 13, 23, 16, 2, 22, 75, 56032 }, // ‼
-    { 15, 3, 15, 0, 24, 12, 56107 }, // ‾
-    { 7, 3, 9, 1, 9, 6, 56119 }, // ⁃
-    { 15, 24, 5, -5, 22, 90, 56125 }, // ⁄
-    { 23, 23, 26, 2, 22, 133, 56215 }, // ⁇
-    { 19, 23, 22, 2, 22, 110, 56348 }, // ⁈
-    { 19, 23, 22, 2, 22, 110, 56458 }, // ⁉
-    { 17, 5, 29, 6, 11, 22, 56568 }, // ⁓
-    { 23, 10, 25, 1, 21, 58, 56590 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 56648 }, //  
-    { 0, 0, 0, 0, 0, 0, 56648 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 56648 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 56648 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 56648 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 56648 }, // ⁤
-    { 11, 14, 13, 1, 24, 39, 56648 }, // ⁰
-    { 11, 14, 13, 1, 24, 39, 56687 }, // ⁴
-    { 10, 14, 13, 1, 24, 35, 56726 }, // ⁵
-    { 11, 14, 13, 1, 24, 39, 56761 }, // ⁶
-    { 10, 14, 13, 2, 24, 35, 56800 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 56835 }, // ⁸
-    { 11, 14, 13, 1, 24, 39, 56874 }, // ⁹
-    { 13, 11, 16, 2, 21, 36, 56913 }, // ⁿ
-    { 11, 15, 13, 1, 10, 42, 56949 }, // ₀
-    { 9, 14, 13, 2, 10, 32, 56991 }, // ₁
-    { 11, 14, 13, 1, 10, 39, 57023 }, // ₂
-    { 9, 15, 13, 2, 10, 34, 57062 }, // ₃
-    { 11, 15, 13, 1, 10, 42, 57096 }, // ₄
-    { 10, 14, 13, 1, 9, 35, 57138 }, // ₅
-    { 11, 15, 13, 1, 10, 42, 57173 }, // ₆
-    { 10, 14, 13, 2, 9, 35, 57215 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 57250 }, // ₈
-    { 11, 15, 13, 1, 10, 42, 57292 }, // ₉
-    { 15, 20, 18, 1, 20, 75, 57334 }, // ₣
-    { 16, 22, 18, 1, 21, 88, 57409 }, // ₤
-    { 36, 22, 36, 0, 21, 198, 57497 }, // ₧
-    { 18, 22, 18, 0, 21, 99, 57695 }, // €
-    { 17, 12, 29, 6, 16, 51, 57794 }, // ←
-    { 13, 20, 29, 8, 20, 65, 57845 }, // ↑
-    { 17, 12, 29, 6, 16, 51, 57910 }, // →
-    { 13, 20, 29, 8, 20, 65, 57961 }, // ↓
-    { 18, 12, 29, 5, 16, 54, 58026 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 58080 }, // ↕
-    { 13, 20, 29, 8, 20, 65, 58145 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 58210 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 58275 }, // ↳
-    { 17, 14, 29, 6, 17, 60, 58340 }, // ↵
-    { 17, 14, 29, 6, 17, 60, 58400 }, // ⇐
-    { 13, 18, 29, 8, 19, 59, 58460 }, // ⇑
-    { 17, 14, 29, 6, 17, 60, 58519 }, // ⇒
-    { 13, 18, 29, 8, 19, 59, 58579 }, // ⇓
-    { 19, 14, 29, 5, 17, 67, 58638 }, // ⇔
-    { 19, 22, 29, 5, 21, 105, 58705 }, // ∀
-    { 14, 24, 18, 2, 23, 84, 58810 }, // ∂
-    { 13, 21, 29, 8, 21, 69, 58894 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 58963 }, // ∅
-    { 19, 21, 19, 0, 21, 100, 59101 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 59201 }, // ∇
-    { 19, 21, 29, 5, 21, 100, 59306 }, // ∈
-    { 19, 26, 29, 5, 23, 124, 59406 }, // ∉
-    { 19, 16, 29, 5, 18, 76, 59530 }, // ∊
-    { 19, 21, 29, 5, 21, 100, 59606 }, // ∋
-    { 19, 26, 29, 5, 23, 124, 59706 }, // ∌
-    { 19, 16, 29, 5, 18, 76, 59830 }, // ∍
-    { 22, 26, 23, 1, 21, 143, 59906 }, // ∏
-    { 18, 26, 18, 0, 21, 117, 60049 }, // ∑
-    { 13, 3, 18, 3, 11, 10, 60166 }, // −
-    { 13, 23, 14, 1, 21, 75, 60176 }, // ∕
-    { 13, 23, 15, 2, 21, 75, 60251 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 60326 }, // ∗
-    { 10, 10, 18, 4, 15, 25, 60375 }, // ∘
-    { 6, 4, 18, 6, 10, 6, 60400 }, // ∙
-    { 18, 28, 18, 0, 24, 126, 60406 }, // √
-    { 14, 11, 18, 2, 15, 39, 60532 }, // ∝
-    { 18, 10, 18, 0, 14, 45, 60571 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 60616 }, // ∟
-    { 21, 21, 29, 3, 21, 111, 60716 }, // ∠
-    { 4, 30, 15, 5, 23, 30, 60827 }, // ∣
-    { 9, 30, 15, 3, 23, 68, 60857 }, // ∥
-    { 19, 21, 29, 5, 21, 100, 60925 }, // ∧
-    { 19, 21, 29, 5, 21, 100, 61025 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 61125 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 61215 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 61309 }, // ∫
-    { 19, 17, 29, 5, 16, 81, 61429 }, // ∴
-    { 19, 17, 29, 5, 16, 81, 61510 }, // ∵
-    { 5, 16, 9, 2, 18, 20, 61591 }, // ∶
-    { 19, 17, 29, 5, 16, 81, 61611 }, // ∷
-    { 17, 5, 29, 6, 11, 22, 61692 }, // ∼
-    { 17, 15, 29, 6, 17, 64, 61714 }, // ≅
-    { 14, 10, 18, 2, 15, 35, 61778 }, // ≈
-    { 17, 10, 29, 6, 13, 43, 61813 }, // ≍
-    { 13, 13, 18, 3, 16, 43, 61856 }, // ≠
-    { 17, 13, 29, 6, 15, 56, 61899 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 61955 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 62018 }, // ≥
-    { 23, 14, 29, 3, 17, 81, 62081 }, // ≪
-    { 23, 14, 29, 3, 17, 81, 62162 }, // ≫
-    { 19, 16, 29, 5, 18, 76, 62243 }, // ⊃
-    { 19, 26, 29, 5, 23, 124, 62319 }, // ⊄
-    { 19, 26, 29, 5, 23, 124, 62443 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 62567 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 62667 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 62767 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 62883 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 62999 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 63115 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 63231 }, // ⊥
-    { 6, 5, 18, 6, 10, 8, 63321 }, // ⋅
-    { 25, 5, 29, 2, 10, 32, 63329 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 63361 }, // �
+    { 22, 21, 22, 0, 21, 116, 2048 }, // A
+    { 16, 22, 18, 1, 21, 88, 2164 }, // B
+    { 17, 22, 19, 1, 21, 94, 2252 }, // C
+    { 20, 22, 22, 1, 21, 110, 2346 }, // D
+    { 17, 21, 18, 1, 21, 90, 2456 }, // E
+    { 15, 21, 17, 1, 21, 79, 2546 }, // F
+    { 19, 22, 21, 1, 21, 105, 2625 }, // G
+    { 23, 21, 24, 1, 21, 121, 2730 }, // H
+    { 9, 21, 11, 1, 21, 48, 2851 }, // I
+    { 12, 27, 11, -2, 21, 81, 2899 }, // J
+    { 21, 22, 21, 1, 21, 116, 2980 }, // K
+    { 17, 21, 17, 1, 21, 90, 3096 }, // L
+    { 26, 21, 26, 0, 21, 137, 3186 }, // M
+    { 22, 22, 24, 1, 21, 121, 3323 }, // N
+    { 21, 22, 23, 1, 21, 116, 3444 }, // O
+    { 16, 21, 17, 1, 21, 84, 3560 }, // P
+    { 22, 27, 23, 1, 21, 149, 3644 }, // Q
+    { 20, 22, 20, 1, 21, 110, 3793 }, // R
+    { 14, 22, 16, 1, 21, 77, 3903 }, // S
+    { 18, 21, 20, 1, 21, 95, 3980 }, // T
+    { 22, 22, 22, 0, 21, 121, 4096 }, // U
+    { 21, 22, 21, 0, 21, 116, 4217 }, // V
+    { 32, 22, 32, 0, 21, 176, 4333 }, // W
+    { 21, 21, 21, 0, 21, 111, 4509 }, // X
+    { 20, 21, 20, 0, 21, 105, 4620 }, // Y
+    { 16, 22, 17, 1, 21, 88, 4725 }, // Z
+    { 6, 28, 9, 2, 23, 42, 4813 }, // [
+    { 13, 23, 14, 1, 21, 75, 4855 }, // <backslash>
+    { 6, 28, 9, 1, 23, 42, 4930 }, // ]
+    { 14, 14, 18, 2, 19, 49, 4972 }, // ^
+    { 15, 3, 15, 0, -1, 12, 5021 }, // _
+    { 7, 7, 19, 6, 24, 13, 5033 }, // `
+    { 15, 17, 16, 1, 16, 64, 5046 }, // a
+    { 18, 24, 17, -1, 23, 108, 5110 }, // b
+    { 13, 17, 15, 1, 16, 56, 5218 }, // c
+    { 17, 24, 18, 1, 23, 102, 5274 }, // d
+    { 13, 17, 15, 1, 16, 56, 5376 }, // e
+    { 14, 23, 12, 0, 23, 81, 5432 }, // f
+    { 17, 23, 17, 0, 16, 98, 5513 }, // g
+    { 19, 23, 19, 0, 23, 110, 5611 }, // h
+    { 10, 23, 10, 0, 23, 58, 5721 }, // i
+    { 9, 30, 8, -2, 23, 68, 5779 }, // j
+    { 18, 24, 18, 0, 23, 108, 5847 }, // k
+    { 9, 23, 9, 0, 23, 52, 5955 }, // l
+    { 29, 16, 29, 0, 16, 116, 6007 }, // m
+    { 19, 16, 19, 0, 16, 76, 6144 }, // n
+    { 16, 17, 17, 1, 16, 68, 6220 }, // o
+    { 17, 23, 18, 0, 16, 98, 6288 }, // p
+    { 17, 23, 17, 1, 16, 98, 6386 }, // q
+    { 13, 16, 13, 0, 16, 52, 6484 }, // r
+    { 12, 17, 14, 1, 16, 51, 6536 }, // s
+    { 12, 20, 12, 0, 19, 60, 6587 }, // t
+    { 19, 17, 19, 0, 16, 81, 6647 }, // u
+    { 18, 16, 17, 0, 15, 72, 6728 }, // v
+    { 26, 16, 26, 0, 15, 104, 6800 }, // w
+    { 17, 15, 17, 0, 15, 64, 6904 }, // x
+    { 18, 22, 17, 0, 15, 99, 6968 }, // y
+    { 14, 16, 15, 0, 15, 56, 7067 }, // z
+    { 9, 29, 11, 2, 24, 66, 7123 }, // {
+    { 4, 27, 8, 2, 23, 27, 7189 }, // |
+    { 9, 29, 11, 0, 24, 66, 7216 }, // }
+    { 14, 6, 18, 2, 13, 21, 7282 }, // ~
+    { 0, 0, 6, 0, 0, 0, 7303 }, //  
+    { 5, 23, 8, 1, 16, 29, 7303 }, // ¡
+    { 15, 29, 18, 1, 23, 109, 7332 }, // ¢
+    { 16, 22, 18, 1, 21, 88, 7441 }, // £
+    { 16, 14, 18, 1, 17, 56, 7529 }, // ¤
+    { 20, 20, 18, -1, 20, 100, 7585 }, // ¥
+    { 4, 27, 8, 2, 23, 27, 7685 }, // ¦
+    { 13, 23, 15, 1, 20, 75, 7712 }, // §
+    { 11, 4, 19, 4, 22, 11, 7787 }, // ¨
+    { 22, 22, 23, 0, 21, 121, 7798 }, // ©
+    { 11, 14, 13, 1, 21, 39, 7919 }, // ª
+    { 15, 11, 15, 1, 13, 42, 7958 }, // «
+    { 13, 8, 18, 3, 14, 26, 8000 }, // ¬
+    { 9, 3, 11, 1, 9, 7, 8026 }, // ­
+    { 17, 16, 17, 0, 23, 68, 8033 }, // ®
+    { 10, 3, 19, 5, 21, 8, 8101 }, // ¯
+    { 11, 11, 15, 2, 21, 31, 8109 }, // °
+    { 13, 17, 18, 3, 17, 56, 8192 }, // ±
+    { 11, 14, 13, 1, 24, 39, 8248 }, // ²
+    { 9, 14, 13, 2, 24, 32, 8287 }, // ³
+    { 6, 7, 19, 7, 24, 11, 8319 }, // ´
+    { 18, 23, 19, 2, 16, 104, 8330 }, // µ
+    { 15, 26, 16, 0, 21, 98, 8434 }, // ¶
+    { 6, 4, 8, 1, 10, 6, 8532 }, // ·
+    { 6, 7, 19, 7, -1, 11, 8538 }, // ¸
+    { 9, 14, 13, 2, 24, 32, 8549 }, // ¹
+    { 11, 14, 13, 1, 21, 39, 8581 }, // º
+    { 15, 11, 15, 1, 13, 42, 8620 }, // »
+    { 28, 24, 31, 2, 22, 168, 8662 }, // ¼
+    { 28, 24, 31, 2, 22, 168, 8830 }, // ½
+    { 29, 24, 31, 2, 22, 174, 8998 }, // ¾
+    { 11, 23, 14, 1, 16, 64, 9172 }, // ¿
+    { 22, 28, 22, 0, 28, 154, 9236 }, // À
+    { 22, 28, 22, 0, 28, 154, 9390 }, // Á
+    { 22, 28, 22, 0, 28, 154, 9544 }, // Â
+    { 22, 28, 22, 0, 28, 154, 9698 }, // Ã
+    { 22, 27, 22, 0, 27, 149, 9852 }, // Ä
+    { 22, 29, 22, 0, 29, 160, 10001 }, // Å
+    { 27, 21, 27, -1, 21, 142, 10240 }, // Æ
+    { 17, 29, 19, 1, 21, 124, 10382 }, // Ç
+    { 17, 28, 18, 1, 28, 119, 10506 }, // È
+    { 17, 28, 18, 1, 28, 119, 10625 }, // É
+    { 17, 28, 18, 1, 28, 119, 10744 }, // Ê
+    { 17, 27, 18, 1, 27, 115, 10863 }, // Ë
+    { 9, 28, 11, 1, 28, 63, 10978 }, // Ì
+    { 9, 28, 11, 1, 28, 63, 11041 }, // Í
+    { 11, 28, 11, 0, 28, 77, 11104 }, // Î
+    { 11, 27, 11, 0, 27, 75, 11181 }, // Ï
+    { 21, 22, 22, 0, 21, 116, 11256 }, // Ð
+    { 22, 29, 24, 1, 28, 160, 11372 }, // Ñ
+    { 21, 29, 23, 1, 28, 153, 11532 }, // Ò
+    { 21, 29, 23, 1, 28, 153, 11685 }, // Ó
+    { 21, 29, 23, 1, 28, 153, 11838 }, // Ô
+    { 21, 29, 23, 1, 28, 153, 11991 }, // Õ
+    { 21, 28, 23, 1, 27, 147, 12288 }, // Ö
+    { 12, 12, 18, 3, 16, 36, 12435 }, // ×
+    { 22, 22, 23, 0, 21, 121, 12471 }, // Ø
+    { 22, 29, 22, 0, 28, 160, 12592 }, // Ù
+    { 22, 29, 22, 0, 28, 160, 12752 }, // Ú
+    { 22, 29, 22, 0, 28, 160, 12912 }, // Û
+    { 22, 28, 22, 0, 27, 154, 13072 }, // Ü
+    { 20, 28, 20, 0, 28, 140, 13226 }, // Ý
+    { 16, 21, 18, 1, 21, 84, 13366 }, // Þ
+    { 18, 24, 19, 0, 23, 108, 13450 }, // ß
+    { 15, 25, 16, 1, 24, 94, 13558 }, // à
+    { 15, 25, 16, 1, 24, 94, 13652 }, // á
+    { 15, 25, 16, 1, 24, 94, 13746 }, // â
+    { 15, 24, 16, 1, 23, 90, 13840 }, // ã
+    { 15, 23, 16, 1, 22, 87, 13930 }, // ä
+    { 15, 25, 16, 1, 24, 94, 14017 }, // å
+    { 22, 17, 24, 1, 16, 94, 14111 }, // æ
+    { 13, 24, 15, 1, 16, 78, 14205 }, // ç
+    { 13, 25, 15, 1, 24, 82, 14336 }, // è
+    { 13, 25, 15, 1, 24, 82, 14418 }, // é
+    { 13, 25, 15, 1, 24, 82, 14500 }, // ê
+    { 13, 23, 15, 1, 22, 75, 14582 }, // ë
+    { 10, 24, 10, 0, 24, 60, 14657 }, // ì
+    { 10, 24, 10, 0, 24, 60, 14717 }, // í
+    { 10, 24, 10, 0, 24, 60, 14777 }, // î
+    { 11, 22, 10, -1, 22, 61, 14837 }, // ï
+    { 15, 25, 17, 1, 24, 94, 14898 }, // ð
+    { 19, 23, 19, 0, 23, 110, 14992 }, // ñ
+    { 16, 25, 17, 1, 24, 100, 15102 }, // ò
+    { 16, 25, 17, 1, 24, 100, 15202 }, // ó
+    { 16, 25, 17, 1, 24, 100, 15302 }, // ô
+    { 16, 24, 17, 1, 23, 96, 15402 }, // õ
+    { 16, 23, 17, 1, 22, 92, 15498 }, // ö
+    { 13, 14, 18, 3, 17, 46, 15590 }, // ÷
+    { 17, 17, 17, 0, 16, 73, 15636 }, // ø
+    { 19, 25, 19, 0, 24, 119, 15709 }, // ù
+    { 19, 25, 19, 0, 24, 119, 15828 }, // ú
+    { 19, 25, 19, 0, 24, 119, 15947 }, // û
+    { 19, 23, 19, 0, 22, 110, 16066 }, // ü
+    { 18, 31, 17, 0, 24, 140, 16176 }, // ý
+    { 17, 30, 18, 0, 23, 128, 16384 }, // þ
+    { 18, 29, 17, 0, 22, 131, 16512 }, // ÿ
+    { 22, 26, 22, 0, 26, 143, 16643 }, // Ā
+    { 15, 22, 16, 1, 21, 83, 16786 }, // ā
+    { 22, 28, 22, 0, 28, 154, 16869 }, // Ă
+    { 15, 24, 16, 1, 23, 90, 17023 }, // ă
+    { 22, 28, 22, 0, 21, 154, 17113 }, // Ą
+    { 15, 23, 16, 1, 16, 87, 17267 }, // ą
+    { 17, 29, 19, 1, 28, 124, 17354 }, // Ć
+    { 13, 25, 15, 1, 24, 82, 17478 }, // ć
+    { 17, 29, 19, 1, 28, 124, 17560 }, // Ĉ
+    { 13, 25, 15, 1, 24, 82, 17684 }, // ĉ
+    { 17, 29, 19, 1, 28, 124, 17766 }, // Ċ
+    { 13, 23, 15, 1, 22, 75, 17890 }, // ċ
+    { 17, 29, 19, 1, 28, 124, 17965 }, // Č
+    { 13, 25, 15, 1, 24, 82, 18089 }, // č
+    { 20, 29, 22, 1, 28, 145, 18171 }, // Ď
+    { 20, 24, 19, 1, 23, 120, 18432 }, // ď
+    { 21, 22, 22, 0, 21, 116, 18552 }, // Đ
+    { 17, 24, 18, 1, 23, 102, 18668 }, // đ
+    { 17, 26, 18, 1, 26, 111, 18770 }, // Ē
+    { 13, 22, 15, 1, 21, 72, 18881 }, // ē
+    { 17, 28, 18, 1, 28, 119, 18953 }, // Ĕ
+    { 13, 24, 15, 1, 23, 78, 19072 }, // ĕ
+    { 17, 28, 18, 1, 28, 119, 19150 }, // Ė
+    { 13, 23, 15, 1, 22, 75, 19269 }, // ė
+    { 17, 28, 18, 1, 21, 119, 19344 }, // Ę
+    { 13, 23, 15, 1, 16, 75, 19463 }, // ę
+    { 17, 28, 18, 1, 28, 119, 19538 }, // Ě
+    { 13, 25, 15, 1, 24, 82, 19657 }, // ě
+    { 19, 29, 21, 1, 28, 138, 19739 }, // Ĝ
+    { 17, 31, 17, 0, 24, 132, 19877 }, // ĝ
+    { 19, 29, 21, 1, 28, 138, 20009 }, // Ğ
+    { 17, 30, 17, 0, 23, 128, 20147 }, // ğ
+    { 19, 29, 21, 1, 28, 138, 20275 }, // Ġ
+    { 17, 29, 17, 0, 22, 124, 20480 }, // ġ
+    { 19, 29, 21, 1, 21, 138, 20604 }, // Ģ
+    { 17, 32, 17, 0, 25, 136, 20742 }, // ģ
+    { 23, 28, 24, 1, 28, 161, 20878 }, // Ĥ
+    { 20, 30, 19, -1, 30, 150, 21039 }, // ĥ
+    { 24, 21, 24, 0, 21, 126, 21189 }, // Ħ
+    { 19, 23, 19, 0, 23, 110, 21315 }, // ħ
+    { 11, 28, 11, 0, 28, 77, 21425 }, // Ĩ
+    { 10, 23, 10, 0, 23, 58, 21502 }, // ĩ
+    { 11, 26, 11, 0, 26, 72, 21560 }, // Ī
+    { 10, 21, 10, 0, 21, 53, 21632 }, // ī
+    { 11, 28, 11, 0, 28, 77, 21685 }, // Ĭ
+    { 10, 23, 10, 0, 23, 58, 21762 }, // ĭ
+    { 9, 28, 11, 1, 21, 63, 21820 }, // Į
+    { 10, 30, 10, 0, 23, 75, 21883 }, // į
+    { 9, 28, 11, 1, 28, 63, 21958 }, // İ
+    { 10, 16, 10, 0, 16, 40, 22021 }, // ı
+    { 20, 27, 21, 1, 21, 135, 22061 }, // Ĳ
+    { 16, 30, 18, 0, 23, 120, 22196 }, // ĳ
+    { 13, 34, 11, -2, 28, 111, 22316 }, // Ĵ
+    { 11, 31, 8, -2, 24, 86, 22427 }, // ĵ
+    { 21, 29, 21, 1, 21, 153, 22528 }, // Ķ
+    { 18, 31, 18, 0, 23, 140, 22681 }, // ķ
+    { 18, 17, 18, 0, 16, 77, 22821 }, // ĸ
+    { 17, 28, 17, 1, 28, 119, 22898 }, // Ĺ
+    { 9, 30, 9, 0, 30, 68, 23017 }, // ĺ
+    { 17, 29, 17, 1, 21, 124, 23085 }, // Ļ
+    { 9, 31, 9, 0, 23, 70, 23209 }, // ļ
+    { 17, 23, 17, 1, 23, 98, 23279 }, // Ľ
+    { 12, 23, 10, 0, 23, 69, 23377 }, // ľ
+    { 17, 21, 17, 1, 21, 90, 23446 }, // Ŀ
+    { 14, 23, 14, 0, 23, 81, 23536 }, // ŀ
+    { 19, 21, 17, -1, 21, 100, 23617 }, // Ł
+    { 11, 23, 9, -1, 23, 64, 23717 }, // ł
+    { 22, 29, 24, 1, 28, 160, 23781 }, // Ń
+    { 19, 24, 19, 0, 24, 114, 23941 }, // ń
+    { 22, 29, 24, 1, 21, 160, 24055 }, // Ņ
+    { 19, 24, 19, 0, 16, 114, 24215 }, // ņ
+    { 22, 29, 24, 1, 28, 160, 24329 }, // Ň
+    { 19, 24, 19, 0, 24, 114, 24576 }, // ň
+    { 26, 22, 26, 0, 22, 143, 24690 }, // ŉ
+    { 22, 27, 24, 1, 21, 149, 24833 }, // Ŋ
+    { 17, 23, 19, 0, 16, 98, 24982 }, // ŋ
+    { 21, 27, 23, 1, 26, 142, 25080 }, // Ō
+    { 16, 22, 17, 1, 21, 88, 25222 }, // ō
+    { 21, 29, 23, 1, 28, 153, 25310 }, // Ŏ
+    { 16, 24, 17, 1, 23, 96, 25463 }, // ŏ
+    { 21, 30, 23, 1, 29, 158, 25559 }, // Ő
+    { 16, 25, 17, 1, 24, 100, 25717 }, // ő
+    { 26, 22, 28, 1, 21, 143, 25817 }, // Œ
+    { 25, 17, 26, 1, 16, 107, 25960 }, // œ
+    { 20, 29, 20, 1, 28, 145, 26067 }, // Ŕ
+    { 13, 24, 13, 0, 24, 78, 26212 }, // ŕ
+    { 20, 29, 20, 1, 21, 145, 26290 }, // Ŗ
+    { 13, 24, 13, 0, 16, 78, 26435 }, // ŗ
+    { 20, 29, 20, 1, 28, 145, 26624 }, // Ř
+    { 13, 24, 13, 0, 24, 78, 26769 }, // ř
+    { 14, 29, 16, 1, 28, 102, 26847 }, // Ś
+    { 12, 25, 14, 1, 24, 75, 26949 }, // ś
+    { 14, 29, 16, 1, 28, 102, 27024 }, // Ŝ
+    { 12, 25, 14, 1, 24, 75, 27126 }, // ŝ
+    { 14, 29, 16, 1, 21, 102, 27201 }, // Ş
+    { 12, 24, 14, 1, 16, 72, 27303 }, // ş
+    { 14, 29, 16, 1, 28, 102, 27375 }, // Š
+    { 12, 25, 14, 1, 24, 75, 27477 }, // š
+    { 18, 29, 20, 1, 21, 131, 27552 }, // Ţ
+    { 12, 27, 12, 0, 19, 81, 27683 }, // ţ
+    { 18, 28, 20, 1, 28, 126, 27764 }, // Ť
+    { 12, 25, 12, 0, 24, 75, 27890 }, // ť
+    { 18, 21, 20, 1, 21, 95, 27965 }, // Ŧ
+    { 12, 20, 12, 0, 19, 60, 28060 }, // ŧ
+    { 22, 29, 22, 0, 28, 160, 28120 }, // Ũ
+    { 19, 24, 19, 0, 23, 114, 28280 }, // ũ
+    { 22, 27, 22, 0, 26, 149, 28394 }, // Ū
+    { 19, 22, 19, 0, 21, 105, 28543 }, // ū
+    { 22, 29, 22, 0, 28, 160, 28672 }, // Ŭ
+    { 19, 24, 19, 0, 23, 114, 28832 }, // ŭ
+    { 22, 30, 22, 0, 29, 165, 28946 }, // Ů
+    { 19, 25, 19, 0, 24, 119, 29111 }, // ů
+    { 22, 30, 22, 0, 29, 165, 29230 }, // Ű
+    { 19, 25, 19, 0, 24, 119, 29395 }, // ű
+    { 22, 28, 22, 0, 21, 154, 29514 }, // Ų
+    { 19, 23, 19, 0, 16, 110, 29668 }, // ų
+    { 32, 29, 32, 0, 28, 232, 29778 }, // Ŵ
+    { 26, 25, 26, 0, 24, 163, 30010 }, // ŵ
+    { 20, 28, 20, 0, 28, 140, 30173 }, // Ŷ
+    { 18, 31, 17, 0, 24, 140, 30313 }, // ŷ
+    { 20, 27, 20, 0, 27, 135, 30453 }, // Ÿ
+    { 16, 29, 17, 1, 28, 116, 30588 }, // Ź
+    { 14, 25, 15, 0, 24, 88, 30720 }, // ź
+    { 16, 29, 17, 1, 28, 116, 30808 }, // Ż
+    { 14, 23, 15, 0, 22, 81, 30924 }, // ż
+    { 16, 29, 17, 1, 28, 116, 31005 }, // Ž
+    { 14, 25, 15, 0, 24, 88, 31121 }, // ž
+    { 14, 23, 12, 0, 23, 81, 31209 }, // ſ
+    { 7, 7, 0, -5, 24, 13, 31290 }, // ̀
+    { 6, 7, 0, -2, 24, 11, 31303 }, // ́
+    { 10, 7, 0, -5, 24, 18, 31314 }, // ̂
+    { 10, 6, 0, -5, 23, 15, 31332 }, // ̃
+    { 10, 3, 0, -5, 21, 8, 31347 }, // ̄
+    { 10, 6, 0, -5, 23, 15, 31355 }, // ̆
+    { 4, 4, 0, -2, 22, 4, 31370 }, // ̇
+    { 10, 4, 0, -5, 22, 10, 31374 }, // ̈
+    { 8, 9, 0, -4, 26, 18, 31384 }, // ̉
+    { 8, 8, 0, -4, 24, 16, 31402 }, // ̊
+    { 11, 7, 0, -4, 24, 20, 31418 }, // ̋
+    { 10, 7, 0, -5, 24, 18, 31438 }, // ̌
+    { 11, 7, 0, -7, 24, 20, 31456 }, // ̏
+    { 10, 6, 0, -5, 23, 15, 31476 }, // ̑
+    { 6, 9, 0, -3, 25, 14, 31491 }, // ̒
+    { 5, 9, 0, -2, 26, 12, 31505 }, // ̓
+    { 5, 9, 0, -3, 26, 12, 31517 }, // ̔
+    { 4, 8, 0, -2, 25, 8, 31529 }, // ̕
+    { 5, 7, 0, -2, 19, 9, 31537 }, // ̛
+    { 4, 5, 0, -2, -2, 5, 31546 }, // ̣
+    { 10, 5, 0, -5, -2, 13, 31551 }, // ̤
+    { 8, 7, 0, -4, -1, 14, 31564 }, // ̥
+    { 5, 7, 0, -3, -1, 9, 31578 }, // ̦
+    { 6, 7, 0, -3, -1, 11, 31587 }, // ̧
+    { 7, 8, 0, -3, 1, 14, 31598 }, // ̨
+    { 4, 7, 8, 2, -1, 7, 31612 }, // ̩
+    { 10, 6, 0, -5, -2, 15, 31619 }, // ̭
+    { 10, 6, 0, -5, -1, 15, 31634 }, // ̮
+    { 10, 5, 0, -5, -2, 13, 31649 }, // ̰
+    { 10, 3, 0, -5, -3, 8, 31662 }, // ̱
+    { 10, 6, 0, -5, 23, 15, 31670 }, // ͂
+    { 12, 11, 0, -6, 29, 33, 31685 }, // ̈́
+    { 6, 5, 0, -2, -2, 8, 31718 }, // ͅ
+    { 17, 28, 18, 1, 28, 119, 31726 }, // Ѐ
+    { 17, 27, 18, 1, 27, 115, 31845 }, // Ё
+    { 22, 27, 23, 1, 21, 149, 31960 }, // Ђ
+    { 15, 28, 17, 1, 28, 105, 32109 }, // Ѓ
+    { 18, 22, 19, 1, 21, 99, 32214 }, // Є
+    { 14, 22, 16, 1, 21, 77, 32313 }, // Ѕ
+    { 9, 21, 11, 1, 21, 48, 32390 }, // І
+    { 11, 27, 11, 0, 27, 75, 32438 }, // Ї
+    { 12, 27, 11, -2, 21, 81, 32513 }, // Ј
+    { 28, 22, 28, 0, 21, 154, 32594 }, // Љ
+    { 28, 22, 30, 1, 21, 154, 32768 }, // Њ
+    { 24, 21, 25, 1, 21, 126, 32922 }, // Ћ
+    { 20, 29, 21, 1, 28, 145, 33048 }, // Ќ
+    { 22, 28, 24, 1, 28, 154, 33193 }, // Ѝ
+    { 21, 29, 21, 0, 28, 153, 33347 }, // Ў
+    { 21, 28, 23, 1, 21, 147, 33500 }, // Џ
+    { 22, 21, 22, 0, 21, 116, 33647 }, // А
+    { 17, 22, 18, 1, 21, 94, 33763 }, // Б
+    { 16, 22, 18, 1, 21, 88, 33857 }, // В
+    { 15, 21, 17, 1, 21, 79, 33945 }, // Г
+    { 21, 27, 22, 0, 21, 142, 34024 }, // Д
+    { 17, 21, 18, 1, 21, 90, 34166 }, // Е
+    { 29, 22, 29, 0, 21, 160, 34256 }, // Ж
+    { 15, 22, 17, 1, 21, 83, 34416 }, // З
+    { 22, 21, 24, 1, 21, 116, 34499 }, // И
+    { 22, 28, 24, 1, 28, 154, 34615 }, // Й
+    { 20, 22, 21, 1, 21, 110, 34816 }, // К
+    { 21, 22, 22, 0, 21, 116, 34926 }, // Л
+    { 26, 21, 26, 0, 21, 137, 35042 }, // М
+    { 23, 21, 24, 1, 21, 121, 35179 }, // Н
+    { 21, 22, 23, 1, 21, 116, 35300 }, // О
+    { 22, 21, 23, 1, 21, 116, 35416 }, // П
+    { 16, 21, 17, 1, 21, 84, 35532 }, // Р
+    { 17, 22, 19, 1, 21, 94, 35616 }, // С
+    { 18, 21, 20, 1, 21, 95, 35710 }, // Т
+    { 21, 22, 21, 0, 21, 116, 35805 }, // У
+    { 21, 22, 23, 1, 21, 116, 35921 }, // Ф
+    { 21, 21, 21, 0, 21, 111, 36037 }, // Х
+    { 22, 27, 23, 1, 21, 149, 36148 }, // Ц
+    { 20, 21, 21, 0, 21, 105, 36297 }, // Ч
+    { 29, 21, 31, 1, 21, 153, 36402 }, // Ш
+    { 30, 27, 31, 1, 21, 203, 36555 }, // Щ
+    { 21, 22, 22, 1, 21, 116, 36864 }, // Ъ
+    { 26, 22, 27, 1, 21, 143, 36980 }, // Ы
+    { 17, 22, 18, 1, 21, 94, 37123 }, // Ь
+    { 18, 22, 19, 1, 21, 99, 37217 }, // Э
+    { 29, 22, 31, 1, 21, 160, 37316 }, // Ю
+    { 20, 22, 19, -1, 21, 110, 37476 }, // Я
+    { 15, 17, 16, 1, 16, 64, 37586 }, // а
+    { 15, 24, 17, 1, 23, 90, 37650 }, // б
+    { 14, 16, 16, 1, 15, 56, 37740 }, // в
+    { 13, 15, 14, 1, 15, 49, 37796 }, // г
+    { 18, 21, 19, 0, 15, 95, 37845 }, // д
+    { 13, 17, 15, 1, 16, 56, 37940 }, // е
+    { 24, 17, 23, 0, 16, 102, 37996 }, // ж
+    { 13, 17, 14, 0, 16, 56, 38098 }, // з
+    { 18, 15, 20, 1, 15, 68, 38154 }, // и
+    { 18, 22, 20, 1, 22, 99, 38222 }, // й
+    { 16, 17, 17, 1, 16, 68, 38321 }, // к
+    { 17, 16, 18, 0, 15, 68, 38389 }, // л
+    { 21, 15, 22, 1, 15, 79, 38457 }, // м
+    { 19, 15, 20, 1, 15, 72, 38536 }, // н
+    { 16, 17, 17, 1, 16, 68, 38608 }, // о
+    { 18, 15, 20, 1, 15, 68, 38676 }, // п
+    { 17, 23, 18, 0, 16, 98, 38744 }, // р
+    { 13, 17, 15, 1, 16, 56, 38842 }, // с
+    { 15, 15, 16, 1, 15, 57, 38912 }, // т
+    { 18, 22, 17, 0, 15, 99, 38969 }, // у
+    { 20, 30, 21, 1, 23, 150, 39068 }, // ф
+    { 17, 15, 17, 0, 15, 64, 39218 }, // х
+    { 19, 21, 20, 1, 15, 100, 39282 }, // ц
+    { 17, 15, 18, 0, 15, 64, 39382 }, // ч
+    { 24, 15, 26, 1, 15, 90, 39446 }, // ш
+    { 25, 21, 26, 1, 15, 132, 39536 }, // щ
+    { 17, 16, 19, 1, 15, 68, 39668 }, // ъ
+    { 22, 16, 24, 1, 15, 88, 39736 }, // ы
+    { 14, 16, 16, 1, 15, 56, 39824 }, // ь
+    { 13, 17, 15, 1, 16, 56, 39880 }, // э
+    { 23, 17, 24, 1, 16, 98, 39936 }, // ю
+    { 16, 16, 17, 0, 15, 64, 40034 }, // я
+    { 13, 25, 15, 1, 24, 82, 40098 }, // ѐ
+    { 13, 23, 15, 1, 22, 75, 40180 }, // ё
+    { 17, 30, 18, 0, 23, 128, 40255 }, // ђ
+    { 13, 24, 14, 1, 24, 78, 40383 }, // ѓ
+    { 13, 17, 15, 1, 16, 56, 40461 }, // є
+    { 12, 17, 14, 1, 16, 51, 40517 }, // ѕ
+    { 10, 23, 10, 0, 23, 58, 40568 }, // і
+    { 11, 22, 10, -1, 22, 61, 40626 }, // ї
+    { 9, 30, 8, -2, 23, 68, 40687 }, // ј
+    { 23, 16, 23, 0, 15, 92, 40755 }, // љ
+    { 23, 16, 25, 1, 15, 92, 40847 }, // њ
+    { 19, 23, 19, 0, 23, 110, 40960 }, // ћ
+    { 16, 25, 17, 1, 24, 100, 41070 }, // ќ
+    { 18, 24, 20, 1, 24, 108, 41170 }, // ѝ
+    { 18, 29, 17, 0, 22, 131, 41278 }, // ў
+    { 18, 21, 20, 1, 15, 95, 41409 }, // џ
+    { 21, 24, 21, 0, 23, 126, 41504 }, // Ѣ
+    { 16, 22, 18, 1, 21, 88, 41630 }, // ѣ
+    { 21, 22, 23, 1, 21, 116, 41718 }, // Ѳ
+    { 16, 17, 17, 1, 16, 68, 41834 }, // ѳ
+    { 22, 22, 22, 0, 21, 121, 41902 }, // Ѵ
+    { 18, 17, 18, 0, 16, 77, 42023 }, // ѵ
+    { 23, 34, 24, 1, 28, 196, 42100 }, // Ҋ
+    { 19, 28, 20, 1, 22, 133, 42296 }, // ҋ
+    { 18, 22, 18, 0, 21, 99, 42429 }, // Ҍ
+    { 15, 22, 15, 0, 21, 83, 42528 }, // ҍ
+    { 16, 21, 17, 1, 21, 84, 42611 }, // Ҏ
+    { 17, 23, 18, 0, 16, 98, 42695 }, // ҏ
+    { 15, 24, 16, 1, 24, 90, 42793 }, // Ґ
+    { 13, 19, 14, 1, 19, 62, 42883 }, // ґ
+    { 16, 21, 17, 0, 21, 84, 43008 }, // Ғ
+    { 13, 15, 14, 1, 15, 49, 43092 }, // ғ
+    { 18, 27, 19, 1, 21, 122, 43141 }, // Ҕ
+    { 16, 22, 18, 1, 15, 88, 43263 }, // ҕ
+    { 29, 27, 29, 0, 21, 196, 43351 }, // Җ
+    { 24, 22, 23, 0, 16, 132, 43547 }, // җ
+    { 15, 27, 17, 1, 21, 102, 43679 }, // Ҙ
+    { 13, 22, 14, 0, 16, 72, 43781 }, // ҙ
+    { 20, 27, 21, 1, 21, 135, 43853 }, // Қ
+    { 16, 22, 17, 1, 16, 88, 43988 }, // қ
+    { 21, 22, 22, 1, 21, 116, 44076 }, // Ҝ
+    { 17, 17, 18, 1, 16, 73, 44192 }, // ҝ
+    { 20, 22, 21, 1, 21, 110, 44265 }, // Ҟ
+    { 16, 22, 16, 0, 21, 88, 44375 }, // ҟ
+    { 23, 22, 24, 1, 21, 127, 44463 }, // Ҡ
+    { 18, 17, 19, 1, 16, 77, 44590 }, // ҡ
+    { 23, 27, 24, 1, 21, 156, 44667 }, // Ң
+    { 19, 21, 20, 1, 15, 100, 44823 }, // ң
+    { 27, 21, 28, 1, 21, 142, 45056 }, // Ҥ
+    { 21, 15, 23, 1, 15, 79, 45198 }, // ҥ
+    { 29, 27, 30, 1, 21, 196, 45277 }, // Ҧ
+    { 26, 22, 28, 1, 15, 143, 45473 }, // ҧ
+    { 23, 22, 24, 1, 21, 127, 45616 }, // Ҩ
+    { 18, 17, 19, 1, 16, 77, 45743 }, // ҩ
+    { 17, 27, 19, 1, 21, 115, 45820 }, // Ҫ
+    { 13, 22, 15, 1, 16, 72, 45935 }, // ҫ
+    { 18, 27, 20, 1, 21, 122, 46007 }, // Ҭ
+    { 15, 21, 16, 1, 15, 79, 46129 }, // ҭ
+    { 20, 21, 20, 0, 21, 105, 46208 }, // Ү
+    { 18, 22, 17, 0, 15, 99, 46313 }, // ү
+    { 20, 21, 20, 0, 21, 105, 46412 }, // Ұ
+    { 18, 22, 17, 0, 15, 99, 46517 }, // ұ
+    { 21, 27, 21, 0, 21, 142, 46616 }, // Ҳ
+    { 17, 21, 17, 0, 15, 90, 46758 }, // ҳ
+    { 25, 27, 26, 1, 21, 169, 46848 }, // Ҵ
+    { 23, 21, 23, 0, 15, 121, 47104 }, // ҵ
+    { 20, 27, 21, 0, 21, 135, 47225 }, // Ҷ
+    { 18, 21, 18, 0, 15, 95, 47360 }, // ҷ
+    { 20, 21, 21, 0, 21, 105, 47455 }, // Ҹ
+    { 17, 15, 18, 0, 15, 64, 47560 }, // ҹ
+    { 20, 21, 21, 1, 21, 105, 47624 }, // Һ
+    { 19, 23, 19, 0, 23, 110, 47729 }, // һ
+    { 23, 22, 24, 0, 21, 127, 47839 }, // Ҽ
+    { 18, 17, 18, 0, 16, 77, 47966 }, // ҽ
+    { 23, 27, 24, 0, 21, 156, 48043 }, // Ҿ
+    { 18, 22, 18, 0, 16, 99, 48199 }, // ҿ
+    { 9, 21, 11, 1, 21, 48, 48298 }, // Ӏ
+    { 29, 29, 29, 0, 28, 211, 48346 }, // Ӂ
+    { 24, 23, 23, 0, 22, 138, 48557 }, // ӂ
+    { 19, 27, 20, 1, 21, 129, 48695 }, // Ӄ
+    { 15, 23, 17, 1, 16, 87, 48824 }, // ӄ
+    { 21, 27, 22, 0, 21, 142, 48911 }, // Ӆ
+    { 18, 21, 18, 0, 15, 95, 49053 }, // ӆ
+    { 23, 27, 24, 1, 21, 156, 49152 }, // Ӈ
+    { 19, 22, 20, 1, 15, 105, 49308 }, // ӈ
+    { 23, 27, 24, 1, 21, 156, 49413 }, // Ӊ
+    { 19, 21, 20, 1, 15, 100, 49569 }, // ӊ
+    { 20, 27, 21, 0, 21, 135, 49669 }, // Ӌ
+    { 17, 21, 18, 0, 15, 90, 49804 }, // ӌ
+    { 26, 27, 26, 0, 21, 176, 49894 }, // Ӎ
+    { 21, 21, 22, 1, 15, 111, 50070 }, // ӎ
+    { 9, 23, 9, 0, 23, 52, 50181 }, // ӏ
+    { 22, 28, 22, 0, 28, 154, 50233 }, // Ӑ
+    { 15, 23, 16, 1, 22, 87, 50387 }, // ӑ
+    { 22, 27, 22, 0, 27, 149, 50474 }, // Ӓ
+    { 15, 23, 16, 1, 22, 87, 50623 }, // ӓ
+    { 27, 21, 27, -1, 21, 142, 50710 }, // Ӕ
+    { 22, 17, 24, 1, 16, 94, 50852 }, // ӕ
+    { 17, 28, 18, 1, 28, 119, 50946 }, // Ӗ
+    { 13, 23, 15, 1, 22, 75, 51065 }, // ӗ
+    { 18, 22, 20, 1, 21, 99, 51200 }, // Ә
+    { 13, 17, 15, 1, 16, 56, 51299 }, // ә
+    { 18, 28, 20, 1, 27, 126, 51355 }, // Ӛ
+    { 13, 23, 15, 1, 22, 75, 51481 }, // ӛ
+    { 29, 28, 29, 0, 27, 203, 51556 }, // Ӝ
+    { 24, 23, 23, 0, 22, 138, 51759 }, // ӝ
+    { 15, 28, 17, 1, 27, 105, 51897 }, // Ӟ
+    { 13, 23, 14, 0, 22, 75, 52002 }, // ӟ
+    { 16, 22, 17, 0, 21, 88, 52077 }, // Ӡ
+    { 14, 22, 15, 0, 15, 77, 52165 }, // ӡ
+    { 22, 26, 24, 1, 26, 143, 52242 }, // Ӣ
+    { 18, 21, 20, 1, 21, 95, 52385 }, // ӣ
+    { 22, 27, 24, 1, 27, 149, 52480 }, // Ӥ
+    { 18, 22, 20, 1, 22, 99, 52629 }, // ӥ
+    { 21, 28, 23, 1, 27, 147, 52728 }, // Ӧ
+    { 16, 23, 17, 1, 22, 92, 52875 }, // ӧ
+    { 21, 22, 23, 1, 21, 116, 52967 }, // Ө
+    { 16, 17, 17, 1, 16, 68, 53083 }, // ө
+    { 21, 28, 24, 1, 27, 147, 53248 }, // Ӫ
+    { 16, 23, 17, 1, 22, 92, 53395 }, // ӫ
+    { 18, 28, 19, 1, 27, 126, 53487 }, // Ӭ
+    { 13, 23, 15, 1, 22, 75, 53613 }, // ӭ
+    { 21, 27, 21, 0, 26, 142, 53688 }, // Ӯ
+    { 18, 28, 17, 0, 21, 126, 53830 }, // ӯ
+    { 21, 28, 21, 0, 27, 147, 53956 }, // Ӱ
+    { 18, 29, 17, 0, 22, 131, 54103 }, // ӱ
+    { 21, 30, 21, 0, 29, 158, 54234 }, // Ӳ
+    { 18, 31, 17, 0, 24, 140, 54392 }, // ӳ
+    { 20, 27, 21, 0, 27, 135, 54532 }, // Ӵ
+    { 17, 22, 18, 0, 22, 94, 54667 }, // ӵ
+    { 15, 27, 17, 1, 21, 102, 54761 }, // Ӷ
+    { 13, 21, 14, 1, 15, 69, 54863 }, // ӷ
+    { 26, 28, 28, 1, 27, 182, 54932 }, // Ӹ
+    { 22, 23, 24, 1, 22, 127, 55114 }, // ӹ
+    { 16, 27, 17, 0, 21, 108, 55296 }, // Ӻ
+    { 13, 21, 14, 1, 15, 69, 55404 }, // ӻ
+    { 21, 27, 20, 0, 21, 142, 55473 }, // Ӽ
+    { 17, 22, 17, 0, 15, 94, 55615 }, // ӽ
+    { 21, 21, 21, 0, 21, 111, 55709 }, // Ӿ
+    { 17, 15, 17, 0, 15, 64, 55820 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 55884 }, //  
+    { 0, 0, 29, 0, 0, 0, 55884 }, //  
+    { 0, 0, 15, 0, 0, 0, 55884 }, //  
+    { 0, 0, 29, 0, 0, 0, 55884 }, //  
+    { 0, 0, 10, 0, 0, 0, 55884 }, //  
+    { 0, 0, 7, 0, 0, 0, 55884 }, //  
+    { 0, 0, 5, 0, 0, 0, 55884 }, //  
+    { 0, 0, 18, 0, 0, 0, 55884 }, //  
+    { 0, 0, 8, 0, 0, 0, 55884 }, //  
+    { 0, 0, 6, 0, 0, 0, 55884 }, //  
+    { 0, 0, 1, 0, 0, 0, 55884 }, //  
+    { 0, 0, 0, 0, 0, 0, 55884 }, // ​
+    { 2, 24, 0, -1, 17, 12, 55884 }, // ‌
+    { 6, 26, 0, -3, 19, 39, 55896 }, // ‍
+    { 10, 28, 0, -5, 21, 70, 55935 }, // ‎
+    { 10, 28, 0, -5, 21, 70, 56005 }, // ‏
+    { 9, 3, 11, 1, 9, 7, 56075 }, // ‐
+    { 9, 3, 11, 1, 9, 7, 56082 }, // ‑
+    { 14, 3, 18, 2, 11, 11, 56089 }, // ‒
+    { 15, 3, 15, 0, 9, 12, 56100 }, // –
+    { 29, 3, 29, 0, 9, 22, 56112 }, // —
+    { 29, 3, 29, 0, 9, 22, 56134 }, // ―
+    { 10, 30, 15, 2, 23, 75, 56156 }, // ‖
+    { 15, 7, 15, 0, -1, 27, 56231 }, // ‗
+    { 5, 10, 7, 1, 22, 13, 56258 }, // ‘
+    { 6, 10, 7, 0, 22, 15, 56271 }, // ’
+    { 6, 10, 7, 0, 4, 15, 56286 }, // ‚
+    { 5, 10, 7, 1, 22, 13, 56301 }, // ‛
+    { 11, 10, 13, 1, 22, 28, 56314 }, // “
+    { 12, 10, 13, 0, 22, 30, 56342 }, // ”
+    { 12, 10, 13, 0, 4, 30, 56372 }, // „
+    { 11, 10, 13, 1, 22, 28, 56402 }, // ‟
+    { 14, 19, 15, 0, 21, 67, 56430 }, // †
+    { 14, 23, 15, 0, 21, 81, 56497 }, // ‡
+    { 7, 7, 9, 1, 11, 13, 56578 }, // •
+    { 10, 10, 18, 4, 15, 25, 56591 }, // ‣
+    { 6, 5, 8, 1, 4, 8, 56616 }, // ․
+    { 12, 5, 15, 1, 4, 15, 56624 }, // ‥
+    { 25, 5, 29, 2, 4, 32, 56639 }, // …
+    { 6, 4, 8, 1, 10, 6, 56671 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 56677 }, //  
+    { 0, 0, 0, 0, 0, 0, 56677 }, //  
+    { 10, 28, 0, -5, 21, 70, 56677 }, // ‪
+    { 10, 28, 0, -5, 21, 70, 56747 }, // ‫
+    { 10, 27, 0, -5, 20, 68, 56817 }, // ‬
+    { 12, 28, 0, -6, 21, 84, 56885 }, // ‭
+    { 12, 28, 0, -6, 21, 84, 56969 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 57053 }, //  
+    { 38, 24, 40, 1, 22, 228, 57053 }, // ‰
+    { 6, 10, 8, 1, 21, 15, 57281 }, // ′
+    { 12, 10, 13, 1, 21, 30, 57296 }, // ″
+    { 17, 10, 19, 1, 21, 43, 57344 }, // ‴
+    { 6, 10, 8, 1, 21, 15, 57387 }, // ‵
+    { 12, 10, 14, 1, 21, 30, 57402 }, // ‶
+    { 19, 10, 20, 1, 21, 48, 57432 }, // ‷
+    { 13, 6, 14, 1, 0, 20, 57480 }, // ‸
+    { 7, 11, 9, 1, 13, 20, 57500 }, // ‹
+    { 8, 11, 9, 1, 13, 22, 57520 }, // ›
+    { 18, 20, 18, 0, 19, 90, 57542 }, // ※
+    { 13, 23, 16, 2, 22, 75, 57632 }, // ‼
+    { 15, 3, 15, 0, 24, 12, 57707 }, // ‾
+    { 7, 3, 9, 1, 9, 6, 57719 }, // ⁃
+    { 15, 24, 5, -5, 22, 90, 57725 }, // ⁄
+    { 23, 23, 26, 2, 22, 133, 57815 }, // ⁇
+    { 19, 23, 22, 2, 22, 110, 57948 }, // ⁈
+    { 19, 23, 22, 2, 22, 110, 58058 }, // ⁉
+    { 17, 5, 29, 6, 11, 22, 58168 }, // ⁓
+    { 23, 10, 25, 1, 21, 58, 58190 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 58248 }, //  
+    { 0, 0, 0, 0, 0, 0, 58248 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 58248 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 58248 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 58248 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 58248 }, // ⁤
+    { 11, 14, 13, 1, 24, 39, 58248 }, // ⁰
+    { 11, 14, 13, 1, 24, 39, 58287 }, // ⁴
+    { 10, 14, 13, 1, 24, 35, 58326 }, // ⁵
+    { 11, 14, 13, 1, 24, 39, 58361 }, // ⁶
+    { 10, 14, 13, 2, 24, 35, 58400 }, // ⁷
+    { 11, 14, 13, 1, 24, 39, 58435 }, // ⁸
+    { 11, 14, 13, 1, 24, 39, 58474 }, // ⁹
+    { 13, 11, 16, 2, 21, 36, 58513 }, // ⁿ
+    { 11, 15, 13, 1, 10, 42, 58549 }, // ₀
+    { 9, 14, 13, 2, 10, 32, 58591 }, // ₁
+    { 11, 14, 13, 1, 10, 39, 58623 }, // ₂
+    { 9, 15, 13, 2, 10, 34, 58662 }, // ₃
+    { 11, 15, 13, 1, 10, 42, 58696 }, // ₄
+    { 10, 14, 13, 1, 9, 35, 58738 }, // ₅
+    { 11, 15, 13, 1, 10, 42, 58773 }, // ₆
+    { 10, 14, 13, 2, 9, 35, 58815 }, // ₇
+    { 11, 15, 13, 1, 10, 42, 58850 }, // ₈
+    { 11, 15, 13, 1, 10, 42, 58892 }, // ₉
+    { 15, 20, 18, 1, 20, 75, 58934 }, // ₣
+    { 16, 22, 18, 1, 21, 88, 59009 }, // ₤
+    { 36, 22, 36, 0, 21, 198, 59097 }, // ₧
+    { 18, 22, 18, 0, 21, 99, 59392 }, // €
+    { 17, 12, 29, 6, 16, 51, 59491 }, // ←
+    { 13, 20, 29, 8, 20, 65, 59542 }, // ↑
+    { 17, 12, 29, 6, 16, 51, 59607 }, // →
+    { 13, 20, 29, 8, 20, 65, 59658 }, // ↓
+    { 18, 12, 29, 5, 16, 54, 59723 }, // ↔
+    { 13, 20, 29, 8, 20, 65, 59777 }, // ↕
+    { 13, 20, 29, 8, 20, 65, 59842 }, // ↨
+    { 13, 20, 29, 8, 20, 65, 59907 }, // ↲
+    { 13, 20, 29, 8, 20, 65, 59972 }, // ↳
+    { 17, 14, 29, 6, 17, 60, 60037 }, // ↵
+    { 17, 14, 29, 6, 17, 60, 60097 }, // ⇐
+    { 13, 18, 29, 8, 19, 59, 60157 }, // ⇑
+    { 17, 14, 29, 6, 17, 60, 60216 }, // ⇒
+    { 13, 18, 29, 8, 19, 59, 60276 }, // ⇓
+    { 19, 14, 29, 5, 17, 67, 60335 }, // ⇔
+    { 19, 22, 29, 5, 21, 105, 60402 }, // ∀
+    { 14, 24, 18, 2, 23, 84, 60507 }, // ∂
+    { 13, 21, 29, 8, 21, 69, 60591 }, // ∃
+    { 23, 24, 29, 3, 22, 138, 60660 }, // ∅
+    { 19, 21, 19, 0, 21, 100, 60798 }, // ∆
+    { 19, 22, 29, 5, 21, 105, 60898 }, // ∇
+    { 19, 21, 29, 5, 21, 100, 61003 }, // ∈
+    { 19, 26, 29, 5, 23, 124, 61103 }, // ∉
+    { 19, 16, 29, 5, 18, 76, 61227 }, // ∊
+    { 19, 21, 29, 5, 21, 100, 61303 }, // ∋
+    { 19, 26, 29, 5, 23, 124, 61440 }, // ∌
+    { 19, 16, 29, 5, 18, 76, 61564 }, // ∍
+    { 22, 26, 23, 1, 21, 143, 61640 }, // ∏
+    { 18, 26, 18, 0, 21, 117, 61783 }, // ∑
+    { 13, 3, 18, 3, 11, 10, 61900 }, // −
+    { 13, 23, 14, 1, 21, 75, 61910 }, // ∕
+    { 13, 23, 15, 2, 21, 75, 61985 }, // ∖
+    { 14, 14, 18, 2, 17, 49, 62060 }, // ∗
+    { 10, 10, 18, 4, 15, 25, 62109 }, // ∘
+    { 6, 4, 18, 6, 10, 6, 62134 }, // ∙
+    { 18, 28, 18, 0, 24, 126, 62140 }, // √
+    { 14, 11, 18, 2, 15, 39, 62266 }, // ∝
+    { 18, 10, 18, 0, 14, 45, 62305 }, // ∞
+    { 19, 21, 29, 5, 21, 100, 62350 }, // ∟
+    { 21, 21, 29, 3, 21, 111, 62450 }, // ∠
+    { 4, 30, 15, 5, 23, 30, 62561 }, // ∣
+    { 9, 30, 15, 3, 23, 68, 62591 }, // ∥
+    { 19, 21, 29, 5, 21, 100, 62659 }, // ∧
+    { 19, 21, 29, 5, 21, 100, 62759 }, // ∨
+    { 17, 21, 29, 6, 21, 90, 62859 }, // ∩
+    { 17, 22, 29, 6, 21, 94, 62949 }, // ∪
+    { 16, 30, 18, 1, 23, 120, 63043 }, // ∫
+    { 19, 17, 29, 5, 16, 81, 63163 }, // ∴
+    { 19, 17, 29, 5, 16, 81, 63244 }, // ∵
+    { 5, 16, 9, 2, 18, 20, 63325 }, // ∶
+    { 19, 17, 29, 5, 16, 81, 63345 }, // ∷
+    { 17, 5, 29, 6, 11, 22, 63426 }, // ∼
+    { 17, 15, 29, 6, 17, 64, 63488 }, // ≅
+    { 14, 10, 18, 2, 15, 35, 63552 }, // ≈
+    { 17, 10, 29, 6, 13, 43, 63587 }, // ≍
+    { 13, 13, 18, 3, 16, 43, 63630 }, // ≠
+    { 17, 13, 29, 6, 15, 56, 63673 }, // ≡
+    { 14, 18, 18, 2, 18, 63, 63729 }, // ≤
+    { 14, 18, 18, 2, 18, 63, 63792 }, // ≥
+    { 23, 14, 29, 3, 17, 81, 63855 }, // ≪
+    { 23, 14, 29, 3, 17, 81, 63936 }, // ≫
+    { 19, 16, 29, 5, 18, 76, 64017 }, // ⊃
+    { 19, 26, 29, 5, 23, 124, 64093 }, // ⊄
+    { 19, 26, 29, 5, 23, 124, 64217 }, // ⊅
+    { 19, 21, 29, 5, 21, 100, 64341 }, // ⊆
+    { 19, 21, 29, 5, 21, 100, 64441 }, // ⊇
+    { 21, 22, 29, 4, 21, 116, 64541 }, // ⊕
+    { 21, 22, 29, 4, 21, 116, 64657 }, // ⊖
+    { 21, 22, 29, 4, 21, 116, 64773 }, // ⊗
+    { 21, 22, 29, 4, 21, 116, 64889 }, // ⊘
+    { 17, 21, 29, 6, 21, 90, 65005 }, // ⊥
+    { 6, 5, 18, 6, 10, 8, 65095 }, // ⋅
+    { 25, 5, 29, 2, 10, 32, 65103 }, // ⋯
+    { 27, 28, 29, 1, 24, 189, 65135 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_regularIntervals[] = {
@@ -4809,4 +2982,9 @@ static const EpdFontData bookerly_14_regular = {
     31,
     -8,
     true,
+    bookerly_14_regularBlockOffsets,
+    bookerly_14_regularDirectGlyphs,
+    bookerly_14_regularGlyphPages,
+    256,
+    bookerly_14_regularPageGlyphs,
 };
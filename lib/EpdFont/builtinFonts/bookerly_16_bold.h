@@ -2,5409 +2,2609 @@
  * generated by fontconvert.py
  * name: bookerly_16_bold
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_16_bold 16 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_16_bold 16 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_boldBitmaps[86336] = {
-    0x0A, 0x90, 0xFF, 0x87, 0xFE, 0x2F, 0xF4, 0xBF, 0xC2, 0xFF, 0x0B, 0xFC, 0x2F, 0xF0, 0xBF, 0xC2,
-    0xFF, 0x0B, 0xFC, 0x1F, 0xF0, 0x7F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0xC0, 0xBF, 0x01,
-    0x40, 0x00, 0x00, 0x05, 0x40, 0xFF, 0xC7, 0xFF, 0x1F, 0xFC, 0x3F, 0xF0, 0x19, 0x00, 0x0A, 0x80,
-    0xA9, 0x3F, 0xC3, 0xFD, 0x7F, 0xC3, 0xFC, 0xBF, 0xC7, 0xFC, 0xBF, 0xC3, 0xFC, 0x7F, 0xC3, 0xFC,
-    0x7F, 0x83, 0xFC, 0x7F, 0x83, 0xFC, 0x3F, 0x83, 0xFC, 0x3F, 0x43, 0xF8, 0x39, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x01, 0xAB, 0xFE, 0xAF,
-    0xFA, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xC0, 0x7F,
-    0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x03, 0xF4,
-    0x00, 0x15, 0xFF, 0x56, 0xFD, 0x54, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x41, 0x5B, 0xF5, 0x6F, 0xE5, 0x40, 0x02, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0x40, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x01, 0x50, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xF6, 0xF2, 0xFF, 0x07, 0xF4, 0x7C, 0x2F, 0xC2, 0xFC, 0x2F, 0x03, 0xE0,
-    0xBF, 0x4B, 0xC0, 0xA0, 0x2F, 0xF2, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xF0, 0x24, 0x0F, 0x8B, 0xFC, 0x3E, 0x03, 0xE0, 0xFF, 0x1F, 0xC0, 0xF8, 0x3F, 0xCB, 0xF4,
-    0x3E, 0x0F, 0xF2, 0xFF, 0x0F, 0x4F, 0xF4, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x1F, 0xE6, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x7F,
-    0x40, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF0, 0x07, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x7F, 0x40, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x7F,
-    0x03, 0xF4, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xF0, 0xBF, 0x00, 0x69, 0x00, 0x3F, 0xC0, 0xFE, 0x0F,
-    0xD0, 0xBF, 0xFD, 0x02, 0xFF, 0xFF, 0xC2, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x3F, 0x07,
-    0xF4, 0x7F, 0xC0, 0x1B, 0xE4, 0x0F, 0xE0, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xD0,
-    0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x0F,
-    0xE0, 0x00, 0x00, 0xFD, 0x01, 0xFD, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x1F, 0xD0,
-    0x00, 0x07, 0xF4, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x7F, 0x80, 0x00,
-    0x1F, 0xD0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x1F,
-    0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x7D, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0x02, 0xFF, 0xBF, 0xC0, 0x6F, 0xFA, 0x41, 0xFF, 0x0F, 0xFC, 0x01, 0xFC,
-    0x00, 0xBF, 0x81, 0xFF, 0xC0, 0x7F, 0x00, 0x3F, 0xE0, 0x2F, 0xFC, 0x1F, 0xC0, 0x0F, 0xF8, 0x02,
-    0xFF, 0xDB, 0xF0, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xD0, 0x02, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFD, 0x00, 0x1F, 0xFF, 0xE4, 0x02, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xE4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x01, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0x00, 0x00, 0x55, 0x40, 0x00, 0x55, 0x00,
-    0x0A, 0x83, 0xFC, 0x7F, 0xCB, 0xFC, 0xBF, 0xC7, 0xFC, 0x7F, 0x87, 0xF8, 0x3F, 0x83, 0xF4, 0x39,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xBF, 0xC0,
-    0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x02, 0xFE, 0x00,
-    0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80,
-    0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFE,
-    0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00,
-    0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x01, 0xFF,
-    0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xE0, 0xFE, 0x00, 0xBE, 0x3F, 0x00, 0x3F, 0xEF, 0x40,
-    0x02, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x6F, 0xFD, 0xFC, 0x3F, 0xDF, 0x41, 0x0B, 0xD3, 0xF0,
-    0x00, 0x90, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x0A, 0xAB, 0xFF,
-    0xAA, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0xBF, 0x55, 0x40, 0x02, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x0B, 0xFC, 0x02, 0xFE, 0x00, 0xFF,
-    0x40, 0x3F, 0xC0, 0x2F, 0xD0, 0x0F, 0xE0, 0x0F, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x42, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x06, 0x90, 0xBF, 0xD3,
-    0xFF, 0x8F, 0xFE, 0x3F, 0xF0, 0x19, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFD, 0x02, 0xFF, 0xC0, 0xBF, 0xE0, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x07, 0xFF,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0x3F, 0xF6, 0xFF, 0x40, 0x00, 0xFF, 0xDF, 0xFD,
-    0x00, 0x02, 0xFF, 0x7F, 0xF4, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x3F, 0xF7, 0xFF, 0x40, 0x00,
-    0xFF, 0xDF, 0xFD, 0x00, 0x03, 0xFF, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0x7F, 0xF1,
-    0xFF, 0xC0, 0x02, 0xFF, 0x43, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFF, 0x81, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x6F, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x50, 0x1F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0A, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFB, 0xFF, 0xF0, 0x3F, 0xF8, 0x07, 0xFF, 0x43, 0xFF,
-    0x00, 0x3F, 0xF8, 0x3F, 0xE0, 0x02, 0xFF, 0x82, 0xFD, 0x00, 0x2F, 0xF8, 0x05, 0x40, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x6B, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xEA, 0xFF,
-    0xF0, 0xBF, 0xC0, 0x0F, 0xFC, 0x1F, 0xC0, 0x02, 0xFF, 0x41, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xBF, 0xF0, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x24, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x5F, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x00, 0x2F,
-    0xF3, 0xFF, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x00, 0x02, 0xFE, 0x03,
-    0xFF, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xFA, 0xAB, 0xFF,
-    0xAA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x40, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFD, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x06, 0xAF, 0xFF,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x1B, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x54, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xF0, 0x03, 0xFF, 0xC3, 0xFF,
-    0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x0B, 0xFE, 0x3F, 0xF4, 0x00, 0xBF,
-    0xD2, 0xFF, 0x80, 0x0B, 0xFD, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0xFF, 0xF4, 0x7F, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0x95, 0x57, 0xFF, 0x2F, 0xC0, 0x00, 0xFF, 0x4B, 0xE0, 0x00, 0xFF, 0xC0, 0xF4, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xF5, 0x7F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0xF8, 0x0B, 0xFF, 0x43, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x7F, 0xE1, 0xFF, 0xF4, 0x0F, 0xF8, 0x03, 0xFF, 0xC2, 0xFF, 0x00, 0x0F, 0xFD, 0x3F, 0xF0,
-    0x00, 0xBF, 0xE3, 0xFF, 0x00, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0xFF, 0xD3, 0xFF, 0xD0, 0x2F, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFC, 0x07, 0xFF, 0x82, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xF0, 0x00,
-    0xFF, 0xD3, 0xFF, 0x00, 0x0B, 0xFE, 0x3F, 0xF0, 0x00, 0x7F, 0xE3, 0xFF, 0x40, 0x07, 0xFE, 0x2F,
-    0xFC, 0x00, 0x7F, 0xE0, 0xFF, 0xF4, 0x0B, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x1B, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x42, 0xFF, 0x4F, 0xFE, 0x3F, 0xF8, 0xFF, 0xC0, 0x64, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0xF0, 0x3F, 0xFC, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
-    0x7F, 0xE0, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0B, 0xF0, 0x07,
-    0xF4, 0x03, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFD, 0x00, 0x2F, 0xFF, 0x40, 0x0B,
-    0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0x95, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x7F,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0x90, 0x10, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x1B, 0xFF,
-    0x40, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x0B, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x0E, 0x56, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x1B, 0xF4, 0x01, 0xBF, 0xFC, 0x0B, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
-    0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x06, 0xF9, 0x00, 0x0F, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0xFF, 0x00,
-    0x1F, 0xE0, 0x3F, 0xC0, 0x2F, 0xFB, 0xFD, 0x00, 0x3F, 0xC2, 0xFE, 0x00, 0xFE, 0x07, 0xFC, 0x00,
-    0xFF, 0x0F, 0xF4, 0x03, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x01, 0x40, 0x3F, 0xC0, 0x0F,
-    0xF0, 0xFF, 0x00, 0x00, 0x16, 0xFF, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFF,
-    0x1F, 0xF0, 0x01, 0xFF, 0xAF, 0xF0, 0x03, 0xF8, 0x7F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xD1,
-    0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0x0B, 0xFE, 0x5F, 0xF0, 0x0F,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xE0, 0x0B, 0xFF, 0xCB, 0xFF, 0xF0, 0x00, 0xBF,
-    0xC0, 0x06, 0xF8, 0x06, 0xA8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xFF,
-    0xE4, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xEB, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x01, 0x54, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFF,
-    0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xA5, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xAB, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x41, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFC, 0x00, 0x03,
-    0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x03,
-    0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xFC, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40,
-    0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03,
-    0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xF4, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40,
-    0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x95, 0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC,
-    0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xF9, 0x6A, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xD0, 0x3F, 0xF4, 0x00, 0xFD, 0x03,
-    0xFF, 0x40, 0x0B, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0xEA, 0xBE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFE, 0xAA, 0x90, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x1F, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0xFF,
-    0xD0, 0x00, 0x07, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x14, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0,
-    0x00, 0x02, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x0B,
-    0xFF, 0xFE, 0x5A, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFD,
-    0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0x40, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE2, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0xBF, 0xFF, 0xE0, 0x07, 0xFF, 0xE0,
-    0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0x4F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x6F, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0x41, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xFF, 0x40,
-    0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0xBF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0xBF, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x03, 0xFF,
-    0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0x95,
-    0x6B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xE0, 0x00,
-    0x03, 0xF7, 0xFE, 0x00, 0xFD, 0xFF, 0xC0, 0x00, 0x0F, 0xDB, 0xFC, 0x03, 0xF3, 0xFF, 0x00, 0x00,
-    0x7F, 0x5F, 0xF0, 0x2F, 0xCF, 0xFC, 0x00, 0x01, 0xFC, 0x3F, 0xD0, 0xFE, 0x2F, 0xF0, 0x00, 0x0B,
-    0xF0, 0xFF, 0xC3, 0xF0, 0xBF, 0xC0, 0x00, 0x2F, 0xC1, 0xFF, 0x1F, 0xC2, 0xFF, 0x40, 0x00, 0xFF,
-    0x03, 0xFD, 0xBE, 0x07, 0xFD, 0x00, 0x03, 0xFC, 0x0F, 0xFB, 0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xF0,
-    0x1F, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x3F, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0xFE, 0x00,
-    0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x1F, 0xE0, 0x03,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0xA0, 0x1F,
-    0xC0, 0x1F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFF, 0xD2, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0xFF, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xBF, 0xF8, 0x02, 0xFE,
-    0x00, 0x03, 0xFC, 0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x0F, 0xF0, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x3F,
-    0xC2, 0xFF, 0xE0, 0xBF, 0x80, 0x00, 0xFF, 0x03, 0xFF, 0xD2, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xFF,
-    0xCB, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0xEF, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4,
-    0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC,
-    0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x01, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0x42, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x02, 0xFF, 0xC0, 0xFF, 0xD0,
-    0x07, 0xFF, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x0F, 0xFD, 0x00, 0xBF, 0xE0, 0x3F, 0xF4, 0x03, 0xFF,
-    0x40, 0xFF, 0xD0, 0x3F, 0xFC, 0x03, 0xFF, 0xAF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFA, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x01, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xF0,
-    0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x2F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFF, 0xF5, 0x1B, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x41,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00,
-    0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD7, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0,
-    0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x7F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x01, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0B, 0xFD, 0x00, 0x2F, 0xC3,
-    0xFF, 0x00, 0x0B, 0xF0, 0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x1A, 0x00, 0x07, 0xFF, 0x8F, 0xC0,
-    0x00, 0x7F, 0xE7, 0xF4, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x07, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x94, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x8F, 0xFA, 0x5F, 0xFE, 0x6B, 0xFD, 0x3F, 0xC0, 0x3F, 0xF4, 0x07, 0xF4, 0xFE, 0x00,
-    0xFF, 0xD0, 0x1F, 0xD3, 0xF4, 0x03, 0xFF, 0x40, 0x7F, 0x02, 0x80, 0x0F, 0xFD, 0x00, 0xA4, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-    0xF4, 0x00, 0x0B, 0xFF, 0xE4, 0x6F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00,
-    0x0B, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x4F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x2A, 0x40, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0xFF,
-    0xC2, 0xFF, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xF4, 0x00,
-    0xBF, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x02,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0xFC, 0x01, 0xFF,
-    0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0x80, 0xFF, 0x7F,
-    0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0x4F, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x1F, 0xC3, 0xFF, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x4B, 0xF0, 0x7F, 0xE2, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xE3, 0xF8, 0x0F, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x03, 0xFF, 0x3F,
-    0x80, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x00, 0x7F, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x43,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xD0, 0x07,
-    0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x40, 0xFF,
-    0x80, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xF4, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00,
-    0x3F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0xE4, 0x06, 0xFF, 0xFF, 0x5F,
-    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF,
-    0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00,
-    0x00, 0x7F, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF9, 0x55, 0xFF, 0xF0, 0x1F, 0xC0, 0x01, 0xFF, 0xE0, 0x1F,
-    0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x64, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x0B, 0xFF, 0x80, 0x01, 0xFD,
-    0x0F, 0xFF, 0x00, 0x02, 0xFC, 0x3F, 0xFD, 0x55, 0x5B, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0x54, 0x7F, 0xFF, 0x2F, 0xFF, 0xC7, 0xFF, 0xF0, 0x03, 0xFC, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x7F, 0xFF, 0x2F, 0xFF, 0xCB, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x03, 0xF4, 0xFF, 0x00,
-    0x02, 0xFC, 0x2F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x1F,
-    0xD0, 0x1F, 0xE0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x1F, 0xE2, 0xFE, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x04, 0x00, 0x2E, 0x00, 0x7F, 0x40, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x0B, 0xF8, 0x01, 0xFC, 0x00, 0x28, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80,
-    0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xA9, 0x00, 0x00,
-    0x3F, 0xF7, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xF4, 0x2F, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x02,
-    0xA9, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0xEF, 0xFE, 0x1F, 0xF8, 0x0F,
-    0xFC, 0xFF, 0xC0, 0x2F, 0xE7, 0xFE, 0x00, 0x7F, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xF9, 0x5B, 0xC7, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x06,
-    0xAA, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xEF,
-    0xFF, 0x80, 0x2F, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x02, 0xFF,
-    0x80, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0xBF, 0xD0, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0x02, 0xFF, 0x80,
-    0xFF, 0xE0, 0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0xBF, 0xF0, 0x02, 0xFF, 0x80, 0x7F,
-    0xF4, 0x02, 0xFF, 0x80, 0x3F, 0xFE, 0x5F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF,
-    0xFE, 0xFF, 0xFE, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B,
-    0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x6B, 0xE4, 0x00, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xEF, 0xFC, 0x00, 0x7F, 0xE0, 0x2F, 0x80,
-    0x0B, 0xFC, 0x00, 0xA0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xA9, 0x05, 0xA8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x9B,
-    0xFE, 0x6C, 0x07, 0xFD, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xFF,
-    0x80, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xEF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x54, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFA, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x00,
-    0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0xAB, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x40, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xA9,
-    0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xE4, 0x7F, 0xFC, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xBF,
-    0xF9, 0x02, 0xFF, 0xE4, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF, 0xD3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00,
-    0x15, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
-    0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0x50,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xF8, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x80, 0x1F, 0xFD, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0x40, 0x3F, 0xF0, 0x3F, 0xFF, 0xD0, 0x0F, 0xFC, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC1, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0xFF,
-    0x40, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xDF, 0xFC,
-    0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x03, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0xBF, 0xF4, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x40, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0x4F, 0xFF, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x15, 0x00, 0xBF, 0xFD, 0x0B, 0xFF, 0xF4, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00,
-    0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4,
-    0x02, 0xFF, 0xF8, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xE0, 0x00, 0x5A, 0x01, 0xA9, 0x00, 0x06, 0xA4,
-    0x00, 0x0B, 0xFF, 0xC7, 0xFF, 0xF4, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xF4, 0x7F, 0xFF, 0xD2,
-    0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x07, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x0F, 0xFC,
-    0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0xFF,
-    0xC0, 0x07, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x0F,
-    0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00,
-    0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0x40, 0x7F, 0xF8, 0x02, 0xFF, 0xE4, 0x2F, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0x00, 0x5A,
-    0x01, 0xAA, 0x00, 0x02, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x7F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x01,
-    0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00,
-    0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0,
-    0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x47, 0xFF,
-    0xFE, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF,
-    0xEB, 0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0,
-    0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC,
-    0x3F, 0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x69, 0x01, 0xA9, 0x00, 0x2F, 0xFD, 0x3F, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xD0, 0xBF, 0xFC,
-    0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03,
-    0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x40,
-    0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0x95, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFC, 0x02, 0xFF,
-    0x80, 0xFF, 0xC0, 0x0B, 0xFE, 0x07, 0xFF, 0x00, 0x2F, 0xF8, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0xBF,
-    0xE0, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x0B, 0xFE, 0x0F, 0xFE, 0x00, 0x2F, 0xF8, 0x2F, 0xF8, 0x00,
-    0xBF, 0xE0, 0xBF, 0xF0, 0x02, 0xFF, 0x81, 0xFF, 0xD0, 0x0F, 0xFE, 0x03, 0xFF, 0xE6, 0xFF, 0xF8,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xD7, 0xFE, 0x00, 0x00,
-    0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x59, 0x01, 0xA0, 0x2F, 0xFE, 0x0F, 0xFC, 0x7F, 0xFF, 0x3F,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xE0, 0x10, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x1A, 0xA4,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0x07, 0xFD, 0x07, 0xFC, 0x2F, 0xE0, 0x07, 0xF0,
-    0xFF, 0x80, 0x0F, 0x83, 0xFF, 0xD0, 0x14, 0x0B, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x2E, 0x00, 0x7F, 0xF5, 0xFC, 0x00,
-    0x7F, 0xD7, 0xF4, 0x01, 0xFF, 0x1F, 0xFD, 0x6F, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x5A, 0x40, 0x3F, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00,
-    0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC,
-    0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x0B, 0xFE, 0x01, 0xFF,
-    0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F,
-    0x40, 0x00, 0x00, 0xFF, 0xCF, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xFE, 0x00, 0xFF, 0xFD, 0x3F, 0xFF, 0xF0,
-    0x0F, 0xF0, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x02, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F,
-    0xF4, 0x02, 0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x3F, 0xC0, 0x01, 0xFF, 0x80, 0x7F, 0xFC,
-    0x03, 0xF8, 0x00, 0x0F, 0xFC, 0x0F, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0xBF, 0xC0, 0xFF, 0xFD, 0x0B,
-    0xF0, 0x00, 0x07, 0xFD, 0x1F, 0x5F, 0xE0, 0xFE, 0x00, 0x00, 0x3F, 0xE2, 0xF0, 0xFF, 0x1F, 0xC0,
-    0x00, 0x02, 0xFF, 0x3F, 0x0F, 0xF6, 0xFC, 0x00, 0x00, 0x1F, 0xF7, 0xE0, 0xBF, 0xBF, 0x40, 0x00,
-    0x00, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0x83, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x1F, 0xFE, 0x00,
-    0xBF, 0x80, 0x01, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0xBF,
-    0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xD7, 0xFE,
-    0x00, 0x00, 0x2F, 0xE0, 0xBF, 0xE0, 0x00, 0x2F, 0xF0, 0x0F, 0xFD, 0x00, 0x2F, 0xF4, 0x02, 0xFF,
-    0xE4, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x2F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00,
-    0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0,
-    0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0B,
-    0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xC0, 0x2F, 0xFC,
-    0x07, 0xD0, 0x1F, 0xFC, 0x00, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x24, 0x03, 0xFF,
-    0x80, 0x2F, 0x03, 0xFF, 0xC0, 0x0F, 0xC2, 0xFF, 0xC0, 0x0B, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x1F, 0xFF, 0x41, 0xFF, 0xF8, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0x80,
-    0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x0F, 0xF4,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xFA, 0x40, 0x3F,
-    0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x05, 0x50, 0x00, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3,
-    0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC,
-    0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x2B, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF,
-    0x80, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x80, 0x00,
-    0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x1A, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0x41, 0xFF, 0xFC, 0x03, 0xF0, 0xFF, 0xFF, 0xE7,
-    0xFC, 0xBF, 0x9F, 0xFF, 0xFE, 0x1F, 0x80, 0x7F, 0xFF, 0x01, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0x81, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xB0,
-    0x1F, 0xD0, 0x3F, 0x40, 0xFE, 0x03, 0xF8, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x1F, 0xF0,
-    0x7F, 0xC1, 0xFF, 0x4B, 0xFD, 0x2F, 0xF4, 0xBF, 0xD3, 0xFF, 0x0F, 0xFC, 0x3F, 0xD0, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFC, 0x03, 0xFE, 0x3D,
-    0x3F, 0xD0, 0xFF, 0x83, 0xD1, 0xFC, 0x0F, 0xF0, 0x3D, 0x0F, 0x42, 0xFE, 0x03, 0xD0, 0x40, 0x3F,
-    0xD0, 0x3C, 0x00, 0x03, 0xFD, 0x03, 0xC0, 0x00, 0x3F, 0xD0, 0x7C, 0x00, 0x03, 0xFE, 0x07, 0xC0,
-    0x00, 0x3F, 0xE0, 0x7C, 0x00, 0x02, 0xFF, 0x07, 0xC0, 0x00, 0x1F, 0xFC, 0x7C, 0x00, 0x40, 0xFF,
-    0xFF, 0xC5, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x47, 0xFE, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x07,
-    0xFC, 0x01, 0xFD, 0x00, 0x0F, 0xF8, 0x01, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x05, 0x6F, 0xF5, 0x56, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x15, 0xFF, 0x55, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xFA, 0xFF, 0xFF, 0xF4, 0x07, 0x80, 0x00, 0x15, 0x40, 0x08, 0x00, 0x00,
-    0x01, 0x40, 0xFC, 0x06, 0xA4, 0x1F, 0x47, 0xFD, 0xFF, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xAF, 0xFD, 0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0xFD,
-    0x00, 0x3F, 0xC0, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x3F,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0x7F, 0xFD, 0x3F, 0xC1,
-    0xE0, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x05, 0x55, 0x51, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0xBF, 0x80,
-    0x02, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xDB, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0xFF, 0xFD, 0x54, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x6A, 0xBF, 0xFA, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3,
-    0xFC, 0xFF, 0x3F, 0xC0, 0x00, 0x01, 0xA4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x02,
-    0xF8, 0x0F, 0xFC, 0x1F, 0xC0, 0x0F, 0xE0, 0xFF, 0x00, 0x1F, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0xBE, 0xFF, 0x40, 0x02, 0xF3, 0xFF, 0xD0, 0x0B, 0xC2, 0xFF, 0xE0, 0x1F, 0x41, 0xFF,
-    0xE0, 0x3F, 0x40, 0x7F, 0xE0, 0xBF, 0x80, 0x2F, 0xC0, 0xFF, 0xE0, 0x2F, 0x80, 0xFF, 0xF4, 0x3E,
-    0x00, 0xBF, 0xF8, 0xFC, 0x00, 0x3F, 0xF6, 0xE0, 0x00, 0x1F, 0xFF, 0x81, 0x00, 0x0F, 0xFD, 0x3F,
-    0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x3F, 0x8B, 0xFC, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x8B, 0xFC, 0x3F, 0xF3,
-    0xFF, 0x0F, 0xFC, 0x7F, 0x81, 0xFE, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x7C, 0x00, 0xBF, 0xF8, 0x03, 0xC0, 0x3D, 0x00, 0xFF, 0xFF, 0x00, 0xB8, 0x1F, 0x00, 0xFE, 0x0B,
-    0xC0, 0x0F, 0x0B, 0x40, 0xBE, 0x01, 0xF0, 0x02, 0xD3, 0xC0, 0x3F, 0x00, 0x10, 0x00, 0x78, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0x1E, 0x3C, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xCF, 0x01, 0xFC, 0x00, 0x00,
-    0x01, 0xE3, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x78, 0xB4, 0x0F, 0xF0, 0x00, 0x00, 0x2D, 0x1E, 0x02,
-    0xFF, 0x96, 0xD0, 0x0F, 0x03, 0xC0, 0x3F, 0xFF, 0xF0, 0x07, 0xC0, 0xB8, 0x02, 0xFF, 0xF4, 0x03,
-    0xD0, 0x0F, 0x40, 0x01, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x95, 0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x02, 0xFF, 0xF0, 0x02, 0xFE, 0xFE,
-    0x00, 0xFC, 0x1F, 0xC0, 0x05, 0x03, 0xF0, 0x00, 0x16, 0xFC, 0x00, 0xBF, 0xFF, 0x00, 0xFE, 0x5F,
-    0xC0, 0x7E, 0x03, 0xF0, 0x0F, 0xC2, 0xFE, 0x83, 0xFF, 0xFF, 0xF0, 0x3F, 0xD3, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x03, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF0, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x09, 0x00, 0x06, 0x00, 0x07, 0xF4, 0x03, 0xF8, 0x02, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x7F,
-    0xD0, 0x3F, 0xF0, 0x2F, 0xF4, 0x0F, 0xFD, 0x0B, 0xFE, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xFD,
-    0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x02, 0xFF, 0x01, 0xFF,
-    0x00, 0x07, 0xF4, 0x07, 0xFC, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xA4, 0x15, 0x55, 0x42, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x0F, 0x90, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0x1A, 0xA9,
-    0x03, 0xC0, 0x78, 0x7F, 0xBE, 0x07, 0x42, 0xC0, 0x7C, 0x7C, 0x0F, 0x0F, 0x01, 0xF1, 0xF0, 0x2C,
-    0x3C, 0x07, 0xDF, 0x40, 0xB0, 0xE0, 0x1F, 0xF4, 0x02, 0xC3, 0xC0, 0x7D, 0xF0, 0x0B, 0x0B, 0x01,
-    0xF3, 0xF0, 0x3C, 0x1D, 0x1F, 0xE3, 0xF1, 0xE0, 0x3C, 0x15, 0x41, 0x4F, 0x00, 0x3C, 0x00, 0x00,
-    0xB4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00,
-    0x2A, 0xAA, 0xA9, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x15, 0x55, 0x54, 0x00, 0x6F, 0x90, 0x00,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0xBF, 0x97, 0xFD, 0x3F, 0x80, 0x3F, 0x8F, 0xC0, 0x0F, 0xE3,
-    0xF4, 0x03, 0xF8, 0xFE, 0x00, 0xFD, 0x2F, 0xE6, 0xFF, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0x40,
-    0x01, 0xA9, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x0A, 0xAB, 0xFE, 0xAA, 0x7F, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0xBF, 0x55, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xEF, 0xF8, 0x3F,
-    0xC1, 0xFF, 0x0F, 0xD0, 0x3F, 0xC0, 0xA0, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF5, 0x55, 0x1F, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xF4, 0x6A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x3F,
-    0xD7, 0xFD, 0x3E, 0x01, 0xFD, 0x08, 0x02, 0xFC, 0x00, 0x0B, 0xF4, 0x01, 0xBF, 0xD0, 0x02, 0xFF,
-    0xF8, 0x01, 0xAB, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFD, 0x2A, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xE0, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0x40, 0xFF, 0x07, 0xFC,
-    0x3F, 0xD1, 0xFD, 0x0B, 0xD0, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x68, 0x00, 0x05, 0x80, 0x01, 0xFF,
-    0xC0, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x2F,
-    0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02,
-    0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00,
-    0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x01, 0xFF, 0xC0,
-    0x02, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x2F, 0xFE, 0x0B, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0x7F, 0xF0, 0x3F, 0xE1, 0x50, 0x00,
-    0x54, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x1F, 0x80, 0x2F, 0xFF, 0xFC, 0x7E, 0x00,
-    0xFF, 0xFF, 0xF1, 0xF8, 0x07, 0xFF, 0xFF, 0xC7, 0xE0, 0x1F, 0xFF, 0xFF, 0x1F, 0x80, 0x7F, 0xFF,
-    0xFC, 0x7E, 0x01, 0xFF, 0xFF, 0xF1, 0xF8, 0x07, 0xFF, 0xFF, 0xC7, 0xE0, 0x0F, 0xFF, 0xFF, 0x1F,
-    0x80, 0x1F, 0xFF, 0xFC, 0x7E, 0x00, 0x2F, 0xFF, 0xF1, 0xF8, 0x00, 0x2F, 0xDF, 0xC7, 0xE0, 0x00,
-    0x04, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0x0F,
-    0xC7, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x03, 0xF1, 0xF8,
-    0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x7C, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x06, 0x90, 0xFF,
-    0xD3, 0xFF, 0x8F, 0xFE, 0x2F, 0xF0, 0x15, 0x00, 0x05, 0x01, 0xFF, 0x87, 0xFF, 0x01, 0xFD, 0x07,
-    0xF0, 0x3F, 0x47, 0xF4, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB4, 0x01, 0xBF, 0xF0, 0x2F, 0xFF,
-    0xC0, 0x7F, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03,
-    0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x6F, 0xFF, 0x83, 0xFF, 0xFF, 0x4A,
-    0xAA, 0xA8, 0x00, 0x59, 0x40, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0xFD, 0x07, 0xF8, 0x7F,
-    0x00, 0xBF, 0x1F, 0xC0, 0x1F, 0xCB, 0xF0, 0x07, 0xF1, 0xFC, 0x01, 0xFC, 0x7F, 0x40, 0xBE, 0x0F,
-    0xF5, 0xBF, 0x00, 0xFF, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x05, 0x55, 0x40, 0x00, 0x18, 0x00, 0x19, 0x00, 0x07, 0xF4,
-    0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFF, 0x03, 0xFF,
-    0x40, 0x1F, 0xFC, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xD0, 0x1F, 0xFC, 0x0F, 0xFC, 0x03, 0xFF,
-    0x02, 0xFF, 0x40, 0xFF, 0x80, 0xBF, 0xC0, 0x2F, 0xE0, 0x1F, 0xF0, 0x07, 0xF4, 0x03, 0xF8, 0x00,
-    0x18, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1B, 0xFC,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x1A, 0x00,
-    0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xF0,
-    0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x1F, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x3F, 0x00, 0x0F, 0xFF,
-    0x00, 0xFF, 0xFF, 0xD0, 0x2F, 0x80, 0x0F, 0xDF, 0xC0, 0x7F, 0xFF, 0xF4, 0x1F, 0xC0, 0x0F, 0xD3,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xF0,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF5, 0x5F, 0xD4, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x55, 0x7F, 0x50, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x5F, 0xE0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x0F, 0xD0, 0x1B, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x3F, 0xFF, 0xD0, 0x00,
-    0xFE, 0x00, 0x03, 0xF4, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xE0, 0xFF, 0x80,
-    0x6F, 0xF9, 0x00, 0xFC, 0x07, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0xD0, 0xBE, 0x00, 0xBC, 0x0B, 0xF4,
-    0x7F, 0xFF, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xEF, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF0, 0x2F,
-    0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1C, 0x02, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x68,
-    0x00, 0x00, 0x1F, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xD0, 0x01, 0xFF, 0xC0, 0x15, 0xAF, 0xFC, 0x01, 0xFC, 0x00,
-    0x3F, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x0F, 0xDF, 0xC0, 0x3F, 0xFF, 0x80, 0x0B, 0xF0,
-    0x03, 0xF4, 0xFC, 0x00, 0x55, 0x00, 0x00, 0xFD, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x1F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF5, 0x5F, 0xD4, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x01, 0x55, 0xFD, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFD, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x10, 0x0F, 0xFE, 0xAF, 0x80, 0xBF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF,
-    0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF,
-    0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF7,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF,
-    0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x2C, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD3, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xE2, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2C, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF,
-    0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC2,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xAA,
-    0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD6, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x7F,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x9F, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC7,
-    0xFF, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x2F, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0xFC, 0x05, 0x50, 0x00, 0x00, 0x03, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xE5, 0x55, 0xBF, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xC0, 0x0F,
-    0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xD5, 0x6B, 0xFC, 0x0B,
-    0xFF, 0xE0, 0x06, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B,
-    0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4,
-    0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF,
-    0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF,
-    0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x6E,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xEB, 0xF8,
-    0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0x00, 0x24, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF,
-    0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x14, 0x00,
-    0x50, 0x00, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0x00, 0x01, 0xFF, 0x83, 0xFF,
-    0x00, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF,
-    0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03,
-    0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x08, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xBF, 0xC0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x60, 0x00, 0x02, 0xF8, 0x00, 0x1F,
-    0xFC, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x00, 0x1B, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFF, 0xC0, 0x0F, 0xF7, 0xFC, 0x0F, 0xF0, 0x7F, 0x8F, 0xF0, 0x07, 0xF0, 0xA0, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00,
-    0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFD,
-    0x05, 0x00, 0x05, 0x03, 0xFD, 0x0B, 0xF8, 0x3F, 0xF0, 0xFF, 0xC3, 0xFF, 0x0F, 0xFC, 0x2F, 0xD0,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x7F, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF8, 0x00,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00,
-    0x7F, 0xF0, 0xAB, 0xFF, 0xEA, 0x80, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x0A, 0xBF,
-    0xFE, 0xA8, 0x01, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x2F,
-    0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFD,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xE5, 0x6F, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0x00, 0x02,
-    0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x2F, 0xE0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0xFF,
-    0xE0, 0x0B, 0xF8, 0x00, 0x0F, 0xF3, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0xBF,
-    0x80, 0x00, 0xFF, 0x0B, 0xFF, 0x82, 0xFE, 0x00, 0x03, 0xFC, 0x0F, 0xFF, 0x4B, 0xF8, 0x00, 0x0F,
-    0xF0, 0x0F, 0xFF, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xD0, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00,
-    0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F,
-    0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00,
-    0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F,
-    0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F,
-    0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F,
-    0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4,
-    0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F,
-    0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F,
-    0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F,
-    0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4,
-    0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x03, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x8B, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xD7, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F,
-    0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00,
-    0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40,
-    0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F,
-    0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00,
-    0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40,
-    0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0C, 0x02, 0xF8, 0x00, 0xFD, 0x1F, 0xF4, 0x0F, 0xFC,
-    0x1F, 0xF4, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xEF, 0xF4, 0x0B, 0xFC, 0x2F, 0xF4, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x7C, 0x00, 0x2F, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x01,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0xB8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x6F, 0x80, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xF9, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF,
-    0xC0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFF, 0xF0, 0x0F, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0xBE, 0xBF, 0xF4, 0x1F, 0xFC, 0x00, 0x2F, 0x87,
-    0xFF, 0x41, 0xFF, 0xC0, 0x0B, 0xE0, 0x7F, 0xF4, 0x2F, 0xFC, 0x02, 0xF8, 0x03, 0xFF, 0x42, 0xFF,
-    0xC0, 0xBE, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x2F, 0x80, 0x07, 0xFF, 0x01, 0xFF, 0xDB, 0xE0, 0x00,
-    0x7F, 0xF0, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0xF9, 0x02,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xAF, 0xFF, 0xFF, 0xFD, 0x00, 0x03,
-    0xE0, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x02,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFE, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-    0xF4, 0x00, 0x0B, 0xFF, 0xE4, 0x6F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0x80,
-    0x01, 0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x03,
-    0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x45, 0xFF, 0xF4, 0x03, 0xFF, 0x40, 0x3F, 0xFC, 0x03,
-    0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x03, 0xFF,
-    0x40, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x03, 0xFF, 0x46,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x95, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xE6, 0xFF, 0xF0, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00,
-    0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xE0, 0x03,
-    0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x2F, 0xD0, 0x00, 0x0F,
-    0xFC, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x3F,
-    0xF0, 0xBF, 0xF8, 0x00, 0x0F, 0xFC, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xF4, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0x03, 0xFF,
-    0x01, 0x00, 0xFF, 0xC0, 0xFF, 0xC3, 0xC0, 0x3F, 0xF0, 0x3F, 0xF2, 0xF4, 0x0F, 0xF4, 0x2F, 0xFC,
-    0xFF, 0xAF, 0xFC, 0x7F, 0xFF, 0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0x83, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB,
-    0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF,
-    0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F,
-    0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00,
-    0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0,
-    0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00,
-    0x2F, 0x80, 0xFD, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFE, 0xBF, 0xF4, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x68, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xAF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x0F, 0xF8,
-    0x0B, 0xFE, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x7F, 0xFD, 0x0F, 0xFF,
-    0x83, 0xFF, 0x40, 0x05, 0x40, 0x05, 0x40, 0x00, 0xBD, 0x03, 0x40, 0x00, 0x3F, 0xF8, 0x7D, 0x00,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7D, 0x7F, 0xFC, 0x00, 0x03, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F,
-    0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF,
-    0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC3, 0xFF, 0x00, 0x0B, 0xF4, 0x2F, 0xD0, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B,
-    0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7,
-    0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBE, 0xBF, 0x00, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0x01, 0xF4, 0x1F,
-    0x40, 0x00, 0x1F, 0x41, 0xF0, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD,
-    0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0,
-    0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x6A, 0x40, 0x00, 0x1B, 0xFF, 0xF4, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xEB, 0xFF, 0xFA, 0xBF, 0xF4, 0x3F, 0xF0, 0x2F, 0xFD, 0x00, 0xFF, 0xC3, 0xFD,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x0B, 0xC0, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xAA,
-    0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFA, 0x94, 0x0F,
-    0xFF, 0xEF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xF0, 0x1F, 0xFF, 0xE5, 0x5B, 0x87,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x41,
-    0xFF, 0xFF, 0xD0, 0x00, 0x55, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x01, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0xEF, 0xFE, 0x1F, 0xF8, 0x0F, 0xFC, 0xFF, 0xC0, 0x2F,
-    0xE7, 0xFE, 0x00, 0x7F, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xF9, 0x5B, 0xC7, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xA4, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD,
-    0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x7F, 0x1F, 0xD0, 0x00, 0xFC, 0x07, 0xF0,
-    0x02, 0xF4, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD,
-    0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0,
-    0x07, 0xFD, 0x1F, 0xF4, 0x07, 0xFD, 0x2F, 0xF4, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x05, 0x54, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xF0, 0x00,
-    0x0F, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07,
-    0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x1A, 0x00, 0x00,
-    0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x07, 0xFB, 0xF0, 0x0F, 0xD3, 0xFC, 0x2F, 0x80, 0xFD, 0x3F, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
-    0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x41, 0xFD, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xBF, 0x42, 0xFD, 0x04, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x2F, 0x00, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBE, 0x7F, 0xE0, 0x00, 0x02, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x55, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0x80, 0x7F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0xD7, 0xFF,
-    0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF,
-    0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xF4,
-    0x01, 0xFF, 0x83, 0xFF, 0xD0, 0x3F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x06, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0xBF, 0xF8, 0x00, 0x00,
-    0x0B, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x01, 0xAA, 0x00, 0x02, 0xFF, 0xF1, 0xFF, 0xFE, 0x00,
-    0x7F, 0xFF, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x7F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF,
-    0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B,
-    0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00,
-    0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x47, 0xFF, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD,
-    0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00,
-    0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7,
-    0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF,
-    0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF,
-    0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0,
-    0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0xA8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x01, 0xFE, 0xFC, 0x00,
-    0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0x80, 0x3F, 0xFC, 0x3F, 0xF0, 0x01,
-    0xFF, 0xD7, 0xFF, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0B, 0xFE, 0xFF,
-    0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFF, 0x00, 0x0F,
-    0xFC, 0x7F, 0xF4, 0x01, 0xFF, 0xC3, 0xFF, 0xD0, 0x3F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x2F, 0x40, 0xD0,
-    0x00, 0x0F, 0xFE, 0x1F, 0x40, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0x5F, 0xFF, 0x00, 0x00, 0xF0,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB,
-    0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00,
-    0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F,
-    0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0x40, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x02, 0xFD, 0x0B, 0xF4, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF,
-    0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0,
-    0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD,
-    0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xF9, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xAA, 0x90,
-    0x10, 0x00, 0x1F, 0xFF, 0xFD, 0x78, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x9B, 0xFF, 0xF0,
-    0x07, 0xFD, 0x00, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0xBF, 0xF4, 0x1F, 0xF8, 0x02, 0xFF, 0xF8, 0x2F,
-    0xF4, 0x0B, 0xFF, 0xF8, 0x2F, 0xF4, 0x2F, 0x9F, 0xFC, 0x3F, 0xF4, 0xBE, 0x1F, 0xF8, 0x3F, 0xF6,
-    0xF8, 0x1F, 0xF8, 0x2F, 0xFF, 0xE0, 0x2F, 0xF4, 0x2F, 0xFF, 0x80, 0x2F, 0xF0, 0x1F, 0xFE, 0x00,
-    0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0xBF, 0xD0, 0x0B, 0xFF, 0xEB, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2E, 0x2F, 0xFF, 0xE0, 0x00, 0x04, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03,
-    0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03,
-    0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03,
-    0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03,
-    0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x1B, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x01, 0xBF, 0xF8, 0x0B, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x02,
-    0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x3F, 0xFD, 0x5B, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x4B, 0xFF, 0xD0,
-    0x00, 0x15, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xE1, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF,
-    0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00,
-    0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0,
-    0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0xFF,
-    0x8F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xA9, 0x00, 0x03, 0xFF, 0x7F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xD0, 0xBF,
-    0xFC, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD,
-    0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x03, 0xFF,
-    0x40, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0x95, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03,
-    0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01,
-    0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4,
-    0x7F, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xAA, 0xAA, 0x80, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00,
-    0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0,
-    0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFB,
-    0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF,
-    0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3D, 0x00,
-    0x1D, 0x00, 0x0B, 0xF8, 0x07, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F,
-    0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F,
-    0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F,
-    0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE8, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00,
-    0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0,
-    0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x50, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFC,
-    0x00, 0x03, 0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x1F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF4, 0x2F, 0xFE,
-    0xFF, 0xE1, 0xFF, 0x80, 0xFF, 0xCF, 0xFC, 0x02, 0xFE, 0x7F, 0xE0, 0x07, 0xF2, 0xFF, 0x40, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x95, 0xBC, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x0A, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x80, 0x00, 0x07,
-    0xF8, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x00, 0x06, 0x40, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC,
-    0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00,
-    0x01, 0xB0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0xBF,
-    0x1F, 0xC0, 0x07, 0xF0, 0x2F, 0x80, 0x2F, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xA4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x0B, 0xFF, 0xBF, 0xF8,
-    0x7F, 0xE0, 0x3F, 0xF3, 0xFF, 0x00, 0xBF, 0x9F, 0xF8, 0x01, 0xFC, 0xBF, 0xD0, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE5, 0x6F, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFC,
-    0x00, 0x03, 0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x01,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0xEF, 0xFE, 0x1F, 0xF8, 0x0F, 0xFC, 0xFF, 0xC0,
-    0x2F, 0xE7, 0xFE, 0x00, 0x7F, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xF9, 0x5B, 0xC7, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x0A, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x80, 0x1F, 0xD0, 0x00, 0x0F, 0xE0,
-    0x7F, 0x40, 0x00, 0x0B, 0xF9, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x2F, 0xF8,
-    0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x19, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0x80,
-    0x3F, 0x00, 0xFD, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0xFF, 0xBF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x90, 0x00, 0x1F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF4, 0x2F, 0xFE, 0xFF, 0xE1, 0xFF, 0x80, 0xFF,
-    0xCF, 0xFC, 0x02, 0xFE, 0x7F, 0xE0, 0x07, 0xF2, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0x95, 0xBC, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0xF8, 0x00, 0x05, 0x54, 0x00, 0x00, 0x28, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x7F, 0x81, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE7, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFE, 0x40,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40,
-    0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x03,
-    0xFF, 0x40, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x2F,
-    0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03,
-    0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x40, 0x00, 0x7F,
-    0xF0, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x95,
-    0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x41,
-    0x50, 0x00, 0x00, 0x7F, 0xFE, 0x0B, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x3F, 0x80, 0x00, 0x1F, 0xFF,
-    0xE0, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0x80, 0x00, 0x00,
-    0x2F, 0xF8, 0x3D, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xF0, 0x00, 0x06, 0xAA, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFC, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x2F, 0xF8,
-    0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xD0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x0B,
-    0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xF0,
-    0x02, 0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xE5, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xD2, 0xFF, 0xF4,
-    0x00, 0x01, 0x50, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xD0, 0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFD, 0x00,
-    0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00,
-    0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0xAB, 0xFF, 0xEA, 0x80,
-    0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x0A, 0xBF, 0xFE, 0xA8, 0x01, 0xFF, 0xC0, 0x0F,
-    0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xE5, 0x6F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xAB,
-    0xFF, 0xE9, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xAB, 0xFF, 0xE9, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x1A, 0xFB, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xAB, 0xFF, 0x80, 0x3F, 0xF8, 0x02, 0xFF, 0x80, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0xBF,
-    0xE0, 0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0xFF, 0xE0,
-    0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0xBF, 0xF0, 0x02, 0xFF, 0x80, 0x7F, 0xF4, 0x02,
-    0xFF, 0x80, 0x3F, 0xFE, 0x5F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF, 0xFE, 0xFF,
-    0xFE, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x00,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x6A, 0xAA, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95,
-    0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00,
-    0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95,
-    0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x01, 0xAA, 0xAA, 0xA0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0x55, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03,
-    0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x1C, 0x00, 0x00,
-    0xFE, 0x00, 0x7C, 0x00, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8,
-    0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02,
-    0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x40, 0x00, 0x10, 0x02, 0xF0, 0x00, 0xB0, 0x03, 0xFC, 0x03,
-    0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03,
-    0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55,
-    0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41,
-    0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95,
-    0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00,
-    0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95,
-    0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF,
-    0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57,
-    0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB,
-    0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xA0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0x05, 0x6F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xD4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x28, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x00,
-    0x7F, 0xDF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB,
-    0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xE0, 0x03, 0xF4, 0x0F, 0xD0, 0x02, 0xFC, 0x2F, 0x80,
-    0x00, 0xFF, 0xBF, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x02, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x0F, 0xF0,
-    0x00, 0x00, 0x1F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x19, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x1F,
-    0xFD, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xC0,
-    0x3F, 0xF4, 0x00, 0x00, 0x14, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xCB, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xF4,
-    0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x07,
-    0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0xFE, 0x5A, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x00, 0x2F, 0xC7, 0xF4, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00,
-    0x00, 0xBD, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA9, 0x05, 0xA8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF,
-    0x9B, 0xFE, 0x6C, 0x07, 0xFD, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00,
-    0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xEF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x54, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFA, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0,
-    0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0xAB,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x02, 0x80, 0x00, 0x00, 0x3F, 0x40,
-    0x2F, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x1F, 0xFD, 0x00, 0x01,
-    0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xF4, 0x00,
-    0x00, 0x14, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xCB,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xF4, 0x00, 0x00, 0xFF,
-    0xC0, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x07, 0xFF, 0xE0, 0x00,
-    0x2F, 0xF0, 0x0B, 0xFF, 0xFE, 0x5A, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x05, 0xA8, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x9B, 0xFE, 0x6C, 0x07, 0xFD, 0x01, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x07,
-    0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x54, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFA, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF4,
-    0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0xAB, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xF4, 0x01, 0xFF, 0x80, 0x1F, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF4, 0x07,
-    0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x14, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xFC, 0x00,
-    0x0F, 0xFF, 0xF8, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x03, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0xFE, 0x5A, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA9, 0x05, 0xA8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF,
-    0x9B, 0xFE, 0x6C, 0x07, 0xFD, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00,
-    0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xEF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x54, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFA, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0,
-    0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0xAB,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x40,
-    0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x1F, 0xFD,
-    0x00, 0x01, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0xF4, 0x00, 0x00, 0x14, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xCB, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x07, 0xFF,
-    0xE0, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0xFE, 0x5A, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x05, 0xA8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x9B, 0xFE, 0x6C, 0x07, 0xFD, 0x01, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0xFE,
-    0x02, 0xFF, 0x40, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xFC, 0x54, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFA, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x7F,
-    0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0xAB, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFD, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFD,
-    0x00, 0x00, 0x03, 0xF4, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x6A,
-    0x40, 0x00, 0x03, 0xFF, 0x1F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF9, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00,
-    0x3F, 0xF0, 0x00, 0xBF, 0xF9, 0x02, 0xFF, 0xE4, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x40, 0xFF,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0xFF, 0xE5, 0x55, 0x57, 0xFF, 0x94, 0x00, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0xFF, 0xE5, 0x55, 0x57, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40,
-    0x07, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x06, 0xBF, 0xFA, 0xA0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xBF, 0xFA, 0xA0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2B, 0xE0, 0x00, 0x03, 0xFF, 0x2F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x07,
-    0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0xBF, 0xF9, 0x02, 0xFF, 0xE4, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x38, 0x3F, 0xFC, 0x7D, 0xBF, 0xFF, 0xFD,
-    0xBD, 0x7F, 0xFC, 0x3C, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFD, 0x0B, 0xD0, 0x24, 0x3F, 0xF8, 0x3D, 0x7F, 0xFF, 0xFD, 0x7E, 0x7F, 0xFC,
-    0x3C, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F,
-    0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFC, 0x2A, 0xAA, 0xA4, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x2A, 0xAA, 0xA9, 0x7F,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0C, 0xBF, 0x00, 0x7D, 0x7F, 0xFB, 0xFC,
-    0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFD, 0x04, 0x00, 0x04, 0x3D, 0x00, 0x1D, 0x7F, 0x80, 0x7D, 0x3F, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F,
-    0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00,
-    0x2F, 0xD0, 0x00, 0x2F, 0xFA, 0x80, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
-    0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xF4,
-    0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xE5, 0x00, 0x3F, 0xFF, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x40, 0x3F,
-    0xF8, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00,
-    0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x54, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xBF, 0xF0, 0x0F, 0xFF,
-    0x00, 0x2F, 0xFC, 0x02, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x2A, 0x40, 0x00, 0x6A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x55, 0x0B, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xC7, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0xBF, 0xFE, 0x02, 0xFF, 0xFC, 0x01, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00,
-    0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0x90, 0x0F, 0xFC, 0x3F, 0xFF, 0xFC, 0x03,
-    0xFF, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xEB, 0xF8,
-    0x00, 0xFE, 0x0B, 0xF4, 0x0F, 0xE0, 0x07, 0xE0, 0x19, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0xB9, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x7F, 0x0F, 0xD0, 0x03, 0xF4, 0x1F, 0xC0, 0x1F, 0x40, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x60, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFC, 0xBF, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x03, 0xFF,
-    0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x6F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0x40, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0x40, 0x3F, 0xF0, 0x3F,
-    0xFF, 0xD0, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC1, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x03, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0xBF, 0xF4, 0x00, 0x3F, 0xF0, 0x0F, 0xFF,
-    0x00, 0x1F, 0xFE, 0x40, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0x4F, 0xFF, 0xFC, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0x82, 0xFF, 0xFF,
-    0x02, 0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x2F, 0xF0,
-    0x00, 0x01, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0xBF,
-    0xF0, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0x80,
-    0xBF, 0xF8, 0x00, 0x7F, 0xFD, 0x03, 0xFF, 0xE0, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0x83, 0xFF, 0xFF,
-    0x80, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xFC,
-    0x03, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0x95, 0x6B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x1F, 0xC0, 0x07,
-    0xFF, 0x00, 0xBF, 0xFC, 0x0F, 0xFF, 0xD0, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0xBF, 0xFD, 0x0B, 0xFF, 0xF4, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00,
-    0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0,
-    0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD,
-    0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x02, 0xFF,
-    0xF8, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x01,
-    0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0x95, 0x6B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0xBF, 0xFD, 0x0B, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF,
-    0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0xF8, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0xFF, 0xFD, 0x0F, 0xC0, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xC0, 0xBF, 0xFF, 0xF4, 0x1F, 0x40, 0x03, 0xFF, 0x80, 0x1F, 0x00, 0x03, 0xFF, 0x40, 0x1D, 0x00,
-    0x03, 0xFF, 0x40, 0x04, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x01,
-    0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0x95, 0x6B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x15, 0x01, 0x40, 0xBF, 0xFD,
-    0x0F, 0xCB, 0xFF, 0xF4, 0x3F, 0x6F, 0xFF, 0xD0, 0xFC, 0x03, 0xFF, 0x43, 0xF0, 0x0F, 0xFD, 0x1F,
-    0x40, 0x3F, 0xF4, 0x7C, 0x00, 0xFF, 0xD1, 0xE0, 0x03, 0xFF, 0x41, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x06, 0xE0, 0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03, 0xFF,
-    0x40, 0x2F, 0xFC, 0x03, 0xFF, 0x40, 0x1F, 0xF4, 0x03, 0xFF, 0x40, 0x01, 0x40, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x03, 0xFF, 0x40, 0x00,
-    0xFC, 0x03, 0xFF, 0x40, 0x01, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0x95, 0x6B, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x15, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xF4, 0x02, 0xA0, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xF4, 0x0F, 0xFD, 0x03, 0xFF,
-    0x40, 0xFF, 0xC0, 0x3F, 0xF4, 0x0B, 0xF8, 0x03, 0xFF, 0x40, 0x04, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x41, 0xD0, 0x00,
-    0x00, 0x3F, 0xF9, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x2E, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x00, 0x3F, 0xF4, 0x00,
-    0x0F, 0xC0, 0x03, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x95,
-    0x6B, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x05, 0x40, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0,
-    0x00, 0x3F, 0xF6, 0xC0, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x02, 0x3F, 0xF4, 0x00, 0x0F, 0xFD,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x0B,
-    0xF8, 0x00, 0x0F, 0xF3, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0xBF, 0x80, 0x00,
-    0xFF, 0x0B, 0xFF, 0x82, 0xFE, 0x00, 0x03, 0xFC, 0x0F, 0xFF, 0x4B, 0xF8, 0x00, 0x0F, 0xF0, 0x0F,
-    0xFF, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x01,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A,
-    0x01, 0xAA, 0x00, 0x02, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x7F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x01,
-    0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00,
-    0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0,
-    0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x47, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xD2, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0x00,
-    0x02, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xBF, 0xF8, 0x02, 0xFE, 0x00, 0x03, 0xFC,
-    0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x0F, 0xF0, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x3F, 0xC2, 0xFF, 0xE0,
-    0xBF, 0x80, 0x00, 0xFF, 0x03, 0xFF, 0xD2, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0xCB, 0xF8, 0x00,
-    0x0F, 0xF0, 0x07, 0xFF, 0xEF, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x01, 0xAA, 0x00, 0x02, 0xFF,
-    0xF1, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xF4, 0x7F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x00,
-    0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0,
-    0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x01, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x47, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x01,
-    0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFE,
-    0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x0B, 0xF8, 0x00, 0x0F, 0xF3, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x3F,
-    0xC3, 0xFF, 0xC0, 0xBF, 0x80, 0x00, 0xFF, 0x0B, 0xFF, 0x82, 0xFE, 0x00, 0x03, 0xFC, 0x0F, 0xFF,
-    0x4B, 0xF8, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xBF, 0x80,
-    0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x00, 0xBF,
-    0x0B, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x01, 0xAA, 0x00, 0x02, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0x7F,
-    0xFF, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x7F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0,
-    0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF,
-    0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0xF4, 0x7F,
-    0xFF, 0xE3, 0xFF, 0xFF, 0x47, 0xFF, 0xFE, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x69, 0x01, 0xA9, 0x00, 0x00, 0xFE, 0x02, 0xFF, 0xE2,
-    0xFF, 0xFD, 0x00, 0x1F, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xF4, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x04, 0x00, 0x03, 0xFF, 0xE4, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xF4, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xBF,
-    0x80, 0x00, 0xFF, 0xBF, 0xF4, 0x02, 0xFE, 0x00, 0x03, 0xFC, 0xFF, 0xF0, 0x0B, 0xF8, 0x00, 0x0F,
-    0xF0, 0xFF, 0xE0, 0x2F, 0xE0, 0x00, 0x3F, 0xC2, 0xFF, 0xD0, 0xBF, 0x80, 0x00, 0xFF, 0x03, 0xFF,
-    0xC2, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0x8B, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0x6F, 0xE0,
-    0x00, 0x3F, 0xC0, 0x0B, 0xFF, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFC,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x6A, 0x01, 0xAA, 0x00, 0x2F, 0xFF, 0x1F, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xBF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x7F, 0xFC, 0x01,
-    0xFF, 0xC0, 0x0F, 0xFD, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x01, 0xFF,
-    0x80, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x01, 0xFF, 0x80,
-    0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x0B,
-    0xFD, 0x07, 0xFF, 0xD0, 0x0B, 0xFD, 0x2F, 0xFF, 0xF4, 0x0B, 0xFD, 0x3F, 0xFF, 0xF4, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0,
-    0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0,
-    0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
-    0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00,
-    0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF,
-    0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50,
-    0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F,
-    0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE,
-    0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF,
-    0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0x00,
-    0x0B, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF,
-    0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00,
-    0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F,
-    0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F,
-    0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x0F, 0x40,
-    0x07, 0x40, 0x02, 0xFE, 0x01, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F,
-    0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE,
-    0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF,
-    0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC2, 0xFF,
-    0x40, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0x80,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00,
-    0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F,
-    0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x10, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x00, 0xFF, 0x1F,
-    0xD0, 0x00, 0x1F, 0xD2, 0xFC, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x02,
-    0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF8,
-    0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFE,
-    0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE, 0x00,
-    0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF, 0x41,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0x41, 0xFF, 0xE5, 0xAB,
-    0xFC, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x03, 0xF0, 0x3F, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x0F,
-    0xC1, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x28, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x54, 0x07,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0xBF, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x07, 0xF0, 0xFF, 0xF4,
-    0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xC1, 0xFF, 0xFD, 0x00, 0xFF, 0xE5, 0x56, 0xFF, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFC, 0x1F, 0xF8, 0x03, 0xFF, 0xF0, 0x0B, 0xFE, 0x3F,
-    0xF0, 0x01, 0xFF, 0xE0, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0xBF, 0xE0, 0x00,
-    0xFF, 0xE5, 0x57, 0xFF, 0xBF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xD5, 0x55, 0x54, 0xBF, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFD,
-    0x03, 0xFF, 0xFE, 0x51, 0x6D, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xE0, 0x00, 0x05, 0x50, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0xFF,
-    0xD1, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x1F,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x01, 0xA0, 0x2F, 0xFE, 0x0F, 0xFC, 0x7F,
-    0xFF, 0x3F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xE0, 0x10, 0x01,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0xFF,
-    0xD1, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x1F,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x59, 0x01,
-    0xA0, 0x2F, 0xFE, 0x0F, 0xFC, 0x7F, 0xFF, 0x3F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xE0, 0x10, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x78, 0x00, 0x00, 0x0B,
-    0xD0, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xE7, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF,
-    0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0x41, 0xFF, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0,
-    0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD7,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0x00,
-    0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x02, 0xF0, 0x02,
-    0xF8, 0x0B, 0xF0, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0xBF, 0xBF, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x01, 0xA0, 0x2F, 0xFE, 0x0F, 0xFC, 0x7F, 0xFF, 0x3F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xE0, 0x10, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0B, 0xFD,
-    0x00, 0x2F, 0xC3, 0xFF, 0x00, 0x0B, 0xF0, 0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x1A, 0x00, 0x07,
-    0xFF, 0x8F, 0xC0, 0x00, 0x7F, 0xE7, 0xF4, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0,
-    0x07, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x5A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x7F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0x7F, 0xD0, 0x7F, 0xC2, 0xFE, 0x00, 0x7F, 0x0F, 0xF8, 0x00, 0xF8,
-    0x3F, 0xFD, 0x01, 0x40, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xC2, 0xE0, 0x07, 0xFF, 0x5F, 0xC0, 0x07, 0xFD, 0x7F, 0x40,
-    0x1F, 0xF1, 0xFF, 0xD6, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0x7F, 0xC0, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x0A, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0B, 0xFD, 0x00, 0x2F, 0xC3, 0xFF, 0x00, 0x0B,
-    0xF0, 0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x1A, 0x00, 0x07, 0xFF, 0x8F, 0xC0, 0x00, 0x7F, 0xE7,
-    0xF4, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x07, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x94, 0x00, 0x00, 0x00, 0x06,
-    0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xBF, 0x80, 0x01, 0xFC, 0x7F,
-    0x40, 0x0F, 0xC0, 0x7F, 0x00, 0xBD, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x90, 0x00, 0x1F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4, 0x1F, 0xF0, 0xBF,
-    0x80, 0x1F, 0xC3, 0xFE, 0x00, 0x3E, 0x0F, 0xFF, 0x40, 0x50, 0x2F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF0, 0xB8, 0x01, 0xFF,
-    0xD7, 0xF0, 0x01, 0xFF, 0x5F, 0xD0, 0x07, 0xFC, 0x7F, 0xF5, 0xBF, 0xE0, 0xFF, 0xFF, 0xFE, 0x02,
-    0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0B, 0xFD, 0x00, 0x2F,
-    0xC3, 0xFF, 0x00, 0x0B, 0xF0, 0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x1A, 0x00, 0x07, 0xFF, 0x8F,
-    0xC0, 0x00, 0x7F, 0xE7, 0xF4, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x07, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x94,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0x07,
-    0xFD, 0x07, 0xFC, 0x2F, 0xE0, 0x07, 0xF0, 0xFF, 0x80, 0x0F, 0x83, 0xFF, 0xD0, 0x14, 0x0B, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFC, 0x2E, 0x00, 0x7F, 0xF5, 0xFC, 0x00, 0x7F, 0xD7, 0xF4, 0x01, 0xFF, 0x1F, 0xFD, 0x6F, 0xF8,
-    0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4, 0x00, 0x05, 0x54, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x01, 0x80, 0x00, 0xB4, 0x00, 0xFC,
-    0x00, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x03, 0xFD, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00,
-    0xFF, 0x0B, 0xFD, 0x00, 0x2F, 0xC3, 0xFF, 0x00, 0x0B, 0xF0, 0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE,
-    0x1A, 0x00, 0x07, 0xFF, 0x8F, 0xC0, 0x00, 0x7F, 0xE7, 0xF4, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B,
-    0xFD, 0x7F, 0xF0, 0x07, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0x5A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0xFD,
-    0x03, 0xF4, 0x02, 0xFC, 0x2F, 0x80, 0x03, 0xFE, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40,
-    0x00, 0x7F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0x7F, 0xD0, 0x7F, 0xC2, 0xFE, 0x00, 0x7F, 0x0F,
-    0xF8, 0x00, 0xF8, 0x3F, 0xFD, 0x01, 0x40, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xC2, 0xE0, 0x07, 0xFF, 0x5F, 0xC0, 0x07,
-    0xFD, 0x7F, 0x40, 0x1F, 0xF1, 0xFF, 0xD6, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFA, 0x5F, 0xFE, 0x6B, 0xFD, 0x3F, 0xC0, 0x3F, 0xF4, 0x07,
-    0xF4, 0xFE, 0x00, 0xFF, 0xD0, 0x1F, 0xD3, 0xF4, 0x03, 0xFF, 0x40, 0x7F, 0x02, 0x80, 0x0F, 0xFD,
-    0x00, 0xA4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x6F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0x5A, 0x40, 0x3F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x02, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x03,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xE9, 0x7F, 0xF9, 0xAF, 0xF4, 0xFF, 0x00, 0xFF, 0xD0,
-    0x1F, 0xD3, 0xF8, 0x03, 0xFF, 0x40, 0x7F, 0x4F, 0xD0, 0x0F, 0xFD, 0x01, 0xFC, 0x0A, 0x00, 0x3F,
-    0xF4, 0x02, 0x90, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x19, 0x1F, 0x80,
-    0x03, 0xFC, 0x7C, 0x00, 0x2F, 0xF0, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xBF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x3F, 0xFD, 0x69, 0x00, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFA, 0x5F, 0xFE, 0x6B, 0xFD, 0x3F, 0xC0, 0x3F, 0xF4, 0x07, 0xF4, 0xFE,
-    0x00, 0xFF, 0xD0, 0x1F, 0xD3, 0xF4, 0x03, 0xFF, 0x40, 0x7F, 0x02, 0x80, 0x0F, 0xFD, 0x00, 0xA4,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xAB, 0xFF, 0xAA,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0x6F, 0xFD, 0x54, 0x00,
-    0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x5A, 0x40, 0x3F,
-    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x09, 0x00, 0x00, 0x01, 0xFF, 0xD2, 0xF0, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x1E, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF,
-    0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80,
-    0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F,
-    0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x03, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xB0, 0x00,
-    0x00, 0x3F, 0xD0, 0x2F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF,
-    0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0xE4, 0x6F, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0,
-    0xBC, 0x00, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF,
-    0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF,
-    0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC1, 0xFF,
-    0x40, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0xBD, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xF0,
-    0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0xE4, 0x6F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00,
-    0x00, 0xFF, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00,
-    0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F,
-    0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01,
-    0x54, 0x01, 0x50, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
-    0x07, 0xFF, 0xE5, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF,
-    0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0x7F,
-    0xFC, 0x00, 0x01, 0x54, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x50, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x0A, 0x90, 0x01, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0x0B, 0xFC, 0x00,
-    0xBF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00,
-    0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
-    0xFD, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0xFE,
-    0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xFF,
-    0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xE0,
-    0x3F, 0xDF, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x0F, 0xD3, 0xFF, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x07, 0xF0, 0xFF, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD2, 0xFC, 0x1F, 0xF8, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFE, 0x03, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0x00,
-    0xFF, 0xCF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xC0, 0x1F, 0xFB, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xE0, 0x0F,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0x40, 0x2F, 0xF0, 0x02, 0xFF,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x2F, 0xD0, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x03, 0xFC, 0x00,
-    0x1F, 0xF8, 0x07, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0xFF, 0xFC, 0x07, 0xF4, 0x00, 0x0B,
-    0xFC, 0x0F, 0xFF, 0xD0, 0xBF, 0x00, 0x00, 0x7F, 0xD1, 0xF5, 0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xFE,
-    0x2F, 0x0F, 0xF1, 0xFC, 0x00, 0x00, 0x2F, 0xF3, 0xF0, 0xFF, 0x6F, 0xC0, 0x00, 0x01, 0xFF, 0x7E,
-    0x0B, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xD0, 0x00, 0x00,
-    0x0F, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x02, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x01,
-    0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFC,
-    0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xE2, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0B,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD3, 0xFF, 0xFF,
-    0x42, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFF,
-    0xC0, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x1F, 0xF0, 0x00, 0x07,
-    0xFF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x47, 0xF4, 0x00, 0x00,
-    0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0B,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF9, 0x55, 0xFF, 0xF0, 0x1F, 0xC0, 0x01,
-    0xFF, 0xE0, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x64, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x0B, 0xFF,
-    0x80, 0x01, 0xFD, 0x0F, 0xFF, 0x00, 0x02, 0xFC, 0x3F, 0xFD, 0x55, 0x5B, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x02, 0xFF,
-    0xC0, 0x7D, 0x01, 0xFF, 0xC0, 0x0F, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x02, 0x40, 0x3F,
-    0xF8, 0x02, 0xF0, 0x3F, 0xFC, 0x00, 0xFC, 0x2F, 0xFC, 0x00, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF9, 0x55, 0xFF, 0xF0, 0x1F, 0xC0,
-    0x01, 0xFF, 0xE0, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x64, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x0B,
-    0xFF, 0x80, 0x01, 0xFD, 0x0F, 0xFF, 0x00, 0x02, 0xFC, 0x3F, 0xFD, 0x55, 0x5B, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xC0, 0x2F, 0xFC, 0x07, 0xD0, 0x1F, 0xFC, 0x00, 0xF0, 0x0F,
-    0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x24, 0x03, 0xFF, 0x80, 0x2F, 0x03, 0xFF, 0xC0, 0x0F, 0xC2,
-    0xFF, 0xC0, 0x0B, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x2D, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xDB, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x1F, 0xF9, 0x55, 0xFF, 0xF0, 0x1F, 0xC0, 0x01, 0xFF, 0xE0, 0x1F, 0xC0, 0x03, 0xFF, 0xC0,
-    0x0F, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x64, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x0B, 0xFF, 0x80, 0x01, 0xFD, 0x0F, 0xFF, 0x00, 0x02,
-    0xFC, 0x3F, 0xFD, 0x55, 0x5B, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0xF8, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x02, 0xFF, 0xC0, 0x7D, 0x01, 0xFF, 0xC0, 0x0F, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x02, 0x40, 0x3F, 0xF8, 0x02, 0xF0, 0x3F, 0xFC, 0x00, 0xFC,
-    0x2F, 0xFC, 0x00, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xEF, 0xFD, 0x00, 0xFF, 0xC0, 0x7F, 0x00, 0xBF, 0xD0, 0x07, 0x40,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0x00, 0xF4, 0x0B, 0xF0, 0x2F, 0xF0, 0x3F, 0xF0, 0x2F, 0xE0,
-    0x1F, 0xC0, 0x0D, 0x00, 0x00, 0x01, 0x00, 0x7D, 0x0F, 0xF1, 0xFF, 0x3F, 0xDB, 0xF4, 0xFD, 0x03,
-    0x40, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x07, 0xFB, 0xF0, 0x0F,
-    0xD3, 0xFC, 0x2F, 0x80, 0xFD, 0x3F, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x24, 0x3F, 0xF8,
-    0x3D, 0x7F, 0xFF, 0xFD, 0x7E, 0x7F, 0xFC, 0x3C, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA9,
-    0x7F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0x15, 0x55, 0x54, 0x04, 0x00, 0x04, 0x3D, 0x00, 0x1D, 0x7F,
-    0x80, 0x7D, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x1A, 0x47, 0xFD, 0xBF, 0xEB,
-    0xFE, 0x3F, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xBF, 0x42, 0xFD, 0x04, 0x00, 0x10, 0x06, 0xFD, 0x03, 0xFF, 0xFC, 0x7F, 0x5F, 0xD7, 0xD0, 0xBE,
-    0x2C, 0x0F, 0xD0, 0x02, 0xF8, 0x03, 0xFE, 0x00, 0x3F, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0xBF, 0xF0, 0x2F, 0xAF, 0xC3, 0xD0, 0xBC, 0x7D, 0x07, 0xD7, 0xD0, 0x7C, 0x3F, 0x5F,
-    0xC1, 0xFF, 0xF0, 0x02, 0xE4, 0x00, 0x04, 0x00, 0x40, 0x3E, 0x07, 0xD1, 0xFC, 0x3F, 0xCF, 0xF1,
-    0xFE, 0x7F, 0x4B, 0xF2, 0xF8, 0x3F, 0x4F, 0xC1, 0xF8, 0x2D, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0xBC, 0xBF, 0x01, 0xFC, 0x3F, 0x83, 0xF0, 0x1F, 0xEF, 0xD0, 0x0B, 0xFF,
-    0xC0, 0x02, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x04, 0x00, 0x41, 0xF4, 0x2F, 0x0F, 0xF0, 0xFD, 0x2F,
-    0xD3, 0xFC, 0x3F, 0x87, 0xF4, 0x7F, 0x0B, 0xE0, 0xBD, 0x0F, 0xC0, 0xF0, 0x1E, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x80, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7D, 0x02, 0xFD, 0x70, 0x00, 0x7C, 0x10,
-    0x00, 0x10, 0x00, 0x00, 0x7D, 0x1F, 0xC3, 0xF8, 0x7F, 0x0B, 0xF0, 0xFF, 0x0B, 0xF8, 0x7F, 0xC1,
-    0xA0, 0x0B, 0xE0, 0xBF, 0xD0, 0xFF, 0x81, 0xFE, 0x07, 0xF4, 0x2F, 0xC0, 0xFD, 0x0F, 0xE0, 0x2E,
-    0x00, 0x2F, 0x81, 0xFF, 0x8B, 0xFC, 0x2F, 0xD0, 0x7F, 0x40, 0xFE, 0x01, 0xFC, 0x02, 0xFC, 0x02,
-    0xE0, 0x10, 0x0F, 0xC7, 0xF1, 0xFC, 0x7E, 0x2F, 0x4B, 0xC2, 0xD0, 0x20, 0x00, 0x00, 0x02, 0xF8,
-    0x2F, 0xD1, 0xFD, 0x2F, 0xC7, 0xF4, 0xBD, 0x0B, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFC, 0xBF, 0xEB,
-    0xFE, 0x7F, 0xD1, 0xA4, 0x3F, 0x40, 0xFD, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xBF, 0x82, 0xFE,
-    0x15, 0x00, 0x54, 0x01, 0x40, 0x1F, 0xF8, 0x7E, 0xBD, 0xB8, 0x3E, 0xF8, 0x2E, 0xBD, 0x7D, 0x3F,
-    0xF8, 0x06, 0x90, 0x01, 0x40, 0x3F, 0xC0, 0xFF, 0x42, 0xFE, 0x07, 0xF4, 0x3F, 0xC2, 0xFC, 0x06,
-    0x40, 0x05, 0x40, 0x2F, 0xF4, 0x2F, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x07, 0xF0, 0x2F, 0xD0, 0x1A,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x7F, 0x00, 0xBF, 0x00, 0xBF, 0xD5, 0x3F, 0xFE, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x2A, 0x00, 0x00,
-    0x6E, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x0F, 0xFB, 0xFC, 0x2F, 0xC1, 0xFE, 0x7F, 0x00,
-    0x7E, 0x28, 0x00, 0x18, 0x04, 0x00, 0x04, 0x3D, 0x00, 0x1D, 0x7F, 0x80, 0x7D, 0x3F, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x38, 0x3F, 0xFC, 0x7D, 0x7F,
-    0xFF, 0xFD, 0x7D, 0x3F, 0xFC, 0x2C, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x7F, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFD, 0x2A, 0xAA, 0xA8, 0x01, 0xBF, 0x80, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC,
-    0x7D, 0x02, 0xFD, 0x70, 0x00, 0x7C, 0x10, 0x00, 0x10, 0x00, 0x00, 0x40, 0x00, 0x03, 0xE0, 0x00,
-    0x07, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x28,
-    0x00, 0x04, 0x00, 0x10, 0x7F, 0x82, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0x7F, 0x41, 0xFD,
-    0x00, 0x00, 0x00, 0x2A, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xF5, 0x2F, 0xFC, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB,
-    0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0x00, 0x01,
-    0xFF, 0x83, 0xFF, 0x00, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02,
-    0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40,
-    0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFA, 0x6F, 0xFD, 0x6B, 0xFC, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x0B, 0xF0, 0x00, 0xFE, 0x01, 0xFF,
-    0xC0, 0x2F, 0xC0, 0x02, 0xF4, 0x07, 0xFF, 0x00, 0xBE, 0x00, 0x01, 0x40, 0x1F, 0xFC, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC1, 0x54, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00,
-    0x07, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0xBF, 0xE0,
-    0x02, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xEA, 0xAF, 0xF0, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0xF4, 0x00, 0xBF, 0x00, 0xFF, 0xD0,
-    0x02, 0xFC, 0x03, 0xFF, 0x40, 0x07, 0xD0, 0x0F, 0xFD, 0x00, 0x04, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x94, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xE0, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0xFF, 0xC0,
-    0x00, 0x0F, 0xE0, 0x7F, 0xE0, 0x00, 0x03, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0xF8, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0x03, 0xFF, 0xC0, 0x00,
-    0x07, 0xF0, 0xBF, 0xFC, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x5A, 0x94,
-    0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0B, 0xFD, 0x00, 0x2F, 0xC3, 0xFF, 0x00, 0x0B, 0xF0,
-    0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x1A, 0x00, 0x07, 0xFF, 0x8F, 0xC0, 0x00, 0x7F, 0xE7, 0xF4,
-    0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x07, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x43,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x94, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFD, 0x05, 0x00, 0x05, 0x03, 0xFD, 0x0B, 0xF8, 0x3F, 0xF0, 0xFF, 0xC3, 0xFF, 0x0F, 0xFC,
-    0x2F, 0xD0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x56, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0xEA, 0x90, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0xFF, 0xEA, 0xFF, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xFC,
-    0x00, 0x07, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xFE,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B, 0xFD,
-    0x38, 0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xD1, 0xBF, 0xF8,
-    0x7F, 0xFF, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x3F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x5F, 0xFE,
-    0x54, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFD, 0x07, 0xFF, 0xD0, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x00,
-    0xFF, 0xD0, 0x07, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFD, 0x00, 0x7F, 0xF0, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x0F, 0xFE, 0x00,
-    0x00, 0xFF, 0xD1, 0x7F, 0xFC, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF,
-    0x43, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x9B, 0xFF,
-    0x5A, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x00,
-    0xBF, 0x00, 0x00, 0x2F, 0x40, 0x7F, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x50, 0x07, 0xFF, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x2F, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x7F, 0xC0, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0xBF, 0xFF, 0xE4, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x0B, 0xFF,
-    0xE0, 0x03, 0xFF, 0x40, 0x0F, 0xF9, 0x90, 0x03, 0xFF, 0x40, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x40,
-    0x7F, 0x80, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x41, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x97, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x41,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0x03,
-    0xFF, 0x40, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFF,
-    0x80, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFF,
-    0xC0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0x40, 0x3F, 0xEF, 0xFC, 0x00, 0x3F, 0xF4, 0x0F, 0xF5, 0xFF, 0xC0, 0x03, 0xFF, 0x43, 0xFD, 0x1F,
-    0xFC, 0x00, 0x3F, 0xF4, 0xFF, 0x41, 0xFF, 0xC0, 0x03, 0xFF, 0xBF, 0xD0, 0x1F, 0xFC, 0x00, 0x3F,
-    0xFF, 0xF4, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFF, 0x40, 0x01,
-    0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x03,
-    0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x2F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFE, 0x7F, 0xFF, 0xF4, 0x06, 0xFF,
-    0xF8, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xD0,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x00,
-    0x2F, 0xF8, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x3F, 0xC0, 0x00,
-    0x00, 0x02, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x40, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF,
-    0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0,
-    0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x00,
-    0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00,
-    0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFE, 0x40, 0x06, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00,
-    0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xEA, 0xAF,
-    0xF0, 0x03, 0xFF, 0x40, 0x0B, 0xF0, 0x03, 0xFF, 0x40, 0x07, 0xF0, 0x03, 0xFF, 0x40, 0x03, 0xE0,
-    0x03, 0xFF, 0x40, 0x02, 0x80, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xEA, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xEB, 0xFF, 0xF4, 0x03, 0xFF,
-    0x40, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x03, 0xFF, 0x40, 0x0B, 0xFD, 0x03, 0xFF, 0x40,
-    0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x81, 0xBF,
-    0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0xD0, 0x03, 0xFF,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00,
-    0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xA5, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xAB, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0xFC,
-    0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x41, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFA, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xF0, 0x0F, 0xFD, 0x00, 0x2F, 0xC0, 0x3F,
-    0xF4, 0x00, 0xBF, 0x00, 0xFF, 0xD0, 0x01, 0xF4, 0x03, 0xFF, 0x40, 0x01, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F,
-    0xE0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x0B, 0xFE,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xFE, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x02,
-    0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x82,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0xA0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01,
-    0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40,
-    0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0x00, 0x2F, 0xFF, 0x40, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x01, 0xFF,
-    0xC0, 0x03, 0xFF, 0xF0, 0x00, 0xD7, 0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x68, 0x00, 0x00, 0x3F,
-    0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xF0, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x5F, 0xFD, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0xBF, 0xFA, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x0F, 0xFC, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xC0,
-    0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFC, 0x02, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xD1, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFC, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x01,
-    0x69, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xF4, 0x02, 0xFF, 0xC0, 0x7F, 0x40, 0x03, 0xFF, 0x41, 0xFC, 0x00, 0x0F, 0xFD, 0x03,
-    0xE0, 0x00, 0x3F, 0xF0, 0x01, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x2D,
-    0x00, 0x00, 0xFF, 0xD3, 0xF8, 0x00, 0x03, 0xFF, 0x2F, 0xF4, 0x00, 0x2F, 0xFC, 0xBF, 0xF4, 0x01,
-    0xFF, 0xD1, 0xFF, 0xFE, 0xBF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x16, 0xA5, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x03,
-    0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00,
-    0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xF4, 0x03, 0xFE, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0x5F, 0xFC, 0x00, 0x3F, 0xF4, 0x3F,
-    0xD1, 0xFF, 0xC0, 0x03, 0xFF, 0x4F, 0xF4, 0x1F, 0xFC, 0x00, 0x3F, 0xFB, 0xFD, 0x01, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xF4,
-    0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC,
-    0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00,
-    0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF4, 0x00,
-    0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0x40, 0x3F, 0xEF, 0xFC, 0x00, 0x3F, 0xF4, 0x0F, 0xF5, 0xFF, 0xC0, 0x03, 0xFF, 0x43,
-    0xFD, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0xFF, 0x41, 0xFF, 0xC0, 0x03, 0xFF, 0xBF, 0xD0, 0x1F, 0xFC,
-    0x00, 0x3F, 0xFF, 0xF4, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFF,
-    0x40, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF,
-    0xC0, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0xBF, 0xFF, 0xE4,
-    0x03, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x0B, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x0F, 0xF9, 0x90, 0x03,
-    0xFF, 0x40, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x41, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x97, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0x43, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x40,
-    0x1F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x57, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0x80, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xF8,
-    0x03, 0xFF, 0x40, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xFD, 0x00, 0x00,
-    0x2F, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x3F,
-    0xF4, 0x03, 0x83, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xFF,
-    0x00, 0x1B, 0xFF, 0xFE, 0x1F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0xF4, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xE0, 0x00, 0x03, 0xF7, 0xFE, 0x00, 0xFD, 0xFF, 0xC0, 0x00, 0x0F, 0xDB,
-    0xFC, 0x03, 0xF3, 0xFF, 0x00, 0x00, 0x7F, 0x5F, 0xF0, 0x2F, 0xCF, 0xFC, 0x00, 0x01, 0xFC, 0x3F,
-    0xD0, 0xFE, 0x2F, 0xF0, 0x00, 0x0B, 0xF0, 0xFF, 0xC3, 0xF0, 0xBF, 0xC0, 0x00, 0x2F, 0xC1, 0xFF,
-    0x1F, 0xC2, 0xFF, 0x40, 0x00, 0xFF, 0x03, 0xFD, 0xBE, 0x07, 0xFD, 0x00, 0x03, 0xFC, 0x0F, 0xFB,
-    0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x3F, 0xFE,
-    0x00, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x00, 0x1F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xA0, 0x1F, 0xC0, 0x1F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFD, 0x00, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0x40, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE2, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4,
-    0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC,
-    0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x3F, 0xF9, 0x55, 0x57, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00,
-    0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40,
-    0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40,
-    0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x55, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x42, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x3F,
-    0xF4, 0x02, 0xFF, 0xC0, 0xFF, 0xD0, 0x07, 0xFF, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x0F, 0xFD, 0x00,
-    0xBF, 0xE0, 0x3F, 0xF4, 0x03, 0xFF, 0x40, 0xFF, 0xD0, 0x3F, 0xFC, 0x03, 0xFF, 0xAF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFA, 0x40, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00,
-    0x03, 0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00,
-    0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x8F, 0xFA, 0x5F, 0xFE, 0x6B, 0xFD, 0x3F, 0xC0, 0x3F, 0xF4, 0x07, 0xF4, 0xFE, 0x00,
-    0xFF, 0xD0, 0x1F, 0xD3, 0xF4, 0x03, 0xFF, 0x40, 0x7F, 0x02, 0x80, 0x0F, 0xFD, 0x00, 0xA4, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0xBF, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xF4, 0x06, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x02, 0xFF,
-    0xC0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFD, 0x00,
-    0x00, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x0F,
-    0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFE, 0x7F, 0xF6, 0xFF, 0xF0, 0x2F, 0xF8, 0x0F, 0xF8, 0x1F, 0xFE, 0x0F, 0xFC,
-    0x03, 0xFE, 0x01, 0xFF, 0xCB, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xF7, 0xFF, 0x40, 0x3F, 0xE0, 0x0B,
-    0xFD, 0xFF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x6F, 0xF4, 0x03, 0xFE, 0x00, 0xBF, 0xDB, 0xFE, 0x00,
-    0xFF, 0x80, 0x3F, 0xF0, 0xFF, 0xD0, 0x3F, 0xE0, 0x2F, 0xF8, 0x2F, 0xFE, 0x0F, 0xF8, 0x2F, 0xFC,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF,
-    0xFE, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xAA, 0xAA,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xFC, 0x00,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFC,
-    0x02, 0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xE4, 0x06, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0,
-    0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4,
-    0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F,
-    0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x3F,
-    0xF9, 0x00, 0x1B, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x4B,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x01,
-    0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFD, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06,
-    0xA9, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xF4, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xDB, 0xFF, 0xFE, 0x0B, 0xFF, 0xFE, 0x0B, 0xFF, 0xFE,
-    0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07,
-    0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0,
-    0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xD4, 0x00,
-    0xFF, 0xC0, 0x06, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xF4, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xF4, 0xBF, 0xFF, 0xE0, 0xBF, 0xFF, 0xE0, 0xBF, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x07, 0xFF,
-    0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE,
-    0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x50, 0x03, 0xFF,
-    0x00, 0x1B, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xA5, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x0F,
-    0xFD, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x28, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFA, 0xBF, 0xFF, 0x00,
-    0x00, 0x0F, 0xFD, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xD0,
-    0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0xE0, 0x00,
-    0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD1, 0xBF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xEA, 0x50,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x9B, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x3F,
-    0xF8, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x0F,
-    0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x1F,
-    0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x3F, 0xF8, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x85, 0xFF,
-    0xF0, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0xEA, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0x9A, 0xFF, 0xF4, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x03,
-    0xFF, 0x40, 0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x03, 0xFF,
-    0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x81, 0xBF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x3F, 0xF4, 0x06, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x1F, 0xFF, 0x03, 0xFC, 0x00, 0x02, 0xFF,
-    0xC0, 0xBE, 0x00, 0x00, 0x3F, 0xF8, 0x0B, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x02, 0xC0, 0x00, 0x03, 0xFF, 0x43, 0xF4, 0x00, 0x02, 0xFF, 0xC2,
-    0xFF, 0x00, 0x01, 0xFF, 0xD0, 0xBF, 0xF4, 0x02, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x16, 0x94, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x94, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xD0, 0x7F, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x2F,
-    0xFC, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0xFF, 0xD0,
-    0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xF0, 0x0F,
-    0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x7F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF4, 0x0B, 0xFF, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xD0, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x40, 0x7F,
-    0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF4,
-    0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x03,
-    0xFF, 0x40, 0x0F, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFE, 0x42,
-    0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xF4,
-    0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x07,
-    0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0xBF,
-    0xD0, 0x00, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xD0,
-    0x2F, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x0F, 0xFF,
-    0x40, 0x7F, 0xFF, 0xE0, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xD7, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x41,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B,
-    0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7,
-    0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xAB, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x15, 0x00, 0x03, 0xFE, 0xBF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xF4, 0x07, 0xFF, 0x8F, 0xFD,
-    0x00, 0x1F, 0xFC, 0xFF, 0xD0, 0x00, 0xFF, 0xDF, 0xFD, 0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xFF,
-    0xDB, 0xFE, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xF8,
-    0x01, 0xFF, 0x81, 0xFF, 0xD0, 0x7F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x05, 0x5A, 0xA9, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xF4, 0x6F, 0xFC, 0x07, 0xFC, 0x02, 0xFF, 0x01, 0xFF,
-    0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x1F, 0xF5, 0x4B, 0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xD5, 0xBF, 0xF4, 0x1F, 0xF0, 0x03, 0xFF, 0x07, 0xFC, 0x00, 0xFF,
-    0xC1, 0xFF, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x1F, 0xF8, 0x7F, 0xFA, 0xBF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x07, 0xFE, 0x01, 0xFD, 0x07, 0xFE,
-    0x00, 0xFD, 0x07, 0xFE, 0x00, 0xFC, 0x07, 0xFE, 0x00, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xA4, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xAB, 0xFF, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xF4, 0x00, 0x00, 0xBE,
-    0x02, 0xFF, 0x40, 0x00, 0x0B, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x0F,
-    0xD0, 0x2F, 0xF4, 0x00, 0x00, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0xC0, 0x2F, 0xF4, 0x00, 0x02,
-    0xFC, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0x40, 0x2F, 0xF4, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0x40, 0x00,
-    0xFE, 0x00, 0x2F, 0xF4, 0x01, 0xBF, 0xFE, 0xBF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x02, 0xFD,
-    0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xC2, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0x0F,
-    0x80, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0,
-    0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5,
-    0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE,
-    0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05,
-    0x54, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x3F,
-    0xE0, 0x1F, 0xFE, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xF0, 0x0B, 0xFD, 0x02, 0xFF, 0xF0,
-    0x09, 0xBF, 0xC0, 0x7F, 0xC0, 0x3F, 0xD6, 0x00, 0x01, 0xFD, 0x07, 0xFC, 0x0B, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x7F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD,
-    0xBF, 0xD7, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x07, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x7F,
-    0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x7F, 0xC0,
-    0x3F, 0xF4, 0x00, 0xBF, 0xF0, 0x0B, 0xFE, 0x02, 0xFF, 0xC0, 0x2F, 0xFE, 0x03, 0xFF, 0xFC, 0x0F,
-    0xFF, 0x43, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x3F, 0xF8, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x16, 0xA9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFC, 0x1F, 0xF9, 0x7F,
-    0xFC, 0x1F, 0x80, 0x0F, 0xFD, 0x05, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x15, 0x6F,
-    0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0A, 0xBF, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0x07, 0x00, 0x03, 0xFF, 0x2F, 0x80, 0x03, 0xFF, 0x3F, 0xD0, 0x0B, 0xFD, 0x3F, 0xFE, 0xBF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x3F, 0xFF, 0xEF, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x7F, 0xF8, 0x00,
-    0xBF, 0xE0, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x7F, 0xD0, 0x1F,
-    0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFF, 0xD0, 0x07, 0xFD, 0x1F, 0xEF, 0xF4, 0x01, 0xFF, 0x5F, 0xD7,
-    0xFD, 0x00, 0x7F, 0xEF, 0xC1, 0xFF, 0x40, 0x1F, 0xFF, 0xC0, 0x7F, 0xD0, 0x07, 0xFF, 0xC0, 0x1F,
-    0xF4, 0x01, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0xBF,
-    0xF8, 0xBF, 0xFF, 0xC0, 0xFF, 0xFF, 0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0x04, 0x00, 0x14,
-    0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xF4, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x03, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xEF, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0xBF, 0xE0, 0x07, 0xFD, 0x00, 0x1F, 0xF4,
-    0x01, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x7F, 0xD0, 0x1F, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFF, 0xD0,
-    0x07, 0xFD, 0x1F, 0xEF, 0xF4, 0x01, 0xFF, 0x5F, 0xD7, 0xFD, 0x00, 0x7F, 0xEF, 0xC1, 0xFF, 0x40,
-    0x1F, 0xFF, 0xC0, 0x7F, 0xD0, 0x07, 0xFF, 0xC0, 0x1F, 0xF4, 0x01, 0xFF, 0xC0, 0x07, 0xFD, 0x00,
-    0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0xBF, 0xFF, 0xC0, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x80, 0xBF, 0xFF, 0xC0, 0x2F, 0xF0, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xF4, 0x1F, 0xFE, 0x00, 0xFF, 0xF4, 0x07, 0xFD, 0x02, 0xFE, 0x60, 0x07, 0xFD,
-    0x07, 0xF8, 0x00, 0x07, 0xFD, 0x0F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x6F, 0xF0, 0x00, 0x07, 0xFD, 0x0F, 0xFC,
-    0x00, 0x07, 0xFD, 0x0B, 0xFD, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x07, 0xFD, 0x02, 0xFF, 0xC0,
-    0x1F, 0xFE, 0x40, 0xFF, 0xE0, 0xBF, 0xFF, 0xC0, 0x7F, 0xF8, 0xFF, 0xFF, 0xC0, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xEA, 0xFF, 0xD0, 0x00, 0x0F, 0xD0, 0x3F, 0xF0, 0x00, 0x03,
-    0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xC0, 0x3F, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xFC, 0x00, 0x02, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0xFD,
-    0x00, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x09, 0x2F, 0xC0, 0x0F, 0xFC, 0x03, 0xFF, 0xE0,
-    0x03, 0xFF, 0x02, 0xFF, 0xF0, 0x06, 0xFF, 0xE4, 0xBF, 0xF4, 0x0F, 0xFF, 0xFF, 0x1F, 0xF4, 0x03,
-    0xFF, 0xFF, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0xFF, 0xFD, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xFD, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xE0,
-    0x07, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x07, 0xFB, 0xF4, 0x1F,
-    0xBF, 0xD0, 0x07, 0xF7, 0xFC, 0x3F, 0x3F, 0xD0, 0x07, 0xF2, 0xFC, 0x7E, 0x3F, 0xD0, 0x07, 0xF1,
-    0xFE, 0xFC, 0x3F, 0xD0, 0x07, 0xF0, 0xFF, 0xF8, 0x3F, 0xD0, 0x07, 0xF0, 0x7F, 0xF4, 0x3F, 0xD0,
-    0x07, 0xF0, 0x3F, 0xF0, 0x3F, 0xD0, 0x07, 0xF0, 0x2F, 0xD0, 0x3F, 0xD0, 0x07, 0xF0, 0x0F, 0xC0,
-    0x3F, 0xD0, 0x0F, 0xF8, 0x04, 0x00, 0x7F, 0xE4, 0xBF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0xBF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0xBF, 0xF4, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x01, 0xFF,
-    0x40, 0x07, 0xFE, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x7F, 0xE0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFA, 0xAB, 0xFF, 0x80, 0x1F, 0xF4,
-    0x00, 0x7F, 0xE0, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x7F, 0xD0,
-    0x01, 0xFF, 0x80, 0x7F, 0xFD, 0x00, 0xBF, 0xF9, 0xBF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xF0, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0,
-    0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE,
-    0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40,
-    0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFE,
-    0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x1F, 0xF8,
-    0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x80,
-    0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0xBF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x69, 0x01, 0xA9, 0x00, 0x2F, 0xFD, 0x3F,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xD0, 0xBF,
-    0xFC, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD,
-    0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x03, 0xFF,
-    0x40, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0x95, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x01, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0xEF, 0xFE, 0x1F, 0xF8, 0x0F, 0xFC, 0xFF, 0xC0, 0x2F,
-    0xE7, 0xFE, 0x00, 0x7F, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xF9, 0x5B, 0xC7, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xC1, 0xFF, 0x81, 0xFC, 0x3F, 0x81, 0xFF, 0x81, 0xFC,
-    0x3F, 0x41, 0xFF, 0x81, 0xFC, 0x1F, 0x01, 0xFF, 0x80, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF,
-    0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00,
-    0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0,
-    0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0B,
-    0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x24, 0x03, 0xFE, 0x00, 0x00, 0x07,
-    0xE6, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xE0, 0x1F, 0xFD, 0x1F, 0xF0, 0xBF, 0xF4, 0x3F, 0xF0, 0x1F, 0xF0, 0x1F, 0xFC, 0x7F,
-    0xE0, 0x1F, 0xF0, 0x0F, 0xFD, 0xBF, 0xD0, 0x1F, 0xF0, 0x0B, 0xFD, 0xBF, 0xC0, 0x1F, 0xF0, 0x07,
-    0xFE, 0xFF, 0xC0, 0x1F, 0xF0, 0x07, 0xFE, 0xFF, 0xC0, 0x1F, 0xF0, 0x07, 0xFE, 0xBF, 0xD0, 0x1F,
-    0xF0, 0x0B, 0xFD, 0x7F, 0xF0, 0x1F, 0xF0, 0x0F, 0xFC, 0x3F, 0xF4, 0x1F, 0xF0, 0x2F, 0xF8, 0x1F,
-    0xFE, 0x1F, 0xF0, 0xBF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0x83, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xC0, 0x7F,
-    0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xD7, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0xBF, 0xE0,
-    0x00, 0x2F, 0xF0, 0x0F, 0xFD, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0xE4, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF,
-    0x2F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x41, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x03,
-    0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0,
-    0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFE, 0x1F, 0xFF, 0x00, 0xBF, 0xF4, 0x07, 0xFE,
-    0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00,
-    0x7F, 0xE0, 0x03, 0xFF, 0x40, 0x7F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xCF, 0xFF, 0xF8, 0xFF, 0xFF, 0x2F, 0xFF, 0xF0, 0x7F, 0xF4, 0x0B, 0xFE, 0x01, 0xFF,
-    0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00,
-    0x7F, 0xC0, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x0F,
-    0xF4, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x03, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0xFF, 0xFF, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F, 0xFF, 0xF2, 0xFF, 0xFF, 0x01, 0xFF, 0xD0,
-    0x2F, 0xF8, 0x07, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F,
-    0xF4, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF4,
-    0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x03,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x03, 0xFE,
-    0x00, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x03, 0xFE, 0x00,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF9, 0x00,
-    0x00, 0x3F, 0x81, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0x40,
-    0x00, 0x01, 0xF0, 0x1F, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x01, 0xFF,
-    0x40, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x7F,
-    0xFE, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x87, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xE0, 0x07,
-    0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0xBF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x02, 0xFF,
-    0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFD, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x2F, 0xF4, 0x01, 0xFF,
-    0x40, 0xBF, 0xC0, 0xBF, 0xD0, 0x07, 0xFD, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0x1F, 0xF4, 0x0B, 0xFC,
-    0x0B, 0xFD, 0x00, 0x7F, 0xD0, 0x3F, 0xE0, 0x2F, 0xF4, 0x07, 0xFF, 0xEF, 0xFF, 0x01, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-    0x7F, 0xD0, 0x3F, 0xF0, 0x1F, 0xF4, 0x0B, 0xFC, 0x07, 0xFD, 0x01, 0xFF, 0x01, 0xFF, 0x40, 0xBF,
-    0xC0, 0x7F, 0xD0, 0x3F, 0xF0, 0x7F, 0xFE, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xEA, 0xFF, 0xF8, 0x1F, 0x80, 0x0B, 0xFF, 0x02, 0x40, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x55, 0x5B, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0xA9, 0x6F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x07, 0x00, 0x02, 0xFF, 0x4B, 0xE0, 0x00,
-    0xFF, 0xC3, 0xFD, 0x00, 0xBF, 0xD0, 0xFF, 0xFA, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0xBF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0xBF, 0xF4, 0x07, 0xFD, 0x02, 0xFF, 0x00, 0x3F,
-    0xF8, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x07, 0xFE, 0x57, 0xFE, 0x00, 0x0F, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0xAF,
-    0xFF, 0x00, 0x0F, 0xFC, 0x07, 0xFD, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x07, 0xFD, 0x03, 0xFF, 0x00,
-    0x1F, 0xF8, 0x07, 0xFD, 0x03, 0xFF, 0x80, 0x2F, 0xF0, 0x07, 0xFD, 0x02, 0xFF, 0xD0, 0x7F, 0xE0,
-    0x1F, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xF9, 0xBF, 0xF4, 0x03,
-    0xFF, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x3F, 0xE0, 0x02, 0xFF, 0xE5, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x2F,
-    0xF4, 0x0F, 0xF8, 0x02, 0xFF, 0xC0, 0xBF, 0xF9, 0x2F, 0xFC, 0x0B, 0xFF, 0xFD, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xF0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F,
-    0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x0B, 0xF0, 0x07, 0xFD, 0x1F, 0xF4, 0x07, 0xFD, 0x2F, 0xF4, 0x03, 0xFC, 0x0F, 0xF0, 0x00,
-    0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F,
-    0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x6B, 0xFF, 0xAA, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x6B, 0xFF, 0xAA, 0x80, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x06, 0xFE, 0x00, 0x03, 0xFF,
-    0x7F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xD0,
-    0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x0F,
-    0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFD,
-    0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFF, 0x90, 0x0F, 0xFC, 0x3F,
-    0xFF, 0xF0, 0x0F, 0xFC, 0x3F, 0xFF, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x5B,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x07, 0xFE, 0x01, 0xFD, 0x07, 0xFE, 0x00,
-    0xFD, 0x07, 0xFE, 0x00, 0xFC, 0x07, 0xFE, 0x00, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xA4, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x06, 0xA9, 0x40, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x5B,
-    0xFF, 0x2F, 0xF0, 0x01, 0xFE, 0x3F, 0xE0, 0x00, 0xF8, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6E, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x1A, 0xA4,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0x07, 0xFD, 0x07, 0xFC, 0x2F, 0xE0, 0x07, 0xF0,
-    0xFF, 0x80, 0x0F, 0x83, 0xFF, 0xD0, 0x14, 0x0B, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x2E, 0x00, 0x7F, 0xF5, 0xFC, 0x00,
-    0x7F, 0xD7, 0xF4, 0x01, 0xFF, 0x1F, 0xFD, 0x6F, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
-    0xC0, 0x02, 0xFF, 0x80, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xBF,
-    0x42, 0xFD, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF,
-    0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFC, 0x00, 0x01, 0x50, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFC,
-    0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0x00, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0xD0, 0x2F, 0xFF,
-    0x80, 0x1F, 0xFD, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xAF, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xC0, 0xBF, 0xFF,
-    0xFF, 0x40, 0x01, 0xFC, 0x0B, 0xFF, 0xBF, 0xFC, 0x00, 0x2F, 0x80, 0xBF, 0xC0, 0xBF, 0xD0, 0x03,
-    0xF4, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x3F, 0x00, 0xBF, 0xC0, 0x3F, 0xE2, 0x4F, 0xF0, 0x0B, 0xFC,
-    0x03, 0xFE, 0x3F, 0xFE, 0x00, 0xBF, 0xC0, 0xBF, 0xDB, 0xFF, 0xC0, 0x1F, 0xFE, 0xBF, 0xFC, 0xBF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x07, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0x95, 0x5B, 0xFF, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xD0, 0x7F, 0xFA, 0xAB, 0xFF, 0x41, 0xFF, 0x81, 0xFF, 0x40,
-    0x0B, 0xFD, 0x03, 0xFF, 0x07, 0xFD, 0x00, 0x2F, 0xF4, 0x0B, 0xFC, 0x1F, 0xF4, 0x00, 0xBF, 0xD0,
-    0x3F, 0xF0, 0x7F, 0xD0, 0x02, 0xFF, 0x41, 0xFF, 0x87, 0xFF, 0xD0, 0x1F, 0xFE, 0xAF, 0xFC, 0xBF,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x06,
-    0xBF, 0xFA, 0xA8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xBF, 0xFA, 0xA8, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x06, 0xFE, 0x40,
-    0x00, 0x3F, 0xF7, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xD0, 0x3F, 0xFC, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0xBF, 0xF9, 0x02, 0xFF, 0xE4, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0xBF, 0xFF, 0xC0, 0x2F, 0xF0, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xF4, 0x1F, 0xFE, 0x00, 0xFF, 0xF4, 0x07, 0xFD, 0x02, 0xFE, 0x60, 0x07, 0xFD,
-    0x07, 0xF8, 0x00, 0x07, 0xFD, 0x0F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x6F, 0xF0, 0x00, 0x07, 0xFD, 0x0F, 0xFC,
-    0x00, 0x07, 0xFD, 0x0B, 0xFD, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x07, 0xFD, 0x02, 0xFF, 0xC0,
-    0x1F, 0xFE, 0x40, 0xFF, 0xE0, 0xBF, 0xFF, 0xC0, 0x7F, 0xF8, 0xFF, 0xFF, 0xC0, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFE, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x87, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x7F, 0xD0,
-    0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x01, 0xFF, 0xD0, 0x07, 0xFD, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0x41,
-    0xFF, 0xFD, 0x00, 0x7F, 0xD1, 0xFE, 0xFF, 0x40, 0x1F, 0xF5, 0xFD, 0x7F, 0xD0, 0x07, 0xFE, 0xFC,
-    0x1F, 0xF4, 0x01, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0x40, 0x1F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x07, 0xFF, 0x80, 0x0B, 0xFF, 0x8B, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFB, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x07, 0xF0, 0x0B,
-    0xE0, 0x00, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F,
-    0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00,
-    0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00,
-    0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x24, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xE6, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0xBF, 0xFF, 0xEF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xF4, 0x7F, 0xF8, 0x01, 0xFF, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F,
-    0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF,
-    0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x01, 0xFF, 0x40, 0x3F, 0x83, 0xF4, 0x07, 0xFD, 0x00, 0xFE, 0x0B,
-    0xD0, 0x1F, 0xF4, 0x02, 0xF4, 0x0A, 0x00, 0x7F, 0xD0, 0x0A, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0x81, 0xFF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xE0, 0x00, 0x1F,
-    0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x00,
-    0x07, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xF8, 0x1F, 0xFF, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xEA, 0xFF, 0xEA, 0xFD, 0x03, 0xF0, 0x3F, 0xF0, 0x2F, 0x40, 0xFC, 0x0F, 0xFC, 0x0B,
-    0xC0, 0x09, 0x03, 0xFF, 0x00, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xAF, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x00, 0x3F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x02, 0xFF,
-    0x00, 0x02, 0xFF, 0xDB, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF4,
-    0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF4, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xE4, 0x0B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xD5, 0xBF, 0xF4, 0x1F, 0xF0,
-    0x01, 0xFF, 0xC3, 0xFE, 0x00, 0x0F, 0xFD, 0x7F, 0xC0, 0x00, 0x7F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA, 0xAA, 0xBF, 0xEB, 0xFC, 0x00,
-    0x03, 0xFD, 0xBF, 0xD0, 0x00, 0x7F, 0xC7, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xF8, 0x01, 0xFF, 0x41,
-    0xFF, 0xFA, 0xBF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x7F,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xE3, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0xD0, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x5C, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00,
-    0x0F, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40,
-    0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xD0, 0x00,
-    0x00, 0x0F, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x47, 0xFF, 0xFF, 0x80, 0x0B, 0xFD,
-    0x3F, 0xFF, 0xF4, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0x80, 0x07, 0xFF,
-    0xE0, 0x2F, 0xFC, 0x00, 0xFF, 0x48, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x02, 0xFD,
-    0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0xBF,
-    0x00, 0x00, 0x00, 0xFF, 0xCF, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x2F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xE0, 0x03,
-    0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x03, 0xFE, 0xFF, 0xC0, 0x00, 0xFF,
-    0xD0, 0x3F, 0xD7, 0xFF, 0x00, 0x03, 0xFF, 0x43, 0xFD, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x3F, 0xD0,
-    0x7F, 0xF0, 0x00, 0x3F, 0xFB, 0xFD, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFD,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1F,
-    0xFC, 0x00, 0x7F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0,
-    0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0x41, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0xC0,
-    0x07, 0xFF, 0x40, 0x0B, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0x7F, 0xFF, 0x40, 0x0B, 0xFC,
-    0x2F, 0xEF, 0xF4, 0x00, 0xBF, 0xCB, 0xF1, 0xFF, 0x40, 0x0B, 0xFE, 0xFC, 0x1F, 0xF4, 0x00, 0xBF,
-    0xFF, 0x01, 0xFF, 0x40, 0x0B, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0xBF, 0xF0, 0x01, 0xFF, 0x40, 0x0B,
-    0xFC, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xE4, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0xEA, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0x9A, 0xFF, 0xF4, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03, 0xFF, 0x40, 0x0F,
-    0xFD, 0x03, 0xFF, 0x40, 0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFC,
-    0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x81, 0xBF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFE, 0xFF, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0xC0, 0x2F, 0xF0, 0x0F, 0xFC, 0x02,
-    0xFF, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x0F, 0xFC, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0xBF, 0xFA, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0x42, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x02, 0xFF,
-    0xC0, 0xFF, 0xD0, 0x07, 0xFF, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x0F, 0xFD, 0x28, 0xBF, 0xE0, 0x3F,
-    0xF5, 0xF7, 0xFF, 0x40, 0xFF, 0xD2, 0xFF, 0xFC, 0x03, 0xFF, 0xAF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFA, 0x4F, 0xC0, 0x03, 0xFF, 0x40, 0x0E, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x69, 0x01, 0xA9, 0x00, 0x2F, 0xFD, 0x3F, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xD0, 0xBF, 0xFC, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03,
-    0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF,
-    0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x06, 0x0F, 0xFC, 0x03, 0xFF, 0x0F,
-    0x4F, 0xFC, 0x03, 0xFF, 0x0B, 0xEF, 0xF8, 0x03, 0xFF, 0x43, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x95, 0x5F, 0x00,
-    0x03, 0xFF, 0x00, 0x0B, 0x80, 0x03, 0xFF, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xCB, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xEA, 0xAA, 0x40, 0x3F, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFE, 0x07,
-    0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFF, 0xE9, 0x00, 0xBF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFA, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xF0, 0x0F, 0xFD, 0x00, 0x2F,
-    0xC0, 0x3F, 0xF4, 0x00, 0xBF, 0x00, 0xFF, 0xD0, 0x01, 0xF4, 0x03, 0xFF, 0x40, 0x01, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x05, 0x7F, 0xF9, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x80, 0x3F, 0x40, 0x7F, 0xE0, 0x0F, 0xD0, 0x1F, 0xF8, 0x03, 0xF0,
-    0x07, 0xFE, 0x00, 0x78, 0x16, 0xFF, 0x94, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFF, 0xA4, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x3F, 0xF9, 0x6A, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0xFD, 0x00,
-    0x03, 0xFF, 0x40, 0x0B, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x10, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF8, 0x06, 0xFF, 0xF4, 0x03, 0xFF, 0x40, 0x07,
-    0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x3F, 0xF4, 0x00,
-    0x0F, 0xFD, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x0F, 0xFD, 0x1F, 0xFF, 0xF8,
-    0x00, 0xFF, 0xCB, 0xFF, 0xFF, 0xC0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xAA, 0xBF, 0x40, 0x07, 0xFC, 0x00, 0xBD, 0x00, 0x1F, 0xF0, 0x01, 0xF0,
-    0x00, 0x7F, 0xC0, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xBF, 0x90, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x40, 0xBF, 0xF4, 0x07, 0xFC, 0x00,
-    0xBF, 0xE0, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0x07, 0xFF, 0x90, 0x0F, 0xFC,
-    0xBF, 0xFF, 0xC0, 0x2F, 0xF3, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80,
-    0x0F, 0xF4, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0xBF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0xD7,
-    0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x68, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xC0,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x5F, 0xFD, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0xBF, 0xFA, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x0F, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x07,
-    0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x40, 0xBF, 0xFC, 0x02, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xD1, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFD, 0x06, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x3F, 0xE0, 0x1F, 0xFE,
-    0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xF0, 0x0B, 0xFD, 0x02, 0xFF, 0xF0, 0x09, 0xBF, 0xC0,
-    0x7F, 0xC0, 0x3F, 0xD6, 0x00, 0x01, 0xFD, 0x07, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x7F,
-    0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xD7, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0x07, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFD, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xF4, 0x00,
-    0xBF, 0xF0, 0x0B, 0xFE, 0x02, 0xFF, 0xC0, 0x2F, 0xFE, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF,
-    0x80, 0x3F, 0xFF, 0xC0, 0x3F, 0xFC, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x01, 0x69, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xF4, 0x02, 0xFF, 0xC0, 0x7F, 0x40, 0x03, 0xFF, 0x41,
-    0xFC, 0x00, 0x0F, 0xFD, 0x03, 0xE0, 0x00, 0x3F, 0xF0, 0x01, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x2D, 0x00, 0x00, 0xFF, 0xD3, 0xF8, 0x00, 0x03, 0xFF, 0x6F, 0xF4, 0x00,
-    0x2F, 0xFC, 0xBF, 0xF4, 0x01, 0xFF, 0xD1, 0xFF, 0xFE, 0xBF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x16, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0E, 0x5F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xA9, 0x00, 0x01,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFC, 0x1F, 0xF9, 0x7F, 0xFC, 0x1F, 0x80, 0x0F, 0xFD, 0x05,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x15, 0x6F, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0x0A, 0xBF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x07, 0x00, 0x03, 0xFF, 0x2F,
-    0x80, 0x03, 0xFF, 0x3F, 0xD0, 0x0B, 0xFD, 0x3F, 0xFE, 0xBF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x17, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x02,
-    0xEB, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xE0, 0xBF, 0xFF, 0xE4, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x0B, 0xFF, 0xE0, 0x03, 0xFF, 0x40,
-    0x0F, 0xF9, 0x90, 0x03, 0xFF, 0x40, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0x03,
-    0xFF, 0x40, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x41, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x97, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xAB,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x40, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xFC,
-    0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0xF8,
-    0x03, 0xFF, 0xE0, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x06, 0x80, 0xBF, 0xFF,
-    0xC0, 0x2F, 0xF0, 0xFF, 0xFF, 0xC0, 0xBF, 0xF4, 0x1F, 0xFE, 0x00, 0xFF, 0xF4, 0x07, 0xFD, 0x02,
-    0xFE, 0x60, 0x07, 0xFD, 0x07, 0xF8, 0x00, 0x07, 0xFD, 0x0F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x6F, 0xF0, 0x00,
-    0x07, 0xFD, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x0B, 0xFD, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x07,
-    0xFD, 0x02, 0xFF, 0xC0, 0x1F, 0xFE, 0x40, 0xFF, 0xE0, 0xBF, 0xFF, 0xC0, 0x7F, 0xF8, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0x40, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFC, 0x0B, 0xFF, 0xFE, 0x40, 0x0B, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0xFF,
-    0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xE6, 0x80, 0x03, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0xF4, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0xF1, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0x5F, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFA, 0xFB, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0x2F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF4, 0xF1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4F, 0x0F, 0xFE, 0x00, 0x00,
-    0x3F, 0xF4, 0xF0, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00,
-    0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xD0,
-    0xBF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x4F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0x0F, 0xFF,
-    0xF4, 0x01, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x7F, 0x98, 0x01, 0xFF,
-    0x28, 0x3F, 0x40, 0x00, 0x7F, 0xCF, 0x0F, 0xC0, 0x00, 0x1F, 0xF3, 0xCB, 0xD0, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xDF, 0x7F, 0xC0, 0x00, 0x1F, 0xF3,
-    0xC7, 0xFC, 0x00, 0x07, 0xFC, 0xF0, 0xFF, 0x40, 0x01, 0xFF, 0x14, 0x2F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x03, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xE0, 0xBF, 0xFF, 0x80, 0x0F, 0xFD, 0x3F, 0xFF, 0xE0,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xBF, 0xFF,
-    0xFD, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0xBF, 0xFF, 0xE4, 0x03, 0xFF, 0xE0,
-    0x03, 0xFF, 0x40, 0x0B, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x0F, 0xF9, 0x90, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xD0, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x96, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0x40, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0xBF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x1A, 0x01, 0xFF, 0xFF, 0xE0, 0x3F, 0xF0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0xBF, 0xC0,
-    0x1F, 0xFF, 0x00, 0x2F, 0xF0, 0x0F, 0xF9, 0x80, 0x0B, 0xFC, 0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x03,
-    0xF8, 0x00, 0x00, 0xBF, 0xC2, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0xC1, 0xFF, 0x80, 0x00, 0x2F, 0xF0, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0xE0, 0x02, 0xFF, 0xE0, 0x1F,
-    0xFE, 0x07, 0xFF, 0xFE, 0x02, 0xFF, 0xE2, 0xFF, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE4, 0x07, 0xFF, 0xD0, 0x3F,
-    0xE9, 0xFF, 0xD0, 0x03, 0xFF, 0xF0, 0x0F, 0xF0, 0x3F, 0xF4, 0x02, 0xFF, 0x5C, 0x03, 0xF8, 0x0F,
-    0xFD, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x03, 0xFF, 0x40, 0xBF, 0x40, 0x00, 0x0A, 0x00, 0xFF, 0xD0,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x5F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFA, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x42, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x7F,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xD0, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xF4, 0x3F, 0x81, 0xFF, 0x40, 0xBF, 0x98, 0x0F, 0xD0, 0x7F, 0xD0, 0x7F, 0x80, 0x03, 0xF0, 0x1F,
-    0xF4, 0x3F, 0xC0, 0x00, 0x7C, 0x07, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFD,
-    0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x42, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0,
-    0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0xBF,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF4,
-    0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xBF,
-    0xFF, 0xF8, 0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0x81, 0xFF, 0xE0, 0x02, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xAA, 0xBF, 0xF8, 0x00, 0x7F, 0xD0,
-    0x01, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x80, 0x07, 0xFD,
-    0x00, 0x1F, 0xF8, 0x01, 0xFF, 0xF4, 0x02, 0xFF, 0xF9, 0xBF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xE0, 0x00,
-    0x07, 0xFF, 0xAB, 0xFD, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x07, 0xF4, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF0, 0x1F, 0xD0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0x00, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0x00, 0xA4, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x2F, 0xC0, 0x7F, 0xD0, 0x01, 0xFF, 0x81, 0xFC, 0x07,
-    0xFD, 0x00, 0x1F, 0xF8, 0x1F, 0x80, 0x7F, 0xD0, 0x01, 0xFF, 0x81, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xAA, 0xBF, 0xF8, 0x00, 0x00,
-    0x7F, 0xD0, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xF4, 0x02, 0xFF, 0xE4, 0x00,
-    0xBF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x02,
-    0xFF, 0x9A, 0xA9, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFD, 0x00, 0x02, 0xFF, 0x80, 0x1F, 0xFF, 0x40, 0x3F, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFF,
-    0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00,
-    0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x3F, 0xF4, 0x00, 0x0B, 0xFE,
-    0x00, 0x03, 0xFF, 0x40, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x1F, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFE, 0x00, 0x3F, 0xF2, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xC1, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0x85, 0xA4, 0x00, 0x07, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x03,
-    0xFF, 0xE6, 0xFF, 0xE0, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x07, 0xFD, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x41, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x7F, 0xF9, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xBF, 0xFF, 0xC2, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2B,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x19, 0x40, 0x00, 0x01, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x0F, 0xF9, 0xFF, 0xD0,
-    0x07, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x2F, 0xF8, 0x07, 0xFD, 0x02, 0xFF, 0x40, 0xFF, 0xD0,
-    0x2F, 0xF0, 0x07, 0xFE, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x1F, 0xFC, 0x03, 0xFF, 0x00,
-    0x7F, 0xF0, 0xBF, 0xF0, 0x0F, 0xFC, 0x01, 0xFF, 0xC2, 0xFF, 0xC0, 0x3F, 0xF0, 0x07, 0xFE, 0x0B,
-    0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x0B,
-    0xFD, 0x03, 0xFF, 0x00, 0xFF, 0xF0, 0x0F, 0xF8, 0x1F, 0xF4, 0x01, 0xFF, 0xD0, 0x2F, 0xF0, 0xBF,
-    0xC0, 0x03, 0xFF, 0xC0, 0x3F, 0xF7, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x7F, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xF9, 0xFF, 0xFE, 0x05, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xEB, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x55, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x14, 0x00, 0x00, 0xBF, 0xD0, 0x2F, 0xFE, 0x00,
-    0x1F, 0xF4, 0x1F, 0xFF, 0xFC, 0x03, 0xFF, 0x03, 0xFC, 0x7F, 0xD0, 0x3F, 0xD0, 0xBF, 0x83, 0xFF,
-    0x0B, 0xFC, 0x0F, 0xF4, 0x2F, 0xF0, 0xBF, 0xC0, 0xFF, 0x41, 0xFF, 0x0F, 0xFC, 0x1F, 0xF4, 0x1F,
-    0xF0, 0xFF, 0xC0, 0xFF, 0x41, 0xFF, 0x0B, 0xFC, 0x0F, 0xF4, 0x2F, 0xF0, 0x7F, 0xD0, 0xFF, 0x83,
-    0xFD, 0x03, 0xFF, 0x07, 0xFC, 0x7F, 0xC0, 0x2F, 0xF8, 0x2F, 0xEF, 0xF0, 0x00, 0xFF, 0xF4, 0xFF,
-    0xFC, 0x04, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0x55,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03,
-    0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0x5F, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x42, 0xFF,
-    0xEF, 0xFE, 0x1F, 0xF8, 0x0F, 0xFC, 0xFF, 0xC0, 0x2F, 0xE7, 0xFE, 0x00, 0x7F, 0x2F, 0xF4, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF9, 0x5B, 0xC7, 0xFF, 0xFF, 0xFF, 0x07,
-    0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x07, 0xAF, 0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x8F, 0xFA, 0x5F, 0xFE, 0x6B, 0xFD, 0x3F, 0xC0, 0x3F, 0xF4, 0x07, 0xF4, 0xFE, 0x00,
-    0xFF, 0xD0, 0x1F, 0xD3, 0xF4, 0x03, 0xFF, 0x40, 0x7F, 0x02, 0x80, 0x0F, 0xFD, 0x00, 0xA4, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xC1, 0xFF, 0x81, 0xFC, 0x3F, 0x81, 0xFF, 0x81, 0xFC, 0x3F, 0x41, 0xFF, 0x81,
-    0xFC, 0x1F, 0x01, 0xFF, 0x80, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFF,
-    0xD0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFC, 0x00,
-    0x00, 0x2F, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x2F,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x7F,
-    0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F,
-    0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x8F,
-    0xF0, 0x00, 0x00, 0x0B, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x7F,
-    0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF,
-    0xF4, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xE0,
-    0x02, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x0B, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x7F, 0xFD, 0x54, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03,
-    0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00,
-    0x0B, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00,
-    0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x8B, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x02, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xD0, 0x3F, 0xE0, 0x00, 0x00,
-    0x0B, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xF4, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xC0,
-    0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0xE4, 0x06, 0xFF, 0xFF,
-    0x87, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0x83, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0xBF, 0x80,
-    0x01, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xD7, 0xFE, 0x00, 0x00,
-    0x2F, 0xE0, 0xBF, 0xE0, 0x00, 0x2F, 0xF0, 0x0F, 0xFD, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0xE8, 0x7F,
-    0xFF, 0xC3, 0xFF, 0xFF, 0x6F, 0xFF, 0xE0, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF,
-    0x83, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFE, 0x03,
-    0xF4, 0x7F, 0xF0, 0xFC, 0x07, 0xFF, 0x00, 0x3F, 0x07, 0xFF, 0x0F, 0xC0, 0x7F, 0xF0, 0x03, 0xF0,
-    0x7F, 0xF0, 0xFC, 0x07, 0xFF, 0x00, 0x1E, 0x07, 0xFF, 0x0F, 0x40, 0x7F, 0xF0, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x1B, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0x83, 0xF5, 0xFF,
-    0xDF, 0xC1, 0xFF, 0xD0, 0x3F, 0x0F, 0xF8, 0xBC, 0x0F, 0xF8, 0x03, 0xF0, 0xFF, 0x8B, 0xC0, 0xFF,
-    0x80, 0x2E, 0x0F, 0xF8, 0xB4, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x0F,
-    0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF9, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xD2,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFD, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x6A, 0x94, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xCB, 0xFF, 0xFC, 0x3F, 0xFF, 0xE0, 0x7F, 0xFC, 0x02, 0xFF, 0xD0, 0x07, 0xFE,
-    0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x1F, 0xFC,
-    0x01, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0x4B, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x40,
-    0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xFC, 0x00,
-    0x0F, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0xC1, 0xF0, 0xFF, 0xD0, 0x00,
-    0x3F, 0xF4, 0x7C, 0x3F, 0xF4, 0x00, 0x0F, 0xFF, 0x5F, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x06, 0xBF, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xF0, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x24, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0xBF,
-    0xFF, 0xDB, 0xFF, 0xFC, 0x2F, 0xFF, 0xF0, 0x7F, 0xFC, 0x01, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x74, 0xFF,
-    0xC0, 0x03, 0xFF, 0x1D, 0x3F, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x6F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x1D, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0x4F, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x45, 0xAA, 0x40, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4,
-    0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x2F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x01, 0xA9, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xE4, 0x7F, 0xFC, 0x00, 0x3F, 0xF8,
-    0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03,
-    0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xBF, 0xF9, 0x02, 0xFF, 0xE4, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xE0, 0x01, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0xF8, 0x1F,
-    0xFC, 0x00, 0x02, 0xFF, 0x4F, 0xE0, 0xFF, 0xD0, 0x00, 0x07, 0xFD, 0x3F, 0x43, 0xFF, 0x00, 0x00,
-    0x1F, 0xF9, 0xFE, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xE7, 0xFF, 0xFF, 0xFA, 0xAA, 0xAB, 0xFF, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x06, 0xBF, 0xFE,
-    0xAA, 0xAA, 0xAA, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x18, 0x00, 0x00, 0xFF, 0xFF,
-    0xEA, 0xAF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x04, 0x0F,
-    0xFE, 0xAF, 0xFC, 0x1F, 0x07, 0xFC, 0x02, 0xFF, 0x4F, 0xC3, 0xFE, 0x00, 0x3F, 0xE7, 0xF0, 0xFF,
-    0x40, 0x0F, 0xFD, 0xFE, 0xFF, 0xE5, 0x57, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x55, 0x55, 0x50, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF9, 0x45, 0xB4, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xF8, 0x01, 0xFF, 0xE0, 0x01, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0xF8, 0x1F, 0xFC, 0x00, 0x02,
-    0xFF, 0x4F, 0xE0, 0xFF, 0xD0, 0x00, 0x07, 0xFD, 0x3F, 0x43, 0xFF, 0x00, 0x00, 0x1F, 0xF9, 0xFE,
-    0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xE7, 0xFF, 0xFF, 0xFA, 0xAA, 0xAB, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x06, 0xBF, 0xFE, 0xAA, 0xAA, 0xAA,
-    0x80, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x18, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0xAF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x04, 0x0F, 0xFE, 0xAF, 0xFC, 0x1F, 0x07, 0xFC, 0x02, 0xFF, 0x4F, 0xC3,
-    0xFE, 0x00, 0x3F, 0xE7, 0xF0, 0xFF, 0x40, 0x0F, 0xFD, 0xFE, 0xFF, 0xE5, 0x57, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x55, 0x55, 0x50, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF9, 0x45, 0xB4, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x01,
-    0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0xD7, 0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x68, 0x00, 0x00,
-    0x3F, 0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFF, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x5F, 0xFD, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0xBF, 0xFA, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x0F, 0xFC, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0xFF,
-    0xC0, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x3F, 0xFD, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x40,
-    0xBF, 0xFC, 0x02, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xD1, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xF4, 0x00, 0xFF, 0xFC, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x3F, 0xE0, 0x1F, 0xFE, 0x03, 0xFF, 0xF8, 0x0F,
-    0xFF, 0x01, 0xFF, 0xF0, 0x0B, 0xFD, 0x02, 0xFF, 0xF0, 0x09, 0xBF, 0xC0, 0x7F, 0xC0, 0x3F, 0xD6,
-    0x00, 0x01, 0xFD, 0x07, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0xC0, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x47, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xD7, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0x07, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x07,
-    0xFC, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xF4, 0x00, 0xBF, 0xF0, 0x0B, 0xFE,
-    0x02, 0xFF, 0xC0, 0x2F, 0xFE, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF, 0x80, 0x3F, 0xFF, 0xC0,
-    0x3F, 0xF8, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x4F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0x2F, 0xFF, 0xF9, 0x00, 0xFF,
-    0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0xBF, 0xE6, 0x80, 0x3F, 0xF4, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xC0, 0x00, 0x03, 0xFF, 0x41, 0xFE, 0x00, 0x00, 0x0F, 0xFD,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFA, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xF8,
-    0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x03,
-    0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x40,
-    0x00, 0xBF, 0xE0, 0x7F, 0xFF, 0xE0, 0x02, 0xFF, 0x8B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFD, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x82, 0xFF, 0xFF, 0x00, 0xBF, 0xCF, 0xFF, 0xFC, 0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x3F, 0xFD,
-    0x07, 0xFD, 0x02, 0xFE, 0x60, 0x1F, 0xF4, 0x1F, 0xE0, 0x00, 0x7F, 0xD0, 0xFF, 0x00, 0x01, 0xFF,
-    0x47, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFA, 0xFF,
-    0xFC, 0x01, 0xFF, 0x40, 0x7F, 0xF8, 0x07, 0xFD, 0x00, 0x7F, 0xF0, 0x1F, 0xF4, 0x00, 0xFF, 0xC0,
-    0x7F, 0xD0, 0x02, 0xFF, 0x47, 0xFF, 0x90, 0x0B, 0xFD, 0xBF, 0xFF, 0xC0, 0x2F, 0xF7, 0xFF, 0xFF,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x57,
-    0xFF, 0x40, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xF4, 0x00, 0x00,
-    0x0F, 0xE0, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFD, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x0B,
-    0xF0, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x7F, 0x40, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xF4, 0x03, 0x83, 0xFC, 0x00, 0x0F, 0xFD, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xFF, 0x00, 0x1B, 0xFF, 0xFF, 0x5F, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xF3, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF8, 0x19, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xEA, 0xFF, 0xD0, 0x00, 0x0F, 0xD0, 0x3F, 0xF0, 0x00,
-    0x03, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xC0, 0x3F, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xFC, 0x00, 0x02, 0xF8, 0x03, 0xFF, 0x00, 0x00,
-    0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x09, 0x2F, 0xC0, 0x0F, 0xFC, 0x03, 0xFF,
-    0xE0, 0x03, 0xFF, 0x02, 0xFF, 0xF0, 0x06, 0xFF, 0xF8, 0xBF, 0xF4, 0x0F, 0xFF, 0xFF, 0x9F, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x7F, 0xFC,
-    0x01, 0xBF, 0xF4, 0x07, 0xFE, 0x00, 0x2F, 0xF8, 0x01, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0x80, 0x1F, 0xF9, 0x55, 0xBF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFA, 0xAB, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0xBF, 0xE0, 0x07, 0xFE, 0x00,
-    0x2F, 0xF8, 0x01, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x80, 0x7F, 0xFD, 0x00,
-    0xBF, 0xE0, 0xBF, 0xFF, 0xD0, 0x2F, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x07,
-    0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0xE2, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0x81, 0xFF, 0xE0, 0x02, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xD0,
-    0x01, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x80, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xAA, 0xBF, 0xF8, 0x00, 0x7F,
-    0xD0, 0x01, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x80, 0x07,
-    0xFD, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0xBF, 0xFF, 0xC0, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x4B,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x01,
-    0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFD, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06,
-    0xA9, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD3, 0xFF, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF,
-    0xFE, 0x1F, 0xFF, 0x00, 0xBF, 0xF4, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0,
-    0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x40, 0x7F, 0xE0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01,
-    0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x7F, 0xE0, 0x0F, 0xDF,
-    0xFC, 0x00, 0x00, 0x3F, 0x6F, 0xF0, 0x0F, 0xCF, 0xFC, 0x00, 0x00, 0x7F, 0x5F, 0xF0, 0x2F, 0xCF,
-    0xFC, 0x00, 0x00, 0x7F, 0x0F, 0xF4, 0x3F, 0x8B, 0xFC, 0x00, 0x00, 0xBF, 0x0F, 0xFC, 0x3F, 0x0B,
-    0xFC, 0x00, 0x00, 0xBF, 0x07, 0xFC, 0x7F, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0x03, 0xFD, 0xBE, 0x07,
-    0xFD, 0x00, 0x00, 0xFF, 0x03, 0xFE, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0xFC, 0x07,
-    0xFE, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xF0, 0x03,
-    0xFE, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xE0, 0x03,
-    0xFF, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0x00, 0x0B, 0xFF, 0xA0, 0x1F, 0xC0, 0x1F,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x4B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xD0, 0x7F, 0xFF, 0x00,
-    0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xF4, 0x00,
-    0x7F, 0xBF, 0x41, 0xFB, 0xFD, 0x00, 0x1F, 0xDF, 0xF0, 0xFC, 0xFF, 0x40, 0x07, 0xF2, 0xFC, 0x7E,
-    0x3F, 0xD0, 0x01, 0xFC, 0x7F, 0xBF, 0x0F, 0xF4, 0x00, 0x7F, 0x0F, 0xFF, 0x83, 0xFD, 0x00, 0x1F,
-    0xC1, 0xFF, 0xD0, 0xFF, 0x40, 0x07, 0xF0, 0x3F, 0xF0, 0x3F, 0xD0, 0x01, 0xFC, 0x0B, 0xF4, 0x0F,
-    0xF4, 0x00, 0x7F, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x10, 0x01, 0xFF, 0xE4, 0xBF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x1B, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x02,
-    0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF,
-    0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40,
-    0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02,
-    0xFF, 0x40, 0x02, 0xFF, 0x40, 0x0B, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x00, 0x01,
-    0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA,
-    0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0,
-    0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x01, 0x40,
-    0x01, 0x40, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x42, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF,
-    0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF,
-    0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0xFF,
-    0x40, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x0B, 0xF4, 0x2F, 0xD0, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8,
-    0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD6, 0xAF, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x7F, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x9F, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0xC7, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x2F, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0xFC, 0x05, 0x50, 0x00, 0x00,
-    0x03, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xE5, 0x55, 0xBF, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x1F,
-    0xC0, 0x0F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xD5, 0x6B,
-    0xFC, 0x0B, 0xFF, 0xE0, 0x06, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xA4, 0x00, 0x6A, 0x40,
-    0x00, 0x1B, 0xFF, 0xF4, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xEB,
-    0xFF, 0xFA, 0xBF, 0xF4, 0x3F, 0xF0, 0x2F, 0xFD, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFC, 0x0B, 0xC0, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xFF, 0xFC, 0x00, 0x1B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFA, 0x94, 0x0F, 0xFF, 0xEF, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xF0, 0x1F, 0xFF, 0xE5, 0x5B, 0x87, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xD0, 0x00,
-    0x55, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00,
-    0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01,
-    0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40,
-    0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x40, 0x01, 0x40, 0x03, 0xF0, 0x07, 0xF0, 0x03, 0xF4,
-    0x0B, 0xF0, 0x03, 0xFC, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0,
-    0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5,
-    0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE,
-    0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x01, 0x65, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF9, 0x07, 0xFF, 0xF4, 0x0F, 0xE0, 0x00, 0x1F,
-    0xFF, 0x02, 0xD0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x55, 0x55, 0x55, 0x5F,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFA, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0x2F, 0xF4, 0x00, 0x02, 0xFF,
-    0xC7, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x2F, 0xFE, 0x41, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x7D, 0x00, 0x2F, 0xFC, 0x20, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x6A, 0xAA, 0xAB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xD5, 0x5B, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xE0,
-    0x1F, 0xF4, 0x3F, 0xFE, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x15, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xE0, 0xBF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x95, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xE4, 0x1F, 0xFF,
-    0xD0, 0x3F, 0x80, 0x00, 0x7F, 0xFC, 0x0B, 0x40, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xE1, 0x55, 0x55, 0x55, 0x7F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFD, 0x00, 0x00, 0x3F, 0xF6, 0xFF, 0x40, 0x00, 0x1F, 0xFC,
-    0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x03, 0xFF, 0xC0,
-    0xBF, 0xF9, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x16, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x3F, 0xC0, 0x1F, 0xF4, 0xBF, 0xD0, 0x1F, 0xF4, 0xBF, 0xD0, 0x0F, 0xF0, 0x3F, 0xC0, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x07, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x7D, 0x00, 0x2F, 0xFC, 0x20, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x6A, 0xAA, 0xAB, 0xFF, 0xBF, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x5B, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0,
-    0x0B, 0xFC, 0x7F, 0xE0, 0x1F, 0xF4, 0x3F, 0xFE, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x03, 0xFE, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80,
-    0x3F, 0xFC, 0x00, 0xBF, 0xFD, 0x02, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x07,
-    0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x03, 0x5F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xF9, 0xA0, 0x00, 0x00,
-    0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xFC, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xC0,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x7F, 0xF5, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFA, 0xFF, 0xEB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0xF4, 0x00,
-    0x0B, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xFF, 0xFD, 0x02,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x47, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xF0, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x3F, 0xE0, 0x1F, 0xFE, 0x03, 0xFF, 0xF8, 0x0F, 0xFF,
-    0x01, 0xFF, 0xF0, 0x0B, 0xFD, 0x02, 0xFF, 0xF0, 0x09, 0xBF, 0xC0, 0x7F, 0xC0, 0x3F, 0xD6, 0x00,
-    0x01, 0xFD, 0x07, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0xC0, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x47, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xD7, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x07,
-    0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x07, 0xFC,
-    0x0B, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xF4, 0x00, 0xBF, 0xF0, 0x0B, 0xFE, 0x02,
-    0xFF, 0xC0, 0x2F, 0xFE, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x3F,
-    0xF8, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x0F, 0xF0,
-    0x3F, 0xD0, 0x00, 0xBF, 0xE1, 0xFF, 0x80, 0x02, 0xFF, 0x87, 0xFE, 0x00, 0x03, 0xFC, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFD, 0x00,
-    0xBF, 0xF0, 0x1F, 0xD0, 0x00, 0xFF, 0xD0, 0x7F, 0x00, 0x03, 0xFF, 0x40, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1B,
-    0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x0B, 0x40, 0x00, 0x3F, 0xF4,
-    0xFE, 0x00, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0B, 0xFF, 0x2F, 0xFD, 0x00, 0x7F, 0xF4, 0x7F, 0xFF,
-    0xAF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0xA9, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x07, 0xFD, 0x2F, 0xF4, 0x07, 0xFD, 0x2F,
-    0xF4, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x16, 0xA9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFC, 0x1F, 0xF9, 0x7F,
-    0xFC, 0x1F, 0x80, 0x0F, 0xFD, 0x05, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x15, 0x6F,
-    0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0A, 0xBF, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0x07, 0x00, 0x03, 0xFF, 0x2F, 0x80, 0x03, 0xFF, 0x3F, 0xD0, 0x0B, 0xFD, 0x3F, 0xFE, 0xBF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x15, 0x50, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFE, 0x55, 0x5F, 0xFD, 0x1F,
-    0xC0, 0x01, 0xFF, 0x41, 0xFC, 0x00, 0x7F, 0xD0, 0x0F, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xE0, 0x00, 0x07, 0xFF, 0x2F, 0x80,
-    0x00, 0xFF, 0xD3, 0xFF, 0x40, 0x2F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0x6A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFC, 0x2F, 0x90, 0x0B, 0xFD, 0x0B, 0xC0,
-    0x07, 0xFD, 0x01, 0xF0, 0x03, 0xFD, 0x00, 0x10, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x06, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x38, 0x00, 0x0B, 0xFD, 0x3F, 0x00,
-    0x03, 0xFF, 0x1F, 0xF4, 0x02, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00,
-    0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF4, 0x00,
-    0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0x40, 0x3F, 0xEF, 0xFC, 0x00, 0x3F, 0xF4, 0x0F, 0xF5, 0xFF, 0xC0, 0x03, 0xFF, 0x43,
-    0xFD, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0xFF, 0x41, 0xFF, 0xC0, 0x03, 0xFF, 0xBF, 0xD0, 0x1F, 0xFC,
-    0x00, 0x3F, 0xFF, 0xF4, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFF,
-    0x40, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF,
-    0xC0, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x1A, 0xAA, 0xAA, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x87, 0xFF, 0x80, 0x0B, 0xFE, 0x00,
-    0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x01, 0xFF, 0xD0, 0x07, 0xFD, 0x01, 0xFF, 0xF4, 0x01,
-    0xFF, 0x41, 0xFF, 0xFD, 0x00, 0x7F, 0xD1, 0xFE, 0xFF, 0x40, 0x1F, 0xF5, 0xFD, 0x7F, 0xD0, 0x07,
-    0xFE, 0xFC, 0x1F, 0xF4, 0x01, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0x40, 0x1F,
-    0xFC, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x07, 0xFF, 0x80, 0x0B, 0xFF, 0x8B, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0x80, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF,
-    0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x03, 0xFE, 0xFF, 0xC0, 0x03, 0xFF,
-    0x40, 0xFF, 0x5F, 0xFC, 0x00, 0x3F, 0xF4, 0x3F, 0xD1, 0xFF, 0xC0, 0x03, 0xFF, 0x4F, 0xF4, 0x1F,
-    0xFC, 0x00, 0x3F, 0xFB, 0xFD, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x3F,
-    0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x01,
-    0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xDB, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x07, 0xFD,
-    0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x4B, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x3F, 0xFF, 0xEF, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x7F, 0xF8, 0x00,
-    0xBF, 0xE0, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x7F, 0xD0, 0x1F,
-    0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFF, 0xD0, 0x07, 0xFD, 0x1F, 0xEF, 0xF4, 0x01, 0xFF, 0x5F, 0xD7,
-    0xFD, 0x00, 0x7F, 0xEF, 0xC1, 0xFF, 0x40, 0x1F, 0xFF, 0xC0, 0x7F, 0xD0, 0x07, 0xFF, 0xC0, 0x1F,
-    0xF4, 0x01, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0xBF,
-    0xF8, 0xBF, 0xFF, 0xC0, 0xFF, 0xFF, 0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x01,
-    0x40, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4,
-    0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC,
-    0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x7F, 0x40, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x02, 0xFD,
-    0x0B, 0xF4, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB,
-    0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00,
-    0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F,
-    0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF4,
-    0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF4, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xE4, 0x0B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xD5, 0xBF, 0xF4, 0x1F, 0xF0,
-    0x01, 0xFF, 0xC3, 0xFE, 0x00, 0x0F, 0xFD, 0x7F, 0xC0, 0x00, 0x7F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA, 0xAA, 0xBF, 0xEB, 0xFC, 0x00,
-    0x03, 0xFD, 0xBF, 0xD0, 0x00, 0x7F, 0xC7, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xF8, 0x01, 0xFF, 0x41,
-    0xFF, 0xFA, 0xBF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0,
-    0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00,
-    0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF,
-    0x40, 0x00, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x0B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0x40, 0x03, 0xFF, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0xFF, 0xC0, 0x02, 0xFD, 0x0B, 0xF4, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xD5, 0xBF, 0xF4, 0x1F, 0xF0, 0x01, 0xFF, 0xC3, 0xFE, 0x00, 0x0F,
-    0xFD, 0x7F, 0xC0, 0x00, 0x7F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xEA, 0xAA, 0xBF, 0xEB, 0xFC, 0x00, 0x03, 0xFD, 0xBF, 0xD0, 0x00, 0x7F,
-    0xC7, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xF8, 0x01, 0xFF, 0x41, 0xFF, 0xFA, 0xBF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40,
-    0x00, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xE1, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x7F, 0xE0,
-    0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x16, 0x94, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xD0, 0x1B, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x7F, 0xFC,
-    0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0x02, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x0B, 0x00, 0x00, 0x0F, 0xFD, 0x0F,
-    0xD0, 0x00, 0x0B, 0xFF, 0x0B, 0xFC, 0x00, 0x07, 0xFF, 0x42, 0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF8, 0x00, 0xBF, 0xC3, 0xFF,
-    0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x07, 0xF8, 0x1F, 0xE0, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xEA, 0xFF, 0xF8, 0x1F, 0x80, 0x0B, 0xFF, 0x02, 0x40, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x55, 0x5B, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0xA9, 0x6F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x07, 0x00, 0x02, 0xFF, 0x4B, 0xE0, 0x00,
-    0xFF, 0xC3, 0xFD, 0x00, 0xBF, 0xD0, 0xFF, 0xFA, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFE, 0x7F, 0xFF, 0xF4,
-    0x06, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00,
-    0xFF, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFC,
-    0x00, 0x00, 0x2F, 0xF8, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xFD,
-    0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x3F,
-    0xC0, 0x00, 0x00, 0x02, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xAA, 0xA9, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4,
-    0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC,
-    0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F,
-    0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00, 0x00,
-    0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x24, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xE6, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFE, 0x7F, 0xFF, 0xF4,
-    0x06, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00,
-    0xFF, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFC,
-    0x00, 0x00, 0x2F, 0xF8, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xFD,
-    0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x3F,
-    0xC0, 0x00, 0x00, 0x02, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xC2, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x40, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8,
-    0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF,
-    0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03,
-    0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x24, 0x03, 0xFE, 0x00, 0x00,
-    0x07, 0xE6, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x02, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00, 0x00,
-    0x2F, 0xF0, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0x80, 0x00, 0x01, 0xFE, 0x03, 0xFD, 0x00,
-    0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFE, 0x7F, 0xFF, 0xF4, 0x06, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xC0,
-    0x02, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x03,
-    0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x0B, 0xF4, 0x00, 0x00, 0x0F,
-    0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF9, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x03,
-    0xF8, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x00, 0x00,
-    0x74, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0,
-    0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80,
-    0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0,
-    0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x24, 0x03, 0xFE,
-    0x00, 0x00, 0x07, 0xE6, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x01, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xF4, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00,
-    0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x0F,
-    0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA9, 0x4F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x7F, 0x82, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFE, 0x1F, 0xFF, 0x00, 0xBF, 0xF4, 0x07, 0xFE, 0x00, 0x7F,
-    0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x7F, 0xE0,
-    0x03, 0xFF, 0x40, 0x7F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFA, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xF0, 0x0F, 0xFD, 0x00, 0x2F, 0xC0, 0x3F,
-    0xF4, 0x00, 0xBF, 0x00, 0xFF, 0xD0, 0x01, 0xF4, 0x03, 0xFF, 0x40, 0x01, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x07, 0xFE, 0x01, 0xFD, 0x07, 0xFE, 0x00, 0xFD, 0x07, 0xFE, 0x00, 0xFC, 0x07, 0xFE, 0x00,
-    0xF8, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xE4,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xEA, 0x50, 0x00, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x9B, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x3F, 0xF8, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x40, 0x3F, 0xF8, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x85, 0xFF, 0xF0, 0x03, 0xFF,
-    0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xD2, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x87, 0xFF, 0x90, 0x00, 0x01,
-    0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0xBF, 0xD0, 0x07, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFD, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x2F,
-    0xF4, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0xBF, 0xD0, 0x07, 0xFD, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0x1F,
-    0xF4, 0x0B, 0xFC, 0x0B, 0xFD, 0x00, 0x7F, 0xD0, 0x3F, 0xE0, 0x2F, 0xF4, 0x07, 0xFF, 0xEF, 0xFF,
-    0x01, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFA, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xF0,
-    0x0F, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xF4, 0x00, 0xBF, 0x00, 0xFF, 0xD0, 0x01, 0xF4, 0x03, 0xFF,
-    0x40, 0x01, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x05, 0x7F, 0xF9, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xEA, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x80, 0x3F, 0x40, 0x7F, 0xE0, 0x0F,
-    0xD0, 0x1F, 0xF8, 0x03, 0xF0, 0x07, 0xFE, 0x00, 0x78, 0x16, 0xFF, 0x94, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xA4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x04, 0x1F, 0x80,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xC1, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0xFF,
-    0x80, 0x00, 0x0B, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x01,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xE4, 0x00, 0x7F, 0xF4, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0xFF, 0x80, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFE, 0x3F, 0xFF, 0xD0, 0x7F, 0xFD, 0x07, 0xFF, 0x80,
-    0x2F, 0xE0, 0x01, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x7F, 0xF0, 0xFF, 0x00, 0x00, 0x1F, 0xFB, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xD7, 0xFD, 0x00, 0x00,
-    0xBF, 0x82, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x7F, 0xFF,
-    0xC0, 0x2F, 0xF4, 0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x06, 0xBF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x1F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x15, 0x7F, 0xFF, 0xD5,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0xE4,
-    0x06, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0x83, 0xFF, 0xFD, 0x07, 0xFF, 0xD0,
-    0x1F, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0x80, 0x00,
-    0x01, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xAB, 0xFF, 0xFA, 0x90, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x05, 0x7F, 0xFF, 0x54, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xD7, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0xBF, 0xD0, 0x00, 0x2F, 0xF0, 0x0F, 0xFD, 0x00, 0x2F,
-    0xF4, 0x02, 0xFF, 0xE4, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x2F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0x0A,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x38,
-    0x2C, 0x1E, 0xB4, 0x07, 0xD0, 0x0B, 0xD0, 0x2F, 0xF4, 0x36, 0x9C, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x74, 0x3F, 0xFF, 0xFC, 0x75, 0x55, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03,
-    0x80, 0x70, 0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2E, 0x55, 0x5D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0,
-    0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x42, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x15, 0x55,
-    0x50, 0x15, 0x55, 0x42, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x55,
-    0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0xA9, 0x3F, 0xC0, 0xFF,
-    0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F,
-    0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0,
-    0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF,
-    0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F,
-    0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0,
-    0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x15, 0x40, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x40, 0x0F, 0xC0, 0xFD, 0x0B, 0xF0, 0x3F, 0x81,
-    0xFD, 0x0B, 0xF4, 0x3F, 0xE0, 0xBF, 0xC1, 0xFF, 0x41, 0xE0, 0x00, 0x00, 0x40, 0x2F, 0xC1, 0xFF,
-    0x83, 0xFF, 0x07, 0xFC, 0x1F, 0xE0, 0x7F, 0x42, 0xFC, 0x0F, 0xD0, 0xBE, 0x01, 0xA0, 0x00, 0x00,
-    0x40, 0x2F, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFC, 0x1F, 0xE0, 0x7F, 0x42, 0xFC, 0x0F, 0xD0, 0xBE,
-    0x01, 0xE0, 0x00, 0x05, 0x00, 0xFF, 0x0B, 0xFD, 0x2F, 0xF0, 0xBF, 0x42, 0xFD, 0x03, 0xF8, 0x0B,
-    0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x19, 0x00, 0x00, 0x40, 0x05, 0x00, 0xFC, 0x0B, 0xD0, 0xFD, 0x07,
-    0xF0, 0xBF, 0x03, 0xF8, 0x3F, 0x81, 0xFC, 0x1F, 0xD0, 0xFF, 0x0B, 0xF4, 0x3F, 0xC3, 0xFE, 0x0F,
-    0xF4, 0xBF, 0xC3, 0xFF, 0x1F, 0xF4, 0xBF, 0xC1, 0xE0, 0x0B, 0x80, 0x00, 0x40, 0x05, 0x00, 0xBF,
-    0x07, 0xF8, 0x1F, 0xF8, 0xFF, 0xC0, 0xFF, 0xC3, 0xFD, 0x07, 0xFC, 0x3F, 0xD0, 0x7F, 0x82, 0xFC,
-    0x07, 0xF4, 0x3F, 0xC0, 0xBF, 0x03, 0xF4, 0x0F, 0xD0, 0xBF, 0x02, 0xF8, 0x0F, 0xC0, 0x1A, 0x00,
-    0xA4, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0x07, 0xF8, 0x1F, 0xF8, 0xFF, 0xC0, 0xFF, 0xC3, 0xFD,
-    0x07, 0xFC, 0x3F, 0xD0, 0x7F, 0x82, 0xFD, 0x07, 0xF4, 0x3F, 0xC0, 0xBF, 0x03, 0xF4, 0x0F, 0xD0,
-    0xBF, 0x02, 0xF8, 0x0F, 0xD0, 0x1E, 0x00, 0xB4, 0x00, 0x05, 0x00, 0x10, 0x0F, 0xF0, 0x7F, 0x8B,
-    0xFD, 0x3F, 0xF2, 0xFF, 0x0F, 0xF4, 0xBF, 0x43, 0xFC, 0x2F, 0xD0, 0xFF, 0x03, 0xF8, 0x2F, 0xC0,
-    0xBF, 0x03, 0xF4, 0x0F, 0xD0, 0xBF, 0x02, 0xFC, 0x0F, 0xD0, 0x19, 0x00, 0xA0, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x0B, 0x91, 0xFC, 0x6F, 0x3F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE,
-    0xBF, 0xBF, 0xC5, 0x01, 0xF8, 0x05, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x6A, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0x91, 0xFC, 0x6F, 0x3F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFE, 0xBF, 0xAF, 0xC5, 0x01, 0xFC, 0x01, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xB9, 0x0F, 0x86, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xEB, 0xF6, 0xFC, 0x50, 0x1F, 0xC0, 0x10, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x6A,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xFD, 0xBF, 0xFE, 0xBF, 0xFE, 0xBF, 0xFD, 0x3F, 0xFC,
-    0x0A, 0xA0, 0x28, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x3F, 0xFD, 0x00, 0x3F, 0xD0, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0xBF, 0xD3, 0xFF, 0x8F, 0xFE, 0x2F, 0xF4, 0x15,
-    0x00, 0x1A, 0x80, 0x0A, 0x81, 0xFF, 0xC0, 0xFF, 0xCB, 0xFF, 0x0B, 0xFF, 0x6F, 0xFC, 0x2F, 0xFC,
-    0x7F, 0xE0, 0x3F, 0xF0, 0x59, 0x00, 0x19, 0x00, 0x0A, 0x80, 0x00, 0x2A, 0x00, 0x00, 0xA8, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x7F, 0xF5, 0xFF, 0xD0,
-    0x07, 0xFF, 0x40, 0x1F, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0x90, 0x00, 0x06,
-    0x40, 0x00, 0x19, 0x00, 0x06, 0x90, 0xBF, 0xD3, 0xFF, 0x8F, 0xFE, 0x2F, 0xF0, 0x15, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x74, 0x38, 0x1F, 0xFC, 0x74, 0x05,
-    0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xF4, 0x1C, 0x2E, 0x50, 0x0D, 0x0B, 0x00,
-    0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0, 0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0x40, 0x07, 0xFC,
-    0x00, 0xEA, 0x70, 0x38, 0xA2, 0xCA, 0x0A, 0x0A, 0x40, 0xA0, 0x10, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xD0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x0F,
-    0x0E, 0x00, 0x00, 0x3C, 0x38, 0xBF, 0xFF, 0xF0, 0xEB, 0x55, 0x6D, 0x2C, 0xA0, 0x07, 0x4B, 0x0A,
-    0x01, 0xD2, 0xC0, 0xA0, 0x74, 0xB0, 0x0A, 0x04, 0x04, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x2D, 0x3C, 0x00, 0x0B, 0x4F, 0x00, 0x02, 0xC3,
-    0xC0, 0x00, 0xB0, 0xFF, 0xFF, 0xE3, 0x87, 0x95, 0x5E, 0x0E, 0x1D, 0x00, 0xA0, 0x38, 0x74, 0x0A,
-    0x00, 0xE1, 0xD0, 0xA0, 0x01, 0x01, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE6, 0xFE,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x7F, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0x0B, 0xF0, 0x06,
-    0x90, 0x00, 0x00, 0x65, 0x00, 0x3F, 0xC0, 0xFE, 0x0F, 0xD0, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFC, 0x2F, 0x83, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x3F, 0x07,
-    0xF4, 0x7F, 0xC0, 0xBF, 0x47, 0xFC, 0x01, 0xBE, 0x40, 0xFE, 0x0F, 0xE0, 0x2F, 0xC0, 0xFE, 0x02,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x1F, 0xD1, 0xFD, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF8,
-    0x1F, 0xD0, 0x0F, 0xE2, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x0F, 0xE2, 0xFC,
-    0x01, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x1F, 0xD2, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x2F,
-    0xC0, 0x1F, 0xD0, 0x1F, 0xD1, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xE0, 0x2F, 0xC1,
-    0xFE, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x7F, 0x80, 0xFF, 0x4B, 0xF4, 0x00, 0x01,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x3F, 0x80, 0x1F,
-    0xF0, 0x0F, 0xFC, 0x03, 0xFE, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0xBF, 0x80, 0x3F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x50, 0x00, 0x00, 0x64, 0x00, 0x90, 0x00, 0xFE, 0x02, 0xFC, 0x01, 0xFF, 0x03, 0xFD, 0x03,
-    0xFF, 0x0B, 0xFC, 0x03, 0xFE, 0x0F, 0xF8, 0x0B, 0xFC, 0x2F, 0xF0, 0x0F, 0xF4, 0x3F, 0xE0, 0x2F,
-    0xE0, 0x7F, 0xC0, 0x3F, 0xC0, 0xFF, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00,
-    0x64, 0x00, 0x90, 0x03, 0x40, 0x03, 0xF8, 0x0B, 0xF0, 0x1F, 0xC0, 0x1F, 0xF0, 0x3F, 0xD0, 0xFF,
-    0x80, 0xFF, 0xC2, 0xFF, 0x07, 0xFD, 0x03, 0xFE, 0x0F, 0xF8, 0x3F, 0xF0, 0x2F, 0xF0, 0xBF, 0xC1,
-    0xFF, 0x40, 0xFF, 0x43, 0xFE, 0x0F, 0xF8, 0x0B, 0xF8, 0x1F, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF,
-    0x02, 0xFD, 0x00, 0xFC, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x50, 0x01, 0x40, 0x06, 0x00, 0x00, 0x06,
-    0x40, 0x0B, 0xF0, 0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0B,
-    0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x01, 0x40, 0x0A, 0x00, 0x18, 0x01, 0xFC, 0x03, 0xF4, 0x0F,
-    0xF8, 0x2F, 0xF0, 0x2F, 0xF0, 0x7F, 0xD0, 0x3F, 0xE0, 0xFF, 0xC0, 0xBF, 0xC1, 0xFF, 0x00, 0xFF,
-    0x43, 0xFE, 0x01, 0xFF, 0x03, 0xFC, 0x02, 0xFD, 0x07, 0xF4, 0x03, 0xF0, 0x0B, 0xD0, 0x02, 0x00,
-    0x08, 0x00, 0x0A, 0x00, 0x18, 0x00, 0x60, 0x07, 0xF0, 0x0F, 0xD0, 0x3F, 0x80, 0xFF, 0x82, 0xFF,
-    0x07, 0xFC, 0x0B, 0xFC, 0x1F, 0xF4, 0x3F, 0xE0, 0x3F, 0xE0, 0xFF, 0xC3, 0xFF, 0x02, 0xFF, 0x07,
-    0xFC, 0x1F, 0xF4, 0x0F, 0xF4, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xC0, 0xFF, 0x03, 0xFD, 0x02, 0xFD,
-    0x07, 0xF4, 0x0F, 0xE0, 0x0F, 0xC0, 0x2F, 0x40, 0x7E, 0x00, 0x20, 0x00, 0x80, 0x01, 0x40, 0x00,
-    0x06, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xF8, 0xFE,
-    0x01, 0xFE, 0x03, 0xF8, 0x2F, 0x80, 0x0F, 0xD0, 0x00, 0x09, 0x00, 0x1F, 0xD0, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x3F, 0xF0, 0x3F, 0xF4, 0x0F, 0xF8, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x2F,
-    0xF0, 0x01, 0xFD, 0x00, 0x0A, 0x00, 0x18, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03,
-    0xFF, 0x00, 0x7F, 0xF0, 0x0B, 0xFC, 0x07, 0xFF, 0x03, 0xFF, 0x03, 0xFE, 0x02, 0xFE, 0x01, 0xFD,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x8B, 0xE0,
-    0x03, 0xE0, 0x03, 0xF0, 0xBE, 0x02, 0xFC, 0x03, 0xF0, 0x0B, 0xE0, 0xBF, 0x03, 0xF4, 0x00, 0xFD,
-    0x0F, 0x43, 0xF4, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x02, 0xF4, 0x00, 0x00, 0x0F,
-    0xD2, 0xF8, 0x00, 0x01, 0x80, 0xFE, 0xF8, 0x18, 0x02, 0xFC, 0x1F, 0xF8, 0x1F, 0xC0, 0xFF, 0x02,
-    0xFC, 0x0B, 0xF4, 0x1F, 0xC1, 0xFF, 0xC1, 0xFC, 0x01, 0x41, 0xFD, 0xFC, 0x04, 0x00, 0x01, 0xFC,
-    0x1F, 0x80, 0x00, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x0F,
-    0x82, 0xF8, 0x00, 0xFD, 0x0B, 0xF0, 0x3F, 0x40, 0xFD, 0x02, 0xFC, 0x03, 0xF4, 0xBD, 0x00, 0x2D,
-    0x00, 0x3F, 0x0A, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x01,
-    0xA8, 0x3F, 0xE0, 0x0B, 0xFC, 0x7F, 0xE0, 0x0F, 0xFC, 0xBF, 0xD0, 0x0F, 0xFC, 0xBF, 0xC0, 0x0F,
-    0xFC, 0xBF, 0xC0, 0x0F, 0xF8, 0xBF, 0xC0, 0x0F, 0xF8, 0xBF, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F,
-    0xF4, 0xBF, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF4, 0x7F, 0xC0, 0x0F, 0xF4, 0x7F, 0xC0, 0x0F,
-    0xF4, 0x3F, 0x80, 0x0B, 0xF4, 0x3F, 0x80, 0x0B, 0xF4, 0x3F, 0x80, 0x07, 0xF4, 0x3F, 0xC0, 0x07,
-    0xF4, 0x2F, 0xC0, 0x03, 0xF4, 0x14, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x50, 0x3F, 0xF0, 0x07, 0xFD, 0x7F, 0xF0, 0x0F, 0xFF, 0x7F, 0xF0, 0x0F, 0xFF, 0x3F, 0xF0, 0x0B,
-    0xFD, 0x06, 0x40, 0x01, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x15, 0x50, 0xBF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFD, 0x15, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xE0, 0x39, 0x5B, 0xFE, 0x01, 0xE5, 0x6F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x6F, 0xFF, 0x00, 0x01,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xD0,
-    0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0xBF, 0xE4, 0x00, 0x00, 0xFF, 0x8B,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFD, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0xBF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xC0, 0xE5, 0x6F, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xD0,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0x1B,
-    0xF4, 0x0B, 0xF8, 0x00, 0x1B, 0xFF, 0xC0, 0x2F, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0x7F, 0x80, 0x3F,
-    0xFF, 0xE0, 0x01, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xE0,
-    0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x24, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x05, 0x40, 0x1F, 0xF4, 0x00,
-    0x00, 0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x0B, 0xFD,
-    0x00, 0x00, 0x3F, 0xE0, 0x06, 0x40, 0x00, 0x00, 0x19, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0xF4, 0x0B, 0xFD, 0x02, 0xFF, 0xFF, 0xD0,
-    0xBF, 0xC0, 0x1F, 0xFF, 0xFF, 0x0B, 0xFC, 0x00, 0xF9, 0x5F, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x2F,
-    0xCB, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xEB, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x01, 0xBF, 0xFD, 0x7F, 0xC0, 0x01, 0xFF,
-    0xFF, 0xC3, 0xF8, 0x00, 0x2F, 0xFF, 0xF0, 0x3F, 0x80, 0x02, 0xFF, 0xE4, 0x03, 0xF8, 0x00, 0x2F,
-    0xE0, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x14, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x14, 0x00, 0x03, 0xFF, 0x00,
-    0x0F, 0xF8, 0x00, 0x7F, 0xF0, 0x02, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x01, 0xFF, 0x40, 0x00, 0x64, 0x00, 0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xE4, 0x00, 0x3C, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x7F,
-    0xFF, 0xF8, 0x0E, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x90,
-    0x03, 0x40, 0x0A, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x7F, 0x01, 0xFD, 0x01, 0xFF, 0x03, 0xFD, 0x0F,
-    0xF8, 0x3F, 0xE0, 0x3F, 0xF0, 0xBF, 0xC1, 0xFF, 0x43, 0xFE, 0x03, 0xFE, 0x0F, 0xF8, 0x3F, 0xF0,
-    0xBF, 0xC0, 0xBF, 0xC2, 0xFF, 0x07, 0xFD, 0x0F, 0xF8, 0x0F, 0xF4, 0x3F, 0xE0, 0xFF, 0x82, 0xFF,
-    0x02, 0xFE, 0x07, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF, 0x02, 0xFD, 0x07, 0xF8, 0x03,
-    0xF0, 0x0B, 0xD0, 0x1F, 0x80, 0x3E, 0x00, 0x05, 0x00, 0x14, 0x00, 0x60, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xF0,
-    0x3F, 0xD0, 0xFF, 0x40, 0x7F, 0x83, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x7F, 0xC0, 0x0F,
-    0xF1, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x0B, 0xF8, 0x2F, 0xE0, 0x3F, 0xC0,
-    0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFD,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0xFC, 0xFD, 0x00, 0x2F, 0x4F, 0xD0, 0x0B, 0xE0, 0xFD, 0x01, 0xFC,
-    0x0F, 0xD0, 0x3F, 0xAA, 0xFF, 0xA3, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xD1, 0xFF, 0xFF, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0xE4, 0x02, 0xFF, 0xFC, 0x06, 0xBF,
-    0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0xAA, 0xFF, 0xE3, 0xFF,
-    0xFE, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFF,
-    0xF0, 0x07, 0xFF, 0x90, 0x07, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0xA9, 0x00, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xEB, 0xFF, 0x1F, 0xD0, 0x3F, 0xC7, 0xF4, 0x07, 0xF4, 0xFE, 0x01, 0xFD, 0x3F, 0xC0,
-    0xBF, 0x0B, 0xFE, 0xBF, 0xC0, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xE8, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFD, 0x03, 0xF8, 0xFC, 0x07, 0xF0, 0x24, 0x0F,
-    0xD0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x7F, 0x47, 0xF8, 0x2F, 0xC0, 0xBF, 0x0B,
-    0xF0, 0x3F, 0x81, 0xFF, 0x2F, 0xC0, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x43,
-    0xF8, 0x1F, 0xF1, 0xFC, 0x02, 0xFC, 0x7F, 0x00, 0xBF, 0x0F, 0xF4, 0x7F, 0x82, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0xFF, 0xFF,
-    0x80, 0xFF, 0xEF, 0xF4, 0x3F, 0xC0, 0xFF, 0x1F, 0xD0, 0x3F, 0xC7, 0xF4, 0x0B, 0xF0, 0xFF, 0x02,
-    0xFC, 0x2F, 0xFA, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x1A, 0xFF, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x01, 0xBF, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xC7, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xEB, 0xF4, 0x02, 0xFC, 0x0F, 0xE0, 0x0B, 0xE0,
-    0x2F, 0x80, 0x2F, 0x80, 0xBE, 0x00, 0xBE, 0x02, 0xF8, 0x02, 0xF8, 0x0B, 0xE0, 0x0B, 0xE0, 0x2F,
-    0x80, 0xFF, 0xE2, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x00, 0x00, 0x06, 0x90, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xFE, 0x6F, 0xF0, 0x2F, 0xE0, 0x2F, 0xE0, 0xFF, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x7F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC,
-    0x01, 0xFE, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xF0, 0xBF, 0xC0, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x04, 0x00, 0x06, 0xFC, 0x06, 0xFF, 0xF0, 0x2F, 0xFF, 0x80,
-    0x2A, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8,
-    0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x40, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x45, 0x55,
-    0x54, 0x00, 0x59, 0x40, 0x01, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0x5F, 0xF8, 0x3F, 0x80,
-    0xFF, 0x0B, 0xD0, 0x7F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
-    0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xF0, 0x15, 0x55, 0x50, 0x00, 0x59, 0x40, 0x0B, 0xFF, 0xF4, 0x2F, 0xFF, 0xFC, 0x3F, 0x42,
-    0xFD, 0x2D, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0xE0, 0x02, 0xFF, 0xFC,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xFC, 0x3F, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xD0, 0x0A, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xEF, 0xD0, 0x01, 0xFC, 0xFD, 0x00, 0x3F, 0x0F,
-    0xD0, 0x0F, 0xD0, 0xFD, 0x02, 0xF8, 0x0F, 0xD0, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x0A,
-    0xAA, 0xFF, 0xA0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xD1, 0xFF, 0xFF, 0x47, 0xFF, 0xFC, 0x1F, 0xC0, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xF8, 0x01, 0x7F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x6F,
-    0xF3, 0xFF, 0xFF, 0x4B, 0xFF, 0xF4, 0x0B, 0xE9, 0x00, 0x00, 0x00, 0x64, 0x00, 0x07, 0xFF, 0x80,
-    0x0B, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xF4, 0x3F, 0x82, 0xFF, 0x1F, 0xD0, 0x2F, 0xD7, 0xF8, 0x07, 0xF4, 0xFF, 0x01, 0xFD,
-    0x3F, 0xD0, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x02, 0xBA, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0xFC, 0x03, 0xF4, 0xB8, 0x0F, 0xE0, 0x00,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1A, 0x40,
-    0x00, 0xFF, 0xFD, 0x00, 0xFF, 0xBF, 0xD0, 0xBF, 0x03, 0xF8, 0x2F, 0xC0, 0xBE, 0x0B, 0xF4, 0x3F,
-    0x40, 0xFF, 0xBF, 0x80, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x0B, 0xF5, 0xFF, 0x83, 0xF4, 0x0F,
-    0xF1, 0xFC, 0x02, 0xFC, 0x7F, 0x40, 0xBF, 0x0F, 0xFA, 0xFF, 0x41, 0xFF, 0xFF, 0x40, 0x06, 0xF9,
-    0x00, 0x00, 0x69, 0x00, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0x5B, 0xF8, 0x3F, 0x80,
-    0xFF, 0x1F, 0xD0, 0x2F, 0xC7, 0xF8, 0x0B, 0xF0, 0xFF, 0x42, 0xFC, 0x1F, 0xFF, 0xFF, 0x01, 0xFF,
-    0xFF, 0xC0, 0x01, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xF0, 0x0A, 0xFF, 0xF4, 0x03, 0xFF,
-    0xE0, 0x00, 0x2E, 0x80, 0x00, 0x15, 0x55, 0x55, 0x55, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x01, 0xBF, 0xFA, 0xFF, 0xFC, 0x01, 0xFF, 0x80, 0x03, 0xF4, 0x07, 0xFE, 0x00,
-    0x0F, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xFF, 0x55, 0x54, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x90,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xAB, 0xFF, 0xA9, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x47, 0xFE, 0x00, 0x03, 0xFE, 0x02, 0xFE, 0x00, 0x07, 0xFC, 0x01,
-    0xFD, 0x00, 0x0B, 0xFC, 0x00, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x02, 0xAF, 0xFA, 0xAF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xBF, 0xFE, 0xAA, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x06, 0x7F, 0xFA, 0xAA, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x15, 0xFF, 0x95, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFA, 0xFF, 0xFF, 0xF8, 0x06, 0x80, 0x00, 0x55, 0x40, 0x01, 0x6A, 0xFF, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD5, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x15, 0x00, 0x00, 0xFF,
-    0xC0, 0x2F, 0xF4, 0x6F, 0xFF, 0xFD, 0x02, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xF1, 0xFF, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x2F, 0xD0, 0xBD, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x7C, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x0B,
-    0xFC, 0x00, 0x3F, 0xE0, 0x14, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x1E, 0x02, 0xFE, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x3F, 0x00, 0xFE, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x3F,
-    0x02, 0xFD, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xA0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x57, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x85,
-    0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x10, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x5F, 0xFD, 0x55, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x01, 0xBC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x01, 0x55,
-    0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x87, 0xF9, 0x55, 0x55, 0x55, 0x40, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x80, 0xBF, 0x7F, 0x7F, 0x8B, 0xF4, 0xFC, 0x7F, 0x8F, 0x83, 0xF0, 0xBC, 0x08, 0x1F,
-    0xC0, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x05, 0x55, 0x00, 0x00, 0xBF, 0x4B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55,
-    0x55, 0x55, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x08, 0x1F, 0xC0, 0x80, 0xB8,
-    0x3F, 0x0B, 0x8B, 0xF4, 0xFC, 0x7F, 0x8F, 0xF7, 0xF7, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xFC, 0x00,
-    0xFF, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF8, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0x47, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xF5, 0x55, 0x55,
-    0x7F, 0x80, 0xBF, 0x40, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x3F,
-    0x80, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0x03, 0xFD, 0xFC, 0xFF, 0x0B, 0xC3, 0xF1, 0xF8, 0x09, 0x0F, 0xC2, 0x80, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x90, 0xFC, 0x18, 0x0B, 0xC3, 0xF0, 0xF8, 0x3F, 0xCF, 0xCF, 0xF0, 0x7F, 0xBF, 0xBF, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0xFF, 0x7F, 0x7F, 0xC3, 0xF4, 0xFC, 0x7F, 0x03, 0x83, 0xF0,
-    0xB0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x03, 0xF0, 0x10,
-    0x1F, 0x0F, 0xC3, 0xD0, 0xFF, 0x3F, 0x3F, 0xC1, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x08, 0x03, 0xF4, 0x00, 0xBC, 0x0F, 0xD0,
-    0x0B, 0xFC, 0x3F, 0x40, 0xBF, 0xC0, 0xFD, 0x07, 0xF8, 0x03, 0xF4, 0x7F, 0x95, 0x5F, 0xD7, 0xFF,
-    0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x6A, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-    0x01, 0x80, 0x01, 0xFC, 0x1F, 0x80, 0x07, 0xF0, 0xFF, 0x80, 0x1F, 0xC0, 0xFF, 0x40, 0x7F, 0x00,
-    0xBF, 0x41, 0xFD, 0x55, 0xBF, 0x47, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x07, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x03, 0xF4,
-    0x03, 0xFD, 0x00, 0x0F, 0xD0, 0x3F, 0xC0, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0x00, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0xF9, 0x55, 0x55,
-    0x54, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x55, 0x5A, 0x90, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x6F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xF5, 0x55, 0x55, 0x55, 0x50, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0xBF, 0x95, 0x6A, 0xAA, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x07, 0xF7, 0xF4, 0x00, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x0B, 0xFD, 0x1F, 0xF8, 0x00, 0xBF,
-    0xF4, 0x7F, 0xF8, 0x0B, 0xFB, 0xD1, 0xFB, 0xF8, 0x3F, 0x5F, 0x47, 0xD7, 0xF0, 0x34, 0x7D, 0x1F,
-    0x47, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00,
-    0x00, 0x7D, 0x1F, 0x40, 0x00, 0x02, 0xF4, 0x7D, 0x00, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x00, 0x2F,
-    0x47, 0xE0, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0x0B, 0xD1, 0xF8,
-    0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x1A, 0x95, 0x54, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x55, 0x55, 0x55, 0x55, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xE1, 0x55, 0x55, 0x55, 0x57, 0xF6,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2E, 0xAA, 0xA5, 0x5B, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x02, 0x90, 0x00, 0x00,
-    0xBD, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x00, 0x2F, 0x47,
-    0xE0, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x7D, 0x00, 0x00, 0x07, 0xD1, 0xF4, 0x00,
-    0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x03, 0x07,
-    0xD1, 0xF4, 0x70, 0x3F, 0x1F, 0x47, 0xD3, 0xF0, 0xFF, 0x7D, 0x1F, 0x7F, 0xC0, 0xBF, 0xF4, 0x7F,
-    0xF8, 0x00, 0xBF, 0xD1, 0xFF, 0x80, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x00, 0xBF, 0x7F, 0x80, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x0E, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x02, 0xFD,
-    0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD1, 0xFD, 0x55, 0x55, 0x55, 0xFD, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xD5, 0x55,
-    0x55, 0x5F, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFD, 0x00,
-    0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x3D, 0x01,
-    0xF0, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x02, 0xFE, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x0F,
-    0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xFA, 0xAA, 0xAF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF0,
-    0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0xBF, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x0F, 0xD5, 0xBF, 0xF0, 0x00, 0x90, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xFB, 0xFD, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xD0, 0x07,
-    0xFC, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x0B, 0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x82, 0xFE,
-    0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFC,
-    0x03, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x3F, 0xE0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xEA, 0xAF, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0x45, 0x55, 0x40, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF5, 0xEA, 0xAA, 0x5F,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x02, 0x80, 0x00, 0x1B, 0xFF, 0xFF, 0x42,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFA, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFE,
-    0x00, 0xBF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-    0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x01, 0xFC, 0xFF, 0x82, 0xFF, 0x00, 0x01,
-    0xFC, 0x2F, 0xF0, 0xFF, 0xC0, 0x01, 0xFD, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0xFD, 0x02, 0xFF, 0x0F,
-    0xF8, 0x00, 0xFD, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0xFD, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0xFD, 0x00,
-    0x0F, 0xFC, 0x3F, 0xE0, 0xFD, 0x00, 0x03, 0xFE, 0x0B, 0xFC, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0xFF, 0xF4, 0x01, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x00, 0x06, 0xA5, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0xFF, 0xE0, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0xF4, 0x00, 0x0F,
-    0xF0, 0x03, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xD0, 0x03,
-    0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x41,
-    0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xE5, 0x55, 0x57, 0xFD,
-    0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x3F, 0xF8, 0x00, 0x1F, 0xE0, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xF8, 0x02, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x80, 0x00,
-    0x3F, 0xF8, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xC7, 0xF4, 0x00, 0x00,
-    0x2F, 0xFA, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x55,
-    0x55, 0x55, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0x95, 0x55, 0x55, 0x55, 0x43, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1A, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xE4, 0x03, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x1F,
-    0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00,
-    0x1F, 0xE0, 0x00, 0x7F, 0xE1, 0x55, 0xFF, 0x95, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xE5, 0x5B, 0xFD, 0x55, 0x50,
-    0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x07, 0xF8, 0x00,
-    0x00, 0x0F, 0xFD, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x15,
-    0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xF9, 0x55, 0x55, 0x55, 0x54, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xA4, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x55, 0x55, 0x55, 0x54,
-    0xBF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x55, 0x55, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x06, 0xFF, 0xD0, 0x00, 0x2F, 0xD0, 0x01, 0xFF,
-    0xC0, 0x00, 0x7F, 0x80, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFD, 0x00,
-    0x0B, 0xFC, 0x15, 0x5B, 0xFD, 0x55, 0x2F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0xFF, 0x95, 0x6F, 0xF4, 0x00,
-    0x01, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0xF8,
-    0x00, 0x00, 0x1F, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x05, 0x55, 0x55, 0x55,
-    0x0B, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x45, 0x55, 0x55, 0x55, 0x5B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF9, 0x55, 0x57, 0xFF,
-    0x80, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF,
-    0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F,
-    0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03,
-    0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03,
-    0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00,
-    0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00,
-    0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00,
-    0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xF5, 0x55, 0x5F, 0xF0, 0x1F, 0xFD, 0x00, 0x01, 0xFC, 0x02, 0xFF,
-    0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x3E, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x07, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x95, 0x55, 0x55, 0x54, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0x54, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x03, 0xF0, 0x78, 0x2F, 0xD3, 0xE3, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x3F, 0xFB, 0xFF, 0xFD, 0x1F, 0xC3, 0xE1, 0xFC, 0x0D, 0x07, 0xF0, 0x34,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x6A, 0x40, 0x01,
-    0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0x5B, 0xFC, 0x7F, 0x00, 0xBF, 0x2F, 0xC0, 0x1F, 0xCB,
-    0xF0, 0x03, 0xF2, 0xFC, 0x02, 0xFC, 0x3F, 0xD6, 0xFE, 0x0B, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-    0x06, 0xF9, 0x00, 0x1A, 0x81, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC, 0x7F, 0xE0, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xC0,
-    0x07, 0xFF, 0xF0, 0x02, 0xF8, 0x00, 0x16, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xF4, 0x07, 0xF0,
-    0x00, 0x00, 0xBF, 0x80, 0xBF, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0xFC,
-    0x00, 0x00, 0x03, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xFF, 0xD0,
-    0x07, 0xC0, 0xFF, 0xFD, 0x0B, 0xF0, 0xFF, 0xFF, 0xCB, 0xF8, 0x3F, 0x82, 0xFF, 0xF0, 0x1F, 0xC0,
-    0x3F, 0xF0, 0x0B, 0xE0, 0x03, 0xF8, 0x02, 0xFC, 0x02, 0xFF, 0x40, 0x7F, 0x42, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFC, 0xFF, 0x82, 0xFF, 0xFC, 0x0F, 0xF0, 0x2F, 0xF8, 0x00, 0xFC, 0x00, 0x50, 0x00, 0x06,
-    0x00, 0x00, 0x10, 0x00, 0x01, 0x40, 0x01, 0xFF, 0xC0, 0x0B, 0xFD, 0x01, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x7F, 0x43, 0xFF, 0xE0, 0xBF, 0x2F, 0xC0, 0x3F, 0xE0, 0x0F,
-    0xCB, 0xE0, 0x0B, 0xF0, 0x03, 0xF2, 0xF8, 0x03, 0xFF, 0x00, 0xFC, 0x7F, 0x03, 0xFF, 0xE0, 0xBF,
-    0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x82, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0,
-    0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A,
-    0x3F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F,
-    0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF,
-    0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x55, 0x40, 0x2A, 0x40, 0xA9, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x15, 0x40, 0x55,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x0B,
-    0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x02, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00, 0x01,
-    0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x03, 0xFD, 0x00,
-    0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC7, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xC2, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x00,
-    0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x2F, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0xE0,
-    0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFE, 0x56,
-    0xFF, 0xE0, 0xFF, 0x80, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0xFF, 0x5F, 0xE0, 0x00, 0x02, 0xFD,
-    0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0,
-    0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00,
-    0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB,
-    0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00,
-    0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07,
-    0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF,
-    0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00,
-    0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F,
-    0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4,
-    0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0x7F, 0x80, 0x00, 0x0B, 0xF5, 0xFF, 0x00, 0x00,
-    0x3F, 0xD3, 0xFE, 0x00, 0x02, 0xFF, 0x0B, 0xFF, 0x95, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xBA, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFB,
-    0xFC, 0x00, 0x02, 0xFF, 0x07, 0xD0, 0x00, 0x0F, 0xFC, 0x04, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x04, 0x07, 0xFD, 0x00, 0x00, 0xFC, 0x2F, 0xF0, 0x00, 0x0B, 0xFE, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x01, 0xA8, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00,
-    0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x01, 0x50, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x4B, 0xFF, 0x3F, 0xFC, 0xBF, 0xF0, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x07, 0xFE,
-    0x2F, 0xFC, 0xFF, 0xF1, 0xFF, 0x81, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01, 0xA8, 0x0B, 0xFE,
-    0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC2,
-    0xFF, 0x40, 0x00, 0x07, 0xFE, 0x01, 0x50, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xE4, 0x00, 0x3C, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0x80, 0x7F, 0xFF, 0xF8, 0x0E, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x14, 0x03, 0xFF, 0xF8, 0x00, 0x7D, 0x0F, 0xFF, 0xFF, 0x96, 0xFE, 0x2F, 0xE6, 0xFF,
-    0xFF, 0xFC, 0x2F, 0x40, 0x1F, 0xFF, 0xF0, 0x0A, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xA4, 0x00, 0x14, 0x03, 0xFF, 0xD0, 0x0F,
-    0xC3, 0xFF, 0xFE, 0x0B, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x03, 0xFF, 0xFD, 0x0F, 0x40, 0x1F,
-    0xFD, 0x00, 0x40, 0x00, 0x54, 0x00, 0x0B, 0xE0, 0x00, 0x60, 0x0F, 0xFF, 0x80, 0x3F, 0x0F, 0xFF,
-    0xFD, 0x2F, 0xC7, 0xFE, 0xFF, 0xFF, 0xF2, 0xF8, 0x0B, 0xFF, 0xF0, 0x2C, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x06, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA4, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0x6B, 0xFC, 0x20, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x2A, 0xAA, 0xBF,
-    0xE9, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xFF, 0xAA, 0x40, 0x03, 0xF0, 0x00,
-    0x00, 0x2F, 0x80, 0x02, 0xAA, 0xFE, 0xAA, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xAB,
-    0xFA, 0xAA, 0xA4, 0x2F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x55, 0x55,
-    0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xAA, 0xAA, 0xAA,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0xBF, 0xF9, 0x00, 0x2F, 0xFE, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xBF, 0xF8, 0x00, 0x7F,
-    0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x1F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0x40, 0x07, 0xFF, 0x90, 0x07,
-    0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x01, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x1B, 0xFF, 0x40,
-    0x00, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xFF,
-    0x00, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xD0,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF9,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xFD, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00,
-    0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFA, 0xAA, 0xA4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x9F, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x1F,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40,
-    0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0x00, 0x07, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xF0, 0x6A, 0xBF, 0xFA, 0xBF, 0xFF, 0x41, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFE, 0xAA, 0xAA, 0xA0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x2A, 0xAA, 0xAA, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x00, 0x01, 0xFF, 0x9F, 0xDB, 0xFD, 0x00, 0x01, 0xFE, 0x03, 0xF0, 0x2F, 0xD0, 0x00, 0xFD,
-    0x00, 0xFC, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x0F, 0xC0, 0x02,
-    0xF4, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC3, 0xE0, 0x00,
-    0x3F, 0x00, 0x02, 0xF1, 0xFE, 0xAA, 0xAF, 0xEA, 0xAA, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x0F,
-    0xC0, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x40,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0xD0, 0x02, 0xFC, 0x03, 0xF0,
-    0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0xFC, 0x6F, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x90, 0x1B, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xF1, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x2F, 0xE4, 0x00, 0x6F, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x90, 0x1B,
-    0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x7E, 0xBF, 0x00, 0x07, 0xF6, 0xF4, 0x2F, 0x0B, 0xF0, 0x07, 0xF4,
-    0x3E, 0x0F, 0xC0, 0xBF, 0x07, 0xF4, 0x0F, 0xC3, 0xE0, 0x0B, 0xF7, 0xF4, 0x02, 0xF1, 0xF4, 0x00,
-    0xBF, 0xF4, 0x00, 0x7D, 0x7D, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0x5F, 0x40, 0x07, 0xFF, 0x00, 0x07,
-    0xD3, 0xD0, 0x07, 0xFF, 0xF0, 0x01, 0xF0, 0xF8, 0x07, 0xF4, 0xBF, 0x00, 0xBC, 0x3F, 0x07, 0xF4,
-    0x0B, 0xF0, 0x3F, 0x07, 0xD7, 0xF4, 0x00, 0xBF, 0x1F, 0x40, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xC0,
-    0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0x00,
-    0x6F, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x90, 0x1B, 0xFD, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x7E, 0x00, 0x00, 0x07, 0xF6, 0xF4, 0x2F, 0x00, 0x00, 0x07, 0xF4, 0x3E, 0x0F, 0xC0,
-    0x00, 0x07, 0xF4, 0x0F, 0xC3, 0xE0, 0x00, 0x07, 0xF4, 0x02, 0xF1, 0xF4, 0x00, 0x07, 0xF4, 0x00,
-    0x7D, 0x7D, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0x5F, 0x40, 0x07, 0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x07,
-    0xF4, 0x00, 0x01, 0xF0, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0xBC, 0x3F, 0x07, 0xF4, 0x00, 0x00, 0x3F,
-    0x07, 0xD7, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00,
-    0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x6F, 0xE0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x1A, 0x81, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC, 0x7F, 0xE0, 0x15, 0x00, 0x0A, 0x90, 0x00, 0x2A,
-    0x40, 0x00, 0xA9, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFD, 0x00,
-    0x7F, 0xF5, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0x1F, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0xF9, 0xBE, 0x40, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE4, 0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x2F,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC2, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x07, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_16_boldBitmaps[38855] = {
+    0x95, 0x55, 0x3D, 0x73, 0xDD, 0x44, 0x14, 0xBD, 0x92, 0xC6, 0xD6, 0x8C, 0x35, 0xC3, 0xD2, 0xB8,
+    0x60, 0x52, 0xA8, 0x49, 0xAF, 0x3A, 0x8D, 0x57, 0x26, 0x65, 0x0A, 0x5C, 0xBC, 0x07, 0x05, 0x05,
+    0x0D, 0x0D, 0x93, 0xC2, 0x7F, 0x00, 0xD0, 0x33, 0x2E, 0x52, 0x50, 0xE0, 0x86, 0x9E, 0x96, 0xA4,
+    0xF0, 0x2F, 0x80, 0xDD, 0x89, 0x8B, 0x14, 0x69, 0xDE, 0x90, 0x92, 0xC2, 0x9A, 0xC1, 0xC0, 0x0C,
+    0x0D, 0x8B, 0x11, 0x41, 0x71, 0x56, 0xBA, 0x9C, 0x23, 0x3D, 0x13, 0x67, 0xA0, 0x00, 0x8D, 0x76,
+    0xF5, 0x76, 0xF7, 0xEE, 0xBD, 0xF7, 0x9C, 0xFB, 0xF1, 0x76, 0x4E, 0xF4, 0xC1, 0x58, 0x75, 0xEE,
+    0xB1, 0x16, 0xB1, 0x0A, 0xD3, 0xA7, 0x0C, 0x8D, 0x1F, 0xB3, 0xDE, 0xB4, 0xD6, 0xBB, 0xA4, 0x16,
+    0xD9, 0xAA, 0xF5, 0x89, 0x96, 0xD1, 0x86, 0xB7, 0x64, 0x67, 0xF5, 0xB5, 0x3D, 0x1B, 0x9A, 0xB3,
+    0xE8, 0x9E, 0x44, 0x77, 0x16, 0xF1, 0xA3, 0x39, 0xE6, 0x6B, 0xF1, 0xDE, 0xED, 0xEF, 0xA4, 0xAD,
+    0xE0, 0x49, 0xFB, 0x1C, 0xDF, 0x31, 0x8B, 0x22, 0xB6, 0x1E, 0x45, 0x4A, 0xDF, 0xD4, 0x52, 0x84,
+    0xCA, 0x27, 0x8F, 0xC6, 0xD3, 0xAB, 0x95, 0xE2, 0x09, 0x16, 0x53, 0x94, 0xCA, 0x37, 0x22, 0xA6,
+    0xAD, 0xBC, 0x64, 0x9D, 0x69, 0x25, 0x89, 0x59, 0x27, 0xBB, 0xFA, 0xEE, 0xB0, 0x28, 0x71, 0x3C,
+    0x16, 0x94, 0xDC, 0x7F, 0xFF, 0x8F, 0xC3, 0x1F, 0xEB, 0x34, 0xE6, 0x01, 0x2A, 0xD3, 0x57, 0x2A,
+    0x6D, 0x2D, 0xC9, 0xC1, 0x56, 0x2D, 0x9B, 0xE7, 0x53, 0x8C, 0x12, 0xAB, 0x7C, 0x2D, 0x92, 0x74,
+    0x22, 0xDB, 0xDA, 0x8A, 0x51, 0x5D, 0x61, 0xF4, 0xE6, 0xF9, 0xA5, 0xE6, 0xDD, 0xC7, 0xD5, 0xE3,
+    0x58, 0x65, 0xAD, 0xBB, 0xE7, 0xBF, 0xAA, 0x2E, 0x83, 0xE4, 0x30, 0x2F, 0xAA, 0x35, 0xA4, 0xA0,
+    0xCF, 0x69, 0x27, 0x29, 0x57, 0x56, 0xC3, 0x6D, 0xF3, 0x79, 0xDC, 0xCB, 0x5A, 0x2D, 0x7D, 0x6F,
+    0x9F, 0x76, 0x7B, 0xE6, 0x52, 0xCD, 0x3B, 0x1D, 0xFC, 0x8D, 0x39, 0x74, 0x49, 0xA5, 0x17, 0xB0,
+    0xB4, 0x7A, 0x65, 0x49, 0xBE, 0xC1, 0xA8, 0x60, 0xBA, 0x58, 0xCB, 0x3F, 0x9E, 0x37, 0x20, 0x03,
+    0x4F, 0xE8, 0xB7, 0x53, 0x2F, 0x76, 0x25, 0xE5, 0x4F, 0x23, 0xB8, 0x10, 0xD0, 0x1B, 0x92, 0x41,
+    0xA4, 0xA9, 0x9D, 0x58, 0x2F, 0x79, 0xC8, 0x3B, 0x22, 0x74, 0xD8, 0x80, 0x3B, 0x05, 0x96, 0xA5,
+    0x9F, 0x96, 0x60, 0x44, 0xF2, 0xAE, 0x08, 0x4E, 0x3E, 0x82, 0xE0, 0x68, 0xD6, 0x6E, 0x80, 0xA3,
+    0x8F, 0x7B, 0xAB, 0x5D, 0x01, 0x1A, 0xF3, 0xAE, 0xF1, 0xB7, 0x2E, 0x4C, 0x3B, 0x51, 0x93, 0x44,
+    0xB3, 0x2E, 0xE1, 0x85, 0x3D, 0x1A, 0x64, 0xD2, 0x52, 0xAE, 0xC1, 0xAA, 0x0C, 0xC9, 0x40, 0x53,
+    0x95, 0x2F, 0x79, 0x9A, 0x77, 0x33, 0x8F, 0x2A, 0xA6, 0x6B, 0xE0, 0xCF, 0x9A, 0x98, 0xE1, 0x0F,
+    0x76, 0x30, 0x4A, 0x68, 0x59, 0xC0, 0xF1, 0x37, 0x5F, 0x83, 0x71, 0xD8, 0x73, 0x76, 0x4A, 0x84,
+    0x8C, 0x1B, 0xFC, 0xF6, 0x8A, 0xD9, 0x4E, 0xE6, 0x4C, 0xA0, 0xEB, 0x59, 0xA4, 0x56, 0xD1, 0xFD,
+    0x81, 0x07, 0x2D, 0xE7, 0x22, 0x7E, 0xC2, 0x74, 0x50, 0x46, 0x29, 0xD3, 0x50, 0x68, 0xCC, 0x74,
+    0xC8, 0x54, 0x53, 0x75, 0xFE, 0xF0, 0x6A, 0x5F, 0x4D, 0x4C, 0xA2, 0xB8, 0x23, 0x45, 0x16, 0xD8,
+    0xB6, 0x8A, 0xA5, 0x37, 0x7D, 0xAA, 0xDF, 0x87, 0x4C, 0xC1, 0x32, 0x0E, 0xD6, 0xA9, 0x0E, 0x52,
+    0xE2, 0xD5, 0x8B, 0x54, 0xAF, 0x4E, 0x55, 0x2F, 0x2A, 0x66, 0xC4, 0x98, 0x38, 0xED, 0x2B, 0x98,
+    0x5F, 0xD6, 0xB2, 0x94, 0x1D, 0xE4, 0xDF, 0x53, 0xA6, 0x63, 0xF3, 0xA0, 0xB7, 0xC7, 0xDD, 0x9D,
+    0xD9, 0x61, 0x53, 0x8B, 0xD6, 0x06, 0x3A, 0x7C, 0x1E, 0xE1, 0x65, 0x42, 0xB0, 0xA0, 0x2F, 0x1D,
+    0xE7, 0x2F, 0xD6, 0xD8, 0xAF, 0x5A, 0x71, 0x2B, 0x6C, 0x15, 0x51, 0xCA, 0x00, 0x44, 0xB8, 0x92,
+    0x8D, 0x3C, 0x80, 0x4C, 0x15, 0x70, 0x0D, 0xD7, 0x05, 0x51, 0xD3, 0x55, 0x02, 0x08, 0x00, 0x57,
+    0xCF, 0x9A, 0x71, 0x50, 0x75, 0xBC, 0x95, 0xC2, 0x09, 0x9C, 0xE0, 0x26, 0xB7, 0x02, 0x88, 0x10,
+    0xD3, 0x4B, 0xD1, 0x53, 0x07, 0xDE, 0xEC, 0xFA, 0x9D, 0x97, 0xD8, 0x2F, 0x3A, 0xCA, 0x94, 0x93,
+    0x6E, 0x4B, 0x7B, 0x70, 0x24, 0x1B, 0x78, 0xC9, 0xB6, 0x4C, 0xAA, 0x64, 0xF6, 0x3E, 0x0B, 0xD2,
+    0x8E, 0xF2, 0xAD, 0x15, 0xFB, 0x6B, 0x8D, 0x60, 0x7B, 0x04, 0xFA, 0x70, 0x88, 0xF6, 0x7C, 0xBF,
+    0x78, 0x16, 0xE4, 0x04, 0xCC, 0xEE, 0xB1, 0x28, 0x99, 0x1E, 0x53, 0x66, 0x21, 0x9D, 0x10, 0x5C,
+    0x2E, 0x77, 0x1E, 0xE9, 0xC3, 0x06, 0x0C, 0x81, 0xA5, 0x17, 0x4B, 0xB7, 0xAC, 0x5F, 0x3F, 0x9D,
+    0x84, 0xF9, 0x7C, 0x08, 0x48, 0x36, 0x14, 0x11, 0xD8, 0xB5, 0xB6, 0xBE, 0x42, 0x96, 0x98, 0x36,
+    0x63, 0xED, 0xEE, 0x2E, 0xDF, 0x56, 0x3D, 0x57, 0x6D, 0x34, 0xEE, 0x2E, 0x0F, 0xB6, 0x4F, 0xDC,
+    0x33, 0xFD, 0x62, 0x64, 0xE1, 0x33, 0xBE, 0x0C, 0xA8, 0x90, 0x1C, 0x22, 0x20, 0x04, 0x22, 0x07,
+    0x85, 0xCC, 0x25, 0x81, 0x2E, 0x42, 0x21, 0xD0, 0xBF, 0x45, 0x40, 0x30, 0x61, 0xCE, 0x22, 0xA8,
+    0x57, 0xBD, 0x21, 0xD2, 0x33, 0x6F, 0x6E, 0x88, 0x60, 0x2C, 0xE9, 0xDB, 0xF6, 0x48, 0x41, 0xD4,
+    0x0C, 0x62, 0x1D, 0xF0, 0x43, 0x5B, 0x83, 0x84, 0xF7, 0xAE, 0xCD, 0xF4, 0x18, 0x51, 0x43, 0x1F,
+    0x12, 0x13, 0x5D, 0x2B, 0xF6, 0x39, 0x34, 0xEA, 0xF9, 0x80, 0x20, 0x34, 0x08, 0xC6, 0xC0, 0xEA,
+    0xFA, 0x73, 0xB3, 0x95, 0x29, 0xE2, 0x33, 0x49, 0x35, 0xBF, 0xA9, 0x4F, 0xF5, 0xAE, 0xAE, 0x4A,
+    0x54, 0xEF, 0x91, 0xAE, 0xD1, 0x0E, 0x46, 0xF6, 0x85, 0x16, 0x9A, 0x98, 0xA1, 0x93, 0x49, 0x02,
+    0x59, 0xCB, 0xA1, 0xAE, 0x2A, 0x1C, 0xB2, 0x13, 0x28, 0x12, 0x9D, 0x59, 0x5B, 0xB0, 0x6A, 0x80,
+    0xC5, 0xFD, 0x97, 0x65, 0x39, 0x1E, 0xA0, 0x6B, 0x05, 0x78, 0x7C, 0x86, 0x21, 0xB2, 0x03, 0x20,
+    0xD8, 0xA8, 0xD1, 0x35, 0x86, 0x44, 0x5F, 0xA2, 0x56, 0xFB, 0x1C, 0x9E, 0x88, 0xED, 0x6D, 0x9B,
+    0xEA, 0x67, 0x83, 0x54, 0xFD, 0x56, 0x9D, 0xB1, 0x36, 0x1A, 0xF0, 0x60, 0x06, 0x96, 0x08, 0x78,
+    0x72, 0x24, 0x85, 0x54, 0x93, 0x53, 0x6E, 0x28, 0x19, 0xEA, 0xAE, 0x25, 0xF0, 0xB0, 0x75, 0xFE,
+    0xC0, 0x3A, 0x00, 0x0E, 0x08, 0xDC, 0x7F, 0x41, 0xBE, 0xBA, 0x94, 0xBD, 0x52, 0x7F, 0xD1, 0xE0,
+    0xBC, 0x41, 0x25, 0xA5, 0xBA, 0xEF, 0x27, 0x52, 0x6D, 0x98, 0x46, 0x02, 0xBD, 0xB7, 0x00, 0x0D,
+    0x3D, 0xD5, 0x4F, 0x25, 0x7C, 0x3B, 0xA7, 0xF2, 0xC9, 0x34, 0xAC, 0xE5, 0x3A, 0x9B, 0xCF, 0x71,
+    0xFA, 0x81, 0xB6, 0x0E, 0x0C, 0xC1, 0xF7, 0xF5, 0xD4, 0x12, 0x77, 0x17, 0x53, 0xD2, 0xDC, 0x97,
+    0xD9, 0x29, 0x80, 0x62, 0x81, 0xEB, 0xD4, 0x10, 0xD8, 0xDE, 0xA6, 0xAB, 0x98, 0xCC, 0x4B, 0x4C,
+    0xD5, 0xEF, 0x98, 0x9A, 0x33, 0x16, 0x06, 0xB0, 0xA6, 0x63, 0xC6, 0x4A, 0xC3, 0x64, 0x58, 0xD5,
+    0xF6, 0x0A, 0xF9, 0x69, 0xAF, 0x31, 0x28, 0x9B, 0xFC, 0x74, 0x59, 0xFE, 0x7D, 0x4A, 0x1E, 0x22,
+    0x40, 0xCB, 0x65, 0x8D, 0x8C, 0x5E, 0x43, 0x16, 0xFD, 0x4E, 0x87, 0x74, 0xB2, 0xBB, 0xC1, 0x45,
+    0xCF, 0x33, 0xC6, 0x91, 0x8D, 0x19, 0x2A, 0xFD, 0xF6, 0x29, 0x7B, 0x58, 0x35, 0xB9, 0xB5, 0xBE,
+    0x49, 0x5B, 0x0D, 0x2E, 0x3D, 0x46, 0x0B, 0x12, 0xF8, 0xDF, 0x13, 0xA6, 0x1C, 0x20, 0x7D, 0x5B,
+    0x8B, 0x39, 0xEB, 0x08, 0x0E, 0x65, 0x0A, 0x53, 0x89, 0x22, 0x72, 0x0D, 0x36, 0xCC, 0x86, 0x94,
+    0x4D, 0x80, 0x16, 0xC4, 0x3A, 0x32, 0x2F, 0xD9, 0xC3, 0xB4, 0xB3, 0x80, 0x04, 0xA0, 0x06, 0x7F,
+    0x8C, 0x82, 0x3A, 0x91, 0x62, 0x84, 0x3D, 0xF7, 0x9D, 0xAE, 0x8A, 0x01, 0x49, 0xAA, 0x5E, 0xBB,
+    0xA6, 0xA7, 0x20, 0xB3, 0xC0, 0xE3, 0x1A, 0xE2, 0xB8, 0x0B, 0x36, 0x81, 0x88, 0x81, 0xFB, 0x59,
+    0xE7, 0x3A, 0x1D, 0xDD, 0x97, 0xEF, 0x29, 0xEA, 0x53, 0xEF, 0xC1, 0x1F, 0xDF, 0xCD, 0xD8, 0xDA,
+    0x19, 0x1F, 0xB3, 0x8B, 0x18, 0x99, 0x69, 0x73, 0x84, 0x90, 0x2D, 0xCA, 0x6A, 0xD9, 0x08, 0x94,
+    0x3C, 0x1C, 0x37, 0x2D, 0x96, 0x37, 0x59, 0x52, 0xB2, 0x90, 0xFF, 0xF1, 0xFC, 0x05, 0x95, 0x55,
+    0xB1, 0x8E, 0xE4, 0x44, 0x10, 0x2D, 0x8F, 0xC5, 0x8E, 0x84, 0x25, 0x9A, 0xE0, 0x0E, 0x09, 0x36,
+    0x70, 0x42, 0x42, 0x00, 0xFE, 0x84, 0x6E, 0xE0, 0x03, 0xB8, 0x80, 0x21, 0x38, 0x02, 0x12, 0x22,
+    0x08, 0xF8, 0x04, 0x5B, 0xFC, 0x00, 0x9B, 0xEC, 0x27, 0x9C, 0x80, 0xD9, 0xE0, 0xFE, 0x00, 0x5B,
+    0x4B, 0x40, 0x70, 0xC1, 0xFA, 0xC4, 0x0F, 0x18, 0x6E, 0xA3, 0x23, 0xC0, 0x12, 0x46, 0xF8, 0x96,
+    0x9E, 0x2E, 0xDE, 0x2B, 0xCF, 0xCE, 0xED, 0x1E, 0x10, 0x9C, 0xB5, 0xD3, 0xDB, 0xEE, 0xEA, 0xAA,
+    0x7A, 0x55, 0xF5, 0xAA, 0x2C, 0x47, 0xA9, 0x91, 0xB5, 0x6A, 0xB3, 0x52, 0x55, 0xA9, 0xFF, 0xAC,
+    0x67, 0x17, 0x45, 0x3B, 0x6D, 0x5C, 0x74, 0x33, 0x37, 0x5D, 0x39, 0x17, 0xFA, 0xA1, 0x8A, 0x57,
+    0xED, 0x44, 0x75, 0x90, 0x5C, 0x35, 0x64, 0xAA, 0x3B, 0xA9, 0x7F, 0xD1, 0xC9, 0xCD, 0xB9, 0x9E,
+    0xAB, 0xB8, 0x9D, 0x1F, 0xA5, 0x7D, 0xA2, 0xB2, 0x4E, 0xD8, 0xE8, 0xCF, 0xDA, 0x57, 0xB1, 0x84,
+    0xC1, 0x50, 0xAB, 0xF6, 0xD2, 0x42, 0x4B, 0x36, 0x41, 0xE4, 0x28, 0x05, 0x29, 0xE0, 0x26, 0xA7,
+    0x7A, 0xAB, 0x3A, 0x96, 0x71, 0xAD, 0x5F, 0x6B, 0x28, 0xE3, 0xA2, 0x25, 0x05, 0xD5, 0xEB, 0x27,
+    0x1A, 0xD6, 0xA9, 0x8A, 0x52, 0x0F, 0x3A, 0x15, 0x09, 0xE0, 0xB4, 0x87, 0xB1, 0x28, 0xC7, 0x84,
+    0x20, 0x7E, 0x12, 0x18, 0x11, 0x59, 0xF1, 0x45, 0x27, 0xC9, 0xDA, 0x44, 0x49, 0x93, 0xD3, 0x95,
+    0xC3, 0x4F, 0xEE, 0xC2, 0x95, 0x48, 0xFD, 0xA3, 0x7E, 0x93, 0xFC, 0x5C, 0x37, 0x72, 0xE3, 0x79,
+    0xEB, 0x03, 0xFD, 0x08, 0x87, 0xDA, 0x7D, 0xCE, 0x37, 0x0D, 0xED, 0xE8, 0x23, 0x8C, 0xA9, 0xBC,
+    0xF8, 0xBC, 0x03, 0xEF, 0x2E, 0xAE, 0x54, 0xDA, 0xC6, 0x77, 0xE5, 0x50, 0x8C, 0xEB, 0x29, 0x9F,
+    0x65, 0xDE, 0x4B, 0xE1, 0xA0, 0x64, 0xDA, 0x24, 0x03, 0x80, 0x7A, 0x27, 0x95, 0x86, 0x42, 0x1B,
+    0x01, 0x78, 0x22, 0xE2, 0x89, 0x94, 0xCA, 0x0B, 0x03, 0x60, 0xE2, 0xA0, 0x05, 0xD4, 0x77, 0xA9,
+    0xB8, 0xDD, 0x6E, 0xBF, 0x45, 0x3C, 0xBF, 0xE3, 0x77, 0xBA, 0xD9, 0x6C, 0xF6, 0xE6, 0x5E, 0xC5,
+    0x31, 0x32, 0x95, 0x70, 0x7A, 0x85, 0xED, 0xC9, 0xEB, 0x38, 0x83, 0xAB, 0x22, 0x3D, 0x37, 0x93,
+    0x1D, 0xEC, 0xE2, 0xB0, 0x9A, 0x11, 0x71, 0x58, 0x6B, 0xBF, 0x77, 0x9F, 0x69, 0x90, 0xBC, 0x3F,
+    0x60, 0x2F, 0x12, 0xD0, 0x44, 0xE4, 0xA3, 0x6B, 0x35, 0xBE, 0xF6, 0x09, 0x2C, 0x38, 0x00, 0x83,
+    0xAE, 0x0F, 0xE2, 0x06, 0x39, 0x9E, 0xB2, 0x16, 0x41, 0xA7, 0x5C, 0x93, 0xE8, 0x2C, 0xBE, 0x97,
+    0x02, 0xF6, 0xE1, 0xEF, 0xED, 0x45, 0xFD, 0x9E, 0xD9, 0x83, 0x4F, 0x3F, 0x4B, 0x01, 0x2D, 0x4B,
+    0x95, 0x7C, 0x99, 0x4E, 0xF8, 0xEF, 0x2B, 0x55, 0x26, 0xC1, 0x29, 0x4B, 0x88, 0x8B, 0x69, 0xAB,
+    0x04, 0x94, 0x0C, 0xD8, 0x0A, 0xAE, 0xA8, 0x52, 0x4E, 0x44, 0x01, 0x1E, 0x85, 0xA3, 0x67, 0xE2,
+    0xA6, 0x62, 0x06, 0x5F, 0xA4, 0x1C, 0x7C, 0x57, 0xFD, 0xBD, 0x13, 0x7F, 0x9E, 0x24, 0xAD, 0x21,
+    0x74, 0x53, 0x3E, 0xBA, 0x31, 0x8F, 0xBE, 0xCB, 0x82, 0xEF, 0xDC, 0x88, 0x22, 0xBC, 0x01, 0x9E,
+    0xFD, 0x14, 0x51, 0x5E, 0x88, 0xCB, 0x31, 0xD3, 0x87, 0x63, 0x3E, 0xD7, 0x10, 0x41, 0xF3, 0x31,
+    0xD8, 0xD9, 0xA0, 0x52, 0xEB, 0x98, 0x69, 0x91, 0x3E, 0x1B, 0xA1, 0xAD, 0x64, 0x98, 0x1F, 0x0A,
+    0x7D, 0xA4, 0x60, 0x5F, 0x77, 0x34, 0x1F, 0x7D, 0x87, 0xFC, 0x77, 0x06, 0xD7, 0xA0, 0xE0, 0xC9,
+    0xF9, 0x9E, 0x75, 0xF8, 0x7F, 0x09, 0xA6, 0xF0, 0x5C, 0x7F, 0x83, 0x75, 0x20, 0xC7, 0xD3, 0x2C,
+    0x01, 0x0D, 0xBC, 0x98, 0x6D, 0xEE, 0x2D, 0xE1, 0xDF, 0xB1, 0xB5, 0xB2, 0xC3, 0xF5, 0x42, 0x0C,
+    0xE6, 0x7E, 0x29, 0x05, 0x0D, 0x46, 0xBE, 0x78, 0x12, 0x4D, 0x8A, 0xBF, 0xEC, 0x02, 0x59, 0x0B,
+    0xF9, 0x39, 0x2F, 0xE4, 0xB1, 0xE4, 0x85, 0x3A, 0xF0, 0x42, 0x31, 0xB2, 0x86, 0x92, 0xA4, 0xC6,
+    0x85, 0xEA, 0xEA, 0x8C, 0x75, 0x52, 0x52, 0x59, 0x50, 0x6E, 0x20, 0x73, 0x57, 0xDB, 0x87, 0x2C,
+    0x1F, 0x18, 0x32, 0x4A, 0xD5, 0xD3, 0x5F, 0x0E, 0xA1, 0x9F, 0x57, 0xC8, 0x72, 0xA9, 0x33, 0x3A,
+    0x07, 0xFD, 0x72, 0x81, 0x14, 0xA3, 0x92, 0x92, 0x7D, 0x6C, 0x70, 0x27, 0x21, 0x76, 0xF6, 0x8F,
+    0x76, 0xB9, 0x66, 0xDA, 0xE7, 0xC8, 0xDA, 0x78, 0x7B, 0x19, 0xB0, 0xD4, 0x90, 0x3E, 0xD0, 0x40,
+    0x87, 0xE6, 0x15, 0xF7, 0xCE, 0x74, 0xA2, 0x14, 0xDC, 0x10, 0xF7, 0x1F, 0x4B, 0x85, 0xE5, 0x7D,
+    0x9D, 0x2A, 0x5C, 0x1E, 0x68, 0x3E, 0xE0, 0x77, 0x79, 0xCD, 0xAA, 0x57, 0x1E, 0x58, 0xF6, 0x2E,
+    0x41, 0x76, 0x96, 0x47, 0xC9, 0xB0, 0xCB, 0x63, 0x76, 0x4F, 0x1E, 0x31, 0x33, 0xF2, 0x19, 0xAC,
+    0x5C, 0x4D, 0xEC, 0xCE, 0x60, 0xE9, 0xA8, 0x0F, 0x4B, 0xFB, 0xC2, 0xC2, 0x6C, 0xD6, 0x64, 0x91,
+    0x8F, 0x96, 0x49, 0xCB, 0xED, 0x20, 0x6F, 0x16, 0x24, 0xD5, 0x92, 0x9F, 0x96, 0x34, 0x2B, 0xD4,
+    0xBA, 0x19, 0x51, 0x33, 0x72, 0x86, 0x8E, 0xF9, 0xC1, 0xD8, 0x27, 0x0B, 0x9E, 0x51, 0x61, 0xC0,
+    0x20, 0x4A, 0xB4, 0x02, 0x02, 0x86, 0x6C, 0xE4, 0x5A, 0xCF, 0x5C, 0x19, 0x64, 0xB0, 0x88, 0x82,
+    0x94, 0x37, 0x56, 0xF7, 0xAF, 0x93, 0x6A, 0xB9, 0x3F, 0x99, 0xAE, 0x59, 0x60, 0xAA, 0x90, 0x37,
+    0x58, 0x3E, 0x6D, 0x95, 0xF1, 0x02, 0x0C, 0x3D, 0x9E, 0xC8, 0xCD, 0x84, 0xF0, 0x64, 0x26, 0x8E,
+    0xB9, 0x5D, 0xB2, 0x71, 0x7A, 0x46, 0x7B, 0x2B, 0x2E, 0x99, 0xD9, 0x34, 0x63, 0xB2, 0x5F, 0x9A,
+    0xBB, 0x56, 0x85, 0x70, 0x58, 0x78, 0x76, 0x90, 0xEE, 0x17, 0x53, 0xBB, 0xB6, 0x72, 0xFA, 0xA9,
+    0x0D, 0xD1, 0x78, 0x70, 0x34, 0x71, 0x77, 0xC1, 0x2C, 0x71, 0xD3, 0xFB, 0x67, 0x5F, 0x20, 0x5D,
+    0xC1, 0xF5, 0x48, 0x3A, 0x37, 0x45, 0xC7, 0xEC, 0x9B, 0xAD, 0x65, 0xF3, 0xF4, 0x07, 0x8E, 0xED,
+    0xD1, 0x9C, 0xF9, 0xB4, 0x3D, 0xB9, 0x21, 0xBA, 0xB5, 0x99, 0x59, 0x80, 0x1D, 0xF3, 0x8D, 0x31,
+    0xCC, 0x7E, 0x46, 0xB5, 0xBF, 0x0F, 0xA4, 0x3F, 0x02, 0xCF, 0x2C, 0x7C, 0xE3, 0x04, 0x66, 0x59,
+    0xA6, 0x4D, 0x09, 0xC6, 0x62, 0x72, 0x80, 0xAD, 0x13, 0xFB, 0xC3, 0x99, 0xD7, 0x3B, 0x4B, 0xE3,
+    0x2D, 0x0D, 0x63, 0x1D, 0xB0, 0x14, 0x1B, 0x53, 0x1A, 0x06, 0x1E, 0x29, 0x8D, 0x63, 0xA4, 0x3B,
+    0x9D, 0xEB, 0x89, 0x4D, 0x0A, 0x4F, 0x2B, 0xCD, 0x51, 0xF5, 0x22, 0x72, 0xBC, 0x55, 0x23, 0x06,
+    0xD2, 0x7D, 0xED, 0x9C, 0xD5, 0xB5, 0x30, 0x0E, 0xAC, 0x16, 0x28, 0xAC, 0x7F, 0x6B, 0xBC, 0xF8,
+    0x03, 0x19, 0x70, 0x34, 0xA6, 0xA1, 0x02, 0x5C, 0xA8, 0xAD, 0x99, 0x49, 0xD6, 0x14, 0x5F, 0x20,
+    0xE1, 0xF8, 0xF5, 0x66, 0x9C, 0xE0, 0x72, 0xA3, 0x87, 0x89, 0x92, 0xF1, 0xD0, 0xAB, 0x2E, 0x9F,
+    0xB0, 0xEB, 0x7E, 0xD0, 0x45, 0xF4, 0x7F, 0x5A, 0xB7, 0x0D, 0xF2, 0xBB, 0x17, 0x4A, 0xE3, 0xC1,
+    0xAF, 0x0B, 0x8C, 0x0B, 0x56, 0xC0, 0xFA, 0x30, 0x59, 0x41, 0x50, 0xBA, 0xE6, 0x65, 0xFF, 0x4A,
+    0x2A, 0xA6, 0x85, 0xF5, 0xB4, 0x09, 0x83, 0x69, 0x01, 0xB0, 0x5B, 0xEA, 0x63, 0x90, 0x5E, 0xF6,
+    0x35, 0x1A, 0xF2, 0x0C, 0xB0, 0x39, 0x7D, 0x20, 0xE1, 0x10, 0x6C, 0x23, 0x6A, 0xDC, 0x8B, 0xC7,
+    0xDD, 0xF7, 0xC2, 0xF3, 0xEF, 0xDC, 0x3F, 0xAD, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0x7B,
+    0x45, 0x5C, 0xB8, 0xD8, 0x9E, 0x14, 0xDB, 0xD3, 0xF8, 0x27, 0xAC, 0x43, 0x0A, 0x8A, 0x14, 0x47,
+    0x93, 0x26, 0x4D, 0x6A, 0x48, 0x91, 0x9F, 0xB0, 0xFE, 0x07, 0xB9, 0x22, 0xE9, 0x29, 0xE8, 0x69,
+    0xA8, 0xB1, 0x73, 0x57, 0x50, 0x50, 0xF0, 0x25, 0x14, 0x14, 0x34, 0x16, 0x39, 0x29, 0xE5, 0xAD,
+    0x84, 0xA3, 0x98, 0xB0, 0xF6, 0xF0, 0xDE, 0xF8, 0x43, 0xA2, 0x05, 0xC5, 0xD2, 0xCD, 0xF9, 0x9B,
+    0xD9, 0x9D, 0x7D, 0xF3, 0xE6, 0xCD, 0x7A, 0xD4, 0xE2, 0x75, 0x53, 0x2D, 0x41, 0xCB, 0xA8, 0x73,
+    0xA3, 0xB3, 0xD3, 0xDE, 0xA9, 0xC0, 0xFA, 0x42, 0x1B, 0x33, 0xAD, 0x4E, 0xB0, 0xF7, 0x77, 0x81,
+    0xBD, 0x58, 0x69, 0xD3, 0x4C, 0x0B, 0x37, 0xAD, 0xBD, 0x8F, 0xE6, 0x7F, 0xBA, 0xD9, 0x1A, 0xED,
+    0xB9, 0xDE, 0x76, 0xDD, 0x53, 0xCB, 0x30, 0x5A, 0xB6, 0x8E, 0xC9, 0x7B, 0xAF, 0xA7, 0xA0, 0xAB,
+    0xD3, 0x75, 0xD4, 0x4D, 0x14, 0x4F, 0x91, 0xAE, 0x08, 0x9E, 0xEA, 0x92, 0x1E, 0xB8, 0x60, 0x46,
+    0x5D, 0x98, 0x6A, 0xA0, 0xE9, 0xFF, 0xAF, 0xF9, 0x9E, 0xA6, 0xC0, 0x54, 0x34, 0x0E, 0xE6, 0xC5,
+    0x13, 0x94, 0xAA, 0x2C, 0x56, 0x75, 0xE5, 0xD9, 0x0B, 0x0A, 0xE0, 0x91, 0x83, 0x07, 0x8C, 0x06,
+    0xEF, 0x80, 0x26, 0x1D, 0x0E, 0xF7, 0x00, 0xAE, 0x28, 0x39, 0xEA, 0xD4, 0xC0, 0x85, 0x25, 0x80,
+    0x3F, 0x8B, 0x7B, 0xBF, 0xCB, 0x86, 0xCA, 0xFC, 0x6F, 0xC5, 0xFD, 0x81, 0x9D, 0xE9, 0x71, 0xEE,
+    0x7E, 0x2E, 0x52, 0x95, 0x78, 0xDA, 0xBB, 0x2C, 0x6D, 0xD6, 0xEB, 0x3C, 0x4E, 0xD2, 0xBD, 0xD4,
+    0x70, 0x85, 0xC3, 0xD5, 0x6D, 0x3F, 0x34, 0x9B, 0xB8, 0xE2, 0xFF, 0xCA, 0x01, 0x49, 0x73, 0xD0,
+    0x09, 0xE4, 0xC5, 0x29, 0xEE, 0x82, 0xE2, 0x60, 0xB2, 0xDB, 0xA5, 0x59, 0x2B, 0x9D, 0x40, 0x78,
+    0x98, 0xF1, 0x03, 0x94, 0x8F, 0x7D, 0xBB, 0x88, 0x4E, 0xAD, 0x7E, 0x13, 0xA6, 0xA0, 0x8B, 0xEA,
+    0x49, 0x2A, 0xD5, 0xB7, 0x44, 0x0A, 0x88, 0x3D, 0x20, 0x49, 0xA2, 0x7B, 0xAA, 0x55, 0x5F, 0xC3,
+    0xD1, 0x80, 0xB1, 0x84, 0xE0, 0x38, 0x00, 0xA6, 0xD4, 0x3B, 0x8A, 0xDF, 0xA5, 0x5D, 0x85, 0x35,
+    0x75, 0x38, 0x0D, 0xFF, 0x18, 0x1A, 0x57, 0x86, 0x8A, 0x2E, 0x0C, 0x65, 0xCD, 0x0C, 0x5D, 0xE9,
+    0xCC, 0x90, 0xD3, 0xD7, 0x0C, 0x39, 0xFD, 0x89, 0xA1, 0x46, 0x6F, 0x89, 0xD1, 0x83, 0x16, 0x51,
+    0x64, 0x61, 0xC8, 0x88, 0xF1, 0x59, 0x48, 0x42, 0x9C, 0x90, 0x73, 0x68, 0xC1, 0x52, 0x42, 0x05,
+    0x20, 0x6A, 0x5C, 0x4D, 0x0D, 0xC0, 0xC9, 0xE7, 0x12, 0x7F, 0x9F, 0x3C, 0x87, 0xA9, 0x4D, 0x1C,
+    0xDD, 0xB9, 0xA1, 0xC8, 0x56, 0xEB, 0x4D, 0xD0, 0x53, 0x03, 0x8C, 0x9A, 0x3D, 0x5B, 0xBD, 0x74,
+    0xA0, 0x36, 0x96, 0xB8, 0x98, 0xCD, 0x58, 0xBC, 0x25, 0xD8, 0x70, 0xB6, 0x23, 0xAC, 0xFF, 0x97,
+    0x0D, 0x25, 0x2D, 0x66, 0xB1, 0xAB, 0x5B, 0x23, 0x54, 0x13, 0x97, 0x0E, 0x4D, 0x4A, 0xD9, 0xA3,
+    0xC9, 0x7A, 0x6A, 0xF5, 0xE6, 0xAE, 0x0E, 0xC0, 0xC2, 0xCE, 0xE1, 0x44, 0x2E, 0x66, 0x11, 0x22,
+    0x8F, 0xBE, 0x24, 0xB2, 0x87, 0x52, 0xD1, 0xEB, 0x29, 0x81, 0x8E, 0xC6, 0xE9, 0xE7, 0xF8, 0x09,
+    0x19, 0xCE, 0x71, 0xA9, 0x75, 0x22, 0x36, 0x28, 0x25, 0x14, 0xB8, 0x46, 0xB8, 0xA8, 0xFD, 0x53,
+    0xC4, 0xAA, 0xEF, 0x94, 0x6C, 0x14, 0x94, 0xCD, 0xA6, 0x7E, 0xE8, 0x0F, 0x8D, 0xB1, 0x04, 0x21,
+    0x76, 0xAB, 0xDC, 0x5C, 0xE8, 0x8B, 0xB4, 0x2C, 0x3B, 0x1E, 0xE7, 0x1A, 0x0F, 0x80, 0xB2, 0x1A,
+    0x1B, 0x58, 0x56, 0x1B, 0xB8, 0x83, 0x08, 0x74, 0x5D, 0x30, 0x19, 0xF0, 0x02, 0xFE, 0x08, 0xAA,
+    0x34, 0x1F, 0x4C, 0x40, 0x0B, 0xC8, 0xF2, 0x05, 0x5A, 0x5A, 0xE9, 0x2B, 0x8E, 0x59, 0x5A, 0x0E,
+    0x12, 0x38, 0x28, 0x4E, 0x1F, 0x58, 0xE0, 0x25, 0x0F, 0x4D, 0xF9, 0xE0, 0xC2, 0x2B, 0xC3, 0x35,
+    0x0E, 0x06, 0xBB, 0x69, 0xA3, 0x6D, 0xF5, 0xDD, 0x5D, 0xA2, 0x25, 0xF1, 0xC4, 0x44, 0x78, 0x1D,
+    0x5B, 0xC1, 0x5D, 0xB4, 0x8D, 0x21, 0x94, 0xB8, 0xF7, 0x47, 0xAF, 0xC0, 0x19, 0xE9, 0x9A, 0x0C,
+    0x30, 0x5B, 0x59, 0x11, 0xD3, 0xF1, 0x3C, 0x14, 0xA3, 0xEE, 0x46, 0xC8, 0x1D, 0x27, 0x84, 0x6C,
+    0x70, 0xBC, 0x21, 0x6A, 0x54, 0x90, 0x21, 0x5B, 0x56, 0xA3, 0x93, 0xDD, 0x1E, 0x68, 0x11, 0xDD,
+    0xD8, 0x1E, 0x21, 0x26, 0xD4, 0xF5, 0x0A, 0xEB, 0x9C, 0x41, 0xF0, 0xA6, 0x09, 0xE3, 0x51, 0xF4,
+    0x57, 0x65, 0x39, 0x2D, 0xB1, 0x17, 0xCF, 0x61, 0xCB, 0xB4, 0x3A, 0x05, 0x4A, 0x18, 0x87, 0x80,
+    0xCE, 0x39, 0xA2, 0x5C, 0x9D, 0xA2, 0xE2, 0xF4, 0xF3, 0x3D, 0x71, 0x67, 0x90, 0xEA, 0xAB, 0x9E,
+    0x50, 0x31, 0x92, 0x90, 0x31, 0xA0, 0xB0, 0x85, 0xED, 0x26, 0xDD, 0xB5, 0x72, 0x04, 0x4F, 0xD5,
+    0x12, 0x8D, 0xC1, 0x99, 0x73, 0x33, 0x20, 0x11, 0x19, 0x07, 0x04, 0x6E, 0x41, 0x4E, 0x54, 0x3F,
+    0xEE, 0x9F, 0xA2, 0xFE, 0x67, 0x18, 0xA4, 0xB7, 0x70, 0xFF, 0x89, 0x6D, 0x90, 0x5C, 0xA3, 0xAC,
+    0xEE, 0x3E, 0x71, 0x26, 0xB2, 0xF1, 0xE8, 0xB9, 0x21, 0x3D, 0x5F, 0x15, 0xFA, 0xC6, 0xEC, 0xB3,
+    0x0F, 0x8F, 0xF7, 0x27, 0x1B, 0x26, 0x78, 0x69, 0x16, 0xA8, 0xFF, 0x14, 0x7E, 0xA1, 0x4C, 0x52,
+    0x3D, 0x00, 0xC3, 0xB7, 0x67, 0x39, 0x1C, 0x93, 0x60, 0x82, 0x38, 0x44, 0xF2, 0xDF, 0xDC, 0x77,
+    0x28, 0x94, 0x43, 0x41, 0x95, 0x0D, 0x0F, 0xD0, 0xE0, 0xE5, 0x3D, 0xA8, 0x43, 0xB1, 0x51, 0x57,
+    0x56, 0x45, 0x2E, 0x74, 0x22, 0xE9, 0xBC, 0x39, 0x3E, 0xEA, 0x0F, 0x80, 0xA8, 0x38, 0xFA, 0x99,
+    0xF8, 0x30, 0x53, 0x4F, 0xF5, 0xE0, 0x61, 0xE2, 0x35, 0xC8, 0xA1, 0xAA, 0xA9, 0x01, 0x3C, 0x5F,
+    0x5F, 0x32, 0x40, 0x6C, 0x3F, 0x1A, 0xB6, 0x02, 0x6C, 0xD0, 0x4E, 0x9F, 0x2C, 0x9B, 0xC3, 0x06,
+    0x5C, 0x7A, 0x81, 0xE4, 0x8B, 0x65, 0x9B, 0x91, 0x4D, 0x9A, 0x42, 0x3D, 0xCB, 0xC8, 0xCF, 0xC3,
+    0xE4, 0x6D, 0x9E, 0x2B, 0x35, 0x16, 0x70, 0x21, 0x61, 0x81, 0x63, 0x93, 0x63, 0x4E, 0xF6, 0x75,
+    0xB9, 0x20, 0x41, 0x61, 0x55, 0xA3, 0xE9, 0x96, 0x72, 0x6C, 0xD5, 0x44, 0x10, 0x4D, 0xA7, 0x4E,
+    0x8D, 0xC0, 0x60, 0x71, 0x51, 0x93, 0x6B, 0x5B, 0xFE, 0x11, 0x2D, 0xB1, 0xC9, 0x67, 0xB8, 0x1E,
+    0xD9, 0xD7, 0xA1, 0xCB, 0x80, 0x7D, 0x85, 0x2A, 0x50, 0x5E, 0xE4, 0x3C, 0xDB, 0xF7, 0x85, 0x97,
+    0x12, 0x06, 0x31, 0x0B, 0xCE, 0x23, 0x2A, 0xDC, 0x98, 0x59, 0xA0, 0x42, 0x5C, 0x70, 0x7E, 0x05,
+    0x70, 0xAC, 0xCB, 0x44, 0x44, 0x75, 0x18, 0x4E, 0x4E, 0x19, 0xA6, 0x75, 0x40, 0x6C, 0xC0, 0x87,
+    0x30, 0x72, 0x3A, 0x73, 0xBC, 0x28, 0x9E, 0x03, 0x5A, 0xC2, 0xB5, 0x36, 0x36, 0xEB, 0x0F, 0x72,
+    0xFA, 0x9D, 0x40, 0xD2, 0x9B, 0xD5, 0x17, 0xC2, 0xF3, 0x05, 0xF7, 0x48, 0x1C, 0x18, 0x1B, 0x25,
+    0xDD, 0xB2, 0xE5, 0x89, 0x9F, 0x1D, 0x8E, 0x22, 0x3E, 0x89, 0xCE, 0x18, 0xAD, 0x09, 0xE4, 0x18,
+    0x51, 0x5E, 0xDF, 0x72, 0x28, 0xC2, 0xBE, 0x83, 0x9C, 0x08, 0x49, 0x27, 0xF9, 0x98, 0xCF, 0xDF,
+    0x95, 0x55, 0x3D, 0x8F, 0xE4, 0x44, 0x10, 0x6D, 0xDB, 0xEC, 0x38, 0x70, 0xD0, 0xD1, 0x24, 0x24,
+    0x9D, 0x12, 0xE1, 0x9F, 0xD0, 0x06, 0x7E, 0x00, 0x04, 0x3B, 0x02, 0xE9, 0x82, 0x4B, 0x88, 0xF8,
+    0xF8, 0x0D, 0xF6, 0xFD, 0x83, 0xCB, 0x2F, 0xB9, 0x90, 0x59, 0x7E, 0x84, 0x7D, 0xD1, 0x05, 0x24,
+    0x23, 0x21, 0x62, 0x2C, 0x18, 0x44, 0x40, 0xB0, 0x46, 0xB2, 0x74, 0xBD, 0x77, 0x6D, 0x3F, 0xDE,
+    0x6B, 0x2F, 0x7B, 0x2B, 0x81, 0x74, 0x7B, 0xB6, 0xA7, 0xB6, 0xB7, 0x5D, 0x55, 0x5D, 0xF5, 0xEA,
+    0x55, 0xD9, 0x01, 0x9F, 0x01, 0x15, 0x70, 0x02, 0x5E, 0x50, 0x3A, 0x9C, 0x4A, 0x0C, 0x19, 0x1A,
+    0xD3, 0x46, 0x83, 0xCE, 0x54, 0x68, 0x28, 0x4D, 0x3F, 0xF5, 0x83, 0x31, 0x16, 0x2D, 0xA5, 0xA1,
+    0x1A, 0xA5, 0x4B, 0x32, 0xC7, 0x48, 0x29, 0x65, 0x5E, 0x5E, 0xAA, 0x94, 0x33, 0x65, 0xFD, 0x06,
+    0x52, 0x9A, 0x30, 0xD1, 0x6E, 0xB6, 0x2B, 0x65, 0xCC, 0x69, 0x52, 0x45, 0xE3, 0xA3, 0xA9, 0x16,
+    0x53, 0x60, 0x70, 0x38, 0xEF, 0x80, 0xC7, 0x40, 0x09, 0xBC, 0x01, 0x9E, 0x00, 0xB1, 0xC5, 0x52,
+    0x61, 0xE9, 0x11, 0x2D, 0x16, 0x3A, 0x2A, 0xF5, 0x0C, 0xA6, 0xEF, 0x32, 0x9A, 0xD2, 0x21, 0xA6,
+    0x9C, 0x9E, 0xDA, 0xB9, 0xE0, 0x79, 0x75, 0xAC, 0x78, 0x90, 0x5D, 0x2C, 0x23, 0x28, 0x51, 0x33,
+    0xB2, 0x02, 0x6D, 0x97, 0xE2, 0x53, 0x30, 0xFD, 0x92, 0x42, 0x4A, 0x81, 0xD5, 0xE1, 0x9D, 0x32,
+    0x87, 0x32, 0xB1, 0x48, 0xF1, 0x4A, 0x52, 0x60, 0x94, 0x98, 0x1D, 0x45, 0x70, 0x37, 0x07, 0x4C,
+    0x8E, 0xC8, 0x8C, 0x6E, 0x60, 0xE8, 0xB6, 0xA9, 0x52, 0x7E, 0xCB, 0xBF, 0x67, 0xC8, 0x4E, 0xF9,
+    0x31, 0x94, 0x4E, 0x1E, 0xE4, 0x57, 0x2F, 0xDB, 0xB0, 0xBD, 0xFC, 0x9A, 0x46, 0x26, 0x56, 0xE8,
+    0xB2, 0x85, 0x2F, 0xF3, 0xE8, 0x97, 0xC3, 0xA3, 0xE8, 0xE9, 0x39, 0x89, 0xA0, 0x33, 0x04, 0x1B,
+    0x75, 0xD7, 0x74, 0x9B, 0xF7, 0xBE, 0x17, 0xD9, 0x31, 0xEF, 0x86, 0x87, 0x12, 0x0C, 0xCF, 0x58,
+    0x6A, 0x25, 0xC3, 0x5F, 0xC5, 0x20, 0x04, 0x59, 0xC1, 0xF7, 0x99, 0x42, 0xC3, 0x7D, 0xA5, 0xF1,
+    0xAD, 0x52, 0x29, 0xA5, 0xE5, 0x9E, 0x52, 0xCF, 0x64, 0xFC, 0xB0, 0x29, 0xB9, 0x54, 0xCA, 0x4D,
+    0x29, 0xBB, 0x6C, 0x51, 0xE3, 0x25, 0x26, 0xBA, 0x05, 0x35, 0xEC, 0xFB, 0x2E, 0x64, 0xFE, 0x93,
+    0x40, 0x4B, 0x97, 0xCE, 0x34, 0x1B, 0xD1, 0x78, 0x1E, 0xA3, 0x74, 0xD7, 0x83, 0xB1, 0xBF, 0xCF,
+    0xA6, 0x98, 0x05, 0x16, 0x8B, 0xBB, 0x16, 0xC1, 0xB4, 0x8D, 0xAC, 0xDD, 0xC9, 0x8D, 0x45, 0xAC,
+    0x26, 0x03, 0xBA, 0x73, 0xBF, 0xAD, 0x29, 0x33, 0x5E, 0x07, 0x5E, 0xC2, 0xF2, 0x9A, 0xBF, 0xD7,
+    0x57, 0x57, 0x57, 0xC7, 0x0F, 0xCC, 0xC7, 0x34, 0x69, 0x87, 0x7A, 0xAA, 0x42, 0x16, 0xCD, 0x47,
+    0xD4, 0xD9, 0x1D, 0x45, 0x5C, 0xF2, 0x8F, 0x15, 0xCE, 0xF1, 0x17, 0x1A, 0x3F, 0xBA, 0xC0, 0xC3,
+    0xD1, 0xED, 0x3A, 0x1B, 0xB6, 0x18, 0x3E, 0x44, 0x30, 0x35, 0xD0, 0xB1, 0x24, 0xA1, 0x40, 0x87,
+    0xAE, 0x1D, 0x6D, 0xA8, 0xA4, 0xD3, 0x8F, 0x75, 0x24, 0x55, 0xB1, 0x7A, 0xBC, 0x62, 0xC3, 0x04,
+    0x3F, 0x9B, 0x4B, 0xDE, 0xE6, 0x82, 0x40, 0xED, 0x94, 0x4B, 0x81, 0x78, 0xC7, 0x3F, 0xA8, 0x55,
+    0xBC, 0x12, 0xB4, 0xDA, 0x2C, 0xB6, 0xCD, 0x17, 0x0C, 0xC0, 0xBF, 0xE2, 0x09, 0x62, 0x56, 0x57,
+    0x40, 0x4C, 0xC3, 0x5C, 0xAF, 0xD4, 0x14, 0xAB, 0xA2, 0x69, 0xF9, 0x57, 0x16, 0x20, 0xCB, 0x64,
+    0x9E, 0x36, 0xFD, 0xDD, 0x66, 0xB9, 0x69, 0x36, 0x6A, 0xA6, 0x41, 0xE6, 0x64, 0x24, 0x45, 0x0A,
+    0xD8, 0x98, 0xFD, 0x41, 0x4C, 0x3E, 0xB2, 0x7C, 0x68, 0xB8, 0xF3, 0x29, 0xAE, 0x57, 0x17, 0x6C,
+    0xC4, 0x50, 0xFF, 0xB9, 0x9A, 0xB6, 0x66, 0xED, 0xFA, 0x13, 0x23, 0x69, 0x8C, 0xFA, 0xB1, 0x8E,
+    0x09, 0xEE, 0x8C, 0x11, 0x14, 0xB8, 0x79, 0xF4, 0x12, 0x69, 0x0E, 0x84, 0x52, 0x9E, 0x0E, 0x8D,
+    0xA2, 0xDD, 0x37, 0x42, 0x8B, 0x7E, 0xDB, 0x3B, 0x91, 0xFF, 0x57, 0xEC, 0xAE, 0x28, 0xFA, 0xDB,
+    0x6C, 0x3A, 0x4B, 0xFC, 0xBB, 0x9A, 0xD1, 0x75, 0x9E, 0x08, 0x13, 0xBB, 0x5C, 0xB8, 0x49, 0x9C,
+    0x28, 0x90, 0xC4, 0xDB, 0xBD, 0xA4, 0x32, 0x4B, 0x79, 0x7D, 0x4C, 0x41, 0x07, 0x67, 0x2B, 0x1A,
+    0x17, 0x98, 0xD9, 0xBF, 0x7B, 0xDE, 0xA9, 0x64, 0x3D, 0x4E, 0x74, 0xCE, 0x29, 0xD2, 0x47, 0x37,
+    0x55, 0x8B, 0x3F, 0x15, 0x6B, 0xCB, 0xEC, 0xFB, 0x3F, 0xBE, 0x04, 0x0F, 0x5E, 0x55, 0x12, 0xFC,
+    0x72, 0xB8, 0xD4, 0x8C, 0x62, 0x82, 0xC4, 0x50, 0x24, 0xFA, 0xE4, 0x7B, 0x56, 0x90, 0xD3, 0x04,
+    0x31, 0x53, 0x6F, 0x5F, 0xB0, 0x50, 0xE6, 0xDB, 0xF3, 0x36, 0x9F, 0x88, 0x3E, 0xED, 0xAF, 0x09,
+    0xF7, 0x58, 0x77, 0x1C, 0x49, 0xCF, 0x53, 0xB9, 0x54, 0xA8, 0x8C, 0x0B, 0xCE, 0x02, 0x30, 0x5D,
+    0x4C, 0x34, 0x5E, 0xD2, 0x8E, 0x71, 0xB7, 0xAF, 0x1E, 0xB4, 0x68, 0xF1, 0x54, 0x05, 0x21, 0xAC,
+    0x22, 0x45, 0x76, 0xBC, 0xF8, 0x41, 0xFF, 0xAE, 0x24, 0x06, 0x96, 0x02, 0xCF, 0xD6, 0xEF, 0xCA,
+    0x85, 0x0D, 0xC6, 0x63, 0xD1, 0x48, 0x74, 0x49, 0x94, 0x6B, 0x8E, 0x86, 0x31, 0x69, 0xCA, 0x89,
+    0x46, 0x8A, 0xB9, 0x88, 0x0C, 0xBA, 0xD4, 0x5C, 0x50, 0x73, 0x8A, 0xB5, 0xD4, 0x13, 0x67, 0x04,
+    0xF5, 0x6C, 0x5F, 0xB3, 0x5C, 0xA4, 0x88, 0x0D, 0x7E, 0x34, 0x6E, 0x66, 0xD6, 0xED, 0xE4, 0xD7,
+    0x1F, 0x71, 0xE2, 0x61, 0x68, 0xA8, 0x47, 0x9B, 0x6F, 0x8E, 0xAC, 0xE1, 0x3E, 0xCD, 0x37, 0xB9,
+    0xE9, 0xD5, 0xD3, 0x55, 0x5A, 0x8A, 0x06, 0x04, 0xE3, 0xDE, 0x72, 0x4A, 0xCB, 0x4C, 0x0C, 0xFD,
+    0x1B, 0x1A, 0xD0, 0x0A, 0xDF, 0x6F, 0x3C, 0x3D, 0x73, 0xC2, 0xFB, 0x90, 0x09, 0xB5, 0x46, 0x84,
+    0x9C, 0xCD, 0x83, 0x97, 0xFD, 0x4D, 0x8E, 0xB3, 0xC7, 0xD4, 0xE3, 0x67, 0xC0, 0x32, 0xB5, 0x3D,
+    0x51, 0xA2, 0x4B, 0x8D, 0x51, 0xF1, 0xE7, 0x78, 0x3B, 0x03, 0x48, 0xBA, 0x9A, 0x6C, 0x20, 0x7B,
+    0x38, 0x24, 0xDF, 0xF5, 0x94, 0x72, 0xC9, 0xD1, 0x19, 0x4D, 0xF6, 0x85, 0xEA, 0xE6, 0x56, 0x3D,
+    0x5C, 0xE4, 0xCF, 0x6F, 0xBD, 0x65, 0x5F, 0x19, 0x90, 0x86, 0x2C, 0x7E, 0xD4, 0xFE, 0xC3, 0x1F,
+    0x17, 0x14, 0x7D, 0x3F, 0x95, 0x02, 0xB2, 0xE3, 0x84, 0xDF, 0x3D, 0xDD, 0x20, 0xAC, 0x54, 0xDB,
+    0x6A, 0x1B, 0xF4, 0xF7, 0x5A, 0xFA, 0x7F, 0xFB, 0x7C, 0x60, 0x05, 0xFC, 0xE4, 0x71, 0x52, 0xA3,
+    0x32, 0x59, 0x7D, 0x51, 0xF9, 0x81, 0x6D, 0xA8, 0xA9, 0xF6, 0x5B, 0x20, 0x4D, 0x7D, 0x71, 0xF0,
+    0x6B, 0x4C, 0x78, 0x73, 0xDC, 0x45, 0x1F, 0xB8, 0xA9, 0x62, 0x60, 0xE8, 0x67, 0x6A, 0xF2, 0x43,
+    0xE1, 0xD6, 0x06, 0x74, 0x33, 0x39, 0x7C, 0xAE, 0x54, 0x74, 0x16, 0xA7, 0xCD, 0x9E, 0x5F, 0x37,
+    0x56, 0xB1, 0x56, 0x5B, 0x34, 0x76, 0x49, 0x68, 0x3F, 0x7C, 0x99, 0x23, 0xF0, 0x33, 0x9B, 0x4E,
+    0x37, 0xFF, 0x00, 0xBD, 0x54, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0x7E, 0xD6, 0xAE, 0x0B, 0x17,
+    0x43, 0xC1, 0x36, 0x49, 0x31, 0x0D, 0x5D, 0x24, 0xE6, 0x07, 0x88, 0xC6, 0xA1, 0xA1, 0xA0, 0xD9,
+    0x62, 0xB7, 0x60, 0x1B, 0x6A, 0xAA, 0xFC, 0xC0, 0x4A, 0xE3, 0xB0, 0x1F, 0x40, 0x45, 0x0D, 0x45,
+    0x1A, 0xB6, 0xE2, 0x0F, 0x66, 0x00, 0xA1, 0x14, 0x14, 0x31, 0x20, 0x94, 0xD6, 0x0A, 0x2B, 0x28,
+    0x52, 0xC4, 0x08, 0x03, 0x16, 0x8C, 0x7D, 0x38, 0xD7, 0x6F, 0x37, 0xD9, 0x28, 0x59, 0x65, 0x69,
+    0xB0, 0xDE, 0x1B, 0x8D, 0x3D, 0x33, 0xF7, 0x9E, 0x7B, 0xCE, 0x99, 0x2B, 0x47, 0xC5, 0x17, 0xB2,
+    0x7B, 0x5F, 0x6A, 0x3C, 0xC0, 0x68, 0x91, 0x2A, 0xFC, 0x03, 0x04, 0x64, 0xC1, 0xF6, 0x69, 0x36,
+    0x18, 0x03, 0x7E, 0x40, 0x2F, 0x61, 0x28, 0xD1, 0xBA, 0x2C, 0x76, 0x12, 0xDD, 0x26, 0xD5, 0x22,
+    0x7E, 0x28, 0x90, 0x0A, 0xB4, 0x26, 0x73, 0x55, 0x42, 0x5F, 0x42, 0xEC, 0x7F, 0xD8, 0x60, 0xD1,
+    0x84, 0x69, 0x83, 0x33, 0x87, 0x21, 0xE0, 0x1B, 0xC0, 0x20, 0x3B, 0xF4, 0x40, 0x92, 0xA3, 0xE2,
+    0x54, 0x36, 0xF8, 0x0D, 0x8B, 0x04, 0x44, 0x8C, 0xA5, 0x22, 0x49, 0x8A, 0x24, 0xEB, 0x79, 0x74,
+    0x1A, 0x72, 0xD6, 0x38, 0x51, 0xA7, 0xF5, 0x35, 0xA6, 0x61, 0x2E, 0x30, 0x39, 0xAD, 0xE5, 0x67,
+    0xE0, 0x3D, 0x06, 0xDE, 0x3D, 0x6D, 0xA4, 0x62, 0x7D, 0x8C, 0xBD, 0x68, 0xB1, 0xA3, 0x9D, 0x4A,
+    0x82, 0x10, 0x3B, 0x13, 0x29, 0x9E, 0x2C, 0x62, 0x96, 0xD8, 0x4B, 0x7C, 0xBA, 0x48, 0xBD, 0xB0,
+    0xFA, 0xC8, 0x2F, 0xF5, 0x1C, 0xB9, 0xF4, 0x00, 0x8D, 0xCD, 0x7E, 0x2E, 0x71, 0x87, 0xA7, 0xFA,
+    0x1A, 0x98, 0x58, 0xC8, 0x24, 0xB2, 0x73, 0x20, 0x22, 0x1F, 0x91, 0x4D, 0x37, 0x7B, 0xA4, 0xC8,
+    0x45, 0x56, 0xC5, 0xD5, 0x12, 0x5D, 0xCC, 0x25, 0x1A, 0xC7, 0x41, 0xCC, 0x7C, 0xD5, 0x90, 0x2F,
+    0x06, 0xC7, 0x72, 0x9B, 0x38, 0x68, 0xCD, 0x9D, 0x0E, 0x8A, 0x70, 0x92, 0x12, 0x9F, 0x36, 0x1C,
+    0x98, 0xE2, 0xF2, 0xD0, 0x88, 0x38, 0x6A, 0x25, 0x5E, 0x87, 0xBD, 0x43, 0x45, 0xB0, 0x7B, 0xBA,
+    0x4F, 0xEA, 0x30, 0xF3, 0x9B, 0xE6, 0x26, 0x44, 0x97, 0x37, 0x68, 0x91, 0xEA, 0x85, 0x94, 0xBB,
+    0xC9, 0x91, 0x93, 0x3E, 0xF6, 0x1B, 0x9C, 0xA0, 0xA9, 0x17, 0xB3, 0x3C, 0xFB, 0x34, 0x6C, 0x70,
+    0x0F, 0x9D, 0x59, 0x4A, 0xFC, 0x82, 0xA9, 0xD6, 0x83, 0x86, 0x43, 0x5B, 0xE3, 0xD1, 0x22, 0xD2,
+    0x70, 0x8F, 0x70, 0x97, 0x30, 0x76, 0x2B, 0xA4, 0x84, 0x6F, 0xFA, 0xA9, 0x66, 0x22, 0x6A, 0x34,
+    0x8A, 0x1C, 0x1E, 0x36, 0xF2, 0x41, 0xF1, 0xB9, 0x5B, 0x4C, 0x0E, 0xF0, 0x99, 0xD9, 0x99, 0x16,
+    0x63, 0x81, 0xFE, 0x0D, 0x2A, 0x20, 0xAF, 0xFB, 0x57, 0xAC, 0x91, 0x67, 0xF8, 0x67, 0xE8, 0x1B,
+    0xF7, 0x57, 0x69, 0xC8, 0x61, 0x35, 0x57, 0xD9, 0xF5, 0xD5, 0x40, 0xBD, 0x4F, 0xD0, 0xBD, 0x59,
+    0x73, 0x97, 0xE1, 0x0E, 0xCB, 0x9D, 0x84, 0xC8, 0x93, 0xF9, 0x6D, 0x09, 0x7F, 0xD0, 0x5D, 0x8F,
+    0x98, 0xC9, 0xCE, 0x77, 0x27, 0xC6, 0x68, 0xE9, 0x98, 0xAD, 0x1A, 0xBB, 0xE4, 0x87, 0x44, 0xD5,
+    0xCA, 0xD0, 0xC0, 0x69, 0x92, 0xBB, 0x50, 0xA3, 0xD1, 0x69, 0x98, 0xE8, 0x4C, 0x66, 0x11, 0x35,
+    0x94, 0x9A, 0xF3, 0x15, 0xAF, 0x4A, 0xB2, 0xC1, 0x51, 0xE3, 0x59, 0xA4, 0xC6, 0x8C, 0xE4, 0x7B,
+    0x8F, 0x21, 0x77, 0x44, 0x69, 0x18, 0x6E, 0x6A, 0xA6, 0x12, 0x53, 0x85, 0xC1, 0xA1, 0x55, 0xE5,
+    0x58, 0x02, 0x59, 0xBC, 0xF6, 0x74, 0x5C, 0xA7, 0x3F, 0xC5, 0x89, 0x22, 0x02, 0x67, 0x74, 0xE1,
+    0x53, 0xF0, 0x8A, 0x8C, 0x71, 0x96, 0xE2, 0xA0, 0xD8, 0x97, 0xF5, 0x21, 0x11, 0x1F, 0x83, 0x8E,
+    0x1A, 0x1D, 0x12, 0xAB, 0xD7, 0x3B, 0xD4, 0x96, 0x59, 0x78, 0x11, 0x63, 0xCB, 0x8A, 0xCC, 0x48,
+    0x31, 0x0A, 0x28, 0x66, 0xD7, 0x11, 0x31, 0x97, 0xC4, 0x8E, 0x41, 0x0B, 0x7F, 0xC8, 0x92, 0xEB,
+    0x59, 0x95, 0xA2, 0x1F, 0x15, 0xB1, 0x4A, 0x68, 0xD5, 0x38, 0x82, 0x41, 0x23, 0xCF, 0xF2, 0xE2,
+    0x43, 0xB7, 0x08, 0xEF, 0x02, 0x93, 0x0D, 0x66, 0x60, 0x2F, 0x00, 0x01, 0x8A, 0xA3, 0x13, 0x15,
+    0x2A, 0x0D, 0xA5, 0x0D, 0xC0, 0xEB, 0x75, 0x0E, 0xB9, 0xA4, 0x0E, 0xD9, 0x20, 0x31, 0x51, 0x4C,
+    0x98, 0xEB, 0x81, 0xD1, 0xEC, 0x87, 0x3D, 0x93, 0xF9, 0xC7, 0x03, 0x6C, 0x62, 0x36, 0x6F, 0xFE,
+    0x54, 0x2C, 0x7F, 0xF5, 0x31, 0x2A, 0x1A, 0x9A, 0x5C, 0xF1, 0x20, 0xF9, 0x15, 0x11, 0xEF, 0x7D,
+    0xB7, 0x3A, 0x58, 0xF9, 0x16, 0xCB, 0x7B, 0xD5, 0xBE, 0x08, 0x86, 0xCD, 0xC0, 0xD3, 0xA3, 0x73,
+    0x85, 0xCE, 0x2E, 0xAC, 0x95, 0x82, 0x84, 0x96, 0xEA, 0xF8, 0x44, 0x6D, 0x62, 0x52, 0xE3, 0xAF,
+    0x45, 0x75, 0xB2, 0x15, 0x97, 0x45, 0xAE, 0x03, 0x2D, 0xEA, 0xD4, 0xB1, 0x8E, 0x26, 0x27, 0x78,
+    0xB6, 0x09, 0xC7, 0x32, 0xCE, 0xD6, 0x06, 0x73, 0xDE, 0x5D, 0xAE, 0x43, 0xEB, 0x70, 0x25, 0xAD,
+    0x9F, 0xBC, 0x8A, 0x56, 0xB3, 0xD2, 0x1A, 0x9F, 0xD3, 0xEA, 0x35, 0x0D, 0xC5, 0xD1, 0x0D, 0xEA,
+    0x44, 0xDD, 0xAA, 0x1E, 0x62, 0xE2, 0xF9, 0x02, 0x2C, 0x9B, 0xDC, 0x73, 0xE6, 0xD7, 0x76, 0xA2,
+    0x1D, 0x63, 0xB2, 0xC9, 0xE5, 0xAA, 0x23, 0x2F, 0x0A, 0x9E, 0x6D, 0x68, 0x1B, 0xBD, 0x86, 0xAC,
+    0xFE, 0x24, 0x65, 0x6F, 0x69, 0x23, 0x2E, 0x09, 0xF2, 0x6B, 0xDE, 0xEA, 0x81, 0xC7, 0xF4, 0xB6,
+    0xF1, 0x76, 0x43, 0xFB, 0xC1, 0xFA, 0x14, 0x24, 0x8D, 0x01, 0x27, 0x3A, 0xDF, 0x77, 0xBC, 0x02,
+    0x84, 0x4F, 0x2C, 0xAC, 0x44, 0x79, 0xD4, 0xB7, 0x95, 0x70, 0x6D, 0xA5, 0xEC, 0xAA, 0x89, 0xD3,
+    0x67, 0x5F, 0x43, 0x4B, 0xA5, 0xB9, 0x97, 0xF8, 0x2F, 0x8E, 0xD9, 0xBF, 0x79, 0x03, 0x1A, 0x37,
+    0xCB, 0xCE, 0xBE, 0xF8, 0x87, 0xBF, 0x67, 0xBC, 0x66, 0x48, 0xAB, 0xBE, 0x5A, 0xE2, 0x2D, 0x8A,
+    0x1A, 0x92, 0xC6, 0xBA, 0xFC, 0xA3, 0x8C, 0xE4, 0x98, 0xA6, 0x88, 0xDB, 0x55, 0xB5, 0x92, 0x12,
+    0x1F, 0xBA, 0x4B, 0xDF, 0x5F, 0x3A, 0x18, 0xD2, 0x0D, 0xBA, 0x0F, 0xBA, 0x7D, 0xEF, 0xBC, 0x4C,
+    0x36, 0xB0, 0x3B, 0xC8, 0x25, 0x19, 0xF8, 0x35, 0xC7, 0xCF, 0xB0, 0xD8, 0x36, 0xA0, 0x48, 0x9B,
+    0x65, 0x5D, 0xBC, 0x79, 0x0F, 0xDF, 0xC1, 0xE5, 0x15, 0x4D, 0xF1, 0xA5, 0xED, 0x7C, 0xB3, 0x94,
+    0x93, 0x19, 0x7C, 0xA2, 0x96, 0x76, 0x08, 0x5F, 0xE1, 0xFD, 0xD9, 0x8D, 0xF1, 0x47, 0x98, 0xEC,
+    0xBB, 0x83, 0x73, 0xDA, 0x36, 0xAB, 0x8F, 0x54, 0x8F, 0x97, 0x26, 0x41, 0x4B, 0x21, 0xC1, 0xEC,
+    0x3C, 0xB9, 0x5C, 0x6E, 0xFB, 0x0E, 0x27, 0xDF, 0x67, 0x33, 0xDC, 0x36, 0xEF, 0x2E, 0x65, 0xD7,
+    0xF8, 0xEE, 0x1D, 0x29, 0xE7, 0x92, 0x40, 0xBB, 0x63, 0x29, 0x97, 0x8A, 0x93, 0xFE, 0x98, 0xCA,
+    0x73, 0x62, 0xF3, 0xB1, 0x34, 0xC0, 0xB7, 0x59, 0xF5, 0x49, 0x3C, 0x4E, 0x1D, 0xD4, 0x32, 0x46,
+    0x81, 0xA9, 0xF7, 0xAF, 0x98, 0x34, 0xF2, 0xBF, 0x3C, 0xFF, 0x02, 0xE5, 0x55, 0xBF, 0x6F, 0xDD,
+    0x54, 0x14, 0x3E, 0xD7, 0xEE, 0x8B, 0x4B, 0x2D, 0x74, 0x59, 0x1E, 0x82, 0x22, 0xEA, 0x85, 0xA9,
+    0x02, 0xF9, 0x1F, 0x78, 0xE4, 0xBA, 0x5D, 0x22, 0xB1, 0x10, 0xA4, 0xBA, 0x12, 0x53, 0x57, 0xD4,
+    0x25, 0x6B, 0x87, 0x34, 0x7E, 0x15, 0x03, 0x03, 0x43, 0xBB, 0x00, 0x2B, 0x12, 0x41, 0x6A, 0xD3,
+    0x01, 0x86, 0x0C, 0x1D, 0x50, 0x7C, 0xD3, 0x0E, 0x19, 0x18, 0x6A, 0x14, 0x24, 0x06, 0x86, 0x5C,
+    0x54, 0xC4, 0xC0, 0x52, 0x87, 0x38, 0xC8, 0xAD, 0xEC, 0x7B, 0xF8, 0xCE, 0x7D, 0x4D, 0x45, 0x85,
+    0x10, 0x7F, 0x00, 0x4E, 0xDE, 0xD5, 0xF5, 0xB9, 0x3F, 0xCE, 0xAF, 0xEF, 0xFB, 0x4C, 0xB4, 0xE4,
+    0x0B, 0xA2, 0x9C, 0x3B, 0x22, 0xE6, 0x81, 0x22, 0x5E, 0xF1, 0x14, 0x8F, 0x91, 0xA7, 0x64, 0x50,
+    0x23, 0xE9, 0x5E, 0xF5, 0xA4, 0xB1, 0xB6, 0x18, 0xB2, 0x96, 0x68, 0xB2, 0x76, 0x7C, 0x99, 0x34,
+    0x33, 0xCB, 0xE0, 0x89, 0x0C, 0x6C, 0x64, 0x9C, 0x0C, 0x0D, 0x86, 0xCA, 0x9E, 0x0C, 0xF5, 0x9C,
+    0x68, 0xCA, 0xE5, 0xE5, 0xEF, 0x0C, 0x36, 0x0F, 0x61, 0xC8, 0x9E, 0x32, 0x77, 0xC9, 0x9C, 0xA6,
+    0xC5, 0x69, 0x22, 0x55, 0x0C, 0x4B, 0x9B, 0xD9, 0xCA, 0xC8, 0x9E, 0x63, 0x2C, 0xBA, 0x98, 0xBF,
+    0x81, 0xC3, 0x36, 0xED, 0xC8, 0xCC, 0xB5, 0xA3, 0x91, 0x8C, 0x8D, 0x3B, 0xF2, 0x30, 0xC5, 0x3D,
+    0x1C, 0x18, 0xAB, 0xB0, 0x6B, 0x9E, 0x63, 0xD8, 0xF5, 0xD5, 0x68, 0x76, 0xE1, 0x72, 0xA6, 0xE0,
+    0x87, 0xA6, 0xE5, 0xEA, 0xA4, 0xFC, 0x80, 0xB9, 0xA9, 0xF8, 0x01, 0xB3, 0x62, 0xAF, 0xB8, 0x81,
+    0xF7, 0x88, 0xE7, 0xF1, 0x40, 0x31, 0x53, 0xE6, 0x28, 0xF5, 0xC4, 0xC8, 0x61, 0xC0, 0x4D, 0x94,
+    0x75, 0xB9, 0x95, 0xB0, 0x47, 0x49, 0xFB, 0x67, 0x76, 0x54, 0xE1, 0xCA, 0x82, 0x4A, 0x1E, 0x2F,
+    0x21, 0x28, 0x1C, 0x0D, 0xD9, 0x59, 0x32, 0x21, 0xBD, 0xAB, 0xF5, 0xD3, 0x4D, 0xF8, 0x60, 0xC9,
+    0x08, 0x77, 0x49, 0x25, 0x06, 0x0C, 0x4B, 0x08, 0x85, 0xE4, 0x64, 0x81, 0x23, 0x2C, 0x16, 0xF3,
+    0xF0, 0x68, 0xE0, 0xE7, 0x43, 0x49, 0xE1, 0x59, 0xFA, 0xEA, 0x6F, 0x36, 0x36, 0x96, 0xD4, 0x26,
+    0xF6, 0x7B, 0x38, 0x1E, 0xA3, 0x5E, 0x0F, 0x99, 0xD5, 0x0E, 0xF1, 0x25, 0x12, 0x0A, 0x7C, 0xED,
+    0x70, 0x11, 0x1D, 0x71, 0x93, 0xDE, 0x67, 0x97, 0x5D, 0x60, 0x67, 0x8A, 0xCA, 0xD5, 0xF3, 0xDC,
+    0xB2, 0xCB, 0xE7, 0xDC, 0x2D, 0x53, 0xDD, 0x0F, 0x64, 0xFE, 0x74, 0x94, 0xF1, 0x0D, 0xD2, 0xA3,
+    0x21, 0xFD, 0x07, 0xDE, 0x3F, 0x1D, 0xA2, 0x21, 0x43, 0xB8, 0x39, 0xF7, 0x92, 0x65, 0x08, 0xD0,
+    0xC1, 0x6A, 0x8E, 0x58, 0x0F, 0xD5, 0x0D, 0xAF, 0xE8, 0x14, 0x9D, 0x3C, 0x19, 0xFF, 0x2A, 0x7D,
+    0xF9, 0xBD, 0x46, 0x8E, 0xE2, 0x8E, 0x08, 0x81, 0xC7, 0x8E, 0x50, 0x14, 0x5A, 0xA6, 0x75, 0x38,
+    0x88, 0xED, 0xBB, 0x80, 0x01, 0xDD, 0xCB, 0xC8, 0xA7, 0x56, 0xA7, 0xC5, 0x8E, 0x6A, 0xA3, 0x7D,
+    0x6B, 0xE8, 0x15, 0xBA, 0xD6, 0x6A, 0x94, 0xE0, 0xDC, 0x2C, 0x41, 0xBB, 0x93, 0x87, 0x0A, 0x07,
+    0xD5, 0x23, 0x5B, 0x01, 0x3A, 0xD7, 0xB6, 0x35, 0x4C, 0xEF, 0x9C, 0x8B, 0xF8, 0xF3, 0x46, 0xC7,
+    0xD6, 0x70, 0x9B, 0xD8, 0x7B, 0x11, 0x77, 0x71, 0xA3, 0x0B, 0x45, 0x51, 0x4B, 0x00, 0x0E, 0xC6,
+    0x6C, 0x4E, 0x72, 0x94, 0x3F, 0x5B, 0x43, 0xDF, 0x92, 0x50, 0x3D, 0x9A, 0x7C, 0x2D, 0x51, 0x95,
+    0x00, 0x5D, 0x1B, 0x79, 0x4F, 0x28, 0xC7, 0x24, 0x6E, 0xE9, 0xD5, 0x81, 0x6A, 0x26, 0x7F, 0xC5,
+    0x6E, 0xC4, 0xAD, 0xBE, 0xEF, 0x3F, 0x66, 0x6E, 0xCD, 0xBE, 0x0B, 0x09, 0x4C, 0x00, 0x94, 0x06,
+    0xEF, 0xD3, 0x12, 0x8E, 0x5F, 0xA2, 0x25, 0x4A, 0xBA, 0xB8, 0x8F, 0xD0, 0x72, 0xAA, 0x6D, 0xD5,
+    0x98, 0x36, 0xEF, 0xF4, 0x28, 0xAD, 0x9E, 0xD7, 0x36, 0x4C, 0xC4, 0x82, 0xD6, 0xD5, 0x4D, 0xD8,
+    0x93, 0x74, 0xC9, 0x40, 0x67, 0xF0, 0x17, 0x5A, 0xC9, 0xFC, 0x18, 0xBF, 0x3A, 0x34, 0x59, 0x60,
+    0x01, 0xC8, 0x01, 0x78, 0xA1, 0x30, 0xD1, 0xE6, 0xB4, 0xBC, 0xC8, 0x7C, 0xC0, 0x5C, 0xF1, 0x00,
+    0x74, 0x91, 0x92, 0x76, 0xD6, 0x88, 0x59, 0xDF, 0x4A, 0x1B, 0x24, 0x14, 0xDB, 0xF4, 0xEC, 0x9D,
+    0xD8, 0x5E, 0xAB, 0x76, 0x92, 0x8B, 0x76, 0x7D, 0x5D, 0x6B, 0x75, 0xD8, 0xBE, 0x3D, 0x4B, 0x0E,
+    0x8A, 0x6F, 0x5D, 0xD6, 0x45, 0x0F, 0xEC, 0xF5, 0x36, 0x4D, 0xD5, 0x51, 0x3B, 0x7B, 0x33, 0x7B,
+    0x74, 0xE8, 0x66, 0xD3, 0x0B, 0xEF, 0xD3, 0x8C, 0x68, 0x9B, 0xAE, 0x53, 0x56, 0x2C, 0xA8, 0xB6,
+    0x74, 0x9B, 0xE8, 0xFC, 0xD6, 0x1D, 0xC3, 0xBE, 0x62, 0x3F, 0x2D, 0x2F, 0xD1, 0xDA, 0x2D, 0xA9,
+    0x3B, 0x52, 0xAB, 0xBF, 0x18, 0xCD, 0xDC, 0xDC, 0xB4, 0xFA, 0x11, 0x52, 0xF3, 0x34, 0xE6, 0xBF,
+    0x09, 0x3B, 0x8A, 0x8A, 0x0B, 0x75, 0x07, 0x05, 0x40, 0xDE, 0x35, 0x02, 0x44, 0xF9, 0x53, 0x54,
+    0x53, 0x80, 0x5C, 0xD3, 0x99, 0xBB, 0x7E, 0x0B, 0x48, 0xF4, 0x48, 0xE7, 0x49, 0x59, 0x97, 0xC5,
+    0x8B, 0xAB, 0x61, 0xB3, 0x5A, 0xFD, 0x67, 0xD2, 0x8B, 0xA7, 0xEA, 0xE1, 0xD5, 0xF2, 0xE3, 0xDE,
+    0xEC, 0xB2, 0x6E, 0x8C, 0xFD, 0x12, 0x6C, 0x41, 0x43, 0x41, 0xF7, 0xC5, 0x3F, 0x28, 0x9F, 0x1D,
+    0x97, 0x40, 0xD8, 0x3E, 0xA8, 0x7B, 0x75, 0x4B, 0xB8, 0x10, 0x01, 0x9E, 0x20, 0xF4, 0x4F, 0xE3,
+    0xB2, 0x1A, 0x4F, 0xE3, 0xF6, 0xB4, 0x53, 0x52, 0xE1, 0x5E, 0xDD, 0x1D, 0xA5, 0x7C, 0x0A, 0xDA,
+    0x31, 0x9E, 0x17, 0xC6, 0xBB, 0x5C, 0xB4, 0x85, 0x14, 0xE9, 0x82, 0x93, 0xC1, 0xFC, 0x30, 0xA6,
+    0xCD, 0xCB, 0xF2, 0xFE, 0x11, 0x4D, 0xE6, 0x8A, 0xD1, 0x22, 0xCA, 0xE1, 0xDD, 0x82, 0xA8, 0xE0,
+    0x54, 0xE8, 0x54, 0xC4, 0xC5, 0x7F, 0x4E, 0x33, 0x4C, 0x7B, 0x25, 0x53, 0x6B, 0x30, 0xF5, 0x29,
+    0xBB, 0x88, 0x79, 0x0C, 0x12, 0x73, 0x53, 0x14, 0xC0, 0x55, 0xAD, 0xF9, 0x65, 0x95, 0x2E, 0xC5,
+    0x21, 0xC9, 0xA0, 0x4F, 0x0B, 0xE6, 0x3E, 0x9B, 0x16, 0x27, 0xD3, 0x68, 0x75, 0x41, 0x52, 0x64,
+    0x86, 0x1B, 0xB8, 0xC1, 0x05, 0x23, 0x6A, 0x94, 0x41, 0x64, 0x86, 0x0D, 0x94, 0xE5, 0xB0, 0x07,
+    0x50, 0xF7, 0x90, 0x2C, 0x4C, 0x40, 0xC2, 0x86, 0x7A, 0x6E, 0xD2, 0x62, 0xCA, 0x64, 0x57, 0x0E,
+    0x13, 0xE5, 0x07, 0x7B, 0x8E, 0x4E, 0x19, 0x60, 0x9C, 0x60, 0xA2, 0xF8, 0x50, 0xF0, 0xB4, 0x27,
+    0x80, 0xFA, 0x37, 0xD3, 0x3A, 0x4C, 0x12, 0x82, 0x16, 0x1E, 0xBC, 0x85, 0x18, 0x6E, 0xA1, 0xC0,
+    0x37, 0x7D, 0xDE, 0x4E, 0x69, 0xA2, 0xF8, 0x13, 0x56, 0x63, 0xD2, 0x9A, 0x95, 0x2E, 0x60, 0x55,
+    0x6D, 0xAB, 0xBA, 0xCD, 0xD9, 0x56, 0x5E, 0x80, 0x0A, 0x9C, 0x02, 0xA6, 0x2F, 0x4C, 0xD7, 0x18,
+    0x24, 0x79, 0x6F, 0xEB, 0x36, 0x7D, 0x58, 0x28, 0x68, 0x11, 0xFA, 0x39, 0x26, 0x7D, 0x45, 0x75,
+    0x66, 0xB3, 0xEF, 0xDB, 0xE4, 0x70, 0x50, 0x43, 0x55, 0xEC, 0xE8, 0xE3, 0x1A, 0x2B, 0xC5, 0x33,
+    0x8D, 0xA0, 0x89, 0x6C, 0xAB, 0xD9, 0x4D, 0x40, 0xA5, 0xD7, 0xE8, 0xF5, 0xC0, 0x24, 0xA8, 0x6C,
+    0xDE, 0x06, 0xF6, 0xC4, 0x00, 0x1D, 0x0A, 0x8D, 0xAA, 0x0B, 0xB1, 0x64, 0x12, 0x33, 0x4A, 0x2F,
+    0x4B, 0xB9, 0xCB, 0xDA, 0xB0, 0x59, 0x4E, 0xBD, 0xF8, 0x24, 0xA8, 0xAC, 0x42, 0x42, 0x90, 0x5D,
+    0x7A, 0x43, 0x50, 0x37, 0x0A, 0x6B, 0x44, 0x3D, 0x45, 0x7B, 0x44, 0x2F, 0xA1, 0x96, 0x57, 0x9E,
+    0xF1, 0x2C, 0x48, 0xB1, 0xA8, 0xAA, 0x5F, 0x70, 0x4F, 0x8C, 0x49, 0x28, 0x89, 0x23, 0xE8, 0xFE,
+    0x59, 0xD9, 0x00, 0x99, 0x81, 0x66, 0x62, 0x03, 0x90, 0xD2, 0xCA, 0x86, 0x9A, 0xD0, 0xFD, 0xB5,
+    0x27, 0x04, 0xF1, 0x13, 0xB6, 0x34, 0xF9, 0x5C, 0x1F, 0xD8, 0x8A, 0x3B, 0x08, 0xE9, 0xFE, 0xE2,
+    0x6C, 0xEA, 0x44, 0x8C, 0x93, 0x16, 0xE5, 0x93, 0x66, 0xF7, 0xF1, 0xF1, 0x95, 0x1F, 0x85, 0x03,
+    0xE1, 0xE3, 0x21, 0x17, 0xA1, 0xC9, 0x2E, 0x44, 0x54, 0x56, 0xAB, 0x21, 0x22, 0x12, 0x61, 0x83,
+    0x9B, 0xD0, 0x90, 0x4C, 0xBE, 0x61, 0xF8, 0x0E, 0x50, 0x4B, 0xFF, 0x8B, 0xE7, 0x2F, 0xD5, 0x55,
+    0xBD, 0x6E, 0xD4, 0x40, 0x10, 0x1E, 0xDB, 0x24, 0x96, 0x70, 0xB1, 0x14, 0x50, 0x01, 0xF2, 0x0B,
+    0x44, 0xF2, 0x1B, 0x60, 0xF3, 0x06, 0x69, 0x52, 0xA7, 0x45, 0xA2, 0xE0, 0x11, 0x6C, 0x89, 0x92,
+    0x26, 0x6F, 0x40, 0x7F, 0x14, 0x97, 0x07, 0x40, 0xB1, 0x93, 0x86, 0x92, 0x43, 0xFC, 0xB4, 0x58,
+    0x20, 0x1A, 0x1A, 0x5C, 0x18, 0xC5, 0x89, 0xD6, 0x1E, 0xBE, 0x6F, 0x36, 0x88, 0x44, 0x88, 0x82,
+    0x2E, 0x59, 0xE9, 0x6E, 0x7D, 0xDE, 0x99, 0x6F, 0xBE, 0x6F, 0x66, 0x76, 0x4E, 0xE4, 0xD2, 0x7A,
+    0x88, 0x4F, 0xD4, 0x88, 0xB8, 0x41, 0xE4, 0xBE, 0x17, 0x49, 0x47, 0x91, 0x56, 0x45, 0x12, 0x3C,
+    0xE7, 0xDA, 0x48, 0x34, 0xE3, 0x7C, 0xBF, 0x17, 0xC1, 0x3B, 0x49, 0x26, 0x91, 0x9A, 0x5E, 0x8B,
+    0x48, 0x09, 0x27, 0x7E, 0xE5, 0x1D, 0x76, 0xD7, 0x8B, 0xDB, 0xDC, 0x9F, 0x68, 0x90, 0x0E, 0xA5,
+    0x6E, 0x60, 0x90, 0x8C, 0xA5, 0x7A, 0x18, 0xC4, 0x3E, 0xEF, 0xB5, 0x79, 0x76, 0x26, 0x3E, 0x1D,
+    0xF0, 0xA4, 0x9B, 0x23, 0x79, 0x9D, 0x8D, 0xB5, 0x8E, 0x75, 0x08, 0x42, 0x8C, 0x04, 0x41, 0x08,
+    0x64, 0x3B, 0xB0, 0x6C, 0xCF, 0x86, 0xB0, 0x27, 0xA3, 0xA4, 0xB4, 0x83, 0x71, 0xAA, 0x3A, 0x92,
+    0x51, 0xA4, 0x80, 0x26, 0xA3, 0x52, 0xC1, 0xA4, 0xAE, 0x82, 0x94, 0xA4, 0x93, 0x7F, 0xAF, 0x43,
+    0xC8, 0x68, 0x0F, 0x80, 0xBE, 0x81, 0x23, 0x74, 0xC5, 0x00, 0x28, 0x7F, 0xF8, 0x10, 0x7E, 0x28,
+    0x36, 0x0C, 0x27, 0x0F, 0xF8, 0x96, 0x31, 0xA5, 0x6E, 0xA4, 0x20, 0x5C, 0xDD, 0x33, 0x3E, 0x03,
+    0x55, 0x14, 0x2D, 0xB1, 0xCE, 0x24, 0xFA, 0x04, 0x74, 0x7B, 0x88, 0x2D, 0x3B, 0xE6, 0xA2, 0x96,
+    0x8C, 0x40, 0xBD, 0xDB, 0x44, 0xDA, 0xDD, 0x5B, 0xFB, 0x08, 0xBA, 0x7D, 0xA2, 0x2A, 0x65, 0xE5,
+    0x3E, 0x77, 0xA5, 0x36, 0xD9, 0x90, 0x8C, 0x5E, 0xF6, 0x88, 0x7D, 0xE4, 0x3A, 0xD3, 0x9C, 0x77,
+    0xD4, 0x94, 0x0E, 0xC9, 0xCF, 0xFD, 0x0F, 0x96, 0xD0, 0x5A, 0x15, 0x59, 0x2E, 0x3A, 0xF8, 0x2D,
+    0x96, 0xE9, 0x68, 0x6F, 0x86, 0xB0, 0x96, 0x19, 0xE9, 0x18, 0x0E, 0x0F, 0x70, 0x21, 0x43, 0xD9,
+    0xC2, 0x41, 0x5A, 0x5D, 0x15, 0xB8, 0xCD, 0x1A, 0x75, 0x92, 0x7B, 0x64, 0xA7, 0x13, 0x37, 0xFE,
+    0x39, 0xA8, 0x24, 0x9A, 0x2C, 0xBD, 0x60, 0x99, 0x6B, 0x97, 0xA9, 0x8F, 0x91, 0x81, 0x72, 0x96,
+    0x34, 0x94, 0x33, 0x85, 0xF2, 0xB2, 0x92, 0x78, 0x96, 0x3B, 0x6E, 0x59, 0x37, 0xAD, 0x9D, 0x77,
+    0xA9, 0x4E, 0xB2, 0x7D, 0x06, 0xFF, 0x03, 0x43, 0xC9, 0x59, 0x6E, 0xC8, 0xB7, 0xA8, 0xC5, 0x62,
+    0xEF, 0x5A, 0x6F, 0x5B, 0x1D, 0xF2, 0x7E, 0xF7, 0x32, 0x9B, 0xF0, 0xA3, 0x20, 0x69, 0x54, 0xCD,
+    0x7E, 0xA8, 0x51, 0x62, 0x4F, 0x41, 0x9E, 0x9A, 0x2B, 0x3B, 0x05, 0x85, 0x3E, 0x35, 0x83, 0xA5,
+    0x1C, 0x78, 0x7E, 0x42, 0x83, 0xC4, 0xE7, 0x34, 0xA8, 0x2B, 0x1A, 0x64, 0x43, 0xB6, 0x84, 0x14,
+    0xC1, 0xA0, 0x38, 0x7F, 0x05, 0x0E, 0x48, 0x12, 0x11, 0x90, 0x33, 0x6A, 0x3D, 0x5F, 0xAD, 0xD9,
+    0x13, 0x20, 0x34, 0x08, 0x2A, 0x89, 0x78, 0x6C, 0xAC, 0x72, 0x8A, 0x21, 0x21, 0xD7, 0xA9, 0xD5,
+    0x3E, 0x53, 0x7D, 0x8B, 0xB4, 0xB6, 0x16, 0x36, 0x36, 0x3A, 0x51, 0x20, 0xDF, 0x6E, 0x4C, 0x82,
+    0x0F, 0xDC, 0xA8, 0x2E, 0x5E, 0x4C, 0xE3, 0x2D, 0xB9, 0x21, 0x7A, 0xE2, 0xC3, 0x40, 0xC7, 0x84,
+    0x14, 0x26, 0x21, 0x3B, 0x65, 0x13, 0xC7, 0x33, 0x2F, 0x35, 0x82, 0x96, 0xE1, 0x8E, 0x37, 0x37,
+    0xA4, 0x3E, 0xB6, 0xB2, 0x61, 0xC7, 0x78, 0xBC, 0xEF, 0xE5, 0xE2, 0x9A, 0x4B, 0xF2, 0xC5, 0xE8,
+    0xEC, 0x64, 0xE3, 0xDF, 0xD7, 0xFB, 0x1A, 0xEB, 0xD9, 0x8D, 0x58, 0x92, 0xFA, 0x98, 0x41, 0x9D,
+    0x2F, 0xC8, 0x4A, 0x4F, 0x58, 0xA6, 0x74, 0xB2, 0xFA, 0x5C, 0x5D, 0x66, 0x8C, 0x1E, 0x0C, 0x37,
+    0xCB, 0xCE, 0x9D, 0xD5, 0x34, 0x02, 0xB8, 0x49, 0xE8, 0x4C, 0x8F, 0x4D, 0xA9, 0xD6, 0x0C, 0xDC,
+    0x57, 0xB5, 0x7E, 0x2E, 0x68, 0x50, 0x1E, 0xD3, 0x20, 0x1D, 0x1D, 0x0D, 0x5A, 0x69, 0x7B, 0x0E,
+    0x54, 0x66, 0x24, 0xD6, 0x55, 0x3B, 0xD2, 0x9F, 0x12, 0xD2, 0xA0, 0x47, 0x57, 0x2B, 0x08, 0xCE,
+    0x07, 0xC9, 0x94, 0xD7, 0x9F, 0xF1, 0x30, 0xD1, 0x12, 0x6D, 0x0A, 0x6D, 0x30, 0x63, 0x5F, 0x04,
+    0x09, 0x6A, 0x7A, 0x80, 0x1A, 0xED, 0x1A, 0xC3, 0xD0, 0x69, 0x75, 0x6B, 0xDC, 0x8E, 0x8D, 0xD5,
+    0xE4, 0x1A, 0x9B, 0x53, 0x96, 0xF2, 0xD6, 0x4E, 0x12, 0x23, 0x2A, 0x5B, 0xBB, 0xD7, 0x5E, 0x16,
+    0xBE, 0xCD, 0x8D, 0x45, 0x56, 0xB5, 0x4B, 0x64, 0x68, 0xFC, 0xA3, 0xF8, 0xB4, 0x26, 0x15, 0x05,
+    0x82, 0xF5, 0xC7, 0x4B, 0x4C, 0x76, 0xB2, 0x79, 0xA3, 0x72, 0x9B, 0x86, 0xEF, 0x82, 0x48, 0x37,
+    0x04, 0x49, 0xD9, 0x98, 0x7B, 0x0A, 0x4E, 0x7C, 0x1A, 0x10, 0xE7, 0xC8, 0x10, 0x23, 0x1B, 0xEF,
+    0x30, 0xD5, 0xEF, 0x6B, 0x6B, 0xC4, 0x3A, 0x04, 0xBA, 0xA0, 0x0D, 0xA0, 0x6F, 0x7B, 0xE8, 0xA5,
+    0x47, 0xFC, 0x17, 0x46, 0x23, 0xE6, 0x1D, 0xC6, 0x37, 0xC4, 0xB9, 0x21, 0xE5, 0x34, 0xFF, 0xF8,
+    0xD4, 0x67, 0xDA, 0x6F, 0xC3, 0x74, 0x71, 0x3A, 0x1B, 0xCB, 0xE7, 0xAA, 0x8F, 0x7F, 0x93, 0xFC,
+    0xEF, 0xF5, 0x0B, 0xCD, 0x55, 0xBB, 0x8E, 0xD3, 0x40, 0x14, 0xBD, 0xB6, 0x95, 0xCD, 0x8A, 0x14,
+    0xD3, 0xEC, 0x16, 0x68, 0x0B, 0x37, 0x34, 0x54, 0xFE, 0x04, 0x5B, 0x50, 0x6E, 0x43, 0x01, 0x0D,
+    0x34, 0x7C, 0x01, 0xFC, 0x01, 0x31, 0xEC, 0x07, 0xD0, 0xB0, 0x3D, 0x0D, 0x12, 0xD2, 0x7E, 0x84,
+    0x2D, 0xED, 0x0F, 0x58, 0xF0, 0x03, 0x91, 0x08, 0x0D, 0x34, 0x96, 0x08, 0xC2, 0xC5, 0xD8, 0x87,
+    0x73, 0xC6, 0x49, 0x88, 0x22, 0x0A, 0x5E, 0x52, 0x18, 0x25, 0xC7, 0x71, 0xEE, 0xDC, 0xC7, 0xDC,
+    0x7B, 0xE6, 0x5E, 0xB3, 0xC9, 0x1B, 0xB3, 0x18, 0x58, 0x5A, 0x06, 0x78, 0x03, 0x21, 0xC1, 0xF2,
+    0xCC, 0xCF, 0x60, 0x89, 0x77, 0xDE, 0x92, 0x2E, 0xEB, 0x2C, 0x5E, 0xE5, 0x2B, 0xB3, 0x22, 0x6F,
+    0xCD, 0x6C, 0xBE, 0x85, 0x6A, 0x0F, 0x56, 0x12, 0x74, 0x84, 0xDC, 0x0B, 0x40, 0x48, 0xB1, 0xB0,
+    0x9B, 0x33, 0x1A, 0xED, 0x13, 0x59, 0xB6, 0x0A, 0xE8, 0x8C, 0xEF, 0x8D, 0xD9, 0xE9, 0x7D, 0xCA,
+    0x27, 0x26, 0x9D, 0x85, 0x40, 0xDA, 0xD3, 0x00, 0x32, 0xE6, 0xF4, 0x5F, 0x55, 0x12, 0x6E, 0xF3,
+    0x7B, 0xAC, 0x6D, 0x79, 0xB1, 0xD9, 0x9B, 0xF7, 0xC1, 0x34, 0xDF, 0xA3, 0xB0, 0x25, 0xB2, 0x9D,
+    0x45, 0x17, 0xE8, 0x20, 0xA8, 0xC6, 0xC3, 0x5C, 0x5E, 0x11, 0x8A, 0x58, 0x10, 0x75, 0x04, 0x6B,
+    0x05, 0xB6, 0x86, 0xF2, 0xD4, 0x14, 0x5A, 0xB1, 0x05, 0xFD, 0xB7, 0x95, 0xAE, 0x21, 0xA8, 0x6D,
+    0xAC, 0x5C, 0x3E, 0xF2, 0xA9, 0x2C, 0x6F, 0x1D, 0x29, 0xE8, 0xC7, 0xFC, 0xC6, 0xFA, 0x91, 0x2A,
+    0x01, 0x55, 0x27, 0x3D, 0x86, 0x9A, 0x28, 0xD2, 0xA8, 0x38, 0x78, 0x7C, 0x4F, 0x14, 0x86, 0xF4,
+    0xA6, 0x60, 0x76, 0xDD, 0x67, 0xC6, 0x97, 0x3F, 0x67, 0x6C, 0x83, 0x3D, 0x33, 0xBB, 0x65, 0x27,
+    0x07, 0x8E, 0xEF, 0xC4, 0xEE, 0x99, 0xE1, 0xEE, 0xC0, 0x18, 0x2F, 0x30, 0x82, 0x21, 0xEE, 0x6D,
+    0x6F, 0x1D, 0x20, 0xB4, 0xE3, 0xC0, 0x3B, 0x12, 0x9F, 0x9C, 0x4B, 0x51, 0x46, 0x55, 0xBD, 0x2D,
+    0x67, 0x85, 0x81, 0xBC, 0xAE, 0x40, 0x0B, 0xE5, 0xEF, 0x7E, 0x52, 0x29, 0x4A, 0x5D, 0xCC, 0x89,
+    0x3B, 0x4B, 0x79, 0x35, 0xE8, 0xBF, 0x4D, 0x86, 0x1F, 0x6C, 0xF9, 0x37, 0xF6, 0xCF, 0x4A, 0x19,
+    0x77, 0xA8, 0xDD, 0x37, 0xEF, 0xDA, 0xF9, 0xCB, 0x76, 0xDA, 0xBE, 0x56, 0xB6, 0xB5, 0x78, 0x11,
+    0x3F, 0xF0, 0x8C, 0x74, 0x61, 0x24, 0x6B, 0xDE, 0x99, 0x1B, 0x42, 0x8A, 0x7E, 0xF9, 0x25, 0x02,
+    0xDE, 0x85, 0x4C, 0xF5, 0x13, 0x9B, 0x24, 0xFD, 0xAC, 0xCB, 0x5B, 0x5C, 0xC3, 0xF9, 0xAC, 0xA9,
+    0x76, 0x38, 0xCF, 0xC6, 0x72, 0x41, 0x37, 0x19, 0x06, 0x69, 0xCA, 0xC6, 0x9F, 0x3C, 0xA6, 0xC0,
+    0x1D, 0xFA, 0xCA, 0xA1, 0xCA, 0x3D, 0xA0, 0xD9, 0x23, 0xA8, 0x6B, 0xA9, 0xAE, 0x6C, 0x27, 0xAA,
+    0x98, 0x48, 0xD3, 0xA4, 0x24, 0x38, 0x9B, 0xD5, 0x9C, 0xBE, 0x7A, 0x0A, 0x6B, 0x95, 0x97, 0x4D,
+    0x89, 0x5B, 0x1C, 0x24, 0x88, 0x99, 0x89, 0x5E, 0x0D, 0xEC, 0x0A, 0x9F, 0xCA, 0xD4, 0xD3, 0x1C,
+    0x39, 0x73, 0xA3, 0x1A, 0xDE, 0x46, 0x1B, 0x81, 0x34, 0xB2, 0x51, 0xA3, 0x97, 0xC6, 0x14, 0xA3,
+    0xA9, 0x22, 0x7C, 0x6A, 0xC3, 0xC7, 0xA7, 0xA8, 0x63, 0xF9, 0x2B, 0x85, 0x43, 0x61, 0x21, 0x90,
+    0xFD, 0x15, 0x0D, 0x89, 0x7A, 0x93, 0x43, 0x5A, 0x84, 0x62, 0x8A, 0xCD, 0xF1, 0x57, 0x5D, 0x3F,
+    0x4B, 0x6A, 0xD8, 0xCF, 0x17, 0xC4, 0x7E, 0xBC, 0xE7, 0x83, 0xB5, 0x39, 0x87, 0x38, 0xB7, 0x8A,
+    0xD8, 0x37, 0x63, 0x65, 0xDC, 0xDB, 0x8C, 0xB9, 0x67, 0xB1, 0x32, 0x56, 0x81, 0x86, 0xD8, 0xFB,
+    0x18, 0xBD, 0x44, 0x03, 0x16, 0x12, 0x7D, 0x41, 0x23, 0xD1, 0x35, 0x6A, 0x89, 0x66, 0x78, 0x31,
+    0xA8, 0x87, 0xE3, 0x9C, 0xA2, 0xD6, 0x41, 0xA2, 0x3A, 0x85, 0x44, 0x54, 0x97, 0x88, 0x0F, 0x89,
+    0x6C, 0xAE, 0xB2, 0xD6, 0x8C, 0x51, 0x22, 0xA3, 0x28, 0x43, 0x13, 0x89, 0x77, 0x3A, 0xE7, 0xC2,
+    0x85, 0x8B, 0x13, 0xEA, 0x19, 0x0B, 0x75, 0x2A, 0x4B, 0x56, 0x01, 0x31, 0x62, 0x13, 0xDA, 0x8B,
+    0x3A, 0x9F, 0x9D, 0xF9, 0x70, 0x90, 0x9D, 0x8E, 0x32, 0x79, 0x65, 0x61, 0xC2, 0x2C, 0x02, 0x13,
+    0xFA, 0xF1, 0x1A, 0x33, 0x75, 0xCB, 0x14, 0x0D, 0x73, 0x1B, 0xA3, 0x55, 0xDE, 0xC9, 0x0F, 0x35,
+    0x25, 0xAF, 0x41, 0x43, 0x64, 0x9A, 0xB2, 0x5E, 0x53, 0x26, 0x5D, 0xA3, 0x46, 0x8C, 0xDB, 0xC1,
+    0xD4, 0x6B, 0x62, 0x10, 0xA9, 0x95, 0x75, 0x9A, 0x38, 0xF9, 0x2A, 0x1B, 0x54, 0x3F, 0xC7, 0x66,
+    0x80, 0x66, 0xC6, 0x21, 0xA6, 0xAB, 0xC0, 0x02, 0x05, 0x8F, 0xDA, 0x0C, 0x5D, 0x7F, 0x7B, 0x38,
+    0xB2, 0xFF, 0x68, 0xE4, 0x66, 0x98, 0x1F, 0xAC, 0xAA, 0x6E, 0x43, 0xB9, 0x19, 0x5B, 0x96, 0x2F,
+    0xF6, 0x0E, 0xF1, 0xBF, 0x9E, 0xE2, 0x6F, 0xD7, 0x77, 0xD5, 0x55, 0x2D, 0x8F, 0xD5, 0x50, 0x10,
+    0x9D, 0xB6, 0xB0, 0x15, 0x25, 0xB9, 0x08, 0x14, 0x88, 0x22, 0x10, 0xB8, 0xFB, 0x13, 0x5A, 0x20,
+    0xAC, 0x5E, 0x8D, 0xC2, 0x60, 0x30, 0xEF, 0x0F, 0x90, 0xB4, 0x0E, 0x81, 0x59, 0x01, 0xFF, 0x60,
+    0x0D, 0x84, 0x04, 0x8B, 0xDA, 0xF6, 0x27, 0xD4, 0x21, 0x30, 0x15, 0xEB, 0x69, 0xC2, 0x4D, 0xE8,
+    0x26, 0xB7, 0x3D, 0x9C, 0x99, 0xBE, 0x25, 0x64, 0x43, 0x82, 0x59, 0x12, 0x76, 0xF2, 0xDE, 0x79,
+    0xB9, 0x5F, 0x33, 0x73, 0x66, 0xEE, 0x3D, 0x4F, 0xE4, 0x60, 0x14, 0x5A, 0x19, 0x15, 0x2B, 0x28,
+    0xA2, 0xE9, 0x45, 0xB2, 0x58, 0x72, 0xC1, 0x4D, 0xF9, 0x24, 0x92, 0xB6, 0x49, 0x2D, 0x17, 0x76,
+    0xF3, 0x2D, 0x21, 0x05, 0xB8, 0xEA, 0x81, 0x45, 0xA4, 0x03, 0xD0, 0xA6, 0x38, 0x2B, 0x31, 0xE4,
+    0xE0, 0xCA, 0xE4, 0x38, 0x89, 0xE0, 0x67, 0xFA, 0x8B, 0x55, 0x30, 0xA4, 0x13, 0xBF, 0x34, 0xC4,
+    0x72, 0x8F, 0x1D, 0xD1, 0xFD, 0x86, 0x65, 0x6C, 0x82, 0x21, 0x4F, 0xF9, 0xB9, 0x62, 0x36, 0x55,
+    0xF0, 0xAB, 0x48, 0x33, 0x39, 0xD4, 0x09, 0x86, 0x02, 0x67, 0xF7, 0xD0, 0x66, 0x0C, 0xB5, 0x5A,
+    0x44, 0xDD, 0xCC, 0xB0, 0x4C, 0xE5, 0xD9, 0xD1, 0xAF, 0xD4, 0x92, 0x35, 0xE3, 0x4C, 0x86, 0x37,
+    0x83, 0x48, 0x01, 0x28, 0x7E, 0x81, 0x72, 0xE9, 0x21, 0x97, 0xEC, 0xBF, 0x64, 0x91, 0xD4, 0x5A,
+    0x67, 0x17, 0xFC, 0xA8, 0x4E, 0x34, 0x9C, 0x33, 0x2C, 0x82, 0x1F, 0xAE, 0x43, 0xFE, 0xB4, 0x87,
+    0x72, 0x2B, 0x9D, 0x65, 0x29, 0x83, 0x8B, 0x65, 0x40, 0x5F, 0x22, 0x72, 0x47, 0x2F, 0x3E, 0x6A,
+    0x32, 0xE2, 0xF8, 0xC5, 0xB7, 0x50, 0x44, 0x1F, 0x9A, 0xDE, 0x4F, 0xAF, 0xC4, 0x4B, 0x2D, 0xB7,
+    0x95, 0xF9, 0x0B, 0x49, 0xAC, 0x67, 0xED, 0x67, 0x45, 0xEC, 0x48, 0x05, 0xCA, 0xAE, 0x3B, 0xCF,
+    0xD5, 0x45, 0xE4, 0x6C, 0x9F, 0xA1, 0x96, 0x6A, 0x91, 0x6E, 0xE4, 0x40, 0xE9, 0x71, 0x8B, 0xD0,
+    0xF7, 0x69, 0x17, 0xB8, 0xEE, 0x5F, 0xE3, 0x11, 0xFA, 0x62, 0x6C, 0x82, 0x8F, 0xE9, 0x9C, 0xE1,
+    0x31, 0xFA, 0x53, 0xCD, 0x3E, 0xFA, 0x36, 0x47, 0x82, 0xAF, 0x23, 0x49, 0x94, 0x98, 0xA5, 0x58,
+    0x45, 0x93, 0x57, 0x2E, 0xBD, 0xFA, 0x6D, 0x16, 0xC9, 0x51, 0x67, 0x38, 0x4F, 0x19, 0x4D, 0x63,
+    0xCE, 0x52, 0x7D, 0xD2, 0x8A, 0x66, 0x63, 0xA3, 0x1B, 0x6F, 0xC8, 0xDD, 0x13, 0x63, 0xF6, 0xC0,
+    0x30, 0xB7, 0xD7, 0x22, 0x9D, 0xF5, 0xA3, 0x30, 0xEA, 0x6C, 0x80, 0xCD, 0xF9, 0x69, 0xEB, 0xCC,
+    0xA5, 0x4E, 0xE5, 0xA4, 0xC1, 0x22, 0xD1, 0x19, 0xF3, 0xFD, 0x4E, 0x86, 0xCC, 0x22, 0x65, 0x6C,
+    0x67, 0xB4, 0x48, 0x20, 0xB9, 0xD2, 0x01, 0x99, 0x49, 0x39, 0xB3, 0xD2, 0xA2, 0xE5, 0xEA, 0xD6,
+    0x43, 0x4C, 0xA2, 0x0D, 0xE3, 0xA2, 0xE3, 0x4F, 0x6D, 0xF7, 0x45, 0xD3, 0x3E, 0x78, 0xBF, 0x4F,
+    0xD0, 0x38, 0x48, 0xB3, 0x71, 0x08, 0x26, 0x06, 0xD8, 0x12, 0x37, 0x92, 0xDD, 0xB1, 0x3D, 0x2D,
+    0xB9, 0x66, 0xB4, 0x3E, 0x1A, 0x56, 0x61, 0xEB, 0x93, 0x32, 0x49, 0x17, 0xDD, 0x26, 0xDD, 0x13,
+    0x95, 0xBA, 0x72, 0x70, 0x14, 0x06, 0x79, 0x2E, 0xF7, 0xAF, 0x15, 0xAD, 0x3B, 0xA2, 0xEF, 0xAC,
+    0x9C, 0x4C, 0xA1, 0x51, 0x2C, 0x4A, 0x71, 0xD2, 0xCB, 0x48, 0xE9, 0x8B, 0xF2, 0x27, 0x23, 0x93,
+    0x04, 0xF8, 0x41, 0x5A, 0xF4, 0x54, 0x61, 0xE6, 0xA0, 0xF5, 0xFF, 0x80, 0xC9, 0x7E, 0xC0, 0x67,
+    0x99, 0x30, 0x61, 0xD2, 0x60, 0xE9, 0x29, 0x17, 0x3B, 0xE8, 0xBF, 0x0A, 0x54, 0x85, 0x61, 0x7A,
+    0x91, 0xEA, 0x0B, 0xA3, 0xBD, 0xB4, 0x6B, 0x25, 0x07, 0xDB, 0xB5, 0xD3, 0xC6, 0x24, 0x46, 0x74,
+    0x7B, 0x53, 0xD5, 0x6A, 0xB9, 0x0F, 0x1B, 0xE7, 0xCB, 0x8C, 0x96, 0x02, 0x4B, 0x87, 0xE8, 0xB0,
+    0x54, 0x08, 0xB9, 0x7E, 0x7A, 0xE9, 0x5A, 0xEA, 0x93, 0x30, 0x1A, 0xA6, 0x54, 0x15, 0x2B, 0x68,
+    0x3D, 0x7C, 0x2C, 0x82, 0x6A, 0x9B, 0x1B, 0xB5, 0xB3, 0xDE, 0x8A, 0xD6, 0xA8, 0x7F, 0xD8, 0x0D,
+    0xEF, 0x16, 0xBB, 0x23, 0x56, 0x38, 0x3F, 0xFF, 0x15, 0x37, 0xB9, 0x65, 0x5F, 0xA6, 0x3D, 0x76,
+    0x2A, 0xBC, 0xA6, 0xBE, 0x3B, 0x1C, 0x8B, 0xB5, 0x90, 0xF0, 0xE1, 0x48, 0x5B, 0xB8, 0x5A, 0x1F,
+    0x87, 0x0C, 0x4F, 0x11, 0xB8, 0x50, 0x45, 0x42, 0xA9, 0xE0, 0x16, 0x85, 0x78, 0x01, 0x36, 0x57,
+    0x71, 0xCB, 0x21, 0x46, 0x3D, 0xA1, 0xEA, 0x3A, 0xF3, 0xEC, 0xBB, 0xBD, 0xBF, 0x02, 0x27, 0xB2,
+    0x05, 0x32, 0xB8, 0x6A, 0xFB, 0x09, 0xB5, 0x55, 0x3B, 0x6E, 0xD5, 0x40, 0x14, 0xBD, 0xB6, 0x93,
+    0xB8, 0xB0, 0xD0, 0x50, 0x93, 0xC2, 0x4B, 0x70, 0x43, 0x89, 0x18, 0x27, 0x2B, 0xA0, 0xE0, 0x89,
+    0x82, 0x0D, 0x20, 0x24, 0x24, 0x16, 0x00, 0x8C, 0x25, 0x0A, 0xDA, 0x14, 0x2C, 0x80, 0x22, 0x4D,
+    0x68, 0x60, 0x03, 0x64, 0x2C, 0x52, 0xD0, 0x5A, 0x42, 0x88, 0x82, 0xC6, 0x12, 0xBF, 0x82, 0x22,
+    0x16, 0x1A, 0x09, 0x03, 0x63, 0x1F, 0xCE, 0x75, 0x90, 0x78, 0xA9, 0x90, 0x40, 0x6F, 0x9E, 0x9D,
+    0xF8, 0x5D, 0xCF, 0x9C, 0xFB, 0x3B, 0xF7, 0x3C, 0x91, 0xDD, 0xEF, 0x22, 0xE2, 0x11, 0x44, 0x00,
+    0xD4, 0x82, 0x4F, 0x18, 0xC4, 0x77, 0x26, 0x8A, 0xED, 0x13, 0x48, 0x19, 0xC4, 0xB5, 0x45, 0x94,
+    0xAA, 0xCF, 0x20, 0xD5, 0x20, 0x68, 0xAB, 0x5E, 0xEC, 0x50, 0x75, 0x62, 0x62, 0xD9, 0x4B, 0x86,
+    0x62, 0xE4, 0xC1, 0x97, 0x68, 0x68, 0xF4, 0x23, 0x8D, 0x06, 0x6D, 0x86, 0x04, 0x91, 0x3B, 0x4B,
+    0xB4, 0x96, 0x27, 0x02, 0xB1, 0x0C, 0x68, 0xA4, 0x09, 0x27, 0x34, 0xD9, 0xAF, 0xC1, 0x84, 0x2A,
+    0xE2, 0x59, 0x74, 0xA8, 0x10, 0x4B, 0x3C, 0x04, 0x41, 0x64, 0xFB, 0x9A, 0xC8, 0x45, 0xFE, 0x37,
+    0xB5, 0x48, 0x1A, 0xF9, 0x40, 0x77, 0xC4, 0x6E, 0xF8, 0x6D, 0xE6, 0x43, 0xAE, 0xDF, 0x2E, 0xC8,
+    0xDA, 0xDA, 0x39, 0x12, 0x29, 0xE9, 0xA9, 0x00, 0x86, 0x14, 0x5F, 0x50, 0xDB, 0xBE, 0x1C, 0xB3,
+    0x89, 0x47, 0x76, 0x1A, 0x33, 0x9E, 0x9D, 0xBD, 0x44, 0xE8, 0x0A, 0x68, 0x4A, 0x60, 0xCC, 0xD0,
+    0xA0, 0x71, 0xBD, 0x19, 0x0B, 0xDD, 0xE3, 0xFB, 0x2A, 0xE6, 0x4C, 0x79, 0xB6, 0xF8, 0x86, 0x0E,
+    0xA3, 0x0D, 0x72, 0x9D, 0x9F, 0xB3, 0x18, 0xF2, 0x4E, 0x8F, 0xF3, 0x66, 0x8E, 0x92, 0x69, 0x30,
+    0x9E, 0x51, 0x19, 0xB5, 0x5E, 0xDE, 0x7C, 0x08, 0xE9, 0x93, 0xDF, 0x89, 0x57, 0x13, 0x43, 0xF9,
+    0xC9, 0xC4, 0x27, 0xDB, 0x4A, 0xD5, 0x4C, 0x92, 0x0D, 0x79, 0xBB, 0xE6, 0xFE, 0xF6, 0x81, 0x24,
+    0x40, 0xCB, 0xF6, 0xB1, 0x39, 0xB3, 0x0F, 0xD9, 0x9C, 0xA0, 0xB1, 0x1D, 0x3D, 0xDF, 0x5A, 0xCE,
+    0xF3, 0x21, 0x79, 0x86, 0x26, 0xA5, 0x67, 0xEE, 0xE3, 0xAB, 0xD1, 0x8C, 0xF9, 0xAC, 0x9E, 0xB9,
+    0xA7, 0x98, 0x53, 0xB4, 0x8E, 0xE6, 0xF7, 0x80, 0x9B, 0x0C, 0xBB, 0x50, 0x6F, 0xF3, 0x23, 0x2F,
+    0xB2, 0x5A, 0xEC, 0x78, 0x5F, 0x18, 0x59, 0x27, 0xF7, 0x5D, 0x94, 0xAC, 0x25, 0x2F, 0xCE, 0xAF,
+    0x0D, 0x95, 0x9E, 0xCB, 0xED, 0x4D, 0x64, 0x91, 0xF2, 0xE6, 0x04, 0x52, 0x04, 0x12, 0x6D, 0x6B,
+    0xE9, 0xC8, 0x66, 0x3D, 0x27, 0xE4, 0x1E, 0xAB, 0x21, 0x72, 0xEC, 0x59, 0xB5, 0xFD, 0x41, 0x92,
+    0x50, 0xD6, 0x52, 0xEE, 0x69, 0xE9, 0x1F, 0xB0, 0x07, 0xFA, 0xAA, 0x38, 0xD8, 0x68, 0x08, 0x3B,
+    0x87, 0x72, 0xBB, 0x96, 0x5D, 0x04, 0x87, 0x86, 0xC8, 0x5C, 0x8A, 0xFD, 0xC3, 0x07, 0x4E, 0x1B,
+    0xCF, 0x9D, 0xF0, 0xE6, 0x20, 0x16, 0xAD, 0x09, 0xE2, 0x19, 0x0D, 0x9E, 0x32, 0x82, 0x5D, 0xDD,
+    0xD6, 0xD2, 0x0F, 0x7E, 0x3C, 0x36, 0x38, 0xA5, 0xEF, 0x0C, 0xB5, 0x36, 0xDE, 0xE9, 0x00, 0x0B,
+    0xFD, 0x79, 0xF2, 0xD7, 0x0F, 0x25, 0x3E, 0xDE, 0x7C, 0xB4, 0x60, 0x8E, 0x16, 0x33, 0xD9, 0x52,
+    0x03, 0x7B, 0xDA, 0xDE, 0x95, 0xC8, 0x4A, 0xC7, 0xED, 0x48, 0x79, 0x54, 0x13, 0x68, 0x1F, 0xA7,
+    0x73, 0x39, 0x9A, 0x48, 0xD4, 0xCF, 0xB3, 0xB8, 0x8A, 0xB2, 0xE0, 0x3B, 0x45, 0x15, 0xC3, 0x21,
+    0xAC, 0xA2, 0xA2, 0x71, 0xEF, 0x40, 0xD3, 0xF7, 0x9B, 0xAF, 0x08, 0xC8, 0x50, 0x47, 0xA6, 0xD3,
+    0x2C, 0x38, 0x4C, 0x43, 0xFD, 0x5A, 0x06, 0x62, 0xE8, 0xD8, 0xD6, 0xCB, 0x20, 0x93, 0xBB, 0x72,
+    0xF8, 0x7B, 0xB0, 0xEE, 0xF1, 0xD6, 0x69, 0x56, 0x46, 0x39, 0x8E, 0x53, 0xC9, 0x0A, 0x67, 0x74,
+    0x22, 0x77, 0xCF, 0xB7, 0xD8, 0xA3, 0xCB, 0x40, 0xE9, 0x98, 0x7D, 0x2C, 0x87, 0x62, 0xB2, 0x5D,
+    0x36, 0x3B, 0x0A, 0x8B, 0xFF, 0x78, 0x03, 0x0C, 0x7F, 0xD6, 0xFA, 0xE1, 0xCD, 0xEA, 0xBA, 0x56,
+    0x82, 0xF1, 0x89, 0x23, 0x8C, 0x9D, 0xF7, 0xEE, 0xB0, 0xDC, 0x13, 0x23, 0x8A, 0xCC, 0xA6, 0x97,
+    0x6D, 0xA5, 0xD4, 0x16, 0xEF, 0xAB, 0xCA, 0xAB, 0x7A, 0x19, 0x68, 0x95, 0x12, 0x9D, 0xE7, 0x9C,
+    0xE1, 0xA5, 0xCD, 0x66, 0x7C, 0x26, 0xCF, 0x59, 0x7A, 0xFA, 0x30, 0xF4, 0x67, 0x7D, 0x23, 0xAE,
+    0xEC, 0x24, 0xE6, 0x43, 0x1A, 0xD2, 0x7E, 0x33, 0x39, 0xAA, 0x5E, 0x16, 0x43, 0x3E, 0x95, 0x21,
+    0x9F, 0xAA, 0x90, 0x45, 0x33, 0x48, 0x9D, 0x6C, 0x24, 0xB7, 0x64, 0x91, 0xE7, 0xAA, 0x55, 0x6D,
+    0x66, 0xA7, 0xB5, 0x9A, 0x6E, 0x4D, 0x95, 0x57, 0xA4, 0x50, 0x43, 0xFE, 0xF2, 0x6F, 0xF2, 0xB7,
+    0x2B, 0xC7, 0x07, 0x8B, 0xC8, 0x4B, 0x41, 0xA9, 0xB7, 0x0C, 0x9A, 0x64, 0xB0, 0x9D, 0x2A, 0xED,
+    0xB4, 0x26, 0xB3, 0xFF, 0x86, 0x79, 0x49, 0xA7, 0x30, 0x45, 0x47, 0xF5, 0x34, 0xAF, 0x23, 0xA5,
+    0xD3, 0xCA, 0x95, 0xFF, 0x02, 0x5C, 0x94, 0x89, 0x9A, 0xC4, 0xCB, 0xEF, 0x4F, 0x7F, 0x34, 0xE9,
+    0x5F, 0xD1, 0xB8, 0x42, 0xC5, 0x22, 0x9F, 0xEA, 0x8F, 0x68, 0x38, 0x23, 0x4B, 0xAA, 0x6F, 0x8E,
+    0x5D, 0x2F, 0x69, 0xA2, 0xF3, 0xA1, 0x1C, 0x5A, 0xD9, 0x7E, 0x51, 0x77, 0xCB, 0x31, 0x33, 0xEC,
+    0x12, 0x7F, 0x69, 0x1D, 0xD5, 0x31, 0xC1, 0x5B, 0x88, 0x99, 0x38, 0xDD, 0xF8, 0x32, 0x4B, 0x31,
+    0xB3, 0x3B, 0xFE, 0x54, 0x1F, 0x68, 0xF1, 0xEF, 0xF8, 0x2A, 0xBA, 0x90, 0x50, 0xD1, 0x3B, 0x3B,
+    0x68, 0x0B, 0x85, 0x32, 0x5F, 0x27, 0x3A, 0xA5, 0xCB, 0x98, 0xAE, 0xAD, 0x5F, 0xC5, 0x55, 0xB1,
+    0x8E, 0xD4, 0x30, 0x10, 0x1D, 0xC7, 0x77, 0xBB, 0x12, 0x16, 0xCA, 0x35, 0x5B, 0x51, 0xF8, 0x0F,
+    0xC8, 0x0F, 0x20, 0x6C, 0x68, 0x28, 0x28, 0xB8, 0xE2, 0xB6, 0x81, 0x82, 0x9E, 0x8A, 0x92, 0x2E,
+    0x11, 0x3F, 0x00, 0x0D, 0x15, 0x05, 0x0D, 0x05, 0xEC, 0x47, 0x9C, 0x57, 0xA2, 0xA0, 0x4D, 0x83,
+    0x28, 0x68, 0x16, 0x41, 0x77, 0xC5, 0x19, 0x29, 0x42, 0x41, 0x8A, 0x33, 0xBC, 0x71, 0x8E, 0xD3,
+    0xAD, 0x0E, 0xA4, 0xA3, 0x38, 0x9D, 0x25, 0x8F, 0x9C, 0x49, 0x32, 0xEF, 0x8D, 0xDF, 0x78, 0x4C,
+    0xAA, 0x9F, 0x11, 0x51, 0x88, 0x03, 0x51, 0xC9, 0xBC, 0x26, 0x1A, 0x42, 0x4F, 0x64, 0xEE, 0x8E,
+    0xF0, 0x92, 0xA2, 0xAD, 0xF1, 0x50, 0xAD, 0xA8, 0xE0, 0x1F, 0x3C, 0x52, 0xCD, 0x81, 0x3B, 0xCD,
+    0x18, 0xEB, 0x82, 0xBB, 0x7A, 0x20, 0x3B, 0x10, 0xB7, 0x8A, 0x9B, 0x32, 0x91, 0xED, 0x29, 0xC8,
+    0xD2, 0x5C, 0x60, 0x59, 0x27, 0xC5, 0x7D, 0x85, 0x08, 0xFC, 0x8D, 0xF9, 0x1E, 0x02, 0xEF, 0x00,
+    0x46, 0xB7, 0xC2, 0x08, 0xD3, 0x80, 0x14, 0xB9, 0x8D, 0x3C, 0x35, 0x20, 0x23, 0x4F, 0xDA, 0x9F,
+    0xE1, 0x33, 0x5B, 0x79, 0x9A, 0x33, 0x7B, 0x10, 0x19, 0x09, 0x5C, 0x3A, 0xDB, 0x6B, 0xFE, 0xC0,
+    0x64, 0x53, 0x1D, 0x89, 0x8F, 0x46, 0x2A, 0xC7, 0xB0, 0xA1, 0x70, 0x3C, 0x92, 0x19, 0x19, 0x0B,
+    0x78, 0x4C, 0x0A, 0x78, 0xF5, 0x91, 0xBD, 0x1D, 0x5C, 0xD2, 0x7C, 0x07, 0x7F, 0x6D, 0x0C, 0x73,
+    0x4F, 0x16, 0x93, 0x76, 0x0F, 0x24, 0xAC, 0x70, 0x50, 0x9D, 0x40, 0x63, 0x3B, 0xE6, 0x70, 0x13,
+    0x63, 0x56, 0x60, 0xA5, 0xC5, 0x7B, 0x9D, 0x2E, 0x9F, 0xC2, 0xBB, 0x93, 0xC4, 0x0D, 0x7B, 0x52,
+    0x23, 0x12, 0x77, 0x0F, 0x22, 0x99, 0x8D, 0xF3, 0x34, 0xA8, 0x78, 0x06, 0xFE, 0xC9, 0x5B, 0x82,
+    0x16, 0x1D, 0x39, 0xC4, 0x80, 0x7C, 0x08, 0xD6, 0xB8, 0xC1, 0x45, 0xC5, 0x9F, 0x79, 0x42, 0x16,
+    0x0A, 0x13, 0x72, 0xA6, 0x20, 0x5C, 0xBE, 0xE0, 0xD5, 0x50, 0x77, 0x0A, 0x34, 0x5B, 0xD7, 0x59,
+    0x21, 0x1E, 0x98, 0x1B, 0x85, 0x49, 0xB4, 0xC4, 0xFE, 0x56, 0xBE, 0xC5, 0xCF, 0xD6, 0xC3, 0xD3,
+    0x91, 0x7D, 0x8C, 0xE4, 0xA3, 0x6B, 0xB7, 0x2B, 0xE1, 0xB2, 0xF2, 0xC6, 0xB0, 0x6D, 0x8D, 0xA8,
+    0xE5, 0x40, 0x2E, 0xA2, 0xB8, 0x92, 0xE9, 0x50, 0x85, 0x3B, 0x97, 0x8E, 0x3C, 0x43, 0xDE, 0xC1,
+    0x93, 0x46, 0xD9, 0x97, 0x10, 0xD9, 0x36, 0x02, 0x75, 0x6D, 0xB5, 0x5A, 0xD5, 0x80, 0xC1, 0xF7,
+    0xBF, 0x96, 0xCB, 0x65, 0x2E, 0xBD, 0x79, 0x9C, 0x94, 0xC1, 0x66, 0x15, 0xD0, 0x45, 0xC1, 0xA9,
+    0x56, 0x2F, 0xF7, 0x10, 0x2A, 0x3D, 0x13, 0x3A, 0x20, 0xF3, 0x9A, 0xE3, 0x3C, 0x11, 0x47, 0xE4,
+    0x10, 0xC0, 0xAE, 0x40, 0x85, 0x77, 0x46, 0x4C, 0xF5, 0x66, 0x70, 0xDD, 0xA1, 0xED, 0xDD, 0xCF,
+    0xDE, 0xA2, 0xEA, 0x37, 0xF0, 0x70, 0x53, 0x45, 0x3B, 0x22, 0xD7, 0x92, 0x71, 0x28, 0x0C, 0x1F,
+    0xC1, 0x21, 0x89, 0xDD, 0xC4, 0x6B, 0xDA, 0x51, 0x4B, 0x81, 0xCC, 0xB8, 0xB7, 0xC4, 0x94, 0x59,
+    0x7B, 0xD1, 0x89, 0x80, 0x40, 0x13, 0x57, 0x08, 0x96, 0xD9, 0x3E, 0xDD, 0x56, 0x68, 0x17, 0xB3,
+    0xE0, 0x78, 0x83, 0x9B, 0xC0, 0x9A, 0xFB, 0x39, 0x47, 0x80, 0x69, 0xA6, 0xAA, 0x07, 0x5A, 0x71,
+    0xF1, 0x65, 0x97, 0x97, 0x9F, 0xD0, 0x15, 0x40, 0x8C, 0xBF, 0x23, 0xC7, 0x63, 0xDE, 0x68, 0xEE,
+    0x42, 0x22, 0x75, 0xA0, 0xF6, 0x4F, 0x09, 0x56, 0x62, 0x74, 0x9F, 0x09, 0x8A, 0xC3, 0x0A, 0x57,
+    0x2D, 0x67, 0x96, 0x5C, 0xEE, 0x25, 0xEB, 0xAB, 0xE2, 0x77, 0xC3, 0x9F, 0xEE, 0x17, 0x0B, 0xA9,
+    0x4A, 0xDA, 0xDC, 0x3C, 0x4A, 0x87, 0x4B, 0x22, 0xA7, 0x6D, 0xAA, 0x6D, 0x6A, 0xFB, 0xF9, 0x23,
+    0x15, 0x7A, 0xC3, 0xD1, 0x71, 0x53, 0x33, 0x24, 0xFC, 0x3F, 0x52, 0xD3, 0xD2, 0xCB, 0x32, 0x3D,
+    0xE2, 0xA6, 0x00, 0xB3, 0xD1, 0x97, 0xA8, 0x24, 0x48, 0xCD, 0xF7, 0xB9, 0xA5, 0x85, 0x5F, 0x9C,
+    0x80, 0x15, 0x83, 0x91, 0x92, 0xFA, 0x0A, 0x55, 0xF5, 0x88, 0xD6, 0x88, 0xAE, 0x23, 0xED, 0x66,
+    0x8F, 0xFC, 0x15, 0x6D, 0xD7, 0xD4, 0xF4, 0x6F, 0x8B, 0x31, 0x53, 0xBD, 0x65, 0x0D, 0xA5, 0x03,
+    0xE4, 0x66, 0x48, 0x87, 0x99, 0x76, 0x43, 0xE7, 0x06, 0x8E, 0xE5, 0x73, 0x4E, 0x8E, 0x51, 0xD6,
+    0x6B, 0xEC, 0x58, 0x8D, 0xB8, 0x0D, 0x2A, 0xA0, 0x1A, 0xA4, 0x7F, 0xF3, 0x1A, 0xD5, 0x6B, 0x46,
+    0x85, 0x68, 0x75, 0x44, 0x33, 0xD5, 0x2C, 0xC5, 0x61, 0xBB, 0x1A, 0x79, 0xF2, 0x0B, 0x00, 0x99,
+    0x24, 0x8A, 0x38, 0x11, 0x47, 0xF6, 0x5B, 0xEE, 0x23, 0xCA, 0x57, 0xD3, 0xA9, 0x7A, 0xD2, 0x8F,
+    0xA7, 0x92, 0x2F, 0xE4, 0xD5, 0x4C, 0x3E, 0xC5, 0x3D, 0x24, 0xC0, 0x29, 0xFF, 0x2A, 0xEC, 0x57,
+    0x99, 0xCA, 0x22, 0x4B, 0x28, 0xE4, 0xC5, 0x04, 0x31, 0xFA, 0xAF, 0x46, 0xBD, 0x87, 0xA9, 0x79,
+    0x2D, 0x97, 0x59, 0xD4, 0xD3, 0x01, 0x6E, 0xC3, 0x20, 0xE2, 0xC1, 0x50, 0x99, 0xFE, 0x65, 0x86,
+    0x3F, 0xA6, 0xC2, 0x45, 0xE8, 0x43, 0xFE, 0xB7, 0x15, 0x23, 0x9D, 0xA9, 0x47, 0xD0, 0x57, 0xFE,
+    0x3C, 0x9A, 0x74, 0x57, 0x96, 0x76, 0x2E, 0x66, 0xB1, 0x3C, 0xA0, 0xAB, 0x1E, 0xBF, 0x01, 0xD5,
+    0x55, 0x3D, 0x6E, 0xD5, 0x40, 0x10, 0x1E, 0xDB, 0xCA, 0xB3, 0x88, 0x25, 0xDC, 0x90, 0x02, 0x10,
+    0x32, 0x75, 0x24, 0xB4, 0x27, 0x00, 0xAF, 0x38, 0x01, 0xC5, 0x7B, 0x15, 0x87, 0xE0, 0x06, 0xAC,
+    0xE1, 0x02, 0xA4, 0xA1, 0x26, 0x05, 0x48, 0xE4, 0x51, 0xC0, 0x01, 0x90, 0xD6, 0x4A, 0x43, 0x19,
+    0x1F, 0xC1, 0x48, 0x41, 0x20, 0x51, 0xC4, 0x02, 0x4B, 0x59, 0xC2, 0xDA, 0xC3, 0x37, 0xEB, 0xBC,
+    0x24, 0x90, 0x3A, 0x10, 0x1C, 0x69, 0x9E, 0xB3, 0x9E, 0x9D, 0xEF, 0x67, 0xF6, 0x87, 0x48, 0x9E,
+    0xC4, 0xE5, 0x2D, 0x91, 0xDD, 0x65, 0xA2, 0xCC, 0xAB, 0x8E, 0xC8, 0x3C, 0x19, 0x31, 0xAC, 0x23,
+    0x3A, 0xF7, 0xA4, 0xCC, 0x4F, 0x79, 0x28, 0xB9, 0x57, 0x5C, 0xB3, 0x23, 0xD3, 0x26, 0x5C, 0x25,
+    0x9E, 0x94, 0x27, 0x5B, 0x11, 0xD7, 0x79, 0x47, 0xD9, 0x18, 0xA1, 0x8E, 0xE9, 0x54, 0x43, 0x09,
+    0xE3, 0x13, 0x15, 0xBD, 0xD1, 0x44, 0xFC, 0x0C, 0x75, 0xB3, 0x41, 0xEA, 0x96, 0x5C, 0x13, 0xC5,
+    0x98, 0x4D, 0x94, 0xB3, 0x14, 0xB5, 0x9D, 0x54, 0x1E, 0xE4, 0xB5, 0xAC, 0x65, 0xB4, 0x27, 0x49,
+    0x40, 0x98, 0x49, 0xAA, 0xE5, 0x5E, 0x80, 0x87, 0x30, 0x15, 0x21, 0x5A, 0x06, 0x2A, 0xD1, 0x72,
+    0x59, 0x85, 0x21, 0xA9, 0x99, 0x30, 0x43, 0x02, 0x6D, 0x2E, 0x5F, 0x9F, 0xE7, 0x7C, 0x2D, 0x44,
+    0xD5, 0x4E, 0xFC, 0xC3, 0x3F, 0x52, 0x11, 0xCC, 0xB8, 0x0A, 0x53, 0x7D, 0x40, 0xE6, 0x06, 0x31,
+    0x3B, 0x0C, 0x09, 0x63, 0x29, 0x94, 0x8A, 0x5D, 0x49, 0x48, 0x7C, 0x21, 0x09, 0x46, 0x4B, 0x42,
+    0xD6, 0x65, 0x02, 0x37, 0x42, 0x20, 0x4A, 0x1E, 0xBD, 0x61, 0x2D, 0xD0, 0x52, 0xC1, 0xE0, 0xA7,
+    0xA6, 0xFC, 0x68, 0xF9, 0x76, 0x20, 0x71, 0x00, 0xA2, 0x60, 0x01, 0xF0, 0xC4, 0x83, 0xD2, 0x89,
+    0xDE, 0x82, 0x9D, 0xE5, 0x36, 0x63, 0xDE, 0x03, 0x67, 0xCB, 0x3E, 0x16, 0x05, 0x06, 0xEF, 0x18,
+    0x6A, 0x68, 0x63, 0x31, 0x3F, 0x43, 0x7A, 0xB6, 0x23, 0xFC, 0xBC, 0x7C, 0xEA, 0x62, 0xFE, 0xCA,
+    0xBA, 0x6C, 0x0B, 0x97, 0x0C, 0xC4, 0xD5, 0xAC, 0xCA, 0xC5, 0x3A, 0x50, 0xBB, 0x81, 0x9A, 0x8A,
+    0xB9, 0x2A, 0x98, 0x1D, 0xFA, 0xC0, 0x95, 0x69, 0x73, 0x97, 0x49, 0x8E, 0x6D, 0x95, 0x47, 0xAB,
+    0x78, 0x2C, 0xF9, 0x90, 0x1B, 0x76, 0x65, 0x4F, 0x73, 0x3A, 0x2D, 0x7F, 0x87, 0xAE, 0x8A, 0xF0,
+    0x3E, 0x11, 0x95, 0xE5, 0xCF, 0x31, 0xD8, 0x2D, 0x56, 0x83, 0x6F, 0xB0, 0x69, 0x4D, 0xFF, 0x17,
+    0x06, 0x92, 0xC6, 0xDF, 0x5D, 0xBA, 0x45, 0x99, 0x4B, 0x1B, 0x14, 0xF0, 0x22, 0x03, 0x5A, 0x46,
+    0xFD, 0x17, 0x9C, 0xBC, 0xBC, 0xAE, 0x08, 0xC6, 0x44, 0x2B, 0xF0, 0xA1, 0x31, 0xC4, 0xA2, 0x0B,
+    0xBB, 0x86, 0xBF, 0x50, 0xD8, 0x78, 0x75, 0x60, 0xEF, 0x2E, 0xD0, 0x25, 0x21, 0x52, 0xA2, 0x13,
+    0xA9, 0x00, 0x5B, 0x71, 0x61, 0x78, 0x80, 0x11, 0x61, 0x63, 0xAB, 0x63, 0xD8, 0x2B, 0xC1, 0xA3,
+    0xB0, 0xFE, 0xB4, 0xB0, 0xD2, 0xC7, 0x09, 0x66, 0x0B, 0xE1, 0xF6, 0x49, 0x0F, 0xD7, 0x5E, 0x85,
+    0x15, 0xBA, 0x2F, 0xF0, 0x9E, 0xC4, 0x99, 0x84, 0xF7, 0x6F, 0xFA, 0x4C, 0x6C, 0xC8, 0x3D, 0x0E,
+    0x30, 0x08, 0x89, 0x7B, 0xA0, 0x92, 0x0E, 0x16, 0x9B, 0x93, 0x60, 0xFF, 0x08, 0xE2, 0x88, 0x11,
+    0x3D, 0xA5, 0x5F, 0x9D, 0x27, 0x05, 0xD6, 0xFC, 0x75, 0xE8, 0xE6, 0x61, 0xF2, 0xDC, 0x42, 0xDE,
+    0xB4, 0x25, 0x69, 0x63, 0x7E, 0xDC, 0x68, 0x37, 0xC9, 0xC0, 0xF1, 0x14, 0x83, 0x9E, 0x1C, 0x97,
+    0x8F, 0x31, 0xBA, 0x7D, 0xBA, 0xCA, 0x36, 0xB7, 0x50, 0xA7, 0x07, 0xC7, 0x5E, 0x8D, 0xFC, 0x11,
+    0xE6, 0xEC, 0xF9, 0x78, 0x34, 0x6D, 0xFA, 0x0D, 0x92, 0x60, 0x11, 0x09, 0x37, 0xE0, 0xC4, 0xF0,
+    0x1D, 0xAC, 0x91, 0x2B, 0xE0, 0xCF, 0xDF, 0xA3, 0xBD, 0x1D, 0xF0, 0x2A, 0x03, 0xC8, 0x35, 0x01,
+    0x5B, 0x6F, 0x56, 0x6D, 0x31, 0x00, 0x8A, 0x06, 0x38, 0x95, 0x3A, 0x74, 0x3C, 0x6F, 0xB3, 0x86,
+    0x66, 0x3A, 0xD6, 0x97, 0xC0, 0x91, 0xE8, 0x1D, 0x28, 0x62, 0x2E, 0x77, 0x94, 0x1F, 0xB4, 0x64,
+    0x8B, 0x3A, 0xED, 0x54, 0xA5, 0xF4, 0xBD, 0x13, 0x37, 0xD6, 0x5F, 0x86, 0x03, 0xDB, 0xF2, 0x90,
+    0xB1, 0x75, 0xA6, 0x2D, 0xBF, 0x33, 0xD9, 0x17, 0x2E, 0xF2, 0xB6, 0x09, 0x9D, 0xCE, 0xC5, 0x11,
+    0x17, 0x18, 0x88, 0x23, 0xA9, 0x2C, 0x71, 0xFE, 0xF4, 0x08, 0x0B, 0xCB, 0x43, 0x4F, 0x5B, 0x60,
+    0x21, 0x47, 0x8B, 0x55, 0xB1, 0x42, 0x2C, 0x99, 0x44, 0xF4, 0xAB, 0x37, 0xD5, 0xFC, 0x76, 0xC4,
+    0xFF, 0x4B, 0x37, 0xE2, 0xED, 0xC0, 0x29, 0x82, 0x86, 0x84, 0xA7, 0xCB, 0xEB, 0xCC, 0xC5, 0x19,
+    0xEF, 0xE0, 0x0B, 0x6B, 0xF0, 0xBA, 0xCF, 0x07, 0x63, 0xE1, 0x72, 0xCF, 0xB5, 0xFA, 0x8C, 0x8D,
+    0xAE, 0x90, 0x67, 0xE5, 0x8E, 0x84, 0x1B, 0xE8, 0x34, 0x6E, 0x50, 0x61, 0x10, 0xC1, 0xD3, 0x84,
+    0x7F, 0x3C, 0xFC, 0x00, 0x24, 0x40, 0x38, 0x6C, 0xAA, 0x8A, 0x16, 0x9A, 0x2E, 0xE8, 0xF9, 0x05,
+    0xCD, 0x55, 0xBD, 0x6E, 0xD4, 0x40, 0x10, 0xFE, 0x6C, 0x2B, 0xB1, 0x14, 0x17, 0xA6, 0xB9, 0x82,
+    0x1F, 0xE1, 0x16, 0xA5, 0xB9, 0x27, 0x40, 0x36, 0x6F, 0x90, 0x22, 0x27, 0x0A, 0x0A, 0x7A, 0x24,
+    0x94, 0x17, 0x40, 0xD8, 0x88, 0x17, 0x48, 0x73, 0x7D, 0x0A, 0x90, 0xC2, 0x5D, 0xC3, 0x03, 0x20,
+    0xF6, 0xDE, 0x00, 0x0B, 0x41, 0x6F, 0xA4, 0x44, 0x08, 0x68, 0x2C, 0xE4, 0xC2, 0x51, 0xEC, 0x1D,
+    0xBE, 0x59, 0x5F, 0x9C, 0x53, 0x68, 0x83, 0xC2, 0xDE, 0xF9, 0xBB, 0xBB, 0xD9, 0x9D, 0x99, 0x6F,
+    0xBE, 0xD9, 0xDD, 0xC3, 0x0E, 0xC2, 0x02, 0x49, 0x91, 0x94, 0x88, 0xAB, 0x3C, 0x43, 0x74, 0xD6,
+    0x03, 0xBE, 0xB4, 0x00, 0x4C, 0x4D, 0x48, 0x56, 0x58, 0x8F, 0xAD, 0xB7, 0x3A, 0x21, 0x27, 0x98,
+    0x8A, 0x74, 0x10, 0x42, 0x20, 0x27, 0x77, 0xBB, 0x48, 0x10, 0x74, 0x71, 0x87, 0xA0, 0x9D, 0xB6,
+    0xF0, 0x9B, 0xB4, 0x01, 0xB2, 0x54, 0x3D, 0xF3, 0x11, 0xCC, 0x15, 0x68, 0x74, 0x42, 0x33, 0xA4,
+    0x9D, 0x82, 0x68, 0x1A, 0xA9, 0x70, 0x3B, 0x62, 0xD0, 0x3E, 0xD0, 0xC8, 0x30, 0x42, 0x0A, 0xFC,
+    0x5D, 0x02, 0x93, 0x7D, 0x97, 0x3E, 0x2A, 0xE2, 0x22, 0x45, 0x0F, 0x89, 0x2B, 0x88, 0x81, 0x27,
+    0x35, 0x9F, 0x0C, 0x5E, 0x8B, 0x71, 0xEC, 0x1E, 0x32, 0x4E, 0x43, 0x8E, 0xCD, 0xD4, 0xCA, 0x37,
+    0x29, 0xE4, 0x53, 0xE7, 0xDB, 0xBC, 0x0A, 0x7F, 0x73, 0x5D, 0xC4, 0xB2, 0x94, 0x1B, 0xF3, 0xF8,
+    0xB2, 0x62, 0x68, 0xCD, 0xA9, 0xC9, 0xE7, 0x1F, 0x72, 0x91, 0x9A, 0xF9, 0x8A, 0x9C, 0x29, 0xB7,
+    0x98, 0xEC, 0x01, 0xEE, 0x33, 0xD8, 0x4B, 0x50, 0x0D, 0xE4, 0xAF, 0xE8, 0x87, 0xE9, 0x77, 0xA5,
+    0x1C, 0xD1, 0x17, 0xCE, 0x5B, 0xF9, 0x5F, 0xA6, 0xF5, 0x94, 0xE0, 0x81, 0x88, 0xCD, 0x54, 0x15,
+    0x69, 0x94, 0xBC, 0x50, 0x15, 0xC9, 0x72, 0x59, 0x11, 0x43, 0xA9, 0x88, 0x90, 0x5A, 0x31, 0x6F,
+    0x15, 0xD3, 0x4E, 0x71, 0xEA, 0x30, 0xD9, 0xC0, 0xF8, 0x2F, 0xCB, 0x74, 0x58, 0xDF, 0x38, 0x5F,
+    0x17, 0x41, 0x4A, 0x62, 0xA0, 0x91, 0xE7, 0x46, 0xB4, 0x19, 0xA4, 0xAD, 0x19, 0x0F, 0x35, 0xFB,
+    0xC9, 0x25, 0x2D, 0x4C, 0x1E, 0xED, 0x91, 0xA7, 0x8D, 0x4A, 0x84, 0xD2, 0xA6, 0x85, 0x6A, 0xEC,
+    0x7A, 0xFB, 0x9A, 0x4D, 0x88, 0x6C, 0x5C, 0xB0, 0xAE, 0xF6, 0xA1, 0xF6, 0xA3, 0xAA, 0xB1, 0xBD,
+    0x90, 0x42, 0xBB, 0x6B, 0x55, 0x12, 0x06, 0x0C, 0xE4, 0x9C, 0xD5, 0x4E, 0x3B, 0x9F, 0x66, 0x59,
+    0x45, 0x16, 0xA1, 0xE5, 0x6A, 0x7D, 0x9B, 0x0A, 0xA6, 0xA4, 0x99, 0x24, 0x68, 0x8E, 0x37, 0xCD,
+    0x35, 0xCD, 0x9E, 0x94, 0x34, 0x07, 0x72, 0xCA, 0x20, 0x31, 0x09, 0x9D, 0x11, 0x2D, 0xC3, 0xC6,
+    0xF2, 0x99, 0xCA, 0x78, 0x7B, 0xDE, 0x9E, 0x52, 0x9B, 0xF1, 0xD9, 0x76, 0x74, 0xB5, 0xDD, 0xEC,
+    0xF2, 0x20, 0x19, 0x6B, 0x4B, 0xD8, 0x57, 0xF6, 0x29, 0xA7, 0x47, 0x0F, 0x57, 0xA5, 0x6A, 0xC6,
+    0x09, 0x46, 0xD0, 0x09, 0xCA, 0xCF, 0x09, 0x4A, 0xB1, 0x94, 0x9F, 0x45, 0xD2, 0x91, 0x2C, 0x45,
+    0xD9, 0x31, 0xF6, 0xD8, 0xBB, 0x98, 0x18, 0x54, 0x73, 0x1E, 0xBD, 0x7A, 0x84, 0x32, 0x84, 0xCA,
+    0x06, 0xD9, 0x20, 0xA7, 0x07, 0xB2, 0xF2, 0x35, 0x5F, 0xA1, 0x38, 0x74, 0x6D, 0x53, 0x37, 0x4C,
+    0x32, 0xDD, 0x1C, 0xD4, 0x27, 0x1F, 0x41, 0x75, 0xF0, 0x96, 0xF2, 0x43, 0xF9, 0xDA, 0xE1, 0x9B,
+    0xB3, 0xDD, 0x39, 0xD7, 0x92, 0x19, 0x2A, 0x54, 0x48, 0x64, 0x29, 0x45, 0xDA, 0x72, 0x22, 0x55,
+    0x2D, 0x4C, 0x75, 0x01, 0xA2, 0x8A, 0xC9, 0xF8, 0xD3, 0x29, 0x95, 0x37, 0xBA, 0xCE, 0x3E, 0x25,
+    0x28, 0x01, 0x27, 0x53, 0x20, 0x8D, 0xE9, 0x31, 0xE1, 0x0B, 0xBB, 0x8B, 0x37, 0x6C, 0x0D, 0x8F,
+    0xC2, 0x00, 0xCF, 0x16, 0xC7, 0xB8, 0x32, 0x54, 0xB3, 0x56, 0xEB, 0x68, 0xCD, 0x70, 0x1A, 0xE7,
+    0x4B, 0xDD, 0x32, 0xBE, 0x82, 0xE7, 0xB6, 0x8D, 0xD3, 0x02, 0x6B, 0x28, 0x26, 0x4E, 0xEC, 0x6C,
+    0x04, 0xB5, 0x8D, 0xB3, 0x6B, 0x70, 0x6E, 0x17, 0x51, 0xE6, 0x4F, 0xBA, 0x44, 0x23, 0x8F, 0x89,
+    0x1A, 0x6F, 0xB1, 0x38, 0x0A, 0x9C, 0xE4, 0x52, 0x7B, 0xB3, 0x59, 0x36, 0x72, 0xD9, 0x7E, 0xA7,
+    0x7C, 0xB8, 0x33, 0xA5, 0x89, 0xAD, 0xE9, 0x92, 0x3A, 0xEA, 0xD3, 0x32, 0xB0, 0x39, 0xFB, 0x67,
+    0x4E, 0x1F, 0x0B, 0x23, 0x58, 0xD5, 0x5A, 0xBE, 0xCE, 0xF6, 0x0D, 0xCF, 0x8F, 0x29, 0x87, 0xAB,
+    0x21, 0xB5, 0x8F, 0x9E, 0x33, 0x45, 0xCF, 0x93, 0xDE, 0x51, 0xC6, 0xCA, 0x9D, 0x3F, 0x37, 0x5E,
+    0xE0, 0x1E, 0x60, 0xF9, 0x01, 0xF3, 0xAB, 0xD3, 0x4D, 0xD9, 0xE8, 0x01, 0x24, 0x5F, 0xEC, 0xDF,
+    0xB0, 0x06, 0xC8, 0x70, 0xCB, 0xAF, 0xF1, 0x3E, 0xE8, 0x02, 0xD5, 0xA1, 0xE4, 0xF6, 0xE1, 0x61,
+    0xDD, 0xB8, 0x86, 0xAE, 0x5D, 0x0B, 0xEA, 0x70, 0x95, 0x23, 0x3C, 0x8B, 0xFF, 0x60, 0x3F, 0xC0,
+    0x3F, 0x02, 0x2F, 0xAD, 0xCB, 0x27, 0xD2, 0x8B, 0x32, 0xFB, 0x27, 0x5A, 0xDC, 0x44, 0x79, 0xC0,
+    0x47, 0x95, 0x5E, 0x9B, 0xEB, 0x2A, 0x8B, 0x1D, 0x58, 0x16, 0x1D, 0xF2, 0x9E, 0xE2, 0x1F, 0xD0,
+    0xEA, 0x3A, 0xCB, 0xAC, 0xB1, 0x75, 0x40, 0x8A, 0xE9, 0x3A, 0xAD, 0xFE, 0x2F, 0xCA, 0x17, 0xAE,
+    0xE4, 0xB5, 0xB6, 0xB9, 0xBF, 0xAE, 0x75, 0xFC, 0x01, 0xCD, 0x55, 0xB1, 0x8E, 0xD3, 0x40, 0x14,
+    0x7C, 0xB6, 0x95, 0x33, 0xC2, 0x85, 0x29, 0xB8, 0x82, 0xCA, 0x2D, 0x9D, 0x7F, 0x00, 0x69, 0xCD,
+    0x3F, 0xDC, 0x09, 0x09, 0x1A, 0x6A, 0x74, 0x7C, 0x83, 0xDD, 0x53, 0x5F, 0x45, 0x4B, 0x71, 0xD1,
+    0x51, 0xD2, 0x22, 0xBB, 0xA3, 0xA0, 0xC0, 0x0D, 0xF5, 0xB9, 0xA1, 0x8E, 0x0B, 0x4B, 0x58, 0x68,
+    0xED, 0xC7, 0xCC, 0x73, 0x92, 0xBB, 0x03, 0x51, 0x22, 0xD9, 0x4A, 0x26, 0xAB, 0xDD, 0xEC, 0xCC,
+    0xEC, 0xBC, 0x97, 0xAC, 0xBC, 0x96, 0xA7, 0x22, 0x5E, 0x66, 0x11, 0x8D, 0x46, 0x91, 0xF2, 0xA6,
+    0x13, 0xC9, 0xB4, 0x11, 0x89, 0x55, 0x84, 0x2B, 0x77, 0x9E, 0x5A, 0x55, 0x47, 0x25, 0x70, 0xE4,
+    0x23, 0xBD, 0xBC, 0x06, 0x14, 0x21, 0x21, 0x18, 0x01, 0xD2, 0x13, 0x64, 0x0F, 0xD5, 0x29, 0x40,
+    0xB5, 0x38, 0x02, 0xE7, 0x8E, 0xAB, 0x7B, 0xB0, 0x6D, 0x07, 0x96, 0xCB, 0x57, 0x3E, 0x23, 0xF3,
+    0x51, 0x68, 0xA0, 0x6C, 0xD0, 0x45, 0x5D, 0x34, 0xA4, 0x6D, 0xE8, 0xF3, 0x4A, 0xB4, 0x16, 0x71,
+    0x13, 0x3C, 0xC2, 0x6C, 0xDC, 0xDD, 0x7A, 0x3B, 0xD9, 0xD2, 0x5F, 0x0B, 0x99, 0x21, 0x9D, 0x6B,
+    0x9F, 0xF5, 0xC9, 0xE4, 0xDA, 0x68, 0x2E, 0x9B, 0x48, 0xEB, 0x1F, 0x2F, 0x14, 0x8C, 0xB3, 0xF2,
+    0xFD, 0xFD, 0xFC, 0xAC, 0xC6, 0xE9, 0xEA, 0x16, 0x67, 0xED, 0x41, 0x35, 0x3F, 0x7F, 0x0B, 0xC9,
+    0x29, 0x81, 0x6A, 0xA0, 0xDA, 0xC9, 0xE6, 0x0C, 0x64, 0xE1, 0x27, 0x52, 0x3A, 0xAA, 0x87, 0xE6,
+    0x21, 0xBB, 0x01, 0x06, 0x53, 0x8A, 0x1D, 0x59, 0x9B, 0x62, 0xEF, 0x13, 0x79, 0x70, 0x94, 0xDE,
+    0x6C, 0x0B, 0xC6, 0xA5, 0xA3, 0x04, 0xF4, 0x2D, 0x39, 0xB0, 0xC3, 0xBE, 0x40, 0xAB, 0x6C, 0x92,
+    0x60, 0x16, 0x6D, 0x25, 0x1E, 0x98, 0x67, 0xDA, 0x90, 0xF3, 0xB1, 0x30, 0xDF, 0x7D, 0xC0, 0x99,
+    0x25, 0x5C, 0xF7, 0x26, 0xD5, 0x80, 0xE0, 0xAB, 0x0A, 0xCC, 0xE4, 0x5E, 0x52, 0x1D, 0x4B, 0x7C,
+    0x5B, 0x1B, 0xED, 0xB1, 0x14, 0xC1, 0x5B, 0xE2, 0x63, 0x60, 0xDE, 0x27, 0x3A, 0xBF, 0xD4, 0x26,
+    0x65, 0x40, 0xFC, 0xAE, 0x7A, 0xAC, 0x2B, 0x2A, 0x28, 0xA7, 0x34, 0x2F, 0x17, 0xC6, 0x25, 0xCC,
+    0x17, 0x3A, 0xE9, 0x0E, 0x29, 0xE5, 0x5F, 0xC0, 0x54, 0x86, 0xD0, 0xFA, 0x2C, 0xE3, 0xDD, 0x92,
+    0x06, 0xDB, 0xCD, 0x15, 0x0D, 0xC3, 0x24, 0x52, 0x88, 0xF4, 0xFD, 0x7C, 0x11, 0x4F, 0x01, 0x68,
+    0xBD, 0x68, 0x41, 0xA8, 0x0C, 0xE2, 0x39, 0x64, 0x09, 0x77, 0x60, 0xA5, 0x9C, 0x30, 0xA9, 0xC8,
+    0x43, 0x2D, 0x66, 0x3A, 0x09, 0x29, 0x69, 0xA4, 0x42, 0x0A, 0xDA, 0xB3, 0xD4, 0x43, 0xFA, 0x0B,
+    0x51, 0xB8, 0x5E, 0xD2, 0xD1, 0x75, 0x92, 0x0D, 0xC8, 0xBA, 0xEC, 0xDD, 0x7C, 0xAD, 0x2D, 0xD3,
+    0x29, 0x2C, 0x2D, 0x79, 0xC3, 0xE0, 0x96, 0x27, 0x29, 0x42, 0xB4, 0x86, 0x2B, 0x72, 0x8C, 0x75,
+    0x87, 0x35, 0x24, 0xD1, 0x10, 0xCD, 0xED, 0xB9, 0xAC, 0x35, 0xEC, 0x47, 0xCB, 0x8F, 0xE4, 0x19,
+    0xB6, 0x06, 0x96, 0x0B, 0x48, 0x1C, 0x2C, 0x48, 0x3C, 0xCB, 0x1A, 0x73, 0x46, 0xFB, 0x12, 0xFF,
+    0xCA, 0x24, 0x6F, 0xE5, 0xFE, 0xB3, 0xB6, 0xA6, 0xBE, 0xB2, 0x7E, 0x3E, 0x28, 0xD8, 0x28, 0x9C,
+    0xE4, 0x50, 0x81, 0x35, 0xE5, 0xBC, 0xB6, 0xE4, 0x02, 0x2B, 0x7E, 0xD9, 0x58, 0xDD, 0x2B, 0x12,
+    0x5B, 0x6B, 0x26, 0xF6, 0xDF, 0xEA, 0x38, 0x1D, 0x9A, 0xE8, 0xC9, 0x6D, 0x93, 0x38, 0xC2, 0x74,
+    0x58, 0xE1, 0xBD, 0xB0, 0x04, 0x13, 0xDB, 0xC8, 0xE6, 0x8C, 0xE3, 0xC3, 0x9A, 0xDA, 0xFB, 0xA3,
+    0x39, 0x49, 0xA7, 0xE5, 0xAA, 0xB2, 0x8F, 0xE4, 0xE7, 0x12, 0x67, 0xE4, 0xED, 0xC0, 0x11, 0x63,
+    0x7D, 0x28, 0xE1, 0x1F, 0xAD, 0x1E, 0x52, 0x47, 0xF5, 0x9B, 0x6A, 0xEB, 0x10, 0xB5, 0x4E, 0xB8,
+    0x48, 0x06, 0x5E, 0x55, 0x28, 0x17, 0xE9, 0x20, 0xEF, 0x2C, 0x79, 0x56, 0x2E, 0x52, 0xBB, 0xB6,
+    0x52, 0x7F, 0x5C, 0x62, 0x9D, 0x1B, 0x9E, 0xDB, 0x2E, 0x38, 0xCB, 0xDF, 0x6A, 0x61, 0x4B, 0xFF,
+    0xDC, 0x75, 0x9F, 0xB0, 0xE2, 0x7C, 0xC9, 0x36, 0xD1, 0x77, 0x8B, 0x0D, 0xBC, 0x0A, 0xCB, 0xE8,
+    0xFF, 0x3E, 0xBF, 0x01, 0xB5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0xDB, 0xB9, 0xB8, 0x30,
+    0xD2, 0x56, 0x29, 0x28, 0xD0, 0x36, 0x54, 0x41, 0xC2, 0x2D, 0x45, 0x22, 0xFB, 0x47, 0xE4, 0x44,
+    0x4B, 0x4B, 0xFE, 0xC3, 0x61, 0xFF, 0x04, 0x0A, 0x7E, 0x00, 0x05, 0x05, 0x49, 0x4D, 0x01, 0x05,
+    0xD8, 0x1D, 0xED, 0x21, 0x7E, 0x00, 0x2E, 0x2E, 0x15, 0x8D, 0x91, 0x5C, 0x6C, 0x82, 0xED, 0xC7,
+    0x9B, 0x75, 0x72, 0x01, 0x21, 0x91, 0xAF, 0xC3, 0xB2, 0x66, 0x77, 0x67, 0x77, 0xC6, 0x6F, 0xDF,
+    0xCE, 0x3E, 0xCB, 0x4C, 0xF8, 0x04, 0x50, 0x6B, 0xBC, 0x85, 0xDA, 0xE4, 0x87, 0xDA, 0x22, 0x18,
+    0x44, 0xA2, 0x2E, 0x68, 0xE5, 0xE2, 0x99, 0xE5, 0x34, 0x29, 0x68, 0x43, 0x0C, 0xBA, 0x0E, 0x9D,
+    0x8F, 0x59, 0xD2, 0x44, 0xEA, 0x16, 0xA3, 0x6E, 0xC9, 0x7C, 0x08, 0xEA, 0xC3, 0x9C, 0x6E, 0xCB,
+    0x69, 0x03, 0xA0, 0x96, 0x8C, 0xB6, 0x14, 0x9C, 0x5A, 0xD0, 0x5D, 0xDA, 0x5E, 0x57, 0x73, 0x69,
+    0xD6, 0x71, 0x29, 0x93, 0x44, 0xEA, 0xCE, 0xCD, 0x15, 0xEE, 0xEA, 0x34, 0xC4, 0xCA, 0xA0, 0x4F,
+    0xD1, 0x65, 0x68, 0x99, 0x36, 0x05, 0x72, 0xA0, 0xCF, 0xA6, 0xC6, 0x12, 0x58, 0x85, 0x95, 0xA0,
+    0x61, 0x94, 0x87, 0xC6, 0x46, 0x3F, 0x0C, 0x0C, 0x53, 0x33, 0xEE, 0xE0, 0x64, 0xFE, 0x14, 0xAF,
+    0xCE, 0xE7, 0xD6, 0x2B, 0xF5, 0xF9, 0xAB, 0xD1, 0x95, 0xB2, 0x5E, 0xF9, 0xAF, 0x46, 0xB3, 0xE4,
+    0x31, 0x46, 0xF2, 0xE3, 0xFE, 0x84, 0x24, 0x3B, 0xA2, 0x84, 0x29, 0x55, 0x95, 0x92, 0x14, 0xFB,
+    0xAE, 0xE7, 0x6B, 0xBB, 0x3A, 0x7B, 0xAD, 0x5E, 0xF6, 0xA7, 0x6E, 0x84, 0x89, 0xBF, 0x47, 0x9A,
+    0x2E, 0x65, 0x6E, 0xC5, 0xCC, 0x2E, 0xE0, 0x24, 0x1B, 0x63, 0xD4, 0x0C, 0x23, 0x71, 0x9E, 0x9B,
+    0x89, 0x95, 0x2B, 0xBB, 0x9E, 0x30, 0x52, 0x55, 0xE1, 0x2B, 0x40, 0xE2, 0x98, 0xDF, 0x36, 0x4F,
+    0xB2, 0x7E, 0x51, 0x61, 0xF8, 0x58, 0xF4, 0x7B, 0xE6, 0xF2, 0x7C, 0x2B, 0x8C, 0xA4, 0xA9, 0x82,
+    0xE3, 0xF1, 0xDC, 0xF4, 0xB5, 0x1A, 0xA8, 0xE1, 0xC9, 0xF2, 0x61, 0xE6, 0xF6, 0x0B, 0x0C, 0x2F,
+    0x34, 0x79, 0xB7, 0x4E, 0x2E, 0xF3, 0x3C, 0x45, 0x59, 0xA0, 0xA4, 0x0D, 0xAE, 0x7A, 0x63, 0x85,
+    0x4C, 0x02, 0xFB, 0xDD, 0xE3, 0x37, 0x85, 0x66, 0x66, 0xE7, 0xED, 0x66, 0x71, 0xEE, 0x1E, 0x1F,
+    0x15, 0x18, 0x49, 0xC2, 0xCE, 0xFC, 0xE0, 0x2E, 0x08, 0x19, 0xB7, 0x27, 0xF7, 0x2A, 0x59, 0x14,
+    0x3F, 0x39, 0xEC, 0x12, 0x1E, 0xDA, 0xC1, 0x26, 0x71, 0x6E, 0xC9, 0xD6, 0xBE, 0x3C, 0x28, 0xCA,
+    0x45, 0xA6, 0xD5, 0xDD, 0x86, 0x63, 0x7E, 0x17, 0xB4, 0x1B, 0x81, 0x14, 0x3A, 0x31, 0x8D, 0xD8,
+    0xA5, 0xA4, 0x7C, 0xCF, 0xE8, 0xAF, 0x63, 0x7F, 0xFB, 0x59, 0xE9, 0x81, 0xAE, 0x64, 0xE5, 0xD5,
+    0x21, 0xAF, 0xFA, 0xD1, 0x9D, 0x8E, 0x5E, 0xE2, 0x4E, 0x2C, 0x55, 0xA3, 0xF4, 0xEF, 0x09, 0xAF,
+    0x82, 0x24, 0xC3, 0x79, 0xC2, 0x4F, 0xBC, 0x50, 0xE7, 0xA8, 0x64, 0x94, 0xCD, 0x16, 0xC6, 0xAD,
+    0x89, 0xB5, 0xC0, 0x37, 0xE0, 0x0B, 0x74, 0xE0, 0x28, 0x79, 0x79, 0xE6, 0x78, 0xD9, 0x55, 0xEB,
+    0xBC, 0x9E, 0x39, 0x89, 0xFE, 0xEB, 0x40, 0xA5, 0x2F, 0x6B, 0x13, 0xA0, 0xE1, 0x47, 0x75, 0x1F,
+    0x45, 0x23, 0x6B, 0x49, 0x0E, 0xA8, 0xA5, 0xAA, 0xE9, 0x4E, 0xBC, 0x84, 0xAB, 0xB5, 0x93, 0x0B,
+    0xFE, 0xFE, 0x6F, 0xAF, 0xFC, 0xF1, 0xB1, 0x74, 0x19, 0x85, 0x3A, 0xA3, 0x6E, 0xB4, 0xFC, 0x23,
+    0xA4, 0x7D, 0xA8, 0x7B, 0x94, 0xDD, 0x5C, 0x0E, 0x45, 0x7E, 0xBF, 0xCB, 0x32, 0x4F, 0xD0, 0x58,
+    0x7C, 0xD6, 0x9D, 0xB6, 0xD5, 0x18, 0xA2, 0xF7, 0x47, 0x3F, 0x85, 0x5B, 0xAA, 0x55, 0x1B, 0x8F,
+    0x62, 0xAE, 0xE7, 0xB4, 0x78, 0x69, 0x94, 0xC3, 0x88, 0xFA, 0x84, 0x09, 0xA9, 0xC7, 0x9E, 0xAA,
+    0x7A, 0x18, 0xBD, 0x61, 0x66, 0xF4, 0x80, 0x55, 0x1B, 0xB5, 0xD2, 0x12, 0xBF, 0x01, 0x2D, 0xAF,
+    0xE0, 0x3D, 0xFD, 0x8E, 0xDB, 0x63, 0x49, 0x7E, 0x77, 0x32, 0x26, 0x9D, 0x69, 0xE2, 0xE6, 0xBE,
+    0xCC, 0x2E, 0x90, 0x32, 0xE3, 0x72, 0x12, 0x62, 0xE7, 0xA9, 0xA0, 0x32, 0x4E, 0x9A, 0x9D, 0xDF,
+    0x62, 0xD8, 0xEA, 0x5F, 0x4D, 0xCF, 0x54, 0x52, 0xE7, 0x67, 0x48, 0x51, 0x48, 0x02, 0x0B, 0x2E,
+    0x50, 0x55, 0xFF, 0xE0, 0xA9, 0x7E, 0x47, 0x48, 0xAD, 0x27, 0x36, 0xD1, 0x39, 0xB3, 0x8C, 0x3A,
+    0x5B, 0xDB, 0xFC, 0xF1, 0xE5, 0x7F, 0xF4, 0x19, 0x03, 0x6B, 0x56, 0x2B, 0x71, 0xF7, 0xEB, 0xB4,
+    0xAA, 0xFD, 0xE6, 0x26, 0x43, 0x3B, 0x61, 0x48, 0x34, 0x4D, 0xC7, 0x43, 0x2D, 0xA5, 0x20, 0x86,
+    0xE7, 0x72, 0xFD, 0xE7, 0x17, 0xC5, 0x55, 0xBB, 0x6E, 0xD5, 0x40, 0x10, 0x5D, 0xDB, 0x24, 0x57,
+    0xC2, 0xC5, 0xD2, 0xA4, 0xA0, 0x40, 0xFB, 0x07, 0xF8, 0x13, 0xD6, 0x11, 0x05, 0x45, 0x0A, 0x52,
+    0x40, 0x43, 0x45, 0x4F, 0x91, 0x1F, 0x40, 0xBA, 0x56, 0x28, 0x29, 0x48, 0x43, 0x9F, 0x9A, 0x9A,
+    0xDE, 0x46, 0x94, 0x34, 0x46, 0x7C, 0x00, 0x96, 0xF8, 0x81, 0x1B, 0x61, 0x21, 0x47, 0xB2, 0x7D,
+    0x38, 0x67, 0xEE, 0x43, 0x49, 0x83, 0x42, 0x04, 0xC2, 0xD2, 0x3D, 0x1E, 0xEF, 0xCC, 0xCE, 0xCC,
+    0x99, 0x9D, 0x9D, 0x5B, 0x63, 0xF4, 0x98, 0x80, 0x31, 0x60, 0xAC, 0xD1, 0x2D, 0xD0, 0x65, 0x28,
+    0x33, 0x38, 0xA2, 0x1F, 0x85, 0x71, 0x25, 0x44, 0x43, 0x7C, 0x34, 0x3B, 0xE2, 0x93, 0x41, 0xB8,
+    0xEC, 0x84, 0x5C, 0x16, 0x9A, 0x5C, 0xDB, 0xFA, 0xC9, 0x64, 0x36, 0x28, 0x65, 0x6F, 0xBB, 0x0E,
+    0x61, 0x1E, 0x6A, 0xF3, 0x56, 0xC8, 0x79, 0xE9, 0xD1, 0x06, 0x0C, 0x19, 0x86, 0x1A, 0x93, 0x03,
+    0x9F, 0xD1, 0x15, 0xA3, 0xE3, 0x93, 0x9C, 0x11, 0x4A, 0x49, 0xF9, 0x60, 0x68, 0xAB, 0xD9, 0x15,
+    0x5C, 0xF4, 0xC2, 0xD0, 0x09, 0xEF, 0x0A, 0x0E, 0x64, 0xA6, 0x3C, 0x72, 0xC6, 0x71, 0x29, 0x64,
+    0xC5, 0xFC, 0xF9, 0x68, 0xD1, 0x31, 0x7D, 0xE7, 0xFC, 0xD5, 0x45, 0x88, 0x53, 0x44, 0xEB, 0xC7,
+    0x14, 0x55, 0x86, 0x84, 0xA9, 0xE2, 0x23, 0x21, 0xAE, 0x08, 0x7E, 0xC2, 0x96, 0x11, 0xBE, 0x71,
+    0x57, 0xBC, 0xA0, 0x17, 0x3F, 0xC6, 0x81, 0x8B, 0x99, 0x2C, 0x9B, 0xBA, 0xA7, 0xA5, 0x87, 0x0B,
+    0x73, 0x09, 0xBA, 0x59, 0x05, 0x92, 0x1D, 0x13, 0x8B, 0xB5, 0xC7, 0xCC, 0xEF, 0x28, 0x48, 0x6C,
+    0xB7, 0x41, 0x9D, 0x05, 0x8D, 0x95, 0x72, 0x96, 0x49, 0x90, 0x26, 0x15, 0xC3, 0x67, 0xA5, 0xB2,
+    0x1D, 0xE8, 0x61, 0x89, 0x53, 0x80, 0xE2, 0x02, 0x65, 0x82, 0x8A, 0x9E, 0xC2, 0x50, 0xAC, 0x5C,
+    0x82, 0x37, 0x74, 0x10, 0x2E, 0xE9, 0x20, 0xB1, 0x7C, 0x02, 0x13, 0xA7, 0xF8, 0x56, 0xAB, 0x43,
+    0x2D, 0x83, 0xD7, 0xA8, 0x28, 0x86, 0x99, 0x62, 0xC5, 0xEA, 0x2F, 0xA7, 0x0C, 0x5D, 0x81, 0xC1,
+    0x53, 0x81, 0x2A, 0x5A, 0x01, 0x9F, 0xF2, 0xF7, 0x42, 0x21, 0xF5, 0x15, 0x94, 0xD1, 0xFA, 0x98,
+    0x58, 0x95, 0x6C, 0x56, 0xC1, 0xAD, 0xD8, 0xBB, 0x47, 0xE7, 0xC1, 0x03, 0x99, 0x24, 0xF5, 0xB2,
+    0xAB, 0x04, 0xE5, 0x6D, 0xE1, 0x83, 0x60, 0x24, 0x24, 0x82, 0x8C, 0xF0, 0xEE, 0x25, 0x1B, 0x0D,
+    0x6A, 0x35, 0x60, 0xD0, 0xC9, 0x33, 0xCA, 0x31, 0x4B, 0xB3, 0x80, 0xAB, 0xD9, 0x88, 0x6D, 0x3C,
+    0xDB, 0x64, 0x72, 0xE0, 0xEA, 0x29, 0x47, 0x5F, 0xA0, 0x55, 0xBF, 0x4C, 0x2E, 0xF6, 0xEE, 0x0F,
+    0x44, 0x56, 0x73, 0xA9, 0xAE, 0xEE, 0xFE, 0x0B, 0x21, 0x7B, 0x8E, 0xD5, 0xAC, 0xD6, 0x77, 0xAA,
+    0x73, 0xAA, 0x3E, 0x48, 0xE6, 0x6D, 0x1B, 0xE7, 0xEA, 0xCA, 0xFD, 0xF2, 0xEF, 0xF1, 0x74, 0xEA,
+    0x3C, 0xFA, 0x67, 0x44, 0xDF, 0xBB, 0xA2, 0x71, 0xB3, 0xF3, 0x9D, 0xBB, 0x6F, 0x99, 0xEC, 0x09,
+    0xBC, 0xBA, 0xCF, 0xB7, 0xAC, 0x87, 0xE7, 0x0D, 0x98, 0x42, 0xC3, 0x7A, 0x04, 0xDE, 0xC5, 0x2A,
+    0x88, 0xD8, 0x03, 0xC1, 0x9D, 0x7F, 0x54, 0x8F, 0x83, 0xA4, 0xAC, 0x27, 0xFF, 0x19, 0x7D, 0x3C,
+    0x41, 0x4B, 0x93, 0x47, 0x2B, 0x3F, 0x85, 0x32, 0xF6, 0xAF, 0x1C, 0xBE, 0x70, 0xDA, 0x1C, 0xF2,
+    0xD2, 0x39, 0xD1, 0x22, 0x2F, 0x73, 0x7A, 0xA3, 0x4F, 0x32, 0x77, 0x4B, 0x5D, 0x3C, 0x72, 0xBF,
+    0xD9, 0x21, 0xEF, 0x6B, 0xB2, 0x85, 0x41, 0x43, 0x68, 0xDC, 0x42, 0xE8, 0x95, 0x7B, 0x79, 0x1B,
+    0x52, 0x3A, 0xD3, 0x5E, 0x11, 0x4B, 0x4E, 0x9E, 0x7E, 0xB3, 0x3D, 0xFE, 0x4E, 0x48, 0xCF, 0x6D,
+    0x90, 0xC6, 0xDE, 0x4F, 0x1B, 0x21, 0x1F, 0xAC, 0xEC, 0xBF, 0xD9, 0x55, 0xB3, 0x65, 0x48, 0xD3,
+    0x2D, 0x78, 0xA3, 0x19, 0x87, 0x35, 0x58, 0x13, 0xCD, 0xB1, 0xCE, 0x56, 0x83, 0x45, 0xC6, 0x6B,
+    0xEB, 0xAD, 0x78, 0x48, 0xB3, 0x78, 0xB9, 0x9E, 0x64, 0x12, 0x65, 0xB6, 0x58, 0x83, 0x39, 0x96,
+    0xED, 0xC3, 0xDD, 0xB6, 0x0F, 0xDA, 0xE6, 0x1B, 0x23, 0x2C, 0x31, 0x36, 0xC6, 0x38, 0x11, 0xD1,
+    0xC6, 0x28, 0x7B, 0x89, 0x25, 0xE7, 0x1B, 0x29, 0xA7, 0x0C, 0x2F, 0xD2, 0x74, 0xAC, 0x6D, 0x93,
+    0xB9, 0xD0, 0xC7, 0xCF, 0xC6, 0x83, 0xE5, 0x64, 0x7B, 0xAE, 0xCC, 0xCB, 0xC4, 0xC4, 0x39, 0xEF,
+    0xDB, 0xF4, 0xBA, 0x99, 0x7D, 0xE4, 0xE8, 0x58, 0x50, 0x23, 0xC5, 0x6B, 0x51, 0x59, 0x9B, 0x16,
+    0xF6, 0x5A, 0x60, 0x3D, 0x88, 0x6C, 0x78, 0x7A, 0x1B, 0xAB, 0x2E, 0x76, 0xBB, 0x1B, 0x75, 0xFD,
+    0x01, 0x34, 0x1B, 0xBF, 0xF2, 0xC5, 0x7A, 0x1C, 0x31, 0xB1, 0x80, 0x3E, 0x61, 0xB5, 0xD2, 0x99,
+    0xE1, 0x46, 0xFD, 0x87, 0x78, 0xB6, 0x49, 0xD1, 0xB1, 0x02, 0x2B, 0x57, 0x57, 0xB4, 0x5F, 0x49,
+    0x35, 0xA3, 0x93, 0xEA, 0x07, 0x5A, 0xA9, 0x3E, 0x91, 0x24, 0x55, 0x39, 0x4E, 0xA9, 0xE2, 0x0C,
+    0x3A, 0xA2, 0x8A, 0x03, 0x5E, 0xAA, 0x26, 0x40, 0x2A, 0x6E, 0x97, 0x8A, 0x2F, 0xA9, 0x48, 0x4B,
+    0x2A, 0x16, 0x41, 0x2A, 0x47, 0x15, 0x49, 0x26, 0xFA, 0x3B, 0x43, 0x93, 0xA2, 0x63, 0xAD, 0x36,
+    0x87, 0xB1, 0x9E, 0xF3, 0xEE, 0x9E, 0x31, 0x31, 0xA2, 0x93, 0xB1, 0x69, 0x76, 0x7F, 0x6F, 0xC6,
+    0x35, 0x18, 0xEF, 0xF3, 0xEB, 0xCC, 0x9E, 0x27, 0xEF, 0xD9, 0x5F, 0x17, 0x74, 0xBE, 0x44, 0xAD,
+    0xB2, 0xC2, 0xBC, 0xF7, 0xCB, 0x51, 0x53, 0x5C, 0xF1, 0x2A, 0x96, 0x31, 0x0C, 0xAE, 0x96, 0x98,
+    0xDF, 0x40, 0x5C, 0x4E, 0xCC, 0xB1, 0xA0, 0x07, 0x7C, 0x07, 0x1E, 0x63, 0xDE, 0x04, 0xFA, 0x05,
+    0xD5, 0x54, 0x2F, 0x6F, 0xD7, 0x50, 0x14, 0xBD, 0x6D, 0xD9, 0x2A, 0x2A, 0x3A, 0x81, 0x83, 0xA4,
+    0x16, 0xD7, 0x8F, 0xD0, 0xA2, 0x10, 0x33, 0x08, 0x66, 0xD0, 0x18, 0x30, 0x58, 0x5C, 0x1B, 0x2C,
+    0x06, 0xC1, 0x07, 0xC0, 0xF2, 0xD3, 0xF8, 0xD7, 0x6C, 0x02, 0x81, 0x69, 0xC6, 0x07, 0xA0, 0x81,
+    0x39, 0xC4, 0x4A, 0x78, 0xA2, 0x24, 0x6D, 0x0F, 0xE7, 0xDE, 0xF7, 0x63, 0x6C, 0x0B, 0x24, 0x0B,
+    0x09, 0x04, 0x5E, 0x93, 0xDB, 0x3F, 0xE7, 0xFD, 0xB9, 0xF7, 0x9C, 0x7B, 0x5A, 0xA1, 0x93, 0x06,
+    0x1E, 0xE8, 0x62, 0xE0, 0x18, 0xA8, 0x53, 0x2C, 0xFC, 0x20, 0xE2, 0x5A, 0x01, 0x24, 0x5E, 0x25,
+    0xC1, 0x2A, 0xD9, 0x24, 0x39, 0x66, 0x29, 0x07, 0xA9, 0x78, 0x53, 0xC8, 0x4D, 0x0A, 0xCD, 0xF0,
+    0x0A, 0x8D, 0x18, 0x15, 0x3A, 0xC4, 0xA0, 0x50, 0x82, 0x63, 0x85, 0x12, 0xBC, 0x55, 0x28, 0xC5,
+    0x29, 0xA1, 0x2E, 0x07, 0x08, 0x71, 0x17, 0x85, 0xA4, 0x80, 0x42, 0x52, 0x42, 0x21, 0xEE, 0xD9,
+    0x66, 0xF0, 0xD2, 0xAC, 0x3C, 0x71, 0x14, 0x37, 0x25, 0xCC, 0x46, 0xD0, 0x8B, 0x8E, 0xE7, 0x1A,
+    0xAE, 0xDB, 0x23, 0x4F, 0xD2, 0x51, 0x8C, 0x76, 0xAB, 0x02, 0x0E, 0x8B, 0x69, 0x80, 0xAA, 0xD6,
+    0x6E, 0x0F, 0x34, 0xDC, 0x8F, 0x36, 0x12, 0xE3, 0x33, 0xCF, 0x6B, 0xE0, 0xE0, 0xB9, 0xA7, 0xD5,
+    0xE8, 0x1B, 0x9E, 0x3E, 0x73, 0xF7, 0x08, 0x6D, 0xBE, 0x48, 0x31, 0x89, 0xD3, 0xC7, 0xEC, 0x0A,
+    0x8F, 0xCD, 0x12, 0x61, 0x2A, 0xB9, 0x03, 0x3E, 0x02, 0x77, 0xB8, 0xF1, 0x76, 0xEC, 0x69, 0x28,
+    0x35, 0x9D, 0xD8, 0xB2, 0xC9, 0xC7, 0xB3, 0xC4, 0x0A, 0xFD, 0x9A, 0x78, 0x7D, 0xBC, 0xA5, 0x21,
+    0x6A, 0xE5, 0xB5, 0xCE, 0xE8, 0x6C, 0x4E, 0xD5, 0xD9, 0xA4, 0xEA, 0xBD, 0x2D, 0x68, 0x42, 0x29,
+    0xCD, 0xB6, 0xBC, 0x5A, 0x2E, 0x0D, 0xAA, 0x11, 0x01, 0xEF, 0x78, 0xCB, 0x80, 0x7D, 0xAA, 0x54,
+    0xC0, 0x47, 0x54, 0xC3, 0x24, 0x9A, 0x83, 0x44, 0x53, 0x90, 0x68, 0x0C, 0xEA, 0x8D, 0x0A, 0xAD,
+    0x18, 0x14, 0xFA, 0x82, 0x5E, 0xA1, 0x23, 0x74, 0x0A, 0x65, 0x78, 0xAA, 0x3A, 0xE4, 0xD8, 0x57,
+    0x1D, 0x72, 0x28, 0xD4, 0x15, 0x50, 0x88, 0xCB, 0x4D, 0xA2, 0x2A, 0x48, 0xD4, 0x04, 0x89, 0x9C,
+    0xA9, 0x27, 0x84, 0x4A, 0xA5, 0xCE, 0x24, 0x8A, 0x31, 0x50, 0x55, 0x1E, 0x6E, 0xA9, 0xC6, 0x67,
+    0x09, 0x3F, 0x11, 0xAA, 0x91, 0xF7, 0x5A, 0x81, 0xCB, 0x06, 0xD6, 0xBF, 0xCE, 0x5A, 0xB3, 0x4D,
+    0x6B, 0x06, 0x65, 0x61, 0xBA, 0x58, 0xD9, 0x9F, 0x97, 0x2A, 0xB6, 0x36, 0x22, 0x7F, 0x21, 0xC9,
+    0x7C, 0x9B, 0x80, 0xEB, 0x42, 0xF7, 0xCC, 0xE1, 0xB5, 0x09, 0xED, 0x93, 0x8E, 0xF2, 0x30, 0x7A,
+    0x25, 0xB2, 0xC6, 0xF8, 0xA0, 0x34, 0x77, 0x8E, 0xF9, 0x8C, 0x89, 0x4F, 0x35, 0xAF, 0xF6, 0x1A,
+    0x0B, 0x3E, 0x69, 0x74, 0x45, 0x45, 0xFA, 0xB9, 0x01, 0xEB, 0xCF, 0xC3, 0xAB, 0xFC, 0xF6, 0xAB,
+    0xFB, 0x1A, 0xD1, 0x00, 0xAA, 0x9C, 0x63, 0xDF, 0x93, 0x80, 0x1C, 0x4B, 0xF5, 0xDD, 0x99, 0xED,
+    0x4F, 0x9C, 0xB9, 0x06, 0xD9, 0x97, 0x0B, 0xCE, 0x9C, 0x82, 0x33, 0x7D, 0x70, 0xE6, 0x18, 0x9C,
+    0x39, 0x04, 0x67, 0xF6, 0xC1, 0x99, 0x87, 0xC1, 0x99, 0xCF, 0x82, 0x33, 0x1F, 0xAB, 0xB6, 0x59,
+    0x90, 0xFD, 0x17, 0xCE, 0xAC, 0xD5, 0x99, 0xD5, 0x12, 0x9C, 0xE9, 0xCF, 0x39, 0x33, 0xB2, 0x76,
+    0xBD, 0x69, 0xDC, 0x45, 0xB3, 0xB9, 0x91, 0x7D, 0x69, 0x56, 0x80, 0xB5, 0x70, 0x15, 0xFA, 0x79,
+    0x57, 0xA9, 0x7F, 0x44, 0x85, 0x4B, 0x14, 0x18, 0x4C, 0xE0, 0x8A, 0x3C, 0xCE, 0xA6, 0x2F, 0x09,
+    0xCC, 0x17, 0x93, 0xD7, 0x74, 0xBB, 0x42, 0x48, 0xD1, 0x67, 0x0B, 0x95, 0xCD, 0xC8, 0x8F, 0x37,
+    0xEE, 0x7E, 0x84, 0x72, 0xDA, 0xFA, 0x87, 0x9D, 0xA9, 0x69, 0x50, 0xCE, 0x42, 0x5D, 0xBA, 0xFB,
+    0x92, 0x9F, 0x36, 0x1B, 0x6A, 0x4F, 0x09, 0x7B, 0xCB, 0xB3, 0xB3, 0x2F, 0xED, 0x25, 0x8B, 0xED,
+    0xBC, 0x30, 0x13, 0x87, 0xD5, 0x24, 0x57, 0x54, 0x79, 0xD2, 0x7F, 0x52, 0xA0, 0x4F, 0xF9, 0x33,
+    0xC4, 0xC8, 0x3E, 0x14, 0x78, 0x3D, 0xA8, 0x9A, 0x2B, 0x6F, 0x91, 0xE7, 0x95, 0x8B, 0x9E, 0x5A,
+    0x6C, 0xA3, 0x63, 0xCC, 0xCF, 0xC5, 0x62, 0x6E, 0xBC, 0xC5, 0x49, 0x53, 0xAC, 0x66, 0x55, 0xBF,
+    0x5C, 0x35, 0x53, 0x7A, 0x22, 0x62, 0x3D, 0x38, 0xB9, 0x81, 0x56, 0xBB, 0x7E, 0xB5, 0x13, 0x75,
+    0xB2, 0xFE, 0x2D, 0x69, 0x8C, 0xBB, 0x0C, 0x9B, 0xCD, 0x4B, 0x7B, 0x8F, 0x15, 0xD9, 0x39, 0x38,
+    0x38, 0x97, 0xEF, 0x2E, 0x6B, 0x62, 0x49, 0x75, 0xA2, 0x4B, 0xB9, 0xDE, 0x17, 0x34, 0xE6, 0x11,
+    0x42, 0x26, 0xF8, 0xB4, 0x4A, 0xBE, 0xBA, 0x41, 0xDC, 0x29, 0x7F, 0xE0, 0xFC, 0x0D, 0x88, 0xE3,
+    0x97, 0x4C, 0x53, 0xC2, 0x1B, 0xD4, 0xC5, 0x5C, 0x2D, 0x09, 0x6E, 0x73, 0xD5, 0x40, 0x3E, 0x26,
+    0x13, 0x5E, 0x76, 0xEE, 0x9D, 0xED, 0x9D, 0x74, 0x11, 0x49, 0xCA, 0xC6, 0xB4, 0x57, 0xDA, 0x9C,
+    0x35, 0xAB, 0xD9, 0xC7, 0x2D, 0x46, 0x55, 0xFD, 0x8F, 0xD3, 0xB6, 0xC7, 0x2B, 0xAF, 0xD3, 0x3A,
+    0x5E, 0x23, 0xAF, 0x80, 0xCE, 0x61, 0x11, 0xEE, 0xF9, 0x5F, 0xE2, 0xEF, 0x3F, 0x19, 0xDF, 0x00,
+    0xCD, 0x55, 0xB1, 0x6E, 0xD5, 0x40, 0x10, 0xDC, 0xB3, 0x49, 0x2C, 0xE1, 0xC2, 0x29, 0x68, 0x80,
+    0xC2, 0x2D, 0x9D, 0x7F, 0x00, 0x71, 0x8E, 0x28, 0x69, 0x82, 0x94, 0x80, 0x48, 0x43, 0x4D, 0x81,
+    0x68, 0xE9, 0xEE, 0x49, 0x7C, 0x00, 0x14, 0xF9, 0x80, 0xB4, 0x84, 0x82, 0x96, 0xCE, 0x4E, 0x28,
+    0x68, 0x0D, 0x12, 0xD0, 0xBA, 0x48, 0x44, 0x41, 0xC1, 0x21, 0x5C, 0x18, 0x64, 0xDF, 0x32, 0x73,
+    0xEF, 0x89, 0xA4, 0xA3, 0x81, 0x28, 0x56, 0x6E, 0x1D, 0xDD, 0x79, 0x77, 0x67, 0x66, 0xF7, 0xF6,
+    0x89, 0x98, 0x3A, 0x11, 0x91, 0xB4, 0x2B, 0x16, 0x22, 0x85, 0xAF, 0x5A, 0x11, 0xEB, 0x1B, 0x58,
+    0x3D, 0xD2, 0x5A, 0x92, 0x90, 0x4D, 0x38, 0xF4, 0x79, 0x27, 0x92, 0x2C, 0xD6, 0xE5, 0xCF, 0xB3,
+    0xB6, 0x07, 0x93, 0xA8, 0xF6, 0x22, 0x95, 0xEA, 0x2C, 0xD2, 0xA8, 0xEA, 0x22, 0xD1, 0xE3, 0x52,
+    0xBB, 0x4C, 0x71, 0xE2, 0x0B, 0x6C, 0xEA, 0x50, 0x8D, 0x88, 0x37, 0xD9, 0x21, 0x5A, 0x8F, 0x8F,
+    0x67, 0x07, 0x5B, 0xAE, 0x6C, 0x03, 0x5B, 0x9C, 0xB1, 0xE5, 0xE4, 0x86, 0x68, 0xE1, 0x55, 0x8D,
+    0x16, 0xA9, 0xED, 0x50, 0x05, 0x11, 0xE7, 0x0B, 0xAD, 0x8D, 0x76, 0xB9, 0x1E, 0x5F, 0xD7, 0x45,
+    0x8A, 0x54, 0x21, 0x66, 0xE4, 0xC7, 0x48, 0x0B, 0x28, 0xBB, 0x5B, 0x30, 0x46, 0x36, 0x44, 0x6E,
+    0x65, 0x9D, 0x64, 0x5E, 0x91, 0xBC, 0xEC, 0xA4, 0xFC, 0x30, 0x49, 0x32, 0xDA, 0x5A, 0x6C, 0xD6,
+    0x4B, 0xD2, 0xDE, 0x3C, 0x25, 0x20, 0xEB, 0x07, 0xB5, 0x64, 0xAA, 0x75, 0xCA, 0x60, 0x88, 0x38,
+    0x94, 0x63, 0xAA, 0x6F, 0x75, 0x89, 0x4D, 0xBF, 0x06, 0x29, 0x42, 0xD3, 0x4B, 0xF3, 0x2D, 0x48,
+    0x1E, 0x40, 0xB3, 0xC1, 0x4E, 0x4E, 0x90, 0xFA, 0x4E, 0xEB, 0x72, 0xB2, 0x73, 0xAA, 0x9B, 0xF0,
+    0xEA, 0x73, 0xD5, 0x11, 0x20, 0x00, 0x78, 0x6D, 0x9B, 0x61, 0x9F, 0x60, 0x53, 0x3D, 0x45, 0xC1,
+    0xD3, 0x66, 0xF1, 0xA5, 0xE2, 0xC2, 0xA6, 0x9E, 0xBC, 0x9A, 0x32, 0x82, 0xAF, 0x53, 0x6F, 0x47,
+    0x10, 0x96, 0xE2, 0x50, 0x5B, 0x10, 0x94, 0x1B, 0x51, 0xAA, 0x8E, 0xC2, 0x0B, 0x8E, 0xC5, 0x60,
+    0xBB, 0x08, 0xB2, 0x9D, 0x81, 0xA4, 0x45, 0x30, 0x6A, 0xC8, 0x60, 0x80, 0x43, 0xB0, 0xC9, 0xF2,
+    0x18, 0xE0, 0x29, 0x0F, 0xA4, 0x9B, 0x56, 0xDE, 0x63, 0xF4, 0x1E, 0x9B, 0x81, 0xC1, 0x21, 0xC1,
+    0xC0, 0x63, 0x7B, 0x88, 0xEA, 0xE8, 0xC9, 0x3D, 0x35, 0x4B, 0x28, 0xA3, 0x2C, 0xDF, 0xDD, 0x0A,
+    0x22, 0x20, 0xEF, 0xD4, 0x51, 0x8F, 0x97, 0xFC, 0x13, 0xA7, 0xBD, 0xD3, 0x0E, 0x95, 0xFD, 0x05,
+    0x49, 0x0A, 0x2A, 0xFD, 0x7A, 0xA2, 0x32, 0x3E, 0x0F, 0xD6, 0x1B, 0xED, 0xD3, 0x40, 0x79, 0xBA,
+    0x54, 0x81, 0x46, 0x4F, 0xEE, 0xF3, 0xC5, 0xD2, 0x6B, 0x7C, 0x45, 0xA1, 0x3E, 0xEE, 0x6C, 0x73,
+    0x13, 0x88, 0xA8, 0x16, 0x1A, 0xC4, 0x0D, 0x86, 0x95, 0xA2, 0x64, 0xE1, 0xEE, 0xE3, 0x32, 0xA6,
+    0x9D, 0xA1, 0xDB, 0x0F, 0xD5, 0x09, 0xA8, 0x16, 0x0D, 0x3E, 0x5A, 0xDB, 0x12, 0xB3, 0x43, 0x18,
+    0x2F, 0x68, 0xCA, 0x36, 0x76, 0x17, 0x71, 0x39, 0xB0, 0x03, 0x55, 0x44, 0x93, 0xEA, 0x98, 0x67,
+    0x1B, 0x67, 0x6A, 0x08, 0x0F, 0x83, 0xB4, 0xC7, 0x52, 0x44, 0x66, 0x64, 0x34, 0x09, 0x0B, 0x33,
+    0x50, 0x15, 0x94, 0x81, 0x90, 0x5B, 0xD1, 0x36, 0x55, 0x6C, 0xA3, 0xB1, 0xB8, 0x0D, 0x70, 0xD6,
+    0x53, 0x3C, 0x7D, 0x8F, 0xEF, 0xD8, 0x4C, 0x35, 0xFD, 0xFB, 0x28, 0x36, 0x52, 0xEA, 0x67, 0x9C,
+    0xA5, 0x9A, 0x2B, 0xA5, 0xA5, 0xD0, 0xD6, 0xD3, 0x6A, 0x5B, 0x06, 0x06, 0xA9, 0x94, 0x1A, 0x59,
+    0xBD, 0x83, 0x8A, 0x58, 0x45, 0x76, 0xA9, 0xA6, 0xA8, 0x1F, 0xDA, 0xF0, 0x12, 0xB1, 0x63, 0x59,
+    0xFC, 0xDF, 0x60, 0x21, 0x44, 0x82, 0xDA, 0xA6, 0x60, 0x2F, 0xED, 0x29, 0xEC, 0x07, 0x66, 0xBF,
+    0x0A, 0xC5, 0xE4, 0x14, 0x77, 0x02, 0x88, 0x21, 0x36, 0x14, 0xEA, 0x37, 0x0C, 0x3A, 0xF9, 0x6F,
+    0x2B, 0x03, 0x4D, 0xF8, 0x60, 0x85, 0x0B, 0xC8, 0x7F, 0x4D, 0x62, 0xDD, 0x68, 0xB3, 0x99, 0xB6,
+    0x20, 0x73, 0xB1, 0x91, 0x7B, 0x88, 0x1B, 0x3D, 0xED, 0xD5, 0x7F, 0xAA, 0x02, 0x9E, 0x2B, 0x12,
+    0xC5, 0x16, 0xCE, 0x02, 0xC7, 0x05, 0x1E, 0x0D, 0xA0, 0x00, 0x99, 0x61, 0x47, 0xED, 0xCB, 0x53,
+    0x91, 0xBC, 0xCB, 0x39, 0x30, 0x7A, 0x1E, 0x56, 0x5F, 0x88, 0xCC, 0xC6, 0x16, 0xE3, 0xFD, 0xC2,
+    0xFE, 0xE2, 0xE2, 0xF6, 0x15, 0x1E, 0x9F, 0xF8, 0x64, 0xCC, 0xBD, 0x99, 0x71, 0x37, 0x9A, 0xA6,
+    0x16, 0x8E, 0x45, 0xDE, 0xFC, 0x64, 0xF8, 0x0F, 0x7D, 0x65, 0x90, 0x33, 0x19, 0x97, 0x23, 0x26,
+    0xE7, 0xB8, 0xC1, 0x4A, 0x79, 0xB0, 0xB5, 0xCA, 0x64, 0x1E, 0xD5, 0x9C, 0xBC, 0x75, 0xC5, 0xF1,
+    0x84, 0x54, 0x18, 0x38, 0x9A, 0xCF, 0x52, 0x61, 0x7E, 0xE6, 0x5E, 0x3B, 0x33, 0x70, 0x76, 0xE7,
+    0xE0, 0xCE, 0xFB, 0x0D, 0x6A, 0x81, 0xBF, 0x15, 0x43, 0x74, 0x01, 0x4B, 0x4C, 0xFA, 0x26, 0x5C,
+    0x43, 0xF4, 0xE7, 0xAD, 0x38, 0x14, 0xA2, 0xFC, 0x09, 0x37, 0x8C, 0xDD, 0x4C, 0xA9, 0xF7, 0x6D,
+    0x2A, 0xE7, 0x88, 0x63, 0x77, 0x6F, 0x75, 0xE1, 0x53, 0x88, 0x88, 0x69, 0x2E, 0xF0, 0xCE, 0xC7,
+    0xD8, 0x4F, 0x86, 0xD4, 0x4F, 0x2B, 0x66, 0x0E, 0x18, 0x77, 0xC0, 0x50, 0xF1, 0xAE, 0x73, 0x47,
+    0x41, 0x5C, 0x31, 0xCA, 0x68, 0x67, 0x53, 0x37, 0xC8, 0x8F, 0x22, 0x18, 0x0E, 0xE5, 0x06, 0xAB,
+    0xD4, 0xA3, 0x3E, 0xD3, 0x87, 0x6D, 0x36, 0xBB, 0xBA, 0xFC, 0xAE, 0x9F, 0xF4, 0x19, 0x2A, 0x9C,
+    0x13, 0x17, 0xC7, 0xA0, 0x79, 0xC3, 0x26, 0xE2, 0xAF, 0x1F, 0x87, 0xAA, 0x43, 0x89, 0x33, 0x0C,
+    0x4C, 0x71, 0x72, 0x79, 0xD9, 0xDB, 0xE7, 0xCB, 0xFC, 0x1C, 0x9E, 0xDF, 0xD5, 0x55, 0x31, 0x6E,
+    0xD5, 0x40, 0x10, 0x9D, 0xB5, 0xC9, 0xB7, 0x88, 0x0B, 0x37, 0x49, 0x41, 0x22, 0xC5, 0x2D, 0x15,
+    0xBE, 0x41, 0x6C, 0x09, 0x89, 0x96, 0x14, 0x49, 0x93, 0x26, 0x75, 0xA0, 0xC8, 0x05, 0x90, 0xD6,
+    0x52, 0x0E, 0x90, 0x14, 0x1C, 0x80, 0x22, 0x0D, 0x9F, 0x82, 0x86, 0x22, 0x0D, 0xB2, 0x95, 0x5C,
+    0xC0, 0x02, 0x41, 0x5A, 0x4B, 0x20, 0x21, 0x2A, 0x8C, 0xD8, 0x48, 0x0E, 0xDA, 0xF5, 0xF0, 0x66,
+    0xFD, 0x49, 0x00, 0x21, 0x20, 0x0A, 0x42, 0x62, 0xA4, 0x5D, 0x79, 0x77, 0xFF, 0xCE, 0xBC, 0x79,
+    0xF3, 0x76, 0x3E, 0x4D, 0x6A, 0xA2, 0xAA, 0xA6, 0x90, 0x6B, 0xCA, 0xAB, 0x52, 0x59, 0x5D, 0x24,
+    0xB5, 0xA6, 0xE7, 0x74, 0x48, 0x5F, 0xED, 0xDE, 0x3E, 0xA5, 0xEC, 0x02, 0x66, 0x9B, 0x9A, 0xB4,
+    0xAB, 0xCA, 0xF4, 0x78, 0xA0, 0xD5, 0x84, 0x8B, 0xB5, 0x8C, 0x5B, 0xCA, 0xB9, 0x27, 0xCD, 0x96,
+    0x32, 0x8C, 0x88, 0xBB, 0x43, 0xC5, 0x27, 0x9D, 0xE2, 0xAD, 0x26, 0xB2, 0xFA, 0xB4, 0x6A, 0x99,
+    0x07, 0xDC, 0x6B, 0x68, 0x71, 0x8D, 0x48, 0x6D, 0x17, 0xF0, 0xC3, 0x45, 0xC6, 0xDC, 0x61, 0xD8,
+    0xC4, 0x11, 0xC7, 0x8E, 0xB2, 0x63, 0xA6, 0xB8, 0xE3, 0x46, 0x99, 0xDC, 0x12, 0xC5, 0x70, 0xA9,
+    0x98, 0x4B, 0xF8, 0x1B, 0x08, 0x57, 0x8D, 0xBF, 0x82, 0x08, 0x1D, 0x50, 0x0E, 0x4B, 0x08, 0xB1,
+    0x57, 0x93, 0x7E, 0x87, 0xED, 0x33, 0x5C, 0x73, 0xBA, 0x8B, 0x38, 0x61, 0xE6, 0xDB, 0x18, 0x85,
+    0xC6, 0x15, 0xDA, 0x7C, 0x08, 0xC4, 0xEB, 0x18, 0x55, 0x43, 0x24, 0x1E, 0xA9, 0xC2, 0xC8, 0xEA,
+    0x71, 0xE4, 0xD8, 0x9C, 0x14, 0xD8, 0x58, 0x3A, 0x80, 0x2B, 0x2E, 0x2A, 0xE6, 0xC8, 0x45, 0x36,
+    0x6B, 0xA3, 0x8E, 0xCB, 0x64, 0x97, 0x9B, 0x85, 0x18, 0xF9, 0x24, 0x70, 0x84, 0xB0, 0x00, 0xC3,
+    0x00, 0x63, 0x6F, 0x91, 0x3E, 0xB5, 0xA4, 0x4F, 0x8C, 0xE2, 0xD4, 0xED, 0xF4, 0x39, 0xE0, 0x55,
+    0x00, 0x36, 0x87, 0x28, 0x0A, 0xBE, 0x72, 0x40, 0x63, 0x09, 0x56, 0x12, 0x39, 0xA2, 0x04, 0x09,
+    0x00, 0x47, 0xB0, 0x8F, 0xD3, 0x92, 0x9E, 0x91, 0x25, 0xA6, 0xBC, 0x66, 0x0A, 0x1D, 0x13, 0xF2,
+    0x20, 0xC4, 0x45, 0xFC, 0xBC, 0x18, 0xB9, 0xFD, 0x87, 0xA4, 0xC0, 0x56, 0x68, 0x95, 0x5C, 0x68,
+    0x02, 0x9B, 0x95, 0xE1, 0x60, 0x51, 0xF3, 0x86, 0x22, 0x1C, 0x47, 0xED, 0x79, 0xAD, 0xD5, 0x54,
+    0xFC, 0x1A, 0x64, 0xDE, 0xE9, 0x46, 0x1F, 0x0D, 0xA4, 0x93, 0x9E, 0xFA, 0xDC, 0x29, 0x50, 0x55,
+    0x12, 0x73, 0x0B, 0x1C, 0x1D, 0x55, 0x18, 0x29, 0x1F, 0xB5, 0x11, 0x6F, 0xD5, 0x91, 0xD3, 0x45,
+    0xFA, 0x91, 0x5F, 0xF3, 0x2E, 0x73, 0x1F, 0x0B, 0xAE, 0x8D, 0x02, 0xAA, 0x80, 0xF5, 0x32, 0xF1,
+    0x1B, 0x3F, 0xEF, 0x7D, 0xDE, 0x1A, 0xEE, 0xBB, 0xBC, 0xCE, 0x4D, 0x64, 0x06, 0xD0, 0x95, 0xBE,
+    0x34, 0x21, 0xC0, 0x05, 0x25, 0x12, 0x3E, 0x00, 0x1D, 0x46, 0x82, 0x0B, 0x8B, 0x00, 0x25, 0xD4,
+    0x60, 0x9B, 0x2E, 0xB9, 0x3D, 0x61, 0x5F, 0x05, 0xE1, 0x09, 0x20, 0xDD, 0x79, 0x4A, 0x73, 0x9E,
+    0x6A, 0xC8, 0x9B, 0xBC, 0xC8, 0xE5, 0x5B, 0xA6, 0xB0, 0xA7, 0x99, 0x30, 0x28, 0x14, 0x99, 0xD0,
+    0xBC, 0xFC, 0x4E, 0xC4, 0x81, 0xE3, 0xD8, 0xCE, 0xEA, 0x5A, 0xD3, 0x0E, 0xF3, 0x31, 0x12, 0x00,
+    0xA1, 0xBD, 0xC2, 0x52, 0xAA, 0x97, 0xE2, 0x54, 0x77, 0xF4, 0x93, 0x65, 0x88, 0x65, 0xC2, 0x9B,
+    0x45, 0x8E, 0xF8, 0xA2, 0x91, 0x0A, 0xF0, 0x16, 0xE1, 0x72, 0x81, 0x3C, 0xD1, 0xF2, 0xCB, 0x08,
+    0xE0, 0x53, 0x44, 0x95, 0x25, 0x78, 0xBF, 0x29, 0x41, 0x29, 0x80, 0x76, 0x72, 0xAF, 0x20, 0x16,
+    0x5C, 0x8A, 0x75, 0x29, 0xB3, 0xE0, 0x52, 0x23, 0xE6, 0x8B, 0x7C, 0xBC, 0x7D, 0x4B, 0xAD, 0x4C,
+    0x43, 0xFE, 0x5E, 0x9F, 0x3D, 0x35, 0xEC, 0xA9, 0xED, 0x85, 0xDA, 0xBB, 0x4D, 0xE2, 0x94, 0x9D,
+    0x07, 0x59, 0x22, 0xC5, 0xAB, 0x51, 0x3B, 0x6E, 0x2F, 0x4B, 0x71, 0x11, 0x59, 0x14, 0x23, 0x22,
+    0x1C, 0x2D, 0xA9, 0x47, 0x35, 0x03, 0x6B, 0xD8, 0xD1, 0x8D, 0xB4, 0x0C, 0xED, 0x03, 0xCA, 0xBA,
+    0x96, 0x46, 0x3A, 0x54, 0xE5, 0xB9, 0xB3, 0xA8, 0x4B, 0xFB, 0x6B, 0xEE, 0x64, 0x99, 0x08, 0xEF,
+    0x6E, 0x1B, 0x41, 0x8C, 0xF4, 0x8D, 0x40, 0xCA, 0xB8, 0x71, 0x05, 0x35, 0xA9, 0x27, 0x3C, 0x95,
+    0xF7, 0x23, 0x4C, 0xE2, 0xCD, 0xB4, 0x57, 0x51, 0xD3, 0x65, 0xA4, 0x81, 0xA7, 0x5C, 0xE3, 0x44,
+    0xED, 0xB8, 0xF5, 0xDF, 0x49, 0x63, 0x66, 0x81, 0x8D, 0x3D, 0x0C, 0x23, 0xB2, 0x4C, 0x24, 0x2C,
+    0x51, 0x5F, 0x09, 0xB4, 0x38, 0xF8, 0xA1, 0xF6, 0x33, 0x43, 0x0D, 0x5A, 0xE4, 0xA4, 0x7D, 0x8B,
+    0xFD, 0x84, 0x1B, 0x29, 0xF7, 0x01, 0x02, 0x81, 0x43, 0x41, 0xC1, 0xB5, 0xFA, 0xAB, 0x0B, 0x61,
+    0x28, 0x95, 0xDE, 0xE8, 0x59, 0xAA, 0x86, 0x3B, 0xE8, 0x01, 0x21, 0x7B, 0x66, 0xA5, 0xD9, 0x20,
+    0x93, 0x6C, 0x44, 0x3D, 0x79, 0xEC, 0xD1, 0x99, 0xEB, 0xA2, 0xDD, 0x17, 0x9D, 0xDF, 0x07, 0xB5,
+    0xA7, 0xD2, 0xAD, 0x56, 0x22, 0xFF, 0xD4, 0xAE, 0x7D, 0x9F, 0xC9, 0x9C, 0xE4, 0xCF, 0xDD, 0xB2,
+    0xF4, 0xD5, 0x90, 0xFB, 0x48, 0x5A, 0x61, 0x09, 0xBE, 0xB2, 0x1E, 0x4C, 0x07, 0x7F, 0xFE, 0x69,
+    0xFC, 0xE7, 0xAB, 0xAA, 0x97, 0x90, 0xFC, 0x16, 0x2A, 0xFA, 0xC0, 0x6D, 0xC8, 0xA6, 0x72, 0xA4,
+    0xD6, 0xD5, 0x9A, 0xFC, 0x95, 0x4D, 0x1F, 0x5D, 0xD0, 0x8B, 0xB2, 0xC9, 0xB3, 0x9F, 0x4E, 0xFF,
+    0x43, 0x7A, 0xFF, 0x9A, 0x7D, 0x01, 0xCD, 0x95, 0x31, 0x6E, 0xD4, 0x40, 0x14, 0x86, 0x7F, 0xAF,
+    0x05, 0x16, 0x6C, 0x31, 0x34, 0x34, 0xA4, 0x18, 0x6E, 0xE0, 0x0B, 0x00, 0xB3, 0x15, 0xB4, 0x14,
+    0x09, 0x87, 0x48, 0x41, 0x2E, 0x10, 0xB1, 0x3E, 0x42, 0xAE, 0x41, 0x2A, 0x0E, 0x90, 0x68, 0x1C,
+    0x71, 0x00, 0x56, 0x20, 0xEA, 0x58, 0x28, 0xD4, 0xB1, 0x84, 0x11, 0x96, 0xE2, 0xF5, 0xCF, 0xFF,
+    0x66, 0xB3, 0x24, 0x20, 0x0A, 0x0A, 0x60, 0x63, 0xAD, 0xC6, 0xEF, 0x79, 0x66, 0x3D, 0xFF, 0xFB,
+    0xE6, 0xBD, 0x67, 0x3C, 0x38, 0x3C, 0x04, 0x26, 0x64, 0x07, 0x04, 0x12, 0xC0, 0xCE, 0xCE, 0x73,
+    0x5C, 0xBF, 0x6E, 0xC1, 0xE6, 0xDB, 0x2D, 0x56, 0x91, 0x39, 0xFB, 0x82, 0x6D, 0xC9, 0x2A, 0x27,
+    0xCA, 0x1E, 0xA1, 0x9D, 0xFC, 0xB9, 0xD9, 0x25, 0xF3, 0x63, 0xEC, 0x51, 0x92, 0x3C, 0x03, 0x79,
+    0xCE, 0x26, 0x67, 0x17, 0x97, 0xC8, 0xB6, 0xB3, 0xAB, 0x3D, 0xA7, 0xB3, 0xBC, 0xD2, 0x6D, 0x89,
+    0x41, 0xA3, 0x1B, 0x69, 0x4E, 0x64, 0xAB, 0x31, 0x63, 0x6F, 0x0B, 0xB2, 0x9F, 0xF5, 0x01, 0x05,
+    0xD9, 0x78, 0x72, 0xCE, 0x51, 0x71, 0x7C, 0x21, 0x2B, 0xCF, 0x7E, 0xC2, 0x1A, 0x6E, 0x80, 0xD7,
+    0x4B, 0x58, 0x67, 0x7F, 0xD5, 0x01, 0x17, 0xF0, 0x3D, 0x1C, 0x91, 0x73, 0x86, 0x38, 0x3E, 0x95,
+    0xB8, 0x5C, 0x21, 0x69, 0xD2, 0xE9, 0x36, 0x83, 0x05, 0x68, 0xAA, 0x6F, 0xBF, 0x5E, 0xF1, 0xCB,
+    0xA4, 0xB9, 0xC5, 0x1B, 0x01, 0x5E, 0x94, 0x89, 0x75, 0x63, 0x2B, 0x2D, 0x96, 0xAD, 0x1E, 0x9B,
+    0x62, 0xBD, 0x9D, 0x36, 0x9C, 0x77, 0x36, 0xFA, 0xF3, 0x5A, 0x63, 0xDE, 0xBE, 0x32, 0xE7, 0x49,
+    0xDE, 0x24, 0xE7, 0xB1, 0x39, 0x65, 0x9A, 0x41, 0xC2, 0xAF, 0xBF, 0xFE, 0x10, 0x2A, 0xD6, 0x19,
+    0xF9, 0x4D, 0xA1, 0x68, 0x83, 0xC0, 0x5E, 0x4E, 0x55, 0xFE, 0x03, 0xD6, 0x97, 0x8E, 0x93, 0x6E,
+    0x21, 0x95, 0x8C, 0xD0, 0x61, 0xCA, 0xB3, 0x3D, 0xA6, 0x6C, 0xD5, 0xA4, 0x42, 0xB3, 0xD4, 0x15,
+    0xD4, 0x84, 0x72, 0xF7, 0xC0, 0xC6, 0xFB, 0x48, 0xA9, 0x63, 0x61, 0x5C, 0xD8, 0xE3, 0x7D, 0xA7,
+    0x85, 0xD3, 0xFA, 0x48, 0xE6, 0xD1, 0x54, 0x66, 0xF1, 0xD5, 0xC2, 0x2E, 0x6D, 0x01, 0x5E, 0xCE,
+    0x36, 0x00, 0xFF, 0x21, 0x6C, 0xD7, 0x69, 0xE5, 0x6D, 0xCB, 0x65, 0x61, 0x1A, 0xE3, 0x89, 0x65,
+    0x8E, 0xEF, 0x82, 0xE8, 0x17, 0x83, 0x33, 0x81, 0xC7, 0x99, 0x4D, 0x4C, 0x70, 0xE7, 0x97, 0x7C,
+    0xBF, 0xD9, 0xF0, 0xEF, 0x65, 0x56, 0x92, 0x0B, 0x83, 0x4D, 0xB7, 0xD0, 0x39, 0x7C, 0xD2, 0xCB,
+    0x26, 0x43, 0x50, 0x45, 0x84, 0x67, 0xCA, 0xA3, 0xA2, 0x39, 0xD6, 0xD4, 0xA3, 0xA2, 0xDA, 0x48,
+    0xE6, 0x6F, 0x8E, 0x5D, 0xAB, 0x3E, 0xF5, 0x79, 0x6F, 0xBC, 0xCE, 0xAE, 0xB5, 0x9E, 0xB6, 0x62,
+    0xF7, 0x62, 0x48, 0x18, 0x42, 0x1A, 0x5D, 0x2A, 0x37, 0x70, 0xE5, 0x8C, 0x09, 0x2B, 0x97, 0x48,
+    0x88, 0xAA, 0xFF, 0x86, 0x6C, 0x3E, 0x58, 0xC5, 0xA7, 0x6D, 0x4B, 0x4B, 0xD7, 0x22, 0xA9, 0x8A,
+    0xA9, 0x47, 0x8F, 0x96, 0xC6, 0x21, 0x15, 0x50, 0xBC, 0x52, 0xB4, 0xBB, 0x36, 0x42, 0xBB, 0x36,
+    0xB8, 0x36, 0x4E, 0x2F, 0x1F, 0x85, 0xFA, 0xF2, 0x51, 0x59, 0xBB, 0xD4, 0x5B, 0x30, 0xA9, 0xB2,
+    0x19, 0x7E, 0x77, 0xA9, 0x9B, 0x56, 0x77, 0x0F, 0x44, 0xE8, 0xAD, 0x8E, 0x6B, 0x3A, 0xD8, 0x57,
+    0x40, 0x3F, 0x35, 0x5D, 0x67, 0xA3, 0xFA, 0x70, 0x03, 0x55, 0x4B, 0xEC, 0x20, 0xA5, 0xBE, 0x85,
+    0x5F, 0x2A, 0x00, 0x68, 0x5D, 0xCE, 0xCA, 0x29, 0x02, 0xA9, 0x8B, 0x5A, 0x37, 0x18, 0x47, 0x3F,
+    0xE8, 0x35, 0x98, 0xD7, 0xD6, 0xB2, 0x23, 0x17, 0xA5, 0x8A, 0x2C, 0x36, 0xE1, 0xB4, 0x37, 0xD2,
+    0x7E, 0x70, 0x1F, 0x98, 0x8B, 0x7F, 0xCE, 0xA2, 0xE5, 0x89, 0x05, 0x15, 0xDF, 0x0F, 0xBE, 0xB7,
+    0x48, 0x7D, 0x3F, 0xE6, 0x0C, 0xB5, 0xCD, 0x05, 0xF0, 0x9D, 0x75, 0xC6, 0x78, 0x5E, 0xFB, 0x0B,
+    0x2B, 0x4F, 0x6F, 0x94, 0xEC, 0xD8, 0xC4, 0x0A, 0x5C, 0xB1, 0x90, 0x10, 0x2B, 0x63, 0xF8, 0x11,
+    0xA6, 0x10, 0xE9, 0x13, 0x61, 0xFD, 0x3E, 0x7D, 0x38, 0x7C, 0x87, 0x9B, 0x76, 0x7D, 0x07, 0xCD,
+    0x55, 0x31, 0x8F, 0x1D, 0x35, 0x10, 0x9E, 0xDD, 0x7D, 0x64, 0x25, 0x56, 0xC8, 0x57, 0x40, 0x73,
+    0x52, 0xB2, 0x14, 0xA9, 0x50, 0x22, 0xFF, 0x81, 0x1C, 0xDE, 0x4B, 0x93, 0x82, 0x82, 0x26, 0x57,
+    0x51, 0x84, 0x82, 0xFE, 0xF8, 0x01, 0x79, 0xE7, 0x45, 0x14, 0xB4, 0xFC, 0x84, 0x6B, 0xA1, 0xA1,
+    0xA5, 0x48, 0xF0, 0x1E, 0xF7, 0x03, 0xD8, 0xE8, 0x8A, 0x14, 0x29, 0xF2, 0x84, 0xE8, 0x52, 0xC4,
+    0x97, 0x2C, 0x92, 0x51, 0xEC, 0x1D, 0xE6, 0xF3, 0xDE, 0x41, 0x4E, 0x07, 0x42, 0x14, 0x88, 0x58,
+    0xCF, 0xDE, 0xDD, 0x19, 0x7B, 0xE6, 0x9B, 0x6F, 0xC6, 0xF3, 0x88, 0x68, 0xBB, 0x23, 0x8C, 0x2A,
+    0xE5, 0x07, 0xB1, 0xCF, 0x8F, 0x96, 0x87, 0x2C, 0xF5, 0x73, 0xFE, 0x4C, 0x55, 0x16, 0xB7, 0x7D,
+    0x4B, 0x7F, 0x37, 0x0C, 0x7B, 0xB5, 0x51, 0x7C, 0xC2, 0x4C, 0x5C, 0x70, 0x54, 0xDC, 0x69, 0x5F,
+    0x32, 0x19, 0x5F, 0xC9, 0xDB, 0x58, 0xC9, 0x5B, 0xA8, 0x22, 0xB5, 0xA1, 0xE6, 0xC1, 0xF4, 0xC4,
+    0x03, 0xC7, 0x7A, 0xA2, 0x46, 0xF6, 0x8D, 0x8E, 0xC8, 0x3E, 0xFA, 0x75, 0x56, 0x1B, 0xAA, 0x66,
+    0xAD, 0x4E, 0x23, 0x91, 0x7E, 0xE9, 0x79, 0x7F, 0xA0, 0x82, 0x0F, 0x9A, 0x57, 0x13, 0x91, 0xEC,
+    0x31, 0x2C, 0x2E, 0x5C, 0xAC, 0x78, 0x23, 0xA0, 0xB8, 0xD7, 0x40, 0x6B, 0xA6, 0x02, 0x28, 0x0B,
+    0x26, 0x15, 0x5E, 0x03, 0x72, 0x65, 0x93, 0xA1, 0x66, 0x91, 0xCD, 0xF0, 0x67, 0xD7, 0xCB, 0xA9,
+    0xD0, 0x8E, 0x62, 0x6A, 0x53, 0x8B, 0xBA, 0xEC, 0x8A, 0xEE, 0x02, 0x78, 0xCB, 0xA9, 0xE1, 0xE4,
+    0x00, 0x3B, 0x19, 0x9E, 0x6A, 0xFC, 0x06, 0x72, 0x7D, 0xC1, 0x23, 0x31, 0x48, 0x29, 0xC5, 0x90,
+    0x9D, 0x2A, 0x60, 0x8B, 0x0D, 0x20, 0x25, 0x81, 0x4B, 0x35, 0xEB, 0x01, 0x78, 0x6C, 0x0F, 0xE6,
+    0x00, 0x91, 0x5C, 0xE6, 0xD1, 0x44, 0xAC, 0x3A, 0xFC, 0xE3, 0x5A, 0x32, 0x22, 0x52, 0x0C, 0xDA,
+    0x97, 0x95, 0xB6, 0xA1, 0x54, 0x30, 0x50, 0x40, 0x47, 0xC6, 0x09, 0xD6, 0xE6, 0x67, 0x11, 0x14,
+    0xB1, 0x11, 0x81, 0xA1, 0x9D, 0xCB, 0xEC, 0x5B, 0x0E, 0x1A, 0xDC, 0xDF, 0x46, 0x08, 0x7D, 0x3D,
+    0x0B, 0xDB, 0x64, 0x86, 0x92, 0x87, 0x26, 0xC0, 0x96, 0x40, 0x73, 0x9B, 0xD6, 0x0B, 0xE0, 0x52,
+    0xF0, 0x19, 0x6F, 0x40, 0xEE, 0x1D, 0xC4, 0x11, 0x32, 0xB1, 0x4F, 0x33, 0xAD, 0xF0, 0xA9, 0xB9,
+    0x3F, 0xAF, 0x82, 0x26, 0x07, 0x64, 0x47, 0xD4, 0x41, 0x8E, 0x87, 0x41, 0x9A, 0x86, 0x6A, 0x3F,
+    0x42, 0x8D, 0x6F, 0x2B, 0x0C, 0xC9, 0xD1, 0x0C, 0xFC, 0x30, 0x43, 0x29, 0xBA, 0xB7, 0x10, 0xC0,
+    0x64, 0x46, 0x64, 0xC1, 0x7A, 0xAC, 0x06, 0xE1, 0x79, 0x3D, 0xD2, 0x5F, 0x21, 0x7F, 0x73, 0xA8,
+    0xA7, 0xF7, 0x21, 0x0F, 0xE7, 0xFC, 0xBB, 0x88, 0x5D, 0xA2, 0xA8, 0xE6, 0x0E, 0x71, 0xBD, 0x0E,
+    0x5B, 0x4E, 0xF0, 0x06, 0xCB, 0xD4, 0xCA, 0x12, 0xDA, 0xDF, 0xF6, 0xD8, 0xB7, 0x83, 0x64, 0xAC,
+    0x1D, 0x2A, 0x1E, 0x54, 0x97, 0xC9, 0x6B, 0xD3, 0x39, 0x20, 0x58, 0x29, 0x41, 0x55, 0x0D, 0x7E,
+    0x15, 0x94, 0xB9, 0x86, 0x6D, 0x58, 0x94, 0x9F, 0xC9, 0x21, 0x8A, 0x0D, 0xF7, 0x45, 0x12, 0x65,
+    0x19, 0x4D, 0xDA, 0xFB, 0x24, 0x1A, 0xB1, 0x9C, 0x97, 0x00, 0x1F, 0xD3, 0x99, 0xE7, 0x77, 0xE1,
+    0x5D, 0x8C, 0xD4, 0x7E, 0xC9, 0x0B, 0xF8, 0x21, 0xCC, 0x03, 0x99, 0x6F, 0x5F, 0xBA, 0x95, 0x0B,
+    0xC0, 0x5A, 0xE6, 0x17, 0x51, 0xEA, 0x61, 0x2D, 0x77, 0x46, 0x11, 0x90, 0x20, 0x7A, 0xC0, 0x72,
+    0x32, 0x91, 0x25, 0x33, 0x95, 0x9D, 0x09, 0xA5, 0x17, 0xBC, 0x51, 0x47, 0x72, 0x08, 0xEE, 0x18,
+    0x51, 0xDA, 0x3F, 0x7D, 0xE7, 0xE1, 0x32, 0x79, 0x7D, 0xBE, 0x88, 0x67, 0x6F, 0x34, 0x5F, 0xCA,
+    0xEB, 0xFF, 0x46, 0x50, 0x79, 0x08, 0x64, 0xB8, 0x3D, 0x03, 0x4A, 0x1D, 0xA5, 0x28, 0xD2, 0xAD,
+    0x8B, 0xE8, 0x2A, 0xD9, 0xBF, 0x2B, 0xD3, 0x5B, 0x1C, 0x1E, 0x74, 0xAC, 0xC7, 0x36, 0x92, 0x57,
+    0xE2, 0x52, 0xCD, 0x8B, 0x7F, 0x00, 0xAC, 0x19, 0x5B, 0xBB, 0xEB, 0x68, 0x39, 0x40, 0xFD, 0xA3,
+    0x5C, 0x28, 0x7F, 0xE6, 0x74, 0x06, 0xA7, 0x4B, 0x4D, 0x7C, 0x4A, 0x37, 0x89, 0xF2, 0x2D, 0x63,
+    0x64, 0xC4, 0x3C, 0xF1, 0x67, 0x1D, 0xB4, 0xCA, 0x1B, 0x1E, 0xBE, 0x19, 0x85, 0x23, 0xE3, 0x7B,
+    0x92, 0xB6, 0x40, 0x49, 0xEE, 0xA2, 0x04, 0xC9, 0x0E, 0x28, 0x41, 0x54, 0x87, 0xD6, 0xFE, 0x9F,
+    0x16, 0xCE, 0xFE, 0x21, 0xEE, 0x5B, 0x2F, 0xB4, 0x4F, 0x25, 0x3F, 0x4F, 0xD2, 0xFF, 0x2D, 0xB9,
+    0xB1, 0xEE, 0x72, 0x7E, 0xE2, 0x92, 0x30, 0xFA, 0x23, 0x61, 0xFF, 0x5E, 0xA0, 0xF9, 0x6B, 0xE9,
+    0x24, 0xB3, 0xC4, 0x23, 0xC1, 0xAC, 0x68, 0x6A, 0xBC, 0xF6, 0xC6, 0x6B, 0x21, 0xF5, 0x1D, 0x09,
+    0x90, 0xD6, 0xEA, 0x94, 0xCD, 0x93, 0x29, 0x55, 0xDD, 0xD2, 0x60, 0xB9, 0x17, 0x4E, 0xEB, 0x57,
+    0x5E, 0x9D, 0x44, 0xDD, 0x27, 0x43, 0xB7, 0xD0, 0xEE, 0xC6, 0xEB, 0x26, 0xEC, 0x48, 0x3B, 0x3A,
+    0xB0, 0xF1, 0x56, 0xAE, 0x99, 0x0F, 0xBE, 0xFD, 0x46, 0x6C, 0x3A, 0x4E, 0xEF, 0xED, 0xDD, 0x5D,
+    0xD1, 0x6A, 0x87, 0xAE, 0xDA, 0x7E, 0x6D, 0x38, 0xB6, 0x68, 0x4A, 0xDD, 0xF6, 0x9D, 0xE4, 0x9E,
+    0xCD, 0x66, 0x80, 0x49, 0xBB, 0x9B, 0x10, 0xF2, 0x31, 0xBB, 0xDB, 0x69, 0x45, 0x5B, 0x57, 0x92,
+    0x34, 0x53, 0x7B, 0xEF, 0xF1, 0xF8, 0xC3, 0x0D, 0x35, 0x96, 0xA1, 0x92, 0x76, 0x4C, 0x45, 0xFE,
+    0x5B, 0xBA, 0x2B, 0xAC, 0xE9, 0xEF, 0x8E, 0xC7, 0x07, 0xEB, 0xFA, 0xF1, 0x78, 0xDF, 0xDC, 0x3B,
+    0x12, 0x53, 0xBF, 0x08, 0xE0, 0xEE, 0xC3, 0xFA, 0x51, 0x34, 0x3F, 0x9D, 0xCE, 0xF6, 0xA3, 0x17,
+    0xC1, 0x7C, 0x7C, 0x14, 0x6E, 0x56, 0xC3, 0xC2, 0xDC, 0x0D, 0x7A, 0xE0, 0x8A, 0x68, 0xBE, 0xF4,
+    0xED, 0xF3, 0xB1, 0x61, 0x69, 0xE9, 0xA8, 0xA7, 0x15, 0xED, 0x4E, 0x5A, 0xF9, 0xA4, 0x4F, 0xA2,
+    0xF9, 0x6A, 0xB2, 0xCD, 0xE6, 0xA1, 0x1A, 0xFC, 0x35, 0x34, 0x5F, 0xD7, 0x2B, 0x0E, 0x82, 0x71,
+    0x5D, 0xA6, 0xCF, 0xE9, 0xFE, 0x16, 0xEA, 0x7E, 0xDD, 0x1E, 0x07, 0x2B, 0x65, 0xDB, 0x04, 0x7B,
+    0x74, 0x78, 0x31, 0xCB, 0xBF, 0x03, 0xD5, 0x54, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xDB, 0x77,
+    0x67, 0x24, 0x17, 0xFB, 0x0A, 0x4E, 0x42, 0x17, 0x21, 0x53, 0x46, 0x27, 0x74, 0xDB, 0xA6, 0x81,
+    0x35, 0x49, 0x49, 0x41, 0x8A, 0x0B, 0x45, 0x28, 0xA8, 0x11, 0x12, 0xE1, 0x0F, 0xE0, 0xDD, 0x3A,
+    0x49, 0x49, 0x41, 0x0A, 0xF2, 0x1F, 0xA4, 0x40, 0x50, 0xD0, 0xD2, 0x1C, 0x76, 0x92, 0x22, 0xAD,
+    0x4F, 0x28, 0x75, 0x5C, 0x24, 0x42, 0x3A, 0x9A, 0x45, 0x32, 0x92, 0x81, 0xDD, 0x1D, 0xBE, 0x59,
+    0xBF, 0xBB, 0x04, 0x8A, 0x48, 0xA1, 0x41, 0x58, 0xEF, 0xCD, 0xD8, 0xBB, 0x3B, 0xBF, 0xBE, 0x6F,
+    0x66, 0xAB, 0xB1, 0x1B, 0xF8, 0x66, 0x2C, 0x27, 0xDD, 0x07, 0x35, 0x1E, 0x90, 0xBE, 0xC9, 0x5F,
+    0x7A, 0x3D, 0xD8, 0x26, 0x66, 0x3E, 0xF7, 0xF9, 0xB8, 0x52, 0x8F, 0x7E, 0xF5, 0x47, 0xFA, 0xFD,
+    0x07, 0xC3, 0x5B, 0x44, 0xF9, 0xAC, 0x4F, 0x82, 0x7E, 0x34, 0x1D, 0x57, 0x44, 0xB4, 0x5D, 0xF8,
+    0xEE, 0x97, 0x68, 0x4F, 0xEE, 0x99, 0x26, 0xF0, 0x43, 0xC6, 0xAF, 0xBB, 0x15, 0x77, 0xE9, 0x30,
+    0x6B, 0xEA, 0xF9, 0xE8, 0xF8, 0x87, 0x77, 0xE7, 0x83, 0xE3, 0xB5, 0x99, 0x77, 0xEE, 0x64, 0x8D,
+    0xE9, 0xF9, 0x32, 0x22, 0x98, 0x07, 0x7E, 0xA7, 0xD9, 0x6E, 0xF4, 0xA4, 0xC5, 0xB3, 0x2F, 0x9D,
+    0x1E, 0xF6, 0xE0, 0xA7, 0x1A, 0x75, 0x6B, 0xA9, 0xA3, 0xEE, 0xB1, 0x89, 0xD5, 0x8C, 0x05, 0xF5,
+    0xD3, 0x14, 0xCC, 0x07, 0x10, 0xFB, 0x44, 0x9F, 0x51, 0xC6, 0x7D, 0xC1, 0x4E, 0xFD, 0xE9, 0xF5,
+    0xFD, 0x68, 0xE9, 0xE8, 0x22, 0xBD, 0xB1, 0x45, 0x5B, 0xEF, 0xD0, 0x9B, 0xB6, 0x5D, 0x1B, 0xF6,
+    0x9A, 0x5D, 0x1E, 0x1B, 0x18, 0xD5, 0xE3, 0x25, 0xE3, 0xD7, 0x96, 0xC3, 0xDA, 0xF8, 0xB7, 0x2B,
+    0x87, 0x95, 0xDD, 0x6B, 0x87, 0x96, 0x63, 0xC7, 0x61, 0xFF, 0xDB, 0x6F, 0xB2, 0xAE, 0x55, 0x3C,
+    0xE3, 0xFC, 0x3A, 0x0F, 0x9F, 0xD3, 0x17, 0x2B, 0x5A, 0x11, 0x35, 0x54, 0x8C, 0x54, 0x4E, 0xA4,
+    0x26, 0xD2, 0x23, 0x99, 0x9E, 0x2C, 0xD1, 0x45, 0xDA, 0xA2, 0x95, 0xBD, 0x15, 0x97, 0x7A, 0xEC,
+    0x7B, 0x01, 0x7E, 0xF6, 0x9B, 0x50, 0x4C, 0xEA, 0x37, 0x0D, 0x54, 0xF0, 0xF5, 0x1A, 0xFE, 0x64,
+    0x24, 0xA2, 0x1D, 0xE5, 0x4D, 0x4E, 0xD4, 0x8C, 0x6F, 0x84, 0xC0, 0x6B, 0x46, 0x2F, 0x3C, 0x1D,
+    0x33, 0xCF, 0x2C, 0x42, 0xDE, 0x7C, 0xC1, 0x77, 0xBF, 0x83, 0x68, 0x72, 0x11, 0xD9, 0x0C, 0x41,
+    0x4E, 0x04, 0x6D, 0x44, 0xBB, 0x0B, 0xC1, 0xDC, 0x9C, 0x0B, 0x59, 0x3B, 0xDF, 0xDD, 0x88, 0x64,
+    0x76, 0xE6, 0xE5, 0xEE, 0x47, 0xBE, 0x16, 0xCF, 0xE7, 0x81, 0x26, 0x7A, 0x9D, 0xAE, 0x12, 0xF1,
+    0x95, 0x08, 0xDC, 0x6E, 0xF3, 0x22, 0x88, 0xF3, 0x40, 0xFF, 0x78, 0xFE, 0x83, 0xD4, 0xCC, 0x92,
+    0xA0, 0x48, 0x1E, 0x8A, 0xA4, 0x48, 0xFD, 0x71, 0x23, 0x7C, 0xEA, 0x01, 0xBE, 0x75, 0xE0, 0x2C,
+    0x82, 0x6B, 0xDD, 0xE7, 0x53, 0xC9, 0xF4, 0x23, 0xA1, 0x8D, 0xBC, 0xD4, 0x42, 0x56, 0xC8, 0x44,
+    0x25, 0xF7, 0x0F, 0xA1, 0x4A, 0x58, 0xB5, 0x82, 0x38, 0x7C, 0x60, 0x0B, 0xAA, 0xC7, 0xD6, 0x50,
+    0x43, 0xC1, 0x4A, 0x21, 0x01, 0x58, 0xA9, 0x98, 0xAC, 0xB4, 0x97, 0xE6, 0xA1, 0xCE, 0xC9, 0x96,
+    0xBC, 0x61, 0x0B, 0x6F, 0x70, 0x41, 0xF5, 0x0C, 0x04, 0x22, 0x75, 0x63, 0x8E, 0x94, 0x0A, 0x4E,
+    0x90, 0x28, 0x9F, 0x94, 0xF8, 0x45, 0x53, 0xF2, 0x12, 0xD4, 0x2D, 0x31, 0x29, 0xB1, 0x9C, 0x76,
+    0xF6, 0xEE, 0xA5, 0x63, 0x77, 0x64, 0xA5, 0xC7, 0x48, 0x48, 0xF5, 0xD2, 0x05, 0xA5, 0x6C, 0xEB,
+    0xA7, 0x58, 0x5E, 0xBD, 0x80, 0x73, 0x2E, 0x65, 0x3E, 0x11, 0x71, 0x63, 0xC1, 0xF9, 0xF4, 0x7B,
+    0xA7, 0x02, 0x0A, 0x36, 0x13, 0x5A, 0x9E, 0x87, 0x04, 0x78, 0x39, 0x60, 0x69, 0x8B, 0xB0, 0xB4,
+    0x84, 0x4F, 0x88, 0x2A, 0xE1, 0xEC, 0xE5, 0x4B, 0xAD, 0x20, 0x30, 0x21, 0x57, 0xA4, 0x69, 0x12,
+    0x2E, 0xB4, 0xFD, 0x75, 0x22, 0x77, 0x46, 0xEA, 0x40, 0x48, 0xA2, 0xCF, 0x39, 0x8F, 0xA5, 0x20,
+    0x4B, 0xB6, 0x85, 0x50, 0x23, 0xFA, 0xB6, 0x98, 0xC4, 0xCB, 0x9C, 0x2A, 0x2E, 0x39, 0x15, 0x2A,
+    0x40, 0x76, 0xE2, 0x48, 0x23, 0xCD, 0xA5, 0xFC, 0x1C, 0x4B, 0x88, 0x20, 0xF1, 0x04, 0x51, 0x55,
+    0x08, 0xC8, 0xAE, 0xF3, 0x54, 0x04, 0xC5, 0x03, 0xEC, 0xA4, 0xAC, 0x5E, 0x25, 0x53, 0x30, 0x81,
+    0x04, 0xAF, 0x4B, 0xF4, 0xEC, 0x93, 0x46, 0xF8, 0x69, 0xE0, 0xC8, 0x89, 0x33, 0x64, 0xCD, 0x55,
+    0x20, 0xFD, 0x90, 0xA9, 0x72, 0x3C, 0x64, 0x93, 0xF1, 0x82, 0xEF, 0x28, 0x41, 0x5B, 0x84, 0x8B,
+    0x02, 0xD2, 0x94, 0x4C, 0xE0, 0x06, 0x80, 0x77, 0x71, 0x0F, 0x59, 0x7D, 0x05, 0xA7, 0x3F, 0x63,
+    0xF9, 0x77, 0x98, 0x05, 0xEB, 0x4A, 0x96, 0x40, 0x57, 0xA4, 0xFF, 0x30, 0xD5, 0x4B, 0x28, 0x50,
+    0xC8, 0x1C, 0x50, 0x2D, 0xA0, 0x78, 0xD5, 0x5F, 0x2D, 0x86, 0x62, 0xBE, 0x8D, 0x8B, 0x2C, 0x54,
+    0xB3, 0x71, 0x18, 0x78, 0x85, 0x19, 0xEF, 0x9A, 0xE7, 0xEC, 0x21, 0xFD, 0xDB, 0xC8, 0x4D, 0x72,
+    0x14, 0x04, 0x90, 0xF3, 0xBF, 0x51, 0xE8, 0x9F, 0xCB, 0x2C, 0xB7, 0x4F, 0x1A, 0x9D, 0x09, 0x75,
+    0x0C, 0x06, 0x1E, 0x85, 0x52, 0x61, 0x54, 0xA8, 0x00, 0x9F, 0xAF, 0xFE, 0x09, 0x18, 0x8D, 0x4B,
+    0x8D, 0x5D, 0xC5, 0xB4, 0x23, 0x04, 0x81, 0x1E, 0x69, 0x54, 0xE9, 0xC8, 0x03, 0xA9, 0x24, 0x4D,
+    0x1D, 0x2D, 0xA3, 0xC2, 0x9B, 0xEF, 0x74, 0x1B, 0xF0, 0x87, 0x89, 0x5E, 0x8A, 0xF4, 0x52, 0x9D,
+    0x85, 0xE7, 0xFA, 0x14, 0x4D, 0x9F, 0x79, 0xA1, 0xBD, 0xA1, 0x3C, 0x69, 0x47, 0x05, 0xF4, 0x29,
+    0xFA, 0xAD, 0x98, 0x71, 0x0E, 0x13, 0x87, 0x0B, 0x15, 0x3D, 0x11, 0xA9, 0x12, 0x5D, 0x02, 0x37,
+    0xB7, 0xE8, 0x7A, 0x84, 0xAE, 0xC2, 0x25, 0xDC, 0xB3, 0xDC, 0xD7, 0xDE, 0xC0, 0x29, 0x9F, 0x74,
+    0xB3, 0x65, 0xBA, 0x20, 0x7E, 0x6C, 0x48, 0x19, 0xB6, 0x32, 0x16, 0xCC, 0x4F, 0x69, 0xA7, 0x39,
+    0xBB, 0xA7, 0x42, 0x25, 0xA3, 0x6E, 0x12, 0xF7, 0x4E, 0x7A, 0xBD, 0xE9, 0xD0, 0x2D, 0x0B, 0xBC,
+    0x9B, 0xC1, 0x38, 0x1B, 0x89, 0xB3, 0xF9, 0x38, 0x1F, 0x96, 0xBF, 0x1F, 0x78, 0x76, 0xED, 0xE3,
+    0x78, 0xB8, 0x41, 0x04, 0x18, 0xA8, 0xA4, 0xD9, 0x2D, 0x57, 0x11, 0xC0, 0x11, 0xB6, 0x02, 0xC6,
+    0x78, 0xF1, 0xA0, 0xE7, 0xC5, 0x43, 0xC9, 0x1B, 0x0F, 0xDC, 0x2F, 0x21, 0xAC, 0x5B, 0x0E, 0x98,
+    0x29, 0xE5, 0x70, 0x62, 0x71, 0xD1, 0xCD, 0x32, 0x69, 0x41, 0x2F, 0x0D, 0x1A, 0x84, 0x61, 0x96,
+    0x2A, 0xFE, 0x07, 0xCF, 0x5F, 0xAD, 0x55, 0x3D, 0x8F, 0xDD, 0x54, 0x14, 0x3C, 0xF6, 0x15, 0xFB,
+    0x84, 0x5C, 0xDC, 0x26, 0xD4, 0xA6, 0xA5, 0xF2, 0x4F, 0xB0, 0x51, 0x8A, 0xB4, 0x29, 0x52, 0x41,
+    0x41, 0x4B, 0xB7, 0x3F, 0xC1, 0x26, 0x0D, 0xED, 0x16, 0x44, 0x29, 0xD2, 0xA4, 0xA1, 0x61, 0x8B,
+    0xFD, 0x03, 0x48, 0xB6, 0xE0, 0x07, 0x60, 0x2A, 0x0A, 0x1A, 0x17, 0x5B, 0x41, 0x81, 0x0B, 0xA3,
+    0x38, 0x1B, 0xDB, 0x87, 0x99, 0xF1, 0xDB, 0x97, 0x5D, 0x69, 0x49, 0x95, 0x2B, 0xBD, 0xE3, 0x37,
+    0xF6, 0xF5, 0xF9, 0x98, 0x33, 0xE7, 0xBA, 0x74, 0xAC, 0xC9, 0x02, 0x2F, 0x5E, 0x59, 0xC9, 0xCB,
+    0x68, 0x61, 0x7B, 0xE5, 0x5F, 0xB9, 0x59, 0xD9, 0xD5, 0x63, 0x06, 0x38, 0x1F, 0xDC, 0x5A, 0xB3,
+    0xA2, 0x02, 0x1C, 0xCC, 0x9E, 0x02, 0x3E, 0x32, 0xAC, 0x7A, 0xA4, 0xB5, 0x83, 0x27, 0xCF, 0x04,
+    0xDF, 0xF9, 0x26, 0xE8, 0xBE, 0x10, 0xE2, 0x3A, 0x10, 0x5E, 0x14, 0xBE, 0x6F, 0xAE, 0x27, 0x42,
+    0x44, 0xAB, 0x04, 0xCB, 0x59, 0x30, 0xF5, 0x46, 0xB0, 0x78, 0x0F, 0xE1, 0x22, 0x71, 0xEF, 0x52,
+    0xF7, 0xB9, 0x86, 0xCF, 0xC2, 0xFD, 0x89, 0x7B, 0x0F, 0x27, 0x49, 0xC3, 0x40, 0xB1, 0x57, 0x38,
+    0x38, 0x87, 0x2F, 0xFE, 0x8F, 0x74, 0x61, 0xF9, 0x35, 0x6F, 0x7F, 0x6A, 0x77, 0xD7, 0x27, 0xD6,
+    0xFA, 0x6A, 0x75, 0x87, 0x94, 0x12, 0x1F, 0x5A, 0xBF, 0x0E, 0x3E, 0x20, 0x7E, 0x26, 0x1B, 0xDF,
+    0x5E, 0xC0, 0x16, 0x3D, 0x33, 0xAA, 0x1B, 0x5A, 0xA7, 0xC7, 0x2F, 0x57, 0xDA, 0x97, 0x0B, 0xAD,
+    0xCF, 0xB2, 0xFA, 0x7F, 0xB9, 0xD1, 0x3E, 0x46, 0xF6, 0xD8, 0xE3, 0x9D, 0xF6, 0x0F, 0x7A, 0x97,
+    0x0C, 0x56, 0xE5, 0x42, 0x9B, 0xAB, 0xBE, 0xCC, 0x9B, 0xDC, 0xE7, 0xC0, 0x88, 0x88, 0x3B, 0xD3,
+    0x41, 0x4D, 0x6E, 0xEC, 0xEC, 0xC2, 0xEC, 0x73, 0x65, 0x46, 0x26, 0xB1, 0xE0, 0xE7, 0x54, 0x80,
+    0x95, 0xDA, 0x63, 0xE7, 0xE3, 0x31, 0xF7, 0xFB, 0x2B, 0x03, 0x07, 0xEA, 0xD0, 0x02, 0x7E, 0xDE,
+    0xA1, 0x5F, 0x05, 0x43, 0x54, 0x96, 0x2F, 0x56, 0x4E, 0x96, 0x78, 0x47, 0x50, 0x0A, 0x44, 0x81,
+    0xE0, 0x02, 0x2E, 0x50, 0xFE, 0x43, 0x10, 0xFF, 0x25, 0x78, 0xBC, 0xEA, 0x1D, 0x56, 0x11, 0xBC,
+    0xED, 0x09, 0x7C, 0x92, 0x83, 0x55, 0xDE, 0xBC, 0x12, 0xE8, 0xEF, 0xBB, 0xCE, 0x51, 0x8A, 0x37,
+    0x99, 0xAF, 0xA0, 0x74, 0x57, 0x4C, 0x87, 0x1E, 0x5B, 0x52, 0x25, 0x15, 0xCB, 0x61, 0x41, 0x71,
+    0x8C, 0xC8, 0x3D, 0x9B, 0x8B, 0x51, 0xB4, 0xB1, 0x37, 0xED, 0x66, 0x0F, 0xAC, 0x9A, 0x45, 0x6C,
+    0x60, 0x27, 0xF3, 0xAD, 0xF6, 0xE9, 0xCC, 0xA1, 0xB1, 0x06, 0x7D, 0x4A, 0xC1, 0x07, 0x42, 0x79,
+    0x9F, 0xA0, 0x15, 0xED, 0x10, 0xD0, 0x8A, 0x72, 0x0C, 0xA0, 0xBF, 0x98, 0x33, 0xA8, 0x27, 0x2E,
+    0x11, 0x51, 0xB2, 0xB5, 0x00, 0x6B, 0x61, 0x2B, 0x41, 0x5A, 0xEA, 0xAD, 0x68, 0x54, 0x94, 0x7A,
+    0x11, 0x8B, 0x13, 0x6D, 0x2E, 0x12, 0x73, 0xA6, 0xD0, 0x97, 0xD8, 0x9E, 0xBE, 0x75, 0xE9, 0x65,
+    0x95, 0x9D, 0x29, 0x26, 0x57, 0x0B, 0xBE, 0xA0, 0x41, 0x49, 0x51, 0x25, 0x3D, 0xD9, 0xA9, 0x85,
+    0x74, 0xE3, 0x76, 0x5B, 0x38, 0xC4, 0x79, 0xE2, 0x02, 0x0A, 0x8D, 0xEB, 0xC7, 0x7B, 0xB0, 0x55,
+    0x67, 0xDE, 0xE5, 0x8A, 0x7C, 0xE5, 0xEF, 0xD7, 0xC2, 0xB2, 0x25, 0x0C, 0x26, 0x6A, 0xE9, 0xCE,
+    0x61, 0x5D, 0xE9, 0x96, 0x14, 0x13, 0x76, 0x8D, 0xFC, 0x7C, 0x97, 0x54, 0x0D, 0xA5, 0x15, 0xC3,
+    0x3E, 0x94, 0xBB, 0xBC, 0x76, 0x2E, 0x24, 0xAF, 0xE0, 0x3B, 0x3D, 0x6A, 0x4B, 0xF6, 0x46, 0x1B,
+    0x36, 0x85, 0xC9, 0x7F, 0xE1, 0x86, 0xB0, 0xE4, 0x9A, 0xDB, 0x8A, 0x1B, 0xB2, 0x31, 0x63, 0xD0,
+    0x4D, 0x43, 0x5E, 0xDC, 0x5C, 0x4A, 0xF5, 0x4A, 0x8C, 0x73, 0xDD, 0x59, 0xBC, 0xF9, 0xE9, 0x8A,
+    0x55, 0x81, 0x3A, 0x8C, 0x6E, 0xAF, 0xB9, 0x66, 0xD6, 0x73, 0x0A, 0x6E, 0xA1, 0xFD, 0xD6, 0x07,
+    0xE8, 0xF5, 0x37, 0xF4, 0x05, 0x4D, 0x6E, 0x79, 0xCA, 0xE8, 0xA8, 0xE1, 0xBF, 0x31, 0xF8, 0x5F,
+    0x57, 0x23, 0xA7, 0x84, 0xE6, 0x40, 0x13, 0x38, 0x8E, 0x69, 0xA3, 0x93, 0x01, 0x4F, 0x15, 0x6B,
+    0x53, 0xC0, 0x3E, 0xF8, 0xDF, 0x3E, 0x69, 0xBC, 0x38, 0xB1, 0x2B, 0x5F, 0x3B, 0x99, 0xC8, 0x7B,
+    0x39, 0xCC, 0x77, 0xED, 0x44, 0x12, 0x07, 0xBA, 0x47, 0xEF, 0xFC, 0xFA, 0xC8, 0x08, 0x0F, 0xA6,
+    0x73, 0x9E, 0x70, 0x0C, 0x6E, 0x7C, 0x8A, 0x2E, 0x24, 0x74, 0x4A, 0x59, 0xDD, 0x33, 0xC8, 0x00,
+    0xFA, 0x0B, 0xFE, 0x23, 0xE7, 0xC6, 0xFD, 0x36, 0xF8, 0x25, 0x83, 0x1B, 0x83, 0x5B, 0x7C, 0xC0,
+    0x14, 0x0B, 0xCF, 0x82, 0xA9, 0x78, 0x20, 0x38, 0xE1, 0x1B, 0xC6, 0xFD, 0x53, 0xC1, 0xFD, 0xE6,
+    0x52, 0x15, 0x8C, 0x10, 0x43, 0xD1, 0xA1, 0xFD, 0x2D, 0x55, 0xCE, 0xCA, 0x12, 0xEA, 0xE3, 0x28,
+    0x5B, 0x52, 0x2F, 0x16, 0x3E, 0x7C, 0x6B, 0x60, 0x4F, 0x57, 0x88, 0x1F, 0x0D, 0x89, 0x3A, 0x66,
+    0xF7, 0xB3, 0xBB, 0x09, 0xFB, 0x81, 0x4E, 0x80, 0xF6, 0xC5, 0x29, 0x67, 0x13, 0x51, 0xB9, 0x66,
+    0xF3, 0xD8, 0x51, 0x81, 0xE1, 0x0E, 0xC8, 0x7B, 0x82, 0x64, 0x15, 0x28, 0x3A, 0x02, 0xF4, 0x92,
+    0xA0, 0x6C, 0x08, 0x0E, 0x93, 0x40, 0x6B, 0x04, 0x18, 0x70, 0x00, 0x28, 0x92, 0x00, 0x83, 0x05,
+    0x10, 0x91, 0x84, 0x4E, 0x69, 0xAC, 0xEF, 0x65, 0xD7, 0x5A, 0x97, 0x3F, 0x98, 0xF1, 0x61, 0x2D,
+    0x29, 0xB8, 0xFA, 0x57, 0x8A, 0x2B, 0x2C, 0x1C, 0x5D, 0x2B, 0x9F, 0x53, 0xD7, 0xE9, 0x9C, 0x53,
+    0xD1, 0x79, 0xF5, 0x9A, 0x7C, 0xBD, 0x26, 0x61, 0x33, 0x5F, 0x9B, 0xF9, 0x0F, 0x64, 0xBD, 0x10,
+    0x63, 0x29, 0x4D, 0xA2, 0x93, 0x6E, 0x3C, 0x0A, 0x44, 0xA6, 0xF9, 0x4C, 0x3D, 0xAA, 0x4E, 0x86,
+    0xF7, 0x4E, 0x4F, 0x8F, 0x46, 0xAF, 0xDD, 0x7A, 0x79, 0xF1, 0xF5, 0x42, 0x95, 0x2C, 0xA7, 0x40,
+    0x93, 0x3D, 0xDD, 0x65, 0x02, 0x8E, 0x70, 0xB0, 0x79, 0x13, 0x27, 0xAB, 0xF1, 0x0A, 0x86, 0x1F,
+    0xAD, 0xF5, 0xAA, 0xF5, 0x3E, 0xF3, 0xEE, 0xE0, 0xA3, 0xA6, 0x77, 0x34, 0xD4, 0x03, 0xB1, 0x6C,
+    0xDF, 0xB2, 0xF0, 0xB8, 0x50, 0xFC, 0x96, 0x51, 0x1E, 0x1A, 0x25, 0x5C, 0x3A, 0x4D, 0x68, 0x3E,
+    0x94, 0x23, 0x4F, 0x1C, 0x4B, 0xD7, 0x6F, 0xD6, 0xF3, 0xFD, 0x5B, 0xA5, 0xEF, 0xEA, 0xB1, 0x4B,
+    0x1A, 0xE6, 0x62, 0x6B, 0x6F, 0x74, 0xF6, 0xE7, 0x4B, 0xDC, 0xE7, 0x2E, 0x6E, 0xC1, 0x95, 0x77,
+    0x26, 0x4F, 0x23, 0x67, 0xB8, 0x29, 0xC7, 0xA8, 0x6F, 0x92, 0xC2, 0xF1, 0x63, 0x23, 0xE9, 0xB2,
+    0xF3, 0x38, 0x48, 0x90, 0x19, 0x0E, 0xCC, 0x11, 0x2A, 0xA8, 0xDA, 0x25, 0xA5, 0x50, 0x99, 0xF8,
+    0xEF, 0x92, 0x3B, 0x7E, 0x0B, 0x3F, 0x36, 0xFC, 0xE6, 0xFC, 0x60, 0xFF, 0xB7, 0xFE, 0x03, 0xC5,
+    0x55, 0xB1, 0xAE, 0xD5, 0x46, 0x10, 0x1D, 0xDF, 0x15, 0xEF, 0x16, 0x2E, 0x5C, 0x11, 0x09, 0xBD,
+    0x62, 0xEB, 0x14, 0xD1, 0x7E, 0xC2, 0x1A, 0xF8, 0x00, 0x28, 0x82, 0x90, 0xD2, 0xBC, 0x3A, 0x4A,
+    0x91, 0x4F, 0xB0, 0x25, 0x4A, 0x0A, 0x28, 0x90, 0xD2, 0xA6, 0x08, 0x55, 0x0A, 0xFE, 0x00, 0x1B,
+    0x52, 0xA6, 0xC0, 0xE8, 0x95, 0x14, 0xB1, 0x92, 0x2B, 0xA5, 0x8C, 0x25, 0x1C, 0xE1, 0xC7, 0xDB,
+    0xF5, 0x70, 0xCE, 0xF8, 0x49, 0xE1, 0x46, 0x49, 0x91, 0x22, 0xC2, 0x57, 0x1A, 0xDD, 0xF1, 0xEC,
+    0xCE, 0xCC, 0x39, 0x67, 0x76, 0x2D, 0xC5, 0xD7, 0x22, 0x3B, 0xD5, 0x41, 0x3A, 0xD5, 0x69, 0xAF,
+    0xAA, 0xA3, 0x9F, 0x77, 0xDA, 0x37, 0xB5, 0xD3, 0x9B, 0x49, 0xAA, 0xEC, 0x46, 0x89, 0x53, 0x51,
+    0x8B, 0xF6, 0x22, 0x65, 0x16, 0x91, 0x66, 0x94, 0x52, 0x55, 0xC4, 0xEB, 0x2A, 0x12, 0xF9, 0x4F,
+    0xBE, 0xC5, 0x3F, 0x09, 0x09, 0x26, 0xCE, 0x5F, 0x88, 0xE8, 0xF9, 0x22, 0x4E, 0xC3, 0x8C, 0x57,
+    0xDD, 0x5C, 0xE8, 0x6B, 0x5D, 0xBB, 0x75, 0xC7, 0xCC, 0x85, 0xEA, 0x22, 0xF2, 0xD9, 0x53, 0x41,
+    0xB1, 0xEC, 0x94, 0x4F, 0xDF, 0xA8, 0x76, 0x8A, 0x8A, 0xDA, 0xC6, 0x59, 0x0A, 0xED, 0x9D, 0xD6,
+    0xE2, 0x13, 0x12, 0x21, 0x85, 0x39, 0x6A, 0x4E, 0x34, 0xA7, 0x32, 0xC7, 0xAD, 0xE6, 0xE8, 0x19,
+    0x9D, 0xF8, 0x9A, 0xCE, 0x9D, 0x99, 0x7B, 0x2E, 0xB3, 0x25, 0xD0, 0x9A, 0x8E, 0x0E, 0xE6, 0xCC,
+    0x96, 0x2D, 0x1F, 0xA7, 0x86, 0xE3, 0xD1, 0x4A, 0xA7, 0x6F, 0x80, 0x3C, 0xB2, 0x8F, 0x04, 0xE8,
+    0x93, 0xC8, 0x5D, 0xFC, 0x00, 0xA5, 0x0D, 0xAD, 0x88, 0x4B, 0x8E, 0x90, 0xC2, 0xD8, 0x01, 0xBA,
+    0x28, 0x32, 0x91, 0x29, 0x00, 0xF8, 0x87, 0xA7, 0xFC, 0x38, 0xCF, 0x25, 0x3A, 0x08, 0xBA, 0x1C,
+    0x95, 0xA3, 0x13, 0xCD, 0xA9, 0xCC, 0x71, 0x1B, 0x2C, 0x35, 0x27, 0xFE, 0x41, 0xA7, 0xFA, 0x93,
+    0xCE, 0xED, 0x6C, 0x7B, 0xF4, 0x26, 0x9D, 0x6E, 0x30, 0x24, 0xB3, 0x25, 0xC8, 0x96, 0x4D, 0x6B,
+    0x73, 0x86, 0xE3, 0xD4, 0x3E, 0x81, 0xDB, 0xB6, 0xD4, 0x7C, 0x44, 0x2C, 0x3B, 0xBB, 0x46, 0xAE,
+    0xA5, 0xE9, 0xD1, 0x5A, 0xA1, 0x63, 0xA7, 0x07, 0xA7, 0x23, 0x76, 0x94, 0x66, 0xAB, 0x8B, 0xC7,
+    0xB0, 0x61, 0x00, 0xD7, 0x75, 0xD3, 0xD2, 0x62, 0x0F, 0x84, 0xCF, 0xB4, 0xDF, 0x25, 0x5A, 0x02,
+    0x86, 0xB5, 0xFF, 0x3F, 0xAE, 0xB4, 0xB7, 0x51, 0xCF, 0xB1, 0x3F, 0x5B, 0x3F, 0xDA, 0x5E, 0xAA,
+    0x55, 0x03, 0x1F, 0xAC, 0x57, 0xB1, 0xFC, 0xAD, 0x27, 0x05, 0xA8, 0x88, 0xBA, 0x0B, 0x13, 0x34,
+    0x9C, 0x12, 0x39, 0x79, 0x2C, 0x46, 0x14, 0xD6, 0xE1, 0x19, 0xAC, 0x59, 0xD4, 0xCF, 0xF7, 0x91,
+    0x55, 0x56, 0xC1, 0x7F, 0x89, 0x1C, 0x05, 0xA9, 0xC6, 0x8A, 0x6D, 0x18, 0x8D, 0x45, 0xB6, 0x40,
+    0x53, 0x33, 0xE0, 0x7B, 0x06, 0xCA, 0x89, 0x01, 0x28, 0xC4, 0xC0, 0x4A, 0x2A, 0x10, 0x66, 0x20,
+    0x0C, 0x0C, 0x54, 0x13, 0x03, 0xFB, 0x85, 0xE3, 0xF2, 0x80, 0x73, 0x0C, 0xAA, 0xAD, 0x53, 0x95,
+    0x53, 0x5D, 0x3D, 0x47, 0x49, 0xCF, 0xB5, 0x86, 0x5A, 0xF3, 0x0D, 0x53, 0xD0, 0x91, 0x2E, 0x70,
+    0xC8, 0x11, 0xC3, 0x5B, 0xE1, 0x7C, 0x04, 0xA5, 0x5C, 0xC8, 0x64, 0x93, 0xDE, 0xEF, 0xC9, 0x85,
+    0x69, 0x0B, 0xD0, 0xEF, 0x56, 0xC9, 0xA0, 0xA0, 0x7A, 0x93, 0xDC, 0x5B, 0xEC, 0x6C, 0xCE, 0xA6,
+    0xF0, 0x2A, 0x49, 0x91, 0xE2, 0xB0, 0x86, 0x09, 0xDD, 0xE9, 0x4F, 0x13, 0xE6, 0x26, 0xBC, 0x50,
+    0xFF, 0x92, 0x43, 0xEC, 0xF2, 0xF3, 0x7D, 0x46, 0xBB, 0xD5, 0xE5, 0xE4, 0x91, 0x74, 0xF2, 0x10,
+    0x08, 0x27, 0xAB, 0x8F, 0x80, 0xDC, 0x12, 0xF7, 0xE4, 0x56, 0xB4, 0x0B, 0x39, 0xAB, 0x24, 0x7E,
+    0x84, 0x13, 0x27, 0xE9, 0xEA, 0x12, 0x23, 0xD2, 0x97, 0xFA, 0xBD, 0xC7, 0xBC, 0xCE, 0x24, 0x0A,
+    0x32, 0xFF, 0xCE, 0x4E, 0xD1, 0x62, 0xBD, 0x69, 0xFD, 0x16, 0x10, 0x00, 0xE6, 0x67, 0x6B, 0x0C,
+    0x30, 0x47, 0xC4, 0x6A, 0xA3, 0xC0, 0x60, 0x33, 0x0F, 0xC9, 0x41, 0xAF, 0xE4, 0xD9, 0x48, 0xB0,
+    0x10, 0x30, 0x35, 0xD3, 0xA6, 0x05, 0x42, 0x7C, 0xC4, 0xC4, 0xD8, 0x42, 0xFF, 0xB6, 0xEB, 0x38,
+    0xE1, 0xB8, 0x09, 0xCE, 0x93, 0xF4, 0xEB, 0xD6, 0xC6, 0xAB, 0xED, 0x20, 0x70, 0xF0, 0x9E, 0xD8,
+    0x79, 0xC1, 0x1A, 0xF0, 0x88, 0xC6, 0x78, 0xC1, 0x68, 0xBB, 0xD3, 0x83, 0xD7, 0x61, 0xAF, 0x88,
+    0x4C, 0x4C, 0xA6, 0x73, 0x00, 0xA9, 0x31, 0x31, 0x23, 0x2C, 0x8E, 0x60, 0xC8, 0x68, 0x4B, 0xFC,
+    0x95, 0xED, 0x60, 0xAB, 0x8F, 0xAC, 0x4F, 0xCD, 0x6C, 0x16, 0xBB, 0xC2, 0x82, 0x89, 0x43, 0x2F,
+    0xC1, 0xA0, 0x54, 0x3C, 0x19, 0x43, 0xA9, 0x87, 0x53, 0x6D, 0x09, 0x64, 0xB5, 0x8A, 0x5C, 0x8C,
+    0xB2, 0x68, 0xE5, 0xAB, 0xBB, 0x5B, 0x0B, 0xAA, 0xBF, 0x98, 0xCD, 0x9B, 0x53, 0xC7, 0x8B, 0x7B,
+    0xF7, 0xB9, 0xA3, 0xB6, 0x6B, 0xC6, 0x06, 0xF9, 0xFF, 0x71, 0x78, 0x29, 0xF2, 0x50, 0x80, 0x93,
+    0x87, 0x60, 0x09, 0xEA, 0xA1, 0x89, 0x8A, 0xA2, 0xCA, 0x3D, 0x29, 0xBA, 0x8D, 0x3F, 0x4D, 0x81,
+    0xC6, 0xE9, 0x2D, 0xB8, 0x54, 0x33, 0xF2, 0x36, 0x26, 0x63, 0x64, 0x3A, 0xE1, 0x55, 0x87, 0x57,
+    0x3C, 0x78, 0x43, 0xC4, 0xAA, 0x67, 0x98, 0x17, 0x4A, 0x06, 0xCA, 0x31, 0x64, 0xEF, 0x6B, 0xD3,
+    0xC9, 0x54, 0x32, 0x8D, 0xEC, 0x70, 0xD8, 0xAB, 0x06, 0x4C, 0x94, 0x14, 0x23, 0x6E, 0x6C, 0x5C,
+    0x7B, 0x6A, 0xE2, 0x1C, 0xA8, 0x4D, 0x92, 0xAD, 0xE4, 0xE1, 0x34, 0x95, 0xCA, 0x19, 0xC5, 0x39,
+    0x5E, 0x20, 0xCB, 0x6E, 0x66, 0x8E, 0x9A, 0xA2, 0x70, 0x54, 0xAE, 0x4C, 0xF7, 0x37, 0xC3, 0x32,
+    0x54, 0x83, 0xD7, 0x1B, 0x8F, 0x89, 0x90, 0xF1, 0x51, 0x6E, 0x94, 0xE4, 0xD8, 0xD9, 0x40, 0x75,
+    0xBC, 0x45, 0x4A, 0x43, 0x7A, 0xFD, 0xCB, 0x6D, 0xE4, 0x16, 0x23, 0xFF, 0x37, 0xB3, 0x8F, 0xDE,
+    0x9F, 0xAD, 0xDF, 0x64, 0x9C, 0x85, 0x79, 0x3F, 0xF3, 0x06, 0xF0, 0xE7, 0x04, 0xD8, 0xEC, 0x5A,
+    0xE0, 0xF8, 0xE1, 0x0A, 0x88, 0x21, 0xD9, 0xA0, 0x6C, 0xF0, 0xFE, 0xDB, 0xEB, 0x13, 0x2B, 0x6E,
+    0xD8, 0x0B, 0x1B, 0xC6, 0x86, 0x37, 0xF5, 0x8A, 0xCB, 0xA9, 0xD4, 0x15, 0xDC, 0x9C, 0xE8, 0xB2,
+    0x47, 0xAC, 0xE9, 0x77, 0x1C, 0x6B, 0x50, 0x89, 0x8F, 0x07, 0xB0, 0x8D, 0xCE, 0xE6, 0x9D, 0xDF,
+    0x81, 0xB0, 0x94, 0xBC, 0x94, 0x52, 0x35, 0xF2, 0x3B, 0x18, 0xF0, 0x49, 0x70, 0x6B, 0x6C, 0x49,
+    0x62, 0x67, 0x05, 0xED, 0x72, 0x6B, 0xD2, 0x5F, 0x2D, 0xF8, 0xC9, 0x2C, 0x1B, 0x19, 0x22, 0x96,
+    0xEF, 0x2E, 0xD4, 0x7A, 0xCA, 0x66, 0x49, 0x58, 0xC1, 0xB3, 0x21, 0xF2, 0xB9, 0x7C, 0xC2, 0xE7,
+    0x03, 0xC5, 0x55, 0xA1, 0xB2, 0xE5, 0x44, 0x10, 0xED, 0x9B, 0x14, 0xEF, 0x8A, 0x88, 0x71, 0x98,
+    0x15, 0xB1, 0xB8, 0x7C, 0xC2, 0xA4, 0x6A, 0x25, 0x82, 0xF7, 0x07, 0x18, 0x14, 0x86, 0x4F, 0x48,
+    0x56, 0xE0, 0x57, 0xA0, 0xC0, 0xAC, 0x59, 0xB1, 0xFB, 0x11, 0x24, 0x60, 0x11, 0x64, 0x0B, 0xDC,
+    0x33, 0x11, 0xAB, 0xD6, 0x90, 0x82, 0x14, 0x1B, 0xD8, 0x24, 0x87, 0x73, 0x7A, 0x92, 0xC7, 0x42,
+    0x21, 0x30, 0xB0, 0xB7, 0xE6, 0xF6, 0x4C, 0x66, 0x26, 0x73, 0x4E, 0x77, 0x9F, 0xF4, 0x58, 0xF6,
+    0xFC, 0xF9, 0x13, 0x33, 0x03, 0x16, 0xDA, 0xE8, 0xD6, 0x9A, 0x49, 0xB6, 0xDC, 0x6A, 0xB3, 0x02,
+    0x40, 0x6B, 0x15, 0xED, 0x6E, 0x71, 0x6F, 0x7E, 0xC5, 0x54, 0x2D, 0x61, 0x29, 0xF7, 0xB0, 0xE6,
+    0xFB, 0x05, 0xDF, 0x6D, 0x86, 0x36, 0xBE, 0x46, 0x1D, 0xC7, 0x62, 0x43, 0x1F, 0x96, 0x0C, 0x9F,
+    0xCD, 0xF9, 0x6E, 0xDD, 0xDD, 0xAE, 0x85, 0x09, 0x43, 0x1C, 0xAB, 0xA5, 0xDA, 0xC3, 0x52, 0xAD,
+    0x19, 0xCF, 0xC0, 0x6A, 0x25, 0xED, 0x6C, 0xF6, 0x00, 0x7B, 0x4B, 0x8C, 0xE0, 0x78, 0x57, 0x38,
+    0x1E, 0x21, 0x38, 0x03, 0xF4, 0x66, 0x64, 0xF5, 0x58, 0x33, 0x78, 0x08, 0x90, 0xC2, 0x00, 0x7C,
+    0x43, 0x5B, 0x62, 0xB8, 0xA2, 0xBF, 0xA0, 0xB6, 0x66, 0xE5, 0xF9, 0x24, 0x57, 0xD3, 0x5A, 0x37,
+    0x75, 0xBD, 0x5E, 0x6C, 0x7A, 0x77, 0x64, 0xF0, 0xB3, 0x64, 0x33, 0x8C, 0xEE, 0xCE, 0x6A, 0xEE,
+    0x5B, 0xEB, 0x96, 0xE0, 0x56, 0xBD, 0x11, 0x62, 0x39, 0x81, 0x8E, 0x86, 0x39, 0x10, 0x37, 0x90,
+    0xDF, 0x60, 0xC5, 0x6A, 0x71, 0xB5, 0x62, 0xB3, 0x1C, 0x7D, 0x89, 0x97, 0x37, 0xC0, 0xC7, 0xC0,
+    0x15, 0x78, 0x03, 0x3C, 0x22, 0xF9, 0x0E, 0x1B, 0xE9, 0x7D, 0x0F, 0xBC, 0xF0, 0x87, 0x39, 0x28,
+    0x28, 0x8B, 0xE8, 0xE7, 0xE2, 0x34, 0x59, 0x9C, 0xFF, 0xBB, 0x87, 0xDF, 0x18, 0x33, 0x8F, 0x1E,
+    0x70, 0x87, 0xB7, 0x7E, 0x9E, 0xAB, 0x5C, 0xA1, 0xA3, 0x77, 0x83, 0x3F, 0x6C, 0xFE, 0x50, 0x29,
+    0x1C, 0x76, 0x71, 0xE7, 0x2D, 0xB4, 0xDE, 0x7D, 0x12, 0xB1, 0x95, 0xEE, 0xD5, 0x87, 0xC0, 0x0F,
+    0xEE, 0xD5, 0x50, 0x38, 0xC6, 0x85, 0x61, 0x67, 0x04, 0x12, 0x6C, 0xB9, 0x5A, 0xD8, 0x0E, 0xF0,
+    0x63, 0x81, 0xB3, 0x6C, 0x01, 0x35, 0x17, 0x3C, 0x95, 0x35, 0x63, 0xA9, 0x60, 0x67, 0x29, 0xA1,
+    0x37, 0xCF, 0x3E, 0x72, 0x58, 0xD1, 0x55, 0x1A, 0x9C, 0x49, 0x9C, 0x1D, 0xFB, 0xAD, 0x85, 0xE2,
+    0x4C, 0xF2, 0xA0, 0x19, 0xCC, 0x9D, 0x07, 0x12, 0x78, 0x0D, 0xFC, 0xE2, 0x8C, 0xEE, 0xB0, 0x17,
+    0xDE, 0x78, 0x04, 0xA1, 0x33, 0xB4, 0xB9, 0x68, 0xD8, 0x75, 0x67, 0x8E, 0xD4, 0xCA, 0xC5, 0xE2,
+    0xA4, 0xD6, 0x8C, 0x26, 0x6A, 0xD4, 0xC3, 0xFF, 0xB0, 0xE5, 0x47, 0x6E, 0xB9, 0x41, 0x5B, 0x1E,
+    0x41, 0xFF, 0xF9, 0x8C, 0xFE, 0x4F, 0xE7, 0xA0, 0x3E, 0x3D, 0x61, 0x5B, 0xDD, 0xD2, 0xB7, 0x31,
+    0x35, 0xBA, 0xCE, 0x58, 0x16, 0xBB, 0xDD, 0x23, 0xBC, 0xEB, 0xC1, 0x2D, 0x07, 0x0F, 0x76, 0x3B,
+    0xDD, 0x59, 0xBA, 0x63, 0xB0, 0x9D, 0xEE, 0x24, 0x09, 0x99, 0xBE, 0x88, 0xF4, 0xBB, 0x9E, 0x83,
+    0xFC, 0x7E, 0xB0, 0x9C, 0x83, 0xF9, 0x18, 0x64, 0xE7, 0xC0, 0x9E, 0x48, 0x1B, 0xBD, 0xF2, 0x4C,
+    0x7D, 0xE6, 0x49, 0x21, 0x78, 0xAA, 0xCF, 0x31, 0xF6, 0x12, 0x45, 0x18, 0x25, 0x8A, 0x7C, 0x76,
+    0x51, 0x7C, 0xF0, 0x57, 0xB5, 0xE0, 0x99, 0xAB, 0xC5, 0x85, 0x92, 0xF4, 0x1D, 0x7F, 0xEF, 0x20,
+    0x19, 0x5D, 0xB8, 0x8F, 0x6F, 0x54, 0x8B, 0xF4, 0xA5, 0xA2, 0x11, 0x67, 0xA9, 0x93, 0x47, 0x31,
+    0x45, 0x5C, 0xD0, 0x01, 0x78, 0xD1, 0xAD, 0xAE, 0xC9, 0xD5, 0x71, 0x17, 0x3F, 0x63, 0x3C, 0x68,
+    0x75, 0xF2, 0xAB, 0x93, 0x97, 0x9B, 0xE6, 0xB7, 0x4E, 0xBC, 0x68, 0x72, 0xD5, 0x06, 0x1E, 0xE0,
+    0x74, 0xFE, 0x55, 0xFF, 0xEA, 0x36, 0xF5, 0xD8, 0x8F, 0x1E, 0x83, 0xF7, 0x5F, 0x61, 0x4A, 0xFB,
+    0xE2, 0x92, 0xFA, 0x72, 0x4D, 0x7D, 0xF8, 0x5B, 0x7F, 0xCE, 0x1F, 0xFB, 0x3E, 0xF7, 0xF7, 0x94,
+    0x8F, 0xA1, 0x4A, 0xE9, 0xB0, 0x94, 0x8D, 0xD1, 0xFE, 0x4C, 0x46, 0xE2, 0x8F, 0xE4, 0xC4, 0x2C,
+    0x26, 0xED, 0xF1, 0x5D, 0xFD, 0xB3, 0x79, 0xF5, 0xD8, 0x63, 0xE0, 0xF4, 0x28, 0xC2, 0x2F, 0xE5,
+    0x68, 0x5D, 0x09, 0x38, 0x6C, 0x34, 0xC5, 0xBD, 0x71, 0x52, 0x62, 0xF4, 0xA8, 0x9B, 0xC5, 0x61,
+    0x14, 0x81, 0x9A, 0xFF, 0x97, 0x07, 0xF0, 0x7B, 0x4F, 0x0F, 0xF4, 0xCC, 0x33, 0xE2, 0x82, 0x8F,
+    0xF3, 0x0D, 0xA6, 0x30, 0x51, 0x44, 0xB9, 0x22, 0xDE, 0x7F, 0xCD, 0x7C, 0x2C, 0x85, 0xAA, 0xB2,
+    0xCA, 0x8E, 0xAA, 0xB8, 0xAA, 0x49, 0x25, 0xBA, 0x57, 0xAF, 0x17, 0x2E, 0x89, 0xE3, 0x76, 0x29,
+    0xA5, 0xA2, 0x62, 0xCF, 0x7A, 0x32, 0x7C, 0x38, 0xF3, 0xF5, 0x6F, 0xC1, 0x77, 0x86, 0x6E, 0x66,
+    0xCD, 0x76, 0x06, 0x99, 0xFB, 0x5E, 0xEA, 0xF6, 0xB1, 0xF7, 0xBF, 0x38, 0x03, 0xC0, 0x51, 0x26,
+    0x31, 0xE9, 0xAE, 0xD0, 0x4D, 0xA1, 0x5D, 0x75, 0x45, 0x04, 0xE9, 0xAD, 0xF5, 0x48, 0x0E, 0x8D,
+    0xD7, 0xA8, 0x6A, 0x25, 0xB4, 0x24, 0x45, 0xCC, 0xC8, 0x6B, 0x6A, 0xE0, 0xE7, 0x67, 0xCD, 0x72,
+    0xAA, 0x64, 0xE2, 0x16, 0xAE, 0x90, 0x76, 0x9C, 0xA5, 0xA4, 0x42, 0xF1, 0xA6, 0x66, 0x4C, 0xE1,
+    0x71, 0xD1, 0x35, 0x53, 0x70, 0xC2, 0x17, 0x6D, 0x29, 0x8E, 0x2D, 0x43, 0xC9, 0xD8, 0x57, 0x3A,
+    0xA5, 0x71, 0x11, 0xEA, 0x14, 0x09, 0x9C, 0x40, 0x44, 0xE6, 0x8A, 0x0B, 0x53, 0xF5, 0x44, 0x51,
+    0xC5, 0x58, 0x51, 0x9A, 0x18, 0x75, 0xD0, 0xA8, 0x6B, 0x2C, 0x20, 0x51, 0x55, 0x40, 0x52, 0x41,
+    0xB6, 0x4F, 0x6F, 0xED, 0x5D, 0xFE, 0xFE, 0x00, 0xB5, 0x55, 0xB1, 0x6E, 0x26, 0x35, 0x10, 0x9E,
+    0x7F, 0xF7, 0x12, 0xEB, 0xD8, 0x62, 0x1B, 0x82, 0x10, 0x8D, 0x1F, 0x61, 0x1F, 0xC1, 0x9B, 0xA3,
+    0xA0, 0xA0, 0x49, 0x91, 0x08, 0x09, 0x8A, 0xA3, 0xA0, 0xA1, 0x40, 0x79, 0x03, 0xBC, 0x79, 0x02,
+    0x68, 0x78, 0x03, 0x9A, 0x90, 0x17, 0xA0, 0xC2, 0x1B, 0x28, 0xAE, 0xB5, 0x74, 0x3A, 0x52, 0x50,
+    0xB0, 0x45, 0xD0, 0x49, 0x5C, 0x11, 0x83, 0x8C, 0xCE, 0x39, 0x6C, 0x0F, 0xDF, 0xEC, 0x7F, 0x09,
+    0x39, 0xA4, 0x43, 0x34, 0xEC, 0xC5, 0x13, 0x67, 0x6E, 0x66, 0x3C, 0xFE, 0xBE, 0x99, 0x31, 0xD1,
+    0x31, 0x73, 0xA4, 0x81, 0x99, 0x7D, 0x0B, 0x51, 0x68, 0xA8, 0x0F, 0x78, 0x22, 0x9E, 0xBB, 0x42,
+    0x5D, 0xA5, 0x21, 0xCA, 0x8F, 0xF3, 0xC4, 0xBE, 0xE1, 0xB1, 0xE1, 0x09, 0x6A, 0xC5, 0xA2, 0xEB,
+    0x79, 0x84, 0xBA, 0x87, 0xCF, 0x48, 0x9D, 0x38, 0x8A, 0x8C, 0x44, 0x66, 0x81, 0xBA, 0x61, 0x58,
+    0x93, 0xCE, 0xB0, 0x86, 0xA7, 0x58, 0xD7, 0x35, 0x48, 0x40, 0x04, 0x38, 0x5A, 0x5E, 0x38, 0xC1,
+    0xFC, 0x82, 0x47, 0x9C, 0xBC, 0xFF, 0x25, 0xC9, 0xB7, 0x7B, 0x4A, 0xA4, 0x39, 0x4B, 0x18, 0x98,
+    0x3D, 0xE3, 0xD1, 0x2C, 0x3A, 0xB5, 0x85, 0x78, 0xDA, 0x9D, 0xFA, 0x04, 0x03, 0xA4, 0xF5, 0x0E,
+    0x27, 0xC9, 0x75, 0xD2, 0xCC, 0xA9, 0xE5, 0x89, 0x27, 0xBB, 0xF4, 0xA9, 0x13, 0x1B, 0xB7, 0x0C,
+    0x59, 0x21, 0x99, 0x6A, 0xF8, 0x39, 0x7B, 0x4E, 0x26, 0xD2, 0x21, 0xFE, 0xDD, 0x7C, 0x6F, 0x63,
+    0x3D, 0x9C, 0xC9, 0x22, 0xBE, 0x61, 0x9E, 0xFB, 0xD5, 0xFF, 0x0C, 0x49, 0xCD, 0x44, 0x12, 0xBC,
+    0x61, 0x18, 0x98, 0xB0, 0x47, 0x6D, 0x75, 0x15, 0x66, 0x9C, 0x91, 0x06, 0x07, 0x17, 0x15, 0x7F,
+    0x51, 0x70, 0x11, 0x46, 0xF2, 0x3F, 0x17, 0xEA, 0x8B, 0x5B, 0x88, 0x7F, 0xAA, 0xD8, 0xD8, 0x40,
+    0xFC, 0x98, 0xA9, 0xCF, 0x26, 0x6D, 0xF8, 0x84, 0xBD, 0x0D, 0x08, 0x5A, 0x25, 0xFA, 0x44, 0x0E,
+    0x8B, 0x8E, 0x46, 0xDA, 0xF9, 0xF0, 0x54, 0xD2, 0x2D, 0x82, 0x92, 0xB7, 0xF1, 0x38, 0xAB, 0xDC,
+    0xF0, 0x86, 0xC9, 0xCE, 0x76, 0xD6, 0x41, 0xFF, 0xF1, 0x3E, 0xC2, 0x33, 0xDC, 0xE1, 0x63, 0x9F,
+    0xB8, 0xA8, 0x43, 0xCB, 0x2A, 0x13, 0x9F, 0x33, 0x52, 0x81, 0x45, 0xB2, 0x2F, 0x5C, 0x76, 0xF0,
+    0x47, 0xD0, 0x74, 0x7B, 0x15, 0x28, 0xAA, 0x30, 0x05, 0x0C, 0x8A, 0xAA, 0x1B, 0x2C, 0x92, 0x95,
+    0xB1, 0x12, 0x16, 0xBD, 0x6E, 0x69, 0xFE, 0x1A, 0xBE, 0x08, 0x8F, 0xB5, 0xFD, 0x24, 0xAD, 0x84,
+    0xBF, 0x41, 0xE1, 0x2E, 0x9F, 0x21, 0x67, 0x15, 0x40, 0x15, 0x7D, 0x27, 0xDC, 0x75, 0x8B, 0x6C,
+    0xAB, 0x6C, 0x7B, 0x21, 0x90, 0xF2, 0xCA, 0xE8, 0x8C, 0x6D, 0xB3, 0x6E, 0xCD, 0x88, 0xAD, 0x0A,
+    0xB2, 0x95, 0x32, 0xD9, 0xB8, 0xEA, 0x38, 0x59, 0x09, 0xF6, 0x94, 0x57, 0x1E, 0x3C, 0x00, 0x7D,
+    0x8C, 0xA3, 0x9A, 0x62, 0x00, 0xF2, 0xF0, 0x3D, 0x6E, 0xB0, 0xC9, 0x1A, 0xC0, 0xF4, 0x53, 0xC0,
+    0xE1, 0xDF, 0xAE, 0x84, 0xBB, 0xB5, 0xEC, 0x62, 0x5F, 0x5D, 0xD6, 0xA1, 0x2B, 0xC6, 0xB7, 0xD5,
+    0xCE, 0x2D, 0xBB, 0x5F, 0x3E, 0xE0, 0x97, 0xF7, 0xAC, 0xFC, 0xE4, 0xE8, 0x50, 0x68, 0x42, 0xFD,
+    0x10, 0x40, 0x27, 0x53, 0xF7, 0x3F, 0x93, 0xBB, 0x83, 0xA0, 0x0C, 0xE8, 0x16, 0xDA, 0x39, 0xA4,
+    0x66, 0x2D, 0xA1, 0x4F, 0x50, 0x07, 0x86, 0x67, 0xD4, 0x4D, 0x6D, 0x39, 0xF5, 0x40, 0x1A, 0x21,
+    0x1B, 0x0E, 0xF7, 0x1D, 0xF0, 0x36, 0x3F, 0x12, 0xB0, 0xCA, 0x1D, 0x22, 0x74, 0x00, 0xB7, 0x08,
+    0xDF, 0xEF, 0xE5, 0x01, 0xF9, 0x48, 0xDD, 0xE3, 0x82, 0xC2, 0x3A, 0x4B, 0x39, 0x14, 0x77, 0x51,
+    0xA5, 0x22, 0x54, 0x96, 0x7B, 0xDB, 0xC5, 0xCE, 0x50, 0xF7, 0xE2, 0x5B, 0xA1, 0x95, 0x50, 0xE8,
+    0x88, 0xD0, 0x01, 0x9B, 0x79, 0xC0, 0x41, 0xB9, 0xE7, 0x77, 0xB7, 0xE7, 0xA6, 0x9D, 0x51, 0xD2,
+    0x40, 0xD5, 0xBD, 0x75, 0x4A, 0x92, 0x9A, 0xA4, 0xA8, 0xAF, 0x2D, 0x6E, 0xDD, 0x97, 0x1D, 0xEA,
+    0x00, 0x46, 0x9F, 0x69, 0xEF, 0x58, 0xFA, 0xCD, 0x63, 0x45, 0x7A, 0xC3, 0x21, 0x0F, 0xC5, 0x0A,
+    0x39, 0x0C, 0x53, 0xCB, 0xC6, 0x03, 0x02, 0x81, 0x02, 0xA5, 0xA7, 0xA4, 0xB1, 0xF6, 0x0E, 0xB6,
+    0x4C, 0x0D, 0x1C, 0x0C, 0x5F, 0xC9, 0x51, 0xC9, 0x26, 0x72, 0x8B, 0x42, 0x4D, 0xC6, 0x0D, 0x8F,
+    0xBA, 0x90, 0xF5, 0x1A, 0xBF, 0xA3, 0x66, 0xAF, 0x8A, 0xBE, 0x82, 0xF2, 0xE1, 0x05, 0x94, 0x57,
+    0xE7, 0x50, 0x22, 0x57, 0xAF, 0x78, 0x16, 0xCB, 0x59, 0x89, 0x25, 0x3C, 0xC4, 0x3D, 0x39, 0x9E,
+    0x19, 0xF8, 0x22, 0xE6, 0x42, 0xF7, 0xE8, 0x4D, 0xA4, 0x35, 0xEB, 0x99, 0x54, 0x14, 0x70, 0xB8,
+    0xCD, 0x72, 0xDE, 0x8A, 0x00, 0x84, 0xA0, 0x7B, 0xE7, 0xFB, 0x1F, 0x13, 0xC1, 0x04, 0x98, 0xF0,
+    0xF7, 0x10, 0xC0, 0x02, 0x7A, 0xA1, 0x12, 0x47, 0x55, 0x9A, 0xFA, 0xB1, 0x2A, 0x2A, 0x91, 0x2A,
+    0x7D, 0x80, 0x90, 0x2C, 0x85, 0x24, 0x25, 0xBC, 0xAB, 0x7A, 0x2C, 0x3A, 0x40, 0xAA, 0x8A, 0x8C,
+    0xA5, 0xD2, 0x32, 0x04, 0x58, 0xD1, 0x75, 0xE4, 0x05, 0xA1, 0x6C, 0x82, 0xAD, 0x16, 0xA6, 0x37,
+    0x07, 0xB7, 0xBD, 0x83, 0x13, 0xA4, 0xB3, 0x37, 0xEE, 0x57, 0x70, 0xD0, 0x7B, 0x13, 0xA8, 0x8D,
+    0x08, 0x41, 0xE2, 0x4D, 0x86, 0x84, 0xEA, 0x19, 0x4A, 0x15, 0xA0, 0x6C, 0x92, 0x28, 0x8B, 0x28,
+    0x0D, 0x5A, 0xF2, 0xFE, 0x30, 0xF7, 0xB9, 0xE5, 0xA5, 0xC5, 0x74, 0x0B, 0xBB, 0x7C, 0xE9, 0x22,
+    0x3A, 0x48, 0x47, 0xD4, 0xCF, 0x7C, 0x40, 0x77, 0xFA, 0x73, 0x24, 0x2E, 0x18, 0x01, 0x8D, 0xF4,
+    0x28, 0x8A, 0x79, 0x51, 0x52, 0x09, 0x00, 0x00, 0x13, 0xC2, 0xAB, 0x3F, 0xA3, 0x76, 0x5E, 0x3D,
+    0xCF, 0xC6, 0x78, 0xF5, 0x7B, 0xFE, 0x1C, 0xF2, 0xB7, 0x9A, 0x21, 0x03, 0x66, 0x16, 0xA4, 0x8D,
+    0x22, 0x4D, 0x10, 0x39, 0x78, 0x91, 0x48, 0xC7, 0xF7, 0xE9, 0x1E, 0xD9, 0x4B, 0x87, 0xFB, 0x31,
+    0xDA, 0x0C, 0x23, 0xB2, 0xFE, 0xCD, 0x06, 0xDF, 0xB2, 0x11, 0x85, 0x0D, 0x8C, 0x93, 0x11, 0xED,
+    0x2E, 0x18, 0x4F, 0x3A, 0xA2, 0x7C, 0x65, 0x2A, 0xAE, 0x33, 0x06, 0xCA, 0x17, 0x67, 0x37, 0xCA,
+    0x7F, 0x58, 0xDA, 0x42, 0xEE, 0x7A, 0x65, 0x83, 0x25, 0x66, 0xA0, 0xDD, 0x6F, 0x46, 0x41, 0x79,
+    0x6C, 0xC5, 0x4F, 0x1A, 0x04, 0xB3, 0x98, 0x7F, 0x60, 0xD2, 0xEB, 0xE0, 0x7B, 0x86, 0x09, 0x58,
+    0x31, 0x0A, 0xDD, 0x55, 0xC5, 0x2B, 0x01, 0x2E, 0x1C, 0x34, 0x5D, 0x71, 0xF8, 0xAF, 0x47, 0xE0,
+    0x3B, 0x1B, 0xA0, 0xB9, 0xCF, 0xDB, 0x0E, 0x48, 0x98, 0x3C, 0xE9, 0x4E, 0x1D, 0x09, 0xFC, 0x28,
+    0x21, 0xC9, 0x4A, 0x3A, 0x6E, 0x51, 0xEB, 0xF8, 0x58, 0x5F, 0x16, 0xBB, 0x60, 0x9C, 0x68, 0xDC,
+    0xC4, 0xFF, 0x27, 0xA5, 0x2D, 0x1B, 0x46, 0x09, 0xF9, 0xB5, 0x84, 0xF0, 0xA6, 0xD0, 0xA7, 0x1B,
+    0xCC, 0x5B, 0x4C, 0xCB, 0x59, 0x78, 0x0E, 0x12, 0x1D, 0x49, 0x7B, 0x07, 0xCE, 0xC6, 0x01, 0x02,
+    0x4D, 0xFC, 0x3A, 0x91, 0x6F, 0xC4, 0x00, 0x3A, 0x47, 0x17, 0xDA, 0x9B, 0x07, 0x51, 0x00, 0x48,
+    0x68, 0xCF, 0xAF, 0x46, 0x92, 0x5A, 0x78, 0x45, 0x8C, 0x72, 0x19, 0x94, 0x8E, 0x11, 0xB1, 0x77,
+    0x24, 0x17, 0x6C, 0xD6, 0xC6, 0x97, 0x57, 0xED, 0x01, 0x5F, 0x55, 0x9D, 0xFA, 0x8C, 0x7A, 0x7B,
+    0x0A, 0x90, 0x65, 0x94, 0x60, 0x82, 0x89, 0x13, 0xDE, 0x42, 0x1A, 0xE0, 0x01, 0xB4, 0x30, 0xA1,
+    0xA0, 0xBA, 0xFE, 0xE8, 0x11, 0x4E, 0x12, 0xA8, 0x94, 0xBC, 0x1E, 0x47, 0xE3, 0x16, 0x28, 0xA1,
+    0xB6, 0xAC, 0xFC, 0x6E, 0xC5, 0x39, 0x9F, 0x64, 0x73, 0x22, 0x62, 0x1F, 0x42, 0x03, 0x88, 0x88,
+    0x00, 0x18, 0x60, 0xFF, 0x2E, 0x14, 0x5F, 0x4A, 0xAC, 0xF2, 0x52, 0xBC, 0xFA, 0xFD, 0x05, 0xB5,
+    0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0xBD, 0xB6, 0x95, 0xB8, 0x70, 0x61, 0x1A, 0x1A, 0x52, 0x4C,
+    0x43, 0xEF, 0x47, 0x18, 0xA7, 0xA6, 0xA1, 0xC8, 0xA7, 0x14, 0x79, 0x83, 0x20, 0x04, 0x0F, 0x80,
+    0x64, 0x03, 0x05, 0x65, 0xF6, 0x35, 0x96, 0x86, 0x47, 0x18, 0x8B, 0x3C, 0x40, 0x2C, 0x21, 0x44,
+    0xEB, 0x62, 0x83, 0x10, 0x0D, 0x23, 0x98, 0xC2, 0x1B, 0xC6, 0x73, 0x38, 0x77, 0x66, 0x37, 0xFB,
+    0xA5, 0xD8, 0x22, 0x02, 0x2C, 0xF9, 0xCE, 0xD8, 0x33, 0x73, 0x7F, 0xCE, 0x3D, 0xF7, 0x8E, 0x08,
+    0x9F, 0x16, 0xF8, 0x06, 0x87, 0x45, 0x18, 0xB0, 0x60, 0x97, 0x69, 0x6B, 0x30, 0x37, 0x51, 0x86,
+    0x28, 0x6E, 0x16, 0x2C, 0xBD, 0x97, 0x2E, 0x55, 0x10, 0x99, 0xFC, 0xB0, 0x4A, 0x03, 0x2E, 0x89,
+    0x09, 0xD3, 0x28, 0x82, 0x17, 0x5E, 0xA4, 0x3B, 0x12, 0x75, 0x58, 0x2C, 0x22, 0x35, 0x4F, 0x8B,
+    0xF4, 0x50, 0xA5, 0xCE, 0xAB, 0xE6, 0x43, 0xA7, 0x76, 0xD1, 0xBF, 0xFC, 0xFE, 0xB8, 0xE1, 0xD6,
+    0xF6, 0x57, 0xDD, 0xEA, 0xA0, 0x47, 0x41, 0x55, 0x32, 0xE9, 0xF9, 0xEA, 0x52, 0xF2, 0xF3, 0xE0,
+    0x53, 0x51, 0x3D, 0xF9, 0xF0, 0x99, 0x14, 0x73, 0x8F, 0x1C, 0x02, 0xC5, 0x23, 0x20, 0x48, 0x05,
+    0x3E, 0x23, 0x63, 0xF9, 0x1B, 0x9B, 0x39, 0x8C, 0x77, 0xC1, 0x7A, 0xE3, 0x4D, 0x9C, 0x36, 0xE3,
+    0xFB, 0xC3, 0xAD, 0xC6, 0x77, 0x87, 0x5B, 0x8C, 0x6F, 0x13, 0xCE, 0x64, 0xF9, 0x3F, 0x71, 0x67,
+    0x1F, 0x6D, 0x30, 0x7E, 0xD8, 0x4D, 0xE2, 0x59, 0xDF, 0xA9, 0xB6, 0x45, 0x75, 0xA6, 0xAC, 0x7F,
+    0xBD, 0xB5, 0x75, 0x9F, 0x0F, 0x35, 0x34, 0xAC, 0x36, 0xCB, 0xEA, 0x74, 0x1A, 0x4B, 0x38, 0x3D,
+    0xA2, 0xC5, 0xB7, 0x38, 0x5A, 0xAC, 0x26, 0x11, 0xCE, 0x0A, 0xCB, 0x34, 0x8B, 0x89, 0x84, 0xA4,
+    0x82, 0xE3, 0xD6, 0xA1, 0xE0, 0xA6, 0xEA, 0xAD, 0xCF, 0x38, 0x66, 0xB1, 0x71, 0xE5, 0x17, 0x5A,
+    0x1E, 0x36, 0xB7, 0xC9, 0x40, 0xFF, 0x69, 0xA4, 0xC6, 0xD5, 0x84, 0x97, 0xC0, 0x80, 0x2D, 0x5B,
+    0x11, 0x05, 0xF0, 0x18, 0xB0, 0x03, 0x3F, 0x02, 0x8F, 0xB1, 0xB5, 0x98, 0xDB, 0xA4, 0x6A, 0x34,
+    0x83, 0xF2, 0xDE, 0xD3, 0x0C, 0xE0, 0x6F, 0x4E, 0xE5, 0x1F, 0x2A, 0x4A, 0xEE, 0xD4, 0x33, 0xCD,
+    0x38, 0x7D, 0x51, 0x9B, 0x75, 0x9E, 0x9A, 0x59, 0x65, 0x86, 0x83, 0x99, 0xFC, 0x09, 0x70, 0x74,
+    0x2C, 0x19, 0x88, 0x0B, 0x54, 0x35, 0x6D, 0x67, 0x02, 0xD9, 0xC2, 0x38, 0x6D, 0x04, 0x88, 0x61,
+    0x65, 0xF1, 0x48, 0x05, 0x13, 0xFF, 0x8E, 0xA8, 0xDC, 0xB5, 0xC2, 0x01, 0x0D, 0x1F, 0x05, 0x3D,
+    0x7E, 0xFE, 0x85, 0x38, 0xE1, 0x95, 0xC6, 0x38, 0xC0, 0x4F, 0x41, 0x89, 0xB8, 0xB6, 0x51, 0x30,
+    0xDA, 0x8D, 0x94, 0xB4, 0x6B, 0x4F, 0xBE, 0x2E, 0x7D, 0x20, 0xB1, 0x8C, 0x6F, 0x0E, 0x21, 0x02,
+    0xEF, 0xBF, 0x38, 0x69, 0xB4, 0xB8, 0xCA, 0x91, 0x03, 0xB6, 0x0C, 0xCB, 0x8D, 0x0B, 0xE4, 0x28,
+    0x60, 0xE0, 0x81, 0x17, 0xF8, 0x13, 0xA0, 0xF9, 0x61, 0x6F, 0xC9, 0xB3, 0xA2, 0xE9, 0x56, 0xC5,
+    0x7F, 0xF0, 0x59, 0xE1, 0x1D, 0x37, 0x5E, 0x95, 0x21, 0x16, 0x2F, 0x5C, 0x71, 0xA7, 0xDD, 0xCB,
+    0xA7, 0xCD, 0xF8, 0x4B, 0x13, 0x6E, 0x3E, 0xCB, 0x50, 0xF9, 0xF2, 0x37, 0x7B, 0x6F, 0xF5, 0x2C,
+    0xA7, 0x04, 0xD5, 0x7E, 0x8D, 0x91, 0x7B, 0x0D, 0x77, 0xDB, 0x8A, 0xD3, 0xCA, 0x1B, 0xA4, 0x51,
+    0x0B, 0x86, 0x0C, 0x33, 0xA5, 0x76, 0x46, 0x1E, 0x31, 0xA1, 0x8B, 0x3A, 0x75, 0x77, 0x53, 0xCC,
+    0x2C, 0x4F, 0x56, 0xA0, 0x55, 0x3A, 0xB4, 0xF9, 0xC0, 0xD9, 0x93, 0x39, 0x9F, 0xD9, 0xA2, 0x96,
+    0xBE, 0xC3, 0x05, 0x8F, 0x6C, 0x5A, 0xF3, 0x35, 0x46, 0xB5, 0xD6, 0x1D, 0x32, 0xAD, 0x5A, 0x1F,
+    0x34, 0x75, 0x25, 0x6E, 0xA5, 0x82, 0x5D, 0x97, 0x68, 0x32, 0x2F, 0x59, 0xAF, 0x4B, 0xB4, 0xC7,
+    0xA5, 0xA3, 0x46, 0x3E, 0xD5, 0xC5, 0xB2, 0xB4, 0x0D, 0xA1, 0xA5, 0xE6, 0x0A, 0x3B, 0x01, 0x09,
+    0x96, 0x55, 0x4D, 0xE3, 0x85, 0x37, 0xF2, 0x96, 0x1D, 0x91, 0x05, 0xA6, 0x8D, 0xE9, 0xBA, 0xB4,
+    0x1A, 0x0D, 0x2E, 0x5B, 0x34, 0xA5, 0x13, 0x44, 0xC5, 0x74, 0x56, 0x3B, 0xAA, 0xB7, 0x3D, 0x2A,
+    0x64, 0x6B, 0xFA, 0x83, 0x51, 0x85, 0xA2, 0xF8, 0x56, 0xE5, 0x47, 0x97, 0xCA, 0xE5, 0x5D, 0x19,
+    0xBA, 0x4C, 0xBF, 0x63, 0x37, 0x73, 0x87, 0x7A, 0x14, 0x2D, 0x4D, 0xB3, 0xCB, 0xE9, 0x59, 0x52,
+    0x10, 0x96, 0x4E, 0xF7, 0x5F, 0x7E, 0xC1, 0x3C, 0xB4, 0xA9, 0x65, 0x9C, 0x9F, 0x90, 0xD2, 0x2F,
+    0x0F, 0xC6, 0x86, 0x37, 0xF0, 0x64, 0xAF, 0x56, 0xD1, 0xCA, 0x06, 0x50, 0x74, 0x3E, 0xBF, 0xA0,
+    0xCA, 0xA5, 0xCD, 0x9E, 0x2F, 0x5C, 0x5D, 0xB4, 0x09, 0x70, 0x13, 0x9D, 0xC5, 0xC2, 0x5A, 0x61,
+    0xD0, 0x62, 0xF7, 0xF6, 0x60, 0x09, 0x9A, 0xD8, 0xA6, 0xA7, 0x49, 0xFA, 0x98, 0x51, 0x3E, 0x1B,
+    0x7E, 0x80, 0x0E, 0xEC, 0x20, 0x79, 0xD0, 0x9D, 0xF9, 0xC0, 0x3C, 0x78, 0x3D, 0xBE, 0xB2, 0xBD,
+    0x31, 0x4D, 0x54, 0x4D, 0x43, 0x24, 0xB2, 0x1A, 0xEA, 0x51, 0x78, 0x71, 0xBA, 0x03, 0x0A, 0xB9,
+    0xA1, 0xCD, 0xEE, 0xDA, 0x05, 0x6A, 0xC0, 0x6C, 0x32, 0xEF, 0xB5, 0x06, 0xB0, 0x58, 0x96, 0xE6,
+    0x6B, 0xCC, 0xB5, 0x1A, 0xA4, 0xF7, 0x3B, 0xD3, 0xC6, 0x7A, 0xB4, 0x2B, 0x2F, 0x01, 0x70, 0xD7,
+    0x10, 0x7A, 0x26, 0x6D, 0x71, 0xD7, 0x43, 0x64, 0xBB, 0xC1, 0x6A, 0xE1, 0x9F, 0x64, 0xAD, 0x1F,
+    0xF0, 0xFD, 0x8A, 0xAF, 0x72, 0xE2, 0x2D, 0xF0, 0xFE, 0x86, 0x95, 0x5F, 0xDE, 0xA5, 0xE9, 0x61,
+    0x06, 0x76, 0x25, 0x43, 0x42, 0x9F, 0x5C, 0xD4, 0x7E, 0x6B, 0xD7, 0x26, 0x4D, 0x4B, 0x03, 0xF7,
+    0xFA, 0x29, 0x5B, 0x07, 0x92, 0xB6, 0x59, 0xFC, 0x7C, 0x7A, 0xA2, 0x34, 0x77, 0xAB, 0xDE, 0x34,
+    0xA4, 0x6A, 0x7A, 0xFC, 0x39, 0xF3, 0x78, 0x74, 0x25, 0x8F, 0x9B, 0x3C, 0x28, 0x66, 0xEB, 0xD8,
+    0x31, 0x72, 0x43, 0xF0, 0x86, 0xD0, 0x44, 0x5E, 0x2B, 0x63, 0xF5, 0xFF, 0xD8, 0xFA, 0x30, 0x23,
+    0x37, 0xAA, 0x42, 0x8D, 0x4E, 0x45, 0xA3, 0xE2, 0x33, 0x7C, 0x3F, 0x6B, 0x16, 0xD7, 0x32, 0x6B,
+    0xCA, 0x42, 0x2E, 0xBC, 0x87, 0x89, 0x62, 0xCA, 0xF6, 0xE1, 0x55, 0xEC, 0x0D, 0x01, 0x8B, 0xDC,
+    0x62, 0x54, 0xF4, 0x59, 0x1C, 0xF7, 0x09, 0xE2, 0x7B, 0xC1, 0x5B, 0x08, 0x3E, 0x0B, 0xA3, 0xB5,
+    0xAE, 0x55, 0x74, 0x73, 0x31, 0x28, 0x4D, 0xB5, 0x2B, 0x3D, 0x63, 0x4D, 0x56, 0x5A, 0x88, 0x55,
+    0xBE, 0x6D, 0x9F, 0x8F, 0xF2, 0x2F, 0x9E, 0x7F, 0x00, 0xB5, 0x55, 0x3D, 0x8E, 0x1D, 0x45, 0x10,
+    0xAE, 0x9E, 0xD9, 0xDD, 0x11, 0x9E, 0x60, 0x08, 0xEC, 0x84, 0xA4, 0x13, 0x87, 0x88, 0x39, 0x42,
+    0xCF, 0xE3, 0x02, 0x10, 0x80, 0x84, 0x70, 0xC2, 0x09, 0xEC, 0x13, 0xA0, 0x1E, 0x70, 0x40, 0x40,
+    0xC0, 0x06, 0x90, 0x13, 0x38, 0xC0, 0x22, 0xD8, 0x1B, 0xD0, 0x83, 0xB8, 0xC0, 0x20, 0x02, 0x02,
+    0x27, 0x4F, 0xD6, 0x8A, 0xC0, 0x09, 0x13, 0x8C, 0xE5, 0xF1, 0xD2, 0xDD, 0xC5, 0xF7, 0xF5, 0xEE,
+    0x5B, 0x16, 0x24, 0xC0, 0x42, 0xA2, 0x35, 0xDD, 0xAF, 0x7F, 0xAA, 0xAA, 0xAB, 0xBF, 0xFA, 0xAA,
+    0x9E, 0xC8, 0xEB, 0x22, 0xF2, 0x31, 0xBA, 0x8A, 0x98, 0x2C, 0x52, 0x47, 0x91, 0x76, 0x15, 0xE9,
+    0x66, 0xCC, 0x07, 0xB9, 0xD9, 0x82, 0x6A, 0x56, 0xD5, 0x64, 0xD1, 0x9B, 0x6C, 0xD0, 0x85, 0x3D,
+    0xA2, 0x6F, 0xE8, 0xF2, 0x77, 0xDD, 0xEA, 0x23, 0xE8, 0x46, 0x51, 0x74, 0x39, 0x79, 0x3C, 0x60,
+    0xB1, 0xD6, 0xB0, 0xD1, 0xE5, 0x7B, 0xDA, 0x2F, 0x26, 0xBB, 0xBD, 0x6C, 0x1E, 0xD7, 0x05, 0x76,
+    0xCD, 0x90, 0x4B, 0x45, 0xB6, 0xAC, 0xF7, 0x22, 0x1E, 0xEE, 0xB8, 0xBC, 0xBB, 0xDF, 0xE3, 0xFE,
+    0x16, 0x07, 0x46, 0x75, 0x2F, 0xC7, 0xEF, 0x89, 0xBC, 0xF1, 0x48, 0x1A, 0xD5, 0x01, 0x7E, 0x35,
+    0xA9, 0x89, 0xFD, 0xBE, 0x59, 0x74, 0xEC, 0x1E, 0xEA, 0x7C, 0xBB, 0xD5, 0x4D, 0x3A, 0x58, 0x82,
+    0xA7, 0x02, 0x0D, 0x31, 0x1A, 0xDF, 0x12, 0xFF, 0x3C, 0x8A, 0xFF, 0x79, 0x35, 0x6A, 0xD3, 0x83,
+    0xCD, 0xA9, 0x8E, 0x70, 0xA3, 0x98, 0x91, 0x3B, 0x10, 0x18, 0x6B, 0x9D, 0xF0, 0x55, 0x3A, 0xCA,
+    0xE3, 0xC3, 0x83, 0xDF, 0x1F, 0x7A, 0x1D, 0xBD, 0x8E, 0x18, 0xCD, 0xBF, 0x7D, 0x8D, 0x9E, 0x3B,
+    0x8D, 0x8E, 0x4F, 0x14, 0xBF, 0x4B, 0xFA, 0x83, 0xE2, 0x0B, 0x6F, 0xA7, 0xA3, 0x02, 0xF0, 0x7F,
+    0xB7, 0x66, 0xDE, 0x95, 0x2E, 0x8A, 0xCD, 0xFC, 0x30, 0xA9, 0xBE, 0xBE, 0xB2, 0x66, 0x3E, 0x10,
+    0x8D, 0x15, 0xC1, 0x88, 0xDC, 0x7F, 0xF5, 0xCF, 0x6E, 0xE2, 0x56, 0x09, 0x4B, 0xA3, 0x33, 0x3C,
+    0xB1, 0x49, 0x4E, 0x4E, 0x0F, 0xEF, 0x05, 0xC0, 0x3A, 0x4B, 0xA5, 0x97, 0x81, 0xD2, 0xB3, 0x24,
+    0xE4, 0x41, 0x98, 0xF0, 0x93, 0xDA, 0xF8, 0xC7, 0x22, 0x02, 0xD3, 0x51, 0xBA, 0x09, 0xC0, 0x0F,
+    0x06, 0x8B, 0x10, 0xA5, 0x1F, 0xC3, 0x14, 0xE6, 0x7A, 0x6D, 0x63, 0x9D, 0xC5, 0x49, 0x98, 0xDC,
+    0xD3, 0x77, 0x16, 0x2E, 0x5C, 0xC6, 0x22, 0x3C, 0xD1, 0xC9, 0xE6, 0x10, 0xC3, 0x0A, 0x4D, 0x04,
+    0x8B, 0x54, 0x1A, 0x8E, 0x6F, 0x72, 0x0B, 0x97, 0x36, 0x08, 0x58, 0xA7, 0xD1, 0x22, 0x2A, 0x0D,
+    0x1C, 0x23, 0x79, 0x92, 0xF4, 0x88, 0xBD, 0x5D, 0x0B, 0x15, 0xFC, 0x5C, 0xE9, 0x80, 0x48, 0x7D,
+    0x75, 0x4F, 0xF5, 0x14, 0x71, 0x47, 0xDB, 0x23, 0xC0, 0x7A, 0xA1, 0xB3, 0xBF, 0xF8, 0x56, 0x77,
+    0xFA, 0x89, 0x0E, 0x6D, 0xAA, 0xB5, 0x68, 0xB5, 0xB1, 0x68, 0xB9, 0x85, 0x5A, 0x3B, 0xFD, 0x4C,
+    0x67, 0x9B, 0xCF, 0x62, 0xD0, 0xEF, 0xA1, 0xF0, 0x13, 0xEF, 0x02, 0x43, 0x0E, 0xED, 0x4E, 0xB9,
+    0x7F, 0x2D, 0x0C, 0x07, 0xE3, 0x9B, 0x32, 0xAD, 0x39, 0x3D, 0x09, 0x17, 0xDF, 0x14, 0xDE, 0xCF,
+    0x57, 0xD3, 0xB2, 0x2B, 0x6E, 0x29, 0x02, 0x27, 0x79, 0x10, 0xF7, 0x02, 0x5E, 0x83, 0xCC, 0xD0,
+    0x01, 0xA5, 0xC8, 0xA2, 0xD9, 0x45, 0x00, 0x6C, 0xC8, 0xA6, 0xA1, 0xE3, 0x54, 0xFE, 0x79, 0x1A,
+    0x5E, 0x56, 0x0C, 0xF6, 0x12, 0xE8, 0x57, 0x47, 0xE4, 0x0D, 0x9D, 0xAA, 0x41, 0x7C, 0x69, 0x79,
+    0x51, 0xC7, 0xC1, 0xCD, 0xE4, 0xD5, 0x88, 0xE1, 0x3B, 0x9E, 0xDE, 0x95, 0x3F, 0xB7, 0x13, 0x90,
+    0x79, 0xEA, 0x17, 0xD5, 0x29, 0xAC, 0x40, 0x4E, 0xD7, 0x26, 0x55, 0xF9, 0x23, 0x64, 0xC5, 0x06,
+    0x10, 0x61, 0xA0, 0x49, 0x76, 0x62, 0xAE, 0x94, 0x61, 0x8F, 0xAC, 0x7C, 0xC0, 0x3D, 0xDC, 0xDE,
+    0xA4, 0x36, 0x61, 0xA8, 0x15, 0x43, 0xC5, 0x20, 0x0D, 0xBA, 0x87, 0x29, 0xBF, 0x41, 0xD6, 0x32,
+    0xFE, 0xE0, 0x5F, 0xF1, 0xC7, 0xD0, 0x0B, 0xC9, 0x72, 0xF0, 0xA5, 0xE1, 0xA1, 0x78, 0xD2, 0xA1,
+    0x26, 0x5E, 0xF2, 0xA6, 0xFC, 0xB5, 0x21, 0xA6, 0x35, 0x2B, 0xC6, 0xA4, 0xC0, 0x7F, 0x6C, 0x33,
+    0x22, 0x68, 0x74, 0xB0, 0xC0, 0x66, 0x6E, 0x92, 0x51, 0xFC, 0xEE, 0x90, 0xE9, 0xFE, 0xC7, 0x8C,
+    0xCD, 0xE7, 0xC9, 0xCF, 0x4D, 0x8E, 0x3C, 0x8C, 0x30, 0xED, 0x23, 0x25, 0x91, 0xAF, 0x90, 0x44,
+    0xFC, 0xC1, 0x87, 0x56, 0x3F, 0xD7, 0xD8, 0xE9, 0x6F, 0xC5, 0xA6, 0x1C, 0xC9, 0x6D, 0xB8, 0xB0,
+    0xB4, 0xAC, 0x0E, 0xAC, 0x5C, 0xCD, 0x66, 0xE1, 0x9F, 0xD3, 0x74, 0x08, 0x22, 0xB2, 0xED, 0xA6,
+    0x2B, 0x78, 0xF5, 0xA7, 0x9A, 0x9C, 0xAE, 0x3D, 0xBC, 0xD9, 0xC4, 0xEF, 0x6B, 0x84, 0x0A, 0xAC,
+    0x05, 0xFC, 0x23, 0x22, 0x01, 0x84, 0xDA, 0x6C, 0x60, 0xC7, 0x2F, 0xFD, 0x8C, 0x70, 0xB2, 0x08,
+    0xDA, 0xD5, 0xC3, 0x84, 0x7E, 0x01, 0xBB, 0x6D, 0xE2, 0xBB, 0x1D, 0xD0, 0xC3, 0x9B, 0xC8, 0x9B,
+    0x4E, 0x4B, 0x3D, 0x5C, 0xAE, 0x71, 0x70, 0xD3, 0x55, 0xA0, 0xEE, 0xD6, 0xE4, 0xED, 0x2F, 0x14,
+    0x0D, 0x4A, 0xD5, 0xCB, 0x82, 0x40, 0x7D, 0x73, 0x5D, 0x57, 0x90, 0x68, 0x6B, 0xD0, 0x5F, 0x35,
+    0xE2, 0xD7, 0x6F, 0x46, 0xF7, 0xA8, 0x92, 0x6E, 0x41, 0xDA, 0x23, 0x20, 0x74, 0x8D, 0x39, 0xAA,
+    0xD3, 0x2B, 0x6D, 0x7A, 0x90, 0x6E, 0x0B, 0xCC, 0x85, 0x32, 0xCC, 0xD2, 0xD1, 0xBF, 0xAA, 0x38,
+    0x15, 0x38, 0xD8, 0x12, 0xA1, 0x12, 0xBC, 0xC2, 0xF8, 0xA3, 0x12, 0x36, 0x02, 0x65, 0x48, 0x5A,
+    0x3C, 0x28, 0x13, 0x29, 0xD6, 0x5F, 0xEC, 0x0C, 0x25, 0xFB, 0xC9, 0x43, 0x16, 0x01, 0x32, 0x5A,
+    0x17, 0x00, 0x33, 0xB8, 0x87, 0x60, 0x94, 0xE4, 0x76, 0xB6, 0x6B, 0xB5, 0xDE, 0x82, 0xF4, 0xAD,
+    0xB1, 0x48, 0x17, 0x64, 0x4F, 0x59, 0xE2, 0x69, 0xCB, 0x33, 0xAB, 0x0C, 0xF2, 0x90, 0xE4, 0x62,
+    0xE9, 0xB6, 0xA4, 0x39, 0xA4, 0x6B, 0x96, 0xE0, 0xA1, 0xD0, 0x8D, 0xA9, 0x6C, 0x37, 0xAB, 0xA8,
+    0x2F, 0x87, 0xA4, 0xA1, 0x27, 0x7A, 0x5D, 0x84, 0x84, 0x75, 0xA1, 0x25, 0x80, 0x1D, 0x01, 0xAC,
+    0x0A, 0x80, 0x75, 0x01, 0x9C, 0x9B, 0x25, 0xF9, 0x4A, 0xEE, 0x53, 0x75, 0xED, 0x9E, 0xE9, 0xB3,
+    0x54, 0x2F, 0x6E, 0xE9, 0x87, 0xD8, 0xC5, 0x76, 0x7A, 0x0D, 0x92, 0xC3, 0x41, 0x52, 0x5F, 0xD2,
+    0x08, 0xAC, 0xD4, 0x7A, 0xA6, 0xDC, 0xC4, 0xDD, 0x6E, 0x01, 0x42, 0x5D, 0xAC, 0x13, 0x36, 0x2B,
+    0x85, 0xF9, 0x27, 0xE4, 0x16, 0x32, 0x17, 0x0F, 0xCF, 0xD7, 0x9C, 0x39, 0xFE, 0xF2, 0x92, 0xBF,
+    0xFB, 0x52, 0x14, 0x53, 0xA9, 0x01, 0x14, 0x39, 0xB7, 0xE0, 0x2E, 0xB5, 0x16, 0x3C, 0x46, 0xC2,
+    0xDA, 0x03, 0x53, 0x17, 0x91, 0xCD, 0xA0, 0x12, 0x1D, 0xB3, 0xC9, 0x5F, 0x8E, 0xF4, 0x30, 0x85,
+    0x9B, 0x23, 0xF6, 0xBB, 0x58, 0x4E, 0x23, 0xFF, 0xD0, 0xEC, 0x86, 0x3A, 0x81, 0x3A, 0xD0, 0x27,
+    0xB2, 0xAE, 0x03, 0x96, 0x3A, 0xB7, 0x7A, 0xDE, 0xB2, 0x84, 0xC0, 0x93, 0x72, 0xE3, 0x5A, 0x80,
+    0x65, 0xD2, 0x7F, 0x78, 0x2A, 0xFF, 0x4F, 0xFB, 0x1D, 0xB5, 0x55, 0x31, 0x6F, 0xE6, 0x44, 0x10,
+    0x9D, 0xB5, 0x49, 0x2C, 0x61, 0x09, 0x53, 0x00, 0x12, 0x34, 0x6E, 0xE9, 0xFC, 0x13, 0xD6, 0x90,
+    0x02, 0xBA, 0xA3, 0xB8, 0x74, 0x48, 0xD4, 0xD0, 0xD0, 0xD2, 0xD9, 0x54, 0x14, 0x14, 0xA4, 0x80,
+    0x86, 0x9A, 0xE6, 0x42, 0xC1, 0x2F, 0x40, 0xBB, 0x12, 0x05, 0x45, 0x8A, 0xB3, 0x90, 0xD0, 0x15,
+    0x34, 0x96, 0xB8, 0x86, 0x50, 0xC4, 0x08, 0xA3, 0xF3, 0x85, 0xB5, 0x87, 0xF7, 0xC6, 0x5F, 0x48,
+    0x84, 0x8E, 0x0A, 0x61, 0xE9, 0x9B, 0x6F, 0xEC, 0x9D, 0x9D, 0x7D, 0x33, 0xF3, 0x66, 0x56, 0x8E,
+    0xCF, 0x5B, 0x29, 0x54, 0xDB, 0x5C, 0x75, 0x13, 0xFD, 0x31, 0xCC, 0xF5, 0xE4, 0xF4, 0xBB, 0x4D,
+    0xAA, 0xB5, 0x8B, 0xD2, 0xFD, 0x9A, 0x24, 0xDF, 0x82, 0xAA, 0x5E, 0xE1, 0xB7, 0xE9, 0xE5, 0x79,
+    0xE0, 0x97, 0x35, 0x0C, 0xD2, 0x7D, 0xAF, 0x52, 0x26, 0xBF, 0x38, 0x7D, 0x43, 0xAF, 0xC3, 0x58,
+    0xAA, 0x2E, 0x52, 0xE3, 0x27, 0x47, 0xF7, 0x65, 0x7F, 0x5E, 0x85, 0xCB, 0x51, 0xEA, 0xD4, 0xC1,
+    0x71, 0xA1, 0x3F, 0xAB, 0xF6, 0xA2, 0x5B, 0xA1, 0x51, 0x1A, 0x1D, 0x3C, 0xBC, 0xE8, 0xBB, 0x0E,
+    0xEB, 0x38, 0xA5, 0xA2, 0x27, 0x91, 0x30, 0x89, 0x12, 0x4B, 0x5B, 0x4F, 0x22, 0x3E, 0x65, 0x9B,
+    0x88, 0xD3, 0xE8, 0x07, 0x01, 0x96, 0x1C, 0xEB, 0x30, 0xE8, 0x7A, 0xC1, 0xBE, 0x72, 0xC6, 0x8B,
+    0x9F, 0x55, 0x68, 0xF0, 0xD9, 0x88, 0xBF, 0x6A, 0x5B, 0x79, 0x62, 0x80, 0x73, 0x1A, 0x2C, 0x7C,
+    0xF1, 0x70, 0x46, 0x83, 0x49, 0xCC, 0xC0, 0x20, 0x85, 0x28, 0x77, 0x9F, 0xD7, 0xDE, 0x02, 0xA8,
+    0x72, 0xF5, 0x3A, 0xC3, 0x0C, 0xBB, 0xBC, 0xE6, 0xDA, 0x17, 0x3A, 0x36, 0x49, 0xF4, 0x6D, 0xD1,
+    0x58, 0x4D, 0x52, 0x6E, 0x19, 0x5C, 0x77, 0x93, 0x8F, 0xF0, 0x9B, 0xC3, 0x71, 0x3D, 0x07, 0xEC,
+    0xD4, 0x87, 0x70, 0x5B, 0xAE, 0xAB, 0x9D, 0x03, 0xA7, 0x99, 0x9D, 0x59, 0x13, 0x92, 0x28, 0x11,
+    0x15, 0xEB, 0xED, 0x31, 0xAD, 0xBC, 0x43, 0x08, 0x43, 0x35, 0xD0, 0xBC, 0xF7, 0x3D, 0x8D, 0x4E,
+    0x68, 0x90, 0xA9, 0xC1, 0x73, 0xBA, 0xC3, 0x7B, 0x4E, 0xFE, 0xF1, 0x60, 0x7D, 0xAE, 0x54, 0x1F,
+    0xAA, 0xC6, 0x4E, 0xB5, 0xD1, 0x15, 0x21, 0x8E, 0x39, 0x02, 0xAB, 0x13, 0x92, 0x42, 0x5C, 0xC8,
+    0x03, 0x80, 0x45, 0xD1, 0x01, 0x40, 0xA0, 0xA1, 0x8E, 0xB6, 0xE4, 0x95, 0x4B, 0xF9, 0x66, 0x4B,
+    0xFE, 0x11, 0x97, 0x4E, 0x56, 0xDB, 0xE5, 0x07, 0xEE, 0xFA, 0x73, 0x75, 0x5C, 0xD2, 0xA1, 0xE0,
+    0xD2, 0x6A, 0x0E, 0xE1, 0x83, 0x4B, 0xAB, 0xB8, 0xDD, 0xA1, 0x2D, 0xD9, 0x59, 0x9D, 0x8E, 0x80,
+    0xF2, 0x29, 0xCC, 0xBD, 0x2A, 0x90, 0x38, 0xD5, 0x64, 0x00, 0x3D, 0x63, 0x85, 0xBD, 0xBD, 0x94,
+    0xCB, 0xFE, 0x6D, 0x4F, 0xF2, 0x9E, 0x80, 0xC2, 0x0C, 0xE4, 0x79, 0x8B, 0xEE, 0x25, 0x14, 0x67,
+    0x2A, 0x10, 0x71, 0xD7, 0x22, 0x89, 0x45, 0xB2, 0x42, 0xEB, 0x6A, 0x95, 0x63, 0xB1, 0x4E, 0xDB,
+    0xBB, 0xC1, 0x57, 0x9A, 0x2A, 0x5D, 0x50, 0x21, 0x05, 0xC5, 0x86, 0x0C, 0x95, 0x4A, 0xD2, 0xCC,
+    0xA8, 0x21, 0x28, 0x52, 0x26, 0xA7, 0x54, 0x3B, 0xAA, 0xCD, 0x15, 0xD4, 0x8B, 0xDF, 0xA0, 0x6E,
+    0xA9, 0x86, 0x0A, 0x78, 0x6D, 0xA9, 0x91, 0xEA, 0x44, 0x35, 0xA1, 0x68, 0x8E, 0x79, 0x7B, 0x8C,
+    0x3C, 0x32, 0x9B, 0x4B, 0xB5, 0xC3, 0x57, 0x56, 0xA2, 0x32, 0x82, 0x58, 0x01, 0x6A, 0x22, 0x77,
+    0x16, 0x45, 0x0D, 0x37, 0x00, 0xA6, 0x14, 0x01, 0x47, 0x21, 0x13, 0xC6, 0xBD, 0x96, 0xDF, 0x20,
+    0x4D, 0xDC, 0x7E, 0xCB, 0xF5, 0xF2, 0x0C, 0x62, 0xEF, 0x23, 0x1E, 0xF5, 0xA5, 0xCE, 0x58, 0x68,
+    0x12, 0x04, 0xD8, 0x0B, 0x10, 0x7F, 0x8B, 0x8A, 0xDF, 0x6A, 0x88, 0x8F, 0xD1, 0x6B, 0x34, 0x66,
+    0x7B, 0xB5, 0xF8, 0x3D, 0x3E, 0xC4, 0x7D, 0x74, 0x60, 0x6D, 0x40, 0x56, 0x4B, 0x2A, 0x19, 0xD3,
+    0xDB, 0x1C, 0x94, 0x82, 0x94, 0x41, 0x09, 0x6E, 0xBF, 0xDC, 0x51, 0x74, 0x6B, 0x33, 0xF6, 0x71,
+    0xB3, 0xE9, 0x9C, 0x21, 0x0D, 0xB1, 0x99, 0xAA, 0x84, 0xA5, 0x1B, 0xC5, 0x69, 0x1F, 0xAE, 0x75,
+    0xC2, 0xF6, 0xB5, 0xB4, 0xD0, 0xF6, 0xE7, 0x54, 0x5C, 0xD8, 0x99, 0xA6, 0xA9, 0xA1, 0xC8, 0xF5,
+    0x4D, 0xBC, 0xAE, 0xA0, 0xB2, 0x87, 0x9F, 0x48, 0x96, 0x18, 0xE8, 0x6A, 0x7D, 0x3D, 0x8C, 0xFE,
+    0x8F, 0x27, 0xC0, 0xFB, 0x03, 0xAD, 0xBE, 0x41, 0x8F, 0x90, 0x0A, 0x60, 0x05, 0x18, 0x73, 0x7D,
+    0x2F, 0xC2, 0xEA, 0x05, 0x63, 0x26, 0x79, 0x29, 0x24, 0xD1, 0x9E, 0x9F, 0x0E, 0x29, 0x2C, 0x39,
+    0x0E, 0x3C, 0xC7, 0x80, 0xBC, 0xEF, 0x1E, 0x48, 0x83, 0xBE, 0x8B, 0x8C, 0x9D, 0x70, 0x74, 0xC9,
+    0x75, 0x08, 0xE9, 0x90, 0x32, 0x36, 0xFC, 0x33, 0xC5, 0x31, 0x93, 0x57, 0xDD, 0x83, 0x28, 0xAF,
+    0xB0, 0xE3, 0x44, 0x27, 0xA6, 0x7B, 0xB8, 0x49, 0xFC, 0x86, 0xC3, 0xBE, 0x78, 0x0F, 0x42, 0xCA,
+    0x1E, 0xC2, 0x51, 0x3B, 0x00, 0x68, 0x58, 0x71, 0x4F, 0xF1, 0xF2, 0xE9, 0xFD, 0x5B, 0x8E, 0x2D,
+    0x87, 0xAA, 0x67, 0xE4, 0x83, 0xBF, 0x60, 0xEC, 0xF8, 0xE9, 0xC5, 0x8E, 0xE8, 0xF2, 0xBC, 0xF5,
+    0xF3, 0xC1, 0xC1, 0x7F, 0x51, 0x7A, 0x14, 0x14, 0xA9, 0x40, 0xB0, 0x20, 0xB5, 0x8D, 0x07, 0x4E,
+    0x84, 0x7C, 0xDC, 0xCF, 0x46, 0x2B, 0xA0, 0x4F, 0xF7, 0x11, 0xFB, 0x09, 0x82, 0x28, 0xC0, 0xC5,
+    0x1A, 0xC0, 0xBA, 0x11, 0xDB, 0x7A, 0xF9, 0xF7, 0xD7, 0x42, 0x7F, 0x81, 0x4F, 0x24, 0x03, 0x8C,
+    0x60, 0x22, 0x9F, 0x10, 0xFA, 0x4F, 0x14, 0xA8, 0xC5, 0xD7, 0x46, 0xBD, 0x09, 0xB5, 0x68, 0x22,
+    0x50, 0x04, 0xD4, 0xC2, 0x91, 0x92, 0xCE, 0xCA, 0x73, 0xD4, 0x3D, 0xBD, 0xCF, 0x5A, 0x4C, 0x24,
+    0x72, 0xFF, 0xAC, 0x8A, 0xDD, 0xF9, 0x44, 0x9C, 0x20, 0x4B, 0xC6, 0x4A, 0xDF, 0xE0, 0x27, 0x35,
+    0x95, 0x43, 0x5D, 0x17, 0x90, 0x78, 0x03, 0x32, 0xDF, 0x76, 0x63, 0x35, 0xD4, 0x0B, 0x3A, 0x7C,
+    0x93, 0x8F, 0x5E, 0xD1, 0xCF, 0x69, 0x1B, 0xED, 0x0E, 0x28, 0x6C, 0x94, 0xF7, 0x06, 0xDA, 0xC0,
+    0xD7, 0xFA, 0x15, 0x2A, 0x62, 0xD9, 0x88, 0x06, 0x7D, 0x24, 0xF7, 0xB6, 0x5D, 0x15, 0xFF, 0xF4,
+    0x03, 0x56, 0xB2, 0xC5, 0xBC, 0x04, 0x80, 0x95, 0x6A, 0x19, 0xA9, 0xBE, 0xB8, 0x43, 0x83, 0x7A,
+    0xDA, 0x5A, 0xB7, 0x71, 0xE8, 0x01, 0x7F, 0x6E, 0x9B, 0xFD, 0x72, 0x6C, 0x4D, 0x87, 0x2B, 0x06,
+    0xB6, 0xD6, 0x7A, 0x9C, 0x7D, 0xB3, 0x31, 0xC7, 0xD4, 0x05, 0x2A, 0xEF, 0x28, 0xD6, 0x37, 0x56,
+    0xA8, 0x74, 0x72, 0x76, 0x63, 0x34, 0x0C, 0xB3, 0xD8, 0xEF, 0x13, 0xC4, 0xEF, 0xC2, 0xC2, 0xE9,
+    0xC3, 0x04, 0xD8, 0x60, 0x06, 0x59, 0x6F, 0xA6, 0x31, 0x47, 0x87, 0x0D, 0xCD, 0xF3, 0xD0, 0x16,
+    0x49, 0xBE, 0x15, 0xDC, 0x96, 0x68, 0xC7, 0xE8, 0xF6, 0x19, 0x58, 0x6C, 0xE1, 0x0C, 0xC1, 0x81,
+    0xEC, 0xE0, 0x34, 0xAE, 0xC6, 0x36, 0xCC, 0xB0, 0x0A, 0x23, 0x06, 0x1D, 0x26, 0x38, 0x92, 0x51,
+    0xE8, 0x59, 0x95, 0x70, 0x4D, 0x35, 0xBF, 0xB3, 0x48, 0x51, 0x76, 0x86, 0x56, 0xA4, 0x61, 0x77,
+    0xF3, 0xE6, 0xD1, 0xCE, 0x1F, 0x02, 0x70, 0x66, 0xBD, 0xFF, 0x40, 0xFE, 0xD7, 0xE7, 0x2F, 0xD5,
+    0x55, 0x3D, 0xAF, 0xDD, 0x44, 0x10, 0x5D, 0xDB, 0xBA, 0xB1, 0x88, 0x25, 0xB6, 0x81, 0x20, 0xD1,
+    0x6C, 0x43, 0x41, 0x83, 0xFC, 0x13, 0xD6, 0x49, 0x0A, 0xCA, 0x47, 0x41, 0x89, 0xF4, 0x52, 0x50,
+    0x40, 0xF5, 0x5A, 0x0A, 0xA4, 0x35, 0xFF, 0x20, 0x15, 0xA4, 0x4C, 0x8B, 0xF8, 0x0D, 0x68, 0x0D,
+    0x0D, 0x05, 0x05, 0x46, 0x48, 0xA4, 0x8C, 0x85, 0x22, 0xA4, 0x88, 0x66, 0x11, 0x2E, 0xFC, 0xC2,
+    0xAE, 0x87, 0x73, 0xC6, 0xEF, 0xF2, 0x51, 0xD1, 0xD0, 0x60, 0xE9, 0x8E, 0xE6, 0xEE, 0xC7, 0x7C,
+    0x9C, 0x39, 0x33, 0x6B, 0xDE, 0x31, 0xFC, 0x2A, 0x63, 0x64, 0xEC, 0x44, 0x46, 0xBB, 0x9A, 0xB0,
+    0x35, 0x22, 0x8B, 0x15, 0xD3, 0xCB, 0x10, 0x65, 0xEE, 0x64, 0x6A, 0x25, 0x55, 0x32, 0x35, 0x92,
+    0xCC, 0x93, 0x62, 0x7C, 0x6A, 0xF6, 0x0F, 0x8C, 0xF1, 0x93, 0xCD, 0x95, 0xE0, 0x6A, 0xB7, 0x36,
+    0x62, 0xA8, 0x40, 0xC8, 0x14, 0x06, 0x28, 0x6E, 0xF1, 0xC9, 0x4F, 0x50, 0xEA, 0x72, 0x59, 0xAE,
+    0x66, 0xEE, 0x05, 0x11, 0x5C, 0xC7, 0xE7, 0xA1, 0xEC, 0x54, 0xFA, 0x3D, 0xBE, 0x10, 0x1E, 0x72,
+    0xD9, 0x66, 0x97, 0xA1, 0xD8, 0xBD, 0x91, 0x46, 0x60, 0xA0, 0x53, 0x4B, 0x38, 0xDE, 0xCA, 0xE8,
+    0x13, 0x22, 0x31, 0x8D, 0xA8, 0xBB, 0x05, 0xCA, 0x0C, 0x77, 0xBE, 0x98, 0x1A, 0xE6, 0x18, 0xD9,
+    0x04, 0xA5, 0x16, 0x44, 0x9A, 0x6B, 0x59, 0x8F, 0xC0, 0xBF, 0x97, 0xD5, 0x08, 0x7F, 0xE5, 0xD6,
+    0x43, 0xCD, 0xEE, 0x96, 0x86, 0xA7, 0xDE, 0xA7, 0x1B, 0xC5, 0xA6, 0x1B, 0xA5, 0xD9, 0xCE, 0x7B,
+    0x5F, 0x9E, 0x15, 0x37, 0xDC, 0x28, 0xF5, 0x58, 0xAB, 0x81, 0xF7, 0x01, 0x8E, 0x97, 0xC9, 0x2F,
+    0x0E, 0x11, 0x6E, 0x56, 0x2A, 0x49, 0x5D, 0x81, 0xDF, 0x97, 0xE2, 0x14, 0x26, 0xFF, 0xA3, 0xA9,
+    0x4A, 0x9B, 0x3B, 0x18, 0xEC, 0x52, 0x98, 0x0A, 0xBD, 0xBC, 0x9D, 0xFB, 0x91, 0x41, 0x33, 0x8A,
+    0x23, 0x77, 0xF8, 0xB5, 0x25, 0x3E, 0x41, 0xE6, 0xB5, 0xB4, 0xB9, 0xC7, 0x72, 0x58, 0xC2, 0x84,
+    0x65, 0xCB, 0xBB, 0x3B, 0x56, 0x69, 0x6A, 0x35, 0x31, 0x75, 0x3B, 0xF4, 0x1E, 0x8E, 0xB2, 0x95,
+    0xFB, 0x87, 0xDF, 0x7C, 0xD2, 0x88, 0xC2, 0x11, 0x7C, 0x93, 0x6F, 0x72, 0x19, 0x8F, 0x20, 0xB7,
+    0x7F, 0x46, 0x9D, 0x4C, 0xF5, 0x21, 0xBD, 0xC8, 0x6C, 0x22, 0x30, 0x6F, 0xE1, 0x7C, 0x71, 0x2B,
+    0xED, 0x0F, 0x8D, 0xDC, 0xCD, 0x70, 0xD8, 0x2C, 0x28, 0x62, 0x35, 0x18, 0x06, 0xD5, 0x31, 0xDE,
+    0xB0, 0x00, 0x72, 0x60, 0xE4, 0x58, 0x19, 0x4F, 0xCD, 0x5C, 0xB1, 0x46, 0x3D, 0x3D, 0xF9, 0xF5,
+    0x2D, 0x94, 0xF6, 0x87, 0x0D, 0xE9, 0x5C, 0xAD, 0x58, 0x8A, 0x6B, 0x05, 0x84, 0xF7, 0x88, 0x30,
+    0x61, 0xB9, 0x12, 0x81, 0xFF, 0x3B, 0x91, 0x9E, 0x79, 0xBA, 0x41, 0x66, 0x2F, 0x5F, 0xCE, 0x4C,
+    0x1A, 0xAC, 0x62, 0xFA, 0xF5, 0x7E, 0xC6, 0xF5, 0xCE, 0xE7, 0x58, 0x91, 0x05, 0xAE, 0xB2, 0xBB,
+    0x0E, 0xD9, 0x8D, 0xB6, 0x9C, 0x4C, 0x87, 0x5B, 0x36, 0x9B, 0x57, 0x69, 0x1B, 0x21, 0xF7, 0xB8,
+    0x72, 0x3B, 0x16, 0x96, 0xBE, 0x85, 0xC7, 0x7E, 0x6C, 0xC4, 0xCF, 0x5D, 0xF1, 0x7B, 0xCC, 0xEE,
+    0xC8, 0x66, 0x30, 0xAF, 0xD1, 0xEA, 0xF1, 0xAB, 0x7F, 0x49, 0x38, 0xB5, 0x20, 0x5D, 0x80, 0xF1,
+    0xEE, 0xE1, 0xE6, 0x84, 0xBC, 0x0B, 0xC0, 0x82, 0x1B, 0x30, 0x26, 0xCA, 0x33, 0x1C, 0x00, 0xAD,
+    0x3A, 0x95, 0xF6, 0xFA, 0x21, 0x64, 0x3F, 0xE3, 0xD6, 0x10, 0x46, 0x4A, 0x65, 0xD7, 0xDD, 0x42,
+    0xF9, 0x59, 0xD6, 0xA2, 0x6D, 0x2A, 0x55, 0xFF, 0x62, 0xA7, 0xBC, 0x0F, 0xA7, 0x38, 0x03, 0xBC,
+    0x78, 0x7E, 0xD1, 0xBB, 0x2B, 0xA5, 0xCF, 0x94, 0x4E, 0x8C, 0xDA, 0x1F, 0x9D, 0xA0, 0x75, 0xE0,
+    0x11, 0x7E, 0x37, 0x1A, 0x08, 0xCA, 0xBB, 0x56, 0xE5, 0x01, 0x43, 0x55, 0xFE, 0x92, 0x26, 0xFF,
+    0x4D, 0xBE, 0x41, 0x9A, 0x8E, 0x11, 0x95, 0x4F, 0x20, 0x4B, 0x5C, 0xDD, 0x6E, 0x64, 0x6D, 0x4B,
+    0xBD, 0x3F, 0x68, 0x4B, 0xBB, 0x99, 0xB6, 0x80, 0xB0, 0x6D, 0x71, 0x13, 0xAC, 0x89, 0x8A, 0xC5,
+    0xB4, 0xFB, 0x15, 0xD7, 0x00, 0x5E, 0x5B, 0x50, 0xC6, 0xB6, 0xA0, 0x31, 0x70, 0x43, 0x26, 0xB7,
+    0x0F, 0x8C, 0x62, 0x0A, 0x08, 0x02, 0x4C, 0x62, 0x55, 0x76, 0x6D, 0x46, 0xBA, 0xCE, 0x7F, 0xFA,
+    0x54, 0xF1, 0x91, 0x7A, 0x47, 0xF0, 0x32, 0x57, 0xC8, 0x0D, 0x41, 0xFB, 0xDC, 0xC9, 0x8E, 0x85,
+    0x89, 0xAD, 0xC8, 0xFF, 0x28, 0xCC, 0xCF, 0x28, 0xC3, 0xC0, 0x4E, 0xF1, 0x6B, 0x0A, 0x44, 0xE4,
+    0x82, 0xFD, 0xE3, 0xD7, 0x5F, 0x15, 0xB6, 0x4B, 0x12, 0xD3, 0x9F, 0x71, 0x23, 0xAB, 0xFC, 0x8B,
+    0xDF, 0x15, 0xD6, 0x0B, 0x12, 0x1D, 0xC7, 0x14, 0xB9, 0x0B, 0xBB, 0x1F, 0x06, 0x14, 0x3A, 0x74,
+    0x34, 0x4D, 0x23, 0x4F, 0xF5, 0x03, 0x52, 0xC9, 0xD8, 0xCA, 0x0C, 0xF0, 0xC0, 0x81, 0x0B, 0x5A,
+    0x89, 0x07, 0xB1, 0xB5, 0xAA, 0xD5, 0xE3, 0x5E, 0x96, 0x5A, 0x2C, 0xCF, 0x71, 0x32, 0x80, 0x09,
+    0x80, 0xF7, 0x51, 0x25, 0x6F, 0xFA, 0xC1, 0x84, 0xEF, 0xEC, 0x64, 0xDC, 0x6F, 0xDF, 0xCE, 0xC4,
+    0x25, 0x91, 0x63, 0x70, 0x14, 0x9E, 0x06, 0x2E, 0x7E, 0x03, 0x74, 0x72, 0x92, 0xA1, 0x92, 0x57,
+    0xFA, 0x04, 0x52, 0x00, 0x89, 0xB0, 0x99, 0x08, 0x78, 0xC0, 0x3E, 0x4F, 0xFE, 0xB2, 0xA9, 0x8E,
+    0xFE, 0xFA, 0x37, 0xE2, 0x60, 0x1D, 0xC4, 0x81, 0xF4, 0x4A, 0x9C, 0xC8, 0x0C, 0x07, 0x45, 0xE0,
+    0xD3, 0xFF, 0x9A, 0x38, 0x4A, 0x16, 0x4C, 0xAF, 0x93, 0xF2, 0x87, 0x7D, 0xCA, 0xE9, 0x59, 0xD3,
+    0x36, 0x24, 0x37, 0x23, 0xE3, 0x46, 0x4A, 0xAF, 0xB3, 0xA5, 0x7C, 0x0A, 0xB2, 0xC1, 0x66, 0x9C,
+    0x60, 0xB2, 0x4F, 0xF6, 0x7A, 0xEC, 0x72, 0x87, 0xEE, 0x10, 0xD6, 0x2C, 0x7E, 0x8D, 0x5B, 0x3D,
+    0x31, 0x61, 0x95, 0xB1, 0x78, 0x89, 0xFF, 0xF1, 0x2B, 0x74, 0x4C, 0x9F, 0x7C, 0x42, 0x03, 0x82,
+    0xA0, 0xB0, 0x49, 0x7C, 0x31, 0xE0, 0x5A, 0x41, 0x63, 0xFF, 0x84, 0x62, 0x68, 0xF3, 0x9F, 0x7B,
+    0xAA, 0x1A, 0x2C, 0x2A, 0x3B, 0x77, 0x7C, 0x1A, 0x30, 0xFC, 0x70, 0x5A, 0xE4, 0x19, 0xCA, 0xE5,
+    0x9F, 0x73, 0x1E, 0x27, 0x9B, 0x3C, 0x26, 0xCC, 0x7B, 0xCD, 0x66, 0x0B, 0x9F, 0x82, 0x42, 0x74,
+    0x06, 0x73, 0xDB, 0xE0, 0xC0, 0xA8, 0x23, 0xA4, 0x67, 0xB4, 0xB6, 0x70, 0x30, 0x10, 0x22, 0x1D,
+    0xBE, 0xA2, 0x83, 0x06, 0x5C, 0x91, 0x59, 0x37, 0xAD, 0xCE, 0x0F, 0xB9, 0xC7, 0x56, 0xE6, 0xCD,
+    0x55, 0x6F, 0x76, 0xA2, 0x9B, 0x86, 0x77, 0xD8, 0xB9, 0xBB, 0x6E, 0xB2, 0xE7, 0xC9, 0x98, 0xC0,
+    0x87, 0x80, 0x01, 0x2D, 0xAC, 0x8B, 0x89, 0x47, 0x33, 0x55, 0x37, 0x8F, 0xDA, 0x63, 0x04, 0x8D,
+    0x67, 0x81, 0x31, 0xD7, 0x32, 0x93, 0x16, 0xB2, 0xFA, 0x4F, 0x10, 0xDB, 0x23, 0x3B, 0x87, 0x39,
+    0x8C, 0x4D, 0x72, 0x2B, 0x5E, 0x84, 0x8F, 0xB5, 0xB1, 0x68, 0x2F, 0xE9, 0xB4, 0xA6, 0x0B, 0x77,
+    0x4D, 0x80, 0xB5, 0xBB, 0xB0, 0x71, 0x8F, 0xAF, 0x52, 0x98, 0x81, 0x96, 0x71, 0x1A, 0x91, 0xB6,
+    0x18, 0x38, 0x9F, 0xC0, 0x5F, 0xC7, 0xB2, 0xE9, 0x23, 0x77, 0x3A, 0x3F, 0x1C, 0xFF, 0x9F, 0xEF,
+    0x0F, 0xCD, 0x55, 0xBD, 0xAE, 0xD6, 0x46, 0x10, 0x5D, 0xDB, 0x5C, 0x2C, 0xF1, 0x15, 0x6E, 0x92,
+    0x82, 0x50, 0xEC, 0x03, 0x50, 0xF8, 0x11, 0xD6, 0xF0, 0x04, 0x29, 0x72, 0xAB, 0x14, 0x3C, 0x40,
+    0x8A, 0xBC, 0x40, 0x84, 0xBF, 0x2B, 0x94, 0x1A, 0x6A, 0x2A, 0x8A, 0x8B, 0xC4, 0x85, 0x82, 0x36,
+    0x9D, 0x0D, 0x4D, 0xCA, 0xAC, 0x94, 0x17, 0xB0, 0x14, 0x02, 0x05, 0x05, 0x16, 0xB2, 0x14, 0xDF,
+    0x64, 0xED, 0xE1, 0x9C, 0x19, 0xDF, 0xCB, 0xAF, 0x02, 0x25, 0x2B, 0x7D, 0xB3, 0xBB, 0x9E, 0xDD,
+    0xF9, 0x39, 0x73, 0x66, 0xBF, 0x4E, 0x96, 0x42, 0x64, 0x14, 0x9B, 0x3A, 0x99, 0x72, 0x91, 0x58,
+    0xC8, 0xDE, 0xF9, 0xC5, 0x15, 0xD2, 0xB8, 0x2A, 0x7D, 0x66, 0xC2, 0x49, 0x4E, 0x18, 0x1F, 0x4F,
+    0xFB, 0xCF, 0x5F, 0x3F, 0xB7, 0x52, 0x2D, 0xCE, 0xCB, 0xEC, 0x3A, 0x99, 0x3B, 0x8D, 0x25, 0x59,
+    0x48, 0xC9, 0x71, 0x54, 0x36, 0xED, 0x66, 0x9B, 0x26, 0x9D, 0x4A, 0x9B, 0x8A, 0xF1, 0xDD, 0xC9,
+    0xDD, 0xB3, 0x23, 0x92, 0x2A, 0x9A, 0xE8, 0x45, 0x8E, 0x64, 0xC8, 0x25, 0x96, 0x30, 0x3F, 0xBB,
+    0x36, 0x66, 0xB2, 0x7F, 0x77, 0x89, 0x40, 0xB1, 0x84, 0xC4, 0xF2, 0x61, 0xF7, 0x89, 0x03, 0x5C,
+    0x66, 0x44, 0xE5, 0xB4, 0xA3, 0x31, 0xA1, 0x5D, 0xA1, 0x87, 0x7A, 0x80, 0xC8, 0x56, 0x2E, 0x7D,
+    0xA4, 0xD4, 0x10, 0xAB, 0x9E, 0xF2, 0x17, 0x4B, 0x41, 0xFE, 0x13, 0x99, 0x70, 0x5C, 0x5E, 0x8A,
+    0x34, 0x35, 0x9D, 0xC8, 0xE0, 0x4A, 0x79, 0xB4, 0x58, 0xDA, 0xE5, 0x84, 0x9C, 0x5D, 0x18, 0x7D,
+    0x0C, 0xC8, 0x44, 0xFA, 0xD6, 0x49, 0x04, 0x14, 0xEE, 0x78, 0x43, 0xC5, 0x55, 0xB0, 0xDE, 0x22,
+    0xAD, 0x40, 0xBF, 0x30, 0xCC, 0x09, 0xBE, 0x37, 0x78, 0x55, 0x1D, 0xA8, 0xD6, 0xDB, 0x6E, 0xBB,
+    0xED, 0xCE, 0x6F, 0x2F, 0x1F, 0xA8, 0x07, 0x55, 0x19, 0xC8, 0x80, 0x44, 0x43, 0xEB, 0xF1, 0x8B,
+    0xC1, 0x32, 0x3A, 0xC7, 0x6D, 0x03, 0x4E, 0x9E, 0xE8, 0xB1, 0xA4, 0x18, 0xD4, 0x3D, 0xF1, 0x38,
+    0xB2, 0x8D, 0xDF, 0xEB, 0x66, 0x34, 0xF8, 0x0C, 0x3F, 0x67, 0x00, 0x1A, 0x6C, 0xCE, 0x20, 0x7C,
+    0x6F, 0xA3, 0x28, 0x3E, 0x73, 0x0A, 0x23, 0xDC, 0xB2, 0x3E, 0xD8, 0x70, 0x34, 0x96, 0x92, 0x2C,
+    0xF4, 0xCF, 0x41, 0x68, 0xE5, 0xEF, 0xC3, 0x96, 0xE5, 0x66, 0xCC, 0x1D, 0x3F, 0x20, 0x9F, 0x1C,
+    0xC6, 0x34, 0xA1, 0x9D, 0xE2, 0x8E, 0x84, 0xEB, 0x8F, 0x8F, 0xDC, 0x3D, 0xB1, 0x23, 0x1A, 0x14,
+    0x8F, 0x10, 0x3C, 0x3D, 0xC2, 0x85, 0x59, 0xF1, 0xD2, 0x98, 0x95, 0x4A, 0x36, 0x2B, 0x75, 0xDA,
+    0xAC, 0x84, 0x71, 0x73, 0x24, 0xD1, 0x8E, 0xE0, 0x3B, 0x02, 0x0A, 0x33, 0x40, 0x05, 0x76, 0xA5,
+    0xAC, 0x2E, 0xBC, 0x46, 0xAB, 0xB4, 0x08, 0x5F, 0xFE, 0x20, 0x48, 0x32, 0x96, 0xEB, 0x06, 0x5F,
+    0x30, 0x4A, 0x22, 0xD7, 0xDE, 0x16, 0xDE, 0x88, 0xEB, 0x2E, 0x4A, 0x34, 0x22, 0x33, 0x49, 0x3D,
+    0xA9, 0xA9, 0x60, 0x7C, 0x77, 0xE7, 0x0C, 0x7B, 0x8D, 0x14, 0x17, 0xC9, 0x18, 0x19, 0x0D, 0x56,
+    0xDC, 0x02, 0x7A, 0x2C, 0x63, 0x26, 0x8D, 0x76, 0x41, 0x1B, 0x0B, 0x7A, 0xF3, 0x93, 0x93, 0x5F,
+    0x8F, 0x55, 0x09, 0xBC, 0xA8, 0x24, 0x37, 0xA0, 0x94, 0xE7, 0x32, 0x50, 0xD9, 0xFB, 0xA4, 0x37,
+    0x73, 0xB9, 0xA6, 0x37, 0xDB, 0x81, 0x4A, 0x24, 0xD1, 0x9E, 0x66, 0x32, 0x14, 0xD2, 0xC9, 0x53,
+    0xA4, 0x22, 0xDA, 0xF4, 0x4D, 0x18, 0x2C, 0x3A, 0xEB, 0xAF, 0xD2, 0x62, 0x2C, 0x64, 0xCB, 0xA5,
+    0xB1, 0x49, 0x03, 0xBE, 0x6A, 0x99, 0x55, 0x5B, 0xF8, 0x27, 0x14, 0x07, 0xF7, 0x2C, 0x45, 0xED,
+    0xC0, 0x6E, 0xA5, 0x06, 0x00, 0x5F, 0x6E, 0x70, 0x67, 0xA8, 0x80, 0x5D, 0xB5, 0x64, 0xAC, 0x29,
+    0x36, 0xA7, 0x68, 0x44, 0x20, 0xDE, 0x4B, 0x5F, 0xCF, 0xE5, 0x92, 0x03, 0xD9, 0x58, 0x03, 0x3D,
+    0xFD, 0xE6, 0x93, 0x47, 0x0D, 0x40, 0xF8, 0x6E, 0xAC, 0x52, 0x86, 0xE8, 0xFA, 0x00, 0xD5, 0x4E,
+    0x55, 0xB3, 0xAA, 0x3A, 0x54, 0x64, 0x87, 0xE6, 0x71, 0x32, 0x56, 0xB3, 0x9F, 0x32, 0x5E, 0xEE,
+    0x50, 0xDA, 0x3E, 0xFC, 0xC3, 0x37, 0x24, 0xB6, 0xDA, 0x01, 0xA7, 0xB2, 0x1E, 0xC4, 0x7C, 0x23,
+    0x56, 0x87, 0xDE, 0x43, 0x52, 0x07, 0xDF, 0xBB, 0x43, 0xA4, 0xF0, 0x40, 0xB3, 0x1A, 0x98, 0x4C,
+    0xFC, 0x06, 0xA1, 0xC6, 0x7A, 0x05, 0x90, 0x5E, 0x60, 0xBC, 0x48, 0x6D, 0x0C, 0xB1, 0xBB, 0x25,
+    0xBB, 0x54, 0x4D, 0x34, 0x0B, 0xD8, 0x50, 0xF0, 0xC9, 0x8F, 0xC2, 0xA5, 0x7D, 0x6D, 0xA3, 0xDC,
+    0x82, 0xFF, 0x32, 0xB5, 0x88, 0xBF, 0x7E, 0x35, 0x3A, 0x99, 0x24, 0x5D, 0x50, 0xF2, 0x46, 0xEB,
+    0x85, 0xEC, 0x30, 0xFB, 0x81, 0x88, 0xDC, 0x77, 0xE0, 0x10, 0xD8, 0x5E, 0xB3, 0x53, 0xD9, 0xAE,
+    0x85, 0x3C, 0xBB, 0x92, 0x90, 0x4C, 0x91, 0xF8, 0xDE, 0xCD, 0x60, 0x5C, 0x3E, 0x91, 0x2D, 0x0D,
+    0x6B, 0xAB, 0x5D, 0x6E, 0xA2, 0xFB, 0x40, 0x90, 0x50, 0xDA, 0x07, 0x21, 0x29, 0x6B, 0x14, 0xDB,
+    0xC1, 0x5D, 0x26, 0xBD, 0xF5, 0x8D, 0xD1, 0x26, 0x9A, 0x49, 0x77, 0x70, 0xC5, 0xB3, 0x8E, 0x3B,
+    0x15, 0xB8, 0xBD, 0xBB, 0x31, 0xB0, 0x52, 0x71, 0x2B, 0xD7, 0x56, 0x56, 0x8C, 0xFC, 0x04, 0x08,
+    0xE8, 0x93, 0x74, 0x5D, 0x5E, 0xAD, 0x7E, 0xAE, 0x12, 0x0A, 0xF2, 0x62, 0x75, 0x6D, 0x3D, 0x11,
+    0x15, 0x7B, 0x42, 0xC0, 0xB2, 0x3A, 0x69, 0x18, 0x19, 0x2A, 0x0B, 0x5C, 0x7F, 0xFC, 0x1D, 0xEE,
+    0x90, 0xE6, 0x9C, 0xB3, 0xB3, 0x7E, 0x86, 0xC5, 0x9B, 0x40, 0x72, 0x76, 0xE5, 0x63, 0x36, 0x99,
+    0xC5, 0xFF, 0xED, 0xF6, 0x5A, 0xCD, 0x8A, 0xFF, 0x5F, 0x2A, 0x6F, 0xFF, 0x7B, 0x63, 0xFD, 0x69,
+    0x09, 0x7D, 0x98, 0xCA, 0x09, 0x8C, 0x8B, 0xFE, 0xCF, 0x09, 0x0E, 0xDA, 0x7C, 0x8F, 0x46, 0x3B,
+    0x3E, 0xEB, 0x19, 0xED, 0x8F, 0x42, 0xA9, 0x56, 0x2D, 0x6F, 0x5B, 0xE9, 0x0B, 0x3F, 0x5F, 0xD4,
+    0x37, 0x23, 0xB0, 0x7B, 0x32, 0xB1, 0xD7, 0xCC, 0xFE, 0x32, 0x6A, 0xE5, 0x64, 0xAB, 0x64, 0x5D,
+    0xDE, 0xFE, 0x4D, 0xD8, 0x33, 0x7D, 0xE9, 0xAC, 0x6B, 0x89, 0x25, 0x45, 0x32, 0xF1, 0x04, 0xEF,
+    0x5C, 0x38, 0xA2, 0xB8, 0x06, 0xE1, 0xC1, 0xFC, 0xC9, 0xE8, 0xFF, 0xFF, 0xA2, 0x24, 0xD3, 0xF4,
+    0x2D, 0xB5, 0x07, 0x55, 0xFB, 0x34, 0xA7, 0xD7, 0x6C, 0x39, 0xFF, 0x83, 0x50, 0xF1, 0x9B, 0xFB,
+    0x6A, 0xC6, 0x1B, 0xAD, 0x95, 0xA1, 0x8F, 0xDD, 0x46, 0x10, 0xC6, 0xE7, 0x9D, 0xA5, 0x33, 0x30,
+    0x58, 0x14, 0x14, 0x35, 0x26, 0xC1, 0xDD, 0x3F, 0x61, 0x9F, 0x54, 0x45, 0x01, 0x01, 0x21, 0x09,
+    0x0E, 0x29, 0x0A, 0x39, 0x52, 0x18, 0x69, 0xDD, 0x1C, 0x08, 0x08, 0x28, 0xC9, 0x1F, 0x10, 0x5C,
+    0x5C, 0x18, 0xC9, 0x3E, 0x1D, 0x28, 0x28, 0x88, 0xD5, 0x82, 0x82, 0x82, 0x1A, 0x04, 0x94, 0x75,
+    0x81, 0x23, 0x39, 0xD2, 0xDA, 0x5F, 0xBF, 0x99, 0x7D, 0x77, 0x97, 0x26, 0x4D, 0xD3, 0x4A, 0x67,
+    0xBD, 0xB7, 0xF6, 0xBC, 0xF5, 0xCE, 0x7C, 0xF3, 0x9B, 0xD9, 0x7D, 0x11, 0x6B, 0x83, 0xB5, 0x47,
+    0x76, 0x58, 0x03, 0xE6, 0x5A, 0x3F, 0x83, 0xF4, 0xDD, 0x0E, 0xA3, 0x40, 0x04, 0xE9, 0x68, 0x13,
+    0x89, 0x73, 0x95, 0x45, 0x7C, 0x6E, 0x66, 0x11, 0xB7, 0xBA, 0x49, 0xA4, 0x86, 0x1F, 0x44, 0x2A,
+    0xC4, 0x4E, 0xF8, 0x12, 0x5F, 0x14, 0xE9, 0x57, 0x1D, 0x43, 0xD6, 0xD1, 0x2F, 0x9F, 0x1D, 0x8F,
+    0x00, 0xFA, 0x71, 0x40, 0xBA, 0x18, 0xF5, 0xAA, 0x81, 0xA7, 0x26, 0xC4, 0x63, 0xC0, 0x22, 0x71,
+    0xAA, 0xD0, 0x31, 0xB6, 0xCF, 0xC2, 0x48, 0x18, 0xDC, 0x2C, 0xCD, 0xB6, 0x63, 0xB8, 0x98, 0xFC,
+    0xC8, 0xF0, 0x2A, 0xAB, 0x9D, 0x55, 0x04, 0xBE, 0xA3, 0x87, 0x26, 0x6F, 0x2A, 0x81, 0x09, 0xD0,
+    0xBD, 0x06, 0x69, 0xB1, 0x57, 0x7D, 0xEA, 0xBC, 0x36, 0x79, 0x71, 0xFC, 0xA7, 0xC7, 0x5E, 0x1F,
+    0x23, 0x33, 0x16, 0xB2, 0xE0, 0xE3, 0xC3, 0x87, 0x7B, 0x9A, 0xFF, 0x0E, 0x66, 0x52, 0x30, 0x21,
+    0x19, 0x98, 0xC5, 0xC0, 0x64, 0x03, 0xB3, 0x15, 0x30, 0xE1, 0x03, 0x30, 0x01, 0xEA, 0xB9, 0x8C,
+    0x37, 0xE2, 0xFA, 0xE0, 0xBA, 0xC1, 0x24, 0x69, 0x56, 0xF9, 0x08, 0x0C, 0xB3, 0xC7, 0x73, 0x7A,
+    0xA8, 0xB3, 0x69, 0xF8, 0xF3, 0x12, 0x8C, 0x43, 0xD1, 0x34, 0xF0, 0x5D, 0xE4, 0xFF, 0x05, 0xA6,
+    0x05, 0xBE, 0x02, 0xA8, 0x72, 0x0E, 0x48, 0x2D, 0xD6, 0x1D, 0x67, 0x5A, 0xD8, 0x82, 0x98, 0x05,
+    0x1D, 0x23, 0x8C, 0x61, 0xD2, 0x15, 0x8D, 0x3A, 0x0E, 0xAB, 0x41, 0x00, 0xCC, 0x2B, 0x66, 0xCB,
+    0x53, 0xCB, 0x24, 0xBB, 0x92, 0x5B, 0x40, 0x67, 0x82, 0x56, 0xCB, 0xBD, 0xD7, 0xDF, 0xE2, 0xB9,
+    0x96, 0xD0, 0xCD, 0x6E, 0x53, 0x94, 0xD2, 0x73, 0x51, 0x3F, 0x54, 0xF4, 0xE0, 0x67, 0x55, 0xDE,
+    0xE2, 0xCD, 0x31, 0xF0, 0x0C, 0x38, 0x83, 0x56, 0x68, 0x69, 0x8B, 0x73, 0xB1, 0x78, 0x5C, 0x3D,
+    0x18, 0xB0, 0x62, 0x58, 0x1D, 0xA4, 0xB2, 0xB0, 0xE2, 0x0B, 0xCB, 0x97, 0x36, 0x3A, 0xE4, 0x80,
+    0x53, 0xAC, 0x35, 0xC6, 0x76, 0xB3, 0xC2, 0x0E, 0x44, 0xD9, 0xE6, 0x30, 0x50, 0x59, 0x4F, 0x1F,
+    0xBE, 0xF4, 0x91, 0xBA, 0x0E, 0xC9, 0x84, 0xDA, 0xC0, 0xD4, 0xFC, 0xAF, 0x14, 0xE6, 0xA7, 0x7E,
+    0x12, 0x9F, 0xDC, 0x4A, 0x55, 0x47, 0xF8, 0x23, 0xE2, 0x1C, 0x38, 0xC1, 0x54, 0xB4, 0xB4, 0xBA,
+    0xA0, 0x32, 0x09, 0x96, 0xBE, 0x57, 0x19, 0xB5, 0xA9, 0x4C, 0xC4, 0x8E, 0x9F, 0xC1, 0xD0, 0xD0,
+    0x82, 0x2E, 0xC5, 0xDC, 0xAA, 0x39, 0xA6, 0x5C, 0x43, 0x42, 0x0D, 0x37, 0xC4, 0x54, 0xA5, 0x62,
+    0xDE, 0xA2, 0xB9, 0x8F, 0x49, 0x0B, 0x4B, 0x7A, 0x62, 0xDF, 0xEB, 0x36, 0x67, 0xB9, 0xA9, 0x8F,
+    0xD0, 0x6B, 0xF4, 0x76, 0xD3, 0xFA, 0xEA, 0x55, 0xBA, 0xAF, 0xDA, 0x0A, 0xB8, 0x30, 0x16, 0x73,
+    0x2D, 0xA6, 0x37, 0xD0, 0xB2, 0x2B, 0xA4, 0xC5, 0x75, 0xE5, 0xFE, 0x75, 0xB9, 0xB1, 0xB1, 0xF0,
+    0xA3, 0x32, 0x46, 0x8E, 0x38, 0x7D, 0x8B, 0xDF, 0xCF, 0xD8, 0x17, 0x6E, 0x79, 0xE5, 0x96, 0x2A,
+    0xE1, 0xF9, 0x80, 0xEE, 0x4B, 0xB7, 0xFC, 0xE0, 0xD8, 0x8C, 0xAC, 0x3F, 0x3F, 0x7C, 0xFA, 0xEF,
+    0x86, 0xA9, 0x7B, 0x27, 0x45, 0xA2, 0xB3, 0x5B, 0x51, 0x64, 0x7A, 0x77, 0x45, 0x6E, 0x5B, 0xD4,
+    0x16, 0x75, 0xAE, 0x68, 0x7D, 0x12, 0xB0, 0xB2, 0x5D, 0xEE, 0x5A, 0x05, 0xD8, 0xC0, 0xEC, 0x9D,
+    0x55, 0x37, 0x11, 0xAB, 0xC8, 0xFA, 0x0B, 0x6B, 0xD7, 0x7E, 0xD2, 0xE0, 0x13, 0x3F, 0xC2, 0x16,
+    0xA6, 0xD1, 0xE0, 0x62, 0x43, 0x6B, 0xBD, 0x7B, 0x33, 0xE4, 0xF1, 0x8B, 0xD2, 0x88, 0xAE, 0x00,
+    0xFA, 0xA4, 0xC1, 0xC5, 0x9D, 0x5C, 0xEC, 0x3C, 0xDB, 0x85, 0x57, 0xDD, 0xDB, 0x97, 0xEE, 0x5D,
+    0x3E, 0xD3, 0xBD, 0x1E, 0x33, 0xF0, 0x93, 0xE2, 0x9D, 0x62, 0x66, 0x93, 0xD6, 0x1B, 0xCF, 0x84,
+    0x1D, 0xBA, 0x56, 0xCF, 0x06, 0x1A, 0x6D, 0xA6, 0x51, 0x61, 0x1F, 0x27, 0x15, 0xB7, 0xE8, 0x49,
+    0x42, 0x2A, 0x27, 0x16, 0x98, 0x6F, 0x28, 0x1E, 0x0D, 0x51, 0x2B, 0xAA, 0x63, 0xA2, 0xA4, 0x43,
+    0xCA, 0x38, 0x9C, 0x37, 0x26, 0xA5, 0x50, 0xD4, 0x23, 0xA4, 0xC0, 0xAB, 0xD2, 0x7B, 0x00, 0x1F,
+    0x01, 0xF7, 0x80, 0x5F, 0x80, 0x6F, 0x99, 0x7F, 0x03, 0xE6, 0xB2, 0x3F, 0x50, 0x62, 0x47, 0x85,
+    0xF9, 0x00, 0xAE, 0x3E, 0x4C, 0x9C, 0x25, 0x4E, 0x84, 0xF9, 0x49, 0xD0, 0xED, 0xFB, 0x88, 0x13,
+    0x56, 0xBF, 0xFD, 0x81, 0x9E, 0x1A, 0xCC, 0xF0, 0xB8, 0xBF, 0xAF, 0x70, 0xEA, 0x73, 0x3D, 0xB3,
+    0x77, 0xC9, 0x78, 0xDD, 0x0E, 0xF3, 0x15, 0xB5, 0xCA, 0x0E, 0xF3, 0x46, 0xF3, 0x50, 0xA1, 0xA3,
+    0x11, 0x9C, 0x2F, 0x68, 0xF4, 0xF8, 0x0D, 0xD9, 0x23, 0x45, 0x26, 0xAE, 0x34, 0x42, 0x22, 0x00,
+    0x97, 0xED, 0xA4, 0x64, 0xAE, 0xDF, 0x80, 0x07, 0xC8, 0x17, 0xDC, 0xC7, 0xBD, 0x52, 0x77, 0xD6,
+    0x30, 0x27, 0x9B, 0x92, 0xD7, 0x1F, 0xA5, 0xBE, 0x9F, 0x2D, 0x82, 0xD1, 0x78, 0x63, 0xFE, 0xF7,
+    0xEA, 0x7E, 0xE8, 0x71, 0x38, 0xBD, 0xF7, 0x56, 0x36, 0xA3, 0xB1, 0x5D, 0xA9, 0x39, 0x94, 0xF5,
+    0xEF, 0x32, 0xEF, 0x7C, 0xAF, 0xE7, 0xEE, 0x65, 0x7F, 0x4C, 0x16, 0x2E, 0x73, 0xA2, 0x6B, 0xB4,
+    0x89, 0x47, 0xFD, 0x43, 0xBA, 0x64, 0x54, 0x19, 0x23, 0x29, 0xF0, 0x82, 0x4D, 0x50, 0x35, 0x63,
+    0x70, 0xC2, 0x63, 0x61, 0xBA, 0xAC, 0x0C, 0x23, 0xBF, 0x86, 0x1E, 0x30, 0x87, 0x7F, 0x83, 0xEB,
+    0xBB, 0xFE, 0x02, 0xD5, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xB6, 0x93, 0xB5, 0x22, 0x17,
+    0xD3, 0x64, 0x25, 0x50, 0x8A, 0xF9, 0x09, 0xFE, 0x09, 0xF3, 0xA2, 0x08, 0x6D, 0x99, 0x14, 0x59,
+    0xA5, 0x0C, 0x45, 0x0A, 0xA8, 0xF6, 0x27, 0xF8, 0x09, 0x0A, 0x0A, 0x0A, 0xB6, 0xA0, 0x4F, 0x9D,
+    0x97, 0x22, 0x0D, 0xFD, 0x58, 0xE2, 0x07, 0x60, 0x84, 0x44, 0x5A, 0x17, 0x81, 0x48, 0xA9, 0x06,
+    0x61, 0x09, 0xEF, 0xCA, 0xE3, 0xCB, 0x39, 0xD7, 0x2F, 0xD2, 0x92, 0x0A, 0x8A, 0x14, 0x78, 0xF7,
+    0xCD, 0xCC, 0x9B, 0xF1, 0xDC, 0x73, 0xEE, 0xB9, 0x1F, 0x4F, 0x4E, 0x45, 0xA4, 0xD4, 0x09, 0x63,
+    0xD4, 0x9D, 0x48, 0x63, 0xCB, 0x8A, 0x4B, 0x09, 0x37, 0x96, 0xC9, 0x96, 0xC5, 0x0B, 0x2C, 0xFF,
+    0xD0, 0x8C, 0xA5, 0x6A, 0x92, 0x80, 0x71, 0x5F, 0xE9, 0x9B, 0x6E, 0x91, 0x30, 0x17, 0xDA, 0xE3,
+    0x5D, 0xB7, 0xF0, 0xDA, 0xBF, 0x5E, 0xC6, 0xAB, 0x52, 0xDF, 0x04, 0x4D, 0x51, 0x7F, 0x51, 0x75,
+    0xBA, 0x00, 0xA5, 0xF8, 0x52, 0x38, 0xAA, 0x0E, 0xC4, 0x25, 0xCC, 0x11, 0xCD, 0x30, 0xC6, 0xA2,
+    0xD4, 0x3D, 0xA0, 0x66, 0xBF, 0x80, 0xF6, 0xC3, 0x11, 0x6F, 0xD5, 0x39, 0x3C, 0x50, 0x11, 0x7F,
+    0xB5, 0x62, 0x4F, 0xBA, 0xB7, 0xAA, 0xD7, 0x87, 0x97, 0xFA, 0x9D, 0xF2, 0xC9, 0xDE, 0xA6, 0xE9,
+    0x24, 0xAE, 0x87, 0xC3, 0x61, 0x2F, 0x91, 0x7E, 0xE0, 0x62, 0xCF, 0xA9, 0x36, 0xD7, 0xC4, 0x29,
+    0x47, 0x09, 0xAB, 0x4D, 0x1D, 0xBE, 0x7D, 0x22, 0xA2, 0xFA, 0xEE, 0x55, 0xE2, 0xA4, 0x7C, 0x97,
+    0x96, 0xEC, 0x4C, 0xF7, 0x98, 0x6E, 0x9F, 0xF3, 0x5E, 0x71, 0x30, 0xB9, 0x32, 0x0D, 0xE8, 0x70,
+    0xCB, 0xAD, 0xAF, 0x16, 0x5F, 0x2F, 0xE0, 0xF4, 0xE3, 0x2A, 0xE1, 0x6D, 0x82, 0x7B, 0x79, 0xD5,
+    0xDF, 0x9E, 0x28, 0x45, 0xD2, 0x6F, 0x38, 0x8C, 0xB5, 0x9E, 0x9F, 0x3F, 0x92, 0x48, 0xF0, 0x76,
+    0x36, 0x02, 0x44, 0xD4, 0xAB, 0xCF, 0x7E, 0x10, 0x4F, 0x84, 0x12, 0x2F, 0x89, 0xDC, 0x53, 0x32,
+    0x39, 0x7D, 0x2C, 0xFF, 0x0B, 0x31, 0xEA, 0xED, 0x4D, 0x37, 0xD9, 0xD4, 0x0E, 0x36, 0x45, 0x1B,
+    0x8B, 0xC5, 0xA6, 0x6A, 0xB4, 0xE9, 0xC4, 0xEC, 0x7F, 0x34, 0xD5, 0xBC, 0xA9, 0xD6, 0x5A, 0x9E,
+    0x1A, 0xAE, 0xF1, 0x0A, 0xA4, 0xD8, 0x90, 0x54, 0x61, 0xCE, 0xDE, 0x65, 0x9A, 0xAF, 0xB8, 0x15,
+    0x75, 0xAE, 0x98, 0xBB, 0xFF, 0xED, 0xDF, 0xF3, 0xE2, 0xBA, 0xF9, 0x7F, 0x57, 0x6E, 0x99, 0x5F,
+    0xE2, 0x7B, 0x6F, 0x0A, 0x4A, 0x93, 0x9A, 0xB4, 0x39, 0xAE, 0xF5, 0xE6, 0x3A, 0x42, 0xB6, 0xC9,
+    0x03, 0x92, 0x59, 0x8E, 0xCF, 0x4E, 0xFE, 0xF1, 0x3C, 0xDA, 0xAE, 0xC0, 0xA3, 0x7D, 0x03, 0x49,
+    0x21, 0x64, 0x07, 0x6A, 0x3A, 0x22, 0x12, 0xAD, 0xEE, 0xA2, 0x0E, 0x8D, 0xF6, 0xB5, 0x26, 0x2B,
+    0xAF, 0x24, 0xAF, 0x33, 0x6A, 0xB1, 0x5A, 0xBF, 0x80, 0xE9, 0xDE, 0x2D, 0x05, 0xA5, 0x68, 0xA6,
+    0x4A, 0x65, 0xD3, 0x04, 0x75, 0xD5, 0xD1, 0xBC, 0x1F, 0x43, 0x0A, 0x24, 0x55, 0xE6, 0xA7, 0xF9,
+    0x62, 0xD8, 0x42, 0x69, 0x69, 0x63, 0x59, 0xB4, 0x91, 0x6A, 0xD7, 0x78, 0x6D, 0xB1, 0xF7, 0x8B,
+    0x5B, 0x98, 0x2D, 0xE2, 0xD6, 0x4A, 0xAB, 0xAD, 0x0B, 0xD0, 0x52, 0xA2, 0xD6, 0xFB, 0x90, 0x98,
+    0x13, 0x95, 0x1A, 0xDC, 0x88, 0xC5, 0x00, 0xB8, 0x40, 0xD9, 0x93, 0x90, 0x59, 0x8F, 0x05, 0x42,
+    0xB0, 0x8B, 0x88, 0xE2, 0xB4, 0x11, 0xFF, 0x19, 0x4D, 0x44, 0xF9, 0x59, 0x4E, 0x2E, 0xB7, 0xD8,
+    0x7F, 0xCF, 0xB2, 0xC1, 0x1F, 0x29, 0xCD, 0x95, 0xE5, 0x4A, 0xE8, 0x2D, 0x38, 0x55, 0x6E, 0xEC,
+    0xAB, 0x57, 0x3D, 0xA6, 0xDC, 0x26, 0xE6, 0xE9, 0x0D, 0x99, 0x4A, 0xB3, 0xF2, 0x0C, 0x0A, 0x05,
+    0xED, 0xC3, 0xE8, 0x41, 0x73, 0x76, 0x5A, 0x68, 0x6A, 0x32, 0xC0, 0xEF, 0xC4, 0xBE, 0xEB, 0xC3,
+    0xAF, 0x52, 0xE4, 0x7A, 0x61, 0x00, 0x9A, 0xD4, 0xF5, 0x14, 0x3B, 0x9C, 0x2D, 0xED, 0x7E, 0xAB,
+    0x97, 0xE9, 0x28, 0x00, 0x4C, 0xBB, 0x1C, 0x5F, 0xAF, 0x8C, 0x47, 0xBD, 0xB4, 0xD8, 0xEE, 0xC6,
+    0xAE, 0xC7, 0xB6, 0xE3, 0xDD, 0x95, 0xB5, 0x00, 0x53, 0x13, 0x2A, 0xA3, 0x59, 0xB1, 0x6E, 0x01,
+    0xB4, 0x38, 0x7D, 0xB0, 0xE1, 0xCE, 0xB7, 0x8D, 0xD2, 0xE3, 0x2D, 0x5E, 0x70, 0x79, 0x2A, 0xF4,
+    0x21, 0x6C, 0x7A, 0x6D, 0xF5, 0x0A, 0xBE, 0xB2, 0xA3, 0x69, 0x72, 0x59, 0xE2, 0xEF, 0xFB, 0x30,
+    0x31, 0x09, 0x75, 0x68, 0x7B, 0xE0, 0xDF, 0x5F, 0x09, 0xEB, 0x58, 0xB4, 0xD7, 0x2C, 0x64, 0x10,
+    0x99, 0x8D, 0xD6, 0x82, 0x22, 0x78, 0xA9, 0x5B, 0x43, 0x9C, 0xF1, 0xB6, 0x68, 0x82, 0x91, 0x42,
+    0x07, 0xC7, 0x0E, 0x0B, 0x23, 0x02, 0x4E, 0xD8, 0x6E, 0x67, 0x46, 0x25, 0x8E, 0x9D, 0x8E, 0xA5,
+    0x7E, 0x0B, 0x48, 0x97, 0x11, 0xC5, 0xAD, 0x29, 0x17, 0x56, 0x85, 0xCE, 0xF2, 0x4D, 0x59, 0x69,
+    0x17, 0xAB, 0xF5, 0xF2, 0xF1, 0x7D, 0xCE, 0xB1, 0x67, 0x5B, 0x0C, 0xBE, 0xC2, 0x95, 0xF8, 0x93,
+    0x2E, 0x8D, 0x9E, 0xC1, 0x76, 0xAE, 0x73, 0xB9, 0x7E, 0xEE, 0x27, 0x3F, 0x4A, 0x37, 0x28, 0xCC,
+    0x9C, 0x25, 0x44, 0x1B, 0x4A, 0x79, 0xF2, 0xEA, 0xAE, 0x15, 0xD1, 0xDE, 0x75, 0x73, 0x9D, 0xA5,
+    0x4B, 0x9E, 0x0D, 0xBB, 0x1B, 0x4A, 0x5C, 0xBC, 0x6C, 0x50, 0x01, 0x7D, 0xFB, 0x17, 0x6D, 0x0D,
+    0x84, 0x78, 0x0F, 0xDE, 0x0D, 0x94, 0xFA, 0xF8, 0xAB, 0x71, 0x01, 0xBA, 0x05, 0x55, 0x37, 0x70,
+    0xAB, 0xE5, 0x9D, 0x35, 0x9F, 0xA1, 0xB2, 0x11, 0x51, 0x7F, 0xC2, 0x3C, 0x33, 0xEF, 0x50, 0xA4,
+    0xBC, 0xE3, 0x46, 0x78, 0x2D, 0x95, 0xB9, 0x5A, 0x64, 0x3B, 0xE8, 0x76, 0x3C, 0xF0, 0x3D, 0x0F,
+    0x1A, 0x4A, 0xC3, 0xD2, 0xE6, 0xC1, 0x6A, 0x28, 0xDD, 0x8E, 0x07, 0xED, 0xC0, 0x03, 0xA8, 0xCB,
+    0xEE, 0x37, 0xE3, 0xA0, 0xFA, 0x1A, 0xBA, 0xC2, 0x80, 0xF2, 0xB7, 0x0B, 0x1D, 0xEC, 0x9E, 0xEA,
+    0x53, 0x86, 0x46, 0xFF, 0xD4, 0x1D, 0x3C, 0x9C, 0x3F, 0x65, 0xCD, 0x98, 0x5E, 0xD5, 0x56, 0x9C,
+    0xC7, 0xC4, 0xB3, 0xE8, 0x32, 0x63, 0xC0, 0xC5, 0x72, 0xB0, 0xB8, 0x3C, 0xE6, 0x5F, 0x64, 0xEA,
+    0xB4, 0x2C, 0xA0, 0x22, 0xBE, 0x03, 0x8C, 0x1B, 0x20, 0x7D, 0x35, 0xD1, 0xEF, 0x4C, 0x9F, 0x83,
+    0x30, 0x85, 0x7A, 0x6C, 0xD6, 0x09, 0x9B, 0xC8, 0x70, 0x6C, 0x66, 0x6E, 0x06, 0x04, 0xE9, 0x4E,
+    0x8B, 0xD2, 0xA9, 0x74, 0xAC, 0x14, 0xC9, 0x7A, 0xA2, 0x73, 0x9C, 0xC0, 0xE5, 0x39, 0x4B, 0x65,
+    0x40, 0xED, 0x7B, 0x06, 0xB1, 0x61, 0x5F, 0x2B, 0x6F, 0xB4, 0x2D, 0x6B, 0x27, 0x1F, 0x34, 0x8A,
+    0x8F, 0xF2, 0xFC, 0x0D, 0xCD, 0x55, 0x31, 0xB2, 0xDC, 0x44, 0x10, 0x6D, 0x49, 0xC5, 0x57, 0x30,
+    0xC1, 0x38, 0x20, 0xB2, 0x03, 0xA5, 0x64, 0x3A, 0x82, 0x04, 0xA9, 0x03, 0x3B, 0x80, 0xD8, 0x47,
+    0xF8, 0x37, 0xF0, 0x88, 0x72, 0xE8, 0x4B, 0x10, 0x90, 0x78, 0x09, 0x38, 0x01, 0x1E, 0x7D, 0x13,
+    0x12, 0x58, 0x55, 0x1C, 0xC0, 0x2A, 0x70, 0x46, 0x60, 0x15, 0xA8, 0xCA, 0xB2, 0x19, 0xED, 0xE3,
+    0x75, 0xCF, 0xFE, 0xCF, 0x7E, 0x17, 0x24, 0x90, 0x78, 0x56, 0xDB, 0x2D, 0x4D, 0xB7, 0x66, 0x7A,
+    0x5E, 0xBF, 0x6E, 0x45, 0xEC, 0x15, 0xF0, 0x07, 0xB0, 0x7A, 0xE0, 0x27, 0xA0, 0x6F, 0xB1, 0x0B,
+    0x66, 0xA9, 0xD1, 0x57, 0xE8, 0xC5, 0x27, 0xF1, 0xBB, 0x48, 0xB7, 0x48, 0xB7, 0x8A, 0x60, 0x14,
+    0x4C, 0x52, 0x41, 0xAE, 0x4D, 0x47, 0x91, 0x40, 0x13, 0x38, 0x68, 0xD2, 0x41, 0x13, 0x47, 0x36,
+    0xFD, 0xDB, 0x5B, 0xB7, 0x17, 0x9C, 0xD5, 0xD4, 0x60, 0xA3, 0xA9, 0x64, 0x18, 0x34, 0x31, 0x92,
+    0x49, 0x4D, 0x1C, 0xF5, 0x51, 0xA5, 0xF9, 0x8A, 0x14, 0x79, 0xEE, 0x72, 0x57, 0xA9, 0x3E, 0xC2,
+    0x57, 0xED, 0xA1, 0x38, 0xC8, 0x69, 0xB4, 0x58, 0x35, 0x9C, 0xC4, 0x05, 0x43, 0x2A, 0xE2, 0xCA,
+    0x05, 0xDA, 0xAD, 0xC0, 0xE0, 0x8E, 0x12, 0xE6, 0x12, 0x43, 0xF3, 0xEE, 0xAB, 0x38, 0xD7, 0xF4,
+    0xE0, 0x24, 0xC0, 0xC9, 0xF7, 0xDF, 0x71, 0x72, 0x13, 0x4E, 0x7E, 0xE0, 0x19, 0x76, 0x4E, 0x46,
+    0x4C, 0xED, 0xD6, 0x61, 0x75, 0x1A, 0x47, 0xC9, 0xF8, 0x45, 0xA2, 0x06, 0xC1, 0xF8, 0x45, 0xF8,
+    0x1A, 0x45, 0xBA, 0x8E, 0xC2, 0xC4, 0xDD, 0x6F, 0xE9, 0xF1, 0x51, 0x60, 0xDA, 0x2B, 0xA6, 0x11,
+    0xBF, 0xE4, 0x30, 0xDE, 0x10, 0x2F, 0xAE, 0xA9, 0x07, 0x50, 0x7F, 0x03, 0x75, 0xCA, 0xA0, 0xDA,
+    0x83, 0x5B, 0xF2, 0xDC, 0x60, 0x2A, 0x3B, 0x94, 0xF9, 0x41, 0x1C, 0x92, 0x47, 0x62, 0x38, 0xC0,
+    0xD7, 0x20, 0x34, 0x53, 0xBD, 0xEB, 0xD9, 0xC3, 0x44, 0xB4, 0xCE, 0x6F, 0x15, 0x55, 0x09, 0x94,
+    0xBC, 0x3D, 0xC4, 0x7F, 0x70, 0xD0, 0xDB, 0x02, 0x6B, 0x89, 0x2D, 0xEA, 0x62, 0x6F, 0x74, 0x5D,
+    0xCB, 0x9F, 0x61, 0xEA, 0x2C, 0xC9, 0x16, 0x8E, 0x9F, 0x6E, 0xA2, 0xF0, 0x84, 0x62, 0x6F, 0x80,
+    0x47, 0xC0, 0x7D, 0xE0, 0x67, 0x0D, 0x01, 0x93, 0xB3, 0x83, 0x17, 0x19, 0x85, 0x60, 0xE7, 0x6E,
+    0x0C, 0x84, 0xFA, 0xDC, 0xC0, 0x59, 0x5E, 0x1E, 0x3D, 0x0D, 0xA5, 0x42, 0xD8, 0x1B, 0xAC, 0x93,
+    0x3D, 0x70, 0xB3, 0x8B, 0x67, 0x0F, 0x6C, 0xF7, 0x2A, 0xC3, 0x62, 0x84, 0x3A, 0x51, 0xCD, 0x9F,
+    0x19, 0x1C, 0x34, 0xF9, 0x8D, 0x11, 0xCE, 0xDB, 0x8B, 0x65, 0xC6, 0xCC, 0xA2, 0x96, 0xC6, 0x90,
+    0xAB, 0x36, 0x9B, 0xDA, 0x33, 0x09, 0x6F, 0xC1, 0xC7, 0x24, 0x30, 0xEC, 0x88, 0x1F, 0x71, 0x6C,
+    0x20, 0x46, 0xC9, 0x30, 0x9F, 0x09, 0x50, 0x70, 0x27, 0x25, 0x1D, 0x98, 0x39, 0x13, 0xF7, 0x54,
+    0x90, 0x08, 0xB7, 0x44, 0x81, 0x77, 0x4A, 0x70, 0x6E, 0xDE, 0xA9, 0x68, 0x75, 0xBE, 0x31, 0xA1,
+    0x91, 0xFB, 0xF1, 0x5A, 0xD4, 0xA3, 0x32, 0x46, 0x4B, 0x64, 0x50, 0x4D, 0xA2, 0x8F, 0xFC, 0x0F,
+    0x65, 0x06, 0x60, 0xAC, 0x98, 0x25, 0xD5, 0x75, 0xD6, 0x04, 0x53, 0x75, 0x98, 0xFD, 0x2B, 0x02,
+    0xDE, 0x5D, 0x2E, 0xFE, 0x25, 0x75, 0x78, 0xB4, 0xB4, 0xA6, 0xFD, 0xDA, 0x3D, 0xA5, 0x8E, 0x3E,
+    0x75, 0x4E, 0x75, 0x9D, 0x82, 0xE3, 0x29, 0x51, 0xED, 0xCF, 0x6B, 0xD3, 0xC7, 0x64, 0xBA, 0x40,
+    0xD2, 0x62, 0x85, 0x60, 0xAB, 0xA8, 0x8F, 0x82, 0x85, 0xBA, 0xE0, 0x09, 0x17, 0xD2, 0x94, 0xBA,
+    0xE3, 0x21, 0xA5, 0xDC, 0xA5, 0x9D, 0xA8, 0x1D, 0xBE, 0x69, 0x46, 0x12, 0xB4, 0x53, 0x38, 0x03,
+    0x52, 0xC0, 0x62, 0x3A, 0x03, 0xD6, 0xAC, 0xA7, 0x62, 0xCE, 0xA4, 0x3C, 0x31, 0xF5, 0x86, 0x9D,
+    0x12, 0x4E, 0xC0, 0xFE, 0x70, 0xD2, 0x9F, 0xDD, 0x14, 0x3F, 0x93, 0x4E, 0x9A, 0x6C, 0x7A, 0x17,
+    0xC0, 0x6C, 0x91, 0x89, 0xB3, 0x03, 0xC9, 0x97, 0x2A, 0xEE, 0x14, 0xE2, 0xE7, 0x7F, 0x92, 0x83,
+    0xAF, 0x96, 0x84, 0xBE, 0xFE, 0x3D, 0x3D, 0xEE, 0xA6, 0x22, 0x85, 0xE8, 0x69, 0xF0, 0x78, 0x42,
+    0xC3, 0x15, 0x26, 0x1A, 0x96, 0x6E, 0x51, 0x83, 0x5B, 0xD5, 0x20, 0xA9, 0xDA, 0x19, 0xFA, 0x9D,
+    0x02, 0xAF, 0x23, 0x48, 0x2F, 0x5C, 0x62, 0x2C, 0x91, 0x1B, 0x51, 0x37, 0x1B, 0x55, 0xD6, 0xB3,
+    0xFC, 0xE7, 0x03, 0x3C, 0x96, 0xCC, 0x5C, 0xF5, 0x41, 0xE2, 0x75, 0x0F, 0x13, 0x9B, 0xC7, 0x7F,
+    0xBB, 0x1C, 0x5E, 0x77, 0x0A, 0x50, 0x92, 0xA2, 0x97, 0xDE, 0x4E, 0x1F, 0xAC, 0x60, 0xAD, 0x64,
+    0xC3, 0x15, 0x8C, 0xA8, 0x46, 0x17, 0x87, 0x0C, 0x5C, 0x2F, 0x67, 0xE3, 0xD3, 0x0C, 0x8D, 0xC5,
+    0x5A, 0x67, 0xE2, 0x66, 0xB7, 0x06, 0x83, 0xBD, 0x9A, 0x72, 0x9C, 0x8A, 0xB1, 0x7B, 0x6B, 0x0E,
+    0xC7, 0xDC, 0xDE, 0x5E, 0xA8, 0x43, 0x95, 0xB4, 0xC3, 0x49, 0xE8, 0xD5, 0x81, 0x9B, 0x6A, 0x2D,
+    0x68, 0x52, 0xB9, 0x24, 0x5B, 0x67, 0x6F, 0xBD, 0x49, 0x79, 0x62, 0xED, 0xCA, 0xBF, 0x3F, 0x7C,
+    0xBF, 0x5B, 0x4B, 0x89, 0x0B, 0x13, 0x6D, 0xE5, 0xA8, 0xA4, 0xDA, 0x58, 0xF2, 0xDA, 0xE3, 0xA3,
+    0x66, 0x03, 0x2F, 0x59, 0x50, 0x11, 0xA9, 0xE8, 0x79, 0xA0, 0xE7, 0x2C, 0x19, 0xB7, 0xF8, 0x59,
+    0xE2, 0x17, 0x47, 0x5D, 0x6B, 0xA4, 0x1B, 0xD7, 0xFE, 0xE4, 0xE1, 0x29, 0xFA, 0x8B, 0x67, 0x1A,
+    0x68, 0xE2, 0xD1, 0xB0, 0x94, 0xF8, 0x0D, 0x7D, 0x37, 0x37, 0x1B, 0x53, 0x82, 0xE1, 0x62, 0xF0,
+    0x8A, 0x39, 0x63, 0xBC, 0x6B, 0x09, 0x67, 0x1B, 0x67, 0xFF, 0xA9, 0x30, 0xB0, 0x75, 0xCF, 0x7E,
+    0x73, 0xEA, 0x13, 0xE7, 0x36, 0x69, 0x5B, 0x3A, 0x76, 0x78, 0xCB, 0xDC, 0x6E, 0x2C, 0xEE, 0x2F,
+    0xF9, 0x13, 0x79, 0x58, 0xF4, 0x37, 0xE0, 0xF9, 0xD4, 0x2A, 0x1E, 0x78, 0xA1, 0xD5, 0x5E, 0x6F,
+    0x7E, 0x91, 0x0F, 0x87, 0x39, 0x4B, 0x99, 0xBF, 0x45, 0xC1, 0xEC, 0xDE, 0x5A, 0x43, 0x81, 0x2D,
+    0x83, 0x37, 0xFE, 0xFD, 0x2D, 0x8A, 0xE6, 0xE0, 0x7F, 0xD5, 0xA5, 0x8B, 0xD4, 0xAA, 0x43, 0x77,
+    0xA5, 0x0E, 0xF5, 0x6A, 0x5D, 0x25, 0xF2, 0xB3, 0x42, 0xBB, 0xD6, 0x3D, 0x1B, 0xC9, 0x21, 0xAE,
+    0x56, 0xCE, 0x74, 0xA8, 0x33, 0x92, 0x38, 0x1C, 0x08, 0x35, 0xBB, 0x8A, 0xB3, 0x72, 0xB1, 0xF6,
+    0xA6, 0x05, 0x3D, 0xB4, 0x18, 0x58, 0xC6, 0x4F, 0x33, 0x78, 0x30, 0x24, 0x47, 0xF9, 0xBF, 0xE3,
+    0x2F, 0xBD, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0x7E, 0xE6, 0xAD, 0x45, 0x5C, 0x0C, 0x05,
+    0x9B, 0x62, 0xB7, 0x30, 0xFF, 0xC0, 0xFF, 0x80, 0xF1, 0x2A, 0x45, 0xDA, 0x2D, 0xF6, 0x09, 0x89,
+    0x2D, 0xD2, 0x40, 0x13, 0x84, 0xF8, 0x05, 0x68, 0x2C, 0x51, 0xA4, 0xA5, 0xC8, 0xD6, 0xA1, 0x08,
+    0xC5, 0x26, 0xC5, 0xFE, 0x84, 0xB1, 0x94, 0x22, 0x05, 0x8D, 0x29, 0x36, 0xB4, 0x8E, 0xC4, 0x36,
+    0xA4, 0x60, 0x0A, 0x07, 0xBC, 0xAB, 0xB1, 0x2F, 0xE7, 0xCC, 0xDB, 0xEC, 0x06, 0x41, 0x89, 0xB0,
+    0xE5, 0xB1, 0x9F, 0x7D, 0xE7, 0xDC, 0x73, 0xCF, 0xFD, 0x78, 0x22, 0x38, 0xDC, 0xC1, 0x2C, 0x26,
+    0xDA, 0x20, 0xFA, 0x42, 0xA5, 0x1C, 0xEB, 0x5E, 0x3E, 0x90, 0x8F, 0xE4, 0xF6, 0xD8, 0x39, 0x15,
+    0xA9, 0x34, 0x4A, 0xA9, 0x1A, 0x56, 0xFA, 0x46, 0x1B, 0x3B, 0x54, 0x53, 0x3E, 0x8B, 0xB6, 0x3B,
+    0xAD, 0x99, 0x60, 0xA0, 0xAD, 0xEC, 0xE9, 0x24, 0xB5, 0x6A, 0x5B, 0xA9, 0x4E, 0xB9, 0xB6, 0xDA,
+    0xBA, 0xC1, 0x4C, 0x25, 0x6D, 0xFC, 0x50, 0xC7, 0x42, 0x55, 0x17, 0xAB, 0x7F, 0x6A, 0xAF, 0x93,
+    0x1D, 0xE5, 0x08, 0xA7, 0x10, 0x4E, 0x81, 0x2A, 0x39, 0xEF, 0x8A, 0x17, 0x35, 0xEF, 0x1D, 0xF1,
+    0xF4, 0xD5, 0x59, 0xE0, 0xDD, 0x05, 0x89, 0x24, 0xF8, 0x24, 0x8A, 0xC5, 0xDD, 0xBE, 0x54, 0xB9,
+    0x43, 0xC3, 0x9F, 0x93, 0x99, 0x98, 0xE0, 0x68, 0x06, 0xCE, 0x55, 0x5C, 0x1F, 0x02, 0x89, 0x8E,
+    0x88, 0x38, 0x67, 0x09, 0x31, 0x5B, 0xC4, 0x25, 0x44, 0xFD, 0xED, 0x2C, 0xA6, 0x48, 0xB7, 0x8E,
+    0xC4, 0x5E, 0x3B, 0xAA, 0x2F, 0x36, 0x3E, 0xC8, 0xA7, 0x00, 0x92, 0x2A, 0x4A, 0xD5, 0x99, 0x51,
+    0x0A, 0xC5, 0xAF, 0x22, 0x4A, 0xA6, 0xE7, 0x5F, 0xC5, 0x52, 0x87, 0x1D, 0x52, 0x37, 0x3A, 0x27,
+    0x96, 0xDF, 0xA9, 0x1E, 0x6C, 0x49, 0xEE, 0x3C, 0x95, 0x87, 0x8D, 0xEC, 0xEB, 0xE8, 0xB4, 0x4D,
+    0x81, 0x28, 0x95, 0xB9, 0xF2, 0xA3, 0x0D, 0x35, 0xA2, 0x7E, 0x81, 0xAB, 0x2B, 0x63, 0x49, 0x44,
+    0x4F, 0x02, 0xCF, 0xC0, 0x6B, 0x3F, 0x6D, 0x65, 0x94, 0x57, 0x8F, 0x8D, 0xFE, 0x3E, 0x31, 0xF4,
+    0x06, 0xDA, 0x89, 0xEB, 0x0D, 0xE8, 0x41, 0x2D, 0x3F, 0x88, 0xF8, 0x50, 0xE9, 0xC5, 0xF1, 0xA3,
+    0x84, 0x39, 0x59, 0x5D, 0xBC, 0xC2, 0x88, 0x6E, 0x7B, 0xD9, 0x88, 0x6C, 0x1A, 0x41, 0x6E, 0x3E,
+    0x16, 0x99, 0x71, 0xCA, 0x82, 0x53, 0xF4, 0x1E, 0x9E, 0x3C, 0xE3, 0xAE, 0x14, 0xFB, 0xFF, 0x96,
+    0x3A, 0xBC, 0x07, 0x4A, 0x82, 0xE2, 0x53, 0xCC, 0xF5, 0xE4, 0x39, 0x96, 0x66, 0xC5, 0x25, 0x43,
+    0xA6, 0x1A, 0x09, 0x5C, 0xE4, 0x7A, 0x69, 0x77, 0x53, 0x3A, 0x9A, 0x9B, 0x85, 0xEF, 0x6E, 0xBE,
+    0x5E, 0x2F, 0x69, 0xDB, 0x3B, 0x94, 0x93, 0xE3, 0x58, 0x11, 0xF9, 0xC6, 0xD1, 0x28, 0x4D, 0xD6,
+    0xE4, 0xA1, 0x08, 0xF9, 0x58, 0x86, 0x3C, 0x1A, 0x94, 0x0C, 0x68, 0x79, 0xC0, 0xAC, 0x8F, 0x6E,
+    0xEB, 0xC9, 0x6B, 0x0F, 0xF8, 0xD1, 0x2C, 0x3E, 0x56, 0xA1, 0x9C, 0x6D, 0x9F, 0x2F, 0xAE, 0xCB,
+    0xD5, 0x5F, 0x7C, 0xA6, 0x40, 0x5A, 0x28, 0xBA, 0x9E, 0x6F, 0x8E, 0xA8, 0x9D, 0xEF, 0xA1, 0x10,
+    0xF2, 0x6C, 0x97, 0x83, 0xAF, 0xE1, 0x6A, 0x86, 0xDC, 0x31, 0x23, 0x26, 0xF1, 0xB2, 0x2F, 0x1B,
+    0x16, 0xCE, 0x92, 0x72, 0x3B, 0xA5, 0x70, 0x5B, 0x7B, 0x59, 0x00, 0x79, 0x80, 0x1C, 0xAB, 0x1E,
+    0x79, 0xA4, 0x26, 0x96, 0xE9, 0x2F, 0x18, 0x80, 0x40, 0x47, 0xFC, 0x9E, 0x36, 0x9B, 0xCD, 0x83,
+    0x85, 0xF5, 0xA0, 0x4F, 0xB8, 0xBC, 0xE1, 0x72, 0x05, 0x03, 0x33, 0xC3, 0x5F, 0xA1, 0xF5, 0x28,
+    0x2B, 0x7D, 0x49, 0x75, 0x7B, 0x6C, 0xD0, 0x50, 0x2F, 0x07, 0x1A, 0x28, 0x48, 0x60, 0xF1, 0x04,
+    0x7C, 0x24, 0xCE, 0xFA, 0x47, 0xC6, 0xB3, 0xF7, 0x14, 0x1B, 0xB4, 0x41, 0x62, 0x07, 0x92, 0xF8,
+    0x56, 0xEA, 0xF8, 0x09, 0x70, 0xE0, 0x10, 0xFB, 0xF3, 0xE5, 0xE1, 0xB3, 0xE7, 0x29, 0xA6, 0x14,
+    0xD7, 0xF9, 0xF1, 0xAC, 0x5D, 0x11, 0x3D, 0x8A, 0xC3, 0x0D, 0xD5, 0x68, 0x17, 0x1D, 0x10, 0x53,
+    0x9B, 0x2B, 0xCC, 0x77, 0x41, 0x6F, 0x97, 0xB9, 0xAD, 0x07, 0xC4, 0x9D, 0x3A, 0x32, 0x57, 0x56,
+    0x86, 0x3F, 0x58, 0xDE, 0xCF, 0xA9, 0xAC, 0x4F, 0x52, 0x66, 0x27, 0x61, 0x99, 0x0F, 0x2B, 0x8A,
+    0x25, 0xFA, 0x6B, 0xA5, 0xBD, 0x6D, 0xC5, 0xC5, 0xB2, 0x01, 0x9D, 0x96, 0x91, 0xB2, 0x39, 0x2A,
+    0x00, 0x6F, 0x53, 0x27, 0xFA, 0x1A, 0x41, 0xBB, 0x4B, 0x46, 0xBA, 0x8D, 0xFC, 0x2C, 0x45, 0x0E,
+    0x03, 0xFB, 0x07, 0x0C, 0xAA, 0x88, 0xC8, 0x4B, 0xAD, 0x26, 0x98, 0xDF, 0x63, 0xF6, 0x3B, 0x0F,
+    0x21, 0x3B, 0x93, 0xEA, 0x3D, 0x2D, 0x50, 0x1E, 0x38, 0x77, 0x1F, 0x6F, 0x59, 0x94, 0xC1, 0x76,
+    0xD5, 0xE8, 0x7B, 0x5E, 0x06, 0xCF, 0x19, 0xC6, 0xC6, 0xCD, 0xF1, 0x5F, 0x6A, 0x82, 0x80, 0xA9,
+    0x0A, 0x8F, 0x2A, 0xB8, 0xD4, 0xF9, 0x50, 0x07, 0x19, 0x92, 0x14, 0x5A, 0x39, 0x6F, 0xBF, 0xB9,
+    0x56, 0xE5, 0x5F, 0x8F, 0x2C, 0x61, 0x80, 0x5D, 0xBE, 0xA4, 0x52, 0xB1, 0x3D, 0x8A, 0xC2, 0xB0,
+    0x50, 0xA2, 0xF8, 0x79, 0x95, 0x68, 0xA2, 0x58, 0x3A, 0xB6, 0xBE, 0x76, 0xF9, 0x83, 0x11, 0xBD,
+    0x6B, 0x2E, 0x7F, 0x80, 0x60, 0x62, 0x39, 0x0A, 0x90, 0x10, 0x34, 0x68, 0xCE, 0x87, 0x1C, 0x15,
+    0x9F, 0xCD, 0xD7, 0xDE, 0xBA, 0xE4, 0xAF, 0x7C, 0xEB, 0xDE, 0x7A, 0x7A, 0xC8, 0xDE, 0x8D, 0x2F,
+    0x49, 0xFD, 0x96, 0xBA, 0xEF, 0x0A, 0x85, 0x95, 0xAC, 0x83, 0xDD, 0xCE, 0x2A, 0x3B, 0x99, 0x48,
+    0x19, 0xA0, 0x07, 0x90, 0x68, 0x5E, 0x21, 0x77, 0x1D, 0xEB, 0xD3, 0x24, 0x77, 0xC8, 0x9C, 0xD1,
+    0x06, 0x59, 0x47, 0x23, 0x95, 0x60, 0x43, 0x66, 0x7C, 0x28, 0x15, 0x4C, 0x43, 0xA9, 0x7D, 0x22,
+    0xAE, 0xF7, 0x53, 0xFF, 0xE0, 0x0A, 0x7B, 0xDB, 0xE8, 0xF6, 0x0E, 0x6F, 0xE3, 0x9D, 0x8B, 0xA4,
+    0x8D, 0x0D, 0xA9, 0x0C, 0x50, 0x43, 0x89, 0x4C, 0xDD, 0xA7, 0x2A, 0xC0, 0x7C, 0x68, 0xFE, 0x21,
+    0xD1, 0xEA, 0x7B, 0xAE, 0x5F, 0x08, 0xA1, 0x3B, 0x8C, 0xF7, 0x25, 0xD7, 0xC9, 0x80, 0x1F, 0x5A,
+    0x13, 0x5E, 0x3F, 0xF4, 0x9D, 0xEB, 0xEC, 0x2B, 0x02, 0xC7, 0x32, 0x30, 0xF3, 0xAE, 0x63, 0x0C,
+    0xF6, 0x7E, 0xAC, 0xDB, 0xED, 0x00, 0x1F, 0xAF, 0xA7, 0x2B, 0x02, 0x42, 0x07, 0xFD, 0x82, 0x24,
+    0xAF, 0xB4, 0x48, 0x39, 0x72, 0x83, 0xEB, 0xF0, 0xDA, 0x70, 0xEF, 0x82, 0xB7, 0x84, 0xC2, 0x50,
+    0x0C, 0xE5, 0x82, 0xE7, 0x1A, 0x8E, 0xA2, 0x41, 0xB9, 0x25, 0xBF, 0xD3, 0x3A, 0x31, 0x43, 0x5B,
+    0x1F, 0x22, 0x67, 0xA8, 0xA9, 0x5E, 0xFC, 0x6B, 0x6D, 0x57, 0xFA, 0x68, 0x11, 0x4E, 0x92, 0xF7,
+    0x19, 0x7F, 0xDE, 0xB0, 0x05, 0x46, 0xFE, 0x69, 0x70, 0x1A, 0xE8, 0x54, 0xCC, 0x1C, 0x9D, 0xE8,
+    0xD5, 0xDE, 0xB1, 0xDE, 0x27, 0x94, 0x88, 0x1C, 0x42, 0x03, 0x32, 0x81, 0x2D, 0xCA, 0x7A, 0x45,
+    0x7A, 0xA8, 0x4A, 0x2A, 0x4C, 0xA2, 0xFB, 0x94, 0xA7, 0x64, 0x7E, 0xCC, 0x8C, 0xA6, 0xB1, 0x23,
+    0xDB, 0xFD, 0xA7, 0x19, 0xAF, 0x30, 0xC2, 0x1D, 0x26, 0xFB, 0x19, 0xFE, 0xBD, 0x98, 0x49, 0xC7,
+    0xF9, 0xB2, 0x3E, 0xDD, 0xCA, 0xB6, 0x02, 0x91, 0x62, 0xAE, 0x47, 0x5E, 0x89, 0x54, 0x93, 0xDD,
+    0xB2, 0xBA, 0x7B, 0xCA, 0x32, 0x18, 0x38, 0xA2, 0xAA, 0x4B, 0x17, 0xAB, 0xD6, 0xCC, 0x6B, 0x29,
+    0x99, 0xDC, 0x28, 0xBB, 0xDF, 0x90, 0x6D, 0x8F, 0x6B, 0x94, 0x3B, 0x9E, 0xAD, 0xA0, 0x05, 0x98,
+    0xD6, 0x28, 0x74, 0xDB, 0x63, 0x04, 0x72, 0x14, 0x62, 0xB4, 0xB0, 0x6D, 0x64, 0xF7, 0x50, 0xFE,
+    0x97, 0xE3, 0x2F, 0xBD, 0x55, 0x3D, 0xAF, 0xD5, 0x46, 0x10, 0x1D, 0xDB, 0xE1, 0x59, 0x8A, 0x0B,
+    0x53, 0x51, 0x40, 0xB1, 0xFF, 0x00, 0xB7, 0xE9, 0xF6, 0xBE, 0x50, 0x52, 0xE4, 0x15, 0xDC, 0x86,
+    0x14, 0xAF, 0xA7, 0xE1, 0x27, 0xEC, 0xED, 0x52, 0xA4, 0xA1, 0xE0, 0x07, 0xA4, 0x48, 0xC3, 0xFD,
+    0x13, 0x6B, 0xF4, 0x0A, 0x5A, 0x23, 0x84, 0x52, 0xD0, 0x18, 0x89, 0x0A, 0x8A, 0xEB, 0x48, 0x46,
+    0xB2, 0x60, 0x77, 0x27, 0xE7, 0xEC, 0xBD, 0x4F, 0xEF, 0x03, 0x90, 0x12, 0x09, 0xC5, 0xD2, 0xAE,
+    0x7C, 0xC6, 0x3B, 0x5F, 0x67, 0x66, 0xD6, 0xAD, 0xAA, 0x6E, 0xB0, 0x52, 0x8B, 0xED, 0xEF, 0xB4,
+    0x3E, 0x8D, 0xA6, 0x2F, 0xF4, 0x38, 0x88, 0x1B, 0xDA, 0x4D, 0x3B, 0x8B, 0x54, 0x49, 0x44, 0x74,
+    0x23, 0xD2, 0x01, 0xD4, 0xBA, 0x88, 0x38, 0x9D, 0xA4, 0xF4, 0xDA, 0x43, 0x14, 0xF1, 0xCD, 0x4F,
+    0x94, 0xE3, 0xC5, 0x4D, 0x23, 0x5E, 0xBA, 0x8D, 0xE8, 0x2B, 0x5D, 0x75, 0xC1, 0xC2, 0xE0, 0x31,
+    0xD6, 0x50, 0xAA, 0x8E, 0x52, 0x3C, 0x3A, 0x11, 0x3E, 0x35, 0x24, 0xCF, 0xB1, 0x16, 0xAF, 0x1A,
+    0xBA, 0x27, 0x4D, 0x6C, 0xFA, 0x3A, 0x16, 0x53, 0x15, 0xE5, 0x26, 0x3D, 0x71, 0x95, 0x5C, 0xBA,
+    0x82, 0x57, 0x6C, 0x16, 0x1E, 0x8F, 0x3C, 0xFD, 0xC3, 0xAB, 0xB4, 0x91, 0x9F, 0x00, 0xDC, 0x28,
+    0x62, 0xE6, 0x9F, 0xA4, 0x89, 0x56, 0x2A, 0x35, 0x73, 0xA9, 0xF7, 0x98, 0x88, 0xC3, 0xAA, 0xA9,
+    0x76, 0xF4, 0x27, 0x9D, 0x6D, 0xB7, 0x7F, 0x60, 0x6F, 0x29, 0x90, 0x42, 0x15, 0x09, 0xC8, 0x8F,
+    0xDB, 0xAD, 0x7C, 0xED, 0x69, 0x10, 0x28, 0x23, 0xD6, 0x00, 0xFD, 0xCF, 0xD0, 0xE8, 0x74, 0xA9,
+    0xA0, 0x67, 0x82, 0xD8, 0x19, 0xCA, 0x3D, 0x81, 0xCD, 0xA0, 0xCD, 0xA0, 0xD2, 0x0C, 0x34, 0x03,
+    0xBB, 0x23, 0x68, 0x3F, 0x12, 0xDC, 0x8B, 0x59, 0x07, 0xB9, 0x03, 0xF8, 0x81, 0x40, 0xE7, 0x6C,
+    0x20, 0x66, 0x6B, 0xBA, 0xCA, 0x60, 0xB8, 0x6A, 0xDA, 0x04, 0x04, 0xB8, 0x69, 0x34, 0x7A, 0x8D,
+    0x15, 0xE3, 0xD0, 0x1E, 0xC9, 0xC8, 0x6D, 0x86, 0x8B, 0x04, 0x7A, 0x64, 0x49, 0x02, 0xD6, 0xEB,
+    0x93, 0xEB, 0x91, 0x83, 0xDE, 0x4A, 0x13, 0x8E, 0xA8, 0xFE, 0x06, 0x0B, 0x09, 0x95, 0x2B, 0x74,
+    0x65, 0xE0, 0x72, 0x00, 0xB3, 0x74, 0x7D, 0x0C, 0xCF, 0xEE, 0x65, 0x82, 0xF0, 0x63, 0x74, 0x43,
+    0x9D, 0x02, 0x3F, 0x86, 0x1A, 0xC2, 0xC0, 0x93, 0xAC, 0x35, 0x80, 0x99, 0x6B, 0x06, 0xF0, 0xBB,
+    0x86, 0x96, 0x04, 0xC0, 0xA6, 0xC8, 0x03, 0xA1, 0xBB, 0x6E, 0x74, 0x28, 0x76, 0xA5, 0x6D, 0x00,
+    0xB0, 0x13, 0x2B, 0x5F, 0xC6, 0x7A, 0xF9, 0x2A, 0x8F, 0x57, 0xC2, 0xF7, 0x8A, 0xC2, 0xE8, 0xE6,
+    0x72, 0x96, 0x4C, 0xB9, 0xDA, 0x83, 0x3D, 0x81, 0x36, 0x83, 0x36, 0x83, 0x2A, 0x65, 0xA0, 0xA7,
+    0x04, 0xF6, 0x25, 0xC1, 0x2F, 0x33, 0x75, 0x3E, 0xC7, 0x6C, 0x20, 0x07, 0x6B, 0x75, 0xC8, 0x60,
+    0xCE, 0xD6, 0xE2, 0x55, 0xD3, 0x00, 0x06, 0x1D, 0xE3, 0xF5, 0xCD, 0xE5, 0x7A, 0x4E, 0x87, 0x1A,
+    0x4F, 0x5D, 0x2F, 0x75, 0x34, 0x3C, 0x76, 0x1F, 0x9D, 0x64, 0x7B, 0xB4, 0x6D, 0x21, 0x3F, 0x7C,
+    0x91, 0x44, 0xA7, 0x93, 0xD5, 0x1D, 0x89, 0x58, 0x1C, 0x8C, 0x8D, 0x99, 0x1D, 0x52, 0x05, 0xCA,
+    0x06, 0x43, 0x72, 0x0D, 0xC9, 0x35, 0x3B, 0x08, 0x4F, 0xFF, 0x82, 0x70, 0xF7, 0x1C, 0x42, 0xA4,
+    0x3C, 0xD4, 0xF0, 0xCF, 0x62, 0x93, 0x5C, 0x96, 0x81, 0xEA, 0x68, 0xF5, 0x9E, 0x5C, 0xC0, 0x26,
+    0xE6, 0x60, 0x55, 0xA0, 0x19, 0xDB, 0xB9, 0x63, 0x03, 0x07, 0xCB, 0x9E, 0xCE, 0x7B, 0x33, 0x77,
+    0xC3, 0xB5, 0x28, 0x6E, 0x3C, 0xDD, 0x57, 0x77, 0x64, 0x40, 0x28, 0x21, 0xB2, 0x02, 0x99, 0xA5,
+    0xBE, 0xA3, 0x73, 0xC5, 0x97, 0x89, 0xE3, 0xA0, 0x73, 0x87, 0x4A, 0xD8, 0x80, 0xE4, 0xB9, 0x4F,
+    0x9C, 0x4A, 0x87, 0xDD, 0x1C, 0x76, 0x9F, 0xC7, 0xE6, 0x62, 0x37, 0xC1, 0xCD, 0x79, 0x87, 0x56,
+    0xB7, 0xA0, 0xA3, 0x41, 0x5B, 0x97, 0x38, 0xBD, 0x2D, 0x3B, 0x73, 0x68, 0xF4, 0xDD, 0x1D, 0xDD,
+    0xB0, 0x86, 0x29, 0x7B, 0xE4, 0x61, 0xE5, 0xC8, 0xC9, 0xC3, 0xF3, 0xD6, 0x33, 0x83, 0x5B, 0xE5,
+    0x6E, 0x60, 0x2F, 0x94, 0xB1, 0x99, 0xAF, 0x91, 0x78, 0xB4, 0x5D, 0x71, 0xCE, 0x71, 0x06, 0x36,
+    0x60, 0x68, 0x36, 0x18, 0xA5, 0x33, 0xDD, 0x87, 0xA4, 0x1F, 0x92, 0xB4, 0xC9, 0x8F, 0xE2, 0x77,
+    0x49, 0x9A, 0x84, 0xEC, 0x3C, 0x24, 0x0D, 0x63, 0xD3, 0x17, 0x2C, 0xB0, 0x45, 0x03, 0xF1, 0xDE,
+    0x18, 0x31, 0x92, 0x8B, 0xB0, 0x9A, 0x72, 0xE3, 0xC1, 0xBF, 0xE4, 0x03, 0xD9, 0xF8, 0x4B, 0x7C,
+    0x74, 0x99, 0x8F, 0x73, 0x26, 0x1C, 0xDB, 0x21, 0xFA, 0xCB, 0x7B, 0xA6, 0xDF, 0x5D, 0xB0, 0x72,
+    0xCE, 0x47, 0x3C, 0xF0, 0x21, 0x99, 0x8F, 0xE6, 0x1B, 0x7C, 0x3C, 0xF9, 0x22, 0xD7, 0xD7, 0x7E,
+    0x36, 0x53, 0xA1, 0x67, 0x48, 0x31, 0x62, 0x66, 0xDC, 0x87, 0x80, 0x1B, 0x8D, 0xBE, 0x76, 0xD4,
+    0xD7, 0xF7, 0x5B, 0x4F, 0x49, 0xF4, 0x83, 0xB8, 0x17, 0x2A, 0x4D, 0xB0, 0x0B, 0xA7, 0xF3, 0x93,
+    0xBF, 0x9E, 0xEB, 0xF7, 0xED, 0x92, 0xFF, 0x9F, 0x95, 0xFF, 0xDE, 0x25, 0xDF, 0x8B, 0xB9, 0x13,
+    0x12, 0xA7, 0x15, 0x79, 0x78, 0x8B, 0x78, 0xBA, 0x05, 0x7F, 0x8A, 0x2A, 0xB4, 0xD3, 0x15, 0xCE,
+    0x6E, 0x3D, 0xCD, 0x94, 0xCD, 0xBC, 0xF5, 0xF3, 0xBD, 0x02, 0xDE, 0x74, 0xB8, 0xA3, 0xBD, 0x85,
+    0x67, 0x1E, 0x6E, 0xB4, 0x84, 0x41, 0x1D, 0xEF, 0x92, 0x2D, 0x39, 0xFC, 0xDF, 0x30, 0xD6, 0xFB,
+    0x54, 0x0D, 0xCF, 0x53, 0xEB, 0x20, 0x24, 0x2D, 0xBC, 0x35, 0x96, 0x86, 0x43, 0xD6, 0x0E, 0x50,
+    0x6F, 0x02, 0x74, 0x7E, 0x26, 0x4F, 0xFC, 0x27, 0xF1, 0x5E, 0x25, 0x3B, 0x8E, 0x6C, 0x5D, 0xCC,
+    0x51, 0xC2, 0x1D, 0xEA, 0x31, 0x17, 0x24, 0xA8, 0x5E, 0xCC, 0x28, 0x37, 0x65, 0x75, 0x11, 0xE4,
+    0xED, 0x67, 0x64, 0x76, 0x91, 0x7C, 0x97, 0xBE, 0xD7, 0xC5, 0xC0, 0x48, 0x49, 0xEE, 0x59, 0x11,
+    0x59, 0xFF, 0x9A, 0x70, 0x13, 0x6A, 0xDF, 0xB0, 0xF2, 0xCF, 0x1E, 0x23, 0xDA, 0x3A, 0xD5, 0x48,
+    0xEA, 0xFE, 0x28, 0x7A, 0x16, 0xC5, 0x0F, 0xFA, 0x49, 0x27, 0x34, 0x04, 0x38, 0x85, 0x46, 0xB1,
+    0x96, 0x6F, 0x3C, 0xFF, 0x00, 0xD5, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x14, 0x7C, 0x6B, 0x87, 0xB8,
+    0x70, 0x61, 0x7A, 0x0A, 0x37, 0x34, 0xD0, 0xF8, 0x13, 0xEC, 0x9E, 0x82, 0x34, 0xA9, 0xF9, 0x09,
+    0xFA, 0xBD, 0x44, 0xA2, 0xE6, 0x03, 0x68, 0x68, 0xEF, 0xF8, 0x05, 0xA4, 0xB5, 0xC8, 0x0F, 0x18,
+    0x51, 0xD2, 0xB8, 0x40, 0x14, 0x54, 0x2E, 0x2C, 0xE1, 0xA0, 0xB5, 0x1F, 0x33, 0xCF, 0x09, 0x1C,
+    0x09, 0x11, 0x34, 0x48, 0xC7, 0xEA, 0xF6, 0xAD, 0xBC, 0x7E, 0x3B, 0x3B, 0xF3, 0x66, 0xD7, 0x27,
+    0xC9, 0x6E, 0xB7, 0x11, 0x49, 0x55, 0x3B, 0x91, 0xCC, 0xE2, 0x3A, 0x73, 0xAB, 0x79, 0x8D, 0x99,
+    0x2E, 0x41, 0x63, 0xAE, 0x8B, 0xD7, 0xF1, 0x58, 0xA7, 0x4C, 0x37, 0xE2, 0xDB, 0x44, 0x5B, 0xD1,
+    0x46, 0xB4, 0x73, 0x2A, 0x12, 0xFA, 0x74, 0x16, 0xA9, 0x87, 0x34, 0x8A, 0x54, 0x53, 0x3E, 0x8A,
+    0x14, 0xB1, 0xE8, 0x45, 0xF2, 0xB9, 0x6A, 0xB1, 0xCB, 0x52, 0x03, 0x39, 0xD1, 0x40, 0x3C, 0x5D,
+    0x0C, 0x35, 0x32, 0xD6, 0x23, 0x63, 0x39, 0x58, 0x04, 0x05, 0xE9, 0x6A, 0xA4, 0x27, 0x97, 0x40,
+    0x04, 0xB5, 0xD9, 0xE2, 0x84, 0xE8, 0xB4, 0x67, 0xCA, 0x23, 0x23, 0xF4, 0x78, 0xB7, 0x35, 0xE2,
+    0x03, 0xB9, 0x01, 0xCC, 0x9D, 0x9E, 0x36, 0xB7, 0x58, 0x43, 0xD2, 0xB9, 0xCE, 0xB5, 0x8E, 0x95,
+    0xB6, 0x80, 0xF0, 0x7D, 0xAA, 0x1B, 0x90, 0xAB, 0xA2, 0x84, 0x8D, 0x68, 0x5B, 0x0C, 0x92, 0x2F,
+    0x24, 0xEE, 0x87, 0xAA, 0x03, 0x18, 0x79, 0x97, 0xA3, 0x07, 0x8E, 0xBE, 0x1C, 0x48, 0x9B, 0x24,
+    0x6B, 0x25, 0x19, 0x23, 0x50, 0x90, 0x91, 0x04, 0x12, 0xCD, 0x66, 0x63, 0xDE, 0x72, 0x16, 0xCF,
+    0x0F, 0x53, 0xA4, 0x66, 0x9F, 0x99, 0x1A, 0x48, 0x29, 0x57, 0x2A, 0xF3, 0x5C, 0xEF, 0xB6, 0x46,
+    0xC5, 0x9D, 0x38, 0xE0, 0xE6, 0x13, 0x65, 0x16, 0xB1, 0xFE, 0x11, 0xF3, 0xB1, 0xEC, 0xFF, 0x87,
+    0x7A, 0x5B, 0x4B, 0x27, 0xC2, 0x87, 0x77, 0xC8, 0xCC, 0x63, 0xC5, 0xD2, 0x9F, 0x11, 0xB7, 0x71,
+    0x72, 0xC8, 0xA5, 0x07, 0xC1, 0x84, 0xE4, 0xBB, 0x7C, 0xC3, 0x25, 0xD8, 0x4F, 0xAA, 0xC1, 0x23,
+    0x86, 0xF7, 0xA8, 0xA9, 0x5B, 0x58, 0xC4, 0x74, 0xCC, 0xA1, 0xCC, 0x6D, 0x92, 0x43, 0xB7, 0xE1,
+    0xE4, 0x88, 0xBA, 0x5B, 0xBE, 0x30, 0xF8, 0xEA, 0x62, 0xA2, 0x2F, 0x9E, 0xB0, 0xB6, 0x69, 0x4B,
+    0xF0, 0xE7, 0xF9, 0x61, 0x3B, 0x62, 0x97, 0xC1, 0x29, 0xEB, 0xB6, 0xBA, 0x20, 0xD5, 0xE8, 0xC1,
+    0x3E, 0x8D, 0xC5, 0xF0, 0x9B, 0xDB, 0x80, 0x7D, 0xE7, 0x52, 0xF5, 0x99, 0xEA, 0x13, 0xD5, 0x0F,
+    0xAA, 0x67, 0xF8, 0x54, 0xE5, 0x0A, 0x92, 0x8D, 0xA3, 0x11, 0x1D, 0x38, 0xB3, 0x9C, 0x65, 0x94,
+    0x62, 0x86, 0xCE, 0xBD, 0x17, 0x98, 0xC5, 0xAF, 0xD0, 0x06, 0x2F, 0x12, 0x45, 0x6B, 0x80, 0xC5,
+    0x0F, 0x1D, 0x1F, 0x60, 0xC0, 0xF1, 0xF6, 0xA9, 0x91, 0xC7, 0x0A, 0xF3, 0xA7, 0xFB, 0xE9, 0x4C,
+    0xB1, 0xF7, 0x22, 0x37, 0xE3, 0x0A, 0xFB, 0x42, 0xA6, 0xB6, 0xD0, 0xF2, 0xCE, 0x90, 0xA2, 0x17,
+    0x7A, 0x15, 0xFC, 0x39, 0x92, 0x8E, 0xE4, 0xFE, 0x4D, 0xF2, 0x81, 0x94, 0x03, 0x52, 0x96, 0x52,
+    0x25, 0x8C, 0xD9, 0x82, 0xDA, 0xEF, 0x05, 0x35, 0x2B, 0x1A, 0xDF, 0x93, 0x52, 0x2F, 0x16, 0x1E,
+    0xA8, 0x99, 0xEE, 0x7F, 0x09, 0x2E, 0x5C, 0xA2, 0x4E, 0xAA, 0x2C, 0x07, 0xF0, 0x54, 0xBF, 0x52,
+    0xD0, 0x47, 0x06, 0xD1, 0x6F, 0x6F, 0x22, 0x40, 0x8A, 0x01, 0xAC, 0xAB, 0x16, 0x02, 0x02, 0x0F,
+    0xE7, 0xC8, 0x42, 0xAC, 0x42, 0x4C, 0xD3, 0x4A, 0xBF, 0x91, 0x3F, 0x4C, 0x61, 0xAF, 0x12, 0x82,
+    0xC1, 0x67, 0xA6, 0x66, 0xCE, 0x85, 0x96, 0x7E, 0xD1, 0x6B, 0x7A, 0xC9, 0x83, 0x26, 0x35, 0x0B,
+    0xF3, 0x96, 0x02, 0x5F, 0x5F, 0xEB, 0xD4, 0x05, 0x5C, 0xE8, 0xD4, 0x9C, 0x2D, 0x0E, 0x5D, 0xD8,
+    0x23, 0xFA, 0x94, 0xF1, 0x48, 0xDC, 0xD1, 0x4B, 0xFD, 0x84, 0xB5, 0x11, 0xCA, 0x23, 0xBF, 0x90,
+    0x98, 0x64, 0xC7, 0xAE, 0xE9, 0xB0, 0x76, 0xC7, 0x33, 0xE1, 0x9A, 0x7B, 0x66, 0x51, 0x31, 0x56,
+    0x76, 0x1F, 0xCA, 0xA9, 0x1E, 0xF6, 0xC7, 0xF5, 0x62, 0xDF, 0xD5, 0x02, 0x2F, 0x14, 0x02, 0x25,
+    0x61, 0xA3, 0x39, 0x50, 0x15, 0x42, 0xAA, 0xF6, 0xFF, 0xD7, 0x58, 0x09, 0xFE, 0x6A, 0xFC, 0x72,
+    0xB2, 0x8E, 0x28, 0xD0, 0x3A, 0x6A, 0x67, 0xE3, 0x2B, 0x1D, 0xD6, 0xBC, 0x7A, 0x5A, 0xC7, 0x32,
+    0xAE, 0x63, 0x71, 0x63, 0xBC, 0x9E, 0xBF, 0xCA, 0x7B, 0x61, 0xEB, 0x4A, 0xE2, 0x54, 0x3A, 0x05,
+    0x33, 0x93, 0x3C, 0xED, 0x28, 0xCC, 0xF2, 0x4F, 0xDB, 0x77, 0xB5, 0x55, 0x31, 0x8F, 0xDD, 0x44,
+    0x10, 0x1E, 0x3F, 0x73, 0x67, 0xE9, 0xAC, 0xC3, 0x29, 0x72, 0x91, 0xEE, 0x84, 0xCE, 0x2D, 0x42,
+    0xC0, 0x76, 0x28, 0xDD, 0x9A, 0xCB, 0x1F, 0x48, 0x91, 0x57, 0x50, 0x20, 0x7A, 0x9A, 0x5C, 0x01,
+    0x12, 0x9D, 0x7D, 0x41, 0x82, 0x82, 0x82, 0x43, 0xA2, 0xA4, 0xB8, 0x22, 0x05, 0x21, 0x05, 0x14,
+    0x29, 0xA0, 0xC9, 0xFA, 0x74, 0x4A, 0x95, 0xC6, 0x02, 0x21, 0x0A, 0x0A, 0x2C, 0x91, 0x0A, 0x0A,
+    0x0C, 0x58, 0xC4, 0x5C, 0xD6, 0xFE, 0xF8, 0x66, 0xDF, 0x9D, 0xB8, 0x47, 0x0E, 0x05, 0x81, 0xD8,
+    0x67, 0xAF, 0xF5, 0x76, 0x66, 0xBF, 0x99, 0xF9, 0x66, 0x76, 0x56, 0x64, 0x31, 0x66, 0x3E, 0xED,
+    0xF8, 0xC9, 0xFB, 0xB2, 0xE1, 0xA7, 0xFC, 0x12, 0x05, 0x3F, 0x88, 0xBD, 0xCA, 0x8A, 0x48, 0xCE,
+    0x1D, 0x33, 0xA0, 0x16, 0xE0, 0x27, 0x40, 0x62, 0xE0, 0x5D, 0xEC, 0x4B, 0x84, 0x36, 0x19, 0x55,
+    0x50, 0xE4, 0xBD, 0x48, 0x3A, 0x8A, 0xA2, 0x99, 0x3E, 0x02, 0x1E, 0x88, 0x6B, 0x12, 0x60, 0x50,
+    0x11, 0xD0, 0x07, 0x91, 0xED, 0x54, 0x54, 0xB8, 0x9A, 0xA2, 0x71, 0x86, 0xB0, 0x2B, 0xF5, 0x0B,
+    0x51, 0x6B, 0xFA, 0x84, 0xC8, 0x11, 0x06, 0x47, 0x75, 0x8B, 0x47, 0xC0, 0x44, 0x5B, 0xED, 0x89,
+    0x69, 0x2E, 0xE2, 0x21, 0x5F, 0x7C, 0xAB, 0x93, 0xE0, 0xF8, 0xB6, 0x8F, 0x51, 0x64, 0x5D, 0x36,
+    0x8A, 0xA9, 0x6D, 0x2F, 0x4E, 0xD0, 0x44, 0x3D, 0x97, 0x22, 0xE1, 0x92, 0xAC, 0x94, 0xBF, 0x5F,
+    0x13, 0x0B, 0x74, 0x84, 0x40, 0x15, 0x96, 0x84, 0x5A, 0x8C, 0x90, 0xFE, 0xC5, 0x1A, 0xEB, 0x99,
+    0x25, 0xDA, 0xC8, 0x31, 0x15, 0x33, 0x05, 0xCE, 0x00, 0xA5, 0x20, 0x56, 0x6E, 0x32, 0x65, 0xC6,
+    0x52, 0xF7, 0x07, 0x2E, 0x25, 0xAA, 0x96, 0x81, 0x2B, 0x5B, 0xFB, 0x0B, 0x97, 0x52, 0xEA, 0x7F,
+    0xCF, 0x77, 0x60, 0x7C, 0x53, 0x84, 0xCA, 0x16, 0x65, 0x9B, 0x35, 0xF9, 0x10, 0x77, 0xC9, 0x24,
+    0x6F, 0x5D, 0xC2, 0x87, 0x0A, 0x56, 0xC7, 0x1A, 0x03, 0x17, 0x48, 0x55, 0x45, 0x9E, 0xD5, 0xD6,
+    0xA0, 0xF6, 0x6E, 0x8A, 0x01, 0x03, 0x08, 0x11, 0x46, 0x6A, 0xD2, 0x8A, 0x3C, 0x95, 0x57, 0xB4,
+    0xD3, 0x50, 0x95, 0xE6, 0xCD, 0x49, 0xE8, 0x44, 0xBF, 0x02, 0xD0, 0x58, 0x03, 0x1C, 0x72, 0xCE,
+    0x41, 0x5E, 0x6B, 0xD2, 0x28, 0xA5, 0x17, 0x62, 0xA6, 0x28, 0x14, 0xD9, 0x75, 0xAE, 0x56, 0x07,
+    0xCB, 0x5A, 0x43, 0xD2, 0x30, 0xB9, 0xB3, 0x09, 0x49, 0x0B, 0x40, 0x65, 0xC8, 0xAC, 0x55, 0x55,
+    0xCE, 0x1A, 0xB7, 0x79, 0xA8, 0xD1, 0xE4, 0x9D, 0x1A, 0xCB, 0xFA, 0x8C, 0x2E, 0x66, 0x3E, 0xE2,
+    0x96, 0xD4, 0x8B, 0xF1, 0x9A, 0xCB, 0x18, 0x75, 0xCE, 0x3C, 0x96, 0x7D, 0x1E, 0x88, 0xA1, 0x0B,
+    0x55, 0x84, 0x3A, 0xC0, 0x28, 0x3D, 0x54, 0xD7, 0x39, 0xC1, 0x82, 0x8C, 0x50, 0x3F, 0x27, 0xF0,
+    0x3A, 0x47, 0xB7, 0x4E, 0x52, 0x67, 0xD1, 0x61, 0xB2, 0x68, 0xCA, 0x31, 0x41, 0x65, 0x5A, 0x42,
+    0x94, 0x95, 0x94, 0x1D, 0xB7, 0xE5, 0x8F, 0xBC, 0xEE, 0xEC, 0xD4, 0x49, 0x75, 0x55, 0xC1, 0xE3,
+    0xE0, 0x0E, 0xC8, 0x91, 0xF9, 0x86, 0x29, 0x72, 0x37, 0xC0, 0xC4, 0x50, 0x42, 0x7F, 0x6C, 0x5B,
+    0xA2, 0x36, 0xBD, 0x43, 0x15, 0x2C, 0x6B, 0xE1, 0x49, 0xBC, 0x3C, 0xD1, 0x77, 0x59, 0x75, 0xBD,
+    0x04, 0x1A, 0xD5, 0x85, 0x27, 0xB1, 0x97, 0x2C, 0xB1, 0x37, 0xD9, 0xBF, 0xB0, 0xC7, 0x0A, 0x66,
+    0x3D, 0x44, 0xA1, 0xE6, 0x64, 0xA3, 0xC4, 0xD7, 0xCA, 0xDB, 0xDF, 0xB2, 0x37, 0x5B, 0xB0, 0x67,
+    0xCF, 0xB0, 0xB7, 0x0A, 0xBC, 0x06, 0x10, 0x86, 0xF5, 0xBC, 0xB7, 0xA8, 0x2D, 0x0D, 0xCF, 0x5B,
+    0xBC, 0x0D, 0xF2, 0xD1, 0xE4, 0x93, 0xB8, 0x4A, 0x02, 0x25, 0xB9, 0xB7, 0x15, 0x4D, 0xF1, 0x2F,
+    0x6D, 0xD7, 0x12, 0xDD, 0xC6, 0xF1, 0xBE, 0xD6, 0x7D, 0xCF, 0x6A, 0xC6, 0x35, 0xB5, 0xDB, 0x9E,
+    0x90, 0x62, 0x5A, 0xD7, 0x88, 0x09, 0xB5, 0xDF, 0xCF, 0xF0, 0xA0, 0xC4, 0x11, 0x40, 0x29, 0xAB,
+    0x6D, 0xED, 0x93, 0x33, 0xE3, 0x40, 0xE4, 0xF2, 0xF3, 0xDB, 0x77, 0x92, 0x26, 0x6D, 0x4C, 0xFF,
+    0xD2, 0x47, 0xB3, 0xEA, 0x9F, 0xFF, 0xE8, 0xE4, 0x33, 0x64, 0xB3, 0x90, 0x19, 0x49, 0x78, 0xC3,
+    0xC2, 0xBF, 0x39, 0xFF, 0x7C, 0x57, 0xDA, 0xDD, 0xB8, 0xDA, 0x7D, 0x5A, 0x76, 0x2F, 0xCA, 0xAE,
+    0xFC, 0xFB, 0x47, 0xC7, 0x65, 0x11, 0x9E, 0x8A, 0x4A, 0xB6, 0xB5, 0x3C, 0xFC, 0x8B, 0xF3, 0x57,
+    0x53, 0x59, 0x9F, 0xD5, 0xEB, 0xF2, 0xD9, 0xBA, 0x5C, 0x5C, 0x17, 0xF9, 0x2F, 0x8F, 0x6C, 0xCC,
+    0x77, 0x80, 0xEF, 0x80, 0x12, 0x7E, 0x63, 0x7E, 0x75, 0xF9, 0xDF, 0x9C, 0x83, 0xE7, 0x0E, 0xF7,
+    0xF9, 0xFE, 0x4C, 0x8A, 0x3E, 0x5E, 0x14, 0x68, 0xE8, 0x69, 0x9A, 0x22, 0xF6, 0x9C, 0xB3, 0x43,
+    0x25, 0xE7, 0x8E, 0xC7, 0x5A, 0xE3, 0x93, 0x35, 0x9F, 0x2B, 0x6E, 0xD9, 0x1A, 0xFF, 0xEB, 0xB3,
+    0x51, 0x68, 0x7C, 0xF3, 0xD3, 0x78, 0x8E, 0x19, 0xE0, 0xE9, 0x21, 0xD4, 0x5E, 0xB4, 0x08, 0x10,
+    0xA1, 0x23, 0x16, 0x59, 0x3D, 0xA6, 0x9D, 0xDD, 0x1B, 0xD3, 0xDE, 0xB6, 0xEE, 0x10, 0x2F, 0xB3,
+    0xB6, 0x0A, 0x73, 0xC8, 0xAA, 0x4C, 0x7C, 0xDE, 0x96, 0x3B, 0x3E, 0x6B, 0xEE, 0x46, 0x07, 0xE7,
+    0xAC, 0xB5, 0xB2, 0x22, 0x48, 0x47, 0xD3, 0xB9, 0x9D, 0x31, 0x1E, 0xD2, 0x2E, 0x6B, 0x4C, 0xBD,
+    0x49, 0xBD, 0x15, 0xF1, 0x69, 0x33, 0x26, 0x9D, 0x8B, 0x07, 0xBB, 0xE7, 0xF3, 0x06, 0x04, 0x3E,
+    0x9A, 0xB2, 0xDE, 0x1D, 0x21, 0xEF, 0xDD, 0x61, 0x9B, 0x56, 0xAA, 0xE3, 0x92, 0x21, 0x1F, 0x50,
+    0xE3, 0x68, 0x4C, 0xBC, 0x6D, 0xCA, 0x1B, 0x3E, 0xE9, 0x6D, 0xED, 0xE2, 0x3E, 0x6B, 0xDC, 0x6C,
+    0xC8, 0xEA, 0x2D, 0xB9, 0x49, 0x28, 0x79, 0x4C, 0x6D, 0x5C, 0x52, 0x6B, 0xB6, 0xE5, 0x0E, 0xBD,
+    0xB8, 0x90, 0x75, 0xE5, 0x7B, 0xA3, 0xFD, 0x05, 0x34, 0x72, 0xC5, 0x9B, 0x06, 0xF1, 0x60, 0x4E,
+    0x95, 0xE8, 0xEA, 0xA6, 0x1C, 0x88, 0xDE, 0x63, 0x0C, 0x56, 0x5B, 0x43, 0xC6, 0x43, 0xAB, 0xA7,
+    0xDB, 0x49, 0xFA, 0x81, 0xBF, 0x4E, 0x8A, 0x46, 0xBD, 0x51, 0x26, 0xE7, 0xEE, 0x45, 0xC3, 0x8A,
+    0x24, 0xDA, 0x97, 0x29, 0x2D, 0xF5, 0x62, 0x64, 0xE1, 0x6B, 0xFF, 0x0D, 0xCA, 0xA2, 0x37, 0x62,
+    0xD8, 0xCB, 0x83, 0xF0, 0xBA, 0xB6, 0xB5, 0x65, 0x48, 0x73, 0x0E, 0xE4, 0xA7, 0xF7, 0x22, 0x1F,
+    0x05, 0x0C, 0x35, 0xC8, 0x56, 0xA3, 0x90, 0x49, 0x27, 0x5F, 0x64, 0xEF, 0xFC, 0x8A, 0x50, 0x8C,
+    0x28, 0x7F, 0xFC, 0xCD, 0x5F, 0xCD, 0xEB, 0x0B, 0x4B, 0x16, 0xDA, 0x85, 0x05, 0xDE, 0xC9, 0x76,
+    0x74, 0x13, 0x7F, 0xA3, 0xF5, 0x6B, 0x07, 0xCF, 0x52, 0x52, 0x89, 0x1D, 0xB4, 0xAD, 0x5A, 0x0C,
+    0x56, 0x7B, 0xE9, 0xC8, 0x76, 0x6A, 0x47, 0xF5, 0xE9, 0x85, 0x90, 0xDC, 0xD5, 0x7D, 0xF7, 0x15,
+    0xDE, 0x9F, 0x4C, 0xBF, 0x21, 0x5B, 0xD5, 0xDA, 0x1E, 0x99, 0xBB, 0xCF, 0x9E, 0x77, 0xDD, 0x1B,
+    0x5F, 0xB6, 0xB6, 0x7B, 0x45, 0x36, 0xFF, 0x2C, 0xD4, 0x3F, 0x00, 0xAD, 0x55, 0xB1, 0x6F, 0xDF,
+    0x44, 0x14, 0xFE, 0xCE, 0x97, 0xC4, 0xF0, 0x3B, 0xA5, 0xD7, 0x21, 0x91, 0x52, 0x5A, 0x30, 0x03,
+    0x13, 0xA2, 0x78, 0x0D, 0x52, 0xA5, 0x73, 0xD5, 0x81, 0xA1, 0x03, 0x19, 0xCA, 0x84, 0x04, 0x0C,
+    0x30, 0xA2, 0x66, 0xC8, 0x8C, 0xAD, 0x32, 0x30, 0x30, 0xF0, 0x5B, 0xD8, 0x7F, 0x62, 0x2A, 0x4C,
+    0x1D, 0x59, 0x5A, 0x3B, 0x74, 0xA8, 0x04, 0x8B, 0x29, 0xFF, 0x80, 0x81, 0x16, 0x24, 0x3A, 0x70,
+    0x83, 0x91, 0x5C, 0x74, 0xF6, 0xE3, 0x3B, 0x27, 0x0D, 0x51, 0xC7, 0x96, 0x93, 0xCF, 0x7E, 0xB6,
+    0xEF, 0xBD, 0xFB, 0xEE, 0xDD, 0xF7, 0xBD, 0x5B, 0x54, 0x78, 0x1D, 0xB8, 0x69, 0x03, 0x9C, 0x87,
+    0xDC, 0x93, 0x22, 0x1B, 0x51, 0xFE, 0x2D, 0x6D, 0x1A, 0xAD, 0xF8, 0xA9, 0xD1, 0xA2, 0x96, 0xD8,
+    0x28, 0x70, 0x0E, 0x1B, 0xCB, 0xFA, 0x67, 0xF9, 0x72, 0xCA, 0xFD, 0x36, 0x70, 0x01, 0x30, 0x05,
+    0x92, 0x16, 0x38, 0xD8, 0xCD, 0xC2, 0xC1, 0xFA, 0x77, 0xFB, 0xE8, 0xF6, 0x75, 0xB5, 0x7F, 0x06,
+    0xFB, 0x5B, 0xD8, 0xC7, 0xB3, 0x5F, 0xB1, 0xED, 0x02, 0x1D, 0xD2, 0x0A, 0xAF, 0x00, 0xAE, 0xBF,
+    0xF0, 0xE6, 0xDE, 0xA6, 0xC1, 0x66, 0xD2, 0x6C, 0xE2, 0xD6, 0x26, 0xB6, 0x36, 0x81, 0xE7, 0xB9,
+    0x80, 0x3D, 0x64, 0x45, 0x1A, 0xF0, 0xE7, 0xFE, 0xEE, 0xD7, 0x3F, 0x2C, 0x16, 0xC5, 0xEA, 0xEC,
+    0x02, 0x58, 0xE1, 0x99, 0x6E, 0x6C, 0xAB, 0x16, 0xFA, 0x5E, 0x05, 0x7B, 0x06, 0xB8, 0xB4, 0x5B,
+    0x8B, 0x7F, 0xF4, 0xEE, 0x27, 0x6F, 0xAC, 0xD2, 0xAB, 0x0B, 0x75, 0xBF, 0x59, 0x1D, 0xDC, 0x5A,
+    0xAC, 0xAD, 0x71, 0xE4, 0x3C, 0xF4, 0x39, 0x1F, 0x73, 0xDB, 0x5F, 0xE1, 0xE2, 0x25, 0x98, 0x77,
+    0x90, 0xDC, 0x6D, 0x70, 0x4B, 0xE4, 0xB7, 0xCF, 0xBF, 0x7A, 0xFF, 0xCC, 0xCB, 0x58, 0xED, 0x1E,
+    0x2C, 0xF0, 0x4B, 0xBB, 0x52, 0xEA, 0x7F, 0x98, 0xE8, 0xF4, 0x7C, 0xA7, 0x5B, 0x37, 0xDF, 0x95,
+    0x74, 0x48, 0xC2, 0x6C, 0x1A, 0x09, 0xD0, 0xC3, 0x6C, 0x66, 0xBF, 0x4F, 0x30, 0x7E, 0x36, 0x5D,
+    0x25, 0xC8, 0xDA, 0xD9, 0x2C, 0x8B, 0x1A, 0xAE, 0x39, 0x32, 0xF9, 0x52, 0x1E, 0xC5, 0xA9, 0x69,
+    0x4E, 0x27, 0xE6, 0xE5, 0x70, 0x62, 0xEA, 0x1E, 0x4F, 0xDC, 0x8C, 0xDF, 0x58, 0x02, 0x1F, 0xD3,
+    0x7B, 0xB2, 0x6D, 0x3D, 0x72, 0xAA, 0x36, 0x97, 0x90, 0x7F, 0x26, 0x52, 0x38, 0xF1, 0x46, 0xBC,
+    0x4B, 0xFB, 0xB2, 0xA9, 0xDF, 0x0E, 0xEA, 0x4E, 0x31, 0xD9, 0x2E, 0x6F, 0xA6, 0x88, 0x49, 0x05,
+    0xDB, 0x66, 0x3F, 0x8D, 0x6A, 0x04, 0x71, 0x65, 0xAD, 0xFD, 0x35, 0x44, 0xD3, 0xF8, 0x13, 0x93,
+    0xBF, 0xDB, 0xEC, 0xFE, 0x6C, 0xE6, 0x4D, 0x16, 0xC7, 0x46, 0xB7, 0xB2, 0x60, 0x84, 0xC3, 0x49,
+    0xD3, 0x14, 0xD8, 0xBE, 0xAC, 0xE4, 0x6A, 0x0F, 0x8E, 0xD1, 0x22, 0x28, 0xB9, 0xDC, 0xB8, 0x46,
+    0x19, 0x90, 0x49, 0x05, 0xC5, 0x35, 0x6E, 0x17, 0x50, 0xD7, 0x08, 0xF3, 0xEC, 0x49, 0x66, 0x3E,
+    0xE2, 0xA2, 0x33, 0x6F, 0x83, 0x9E, 0x12, 0x81, 0x14, 0x75, 0xE5, 0x1A, 0xDB, 0x90, 0x66, 0xFC,
+    0xB1, 0x04, 0x91, 0x29, 0xD1, 0xA3, 0x16, 0xC3, 0xFF, 0x76, 0x30, 0x21, 0xF7, 0xB6, 0x77, 0x5D,
+    0xDE, 0x95, 0x8D, 0x6B, 0x04, 0x0E, 0xB7, 0xB1, 0x8E, 0xAD, 0x79, 0xAC, 0x2E, 0xF4, 0x40, 0xB4,
+    0x4D, 0xE6, 0x5D, 0x2B, 0x95, 0x7C, 0x2F, 0xE9, 0x18, 0x5D, 0x9C, 0xCF, 0x7D, 0x7D, 0x28, 0x85,
+    0x5C, 0x89, 0xFE, 0x03, 0xFF, 0x46, 0xCF, 0x64, 0x44, 0x48, 0xFA, 0xB4, 0xC3, 0x9E, 0x2A, 0x36,
+    0x40, 0x7D, 0x1A, 0xAF, 0x47, 0xAA, 0x35, 0xF7, 0x7A, 0x42, 0xD9, 0x98, 0x21, 0x2E, 0xA6, 0x51,
+    0xC5, 0x02, 0x3B, 0x2A, 0xE8, 0xDE, 0x0E, 0x39, 0xC3, 0x94, 0xAD, 0xEB, 0xA4, 0x61, 0x30, 0x30,
+    0x18, 0x61, 0x85, 0x64, 0x4C, 0x7B, 0xED, 0x4D, 0x9B, 0xE0, 0x05, 0xEE, 0xFA, 0x0E, 0x3E, 0x4C,
+    0xBD, 0x6D, 0xB9, 0x85, 0x37, 0x24, 0x0D, 0x26, 0x64, 0x04, 0x4A, 0x87, 0xBB, 0x92, 0xF0, 0x35,
+    0xEB, 0x23, 0xEE, 0xBA, 0x29, 0x1B, 0x2E, 0x27, 0xFA, 0xD9, 0xCE, 0x36, 0x79, 0xF1, 0x29, 0x5E,
+    0x45, 0xA5, 0x0A, 0x10, 0x83, 0x62, 0xA2, 0xCA, 0x2E, 0x26, 0x2A, 0x1D, 0x26, 0x35, 0xE9, 0x21,
+    0xAF, 0x6C, 0x8B, 0x17, 0x49, 0x87, 0x38, 0xB7, 0xF3, 0x8E, 0x28, 0x34, 0x77, 0xD0, 0x6B, 0x41,
+    0xEE, 0x99, 0xE1, 0x38, 0x63, 0xD6, 0x12, 0xAF, 0xEB, 0xF8, 0xA9, 0xF4, 0x26, 0xA4, 0xA2, 0x85,
+    0x69, 0x9C, 0xF8, 0x73, 0xE7, 0x38, 0xBB, 0x14, 0x16, 0xD2, 0x2F, 0x3A, 0xDD, 0x69, 0x7F, 0x27,
+    0x09, 0x04, 0xDB, 0xD5, 0x64, 0xCA, 0x68, 0xAF, 0xF4, 0xDC, 0xCF, 0xC8, 0x99, 0x31, 0xE1, 0xCD,
+    0xDE, 0x1F, 0xA0, 0xAA, 0x69, 0xD8, 0x49, 0x42, 0x36, 0x64, 0x4C, 0x4F, 0x30, 0x7D, 0x76, 0x28,
+    0x87, 0x41, 0x5D, 0x1E, 0xC3, 0x1A, 0xA9, 0x91, 0x55, 0x60, 0xC2, 0x88, 0x30, 0x20, 0xAF, 0xE8,
+    0x7E, 0x63, 0xC0, 0x68, 0xBC, 0x2B, 0x48, 0x01, 0xDD, 0xDF, 0xC6, 0x45, 0xB8, 0xC8, 0x7A, 0x5D,
+    0xCC, 0x73, 0x2E, 0x96, 0xEA, 0xA6, 0xEB, 0x4C, 0x28, 0x3B, 0x1B, 0xEA, 0x96, 0xBD, 0x99, 0xFB,
+    0x70, 0xDC, 0xFB, 0xD3, 0xBD, 0x3C, 0xEE, 0xAE, 0x32, 0xC7, 0x3D, 0xED, 0x5D, 0x93, 0xF6, 0x79,
+    0xA3, 0xFB, 0x2D, 0x24, 0x73, 0xC0, 0xF5, 0x02, 0x7B, 0xCE, 0xA7, 0x63, 0xE9, 0xAD, 0xC4, 0xEE,
+    0xBC, 0x19, 0x37, 0x0A, 0xB5, 0xFC, 0x96, 0xAD, 0x14, 0x91, 0xBF, 0xD8, 0xFF, 0xA1, 0xFD, 0xCD,
+    0xF6, 0x5E, 0x3D, 0xC9, 0x24, 0xE3, 0xF6, 0xB5, 0xD3, 0xB2, 0xCB, 0x1B, 0x1C, 0x29, 0xAD, 0x66,
+    0xB7, 0xFC, 0x32, 0x2B, 0xD0, 0x15, 0x38, 0x12, 0xDD, 0x18, 0x87, 0x70, 0x79, 0x3A, 0xBE, 0xDC,
+    0x89, 0x72, 0x8C, 0xE3, 0xFB, 0x59, 0x76, 0x91, 0xF4, 0xA7, 0xC6, 0x5B, 0x0E, 0x89, 0xF4, 0x27,
+    0x63, 0x8F, 0x9D, 0xA7, 0xD3, 0xF1, 0xCD, 0x53, 0x9A, 0xCF, 0x1F, 0x73, 0xCE, 0x0E, 0x75, 0x3C,
+    0x04, 0x26, 0x88, 0x70, 0xE7, 0x48, 0x1F, 0x09, 0x7C, 0x74, 0x6F, 0xBD, 0x37, 0xA9, 0x87, 0xD7,
+    0x7D, 0x14, 0x0D, 0xD2, 0x61, 0x0E, 0xAF, 0xC2, 0xD1, 0x2C, 0xE1, 0x28, 0xFE, 0x08, 0x55, 0x17,
+    0x60, 0xA9, 0xBD, 0x2E, 0xAC, 0x1B, 0xC1, 0x30, 0x84, 0x93, 0xDE, 0x52, 0x4B, 0xA5, 0xB4, 0x96,
+    0x72, 0x72, 0x13, 0xF5, 0xC6, 0xB1, 0x2D, 0x4C, 0x37, 0x7B, 0x92, 0xCE, 0xC8, 0x8B, 0x39, 0x69,
+    0x6B, 0xFF, 0xA1, 0xA0, 0x92, 0x48, 0xB0, 0x34, 0xAA, 0xD6, 0xC3, 0x4E, 0xF1, 0x4C, 0x78, 0xF2,
+    0x30, 0xFC, 0xC8, 0x43, 0x8A, 0x07, 0x54, 0x3C, 0xA1, 0x62, 0x7B, 0x69, 0x59, 0x3F, 0x20, 0xA6,
+    0x2F, 0x58, 0x9C, 0xCC, 0xE8, 0x78, 0x77, 0x3D, 0x01, 0x53, 0x18, 0x0F, 0xAF, 0x93, 0x7C, 0x31,
+    0x03, 0x3C, 0xEA, 0x98, 0x14, 0x7A, 0x71, 0x46, 0xE1, 0xCA, 0x49, 0x37, 0xE0, 0x7C, 0x4F, 0xC5,
+    0x9C, 0xA7, 0x7C, 0xBA, 0x08, 0xB3, 0xAC, 0x9C, 0x74, 0x6A, 0x8A, 0xB2, 0xD7, 0x83, 0x8E, 0x95,
+    0xA3, 0x9B, 0x11, 0x56, 0x91, 0x45, 0x13, 0x5E, 0x9B, 0x01, 0x9D, 0x80, 0x5B, 0x2F, 0x32, 0xAE,
+    0x82, 0x8A, 0xE5, 0x99, 0x45, 0xFE, 0x56, 0xC8, 0xC3, 0x8C, 0xAB, 0x8B, 0x90, 0xCE, 0x91, 0x4C,
+    0x91, 0x58, 0x0C, 0xDA, 0x53, 0x1D, 0x99, 0xF4, 0x66, 0x4C, 0x44, 0xDA, 0xBA, 0xC9, 0x84, 0x35,
+    0x01, 0x8F, 0x3F, 0x20, 0xB3, 0xB8, 0xB2, 0x1F, 0xE3, 0x16, 0x4D, 0xD1, 0x34, 0x8F, 0xA2, 0x59,
+    0xCF, 0x5F, 0xFF, 0x08, 0xCC, 0xE1, 0x58, 0x36, 0x4A, 0xE4, 0xEE, 0x80, 0x9C, 0x85, 0xAF, 0x4A,
+    0xE4, 0x01, 0xF7, 0x2A, 0xEF, 0x58, 0x1C, 0x99, 0x6F, 0xEE, 0x2C, 0x6B, 0xCD, 0xD6, 0x8C, 0x03,
+    0xC7, 0x54, 0xDB, 0x62, 0xE9, 0x82, 0x65, 0x96, 0x7D, 0x22, 0x4D, 0x4A, 0xAD, 0xC5, 0xB3, 0x5D,
+    0x49, 0xC1, 0x1A, 0xB3, 0xB1, 0xF7, 0x74, 0x59, 0xFF, 0x17, 0xA5, 0x55, 0xB1, 0x8E, 0xDD, 0x44,
+    0x14, 0xBD, 0xB6, 0xD9, 0x67, 0xB4, 0x23, 0x31, 0x14, 0xD9, 0x26, 0x48, 0xB8, 0xA1, 0x42, 0x02,
+    0xFF, 0x00, 0x62, 0x4C, 0x22, 0x94, 0x22, 0x45, 0x40, 0xCA, 0x03, 0x21, 0x8A, 0x50, 0x50, 0x00,
+    0x4D, 0x7E, 0x00, 0xC9, 0x26, 0x11, 0xA2, 0xA0, 0xC8, 0x36, 0xF4, 0x91, 0x48, 0xC3, 0x52, 0xA4,
+    0x8D, 0x50, 0xC8, 0x18, 0x28, 0xB6, 0x35, 0x42, 0x28, 0xAD, 0x05, 0x29, 0x88, 0x52, 0xC4, 0x01,
+    0xA3, 0x38, 0x4F, 0x63, 0x1F, 0xCE, 0x9D, 0x7D, 0xBB, 0xA9, 0x10, 0x05, 0xD6, 0xD3, 0xE8, 0xCE,
+    0x7B, 0xBE, 0x33, 0xE7, 0x9E, 0x73, 0xEE, 0x7D, 0x22, 0x7C, 0x12, 0xDC, 0x93, 0xD7, 0x0C, 0x50,
+    0xA1, 0x00, 0x30, 0xBB, 0xA6, 0xC6, 0xF4, 0x9C, 0xA4, 0xE8, 0x24, 0x3E, 0x1F, 0xCA, 0x7E, 0x56,
+    0xED, 0x8A, 0xED, 0xCB, 0xB6, 0x4E, 0xE6, 0x04, 0xD9, 0x6C, 0x27, 0xD7, 0xBB, 0xC1, 0xFF, 0x80,
+    0xB3, 0x4B, 0xB6, 0x70, 0x33, 0xF8, 0xD6, 0xFF, 0x88, 0x9C, 0xDF, 0xDB, 0xD1, 0xF5, 0xB8, 0x82,
+    0x74, 0xC9, 0x83, 0x1D, 0x5C, 0xEB, 0x5A, 0xA4, 0x73, 0x3E, 0x65, 0x83, 0xE9, 0x8A, 0xE6, 0x75,
+    0xD9, 0x91, 0x53, 0xF2, 0x81, 0x34, 0x72, 0x74, 0x69, 0x2F, 0x0E, 0x63, 0x06, 0x0C, 0xC5, 0xE0,
+    0x3A, 0x54, 0xF5, 0xD5, 0x20, 0xB0, 0x43, 0x16, 0xEA, 0xD6, 0x3E, 0x82, 0xB8, 0x9F, 0xE2, 0xD6,
+    0x4C, 0x65, 0xEF, 0xDA, 0x1A, 0x8B, 0xD4, 0x4C, 0xA8, 0x67, 0x39, 0x79, 0x4C, 0x27, 0x19, 0xB7,
+    0xBE, 0x93, 0x62, 0x96, 0x8C, 0x60, 0xC3, 0x2C, 0xE5, 0x85, 0xCE, 0xF4, 0x73, 0x12, 0x6C, 0xE7,
+    0x0E, 0xF0, 0x35, 0x8B, 0x61, 0x41, 0x83, 0x58, 0x16, 0xC2, 0x37, 0x6D, 0xAC, 0xC7, 0x62, 0x74,
+    0xF8, 0x19, 0xC8, 0x07, 0x29, 0x1B, 0xF1, 0xF7, 0x52, 0x84, 0x95, 0x0F, 0x62, 0x47, 0x29, 0x78,
+    0x7E, 0x93, 0x87, 0x03, 0xFC, 0x8E, 0x25, 0xC7, 0xFE, 0xF6, 0x9A, 0x04, 0x55, 0x8E, 0x81, 0xFB,
+    0x7C, 0xD1, 0xFB, 0x52, 0x7C, 0x23, 0x3C, 0xD3, 0x3D, 0x40, 0xD1, 0xB9, 0xC3, 0x31, 0x1F, 0x97,
+    0x64, 0x76, 0xAD, 0x37, 0x8B, 0x6F, 0x81, 0xD6, 0x20, 0x16, 0x57, 0xE3, 0x0F, 0x8F, 0x99, 0x54,
+    0xCE, 0xD9, 0x14, 0xF2, 0xE1, 0x25, 0xDE, 0xEC, 0x1A, 0xA9, 0x45, 0x16, 0x49, 0x83, 0x64, 0x41,
+    0xF2, 0x51, 0xCC, 0xA0, 0x1F, 0xA2, 0xD8, 0x3E, 0xF5, 0x24, 0x1E, 0x6D, 0x7D, 0x6E, 0x2A, 0x79,
+    0xDA, 0xE0, 0x3E, 0x43, 0xD9, 0x16, 0x68, 0x33, 0xBD, 0x1A, 0x67, 0xA7, 0xE2, 0x51, 0x48, 0x43,
+    0x2D, 0xDE, 0x8E, 0xF5, 0x15, 0xDE, 0x53, 0xA0, 0x3A, 0xCE, 0xF3, 0x23, 0xF1, 0x34, 0x78, 0x38,
+    0x92, 0xEB, 0x08, 0xC9, 0x0C, 0x48, 0x43, 0xB9, 0x01, 0x99, 0x6D, 0x4F, 0x93, 0xB3, 0x82, 0x85,
+    0x8E, 0x89, 0x9F, 0x32, 0x4C, 0x52, 0xF7, 0x31, 0xE7, 0x85, 0xC3, 0x29, 0x05, 0x42, 0x8A, 0x07,
+    0x63, 0x1A, 0x6C, 0x6F, 0xFA, 0xB2, 0x29, 0x9B, 0x3B, 0x72, 0x27, 0x9D, 0xD2, 0xC9, 0xC4, 0x2D,
+    0x7E, 0xC3, 0x21, 0xAE, 0x41, 0x64, 0xB5, 0x2F, 0x31, 0x11, 0x53, 0xB6, 0x5C, 0x1E, 0xCA, 0xBE,
+    0xEC, 0x4F, 0xA4, 0x89, 0x4A, 0x0D, 0x71, 0x9B, 0x2C, 0x54, 0x6A, 0x2C, 0xE9, 0x03, 0x87, 0x40,
+    0x59, 0x5B, 0x39, 0x7D, 0x43, 0xE4, 0x19, 0x59, 0x85, 0x15, 0x86, 0x12, 0xCD, 0xCB, 0xE4, 0x6E,
+    0xA2, 0x83, 0x94, 0x86, 0xA7, 0x21, 0xA9, 0x05, 0xEE, 0x02, 0x6F, 0xAE, 0x2F, 0xCA, 0x7B, 0x55,
+    0x02, 0x7A, 0x0B, 0x1D, 0x2E, 0x4D, 0xAE, 0x81, 0xE9, 0xEA, 0x56, 0xCA, 0x4E, 0xC1, 0x1F, 0x7D,
+    0xCA, 0x5E, 0x3F, 0x0E, 0xB8, 0x00, 0xFC, 0x42, 0x01, 0xF6, 0xD6, 0x6F, 0x31, 0xC7, 0x60, 0x2C,
+    0x11, 0xDC, 0x99, 0xF9, 0x95, 0x64, 0x56, 0x5E, 0x8B, 0x21, 0x43, 0x4F, 0x45, 0x25, 0x5D, 0x44,
+    0xA0, 0x6B, 0x11, 0x9C, 0x0A, 0xDE, 0xED, 0xDE, 0x17, 0x05, 0x24, 0xC5, 0x91, 0x6B, 0x68, 0x97,
+    0x72, 0x16, 0xF3, 0xB0, 0x4B, 0xE8, 0x1A, 0x67, 0x3B, 0xDB, 0xCD, 0xE9, 0x44, 0xD7, 0x00, 0x7F,
+    0xD1, 0x35, 0xBB, 0x07, 0xB8, 0x7E, 0xEC, 0x1A, 0xA3, 0xAE, 0x89, 0x8E, 0x39, 0x87, 0x50, 0xB4,
+    0xE2, 0xAB, 0x14, 0xA3, 0xC5, 0x94, 0xD4, 0x11, 0x54, 0xDD, 0xA4, 0xB3, 0x5C, 0x66, 0xD2, 0x79,
+    0x8C, 0xE6, 0x7E, 0xEC, 0x96, 0x1C, 0x8D, 0xC1, 0x60, 0x17, 0x31, 0x14, 0x9A, 0x72, 0x6B, 0x63,
+    0x11, 0xC3, 0x15, 0xCA, 0x53, 0xDE, 0x9D, 0xF2, 0x11, 0x74, 0x4C, 0x07, 0xCA, 0xCA, 0x3E, 0x6B,
+    0xD2, 0xEF, 0xA2, 0x88, 0x08, 0x50, 0xC3, 0x84, 0x90, 0x8D, 0xB7, 0xC8, 0x0D, 0xEF, 0x71, 0x95,
+    0x78, 0x05, 0xC0, 0xAA, 0xC8, 0x97, 0x39, 0x36, 0x4C, 0x4A, 0x05, 0x4F, 0x57, 0x82, 0x59, 0xE0,
+    0x3B, 0x9F, 0xD1, 0x2D, 0x77, 0xCC, 0xE8, 0x2A, 0xF8, 0xC6, 0xA2, 0xC9, 0x31, 0x99, 0xBF, 0x71,
+    0x75, 0xB4, 0xD1, 0x2D, 0x95, 0xB7, 0x1B, 0xBC, 0xC1, 0xDB, 0x57, 0x4F, 0x44, 0x3E, 0xA6, 0x91,
+    0x27, 0xF2, 0xDB, 0xE2, 0x7D, 0xE5, 0x97, 0x50, 0x0E, 0x27, 0x3A, 0xE5, 0x4C, 0x60, 0x87, 0xE8,
+    0xD7, 0x49, 0x4D, 0x46, 0x06, 0xA9, 0x87, 0x5D, 0xED, 0xC9, 0x5E, 0x5E, 0x6D, 0x64, 0x6F, 0xBD,
+    0x5E, 0xBF, 0x4D, 0x36, 0xE8, 0x04, 0x3E, 0x89, 0xDF, 0x20, 0x24, 0x68, 0xB2, 0x91, 0x8D, 0x60,
+    0xDB, 0x62, 0x12, 0x17, 0xED, 0x94, 0xA8, 0xE5, 0x73, 0x50, 0x42, 0x9E, 0xA4, 0x46, 0x41, 0xC7,
+    0xF3, 0x20, 0x7C, 0x8B, 0x6C, 0x4F, 0x22, 0xBB, 0xD8, 0xEC, 0xAB, 0x70, 0x95, 0x7C, 0xCB, 0xDE,
+    0x89, 0x5F, 0xC5, 0x44, 0x03, 0xD5, 0x88, 0x85, 0x90, 0x89, 0x51, 0x49, 0x48, 0x17, 0x9A, 0xBA,
+    0xD4, 0x98, 0x44, 0xF0, 0xDC, 0x73, 0x74, 0xCA, 0x42, 0x09, 0xF3, 0x40, 0x71, 0xC9, 0x25, 0x5D,
+    0xA3, 0xB9, 0xEC, 0x54, 0x49, 0x6F, 0x6E, 0x6E, 0x56, 0x24, 0x16, 0x55, 0xEA, 0x97, 0x03, 0x51,
+    0xE4, 0xB2, 0xAA, 0x37, 0x07, 0xEC, 0x6E, 0x9E, 0x6A, 0x35, 0x5F, 0x9C, 0x0A, 0x47, 0x17, 0x91,
+    0x5D, 0x22, 0xDC, 0xC3, 0x57, 0xEF, 0xDC, 0x26, 0x0A, 0x84, 0x52, 0x97, 0x62, 0x43, 0xB0, 0xAB,
+    0x46, 0xD6, 0x55, 0xF2, 0x09, 0x6E, 0x6C, 0x5B, 0x49, 0x7F, 0xAE, 0x9E, 0x86, 0xDB, 0xF1, 0xB7,
+    0xC2, 0xAF, 0x38, 0xEE, 0x52, 0xB4, 0xE5, 0x74, 0x12, 0xDA, 0x20, 0x1F, 0x9D, 0x84, 0xEC, 0xEB,
+    0xE3, 0x30, 0x3B, 0x09, 0x27, 0xCA, 0x2F, 0x7B, 0x31, 0x6D, 0xBC, 0x8C, 0x39, 0x25, 0x3F, 0x68,
+    0xFD, 0x23, 0x16, 0x6D, 0x09, 0x13, 0xAA, 0x06, 0xF1, 0x74, 0xDF, 0x6B, 0xA8, 0x15, 0xBA, 0xF6,
+    0x53, 0x86, 0xF7, 0x62, 0xD8, 0x9F, 0xE2, 0xBB, 0xA2, 0x61, 0x49, 0x5E, 0xB6, 0xA1, 0x25, 0x92,
+    0x6D, 0xA8, 0x2E, 0xDF, 0x86, 0x7C, 0xE3, 0x38, 0x7C, 0x31, 0xDD, 0x86, 0x74, 0xB5, 0x2C, 0x9C,
+    0xE9, 0xAA, 0x0D, 0x5C, 0x3A, 0xB3, 0xA0, 0x86, 0x56, 0x5C, 0xD8, 0x9F, 0x51, 0x0B, 0xBA, 0xA1,
+    0xC4, 0xD1, 0x34, 0x90, 0x9D, 0x4A, 0xD6, 0x3A, 0xE9, 0xFC, 0x75, 0x55, 0x85, 0xE9, 0x71, 0x6A,
+    0x16, 0xCB, 0xBB, 0xBC, 0x30, 0xD0, 0x85, 0x5C, 0x4A, 0x0E, 0x46, 0x31, 0x6D, 0xB6, 0xC4, 0x89,
+    0xF8, 0xF9, 0xC5, 0x23, 0xA2, 0xA3, 0x02, 0xFA, 0xB3, 0x30, 0x94, 0xE7, 0x35, 0x2F, 0xE8, 0x09,
+    0x6C, 0x9B, 0x4B, 0x33, 0x8F, 0x4C, 0xE3, 0x38, 0x74, 0x43, 0x1C, 0xBB, 0x31, 0xF3, 0x49, 0x72,
+    0x5B, 0xDF, 0x82, 0x24, 0x31, 0xD5, 0x44, 0xC2, 0x77, 0x2E, 0xC6, 0xD6, 0x24, 0x54, 0x55, 0x4B,
+    0x39, 0x93, 0x5C, 0x07, 0x7D, 0x3E, 0x1D, 0x2D, 0xC9, 0xFA, 0xAC, 0x3A, 0x70, 0xA3, 0xCB, 0x52,
+    0xEB, 0xFA, 0xC5, 0x13, 0x7A, 0xB3, 0xAA, 0x9B, 0xE3, 0xD7, 0xC5, 0x6B, 0xA6, 0xD1, 0xE5, 0xE8,
+    0xEF, 0xC5, 0x54, 0x51, 0x76, 0x9D, 0xC7, 0x5E, 0xDB, 0x11, 0x8D, 0xAF, 0xEB, 0x2F, 0xC7, 0x50,
+    0x5F, 0xBB, 0x3A, 0xDC, 0x7E, 0xB6, 0x68, 0xE3, 0x34, 0x4E, 0x98, 0xCA, 0x49, 0xAC, 0x33, 0x41,
+    0x6A, 0x52, 0x32, 0xFF, 0xEB, 0x76, 0x8B, 0xCF, 0x56, 0x5B, 0xFF, 0xE9, 0xBF, 0x82, 0xDE, 0x32,
+    0xEE, 0xB0, 0x4A, 0x7F, 0x5E, 0x21, 0xFD, 0x19, 0xD1, 0x79, 0x5D, 0x89, 0x6D, 0xED, 0xF5, 0xF7,
+    0xB8, 0xE0, 0x64, 0xB1, 0xCD, 0x16, 0xDF, 0x7F, 0x5F, 0xA8, 0x5B, 0x45, 0x37, 0x88, 0x82, 0xBD,
+    0xE5, 0x4C, 0xC4, 0xFE, 0xF8, 0x71, 0x20, 0xEF, 0xAD, 0x85, 0x3A, 0x81, 0xD5, 0x91, 0x1F, 0xD3,
+    0xC8, 0xFF, 0x79, 0xFE, 0x01, 0xC5, 0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xBF, 0x85, 0x33,
+    0x91, 0x05, 0x4E, 0x89, 0x42, 0xE1, 0x7F, 0xC0, 0x6B, 0x28, 0x28, 0x40, 0xEB, 0x23, 0x42, 0xAF,
+    0xA0, 0x49, 0x11, 0x2B, 0x12, 0x14, 0xD7, 0xD0, 0x10, 0x8A, 0x50, 0x50, 0x72, 0xAC, 0x15, 0x44,
+    0x45, 0x73, 0xCD, 0xFD, 0x03, 0xD2, 0x5C, 0x93, 0xFC, 0x00, 0x60, 0x0D, 0xAF, 0xA0, 0x8C, 0x1F,
+    0x51, 0x94, 0xF6, 0x81, 0x84, 0x90, 0xD2, 0xE0, 0x48, 0x3E, 0xE2, 0xDC, 0x79, 0x3D, 0x7C, 0xDF,
+    0xBE, 0x7B, 0x77, 0x89, 0x42, 0xCF, 0x4A, 0x6F, 0x6C, 0xEF, 0xCC, 0xCE, 0x7E, 0x33, 0xF3, 0xCD,
+    0x3C, 0x11, 0xAE, 0x4C, 0x4C, 0x2D, 0x59, 0x67, 0x06, 0xC9, 0x46, 0xD1, 0x3A, 0xC3, 0x73, 0xC8,
+    0x7A, 0x11, 0xB7, 0x50, 0xAC, 0xA7, 0x14, 0xEA, 0x29, 0xBE, 0x3B, 0xAE, 0x2A, 0x57, 0xFB, 0x52,
+    0x1C, 0x8D, 0x7C, 0x2D, 0x2A, 0xB6, 0x96, 0x5C, 0x4C, 0x23, 0x17, 0xCB, 0x8A, 0x18, 0xC5, 0x43,
+    0xF1, 0x80, 0x5E, 0xD5, 0x84, 0x51, 0xB3, 0xE5, 0x93, 0xE1, 0x52, 0xFE, 0x4B, 0x4D, 0xAD, 0x8C,
+    0xB0, 0xE8, 0x44, 0xF2, 0x26, 0x1A, 0x1F, 0x8C, 0x6F, 0x66, 0xCB, 0x6E, 0xB0, 0xF7, 0xEF, 0x77,
+    0xCE, 0x7B, 0x1C, 0xE8, 0x78, 0x56, 0x6C, 0x17, 0xB5, 0x72, 0x19, 0xBF, 0x9D, 0x12, 0x60, 0x4A,
+    0xC9, 0xB4, 0x16, 0x0F, 0x7C, 0xAA, 0xB5, 0x3A, 0xB7, 0xEC, 0x47, 0x67, 0xBE, 0xE9, 0xEE, 0x6D,
+    0xFD, 0xC0, 0x6D, 0x62, 0xBA, 0xCB, 0x45, 0xBE, 0x6C, 0xD5, 0xDA, 0x9F, 0x55, 0x43, 0xA2, 0xDA,
+    0x26, 0x1A, 0x44, 0xB4, 0xA1, 0x16, 0x50, 0x26, 0xDD, 0xAC, 0x53, 0xFC, 0x6A, 0x91, 0xD9, 0xF7,
+    0x22, 0x45, 0x1B, 0x7D, 0x27, 0x30, 0x4B, 0xFB, 0xF3, 0x4F, 0x09, 0xF2, 0x9A, 0xE9, 0xE5, 0x87,
+    0xBC, 0xCD, 0x46, 0x5B, 0xFA, 0x26, 0xA4, 0x83, 0xE9, 0xDD, 0xE1, 0xDE, 0x23, 0x1C, 0xBC, 0x05,
+    0xD7, 0xF0, 0xD5, 0x39, 0x78, 0x88, 0x3F, 0x1E, 0xC1, 0x0D, 0x5F, 0x01, 0x03, 0x4E, 0xDE, 0x84,
+    0x5F, 0x38, 0xCB, 0x2E, 0x9C, 0x25, 0x08, 0x38, 0x45, 0x38, 0x05, 0x8C, 0x5C, 0x52, 0x27, 0x63,
+    0x51, 0xA7, 0x9D, 0xD6, 0x45, 0xA3, 0xA5, 0x13, 0xBF, 0x1B, 0x2A, 0xCF, 0x44, 0xEF, 0x01, 0x9E,
+    0x83, 0x5B, 0x11, 0x8F, 0xDC, 0xF4, 0x92, 0x68, 0xC9, 0x87, 0xE4, 0xF0, 0xF9, 0x4A, 0xCC, 0x6C,
+    0x3A, 0x40, 0x14, 0x6B, 0xE6, 0xB8, 0x4C, 0x6B, 0x40, 0xB4, 0xB5, 0xE9, 0x4D, 0x90, 0xBC, 0xB5,
+    0x8D, 0xD8, 0xAB, 0xD0, 0x12, 0x97, 0xFE, 0xC3, 0x08, 0x09, 0x54, 0x3F, 0x7A, 0x56, 0x55, 0xD7,
+    0x09, 0x04, 0x05, 0xA5, 0x00, 0x0E, 0x18, 0x43, 0xBC, 0x2E, 0x2F, 0xAE, 0x7B, 0x14, 0x3E, 0x8A,
+    0x72, 0x2B, 0x5C, 0x59, 0x7D, 0x7C, 0x00, 0x40, 0x3A, 0x50, 0x4C, 0xAE, 0xC2, 0xBA, 0x45, 0x45,
+    0x0A, 0x16, 0x54, 0xD7, 0x48, 0x88, 0x29, 0xE3, 0x2D, 0xB5, 0x3F, 0xBC, 0x79, 0xB4, 0xCE, 0xBA,
+    0x73, 0x1F, 0x9B, 0xD7, 0xEE, 0xC2, 0xFD, 0xA7, 0xB2, 0x49, 0xAE, 0x38, 0x88, 0xF4, 0x29, 0x84,
+    0x5F, 0x80, 0x64, 0xA1, 0x00, 0x89, 0x7A, 0x37, 0x64, 0xA7, 0xAB, 0xD3, 0xC1, 0xEE, 0x2D, 0x1E,
+    0x75, 0xEF, 0xEC, 0x17, 0x0B, 0x49, 0xFA, 0x7D, 0x58, 0xAD, 0x98, 0xBF, 0x05, 0xC0, 0xEE, 0x17,
+    0xA5, 0xCC, 0xB8, 0x95, 0xAD, 0x10, 0xC4, 0x7C, 0x81, 0xF8, 0x7F, 0x2C, 0x6A, 0x6C, 0x7D, 0xFD,
+    0xFC, 0xD6, 0xD9, 0x7A, 0x37, 0x32, 0xB0, 0xDE, 0x26, 0x0B, 0xF5, 0xB9, 0x72, 0x78, 0x3D, 0xED,
+    0x23, 0xCE, 0x0F, 0x28, 0x7A, 0x86, 0xE1, 0x62, 0x18, 0xBF, 0xE3, 0xED, 0x46, 0x4C, 0xD6, 0xC0,
+    0x60, 0x86, 0xB7, 0x8F, 0xEE, 0x7C, 0xC2, 0x43, 0xE6, 0x45, 0x21, 0xEF, 0x6D, 0x9D, 0x5F, 0x99,
+    0x1D, 0xFC, 0xE7, 0xDD, 0x9B, 0xAD, 0x97, 0x40, 0x33, 0x0E, 0x83, 0xAD, 0x2F, 0x6C, 0xB1, 0x78,
+    0xD0, 0xE9, 0x7E, 0xE1, 0x1A, 0x46, 0x2B, 0x7E, 0x45, 0x1E, 0x23, 0x01, 0xE2, 0x49, 0x1F, 0xCF,
+    0x4B, 0x3C, 0x21, 0x7F, 0xB9, 0xBD, 0x68, 0xD6, 0xBC, 0x01, 0x31, 0xE6, 0x6B, 0x30, 0x29, 0x99,
+    0x48, 0xA7, 0x62, 0x3D, 0x63, 0xBE, 0x29, 0x74, 0x15, 0x00, 0x3C, 0x04, 0x72, 0xE1, 0xEF, 0x87,
+    0x55, 0xB5, 0xF7, 0x07, 0x37, 0xD7, 0x73, 0x8A, 0x68, 0x29, 0xB6, 0xC1, 0x49, 0x33, 0xE6, 0xA8,
+    0xC0, 0xFB, 0x09, 0x44, 0xC2, 0x26, 0xF2, 0xEC, 0xB8, 0x5E, 0x01, 0xD7, 0x2E, 0xD1, 0x0F, 0x33,
+    0xD4, 0x8E, 0x1B, 0x79, 0x20, 0x79, 0xED, 0xC8, 0x4B, 0xDC, 0xC9, 0xD1, 0xDD, 0x4E, 0x62, 0x49,
+    0x79, 0xD1, 0x28, 0xA9, 0x92, 0x8F, 0x30, 0x01, 0x21, 0xE6, 0xA3, 0x19, 0xD9, 0x95, 0x70, 0x2D,
+    0xDA, 0xA2, 0xCE, 0x89, 0x2E, 0x07, 0xB6, 0x3A, 0x59, 0x9D, 0x05, 0x16, 0xBE, 0x50, 0xD6, 0xD8,
+    0xB2, 0xDB, 0xC4, 0x4F, 0x0C, 0x84, 0x6C, 0x86, 0x49, 0xAC, 0x07, 0xC9, 0x27, 0x97, 0x28, 0x92,
+    0x9F, 0x90, 0x1C, 0x05, 0xBD, 0x3D, 0x9A, 0x33, 0x7F, 0x08, 0x64, 0x07, 0x33, 0xDA, 0xE4, 0x34,
+    0xF1, 0xCD, 0x99, 0x2D, 0xDA, 0x6A, 0x7E, 0x8A, 0x78, 0xD0, 0xC4, 0x28, 0x5F, 0x98, 0x69, 0xA9,
+    0x8D, 0x6D, 0xD3, 0x11, 0x54, 0x76, 0x8D, 0x82, 0xCC, 0x05, 0xB0, 0xDE, 0x9E, 0x24, 0xEF, 0xEC,
+    0x3A, 0x51, 0x33, 0x89, 0x5D, 0xDB, 0xB5, 0x19, 0x31, 0x7B, 0xB4, 0x9C, 0xF7, 0xDC, 0x43, 0x04,
+    0x99, 0x4E, 0xC4, 0x85, 0x7A, 0xBF, 0x1A, 0xA1, 0xE9, 0x94, 0x23, 0xA6, 0x07, 0x24, 0x82, 0x3E,
+    0xBE, 0x1B, 0x08, 0xAE, 0x64, 0x3C, 0xD0, 0xB1, 0xD5, 0xE2, 0xC6, 0x87, 0x55, 0xA9, 0xBF, 0xD1,
+    0x02, 0xAC, 0x08, 0x4C, 0xEB, 0x4B, 0x16, 0xDB, 0x8D, 0xE3, 0xC7, 0x47, 0x7B, 0xC1, 0x6D, 0x7A,
+    0x37, 0x76, 0xDC, 0x39, 0xE7, 0x93, 0xCF, 0xCA, 0x59, 0x2D, 0x6F, 0x81, 0x74, 0x03, 0x6F, 0x3D,
+    0x89, 0xD3, 0x07, 0x78, 0xEC, 0x24, 0x1E, 0x72, 0xA0, 0x13, 0xB0, 0x3F, 0xD1, 0x0E, 0x41, 0x63,
+    0x46, 0xA5, 0x01, 0x53, 0x42, 0x6F, 0x2B, 0xE4, 0xBC, 0xD3, 0x26, 0x09, 0x18, 0x3B, 0x6B, 0x41,
+    0xD0, 0xF9, 0x80, 0x3E, 0xF7, 0xCB, 0x09, 0x12, 0x8A, 0x1A, 0xF9, 0x82, 0x22, 0x88, 0x99, 0xB2,
+    0x71, 0xC2, 0xC1, 0x5D, 0xC6, 0x87, 0xBC, 0x40, 0xFA, 0x36, 0xD5, 0x58, 0x66, 0xED, 0xE1, 0x56,
+    0x48, 0xE9, 0x3E, 0x4A, 0xBC, 0xA3, 0x90, 0x2D, 0xE6, 0xF4, 0xCE, 0x9D, 0xE7, 0x9B, 0xFE, 0x1A,
+    0x71, 0x6A, 0x6C, 0x98, 0x38, 0x1D, 0x62, 0xDD, 0x34, 0xF2, 0x8A, 0x34, 0x31, 0xA7, 0xD4, 0x39,
+    0x46, 0x9D, 0x3D, 0xA1, 0x2E, 0xB0, 0x3E, 0xF3, 0x06, 0x3A, 0x33, 0xF0, 0x2A, 0x57, 0x42, 0x97,
+    0x77, 0x2C, 0xEF, 0x24, 0xC5, 0x08, 0x15, 0xB2, 0x02, 0x92, 0xE4, 0x13, 0xC7, 0xA2, 0xEB, 0xC0,
+    0x3F, 0x03, 0x80, 0x70, 0x3F, 0xDA, 0x96, 0x74, 0x51, 0xDD, 0x8C, 0x38, 0xD5, 0xBF, 0xE2, 0x2B,
+    0x53, 0xA2, 0x4E, 0xB7, 0xEB, 0x99, 0xFE, 0x59, 0xDD, 0x08, 0x96, 0x59, 0x21, 0x37, 0xFD, 0x2E,
+    0x2E, 0xB5, 0x0D, 0xBE, 0x8B, 0x35, 0xBE, 0xF3, 0x2E, 0xD1, 0xC6, 0x30, 0x77, 0x60, 0x2A, 0xBE,
+    0x35, 0xC6, 0x8D, 0x3F, 0x94, 0x01, 0xF7, 0xA6, 0x1A, 0x69, 0xF9, 0x2B, 0xB0, 0xCE, 0x4F, 0x38,
+    0x6D, 0x63, 0x18, 0xCA, 0x00, 0xE6, 0x64, 0x96, 0xD9, 0xC4, 0xC6, 0x39, 0x51, 0xB0, 0x46, 0x33,
+    0x0E, 0x00, 0xF9, 0x9C, 0x19, 0x62, 0x81, 0x5B, 0x12, 0x1D, 0xC3, 0x18, 0x22, 0xA4, 0x7A, 0x20,
+    0x9B, 0x5A, 0x03, 0x07, 0x89, 0x1B, 0x59, 0x09, 0x72, 0xC5, 0x8D, 0x6F, 0xD1, 0x7A, 0xF1, 0x5F,
+    0x31, 0x96, 0x5C, 0x63, 0xF1, 0xF5, 0x58, 0x0F, 0xB1, 0x7D, 0x35, 0x32, 0x7E, 0x63, 0x3D, 0xEF,
+    0x65, 0xEB, 0x44, 0x5C, 0x1C, 0x22, 0x2C, 0x44, 0x38, 0x2B, 0x4A, 0xBC, 0x52, 0x76, 0x36, 0xCC,
+    0xFA, 0x5F, 0xD7, 0xBF, 0xC5, 0x55, 0x31, 0x8B, 0xDE, 0x46, 0x10, 0x1D, 0x49, 0xE4, 0x44, 0x2C,
+    0x82, 0xDC, 0x5C, 0x0A, 0xBB, 0xD8, 0x1F, 0x90, 0x42, 0x4D, 0xEA, 0xAC, 0x9C, 0xE0, 0x2A, 0xCD,
+    0x05, 0x2C, 0x5C, 0x5C, 0x71, 0xBD, 0x9B, 0xB4, 0xE9, 0x24, 0xBB, 0xC9, 0x2F, 0x70, 0xEF, 0xC2,
+    0xFF, 0x63, 0x05, 0x2E, 0xAF, 0x88, 0xC0, 0x60, 0x97, 0xD6, 0xE1, 0x84, 0x90, 0xCA, 0x22, 0xE8,
+    0xB8, 0xFD, 0xC8, 0x4A, 0x93, 0x37, 0xB3, 0x77, 0xD2, 0x05, 0x17, 0x69, 0x0C, 0x16, 0xA7, 0xE1,
+    0xB4, 0xFB, 0x76, 0xE6, 0xCD, 0x9B, 0xD9, 0xF9, 0x88, 0x88, 0x9E, 0xE0, 0xA5, 0x2C, 0x88, 0x2D,
+    0x27, 0xA2, 0x7B, 0xCC, 0x0B, 0x15, 0xCC, 0x3C, 0x27, 0x30, 0x3C, 0x18, 0xB1, 0x0F, 0xF8, 0x77,
+    0x20, 0xCA, 0x85, 0xCC, 0x48, 0xED, 0x48, 0xAE, 0xCE, 0x58, 0x8E, 0x94, 0x5E, 0x17, 0x2E, 0x1A,
+    0x7E, 0xFE, 0x93, 0xC0, 0xF8, 0xAD, 0xDA, 0x33, 0x31, 0x4B, 0xFB, 0xC7, 0xE9, 0xD2, 0x9C, 0x70,
+    0x57, 0x0D, 0x04, 0x34, 0x13, 0x15, 0x4B, 0xEE, 0x11, 0x63, 0xC1, 0x02, 0x99, 0x15, 0x0B, 0x54,
+    0x09, 0xB0, 0x16, 0x0B, 0xCF, 0x12, 0x52, 0x03, 0x0F, 0x64, 0x7B, 0x6C, 0x26, 0xAB, 0x50, 0xCA,
+    0x67, 0xB1, 0x89, 0x93, 0x4D, 0x77, 0x8B, 0x8F, 0x9C, 0x29, 0xB9, 0xC6, 0x9E, 0x1B, 0x85, 0x3F,
+    0x2B, 0x7F, 0x7F, 0xDC, 0x34, 0x8F, 0x5A, 0xD9, 0xBC, 0xBC, 0xCD, 0xE7, 0xD0, 0x60, 0xD9, 0x4E,
+    0x74, 0x83, 0x26, 0x16, 0xAB, 0xF9, 0x2D, 0x6A, 0x67, 0xD2, 0x5C, 0xE9, 0x1B, 0xE1, 0x23, 0x00,
+    0x82, 0x93, 0x97, 0x8A, 0x58, 0x29, 0x57, 0x96, 0x1A, 0x57, 0xF6, 0xEE, 0xAB, 0xCD, 0x35, 0x60,
+    0xB1, 0x68, 0x58, 0x15, 0xAF, 0x9A, 0x24, 0x8A, 0xFB, 0x8F, 0x04, 0xEA, 0x1B, 0xCB, 0x8D, 0x43,
+    0xCE, 0x94, 0xF2, 0x8E, 0x6E, 0xC7, 0xCD, 0x89, 0x9B, 0xD5, 0x77, 0x27, 0x68, 0xBF, 0x85, 0x5C,
+    0x11, 0xE5, 0xE8, 0xE5, 0x4D, 0x55, 0x28, 0x6A, 0x02, 0xE0, 0x5F, 0xCA, 0x8D, 0xBB, 0x58, 0x9D,
+    0x3C, 0xF2, 0x2E, 0xA7, 0x23, 0xD8, 0x6A, 0x48, 0xB8, 0xA7, 0xB6, 0x4B, 0xC1, 0x90, 0x45, 0x92,
+    0x14, 0x95, 0x0C, 0xC7, 0x28, 0x43, 0x75, 0xF9, 0x51, 0x79, 0x8E, 0x51, 0xB4, 0x9F, 0x67, 0x51,
+    0xD9, 0xF5, 0xA8, 0xA5, 0x08, 0x58, 0xCC, 0x06, 0x05, 0x32, 0x17, 0x70, 0x42, 0xF6, 0xC3, 0xA2,
+    0xBE, 0x47, 0xA3, 0x84, 0x24, 0xE4, 0x20, 0x21, 0xFD, 0xCE, 0x48, 0xEA, 0x08, 0x32, 0xB5, 0x6C,
+    0x1E, 0xA2, 0x9A, 0x5D, 0xBE, 0xF7, 0xCC, 0xA0, 0x09, 0xF6, 0x9A, 0x77, 0xA7, 0x25, 0xFA, 0x02,
+    0x42, 0x14, 0xE1, 0xA3, 0xF2, 0x3C, 0xC4, 0xF2, 0xA9, 0x0A, 0xA9, 0x25, 0x8A, 0xE8, 0x2A, 0x44,
+    0x27, 0xED, 0x56, 0xA3, 0x5E, 0x7C, 0xBF, 0xA0, 0xF8, 0x38, 0x3D, 0xF9, 0x4E, 0xED, 0x12, 0x3F,
+    0x6A, 0x7B, 0x68, 0x1E, 0x73, 0x97, 0x21, 0x79, 0x3B, 0xCB, 0x1F, 0xFE, 0xFB, 0x8C, 0x1F, 0xE0,
+    0xDC, 0x19, 0xF6, 0x8E, 0x97, 0x42, 0x89, 0x0E, 0xD2, 0xE4, 0xF1, 0x91, 0xCC, 0x7C, 0x29, 0x9C,
+    0x55, 0xAE, 0x9E, 0x2F, 0x9B, 0xB3, 0xC9, 0x2C, 0x94, 0x84, 0x14, 0x7A, 0x59, 0xB2, 0x9E, 0x0A,
+    0x64, 0xAB, 0xCD, 0x2D, 0x8A, 0x94, 0xAB, 0x76, 0xEB, 0xA0, 0xB2, 0xA8, 0x92, 0xA2, 0x50, 0x3B,
+    0xDD, 0x34, 0x93, 0x1A, 0x6D, 0xC5, 0x7C, 0xBD, 0xB9, 0x0B, 0x6A, 0xA4, 0xE1, 0xBE, 0x4B, 0xE0,
+    0xC8, 0xF4, 0x38, 0x52, 0x4E, 0xF0, 0x9E, 0x07, 0x51, 0x6B, 0xB5, 0x12, 0xF8, 0xC7, 0x18, 0x1D,
+    0x8F, 0xD6, 0xF3, 0xAE, 0x5C, 0x82, 0x2B, 0xBC, 0x1F, 0xF0, 0x3E, 0x47, 0x2F, 0xC7, 0xB1, 0x50,
+    0xE0, 0x2D, 0x71, 0x0B, 0x0D, 0x40, 0x16, 0x1C, 0x5A, 0x94, 0xD4, 0x81, 0x00, 0x7C, 0xA7, 0x08,
+    0x97, 0x21, 0x6E, 0x7E, 0x0B, 0x52, 0x8D, 0xB1, 0x57, 0x15, 0x52, 0x83, 0xF6, 0x2D, 0x88, 0x8F,
+    0xAD, 0xB3, 0x41, 0xF0, 0x36, 0x92, 0x64, 0x1D, 0xBD, 0x8A, 0xF7, 0x6A, 0x8A, 0x98, 0xC2, 0xC7,
+    0xE8, 0xD9, 0x4A, 0xEA, 0x43, 0x7C, 0xED, 0xA0, 0x71, 0x07, 0x89, 0x63, 0x09, 0xB0, 0x81, 0x24,
+    0xB0, 0x78, 0x17, 0x90, 0x10, 0x12, 0x62, 0x02, 0x4A, 0x1E, 0x51, 0x8E, 0xCF, 0xEB, 0xB7, 0xCC,
+    0xA6, 0x5F, 0xAA, 0xD7, 0xEF, 0x03, 0x84, 0x90, 0x46, 0xC7, 0x14, 0x5B, 0xA5, 0xAB, 0x6A, 0x14,
+    0x6B, 0xB6, 0xFF, 0xF0, 0x62, 0x5E, 0x5D, 0x84, 0xAF, 0xF2, 0xE9, 0xDB, 0xED, 0x4C, 0x72, 0x82,
+    0x51, 0x59, 0x27, 0xDA, 0x8C, 0x03, 0x9F, 0x86, 0x96, 0x5C, 0xD5, 0x9B, 0xF3, 0x29, 0xFB, 0x3B,
+    0xA4, 0xC1, 0xBE, 0x59, 0x71, 0x10, 0xFA, 0xD1, 0xD1, 0x81, 0xEE, 0x3D, 0xE5, 0x73, 0xAE, 0x42,
+    0x3B, 0x1E, 0x6B, 0xB5, 0xEF, 0x48, 0xB1, 0xD2, 0xB0, 0xDD, 0xE1, 0x4C, 0x27, 0x5A, 0xBB, 0xDF,
+    0x23, 0x9D, 0x73, 0xA6, 0xDF, 0x51, 0xDD, 0x86, 0x72, 0x8A, 0x1A, 0x73, 0xD4, 0x7E, 0x11, 0x86,
+    0x06, 0x6D, 0x31, 0xA5, 0x9E, 0xBE, 0x66, 0xB2, 0x35, 0x32, 0x13, 0x62, 0xAE, 0x73, 0x92, 0x60,
+    0x39, 0x88, 0x7F, 0x15, 0x43, 0x7C, 0x99, 0xF7, 0x72, 0x53, 0xD9, 0xCA, 0xF9, 0x2B, 0x09, 0xE3,
+    0x62, 0x6B, 0x48, 0x13, 0xD9, 0xB0, 0x5D, 0x33, 0xB3, 0x87, 0xB9, 0x4B, 0x09, 0x61, 0xA0, 0xF4,
+    0x68, 0xD8, 0x89, 0xF9, 0xDC, 0xDB, 0x67, 0x3C, 0x99, 0xDE, 0x4E, 0xC5, 0x98, 0xF9, 0x14, 0x9D,
+    0x59, 0xB7, 0xDF, 0xF3, 0x5C, 0x72, 0xE0, 0x67, 0x1C, 0xCA, 0xA9, 0xF2, 0x14, 0xE8, 0x84, 0x8E,
+    0xF4, 0x1C, 0x64, 0xE9, 0x0B, 0x08, 0x13, 0x4A, 0x69, 0xF3, 0xDF, 0x38, 0xB4, 0x3F, 0xF0, 0x08,
+    0x79, 0xEC, 0x58, 0x9E, 0x8F, 0x05, 0x24, 0xF2, 0x68, 0xC7, 0xD0, 0x66, 0x58, 0x2C, 0xF9, 0xC0,
+    0xF0, 0xE0, 0x0D, 0xF7, 0x95, 0x97, 0x71, 0x75, 0x82, 0xB0, 0x98, 0x59, 0xC2, 0x45, 0x47, 0xA2,
+    0xDF, 0x46, 0xFF, 0x27, 0x5E, 0xDC, 0x27, 0xF2, 0xD9, 0x36, 0x7B, 0x34, 0xFB, 0x2F, 0xB5, 0x4C,
+    0xB9, 0x4E, 0x33, 0xBD, 0x40, 0xD7, 0xBF, 0x26, 0x99, 0xDE, 0xC0, 0xA8, 0x53, 0x72, 0x6D, 0x7B,
+    0xFD, 0xF5, 0x88, 0x56, 0x0F, 0xB8, 0x61, 0x9B, 0xE6, 0xF1, 0x46, 0xC6, 0x21, 0x76, 0x6D, 0x2B,
+    0x0D, 0x60, 0x74, 0x68, 0x9A, 0xB0, 0x4F, 0x7F, 0xBD, 0xFC, 0xD2, 0x32, 0x78, 0x7E, 0x55, 0xFB,
+    0xA7, 0x5A, 0xFF, 0xC4, 0xBE, 0xBB, 0x5A, 0xB8, 0xFD, 0x7F, 0xD3, 0xD4, 0xF4, 0x09, 0x9E, 0x7F,
+    0x01, 0xCD, 0x55, 0xBF, 0x6B, 0xD5, 0x50, 0x14, 0x3E, 0x49, 0x5A, 0xA3, 0x06, 0xCC, 0xD2, 0x0E,
+    0x2A, 0x18, 0xE7, 0xA2, 0xDE, 0x7F, 0x40, 0xB8, 0x01, 0x47, 0x97, 0x22, 0x7D, 0x82, 0x2E, 0x75,
+    0x71, 0xB0, 0xFE, 0x0D, 0x25, 0x11, 0x07, 0x57, 0x17, 0x5D, 0x75, 0x78, 0x83, 0x8D, 0x83, 0xBB,
+    0x88, 0x89, 0xED, 0xD0, 0x35, 0xE0, 0xE8, 0xF2, 0x86, 0x22, 0xA8, 0x43, 0x6F, 0xE5, 0x15, 0xD2,
+    0x36, 0xEF, 0x1E, 0xBF, 0x73, 0x5F, 0x5E, 0x5F, 0x8B, 0x0E, 0x16, 0x2A, 0x18, 0x92, 0x93, 0xDC,
+    0x73, 0xCF, 0xF9, 0xCE, 0xCF, 0x7B, 0xB2, 0x90, 0xAE, 0xE9, 0x4F, 0xF6, 0x9F, 0xDE, 0xF3, 0x69,
+    0x8F, 0x28, 0x19, 0x10, 0xAE, 0xB2, 0x02, 0x09, 0x38, 0x05, 0x55, 0x2C, 0x0C, 0x6E, 0x41, 0x42,
+    0x6E, 0x40, 0xF5, 0xB6, 0x11, 0x86, 0xAE, 0x89, 0xA2, 0x26, 0x83, 0xA0, 0xAE, 0x21, 0xE8, 0xB1,
+    0x6F, 0x89, 0xE2, 0x26, 0x80, 0xA0, 0xAE, 0xE2, 0x21, 0xF9, 0x4C, 0x89, 0x21, 0x7C, 0x40, 0x10,
+    0x52, 0x65, 0x1E, 0x58, 0x08, 0x51, 0x6C, 0x08, 0x1F, 0xC0, 0x8F, 0xDA, 0x60, 0x04, 0x85, 0x21,
+    0x84, 0x48, 0x19, 0xCE, 0x89, 0xB2, 0xCD, 0x91, 0x00, 0xE7, 0x82, 0x19, 0x37, 0x8E, 0xB3, 0x0E,
+    0xE3, 0x3E, 0x8F, 0x05, 0x23, 0x20, 0x67, 0x55, 0xE2, 0xF4, 0xF5, 0x40, 0x80, 0x04, 0xB6, 0x22,
+    0x4E, 0xB1, 0x0F, 0xE3, 0xD8, 0x09, 0x5B, 0xA8, 0x77, 0x4E, 0x24, 0x46, 0x0D, 0x3A, 0xDF, 0xA8,
+    0x7C, 0x26, 0xEE, 0xB3, 0x30, 0x02, 0xCB, 0x87, 0x91, 0xC4, 0x5C, 0x1F, 0x06, 0xA8, 0x87, 0x2E,
+    0x4C, 0x89, 0xDB, 0xB3, 0xF2, 0xE9, 0x3D, 0xC4, 0xC3, 0x90, 0xD0, 0xCC, 0x26, 0x60, 0x10, 0x65,
+    0xEF, 0xF2, 0x00, 0xF8, 0xE5, 0x26, 0xD0, 0x78, 0x79, 0x40, 0xFE, 0xA8, 0x4C, 0x29, 0xDC, 0x87,
+    0x77, 0xC9, 0x0F, 0xA8, 0x67, 0xEF, 0x6A, 0xE8, 0xFE, 0x17, 0xAC, 0x2C, 0xA7, 0x68, 0x17, 0x71,
+    0xE9, 0xCF, 0x16, 0xF9, 0x8B, 0xF8, 0x45, 0xD9, 0xC4, 0x08, 0xA1, 0x02, 0x69, 0x11, 0xBC, 0xE4,
+    0xE4, 0x9E, 0x14, 0xD7, 0x7F, 0x0F, 0x92, 0x21, 0xA6, 0x88, 0x45, 0xFA, 0xA0, 0x85, 0x74, 0x58,
+    0x53, 0xDC, 0xCE, 0x60, 0x65, 0x24, 0x01, 0x95, 0x24, 0x0B, 0x42, 0x89, 0x64, 0x30, 0x3B, 0x75,
+    0x56, 0x4E, 0x33, 0x21, 0x5C, 0x6F, 0x95, 0xA1, 0xC8, 0x62, 0xA5, 0xA4, 0xD1, 0xB4, 0x48, 0x5E,
+    0xEA, 0xD3, 0xF4, 0x2A, 0x73, 0x57, 0x34, 0x71, 0x39, 0x19, 0xB9, 0x72, 0x19, 0xC7, 0x4E, 0xE9,
+    0x84, 0xD7, 0x23, 0x18, 0x7D, 0x13, 0xA1, 0xC0, 0x49, 0xA3, 0xA5, 0x8A, 0x86, 0xD1, 0x4F, 0xBC,
+    0x0E, 0xE4, 0xD0, 0x7A, 0x8B, 0x44, 0xB3, 0x1D, 0xA2, 0x74, 0x37, 0xDF, 0x82, 0x1F, 0x11, 0xC7,
+    0x92, 0x99, 0x56, 0xA3, 0x61, 0x4A, 0xA3, 0xE1, 0x87, 0x3D, 0xA9, 0x4D, 0x5A, 0x13, 0x12, 0x4B,
+    0xD0, 0x94, 0x49, 0x9B, 0x79, 0xAE, 0xEF, 0x02, 0xD7, 0x77, 0x62, 0x14, 0xC8, 0xB7, 0x59, 0xB7,
+    0xA5, 0xE1, 0x63, 0xF1, 0x5C, 0x0C, 0xAD, 0x6A, 0x79, 0x87, 0x9F, 0x4C, 0x32, 0x71, 0x8A, 0x4E,
+    0xFD, 0x65, 0x1E, 0x3C, 0xDE, 0xA2, 0x9B, 0xE8, 0x8D, 0x94, 0x13, 0xB4, 0xCF, 0x48, 0xE7, 0x19,
+    0x37, 0x17, 0xD0, 0x23, 0xF5, 0x18, 0x65, 0x25, 0xA5, 0xB9, 0x00, 0x47, 0x69, 0x15, 0x7D, 0xF5,
+    0xD2, 0xAA, 0xAF, 0xE8, 0x2E, 0x95, 0x26, 0x6C, 0xCE, 0x93, 0xF7, 0xF1, 0x48, 0x28, 0xF3, 0xBD,
+    0x5E, 0x6F, 0x49, 0x09, 0x80, 0x23, 0x0E, 0x6A, 0xBA, 0x3B, 0xFB, 0x87, 0x5D, 0xAF, 0x2F, 0xC0,
+    0x75, 0xBC, 0xC1, 0x36, 0xDA, 0x01, 0xA3, 0x2D, 0x03, 0x1E, 0xC5, 0x29, 0x6A, 0x9F, 0xD2, 0x12,
+    0x45, 0x03, 0x7A, 0x10, 0x73, 0xAE, 0x63, 0xA8, 0x6C, 0x5A, 0xE6, 0x9F, 0x4D, 0xC4, 0xE6, 0x9A,
+    0xEB, 0xA8, 0xC9, 0xB5, 0x45, 0x74, 0x66, 0x03, 0x8A, 0x2C, 0x6D, 0xDF, 0x22, 0x02, 0xF4, 0xD6,
+    0xEC, 0xD2, 0xD1, 0x0C, 0xAC, 0x14, 0x7D, 0x2A, 0xC1, 0x7F, 0xEA, 0xA4, 0xF6, 0x7B, 0x8F, 0xDB,
+    0xAB, 0xE0, 0xE2, 0x39, 0x8B, 0xD7, 0x2A, 0xCA, 0x63, 0x16, 0x8A, 0xF2, 0x1B, 0xF6, 0x0E, 0xF0,
+    0x7C, 0x2F, 0xB8, 0x48, 0x03, 0x99, 0x54, 0xB9, 0x5F, 0xD8, 0xE2, 0x15, 0x58, 0xD0, 0xB5, 0x6F,
+    0xF7, 0x8B, 0xBE, 0x42, 0xF6, 0x3F, 0x40, 0x05, 0x49, 0x43, 0x20, 0xBD, 0x3B, 0x02, 0xF7, 0x45,
+    0xC8, 0xFD, 0xA2, 0x28, 0xD6, 0x8E, 0x45, 0xD9, 0x73, 0x01, 0x8A, 0xD1, 0x5D, 0x11, 0xA8, 0x8F,
+    0x25, 0x68, 0xAA, 0xB8, 0xDC, 0xE5, 0x07, 0x19, 0x4C, 0xE4, 0x64, 0x22, 0xDF, 0x43, 0x2A, 0xF7,
+    0x48, 0x59, 0x2C, 0x72, 0xD7, 0xFA, 0x25, 0x0A, 0x9F, 0x49, 0xF5, 0xB0, 0x0E, 0x79, 0x80, 0x3A,
+    0xC9, 0xD1, 0xC7, 0xA9, 0xB9, 0xDE, 0x21, 0xCA, 0xC0, 0xDA, 0xEE, 0xBC, 0x94, 0x35, 0x26, 0x5F,
+    0x08, 0x1D, 0xF5, 0x9B, 0x0E, 0x0C, 0xA9, 0x46, 0x2A, 0xEA, 0x01, 0x13, 0xAB, 0x84, 0x53, 0x29,
+    0x6F, 0x80, 0xBD, 0x73, 0xD3, 0x64, 0xC5, 0x1D, 0x14, 0x5E, 0xCD, 0xD8, 0xB3, 0x45, 0xE7, 0x5C,
+    0x52, 0xC9, 0x89, 0xC6, 0xC1, 0x04, 0x98, 0xC7, 0x0E, 0x60, 0x8C, 0x81, 0x3B, 0xE4, 0xE7, 0xA1,
+    0x8C, 0x4F, 0xE3, 0x66, 0x2B, 0xD0, 0x3B, 0xA7, 0x3B, 0xBF, 0x3B, 0x37, 0x3A, 0x4F, 0x9C, 0x33,
+    0x18, 0xE6, 0x12, 0xC3, 0x0D, 0xA2, 0x2B, 0x9D, 0xDD, 0x39, 0x22, 0x4C, 0x22, 0x1A, 0xB9, 0x1B,
+    0x66, 0xE4, 0x97, 0x14, 0x71, 0x2D, 0xB8, 0x13, 0xA5, 0xB1, 0x49, 0xB1, 0x79, 0xD9, 0x75, 0xAF,
+    0x1B, 0x31, 0x63, 0x6B, 0x98, 0xEC, 0x8A, 0x53, 0xC8, 0xE3, 0x46, 0x0E, 0x25, 0x8D, 0x9D, 0x34,
+    0x24, 0x71, 0xFB, 0x35, 0xF9, 0x83, 0xC3, 0x18, 0x33, 0xE6, 0x3D, 0x99, 0xF8, 0x68, 0x95, 0xD0,
+    0x95, 0x27, 0x99, 0x14, 0x29, 0x74, 0xBF, 0x05, 0x5F, 0xFE, 0x48, 0xDD, 0xA9, 0x0D, 0xDD, 0x61,
+    0x8E, 0x87, 0x93, 0x53, 0xE9, 0x10, 0xC1, 0x9E, 0xCE, 0x26, 0xCF, 0x49, 0xAB, 0x76, 0x0C, 0x92,
+    0xB9, 0xA6, 0x96, 0xCF, 0x4A, 0xB0, 0x5F, 0x9F, 0x78, 0x84, 0xD0, 0x2F, 0xAD, 0x94, 0xB1, 0x6E,
+    0xD4, 0x40, 0x10, 0x86, 0xC7, 0xB6, 0x92, 0x95, 0x30, 0x92, 0xAB, 0x34, 0x50, 0xB8, 0x4F, 0xE3,
+    0x37, 0x88, 0x8D, 0x78, 0x00, 0x78, 0x83, 0xF4, 0x34, 0x69, 0x68, 0x13, 0x5F, 0x2A, 0xDA, 0x14,
+    0xF4, 0xA1, 0x48, 0xC3, 0x35, 0xBC, 0x00, 0xC2, 0x16, 0x14, 0x14, 0x14, 0x58, 0x4A, 0x41, 0x41,
+    0x73, 0x45, 0x2A, 0x1A, 0x8C, 0x58, 0xE0, 0x88, 0xD6, 0x1E, 0xFE, 0x7F, 0x7C, 0x77, 0x49, 0xA8,
+    0x00, 0xB1, 0xD2, 0xCD, 0xDE, 0x8C, 0x77, 0x66, 0xBF, 0x9D, 0x9D, 0x1D, 0x11, 0x91, 0x1D, 0xFC,
+    0x24, 0x09, 0x94, 0x59, 0x4F, 0xD9, 0xCC, 0x56, 0x86, 0xED, 0x46, 0xB5, 0x8B, 0x15, 0xA3, 0xAA,
+    0x21, 0x06, 0xC7, 0xBF, 0xBE, 0x1C, 0xA4, 0xA9, 0x62, 0x9D, 0x61, 0x45, 0x16, 0x24, 0x5F, 0x48,
+    0xD9, 0x89, 0x4A, 0xA4, 0x74, 0x71, 0x41, 0x8A, 0x4E, 0xF2, 0x1E, 0x06, 0xA9, 0x3B, 0x68, 0xA2,
+    0x33, 0x18, 0x62, 0xAD, 0x60, 0x48, 0xF4, 0xC9, 0x52, 0x24, 0x55, 0xBD, 0x9C, 0x9F, 0xA5, 0x0C,
+    0xD5, 0x59, 0xC0, 0x2A, 0xC2, 0x36, 0x83, 0xD0, 0x05, 0x5F, 0x3D, 0x65, 0xD9, 0x42, 0x44, 0xD7,
+    0x0C, 0x22, 0xBB, 0x15, 0x44, 0x3C, 0x5C, 0x51, 0xD6, 0x46, 0x39, 0x60, 0x19, 0x98, 0x84, 0x91,
+    0x46, 0xC9, 0x37, 0xAC, 0x8A, 0xE5, 0xCD, 0x29, 0x37, 0x0D, 0xE9, 0x28, 0xA0, 0x04, 0x2A, 0xB0,
+    0x41, 0x06, 0x4A, 0x00, 0x03, 0x1B, 0x4B, 0xB4, 0x42, 0x00, 0x18, 0x72, 0x6F, 0x86, 0x16, 0x0C,
+    0x6E, 0xA4, 0xA1, 0xE9, 0x1F, 0x35, 0x97, 0x8D, 0xDE, 0x63, 0xA4, 0xE5, 0x44, 0xC9, 0xD8, 0x27,
+    0x2B, 0x4A, 0xB7, 0x34, 0xCA, 0x8E, 0xD2, 0x0C, 0xDB, 0x67, 0x06, 0xC9, 0x84, 0xB5, 0x05, 0x16,
+    0xF6, 0x64, 0x08, 0x25, 0x1D, 0x4B, 0x32, 0xE7, 0x74, 0x48, 0x99, 0xE3, 0xC4, 0xD6, 0x2B, 0xE1,
+    0xCB, 0x05, 0x0F, 0x13, 0xEC, 0xA8, 0xA6, 0x73, 0x91, 0xD3, 0x71, 0x3E, 0x7F, 0x66, 0xEE, 0x09,
+    0xDD, 0x99, 0x2F, 0x6D, 0x65, 0x33, 0xD4, 0x62, 0x52, 0xBC, 0xA7, 0xF8, 0x4A, 0x11, 0xF0, 0x3B,
+    0x13, 0x1A, 0x17, 0x19, 0xF5, 0xFB, 0x14, 0x4C, 0x52, 0x6E, 0x9B, 0x35, 0xE4, 0xCC, 0x96, 0x9B,
+    0xCD, 0x1B, 0x86, 0x2B, 0xFA, 0xB5, 0x31, 0x25, 0x60, 0xAA, 0xBB, 0xF3, 0xB9, 0xEA, 0x83, 0x8D,
+    0x3B, 0x37, 0x5A, 0x5E, 0x6D, 0x2B, 0xC9, 0x7A, 0xA3, 0xEB, 0xBB, 0xF7, 0xEB, 0xAF, 0x07, 0x7A,
+    0xC1, 0xC0, 0x8A, 0x73, 0x44, 0x7A, 0xFA, 0x11, 0xB7, 0x32, 0x26, 0x3D, 0x2E, 0x7E, 0x90, 0x10,
+    0x05, 0xC8, 0x52, 0xF2, 0xF6, 0x48, 0xB2, 0x36, 0xF6, 0x85, 0x24, 0xBD, 0xEC, 0x65, 0x33, 0x41,
+    0xF5, 0xBC, 0x41, 0xED, 0x48, 0xFC, 0x65, 0x9C, 0xBF, 0xF8, 0x34, 0x1F, 0xEC, 0xD6, 0x74, 0xDF,
+    0xE4, 0x79, 0x87, 0x0F, 0x51, 0xBF, 0x84, 0x87, 0xBC, 0x2C, 0xE9, 0x51, 0xBA, 0x0E, 0x1E, 0x79,
+    0x85, 0xCB, 0x83, 0x31, 0x6F, 0xB3, 0x36, 0xEB, 0xE2, 0x90, 0xF4, 0xD9, 0x42, 0x8A, 0x8B, 0x70,
+    0xB0, 0xB0, 0x32, 0xE8, 0xAC, 0xBA, 0x98, 0xCA, 0xAD, 0xA7, 0xD7, 0xD0, 0x6F, 0xC0, 0x9D, 0xDC,
+    0x05, 0x1C, 0x4E, 0x9C, 0x33, 0x9E, 0x08, 0xE1, 0xC4, 0xE0, 0x50, 0x5D, 0x80, 0xC3, 0xD8, 0xCB,
+    0x98, 0x1F, 0xC2, 0x89, 0xC1, 0x61, 0xFC, 0x0E, 0x27, 0x06, 0x87, 0x01, 0x38, 0x5E, 0x9C, 0xA3,
+    0x89, 0x70, 0x62, 0x70, 0x90, 0x80, 0x83, 0x24, 0x9C, 0xFC, 0x2D, 0xDC, 0x68, 0x70, 0xB8, 0x29,
+    0x3C, 0x1F, 0x64, 0xD8, 0x69, 0x7B, 0xD4, 0x88, 0xFB, 0xEE, 0x8B, 0xB4, 0x77, 0x1E, 0x70, 0x8D,
+    0xF3, 0x80, 0x4B, 0x7F, 0xF8, 0xF8, 0x8B, 0x97, 0xC6, 0xCB, 0xE1, 0xA1, 0xA4, 0x4B, 0xC9, 0xF7,
+    0x2B, 0x87, 0xEA, 0x3D, 0xC7, 0x9B, 0xEA, 0x01, 0xE7, 0x7C, 0x03, 0x38, 0xE7, 0xD3, 0xBE, 0x74,
+    0x1F, 0xB0, 0x2C, 0xAF, 0xF0, 0x48, 0x52, 0x6D, 0x51, 0xE9, 0xA8, 0x87, 0x7F, 0x87, 0x9B, 0x32,
+    0x37, 0x18, 0x1C, 0xA5, 0x32, 0x73, 0x84, 0x83, 0x24, 0x9C, 0x18, 0x1C, 0x24, 0xE1, 0x9C, 0xC1,
+    0x41, 0x12, 0xCE, 0x1B, 0x9C, 0x17, 0x83, 0x13, 0x83, 0x63, 0xE6, 0x00, 0x27, 0x06, 0xC7, 0xCC,
+    0xF9, 0x3F, 0xCA, 0x5C, 0x64, 0x05, 0xCB, 0xFC, 0x17, 0x8B, 0x55, 0xBB, 0x8A, 0xC7, 0xFF, 0x61,
+    0xB2, 0xC2, 0xBE, 0x39, 0xDA, 0x3B, 0xC7, 0xFA, 0x4E, 0x8B, 0x50, 0x2F, 0x76, 0xE4, 0xD6, 0x09,
+    0xBB, 0xD0, 0x73, 0xBC, 0xD8, 0x12, 0x0D, 0xEE, 0x2D, 0x5A, 0xC2, 0x20, 0xF5, 0x37, 0x76, 0x31,
+    0xFC, 0xA3, 0xA9, 0x4D, 0x34, 0x7A, 0x28, 0x5B, 0xD5, 0xD4, 0x52, 0xD7, 0xE3, 0xF6, 0x6A, 0x0E,
+    0xD3, 0x94, 0xAD, 0x66, 0x9D, 0xE6, 0xEC, 0xF3, 0x34, 0xF7, 0xD1, 0xD4, 0x81, 0x91, 0x99, 0xD5,
+    0x62, 0xCE, 0xD9, 0xCF, 0x57, 0x56, 0x55, 0x20, 0x39, 0x66, 0x5A, 0xF8, 0x3A, 0x83, 0xA9, 0x23,
+    0xE2, 0x50, 0x0D, 0x45, 0xB0, 0x9E, 0xD0, 0x69, 0xA0, 0x7A, 0x91, 0x68, 0xA8, 0x99, 0xB2, 0x42,
+    0x7D, 0x8D, 0x8E, 0x18, 0x5B, 0x3F, 0x5C, 0x4A, 0x8D, 0x0C, 0xD7, 0xBA, 0x28, 0xD8, 0x18, 0x6B,
+    0x7D, 0xCD, 0x96, 0x89, 0xD9, 0x59, 0x9F, 0xAC, 0x47, 0x7E, 0xA5, 0x6E, 0xAA, 0xD4, 0xBE, 0xF6,
+    0x53, 0x87, 0x35, 0x55, 0x8E, 0x92, 0xA9, 0x07, 0x1F, 0x16, 0xA6, 0x4A, 0xBD, 0x6A, 0xC9, 0xF5,
+    0xA4, 0xCA, 0xE3, 0x6B, 0x87, 0xFD, 0x05,
+};
+
+static const uint32_t bookerly_16_boldBlockOffsets[45] = {
+    0, 1150, 2183, 3184, 4163, 5147, 6286, 7027,
+    7705, 8342, 9133, 9871, 10576, 11321, 11908, 12565,
+    13360, 14096, 14908, 15686, 16271, 17142, 18069, 19023,
+    19969, 20776, 21871, 22793, 23801, 24815, 25825, 26723,
+    27571, 28500, 29409, 30483, 31365, 32010, 33003, 34106,
+    35285, 36372, 37265, 38108, 38855,
+};
+
+static const uint16_t bookerly_16_boldDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_boldGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_16_boldPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_16_boldGlyphs[] = {
@@ -5437,724 +2637,724 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 17, 24, 21, 1, 23, 102, 1694 }, // 5
     { 18, 24, 21, 1, 23, 108, 1796 }, // 6
     { 17, 24, 21, 2, 23, 102, 1904 }, // 7
-    { 18, 24, 21, 1, 23, 108, 2006 }, // 8
-    { 18, 24, 21, 1, 23, 108, 2114 }, // 9
-    { 7, 19, 10, 1, 18, 34, 2222 }, // :
-    { 9, 25, 10, 0, 18, 57, 2256 }, // ;
-    { 15, 16, 21, 3, 19, 60, 2313 }, // <
-    { 15, 10, 21, 3, 16, 38, 2373 }, // =
-    { 15, 16, 21, 3, 19, 60, 2411 }, // >
-    { 13, 26, 16, 2, 25, 85, 2471 }, // ?
-    { 31, 30, 33, 1, 23, 233, 2556 }, // @
-    { 26, 24, 25, 0, 24, 156, 2789 }, // A
-    { 20, 25, 21, 1, 24, 125, 2945 }, // B
-    { 20, 25, 22, 1, 24, 125, 3070 }, // C
-    { 24, 25, 26, 1, 24, 150, 3195 }, // D
-    { 20, 23, 21, 1, 23, 115, 3345 }, // E
-    { 18, 23, 20, 1, 23, 104, 3460 }, // F
-    { 23, 25, 24, 1, 24, 144, 3564 }, // G
-    { 27, 23, 28, 1, 23, 156, 3708 }, // H
-    { 12, 23, 14, 1, 23, 69, 3864 }, // I
-    { 15, 30, 13, -2, 23, 113, 3933 }, // J
-    { 24, 24, 25, 1, 23, 144, 4046 }, // K
-    { 20, 23, 21, 1, 23, 115, 4190 }, // L
-    { 31, 23, 31, 0, 23, 179, 4305 }, // M
-    { 27, 24, 27, 0, 23, 162, 4484 }, // N
-    { 24, 25, 26, 1, 24, 150, 4646 }, // O
-    { 19, 24, 21, 1, 24, 114, 4796 }, // P
-    { 25, 32, 26, 1, 24, 200, 4910 }, // Q
-    { 23, 25, 23, 1, 24, 144, 5110 }, // R
-    { 17, 25, 19, 1, 24, 107, 5254 }, // S
-    { 23, 23, 24, 0, 23, 133, 5361 }, // T
-    { 26, 24, 27, 0, 23, 156, 5494 }, // U
-    { 26, 24, 26, 0, 23, 156, 5650 }, // V
-    { 37, 24, 37, 0, 23, 222, 5806 }, // W
-    { 25, 23, 25, 0, 23, 144, 6028 }, // X
-    { 24, 23, 24, 0, 23, 138, 6172 }, // Y
-    { 20, 24, 20, 0, 23, 120, 6310 }, // Z
-    { 8, 32, 11, 2, 26, 64, 6430 }, // [
-    { 16, 26, 17, 1, 24, 104, 6494 }, // <backslash>
-    { 9, 32, 11, 1, 26, 72, 6598 }, // ]
-    { 17, 17, 21, 2, 22, 73, 6670 }, // ^
-    { 17, 4, 17, 0, -1, 17, 6743 }, // _
-    { 8, 9, 22, 7, 28, 18, 6760 }, // `
-    { 18, 19, 19, 1, 18, 86, 6778 }, // a
-    { 21, 27, 20, -1, 26, 142, 6864 }, // b
-    { 15, 19, 17, 1, 18, 72, 7006 }, // c
-    { 20, 27, 21, 1, 26, 135, 7078 }, // d
-    { 16, 19, 18, 1, 18, 76, 7213 }, // e
-    { 18, 26, 14, 0, 26, 117, 7289 }, // f
-    { 20, 26, 20, 0, 18, 130, 7406 }, // g
-    { 22, 26, 22, 0, 26, 143, 7536 }, // h
-    { 12, 26, 12, 0, 26, 78, 7679 }, // i
-    { 12, 34, 10, -3, 26, 102, 7757 }, // j
-    { 21, 27, 21, 0, 26, 142, 7859 }, // k
-    { 11, 26, 12, 0, 26, 72, 8001 }, // l
-    { 33, 18, 33, 0, 18, 149, 8073 }, // m
-    { 22, 18, 22, 0, 18, 99, 8222 }, // n
-    { 18, 19, 20, 1, 18, 86, 8321 }, // o
-    { 20, 26, 21, 0, 18, 130, 8407 }, // p
-    { 19, 26, 20, 1, 18, 124, 8537 }, // q
-    { 16, 18, 16, 0, 18, 72, 8661 }, // r
-    { 15, 19, 17, 1, 18, 72, 8733 }, // s
-    { 15, 23, 14, -1, 22, 87, 8805 }, // t
-    { 22, 19, 22, 0, 18, 105, 8892 }, // u
-    { 22, 19, 22, 0, 18, 105, 8997 }, // v
-    { 30, 19, 30, 0, 18, 143, 9102 }, // w
-    { 21, 18, 21, 0, 18, 95, 9245 }, // x
-    { 22, 26, 21, 0, 18, 143, 9340 }, // y
-    { 17, 19, 17, 0, 18, 81, 9483 }, // z
-    { 11, 33, 13, 2, 27, 91, 9564 }, // {
-    { 5, 30, 10, 3, 26, 38, 9655 }, // |
-    { 12, 33, 13, 0, 27, 99, 9693 }, // }
-    { 17, 8, 21, 2, 15, 34, 9792 }, // ~
-    { 0, 0, 7, 0, 0, 0, 9826 }, //  
-    { 7, 26, 10, 1, 18, 46, 9826 }, // ¡
-    { 18, 33, 21, 1, 26, 149, 9872 }, // ¢
-    { 20, 24, 21, 0, 23, 120, 10021 }, // £
-    { 19, 16, 21, 1, 19, 76, 10141 }, // ¤
-    { 23, 23, 21, -1, 23, 133, 10217 }, // ¥
-    { 5, 30, 10, 3, 26, 38, 10350 }, // ¦
-    { 15, 26, 17, 1, 23, 98, 10388 }, // §
-    { 13, 6, 22, 5, 26, 20, 10486 }, // ¨
-    { 25, 25, 26, 0, 24, 157, 10506 }, // ©
-    { 13, 17, 15, 1, 24, 56, 10663 }, // ª
-    { 18, 13, 19, 1, 15, 59, 10719 }, // «
-    { 15, 9, 21, 3, 16, 34, 10778 }, // ¬
-    { 11, 5, 13, 1, 11, 14, 10812 }, // ­
-    { 19, 18, 19, 0, 26, 86, 10826 }, // ®
-    { 12, 4, 22, 5, 24, 12, 10912 }, // ¯
-    { 13, 12, 17, 2, 23, 39, 10924 }, // °
-    { 15, 21, 21, 3, 20, 79, 10963 }, // ±
-    { 13, 16, 15, 1, 28, 52, 11042 }, // ²
-    { 12, 17, 15, 1, 28, 51, 11094 }, // ³
-    { 7, 9, 22, 8, 28, 16, 11145 }, // ´
-    { 22, 26, 22, 1, 18, 143, 11161 }, // µ
-    { 19, 28, 20, 0, 23, 133, 11304 }, // ¶
-    { 7, 6, 10, 1, 12, 11, 11437 }, // ·
-    { 7, 8, 22, 8, -1, 14, 11448 }, // ¸
-    { 11, 16, 15, 2, 28, 44, 11462 }, // ¹
-    { 13, 17, 15, 1, 24, 56, 11506 }, // º
-    { 18, 13, 19, 1, 15, 59, 11562 }, // »
-    { 33, 28, 36, 2, 25, 231, 11621 }, // ¼
-    { 33, 28, 36, 2, 25, 231, 11852 }, // ½
-    { 34, 28, 36, 1, 25, 238, 12083 }, // ¾
-    { 14, 25, 16, 1, 18, 88, 12321 }, // ¿
-    { 26, 32, 25, 0, 32, 208, 12409 }, // À
-    { 26, 32, 25, 0, 32, 208, 12617 }, // Á
-    { 26, 32, 25, 0, 32, 208, 12825 }, // Â
-    { 26, 32, 25, 0, 32, 208, 13033 }, // Ã
-    { 26, 31, 25, 0, 31, 202, 13241 }, // Ä
-    { 26, 33, 25, 0, 33, 215, 13443 }, // Å
-    { 33, 23, 32, -1, 23, 190, 13658 }, // Æ
-    { 20, 33, 22, 1, 24, 165, 13848 }, // Ç
-    { 20, 32, 21, 1, 32, 160, 14013 }, // È
-    { 20, 32, 21, 1, 32, 160, 14173 }, // É
-    { 20, 32, 21, 1, 32, 160, 14333 }, // Ê
-    { 20, 31, 21, 1, 31, 155, 14493 }, // Ë
-    { 12, 32, 14, 1, 32, 96, 14648 }, // Ì
-    { 12, 32, 14, 1, 32, 96, 14744 }, // Í
-    { 13, 32, 14, 0, 32, 104, 14840 }, // Î
-    { 14, 31, 14, 0, 31, 109, 14944 }, // Ï
-    { 25, 25, 26, 0, 24, 157, 15053 }, // Ð
-    { 27, 33, 27, 0, 32, 223, 15210 }, // Ñ
-    { 24, 33, 26, 1, 32, 198, 15433 }, // Ò
-    { 24, 33, 26, 1, 32, 198, 15631 }, // Ó
-    { 24, 33, 26, 1, 32, 198, 15829 }, // Ô
-    { 24, 33, 26, 1, 32, 198, 16027 }, // Õ
-    { 24, 32, 26, 1, 31, 192, 16225 }, // Ö
-    { 15, 15, 21, 3, 19, 57, 16417 }, // ×
-    { 26, 25, 26, 0, 24, 163, 16474 }, // Ø
-    { 26, 33, 27, 0, 32, 215, 16637 }, // Ù
-    { 26, 33, 27, 0, 32, 215, 16852 }, // Ú
-    { 26, 33, 27, 0, 32, 215, 17067 }, // Û
-    { 26, 32, 27, 0, 31, 208, 17282 }, // Ü
-    { 24, 32, 24, 0, 32, 192, 17490 }, // Ý
-    { 20, 23, 21, 1, 23, 115, 17682 }, // Þ
-    { 21, 27, 22, 0, 26, 142, 17797 }, // ß
-    { 18, 29, 19, 1, 28, 131, 17939 }, // à
-    { 18, 29, 19, 1, 28, 131, 18070 }, // á
-    { 18, 28, 19, 1, 27, 126, 18201 }, // â
-    { 18, 27, 19, 1, 26, 122, 18327 }, // ã
-    { 18, 27, 19, 1, 26, 122, 18449 }, // ä
-    { 18, 29, 19, 1, 28, 131, 18571 }, // å
-    { 26, 19, 27, 1, 18, 124, 18702 }, // æ
-    { 15, 27, 17, 1, 18, 102, 18826 }, // ç
-    { 16, 29, 18, 1, 28, 116, 18928 }, // è
-    { 16, 29, 18, 1, 28, 116, 19044 }, // é
-    { 16, 28, 18, 1, 27, 112, 19160 }, // ê
-    { 16, 27, 18, 1, 26, 108, 19272 }, // ë
-    { 12, 28, 12, 0, 28, 84, 19380 }, // ì
-    { 12, 28, 12, 0, 28, 84, 19464 }, // í
-    { 12, 27, 12, 0, 27, 81, 19548 }, // î
-    { 12, 26, 12, 0, 26, 78, 19629 }, // ï
-    { 18, 28, 20, 1, 27, 126, 19707 }, // ð
-    { 22, 26, 22, 0, 26, 143, 19833 }, // ñ
-    { 18, 29, 20, 1, 28, 131, 19976 }, // ò
-    { 18, 29, 20, 1, 28, 131, 20107 }, // ó
-    { 18, 28, 20, 1, 27, 126, 20238 }, // ô
-    { 18, 27, 20, 1, 26, 122, 20364 }, // õ
-    { 18, 27, 20, 1, 26, 122, 20486 }, // ö
-    { 15, 16, 21, 3, 19, 60, 20608 }, // ÷
-    { 20, 19, 20, 0, 18, 95, 20668 }, // ø
-    { 22, 29, 22, 0, 28, 160, 20763 }, // ù
-    { 22, 29, 22, 0, 28, 160, 20923 }, // ú
-    { 22, 28, 22, 0, 27, 154, 21083 }, // û
-    { 22, 27, 22, 0, 26, 149, 21237 }, // ü
-    { 22, 36, 21, 0, 28, 198, 21386 }, // ý
-    { 20, 34, 21, 0, 26, 170, 21584 }, // þ
-    { 22, 34, 21, 0, 26, 187, 21754 }, // ÿ
-    { 26, 30, 25, 0, 30, 195, 21941 }, // Ā
-    { 18, 25, 19, 1, 24, 113, 22136 }, // ā
-    { 26, 32, 25, 0, 32, 208, 22249 }, // Ă
-    { 18, 27, 19, 1, 26, 122, 22457 }, // ă
-    { 26, 32, 25, 0, 24, 208, 22579 }, // Ą
-    { 18, 26, 19, 1, 18, 117, 22787 }, // ą
-    { 20, 33, 22, 1, 32, 165, 22904 }, // Ć
-    { 15, 29, 17, 1, 28, 109, 23069 }, // ć
-    { 20, 33, 22, 1, 32, 165, 23178 }, // Ĉ
-    { 15, 28, 17, 1, 27, 105, 23343 }, // ĉ
-    { 20, 33, 22, 1, 32, 165, 23448 }, // Ċ
-    { 15, 27, 17, 1, 26, 102, 23613 }, // ċ
-    { 20, 33, 22, 1, 32, 165, 23715 }, // Č
-    { 15, 29, 17, 1, 28, 109, 23880 }, // č
-    { 24, 33, 26, 1, 32, 198, 23989 }, // Ď
-    { 23, 27, 21, 1, 26, 156, 24187 }, // ď
-    { 25, 25, 26, 0, 24, 157, 24343 }, // Đ
-    { 20, 27, 21, 1, 26, 135, 24500 }, // đ
-    { 20, 30, 21, 1, 30, 150, 24635 }, // Ē
-    { 16, 25, 18, 1, 24, 100, 24785 }, // ē
-    { 20, 32, 21, 1, 32, 160, 24885 }, // Ĕ
-    { 16, 27, 18, 1, 26, 108, 25045 }, // ĕ
-    { 20, 32, 21, 1, 32, 160, 25153 }, // Ė
-    { 16, 27, 18, 1, 26, 108, 25313 }, // ė
-    { 20, 31, 21, 1, 23, 155, 25421 }, // Ę
-    { 16, 26, 18, 1, 18, 104, 25576 }, // ę
-    { 20, 32, 21, 1, 32, 160, 25680 }, // Ě
-    { 16, 29, 18, 1, 28, 116, 25840 }, // ě
-    { 23, 33, 24, 1, 32, 190, 25956 }, // Ĝ
-    { 20, 35, 20, 0, 27, 175, 26146 }, // ĝ
-    { 23, 33, 24, 1, 32, 190, 26321 }, // Ğ
-    { 20, 34, 20, 0, 26, 170, 26511 }, // ğ
-    { 23, 33, 24, 1, 32, 190, 26681 }, // Ġ
-    { 20, 34, 20, 0, 26, 170, 26871 }, // ġ
-    { 23, 33, 24, 1, 24, 190, 27041 }, // Ģ
-    { 20, 37, 20, 0, 29, 185, 27231 }, // ģ
-    { 27, 32, 28, 1, 32, 216, 27416 }, // Ĥ
-    { 23, 34, 22, -1, 34, 196, 27632 }, // ĥ
-    { 28, 23, 28, 0, 23, 161, 27828 }, // Ħ
-    { 22, 26, 22, 0, 26, 143, 27989 }, // ħ
-    { 12, 32, 14, 1, 32, 96, 28132 }, // Ĩ
-    { 12, 26, 12, 0, 26, 78, 28228 }, // ĩ
-    { 12, 30, 14, 1, 30, 90, 28306 }, // Ī
-    { 12, 24, 12, 0, 24, 72, 28396 }, // ī
-    { 12, 32, 14, 1, 32, 96, 28468 }, // Ĭ
-    { 12, 26, 12, 0, 26, 78, 28564 }, // ĭ
-    { 12, 31, 14, 1, 23, 93, 28642 }, // Į
-    { 12, 34, 12, 0, 26, 102, 28735 }, // į
-    { 12, 32, 14, 1, 32, 96, 28837 }, // İ
-    { 12, 18, 12, 0, 18, 54, 28933 }, // ı
-    { 26, 30, 27, 1, 23, 195, 28987 }, // Ĳ
-    { 21, 34, 22, 0, 26, 179, 29182 }, // ĳ
-    { 15, 39, 13, -2, 32, 147, 29361 }, // Ĵ
-    { 15, 35, 10, -3, 27, 132, 29508 }, // ĵ
-    { 24, 32, 25, 1, 23, 192, 29640 }, // Ķ
-    { 21, 35, 21, 0, 26, 184, 29832 }, // ķ
-    { 22, 19, 21, 0, 18, 105, 30016 }, // ĸ
-    { 20, 32, 21, 1, 32, 160, 30121 }, // Ĺ
-    { 11, 34, 12, 0, 34, 94, 30281 }, // ĺ
-    { 20, 32, 21, 1, 23, 160, 30375 }, // Ļ
-    { 11, 35, 12, 0, 26, 97, 30535 }, // ļ
-    { 20, 26, 21, 1, 26, 130, 30632 }, // Ľ
-    { 15, 26, 12, 0, 26, 98, 30762 }, // ľ
-    { 20, 23, 21, 1, 23, 115, 30860 }, // Ŀ
-    { 18, 26, 18, 0, 26, 117, 30975 }, // ŀ
-    { 22, 23, 21, -1, 23, 127, 31092 }, // Ł
-    { 13, 26, 12, -1, 26, 85, 31219 }, // ł
-    { 27, 33, 27, 0, 32, 223, 31304 }, // Ń
-    { 22, 28, 22, 0, 28, 154, 31527 }, // ń
-    { 27, 32, 27, 0, 23, 216, 31681 }, // Ņ
-    { 22, 27, 22, 0, 18, 149, 31897 }, // ņ
-    { 27, 33, 27, 0, 32, 223, 32046 }, // Ň
-    { 22, 28, 22, 0, 28, 154, 32269 }, // ň
-    { 30, 24, 30, 0, 24, 180, 32423 }, // ŉ
-    { 27, 30, 27, 0, 23, 203, 32603 }, // Ŋ
-    { 20, 26, 22, 0, 18, 130, 32806 }, // ŋ
-    { 24, 31, 26, 1, 30, 186, 32936 }, // Ō
-    { 18, 25, 20, 1, 24, 113, 33122 }, // ō
-    { 24, 33, 26, 1, 32, 198, 33235 }, // Ŏ
-    { 18, 27, 20, 1, 26, 122, 33433 }, // ŏ
-    { 24, 34, 26, 1, 33, 204, 33555 }, // Ő
-    { 18, 29, 20, 1, 28, 131, 33759 }, // ő
-    { 31, 24, 33, 1, 23, 186, 33890 }, // Œ
-    { 28, 19, 30, 1, 18, 133, 34076 }, // œ
-    { 23, 33, 23, 1, 32, 190, 34209 }, // Ŕ
-    { 16, 28, 16, 0, 28, 112, 34399 }, // ŕ
-    { 23, 33, 23, 1, 24, 190, 34511 }, // Ŗ
-    { 16, 27, 16, 0, 18, 108, 34701 }, // ŗ
-    { 23, 33, 23, 1, 32, 190, 34809 }, // Ř
-    { 16, 28, 16, 0, 28, 112, 34999 }, // ř
-    { 17, 33, 19, 1, 32, 141, 35111 }, // Ś
-    { 15, 29, 17, 1, 28, 109, 35252 }, // ś
-    { 17, 33, 19, 1, 32, 141, 35361 }, // Ŝ
-    { 15, 28, 17, 1, 27, 105, 35502 }, // ŝ
-    { 17, 33, 19, 1, 24, 141, 35607 }, // Ş
-    { 15, 27, 17, 1, 18, 102, 35748 }, // ş
-    { 17, 33, 19, 1, 32, 141, 35850 }, // Š
-    { 15, 29, 17, 1, 28, 109, 35991 }, // š
-    { 23, 32, 24, 0, 23, 184, 36100 }, // Ţ
-    { 15, 31, 14, -1, 22, 117, 36284 }, // ţ
-    { 23, 32, 24, 0, 32, 184, 36401 }, // Ť
-    { 15, 28, 14, -1, 27, 105, 36585 }, // ť
-    { 23, 23, 24, 0, 23, 133, 36690 }, // Ŧ
-    { 15, 23, 14, -1, 22, 87, 36823 }, // ŧ
-    { 26, 33, 27, 0, 32, 215, 36910 }, // Ũ
-    { 22, 27, 22, 0, 26, 149, 37125 }, // ũ
-    { 26, 31, 27, 0, 30, 202, 37274 }, // Ū
-    { 22, 25, 22, 0, 24, 138, 37476 }, // ū
-    { 26, 33, 27, 0, 32, 215, 37614 }, // Ŭ
-    { 22, 27, 22, 0, 26, 149, 37829 }, // ŭ
-    { 26, 34, 27, 0, 33, 221, 37978 }, // Ů
-    { 22, 29, 22, 0, 28, 160, 38199 }, // ů
-    { 26, 34, 27, 0, 33, 221, 38359 }, // Ű
-    { 22, 29, 22, 0, 28, 160, 38580 }, // ű
-    { 26, 31, 27, 0, 23, 202, 38740 }, // Ų
-    { 22, 26, 22, 0, 18, 143, 38942 }, // ų
-    { 37, 33, 37, 0, 32, 306, 39085 }, // Ŵ
-    { 30, 28, 30, 0, 27, 210, 39391 }, // ŵ
-    { 24, 32, 24, 0, 32, 192, 39601 }, // Ŷ
-    { 22, 35, 21, 0, 27, 193, 39793 }, // ŷ
-    { 24, 31, 24, 0, 31, 186, 39986 }, // Ÿ
-    { 20, 33, 20, 0, 32, 165, 40172 }, // Ź
-    { 17, 29, 17, 0, 28, 124, 40337 }, // ź
-    { 20, 33, 20, 0, 32, 165, 40461 }, // Ż
-    { 17, 27, 17, 0, 26, 115, 40626 }, // ż
-    { 20, 33, 20, 0, 32, 165, 40741 }, // Ž
-    { 17, 29, 17, 0, 28, 124, 40906 }, // ž
-    { 17, 26, 14, 0, 26, 111, 41030 }, // ſ
-    { 7, 9, 0, -5, 28, 16, 41141 }, // ̀
-    { 6, 9, 0, -2, 28, 14, 41157 }, // ́
-    { 12, 8, 0, -6, 27, 24, 41171 }, // ̂
-    { 12, 6, 0, -6, 26, 18, 41195 }, // ̃
-    { 12, 4, 0, -6, 24, 12, 41213 }, // ̄
-    { 12, 6, 0, -6, 26, 18, 41225 }, // ̆
-    { 6, 6, 0, -3, 26, 9, 41243 }, // ̇
-    { 12, 6, 0, -6, 26, 18, 41252 }, // ̈
-    { 10, 10, 0, -5, 29, 25, 41270 }, // ̉
-    { 10, 9, 0, -5, 28, 23, 41295 }, // ̊
-    { 11, 9, 0, -4, 28, 25, 41318 }, // ̋
-    { 12, 8, 0, -6, 28, 24, 41343 }, // ̌
-    { 11, 9, 0, -7, 28, 25, 41367 }, // ̏
-    { 12, 6, 0, -6, 26, 18, 41392 }, // ̑
-    { 6, 10, 0, -3, 29, 15, 41410 }, // ̒
-    { 7, 9, 0, -3, 29, 16, 41425 }, // ̓
-    { 7, 9, 0, -4, 29, 16, 41441 }, // ̔
-    { 5, 9, 0, -2, 29, 12, 41457 }, // ̕
-    { 6, 9, 0, -3, 22, 14, 41469 }, // ̛
-    { 6, 6, 0, -3, -2, 9, 41483 }, // ̣
-    { 12, 5, 0, -6, -3, 15, 41492 }, // ̤
-    { 8, 8, 0, -4, -1, 16, 41507 }, // ̥
-    { 7, 8, 0, -4, -1, 14, 41523 }, // ̦
-    { 8, 8, 0, -4, -1, 16, 41537 }, // ̧
-    { 8, 9, 0, -4, 1, 18, 41553 }, // ̨
-    { 5, 9, 9, 2, -1, 12, 41571 }, // ̩
-    { 12, 7, 0, -6, -2, 21, 41583 }, // ̭
-    { 12, 6, 0, -6, -2, 18, 41604 }, // ̮
-    { 12, 7, 0, -6, -2, 21, 41622 }, // ̰
-    { 12, 4, 0, -6, -3, 12, 41643 }, // ̱
-    { 12, 6, 0, -6, 26, 18, 41655 }, // ͂
-    { 12, 14, 0, -6, 34, 42, 41673 }, // ̈́
-    { 7, 7, 0, -3, -2, 13, 41715 }, // ͅ
-    { 20, 32, 21, 1, 32, 160, 41728 }, // Ѐ
-    { 20, 31, 21, 1, 31, 155, 41888 }, // Ё
-    { 27, 30, 28, 0, 23, 203, 42043 }, // Ђ
-    { 19, 32, 21, 1, 32, 152, 42246 }, // Ѓ
-    { 21, 25, 23, 1, 24, 132, 42398 }, // Є
-    { 17, 25, 19, 1, 24, 107, 42530 }, // Ѕ
-    { 12, 23, 14, 1, 23, 69, 42637 }, // І
-    { 14, 31, 14, 0, 31, 109, 42706 }, // Ї
-    { 15, 30, 13, -2, 23, 113, 42815 }, // Ј
-    { 32, 24, 33, 0, 23, 192, 42928 }, // Љ
-    { 33, 24, 35, 1, 23, 198, 43120 }, // Њ
-    { 30, 23, 30, 0, 23, 173, 43318 }, // Ћ
-    { 24, 33, 25, 1, 32, 198, 43491 }, // Ќ
-    { 26, 32, 28, 1, 32, 208, 43689 }, // Ѝ
-    { 24, 33, 24, 0, 32, 198, 43897 }, // Ў
-    { 25, 31, 27, 1, 23, 194, 44095 }, // Џ
-    { 26, 24, 25, 0, 24, 156, 44289 }, // А
-    { 20, 24, 22, 1, 23, 120, 44445 }, // Б
-    { 20, 25, 21, 1, 24, 125, 44565 }, // В
-    { 19, 23, 21, 1, 23, 110, 44690 }, // Г
-    { 26, 30, 26, 0, 23, 195, 44800 }, // Д
-    { 20, 23, 21, 1, 23, 115, 44995 }, // Е
-    { 37, 25, 37, 0, 24, 232, 45110 }, // Ж
-    { 19, 25, 21, 1, 24, 119, 45342 }, // З
-    { 26, 23, 28, 1, 23, 150, 45461 }, // И
-    { 26, 32, 28, 1, 32, 208, 45611 }, // Й
-    { 24, 25, 25, 1, 24, 150, 45819 }, // К
-    { 25, 24, 26, 0, 23, 150, 45969 }, // Л
-    { 31, 23, 31, 0, 23, 179, 46119 }, // М
-    { 27, 23, 28, 1, 23, 156, 46298 }, // Н
-    { 24, 25, 26, 1, 24, 150, 46454 }, // О
-    { 26, 23, 28, 1, 23, 150, 46604 }, // П
-    { 19, 24, 21, 1, 24, 114, 46754 }, // Р
-    { 20, 25, 22, 1, 24, 125, 46868 }, // С
-    { 23, 23, 24, 0, 23, 133, 46993 }, // Т
-    { 24, 24, 24, 0, 23, 144, 47126 }, // У
-    { 25, 25, 27, 1, 24, 157, 47270 }, // Ф
-    { 25, 23, 25, 0, 23, 144, 47427 }, // Х
-    { 26, 30, 28, 1, 23, 195, 47571 }, // Ц
-    { 25, 23, 26, 0, 23, 144, 47766 }, // Ч
-    { 35, 23, 37, 1, 23, 202, 47910 }, // Ш
-    { 36, 30, 37, 1, 23, 270, 48112 }, // Щ
-    { 25, 24, 26, 0, 23, 150, 48382 }, // Ъ
-    { 32, 24, 34, 1, 23, 192, 48532 }, // Ы
-    { 20, 24, 22, 1, 23, 120, 48724 }, // Ь
-    { 21, 25, 23, 1, 24, 132, 48844 }, // Э
-    { 35, 25, 37, 1, 24, 219, 48976 }, // Ю
-    { 23, 24, 24, 0, 23, 138, 49195 }, // Я
-    { 18, 19, 19, 1, 18, 86, 49333 }, // а
-    { 18, 28, 20, 1, 27, 126, 49419 }, // б
-    { 17, 19, 19, 1, 18, 81, 49545 }, // в
-    { 16, 18, 18, 1, 18, 72, 49626 }, // г
-    { 22, 24, 22, 0, 18, 132, 49698 }, // д
-    { 16, 19, 18, 1, 18, 76, 49830 }, // е
-    { 30, 19, 30, 0, 18, 143, 49906 }, // ж
-    { 16, 19, 17, 0, 18, 76, 50049 }, // з
-    { 21, 18, 23, 1, 18, 95, 50125 }, // и
-    { 21, 26, 23, 1, 26, 137, 50220 }, // й
-    { 20, 19, 21, 1, 18, 95, 50357 }, // к
-    { 21, 19, 21, 0, 18, 100, 50452 }, // л
-    { 24, 18, 26, 1, 18, 108, 50552 }, // м
-    { 21, 18, 23, 1, 18, 95, 50660 }, // н
-    { 18, 19, 20, 1, 18, 86, 50755 }, // о
-    { 21, 18, 23, 1, 18, 95, 50841 }, // п
-    { 20, 26, 21, 0, 18, 130, 50936 }, // р
-    { 15, 19, 17, 1, 18, 72, 51066 }, // с
-    { 20, 18, 20, 0, 18, 90, 51138 }, // т
-    { 22, 26, 21, 0, 18, 143, 51228 }, // у
-    { 24, 34, 26, 1, 26, 204, 51371 }, // ф
-    { 21, 18, 21, 0, 18, 95, 51575 }, // х
-    { 22, 24, 23, 1, 18, 132, 51670 }, // ц
-    { 20, 18, 21, 0, 18, 90, 51802 }, // ч
-    { 29, 18, 30, 1, 18, 131, 51892 }, // ш
-    { 30, 24, 31, 1, 18, 180, 52023 }, // щ
-    { 22, 19, 22, 0, 18, 105, 52203 }, // ъ
-    { 27, 19, 29, 1, 18, 129, 52308 }, // ы
-    { 17, 19, 18, 1, 18, 81, 52437 }, // ь
-    { 17, 19, 18, 0, 18, 81, 52518 }, // э
-    { 28, 19, 29, 1, 18, 133, 52599 }, // ю
-    { 19, 19, 20, 0, 18, 91, 52732 }, // я
-    { 16, 29, 18, 1, 28, 116, 52823 }, // ѐ
-    { 16, 27, 18, 1, 26, 108, 52939 }, // ё
-    { 20, 34, 21, 0, 26, 170, 53047 }, // ђ
-    { 16, 28, 18, 1, 28, 112, 53217 }, // ѓ
-    { 16, 19, 18, 1, 18, 76, 53329 }, // є
-    { 15, 19, 17, 1, 18, 72, 53405 }, // ѕ
-    { 12, 26, 12, 0, 26, 78, 53477 }, // і
-    { 12, 26, 12, 0, 26, 78, 53555 }, // ї
-    { 12, 34, 10, -3, 26, 102, 53633 }, // ј
-    { 26, 19, 27, 0, 18, 124, 53735 }, // љ
-    { 27, 19, 29, 1, 18, 129, 53859 }, // њ
-    { 22, 26, 22, 0, 26, 143, 53988 }, // ћ
-    { 20, 29, 21, 1, 28, 145, 54131 }, // ќ
-    { 21, 28, 23, 1, 28, 147, 54276 }, // ѝ
-    { 22, 34, 21, 0, 26, 187, 54423 }, // ў
-    { 21, 25, 23, 1, 18, 132, 54610 }, // џ
-    { 23, 27, 25, 1, 26, 156, 54742 }, // Ѣ
-    { 21, 25, 21, 0, 24, 132, 54898 }, // ѣ
-    { 24, 25, 26, 1, 24, 150, 55030 }, // Ѳ
-    { 18, 19, 20, 1, 18, 86, 55180 }, // ѳ
-    { 26, 25, 26, 0, 24, 163, 55266 }, // Ѵ
-    { 22, 19, 22, 0, 18, 105, 55429 }, // ѵ
-    { 27, 39, 28, 1, 32, 264, 55534 }, // Ҋ
-    { 22, 32, 23, 1, 26, 176, 55798 }, // ҋ
-    { 20, 24, 22, 1, 23, 120, 55974 }, // Ҍ
-    { 18, 25, 18, 0, 24, 113, 56094 }, // ҍ
-    { 19, 24, 21, 1, 24, 114, 56207 }, // Ҏ
-    { 20, 26, 21, 0, 18, 130, 56321 }, // ҏ
-    { 18, 28, 19, 1, 28, 126, 56451 }, // Ґ
-    { 15, 22, 17, 1, 22, 83, 56577 }, // ґ
-    { 19, 23, 20, 1, 23, 110, 56660 }, // Ғ
-    { 17, 18, 18, 0, 18, 77, 56770 }, // ғ
-    { 22, 30, 24, 1, 23, 165, 56847 }, // Ҕ
-    { 19, 26, 20, 1, 18, 124, 57012 }, // ҕ
-    { 37, 31, 37, 0, 24, 287, 57136 }, // Җ
-    { 30, 24, 30, 0, 18, 180, 57423 }, // җ
-    { 19, 32, 21, 1, 24, 152, 57603 }, // Ҙ
-    { 16, 25, 17, 0, 18, 100, 57755 }, // ҙ
-    { 24, 31, 25, 1, 24, 186, 57855 }, // Қ
-    { 20, 24, 21, 1, 18, 120, 58041 }, // қ
-    { 26, 25, 27, 1, 24, 163, 58161 }, // Ҝ
-    { 21, 19, 22, 1, 18, 100, 58324 }, // ҝ
-    { 24, 25, 25, 1, 24, 150, 58424 }, // Ҟ
-    { 21, 25, 21, 0, 24, 132, 58574 }, // ҟ
-    { 29, 25, 29, 0, 24, 182, 58706 }, // Ҡ
-    { 25, 19, 25, 0, 18, 119, 58888 }, // ҡ
-    { 28, 30, 29, 1, 23, 210, 59007 }, // Ң
-    { 22, 24, 24, 1, 18, 132, 59217 }, // ң
-    { 31, 23, 33, 1, 23, 179, 59349 }, // Ҥ
-    { 26, 18, 27, 1, 18, 117, 59528 }, // ҥ
-    { 35, 30, 37, 1, 23, 263, 59645 }, // Ҧ
-    { 29, 26, 31, 1, 18, 189, 59908 }, // ҧ
-    { 27, 25, 28, 1, 24, 169, 60097 }, // Ҩ
-    { 22, 19, 23, 1, 18, 105, 60266 }, // ҩ
-    { 20, 32, 22, 1, 24, 160, 60371 }, // Ҫ
-    { 15, 25, 17, 1, 18, 94, 60531 }, // ҫ
-    { 23, 30, 24, 0, 23, 173, 60625 }, // Ҭ
-    { 20, 24, 20, 0, 18, 120, 60798 }, // ҭ
-    { 24, 23, 24, 0, 23, 138, 60918 }, // Ү
-    { 22, 26, 22, 0, 18, 143, 61056 }, // ү
-    { 24, 23, 24, 0, 23, 138, 61199 }, // Ұ
-    { 22, 26, 22, 0, 18, 143, 61337 }, // ұ
-    { 26, 30, 26, 0, 23, 195, 61480 }, // Ҳ
-    { 21, 24, 21, 0, 18, 126, 61675 }, // ҳ
-    { 30, 30, 31, 0, 23, 225, 61801 }, // Ҵ
-    { 26, 24, 27, 0, 18, 156, 62026 }, // ҵ
-    { 26, 30, 26, 0, 23, 195, 62182 }, // Ҷ
-    { 21, 24, 22, 0, 18, 126, 62377 }, // ҷ
-    { 25, 23, 26, 0, 23, 144, 62503 }, // Ҹ
-    { 21, 18, 22, 0, 18, 95, 62647 }, // ҹ
-    { 25, 23, 26, 1, 23, 144, 62742 }, // Һ
-    { 22, 26, 22, 0, 26, 143, 62886 }, // һ
-    { 27, 25, 28, 0, 24, 169, 63029 }, // Ҽ
-    { 21, 19, 22, 0, 18, 100, 63198 }, // ҽ
-    { 27, 31, 28, 0, 24, 210, 63298 }, // Ҿ
-    { 21, 25, 22, 0, 18, 132, 63508 }, // ҿ
-    { 12, 23, 14, 1, 23, 69, 63640 }, // Ӏ
-    { 37, 33, 37, 0, 32, 306, 63709 }, // Ӂ
-    { 30, 27, 30, 0, 26, 203, 64015 }, // ӂ
-    { 23, 31, 24, 1, 24, 179, 64218 }, // Ӄ
-    { 19, 26, 21, 1, 18, 124, 64397 }, // ӄ
-    { 25, 30, 26, 0, 23, 188, 64521 }, // Ӆ
-    { 21, 24, 21, 0, 18, 126, 64709 }, // ӆ
-    { 27, 30, 28, 1, 23, 203, 64835 }, // Ӈ
-    { 21, 26, 23, 1, 18, 137, 65038 }, // ӈ
-    { 27, 30, 28, 1, 23, 203, 65175 }, // Ӊ
-    { 22, 24, 23, 1, 18, 132, 65378 }, // ӊ
-    { 25, 30, 26, 0, 23, 188, 65510 }, // Ӌ
-    { 20, 24, 21, 0, 18, 120, 65698 }, // ӌ
-    { 32, 30, 32, 0, 23, 240, 65818 }, // Ӎ
-    { 25, 24, 26, 1, 18, 150, 66058 }, // ӎ
-    { 12, 26, 14, 1, 26, 78, 66208 }, // ӏ
-    { 26, 32, 25, 0, 32, 208, 66286 }, // Ӑ
-    { 18, 27, 19, 1, 26, 122, 66494 }, // ӑ
-    { 26, 31, 25, 0, 31, 202, 66616 }, // Ӓ
-    { 18, 27, 19, 1, 26, 122, 66818 }, // ӓ
-    { 33, 23, 32, -1, 23, 190, 66940 }, // Ӕ
-    { 26, 19, 27, 1, 18, 124, 67130 }, // ӕ
-    { 20, 32, 21, 1, 32, 160, 67254 }, // Ӗ
-    { 16, 27, 18, 1, 26, 108, 67414 }, // ӗ
-    { 21, 25, 23, 1, 24, 132, 67522 }, // Ә
-    { 16, 19, 18, 1, 18, 76, 67654 }, // ә
-    { 21, 32, 23, 1, 31, 168, 67730 }, // Ӛ
-    { 16, 27, 18, 1, 26, 108, 67898 }, // ӛ
-    { 37, 32, 37, 0, 31, 296, 68006 }, // Ӝ
-    { 30, 27, 30, 0, 26, 203, 68302 }, // ӝ
-    { 19, 32, 21, 1, 31, 152, 68505 }, // Ӟ
-    { 16, 27, 17, 0, 26, 108, 68657 }, // ӟ
-    { 18, 24, 19, 0, 23, 108, 68765 }, // Ӡ
-    { 17, 26, 18, 0, 18, 111, 68873 }, // ӡ
-    { 26, 30, 28, 1, 30, 195, 68984 }, // Ӣ
-    { 21, 24, 23, 1, 24, 126, 69179 }, // ӣ
-    { 26, 31, 28, 1, 31, 202, 69305 }, // Ӥ
-    { 21, 26, 23, 1, 26, 137, 69507 }, // ӥ
-    { 24, 32, 26, 1, 31, 192, 69644 }, // Ӧ
-    { 18, 27, 20, 1, 26, 122, 69836 }, // ӧ
-    { 24, 25, 26, 1, 24, 150, 69958 }, // Ө
-    { 18, 19, 20, 1, 18, 86, 70108 }, // ө
-    { 24, 32, 26, 1, 31, 192, 70194 }, // Ӫ
-    { 18, 27, 20, 1, 26, 122, 70386 }, // ӫ
-    { 21, 32, 23, 1, 31, 168, 70508 }, // Ӭ
-    { 17, 27, 18, 0, 26, 115, 70676 }, // ӭ
-    { 24, 31, 24, 0, 30, 186, 70791 }, // Ӯ
-    { 22, 32, 21, 0, 24, 176, 70977 }, // ӯ
-    { 24, 32, 24, 0, 31, 192, 71153 }, // Ӱ
-    { 22, 34, 21, 0, 26, 187, 71345 }, // ӱ
-    { 24, 34, 24, 0, 33, 204, 71532 }, // Ӳ
-    { 22, 36, 21, 0, 28, 198, 71736 }, // ӳ
-    { 25, 31, 26, 0, 31, 194, 71934 }, // Ӵ
-    { 20, 26, 21, 0, 26, 130, 72128 }, // ӵ
-    { 19, 30, 21, 1, 23, 143, 72258 }, // Ӷ
-    { 16, 24, 18, 1, 18, 96, 72401 }, // ӷ
-    { 32, 32, 34, 1, 31, 256, 72497 }, // Ӹ
-    { 27, 27, 29, 1, 26, 183, 72753 }, // ӹ
-    { 19, 30, 20, 1, 23, 143, 72936 }, // Ӻ
-    { 17, 25, 18, 0, 18, 107, 73079 }, // ӻ
-    { 25, 30, 25, 0, 23, 188, 73186 }, // Ӽ
-    { 20, 26, 20, 0, 18, 130, 73374 }, // ӽ
-    { 25, 23, 25, 0, 23, 144, 73504 }, // Ӿ
-    { 21, 18, 21, 0, 18, 95, 73648 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 73743 }, //  
-    { 0, 0, 33, 0, 0, 0, 73743 }, //  
-    { 0, 0, 17, 0, 0, 0, 73743 }, //  
-    { 0, 0, 33, 0, 0, 0, 73743 }, //  
-    { 0, 0, 11, 0, 0, 0, 73743 }, //  
-    { 0, 0, 8, 0, 0, 0, 73743 }, //  
-    { 0, 0, 5, 0, 0, 0, 73743 }, //  
-    { 0, 0, 21, 0, 0, 0, 73743 }, //  
-    { 0, 0, 10, 0, 0, 0, 73743 }, //  
-    { 0, 0, 7, 0, 0, 0, 73743 }, //  
-    { 0, 0, 2, 0, 0, 0, 73743 }, //  
-    { 0, 0, 0, 0, 0, 0, 73743 }, // ​
-    { 2, 28, 0, -1, 20, 14, 73743 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 73757 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 73817 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 73910 }, // ‏
-    { 11, 5, 13, 1, 11, 14, 74003 }, // ‐
-    { 11, 5, 13, 1, 11, 14, 74017 }, // ‑
-    { 17, 4, 21, 2, 13, 17, 74031 }, // ‒
-    { 17, 5, 17, 0, 11, 22, 74048 }, // –
-    { 33, 5, 33, 0, 11, 42, 74070 }, // —
-    { 33, 5, 33, 0, 11, 42, 74112 }, // ―
-    { 12, 34, 17, 2, 26, 102, 74154 }, // ‖
-    { 17, 9, 17, 0, -1, 39, 74256 }, // ‗
-    { 7, 11, 8, 1, 25, 20, 74295 }, // ‘
-    { 7, 11, 8, 0, 25, 20, 74315 }, // ’
-    { 7, 11, 8, 0, 5, 20, 74335 }, // ‚
-    { 7, 11, 8, 1, 25, 20, 74355 }, // ‛
-    { 13, 11, 15, 1, 25, 36, 74375 }, // “
-    { 14, 11, 15, 0, 25, 39, 74411 }, // ”
-    { 14, 11, 15, 0, 5, 39, 74450 }, // „
-    { 13, 11, 15, 1, 25, 36, 74489 }, // ‟
-    { 15, 22, 16, 1, 24, 83, 74525 }, // †
-    { 15, 26, 16, 1, 24, 98, 74608 }, // ‡
-    { 8, 8, 10, 1, 13, 16, 74706 }, // •
-    { 12, 12, 21, 4, 17, 36, 74722 }, // ‣
-    { 7, 6, 10, 1, 5, 11, 74758 }, // ․
-    { 15, 6, 17, 1, 5, 23, 74769 }, // ‥
-    { 29, 6, 33, 2, 5, 44, 74792 }, // …
-    { 7, 6, 10, 1, 12, 11, 74836 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 74847 }, //  
-    { 0, 0, 0, 0, 0, 0, 74847 }, //  
-    { 12, 31, 0, -6, 23, 93, 74847 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 74940 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 75033 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 75111 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 75220 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 75329 }, //  
-    { 44, 27, 46, 1, 25, 297, 75329 }, // ‰
-    { 9, 11, 9, 0, 23, 25, 75626 }, // ′
-    { 16, 11, 16, 0, 23, 44, 75651 }, // ″
-    { 23, 11, 23, 0, 23, 64, 75695 }, // ‴
-    { 9, 11, 9, 0, 23, 25, 75759 }, // ‵
-    { 15, 11, 17, 1, 23, 42, 75784 }, // ‶
-    { 22, 11, 24, 1, 23, 61, 75826 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 75887 }, // ‸
-    { 9, 13, 11, 1, 15, 30, 75912 }, // ‹
-    { 9, 13, 11, 1, 15, 30, 75942 }, // ›
-    { 21, 23, 21, 0, 22, 121, 75972 }, // ※
-    { 16, 26, 19, 2, 25, 104, 76093 }, // ‼
-    { 17, 4, 17, 0, 28, 17, 76197 }, // ‾
-    { 8, 5, 10, 1, 11, 10, 76214 }, // ⁃
-    { 18, 28, 6, -6, 25, 126, 76224 }, // ⁄
-    { 28, 26, 31, 2, 25, 182, 76350 }, // ⁇
-    { 23, 26, 25, 2, 25, 150, 76532 }, // ⁈
-    { 22, 26, 25, 2, 25, 143, 76682 }, // ⁉
-    { 20, 7, 33, 6, 13, 35, 76825 }, // ⁓
-    { 30, 11, 31, 0, 23, 83, 76860 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 76943 }, //  
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁤
-    { 15, 17, 15, 0, 28, 64, 76943 }, // ⁰
-    { 14, 17, 15, 0, 28, 60, 77007 }, // ⁴
-    { 11, 16, 15, 2, 27, 44, 77067 }, // ⁵
-    { 13, 17, 15, 1, 28, 56, 77111 }, // ⁶
-    { 12, 16, 15, 2, 27, 48, 77167 }, // ⁷
-    { 13, 17, 15, 1, 28, 56, 77215 }, // ⁸
-    { 13, 17, 15, 1, 28, 56, 77271 }, // ⁹
-    { 15, 11, 19, 2, 23, 42, 77327 }, // ⁿ
-    { 15, 16, 15, 0, 11, 60, 77369 }, // ₀
-    { 11, 16, 15, 2, 11, 44, 77429 }, // ₁
-    { 13, 16, 15, 1, 11, 52, 77473 }, // ₂
-    { 12, 16, 15, 1, 11, 48, 77525 }, // ₃
-    { 14, 16, 15, 0, 11, 56, 77573 }, // ₄
-    { 11, 16, 15, 2, 11, 44, 77629 }, // ₅
-    { 13, 16, 15, 1, 11, 52, 77673 }, // ₆
-    { 12, 16, 15, 2, 11, 48, 77725 }, // ₇
-    { 13, 16, 15, 1, 11, 52, 77773 }, // ₈
-    { 13, 16, 15, 1, 11, 52, 77825 }, // ₉
-    { 19, 23, 21, 1, 23, 110, 77877 }, // ₣
-    { 20, 24, 21, 0, 23, 120, 77987 }, // ₤
-    { 44, 24, 45, 0, 23, 264, 78107 }, // ₧
-    { 21, 24, 21, 0, 23, 126, 78371 }, // €
-    { 21, 15, 33, 6, 19, 79, 78497 }, // ←
-    { 15, 21, 33, 9, 22, 79, 78576 }, // ↑
-    { 21, 15, 33, 6, 19, 79, 78655 }, // →
-    { 15, 21, 33, 9, 22, 79, 78734 }, // ↓
-    { 21, 15, 33, 6, 19, 79, 78813 }, // ↔
-    { 15, 23, 33, 9, 23, 87, 78892 }, // ↕
-    { 15, 23, 33, 9, 23, 87, 78979 }, // ↨
-    { 15, 23, 33, 9, 23, 87, 79066 }, // ↲
-    { 15, 23, 33, 9, 23, 87, 79153 }, // ↳
-    { 19, 18, 33, 7, 20, 86, 79240 }, // ↵
-    { 21, 19, 33, 6, 21, 100, 79326 }, // ⇐
-    { 19, 21, 33, 7, 22, 100, 79426 }, // ⇑
-    { 21, 19, 33, 6, 21, 100, 79526 }, // ⇒
-    { 19, 21, 33, 7, 22, 100, 79626 }, // ⇓
-    { 21, 17, 33, 6, 20, 90, 79726 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 79816 }, // ∀
-    { 18, 27, 21, 1, 26, 122, 79954 }, // ∂
-    { 17, 23, 33, 8, 23, 98, 80076 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 80174 }, // ∅
-    { 22, 24, 23, 0, 24, 132, 80343 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 80475 }, // ∇
-    { 23, 23, 33, 5, 23, 133, 80601 }, // ∈
-    { 23, 29, 33, 5, 26, 167, 80734 }, // ∉
-    { 23, 20, 33, 5, 21, 115, 80901 }, // ∊
-    { 23, 23, 33, 5, 23, 133, 81016 }, // ∋
-    { 23, 29, 33, 5, 26, 167, 81149 }, // ∌
-    { 23, 20, 33, 5, 21, 115, 81316 }, // ∍
-    { 26, 29, 28, 1, 23, 189, 81431 }, // ∏
-    { 21, 29, 22, 1, 23, 153, 81620 }, // ∑
-    { 15, 4, 21, 3, 13, 15, 81773 }, // −
-    { 16, 26, 17, 1, 24, 104, 81788 }, // ∕
-    { 16, 26, 17, 1, 24, 104, 81892 }, // ∖
-    { 16, 16, 21, 2, 19, 64, 81996 }, // ∗
-    { 13, 12, 21, 4, 17, 39, 82060 }, // ∘
-    { 7, 6, 21, 7, 12, 11, 82099 }, // ∙
-    { 22, 31, 21, -1, 27, 171, 82110 }, // √
-    { 17, 13, 21, 2, 17, 56, 82281 }, // ∝
-    { 21, 13, 21, 0, 17, 69, 82337 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 82406 }, // ∟
-    { 25, 23, 33, 4, 23, 144, 82527 }, // ∠
-    { 5, 34, 17, 6, 26, 43, 82671 }, // ∣
-    { 12, 34, 17, 2, 26, 102, 82714 }, // ∥
-    { 23, 23, 33, 5, 23, 133, 82816 }, // ∧
-    { 23, 23, 33, 5, 23, 133, 82949 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 83082 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 83196 }, // ∪
-    { 19, 34, 21, 1, 26, 162, 83310 }, // ∫
-    { 23, 20, 33, 5, 19, 115, 83472 }, // ∴
-    { 23, 20, 33, 5, 19, 115, 83587 }, // ∵
-    { 7, 19, 10, 2, 21, 34, 83702 }, // ∶
-    { 23, 20, 33, 5, 19, 115, 83736 }, // ∷
-    { 20, 7, 33, 6, 13, 35, 83851 }, // ∼
-    { 20, 18, 33, 6, 20, 90, 83886 }, // ≅
-    { 17, 14, 21, 2, 18, 60, 83976 }, // ≈
-    { 19, 13, 33, 7, 16, 62, 84036 }, // ≍
-    { 15, 16, 21, 3, 19, 60, 84098 }, // ≠
-    { 19, 16, 33, 7, 18, 76, 84158 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 84234 }, // ≤
-    { 15, 21, 21, 3, 21, 79, 84309 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 84388 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 84496 }, // ≫
-    { 23, 20, 33, 5, 21, 115, 84604 }, // ⊃
-    { 23, 29, 33, 5, 26, 167, 84719 }, // ⊄
-    { 23, 29, 33, 5, 26, 167, 84886 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 85053 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 85174 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 85295 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 85452 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 85609 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 85766 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 85923 }, // ⊥
-    { 7, 6, 21, 7, 12, 11, 86033 }, // ⋅
-    { 29, 6, 33, 2, 12, 44, 86044 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 86088 }, // �
+    { 18, 24, 21, 1, 23, 108, 2048 }, // 8
+    { 18, 24, 21, 1, 23, 108, 2156 }, // 9
+    { 7, 19, 10, 1, 18, 34, 2264 }, // :
+    { 9, 25, 10, 0, 18, 57, 2298 }, // ;
+    { 15, 16, 21, 3, 19, 60, 2355 }, // <
+    { 15, 10, 21, 3, 16, 38, 2415 }, // =
+    { 15, 16, 21, 3, 19, 60, 2453 }, // >
+    { 13, 26, 16, 2, 25, 85, 2513 }, // ?
+    { 31, 30, 33, 1, 23, 233, 2598 }, // @
+    { 26, 24, 25, 0, 24, 156, 2831 }, // A
+    { 20, 25, 21, 1, 24, 125, 2987 }, // B
+    { 20, 25, 22, 1, 24, 125, 3112 }, // C
+    { 24, 25, 26, 1, 24, 150, 3237 }, // D
+    { 20, 23, 21, 1, 23, 115, 3387 }, // E
+    { 18, 23, 20, 1, 23, 104, 3502 }, // F
+    { 23, 25, 24, 1, 24, 144, 3606 }, // G
+    { 27, 23, 28, 1, 23, 156, 3750 }, // H
+    { 12, 23, 14, 1, 23, 69, 3906 }, // I
+    { 15, 30, 13, -2, 23, 113, 3975 }, // J
+    { 24, 24, 25, 1, 23, 144, 4096 }, // K
+    { 20, 23, 21, 1, 23, 115, 4240 }, // L
+    { 31, 23, 31, 0, 23, 179, 4355 }, // M
+    { 27, 24, 27, 0, 23, 162, 4534 }, // N
+    { 24, 25, 26, 1, 24, 150, 4696 }, // O
+    { 19, 24, 21, 1, 24, 114, 4846 }, // P
+    { 25, 32, 26, 1, 24, 200, 4960 }, // Q
+    { 23, 25, 23, 1, 24, 144, 5160 }, // R
+    { 17, 25, 19, 1, 24, 107, 5304 }, // S
+    { 23, 23, 24, 0, 23, 133, 5411 }, // T
+    { 26, 24, 27, 0, 23, 156, 5544 }, // U
+    { 26, 24, 26, 0, 23, 156, 5700 }, // V
+    { 37, 24, 37, 0, 23, 222, 5856 }, // W
+    { 25, 23, 25, 0, 23, 144, 6144 }, // X
+    { 24, 23, 24, 0, 23, 138, 6288 }, // Y
+    { 20, 24, 20, 0, 23, 120, 6426 }, // Z
+    { 8, 32, 11, 2, 26, 64, 6546 }, // [
+    { 16, 26, 17, 1, 24, 104, 6610 }, // <backslash>
+    { 9, 32, 11, 1, 26, 72, 6714 }, // ]
+    { 17, 17, 21, 2, 22, 73, 6786 }, // ^
+    { 17, 4, 17, 0, -1, 17, 6859 }, // _
+    { 8, 9, 22, 7, 28, 18, 6876 }, // `
+    { 18, 19, 19, 1, 18, 86, 6894 }, // a
+    { 21, 27, 20, -1, 26, 142, 6980 }, // b
+    { 15, 19, 17, 1, 18, 72, 7122 }, // c
+    { 20, 27, 21, 1, 26, 135, 7194 }, // d
+    { 16, 19, 18, 1, 18, 76, 7329 }, // e
+    { 18, 26, 14, 0, 26, 117, 7405 }, // f
+    { 20, 26, 20, 0, 18, 130, 7522 }, // g
+    { 22, 26, 22, 0, 26, 143, 7652 }, // h
+    { 12, 26, 12, 0, 26, 78, 7795 }, // i
+    { 12, 34, 10, -3, 26, 102, 7873 }, // j
+    { 21, 27, 21, 0, 26, 142, 7975 }, // k
+    { 11, 26, 12, 0, 26, 72, 8117 }, // l
+    { 33, 18, 33, 0, 18, 149, 8192 }, // m
+    { 22, 18, 22, 0, 18, 99, 8341 }, // n
+    { 18, 19, 20, 1, 18, 86, 8440 }, // o
+    { 20, 26, 21, 0, 18, 130, 8526 }, // p
+    { 19, 26, 20, 1, 18, 124, 8656 }, // q
+    { 16, 18, 16, 0, 18, 72, 8780 }, // r
+    { 15, 19, 17, 1, 18, 72, 8852 }, // s
+    { 15, 23, 14, -1, 22, 87, 8924 }, // t
+    { 22, 19, 22, 0, 18, 105, 9011 }, // u
+    { 22, 19, 22, 0, 18, 105, 9116 }, // v
+    { 30, 19, 30, 0, 18, 143, 9221 }, // w
+    { 21, 18, 21, 0, 18, 95, 9364 }, // x
+    { 22, 26, 21, 0, 18, 143, 9459 }, // y
+    { 17, 19, 17, 0, 18, 81, 9602 }, // z
+    { 11, 33, 13, 2, 27, 91, 9683 }, // {
+    { 5, 30, 10, 3, 26, 38, 9774 }, // |
+    { 12, 33, 13, 0, 27, 99, 9812 }, // }
+    { 17, 8, 21, 2, 15, 34, 9911 }, // ~
+    { 0, 0, 7, 0, 0, 0, 9945 }, //  
+    { 7, 26, 10, 1, 18, 46, 9945 }, // ¡
+    { 18, 33, 21, 1, 26, 149, 9991 }, // ¢
+    { 20, 24, 21, 0, 23, 120, 10240 }, // £
+    { 19, 16, 21, 1, 19, 76, 10360 }, // ¤
+    { 23, 23, 21, -1, 23, 133, 10436 }, // ¥
+    { 5, 30, 10, 3, 26, 38, 10569 }, // ¦
+    { 15, 26, 17, 1, 23, 98, 10607 }, // §
+    { 13, 6, 22, 5, 26, 20, 10705 }, // ¨
+    { 25, 25, 26, 0, 24, 157, 10725 }, // ©
+    { 13, 17, 15, 1, 24, 56, 10882 }, // ª
+    { 18, 13, 19, 1, 15, 59, 10938 }, // «
+    { 15, 9, 21, 3, 16, 34, 10997 }, // ¬
+    { 11, 5, 13, 1, 11, 14, 11031 }, // ­
+    { 19, 18, 19, 0, 26, 86, 11045 }, // ®
+    { 12, 4, 22, 5, 24, 12, 11131 }, // ¯
+    { 13, 12, 17, 2, 23, 39, 11143 }, // °
+    { 15, 21, 21, 3, 20, 79, 11182 }, // ±
+    { 13, 16, 15, 1, 28, 52, 11261 }, // ²
+    { 12, 17, 15, 1, 28, 51, 11313 }, // ³
+    { 7, 9, 22, 8, 28, 16, 11364 }, // ´
+    { 22, 26, 22, 1, 18, 143, 11380 }, // µ
+    { 19, 28, 20, 0, 23, 133, 11523 }, // ¶
+    { 7, 6, 10, 1, 12, 11, 11656 }, // ·
+    { 7, 8, 22, 8, -1, 14, 11667 }, // ¸
+    { 11, 16, 15, 2, 28, 44, 11681 }, // ¹
+    { 13, 17, 15, 1, 24, 56, 11725 }, // º
+    { 18, 13, 19, 1, 15, 59, 11781 }, // »
+    { 33, 28, 36, 2, 25, 231, 11840 }, // ¼
+    { 33, 28, 36, 2, 25, 231, 12288 }, // ½
+    { 34, 28, 36, 1, 25, 238, 12519 }, // ¾
+    { 14, 25, 16, 1, 18, 88, 12757 }, // ¿
+    { 26, 32, 25, 0, 32, 208, 12845 }, // À
+    { 26, 32, 25, 0, 32, 208, 13053 }, // Á
+    { 26, 32, 25, 0, 32, 208, 13261 }, // Â
+    { 26, 32, 25, 0, 32, 208, 13469 }, // Ã
+    { 26, 31, 25, 0, 31, 202, 13677 }, // Ä
+    { 26, 33, 25, 0, 33, 215, 13879 }, // Å
+    { 33, 23, 32, -1, 23, 190, 14094 }, // Æ
+    { 20, 33, 22, 1, 24, 165, 14336 }, // Ç
+    { 20, 32, 21, 1, 32, 160, 14501 }, // È
+    { 20, 32, 21, 1, 32, 160, 14661 }, // É
+    { 20, 32, 21, 1, 32, 160, 14821 }, // Ê
+    { 20, 31, 21, 1, 31, 155, 14981 }, // Ë
+    { 12, 32, 14, 1, 32, 96, 15136 }, // Ì
+    { 12, 32, 14, 1, 32, 96, 15232 }, // Í
+    { 13, 32, 14, 0, 32, 104, 15328 }, // Î
+    { 14, 31, 14, 0, 31, 109, 15432 }, // Ï
+    { 25, 25, 26, 0, 24, 157, 15541 }, // Ð
+    { 27, 33, 27, 0, 32, 223, 15698 }, // Ñ
+    { 24, 33, 26, 1, 32, 198, 15921 }, // Ò
+    { 24, 33, 26, 1, 32, 198, 16119 }, // Ó
+    { 24, 33, 26, 1, 32, 198, 16384 }, // Ô
+    { 24, 33, 26, 1, 32, 198, 16582 }, // Õ
+    { 24, 32, 26, 1, 31, 192, 16780 }, // Ö
+    { 15, 15, 21, 3, 19, 57, 16972 }, // ×
+    { 26, 25, 26, 0, 24, 163, 17029 }, // Ø
+    { 26, 33, 27, 0, 32, 215, 17192 }, // Ù
+    { 26, 33, 27, 0, 32, 215, 17407 }, // Ú
+    { 26, 33, 27, 0, 32, 215, 17622 }, // Û
+    { 26, 32, 27, 0, 31, 208, 17837 }, // Ü
+    { 24, 32, 24, 0, 32, 192, 18045 }, // Ý
+    { 20, 23, 21, 1, 23, 115, 18237 }, // Þ
+    { 21, 27, 22, 0, 26, 142, 18432 }, // ß
+    { 18, 29, 19, 1, 28, 131, 18574 }, // à
+    { 18, 29, 19, 1, 28, 131, 18705 }, // á
+    { 18, 28, 19, 1, 27, 126, 18836 }, // â
+    { 18, 27, 19, 1, 26, 122, 18962 }, // ã
+    { 18, 27, 19, 1, 26, 122, 19084 }, // ä
+    { 18, 29, 19, 1, 28, 131, 19206 }, // å
+    { 26, 19, 27, 1, 18, 124, 19337 }, // æ
+    { 15, 27, 17, 1, 18, 102, 19461 }, // ç
+    { 16, 29, 18, 1, 28, 116, 19563 }, // è
+    { 16, 29, 18, 1, 28, 116, 19679 }, // é
+    { 16, 28, 18, 1, 27, 112, 19795 }, // ê
+    { 16, 27, 18, 1, 26, 108, 19907 }, // ë
+    { 12, 28, 12, 0, 28, 84, 20015 }, // ì
+    { 12, 28, 12, 0, 28, 84, 20099 }, // í
+    { 12, 27, 12, 0, 27, 81, 20183 }, // î
+    { 12, 26, 12, 0, 26, 78, 20264 }, // ï
+    { 18, 28, 20, 1, 27, 126, 20342 }, // ð
+    { 22, 26, 22, 0, 26, 143, 20480 }, // ñ
+    { 18, 29, 20, 1, 28, 131, 20623 }, // ò
+    { 18, 29, 20, 1, 28, 131, 20754 }, // ó
+    { 18, 28, 20, 1, 27, 126, 20885 }, // ô
+    { 18, 27, 20, 1, 26, 122, 21011 }, // õ
+    { 18, 27, 20, 1, 26, 122, 21133 }, // ö
+    { 15, 16, 21, 3, 19, 60, 21255 }, // ÷
+    { 20, 19, 20, 0, 18, 95, 21315 }, // ø
+    { 22, 29, 22, 0, 28, 160, 21410 }, // ù
+    { 22, 29, 22, 0, 28, 160, 21570 }, // ú
+    { 22, 28, 22, 0, 27, 154, 21730 }, // û
+    { 22, 27, 22, 0, 26, 149, 21884 }, // ü
+    { 22, 36, 21, 0, 28, 198, 22033 }, // ý
+    { 20, 34, 21, 0, 26, 170, 22231 }, // þ
+    { 22, 34, 21, 0, 26, 187, 22528 }, // ÿ
+    { 26, 30, 25, 0, 30, 195, 22715 }, // Ā
+    { 18, 25, 19, 1, 24, 113, 22910 }, // ā
+    { 26, 32, 25, 0, 32, 208, 23023 }, // Ă
+    { 18, 27, 19, 1, 26, 122, 23231 }, // ă
+    { 26, 32, 25, 0, 24, 208, 23353 }, // Ą
+    { 18, 26, 19, 1, 18, 117, 23561 }, // ą
+    { 20, 33, 22, 1, 32, 165, 23678 }, // Ć
+    { 15, 29, 17, 1, 28, 109, 23843 }, // ć
+    { 20, 33, 22, 1, 32, 165, 23952 }, // Ĉ
+    { 15, 28, 17, 1, 27, 105, 24117 }, // ĉ
+    { 20, 33, 22, 1, 32, 165, 24222 }, // Ċ
+    { 15, 27, 17, 1, 26, 102, 24387 }, // ċ
+    { 20, 33, 22, 1, 32, 165, 24576 }, // Č
+    { 15, 29, 17, 1, 28, 109, 24741 }, // č
+    { 24, 33, 26, 1, 32, 198, 24850 }, // Ď
+    { 23, 27, 21, 1, 26, 156, 25048 }, // ď
+    { 25, 25, 26, 0, 24, 157, 25204 }, // Đ
+    { 20, 27, 21, 1, 26, 135, 25361 }, // đ
+    { 20, 30, 21, 1, 30, 150, 25496 }, // Ē
+    { 16, 25, 18, 1, 24, 100, 25646 }, // ē
+    { 20, 32, 21, 1, 32, 160, 25746 }, // Ĕ
+    { 16, 27, 18, 1, 26, 108, 25906 }, // ĕ
+    { 20, 32, 21, 1, 32, 160, 26014 }, // Ė
+    { 16, 27, 18, 1, 26, 108, 26174 }, // ė
+    { 20, 31, 21, 1, 23, 155, 26282 }, // Ę
+    { 16, 26, 18, 1, 18, 104, 26437 }, // ę
+    { 20, 32, 21, 1, 32, 160, 26624 }, // Ě
+    { 16, 29, 18, 1, 28, 116, 26784 }, // ě
+    { 23, 33, 24, 1, 32, 190, 26900 }, // Ĝ
+    { 20, 35, 20, 0, 27, 175, 27090 }, // ĝ
+    { 23, 33, 24, 1, 32, 190, 27265 }, // Ğ
+    { 20, 34, 20, 0, 26, 170, 27455 }, // ğ
+    { 23, 33, 24, 1, 32, 190, 27625 }, // Ġ
+    { 20, 34, 20, 0, 26, 170, 27815 }, // ġ
+    { 23, 33, 24, 1, 24, 190, 27985 }, // Ģ
+    { 20, 37, 20, 0, 29, 185, 28175 }, // ģ
+    { 27, 32, 28, 1, 32, 216, 28360 }, // Ĥ
+    { 23, 34, 22, -1, 34, 196, 28672 }, // ĥ
+    { 28, 23, 28, 0, 23, 161, 28868 }, // Ħ
+    { 22, 26, 22, 0, 26, 143, 29029 }, // ħ
+    { 12, 32, 14, 1, 32, 96, 29172 }, // Ĩ
+    { 12, 26, 12, 0, 26, 78, 29268 }, // ĩ
+    { 12, 30, 14, 1, 30, 90, 29346 }, // Ī
+    { 12, 24, 12, 0, 24, 72, 29436 }, // ī
+    { 12, 32, 14, 1, 32, 96, 29508 }, // Ĭ
+    { 12, 26, 12, 0, 26, 78, 29604 }, // ĭ
+    { 12, 31, 14, 1, 23, 93, 29682 }, // Į
+    { 12, 34, 12, 0, 26, 102, 29775 }, // į
+    { 12, 32, 14, 1, 32, 96, 29877 }, // İ
+    { 12, 18, 12, 0, 18, 54, 29973 }, // ı
+    { 26, 30, 27, 1, 23, 195, 30027 }, // Ĳ
+    { 21, 34, 22, 0, 26, 179, 30222 }, // ĳ
+    { 15, 39, 13, -2, 32, 147, 30401 }, // Ĵ
+    { 15, 35, 10, -3, 27, 132, 30548 }, // ĵ
+    { 24, 32, 25, 1, 23, 192, 30720 }, // Ķ
+    { 21, 35, 21, 0, 26, 184, 30912 }, // ķ
+    { 22, 19, 21, 0, 18, 105, 31096 }, // ĸ
+    { 20, 32, 21, 1, 32, 160, 31201 }, // Ĺ
+    { 11, 34, 12, 0, 34, 94, 31361 }, // ĺ
+    { 20, 32, 21, 1, 23, 160, 31455 }, // Ļ
+    { 11, 35, 12, 0, 26, 97, 31615 }, // ļ
+    { 20, 26, 21, 1, 26, 130, 31712 }, // Ľ
+    { 15, 26, 12, 0, 26, 98, 31842 }, // ľ
+    { 20, 23, 21, 1, 23, 115, 31940 }, // Ŀ
+    { 18, 26, 18, 0, 26, 117, 32055 }, // ŀ
+    { 22, 23, 21, -1, 23, 127, 32172 }, // Ł
+    { 13, 26, 12, -1, 26, 85, 32299 }, // ł
+    { 27, 33, 27, 0, 32, 223, 32384 }, // Ń
+    { 22, 28, 22, 0, 28, 154, 32607 }, // ń
+    { 27, 32, 27, 0, 23, 216, 32768 }, // Ņ
+    { 22, 27, 22, 0, 18, 149, 32984 }, // ņ
+    { 27, 33, 27, 0, 32, 223, 33133 }, // Ň
+    { 22, 28, 22, 0, 28, 154, 33356 }, // ň
+    { 30, 24, 30, 0, 24, 180, 33510 }, // ŉ
+    { 27, 30, 27, 0, 23, 203, 33690 }, // Ŋ
+    { 20, 26, 22, 0, 18, 130, 33893 }, // ŋ
+    { 24, 31, 26, 1, 30, 186, 34023 }, // Ō
+    { 18, 25, 20, 1, 24, 113, 34209 }, // ō
+    { 24, 33, 26, 1, 32, 198, 34322 }, // Ŏ
+    { 18, 27, 20, 1, 26, 122, 34520 }, // ŏ
+    { 24, 34, 26, 1, 33, 204, 34816 }, // Ő
+    { 18, 29, 20, 1, 28, 131, 35020 }, // ő
+    { 31, 24, 33, 1, 23, 186, 35151 }, // Œ
+    { 28, 19, 30, 1, 18, 133, 35337 }, // œ
+    { 23, 33, 23, 1, 32, 190, 35470 }, // Ŕ
+    { 16, 28, 16, 0, 28, 112, 35660 }, // ŕ
+    { 23, 33, 23, 1, 24, 190, 35772 }, // Ŗ
+    { 16, 27, 16, 0, 18, 108, 35962 }, // ŗ
+    { 23, 33, 23, 1, 32, 190, 36070 }, // Ř
+    { 16, 28, 16, 0, 28, 112, 36260 }, // ř
+    { 17, 33, 19, 1, 32, 141, 36372 }, // Ś
+    { 15, 29, 17, 1, 28, 109, 36513 }, // ś
+    { 17, 33, 19, 1, 32, 141, 36622 }, // Ŝ
+    { 15, 28, 17, 1, 27, 105, 36864 }, // ŝ
+    { 17, 33, 19, 1, 24, 141, 36969 }, // Ş
+    { 15, 27, 17, 1, 18, 102, 37110 }, // ş
+    { 17, 33, 19, 1, 32, 141, 37212 }, // Š
+    { 15, 29, 17, 1, 28, 109, 37353 }, // š
+    { 23, 32, 24, 0, 23, 184, 37462 }, // Ţ
+    { 15, 31, 14, -1, 22, 117, 37646 }, // ţ
+    { 23, 32, 24, 0, 32, 184, 37763 }, // Ť
+    { 15, 28, 14, -1, 27, 105, 37947 }, // ť
+    { 23, 23, 24, 0, 23, 133, 38052 }, // Ŧ
+    { 15, 23, 14, -1, 22, 87, 38185 }, // ŧ
+    { 26, 33, 27, 0, 32, 215, 38272 }, // Ũ
+    { 22, 27, 22, 0, 26, 149, 38487 }, // ũ
+    { 26, 31, 27, 0, 30, 202, 38636 }, // Ū
+    { 22, 25, 22, 0, 24, 138, 38912 }, // ū
+    { 26, 33, 27, 0, 32, 215, 39050 }, // Ŭ
+    { 22, 27, 22, 0, 26, 149, 39265 }, // ŭ
+    { 26, 34, 27, 0, 33, 221, 39414 }, // Ů
+    { 22, 29, 22, 0, 28, 160, 39635 }, // ů
+    { 26, 34, 27, 0, 33, 221, 39795 }, // Ű
+    { 22, 29, 22, 0, 28, 160, 40016 }, // ű
+    { 26, 31, 27, 0, 23, 202, 40176 }, // Ų
+    { 22, 26, 22, 0, 18, 143, 40378 }, // ų
+    { 37, 33, 37, 0, 32, 306, 40521 }, // Ŵ
+    { 30, 28, 30, 0, 27, 210, 40960 }, // ŵ
+    { 24, 32, 24, 0, 32, 192, 41170 }, // Ŷ
+    { 22, 35, 21, 0, 27, 193, 41362 }, // ŷ
+    { 24, 31, 24, 0, 31, 186, 41555 }, // Ÿ
+    { 20, 33, 20, 0, 32, 165, 41741 }, // Ź
+    { 17, 29, 17, 0, 28, 124, 41906 }, // ź
+    { 20, 33, 20, 0, 32, 165, 42030 }, // Ż
+    { 17, 27, 17, 0, 26, 115, 42195 }, // ż
+    { 20, 33, 20, 0, 32, 165, 42310 }, // Ž
+    { 17, 29, 17, 0, 28, 124, 42475 }, // ž
+    { 17, 26, 14, 0, 26, 111, 42599 }, // ſ
+    { 7, 9, 0, -5, 28, 16, 42710 }, // ̀
+    { 6, 9, 0, -2, 28, 14, 42726 }, // ́
+    { 12, 8, 0, -6, 27, 24, 42740 }, // ̂
+    { 12, 6, 0, -6, 26, 18, 42764 }, // ̃
+    { 12, 4, 0, -6, 24, 12, 42782 }, // ̄
+    { 12, 6, 0, -6, 26, 18, 42794 }, // ̆
+    { 6, 6, 0, -3, 26, 9, 42812 }, // ̇
+    { 12, 6, 0, -6, 26, 18, 42821 }, // ̈
+    { 10, 10, 0, -5, 29, 25, 42839 }, // ̉
+    { 10, 9, 0, -5, 28, 23, 42864 }, // ̊
+    { 11, 9, 0, -4, 28, 25, 42887 }, // ̋
+    { 12, 8, 0, -6, 28, 24, 42912 }, // ̌
+    { 11, 9, 0, -7, 28, 25, 42936 }, // ̏
+    { 12, 6, 0, -6, 26, 18, 42961 }, // ̑
+    { 6, 10, 0, -3, 29, 15, 42979 }, // ̒
+    { 7, 9, 0, -3, 29, 16, 43008 }, // ̓
+    { 7, 9, 0, -4, 29, 16, 43024 }, // ̔
+    { 5, 9, 0, -2, 29, 12, 43040 }, // ̕
+    { 6, 9, 0, -3, 22, 14, 43052 }, // ̛
+    { 6, 6, 0, -3, -2, 9, 43066 }, // ̣
+    { 12, 5, 0, -6, -3, 15, 43075 }, // ̤
+    { 8, 8, 0, -4, -1, 16, 43090 }, // ̥
+    { 7, 8, 0, -4, -1, 14, 43106 }, // ̦
+    { 8, 8, 0, -4, -1, 16, 43120 }, // ̧
+    { 8, 9, 0, -4, 1, 18, 43136 }, // ̨
+    { 5, 9, 9, 2, -1, 12, 43154 }, // ̩
+    { 12, 7, 0, -6, -2, 21, 43166 }, // ̭
+    { 12, 6, 0, -6, -2, 18, 43187 }, // ̮
+    { 12, 7, 0, -6, -2, 21, 43205 }, // ̰
+    { 12, 4, 0, -6, -3, 12, 43226 }, // ̱
+    { 12, 6, 0, -6, 26, 18, 43238 }, // ͂
+    { 12, 14, 0, -6, 34, 42, 43256 }, // ̈́
+    { 7, 7, 0, -3, -2, 13, 43298 }, // ͅ
+    { 20, 32, 21, 1, 32, 160, 43311 }, // Ѐ
+    { 20, 31, 21, 1, 31, 155, 43471 }, // Ё
+    { 27, 30, 28, 0, 23, 203, 43626 }, // Ђ
+    { 19, 32, 21, 1, 32, 152, 43829 }, // Ѓ
+    { 21, 25, 23, 1, 24, 132, 43981 }, // Є
+    { 17, 25, 19, 1, 24, 107, 44113 }, // Ѕ
+    { 12, 23, 14, 1, 23, 69, 44220 }, // І
+    { 14, 31, 14, 0, 31, 109, 44289 }, // Ї
+    { 15, 30, 13, -2, 23, 113, 44398 }, // Ј
+    { 32, 24, 33, 0, 23, 192, 44511 }, // Љ
+    { 33, 24, 35, 1, 23, 198, 44703 }, // Њ
+    { 30, 23, 30, 0, 23, 173, 45056 }, // Ћ
+    { 24, 33, 25, 1, 32, 198, 45229 }, // Ќ
+    { 26, 32, 28, 1, 32, 208, 45427 }, // Ѝ
+    { 24, 33, 24, 0, 32, 198, 45635 }, // Ў
+    { 25, 31, 27, 1, 23, 194, 45833 }, // Џ
+    { 26, 24, 25, 0, 24, 156, 46027 }, // А
+    { 20, 24, 22, 1, 23, 120, 46183 }, // Б
+    { 20, 25, 21, 1, 24, 125, 46303 }, // В
+    { 19, 23, 21, 1, 23, 110, 46428 }, // Г
+    { 26, 30, 26, 0, 23, 195, 46538 }, // Д
+    { 20, 23, 21, 1, 23, 115, 46733 }, // Е
+    { 37, 25, 37, 0, 24, 232, 46848 }, // Ж
+    { 19, 25, 21, 1, 24, 119, 47104 }, // З
+    { 26, 23, 28, 1, 23, 150, 47223 }, // И
+    { 26, 32, 28, 1, 32, 208, 47373 }, // Й
+    { 24, 25, 25, 1, 24, 150, 47581 }, // К
+    { 25, 24, 26, 0, 23, 150, 47731 }, // Л
+    { 31, 23, 31, 0, 23, 179, 47881 }, // М
+    { 27, 23, 28, 1, 23, 156, 48060 }, // Н
+    { 24, 25, 26, 1, 24, 150, 48216 }, // О
+    { 26, 23, 28, 1, 23, 150, 48366 }, // П
+    { 19, 24, 21, 1, 24, 114, 48516 }, // Р
+    { 20, 25, 22, 1, 24, 125, 48630 }, // С
+    { 23, 23, 24, 0, 23, 133, 48755 }, // Т
+    { 24, 24, 24, 0, 23, 144, 48888 }, // У
+    { 25, 25, 27, 1, 24, 157, 49152 }, // Ф
+    { 25, 23, 25, 0, 23, 144, 49309 }, // Х
+    { 26, 30, 28, 1, 23, 195, 49453 }, // Ц
+    { 25, 23, 26, 0, 23, 144, 49648 }, // Ч
+    { 35, 23, 37, 1, 23, 202, 49792 }, // Ш
+    { 36, 30, 37, 1, 23, 270, 49994 }, // Щ
+    { 25, 24, 26, 0, 23, 150, 50264 }, // Ъ
+    { 32, 24, 34, 1, 23, 192, 50414 }, // Ы
+    { 20, 24, 22, 1, 23, 120, 50606 }, // Ь
+    { 21, 25, 23, 1, 24, 132, 50726 }, // Э
+    { 35, 25, 37, 1, 24, 219, 50858 }, // Ю
+    { 23, 24, 24, 0, 23, 138, 51200 }, // Я
+    { 18, 19, 19, 1, 18, 86, 51338 }, // а
+    { 18, 28, 20, 1, 27, 126, 51424 }, // б
+    { 17, 19, 19, 1, 18, 81, 51550 }, // в
+    { 16, 18, 18, 1, 18, 72, 51631 }, // г
+    { 22, 24, 22, 0, 18, 132, 51703 }, // д
+    { 16, 19, 18, 1, 18, 76, 51835 }, // е
+    { 30, 19, 30, 0, 18, 143, 51911 }, // ж
+    { 16, 19, 17, 0, 18, 76, 52054 }, // з
+    { 21, 18, 23, 1, 18, 95, 52130 }, // и
+    { 21, 26, 23, 1, 26, 137, 52225 }, // й
+    { 20, 19, 21, 1, 18, 95, 52362 }, // к
+    { 21, 19, 21, 0, 18, 100, 52457 }, // л
+    { 24, 18, 26, 1, 18, 108, 52557 }, // м
+    { 21, 18, 23, 1, 18, 95, 52665 }, // н
+    { 18, 19, 20, 1, 18, 86, 52760 }, // о
+    { 21, 18, 23, 1, 18, 95, 52846 }, // п
+    { 20, 26, 21, 0, 18, 130, 52941 }, // р
+    { 15, 19, 17, 1, 18, 72, 53071 }, // с
+    { 20, 18, 20, 0, 18, 90, 53143 }, // т
+    { 22, 26, 21, 0, 18, 143, 53248 }, // у
+    { 24, 34, 26, 1, 26, 204, 53391 }, // ф
+    { 21, 18, 21, 0, 18, 95, 53595 }, // х
+    { 22, 24, 23, 1, 18, 132, 53690 }, // ц
+    { 20, 18, 21, 0, 18, 90, 53822 }, // ч
+    { 29, 18, 30, 1, 18, 131, 53912 }, // ш
+    { 30, 24, 31, 1, 18, 180, 54043 }, // щ
+    { 22, 19, 22, 0, 18, 105, 54223 }, // ъ
+    { 27, 19, 29, 1, 18, 129, 54328 }, // ы
+    { 17, 19, 18, 1, 18, 81, 54457 }, // ь
+    { 17, 19, 18, 0, 18, 81, 54538 }, // э
+    { 28, 19, 29, 1, 18, 133, 54619 }, // ю
+    { 19, 19, 20, 0, 18, 91, 54752 }, // я
+    { 16, 29, 18, 1, 28, 116, 54843 }, // ѐ
+    { 16, 27, 18, 1, 26, 108, 54959 }, // ё
+    { 20, 34, 21, 0, 26, 170, 55067 }, // ђ
+    { 16, 28, 18, 1, 28, 112, 55296 }, // ѓ
+    { 16, 19, 18, 1, 18, 76, 55408 }, // є
+    { 15, 19, 17, 1, 18, 72, 55484 }, // ѕ
+    { 12, 26, 12, 0, 26, 78, 55556 }, // і
+    { 12, 26, 12, 0, 26, 78, 55634 }, // ї
+    { 12, 34, 10, -3, 26, 102, 55712 }, // ј
+    { 26, 19, 27, 0, 18, 124, 55814 }, // љ
+    { 27, 19, 29, 1, 18, 129, 55938 }, // њ
+    { 22, 26, 22, 0, 26, 143, 56067 }, // ћ
+    { 20, 29, 21, 1, 28, 145, 56210 }, // ќ
+    { 21, 28, 23, 1, 28, 147, 56355 }, // ѝ
+    { 22, 34, 21, 0, 26, 187, 56502 }, // ў
+    { 21, 25, 23, 1, 18, 132, 56689 }, // џ
+    { 23, 27, 25, 1, 26, 156, 56821 }, // Ѣ
+    { 21, 25, 21, 0, 24, 132, 56977 }, // ѣ
+    { 24, 25, 26, 1, 24, 150, 57109 }, // Ѳ
+    { 18, 19, 20, 1, 18, 86, 57344 }, // ѳ
+    { 26, 25, 26, 0, 24, 163, 57430 }, // Ѵ
+    { 22, 19, 22, 0, 18, 105, 57593 }, // ѵ
+    { 27, 39, 28, 1, 32, 264, 57698 }, // Ҋ
+    { 22, 32, 23, 1, 26, 176, 57962 }, // ҋ
+    { 20, 24, 22, 1, 23, 120, 58138 }, // Ҍ
+    { 18, 25, 18, 0, 24, 113, 58258 }, // ҍ
+    { 19, 24, 21, 1, 24, 114, 58371 }, // Ҏ
+    { 20, 26, 21, 0, 18, 130, 58485 }, // ҏ
+    { 18, 28, 19, 1, 28, 126, 58615 }, // Ґ
+    { 15, 22, 17, 1, 22, 83, 58741 }, // ґ
+    { 19, 23, 20, 1, 23, 110, 58824 }, // Ғ
+    { 17, 18, 18, 0, 18, 77, 58934 }, // ғ
+    { 22, 30, 24, 1, 23, 165, 59011 }, // Ҕ
+    { 19, 26, 20, 1, 18, 124, 59176 }, // ҕ
+    { 37, 31, 37, 0, 24, 287, 59392 }, // Җ
+    { 30, 24, 30, 0, 18, 180, 59679 }, // җ
+    { 19, 32, 21, 1, 24, 152, 59859 }, // Ҙ
+    { 16, 25, 17, 0, 18, 100, 60011 }, // ҙ
+    { 24, 31, 25, 1, 24, 186, 60111 }, // Қ
+    { 20, 24, 21, 1, 18, 120, 60297 }, // қ
+    { 26, 25, 27, 1, 24, 163, 60417 }, // Ҝ
+    { 21, 19, 22, 1, 18, 100, 60580 }, // ҝ
+    { 24, 25, 25, 1, 24, 150, 60680 }, // Ҟ
+    { 21, 25, 21, 0, 24, 132, 60830 }, // ҟ
+    { 29, 25, 29, 0, 24, 182, 60962 }, // Ҡ
+    { 25, 19, 25, 0, 18, 119, 61144 }, // ҡ
+    { 28, 30, 29, 1, 23, 210, 61440 }, // Ң
+    { 22, 24, 24, 1, 18, 132, 61650 }, // ң
+    { 31, 23, 33, 1, 23, 179, 61782 }, // Ҥ
+    { 26, 18, 27, 1, 18, 117, 61961 }, // ҥ
+    { 35, 30, 37, 1, 23, 263, 62078 }, // Ҧ
+    { 29, 26, 31, 1, 18, 189, 62341 }, // ҧ
+    { 27, 25, 28, 1, 24, 169, 62530 }, // Ҩ
+    { 22, 19, 23, 1, 18, 105, 62699 }, // ҩ
+    { 20, 32, 22, 1, 24, 160, 62804 }, // Ҫ
+    { 15, 25, 17, 1, 18, 94, 62964 }, // ҫ
+    { 23, 30, 24, 0, 23, 173, 63058 }, // Ҭ
+    { 20, 24, 20, 0, 18, 120, 63231 }, // ҭ
+    { 24, 23, 24, 0, 23, 138, 63488 }, // Ү
+    { 22, 26, 22, 0, 18, 143, 63626 }, // ү
+    { 24, 23, 24, 0, 23, 138, 63769 }, // Ұ
+    { 22, 26, 22, 0, 18, 143, 63907 }, // ұ
+    { 26, 30, 26, 0, 23, 195, 64050 }, // Ҳ
+    { 21, 24, 21, 0, 18, 126, 64245 }, // ҳ
+    { 30, 30, 31, 0, 23, 225, 64371 }, // Ҵ
+    { 26, 24, 27, 0, 18, 156, 64596 }, // ҵ
+    { 26, 30, 26, 0, 23, 195, 64752 }, // Ҷ
+    { 21, 24, 22, 0, 18, 126, 64947 }, // ҷ
+    { 25, 23, 26, 0, 23, 144, 65073 }, // Ҹ
+    { 21, 18, 22, 0, 18, 95, 65217 }, // ҹ
+    { 25, 23, 26, 1, 23, 144, 65312 }, // Һ
+    { 22, 26, 22, 0, 26, 143, 65536 }, // һ
+    { 27, 25, 28, 0, 24, 169, 65679 }, // Ҽ
+    { 21, 19, 22, 0, 18, 100, 65848 }, // ҽ
+    { 27, 31, 28, 0, 24, 210, 65948 }, // Ҿ
+    { 21, 25, 22, 0, 18, 132, 66158 }, // ҿ
+    { 12, 23, 14, 1, 23, 69, 66290 }, // Ӏ
+    { 37, 33, 37, 0, 32, 306, 66359 }, // Ӂ
+    { 30, 27, 30, 0, 26, 203, 66665 }, // ӂ
+    { 23, 31, 24, 1, 24, 179, 66868 }, // Ӄ
+    { 19, 26, 21, 1, 18, 124, 67047 }, // ӄ
+    { 25, 30, 26, 0, 23, 188, 67171 }, // Ӆ
+    { 21, 24, 21, 0, 18, 126, 67359 }, // ӆ
+    { 27, 30, 28, 1, 23, 203, 67584 }, // Ӈ
+    { 21, 26, 23, 1, 18, 137, 67787 }, // ӈ
+    { 27, 30, 28, 1, 23, 203, 67924 }, // Ӊ
+    { 22, 24, 23, 1, 18, 132, 68127 }, // ӊ
+    { 25, 30, 26, 0, 23, 188, 68259 }, // Ӌ
+    { 20, 24, 21, 0, 18, 120, 68447 }, // ӌ
+    { 32, 30, 32, 0, 23, 240, 68567 }, // Ӎ
+    { 25, 24, 26, 1, 18, 150, 68807 }, // ӎ
+    { 12, 26, 14, 1, 26, 78, 68957 }, // ӏ
+    { 26, 32, 25, 0, 32, 208, 69035 }, // Ӑ
+    { 18, 27, 19, 1, 26, 122, 69243 }, // ӑ
+    { 26, 31, 25, 0, 31, 202, 69365 }, // Ӓ
+    { 18, 27, 19, 1, 26, 122, 69632 }, // ӓ
+    { 33, 23, 32, -1, 23, 190, 69754 }, // Ӕ
+    { 26, 19, 27, 1, 18, 124, 69944 }, // ӕ
+    { 20, 32, 21, 1, 32, 160, 70068 }, // Ӗ
+    { 16, 27, 18, 1, 26, 108, 70228 }, // ӗ
+    { 21, 25, 23, 1, 24, 132, 70336 }, // Ә
+    { 16, 19, 18, 1, 18, 76, 70468 }, // ә
+    { 21, 32, 23, 1, 31, 168, 70544 }, // Ӛ
+    { 16, 27, 18, 1, 26, 108, 70712 }, // ӛ
+    { 37, 32, 37, 0, 31, 296, 70820 }, // Ӝ
+    { 30, 27, 30, 0, 26, 203, 71116 }, // ӝ
+    { 19, 32, 21, 1, 31, 152, 71319 }, // Ӟ
+    { 16, 27, 17, 0, 26, 108, 71471 }, // ӟ
+    { 18, 24, 19, 0, 23, 108, 71680 }, // Ӡ
+    { 17, 26, 18, 0, 18, 111, 71788 }, // ӡ
+    { 26, 30, 28, 1, 30, 195, 71899 }, // Ӣ
+    { 21, 24, 23, 1, 24, 126, 72094 }, // ӣ
+    { 26, 31, 28, 1, 31, 202, 72220 }, // Ӥ
+    { 21, 26, 23, 1, 26, 137, 72422 }, // ӥ
+    { 24, 32, 26, 1, 31, 192, 72559 }, // Ӧ
+    { 18, 27, 20, 1, 26, 122, 72751 }, // ӧ
+    { 24, 25, 26, 1, 24, 150, 72873 }, // Ө
+    { 18, 19, 20, 1, 18, 86, 73023 }, // ө
+    { 24, 32, 26, 1, 31, 192, 73109 }, // Ӫ
+    { 18, 27, 20, 1, 26, 122, 73301 }, // ӫ
+    { 21, 32, 23, 1, 31, 168, 73423 }, // Ӭ
+    { 17, 27, 18, 0, 26, 115, 73591 }, // ӭ
+    { 24, 31, 24, 0, 30, 186, 73728 }, // Ӯ
+    { 22, 32, 21, 0, 24, 176, 73914 }, // ӯ
+    { 24, 32, 24, 0, 31, 192, 74090 }, // Ӱ
+    { 22, 34, 21, 0, 26, 187, 74282 }, // ӱ
+    { 24, 34, 24, 0, 33, 204, 74469 }, // Ӳ
+    { 22, 36, 21, 0, 28, 198, 74673 }, // ӳ
+    { 25, 31, 26, 0, 31, 194, 74871 }, // Ӵ
+    { 20, 26, 21, 0, 26, 130, 75065 }, // ӵ
+    { 19, 30, 21, 1, 23, 143, 75195 }, // Ӷ
+    { 16, 24, 18, 1, 18, 96, 75338 }, // ӷ
+    { 32, 32, 34, 1, 31, 256, 75434 }, // Ӹ
+    { 27, 27, 29, 1, 26, 183, 75776 }, // ӹ
+    { 19, 30, 20, 1, 23, 143, 75959 }, // Ӻ
+    { 17, 25, 18, 0, 18, 107, 76102 }, // ӻ
+    { 25, 30, 25, 0, 23, 188, 76209 }, // Ӽ
+    { 20, 26, 20, 0, 18, 130, 76397 }, // ӽ
+    { 25, 23, 25, 0, 23, 144, 76527 }, // Ӿ
+    { 21, 18, 21, 0, 18, 95, 76671 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 76766 }, //  
+    { 0, 0, 33, 0, 0, 0, 76766 }, //  
+    { 0, 0, 17, 0, 0, 0, 76766 }, //  
+    { 0, 0, 33, 0, 0, 0, 76766 }, //  
+    { 0, 0, 11, 0, 0, 0, 76766 }, //  
+    { 0, 0, 8, 0, 0, 0, 76766 }, //  
+    { 0, 0, 5, 0, 0, 0, 76766 }, //  
+    { 0, 0, 21, 0, 0, 0, 76766 }, //  
+    { 0, 0, 10, 0, 0, 0, 76766 }, //  
+    { 0, 0, 7, 0, 0, 0, 76766 }, //  
+    { 0, 0, 2, 0, 0, 0, 76766 }, //  
+    { 0, 0, 0, 0, 0, 0, 76766 }, // ​
+    { 2, 28, 0, -1, 20, 14, 76766 }, // ‌
+    { 8, 30, 0, -4, 22, 60, 76780 }, // ‍
+    { 12, 31, 0, -6, 23, 93, 76840 }, // ‎
+    { 12, 31, 0, -6, 23, 93, 76933 }, // ‏
+    { 11, 5, 13, 1, 11, 14, 77026 }, // ‐
+    { 11, 5, 13, 1, 11, 14, 77040 }, // ‑
+    { 17, 4, 21, 2, 13, 17, 77054 }, // ‒
+    { 17, 5, 17, 0, 11, 22, 77071 }, // –
+    { 33, 5, 33, 0, 11, 42, 77093 }, // —
+    { 33, 5, 33, 0, 11, 42, 77135 }, // ―
+    { 12, 34, 17, 2, 26, 102, 77177 }, // ‖
+    { 17, 9, 17, 0, -1, 39, 77279 }, // ‗
+    { 7, 11, 8, 1, 25, 20, 77318 }, // ‘
+    { 7, 11, 8, 0, 25, 20, 77338 }, // ’
+    { 7, 11, 8, 0, 5, 20, 77358 }, // ‚
+    { 7, 11, 8, 1, 25, 20, 77378 }, // ‛
+    { 13, 11, 15, 1, 25, 36, 77398 }, // “
+    { 14, 11, 15, 0, 25, 39, 77434 }, // ”
+    { 14, 11, 15, 0, 5, 39, 77473 }, // „
+    { 13, 11, 15, 1, 25, 36, 77512 }, // ‟
+    { 15, 22, 16, 1, 24, 83, 77548 }, // †
+    { 15, 26, 16, 1, 24, 98, 77631 }, // ‡
+    { 8, 8, 10, 1, 13, 16, 77729 }, // •
+    { 12, 12, 21, 4, 17, 36, 77745 }, // ‣
+    { 7, 6, 10, 1, 5, 11, 77781 }, // ․
+    { 15, 6, 17, 1, 5, 23, 77792 }, // ‥
+    { 29, 6, 33, 2, 5, 44, 77824 }, // …
+    { 7, 6, 10, 1, 12, 11, 77868 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 77879 }, //  
+    { 0, 0, 0, 0, 0, 0, 77879 }, //  
+    { 12, 31, 0, -6, 23, 93, 77879 }, // ‪
+    { 12, 31, 0, -6, 23, 93, 77972 }, // ‫
+    { 10, 31, 0, -5, 23, 78, 78065 }, // ‬
+    { 14, 31, 0, -7, 23, 109, 78143 }, // ‭
+    { 14, 31, 0, -7, 23, 109, 78252 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 78361 }, //  
+    { 44, 27, 46, 1, 25, 297, 78361 }, // ‰
+    { 9, 11, 9, 0, 23, 25, 78658 }, // ′
+    { 16, 11, 16, 0, 23, 44, 78683 }, // ″
+    { 23, 11, 23, 0, 23, 64, 78727 }, // ‴
+    { 9, 11, 9, 0, 23, 25, 78791 }, // ‵
+    { 15, 11, 17, 1, 23, 42, 78816 }, // ‶
+    { 22, 11, 24, 1, 23, 61, 78858 }, // ‷
+    { 14, 7, 16, 1, 0, 25, 78919 }, // ‸
+    { 9, 13, 11, 1, 15, 30, 78944 }, // ‹
+    { 9, 13, 11, 1, 15, 30, 78974 }, // ›
+    { 21, 23, 21, 0, 22, 121, 79004 }, // ※
+    { 16, 26, 19, 2, 25, 104, 79125 }, // ‼
+    { 17, 4, 17, 0, 28, 17, 79229 }, // ‾
+    { 8, 5, 10, 1, 11, 10, 79246 }, // ⁃
+    { 18, 28, 6, -6, 25, 126, 79256 }, // ⁄
+    { 28, 26, 31, 2, 25, 182, 79382 }, // ⁇
+    { 23, 26, 25, 2, 25, 150, 79564 }, // ⁈
+    { 22, 26, 25, 2, 25, 143, 79714 }, // ⁉
+    { 20, 7, 33, 6, 13, 35, 79872 }, // ⁓
+    { 30, 11, 31, 0, 23, 83, 79907 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 79990 }, //  
+    { 0, 0, 0, 0, 0, 0, 79990 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 79990 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 79990 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 79990 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 79990 }, // ⁤
+    { 15, 17, 15, 0, 28, 64, 79990 }, // ⁰
+    { 14, 17, 15, 0, 28, 60, 80054 }, // ⁴
+    { 11, 16, 15, 2, 27, 44, 80114 }, // ⁵
+    { 13, 17, 15, 1, 28, 56, 80158 }, // ⁶
+    { 12, 16, 15, 2, 27, 48, 80214 }, // ⁷
+    { 13, 17, 15, 1, 28, 56, 80262 }, // ⁸
+    { 13, 17, 15, 1, 28, 56, 80318 }, // ⁹
+    { 15, 11, 19, 2, 23, 42, 80374 }, // ⁿ
+    { 15, 16, 15, 0, 11, 60, 80416 }, // ₀
+    { 11, 16, 15, 2, 11, 44, 80476 }, // ₁
+    { 13, 16, 15, 1, 11, 52, 80520 }, // ₂
+    { 12, 16, 15, 1, 11, 48, 80572 }, // ₃
+    { 14, 16, 15, 0, 11, 56, 80620 }, // ₄
+    { 11, 16, 15, 2, 11, 44, 80676 }, // ₅
+    { 13, 16, 15, 1, 11, 52, 80720 }, // ₆
+    { 12, 16, 15, 2, 11, 48, 80772 }, // ₇
+    { 13, 16, 15, 1, 11, 52, 80820 }, // ₈
+    { 13, 16, 15, 1, 11, 52, 80872 }, // ₉
+    { 19, 23, 21, 1, 23, 110, 80924 }, // ₣
+    { 20, 24, 21, 0, 23, 120, 81034 }, // ₤
+    { 44, 24, 45, 0, 23, 264, 81154 }, // ₧
+    { 21, 24, 21, 0, 23, 126, 81418 }, // €
+    { 21, 15, 33, 6, 19, 79, 81544 }, // ←
+    { 15, 21, 33, 9, 22, 79, 81623 }, // ↑
+    { 21, 15, 33, 6, 19, 79, 81702 }, // →
+    { 15, 21, 33, 9, 22, 79, 81781 }, // ↓
+    { 21, 15, 33, 6, 19, 79, 81920 }, // ↔
+    { 15, 23, 33, 9, 23, 87, 81999 }, // ↕
+    { 15, 23, 33, 9, 23, 87, 82086 }, // ↨
+    { 15, 23, 33, 9, 23, 87, 82173 }, // ↲
+    { 15, 23, 33, 9, 23, 87, 82260 }, // ↳
+    { 19, 18, 33, 7, 20, 86, 82347 }, // ↵
+    { 21, 19, 33, 6, 21, 100, 82433 }, // ⇐
+    { 19, 21, 33, 7, 22, 100, 82533 }, // ⇑
+    { 21, 19, 33, 6, 21, 100, 82633 }, // ⇒
+    { 19, 21, 33, 7, 22, 100, 82733 }, // ⇓
+    { 21, 17, 33, 6, 20, 90, 82833 }, // ⇔
+    { 23, 24, 33, 5, 23, 138, 82923 }, // ∀
+    { 18, 27, 21, 1, 26, 122, 83061 }, // ∂
+    { 17, 23, 33, 8, 23, 98, 83183 }, // ∃
+    { 25, 27, 33, 4, 25, 169, 83281 }, // ∅
+    { 22, 24, 23, 0, 24, 132, 83450 }, // ∆
+    { 21, 24, 33, 6, 23, 126, 83582 }, // ∇
+    { 23, 23, 33, 5, 23, 133, 83708 }, // ∈
+    { 23, 29, 33, 5, 26, 167, 83968 }, // ∉
+    { 23, 20, 33, 5, 21, 115, 84135 }, // ∊
+    { 23, 23, 33, 5, 23, 133, 84250 }, // ∋
+    { 23, 29, 33, 5, 26, 167, 84383 }, // ∌
+    { 23, 20, 33, 5, 21, 115, 84550 }, // ∍
+    { 26, 29, 28, 1, 23, 189, 84665 }, // ∏
+    { 21, 29, 22, 1, 23, 153, 84854 }, // ∑
+    { 15, 4, 21, 3, 13, 15, 85007 }, // −
+    { 16, 26, 17, 1, 24, 104, 85022 }, // ∕
+    { 16, 26, 17, 1, 24, 104, 85126 }, // ∖
+    { 16, 16, 21, 2, 19, 64, 85230 }, // ∗
+    { 13, 12, 21, 4, 17, 39, 85294 }, // ∘
+    { 7, 6, 21, 7, 12, 11, 85333 }, // ∙
+    { 22, 31, 21, -1, 27, 171, 85344 }, // √
+    { 17, 13, 21, 2, 17, 56, 85515 }, // ∝
+    { 21, 13, 21, 0, 17, 69, 85571 }, // ∞
+    { 21, 23, 33, 6, 23, 121, 85640 }, // ∟
+    { 25, 23, 33, 4, 23, 144, 85761 }, // ∠
+    { 5, 34, 17, 6, 26, 43, 85905 }, // ∣
+    { 12, 34, 17, 2, 26, 102, 86016 }, // ∥
+    { 23, 23, 33, 5, 23, 133, 86118 }, // ∧
+    { 23, 23, 33, 5, 23, 133, 86251 }, // ∨
+    { 19, 24, 33, 7, 24, 114, 86384 }, // ∩
+    { 19, 24, 33, 7, 23, 114, 86498 }, // ∪
+    { 19, 34, 21, 1, 26, 162, 86612 }, // ∫
+    { 23, 20, 33, 5, 19, 115, 86774 }, // ∴
+    { 23, 20, 33, 5, 19, 115, 86889 }, // ∵
+    { 7, 19, 10, 2, 21, 34, 87004 }, // ∶
+    { 23, 20, 33, 5, 19, 115, 87038 }, // ∷
+    { 20, 7, 33, 6, 13, 35, 87153 }, // ∼
+    { 20, 18, 33, 6, 20, 90, 87188 }, // ≅
+    { 17, 14, 21, 2, 18, 60, 87278 }, // ≈
+    { 19, 13, 33, 7, 16, 62, 87338 }, // ≍
+    { 15, 16, 21, 3, 19, 60, 87400 }, // ≠
+    { 19, 16, 33, 7, 18, 76, 87460 }, // ≡
+    { 15, 20, 21, 3, 20, 75, 87536 }, // ≤
+    { 15, 21, 21, 3, 21, 79, 87611 }, // ≥
+    { 27, 16, 33, 3, 19, 108, 87690 }, // ≪
+    { 27, 16, 33, 3, 19, 108, 87798 }, // ≫
+    { 23, 20, 33, 5, 21, 115, 87906 }, // ⊃
+    { 23, 29, 33, 5, 26, 167, 88064 }, // ⊄
+    { 23, 29, 33, 5, 26, 167, 88231 }, // ⊅
+    { 21, 23, 33, 6, 23, 121, 88398 }, // ⊆
+    { 21, 23, 33, 6, 23, 121, 88519 }, // ⊇
+    { 25, 25, 33, 4, 24, 157, 88640 }, // ⊕
+    { 25, 25, 33, 4, 24, 157, 88797 }, // ⊖
+    { 25, 25, 33, 4, 24, 157, 88954 }, // ⊗
+    { 25, 25, 33, 4, 24, 157, 89111 }, // ⊘
+    { 19, 23, 33, 7, 23, 110, 89268 }, // ⊥
+    { 7, 6, 21, 7, 12, 11, 89378 }, // ⋅
+    { 29, 6, 33, 2, 12, 44, 89389 }, // ⋯
+    { 31, 32, 33, 1, 28, 248, 89433 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_boldIntervals[] = {
@@ -6233,4 +3433,9 @@ static const EpdFontData bookerly_16_bold = {
     36,
     -9,
     true,
+    bookerly_16_boldBlockOffsets,
+    bookerly_16_boldDirectGlyphs,
+    bookerly_16_boldGlyphPages,
+    256,
+    bookerly_16_boldPageGlyphs,
 };
@@ -2,5621 +2,2908 @@
  * generated by fontconvert.py
  * name: bookerly_16_bolditalic
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_16_bolditalic 16 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_16_bolditalic 16 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_bolditalicBitmaps[89727] = {
-    0x00, 0x06, 0xA0, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x07, 0xFD,
-    0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
-    0x00, 0x07, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0xBF, 0x40, 0x03, 0xFE, 0x00, 0x1F,
-    0xF4, 0x00, 0x3F, 0x80, 0x00, 0x54, 0x00, 0x00, 0x01, 0xA4, 0x1A, 0x41, 0xFD, 0x2F, 0xC0, 0xFF,
-    0x0F, 0xF0, 0x7F, 0xC7, 0xF8, 0x1F, 0xD2, 0xFD, 0x0B, 0xF0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFE,
-    0x0F, 0xE0, 0x3F, 0x43, 0xF4, 0x0F, 0xC0, 0xFC, 0x03, 0x90, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x01, 0xAB, 0xFE, 0xAF, 0xFA, 0x90, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x0F,
-    0xE0, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x15, 0xFF,
-    0x56, 0xFE, 0x54, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0x5B, 0xF5,
-    0x5F, 0xE5, 0x40, 0x02, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x01, 0x50, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0x47, 0xDF, 0xF0, 0x0F, 0xE0, 0xB8, 0xBF, 0x00, 0xFE, 0x0F, 0x47, 0xE0,
-    0x1F, 0xF1, 0xF0, 0x3C, 0x00, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0x01, 0xF0, 0x1F, 0x2F, 0xF0, 0x7F, 0x03, 0xE0, 0xFF, 0x0B, 0xF4, 0x3D, 0x0F,
-    0xF0, 0xBF, 0xC7, 0xC1, 0xFE, 0x07, 0xFE, 0xBC, 0x7F, 0xC0, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x43, 0xFC,
-    0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF8, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x07, 0xF8, 0x0B, 0xF0, 0x2F, 0x80, 0x01,
-    0x00, 0x3F, 0x80, 0xFE, 0x07, 0xF0, 0x1F, 0xFE, 0x03, 0xFE, 0xBF, 0xC0, 0xFC, 0x0B, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xF0, 0x3F, 0x42, 0xFE, 0x7F, 0xD0, 0x7F, 0xF4, 0x0B, 0xE0, 0x7F, 0x81, 0xFE, 0x00,
-    0x00, 0x01, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0xFE, 0x00, 0x00,
-    0x0F, 0xE0, 0x1F, 0xD0, 0x1F, 0xE0, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x7F,
-    0x40, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00,
-    0x2F, 0xD0, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x34, 0x00, 0x2F, 0xD7, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0xFF,
-    0x40, 0x1B, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x1B, 0xFF, 0xFC, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xFE,
-    0x40, 0x0B, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0x5F, 0xF0, 0x39, 0xBE, 0x00, 0x07, 0xF8,
-    0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x80,
-    0xFE, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x8B, 0xF0, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xD0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0xBF, 0xFF, 0x91, 0xFF,
-    0xFF, 0xE0, 0x00, 0x05, 0x40, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00,
-    0x01, 0xA4, 0x1F, 0xD0, 0xFF, 0x07, 0xFC, 0x1F, 0xD0, 0xBF, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0x40,
-    0xFC, 0x03, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xB0, 0xFF, 0x00, 0xBE,
-    0x3F, 0x00, 0x3F, 0xEF, 0x40, 0x01, 0xFF, 0xEF, 0xC0, 0x0B, 0xFF, 0xF0, 0x6F, 0xFD, 0xBC, 0x3F,
-    0xDF, 0x41, 0x07, 0xE3, 0xF0, 0x00, 0x60, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x0A, 0xAB, 0xFF, 0xAA, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0xBF,
-    0x55, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x0B, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x03, 0xF8,
-    0x00, 0x04, 0x00, 0x00, 0x15, 0x55, 0x41, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x15,
-    0x55, 0x50, 0x06, 0x80, 0xBF, 0xC3, 0xFF, 0x0F, 0xFC, 0x3F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xF0, 0x0F, 0xFE, 0x01,
-    0xFF, 0x80, 0x07, 0xFF, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x03, 0xFF, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00,
-    0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F,
-    0xF8, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0,
-    0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xFD, 0x6F, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xFE,
-    0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2B, 0xF9, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFA, 0xBF, 0xF8, 0x00, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x24, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, 0xAF, 0xFC, 0x00, 0xFF,
-    0x80, 0x1F, 0xF4, 0x03, 0xF8, 0x00, 0x3F, 0xD0, 0x07, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x39, 0x5F, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x1F, 0xF0, 0xBF, 0x40, 0x00,
-    0x7F, 0xC0, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xF0,
-    0x02, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x05, 0x55, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x01, 0x5B, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF,
-    0xF9, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xE0,
-    0x07, 0xFF, 0x40, 0x7F, 0xD0, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x01,
-    0xFF, 0x40, 0xBF, 0xC0, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x7F, 0xE0, 0x07, 0xFE,
-    0x00, 0x3F, 0xF8, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x40, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xE5, 0x55,
-    0xFF, 0xC0, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xF4, 0x00, 0xBF, 0xD0, 0x0F, 0xC0, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFD, 0x5F, 0xFC, 0x00,
-    0xFF, 0x80, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0xBF, 0xC0,
-    0x0F, 0xF8, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xF8, 0x7F, 0xF8, 0x01, 0xFF,
-    0x40, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0x7F, 0xD0, 0xBF, 0xC0, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x03,
-    0xFD, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x2F, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFA, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFA, 0xBF, 0xF4, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xF0,
-    0x00, 0xBF, 0xC0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xE5, 0x6F, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x0F, 0xFC, 0x07, 0xFF, 0x01, 0xFF, 0x40, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x02, 0xFF, 0x00, 0xFF, 0xC0,
-    0x3F, 0xF0, 0x0F, 0xF0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x40,
-    0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFD, 0x00, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x95, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA,
-    0x90, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x1B, 0xFF, 0x40, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFD,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40,
-    0x0F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x2F, 0xFF, 0xFC, 0x2F, 0x57, 0xFC, 0x04, 0x02, 0xFC, 0x00,
-    0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x95, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFC, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x7F,
-    0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xE9, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x2F, 0xFF, 0xA5, 0x5B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F,
-    0xE0, 0x01, 0xB8, 0x1A, 0x02, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xFE, 0xFC, 0x03, 0xF4, 0x0F, 0xF0,
-    0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xE0, 0x7F, 0x40, 0x3F, 0xD0, 0xFF, 0x00, 0x3F, 0x83, 0xFC, 0x01,
-    0xFD, 0x01, 0xFC, 0x00, 0xFD, 0x0F, 0xE0, 0x0F, 0xF0, 0x0B, 0xE0, 0x07, 0xF4, 0x7F, 0x40, 0x7F,
-    0x40, 0x3F, 0x40, 0x2F, 0xC2, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x07, 0xF4, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xFF, 0x03,
-    0xFD, 0x03, 0xFD, 0x03, 0xFC, 0x03, 0xFF, 0xBE, 0xF8, 0x7F, 0xD0, 0x0F, 0xF0, 0x0B, 0xFF, 0xE3,
-    0xFF, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x1B, 0x90, 0x0B,
-    0xA4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55,
-    0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4,
-    0xBF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x05,
-    0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xFE, 0xFF, 0xF4, 0x00, 0x55, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x02,
-    0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x00,
-    0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x53, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xEB, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0x80,
-    0x02, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x0B, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x41,
-    0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x03,
-    0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x08, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x6F, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x65, 0xFF, 0x81, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x01,
-    0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFC, 0x00,
-    0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x40,
-    0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xE5,
-    0x6F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x16, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2E, 0x00,
-    0x00, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF4, 0x01, 0xBF,
-    0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x05, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xC0, 0x00,
-    0x2F, 0xF4, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x6A, 0xA0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xEA, 0xA8, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xC0, 0x1F, 0xFD,
-    0x00, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0xFC,
-    0x00, 0x00, 0x14, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFF, 0xDF, 0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0B,
-    0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xF8, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0,
-    0x1F, 0xFF, 0xE5, 0x5F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x28, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD7,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xF8, 0x7F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0xFD, 0x00, 0x00, 0x3F,
-    0xE0, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xF4, 0x00,
-    0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x19, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x00, 0x7F, 0xE0, 0x00, 0xFE, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFB, 0xF8, 0x03, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFA, 0xFE, 0x01, 0xFC, 0xFF, 0x00,
-    0x00, 0x00, 0xFC, 0x7F, 0xC0, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x1F, 0xF0, 0xBF, 0x1F, 0xF0,
-    0x00, 0x00, 0x3F, 0x83, 0xFC, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0x6F, 0x82, 0xFF,
-    0x00, 0x00, 0x07, 0xF0, 0x3F, 0xEF, 0xC0, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0xE0, 0x2F,
-    0xF0, 0x00, 0x00, 0xFD, 0x01, 0xFF, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xF8, 0x03,
-    0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x00,
-    0x3F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40,
-    0x03, 0xFD, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xEF, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF5,
-    0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x3F, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x07, 0xFF,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xF8, 0xFF,
-    0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80,
-    0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD,
-    0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00,
-    0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F,
-    0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x65, 0xFF, 0x82, 0xFF, 0xE0, 0x00, 0x07, 0xFD,
-    0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x00,
-    0x02, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F,
-    0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xD1, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xAE, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xEF,
-    0xFF, 0xC0, 0x00, 0x55, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x02,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
-    0x00, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x1B,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F,
-    0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xF4, 0x02, 0xFF, 0x00, 0x0F, 0xC0, 0x0F, 0xFC, 0x00,
-    0x3F, 0x00, 0x3F, 0xF0, 0x01, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xC0, 0x01, 0xFF,
-    0xC0, 0x7F, 0x00, 0x03, 0xFF, 0x02, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0xE0, 0x3F,
-    0xF4, 0x0B, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9, 0x5F, 0xFD, 0x57, 0xF8, 0xBF, 0x00, 0xFF,
-    0xC0, 0x3F, 0x4B, 0xE0, 0x1F, 0xF8, 0x03, 0xF0, 0xBD, 0x02, 0xFF, 0x40, 0x7E, 0x02, 0x80, 0x3F,
-    0xF0, 0x06, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0,
-    0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
-    0x00, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xA4, 0x00, 0xFF, 0xFF,
-    0xAF, 0xFF, 0xFE, 0x00, 0xBE, 0x00, 0x7F, 0xFF, 0xD2, 0xFF, 0xFD, 0x00, 0x3F, 0xC0, 0x0B, 0xFF,
-    0xE0, 0x1F, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xC0, 0x0F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xFC, 0x02,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x3F, 0x7F, 0xC0,
-    0xBF, 0x40, 0x00, 0x0B, 0xFC, 0x1F, 0xCB, 0xF0, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x0F, 0xD2, 0xFD,
-    0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xC7, 0xF0, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x1F, 0xF3, 0xF4, 0x1F,
-    0xDB, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0xFC, 0x07, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xD0, 0x02, 0xFF, 0xFD, 0x00,
-    0x7F, 0xF9, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFB,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x8B, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x90, 0x07, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xE2, 0xFF, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0xBF,
-    0x80, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFC, 0x02,
-    0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xCF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE,
-    0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xF9, 0x40, 0x2F, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0x00, 0x0F, 0xFE, 0x00, 0x0F,
-    0x40, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x01, 0x90, 0x01, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x00, 0xFF, 0xF0,
-    0x00, 0x3F, 0xC0, 0xBF, 0xF0, 0x00, 0x6F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xFA, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x2A, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x03, 0xF4, 0xFF,
-    0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x3F, 0xC0,
-    0x1F, 0xD0, 0x1F, 0xE0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x1F, 0xE2, 0xFE,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x04, 0x00, 0xF0, 0x0F, 0xE0, 0x3F, 0xD0,
-    0xBF, 0xC0, 0x7F, 0xC0, 0x7F, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07,
-    0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80,
-    0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF,
-    0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00,
-    0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F,
-    0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE,
-    0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x68,
-    0x00, 0x0F, 0xF0, 0x7F, 0xF4, 0x00, 0xFF, 0x2F, 0xFF, 0xC0, 0x0F, 0xEB, 0xFF, 0xFC, 0x01, 0xFE,
-    0xF8, 0xBF, 0xD0, 0x2F, 0xFE, 0x03, 0xFD, 0x03, 0xFF, 0xC0, 0x3F, 0xD0, 0x3F, 0xF0, 0x03, 0xFD,
-    0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0xFF, 0x40,
-    0x1F, 0xF0, 0x0F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xF4, 0x1F, 0xF8, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xF7, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
-    0xFE, 0x01, 0xFF, 0x42, 0xF0, 0x0F, 0xF4, 0x00, 0x40, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x80, 0xFF, 0xC0, 0x1F, 0x43, 0xFF, 0xEB, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x69, 0x1F, 0xF0, 0x00, 0x07, 0xFF, 0xEF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xFB, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0x80,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F,
-    0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFC, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1,
-    0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0xE6, 0xFF,
-    0x01, 0xFD, 0x03, 0xFC, 0x0F, 0xE0, 0x1F, 0xE0, 0xBF, 0x00, 0xFF, 0x03, 0xF8, 0x0B, 0xF4, 0x1F,
-    0xD1, 0xFF, 0x40, 0xBF, 0xBF, 0xF4, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x3F, 0xD0,
-    0x00, 0x90, 0xFF, 0x40, 0x1F, 0xC3, 0xFF, 0x57, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xA0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE6,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1B,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x82, 0xFE, 0xA4, 0x00, 0x0F, 0xF8, 0x07,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xF8,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE6, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x2F,
-    0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40,
-    0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x90, 0x5F, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x29, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0xFC, 0x00,
-    0x3F, 0xDF, 0xFF, 0xF4, 0x01, 0xFE, 0xFD, 0x3F, 0xD0, 0x0B, 0xFF, 0xC0, 0xFF, 0x00, 0x3F, 0xFC,
-    0x07, 0xFC, 0x00, 0xFF, 0xD0, 0x2F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x03, 0xFC,
-    0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x03, 0xFD, 0x00, 0x7F,
-    0xC0, 0x0F, 0xF0, 0x92, 0xFF, 0x00, 0x7F, 0xEF, 0xCF, 0xF8, 0x02, 0xFF, 0xFE, 0x3F, 0xD0, 0x07,
-    0xFF, 0xE1, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x3F, 0xF0, 0x0B, 0xFF, 0x00, 0xBF, 0xD0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x02, 0xFF, 0xF0, 0xBF, 0xFF, 0x0A, 0xBF, 0xE0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x07,
-    0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0,
-    0x07, 0xFC, 0x24, 0x7F, 0xEF, 0x8B, 0xFF, 0xF4, 0xBF, 0xFE, 0x03, 0xFE, 0x40, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x04, 0x01, 0xFF, 0x00, 0x00, 0xF8, 0x1F, 0xF8, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x64, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x0F, 0xF2, 0xFF,
-    0xF8, 0x03, 0xF7, 0xFA, 0xFF, 0x01, 0xFE, 0xE0, 0x3F, 0x80, 0xBF, 0xE0, 0x0F, 0xE0, 0x3F, 0xF0,
-    0x0B, 0xF0, 0x0F, 0xF4, 0x07, 0xF4, 0x07, 0xFC, 0x0B, 0xF4, 0x02, 0xFF, 0xBF, 0xF0, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x1F, 0xF3, 0xFD, 0x00, 0x07, 0xFC, 0x7F, 0xD0, 0x02,
-    0xFE, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0xFF, 0xFE, 0x3F, 0xD0, 0x0F, 0xFF, 0x5F, 0xF0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x00, 0xBF, 0xFC, 0x2F, 0xFF, 0xC2, 0xFF, 0xFC, 0x00,
-    0xBF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFD,
-    0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x30, 0xBF, 0xEF, 0x4F, 0xFF,
-    0xF0, 0xFF, 0xFD, 0x07, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x01, 0x64, 0x00, 0x64, 0x00, 0x19, 0x00,
-    0xBF, 0xF4, 0x1F, 0xFC, 0x0B, 0xFF, 0x0F, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0xFD, 0x2A, 0xFF, 0x6F,
-    0xFF, 0xDF, 0xFF, 0xF8, 0x02, 0xFE, 0xF8, 0xFF, 0xBD, 0x3F, 0xE0, 0x0F, 0xFF, 0x43, 0xFF, 0xD0,
-    0xFF, 0x40, 0x3F, 0xF8, 0x0F, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xF0, 0x1F, 0xF0, 0x0B,
-    0xFD, 0x02, 0xFF, 0x40, 0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x3F,
-    0xD0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x0B, 0xFC, 0x03, 0xFD,
-    0x00, 0xBF, 0x80, 0x3F, 0xE0, 0x0F, 0xF4, 0xA3, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xEF, 0xCF, 0xF4,
-    0x07, 0xFC, 0x01, 0xFF, 0xFE, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFF, 0xF2, 0xFE, 0x00, 0xBF, 0x40,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x00, 0x69, 0x00, 0xBF,
-    0xF8, 0x1F, 0xFD, 0x0F, 0xFF, 0xE2, 0xFF, 0xFC, 0x2A, 0xFF, 0xAF, 0xFF, 0xF0, 0x02, 0xFE, 0xF8,
-    0xBF, 0xC0, 0x0F, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xD0,
-    0x0B, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x07, 0xFD,
-    0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0xC3, 0xFE, 0x00, 0xBF,
-    0xEF, 0x4F, 0xF4, 0x03, 0xFF, 0xFC, 0x7F, 0xC0, 0x0B, 0xFF, 0xD2, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xEF, 0xFD, 0x02, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xF0, 0xFF,
-    0x80, 0x0B, 0xFC, 0x3F, 0xD0, 0x02, 0xFF, 0x2F, 0xF0, 0x00, 0xBF, 0xCF, 0xFC, 0x00, 0x3F, 0xE3,
-    0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xE0, 0x03, 0xFE, 0x0F, 0xFC, 0x02, 0xFF,
-    0x02, 0xFF, 0x42, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x64, 0x01, 0xA4, 0x00, 0x1F, 0xFF, 0x43, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xD3, 0xFF, 0xF4, 0x02, 0xAF, 0xF7, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF4, 0xFF,
-    0xC0, 0x00, 0xFF, 0xF0, 0x2F, 0xF0, 0x00, 0x7F, 0xF4, 0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x03, 0xFF,
-    0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x07, 0xFD, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00,
-    0x03, 0xFE, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x14, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x01, 0x50, 0x00, 0x1F, 0xFF, 0x3F, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE,
-    0xFF, 0xF4, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xF4,
-    0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x03, 0xFE,
-    0x00, 0x7F, 0xE0, 0x0F, 0xF8, 0x03, 0xFF, 0x40, 0x3F, 0xE0, 0x2F, 0xFC, 0x00, 0xFF, 0x82, 0xFB,
-    0xF0, 0x03, 0xFF, 0x6F, 0x7F, 0x80, 0x0F, 0xFF, 0xF8, 0xFE, 0x00, 0x1F, 0xFF, 0x87, 0xF4, 0x00,
-    0x2F, 0xF4, 0x2F, 0xD0, 0x00, 0x05, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x64, 0x01, 0xA0, 0x2F,
-    0xFE, 0x0B, 0xFC, 0xFF, 0xFE, 0x2F, 0xFC, 0xAB, 0xFE, 0x7F, 0xFC, 0x01, 0xFD, 0xFF, 0xF8, 0x02,
-    0xFE, 0xF4, 0x10, 0x03, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x80, 0x2F,
-    0xEA, 0xFE, 0x01, 0xFF, 0x00, 0xB0, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8,
-    0x0F, 0x00, 0x3F, 0xE0, 0xBF, 0x00, 0xBF, 0x83, 0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1B, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x01, 0x40, 0x3F, 0xF0, 0x2F, 0x00, 0xFF,
-    0xEB, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F,
-    0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0,
-    0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07,
-    0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0,
-    0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04,
-    0x00, 0x01, 0x60, 0x00, 0x68, 0x0B, 0xFF, 0x00, 0xFF, 0xD7, 0xFF, 0xE0, 0x1F, 0xF9, 0xFF, 0xFC,
-    0x03, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x2F, 0xE0, 0x0F, 0xF4, 0x0F, 0xF0, 0x02,
-    0xFE, 0x03, 0xFC, 0x00, 0xBF, 0x81, 0xFD, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x03, 0xFC, 0x7F, 0x40,
-    0x00, 0xFF, 0x3F, 0x80, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0xA4, 0x00, 0x68, 0x0B, 0xFF, 0x00, 0xFF, 0x40, 0xFF, 0xC7, 0xFF,
-    0xD0, 0x2F, 0xF0, 0x1F, 0xF5, 0xBF, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xFF, 0x40,
-    0xBF, 0x40, 0x3F, 0xD0, 0x3F, 0xE0, 0x2F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF8, 0x0F, 0xF0, 0x02, 0xFE,
-    0x07, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0x82, 0xFF, 0xC1, 0xFC, 0x00, 0x0F, 0xE0, 0xFF, 0xF0, 0xBF,
-    0x00, 0x03, 0xFC, 0x7F, 0xFC, 0x3F, 0x40, 0x00, 0xFF, 0x3F, 0xBF, 0x2F, 0xC0, 0x00, 0x3F, 0xEF,
-    0x5F, 0xDF, 0xC0, 0x00, 0x0F, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC1, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xD0, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x64, 0x00, 0x3F,
-    0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0xFF, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0xD0, 0xFF, 0xF8, 0x00, 0x0F,
-    0xF8, 0xBF, 0x18, 0x00, 0x01, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF3,
-    0xFE, 0x00, 0x03, 0xEF, 0xF0, 0xBF, 0xC6, 0x81, 0xFF, 0xF4, 0x1F, 0xFF, 0xF0, 0x7F, 0xF8, 0x03,
-    0xFF, 0xF4, 0x0F, 0xF8, 0x00, 0x7F, 0xE4, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x58,
-    0x00, 0x1A, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x01, 0xBF,
-    0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00,
-    0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00,
-    0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x03, 0xD0, 0x6F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1A,
-    0x00, 0x3F, 0xFD, 0x0F, 0xF0, 0x3F, 0xFF, 0xFB, 0xFC, 0x0F, 0xFF, 0xFF, 0xFD, 0x07, 0xF9, 0xBF,
-    0xFD, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x3D, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x38, 0x01, 0xFF, 0x00, 0x2F, 0x40, 0xFF, 0xFE, 0xAF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xEF, 0xFF, 0xFC, 0x0B, 0xD0, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFF, 0xA8, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x7F, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00,
-    0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00,
-    0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80,
-    0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xAB, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0B,
-    0x41, 0xFF, 0xFC, 0x03, 0xF0, 0xFF, 0xFF, 0xE7, 0xFC, 0xBF, 0x9F, 0xFF, 0xFE, 0x1F, 0x80, 0x7F,
-    0xFF, 0x01, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x2F, 0xD0,
-    0x01, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xFD,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x06, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFB, 0xEB,
-    0xF4, 0x3F, 0xF1, 0xF0, 0x28, 0x2F, 0xF0, 0xBC, 0x00, 0x0F, 0xF4, 0x3E, 0x00, 0x07, 0xFC, 0x0F,
-    0x40, 0x02, 0xFE, 0x03, 0xC0, 0x00, 0xFF, 0x41, 0xF0, 0x00, 0x3F, 0xD0, 0xBC, 0x00, 0x0F, 0xF8,
-    0x3E, 0x00, 0x03, 0xFF, 0x0F, 0x40, 0xB0, 0xBF, 0xD7, 0xC0, 0xBD, 0x0F, 0xFF, 0xF6, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0x97, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x01, 0xFC,
-    0x00, 0x00, 0xFF, 0x40, 0x2F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x57, 0xFD, 0x55, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x15, 0xFF, 0x95, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xEF, 0xF9, 0x56, 0xAF, 0xD0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xE0, 0x1B, 0xFF, 0xF0, 0x02, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x08, 0x01, 0xF8, 0x06, 0xA4, 0x1F, 0x80, 0x7F, 0xAF,
-    0xFF, 0xEF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xE5, 0xFF, 0xC0, 0x00, 0x2F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00,
-    0x3F, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0x1F, 0xE0, 0x00, 0x1F, 0xFE, 0xBF,
-    0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xD7, 0xFF, 0xE7, 0xFC, 0x03, 0xC0, 0x05, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x15, 0x55, 0x51, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x07, 0xFE,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xF4, 0x07, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFC, 0x00, 0x00, 0x11, 0xFF, 0x1F, 0xE1, 0x00,
-    0x01, 0xFF, 0xFE, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x14, 0x2F, 0xF4, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00,
-    0x07, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80,
-    0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0,
-    0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x16, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x07, 0xFC,
-    0x00, 0xFF, 0x00, 0x7F, 0x00, 0xBF, 0xC0, 0x0F, 0x40, 0x3F, 0xF4, 0x00, 0x00, 0x2E, 0x7F, 0x00,
-    0x00, 0x0F, 0x8F, 0xF4, 0x00, 0x03, 0xE0, 0xFF, 0x80, 0x00, 0xFC, 0x0F, 0xF8, 0x00, 0x2F, 0x40,
-    0xBF, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0x7F, 0x00, 0x0F, 0xF8, 0x0B, 0xD0, 0x00,
-    0xFF, 0xC0, 0xF8, 0x00, 0x0B, 0xFC, 0x3E, 0x00, 0x00, 0xBF, 0x8F, 0x80, 0x00, 0x07, 0xF3, 0xD0,
-    0x04, 0x00, 0xBF, 0xF0, 0x1F, 0x40, 0x0F, 0xF8, 0x0F, 0xE0, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFD,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0xBD, 0x3F, 0xD2, 0xFE, 0x3F, 0xC3, 0xFE, 0x3F, 0x42, 0xF8, 0x04, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA,
-    0xBF, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xBF, 0xF8, 0x03, 0xC0, 0x3D, 0x00, 0xFF, 0xFF,
-    0x00, 0xB8, 0x1F, 0x00, 0xFE, 0x0B, 0xC0, 0x0F, 0x0B, 0x40, 0xBE, 0x01, 0xF0, 0x02, 0xD3, 0xC0,
-    0x3F, 0x00, 0x10, 0x00, 0x78, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x1E, 0x3C, 0x07, 0xF0, 0x00, 0x00,
-    0x07, 0xCF, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xE3, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x78, 0xB4, 0x0F,
-    0xF0, 0x00, 0x00, 0x2D, 0x1E, 0x02, 0xFF, 0x96, 0xD0, 0x0F, 0x03, 0xC0, 0x3F, 0xFF, 0xF0, 0x07,
-    0xC0, 0xB8, 0x02, 0xFF, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x01, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x95, 0x6F, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x07, 0xFE, 0xFC, 0x01, 0xFF, 0xFF, 0x40, 0x3F, 0x47, 0xF0, 0x0F, 0xD0, 0x3E, 0x00, 0xFC,
-    0x0B, 0xD0, 0x1F, 0x40, 0xFC, 0x02, 0xF4, 0x2F, 0x80, 0x2F, 0x47, 0xF8, 0x82, 0xFF, 0xFF, 0xBC,
-    0x1F, 0xFD, 0xFF, 0x80, 0xBE, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x2F, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x40, 0x00, 0x00, 0x02, 0x40, 0x02, 0x80, 0x00, 0x7F,
-    0x40, 0x7F, 0x80, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x1F, 0xF8, 0x0F, 0xFC,
-    0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x2F, 0xF4, 0x1F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0x80,
-    0x3F, 0xC0, 0x00, 0x28, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xA4, 0x15, 0x55, 0x41, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFD, 0x15, 0x55, 0x50, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x0F, 0x90, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0x1A, 0xA9, 0x03, 0xC0, 0x78,
-    0x7F, 0xBE, 0x07, 0x42, 0xC0, 0x7C, 0x7C, 0x0F, 0x0F, 0x01, 0xF1, 0xF0, 0x2C, 0x3C, 0x07, 0xDF,
-    0x40, 0xB0, 0xE0, 0x1F, 0xF4, 0x02, 0xC3, 0xC0, 0x7D, 0xF0, 0x0B, 0x0B, 0x01, 0xF3, 0xF0, 0x3C,
-    0x1D, 0x1F, 0xE3, 0xF1, 0xE0, 0x3C, 0x15, 0x41, 0x4F, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x7D,
-    0x00, 0x1F, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x1A, 0xAA, 0xA8,
-    0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x54, 0x00, 0x6F, 0x90, 0x00, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xF0, 0xBF, 0x97, 0xFD, 0x3F, 0x80, 0x3F, 0x8F, 0xC0, 0x0F, 0xE3, 0xF4, 0x03, 0xF8,
-    0xFE, 0x00, 0xFD, 0x2F, 0xE6, 0xFF, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0x40, 0x01, 0xA9, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x0A, 0xAB, 0xFE, 0xAA, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xF9, 0x55, 0xBF, 0x55, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x2F, 0xEB, 0xFC, 0x03, 0xF0, 0x1F,
-    0xD0, 0x3C, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0x01, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0xFD,
-    0x03, 0xF9, 0xFF, 0x07, 0xC0, 0x7F, 0x01, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x6F, 0xF0, 0x01,
-    0xFF, 0xF0, 0x01, 0xEB, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x15, 0xBF,
-    0xF0, 0xBF, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x3F, 0x02,
-    0xFD, 0x1F, 0xF0, 0xFF, 0x0B, 0xF4, 0x3F, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x16, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00,
-    0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x00, 0x0B, 0xF8,
-    0x01, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-    0x40, 0xBF, 0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFE, 0x01, 0x02, 0xFF, 0xEB, 0xFB, 0xFA, 0xF0, 0x2F,
-    0xFF, 0xFD, 0x7F, 0xFE, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xC0, 0x3F, 0x7F, 0xD0, 0x1F, 0xE0, 0x07,
-    0xF0, 0x50, 0x00, 0x10, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0x1F,
-    0x40, 0x00, 0x3F, 0xFF, 0xF2, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFF, 0xFF, 0xE3,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFD, 0x3E, 0x00, 0x01, 0xFF, 0xFF, 0xC7, 0xD0, 0x00, 0x1F, 0xFF, 0xFC,
-    0xBC, 0x00, 0x01, 0xFF, 0xFF, 0x8B, 0xC0, 0x00, 0x0F, 0xFF, 0xF4, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0x4F, 0x80, 0x00, 0x07, 0xFF, 0xF1, 0xF4, 0x00, 0x00, 0x0B, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x03,
-    0xE2, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x00, 0x00,
-    0xBC, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xFD, 0x00, 0x00, 0x60,
-    0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xEB, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xFE, 0x7F, 0xEB, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x50,
-    0x03, 0xFD, 0x06, 0xFE, 0x00, 0x7E, 0x00, 0xFC, 0x03, 0xF4, 0x2F, 0xD0, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x2F, 0xFF, 0x01, 0xFF, 0xF8, 0x01, 0x6F, 0xD0, 0x00, 0x7F, 0x00, 0x02,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0xFE, 0x00, 0x1B, 0xFE, 0x42, 0xFF, 0xFE, 0x0A, 0xAA, 0xA4, 0x00, 0x00, 0x50, 0x00, 0x07, 0xFF,
-    0x80, 0x0B, 0xFF, 0xF4, 0x0B, 0xF0, 0x7F, 0x03, 0xF0, 0x1F, 0xC2, 0xF8, 0x07, 0xF0, 0xFD, 0x02,
-    0xF8, 0x3F, 0x00, 0xFD, 0x0F, 0xC0, 0xBF, 0x03, 0xF8, 0xBF, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xE0, 0x15, 0x55,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x60, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x1F, 0xF0, 0x0F, 0xF0,
-    0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x7F, 0xF0, 0x00,
-    0xFF, 0x40, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x0F, 0xF8, 0x0B,
-    0xFC, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xF4, 0x07, 0xF8, 0x00, 0x0A, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0x40, 0x07, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x80, 0x0F,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x0F, 0xFF, 0x02,
-    0xFF, 0xFF, 0x00, 0x2F, 0x80, 0x03, 0xF3, 0xF0, 0x3F, 0xFF, 0xE0, 0x0B, 0xF0, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xD0,
-    0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF9, 0x5F, 0xE4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x0B, 0xE8, 0x00, 0x07, 0xF0, 0x00, 0x07,
-    0xF0, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xE0, 0x00,
-    0x2F, 0x80, 0x7F, 0x42, 0xFC, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x07, 0xC0, 0x2F, 0xC2, 0xFF, 0xFF,
-    0x00, 0xFC, 0x00, 0x04, 0x03, 0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xFA,
-    0xAA, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02,
-    0x40, 0x7E, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x0B, 0xE0,
-    0x00, 0x3F, 0xF4, 0x00, 0x6F, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0xFC, 0x00, 0x3F,
-    0x00, 0x03, 0xF3, 0xF0, 0xBF, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x3F, 0x01, 0x54, 0x00, 0x02,
-    0xFC, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0xBD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x03, 0xF9, 0x5F, 0xE4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0xE0,
-    0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xD0, 0x05, 0x7F, 0x40, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0x02, 0xFD,
-    0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0,
-    0x04, 0xBF, 0x96, 0xF1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x03, 0xFF, 0xF4, 0x02, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B,
-    0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01,
-    0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55,
-    0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4,
-    0xBF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x1C, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55,
-    0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4,
-    0xBF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00,
-    0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00,
-    0x01, 0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5,
-    0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF,
-    0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x05, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xFE, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFD,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x55, 0x7F, 0xD0, 0x00, 0x7C, 0x00, 0x01,
-    0xFF, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x01, 0xFC, 0x00,
-    0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x41, 0xFF, 0x00, 0x7F, 0xF4, 0x00,
-    0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x03, 0xF0, 0x1F, 0xF8, 0x00, 0x00,
-    0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x08,
-    0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x6F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0x6F,
-    0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xC0, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x07, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x1B, 0xF4, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0x6F, 0xC0, 0x00,
-    0x1F, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xC0, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x1B, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xEF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0x40, 0x00,
-    0x00, 0xA8, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0x80, 0x5B, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xF0,
-    0x00, 0x7E, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0xB8, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xD0,
-    0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x16, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00,
-    0x0B, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00,
-    0x2F, 0xF4, 0x01, 0xBF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0B,
-    0xF9, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x0F, 0xFB, 0xF4, 0x00, 0x07, 0xFC, 0x2F, 0xC0, 0x01, 0xFF, 0x00, 0xFC, 0x00, 0x0A, 0x40, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00,
-    0xFF, 0x4B, 0xFC, 0x00, 0x0F, 0xE0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x65, 0xFF, 0x81, 0xBF, 0xFD, 0x00, 0x00, 0x1F,
-    0xF4, 0x01, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x2F,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x2A, 0xFF, 0xEA, 0x90, 0x0F, 0xFC, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0xFF, 0xC0, 0xAB, 0xFF, 0xEA, 0x80, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x02,
-    0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0xBF, 0xE5, 0x6F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF1, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0x40,
-    0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x7F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x0F, 0xFD, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC2, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0xFF, 0x00, 0x00,
-    0x07, 0xF8, 0x0B, 0xFE, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0xDF, 0xE0, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F,
-    0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
-    0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00,
-    0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8,
-    0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00,
-    0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF,
-    0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0,
-    0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00,
-    0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
-    0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00,
-    0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD,
-    0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0x40, 0x00, 0x00, 0x2A, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD,
-    0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD,
-    0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00,
-    0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x2F, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0D, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00,
-    0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF,
-    0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD,
-    0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8,
-    0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40,
-    0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00,
-    0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF,
-    0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD,
-    0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8,
-    0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0C, 0x02, 0xF8, 0x00, 0xFD, 0x1F,
-    0xF4, 0x0F, 0xFC, 0x1F, 0xF4, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xEF, 0xF4, 0x0B, 0xFC, 0x2F,
-    0xF4, 0x7F, 0xC0, 0x2F, 0xF0, 0x7C, 0x00, 0x2F, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x0F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x95, 0xBF, 0xFD, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
-    0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x1F, 0xCF, 0xFD,
-    0x00, 0x7F, 0xF0, 0x01, 0xFC, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x1F, 0xC0, 0xFF, 0xD0, 0x0F, 0xFD,
-    0x02, 0xFC, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x2F, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xC2, 0xF8, 0x00,
-    0x7F, 0xE0, 0x03, 0xFF, 0x6F, 0x80, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFC, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF9, 0x6F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xF7, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0x41, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x20,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F,
-    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F,
-    0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F,
-    0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03,
-    0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x68, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x02, 0xFF,
-    0x40, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03,
-    0xFF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F,
-    0xF4, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x07,
-    0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xD0,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xD0, 0x00, 0x02, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x07,
-    0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE5, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF1, 0xBF,
-    0xF8, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00,
-    0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80,
-    0x2F, 0xF4, 0x00, 0x2F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x5B, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF5, 0x40, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x5F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x0F, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0xBF, 0x42, 0xFD, 0x00,
-    0x00, 0x3F, 0xD3, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFC,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF5,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01,
-    0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0,
-    0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F,
-    0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0,
-    0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE,
-    0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF,
-    0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0,
-    0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F,
-    0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1,
-    0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00,
-    0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF,
-    0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00,
-    0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F,
-    0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x80, 0x00, 0x01, 0xFF, 0xC2, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xE3, 0xFF, 0xC0, 0x00, 0x03, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00,
-    0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF,
-    0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00,
-    0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE,
-    0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C,
-    0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B,
-    0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x0B, 0xD0, 0x00, 0x03, 0xFD, 0x2F, 0xE0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x03, 0xF4,
-    0x2F, 0x80, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B,
-    0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0,
-    0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F,
-    0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF,
-    0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00,
-    0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-    0xFE, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0,
-    0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F,
-    0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1,
-    0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x69, 0x40, 0x01, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0x82, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xBF, 0xFF, 0x9B, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xE0,
-    0x3F, 0xC0, 0x3F, 0xE0, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0xFF,
-    0x80, 0x0F, 0xF0, 0x2F, 0xE0, 0x1F, 0xF0, 0x02, 0xFE, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xEB,
-    0xFD, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-    0xE0, 0x3F, 0xFD, 0x00, 0x0A, 0x03, 0xFE, 0x0B, 0xFF, 0xE0, 0x03, 0xF0, 0x3F, 0xF6, 0xFA, 0xFF,
-    0x96, 0xFF, 0x02, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x00,
-    0x7F, 0xE0, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0x42, 0xF0,
-    0x0F, 0xF4, 0x00, 0x40, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x80, 0xFF, 0xC0,
-    0x1F, 0x43, 0xFF, 0xEB, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x01, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xFE, 0x6F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0xFE, 0x01, 0xFE, 0x0B,
-    0xF0, 0x0F, 0xF0, 0x3F, 0x80, 0xBF, 0x41, 0xFD, 0x1F, 0xF4, 0x0B, 0xFB, 0xFF, 0x40, 0x3F, 0xFF,
-    0xE0, 0x00, 0xFF, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x09, 0x0F, 0xF4, 0x01, 0xFC, 0x3F, 0xF5, 0x7F,
-    0xE0, 0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x0B, 0xF9, 0xBF, 0xC0,
-    0x07, 0xF4, 0x0F, 0xF0, 0x03, 0xF8, 0x07, 0xF8, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0xFE, 0x02, 0xFD,
-    0x00, 0x7F, 0x47, 0xFD, 0x00, 0x2F, 0xEF, 0xFD, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0x40, 0x02, 0x40, 0x3F, 0xD0, 0x07, 0xF0, 0x0F, 0xFD, 0x5F, 0xF8, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x02, 0xFE, 0xFC, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x3F, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0x9B, 0xFC, 0x01, 0xFD, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF8,
-    0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x2F, 0xD0, 0x1F, 0xD1, 0xFF, 0x40, 0x2F, 0xEF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0x3F, 0xD0, 0x07, 0xF0,
-    0x3F, 0xF5, 0x7F, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0xC0, 0x01, 0xFF, 0x0F,
-    0xF4, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x02, 0xFE, 0x6F, 0xF0, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0xFE, 0x01, 0xFE, 0x00,
-    0xBF, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0xBF, 0x40, 0x1F, 0xD1, 0xFF, 0x40, 0x0B, 0xFB, 0xFF, 0x40,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0x0F, 0xF4, 0x01,
-    0xFC, 0x03, 0xFF, 0x57, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0xB4, 0x00, 0x7F, 0x00, 0x1F, 0xF0,
-    0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x02, 0xFC, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0xBF, 0xFC, 0xBF, 0xFF, 0x2A, 0xFF, 0x80, 0x2F, 0xD0, 0x0F, 0xF0, 0x07, 0xFC, 0x02, 0xFE, 0x00,
-    0xFF, 0x40, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF8, 0x03, 0xFD, 0x01, 0xFF, 0x09, 0x7F, 0xEF, 0xAF,
-    0xFF, 0xDB, 0xFF, 0xE0, 0xFF, 0x90, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x40,
-    0x00, 0x3F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x2F, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0A, 0xBF, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xC2, 0x40, 0x1F, 0xFB, 0xE0, 0x0B, 0xFF, 0xF4,
-    0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xE4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xF8, 0x01, 0xFE, 0xFC, 0x03, 0xF4, 0xBE, 0x0F, 0xD0, 0x3F,
-    0x2F, 0x40, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x2F, 0xFF, 0x00, 0xBF,
-    0xFF, 0x00, 0xAB, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0x7F, 0xC2, 0x40, 0x7F, 0xEF, 0x80, 0xBF, 0xFF, 0x40, 0xBF, 0xFE, 0x00, 0x3F, 0xE4, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0xFF, 0x4B, 0xF8, 0x7F, 0xC3, 0xFD, 0x0F,
-    0xD0, 0xFE, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0B,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xAF, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x90, 0x07, 0xFE, 0xF8, 0x02, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFE, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0xF0, 0x00, 0x02, 0xFF, 0xBF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xFD, 0x00, 0x00, 0x1D, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF8, 0x1F, 0xFC, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0xBF, 0xC0,
-    0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x83,
-    0xFE, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x0B,
-    0xFC, 0x02, 0xFF, 0x97, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x02, 0x00, 0x00, 0x1F, 0xFC,
-    0x3E, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xE3, 0xFF, 0xC0, 0x00, 0x0F, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x69, 0x00, 0xBF, 0xF8, 0x1F, 0xFD, 0x0F, 0xFF, 0xE2, 0xFF, 0xFC, 0x2A, 0xFF, 0xAF, 0xFF,
-    0xF0, 0x02, 0xFE, 0xF8, 0xBF, 0xC0, 0x0F, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xFC, 0x0B, 0xF8, 0x01,
-    0xFF, 0xC0, 0x3F, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0xFF, 0x80,
-    0x2F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x1F, 0xF0,
-    0xC3, 0xFE, 0x00, 0xBF, 0xEF, 0x4F, 0xF4, 0x03, 0xFF, 0xFC, 0x7F, 0xC0, 0x0B, 0xFF, 0xD2, 0xFE,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFE, 0xFF, 0xD0, 0x2F, 0xF0, 0x1F, 0xF8, 0x1F, 0xF0, 0x03, 0xFF, 0x0F, 0xF8, 0x00,
-    0xBF, 0xC3, 0xFD, 0x00, 0x2F, 0xF2, 0xFF, 0x00, 0x0B, 0xFC, 0xFF, 0xC0, 0x03, 0xFE, 0x3F, 0xE0,
-    0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x2F, 0xF0, 0x2F,
-    0xF4, 0x2F, 0xF4, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFB, 0xFF, 0x40, 0x2F, 0xF0, 0x1F, 0xF8, 0x07, 0xFC, 0x00,
-    0xFF, 0xC0, 0xFF, 0x80, 0x0B, 0xFC, 0x0F, 0xF4, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x0B, 0xFC, 0x3F,
-    0xF0, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x3F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x42, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xBF, 0x40, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x80,
-    0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F, 0xF0, 0x3F,
-    0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x80, 0x00, 0x0F, 0xFC, 0x2F, 0x00, 0x03, 0xFF, 0xFB, 0xF0, 0x00, 0x3E, 0x2F,
-    0xFD, 0x00, 0x03, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8,
-    0x3F, 0xE0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00,
-    0xBF, 0xC0, 0x2F, 0xF4, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0xBD, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x03, 0xF8, 0x2F, 0xC0,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x02,
-    0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x0B,
-    0xFC, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0xFF, 0x43, 0xFE,
-    0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x2F, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x01, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0xBC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0xEB, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x07, 0xEB, 0xFC,
-    0x00, 0x3F, 0xE2, 0xF4, 0xBF, 0x80, 0x03, 0xFD, 0xBD, 0x0F, 0xF4, 0x00, 0x3F, 0xFF, 0x01, 0xFF,
-    0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x02, 0xFF,
-    0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xD1, 0xFF, 0xF8,
-    0x00, 0x00, 0x24, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F,
-    0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF,
-    0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00,
-    0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF,
-    0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D,
-    0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B,
-    0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A,
-    0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF,
-    0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01,
-    0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF,
-    0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x07, 0xF4,
-    0x0F, 0x80, 0x00, 0x0F, 0xD0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0,
-    0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F,
-    0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00,
-    0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40,
-    0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F,
-    0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F,
-    0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6,
-    0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00,
-    0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x01, 0xA0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xD0, 0x01,
-    0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x1B, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00,
-    0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xC0,
-    0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF7, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3D, 0x06, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x68, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x2F, 0xFF, 0xC0,
-    0x00, 0x1F, 0xDB, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0xF8, 0xBF, 0xD0, 0x00, 0x3F, 0xFE, 0x07, 0xFD,
-    0x00, 0x03, 0xFF, 0x80, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x1F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF4, 0x2F,
-    0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x1A, 0x00,
-    0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x01, 0xBF, 0xFC, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x3F,
-    0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF3,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xD0, 0x6F,
-    0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xAA, 0xAA,
-    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0x55, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00,
-    0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF,
-    0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00,
-    0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE,
-    0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C,
-    0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B,
-    0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x03, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xFA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0xAA, 0xAB,
-    0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x02,
-    0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0xD0, 0x00, 0x03, 0xF8, 0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B,
-    0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0,
-    0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F,
-    0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF,
-    0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00,
-    0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF,
-    0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00,
-    0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE,
-    0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C,
-    0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B,
-    0xFE, 0x00, 0xBF, 0x80, 0x00, 0x50, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x50, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x90, 0x7F,
-    0xC0, 0x1F, 0xFD, 0x00, 0x0B, 0xF0, 0x0F, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xFD, 0x00, 0x00, 0xFC,
-    0x07, 0xFE, 0x00, 0x00, 0x14, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x02, 0x02, 0xFF, 0xF0, 0x00, 0x07, 0xC0, 0x3F, 0xFF, 0x40, 0x1B, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x07, 0xFD, 0x0B, 0xC0, 0x03, 0xFD,
-    0x00, 0x10, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0x00,
-    0x3F, 0xF0, 0x07, 0xD0, 0x0F, 0xFF, 0xAF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xF0, 0x00,
-    0x00, 0x2F, 0xD1, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x1F, 0x80, 0x00, 0x06, 0x80, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x41, 0xFF, 0x00, 0x7F,
-    0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x03, 0xF0, 0x1F, 0xF8,
-    0x00, 0x00, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x08, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x6F, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x07, 0xF0, 0xFD,
-    0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8,
-    0x01, 0xFF, 0x42, 0xF0, 0x03, 0xFD, 0x00, 0x10, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x80, 0x3F, 0xF0, 0x07, 0xD0, 0x3F, 0xFE, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x41, 0xFF,
-    0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x03, 0xF0,
-    0x1F, 0xF8, 0x00, 0x00, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x08, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x6F, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x0F, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0x42, 0xF0, 0x0F, 0xF4, 0x00, 0x40, 0xBF,
-    0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x80, 0xFF, 0xC0, 0x1F, 0x43, 0xFF, 0xEB, 0xFD,
-    0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x1E, 0x00, 0x00, 0x2F, 0x80, 0x2F, 0xD0, 0x00, 0x07, 0xF4, 0x3F, 0xC0,
-    0x00, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFE, 0x41, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F,
-    0xF4, 0x00, 0x03, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x08, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD,
-    0x00, 0x6F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x06, 0x00, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0xBF, 0x2F, 0xC0,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x42,
-    0xF0, 0x00, 0x3F, 0xD0, 0x01, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x80, 0x03, 0xFF, 0x00, 0x7D, 0x00, 0x3F, 0xFE, 0xBF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x02, 0xFC, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x65, 0xFF, 0x81, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFC,
-    0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF0,
-    0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8,
-    0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xE5, 0x6F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xC2, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0xD0, 0x00, 0x00, 0x69, 0x1F, 0xF0, 0x10,
-    0x00, 0x01, 0xFF, 0xFB, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xEF,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0x00,
-    0xBF, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF,
-    0x80, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xBF, 0x0B,
-    0x00, 0x03, 0xFF, 0x6F, 0x9F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x87, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-    0x81, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x65, 0xFF, 0x81, 0xBF,
-    0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00,
-    0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x2A, 0xFF, 0xEA, 0x90, 0x0F, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xC0, 0xAB, 0xFF, 0xEA, 0x80, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00,
-    0x02, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFE, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xE5, 0x6F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0xAA, 0xFF, 0xE8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xAA, 0xFF, 0xA4,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF6, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x0B, 0xF8,
-    0x00, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x01, 0xFF,
-    0x00, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0xFF,
-    0xD0, 0x00, 0x3F, 0xE0, 0x2F, 0xFC, 0x00, 0x03, 0xFE, 0x0B, 0xEF, 0xC2, 0xC0, 0x3F, 0xF6, 0xF9,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFE, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0xBF, 0xE0,
-    0x0F, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x05, 0xBF, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0xFC, 0x00, 0x02,
-    0xFF, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x0B, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0x0B,
-    0xFD, 0x00, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x2F, 0xE6, 0xFF,
-    0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x0F, 0xE0, 0x1F, 0xE0, 0x0B, 0xF0, 0x0F, 0xF0, 0x03, 0xF8, 0x0B,
-    0xF4, 0x01, 0xFD, 0x1F, 0xF4, 0x00, 0xBF, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x03, 0xFD, 0x00, 0x09, 0x00, 0xFF, 0x40, 0x1F, 0xC0, 0x3F, 0xF5, 0x7F, 0xE0, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x03, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x5B, 0xF0, 0x00, 0x07, 0xFD, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xB8, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00,
-    0x3F, 0x80, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0xE0,
-    0x01, 0xC0, 0x01, 0xFD, 0x02, 0xF0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0x6F, 0xF0, 0x01, 0xFD, 0x03, 0xFC,
-    0x00, 0xFE, 0x01, 0xFE, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0xBF, 0x40, 0x1F, 0xD1, 0xFF,
-    0x40, 0x0B, 0xFB, 0xFF, 0x40, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x90, 0x0F, 0xF4, 0x01, 0xFC, 0x03, 0xFF, 0x57, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0x80, 0x5B, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xF0,
-    0x00, 0x7E, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0xB8, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xD0,
-    0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0xE6,
-    0xFF, 0x01, 0xFD, 0x03, 0xFC, 0x0F, 0xE0, 0x1F, 0xE0, 0xBF, 0x00, 0xFF, 0x03, 0xF8, 0x0B, 0xF4,
-    0x1F, 0xD1, 0xFF, 0x40, 0xBF, 0xBF, 0xF4, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x3F,
-    0xD0, 0x00, 0x90, 0xFF, 0x40, 0x1F, 0xC3, 0xFF, 0x57, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x16,
-    0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xF0,
-    0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x80, 0x01,
-    0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF4, 0x01, 0xBF, 0x40, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x1F, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0x80, 0x2F, 0xE6, 0xFF, 0x01, 0xFD, 0x03, 0xFC, 0x0F, 0xE0, 0x1F, 0xE0, 0xBF, 0x00,
-    0xFF, 0x03, 0xF8, 0x0B, 0xF4, 0x1F, 0xD1, 0xFF, 0x40, 0xBF, 0xBF, 0xF4, 0x03, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0xFF, 0x40, 0x1F, 0xC3, 0xFF, 0x57, 0xFE, 0x07,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF9, 0x50, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x80, 0x01, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x3F,
-    0xC0, 0x00, 0x00, 0x7F, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x5B, 0xF0,
-    0x00, 0x07, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xB8, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x00,
-    0x06, 0x00, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xF9, 0xBF, 0xC0, 0x01, 0xFD, 0x03, 0xFC,
-    0x00, 0x3F, 0x80, 0x7F, 0x80, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0xFE, 0x02, 0xFD, 0x00, 0x1F, 0xD1,
-    0xFF, 0x40, 0x02, 0xFE, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x90, 0x03, 0xFD, 0x00, 0x7F, 0x00, 0x3F, 0xF5, 0x7F, 0xE0, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x00, 0x00, 0x07, 0xFC, 0x03,
-    0xF0, 0x00, 0x00, 0x29, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xC0, 0x1F, 0xFD, 0x00, 0x02, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x14, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xDF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xF8, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x7F,
-    0xF8, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xE5, 0x5F, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x00,
-    0x03, 0xF4, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x94, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x1F, 0xF8, 0x2F, 0xEA, 0x40, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x00, 0x00, 0xFF,
-    0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x6F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x01, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF9,
-    0x05, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x06, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x70,
-    0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xC0, 0x1F, 0xFD, 0x00,
-    0x02, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0xFC, 0x00,
-    0x00, 0x14, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xDF, 0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0B, 0xFF,
-    0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xF8, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x1F,
-    0xFF, 0xE5, 0x5F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x40, 0x00, 0x00, 0x0F, 0x80, 0x07, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x82, 0xFE, 0xA4,
-    0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x7F,
-    0xC0, 0x00, 0x07, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE6,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0x40, 0x2F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x90, 0x5F, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xE9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xC0, 0x1F, 0xFD, 0x00, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x14, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xDF, 0xFE, 0x00,
-    0x0B, 0xFF, 0xF8, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xF8,
-    0x00, 0x03, 0xFD, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xE5, 0x5F, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x82, 0xFE, 0xA4, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xF8, 0x03, 0xFE,
-    0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE6, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x2F, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0xBF,
-    0xC0, 0x03, 0xFF, 0x90, 0x5F, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x6F, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00,
-    0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFD, 0x00, 0x7F, 0xC0, 0x1F, 0xFD, 0x00, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x80,
-    0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x14, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xDF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xF8, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xF8, 0x00, 0x03,
-    0xFD, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xE5, 0x5F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x7F, 0xE0, 0xBF, 0xA9, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x07,
-    0xFC, 0x00, 0x00, 0x0F, 0xF9, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xBF, 0xFF, 0xD0, 0x00, 0x7F, 0xD0, 0x0B, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFF,
-    0x40, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xE4, 0x17,
-    0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1B,
-    0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xE4, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xFF,
-    0x90, 0x0B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFB, 0xF8, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x0B, 0xC0,
-    0x00, 0x19, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x29, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0xFC, 0x00, 0x3F,
-    0xDF, 0xFF, 0xF4, 0x01, 0xFE, 0xFD, 0x3F, 0xD0, 0x0B, 0xFF, 0xC0, 0xFF, 0x00, 0x3F, 0xFC, 0x07,
-    0xFC, 0x00, 0xFF, 0xD0, 0x2F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x03, 0xFC, 0x00,
-    0xFF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x03, 0xFD, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF0, 0x92, 0xFF, 0x00, 0x7F, 0xEF, 0xCF, 0xF8, 0x02, 0xFF, 0xFE, 0x3F, 0xD0, 0x07, 0xFF,
-    0xE1, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x05, 0x7F, 0xF5, 0x55, 0x5B, 0xFE, 0x54, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x02, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x2A, 0xFF, 0xEA, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xAF, 0xFA, 0x90, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xFD, 0x00, 0x0F, 0xF0, 0xFF, 0xFC, 0x00, 0x7F, 0xCF, 0xFF,
-    0xF4, 0x01, 0xFE, 0xFE, 0xBF, 0xD0, 0x0B, 0xFF, 0xD0, 0xFF, 0x00, 0x3F, 0xFD, 0x07, 0xFC, 0x00,
-    0xFF, 0xE0, 0x2F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0xC0,
-    0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x92, 0xFF, 0x00, 0x7F, 0xEF, 0xCF, 0xF8, 0x02, 0xFF, 0xFE, 0x3F, 0xD0, 0x07, 0xFF, 0xE1, 0xFF,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x38, 0x00, 0x03, 0xFF, 0x8B, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xC7, 0xFF, 0x40,
-    0x00, 0x70, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xB8, 0x02, 0x01, 0xFF, 0xC3, 0xE0,
-    0xFF, 0xFF, 0xF8, 0x7E, 0x3F, 0xFC, 0x0F, 0x03, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xAF, 0xF8, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00,
-    0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x90,
-    0x07, 0xFE, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0x6A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xAA, 0xAA, 0x03, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xF0, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0xBF,
-    0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x2A, 0xFF, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0F,
-    0xF8, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x09, 0x00, 0x7F, 0xEF, 0x80, 0x2F, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xE0, 0x00, 0xFF, 0x90, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x70, 0x00, 0x7F, 0x00, 0xBC, 0x00, 0x1F, 0xFA, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x01, 0x40, 0x00, 0x03, 0xF0, 0x01, 0xD0, 0xFE, 0x02, 0xF0, 0x3F, 0xFF, 0xF8, 0x03,
-    0xFF, 0xF8, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0B,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xAF, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x90, 0x07, 0xFE, 0xF8, 0x02, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFE, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xA8,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x3F, 0xF0, 0x0B, 0xFF, 0x00, 0xBF, 0xD0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x02, 0xFF, 0xF0, 0xBF, 0xFF, 0x0A, 0xBF, 0xE0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00,
-    0xBF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x07, 0xFC,
-    0x24, 0x7F, 0xEF, 0x8B, 0xFF, 0xF4, 0xBF, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00,
-    0x3D, 0x00, 0x0B, 0xC0, 0x00, 0xBF, 0x54, 0x07, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x68, 0x0B, 0xFF, 0xCB, 0xFF, 0xF2, 0xAF, 0xF8, 0x02, 0xFD,
-    0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x0F, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0x80,
-    0x3F, 0xD0, 0x1F, 0xF0, 0x97, 0xFE, 0xFA, 0xFF, 0xFD, 0xBF, 0xFE, 0x0F, 0xF9, 0x00, 0x50, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x07, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x01, 0x60, 0x02, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0xBF, 0xFF, 0x01, 0xFF, 0xFC, 0x0A, 0xBF, 0xE0,
-    0x1A, 0xFF, 0xC0, 0x02, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0xFF,
-    0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x3F,
-    0xD0, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x24, 0x0B, 0xFC, 0x00, 0x7F, 0xEF, 0x80, 0xFF, 0x80, 0x0B,
-    0xFF, 0xF4, 0x0F, 0xF4, 0x00, 0xBF, 0xFE, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x40, 0x2F, 0xF0, 0x00,
-    0x05, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x10, 0x0B, 0xF8, 0x00,
-    0x00, 0x0F, 0x42, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFB, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x7E, 0x00, 0x00, 0x06,
-    0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x02, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0x5F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00, 0x00, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x7F, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0x80, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x2F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC2, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF7,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xF4, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xF8, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x64, 0x00, 0x3F,
-    0xC1, 0xFF, 0xC0, 0x0F, 0xF2, 0xFF, 0xF8, 0x03, 0xF7, 0xFA, 0xFF, 0x01, 0xFE, 0xE0, 0x3F, 0x80,
-    0xBF, 0xE0, 0x0F, 0xE0, 0x3F, 0xF0, 0x0B, 0xF0, 0x0F, 0xF4, 0x07, 0xF4, 0x07, 0xFC, 0x0B, 0xF4,
-    0x02, 0xFF, 0xBF, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x1F, 0xF3, 0xFD,
-    0x00, 0x07, 0xFC, 0x7F, 0xD0, 0x02, 0xFE, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0xFF, 0xFE, 0x3F, 0xD0,
-    0x0F, 0xFF, 0x5F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00,
-    0x0A, 0x02, 0xFF, 0xE0, 0x0B, 0xFC, 0xFF, 0xFE, 0x03, 0xFF, 0xCA, 0xBF, 0xD0, 0xFF, 0xF8, 0x02,
-    0xFD, 0x3F, 0xEF, 0x40, 0x3F, 0xCB, 0xF0, 0x00, 0x03, 0xFD, 0xF8, 0x00, 0x00, 0x7F, 0xBE, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x01, 0xFF,
-    0x3F, 0x80, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x02, 0xFE, 0x0F, 0xF0, 0x38, 0x3F, 0xD0, 0xFF, 0xEF,
-    0xC3, 0xFC, 0x07, 0xFF, 0xF4, 0x7F, 0xC0, 0x3F, 0xFE, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x19, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x00,
-    0x7F, 0xE0, 0x00, 0xFE, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x02,
-    0xFE, 0x00, 0x2F, 0xFE, 0x02, 0xFF, 0xFC, 0x03, 0xFF, 0x90, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x0B, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x00,
-    0xFF, 0x80, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD,
-    0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0xC3, 0x00, 0xBF, 0xEF, 0x40, 0xFF, 0xFF, 0x00, 0xFF, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x19, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x00, 0x7F, 0xE0, 0x00, 0xFE,
-    0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xF8,
-    0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00,
-    0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00,
-    0x0B, 0xFC, 0x30, 0x0B, 0xFE, 0xF4, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xFF, 0xF1, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFE, 0x2F, 0x40, 0x01, 0xFF, 0xFF, 0x83, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x3D,
-    0x00, 0x00, 0x1F, 0xF8, 0x03, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x19, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xFE,
-    0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x50, 0x2F, 0xFF, 0x0B,
-    0xE2, 0xFF, 0xFC, 0x3F, 0x8B, 0xFF, 0xF0, 0xFD, 0x00, 0xBF, 0x87, 0xF0, 0x03, 0xFE, 0x2F, 0x40,
-    0x0F, 0xF4, 0xBC, 0x00, 0x7F, 0xC3, 0xD0, 0x02, 0xFF, 0x01, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x0C, 0x00, 0x0B, 0xFE, 0xF4, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x7C, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0x80, 0x01,
-    0xFF, 0x40, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xF8, 0x00, 0x0F,
-    0xFC, 0x00, 0x10, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x64, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xC0, 0x07, 0xFE,
-    0x00, 0x0F, 0xE0, 0x02, 0xFF, 0x40, 0x1B, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F,
-    0xC0, 0x68, 0x0B, 0xFC, 0x1F, 0xF0, 0xBF, 0x83, 0xFF, 0x0F, 0xF4, 0x3F, 0xD0, 0xFF, 0x03, 0xF8,
-    0x1F, 0xF0, 0x04, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x0B, 0xFC, 0x30, 0x00, 0xBF, 0xEF, 0x40, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x08, 0x00, 0x00,
-    0x07, 0xFF, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xAF, 0xF4,
-    0x00, 0x00, 0x04, 0x3F, 0xF0, 0x00, 0x19, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x00,
-    0x7F, 0x00, 0x7F, 0xE0, 0x00, 0xFE, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0x50, 0x00, 0x2F, 0xFF,
-    0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x40, 0x03, 0xFE, 0xF4, 0x01, 0xFF,
-    0xFD, 0x00, 0xBF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0xFC, 0x00, 0x3E, 0xFF,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF,
-    0x0C, 0x00, 0xBF, 0xEF, 0x40, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0xFF, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x5F, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC3, 0xFF, 0x41, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF0, 0xBF,
-    0x00, 0x00, 0x03, 0xFC, 0x0F, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x02, 0xFF, 0x8F, 0xF0, 0x00,
-    0x00, 0xBF, 0x40, 0x3F, 0xF7, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x01, 0xFD, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F,
-    0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x1A, 0x40, 0x2F, 0xFE, 0x07, 0xFF, 0x43, 0xFF, 0xF8, 0xBF, 0xFF, 0x0A, 0xBF, 0xEB, 0xFF, 0xFC,
-    0x00, 0xBF, 0xBE, 0x2F, 0xF0, 0x03, 0xFF, 0xE0, 0x7F, 0xC0, 0x0F, 0xFF, 0x02, 0xFE, 0x00, 0x7F,
-    0xF0, 0x0F, 0xF4, 0x02, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x0B,
-    0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xD0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x07, 0xFC, 0x30,
-    0xFF, 0x80, 0x2F, 0xFB, 0xD3, 0xFD, 0x00, 0xFF, 0xFF, 0x1F, 0xF0, 0x02, 0xFF, 0xF4, 0xBF, 0x80,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xEF, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF5, 0xFF, 0xC0, 0x3F, 0x80,
-    0x00, 0x02, 0xFC, 0x3F, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x07, 0xFF, 0x0B, 0xF0, 0x00, 0x00,
-    0x3F, 0xC0, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xF8, 0xFF, 0x00, 0x00, 0x0B, 0xF4,
-    0x03, 0xFF, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0x69, 0x00, 0xBF, 0xF8, 0x1F, 0xFD, 0x0F, 0xFF, 0xE2, 0xFF, 0xFC, 0x2A, 0xFF,
-    0xAF, 0xFF, 0xF0, 0x02, 0xFE, 0xF8, 0xBF, 0xC0, 0x0F, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xFC, 0x0B,
-    0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00,
-    0xFF, 0x80, 0x2F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0xC0,
-    0x1F, 0xF0, 0xC3, 0xFE, 0x00, 0xBF, 0xEF, 0x4F, 0xF4, 0x03, 0xFF, 0xFC, 0x7F, 0xC0, 0x0B, 0xFF,
-    0xD2, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xFF,
-    0x40, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x7F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x0F, 0xFD, 0x07,
-    0xF4, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC2, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x0B, 0xFE, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0xDF, 0xE0, 0x00, 0x00,
-    0xBF, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x02, 0x40, 0x00, 0x2F, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x07, 0xF0, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x06, 0x90, 0x0B, 0xFF, 0x81, 0xFF, 0xD0, 0xFF, 0xFE, 0x2F, 0xFF, 0xC2, 0xAF,
-    0xFA, 0xFF, 0xFF, 0x00, 0x2F, 0xEF, 0x8B, 0xFC, 0x00, 0xFF, 0xF8, 0x1F, 0xF0, 0x03, 0xFF, 0xC0,
-    0xBF, 0x80, 0x1F, 0xFC, 0x03, 0xFD, 0x00, 0xBF, 0xE0, 0x0F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF8, 0x02, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFC,
-    0x01, 0xFF, 0x0C, 0x3F, 0xE0, 0x0B, 0xFE, 0xF4, 0xFF, 0x40, 0x3F, 0xFF, 0xC7, 0xFC, 0x00, 0xBF,
-    0xFD, 0x2F, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x59, 0x00, 0x1A, 0x40, 0x3F, 0x82, 0xFF,
-    0xE0, 0x7F, 0xF4, 0x2F, 0x83, 0xFF, 0xF8, 0xBF, 0xFF, 0x01, 0x00, 0xAB, 0xFE, 0xBF, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xBE, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFE,
-    0x02, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x03,
-    0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC3, 0x00, 0x00,
-    0xFF, 0x80, 0x2F, 0xFB, 0xD0, 0x00, 0x3F, 0xD0, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xFF,
-    0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xEF, 0xFD, 0x00, 0xFF, 0x00, 0x00,
-    0x07, 0xF5, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x3F, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0xFF,
-    0x07, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x2F,
-    0xF8, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x69, 0x02, 0xFF, 0xE0, 0x7F,
-    0xF4, 0xFF, 0xFE, 0x2F, 0xFF, 0xCA, 0xBF, 0xEB, 0xFF, 0xFC, 0x02, 0xFE, 0xF8, 0xBF, 0xC0, 0x3F,
-    0xFE, 0x07, 0xFC, 0x03, 0xFF, 0xC0, 0xBF, 0x80, 0x7F, 0xF0, 0x0F, 0xF8, 0x0B, 0xFE, 0x00, 0xFF,
-    0x40, 0xFF, 0xC0, 0x1F, 0xF0, 0x0F, 0xF8, 0x02, 0xFF, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF0,
-    0x03, 0xFD, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x7F, 0xC0, 0x0F, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3D, 0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x0A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00,
-    0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F,
-    0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00,
-    0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x80, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xBF, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8, 0x00,
-    0xBF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F,
-    0xE0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x2F, 0xF4, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x03, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD,
-    0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD,
-    0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00,
-    0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x10, 0x00, 0x2F, 0x00, 0x0D, 0x00, 0x03, 0xFC, 0x07, 0xD0, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xBF, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8, 0x00,
-    0xBF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F,
-    0xE0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x2F, 0xF4, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x02, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x07,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x03,
-    0xF8, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x95, 0xBF, 0xFC, 0x00,
-    0x0F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x00,
-    0x1F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x7F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0x03, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xF8,
-    0x00, 0x00, 0x3F, 0xF4, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFD,
-    0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xF9,
-    0x6F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xB4, 0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x00, 0xFD, 0x1F, 0xD0, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x00, 0x03, 0xD0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFB, 0xFF, 0x40, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x00,
-    0xBF, 0xC0, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF,
-    0x80, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
-    0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF4, 0x2F, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0x90, 0x0F, 0xF8, 0x01, 0x7F, 0x40, 0x2F, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xC0,
-    0x1F, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xF0,
-    0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0xBC, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF4,
-    0x00, 0x2F, 0xC0, 0x0B, 0xFF, 0xE5, 0x6F, 0xFD, 0x00, 0x5F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A,
-    0x40, 0x00, 0x69, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x2F, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFE, 0xFF, 0xBF, 0xD7, 0xFC, 0x02, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x03, 0xFF, 0xC0, 0x3F, 0xC0, 0xFF, 0x80, 0x0B, 0xFD, 0x02, 0xFD, 0x07, 0xFD, 0x00, 0x2F,
-    0xF0, 0x1F, 0xE0, 0x2F, 0xF0, 0x00, 0xBF, 0x83, 0xFE, 0x00, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0xD0,
-    0x03, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xE0,
-    0x03, 0xFF, 0x40, 0x01, 0x80, 0xFF, 0xC0, 0x2F, 0xFE, 0x00, 0x2F, 0x02, 0xFF, 0x42, 0xFF, 0xFE,
-    0x5B, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFE, 0x2F, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x55, 0xFF, 0x81,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xD0,
-    0x00, 0x07, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x1B, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00,
-    0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x0B,
-    0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x01, 0xA0, 0x2F, 0xFE, 0x0B, 0xFC, 0xFF, 0xFE,
-    0x2F, 0xFC, 0xAB, 0xFE, 0x7F, 0xFC, 0x01, 0xFD, 0xFF, 0xF8, 0x02, 0xFE, 0xF4, 0x10, 0x03, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x55, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40,
-    0x7F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x01, 0xFF, 0x80,
-    0x00, 0x0B, 0xFC, 0x1B, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00,
-    0x00, 0x7F, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x03,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x1A, 0x00, 0x2F, 0xFE, 0x0B, 0xFC, 0x0F, 0xFF, 0xE2,
-    0xFF, 0xC0, 0xAB, 0xFE, 0x7F, 0xFC, 0x00, 0x1F, 0xDF, 0xFF, 0x80, 0x02, 0xFE, 0xF4, 0x10, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xC1, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x55, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40,
-    0x7F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x01, 0xFF, 0x80,
-    0x00, 0x0B, 0xFC, 0x1B, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00,
-    0x00, 0x7F, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x03,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x18, 0x00, 0x0F, 0x80, 0x2F, 0x80, 0x03, 0xF0, 0x2F,
-    0x80, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x40, 0x1A, 0x00, 0xBF, 0xF8, 0x2F, 0xF0, 0xFF, 0xFE, 0x2F, 0xFC, 0x2A, 0xFF, 0x9F, 0xFF, 0x00,
-    0x1F, 0xDF, 0xFF, 0x80, 0x0B, 0xFB, 0xD0, 0x40, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xD0, 0x0B, 0xFC,
-    0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xD0, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x3F, 0x00, 0x07, 0xFF, 0x01, 0xFC, 0x00, 0x0F, 0xFC, 0x0B, 0xF0, 0x00, 0x3F, 0xF0,
-    0x3F, 0xD0, 0x01, 0xFF, 0x80, 0xFF, 0xD0, 0x2F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xBF, 0x80, 0x07, 0xFC, 0x02,
-    0xC0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x3C,
-    0x00, 0xFF, 0x80, 0x2F, 0xC0, 0x2F, 0xE0, 0x0F, 0xFC, 0x0F, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xAC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0B, 0xFB, 0xF8,
-    0x00, 0x00, 0xFF, 0x47, 0xF4, 0x00, 0x0F, 0xF4, 0x07, 0xD0, 0x00, 0x1A, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xF4, 0x02, 0xFF, 0x00, 0x0F, 0xC0,
-    0x0F, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x01, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x0F,
-    0xC0, 0x01, 0xFF, 0xC0, 0x7F, 0x00, 0x03, 0xFF, 0x02, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00,
-    0x7F, 0xE0, 0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x07,
-    0xF0, 0xFD, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x2F, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xBF,
-    0xAB, 0xF8, 0x01, 0xFF, 0x00, 0xB0, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xE0, 0x0F, 0x00, 0x3F, 0xE0, 0x2F, 0xC0, 0x2F, 0xE0, 0x3F, 0xF0, 0x3F, 0xC0, 0x3F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xF4, 0x02, 0xFF, 0x00, 0x0F, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0x00,
-    0x3F, 0xF0, 0x01, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xC0, 0x01, 0xFF, 0xC0, 0x7F,
-    0x00, 0x03, 0xFF, 0x02, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x0B,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00,
-    0x1F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x80, 0x2F, 0xEA, 0xFE, 0x01, 0xFF, 0x00, 0xB0, 0x0B, 0xFC,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0x00, 0x3F, 0xE0, 0xBF, 0x00, 0xBF, 0x83,
-    0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x78, 0x00, 0x02, 0xF4, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xF0,
-    0x00, 0x00, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xE0,
-    0x07, 0xF4, 0x00, 0xBF, 0xC0, 0x03, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0xFF, 0xC0, 0x07,
-    0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xC0, 0x01, 0xFF, 0xC0, 0x1F, 0xC0,
-    0x00, 0xFF, 0xC0, 0x2F, 0xC0, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x01, 0xFF, 0x80, 0x3F, 0xF4, 0x0B,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 0x00, 0x00, 0xBC, 0x02, 0xFC, 0x00,
-    0x0B, 0xD0, 0xBF, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFA, 0xBF, 0x80, 0x01, 0xFF, 0x00, 0xB0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0x00, 0x3F, 0xE0, 0x02, 0xFC, 0x02,
-    0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9, 0x5F, 0xFD, 0x57, 0xF8, 0xBF,
-    0x00, 0xFF, 0xC0, 0x3F, 0x4B, 0xE0, 0x1F, 0xF8, 0x03, 0xF0, 0xBD, 0x02, 0xFF, 0x40, 0x7E, 0x02,
-    0x80, 0x3F, 0xF0, 0x06, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x01, 0x40, 0x3F, 0xF0, 0x2F, 0x00, 0xFF, 0xEB, 0xFC,
-    0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x01, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0x00,
-    0x2F, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0x95, 0xFF, 0xD5, 0x7F, 0x8B, 0xF0, 0x0F, 0xFC, 0x03, 0xF4, 0xBE, 0x01, 0xFF, 0x80, 0x3F,
-    0x0B, 0xD0, 0x2F, 0xF4, 0x07, 0xE0, 0x28, 0x03, 0xFF, 0x00, 0x68, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0x90, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x68, 0x3E, 0x00, 0x00, 0xBF, 0x1F, 0x00, 0x00, 0x7F, 0xC7, 0x40,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x50, 0x00, 0xFF, 0xC0, 0xBC, 0x00,
-    0x3F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9, 0x5F, 0xFD, 0x57, 0xF8, 0xBF, 0x00, 0xFF, 0xC0, 0x3F,
-    0x4B, 0xE0, 0x1F, 0xF8, 0x03, 0xF0, 0xBD, 0x02, 0xFF, 0x40, 0x7E, 0x02, 0x80, 0x3F, 0xF0, 0x06,
-    0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xA8,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x05, 0xBF, 0xD5,
-    0x40, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x0B, 0xFC, 0x01, 0x40, 0x3F, 0xF0, 0x2F, 0x00, 0xFF, 0xEB, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x80, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xF8, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x01, 0x80, 0x00, 0x02, 0xFF, 0x83, 0xE0, 0x00, 0x03, 0xFF, 0xEF,
-    0xD0, 0x00, 0x07, 0xD3, 0xFF, 0xC0, 0x00, 0x03, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F,
-    0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF,
-    0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00,
-    0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF,
-    0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D,
-    0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B,
-    0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xAA,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD,
-    0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF0,
-    0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xF8,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFE,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0,
-    0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F,
-    0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x02, 0xFF,
-    0x40, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03,
-    0xFF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x03, 0xE0, 0x01,
-    0xC0, 0x00, 0x03, 0xF8, 0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF,
-    0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF,
-    0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00,
-    0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02,
-    0xFF, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00,
-    0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00,
-    0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
-    0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0xFD, 0xBD, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00,
-    0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F,
-    0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B,
-    0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0,
-    0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0,
-    0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x1F, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x4B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD,
-    0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0xF0, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0xFF,
-    0x0F, 0xF0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xC0, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54,
-    0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00,
-    0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE,
-    0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03,
-    0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF,
-    0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4,
-    0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F,
-    0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA8, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00,
-    0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F,
-    0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B,
-    0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0,
-    0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0,
-    0xFF, 0xF0, 0x0B, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x50, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x50,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x29, 0x00, 0x3F, 0xFF, 0xEB, 0xFF, 0xFF, 0x80,
-    0x2F, 0x80, 0x1F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x0F, 0xF0, 0x02, 0xFF, 0xF8, 0x07, 0xFE, 0x00,
-    0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0xBF, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x3F,
-    0xF0, 0x2F, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x0F, 0xDF, 0xF0, 0x2F, 0xD0, 0x00, 0x02,
-    0xFF, 0x07, 0xF2, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xC3, 0xF4, 0xBF, 0x4B, 0xF4, 0x00, 0x00,
-    0x1F, 0xF1, 0xFC, 0x2F, 0xD3, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFD, 0x07, 0xF6, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0x7F, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x40, 0x06, 0x80,
-    0xBF, 0xF0, 0x0F, 0xF4, 0x0F, 0xFC, 0x7F, 0xFD, 0x02, 0xFF, 0x01, 0xFF, 0x5B, 0xFF, 0xC0, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF4, 0x03, 0xFD, 0x03, 0xFE, 0x02, 0xFC, 0x00,
-    0xFF, 0x40, 0xFF, 0x80, 0xFF, 0x00, 0x2F, 0xE0, 0x7F, 0xF0, 0x3F, 0x80, 0x07, 0xF8, 0x2F, 0xFC,
-    0x1F, 0xC0, 0x00, 0xFE, 0x0F, 0xFF, 0x0B, 0xF0, 0x00, 0x3F, 0xC7, 0xFF, 0xC3, 0xF4, 0x00, 0x0F,
-    0xF3, 0xFB, 0xF2, 0xFC, 0x00, 0x03, 0xFE, 0xF5, 0xFD, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0xFE,
-    0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFD,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x83, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0x07, 0xE0, 0x00, 0x00, 0x1A, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE3, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
-    0x8B, 0xFF, 0xF4, 0x01, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0xC0,
-    0x7F, 0x80, 0x00, 0x01, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x0B,
-    0xFE, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x3E, 0x00,
-    0x00, 0x03, 0xF4, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x58, 0x00, 0x1A, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F,
-    0xE0, 0x01, 0xBF, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02,
-    0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
-    0x7F, 0x80, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x03, 0xD0, 0x6F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xE2, 0xFF, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0xFF,
-    0xC0, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xCF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x94, 0x02, 0xFF, 0xD0, 0x1F, 0xC0, 0x01, 0xFF,
-    0xE0, 0x07, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x19, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xC0,
-    0x0F, 0xFE, 0x00, 0x07, 0xF0, 0x0F, 0xFF, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0x00, 0x06, 0xFF, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x68, 0x00, 0xFF, 0xF4, 0x3F, 0xC0, 0xFF, 0xFF, 0xEF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0xE6, 0xFF, 0xF4, 0x07, 0xF0, 0x0B, 0xF4, 0x00, 0xF4, 0x0B,
-    0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xE0, 0x07, 0xFC, 0x00, 0xBD, 0x03,
-    0xFF, 0xFA, 0xBF, 0x83, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xBF, 0xFF, 0xF0, 0x2F, 0x42, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0x50, 0x0B, 0xFF, 0x40, 0x7F, 0x00, 0x07, 0xFF, 0x80, 0x1F,
-    0xC0, 0x03, 0xFF, 0x80, 0x03, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x64, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0x00, 0x3F, 0xF8,
-    0x00, 0x1F, 0xC0, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0xFC, 0x00, 0x1B, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1A, 0x00, 0x3F, 0xFD, 0x0F, 0xF0, 0x3F, 0xFF,
-    0xFB, 0xFC, 0x0F, 0xFF, 0xFF, 0xFD, 0x07, 0xF9, 0xBF, 0xFD, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x3D,
-    0x02, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x38, 0x01, 0xFF, 0x00, 0x2F,
-    0x40, 0xFF, 0xFE, 0xAF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xEF, 0xFF, 0xFC, 0x0B, 0xD0, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00, 0xBF,
-    0x40, 0x00, 0x0F, 0xD0, 0xBF, 0x40, 0x00, 0x02, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0x50, 0x0B, 0xFF, 0x40, 0x7F, 0x00, 0x07, 0xFF, 0x80,
-    0x1F, 0xC0, 0x03, 0xFF, 0x80, 0x03, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x64, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0x00, 0x3F,
-    0xF8, 0x00, 0x1F, 0xC0, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0xFC, 0x00, 0x1B, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x03, 0xE0, 0x0F, 0xE0, 0x00, 0xFC, 0x0F,
-    0xE0, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x01, 0xA0, 0x03, 0xFF, 0xD0, 0xFF, 0x03, 0xFF, 0xFF, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x7F, 0x9B, 0xFF, 0xD0, 0x1F, 0xC0, 0x2F, 0xD0, 0x03, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x1F, 0xF0, 0x03, 0x80, 0x1F, 0xF0, 0x02, 0xF4, 0x0F, 0xFF, 0xEA, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x87, 0xFE, 0xFF, 0xFF, 0xC0, 0xBD, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF6, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7C, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3C, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xF4, 0x0B,
-    0xF0, 0x2F, 0xF0, 0x3F, 0xD0, 0x7F, 0xC0, 0x3F, 0x80, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x3F, 0x02, 0xFD, 0x1F, 0xF0, 0xFF, 0x0B, 0xF4, 0x3F, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xF8, 0x02, 0xFE, 0xFC, 0x07, 0xF0, 0xFD,
-    0x1F, 0xD0, 0x3E, 0x3F, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x18, 0x2F, 0xF8, 0x3E, 0x3F,
-    0xFE, 0xFD, 0x7D, 0x3F, 0xFC, 0x38, 0x1F, 0xF0, 0x00, 0x01, 0x00, 0x1A, 0xAA, 0xA8, 0x3F, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x09, 0x00, 0x04, 0x3E, 0x00, 0x1C, 0x3F, 0x80, 0xBC,
-    0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x06, 0x83, 0xFD, 0x7F, 0xD7, 0xFC, 0x3F,
-    0x40, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFC, 0x3F, 0xC3, 0xFD, 0x7F, 0xC3, 0xFD, 0x7F, 0x43,
-    0xF8, 0x04, 0x00, 0x40, 0x06, 0xF9, 0x0F, 0xFF, 0xDB, 0xE7, 0xFB, 0xE0, 0xBE, 0x24, 0x3F, 0x00,
-    0x3F, 0x40, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0xBF, 0xF4,
-    0x1F, 0xEF, 0xC3, 0xE0, 0x7C, 0x3D, 0x03, 0xC3, 0xD0, 0xBC, 0x3F, 0x6F, 0x81, 0xFF, 0xE0, 0x06,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0xC0, 0x1F, 0xC2, 0xFC, 0x0F, 0xF1, 0xFE, 0x0F,
-    0xF0, 0xFF, 0x0B, 0xF0, 0xBF, 0x03, 0xF0, 0x7F, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x60, 0xBC, 0x02, 0xFC, 0xBD, 0x0B, 0xF0, 0x7F, 0x2F, 0xC0, 0x3F, 0xFF, 0x00, 0x1F,
-    0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x09, 0x03, 0xF0, 0xFC,
-    0x0F, 0xC3, 0xF0, 0x3F, 0x4F, 0xD0, 0x7F, 0x1F, 0xC0, 0xBC, 0x2F, 0x00, 0xF0, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0x40, 0x1F, 0xFF, 0xC1, 0xFF, 0xFF, 0x8F, 0xD5, 0xFF, 0x78, 0x00, 0xFD, 0x40,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xBC, 0x07, 0xD0, 0x3F, 0x02, 0xF8, 0x0F,
-    0xE0, 0x3F, 0xC0, 0xBF, 0x40, 0xA4, 0x00, 0x07, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFE, 0x07, 0xF0,
-    0x2F, 0x81, 0xFC, 0x1F, 0xC0, 0x78, 0x00, 0x0F, 0xC3, 0xFD, 0xBF, 0x4F, 0xF0, 0xFE, 0x0B, 0xE0,
-    0x7F, 0x02, 0xF4, 0x0A, 0x00, 0x04, 0x00, 0xFC, 0x1F, 0xC2, 0xFC, 0x3F, 0x43, 0xF0, 0x3D, 0x07,
-    0xC0, 0x10, 0x00, 0x0B, 0xD0, 0xFF, 0x0F, 0xE1, 0xFD, 0x3F, 0x4B, 0xD0, 0xE0, 0x00, 0x00, 0x01,
-    0x01, 0xFC, 0x3F, 0xD7, 0xFD, 0x7F, 0x81, 0x90, 0x0F, 0x80, 0xBC, 0x3F, 0xC3, 0xFD, 0x7F, 0xC3,
-    0xFD, 0x7F, 0x43, 0xF8, 0x14, 0x00, 0x50, 0x01, 0x40, 0x0F, 0xF8, 0x3E, 0xBD, 0x78, 0x2E, 0xB8,
-    0x2E, 0x7D, 0x7C, 0x3F, 0xF4, 0x06, 0x80, 0x00, 0x40, 0x1F, 0xC0, 0x7F, 0x40, 0xFD, 0x03, 0xF0,
-    0x2F, 0x02, 0xF4, 0x05, 0x00, 0x01, 0x50, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xFC, 0x01, 0xFC, 0x07,
-    0xF0, 0x3F, 0xC0, 0x29, 0x00, 0x00, 0x50, 0x07, 0xC0, 0x0F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7F,
-    0x54, 0x3F, 0xFC, 0x1F, 0xE0, 0x00, 0x01, 0xFD, 0x2F, 0xC3, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x0B,
-    0xF0, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0xF0,
-    0x02, 0xFE, 0xFE, 0x03, 0xFC, 0x1F, 0xC3, 0xF8, 0x02, 0xF0, 0x24, 0x00, 0x10, 0x08, 0x00, 0x04,
-    0x3E, 0x00, 0x1C, 0x3F, 0x80, 0xBC, 0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xE0, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x2C, 0x2F, 0xFC, 0x3E, 0x7F, 0xFF, 0xFD, 0x7C, 0x3F, 0xF8, 0x28, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA4,
-    0x00, 0x1A, 0x40, 0x02, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x3F, 0x96, 0xFC, 0x3C, 0x00, 0xFC, 0x20,
-    0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07, 0xF4, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x28, 0x00, 0x01,
-    0x00, 0x14, 0x07, 0xF4, 0x3F, 0x83, 0xFD, 0x2F, 0xE0, 0xFF, 0x0F, 0xF4, 0x3F, 0x41, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0x07, 0xE0, 0xBD, 0x0F, 0xF5, 0xFF, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0x6F, 0xC0, 0x00,
-    0x1F, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xC0, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x1B, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x01, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0x00, 0x03,
-    0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x16,
-    0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xF0,
-    0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x80, 0x01,
-    0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF4, 0x01, 0xBF, 0x40, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B,
-    0xF5, 0x5F, 0xFD, 0x5B, 0xF4, 0xBF, 0x00, 0xFF, 0x80, 0x7F, 0x4B, 0xE0, 0x1F, 0xF4, 0x07, 0xF0,
-    0xBC, 0x02, 0xFF, 0x00, 0xBD, 0x01, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE5, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFE, 0x5B, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x1F, 0xF4, 0x00,
-    0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00,
-    0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xD0, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x06, 0xFF, 0xF9,
-    0x00, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFD, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0D, 0x01, 0xFF, 0x40, 0x00, 0x03,
-    0xFA, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x06, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0x15, 0x7F, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xF4,
-    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x40, 0x7F, 0xC0, 0x0F, 0xFE,
-    0x00, 0x03, 0xF8, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0x40, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xFC,
-    0x00, 0x00, 0x14, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x10, 0x02,
-    0xFF, 0xC0, 0x00, 0x03, 0xC0, 0x1F, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xF4, 0x00, 0x2F, 0xE0,
-    0x07, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x7F, 0xE0, 0x07, 0xF4, 0x02, 0xFF, 0x00, 0x0F, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0xF0,
-    0x01, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xC0, 0x01, 0xFF, 0xC0, 0x7F, 0x00, 0x03,
-    0xFF, 0x02, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x0B, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x0F,
-    0xFC, 0x7F, 0xD0, 0x00, 0xFF, 0x4B, 0xFC, 0x00, 0x0F, 0xE0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x28,
-    0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD7, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0xF5, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0x00, 0x7F, 0xFA, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFC, 0x00,
-    0x01, 0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00,
-    0x07, 0xF4, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x24,
-    0x3F, 0xC0, 0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0xBF, 0xF0, 0xBF,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-    0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x94,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD,
-    0x01, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0x55, 0xFF, 0xD5, 0xBF, 0x40, 0xBF, 0x00, 0xFF,
-    0x80, 0x7F, 0x40, 0xBE, 0x01, 0xFF, 0x40, 0x7F, 0x00, 0xBC, 0x02, 0xFF, 0x00, 0xBE, 0x00, 0x14,
-    0x03, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x05, 0x94,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
-    0xA6, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F,
-    0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x06, 0xFF, 0xF8,
-    0x06, 0xFF, 0xF8, 0x2F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x7F, 0xFE,
-    0x00, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xFB, 0xC0, 0x00, 0x1F,
-    0xF4, 0x02, 0xFD, 0x05, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x43, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDB, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x03,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFE, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xF8,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC2, 0xFE, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x42, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBF, 0xD6, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x02, 0xFF, 0x80, 0x00, 0xBF,
-    0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x07, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xC0, 0x00, 0x00,
-    0x2F, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0x90, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00,
-    0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xF8, 0x05, 0xFD, 0x00, 0x01, 0xFF, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0xF0, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0xBF, 0xFF, 0x00, 0x01, 0xFF,
-    0x40, 0x3F, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFE, 0xFF, 0xF4,
-    0x00, 0x55, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x07, 0xFE, 0x53, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0xEB, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0x00,
-    0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x0B, 0xFE, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF1, 0x57, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0F,
-    0xE0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x03, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x03, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xE0,
-    0x16, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F,
-    0xF0, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x80,
-    0x01, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF4, 0x01, 0xBF, 0x40, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xF4,
-    0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0xFD, 0x01,
-    0xFF, 0xF9, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xBF, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0xBF, 0x00, 0x01,
-    0x03, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xFF, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xE0,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC3, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x6F, 0xF6, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFC,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x7F, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x2F, 0xE0, 0x0B, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x2F,
-    0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x06, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFC, 0x00, 0xBF, 0xF8, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x7F, 0xF0,
-    0x03, 0xF4, 0x00, 0xBF, 0xD0, 0x0F, 0xC0, 0x02, 0xFF, 0x40, 0x2D, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x15, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x08, 0x00, 0x01, 0xFF, 0x81, 0xF4, 0x00,
-    0x0B, 0xFD, 0x0F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xF4, 0x1B, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFD, 0x00, 0x1F,
-    0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xF8, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC2, 0xFE, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x42, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD6, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC2, 0xFE, 0x1F, 0xF8,
-    0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x42, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x3F, 0xF0, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9,
-    0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0x80, 0x0F, 0xFE, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0x41, 0x40, 0x00, 0x2F, 0xF0,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF6, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x24, 0x3F, 0xC0, 0x01, 0xFF,
-    0x80, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x1B, 0xFF, 0xE4, 0x00,
-    0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFB, 0xF8, 0x03, 0xF7, 0xFC, 0x00, 0x00,
-    0x03, 0xFA, 0xFE, 0x01, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0xC0, 0xFD, 0x3F, 0xC0, 0x00,
-    0x00, 0xBF, 0x1F, 0xF0, 0xBF, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x3F, 0x07, 0xFC, 0x00,
-    0x00, 0x0F, 0xD0, 0xFF, 0x6F, 0x82, 0xFF, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0xEF, 0xC0, 0xBF, 0xC0,
-    0x00, 0x03, 0xFC, 0x0B, 0xFF, 0xE0, 0x2F, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xFF, 0xF0, 0x0F, 0xF8,
-    0x00, 0x00, 0x7F, 0x00, 0x7F, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0F,
-    0xF8, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xFD, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1B,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0x80,
-    0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF,
-    0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC,
-    0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4,
-    0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x55,
-    0x57, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x02, 0xFF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x65, 0xFF, 0x82, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x02, 0xFF, 0xC0,
-    0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x3F,
-    0xF0, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x00,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x41,
-    0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x03,
-    0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x08, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x6F, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9, 0x5F, 0xFD, 0x57,
-    0xF8, 0xBF, 0x00, 0xFF, 0xC0, 0x3F, 0x4B, 0xE0, 0x1F, 0xF8, 0x03, 0xF0, 0xBD, 0x02, 0xFF, 0x40,
-    0x7E, 0x02, 0x80, 0x3F, 0xF0, 0x06, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x02, 0xFF, 0x80, 0x00,
-    0xBF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFB, 0xFF, 0xBF, 0xFC, 0x07, 0xFF, 0x03, 0xFD, 0x0F, 0xFD,
-    0x0F, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x2F, 0xF4, 0x07, 0xFC, 0x03, 0xFF, 0x3F, 0xF0, 0x0B, 0xFC,
-    0x03, 0xFF, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFF, 0x3F, 0xE0, 0x0F, 0xF4, 0x03, 0xFE, 0x3F, 0xF0,
-    0x1F, 0xF0, 0x0B, 0xFC, 0x3F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF8, 0x1F, 0xFD, 0x3F, 0xE0, 0xBF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1B, 0xFF, 0xFA,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFD, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x8B, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x90, 0x07, 0xFF, 0xE4, 0x00, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0xBF,
-    0xFF, 0x90, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x0B, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFE,
-    0x00, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x69, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x2F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFE, 0x07, 0xFF, 0xF4, 0x2F, 0xFF, 0x90, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x1F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF4,
-    0x00, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xD3, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x2F, 0xFF, 0xF1,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xF4, 0x2F, 0xFF, 0x90, 0x00, 0x03, 0xFE, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0,
-    0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFD,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFD, 0x47, 0xFE, 0x00, 0x00, 0xBF, 0x01, 0xFF, 0x40, 0x00,
-    0x2F, 0x80, 0xBF, 0xC0, 0x00, 0x0B, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0xA0, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0xBF, 0xFE, 0x00, 0x07, 0xFD, 0x01, 0xFF, 0xD0,
-    0x02, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80,
-    0x0F, 0xF8, 0x00, 0xBF, 0xD0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x7F, 0xF4, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xF9,
-    0xBF, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x7F, 0xE0, 0x00,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x07, 0xFF, 0x01,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0xBF, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xE0,
-    0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x2F, 0xF8, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x40, 0x2F, 0xFE, 0x00, 0x3F,
-    0x40, 0x02, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0xF4, 0x02, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x05,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x90, 0x00,
-    0x03, 0xFF, 0x41, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x3F, 0xF9, 0x1B,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x80,
-    0x2F, 0xFF, 0x56, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0x7F, 0xF4, 0x00, 0x02,
-    0xFF, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xFC,
-    0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFE, 0x07, 0xFF, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x07, 0xFD, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xF4, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xE0, 0x0F, 0xFE, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x07, 0xFF, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x03,
-    0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x06, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF9,
-    0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xE6, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFA, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x7F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xE0, 0x0F, 0xF8, 0x00, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0xBF, 0xFE,
-    0x40, 0x0B, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE,
-    0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01,
-    0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD,
-    0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00,
-    0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x06, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0xE5, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x41, 0x54, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x0F, 0xEB, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD0, 0x7F, 0xF0, 0x0F, 0xFD, 0x00, 0xFF, 0xC0,
-    0x7F, 0xE0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0xFF, 0x80, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x0F, 0xFC, 0x01, 0xFF,
-    0x40, 0x2F, 0xF8, 0x2F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0xBF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x47, 0xFC, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0xFE,
-    0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x2F, 0xD0, 0x3F, 0x81, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE4, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFE, 0x40, 0x7F, 0xE0, 0xFF, 0x00, 0x0B, 0xF8, 0x3F, 0xC0, 0x02, 0xFE,
-    0x0F, 0xF4, 0x00, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x02, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xAF, 0xFC, 0x0F, 0xD0, 0x0F, 0xF0, 0x18, 0x00, 0x7F,
-    0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0xBF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x81, 0xFF, 0x00, 0x1F, 0x47, 0xFD,
-    0x02, 0xFD, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x0F, 0xD5, 0xBF, 0xF0, 0x00, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xFB, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xD0, 0x07,
-    0xFC, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x0B, 0xF8, 0x2F, 0xF0, 0x00, 0xFF, 0x83, 0xFE,
-    0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFC,
-    0x03, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x3F, 0xE0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40,
-    0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0xE6, 0xFF, 0x01, 0xFD, 0x03, 0xFC, 0x0F,
-    0xE0, 0x1F, 0xE0, 0xBF, 0x00, 0xFF, 0x03, 0xF8, 0x0B, 0xF4, 0x1F, 0xD1, 0xFF, 0x40, 0xBF, 0xBF,
-    0xF4, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0xFF, 0x40, 0x1F,
-    0xC3, 0xFF, 0x57, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x54, 0x00, 0x1A, 0x00, 0x07, 0xFF, 0xC0, 0x3F,
-    0x80, 0x2F, 0xFC, 0x01, 0xFF, 0xFD, 0x03, 0xF4, 0x0B, 0xFF, 0xD0, 0x7F, 0xFF, 0xF0, 0x7F, 0x02,
-    0xFF, 0xFC, 0x0B, 0xE6, 0xFF, 0x0B, 0xF0, 0x7F, 0x42, 0x80, 0x74, 0x0F, 0xF0, 0xFE, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0x3F, 0xD3, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0xBF, 0x9F, 0xD0, 0x04, 0x01, 0x00, 0xBE, 0x0F, 0xF1, 0xFF, 0x02, 0xE0, 0x3D, 0x7F, 0xC0,
-    0xFD, 0x0F, 0xFE, 0xFE, 0x0B, 0xFF, 0xF0, 0x1F, 0xC0, 0xFF, 0xFF, 0xC0, 0xBF, 0xFD, 0x02, 0xFC,
-    0x07, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x3F, 0x40, 0x2F, 0xF8, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFE, 0x5F, 0xFC, 0x03, 0xF0, 0x03, 0xFC, 0x01, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0A, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0x00, 0x0F, 0xF4, 0x3F, 0x80, 0x2F, 0xF0, 0x3F,
-    0xFB, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF,
-    0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF,
-    0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00,
-    0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x02, 0xF0, 0x01, 0xD0, 0x00, 0x07, 0xF0,
-    0x03, 0xD0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54,
-    0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00,
-    0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE,
-    0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03,
-    0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF,
-    0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4,
-    0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x68, 0x00, 0x0A, 0x02, 0xFF,
-    0xE0, 0x0B, 0xFC, 0xFF, 0xFE, 0x03, 0xFF, 0xCA, 0xBF, 0xE0, 0xFF, 0xFC, 0x02, 0xFD, 0x3F, 0xE1,
-    0x40, 0x3F, 0xCB, 0xF0, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x0B, 0xFB,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x2F, 0xD0, 0x00,
-    0x1F, 0xF1, 0xFE, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x38, 0x3F, 0xE0, 0xBF, 0xEF, 0xC3, 0xFD, 0x03,
-    0xFF, 0xF4, 0x7F, 0xC0, 0x2F, 0xFE, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xA5, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0xBF, 0xEF, 0xF4, 0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0x2F, 0x81, 0xFF, 0x00,
-    0x00, 0x0F, 0xC0, 0xBF, 0x80, 0x00, 0x07, 0xF0, 0x3F, 0xD0, 0x00, 0x03, 0xF4, 0x0F, 0xF0, 0x00,
-    0x00, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x00,
-    0x1F, 0xC0, 0x7F, 0xC0, 0x04, 0x0F, 0xE0, 0x2F, 0xF0, 0xC3, 0xEF, 0xF0, 0x0B, 0xFE, 0xF4, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFC, 0x3F, 0xFC, 0x00, 0xFF, 0xFD, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x10,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x69, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0xFC, 0x00, 0x15, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xF0, 0x3F, 0xBF, 0x40, 0x00, 0x1F, 0xAF, 0xC2, 0xF6, 0xFC, 0x00, 0x00, 0x7D, 0x7F,
-    0x0F, 0xCF, 0xF0, 0x00, 0x02, 0xF5, 0xFD, 0x7D, 0x3F, 0x80, 0x00, 0x0F, 0xC3, 0xF7, 0xF1, 0xFD,
-    0x00, 0x00, 0x3F, 0x0F, 0xFF, 0x47, 0xF4, 0x00, 0x01, 0xF8, 0x3F, 0xFC, 0x2F, 0xC0, 0x00, 0x0B,
-    0xD0, 0xFF, 0xD0, 0xFF, 0x00, 0x00, 0x3F, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xF8,
-    0x0F, 0xE1, 0xC3, 0xEF, 0xD0, 0x3F, 0xC0, 0x3F, 0xEF, 0x0F, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0xF8,
-    0x3F, 0xF4, 0x03, 0xF4, 0x03, 0xFF, 0xC0, 0xFF, 0x40, 0x05, 0x40, 0x0F, 0xF4, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x64, 0x00, 0x05, 0x40, 0xBF, 0xFC, 0x00, 0xFF, 0x8F, 0xFF,
-    0xF0, 0x03, 0xFE, 0x2A, 0xFF, 0xC0, 0x0F, 0xF4, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x02,
-    0xFF, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x55, 0x7F, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xAA, 0xBF, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF0,
-    0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x93, 0xFE, 0x00, 0xBF, 0xEF, 0x8F, 0xF4, 0x02, 0xFF,
-    0xFD, 0x7F, 0xC0, 0x0B, 0xFF, 0xE2, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xEF,
-    0xFD, 0x02, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x0B, 0xFC, 0x3F, 0xD0,
-    0x02, 0xFF, 0x2F, 0xF0, 0x00, 0xBF, 0xCF, 0xFC, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF,
-    0x80, 0x07, 0xFC, 0x3F, 0xE0, 0x03, 0xFE, 0x0F, 0xFC, 0x02, 0xFF, 0x02, 0xFF, 0x42, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x64, 0x00, 0x69, 0x00, 0xBF, 0xF8, 0x1F, 0xFD, 0x0F, 0xFF, 0xE2, 0xFF, 0xFC, 0x2A,
-    0xFF, 0xAF, 0xFF, 0xF0, 0x02, 0xFE, 0xF8, 0xBF, 0xC0, 0x0F, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xFC,
-    0x0B, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFC,
-    0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x1F, 0xF0, 0xC3, 0xFE, 0x00, 0xBF, 0xEF, 0x4F, 0xF4, 0x03, 0xFF, 0xFC, 0x7F, 0xC0, 0x0B,
-    0xFF, 0xD2, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x64, 0x01,
-    0xA4, 0x00, 0x1F, 0xFF, 0x43, 0xFF, 0xC0, 0x0F, 0xFF, 0xD3, 0xFF, 0xF4, 0x02, 0xAF, 0xF7, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xF4, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x2F, 0xF0, 0x00, 0x7F, 0xF4, 0x0B,
-    0xFC, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F,
-    0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x07, 0xFD,
-    0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x14, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0x42, 0xF0, 0x0F, 0xF4, 0x00, 0x40, 0xBF, 0xC0, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x80, 0xFF, 0xC0, 0x1F, 0x43, 0xFF, 0xEB, 0xFD, 0x07, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x64, 0x00,
-    0x64, 0x00, 0x19, 0x00, 0xBF, 0xF4, 0x1F, 0xFC, 0x0B, 0xFF, 0x0F, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF,
-    0xFD, 0x2A, 0xFF, 0x6F, 0xFF, 0xDF, 0xFF, 0xF8, 0x02, 0xFE, 0xF8, 0xFF, 0xBD, 0x3F, 0xE0, 0x0F,
-    0xFF, 0x43, 0xFF, 0xD0, 0xFF, 0x40, 0x3F, 0xF8, 0x0F, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x7F,
-    0xF0, 0x1F, 0xF0, 0x0B, 0xFD, 0x02, 0xFF, 0x40, 0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFD,
-    0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xF0,
-    0x0B, 0xFC, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x3F, 0xE0, 0x0F, 0xF4, 0xA3, 0xFD, 0x00, 0xFF, 0x40,
-    0x3F, 0xEF, 0xCF, 0xF4, 0x07, 0xFC, 0x01, 0xFF, 0xFE, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFF, 0xF2,
-    0xFE, 0x00, 0xBF, 0x40, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x58, 0x00, 0x1A, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x01,
-    0xBF, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00,
-    0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80,
-    0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x03, 0xD0, 0x6F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFA, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0x47, 0xF4, 0x7F, 0xF0, 0x2F, 0xF0, 0x2F, 0xC0, 0xBF, 0xC0, 0xFF, 0x40,
-    0xBF, 0x00, 0xFF, 0x4B, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x3F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF8, 0xFF,
-    0x40, 0x3F, 0x80, 0x3F, 0xD3, 0xFD, 0x01, 0xFD, 0x00, 0xFF, 0x0F, 0xF8, 0x07, 0xF4, 0x0B, 0xFC,
-    0x3F, 0xF0, 0x2F, 0xC0, 0x3F, 0xD0, 0x7F, 0xD0, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0xE3, 0xFC, 0xBF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF,
-    0xA0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x18, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF9, 0x7F, 0x80, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x64, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0xFF, 0x01, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xD0, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0xBF, 0x18, 0x00, 0x01, 0xFF, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF3, 0xFE, 0x00, 0x03, 0xEF, 0xF0, 0xBF, 0xC6, 0x81,
-    0xFF, 0xF4, 0x1F, 0xFF, 0xF0, 0x7F, 0xF8, 0x03, 0xFF, 0xF4, 0x0F, 0xF8, 0x00, 0x7F, 0xE4, 0x00,
-    0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F,
-    0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF,
-    0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00,
-    0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF,
-    0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1E, 0x1F, 0xF6, 0xFC, 0xFF, 0xBE,
-    0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0B, 0xFE, 0x00, 0xBD, 0xBC, 0x00,
-    0x50, 0x00, 0x10, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x64, 0x00, 0x05, 0x42, 0xFF, 0xD0, 0x07, 0xFC, 0xBF, 0xFD, 0x00, 0xFF, 0x8A,
-    0xBF, 0xC0, 0x0F, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x07, 0xF8, 0x02,
-    0xFE, 0x00, 0xBF, 0x40, 0x7F, 0xD0, 0x0B, 0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xEF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF,
-    0x09, 0x00, 0x00, 0x1F, 0xFB, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x58, 0x00, 0x01, 0x50, 0x01, 0x50, 0x7F,
-    0xFC, 0x00, 0xFF, 0x40, 0xBF, 0x83, 0xFF, 0xF4, 0x07, 0xFC, 0x03, 0xFD, 0x0A, 0xBF, 0xD0, 0x1F,
-    0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x03, 0xFC, 0x03, 0xFD, 0x02, 0xFE,
-    0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF4, 0x00, 0xBF, 0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x03, 0xFC,
-    0x02, 0xFD, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0xBF, 0x80, 0xBF, 0xC0,
-    0x7F, 0xD0, 0x03, 0xFD, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xF4, 0x2F, 0xFC, 0x00,
-    0x7F, 0xC3, 0xFF, 0xC2, 0xFB, 0xF0, 0xE1, 0xFF, 0x7F, 0xFF, 0xBF, 0x5F, 0xFF, 0xC7, 0xFF, 0xF6,
-    0xFF, 0xF8, 0x7F, 0xFD, 0x1F, 0xFF, 0x47, 0xFF, 0x81, 0xFF, 0xE0, 0x2F, 0xF0, 0x0F, 0xF4, 0x03,
-    0xFD, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x58, 0x00, 0x01, 0x50, 0x01, 0x50,
-    0x1F, 0xFF, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0xC0, 0x3F, 0xD0, 0x2A, 0xFF,
-    0x40, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0xFF,
-    0x40, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x02, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x0B,
-    0xF8, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x0F, 0xF4, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x3F,
-    0xF4, 0x2F, 0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0xF0, 0xBE, 0xFC, 0x3C, 0x1F, 0xF7, 0xFF, 0xFB, 0xF6,
-    0xFE, 0xFC, 0x1F, 0xFF, 0xDB, 0xFF, 0xE2, 0xFF, 0xF4, 0x1F, 0xFF, 0x47, 0xFF, 0x81, 0xFF, 0xF0,
-    0x0B, 0xFC, 0x03, 0xFD, 0x00, 0xF9, 0xF0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xA5, 0x40, 0x14, 0x00, 0x7F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0xBA, 0xFF, 0x40, 0x3F, 0x00, 0x1F, 0xC0, 0x03, 0xF4,
-    0x0B, 0xF0, 0x00, 0x2F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xBF, 0xF8, 0x00, 0xBF, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0x0F, 0xFE, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x59,
-    0x00, 0x00, 0x00, 0x54, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0x02, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xEB, 0xF8, 0x00,
-    0xBF, 0x80, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xF4, 0x00, 0x7F, 0xFB, 0xFF, 0xC0, 0xFF, 0x40, 0x0B,
-    0xF8, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x2F, 0xD2, 0xFF, 0x00, 0x0F, 0xF0, 0x02, 0xFC,
-    0x2F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xC3, 0xFD, 0x28, 0x0F, 0xF4, 0x0B, 0xF8, 0x3F, 0xEF, 0xC0,
-    0xBF, 0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x0B, 0xFF, 0xD0,
-    0x02, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x2A, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xAF, 0xFD, 0x0B, 0xF8, 0x03, 0xFE, 0x0F, 0xF4, 0x01, 0xFE, 0x0F, 0xF0, 0x01, 0xFE, 0x0F, 0xF0,
-    0x02, 0xFD, 0x0F, 0xF4, 0x07, 0xFC, 0x0B, 0xFF, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xF8, 0x02, 0xFE, 0xAF, 0xFC, 0x03, 0xF0, 0x03, 0xFE, 0x02, 0xC0, 0x02, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x1A,
-    0xAB, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0x00, 0x0F, 0xF4, 0x3F, 0x80,
-    0x2F, 0xF0, 0x3F, 0xFA, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x6A, 0x40, 0x0B, 0xFF, 0xC0, 0x01, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xD2, 0xAF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x02, 0xFE, 0x02, 0xFF, 0x43,
-    0xFF, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xD0, 0xFF, 0x80, 0x0F, 0xF4, 0x1F, 0xF0,
-    0x3F, 0xC0, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xC0, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0xFF, 0x40, 0x0F, 0xF4, 0x1F, 0xF0, 0x3F,
-    0xD0, 0x07, 0xFC, 0x0B, 0xFC, 0x0F, 0xF8, 0x03, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x97, 0xFE, 0x00,
-    0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFF, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x5F, 0xF8, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x07, 0xF8, 0x00, 0x2F, 0xE0, 0x2F, 0xD0, 0x00,
-    0x7F, 0xE0, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xF9,
-    0xBF, 0x40, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0xEB, 0xAF, 0xE0, 0x3F, 0xEF,
-    0xBF, 0xFF, 0x01, 0xFF, 0xFC, 0xFF, 0xF0, 0x07, 0xFF, 0xD2, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x40,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xFE, 0x6F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0xFE, 0x01, 0xFE,
-    0x0B, 0xF0, 0x0F, 0xF0, 0x3F, 0x80, 0xBF, 0x41, 0xFD, 0x1F, 0xF4, 0x0B, 0xFB, 0xFF, 0x40, 0x3F,
-    0xFF, 0xE0, 0x00, 0xFF, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x09, 0x0F, 0xF4, 0x01, 0xFC, 0x3F, 0xF5,
-    0x7F, 0xE0, 0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0xC0, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0xBF,
-    0xC7, 0xFC, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x02, 0xFE, 0x6F, 0xF0, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0xBF, 0x00, 0xFF,
-    0x00, 0x3F, 0x80, 0xBF, 0x40, 0x1F, 0xD1, 0xFF, 0x40, 0x0B, 0xFB, 0xFF, 0x40, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0x0F, 0xF4, 0x01, 0xFC, 0x03, 0xFF,
-    0x57, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xAB, 0xFF, 0xAF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0xAB, 0xFE, 0xAA, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x01,
-    0x00, 0x00, 0xFF, 0x07, 0xFE, 0x00, 0x0F, 0xF1, 0xFF, 0xF8, 0x01, 0xFE, 0x7F, 0xFF, 0xC0, 0x2F,
-    0xEF, 0xDF, 0xFC, 0x03, 0xFF, 0xE0, 0xBF, 0xC0, 0x3F, 0xFC, 0x07, 0xFC, 0x07, 0xFF, 0x00, 0x7F,
-    0xC0, 0xBF, 0xE0, 0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x0B, 0xFC, 0x1F, 0xF4,
-    0x00, 0xBF, 0xC1, 0xFF, 0x00, 0x0F, 0xF8, 0x2F, 0xF0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F, 0xF0,
-    0x3F, 0xD0, 0x02, 0xFF, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2C, 0x07, 0xFC, 0x00, 0x07, 0xFA, 0xFF, 0x40, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0xBF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x0B, 0xFE, 0xBF, 0xF0, 0x0F, 0xD0, 0x0F, 0xF0, 0x06, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x80, 0x7F, 0xC0, 0x07,
-    0xD0, 0x7F, 0xD0, 0x2F, 0xD0, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0x00, 0xBC, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xF0, 0x14, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xEA, 0xA8,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x10, 0x3F, 0xF0, 0x01, 0xF4, 0x2F, 0xF9, 0x5F,
-    0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x80, 0x2F, 0xEA, 0xFE,
-    0x01, 0xFF, 0x00, 0xB0, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0x00,
-    0x3F, 0xE0, 0xBF, 0x00, 0xBF, 0x83, 0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x3F,
-    0xF0, 0x0B, 0xFF, 0x00, 0xBF, 0xD0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x02,
-    0xFF, 0xF0, 0xBF, 0xFF, 0x0A, 0xBF, 0xE0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xBF,
-    0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x24,
-    0x7F, 0xEF, 0x8B, 0xFF, 0xF4, 0xBF, 0xFE, 0x03, 0xFE, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x0F, 0xD0, 0xFF, 0x4B, 0xF8, 0x7F, 0xC3, 0xFD, 0x0F, 0xD0, 0xFE, 0x00, 0x40, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0,
-    0x02, 0xAF, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0,
-    0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0,
-    0x00, 0x1F, 0xF0, 0x90, 0x07, 0xFE, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xF9,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x04, 0x01, 0xFF, 0x00, 0x00, 0xF8,
-    0x1F, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA5, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x03, 0xF4,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0xBF, 0xFB, 0xFF, 0x80, 0x00, 0x7F, 0x03, 0xFC, 0x01,
-    0xFF, 0x00, 0x03, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x40,
-    0xFE, 0x01, 0xFF, 0x00, 0x7F, 0x83, 0xEF, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xFF, 0x80, 0x0F,
-    0xFE, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x10, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x64, 0x00, 0x15, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0xAB, 0xFF, 0x00, 0xFF, 0x40, 0x00,
-    0x02, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFE,
-    0x00, 0x00, 0x07, 0xFD, 0x57, 0xFE, 0xBF, 0x90, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xAF, 0xFC, 0x0F, 0xFA, 0xAF, 0xF8, 0x03, 0xFD, 0x1F, 0xF0, 0x0B, 0xF4, 0x02, 0xFD,
-    0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFD, 0x2F, 0xF0, 0x0F, 0xF4, 0x03, 0xFC, 0x3F, 0xE0, 0x0F, 0xF8,
-    0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xFF, 0xBF, 0xF0, 0x7F, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0x80,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x2A, 0xFF, 0xEB, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xAF, 0xFA, 0xA9, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xF0, 0x00, 0x3F,
-    0xC7, 0xFF, 0xF0, 0x01, 0xFE, 0x7F, 0xFF, 0xC0, 0x0B, 0xF7, 0xF6, 0xFF, 0x00, 0x3F, 0xFE, 0x07,
-    0xFC, 0x00, 0xFF, 0xF0, 0x2F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF8, 0x03, 0xFC, 0x00,
-    0xFF, 0xC0, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x03, 0xFD, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF0, 0x92, 0xFF, 0x00, 0x7F, 0xEF, 0xCF, 0xF8, 0x02, 0xFF, 0xFE, 0x3F, 0xD0, 0x07, 0xFF,
-    0xE1, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0xA0, 0x2F, 0xFE, 0x00, 0xBF, 0xCF, 0xFF, 0xE0, 0x3F, 0xFC, 0xAB, 0xFE, 0x0F, 0xFF, 0xC0, 0x2F,
-    0xD3, 0xFE, 0x14, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x07, 0xF7, 0xF0, 0x00,
-    0x00, 0xBF, 0xBF, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xF2,
-    0xFD, 0x00, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x2F, 0xE0, 0xFF, 0x43, 0x83, 0xFE, 0x0B, 0xFE, 0xFC,
-    0x3F, 0xD0, 0x3F, 0xFF, 0x47, 0xFC, 0x02, 0xFF, 0xE0, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF,
-    0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00,
-    0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00,
-    0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x0B, 0xC0, 0x07, 0x40, 0x00, 0x01, 0xFC, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x01, 0xA0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xD0,
-    0x01, 0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x1B, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x02, 0xFE,
-    0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x3F,
-    0xC0, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF7,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3D, 0x06, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF,
-    0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00,
-    0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00,
-    0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x2D, 0x7F, 0x80, 0x00, 0x50,
-    0x7C, 0x04, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xFE, 0x40,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x15, 0x57, 0xFF, 0x95, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0xFD, 0x6F, 0xF9, 0x5F, 0xD0, 0xFD, 0x0B, 0xFD, 0x03, 0xF0,
-    0x3F, 0x02, 0xFF, 0x00, 0xFC, 0x07, 0x80, 0xFF, 0xC0, 0x3C, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x0F, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0,
-    0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x3F, 0xE0, 0x02, 0xFF, 0x40, 0x1F, 0xF4, 0x02, 0xFF, 0xC0, 0x6F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x68, 0x00, 0x00, 0x2F, 0xFE, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x2F, 0xFF, 0x80,
-    0x00, 0xAB, 0xFE, 0xBF, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0xF8, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0x6F, 0xE0, 0x0B,
-    0xFE, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFC, 0x02, 0xFF, 0xEF, 0xFD, 0x0F, 0xF8, 0x03, 0xFC, 0x02,
-    0xFE, 0x1F, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x2F, 0xF0, 0x07,
-    0xFC, 0x01, 0xFD, 0x3F, 0xE0, 0x03, 0xFC, 0x07, 0xFC, 0x3F, 0xD0, 0x03, 0xFF, 0xBF, 0xF4, 0x7F,
-    0xC0, 0x01, 0xFF, 0xFF, 0xD0, 0xBF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0xF0, 0x00,
-    0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFC, 0x00,
-    0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0xD5, 0xBF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xAF, 0xFD, 0x02, 0xFF, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x2F,
-    0xF0, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xC0, 0x01, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xAA, 0xAF, 0xF4, 0xFF, 0x40, 0x03, 0xFC, 0x3F, 0xD0, 0x02, 0xFE, 0x0F, 0xF8,
-    0x01, 0xFF, 0x02, 0xFF, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x1F, 0xFF,
-    0xFE, 0x00, 0x01, 0xFF, 0xCB, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xF5, 0xFF, 0xFF, 0x40, 0x01, 0xFF,
-    0xFD, 0x0B, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC2, 0x40, 0x3F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xCB, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x19, 0x07, 0xFF, 0xD0, 0x00, 0x7F, 0xD3,
-    0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0xAB, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0xFF, 0xC0, 0x3F, 0xE6, 0x00,
-    0x3F, 0xF0, 0x2F, 0xD0, 0x00, 0x0F, 0xFC, 0x0F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0x00,
-    0xBF, 0x87, 0xF0, 0x00, 0x00, 0x2F, 0xE3, 0xF4, 0x00, 0x00, 0x07, 0xF9, 0xF8, 0x00, 0x00, 0x01,
-    0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD6, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0x00,
-    0x0B, 0xFC, 0x0B, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC2, 0xFE, 0x1F, 0xF8, 0x00, 0x00, 0x0F,
-    0xFC, 0xFF, 0x42, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF,
-    0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00,
-    0x02, 0xF0, 0x01, 0xD0, 0x00, 0x07, 0xF0, 0x03, 0xD0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F,
-    0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0,
-    0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07,
-    0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0,
-    0x1F, 0xFE, 0x04, 0x1F, 0xF0, 0x7E, 0xFE, 0x2D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFD, 0x1F, 0xFF, 0xF0,
-    0xFF, 0xFD, 0x1F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0B, 0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x50, 0x00, 0x13,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0x5F, 0xFD, 0x54, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFE, 0xBF, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x07, 0xFD,
-    0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x2F, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x1B, 0xFF, 0x40, 0x00, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFD, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xEB,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xAF, 0xFD, 0x2F, 0xE0, 0x0F, 0xF8, 0xFF, 0x40, 0x1F,
-    0xE3, 0xFC, 0x00, 0x7F, 0x8F, 0xF0, 0x02, 0xFD, 0x3F, 0xD0, 0x1F, 0xF0, 0xBF, 0xFB, 0xFF, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x65, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x2F,
-    0xF0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF0, 0x00,
-    0x1F, 0xF8, 0xF0, 0xFF, 0x80, 0x00, 0x7F, 0xD3, 0xE3, 0xFD, 0x00, 0x02, 0xFF, 0x0B, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFC, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x0B, 0xFF, 0xA4, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x03, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x64, 0x01, 0xA4, 0x00, 0x1F, 0xFF, 0x43, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xD3, 0xFF, 0xF4, 0x02, 0xAF, 0xF7, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF4, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF0, 0x2F, 0xF0, 0x00, 0x7F, 0xF4, 0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-    0x7F, 0xCB, 0x87, 0xF8, 0x00, 0x2F, 0xE2, 0xF2, 0xFD, 0x00, 0x0F, 0xF4, 0x3E, 0xFE, 0x00, 0x03,
-    0xFE, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xFB, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x14, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0x00, 0x01, 0xFF,
-    0x00, 0x03, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xD5,
-    0x55, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0xBF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFA,
-    0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x04, 0x2F, 0xF0, 0x00, 0x07, 0x9F, 0xF4, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF1, 0x57, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x0B,
-    0xFD, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xC0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x15, 0xFF, 0xE5, 0x50, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xAF, 0xFE, 0xA8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x06, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xAF, 0xFC, 0x0F, 0x80, 0x0F, 0xF0, 0x10, 0x00, 0x3F, 0xC0, 0x07, 0x03, 0xFE,
-    0x00, 0x3E, 0x7F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xBF, 0xFD, 0x00, 0x0B,
-    0xFE, 0xBC, 0x00, 0x3F, 0xD0, 0xF0, 0x41, 0xFF, 0x00, 0x0B, 0x87, 0xFD, 0x01, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xF9, 0x56, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xC0, 0x00, 0x2F, 0xF0, 0x02, 0xFC, 0x00,
-    0x03, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xE5, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFE, 0x6F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x03, 0xFE, 0x00, 0x0B,
-    0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0xF8, 0x00,
-    0xFF, 0x82, 0xFF, 0xFF, 0xE0, 0x1F, 0xF4, 0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0D, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFA,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x06,
-    0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x1B,
-    0xFF, 0x56, 0xFC, 0x03, 0xFD, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0xF4, 0x07, 0xFC, 0x00, 0x90, 0x07,
-    0xF8, 0x00, 0x00, 0x0B, 0xF9, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xF5, 0x7F, 0xF4, 0x2F, 0xE0, 0x0F, 0xF8, 0x3F, 0xD0, 0x07, 0xFC, 0x3F, 0xD0, 0x03, 0xFC, 0x7F,
-    0xC0, 0x03, 0xFC, 0xBF, 0xC0, 0x03, 0xFC, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0x40, 0x3F, 0xC0, 0x0F, 0xE5, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xF4, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0xFD, 0x01, 0xFF, 0xF9, 0x01, 0xFF, 0xFC,
-    0x00, 0x0F, 0xBF, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0xBF, 0x00, 0x01, 0x03, 0xF4, 0x03, 0xFD, 0x00,
-    0xFF, 0x01, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x7F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x0B, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xFD, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x6F, 0xF6, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xC0, 0x3F, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x2F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x0F, 0xF4,
-    0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xFF, 0xE0,
-    0x06, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xF8, 0x00,
-    0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x06, 0x90, 0x00, 0x54, 0x00,
-    0x1A, 0x00, 0x07, 0xFF, 0xC0, 0x3F, 0x80, 0x2F, 0xFC, 0x01, 0xFF, 0xFD, 0x03, 0xF4, 0x0B, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xF0, 0x7F, 0x02, 0xFF, 0xFC, 0x0B, 0xE6, 0xFF, 0x0B, 0xF0, 0x7F, 0x42, 0x80,
-    0x74, 0x0F, 0xF0, 0xFE, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x3F, 0xD3, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC7,
-    0xFE, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xBF, 0x9F, 0xD0, 0x04, 0x01, 0x00, 0xBE, 0x0F, 0xF1,
-    0xFF, 0x02, 0xF0, 0x3D, 0x7F, 0xC0, 0xFD, 0x0F, 0xFE, 0xFE, 0x0B, 0xFF, 0xF0, 0x1F, 0xC0, 0xFF,
-    0xFF, 0xD0, 0xBF, 0xFD, 0x02, 0xFC, 0x0B, 0xFF, 0xBD, 0x07, 0xFE, 0x00, 0x3F, 0x40, 0x2F, 0xE7,
-    0xC0, 0x05, 0x00, 0x01, 0x00, 0x00, 0x10, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x7F, 0xF0, 0x03, 0xF4,
-    0x00, 0xBF, 0xD0, 0x0F, 0xC0, 0x02, 0xFF, 0x40, 0x2D, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x15, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x08, 0x00, 0x01, 0xFF, 0x81, 0xF4, 0x00, 0x0B, 0xFD,
-    0x0F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xF4, 0x1B, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x79, 0xBE, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x02, 0xFE, 0x5F, 0xFC, 0x03, 0xF0, 0x03, 0xFC, 0x01, 0x80,
-    0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x0A, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0x00,
-    0x0F, 0xF4, 0x3F, 0x80, 0x2F, 0xF0, 0x3F, 0xFB, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0x0B, 0xC0, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xFB, 0xE0,
-    0x00, 0x07, 0xFD, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF6, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x83,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x03,
-    0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x0A, 0x02, 0xFF, 0xE0, 0x0B, 0xFC, 0xFF, 0xFE, 0x03, 0xFF, 0xCA, 0xBF, 0xE0,
-    0xFF, 0xFC, 0x02, 0xFD, 0x3F, 0xE1, 0x40, 0x3F, 0xCB, 0xF0, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00,
-    0x7F, 0x7F, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x01, 0xFF, 0x2F, 0xD0, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x38, 0x3F,
-    0xE0, 0xBF, 0xEF, 0xC3, 0xFD, 0x03, 0xFF, 0xF8, 0x7F, 0xC0, 0x2F, 0xFF, 0x8B, 0xF8, 0x00, 0xFE,
-    0xF8, 0x00, 0x00, 0x01, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0x40, 0x03, 0xFF, 0xBC, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0xF4, 0x04, 0x00, 0x02, 0xFF, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xFE, 0x3C, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x3C, 0x7F, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x78, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0xB6, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0xFB,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0xD2, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xF2, 0xD1, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE2, 0x80, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x01, 0x64, 0x00, 0x00, 0x64, 0x2F, 0xFE, 0x00, 0x03, 0xFD, 0xFF, 0xFE, 0x00, 0x0F, 0xFD, 0xAB,
-    0xFE, 0x00, 0x3F, 0xFC, 0x02, 0xFD, 0x00, 0xBF, 0x18, 0x03, 0xFD, 0x51, 0xF8, 0x00, 0x03, 0xFC,
-    0xF3, 0xE0, 0x00, 0x07, 0xFC, 0xEB, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF7, 0xDF, 0xD0, 0x00, 0x1F, 0xF3, 0x8F, 0xE0, 0x00, 0x1F, 0xF7, 0x8B, 0xF0,
-    0x00, 0x2F, 0xE1, 0x07, 0xF8, 0x2C, 0x3F, 0xD0, 0x03, 0xFE, 0xFC, 0x3F, 0xD0, 0x02, 0xFF, 0xF8,
-    0x7F, 0xC0, 0x00, 0xFF, 0xF0, 0xBF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFE,
-    0xF0, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0x41, 0x40, 0x07, 0xFF, 0xFF, 0x47, 0xF4, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x57, 0xFF, 0x52, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF6, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0x43, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0,
-    0x03, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x40, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x57, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x06, 0x42, 0xFF, 0xFF, 0x82, 0xFE, 0x2F, 0xFF, 0xF4, 0xFF,
-    0xE0, 0x0F, 0xF0, 0x3F, 0xFD, 0x00, 0xFE, 0x0F, 0xF4, 0x80, 0x1F, 0xD2, 0xF8, 0x00, 0x02, 0xFC,
-    0x7E, 0x00, 0x00, 0x3F, 0xCF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0xFF, 0x47,
-    0xFC, 0x1C, 0x1F, 0xF0, 0x3F, 0xFB, 0xD2, 0xFF, 0x02, 0xFF, 0xFC, 0x3F, 0xF0, 0x0F, 0xFF, 0x03,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFD, 0x7F, 0x51, 0xFF, 0x80, 0x0F, 0xFB, 0xF2, 0xFC, 0x0B, 0xFD, 0x00, 0xFF,
-    0x01, 0x0B, 0xE0, 0x2F, 0xF0, 0x0B, 0xF4, 0x00, 0x2F, 0x00, 0xFF, 0xC0, 0x3F, 0x40, 0x00, 0x28,
-    0x03, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xD1,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xE6, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xA9, 0x54, 0x00, 0x19, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xE0, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFC, 0xBD, 0x5B, 0xF0, 0x7F, 0xFE, 0x3F, 0x03, 0xFC, 0x3F, 0xD2, 0x0F, 0xD0, 0xFE, 0x3F,
-    0xC0, 0x02, 0xF8, 0x7F, 0x6F, 0x80, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xCF, 0xF0,
-    0x00, 0x00, 0x3F, 0xE2, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x7F, 0xC1, 0xD0, 0x07, 0xFC, 0x0F, 0xFE,
-    0xF8, 0x01, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x00,
-    0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x64, 0x00, 0x05, 0x40, 0x2F, 0xFF, 0x00, 0x3F,
-    0xE0, 0xFF, 0xFF, 0x00, 0x3F, 0xE0, 0xAB, 0xFF, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0x00, 0x7F, 0xC0,
-    0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x55, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFA, 0xAB, 0xFE, 0x00, 0x1F, 0xF0,
-    0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x2F, 0xF0, 0x07, 0xFC, 0x3C, 0x3F, 0xE0, 0x0B,
-    0xFE, 0xFC, 0x3F, 0xD0, 0x0B, 0xFF, 0xF4, 0x7F, 0xC0, 0x0B, 0xFF, 0xF0, 0xBF, 0x80, 0x03, 0xF9,
-    0xF0, 0x00, 0x00, 0x00, 0x42, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x0F, 0xD0,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x01,
-    0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x06, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x05, 0x55, 0x40, 0x0B, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x4F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xF2, 0xAF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0x00, 0xFF, 0x40,
-    0x2F, 0xF0, 0x7F, 0x40, 0x3F, 0xD0, 0x0F, 0xF8, 0x7F, 0xC0, 0x1F, 0xF5, 0x57, 0xFD, 0x06, 0x40,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xBF,
-    0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0B,
-    0xFC, 0x01, 0xFF, 0x09, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xEF, 0x80, 0x00, 0xFF, 0x40, 0x2F, 0xFF,
-    0xD0, 0x00, 0x7F, 0xC0, 0x0B, 0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x55, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xE5, 0xA4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFE, 0x6F, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x1F, 0xFD, 0x00, 0x2F, 0xF4, 0x00,
-    0x2F, 0xF4, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x7F,
-    0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x07,
-    0xFF, 0xF4, 0x02, 0xFF, 0xF9, 0x00, 0x7F, 0xD2, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x0B, 0xFC,
-    0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xE9, 0x00, 0x00, 0x01, 0x64, 0x00, 0x69, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x7F, 0xF8, 0x00,
-    0x00, 0xFF, 0xFE, 0x2F, 0xFF, 0xC0, 0x00, 0x0A, 0xBF, 0xEB, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFE,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFA, 0xFE, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x02, 0xFF, 0x41, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xE0,
-    0x0B, 0xFC, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xC2, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x3F,
-    0xE0, 0x0B, 0xFC, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x7F, 0xC0, 0x0F, 0xF8,
-    0x00, 0x3F, 0xCB, 0xF8, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x01, 0xA4, 0x00, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xF8,
-    0x01, 0xFF, 0xFF, 0xF0, 0x0B, 0xFE, 0x00, 0x7F, 0xE6, 0xFF, 0x41, 0xFF, 0xC0, 0x0F, 0xF0, 0x0B,
-    0xF8, 0x3F, 0xF4, 0x02, 0xFE, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x7F, 0xE0,
-    0x07, 0xFC, 0x00, 0xBF, 0xCB, 0xFD, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0xFF, 0xC0, 0x0F, 0xF4, 0x00,
-    0xFF, 0x4F, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0xFF, 0xC0, 0x0F, 0xF4, 0x01, 0xFF, 0x0F, 0xFC,
-    0x00, 0xFF, 0x40, 0x3F, 0xD0, 0xFF, 0xD0, 0x0F, 0xF8, 0x0B, 0xFC, 0x0B, 0xFE, 0x00, 0xBF, 0xC0,
-    0xFF, 0x40, 0x7F, 0xF0, 0x03, 0xFD, 0x3F, 0xE0, 0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0x40, 0xFF, 0xFE, 0x00, 0x50, 0xBF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFE, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x9F, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x14, 0x00,
-    0x03, 0xFD, 0x02, 0xFF, 0xD0, 0x03, 0xFD, 0x03, 0xFF, 0xFD, 0x02, 0xFD, 0x02, 0xFD, 0xBF, 0xC0,
-    0xFF, 0x01, 0xFC, 0x0F, 0xF0, 0x7F, 0x80, 0xFE, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0x40, 0xFF, 0x0F,
-    0xF0, 0x1F, 0xC0, 0x3F, 0xC3, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0xFF, 0x01, 0xFC, 0x0B, 0xF0, 0x3F,
-    0xD0, 0x3F, 0x43, 0xF4, 0x0B, 0xF8, 0x0F, 0xF3, 0xF8, 0x01, 0xFF, 0x41, 0xFF, 0xF8, 0x00, 0x3F,
-    0xF9, 0x7F, 0xF8, 0x05, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xEF, 0xFF, 0x80, 0x00,
-    0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x41, 0xFF, 0x00, 0x7F,
-    0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x03, 0xF0, 0x1F, 0xF8,
-    0x00, 0x00, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x08, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x6F, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0x9B, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0x42, 0xF0, 0x0F, 0xF4, 0x00, 0x40, 0xBF, 0xC0,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x80, 0xFF, 0xC0, 0x1F, 0x43, 0xFF, 0xEB, 0xFD, 0x07,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x08, 0x2F, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9, 0x5F, 0xFD, 0x57, 0xF8, 0xBF, 0x00, 0xFF, 0xC0, 0x3F,
-    0x4B, 0xE0, 0x1F, 0xF8, 0x03, 0xF0, 0xBD, 0x02, 0xFF, 0x40, 0x7E, 0x02, 0x80, 0x3F, 0xF0, 0x06,
-    0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x64, 0x00, 0x19,
-    0x00, 0x2F, 0xFD, 0x07, 0xFF, 0x02, 0xFF, 0xC0, 0xFF, 0xFE, 0x2F, 0xFF, 0x0F, 0xFF, 0xD0, 0xAB,
-    0xFD, 0xBF, 0xFF, 0x7F, 0xFF, 0xE0, 0x02, 0xFE, 0xF8, 0xFF, 0xBD, 0x3F, 0xD0, 0x03, 0xFF, 0xD0,
-    0xFF, 0xF4, 0x3F, 0xD0, 0x03, 0xFF, 0x80, 0xFF, 0xD0, 0x7F, 0xC0, 0x07, 0xFF, 0x01, 0xFF, 0xC0,
-    0x7F, 0xC0, 0x0B, 0xFD, 0x02, 0xFF, 0x40, 0xFF, 0x80, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0x40,
-    0x0F, 0xF8, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x1F, 0xF0,
-    0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x2F, 0xE0, 0x0F, 0xF8, 0x03, 0xFD, 0x3D, 0x3F, 0xD0, 0x0F, 0xF4,
-    0x03, 0xFF, 0xBD, 0x3F, 0xD0, 0x1F, 0xF0, 0x07, 0xFF, 0xFC, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFF,
-    0xF8, 0xBF, 0x80, 0x2F, 0xD0, 0x03, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xE0, 0x7F, 0xFF, 0xE2, 0xFF, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0x80,
-    0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFC, 0x02, 0xFD,
-    0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xCF,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x60,
-    0x00, 0x68, 0x0B, 0xFF, 0x00, 0xFF, 0xD7, 0xFF, 0xE0, 0x1F, 0xF9, 0xFF, 0xFC, 0x03, 0xFF, 0x01,
-    0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x2F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x02, 0xFE, 0x03, 0xFC,
-    0x00, 0x7F, 0x81, 0xFD, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0xFF, 0x3F,
-    0x80, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xE2, 0xFF, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0xFF,
-    0xC0, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xCF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x56, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x60, 0x00, 0x68, 0x0B, 0xFF, 0x00, 0xFF, 0xD7, 0xFF, 0xE0, 0x1F, 0xF9, 0xFF,
-    0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x2F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0,
-    0x02, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x81, 0xFD, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x03, 0xFC, 0x7F,
-    0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x54, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFD, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0,
-    0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x8B, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x90, 0x07, 0xFF, 0xE8, 0x00, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x64, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0xFF, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0xD0, 0xFF,
-    0xF8, 0x00, 0x0F, 0xF8, 0xBF, 0x18, 0x00, 0x01, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xF3, 0xFE, 0x1E, 0x03, 0xEF, 0xF0, 0xBF, 0xEF, 0x81, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0,
-    0x7F, 0xF8, 0x03, 0xFF, 0xF0, 0x0F, 0xF8, 0x00, 0x7F, 0xBC, 0x00, 0x50, 0x00, 0x01, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFE, 0x00, 0xFC, 0x3F, 0xE1, 0xFC, 0x03, 0xFF, 0x00, 0x1F, 0xC3,
-    0xFD, 0x1F, 0x80, 0x3F, 0xE0, 0x01, 0xF4, 0x3F, 0xC1, 0xF4, 0x07, 0xFE, 0x00, 0x0F, 0x07, 0xFC,
-    0x2E, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x00, 0x00, 0x02, 0xAA, 0xAA, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF,
-    0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF,
-    0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00,
-    0x1F, 0xF0, 0x7E, 0xFF, 0x1E, 0x1F, 0xF6, 0xFC, 0xFF, 0xBE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xC0, 0xFF, 0xFC, 0x0B, 0xFE, 0x00, 0xBD, 0xBC, 0x00, 0x50, 0x00, 0x10, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x7F, 0xFF, 0xF4, 0x7F,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD7, 0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x01, 0xFF, 0x40,
-    0x02, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4, 0x00,
-    0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x69, 0x4F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x64, 0x00, 0x05, 0x40, 0xBF, 0xF4,
-    0x01, 0xFF, 0x0B, 0xFF, 0xD0, 0x0F, 0xF8, 0x2A, 0xFF, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x01, 0xFF,
-    0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x02, 0xFD, 0x01, 0xFF, 0x40, 0x0B,
-    0xF8, 0x0F, 0xFC, 0x00, 0x2F, 0xFB, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xE3,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xC0, 0x00, 0x01, 0xFF, 0xBF,
-    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x9F, 0x00, 0x00,
-    0x00, 0x10, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF8, 0x7F, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC,
-    0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x2D, 0x0F, 0xFC, 0x00,
-    0x1F, 0xF8, 0x3D, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x3C, 0x2F, 0xF4, 0x00, 0x0F, 0xFD, 0x7C, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xF4, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE1, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x64, 0x00, 0x01, 0x40, 0xBF,
-    0xF4, 0x00, 0xFF, 0x4B, 0xFF, 0xD0, 0x07, 0xFC, 0x2A, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00,
-    0xFF, 0x40, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x45, 0x1F, 0xF0, 0x02, 0xFD, 0x38, 0xBF, 0xC0,
-    0x0B, 0xF5, 0xE3, 0xFE, 0x00, 0x2F, 0xFB, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xF6, 0xFF, 0x00, 0x00, 0x03, 0xCB, 0xF8, 0x00, 0x00, 0x0E, 0x3F, 0xE1, 0x80, 0x00, 0x74, 0xFF,
-    0xEF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x1A, 0xA4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xEA, 0xFF, 0xF0, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x7F,
-    0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x06, 0xFF, 0xF8,
-    0x07, 0xFF, 0xF8, 0x2F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x29, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x00, 0x0F,
-    0xF1, 0xFF, 0xFC, 0x00, 0x3F, 0xDF, 0xFF, 0xF4, 0x01, 0xFE, 0xFD, 0x3F, 0xD0, 0x0B, 0xFF, 0xC0,
-    0xFF, 0x00, 0x3F, 0xFC, 0x07, 0xFC, 0x00, 0xFF, 0xD0, 0x2F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x40,
-    0x2F, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xF4,
-    0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x92, 0xFF, 0x00, 0x7F, 0xEF, 0xCF, 0xF8, 0x02, 0xFF,
-    0xFE, 0x3F, 0xD0, 0x07, 0xFF, 0xE1, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0x40, 0x2F, 0xFD, 0x07, 0xFF,
-    0xC1, 0xFC, 0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0x41, 0xFF, 0x80, 0x00, 0xFF, 0xCB, 0xF0, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFC, 0xFF, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xCB, 0xF0, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF8, 0x7F, 0xEF, 0xFD, 0x55, 0x56, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xAA, 0xAA, 0xAA, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x02, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xE6, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xE6, 0xFF, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x2D, 0x0F, 0xE0, 0x1F, 0xE3,
-    0xF0, 0xBF, 0x00, 0xFF, 0x1F, 0x83, 0xF8, 0x0B, 0xF4, 0x7E, 0x2F, 0xD1, 0xFF, 0x41, 0xFD, 0xFF,
-    0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x90, 0x00, 0xFF, 0x40, 0x1F, 0x80, 0x03, 0xFF, 0x57, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0x40, 0x2F, 0xFD, 0x07, 0xFF, 0xC1, 0xFC,
-    0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0x41, 0xFF, 0x80, 0x00, 0xFF, 0xCB, 0xF0, 0x3F, 0xF0, 0x00,
-    0x0F, 0xFC, 0xFF, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xCB, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x7F,
-    0xEF, 0xFD, 0x55, 0x56, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xAA, 0xAA, 0xAA, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x02, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xC0,
-    0x00, 0x0F, 0xFF, 0xE6, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xE6,
-    0xFF, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x2D, 0x0F, 0xE0, 0x1F, 0xE3, 0xF0, 0xBF, 0x00, 0xFF, 0x1F,
-    0x83, 0xF8, 0x0B, 0xF4, 0x7E, 0x2F, 0xD1, 0xFF, 0x41, 0xFD, 0xFF, 0xBF, 0xF4, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x90, 0x00, 0xFF, 0x40, 0x1F,
-    0x80, 0x03, 0xFF, 0x57, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x9B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xFC,
-    0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0x00,
-    0x03, 0xEF, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xEF, 0x80, 0x00, 0x40, 0xFC, 0x00, 0xFF, 0x40, 0x3F,
-    0xC0, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F,
-    0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x43, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x9F, 0xF9, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83,
-    0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x1F, 0xF0, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x0B, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFD, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0xF8, 0x01,
-    0xFF, 0xE4, 0x01, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x2F,
-    0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x05, 0x40, 0x01, 0xA0, 0x00, 0x7F, 0xFC,
-    0x03, 0xF8, 0x02, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0, 0x3F, 0x40, 0xBF, 0xFD, 0x07, 0xFF, 0xFF, 0x07,
-    0xF0, 0x2F, 0xFF, 0xC0, 0xBE, 0x6F, 0xF0, 0xBF, 0x07, 0xF4, 0x28, 0x07, 0x40, 0xFF, 0x0F, 0xE0,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCB, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF3, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0xEF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x4B, 0xF9, 0xFD, 0x00, 0x40, 0x10, 0x0B, 0xE0, 0xFF, 0x1F, 0xF0, 0x2E, 0x03, 0xD7,
-    0xFC, 0x0F, 0xD0, 0xFF, 0xEF, 0xE0, 0xBF, 0xFF, 0x01, 0xFC, 0x0F, 0xFF, 0xFC, 0x0B, 0xFF, 0xD0,
-    0x2F, 0xC0, 0x7F, 0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xF4, 0x02, 0xFF, 0x80, 0x00, 0x50, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0x80, 0x0F, 0xFE, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0x41, 0x40, 0x00, 0x2F, 0xF0,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xD5, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0xBF,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x2F, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFE,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xAF, 0xFD, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x0A, 0x02, 0xFF, 0xE0, 0x07, 0xFC, 0xFF,
-    0xFF, 0x01, 0xFF, 0xCA, 0xBF, 0xE0, 0x3F, 0xFC, 0x02, 0xFE, 0x0B, 0xE1, 0x40, 0x3F, 0xD1, 0xFC,
-    0x00, 0x03, 0xFC, 0x3F, 0x00, 0x00, 0x7F, 0xC3, 0xE0, 0x00, 0x0B, 0xFD, 0xBD, 0x00, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x56, 0xFF, 0x80, 0x1F, 0xF0, 0x0B, 0xFC,
-    0x02, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x7F, 0xC0,
-    0x03, 0xFC, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1C, 0x02, 0xFD, 0x00, 0x07, 0xF5, 0xBF, 0xC0, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x24, 0x3F, 0xC0, 0x01, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0xBF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xA5, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0xC0, 0x00, 0x00,
-    0xFC, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0xFD, 0x03, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0x7F, 0xC1, 0x01, 0x03, 0xF8, 0x0B, 0xFC, 0x7C, 0x3E, 0xFF, 0x00, 0xBF, 0xEF, 0xC3,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x3F, 0xFC, 0x00, 0xFF, 0xFF, 0x83, 0xFE, 0x00, 0x07, 0xFF, 0xF0,
-    0x01, 0x00, 0x00, 0x04, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x0F,
-    0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9,
-    0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEB, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x05, 0x42, 0xFF, 0xF0, 0x03,
-    0xFE, 0xFF, 0xFF, 0x00, 0x3F, 0xEA, 0xBF, 0xF0, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x3F,
-    0xD0, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xD5, 0x5F, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0xAB, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xF0,
-    0x03, 0xFD, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0xBF, 0xC0,
-    0x7F, 0xC0, 0x0F, 0xF8, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1C, 0x07, 0xF8, 0x00, 0x07, 0xF5, 0xFF, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x05, 0x40, 0x2F, 0xFF, 0x00, 0x3F, 0xE0, 0xFF, 0xFF, 0x00, 0x3F, 0xE0, 0xAB, 0xFF, 0x00,
-    0x3F, 0xD0, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x07, 0xFD, 0x55, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFA, 0xAB, 0xFE, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x10, 0x2F,
-    0xF0, 0x07, 0xFC, 0x7C, 0x3F, 0xE0, 0x0B, 0xFE, 0xFC, 0x3F, 0xD0, 0x0B, 0xFF, 0xFC, 0x7F, 0xC0,
-    0x0B, 0xFF, 0xF8, 0xBF, 0x80, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x47, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD7, 0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x01, 0xFF, 0x40, 0x02,
-    0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x7F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x69, 0x4F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x05, 0x42, 0xFF, 0xD0, 0x07,
-    0xFC, 0xBF, 0xFD, 0x00, 0xFF, 0x8A, 0xBF, 0xC0, 0x0F, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF0, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x40, 0x7F, 0xD0, 0x0B, 0xF8, 0x0F, 0xFD,
-    0x00, 0xBF, 0xEF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFB, 0xF8, 0x03,
-    0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFA, 0xFE, 0x01, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0xC0,
-    0xFD, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x1F, 0xF0, 0xBF, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0x83, 0xFC,
-    0x3F, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0x6F, 0x82, 0xFF, 0x00, 0x00, 0x07, 0xF0, 0x3F,
-    0xEF, 0xC0, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0xE0, 0x2F, 0xF0, 0x00, 0x00, 0xFD, 0x01,
-    0xFF, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xC0,
-    0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xF4,
-    0x00, 0xBF, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xFD, 0x00, 0x06, 0xFF,
-    0x90, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x69, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFC, 0x00, 0x15, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF0,
-    0x3F, 0xBF, 0x40, 0x00, 0x1F, 0xAF, 0xC2, 0xF6, 0xFC, 0x00, 0x00, 0x7D, 0x7F, 0x0F, 0xCF, 0xF0,
-    0x00, 0x02, 0xF5, 0xFD, 0x7D, 0x3F, 0x80, 0x00, 0x0F, 0xC3, 0xF7, 0xF1, 0xFD, 0x00, 0x00, 0x3F,
-    0x0F, 0xFF, 0x47, 0xF4, 0x00, 0x01, 0xF8, 0x3F, 0xFC, 0x2F, 0xC0, 0x00, 0x0B, 0xD0, 0xFF, 0xD0,
-    0xFF, 0x00, 0x00, 0x3F, 0x03, 0xFF, 0x03, 0xFC, 0x10, 0x01, 0xFC, 0x0F, 0xF8, 0x0F, 0xE2, 0xE3,
-    0xEF, 0xD0, 0x3F, 0xC0, 0x3F, 0xEF, 0x8F, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0xFD, 0x3F, 0xF4, 0x03,
-    0xF4, 0x03, 0xFF, 0xF0, 0xFF, 0x40, 0x05, 0x40, 0x0F, 0xFF, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x04,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xAA, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF,
-    0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0xD5, 0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00,
-    0xBF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0xF0, 0x00, 0xE0, 0x00,
-    0x03, 0xF0, 0x03, 0xD0, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
-    0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF,
-    0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80,
-    0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F,
-    0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0,
-    0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81,
-    0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B,
-    0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01,
-    0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xD0,
-    0x00, 0x03, 0xFD, 0x2F, 0xE0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00,
-    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB,
-    0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF,
-    0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00,
-    0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F,
-    0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF,
-    0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x05, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF1, 0xFE, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x55, 0x7F, 0xD0, 0x00, 0x7C, 0x00, 0x01, 0xFF,
-    0x00, 0x03, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x01, 0xFC, 0x00, 0x0F,
-    0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x69, 0x40, 0x01, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0x82, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xBF, 0xFF, 0x9B, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xE0,
-    0x3F, 0xC0, 0x3F, 0xE0, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0xFF,
-    0x80, 0x0F, 0xF0, 0x2F, 0xE0, 0x1F, 0xF0, 0x02, 0xFE, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xEB,
-    0xFD, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-    0xE0, 0x3F, 0xFD, 0x00, 0x0A, 0x03, 0xFE, 0x0B, 0xFF, 0xE0, 0x03, 0xF0, 0x3F, 0xF6, 0xFA, 0xFF,
-    0x96, 0xFF, 0x02, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x00,
-    0x7F, 0xE0, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x2E, 0x00, 0x00,
-    0x02, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0x6F, 0xC0, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xC0, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x1B, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC0, 0x00, 0xB8, 0x00, 0xB4, 0x00, 0x7F, 0x00, 0x7C, 0x00, 0x2F, 0xD0, 0x7E,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF,
-    0x9B, 0xFC, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x2F, 0xC0, 0x3F, 0xC0, 0x0F,
-    0xE0, 0x2F, 0xD0, 0x07, 0xF4, 0x7F, 0xD0, 0x02, 0xFE, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x24, 0x03, 0xFD, 0x00, 0x7F, 0x00, 0xFF, 0xD5, 0xFF,
-    0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x80, 0x2F, 0xFE, 0x00, 0xBE, 0x00, 0x02,
-    0xFF, 0xC0, 0x0E, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x05, 0x55, 0x55, 0x5B,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0B, 0xFE, 0x1F, 0xF4, 0x00, 0x03, 0xFF,
-    0x07, 0xFD, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x3F, 0xF9, 0x1B, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFE, 0xBF, 0xF4, 0x0F, 0xE0, 0x0B, 0xFC, 0x0F, 0x40, 0x07, 0xFC, 0x01, 0x00,
-    0x0B, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xD7, 0xFC, 0x07, 0xFD,
-    0x0B, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0xC0,
-    0xFF, 0x80, 0x3F, 0xEB, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x3F, 0xC1, 0xFD, 0x00, 0x00, 0x1F, 0xF0,
-    0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0xBF,
-    0xF8, 0x02, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x38, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x15, 0x55, 0x55, 0x6F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFE, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x2F, 0xF8,
-    0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x1F, 0xF4, 0x00, 0x0F, 0xFD, 0x07, 0xFE, 0x00, 0x0F, 0xFE, 0x00,
-    0xFF, 0xE4, 0x6F, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x81, 0xFC, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x2F,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xBF, 0xF4, 0x0F, 0xE0, 0x0B, 0xFC, 0x0F, 0x40,
-    0x07, 0xFC, 0x01, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xD7, 0xFC, 0x07, 0xFD, 0x0B, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0x80,
-    0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x80, 0x3F, 0xEB, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0,
-    0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xF4, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xF0, 0x00, 0x3E, 0xFF, 0x00,
-    0x2F, 0xE0, 0x03, 0xFE, 0xFC, 0x00, 0x04, 0x0F, 0xD0, 0x0F, 0xF4, 0x03, 0xFC, 0x04, 0x00, 0x00,
-    0x02, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x80, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0xD0,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF9, 0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x03, 0xFC,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x1B, 0xFF, 0x40, 0x0F,
-    0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x43, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x54, 0x00,
-    0x1A, 0x00, 0x07, 0xFF, 0xC0, 0x3F, 0x80, 0x2F, 0xFC, 0x01, 0xFF, 0xFD, 0x03, 0xF4, 0x0B, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xF0, 0x7F, 0x02, 0xFF, 0xFC, 0x0B, 0xE6, 0xFF, 0x0B, 0xF0, 0x7F, 0x42, 0x80,
-    0x74, 0x0F, 0xF0, 0xFE, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x3F, 0xD3, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC7,
-    0xFE, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xBF, 0x9F, 0xD0, 0x04, 0x01, 0x00, 0xBE, 0x0F, 0xF1,
-    0xFF, 0x02, 0xE0, 0x3D, 0x7F, 0xC0, 0xFD, 0x0F, 0xFE, 0xFE, 0x0B, 0xFF, 0xF0, 0x1F, 0xC0, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFD, 0x02, 0xFC, 0x07, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x3F, 0x40, 0x2F, 0xF8,
-    0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x40, 0x00, 0x07,
-    0xF4, 0x3F, 0xC0, 0x00, 0x3F, 0xD2, 0xFF, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x03, 0xF4, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xD0,
-    0x1F, 0xFC, 0x00, 0xFD, 0x00, 0x2F, 0xF4, 0x03, 0xF0, 0x00, 0xBF, 0xD0, 0x0B, 0x40, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x05, 0x5F, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x02, 0x00, 0x00, 0x7F, 0xE0,
-    0x7D, 0x00, 0x02, 0xFF, 0x43, 0xFC, 0x00, 0x1F, 0xFC, 0x0F, 0xFD, 0x06, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0xBF,
-    0x87, 0xFC, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x0B, 0xF9, 0x7F, 0xF0, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0x60, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xAB,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xC0, 0x03, 0xFD, 0x03, 0xF8,
-    0x02, 0xFF, 0x00, 0xFF, 0xEF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x55, 0x6F, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0xF8, 0x00, 0x3F,
-    0x40, 0x1F, 0xF8, 0x00, 0x0B, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x07, 0x80, 0x00, 0x7F, 0xD0, 0x0B, 0xF0, 0x00,
-    0x3F, 0xF0, 0x03, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xE4, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xFC, 0x00, 0xBF, 0xC0,
-    0x00, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x08, 0x00, 0x00, 0xFF, 0x40, 0x7E, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0x40, 0x0B, 0xFD, 0x00,
-    0xBF, 0xF9, 0xBF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x01,
-    0xBE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0xBF, 0x8F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xE1,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xCF, 0xF4, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x03, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F,
-    0xFF, 0x90, 0x0B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80,
-    0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F,
-    0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F,
-    0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xF8, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xC2, 0xFE, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x42, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00,
-    0x07, 0xF4, 0x3F, 0x80, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80,
-    0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F,
-    0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F,
-    0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x01, 0x40, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0x00,
-    0x2F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8,
-    0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00,
-    0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC,
-    0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC,
-    0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
-    0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x03, 0xFD, 0x2F, 0xF0,
-    0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF,
-    0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE,
-    0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8,
-    0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x0B, 0xFE, 0x00, 0x00,
-    0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x00,
-    0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE,
-    0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0xD5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xAF, 0xFD, 0x02, 0xFF, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x07, 0xFC,
-    0x3F, 0xC0, 0x01, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xAA, 0xAF,
-    0xF4, 0xFF, 0x40, 0x03, 0xFC, 0x3F, 0xD0, 0x02, 0xFE, 0x0F, 0xF8, 0x01, 0xFF, 0x02, 0xFF, 0x01,
-    0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00,
-    0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
-    0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x0B, 0xFE, 0x00,
-    0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00,
-    0x00, 0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0xD5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x03, 0xFD, 0x2F,
-    0xF0, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xF4, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x7F, 0xC0,
-    0x0B, 0xFC, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x07, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFA, 0xAA, 0xFF, 0x43, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x02,
-    0xFE, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x1F, 0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x50, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x00, 0x07, 0xFC,
-    0x3F, 0xE0, 0x00, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFD, 0x00, 0xBF, 0xF8, 0x00, 0xFD, 0x00, 0x0B,
-    0xFF, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0xD0, 0x0B, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x14, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x02, 0x40, 0x00, 0x0F, 0xFD,
-    0x07, 0xF0, 0x00, 0x0F, 0xFF, 0x03, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xE4, 0x6F, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0xE2,
-    0xFF, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFE, 0xAF, 0xFC, 0x03, 0xF0, 0x03, 0xFE, 0x02, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x1A, 0xAB,
-    0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0x00, 0x0F, 0xF4, 0x3F, 0x80, 0x2F,
-    0xF0, 0x3F, 0xFA, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x03, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x02, 0xFF, 0x80,
-    0x00, 0xBF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xC0,
-    0x00, 0x00, 0x2F, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF2,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00,
-    0x1A, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x01, 0xBF, 0xFC,
-    0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x3F,
-    0xD0, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00,
-    0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03,
-    0xD0, 0x6F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x2F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xC3, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x03, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x02, 0xFF, 0x80,
-    0x00, 0xBF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xC0,
-    0x00, 0x00, 0x2F, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF2,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x0F,
-    0xF0, 0x00, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x1A, 0x00, 0x00, 0xBF, 0xF0,
-    0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x01, 0xBF, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x02,
-    0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xD0, 0x6F, 0xD0, 0x00, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x47, 0xFF, 0x00, 0x00,
-    0x0F, 0xFE, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0xBF, 0xE0, 0x00, 0x00, 0xFE, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xE0, 0x01, 0xFF, 0xF4, 0x02, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x1F,
-    0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x28, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x7E, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x3C, 0x00, 0x00, 0x00,
-    0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00,
-    0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x1A, 0x00, 0x00,
-    0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x01, 0xBF, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0,
-    0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x0B, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF3, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xD0, 0x6F, 0xD0,
-    0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x03,
-    0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x87, 0xFC, 0x00, 0x00,
-    0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x0B, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFE,
-    0x00, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x69, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x07, 0xF0, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x1F, 0xC0,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x05, 0x42, 0xFF, 0xD0, 0x07, 0xFC, 0xBF, 0xFD, 0x00, 0xFF, 0x8A, 0xBF, 0xC0, 0x0F,
-    0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0xBF,
-    0x40, 0x7F, 0xD0, 0x0B, 0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xEF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x09, 0x00, 0x00,
-    0x1F, 0xFB, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF1, 0x57, 0xFC, 0x00, 0x01, 0xFF, 0x80,
-    0x0F, 0xE0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x03, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xAF,
-    0xFC, 0x0F, 0xD0, 0x0F, 0xF0, 0x18, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x47, 0xFD, 0x02, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xFB, 0x80, 0x2F, 0xFE, 0x3E, 0x00, 0x01, 0x41, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x87,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF9, 0xBF, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x7F,
-    0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFC,
-    0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x07,
-    0xFF, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0x90, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00,
-    0x00, 0x54, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x02,
-    0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xEB, 0xF8, 0x00, 0xBF, 0x80,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xF4, 0x00, 0x7F, 0xFB, 0xFF, 0xC0, 0xFF, 0x40, 0x0B, 0xF8, 0x03,
-    0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x2F, 0xD2, 0xFF, 0x00, 0x0F, 0xF0, 0x02, 0xFC, 0x2F, 0xE0,
-    0x00, 0xFF, 0x00, 0x3F, 0xC3, 0xFD, 0x28, 0x0F, 0xF4, 0x0B, 0xF8, 0x3F, 0xEF, 0xC0, 0xBF, 0xFF,
-    0xFF, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x0B, 0xFF, 0xD0, 0x02, 0xFF,
-    0x40, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF1, 0x57, 0xF8, 0x00,
-    0x01, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x03, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x15, 0xFF, 0xE5, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xAF, 0xFE,
-    0xA8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xE6,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x06, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFE,
-    0x03, 0xFF, 0xAF, 0xFC, 0x0F, 0x80, 0x0F, 0xF0, 0x10, 0x00, 0x3F, 0xC0, 0x07, 0x03, 0xFE, 0x00,
-    0x3E, 0x7F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xBF, 0xFD, 0x00, 0x0B, 0xFE,
-    0xBC, 0x00, 0x3F, 0xD0, 0xF0, 0x01, 0xFF, 0x00, 0x0B, 0x87, 0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0x9F, 0xC0, 0x01, 0x40, 0x3F, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x04, 0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x8B, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0E, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x64, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0xFF, 0x01, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xD0, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0xBF, 0x18, 0x00, 0x01, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xF3, 0xFE, 0x00, 0x03, 0xEF, 0xF0, 0xBF, 0xC0, 0x01, 0xFF, 0xF4, 0x0F,
-    0xF4, 0x00, 0x7F, 0xF8, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x50, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xD0, 0x2F,
-    0xC0, 0x00, 0x00, 0xFE, 0x6F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xE0, 0x7F, 0xFF, 0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xBF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x8B,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF4, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF,
-    0x90, 0x07, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x06, 0x40, 0x00, 0x64, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0xFF,
-    0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0xD0, 0xFF, 0xF8, 0x00, 0x0B, 0xF8, 0xBF, 0x18, 0x00, 0x00, 0xFF,
-    0x7F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xAA, 0xFF,
-    0xEA, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x05, 0x6F, 0xFD, 0x54, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF3, 0xFD, 0x00, 0x03, 0xEF, 0xF0, 0xBF,
-    0xC6, 0x81, 0xFF, 0xF4, 0x1F, 0xFF, 0xF0, 0x7F, 0xF8, 0x03, 0xFF, 0xF4, 0x0F, 0xF8, 0x00, 0x7F,
-    0xE4, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x38, 0x2C, 0x1E, 0xB4, 0x07, 0xD0, 0x0B, 0xD0, 0x2F,
-    0xF4, 0x36, 0x9C, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x74, 0x3F, 0xFF, 0xFC,
-    0x75, 0x55, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x70, 0x14, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2E, 0x55, 0x5D,
-    0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0, 0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x15, 0x55, 0x41, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x15, 0x55, 0x50, 0x15, 0x55, 0x41, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFD, 0x15, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0x40, 0xA9, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x15, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x04, 0x00, 0x7E, 0x01, 0xFC, 0x03, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F,
-    0xD0, 0x3F, 0xE0, 0x1A, 0x40, 0x00, 0x50, 0x07, 0xFC, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x07,
-    0xF8, 0x0B, 0xF0, 0x0F, 0xE0, 0x3F, 0xC0, 0xBF, 0x00, 0x38, 0x00, 0x00, 0x40, 0x07, 0xF8, 0x0B,
-    0xFC, 0x07, 0xFC, 0x03, 0xFC, 0x07, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0x80, 0xBF, 0x00, 0x78,
-    0x00, 0x01, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x3F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xD0, 0x0F,
-    0xF0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x01, 0xF8, 0x07,
-    0xE0, 0x1F, 0xC0, 0xBF, 0x00, 0xFD, 0x07, 0xF4, 0x0F, 0xF0, 0x3F, 0xC0, 0x7F, 0x41, 0xFD, 0x03,
-    0xFC, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0xD0, 0xFF, 0x00, 0xFF, 0x83, 0xFD, 0x01, 0xA4,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0xBF, 0xC2, 0xFF, 0x00, 0xFF,
-    0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x7F, 0x80, 0xBF, 0x42, 0xFC, 0x03, 0xF8, 0x0F,
-    0xE0, 0x2F, 0xC0, 0xBF, 0x01, 0xFC, 0x07, 0xF0, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x01, 0x00, 0x7F, 0x82, 0xFD, 0x0B, 0xFC, 0x3F, 0xE0, 0x7F, 0xC2, 0xFE, 0x03, 0xFC,
-    0x2F, 0xD0, 0x7F, 0x43, 0xFC, 0x0F, 0xF0, 0x3F, 0x81, 0xFD, 0x0B, 0xF0, 0x3F, 0x81, 0xFD, 0x0B,
-    0xF0, 0x3F, 0x40, 0x78, 0x02, 0xD0, 0x00, 0x01, 0x00, 0x14, 0x00, 0x7F, 0xC3, 0xFE, 0x03, 0xFF,
-    0x1F, 0xF8, 0x0F, 0xF4, 0xBF, 0xC0, 0x3F, 0xC1, 0xFE, 0x00, 0xFF, 0x03, 0xFC, 0x01, 0xFD, 0x0F,
-    0xF0, 0x03, 0xFC, 0x0F, 0xD0, 0x03, 0xF4, 0x2F, 0xC0, 0x07, 0xF0, 0x3F, 0x80, 0x07, 0xC0, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x02, 0x50, 0xBD, 0x05, 0x5F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF6, 0xF9, 0x7E, 0x6B, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x25, 0x0B, 0xD0, 0x54, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x42, 0xF9, 0x7E,
-    0x6B, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x25, 0x07, 0xC0, 0x54, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x81, 0xFA, 0x7E, 0x6B, 0xC0, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xFD, 0xBF, 0xFE, 0xBF, 0xFE,
-    0xBF, 0xFD, 0x7F, 0xF8, 0x1B, 0x90, 0x28, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x3F,
-    0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x3F, 0xFD,
-    0x00, 0x3F, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0xBF, 0xD3, 0xFF, 0x8F,
-    0xFE, 0x2F, 0xF4, 0x15, 0x00, 0x06, 0x80, 0x06, 0x80, 0xFF, 0x80, 0xBF, 0xC7, 0xFE, 0x03, 0xFF,
-    0x1F, 0xF8, 0x1F, 0xFC, 0x7F, 0xC0, 0x3F, 0xC0, 0x54, 0x00, 0x14, 0x00, 0x06, 0x80, 0x00, 0x1A,
-    0x00, 0x00, 0x68, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x01, 0x40, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0x06, 0x90, 0xBF, 0xD3, 0xFF, 0x8F, 0xFE, 0x2F,
-    0xF0, 0x15, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x74, 0x38,
-    0x1F, 0xFC, 0x74, 0x05, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x70, 0x14,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xF4, 0x1C, 0x2E,
-    0x50, 0x0D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0, 0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x1F, 0x40, 0x07, 0xFC, 0x00, 0xEA, 0x70, 0x38, 0xA2, 0xCA, 0x0A, 0x0A, 0x40, 0xA0, 0x10, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xD0, 0x00, 0x03,
-    0xC7, 0x80, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x3C, 0x38, 0xBF, 0xFF, 0xF0, 0xEB, 0x55, 0x6D, 0x2C,
-    0xA0, 0x07, 0x4B, 0x0A, 0x01, 0xD2, 0xC0, 0xA0, 0x74, 0xB0, 0x0A, 0x04, 0x04, 0x00, 0xA0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x2D, 0x3C, 0x00, 0x0B,
-    0x4F, 0x00, 0x02, 0xC3, 0xC0, 0x00, 0xB0, 0xFF, 0xFF, 0xE3, 0x87, 0x95, 0x5E, 0x0E, 0x1D, 0x00,
-    0xA0, 0x38, 0x74, 0x0A, 0x00, 0xE1, 0xD0, 0xA0, 0x01, 0x01, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0xBF, 0x02, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x3F, 0x80, 0xFE, 0x07, 0xF0, 0x1F, 0xFE,
-    0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xEB, 0xFC, 0x0F, 0xC0, 0xBF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xF0, 0x3F, 0x42, 0xFE, 0x7F, 0xD0, 0x2F, 0xE7, 0xFD, 0x07, 0xFF, 0x40, 0xBE, 0x07, 0xF8,
-    0x1F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x0F, 0xE0, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x1F,
-    0xD0, 0x1F, 0xE1, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x1F, 0xD2, 0xFC, 0x01,
-    0xFD, 0x00, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x3F, 0xC2, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-    0x2F, 0xC0, 0x7F, 0x82, 0xFC, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0xFF, 0x02, 0xFD,
-    0x0F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xE0,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xAA, 0x00, 0x00,
-    0x0A, 0xA0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0xFD, 0x01, 0xFE, 0x03,
-    0xFD, 0x07, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x2F, 0xD0, 0x3F, 0x80, 0x3F, 0x00, 0x08, 0x00, 0x00,
-    0xA0, 0x02, 0x40, 0x03, 0xF4, 0x2F, 0x80, 0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x47, 0xFC, 0x07, 0xFC,
-    0x3F, 0xE0, 0x2F, 0xE1, 0xFF, 0x00, 0xFF, 0x0B, 0xF4, 0x0B, 0xF4, 0x3F, 0xC0, 0x3F, 0x81, 0xFC,
-    0x00, 0xFC, 0x07, 0xD0, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0xA0, 0x01, 0x80, 0x02, 0x40, 0x03,
-    0xF4, 0x0F, 0xD0, 0x2F, 0x80, 0x1F, 0xE0, 0x7F, 0xC0, 0xFF, 0x00, 0xFF, 0x42, 0xFE, 0x07, 0xFC,
-    0x07, 0xFC, 0x0F, 0xF4, 0x3F, 0xD0, 0x2F, 0xE0, 0xBF, 0xC1, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x0B,
-    0xF4, 0x0B, 0xF4, 0x1F, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0xBF, 0x02, 0xFC, 0x00, 0xFC, 0x02, 0xF0,
-    0x07, 0xD0, 0x00, 0x80, 0x01, 0x40, 0x05, 0x00, 0x00, 0x06, 0x00, 0x3F, 0x40, 0x7F, 0xC0, 0x3F,
-    0xD0, 0x2F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF8, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0xBD, 0x00, 0x24, 0x06,
-    0x00, 0x18, 0x00, 0xFD, 0x02, 0xF8, 0x07, 0xFC, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F, 0xD0, 0x2F, 0xE0,
-    0x7F, 0xC0, 0x3F, 0xC0, 0xFF, 0x40, 0xBF, 0x81, 0xFE, 0x00, 0xFF, 0x03, 0xFC, 0x01, 0xFD, 0x03,
-    0xF8, 0x02, 0xF4, 0x07, 0xD0, 0x02, 0x40, 0x05, 0x00, 0x06, 0x00, 0x18, 0x00, 0x24, 0x03, 0xF4,
-    0x0B, 0xE0, 0x1F, 0xC0, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x03, 0xFD, 0x0F, 0xF4, 0x2F, 0xE0, 0x2F,
-    0xE0, 0x7F, 0xC1, 0xFF, 0x00, 0xFF, 0x03, 0xFD, 0x0F, 0xF4, 0x0B, 0xF8, 0x1F, 0xE0, 0x3F, 0xC0,
-    0x3F, 0xC0, 0xFF, 0x02, 0xFD, 0x01, 0xFD, 0x03, 0xF8, 0x0F, 0xE0, 0x0B, 0xD0, 0x1F, 0x40, 0x3E,
-    0x00, 0x24, 0x00, 0x50, 0x01, 0x40, 0x00, 0x06, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x1F, 0xFF, 0x80, 0x07, 0xF8, 0xFE, 0x01, 0xFE, 0x03, 0xF8, 0x2F, 0x80, 0x0F, 0xD0, 0x00,
-    0x02, 0x40, 0x01, 0xFD, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0xBF, 0xC0,
-    0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x28, 0x00,
-    0x00, 0x90, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0xBF,
-    0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF4,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x8B, 0xE0,
-    0x03, 0xE0, 0x03, 0xF0, 0xBE, 0x02, 0xFC, 0x03, 0xF0, 0x0B, 0xE0, 0xBF, 0x03, 0xF4, 0x00, 0xFD,
-    0x0F, 0x43, 0xF4, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x02, 0xF4, 0x00, 0x00, 0x0F,
-    0xD2, 0xF8, 0x00, 0x01, 0x80, 0xFE, 0xF8, 0x18, 0x02, 0xFC, 0x1F, 0xF8, 0x1F, 0xC0, 0xFF, 0x02,
-    0xFC, 0x0B, 0xF4, 0x1F, 0xC1, 0xFF, 0xC1, 0xFC, 0x01, 0x41, 0xFD, 0xFC, 0x04, 0x00, 0x01, 0xFC,
-    0x1F, 0x80, 0x00, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x0F,
-    0x82, 0xF8, 0x00, 0xFD, 0x0B, 0xF0, 0x3F, 0x40, 0xFD, 0x02, 0xFC, 0x03, 0xF4, 0xBD, 0x00, 0x2D,
-    0x00, 0x3F, 0x0A, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0,
-    0x01, 0xA8, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x7F, 0xD0, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0x07, 0xF0,
-    0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0x0B, 0xD0, 0x02,
-    0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x09, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x01, 0x50, 0x00, 0x2F, 0xD0, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x0F, 0xF8, 0x00,
-    0x7F, 0xD0, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0xAA,
-    0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9,
-    0x15, 0x50, 0x7F, 0xFD, 0xBF, 0xFE, 0xBF, 0xFD, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40,
-    0x01, 0xBF, 0x40, 0x0F, 0xFF, 0xE0, 0x0B, 0xFF, 0xF0, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x2F, 0x57, 0xFC, 0x0F, 0x97, 0xFD, 0x04, 0x02, 0xFC, 0x04, 0x00,
-    0xFE, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x03,
-    0xFC, 0x00, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0,
-    0x00, 0x3F, 0x95, 0x00, 0x2F, 0xD5, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFF, 0x00, 0x2F, 0xFC, 0x00,
-    0x0F, 0xFD, 0x00, 0x06, 0x90, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0,
-    0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x05, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x2F, 0xE4, 0x00, 0x0F, 0xFC, 0x0F, 0xFF,
-    0xE0, 0x01, 0xFF, 0x42, 0xFF, 0xFF, 0x40, 0x3F, 0xF0, 0x2F, 0xFF, 0xFC, 0x03, 0xFE, 0x02, 0xF5,
-    0x7F, 0xC0, 0x7F, 0xD0, 0x04, 0x02, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x80, 0x00,
-    0x03, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00,
-    0x2F, 0x80, 0x00, 0x2F, 0xC0, 0x03, 0xF9, 0x50, 0x02, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0x40,
-    0x02, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x06, 0x90, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x15, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x01, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x01, 0xBF, 0x80, 0x00, 0x7F, 0xD0,
-    0x7F, 0xFF, 0x00, 0x0F, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4,
-    0x0F, 0x96, 0xFE, 0x01, 0xFF, 0x00, 0x40, 0x0F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0xFE, 0x03, 0xFD,
-    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x3F,
-    0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x07, 0xF4, 0x00, 0x0B,
-    0xF0, 0x00, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xE5, 0x00, 0x0B, 0xD0, 0x01, 0xFF, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x09, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x14, 0x00, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00,
-    0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x3C, 0x0B, 0xFF, 0xFF, 0x40, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x7F, 0xFF, 0xF8, 0x0E, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0x80, 0x02, 0x40, 0x09, 0x00, 0x0F, 0xD0, 0x3F, 0x40,
-    0xBE, 0x01, 0xFC, 0x01, 0xFE, 0x07, 0xFC, 0x0F, 0xF0, 0x3F, 0xD0, 0x3F, 0xD0, 0xBF, 0x81, 0xFF,
-    0x07, 0xFC, 0x07, 0xFC, 0x0F, 0xF4, 0x3F, 0xD0, 0xBF, 0x80, 0xBF, 0x82, 0xFF, 0x07, 0xFC, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0xBF, 0x42, 0xFE, 0x02, 0xFD, 0x07, 0xF8, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x3F, 0x80, 0xBF, 0x02, 0xFC, 0x07, 0xF4, 0x03, 0xF0, 0x0B, 0xC0, 0x1F, 0x40, 0x7E, 0x00, 0x08,
-    0x00, 0x14, 0x00, 0x50, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x7F,
-    0xFF, 0xC0, 0x1F, 0xFB, 0xFD, 0x03, 0xF8, 0x0F, 0xE0, 0xFF, 0x00, 0xFF, 0x0F, 0xE0, 0x0F, 0xF2,
-    0xFD, 0x00, 0xFE, 0x3F, 0xC0, 0x0F, 0xE3, 0xFC, 0x02, 0xFD, 0x3F, 0x80, 0x3F, 0xC3, 0xF8, 0x07,
-    0xF4, 0x3F, 0xC0, 0xFF, 0x02, 0xFF, 0xBF, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFE, 0xF4, 0x00, 0x3F, 0x3F, 0x00, 0x0F, 0xC3, 0xF0, 0x03,
-    0xF0, 0x7F, 0x00, 0xFD, 0x0B, 0xE0, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x2B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x3F,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x3F, 0xC0, 0x55, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x0B, 0xFE, 0x40, 0x02, 0xFE, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x0F, 0xFA, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0xAB, 0xFD, 0x07, 0xF0,
-    0x0F, 0xE0, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0x0B, 0xE0, 0x7F, 0x00, 0xFD, 0x03, 0xF9, 0x7F, 0xC0,
-    0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFA, 0x07, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xF0, 0xF8, 0x07, 0xF4, 0x3D, 0x03, 0xF8, 0x01, 0x03, 0xF8, 0x00, 0x02,
-    0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F,
-    0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x1F, 0xD1, 0xFD, 0x0B, 0xE0, 0x3F, 0x43,
-    0xF8, 0x1F, 0xC0, 0x7F, 0x5F, 0xD0, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x07, 0xF6, 0xFE, 0x03,
-    0xF0, 0x2F, 0xC2, 0xF8, 0x03, 0xF4, 0xBE, 0x01, 0xFC, 0x2F, 0xD1, 0xFE, 0x03, 0xFF, 0xFE, 0x00,
-    0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0x40, 0x3F, 0xD7, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0xBF, 0x00, 0xFD, 0x0B, 0xE0, 0x0F, 0xD0,
-    0xBF, 0x00, 0xFD, 0x07, 0xFE, 0xBF, 0xC0, 0x2F, 0xFF, 0xF8, 0x00, 0x6A, 0xFF, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x6F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0x03, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0x47, 0xFE, 0xBF, 0xF0, 0x1F, 0xBA, 0xFC,
-    0x0B, 0xF8, 0x7E, 0x03, 0xFC, 0x2F, 0x40, 0xFD, 0x0F, 0xC0, 0x7F, 0x03, 0xE0, 0x2F, 0x81, 0xF4,
-    0x4F, 0xD0, 0xBE, 0xF3, 0xF0, 0x3F, 0xF5, 0xF8, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x64, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xD2, 0xFE, 0x07, 0xF4, 0x0F, 0xF0,
-    0xFF, 0x00, 0xFF, 0x1F, 0xD0, 0x0F, 0xF2, 0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0x1F, 0xD3, 0xF8, 0x02,
-    0xFC, 0x3F, 0x80, 0x3F, 0xC3, 0xFC, 0x0B, 0xF4, 0x3F, 0xD1, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xE0, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x01, 0x80, 0x01, 0xBF, 0xC0, 0x7F, 0xFE, 0x00, 0xFF,
-    0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x01,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x7F, 0xFF, 0x83, 0xFF, 0xFE, 0x05,
-    0x55, 0x50, 0x00, 0x01, 0x94, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xD2, 0xFD,
-    0x03, 0xE0, 0x0F, 0xD0, 0x1C, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x07,
-    0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xF5, 0x55, 0x03,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x00, 0x55, 0x55, 0x00, 0x00, 0x06, 0x50, 0x00, 0xBF, 0xFC,
-    0x03, 0xFF, 0xFE, 0x07, 0xE0, 0xBF, 0x03, 0x80, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF8, 0x01,
-    0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x42, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x1F,
-    0xF4, 0x6B, 0xFF, 0xD0, 0xBF, 0xFF, 0x40, 0x2A, 0x90, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFA, 0xF4, 0x00,
-    0x7E, 0x3F, 0x00, 0x1F, 0x83, 0xF0, 0x07, 0xE0, 0x7E, 0x01, 0xFC, 0x0B, 0xE0, 0x3F, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFD, 0x05, 0x56, 0xFD, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF4, 0x07, 0xF5, 0x54, 0x02,
-    0xF4, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xF0, 0x2B, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xE0, 0x00, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x16, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xFF,
-    0x80, 0x0F, 0xF9, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x3F, 0x42, 0xFD, 0x07, 0xF0, 0x0F, 0xE0, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0x0F, 0xE0,
-    0x7F, 0x41, 0xFC, 0x03, 0xFE, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xF4, 0xFD, 0x57, 0xFC, 0x3E, 0x02, 0xFC, 0x0B, 0x01,
-    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F,
-    0x80, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x2F, 0xFF, 0x40, 0x3F, 0xEF, 0xF4, 0x2F, 0xC0, 0xFE, 0x0F,
-    0xE0, 0x3F, 0x42, 0xFC, 0x2F, 0xC0, 0x3F, 0xEF, 0xC0, 0x07, 0xFF, 0x80, 0x0B, 0xFF, 0xF0, 0x0B,
-    0xE0, 0xFF, 0x07, 0xF0, 0x1F, 0xD2, 0xF8, 0x03, 0xF4, 0xBF, 0x02, 0xFC, 0x1F, 0xFB, 0xFD, 0x02,
-    0xFF, 0xFD, 0x00, 0x06, 0x94, 0x00, 0x00, 0x05, 0x90, 0x00, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0x80, 0x3F, 0x81, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0xBF, 0x00, 0xFD, 0x0B, 0xF0, 0x0F, 0xD0, 0x7F,
-    0x41, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xF4, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x2F, 0xF4, 0x02, 0xBF, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x55, 0x50, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x1F, 0xFE, 0xAB, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0xFC, 0x00,
-    0x02, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x2B, 0xFF, 0x99, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFF, 0xA9, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0x97, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x2F, 0xD0, 0x00, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x2F, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFB, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1A, 0xFF, 0xEA, 0xA4, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xEB, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xAB, 0xFF, 0xAA, 0x90, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xEF, 0xF9, 0x56, 0xAF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xE0, 0x1B, 0xFF, 0xF0, 0x02, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xAB, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0xFF, 0xDB, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x3F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x0B, 0xFE, 0xA0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x40,
-    0xBF, 0xE3, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0x40, 0x0B, 0xFC, 0x1F, 0xFE, 0x1F, 0xFF, 0xFE, 0x03,
-    0xF9, 0xBC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x20, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0x80, 0x01,
-    0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x09, 0x02, 0xFE, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x0B, 0xFC, 0x7C, 0xBC, 0x07, 0xF8, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xF3,
-    0xFE, 0x7F, 0xC1, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x47, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xAA, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x07, 0xF0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x78, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0x6F, 0xF5, 0x6A, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xD5, 0x55, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x70,
-    0x00, 0x0B, 0xFF, 0xE5, 0x6F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x01, 0x55, 0x43, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xF9, 0x55, 0x55,
-    0x55, 0x40, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0xBF,
-    0x7F, 0x7F, 0x8B, 0xF4, 0xFC, 0x7F, 0x8F, 0x83, 0xF0, 0xBC, 0x08, 0x1F, 0xC0, 0x80, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x05, 0x55, 0x00, 0x00, 0xBF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x08, 0x1F, 0xC0, 0x80, 0xB8, 0x3F, 0x0B, 0x8B, 0xF4,
-    0xFC, 0x7F, 0x8F, 0xF7, 0xF7, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x03, 0x80, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xF8,
-    0x00, 0x0B, 0xF8, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xF5, 0x55, 0x55, 0x7F, 0x80, 0xBF, 0x40,
-    0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x03, 0xFD,
-    0xFC, 0xFF, 0x0B, 0xC3, 0xF1, 0xF8, 0x09, 0x0F, 0xC2, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x90, 0xFC, 0x18,
-    0x0B, 0xC3, 0xF0, 0xF8, 0x3F, 0xCF, 0xCF, 0xF0, 0x7F, 0xBF, 0xBF, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFF, 0x80, 0xFF, 0x7F, 0x7F, 0xC3, 0xF4, 0xFC, 0x7F, 0x03, 0x83, 0xF0, 0xB0, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x03, 0xF0, 0x10, 0x1F, 0x0F, 0xC3, 0xD0,
-    0xFF, 0x3F, 0x3F, 0xC1, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xFD, 0x00, 0x08, 0x03, 0xF4, 0x00, 0xBC, 0x0F, 0xD0, 0x0B, 0xFC, 0x3F, 0x40,
-    0xBF, 0xC0, 0xFD, 0x07, 0xF8, 0x03, 0xF4, 0x7F, 0x95, 0x5F, 0xD7, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x6A, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x01, 0x80, 0x01, 0xFC,
-    0x1F, 0x80, 0x07, 0xF0, 0xFF, 0x80, 0x1F, 0xC0, 0xFF, 0x40, 0x7F, 0x00, 0xBF, 0x41, 0xFD, 0x55,
-    0xBF, 0x47, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x07, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x03, 0xFD, 0x00, 0x0F,
-    0xD0, 0x3F, 0xC0, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0x00, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0xF9, 0x55, 0x55, 0x54, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x55, 0x5A, 0x90, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF5,
-    0x55, 0x55, 0x55, 0x50, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF,
-    0x95, 0x6A, 0xAA, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xF7, 0xF4,
-    0x00, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x0B, 0xFD, 0x1F, 0xF8, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x0B,
-    0xFB, 0xD1, 0xFB, 0xF8, 0x3F, 0x5F, 0x47, 0xD7, 0xF0, 0x34, 0x7D, 0x1F, 0x47, 0x00, 0x01, 0xF4,
-    0x7D, 0x00, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x7D, 0x1F, 0x40,
-    0x00, 0x02, 0xF4, 0x7D, 0x00, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00,
-    0xBD, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x00, 0x2F, 0x47,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x1A, 0x95, 0x54, 0x07,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x55, 0x55,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xE1, 0x55, 0x55, 0x55, 0x57, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2E, 0xAA, 0xA5, 0x5B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x02, 0x90, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00,
-    0x02, 0xF4, 0x7E, 0x00, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0xBD,
-    0x1F, 0x80, 0x00, 0x02, 0xF4, 0x7D, 0x00, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0x00, 0x1F, 0x47, 0xD0,
-    0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x03, 0x07, 0xD1, 0xF4, 0x70, 0x3F,
-    0x1F, 0x47, 0xD3, 0xF0, 0xFF, 0x7D, 0x1F, 0x7F, 0xC0, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0xBF, 0xD1,
-    0xFF, 0x80, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x00, 0xBF, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x0E, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0x02,
-    0xFD, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFD,
-    0x55, 0x55, 0x55, 0xFD, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xD5, 0x55, 0x55, 0x5F, 0xE2, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F,
-    0xC0, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xC3,
-    0xFF, 0xC0, 0x00, 0x02, 0xFE, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x7F,
-    0xC0, 0x3F, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xFA, 0xAA, 0xAF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFD,
-    0x00, 0xBF, 0x40, 0x00, 0x2F, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xE0, 0x00, 0x00,
-    0xFF, 0xD0, 0xBF, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x1F, 0xC0, 0x00,
-    0x00, 0x0B, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x0F, 0xD5, 0xBF, 0xF0,
-    0x00, 0x90, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xD0, 0x07, 0xFC, 0x0B, 0xF8, 0x00,
-    0x7F, 0xC0, 0xFF, 0x00, 0x0B, 0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x0F, 0xF0, 0x3F,
-    0xE0, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0xFF,
-    0x40, 0x2F, 0xF4, 0x3F, 0xE0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xEA, 0xAF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x45, 0x55,
-    0x40, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF5, 0xEA, 0xAA, 0x5F, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x69, 0x40, 0x02, 0x80, 0x00, 0x1B, 0xFF, 0xFF, 0x42, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFA, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0xBF, 0xFC, 0x00,
-    0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x01, 0xFC, 0xFF, 0x82, 0xFF, 0x00, 0x01, 0xFC, 0x2F, 0xF0, 0xFF,
-    0xC0, 0x01, 0xFD, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0xFD, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0xFD, 0x00,
-    0xBF, 0xC3, 0xFE, 0x00, 0xFD, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0xFD, 0x00, 0x0F, 0xFC, 0x3F, 0xE0,
-    0xFD, 0x00, 0x03, 0xFE, 0x0B, 0xFC, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-    0xC0, 0x3F, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xF4,
-    0x01, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x00, 0x06, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0xF4, 0x00, 0x00,
-    0x0B, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0xE0, 0x00,
-    0x03, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0x80,
-    0x00, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xFE,
-    0x00, 0x7F, 0x80, 0x00, 0x7F, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0x3F,
-    0xFC, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xE5, 0x55, 0x57, 0xFD, 0x3F, 0xF8, 0x00, 0x01,
-    0xFF, 0x0B, 0xFF, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x3F, 0xF8, 0x00, 0x1F,
-    0xE0, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xF8, 0x02, 0xFD,
-    0x00, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0xF8, 0x2F, 0xC0,
-    0x00, 0x07, 0xFF, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xC7, 0xF4, 0x00, 0x00, 0x2F, 0xFA, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x55, 0x55, 0x55, 0x47, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
-    0xFF, 0x95, 0x55, 0x55, 0x55, 0x43, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1A, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x41, 0xFF, 0xE4, 0x03, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x00, 0xBF, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F,
-    0xE1, 0x55, 0xFF, 0x95, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xE5, 0x5B, 0xFD, 0x55, 0x50, 0xFF, 0x80, 0x2F, 0xD0,
-    0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x2F,
-    0xD0, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x15, 0x55, 0x55, 0x54, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x5F, 0xF9, 0x55, 0x55, 0x55, 0x54, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xA4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x55, 0x55, 0x55, 0x54, 0xBF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x55,
-    0x55, 0x55, 0x55, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE9, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0F, 0xF0, 0x06, 0xFF, 0xD0, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0x80,
-    0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFC, 0x15, 0x5B,
-    0xFD, 0x55, 0x2F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0xBF,
-    0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xE1,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x45,
-    0x55, 0x55, 0x55, 0x5B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF9, 0x55, 0x57, 0xFF, 0x80, 0x03, 0xFF, 0x40,
-    0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF,
-    0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F,
-    0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03,
-    0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03,
-    0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xF5, 0x55, 0x5F, 0xF0, 0x1F, 0xFD, 0x00, 0x01, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0x00,
-    0x3F, 0xF8, 0x00, 0x0B, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3E, 0x01, 0xFF,
-    0x40, 0x00, 0x1F, 0xC0, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFF, 0x95, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0x54, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x03, 0xF0, 0x78, 0x2F, 0xD3, 0xE3, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xFB, 0xFF, 0xFD, 0x1F, 0xC3, 0xE1, 0xFC, 0x0D, 0x07, 0xF0, 0x34, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x6A, 0x40, 0x01, 0xFF, 0xFD, 0x01,
-    0xFF, 0xFF, 0xD0, 0xFF, 0x5B, 0xFC, 0x7F, 0x00, 0xBF, 0x2F, 0xC0, 0x1F, 0xCB, 0xF0, 0x03, 0xF2,
-    0xFC, 0x02, 0xFC, 0x3F, 0xD6, 0xFE, 0x0B, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x06, 0xF9, 0x00,
-    0x1A, 0x81, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC, 0x7F, 0xE0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFF, 0xF0,
-    0x02, 0xF8, 0x00, 0x16, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0xBF,
-    0x80, 0xBF, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x03,
-    0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xFF, 0xD0, 0x07, 0xC0, 0xFF,
-    0xFD, 0x0B, 0xF0, 0xFF, 0xFF, 0xCB, 0xF8, 0x3F, 0x82, 0xFF, 0xF0, 0x1F, 0xC0, 0x3F, 0xF0, 0x0B,
-    0xE0, 0x03, 0xF8, 0x02, 0xFC, 0x02, 0xFF, 0x40, 0x7F, 0x42, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0xFF,
-    0x82, 0xFF, 0xFC, 0x0F, 0xF0, 0x2F, 0xF8, 0x00, 0xFC, 0x00, 0x50, 0x00, 0x06, 0x00, 0x00, 0x10,
-    0x00, 0x01, 0x40, 0x01, 0xFF, 0xC0, 0x0B, 0xFD, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFC, 0x7F, 0x43, 0xFF, 0xE0, 0xBF, 0x2F, 0xC0, 0x3F, 0xE0, 0x0F, 0xCB, 0xE0, 0x0B,
-    0xF0, 0x03, 0xF2, 0xF8, 0x03, 0xFF, 0x00, 0xFC, 0x7F, 0x03, 0xFF, 0xE0, 0xBF, 0x0F, 0xFF, 0xF9,
-    0xFF, 0xFF, 0x82, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x50, 0x00,
-    0x01, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0x3F, 0xDF, 0xF7,
-    0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD,
-    0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF,
-    0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x55, 0x40, 0x2A, 0x40, 0xA9, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x15, 0x40, 0x55, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x7F, 0xC0,
-    0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF4,
-    0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4,
-    0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC7, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC2, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x1F,
-    0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0,
-    0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0xE0, 0x00, 0x00, 0x03,
-    0xFE, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFE, 0x56, 0xFF, 0xE0, 0xFF,
-    0x80, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0xFF, 0x5F, 0xE0, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00,
-    0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE,
-    0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0,
-    0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00,
-    0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB,
-    0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00,
-    0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07,
-    0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF,
-    0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00,
-    0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F,
-    0xAF, 0xD0, 0x00, 0x01, 0xFE, 0x7F, 0x80, 0x00, 0x0B, 0xF5, 0xFF, 0x00, 0x00, 0x3F, 0xD3, 0xFE,
-    0x00, 0x02, 0xFF, 0x0B, 0xFF, 0x95, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x00, 0x02, 0xBA, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x02,
-    0xFF, 0x07, 0xD0, 0x00, 0x0F, 0xFC, 0x04, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x04, 0x07, 0xFD, 0x00, 0x00, 0xFC, 0x2F, 0xF0, 0x00, 0x0B, 0xFE, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x01, 0xA8, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x01, 0x50, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xFE, 0x07, 0xFF, 0x07, 0xFE, 0x03, 0xF8, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1F, 0xD0, 0x3F,
-    0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01, 0xA8, 0x0B, 0xFE, 0x00,
-    0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC2, 0xFF,
-    0x40, 0x00, 0x07, 0xFE, 0x01, 0x50, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE4, 0x00, 0x3C, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0x80,
-    0x7F, 0xFF, 0xF8, 0x0E, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x00, 0x14, 0x03, 0xFF, 0xF8, 0x00, 0x7D, 0x0F, 0xFF, 0xFF, 0x96, 0xFE, 0x2F, 0xE6, 0xFF, 0xFF,
-    0xFC, 0x2F, 0x40, 0x1F, 0xFF, 0xF0, 0x0A, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xA4, 0x00, 0x14, 0x03, 0xFF, 0xD0, 0x0F, 0xC3,
-    0xFF, 0xFE, 0x0B, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x03, 0xFF, 0xFD, 0x0F, 0x40, 0x1F, 0xFD,
-    0x00, 0x40, 0x00, 0x54, 0x00, 0x0B, 0xE0, 0x00, 0x60, 0x0F, 0xFF, 0x80, 0x3F, 0x0F, 0xFF, 0xFD,
-    0x2F, 0xC7, 0xFE, 0xFF, 0xFF, 0xF2, 0xF8, 0x0B, 0xFF, 0xF0, 0x2C, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x06, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x05, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0x6B, 0xFC, 0x20, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x2A, 0xAA, 0xBF, 0xE9,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xFF, 0xAA, 0x40, 0x03, 0xF0, 0x00, 0x00,
-    0x2F, 0x80, 0x02, 0xAA, 0xFE, 0xAA, 0x9F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xAB, 0xFA,
-    0xAA, 0xA4, 0x2F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x55, 0x55, 0x55,
-    0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xAA, 0xAA, 0xAA, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0xBF, 0xF9, 0x00, 0x2F, 0xFE, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xBF, 0xF8, 0x00, 0x7F, 0xFD,
-    0x00, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F,
-    0xC0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0x40, 0x07, 0xFF, 0x90, 0x07, 0xFF,
-    0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF,
-    0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x03,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x1B, 0xFF, 0x40, 0x00,
-    0x07, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0x00,
-    0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xD0, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFD, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x00,
-    0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFA, 0xAA, 0xA4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x01, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x9F, 0xFF, 0x00, 0x00,
-    0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x03,
-    0xFD, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x00,
-    0x07, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xF0, 0x6A, 0xBF, 0xFA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFE, 0xAA, 0xAA, 0xA0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x2A, 0xAA, 0xAA, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x9F, 0xDB, 0xFD, 0x00, 0x01, 0xFE, 0x03, 0xF0, 0x2F, 0xD0, 0x00, 0xFD, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4,
-    0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F,
-    0x00, 0x02, 0xF1, 0xFE, 0xAA, 0xAF, 0xEA, 0xAA, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x0F, 0xC0,
-    0x00, 0xBC, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0xD0, 0x02, 0xFC, 0x03, 0xF0, 0x0F,
-    0xE0, 0x00, 0x2F, 0xE4, 0xFC, 0x6F, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x90, 0x1B, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF1,
-    0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F,
-    0xE4, 0x00, 0x6F, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x90, 0x1B, 0xFD,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xC0, 0x7E, 0xBF, 0x00, 0x07, 0xF6, 0xF4, 0x2F, 0x0B, 0xF0, 0x07, 0xF4, 0x3E,
-    0x0F, 0xC0, 0xBF, 0x07, 0xF4, 0x0F, 0xC3, 0xE0, 0x0B, 0xF7, 0xF4, 0x02, 0xF1, 0xF4, 0x00, 0xBF,
-    0xF4, 0x00, 0x7D, 0x7D, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0x5F, 0x40, 0x07, 0xFF, 0x00, 0x07, 0xD3,
-    0xD0, 0x07, 0xFF, 0xF0, 0x01, 0xF0, 0xF8, 0x07, 0xF4, 0xBF, 0x00, 0xBC, 0x3F, 0x07, 0xF4, 0x0B,
-    0xF0, 0x3F, 0x07, 0xD7, 0xF4, 0x00, 0xBF, 0x1F, 0x40, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xC0, 0x1F,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x6F,
-    0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x90, 0x1B, 0xFD, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x7E, 0x00, 0x00, 0x07, 0xF6, 0xF4, 0x2F, 0x00, 0x00, 0x07, 0xF4, 0x3E, 0x0F, 0xC0, 0x00,
-    0x07, 0xF4, 0x0F, 0xC3, 0xE0, 0x00, 0x07, 0xF4, 0x02, 0xF1, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x7D,
-    0x7D, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0x5F, 0x40, 0x07, 0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x07, 0xF4,
-    0x00, 0x01, 0xF0, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0xBC, 0x3F, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x07,
-    0xD7, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x6F, 0xE0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1A, 0x81, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC, 0x7F, 0xE0, 0x15, 0x00, 0x0A, 0x90, 0x00, 0x2A, 0x40,
-    0x00, 0xA9, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x7F,
-    0xF5, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0x1F, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x01,
-    0x50, 0x00, 0x05, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xF9,
-    0xBE, 0x40, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x43, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE4,
-    0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC2, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_16_bolditalicBitmaps[43637] = {
+    0x95, 0x55, 0xBF, 0x6F, 0xDE, 0x44, 0x18, 0x7E, 0x6D, 0x93, 0x5A, 0x8A, 0x07, 0x33, 0x90, 0xA5,
+    0x91, 0xB8, 0x85, 0xAD, 0x83, 0x17, 0x96, 0x4A, 0x14, 0x3B, 0x74, 0xE8, 0x9A, 0x21, 0x1F, 0x4B,
+    0x87, 0xF0, 0x1F, 0x64, 0x66, 0xB2, 0x99, 0x59, 0xC2, 0x7F, 0xD0, 0x81, 0x89, 0x0E, 0x65, 0x64,
+    0x88, 0x7A, 0x87, 0x18, 0xBA, 0x5A, 0x2C, 0x0C, 0x0C, 0xB5, 0x04, 0xCC, 0x39, 0x24, 0x23, 0xB9,
+    0xD5, 0xF9, 0x5E, 0x9E, 0xE7, 0x9C, 0x90, 0x54, 0x61, 0x80, 0x93, 0xBE, 0xF3, 0xE7, 0xBB, 0xF7,
+    0xE7, 0xF3, 0x3E, 0xEF, 0x6B, 0xB9, 0xF7, 0x4C, 0xAC, 0x2B, 0x57, 0x69, 0xBD, 0xE8, 0x80, 0xA7,
+    0xF1, 0x62, 0x87, 0x62, 0x95, 0xDA, 0x4B, 0xEB, 0x24, 0x4A, 0x39, 0x8B, 0x71, 0x62, 0x25, 0x5F,
+    0xA4, 0x1A, 0xA5, 0x15, 0x39, 0x17, 0xAC, 0xBD, 0x4E, 0x6C, 0x57, 0x44, 0x31, 0xB3, 0xB4, 0x83,
+    0x9C, 0x88, 0x64, 0xDF, 0xDE, 0x3F, 0x5A, 0x1B, 0xA7, 0xB5, 0xEF, 0x5F, 0x2D, 0xE6, 0xE7, 0xB5,
+    0xF2, 0x5A, 0x84, 0xD6, 0xC5, 0x7A, 0x6A, 0x1F, 0xCF, 0xB5, 0x0B, 0xC5, 0xF9, 0x97, 0xD4, 0x83,
+    0x99, 0x72, 0x12, 0x89, 0x79, 0x10, 0x69, 0xBB, 0x28, 0xB0, 0xDD, 0x76, 0x52, 0x79, 0xE3, 0xB2,
+    0xE7, 0xF1, 0xC5, 0xDB, 0x73, 0xC5, 0xF2, 0x2D, 0xB6, 0x20, 0x8D, 0xEB, 0x45, 0xEA, 0xA9, 0x71,
+    0x52, 0xCC, 0xF5, 0x24, 0x59, 0x28, 0x66, 0x39, 0xD0, 0xCF, 0xE3, 0x89, 0xC1, 0x75, 0xAC, 0x28,
+    0x79, 0xF4, 0xF4, 0xAF, 0xD3, 0x3F, 0xBA, 0x3C, 0x94, 0xFE, 0x8E, 0xC9, 0xEC, 0x18, 0x21, 0x5E,
+    0xAF, 0x6A, 0xC0, 0x36, 0xE3, 0x57, 0xE3, 0x97, 0x41, 0xB8, 0xD4, 0x41, 0x60, 0xA1, 0xCB, 0x55,
+    0x57, 0xE9, 0x9F, 0xBC, 0xF6, 0xF5, 0xF4, 0x83, 0x95, 0x58, 0x3F, 0x99, 0xCC, 0x9F, 0xFE, 0x13,
+    0xD1, 0x4B, 0x88, 0x2A, 0xE2, 0xEC, 0x15, 0xF2, 0x10, 0x81, 0xC2, 0xCC, 0xA3, 0x51, 0x44, 0x35,
+    0xF3, 0xA6, 0xF1, 0x7D, 0x31, 0x69, 0x35, 0x3F, 0xAA, 0xBD, 0x7D, 0xF5, 0x63, 0x2C, 0xE3, 0x45,
+    0xEF, 0x10, 0xF5, 0x2C, 0xB4, 0x97, 0x14, 0x72, 0x68, 0xCB, 0x23, 0xFC, 0x4A, 0x87, 0xED, 0x82,
+    0xBE, 0xAF, 0x83, 0xB8, 0xB3, 0x20, 0x5A, 0xE1, 0x02, 0x99, 0x56, 0xEA, 0xA5, 0x08, 0x82, 0xB0,
+    0x06, 0x81, 0x6B, 0xFB, 0x18, 0x30, 0x8C, 0x09, 0x84, 0x72, 0x91, 0x3C, 0x20, 0x45, 0xE4, 0xD7,
+    0xBA, 0xD6, 0x11, 0x95, 0xA5, 0x08, 0x28, 0x0E, 0xF0, 0x6F, 0x07, 0x46, 0xB8, 0x54, 0xBE, 0x19,
+    0x32, 0xBC, 0xC6, 0xD2, 0x9B, 0x58, 0x44, 0xEB, 0x42, 0xA5, 0xC1, 0x00, 0xCE, 0xCF, 0x62, 0x3F,
+    0xF6, 0x73, 0x35, 0xF5, 0x5F, 0x41, 0x3B, 0x0B, 0x35, 0xB2, 0xDD, 0xA0, 0x8A, 0x04, 0xD8, 0x8C,
+    0x66, 0x4A, 0xB6, 0x33, 0x58, 0xE9, 0xBB, 0x06, 0xD6, 0x71, 0x0A, 0x50, 0x17, 0x86, 0xD2, 0x8C,
+    0x8C, 0xA3, 0x43, 0x62, 0x4E, 0x20, 0x57, 0x2A, 0x2B, 0x21, 0xB2, 0xFF, 0x4C, 0xA4, 0x90, 0x7F,
+    0x5D, 0x55, 0xE4, 0x9E, 0x01, 0x5D, 0x3C, 0x8C, 0xA6, 0x37, 0x70, 0x81, 0x37, 0xBE, 0x02, 0xF6,
+    0x29, 0x60, 0x08, 0xAC, 0xF9, 0x76, 0x86, 0x54, 0x3E, 0x96, 0xE6, 0x97, 0x20, 0x20, 0x86, 0xD5,
+    0xEE, 0x50, 0x87, 0x5C, 0xC7, 0x43, 0x10, 0xA0, 0x0F, 0xB9, 0xC6, 0xAE, 0xD2, 0xB9, 0x86, 0x6F,
+    0x7B, 0xEA, 0x1F, 0xBE, 0x44, 0x92, 0xED, 0x08, 0x1A, 0xB4, 0x63, 0xEF, 0x40, 0x4A, 0x05, 0x63,
+    0x41, 0xD0, 0x90, 0xE9, 0xD7, 0x1E, 0xBC, 0x4D, 0xA8, 0xE1, 0x5E, 0x17, 0x38, 0xC4, 0x63, 0x44,
+    0x10, 0x91, 0x45, 0xC9, 0xC8, 0x95, 0x78, 0x0C, 0xEB, 0xDF, 0x28, 0xE2, 0x07, 0x31, 0x58, 0x57,
+    0xB2, 0xF8, 0x1C, 0xBC, 0x35, 0xA3, 0x96, 0xC1, 0x8C, 0xB6, 0x08, 0xE0, 0x6A, 0x07, 0xA2, 0xDE,
+    0x62, 0x4D, 0x06, 0xB9, 0x06, 0x25, 0x21, 0xEA, 0x00, 0x89, 0xE4, 0x42, 0x06, 0x38, 0xAC, 0x01,
+    0x7C, 0x8F, 0x1A, 0xAC, 0xDB, 0x09, 0x00, 0x62, 0x86, 0xE8, 0x19, 0xE9, 0x07, 0xC9, 0xD7, 0xAB,
+    0x82, 0x8E, 0xE9, 0x26, 0xBD, 0x2E, 0x9B, 0x20, 0xB0, 0x15, 0x00, 0x93, 0xC3, 0x04, 0x75, 0x2B,
+    0x2A, 0x2D, 0x9B, 0x39, 0x5E, 0x9B, 0x1B, 0xCE, 0xCA, 0x87, 0x92, 0x3C, 0x25, 0xD1, 0x78, 0x4B,
+    0x9C, 0x86, 0xA7, 0xE4, 0x5D, 0xAE, 0xAD, 0x5C, 0x1D, 0xD9, 0x1B, 0xD7, 0xED, 0xB8, 0xDD, 0x86,
+    0xED, 0x06, 0x7F, 0xCB, 0x90, 0x4E, 0xB3, 0xB8, 0x85, 0x89, 0x20, 0x18, 0x93, 0x75, 0xC9, 0x28,
+    0x34, 0x19, 0x06, 0xBA, 0x5B, 0xDE, 0xBF, 0x72, 0x9F, 0xCF, 0xF2, 0xBD, 0xCA, 0xCB, 0x56, 0xDA,
+    0xCB, 0x2E, 0xD3, 0x4B, 0x07, 0x6A, 0x9E, 0xAD, 0x17, 0xED, 0xEB, 0xA3, 0xF2, 0x37, 0x2F, 0x5F,
+    0xC0, 0xCA, 0xA7, 0x69, 0x0A, 0x60, 0x32, 0x08, 0x0B, 0xC9, 0xCA, 0xA2, 0x92, 0x78, 0xDD, 0x7F,
+    0xAE, 0xDF, 0xF5, 0x4A, 0xE4, 0xF5, 0xCD, 0xCE, 0xEE, 0xBA, 0x77, 0x6F, 0x93, 0x30, 0xD7, 0x7D,
+    0x7A, 0x54, 0x07, 0xEF, 0x76, 0xA8, 0x67, 0x84, 0xD5, 0xBB, 0xC6, 0x17, 0x8B, 0xBC, 0x27, 0x72,
+    0xB0, 0x3B, 0x52, 0xFD, 0x55, 0xF5, 0x4C, 0xD7, 0x83, 0xDD, 0xF1, 0xBD, 0xC1, 0xFE, 0xA4, 0x35,
+    0x66, 0xC9, 0x07, 0x49, 0x2F, 0xF1, 0xC9, 0x12, 0xA7, 0x9E, 0x0D, 0x45, 0x40, 0x53, 0x8A, 0x29,
+    0xAB, 0x94, 0x3B, 0x58, 0x22, 0x5B, 0xEA, 0x29, 0xDB, 0x94, 0xFD, 0x1D, 0x15, 0xF3, 0x9F, 0x55,
+    0xDC, 0x3B, 0x2A, 0x7B, 0xC7, 0x5B, 0xF8, 0xFB, 0x14, 0xB3, 0xCA, 0x8E, 0x00, 0xDF, 0x1A, 0x0E,
+    0x2C, 0xEB, 0xEB, 0x98, 0x61, 0x86, 0x6A, 0xA1, 0x52, 0x28, 0x46, 0x69, 0x81, 0xB0, 0xB1, 0x61,
+    0x46, 0x16, 0x4A, 0x16, 0x29, 0x66, 0x6C, 0x19, 0x41, 0xA4, 0x72, 0xED, 0x27, 0xA9, 0x43, 0x8F,
+    0xD6, 0x5E, 0xB0, 0x61, 0x9A, 0x4C, 0xE0, 0x17, 0x36, 0x75, 0x2D, 0x68, 0xDC, 0xB5, 0xEB, 0x19,
+    0x06, 0x31, 0xA9, 0x5B, 0xB1, 0xEF, 0xD2, 0x40, 0x91, 0x9B, 0x79, 0x66, 0x44, 0x0E, 0x15, 0x3E,
+    0x41, 0x7C, 0x9D, 0x72, 0x36, 0x1A, 0xFC, 0x48, 0xEF, 0xC1, 0x15, 0xD4, 0x11, 0xB2, 0x2D, 0x52,
+    0x82, 0x5E, 0x49, 0xF6, 0xA6, 0x66, 0x80, 0x6F, 0xA8, 0xB1, 0xD0, 0xB7, 0x84, 0x3C, 0xBB, 0xB3,
+    0xC0, 0xC4, 0x82, 0x27, 0x00, 0xF1, 0xE0, 0x0D, 0xC7, 0x1C, 0xD4, 0x1A, 0xBE, 0xDA, 0xB7, 0x96,
+    0xE5, 0x31, 0xE8, 0x41, 0x58, 0x47, 0xCB, 0xC3, 0xC5, 0x47, 0x62, 0x08, 0x13, 0xAD, 0x8B, 0x9D,
+    0x48, 0x4D, 0xC0, 0x52, 0x11, 0xAA, 0x86, 0xC8, 0xD1, 0x48, 0xC1, 0x23, 0x43, 0x6C, 0xFA, 0xF9,
+    0x5A, 0x80, 0x6F, 0x1C, 0xE9, 0xCE, 0x72, 0x63, 0x2F, 0x0E, 0xE4, 0x07, 0x4E, 0x1F, 0x2C, 0xDB,
+    0x84, 0xC8, 0xF9, 0x6A, 0xE2, 0x8B, 0x80, 0x86, 0x36, 0x33, 0x48, 0xD0, 0x8E, 0xA5, 0xCB, 0x38,
+    0x40, 0xEA, 0x64, 0xD8, 0x6D, 0x1E, 0x0C, 0x22, 0x2F, 0x53, 0xBA, 0xDC, 0x1E, 0x9E, 0xD2, 0x73,
+    0x12, 0x68, 0xFC, 0x95, 0x14, 0x7D, 0x65, 0x88, 0x23, 0xB3, 0x8A, 0xE2, 0xA8, 0xCF, 0x38, 0x8F,
+    0x39, 0x45, 0x44, 0xAE, 0xEA, 0x96, 0xE6, 0x32, 0x5B, 0x8D, 0x78, 0x41, 0x76, 0x92, 0x34, 0xD3,
+    0x60, 0x7B, 0xE4, 0xB8, 0x27, 0xD8, 0x28, 0x76, 0x19, 0xC0, 0x14, 0xE3, 0x41, 0x80, 0xDE, 0x29,
+    0xA7, 0x80, 0xA6, 0x31, 0xC3, 0x21, 0x03, 0xA2, 0xF2, 0xF3, 0x64, 0xFF, 0xD9, 0x00, 0x17, 0x3F,
+    0x0E, 0xEC, 0xA6, 0xD4, 0x9C, 0x1B, 0xAB, 0x92, 0x0B, 0xF2, 0x72, 0x6F, 0xB7, 0x3B, 0x61, 0xFA,
+    0x13, 0xA7, 0x10, 0xA6, 0x19, 0x88, 0xC2, 0xE6, 0x4C, 0x0C, 0x63, 0x4F, 0x6E, 0x70, 0x32, 0xA1,
+    0x92, 0xF3, 0xCB, 0x70, 0x43, 0x09, 0x98, 0x3B, 0x21, 0x32, 0x49, 0x24, 0x85, 0x8A, 0x73, 0xD6,
+    0x8D, 0x35, 0x84, 0x58, 0x97, 0x3D, 0x4D, 0xDF, 0x9B, 0xF4, 0x11, 0x23, 0x0D, 0x7F, 0x87, 0x4C,
+    0x27, 0xFF, 0x77, 0xFD, 0x0D, 0x6D, 0x55, 0xBB, 0x8E, 0xE5, 0x44, 0x10, 0x2D, 0xDB, 0x7B, 0xC7,
+    0x08, 0x07, 0x4D, 0xB0, 0x10, 0xEC, 0x0D, 0x4C, 0x8E, 0xA0, 0x3F, 0xC1, 0xBD, 0x7F, 0x30, 0x12,
+    0x5C, 0x6D, 0x40, 0xB0, 0x11, 0x09, 0xC9, 0xFC, 0x00, 0x92, 0x2F, 0xDA, 0x1F, 0x98, 0x64, 0x62,
+    0x36, 0x00, 0x81, 0x86, 0x1F, 0x20, 0xC2, 0x16, 0x3F, 0x80, 0xF9, 0x02, 0x2C, 0xB1, 0x13, 0x00,
+    0x01, 0x0E, 0x1C, 0x98, 0x51, 0xDB, 0xC5, 0x39, 0xD5, 0xDE, 0xE1, 0x21, 0xEE, 0x8C, 0x5F, 0xED,
+    0xAE, 0xAA, 0x53, 0xA7, 0x4E, 0x95, 0x45, 0xE4, 0x38, 0x8B, 0x94, 0xBA, 0x8A, 0xB4, 0xFA, 0xA7,
+    0xE4, 0xBC, 0x71, 0x3A, 0x88, 0x34, 0xB8, 0x11, 0x9D, 0x04, 0x4B, 0x67, 0x6E, 0xB8, 0xE1, 0xBA,
+    0x8E, 0x52, 0xAB, 0x46, 0x69, 0x54, 0x55, 0x9A, 0xB1, 0xD4, 0xD0, 0x0E, 0x78, 0xDF, 0xF5, 0x59,
+    0x3A, 0x85, 0xFD, 0x94, 0xAB, 0xB4, 0x63, 0xB9, 0x49, 0xB3, 0xD4, 0x91, 0x16, 0xB3, 0x54, 0x0A,
+    0xA7, 0x59, 0xB7, 0xC1, 0x69, 0x16, 0x70, 0x9C, 0x4E, 0xA7, 0x40, 0x2F, 0x3D, 0x0E, 0x2D, 0x71,
+    0x44, 0x7F, 0x77, 0xC2, 0x93, 0xB8, 0x58, 0xCC, 0xD2, 0x0D, 0xAE, 0x2F, 0x09, 0xA0, 0x1D, 0x45,
+    0x0A, 0xC5, 0x4D, 0x63, 0x48, 0x60, 0xE9, 0x17, 0x58, 0x6B, 0x0F, 0x34, 0x11, 0xCB, 0xDD, 0x48,
+    0x6C, 0x7C, 0x3F, 0xBF, 0x5E, 0x5E, 0xF7, 0xDD, 0xC2, 0xDD, 0x05, 0x37, 0x65, 0x97, 0xC2, 0xDF,
+    0x7B, 0x0B, 0x53, 0xD8, 0xB0, 0x0D, 0xA7, 0x7A, 0x7D, 0x1E, 0x45, 0xCF, 0x6E, 0x2E, 0x91, 0xCD,
+    0xE0, 0xA7, 0x4C, 0xA5, 0xEB, 0xDD, 0x22, 0xFA, 0x93, 0x02, 0x3D, 0x52, 0xC4, 0x29, 0x00, 0xF5,
+    0xC2, 0xED, 0x0B, 0xA2, 0xB6, 0x0B, 0x32, 0x6B, 0x26, 0x37, 0x4B, 0x3B, 0x74, 0xBD, 0xE8, 0x8B,
+    0x4D, 0x8A, 0x15, 0x18, 0xFC, 0xE4, 0x23, 0x28, 0x68, 0xB8, 0xAB, 0x55, 0x70, 0xE5, 0x41, 0x92,
+    0xE5, 0x08, 0x6A, 0xEF, 0x99, 0x02, 0x5E, 0xA4, 0x37, 0xED, 0x7D, 0x37, 0x03, 0x1A, 0x78, 0xA9,
+    0x67, 0xD1, 0xBE, 0xA2, 0x31, 0x98, 0x02, 0x02, 0xC6, 0x24, 0xE8, 0xAE, 0xAF, 0x36, 0x5E, 0xF5,
+    0xEE, 0x0A, 0x31, 0x77, 0x18, 0xE0, 0xEC, 0xA8, 0xCC, 0xB1, 0xB0, 0x8C, 0x58, 0x8E, 0x82, 0x99,
+    0x56, 0x3C, 0x79, 0x3C, 0x5E, 0x10, 0x2A, 0x33, 0x03, 0x56, 0xD0, 0x20, 0x07, 0x49, 0x3F, 0x37,
+    0xB8, 0x58, 0x2A, 0x60, 0xFB, 0x20, 0xFF, 0xFE, 0x65, 0x2F, 0x11, 0x4F, 0x7B, 0xA4, 0x33, 0x49,
+    0x22, 0x47, 0x56, 0xF2, 0x8C, 0x7F, 0xD0, 0x9E, 0x2F, 0xF2, 0xBF, 0xBF, 0x27, 0xE0, 0xF4, 0x0C,
+    0x33, 0xC0, 0x94, 0x0E, 0x37, 0x21, 0xDB, 0x08, 0xDE, 0x4F, 0xD2, 0x9C, 0xE5, 0x91, 0x6D, 0x41,
+    0xA0, 0xFA, 0xCC, 0x8A, 0x10, 0x49, 0xBB, 0x02, 0x5E, 0xA8, 0x60, 0xC3, 0x7A, 0x10, 0x1A, 0x56,
+    0x20, 0x07, 0x6E, 0x18, 0x91, 0x19, 0x16, 0xE0, 0x49, 0xDE, 0xA7, 0xE1, 0xED, 0xED, 0xED, 0xD7,
+    0x50, 0xC1, 0x1F, 0x38, 0x6E, 0xA0, 0x8D, 0x3D, 0xE2, 0x9B, 0x58, 0x06, 0x75, 0x1B, 0x56, 0xEF,
+    0x71, 0x7B, 0xFD, 0x16, 0xD6, 0x00, 0x0E, 0x24, 0x3D, 0xB8, 0xC9, 0x1E, 0xFC, 0x6E, 0x26, 0x8E,
+    0xA3, 0x86, 0x52, 0x87, 0x3D, 0x3C, 0x72, 0x97, 0x62, 0x48, 0xBE, 0xF2, 0x2D, 0x38, 0x1D, 0xBD,
+    0xCE, 0x1E, 0x5A, 0x7B, 0x16, 0x1F, 0xE5, 0x20, 0x37, 0x4A, 0xB1, 0x08, 0x38, 0x68, 0x50, 0x50,
+    0x6A, 0x05, 0xB7, 0x1E, 0x68, 0x6F, 0xA4, 0xD9, 0xC4, 0x47, 0xB9, 0xB8, 0xA6, 0xE1, 0x21, 0x88,
+    0x1F, 0xA0, 0x76, 0x14, 0x9E, 0x1B, 0x13, 0xBB, 0x17, 0xDD, 0xAF, 0x76, 0x51, 0x16, 0x96, 0x1A,
+    0xA1, 0xBE, 0x91, 0xEE, 0x57, 0x1F, 0xE3, 0x5A, 0x28, 0x0C, 0xC1, 0x13, 0x45, 0x09, 0xA6, 0x0A,
+    0xAA, 0x1E, 0x01, 0xFC, 0x98, 0x7D, 0xF7, 0x24, 0x5F, 0x21, 0xB5, 0x66, 0x83, 0xCA, 0xDD, 0x54,
+    0xA0, 0xA1, 0xDC, 0xD8, 0x86, 0x66, 0xC0, 0xD2, 0x8B, 0x98, 0xAD, 0x59, 0x94, 0xD5, 0x8D, 0x6E,
+    0xAA, 0xC6, 0x72, 0x6E, 0x03, 0x5E, 0x04, 0xFF, 0x43, 0xCC, 0x23, 0x96, 0xD5, 0x4D, 0xFC, 0x2B,
+    0xE7, 0xA6, 0x6F, 0xFA, 0xF6, 0xDC, 0xA0, 0x53, 0xB4, 0x58, 0xF1, 0x17, 0x0B, 0xFD, 0x7E, 0x69,
+    0x07, 0xD8, 0xE8, 0x2F, 0x68, 0xDE, 0xA6, 0xAF, 0x37, 0xC7, 0x12, 0x85, 0xE3, 0x75, 0xF5, 0x25,
+    0x80, 0xA5, 0xE4, 0x13, 0x84, 0xC4, 0x9C, 0xBC, 0xCB, 0x3E, 0x08, 0x52, 0x0F, 0xD6, 0xD2, 0x26,
+    0x2D, 0xB4, 0x27, 0x65, 0x4B, 0xB9, 0xA5, 0xE2, 0x1F, 0x2E, 0x5F, 0x57, 0xFD, 0xB1, 0x9D, 0x91,
+    0xB8, 0xEC, 0x3D, 0x87, 0x4D, 0x46, 0x29, 0x49, 0xA7, 0x07, 0xDA, 0x65, 0x9B, 0x05, 0x6A, 0xBE,
+    0x60, 0xE3, 0x55, 0x93, 0x3D, 0x6C, 0x6E, 0x36, 0x43, 0x9B, 0x1F, 0x73, 0x15, 0x8D, 0x03, 0x16,
+    0xDC, 0x0F, 0x50, 0x0D, 0xBA, 0xE7, 0xD4, 0xC1, 0x8F, 0x9A, 0xC0, 0x31, 0x23, 0x30, 0x6B, 0x8A,
+    0xED, 0xF6, 0x5B, 0x25, 0x63, 0xD4, 0x14, 0x6A, 0x81, 0x86, 0xCF, 0xF9, 0x72, 0xC9, 0xBA, 0x57,
+    0x80, 0x38, 0x77, 0x3A, 0x60, 0x54, 0xFC, 0x88, 0xB6, 0xE8, 0x70, 0xC8, 0x81, 0x32, 0xE9, 0x28,
+    0x7E, 0x6A, 0x04, 0x1B, 0x36, 0x54, 0xFD, 0xA4, 0x4F, 0x91, 0x7E, 0xCD, 0x78, 0x9C, 0x42, 0x3D,
+    0x1B, 0x2E, 0x32, 0x7F, 0x78, 0x25, 0x4D, 0x52, 0x6E, 0x1F, 0xAE, 0xBB, 0x19, 0xB2, 0xC7, 0xAD,
+    0xFE, 0x8E, 0xD0, 0xF5, 0x8C, 0xC6, 0x82, 0x01, 0xE6, 0x15, 0xFB, 0xAF, 0x2F, 0x38, 0x89, 0x58,
+    0x74, 0x3D, 0xA3, 0x23, 0xFC, 0xDE, 0x9A, 0x2D, 0xCB, 0xED, 0x59, 0x6B, 0x94, 0x4E, 0xAF, 0xFF,
+    0x6E, 0x0D, 0x22, 0x39, 0xEA, 0x16, 0x38, 0x19, 0x67, 0x6E, 0x03, 0xC4, 0xED, 0x29, 0xE2, 0xCF,
+    0xE2, 0xD1, 0x66, 0x52, 0x8D, 0xD0, 0x42, 0x31, 0xD5, 0x20, 0xF7, 0xD2, 0x26, 0x94, 0x0D, 0xB5,
+    0x8C, 0xD4, 0xD8, 0x0C, 0xC3, 0xA4, 0x24, 0x97, 0x9B, 0xEC, 0x0D, 0x6E, 0x93, 0x97, 0x12, 0x94,
+    0x37, 0xD8, 0xE6, 0xB5, 0x00, 0xE8, 0x55, 0xCF, 0x81, 0x49, 0xD1, 0xE0, 0x65, 0xA3, 0xA6, 0x7D,
+    0xDB, 0xFB, 0x51, 0xAA, 0xD8, 0x29, 0x24, 0x3A, 0x06, 0x1B, 0x37, 0xB8, 0xB0, 0xA8, 0xD8, 0xF0,
+    0x89, 0x7E, 0xDE, 0xB1, 0x3F, 0xE6, 0x4C, 0x49, 0xA9, 0x8D, 0x11, 0x40, 0x82, 0xF3, 0x42, 0x6D,
+    0x66, 0x62, 0xC8, 0x22, 0x57, 0xCE, 0xDB, 0xD4, 0xDB, 0x78, 0x60, 0xA1, 0xF1, 0xC0, 0xD0, 0x18,
+    0xE0, 0x0B, 0x3F, 0x02, 0x9C, 0xBE, 0x48, 0x02, 0x54, 0x94, 0x36, 0x28, 0x04, 0x11, 0xE0, 0x06,
+    0xC0, 0x39, 0xD0, 0x58, 0xB6, 0xBB, 0x2B, 0x3A, 0x33, 0x25, 0x79, 0x3B, 0xFF, 0x87, 0x24, 0x8A,
+    0x6D, 0x26, 0x42, 0xF6, 0xA7, 0xE9, 0xAE, 0x19, 0xDF, 0x89, 0x6C, 0xD2, 0x12, 0x0C, 0x45, 0x4E,
+    0x0E, 0x38, 0xFC, 0xCC, 0x22, 0x0B, 0xBD, 0x0A, 0x51, 0x4B, 0xCA, 0xEA, 0x4C, 0x6F, 0xF6, 0x71,
+    0x22, 0x35, 0x6D, 0x12, 0x6B, 0x78, 0xD0, 0x24, 0x0C, 0x3F, 0xE0, 0x78, 0xCA, 0x2C, 0x11, 0x07,
+    0x04, 0x73, 0xD6, 0x05, 0xFB, 0xB0, 0x58, 0x44, 0xA3, 0x8D, 0xFB, 0x09, 0x62, 0xCC, 0x4D, 0x75,
+    0xB5, 0x81, 0x74, 0xF1, 0xC0, 0x41, 0x71, 0x76, 0x3D, 0x6C, 0xC4, 0x48, 0x71, 0x21, 0x7D, 0x41,
+    0x12, 0x84, 0x76, 0xB0, 0xC6, 0xF9, 0xF4, 0xA5, 0x89, 0x75, 0xFF, 0x0C, 0x66, 0xFA, 0xDB, 0x37,
+    0x42, 0x83, 0xBD, 0x94, 0xC9, 0x20, 0xDD, 0x1A, 0xB8, 0x8A, 0x55, 0x2E, 0xA9, 0xED, 0x9C, 0x59,
+    0xB3, 0x60, 0xBB, 0x54, 0x82, 0x8D, 0x8D, 0x57, 0x5C, 0x4F, 0x44, 0x00, 0xE1, 0x0A, 0xA5, 0xD6,
+    0x98, 0xBC, 0x91, 0x1E, 0x9A, 0x33, 0x67, 0xC8, 0x04, 0xE6, 0xE5, 0xB1, 0xCD, 0xFC, 0x7F, 0xA2,
+    0x31, 0xB5, 0x40, 0x28, 0x98, 0xF7, 0x80, 0xA1, 0xFA, 0x33, 0x85, 0xBF, 0xB0, 0x79, 0xB4, 0x32,
+    0x46, 0xDB, 0x05, 0xAD, 0x55, 0xE0, 0x1D, 0x3C, 0xEA, 0xDD, 0xF3, 0x94, 0x7E, 0x9F, 0x19, 0xF7,
+    0x39, 0xE3, 0x8A, 0xBC, 0xFD, 0x50, 0x92, 0xBF, 0x00, 0xAD, 0x55, 0x2D, 0x93, 0xD4, 0x5A, 0x10,
+    0xED, 0x24, 0xC5, 0x44, 0x44, 0x04, 0x81, 0xA1, 0x56, 0xC4, 0x3E, 0x97, 0x9F, 0x70, 0xE3, 0x31,
+    0x08, 0x16, 0xE4, 0x2A, 0x34, 0xFF, 0x80, 0xE4, 0xC1, 0x1F, 0x40, 0xF0, 0x03, 0x10, 0x68, 0xFE,
+    0x01, 0x95, 0x14, 0x08, 0x6C, 0x50, 0xD8, 0x31, 0xE8, 0x8D, 0x08, 0xB5, 0x59, 0xDE, 0xBD, 0xE9,
+    0x77, 0x4E, 0xF7, 0x4C, 0xAD, 0xD9, 0x57, 0xCF, 0x30, 0x35, 0x73, 0x33, 0xB9, 0xE9, 0x7B, 0xFA,
+    0xF4, 0xE9, 0x8F, 0x48, 0xAD, 0x9A, 0xAB, 0xCE, 0xF8, 0x1D, 0x83, 0x46, 0x69, 0x74, 0xCB, 0x75,
+    0xEF, 0xA4, 0x8E, 0x92, 0x6B, 0x27, 0x99, 0x0E, 0x12, 0x16, 0x91, 0x76, 0x95, 0x42, 0xC5, 0x7E,
+    0xFD, 0x51, 0xB8, 0x55, 0x25, 0x91, 0x72, 0x17, 0x19, 0x27, 0xDB, 0x82, 0xBD, 0x54, 0x8A, 0x0F,
+    0x6E, 0x79, 0xD9, 0x44, 0x6A, 0x5E, 0xEF, 0x85, 0x08, 0x0E, 0x51, 0x26, 0xBF, 0x1D, 0xE7, 0x3B,
+    0x08, 0x6C, 0x01, 0xA2, 0xD4, 0x5B, 0x19, 0x75, 0x38, 0x93, 0x0A, 0x9A, 0x4A, 0x43, 0x06, 0x24,
+    0xBD, 0x4C, 0x99, 0x02, 0x94, 0x47, 0x09, 0x6E, 0xE7, 0xE9, 0x81, 0x00, 0xF7, 0x6F, 0xEE, 0xF7,
+    0x6C, 0x92, 0x3C, 0x43, 0x3C, 0xC0, 0x17, 0x31, 0x0B, 0x38, 0x13, 0x73, 0xD1, 0xD9, 0x3D, 0xE3,
+    0x18, 0x1C, 0xD0, 0x38, 0x79, 0xE4, 0x0C, 0xC3, 0xCF, 0xFF, 0xDF, 0x13, 0x73, 0x28, 0xFD, 0xFC,
+    0x5F, 0x4F, 0xC8, 0xC5, 0xC8, 0x48, 0x0D, 0xB1, 0x2C, 0xF2, 0xBF, 0xF8, 0xB8, 0xF9, 0xE1, 0x04,
+    0x3A, 0xB0, 0xC3, 0x22, 0xBD, 0x1D, 0x79, 0x4F, 0x5F, 0x24, 0x57, 0x43, 0xDA, 0x51, 0xB7, 0x5E,
+    0x67, 0x8A, 0xD0, 0x27, 0xAA, 0x49, 0xC0, 0x4C, 0x3B, 0xBA, 0xA9, 0x22, 0x63, 0x02, 0x6E, 0x4B,
+    0x64, 0xFD, 0xC2, 0xC3, 0xE5, 0x6E, 0x6E, 0x9A, 0x9B, 0x9D, 0x18, 0xA3, 0x85, 0x89, 0x68, 0x1D,
+    0xD0, 0xF6, 0xFA, 0x6B, 0xE0, 0xC0, 0xDF, 0x55, 0x34, 0xA2, 0x6D, 0x34, 0x6A, 0x81, 0xBC, 0xE0,
+    0x03, 0xB0, 0x48, 0x95, 0xE2, 0x02, 0x50, 0x5C, 0x4A, 0xDD, 0x32, 0x67, 0x91, 0x69, 0x04, 0x10,
+    0x98, 0x4C, 0x46, 0xEF, 0xA1, 0x67, 0x48, 0x5A, 0xA2, 0x36, 0xBA, 0x9D, 0xE4, 0xB1, 0x78, 0x8D,
+    0x96, 0x85, 0x5F, 0x38, 0x27, 0x31, 0x54, 0x0F, 0xDC, 0xC5, 0xB1, 0xA5, 0xD9, 0xCE, 0x82, 0x81,
+    0xF4, 0x63, 0x2E, 0x81, 0x4B, 0x4F, 0x8D, 0x77, 0x88, 0x76, 0x60, 0x29, 0x68, 0x6C, 0x59, 0x63,
+    0x01, 0xCB, 0x02, 0x78, 0xD6, 0x90, 0xFD, 0x26, 0xA8, 0x35, 0x41, 0x3C, 0x1C, 0xB2, 0x74, 0x27,
+    0xB0, 0xA0, 0x1A, 0xDA, 0xD5, 0x3A, 0x93, 0xD2, 0x5C, 0x32, 0x8C, 0xEA, 0x9F, 0xAD, 0xB8, 0x61,
+    0x5D, 0xFC, 0xDE, 0xB3, 0x48, 0x36, 0xB1, 0x9F, 0x52, 0x00, 0xD3, 0xB1, 0x59, 0xF0, 0xC5, 0x81,
+    0xB7, 0x31, 0x94, 0x30, 0xA8, 0x67, 0x7D, 0xF5, 0x06, 0x06, 0xE5, 0x12, 0xAE, 0x27, 0x54, 0x7A,
+    0x11, 0x2B, 0x3D, 0x52, 0xD9, 0x94, 0xE9, 0xC2, 0xB4, 0x81, 0xD6, 0xC6, 0xEA, 0x6A, 0x27, 0x90,
+    0x87, 0xCB, 0xFA, 0x58, 0x24, 0x96, 0x77, 0xB9, 0xCA, 0xC8, 0xBC, 0xE6, 0x51, 0xDA, 0x0E, 0x5B,
+    0x07, 0x7D, 0x27, 0x72, 0xA1, 0x6B, 0x85, 0x6A, 0x06, 0x8D, 0xDD, 0xE4, 0xB7, 0x24, 0x07, 0xB5,
+    0x5C, 0xB4, 0x96, 0x4F, 0x14, 0x21, 0x0E, 0x10, 0x07, 0x4F, 0xE8, 0x17, 0xB9, 0x0A, 0x03, 0xB4,
+    0x43, 0x63, 0xCE, 0x56, 0x90, 0xD5, 0xCA, 0x70, 0x96, 0x82, 0xE4, 0x90, 0x34, 0xDA, 0xFC, 0xD2,
+    0x89, 0x36, 0x31, 0xAC, 0x66, 0x53, 0x6A, 0xC5, 0x08, 0x26, 0xFD, 0x4A, 0x57, 0xC7, 0x76, 0xA3,
+    0xA7, 0xB5, 0xD0, 0x9E, 0x36, 0xD0, 0x88, 0x36, 0xC0, 0xA7, 0xCD, 0x90, 0x1B, 0x9D, 0x59, 0xFA,
+    0x9D, 0x36, 0xD8, 0x1D, 0x40, 0x6A, 0xC8, 0x60, 0xC3, 0xEC, 0x41, 0xF6, 0x5A, 0x93, 0x50, 0x08,
+    0x7E, 0x9E, 0xDA, 0x7A, 0xD9, 0x31, 0x3F, 0xCC, 0x6D, 0x6E, 0xED, 0xCD, 0x2E, 0x9F, 0x25, 0xEC,
+    0xCF, 0x81, 0x88, 0x6F, 0x8F, 0xF1, 0x31, 0x49, 0x40, 0x59, 0x74, 0xD2, 0x40, 0x2D, 0xC0, 0xA7,
+    0x1A, 0x19, 0xAE, 0x53, 0x43, 0xCA, 0x89, 0xA5, 0xD5, 0x24, 0x56, 0x56, 0x13, 0xB9, 0xB6, 0xB6,
+    0x86, 0xCD, 0xD6, 0x95, 0xEB, 0xB8, 0x04, 0xD8, 0xE8, 0xDC, 0x26, 0x08, 0x33, 0xD5, 0xE4, 0x0A,
+    0x52, 0x3F, 0x47, 0xDE, 0x32, 0xDD, 0x1C, 0x2F, 0xC3, 0xB9, 0xBC, 0xE4, 0x91, 0x91, 0x7A, 0x70,
+    0x69, 0xA4, 0xA0, 0x56, 0x69, 0x36, 0xAD, 0xAD, 0x2F, 0xF5, 0x0D, 0x77, 0x12, 0x19, 0xB5, 0x0B,
+    0xCB, 0x4E, 0x99, 0x26, 0xFC, 0x41, 0x64, 0xCD, 0xC6, 0xB2, 0xEC, 0x67, 0x1B, 0x74, 0x02, 0xBB,
+    0x3A, 0xBD, 0xDA, 0xA9, 0x2D, 0xA2, 0xC9, 0x6C, 0x7E, 0x55, 0xFA, 0xF1, 0xDC, 0xA1, 0xDE, 0xE5,
+    0x85, 0xF5, 0x8A, 0x15, 0xA8, 0x77, 0x6F, 0x73, 0x92, 0x61, 0xB5, 0xBA, 0x9F, 0xEE, 0xF4, 0x71,
+    0x81, 0x88, 0xC3, 0xF2, 0x73, 0x89, 0x4E, 0x1A, 0x51, 0xA4, 0x11, 0x85, 0x61, 0x2A, 0x09, 0x65,
+    0x82, 0x24, 0xAE, 0x93, 0xB8, 0x50, 0xE2, 0x4A, 0x89, 0x4B, 0x25, 0xAE, 0x95, 0xB8, 0x58, 0x7E,
+    0xD9, 0xC4, 0xE5, 0xB2, 0x4B, 0xBF, 0x88, 0x0B, 0x46, 0x2B, 0xC2, 0x9A, 0x5E, 0xA4, 0xFF, 0x7D,
+    0xB4, 0x81, 0x68, 0xA2, 0x89, 0x53, 0x41, 0x7C, 0x1F, 0xC8, 0xAF, 0xB2, 0x1B, 0x10, 0xBC, 0x15,
+    0xA7, 0x6B, 0x57, 0xDA, 0x7E, 0xE2, 0x38, 0x50, 0xF5, 0x79, 0xA0, 0x96, 0xFA, 0x0B, 0x9B, 0x18,
+    0x72, 0xA7, 0xF4, 0xC1, 0xF4, 0x81, 0x95, 0x35, 0xDD, 0x35, 0x7C, 0x5E, 0xEA, 0xDF, 0x30, 0xC2,
+    0x0C, 0x02, 0x9B, 0xDC, 0xF4, 0x75, 0x95, 0x21, 0x19, 0xBB, 0x81, 0x8D, 0x8B, 0x44, 0x50, 0xF1,
+    0x2A, 0x5E, 0xA8, 0x49, 0xE2, 0x6F, 0x08, 0xCB, 0x24, 0x5B, 0xB0, 0x5D, 0x7C, 0x6E, 0x51, 0xC6,
+    0xB0, 0xD8, 0x4B, 0xE6, 0x68, 0xE1, 0xCD, 0x54, 0x65, 0x9C, 0x50, 0x97, 0x98, 0x3B, 0x05, 0xDA,
+    0x0F, 0xC3, 0x45, 0x23, 0x5F, 0x0B, 0xAD, 0x65, 0x22, 0xC3, 0xB1, 0x07, 0xCF, 0xD8, 0x2B, 0x00,
+    0x18, 0xD9, 0x22, 0x0A, 0x8B, 0xFE, 0x58, 0xAE, 0x20, 0x52, 0x33, 0xE1, 0x1C, 0x20, 0xD9, 0xCA,
+    0x1C, 0x83, 0xD5, 0x42, 0x4B, 0xCE, 0x00, 0x8D, 0xA7, 0xA5, 0xE4, 0x92, 0x93, 0x0F, 0x9B, 0x1A,
+    0xEF, 0x96, 0xA9, 0x87, 0x1D, 0x7A, 0xA5, 0x8E, 0xF5, 0x0A, 0xA0, 0x80, 0xAE, 0xA5, 0x7C, 0xAB,
+    0xA7, 0xB3, 0x67, 0x2E, 0xE9, 0x94, 0x45, 0xA6, 0x5F, 0xB9, 0x44, 0x0E, 0x22, 0xFD, 0x76, 0x7B,
+    0x95, 0x5E, 0x6C, 0x23, 0x6A, 0x25, 0x3C, 0x39, 0x36, 0x5B, 0xB1, 0x7C, 0xC6, 0xCC, 0x7B, 0x9D,
+    0x0F, 0x61, 0x39, 0x0C, 0xA7, 0x97, 0x05, 0x5F, 0x7C, 0x3E, 0xFA, 0xBC, 0x80, 0x6C, 0xE2, 0x79,
+    0x71, 0x59, 0x59, 0xD9, 0x90, 0xF4, 0xE9, 0x77, 0x3A, 0xB0, 0x9C, 0x0F, 0xF0, 0x35, 0xC5, 0x8C,
+    0xB0, 0x6F, 0x7D, 0x68, 0xFF, 0x91, 0xCF, 0xBF, 0xD5, 0x55, 0xB1, 0x8E, 0xDE, 0x44, 0x10, 0x1E,
+    0xDB, 0x20, 0x17, 0x2E, 0x4C, 0x93, 0x86, 0x66, 0x7B, 0x84, 0xE4, 0x17, 0x40, 0x5A, 0x0B, 0x1E,
+    0x80, 0x34, 0x88, 0x57, 0x20, 0x15, 0x8F, 0xB0, 0xA6, 0x4E, 0x73, 0x0F, 0x41, 0xC3, 0x35, 0xBC,
+    0x41, 0x76, 0xA5, 0x14, 0x29, 0x28, 0x62, 0xD2, 0xD2, 0x98, 0x80, 0x68, 0x52, 0xDC, 0x4A, 0x58,
+    0xE0, 0xDC, 0xAD, 0x3D, 0x7C, 0xDF, 0xF8, 0x27, 0xE4, 0x24, 0x24, 0x84, 0x44, 0xC3, 0xEA, 0xBF,
+    0x91, 0xBD, 0xDE, 0x9D, 0xF9, 0xE6, 0x9B, 0x6F, 0xE6, 0x9C, 0x1E, 0xB5, 0xEA, 0x53, 0xD5, 0xD9,
+    0x6B, 0x19, 0x74, 0xAD, 0x75, 0x97, 0x61, 0x95, 0x5A, 0xF9, 0x13, 0xBF, 0x88, 0xCF, 0xD2, 0xEC,
+    0xD2, 0xE0, 0x25, 0x24, 0x09, 0x8B, 0xB4, 0x45, 0xBA, 0x5D, 0x24, 0x4E, 0xA2, 0x49, 0xFA, 0x55,
+    0xFA, 0x22, 0xA2, 0x23, 0x5F, 0x5C, 0x16, 0xB7, 0x49, 0xC5, 0x9B, 0xA3, 0x0C, 0x6F, 0xDF, 0xF4,
+    0x89, 0x2F, 0x5D, 0xB1, 0x17, 0x7C, 0xF4, 0x9B, 0x04, 0x7C, 0xD4, 0xDB, 0x08, 0x4F, 0x4E, 0x15,
+    0x5B, 0x12, 0x00, 0x41, 0xE0, 0xD7, 0xAC, 0x3C, 0xA0, 0x09, 0xBA, 0x35, 0xAA, 0x83, 0x1E, 0x95,
+    0xEA, 0x33, 0xE0, 0x72, 0x3A, 0x0D, 0x0C, 0x30, 0xB6, 0x07, 0xDC, 0x18, 0x80, 0x60, 0x9E, 0x01,
+    0x13, 0x30, 0x10, 0x1F, 0x98, 0x01, 0x09, 0xBB, 0x40, 0x89, 0xA7, 0x06, 0xB6, 0xD9, 0x2B, 0x9C,
+    0xC6, 0x71, 0x84, 0x06, 0xAA, 0x88, 0x50, 0x5D, 0x01, 0x20, 0xF8, 0x19, 0x18, 0xCA, 0x3F, 0x5F,
+    0x60, 0x7B, 0xCD, 0xB0, 0x8D, 0x6E, 0x8C, 0x1B, 0x0B, 0xAD, 0xDB, 0x69, 0x5B, 0x5E, 0xC3, 0x75,
+    0x79, 0xB3, 0xC0, 0x93, 0x7C, 0x2D, 0xAA, 0xDF, 0xEA, 0x21, 0x4F, 0x80, 0xF1, 0x05, 0x90, 0xF9,
+    0xD4, 0xE9, 0x82, 0xE4, 0x87, 0xCC, 0xD8, 0x07, 0xD1, 0xF8, 0xB9, 0xD2, 0xA9, 0x53, 0xA2, 0xF2,
+    0xB9, 0xD1, 0x64, 0x54, 0xD5, 0x9A, 0x1B, 0x63, 0x41, 0x4B, 0x0D, 0xF7, 0x9A, 0xA2, 0xD2, 0xF5,
+    0x90, 0x7D, 0x48, 0x40, 0xD6, 0x15, 0xF7, 0x5D, 0x06, 0xB6, 0x5A, 0xFB, 0x17, 0x3B, 0xD1, 0x85,
+    0x67, 0x39, 0x7E, 0x0A, 0x64, 0xEE, 0xD7, 0xD5, 0xFD, 0xB0, 0x32, 0x99, 0xD2, 0xDE, 0x11, 0x23,
+    0x39, 0x29, 0x06, 0x46, 0xFC, 0x61, 0xF8, 0xA7, 0x5E, 0x2D, 0x83, 0xD4, 0x80, 0x19, 0xE4, 0xB0,
+    0x90, 0x1E, 0xBA, 0x26, 0x3B, 0xC8, 0x63, 0x93, 0x3E, 0xCB, 0x5B, 0x6B, 0xD0, 0xD2, 0x23, 0x5D,
+    0xD5, 0x25, 0xE8, 0xCC, 0xAA, 0x87, 0xD7, 0xE7, 0xAD, 0x91, 0xB8, 0xC8, 0x62, 0xAD, 0x13, 0xD9,
+    0x6A, 0xB4, 0x63, 0xC4, 0x6E, 0x0F, 0x93, 0x05, 0xDA, 0xCE, 0xDB, 0xC9, 0xB8, 0x28, 0x27, 0x3B,
+    0x56, 0xB3, 0xEE, 0xDC, 0x8B, 0xF4, 0x20, 0xED, 0x9D, 0x51, 0x16, 0x1E, 0x93, 0xC5, 0xB6, 0xF4,
+    0x06, 0x36, 0x79, 0xCB, 0x81, 0xC5, 0x07, 0x3F, 0xBC, 0xD6, 0xE9, 0x55, 0xAB, 0x3F, 0x03, 0xC5,
+    0xAC, 0x9A, 0x5B, 0x55, 0xFC, 0xA6, 0x0B, 0x34, 0x43, 0xF6, 0x92, 0xC0, 0x76, 0xA6, 0x12, 0x27,
+    0x14, 0x17, 0x65, 0x6D, 0xC9, 0x36, 0xA9, 0xDC, 0x99, 0x9C, 0x43, 0x6E, 0x61, 0x66, 0x28, 0x7D,
+    0x9E, 0x09, 0xF9, 0x44, 0xBC, 0x19, 0x52, 0xC2, 0x71, 0x86, 0x30, 0x90, 0x82, 0xDA, 0x80, 0x75,
+    0xB6, 0xE1, 0x8D, 0x0B, 0x3B, 0x41, 0x31, 0x49, 0x15, 0x8F, 0x91, 0x59, 0x99, 0xA7, 0x33, 0xC5,
+    0x40, 0x5D, 0x62, 0x47, 0x73, 0x0F, 0x53, 0x9A, 0xD7, 0xE3, 0xB0, 0x57, 0x50, 0xD9, 0x21, 0x41,
+    0x7A, 0x94, 0x78, 0x34, 0xC2, 0xCD, 0x74, 0xF4, 0xDC, 0x9E, 0x66, 0x62, 0x7C, 0x33, 0xE9, 0x62,
+    0x6A, 0xD2, 0x53, 0xE9, 0x5C, 0x5D, 0x55, 0xBA, 0x48, 0x11, 0x98, 0x20, 0xD0, 0x9B, 0x4F, 0x31,
+    0xCB, 0x97, 0x99, 0x71, 0x36, 0x0B, 0x81, 0x46, 0xD4, 0xE3, 0x52, 0x9E, 0x0A, 0x20, 0xA0, 0x29,
+    0x16, 0x98, 0x0A, 0x41, 0xF9, 0x84, 0x82, 0xC0, 0x23, 0x45, 0xCD, 0xB4, 0x91, 0x29, 0x1F, 0x59,
+    0x55, 0x74, 0x01, 0x45, 0xDE, 0xAD, 0xD6, 0x6A, 0xFF, 0xEE, 0xFC, 0x2D, 0x0E, 0x81, 0x55, 0x3D,
+    0xC5, 0x31, 0x00, 0x79, 0x14, 0xFB, 0xCA, 0xC3, 0x3C, 0xD1, 0x2F, 0xA7, 0xD7, 0x30, 0x9A, 0xBB,
+    0xBA, 0x9C, 0xDE, 0xE9, 0x87, 0x11, 0xFC, 0x64, 0xDB, 0xD5, 0x7E, 0xB9, 0x91, 0xCF, 0x68, 0xBC,
+    0xC1, 0x5A, 0x5C, 0x1C, 0xB5, 0xEB, 0x79, 0xE3, 0xC1, 0x08, 0x3A, 0x20, 0x45, 0x50, 0xE2, 0xFF,
+    0xB3, 0x5C, 0xEA, 0x43, 0xAC, 0xED, 0xEF, 0x9F, 0xFF, 0x40, 0xA5, 0xB2, 0xCC, 0x96, 0xBF, 0x44,
+    0xDF, 0xEC, 0x36, 0x0A, 0xE0, 0x80, 0x0A, 0xC4, 0x35, 0x77, 0x03, 0x2D, 0xFD, 0xB4, 0x4A, 0xB3,
+    0x62, 0x6C, 0x95, 0x21, 0xC9, 0xD1, 0x60, 0x36, 0x8D, 0xE8, 0xAA, 0xE4, 0x66, 0xB7, 0x34, 0x05,
+    0xF9, 0x28, 0x42, 0xB9, 0x97, 0x87, 0x45, 0xC4, 0xFA, 0x0C, 0xCB, 0xA3, 0x52, 0x37, 0xF8, 0xBB,
+    0xBD, 0xBE, 0xBE, 0xFE, 0xE6, 0x1D, 0xC9, 0xFD, 0xE2, 0xE7, 0x98, 0x42, 0x0A, 0xE3, 0x47, 0x3C,
+    0xF2, 0xA8, 0x7A, 0x88, 0xB8, 0x10, 0x24, 0xE4, 0x93, 0x25, 0xDE, 0x29, 0x67, 0x41, 0x4C, 0xCD,
+    0x21, 0x31, 0x41, 0x7F, 0xE8, 0x55, 0x34, 0x1E, 0x26, 0x03, 0x66, 0xE5, 0x80, 0xD9, 0x80, 0x0E,
+    0x85, 0x08, 0xFD, 0xD2, 0x43, 0xDA, 0xCB, 0x40, 0xF3, 0xA4, 0x7C, 0xE8, 0x7F, 0x7B, 0xCD, 0x81,
+    0xFC, 0xA3, 0x6E, 0x4E, 0xBF, 0xD2, 0xA5, 0x3B, 0xD8, 0x99, 0x0F, 0xE5, 0x3D, 0x91, 0x77, 0x4D,
+    0xA9, 0x97, 0x99, 0x15, 0xF5, 0x6C, 0xF2, 0x33, 0x35, 0x32, 0xC0, 0xD1, 0x87, 0x6E, 0xF9, 0x02,
+    0xEC, 0x84, 0x55, 0x30, 0x3E, 0x53, 0xFF, 0x4A, 0x4B, 0x75, 0x6C, 0x71, 0x1E, 0x8E, 0x66, 0x87,
+    0x24, 0xFD, 0x8C, 0x89, 0xB4, 0x23, 0x24, 0x00, 0x03, 0x0F, 0xDA, 0x1B, 0xD3, 0x71, 0x74, 0xB9,
+    0xCF, 0xB5, 0x02, 0x52, 0x40, 0x9B, 0x3A, 0x4E, 0xDE, 0x83, 0x3D, 0x30, 0xB5, 0xBF, 0x9B, 0x7E,
+    0xD9, 0x3B, 0xF2, 0xFE, 0xC8, 0xB6, 0xC2, 0x38, 0x9E, 0x6C, 0x2A, 0x7F, 0x9C, 0x41, 0xFB, 0x18,
+    0x93, 0x05, 0x77, 0x44, 0x83, 0x47, 0x16, 0x63, 0xB3, 0x0E, 0x9B, 0x34, 0xB9, 0x4F, 0xF4, 0xD5,
+    0xDE, 0x5A, 0x0F, 0x1D, 0xD0, 0xF3, 0x74, 0xF1, 0x23, 0x20, 0xE8, 0x9C, 0xB3, 0xB5, 0xFE, 0x69,
+    0xCE, 0xCE, 0xEC, 0xAD, 0x75, 0x57, 0x39, 0x8B, 0xFB, 0x08, 0x4E, 0x5B, 0xBD, 0x59, 0x48, 0xE4,
+    0x4C, 0x22, 0xD3, 0x1B, 0x22, 0x27, 0x12, 0x39, 0xDE, 0x23, 0xF2, 0xB8, 0x4F, 0x64, 0xF9, 0x27,
+    0x22, 0x99, 0x8E, 0xD3, 0x54, 0x33, 0x9D, 0x5F, 0xB4, 0xDA, 0x9B, 0xD2, 0x2F, 0x6E, 0x89, 0x28,
+    0xF8, 0xD6, 0xAD, 0xEE, 0x7B, 0x1D, 0x63, 0x5C, 0x1B, 0xE0, 0xEE, 0xF9, 0x2F, 0x6B, 0x96, 0x2B,
+    0x70, 0xF4, 0x54, 0x3F, 0x3F, 0xFE, 0x26, 0x9D, 0xFF, 0xEF, 0xFA, 0x03, 0xAD, 0x55, 0xBD, 0x6E,
+    0xE6, 0x44, 0x14, 0x1D, 0xDB, 0x1B, 0x59, 0x5A, 0x17, 0x43, 0xC1, 0x16, 0xEC, 0x0A, 0xB9, 0xA1,
+    0x21, 0x14, 0xE6, 0x01, 0x90, 0xC6, 0x62, 0x1F, 0x60, 0x53, 0x90, 0x02, 0x9A, 0x50, 0xA4, 0xD8,
+    0xAD, 0xF2, 0x02, 0x08, 0x7B, 0x43, 0x41, 0x41, 0xB3, 0xE2, 0x09, 0x22, 0x91, 0x06, 0x51, 0x84,
+    0x17, 0x40, 0xE3, 0x2C, 0xC5, 0x96, 0xB1, 0xA0, 0xA0, 0x8C, 0xF9, 0xD1, 0x4A, 0x40, 0xF1, 0x99,
+    0xC5, 0xB0, 0x5E, 0x18, 0xCF, 0xE5, 0x9C, 0xEB, 0x7C, 0x52, 0x0A, 0xE8, 0xB0, 0x94, 0x9B, 0xCF,
+    0xF3, 0x73, 0x7F, 0xCE, 0x39, 0xF7, 0xDA, 0x18, 0x63, 0xDE, 0x38, 0x81, 0x49, 0x65, 0x81, 0xB5,
+    0x22, 0xB0, 0xD5, 0xD3, 0x08, 0xEB, 0xBA, 0x0F, 0x60, 0x7D, 0x0B, 0x63, 0xA4, 0x86, 0x49, 0xB8,
+    0x87, 0x83, 0xB4, 0x47, 0x82, 0xA5, 0x54, 0x78, 0x3C, 0x13, 0xE1, 0xF1, 0x3C, 0x70, 0xBD, 0x50,
+    0x6B, 0x67, 0xB5, 0x13, 0x6D, 0xB9, 0xDA, 0x91, 0xB6, 0x52, 0xEB, 0x06, 0xB5, 0x3D, 0x6D, 0xB3,
+    0xDA, 0x8E, 0xD6, 0xAB, 0x95, 0x7F, 0x0F, 0x98, 0x31, 0xC6, 0x5B, 0x1A, 0xC4, 0x9F, 0xD1, 0xBD,
+    0x08, 0xDD, 0x78, 0x3D, 0x7E, 0xE7, 0x27, 0xA3, 0x4F, 0xF2, 0x79, 0xAD, 0x3B, 0xD2, 0x9B, 0x92,
+    0xB9, 0x25, 0x72, 0x1C, 0x4F, 0x91, 0x0D, 0xAF, 0xB9, 0xCE, 0x8E, 0xF4, 0x88, 0x58, 0xF9, 0x4C,
+    0x6F, 0x76, 0x64, 0x52, 0xEE, 0x29, 0x43, 0x39, 0x61, 0x66, 0xD5, 0x0B, 0x86, 0x8B, 0x9A, 0xA9,
+    0xE6, 0x25, 0xBD, 0xC6, 0x67, 0xB8, 0x86, 0x45, 0x96, 0x11, 0x65, 0x27, 0x52, 0x57, 0x82, 0xDB,
+    0xC6, 0x2E, 0x70, 0xCA, 0x1F, 0xF0, 0xE0, 0xBB, 0x4C, 0x1E, 0x1D, 0x2C, 0x26, 0xD7, 0xE0, 0x80,
+    0x84, 0x77, 0x8E, 0x7E, 0xA6, 0x93, 0x1D, 0xF8, 0x2F, 0xA4, 0x63, 0xAE, 0x84, 0x2C, 0x6C, 0x71,
+    0x60, 0xE6, 0xD9, 0xB2, 0xC5, 0xC6, 0x77, 0xAF, 0xE3, 0xCD, 0xC2, 0xF1, 0x6F, 0x38, 0xE2, 0x2E,
+    0x65, 0x4A, 0xE2, 0xE2, 0x7A, 0x5C, 0x14, 0xE3, 0x02, 0x0A, 0x90, 0xBE, 0x1A, 0x72, 0x41, 0xAC,
+    0x6A, 0xCA, 0xF0, 0xD6, 0x95, 0x23, 0x8A, 0xF0, 0x6D, 0x39, 0xC1, 0x47, 0x83, 0xDA, 0x3E, 0x45,
+    0x69, 0x9B, 0x8B, 0x39, 0x95, 0xE8, 0xFA, 0x5C, 0xBE, 0x17, 0xA6, 0x87, 0xE0, 0x2B, 0x2E, 0xC8,
+    0x74, 0x2C, 0xC4, 0xF8, 0x3E, 0x9F, 0x57, 0xA4, 0xEE, 0xA7, 0x32, 0x7A, 0xB9, 0xE9, 0x87, 0x94,
+    0x45, 0xC0, 0xBD, 0x6F, 0x41, 0x97, 0x18, 0xF5, 0x0A, 0x07, 0xE1, 0xB5, 0x66, 0xF3, 0x89, 0x4C,
+    0x3E, 0x66, 0xB1, 0x5E, 0x7D, 0xE8, 0x53, 0x75, 0xC4, 0x03, 0x05, 0xA9, 0x73, 0xA7, 0x89, 0x9B,
+    0xEB, 0xCF, 0xBB, 0x84, 0x6A, 0xA1, 0x28, 0x40, 0xFB, 0x4D, 0xE2, 0xA7, 0x24, 0xE6, 0xFF, 0x59,
+    0xF5, 0x15, 0xB3, 0xAA, 0x18, 0xB7, 0x3D, 0xAE, 0x2A, 0x52, 0x99, 0x5C, 0x7F, 0xBB, 0xC1, 0xBD,
+    0xB9, 0x9C, 0x09, 0x72, 0x07, 0x82, 0x49, 0x2A, 0xDD, 0xDD, 0x7E, 0xB4, 0x85, 0xD9, 0x87, 0x15,
+    0xE5, 0x8A, 0x70, 0x33, 0x1C, 0xDD, 0x02, 0xAD, 0xD5, 0xAB, 0x6F, 0x0F, 0x8D, 0x3B, 0x97, 0xCE,
+    0x3E, 0x93, 0x39, 0x7B, 0xFE, 0x97, 0x24, 0x71, 0x70, 0xAD, 0x1F, 0xEC, 0x00, 0x6C, 0x46, 0x3B,
+    0xE5, 0x53, 0x1E, 0x8A, 0x29, 0x15, 0x0F, 0x42, 0xE1, 0xD6, 0x6D, 0x06, 0x53, 0xFE, 0x0E, 0x46,
+    0x43, 0xD3, 0xA7, 0xB1, 0x88, 0x40, 0x9E, 0xD0, 0x5A, 0x39, 0x18, 0xB5, 0x88, 0xC4, 0x98, 0x5B,
+    0x08, 0x58, 0xC9, 0x63, 0x51, 0xF4, 0x66, 0x1C, 0x28, 0x47, 0x88, 0xD5, 0x0D, 0xCA, 0x48, 0x71,
+    0x0D, 0xD3, 0xEB, 0xAB, 0x6F, 0xFA, 0xCD, 0x3D, 0x19, 0x65, 0xC9, 0x23, 0xC9, 0x49, 0x0E, 0xCD,
+    0xA1, 0x79, 0xC5, 0xF8, 0xA9, 0x0C, 0x85, 0x58, 0xF9, 0x81, 0x3B, 0xBB, 0x72, 0x24, 0x97, 0x32,
+    0xA7, 0x71, 0x96, 0xAF, 0xDC, 0x60, 0xE5, 0xAE, 0xF4, 0x52, 0xBB, 0xD9, 0x2E, 0x79, 0x48, 0xA4,
+    0x6B, 0x20, 0xDB, 0x62, 0x01, 0x09, 0xD2, 0xBA, 0xD1, 0x06, 0x78, 0xC5, 0x8F, 0xBE, 0x1C, 0xB9,
+    0x09, 0x3C, 0xB1, 0xC9, 0x35, 0xDF, 0xE2, 0xE6, 0xF4, 0x19, 0x36, 0x6B, 0xB7, 0xB9, 0x98, 0xB8,
+    0x19, 0x1B, 0x6C, 0xE6, 0xF2, 0x0C, 0xAA, 0xA9, 0x95, 0x3E, 0xAD, 0x01, 0xE1, 0x1F, 0x18, 0x3F,
+    0x97, 0x0B, 0x83, 0x87, 0x5D, 0x39, 0x93, 0x11, 0x81, 0x7D, 0x67, 0xE5, 0x21, 0x85, 0x57, 0xCC,
+    0x08, 0x09, 0x19, 0xA2, 0x7C, 0xD0, 0x4D, 0x19, 0xB6, 0x90, 0xE1, 0xA2, 0xB5, 0x52, 0x35, 0x70,
+    0xF9, 0x35, 0x1C, 0x6E, 0xEE, 0x4D, 0x99, 0x04, 0x94, 0x27, 0xDF, 0x44, 0x53, 0xCE, 0x5B, 0xE1,
+    0xDD, 0xAE, 0x81, 0x7C, 0xE4, 0x9C, 0x18, 0x33, 0xD9, 0x20, 0xE9, 0x44, 0xBD, 0x8E, 0xD2, 0x16,
+    0xC1, 0xF5, 0xA9, 0x80, 0x22, 0x7F, 0x01, 0xB5, 0xFF, 0x18, 0x31, 0x2C, 0xA4, 0xCD, 0x03, 0x50,
+    0x8A, 0x36, 0xA4, 0x92, 0xCA, 0xDB, 0x52, 0x37, 0x68, 0xB6, 0x82, 0x73, 0xA6, 0xA1, 0x42, 0xF6,
+    0x98, 0xEF, 0x61, 0x72, 0x0A, 0xE2, 0xEF, 0x82, 0x43, 0xF9, 0x56, 0xA6, 0xF4, 0xEC, 0x39, 0xBC,
+    0x43, 0x6A, 0xA0, 0x5B, 0x46, 0x38, 0x6B, 0x26, 0xA0, 0x5E, 0xCE, 0x99, 0x50, 0x33, 0xD2, 0xAA,
+    0x94, 0x95, 0x00, 0x76, 0xC8, 0x6C, 0x34, 0x73, 0x3B, 0x61, 0x39, 0x8B, 0x19, 0xA7, 0x03, 0xC7,
+    0x97, 0xA7, 0x71, 0xEC, 0x6E, 0x3B, 0xBD, 0xBC, 0xAA, 0xE5, 0x6A, 0xF0, 0xE8, 0x3C, 0x72, 0x93,
+    0x4E, 0x19, 0x4E, 0x0A, 0x0A, 0x6E, 0x67, 0x7F, 0x5F, 0x91, 0x7B, 0x90, 0xEC, 0x21, 0x11, 0xD7,
+    0xA5, 0x1C, 0x7E, 0x55, 0x44, 0xB7, 0x4A, 0x0B, 0xD0, 0x40, 0x1A, 0xAE, 0x69, 0x08, 0xD7, 0x29,
+    0xEF, 0x5C, 0xC4, 0x5B, 0x33, 0xE0, 0x1F, 0xB8, 0x18, 0x2A, 0x24, 0x76, 0xFC, 0x37, 0xE0, 0x38,
+    0x6A, 0x5A, 0x2B, 0x33, 0xD0, 0x92, 0x8F, 0x27, 0x53, 0x4D, 0x18, 0x38, 0x3B, 0xAA, 0x76, 0x4D,
+    0x60, 0x6D, 0x8E, 0x76, 0x6D, 0x8E, 0x94, 0x72, 0xB4, 0xCC, 0xF0, 0xD6, 0x3E, 0x50, 0x38, 0x4C,
+    0x4E, 0xAA, 0x58, 0x04, 0x89, 0x55, 0xF8, 0x22, 0x36, 0x21, 0x59, 0x28, 0x95, 0xE9, 0xA5, 0x4C,
+    0xE7, 0x4E, 0x8B, 0xE6, 0x40, 0xC7, 0xB0, 0x9A, 0xB0, 0xCA, 0x9F, 0xF3, 0x97, 0xAD, 0xC0, 0x66,
+    0x65, 0x4B, 0xB1, 0xC9, 0xD6, 0x79, 0xFB, 0x5E, 0x8D, 0xE0, 0x3D, 0x66, 0x55, 0x5B, 0xFD, 0x12,
+    0x51, 0xF2, 0x97, 0x6C, 0xB4, 0x92, 0x5D, 0xB5, 0xAC, 0x4D, 0xCC, 0x3F, 0xC7, 0xF7, 0xD9, 0xE2,
+    0xAA, 0x37, 0xFE, 0x23, 0xC9, 0x02, 0x3E, 0x11, 0x43, 0x89, 0x64, 0x0A, 0x36, 0xB7, 0x92, 0x72,
+    0xA2, 0x73, 0x81, 0x98, 0x31, 0x1E, 0x62, 0xDC, 0x11, 0x34, 0x85, 0x44, 0x9C, 0xD4, 0x56, 0x61,
+    0xBB, 0xB3, 0x20, 0xE0, 0x99, 0x6D, 0x0F, 0xF5, 0x7A, 0xBE, 0x08, 0x49, 0xED, 0xC6, 0xCA, 0xC8,
+    0xAF, 0x01, 0x69, 0x60, 0xD8, 0x81, 0x1E, 0xF0, 0x9D, 0xD4, 0x3A, 0x49, 0x92, 0x77, 0x4A, 0xA9,
+    0xED, 0x84, 0x1E, 0xAF, 0xC6, 0x5D, 0x1A, 0x8A, 0x79, 0xA0, 0x10, 0x7B, 0x9D, 0xE3, 0x8A, 0xB5,
+    0xEA, 0x9F, 0xF2, 0xAE, 0xA1, 0x7B, 0x0C, 0xBD, 0xA9, 0xE0, 0x6C, 0x2E, 0x49, 0xFA, 0x87, 0xF2,
+    0x6A, 0xF9, 0x27, 0x70, 0x2A, 0xD1, 0x54, 0xA1, 0xC4, 0x20, 0x9D, 0x80, 0x4B, 0xD3, 0x22, 0xE9,
+    0x1B, 0x26, 0x79, 0xDF, 0xDC, 0xC7, 0x49, 0xF9, 0x0E, 0xC5, 0xBC, 0x10, 0xDC, 0x64, 0xF3, 0xA0,
+    0x8F, 0x2A, 0x74, 0x8D, 0x45, 0x07, 0x80, 0x05, 0xFF, 0x70, 0x81, 0x13, 0x01, 0x21, 0x4D, 0x6D,
+    0xC4, 0x71, 0x22, 0x60, 0xDA, 0x2B, 0xCA, 0xA8, 0x9C, 0x5F, 0x1F, 0xC2, 0x59, 0x0C, 0x57, 0x9F,
+    0x9E, 0x3D, 0x73, 0xBA, 0xBA, 0xAC, 0xE5, 0x09, 0x66, 0xF5, 0x58, 0xFE, 0xE1, 0x43, 0x86, 0x56,
+    0x4C, 0xB8, 0xE4, 0x6B, 0xD7, 0x83, 0x7B, 0x28, 0xC3, 0xCE, 0x74, 0x9F, 0x4B, 0x36, 0x9B, 0xE6,
+    0x58, 0xCE, 0x83, 0xB1, 0x03, 0x26, 0x31, 0x83, 0x04, 0xC7, 0x30, 0x1E, 0x50, 0xBA, 0xCD, 0xC1,
+    0x25, 0x43, 0x3D, 0x41, 0x90, 0x54, 0xCE, 0x29, 0x3E, 0xDF, 0x37, 0x23, 0xBF, 0x4A, 0xC4, 0x31,
+    0xEF, 0xB3, 0xD1, 0xFC, 0x4F, 0xCF, 0x3F, 0x95, 0x55, 0x31, 0x6F, 0xDD, 0x54, 0x14, 0x3E, 0xF6,
+    0x6D, 0x62, 0x84, 0x87, 0x0B, 0x12, 0x0F, 0xA1, 0x54, 0xF4, 0xAE, 0x1D, 0x00, 0xAF, 0x0C, 0x69,
+    0x7C, 0xD3, 0xA5, 0x23, 0x41, 0xEA, 0x03, 0x46, 0x06, 0xF6, 0xAC, 0x19, 0x52, 0x6C, 0xF8, 0x03,
+    0xC9, 0x52, 0x3A, 0xC2, 0x50, 0xA4, 0xB4, 0x1D, 0xD2, 0xA1, 0x43, 0x85, 0xDA, 0xDC, 0x2B, 0x2A,
+    0xC1, 0x88, 0x05, 0x43, 0x07, 0x06, 0x8C, 0x12, 0x40, 0x82, 0x21, 0x8E, 0x62, 0x21, 0x47, 0xB5,
+    0x7D, 0xF8, 0xCE, 0x7D, 0x2F, 0x29, 0x05, 0x04, 0xC2, 0x91, 0x6F, 0xAE, 0x7D, 0x8F, 0xCF, 0x39,
+    0xDF, 0x77, 0xBE, 0x73, 0x1E, 0x2D, 0x5A, 0xFA, 0x80, 0xF2, 0x36, 0x62, 0x9F, 0x73, 0xC4, 0x8D,
+    0xE1, 0x8A, 0x3B, 0xD2, 0x9D, 0x7B, 0x85, 0x22, 0x2E, 0x88, 0x28, 0x67, 0x2C, 0x09, 0x5B, 0xAC,
+    0x5C, 0xCA, 0x73, 0x83, 0xC5, 0xF4, 0x58, 0xB4, 0x3C, 0x6B, 0xC6, 0x73, 0x7A, 0x3C, 0x92, 0x3A,
+    0x6C, 0xDC, 0x57, 0x1F, 0x71, 0x6B, 0xB8, 0x29, 0x3A, 0xC5, 0xAD, 0xEE, 0xA8, 0x38, 0xA0, 0x35,
+    0x8A, 0x60, 0x49, 0xEF, 0xD1, 0x12, 0x91, 0x6B, 0xF4, 0x40, 0x86, 0xCB, 0xA2, 0x8E, 0x5C, 0xAF,
+    0xE0, 0xB6, 0xF0, 0x59, 0x4D, 0x6A, 0x88, 0x47, 0x78, 0xAD, 0xF2, 0x8A, 0xE2, 0x51, 0xC1, 0xAF,
+    0xA9, 0x0B, 0xF8, 0xE5, 0x14, 0x7E, 0x75, 0x33, 0x4A, 0x58, 0xE3, 0xB1, 0x3D, 0xEE, 0x64, 0x2B,
+    0x19, 0xA5, 0x5C, 0x61, 0x75, 0x5D, 0xD8, 0x8A, 0x77, 0xF6, 0x92, 0x4D, 0x8B, 0x25, 0x1E, 0xE4,
+    0xB9, 0xB0, 0xA4, 0xAA, 0x75, 0x18, 0x15, 0xDC, 0x8A, 0x8D, 0xBC, 0xCC, 0xC5, 0x13, 0x7D, 0x21,
+    0x0B, 0x4D, 0x90, 0x4D, 0x3E, 0xE8, 0x26, 0xE7, 0x27, 0xBD, 0x66, 0x1E, 0x92, 0x13, 0x37, 0x44,
+    0x3D, 0xBE, 0xBD, 0x24, 0xA9, 0xC8, 0x1D, 0xFD, 0xF5, 0x66, 0x7A, 0x13, 0x77, 0x66, 0x79, 0xDC,
+    0xAD, 0x99, 0xB9, 0x2B, 0x0E, 0xB9, 0x4F, 0x2B, 0x27, 0x9E, 0x5F, 0x08, 0x3E, 0x61, 0xE2, 0x85,
+    0xAB, 0x58, 0xD8, 0x43, 0xEA, 0x8E, 0x48, 0xC0, 0xE8, 0x1A, 0xA1, 0x01, 0x07, 0x3E, 0x12, 0xE4,
+    0x62, 0x90, 0x94, 0xB3, 0xE1, 0xA4, 0xA8, 0x28, 0xC1, 0xE7, 0x19, 0x6C, 0x33, 0x31, 0xF2, 0xC1,
+    0x48, 0x01, 0x95, 0xC0, 0x05, 0x2E, 0x05, 0xFB, 0x6C, 0xFE, 0x76, 0xFE, 0x29, 0x80, 0x45, 0xBC,
+    0x43, 0x0A, 0x9C, 0x27, 0x08, 0x17, 0x5D, 0x9D, 0x85, 0x46, 0x90, 0xC2, 0xC6, 0xBD, 0xC4, 0x45,
+    0xAC, 0x41, 0x22, 0xE1, 0x43, 0x16, 0x67, 0xF8, 0xAA, 0xA0, 0xD3, 0xA3, 0x68, 0x20, 0xB0, 0xFA,
+    0xA7, 0x23, 0x27, 0x99, 0xE0, 0xEB, 0xD3, 0x23, 0x24, 0x31, 0xD2, 0xDC, 0x27, 0x36, 0xC5, 0x08,
+    0x38, 0x02, 0xA2, 0x99, 0x65, 0xE2, 0x66, 0xF9, 0xE9, 0xEA, 0x6C, 0x6B, 0x9E, 0x6E, 0x03, 0xD2,
+    0x2A, 0xE0, 0x02, 0x53, 0x64, 0xBA, 0x00, 0x22, 0x99, 0x83, 0xE0, 0x39, 0x1D, 0xCD, 0x19, 0x52,
+    0x39, 0xC1, 0xF6, 0xCE, 0x18, 0xE0, 0x18, 0xBC, 0x99, 0xD8, 0x79, 0x6C, 0xB6, 0xE9, 0x2A, 0xF7,
+    0xAA, 0x61, 0xFE, 0xA5, 0x77, 0x9F, 0xF2, 0x68, 0xCA, 0x82, 0x23, 0x1F, 0xCF, 0x53, 0x8B, 0xB6,
+    0x29, 0xAB, 0x22, 0xD8, 0x40, 0x4C, 0x35, 0x6A, 0x29, 0xD7, 0xFB, 0xA4, 0xBD, 0x00, 0xED, 0x02,
+    0x1A, 0x7B, 0x86, 0x86, 0x29, 0xE9, 0x85, 0x5E, 0x2E, 0xC1, 0x35, 0xA8, 0x66, 0x8F, 0xFF, 0x50,
+    0xF0, 0xAD, 0xF0, 0x95, 0x54, 0x4E, 0x84, 0xFC, 0x21, 0xEE, 0x0C, 0xC1, 0xE1, 0x83, 0x14, 0x32,
+    0x8C, 0x90, 0xFB, 0x22, 0xD7, 0x94, 0x31, 0xA3, 0xA4, 0x5C, 0xE5, 0x4F, 0x7E, 0x6B, 0xF3, 0xA3,
+    0xE6, 0x62, 0xD6, 0x3C, 0x80, 0xCC, 0x56, 0xE0, 0x53, 0x5B, 0x68, 0x15, 0xEE, 0x57, 0x11, 0xA5,
+    0xC2, 0xCB, 0x6E, 0x05, 0x28, 0xB4, 0xBD, 0xEB, 0x1E, 0xFB, 0x87, 0x9A, 0x7F, 0x47, 0x23, 0xF1,
+    0x08, 0xA9, 0xA3, 0xBE, 0xEE, 0x00, 0x0A, 0x9C, 0xFB, 0xA5, 0xEE, 0x1F, 0x82, 0x9D, 0x5E, 0xE7,
+    0x4F, 0x42, 0x4B, 0xB5, 0xD2, 0x6C, 0x22, 0x68, 0xBE, 0x31, 0x08, 0xA1, 0x19, 0x64, 0xD2, 0x45,
+    0xBD, 0x90, 0x92, 0xCD, 0xF8, 0xA3, 0x19, 0x11, 0xC2, 0x35, 0xBD, 0x3B, 0x4C, 0x4B, 0x49, 0xB3,
+    0x47, 0x78, 0x46, 0x3B, 0x4E, 0xF8, 0xFA, 0x1A, 0xB8, 0x0F, 0x56, 0x7C, 0x66, 0x25, 0xCC, 0xA3,
+    0x30, 0x90, 0xA1, 0x3A, 0x3C, 0x79, 0x67, 0xB7, 0x2A, 0x60, 0xDB, 0x23, 0x0A, 0xE2, 0x14, 0xF5,
+    0x79, 0x6E, 0xE2, 0xED, 0xC0, 0x2B, 0xCE, 0x9F, 0x8B, 0xBA, 0xC5, 0x9B, 0xA0, 0x7B, 0x97, 0x0F,
+    0x6B, 0x31, 0x80, 0x7A, 0x7E, 0x42, 0x32, 0x99, 0x47, 0x60, 0x5D, 0x41, 0x47, 0x49, 0x83, 0x7A,
+    0x23, 0x1D, 0xE8, 0xAC, 0x10, 0xA1, 0x9A, 0x0A, 0x35, 0x30, 0x23, 0x9A, 0x31, 0x93, 0x04, 0xB2,
+    0xC7, 0x28, 0x99, 0xF2, 0x0B, 0xB4, 0x3C, 0x03, 0x35, 0x99, 0x5E, 0x9D, 0x4C, 0xDF, 0x86, 0x1F,
+    0xE6, 0xAF, 0x79, 0x54, 0x3C, 0x28, 0x2E, 0x51, 0xBA, 0x64, 0x94, 0x76, 0xD5, 0x3D, 0xB9, 0x92,
+    0x4C, 0x9B, 0x80, 0x96, 0xBC, 0x16, 0x59, 0xB8, 0x2F, 0x91, 0xE9, 0x8B, 0x6C, 0x7E, 0x84, 0x84,
+    0x46, 0xB0, 0x27, 0x29, 0xC8, 0x18, 0x10, 0x28, 0x2F, 0x65, 0x2D, 0xE4, 0x1E, 0x5E, 0x08, 0x56,
+    0x3F, 0xEF, 0xF8, 0x20, 0xA7, 0xA0, 0x38, 0xF0, 0xDC, 0x87, 0xED, 0x18, 0xA6, 0x56, 0xE8, 0x5A,
+    0x3E, 0x25, 0xF8, 0xDF, 0x5B, 0x64, 0x42, 0xCF, 0x5E, 0x4B, 0xE5, 0x7F, 0xB6, 0xC8, 0xCB, 0xDB,
+    0x32, 0x5E, 0x2C, 0x49, 0x88, 0x11, 0x22, 0x63, 0xF0, 0xE1, 0xBC, 0xB6, 0x39, 0x92, 0x7A, 0x03,
+    0x53, 0x4A, 0x6F, 0xB5, 0xA4, 0x6A, 0x94, 0xA4, 0xC7, 0x20, 0xCC, 0xAC, 0xF3, 0x89, 0xE0, 0x64,
+    0x5B, 0x40, 0x2C, 0x69, 0x05, 0x21, 0x76, 0x48, 0x77, 0x05, 0x90, 0xB7, 0x4A, 0x4A, 0x8E, 0xAB,
+    0x73, 0x98, 0x8E, 0xC6, 0xEA, 0x4E, 0xD7, 0xAA, 0x57, 0x83, 0x1A, 0xE0, 0x77, 0x00, 0x6E, 0x00,
+    0x5A, 0x3F, 0x98, 0x01, 0xF0, 0x0F, 0xF3, 0x6F, 0xC7, 0xFC, 0xD1, 0x98, 0x5F, 0xEE, 0xCE, 0xD1,
+    0x69, 0xA7, 0x40, 0x63, 0x72, 0xEC, 0x7E, 0x75, 0x55, 0x68, 0xAA, 0xBD, 0x20, 0x68, 0x55, 0x07,
+    0xA5, 0xAD, 0xD0, 0x26, 0xA6, 0xA4, 0xF2, 0x97, 0xE0, 0x8C, 0xEE, 0x1B, 0x1A, 0x53, 0xAF, 0x53,
+    0xBB, 0x17, 0x35, 0xF1, 0x77, 0x3E, 0x87, 0xF8, 0x37, 0x1A, 0xD1, 0xE0, 0x85, 0x65, 0xD4, 0x94,
+    0x92, 0x6F, 0x44, 0x63, 0xD1, 0xBE, 0xC7, 0x88, 0xA1, 0x8D, 0x7B, 0xA2, 0xB3, 0xD7, 0x2F, 0xC4,
+    0xFC, 0x49, 0xA5, 0x15, 0x7E, 0x17, 0x9A, 0xC4, 0xDF, 0x8F, 0xB9, 0x55, 0x95, 0xB6, 0x11, 0xC5,
+    0x0D, 0x01, 0x23, 0x56, 0x53, 0x8A, 0x1C, 0x88, 0xAF, 0xAF, 0xD7, 0x41, 0xB4, 0xF2, 0xEB, 0xB0,
+    0xF0, 0xB9, 0x64, 0xB5, 0x80, 0xE7, 0xB1, 0x07, 0xFD, 0x36, 0xBF, 0xD2, 0xE8, 0x6A, 0x85, 0x30,
+    0x2B, 0x8D, 0xED, 0xE3, 0x36, 0x2B, 0xB3, 0x2B, 0xDD, 0xC7, 0xCC, 0x0F, 0xCC, 0xC0, 0xE5, 0x5E,
+    0x5A, 0xCF, 0x1A, 0xFA, 0x33, 0x68, 0x07, 0x35, 0xAD, 0x26, 0x53, 0x04, 0x8F, 0x6D, 0x0C, 0x6D,
+    0xD9, 0xA2, 0x4C, 0x7B, 0xA1, 0xD5, 0x3B, 0x6F, 0x3A, 0x0D, 0x5F, 0x25, 0x7B, 0xBC, 0x41, 0x17,
+    0xB7, 0x18, 0x2D, 0x79, 0x93, 0x49, 0xE7, 0xE5, 0xA8, 0xAA, 0x87, 0xC4, 0xF3, 0x12, 0x65, 0xB9,
+    0x88, 0x3F, 0x11, 0x3B, 0xC4, 0x71, 0x88, 0xDB, 0x49, 0x0B, 0x3E, 0x9D, 0x4C, 0xB3, 0x19, 0x1C,
+    0xDF, 0x9C, 0x4C, 0x57, 0x99, 0xBF, 0x67, 0x5E, 0xE7, 0x61, 0x32, 0xC5, 0xAF, 0xD3, 0x54, 0xE8,
+    0x43, 0xEA, 0x7A, 0x1B, 0x55, 0x41, 0xC9, 0x7C, 0xBA, 0x74, 0x4B, 0xF9, 0x8D, 0x62, 0x2F, 0xB9,
+    0xEC, 0x37, 0x37, 0xB5, 0x8E, 0x8E, 0x9A, 0xD7, 0x96, 0x93, 0x1F, 0xEC, 0xDD, 0xDA, 0xB4, 0xF1,
+    0x23, 0x7F, 0xAD, 0x49, 0xD3, 0xE8, 0xB8, 0x59, 0x7E, 0xD5, 0xEC, 0x1F, 0xD5, 0xCB, 0x93, 0xD5,
+    0xB7, 0x44, 0xE9, 0xF7, 0xE8, 0x1A, 0x19, 0x8B, 0x0E, 0x00, 0x2F, 0x8B, 0x3B, 0x90, 0xCF, 0xED,
+    0x9D, 0x9C, 0x87, 0x9C, 0x7B, 0xC8, 0x9F, 0xD6, 0xB7, 0x85, 0x7E, 0xC8, 0xC4, 0xDD, 0x18, 0x90,
+    0xE7, 0x96, 0xD7, 0xFB, 0xAD, 0xEA, 0x46, 0x1A, 0xB2, 0x9F, 0x05, 0xB4, 0x85, 0x88, 0x22, 0x8C,
+    0xA3, 0x05, 0x1B, 0x26, 0x29, 0x24, 0x2A, 0x2A, 0x9B, 0x8F, 0xDB, 0xE7, 0xEF, 0x8C, 0xB7, 0xD1,
+    0xAC, 0x23, 0xE0, 0x9C, 0x4C, 0xDD, 0xD4, 0x3E, 0x7B, 0x1A, 0x8C, 0xA3, 0xB5, 0xBF, 0x83, 0xFE,
+    0x3F, 0xD7, 0x1F, 0xD5, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0xBD, 0xF6, 0x64, 0xD7, 0x52, 0x8C,
+    0x64, 0x0A, 0x12, 0x81, 0x16, 0xC9, 0x0F, 0x40, 0xE1, 0x17, 0x00, 0xC6, 0x4A, 0x4B, 0xC1, 0x16,
+    0xA4, 0x4A, 0x41, 0xDE, 0x20, 0xBC, 0x40, 0x76, 0x2C, 0x51, 0xD2, 0x6C, 0x45, 0xCB, 0x16, 0x14,
+    0xF0, 0xF1, 0x0A, 0x81, 0xB1, 0xB2, 0x45, 0x4A, 0xDC, 0xA4, 0xB7, 0x60, 0x0B, 0x94, 0xAF, 0x60,
+    0x02, 0x2E, 0x9C, 0xE0, 0xF1, 0xE5, 0x9C, 0xF1, 0x17, 0xB4, 0x01, 0x29, 0x3D, 0xA3, 0xFD, 0x66,
+    0x3D, 0x3F, 0x77, 0xE6, 0x9C, 0x7B, 0xEE, 0xBD, 0x23, 0x22, 0x92, 0xE9, 0x20, 0x5E, 0xBB, 0x66,
+    0xBF, 0x98, 0x50, 0x0F, 0x1F, 0x66, 0x8B, 0x88, 0xED, 0xA5, 0x0C, 0x92, 0xE3, 0x4B, 0x45, 0x5C,
+    0x27, 0xF5, 0xC0, 0xB1, 0x51, 0x9D, 0xAC, 0x6A, 0xB6, 0xDB, 0x9D, 0xC3, 0x4C, 0x9A, 0x29, 0xD7,
+    0x68, 0x5E, 0x68, 0xD1, 0xBB, 0x4C, 0x7E, 0xE2, 0xEE, 0x07, 0x21, 0xD3, 0x90, 0xED, 0x17, 0xC9,
+    0xD2, 0x5F, 0x31, 0xDF, 0xF2, 0x01, 0x27, 0xBB, 0x59, 0x52, 0x2B, 0xC4, 0xE6, 0xB1, 0x0E, 0x5A,
+    0x4E, 0x56, 0xBE, 0xE0, 0x44, 0xF6, 0x99, 0xDC, 0xC6, 0x15, 0x6D, 0x13, 0xA4, 0x0E, 0x66, 0x95,
+    0x5C, 0xC5, 0x0E, 0x62, 0xC7, 0x62, 0x11, 0x13, 0xC5, 0xF7, 0xC0, 0x51, 0xCE, 0x82, 0x91, 0xB6,
+    0x40, 0x51, 0x05, 0x29, 0xE7, 0x4C, 0x0F, 0x06, 0xD5, 0x04, 0x03, 0x7C, 0xFA, 0x51, 0xEA, 0xA9,
+    0x5E, 0xB3, 0x5C, 0xF7, 0x7F, 0xBD, 0x0C, 0x8D, 0x46, 0xB7, 0x02, 0xE7, 0x97, 0xDA, 0x5B, 0x37,
+    0xD4, 0x63, 0x11, 0x4E, 0xE5, 0x6D, 0xF1, 0xBC, 0x0C, 0xE6, 0x92, 0xF8, 0x08, 0x2E, 0x43, 0x97,
+    0xAF, 0xFC, 0x04, 0x53, 0x11, 0x73, 0xB1, 0x01, 0x3C, 0xF2, 0x70, 0x45, 0xA1, 0x1A, 0x49, 0x75,
+    0x6D, 0x45, 0xB5, 0x6E, 0xC5, 0xEA, 0x1F, 0xB8, 0x58, 0xB5, 0x81, 0xB1, 0xFE, 0x3A, 0x4A, 0xA5,
+    0xF1, 0x63, 0xF8, 0x4C, 0x9F, 0x0C, 0x52, 0xEB, 0xF2, 0x88, 0x9F, 0x5F, 0xF5, 0x98, 0x9D, 0xE8,
+    0x2D, 0xFD, 0xB4, 0xC3, 0x01, 0xCF, 0x27, 0x91, 0xD2, 0xD5, 0x3C, 0xF9, 0x17, 0x5E, 0xF5, 0x91,
+    0x25, 0xFB, 0xCB, 0x11, 0xFD, 0xA3, 0x87, 0x84, 0xF2, 0x84, 0xB7, 0xCE, 0x0B, 0xA1, 0x54, 0x1D,
+    0x76, 0xFD, 0xC9, 0x5D, 0x67, 0x51, 0xE4, 0x7E, 0x05, 0xAA, 0xD5, 0x5E, 0x31, 0xE9, 0x22, 0x3D,
+    0xF4, 0x3D, 0x71, 0x95, 0x97, 0xAB, 0xDB, 0x47, 0x8B, 0xC9, 0x53, 0x13, 0x8F, 0x57, 0x39, 0x93,
+    0xC5, 0x4C, 0xCD, 0xF0, 0x5E, 0x02, 0xDD, 0x74, 0x8D, 0x66, 0x3A, 0x67, 0x0F, 0x06, 0x71, 0x14,
+    0xA1, 0x1A, 0x05, 0x3B, 0xA3, 0x14, 0x41, 0x9A, 0x5E, 0x56, 0x39, 0x59, 0xEF, 0xE8, 0x7A, 0x73,
+    0xF7, 0x2D, 0x8C, 0x01, 0xAD, 0x2B, 0x75, 0x2A, 0x83, 0x83, 0xD2, 0x8F, 0xE7, 0x22, 0xC4, 0x7C,
+    0xB6, 0x12, 0xAB, 0xDE, 0x9B, 0xD9, 0x8B, 0xD3, 0xB6, 0x58, 0x37, 0x47, 0xDC, 0x06, 0xA9, 0x41,
+    0x75, 0xBC, 0x75, 0x17, 0x83, 0x73, 0xB9, 0x0F, 0xE7, 0x95, 0xD4, 0x08, 0x3E, 0xB4, 0x01, 0xDE,
+    0xB3, 0xA3, 0x0D, 0xE2, 0x07, 0x17, 0x20, 0x80, 0x76, 0xD5, 0x52, 0x46, 0xD1, 0xDE, 0x0F, 0xD5,
+    0x5C, 0x42, 0xAB, 0xCE, 0xF7, 0xD5, 0x54, 0xCC, 0x72, 0x53, 0x8E, 0x5B, 0x79, 0xBD, 0x19, 0x4C,
+    0xE4, 0x03, 0x3E, 0xA0, 0xC8, 0x09, 0xA5, 0xA8, 0x47, 0x60, 0x82, 0x5F, 0x0C, 0x7C, 0xF1, 0x41,
+    0xDC, 0x16, 0xA4, 0x86, 0x77, 0x10, 0x71, 0x29, 0xFE, 0x0C, 0x63, 0x07, 0x3C, 0x92, 0x70, 0x1C,
+    0x70, 0x51, 0x6C, 0x2B, 0x66, 0x92, 0xB2, 0x05, 0x47, 0x30, 0x84, 0xB1, 0x4F, 0x0B, 0x80, 0x32,
+    0x8A, 0x01, 0xBC, 0x29, 0x83, 0x1B, 0x23, 0x44, 0xC9, 0x55, 0xE1, 0x20, 0xF8, 0xD7, 0xEA, 0x08,
+    0x06, 0x0B, 0x85, 0x40, 0x64, 0xDA, 0x82, 0x5A, 0xD8, 0xAE, 0x1A, 0x7E, 0x4C, 0x91, 0x61, 0x5E,
+    0x7C, 0x7E, 0x95, 0xEE, 0x73, 0xE0, 0x0D, 0xD7, 0xB7, 0xD0, 0x7F, 0xD9, 0x42, 0x26, 0x9F, 0x37,
+    0x74, 0xBC, 0x53, 0x3C, 0x7E, 0x38, 0x9F, 0xC9, 0xB0, 0xB5, 0xB7, 0xE4, 0x0D, 0xED, 0x7D, 0xD9,
+    0xD8, 0x02, 0xEA, 0xC6, 0x16, 0xBF, 0xC4, 0x96, 0xE4, 0xC8, 0x36, 0x91, 0xAB, 0x0F, 0xE4, 0xC8,
+    0x96, 0x44, 0xD9, 0xD1, 0x22, 0xAD, 0x6E, 0x31, 0xDA, 0x62, 0xAE, 0xFC, 0x8D, 0x8A, 0x16, 0x01,
+    0xFA, 0x91, 0x6D, 0x04, 0xB3, 0x1E, 0x6C, 0x9B, 0xCE, 0xDD, 0x59, 0xC0, 0xB6, 0x08, 0x45, 0xDF,
+    0x3C, 0x06, 0xDB, 0x45, 0x6E, 0x98, 0x19, 0x6C, 0x13, 0x5C, 0xD9, 0xA0, 0x36, 0x43, 0x62, 0xBD,
+    0xA5, 0x80, 0x6B, 0x37, 0x3E, 0x30, 0xCE, 0x78, 0x3C, 0x07, 0xE4, 0xC5, 0xCE, 0xBE, 0xDC, 0x25,
+    0x4D, 0x40, 0x3F, 0xA4, 0x05, 0x8B, 0x5C, 0x48, 0xCC, 0x53, 0xBB, 0x78, 0x13, 0xDB, 0x02, 0xBF,
+    0x13, 0xBA, 0x15, 0x87, 0xD6, 0xF4, 0x22, 0x6E, 0xC5, 0x39, 0x58, 0x00, 0x8F, 0x87, 0x54, 0x0A,
+    0xDF, 0x79, 0x7B, 0x76, 0xC8, 0x39, 0xD0, 0x2E, 0xC8, 0xF2, 0x04, 0x1D, 0x85, 0xAF, 0x95, 0x82,
+    0xB0, 0x1A, 0xCD, 0xC4, 0x5C, 0xB6, 0xDC, 0xB1, 0x10, 0x04, 0xF5, 0x42, 0x2E, 0x76, 0x58, 0x2E,
+    0x11, 0xDB, 0x13, 0xCB, 0x0C, 0xC2, 0x5C, 0x4B, 0x48, 0x64, 0x99, 0x3B, 0x3E, 0x92, 0xCC, 0x62,
+    0x51, 0x4E, 0xF2, 0x57, 0xDA, 0x3A, 0x39, 0x68, 0x3B, 0x6C, 0xDA, 0x9A, 0x57, 0xDA, 0x7A, 0xD9,
+    0xB4, 0x4D, 0x01, 0x36, 0x1F, 0x34, 0x20, 0xC3, 0x14, 0x60, 0x81, 0x16, 0x07, 0x42, 0xEF, 0xFE,
+    0x9B, 0xE1, 0x29, 0x5D, 0xA3, 0x3D, 0xEA, 0x0E, 0x1C, 0x79, 0xC4, 0x99, 0xFC, 0x42, 0x5C, 0x30,
+    0x3A, 0x1C, 0xB9, 0x16, 0x90, 0xEA, 0x21, 0x8F, 0x60, 0x8D, 0x0E, 0x87, 0x47, 0xB2, 0x68, 0xFA,
+    0x1B, 0xFE, 0xEB, 0xE7, 0xAA, 0x97, 0xAA, 0x46, 0xA7, 0x7C, 0x6D, 0x5F, 0xF3, 0x16, 0xDA, 0x92,
+    0xFA, 0x7A, 0x4A, 0xFF, 0x18, 0x1A, 0x8C, 0x10, 0xBA, 0x47, 0x8E, 0xB7, 0xA5, 0xAC, 0xBB, 0x06,
+    0x20, 0x4B, 0xF6, 0x66, 0x5B, 0xD9, 0xB6, 0x35, 0x71, 0xB3, 0x49, 0xA0, 0x35, 0x85, 0x4B, 0xFD,
+    0x3B, 0x65, 0x46, 0x61, 0xE6, 0xC0, 0x27, 0xCD, 0xAB, 0x51, 0x19, 0xB9, 0x4B, 0x35, 0xA7, 0x00,
+    0x40, 0x65, 0x65, 0x46, 0xE3, 0x1C, 0x60, 0x75, 0x18, 0xD8, 0xA7, 0xF7, 0x70, 0x4E, 0xA5, 0x48,
+    0x79, 0xD6, 0x33, 0xAA, 0x66, 0x9F, 0xED, 0x3C, 0x0B, 0x2E, 0x8B, 0x32, 0x7D, 0xD3, 0x4C, 0xD2,
+    0x70, 0xB1, 0x3B, 0x01, 0x0B, 0xAF, 0x9F, 0x20, 0x30, 0x9C, 0x2E, 0x08, 0x42, 0x94, 0xC6, 0xFE,
+    0x1A, 0xC6, 0x2D, 0x23, 0xCA, 0x84, 0x67, 0x2B, 0x27, 0xF9, 0x01, 0x5C, 0x22, 0xD9, 0x5C, 0x25,
+    0x22, 0xE7, 0xF2, 0x7F, 0xA1, 0xF5, 0x5D, 0x42, 0x65, 0x53, 0xC2, 0x57, 0xAC, 0xCB, 0x62, 0xD6,
+    0x04, 0x4E, 0x53, 0x11, 0x70, 0x7D, 0x43, 0x8A, 0xE7, 0x72, 0x9D, 0xD1, 0x3B, 0xF2, 0xCF, 0xD3,
+    0x22, 0xD5, 0x72, 0xCD, 0x07, 0xA9, 0xA6, 0xE3, 0x18, 0x0A, 0x9D, 0xAD, 0x89, 0x89, 0xFD, 0x26,
+    0xA4, 0x2C, 0x4D, 0x83, 0xB5, 0x9A, 0x92, 0x21, 0xEF, 0x29, 0x26, 0x32, 0x01, 0x46, 0xD2, 0x6A,
+    0x86, 0x82, 0xC5, 0x30, 0xDE, 0xF5, 0x03, 0x5F, 0x19, 0x4D, 0x39, 0x96, 0x92, 0x74, 0xDD, 0xFD,
+    0x00, 0x53, 0xDF, 0x09, 0xDF, 0x44, 0xBC, 0xD9, 0xDA, 0xF2, 0x61, 0xAB, 0xE7, 0xCC, 0x5F, 0xE1,
+    0xD5, 0x9A, 0xF0, 0xA2, 0xE1, 0x41, 0xFB, 0x19, 0x11, 0xEF, 0x75, 0xF9, 0x6F, 0xD2, 0xFE, 0x0D,
+    0xCD, 0x55, 0x31, 0x8E, 0xD4, 0x40, 0x10, 0x6C, 0xDB, 0x02, 0x03, 0x46, 0x4C, 0x82, 0x10, 0xE2,
+    0x90, 0x9C, 0x10, 0xE3, 0x27, 0xD8, 0xC4, 0x24, 0x17, 0x70, 0x11, 0x8F, 0xB8, 0x0F, 0x9C, 0xCE,
+    0x2B, 0xF1, 0x81, 0xFB, 0x01, 0x84, 0xE8, 0x48, 0x08, 0x09, 0x10, 0x63, 0x89, 0x07, 0xE0, 0x84,
+    0xDC, 0x20, 0x22, 0x12, 0x06, 0xC9, 0x81, 0x91, 0xD6, 0x6E, 0xBA, 0x6A, 0xBC, 0x0B, 0xE8, 0x2E,
+    0x46, 0x67, 0x69, 0xC7, 0xF2, 0xCC, 0xF4, 0x74, 0x55, 0x75, 0xF5, 0xAC, 0xC8, 0xFA, 0x64, 0xD3,
+    0x1D, 0xBC, 0xF4, 0x6B, 0xB0, 0xB1, 0x52, 0xC5, 0xD4, 0x4F, 0xED, 0xED, 0xF5, 0x30, 0x1F, 0xE5,
+    0xC2, 0x73, 0x97, 0x63, 0xDD, 0x61, 0x74, 0x5B, 0x8C, 0x29, 0x37, 0x4B, 0x3B, 0x73, 0x4A, 0x07,
+    0x1B, 0x93, 0x45, 0xB9, 0xEB, 0x25, 0xCE, 0x2C, 0x02, 0x3F, 0x16, 0x37, 0x32, 0x50, 0x37, 0x22,
+    0xF9, 0x58, 0x20, 0x54, 0xC5, 0xDB, 0x39, 0x55, 0x9F, 0xDB, 0x47, 0x36, 0x1F, 0x79, 0x3B, 0x47,
+    0x55, 0x17, 0x91, 0xD2, 0x5E, 0x41, 0xB2, 0xE5, 0xFC, 0x8D, 0x85, 0xFA, 0x8D, 0x54, 0x41, 0x5C,
+    0xB0, 0x44, 0x4D, 0x8A, 0xC5, 0x29, 0xF1, 0xDF, 0xA4, 0xD0, 0xD1, 0x6B, 0x9F, 0xAB, 0x7E, 0xD2,
+    0xAD, 0x78, 0xDD, 0x12, 0x5A, 0x03, 0x04, 0x83, 0x27, 0xA8, 0x98, 0xEE, 0x0B, 0x72, 0xA7, 0x93,
+    0xEB, 0x2F, 0x10, 0x49, 0x1A, 0xB2, 0x27, 0x05, 0x51, 0xF2, 0xA9, 0x48, 0x21, 0x8F, 0x7C, 0x80,
+    0xC3, 0x92, 0xFD, 0x00, 0x85, 0xEC, 0x17, 0x29, 0x78, 0x17, 0x98, 0x40, 0x1B, 0x04, 0xBA, 0x09,
+    0xAC, 0x1B, 0x50, 0x70, 0x01, 0x7C, 0xD2, 0x59, 0x5A, 0xFB, 0xA8, 0x3F, 0x3F, 0x9F, 0x21, 0x84,
+    0x9A, 0x14, 0x89, 0x8D, 0x16, 0x5A, 0x7F, 0x3F, 0xF7, 0x41, 0x8A, 0xC9, 0x60, 0x81, 0xB5, 0x54,
+    0xA3, 0x54, 0x58, 0xDC, 0x1C, 0x2C, 0x8D, 0x81, 0x7F, 0xAA, 0x16, 0xA9, 0x5B, 0xD5, 0xAE, 0xD0,
+    0x88, 0xE4, 0x90, 0xA8, 0xFC, 0x40, 0x54, 0x50, 0x4C, 0xB2, 0xFE, 0x3D, 0x3E, 0x4E, 0x0A, 0xAC,
+    0xE7, 0xDD, 0x44, 0x7D, 0x3D, 0x89, 0x44, 0xBC, 0xC9, 0xE1, 0x95, 0xA7, 0x95, 0x29, 0xA3, 0x2D,
+    0x30, 0x96, 0x59, 0xE4, 0x78, 0x9D, 0xC8, 0x74, 0xBC, 0x46, 0x94, 0x1F, 0x54, 0x1C, 0xB6, 0x96,
+    0x9F, 0x82, 0x80, 0x43, 0xFE, 0x73, 0x91, 0x5B, 0x58, 0x98, 0xAB, 0x58, 0xC2, 0xFA, 0x45, 0xA4,
+    0x56, 0x84, 0xE8, 0xC1, 0x74, 0xCE, 0xE1, 0x15, 0x40, 0x8E, 0x67, 0xBA, 0xC1, 0x31, 0x5B, 0x36,
+    0x27, 0x1A, 0x45, 0x88, 0xEB, 0xF0, 0x36, 0x73, 0xE6, 0xF3, 0x51, 0xDB, 0xCB, 0x89, 0xE1, 0xB4,
+    0x3D, 0xC8, 0x66, 0x07, 0xB5, 0x5D, 0xB2, 0x15, 0x73, 0x8C, 0xF1, 0x6D, 0xBB, 0x5C, 0x1B, 0x3B,
+    0x53, 0xA7, 0x4C, 0x97, 0x94, 0x44, 0x6B, 0xED, 0xEB, 0xDD, 0x29, 0x47, 0xF6, 0x3B, 0x50, 0xE3,
+    0x67, 0x33, 0xA3, 0xD1, 0x83, 0xFB, 0x96, 0x27, 0x2A, 0xAD, 0x71, 0xEF, 0x6A, 0x53, 0x63, 0xA8,
+    0x47, 0xC9, 0x42, 0x69, 0x2A, 0x1E, 0xBA, 0x99, 0xD4, 0x58, 0xA3, 0xCD, 0xAE, 0x9E, 0x35, 0xF4,
+    0x75, 0x0B, 0x57, 0x30, 0xC9, 0x63, 0x2B, 0x23, 0x75, 0xA3, 0x30, 0xD8, 0xA5, 0x98, 0x68, 0xC7,
+    0x1D, 0xD3, 0x65, 0xCC, 0x59, 0xAF, 0x82, 0x63, 0xEF, 0xB3, 0x7D, 0x07, 0xD6, 0x50, 0xA3, 0xA4,
+    0x14, 0xA7, 0xFC, 0x46, 0xD9, 0x6B, 0x26, 0xC1, 0xF0, 0xE0, 0x6F, 0xA7, 0xE7, 0xB2, 0xDF, 0x11,
+    0x71, 0xC4, 0xC4, 0x69, 0x74, 0x87, 0xA7, 0x61, 0xEE, 0xFF, 0xDB, 0x1C, 0xA0, 0xDD, 0x58, 0xD5,
+    0x0C, 0xCC, 0xAE, 0x17, 0x93, 0x63, 0x43, 0x67, 0x8C, 0x2D, 0xA2, 0x4B, 0x26, 0xD0, 0xCA, 0xBB,
+    0xF5, 0x06, 0x68, 0xD9, 0xF3, 0xB0, 0x8F, 0xB5, 0xA5, 0x4E, 0xAC, 0x6F, 0xEC, 0x65, 0x4B, 0x4E,
+    0xCD, 0xAB, 0x71, 0x6F, 0x47, 0x0B, 0x4C, 0x07, 0x31, 0x97, 0x95, 0x26, 0x7B, 0x2F, 0x0B, 0xDA,
+    0xFA, 0x80, 0x4A, 0xD2, 0x27, 0x94, 0x1B, 0xD2, 0xFE, 0x79, 0x6E, 0xD3, 0xD7, 0xD1, 0xF1, 0xBC,
+    0x50, 0xA2, 0x6E, 0x13, 0x6B, 0x89, 0xD9, 0x9B, 0x72, 0x15, 0xD1, 0xA7, 0x6F, 0x19, 0x1B, 0x28,
+    0x35, 0x8B, 0xFC, 0x63, 0x80, 0x2D, 0x4B, 0x34, 0x53, 0x57, 0x59, 0xBE, 0xD7, 0xF2, 0xE8, 0x1F,
+    0xDC, 0x08, 0xED, 0x69, 0x39, 0x1A, 0xD0, 0xD0, 0xE9, 0xE6, 0x79, 0x00, 0x49, 0x8B, 0xB1, 0x83,
+    0x4E, 0x01, 0x22, 0x09, 0xD1, 0x52, 0x52, 0x52, 0x91, 0xB6, 0xE7, 0xF9, 0xB0, 0xB6, 0x63, 0xE2,
+    0x1A, 0xEE, 0x8F, 0x75, 0x2E, 0xE6, 0xBD, 0x66, 0x40, 0xFF, 0xCE, 0x74, 0x90, 0x3C, 0x40, 0x07,
+    0x73, 0x8A, 0xEF, 0xAF, 0xAF, 0xF2, 0x30, 0x63, 0xE7, 0xA8, 0x17, 0xEE, 0x9E, 0x04, 0x06, 0x0D,
+    0xAD, 0x01, 0xF4, 0x1F, 0xED, 0xD8, 0x6C, 0x29, 0x03, 0xFB, 0xAD, 0xB9, 0xF8, 0x6F, 0xE0, 0x48,
+    0xD6, 0x03, 0xF7, 0xEE, 0x4E, 0x18, 0xEE, 0x6D, 0xA1, 0xA6, 0xE5, 0xB1, 0x66, 0x2A, 0x37, 0x48,
+    0x7F, 0xB2, 0x8A, 0x17, 0xD5, 0x2C, 0xA9, 0x8E, 0x87, 0xA3, 0x33, 0xA6, 0x74, 0x6C, 0x2D, 0x96,
+    0x21, 0x65, 0x19, 0x62, 0x5D, 0x2C, 0xF0, 0x31, 0x14, 0xB0, 0xCE, 0x34, 0x05, 0xDC, 0x60, 0x65,
+    0x48, 0xFC, 0x2A, 0x8C, 0xDF, 0xF5, 0x87, 0xEE, 0x40, 0xBD, 0x42, 0xC4, 0x5A, 0xAB, 0x1C, 0xEC,
+    0x5B, 0x93, 0x27, 0xF1, 0xFB, 0x1B, 0x71, 0xE7, 0x8C, 0xC0, 0x3F, 0x8B, 0x92, 0x75, 0x0E, 0x51,
+    0x44, 0xC8, 0x44, 0x49, 0x01, 0xF2, 0xF2, 0xC9, 0xE1, 0x92, 0x49, 0x00, 0x46, 0xB6, 0x63, 0x3D,
+    0xE3, 0x99, 0x75, 0xBC, 0x5E, 0xE2, 0x2D, 0x6C, 0xEB, 0xE9, 0x18, 0x19, 0x17, 0x86, 0xB1, 0xB4,
+    0x5F, 0xF1, 0xCB, 0xE6, 0xCF, 0xE4, 0xFF, 0x83, 0xB9, 0xF4, 0xF9, 0x0D, 0xD5, 0x55, 0x31, 0x72,
+    0xD4, 0x40, 0x10, 0x1C, 0x49, 0x18, 0x15, 0x3E, 0x5C, 0x4B, 0x00, 0xF1, 0x12, 0x52, 0x4E, 0x36,
+    0x25, 0x93, 0x88, 0x49, 0x9C, 0xC0, 0x0F, 0x88, 0x8F, 0x07, 0x50, 0xE8, 0xE0, 0x05, 0x4E, 0x78,
+    0x05, 0x8F, 0x90, 0xF0, 0x07, 0xB8, 0x1F, 0x70, 0x89, 0x13, 0x27, 0xAC, 0xAB, 0x54, 0x85, 0x5C,
+    0xDE, 0xBD, 0xA1, 0x7B, 0x84, 0xCD, 0x95, 0x0D, 0xB9, 0xBD, 0x75, 0x37, 0x92, 0x4E, 0x3D, 0x33,
+    0xDD, 0x33, 0xBB, 0x73, 0x22, 0xE5, 0x46, 0x44, 0x74, 0x25, 0xD2, 0x6C, 0x45, 0xDC, 0xE5, 0x28,
+    0x75, 0x0A, 0x43, 0xA1, 0x92, 0x64, 0xBF, 0x2D, 0x5B, 0xB9, 0x5E, 0xAA, 0x51, 0x82, 0xAA, 0x14,
+    0x4A, 0xB0, 0x0E, 0x22, 0x7E, 0x12, 0x29, 0x15, 0x90, 0x26, 0x8A, 0x54, 0x2A, 0xF3, 0x4D, 0x8D,
+    0x30, 0xD2, 0xAF, 0x11, 0x2B, 0xC9, 0x8C, 0x73, 0xC0, 0x15, 0x74, 0x0A, 0xE3, 0xBF, 0x70, 0x4B,
+    0x3D, 0xB6, 0xC0, 0x95, 0x2A, 0xA9, 0x1C, 0x15, 0x78, 0xFF, 0x39, 0xC1, 0xBD, 0x5B, 0x8B, 0xBE,
+    0xC6, 0xCD, 0xA6, 0xDB, 0xA1, 0xC1, 0xE5, 0x80, 0x2E, 0xC9, 0xC7, 0xEB, 0x34, 0xE7, 0xB9, 0x1D,
+    0xDE, 0x6E, 0x3A, 0x04, 0x5C, 0xE4, 0x2B, 0x1A, 0xE9, 0x8F, 0xD0, 0xDB, 0xBC, 0xAF, 0x70, 0x0F,
+    0xF5, 0x62, 0x0E, 0xDC, 0x28, 0xD9, 0xC9, 0xDE, 0x1B, 0x66, 0xEE, 0x55, 0x41, 0xB3, 0x53, 0x5E,
+    0x16, 0xB0, 0x88, 0xF1, 0x4E, 0x3F, 0xF5, 0xC0, 0xFB, 0xB1, 0x00, 0xB8, 0x24, 0xF7, 0x96, 0xD1,
+    0x42, 0x62, 0xBC, 0x02, 0xD9, 0x10, 0x11, 0xF9, 0xEA, 0xCC, 0xD4, 0x87, 0x7A, 0x76, 0xEC, 0x12,
+    0x3C, 0xB7, 0x78, 0xF8, 0xAA, 0x67, 0x2B, 0x9F, 0xC8, 0xA1, 0xD4, 0x15, 0x59, 0x34, 0x23, 0x3D,
+    0x6B, 0x35, 0x26, 0xC8, 0x80, 0x87, 0x66, 0x62, 0x75, 0x3C, 0x9E, 0xFB, 0xD3, 0x25, 0x83, 0x29,
+    0x4B, 0x13, 0xCC, 0xA2, 0x4A, 0xA8, 0xD7, 0xED, 0xE5, 0x36, 0x2F, 0xED, 0xB2, 0x0D, 0xBC, 0x20,
+    0x19, 0x14, 0x4B, 0x75, 0x4E, 0xE6, 0x22, 0xEF, 0xFD, 0x5A, 0xFE, 0xB3, 0x1C, 0x80, 0x00, 0x2F,
+    0x74, 0x44, 0x9A, 0x88, 0x5B, 0xF8, 0x32, 0x0B, 0x88, 0x0C, 0x50, 0x32, 0x21, 0x30, 0x2B, 0x20,
+    0x35, 0x8A, 0xDB, 0xE8, 0xA6, 0xCC, 0x74, 0x49, 0x02, 0x6E, 0xD5, 0xA5, 0xB6, 0xC4, 0xE4, 0x2E,
+    0x1A, 0xC6, 0x65, 0xC3, 0x7C, 0xD3, 0x13, 0x14, 0xDA, 0xC5, 0x26, 0x02, 0x53, 0x4F, 0x8B, 0x2D,
+    0x30, 0xF0, 0xD2, 0x1F, 0xC4, 0x40, 0x04, 0x31, 0x43, 0xA5, 0xC4, 0x6C, 0x18, 0x98, 0x91, 0x3D,
+    0x4A, 0x0A, 0x4C, 0x85, 0xCC, 0x25, 0xBE, 0x1D, 0x36, 0x21, 0x8A, 0xE5, 0x58, 0x4D, 0x6D, 0x0B,
+    0x9D, 0x99, 0x3E, 0xDD, 0x61, 0x5D, 0xCF, 0xDC, 0x4D, 0x15, 0xDB, 0x49, 0xE1, 0xB4, 0xA5, 0xC9,
+    0x96, 0x60, 0x2F, 0x8A, 0xD5, 0x5F, 0x07, 0x6B, 0x64, 0x50, 0xEB, 0x3C, 0x62, 0x72, 0x0B, 0x51,
+    0xE2, 0xF6, 0x2D, 0x35, 0x47, 0xE9, 0x26, 0x7A, 0x36, 0x89, 0x7D, 0xF4, 0x68, 0x15, 0xA2, 0x66,
+    0x47, 0xA9, 0xD9, 0x93, 0x68, 0x46, 0x63, 0xF1, 0x0B, 0xFA, 0x82, 0xB7, 0xB4, 0xC1, 0x6C, 0x33,
+    0x99, 0x1D, 0x69, 0xFB, 0xD8, 0x24, 0xF6, 0x2F, 0x50, 0xC6, 0xE0, 0x14, 0x19, 0x50, 0xC9, 0xD3,
+    0x3E, 0x5B, 0xC7, 0x22, 0xCF, 0x8F, 0xED, 0x3D, 0x9D, 0x6E, 0x6A, 0x11, 0x39, 0x30, 0xFB, 0x91,
+    0xC6, 0xB6, 0xA3, 0x04, 0x13, 0x63, 0xD0, 0x42, 0x6D, 0xF3, 0xEF, 0xB6, 0xFC, 0x6E, 0x6A, 0xD9,
+    0x9F, 0x2B, 0x1F, 0x69, 0x7B, 0x1E, 0xB5, 0x72, 0x4B, 0x15, 0x6E, 0xEC, 0x78, 0x22, 0xD7, 0x01,
+    0xA4, 0x0F, 0xE5, 0xD1, 0xBD, 0xE8, 0x48, 0x39, 0x2D, 0xEC, 0x64, 0x90, 0xB3, 0x57, 0x76, 0x24,
+    0xD8, 0xF6, 0x3A, 0xA8, 0xC6, 0x9B, 0xC7, 0xE7, 0x4E, 0xAA, 0x28, 0xDA, 0x07, 0xE4, 0x1F, 0x39,
+    0x37, 0x43, 0xB4, 0xD9, 0x7E, 0xCE, 0x6D, 0xE4, 0x87, 0x7C, 0x2F, 0xF8, 0x8B, 0xBC, 0x90, 0xC7,
+    0xE5, 0x24, 0xD9, 0x8F, 0x2E, 0xF9, 0x51, 0x07, 0x8F, 0x71, 0xE1, 0x41, 0x84, 0xE9, 0x30, 0x40,
+    0x1C, 0xBE, 0xFA, 0x73, 0x5C, 0xA4, 0x30, 0x76, 0x43, 0x88, 0x1F, 0x24, 0x48, 0x2B, 0x4F, 0xE8,
+    0xF7, 0xEC, 0x48, 0x56, 0xA6, 0xC7, 0x0D, 0x9C, 0x81, 0x39, 0x5B, 0x7C, 0x28, 0x72, 0xFA, 0x85,
+    0x03, 0xDB, 0x24, 0x09, 0x75, 0x70, 0xC8, 0xF3, 0x0F, 0x64, 0xC0, 0x18, 0xC6, 0x5F, 0x5A, 0x8B,
+    0x61, 0xE3, 0xBF, 0x67, 0xE9, 0x62, 0x91, 0x9A, 0x11, 0xBF, 0xF9, 0x41, 0xD7, 0x2E, 0x97, 0x50,
+    0x0E, 0x21, 0x61, 0x85, 0xD7, 0x7A, 0x32, 0x61, 0xAC, 0x57, 0xBA, 0x5C, 0xA1, 0x1A, 0x0E, 0x7C,
+    0x51, 0x82, 0x06, 0xDC, 0x11, 0xBD, 0xBF, 0x8E, 0x89, 0x4F, 0xA5, 0x17, 0x4B, 0xCE, 0x75, 0x93,
+    0x57, 0xFD, 0xE2, 0xD8, 0x97, 0xF0, 0xCA, 0x54, 0x3E, 0x97, 0x3D, 0xB9, 0x5B, 0xEB, 0x37, 0xD5,
+    0x55, 0x31, 0x6E, 0xD5, 0x40, 0x10, 0x1D, 0x7B, 0x8B, 0x2D, 0x5C, 0x38, 0x05, 0x48, 0x88, 0x14,
+    0xA6, 0xA0, 0x44, 0xEC, 0x11, 0xF6, 0x2B, 0x27, 0x48, 0x4F, 0x41, 0x0B, 0x15, 0x47, 0xB0, 0x39,
+    0x41, 0xB8, 0x07, 0x17, 0xA0, 0xC2, 0x56, 0x38, 0x00, 0x16, 0x5C, 0xC0, 0x08, 0xE8, 0x8D, 0xE4,
+    0x20, 0x87, 0xAC, 0x3D, 0xBC, 0x37, 0xFE, 0x89, 0xF2, 0x25, 0x2A, 0x8A, 0x48, 0x59, 0x59, 0x33,
+    0xDE, 0xBF, 0xF6, 0xEC, 0x7B, 0xF3, 0xDE, 0xFA, 0x8B, 0xEC, 0x47, 0x6F, 0x31, 0x34, 0x8C, 0x4E,
+    0xB7, 0xC9, 0x62, 0xA9, 0x9D, 0x2C, 0xD5, 0x9D, 0xA5, 0x27, 0x72, 0x38, 0x2A, 0x5D, 0x73, 0xD5,
+    0x4F, 0xAA, 0x7D, 0xD4, 0x14, 0x74, 0xCA, 0x75, 0x91, 0x30, 0x49, 0xAE, 0xBC, 0x24, 0x0E, 0x12,
+    0x47, 0x71, 0x8B, 0x95, 0x44, 0x85, 0x7A, 0x10, 0x9F, 0xA4, 0x40, 0xE1, 0xB6, 0x11, 0xED, 0xA4,
+    0x9C, 0xA4, 0x4C, 0x22, 0xBA, 0xE3, 0xA4, 0x1A, 0xA5, 0x9A, 0x25, 0xE3, 0x9B, 0x3B, 0x09, 0xB7,
+    0xDF, 0x8C, 0x1D, 0x27, 0x45, 0xB2, 0x09, 0x16, 0xE3, 0x2C, 0x35, 0x16, 0xF5, 0x4F, 0xBB, 0x10,
+    0x81, 0xE2, 0x27, 0xA9, 0x01, 0x81, 0x68, 0x2D, 0xCA, 0xC3, 0x43, 0x94, 0xB9, 0xF1, 0x92, 0xB4,
+    0x11, 0x32, 0x26, 0xB5, 0x4D, 0x82, 0x51, 0x75, 0xAB, 0x2D, 0x3C, 0x95, 0xFB, 0x45, 0xEE, 0x78,
+    0xC7, 0xE8, 0x4D, 0xA6, 0x4C, 0x4D, 0xA6, 0xDA, 0xC8, 0x85, 0x81, 0x84, 0x8A, 0xD9, 0x8D, 0x48,
+    0xAF, 0xE4, 0xD1, 0x21, 0xAB, 0x4C, 0x75, 0x08, 0x9A, 0xA2, 0x2E, 0x4E, 0xF5, 0x1C, 0xF5, 0x83,
+    0xF6, 0x86, 0x6A, 0xE4, 0x85, 0x5E, 0x18, 0xAA, 0x9E, 0xA8, 0xC0, 0xC7, 0xAF, 0x46, 0xAE, 0xED,
+    0x51, 0xEF, 0x16, 0x9F, 0x8D, 0x1C, 0xF8, 0x64, 0xDA, 0x90, 0x1C, 0xDB, 0x72, 0xFB, 0x4D, 0xB7,
+    0xF1, 0x69, 0x8D, 0x1C, 0x1E, 0x76, 0xDA, 0x78, 0x2E, 0xEA, 0x7B, 0x70, 0x00, 0x02, 0xC2, 0xF5,
+    0xAA, 0xC4, 0x5E, 0xE8, 0xC6, 0xE0, 0x74, 0x0F, 0x4F, 0x1E, 0x50, 0xB1, 0x54, 0x0E, 0x48, 0xF1,
+    0x0B, 0x05, 0xF2, 0x29, 0xDA, 0xE4, 0x24, 0xC9, 0xBF, 0xC6, 0xBD, 0xF0, 0xE0, 0x66, 0xC1, 0x9A,
+    0xA1, 0x48, 0xA6, 0xC2, 0x78, 0xE3, 0x3F, 0xE5, 0x5A, 0xBE, 0x3B, 0x7C, 0x5E, 0xB5, 0x53, 0x3D,
+    0xD3, 0xD5, 0xEB, 0x0A, 0x81, 0xBC, 0xF6, 0x40, 0x09, 0x09, 0x20, 0x11, 0x49, 0xF4, 0x8E, 0x98,
+    0xBB, 0xD0, 0xE3, 0xC1, 0x6C, 0xA5, 0x0B, 0x4A, 0xD4, 0x2B, 0x13, 0xEB, 0x85, 0x2B, 0x7A, 0x21,
+    0x5A, 0x55, 0xDD, 0xF6, 0xA2, 0x2B, 0xBC, 0xB9, 0x3C, 0x4C, 0x37, 0x67, 0x60, 0x3B, 0xE7, 0xA5,
+    0x35, 0xB5, 0x66, 0x83, 0x8F, 0xF5, 0x87, 0x6D, 0xCC, 0x4A, 0x6A, 0xAF, 0x23, 0x5D, 0xFF, 0x52,
+    0x99, 0xC3, 0xCA, 0xD9, 0xEA, 0xFD, 0x34, 0xEC, 0xE0, 0x0C, 0x0B, 0xB1, 0x39, 0xBF, 0xDA, 0x99,
+    0xF5, 0x95, 0xC8, 0x40, 0x0F, 0x17, 0x0C, 0xA3, 0x1D, 0x32, 0xCA, 0x6B, 0x07, 0x93, 0x60, 0xDF,
+    0x30, 0x15, 0xB4, 0xC8, 0x0B, 0x54, 0x8E, 0xEC, 0x94, 0xB3, 0x76, 0xD5, 0x17, 0x20, 0x4E, 0x39,
+    0xE0, 0x87, 0xF9, 0x7A, 0xB3, 0xB8, 0x79, 0x02, 0xE3, 0xF1, 0xA5, 0x99, 0x5C, 0x0D, 0x7C, 0x6D,
+    0xC9, 0xAF, 0x2F, 0x89, 0x39, 0xF6, 0xA4, 0x0C, 0xD7, 0x41, 0x1A, 0xC1, 0xED, 0x6A, 0x5F, 0xA9,
+    0x62, 0xB4, 0xF3, 0x5C, 0x03, 0x7D, 0x39, 0x39, 0xA2, 0x8D, 0x5D, 0xE8, 0x88, 0x39, 0x4F, 0x76,
+    0x28, 0x36, 0x5F, 0xF5, 0xD6, 0x01, 0x3D, 0x21, 0x4B, 0x9F, 0x1C, 0xD5, 0xAB, 0x46, 0xCF, 0xD4,
+    0x9A, 0x51, 0xA1, 0x3A, 0xC0, 0xB2, 0x2C, 0xFB, 0x53, 0x9B, 0x33, 0x72, 0x2D, 0x79, 0x57, 0xCE,
+    0xED, 0x09, 0xD0, 0xC5, 0xAF, 0x38, 0x47, 0x28, 0x51, 0x10, 0x93, 0x4F, 0x05, 0x2B, 0xC1, 0x31,
+    0x54, 0x51, 0x4D, 0x4A, 0x67, 0x8D, 0x1D, 0x02, 0xF7, 0x2B, 0x2E, 0xAC, 0xD7, 0x71, 0x3B, 0xA5,
+    0xED, 0xF6, 0xC0, 0x9B, 0x77, 0x7B, 0x8E, 0x47, 0x0C, 0x1F, 0xD8, 0xD8, 0xC5, 0xBA, 0x7B, 0xE3,
+    0x89, 0x48, 0x23, 0x91, 0x91, 0x64, 0xC3, 0x81, 0x3B, 0x5E, 0xE3, 0xB4, 0x78, 0xFD, 0x3C, 0x52,
+    0x84, 0x51, 0xDA, 0x2B, 0xED, 0xD1, 0xE2, 0xB6, 0x03, 0xF1, 0x96, 0x4D, 0xD7, 0x06, 0x3A, 0x29,
+    0x30, 0xA3, 0x56, 0x18, 0xA1, 0x73, 0x1C, 0xA0, 0x4E, 0x1C, 0xCA, 0x05, 0x21, 0x30, 0x7C, 0x4C,
+    0xCF, 0xE2, 0xEF, 0x4B, 0x1E, 0x97, 0x6F, 0x3A, 0x57, 0xFA, 0x56, 0x07, 0xD0, 0x05, 0xAC, 0xD3,
+    0x0D, 0x8C, 0x0D, 0x4F, 0x94, 0xA5, 0x7D, 0x50, 0x7A, 0xEB, 0xE3, 0x9E, 0x9A, 0xA1, 0x74, 0x64,
+    0x92, 0x75, 0x77, 0x8E, 0x2A, 0x9F, 0xAF, 0x4F, 0x50, 0x65, 0x82, 0xB7, 0x08, 0x0B, 0xFE, 0xB7,
+    0xDC, 0x04, 0xA4, 0x45, 0xEF, 0x9B, 0x3B, 0x04, 0xF4, 0x5C, 0x1A, 0xA8, 0x75, 0x3E, 0xD0, 0xC9,
+    0x08, 0xDF, 0x61, 0x7F, 0xD7, 0x99, 0xB6, 0x47, 0x77, 0xAF, 0xD6, 0x7F, 0x8D, 0xBF, 0xBD, 0x55,
+    0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0xB6, 0x09, 0x56, 0xD6, 0xC5, 0x50, 0x50, 0x21, 0xC1, 0xF4,
+    0x11, 0xC2, 0x0D, 0x2D, 0xCC, 0x90, 0x14, 0x14, 0x14, 0x49, 0x47, 0x99, 0x26, 0xC5, 0xA6, 0x4A,
+    0x9B, 0x2A, 0x76, 0xE0, 0x07, 0x5E, 0x05, 0x05, 0x0D, 0x05, 0x1D, 0xC5, 0x36, 0x14, 0x14, 0x68,
+    0x67, 0xB4, 0xAF, 0x48, 0x89, 0x49, 0x4B, 0x63, 0x20, 0x5D, 0x8A, 0x1D, 0x21, 0x13, 0xCD, 0xB2,
+    0xE3, 0xB9, 0x9C, 0x3B, 0xFB, 0x76, 0xF3, 0x56, 0xA2, 0x44, 0x58, 0xEB, 0x59, 0xBF, 0x67, 0xBF,
+    0x7B, 0xCE, 0x9C, 0x7B, 0xCE, 0x35, 0x91, 0x1C, 0x55, 0xEA, 0x26, 0x6A, 0xD6, 0x7E, 0xA6, 0x36,
+    0x19, 0x5C, 0x2D, 0xFD, 0x48, 0x64, 0xDF, 0xA0, 0xFD, 0xE3, 0x61, 0x75, 0x8F, 0x5A, 0xFE, 0x39,
+    0x50, 0xCF, 0x1C, 0xC8, 0x9D, 0xF3, 0x54, 0xF1, 0xE8, 0x7C, 0x93, 0xC9, 0xF9, 0x2E, 0x11, 0x8F,
+    0x2A, 0x12, 0x93, 0x0E, 0x15, 0x53, 0x1F, 0x1A, 0x26, 0x33, 0xB7, 0x19, 0x8B, 0x5A, 0xB1, 0xF4,
+    0xB2, 0x1C, 0xA7, 0xF7, 0xCD, 0xAB, 0x33, 0x4E, 0x3D, 0xFF, 0xC6, 0x51, 0xF3, 0x53, 0x9E, 0xBB,
+    0x4C, 0x6C, 0xE9, 0x1E, 0xBD, 0x25, 0x14, 0x36, 0x58, 0xF4, 0x8A, 0xC5, 0x38, 0x2C, 0x3F, 0x29,
+    0x4B, 0xB4, 0xC8, 0x12, 0x35, 0x3E, 0xE6, 0x63, 0xB9, 0x91, 0xB0, 0x74, 0x9B, 0xFF, 0x89, 0xD0,
+    0x43, 0x5B, 0x7D, 0x47, 0x34, 0xF0, 0x17, 0xBC, 0x08, 0x02, 0xB3, 0xEF, 0xD8, 0xF1, 0x37, 0x09,
+    0x20, 0x66, 0x36, 0xDE, 0xCC, 0x4D, 0x6A, 0x12, 0x70, 0x9C, 0x75, 0x16, 0x58, 0xA1, 0x9F, 0x75,
+    0xA8, 0xB3, 0x8A, 0x35, 0x90, 0x5E, 0x4A, 0xF9, 0x8E, 0x33, 0x81, 0x0C, 0x56, 0x7C, 0x30, 0x2B,
+    0x1D, 0x34, 0xB9, 0xE3, 0xB9, 0x09, 0xE6, 0xD5, 0xDF, 0xFC, 0x15, 0xD7, 0xCC, 0x0A, 0x35, 0x35,
+    0x7B, 0xC7, 0x33, 0x0D, 0x73, 0xCD, 0x2F, 0x08, 0xC8, 0x64, 0x65, 0x6B, 0xEF, 0x58, 0x52, 0xEC,
+    0x2B, 0xE6, 0xB1, 0xE7, 0x5C, 0xF1, 0xED, 0xA0, 0x16, 0xB2, 0xCE, 0xA3, 0x45, 0xD0, 0x28, 0x10,
+    0xC9, 0x25, 0xCA, 0x62, 0x83, 0x64, 0x02, 0x8D, 0x28, 0x73, 0x87, 0x5F, 0xAE, 0x2D, 0x74, 0x50,
+    0x80, 0xEB, 0x78, 0xA4, 0x0A, 0x75, 0x6E, 0xA0, 0x12, 0x2E, 0x41, 0x88, 0x08, 0xD2, 0xA1, 0xC5,
+    0x04, 0x19, 0xF5, 0x4C, 0x74, 0x58, 0x04, 0xC4, 0x23, 0x0A, 0xFF, 0x20, 0x77, 0x8D, 0x62, 0x2D,
+    0x6A, 0xB7, 0x78, 0xAC, 0x41, 0xD1, 0x7A, 0xBA, 0x6A, 0x3B, 0x44, 0xA8, 0x38, 0x41, 0x81, 0x58,
+    0xE7, 0x47, 0x41, 0x4F, 0xC6, 0xE7, 0x2A, 0x77, 0x41, 0x05, 0x33, 0xBA, 0x4F, 0x56, 0xBD, 0x74,
+    0xE7, 0x6C, 0x0D, 0x76, 0x00, 0x95, 0xC0, 0xEE, 0xA6, 0x5A, 0xAA, 0x64, 0xFE, 0x1A, 0xE6, 0x81,
+    0x99, 0x18, 0x5F, 0x3B, 0x54, 0x7B, 0xFB, 0xAA, 0xD8, 0x01, 0xCE, 0x16, 0xFC, 0x1B, 0xE0, 0x14,
+    0x5A, 0x97, 0xA7, 0xD9, 0xDD, 0x7C, 0xED, 0x36, 0x3C, 0x88, 0xAE, 0x8A, 0x86, 0xDD, 0x99, 0xF3,
+    0xED, 0xA2, 0x42, 0x13, 0xDB, 0x58, 0x43, 0x73, 0xCA, 0xF5, 0x4A, 0xC3, 0xA7, 0x2B, 0xF5, 0xA7,
+    0x2B, 0x64, 0x8A, 0xD4, 0x30, 0xE8, 0xB2, 0xAD, 0xAD, 0x99, 0xDA, 0xA0, 0xD6, 0xFB, 0x11, 0xC2,
+    0x25, 0x32, 0xB8, 0x53, 0x83, 0x41, 0x91, 0xE1, 0xE2, 0xE8, 0x7C, 0xD1, 0x4B, 0xB8, 0xD6, 0x39,
+    0x81, 0xC9, 0x4A, 0xDA, 0x3F, 0x01, 0xF8, 0x47, 0xAF, 0x81, 0x21, 0xBD, 0x00, 0x63, 0xBF, 0xE4,
+    0xD0, 0xEC, 0x15, 0x5D, 0x06, 0xAE, 0x6C, 0x58, 0xCD, 0xFD, 0xA4, 0x7F, 0x61, 0x2B, 0xB0, 0xB2,
+    0x63, 0xB4, 0x94, 0x10, 0x96, 0x8D, 0xA0, 0xCA, 0x96, 0x35, 0xDA, 0x29, 0xF2, 0x17, 0xD0, 0xCB,
+    0x3D, 0x57, 0x51, 0xA3, 0x8F, 0x68, 0x9F, 0x7B, 0x96, 0x00, 0x26, 0xFE, 0xDE, 0x8F, 0x15, 0xD0,
+    0x44, 0x5D, 0x98, 0x61, 0x14, 0x79, 0x05, 0x8E, 0xA0, 0x2F, 0x7A, 0x02, 0x17, 0x8D, 0xCE, 0x0A,
+    0x9E, 0x28, 0xDC, 0x88, 0x8B, 0x40, 0xBB, 0x00, 0x8A, 0xC6, 0x0D, 0x7F, 0x9E, 0x49, 0x44, 0x16,
+    0xC4, 0xA2, 0xB2, 0x74, 0x1C, 0x2D, 0xFD, 0x81, 0x06, 0x58, 0x04, 0xEE, 0x30, 0x53, 0x9D, 0xE8,
+    0xBD, 0x82, 0xF2, 0xE6, 0xE8, 0x92, 0xE3, 0x5B, 0x70, 0xD3, 0xA4, 0x42, 0x9B, 0x6A, 0x71, 0xB9,
+    0xF1, 0x3A, 0xA8, 0xD8, 0xAC, 0x15, 0xDF, 0x1C, 0x4E, 0x8F, 0xF8, 0x57, 0x9E, 0x79, 0x73, 0xA9,
+    0x54, 0x8B, 0x0E, 0x05, 0x82, 0xCA, 0x88, 0x8E, 0x04, 0xC2, 0x59, 0x69, 0x50, 0x7B, 0x65, 0x89,
+    0x6F, 0x21, 0x0F, 0xFE, 0xFC, 0x81, 0x9B, 0xA9, 0x5B, 0xA4, 0x9B, 0xF2, 0xA0, 0x1B, 0x85, 0x9D,
+    0x0A, 0xE2, 0x22, 0x71, 0x27, 0x7E, 0x38, 0x9C, 0x58, 0x7D, 0x8E, 0x20, 0x2C, 0x35, 0xE4, 0x34,
+    0x2F, 0x2E, 0x38, 0x52, 0xB1, 0x62, 0x8F, 0xC8, 0xC6, 0x2A, 0xA7, 0x66, 0x39, 0x56, 0x93, 0xE9,
+    0xED, 0x07, 0xBB, 0xE2, 0x87, 0x52, 0xDB, 0x31, 0x7D, 0x9F, 0x85, 0x00, 0x4A, 0xA3, 0x5A, 0x17,
+    0x09, 0x0A, 0xA2, 0x32, 0xBC, 0x6F, 0x66, 0x41, 0x41, 0xE1, 0xE1, 0x74, 0x74, 0x6C, 0x5D, 0x96,
+    0xBA, 0x37, 0x76, 0x53, 0x4C, 0x4D, 0xFC, 0x59, 0x1C, 0xB6, 0xAB, 0x9A, 0xF2, 0xDE, 0xF8, 0x3A,
+    0x84, 0x8D, 0x10, 0xDE, 0x50, 0x1F, 0x45, 0xA9, 0x29, 0x86, 0x1B, 0x3C, 0x61, 0xD8, 0xA9, 0x2B,
+    0xEE, 0x5C, 0xB8, 0xEB, 0xB0, 0x69, 0x33, 0x02, 0xBC, 0x12, 0xCA, 0xAA, 0xB3, 0x92, 0xC7, 0x4B,
+    0xC2, 0xD0, 0x83, 0xA1, 0x43, 0x27, 0x5E, 0x13, 0x0F, 0x49, 0xC8, 0x9A, 0x73, 0x54, 0x7B, 0x57,
+    0x02, 0x55, 0x4C, 0xDC, 0xC6, 0xD2, 0xC8, 0xE2, 0x3E, 0x27, 0xD9, 0x8E, 0x3A, 0x95, 0x69, 0x04,
+    0xFF, 0x26, 0x60, 0x0D, 0x27, 0x2C, 0xF3, 0x15, 0xA1, 0xF8, 0x12, 0xE5, 0x17, 0x33, 0x57, 0x2C,
+    0x7D, 0x9A, 0x4D, 0xE8, 0x52, 0xCD, 0x5F, 0xB3, 0x55, 0x92, 0x98, 0x01, 0x52, 0x55, 0x38, 0x77,
+    0xE8, 0x3F, 0xD6, 0x88, 0x6C, 0xFA, 0x18, 0x08, 0xF8, 0xAE, 0xFD, 0x83, 0x3D, 0x29, 0x99, 0x02,
+    0x54, 0xED, 0xA7, 0xE5, 0x01, 0xF2, 0xE2, 0xA2, 0x5E, 0x15, 0xFF, 0xCE, 0xE9, 0x16, 0x1F, 0x61,
+    0xAF, 0x39, 0x3A, 0xB8, 0xF1, 0x29, 0x6C, 0x94, 0x3A, 0x04, 0xC2, 0x9B, 0x49, 0x86, 0x1B, 0xA8,
+    0xB7, 0x32, 0x1A, 0xFB, 0x19, 0x71, 0x67, 0xAB, 0xE5, 0x93, 0x83, 0x13, 0xB6, 0xA0, 0x79, 0x7A,
+    0x77, 0x69, 0x38, 0x0D, 0x50, 0xEA, 0x79, 0x26, 0x2D, 0x04, 0x8A, 0xAC, 0x32, 0x0B, 0xA5, 0x39,
+    0x6A, 0xBA, 0x98, 0x0F, 0x04, 0x0A, 0xA2, 0x5C, 0x19, 0x1C, 0xD4, 0x7A, 0xDA, 0x1F, 0x15, 0xA4,
+    0xB1, 0x03, 0x4C, 0x4B, 0x32, 0x99, 0xA7, 0x3E, 0x40, 0x01, 0x4C, 0x5E, 0x8C, 0x29, 0xB7, 0x45,
+    0x5C, 0xFF, 0x64, 0xEA, 0x12, 0x63, 0x40, 0x43, 0x02, 0xBE, 0x1B, 0x69, 0xD8, 0xCA, 0xEE, 0xD9,
+    0xF7, 0xA1, 0x5F, 0xFA, 0x05, 0xD3, 0x0B, 0x29, 0xC1, 0xD9, 0x5E, 0x0F, 0x2D, 0xD1, 0x87, 0x3B,
+    0x74, 0x99, 0x52, 0x64, 0x76, 0xE8, 0x95, 0x88, 0xD0, 0xC3, 0x4F, 0xD5, 0x1E, 0x83, 0x42, 0xA1,
+    0x2D, 0xC1, 0x47, 0x86, 0x19, 0xC1, 0x11, 0x0E, 0xB2, 0x63, 0xCF, 0x63, 0x27, 0x3D, 0x70, 0x27,
+    0x42, 0x02, 0x0D, 0xE4, 0x7F, 0xEB, 0xC1, 0x6D, 0x48, 0xC2, 0xE8, 0xB0, 0xD0, 0xD8, 0xEB, 0x41,
+    0x39, 0xE4, 0x95, 0xD8, 0x01, 0xB4, 0x42, 0x65, 0xBC, 0xA3, 0x30, 0xA1, 0x9F, 0x63, 0xF4, 0x44,
+    0xE5, 0xE9, 0x09, 0x3D, 0xBE, 0x1E, 0x69, 0xF4, 0x70, 0x2C, 0x2A, 0x28, 0x76, 0xB0, 0x3E, 0xDE,
+    0x18, 0x83, 0x57, 0x49, 0x64, 0xF0, 0x88, 0x73, 0x12, 0xEB, 0x6F, 0x71, 0x33, 0x8A, 0x0E, 0x77,
+    0xA0, 0x75, 0xC0, 0xCB, 0x24, 0xE3, 0x0D, 0xE5, 0xBC, 0x08, 0x01, 0xFF, 0xAC, 0xB0, 0x17, 0xE2,
+    0xA3, 0x51, 0xE6, 0x9A, 0x12, 0xFF, 0xFD, 0xF1, 0x0F, 0xD5, 0x55, 0xCB, 0x8E, 0xD4, 0x46, 0x14,
+    0xBD, 0x65, 0x33, 0x58, 0xC2, 0x8B, 0x62, 0x91, 0xD5, 0x20, 0xE4, 0x0D, 0x2B, 0x84, 0xF0, 0x17,
+    0x84, 0x6A, 0x29, 0x3F, 0x30, 0x0B, 0x5A, 0x22, 0x7F, 0x00, 0x2B, 0xFE, 0x00, 0x9B, 0x2F, 0x81,
+    0x05, 0x9B, 0x74, 0xFE, 0x20, 0x0A, 0x29, 0x4B, 0x7C, 0x00, 0x8E, 0xB2, 0x64, 0x63, 0xA2, 0xEC,
+    0x66, 0x53, 0x28, 0xD6, 0xE0, 0xD1, 0x54, 0xD7, 0xE5, 0x9C, 0xEA, 0xEE, 0x01, 0xC2, 0x9A, 0x91,
+    0x52, 0x52, 0x57, 0xFB, 0x51, 0x75, 0xEB, 0xDC, 0x73, 0xCE, 0xBD, 0x16, 0xB9, 0x2F, 0xBD, 0xD8,
+    0xD8, 0x4A, 0xA9, 0x17, 0x41, 0x1E, 0xB4, 0x5B, 0x29, 0x07, 0x5D, 0x89, 0x18, 0xFC, 0x2E, 0xC7,
+    0x31, 0x6E, 0x3A, 0xED, 0xA5, 0x55, 0x15, 0xAB, 0x7E, 0x2E, 0xD4, 0x68, 0xDF, 0x0D, 0x36, 0xDA,
+    0x45, 0x3C, 0x96, 0xD7, 0xB1, 0x0D, 0xE2, 0xDF, 0xE0, 0xE5, 0xE2, 0x26, 0xD1, 0x9F, 0x92, 0x34,
+    0xC1, 0x4D, 0x65, 0x2A, 0x15, 0xAF, 0xDB, 0xB9, 0x9D, 0x8D, 0xEA, 0x56, 0x6A, 0x45, 0xE0, 0x06,
+    0x61, 0xE4, 0xE8, 0x32, 0xB2, 0x1D, 0x5E, 0x4B, 0xB9, 0xC5, 0x6E, 0xF7, 0x57, 0x92, 0x72, 0x69,
+    0x07, 0xB9, 0x26, 0xF2, 0xBD, 0x4F, 0xBE, 0x8E, 0xA0, 0x7E, 0x25, 0x65, 0xC2, 0xF9, 0xB3, 0x48,
+    0xD3, 0xF3, 0xE1, 0x8D, 0xCD, 0x66, 0xD3, 0xA9, 0x26, 0x55, 0x3D, 0x5F, 0xAF, 0xD7, 0x39, 0xFD,
+    0x2A, 0x88, 0x20, 0xAC, 0x60, 0x67, 0x11, 0xF7, 0x9C, 0x98, 0x57, 0xF8, 0xAB, 0x74, 0xF9, 0x5D,
+    0x0A, 0x65, 0x58, 0x3D, 0xD5, 0x41, 0xDA, 0x00, 0x3C, 0x55, 0x14, 0x5C, 0x02, 0x5E, 0x14, 0x1B,
+    0x1A, 0x1D, 0x0A, 0xAD, 0x4E, 0xA3, 0xB8, 0xBF, 0x67, 0xDF, 0x97, 0xDB, 0xD7, 0x38, 0xC9, 0x01,
+    0x3C, 0x78, 0x1E, 0x10, 0xD2, 0x85, 0x3A, 0x22, 0x40, 0x81, 0x00, 0x38, 0x74, 0x04, 0x38, 0x9D,
+    0xA5, 0xFA, 0x53, 0x17, 0x91, 0x3B, 0x72, 0x92, 0x53, 0xBF, 0xC9, 0x09, 0xF0, 0xF2, 0xD1, 0x52,
+    0x24, 0xDE, 0x52, 0x19, 0xE9, 0x06, 0x12, 0x37, 0xF1, 0xE1, 0xF8, 0x25, 0x57, 0x3F, 0x8B, 0x79,
+    0xD8, 0xE8, 0xCA, 0xCE, 0x4E, 0xFB, 0x36, 0xDC, 0xE5, 0x84, 0x0D, 0xA4, 0x45, 0xDC, 0x88, 0x93,
+    0xBB, 0x01, 0x41, 0xFC, 0x50, 0x6E, 0x81, 0xB1, 0x8A, 0x86, 0xE4, 0x81, 0x26, 0x3B, 0xD7, 0x9A,
+    0xF1, 0x82, 0xB9, 0x67, 0x7A, 0xBB, 0x39, 0x8B, 0x9A, 0x1A, 0x0D, 0x1A, 0x91, 0x81, 0xCE, 0x75,
+    0x92, 0xAE, 0x07, 0xA0, 0xCF, 0xAA, 0xD4, 0x3B, 0xD9, 0x30, 0xB9, 0xE1, 0x00, 0x46, 0x0F, 0x28,
+    0xCB, 0xC0, 0xAB, 0xFE, 0xCA, 0x51, 0x15, 0xE4, 0xC9, 0x12, 0x01, 0x0C, 0x0C, 0x71, 0x3D, 0x74,
+    0x8A, 0x0E, 0x3A, 0xCD, 0x16, 0xEE, 0x1E, 0xEB, 0xD5, 0x15, 0x03, 0x32, 0x11, 0x0C, 0x95, 0xD1,
+    0x8D, 0x30, 0x05, 0xA7, 0xD9, 0x81, 0x93, 0xD5, 0xB5, 0xAB, 0x57, 0x4B, 0x0A, 0xEA, 0x23, 0x2E,
+    0x8B, 0x46, 0x71, 0x8C, 0xCA, 0x41, 0xBA, 0x9A, 0xF7, 0x12, 0xB3, 0xF9, 0xBF, 0x2A, 0x3A, 0x39,
+    0xEA, 0xCD, 0x4B, 0x14, 0x8D, 0x28, 0x80, 0x2C, 0x55, 0x92, 0x5B, 0xF0, 0x6C, 0x40, 0x2A, 0x34,
+    0xA1, 0x1B, 0xDB, 0x09, 0x25, 0x0B, 0x5C, 0xD2, 0x4E, 0x88, 0x63, 0x52, 0xB5, 0x30, 0xB6, 0xA7,
+    0x0F, 0xE8, 0x4A, 0xFB, 0x81, 0x21, 0x95, 0x19, 0xDB, 0x8F, 0x3C, 0xC2, 0x53, 0x92, 0x9A, 0xD5,
+    0x27, 0x3E, 0x1C, 0x74, 0xDA, 0x59, 0xB9, 0xA5, 0x81, 0x2B, 0x88, 0xF7, 0xE3, 0x75, 0x2C, 0xAA,
+    0x58, 0x4F, 0xE2, 0x51, 0x0E, 0xA8, 0x12, 0xFA, 0xBB, 0x7E, 0xB9, 0xC7, 0x93, 0xD7, 0x12, 0xB9,
+    0x55, 0x46, 0xD0, 0x5D, 0x12, 0x5C, 0x42, 0x1C, 0xFB, 0x7C, 0xAA, 0x1C, 0xD7, 0xAF, 0x1E, 0x13,
+    0x4E, 0x87, 0x75, 0xDA, 0xA2, 0x1E, 0x9B, 0x77, 0x8A, 0x4A, 0x4B, 0x8B, 0x1F, 0xC5, 0xA5, 0x0A,
+    0xED, 0x0D, 0x05, 0x8A, 0xCB, 0x80, 0xD5, 0xC8, 0x0C, 0xF6, 0xF5, 0x03, 0x4A, 0x11, 0xE5, 0x0B,
+    0x80, 0xBA, 0x6A, 0x02, 0x88, 0x45, 0x63, 0x28, 0xD8, 0x3F, 0x84, 0x0D, 0x04, 0x1B, 0x94, 0x69,
+    0x2B, 0xDE, 0x57, 0x89, 0xD8, 0xFC, 0x00, 0x38, 0xD8, 0x70, 0x48, 0xA2, 0xC9, 0xA6, 0xCF, 0x4D,
+    0x93, 0xA5, 0x0C, 0xA0, 0xC0, 0x64, 0xF6, 0x2D, 0x64, 0x37, 0x3A, 0x16, 0x86, 0x0D, 0x58, 0x63,
+    0x94, 0x32, 0x34, 0x23, 0xCB, 0xF9, 0xA6, 0xF9, 0x9A, 0xF6, 0x47, 0x72, 0x4C, 0x8A, 0xEC, 0x96,
+    0xBD, 0xAA, 0x9B, 0x8C, 0xA7, 0xE2, 0x80, 0x98, 0x09, 0xDF, 0x71, 0x0F, 0x33, 0x15, 0xA9, 0x44,
+    0xA2, 0xCD, 0x04, 0xA5, 0x45, 0xEB, 0x1C, 0x97, 0xC1, 0xB4, 0x01, 0x07, 0xF6, 0x5F, 0xC2, 0xD2,
+    0x2E, 0x13, 0x4E, 0x6E, 0xFD, 0x92, 0x2F, 0x33, 0xD6, 0xDC, 0x36, 0x72, 0x43, 0xC9, 0x9C, 0x75,
+    0xE8, 0x80, 0xE3, 0xD3, 0x91, 0xFD, 0x75, 0xE6, 0x1A, 0x3E, 0x74, 0xB9, 0xCB, 0xFC, 0xB6, 0xC7,
+    0xB3, 0x5E, 0xB3, 0x13, 0x35, 0x99, 0x6D, 0x34, 0x3B, 0xA6, 0x79, 0xBC, 0xF9, 0x45, 0xBE, 0x19,
+    0x3F, 0xC8, 0xA5, 0x06, 0x7B, 0x71, 0x8B, 0x7C, 0xB8, 0x74, 0xF9, 0x20, 0x9B, 0xB5, 0x34, 0x69,
+    0x27, 0xDA, 0x8B, 0x90, 0xAD, 0x97, 0x6F, 0x52, 0x86, 0xE3, 0x06, 0x7A, 0xA3, 0x9A, 0xEB, 0xEC,
+    0x1B, 0xF2, 0x0E, 0x5F, 0x50, 0xCC, 0x72, 0xBB, 0x86, 0x6A, 0x50, 0x9B, 0x02, 0x00, 0x06, 0x10,
+    0x94, 0x69, 0xF3, 0x2B, 0xB6, 0x7A, 0x7C, 0x11, 0x02, 0x0D, 0x0D, 0xDA, 0x49, 0x4C, 0xB3, 0x18,
+    0xFF, 0x0F, 0x72, 0x98, 0x61, 0x1E, 0xB8, 0xE8, 0x2D, 0x24, 0xF7, 0xF8, 0x99, 0xCD, 0xA6, 0xA7,
+    0x7E, 0x23, 0xA7, 0xE1, 0x3F, 0x9A, 0x88, 0x3C, 0x31, 0x27, 0xF0, 0xDC, 0xDB, 0xC0, 0xAF, 0x0B,
+    0xBE, 0x22, 0x17, 0xB4, 0x7B, 0x8F, 0x92, 0x4B, 0x3B, 0x4F, 0x68, 0x4F, 0x57, 0x40, 0x5E, 0xD4,
+    0x4C, 0x1B, 0x20, 0x85, 0x9B, 0xE0, 0x18, 0x37, 0x41, 0x1F, 0x37, 0xB5, 0x9C, 0xFE, 0x88, 0xF7,
+    0xDC, 0xD9, 0xB9, 0xC6, 0x56, 0xDF, 0xEB, 0xD2, 0xE8, 0x73, 0x9D, 0x50, 0x81, 0x10, 0xF9, 0x64,
+    0xD7, 0xBC, 0xFF, 0x07, 0xE3, 0x13, 0xD5, 0x54, 0x3D, 0x6E, 0xD6, 0x40, 0x10, 0x1D, 0xDB, 0x22,
+    0x86, 0xB8, 0xD8, 0xAF, 0x48, 0x1A, 0x22, 0xE1, 0x96, 0x02, 0xB1, 0x27, 0x40, 0x36, 0x70, 0x81,
+    0xAF, 0x20, 0x87, 0xA0, 0xE2, 0x04, 0x60, 0x73, 0x83, 0xDC, 0x80, 0x16, 0x41, 0xC1, 0x05, 0x50,
+    0x76, 0x6F, 0x10, 0x73, 0x03, 0x23, 0xA5, 0xA3, 0x60, 0x0B, 0x0B, 0x19, 0xB0, 0x77, 0x78, 0x33,
+    0xCE, 0xF7, 0x47, 0x8F, 0x14, 0x2C, 0x79, 0xBC, 0xB6, 0x77, 0x66, 0xDE, 0xBC, 0x79, 0xB3, 0x44,
+    0xB4, 0x22, 0xB9, 0x4C, 0x9D, 0xC1, 0x26, 0x53, 0x12, 0xF0, 0x28, 0x7F, 0xCD, 0xF2, 0x8D, 0xB9,
+    0x85, 0x4D, 0xB9, 0xD3, 0x1D, 0x35, 0xED, 0x5D, 0x27, 0x6A, 0x2B, 0xAF, 0xAE, 0x13, 0xED, 0xB6,
+    0x35, 0xEA, 0x69, 0xB8, 0x97, 0x68, 0x91, 0x75, 0xD7, 0x3B, 0x89, 0x59, 0x04, 0x7D, 0x89, 0x66,
+    0x50, 0x47, 0x09, 0x9D, 0x0F, 0x85, 0xB8, 0x32, 0x39, 0xC4, 0xB1, 0x5D, 0x8E, 0x97, 0x6C, 0x3E,
+    0x77, 0x9D, 0x64, 0xE6, 0x08, 0x18, 0x78, 0x04, 0xCA, 0xE2, 0x87, 0x8F, 0x70, 0x75, 0x2D, 0xD9,
+    0x40, 0x26, 0x20, 0x51, 0x9D, 0xCA, 0xCF, 0x31, 0x71, 0xD7, 0x54, 0xF0, 0xE0, 0xB8, 0xCB, 0x99,
+    0xAF, 0x78, 0x22, 0x87, 0x9B, 0xD6, 0x82, 0x25, 0x50, 0x47, 0xD9, 0x58, 0x78, 0xCA, 0xB4, 0x06,
+    0x09, 0x46, 0xF6, 0x7A, 0xBF, 0x00, 0x7A, 0x99, 0xAC, 0x29, 0xE7, 0xAB, 0x40, 0x56, 0x92, 0xB8,
+    0xDF, 0xDC, 0x25, 0xDC, 0x3A, 0x9F, 0x45, 0xA0, 0x01, 0x2C, 0x6E, 0xCD, 0x08, 0x64, 0x65, 0x48,
+    0x18, 0x79, 0x33, 0xA6, 0xAA, 0xCF, 0x23, 0x8C, 0x99, 0x61, 0xAC, 0x98, 0xCB, 0xE9, 0x51, 0xF5,
+    0xE3, 0x27, 0x4F, 0x96, 0xBF, 0xF2, 0x58, 0xF2, 0x5B, 0xEE, 0x8B, 0x48, 0x5C, 0x03, 0xC0, 0xEA,
+    0x96, 0x53, 0x84, 0x4C, 0x0A, 0x24, 0x0B, 0x0A, 0x51, 0xBF, 0x50, 0xA9, 0x40, 0x13, 0x7E, 0xBF,
+    0x80, 0x93, 0xCE, 0x93, 0xED, 0xFF, 0x19, 0x51, 0xC0, 0xBA, 0xA6, 0xC7, 0x92, 0xE4, 0xB3, 0x98,
+    0x61, 0xE9, 0x1A, 0xCC, 0xBC, 0x16, 0x14, 0x82, 0xCF, 0xB5, 0xDB, 0x66, 0xDD, 0xDB, 0x22, 0xB4,
+    0xB2, 0xA9, 0x11, 0xC8, 0x6E, 0x94, 0x55, 0xBF, 0xF9, 0xBB, 0x5C, 0xA7, 0x50, 0xE9, 0x11, 0xF3,
+    0x05, 0x2A, 0xE0, 0x59, 0xD9, 0x01, 0xEC, 0x8B, 0xC6, 0x97, 0x33, 0xD8, 0x45, 0x17, 0xD2, 0x11,
+    0xB8, 0x68, 0x02, 0x42, 0x3A, 0xC9, 0x58, 0x24, 0xCD, 0x7E, 0x13, 0xC6, 0x4A, 0x40, 0x23, 0x52,
+    0xC9, 0xB4, 0x7C, 0x6D, 0x50, 0x25, 0xA9, 0x0A, 0x90, 0x9B, 0xA6, 0xA8, 0x3E, 0xF7, 0x15, 0xD7,
+    0x67, 0x01, 0xC1, 0xC1, 0xA3, 0x1A, 0x2C, 0xE1, 0xD6, 0xE8, 0xDE, 0xD3, 0x1D, 0x8E, 0x63, 0xDC,
+    0x39, 0xA0, 0x66, 0x93, 0xB4, 0x5D, 0x3B, 0xB8, 0xDC, 0xD5, 0xCD, 0xCF, 0x9D, 0x0E, 0x25, 0x1D,
+    0x22, 0xA3, 0x9B, 0x05, 0xC4, 0x9A, 0xCF, 0x85, 0xCF, 0x66, 0x5A, 0x2D, 0x4E, 0x00, 0xD8, 0xF8,
+    0xA5, 0x68, 0xB0, 0x8C, 0x3E, 0x2B, 0xE0, 0x94, 0xAA, 0x90, 0x77, 0x86, 0x3F, 0x0D, 0x89, 0x40,
+    0xA8, 0x80, 0x20, 0x15, 0x00, 0x77, 0x96, 0x88, 0x67, 0x4A, 0x96, 0xCE, 0xB1, 0x04, 0xB1, 0xDF,
+    0xB1, 0xB4, 0x5F, 0x50, 0x76, 0xD5, 0x95, 0x2D, 0x1D, 0xB5, 0xC9, 0x76, 0x92, 0xCF, 0x65, 0x37,
+    0xC7, 0x1A, 0x21, 0x78, 0x40, 0x11, 0x22, 0x90, 0xF8, 0x94, 0xA9, 0x19, 0xC8, 0xFA, 0x2A, 0x50,
+    0xD1, 0x57, 0x03, 0x54, 0x52, 0x22, 0xF5, 0x5A, 0x78, 0x03, 0x52, 0xD5, 0x88, 0xB0, 0xE3, 0x94,
+    0x9D, 0xBF, 0x29, 0x93, 0xAC, 0x16, 0x35, 0xDF, 0x2D, 0xC0, 0x6B, 0x49, 0xE8, 0xC1, 0x2B, 0x50,
+    0x06, 0xE1, 0x64, 0x2A, 0x54, 0x2C, 0x7B, 0xF8, 0xEB, 0xDE, 0x17, 0x5B, 0x0A, 0x30, 0xA7, 0xA8,
+    0x08, 0xDE, 0x03, 0xA5, 0x71, 0x02, 0x6F, 0xE8, 0x9C, 0x7F, 0x03, 0xAA, 0x9E, 0xEC, 0x68, 0xBA,
+    0x5F, 0x2B, 0x4D, 0x25, 0x6A, 0x75, 0x3C, 0x26, 0xFC, 0x2C, 0x08, 0x4B, 0x32, 0x1C, 0x32, 0x2D,
+    0x52, 0xAD, 0x90, 0x54, 0xF5, 0x37, 0x77, 0xA0, 0x56, 0x38, 0xAA, 0xA2, 0xEB, 0x20, 0x02, 0x6F,
+    0xC0, 0xAE, 0x52, 0x74, 0x42, 0x07, 0x59, 0x95, 0x55, 0x12, 0x35, 0x00, 0x95, 0x0E, 0xE2, 0xC1,
+    0x29, 0x77, 0x2B, 0x18, 0x3A, 0xAE, 0x55, 0x08, 0xF9, 0xBC, 0x94, 0xD8, 0xD4, 0x9B, 0x23, 0x7B,
+    0xC3, 0x8B, 0x61, 0x2F, 0x0E, 0x96, 0xA3, 0xD0, 0x02, 0x3A, 0x6A, 0x1C, 0x16, 0x60, 0x47, 0x59,
+    0x91, 0x65, 0x5C, 0xEA, 0x14, 0x52, 0xD8, 0x97, 0xCF, 0xF9, 0xDB, 0x8C, 0xD3, 0x20, 0x18, 0x55,
+    0x5C, 0x4B, 0x8B, 0x1C, 0x1E, 0xD2, 0x03, 0xC4, 0x6F, 0x6D, 0x87, 0x23, 0x47, 0xCE, 0x2C, 0x27,
+    0xBA, 0x33, 0x3A, 0x1C, 0x6A, 0x4C, 0x7B, 0x8B, 0x38, 0x49, 0xE8, 0x88, 0x68, 0x4C, 0x47, 0x32,
+    0xFE, 0x12, 0x31, 0xAD, 0x57, 0x6D, 0x68, 0x08, 0x9D, 0x99, 0xBC, 0xDB, 0xEF, 0x21, 0x28, 0x42,
+    0x08, 0x52, 0xED, 0xC8, 0x88, 0x09, 0x4B, 0x98, 0x85, 0x84, 0x8A, 0xCD, 0x7E, 0x21, 0x4A, 0x07,
+    0x4E, 0xB4, 0xA3, 0x43, 0x26, 0x5C, 0x01, 0xF6, 0x6B, 0x12, 0x05, 0x25, 0xCB, 0xA0, 0xE3, 0xBB,
+    0x8D, 0x74, 0xA0, 0xA1, 0xFF, 0xFE, 0xFA, 0x03, 0xCD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x9D,
+    0x3D, 0x2B, 0x58, 0xC4, 0x85, 0x53, 0x00, 0x05, 0xCD, 0xF6, 0x14, 0xF8, 0x13, 0xD6, 0x3D, 0x4D,
+    0x9A, 0x88, 0x82, 0x9A, 0x82, 0x2A, 0x3F, 0x00, 0xD8, 0x54, 0xB4, 0xF9, 0x03, 0x1A, 0xAA, 0xA3,
+    0xA0, 0xA1, 0xA0, 0x40, 0x5A, 0x2B, 0xFC, 0x80, 0xF9, 0x03, 0x37, 0x20, 0x94, 0x86, 0x2D, 0x0E,
+    0x30, 0xC2, 0xE7, 0xE1, 0xBD, 0x71, 0x74, 0x4A, 0x10, 0x12, 0x05, 0x14, 0x59, 0x5D, 0xF6, 0xBC,
+    0xDE, 0x9B, 0x99, 0xF7, 0xDE, 0xBC, 0xDD, 0x88, 0xB8, 0x13, 0x79, 0x23, 0x22, 0x41, 0x42, 0x2B,
+    0xB2, 0x9A, 0xFC, 0x80, 0x45, 0xF9, 0x7D, 0x83, 0x59, 0x9A, 0x2D, 0xE7, 0x95, 0xD6, 0xFC, 0x2A,
+    0x7A, 0xD9, 0x8D, 0xBD, 0x23, 0xBE, 0x8A, 0xAA, 0x78, 0xD7, 0x28, 0xBF, 0x0A, 0xCC, 0xDA, 0xCA,
+    0x43, 0x7D, 0x16, 0x11, 0xE4, 0x37, 0x4E, 0x13, 0x02, 0x25, 0x43, 0x6C, 0x48, 0x52, 0x4D, 0x78,
+    0x12, 0xA7, 0x9D, 0x34, 0x83, 0x94, 0x93, 0xE4, 0xF8, 0x0D, 0x16, 0xB1, 0xE3, 0x02, 0x1F, 0x2E,
+    0xF0, 0xF1, 0x93, 0xF8, 0x11, 0x61, 0x2D, 0x4B, 0x86, 0x8D, 0x54, 0x49, 0x72, 0xE6, 0xC0, 0x7E,
+    0xCF, 0x34, 0x61, 0x94, 0x7C, 0x16, 0x8F, 0x75, 0xFC, 0x78, 0xCC, 0x64, 0xA8, 0x39, 0x48, 0x65,
+    0x73, 0x86, 0xF9, 0x44, 0x2E, 0x0C, 0x77, 0xB8, 0x87, 0xB9, 0xD2, 0x7C, 0xE0, 0x7C, 0x3A, 0x82,
+    0x81, 0x26, 0x12, 0x2A, 0xA6, 0x80, 0x39, 0x9B, 0x3D, 0x39, 0xE8, 0xBD, 0x8E, 0xE4, 0x4F, 0x41,
+    0xE4, 0x91, 0x4F, 0x07, 0xC0, 0xF8, 0x73, 0x24, 0x65, 0xDD, 0x72, 0xFE, 0x82, 0x52, 0x4E, 0x5B,
+    0xE0, 0x14, 0x6D, 0x2B, 0x24, 0x8A, 0x5D, 0x09, 0x65, 0xC2, 0x90, 0x01, 0xB3, 0x4F, 0x4E, 0x99,
+    0x0D, 0x5B, 0xC8, 0x46, 0x66, 0x78, 0x0A, 0xB6, 0x0D, 0xBE, 0x52, 0x8E, 0x55, 0x2C, 0x00, 0xEB,
+    0xF8, 0x05, 0x99, 0xEA, 0x73, 0x60, 0xF4, 0xFA, 0x0C, 0x33, 0xF8, 0x05, 0x94, 0xDB, 0x13, 0xF7,
+    0x1F, 0xB5, 0xBC, 0xA3, 0x67, 0x27, 0xE5, 0x84, 0xC8, 0x19, 0x8B, 0x57, 0x7A, 0xD6, 0xFE, 0xAE,
+    0x65, 0xF8, 0x37, 0x2D, 0xA9, 0x1B, 0x7E, 0x85, 0x84, 0xA0, 0x26, 0x77, 0xF8, 0x28, 0x05, 0x94,
+    0x92, 0xB5, 0x7E, 0x06, 0x57, 0xE5, 0x8B, 0xB5, 0xBE, 0x14, 0xCA, 0x82, 0xBF, 0x6F, 0xB3, 0xBD,
+    0xEC, 0x51, 0x53, 0xAD, 0xBD, 0xD8, 0x0F, 0x09, 0x01, 0x39, 0xE4, 0xAA, 0xA1, 0x53, 0x99, 0xA4,
+    0x04, 0x31, 0xF2, 0x0A, 0x03, 0xB6, 0xC0, 0x02, 0x1A, 0x12, 0x1A, 0xC5, 0xCB, 0xE6, 0xE2, 0xCB,
+    0x69, 0x17, 0xBE, 0xFD, 0xD0, 0x69, 0xA5, 0xB3, 0xD7, 0x76, 0x51, 0x2E, 0x0E, 0x54, 0xFF, 0x50,
+    0x0E, 0x0C, 0xD3, 0x11, 0x85, 0x43, 0x11, 0x1A, 0xD5, 0x50, 0xAD, 0xD7, 0x97, 0x40, 0x2F, 0x83,
+    0x5C, 0xB6, 0xC6, 0x6B, 0x63, 0x1C, 0x61, 0xB9, 0x71, 0x2F, 0x22, 0xA4, 0x77, 0x13, 0xAB, 0xE7,
+    0x26, 0xA2, 0x17, 0x6A, 0x62, 0xCD, 0xC6, 0x9C, 0x9B, 0xEF, 0x2B, 0x4A, 0x21, 0x08, 0xA9, 0x99,
+    0x84, 0x0D, 0x27, 0x5F, 0x89, 0xBD, 0x65, 0xE5, 0x23, 0x02, 0x8B, 0x96, 0xF8, 0x1B, 0x04, 0xD6,
+    0xD9, 0x28, 0xC5, 0x56, 0x8E, 0x7B, 0xC7, 0xF6, 0x59, 0xC5, 0x89, 0xD1, 0xEC, 0xEB, 0xFE, 0x7A,
+    0xCD, 0x1C, 0x9D, 0x63, 0xCA, 0x9B, 0x47, 0x87, 0x17, 0x94, 0x85, 0x64, 0x1E, 0xA0, 0x2A, 0x1D,
+    0xA5, 0xFA, 0xA4, 0xE2, 0xFB, 0xD0, 0x95, 0x83, 0x1F, 0x8A, 0x54, 0xA6, 0x6C, 0x2C, 0x36, 0x6E,
+    0xEB, 0x37, 0x12, 0x23, 0xFA, 0x87, 0xC8, 0x92, 0x50, 0xB6, 0x72, 0x1D, 0x12, 0xFA, 0x2E, 0x7C,
+    0x6D, 0x06, 0xA8, 0x9B, 0x84, 0x39, 0x0B, 0xE2, 0xBE, 0x71, 0x81, 0x76, 0xD1, 0x66, 0x76, 0xA8,
+    0x1F, 0xD3, 0xE3, 0xAF, 0x07, 0x36, 0x6E, 0xB6, 0xB3, 0x6C, 0xA7, 0xF8, 0xE0, 0xB2, 0x46, 0x81,
+    0x28, 0x57, 0xC4, 0x5A, 0xE7, 0xBA, 0x34, 0xAC, 0x7D, 0x90, 0x28, 0x83, 0xEF, 0x78, 0x08, 0x9F,
+    0xB2, 0x83, 0x2E, 0x9D, 0xB3, 0x5E, 0x64, 0x68, 0x7A, 0x4B, 0xA7, 0x4B, 0xA3, 0x37, 0x96, 0xA4,
+    0x3B, 0xD7, 0xAF, 0x30, 0xFD, 0x4C, 0x50, 0x1E, 0xEB, 0xB7, 0x6C, 0x6D, 0x9E, 0xE0, 0x64, 0xDE,
+    0x31, 0xB1, 0xBF, 0x86, 0xBC, 0x28, 0x93, 0xAC, 0x62, 0x57, 0xEA, 0x72, 0xD8, 0x70, 0x1C, 0xB2,
+    0xC1, 0x75, 0x6E, 0xBB, 0x82, 0x39, 0x91, 0x30, 0x67, 0x52, 0x9E, 0xB9, 0xDD, 0xB8, 0x5D, 0x23,
+    0x3F, 0x9B, 0x06, 0x53, 0xCF, 0xC7, 0xC9, 0x6D, 0x71, 0x0A, 0x67, 0x37, 0x4B, 0x14, 0x98, 0xA8,
+    0x8D, 0xB5, 0xFF, 0xA0, 0x75, 0xF1, 0x13, 0x8D, 0x20, 0x28, 0x83, 0xD4, 0xCB, 0x09, 0x5C, 0x36,
+    0x65, 0x7A, 0x7F, 0x66, 0xF3, 0x81, 0x14, 0x3B, 0x11, 0xF8, 0x5D, 0x7D, 0x21, 0x6F, 0xD9, 0x19,
+    0xD0, 0x7A, 0x87, 0xBC, 0x32, 0xE4, 0x8D, 0xFC, 0x61, 0x5C, 0x05, 0xA9, 0x64, 0xBF, 0x36, 0xB8,
+    0xB4, 0x29, 0xA1, 0x36, 0xF5, 0xA5, 0x8E, 0x42, 0x26, 0x38, 0x8A, 0x2A, 0xC1, 0x50, 0x14, 0x89,
+    0x7E, 0x82, 0x46, 0xB4, 0x13, 0x25, 0x82, 0x9B, 0xA8, 0x10, 0xCD, 0x44, 0x81, 0xE0, 0xA5, 0xF7,
+    0xD0, 0x87, 0x56, 0xA2, 0x3C, 0x74, 0x92, 0xA9, 0x53, 0xDA, 0x91, 0x89, 0xE4, 0xBB, 0x38, 0x1A,
+    0x46, 0xBF, 0x35, 0xD1, 0xE8, 0xC0, 0x87, 0x5B, 0xCF, 0xB7, 0x84, 0xFD, 0xD8, 0x60, 0x0B, 0xEF,
+    0x12, 0xF2, 0xB5, 0x7F, 0x1B, 0x91, 0xB7, 0x57, 0x66, 0x50, 0x4B, 0x1A, 0xD4, 0xAE, 0xC6, 0xF3,
+    0x7F, 0x23, 0xBC, 0xEC, 0x8D, 0xEF, 0x5D, 0x2A, 0xE7, 0xEC, 0xFA, 0x2A, 0x71, 0xEF, 0x6C, 0x5C,
+    0x3C, 0x17, 0x94, 0x15, 0x53, 0x66, 0x0A, 0x33, 0xCA, 0x32, 0x06, 0xD9, 0x3D, 0x2E, 0xCD, 0x0A,
+    0x67, 0x56, 0x68, 0x39, 0x90, 0xED, 0x7F, 0x20, 0x3D, 0x88, 0x7B, 0x82, 0x12, 0x00, 0x8A, 0xAB,
+    0x40, 0xDE, 0xE1, 0x84, 0xFF, 0x38, 0xC4, 0xEB, 0x5A, 0x0A, 0x56, 0x5D, 0xB5, 0x0E, 0x3B, 0xA1,
+    0x0E, 0x28, 0xDE, 0xF0, 0xEE, 0x17, 0x6D, 0x58, 0x55, 0xC7, 0xDD, 0x9D, 0xE1, 0xC6, 0x2B, 0x68,
+    0x94, 0xBF, 0x8F, 0x5F, 0xCD, 0x55, 0x3B, 0x8E, 0xD4, 0x40, 0x10, 0x2D, 0xBB, 0x61, 0x2C, 0xE4,
+    0xC0, 0xC9, 0x22, 0x24, 0x08, 0x9C, 0x42, 0xD4, 0x47, 0xB0, 0x8F, 0x40, 0x42, 0xBC, 0x39, 0xC9,
+    0x72, 0x83, 0xB6, 0x38, 0xC1, 0x04, 0x7B, 0x00, 0x02, 0x92, 0x8D, 0xB8, 0x00, 0x5A, 0xFB, 0x08,
+    0xE6, 0x04, 0x38, 0x18, 0x90, 0x20, 0x59, 0x07, 0x46, 0xF2, 0x20, 0xDB, 0xC5, 0x7B, 0x35, 0x1F,
+    0x66, 0xE0, 0x02, 0x63, 0xC9, 0xA5, 0x9E, 0x1E, 0xD7, 0xAB, 0x57, 0xAF, 0xAA, 0xAB, 0x25, 0x92,
+    0x95, 0xC8, 0x18, 0x8F, 0x92, 0x35, 0xF7, 0x22, 0xB5, 0x6F, 0xC4, 0x69, 0x2F, 0xE2, 0x27, 0x11,
+    0xD1, 0x52, 0x24, 0x69, 0xE5, 0xE4, 0x79, 0x8E, 0x9D, 0xA0, 0xF8, 0x5B, 0x47, 0x49, 0xB7, 0x75,
+    0x13, 0xCD, 0x6E, 0x92, 0xA2, 0x0A, 0x55, 0xDA, 0x67, 0xBD, 0x2C, 0xF1, 0x2C, 0xF9, 0x17, 0x2D,
+    0xE3, 0x45, 0x5B, 0x29, 0xB4, 0x03, 0x14, 0xBC, 0x8B, 0x56, 0xD6, 0x6E, 0x96, 0x20, 0xC5, 0xAF,
+    0xD0, 0x45, 0xAA, 0x93, 0x64, 0xBA, 0x00, 0x02, 0xAF, 0x5C, 0xED, 0x60, 0xD3, 0x0A, 0xC6, 0x71,
+    0x43, 0x00, 0x0C, 0x97, 0x07, 0xF8, 0xE5, 0x7D, 0x8D, 0xF0, 0x93, 0x03, 0x9B, 0x57, 0xF2, 0xE4,
+    0x48, 0xE1, 0x0D, 0x28, 0xAC, 0x54, 0x37, 0x12, 0xAB, 0x6A, 0x0B, 0x3C, 0x00, 0xD6, 0x80, 0x6F,
+    0xF2, 0x59, 0xE2, 0xC9, 0x81, 0x5C, 0x51, 0x21, 0xAC, 0xEB, 0x73, 0xA4, 0x70, 0xE5, 0x98, 0x83,
+    0x14, 0xC0, 0x90, 0xC4, 0xF0, 0xEB, 0x0E, 0x26, 0x5B, 0xC8, 0x01, 0x04, 0x55, 0xBF, 0x2E, 0x92,
+    0xEA, 0x88, 0x94, 0x9D, 0xA6, 0xF4, 0xED, 0xC2, 0x28, 0x6E, 0x76, 0xF8, 0x0F, 0x88, 0xFA, 0xED,
+    0x1A, 0xE0, 0x08, 0xD1, 0x30, 0xCE, 0xC0, 0x90, 0x1B, 0xB8, 0x3F, 0x3D, 0x95, 0x24, 0x35, 0x81,
+    0xB4, 0xE1, 0xD2, 0x82, 0xD5, 0x35, 0x83, 0xF5, 0x33, 0x6C, 0x88, 0x90, 0x8D, 0x1B, 0xE2, 0x33,
+    0x0D, 0xA1, 0xE2, 0x2D, 0x39, 0xA8, 0xCE, 0x42, 0xD8, 0x5E, 0xF2, 0xD1, 0xFF, 0x2C, 0x45, 0xAB,
+    0x00, 0xF1, 0x27, 0x51, 0xA6, 0x9E, 0x80, 0x7C, 0xA8, 0x0A, 0x90, 0xD5, 0x48, 0xA9, 0xCD, 0xCD,
+    0x00, 0xAB, 0x58, 0x82, 0xC4, 0x1A, 0xD6, 0x33, 0x8F, 0x98, 0x41, 0x24, 0x33, 0xEB, 0x15, 0x22,
+    0x26, 0x0A, 0xE2, 0x91, 0x3E, 0x80, 0x6B, 0x3E, 0xC4, 0x80, 0x86, 0x83, 0xB6, 0x00, 0xC5, 0x22,
+    0x1B, 0x24, 0x45, 0xB1, 0xB6, 0x8F, 0xA1, 0x4E, 0x60, 0x70, 0x94, 0x88, 0x3E, 0xAB, 0x85, 0x78,
+    0x12, 0x19, 0xB5, 0x41, 0xDE, 0x21, 0x7C, 0xE3, 0xF1, 0x5B, 0x3F, 0xB5, 0x64, 0x39, 0x10, 0xDB,
+    0x22, 0x3C, 0x92, 0x0B, 0x2C, 0x42, 0x25, 0xC0, 0xCE, 0xAA, 0x84, 0x01, 0xCA, 0xCF, 0xAC, 0x04,
+    0x7B, 0x2E, 0x52, 0x63, 0x5C, 0x57, 0xE7, 0xC2, 0x47, 0x77, 0xA5, 0x7D, 0x81, 0x4F, 0x72, 0x58,
+    0x7C, 0xF6, 0x7E, 0xF9, 0x28, 0xD9, 0x48, 0xB5, 0x8B, 0x06, 0x1D, 0x0C, 0xAD, 0x51, 0x84, 0x64,
+    0x64, 0x2F, 0x66, 0x7D, 0x0E, 0xC6, 0xC5, 0x77, 0x92, 0x2F, 0x78, 0x26, 0xC4, 0x6F, 0xA9, 0xB9,
+    0x65, 0xE0, 0x77, 0x55, 0x6F, 0xAD, 0x1E, 0x6C, 0xD9, 0xC0, 0x9E, 0xCE, 0x17, 0xD5, 0x32, 0xD2,
+    0xD2, 0x43, 0xED, 0x9E, 0x75, 0x29, 0x1A, 0x2E, 0x80, 0x50, 0x37, 0x4E, 0xD7, 0xD7, 0x33, 0x0B,
+    0x44, 0x5D, 0xD4, 0x7C, 0x6E, 0x7E, 0x9C, 0x72, 0xE3, 0x0E, 0xA3, 0x23, 0xF2, 0x64, 0xE0, 0x24,
+    0x9F, 0x76, 0xE7, 0x19, 0x5C, 0x90, 0xF2, 0xF1, 0x07, 0xDA, 0x82, 0x12, 0x44, 0x16, 0x26, 0x35,
+    0xDA, 0x79, 0xFB, 0x4F, 0xAF, 0x5C, 0xB2, 0xF2, 0x97, 0xA2, 0x66, 0x54, 0x5A, 0x52, 0x76, 0x9A,
+    0x07, 0x43, 0xB6, 0xD1, 0xC2, 0x48, 0x91, 0xA9, 0x1A, 0x68, 0x56, 0xE5, 0xA9, 0xA4, 0x71, 0x6F,
+    0x72, 0xD8, 0xD2, 0x7C, 0x32, 0xF6, 0x8E, 0xDC, 0xD3, 0x38, 0x6B, 0xA6, 0xAC, 0x3F, 0x56, 0x48,
+    0x5E, 0xFE, 0x75, 0x7C, 0xFB, 0x5A, 0xEC, 0xEC, 0x0F, 0xA6, 0x49, 0x23, 0xA1, 0xAB, 0xEF, 0x30,
+    0x61, 0x38, 0x67, 0xB2, 0x9E, 0xB3, 0x02, 0x64, 0x51, 0x90, 0x85, 0x1D, 0xE8, 0x26, 0x56, 0x28,
+    0xDB, 0xD6, 0x36, 0x0B, 0x48, 0x25, 0x5D, 0xCA, 0xC3, 0xC9, 0x4A, 0x2D, 0x6C, 0xB1, 0x23, 0x4C,
+    0x41, 0x72, 0x0E, 0x94, 0x44, 0x6B, 0x4E, 0x98, 0x36, 0xD5, 0x06, 0x60, 0xD0, 0x0C, 0x34, 0x78,
+    0x4B, 0xB4, 0xE2, 0x51, 0x90, 0xCD, 0x33, 0xD6, 0x89, 0xC1, 0xA1, 0x17, 0x7D, 0x5E, 0xFC, 0x2E,
+    0x4F, 0x2E, 0x81, 0xC3, 0x35, 0xB0, 0xBF, 0x08, 0xF6, 0x57, 0xC1, 0xFE, 0x32, 0x38, 0x5C, 0x07,
+    0xE7, 0x17, 0xC2, 0xF1, 0xC1, 0x28, 0xF5, 0x38, 0xF7, 0x5E, 0x17, 0xB7, 0x13, 0xB9, 0xF2, 0x54,
+    0x18, 0x19, 0x7A, 0x44, 0xCB, 0x51, 0x0A, 0x65, 0xCF, 0x94, 0x56, 0x41, 0xBC, 0xAC, 0x21, 0xB7,
+    0x98, 0x5B, 0xE8, 0xAC, 0x7D, 0xB9, 0xC5, 0x51, 0x5E, 0x5B, 0x27, 0x70, 0x46, 0xDB, 0x88, 0xD4,
+    0x1D, 0xE1, 0xFF, 0x21, 0xDC, 0x1E, 0x22, 0xB4, 0xF6, 0x33, 0x9D, 0x4F, 0x20, 0x5A, 0x3B, 0xC7,
+    0x41, 0xD7, 0x68, 0x89, 0x03, 0x29, 0xBC, 0x6D, 0x30, 0x19, 0x2F, 0xE4, 0xF9, 0x03, 0xC5, 0x55,
+    0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0xDB, 0xBA, 0xB3, 0x82, 0x0B, 0xA7, 0x49, 0x01, 0x8D, 0x9B,
+    0x34, 0xD0, 0xB8, 0xA5, 0x41, 0x6B, 0xF1, 0x0B, 0x52, 0xE4, 0x2A, 0x1A, 0xCA, 0x88, 0x86, 0xFC,
+    0x02, 0xEC, 0x3E, 0x4D, 0x44, 0xC3, 0x1F, 0xA0, 0x80, 0x48, 0xE8, 0x5A, 0x0A, 0xA4, 0x5D, 0x89,
+    0x82, 0x82, 0x22, 0xFE, 0x07, 0x18, 0x89, 0x8A, 0x06, 0x83, 0x8C, 0x74, 0x09, 0xF6, 0x0E, 0x6F,
+    0xC6, 0x77, 0x5C, 0x2E, 0x44, 0x14, 0x88, 0x8F, 0x95, 0xFC, 0xB1, 0xEB, 0xD9, 0xB7, 0x33, 0xEF,
+    0xCD, 0x8C, 0x89, 0x5E, 0x10, 0x51, 0xD2, 0xE3, 0x66, 0x71, 0x4B, 0xBE, 0x2D, 0xF0, 0x12, 0xB7,
+    0x94, 0xB6, 0x89, 0xA3, 0xEB, 0xB4, 0x45, 0xE3, 0x98, 0x14, 0xF8, 0xC6, 0x0E, 0xDF, 0xB8, 0xA0,
+    0x90, 0xC5, 0x3C, 0x6F, 0x71, 0xE3, 0x8A, 0x28, 0x1A, 0xF0, 0x92, 0xC9, 0xCC, 0xBA, 0x9B, 0x98,
+    0xA5, 0x4C, 0xE9, 0x67, 0x98, 0x98, 0x77, 0xDC, 0x05, 0x7E, 0x30, 0x35, 0x36, 0x32, 0x99, 0x3E,
+    0xEE, 0x89, 0xEB, 0xBC, 0x89, 0x99, 0xB8, 0xC8, 0xBB, 0x08, 0x33, 0x97, 0xB5, 0x91, 0x27, 0x5B,
+    0x65, 0x1D, 0x30, 0x4A, 0x97, 0xB6, 0x8F, 0x99, 0xCA, 0x4F, 0xA7, 0x8B, 0x90, 0xBD, 0xA9, 0x63,
+    0x7E, 0x0F, 0x20, 0xC1, 0x9E, 0xE0, 0x4A, 0x99, 0x43, 0xE6, 0x1A, 0x57, 0x63, 0x80, 0x9D, 0xB1,
+    0x18, 0x15, 0x94, 0xF6, 0xF0, 0xA6, 0xA0, 0x00, 0x7E, 0x98, 0x16, 0x1E, 0xCA, 0x58, 0x90, 0x3E,
+    0xD8, 0x4D, 0xCA, 0xAF, 0xB3, 0x7B, 0x7E, 0x9F, 0x62, 0x2F, 0xAE, 0x11, 0x95, 0x8D, 0xD8, 0x8F,
+    0x56, 0x98, 0x8E, 0xB6, 0x82, 0xCC, 0x6B, 0x08, 0xCA, 0x3B, 0x8A, 0x98, 0xF4, 0x32, 0x0D, 0xC9,
+    0x52, 0x3C, 0x8C, 0x53, 0x5B, 0xAF, 0x21, 0xB0, 0x04, 0x88, 0x98, 0xCF, 0x40, 0x48, 0xB5, 0x72,
+    0xCA, 0xF0, 0x10, 0x2B, 0xF2, 0x26, 0x5B, 0xF3, 0x15, 0x5B, 0xB7, 0xF8, 0x23, 0xBC, 0x85, 0xE1,
+    0x74, 0x7E, 0x7E, 0x3C, 0xBA, 0x14, 0x0D, 0x40, 0x4F, 0x5B, 0xAC, 0x95, 0xA7, 0xC2, 0x96, 0xB7,
+    0x60, 0xAB, 0x06, 0x5B, 0x83, 0xB0, 0xD5, 0xFC, 0x2E, 0x5B, 0x3A, 0xB2, 0xE6, 0x36, 0xFC, 0x3E,
+    0x72, 0x24, 0x47, 0xA6, 0x6F, 0xE0, 0xCA, 0x61, 0xE6, 0x68, 0x73, 0x30, 0xB7, 0x94, 0x33, 0x23,
+    0x7A, 0x51, 0x52, 0x5C, 0xCE, 0x40, 0x89, 0x50, 0xAA, 0x64, 0x48, 0xD8, 0xFA, 0x22, 0x14, 0x2A,
+    0x01, 0x12, 0xBD, 0xDA, 0xA5, 0xB0, 0x13, 0xCE, 0x84, 0xB0, 0x2B, 0xEC, 0x1E, 0xF2, 0xB1, 0x02,
+    0x47, 0xE0, 0x86, 0x82, 0x97, 0x61, 0xC0, 0xAF, 0x1B, 0xD0, 0xFD, 0xC8, 0xF4, 0x29, 0x62, 0xA1,
+    0xED, 0x95, 0x03, 0x07, 0x42, 0x54, 0xC2, 0x6D, 0x38, 0x5F, 0x50, 0x28, 0xAC, 0x82, 0x63, 0x47,
+    0x39, 0x68, 0x86, 0x0E, 0x3D, 0x4E, 0xD0, 0x1C, 0x33, 0x35, 0x12, 0xEC, 0x38, 0xF6, 0x88, 0x75,
+    0x20, 0xEB, 0x29, 0x3D, 0x23, 0xDA, 0xC3, 0xEE, 0x60, 0x36, 0x2B, 0xA8, 0x44, 0x78, 0x89, 0xF8,
+    0xFF, 0xE0, 0xE4, 0xE9, 0x7F, 0x09, 0x6F, 0x7A, 0x72, 0x82, 0x67, 0x8D, 0xC3, 0x76, 0x66, 0xFB,
+    0xCB, 0x93, 0xA7, 0x95, 0xD4, 0x93, 0x65, 0x88, 0x5E, 0x51, 0x5E, 0x43, 0x63, 0x82, 0xA2, 0x21,
+    0xF6, 0xE3, 0x70, 0xE3, 0xA4, 0x5E, 0x70, 0x04, 0x84, 0x0C, 0x78, 0x0B, 0x2A, 0x56, 0x39, 0x43,
+    0xF8, 0x86, 0x00, 0x3B, 0xEA, 0x07, 0x0F, 0xA9, 0xA3, 0x43, 0x2A, 0xE9, 0x15, 0x65, 0xE7, 0x03,
+    0x0E, 0x02, 0x39, 0xB9, 0xE8, 0xBB, 0xBD, 0x0E, 0x0F, 0xA7, 0xBA, 0x50, 0x62, 0x2C, 0xB1, 0x55,
+    0xDD, 0x46, 0x7E, 0xAA, 0xC7, 0x12, 0x87, 0x7A, 0x7D, 0xF5, 0x62, 0xF5, 0xF3, 0xA2, 0x06, 0x8B,
+    0xD0, 0x02, 0xEB, 0x0B, 0xC5, 0x94, 0xE2, 0x08, 0x0A, 0x8A, 0xDA, 0xA0, 0xF6, 0x61, 0x6B, 0x78,
+    0x11, 0x61, 0x21, 0xFF, 0xF0, 0x67, 0x84, 0x43, 0xD1, 0x89, 0x66, 0x4E, 0x85, 0xB9, 0x78, 0xBC,
+    0xD2, 0x7C, 0xD9, 0xA7, 0xF5, 0xA2, 0xBF, 0x62, 0x51, 0x44, 0x11, 0x49, 0xA7, 0xA8, 0x46, 0xC1,
+    0x54, 0x4D, 0x28, 0x86, 0x05, 0x5A, 0x18, 0x25, 0x78, 0x46, 0x9D, 0x04, 0xFD, 0x0C, 0x01, 0x0B,
+    0xA8, 0x57, 0xFF, 0x83, 0x01, 0x00, 0x09, 0x03, 0x29, 0x5E, 0x2C, 0x23, 0x0A, 0xB9, 0xB5, 0x7C,
+    0xCD, 0x36, 0x08, 0xC7, 0x38, 0xA8, 0x65, 0x2B, 0xC4, 0xC2, 0xA4, 0x65, 0x87, 0x0A, 0xEB, 0x77,
+    0xCB, 0x4F, 0x47, 0xDC, 0xD9, 0x01, 0xAE, 0xA5, 0x2E, 0x68, 0xE9, 0x8E, 0x1C, 0x60, 0xF7, 0x63,
+    0x14, 0x68, 0xB3, 0x64, 0x25, 0xD0, 0xB4, 0x59, 0xF2, 0x2E, 0xFD, 0x23, 0x69, 0x36, 0x33, 0xF2,
+    0xAF, 0x4B, 0x46, 0x07, 0x09, 0xBF, 0xE5, 0x2F, 0xF3, 0x05, 0xA2, 0x40, 0x7F, 0x70, 0x79, 0x93,
+    0xA2, 0x7B, 0xC0, 0x27, 0xAE, 0x4C, 0x9D, 0xB5, 0x4F, 0xFC, 0x39, 0x0F, 0xD6, 0x43, 0x87, 0x3D,
+    0x55, 0x21, 0x1A, 0x9B, 0x6A, 0x5B, 0x6E, 0x36, 0xD5, 0x15, 0xFC, 0xA5, 0x8E, 0x58, 0x8E, 0x1D,
+    0x31, 0x59, 0x76, 0x44, 0x76, 0x17, 0x3B, 0x62, 0xB0, 0xAC, 0xB1, 0x6C, 0x74, 0x51, 0xAB, 0x6C,
+    0x09, 0x81, 0xAA, 0x13, 0x7B, 0x59, 0xFA, 0x25, 0x84, 0x4C, 0x45, 0x46, 0x40, 0x88, 0x53, 0xA1,
+    0x34, 0x61, 0xF6, 0x0A, 0x81, 0x21, 0x8D, 0x18, 0x95, 0xA5, 0x7B, 0x88, 0x7C, 0x29, 0xAA, 0x42,
+    0x52, 0xD5, 0x33, 0xD4, 0x0A, 0x97, 0x90, 0x6A, 0xB5, 0xDD, 0x29, 0x7E, 0x50, 0x0E, 0xA5, 0x91,
+    0x00, 0xC0, 0x90, 0x7C, 0xA5, 0x0C, 0xBA, 0xD6, 0x70, 0x15, 0xAA, 0xA7, 0x1B, 0xDA, 0x1C, 0x50,
+    0x70, 0x1F, 0x19, 0x80, 0xAC, 0xB6, 0x1C, 0x70, 0x8F, 0x3C, 0xB8, 0x01, 0xA9, 0x06, 0xF9, 0x37,
+    0xA2, 0x5E, 0xB1, 0xA1, 0x97, 0xD4, 0xB6, 0x15, 0x58, 0xC5, 0x13, 0xF5, 0xCB, 0x38, 0x54, 0x9E,
+    0xA6, 0x41, 0x7E, 0xA0, 0x92, 0x91, 0xEB, 0x25, 0xD2, 0x66, 0x17, 0x1B, 0x50, 0xD0, 0x5C, 0x25,
+    0xDC, 0xC9, 0x06, 0x0F, 0xEE, 0x23, 0x5F, 0xE0, 0x07, 0x30, 0xD1, 0xFC, 0x25, 0x81, 0xA3, 0xED,
+    0x44, 0x7E, 0x3D, 0x77, 0x95, 0x14, 0xC9, 0x04, 0xC3, 0x9A, 0x39, 0x12, 0x61, 0xF8, 0x9C, 0xFE,
+    0xDD, 0xF8, 0x0E, 0xC5, 0x55, 0x3B, 0x8E, 0xDC, 0x46, 0x10, 0x2D, 0x92, 0xBB, 0x4B, 0x63, 0x69,
+    0xA0, 0x95, 0x28, 0x90, 0x14, 0xF0, 0x04, 0x06, 0x1D, 0x2A, 0xB0, 0xD1, 0x3C, 0xC2, 0xDC, 0x60,
+    0x93, 0x0D, 0x7C, 0x08, 0x41, 0x1C, 0x40, 0x81, 0x02, 0x27, 0x7B, 0x13, 0x27, 0x0E, 0x0D, 0x35,
+    0xAD, 0xCD, 0xE4, 0x84, 0x47, 0x20, 0x74, 0x81, 0x69, 0xCB, 0x04, 0x44, 0x58, 0x4D, 0x96, 0xDE,
+    0x2B, 0x8E, 0x06, 0x2B, 0x5B, 0x86, 0x2C, 0xC0, 0x80, 0x89, 0x99, 0x9E, 0x19, 0x16, 0xBB, 0xAB,
+    0xDE, 0xA7, 0x6A, 0x44, 0x24, 0xFB, 0x59, 0x70, 0x75, 0x03, 0x96, 0x5A, 0xB1, 0x94, 0xEF, 0x92,
+    0x48, 0xBE, 0xBA, 0x51, 0x44, 0xDB, 0xA7, 0x22, 0x17, 0xFB, 0x6C, 0x2F, 0x77, 0x2F, 0xD5, 0x49,
+    0xA4, 0x51, 0xB5, 0xAF, 0x0C, 0x69, 0x8F, 0xC5, 0x61, 0x97, 0x64, 0xF6, 0xBB, 0x41, 0x5C, 0x0A,
+    0xC6, 0xC5, 0xC7, 0xD3, 0xD7, 0x0E, 0x07, 0x4A, 0xB5, 0xC8, 0x27, 0x36, 0xD4, 0xDC, 0x90, 0x6B,
+    0xFB, 0x99, 0x0D, 0xF3, 0xF1, 0xA9, 0x7C, 0xCF, 0xA7, 0xBA, 0x2B, 0x84, 0x2A, 0xE5, 0xAE, 0xA0,
+    0xA8, 0xBE, 0x54, 0x6E, 0xBD, 0xD8, 0xDD, 0x2D, 0x35, 0x4B, 0xB6, 0xDB, 0x8A, 0x64, 0x74, 0x5D,
+    0xB1, 0x04, 0x87, 0xD3, 0x42, 0x8E, 0x9C, 0x5E, 0xBE, 0xFB, 0x08, 0xD9, 0xF9, 0x0D, 0xD3, 0x32,
+    0xA3, 0xE7, 0xB1, 0x97, 0x6A, 0xA4, 0x70, 0x63, 0x99, 0x2C, 0xF7, 0xE9, 0x34, 0x7F, 0x8A, 0x54,
+    0x8C, 0x14, 0xEB, 0x67, 0x22, 0x5C, 0x02, 0x41, 0x78, 0x80, 0x6A, 0x19, 0x9E, 0x6B, 0xC0, 0xE9,
+    0x34, 0x91, 0xF5, 0x44, 0xC8, 0x44, 0xF7, 0x90, 0x05, 0x88, 0x53, 0x75, 0xF8, 0x19, 0x74, 0xEE,
+    0x74, 0xC8, 0xC0, 0x31, 0x4B, 0xF2, 0x23, 0xB9, 0xCA, 0xB4, 0x25, 0xBB, 0x55, 0x32, 0xB6, 0x7C,
+    0x6C, 0x98, 0x48, 0x5F, 0x9A, 0x6E, 0xAB, 0x71, 0x57, 0xBF, 0xB5, 0x8C, 0x41, 0x47, 0x23, 0x52,
+    0xB7, 0x03, 0xED, 0x5E, 0x77, 0x58, 0x0C, 0xC5, 0x55, 0x32, 0xFA, 0x9B, 0x64, 0x7C, 0xFB, 0xD9,
+    0x4A, 0xEF, 0x70, 0x6C, 0xB9, 0x88, 0x69, 0x1B, 0xF9, 0x51, 0xEA, 0x9C, 0x6D, 0x55, 0x64, 0x9A,
+    0x70, 0x10, 0x2A, 0xE9, 0x8D, 0xA5, 0x7B, 0x5C, 0x36, 0x9A, 0x9B, 0xD1, 0x3E, 0xBA, 0x2D, 0x60,
+    0x49, 0xA4, 0x9C, 0xEC, 0xC3, 0x9B, 0x69, 0x8A, 0xD9, 0x7E, 0x5C, 0x6E, 0xF4, 0x52, 0xAA, 0xC4,
+    0xDA, 0x5A, 0xF8, 0xA7, 0xB7, 0x44, 0xA6, 0x6A, 0x91, 0xE8, 0x04, 0x56, 0xBD, 0xBF, 0x16, 0xFF,
+    0xAB, 0xF6, 0xEE, 0x8D, 0xCE, 0xC5, 0xDB, 0x3F, 0x35, 0x5B, 0x47, 0xBF, 0x0F, 0xA3, 0x1B, 0x7D,
+    0xAC, 0xA2, 0x9B, 0xCA, 0xA9, 0x4C, 0xD5, 0x94, 0x6B, 0x88, 0xE6, 0x3C, 0x7F, 0x18, 0xA5, 0xFE,
+    0x63, 0x81, 0x38, 0xDD, 0x90, 0xAF, 0xD5, 0x0A, 0xBF, 0xEA, 0xEA, 0x07, 0xA7, 0x57, 0xD1, 0xB4,
+    0xC8, 0x44, 0xCE, 0x88, 0x74, 0x38, 0xD6, 0x61, 0xC2, 0xB2, 0xEA, 0x76, 0x7B, 0x9F, 0xB3, 0xA8,
+    0x6B, 0xB9, 0xCC, 0x75, 0xAC, 0x92, 0xAE, 0x85, 0xBE, 0x0A, 0x83, 0xCE, 0xF9, 0xE2, 0x0F, 0xAD,
+    0xFF, 0x2D, 0x4A, 0xB1, 0x50, 0xA1, 0x17, 0x34, 0x19, 0x7B, 0x01, 0xF5, 0xB9, 0x77, 0x13, 0xEA,
+    0x04, 0xB2, 0xFA, 0xCD, 0xC2, 0x16, 0x89, 0x8F, 0xFD, 0xA0, 0x87, 0xDB, 0x54, 0xEA, 0xD4, 0xF5,
+    0x7E, 0xAD, 0x66, 0x31, 0x0F, 0xB7, 0x27, 0x43, 0x95, 0x72, 0x4C, 0x67, 0x3E, 0xAF, 0x18, 0x35,
+    0x7B, 0x85, 0x1B, 0xCB, 0x7C, 0xF7, 0x72, 0x4C, 0xD0, 0x50, 0xA8, 0xDA, 0xAC, 0x40, 0x7E, 0x6C,
+    0x97, 0x29, 0x6D, 0x1D, 0x51, 0x6C, 0x32, 0x8B, 0x09, 0x75, 0x6C, 0x0D, 0x97, 0x3E, 0x2C, 0xF4,
+    0xD3, 0xD6, 0x7A, 0xF0, 0xC1, 0x03, 0x2E, 0x9E, 0x4B, 0xC7, 0x3E, 0x5A, 0x25, 0x0C, 0x17, 0x4B,
+    0xA9, 0xAA, 0x09, 0x8D, 0xAB, 0xB3, 0xC7, 0x12, 0x2D, 0xED, 0x37, 0xC0, 0x21, 0xCD, 0x9A, 0x53,
+    0xE2, 0x9B, 0xDC, 0xEC, 0x27, 0xF7, 0x51, 0x69, 0xDF, 0xD8, 0x0B, 0x8A, 0x90, 0x4A, 0x6D, 0x21,
+    0x0F, 0xEC, 0x0F, 0x37, 0x17, 0xE4, 0x9B, 0xDE, 0x06, 0x5A, 0x37, 0x89, 0x8B, 0x34, 0x3B, 0x84,
+    0x84, 0xB1, 0x61, 0x7D, 0x38, 0x21, 0xDC, 0x4A, 0x38, 0xB4, 0x40, 0xA3, 0x0B, 0x53, 0x9F, 0xFF,
+    0x7F, 0xD8, 0x36, 0xF9, 0x8F, 0xCD, 0x47, 0x51, 0x3A, 0x2E, 0x41, 0x8E, 0x56, 0x30, 0xA3, 0x5E,
+    0xF0, 0x56, 0xB6, 0x83, 0x2F, 0x41, 0x01, 0x5E, 0x06, 0xCB, 0x90, 0xFD, 0x15, 0xD6, 0xC6, 0x45,
+    0x8B, 0xE3, 0xFE, 0xC6, 0xC5, 0xB7, 0xD5, 0x3A, 0x39, 0x8D, 0x4E, 0x07, 0x22, 0xD8, 0xD1, 0x01,
+    0xD5, 0x48, 0x6A, 0xAA, 0x48, 0xF7, 0xD5, 0x7B, 0x79, 0x7A, 0x92, 0xDB, 0x4C, 0x27, 0x36, 0x97,
+    0x30, 0x87, 0x54, 0x7F, 0x4F, 0x64, 0xA6, 0x01, 0xC1, 0xFA, 0x2C, 0x92, 0x9A, 0xEF, 0x09, 0xB7,
+    0xE8, 0xFF, 0x61, 0x1E, 0x1A, 0x3B, 0x40, 0xFC, 0x81, 0x99, 0x6D, 0x34, 0xD6, 0xF3, 0xDD, 0x01,
+    0xFA, 0x80, 0x1B, 0x8A, 0xB8, 0x31, 0x84, 0x8A, 0x30, 0xCA, 0x49, 0x11, 0xA6, 0x8D, 0x52, 0x54,
+    0x70, 0x84, 0x76, 0xA6, 0x24, 0xF7, 0x65, 0xD7, 0x68, 0xF5, 0x5A, 0x93, 0xFF, 0x51, 0xE3, 0x22,
+    0xE1, 0x79, 0x2C, 0x50, 0x89, 0x9B, 0x7E, 0x91, 0xEE, 0x76, 0xC8, 0x35, 0xB3, 0xE6, 0x04, 0x7C,
+    0xF6, 0x26, 0xA7, 0x59, 0x63, 0xFF, 0x09, 0xD6, 0xAE, 0x1C, 0x61, 0xA0, 0x84, 0xE3, 0x0D, 0x5C,
+    0x91, 0xA0, 0x5C, 0xBF, 0x16, 0xF0, 0x80, 0xD1, 0xD9, 0x53, 0x7A, 0xD3, 0x77, 0x77, 0x72, 0x76,
+    0xA5, 0x36, 0xBD, 0x78, 0xD3, 0xD0, 0x6C, 0x83, 0xDF, 0x70, 0x18, 0x44, 0x80, 0x79, 0xC2, 0x5A,
+    0xBB, 0x3D, 0x46, 0x1C, 0xEE, 0x84, 0x01, 0xB9, 0x7D, 0x44, 0xDF, 0x22, 0x72, 0x6F, 0x73, 0xC6,
+    0x06, 0x10, 0xC7, 0x5F, 0x6F, 0x0E, 0x40, 0xA4, 0xEE, 0x0D, 0x1F, 0x22, 0x8F, 0x26, 0xB3, 0x00,
+    0xF2, 0xB0, 0x93, 0x8F, 0xF0, 0x38, 0x6E, 0xE0, 0x62, 0xEA, 0x4A, 0xF5, 0x08, 0x07, 0x67, 0xA0,
+    0x76, 0x8E, 0x72, 0x48, 0x0B, 0x01, 0x51, 0xFA, 0x0F, 0x55, 0xAA, 0x63, 0x78, 0xA6, 0x6E, 0x42,
+    0x3B, 0x17, 0x73, 0x1D, 0xCF, 0x3E, 0x0A, 0x53, 0x60, 0x5A, 0x1A, 0x0A, 0x13, 0x18, 0x4B, 0x39,
+    0xFF, 0xD7, 0x1D, 0xFB, 0x15, 0xFF, 0x98, 0x5E, 0x70, 0xB1, 0x7F, 0x2B, 0xE0, 0xAD, 0x17, 0x3E,
+    0x96, 0xB8, 0x1F, 0xBB, 0xDC, 0x4F, 0x60, 0xEF, 0xEC, 0xCB, 0x5C, 0xFD, 0x1F, 0x5E, 0xEF, 0x01,
+    0xD5, 0x55, 0xB1, 0x8E, 0xE4, 0x44, 0x10, 0x2D, 0xDB, 0xBA, 0xB5, 0xB4, 0x3E, 0xA9, 0x13, 0x08,
+    0xB8, 0xC4, 0x39, 0x49, 0xF3, 0x03, 0xD0, 0x46, 0xF7, 0x01, 0x6C, 0xC0, 0x20, 0x11, 0x91, 0x90,
+    0x90, 0xF1, 0x07, 0x36, 0x10, 0x12, 0x70, 0x9F, 0x40, 0x40, 0xC2, 0x12, 0x5C, 0x4A, 0xC2, 0xB5,
+    0xEF, 0x26, 0x40, 0x22, 0xB2, 0xE0, 0x03, 0xB0, 0x90, 0x88, 0x08, 0xB6, 0x03, 0x23, 0x2C, 0xB6,
+    0xDD, 0xC5, 0x7B, 0xED, 0x59, 0x98, 0x5B, 0xC4, 0x07, 0xD0, 0x1A, 0xB9, 0xC7, 0xE3, 0xE7, 0xEA,
+    0xAA, 0xF7, 0x5E, 0xD5, 0x48, 0x71, 0x25, 0x56, 0xF1, 0x19, 0x1B, 0x0D, 0xD2, 0xAC, 0x52, 0x25,
+    0x11, 0xED, 0xA4, 0x1F, 0xC5, 0x06, 0x31, 0x6B, 0x57, 0xA5, 0xA5, 0xD0, 0x4D, 0xFC, 0x2A, 0x2E,
+    0x88, 0xC7, 0xF7, 0x28, 0x6F, 0xA9, 0x88, 0x1F, 0xC5, 0xCD, 0x62, 0x16, 0xA9, 0xA3, 0x94, 0xFA,
+    0x50, 0xFC, 0x4D, 0xE7, 0x74, 0x34, 0x3A, 0x15, 0x3A, 0xC8, 0x03, 0x79, 0x69, 0x7D, 0xBC, 0x6F,
+    0xDF, 0xE5, 0x2B, 0x9F, 0x63, 0x95, 0x3A, 0x71, 0xAB, 0xF6, 0xAD, 0x4C, 0x5D, 0x7E, 0xF8, 0xA1,
+    0xFC, 0x6B, 0x55, 0x48, 0xCB, 0x69, 0x28, 0x91, 0x43, 0x8B, 0xB3, 0x71, 0x48, 0xA9, 0x2B, 0x52,
+    0x5C, 0xC4, 0x04, 0x91, 0x3E, 0x49, 0x85, 0x3B, 0xA4, 0x5F, 0x6C, 0x22, 0x06, 0x4F, 0x7C, 0x87,
+    0x57, 0x54, 0xDC, 0x28, 0x92, 0x74, 0xCA, 0x98, 0x0F, 0x62, 0xC6, 0x1C, 0xF5, 0x6D, 0x62, 0x42,
+    0x1F, 0x3C, 0xC2, 0x46, 0x13, 0x81, 0x29, 0x52, 0xA9, 0x5F, 0x00, 0xE3, 0x3B, 0xF7, 0x07, 0x31,
+    0x60, 0x21, 0x63, 0x04, 0x21, 0x18, 0x19, 0x81, 0x05, 0x91, 0x6B, 0x9D, 0x89, 0x11, 0x9E, 0x0C,
+    0x26, 0xDA, 0x0D, 0x65, 0xE8, 0x50, 0x01, 0xA3, 0x28, 0x00, 0x5C, 0x71, 0x3D, 0xB8, 0x57, 0x72,
+    0x85, 0xB8, 0x62, 0x27, 0x96, 0x8C, 0x2F, 0xA0, 0x2A, 0x87, 0x90, 0x8A, 0x5F, 0xEA, 0xF3, 0x12,
+    0x5F, 0x93, 0x47, 0x9D, 0x4D, 0xB5, 0x3E, 0xD6, 0xD5, 0xEB, 0xA5, 0xFF, 0x0D, 0x65, 0xFA, 0x67,
+    0x36, 0x54, 0x3A, 0xF7, 0x60, 0xB4, 0x4C, 0xD2, 0x07, 0xB3, 0x94, 0x3A, 0xB8, 0xD1, 0x44, 0xC4,
+    0x72, 0x73, 0xB3, 0x16, 0xDA, 0xB9, 0xA9, 0xE6, 0x9D, 0x0D, 0x75, 0x7C, 0x43, 0x07, 0x7B, 0xFB,
+    0xD3, 0x86, 0x64, 0x5A, 0x10, 0xB5, 0xF8, 0xA1, 0x4E, 0x64, 0x1A, 0x87, 0x39, 0xCD, 0x6C, 0x58,
+    0xEA, 0xA2, 0x63, 0x85, 0xC8, 0x16, 0xFC, 0x1B, 0x08, 0x8C, 0x9C, 0x58, 0x95, 0x1B, 0x20, 0x45,
+    0x94, 0x76, 0x62, 0x29, 0x43, 0xB3, 0xF0, 0x95, 0x50, 0x45, 0xE4, 0x7B, 0xB3, 0x65, 0xCC, 0xEF,
+    0x3A, 0x12, 0x13, 0xDD, 0x92, 0x31, 0xB5, 0x36, 0x28, 0xCB, 0x8D, 0x7A, 0x04, 0xA6, 0x9D, 0xED,
+    0x0A, 0x4C, 0xB3, 0x54, 0xDA, 0x13, 0x23, 0x9E, 0x72, 0x2A, 0xE2, 0x13, 0x33, 0x30, 0x30, 0x23,
+    0x43, 0x24, 0x60, 0xF0, 0xEB, 0x20, 0x8D, 0x0E, 0x05, 0x30, 0xAD, 0x66, 0x3B, 0x19, 0x90, 0x0D,
+    0xFF, 0xE4, 0x75, 0x25, 0xA7, 0x94, 0xC9, 0xDC, 0xE9, 0x37, 0xDD, 0x37, 0xBB, 0xF3, 0x6B, 0xE6,
+    0xBC, 0xD5, 0x21, 0x6F, 0xCD, 0xBE, 0x15, 0x4F, 0x4E, 0xC6, 0xF9, 0x08, 0xC2, 0xB4, 0x9B, 0xD1,
+    0x5F, 0x34, 0xBE, 0xAE, 0x4F, 0x61, 0x98, 0xB4, 0x7A, 0xB0, 0xF7, 0x09, 0xF8, 0x8A, 0xE4, 0x6B,
+    0x74, 0x53, 0x93, 0x10, 0xD1, 0x81, 0x2F, 0x01, 0x5F, 0x73, 0x8D, 0xFA, 0xBA, 0x96, 0x77, 0x7E,
+    0x6C, 0xC3, 0x31, 0xC1, 0xC2, 0xEF, 0xA0, 0x90, 0xD8, 0xC3, 0x03, 0x3F, 0x26, 0x69, 0xD7, 0x93,
+    0xA4, 0x4C, 0xC9, 0xD0, 0xA5, 0x8E, 0xC6, 0x4D, 0x77, 0xC2, 0xB6, 0xF8, 0xBD, 0xA0, 0x94, 0x17,
+    0x72, 0x97, 0xC8, 0xB7, 0xDC, 0xE3, 0x9E, 0xB5, 0x7D, 0x9E, 0x72, 0x25, 0x5B, 0xDE, 0xA4, 0xDF,
+    0xF6, 0xDC, 0xB7, 0xF3, 0x56, 0x78, 0x69, 0x19, 0x38, 0x4D, 0xD9, 0x85, 0x8B, 0xF4, 0x9A, 0xFD,
+    0xD7, 0x40, 0x1E, 0xF6, 0x07, 0x6D, 0x0A, 0xBE, 0x58, 0xBE, 0x57, 0xA9, 0xB3, 0x44, 0x73, 0x99,
+    0xED, 0x9E, 0x0F, 0xAB, 0x6E, 0x61, 0x06, 0xDA, 0x14, 0x36, 0x21, 0xC6, 0x6C, 0x19, 0xF3, 0x5C,
+    0x5F, 0x50, 0xC6, 0xE0, 0x02, 0x65, 0x5C, 0x9B, 0x04, 0x0C, 0xDE, 0xD2, 0x9F, 0x89, 0x81, 0x0D,
+    0x88, 0xC9, 0x8E, 0x60, 0x64, 0x4F, 0xCC, 0x02, 0x5D, 0x06, 0x62, 0xE0, 0x3C, 0xB8, 0x62, 0x96,
+    0x1E, 0xED, 0xAD, 0x49, 0x4C, 0xA4, 0x89, 0xBA, 0xE2, 0x24, 0xC7, 0x2B, 0xBB, 0x52, 0x65, 0x27,
+    0x56, 0x7A, 0x91, 0x67, 0x14, 0x24, 0xF6, 0xEC, 0xD4, 0x85, 0x9E, 0x02, 0x2F, 0x0D, 0xB9, 0x33,
+    0xC3, 0x59, 0x75, 0x17, 0xDD, 0xC5, 0x93, 0x06, 0x62, 0x4C, 0x9A, 0xAC, 0xBE, 0x78, 0xFA, 0x27,
+    0x3D, 0x79, 0xF3, 0x39, 0xD2, 0x5F, 0x5B, 0xF8, 0x7C, 0xF4, 0x43, 0x1B, 0x2B, 0x0C, 0x99, 0xD9,
+    0xE0, 0x0E, 0xFD, 0x64, 0x56, 0xBA, 0x7E, 0x32, 0x18, 0x37, 0xB8, 0x6B, 0xE0, 0xF3, 0x87, 0x70,
+    0x7D, 0x5A, 0x50, 0xA8, 0x7E, 0x0F, 0xC1, 0x36, 0x3B, 0xEF, 0x73, 0xE4, 0x4A, 0x8A, 0x2F, 0xF7,
+    0xA9, 0xB2, 0xD3, 0x9C, 0x9D, 0x62, 0xC2, 0x3F, 0x26, 0x2A, 0xB6, 0x33, 0x27, 0xF5, 0xDD, 0xFB,
+    0x68, 0x35, 0xF7, 0x29, 0x1A, 0x6B, 0xB1, 0x9F, 0xB1, 0xDB, 0x0A, 0xF9, 0x26, 0x79, 0x30, 0x9F,
+    0x1B, 0x0E, 0x84, 0x24, 0xDA, 0xD1, 0x24, 0x9C, 0x8E, 0x4A, 0x38, 0x07, 0x73, 0xDB, 0xE1, 0xFD,
+    0x31, 0x3F, 0x9E, 0x0D, 0x2A, 0x6B, 0x17, 0xA4, 0x2A, 0x4C, 0x8A, 0x35, 0x8B, 0x3F, 0x0A, 0xFD,
+    0x74, 0x0B, 0xA1, 0x26, 0x1A, 0x9F, 0x05, 0x2D, 0xA4, 0xA0, 0x9F, 0xE5, 0xFF, 0xD6, 0x85, 0x3B,
+    0x5B, 0x17, 0x3B, 0x5D, 0x55, 0xF0, 0x43, 0x9E, 0xD4, 0x9A, 0x59, 0xF5, 0xFB, 0x66, 0xF6, 0xF9,
+    0x2D, 0x87, 0xBB, 0xBE, 0x2B, 0xC9, 0x26, 0x65, 0xFD, 0x81, 0x93, 0x2B, 0xB7, 0x1D, 0x69, 0xCC,
+    0xAA, 0xC2, 0x91, 0x2B, 0xBB, 0xAE, 0x53, 0xB4, 0x18, 0x44, 0x55, 0xCE, 0xAD, 0x19, 0x0C, 0x6D,
+    0x25, 0x85, 0x85, 0xA6, 0x94, 0x5D, 0x07, 0x28, 0xBE, 0xB0, 0x49, 0xD9, 0x65, 0xF3, 0x49, 0x3A,
+    0xFC, 0xC3, 0xBC, 0x09, 0x25, 0x1B, 0x18, 0x30, 0x9F, 0x4D, 0x53, 0xCA, 0xE5, 0x57, 0x79, 0xD2,
+    0x1E, 0x0E, 0x39, 0x13, 0xE2, 0xDB, 0x7C, 0xBD, 0xBC, 0xFE, 0xFA, 0x7E, 0x43, 0x1D, 0xD8, 0xB8,
+    0x96, 0x13, 0x1B, 0x15, 0x80, 0x6A, 0xC0, 0xD9, 0x4C, 0xE9, 0x3D, 0x76, 0x57, 0x90, 0x1E, 0xD9,
+    0xE0, 0x3F, 0x0C, 0x79, 0x76, 0xD2, 0xC6, 0x06, 0x41, 0x30, 0x3D, 0xD8, 0x54, 0x5B, 0x4B, 0xDE,
+    0x37, 0x4B, 0xD6, 0x36, 0x47, 0xBD, 0x23, 0xAF, 0x36, 0x5F, 0xDD, 0x9A, 0xAF, 0x0B, 0xAF, 0x3E,
+    0x38, 0x60, 0x74, 0xB2, 0x6C, 0x18, 0x8C, 0x1A, 0x9C, 0x80, 0x6C, 0x7F, 0xF5, 0xBC, 0x55, 0x72,
+    0x8F, 0xEB, 0x20, 0x99, 0xE5, 0xBF, 0xBB, 0xE6, 0xFA, 0x7A, 0x80, 0xB4, 0x19, 0x31, 0xCA, 0xAB,
+    0x87, 0x77, 0xCF, 0xF2, 0x7D, 0x84, 0x7C, 0x7B, 0xBC, 0x60, 0x95, 0x91, 0xFC, 0x42, 0xB2, 0x48,
+    0x4C, 0x84, 0xE7, 0xFC, 0xA8, 0x5D, 0x13, 0x61, 0x41, 0x7F, 0xC4, 0xC3, 0x15, 0x1C, 0xE9, 0x63,
+    0x8C, 0xA8, 0xE0, 0xE6, 0x2A, 0xD1, 0x82, 0xA3, 0x5D, 0x2C, 0x7A, 0x05, 0x81, 0x1B, 0x96, 0xCA,
+    0x36, 0xBE, 0xFF, 0x27, 0xFC, 0x1F, 0xEB, 0x2F, 0xCD, 0x95, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0x86,
+    0x8F, 0x3D, 0x49, 0x5C, 0x58, 0x68, 0x52, 0x10, 0x29, 0x04, 0x24, 0x37, 0x29, 0x50, 0x9A, 0x79,
+    0x01, 0xA4, 0xB1, 0xA0, 0x4C, 0x93, 0x66, 0x29, 0xA0, 0xA0, 0xA1, 0xA1, 0xDA, 0x47, 0xB0, 0x11,
+    0x2F, 0x90, 0x86, 0x9A, 0xED, 0xD3, 0x52, 0x02, 0x63, 0xB4, 0x2F, 0x60, 0x2A, 0x4A, 0xAC, 0x48,
+    0xA9, 0x71, 0x61, 0x09, 0xA3, 0x8C, 0xE7, 0xE4, 0xFF, 0x67, 0x76, 0x75, 0xEF, 0xF6, 0x29, 0x62,
+    0xDD, 0x7B, 0xAE, 0xAF, 0x67, 0x7C, 0xCE, 0x7F, 0xBE, 0xF9, 0xC7, 0x16, 0x29, 0x47, 0x3B, 0x1A,
+    0x44, 0x3B, 0x75, 0x8C, 0x29, 0xF1, 0x8A, 0xEE, 0x88, 0xB5, 0xCE, 0x1C, 0xBE, 0x27, 0xA7, 0xE3,
+    0xA2, 0x47, 0x70, 0x1C, 0xAD, 0x55, 0xB5, 0x17, 0x8B, 0x38, 0x8B, 0x4F, 0x5F, 0xEB, 0x2A, 0xF8,
+    0x0C, 0x7B, 0xAD, 0x93, 0xF8, 0x68, 0x30, 0xD4, 0xC5, 0x56, 0x45, 0xBA, 0xC3, 0x1E, 0xC8, 0x7A,
+    0x74, 0x91, 0xD1, 0x45, 0x5E, 0xF1, 0xB8, 0xBD, 0x8B, 0x8C, 0x2E, 0x47, 0xBF, 0xE7, 0xB8, 0x31,
+    0x86, 0xD5, 0x63, 0x8E, 0xCE, 0xEE, 0x10, 0xA3, 0x93, 0x55, 0x54, 0x80, 0x9A, 0x37, 0x81, 0x7F,
+    0x15, 0x15, 0x04, 0x71, 0xC4, 0xED, 0x59, 0xA0, 0x7C, 0x9C, 0x45, 0xBD, 0x90, 0x87, 0xE2, 0xE4,
+    0x23, 0x31, 0xB1, 0x99, 0x8B, 0x38, 0x45, 0x13, 0x75, 0xEA, 0xCF, 0x84, 0x3F, 0xC1, 0x9F, 0x01,
+    0x77, 0x3A, 0x65, 0xCA, 0xB0, 0xD5, 0x5A, 0xE9, 0x38, 0x4C, 0x36, 0xDA, 0x5D, 0xC2, 0xA4, 0x7D,
+    0x1B, 0xDD, 0x2A, 0xE1, 0x1A, 0x83, 0xBB, 0x5F, 0x44, 0xBF, 0x4A, 0xD2, 0xAD, 0x7E, 0x31, 0xC9,
+    0x28, 0x86, 0xDD, 0xE6, 0xB6, 0x4A, 0xF5, 0x80, 0x12, 0x36, 0x46, 0x01, 0xF7, 0xCF, 0x72, 0x4B,
+    0x35, 0xD7, 0x13, 0x0A, 0x46, 0x83, 0xD2, 0x46, 0x1B, 0x14, 0x6F, 0xF4, 0x39, 0x9A, 0x6F, 0x13,
+    0x9B, 0x37, 0x7B, 0xB3, 0x61, 0xD2, 0x95, 0xBC, 0x3C, 0xDD, 0xF1, 0xE8, 0x45, 0xE6, 0xCB, 0x4C,
+    0x2D, 0x13, 0xDF, 0x80, 0xB4, 0xFA, 0x73, 0x88, 0x6C, 0xB9, 0xD1, 0x91, 0xF4, 0x74, 0x2D, 0x24,
+    0x49, 0xB5, 0xD1, 0x9E, 0xEB, 0xA1, 0xF3, 0xB0, 0x12, 0x56, 0x41, 0x69, 0x73, 0x2D, 0x83, 0x3C,
+    0x98, 0xA2, 0x0B, 0x86, 0x97, 0xC2, 0x92, 0x03, 0x0E, 0xEB, 0x30, 0x81, 0xBA, 0x84, 0x4D, 0x0A,
+    0x49, 0x7C, 0x6A, 0xFD, 0xFF, 0x12, 0x39, 0x3D, 0xEA, 0x51, 0x2C, 0x49, 0xDD, 0xD2, 0x3C, 0xEF,
+    0xA9, 0x19, 0x7F, 0x85, 0xA8, 0xBF, 0x50, 0xC4, 0x5F, 0x23, 0x84, 0xE7, 0x68, 0xE1, 0xE8, 0x66,
+    0x31, 0x9B, 0xC7, 0x6D, 0xF3, 0x17, 0xE7, 0xED, 0x67, 0xB8, 0x0D, 0x73, 0x90, 0xAE, 0xE8, 0x5B,
+    0xED, 0x33, 0xDE, 0x26, 0x0A, 0x96, 0x90, 0x7C, 0xED, 0x46, 0x8A, 0x00, 0x3C, 0x79, 0xF8, 0x64,
+    0x24, 0xE1, 0xDE, 0x2F, 0x95, 0x0A, 0x11, 0x8B, 0x5F, 0xDB, 0x28, 0x64, 0x0C, 0x21, 0x68, 0x31,
+    0x43, 0xAE, 0xB2, 0xA4, 0x3B, 0x94, 0xB3, 0xE5, 0x14, 0x4D, 0xB6, 0xF9, 0x77, 0xE7, 0x6C, 0x25,
+    0x3C, 0xA7, 0x2F, 0xED, 0x5E, 0x0D, 0xBD, 0x4B, 0xD2, 0x1C, 0xF4, 0xF1, 0x81, 0xDB, 0xC5, 0xAC,
+    0x64, 0x10, 0x26, 0x59, 0x1B, 0x88, 0x42, 0x5D, 0x21, 0x4B, 0xCB, 0xB4, 0xA4, 0x09, 0xE6, 0x12,
+    0x96, 0x9C, 0x13, 0xB8, 0x70, 0x8E, 0xC5, 0xB0, 0x6C, 0x57, 0x75, 0xC2, 0xA2, 0xDF, 0x9D, 0x88,
+    0x09, 0xB5, 0xE6, 0xDD, 0x91, 0xAF, 0xFD, 0x96, 0x5D, 0xBE, 0x88, 0x87, 0xD5, 0x05, 0xBD, 0xB9,
+    0x09, 0x16, 0xBD, 0x3C, 0xE4, 0xBB, 0x45, 0xB2, 0x24, 0xDD, 0x6E, 0x34, 0x22, 0xDF, 0x25, 0x7F,
+    0x09, 0xF9, 0xD1, 0xAD, 0x1D, 0xBF, 0xE9, 0xE5, 0x07, 0x32, 0x9F, 0x9C, 0xF6, 0x58, 0x80, 0x6B,
+    0x0A, 0x48, 0x1A, 0xFE, 0x8E, 0x84, 0xB6, 0xDB, 0xB5, 0xC3, 0xA2, 0x4F, 0x7E, 0x82, 0x03, 0x8E,
+    0xFA, 0x40, 0x79, 0xB7, 0x76, 0x0B, 0xD9, 0xFD, 0x94, 0x50, 0xDB, 0xA4, 0x30, 0x03, 0x99, 0x45,
+    0xFB, 0x50, 0x38, 0x40, 0x1C, 0x10, 0x6A, 0x5F, 0x8D, 0x48, 0x97, 0xC4, 0xD5, 0xFA, 0xA5, 0xA6,
+    0x6F, 0x63, 0x93, 0xAB, 0xCF, 0xAD, 0x26, 0x07, 0x0D, 0x8D, 0xCE, 0x1D, 0x5A, 0xC7, 0x3E, 0xA9,
+    0xEE, 0xF0, 0xFC, 0x2C, 0xC7, 0xDF, 0xF3, 0x72, 0x53, 0xA1, 0x38, 0xF6, 0x2A, 0x4A, 0xB7, 0x96,
+    0xDD, 0x53, 0x9D, 0x59, 0xF6, 0xFE, 0x05, 0xC2, 0x03, 0x72, 0xC7, 0x46, 0xE2, 0x3A, 0x07, 0xFD,
+    0x17, 0x18, 0x2E, 0xF4, 0x47, 0x2C, 0x49, 0xA5, 0x3D, 0x6C, 0x09, 0x46, 0xE0, 0x6C, 0x4A, 0x4C,
+    0x24, 0x84, 0xBC, 0x61, 0x06, 0x43, 0xB8, 0x41, 0xDA, 0xF8, 0xA9, 0x66, 0xA3, 0xEF, 0x39, 0xE6,
+    0x5D, 0x4C, 0xA8, 0x6E, 0xA5, 0x38, 0xBF, 0x22, 0x19, 0xE2, 0xB0, 0xB0, 0x25, 0x9A, 0x78, 0x98,
+    0xB9, 0x7B, 0x02, 0xD8, 0x8E, 0x30, 0x97, 0xD1, 0xC5, 0x81, 0xA3, 0x46, 0x8F, 0x8E, 0x5C, 0xF6,
+    0x6B, 0x75, 0x4B, 0xF4, 0x0A, 0xE7, 0x40, 0x6D, 0xF0, 0x6D, 0xF9, 0x6C, 0xE1, 0x06, 0x61, 0x32,
+    0x0C, 0x7D, 0x7E, 0x6A, 0xE0, 0xFB, 0xEA, 0xCA, 0xA5, 0x36, 0x82, 0x49, 0x7C, 0x95, 0x86, 0x58,
+    0x1D, 0xBA, 0xD7, 0x69, 0x7B, 0x68, 0x60, 0x39, 0x6E, 0xA0, 0x26, 0x6F, 0x58, 0x48, 0x8B, 0x65,
+    0xF1, 0xBB, 0x8D, 0xD2, 0x8A, 0x73, 0x3C, 0x45, 0x61, 0xF3, 0x0D, 0xD3, 0x87, 0x4B, 0xA2, 0xD0,
+    0xB0, 0xEB, 0x29, 0xB6, 0xE5, 0x7C, 0x61, 0xEC, 0xB2, 0xF2, 0x50, 0x40, 0x30, 0x3C, 0xE8, 0x9F,
+    0x08, 0x71, 0x58, 0x7D, 0xAD, 0x13, 0x79, 0x48, 0xF7, 0x8F, 0x8E, 0x04, 0x22, 0x9E, 0x0F, 0x2D,
+    0xAA, 0xE2, 0x93, 0x86, 0x48, 0xE8, 0xF9, 0xCC, 0xA4, 0xA2, 0x3E, 0x97, 0xB7, 0x92, 0x14, 0x2A,
+    0x86, 0x96, 0x29, 0x58, 0x6E, 0x5E, 0x15, 0xB9, 0x2A, 0x87, 0x1B, 0x9E, 0xFC, 0x91, 0xDF, 0x2C,
+    0x98, 0x47, 0x15, 0x4F, 0xCB, 0xAC, 0x4F, 0xF0, 0xC6, 0xE1, 0xEA, 0x70, 0x8D, 0xDC, 0x9F, 0xCC,
+    0x6F, 0xFF, 0x63, 0x1B, 0x4D, 0x7E, 0xDF, 0xE4, 0x1A, 0x37, 0xB6, 0xFC, 0x80, 0x9D, 0x77, 0x4F,
+    0x1E, 0x8B, 0x1D, 0xDD, 0x68, 0x56, 0x37, 0x4A, 0x70, 0x78, 0xCE, 0x22, 0x4B, 0x9D, 0x33, 0xA1,
+    0x8B, 0x66, 0x3E, 0xC9, 0x27, 0xE9, 0xB0, 0xA3, 0x16, 0x8C, 0xF7, 0x4C, 0x7F, 0xD1, 0x0C, 0xBA,
+    0x7D, 0x3B, 0xF7, 0x26, 0x3F, 0xCF, 0x97, 0xC2, 0x99, 0x89, 0x69, 0x3D, 0xA8, 0x2F, 0x08, 0xC2,
+    0x54, 0xBC, 0x47, 0xEE, 0xA4, 0x5C, 0xA9, 0xBC, 0xE7, 0xE3, 0x1D, 0xC5, 0x54, 0x21, 0x8F, 0xD6,
+    0x40, 0x10, 0x9D, 0x6E, 0xF3, 0x5D, 0x43, 0x2A, 0x6A, 0xC0, 0x80, 0xA8, 0x05, 0x41, 0xFA, 0x07,
+    0x08, 0x5B, 0x87, 0xC0, 0x9C, 0x20, 0x21, 0xC1, 0x60, 0x41, 0x9D, 0x45, 0xD1, 0x26, 0x48, 0x0C,
+    0x06, 0x8F, 0x40, 0x90, 0x40, 0x02, 0x3F, 0x00, 0x68, 0x03, 0xE2, 0x6C, 0x0D, 0x9A, 0x6A, 0x30,
+    0x15, 0x15, 0xBD, 0xA3, 0xFD, 0x86, 0xF7, 0x66, 0xFB, 0x7D, 0x77, 0xC1, 0x40, 0xCE, 0xD0, 0x64,
+    0x37, 0x69, 0xBB, 0x33, 0xEF, 0xCD, 0x9B, 0x37, 0x2B, 0x12, 0x1E, 0x57, 0x62, 0x7B, 0x8A, 0x95,
+    0xCD, 0x78, 0xD1, 0x5E, 0xC4, 0x6F, 0x45, 0x22, 0x2D, 0xD7, 0x5F, 0xF6, 0x5C, 0x39, 0x14, 0xC9,
+    0x75, 0xC1, 0x7F, 0xDD, 0x4A, 0xA1, 0x3A, 0x45, 0x5A, 0xE7, 0x5D, 0x3A, 0x8B, 0x17, 0x3F, 0xC8,
+    0x2C, 0xDA, 0x26, 0x5D, 0xAC, 0x35, 0x92, 0x68, 0xCB, 0x93, 0x9D, 0xE0, 0xD4, 0xB0, 0x6E, 0x39,
+    0xB7, 0x94, 0x99, 0x13, 0x6D, 0x3D, 0xB6, 0x68, 0x06, 0x58, 0x3A, 0x20, 0xD4, 0x77, 0x48, 0xA4,
+    0x5D, 0x31, 0xC7, 0xAA, 0xDA, 0x25, 0x0A, 0x88, 0x48, 0x09, 0xBD, 0x91, 0xFD, 0x93, 0x60, 0xC5,
+    0xC8, 0xE0, 0x16, 0xD2, 0xC2, 0x0B, 0x57, 0x83, 0xE5, 0xD7, 0x9F, 0xBB, 0x27, 0x7A, 0x4C, 0x84,
+    0x11, 0x1C, 0xB6, 0x92, 0x9E, 0x36, 0x75, 0x32, 0xBB, 0xD6, 0xF1, 0x70, 0x35, 0x90, 0x58, 0x89,
+    0xE8, 0x91, 0x6C, 0x90, 0x9E, 0x8C, 0xB2, 0xAD, 0xDC, 0x12, 0xAD, 0x8B, 0xB6, 0xE8, 0xB3, 0x39,
+    0x1B, 0xC0, 0x60, 0x92, 0x0A, 0xCB, 0xF1, 0x54, 0x14, 0x4A, 0x7F, 0x87, 0x85, 0x2A, 0x81, 0x87,
+    0x2D, 0xFD, 0x35, 0x21, 0xF2, 0x0E, 0x00, 0xC6, 0xA4, 0x93, 0xAB, 0x72, 0x69, 0xC5, 0xDD, 0xDC,
+    0x23, 0x2E, 0xD2, 0x36, 0xAA, 0x75, 0x4A, 0x85, 0xAA, 0x3E, 0x19, 0x81, 0x9C, 0xB5, 0x59, 0x50,
+    0x28, 0x1A, 0x85, 0xE5, 0xC7, 0x84, 0x25, 0x43, 0xA8, 0x31, 0xAF, 0x5B, 0xA2, 0x26, 0xFB, 0xC4,
+    0xDA, 0x86, 0xAC, 0x8D, 0xB4, 0xAD, 0x70, 0xCE, 0x51, 0xA1, 0x6C, 0x44, 0x22, 0x3F, 0xA6, 0x2A,
+    0x10, 0x67, 0x84, 0x2E, 0x80, 0xA8, 0x28, 0x6D, 0xB4, 0xEF, 0x4B, 0x8A, 0x37, 0x34, 0x40, 0x9A,
+    0x49, 0xA2, 0xED, 0x2C, 0xC9, 0xB0, 0x48, 0xD6, 0xDD, 0x96, 0xA2, 0xBC, 0x79, 0x26, 0xCB, 0x83,
+    0xD2, 0x30, 0x3D, 0x30, 0x9A, 0xB7, 0x68, 0x9C, 0x7C, 0xA0, 0x28, 0x11, 0x1B, 0x45, 0x2A, 0xD5,
+    0x12, 0x34, 0x89, 0xED, 0x43, 0x9F, 0x89, 0xEF, 0x29, 0x09, 0x7A, 0xD3, 0x7A, 0xD4, 0x93, 0xA3,
+    0x1C, 0x53, 0x64, 0xF3, 0xFF, 0x4A, 0xDD, 0x70, 0x23, 0xBD, 0x98, 0xDD, 0x14, 0xF6, 0x23, 0xED,
+    0x57, 0x13, 0xE4, 0xC0, 0x91, 0x1B, 0xBB, 0x42, 0xE1, 0x3C, 0xF4, 0xB1, 0x2E, 0x7E, 0x6C, 0x59,
+    0x27, 0x3B, 0x97, 0x63, 0xF9, 0x25, 0x94, 0xC9, 0xE5, 0xF9, 0x3E, 0xB1, 0xCA, 0x46, 0x9A, 0x67,
+    0x1A, 0xCF, 0x99, 0x6A, 0xCF, 0x22, 0x53, 0xC2, 0x1D, 0x06, 0xB0, 0xA6, 0x15, 0x33, 0x0E, 0x49,
+    0x03, 0xA8, 0x82, 0x59, 0x86, 0x1D, 0xCA, 0x2B, 0x79, 0x22, 0x6E, 0x04, 0xEB, 0x68, 0xE1, 0x47,
+    0xAD, 0xDA, 0x30, 0x31, 0x92, 0x4D, 0x12, 0x8E, 0x9F, 0xB9, 0x02, 0x85, 0x74, 0x48, 0x8C, 0x92,
+    0x0B, 0x73, 0x17, 0xB4, 0x42, 0x6E, 0x98, 0x59, 0xC3, 0x06, 0x1B, 0x51, 0x2C, 0xA1, 0x30, 0xA8,
+    0xB7, 0x5C, 0x07, 0xC6, 0xD4, 0x42, 0xAC, 0xF0, 0xBD, 0xB6, 0xB1, 0x31, 0xB9, 0xF2, 0x16, 0x31,
+    0x05, 0x37, 0x9B, 0x1B, 0xD3, 0xCB, 0x73, 0x66, 0x72, 0x88, 0xB6, 0x0E, 0x8E, 0x09, 0x16, 0x95,
+    0x07, 0x22, 0x1F, 0xC1, 0x31, 0xED, 0xA0, 0x51, 0x85, 0x38, 0xEB, 0x47, 0xBE, 0x10, 0x0B, 0x07,
+    0xE2, 0xFE, 0xDC, 0xD8, 0x50, 0x37, 0x03, 0xA7, 0x43, 0x38, 0x37, 0x94, 0x4E, 0x8A, 0x61, 0xF5,
+    0x08, 0x07, 0xC7, 0x94, 0xB3, 0xE9, 0x31, 0x97, 0x60, 0x72, 0x28, 0xA0, 0x9B, 0xDD, 0x96, 0x33,
+    0xDC, 0xDA, 0xE8, 0x50, 0x43, 0xD0, 0x5D, 0x67, 0x17, 0xF5, 0xAA, 0x7E, 0xE5, 0x36, 0x7B, 0xEE,
+    0xC7, 0x27, 0x0F, 0x97, 0xFB, 0x53, 0x43, 0xEA, 0x77, 0xFB, 0x7C, 0x8A, 0x87, 0x4F, 0x4E, 0xCB,
+    0xA7, 0xAE, 0xF6, 0xC3, 0x41, 0xBD, 0xB6, 0xD5, 0x93, 0x54, 0x42, 0x25, 0xA5, 0xE9, 0xD6, 0xFB,
+    0x28, 0xB4, 0x5D, 0x72, 0x4A, 0xEB, 0x98, 0x5B, 0x8A, 0x51, 0x76, 0x3E, 0xA0, 0xF1, 0x43, 0xC0,
+    0x81, 0x9E, 0xF0, 0x3F, 0x6B, 0xF4, 0xBA, 0xDD, 0x17, 0x76, 0x6F, 0x7F, 0x2A, 0x04, 0xF0, 0x16,
+    0xB1, 0x6E, 0x22, 0x4D, 0xBB, 0xF3, 0x8E, 0xBC, 0x0E, 0x97, 0xC7, 0x2B, 0xFB, 0xC8, 0x0B, 0x86,
+    0x8D, 0x04, 0x99, 0x6B, 0xAA, 0x5F, 0xE0, 0xF0, 0x8C, 0x69, 0xD1, 0x85, 0x78, 0x09, 0x01, 0x4D,
+    0x6B, 0xD9, 0xEC, 0x50, 0x67, 0xE7, 0xD3, 0x39, 0x2A, 0xFD, 0x50, 0x88, 0xFE, 0xE4, 0x35, 0xD6,
+    0xA5, 0x68, 0x88, 0xDD, 0x36, 0xA0, 0x7B, 0x59, 0x2C, 0x2E, 0x5D, 0x8D, 0x54, 0x94, 0xE2, 0x10,
+    0x57, 0xD5, 0x06, 0x07, 0xCA, 0x75, 0x34, 0xF0, 0xF2, 0x6D, 0x30, 0x7E, 0x23, 0x29, 0x15, 0xDF,
+    0x87, 0x9D, 0x1D, 0x02, 0xE5, 0xAC, 0x3E, 0xDF, 0x29, 0x77, 0x26, 0x68, 0xD0, 0xB6, 0x7A, 0xA9,
+    0xDF, 0xAA, 0xE7, 0x43, 0x36, 0xC7, 0xE3, 0x67, 0x3A, 0x22, 0xED, 0x8A, 0x31, 0xE9, 0xAF, 0x23,
+    0xF6, 0xD1, 0xAE, 0x72, 0x93, 0xA3, 0xA2, 0xB6, 0xE9, 0xB2, 0x17, 0xD4, 0xB4, 0x8D, 0xE8, 0xAD,
+    0x20, 0x68, 0xD0, 0xF6, 0x9C, 0x54, 0x16, 0x70, 0xA4, 0x2F, 0xAC, 0x93, 0xFC, 0xA8, 0x67, 0x96,
+    0x21, 0x27, 0xBB, 0x90, 0xA7, 0x30, 0x22, 0x8F, 0x6E, 0x43, 0x95, 0x1C, 0x31, 0xC7, 0xA5, 0x35,
+    0x91, 0xD2, 0x1C, 0x21, 0x8A, 0x77, 0x04, 0xB8, 0xB6, 0xE1, 0x23, 0x60, 0x12, 0x9B, 0xFF, 0x95,
+    0xC3, 0x1F, 0x1F, 0x0F, 0xF1, 0xF1, 0xA3, 0xF8, 0x53, 0x5C, 0x25, 0xF0, 0xB1, 0xA3, 0x97, 0x39,
+    0xB6, 0x9C, 0xC8, 0x0B, 0x78, 0x89, 0xF4, 0xDD, 0x7B, 0x7D, 0x43, 0x3F, 0x00, 0x2C, 0xA1, 0x41,
+    0x2F, 0xEC, 0xA5, 0x7F, 0xB5, 0xC6, 0xA6, 0xF9, 0x56, 0xA2, 0x66, 0x47, 0xB0, 0xBF, 0x5B, 0xE3,
+    0x7F, 0x3F, 0xBF, 0x01, 0xD5, 0x95, 0xBF, 0x8E, 0xD4, 0x30, 0x10, 0xC6, 0xBF, 0x24, 0xC0, 0x0A,
+    0xA5, 0x08, 0x0D, 0x15, 0x42, 0xEE, 0xAF, 0xF1, 0x13, 0x9C, 0x6C, 0x6A, 0x9A, 0x2B, 0x76, 0x0B,
+    0xDE, 0x84, 0xEA, 0x12, 0xC4, 0x0B, 0xDC, 0x23, 0x50, 0x9E, 0x8E, 0x57, 0x00, 0x62, 0x1D, 0x05,
+    0x6D, 0x24, 0x5E, 0x20, 0x6F, 0x40, 0x8A, 0x08, 0x45, 0xC8, 0xC9, 0xF0, 0x8D, 0xB3, 0x07, 0xCB,
+    0x9F, 0x96, 0xD5, 0x62, 0x59, 0xB3, 0xF2, 0xCE, 0xD8, 0xF3, 0xCD, 0xCF, 0x93, 0x04, 0xD8, 0x8F,
+    0xFA, 0x59, 0x47, 0x6B, 0xE7, 0x9A, 0xB6, 0x10, 0xE9, 0xF9, 0x73, 0x6E, 0x23, 0x6D, 0xDE, 0x7C,
+    0xC0, 0xDF, 0x46, 0xC6, 0x20, 0x2B, 0xD1, 0xC9, 0xCC, 0xF0, 0x5B, 0x11, 0x6F, 0xA5, 0xCB, 0xC5,
+    0xC3, 0x0E, 0x3A, 0x8B, 0x85, 0xA7, 0x00, 0xAE, 0x83, 0x1B, 0xB0, 0x89, 0xD8, 0x2C, 0x4C, 0x11,
+    0xD0, 0x76, 0x28, 0x27, 0x54, 0x3C, 0x97, 0x91, 0x12, 0x50, 0x8D, 0xBA, 0xC8, 0x84, 0xB3, 0x81,
+    0xE1, 0xCE, 0x11, 0xF9, 0xE1, 0xCE, 0x22, 0xA6, 0x45, 0x1B, 0x74, 0xC1, 0xE0, 0x42, 0x9A, 0x8D,
+    0x3A, 0xE5, 0xAD, 0x74, 0xAA, 0x40, 0x46, 0x60, 0x23, 0x32, 0x53, 0x4F, 0x99, 0x2C, 0xB2, 0x8B,
+    0x55, 0xDE, 0x65, 0xD6, 0x20, 0x97, 0xD7, 0x3D, 0xB7, 0x7C, 0xE9, 0xB0, 0xF9, 0xCC, 0x64, 0xC5,
+    0x2B, 0x51, 0xCF, 0xA3, 0xC3, 0x2A, 0x5E, 0x20, 0xDB, 0x1A, 0xF1, 0xD5, 0xE8, 0xA4, 0xB1, 0xC3,
+    0x99, 0x1A, 0x4A, 0x73, 0x3D, 0x84, 0x0A, 0xA8, 0xAB, 0x0E, 0xD4, 0xD3, 0x86, 0x62, 0x06, 0x33,
+    0xC7, 0x4C, 0x7C, 0x19, 0x29, 0xA8, 0x1A, 0x4B, 0x9A, 0xC1, 0x08, 0x35, 0x5F, 0xCA, 0x53, 0xF3,
+    0x35, 0xCA, 0x62, 0x64, 0x90, 0x68, 0x24, 0xC8, 0x58, 0x2E, 0xA8, 0x1B, 0x5C, 0xE0, 0x1E, 0xCF,
+    0xBF, 0xBF, 0xDB, 0x2A, 0xC3, 0x15, 0xA8, 0x4B, 0x12, 0xF3, 0x9B, 0x9B, 0xE6, 0xFF, 0x03, 0x9A,
+    0x54, 0x53, 0x58, 0x50, 0x77, 0x40, 0xB6, 0xDB, 0x1D, 0x13, 0xE3, 0x9E, 0xD0, 0x80, 0x37, 0x8A,
+    0xB1, 0x39, 0x4F, 0x4C, 0x59, 0x04, 0xC0, 0xF8, 0xD4, 0xBE, 0x13, 0xFE, 0xB8, 0xDB, 0xD3, 0x6F,
+    0xD2, 0x06, 0x1E, 0x45, 0x9F, 0xB1, 0x35, 0xA7, 0x32, 0x28, 0x5D, 0xCF, 0x78, 0x8D, 0xB0, 0xFD,
+    0x51, 0xE9, 0x3E, 0x4E, 0x69, 0x4C, 0xD2, 0x56, 0xAC, 0x40, 0xDF, 0x55, 0x9E, 0xB6, 0xF2, 0xA3,
+    0x2E, 0x26, 0x83, 0x24, 0x3E, 0x79, 0x5C, 0x4C, 0xD1, 0xDB, 0x1F, 0xF2, 0x8C, 0x2C, 0x6C, 0xF0,
+    0x8F, 0x22, 0x9D, 0x93, 0x68, 0x65, 0xCC, 0x59, 0x82, 0x32, 0x12, 0x9D, 0xA0, 0x4C, 0x65, 0x34,
+    0x27, 0x46, 0xA4, 0x5B, 0xF7, 0x8A, 0xBA, 0x64, 0xAE, 0xB6, 0xF9, 0x49, 0x77, 0x8F, 0x9A, 0x74,
+    0xCD, 0xA4, 0xA8, 0xD3, 0x25, 0x1D, 0xEE, 0x74, 0x89, 0x6E, 0xB9, 0xA2, 0xA6, 0xD3, 0x4D, 0xA8,
+    0xE9, 0x94, 0x6F, 0xED, 0xAC, 0x0A, 0x14, 0x1D, 0x6A, 0x4A, 0xA0, 0x9E, 0x36, 0xD9, 0x7D, 0x51,
+    0xC8, 0xAE, 0xD2, 0x7B, 0x4D, 0x7B, 0xA4, 0xBD, 0x2B, 0x65, 0x50, 0x33, 0x5A, 0x9A, 0xF9, 0xFD,
+    0x5D, 0xF3, 0x3C, 0xB9, 0x3A, 0x6A, 0x2F, 0x03, 0x7D, 0xA6, 0x32, 0x6B, 0xAF, 0xAA, 0xEC, 0xC8,
+    0xE2, 0x50, 0x2D, 0x7A, 0x05, 0x85, 0x3C, 0x5F, 0xB4, 0x0A, 0xAF, 0xF6, 0x01, 0x1E, 0xFE, 0xD6,
+    0xD2, 0xA7, 0x4D, 0x3B, 0x8D, 0xD2, 0xB3, 0x18, 0x73, 0xCB, 0x3C, 0xEE, 0x13, 0xD1, 0x4A, 0x35,
+    0x20, 0x8F, 0x96, 0x0D, 0x3E, 0xF0, 0xEB, 0x52, 0x84, 0x97, 0xC7, 0xEB, 0xED, 0x93, 0x81, 0xD5,
+    0xFE, 0x02, 0xCB, 0x24, 0x9B, 0xA7, 0xC7, 0x09, 0xEB, 0xE7, 0xB5, 0x4A, 0x7F, 0x41, 0xAE, 0xD7,
+    0x27, 0x2D, 0xA4, 0xB0, 0x1E, 0xFF, 0x7A, 0x7C, 0x07, 0xCD, 0x54, 0xB1, 0xAE, 0xDD, 0x44, 0x10,
+    0x9D, 0x5D, 0xA3, 0x67, 0x29, 0x2E, 0x96, 0x86, 0x82, 0x44, 0x68, 0x1B, 0x0A, 0xA0, 0x71, 0x4B,
+    0x93, 0xD8, 0x82, 0x92, 0xE6, 0x15, 0x29, 0x40, 0xB4, 0x14, 0x34, 0x88, 0x1F, 0x80, 0xD8, 0x28,
+    0x05, 0x45, 0x1A, 0x0A, 0x3A, 0x9A, 0xFC, 0x01, 0x3D, 0xE2, 0xC9, 0x96, 0x5E, 0x41, 0x89, 0x25,
+    0x3E, 0x20, 0x06, 0x24, 0x0A, 0x28, 0xB2, 0x84, 0x25, 0xBA, 0xE1, 0xAD, 0x7D, 0x38, 0xB3, 0xBE,
+    0xF7, 0xE5, 0xDD, 0x17, 0x3E, 0x80, 0x95, 0x76, 0xD6, 0xD7, 0xD7, 0x3B, 0x33, 0xE7, 0xCC, 0x99,
+    0x91, 0x0F, 0xC4, 0xDC, 0xF5, 0x68, 0x5D, 0x6C, 0xD0, 0xD7, 0xE1, 0x2D, 0x35, 0x82, 0xB6, 0x99,
+    0x05, 0xD2, 0x4C, 0x06, 0xD2, 0x8D, 0x76, 0x95, 0x61, 0x2C, 0x16, 0x41, 0x5F, 0x26, 0x83, 0xB6,
+    0x4A, 0x05, 0xC4, 0xC5, 0x8A, 0x26, 0x78, 0x88, 0x0F, 0xF7, 0xF0, 0x9A, 0x7F, 0x9A, 0xB0, 0x7A,
+    0x04, 0x24, 0x8F, 0x11, 0xA1, 0x5A, 0x79, 0x4D, 0x4E, 0xC5, 0x09, 0xD7, 0x6D, 0x35, 0xDF, 0xAB,
+    0x49, 0x6A, 0xD6, 0x53, 0x1A, 0x04, 0x9A, 0x7A, 0xD4, 0xDF, 0x55, 0x2F, 0x79, 0xB9, 0xDD, 0xFE,
+    0x44, 0xBF, 0x3F, 0x63, 0x3E, 0x7D, 0x18, 0xB6, 0x73, 0x76, 0xF9, 0x7B, 0xFB, 0x95, 0xEC, 0x6F,
+    0x5C, 0x5D, 0x0E, 0x90, 0x37, 0xA5, 0xC1, 0x1F, 0x20, 0x80, 0xDE, 0x23, 0x0E, 0x84, 0x14, 0x2C,
+    0x76, 0xE5, 0x2A, 0x55, 0xA2, 0x13, 0x83, 0x3E, 0xA7, 0x2D, 0xDD, 0x6C, 0x31, 0x96, 0x49, 0x5C,
+    0x62, 0x16, 0x44, 0xC5, 0xB7, 0x03, 0x1F, 0x99, 0xD3, 0xD8, 0xF0, 0xB1, 0x95, 0x26, 0xD4, 0x7C,
+    0x1C, 0x79, 0xCD, 0x3D, 0x0A, 0xF5, 0x24, 0x16, 0xE5, 0x93, 0xE4, 0x98, 0xF0, 0x70, 0x1E, 0x87,
+    0xF7, 0x98, 0x94, 0xFF, 0x33, 0xD5, 0x3F, 0x11, 0x4B, 0x99, 0x96, 0xF2, 0xE9, 0xA2, 0x68, 0x3A,
+    0xB3, 0xAE, 0x3C, 0xC9, 0x60, 0x87, 0x9C, 0xCC, 0x98, 0x51, 0x14, 0x98, 0x0B, 0x8C, 0x1B, 0x5C,
+    0xCC, 0x8A, 0x78, 0x47, 0xEF, 0x8A, 0x39, 0x6D, 0x70, 0xCD, 0x2A, 0x45, 0x92, 0xFF, 0x5A, 0xB7,
+    0x32, 0x56, 0x97, 0x36, 0x6C, 0xAD, 0xDE, 0xB9, 0xD0, 0x9B, 0x65, 0x58, 0xB2, 0xF5, 0xEA, 0x3E,
+    0x14, 0xD3, 0xF1, 0xAD, 0x57, 0xE4, 0x46, 0x7B, 0xD2, 0x0F, 0xC1, 0x45, 0x97, 0xBA, 0xC5, 0xC2,
+    0xE0, 0x43, 0x85, 0xD2, 0x4C, 0x9E, 0xAF, 0xAA, 0x58, 0x2C, 0xC5, 0x6A, 0x89, 0xB5, 0x45, 0x0F,
+    0xA9, 0xE7, 0x2E, 0x34, 0x7D, 0xB9, 0xAB, 0x93, 0x1F, 0x65, 0x75, 0xA8, 0x82, 0x34, 0x3F, 0xE0,
+    0x3C, 0x8A, 0xFB, 0xEB, 0xE2, 0x49, 0x92, 0x62, 0xFD, 0x7B, 0x61, 0x74, 0xA4, 0x8E, 0xC8, 0xF8,
+    0x0D, 0x71, 0x55, 0x4B, 0x49, 0x6B, 0x17, 0xA3, 0x18, 0x3F, 0x97, 0xE6, 0x6A, 0xE4, 0x4F, 0xD4,
+    0x94, 0x9A, 0x9B, 0x74, 0x9A, 0x74, 0x79, 0xA1, 0x76, 0xB8, 0x4F, 0x94, 0x2E, 0x96, 0xC4, 0x7E,
+    0x53, 0x4E, 0x8E, 0x52, 0x1D, 0x10, 0x1A, 0xFC, 0x0A, 0x7C, 0x01, 0x3C, 0x40, 0x34, 0x88, 0xAC,
+    0x83, 0xDD, 0xD7, 0x4A, 0x7C, 0xD4, 0x82, 0x34, 0xA1, 0x22, 0xDB, 0xC3, 0xD8, 0xF5, 0x62, 0xF0,
+    0x6E, 0x52, 0x3E, 0x59, 0x16, 0xA9, 0xD6, 0x25, 0x93, 0x32, 0x67, 0xC6, 0x73, 0x44, 0x65, 0xC6,
+    0x64, 0xDD, 0x54, 0x39, 0x85, 0x5A, 0x5F, 0x48, 0xA6, 0xBE, 0xC8, 0x5F, 0x78, 0x65, 0xFB, 0x04,
+    0xCF, 0x72, 0xE0, 0xEC, 0x29, 0x5F, 0x3F, 0xAC, 0x33, 0x35, 0x5B, 0x65, 0x94, 0x6B, 0xBB, 0x6A,
+    0xF2, 0x9D, 0x23, 0xBB, 0x7E, 0xBA, 0xC3, 0xAF, 0xA3, 0x3D, 0x26, 0xFA, 0x7D, 0xC2, 0x11, 0xD2,
+    0xBC, 0x88, 0x67, 0xC9, 0x67, 0x33, 0x68, 0x4B, 0x50, 0xF2, 0xF5, 0x2C, 0xC5, 0x42, 0x14, 0xEC,
+    0x9C, 0x86, 0xC2, 0x59, 0xB5, 0xB8, 0x7E, 0x66, 0xFE, 0xA2, 0xF4, 0xB2, 0x5F, 0x54, 0x25, 0x20,
+    0xDF, 0x24, 0x79, 0x97, 0x85, 0x93, 0x43, 0xAA, 0xF3, 0x61, 0x97, 0x1F, 0x2F, 0xF3, 0x76, 0xAA,
+    0x7E, 0xBB, 0x11, 0xDA, 0x4A, 0x31, 0x7D, 0xCA, 0x8F, 0x3A, 0x6D, 0x89, 0x0A, 0xFA, 0xB2, 0x51,
+    0x4F, 0xF2, 0xDD, 0x96, 0xCE, 0x4B, 0x6C, 0x35, 0xB1, 0xC9, 0x11, 0x92, 0x8F, 0x7A, 0xBB, 0x3B,
+    0xD7, 0xBF, 0x97, 0x6A, 0x7E, 0x51, 0x58, 0x35, 0x92, 0xC3, 0x8E, 0xF0, 0x3B, 0xFC, 0x42, 0x4F,
+    0xDD, 0xA2, 0xE1, 0x86, 0xDE, 0x82, 0x72, 0xD6, 0x02, 0x92, 0x61, 0x97, 0x34, 0x6E, 0x1D, 0x3C,
+    0xAF, 0x77, 0x93, 0xA6, 0x84, 0x1F, 0x99, 0xBD, 0x05, 0x9B, 0x83, 0xCC, 0xED, 0x36, 0x85, 0x2B,
+    0xAB, 0x59, 0x9E, 0x9D, 0x46, 0xB1, 0x9B, 0x46, 0xD3, 0x25, 0x91, 0x1B, 0x8A, 0x52, 0xF3, 0x30,
+    0xC3, 0xDA, 0x6A, 0xE0, 0xEC, 0x09, 0xBB, 0xAB, 0xD9, 0xBC, 0x91, 0x1D, 0x64, 0x3D, 0x8C, 0x5A,
+    0xC2, 0x1C, 0x46, 0xFD, 0xE5, 0x62, 0xBE, 0x7E, 0x94, 0x79, 0x09, 0x20, 0x5A, 0x1A, 0x88, 0x9A,
+    0xB1, 0xF9, 0xDA, 0x62, 0xF2, 0xA3, 0xC1, 0x5C, 0xE6, 0xF6, 0x8A, 0xDB, 0x54, 0xC9, 0x66, 0x50,
+    0xF6, 0xBA, 0x6C, 0x34, 0x5E, 0x93, 0x4D, 0x3A, 0x98, 0x5A, 0x19, 0xF4, 0x8B, 0xBC, 0x2A, 0x7E,
+    0x15, 0x37, 0xBA, 0x95, 0x0D, 0xE5, 0xC0, 0x56, 0x24, 0xFF, 0x27, 0xD0, 0x38, 0x6C, 0x10, 0x0D,
+    0xC1, 0x9C, 0x71, 0xCC, 0xE1, 0x0D, 0x4D, 0x84, 0xAF, 0xB4, 0xB2, 0x5A, 0xE8, 0xDC, 0x0B, 0xBA,
+    0xEF, 0xEC, 0xFF, 0x3C, 0xAC, 0xBB, 0xF2, 0xB1, 0x20, 0x36, 0x23, 0xF0, 0x98, 0x42, 0x47, 0xF4,
+    0xBF, 0x21, 0x96, 0x2A, 0xE8, 0x58, 0x31, 0x19, 0xDD, 0xE5, 0xF5, 0x9D, 0x64, 0xE6, 0x3E, 0x2B,
+    0xF0, 0xCF, 0x70, 0x9F, 0x81, 0x7F, 0x06, 0x7B, 0xA4, 0x7E, 0x27, 0x8F, 0xC1, 0xF6, 0x79, 0xFD,
+    0x32, 0xC3, 0xF3, 0x41, 0xD3, 0x65, 0x66, 0x7C, 0x79, 0xB1, 0xCE, 0x9E, 0x1E, 0xA6, 0x8A, 0x86,
+    0xD2, 0x54, 0xCA, 0xD6, 0x53, 0x4A, 0xBB, 0x23, 0x89, 0xBD, 0x1F, 0x0B, 0xCE, 0xC2, 0x29, 0x4F,
+    0xA6, 0x6C, 0xAC, 0x0A, 0xD0, 0x6C, 0x26, 0x73, 0x3F, 0x1F, 0x68, 0x3C, 0xE2, 0xF2, 0x23, 0xE5,
+    0xB2, 0x51, 0x2E, 0xFD, 0x48, 0x1A, 0x5D, 0xA8, 0x93, 0xDC, 0x4A, 0x1A, 0x67, 0xDD, 0x42, 0x0C,
+    0xCA, 0xDB, 0x25, 0x51, 0xAD, 0xEA, 0x7D, 0x93, 0x84, 0xC5, 0xBE, 0xCA, 0xE6, 0x68, 0x56, 0xDD,
+    0x94, 0x66, 0x71, 0x24, 0xE7, 0x82, 0x8A, 0xC4, 0x52, 0x3E, 0x1B, 0x16, 0xA3, 0xCA, 0xBB, 0xAD,
+    0xBC, 0x66, 0x6E, 0xAF, 0x6F, 0xC8, 0xDB, 0xDC, 0x75, 0x8B, 0xF5, 0xDB, 0x99, 0xB1, 0x76, 0xDD,
+    0x63, 0xA4, 0x6A, 0x1A, 0x14, 0xFD, 0xCB, 0xDC, 0x0F, 0xE5, 0x33, 0x91, 0x7B, 0x3A, 0xC2, 0xDD,
+    0x44, 0x63, 0x17, 0x1C, 0x26, 0xC4, 0x36, 0x04, 0xEE, 0xFC, 0x9F, 0x08, 0x32, 0x9C, 0x87, 0xC5,
+    0xCC, 0x96, 0xD5, 0xB6, 0xAD, 0x1F, 0x70, 0x70, 0xA8, 0xAF, 0x21, 0x6C, 0xAC, 0x99, 0xF8, 0x3C,
+    0x51, 0x73, 0x6A, 0x1E, 0x16, 0x98, 0x40, 0x1F, 0xC3, 0xA8, 0x49, 0x77, 0xDF, 0xA8, 0xEE, 0xEB,
+    0xA9, 0x98, 0x38, 0x6F, 0x44, 0xB7, 0xBF, 0xBE, 0x43, 0xD1, 0xFB, 0x60, 0xA3, 0xC3, 0xEF, 0x9C,
+    0xEC, 0xC0, 0x97, 0x2B, 0xC5, 0x7C, 0x96, 0x07, 0x8D, 0xB9, 0xA6, 0x93, 0x7F, 0x01, 0x75, 0x55,
+    0xBF, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBB, 0xB3, 0x7D, 0x84, 0x13, 0x5A, 0x17, 0x36, 0x8A, 0x12,
+    0xC4, 0x52, 0xB8, 0x08, 0x86, 0xF8, 0x5A, 0x0A, 0xFB, 0xED, 0xA1, 0x94, 0x2E, 0xE2, 0xC2, 0xAE,
+    0x52, 0x40, 0x41, 0x43, 0x15, 0x0A, 0x0A, 0x17, 0x8E, 0xF6, 0x19, 0x97, 0x29, 0xA0, 0xA2, 0xA6,
+    0x70, 0x81, 0xD2, 0xD0, 0x52, 0xD8, 0xDC, 0x92, 0xF7, 0x0F, 0x5C, 0x83, 0x5C, 0xD0, 0x1C, 0x12,
+    0x08, 0x51, 0xB1, 0x48, 0x1B, 0x74, 0x0E, 0x7B, 0x37, 0xCC, 0xCC, 0x3D, 0x5B, 0x36, 0x0E, 0xAB,
+    0xA7, 0xEF, 0x3D, 0xDD, 0xCD, 0xCE, 0x7C, 0xF3, 0xCD, 0x8F, 0x07, 0x00, 0xF0, 0xDE, 0x37, 0x04,
+    0x29, 0xF6, 0x84, 0x05, 0x22, 0x61, 0xF9, 0xF7, 0x40, 0x68, 0xDC, 0x01, 0x61, 0x3D, 0x25, 0x00,
+    0xAC, 0x08, 0x12, 0x7E, 0x47, 0x86, 0x8C, 0xD9, 0x88, 0x83, 0x20, 0xDF, 0x84, 0x3C, 0x32, 0x16,
+    0x82, 0xAA, 0xBB, 0x82, 0x81, 0x51, 0x7B, 0xC6, 0x52, 0xD0, 0xB4, 0x82, 0x0D, 0xA3, 0x1D, 0xD1,
+    0x31, 0xD6, 0x82, 0xF8, 0x3F, 0x01, 0x39, 0xD4, 0xA6, 0x04, 0xA9, 0xBF, 0x63, 0xC7, 0x88, 0xEC,
+    0xA6, 0x16, 0xF3, 0xBB, 0xBF, 0xB2, 0xC9, 0x02, 0x84, 0xC2, 0x97, 0xDE, 0x34, 0xD6, 0x99, 0xE9,
+    0x7D, 0xE1, 0x04, 0x26, 0xED, 0xB5, 0xC7, 0x22, 0x18, 0xF8, 0x0C, 0xC6, 0x53, 0x34, 0x60, 0x3C,
+    0xD4, 0x5D, 0x3A, 0xC4, 0xDC, 0xF7, 0xBA, 0x99, 0x98, 0x8A, 0x6D, 0xF3, 0xF6, 0x76, 0xD9, 0x4D,
+    0xCC, 0xD0, 0x3F, 0x31, 0xF1, 0x03, 0x62, 0x9B, 0xC0, 0x9D, 0x67, 0xDF, 0x1A, 0x8C, 0x16, 0xE3,
+    0xEA, 0xDE, 0xCE, 0x2D, 0x58, 0x98, 0xC0, 0x5B, 0x66, 0x7A, 0x62, 0x30, 0x68, 0x6C, 0xD2, 0x01,
+    0x96, 0x8E, 0x7A, 0x7B, 0x16, 0x4D, 0xC5, 0x3C, 0xB5, 0x8B, 0x66, 0xD6, 0x5B, 0xFA, 0x3C, 0xE8,
+    0x16, 0xA0, 0x5A, 0x3A, 0x57, 0xF8, 0xF3, 0xEF, 0xFF, 0xB4, 0x3F, 0xAC, 0x19, 0x30, 0x15, 0xC2,
+    0x04, 0x14, 0x5B, 0xC1, 0x27, 0x50, 0x07, 0xFD, 0xE7, 0xAC, 0x3D, 0xD8, 0xCA, 0x66, 0xCD, 0x89,
+    0x79, 0x7C, 0x88, 0xED, 0x92, 0x10, 0x87, 0xFB, 0x99, 0xD3, 0xCF, 0xA3, 0xFA, 0x6B, 0x50, 0xC4,
+    0xD5, 0xD7, 0x99, 0xB7, 0xE0, 0xDF, 0x96, 0x37, 0xCB, 0xF0, 0xF1, 0x49, 0x1A, 0x4F, 0x0B, 0x6F,
+    0x4B, 0x67, 0x10, 0x74, 0xCF, 0x7A, 0xE6, 0x22, 0xE0, 0xDA, 0xAD, 0xCC, 0x47, 0x35, 0xF3, 0xE6,
+    0x61, 0x63, 0xB5, 0x3B, 0x29, 0xC1, 0x6F, 0xF2, 0xE3, 0xF5, 0x4A, 0xE3, 0x8F, 0x88, 0x5F, 0xFE,
+    0x84, 0xFB, 0xD0, 0x57, 0xA9, 0xA8, 0x09, 0xB9, 0x3B, 0xC9, 0x1B, 0x93, 0x76, 0xAA, 0x35, 0xAE,
+    0xAE, 0x8E, 0x21, 0xF7, 0xA6, 0xB5, 0x6E, 0xC8, 0x7D, 0x79, 0x18, 0xB5, 0xDB, 0x07, 0x35, 0xEB,
+    0xEB, 0x87, 0x7E, 0x28, 0x5A, 0x9B, 0x86, 0xD7, 0x49, 0xC8, 0x48, 0x74, 0xCC, 0x03, 0xBF, 0x95,
+    0xBB, 0x65, 0x12, 0x0C, 0xD5, 0x2F, 0xBD, 0xD9, 0x6E, 0x28, 0x6A, 0x92, 0x44, 0x73, 0xD6, 0xDB,
+    0xC3, 0xAF, 0x14, 0x49, 0x71, 0x91, 0xF2, 0x0A, 0xEC, 0x24, 0x95, 0xEA, 0x26, 0xA7, 0xFB, 0x1B,
+    0xDF, 0x6F, 0x3C, 0x39, 0x30, 0x61, 0x69, 0x0A, 0x95, 0x76, 0xB6, 0xEA, 0x33, 0x5F, 0xA6, 0x61,
+    0x11, 0x92, 0x9D, 0x22, 0x52, 0x63, 0xC4, 0x84, 0x14, 0x37, 0xEE, 0x5D, 0x80, 0x9D, 0xDC, 0x29,
+    0x92, 0x65, 0x02, 0x76, 0xD7, 0x44, 0xDD, 0x42, 0xD2, 0x97, 0xB3, 0x68, 0x8E, 0x82, 0x2D, 0xFC,
+    0xA7, 0xC2, 0x37, 0x0D, 0x54, 0xF6, 0x2A, 0x45, 0x9F, 0x0E, 0x43, 0x16, 0xF5, 0xAC, 0x4B, 0xFD,
+    0x1A, 0x2C, 0xBF, 0x76, 0xAD, 0x0A, 0x6D, 0x2A, 0xDD, 0x57, 0xF8, 0xF7, 0xCB, 0x38, 0xB1, 0xD8,
+    0x1F, 0x98, 0xEE, 0x9E, 0x62, 0x65, 0x56, 0xF7, 0x76, 0xC7, 0xC2, 0xAD, 0x3F, 0x3B, 0x86, 0x3B,
+    0xE4, 0x25, 0x28, 0x8C, 0xE6, 0xEB, 0xB8, 0x09, 0xF1, 0x1D, 0xF8, 0x1C, 0xC6, 0x56, 0x81, 0x62,
+    0x0A, 0x79, 0x80, 0x2C, 0x72, 0xFB, 0xA6, 0xD4, 0x56, 0xF4, 0xB9, 0x47, 0x55, 0x5F, 0xC9, 0x83,
+    0x39, 0xEA, 0xCB, 0x16, 0x55, 0x30, 0x1F, 0x4A, 0x03, 0xAF, 0xE7, 0xED, 0xA9, 0x7A, 0x81, 0x67,
+    0x01, 0x2E, 0x4F, 0x2E, 0x68, 0xC6, 0x1E, 0x9D, 0xCA, 0x38, 0x4C, 0xA5, 0x53, 0xC7, 0x3E, 0x96,
+    0x6A, 0xDF, 0x86, 0x6B, 0x07, 0xE9, 0x54, 0x34, 0x5E, 0x34, 0x66, 0x9A, 0xD0, 0x53, 0x43, 0x27,
+    0x8F, 0x1D, 0xE8, 0x00, 0x96, 0x3B, 0x3F, 0xE9, 0x78, 0xA4, 0x72, 0x07, 0x4A, 0x06, 0xC8, 0xB6,
+    0xE2, 0xBA, 0x1A, 0x47, 0x92, 0x68, 0x18, 0xC4, 0x46, 0x9C, 0x50, 0x70, 0x49, 0xBB, 0x14, 0x3A,
+    0x12, 0x90, 0x2E, 0xA6, 0x2D, 0x4F, 0x9B, 0x76, 0x3C, 0x4F, 0x03, 0x4B, 0x77, 0x97, 0xFC, 0x92,
+    0xB5, 0xE3, 0x88, 0xC8, 0xB7, 0x51, 0xEC, 0x77, 0x12, 0x9E, 0x48, 0x6F, 0xC9, 0x71, 0x3D, 0x1B,
+    0x78, 0xAA, 0x78, 0x30, 0x0B, 0x2F, 0xA9, 0xFC, 0xE7, 0x28, 0xB9, 0x54, 0x13, 0x36, 0x89, 0x78,
+    0xA1, 0xC1, 0x7D, 0x33, 0x32, 0xAB, 0xDC, 0xF3, 0x9C, 0xEB, 0x29, 0x0F, 0xD2, 0xC1, 0x9C, 0xC4,
+    0xC8, 0x4A, 0x4B, 0x14, 0xBA, 0x33, 0x25, 0x56, 0xBC, 0x51, 0x14, 0xA7, 0x3A, 0xA6, 0x93, 0x4A,
+    0x3A, 0x63, 0x7E, 0x74, 0x71, 0x83, 0x47, 0x3D, 0x89, 0x90, 0x53, 0x4B, 0xB7, 0x94, 0x4E, 0x52,
+    0x57, 0x39, 0x45, 0x89, 0x12, 0xD1, 0x67, 0xA2, 0x97, 0x10, 0xC7, 0x19, 0x43, 0xE4, 0x74, 0xF0,
+    0xE9, 0x8B, 0x8F, 0xFA, 0x47, 0xA1, 0xA6, 0x9B, 0x76, 0xBB, 0xD5, 0x21, 0xF7, 0x27, 0xB4, 0x1D,
+    0x4E, 0x93, 0xCA, 0xF8, 0xCB, 0x9D, 0x64, 0x7F, 0x3B, 0xBE, 0x10, 0xAD, 0xE6, 0xE0, 0x6A, 0x78,
+    0x44, 0x6C, 0x70, 0xAA, 0x23, 0xB3, 0xA3, 0xD9, 0xA5, 0x32, 0xF4, 0x4C, 0xC0, 0x36, 0xAC, 0x78,
+    0xCF, 0xEB, 0xA8, 0x6E, 0xE8, 0xBB, 0x88, 0x4B, 0x78, 0x0E, 0xF8, 0x9C, 0x16, 0x8B, 0xEA, 0x0C,
+    0xF6, 0xE3, 0xF6, 0x91, 0x65, 0xC5, 0x6B, 0xE7, 0x0D, 0x2E, 0x47, 0xF6, 0xB2, 0x6E, 0xB9, 0x18,
+    0xDD, 0xC5, 0xC2, 0x5C, 0xFA, 0xE3, 0xAA, 0x64, 0x52, 0xF3, 0x4C, 0x96, 0x5C, 0xCD, 0x8B, 0x4D,
+    0xA3, 0xE4, 0xCD, 0x0F, 0xD4, 0xB9, 0xCC, 0x2C, 0xDC, 0xEC, 0x0A, 0x26, 0x4B, 0x69, 0xCF, 0xBB,
+    0x02, 0x57, 0x69, 0x19, 0xEA, 0x8E, 0xAA, 0x48, 0x2E, 0xB2, 0xC0, 0x49, 0x29, 0xE9, 0x8A, 0x2D,
+    0x91, 0xB1, 0xBA, 0xE8, 0x8A, 0x7E, 0x2E, 0x23, 0x5C, 0xD3, 0xFF, 0x7A, 0x57, 0x5C, 0xCA, 0x7D,
+    0x45, 0x7F, 0xCB, 0x6B, 0xB3, 0x90, 0x6E, 0x32, 0xB2, 0xEC, 0xE9, 0xEC, 0x55, 0xFC, 0x96, 0x5E,
+    0x70, 0x9D, 0x1D, 0x08, 0x1D, 0x33, 0x54, 0xD6, 0xA9, 0x01, 0xB2, 0x2E, 0x25, 0xF9, 0x0C, 0x2B,
+    0x9C, 0x79, 0xDE, 0xEE, 0x2B, 0xA3, 0x7B, 0xA9, 0x34, 0x5D, 0xE2, 0x97, 0xDC, 0x27, 0x54, 0xB0,
+    0x61, 0x4E, 0x68, 0x8C, 0x6C, 0xC8, 0x60, 0x99, 0x27, 0x82, 0x76, 0x1B, 0x91, 0x1D, 0x80, 0x8C,
+    0xCA, 0x36, 0xC7, 0x97, 0x75, 0x0F, 0xA5, 0xDC, 0xB3, 0xC2, 0xA2, 0x66, 0x80, 0x45, 0x21, 0xB2,
+    0xB8, 0x4B, 0x89, 0x70, 0xDD, 0xB9, 0x83, 0x0A, 0xF6, 0x68, 0xDB, 0x3C, 0xA4, 0x2C, 0x01, 0x25,
+    0x42, 0xDB, 0xD4, 0x27, 0x54, 0xC2, 0x96, 0x43, 0x78, 0xB6, 0x0C, 0x9C, 0x4A, 0x9C, 0x43, 0xCE,
+    0x90, 0x72, 0x69, 0x12, 0xF4, 0xCA, 0x25, 0xE8, 0x2C, 0xD9, 0xD1, 0x68, 0xAB, 0x48, 0x3B, 0xD3,
+    0xB6, 0x26, 0x14, 0xC8, 0xB9, 0x85, 0x44, 0x5A, 0xCB, 0x72, 0xDC, 0xA4, 0x1A, 0x1B, 0x9D, 0x15,
+    0xA1, 0x1B, 0xD2, 0xB6, 0xF3, 0x99, 0xE6, 0x02, 0x72, 0x3A, 0xAC, 0xE0, 0xAB, 0x1F, 0x0E, 0xAF,
+    0x78, 0xC8, 0x65, 0x60, 0xA1, 0xB9, 0x95, 0xD8, 0x67, 0x36, 0xFE, 0x4D, 0xF1, 0xDC, 0x99, 0x2F,
+    0x98, 0x0A, 0x0D, 0x28, 0x6E, 0xD3, 0x8F, 0xD6, 0x56, 0x37, 0xC6, 0x8D, 0xF5, 0xF4, 0xD4, 0x08,
+    0xDD, 0xE8, 0x4B, 0x9C, 0x73, 0x45, 0x45, 0x50, 0x8E, 0x20, 0x3F, 0xB8, 0x98, 0x52, 0x7E, 0xAE,
+    0x83, 0xD4, 0x97, 0xED, 0x74, 0x37, 0xAF, 0xF0, 0x0D, 0x3B, 0xA6, 0x22, 0x8E, 0x0D, 0x0E, 0x37,
+    0x86, 0xFC, 0x5F, 0x8D, 0x55, 0x31, 0x92, 0xDD, 0x44, 0x10, 0x6D, 0x49, 0x2C, 0x0A, 0x54, 0xC5,
+    0x24, 0x1B, 0xA3, 0x84, 0xC0, 0x99, 0x8E, 0x30, 0x02, 0x8E, 0x40, 0x6D, 0xCE, 0x45, 0x40, 0xAA,
+    0xE2, 0x02, 0x1B, 0x6C, 0x4E, 0xE6, 0xC0, 0xBE, 0x02, 0xE5, 0x11, 0x5C, 0x00, 0x25, 0x40, 0x40,
+    0xF2, 0x03, 0x67, 0x24, 0x2A, 0x4A, 0x54, 0xC9, 0x58, 0x9A, 0xE6, 0xBD, 0x6E, 0xED, 0x1A, 0x7B,
+    0x71, 0x99, 0x29, 0xFD, 0x99, 0xAF, 0x3F, 0x33, 0xDD, 0xAF, 0x5F, 0xBF, 0xEE, 0x2F, 0x12, 0x54,
+    0x7B, 0x69, 0x54, 0x27, 0x11, 0xD5, 0x51, 0xA4, 0x52, 0xC1, 0xE0, 0xAB, 0x0C, 0x17, 0x4C, 0xDD,
+    0x8A, 0x29, 0xEC, 0xF2, 0xC1, 0x9D, 0x82, 0xB7, 0x65, 0x98, 0xDF, 0xB7, 0x93, 0xB8, 0x13, 0x17,
+    0xEE, 0x6C, 0x98, 0x9A, 0x43, 0xE4, 0x09, 0xB7, 0xDB, 0xDF, 0x1C, 0x40, 0x2F, 0x25, 0x27, 0x19,
+    0xEC, 0xCA, 0x9D, 0xD8, 0x18, 0x54, 0x95, 0x76, 0x12, 0xD6, 0xED, 0x7C, 0xA7, 0xEF, 0x6A, 0x6F,
+    0x32, 0xF7, 0xAB, 0xAD, 0xE1, 0xB6, 0xD4, 0xAB, 0xB9, 0x93, 0x66, 0xF1, 0x35, 0x5C, 0xCC, 0x89,
+    0x84, 0xB9, 0x25, 0x16, 0x69, 0xA7, 0xEE, 0x2F, 0xAE, 0x71, 0x8A, 0xCA, 0x8B, 0xB1, 0x8F, 0xAA,
+    0x00, 0x94, 0x64, 0xF8, 0x5B, 0x71, 0x22, 0x03, 0x5E, 0xB7, 0x4B, 0x71, 0x20, 0x3E, 0x58, 0xA8,
+    0x76, 0xAC, 0xB0, 0x5C, 0xAF, 0xA2, 0x23, 0xD6, 0xB0, 0x14, 0xDA, 0x87, 0xFD, 0xB3, 0x38, 0x95,
+    0xDA, 0xB7, 0x5B, 0xD4, 0x11, 0xC8, 0xD3, 0x92, 0x54, 0x3A, 0x00, 0x9A, 0xD2, 0x5E, 0x60, 0xC9,
+    0x12, 0x2F, 0xA5, 0xE1, 0xFB, 0x48, 0xCE, 0x11, 0x34, 0x83, 0x5F, 0x61, 0x78, 0x35, 0x29, 0xC6,
+    0xB1, 0x3E, 0x19, 0xCB, 0x99, 0x0F, 0xA9, 0xE9, 0x0B, 0x06, 0x2D, 0x69, 0xE2, 0x63, 0x04, 0xDD,
+    0x73, 0x64, 0x11, 0xD4, 0x07, 0x1F, 0x3B, 0x58, 0xEA, 0xDD, 0xC9, 0x04, 0xA9, 0x88, 0x5C, 0x11,
+    0x42, 0xA0, 0xE7, 0x74, 0xF8, 0xC1, 0x42, 0x01, 0x10, 0x3C, 0x4A, 0xB7, 0x30, 0x51, 0x88, 0xE1,
+    0x00, 0x28, 0x58, 0xC4, 0x4F, 0x6E, 0x51, 0x27, 0xB7, 0x38, 0x5C, 0xFC, 0x60, 0x5A, 0x6A, 0xDD,
+    0x88, 0x7A, 0x05, 0xC6, 0x0A, 0xEB, 0x82, 0xE9, 0x47, 0x35, 0x29, 0x9C, 0xC3, 0x3C, 0x4D, 0x3E,
+    0x93, 0x7F, 0x1D, 0xD3, 0x8D, 0xFE, 0x92, 0xFA, 0x04, 0x6E, 0x86, 0xFE, 0x05, 0x90, 0x0D, 0xF2,
+    0x03, 0x4C, 0xBD, 0x90, 0x6B, 0xB0, 0x72, 0x2D, 0x1E, 0x99, 0xD4, 0xF9, 0xEA, 0xCE, 0x22, 0xF7,
+    0xF4, 0x1A, 0xD4, 0xA7, 0xBA, 0x10, 0xC4, 0xB0, 0x08, 0xD2, 0x82, 0x38, 0xBB, 0xF5, 0x0C, 0xD8,
+    0x1F, 0xC8, 0x0A, 0x68, 0x21, 0x21, 0x3C, 0x69, 0xFA, 0x58, 0x37, 0x3C, 0x9D, 0xE6, 0x4E, 0x8F,
+    0xA8, 0x7B, 0x34, 0x21, 0x3C, 0x8C, 0xC9, 0xE6, 0xCE, 0x60, 0xBA, 0x32, 0x25, 0x79, 0xCA, 0x1D,
+    0xBA, 0xC9, 0x4D, 0xE4, 0x56, 0xDE, 0x1A, 0x57, 0x54, 0x39, 0x42, 0x24, 0xA2, 0x71, 0xC8, 0xD2,
+    0xEA, 0x56, 0x21, 0xFF, 0x40, 0x1C, 0x5F, 0x4F, 0x00, 0x55, 0x1E, 0x57, 0xCC, 0x45, 0x3B, 0x9B,
+    0xD1, 0x6C, 0x32, 0x0E, 0x8B, 0x29, 0x7E, 0xB0, 0x2C, 0x7C, 0x49, 0x39, 0x35, 0x4E, 0x4F, 0x54,
+    0xAF, 0x88, 0xDF, 0x0F, 0x4B, 0x94, 0xE5, 0xAB, 0x5B, 0xDB, 0xC5, 0xAA, 0x24, 0xBA, 0x09, 0x26,
+    0x35, 0x6C, 0x96, 0xE3, 0x61, 0x26, 0xCE, 0x92, 0xBE, 0x29, 0xE4, 0x31, 0x64, 0x33, 0xD4, 0xC2,
+    0xB7, 0x1E, 0xD2, 0x6D, 0xF7, 0x00, 0x1F, 0x05, 0x09, 0xB5, 0xDA, 0xE2, 0xBC, 0xE2, 0xF5, 0x24,
+    0x22, 0x2D, 0xE7, 0xEA, 0xDB, 0xF2, 0xB5, 0x3C, 0x1A, 0x50, 0x07, 0x92, 0x4B, 0x59, 0x5E, 0xE8,
+    0xA4, 0xB5, 0x5C, 0xF7, 0xAC, 0x4D, 0x08, 0xD9, 0x0A, 0x93, 0x6A, 0x43, 0x1A, 0x88, 0x09, 0xF0,
+    0x2A, 0x56, 0x17, 0x7E, 0x62, 0x91, 0xD4, 0x19, 0x28, 0x67, 0xE2, 0x6E, 0x49, 0x7D, 0xB3, 0x37,
+    0x9B, 0x75, 0x89, 0x9F, 0x72, 0xBB, 0x91, 0x17, 0xFD, 0xC2, 0x4C, 0xE8, 0x6C, 0x26, 0x8C, 0x55,
+    0xDC, 0xDF, 0xCD, 0x62, 0xCC, 0xBC, 0x8E, 0xD7, 0xD1, 0x12, 0x81, 0xC4, 0xB2, 0x2E, 0x59, 0xF3,
+    0x30, 0x51, 0xEB, 0x2B, 0xC8, 0x78, 0xBC, 0x07, 0x85, 0x8F, 0x15, 0xC7, 0x9B, 0xF1, 0x09, 0x83,
+    0x94, 0x4F, 0x19, 0x9A, 0x7C, 0xC3, 0xF9, 0xD7, 0xDD, 0xE8, 0x5E, 0x8C, 0xFB, 0xF1, 0x71, 0x98,
+    0x08, 0xEC, 0xA8, 0xF4, 0xE8, 0x74, 0xAF, 0x75, 0x6F, 0xF5, 0x52, 0xE8, 0x5A, 0xD2, 0xF5, 0x08,
+    0x89, 0x8A, 0xD2, 0x29, 0x2A, 0x1A, 0xB9, 0xA8, 0x37, 0x86, 0xC3, 0x84, 0xC6, 0x4B, 0x07, 0x8F,
+    0xDD, 0x32, 0xC0, 0x5A, 0xBB, 0x30, 0x8F, 0xE1, 0x4F, 0x3A, 0x09, 0xAF, 0xAD, 0xEA, 0xCC, 0x55,
+    0x65, 0xA0, 0x2A, 0x73, 0x58, 0x5A, 0xAA, 0x69, 0x45, 0x9E, 0x34, 0xD4, 0xC0, 0xB7, 0x26, 0xB0,
+    0xE4, 0xAD, 0xED, 0xB0, 0xB4, 0xB0, 0x31, 0x49, 0xF1, 0x50, 0xF9, 0xEC, 0x69, 0xF8, 0x7C, 0x87,
+    0xD8, 0x0A, 0x16, 0x8D, 0xDE, 0x3A, 0xC3, 0xDE, 0x10, 0x69, 0x1B, 0x26, 0x06, 0xE7, 0x9B, 0x1D,
+    0x13, 0x0C, 0xB1, 0x99, 0x81, 0x37, 0x3F, 0xD3, 0xFB, 0x99, 0xE9, 0x9D, 0x33, 0xE1, 0xCD, 0x99,
+    0x92, 0xDD, 0x63, 0x34, 0x4E, 0xFF, 0x7D, 0x66, 0xFB, 0x8F, 0x33, 0x35, 0x0B, 0xF7, 0x95, 0x15,
+    0x22, 0xF0, 0x54, 0xB6, 0x10, 0x6F, 0xF4, 0x32, 0x09, 0x2E, 0xA5, 0xCA, 0x45, 0x58, 0x9C, 0x02,
+    0x1B, 0x4E, 0x72, 0x5D, 0x5F, 0xF5, 0xF4, 0x0E, 0xE9, 0xD7, 0xAE, 0x46, 0xFB, 0xD9, 0xDB, 0x6E,
+    0xA9, 0x66, 0x6E, 0x38, 0x9C, 0x02, 0x3A, 0x28, 0xB2, 0x31, 0x17, 0xBF, 0xB7, 0xE4, 0x19, 0xD3,
+    0x92, 0xC3, 0x6A, 0x17, 0x89, 0xBD, 0x5E, 0xAD, 0x83, 0x7B, 0xA5, 0x74, 0x73, 0x8D, 0x97, 0xEA,
+    0xB8, 0x21, 0xB9, 0xD6, 0x52, 0x91, 0x59, 0x14, 0x2C, 0xA4, 0xFF, 0xEC, 0x39, 0xAE, 0x22, 0xA1,
+    0xE8, 0x6C, 0x00, 0x8B, 0xA8, 0x4A, 0x6E, 0x6E, 0x45, 0x7A, 0x89, 0xA0, 0xD6, 0xA4, 0x33, 0x22,
+    0xFC, 0x19, 0xEA, 0x4B, 0xF8, 0xB0, 0x27, 0x5A, 0x2B, 0xCE, 0x76, 0x1D, 0x9D, 0x67, 0xBB, 0x3A,
+    0xC0, 0xA8, 0x84, 0x09, 0xF7, 0x8B, 0x8D, 0xC4, 0xB4, 0x67, 0xC2, 0xAC, 0xBB, 0xCA, 0xF0, 0xD2,
+    0xCB, 0xDA, 0xDD, 0x4E, 0x12, 0x32, 0x7A, 0x3B, 0x52, 0x10, 0x37, 0x6F, 0xA5, 0xB8, 0x10, 0x4C,
+    0xD9, 0xF8, 0x9A, 0xAD, 0x85, 0xCD, 0x2C, 0x64, 0xB8, 0xBB, 0x90, 0x59, 0xEB, 0xA0, 0x54, 0x32,
+    0x28, 0x7E, 0x68, 0x35, 0x37, 0xDE, 0xAD, 0x7B, 0xFE, 0x69, 0xB1, 0xD4, 0x33, 0x1A, 0xCD, 0x8D,
+    0x7E, 0xAE, 0xEC, 0x33, 0x0D, 0x0B, 0x50, 0x86, 0x09, 0x26, 0x11, 0x31, 0x4C, 0x22, 0x32, 0x13,
+    0x66, 0x9D, 0xBF, 0x3A, 0xCE, 0x6B, 0x81, 0x26, 0x45, 0xFF, 0x50, 0x76, 0xCB, 0x8A, 0xF5, 0x22,
+    0xED, 0x3D, 0x06, 0x87, 0x73, 0x81, 0xBC, 0x81, 0x1F, 0x08, 0xD3, 0xD4, 0x64, 0xFB, 0x73, 0x1C,
+    0xF9, 0x87, 0x34, 0x33, 0xBF, 0xB7, 0xF2, 0x3F, 0xC6, 0x3F, 0xD5, 0x55, 0x41, 0xAE, 0xE5, 0x34,
+    0x10, 0x6C, 0x3F, 0x0F, 0x63, 0xA4, 0x2C, 0xCC, 0x06, 0x16, 0x8C, 0x44, 0x36, 0xB3, 0x65, 0x72,
+    0x04, 0x07, 0xB8, 0x00, 0x0B, 0x24, 0x8E, 0x31, 0x17, 0x40, 0x4A, 0x80, 0x0B, 0x70, 0x84, 0x39,
+    0xC9, 0xD8, 0x1A, 0x2E, 0x90, 0x15, 0x6B, 0x2F, 0xD8, 0x13, 0xA4, 0x68, 0xC8, 0x40, 0x92, 0xA6,
+    0xAA, 0xFD, 0x3F, 0xE2, 0x4B, 0x1F, 0xB1, 0x62, 0x41, 0xF4, 0x9F, 0x9D, 0x9F, 0x97, 0xEE, 0xAE,
+    0xAE, 0x2E, 0xD7, 0x93, 0xA8, 0xAA, 0xAB, 0x64, 0xAC, 0xC5, 0x61, 0x51, 0x91, 0xF4, 0xEB, 0xD7,
+    0x87, 0x38, 0x9D, 0x63, 0x95, 0xEE, 0x94, 0x34, 0x4A, 0x5A, 0xE5, 0x10, 0xD1, 0xE2, 0x17, 0x09,
+    0x97, 0x3C, 0x11, 0xE9, 0x37, 0xC1, 0x95, 0x17, 0x2C, 0x5E, 0x79, 0x1B, 0x0F, 0xAE, 0x53, 0xC5,
+    0x72, 0xD3, 0xF1, 0xAF, 0x07, 0x08, 0x14, 0x06, 0x62, 0x41, 0x20, 0xAE, 0x81, 0x81, 0x41, 0x79,
+    0x9F, 0xF5, 0x64, 0xB4, 0xDA, 0x2B, 0x92, 0x50, 0xF9, 0x14, 0x83, 0x81, 0xC8, 0x09, 0xDB, 0xCF,
+    0xF8, 0xF6, 0xB0, 0xEC, 0x7E, 0xB7, 0x2D, 0x6C, 0x9E, 0x71, 0xDD, 0x1A, 0x4E, 0x16, 0xA8, 0x9D,
+    0x6D, 0x4B, 0xC7, 0x4A, 0x43, 0xB1, 0x82, 0x69, 0x8E, 0x3B, 0x71, 0x8C, 0x06, 0x50, 0x65, 0x40,
+    0x72, 0x77, 0x1A, 0x0C, 0x7F, 0xD8, 0x16, 0x36, 0x49, 0x40, 0x19, 0x57, 0x99, 0x80, 0x7E, 0x58,
+    0x24, 0x03, 0xDC, 0x54, 0x88, 0xD1, 0xA1, 0x88, 0xCE, 0x32, 0x90, 0x84, 0x77, 0x06, 0x01, 0x64,
+    0x10, 0x10, 0xE0, 0xE6, 0xD1, 0x32, 0x18, 0x9A, 0xBB, 0x6D, 0x13, 0xD6, 0x0F, 0x46, 0x8D, 0x84,
+    0xDA, 0xB6, 0x45, 0x5E, 0x91, 0x82, 0x19, 0x15, 0x10, 0xB7, 0x59, 0xF8, 0x72, 0x4F, 0x6B, 0xFD,
+    0x88, 0xB4, 0x8E, 0x08, 0x01, 0xE6, 0x7E, 0x26, 0x9E, 0x6F, 0x1E, 0xB0, 0x73, 0x47, 0xAB, 0x02,
+    0x85, 0x37, 0x3A, 0xA2, 0xD1, 0xF3, 0x18, 0xAD, 0x2F, 0x88, 0xD5, 0x1D, 0x02, 0x2E, 0x30, 0xA6,
+    0x61, 0x73, 0x79, 0x0C, 0xC6, 0x1D, 0x2B, 0xAE, 0x9E, 0x15, 0xF1, 0xBE, 0xFB, 0xD2, 0xC8, 0xFD,
+    0x8A, 0x53, 0xEA, 0x75, 0x73, 0xA8, 0xA5, 0x6B, 0xA7, 0x87, 0x03, 0xB4, 0x74, 0x3A, 0x7D, 0xE7,
+    0x10, 0x11, 0x73, 0xE9, 0x76, 0xD1, 0x2C, 0xCE, 0x6F, 0xFE, 0x14, 0x75, 0x88, 0x78, 0x8D, 0x1E,
+    0xB3, 0x0D, 0xB6, 0x4C, 0x65, 0x1A, 0xAD, 0xDF, 0xA1, 0x26, 0xDE, 0xC8, 0xEB, 0x6E, 0x1B, 0x66,
+    0x83, 0xFB, 0xE3, 0x19, 0x09, 0x5E, 0x3A, 0x76, 0x29, 0x36, 0x59, 0xD5, 0xDD, 0x6E, 0xAE, 0x97,
+    0x6F, 0x4D, 0x18, 0x5E, 0xE3, 0x96, 0x9A, 0x4E, 0xFC, 0x61, 0xA3, 0xF2, 0x3A, 0x2A, 0xA9, 0x46,
+    0x47, 0xF3, 0x54, 0x38, 0x8C, 0x9B, 0x96, 0xA1, 0xF2, 0xBB, 0x9B, 0x2E, 0x71, 0x23, 0x21, 0x5E,
+    0x17, 0xD0, 0x3C, 0xEC, 0x48, 0x58, 0x9F, 0xE2, 0x1E, 0xA4, 0x69, 0xED, 0xD8, 0xDD, 0x0E, 0xD5,
+    0xA1, 0x3B, 0x0A, 0xD3, 0x59, 0x6F, 0xF2, 0x01, 0x97, 0xF7, 0xD0, 0xE8, 0x80, 0xD2, 0x9E, 0x14,
+    0xF4, 0xC6, 0xC3, 0x38, 0xAD, 0x98, 0x51, 0x5E, 0x62, 0x01, 0x75, 0x9F, 0x8A, 0xD5, 0x6E, 0xD5,
+    0x44, 0x3E, 0x9C, 0x40, 0x2B, 0x67, 0x12, 0xB8, 0x7C, 0xCC, 0x45, 0x06, 0x8E, 0x33, 0x11, 0x7D,
+    0xAE, 0xEF, 0x63, 0x4E, 0xDF, 0x6E, 0x28, 0x42, 0x9D, 0xAC, 0x69, 0x7B, 0x06, 0xCC, 0x1C, 0xA7,
+    0xB1, 0x9A, 0xD9, 0xAB, 0xB3, 0x69, 0xA8, 0xDE, 0x54, 0x2B, 0x3F, 0x09, 0xE3, 0xEA, 0x75, 0xBF,
+    0xF1, 0x05, 0x0C, 0x89, 0xD3, 0xC2, 0x09, 0x32, 0xC9, 0x41, 0xF3, 0x9D, 0xDA, 0x41, 0xF1, 0x5A,
+    0x6D, 0x78, 0xD4, 0x3F, 0x26, 0x3E, 0x31, 0xD1, 0xB4, 0xF4, 0x54, 0x7C, 0x77, 0x74, 0x3B, 0x95,
+    0xA0, 0x6F, 0xAE, 0x7E, 0xE7, 0x9C, 0xF5, 0x73, 0x4B, 0xA1, 0x8B, 0xA5, 0xE0, 0x48, 0x99, 0xA2,
+    0x89, 0x38, 0x5D, 0x26, 0x18, 0x8F, 0x02, 0x3C, 0x83, 0xD0, 0x07, 0x75, 0xC1, 0xF3, 0x80, 0x14,
+    0x01, 0xE2, 0xCD, 0x3A, 0xDF, 0x83, 0xC2, 0x07, 0x4D, 0x16, 0x79, 0x70, 0x55, 0x53, 0x91, 0x7C,
+    0x22, 0xED, 0x3C, 0xD9, 0xEC, 0xF2, 0x4F, 0x47, 0x1B, 0x98, 0xCD, 0x0D, 0x90, 0x47, 0xF9, 0xA7,
+    0xEB, 0x7F, 0xD7, 0x37, 0xA6, 0x95, 0x90, 0x43, 0x0B, 0xBF, 0xED, 0x75, 0xA6, 0x03, 0xF1, 0x7C,
+    0xC1, 0xE3, 0xAE, 0x95, 0x67, 0x28, 0x7F, 0x36, 0xC2, 0x2C, 0x82, 0xB9, 0x46, 0x49, 0x73, 0x93,
+    0x2B, 0x25, 0xBE, 0xF7, 0x4C, 0x31, 0x2D, 0xA7, 0x09, 0x96, 0x7D, 0xB0, 0x7B, 0x3E, 0x4B, 0x6F,
+    0xED, 0x84, 0xE9, 0x17, 0x66, 0x4A, 0x67, 0x30, 0x7D, 0xAD, 0xB1, 0xA5, 0xA0, 0xF1, 0xC0, 0xAD,
+    0xE8, 0x31, 0xBD, 0x29, 0x1A, 0x3E, 0x03, 0x99, 0x83, 0xAA, 0xEA, 0x1B, 0xC6, 0x80, 0xDA, 0x20,
+    0xAD, 0xBB, 0xEE, 0x01, 0x36, 0xD7, 0x3B, 0x1E, 0x78, 0x60, 0xFD, 0x9B, 0x07, 0x9A, 0x45, 0x84,
+    0xCD, 0xCC, 0xAF, 0x5B, 0x4D, 0xCE, 0xB1, 0x9A, 0x1F, 0xC4, 0xC5, 0xB6, 0xBE, 0x90, 0x41, 0x49,
+    0xC5, 0x4C, 0x36, 0x8D, 0x66, 0xBE, 0xB9, 0x79, 0xF0, 0x65, 0x1B, 0xAC, 0x70, 0xB2, 0x94, 0x46,
+    0x5F, 0x68, 0xC0, 0x20, 0x71, 0x6C, 0xCF, 0x53, 0xB1, 0xB9, 0x11, 0x1C, 0x25, 0x2E, 0xCF, 0x60,
+    0xC0, 0x19, 0x94, 0x91, 0xFA, 0xEA, 0x78, 0xAC, 0x9F, 0xDC, 0x4D, 0xDF, 0x51, 0x21, 0xD9, 0x3E,
+    0x05, 0x28, 0x0B, 0xA6, 0xBC, 0x32, 0x10, 0x0F, 0xA8, 0x85, 0x91, 0x66, 0x3E, 0x46, 0xCE, 0xB8,
+    0xD7, 0x25, 0xE0, 0xD4, 0x48, 0xF7, 0xC7, 0xEE, 0x7F, 0x03, 0x44, 0xFF, 0xFB, 0xE5, 0x0E, 0x76,
+    0x73, 0x4C, 0xE5, 0x4C, 0x24, 0xA5, 0x5F, 0xF1, 0x87, 0x80, 0xEF, 0x8F, 0x44, 0x02, 0xE3, 0xA2,
+    0x2F, 0xBF, 0xE3, 0xB1, 0x5C, 0xD3, 0x2F, 0x05, 0xCE, 0x0C, 0xCB, 0xD0, 0x4A, 0x2E, 0xE1, 0x55,
+    0x2B, 0xAD, 0x7D, 0x92, 0x69, 0xE7, 0xAF, 0x80, 0xF9, 0x3D, 0x4A, 0xC6, 0x0A, 0xC7, 0xC2, 0xA9,
+    0x46, 0x2F, 0x59, 0xF0, 0xC2, 0x0D, 0xAE, 0x31, 0xE2, 0xD1, 0x53, 0xFD, 0x41, 0xD0, 0xC2, 0x46,
+    0xCF, 0x00, 0x8C, 0xCB, 0x54, 0xDD, 0x99, 0x48, 0x4D, 0xBB, 0x4B, 0x93, 0xC9, 0xD1, 0xB4, 0x7B,
+    0x3D, 0xA6, 0xDD, 0x26, 0xBC, 0xE6, 0xBE, 0x78, 0x44, 0x95, 0x71, 0x04, 0xF6, 0x7B, 0x71, 0x27,
+    0x3C, 0xBA, 0x2C, 0xB5, 0xDB, 0x5C, 0x2F, 0x36, 0xD3, 0x7D, 0x24, 0x45, 0x6A, 0x29, 0xC2, 0xD9,
+    0xFE, 0xFD, 0x17, 0xED, 0x1E, 0x8F, 0x9F, 0xD9, 0xFF, 0xE8, 0xFA, 0x13, 0x9D, 0x55, 0xB1, 0x6E,
+    0xD4, 0x40, 0x10, 0x9D, 0xB3, 0x45, 0x8C, 0x70, 0xE1, 0x86, 0x8E, 0xC2, 0x2D, 0xA2, 0xF1, 0x27,
+    0xEC, 0x51, 0x53, 0x40, 0x41, 0x48, 0x49, 0x85, 0x04, 0x55, 0xFE, 0x20, 0x3E, 0x41, 0x49, 0x93,
+    0x8F, 0xA0, 0xCA, 0x3F, 0x20, 0x5B, 0xA2, 0xA0, 0x35, 0xA2, 0xA0, 0x75, 0x01, 0xBD, 0x41, 0x2E,
+    0x1C, 0xB2, 0xEB, 0xE1, 0xBD, 0xD9, 0x3B, 0x5F, 0x12, 0x21, 0x85, 0x70, 0xF2, 0x8D, 0x2F, 0xEB,
+    0xE7, 0xD9, 0xF7, 0xDE, 0xCC, 0x6C, 0x44, 0xE4, 0x70, 0x2D, 0x22, 0x95, 0x4E, 0x22, 0x89, 0xAA,
+    0xAE, 0xA5, 0x40, 0xEC, 0xC4, 0xCD, 0x2F, 0x74, 0x10, 0x5C, 0xF5, 0x94, 0x68, 0x2B, 0xCE, 0xA7,
+    0x78, 0x54, 0xFA, 0x5C, 0x45, 0xCA, 0x50, 0x04, 0x91, 0x22, 0x94, 0x9E, 0xB1, 0xF2, 0x5C, 0x71,
+    0x78, 0xBD, 0xF4, 0x8C, 0x95, 0x45, 0x37, 0x59, 0x1C, 0x19, 0x9B, 0xC1, 0x01, 0xA3, 0x5D, 0x15,
+    0x24, 0xD5, 0xB6, 0x50, 0xEC, 0x20, 0xB9, 0xFE, 0x68, 0xF8, 0xA7, 0x62, 0x07, 0x41, 0xDC, 0xE0,
+    0x75, 0x52, 0x10, 0xB9, 0xCF, 0x40, 0x0E, 0x58, 0xCC, 0xED, 0xD6, 0xAD, 0xE2, 0x0D, 0xF0, 0xC3,
+    0x23, 0xB0, 0x58, 0x01, 0x0D, 0x4A, 0xD2, 0x80, 0x25, 0xDE, 0xC6, 0xB7, 0x20, 0x13, 0x2F, 0xD9,
+    0x2C, 0xFC, 0x26, 0x86, 0x59, 0x5F, 0xC3, 0x94, 0x53, 0xC4, 0x84, 0x05, 0x93, 0x6C, 0x31, 0x94,
+    0x77, 0x05, 0x93, 0x47, 0x4C, 0xAA, 0xB2, 0xC3, 0x64, 0x7A, 0x9E, 0xE8, 0x0C, 0xD6, 0xFA, 0x0E,
+    0x44, 0x40, 0xFB, 0x8B, 0x11, 0x97, 0x3B, 0x87, 0xE6, 0x9D, 0xF6, 0x40, 0x70, 0xA5, 0xB2, 0xF8,
+    0x4A, 0xDF, 0x72, 0x25, 0xD0, 0xB8, 0x6A, 0x60, 0x1A, 0xC8, 0xF6, 0xCC, 0x67, 0x7B, 0x90, 0x7F,
+    0xDD, 0x61, 0x21, 0x51, 0x01, 0xAE, 0x08, 0xC7, 0xE0, 0xED, 0x28, 0x10, 0x42, 0xC1, 0x20, 0xD7,
+    0x0F, 0x62, 0x74, 0xC4, 0xB8, 0x89, 0xA4, 0x33, 0x7F, 0x96, 0x66, 0x0F, 0x04, 0x6D, 0xAD, 0x42,
+    0xB5, 0x46, 0x73, 0x8A, 0x10, 0x94, 0x11, 0xDF, 0x07, 0x3A, 0xAF, 0x99, 0x69, 0x94, 0x5A, 0xD5,
+    0x4B, 0x33, 0x3F, 0x56, 0xA9, 0x47, 0xA9, 0x5A, 0x24, 0xCB, 0x7B, 0x37, 0x4A, 0x3A, 0x30, 0xCB,
+    0x33, 0xD6, 0xCF, 0xE4, 0x99, 0x97, 0x48, 0xDA, 0x73, 0x43, 0xE6, 0x2F, 0x66, 0x7B, 0xC2, 0x45,
+    0x13, 0xC8, 0xEA, 0xDE, 0xCD, 0xB1, 0x45, 0x29, 0x1A, 0xE4, 0xB8, 0x75, 0x14, 0x18, 0xCB, 0xE6,
+    0x28, 0x7B, 0x65, 0xA5, 0x93, 0xE7, 0xD1, 0x06, 0xD5, 0x4F, 0x0C, 0x9E, 0x28, 0xFD, 0x7C, 0xFE,
+    0x32, 0x1C, 0x4D, 0x0D, 0x24, 0xB8, 0x27, 0x7D, 0x39, 0xA5, 0xC3, 0x47, 0x98, 0x79, 0x92, 0x6C,
+    0xDC, 0x70, 0xB0, 0x89, 0x9B, 0x8B, 0xE3, 0xBE, 0xD9, 0xBC, 0xE8, 0x62, 0x1D, 0xB7, 0x9A, 0x4D,
+    0x2D, 0xDD, 0x47, 0xE2, 0x71, 0xC7, 0x36, 0x9A, 0x62, 0x2F, 0x1C, 0xE8, 0xB9, 0x59, 0xC0, 0xC2,
+    0xE9, 0x6C, 0x9E, 0x84, 0x54, 0x43, 0xA5, 0x3E, 0x53, 0x5F, 0x6A, 0xBF, 0xD2, 0x31, 0x01, 0xB5,
+    0x06, 0xAD, 0x82, 0x8B, 0x49, 0x53, 0x24, 0x6F, 0xDA, 0x0C, 0x79, 0x61, 0x3E, 0x5F, 0xEB, 0x2B,
+    0x6C, 0x54, 0x0D, 0x35, 0x7B, 0x6F, 0x60, 0xFA, 0xE2, 0x17, 0xF7, 0x2F, 0x2E, 0xB8, 0x75, 0x66,
+    0xF2, 0xD3, 0xE8, 0xBF, 0x69, 0x4C, 0x8C, 0x01, 0xB3, 0xC8, 0xC3, 0x9C, 0x94, 0x4E, 0x8C, 0x73,
+    0x13, 0x1D, 0x0C, 0x8B, 0x1E, 0x59, 0x49, 0xFC, 0xDC, 0x3B, 0x3B, 0x33, 0x5E, 0x64, 0x97, 0xC7,
+    0xE6, 0x36, 0x2C, 0x7B, 0x53, 0x56, 0x0D, 0x6B, 0x65, 0xFD, 0xB2, 0xD2, 0x0B, 0x6D, 0x40, 0x3B,
+    0xC5, 0x5C, 0x15, 0x3E, 0xC3, 0xA4, 0x55, 0x23, 0xA3, 0x1B, 0x72, 0xC6, 0xBE, 0x98, 0x2C, 0x8E,
+    0xE9, 0xEC, 0x86, 0x12, 0x6B, 0x6E, 0xA8, 0x86, 0x6A, 0xC2, 0xCC, 0xF5, 0x4D, 0x6F, 0x83, 0xB2,
+    0xE1, 0xE0, 0x4E, 0x2C, 0xFF, 0x6F, 0xFA, 0xD5, 0xB4, 0x7B, 0x17, 0x95, 0x74, 0x9D, 0xC5, 0x47,
+    0x67, 0x1F, 0xAC, 0x4A, 0xBE, 0x00, 0x16, 0xB5, 0xAB, 0xB5, 0x4B, 0x50, 0xD3, 0xFA, 0xDC, 0xEA,
+    0x4F, 0x4E, 0xE8, 0xD2, 0x91, 0x3A, 0x37, 0xCD, 0x9A, 0xA2, 0x73, 0x52, 0xCE, 0x03, 0xFD, 0x91,
+    0x22, 0xF2, 0xAF, 0x62, 0xB3, 0x39, 0xAB, 0x13, 0x46, 0x5A, 0x4C, 0x9A, 0xAD, 0x35, 0x56, 0xAB,
+    0xEC, 0xC2, 0x5C, 0xAA, 0xDF, 0xD3, 0x8F, 0xCC, 0x5B, 0x41, 0x5D, 0x8B, 0xCE, 0x93, 0x14, 0x5B,
+    0xD1, 0xF5, 0x8E, 0xAF, 0xE5, 0x7A, 0x9A, 0xE9, 0x77, 0xB0, 0xE8, 0xA0, 0x1F, 0xA3, 0x93, 0x59,
+    0x1B, 0x15, 0x3A, 0x63, 0xC2, 0xD6, 0x71, 0xCA, 0x5A, 0xB6, 0x56, 0xA3, 0xA7, 0xAC, 0x3C, 0x8B,
+    0x7F, 0x69, 0xEA, 0xEB, 0xDE, 0x3A, 0x81, 0x7D, 0xC1, 0x69, 0xF5, 0xCB, 0xB4, 0x2E, 0x53, 0xDF,
+    0x5E, 0xC3, 0x14, 0xFE, 0xF2, 0x44, 0x5B, 0xD3, 0x03, 0x57, 0x77, 0x7B, 0xCC, 0xF4, 0x17, 0x0C,
+    0x67, 0x1A, 0x55, 0x8A, 0xA7, 0x50, 0x9F, 0xDA, 0xCD, 0x6C, 0x88, 0x5D, 0x40, 0x07, 0xE2, 0xCD,
+    0xAD, 0xED, 0x56, 0xC6, 0x49, 0xCC, 0xAC, 0x0B, 0x24, 0x19, 0xE2, 0xC3, 0xD7, 0xB0, 0x43, 0xC7,
+    0x1A, 0x45, 0xE6, 0x74, 0x7C, 0xD3, 0x90, 0x69, 0x00, 0x51, 0xEC, 0x91, 0x1B, 0x31, 0x30, 0xC0,
+    0x05, 0x3A, 0xBA, 0xC1, 0xA0, 0x83, 0x01, 0x5A, 0x1F, 0x94, 0xEA, 0xB8, 0xD6, 0x9B, 0x7C, 0xEE,
+    0x9B, 0xD9, 0x19, 0x98, 0xD9, 0x19, 0x2D, 0x6F, 0x9E, 0xFA, 0x65, 0x1E, 0xE2, 0x0C, 0xE7, 0x41,
+    0xAE, 0x9E, 0x1A, 0xC7, 0x18, 0x4F, 0xC2, 0x3B, 0x1B, 0x4D, 0xAB, 0x21, 0x06, 0xF3, 0x6B, 0x34,
+    0xB8, 0xD2, 0x9F, 0x66, 0xF1, 0x9C, 0xE9, 0x58, 0xD1, 0xE4, 0x80, 0x57, 0x93, 0x68, 0x21, 0xBC,
+    0x88, 0x26, 0xE2, 0xAC, 0x74, 0x66, 0x23, 0x1E, 0x94, 0xD1, 0x24, 0x6D, 0xED, 0x70, 0xDC, 0xA3,
+    0xE5, 0x06, 0xB4, 0x8F, 0xE8, 0x3E, 0xDA, 0x4A, 0x6D, 0xD1, 0xFC, 0x7F, 0x43, 0x8F, 0xB2, 0x2B,
+    0x83, 0xA2, 0x55, 0x63, 0x21, 0xC0, 0x3B, 0xDD, 0xFE, 0xE8, 0x6F, 0x10, 0x35, 0xFF, 0xA7, 0xA8,
+    0xF5, 0x2D, 0x45, 0x8D, 0xDB, 0xFF, 0x23, 0xB7, 0x17, 0xB5, 0xEB, 0xAE, 0xED, 0xA9, 0xBA, 0xEF,
+    0xB0, 0x7D, 0x8F, 0x2D, 0x5D, 0xB6, 0xF4, 0xD9, 0xD2, 0x69, 0x4B, 0xAF, 0xED, 0xBB, 0x0D, 0x87,
+    0x93, 0xDC, 0xE2, 0xF3, 0x07, 0xBD, 0x54, 0xBD, 0x8E, 0xE6, 0x34, 0x14, 0xBD, 0x49, 0x76, 0x26,
+    0x12, 0x29, 0x4C, 0xC1, 0x4A, 0x68, 0x11, 0x4A, 0x8F, 0x90, 0xFC, 0x04, 0xC8, 0x59, 0x28, 0xA6,
+    0x9D, 0x62, 0x16, 0xB4, 0x15, 0x35, 0x3D, 0x35, 0xC9, 0x88, 0x17, 0x98, 0x37, 0x80, 0x82, 0x86,
+    0x8A, 0x37, 0x18, 0x47, 0xA2, 0xA0, 0xC4, 0x08, 0x51, 0x13, 0x24, 0x76, 0x1A, 0x1A, 0x23, 0x65,
+    0x57, 0xF9, 0x58, 0xC7, 0x97, 0x73, 0xFC, 0xCD, 0x0F, 0x05, 0x05, 0x15, 0x9F, 0xB4, 0x1E, 0xAF,
+    0x1D, 0xDF, 0x7B, 0xEE, 0x39, 0xE7, 0x5E, 0xAB, 0xAA, 0x62, 0xB0, 0xCC, 0x0D, 0x96, 0xA9, 0xDA,
+    0xCF, 0xB2, 0x88, 0xAF, 0x74, 0x10, 0x3B, 0xF9, 0x59, 0xBA, 0xD9, 0x45, 0x91, 0xAF, 0xCD, 0x26,
+    0x22, 0xED, 0x8E, 0xA5, 0xD6, 0x73, 0xAC, 0x5E, 0x0F, 0x22, 0x4E, 0x75, 0x11, 0x93, 0x7D, 0xC6,
+    0x4D, 0xA5, 0xA1, 0x56, 0xB1, 0xAB, 0xE8, 0xDC, 0x66, 0x71, 0x4B, 0xA5, 0x13, 0xDE, 0xF8, 0x80,
+    0x37, 0x2E, 0xE2, 0x66, 0x5C, 0x5B, 0x84, 0xDF, 0x3A, 0x2C, 0x2B, 0x13, 0x5D, 0xC9, 0xF1, 0x87,
+    0xCC, 0x22, 0x38, 0x43, 0xC4, 0x24, 0xF8, 0x64, 0xAE, 0x00, 0x42, 0x3A, 0x45, 0x3E, 0xB7, 0x88,
+    0x34, 0xB8, 0x25, 0x16, 0x31, 0x49, 0xA4, 0xC3, 0x3F, 0x19, 0x71, 0x4A, 0x48, 0x35, 0x4F, 0xF1,
+    0x69, 0xB9, 0x29, 0xC8, 0x78, 0xDA, 0xBF, 0xC4, 0x46, 0x67, 0x02, 0xDC, 0x04, 0x40, 0x10, 0x40,
+    0x33, 0x61, 0x89, 0x39, 0xF8, 0xBD, 0xDC, 0x8C, 0xA1, 0x4F, 0x0C, 0x0B, 0x50, 0x2E, 0xF6, 0x5B,
+    0x09, 0xE0, 0xC3, 0x31, 0x6C, 0xAD, 0xB7, 0x61, 0x4D, 0xBA, 0x0D, 0x3B, 0x2E, 0x0C, 0x6B, 0x63,
+    0xAB, 0xA8, 0x88, 0x00, 0x35, 0x5A, 0x80, 0xF7, 0xD8, 0x34, 0x77, 0x9C, 0xF5, 0x48, 0xF1, 0xF0,
+    0x2B, 0x15, 0xA1, 0xCE, 0x59, 0x4A, 0x29, 0xD2, 0xF0, 0xB2, 0xD4, 0x20, 0xE0, 0xF3, 0x08, 0x53,
+    0x1E, 0xF8, 0xAC, 0x0A, 0x15, 0x5E, 0xF7, 0xC2, 0x67, 0x24, 0x9F, 0xCA, 0x1B, 0x5D, 0x00, 0x10,
+    0x20, 0x98, 0x83, 0x6F, 0x74, 0xC6, 0x1B, 0xB7, 0xE0, 0xC6, 0x92, 0x4F, 0xBB, 0xFD, 0x3B, 0x9F,
+    0xF2, 0x18, 0xF2, 0x9C, 0xAA, 0x06, 0x56, 0xAE, 0x84, 0x80, 0x98, 0x7E, 0xB0, 0xD0, 0x64, 0xA8,
+    0x11, 0x63, 0x16, 0xB7, 0xD6, 0x01, 0x59, 0x8A, 0x94, 0xC4, 0x33, 0x12, 0x4F, 0x5F, 0xC8, 0x57,
+    0x1C, 0x11, 0xB3, 0x52, 0xD8, 0x13, 0x7C, 0x29, 0x47, 0x7A, 0xA5, 0xCB, 0x72, 0x85, 0x80, 0x4F,
+    0x13, 0x96, 0x59, 0x19, 0xC8, 0x1D, 0xDE, 0xD1, 0x50, 0x6C, 0x23, 0xE5, 0x49, 0x5B, 0x38, 0xA8,
+    0xCE, 0xEF, 0x69, 0x78, 0x46, 0xD1, 0x70, 0xD8, 0x53, 0x4A, 0xAB, 0x3B, 0x91, 0x0C, 0xF8, 0xDF,
+    0x4A, 0xC8, 0x81, 0x1C, 0x5B, 0xFD, 0x18, 0xD8, 0xC0, 0xCC, 0xB8, 0xC2, 0x1E, 0xD4, 0x03, 0xE7,
+    0x6E, 0x43, 0x8A, 0x1A, 0x01, 0x2D, 0x73, 0x51, 0x27, 0x40, 0x6B, 0x72, 0x7B, 0xDC, 0xB4, 0x3B,
+    0x90, 0x10, 0x12, 0x82, 0xEC, 0xE5, 0x04, 0x10, 0xD2, 0x3F, 0x36, 0x76, 0x13, 0xB3, 0xF6, 0xDC,
+    0xAC, 0xD2, 0xAF, 0xC4, 0x0E, 0xEA, 0x6C, 0xE4, 0x06, 0x75, 0xBA, 0x68, 0xF0, 0x8A, 0x59, 0x16,
+    0x10, 0xC0, 0x2C, 0x63, 0x68, 0x75, 0xE8, 0x94, 0xD2, 0x34, 0xFA, 0x02, 0x0E, 0x39, 0xD5, 0x8D,
+    0x48, 0x57, 0x42, 0x96, 0x91, 0x95, 0x39, 0x65, 0xBA, 0xC3, 0x1D, 0xBD, 0x65, 0xAD, 0x3C, 0x0B,
+    0x27, 0x59, 0x5B, 0xA1, 0x18, 0xA0, 0xDC, 0x81, 0x60, 0xBB, 0x5C, 0x6C, 0x8B, 0x26, 0x20, 0xBC,
+    0x8D, 0x8A, 0xB3, 0x13, 0x8E, 0x10, 0xE9, 0x06, 0x5D, 0x0C, 0x58, 0x6D, 0xF5, 0x86, 0x86, 0xE8,
+    0x29, 0x4E, 0xD1, 0x9D, 0x6E, 0xF8, 0xCB, 0x2F, 0x34, 0x6F, 0x71, 0x85, 0x0D, 0x23, 0xB4, 0x69,
+    0x52, 0xB1, 0xBC, 0x1E, 0x7D, 0xBB, 0xC0, 0x00, 0xAD, 0x26, 0x5A, 0x09, 0x16, 0xF1, 0x19, 0xB8,
+    0xE7, 0x51, 0x69, 0x8A, 0x8E, 0xD4, 0xDE, 0x51, 0xFF, 0x19, 0x44, 0x68, 0xF5, 0x47, 0x94, 0x5D,
+    0xA4, 0x7F, 0xAD, 0x01, 0x08, 0x50, 0x5E, 0x06, 0x98, 0x8E, 0x20, 0x10, 0x46, 0xA5, 0x8F, 0x15,
+    0x4C, 0x14, 0xE9, 0xAD, 0xA5, 0x34, 0x2C, 0x98, 0x71, 0x8B, 0xE5, 0x72, 0x9D, 0xDE, 0x77, 0xAF,
+    0x0E, 0x9A, 0xAC, 0xFE, 0xA6, 0x5B, 0xAF, 0x97, 0xBA, 0xA0, 0xAA, 0x92, 0xE0, 0xCD, 0x7B, 0x75,
+    0x61, 0x21, 0x50, 0x35, 0x81, 0x82, 0x9D, 0xE6, 0x8D, 0x28, 0x65, 0x47, 0xA5, 0x2F, 0x50, 0xD3,
+    0x5A, 0x10, 0x83, 0x8A, 0x52, 0xDA, 0xD3, 0x0B, 0xA9, 0xD3, 0x08, 0x79, 0xFE, 0x00, 0x8D, 0xBE,
+    0x98, 0x35, 0x8C, 0x94, 0x01, 0xD8, 0x17, 0xB6, 0x1B, 0xBA, 0x1A, 0xF4, 0xD8, 0x08, 0xDA, 0x74,
+    0xD2, 0xA9, 0x4D, 0x00, 0x4A, 0xC1, 0x50, 0xA6, 0xDD, 0x20, 0xA7, 0xA3, 0x06, 0x2C, 0x53, 0x46,
+    0x3A, 0xEC, 0xA4, 0xA4, 0x7F, 0x72, 0xCE, 0xAC, 0x14, 0x20, 0xD6, 0xF9, 0x2C, 0x55, 0x08, 0x27,
+    0x28, 0x62, 0xF6, 0x20, 0xCE, 0x5D, 0xFA, 0x00, 0x62, 0x7F, 0xA7, 0xCF, 0x3E, 0xCA, 0xC3, 0xB8,
+    0x20, 0xC5, 0xE6, 0xE6, 0x3A, 0x83, 0x78, 0x18, 0x0A, 0x64, 0x40, 0xD6, 0xD9, 0x30, 0xAC, 0x67,
+    0x44, 0xF2, 0x76, 0xF2, 0x0D, 0x63, 0x21, 0x57, 0xAE, 0xF5, 0xBB, 0x64, 0x82, 0x89, 0x6F, 0x0B,
+    0x04, 0xA0, 0xEB, 0x3C, 0x6B, 0xC3, 0x6E, 0x11, 0xBF, 0x51, 0x5E, 0xEA, 0x7B, 0x09, 0xFE, 0xCE,
+    0xF6, 0x7A, 0x47, 0x90, 0xC5, 0x72, 0xBE, 0x20, 0x56, 0xC5, 0x06, 0xAF, 0xAE, 0x07, 0xFA, 0x61,
+    0x28, 0xFD, 0x6C, 0x7E, 0xC1, 0xDB, 0x50, 0xDF, 0xCD, 0xA8, 0xD2, 0xFD, 0x6D, 0x19, 0x61, 0x41,
+    0xEC, 0xEB, 0x9D, 0xFA, 0x04, 0xFA, 0x18, 0x23, 0x07, 0xFD, 0x14, 0xDA, 0x04, 0x61, 0xC6, 0x99,
+    0x68, 0x2D, 0xDA, 0xFD, 0xCB, 0x2C, 0x26, 0x72, 0x8E, 0x36, 0x54, 0xC7, 0x2D, 0x0D, 0x87, 0x16,
+    0x38, 0x59, 0x79, 0x56, 0x2C, 0x99, 0x69, 0xA0, 0xE1, 0x9E, 0x12, 0x36, 0xD7, 0x8C, 0x2A, 0x26,
+    0x7B, 0xA3, 0xD5, 0xDE, 0x24, 0xB3, 0xF4, 0x8B, 0x47, 0xC5, 0x5B, 0xB7, 0xF6, 0x3F, 0xE9, 0xE0,
+    0x3D, 0xA8, 0x47, 0x4C, 0xBC, 0x70, 0x41, 0xAE, 0x74, 0xE8, 0xBF, 0xD7, 0x4F, 0xD0, 0x57, 0x1A,
+    0xD9, 0xA5, 0xDD, 0x5D, 0x05, 0xA7, 0x57, 0x72, 0x21, 0x4F, 0x50, 0xEF, 0xEC, 0x26, 0x0B, 0x11,
+    0xF6, 0x06, 0x0D, 0x1B, 0x46, 0x8D, 0x63, 0xAD, 0xA9, 0xBB, 0xD1, 0x2E, 0x8E, 0x1F, 0x4E, 0x9F,
+    0x9B, 0x98, 0x4D, 0x60, 0x49, 0xEE, 0x67, 0x0E, 0xB2, 0x4E, 0x93, 0x97, 0x32, 0xC5, 0x7E, 0x8D,
+    0xC7, 0x09, 0x58, 0x06, 0xA2, 0x3A, 0x36, 0xBA, 0xF4, 0x3F, 0x64, 0x5A, 0xBA, 0x59, 0xFD, 0x57,
+    0xE1, 0x51, 0x25, 0xD7, 0xE6, 0x4F, 0xAD, 0x97, 0x0F, 0xC6, 0x79, 0x37, 0x39, 0x77, 0x1A, 0xFB,
+    0x19, 0x72, 0xF8, 0xBD, 0x4E, 0xAD, 0x46, 0x3A, 0x11, 0xB2, 0xA3, 0xA4, 0x4A, 0x8A, 0xDB, 0xAA,
+    0x6F, 0x39, 0x3C, 0x60, 0x0D, 0xDD, 0xEA, 0xFC, 0x69, 0x6A, 0x62, 0x93, 0xAA, 0xA9, 0xE1, 0x68,
+    0xE6, 0x54, 0x59, 0x4A, 0x39, 0x06, 0x59, 0xDE, 0x00, 0xD5, 0xC2, 0xCE, 0x32, 0x5B, 0x8F, 0xBF,
+    0xC0, 0x1E, 0x1D, 0x9C, 0x0F, 0x8A, 0x87, 0x16, 0xCD, 0x2C, 0x6F, 0x21, 0xD6, 0x73, 0xA9, 0x2E,
+    0x40, 0x18, 0x6E, 0xC1, 0x51, 0x7C, 0x8F, 0x0B, 0x08, 0xA5, 0xEF, 0xC0, 0x08, 0xBA, 0x61, 0x84,
+    0x47, 0x38, 0x07, 0x60, 0x26, 0xD8, 0x10, 0xFE, 0xEB, 0x48, 0xB9, 0x41, 0xFD, 0x50, 0xA2, 0x67,
+    0xCB, 0x7C, 0xA1, 0xEF, 0xF6, 0xAF, 0x92, 0xE6, 0x5E, 0xA3, 0x26, 0xB0, 0x8D, 0x61, 0x96, 0x65,
+    0x9C, 0x60, 0xA1, 0x47, 0x0F, 0xF3, 0x1F, 0x73, 0x21, 0x56, 0x41, 0xDA, 0xD8, 0x60, 0xD9, 0xFA,
+    0x99, 0x83, 0x98, 0x63, 0x9E, 0x44, 0x3D, 0x1E, 0x6E, 0x3F, 0xFA, 0x9F, 0xB0, 0xFC, 0x87, 0xDF,
+    0xDF, 0xB5, 0x55, 0x31, 0x8F, 0xD6, 0x46, 0x10, 0x1D, 0x7B, 0xB9, 0x58, 0xC1, 0xC5, 0x52, 0x80,
+    0x44, 0x88, 0x94, 0xED, 0xAF, 0x71, 0x9B, 0x22, 0xD2, 0x5A, 0x47, 0x41, 0x91, 0x82, 0x2B, 0x72,
+    0x12, 0xA9, 0xD2, 0x50, 0x84, 0x8A, 0x5F, 0x40, 0xD6, 0x88, 0x2E, 0x0D, 0x45, 0xFE, 0x40, 0xA4,
+    0x84, 0x26, 0x0D, 0x3D, 0x0A, 0xAC, 0xC5, 0x49, 0x89, 0x94, 0x14, 0x67, 0x85, 0x32, 0x45, 0x7C,
+    0x40, 0x97, 0xE2, 0x5B, 0xC2, 0xE6, 0x58, 0x72, 0x6B, 0x4F, 0xDE, 0xEC, 0x77, 0x42, 0xCA, 0x0F,
+    0xC8, 0x77, 0xC2, 0x36, 0xEB, 0xDD, 0x99, 0x37, 0xEF, 0xBD, 0x19, 0xD3, 0x97, 0x74, 0xBE, 0xE6,
+    0xB9, 0xCD, 0xBC, 0x2A, 0xFE, 0xC5, 0xCF, 0x9C, 0xEB, 0xC5, 0x1E, 0xF7, 0xF6, 0xD7, 0x40, 0x2A,
+    0x65, 0x22, 0xE7, 0x88, 0xDA, 0xD3, 0x40, 0xC4, 0xDC, 0x93, 0xE6, 0x4C, 0x15, 0x77, 0x13, 0x99,
+    0x57, 0x2B, 0xD5, 0xAB, 0x8E, 0x1F, 0xDB, 0xD9, 0x6F, 0x0E, 0x17, 0xC5, 0xD1, 0x8D, 0xDD, 0xDA,
+    0x26, 0xC2, 0x26, 0xAA, 0x48, 0x7E, 0x57, 0x1E, 0xE0, 0xE2, 0x79, 0x94, 0x93, 0x38, 0xEE, 0x37,
+    0x91, 0xC8, 0x5E, 0x45, 0xC4, 0xEE, 0x2E, 0x13, 0xE9, 0xD1, 0x0F, 0xD4, 0x04, 0x3B, 0x91, 0x8A,
+    0x1A, 0xAF, 0x73, 0x93, 0xB0, 0x47, 0x2D, 0xD8, 0xD3, 0xE3, 0xB5, 0x19, 0xDD, 0x78, 0x4E, 0xCF,
+    0x5D, 0x38, 0xDC, 0x84, 0x76, 0x8D, 0x9C, 0x14, 0x67, 0x9B, 0x89, 0x17, 0x9D, 0xC8, 0x24, 0xBA,
+    0x40, 0xB4, 0x8F, 0x3C, 0xB7, 0x88, 0x6E, 0xF5, 0xC4, 0x2B, 0x70, 0xF5, 0x2D, 0x2F, 0x04, 0x74,
+    0x97, 0x38, 0x35, 0x3C, 0x93, 0xE2, 0x60, 0x7D, 0x4F, 0xE6, 0xE1, 0xD3, 0x13, 0x64, 0xBC, 0xE3,
+    0xF4, 0x51, 0xA0, 0xFA, 0xEF, 0xE5, 0x8E, 0x1D, 0x48, 0x1F, 0xBE, 0x79, 0x25, 0x69, 0x34, 0x5F,
+    0x8B, 0x54, 0x25, 0x9B, 0xBB, 0x91, 0xDA, 0x89, 0x27, 0x64, 0xB5, 0x8A, 0x15, 0x0A, 0xCC, 0x3A,
+    0xE9, 0xE3, 0xC3, 0xCD, 0x64, 0x47, 0xBB, 0xD1, 0x4C, 0x5C, 0x71, 0xB2, 0x51, 0x45, 0xC5, 0x23,
+    0xF7, 0x3B, 0xBD, 0x8E, 0x92, 0x9B, 0xCE, 0xE1, 0xDF, 0x4D, 0xDA, 0xE9, 0x3D, 0x50, 0xDD, 0xE7,
+    0xA0, 0xD6, 0x5D, 0x1E, 0x75, 0xAC, 0x57, 0x72, 0x72, 0x63, 0xB2, 0x93, 0x4E, 0x15, 0x1F, 0xB8,
+    0xA9, 0x65, 0xC6, 0xFF, 0x18, 0xD8, 0xF8, 0x07, 0x3F, 0x37, 0xB8, 0xF5, 0x26, 0x20, 0x8D, 0x1F,
+    0x4D, 0xF8, 0x66, 0x05, 0x2F, 0xF7, 0xB1, 0x7D, 0x71, 0x63, 0xCB, 0xCF, 0x51, 0x08, 0x58, 0xA0,
+    0x9D, 0x42, 0x5F, 0x0F, 0xA6, 0x41, 0x32, 0xC8, 0x53, 0xBC, 0x59, 0x6A, 0xA0, 0x00, 0x6F, 0x36,
+    0xF0, 0xD0, 0x66, 0x3B, 0xD5, 0xDC, 0x05, 0xF2, 0x47, 0x99, 0xEC, 0x0B, 0x1C, 0x8A, 0x3C, 0x34,
+    0xD9, 0xCE, 0x6A, 0xD5, 0xB9, 0xE6, 0x9A, 0xF7, 0xB8, 0x77, 0x2C, 0x8C, 0x40, 0x0C, 0xB7, 0x52,
+    0xE1, 0x0A, 0x58, 0x6F, 0x91, 0x4F, 0x66, 0xD1, 0xFC, 0x9C, 0xF3, 0x2E, 0x3F, 0xE4, 0x50, 0xAF,
+    0xC9, 0x8F, 0xBA, 0x44, 0xCD, 0x2D, 0xB0, 0x8E, 0x76, 0x6A, 0x57, 0x92, 0x1C, 0x02, 0x72, 0xE8,
+    0xE6, 0x66, 0x29, 0x58, 0x9B, 0x2D, 0xD6, 0x43, 0xC1, 0x7A, 0x1D, 0x2C, 0x64, 0xC1, 0xFA, 0xDB,
+    0x2A, 0x3A, 0x6C, 0xB1, 0x56, 0x37, 0xAB, 0xEF, 0xC9, 0xF0, 0x55, 0x10, 0xC0, 0xCF, 0x38, 0xD6,
+    0x0F, 0xDF, 0x00, 0x38, 0x2C, 0x01, 0xED, 0x39, 0x00, 0xA7, 0x8B, 0x6D, 0xC6, 0x6E, 0xC5, 0xD4,
+    0x4A, 0x60, 0xB5, 0x82, 0x1C, 0xE4, 0x31, 0x41, 0xB8, 0x4A, 0x54, 0x12, 0xE9, 0x88, 0x65, 0x05,
+    0x0B, 0xA2, 0x6A, 0xF0, 0x05, 0xE3, 0x88, 0x1E, 0x88, 0x83, 0x37, 0x17, 0x89, 0xC0, 0x17, 0xF2,
+    0xB0, 0x10, 0xE3, 0xE1, 0x28, 0xB2, 0xB1, 0x98, 0x2B, 0xC8, 0x1E, 0xBC, 0xDA, 0x39, 0x38, 0xA0,
+    0x33, 0xD2, 0x34, 0x8F, 0x88, 0x30, 0x74, 0xBC, 0x56, 0xBC, 0x17, 0x20, 0x56, 0x8F, 0x03, 0xE2,
+    0x2B, 0x13, 0xCA, 0x59, 0x25, 0x21, 0x81, 0xDC, 0x06, 0x1A, 0x78, 0x34, 0x57, 0xF9, 0xCF, 0xA5,
+    0x01, 0xC7, 0x1A, 0xA9, 0x5A, 0x1E, 0xA8, 0x12, 0xFF, 0xDE, 0x04, 0x5B, 0x1F, 0x90, 0x8F, 0x26,
+    0xB7, 0x2C, 0x7C, 0x05, 0x5E, 0x76, 0xF9, 0x36, 0xFF, 0xC1, 0x09, 0x9C, 0xF1, 0x63, 0x3B, 0x6B,
+    0x14, 0x3B, 0x71, 0x6F, 0x93, 0x5E, 0x9A, 0x0C, 0xE6, 0x5C, 0x30, 0xA1, 0x85, 0x46, 0x3D, 0x0F,
+    0x36, 0xE8, 0x8C, 0x74, 0x78, 0x98, 0x84, 0x3A, 0x60, 0x16, 0xF2, 0x5A, 0x59, 0xF3, 0x03, 0x4E,
+    0xC6, 0xEF, 0x84, 0x55, 0xBB, 0x39, 0x8A, 0xF2, 0x72, 0x75, 0x78, 0xD9, 0xF0, 0x5F, 0xE0, 0xB6,
+    0xD7, 0x4B, 0xA9, 0xA1, 0x74, 0xCF, 0x0D, 0xBA, 0x02, 0xB4, 0x01, 0x4B, 0x86, 0x07, 0x37, 0x57,
+    0x3E, 0x83, 0x19, 0xD0, 0xD5, 0xC1, 0xDA, 0x0B, 0x4C, 0x06, 0x06, 0xC1, 0x61, 0xBD, 0x0A, 0x2F,
+    0x66, 0x76, 0x03, 0x9A, 0xAC, 0x45, 0x7D, 0x3A, 0x88, 0xDC, 0x6C, 0x40, 0x91, 0x7E, 0x2D, 0xF2,
+    0x30, 0xBA, 0x17, 0x75, 0x4D, 0xC2, 0x56, 0x2A, 0x8F, 0x12, 0x5D, 0x9A, 0x12, 0xBC, 0xE2, 0x52,
+    0x97, 0x9C, 0xAE, 0x27, 0x35, 0xDD, 0xC6, 0x26, 0xC7, 0x51, 0xF6, 0xC8, 0xA2, 0x95, 0x48, 0xF4,
+    0x88, 0xCE, 0x7E, 0x97, 0xA8, 0x9C, 0x1E, 0x68, 0x3B, 0x08, 0x48, 0xFF, 0x23, 0x9B, 0x5C, 0x35,
+    0x43, 0x1B, 0x09, 0x4C, 0x66, 0x2A, 0xE2, 0xC8, 0x45, 0xD8, 0x26, 0x90, 0x3A, 0x89, 0x7B, 0xA1,
+    0x91, 0xE5, 0x62, 0xE2, 0x6B, 0xD1, 0xC1, 0x0D, 0xDD, 0xE8, 0xD1, 0x46, 0x9E, 0xF8, 0xD3, 0xAC,
+    0xB2, 0x5A, 0xC1, 0x48, 0xD0, 0x09, 0x84, 0x0C, 0xF6, 0xD9, 0x52, 0x81, 0x1A, 0x9D, 0x1A, 0xD8,
+    0xC5, 0x62, 0x9F, 0x9D, 0xDC, 0xC4, 0x28, 0x9B, 0x5F, 0x64, 0x1F, 0x90, 0xF5, 0xCC, 0x16, 0xC8,
+    0xF3, 0x21, 0x7F, 0x2B, 0x68, 0x82, 0x24, 0xEB, 0xA4, 0x16, 0x12, 0xB0, 0x97, 0x1B, 0x2C, 0x54,
+    0x6F, 0x85, 0x8C, 0x46, 0x4C, 0x01, 0x2B, 0x08, 0xDC, 0xF6, 0x65, 0x29, 0xE0, 0xBD, 0x1E, 0xA2,
+    0xDA, 0x28, 0x36, 0x47, 0x2B, 0x05, 0x03, 0xFD, 0x12, 0x8C, 0xE0, 0x2F, 0xC3, 0x56, 0x42, 0x92,
+    0xE5, 0x02, 0xBA, 0x97, 0x02, 0xE5, 0x98, 0x95, 0xE8, 0xE6, 0x5D, 0x18, 0x2D, 0x5E, 0x6B, 0x5F,
+    0xC3, 0xA3, 0x9B, 0xE0, 0x7F, 0xBA, 0xCB, 0xD1, 0x70, 0x70, 0xB0, 0x74, 0x84, 0x97, 0xDC, 0x4B,
+    0x74, 0x98, 0xC8, 0xF6, 0x39, 0x55, 0x9F, 0x19, 0xC6, 0x84, 0xB0, 0x30, 0x60, 0xD8, 0x95, 0x8B,
+    0x68, 0x3D, 0x4B, 0x53, 0x4D, 0x70, 0x82, 0x1B, 0x21, 0x9D, 0x1F, 0x8B, 0x3D, 0x44, 0xFD, 0xBE,
+    0x15, 0x59, 0x75, 0x84, 0x2A, 0x1A, 0x88, 0x60, 0xD1, 0xAF, 0xF8, 0x23, 0x73, 0x92, 0xF9, 0x09,
+    0xA2, 0x73, 0x36, 0x18, 0x38, 0x19, 0x2D, 0xF9, 0xF8, 0x47, 0xC4, 0xBF, 0x20, 0x50, 0xE8, 0xDD,
+    0xA5, 0x92, 0x4B, 0x2B, 0x12, 0xC2, 0x12, 0xA5, 0x0D, 0x31, 0x8C, 0xF6, 0x78, 0x6A, 0xB2, 0x47,
+    0xF4, 0xAF, 0xD1, 0xD8, 0x51, 0x89, 0xF9, 0xAC, 0xF8, 0x2B, 0x49, 0xDA, 0x1E, 0xA3, 0x28, 0x69,
+    0xF4, 0xF2, 0x86, 0x47, 0x25, 0xE3, 0xC8, 0xA4, 0x52, 0x98, 0xC4, 0xE0, 0xF7, 0x51, 0x2B, 0x86,
+    0x7C, 0x2D, 0x0D, 0x67, 0x64, 0x59, 0x68, 0x96, 0x5E, 0xB8, 0x41, 0xD5, 0x7E, 0xB5, 0xEF, 0x64,
+    0x6A, 0xF9, 0x7B, 0x0C, 0xCF, 0xAA, 0xE5, 0xBC, 0x87, 0xB3, 0x31, 0xB3, 0xE1, 0xEC, 0xC1, 0x8D,
+    0x10, 0x51, 0x0C, 0x69, 0x44, 0xC7, 0x28, 0x59, 0x06, 0x8B, 0xB5, 0x7A, 0xA9, 0xA4, 0x1C, 0xD1,
+    0x16, 0xBB, 0xFC, 0xE8, 0x26, 0xB5, 0x94, 0xEE, 0xD6, 0xC1, 0xC6, 0x2E, 0x93, 0x3B, 0xE4, 0xA7,
+    0xA7, 0xE1, 0x98, 0x1D, 0xFB, 0x2F, 0xF8, 0x67, 0x3E, 0xE1, 0xE4, 0x16, 0xC3, 0xD7, 0x30, 0x8C,
+    0x30, 0xF3, 0x01, 0x7D, 0xC1, 0x7C, 0x3D, 0x57, 0x38, 0xDD, 0x02, 0x30, 0xC2, 0x60, 0x37, 0x5B,
+    0x4C, 0x36, 0xF8, 0x62, 0xB7, 0xDC, 0xC6, 0x33, 0x04, 0xB8, 0x01, 0xDC, 0x50, 0xAD, 0xE5, 0x01,
+    0x99, 0xE5, 0xE1, 0x0C, 0x42, 0x53, 0x4C, 0x46, 0x6D, 0x6A, 0x73, 0x19, 0x32, 0x5A, 0x18, 0x38,
+    0xC3, 0x60, 0x02, 0x87, 0x27, 0xF9, 0x13, 0xF3, 0x86, 0x4F, 0x4F, 0x56, 0x90, 0xFD, 0x3B, 0x3A,
+    0x3D, 0x6E, 0x41, 0x6C, 0xFB, 0xF5, 0x6D, 0xA0, 0x1E, 0x7F, 0xAA, 0xF8, 0x0C, 0xDF, 0xA9, 0xFF,
+    0xDC, 0xB6, 0x8B, 0x66, 0x2E, 0x37, 0xF1, 0xDC, 0xB6, 0x49, 0x1E, 0xF4, 0x17, 0xD1, 0x45, 0x8C,
+    0x09, 0xC1, 0x6B, 0xBD, 0x3E, 0x82, 0xFA, 0xF8, 0x96, 0xA9, 0x08, 0xAF, 0x76, 0xF7, 0x44, 0x32,
+    0xC6, 0x67, 0xAF, 0x83, 0x93, 0x1B, 0x46, 0x3F, 0x7A, 0x19, 0x80, 0xF2, 0x2D, 0x10, 0x9D, 0xF0,
+    0x90, 0x4A, 0x05, 0x7A, 0xC5, 0x07, 0xCC, 0xC2, 0x9D, 0x54, 0x1A, 0x71, 0x9F, 0xFE, 0xD7, 0xDF,
+    0xBF, 0xB5, 0x55, 0xBD, 0x8E, 0xDD, 0x44, 0x14, 0x3E, 0x9E, 0xC9, 0xC6, 0x62, 0x5D, 0x4C, 0x8A,
+    0xA5, 0x59, 0x0A, 0x37, 0x14, 0x51, 0x84, 0xE4, 0x37, 0x60, 0x8C, 0xB6, 0xA0, 0xA0, 0x49, 0x81,
+    0x14, 0x41, 0x93, 0x26, 0x45, 0xA0, 0xE1, 0x0D, 0xB0, 0xA5, 0x2D, 0x29, 0x58, 0xD1, 0xD0, 0xA6,
+    0x08, 0x12, 0x64, 0x8B, 0xCB, 0x03, 0x20, 0xCD, 0x40, 0x8A, 0x94, 0x31, 0xE1, 0x01, 0x30, 0x52,
+    0xAA, 0x6C, 0x71, 0x07, 0x64, 0x88, 0x77, 0x77, 0x3C, 0x87, 0xEF, 0x8C, 0xEF, 0x2E, 0x79, 0x01,
+    0x46, 0xF2, 0xDC, 0x3B, 0x9E, 0x99, 0xF3, 0xF3, 0x9D, 0xEF, 0x3B, 0xA6, 0x4F, 0x88, 0xE8, 0xE3,
+    0x82, 0x67, 0xA2, 0x3A, 0x58, 0xEE, 0x49, 0xB1, 0xDA, 0x4C, 0x44, 0x76, 0x24, 0x26, 0xD2, 0x0B,
+    0xDE, 0x62, 0xE1, 0x55, 0x22, 0x2A, 0x23, 0xD9, 0xB3, 0x99, 0x5C, 0xAF, 0x99, 0x27, 0x33, 0x51,
+    0x77, 0xC9, 0x9E, 0xDB, 0x6A, 0xD6, 0x11, 0x67, 0xB8, 0x6D, 0x5E, 0x30, 0x99, 0xA0, 0x62, 0x23,
+    0x37, 0xED, 0xD3, 0xE5, 0xB6, 0x99, 0xAA, 0xD9, 0x6E, 0xBD, 0x63, 0x2E, 0x79, 0xC6, 0x9D, 0xDE,
+    0x32, 0x55, 0x3C, 0x28, 0x6E, 0x69, 0x8F, 0xA8, 0x80, 0x5F, 0xF8, 0xAE, 0xE1, 0x52, 0xDC, 0xDE,
+    0xC1, 0x5B, 0xF1, 0x58, 0xE0, 0x11, 0x67, 0x3A, 0xB9, 0x01, 0x77, 0xE6, 0x92, 0x37, 0x0B, 0x5C,
+    0x24, 0x33, 0x15, 0xC9, 0x04, 0x79, 0xD4, 0x62, 0xA6, 0x32, 0x56, 0xEC, 0x02, 0xF6, 0x3D, 0xB9,
+    0x85, 0x68, 0x0F, 0x77, 0x8B, 0xCF, 0x88, 0x1A, 0x86, 0x6F, 0x9E, 0x55, 0xDA, 0x44, 0x1D, 0x74,
+    0x52, 0x39, 0x6C, 0xC5, 0xF9, 0x31, 0xCC, 0x70, 0x96, 0xE8, 0xF0, 0x34, 0xE5, 0xBC, 0x90, 0x4E,
+    0x4D, 0x66, 0xB2, 0x7D, 0x13, 0xEC, 0x05, 0xFB, 0x86, 0x25, 0xB8, 0x97, 0x44, 0x07, 0x88, 0xEB,
+    0x01, 0xD1, 0xE7, 0x6D, 0xC5, 0xBE, 0xE0, 0xC5, 0x70, 0x50, 0xCC, 0x2F, 0x60, 0x90, 0x39, 0xAA,
+    0xA4, 0xF8, 0x88, 0x91, 0x2B, 0xB7, 0x76, 0xB0, 0x03, 0xF7, 0x66, 0x02, 0x68, 0x5E, 0x2F, 0x15,
+    0x33, 0x20, 0x90, 0x78, 0x81, 0x15, 0xF3, 0x42, 0xCD, 0xD8, 0x01, 0x9B, 0xBC, 0x3D, 0x20, 0xD8,
+    0x68, 0x66, 0xBD, 0x20, 0x20, 0xFE, 0x36, 0xE1, 0x76, 0x07, 0x5F, 0x9D, 0xAF, 0x10, 0x0C, 0xB0,
+    0x72, 0xE7, 0x24, 0xA3, 0x95, 0xE9, 0xE6, 0x93, 0xBB, 0x54, 0x32, 0x0F, 0xE4, 0x24, 0x9A, 0x74,
+    0x5F, 0xAC, 0x65, 0xEC, 0xB1, 0x9A, 0xCA, 0x19, 0xC7, 0x9B, 0x81, 0xBA, 0x11, 0x09, 0x21, 0x18,
+    0x99, 0x46, 0xD2, 0xE7, 0xAE, 0xA5, 0xE6, 0x97, 0x48, 0xC5, 0x62, 0xC2, 0xD9, 0x66, 0xB4, 0x5B,
+    0xC7, 0x05, 0x47, 0x0E, 0x25, 0x4B, 0x3D, 0x66, 0x18, 0xBE, 0xB1, 0xB3, 0x6F, 0xF0, 0xE3, 0x56,
+    0x74, 0xCB, 0x9C, 0x3F, 0x70, 0x40, 0xD9, 0xD5, 0x40, 0x57, 0xA3, 0x78, 0x0C, 0xFC, 0x23, 0x60,
+    0x04, 0x84, 0x5F, 0x84, 0x7A, 0xB0, 0x3E, 0x15, 0xA9, 0x0A, 0x26, 0xD8, 0xDE, 0x7D, 0xB0, 0xD4,
+    0x53, 0x75, 0x89, 0xC4, 0x05, 0xE3, 0x49, 0x10, 0x7C, 0x0B, 0x35, 0x89, 0xF6, 0xEF, 0x6E, 0x94,
+    0x7C, 0x24, 0x16, 0x37, 0xAF, 0xF0, 0x65, 0x53, 0x73, 0x0D, 0xF8, 0xC0, 0x12, 0xF7, 0x2C, 0x52,
+    0xED, 0xE1, 0x6F, 0x8D, 0x63, 0x37, 0x0E, 0xDB, 0xEC, 0x09, 0xD0, 0xF6, 0xE2, 0xAA, 0x58, 0x74,
+    0x24, 0xF8, 0x42, 0x7C, 0xE0, 0x4E, 0xEF, 0xDA, 0xFA, 0x57, 0x30, 0x0B, 0xDE, 0x34, 0x40, 0x12,
+    0x77, 0x64, 0x07, 0x3A, 0x11, 0x7F, 0x9A, 0xEF, 0x25, 0x12, 0x87, 0x46, 0x76, 0xC4, 0x63, 0x21,
+    0xD0, 0x09, 0x03, 0x1A, 0xE0, 0x52, 0xC9, 0x59, 0x87, 0x3F, 0xD4, 0x80, 0xB7, 0xA7, 0xBC, 0x19,
+    0x8C, 0x40, 0x75, 0x9A, 0x9E, 0xB4, 0x20, 0x2E, 0x30, 0x98, 0xC0, 0x3B, 0x2E, 0x13, 0x99, 0x3F,
+    0x79, 0x2E, 0x52, 0x87, 0xC2, 0x6F, 0x7F, 0x87, 0xD1, 0xD1, 0x79, 0x1B, 0xCB, 0x58, 0x4A, 0x61,
+    0xDC, 0x58, 0x46, 0x13, 0xF1, 0x87, 0x7D, 0x15, 0x6B, 0x64, 0xF0, 0xB3, 0x00, 0x09, 0x7B, 0x7C,
+    0x94, 0x44, 0x24, 0x60, 0xB0, 0x48, 0x61, 0x58, 0x21, 0x24, 0x21, 0x2E, 0x04, 0xF0, 0x1E, 0x16,
+    0xE5, 0x05, 0x16, 0x0E, 0xF5, 0x2B, 0x41, 0x07, 0x7A, 0xE7, 0xE5, 0x75, 0xBA, 0x8F, 0x04, 0x10,
+    0xC0, 0x8D, 0xF3, 0x55, 0x56, 0x9A, 0x68, 0x8A, 0xE8, 0x7D, 0x6C, 0xDD, 0xFE, 0x0F, 0x94, 0xBD,
+    0xC7, 0x12, 0xBB, 0x07, 0x8D, 0xC6, 0x2A, 0xB9, 0x60, 0x06, 0x13, 0x6E, 0xE6, 0xB3, 0x5D, 0x00,
+    0x52, 0x1E, 0xF4, 0x25, 0x11, 0x6A, 0x05, 0xB9, 0x34, 0x73, 0x96, 0x68, 0xDF, 0xF9, 0x72, 0xE8,
+    0x86, 0x66, 0xB0, 0x00, 0xB2, 0x01, 0x22, 0x15, 0xCA, 0xB0, 0xD6, 0x00, 0x08, 0x97, 0xB9, 0x96,
+    0x0B, 0x6A, 0xB3, 0x40, 0x00, 0x3F, 0x49, 0xB4, 0x28, 0x08, 0x44, 0x7A, 0x40, 0x72, 0xD6, 0x62,
+    0xCB, 0xBE, 0xFA, 0x3E, 0x67, 0x82, 0xE7, 0x96, 0x0D, 0xC5, 0xD4, 0x9C, 0xDF, 0x0F, 0xB5, 0xF8,
+    0x67, 0x6E, 0x95, 0x34, 0x85, 0x3D, 0xB1, 0xF5, 0x69, 0x0B, 0xDF, 0x22, 0xC7, 0xBE, 0x79, 0x95,
+    0xA0, 0xD0, 0x1F, 0x2B, 0x98, 0xAA, 0xF1, 0x58, 0xD4, 0xB5, 0xDB, 0x3D, 0x56, 0xD6, 0xB3, 0x41,
+    0x58, 0x8E, 0xDC, 0x31, 0xEB, 0x08, 0xE4, 0xC7, 0x3A, 0xC7, 0x04, 0x07, 0x77, 0x57, 0x56, 0xC0,
+    0x63, 0xA8, 0x98, 0xDC, 0x00, 0x36, 0xE7, 0xF1, 0x50, 0x71, 0x70, 0xBC, 0xEF, 0x46, 0x85, 0x2D,
+    0x8F, 0x10, 0x1D, 0x44, 0x05, 0x12, 0xD4, 0xD0, 0x2F, 0x89, 0x76, 0xDE, 0xED, 0xB6, 0x5F, 0xF1,
+    0xE4, 0x92, 0x4E, 0xED, 0xDE, 0x6A, 0x23, 0x9A, 0x81, 0x3F, 0x9A, 0xBB, 0xA7, 0x8B, 0x19, 0x12,
+    0xB5, 0xD7, 0xAC, 0x7A, 0x08, 0x47, 0x10, 0x55, 0x50, 0x9B, 0x99, 0x60, 0x4C, 0x9A, 0x49, 0xE7,
+    0x45, 0x61, 0xB0, 0x07, 0xE0, 0xA5, 0xB1, 0x48, 0xAF, 0x19, 0x60, 0xFA, 0xA4, 0x4C, 0xB3, 0x42,
+    0xF6, 0x0E, 0x3C, 0x38, 0xBF, 0x8A, 0x2D, 0x8F, 0xC6, 0x4B, 0xB3, 0x10, 0xB1, 0x08, 0x63, 0x6D,
+    0x58, 0x25, 0xF3, 0xC6, 0x90, 0x76, 0x29, 0xD9, 0x6A, 0x21, 0xDA, 0xBE, 0x64, 0x26, 0x86, 0x57,
+    0x26, 0x08, 0xE5, 0xC4, 0x47, 0x6E, 0x2F, 0xB9, 0x70, 0xE4, 0xBC, 0xB4, 0x32, 0xFC, 0x31, 0x92,
+    0xAF, 0xBD, 0x3A, 0x2E, 0xF8, 0x49, 0xFD, 0x72, 0x94, 0xD7, 0xAB, 0x1B, 0xB2, 0x37, 0xD7, 0xB3,
+    0xF4, 0x00, 0xA9, 0xB6, 0x00, 0x2A, 0xE6, 0x0E, 0x4F, 0x76, 0xA2, 0xF9, 0x4E, 0xE6, 0x8A, 0x33,
+    0x74, 0xD2, 0x26, 0xB0, 0x48, 0x62, 0x80, 0xEC, 0x91, 0xBC, 0x53, 0x73, 0x23, 0xEF, 0x8C, 0xCF,
+    0xEF, 0x3A, 0xBD, 0xE0, 0xB2, 0x9E, 0x6A, 0x31, 0x66, 0xBC, 0xBB, 0xC4, 0xAA, 0xD3, 0x11, 0x3E,
+    0xF4, 0x64, 0x82, 0x16, 0x55, 0x5A, 0x6F, 0x42, 0x2B, 0x05, 0xED, 0x8E, 0xB7, 0x78, 0x23, 0x25,
+    0xEB, 0x4D, 0xE2, 0x11, 0xA5, 0xAC, 0x85, 0x37, 0x7D, 0x6E, 0xCF, 0xB7, 0x76, 0x1A, 0x7B, 0x40,
+    0x6F, 0x67, 0x91, 0x41, 0x47, 0x22, 0xF8, 0x1E, 0xF2, 0x12, 0xF2, 0x2B, 0x31, 0x80, 0x94, 0x55,
+    0x9E, 0x75, 0xEE, 0x2E, 0xF7, 0x92, 0x3B, 0x01, 0x85, 0xE4, 0x3B, 0x81, 0x69, 0x13, 0xCD, 0xC5,
+    0x06, 0x0D, 0xB0, 0x0E, 0xD5, 0xA4, 0x30, 0x1B, 0xCC, 0x0D, 0x66, 0x1D, 0xED, 0x68, 0x66, 0x7C,
+    0x24, 0x06, 0xE9, 0xE6, 0x9D, 0x10, 0xDF, 0xC3, 0xB8, 0x74, 0xF4, 0x95, 0x78, 0xA2, 0x6A, 0x14,
+    0x55, 0x54, 0x01, 0x3F, 0x7C, 0x85, 0xF1, 0x1D, 0x3E, 0x03, 0x45, 0x70, 0x58, 0x6D, 0x2E, 0x7E,
+    0xD8, 0x61, 0x2C, 0x77, 0x4C, 0xC0, 0xAE, 0x7D, 0xC6, 0x21, 0x0B, 0xBB, 0x7A, 0xFD, 0x0F, 0x7A,
+    0x49, 0x42, 0x65, 0x38, 0x34, 0x63, 0x29, 0xB1, 0x36, 0xF8, 0x56, 0x11, 0x7B, 0x70, 0x4B, 0xB2,
+    0xA8, 0x27, 0xDC, 0xEA, 0x00, 0xC1, 0x37, 0x00, 0x60, 0xFB, 0x1C, 0x8C, 0x48, 0x20, 0x1C, 0xFF,
+    0xC1, 0x6B, 0xF1, 0xF7, 0xAE, 0x6B, 0xAE, 0x51, 0x03, 0xFA, 0x32, 0x3B, 0x58, 0xDB, 0xA7, 0x10,
+    0x2B, 0x2F, 0x48, 0x60, 0xDF, 0x7F, 0x83, 0x1E, 0x37, 0x7B, 0x7A, 0xD4, 0xA0, 0x8D, 0x3D, 0x17,
+    0x10, 0x4F, 0x93, 0x41, 0x7F, 0xF9, 0x2D, 0x1D, 0xE8, 0x08, 0x12, 0xD9, 0xAF, 0x3D, 0x95, 0xAF,
+    0x71, 0xC9, 0x61, 0x61, 0x84, 0x3E, 0xB9, 0xCA, 0x7F, 0x2D, 0xA0, 0x44, 0x3D, 0x82, 0xA8, 0x7C,
+    0x74, 0x9C, 0xAA, 0x14, 0xF1, 0x65, 0xE1, 0x0F, 0xA3, 0x42, 0x4B, 0x12, 0x25, 0x90, 0xC0, 0xFF,
+    0x3F, 0x8E, 0x7F, 0x01, 0xB5, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0x7B, 0x13, 0x5C, 0xB8,
+    0x30, 0x12, 0xA4, 0x00, 0x04, 0xDB, 0x23, 0x45, 0xA6, 0xA4, 0x00, 0xD6, 0xE2, 0x17, 0xA4, 0xB8,
+    0x08, 0x51, 0xA5, 0x01, 0x89, 0xEE, 0xFE, 0x00, 0x60, 0x43, 0x43, 0xC9, 0x35, 0xF4, 0x29, 0xA8,
+    0x48, 0x71, 0x7F, 0x00, 0xC9, 0xAB, 0xB4, 0x29, 0xB0, 0x14, 0x41, 0x6D, 0xE9, 0x24, 0x1A, 0x8A,
+    0x2C, 0xC2, 0x80, 0x4F, 0xEC, 0xEE, 0xF0, 0xDE, 0x7E, 0xF7, 0x5D, 0x12, 0x24, 0x3A, 0xB0, 0xBE,
+    0x6F, 0x6C, 0xEF, 0xDA, 0x33, 0x6F, 0xDE, 0xCC, 0x3C, 0x8B, 0xBC, 0x28, 0x38, 0x36, 0xFC, 0xEB,
+    0x48, 0x93, 0x79, 0xAB, 0x03, 0xCC, 0xE8, 0x61, 0xBA, 0x95, 0x8B, 0x8B, 0x3C, 0x73, 0x7C, 0x28,
+    0xD5, 0x89, 0xD5, 0xA1, 0xDB, 0x9C, 0x4E, 0x7D, 0x78, 0x93, 0x06, 0x2F, 0xB8, 0x55, 0x54, 0xDC,
+    0x52, 0x29, 0xDE, 0x83, 0x93, 0xD9, 0x9B, 0x24, 0x3A, 0x35, 0xB1, 0xD2, 0xA1, 0x8D, 0x46, 0xA5,
+    0xDB, 0x5A, 0x98, 0x60, 0x55, 0x6C, 0xF8, 0x5C, 0x5F, 0xB7, 0x7F, 0x44, 0xCD, 0x56, 0x83, 0x46,
+    0xAB, 0x5E, 0xB7, 0x36, 0xCB, 0x38, 0xC9, 0x1D, 0xB9, 0xF1, 0x4C, 0x9C, 0xB7, 0x44, 0x5A, 0xDF,
+    0x0C, 0x52, 0x45, 0x09, 0x22, 0x76, 0x1D, 0x09, 0x4C, 0x01, 0xAA, 0x51, 0x82, 0xBA, 0x79, 0xE7,
+    0xF8, 0xE0, 0xCD, 0xA9, 0xBA, 0x2F, 0xF0, 0xAE, 0x88, 0xBE, 0x37, 0x59, 0x5E, 0x53, 0xEF, 0x82,
+    0x34, 0x91, 0xB9, 0xB8, 0xA5, 0x5F, 0xC5, 0x24, 0x80, 0x91, 0x7E, 0x75, 0x5E, 0xAA, 0xDC, 0xEC,
+    0xC8, 0x2A, 0xCC, 0x74, 0xC6, 0xE4, 0xBA, 0x5F, 0x99, 0xB6, 0xBA, 0x09, 0x97, 0x7F, 0x22, 0x8E,
+    0xCC, 0x78, 0x14, 0xDE, 0x26, 0x5E, 0xF2, 0xBE, 0x8B, 0xD7, 0x8C, 0xF4, 0xE4, 0xA1, 0x01, 0x57,
+    0xEF, 0xBE, 0x90, 0x08, 0x83, 0x8B, 0xB3, 0x62, 0xD1, 0x14, 0x44, 0xED, 0xFD, 0xFF, 0x91, 0x9F,
+    0xDB, 0xE4, 0xE7, 0x53, 0xF2, 0xF3, 0x3D, 0x83, 0x10, 0x54, 0x45, 0xD3, 0xB2, 0x74, 0xF6, 0xBA,
+    0x40, 0x56, 0x91, 0x74, 0xA7, 0x80, 0x5F, 0xCD, 0x19, 0xF0, 0x1A, 0x00, 0xBD, 0xF5, 0x81, 0x7E,
+    0x73, 0x82, 0x35, 0xD5, 0x86, 0xE6, 0xCB, 0x74, 0x7A, 0x79, 0x6F, 0x49, 0x6D, 0x32, 0xC1, 0xD5,
+    0x2A, 0xB1, 0x99, 0xD4, 0xBF, 0x03, 0xA6, 0x98, 0x82, 0xDD, 0x4B, 0xF2, 0x7A, 0x86, 0x94, 0x54,
+    0x91, 0xF6, 0x13, 0x0D, 0xD8, 0xE9, 0xB2, 0xD8, 0x4D, 0xD4, 0xB7, 0x51, 0x5C, 0x20, 0xD8, 0x08,
+    0xEC, 0x38, 0xBB, 0xB5, 0xD6, 0xC1, 0x6E, 0xB5, 0xFA, 0x53, 0x3C, 0xEE, 0x67, 0x98, 0xC9, 0xA9,
+    0x5E, 0x1E, 0xD1, 0x7C, 0x24, 0x9F, 0x80, 0xB5, 0xDC, 0xD0, 0x53, 0xEE, 0x01, 0xEA, 0x41, 0x9E,
+    0x61, 0xEB, 0xBC, 0xC3, 0x82, 0x34, 0x10, 0x68, 0x90, 0x1E, 0xB9, 0x14, 0x3D, 0x5D, 0xDB, 0x5C,
+    0xA9, 0xC6, 0x2E, 0xD6, 0xFA, 0x24, 0x75, 0xBB, 0x41, 0x01, 0xED, 0x66, 0x10, 0xCA, 0x06, 0xD8,
+    0xDC, 0x07, 0xB0, 0x95, 0xDC, 0x6A, 0x62, 0x13, 0xDD, 0x62, 0x74, 0xDE, 0x46, 0x8F, 0xE7, 0x97,
+    0x79, 0x92, 0xB1, 0x74, 0x6D, 0xC5, 0x1A, 0xC9, 0xDD, 0x52, 0x29, 0x45, 0x22, 0xB5, 0xB2, 0x42,
+    0x4C, 0x7C, 0x11, 0x97, 0x6B, 0x64, 0x82, 0xDF, 0xB8, 0x03, 0xAD, 0xF4, 0xA4, 0x1C, 0x69, 0xB4,
+    0x64, 0x2B, 0xB1, 0xC4, 0x5D, 0xB2, 0xC5, 0xF6, 0xA4, 0x28, 0x39, 0xDA, 0x78, 0x65, 0xD1, 0x05,
+    0xFD, 0xEE, 0xC0, 0xB3, 0xDB, 0x68, 0xC7, 0xE0, 0xE0, 0x5C, 0x97, 0x3E, 0x22, 0x82, 0x07, 0x35,
+    0x28, 0x5C, 0xAB, 0x3F, 0xA2, 0x6F, 0xC8, 0x59, 0x60, 0x93, 0xB2, 0x7B, 0x2C, 0x21, 0x88, 0xBC,
+    0x5C, 0x88, 0x78, 0x15, 0x6D, 0x8C, 0xCA, 0x00, 0xD1, 0x6A, 0xF4, 0x3C, 0x81, 0x76, 0xFD, 0x42,
+    0xA5, 0x0F, 0xEC, 0x00, 0x87, 0x2C, 0x18, 0xF5, 0x07, 0xFC, 0x2F, 0xF4, 0xBB, 0xF3, 0x4D, 0x07,
+    0x83, 0x04, 0xEB, 0xDC, 0xED, 0x95, 0xD6, 0x8A, 0x06, 0x19, 0x91, 0x47, 0xCB, 0x5C, 0x4A, 0x9E,
+    0xC7, 0xBE, 0x3F, 0x61, 0xAD, 0x2B, 0x7D, 0x84, 0x68, 0xB5, 0xFE, 0x8E, 0xED, 0x4A, 0x13, 0xF3,
+    0x51, 0xBC, 0x32, 0x89, 0x3E, 0x1C, 0x00, 0x1C, 0x33, 0x8C, 0xE4, 0xDC, 0x02, 0x68, 0x98, 0x20,
+    0x74, 0xAB, 0x6F, 0x39, 0x4B, 0xC1, 0x00, 0x9B, 0x49, 0x65, 0xE2, 0x75, 0xA0, 0x53, 0x57, 0xC6,
+    0xAB, 0xDD, 0x39, 0x07, 0xB5, 0x5A, 0x8E, 0xFE, 0xF8, 0x88, 0x1D, 0xD1, 0xFD, 0xC6, 0x21, 0x30,
+    0x87, 0x64, 0xB4, 0xCC, 0x42, 0x5F, 0xD8, 0x66, 0x51, 0xC1, 0x79, 0x19, 0x14, 0x71, 0xFE, 0x39,
+    0x81, 0x90, 0x57, 0x1A, 0x70, 0x3E, 0x3E, 0xC6, 0x5B, 0xE3, 0xFE, 0x20, 0x8B, 0x43, 0xAF, 0x7B,
+    0xF7, 0x33, 0x9A, 0x07, 0x23, 0xD4, 0x45, 0xCC, 0x5D, 0xAD, 0x1D, 0xFC, 0xCE, 0x5F, 0x91, 0xDB,
+    0x0B, 0x90, 0xDA, 0x5C, 0x22, 0x40, 0x95, 0xE9, 0x7F, 0x4C, 0xA5, 0x8F, 0x8F, 0x21, 0x0E, 0x11,
+    0x4A, 0x80, 0xEE, 0x39, 0x1D, 0xBA, 0x3E, 0xD6, 0x82, 0x40, 0xDE, 0xE0, 0xA9, 0x0D, 0x4D, 0x79,
+    0x68, 0xFE, 0xA9, 0x40, 0x35, 0x5A, 0x50, 0xA2, 0x3E, 0x83, 0xFC, 0xDB, 0x81, 0x06, 0x61, 0x5D,
+    0xF8, 0x77, 0x9A, 0x58, 0xB7, 0xBA, 0xF4, 0x0D, 0xCB, 0x3B, 0x94, 0xF0, 0xA5, 0x03, 0x36, 0xD6,
+    0x99, 0x3C, 0x96, 0x61, 0xC7, 0x92, 0x52, 0x03, 0xA0, 0x5B, 0x14, 0x80, 0x71, 0xB1, 0xE4, 0xA6,
+    0x8D, 0xED, 0x4E, 0x85, 0xD2, 0x87, 0x99, 0x93, 0xD4, 0x45, 0x7D, 0xBF, 0xB8, 0xD0, 0xA5, 0xB8,
+    0x50, 0xCE, 0x0E, 0xDE, 0x8F, 0xC5, 0xA3, 0xCB, 0x7C, 0x1D, 0xB7, 0x93, 0xCC, 0x74, 0xB1, 0x16,
+    0xA9, 0x69, 0xE1, 0x15, 0x2E, 0x1A, 0x0C, 0xD1, 0x7C, 0x04, 0x85, 0x41, 0xD3, 0xD4, 0x94, 0xDE,
+    0x62, 0x4E, 0xE9, 0x80, 0xFB, 0x8A, 0x73, 0xB3, 0x5F, 0xDD, 0x1E, 0x32, 0x34, 0x87, 0x87, 0xE4,
+    0xB3, 0xC3, 0xA9, 0x9E, 0x9E, 0x26, 0xEA, 0xA5, 0x0E, 0xD5, 0x22, 0x4D, 0x30, 0x30, 0x3B, 0x6A,
+    0x5C, 0xD8, 0xA9, 0x4A, 0x69, 0x6F, 0x0D, 0xFF, 0x89, 0xBA, 0xE7, 0x1B, 0x50, 0xAF, 0x7C, 0x9B,
+    0xEA, 0x95, 0xA8, 0x5E, 0x89, 0xEA, 0xC5, 0x29, 0x9B, 0x77, 0xF4, 0xED, 0x4B, 0xC4, 0xD6, 0x94,
+    0xAE, 0x22, 0x76, 0xCB, 0x98, 0xEF, 0x31, 0xE8, 0xDB, 0x4F, 0x4B, 0x51, 0xE4, 0xC7, 0x93, 0x33,
+    0x20, 0x37, 0xB9, 0x34, 0xC0, 0x40, 0xEE, 0x40, 0x73, 0x47, 0x0A, 0xAA, 0x7B, 0xE9, 0xE4, 0xA0,
+    0x6B, 0xD8, 0x39, 0x63, 0xA9, 0x59, 0x08, 0xC7, 0xAD, 0x0E, 0xEA, 0xC2, 0x1D, 0xF2, 0x56, 0x34,
+    0xCA, 0x53, 0xA3, 0x80, 0xDF, 0x77, 0x3B, 0x3A, 0x1C, 0x3B, 0x7D, 0xC0, 0x4E, 0xBF, 0x53, 0x07,
+    0x77, 0xC4, 0xD1, 0x8D, 0x23, 0x7B, 0x76, 0xFC, 0x8E, 0x0C, 0xF8, 0x74, 0x0C, 0xAC, 0xAB, 0x21,
+    0xD5, 0xE5, 0x6B, 0x01, 0x4C, 0x5B, 0xD1, 0xD3, 0x11, 0xCB, 0xD4, 0x5A, 0xAE, 0x12, 0x24, 0x48,
+    0x73, 0xBF, 0x20, 0x94, 0x42, 0xDD, 0xCE, 0x53, 0xBF, 0x76, 0x3B, 0x94, 0xF0, 0x22, 0xCA, 0xF8,
+    0x75, 0xA8, 0x93, 0x5B, 0x6C, 0x98, 0xFF, 0xC2, 0x90, 0xC3, 0x0F, 0xBF, 0x27, 0xB7, 0x8A, 0xFB,
+    0xBB, 0x45, 0x98, 0xD0, 0x3D, 0x0C, 0xBF, 0xF1, 0x12, 0xDB, 0x1F, 0x43, 0x08, 0xD6, 0x02, 0x1A,
+    0xAA, 0x54, 0xFA, 0xA3, 0xC8, 0xAC, 0xA1, 0x3A, 0x40, 0x8E, 0xA1, 0x10, 0x98, 0xA3, 0x8B, 0x84,
+    0x5E, 0x6C, 0x95, 0x1D, 0x62, 0x73, 0x49, 0x76, 0x21, 0x43, 0x89, 0x64, 0x7D, 0x4B, 0x24, 0xA1,
+    0xA6, 0xEE, 0x78, 0x33, 0x1C, 0x28, 0x3B, 0xE8, 0x78, 0x69, 0xAB, 0x83, 0x0E, 0xD5, 0x0C, 0xC8,
+    0x3C, 0xFC, 0x3F, 0x9A, 0xFF, 0x6F, 0xCD, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0xBD, 0xF6, 0x64,
+    0x3F, 0xA3, 0xB5, 0xD0, 0xA4, 0x80, 0x82, 0x6C, 0xE1, 0x86, 0x16, 0xB9, 0xA5, 0x21, 0x63, 0xE0,
+    0x05, 0x52, 0x24, 0xA1, 0xA4, 0xA1, 0xA0, 0x4B, 0x43, 0x43, 0x65, 0x03, 0x45, 0x0A, 0x9A, 0x7D,
+    0x83, 0x50, 0xA4, 0x00, 0x9A, 0xBC, 0x00, 0xD9, 0x19, 0x29, 0x45, 0x24, 0xD2, 0x58, 0x8A, 0xA8,
+    0x31, 0x48, 0x0B, 0x74, 0x78, 0xD1, 0x10, 0xBC, 0xD9, 0xF1, 0x5C, 0xCE, 0xBD, 0xFE, 0x36, 0x80,
+    0xE0, 0x01, 0xB0, 0xE4, 0xF1, 0x7C, 0xF6, 0xCC, 0x99, 0x73, 0xCE, 0xFD, 0xF9, 0xA8, 0xF8, 0xA0,
+    0xB8, 0x4F, 0x0D, 0xBF, 0xCB, 0xC1, 0xF2, 0x53, 0x8E, 0xE5, 0x83, 0x3F, 0x38, 0x93, 0xE1, 0xC8,
+    0x81, 0x78, 0x6E, 0x67, 0xEA, 0x63, 0x9D, 0xA8, 0x59, 0x4A, 0x26, 0x3C, 0x79, 0x30, 0x99, 0xDC,
+    0x48, 0x4C, 0x16, 0x5F, 0x9E, 0xDC, 0x5D, 0xA8, 0xFD, 0xF1, 0xB7, 0x95, 0x6C, 0xBC, 0x8E, 0x3D,
+    0xB9, 0x66, 0x2A, 0xF8, 0x82, 0x3B, 0xF2, 0x8C, 0xC1, 0x31, 0x20, 0x6C, 0x7C, 0x65, 0x21, 0x03,
+    0x00, 0x7C, 0x21, 0x33, 0x90, 0x0F, 0x44, 0xE4, 0x22, 0x06, 0xCF, 0x33, 0x66, 0x9C, 0x88, 0x0E,
+    0x6E, 0xDD, 0xA2, 0xFD, 0xF5, 0x85, 0x0C, 0xD5, 0x28, 0xA3, 0xEB, 0x30, 0x14, 0x49, 0xA6, 0xF5,
+    0x2C, 0x60, 0x3C, 0x94, 0x18, 0x56, 0xAA, 0x30, 0x62, 0x2B, 0x7F, 0x87, 0x5D, 0x55, 0x96, 0xEF,
+    0xAD, 0xE0, 0x11, 0x0B, 0xB4, 0x61, 0x99, 0x36, 0x8B, 0x8C, 0xBD, 0xE0, 0x94, 0x2C, 0x38, 0x56,
+    0x71, 0xDC, 0x2C, 0x90, 0x3C, 0x08, 0xE4, 0xFA, 0xE2, 0xC5, 0xBF, 0x37, 0x7A, 0xD9, 0xD8, 0xF0,
+    0x22, 0xBB, 0x19, 0xD8, 0x96, 0x75, 0x09, 0xD1, 0x6B, 0x72, 0xD8, 0x44, 0x22, 0x08, 0xF0, 0xF2,
+    0x63, 0x80, 0xD4, 0xD0, 0xE3, 0x6E, 0xF8, 0x79, 0x07, 0xB5, 0xDB, 0xB7, 0x42, 0xC0, 0x7A, 0xEC,
+    0x81, 0x7F, 0x64, 0x81, 0x63, 0xE4, 0x38, 0x61, 0x82, 0x97, 0x57, 0xF0, 0xB2, 0xBA, 0x17, 0x71,
+    0x22, 0x56, 0xCA, 0xAD, 0x87, 0xDE, 0x10, 0x7C, 0xAB, 0xD2, 0x00, 0xC9, 0xA1, 0xC0, 0x00, 0x14,
+    0x77, 0xF6, 0xDE, 0x22, 0x94, 0xED, 0x24, 0x94, 0xE1, 0x09, 0x28, 0xCB, 0xB6, 0x60, 0xC2, 0x5E,
+    0x7C, 0x23, 0xE2, 0x5F, 0xE5, 0x53, 0x00, 0xB0, 0xD8, 0xBE, 0x7B, 0x90, 0xBF, 0x94, 0xD3, 0xA7,
+    0xFF, 0x12, 0xBF, 0x69, 0xFD, 0x9B, 0x6B, 0x15, 0x67, 0x8D, 0xC5, 0x2A, 0x0E, 0xB0, 0x2E, 0xD9,
+    0xDD, 0xA7, 0x1D, 0x8E, 0xF6, 0x9C, 0x0D, 0x3F, 0x48, 0x76, 0xB0, 0xF3, 0x55, 0x72, 0xA1, 0x42,
+    0xE0, 0xAF, 0xF7, 0x08, 0x44, 0xC6, 0x9E, 0x91, 0xFC, 0x4A, 0x75, 0xFE, 0x06, 0xA9, 0x30, 0xBF,
+    0x8D, 0xC4, 0xB8, 0xBB, 0x16, 0x19, 0xDC, 0x63, 0x0B, 0x02, 0x2D, 0xBE, 0x16, 0xDD, 0x5E, 0xCC,
+    0x24, 0x21, 0xCB, 0xF0, 0x12, 0x53, 0xB2, 0xE7, 0xB7, 0x57, 0x68, 0xE9, 0x9A, 0x00, 0x5F, 0xCA,
+    0x24, 0x96, 0xB7, 0x7B, 0x5E, 0x1B, 0xA3, 0xFE, 0xF4, 0x3E, 0x22, 0xC3, 0x62, 0xBC, 0x1A, 0x61,
+    0xF3, 0x1D, 0x1E, 0x20, 0xBE, 0x4D, 0x42, 0x16, 0x9A, 0x59, 0x4D, 0x80, 0x43, 0x23, 0xD8, 0x20,
+    0x1D, 0x11, 0x61, 0x1F, 0xF0, 0xCA, 0xA6, 0x0A, 0x9B, 0xF8, 0x53, 0x9C, 0xD2, 0x44, 0xC7, 0x6B,
+    0xA9, 0xC1, 0x74, 0x62, 0x01, 0x56, 0xD1, 0xCB, 0x38, 0x94, 0xCC, 0x73, 0x10, 0x43, 0x1E, 0x49,
+    0x88, 0xC4, 0x75, 0xDA, 0xFD, 0xB2, 0xE5, 0x1C, 0x52, 0x2B, 0xC9, 0x7D, 0xC4, 0xB7, 0x13, 0xE2,
+    0x94, 0x10, 0xC0, 0x58, 0x25, 0x3A, 0xAE, 0x40, 0xA3, 0x3E, 0xBF, 0x29, 0x3A, 0x06, 0x2B, 0xC8,
+    0xBF, 0xF7, 0xB1, 0x9D, 0xEC, 0xE2, 0xC6, 0x2A, 0xB9, 0xD1, 0xA4, 0x3E, 0x98, 0xE4, 0x71, 0x73,
+    0x87, 0xD5, 0x54, 0x63, 0x35, 0x6A, 0x82, 0x9A, 0xC9, 0x74, 0x2E, 0xD8, 0x53, 0xEE, 0x2C, 0x4C,
+    0xAD, 0xA1, 0xA2, 0xF8, 0x1A, 0x6E, 0x14, 0x1A, 0x5F, 0xBA, 0x29, 0xA2, 0x1B, 0x8E, 0x85, 0x56,
+    0x57, 0xCD, 0xA9, 0x00, 0x1F, 0xB7, 0x16, 0x7C, 0x5E, 0x80, 0x93, 0x85, 0x18, 0xC8, 0xF0, 0x54,
+    0x98, 0x08, 0x26, 0x5C, 0x60, 0xC7, 0x09, 0x6A, 0xCD, 0x6B, 0x6E, 0x84, 0x3E, 0xF4, 0xE2, 0xAB,
+    0x01, 0x0B, 0x2D, 0x0E, 0x3A, 0xA9, 0x63, 0x3B, 0x68, 0x0E, 0x3C, 0x5A, 0xAD, 0x66, 0x28, 0xCC,
+    0x63, 0xAD, 0x1E, 0x29, 0x12, 0xCD, 0xE5, 0x2A, 0xDF, 0x79, 0xA6, 0x6E, 0x18, 0xB6, 0xD1, 0x8D,
+    0x3A, 0x31, 0x49, 0x5C, 0xC1, 0xA4, 0x63, 0xCD, 0xD4, 0x92, 0x87, 0x3E, 0x88, 0x5B, 0x25, 0x87,
+    0x76, 0x92, 0x6F, 0x25, 0x8F, 0x56, 0x1C, 0xC7, 0x1A, 0x28, 0xA5, 0x76, 0x01, 0xE0, 0xB4, 0xC3,
+    0x1C, 0x62, 0x79, 0x02, 0x6F, 0xF2, 0x8B, 0x44, 0x01, 0x79, 0x52, 0x73, 0x57, 0xEC, 0x8D, 0x0C,
+    0xFB, 0x2A, 0xB6, 0xD3, 0x7E, 0x52, 0xC5, 0xFD, 0x64, 0xAB, 0x63, 0xB9, 0x1E, 0x5E, 0x4E, 0xDA,
+    0xCB, 0xC9, 0x0E, 0x5A, 0x76, 0xC7, 0xB0, 0xE6, 0x1A, 0x0E, 0x09, 0x0E, 0xD1, 0x2E, 0x78, 0x35,
+    0xB1, 0xE6, 0xB1, 0xE7, 0xB9, 0x2F, 0x39, 0xD5, 0x3F, 0x71, 0x3D, 0xF7, 0xEF, 0x0C, 0x1F, 0xD9,
+    0x39, 0x5B, 0x51, 0xE0, 0xDD, 0xD3, 0x45, 0xC5, 0x26, 0x75, 0xC6, 0xF3, 0xF7, 0xF3, 0x96, 0x6F,
+    0x9A, 0x45, 0xEC, 0xD4, 0x82, 0xE6, 0x71, 0x5E, 0xD5, 0x2D, 0x7F, 0x6F, 0xBC, 0x52, 0xD0, 0x89,
+    0x3D, 0xE3, 0x72, 0x7E, 0xAB, 0x0F, 0xAB, 0xCD, 0x68, 0x54, 0x73, 0x13, 0xE0, 0x94, 0x5F, 0xCB,
+    0x54, 0xF3, 0x43, 0x64, 0x9F, 0xEB, 0xDA, 0x9F, 0xC3, 0x01, 0x41, 0xC9, 0xD5, 0x3D, 0x43, 0x3D,
+    0x09, 0x57, 0xFE, 0xC7, 0xCF, 0x6A, 0x13, 0xA2, 0xB6, 0xE1, 0x3A, 0x90, 0x38, 0x1C, 0x20, 0xB6,
+    0x2D, 0xDC, 0x86, 0x1B, 0x49, 0x52, 0x1D, 0xE6, 0x74, 0xFD, 0x6C, 0x22, 0x0C, 0xB2, 0x01, 0x25,
+    0xF8, 0x86, 0x26, 0x21, 0x6D, 0x06, 0xA3, 0x56, 0x7B, 0xE9, 0x5E, 0xAC, 0x31, 0x22, 0xBA, 0x26,
+    0x03, 0xB5, 0x42, 0xD5, 0x89, 0x28, 0x3F, 0xBD, 0x04, 0xF4, 0x4F, 0x22, 0x32, 0x5D, 0x5A, 0xEC,
+    0xEC, 0xE2, 0x11, 0xC2, 0x24, 0x6D, 0x48, 0xAB, 0xDB, 0x8B, 0x36, 0x75, 0xD3, 0xA8, 0x66, 0x58,
+    0xFE, 0xF1, 0x89, 0xE0, 0x46, 0xF1, 0x03, 0x6C, 0x0E, 0x8F, 0x95, 0xDF, 0x57, 0x42, 0x69, 0xC2,
+    0x9E, 0xA5, 0xCC, 0xEF, 0x27, 0x33, 0x9B, 0x54, 0x0C, 0xD2, 0x99, 0x24, 0xA9, 0xD1, 0xC1, 0x2C,
+    0x96, 0x5A, 0x40, 0x1D, 0x7A, 0x69, 0x50, 0xD2, 0xE2, 0x96, 0x06, 0x4F, 0x98, 0x3F, 0xBB, 0x0B,
+    0x1E, 0xA5, 0x8E, 0x2B, 0x81, 0x3C, 0x02, 0x7E, 0x15, 0xA8, 0xAC, 0x03, 0xD0, 0xE5, 0x1E, 0xD0,
+    0xE6, 0xE9, 0xAF, 0xEB, 0x40, 0xDA, 0x3C, 0xE2, 0x05, 0x99, 0x3C, 0xB5, 0x2C, 0xED, 0xA4, 0xD4,
+    0xB6, 0x36, 0x34, 0x17, 0x13, 0x55, 0x5B, 0x0E, 0xB7, 0x73, 0x3D, 0x6B, 0xEB, 0xE9, 0xB7, 0xEC,
+    0x8B, 0xDA, 0x68, 0xDB, 0xA0, 0x2D, 0x3A, 0x69, 0xFE, 0xF1, 0x44, 0x2F, 0xDA, 0xAC, 0x7B, 0x26,
+    0x3A, 0x0A, 0xFE, 0x2C, 0x6B, 0x9F, 0x56, 0xC7, 0xDD, 0x2C, 0x5D, 0x14, 0x10, 0xD2, 0x50, 0xC1,
+    0x40, 0xBA, 0x1B, 0x1A, 0x9F, 0x98, 0xE1, 0x71, 0x76, 0x80, 0xED, 0x93, 0xD1, 0x3F, 0x88, 0xA9,
+    0xD2, 0x6A, 0x05, 0x7D, 0xAD, 0x0C, 0xB3, 0xC5, 0xCB, 0xCE, 0xF4, 0xE2, 0x3F, 0xE5, 0x32, 0x19,
+    0xAB, 0x2D, 0x4B, 0x9B, 0x4D, 0xC9, 0xEB, 0xB8, 0x3F, 0xA4, 0xC3, 0x12, 0xD9, 0x9D, 0xA4, 0xF3,
+    0x7D, 0xEB, 0x27, 0x4E, 0xE5, 0xEA, 0x7E, 0xE8, 0xDC, 0x93, 0x99, 0xCC, 0x82, 0x3D, 0x3D, 0xF8,
+    0xD7, 0x17, 0x1A, 0x3C, 0x71, 0x2F, 0x81, 0x63, 0x3B, 0x52, 0x73, 0x96, 0xA9, 0xCC, 0x36, 0xBE,
+    0xE9, 0x26, 0xFF, 0xEB, 0xA3, 0xD5, 0xF0, 0xD2, 0x87, 0x96, 0x3F, 0x5F, 0x28, 0x83, 0x71, 0xD1,
+    0x0C, 0xFB, 0xF3, 0xD0, 0xF4, 0xA8, 0x94, 0x37, 0x1E, 0x1C, 0xB4, 0x0E, 0x6F, 0xD0, 0xFF, 0xE1,
+    0xFA, 0x13, 0xCD, 0x95, 0xBF, 0x8E, 0xDD, 0x44, 0x14, 0xC6, 0x8F, 0x3D, 0xC9, 0x5A, 0x60, 0xA1,
+    0xA1, 0x41, 0x02, 0x09, 0xC9, 0x2D, 0x05, 0x92, 0x5F, 0x20, 0xD2, 0x38, 0xA1, 0x48, 0x19, 0x12,
+    0xB1, 0xDA, 0x82, 0x76, 0x1B, 0xAA, 0x6D, 0x69, 0x60, 0x0C, 0x2D, 0x45, 0x5E, 0x82, 0x26, 0xA4,
+    0xA0, 0xA3, 0x22, 0xB2, 0x81, 0x92, 0x22, 0xCE, 0xE5, 0x01, 0x62, 0x40, 0x20, 0xA1, 0x14, 0x8C,
+    0x36, 0x0E, 0xF1, 0xEE, 0xCE, 0xCC, 0xE1, 0x3B, 0x33, 0xBE, 0x1B, 0xAD, 0xC4, 0x03, 0x70, 0x75,
+    0xAF, 0xE7, 0xFA, 0xCF, 0x9C, 0xF9, 0xCE, 0xEF, 0x7C, 0x67, 0x4C, 0x24, 0x9F, 0x0F, 0x49, 0x73,
+    0xA4, 0x3A, 0x50, 0xCB, 0x81, 0x4C, 0xA4, 0x86, 0x17, 0xC2, 0x3F, 0xE2, 0x4E, 0xF1, 0xF7, 0x54,
+    0x30, 0xD5, 0xCB, 0x35, 0x2A, 0x99, 0xF4, 0x44, 0xA4, 0xE2, 0x0D, 0xD3, 0xA7, 0xC1, 0x62, 0x66,
+    0x15, 0x3E, 0x0D, 0x32, 0xF8, 0xEF, 0x56, 0x0C, 0x35, 0xB3, 0xC3, 0xA0, 0x19, 0xF3, 0x31, 0x9C,
+    0x5D, 0xC8, 0xC5, 0xE6, 0xC5, 0xEF, 0x1E, 0x43, 0x7B, 0xBA, 0x8B, 0x18, 0xCC, 0xE9, 0x13, 0x96,
+    0xE1, 0xB7, 0x9E, 0x11, 0xC5, 0x4C, 0xC4, 0x23, 0x91, 0x1D, 0xC9, 0xCE, 0x44, 0xC3, 0x48, 0x66,
+    0xA1, 0x8A, 0x57, 0x6A, 0x7D, 0x92, 0xA2, 0xB9, 0x33, 0xEC, 0x49, 0x71, 0x97, 0x64, 0xBE, 0x49,
+    0xC5, 0x31, 0xD1, 0x71, 0x1B, 0x49, 0x05, 0xE8, 0xD5, 0xE1, 0x61, 0x24, 0xE3, 0xCB, 0x40, 0xC3,
+    0xDB, 0x2A, 0xDC, 0x5D, 0x49, 0xF9, 0xE7, 0x33, 0xA4, 0x3C, 0x1B, 0xA9, 0x8E, 0x88, 0x0E, 0x19,
+    0x23, 0xE9, 0x97, 0x4F, 0x27, 0x6A, 0x9E, 0xDF, 0x9F, 0xA9, 0x79, 0xF9, 0x95, 0xA3, 0xF6, 0xD7,
+    0x6A, 0x7D, 0xDF, 0x4C, 0x2A, 0x7A, 0x33, 0x95, 0xBC, 0x62, 0x61, 0x76, 0x43, 0x4F, 0x16, 0x5A,
+    0xE8, 0x5A, 0x5A, 0x84, 0x8A, 0x8E, 0x64, 0x51, 0x1E, 0x4B, 0xE6, 0xB9, 0xE1, 0xBE, 0xC2, 0x52,
+    0x09, 0x46, 0xAF, 0xA3, 0x43, 0xC2, 0x34, 0xDC, 0xEC, 0x2A, 0xE6, 0xDB, 0x48, 0xB1, 0x65, 0x2F,
+    0x2C, 0x8E, 0xF8, 0x9E, 0x64, 0xD8, 0xAC, 0x1A, 0xB9, 0x90, 0x9D, 0x1E, 0xE1, 0x28, 0x93, 0x33,
+    0x0A, 0xB9, 0x66, 0xFE, 0x91, 0x14, 0x0A, 0xFE, 0x40, 0x10, 0xD4, 0xA1, 0x92, 0xC7, 0x8D, 0xD3,
+    0x42, 0x89, 0xC7, 0xD6, 0x09, 0x4E, 0xCC, 0x43, 0x88, 0x25, 0xF1, 0x18, 0xB0, 0xF6, 0x88, 0x2A,
+    0xCC, 0x8A, 0x7B, 0x09, 0x54, 0x61, 0x6D, 0xE6, 0xAE, 0x8E, 0x7B, 0x81, 0x74, 0x82, 0x65, 0x87,
+    0x20, 0xF1, 0x31, 0xEB, 0x28, 0x85, 0xC3, 0x3C, 0x25, 0x7F, 0x6C, 0x7F, 0x70, 0x8B, 0xF9, 0xCB,
+    0xD8, 0xF2, 0xC2, 0xB3, 0x76, 0x26, 0x50, 0xD4, 0x4B, 0xDF, 0xEC, 0x56, 0x2A, 0xFD, 0xE7, 0x78,
+    0xEE, 0x71, 0x0F, 0xA0, 0x28, 0x8C, 0xC5, 0x12, 0x75, 0x4A, 0xEC, 0xBE, 0x23, 0xBD, 0x40, 0x20,
+    0xDF, 0xF6, 0xEF, 0x36, 0xCE, 0x5C, 0xEC, 0xB8, 0x44, 0x62, 0x4E, 0xB3, 0x0A, 0x52, 0x1A, 0xA2,
+    0x6E, 0x4F, 0x66, 0x60, 0x5E, 0x0B, 0xFE, 0x89, 0x99, 0xA7, 0x86, 0xEF, 0x30, 0x87, 0x82, 0x83,
+    0xBD, 0x0B, 0x75, 0x17, 0xA7, 0x1E, 0xF6, 0xE1, 0xA2, 0x9E, 0x5B, 0x57, 0x2F, 0xD4, 0x22, 0x0D,
+    0xD3, 0xD1, 0x7B, 0x2A, 0xAA, 0x64, 0x81, 0xA5, 0x95, 0x30, 0xC3, 0x13, 0xD1, 0xA7, 0xAE, 0x92,
+    0xF9, 0x53, 0xEC, 0xB0, 0x27, 0xE3, 0xEB, 0x2B, 0x64, 0x0C, 0xC8, 0x54, 0x99, 0x4C, 0xFB, 0x8A,
+    0x4C, 0xBF, 0x91, 0x41, 0xA0, 0xA9, 0x4E, 0x64, 0x68, 0x4F, 0x06, 0xBF, 0x07, 0x1F, 0xD1, 0x3B,
+    0x05, 0x73, 0x6F, 0x66, 0xDC, 0xB6, 0xFE, 0xD1, 0xC7, 0xCE, 0x46, 0xA3, 0xBC, 0xD9, 0xE9, 0x29,
+    0x9A, 0xB1, 0x5C, 0xAD, 0xA0, 0x6B, 0x9F, 0x8E, 0xA2, 0x40, 0xC0, 0xA3, 0xD4, 0x24, 0xCF, 0x23,
+    0xF6, 0x63, 0x27, 0xC6, 0x14, 0xAA, 0x8B, 0xFD, 0x61, 0xAA, 0xBC, 0x8E, 0x48, 0xB6, 0xC0, 0x03,
+    0xC3, 0x08, 0x8A, 0x70, 0x4D, 0xC8, 0x2E, 0x14, 0xED, 0x28, 0xCB, 0x24, 0xA5, 0x11, 0xAB, 0x34,
+    0xBC, 0x96, 0x1C, 0x3B, 0xD2, 0x1E, 0x65, 0xEF, 0x10, 0xAD, 0x27, 0x51, 0x0E, 0xC9, 0x8A, 0x29,
+    0xFD, 0xC4, 0xDD, 0xB8, 0x04, 0x44, 0x92, 0x8F, 0x18, 0x5D, 0x2E, 0xE1, 0x79, 0x69, 0x99, 0x04,
+    0x42, 0x86, 0x35, 0x45, 0xE6, 0xFF, 0x0E, 0x61, 0x72, 0x08, 0xF8, 0x2F, 0x9D, 0x0E, 0xD3, 0xAB,
+    0x10, 0x52, 0xC3, 0x11, 0x7D, 0x73, 0x46, 0xC3, 0x5E, 0x14, 0xC3, 0xC3, 0xA1, 0xCA, 0xA4, 0x31,
+    0x21, 0xE4, 0x02, 0x8A, 0x47, 0xE4, 0x74, 0xDD, 0x4E, 0xF3, 0x50, 0xB9, 0x3C, 0x7E, 0x96, 0x87,
+    0x12, 0x28, 0x8E, 0xE9, 0x7A, 0xD7, 0x22, 0xC6, 0x2C, 0x81, 0xE6, 0x87, 0x38, 0x4C, 0x25, 0xEA,
+    0x30, 0x22, 0xD0, 0x20, 0x07, 0x74, 0x45, 0x38, 0x84, 0x21, 0x21, 0x36, 0x49, 0x26, 0x7D, 0x8E,
+    0x5E, 0x6C, 0x1C, 0x6E, 0xE1, 0x80, 0xE6, 0x75, 0x95, 0xBF, 0x61, 0xE6, 0x5A, 0xDA, 0xAC, 0xE6,
+    0xC5, 0x8E, 0xB5, 0xB4, 0x99, 0x3A, 0x93, 0x95, 0x6E, 0x49, 0x6D, 0xD5, 0xD5, 0x43, 0x23, 0x37,
+    0x92, 0xD5, 0xDE, 0xDA, 0xD3, 0x45, 0x71, 0x06, 0x5E, 0x25, 0xF8, 0x28, 0xE5, 0x69, 0x65, 0x95,
+    0xCC, 0xB0, 0x5A, 0x37, 0x3E, 0xD8, 0x8E, 0x72, 0xEE, 0x36, 0xA3, 0x89, 0xC5, 0x9A, 0x48, 0xB4,
+    0xCB, 0x41, 0x7F, 0xC9, 0x19, 0x6D, 0x99, 0x80, 0xE1, 0x2C, 0x23, 0x16, 0x03, 0x5E, 0x5A, 0x90,
+    0xD3, 0xD6, 0xB2, 0x81, 0x4C, 0xD5, 0x33, 0x69, 0x07, 0xF3, 0xD2, 0xEF, 0x74, 0x49, 0x7C, 0x0B,
+    0x4B, 0xB9, 0x7C, 0xC9, 0xB8, 0x5B, 0x69, 0x36, 0xEC, 0x62, 0x9F, 0xA4, 0x36, 0x85, 0x9F, 0xAC,
+    0xB8, 0x2A, 0x61, 0x3C, 0x04, 0xA4, 0x11, 0xD7, 0xEF, 0xB0, 0xC3, 0x8D, 0xD3, 0x6F, 0xB1, 0xB1,
+    0xB0, 0x4F, 0x2C, 0x0D, 0xB6, 0xD7, 0xD6, 0xD9, 0xCE, 0x4C, 0x1A, 0xFB, 0x50, 0xF3, 0xE2, 0x28,
+    0x1C, 0x64, 0xA0, 0x49, 0xA0, 0x58, 0xE2, 0x9B, 0x61, 0x16, 0x2A, 0xD2, 0x0C, 0x89, 0x2A, 0xFA,
+    0xA3, 0xE0, 0xD7, 0x64, 0xAF, 0x18, 0xFE, 0xEE, 0x65, 0x36, 0x9A, 0x5F, 0xD0, 0xCE, 0xD4, 0xCE,
+    0x59, 0x2E, 0x5D, 0xA7, 0x7D, 0x5E, 0x9C, 0xF6, 0xA0, 0x9C, 0x69, 0xB3, 0xB9, 0x0B, 0x5B, 0xE6,
+    0xE1, 0xC9, 0x9A, 0xFA, 0xAD, 0x2B, 0xD2, 0x04, 0x64, 0x91, 0xD2, 0x42, 0x2A, 0x19, 0x12, 0x12,
+    0x4E, 0x04, 0x90, 0xA7, 0x4A, 0x4D, 0x85, 0xE6, 0xB3, 0x7F, 0x7C, 0x2D, 0x6B, 0x8B, 0x57, 0x33,
+    0xE0, 0x54, 0x1D, 0x30, 0xD2, 0xF1, 0x44, 0xAA, 0xD3, 0xE3, 0xDB, 0x84, 0x2D, 0xD6, 0x80, 0xD6,
+    0x94, 0x77, 0x45, 0xC5, 0x5B, 0x2C, 0xE3, 0x10, 0x28, 0xC7, 0x07, 0x67, 0x7C, 0x8D, 0x43, 0xD5,
+    0xF0, 0x55, 0xB1, 0xE2, 0xA5, 0x04, 0x3E, 0xBB, 0x43, 0xBE, 0x10, 0x5A, 0x7B, 0x23, 0x0C, 0xC3,
+    0x96, 0x0B, 0xD4, 0x6D, 0xCE, 0xCC, 0x4A, 0xE8, 0x8D, 0x4C, 0x9E, 0xD4, 0xF9, 0x90, 0x6F, 0x98,
+    0x8C, 0x19, 0xA1, 0x37, 0x83, 0x1F, 0xFC, 0x45, 0xF2, 0x8E, 0xF8, 0x44, 0x72, 0x9F, 0xAD, 0x88,
+    0xC5, 0x36, 0x38, 0xD2, 0xEB, 0xC3, 0x33, 0x79, 0xB2, 0x8C, 0xAB, 0x38, 0xC2, 0x44, 0xD9, 0x65,
+    0xB0, 0x81, 0xC8, 0x32, 0xD6, 0xE9, 0x73, 0xBC, 0xFA, 0x22, 0x3C, 0x16, 0x64, 0x2F, 0x46, 0x66,
+    0x1A, 0xDD, 0x7C, 0x93, 0xBF, 0x10, 0xE7, 0xD7, 0x3E, 0x79, 0xDA, 0xFC, 0x98, 0xCD, 0x2F, 0x17,
+    0xC8, 0xFC, 0x22, 0x0F, 0x2A, 0x8F, 0xC2, 0xAC, 0x64, 0x7E, 0x5E, 0xE5, 0x2D, 0x99, 0x65, 0x0C,
+    0x49, 0xB6, 0x4E, 0xDA, 0x0A, 0x91, 0x5C, 0x65, 0x4F, 0xC7, 0x13, 0xB9, 0xD4, 0x64, 0xB1, 0x9C,
+    0x72, 0x29, 0x1E, 0xD0, 0xFF, 0xE2, 0xF3, 0x2F, 0xCD, 0x55, 0x3D, 0x8F, 0xDE, 0x44, 0x10, 0x1E,
+    0xDB, 0xBA, 0xDB, 0x88, 0x2D, 0x56, 0x48, 0x20, 0x41, 0x22, 0xE1, 0x7F, 0x80, 0x7F, 0x01, 0x5A,
+    0x1F, 0x29, 0x29, 0xB8, 0x22, 0x09, 0x25, 0x14, 0x29, 0xE8, 0xF8, 0x07, 0xAC, 0x53, 0xD3, 0xD0,
+    0x50, 0x51, 0x40, 0x41, 0xC7, 0x5F, 0x48, 0xF0, 0x46, 0x57, 0x50, 0x50, 0xE0, 0x2E, 0xAD, 0xA1,
+    0x40, 0x91, 0x28, 0x6E, 0xA5, 0xB8, 0xD8, 0x83, 0xB5, 0x87, 0x67, 0x66, 0xEF, 0xA2, 0x34, 0x88,
+    0x06, 0x21, 0xFC, 0xEA, 0xDD, 0xF5, 0x7E, 0xCC, 0xD7, 0x33, 0x33, 0x8F, 0x89, 0x9A, 0x7B, 0x84,
+    0xC7, 0xF0, 0xA2, 0xE3, 0x15, 0xC6, 0x8E, 0xD7, 0xE6, 0x3B, 0x22, 0x5E, 0x3B, 0xCE, 0xE4, 0x73,
+    0xC3, 0x9C, 0xEC, 0x41, 0xE1, 0x37, 0x3E, 0xE3, 0xE8, 0x92, 0xCD, 0x7E, 0x6B, 0x0F, 0x9A, 0x2F,
+    0x98, 0x7C, 0x34, 0x25, 0xAC, 0xA6, 0xD0, 0xFC, 0xD3, 0x4E, 0xF3, 0x64, 0x33, 0xCE, 0x37, 0xE2,
+    0x0F, 0x0B, 0xF1, 0xE8, 0x92, 0x2C, 0x1A, 0x76, 0xB2, 0xF0, 0x0B, 0x2F, 0x2E, 0xDB, 0x02, 0x35,
+    0x73, 0xE4, 0x31, 0xA4, 0x6E, 0xF7, 0xD0, 0x1E, 0x3D, 0x0C, 0xF4, 0x3C, 0xF2, 0x41, 0xE7, 0x33,
+    0x33, 0xFF, 0x71, 0xC0, 0x16, 0x9E, 0xD8, 0x32, 0x7F, 0xC3, 0x2B, 0xD1, 0x1B, 0x74, 0x32, 0x12,
+    0x35, 0x3F, 0xA8, 0x53, 0x70, 0xD0, 0x1C, 0xD8, 0xEA, 0xF6, 0x96, 0x97, 0x6E, 0xEF, 0x78, 0x6F,
+    0xF1, 0x83, 0xBE, 0xA6, 0xB8, 0x14, 0xA6, 0xA3, 0x2D, 0x43, 0xF4, 0x23, 0xBB, 0xD4, 0x47, 0x7F,
+    0x51, 0x4C, 0x72, 0x0B, 0x4E, 0x6C, 0xF2, 0x8B, 0xBF, 0xBB, 0xD9, 0xEC, 0x5E, 0x20, 0x90, 0x33,
+    0x09, 0xE8, 0x2A, 0xE4, 0x93, 0x4E, 0xCC, 0x8C, 0x03, 0x5F, 0xF2, 0x04, 0x8D, 0x6F, 0x0A, 0x02,
+    0xF7, 0xF1, 0xBF, 0xC3, 0xC7, 0x48, 0x9E, 0x79, 0xA3, 0xC0, 0x8C, 0xB0, 0x8E, 0x33, 0xA6, 0xB0,
+    0x11, 0xF4, 0x26, 0xB2, 0xAB, 0xDF, 0xA8, 0x4B, 0x7D, 0x26, 0x3A, 0x77, 0xBB, 0x7A, 0x84, 0xA1,
+    0x81, 0x02, 0xA2, 0x19, 0xBE, 0x02, 0x29, 0x0C, 0xEE, 0xD0, 0x13, 0xD9, 0xE4, 0x84, 0x61, 0x28,
+    0x44, 0xB7, 0x2C, 0x47, 0xEA, 0x89, 0x77, 0xFA, 0x0C, 0x11, 0x03, 0x4D, 0xB1, 0x9E, 0xC4, 0xCE,
+    0x0A, 0x79, 0xBD, 0x5B, 0xC4, 0x83, 0x41, 0x06, 0x17, 0x21, 0xFF, 0x75, 0x12, 0xCD, 0xF9, 0x46,
+    0xE9, 0xE9, 0xB7, 0x72, 0x42, 0xB7, 0x47, 0x72, 0x1C, 0x45, 0x62, 0x60, 0x20, 0xF5, 0x7E, 0x02,
+    0xD8, 0xE3, 0x1C, 0x01, 0x08, 0x51, 0x0F, 0x09, 0x79, 0x85, 0x79, 0x07, 0x11, 0xF8, 0x3B, 0x71,
+    0xEC, 0xEF, 0xF2, 0xEF, 0xBB, 0x81, 0x2D, 0x07, 0x84, 0x2D, 0x7F, 0x49, 0x2D, 0x6E, 0x99, 0x48,
+    0xB7, 0x60, 0x69, 0x2E, 0xD4, 0xC2, 0xBE, 0x08, 0xA8, 0x6D, 0x01, 0xE4, 0x42, 0x86, 0x22, 0x2E,
+    0xF2, 0x8F, 0x57, 0x1F, 0xEF, 0x1F, 0xE5, 0x99, 0x90, 0xA3, 0x0F, 0xD6, 0x3E, 0x77, 0xE9, 0x49,
+    0xCB, 0xE3, 0xE7, 0xED, 0xE4, 0xD3, 0xE9, 0x54, 0x23, 0x27, 0x2F, 0x41, 0x1B, 0x95, 0x9F, 0xA5,
+    0x78, 0x9C, 0x06, 0x81, 0x50, 0xE1, 0x8D, 0x78, 0x0D, 0x01, 0x51, 0xBC, 0xDD, 0x40, 0x25, 0x4E,
+    0x5D, 0x0B, 0x9C, 0x0A, 0xCE, 0x48, 0xB2, 0x78, 0xCA, 0x7A, 0xCD, 0xC9, 0x19, 0xA9, 0xB2, 0x5E,
+    0x94, 0x35, 0x15, 0x11, 0xC1, 0xA6, 0xD5, 0xA3, 0xDB, 0xB2, 0xF9, 0x90, 0x1E, 0xD2, 0xDB, 0x34,
+    0x20, 0xA6, 0x96, 0x23, 0x1F, 0x03, 0x3B, 0x5E, 0xBE, 0xDF, 0x67, 0x0E, 0xBC, 0xB6, 0x47, 0xE6,
+    0x27, 0x7E, 0x41, 0x99, 0xF0, 0x26, 0xD3, 0xC4, 0x4B, 0x88, 0x86, 0x1B, 0x8E, 0x21, 0x5A, 0x54,
+    0xCC, 0xC8, 0x93, 0x2B, 0xF0, 0x03, 0x95, 0x99, 0xBB, 0xBD, 0x61, 0x20, 0x66, 0x4A, 0x2B, 0x93,
+    0x2D, 0x00, 0x61, 0x58, 0x65, 0xFB, 0x3D, 0xBF, 0xB8, 0xAD, 0x13, 0x3D, 0x38, 0xE5, 0x12, 0xA2,
+    0x4C, 0x79, 0x9E, 0x06, 0xD4, 0x5B, 0x56, 0x9C, 0x5E, 0xAF, 0x53, 0x5B, 0x5E, 0x9D, 0xBA, 0xBA,
+    0x79, 0x47, 0x1D, 0x25, 0xBF, 0xE8, 0x74, 0x02, 0x4C, 0x8B, 0xE3, 0x8C, 0x2C, 0x07, 0xFE, 0x15,
+    0xC9, 0x0F, 0xBB, 0x80, 0x33, 0x4F, 0x30, 0x8A, 0x96, 0x31, 0x3B, 0xDA, 0x07, 0x98, 0xB5, 0x48,
+    0xDE, 0x90, 0x7A, 0x60, 0x19, 0x16, 0x41, 0x89, 0x7F, 0x4E, 0x02, 0xDD, 0x3C, 0x0A, 0x6A, 0x5A,
+    0x51, 0x15, 0x51, 0xB5, 0x14, 0xD6, 0x97, 0xB8, 0xDA, 0xF2, 0x12, 0xD2, 0x8A, 0xB9, 0x02, 0xDB,
+    0xCC, 0x00, 0x56, 0x92, 0x29, 0xBB, 0x2A, 0xDE, 0x7C, 0x42, 0x9F, 0x5A, 0x84, 0xFD, 0x8C, 0xD7,
+    0xFE, 0x8A, 0x81, 0x00, 0x42, 0x9F, 0x27, 0xBF, 0x0C, 0x88, 0xD4, 0xA5, 0xF6, 0xE8, 0x0A, 0x85,
+    0x47, 0x3B, 0x60, 0x60, 0xEA, 0x4A, 0x80, 0x94, 0x9F, 0xC8, 0x5F, 0x46, 0x35, 0xDB, 0x4A, 0xCF,
+    0x49, 0x6E, 0x87, 0xA5, 0x66, 0x08, 0x97, 0xA9, 0x11, 0x3B, 0xE2, 0x1E, 0xDC, 0xD7, 0xCD, 0x80,
+    0x9B, 0x1E, 0xF5, 0x7C, 0x72, 0xFF, 0x1E, 0xFD, 0x9B, 0x31, 0xBB, 0x9B, 0xFA, 0xC0, 0xBD, 0x07,
+    0xFC, 0xD5, 0x7F, 0x1C, 0x73, 0x0F, 0x1A, 0xB2, 0xD2, 0xA6, 0xE6, 0x1F, 0x63, 0xBE, 0x0E, 0x9A,
+    0x34, 0xEA, 0xA5, 0x95, 0xB0, 0xAF, 0x94, 0x13, 0x24, 0x51, 0x4A, 0x89, 0xD0, 0x3A, 0xD5, 0xE8,
+    0xAC, 0xF8, 0x67, 0xF7, 0x30, 0x69, 0x94, 0xB9, 0xB6, 0x5E, 0xD4, 0xB0, 0x6A, 0x2D, 0x29, 0x0F,
+    0x93, 0xAD, 0x7B, 0xB3, 0xA6, 0xDA, 0xFC, 0xA9, 0xED, 0x13, 0xBE, 0x10, 0xD6, 0x31, 0x45, 0xFB,
+    0xCC, 0x47, 0xB0, 0x91, 0x74, 0x7E, 0x48, 0x5A, 0x71, 0x10, 0x43, 0x83, 0x1B, 0x7E, 0x0E, 0x2F,
+    0x16, 0xA0, 0x80, 0xAE, 0x37, 0x8A, 0x9C, 0x68, 0xA9, 0x45, 0x5A, 0xF5, 0xBB, 0xBA, 0xE7, 0x6B,
+    0xDB, 0x5F, 0xD7, 0x6F, 0xAD, 0xD8, 0xD7, 0xA4, 0x33, 0x47, 0xB4, 0x98, 0x07, 0x6F, 0x83, 0xA9,
+    0x1A, 0x4E, 0x3D, 0x94, 0x65, 0x30, 0xCA, 0xFC, 0x16, 0xF8, 0x28, 0x88, 0x1C, 0xEB, 0x67, 0x42,
+    0xDC, 0x52, 0xE2, 0xD2, 0x64, 0x68, 0x71, 0x3A, 0x59, 0x3B, 0x21, 0x3D, 0xFB, 0xE2, 0x78, 0xA7,
+    0xBB, 0x4C, 0xF3, 0xE5, 0x23, 0xDE, 0xA0, 0x20, 0xE4, 0x0E, 0x0C, 0x94, 0x29, 0x3C, 0xA6, 0x73,
+    0x6A, 0x06, 0xED, 0x76, 0x31, 0xD8, 0x09, 0x33, 0xD0, 0xAE, 0x24, 0x7A, 0x33, 0x08, 0x15, 0xC3,
+    0x6F, 0x09, 0x21, 0xE2, 0x8B, 0x50, 0x14, 0x59, 0xE6, 0xA7, 0xE0, 0xAF, 0xE2, 0x7F, 0x91, 0xFE,
+    0xED, 0x2F, 0xF6, 0x7E, 0xF2, 0x6B, 0xB3, 0xF9, 0xA7, 0x1B, 0xD2, 0xEF, 0x4C, 0x79, 0x17, 0x55,
+    0xA4, 0xE4, 0x27, 0xE5, 0x21, 0xE4, 0x27, 0xD8, 0xC1, 0x43, 0x79, 0x05, 0x2D, 0x36, 0x2C, 0x54,
+    0x23, 0x05, 0x87, 0xFF, 0xAA, 0xAF, 0x42, 0x7A, 0xBE, 0xE2, 0x26, 0xAF, 0x92, 0xE1, 0xBF, 0x51,
+    0x21, 0xCB, 0x4D, 0x49, 0xDE, 0xEA, 0x97, 0x69, 0x32, 0x3A, 0xE1, 0x33, 0xA6, 0xF3, 0xF2, 0x2A,
+    0xB2, 0xE4, 0x27, 0x9D, 0xCC, 0x56, 0x97, 0xA1, 0x4E, 0xB6, 0x5E, 0xA2, 0xC7, 0x75, 0x3A, 0xAD,
+    0x97, 0xFE, 0x2F, 0xCF, 0x5F, 0xCD, 0x55, 0x3D, 0xAF, 0xDD, 0x44, 0x10, 0x1D, 0xDB, 0xE4, 0xB9,
+    0xB0, 0xC4, 0xA6, 0xA1, 0x49, 0xC1, 0xB6, 0x10, 0x29, 0x72, 0x4B, 0x01, 0xB2, 0xA3, 0x88, 0x8A,
+    0x02, 0x8A, 0x3C, 0x10, 0x7D, 0x9A, 0x54, 0x69, 0x52, 0x42, 0x6C, 0x29, 0x7F, 0x00, 0xD1, 0x52,
+    0xA4, 0xA1, 0x7A, 0xBF, 0x21, 0x60, 0xA3, 0x94, 0x29, 0x70, 0x2A, 0x4A, 0xFC, 0x14, 0x94, 0x82,
+    0xE6, 0x1A, 0xC9, 0x44, 0x8E, 0x62, 0xFB, 0x70, 0xCE, 0xEE, 0x7B, 0xE1, 0x81, 0x42, 0x09, 0x62,
+    0xE5, 0x3B, 0xF7, 0xEE, 0xDC, 0xDD, 0x99, 0x39, 0x67, 0x3E, 0x6C, 0xE9, 0xC9, 0x49, 0x6B, 0x19,
+    0xD0, 0x5B, 0x2E, 0x91, 0x1C, 0x1F, 0xDB, 0x85, 0xF5, 0xB9, 0x25, 0x37, 0x3D, 0x6A, 0x37, 0x57,
+    0x68, 0xCB, 0xE9, 0xAA, 0x84, 0xA1, 0xAE, 0x46, 0x83, 0x55, 0x43, 0x02, 0x6B, 0xFA, 0x74, 0xB7,
+    0xAE, 0xCF, 0x36, 0x43, 0x9B, 0xAF, 0x09, 0xEA, 0x62, 0xCD, 0x60, 0x6E, 0x2E, 0x28, 0x26, 0x0F,
+    0xF3, 0xD3, 0x3D, 0xBC, 0xED, 0x9F, 0xAF, 0xF8, 0xDE, 0x63, 0xC2, 0xEA, 0xD1, 0x63, 0x2D, 0x76,
+    0xFB, 0xEE, 0xA1, 0x7D, 0x62, 0x97, 0x57, 0x79, 0x78, 0x25, 0x12, 0x89, 0x62, 0xA6, 0x28, 0x47,
+    0x8A, 0x4B, 0xD6, 0x60, 0x6E, 0xF0, 0x12, 0x78, 0x04, 0xFC, 0x84, 0x2D, 0xC7, 0x46, 0xF3, 0xA9,
+    0x3C, 0x98, 0x5B, 0xAD, 0x9A, 0xF4, 0x30, 0x60, 0xB4, 0xD9, 0x6E, 0xF9, 0x6E, 0x7E, 0xB1, 0x72,
+    0xB6, 0x26, 0xEA, 0x46, 0x06, 0x41, 0x4C, 0x58, 0x04, 0x0A, 0x43, 0x90, 0xB5, 0xD9, 0xED, 0x8F,
+    0x83, 0x37, 0x5E, 0xA4, 0x3B, 0xB4, 0xF2, 0xB7, 0xBD, 0x52, 0xE8, 0xA2, 0xD9, 0x1D, 0xDE, 0xD1,
+    0x71, 0x6A, 0x4A, 0x04, 0x4D, 0x1A, 0x8E, 0xB8, 0x70, 0xA4, 0xD2, 0x1D, 0x0B, 0x8A, 0x2C, 0x28,
+    0x5C, 0x50, 0xBC, 0xC3, 0xCF, 0x2D, 0xBB, 0x54, 0x77, 0x73, 0x82, 0x02, 0x83, 0x5B, 0xAE, 0x8A,
+    0x9E, 0x8C, 0x7C, 0xF0, 0x5E, 0xBE, 0x5A, 0xD3, 0x96, 0x63, 0xAA, 0xF0, 0x8B, 0x85, 0xA1, 0x97,
+    0x2F, 0x69, 0xBD, 0x92, 0xF1, 0xE6, 0xE9, 0x2E, 0x1B, 0xC2, 0x5C, 0x3D, 0x22, 0xF7, 0xE8, 0x18,
+    0x11, 0xB8, 0xF5, 0xF2, 0x5C, 0x3D, 0xA0, 0xFE, 0xB2, 0x9C, 0x65, 0x3A, 0xE1, 0x06, 0x1D, 0x23,
+    0x8A, 0x5C, 0x20, 0x1A, 0x85, 0x76, 0x53, 0x1C, 0x55, 0x58, 0x19, 0x6E, 0x87, 0xA5, 0xC1, 0xD0,
+    0x60, 0xCC, 0x37, 0xB1, 0x41, 0x92, 0x08, 0xCD, 0x9D, 0x4B, 0x3D, 0xCB, 0x35, 0x4A, 0xBF, 0x7C,
+    0x40, 0xA2, 0xFC, 0xF2, 0x3E, 0xB9, 0x72, 0xDB, 0x17, 0x04, 0xEE, 0xB0, 0x33, 0x1C, 0x11, 0x34,
+    0x31, 0x00, 0x80, 0xDC, 0x1F, 0xCD, 0x1D, 0x7D, 0x25, 0x93, 0x82, 0x48, 0x47, 0xC9, 0xEC, 0x34,
+    0xB0, 0x15, 0x39, 0x4B, 0x45, 0x25, 0xD9, 0x51, 0x96, 0x44, 0xB1, 0xAE, 0xCD, 0x22, 0x20, 0x21,
+    0x01, 0x86, 0x8F, 0x30, 0xE4, 0x2B, 0x09, 0x28, 0xC7, 0x6C, 0x65, 0xAD, 0x38, 0x7D, 0x35, 0x1F,
+    0xFA, 0x29, 0xDD, 0xDE, 0xEB, 0xFA, 0xE2, 0x77, 0x42, 0x26, 0x01, 0xF3, 0x19, 0x01, 0xCF, 0x41,
+    0xE3, 0x8F, 0x69, 0xE3, 0xCD, 0xEA, 0xB4, 0xB5, 0xBB, 0x38, 0x70, 0x0B, 0xE2, 0x73, 0xF2, 0x5A,
+    0x0A, 0xF6, 0x1B, 0x82, 0x0E, 0x04, 0x8F, 0x62, 0xCB, 0xCB, 0x23, 0x1D, 0xFF, 0x3D, 0x9E, 0x0C,
+    0xF6, 0xA7, 0xDC, 0xAF, 0x7C, 0x1B, 0xB2, 0xC8, 0xFF, 0x8B, 0x80, 0xC9, 0xE1, 0x57, 0xE2, 0x8B,
+    0x75, 0xE3, 0x16, 0x49, 0x3F, 0x4B, 0x96, 0xD3, 0x59, 0x25, 0xB1, 0xA4, 0x29, 0x9B, 0x51, 0x0F,
+    0xD1, 0xF3, 0x41, 0x7F, 0x84, 0x25, 0xC7, 0x52, 0x62, 0x2B, 0xB1, 0x56, 0xE1, 0x61, 0x8E, 0x95,
+    0x21, 0xC6, 0xD6, 0xD1, 0x69, 0xAA, 0x48, 0x65, 0x22, 0x86, 0x93, 0x29, 0x55, 0x5E, 0xBB, 0xAE,
+    0x7F, 0x97, 0x3B, 0xC7, 0xEC, 0xFF, 0xC6, 0x23, 0xD5, 0xCF, 0x98, 0x93, 0x7D, 0xAB, 0x06, 0x5E,
+    0x64, 0x5D, 0xAC, 0xCC, 0x1F, 0x86, 0x72, 0xCC, 0x41, 0x76, 0xCA, 0x59, 0x24, 0xF5, 0x7E, 0x62,
+    0x11, 0x77, 0xAD, 0x9F, 0x69, 0xA3, 0xE9, 0xDD, 0xF4, 0x35, 0x3B, 0xEB, 0xF0, 0xE3, 0x92, 0x62,
+    0xAF, 0x86, 0x1C, 0xA7, 0x34, 0xB4, 0x85, 0x96, 0x08, 0x2B, 0x34, 0x68, 0x12, 0x0A, 0x9A, 0x52,
+    0x9C, 0x74, 0x4C, 0x40, 0x52, 0x97, 0xEC, 0x91, 0x1F, 0xD4, 0x5D, 0x6E, 0x6D, 0xAE, 0x33, 0x20,
+    0x3C, 0x9E, 0x84, 0x76, 0x85, 0x8A, 0x9C, 0x1B, 0x86, 0xED, 0x96, 0xE6, 0xB0, 0x1D, 0x7F, 0x8A,
+    0x1B, 0xD0, 0x9A, 0xC4, 0x0D, 0x0D, 0xE4, 0x38, 0xD1, 0x10, 0x88, 0x5D, 0x10, 0x19, 0xB4, 0x6A,
+    0x8E, 0x1B, 0xA2, 0xAC, 0xAD, 0x24, 0xCE, 0x87, 0x74, 0x36, 0xAA, 0xEC, 0x1C, 0x9E, 0x31, 0xCD,
+    0xAC, 0x3C, 0xB9, 0x4E, 0x62, 0x63, 0x31, 0x50, 0xE5, 0x80, 0x05, 0x19, 0xD6, 0x95, 0x3A, 0x96,
+    0x70, 0xAA, 0x04, 0x94, 0xCF, 0xC0, 0x1E, 0xCA, 0xD6, 0x6B, 0x6E, 0xF4, 0x4F, 0xA7, 0xCE, 0xE0,
+    0xEF, 0x2F, 0xC5, 0x7C, 0xAF, 0x7C, 0x82, 0xEB, 0x1B, 0xBA, 0x39, 0x93, 0x9D, 0x34, 0x58, 0xA1,
+    0xF1, 0xAF, 0xC8, 0x89, 0x6F, 0x33, 0x7C, 0xB6, 0xC7, 0x26, 0x74, 0x72, 0x52, 0x88, 0xDD, 0xA4,
+    0xFE, 0xBF, 0xA3, 0x0F, 0xF9, 0xE7, 0xDD, 0xDE, 0xCE, 0x5B, 0x96, 0xE7, 0x82, 0xCC, 0x83, 0x6D,
+    0xFB, 0x32, 0xC8, 0xAC, 0xBF, 0x38, 0x60, 0xFF, 0x0D, 0xAA, 0xE2, 0xB8, 0x90, 0x9B, 0x4A, 0x2E,
+    0xD4, 0x2F, 0x99, 0x86, 0x87, 0xB3, 0x0B, 0xFD, 0x44, 0xF4, 0x7D, 0x22, 0xA7, 0x82, 0x1C, 0x1A,
+    0x49, 0x4D, 0x2F, 0x16, 0xD8, 0x25, 0xFF, 0xA0, 0xDC, 0x5F, 0xA3, 0xE4, 0xB0, 0x09, 0x1D, 0x78,
+    0x84, 0x17, 0xC1, 0x66, 0x16, 0x46, 0x88, 0x9D, 0xBB, 0x8A, 0xF8, 0xE3, 0x57, 0x31, 0x9C, 0x61,
+    0xCF, 0x96, 0x34, 0x32, 0x62, 0xF8, 0x26, 0xF2, 0xC4, 0xE6, 0x5E, 0xE2, 0x8F, 0x04, 0xBF, 0xD8,
+    0xEB, 0x57, 0x2C, 0xAE, 0xB7, 0x34, 0xA8, 0xF9, 0x32, 0xD0, 0xA8, 0x6F, 0xF8, 0xB2, 0x61, 0xA7,
+    0x6C, 0x64, 0xB0, 0x6E, 0x76, 0x26, 0xC5, 0xB2, 0xC3, 0xC4, 0x34, 0x54, 0x87, 0xD6, 0x6A, 0x0D,
+    0x9F, 0xAA, 0x27, 0x57, 0x65, 0x5B, 0xF5, 0x65, 0x1F, 0xD2, 0xE0, 0x27, 0x1F, 0x22, 0x58, 0x39,
+    0x88, 0x87, 0xE0, 0xF6, 0xC6, 0x56, 0x8C, 0x31, 0x45, 0x88, 0x59, 0x22, 0xBF, 0x98, 0xCF, 0x7F,
+    0xEC, 0x31, 0xA2, 0x07, 0x2F, 0xBA, 0x70, 0x0D, 0xF7, 0xB7, 0x30, 0xAC, 0x19, 0x01, 0xD2, 0xF0,
+    0x1F, 0x47, 0x6E, 0x1F, 0x46, 0x31, 0x46, 0x3F, 0x39, 0x41, 0xE8, 0xA6, 0x82, 0x7D, 0x2B, 0x4D,
+    0x88, 0x84, 0x36, 0x69, 0x2E, 0x34, 0x70, 0x82, 0x85, 0xE0, 0x12, 0xF0, 0xBD, 0xC9, 0x13, 0x1C,
+    0x90, 0xBB, 0x26, 0x1C, 0x29, 0x13, 0x7D, 0xF5, 0x5F, 0x19, 0xFB, 0xCF, 0xD6, 0x1F, 0xD5, 0x55,
+    0xB1, 0xAE, 0xDC, 0x44, 0x14, 0xBD, 0xF6, 0xBC, 0x30, 0x52, 0x5C, 0xF8, 0x35, 0x34, 0x10, 0xE1,
+    0x26, 0x05, 0x12, 0x12, 0xFB, 0x07, 0x8C, 0x81, 0x82, 0x82, 0x82, 0x34, 0xA4, 0xA5, 0xA1, 0x49,
+    0x15, 0x3E, 0x20, 0xC2, 0x8B, 0xE8, 0xA8, 0xF8, 0x84, 0x57, 0x40, 0x81, 0x52, 0xD0, 0xD0, 0x86,
+    0x31, 0x7A, 0x1D, 0x34, 0xA6, 0x88, 0xD2, 0x3A, 0x2D, 0x29, 0x9E, 0xA5, 0x38, 0x92, 0x1F, 0x19,
+    0xFB, 0x72, 0xCE, 0x9D, 0xDD, 0xA7, 0x2D, 0xF8, 0x00, 0xB0, 0xD6, 0x1E, 0x79, 0x3C, 0x73, 0xEF,
+    0x39, 0xE7, 0x9E, 0xB9, 0x2B, 0x72, 0x72, 0x7D, 0xCF, 0xC7, 0x4E, 0xDE, 0xE1, 0xE0, 0x26, 0x37,
+    0x70, 0xEC, 0xBE, 0x49, 0xF6, 0xAA, 0x6A, 0x4B, 0x1A, 0xDD, 0xDB, 0xF8, 0x66, 0x7B, 0xB2, 0xEF,
+    0x81, 0xDC, 0x6A, 0x8B, 0x0B, 0xE9, 0x92, 0x5B, 0x4A, 0xED, 0x1B, 0x1D, 0x42, 0x1B, 0x57, 0xAF,
+    0xEA, 0xA7, 0x9D, 0xF6, 0xBF, 0x3E, 0x9C, 0xA2, 0x9F, 0xDF, 0xF5, 0xAD, 0xD6, 0xE3, 0x8A, 0xC5,
+    0xD5, 0xCB, 0x35, 0x30, 0x46, 0xD4, 0x3F, 0x26, 0xBE, 0xEA, 0x6A, 0x91, 0x55, 0x75, 0xC4, 0x50,
+    0xBF, 0x54, 0x2E, 0x2A, 0x52, 0x77, 0xC5, 0xF4, 0xE1, 0xD3, 0xEB, 0x55, 0xDA, 0xF3, 0x6A, 0xD4,
+    0x66, 0x7A, 0xDF, 0x3D, 0x4B, 0xF5, 0xA0, 0x57, 0x63, 0xD4, 0x22, 0xD5, 0x9A, 0x2A, 0x1D, 0x76,
+    0x7D, 0xA7, 0xD2, 0x8D, 0x6E, 0x2E, 0x01, 0xEB, 0x9E, 0x9C, 0x4B, 0x71, 0x40, 0x54, 0xB4, 0x12,
+    0x34, 0x89, 0xF6, 0x25, 0xC2, 0x02, 0xB3, 0xD7, 0x4D, 0x18, 0x58, 0xF7, 0xF5, 0x36, 0x89, 0x5F,
+    0x25, 0x7E, 0xD8, 0xCA, 0x6E, 0xF2, 0x33, 0x33, 0xF7, 0xC4, 0xE3, 0xD4, 0x91, 0x68, 0xB3, 0x34,
+    0x3D, 0x59, 0x3F, 0x25, 0x0A, 0x6C, 0xDE, 0x88, 0x49, 0x8D, 0x7C, 0xB8, 0x8E, 0x78, 0x2B, 0x74,
+    0xBF, 0xC3, 0xB7, 0x6A, 0x95, 0xDD, 0x82, 0xB9, 0x89, 0x3F, 0x84, 0xE0, 0xCF, 0x6D, 0x88, 0x82,
+    0x10, 0xB3, 0xD4, 0x08, 0x15, 0x7B, 0x7E, 0x6A, 0xC0, 0x4A, 0xF7, 0x44, 0x81, 0xA4, 0x08, 0xD4,
+    0xEE, 0x26, 0x03, 0x98, 0x65, 0xE4, 0x3A, 0xF1, 0x12, 0x49, 0xB5, 0xFB, 0xF9, 0x90, 0x92, 0x2F,
+    0x5E, 0x17, 0x7E, 0x2F, 0x7F, 0xB2, 0xC5, 0x5F, 0xCA, 0xED, 0x12, 0x01, 0x92, 0x6A, 0xA1, 0xBF,
+    0xC7, 0x31, 0xA4, 0x72, 0xAB, 0x9E, 0xB7, 0xE1, 0xCF, 0x24, 0x2E, 0x05, 0xEC, 0xBC, 0x1C, 0x81,
+    0xE7, 0x09, 0x35, 0x5C, 0x98, 0x63, 0x2A, 0xF4, 0xBE, 0xEE, 0x9B, 0xA9, 0xC2, 0x3A, 0x09, 0x7D,
+    0x18, 0xDC, 0x0A, 0x6E, 0x61, 0xE8, 0x7A, 0x97, 0xAA, 0x19, 0x33, 0x60, 0xCB, 0xC4, 0x1D, 0x6A,
+    0x58, 0x4F, 0x72, 0xA7, 0x5C, 0xC5, 0xBF, 0x02, 0xDC, 0xA8, 0x13, 0x08, 0x20, 0xF1, 0x1B, 0x3F,
+    0x58, 0xE5, 0x41, 0x9B, 0x3C, 0xF2, 0xD0, 0xE5, 0x02, 0xB9, 0x44, 0x8A, 0xE2, 0x16, 0x4F, 0x65,
+    0xFC, 0xEC, 0xAD, 0xA4, 0x48, 0x45, 0x36, 0xA3, 0xF1, 0xA9, 0x07, 0x1B, 0x9A, 0xBE, 0x21, 0x87,
+    0xD0, 0xEF, 0x28, 0x72, 0x68, 0xA9, 0x93, 0x44, 0x93, 0x4B, 0x00, 0x0B, 0xB1, 0x8A, 0x15, 0xB5,
+    0x33, 0x2C, 0x14, 0x00, 0xB5, 0x80, 0x86, 0x04, 0x84, 0xE1, 0x6E, 0xE8, 0x21, 0x34, 0x6A, 0x08,
+    0xE9, 0x5A, 0x40, 0x90, 0xB7, 0x81, 0x2B, 0xA2, 0xA0, 0x28, 0x62, 0x18, 0x0B, 0x22, 0x3A, 0x63,
+    0x7E, 0x53, 0x89, 0x7B, 0xCC, 0x9B, 0x66, 0x58, 0x09, 0xD9, 0xA1, 0x31, 0x1B, 0x61, 0x39, 0xB1,
+    0xB6, 0xBC, 0xF5, 0x23, 0x0D, 0x0E, 0x9A, 0x94, 0x89, 0x62, 0x33, 0x71, 0xF8, 0x18, 0x70, 0xAB,
+    0xB1, 0x43, 0xF2, 0x54, 0x2D, 0x04, 0x8E, 0x94, 0x6E, 0x66, 0xD0, 0x50, 0x6C, 0x64, 0x17, 0xB0,
+    0x8A, 0x12, 0xE2, 0x53, 0xF7, 0x5B, 0xE1, 0x96, 0x2A, 0x3D, 0xFA, 0x40, 0x25, 0x5E, 0x5D, 0xEA,
+    0x08, 0x1F, 0x06, 0xC2, 0xFA, 0x76, 0x43, 0xCD, 0x26, 0xD8, 0xEF, 0xEC, 0x6B, 0x43, 0xD4, 0xDF,
+    0xE4, 0x0E, 0x7C, 0x54, 0x06, 0xED, 0x97, 0xE3, 0x81, 0x41, 0x76, 0x16, 0x9A, 0xB6, 0xA0, 0x4D,
+    0x1B, 0xC5, 0xB9, 0xD9, 0x5A, 0xDA, 0x81, 0x74, 0x8D, 0x39, 0xB2, 0x43, 0x38, 0x8A, 0xCD, 0x9B,
+    0x3A, 0x61, 0x0A, 0xAE, 0x13, 0x0A, 0x8F, 0x62, 0x71, 0x8A, 0x3A, 0x57, 0xA8, 0x0B, 0x75, 0xE3,
+    0xB0, 0x64, 0xAF, 0xFE, 0x7B, 0x88, 0x90, 0x43, 0xB0, 0x60, 0x7C, 0x25, 0xF3, 0x63, 0x88, 0xD5,
+    0x1C, 0xEC, 0xF5, 0x1A, 0xF6, 0xA7, 0x03, 0x47, 0xA2, 0x08, 0x94, 0x3A, 0x0B, 0xEB, 0xB6, 0x0C,
+    0xDB, 0x7C, 0x2A, 0x5F, 0x59, 0x79, 0xA5, 0x79, 0x61, 0xE7, 0xF6, 0x60, 0x58, 0x70, 0xC8, 0x6B,
+    0xDF, 0xBB, 0xC8, 0x8E, 0xBD, 0xF5, 0x91, 0x4E, 0x6E, 0x83, 0xCA, 0xE1, 0xAF, 0x38, 0xB9, 0x15,
+    0x4E, 0xEC, 0xE0, 0xC4, 0x2A, 0xB9, 0x15, 0xDE, 0xEF, 0x9E, 0x7E, 0x31, 0x13, 0x78, 0x8B, 0x7B,
+    0xAA, 0xFF, 0x7E, 0x0C, 0x5F, 0x03, 0x5F, 0xC3, 0x75, 0xCA, 0x75, 0xA3, 0xAD, 0x8B, 0x7D, 0xD7,
+    0xD7, 0x0B, 0x4A, 0x02, 0x34, 0xD2, 0x20, 0x7C, 0xB9, 0x99, 0xA1, 0xE4, 0x0E, 0xEA, 0xEE, 0x5F,
+    0x91, 0x04, 0x72, 0x7B, 0x9D, 0x0F, 0x8E, 0xFD, 0xCF, 0xAA, 0x1A, 0x8F, 0xA0, 0x94, 0xAA, 0xFA,
+    0xDC, 0xE9, 0x0E, 0x87, 0x90, 0x07, 0x6D, 0x7F, 0xEA, 0xE2, 0xF2, 0x38, 0x9B, 0x3B, 0xAC, 0x39,
+    0x09, 0xD7, 0x45, 0x56, 0xB5, 0xDD, 0x51, 0x29, 0x06, 0x1A, 0x1F, 0xE3, 0x31, 0x98, 0xAE, 0xA6,
+    0x95, 0x09, 0xEB, 0xD7, 0xCF, 0xB5, 0x25, 0xF8, 0xDC, 0xB4, 0x20, 0xED, 0x26, 0x94, 0x95, 0x8F,
+    0x74, 0x8E, 0x86, 0x97, 0x1E, 0x41, 0xDC, 0x2D, 0xA1, 0x12, 0x9A, 0xBA, 0xBE, 0xD2, 0x25, 0xA2,
+    0x37, 0x32, 0xF1, 0x27, 0xE3, 0x31, 0x59, 0xB3, 0x3F, 0xBA, 0xF6, 0xC9, 0x89, 0x69, 0x3B, 0x9D,
+    0x3B, 0x7D, 0xAD, 0x7A, 0xA9, 0xFA, 0x8C, 0x1C, 0xD6, 0x42, 0x5B, 0xC8, 0x8A, 0x83, 0x0F, 0xB2,
+    0xB9, 0x0D, 0xB2, 0x0B, 0xEE, 0xE1, 0x15, 0x68, 0x09, 0x1F, 0x41, 0xA4, 0x2E, 0xCF, 0x8D, 0x50,
+    0xC6, 0x99, 0x90, 0xA0, 0x6E, 0x15, 0xA3, 0x98, 0xF2, 0xE0, 0x33, 0x63, 0x6A, 0x1E, 0x2B, 0xAC,
+    0x1F, 0x52, 0xB2, 0xC3, 0x84, 0xF5, 0x02, 0x79, 0x48, 0xA5, 0x2A, 0x73, 0x58, 0xB0, 0x1E, 0xCC,
+    0x7D, 0x07, 0xDD, 0xEA, 0xE1, 0xE6, 0x74, 0x89, 0x1D, 0xB4, 0xFC, 0x7F, 0x75, 0x5B, 0x6E, 0xFC,
+    0x37, 0xF8, 0x14, 0x21, 0xCA, 0x77, 0xB1, 0xAF, 0x67, 0x97, 0x68, 0xB1, 0xBE, 0x99, 0xFC, 0x02,
+    0xC9, 0x62, 0xDB, 0x0D, 0xD5, 0x52, 0x43, 0xB6, 0x2B, 0xED, 0x1D, 0xBB, 0x49, 0xB3, 0x10, 0x41,
+    0x6D, 0xFF, 0x07, 0x92, 0xDD, 0xE6, 0x95, 0x37, 0xBB, 0xFB, 0x76, 0x28, 0xCE, 0x6A, 0x6D, 0xED,
+    0x70, 0xB0, 0x1B, 0x40, 0x29, 0x39, 0x7B, 0x26, 0xFF, 0xE3, 0xEB, 0x1F, 0xD5, 0x55, 0xBD, 0x92,
+    0xDE, 0x34, 0x14, 0xBD, 0xB2, 0xB2, 0xF1, 0x4C, 0x3C, 0x83, 0x52, 0x90, 0xEA, 0x2B, 0xDC, 0xA4,
+    0x64, 0xD0, 0x0B, 0x30, 0x23, 0x51, 0x51, 0xD0, 0x6C, 0xC1, 0x56, 0x79, 0x82, 0xAD, 0xF6, 0x05,
+    0x48, 0xE4, 0x24, 0x25, 0x05, 0x5B, 0xD1, 0xA4, 0xA5, 0xDA, 0x86, 0x86, 0x82, 0x86, 0xB5, 0x06,
+    0x1E, 0x00, 0x37, 0xE9, 0x1D, 0x42, 0x05, 0xC5, 0x3A, 0x33, 0xCE, 0xC6, 0x9B, 0xC8, 0xBE, 0x9C,
+    0x2B, 0x7D, 0x9B, 0x09, 0x13, 0x1A, 0x98, 0xA1, 0x40, 0xF3, 0x59, 0xFA, 0xAC, 0x9F, 0xAB, 0x73,
+    0xCE, 0xFD, 0x31, 0x29, 0x66, 0xA2, 0x3E, 0x3F, 0x91, 0x02, 0x9E, 0x86, 0x27, 0x72, 0xDC, 0x61,
+    0x62, 0xA5, 0x96, 0x3D, 0xE1, 0xC5, 0x1B, 0x1E, 0x08, 0x2F, 0x43, 0xCD, 0x33, 0x51, 0xF3, 0x66,
+    0xD1, 0xAF, 0x12, 0x91, 0x7E, 0xBD, 0xA9, 0x84, 0x83, 0x94, 0x42, 0x5C, 0x5D, 0xC4, 0x81, 0x76,
+    0xC2, 0x0F, 0x07, 0x1E, 0x27, 0x57, 0x63, 0x83, 0x19, 0xF8, 0xE4, 0x11, 0x36, 0xD4, 0x93, 0xBB,
+    0x88, 0x7D, 0x24, 0x9D, 0x1A, 0x1E, 0x2D, 0x36, 0xAC, 0x8A, 0x27, 0xB3, 0x10, 0x05, 0x0A, 0x8B,
+    0xDE, 0x88, 0x6C, 0x34, 0x89, 0x70, 0xA5, 0x19, 0xF5, 0x4A, 0x6E, 0xA4, 0x7A, 0xA6, 0x9E, 0xB0,
+    0xA1, 0x4A, 0x64, 0x3D, 0xA6, 0x6E, 0xF2, 0x29, 0xD1, 0x8E, 0x97, 0x86, 0x93, 0xC0, 0xE0, 0xC7,
+    0x82, 0xB9, 0x61, 0x01, 0x25, 0xCD, 0x4C, 0x65, 0x6C, 0xE6, 0x32, 0xEA, 0x65, 0x3F, 0xA6, 0x32,
+    0x56, 0xFB, 0x91, 0xAE, 0xC7, 0xBB, 0x78, 0xD4, 0x31, 0xD1, 0xB1, 0x27, 0xDE, 0xC8, 0xB0, 0x6F,
+    0x78, 0x25, 0xD8, 0xBE, 0xC3, 0x4B, 0xCD, 0x23, 0x69, 0x9E, 0x5C, 0xEF, 0xA9, 0xFD, 0xEE, 0xA7,
+    0x4B, 0x9C, 0xB8, 0x1F, 0xCC, 0x2F, 0x13, 0x55, 0x2F, 0xD7, 0xFB, 0x0E, 0x08, 0x7F, 0x7E, 0xF5,
+    0x62, 0x05, 0x43, 0xC3, 0x9F, 0xCD, 0xA4, 0x16, 0x97, 0x2C, 0x04, 0x1B, 0x78, 0x00, 0x1E, 0xA7,
+    0x59, 0xA7, 0xDB, 0x2A, 0x99, 0xC5, 0xFC, 0xFA, 0xFC, 0x62, 0x70, 0xD1, 0x5D, 0x7C, 0xCD, 0xC4,
+    0x8A, 0x57, 0x37, 0xEB, 0x19, 0x36, 0xD9, 0x1F, 0x40, 0xC8, 0x78, 0x88, 0xCB, 0x6F, 0xFC, 0x58,
+    0x00, 0x16, 0xE0, 0xD6, 0x4B, 0xAF, 0x0A, 0x6A, 0x13, 0xF3, 0xF0, 0x09, 0x5D, 0xB7, 0x9B, 0x67,
+    0x67, 0x40, 0x04, 0xC7, 0x08, 0xDF, 0x5A, 0x1C, 0x22, 0xCE, 0x71, 0x43, 0xE1, 0x2D, 0x3A, 0x57,
+    0xE2, 0x84, 0x7F, 0x3E, 0xD9, 0xEE, 0x27, 0x77, 0xA0, 0x6C, 0x21, 0x80, 0x11, 0x55, 0x73, 0xBB,
+    0x5D, 0xD0, 0xE1, 0x2A, 0x35, 0xD3, 0xF7, 0xF8, 0xEB, 0xA2, 0x95, 0x89, 0xED, 0x64, 0x24, 0x71,
+    0x40, 0x46, 0x1A, 0x56, 0x7A, 0xAF, 0x29, 0xFF, 0x8E, 0xEE, 0x9C, 0x99, 0xD8, 0xBC, 0xAD, 0x2E,
+    0xBE, 0x82, 0xDA, 0x62, 0xE0, 0x42, 0x78, 0xEB, 0xAB, 0x7C, 0x5D, 0x9F, 0xBD, 0x67, 0x46, 0x21,
+    0xA6, 0x93, 0x44, 0x05, 0x05, 0x8F, 0x60, 0x01, 0xE6, 0x46, 0x10, 0xAF, 0x14, 0xF0, 0xE2, 0x9E,
+    0xDE, 0x83, 0x1D, 0x20, 0x04, 0x56, 0x44, 0xAC, 0x20, 0x75, 0xBF, 0x9F, 0xF5, 0x13, 0x35, 0x4B,
+    0x26, 0x85, 0x9F, 0x9D, 0xC9, 0xCA, 0x62, 0xB7, 0xDB, 0x3C, 0x82, 0xF9, 0x73, 0x30, 0x0A, 0x9C,
+    0x20, 0x5C, 0xC3, 0x05, 0x49, 0x6E, 0xA7, 0xA4, 0x26, 0x82, 0x8B, 0x27, 0x3D, 0x20, 0x4E, 0xDA,
+    0x28, 0xD2, 0x7A, 0x9C, 0x12, 0xC8, 0x77, 0xFC, 0xF5, 0xAE, 0x63, 0x75, 0x08, 0xC8, 0x70, 0xBB,
+    0x65, 0x64, 0x43, 0xFF, 0x86, 0x07, 0xD8, 0xED, 0x23, 0x62, 0xB5, 0x8F, 0x8D, 0x84, 0x2A, 0x70,
+    0x32, 0x04, 0x54, 0x4C, 0x76, 0xD2, 0x8C, 0x98, 0xAD, 0x37, 0x74, 0x46, 0xA2, 0xD7, 0x4A, 0x77,
+    0x9E, 0x3E, 0x72, 0x97, 0x57, 0x9C, 0x2C, 0x3F, 0xE3, 0xA5, 0xE5, 0x87, 0x3C, 0x36, 0x1B, 0xE1,
+    0xA2, 0xC3, 0xA2, 0xED, 0x87, 0xE4, 0x33, 0xE9, 0x5E, 0xA2, 0x93, 0x8D, 0xC4, 0xAD, 0x7B, 0x26,
+    0x72, 0x54, 0x8B, 0x19, 0xFE, 0x6F, 0xAA, 0xAA, 0xD4, 0x40, 0xCB, 0x15, 0xDB, 0xEA, 0x84, 0xB8,
+    0xD2, 0xB3, 0x45, 0x80, 0xF9, 0x1B, 0x7F, 0xA1, 0xF0, 0x5F, 0x0B, 0xAA, 0x39, 0x93, 0x90, 0x62,
+    0xC5, 0x45, 0x8E, 0x93, 0xFD, 0x84, 0xE6, 0xF9, 0x20, 0x8B, 0x75, 0xCE, 0x25, 0xB7, 0x5A, 0xA0,
+    0x10, 0x29, 0xEB, 0x17, 0x1B, 0xDD, 0x92, 0x85, 0xD5, 0x16, 0xC9, 0x51, 0xB6, 0x4A, 0x19, 0x99,
+    0x5C, 0x66, 0x56, 0xAD, 0xB5, 0x80, 0x15, 0xE5, 0x8A, 0x4D, 0x33, 0x9A, 0x4C, 0x5A, 0xA3, 0x7E,
+    0x15, 0x5F, 0x94, 0x75, 0x21, 0x95, 0xEF, 0xAC, 0xD7, 0xA3, 0x30, 0xD0, 0x97, 0x90, 0x0B, 0x7B,
+    0xE4, 0x36, 0x18, 0x0A, 0x51, 0x25, 0x82, 0x87, 0xC1, 0x32, 0x44, 0xA4, 0x2F, 0x6C, 0xF2, 0xA2,
+    0x79, 0xAB, 0xB2, 0xDE, 0x8E, 0x07, 0xB7, 0xB7, 0x72, 0xEC, 0xD5, 0xB7, 0xB8, 0x8B, 0x1F, 0xA1,
+    0xC6, 0x5A, 0x59, 0x84, 0xC4, 0x3D, 0x3F, 0x49, 0x10, 0xCA, 0x8D, 0xA8, 0x26, 0xA3, 0x4E, 0x28,
+    0xA0, 0x89, 0x7A, 0xDF, 0x7B, 0xE8, 0x35, 0xD9, 0xB1, 0x9D, 0xAA, 0xCD, 0x2C, 0x70, 0x94, 0xFB,
+    0x43, 0x24, 0x6A, 0x00, 0x02, 0x82, 0x0A, 0x14, 0x1C, 0x58, 0xE9, 0x96, 0xDE, 0x50, 0x6F, 0xF5,
+    0xE4, 0x2E, 0x5F, 0xF3, 0x37, 0x8C, 0xFB, 0x04, 0x7D, 0xCB, 0xB1, 0x87, 0x2E, 0x61, 0xAC, 0xF8,
+    0x37, 0x82, 0x7A, 0xE4, 0xDF, 0x75, 0x93, 0xA4, 0xFC, 0x03, 0xFA, 0x58, 0x4A, 0x26, 0x32, 0x9F,
+    0xCC, 0xDA, 0x77, 0x92, 0xEF, 0x29, 0x67, 0xBD, 0x7F, 0x3F, 0xDF, 0x45, 0x01, 0xA9, 0x9E, 0xCC,
+    0xF2, 0xAD, 0x10, 0x1E, 0x7A, 0x53, 0x27, 0x91, 0xDA, 0x19, 0xB5, 0x1D, 0xAE, 0x45, 0x4D, 0x83,
+    0x33, 0xEB, 0x48, 0x26, 0x4B, 0x1B, 0xC4, 0x21, 0x2A, 0x1B, 0xC2, 0x99, 0x25, 0x7B, 0x6B, 0xC8,
+    0x46, 0xA0, 0x5D, 0x56, 0xD0, 0xCE, 0x6F, 0x63, 0x1C, 0x07, 0xAB, 0x51, 0xBE, 0x02, 0x48, 0x52,
+    0xA8, 0xBA, 0x21, 0x22, 0xFD, 0x0E, 0x76, 0x8B, 0x32, 0x45, 0x3C, 0xE6, 0xF9, 0x2D, 0x94, 0x48,
+    0x3F, 0xA0, 0x56, 0x05, 0xC8, 0x6F, 0x87, 0x07, 0x08, 0x36, 0xD8, 0x0C, 0xB0, 0xA9, 0xBE, 0xB8,
+    0xAE, 0xA3, 0xA7, 0xA2, 0xAE, 0x7C, 0xE7, 0x46, 0xEA, 0x9F, 0x24, 0xF1, 0x2A, 0xB9, 0x2E, 0x74,
+    0x36, 0xBA, 0x68, 0x46, 0x3B, 0xD4, 0x73, 0x18, 0xAA, 0x0D, 0x78, 0x18, 0x05, 0xD2, 0x49, 0x5E,
+    0xCC, 0x74, 0x17, 0x6E, 0x0C, 0xC4, 0x4F, 0xB9, 0x03, 0xBB, 0xA8, 0x65, 0xC5, 0x0A, 0x4E, 0xA9,
+    0xE1, 0x74, 0x20, 0x7D, 0x8F, 0x03, 0xE2, 0xCA, 0xDC, 0x21, 0x7C, 0x3B, 0xAC, 0x9F, 0xE3, 0x25,
+    0x7E, 0x00, 0x76, 0x02, 0x2E, 0xF3, 0x52, 0x99, 0x91, 0xCB, 0x39, 0x99, 0x0E, 0x8E, 0x8E, 0xEE,
+    0x89, 0x2F, 0x98, 0xBF, 0x92, 0xEE, 0xB9, 0x74, 0xB3, 0x7C, 0xFD, 0x12, 0x68, 0x36, 0x1B, 0xB4,
+    0xD3, 0x5C, 0xAF, 0xE8, 0x3E, 0xE5, 0x4E, 0xC3, 0xF9, 0x57, 0xBB, 0x42, 0xB8, 0x13, 0xA1, 0x3C,
+    0x98, 0x5D, 0xC9, 0xE5, 0x7F, 0xE7, 0x8D, 0x7F, 0xD1, 0xFE, 0x04, 0xB5, 0x55, 0xB1, 0x8E, 0xDD,
+    0x44, 0x14, 0xBD, 0xF6, 0xEC, 0xC6, 0x48, 0x53, 0x4C, 0x0A, 0xD2, 0x80, 0x90, 0x7B, 0x1A, 0xB7,
+    0x34, 0x30, 0x56, 0xF2, 0x03, 0x29, 0xB2, 0x05, 0x15, 0xFC, 0x41, 0x1A, 0x5A, 0x62, 0x53, 0x51,
+    0x66, 0xFF, 0x80, 0x16, 0x42, 0xC1, 0x1F, 0xEC, 0x18, 0x52, 0x50, 0x62, 0x91, 0x82, 0x82, 0x02,
+    0x47, 0x5A, 0xD1, 0x50, 0x30, 0x91, 0x2C, 0xE4, 0x95, 0xC6, 0x73, 0x39, 0x67, 0xBC, 0x0B, 0x2B,
+    0x41, 0x3A, 0x18, 0xC9, 0xF7, 0x8D, 0x3D, 0xF6, 0x99, 0x7B, 0xCF, 0x39, 0x77, 0x9E, 0x54, 0x5F,
+    0x8A, 0x74, 0x3A, 0x56, 0xAA, 0xB1, 0xC9, 0x61, 0x75, 0x8B, 0x4D, 0xAE, 0x6F, 0x52, 0x25, 0x36,
+    0x49, 0xA5, 0x09, 0x6B, 0x49, 0xF4, 0xA7, 0xD4, 0xEC, 0x76, 0x73, 0xD1, 0x45, 0x3F, 0xB5, 0x8B,
+    0x1F, 0xFD, 0x34, 0x4C, 0x3A, 0xFA, 0xDF, 0x32, 0x96, 0x37, 0xB1, 0x3A, 0x8A, 0x3C, 0x14, 0x8C,
+    0x37, 0xF9, 0xE3, 0xBF, 0xDD, 0x45, 0xDA, 0x88, 0x87, 0x36, 0xF9, 0x59, 0xAA, 0xE4, 0x16, 0xB9,
+    0x3D, 0xEE, 0xF5, 0x22, 0xB5, 0x6A, 0x8F, 0xEF, 0x80, 0x8D, 0xA0, 0x53, 0x93, 0x25, 0x6C, 0x35,
+    0x91, 0xE4, 0x3D, 0x11, 0x9D, 0xF1, 0x56, 0xBB, 0x21, 0x34, 0xCA, 0x0F, 0x74, 0x42, 0xF0, 0xF1,
+    0xDE, 0xD9, 0xD9, 0xE3, 0xE4, 0xF1, 0x7A, 0xEE, 0x10, 0xF4, 0x29, 0xC3, 0x8B, 0x8C, 0x95, 0x57,
+    0xC0, 0xEA, 0xB6, 0x61, 0x16, 0x97, 0xDA, 0x55, 0xDC, 0x0E, 0x34, 0x97, 0x45, 0x2F, 0x1F, 0x2B,
+    0xD2, 0xD3, 0x2C, 0x46, 0x95, 0x19, 0xE9, 0x25, 0x37, 0xBF, 0xC9, 0xA2, 0xFB, 0x2C, 0xC9, 0xF0,
+    0x3C, 0x49, 0xF8, 0x1C, 0x97, 0x59, 0xF1, 0xA4, 0xFF, 0x2B, 0xC3, 0xFF, 0x94, 0x13, 0x91, 0x53,
+    0xB9, 0x7B, 0x4C, 0xDC, 0x12, 0xAE, 0x27, 0x69, 0x98, 0xCB, 0xC4, 0xE4, 0x2E, 0x1E, 0x8F, 0x2E,
+    0x9A, 0x55, 0xFE, 0x75, 0x9C, 0x96, 0xBC, 0xAA, 0x87, 0xF8, 0x48, 0x06, 0x9D, 0x41, 0x89, 0xD1,
+    0xA9, 0x43, 0x66, 0xA0, 0x49, 0xD7, 0x46, 0x2F, 0x1B, 0x8D, 0xF2, 0x01, 0x4A, 0x5D, 0x4C, 0x4E,
+    0x72, 0xE2, 0x66, 0xB7, 0x9A, 0x74, 0x02, 0x8A, 0x37, 0x93, 0xEA, 0xC4, 0x6F, 0x7D, 0xA5, 0xD5,
+    0x5E, 0xB6, 0x9D, 0xC3, 0x58, 0x26, 0xF5, 0xD6, 0xCD, 0x17, 0x05, 0x7D, 0x70, 0xAB, 0x3F, 0xF8,
+    0x50, 0x4A, 0x42, 0xE2, 0x31, 0x29, 0x82, 0xB5, 0x57, 0xE1, 0xE7, 0x74, 0x64, 0xEB, 0xE7, 0xB2,
+    0xE6, 0x92, 0x8B, 0x25, 0x5F, 0xB7, 0x9B, 0xD4, 0x70, 0xCD, 0xE6, 0x4A, 0x85, 0xA5, 0x42, 0xB9,
+    0x30, 0x72, 0xCD, 0x6A, 0xEF, 0x67, 0x03, 0xDD, 0x9C, 0xF6, 0x2E, 0x4A, 0x58, 0x00, 0x38, 0xBE,
+    0x8D, 0xF9, 0xCE, 0x09, 0xF2, 0xAE, 0x75, 0xA9, 0x71, 0x4B, 0x1A, 0x57, 0x39, 0x39, 0x6A, 0xEC,
+    0x6F, 0xD5, 0x0B, 0xBF, 0x4C, 0x25, 0xEB, 0xE7, 0x99, 0x3F, 0x0D, 0x3D, 0xC4, 0xDB, 0x07, 0xDB,
+    0xF1, 0xEA, 0xC9, 0x3F, 0x29, 0xBA, 0x73, 0x2E, 0x8F, 0xE4, 0x2D, 0xB8, 0x65, 0xF2, 0x63, 0x97,
+    0x2A, 0xDD, 0xCD, 0x6A, 0x75, 0x1E, 0x34, 0x0E, 0xB5, 0x26, 0xFB, 0xAB, 0xDA, 0x38, 0xDC, 0x1F,
+    0x3F, 0x71, 0x31, 0x3B, 0x42, 0x05, 0xFF, 0x82, 0x50, 0x56, 0x53, 0x51, 0x23, 0xE8, 0x2F, 0xA5,
+    0x24, 0x3A, 0x85, 0x66, 0xF3, 0x87, 0xFD, 0xBE, 0xCF, 0x64, 0xCA, 0xAC, 0xE1, 0x8B, 0xF9, 0xA4,
+    0x92, 0x0B, 0xF7, 0x4A, 0xEB, 0xE5, 0xFD, 0x61, 0xDA, 0x5D, 0xCE, 0x56, 0x63, 0x3B, 0xC1, 0xB5,
+    0x61, 0xAF, 0x53, 0x43, 0x8B, 0x88, 0xEF, 0xBB, 0x0D, 0x32, 0x57, 0x72, 0x28, 0x7D, 0xB7, 0xEA,
+    0xA5, 0x59, 0xFD, 0x24, 0xFE, 0x47, 0x85, 0x61, 0xDC, 0x06, 0x9C, 0x6E, 0xBA, 0x5D, 0xE3, 0x23,
+    0xEE, 0x8F, 0xFD, 0xC0, 0x35, 0xD2, 0x46, 0xE8, 0xE6, 0x36, 0xC9, 0x0E, 0x4A, 0x0C, 0x38, 0x9B,
+    0x6D, 0x5F, 0xD3, 0xF9, 0x8E, 0x79, 0x86, 0x49, 0x4E, 0x3F, 0x02, 0xD7, 0x1E, 0x6D, 0x00, 0x47,
+    0x4E, 0x72, 0x27, 0xB0, 0x21, 0x2C, 0x15, 0x71, 0x4C, 0xB9, 0xDB, 0x6A, 0xE8, 0xB8, 0x7C, 0x8A,
+    0xA6, 0x7A, 0x90, 0xA4, 0x4D, 0x6E, 0xBF, 0xA3, 0xB3, 0xA7, 0xE7, 0x11, 0x66, 0x08, 0x4B, 0x63,
+    0x5D, 0x5B, 0x11, 0xCA, 0xB7, 0x13, 0x32, 0x8A, 0xC5, 0xF7, 0xED, 0xC4, 0x1A, 0x6F, 0x11, 0x5A,
+    0x7D, 0x45, 0xE0, 0x8D, 0x64, 0x8C, 0xF6, 0x6A, 0x88, 0x26, 0x9A, 0x24, 0x1F, 0x0B, 0x73, 0x19,
+    0x20, 0x72, 0x18, 0xA9, 0x2A, 0xFC, 0x07, 0xC4, 0xAF, 0xF9, 0x90, 0xD2, 0xB8, 0xAD, 0x99, 0xCC,
+    0x6E, 0x36, 0x64, 0xAC, 0xBF, 0x6B, 0x0F, 0x1F, 0xF5, 0x15, 0xFB, 0xAD, 0xEA, 0x0F, 0x57, 0x65,
+    0xA2, 0xA1, 0xC5, 0x11, 0x62, 0x9D, 0xCF, 0x1E, 0x6F, 0x72, 0xC1, 0xE6, 0xF6, 0x3D, 0x82, 0x9D,
+    0x4A, 0x9B, 0xBB, 0xBF, 0x43, 0x2A, 0x52, 0xA0, 0x3E, 0x43, 0x0C, 0xF9, 0xE6, 0xE8, 0x7D, 0x56,
+    0xD0, 0xF0, 0xBE, 0xD2, 0xBE, 0x19, 0x65, 0x98, 0x6D, 0xC4, 0x81, 0x60, 0x76, 0x02, 0xA1, 0xCF,
+    0xD9, 0x91, 0xF0, 0x13, 0xFA, 0x7C, 0xA3, 0x7F, 0x97, 0x72, 0x12, 0xDD, 0x0C, 0xCF, 0xA5, 0x81,
+    0x21, 0x30, 0xA0, 0x3D, 0xA3, 0x24, 0xB2, 0xBA, 0x56, 0x5A, 0xFC, 0x45, 0xB5, 0xE9, 0x00, 0xCF,
+    0xAD, 0xC8, 0xAA, 0x21, 0x42, 0xD9, 0xBF, 0x0E, 0x7C, 0xC5, 0x14, 0xF3, 0xD3, 0xE5, 0xC7, 0x51,
+    0x74, 0xCC, 0xC6, 0x37, 0xF8, 0xF6, 0x13, 0xB0, 0x2E, 0xA1, 0xB7, 0xBB, 0x84, 0xAB, 0xB0, 0x1D,
+    0x8C, 0x3B, 0x2A, 0x5B, 0x5D, 0x9C, 0x1F, 0xA7, 0xDD, 0xD9, 0xA3, 0xD2, 0xE8, 0x5A, 0x6C, 0x85,
+    0x44, 0x4A, 0x4B, 0xD5, 0xCF, 0x9E, 0x8D, 0xF2, 0xBA, 0x01, 0xA2, 0x3A, 0xE5, 0x31, 0x92, 0xF9,
+    0x15, 0x34, 0x1F, 0x8B, 0x86, 0xD8, 0x1B, 0x1D, 0xC3, 0x92, 0xD9, 0x5E, 0xE8, 0x21, 0x09, 0x91,
+    0xE7, 0xA2, 0xF8, 0x4C, 0x7C, 0x6C, 0xBB, 0xD0, 0x07, 0x0D, 0x13, 0x6F, 0xF6, 0x62, 0x15, 0x94,
+    0x19, 0x9E, 0x26, 0xD2, 0xDA, 0xBD, 0x64, 0xD6, 0xFA, 0xC3, 0x5A, 0x20, 0xD0, 0x21, 0x05, 0x42,
+    0xF9, 0x39, 0x9D, 0xC5, 0x5B, 0x96, 0x3D, 0x00, 0xC2, 0x43, 0x17, 0x42, 0xE4, 0xA3, 0xDC, 0x30,
+    0x17, 0x55, 0x06, 0x3D, 0xA7, 0x33, 0xAE, 0x93, 0xE2, 0x55, 0x4A, 0x29, 0x85, 0x18, 0xEE, 0xD5,
+    0x30, 0x54, 0x67, 0x67, 0xB7, 0x2B, 0xF9, 0x10, 0x4E, 0x6F, 0xD1, 0xEC, 0xAB, 0x47, 0x0D, 0xF1,
+    0x5D, 0x06, 0x70, 0xE6, 0x17, 0x38, 0xCA, 0xA3, 0x30, 0x19, 0xA6, 0x1A, 0x27, 0x3F, 0xEC, 0x03,
+    0x3A, 0x71, 0xBE, 0x6A, 0x6F, 0x13, 0x0B, 0x41, 0xF7, 0x8A, 0x8B, 0xAD, 0x42, 0x97, 0x27, 0xFA,
+    0x4E, 0xFB, 0x47, 0xD2, 0xDC, 0x6A, 0xD4, 0xD4, 0xEA, 0xA4, 0xAB, 0xCD, 0xF4, 0xE2, 0xC3, 0xC3,
+    0xB6, 0xA7, 0x87, 0xD0, 0x26, 0xB5, 0x07, 0xBB, 0xC7, 0x99, 0x61, 0xAF, 0xCF, 0x8C, 0xC1, 0x6C,
+    0xAF, 0x25, 0x19, 0xA6, 0x44, 0xFD, 0x0B, 0x2F, 0xAF, 0x3C, 0x9B, 0xB6, 0xF2, 0x9F, 0x84, 0x52,
+    0xC9, 0x6C, 0x05, 0xB6, 0x48, 0x0D, 0xD8, 0xB2, 0x85, 0x9A, 0xC3, 0x14, 0x78, 0x44, 0x6D, 0x41,
+    0xCD, 0x40, 0x39, 0x87, 0xB9, 0x25, 0x07, 0x36, 0xD9, 0x8D, 0x4C, 0xE9, 0x77, 0x99, 0x76, 0x76,
+    0x49, 0xEF, 0x17, 0x08, 0x74, 0x21, 0x21, 0x34, 0x1E, 0xEC, 0xA6, 0x83, 0xEC, 0x5C, 0x98, 0x35,
+    0xD8, 0x20, 0x10, 0x62, 0x29, 0xEC, 0x92, 0xF0, 0xC2, 0xE1, 0x15, 0x5C, 0x3A, 0xDE, 0x24, 0x85,
+    0xAB, 0xB0, 0xFA, 0x3F, 0x8E, 0x3F, 0x01, 0xD5, 0x94, 0xC1, 0x8E, 0xD4, 0x46, 0x10, 0x86, 0xCB,
+    0xEE, 0x5D, 0x8D, 0x14, 0x1F, 0x9A, 0x03, 0xB9, 0x2C, 0x8A, 0xFA, 0x1A, 0x71, 0xF1, 0x23, 0xB4,
+    0xA5, 0x7D, 0x01, 0x0E, 0x6C, 0x94, 0x3C, 0x02, 0x27, 0xDE, 0x60, 0x7B, 0xC2, 0xD3, 0x44, 0xC3,
+    0x61, 0xEF, 0x91, 0x90, 0x1B, 0xED, 0x03, 0x60, 0x09, 0x71, 0xB7, 0x60, 0xB9, 0x3B, 0x60, 0x45,
+    0xD6, 0xD2, 0xEE, 0xCA, 0xFF, 0x37, 0x13, 0xB4, 0xCB, 0x22, 0x44, 0xA4, 0x48, 0x40, 0x6B, 0x5C,
+    0x9A, 0xF1, 0x54, 0x77, 0xFD, 0xF5, 0x55, 0x75, 0x89, 0x70, 0x55, 0xC9, 0x46, 0x31, 0xC9, 0x0F,
+    0xB2, 0x29, 0x66, 0xF6, 0x5B, 0x91, 0xEE, 0x40, 0xAE, 0xAC, 0xDF, 0xA4, 0xBA, 0xEF, 0xB4, 0xB3,
+    0xB3, 0xD7, 0x6D, 0x3B, 0xDD, 0xA5, 0x11, 0xED, 0xFC, 0x28, 0x2A, 0x7E, 0xA8, 0x54, 0x42, 0xAC,
+    0xB3, 0xF4, 0xD1, 0xAC, 0xA2, 0xDB, 0x4D, 0xAA, 0xB4, 0x6B, 0x92, 0x51, 0xB1, 0x73, 0x03, 0x33,
+    0x39, 0x15, 0x37, 0x9D, 0xEA, 0x4F, 0xEE, 0xEF, 0xA4, 0xD9, 0xE9, 0xA4, 0xC9, 0x69, 0xD4, 0xB9,
+    0xC9, 0x12, 0xB6, 0x72, 0x4F, 0x18, 0xA8, 0x2A, 0xE1, 0xEC, 0x14, 0x3A, 0x91, 0x76, 0x52, 0xC4,
+    0xF7, 0x7F, 0x29, 0xBE, 0xBB, 0xB8, 0xCA, 0x47, 0xEB, 0x04, 0xAF, 0xA5, 0xD5, 0x45, 0xA4, 0x56,
+    0x85, 0x8F, 0x85, 0x1D, 0xC4, 0xE7, 0x5F, 0x14, 0x92, 0x26, 0x09, 0x4B, 0xAD, 0x51, 0x3C, 0xC2,
+    0x77, 0xE2, 0x12, 0xE2, 0x8B, 0x5B, 0x2D, 0x0E, 0xB1, 0xAB, 0x4B, 0xB4, 0x6D, 0xE2, 0x1B, 0x8F,
+    0xED, 0x2E, 0xD1, 0xB6, 0xC5, 0xFA, 0xA5, 0xD8, 0x99, 0xB6, 0x9F, 0x3C, 0x7C, 0x74, 0x68, 0x57,
+    0x31, 0x1A, 0x2D, 0x32, 0x50, 0x69, 0xF4, 0x75, 0xCF, 0x9F, 0x8A, 0x08, 0x02, 0x0B, 0x81, 0x8E,
+    0x12, 0x44, 0x6E, 0x7F, 0x10, 0x66, 0xE3, 0x13, 0x31, 0x2B, 0xC0, 0xF8, 0xE7, 0x59, 0xCC, 0xD2,
+    0x46, 0xB9, 0x86, 0x50, 0x8E, 0x20, 0x3C, 0x60, 0x67, 0xAB, 0x3C, 0xB2, 0x9F, 0x6B, 0xAD, 0x74,
+    0x1B, 0xA2, 0x4D, 0x76, 0x01, 0x3A, 0x22, 0xC3, 0xDE, 0xFE, 0x1C, 0x7F, 0x2E, 0x04, 0x7B, 0x9C,
+    0x41, 0xCD, 0x8F, 0x26, 0x03, 0x64, 0x1F, 0xDB, 0xB9, 0x9D, 0x2B, 0xD5, 0x15, 0x4A, 0x98, 0x18,
+    0x05, 0x1C, 0x7E, 0x9E, 0x47, 0x7D, 0x95, 0x47, 0xCB, 0x72, 0x88, 0x4D, 0x60, 0x0E, 0x06, 0x36,
+    0x5D, 0xE1, 0x01, 0x77, 0x5D, 0x3D, 0x6D, 0xDA, 0x5B, 0xA4, 0xD8, 0x2E, 0x7E, 0x2E, 0x3C, 0x60,
+    0xC3, 0x44, 0x2A, 0xE0, 0x91, 0x10, 0x21, 0xDA, 0x0C, 0x09, 0xF8, 0xBC, 0xF8, 0x2C, 0x0F, 0xE4,
+    0x5A, 0x69, 0xA6, 0xA2, 0xD1, 0xE8, 0xD9, 0x5A, 0xAB, 0xE8, 0xEF, 0x5A, 0x2A, 0x8B, 0x16, 0x8B,
+    0x95, 0x32, 0xEA, 0x33, 0x3C, 0xAF, 0x74, 0x77, 0x36, 0x6B, 0xC7, 0xE6, 0xAB, 0xB3, 0x5D, 0x2A,
+    0x25, 0x94, 0x2E, 0x20, 0x8F, 0x92, 0x67, 0x80, 0x5C, 0x74, 0xC8, 0xFF, 0xD3, 0x20, 0x5F, 0x15,
+    0xC8, 0x7F, 0x6B, 0x90, 0x2C, 0x36, 0xB3, 0x41, 0x84, 0x0D, 0xD2, 0xB0, 0x41, 0x42, 0x54, 0xDC,
+    0x4E, 0x6A, 0x3B, 0xC7, 0xB3, 0xF8, 0xCB, 0x9D, 0x1E, 0xAF, 0xE0, 0x41, 0x6E, 0x06, 0x17, 0x29,
+    0xB6, 0x93, 0xFB, 0x74, 0x83, 0x1C, 0x10, 0x60, 0x1B, 0x99, 0xE7, 0xDC, 0x47, 0x5E, 0xF1, 0x51,
+    0x64, 0x6D, 0xC6, 0x1B, 0xCC, 0xEE, 0xEC, 0x61, 0x25, 0xD9, 0x20, 0x44, 0xAC, 0x57, 0xE9, 0x17,
+    0xE1, 0x79, 0xE2, 0x99, 0x6D, 0xD3, 0x09, 0xD3, 0xE6, 0x6F, 0x94, 0x03, 0x08, 0x09, 0x02, 0x81,
+    0xE0, 0x8F, 0x90, 0xB9, 0xE4, 0xBE, 0x45, 0xB6, 0x60, 0x0D, 0x50, 0x13, 0x6B, 0xB0, 0xD4, 0x38,
+    0x70, 0xDD, 0x4C, 0x38, 0xD5, 0x94, 0x83, 0xF4, 0xE2, 0x21, 0xA6, 0x06, 0x1C, 0xE9, 0x9D, 0xFF,
+    0x45, 0x74, 0xD8, 0x5D, 0x01, 0xE4, 0x5F, 0x6A, 0xE1, 0xE3, 0x1F, 0xA5, 0x6B, 0x78, 0xAA, 0x07,
+    0x2C, 0x2A, 0xEE, 0x85, 0x2E, 0x75, 0x3E, 0x4B, 0x66, 0x32, 0xB9, 0xE6, 0xD0, 0x41, 0x09, 0xCA,
+    0x03, 0xE1, 0x38, 0x2E, 0xCB, 0xD1, 0x63, 0xBC, 0x43, 0x34, 0x24, 0xEA, 0x90, 0xB1, 0xC7, 0xA4,
+    0xF2, 0x97, 0x1A, 0x79, 0xE9, 0x1A, 0xBD, 0xD8, 0x97, 0xE3, 0xC7, 0x93, 0xFB, 0x14, 0xA9, 0xEC,
+    0x9D, 0x80, 0x04, 0x44, 0xEE, 0xEE, 0xFE, 0x90, 0x9B, 0xCB, 0xE9, 0x6A, 0x14, 0x1D, 0x91, 0x36,
+    0x9C, 0x59, 0x63, 0xA5, 0xA8, 0xC9, 0x56, 0xFA, 0x2D, 0xEA, 0x82, 0xC9, 0x27, 0x1A, 0x0D, 0xF6,
+    0xF6, 0x71, 0x83, 0x2C, 0xC2, 0x60, 0x91, 0xB3, 0x1F, 0x51, 0x55, 0x34, 0x68, 0x60, 0xFD, 0x27,
+    0x92, 0xB2, 0x6F, 0x78, 0xBC, 0x7D, 0xC7, 0x44, 0x37, 0x6C, 0x0E, 0x0E, 0x95, 0x62, 0xE1, 0x52,
+    0xC4, 0xE3, 0x3B, 0x5D, 0x7E, 0x6E, 0xD0, 0x5A, 0x72, 0xDA, 0x13, 0x5F, 0x5F, 0xFE, 0xEC, 0x4B,
+    0x6B, 0xFB, 0x52, 0xA9, 0x6A, 0xAF, 0xE8, 0x87, 0xDD, 0x4E, 0xD8, 0x60, 0x13, 0xC5, 0x71, 0xF3,
+    0xC9, 0x49, 0x77, 0x4D, 0xF2, 0xAF, 0x72, 0xC4, 0x11, 0x86, 0x91, 0x87, 0x1E, 0x08, 0x63, 0xD5,
+    0x97, 0x46, 0x47, 0x7F, 0x8C, 0xA0, 0x42, 0x5E, 0x7E, 0xC0, 0x8C, 0x47, 0xD3, 0x70, 0x0E, 0x8E,
+    0xD4, 0xA9, 0xCD, 0xC4, 0x9B, 0xC5, 0xAB, 0xA6, 0x0E, 0xD2, 0xEC, 0x5B, 0x6A, 0xD5, 0x50, 0x6A,
+    0x5D, 0xD4, 0x7C, 0x28, 0xBB, 0x14, 0xE9, 0x96, 0x42, 0xEB, 0x22, 0x0E, 0xD7, 0xD1, 0x0C, 0x0F,
+    0x07, 0x52, 0x9C, 0xE9, 0xC3, 0x97, 0x9E, 0x27, 0xC9, 0x9F, 0xFB, 0xB2, 0x15, 0xE0, 0xED, 0x53,
+    0xBE, 0x0B, 0xE7, 0xB4, 0xFD, 0x79, 0xA1, 0x6E, 0x96, 0xEF, 0x82, 0xF7, 0xFB, 0x15, 0x4C, 0x41,
+    0xA4, 0x9C, 0x6A, 0x0C, 0xEB, 0x06, 0x66, 0x72, 0xEB, 0xBA, 0xD3, 0xB7, 0x86, 0xFE, 0x0B, 0xD6,
+    0x3F, 0x95, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0xB6, 0xB3, 0xCF, 0x42, 0x96, 0x98, 0x14,
+    0x20, 0x45, 0x29, 0xE2, 0x36, 0x05, 0x92, 0x7F, 0x00, 0x65, 0x0C, 0x4D, 0x4A, 0x52, 0x20, 0x25,
+    0xF4, 0x69, 0xA0, 0xD9, 0x3F, 0xC0, 0xAF, 0x8B, 0x04, 0x4D, 0xFE, 0x00, 0x8A, 0x14, 0x74, 0xDB,
+    0x23, 0xC8, 0x18, 0xE5, 0x07, 0x2C, 0x1A, 0x5A, 0x37, 0x41, 0x42, 0x14, 0x3B, 0x4B, 0x8C, 0xE4,
+    0xE8, 0x8D, 0x7D, 0x39, 0xE7, 0xFA, 0x25, 0x6C, 0xB2, 0xA1, 0xC0, 0x7A, 0x3B, 0xF2, 0x8E, 0x67,
+    0xCE, 0x9C, 0x7B, 0xEE, 0xB9, 0x77, 0x44, 0x8E, 0xCF, 0x2D, 0xF9, 0x08, 0x63, 0x90, 0x55, 0xA4,
+    0xD0, 0xBB, 0x2A, 0xE2, 0xD6, 0x26, 0x89, 0x74, 0x63, 0x18, 0x45, 0xD6, 0x0C, 0xD3, 0xF2, 0xBD,
+    0x3C, 0x96, 0xCB, 0x4F, 0xAD, 0x4B, 0xA1, 0x4B, 0xA3, 0xA9, 0xD4, 0x54, 0xEB, 0x98, 0xE9, 0x94,
+    0xEB, 0x5E, 0xC2, 0x5E, 0x30, 0x02, 0x40, 0xFB, 0x02, 0x00, 0xA1, 0x2F, 0x67, 0xC0, 0x0C, 0x2E,
+    0x8A, 0xF8, 0xB1, 0xE9, 0x45, 0x9A, 0xD8, 0xED, 0xB1, 0x39, 0x62, 0x89, 0xB8, 0xBF, 0x12, 0xC7,
+    0x03, 0x96, 0x48, 0xA9, 0x58, 0x82, 0xC3, 0x7B, 0x1B, 0xB1, 0x44, 0x72, 0x2E, 0x11, 0xA2, 0xC8,
+    0xED, 0x6A, 0xC2, 0xF8, 0x75, 0x18, 0x48, 0xD2, 0x3E, 0x86, 0x85, 0x1F, 0xFD, 0xC8, 0x31, 0x7B,
+    0x83, 0x57, 0xDE, 0x7F, 0x8C, 0xB1, 0xAB, 0x00, 0xE7, 0x2E, 0x18, 0x4F, 0xF2, 0xC0, 0x0C, 0xF6,
+    0xFF, 0x2F, 0x04, 0x8B, 0xB7, 0xDE, 0x58, 0x2F, 0x0F, 0xE4, 0x26, 0xBE, 0x47, 0xB7, 0x20, 0xA4,
+    0x7D, 0x37, 0x66, 0x21, 0x15, 0x38, 0xB9, 0xEB, 0x9B, 0x51, 0x8A, 0x25, 0x07, 0x82, 0x1F, 0xFC,
+    0x20, 0xF9, 0x4A, 0x26, 0xF5, 0x48, 0xF6, 0x6A, 0x60, 0x91, 0xAA, 0x68, 0x0D, 0x70, 0xF7, 0x82,
+    0x11, 0x68, 0x87, 0xA1, 0x52, 0xE3, 0x38, 0xDB, 0x2B, 0xD1, 0x2D, 0x20, 0x47, 0xFA, 0xB9, 0x51,
+    0xEE, 0x5A, 0x29, 0x86, 0x53, 0x2C, 0xEA, 0x74, 0xE2, 0x1A, 0x4E, 0x7A, 0x22, 0xC9, 0x8F, 0x1B,
+    0x9D, 0x0F, 0xA4, 0x05, 0xE9, 0x79, 0xD3, 0x4A, 0xF1, 0xAE, 0x8F, 0x70, 0x70, 0x3E, 0xBB, 0x41,
+    0xAE, 0x3C, 0xC0, 0xE8, 0xF4, 0xA0, 0xFA, 0x4C, 0xF5, 0x37, 0x5D, 0x4A, 0x5D, 0x32, 0x6D, 0x73,
+    0x6D, 0xAB, 0x24, 0x2E, 0x89, 0x8F, 0xFC, 0xE1, 0x7C, 0xDD, 0x17, 0xAB, 0x94, 0xAB, 0xD4, 0xB3,
+    0x34, 0x93, 0x74, 0xDB, 0xDC, 0x88, 0x20, 0x0B, 0x55, 0x9D, 0xA1, 0xBC, 0x82, 0x34, 0x47, 0x1C,
+    0xF6, 0xE5, 0x67, 0xC9, 0x84, 0x65, 0x32, 0x32, 0x53, 0xBA, 0x5A, 0x5E, 0x4F, 0x6C, 0xC1, 0x9C,
+    0xEA, 0xC8, 0x74, 0x31, 0xD0, 0x46, 0xF5, 0x15, 0x95, 0xA7, 0x65, 0xB4, 0xAC, 0xE6, 0x6B, 0x8D,
+    0x97, 0x7E, 0x79, 0x2B, 0x2F, 0x0F, 0xE5, 0xE4, 0x53, 0x1D, 0xCA, 0x84, 0xBC, 0xE9, 0x37, 0xA1,
+    0x77, 0x53, 0x91, 0x32, 0x15, 0xDF, 0xD7, 0xB1, 0x9C, 0xA1, 0x71, 0x68, 0xBB, 0xA1, 0x9A, 0x41,
+    0x3A, 0x9C, 0xC3, 0x38, 0xAA, 0x09, 0x64, 0x79, 0xBA, 0x09, 0xA7, 0xEF, 0x41, 0xF8, 0x43, 0x84,
+    0x21, 0x56, 0xDA, 0x8E, 0x09, 0xC0, 0xD9, 0x19, 0xD8, 0x3A, 0x90, 0x8E, 0x70, 0x84, 0x6A, 0x9F,
+    0x61, 0x00, 0x19, 0x7F, 0x71, 0x3F, 0x91, 0xB8, 0x1B, 0x49, 0xDC, 0xB7, 0x24, 0x9E, 0xCC, 0x8D,
+    0x03, 0x25, 0xB8, 0x06, 0x00, 0x42, 0x8A, 0x59, 0xA9, 0x30, 0xF6, 0xCE, 0x22, 0xEE, 0x46, 0xB3,
+    0x5C, 0xFB, 0x7A, 0xE2, 0x52, 0xC4, 0xA5, 0xE5, 0xA7, 0x99, 0xCC, 0xA6, 0xAB, 0x79, 0x70, 0xE1,
+    0x6E, 0xB3, 0x2C, 0x9C, 0xC2, 0x58, 0x4D, 0xA5, 0xCA, 0x26, 0x1A, 0xCA, 0x26, 0x3F, 0x9B, 0x7B,
+    0x6D, 0x62, 0x47, 0x54, 0x39, 0x79, 0x02, 0x7C, 0xC4, 0xAC, 0x6B, 0xAE, 0x67, 0xC9, 0xA1, 0x26,
+    0x6E, 0x70, 0x6F, 0xA9, 0x74, 0x1F, 0xE2, 0xC2, 0xDB, 0x48, 0xE7, 0x54, 0xAB, 0x19, 0x1B, 0xF2,
+    0xD4, 0x77, 0x97, 0x3C, 0x21, 0xC6, 0xD8, 0xE8, 0x61, 0xDF, 0xAC, 0x77, 0x24, 0xFB, 0x04, 0xD4,
+    0x20, 0xB4, 0xD0, 0x75, 0x01, 0xE7, 0x81, 0x12, 0x29, 0xDF, 0xFB, 0xD7, 0x39, 0xF2, 0xCA, 0x3C,
+    0x0C, 0xE1, 0x42, 0xB7, 0x19, 0xB3, 0x90, 0xFC, 0x97, 0x8B, 0x2E, 0x3D, 0x8E, 0x1A, 0x2A, 0x9C,
+    0x19, 0x90, 0x82, 0x72, 0x93, 0x75, 0x0F, 0x97, 0xCE, 0x5B, 0xAD, 0x51, 0xB0, 0x8C, 0x98, 0x94,
+    0xA8, 0x4A, 0x47, 0xD9, 0xA8, 0x94, 0x29, 0x67, 0x19, 0x23, 0xC3, 0xE5, 0xA8, 0x5F, 0xFD, 0xF7,
+    0x51, 0xC2, 0x40, 0x9F, 0x59, 0x73, 0x81, 0x7E, 0x14, 0xD2, 0xBD, 0xA4, 0x13, 0x7A, 0xF6, 0x86,
+    0xDA, 0xEA, 0x0D, 0xD5, 0xEE, 0x23, 0x1C, 0x4A, 0x80, 0x30, 0x6C, 0xB0, 0xB9, 0x1E, 0x61, 0x5D,
+    0x3A, 0xC2, 0x76, 0x23, 0x61, 0x9B, 0x58, 0x2A, 0xCD, 0x49, 0xCF, 0x42, 0x9B, 0xC7, 0xE6, 0x00,
+    0x40, 0xD3, 0x39, 0xBA, 0xAF, 0x2D, 0x45, 0x57, 0x4A, 0xC5, 0x52, 0xE1, 0x22, 0x39, 0x66, 0x6A,
+    0xBE, 0x72, 0x83, 0x2D, 0xBC, 0x9E, 0xBD, 0xBD, 0xF6, 0x0B, 0xFC, 0x7D, 0x9E, 0x31, 0xE8, 0x3A,
+    0x7A, 0x6C, 0x00, 0x8F, 0xB3, 0xC9, 0x14, 0x00, 0xD1, 0x02, 0x7D, 0x82, 0xDD, 0xAC, 0x67, 0x6B,
+    0x28, 0x51, 0x66, 0x7F, 0xCE, 0xE8, 0x7A, 0x38, 0x79, 0x02, 0x68, 0x77, 0xD0, 0x1E, 0xF5, 0x37,
+    0x17, 0x09, 0x6B, 0xB4, 0x6D, 0x7E, 0x55, 0x1C, 0x99, 0xA7, 0x86, 0x3B, 0xFD, 0xB3, 0xE5, 0xB6,
+    0x9B, 0xAA, 0xD9, 0x9F, 0xF7, 0xE0, 0x5B, 0xEA, 0x8C, 0x3D, 0x7B, 0xAF, 0x6C, 0x19, 0x0C, 0xF3,
+    0x64, 0x2B, 0x98, 0x77, 0x5A, 0x7A, 0x7E, 0xB7, 0xA5, 0xFB, 0xA3, 0x33, 0xCD, 0xD2, 0x1F, 0xEA,
+    0xF3, 0x7B, 0xCC, 0x1D, 0xA0, 0x76, 0x67, 0xEB, 0x0F, 0xFF, 0xCB, 0xD2, 0x2D, 0x33, 0xA4, 0x96,
+    0x1E, 0xF3, 0x71, 0x66, 0x35, 0x52, 0x9A, 0x57, 0x1A, 0x0E, 0xBF, 0x27, 0x5B, 0xC8, 0x09, 0x67,
+    0x2B, 0x6E, 0x9A, 0xB1, 0x76, 0x4F, 0x64, 0x87, 0x7D, 0x41, 0xD7, 0x82, 0x96, 0xDE, 0xBB, 0x78,
+    0x1D, 0xC2, 0x94, 0x68, 0x37, 0x77, 0xD0, 0x66, 0xD0, 0xD6, 0xB8, 0x05, 0x89, 0xAE, 0xD6, 0x9F,
+    0xD0, 0x45, 0x23, 0x2C, 0x5D, 0x3D, 0x42, 0x8F, 0x42, 0x8C, 0xA9, 0xB1, 0xD4, 0x7D, 0xD7, 0x67,
+    0xAD, 0xC7, 0x79, 0xB3, 0x5C, 0x83, 0x33, 0x21, 0x06, 0xAE, 0x11, 0x29, 0x8E, 0xF9, 0xC3, 0xDD,
+    0xE2, 0x90, 0x04, 0xD5, 0xB1, 0xA3, 0x44, 0xC8, 0xFE, 0x4B, 0xF0, 0x1C, 0xCD, 0xF1, 0xDA, 0x33,
+    0x85, 0xB8, 0x71, 0x02, 0xBB, 0xA5, 0x56, 0xD6, 0x70, 0x17, 0x36, 0x67, 0xE1, 0x1E, 0xDB, 0x6D,
+    0x45, 0xE0, 0x37, 0xE7, 0x1B, 0x75, 0x48, 0x6D, 0x73, 0xC1, 0x34, 0x29, 0x0F, 0x56, 0xFE, 0xDD,
+    0xB7, 0x0C, 0xA8, 0x34, 0x87, 0x81, 0x7C, 0x33, 0x5B, 0x8A, 0x29, 0x15, 0xBA, 0x3E, 0xDA, 0x44,
+    0x05, 0x7F, 0xF1, 0x4A, 0x23, 0x05, 0x3A, 0x6E, 0xBB, 0x91, 0x68, 0xA5, 0xAD, 0xC6, 0x88, 0xF8,
+    0xBE, 0xDD, 0x90, 0xF2, 0xF4, 0x74, 0xBB, 0xC3, 0x0C, 0xBE, 0x52, 0x13, 0x71, 0xF7, 0xC7, 0xB1,
+    0x03, 0x3C, 0x14, 0x3F, 0x65, 0xDA, 0x7B, 0x38, 0x37, 0xD6, 0x3A, 0x80, 0xA4, 0x9B, 0xC3, 0x0D,
+    0x04, 0xCC, 0x6B, 0xC3, 0xAB, 0xE9, 0xCB, 0x7D, 0xD6, 0x74, 0x2D, 0x53, 0xB5, 0xDD, 0x8E, 0x56,
+    0x54, 0xEC, 0x34, 0xD5, 0x8B, 0x55, 0x8A, 0xF3, 0x18, 0xE0, 0x0B, 0xB3, 0xDA, 0x0C, 0x9D, 0x1C,
+    0xBC, 0xD7, 0xA3, 0xFC, 0x8D, 0x4C, 0x61, 0x99, 0x41, 0x5B, 0x90, 0x81, 0x0D, 0x60, 0xDD, 0x6E,
+    0x99, 0x91, 0xDB, 0xE9, 0x84, 0xAF, 0xDA, 0x2B, 0x45, 0xF1, 0x0F, 0xCD, 0x54, 0x3D, 0x88, 0xDC,
+    0x46, 0x14, 0xFE, 0xB4, 0x73, 0xB7, 0x03, 0x2B, 0xF6, 0xE4, 0xE2, 0x16, 0xCC, 0xD9, 0xB1, 0xAA,
+    0x40, 0x08, 0xB6, 0xD5, 0x85, 0x2D, 0x0C, 0x23, 0xDB, 0xA5, 0x8B, 0x6C, 0x71, 0x5B, 0xC6, 0x69,
+    0x5C, 0x04, 0x42, 0xF0, 0x16, 0x17, 0x70, 0x11, 0xAC, 0xB9, 0xA4, 0x48, 0xE1, 0x22, 0xDB, 0xB8,
+    0x73, 0x21, 0x8C, 0x0B, 0xDB, 0xD5, 0x15, 0x29, 0xD2, 0x18, 0x4D, 0x7C, 0x10, 0x43, 0xD2, 0x88,
+    0xA4, 0x4C, 0x23, 0x13, 0x57, 0x76, 0xE1, 0x09, 0x11, 0x41, 0xB6, 0x47, 0xFB, 0xF2, 0x46, 0xB7,
+    0x17, 0xEE, 0x4C, 0x20, 0xC1, 0x3F, 0x90, 0x37, 0x3F, 0xD2, 0x9B, 0xF9, 0xDE, 0xEF, 0xCC, 0x3C,
+    0x24, 0xE4, 0x22, 0x6A, 0x40, 0x54, 0x65, 0x54, 0xF6, 0xA8, 0x45, 0xF6, 0x0C, 0x28, 0x2A, 0x50,
+    0x0A, 0x90, 0x89, 0x6A, 0xA0, 0x47, 0xBA, 0x60, 0x46, 0x50, 0xD8, 0x00, 0x08, 0xDB, 0x4C, 0xF3,
+    0xC7, 0xCB, 0x30, 0x25, 0x64, 0x78, 0x26, 0xA6, 0x94, 0x01, 0x44, 0xCE, 0x23, 0xBA, 0x35, 0x14,
+    0x5E, 0x03, 0xE4, 0x0B, 0xF2, 0x4C, 0x76, 0xAD, 0xF5, 0x8C, 0x8B, 0x3C, 0x40, 0x19, 0xC5, 0x6A,
+    0x05, 0x9B, 0xB2, 0xCC, 0x94, 0xA0, 0x92, 0x65, 0xE6, 0x92, 0x1E, 0xB1, 0xA2, 0x92, 0xC8, 0x4A,
+    0x22, 0xEE, 0x6C, 0xA5, 0x9F, 0xE2, 0x12, 0x54, 0x1D, 0x90, 0x51, 0x14, 0x90, 0x8D, 0x79, 0xB7,
+    0x41, 0xD8, 0x14, 0x47, 0xD9, 0x64, 0xE6, 0x15, 0x79, 0xDD, 0xD2, 0x4F, 0x77, 0xE9, 0xF1, 0x9C,
+    0x59, 0xAA, 0xB1, 0x7A, 0xB9, 0xDD, 0xF4, 0xEE, 0xA5, 0x7E, 0x62, 0xFD, 0xE1, 0x1F, 0x2D, 0xC4,
+    0x53, 0x5B, 0xFC, 0xB0, 0x4D, 0x75, 0x4C, 0x36, 0x6B, 0x04, 0xD5, 0x51, 0x83, 0xEC, 0x11, 0x26,
+    0x08, 0x80, 0xC1, 0xDD, 0x03, 0x94, 0x03, 0xE3, 0x93, 0x27, 0xBE, 0x95, 0x65, 0x58, 0x26, 0xF5,
+    0x07, 0x37, 0x7A, 0xFA, 0xBF, 0x37, 0xF6, 0xE1, 0x38, 0x1B, 0x4B, 0xD1, 0x2B, 0x81, 0x2D, 0x45,
+    0xEE, 0xF3, 0xE9, 0x77, 0x33, 0x54, 0x33, 0xA1, 0x67, 0x6B, 0x98, 0xAD, 0x63, 0x86, 0x57, 0xEF,
+    0x9E, 0xC6, 0x40, 0x05, 0xA9, 0x71, 0xC2, 0x47, 0xED, 0x4E, 0x4F, 0x3F, 0x0A, 0x31, 0xEC, 0x99,
+    0x21, 0x76, 0x86, 0x58, 0x1F, 0x02, 0xAF, 0xD3, 0x31, 0x9A, 0x9E, 0x25, 0xFA, 0x95, 0xE8, 0x32,
+    0xB5, 0xA3, 0xE9, 0xE4, 0x30, 0x37, 0x65, 0x4A, 0xF8, 0x60, 0x7F, 0xE2, 0xF1, 0x3B, 0xA7, 0xE8,
+    0x36, 0xBA, 0xBC, 0x13, 0x3D, 0xE5, 0xF1, 0x82, 0xC7, 0x02, 0x07, 0xC9, 0xEF, 0xFC, 0x23, 0xE1,
+    0x65, 0xFA, 0x77, 0xE4, 0xFB, 0xE9, 0x1D, 0xF5, 0xFD, 0xE2, 0xAD, 0xF6, 0x51, 0xEA, 0xE3, 0x9B,
+    0xEE, 0xC7, 0xF3, 0x9C, 0x03, 0xBC, 0xB3, 0x6F, 0x3E, 0xDA, 0x0F, 0xD0, 0x3B, 0xA5, 0xB1, 0x82,
+    0xAB, 0x81, 0x13, 0x75, 0x64, 0xE3, 0x92, 0xEF, 0xAF, 0x51, 0xA5, 0xAA, 0x36, 0x52, 0x4C, 0xA4,
+    0x93, 0x4E, 0x70, 0x93, 0x4D, 0x68, 0xA3, 0x4A, 0x99, 0xC2, 0x9F, 0x54, 0xCA, 0x5C, 0xB7, 0x2E,
+    0xF7, 0xF0, 0xBA, 0xC0, 0x15, 0xBE, 0x6C, 0xB1, 0x55, 0x56, 0x75, 0xD2, 0x71, 0x19, 0x59, 0x51,
+    0x07, 0x0E, 0x5F, 0xB0, 0xA1, 0x15, 0x1C, 0x09, 0x1A, 0x59, 0xC5, 0x2C, 0xDB, 0x7A, 0x01, 0x65,
+    0xB2, 0xB3, 0xAD, 0x70, 0x91, 0xF5, 0xBF, 0xAA, 0x24, 0xD0, 0x57, 0x6D, 0x70, 0xAB, 0x3F, 0xEF,
+    0xBC, 0x0A, 0xAB, 0x44, 0x17, 0xF7, 0x79, 0xCD, 0x1B, 0x65, 0x48, 0x95, 0xE9, 0xE2, 0x9C, 0x13,
+    0x4D, 0x54, 0x25, 0xA6, 0x08, 0x9C, 0xB4, 0xD2, 0x24, 0x7B, 0xFE, 0xA7, 0x01, 0xB2, 0x2F, 0xDB,
+    0xD0, 0xA9, 0x2A, 0xBB, 0xBF, 0x10, 0x2E, 0x29, 0xB3, 0xF3, 0x2C, 0xA0, 0xB6, 0xDB, 0x70, 0x39,
+    0xA5, 0x57, 0xF8, 0xAE, 0x06, 0x58, 0x47, 0xB6, 0xBB, 0x10, 0x14, 0x37, 0x51, 0x5D, 0x18, 0xCE,
+    0x89, 0x57, 0x1D, 0xB4, 0xEC, 0x9F, 0x8B, 0x4A, 0x51, 0x27, 0x46, 0x5A, 0xA5, 0xA5, 0x51, 0x7F,
+    0x1F, 0x4B, 0xC4, 0x8F, 0x8A, 0x4B, 0x40, 0xC0, 0x0F, 0x5A, 0xF2, 0x6F, 0xAC, 0x7B, 0x93, 0x7B,
+    0xAB, 0x1F, 0x73, 0x9E, 0x32, 0xA2, 0x3F, 0x9F, 0x5D, 0xFD, 0xD4, 0x80, 0x1F, 0xB7, 0xE4, 0x12,
+    0xE0, 0x45, 0xDC, 0x1E, 0x28, 0xE1, 0xF7, 0xC1, 0x17, 0x45, 0xF0, 0x4E, 0xCC, 0x3B, 0x7C, 0xC6,
+    0x82, 0x77, 0x96, 0x21, 0x2D, 0x75, 0x4A, 0x2E, 0x28, 0x5E, 0x29, 0xFC, 0xCB, 0x8E, 0x35, 0xDE,
+    0x0D, 0xCB, 0xCD, 0x98, 0xD5, 0x72, 0x29, 0xA0, 0x73, 0x9D, 0x5E, 0x5E, 0xE4, 0xF8, 0x59, 0xF6,
+    0x65, 0xA4, 0x34, 0x9B, 0xD1, 0x12, 0xB9, 0xFD, 0xFC, 0x10, 0xB2, 0x5E, 0x22, 0x7D, 0x01, 0xDB,
+    0x48, 0x3B, 0x53, 0x8D, 0x6A, 0x8B, 0x05, 0xB7, 0x36, 0x6B, 0x8E, 0xCD, 0xDF, 0x63, 0x37, 0x35,
+    0x54, 0xC3, 0xD7, 0x51, 0x2B, 0x6A, 0x14, 0x2D, 0x14, 0xB5, 0x8A, 0x4A, 0xD5, 0xFA, 0xC2, 0x74,
+    0xAA, 0x73, 0xAE, 0x3F, 0x2F, 0x7E, 0xA1, 0x6F, 0x16, 0x49, 0x3D, 0x42, 0x5F, 0xF7, 0x35, 0x57,
+    0xC3, 0x07, 0x5D, 0xBE, 0x62, 0x97, 0xF1, 0x51, 0x6E, 0x72, 0x02, 0xFB, 0x1A, 0x1B, 0xC0, 0x27,
+    0xA1, 0x43, 0x62, 0x51, 0xEC, 0x12, 0xB8, 0xCC, 0x29, 0x4B, 0x46, 0xF8, 0x3F, 0x65, 0x38, 0x5E,
+    0x4E, 0x69, 0x8A, 0x55, 0x78, 0xEC, 0x52, 0x9B, 0x1D, 0x1D, 0xAA, 0x18, 0xE3, 0xD8, 0x6D, 0xAD,
+    0xBE, 0xB5, 0x8A, 0x51, 0x1F, 0x3F, 0x3D, 0x19, 0xBE, 0xC1, 0x8A, 0xC1, 0xB5, 0x33, 0x4E, 0xA5,
+    0xC3, 0xE3, 0xD9, 0xF8, 0xE6, 0x8F, 0x83, 0x41, 0x9A, 0x1F, 0x19, 0x00, 0x39, 0x5E, 0x69, 0x62,
+    0xCA, 0x4B, 0x88, 0x07, 0x1A, 0xD1, 0x1A, 0x70, 0x66, 0x5C, 0x90, 0x7D, 0x32, 0xFD, 0xEC, 0x64,
+    0x2E, 0x2F, 0x0C, 0x82, 0x9F, 0x4D, 0xBE, 0xB5, 0x33, 0x58, 0x59, 0x61, 0x64, 0x07, 0x7D, 0xCD,
+    0x4F, 0x47, 0xB3, 0x1C, 0xA7, 0xCE, 0x20, 0xFC, 0x10, 0xBD, 0x5D, 0x83, 0x1D, 0xA2, 0xDF, 0xBE,
+    0xBE, 0x7E, 0x71, 0xED, 0x1D, 0xE4, 0xE3, 0xAD, 0x01, 0x1E, 0x96, 0x79, 0x10, 0xBC, 0x01, 0x43,
+    0x07, 0xED, 0xFD, 0xBF, 0xE9, 0x2F, 0x6D, 0x55, 0x3F, 0x8F, 0x1F, 0x35, 0x10, 0x9D, 0x5D, 0x27,
+    0x67, 0x92, 0x95, 0x62, 0x8A, 0x9C, 0x14, 0x85, 0xC2, 0xCD, 0x15, 0x48, 0x08, 0xF9, 0x0B, 0x00,
+    0x5E, 0x2E, 0x05, 0xED, 0x15, 0x20, 0x4A, 0xA8, 0x69, 0xF2, 0x0D, 0x58, 0x27, 0x2D, 0x4D, 0x1A,
+    0xA0, 0x4D, 0x09, 0xE1, 0x33, 0xE4, 0xD6, 0x49, 0xBE, 0xC0, 0x26, 0x08, 0xD1, 0x3A, 0x4A, 0x10,
+    0x05, 0x05, 0x16, 0x5A, 0xD0, 0xE6, 0xF0, 0x7A, 0x78, 0xB3, 0xBF, 0xFB, 0x13, 0xA4, 0xAC, 0x74,
+    0xFB, 0x9B, 0xF3, 0xDA, 0x33, 0x6F, 0xDE, 0xBC, 0x19, 0x13, 0xFD, 0xFF, 0xB9, 0xB6, 0xFB, 0xE9,
+    0x66, 0x22, 0x17, 0x37, 0x73, 0x64, 0x22, 0xBF, 0x99, 0x2D, 0x73, 0x20, 0x3E, 0xFD, 0xEE, 0x63,
+    0xBB, 0x6E, 0xA6, 0x49, 0x2E, 0xEA, 0x65, 0x33, 0x5D, 0x74, 0xD1, 0xA4, 0xCD, 0xF4, 0xD1, 0xC7,
+    0x53, 0x07, 0x3E, 0xF8, 0x38, 0xF4, 0x67, 0x66, 0xD8, 0x9D, 0xA2, 0x21, 0x8C, 0xED, 0x42, 0x6F,
+    0x13, 0x35, 0x58, 0xAD, 0x3A, 0xDB, 0x4A, 0x0D, 0x27, 0xFF, 0x47, 0x31, 0x71, 0xE4, 0xD8, 0x71,
+    0xB1, 0x9C, 0xFD, 0x61, 0x1D, 0x26, 0xF7, 0xFB, 0xAA, 0xB9, 0x3F, 0xD6, 0x8B, 0x4D, 0x43, 0xA8,
+    0xD8, 0x5F, 0x4C, 0x36, 0x89, 0x09, 0xA6, 0x9A, 0x4D, 0x32, 0xA9, 0x8A, 0x69, 0x92, 0x9D, 0xEC,
+    0xF3, 0x55, 0x4C, 0x41, 0x61, 0x9F, 0x95, 0x06, 0x81, 0x86, 0xDE, 0x45, 0xFF, 0xB8, 0xA8, 0x42,
+    0xF8, 0xE0, 0xE2, 0x70, 0xB7, 0x00, 0x29, 0xFE, 0x73, 0x13, 0xB7, 0xAB, 0xC9, 0x92, 0xA6, 0xE1,
+    0x42, 0xCC, 0x91, 0x6C, 0x22, 0xCD, 0x89, 0x06, 0xE4, 0x67, 0x81, 0xFB, 0x01, 0xD1, 0xD5, 0xFB,
+    0x88, 0x40, 0x6F, 0x7A, 0xEE, 0xD3, 0xDA, 0x54, 0xB5, 0xEA, 0xD2, 0x2D, 0x26, 0xBB, 0x09, 0x59,
+    0xD1, 0x5B, 0x58, 0x6D, 0x7B, 0x35, 0xBB, 0x60, 0x81, 0x8D, 0x3F, 0x29, 0xBA, 0xF8, 0xE4, 0x9E,
+    0xC3, 0xEC, 0x66, 0x21, 0xCB, 0xDF, 0x29, 0x54, 0xF4, 0x44, 0x61, 0x4F, 0xCE, 0x37, 0x41, 0xF6,
+    0x9A, 0x49, 0x76, 0x0F, 0x11, 0x9B, 0x0E, 0xAB, 0xC6, 0x09, 0x33, 0xFB, 0xC9, 0xA5, 0xF1, 0x11,
+    0x16, 0x54, 0x91, 0x73, 0x36, 0xE1, 0x24, 0x88, 0xC2, 0xD9, 0x36, 0xCB, 0xE9, 0xA6, 0xBF, 0x4C,
+    0xB4, 0x47, 0xBE, 0x1F, 0xA2, 0x6C, 0x35, 0xB9, 0x5B, 0x94, 0x64, 0xFA, 0x90, 0x0E, 0xF6, 0xE8,
+    0x06, 0xAD, 0xED, 0xA2, 0x85, 0x9E, 0xCD, 0x0F, 0xB6, 0x44, 0xEE, 0xC7, 0x3B, 0x55, 0xBC, 0x35,
+    0xAB, 0x5A, 0xDA, 0x59, 0x4F, 0x2D, 0x1C, 0xC8, 0xCE, 0x03, 0x35, 0x77, 0xC9, 0x46, 0x04, 0x57,
+    0x45, 0xAD, 0x66, 0x76, 0x09, 0x07, 0xB6, 0xC0, 0xF8, 0xA7, 0x5B, 0xB6, 0xC0, 0x11, 0x24, 0xC9,
+    0x39, 0x93, 0xBA, 0xC9, 0xF6, 0x1F, 0xD1, 0x01, 0x1D, 0x35, 0x3D, 0x4E, 0x53, 0x83, 0x72, 0x0F,
+    0x89, 0x2C, 0x07, 0xBD, 0x54, 0x30, 0xB1, 0xB8, 0x60, 0x26, 0x6A, 0x7B, 0x00, 0x19, 0xA3, 0xCF,
+    0x76, 0xD1, 0x15, 0x46, 0xB7, 0x92, 0xCF, 0xC4, 0xBD, 0x2E, 0xA8, 0x0E, 0xBD, 0x4B, 0x74, 0x8F,
+    0x40, 0xB9, 0xCD, 0xB2, 0xEA, 0x13, 0x8D, 0x13, 0xBE, 0x19, 0x90, 0x1F, 0xCD, 0x42, 0x1C, 0xCC,
+    0x4C, 0x57, 0x5F, 0xD3, 0xA0, 0xFE, 0x26, 0xA9, 0xA4, 0xF2, 0x71, 0x5B, 0x54, 0xEE, 0xD2, 0xA8,
+    0x66, 0x5A, 0xCD, 0x2D, 0x54, 0x6B, 0x82, 0x85, 0x34, 0xF1, 0x32, 0xCF, 0x16, 0x6A, 0x42, 0x5D,
+    0x6E, 0xB4, 0xC5, 0x2E, 0x16, 0x58, 0xC1, 0x98, 0x7D, 0xC4, 0x8F, 0x4A, 0xF3, 0xF1, 0x5A, 0x2E,
+    0x41, 0x26, 0x36, 0x10, 0x68, 0x03, 0x54, 0xD4, 0x3B, 0xE0, 0xF8, 0xDD, 0x85, 0xD6, 0x2E, 0xFB,
+    0x7E, 0x85, 0xCF, 0xF9, 0x21, 0xBD, 0x4F, 0x5E, 0x02, 0xAA, 0x9D, 0x32, 0x69, 0xEF, 0x7E, 0xF3,
+    0x03, 0xB9, 0xDC, 0x15, 0x1A, 0x26, 0x3B, 0x03, 0x95, 0x60, 0x0F, 0x3E, 0x35, 0xDC, 0x0F, 0x53,
+    0xC3, 0x34, 0xC4, 0x56, 0x92, 0x52, 0x2B, 0x50, 0x43, 0x41, 0x4C, 0xBB, 0xD7, 0x02, 0x61, 0xE9,
+    0x19, 0x89, 0xEB, 0xDC, 0x14, 0xEA, 0x32, 0x4A, 0xD5, 0x25, 0x04, 0xED, 0x26, 0x60, 0x34, 0x51,
+    0x65, 0xBA, 0x02, 0x62, 0x76, 0x21, 0x2E, 0xF7, 0xCD, 0x11, 0xA4, 0x07, 0xD1, 0xF9, 0x84, 0x9C,
+    0xB7, 0x38, 0x3E, 0x80, 0x93, 0x7D, 0x7C, 0xA2, 0x07, 0x78, 0x06, 0x66, 0xFE, 0x13, 0x7F, 0x27,
+    0xB0, 0x7F, 0xDC, 0x3F, 0x1A, 0xD6, 0xB1, 0x8E, 0xEB, 0xFE, 0xA7, 0xE7, 0xC2, 0xD3, 0xE2, 0x49,
+    0x49, 0xB3, 0x6D, 0xCD, 0xD7, 0x54, 0x59, 0xE4, 0xF3, 0xD7, 0xD6, 0x65, 0x3E, 0x9C, 0xBD, 0x44,
+    0xC7, 0xC0, 0x20, 0xAF, 0x49, 0x7A, 0x56, 0x3A, 0x53, 0x67, 0xF1, 0x90, 0xCF, 0xDD, 0x14, 0x71,
+    0x23, 0x2F, 0x5A, 0xCF, 0xDD, 0x8C, 0x17, 0xBE, 0xE2, 0xD9, 0x6B, 0xF3, 0x40, 0x5F, 0x9E, 0x23,
+    0x69, 0x6B, 0xDF, 0x8C, 0xBD, 0xE1, 0xD4, 0x71, 0x76, 0x3C, 0xA3, 0x8B, 0x9C, 0xB4, 0x6C, 0x71,
+    0x9F, 0x17, 0xF3, 0xFD, 0x7A, 0xA9, 0x45, 0x05, 0xEA, 0xE6, 0x7D, 0x95, 0x40, 0x30, 0x90, 0xA6,
+    0x9E, 0xC5, 0x17, 0x1A, 0x0D, 0x51, 0xC6, 0x00, 0xFE, 0x90, 0xC4, 0xAE, 0x09, 0x51, 0x1F, 0x04,
+    0xF0, 0xDF, 0x92, 0xFB, 0x85, 0x3C, 0x3A, 0x95, 0xC9, 0xE1, 0xC4, 0x4A, 0x7B, 0xF7, 0xA8, 0xBD,
+    0x47, 0x67, 0xEC, 0x11, 0xD4, 0xE7, 0x26, 0x39, 0x02, 0xF9, 0xB8, 0x0C, 0x02, 0x37, 0x29, 0x45,
+    0x59, 0x44, 0x5B, 0x5C, 0xDE, 0xED, 0xBB, 0x19, 0xDC, 0x4B, 0x32, 0x05, 0xD0, 0x1A, 0x3E, 0x64,
+    0xEE, 0x3D, 0xF0, 0x15, 0x55, 0xDB, 0xBF, 0x87, 0x38, 0x4C, 0x00, 0x86, 0x0A, 0x63, 0x14, 0x8C,
+    0x01, 0xB8, 0xA0, 0x39, 0x60, 0xD9, 0xE6, 0x1B, 0x9C, 0x9A, 0x0C, 0x3E, 0x81, 0xCA, 0x42, 0x98,
+    0xC2, 0x09, 0x40, 0xB9, 0xA8, 0x5E, 0x1D, 0xA1, 0x9A, 0xC0, 0xE4, 0xFB, 0x96, 0xA5, 0x9C, 0x80,
+    0x74, 0x70, 0x81, 0x68, 0x5F, 0x72, 0xD8, 0x0A, 0xDA, 0xA0, 0x19, 0x56, 0xB2, 0x5B, 0x8A, 0x28,
+    0xCB, 0x91, 0x7C, 0x85, 0xA8, 0xB6, 0xB1, 0xD9, 0x20, 0xDA, 0x30, 0x61, 0xB4, 0x08, 0x2C, 0xC8,
+    0x26, 0x30, 0xA3, 0xF6, 0xE6, 0xBB, 0x0A, 0x5D, 0xF5, 0x98, 0x9F, 0x28, 0x0C, 0xC6, 0x89, 0x14,
+    0x0C, 0x87, 0x35, 0x3A, 0x5A, 0x2A, 0x8B, 0x12, 0x0E, 0x01, 0x94, 0x81, 0xAF, 0x41, 0xA8, 0xEB,
+    0xB2, 0x94, 0xE8, 0x98, 0xEC, 0x6F, 0x10, 0x57, 0xC3, 0x19, 0xB2, 0x36, 0x15, 0xEA, 0xA2, 0x9B,
+    0x17, 0x70, 0xAE, 0x9F, 0x52, 0xEA, 0x53, 0xCB, 0x04, 0x38, 0x20, 0xC9, 0x07, 0x2C, 0x41, 0x77,
+    0xA7, 0xEC, 0x60, 0xC8, 0xBE, 0xA4, 0x0F, 0x3A, 0xF0, 0xC2, 0x16, 0x42, 0x5B, 0x7D, 0x18, 0x78,
+    0xB9, 0x06, 0x8C, 0xD3, 0xE9, 0x68, 0x93, 0xD1, 0x74, 0x05, 0xD5, 0xF0, 0xFD, 0x71, 0x53, 0x9A,
+    0x2A, 0xE3, 0xC4, 0x4F, 0x7E, 0x1A, 0xEF, 0xF0, 0xD9, 0x84, 0x1A, 0xC3, 0x78, 0x97, 0xB7, 0x31,
+    0x93, 0x7D, 0x1C, 0x0F, 0x6B, 0xBB, 0xEA, 0x45, 0xCC, 0x6D, 0x50, 0xE9, 0x19, 0xFD, 0x1A, 0x6D,
+    0xFF, 0x35, 0x26, 0xE2, 0x75, 0xCC, 0x8B, 0xB0, 0x73, 0x3B, 0xCA, 0x64, 0x8D, 0xF6, 0xDF, 0x6D,
+    0x9A, 0x80, 0x72, 0xCC, 0xED, 0xBF, 0x30, 0xAC, 0xC1, 0xFB, 0x8B, 0xD2, 0x02, 0x84, 0x7F, 0xB2,
+    0xE8, 0x59, 0x06, 0x0E, 0x8F, 0xD1, 0x20, 0x37, 0x37, 0xBF, 0x36, 0x6E, 0xCB, 0xA6, 0x41, 0x8C,
+    0x0A, 0x85, 0xFB, 0xA7, 0x82, 0x61, 0x4F, 0xE6, 0x49, 0x56, 0x79, 0x40, 0x3F, 0x27, 0xCF, 0xFC,
+    0x82, 0xB9, 0xBE, 0xB7, 0xCD, 0xF0, 0x40, 0x32, 0x19, 0x3C, 0xD4, 0x8B, 0xD6, 0xE5, 0x04, 0x4F,
+    0x3A, 0x91, 0x4C, 0x8C, 0xD3, 0xC9, 0x7E, 0x3B, 0x49, 0x81, 0x45, 0xE0, 0x60, 0xD7, 0xC7, 0xCF,
+    0x78, 0xF2, 0x3C, 0x75, 0xDC, 0x9F, 0x87, 0x7A, 0x07, 0xE5, 0xC7, 0x4A, 0xED, 0xD1, 0xEC, 0x34,
+    0xF6, 0x64, 0x4E, 0x82, 0xDC, 0x7A, 0xFE, 0xA7, 0x55, 0xE3, 0xD2, 0x19, 0xE8, 0x58, 0x63, 0x1A,
+    0x21, 0xAE, 0x7A, 0x35, 0x44, 0x5C, 0x50, 0x34, 0xEC, 0x2E, 0xBE, 0x8E, 0x4F, 0x34, 0xF3, 0xCF,
+    0xCC, 0x19, 0x69, 0x7C, 0xA8, 0x96, 0x66, 0xA7, 0x79, 0xB9, 0x82, 0xEA, 0xD6, 0x54, 0xE8, 0xA6,
+    0x9D, 0x4E, 0x51, 0xC5, 0xE6, 0x22, 0xB7, 0xAE, 0x22, 0x5C, 0xB6, 0x4F, 0x25, 0x8F, 0x5B, 0x18,
+    0x62, 0xC3, 0x17, 0x40, 0x33, 0xB5, 0x9C, 0xF4, 0x3F, 0x55, 0x65, 0xF7, 0x78, 0x51, 0x33, 0xAA,
+    0xE0, 0x9E, 0x56, 0xC5, 0xE8, 0x8A, 0x57, 0x17, 0xDD, 0x87, 0x72, 0x89, 0xB4, 0x7F, 0x2D, 0x80,
+    0x35, 0x8D, 0xC2, 0xC3, 0xF6, 0xA3, 0xEB, 0x18, 0x1D, 0x2F, 0xF4, 0x95, 0xDC, 0x62, 0x89, 0xBA,
+    0x85, 0x6E, 0x57, 0x24, 0xDE, 0xAB, 0xDA, 0xD3, 0x9B, 0x9F, 0xFF, 0x00, 0xAD, 0x55, 0xBF, 0x8F,
+    0xDE, 0x44, 0x10, 0x1D, 0xDB, 0xF9, 0xCE, 0x09, 0x5B, 0x6C, 0x0A, 0x40, 0x28, 0x41, 0x32, 0x35,
+    0x11, 0xF2, 0x7F, 0x90, 0x75, 0x8E, 0xE2, 0x0A, 0x0A, 0xAE, 0xC0, 0xA1, 0x4C, 0x43, 0x15, 0x8A,
+    0xA3, 0xA4, 0x88, 0x6E, 0x1D, 0x5D, 0x41, 0x91, 0x82, 0x2B, 0x82, 0x10, 0x1D, 0x45, 0x9A, 0xDC,
+    0x15, 0x50, 0x22, 0x74, 0x8A, 0x0D, 0xF7, 0x07, 0xC4, 0x04, 0x21, 0x0A, 0x1A, 0x4B, 0x11, 0x0D,
+    0x14, 0x59, 0x12, 0x9F, 0xE2, 0xBB, 0xAC, 0x77, 0x78, 0xB3, 0xBE, 0x00, 0x42, 0x8A, 0x68, 0xB0,
+    0xE4, 0xFD, 0xD6, 0xF6, 0xFC, 0x78, 0xEF, 0xCD, 0xEC, 0x7C, 0x44, 0xA4, 0x46, 0xBB, 0x11, 0x5A,
+    0x57, 0x7C, 0xEB, 0xD5, 0xB4, 0x9D, 0xF9, 0xB2, 0x9A, 0x75, 0x67, 0xB3, 0xA1, 0xBC, 0x39, 0xBE,
+    0xDB, 0xDF, 0x7B, 0xE2, 0xCC, 0xD1, 0xA4, 0x1C, 0xC9, 0x95, 0x7C, 0x40, 0x29, 0x8F, 0xC4, 0xDC,
+    0x99, 0x07, 0x21, 0x1F, 0xB5, 0x63, 0xE2, 0xA2, 0xD7, 0x8F, 0x3D, 0x05, 0xD3, 0x15, 0x3F, 0x4E,
+    0xA9, 0x37, 0x8D, 0x39, 0xF4, 0x6A, 0x34, 0x3F, 0x84, 0x94, 0xB9, 0x51, 0x3C, 0xD0, 0x85, 0x5D,
+    0xF8, 0x35, 0x49, 0xDB, 0xD9, 0x40, 0xF0, 0x2D, 0x7A, 0xB2, 0x94, 0x7A, 0xD2, 0x03, 0x99, 0x2A,
+    0xF1, 0x84, 0xC8, 0x65, 0x47, 0x81, 0x2C, 0xEF, 0x70, 0x58, 0xD5, 0x9B, 0x94, 0xDC, 0xA6, 0x8C,
+    0xDD, 0x92, 0x63, 0xCE, 0x06, 0xDD, 0xBF, 0x0E, 0x6B, 0x32, 0x8D, 0x78, 0xE4, 0x13, 0x25, 0x81,
+    0xA8, 0xAD, 0xE4, 0xB9, 0x38, 0xAA, 0x33, 0xE6, 0xD1, 0x30, 0x53, 0x5D, 0x13, 0xAD, 0x6D, 0x52,
+    0xEB, 0x33, 0x0E, 0xF9, 0xD0, 0x66, 0x8D, 0x25, 0x9A, 0x61, 0x9D, 0xF0, 0x90, 0xF0, 0x44, 0xEB,
+    0x9E, 0x90, 0x09, 0x61, 0x8A, 0xF1, 0x43, 0xEE, 0x5B, 0xAE, 0xDE, 0xDC, 0x15, 0x32, 0x95, 0xBC,
+    0xA2, 0xB6, 0xA3, 0x12, 0x30, 0xB8, 0x49, 0x4E, 0x46, 0xDA, 0x36, 0x54, 0xEC, 0xB8, 0x7C, 0xD8,
+    0x4E, 0xBC, 0x1A, 0x10, 0xF9, 0x21, 0xF3, 0xBC, 0xBA, 0x3A, 0x57, 0x54, 0x36, 0x94, 0x8D, 0x44,
+    0xAF, 0x44, 0x19, 0x4A, 0x1E, 0x34, 0x8F, 0xF9, 0xD1, 0x7B, 0x29, 0x5E, 0x05, 0x80, 0x99, 0xE9,
+    0x25, 0xEE, 0x29, 0x97, 0x68, 0x80, 0xDA, 0x09, 0xC9, 0xD2, 0x5D, 0x62, 0xA7, 0xC1, 0x7F, 0xAF,
+    0x82, 0xC7, 0xAB, 0x15, 0x59, 0x4F, 0x86, 0x1B, 0x7D, 0x4C, 0x19, 0xCC, 0x98, 0xA8, 0xE0, 0x21,
+    0x13, 0x92, 0xEB, 0x73, 0xEE, 0xF4, 0x60, 0xE9, 0x5E, 0xFC, 0xB9, 0xE2, 0xB3, 0x00, 0xAB, 0x53,
+    0xDD, 0x08, 0x52, 0xF0, 0x03, 0x90, 0x9C, 0xDF, 0xF7, 0x97, 0x53, 0xAF, 0xC0, 0x02, 0xBC, 0x28,
+    0xC4, 0x3C, 0x36, 0xAA, 0x00, 0xF1, 0x20, 0x0C, 0x54, 0x4C, 0x27, 0xA2, 0xB7, 0xE0, 0xB1, 0xB6,
+    0x0B, 0x7C, 0x95, 0x79, 0x34, 0x96, 0x5D, 0xD0, 0x83, 0x59, 0xF7, 0x65, 0x67, 0x1E, 0x75, 0xB9,
+    0x14, 0xC3, 0xA9, 0x81, 0x73, 0x57, 0x3C, 0x98, 0xB2, 0xB1, 0x4D, 0x7D, 0xF1, 0x6C, 0x4E, 0x79,
+    0xA6, 0xB5, 0xDB, 0x44, 0xAB, 0x5D, 0xCA, 0x45, 0x2A, 0x6E, 0xCC, 0x4D, 0x0F, 0x1C, 0x7D, 0x4B,
+    0xB3, 0xC2, 0x8F, 0xC0, 0x01, 0x46, 0x90, 0xA5, 0x15, 0x20, 0x23, 0x57, 0x39, 0xA6, 0xAD, 0x17,
+    0xC2, 0xC9, 0x1D, 0xE4, 0x5A, 0xD5, 0x75, 0xBD, 0x09, 0x37, 0x0E, 0xC8, 0xC9, 0x00, 0x5D, 0x84,
+    0x7D, 0x7C, 0x02, 0x01, 0x68, 0x30, 0x12, 0x34, 0x67, 0xD2, 0x80, 0x29, 0xDD, 0x93, 0x05, 0xE1,
+    0x63, 0x7B, 0x2C, 0x8A, 0x51, 0x60, 0x54, 0x18, 0x21, 0x35, 0x43, 0x38, 0xE2, 0x06, 0x6F, 0xE1,
+    0x40, 0x74, 0x89, 0xBF, 0x88, 0xA4, 0x07, 0xA2, 0x2D, 0xBE, 0x2B, 0x0E, 0xD8, 0x51, 0x3E, 0x0B,
+    0x31, 0x64, 0x41, 0x40, 0x60, 0x21, 0xA9, 0x79, 0xBC, 0x2E, 0x1E, 0x93, 0xC4, 0x18, 0xA3, 0x4F,
+    0x87, 0x40, 0x9F, 0xC3, 0xB2, 0x1C, 0x4A, 0x29, 0x86, 0x88, 0xC5, 0x55, 0x89, 0xC0, 0x92, 0x3E,
+    0x0D, 0xD1, 0xF2, 0x99, 0xC0, 0x13, 0xD3, 0x0B, 0xFC, 0x1B, 0x18, 0x68, 0x88, 0x46, 0x97, 0xF9,
+    0x77, 0x07, 0xFE, 0x12, 0x7E, 0x9F, 0xF7, 0x20, 0xBB, 0x11, 0x90, 0x52, 0x26, 0xA4, 0x07, 0xB2,
+    0xEC, 0xD1, 0xF1, 0xD5, 0xAF, 0x7A, 0x0B, 0x37, 0x0F, 0x2B, 0x38, 0xDB, 0xE1, 0x22, 0xBB, 0x74,
+    0x77, 0x39, 0x12, 0xFB, 0x27, 0xD5, 0x82, 0x45, 0xE2, 0xF6, 0xCB, 0xB6, 0xF8, 0x7B, 0xBB, 0xCD,
+    0xBF, 0x08, 0xB0, 0x58, 0xCB, 0x90, 0x45, 0xA2, 0x91, 0x6B, 0x1E, 0x96, 0x1D, 0xFA, 0x4F, 0xFB,
+    0xCC, 0x2D, 0xB5, 0x26, 0x33, 0x98, 0x68, 0xAC, 0xD1, 0xBA, 0xD5, 0xC2, 0xD1, 0x0C, 0xDA, 0xAB,
+    0xF0, 0x25, 0x44, 0xC5, 0xAB, 0xF6, 0xA1, 0xA4, 0xE7, 0x4A, 0xF9, 0x22, 0x14, 0x1C, 0xB2, 0xE3,
+    0x03, 0xD1, 0x62, 0x00, 0xD6, 0xB2, 0x7B, 0x03, 0x8A, 0xCE, 0x42, 0xB6, 0x6D, 0xC0, 0xE6, 0x04,
+    0x91, 0xE1, 0xD1, 0x44, 0xF6, 0xD9, 0x0C, 0xE1, 0x3A, 0x69, 0x75, 0xD2, 0x4E, 0xB6, 0x99, 0xC4,
+    0x46, 0xAA, 0x94, 0x2B, 0x91, 0x20, 0xE1, 0xF4, 0x1C, 0x04, 0x92, 0xE2, 0x28, 0x7F, 0xE3, 0x20,
+    0x9F, 0x14, 0x4E, 0x0D, 0x4A, 0xFA, 0x24, 0xD8, 0xEF, 0xA2, 0xE0, 0x96, 0x37, 0x78, 0x56, 0x8B,
+    0xC4, 0x43, 0xFE, 0x9C, 0xC5, 0x79, 0xA2, 0xC8, 0xFD, 0x22, 0xCE, 0x80, 0x08, 0xD8, 0xC7, 0xA2,
+    0x56, 0xA0, 0xBF, 0x27, 0xDA, 0xF7, 0xB9, 0x23, 0x8D, 0x43, 0xD7, 0x48, 0xE2, 0x8F, 0x17, 0x41,
+    0x93, 0xAD, 0xA3, 0xEB, 0x8D, 0x54, 0x1D, 0x00, 0xDA, 0x18, 0x3A, 0x56, 0x67, 0xD5, 0xFE, 0x54,
+    0xC7, 0x17, 0x93, 0x14, 0x52, 0xD2, 0x94, 0x51, 0x92, 0xB6, 0x8F, 0xC2, 0x36, 0x51, 0x9D, 0x86,
+    0x3E, 0x42, 0xEB, 0xFC, 0xBA, 0xD5, 0x9F, 0xFA, 0xEB, 0xD8, 0x46, 0x39, 0x4B, 0x0F, 0xD0, 0xCB,
+    0xB8, 0xCF, 0xC8, 0x26, 0x17, 0x01, 0xE5, 0x28, 0x2E, 0x5D, 0x93, 0x4F, 0xCB, 0x92, 0xD4, 0x6F,
+    0x4B, 0xED, 0x4E, 0x64, 0x09, 0x52, 0x4B, 0xFE, 0xE4, 0x18, 0xDD, 0x5B, 0x49, 0x81, 0x17, 0xF3,
+    0x28, 0x0F, 0xA9, 0xA8, 0x7F, 0x24, 0xA8, 0x2A, 0xD1, 0x50, 0x46, 0x03, 0x90, 0xE1, 0xF8, 0x70,
+    0xD3, 0x5A, 0x7B, 0x6B, 0xF4, 0xF6, 0xD3, 0x1D, 0x77, 0x70, 0xB6, 0xE8, 0x1A, 0x4C, 0x32, 0x19,
+    0x2C, 0x94, 0x0B, 0x8D, 0x3E, 0x9E, 0xC8, 0x64, 0x7E, 0xE1, 0xE3, 0x29, 0x3E, 0x2D, 0x92, 0xE9,
+    0x31, 0xF2, 0x92, 0xAD, 0x1A, 0x57, 0x42, 0xFD, 0x1D, 0x81, 0xF4, 0x38, 0xA2, 0x6B, 0x65, 0x05,
+    0xB6, 0xBA, 0x95, 0xEF, 0x71, 0xE1, 0xBF, 0x16, 0xDD, 0x9C, 0xE2, 0xFB, 0xEF, 0x84, 0xF2, 0x28,
+    0xE8, 0x1C, 0x09, 0xD8, 0x6F, 0x8C, 0x8A, 0xD8, 0x9F, 0x3E, 0xF5, 0x3A, 0x9E, 0x69, 0xCC, 0x60,
+    0x30, 0x53, 0xD0, 0x47, 0x9D, 0xD6, 0x93, 0x14, 0x65, 0x78, 0xE3, 0xB2, 0x09, 0x6D, 0x80, 0x43,
+    0x89, 0x6F, 0x6A, 0x52, 0x52, 0xFE, 0x0D, 0x81, 0xF4, 0x54, 0x16, 0x8E, 0xE8, 0x6E, 0x1D, 0xD5,
+    0xB5, 0x6D, 0x00, 0xCD, 0x8A, 0x11, 0x44, 0xE2, 0x38, 0xA1, 0x29, 0x3B, 0x6D, 0xF5, 0xA5, 0x73,
+    0x63, 0x4B, 0xA3, 0x41, 0xA5, 0xA6, 0xD2, 0xA7, 0xD9, 0xEC, 0x59, 0x1D, 0xFE, 0x31, 0x9D, 0xD3,
+    0xDF, 0x37, 0xF2, 0x15, 0x03, 0x82, 0xA4, 0xF5, 0x31, 0x2D, 0xE4, 0x71, 0xD7, 0xBF, 0xA6, 0x0E,
+    0xDD, 0x64, 0xEE, 0xDF, 0x77, 0xB6, 0x6D, 0xE1, 0xE0, 0xC4, 0x37, 0x4E, 0x0F, 0xB3, 0x74, 0x1B,
+    0xAD, 0x55, 0x91, 0xD6, 0x3F, 0x4A, 0xC2, 0xD6, 0x1E, 0x82, 0x56, 0xB6, 0xE3, 0xBE, 0x7E, 0x1E,
+    0x07, 0x61, 0x93, 0xCC, 0x9D, 0x2F, 0xF4, 0x61, 0xCF, 0xC6, 0xA0, 0x81, 0x67, 0x1C, 0xCD, 0x3E,
+    0xC1, 0xE1, 0x20, 0xE9, 0x2C, 0x99, 0xC3, 0x1C, 0x78, 0xB9, 0x9E, 0xE1, 0x06, 0xFB, 0xF4, 0xCE,
+    0x8B, 0x14, 0xC4, 0xBC, 0x3D, 0x8B, 0xC9, 0x7F, 0xA0, 0x7B, 0xE5, 0x4D, 0xD5, 0x76, 0x73, 0x8E,
+    0xE9, 0x69, 0x3F, 0xBB, 0xF6, 0x33, 0x1C, 0xB7, 0x10, 0x1A, 0xB1, 0x9C, 0xF4, 0x50, 0xBC, 0xC5,
+    0x05, 0x19, 0x6E, 0x50, 0x3C, 0x18, 0xD7, 0x11, 0x77, 0x96, 0x02, 0xFF, 0xBB, 0x1C, 0x54, 0xC0,
+    0xC8, 0xE2, 0x4F, 0xD1, 0x17, 0x4D, 0xEE, 0xB8, 0x29, 0x3A, 0xAE, 0x2C, 0xB5, 0x57, 0xE6, 0xBA,
+    0x15, 0xA1, 0xAF, 0x2D, 0x1D, 0xEA, 0xE2, 0x94, 0x47, 0xA7, 0x48, 0x9F, 0x48, 0xC3, 0x48, 0xE7,
+    0x9C, 0xA1, 0xFF, 0xFB, 0xFA, 0x13, 0xCD, 0x55, 0xB1, 0x8E, 0xDD, 0x54, 0x10, 0x1D, 0xDB, 0x22,
+    0x16, 0xB2, 0xC0, 0x34, 0x34, 0x9B, 0xC2, 0x1F, 0x80, 0x84, 0x1B, 0x0A, 0x0A, 0xD0, 0xF5, 0x12,
+    0xA1, 0x57, 0xD0, 0x2C, 0xD2, 0x5A, 0x91, 0x48, 0xB1, 0x0D, 0x0D, 0xA1, 0x80, 0x82, 0x76, 0xB1,
+    0x15, 0x89, 0x7E, 0x9B, 0xFD, 0x03, 0xD2, 0x6C, 0x13, 0x7E, 0x00, 0x6C, 0x69, 0x0B, 0x5A, 0x2F,
+    0x51, 0xB4, 0xAD, 0x83, 0x88, 0x90, 0xD2, 0x60, 0x24, 0x2F, 0x38, 0x59, 0x5F, 0x0F, 0xE7, 0xCC,
+    0x7B, 0x6F, 0xB3, 0x21, 0x7C, 0x00, 0x4F, 0x7A, 0x47, 0xF6, 0xDC, 0xB9, 0x33, 0x67, 0x66, 0xCE,
+    0xBD, 0x16, 0x91, 0x78, 0x12, 0x91, 0xAC, 0x07, 0xB8, 0x22, 0xAE, 0xC5, 0x8B, 0xAB, 0xA3, 0x31,
+    0xF2, 0x92, 0x76, 0xAE, 0x15, 0x77, 0x0B, 0xAB, 0xDE, 0xA9, 0xEA, 0x5F, 0xF8, 0xEB, 0x39, 0xE1,
+    0x93, 0x67, 0x65, 0xB9, 0x9F, 0x8C, 0xD8, 0x90, 0x70, 0x6B, 0x32, 0x03, 0xD2, 0x0E, 0xF0, 0x86,
+    0xBC, 0xFC, 0xFB, 0x81, 0xD0, 0x18, 0x14, 0x5B, 0xA8, 0x8A, 0xF2, 0xB3, 0xA3, 0x0A, 0x51, 0x26,
+    0xC2, 0x52, 0x95, 0xF8, 0x7D, 0xC5, 0x85, 0xF8, 0x02, 0x4F, 0x7B, 0x0D, 0x8D, 0x09, 0xB3, 0xD4,
+    0xCD, 0xF1, 0xDD, 0x93, 0x3E, 0x19, 0xAE, 0x62, 0xAC, 0x1F, 0x87, 0x17, 0xE1, 0x3F, 0xE7, 0x2E,
+    0xD2, 0xA8, 0x00, 0xF1, 0xDF, 0x80, 0x66, 0x35, 0x49, 0xE2, 0xB3, 0x49, 0x9A, 0xB1, 0x9A, 0x92,
+    0xCB, 0xB3, 0xCB, 0xC9, 0x1D, 0xAC, 0xCE, 0x87, 0xF7, 0x0E, 0xB3, 0x95, 0x04, 0xE3, 0x21, 0xBC,
+    0xCE, 0xE0, 0x95, 0xAD, 0x40, 0xF6, 0x30, 0x2B, 0x24, 0xA4, 0x29, 0x39, 0x43, 0x11, 0xF9, 0x0A,
+    0xF5, 0xFF, 0x98, 0xD5, 0x30, 0x7D, 0x7B, 0xDD, 0xB4, 0xF9, 0xBD, 0x4F, 0x70, 0xB5, 0x6C, 0x9A,
+    0x25, 0x55, 0xBD, 0x73, 0xBC, 0x1F, 0x8F, 0xC6, 0xF3, 0x23, 0xC2, 0xC8, 0x32, 0x2A, 0x2B, 0xE3,
+    0x31, 0x9E, 0x6E, 0x5B, 0xB3, 0x26, 0x16, 0x33, 0xBD, 0x7B, 0x72, 0xFF, 0x0E, 0x37, 0x45, 0x2F,
+    0x83, 0x7C, 0xB0, 0x0D, 0xBE, 0x13, 0x1E, 0xFD, 0x67, 0xEE, 0xB5, 0xE9, 0x15, 0xD2, 0xAC, 0x23,
+    0x82, 0xE9, 0x6B, 0x97, 0xAD, 0x1E, 0x0E, 0x7A, 0x98, 0x55, 0x2D, 0xAB, 0x95, 0xE6, 0x4C, 0x6B,
+    0x6B, 0x80, 0x34, 0x15, 0x98, 0x36, 0x4C, 0xD2, 0x90, 0xF2, 0x37, 0xDB, 0x44, 0x61, 0xFB, 0x26,
+    0x60, 0x4E, 0x7B, 0x09, 0x7D, 0xB0, 0x00, 0x30, 0xF5, 0x90, 0xFD, 0x26, 0xE8, 0x99, 0x07, 0x71,
+    0xEF, 0xA9, 0x85, 0x3F, 0x1E, 0x95, 0xE5, 0xC1, 0xAF, 0x34, 0xF6, 0x39, 0xC1, 0x3C, 0xC5, 0xB5,
+    0xD8, 0x19, 0xCD, 0x29, 0x26, 0xF0, 0x61, 0x00, 0x08, 0xE4, 0x2D, 0x64, 0xC0, 0x43, 0x3A, 0x2A,
+    0xE8, 0xBA, 0x53, 0x6D, 0x25, 0xC4, 0xEC, 0x68, 0x48, 0x11, 0xA7, 0x6A, 0xDD, 0xCC, 0x24, 0xD5,
+    0xF3, 0x93, 0x07, 0x83, 0xD8, 0x48, 0x99, 0x68, 0x96, 0x18, 0x38, 0x08, 0x5C, 0x20, 0x88, 0x7C,
+    0x8E, 0x20, 0x1F, 0x37, 0x20, 0xB4, 0x68, 0x87, 0x39, 0x07, 0x7A, 0x0A, 0xE6, 0x91, 0x66, 0x2D,
+    0x7A, 0xE1, 0x39, 0xF8, 0x4C, 0x39, 0x63, 0x87, 0xE8, 0x48, 0xB7, 0xB0, 0x10, 0xA5, 0x08, 0x22,
+    0xB5, 0x79, 0x50, 0x7C, 0xF2, 0x3A, 0x21, 0xF8, 0x09, 0xCD, 0x51, 0x2D, 0xA4, 0x51, 0x88, 0xF7,
+    0x11, 0x98, 0x1D, 0x85, 0xF4, 0x49, 0xE9, 0xD2, 0xB4, 0x1B, 0xDF, 0xAA, 0x93, 0xFC, 0x12, 0xF5,
+    0xA8, 0x76, 0x18, 0x9F, 0x0F, 0xB5, 0xD0, 0xD6, 0x75, 0xF1, 0x0C, 0x29, 0x57, 0xAD, 0x42, 0xCC,
+    0x19, 0xB8, 0xDE, 0x5B, 0x24, 0x1D, 0x5C, 0x1F, 0x68, 0xB4, 0x88, 0xEB, 0x5D, 0x1F, 0xCD, 0x91,
+    0x8A, 0x16, 0xF9, 0x48, 0x1B, 0x2A, 0x48, 0x74, 0x21, 0x2F, 0xCC, 0xFB, 0x35, 0xA3, 0xA6, 0x4B,
+    0x8A, 0x9A, 0x1E, 0x52, 0x08, 0xFA, 0xF4, 0x81, 0x27, 0xB9, 0x82, 0xF5, 0x60, 0x0D, 0xDC, 0x53,
+    0x33, 0x7C, 0x5C, 0x16, 0xFA, 0x0B, 0x3D, 0xA0, 0x0A, 0xCF, 0xB6, 0xBE, 0xE2, 0xB1, 0x35, 0x5C,
+    0x3C, 0x3D, 0x39, 0xF0, 0x3C, 0x1D, 0x07, 0x9B, 0x13, 0x77, 0xA5, 0xF9, 0xE0, 0x8B, 0x22, 0xAC,
+    0xE5, 0x26, 0x44, 0x37, 0x31, 0xEB, 0xF3, 0x99, 0x08, 0x3E, 0x6E, 0x91, 0x06, 0x38, 0x31, 0x08,
+    0xD4, 0x1F, 0xE8, 0x80, 0xA2, 0x03, 0xF5, 0xB1, 0x97, 0x60, 0xD6, 0x7B, 0x0A, 0xCC, 0x07, 0x6D,
+    0x03, 0x9F, 0xCC, 0xAE, 0x17, 0x14, 0x9D, 0x4E, 0x38, 0xE7, 0xCD, 0xE9, 0x02, 0xC4, 0x42, 0x8D,
+    0x7E, 0x61, 0xC1, 0x4B, 0xB4, 0x24, 0xF3, 0x82, 0x8D, 0xBB, 0xAC, 0x0F, 0x7D, 0x01, 0x36, 0x5D,
+    0xAC, 0x36, 0x66, 0x1D, 0x11, 0x56, 0x28, 0xE9, 0xD1, 0x10, 0xCF, 0x18, 0x64, 0x27, 0xA9, 0xDC,
+    0xB8, 0x7F, 0xFD, 0xD0, 0xEF, 0x91, 0xA7, 0xDA, 0x81, 0xB1, 0xDB, 0xC1, 0xE6, 0xA6, 0xA6, 0x2B,
+    0xCA, 0x24, 0xBA, 0xE4, 0x5A, 0xC5, 0xAA, 0x93, 0x3F, 0xB9, 0xE6, 0x39, 0x9F, 0xBC, 0xC5, 0x5A,
+    0x34, 0x31, 0x55, 0x55, 0x60, 0x2D, 0x1D, 0x38, 0xDE, 0x45, 0xB2, 0x19, 0x4B, 0xE8, 0x0A, 0x44,
+    0x92, 0x2E, 0x38, 0x76, 0x52, 0x0D, 0xD0, 0x5F, 0x04, 0x82, 0x08, 0x3F, 0xBB, 0x8E, 0x72, 0x51,
+    0xBB, 0x47, 0x88, 0xBF, 0xDB, 0x23, 0x5B, 0xA2, 0xF6, 0x6E, 0xBF, 0x67, 0xFA, 0xA4, 0xBC, 0xED,
+    0x1D, 0xBB, 0x42, 0x6D, 0x36, 0xBB, 0x48, 0xEA, 0x5A, 0xBC, 0x67, 0x3D, 0xDE, 0xD3, 0x21, 0xD0,
+    0x36, 0x62, 0xEF, 0xA0, 0x54, 0xBC, 0xAB, 0xD5, 0x5D, 0xE3, 0x1D, 0x79, 0x63, 0x35, 0x59, 0xFE,
+    0x0C, 0xAE, 0x39, 0x7A, 0x8D, 0x77, 0x96, 0xA1, 0x2C, 0x20, 0xA7, 0xB2, 0xA2, 0x75, 0x6D, 0xBC,
+    0x27, 0x32, 0xCE, 0x28, 0xE4, 0x05, 0x20, 0x5F, 0xB2, 0x43, 0x1C, 0x70, 0x47, 0xA1, 0x6B, 0x41,
+    0x2A, 0x3E, 0xD6, 0x23, 0x59, 0xCF, 0x1A, 0x3C, 0x28, 0x5C, 0x53, 0x25, 0xC4, 0x65, 0x86, 0xEF,
+    0x70, 0xF4, 0x56, 0xC6, 0x96, 0x23, 0x57, 0x1B, 0xBE, 0x5E, 0xE8, 0x31, 0xCC, 0xB7, 0x4C, 0xF1,
+    0x6B, 0xEF, 0x7C, 0x94, 0x6D, 0x10, 0xA9, 0xEC, 0x12, 0xE1, 0x20, 0xFC, 0x66, 0x28, 0x96, 0x52,
+    0x6E, 0xAC, 0x95, 0x25, 0x72, 0x97, 0x10, 0xD9, 0x3E, 0x1E, 0xD9, 0x1D, 0x3A, 0xF2, 0xC2, 0xC2,
+    0x18, 0xE9, 0x98, 0x11, 0x77, 0xF5, 0x37, 0x76, 0xD6, 0x8E, 0x77, 0xD5, 0xE3, 0x3C, 0x42, 0xE6,
+    0x34, 0x4C, 0x66, 0x78, 0x5C, 0xEA, 0xF1, 0xA7, 0x7A, 0x75, 0xED, 0x6F, 0xB9, 0x3D, 0xB9, 0xE3,
+    0xCB, 0x3D, 0xAD, 0xF3, 0x4E, 0x22, 0xEB, 0x57, 0xE2, 0x79, 0x29, 0xA6, 0x1E, 0x06, 0xC9, 0x96,
+    0x75, 0x73, 0x48, 0x22, 0x37, 0x6E, 0x99, 0x71, 0x4B, 0x8C, 0x9B, 0x63, 0xBB, 0x02, 0x2B, 0xC8,
+    0xEE, 0x6D, 0x09, 0x9A, 0xAD, 0x9A, 0xB6, 0x7C, 0xB8, 0x27, 0xB5, 0x02, 0x9A, 0xDE, 0x0E, 0xB9,
+    0xF1, 0x9F, 0xDE, 0xC6, 0x17, 0x67, 0xD3, 0x94, 0x6B, 0x7C, 0xF0, 0x1D, 0x2A, 0xF7, 0xDD, 0xFA,
+    0x0B, 0x61, 0x97, 0xB5, 0xAE, 0xDB, 0xC9, 0x20, 0x86, 0xA3, 0x5D, 0x3B, 0x9D, 0xBC, 0xB3, 0x6D,
+    0x8A, 0x20, 0xC8, 0xF7, 0xE6, 0xB1, 0xC8, 0x7A, 0x3A, 0x96, 0x97, 0x6B, 0x37, 0x0D, 0x63, 0x4B,
+    0x98, 0xF8, 0x6B, 0x4D, 0x1F, 0x98, 0xA5, 0x39, 0xFF, 0xF7, 0x78, 0xEC, 0xCA, 0x6F, 0xF8, 0xD9,
+    0x0B, 0xF5, 0x85, 0x77, 0xD5, 0x5F, 0x05, 0x69, 0x46, 0x8B, 0x5D, 0xDB, 0xC7, 0xEE, 0x2A, 0xE5,
+    0x52, 0xC8, 0xFF, 0xE9, 0xF7, 0x0F, 0xC5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0xDB, 0xCA,
+    0x59, 0x60, 0x21, 0xA7, 0x09, 0x05, 0xCD, 0xF6, 0x34, 0x6E, 0xA8, 0x59, 0x0B, 0x44, 0x45, 0x93,
+    0x22, 0x16, 0x45, 0x8A, 0xF4, 0x69, 0x68, 0xE9, 0x6C, 0xD2, 0xE4, 0x17, 0xA4, 0xA7, 0xA0, 0xE1,
+    0x57, 0x78, 0x81, 0x82, 0xE2, 0x0A, 0x4E, 0x42, 0x82, 0x32, 0x8E, 0x52, 0x20, 0xAA, 0xAC, 0x90,
+    0xA3, 0xEC, 0x89, 0xB5, 0x87, 0x99, 0xD9, 0x3B, 0x5F, 0x90, 0x90, 0xA0, 0x08, 0xC2, 0xB2, 0x9F,
+    0xEC, 0xDD, 0xF9, 0x7C, 0x3B, 0x33, 0x9E, 0xBD, 0x06, 0xBA, 0x72, 0xCB, 0xA8, 0x0D, 0x81, 0x42,
+    0xFC, 0x06, 0x50, 0x23, 0x62, 0x13, 0x11, 0xE0, 0x22, 0x15, 0x24, 0x91, 0x19, 0x61, 0xB1, 0x88,
+    0xD0, 0x40, 0xDD, 0xC4, 0x58, 0x02, 0x42, 0x82, 0x10, 0x0F, 0x90, 0xF9, 0x9D, 0xFD, 0xA1, 0x2A,
+    0x2E, 0x59, 0x0E, 0xBF, 0x08, 0x1E, 0x30, 0x0C, 0x3B, 0x15, 0x9E, 0x3C, 0xEF, 0x21, 0x1A, 0xA1,
+    0x35, 0x90, 0x78, 0x92, 0x86, 0xAC, 0x57, 0x8E, 0x7C, 0x9C, 0x91, 0x11, 0xD0, 0x17, 0x83, 0xD8,
+    0xEE, 0xC8, 0x25, 0x8E, 0xE2, 0x72, 0xC1, 0x2E, 0xDD, 0x26, 0xA2, 0x62, 0xC1, 0x58, 0x97, 0xBC,
+    0xB9, 0x04, 0x89, 0xA7, 0x09, 0xF1, 0xA8, 0x10, 0x15, 0x40, 0xCA, 0xA6, 0x20, 0xC6, 0x86, 0x30,
+    0xC1, 0xAD, 0xAA, 0xAA, 0x32, 0xCF, 0xA6, 0xF0, 0x7A, 0x3C, 0x4F, 0x68, 0x79, 0x7F, 0x90, 0x1C,
+    0xED, 0x24, 0x5D, 0xF8, 0x60, 0x84, 0xA5, 0x07, 0xB1, 0x6D, 0xD8, 0xF6, 0x2B, 0x08, 0x57, 0x2B,
+    0x9A, 0xA7, 0x82, 0x43, 0xF8, 0x28, 0xF5, 0xB2, 0x7A, 0x86, 0x4D, 0x42, 0xC9, 0xEB, 0x9E, 0x6F,
+    0x7A, 0xFB, 0x8F, 0x1F, 0x14, 0x73, 0xA3, 0xD0, 0xB5, 0x38, 0x64, 0x12, 0xE8, 0x82, 0x02, 0x5D,
+    0x05, 0xCF, 0x99, 0xB9, 0x9C, 0x63, 0x16, 0xBA, 0x0C, 0x5E, 0x56, 0x07, 0x56, 0x0D, 0x10, 0xF9,
+    0x98, 0xF8, 0xD2, 0xA0, 0x1D, 0x64, 0x94, 0x6D, 0xC9, 0x79, 0x32, 0x23, 0xF9, 0x48, 0x10, 0x09,
+    0xA1, 0x85, 0x17, 0x26, 0x99, 0xA1, 0x5A, 0xB6, 0xFC, 0x1A, 0x32, 0xB6, 0x9E, 0x8E, 0xB2, 0xBD,
+    0x86, 0x98, 0xE0, 0x61, 0x44, 0x86, 0x94, 0x21, 0x95, 0xDC, 0x92, 0xF5, 0xD4, 0x33, 0x5B, 0xA3,
+    0x66, 0xC7, 0x4F, 0x83, 0x77, 0xBA, 0xE4, 0x3C, 0xB7, 0x81, 0xDE, 0xAE, 0xE8, 0xB9, 0xA0, 0xE7,
+    0xA4, 0xAA, 0xF6, 0x78, 0x71, 0x14, 0xB6, 0x39, 0x94, 0xBA, 0x59, 0x57, 0x61, 0xD1, 0xAD, 0x6B,
+    0x20, 0xEB, 0xD9, 0x29, 0xD7, 0x44, 0xC2, 0x31, 0x44, 0x22, 0x8D, 0xBF, 0x51, 0x51, 0x7F, 0xAD,
+    0x62, 0x7E, 0x51, 0xD9, 0xDA, 0x5D, 0xEF, 0xF0, 0x86, 0x26, 0x0A, 0x0A, 0x1B, 0x0C, 0x65, 0x2E,
+    0x58, 0x48, 0x46, 0xE6, 0x86, 0x6D, 0x5C, 0x17, 0xEA, 0x36, 0x42, 0x29, 0x0B, 0x0D, 0xD7, 0x84,
+    0xDA, 0x26, 0x78, 0x60, 0x21, 0xC5, 0xD6, 0xFA, 0x20, 0x14, 0xED, 0x41, 0x4A, 0x9F, 0xAB, 0x27,
+    0x4F, 0xEC, 0x8B, 0xE2, 0xD3, 0xB9, 0x27, 0xA6, 0xB8, 0x13, 0x3A, 0xA8, 0x47, 0x2E, 0xBB, 0x92,
+    0x4E, 0xB3, 0xD7, 0x3F, 0x70, 0x50, 0xEF, 0xCF, 0xFC, 0x9D, 0xD4, 0x3E, 0x98, 0x74, 0x22, 0x0A,
+    0xF5, 0xB0, 0x8C, 0xA4, 0x5A, 0x17, 0xB8, 0xEF, 0x6B, 0x68, 0x0B, 0xA3, 0xE6, 0x36, 0xF9, 0xEE,
+    0x63, 0xAF, 0x3F, 0x8F, 0xA4, 0x48, 0x04, 0xC3, 0x6C, 0x09, 0xF7, 0x5E, 0xE2, 0x1C, 0x0B, 0x5F,
+    0x77, 0x3B, 0x52, 0x0E, 0xB7, 0x99, 0xA5, 0xD8, 0x4F, 0x4D, 0x9E, 0xF4, 0xD2, 0x57, 0x9B, 0x46,
+    0x13, 0x8A, 0x94, 0xD9, 0x48, 0x35, 0x93, 0x54, 0x2B, 0x52, 0x5D, 0x4A, 0xC5, 0x31, 0x70, 0x84,
+    0x8A, 0xEA, 0xC6, 0xC6, 0x0E, 0xEE, 0x22, 0xE8, 0x92, 0x32, 0xE3, 0xC0, 0xDA, 0xA6, 0xE5, 0x04,
+    0xF3, 0x05, 0xDB, 0x17, 0x32, 0xD8, 0x96, 0x3A, 0xE7, 0x33, 0x40, 0xCD, 0xFA, 0x57, 0xEC, 0xA6,
+    0x0D, 0xB5, 0xC3, 0x55, 0xA6, 0xFD, 0xD4, 0x87, 0x6A, 0xE3, 0x66, 0x1B, 0x22, 0xA0, 0x89, 0x63,
+    0xA8, 0xA2, 0x2D, 0xE2, 0xDC, 0xE9, 0x23, 0xB4, 0xCA, 0x68, 0x9B, 0x75, 0x89, 0x8B, 0xA9, 0x74,
+    0xCB, 0xFA, 0x11, 0xF6, 0x39, 0x7A, 0x3C, 0x42, 0x9F, 0xDB, 0xC2, 0x81, 0x87, 0x5D, 0x98, 0x89,
+    0x1E, 0xD1, 0x62, 0x32, 0x22, 0xC6, 0xE7, 0xDC, 0x07, 0x1F, 0xD1, 0xD7, 0x8F, 0xB1, 0x23, 0x7A,
+    0x74, 0x97, 0xCF, 0xBB, 0x8C, 0x28, 0x72, 0x54, 0xAF, 0xBE, 0x4E, 0x68, 0x31, 0xC7, 0x25, 0x92,
+    0x05, 0xA7, 0xD0, 0x14, 0x8E, 0xE7, 0xD9, 0x2E, 0xB9, 0x0D, 0x95, 0x24, 0x15, 0x21, 0xA5, 0x13,
+    0xAA, 0xE6, 0x86, 0x17, 0x65, 0x96, 0xD4, 0xD3, 0x84, 0x94, 0xE1, 0x24, 0xD9, 0xDF, 0x92, 0x63,
+    0x4A, 0x65, 0xDC, 0x49, 0x87, 0x85, 0xEE, 0xE2, 0x5E, 0x9F, 0x78, 0x8A, 0x56, 0x68, 0xA4, 0x9C,
+    0x03, 0x8A, 0x42, 0x1B, 0xA6, 0x64, 0x07, 0xEB, 0x96, 0x0D, 0x53, 0x6E, 0x85, 0x85, 0x38, 0x50,
+    0x32, 0x55, 0x95, 0x1C, 0x6E, 0x1E, 0x90, 0x9D, 0x73, 0xC9, 0xD0, 0x75, 0x2C, 0xF8, 0x55, 0xD0,
+    0x1D, 0xEA, 0xD3, 0xAB, 0x01, 0xEB, 0x3F, 0x43, 0x55, 0xDE, 0x2F, 0xDF, 0xE8, 0xB7, 0xE3, 0x3F,
+    0xBD, 0x77, 0xCA, 0x6A, 0x45, 0x21, 0xFF, 0x45, 0xD6, 0x8C, 0x14, 0xC2, 0x0E, 0x7A, 0xF9, 0x01,
+    0x70, 0x6A, 0xFA, 0xC2, 0x4A, 0xAD, 0x2D, 0xB8, 0x23, 0x43, 0x8F, 0x92, 0x60, 0x84, 0x31, 0x91,
+    0x99, 0x3B, 0xEE, 0x62, 0x6D, 0xA8, 0x0B, 0x69, 0x5C, 0x51, 0x3F, 0xD2, 0x0B, 0x09, 0x92, 0x54,
+    0xDB, 0x50, 0x6F, 0x53, 0xD7, 0x52, 0x13, 0x24, 0xF2, 0x97, 0xCA, 0x3C, 0xF7, 0x71, 0xDE, 0x73,
+    0xD3, 0x16, 0x96, 0x09, 0xAF, 0x3F, 0xF0, 0xD4, 0xC3, 0x86, 0x6D, 0xE6, 0x4E, 0x56, 0xDE, 0x21,
+    0x1F, 0x49, 0x10, 0xCC, 0x3C, 0x8F, 0x04, 0x25, 0xFA, 0xBA, 0x63, 0x43, 0x6C, 0xD6, 0xD0, 0x14,
+    0xA0, 0x7D, 0x72, 0x4E, 0x3B, 0xD4, 0xF8, 0x3C, 0x1A, 0x25, 0x08, 0x65, 0x79, 0x24, 0x48, 0x6C,
+    0xD0, 0x1E, 0x73, 0xF8, 0xC8, 0x0B, 0xC9, 0x88, 0x53, 0x26, 0x79, 0x98, 0xC2, 0x92, 0xA0, 0xEE,
+    0xA7, 0xB3, 0x0E, 0x05, 0x75, 0xE3, 0xD7, 0x4F, 0xCD, 0x55, 0xBB, 0x6E, 0xD4, 0x50, 0x10, 0x1D,
+    0xAF, 0x93, 0x18, 0xB0, 0x84, 0x1B, 0xD2, 0x80, 0x84, 0xA9, 0x23, 0xC0, 0x3F, 0x80, 0x64, 0x23,
+    0x7E, 0x20, 0x42, 0x59, 0x24, 0x68, 0x42, 0x43, 0x41, 0xF8, 0x86, 0xC8, 0x96, 0x28, 0x68, 0xD3,
+    0x40, 0x1B, 0x8A, 0x2D, 0x88, 0x29, 0x68, 0x11, 0x42, 0x5C, 0x8B, 0x14, 0x69, 0x2D, 0x51, 0xD2,
+    0xB8, 0x88, 0x90, 0x80, 0x02, 0x83, 0x36, 0x92, 0xB3, 0xB1, 0x3D, 0x9C, 0x19, 0x7B, 0x77, 0x13,
+    0x41, 0x41, 0xA4, 0x14, 0x58, 0xF6, 0xDD, 0xBD, 0xE3, 0x99, 0x33, 0x67, 0x1E, 0x77, 0x4C, 0xD6,
+    0x23, 0x22, 0x8B, 0x39, 0xA7, 0x90, 0xB9, 0xB4, 0x19, 0x4B, 0xD0, 0xDE, 0xE3, 0x82, 0x13, 0x32,
+    0x7B, 0x35, 0x11, 0xAF, 0x17, 0x34, 0x68, 0x4C, 0x44, 0xCE, 0xA4, 0x21, 0xF2, 0xBF, 0x8F, 0x89,
+    0xE2, 0x37, 0x39, 0x59, 0xED, 0x7F, 0x21, 0x8A, 0x13, 0x72, 0x0F, 0x98, 0x28, 0xFC, 0xD4, 0xD2,
+    0x80, 0x5D, 0x7E, 0x6E, 0x2A, 0x0F, 0x21, 0x64, 0x58, 0x6A, 0x72, 0x98, 0x23, 0xA2, 0xFB, 0x78,
+    0x68, 0xF0, 0x0E, 0x4B, 0x8C, 0x98, 0x5C, 0x16, 0xED, 0xA3, 0x1A, 0xDA, 0x4E, 0x4E, 0x5E, 0xBD,
+    0x80, 0x5D, 0x29, 0x09, 0xC8, 0x08, 0xFA, 0x50, 0xF2, 0x6B, 0xD1, 0x3C, 0x73, 0x51, 0x42, 0x0B,
+    0x0E, 0xA8, 0xD7, 0x41, 0x49, 0x6E, 0x8B, 0x5D, 0x00, 0x7E, 0xC8, 0x38, 0x34, 0x2F, 0x8F, 0x68,
+    0x7E, 0x99, 0x84, 0xC4, 0x56, 0x28, 0xFB, 0x8D, 0x08, 0x84, 0x1C, 0xC4, 0x11, 0x9D, 0xF2, 0x7A,
+    0x0C, 0xA7, 0xAF, 0xDC, 0x16, 0x30, 0x55, 0x28, 0x55, 0x2C, 0xB9, 0x24, 0x9B, 0x3F, 0x02, 0xD9,
+    0x69, 0xAD, 0x55, 0xA2, 0xC5, 0x1E, 0x31, 0xCC, 0xF1, 0xF2, 0x0E, 0x78, 0xB8, 0xEC, 0x49, 0x66,
+    0xEA, 0xB0, 0x82, 0xBB, 0x32, 0x04, 0x8F, 0xF6, 0xB4, 0x3E, 0x69, 0x47, 0x16, 0x4F, 0x82, 0xA6,
+    0x18, 0x25, 0x42, 0xD8, 0x40, 0x87, 0x5B, 0x11, 0x88, 0x53, 0x7A, 0x6B, 0xB7, 0x0E, 0x3B, 0xAD,
+    0x5D, 0xD1, 0x89, 0x80, 0x2C, 0xF2, 0xF3, 0xB0, 0x8C, 0x8B, 0x38, 0xBB, 0x49, 0x67, 0x4E, 0xEB,
+    0x1F, 0x33, 0x61, 0xF1, 0x3E, 0xDD, 0x42, 0x77, 0x44, 0xEC, 0xA3, 0x81, 0x9A, 0x30, 0x89, 0xB9,
+    0xBA, 0x88, 0x2E, 0xC9, 0x3B, 0x94, 0x8D, 0x88, 0x2E, 0xD9, 0x5C, 0xD1, 0x26, 0x3A, 0xEB, 0x45,
+    0x1B, 0x7C, 0x41, 0x7F, 0x05, 0x91, 0xCF, 0xE5, 0x05, 0xB2, 0x3E, 0x1C, 0x8B, 0x65, 0x79, 0x38,
+    0x1C, 0xAE, 0x05, 0x02, 0xA0, 0x8B, 0x42, 0xCD, 0xDF, 0x2E, 0xFE, 0xE5, 0xAD, 0x35, 0x12, 0xE0,
+    0xDC, 0xDB, 0xE5, 0xD6, 0xFD, 0x09, 0x41, 0x6D, 0x6C, 0x6E, 0xBC, 0x08, 0xD5, 0x8F, 0x68, 0x8D,
+    0xDC, 0x82, 0x1E, 0x7A, 0x9C, 0x84, 0x1E, 0x4C, 0xF6, 0x5A, 0xE6, 0x5F, 0x95, 0xCB, 0xE5, 0x75,
+    0xED, 0xA9, 0xE9, 0xB5, 0x4F, 0xB4, 0xB4, 0x0B, 0x43, 0x96, 0xC6, 0xAF, 0x11, 0x01, 0xBA, 0x6B,
+    0x71, 0xED, 0x78, 0x06, 0x36, 0xD2, 0x11, 0x19, 0xC8, 0x9F, 0xAA, 0xD6, 0x64, 0xF8, 0xA4, 0xBE,
+    0x06, 0x29, 0x9E, 0x73, 0xF8, 0xD9, 0x44, 0x81, 0xCA, 0x95, 0xD4, 0x7C, 0xC5, 0xBB, 0x23, 0x3C,
+    0xDF, 0x52, 0x4E, 0x23, 0x1B, 0xF8, 0x41, 0x32, 0x48, 0xDB, 0x74, 0x1B, 0x22, 0xD8, 0xB6, 0xAF,
+    0x27, 0xE9, 0x28, 0x40, 0xF6, 0xDF, 0xC3, 0x04, 0x49, 0x43, 0x20, 0xC3, 0xBB, 0x02, 0xF7, 0x59,
+    0x96, 0x07, 0x69, 0x9A, 0xEE, 0x9C, 0x88, 0x72, 0xA8, 0x01, 0x8A, 0xD3, 0x03, 0x51, 0xC8, 0x4F,
+    0x24, 0x68, 0x6E, 0xB8, 0xDE, 0xE7, 0x07, 0x19, 0xF4, 0xE5, 0x6C, 0x22, 0xDF, 0x63, 0x32, 0x87,
+    0x14, 0xB4, 0xD8, 0x24, 0xDA, 0xFC, 0x06, 0x85, 0x8F, 0xA5, 0x7A, 0xD8, 0x3B, 0x5C, 0xA0, 0x4E,
+    0x72, 0xF8, 0x71, 0x6E, 0x6E, 0xF4, 0x88, 0x32, 0xB2, 0x7E, 0xF4, 0x2C, 0x65, 0x5F, 0xE0, 0x00,
+    0xC1, 0x26, 0xF8, 0xC3, 0x06, 0x8E, 0x82, 0x4A, 0x2A, 0x6A, 0x01, 0x13, 0x3B, 0x9F, 0x23, 0x29,
+    0xAF, 0x8D, 0x77, 0xE7, 0xE7, 0xC9, 0xF2, 0x7A, 0x28, 0xFC, 0x54, 0x1D, 0xB3, 0x55, 0x25, 0xE7,
+    0x67, 0x72, 0xA6, 0x71, 0x34, 0x01, 0x66, 0xB1, 0x02, 0x74, 0x18, 0xB8, 0x1D, 0xDE, 0x72, 0x64,
+    0x80, 0x96, 0x14, 0x8E, 0x95, 0x71, 0x4F, 0xBA, 0xE7, 0xDD, 0xD3, 0xE8, 0x99, 0x28, 0x19, 0x93,
+    0x69, 0x0C, 0x68, 0xF7, 0xAB, 0xBD, 0xDF, 0x4B, 0x44, 0x98, 0x45, 0xD4, 0xE8, 0x0D, 0x37, 0x36,
+    0x1A, 0xD4, 0xE5, 0x5C, 0x70, 0xA7, 0x46, 0x9D, 0x4B, 0xF1, 0x79, 0x45, 0xBB, 0x57, 0x87, 0x4C,
+    0xE7, 0x2D, 0x60, 0xDC, 0x11, 0xF4, 0x71, 0x23, 0x87, 0x92, 0xC6, 0x5E, 0x1B, 0x9A, 0xB8, 0x07,
+    0x39, 0x0D, 0x8A, 0x59, 0x8C, 0x31, 0xF3, 0xA1, 0xCC, 0x7C, 0xB4, 0x8A, 0xA3, 0xE5, 0xF1, 0xA7,
+    0x45, 0x72, 0x64, 0x22, 0x21, 0x47, 0xC9, 0xEC, 0xDC, 0x3A, 0x7A, 0x9C, 0xBD, 0xF1, 0xF4, 0x54,
+    0x2A, 0x22, 0xC4, 0xF3, 0xE9, 0x64, 0xA9, 0x76, 0x50, 0x77, 0x20, 0xB1, 0x36, 0xB5, 0xFC, 0xCD,
+    0x04, 0xFB, 0xE5, 0xB1, 0x3E, 0x5C, 0xD6, 0x72, 0x75, 0x78, 0xE5, 0x6C, 0xDA, 0x89, 0x60, 0x09,
+    0x19, 0x07, 0x6F, 0x5C, 0x91, 0xDA, 0x2B, 0xAB, 0x71, 0xD8, 0x60, 0xF0, 0x81, 0x0B, 0x34, 0x30,
+    0x54, 0xFC, 0x42, 0xFC, 0x33, 0xDC, 0x89, 0x09, 0x68, 0x05, 0x39, 0xF9, 0x25, 0x04, 0x14, 0xE7,
+    0x42, 0x92, 0x13, 0x08, 0x06, 0x38, 0xBF, 0xC2, 0xFC, 0x19, 0x0A, 0x80, 0xA3, 0x80, 0xA6, 0x75,
+    0x95, 0x95, 0x02, 0x46, 0x96, 0xD1, 0x76, 0xD3, 0xB8, 0xDC, 0x2E, 0xA2, 0x4C, 0x03, 0x98, 0x0B,
+    0x88, 0x56, 0xF4, 0x7B, 0xD1, 0xCC, 0x59, 0xC6, 0xCA, 0xB2, 0xD1, 0x84, 0x8D, 0xE5, 0xA3, 0x82,
+    0x3E, 0xF3, 0x67, 0x5C, 0x25, 0x1B, 0x66, 0x5B, 0x9C, 0xD6, 0x3A, 0x64, 0x0A, 0x99, 0x7F, 0x26,
+    0x02, 0x33, 0xB0, 0x04, 0x61, 0xD0, 0xD6, 0x12, 0x00, 0x00, 0x02, 0x7F, 0xAC, 0x82, 0x0C, 0x1C,
+    0x50, 0x3F, 0x08, 0x4C, 0xB9, 0x61, 0x26, 0x86, 0x6F, 0x0B, 0x52, 0xD5, 0xB1, 0x14, 0xEC, 0xAD,
+    0x9E, 0xA5, 0x74, 0xF2, 0x2C, 0xEF, 0xB2, 0x2C, 0x8D, 0xE8, 0x6C, 0xAF, 0xDF, 0xAD, 0x94, 0xB1,
+    0x6E, 0xD4, 0x40, 0x10, 0x86, 0x7F, 0x9F, 0x15, 0x56, 0xC2, 0x48, 0x5B, 0xA5, 0x81, 0xC2, 0x7D,
+    0x1A, 0xBF, 0x41, 0x6C, 0x89, 0x07, 0x80, 0x37, 0xC8, 0x23, 0xA4, 0xA1, 0x4D, 0x36, 0x79, 0x83,
+    0x14, 0xF4, 0x50, 0xD0, 0x70, 0x0D, 0x2F, 0x80, 0xB0, 0x05, 0x05, 0x05, 0x05, 0x96, 0x52, 0x50,
+    0xD0, 0xB8, 0x48, 0x45, 0x83, 0x23, 0x16, 0x38, 0xA4, 0x3D, 0x0F, 0xFF, 0x8C, 0x73, 0xE1, 0x42,
+    0x05, 0x88, 0x95, 0xEE, 0x9F, 0x9B, 0x5D, 0xEF, 0xCE, 0xB7, 0xFF, 0xAE, 0x8D, 0x5B, 0xAD, 0x48,
+    0x57, 0x89, 0xC8, 0x18, 0x28, 0xA9, 0xA6, 0x48, 0xBD, 0x06, 0x50, 0xAE, 0x28, 0x45, 0xA2, 0xE4,
+    0x42, 0x81, 0x9C, 0x50, 0xEA, 0x81, 0xE2, 0xB5, 0x33, 0x9B, 0x73, 0x7D, 0xC8, 0xC9, 0xB4, 0x5C,
+    0x3E, 0xB5, 0xE9, 0xB9, 0x4E, 0x47, 0x41, 0xE9, 0x70, 0xDD, 0xC4, 0xD6, 0x54, 0x79, 0xAF, 0xF2,
+    0x45, 0x25, 0xF1, 0xF7, 0x0C, 0xDA, 0x39, 0x78, 0xCD, 0xEF, 0xAB, 0x8C, 0x5A, 0xD6, 0x8A, 0xB5,
+    0xBD, 0xD6, 0x59, 0x5D, 0x17, 0x6F, 0x75, 0xB9, 0x6A, 0xDC, 0x74, 0x16, 0x0A, 0x58, 0xC8, 0xDE,
+    0x72, 0x29, 0xF2, 0xE0, 0x7A, 0xBA, 0x16, 0x5A, 0xFD, 0x2A, 0x8B, 0x7C, 0x53, 0x68, 0xBB, 0xFA,
+    0xB8, 0x19, 0x3D, 0x94, 0x0B, 0x5D, 0x58, 0xB8, 0x8F, 0x4C, 0x9E, 0x7C, 0x5C, 0x23, 0x9B, 0xF2,
+    0xB1, 0xEA, 0xB1, 0x46, 0xCA, 0x12, 0xB5, 0x46, 0xD9, 0x1D, 0xC3, 0x77, 0x8B, 0x58, 0x21, 0x1F,
+    0xB1, 0xEF, 0x4F, 0x90, 0xE0, 0xDF, 0x0C, 0x1C, 0x58, 0x5C, 0x4E, 0xCB, 0x17, 0x9F, 0x96, 0xEB,
+    0x60, 0x6B, 0x1F, 0x98, 0x9E, 0xF7, 0x1C, 0xC8, 0xC6, 0x15, 0x67, 0xE0, 0x65, 0xAD, 0x33, 0x6A,
+    0xD7, 0x73, 0x46, 0xD9, 0x24, 0x0E, 0xF8, 0xAE, 0xEC, 0x7C, 0xE7, 0xFB, 0x45, 0xCA, 0x47, 0x3F,
+    0xA0, 0xBA, 0x48, 0x87, 0x03, 0xCB, 0x8A, 0xF4, 0xBA, 0x0F, 0xB3, 0x72, 0xE7, 0xF1, 0x16, 0xFA,
+    0x0D, 0xB8, 0xB3, 0x7B, 0x84, 0xE3, 0x8E, 0x4B, 0x5D, 0x0F, 0x50, 0x38, 0x18, 0x1C, 0xA0, 0x70,
+    0x6C, 0xFB, 0x5E, 0xFD, 0x51, 0x38, 0x18, 0x1C, 0xDB, 0xEF, 0x70, 0x30, 0x38, 0x36, 0xC2, 0xE9,
+    0xC1, 0x39, 0xED, 0x52, 0x38, 0x18, 0x1C, 0x95, 0x70, 0x54, 0x85, 0xC3, 0xDF, 0xC2, 0x4D, 0x06,
+    0xC7, 0x93, 0x72, 0x09, 0x74, 0xD8, 0x49, 0x77, 0xDC, 0xC2, 0x7D, 0x8B, 0x55, 0x31, 0xBA, 0x48,
+    0xB8, 0xD6, 0x45, 0xC2, 0x15, 0xDF, 0xE3, 0xE2, 0x32, 0xA2, 0x8D, 0x38, 0x3A, 0x42, 0xB1, 0x42,
+    0x79, 0xD0, 0x38, 0x81, 0x3B, 0xEF, 0x9D, 0x8C, 0x84, 0x73, 0xB1, 0x25, 0x9C, 0x8B, 0xC5, 0x58,
+    0xBB, 0x0F, 0x7C, 0xAC, 0x6C, 0x24, 0xB2, 0x7E, 0x57, 0x46, 0xBD, 0x0F, 0xFF, 0x0E, 0x37, 0x3B,
+    0xB7, 0x36, 0x38, 0x55, 0x51, 0xE7, 0x14, 0x8E, 0xAA, 0x70, 0x30, 0x38, 0xAA, 0xC2, 0x39, 0x83,
+    0xA3, 0x2A, 0x5C, 0x34, 0xB8, 0x08, 0x83, 0x83, 0xC1, 0xA9, 0x73, 0x84, 0x83, 0xC1, 0xA9, 0x73,
+    0xF1, 0x8F, 0x9C, 0xCB, 0xEC, 0xC2, 0xAA, 0xFF, 0x95, 0x9E, 0x51, 0xCB, 0x91, 0xC5, 0xF4, 0x3F,
+    0xBA, 0xEC, 0x62, 0xDF, 0x6C, 0xDD, 0xDD, 0x53, 0x79, 0x27, 0x55, 0x0A, 0xC3, 0x2E, 0x6E, 0x9F,
+    0x61, 0xAF, 0xC1, 0x73, 0xBE, 0xB1, 0xF5, 0x08, 0x79, 0x2B, 0x4D, 0xB9, 0x46, 0xF8, 0x2A, 0x74,
+    0x9C, 0xFF, 0xB4, 0xAB, 0xCB, 0x25, 0x7B, 0x88, 0x9D, 0x06, 0xBB, 0x5B, 0x1E, 0xE2, 0xCE, 0x55,
+    0x4C, 0x73, 0xF0, 0x57, 0x51, 0xE6, 0xE8, 0x3F, 0xCF, 0x71, 0xCC, 0x2C, 0x7A, 0x3A, 0x73, 0xF5,
+    0xB0, 0x46, 0xFF, 0xE3, 0x95, 0xDD, 0x2A, 0x92, 0x9C, 0xAA, 0x2D, 0xFA, 0x76, 0x26, 0x4B, 0x27,
+    0xAE, 0xA3, 0x69, 0xAA, 0x92, 0x7D, 0x13, 0x7A, 0x49, 0x9A, 0x5E, 0xE4, 0x92, 0x82, 0x5A, 0x56,
+    0x49, 0x0C, 0x32, 0x61, 0x21, 0xD2, 0x04, 0xBE, 0xC8, 0x81, 0x0E, 0x07, 0x19, 0xF8, 0x6D, 0x6A,
+    0x18, 0x5F, 0x8B, 0x1A, 0x1E, 0xC4, 0x69, 0x8A, 0x30, 0xE9, 0xA8, 0xE6, 0x96, 0x22, 0xC4, 0xA0,
+    0x29, 0xC2, 0x89, 0xA5, 0x38, 0xCE, 0x2D, 0xC5, 0x51, 0x65, 0x29, 0xE6, 0x51, 0xC6, 0x39, 0xC5,
+    0xA3, 0xAD, 0xCD, 0xFE, 0x04,
+};
+
+static const uint32_t bookerly_16_bolditalicBlockOffsets[47] = {
+    0, 1093, 2201, 3160, 4108, 5239, 6419, 7456,
+    8252, 8927, 9614, 10697, 11542, 12264, 13108, 13822,
+    14675, 15568, 16584, 17483, 18340, 18857, 19854, 20979,
+    21946, 22844, 23717, 24801, 26017, 27188, 28246, 29346,
+    30408, 31381, 32318, 33260, 34235, 35271, 36065, 37115,
+    37958, 39164, 40326, 41350, 42200, 43053, 43637,
+};
+
+static const uint16_t bookerly_16_bolditalicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_bolditalicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_16_bolditalicPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
@@ -5647,726 +2934,726 @@ static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
     { 19, 24, 21, 0, 23, 114, 1659 }, // 3
     { 20, 23, 21, 0, 23, 115, 1773 }, // 4
     { 19, 24, 21, 1, 23, 114, 1888 }, // 5
-    { 20, 24, 21, 1, 23, 120, 2002 }, // 6
-    { 19, 24, 21, 3, 23, 114, 2122 }, // 7
-    { 19, 24, 21, 1, 23, 114, 2236 }, // 8
-    { 21, 24, 21, -1, 23, 126, 2350 }, // 9
-    { 9, 19, 10, 1, 18, 43, 2476 }, // :
-    { 12, 24, 10, -2, 18, 72, 2519 }, // ;
-    { 15, 16, 21, 3, 19, 60, 2591 }, // <
-    { 15, 10, 21, 3, 16, 38, 2651 }, // =
-    { 15, 16, 21, 3, 19, 60, 2689 }, // >
-    { 12, 25, 13, 2, 24, 75, 2749 }, // ?
-    { 31, 30, 33, 1, 23, 233, 2824 }, // @
-    { 26, 24, 24, -2, 24, 156, 3057 }, // A
-    { 22, 25, 21, -2, 24, 138, 3213 }, // B
-    { 21, 25, 22, 1, 24, 132, 3351 }, // C
-    { 26, 25, 24, -2, 24, 163, 3483 }, // D
-    { 23, 23, 21, -2, 23, 133, 3646 }, // E
-    { 22, 23, 19, -2, 23, 127, 3779 }, // F
-    { 22, 25, 24, 1, 24, 138, 3906 }, // G
-    { 30, 23, 26, -2, 23, 173, 4044 }, // H
-    { 17, 23, 13, -2, 23, 98, 4217 }, // I
-    { 21, 30, 13, -6, 23, 158, 4315 }, // J
-    { 27, 24, 24, -2, 23, 162, 4473 }, // K
-    { 20, 23, 19, -2, 23, 115, 4635 }, // L
-    { 33, 23, 30, -3, 23, 190, 4750 }, // M
-    { 29, 24, 26, -1, 23, 174, 4940 }, // N
-    { 24, 25, 24, 0, 24, 150, 5114 }, // O
-    { 23, 24, 20, -2, 24, 138, 5264 }, // P
-    { 28, 32, 25, 0, 24, 224, 5402 }, // Q
-    { 24, 25, 22, -2, 24, 150, 5626 }, // R
-    { 19, 25, 18, -1, 24, 119, 5776 }, // S
-    { 22, 23, 22, 2, 23, 127, 5895 }, // T
-    { 26, 24, 26, 2, 23, 156, 6022 }, // U
-    { 25, 24, 24, 2, 23, 150, 6178 }, // V
-    { 33, 24, 33, 2, 23, 198, 6328 }, // W
-    { 27, 23, 22, -3, 23, 156, 6526 }, // X
-    { 23, 23, 22, 1, 23, 133, 6682 }, // Y
-    { 21, 24, 20, -1, 23, 126, 6815 }, // Z
-    { 15, 32, 11, -2, 26, 120, 6941 }, // [
-    { 15, 26, 17, 1, 24, 98, 7061 }, // <backslash>
-    { 15, 32, 11, -2, 26, 120, 7159 }, // ]
-    { 17, 17, 21, 2, 22, 73, 7279 }, // ^
-    { 17, 4, 17, 0, -1, 17, 7352 }, // _
-    { 7, 9, 20, 7, 28, 16, 7369 }, // `
-    { 20, 19, 20, 0, 18, 95, 7385 }, // a
-    { 18, 27, 18, 0, 26, 122, 7480 }, // b
-    { 15, 19, 15, 0, 18, 72, 7602 }, // c
-    { 20, 27, 20, 0, 26, 135, 7674 }, // d
-    { 15, 19, 16, 0, 18, 72, 7809 }, // e
-    { 24, 34, 14, -6, 26, 204, 7881 }, // f
-    { 23, 26, 17, -3, 18, 150, 8085 }, // g
-    { 19, 27, 20, 0, 26, 129, 8235 }, // h
-    { 10, 27, 11, 1, 26, 68, 8364 }, // i
-    { 19, 34, 10, -7, 26, 162, 8432 }, // j
-    { 17, 27, 18, 0, 26, 115, 8594 }, // k
-    { 10, 27, 11, 1, 26, 68, 8709 }, // l
-    { 27, 19, 29, 1, 18, 129, 8777 }, // m
-    { 19, 19, 20, 1, 18, 91, 8906 }, // n
-    { 17, 19, 18, 0, 18, 81, 8997 }, // o
-    { 21, 26, 19, -3, 18, 137, 9078 }, // p
-    { 19, 26, 19, 0, 18, 124, 9215 }, // q
-    { 16, 18, 16, 1, 18, 72, 9339 }, // r
-    { 15, 19, 14, -1, 18, 72, 9411 }, // s
-    { 15, 23, 14, 0, 22, 87, 9483 }, // t
-    { 20, 19, 20, 0, 18, 95, 9570 }, // u
-    { 17, 19, 17, 0, 18, 81, 9665 }, // v
-    { 25, 19, 25, 0, 18, 119, 9746 }, // w
-    { 21, 19, 19, -1, 18, 100, 9865 }, // x
-    { 22, 26, 17, -5, 18, 143, 9965 }, // y
-    { 17, 19, 16, -1, 18, 81, 10108 }, // z
-    { 15, 33, 14, 1, 27, 124, 10189 }, // {
-    { 11, 30, 10, -1, 26, 83, 10313 }, // |
-    { 15, 33, 14, -2, 27, 124, 10396 }, // }
-    { 17, 8, 21, 2, 15, 34, 10520 }, // ~
-    { 0, 0, 7, 0, 0, 0, 10554 }, //  
-    { 11, 26, 11, -1, 18, 72, 10554 }, // ¡
-    { 17, 33, 21, 2, 26, 141, 10626 }, // ¢
-    { 22, 24, 21, -1, 23, 132, 10767 }, // £
-    { 21, 16, 21, 0, 19, 84, 10899 }, // ¤
-    { 23, 23, 21, 1, 23, 133, 10983 }, // ¥
-    { 11, 30, 10, -1, 26, 83, 11116 }, // ¦
-    { 17, 26, 17, -1, 23, 111, 11199 }, // §
-    { 12, 6, 20, 4, 26, 18, 11310 }, // ¨
-    { 25, 25, 26, 0, 24, 157, 11328 }, // ©
-    { 14, 17, 15, 1, 24, 60, 11485 }, // ª
-    { 19, 13, 20, 1, 15, 62, 11545 }, // «
-    { 15, 9, 21, 3, 16, 34, 11607 }, // ¬
-    { 11, 5, 13, 1, 11, 14, 11641 }, // ­
-    { 19, 18, 19, 0, 26, 86, 11655 }, // ®
-    { 12, 4, 20, 4, 24, 12, 11741 }, // ¯
-    { 13, 12, 17, 2, 23, 39, 11753 }, // °
-    { 15, 21, 21, 3, 20, 79, 11792 }, // ±
-    { 14, 16, 15, 0, 28, 56, 11871 }, // ²
-    { 12, 17, 15, 1, 28, 51, 11927 }, // ³
-    { 7, 10, 20, 7, 29, 18, 11978 }, // ´
-    { 22, 26, 20, -2, 18, 143, 11996 }, // µ
-    { 22, 28, 20, -1, 23, 154, 12139 }, // ¶
-    { 6, 6, 10, 2, 12, 9, 12293 }, // ·
-    { 8, 8, 20, 6, -1, 16, 12302 }, // ¸
-    { 11, 16, 15, 1, 28, 44, 12318 }, // ¹
-    { 13, 17, 15, 1, 24, 56, 12362 }, // º
-    { 19, 13, 20, 0, 15, 62, 12418 }, // »
-    { 34, 28, 36, 1, 25, 238, 12480 }, // ¼
-    { 34, 28, 36, 1, 25, 238, 12718 }, // ½
-    { 34, 28, 36, 1, 25, 238, 12956 }, // ¾
-    { 11, 25, 13, 0, 18, 69, 13194 }, // ¿
-    { 26, 33, 24, -2, 33, 215, 13263 }, // À
-    { 26, 33, 24, -2, 33, 215, 13478 }, // Á
-    { 26, 32, 24, -2, 32, 208, 13693 }, // Â
-    { 26, 32, 24, -2, 32, 208, 13901 }, // Ã
-    { 26, 31, 24, -2, 31, 202, 14109 }, // Ä
-    { 26, 33, 24, -2, 33, 215, 14311 }, // Å
-    { 34, 23, 31, -3, 23, 196, 14526 }, // Æ
-    { 21, 33, 22, 1, 24, 174, 14722 }, // Ç
-    { 23, 33, 21, -2, 33, 190, 14896 }, // È
-    { 23, 33, 21, -2, 33, 190, 15086 }, // É
-    { 23, 32, 21, -2, 32, 184, 15276 }, // Ê
-    { 23, 31, 21, -2, 31, 179, 15460 }, // Ë
-    { 17, 33, 13, -2, 33, 141, 15639 }, // Ì
-    { 17, 33, 13, -2, 33, 141, 15780 }, // Í
-    { 18, 32, 13, -2, 32, 144, 15921 }, // Î
-    { 18, 31, 13, -2, 31, 140, 16065 }, // Ï
-    { 26, 25, 24, -2, 24, 163, 16205 }, // Ð
-    { 29, 33, 26, -1, 32, 240, 16368 }, // Ñ
-    { 24, 34, 24, 0, 33, 204, 16608 }, // Ò
-    { 24, 34, 24, 0, 33, 204, 16812 }, // Ó
-    { 24, 33, 24, 0, 32, 198, 17016 }, // Ô
-    { 24, 33, 24, 0, 32, 198, 17214 }, // Õ
-    { 24, 32, 24, 0, 31, 192, 17412 }, // Ö
-    { 15, 15, 21, 3, 19, 57, 17604 }, // ×
-    { 27, 25, 24, -1, 24, 169, 17661 }, // Ø
-    { 26, 34, 26, 2, 33, 221, 17830 }, // Ù
-    { 26, 34, 26, 2, 33, 221, 18051 }, // Ú
-    { 26, 33, 26, 2, 32, 215, 18272 }, // Û
-    { 26, 32, 26, 2, 31, 208, 18487 }, // Ü
-    { 23, 33, 22, 1, 33, 190, 18695 }, // Ý
-    { 22, 23, 20, -2, 23, 127, 18885 }, // Þ
-    { 27, 34, 21, -6, 26, 230, 19012 }, // ß
-    { 20, 29, 20, 0, 28, 145, 19242 }, // à
-    { 20, 30, 20, 0, 29, 150, 19387 }, // á
-    { 20, 29, 20, 0, 28, 145, 19537 }, // â
-    { 20, 27, 20, 0, 26, 135, 19682 }, // ã
-    { 20, 27, 20, 0, 26, 135, 19817 }, // ä
-    { 20, 29, 20, 0, 28, 145, 19952 }, // å
-    { 26, 19, 26, 0, 18, 124, 20097 }, // æ
-    { 15, 27, 15, 0, 18, 102, 20221 }, // ç
-    { 15, 29, 16, 0, 28, 109, 20323 }, // è
-    { 17, 30, 16, 0, 29, 128, 20432 }, // é
-    { 16, 29, 16, 0, 28, 116, 20560 }, // ê
-    { 17, 27, 16, 0, 26, 115, 20676 }, // ë
-    { 9, 29, 11, 1, 28, 66, 20791 }, // ì
-    { 13, 30, 11, 1, 29, 98, 20857 }, // í
-    { 12, 29, 11, 1, 28, 87, 20955 }, // î
-    { 13, 27, 11, 1, 26, 88, 21042 }, // ï
-    { 18, 28, 18, 0, 27, 126, 21130 }, // ð
-    { 19, 27, 20, 1, 26, 129, 21256 }, // ñ
-    { 17, 29, 18, 0, 28, 124, 21385 }, // ò
-    { 18, 30, 18, 0, 29, 135, 21509 }, // ó
-    { 18, 29, 18, 0, 28, 131, 21644 }, // ô
-    { 18, 27, 18, 0, 26, 122, 21775 }, // õ
-    { 18, 27, 18, 0, 26, 122, 21897 }, // ö
-    { 15, 16, 21, 3, 19, 60, 22019 }, // ÷
-    { 22, 19, 18, -2, 18, 105, 22079 }, // ø
-    { 20, 29, 20, 0, 28, 145, 22184 }, // ù
-    { 20, 30, 20, 0, 29, 150, 22329 }, // ú
-    { 20, 29, 20, 0, 28, 145, 22479 }, // û
-    { 20, 27, 20, 0, 26, 135, 22624 }, // ü
-    { 22, 37, 17, -5, 29, 204, 22759 }, // ý
-    { 22, 34, 18, -4, 26, 187, 22963 }, // þ
-    { 22, 34, 17, -5, 26, 187, 23150 }, // ÿ
-    { 26, 30, 24, -2, 30, 195, 23337 }, // Ā
-    { 20, 25, 20, 0, 24, 125, 23532 }, // ā
-    { 26, 32, 24, -2, 32, 208, 23657 }, // Ă
-    { 20, 27, 20, 0, 26, 135, 23865 }, // ă
-    { 26, 31, 24, -2, 24, 202, 24000 }, // Ą
-    { 20, 25, 20, 0, 18, 125, 24202 }, // ą
-    { 21, 34, 22, 1, 33, 179, 24327 }, // Ć
-    { 17, 30, 15, 0, 29, 128, 24506 }, // ć
-    { 21, 33, 22, 1, 32, 174, 24634 }, // Ĉ
-    { 16, 29, 15, 0, 28, 116, 24808 }, // ĉ
-    { 21, 33, 22, 1, 32, 174, 24924 }, // Ċ
-    { 15, 27, 15, 0, 26, 102, 25098 }, // ċ
-    { 21, 33, 22, 1, 32, 174, 25200 }, // Č
-    { 18, 29, 15, 0, 28, 131, 25374 }, // č
-    { 26, 33, 24, -2, 32, 215, 25505 }, // Ď
-    { 25, 27, 20, 0, 26, 169, 25720 }, // ď
-    { 26, 25, 24, -2, 24, 163, 25889 }, // Đ
-    { 22, 27, 20, 0, 26, 149, 26052 }, // đ
-    { 23, 30, 21, -2, 30, 173, 26201 }, // Ē
-    { 17, 25, 16, 0, 24, 107, 26374 }, // ē
-    { 23, 32, 21, -2, 32, 184, 26481 }, // Ĕ
-    { 17, 27, 16, 0, 26, 115, 26665 }, // ĕ
-    { 23, 32, 21, -2, 32, 184, 26780 }, // Ė
-    { 15, 27, 16, 0, 26, 102, 26964 }, // ė
-    { 23, 30, 21, -2, 23, 173, 27066 }, // Ę
-    { 15, 25, 16, 0, 18, 94, 27239 }, // ę
-    { 23, 32, 21, -2, 32, 184, 27333 }, // Ě
-    { 18, 29, 16, 0, 28, 131, 27517 }, // ě
-    { 22, 33, 24, 1, 32, 182, 27648 }, // Ĝ
-    { 23, 36, 17, -3, 28, 207, 27830 }, // ĝ
-    { 22, 33, 24, 1, 32, 182, 28037 }, // Ğ
-    { 23, 34, 17, -3, 26, 196, 28219 }, // ğ
-    { 22, 33, 24, 1, 32, 182, 28415 }, // Ġ
-    { 23, 34, 17, -3, 26, 196, 28597 }, // ġ
-    { 22, 33, 24, 1, 24, 182, 28793 }, // Ģ
-    { 23, 37, 17, -3, 29, 213, 28975 }, // ģ
-    { 30, 32, 26, -2, 32, 240, 29188 }, // Ĥ
-    { 19, 35, 20, 0, 34, 167, 29428 }, // ĥ
-    { 30, 23, 26, -2, 23, 173, 29595 }, // Ħ
-    { 19, 27, 20, 0, 26, 129, 29768 }, // ħ
-    { 18, 32, 13, -2, 32, 144, 29897 }, // Ĩ
-    { 13, 27, 11, 1, 26, 88, 30041 }, // ĩ
-    { 18, 30, 13, -2, 30, 135, 30129 }, // Ī
-    { 13, 25, 11, 1, 24, 82, 30264 }, // ī
-    { 17, 32, 13, -2, 32, 136, 30346 }, // Ĭ
-    { 13, 27, 11, 1, 26, 88, 30482 }, // ĭ
-    { 17, 30, 13, -2, 23, 128, 30570 }, // Į
-    { 10, 33, 11, 1, 26, 83, 30698 }, // į
-    { 17, 32, 13, -2, 32, 136, 30781 }, // İ
-    { 9, 19, 11, 1, 18, 43, 30917 }, // ı
-    { 30, 30, 26, -2, 23, 225, 30960 }, // Ĳ
-    { 22, 34, 21, 1, 26, 187, 31185 }, // ĳ
-    { 22, 39, 13, -6, 32, 215, 31372 }, // Ĵ
-    { 21, 36, 10, -7, 28, 189, 31587 }, // ĵ
-    { 27, 32, 24, -2, 23, 216, 31776 }, // Ķ
-    { 17, 35, 18, 0, 26, 149, 31992 }, // ķ
-    { 18, 19, 19, 1, 18, 86, 32141 }, // ĸ
-    { 20, 33, 19, -2, 33, 165, 32227 }, // Ĺ
-    { 12, 35, 11, 1, 34, 105, 32392 }, // ĺ
-    { 20, 32, 19, -2, 23, 160, 32497 }, // Ļ
-    { 12, 35, 11, -1, 26, 105, 32657 }, // ļ
-    { 22, 26, 19, -2, 26, 143, 32762 }, // Ľ
-    { 15, 27, 12, 1, 26, 102, 32905 }, // ľ
-    { 21, 23, 19, -2, 23, 121, 33007 }, // Ŀ
-    { 14, 27, 14, 1, 26, 95, 33128 }, // ŀ
-    { 20, 23, 19, -2, 23, 115, 33223 }, // Ł
-    { 13, 27, 10, -1, 26, 88, 33338 }, // ł
-    { 29, 34, 26, -1, 33, 247, 33426 }, // Ń
-    { 19, 30, 20, 1, 29, 143, 33673 }, // ń
-    { 29, 32, 26, -1, 23, 232, 33816 }, // Ņ
-    { 19, 27, 20, 1, 18, 129, 34048 }, // ņ
-    { 29, 33, 26, -1, 32, 240, 34177 }, // Ň
-    { 19, 29, 20, 1, 28, 138, 34417 }, // ň
-    { 25, 26, 27, 2, 25, 163, 34555 }, // ŉ
-    { 29, 30, 26, -1, 23, 218, 34718 }, // Ŋ
-    { 18, 26, 19, 1, 18, 117, 34936 }, // ŋ
-    { 24, 31, 24, 0, 30, 186, 35053 }, // Ō
-    { 18, 25, 18, 0, 24, 113, 35239 }, // ō
-    { 24, 33, 24, 0, 32, 198, 35352 }, // Ŏ
-    { 18, 27, 18, 0, 26, 122, 35550 }, // ŏ
-    { 25, 34, 24, 0, 33, 213, 35672 }, // Ő
-    { 20, 29, 18, 0, 28, 145, 35885 }, // ő
-    { 33, 25, 33, 0, 24, 207, 36030 }, // Œ
-    { 27, 19, 27, 0, 18, 129, 36237 }, // œ
-    { 24, 34, 22, -2, 33, 204, 36366 }, // Ŕ
-    { 16, 29, 16, 1, 29, 116, 36570 }, // ŕ
-    { 24, 33, 22, -2, 24, 198, 36686 }, // Ŗ
-    { 18, 27, 16, -1, 18, 122, 36884 }, // ŗ
-    { 24, 33, 22, -2, 32, 198, 37006 }, // Ř
-    { 17, 28, 16, 1, 28, 119, 37204 }, // ř
-    { 19, 34, 18, -1, 33, 162, 37323 }, // Ś
-    { 17, 30, 14, -1, 29, 128, 37485 }, // ś
-    { 19, 33, 18, -1, 32, 157, 37613 }, // Ŝ
-    { 16, 29, 14, -1, 28, 116, 37770 }, // ŝ
-    { 19, 33, 18, -1, 24, 157, 37886 }, // Ş
-    { 15, 27, 14, -1, 18, 102, 38043 }, // ş
-    { 20, 33, 18, -1, 32, 165, 38145 }, // Š
-    { 18, 29, 14, -1, 28, 131, 38310 }, // š
-    { 22, 32, 22, 2, 23, 176, 38441 }, // Ţ
-    { 15, 31, 14, 0, 22, 117, 38617 }, // ţ
-    { 22, 32, 22, 2, 32, 176, 38734 }, // Ť
-    { 17, 28, 14, 0, 27, 119, 38910 }, // ť
-    { 22, 23, 22, 2, 23, 127, 39029 }, // Ŧ
-    { 15, 23, 14, 0, 22, 87, 39156 }, // ŧ
-    { 26, 33, 26, 2, 32, 215, 39243 }, // Ũ
-    { 20, 27, 20, 0, 26, 135, 39458 }, // ũ
-    { 26, 31, 26, 2, 30, 202, 39593 }, // Ū
-    { 20, 25, 20, 0, 24, 125, 39795 }, // ū
-    { 26, 33, 26, 2, 32, 215, 39920 }, // Ŭ
-    { 20, 27, 20, 0, 26, 135, 40135 }, // ŭ
-    { 26, 34, 26, 2, 33, 221, 40270 }, // Ů
-    { 20, 29, 20, 0, 28, 145, 40491 }, // ů
-    { 26, 34, 26, 2, 33, 221, 40636 }, // Ű
-    { 20, 29, 20, 0, 28, 145, 40857 }, // ű
-    { 26, 30, 26, 2, 23, 195, 41002 }, // Ų
-    { 20, 25, 20, 0, 18, 125, 41197 }, // ų
-    { 33, 33, 33, 2, 32, 273, 41322 }, // Ŵ
-    { 25, 29, 25, 0, 28, 182, 41595 }, // ŵ
-    { 23, 32, 22, 1, 32, 184, 41777 }, // Ŷ
-    { 22, 36, 17, -5, 28, 198, 41961 }, // ŷ
-    { 23, 31, 22, 1, 31, 179, 42159 }, // Ÿ
-    { 21, 34, 20, -1, 33, 179, 42338 }, // Ź
-    { 17, 30, 16, -1, 29, 128, 42517 }, // ź
-    { 21, 33, 20, -1, 32, 174, 42645 }, // Ż
-    { 17, 27, 16, -1, 26, 115, 42819 }, // ż
-    { 21, 33, 20, -1, 32, 174, 42934 }, // Ž
-    { 17, 29, 16, -1, 28, 124, 43108 }, // ž
-    { 24, 34, 14, -6, 26, 204, 43232 }, // ſ
-    { 7, 9, 0, -5, 28, 16, 43436 }, // ̀
-    { 7, 10, 0, -2, 29, 18, 43452 }, // ́
-    { 12, 9, 0, -7, 28, 27, 43470 }, // ̂
-    { 12, 6, 0, -6, 26, 18, 43497 }, // ̃
-    { 12, 4, 0, -6, 24, 12, 43515 }, // ̄
-    { 12, 6, 0, -6, 26, 18, 43527 }, // ̆
-    { 6, 6, 0, -3, 26, 9, 43545 }, // ̇
-    { 12, 6, 0, -6, 26, 18, 43554 }, // ̈
-    { 9, 10, 0, -4, 29, 23, 43572 }, // ̉
-    { 10, 9, 0, -5, 28, 23, 43595 }, // ̊
-    { 13, 9, 0, -6, 28, 30, 43618 }, // ̋
-    { 12, 8, 0, -5, 28, 24, 43648 }, // ̌
-    { 11, 9, 0, -7, 28, 25, 43672 }, // ̏
-    { 11, 7, 0, -6, 26, 20, 43697 }, // ̑
-    { 7, 10, 0, -3, 29, 18, 43717 }, // ̒
-    { 7, 9, 0, -3, 29, 16, 43735 }, // ̓
-    { 6, 9, 0, -4, 29, 14, 43751 }, // ̔
-    { 6, 9, 0, -3, 29, 14, 43765 }, // ̕
-    { 6, 8, 0, -3, 21, 12, 43779 }, // ̛
-    { 6, 6, 0, -3, -2, 9, 43791 }, // ̣
-    { 12, 5, 0, -6, -3, 15, 43800 }, // ̤
-    { 8, 8, 0, -4, -1, 16, 43815 }, // ̥
-    { 7, 8, 0, -4, -1, 14, 43831 }, // ̦
-    { 8, 8, 0, -4, -1, 16, 43845 }, // ̧
-    { 8, 8, 0, -4, 1, 16, 43861 }, // ̨
-    { 6, 9, 9, -1, -1, 14, 43877 }, // ̩
-    { 13, 8, 0, -7, -1, 26, 43891 }, // ̭
-    { 12, 6, 0, -6, -2, 18, 43917 }, // ̮
-    { 12, 7, 0, -6, -2, 21, 43935 }, // ̰
-    { 12, 4, 0, -6, -3, 12, 43956 }, // ̱
-    { 12, 7, 0, -6, 26, 21, 43968 }, // ͂
-    { 13, 14, 0, -7, 34, 46, 43989 }, // ̈́
-    { 6, 7, 0, -2, -2, 11, 44035 }, // ͅ
-    { 23, 33, 21, -2, 33, 190, 44046 }, // Ѐ
-    { 23, 31, 21, -2, 31, 179, 44236 }, // Ё
-    { 22, 30, 25, 2, 23, 165, 44415 }, // Ђ
-    { 23, 33, 19, -2, 33, 190, 44580 }, // Ѓ
-    { 22, 25, 21, 0, 24, 138, 44770 }, // Є
-    { 19, 25, 18, -1, 24, 119, 44908 }, // Ѕ
-    { 17, 23, 13, -2, 23, 98, 45027 }, // І
-    { 18, 31, 13, -2, 31, 140, 45125 }, // Ї
-    { 21, 30, 13, -6, 23, 158, 45265 }, // Ј
-    { 32, 24, 31, -2, 23, 192, 45423 }, // Љ
-    { 33, 24, 32, -2, 23, 198, 45615 }, // Њ
-    { 24, 23, 28, 2, 23, 138, 45813 }, // Ћ
-    { 27, 34, 23, -2, 33, 230, 45951 }, // Ќ
-    { 30, 33, 27, -2, 33, 248, 46181 }, // Ѝ
-    { 24, 34, 22, 1, 33, 204, 46429 }, // Ў
-    { 29, 31, 25, -2, 23, 225, 46633 }, // Џ
-    { 26, 24, 24, -2, 24, 156, 46858 }, // А
-    { 22, 24, 21, -2, 23, 132, 47014 }, // Б
-    { 22, 25, 21, -2, 24, 138, 47146 }, // В
-    { 23, 23, 19, -2, 23, 133, 47284 }, // Г
-    { 28, 30, 25, -2, 23, 210, 47417 }, // Д
-    { 23, 23, 21, -2, 23, 133, 47627 }, // Е
-    { 37, 25, 32, -3, 24, 232, 47760 }, // Ж
-    { 19, 25, 19, -1, 24, 119, 47992 }, // З
-    { 30, 23, 27, -2, 23, 173, 48111 }, // И
-    { 30, 33, 27, -2, 33, 248, 48284 }, // Й
-    { 27, 25, 23, -2, 24, 169, 48532 }, // К
-    { 28, 24, 24, -2, 23, 168, 48701 }, // Л
-    { 33, 23, 30, -3, 23, 190, 48869 }, // М
-    { 30, 23, 26, -2, 23, 173, 49059 }, // Н
-    { 24, 25, 24, 0, 24, 150, 49232 }, // О
-    { 29, 23, 26, -2, 23, 167, 49382 }, // П
-    { 23, 24, 20, -2, 24, 138, 49549 }, // Р
-    { 21, 25, 22, 1, 24, 132, 49687 }, // С
-    { 22, 23, 22, 2, 23, 127, 49819 }, // Т
-    { 24, 24, 22, 1, 23, 144, 49946 }, // У
-    { 24, 25, 25, 0, 24, 150, 50090 }, // Ф
-    { 27, 23, 22, -3, 23, 156, 50240 }, // Х
-    { 29, 30, 26, -2, 23, 218, 50396 }, // Ц
-    { 23, 23, 24, 2, 23, 133, 50614 }, // Ч
-    { 37, 23, 33, -2, 23, 213, 50747 }, // Ш
-    { 37, 30, 34, -2, 23, 278, 50960 }, // Щ
-    { 21, 24, 24, 2, 23, 126, 51238 }, // Ъ
-    { 35, 24, 31, -2, 23, 210, 51364 }, // Ы
-    { 21, 24, 20, -2, 23, 126, 51574 }, // Ь
-    { 21, 25, 21, -1, 24, 132, 51700 }, // Э
-    { 36, 25, 34, -2, 24, 225, 51832 }, // Ю
-    { 26, 24, 22, -2, 23, 156, 52057 }, // Я
-    { 20, 19, 20, 0, 18, 95, 52213 }, // а
-    { 19, 28, 18, 1, 27, 133, 52308 }, // б
-    { 17, 19, 17, 0, 18, 81, 52441 }, // в
-    { 15, 19, 15, 0, 18, 72, 52522 }, // г
-    { 18, 27, 18, 0, 26, 122, 52594 }, // д
-    { 15, 19, 16, 0, 18, 72, 52716 }, // е
-    { 30, 19, 30, 0, 18, 143, 52788 }, // ж
-    { 16, 19, 15, -1, 18, 76, 52931 }, // з
-    { 20, 19, 20, 0, 18, 95, 53007 }, // и
-    { 20, 28, 20, 0, 27, 140, 53102 }, // й
-    { 18, 19, 19, 1, 18, 86, 53242 }, // к
-    { 21, 19, 21, -1, 18, 100, 53328 }, // л
-    { 27, 19, 26, -1, 18, 129, 53428 }, // м
-    { 19, 19, 21, 1, 18, 91, 53557 }, // н
-    { 17, 19, 18, 0, 18, 81, 53648 }, // о
-    { 19, 19, 20, 1, 18, 91, 53729 }, // п
-    { 21, 26, 19, -3, 18, 137, 53820 }, // р
-    { 15, 19, 15, 0, 18, 72, 53957 }, // с
-    { 27, 19, 29, 1, 18, 129, 54029 }, // т
-    { 22, 26, 17, -5, 18, 143, 54158 }, // у
-    { 23, 34, 24, 0, 26, 196, 54301 }, // ф
-    { 21, 19, 19, -1, 18, 100, 54497 }, // х
-    { 20, 25, 21, 0, 18, 125, 54597 }, // ц
-    { 18, 19, 20, 1, 18, 86, 54722 }, // ч
-    { 27, 19, 28, 0, 18, 129, 54808 }, // ш
-    { 28, 25, 28, 0, 18, 175, 54937 }, // щ
-    { 18, 19, 18, 0, 18, 86, 55112 }, // ъ
-    { 26, 19, 26, 0, 18, 124, 55198 }, // ы
-    { 16, 19, 17, 0, 18, 76, 55322 }, // ь
-    { 16, 19, 16, -1, 18, 76, 55398 }, // э
-    { 25, 19, 26, 1, 18, 119, 55474 }, // ю
-    { 19, 19, 20, 0, 18, 91, 55593 }, // я
-    { 15, 29, 16, 0, 28, 109, 55684 }, // ѐ
-    { 17, 27, 16, 0, 26, 115, 55793 }, // ё
-    { 18, 34, 19, 0, 26, 153, 55908 }, // ђ
-    { 16, 30, 15, 0, 29, 120, 56061 }, // ѓ
-    { 16, 19, 16, 0, 18, 76, 56181 }, // є
-    { 15, 19, 14, -1, 18, 72, 56257 }, // ѕ
-    { 10, 27, 11, 1, 26, 68, 56329 }, // і
-    { 13, 27, 11, 1, 26, 88, 56397 }, // ї
-    { 19, 34, 10, -7, 26, 162, 56485 }, // ј
-    { 27, 19, 26, -1, 18, 129, 56647 }, // љ
-    { 24, 19, 26, 1, 18, 114, 56776 }, // њ
-    { 19, 27, 20, 0, 26, 129, 56890 }, // ћ
-    { 18, 30, 19, 1, 29, 135, 57019 }, // ќ
-    { 20, 29, 20, 0, 28, 145, 57154 }, // ѝ
-    { 22, 35, 17, -5, 27, 193, 57299 }, // ў
-    { 20, 25, 20, 0, 18, 125, 57492 }, // џ
-    { 21, 27, 23, 2, 26, 142, 57617 }, // Ѣ
-    { 24, 19, 26, 1, 18, 114, 57759 }, // ѣ
-    { 24, 25, 24, 0, 24, 150, 57873 }, // Ѳ
-    { 17, 19, 18, 0, 18, 81, 58023 }, // ѳ
-    { 25, 25, 25, 2, 24, 157, 58104 }, // Ѵ
-    { 21, 19, 19, -1, 18, 100, 58261 }, // ѵ
-    { 30, 40, 27, -2, 33, 300, 58361 }, // Ҋ
-    { 20, 34, 20, 0, 27, 170, 58661 }, // ҋ
-    { 21, 24, 20, -2, 23, 126, 58831 }, // Ҍ
-    { 15, 25, 17, 1, 24, 94, 58957 }, // ҍ
-    { 23, 24, 20, -2, 24, 138, 59051 }, // Ҏ
-    { 21, 26, 19, -3, 18, 137, 59189 }, // ҏ
-    { 23, 28, 19, -2, 28, 161, 59326 }, // Ґ
-    { 17, 23, 16, 0, 22, 98, 59487 }, // ґ
-    { 23, 23, 19, -2, 23, 133, 59585 }, // Ғ
-    { 15, 19, 15, 0, 18, 72, 59718 }, // ғ
-    { 22, 30, 22, -2, 23, 165, 59790 }, // Ҕ
-    { 16, 26, 18, 1, 18, 104, 59955 }, // ҕ
-    { 37, 31, 32, -3, 24, 287, 60059 }, // Җ
-    { 30, 25, 30, 0, 18, 188, 60346 }, // җ
-    { 19, 31, 19, -1, 24, 148, 60534 }, // Ҙ
-    { 16, 25, 15, -1, 18, 100, 60682 }, // ҙ
-    { 27, 31, 23, -2, 24, 210, 60782 }, // Қ
-    { 18, 25, 19, 1, 18, 113, 60992 }, // қ
-    { 28, 25, 24, -2, 24, 175, 61105 }, // Ҝ
-    { 20, 19, 21, 1, 18, 95, 61280 }, // ҝ
-    { 27, 25, 23, -2, 24, 169, 61375 }, // Ҟ
-    { 18, 25, 18, 0, 24, 113, 61544 }, // ҟ
-    { 27, 25, 27, 2, 24, 169, 61657 }, // Ҡ
-    { 21, 19, 22, 0, 18, 100, 61826 }, // ҡ
-    { 30, 30, 27, -2, 23, 225, 61926 }, // Ң
-    { 20, 25, 21, 1, 18, 125, 62151 }, // ң
-    { 35, 23, 31, -2, 23, 202, 62276 }, // Ҥ
-    { 25, 19, 25, 1, 18, 119, 62478 }, // ҥ
-    { 34, 30, 34, -2, 23, 255, 62597 }, // Ҧ
-    { 26, 26, 28, 1, 18, 169, 62852 }, // ҧ
-    { 26, 25, 27, 1, 24, 163, 63021 }, // Ҩ
-    { 21, 19, 21, 0, 18, 100, 63184 }, // ҩ
-    { 21, 31, 22, 1, 24, 163, 63284 }, // Ҫ
-    { 15, 25, 15, 0, 18, 94, 63447 }, // ҫ
-    { 22, 30, 22, 2, 23, 165, 63541 }, // Ҭ
-    { 28, 25, 29, 1, 18, 175, 63706 }, // ҭ
-    { 23, 23, 22, 1, 23, 133, 63881 }, // Ү
-    { 17, 26, 17, 0, 18, 111, 64014 }, // ү
-    { 23, 23, 22, 1, 23, 133, 64125 }, // Ұ
-    { 17, 26, 17, 0, 18, 111, 64258 }, // ұ
-    { 27, 30, 22, -3, 23, 203, 64369 }, // Ҳ
-    { 21, 25, 19, -1, 18, 132, 64572 }, // ҳ
-    { 30, 30, 30, 2, 23, 225, 64704 }, // Ҵ
-    { 20, 31, 21, 0, 24, 155, 64929 }, // ҵ
-    { 23, 30, 24, 2, 23, 173, 65084 }, // Ҷ
-    { 19, 25, 20, 1, 18, 119, 65257 }, // ҷ
-    { 24, 23, 24, 2, 23, 138, 65376 }, // Ҹ
-    { 19, 19, 20, 1, 18, 91, 65514 }, // ҹ
-    { 24, 23, 24, -2, 23, 138, 65605 }, // Һ
-    { 19, 27, 20, 0, 26, 129, 65743 }, // һ
-    { 26, 25, 27, 1, 24, 163, 65872 }, // Ҽ
-    { 19, 19, 20, 0, 18, 91, 66035 }, // ҽ
-    { 26, 32, 27, 1, 24, 208, 66126 }, // Ҿ
-    { 19, 25, 20, 0, 18, 119, 66334 }, // ҿ
-    { 17, 23, 13, -2, 23, 98, 66453 }, // Ӏ
-    { 37, 34, 32, -3, 33, 315, 66551 }, // Ӂ
-    { 30, 28, 30, 0, 27, 210, 66866 }, // ӂ
-    { 27, 31, 24, -2, 24, 210, 67076 }, // Ӄ
-    { 18, 26, 19, 1, 18, 117, 67286 }, // ӄ
-    { 28, 30, 24, -2, 23, 210, 67403 }, // Ӆ
-    { 22, 25, 21, -1, 18, 138, 67613 }, // ӆ
-    { 30, 30, 26, -2, 23, 225, 67751 }, // Ӈ
-    { 18, 26, 19, 1, 18, 117, 67976 }, // ӈ
-    { 30, 30, 27, -2, 23, 225, 68093 }, // Ӊ
-    { 20, 25, 21, 1, 18, 125, 68318 }, // ӊ
-    { 23, 30, 24, 2, 23, 173, 68443 }, // Ӌ
-    { 18, 25, 19, 1, 18, 113, 68616 }, // ӌ
-    { 33, 30, 30, -3, 23, 248, 68729 }, // Ӎ
-    { 27, 25, 26, -1, 18, 169, 68977 }, // ӎ
-    { 17, 26, 13, -2, 26, 111, 69146 }, // ӏ
-    { 26, 33, 24, -2, 33, 215, 69257 }, // Ӑ
-    { 20, 28, 20, 0, 27, 140, 69472 }, // ӑ
-    { 26, 31, 24, -2, 31, 202, 69612 }, // Ӓ
-    { 20, 27, 20, 0, 26, 135, 69814 }, // ӓ
-    { 34, 23, 31, -3, 23, 196, 69949 }, // Ӕ
-    { 26, 19, 26, 0, 18, 124, 70145 }, // ӕ
-    { 23, 33, 21, -2, 33, 190, 70269 }, // Ӗ
-    { 17, 28, 16, 0, 27, 119, 70459 }, // ӗ
-    { 21, 25, 22, 0, 24, 132, 70578 }, // Ә
-    { 16, 19, 16, 0, 18, 76, 70710 }, // ә
-    { 21, 32, 22, 0, 31, 168, 70786 }, // Ӛ
-    { 16, 27, 16, 0, 26, 108, 70954 }, // ӛ
-    { 37, 32, 32, -3, 31, 296, 71062 }, // Ӝ
-    { 30, 27, 30, 0, 26, 203, 71358 }, // ӝ
-    { 19, 32, 19, -1, 31, 152, 71561 }, // Ӟ
-    { 17, 27, 15, -1, 26, 115, 71713 }, // ӟ
-    { 21, 24, 19, -1, 23, 126, 71828 }, // Ӡ
-    { 20, 26, 18, -2, 18, 130, 71954 }, // ӡ
-    { 30, 30, 27, -2, 30, 225, 72084 }, // Ӣ
-    { 20, 25, 20, 0, 24, 125, 72309 }, // ӣ
-    { 30, 31, 27, -2, 31, 233, 72434 }, // Ӥ
-    { 20, 27, 20, 0, 26, 135, 72667 }, // ӥ
-    { 24, 32, 24, 0, 31, 192, 72802 }, // Ӧ
-    { 18, 27, 18, 0, 26, 122, 72994 }, // ӧ
-    { 24, 25, 24, 0, 24, 150, 73116 }, // Ө
-    { 17, 19, 18, 0, 18, 81, 73266 }, // ө
-    { 24, 32, 24, 0, 31, 192, 73347 }, // Ӫ
-    { 18, 27, 18, 0, 26, 122, 73539 }, // ӫ
-    { 21, 32, 21, -1, 31, 168, 73661 }, // Ӭ
-    { 16, 27, 16, -1, 26, 108, 73829 }, // ӭ
-    { 24, 31, 22, 1, 30, 186, 73937 }, // Ӯ
-    { 22, 32, 17, -5, 24, 176, 74123 }, // ӯ
-    { 24, 32, 22, 1, 31, 192, 74299 }, // Ӱ
-    { 22, 34, 17, -5, 26, 187, 74491 }, // ӱ
-    { 24, 34, 22, 1, 33, 204, 74678 }, // Ӳ
-    { 22, 36, 17, -5, 28, 198, 74882 }, // ӳ
-    { 23, 31, 24, 2, 31, 179, 75080 }, // Ӵ
-    { 18, 27, 20, 1, 26, 122, 75259 }, // ӵ
-    { 23, 30, 19, -2, 23, 173, 75381 }, // Ӷ
-    { 15, 25, 15, 0, 18, 94, 75554 }, // ӷ
-    { 35, 32, 31, -2, 31, 280, 75648 }, // Ӹ
-    { 26, 27, 26, 0, 26, 176, 75928 }, // ӹ
-    { 23, 30, 19, -2, 23, 173, 76104 }, // Ӻ
-    { 15, 25, 15, 0, 18, 94, 76277 }, // ӻ
-    { 27, 30, 22, -3, 23, 203, 76371 }, // Ӽ
-    { 21, 26, 19, -1, 18, 137, 76574 }, // ӽ
-    { 27, 23, 22, -3, 23, 156, 76711 }, // Ӿ
-    { 21, 19, 19, -1, 18, 100, 76867 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 76967 }, //  
-    { 0, 0, 33, 0, 0, 0, 76967 }, //  
-    { 0, 0, 17, 0, 0, 0, 76967 }, //  
-    { 0, 0, 33, 0, 0, 0, 76967 }, //  
-    { 0, 0, 11, 0, 0, 0, 76967 }, //  
-    { 0, 0, 8, 0, 0, 0, 76967 }, //  
-    { 0, 0, 5, 0, 0, 0, 76967 }, //  
-    { 0, 0, 21, 0, 0, 0, 76967 }, //  
-    { 0, 0, 10, 0, 0, 0, 76967 }, //  
-    { 0, 0, 7, 0, 0, 0, 76967 }, //  
-    { 0, 0, 2, 0, 0, 0, 76967 }, //  
-    { 0, 0, 0, 0, 0, 0, 76967 }, // ​
-    { 2, 28, 0, -1, 20, 14, 76967 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 76981 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 77041 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 77134 }, // ‏
-    { 11, 5, 13, 1, 11, 14, 77227 }, // ‐
-    { 11, 5, 13, 1, 11, 14, 77241 }, // ‑
-    { 17, 4, 21, 2, 13, 17, 77255 }, // ‒
-    { 17, 5, 17, 0, 11, 22, 77272 }, // –
-    { 33, 5, 33, 0, 11, 42, 77294 }, // —
-    { 33, 5, 33, 0, 11, 42, 77336 }, // ―
-    { 12, 34, 17, 2, 26, 102, 77378 }, // ‖
-    { 17, 9, 17, 0, -1, 39, 77480 }, // ‗
-    { 8, 11, 10, 2, 25, 22, 77519 }, // ‘
-    { 8, 11, 10, 2, 25, 22, 77541 }, // ’
-    { 8, 11, 10, 0, 5, 22, 77563 }, // ‚
-    { 8, 12, 10, 1, 25, 24, 77585 }, // ‛
-    { 15, 11, 17, 2, 25, 42, 77609 }, // “
-    { 15, 12, 17, 2, 25, 45, 77651 }, // ”
-    { 14, 11, 17, 0, 5, 39, 77696 }, // „
-    { 15, 12, 17, 1, 25, 45, 77735 }, // ‟
-    { 15, 22, 15, 1, 24, 83, 77780 }, // †
-    { 17, 26, 15, -1, 24, 111, 77863 }, // ‡
-    { 8, 8, 10, 1, 13, 16, 77974 }, // •
-    { 12, 12, 21, 4, 17, 36, 77990 }, // ‣
-    { 7, 6, 10, 1, 5, 11, 78026 }, // ․
-    { 15, 6, 17, 1, 5, 23, 78037 }, // ‥
-    { 29, 6, 33, 2, 5, 44, 78060 }, // …
-    { 7, 6, 10, 1, 12, 11, 78104 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 78115 }, //  
-    { 0, 0, 0, 0, 0, 0, 78115 }, //  
-    { 12, 31, 0, -6, 23, 93, 78115 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 78208 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 78301 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 78379 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 78488 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 78597 }, //  
-    { 44, 28, 46, 1, 25, 308, 78597 }, // ‰
-    { 8, 11, 8, 0, 23, 22, 78905 }, // ′
-    { 15, 11, 15, 0, 23, 42, 78927 }, // ″
-    { 23, 11, 23, 0, 23, 64, 78969 }, // ‴
-    { 8, 11, 8, 0, 23, 22, 79033 }, // ‵
-    { 15, 11, 16, 0, 23, 42, 79055 }, // ‶
-    { 22, 11, 23, 0, 23, 61, 79097 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 79158 }, // ‸
-    { 10, 13, 12, 1, 15, 33, 79183 }, // ‹
-    { 11, 13, 12, 0, 15, 36, 79216 }, // ›
-    { 21, 23, 21, 0, 22, 121, 79252 }, // ※
-    { 20, 26, 20, 1, 25, 130, 79373 }, // ‼
-    { 17, 4, 17, 0, 28, 17, 79503 }, // ‾
-    { 8, 5, 10, 1, 11, 10, 79520 }, // ⁃
-    { 21, 28, 9, -6, 25, 147, 79530 }, // ⁄
-    { 24, 25, 26, 2, 24, 150, 79677 }, // ⁇
-    { 22, 26, 23, 2, 25, 143, 79827 }, // ⁈
-    { 22, 26, 23, 1, 25, 143, 79970 }, // ⁉
-    { 20, 7, 33, 6, 13, 35, 80113 }, // ⁓
-    { 30, 11, 30, 0, 23, 83, 80148 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 80231 }, //  
-    { 0, 0, 0, 0, 0, 0, 80231 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 80231 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 80231 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 80231 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 80231 }, // ⁤
-    { 14, 17, 15, 0, 28, 60, 80231 }, // ⁰
-    { 14, 16, 15, 0, 28, 56, 80291 }, // ⁴
-    { 13, 16, 15, 1, 27, 52, 80347 }, // ⁵
-    { 14, 17, 15, 1, 28, 60, 80399 }, // ⁶
-    { 13, 16, 15, 2, 27, 52, 80459 }, // ⁷
-    { 13, 17, 15, 1, 28, 56, 80511 }, // ⁸
-    { 14, 17, 15, 0, 28, 60, 80567 }, // ⁹
-    { 13, 13, 19, 3, 24, 43, 80627 }, // ⁿ
-    { 14, 16, 15, 0, 11, 56, 80670 }, // ₀
-    { 11, 16, 15, 1, 11, 44, 80726 }, // ₁
-    { 14, 16, 15, 0, 11, 56, 80770 }, // ₂
-    { 12, 16, 15, 1, 11, 48, 80826 }, // ₃
-    { 14, 16, 15, 0, 11, 56, 80874 }, // ₄
-    { 13, 16, 15, 1, 11, 52, 80930 }, // ₅
-    { 14, 16, 15, 1, 11, 56, 80982 }, // ₆
-    { 13, 16, 15, 2, 11, 52, 81038 }, // ₇
-    { 13, 16, 15, 1, 11, 52, 81090 }, // ₈
-    { 14, 16, 15, 0, 11, 56, 81142 }, // ₉
-    { 22, 23, 21, -1, 23, 127, 81198 }, // ₣
-    { 22, 24, 21, -1, 23, 132, 81325 }, // ₤
-    { 43, 24, 44, 0, 23, 258, 81457 }, // ₧
-    { 23, 24, 21, -1, 23, 138, 81715 }, // €
-    { 21, 15, 33, 6, 19, 79, 81853 }, // ←
-    { 15, 21, 33, 9, 22, 79, 81932 }, // ↑
-    { 21, 15, 33, 6, 19, 79, 82011 }, // →
-    { 15, 21, 33, 9, 22, 79, 82090 }, // ↓
-    { 21, 15, 33, 6, 19, 79, 82169 }, // ↔
-    { 15, 23, 33, 9, 23, 87, 82248 }, // ↕
-    { 15, 23, 33, 9, 23, 87, 82335 }, // ↨
-    { 15, 23, 33, 9, 23, 87, 82422 }, // ↲
-    { 15, 23, 33, 9, 23, 87, 82509 }, // ↳
-    { 19, 18, 33, 7, 20, 86, 82596 }, // ↵
-    { 21, 19, 33, 6, 21, 100, 82682 }, // ⇐
-    { 19, 21, 33, 7, 22, 100, 82782 }, // ⇑
-    { 21, 19, 33, 6, 21, 100, 82882 }, // ⇒
-    { 19, 21, 33, 7, 22, 100, 82982 }, // ⇓
-    { 21, 17, 33, 6, 20, 90, 83082 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 83172 }, // ∀
-    { 18, 27, 21, 1, 26, 122, 83310 }, // ∂
-    { 17, 23, 33, 8, 23, 98, 83432 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 83530 }, // ∅
-    { 22, 24, 23, 0, 24, 132, 83699 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 83831 }, // ∇
-    { 23, 23, 33, 5, 23, 133, 83957 }, // ∈
-    { 23, 29, 33, 5, 26, 167, 84090 }, // ∉
-    { 23, 20, 33, 5, 21, 115, 84257 }, // ∊
-    { 23, 23, 33, 5, 23, 133, 84372 }, // ∋
-    { 23, 29, 33, 5, 26, 167, 84505 }, // ∌
-    { 23, 20, 33, 5, 21, 115, 84672 }, // ∍
-    { 26, 29, 28, 1, 23, 189, 84787 }, // ∏
-    { 21, 29, 22, 1, 23, 153, 84976 }, // ∑
-    { 15, 4, 21, 3, 13, 15, 85129 }, // −
-    { 21, 26, 17, -2, 24, 137, 85144 }, // ∕
-    { 16, 26, 17, 1, 24, 104, 85281 }, // ∖
-    { 16, 16, 21, 2, 19, 64, 85385 }, // ∗
-    { 13, 12, 21, 4, 17, 39, 85449 }, // ∘
-    { 7, 6, 21, 7, 12, 11, 85488 }, // ∙
-    { 22, 31, 21, -1, 27, 171, 85499 }, // √
-    { 17, 13, 21, 2, 17, 56, 85670 }, // ∝
-    { 21, 13, 21, 0, 17, 69, 85726 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 85795 }, // ∟
-    { 25, 23, 33, 4, 23, 144, 85916 }, // ∠
-    { 5, 34, 17, 6, 26, 43, 86060 }, // ∣
-    { 12, 34, 17, 2, 26, 102, 86103 }, // ∥
-    { 23, 23, 33, 5, 23, 133, 86205 }, // ∧
-    { 23, 23, 33, 5, 23, 133, 86338 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 86471 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 86585 }, // ∪
-    { 19, 34, 21, 1, 26, 162, 86699 }, // ∫
-    { 23, 20, 33, 5, 19, 115, 86861 }, // ∴
-    { 23, 20, 33, 5, 19, 115, 86976 }, // ∵
-    { 8, 18, 10, 1, 20, 36, 87091 }, // ∶
-    { 23, 20, 33, 5, 19, 115, 87127 }, // ∷
-    { 20, 7, 33, 6, 13, 35, 87242 }, // ∼
-    { 20, 18, 33, 6, 20, 90, 87277 }, // ≅
-    { 17, 14, 21, 2, 18, 60, 87367 }, // ≈
-    { 19, 13, 33, 7, 16, 62, 87427 }, // ≍
-    { 15, 16, 21, 3, 19, 60, 87489 }, // ≠
-    { 19, 16, 33, 7, 18, 76, 87549 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 87625 }, // ≤
-    { 15, 21, 21, 3, 21, 79, 87700 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 87779 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 87887 }, // ≫
-    { 23, 20, 33, 5, 21, 115, 87995 }, // ⊃
-    { 23, 29, 33, 5, 26, 167, 88110 }, // ⊄
-    { 23, 29, 33, 5, 26, 167, 88277 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 88444 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 88565 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 88686 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 88843 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 89000 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 89157 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 89314 }, // ⊥
-    { 7, 6, 21, 7, 12, 11, 89424 }, // ⋅
-    { 29, 6, 33, 2, 12, 44, 89435 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 89479 }, // �
+    { 20, 24, 21, 1, 23, 120, 2048 }, // 6
+    { 19, 24, 21, 3, 23, 114, 2168 }, // 7
+    { 19, 24, 21, 1, 23, 114, 2282 }, // 8
+    { 21, 24, 21, -1, 23, 126, 2396 }, // 9
+    { 9, 19, 10, 1, 18, 43, 2522 }, // :
+    { 12, 24, 10, -2, 18, 72, 2565 }, // ;
+    { 15, 16, 21, 3, 19, 60, 2637 }, // <
+    { 15, 10, 21, 3, 16, 38, 2697 }, // =
+    { 15, 16, 21, 3, 19, 60, 2735 }, // >
+    { 12, 25, 13, 2, 24, 75, 2795 }, // ?
+    { 31, 30, 33, 1, 23, 233, 2870 }, // @
+    { 26, 24, 24, -2, 24, 156, 3103 }, // A
+    { 22, 25, 21, -2, 24, 138, 3259 }, // B
+    { 21, 25, 22, 1, 24, 132, 3397 }, // C
+    { 26, 25, 24, -2, 24, 163, 3529 }, // D
+    { 23, 23, 21, -2, 23, 133, 3692 }, // E
+    { 22, 23, 19, -2, 23, 127, 3825 }, // F
+    { 22, 25, 24, 1, 24, 138, 3952 }, // G
+    { 30, 23, 26, -2, 23, 173, 4096 }, // H
+    { 17, 23, 13, -2, 23, 98, 4269 }, // I
+    { 21, 30, 13, -6, 23, 158, 4367 }, // J
+    { 27, 24, 24, -2, 23, 162, 4525 }, // K
+    { 20, 23, 19, -2, 23, 115, 4687 }, // L
+    { 33, 23, 30, -3, 23, 190, 4802 }, // M
+    { 29, 24, 26, -1, 23, 174, 4992 }, // N
+    { 24, 25, 24, 0, 24, 150, 5166 }, // O
+    { 23, 24, 20, -2, 24, 138, 5316 }, // P
+    { 28, 32, 25, 0, 24, 224, 5454 }, // Q
+    { 24, 25, 22, -2, 24, 150, 5678 }, // R
+    { 19, 25, 18, -1, 24, 119, 5828 }, // S
+    { 22, 23, 22, 2, 23, 127, 5947 }, // T
+    { 26, 24, 26, 2, 23, 156, 6144 }, // U
+    { 25, 24, 24, 2, 23, 150, 6300 }, // V
+    { 33, 24, 33, 2, 23, 198, 6450 }, // W
+    { 27, 23, 22, -3, 23, 156, 6648 }, // X
+    { 23, 23, 22, 1, 23, 133, 6804 }, // Y
+    { 21, 24, 20, -1, 23, 126, 6937 }, // Z
+    { 15, 32, 11, -2, 26, 120, 7063 }, // [
+    { 15, 26, 17, 1, 24, 98, 7183 }, // <backslash>
+    { 15, 32, 11, -2, 26, 120, 7281 }, // ]
+    { 17, 17, 21, 2, 22, 73, 7401 }, // ^
+    { 17, 4, 17, 0, -1, 17, 7474 }, // _
+    { 7, 9, 20, 7, 28, 16, 7491 }, // `
+    { 20, 19, 20, 0, 18, 95, 7507 }, // a
+    { 18, 27, 18, 0, 26, 122, 7602 }, // b
+    { 15, 19, 15, 0, 18, 72, 7724 }, // c
+    { 20, 27, 20, 0, 26, 135, 7796 }, // d
+    { 15, 19, 16, 0, 18, 72, 7931 }, // e
+    { 24, 34, 14, -6, 26, 204, 8192 }, // f
+    { 23, 26, 17, -3, 18, 150, 8396 }, // g
+    { 19, 27, 20, 0, 26, 129, 8546 }, // h
+    { 10, 27, 11, 1, 26, 68, 8675 }, // i
+    { 19, 34, 10, -7, 26, 162, 8743 }, // j
+    { 17, 27, 18, 0, 26, 115, 8905 }, // k
+    { 10, 27, 11, 1, 26, 68, 9020 }, // l
+    { 27, 19, 29, 1, 18, 129, 9088 }, // m
+    { 19, 19, 20, 1, 18, 91, 9217 }, // n
+    { 17, 19, 18, 0, 18, 81, 9308 }, // o
+    { 21, 26, 19, -3, 18, 137, 9389 }, // p
+    { 19, 26, 19, 0, 18, 124, 9526 }, // q
+    { 16, 18, 16, 1, 18, 72, 9650 }, // r
+    { 15, 19, 14, -1, 18, 72, 9722 }, // s
+    { 15, 23, 14, 0, 22, 87, 9794 }, // t
+    { 20, 19, 20, 0, 18, 95, 9881 }, // u
+    { 17, 19, 17, 0, 18, 81, 9976 }, // v
+    { 25, 19, 25, 0, 18, 119, 10057 }, // w
+    { 21, 19, 19, -1, 18, 100, 10240 }, // x
+    { 22, 26, 17, -5, 18, 143, 10340 }, // y
+    { 17, 19, 16, -1, 18, 81, 10483 }, // z
+    { 15, 33, 14, 1, 27, 124, 10564 }, // {
+    { 11, 30, 10, -1, 26, 83, 10688 }, // |
+    { 15, 33, 14, -2, 27, 124, 10771 }, // }
+    { 17, 8, 21, 2, 15, 34, 10895 }, // ~
+    { 0, 0, 7, 0, 0, 0, 10929 }, //  
+    { 11, 26, 11, -1, 18, 72, 10929 }, // ¡
+    { 17, 33, 21, 2, 26, 141, 11001 }, // ¢
+    { 22, 24, 21, -1, 23, 132, 11142 }, // £
+    { 21, 16, 21, 0, 19, 84, 11274 }, // ¤
+    { 23, 23, 21, 1, 23, 133, 11358 }, // ¥
+    { 11, 30, 10, -1, 26, 83, 11491 }, // ¦
+    { 17, 26, 17, -1, 23, 111, 11574 }, // §
+    { 12, 6, 20, 4, 26, 18, 11685 }, // ¨
+    { 25, 25, 26, 0, 24, 157, 11703 }, // ©
+    { 14, 17, 15, 1, 24, 60, 11860 }, // ª
+    { 19, 13, 20, 1, 15, 62, 11920 }, // «
+    { 15, 9, 21, 3, 16, 34, 11982 }, // ¬
+    { 11, 5, 13, 1, 11, 14, 12016 }, // ­
+    { 19, 18, 19, 0, 26, 86, 12030 }, // ®
+    { 12, 4, 20, 4, 24, 12, 12116 }, // ¯
+    { 13, 12, 17, 2, 23, 39, 12128 }, // °
+    { 15, 21, 21, 3, 20, 79, 12167 }, // ±
+    { 14, 16, 15, 0, 28, 56, 12288 }, // ²
+    { 12, 17, 15, 1, 28, 51, 12344 }, // ³
+    { 7, 10, 20, 7, 29, 18, 12395 }, // ´
+    { 22, 26, 20, -2, 18, 143, 12413 }, // µ
+    { 22, 28, 20, -1, 23, 154, 12556 }, // ¶
+    { 6, 6, 10, 2, 12, 9, 12710 }, // ·
+    { 8, 8, 20, 6, -1, 16, 12719 }, // ¸
+    { 11, 16, 15, 1, 28, 44, 12735 }, // ¹
+    { 13, 17, 15, 1, 24, 56, 12779 }, // º
+    { 19, 13, 20, 0, 15, 62, 12835 }, // »
+    { 34, 28, 36, 1, 25, 238, 12897 }, // ¼
+    { 34, 28, 36, 1, 25, 238, 13135 }, // ½
+    { 34, 28, 36, 1, 25, 238, 13373 }, // ¾
+    { 11, 25, 13, 0, 18, 69, 13611 }, // ¿
+    { 26, 33, 24, -2, 33, 215, 13680 }, // À
+    { 26, 33, 24, -2, 33, 215, 13895 }, // Á
+    { 26, 32, 24, -2, 32, 208, 14110 }, // Â
+    { 26, 32, 24, -2, 32, 208, 14336 }, // Ã
+    { 26, 31, 24, -2, 31, 202, 14544 }, // Ä
+    { 26, 33, 24, -2, 33, 215, 14746 }, // Å
+    { 34, 23, 31, -3, 23, 196, 14961 }, // Æ
+    { 21, 33, 22, 1, 24, 174, 15157 }, // Ç
+    { 23, 33, 21, -2, 33, 190, 15331 }, // È
+    { 23, 33, 21, -2, 33, 190, 15521 }, // É
+    { 23, 32, 21, -2, 32, 184, 15711 }, // Ê
+    { 23, 31, 21, -2, 31, 179, 15895 }, // Ë
+    { 17, 33, 13, -2, 33, 141, 16074 }, // Ì
+    { 17, 33, 13, -2, 33, 141, 16215 }, // Í
+    { 18, 32, 13, -2, 32, 144, 16384 }, // Î
+    { 18, 31, 13, -2, 31, 140, 16528 }, // Ï
+    { 26, 25, 24, -2, 24, 163, 16668 }, // Ð
+    { 29, 33, 26, -1, 32, 240, 16831 }, // Ñ
+    { 24, 34, 24, 0, 33, 204, 17071 }, // Ò
+    { 24, 34, 24, 0, 33, 204, 17275 }, // Ó
+    { 24, 33, 24, 0, 32, 198, 17479 }, // Ô
+    { 24, 33, 24, 0, 32, 198, 17677 }, // Õ
+    { 24, 32, 24, 0, 31, 192, 17875 }, // Ö
+    { 15, 15, 21, 3, 19, 57, 18067 }, // ×
+    { 27, 25, 24, -1, 24, 169, 18124 }, // Ø
+    { 26, 34, 26, 2, 33, 221, 18432 }, // Ù
+    { 26, 34, 26, 2, 33, 221, 18653 }, // Ú
+    { 26, 33, 26, 2, 32, 215, 18874 }, // Û
+    { 26, 32, 26, 2, 31, 208, 19089 }, // Ü
+    { 23, 33, 22, 1, 33, 190, 19297 }, // Ý
+    { 22, 23, 20, -2, 23, 127, 19487 }, // Þ
+    { 27, 34, 21, -6, 26, 230, 19614 }, // ß
+    { 20, 29, 20, 0, 28, 145, 19844 }, // à
+    { 20, 30, 20, 0, 29, 150, 19989 }, // á
+    { 20, 29, 20, 0, 28, 145, 20139 }, // â
+    { 20, 27, 20, 0, 26, 135, 20284 }, // ã
+    { 20, 27, 20, 0, 26, 135, 20480 }, // ä
+    { 20, 29, 20, 0, 28, 145, 20615 }, // å
+    { 26, 19, 26, 0, 18, 124, 20760 }, // æ
+    { 15, 27, 15, 0, 18, 102, 20884 }, // ç
+    { 15, 29, 16, 0, 28, 109, 20986 }, // è
+    { 17, 30, 16, 0, 29, 128, 21095 }, // é
+    { 16, 29, 16, 0, 28, 116, 21223 }, // ê
+    { 17, 27, 16, 0, 26, 115, 21339 }, // ë
+    { 9, 29, 11, 1, 28, 66, 21454 }, // ì
+    { 13, 30, 11, 1, 29, 98, 21520 }, // í
+    { 12, 29, 11, 1, 28, 87, 21618 }, // î
+    { 13, 27, 11, 1, 26, 88, 21705 }, // ï
+    { 18, 28, 18, 0, 27, 126, 21793 }, // ð
+    { 19, 27, 20, 1, 26, 129, 21919 }, // ñ
+    { 17, 29, 18, 0, 28, 124, 22048 }, // ò
+    { 18, 30, 18, 0, 29, 135, 22172 }, // ó
+    { 18, 29, 18, 0, 28, 131, 22307 }, // ô
+    { 18, 27, 18, 0, 26, 122, 22528 }, // õ
+    { 18, 27, 18, 0, 26, 122, 22650 }, // ö
+    { 15, 16, 21, 3, 19, 60, 22772 }, // ÷
+    { 22, 19, 18, -2, 18, 105, 22832 }, // ø
+    { 20, 29, 20, 0, 28, 145, 22937 }, // ù
+    { 20, 30, 20, 0, 29, 150, 23082 }, // ú
+    { 20, 29, 20, 0, 28, 145, 23232 }, // û
+    { 20, 27, 20, 0, 26, 135, 23377 }, // ü
+    { 22, 37, 17, -5, 29, 204, 23512 }, // ý
+    { 22, 34, 18, -4, 26, 187, 23716 }, // þ
+    { 22, 34, 17, -5, 26, 187, 23903 }, // ÿ
+    { 26, 30, 24, -2, 30, 195, 24090 }, // Ā
+    { 20, 25, 20, 0, 24, 125, 24285 }, // ā
+    { 26, 32, 24, -2, 32, 208, 24576 }, // Ă
+    { 20, 27, 20, 0, 26, 135, 24784 }, // ă
+    { 26, 31, 24, -2, 24, 202, 24919 }, // Ą
+    { 20, 25, 20, 0, 18, 125, 25121 }, // ą
+    { 21, 34, 22, 1, 33, 179, 25246 }, // Ć
+    { 17, 30, 15, 0, 29, 128, 25425 }, // ć
+    { 21, 33, 22, 1, 32, 174, 25553 }, // Ĉ
+    { 16, 29, 15, 0, 28, 116, 25727 }, // ĉ
+    { 21, 33, 22, 1, 32, 174, 25843 }, // Ċ
+    { 15, 27, 15, 0, 26, 102, 26017 }, // ċ
+    { 21, 33, 22, 1, 32, 174, 26119 }, // Č
+    { 18, 29, 15, 0, 28, 131, 26293 }, // č
+    { 26, 33, 24, -2, 32, 215, 26624 }, // Ď
+    { 25, 27, 20, 0, 26, 169, 26839 }, // ď
+    { 26, 25, 24, -2, 24, 163, 27008 }, // Đ
+    { 22, 27, 20, 0, 26, 149, 27171 }, // đ
+    { 23, 30, 21, -2, 30, 173, 27320 }, // Ē
+    { 17, 25, 16, 0, 24, 107, 27493 }, // ē
+    { 23, 32, 21, -2, 32, 184, 27600 }, // Ĕ
+    { 17, 27, 16, 0, 26, 115, 27784 }, // ĕ
+    { 23, 32, 21, -2, 32, 184, 27899 }, // Ė
+    { 15, 27, 16, 0, 26, 102, 28083 }, // ė
+    { 23, 30, 21, -2, 23, 173, 28185 }, // Ę
+    { 15, 25, 16, 0, 18, 94, 28358 }, // ę
+    { 23, 32, 21, -2, 32, 184, 28452 }, // Ě
+    { 18, 29, 16, 0, 28, 131, 28672 }, // ě
+    { 22, 33, 24, 1, 32, 182, 28803 }, // Ĝ
+    { 23, 36, 17, -3, 28, 207, 28985 }, // ĝ
+    { 22, 33, 24, 1, 32, 182, 29192 }, // Ğ
+    { 23, 34, 17, -3, 26, 196, 29374 }, // ğ
+    { 22, 33, 24, 1, 32, 182, 29570 }, // Ġ
+    { 23, 34, 17, -3, 26, 196, 29752 }, // ġ
+    { 22, 33, 24, 1, 24, 182, 29948 }, // Ģ
+    { 23, 37, 17, -3, 29, 213, 30130 }, // ģ
+    { 30, 32, 26, -2, 32, 240, 30343 }, // Ĥ
+    { 19, 35, 20, 0, 34, 167, 30720 }, // ĥ
+    { 30, 23, 26, -2, 23, 173, 30887 }, // Ħ
+    { 19, 27, 20, 0, 26, 129, 31060 }, // ħ
+    { 18, 32, 13, -2, 32, 144, 31189 }, // Ĩ
+    { 13, 27, 11, 1, 26, 88, 31333 }, // ĩ
+    { 18, 30, 13, -2, 30, 135, 31421 }, // Ī
+    { 13, 25, 11, 1, 24, 82, 31556 }, // ī
+    { 17, 32, 13, -2, 32, 136, 31638 }, // Ĭ
+    { 13, 27, 11, 1, 26, 88, 31774 }, // ĭ
+    { 17, 30, 13, -2, 23, 128, 31862 }, // Į
+    { 10, 33, 11, 1, 26, 83, 31990 }, // į
+    { 17, 32, 13, -2, 32, 136, 32073 }, // İ
+    { 9, 19, 11, 1, 18, 43, 32209 }, // ı
+    { 30, 30, 26, -2, 23, 225, 32252 }, // Ĳ
+    { 22, 34, 21, 1, 26, 187, 32477 }, // ĳ
+    { 22, 39, 13, -6, 32, 215, 32768 }, // Ĵ
+    { 21, 36, 10, -7, 28, 189, 32983 }, // ĵ
+    { 27, 32, 24, -2, 23, 216, 33172 }, // Ķ
+    { 17, 35, 18, 0, 26, 149, 33388 }, // ķ
+    { 18, 19, 19, 1, 18, 86, 33537 }, // ĸ
+    { 20, 33, 19, -2, 33, 165, 33623 }, // Ĺ
+    { 12, 35, 11, 1, 34, 105, 33788 }, // ĺ
+    { 20, 32, 19, -2, 23, 160, 33893 }, // Ļ
+    { 12, 35, 11, -1, 26, 105, 34053 }, // ļ
+    { 22, 26, 19, -2, 26, 143, 34158 }, // Ľ
+    { 15, 27, 12, 1, 26, 102, 34301 }, // ľ
+    { 21, 23, 19, -2, 23, 121, 34403 }, // Ŀ
+    { 14, 27, 14, 1, 26, 95, 34524 }, // ŀ
+    { 20, 23, 19, -2, 23, 115, 34619 }, // Ł
+    { 13, 27, 10, -1, 26, 88, 34816 }, // ł
+    { 29, 34, 26, -1, 33, 247, 34904 }, // Ń
+    { 19, 30, 20, 1, 29, 143, 35151 }, // ń
+    { 29, 32, 26, -1, 23, 232, 35294 }, // Ņ
+    { 19, 27, 20, 1, 18, 129, 35526 }, // ņ
+    { 29, 33, 26, -1, 32, 240, 35655 }, // Ň
+    { 19, 29, 20, 1, 28, 138, 35895 }, // ň
+    { 25, 26, 27, 2, 25, 163, 36033 }, // ŉ
+    { 29, 30, 26, -1, 23, 218, 36196 }, // Ŋ
+    { 18, 26, 19, 1, 18, 117, 36414 }, // ŋ
+    { 24, 31, 24, 0, 30, 186, 36531 }, // Ō
+    { 18, 25, 18, 0, 24, 113, 36717 }, // ō
+    { 24, 33, 24, 0, 32, 198, 36864 }, // Ŏ
+    { 18, 27, 18, 0, 26, 122, 37062 }, // ŏ
+    { 25, 34, 24, 0, 33, 213, 37184 }, // Ő
+    { 20, 29, 18, 0, 28, 145, 37397 }, // ő
+    { 33, 25, 33, 0, 24, 207, 37542 }, // Œ
+    { 27, 19, 27, 0, 18, 129, 37749 }, // œ
+    { 24, 34, 22, -2, 33, 204, 37878 }, // Ŕ
+    { 16, 29, 16, 1, 29, 116, 38082 }, // ŕ
+    { 24, 33, 22, -2, 24, 198, 38198 }, // Ŗ
+    { 18, 27, 16, -1, 18, 122, 38396 }, // ŗ
+    { 24, 33, 22, -2, 32, 198, 38518 }, // Ř
+    { 17, 28, 16, 1, 28, 119, 38716 }, // ř
+    { 19, 34, 18, -1, 33, 162, 38912 }, // Ś
+    { 17, 30, 14, -1, 29, 128, 39074 }, // ś
+    { 19, 33, 18, -1, 32, 157, 39202 }, // Ŝ
+    { 16, 29, 14, -1, 28, 116, 39359 }, // ŝ
+    { 19, 33, 18, -1, 24, 157, 39475 }, // Ş
+    { 15, 27, 14, -1, 18, 102, 39632 }, // ş
+    { 20, 33, 18, -1, 32, 165, 39734 }, // Š
+    { 18, 29, 14, -1, 28, 131, 39899 }, // š
+    { 22, 32, 22, 2, 23, 176, 40030 }, // Ţ
+    { 15, 31, 14, 0, 22, 117, 40206 }, // ţ
+    { 22, 32, 22, 2, 32, 176, 40323 }, // Ť
+    { 17, 28, 14, 0, 27, 119, 40499 }, // ť
+    { 22, 23, 22, 2, 23, 127, 40618 }, // Ŧ
+    { 15, 23, 14, 0, 22, 87, 40745 }, // ŧ
+    { 26, 33, 26, 2, 32, 215, 40960 }, // Ũ
+    { 20, 27, 20, 0, 26, 135, 41175 }, // ũ
+    { 26, 31, 26, 2, 30, 202, 41310 }, // Ū
+    { 20, 25, 20, 0, 24, 125, 41512 }, // ū
+    { 26, 33, 26, 2, 32, 215, 41637 }, // Ŭ
+    { 20, 27, 20, 0, 26, 135, 41852 }, // ŭ
+    { 26, 34, 26, 2, 33, 221, 41987 }, // Ů
+    { 20, 29, 20, 0, 28, 145, 42208 }, // ů
+    { 26, 34, 26, 2, 33, 221, 42353 }, // Ű
+    { 20, 29, 20, 0, 28, 145, 42574 }, // ű
+    { 26, 30, 26, 2, 23, 195, 42719 }, // Ų
+    { 20, 25, 20, 0, 18, 125, 43008 }, // ų
+    { 33, 33, 33, 2, 32, 273, 43133 }, // Ŵ
+    { 25, 29, 25, 0, 28, 182, 43406 }, // ŵ
+    { 23, 32, 22, 1, 32, 184, 43588 }, // Ŷ
+    { 22, 36, 17, -5, 28, 198, 43772 }, // ŷ
+    { 23, 31, 22, 1, 31, 179, 43970 }, // Ÿ
+    { 21, 34, 20, -1, 33, 179, 44149 }, // Ź
+    { 17, 30, 16, -1, 29, 128, 44328 }, // ź
+    { 21, 33, 20, -1, 32, 174, 44456 }, // Ż
+    { 17, 27, 16, -1, 26, 115, 44630 }, // ż
+    { 21, 33, 20, -1, 32, 174, 44745 }, // Ž
+    { 17, 29, 16, -1, 28, 124, 44919 }, // ž
+    { 24, 34, 14, -6, 26, 204, 45056 }, // ſ
+    { 7, 9, 0, -5, 28, 16, 45260 }, // ̀
+    { 7, 10, 0, -2, 29, 18, 45276 }, // ́
+    { 12, 9, 0, -7, 28, 27, 45294 }, // ̂
+    { 12, 6, 0, -6, 26, 18, 45321 }, // ̃
+    { 12, 4, 0, -6, 24, 12, 45339 }, // ̄
+    { 12, 6, 0, -6, 26, 18, 45351 }, // ̆
+    { 6, 6, 0, -3, 26, 9, 45369 }, // ̇
+    { 12, 6, 0, -6, 26, 18, 45378 }, // ̈
+    { 9, 10, 0, -4, 29, 23, 45396 }, // ̉
+    { 10, 9, 0, -5, 28, 23, 45419 }, // ̊
+    { 13, 9, 0, -6, 28, 30, 45442 }, // ̋
+    { 12, 8, 0, -5, 28, 24, 45472 }, // ̌
+    { 11, 9, 0, -7, 28, 25, 45496 }, // ̏
+    { 11, 7, 0, -6, 26, 20, 45521 }, // ̑
+    { 7, 10, 0, -3, 29, 18, 45541 }, // ̒
+    { 7, 9, 0, -3, 29, 16, 45559 }, // ̓
+    { 6, 9, 0, -4, 29, 14, 45575 }, // ̔
+    { 6, 9, 0, -3, 29, 14, 45589 }, // ̕
+    { 6, 8, 0, -3, 21, 12, 45603 }, // ̛
+    { 6, 6, 0, -3, -2, 9, 45615 }, // ̣
+    { 12, 5, 0, -6, -3, 15, 45624 }, // ̤
+    { 8, 8, 0, -4, -1, 16, 45639 }, // ̥
+    { 7, 8, 0, -4, -1, 14, 45655 }, // ̦
+    { 8, 8, 0, -4, -1, 16, 45669 }, // ̧
+    { 8, 8, 0, -4, 1, 16, 45685 }, // ̨
+    { 6, 9, 9, -1, -1, 14, 45701 }, // ̩
+    { 13, 8, 0, -7, -1, 26, 45715 }, // ̭
+    { 12, 6, 0, -6, -2, 18, 45741 }, // ̮
+    { 12, 7, 0, -6, -2, 21, 45759 }, // ̰
+    { 12, 4, 0, -6, -3, 12, 45780 }, // ̱
+    { 12, 7, 0, -6, 26, 21, 45792 }, // ͂
+    { 13, 14, 0, -7, 34, 46, 45813 }, // ̈́
+    { 6, 7, 0, -2, -2, 11, 45859 }, // ͅ
+    { 23, 33, 21, -2, 33, 190, 45870 }, // Ѐ
+    { 23, 31, 21, -2, 31, 179, 46060 }, // Ё
+    { 22, 30, 25, 2, 23, 165, 46239 }, // Ђ
+    { 23, 33, 19, -2, 33, 190, 46404 }, // Ѓ
+    { 22, 25, 21, 0, 24, 138, 46594 }, // Є
+    { 19, 25, 18, -1, 24, 119, 46732 }, // Ѕ
+    { 17, 23, 13, -2, 23, 98, 46851 }, // І
+    { 18, 31, 13, -2, 31, 140, 46949 }, // Ї
+    { 21, 30, 13, -6, 23, 158, 47104 }, // Ј
+    { 32, 24, 31, -2, 23, 192, 47262 }, // Љ
+    { 33, 24, 32, -2, 23, 198, 47454 }, // Њ
+    { 24, 23, 28, 2, 23, 138, 47652 }, // Ћ
+    { 27, 34, 23, -2, 33, 230, 47790 }, // Ќ
+    { 30, 33, 27, -2, 33, 248, 48020 }, // Ѝ
+    { 24, 34, 22, 1, 33, 204, 48268 }, // Ў
+    { 29, 31, 25, -2, 23, 225, 48472 }, // Џ
+    { 26, 24, 24, -2, 24, 156, 48697 }, // А
+    { 22, 24, 21, -2, 23, 132, 48853 }, // Б
+    { 22, 25, 21, -2, 24, 138, 48985 }, // В
+    { 23, 23, 19, -2, 23, 133, 49152 }, // Г
+    { 28, 30, 25, -2, 23, 210, 49285 }, // Д
+    { 23, 23, 21, -2, 23, 133, 49495 }, // Е
+    { 37, 25, 32, -3, 24, 232, 49628 }, // Ж
+    { 19, 25, 19, -1, 24, 119, 49860 }, // З
+    { 30, 23, 27, -2, 23, 173, 49979 }, // И
+    { 30, 33, 27, -2, 33, 248, 50152 }, // Й
+    { 27, 25, 23, -2, 24, 169, 50400 }, // К
+    { 28, 24, 24, -2, 23, 168, 50569 }, // Л
+    { 33, 23, 30, -3, 23, 190, 50737 }, // М
+    { 30, 23, 26, -2, 23, 173, 50927 }, // Н
+    { 24, 25, 24, 0, 24, 150, 51200 }, // О
+    { 29, 23, 26, -2, 23, 167, 51350 }, // П
+    { 23, 24, 20, -2, 24, 138, 51517 }, // Р
+    { 21, 25, 22, 1, 24, 132, 51655 }, // С
+    { 22, 23, 22, 2, 23, 127, 51787 }, // Т
+    { 24, 24, 22, 1, 23, 144, 51914 }, // У
+    { 24, 25, 25, 0, 24, 150, 52058 }, // Ф
+    { 27, 23, 22, -3, 23, 156, 52208 }, // Х
+    { 29, 30, 26, -2, 23, 218, 52364 }, // Ц
+    { 23, 23, 24, 2, 23, 133, 52582 }, // Ч
+    { 37, 23, 33, -2, 23, 213, 52715 }, // Ш
+    { 37, 30, 34, -2, 23, 278, 52928 }, // Щ
+    { 21, 24, 24, 2, 23, 126, 53248 }, // Ъ
+    { 35, 24, 31, -2, 23, 210, 53374 }, // Ы
+    { 21, 24, 20, -2, 23, 126, 53584 }, // Ь
+    { 21, 25, 21, -1, 24, 132, 53710 }, // Э
+    { 36, 25, 34, -2, 24, 225, 53842 }, // Ю
+    { 26, 24, 22, -2, 23, 156, 54067 }, // Я
+    { 20, 19, 20, 0, 18, 95, 54223 }, // а
+    { 19, 28, 18, 1, 27, 133, 54318 }, // б
+    { 17, 19, 17, 0, 18, 81, 54451 }, // в
+    { 15, 19, 15, 0, 18, 72, 54532 }, // г
+    { 18, 27, 18, 0, 26, 122, 54604 }, // д
+    { 15, 19, 16, 0, 18, 72, 54726 }, // е
+    { 30, 19, 30, 0, 18, 143, 54798 }, // ж
+    { 16, 19, 15, -1, 18, 76, 54941 }, // з
+    { 20, 19, 20, 0, 18, 95, 55017 }, // и
+    { 20, 28, 20, 0, 27, 140, 55112 }, // й
+    { 18, 19, 19, 1, 18, 86, 55296 }, // к
+    { 21, 19, 21, -1, 18, 100, 55382 }, // л
+    { 27, 19, 26, -1, 18, 129, 55482 }, // м
+    { 19, 19, 21, 1, 18, 91, 55611 }, // н
+    { 17, 19, 18, 0, 18, 81, 55702 }, // о
+    { 19, 19, 20, 1, 18, 91, 55783 }, // п
+    { 21, 26, 19, -3, 18, 137, 55874 }, // р
+    { 15, 19, 15, 0, 18, 72, 56011 }, // с
+    { 27, 19, 29, 1, 18, 129, 56083 }, // т
+    { 22, 26, 17, -5, 18, 143, 56212 }, // у
+    { 23, 34, 24, 0, 26, 196, 56355 }, // ф
+    { 21, 19, 19, -1, 18, 100, 56551 }, // х
+    { 20, 25, 21, 0, 18, 125, 56651 }, // ц
+    { 18, 19, 20, 1, 18, 86, 56776 }, // ч
+    { 27, 19, 28, 0, 18, 129, 56862 }, // ш
+    { 28, 25, 28, 0, 18, 175, 56991 }, // щ
+    { 18, 19, 18, 0, 18, 86, 57166 }, // ъ
+    { 26, 19, 26, 0, 18, 124, 57344 }, // ы
+    { 16, 19, 17, 0, 18, 76, 57468 }, // ь
+    { 16, 19, 16, -1, 18, 76, 57544 }, // э
+    { 25, 19, 26, 1, 18, 119, 57620 }, // ю
+    { 19, 19, 20, 0, 18, 91, 57739 }, // я
+    { 15, 29, 16, 0, 28, 109, 57830 }, // ѐ
+    { 17, 27, 16, 0, 26, 115, 57939 }, // ё
+    { 18, 34, 19, 0, 26, 153, 58054 }, // ђ
+    { 16, 30, 15, 0, 29, 120, 58207 }, // ѓ
+    { 16, 19, 16, 0, 18, 76, 58327 }, // є
+    { 15, 19, 14, -1, 18, 72, 58403 }, // ѕ
+    { 10, 27, 11, 1, 26, 68, 58475 }, // і
+    { 13, 27, 11, 1, 26, 88, 58543 }, // ї
+    { 19, 34, 10, -7, 26, 162, 58631 }, // ј
+    { 27, 19, 26, -1, 18, 129, 58793 }, // љ
+    { 24, 19, 26, 1, 18, 114, 58922 }, // њ
+    { 19, 27, 20, 0, 26, 129, 59036 }, // ћ
+    { 18, 30, 19, 1, 29, 135, 59165 }, // ќ
+    { 20, 29, 20, 0, 28, 145, 59392 }, // ѝ
+    { 22, 35, 17, -5, 27, 193, 59537 }, // ў
+    { 20, 25, 20, 0, 18, 125, 59730 }, // џ
+    { 21, 27, 23, 2, 26, 142, 59855 }, // Ѣ
+    { 24, 19, 26, 1, 18, 114, 59997 }, // ѣ
+    { 24, 25, 24, 0, 24, 150, 60111 }, // Ѳ
+    { 17, 19, 18, 0, 18, 81, 60261 }, // ѳ
+    { 25, 25, 25, 2, 24, 157, 60342 }, // Ѵ
+    { 21, 19, 19, -1, 18, 100, 60499 }, // ѵ
+    { 30, 40, 27, -2, 33, 300, 60599 }, // Ҋ
+    { 20, 34, 20, 0, 27, 170, 60899 }, // ҋ
+    { 21, 24, 20, -2, 23, 126, 61069 }, // Ҍ
+    { 15, 25, 17, 1, 24, 94, 61195 }, // ҍ
+    { 23, 24, 20, -2, 24, 138, 61289 }, // Ҏ
+    { 21, 26, 19, -3, 18, 137, 61440 }, // ҏ
+    { 23, 28, 19, -2, 28, 161, 61577 }, // Ґ
+    { 17, 23, 16, 0, 22, 98, 61738 }, // ґ
+    { 23, 23, 19, -2, 23, 133, 61836 }, // Ғ
+    { 15, 19, 15, 0, 18, 72, 61969 }, // ғ
+    { 22, 30, 22, -2, 23, 165, 62041 }, // Ҕ
+    { 16, 26, 18, 1, 18, 104, 62206 }, // ҕ
+    { 37, 31, 32, -3, 24, 287, 62310 }, // Җ
+    { 30, 25, 30, 0, 18, 188, 62597 }, // җ
+    { 19, 31, 19, -1, 24, 148, 62785 }, // Ҙ
+    { 16, 25, 15, -1, 18, 100, 62933 }, // ҙ
+    { 27, 31, 23, -2, 24, 210, 63033 }, // Қ
+    { 18, 25, 19, 1, 18, 113, 63243 }, // қ
+    { 28, 25, 24, -2, 24, 175, 63488 }, // Ҝ
+    { 20, 19, 21, 1, 18, 95, 63663 }, // ҝ
+    { 27, 25, 23, -2, 24, 169, 63758 }, // Ҟ
+    { 18, 25, 18, 0, 24, 113, 63927 }, // ҟ
+    { 27, 25, 27, 2, 24, 169, 64040 }, // Ҡ
+    { 21, 19, 22, 0, 18, 100, 64209 }, // ҡ
+    { 30, 30, 27, -2, 23, 225, 64309 }, // Ң
+    { 20, 25, 21, 1, 18, 125, 64534 }, // ң
+    { 35, 23, 31, -2, 23, 202, 64659 }, // Ҥ
+    { 25, 19, 25, 1, 18, 119, 64861 }, // ҥ
+    { 34, 30, 34, -2, 23, 255, 64980 }, // Ҧ
+    { 26, 26, 28, 1, 18, 169, 65235 }, // ҧ
+    { 26, 25, 27, 1, 24, 163, 65536 }, // Ҩ
+    { 21, 19, 21, 0, 18, 100, 65699 }, // ҩ
+    { 21, 31, 22, 1, 24, 163, 65799 }, // Ҫ
+    { 15, 25, 15, 0, 18, 94, 65962 }, // ҫ
+    { 22, 30, 22, 2, 23, 165, 66056 }, // Ҭ
+    { 28, 25, 29, 1, 18, 175, 66221 }, // ҭ
+    { 23, 23, 22, 1, 23, 133, 66396 }, // Ү
+    { 17, 26, 17, 0, 18, 111, 66529 }, // ү
+    { 23, 23, 22, 1, 23, 133, 66640 }, // Ұ
+    { 17, 26, 17, 0, 18, 111, 66773 }, // ұ
+    { 27, 30, 22, -3, 23, 203, 66884 }, // Ҳ
+    { 21, 25, 19, -1, 18, 132, 67087 }, // ҳ
+    { 30, 30, 30, 2, 23, 225, 67219 }, // Ҵ
+    { 20, 31, 21, 0, 24, 155, 67584 }, // ҵ
+    { 23, 30, 24, 2, 23, 173, 67739 }, // Ҷ
+    { 19, 25, 20, 1, 18, 119, 67912 }, // ҷ
+    { 24, 23, 24, 2, 23, 138, 68031 }, // Ҹ
+    { 19, 19, 20, 1, 18, 91, 68169 }, // ҹ
+    { 24, 23, 24, -2, 23, 138, 68260 }, // Һ
+    { 19, 27, 20, 0, 26, 129, 68398 }, // һ
+    { 26, 25, 27, 1, 24, 163, 68527 }, // Ҽ
+    { 19, 19, 20, 0, 18, 91, 68690 }, // ҽ
+    { 26, 32, 27, 1, 24, 208, 68781 }, // Ҿ
+    { 19, 25, 20, 0, 18, 119, 68989 }, // ҿ
+    { 17, 23, 13, -2, 23, 98, 69108 }, // Ӏ
+    { 37, 34, 32, -3, 33, 315, 69206 }, // Ӂ
+    { 30, 28, 30, 0, 27, 210, 69632 }, // ӂ
+    { 27, 31, 24, -2, 24, 210, 69842 }, // Ӄ
+    { 18, 26, 19, 1, 18, 117, 70052 }, // ӄ
+    { 28, 30, 24, -2, 23, 210, 70169 }, // Ӆ
+    { 22, 25, 21, -1, 18, 138, 70379 }, // ӆ
+    { 30, 30, 26, -2, 23, 225, 70517 }, // Ӈ
+    { 18, 26, 19, 1, 18, 117, 70742 }, // ӈ
+    { 30, 30, 27, -2, 23, 225, 70859 }, // Ӊ
+    { 20, 25, 21, 1, 18, 125, 71084 }, // ӊ
+    { 23, 30, 24, 2, 23, 173, 71209 }, // Ӌ
+    { 18, 25, 19, 1, 18, 113, 71382 }, // ӌ
+    { 33, 30, 30, -3, 23, 248, 71680 }, // Ӎ
+    { 27, 25, 26, -1, 18, 169, 71928 }, // ӎ
+    { 17, 26, 13, -2, 26, 111, 72097 }, // ӏ
+    { 26, 33, 24, -2, 33, 215, 72208 }, // Ӑ
+    { 20, 28, 20, 0, 27, 140, 72423 }, // ӑ
+    { 26, 31, 24, -2, 31, 202, 72563 }, // Ӓ
+    { 20, 27, 20, 0, 26, 135, 72765 }, // ӓ
+    { 34, 23, 31, -3, 23, 196, 72900 }, // Ӕ
+    { 26, 19, 26, 0, 18, 124, 73096 }, // ӕ
+    { 23, 33, 21, -2, 33, 190, 73220 }, // Ӗ
+    { 17, 28, 16, 0, 27, 119, 73410 }, // ӗ
+    { 21, 25, 22, 0, 24, 132, 73529 }, // Ә
+    { 16, 19, 16, 0, 18, 76, 73728 }, // ә
+    { 21, 32, 22, 0, 31, 168, 73804 }, // Ӛ
+    { 16, 27, 16, 0, 26, 108, 73972 }, // ӛ
+    { 37, 32, 32, -3, 31, 296, 74080 }, // Ӝ
+    { 30, 27, 30, 0, 26, 203, 74376 }, // ӝ
+    { 19, 32, 19, -1, 31, 152, 74579 }, // Ӟ
+    { 17, 27, 15, -1, 26, 115, 74731 }, // ӟ
+    { 21, 24, 19, -1, 23, 126, 74846 }, // Ӡ
+    { 20, 26, 18, -2, 18, 130, 74972 }, // ӡ
+    { 30, 30, 27, -2, 30, 225, 75102 }, // Ӣ
+    { 20, 25, 20, 0, 24, 125, 75327 }, // ӣ
+    { 30, 31, 27, -2, 31, 233, 75452 }, // Ӥ
+    { 20, 27, 20, 0, 26, 135, 75776 }, // ӥ
+    { 24, 32, 24, 0, 31, 192, 75911 }, // Ӧ
+    { 18, 27, 18, 0, 26, 122, 76103 }, // ӧ
+    { 24, 25, 24, 0, 24, 150, 76225 }, // Ө
+    { 17, 19, 18, 0, 18, 81, 76375 }, // ө
+    { 24, 32, 24, 0, 31, 192, 76456 }, // Ӫ
+    { 18, 27, 18, 0, 26, 122, 76648 }, // ӫ
+    { 21, 32, 21, -1, 31, 168, 76770 }, // Ӭ
+    { 16, 27, 16, -1, 26, 108, 76938 }, // ӭ
+    { 24, 31, 22, 1, 30, 186, 77046 }, // Ӯ
+    { 22, 32, 17, -5, 24, 176, 77232 }, // ӯ
+    { 24, 32, 22, 1, 31, 192, 77408 }, // Ӱ
+    { 22, 34, 17, -5, 26, 187, 77600 }, // ӱ
+    { 24, 34, 22, 1, 33, 204, 77824 }, // Ӳ
+    { 22, 36, 17, -5, 28, 198, 78028 }, // ӳ
+    { 23, 31, 24, 2, 31, 179, 78226 }, // Ӵ
+    { 18, 27, 20, 1, 26, 122, 78405 }, // ӵ
+    { 23, 30, 19, -2, 23, 173, 78527 }, // Ӷ
+    { 15, 25, 15, 0, 18, 94, 78700 }, // ӷ
+    { 35, 32, 31, -2, 31, 280, 78794 }, // Ӹ
+    { 26, 27, 26, 0, 26, 176, 79074 }, // ӹ
+    { 23, 30, 19, -2, 23, 173, 79250 }, // Ӻ
+    { 15, 25, 15, 0, 18, 94, 79423 }, // ӻ
+    { 27, 30, 22, -3, 23, 203, 79517 }, // Ӽ
+    { 21, 26, 19, -1, 18, 137, 79720 }, // ӽ
+    { 27, 23, 22, -3, 23, 156, 79872 }, // Ӿ
+    { 21, 19, 19, -1, 18, 100, 80028 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 80128 }, //  
+    { 0, 0, 33, 0, 0, 0, 80128 }, //  
+    { 0, 0, 17, 0, 0, 0, 80128 }, //  
+    { 0, 0, 33, 0, 0, 0, 80128 }, //  
+    { 0, 0, 11, 0, 0, 0, 80128 }, //  
+    { 0, 0, 8, 0, 0, 0, 80128 }, //  
+    { 0, 0, 5, 0, 0, 0, 80128 }, //  
+    { 0, 0, 21, 0, 0, 0, 80128 }, //  
+    { 0, 0, 10, 0, 0, 0, 80128 }, //  
+    { 0, 0, 7, 0, 0, 0, 80128 }, //  
+    { 0, 0, 2, 0, 0, 0, 80128 }, //  
+    { 0, 0, 0, 0, 0, 0, 80128 }, // ​
+    { 2, 28, 0, -1, 20, 14, 80128 }, // ‌
+    { 8, 30, 0, -4, 22, 60, 80142 }, // ‍
+    { 12, 31, 0, -6, 23, 93, 80202 }, // ‎
+    { 12, 31, 0, -6, 23, 93, 80295 }, // ‏
+    { 11, 5, 13, 1, 11, 14, 80388 }, // ‐
+    { 11, 5, 13, 1, 11, 14, 80402 }, // ‑
+    { 17, 4, 21, 2, 13, 17, 80416 }, // ‒
+    { 17, 5, 17, 0, 11, 22, 80433 }, // –
+    { 33, 5, 33, 0, 11, 42, 80455 }, // —
+    { 33, 5, 33, 0, 11, 42, 80497 }, // ―
+    { 12, 34, 17, 2, 26, 102, 80539 }, // ‖
+    { 17, 9, 17, 0, -1, 39, 80641 }, // ‗
+    { 8, 11, 10, 2, 25, 22, 80680 }, // ‘
+    { 8, 11, 10, 2, 25, 22, 80702 }, // ’
+    { 8, 11, 10, 0, 5, 22, 80724 }, // ‚
+    { 8, 12, 10, 1, 25, 24, 80746 }, // ‛
+    { 15, 11, 17, 2, 25, 42, 80770 }, // “
+    { 15, 12, 17, 2, 25, 45, 80812 }, // ”
+    { 14, 11, 17, 0, 5, 39, 80857 }, // „
+    { 15, 12, 17, 1, 25, 45, 80896 }, // ‟
+    { 15, 22, 15, 1, 24, 83, 80941 }, // †
+    { 17, 26, 15, -1, 24, 111, 81024 }, // ‡
+    { 8, 8, 10, 1, 13, 16, 81135 }, // •
+    { 12, 12, 21, 4, 17, 36, 81151 }, // ‣
+    { 7, 6, 10, 1, 5, 11, 81187 }, // ․
+    { 15, 6, 17, 1, 5, 23, 81198 }, // ‥
+    { 29, 6, 33, 2, 5, 44, 81221 }, // …
+    { 7, 6, 10, 1, 12, 11, 81265 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 81276 }, //  
+    { 0, 0, 0, 0, 0, 0, 81276 }, //  
+    { 12, 31, 0, -6, 23, 93, 81276 }, // ‪
+    { 12, 31, 0, -6, 23, 93, 81369 }, // ‫
+    { 10, 31, 0, -5, 23, 78, 81462 }, // ‬
+    { 14, 31, 0, -7, 23, 109, 81540 }, // ‭
+    { 14, 31, 0, -7, 23, 109, 81649 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 81758 }, //  
+    { 44, 28, 46, 1, 25, 308, 81920 }, // ‰
+    { 8, 11, 8, 0, 23, 22, 82228 }, // ′
+    { 15, 11, 15, 0, 23, 42, 82250 }, // ″
+    { 23, 11, 23, 0, 23, 64, 82292 }, // ‴
+    { 8, 11, 8, 0, 23, 22, 82356 }, // ‵
+    { 15, 11, 16, 0, 23, 42, 82378 }, // ‶
+    { 22, 11, 23, 0, 23, 61, 82420 }, // ‷
+    { 14, 7, 16, 1, 0, 25, 82481 }, // ‸
+    { 10, 13, 12, 1, 15, 33, 82506 }, // ‹
+    { 11, 13, 12, 0, 15, 36, 82539 }, // ›
+    { 21, 23, 21, 0, 22, 121, 82575 }, // ※
+    { 20, 26, 20, 1, 25, 130, 82696 }, // ‼
+    { 17, 4, 17, 0, 28, 17, 82826 }, // ‾
+    { 8, 5, 10, 1, 11, 10, 82843 }, // ⁃
+    { 21, 28, 9, -6, 25, 147, 82853 }, // ⁄
+    { 24, 25, 26, 2, 24, 150, 83000 }, // ⁇
+    { 22, 26, 23, 2, 25, 143, 83150 }, // ⁈
+    { 22, 26, 23, 1, 25, 143, 83293 }, // ⁉
+    { 20, 7, 33, 6, 13, 35, 83436 }, // ⁓
+    { 30, 11, 30, 0, 23, 83, 83471 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 83554 }, //  
+    { 0, 0, 0, 0, 0, 0, 83554 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 83554 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 83554 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 83554 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 83554 }, // ⁤
+    { 14, 17, 15, 0, 28, 60, 83554 }, // ⁰
+    { 14, 16, 15, 0, 28, 56, 83614 }, // ⁴
+    { 13, 16, 15, 1, 27, 52, 83670 }, // ⁵
+    { 14, 17, 15, 1, 28, 60, 83722 }, // ⁶
+    { 13, 16, 15, 2, 27, 52, 83782 }, // ⁷
+    { 13, 17, 15, 1, 28, 56, 83834 }, // ⁸
+    { 14, 17, 15, 0, 28, 60, 83890 }, // ⁹
+    { 13, 13, 19, 3, 24, 43, 83968 }, // ⁿ
+    { 14, 16, 15, 0, 11, 56, 84011 }, // ₀
+    { 11, 16, 15, 1, 11, 44, 84067 }, // ₁
+    { 14, 16, 15, 0, 11, 56, 84111 }, // ₂
+    { 12, 16, 15, 1, 11, 48, 84167 }, // ₃
+    { 14, 16, 15, 0, 11, 56, 84215 }, // ₄
+    { 13, 16, 15, 1, 11, 52, 84271 }, // ₅
+    { 14, 16, 15, 1, 11, 56, 84323 }, // ₆
+    { 13, 16, 15, 2, 11, 52, 84379 }, // ₇
+    { 13, 16, 15, 1, 11, 52, 84431 }, // ₈
+    { 14, 16, 15, 0, 11, 56, 84483 }, // ₉
+    { 22, 23, 21, -1, 23, 127, 84539 }, // ₣
+    { 22, 24, 21, -1, 23, 132, 84666 }, // ₤
+    { 43, 24, 44, 0, 23, 258, 84798 }, // ₧
+    { 23, 24, 21, -1, 23, 138, 85056 }, // €
+    { 21, 15, 33, 6, 19, 79, 85194 }, // ←
+    { 15, 21, 33, 9, 22, 79, 85273 }, // ↑
+    { 21, 15, 33, 6, 19, 79, 85352 }, // →
+    { 15, 21, 33, 9, 22, 79, 85431 }, // ↓
+    { 21, 15, 33, 6, 19, 79, 85510 }, // ↔
+    { 15, 23, 33, 9, 23, 87, 85589 }, // ↕
+    { 15, 23, 33, 9, 23, 87, 85676 }, // ↨
+    { 15, 23, 33, 9, 23, 87, 85763 }, // ↲
+    { 15, 23, 33, 9, 23, 87, 85850 }, // ↳
+    { 19, 18, 33, 7, 20, 86, 86016 }, // ↵
+    { 21, 19, 33, 6, 21, 100, 86102 }, // ⇐
+    { 19, 21, 33, 7, 22, 100, 86202 }, // ⇑
+    { 21, 19, 33, 6, 21, 100, 86302 }, // ⇒
+    { 19, 21, 33, 7, 22, 100, 86402 }, // ⇓
+    { 21, 17, 33, 6, 20, 90, 86502 }, // ⇔
+    { 23, 24, 33, 5, 23, 138, 86592 }, // ∀
+    { 18, 27, 21, 1, 26, 122, 86730 }, // ∂
+    { 17, 23, 33, 8, 23, 98, 86852 }, // ∃
+    { 25, 27, 33, 4, 25, 169, 86950 }, // ∅
+    { 22, 24, 23, 0, 24, 132, 87119 }, // ∆
+    { 21, 24, 33, 6, 23, 126, 87251 }, // ∇
+    { 23, 23, 33, 5, 23, 133, 87377 }, // ∈
+    { 23, 29, 33, 5, 26, 167, 87510 }, // ∉
+    { 23, 20, 33, 5, 21, 115, 87677 }, // ∊
+    { 23, 23, 33, 5, 23, 133, 87792 }, // ∋
+    { 23, 29, 33, 5, 26, 167, 88064 }, // ∌
+    { 23, 20, 33, 5, 21, 115, 88231 }, // ∍
+    { 26, 29, 28, 1, 23, 189, 88346 }, // ∏
+    { 21, 29, 22, 1, 23, 153, 88535 }, // ∑
+    { 15, 4, 21, 3, 13, 15, 88688 }, // −
+    { 21, 26, 17, -2, 24, 137, 88703 }, // ∕
+    { 16, 26, 17, 1, 24, 104, 88840 }, // ∖
+    { 16, 16, 21, 2, 19, 64, 88944 }, // ∗
+    { 13, 12, 21, 4, 17, 39, 89008 }, // ∘
+    { 7, 6, 21, 7, 12, 11, 89047 }, // ∙
+    { 22, 31, 21, -1, 27, 171, 89058 }, // √
+    { 17, 13, 21, 2, 17, 56, 89229 }, // ∝
+    { 21, 13, 21, 0, 17, 69, 89285 }, // ∞
+    { 21, 23, 33, 6, 23, 121, 89354 }, // ∟
+    { 25, 23, 33, 4, 23, 144, 89475 }, // ∠
+    { 5, 34, 17, 6, 26, 43, 89619 }, // ∣
+    { 12, 34, 17, 2, 26, 102, 89662 }, // ∥
+    { 23, 23, 33, 5, 23, 133, 89764 }, // ∧
+    { 23, 23, 33, 5, 23, 133, 89897 }, // ∨
+    { 19, 24, 33, 7, 24, 114, 90112 }, // ∩
+    { 19, 24, 33, 7, 23, 114, 90226 }, // ∪
+    { 19, 34, 21, 1, 26, 162, 90340 }, // ∫
+    { 23, 20, 33, 5, 19, 115, 90502 }, // ∴
+    { 23, 20, 33, 5, 19, 115, 90617 }, // ∵
+    { 8, 18, 10, 1, 20, 36, 90732 }, // ∶
+    { 23, 20, 33, 5, 19, 115, 90768 }, // ∷
+    { 20, 7, 33, 6, 13, 35, 90883 }, // ∼
+    { 20, 18, 33, 6, 20, 90, 90918 }, // ≅
+    { 17, 14, 21, 2, 18, 60, 91008 }, // ≈
+    { 19, 13, 33, 7, 16, 62, 91068 }, // ≍
+    { 15, 16, 21, 3, 19, 60, 91130 }, // ≠
+    { 19, 16, 33, 7, 18, 76, 91190 }, // ≡
+    { 15, 20, 21, 3, 20, 75, 91266 }, // ≤
+    { 15, 21, 21, 3, 21, 79, 91341 }, // ≥
+    { 27, 16, 33, 3, 19, 108, 91420 }, // ≪
+    { 27, 16, 33, 3, 19, 108, 91528 }, // ≫
+    { 23, 20, 33, 5, 21, 115, 91636 }, // ⊃
+    { 23, 29, 33, 5, 26, 167, 91751 }, // ⊄
+    { 23, 29, 33, 5, 26, 167, 91918 }, // ⊅
+    { 21, 23, 33, 6, 23, 121, 92160 }, // ⊆
+    { 21, 23, 33, 6, 23, 121, 92281 }, // ⊇
+    { 25, 25, 33, 4, 24, 157, 92402 }, // ⊕
+    { 25, 25, 33, 4, 24, 157, 92559 }, // ⊖
+    { 25, 25, 33, 4, 24, 157, 92716 }, // ⊗
+    { 25, 25, 33, 4, 24, 157, 92873 }, // ⊘
+    { 19, 23, 33, 7, 23, 110, 93030 }, // ⊥
+    { 7, 6, 21, 7, 12, 11, 93140 }, // ⋅
+    { 29, 6, 33, 2, 12, 44, 93151 }, // ⋯
+    { 31, 32, 33, 1, 28, 248, 93195 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_bolditalicIntervals[] = {
@@ -6445,4 +3732,9 @@ static const EpdFontData bookerly_16_bolditalic = {
     36,
     -9,
     true,
+    bookerly_16_bolditalicBlockOffsets,
+    bookerly_16_bolditalicDirectGlyphs,
+    bookerly_16_bolditalicGlyphPages,
+    256,
+    bookerly_16_bolditalicPageGlyphs,
 };
@@ -2,5237 +2,2755 @@
  * generated by fontconvert.py
  * name: bookerly_16_italic
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_16_italic 16 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_16_italic 16 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_italicBitmaps[83583] = {
-    0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xE0,
-    0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0x74, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x40,
-    0x00, 0x00, 0x80, 0x18, 0x07, 0xC0, 0xBC, 0x0F, 0xC0, 0xF8, 0x0F, 0x81, 0xF4, 0x1F, 0x42, 0xF0,
-    0x1F, 0x02, 0xF0, 0x2F, 0x03, 0xE0, 0x2E, 0x03, 0xC0, 0x3D, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00,
-    0x78, 0x00, 0x00, 0x0B, 0x80, 0x2D, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0x55, 0xF5, 0x57,
-    0xD5, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2A, 0xBF, 0xAA, 0xFE, 0xA4, 0x00, 0x0F, 0x40, 0x3D,
-    0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x02, 0xE0,
-    0x00, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0xB4, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x03, 0xF9, 0xBB, 0xFD, 0x00, 0xBD, 0x0F, 0x4B, 0xF0, 0x0F, 0xC0, 0xF0, 0x3F, 0x01, 0xF8,
-    0x1E, 0x03, 0xE0, 0x1F, 0xC2, 0xD0, 0x10, 0x00, 0xFD, 0x2C, 0x00, 0x00, 0x0F, 0xFB, 0xC0, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x01, 0xE7, 0xFC, 0x00, 0x40, 0x2D, 0x0F, 0xE0, 0x7C, 0x03, 0xC0, 0xFF, 0x0B,
-    0xC0, 0x3C, 0x0B, 0xE0, 0xFD, 0x07, 0x80, 0xFE, 0x0B, 0xF0, 0xB4, 0x1F, 0xC0, 0x7F, 0xEF, 0x5B,
-    0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x3D, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xE0, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x7C,
-    0x00, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0x00,
-    0xBC, 0x00, 0xF8, 0x0B, 0xC0, 0x05, 0x40, 0xBC, 0x01, 0xF0, 0x1F, 0x00, 0xBF, 0xF0, 0x7E, 0x07,
-    0xD0, 0x3D, 0x03, 0xFA, 0xFC, 0x2F, 0xFF, 0x40, 0xB8, 0x0F, 0xC0, 0x7D, 0x0B, 0xF8, 0x01, 0xF0,
-    0x1F, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x3D, 0x00,
-    0x3E, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x00, 0xF4, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x0B, 0xC0,
-    0x00, 0x7C, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x0F, 0xC0, 0x00, 0x04, 0x00, 0x0B, 0xDB, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x2F, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xBF, 0xD0, 0x0B, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xF7,
-    0xF0, 0x0B, 0xFF, 0x90, 0x00, 0xF8, 0x3F, 0x02, 0xFE, 0xE0, 0x00, 0x2F, 0x01, 0xF8, 0x2D, 0x2E,
-    0x00, 0x03, 0xD0, 0x0F, 0xD0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x7C, 0x00, 0x0B, 0xC0,
-    0x03, 0xF8, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x0F, 0xE2, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x55, 0xBF, 0xFE, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x2F, 0xFF, 0x90, 0x00, 0x05, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x40, 0x00, 0x80, 0x7C, 0x0F, 0xC0, 0xF8, 0x1F,
-    0x41, 0xF0, 0x2F, 0x02, 0xE0, 0x3D, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x08, 0x0F, 0xC0,
-    0x2F, 0x0F, 0x40, 0x3F, 0xCE, 0x00, 0x07, 0xFD, 0xBD, 0x00, 0xBF, 0xFD, 0x0B, 0xED, 0x6D, 0x3F,
-    0x8E, 0x00, 0x1F, 0x0F, 0x00, 0x04, 0x0F, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E,
-    0x00, 0x01, 0x55, 0xF9, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFD, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC,
-    0x02, 0xF0, 0x07, 0xE0, 0x1F, 0x80, 0xBD, 0x00, 0x10, 0x00, 0x7F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xCB, 0xF7, 0xFD, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xE0, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFC,
-    0x00, 0xBE, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x07,
-    0xF0, 0x00, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00,
-    0x03, 0xF0, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F,
-    0x80, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x0F, 0xF9, 0x6F, 0xF4, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x6F, 0xE0, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFC, 0x00, 0x05, 0x7F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x7F, 0xD0, 0x07, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0xBF, 0x00,
-    0x07, 0xF4, 0x03, 0xF0, 0x00, 0x1F, 0xD0, 0x07, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0x7E, 0x00, 0x0B, 0xF0, 0x07,
-    0x80, 0x00, 0xBE, 0x00, 0x10, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x5B, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFB, 0xD0, 0x00, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x03, 0xF4, 0x2F, 0x40, 0x00,
-    0x3F, 0x40, 0xFC, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x02, 0xF8, 0x00,
-    0x7E, 0x00, 0x2F, 0x80, 0x02, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x55, 0x55, 0x5F, 0xE5, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-    0x16, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x6F, 0xFE, 0x00,
-    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x1B, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x2F,
-    0x80, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x3F, 0x40,
-    0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x03,
-    0xFC, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xBD, 0x55, 0x56, 0xFC, 0x3E, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xFD, 0x07,
-    0x80, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0F, 0xF9, 0xBF, 0xD0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0xBE,
-    0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0x0B, 0xD0, 0x0F, 0xE0, 0x01, 0xFC,
-    0x00, 0xBF, 0x40, 0x7F, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x7F, 0xBF, 0xF0, 0x00, 0x2F, 0xC0, 0xBF, 0xC0, 0x0B, 0xE0, 0x02, 0xFD, 0x01,
-    0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00,
-    0xFE, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x2F, 0xF4, 0x1F, 0xF4, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xAB, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-    0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x00, 0xFE, 0x02, 0xFC,
-    0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x3F, 0xD0, 0x02,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x16, 0x57, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0xFD, 0x03, 0xFD,
-    0x03, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xBF, 0x40, 0xFF, 0x40, 0xFE, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x2F, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xF4,
-    0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x52, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x10, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07,
-    0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xF0, 0x0F, 0xEB, 0xF8, 0x08, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xA8, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x00, 0x7F,
-    0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xE0, 0x00, 0x69, 0x05, 0x00, 0x7E, 0x01,
-    0xF8, 0x00, 0x3F, 0xFE, 0xF0, 0x03, 0xE0, 0x3F, 0x00, 0x0F, 0xE7, 0xFF, 0x00, 0x3E, 0x07, 0xD0,
-    0x03, 0xF0, 0x0B, 0xE0, 0x03, 0xE0, 0xFC, 0x00, 0xBD, 0x00, 0x3C, 0x00, 0x3E, 0x0F, 0x80, 0x0F,
-    0x80, 0x07, 0xC0, 0x03, 0xD1, 0xF0, 0x01, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x2F, 0x00, 0x3F, 0x00,
-    0x0F, 0x40, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0xF4, 0x3F, 0x00, 0x3E, 0x00, 0x7F,
-    0x00, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x0F, 0xF0, 0x0B, 0xD0, 0x3F, 0x00, 0x3F, 0x03, 0xDF, 0x02,
-    0xF4, 0x03, 0xF0, 0x03, 0xFE, 0xF1, 0xFB, 0xFD, 0x00, 0x3F, 0x00, 0x2F, 0xFC, 0x0F, 0xFF, 0x00,
-    0x02, 0xF4, 0x00, 0x69, 0x00, 0x29, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x55, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4,
-    0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xA6, 0xF8, 0x0B, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x07, 0xE0,
-    0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x0B,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0x40, 0x1F, 0xF4,
-    0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00,
-    0x7E, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0xFC,
-    0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x51, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFA, 0x5B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D,
-    0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03, 0xF4, 0x00, 0x00, 0x7C, 0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0,
-    0x0B, 0xFF, 0xAA, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xA6, 0xF8, 0x06, 0xFF, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0x2F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFE,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0xBD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFD, 0x00, 0x01, 0xFD, 0x01, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0xAB, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFE,
-    0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x3C, 0x00, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x03, 0xF0, 0x00,
-    0x34, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xDA, 0xAA, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xE9, 0x6B, 0xFD, 0x00, 0x7F, 0x80, 0x00, 0x2F,
-    0x00, 0x7F, 0x40, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x00, 0x02, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xFF, 0xDB,
-    0xF0, 0x00, 0x0B, 0xFF, 0xF6, 0xFC, 0x00, 0x00, 0x1B, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0xFF, 0x40, 0x00, 0x0B, 0xD0, 0x0F,
-    0xF8, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0xE9, 0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xD0, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0x95, 0x55, 0x56, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x28, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0xBF, 0xD0, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x00, 0x6F, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x81, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xD3, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x6F,
-    0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x38, 0x02, 0xF8, 0x00, 0x02, 0xE0, 0x0F, 0xD0, 0x00, 0x0F, 0x40, 0x3F,
-    0x00, 0x00, 0xBC, 0x01, 0xFD, 0x5A, 0xAB, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x7E, 0xF8, 0x00, 0x0F, 0xBF, 0x40, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x1F,
-    0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0xBC,
-    0x3F, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x02, 0xF0,
-    0x3F, 0x00, 0x00, 0x03, 0xE0, 0xBD, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x7E, 0x0B, 0xC0,
-    0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x0F, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x3E, 0x00,
-    0x7E, 0x00, 0x00, 0x1F, 0x40, 0x3F, 0x7C, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0xF4, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x00,
-    0xBD, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x00,
-    0x00, 0x1F, 0x42, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0xBE, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x3F,
-    0x83, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x07, 0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07,
-    0xF4, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xA6, 0xF8, 0x07, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x7F,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0x7E, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x1F,
-    0xC5, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xF9, 0x57, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x06,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0xA8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0x6F, 0x80, 0xBF, 0x80,
-    0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0xBD,
-    0x00, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x2F,
-    0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x9B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00,
-    0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0x4B, 0xFF, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x07, 0xC0, 0x3F, 0x00,
-    0x01, 0xE0, 0x0F, 0xD0, 0x00, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x18, 0x00, 0x02, 0xFC, 0x0F, 0x00, 0x00, 0x3F,
-    0x07, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x03, 0xF0, 0x2F, 0xE4, 0x07,
-    0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00,
-    0xBE, 0x00, 0x3D, 0x3C, 0x00, 0xBD, 0x00, 0x3C, 0x3C, 0x00, 0xFD, 0x00, 0x3C, 0x38, 0x00, 0xFC,
-    0x00, 0x74, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40,
-    0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF8, 0x0B, 0xF9,
-    0x00, 0x00, 0x7F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x0B,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xBD, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x64, 0x00, 0x2F, 0xFF, 0xE3, 0xFF, 0xFE, 0x00, 0x0F, 0x80,
-    0x03, 0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x2F, 0x40, 0x02, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x03, 0xFF, 0xC0, 0x01, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0xC0, 0x0F, 0xCB, 0xD0, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x7D, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x3F, 0x07, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x7E, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0xFC, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x3F, 0x0B, 0xC0,
-    0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x3F, 0x1F,
-    0x00, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x03, 0xF3, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xF0, 0x00, 0x2F,
-    0xBC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xF4, 0x07, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xDF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x7E, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xBD, 0x00,
-    0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00,
-    0x00, 0x00, 0x3F, 0x5F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBE, 0xAA, 0xAA, 0xFE, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xF4, 0x00,
-    0x0B, 0xF0, 0x00, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB0, 0x02, 0xFC,
-    0x00, 0x00, 0xF0, 0x07, 0xF0, 0x00, 0x02, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0xEA, 0xAA,
-    0xAF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xBC,
-    0x1F, 0x40, 0x00, 0xF8, 0x0F, 0x80, 0x02, 0xF0, 0x0B, 0xC0, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xD0,
-    0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xBC, 0x2E, 0x00,
-    0x00, 0x3D, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x01, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x2F, 0xC0, 0x2F, 0x80, 0x1F, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02,
-    0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F,
-    0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0,
-    0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2,
-    0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40,
-    0x00, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0x40, 0x07, 0xD1,
-    0xFF, 0xF0, 0x02, 0xF2, 0xFA, 0xFE, 0x00, 0xFD, 0xF0, 0x2F, 0xC0, 0x3E, 0xF0, 0x07, 0xF0, 0x0F,
-    0xF0, 0x01, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x1F, 0x80, 0xFD, 0x00, 0x0B, 0xD0,
-    0x3F, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x7F,
-    0x00, 0xF8, 0x00, 0x3F, 0x00, 0xBF, 0x90, 0x7F, 0x40, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xAF, 0xFE,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0xFC,
-    0x03, 0xF9, 0xBE, 0x03, 0xF0, 0x01, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x87, 0xF0, 0x01, 0xF0, 0xFF, 0x9B, 0xF4, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xD0,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0xE3,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0B, 0xF5, 0xBF, 0xE0, 0x01, 0xF8, 0x00, 0xFD, 0x00, 0x3F,
-    0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00,
-    0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC,
-    0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xC0, 0xBD, 0x03, 0xE0, 0x07, 0xD0,
-    0xBC, 0x00, 0xBD, 0x0F, 0x80, 0x1F, 0xC2, 0xF0, 0x0B, 0xF0, 0x3F, 0x07, 0xFC, 0x07, 0xFB, 0xFE,
-    0x00, 0x7F, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x20, 0x7F,
-    0x00, 0x1F, 0x43, 0xFE, 0x6F, 0xE0, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x10, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x56, 0xF9, 0x54, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
-    0x40, 0xFD, 0x90, 0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x1F,
-    0x40, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x01,
-    0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE7, 0xFF, 0xC0, 0x00,
-    0x2F, 0xD0, 0x02, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80,
-    0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0xEA, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0xC0, 0x01, 0xF4, 0x3F, 0xFE, 0x00, 0x2F, 0x0F,
-    0xEF, 0xF0, 0x03, 0xF3, 0xE0, 0x3F, 0x00, 0x3E, 0xB8, 0x03, 0xE0, 0x07, 0xEF, 0x00, 0x7D, 0x00,
-    0xBF, 0xC0, 0x0B, 0xC0, 0x0F, 0xF4, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x01,
-    0xF4, 0x01, 0xFC, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x08, 0x3F,
-    0x00, 0x07, 0xD2, 0xD7, 0xE0, 0x00, 0xBF, 0xFC, 0xBD, 0x00, 0x0B, 0xFF, 0x0F, 0xC0, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x3F,
-    0xFD, 0x01, 0x5F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x20, 0x3F, 0x4F, 0x03,
-    0xFF, 0xE0, 0x3F, 0xF8, 0x03, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0x5F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x04, 0x03, 0xF0, 0x00, 0x07, 0x96, 0xF4, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBC, 0x1F, 0xF8, 0x00, 0xF8, 0xBF, 0xFD, 0x00, 0xFB, 0xE0, 0xBD, 0x01, 0xFF, 0x40, 0x7D, 0x02,
-    0xFD, 0x00, 0xBC, 0x03, 0xF8, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x07, 0xD0, 0x7F, 0x80, 0x0B,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x1F,
-    0x43, 0xF8, 0x00, 0x2F, 0x01, 0xFE, 0x00, 0x3F, 0x00, 0xBF, 0xD0, 0x3F, 0x00, 0x2F, 0xFF, 0x7D,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x15, 0x02, 0xFF, 0xD0, 0xFF, 0xF4, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-    0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0F, 0xC1, 0x43, 0xF1, 0xE1, 0xFF, 0xF4, 0x7F, 0xF4, 0x0F,
-    0xF0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x02, 0xFD, 0x00,
-    0x7F, 0xC0, 0x7F, 0xF8, 0x1F, 0xFF, 0x02, 0xFF, 0xD0, 0x15, 0xF8, 0x7F, 0xBF, 0x0F, 0xEF, 0xE0,
-    0x01, 0xF5, 0xF4, 0x3F, 0x3E, 0x07, 0xE0, 0x01, 0xF7, 0xD0, 0x3E, 0xB8, 0x0B, 0xD0, 0x02, 0xFB,
-    0x40, 0x3F, 0xF0, 0x0B, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0xBF,
-    0x40, 0x0F, 0x80, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0x40, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x2F,
-    0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0x7D, 0x08, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xBC, 0x3C, 0x2F, 0x00, 0x07,
-    0xE0, 0x00, 0xFE, 0xF8, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xE0, 0x3E, 0x00, 0x0F, 0xC0, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0,
-    0x0B, 0xF8, 0x07, 0xFF, 0x81, 0xFF, 0xF4, 0x05, 0x7E, 0x1F, 0xEF, 0xE0, 0x01, 0xF5, 0xF4, 0x2F,
-    0x40, 0x07, 0xDF, 0x40, 0xBD, 0x00, 0x2F, 0xB4, 0x03, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xC0, 0x03,
-    0xFC, 0x00, 0x7E, 0x00, 0x1F, 0xD0, 0x02, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x82, 0xF4, 0x00, 0x3F, 0x1F,
-    0x0B, 0xC0, 0x00, 0xFE, 0xF8, 0x3F, 0x00, 0x03, 0xFF, 0x80, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE,
-    0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC,
-    0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0,
-    0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x1F, 0xF0, 0x01, 0xFF, 0xE0, 0xFF, 0xFC, 0x00,
-    0x57, 0xD3, 0xFB, 0xFC, 0x00, 0x07, 0xDB, 0x80, 0xFD, 0x00, 0x07, 0xEE, 0x00, 0xBE, 0x00, 0x0B,
-    0xFC, 0x00, 0xBE, 0x00, 0x0F, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x1F, 0xC0,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x90, 0xBF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFA, 0xFF, 0xD0, 0x00, 0x01, 0xF4, 0x14, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xF9, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x82, 0xE0, 0x03, 0xFF, 0xFE, 0xF0, 0x03,
-    0xF9, 0x6F, 0xFC, 0x03, 0xF4, 0x01, 0xFE, 0x01, 0xF8, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x7F,
-    0x01, 0xF8, 0x00, 0x3F, 0x80, 0xBD, 0x00, 0x2F, 0xD0, 0x2F, 0x80, 0x1F, 0xF4, 0x0B, 0xF0, 0x1F,
-    0x7C, 0x01, 0xFE, 0x7F, 0x2F, 0x00, 0x3F, 0xFF, 0x0F, 0x80, 0x07, 0xFE, 0x03, 0xE0, 0x00, 0x14,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0xFD, 0x7F, 0xFC, 0x3F, 0xE1, 0x5F, 0x8F, 0xFD, 0x00,
-    0xF5, 0xF5, 0x80, 0x1F, 0x7C, 0x00, 0x01, 0xFB, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x07, 0xE5, 0x7E, 0x03, 0xF0, 0x01,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBE, 0x0D, 0x00, 0x1F, 0x8B, 0xC0, 0x07,
-    0xC2, 0xFE, 0x47, 0xE0, 0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x1A, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xFE, 0x56, 0xF9, 0x54, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80,
-    0x00, 0x2F, 0x40, 0x38, 0x2F, 0x41, 0xF8, 0x2F, 0xEF, 0xF0, 0x2F, 0xFF, 0xC0, 0x0F, 0xFD, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x01,
-    0xFC, 0x05, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x0B, 0xF4,
-    0x00, 0x7E, 0x00, 0xBB, 0xD0, 0x81, 0xF8, 0x0B, 0xCF, 0x0F, 0x07, 0xF5, 0xFC, 0x7E, 0xF8, 0x0F,
-    0xFF, 0xC0, 0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFC, 0x00, 0x3F, 0x87, 0xFF, 0x40, 0x0B, 0xF0, 0x5B, 0xE0, 0x00, 0xFC, 0x01,
-    0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x03, 0xE0, 0x02, 0xF4, 0x02, 0xF0,
-    0x00, 0x7E, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0xFC, 0x2F,
-    0x00, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC7, 0xFF, 0x40, 0x0F, 0xD0,
-    0x03, 0xF8, 0x5B, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0x80, 0x3F,
-    0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x0B, 0xD0, 0x0B, 0xF0, 0x02, 0xF0, 0x01, 0xF8, 0x03, 0xFD, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x3D, 0x00, 0x0F, 0xC0, 0xBF, 0xE0, 0x2F, 0x00, 0x02, 0xF0,
-    0x3D, 0xF8, 0x0F, 0x40, 0x00, 0xBC, 0x2F, 0x2F, 0x0B, 0xC0, 0x00, 0x1F, 0x0F, 0x0B, 0xC3, 0xD0,
-    0x00, 0x07, 0xCB, 0x81, 0xF3, 0xE0, 0x00, 0x01, 0xFB, 0xC0, 0x7E, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFD,
-    0x03, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xEF, 0xE0, 0x2F, 0xEC, 0x00, 0x07, 0xF0, 0x7D, 0x00, 0x00,
-    0x03, 0xF4, 0xF8, 0x00, 0x00, 0x01, 0xFA, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xCF, 0xC0, 0x00, 0x00, 0x0F, 0x4B, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xF0,
-    0x00, 0x3A, 0xFC, 0x03, 0xFA, 0xF4, 0x3F, 0xF0, 0x02, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0xFE, 0x40,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00,
-    0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01,
-    0xFC, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D,
-    0x00, 0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07,
-    0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00,
-    0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x7C, 0x0B,
-    0xFF, 0xF4, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x00, 0x7F, 0xE0, 0x0E, 0x00, 0x0F, 0xC0, 0x04,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x50, 0x2F,
-    0xD0, 0x00, 0xF0, 0x7F, 0xFF, 0xFB, 0xF0, 0xFD, 0xFF, 0xFF, 0xF0, 0xB8, 0x1B, 0xFF, 0xC0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0x80,
-    0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x1F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFE, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F,
-    0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00,
-    0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x7C,
-    0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00,
-    0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7E, 0x00, 0x06, 0xFF, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x08, 0x0F, 0xFF, 0x80, 0x2E, 0x2F, 0xFF,
-    0xF4, 0xBE, 0x3E, 0x07, 0xFF, 0xFC, 0x3C, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01,
-    0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x1D, 0x00, 0x02, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B,
-    0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0xD3, 0xC1, 0xE0, 0x0F, 0xC0,
-    0xF0, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x07, 0xE0, 0x2D, 0x00, 0x02, 0xF0, 0x0B, 0x00, 0x00, 0xFC,
-    0x03, 0xC0, 0x00, 0x3F, 0x00, 0xE0, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x03, 0xF0, 0x2D, 0x00, 0x00,
-    0xFC, 0x0F, 0x00, 0x00, 0x3F, 0x83, 0xC0, 0x3C, 0x07, 0xF9, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xAB, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x7F, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x07, 0xD0, 0x00,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xFE, 0xAA, 0xAF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFC, 0x1A, 0xFF, 0xFD, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00,
-    0xF4, 0x01, 0x50, 0x0B, 0xC0, 0x2F, 0x0B, 0xFF, 0x8F, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x2F, 0x80, 0x3F, 0x40, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x0B, 0xD0, 0x00, 0x07, 0xF8, 0x1B, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x82,
-    0xFF, 0x82, 0xF0, 0x03, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x50, 0x15, 0x55, 0x47, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x2F, 0xFE, 0x00, 0x1B, 0xFE, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00,
-    0x03, 0xF4, 0x7E, 0x00, 0x00, 0x0F, 0xFF, 0x8F, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03,
-    0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x7C, 0x00, 0x0B,
-    0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x03, 0xFA, 0xFF, 0x40, 0x3D, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0xF4, 0x2F, 0xC0, 0x03, 0xC0, 0xFB,
-    0x80, 0x00, 0x07, 0x8F, 0x40, 0x00, 0x2D, 0x1F, 0x80, 0x00, 0xB4, 0x1F, 0x80, 0x02, 0xD0, 0x1F,
-    0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x1F, 0xD0, 0x1F,
-    0x00, 0x1F, 0xD0, 0x3C, 0x00, 0x0F, 0xD0, 0xF0, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0x0F, 0xCF, 0x00,
-    0x00, 0x0F, 0xB8, 0x3C, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xFE, 0x0F, 0xD0, 0x07, 0xF0, 0x2F, 0xE5,
-    0xBF, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1A, 0xE4, 0x00, 0x00, 0x05, 0x00, 0x14, 0x2F, 0xC0, 0xFD,
-    0x3F, 0xC2, 0xFD, 0x3F, 0x41, 0xFC, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7C,
-    0x00, 0x7F, 0xF4, 0x03, 0xC0, 0x3D, 0x00, 0xFF, 0xFE, 0x00, 0xB8, 0x1F, 0x00, 0xF8, 0x03, 0x80,
-    0x0F, 0x0B, 0x40, 0x7C, 0x00, 0xE0, 0x02, 0xD3, 0xC0, 0x2E, 0x00, 0x10, 0x00, 0x78, 0xF0, 0x0F,
-    0x40, 0x00, 0x00, 0x1E, 0x3C, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xCF, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xE3, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x78, 0xB4, 0x0B, 0xC0, 0x00, 0x00, 0x2D, 0x1E, 0x01, 0xFD,
-    0x00, 0x40, 0x0F, 0x03, 0xC0, 0x2F, 0xFF, 0xF0, 0x07, 0xC0, 0xB8, 0x01, 0xFF, 0xF4, 0x03, 0xD0,
-    0x0F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xFF, 0x95, 0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xC0, 0x1F, 0xFF, 0xD0,
-    0x0F, 0x41, 0xF0, 0x0B, 0x80, 0xB8, 0x03, 0xC0, 0x3D, 0x01, 0xF0, 0x0F, 0x00, 0xB8, 0x0B, 0xC0,
-    0x2E, 0x07, 0xE1, 0x0B, 0xDB, 0xB9, 0xC1, 0xFF, 0x8F, 0xE0, 0x2F, 0x43, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x14, 0x00, 0x1F,
-    0x40, 0xBC, 0x00, 0xBE, 0x03, 0xF0, 0x03, 0xF8, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F, 0x00, 0x3F, 0x82,
-    0xFC, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x0F, 0xC0,
-    0x7E, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x10, 0x01, 0x40, 0xBF, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x6F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE2, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x0F,
-    0x90, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0x06, 0xA8, 0x03, 0xC0, 0x78, 0x2F, 0xBD,
-    0x07, 0x42, 0xC0, 0x38, 0x78, 0x0F, 0x0F, 0x00, 0xE1, 0xE0, 0x2C, 0x3C, 0x03, 0xEF, 0x00, 0xB0,
-    0xE0, 0x0F, 0xF0, 0x02, 0xC3, 0xC0, 0x38, 0xF0, 0x0B, 0x0B, 0x00, 0xE1, 0xF0, 0x3C, 0x1D, 0x0F,
-    0xE1, 0xF1, 0xE0, 0x3C, 0x15, 0x41, 0x4F, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x7D, 0x00, 0x1F,
-    0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x15, 0x55, 0x42, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xE0, 0x3F, 0x47, 0xF4, 0x7C,
-    0x00, 0xFC, 0xBC, 0x00, 0x7C, 0xBC, 0x00, 0x7C, 0xBC, 0x00, 0xBC, 0x7E, 0x00, 0xF8, 0x3F, 0xEB,
-    0xF0, 0x0B, 0xFF, 0xC0, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x01, 0x55, 0xF9,
-    0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0xD1, 0xFC, 0x0B,
-    0x80, 0x2F, 0x01, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x00,
-    0x07, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xEA, 0xAA, 0x0F,
-    0xFF, 0xFF, 0x80, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xFC, 0x03,
-    0xE0, 0xBC, 0x03, 0x40, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x6F, 0xC0, 0x01, 0xFF,
-    0xE0, 0x00, 0x97, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xD0,
-    0x7F, 0xFF, 0x40, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0B, 0xC0, 0x7F, 0x03, 0xF4,
-    0x3F, 0x42, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x7D, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x07,
-    0xE0, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x02, 0xF4,
-    0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x2E, 0xF0, 0x10, 0x0F, 0xFD, 0x7F, 0x3F, 0xBD, 0x07, 0xFF, 0xFF, 0x0F, 0xFE,
-    0x02, 0xE7, 0xFE, 0x01, 0xFD, 0x00, 0xF8, 0x14, 0x00, 0x04, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x7E, 0x40,
-    0x00, 0x7F, 0xFF, 0x4F, 0x00, 0x00, 0x3F, 0xFF, 0xC3, 0xC0, 0x00, 0x2F, 0xFF, 0xF1, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFC, 0xB4, 0x00, 0x07, 0xFF, 0xFE, 0x3D, 0x00, 0x02, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
-    0xBF, 0xFF, 0xC3, 0xC0, 0x00, 0x2F, 0xFF, 0xF1, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0xB4, 0x00, 0x00,
-    0xFF, 0xFE, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xB7, 0xC3, 0xC0, 0x00, 0x00,
-    0x00, 0xF1, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0xB4, 0x00, 0x00, 0x00, 0x1E, 0x3D, 0x00, 0x00, 0x00,
-    0x0B, 0x4F, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x00, 0x00,
-    0x78, 0xF4, 0x00, 0x00, 0x00, 0x2D, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x3D, 0x00, 0x00, 0x10, 0x0F,
-    0xFD, 0x00, 0x00, 0x2E, 0x5F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x50, 0x03, 0xFC,
-    0x06, 0xFD, 0x00, 0x7C, 0x00, 0xFC, 0x03, 0xF0, 0x2F, 0xC0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBC, 0x02, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0,
-    0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x2F,
-    0xFF, 0x42, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xD0,
-    0xBC, 0x03, 0xE0, 0x1F, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x2F, 0x00, 0xFC, 0x0B, 0xC0,
-    0x7D, 0x02, 0xF0, 0x7E, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xD0, 0x01, 0x00, 0x04, 0x00, 0x03, 0xD0, 0x1F, 0x00,
-    0x01, 0xF4, 0x0B, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x2F, 0xC0, 0xFE,
-    0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0xFD, 0x0B, 0xF0, 0x03, 0xF4, 0x1F, 0xC0,
-    0x0F, 0xC0, 0x7E, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2C, 0x00, 0xBC, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00, 0xF8, 0x00, 0x00,
-    0xF8, 0x00, 0x0F, 0xFC, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x3D, 0xB8, 0x1F, 0xFF, 0x40, 0x07,
-    0xC0, 0x00, 0xF8, 0xF4, 0x3F, 0xFF, 0x40, 0x0F, 0x40, 0x03, 0xE0, 0xF4, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0xFD, 0x57, 0xF5, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x6A, 0xAB, 0xE9, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x1B, 0xA0, 0x00, 0xBC, 0x00, 0x00,
-    0xBC, 0x01, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x07, 0xF9, 0xFE, 0x00, 0xF8, 0x00, 0x03,
-    0xD0, 0x0F, 0x80, 0x3F, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x0B, 0x00, 0x3E, 0x1F, 0xFF, 0x40, 0x2F,
-    0x00, 0x00, 0x00, 0x7D, 0x3F, 0xFF, 0x40, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x55, 0x50, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0x80, 0x7C,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3A, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xC0, 0x00,
-    0x1F, 0x40, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x7C, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3D, 0x00, 0x03, 0xDB, 0x86,
-    0xBF, 0xF8, 0x00, 0x3E, 0x00, 0x03, 0xE3, 0xD1, 0xFF, 0xE0, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0xF4,
-    0x15, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x2F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF5, 0x5F, 0xD4, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x1A, 0xAA, 0xFA, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFD, 0x00, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xAF, 0xC0, 0x00,
-    0x2F, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x2F, 0x80, 0x01, 0xF8, 0x00, 0x1F,
-    0x80, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x10, 0xFF, 0xAF, 0xC1,
-    0xFF, 0xFE, 0x01, 0xFF, 0xF0, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F,
-    0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40,
-    0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07, 0xD0, 0x00,
-    0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x1B,
-    0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F,
-    0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x2F, 0x80,
-    0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02,
-    0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xCB, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x2F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xCB, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF6, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0x80, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xEA, 0xAA, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFA, 0xAA, 0xAF, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xFD, 0x00, 0x06, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xEA, 0xAB, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0xAA, 0xA8, 0x00, 0x00, 0x00,
-    0x0F, 0xEA, 0xAF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xEA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x40, 0x00,
-    0x03, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x74, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xFD, 0x55, 0xAF, 0xC0,
-    0x07, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFA, 0x5B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03,
-    0xF4, 0x00, 0x00, 0x7C, 0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xAA, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1B, 0xFA, 0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFA, 0xAA, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x04, 0x00, 0x0B,
-    0xE0, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x7F,
-    0x56, 0xAB, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFA, 0xAA, 0xFD, 0x00, 0x02, 0xF4,
-    0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xAA, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFA, 0xAA,
-    0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x04, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0x56, 0xAB, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0xBE,
-    0x00, 0x00, 0x07, 0xF0, 0x0B, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1B, 0xFA, 0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFA, 0xAA, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x04, 0x00, 0x0B,
-    0xE0, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x7F,
-    0x56, 0xAB, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x00,
-    0xBF, 0x43, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAB,
-    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x1F, 0xC0,
-    0x3F, 0x00, 0x2D, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x1F, 0x40, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xA6, 0xF8, 0x06, 0xFF, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x05,
-    0x6F, 0xD5, 0x50, 0x00, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFD, 0x0A, 0xBF, 0xEA, 0xA0, 0x00,
-    0xFD, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFD, 0x01, 0x7F, 0xF0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xD1, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x42, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00,
-    0x2F, 0x00, 0xBE, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x83, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4,
-    0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x0F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00,
-    0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00, 0x00,
-    0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0,
-    0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x8B,
-    0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F,
-    0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x02,
-    0xF0, 0x00, 0x00, 0x0B, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x8B, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00,
-    0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x28, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x24, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x95, 0x7F, 0xF0, 0x00, 0x1F, 0xE0, 0x00,
-    0x1F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00,
-    0x00, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC,
-    0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00,
-    0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD,
-    0x05, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x02, 0xF0,
-    0x00, 0x00, 0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x7D, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0x95, 0x7F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x3C, 0x1F, 0x80, 0x0F, 0xC0, 0xBE, 0x03, 0xF0, 0x02, 0xF8, 0xFC, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0xF4, 0x00, 0x3F, 0x0B, 0xD0,
-    0x0F, 0xD0, 0x2F, 0x43, 0xF4, 0x00, 0xBD, 0x0D, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x2C, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xCB, 0xC0, 0x00, 0x1F, 0xF9, 0x57, 0xFF, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x03,
-    0xFB, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0x3E, 0x07, 0xF0, 0x03,
-    0xF4, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x07, 0xF0, 0x01, 0xF8,
-    0x00, 0xBF, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x1F, 0x80, 0x00, 0xFD, 0x00,
-    0xBF, 0x07, 0xD0, 0x00, 0x1F, 0xC0, 0x0B, 0xF1, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xBD, 0x00,
-    0x00, 0x7F, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xF8, 0x00,
-    0x02, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x2F, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80,
-    0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F,
-    0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xF0,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07,
-    0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F,
-    0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x00,
-    0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07,
-    0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F,
-    0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xFD, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x81,
-    0xFF, 0x40, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00,
-    0x02, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x01, 0xF8, 0x00,
-    0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF5, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0x50, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0x07, 0xFA, 0xBF, 0xF0, 0x00, 0x0B, 0xD0, 0x07, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00,
-    0x2F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0x00, 0x7F,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xBF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0xFD, 0x54,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2E,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xFC,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xE0,
-    0x00, 0x0B, 0xD1, 0xD0, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x7E, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x01, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE,
-    0xF0, 0x00, 0xFF, 0x5B, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0,
-    0x07, 0xE0, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00,
-    0x7B, 0xD0, 0x8B, 0xF0, 0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0,
-    0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE, 0xF0, 0x00,
-    0xFF, 0x5B, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x1F, 0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00, 0x7B, 0xD0,
-    0x8B, 0xF0, 0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x03, 0xF8, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x00, 0x7E,
-    0x03, 0xE0, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE, 0xF0, 0x00, 0xFF, 0x5B,
-    0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F,
-    0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x7F,
-    0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00, 0x7B, 0xD0, 0x8B, 0xF0,
-    0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8, 0x03, 0xF8,
-    0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xB0, 0x00, 0x07,
-    0xFF, 0x4F, 0x00, 0x00, 0xF9, 0xFF, 0xF0, 0x00, 0x0F, 0x07, 0xFC, 0x00, 0x00, 0x10, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00,
-    0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01,
-    0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD,
-    0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E,
-    0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00,
-    0x01, 0x40, 0x05, 0x00, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0xFD, 0x07,
-    0xF0, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE, 0xF0, 0x00, 0xFF, 0x5B, 0xFF,
-    0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80,
-    0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x7F, 0x00,
-    0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00, 0x7B, 0xD0, 0x8B, 0xF0, 0x2F,
-    0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8, 0x03, 0xF8, 0x00,
-    0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x3C, 0x00, 0x00, 0x3D, 0x03, 0xC0, 0x00,
-    0x02, 0xF0, 0xB8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F,
-    0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC,
-    0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00,
-    0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08,
-    0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80,
-    0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x7F, 0xF4, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0xFC, 0x00, 0xBF, 0x96, 0xFF, 0x80, 0xBD, 0x02,
-    0xFC, 0x00, 0x7E, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x01, 0xF4, 0x01,
-    0xFC, 0x1F, 0x80, 0x03, 0xF0, 0x0B, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x7F, 0xC0, 0x3F, 0x00, 0x0B,
-    0xEB, 0xFD, 0x00, 0x7E, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7E, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBD,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0xFF, 0xD0, 0x00, 0x20, 0xBF, 0x03, 0xDB, 0xF0, 0x01,
-    0xF4, 0x7F, 0xAF, 0x83, 0xFD, 0x6F, 0xE0, 0x3F, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x00,
-    0xBF, 0xF8, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFC, 0x03, 0xF9, 0xBE, 0x03, 0xF0, 0x01, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x87, 0xF0, 0x01, 0xF0, 0xFF, 0x9B, 0xF4, 0x2F, 0xFF, 0xF0,
-    0x02, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xAF, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0xFC, 0x0B, 0xD0, 0x3E,
-    0x00, 0x7D, 0x0B, 0xC0, 0x0B, 0xD0, 0xF8, 0x01, 0xFC, 0x2F, 0x00, 0xBF, 0x03, 0xF0, 0x7F, 0xC0,
-    0x7F, 0xBF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00,
-    0x02, 0x07, 0xF0, 0x01, 0xF4, 0x3F, 0xE6, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0x80, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0x80, 0x1F, 0x40, 0xBC, 0x00, 0xBD, 0x03, 0xE0, 0x07, 0xF0, 0x2F,
-    0x00, 0xBF, 0x00, 0xFC, 0x1F, 0xF0, 0x07, 0xFB, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0x40,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x20, 0x1F, 0xC0, 0x07, 0xD0, 0x3F, 0xE6, 0xFE,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFE, 0xF4, 0x00, 0x0B, 0xC3, 0xF0, 0x00,
-    0xBD, 0x07, 0xC0, 0x07, 0xD0, 0x0F, 0x00, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0x80, 0x1F,
-    0x40, 0xBC, 0x00, 0xBD, 0x03, 0xE0, 0x07, 0xF0, 0x2F, 0x00, 0xBF, 0x00, 0xFC, 0x1F, 0xF0, 0x07,
-    0xFB, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x20, 0x1F, 0xC0, 0x07, 0xD0, 0x3F, 0xE6, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x7F, 0x82,
-    0xFC, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFC, 0x0B,
-    0xD0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0F, 0x80, 0x1F, 0xC0, 0x2F, 0x00, 0xBF,
-    0x00, 0x3F, 0x07, 0xFC, 0x00, 0x7F, 0xBF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x3F, 0xE6, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0xB4, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0xB8, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0xFF, 0xF4, 0x15, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B,
-    0xD0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xF0, 0x02, 0xF8,
-    0x20, 0xFD, 0x3C, 0x3F, 0xFE, 0x0F, 0xFE, 0x03, 0xFD, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x3F, 0xFD, 0x00,
-    0x15, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x82,
-    0x00, 0x3F, 0x4F, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x7E, 0xFC, 0x01, 0xF4, 0xBC, 0x03,
-    0xE0, 0x3E, 0x0F, 0x80, 0x2E, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC,
-    0x00, 0x3F, 0xFD, 0x00, 0x15, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0x82, 0x00, 0x3F, 0x4F, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xD0,
-    0x00, 0x04, 0x00, 0x00, 0x01, 0x40, 0x05, 0x02, 0xFC, 0x0F, 0xD0, 0xFF, 0x07, 0xF4, 0x3F, 0x41,
-    0xFC, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC,
-    0x00, 0x0F, 0xFF, 0x40, 0x01, 0x5F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x82, 0x00, 0x0F, 0xD3, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x08, 0x00, 0x03, 0xF8, 0x7D, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x07, 0xE7, 0xE0, 0x00, 0x0B, 0x42, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x1B, 0xFE, 0x7C, 0x00, 0xBF, 0xFF, 0xFD, 0x02, 0xFD, 0x07, 0xFD, 0x0B, 0xF0, 0x01,
-    0xFE, 0x0F, 0xC0, 0x00, 0xFE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00,
-    0xBD, 0xBE, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x01, 0xF4, 0xFD, 0x00, 0x02,
-    0xF0, 0xFD, 0x00, 0x07, 0xE0, 0xBF, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0xBF, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x2C, 0x00, 0x00, 0x7F, 0xF4, 0xF0, 0x00, 0x03, 0xE7, 0xFF, 0xC0, 0x00, 0x0F, 0x07, 0xFC,
-    0x00, 0x00, 0x04, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x0B, 0xF8, 0x07, 0xFF, 0x81, 0xFF, 0xF4, 0x05, 0x7E, 0x1F,
-    0xEF, 0xE0, 0x01, 0xF5, 0xF4, 0x2F, 0x40, 0x07, 0xDF, 0x40, 0xBD, 0x00, 0x2F, 0xB4, 0x03, 0xF0,
-    0x00, 0xFF, 0x80, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0xD0, 0x02, 0xF4, 0x00, 0xBF,
-    0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x0B,
-    0xD0, 0x82, 0xF4, 0x00, 0x3F, 0x1F, 0x0B, 0xC0, 0x00, 0xFE, 0xF8, 0x3F, 0x00, 0x03, 0xFF, 0x80,
-    0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4,
-    0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00,
-    0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4,
-    0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00,
-    0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x03,
-    0xE0, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4,
-    0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00,
-    0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x7F, 0x81, 0xC0, 0x00, 0x7F, 0xF4, 0xF4, 0x00, 0x3F, 0x3F, 0xFC, 0x00, 0x0F, 0x03, 0xFC, 0x00,
-    0x00, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xF9, 0x1F, 0xF0, 0x03, 0xF4, 0x00,
-    0xFD, 0x02, 0xF8, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x0B, 0xE0, 0xBD, 0x00, 0x02, 0xF8, 0x3F, 0x00,
-    0x00, 0xBD, 0x1F, 0xC0, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x07, 0xE0, 0xBE,
-    0x00, 0x03, 0xF4, 0x2F, 0x80, 0x02, 0xF8, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0xFF, 0x02, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x05, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xE4, 0x7F, 0xC0, 0x0F, 0xD0, 0x03, 0xF4,
-    0x0B, 0xE0, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x02,
-    0xF4, 0x7F, 0x00, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x1F, 0x82, 0xF8, 0x00,
-    0x0F, 0xD0, 0xBE, 0x00, 0x0B, 0xE0, 0x1F, 0xC0, 0x07, 0xF0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x81, 0xD0, 0x00, 0x0F, 0xFF, 0xFE, 0xF4, 0x00, 0x0F, 0xE4, 0x7F, 0xF0, 0x00, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x03, 0xFD, 0x00, 0x07, 0xF0, 0x03, 0xFF, 0x80, 0x02, 0xF4, 0x03,
-    0xEB, 0xE0, 0x00, 0xFC, 0x07, 0xD2, 0xF4, 0x00, 0x7F, 0x07, 0xD0, 0xFD, 0x00, 0x1F, 0x8B, 0xC0,
-    0x3F, 0x00, 0x0B, 0xEB, 0xC0, 0x1F, 0x80, 0x02, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x0B,
-    0xF0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x1F, 0xF8, 0x0B, 0xF4, 0x00, 0x2F, 0xBF, 0xFF, 0xF0,
-    0x00, 0x0F, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xBC,
-    0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02,
-    0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00,
-    0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8, 0x02, 0xEF, 0x42, 0x07, 0xE0, 0x2F, 0x3C, 0x3C, 0x1F, 0xD7,
-    0xF1, 0xFB, 0xE0, 0x3F, 0xFF, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x0F, 0xE0, 0x00, 0x10, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xC0, 0x00, 0xBC, 0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15, 0xFC, 0x00, 0x1F, 0x80, 0x03,
-    0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8, 0x02, 0xEF, 0x42, 0x07, 0xE0,
-    0x2F, 0x3C, 0x3C, 0x1F, 0xD7, 0xF1, 0xFB, 0xE0, 0x3F, 0xFF, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x0F,
-    0xE0, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0xF8, 0x7D, 0x00, 0x00, 0x0F,
-    0xC0, 0xF8, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x01, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xBC, 0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15,
-    0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
-    0x02, 0xF4, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8,
-    0x02, 0xEF, 0x42, 0x07, 0xE0, 0x2F, 0x3C, 0x3C, 0x1F, 0xD7, 0xF1, 0xFB, 0xE0, 0x3F, 0xFF, 0x03,
-    0xFF, 0x00, 0xBF, 0xE0, 0x0F, 0xE0, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00,
-    0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFC, 0x00, 0x0B, 0xC1, 0xFF, 0xF0, 0x00, 0x7F, 0x01, 0x5F, 0xC0, 0x01, 0xF8, 0x00,
-    0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x02, 0xFD, 0x00, 0x1F, 0x80, 0x2E, 0xF4, 0x20, 0x7E,
-    0x02, 0xF3, 0xC3, 0xC1, 0xFD, 0x7F, 0x1F, 0xBE, 0x03, 0xFF, 0xF0, 0x3F, 0xF0, 0x0B, 0xFE, 0x00,
-    0xFE, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC,
-    0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00,
-    0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0,
-    0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00,
-    0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xF4, 0x00, 0x01, 0xF4, 0xBF, 0xFC, 0x00, 0x02, 0xF2,
-    0xFA, 0xFE, 0x00, 0x03, 0xE7, 0xC0, 0xBF, 0x00, 0x03, 0xEF, 0x00, 0x7F, 0x00, 0x07, 0xFC, 0x00,
-    0x7F, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x00,
-    0x3F, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0xD0, 0x7F, 0x40, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0xFC, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xFA, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x07, 0xF4, 0x00,
-    0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x10, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0xF0,
-    0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00,
-    0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0xF4,
-    0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00,
-    0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x00,
-    0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF7, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xFA, 0xAA, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xFE, 0xAA, 0xAB, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xFF, 0x40, 0x01, 0xBF, 0xFF, 0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8,
-    0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00,
-    0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7,
-    0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4,
-    0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x24, 0x00, 0x0B, 0xD0, 0x0F, 0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0,
-    0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00,
-    0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07,
-    0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3,
-    0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01,
-    0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4,
-    0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00,
-    0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B,
-    0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0,
-    0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF,
-    0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0xC0, 0x01, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFA, 0x5B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03, 0xF4, 0x00,
-    0x00, 0x7C, 0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xAA, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFE, 0x6F, 0x80, 0x0F, 0xC0, 0x04,
-    0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x20, 0x1F, 0xC0, 0x07, 0xC0, 0x3F, 0xE6, 0xFD, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x7D, 0x00, 0x00, 0x78, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFA, 0x5B,
-    0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03, 0xF4, 0x00, 0x00, 0x7C,
-    0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xAA, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFE, 0xF4, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0xBD, 0x07,
-    0xC0, 0x07, 0xD0, 0x0F, 0x00, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFE, 0x6F, 0x80, 0x0F, 0xC0, 0x04, 0x00, 0xBC,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x20,
-    0x1F, 0xC0, 0x07, 0xC0, 0x3F, 0xE6, 0xFD, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4,
-    0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFA, 0x5B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x01,
-    0xFD, 0x00, 0x00, 0x7C, 0x03, 0xF4, 0x00, 0x00, 0x7C, 0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x0B,
-    0xFF, 0xAA, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x0F, 0xFF, 0xF0, 0x0F, 0xE6, 0xF8, 0x0F, 0xC0, 0x04, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x02, 0x1F, 0xC0, 0x07, 0xC3, 0xFE, 0x6F, 0xD0, 0xBF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x0A, 0x00, 0x00, 0x0F,
-    0x80, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xE9, 0x6F, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xC0, 0x2F, 0x80, 0x00, 0x01, 0xD0, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0x80, 0x1F, 0xF8, 0x00, 0x0B, 0xD0,
-    0x02, 0xFF, 0xEA, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x1F,
-    0x02, 0xF4, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x0B, 0xEF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFE, 0x6F, 0x80, 0x03, 0xF0, 0x01, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x02, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x3F, 0xE6, 0xFD, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x01, 0x80, 0x00, 0x00, 0x0B, 0xC0,
-    0x0F, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xA6, 0xF8, 0x06, 0xFF, 0xC0, 0x00, 0x02,
-    0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xFD, 0x00, 0x01, 0xFD, 0x01, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0xBC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0x5B, 0xFE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x7E, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x7B, 0xD0,
-    0x80, 0x00, 0xBF, 0x02, 0xF3, 0xD2, 0xD0, 0x00, 0x7F, 0xEF, 0xC3, 0xEF, 0xC0, 0x00, 0x3F, 0xFF,
-    0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xA6, 0xF8, 0x06, 0xFF, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFD,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFE, 0x05, 0x6F, 0xD5, 0x50, 0x00, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFD, 0x0A, 0xBF,
-    0xEA, 0xA0, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFD,
-    0x01, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0A, 0xAF, 0xE9, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x01, 0xB8, 0x3F, 0x00, 0x00, 0x1F, 0xFF, 0xBF, 0x00, 0x00, 0x7F, 0xEF,
-    0xFE, 0x00, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3E, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x00, 0xBE,
-    0x00, 0x7B, 0xD0, 0x80, 0xBF, 0x02, 0xF3, 0xD2, 0xD0, 0x7F, 0xEF, 0xC3, 0xEF, 0xC0, 0x3F, 0xFF,
-    0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15,
-    0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xAA,
-    0xAF, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xF0, 0x00,
-    0x0E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xAA, 0xA8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x40, 0x00, 0xBE, 0x00, 0x00, 0xF0,
-    0x00, 0x3F, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x07, 0xF5, 0x6A, 0xBF, 0x40,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x55, 0x50, 0x00,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xF0, 0x2F,
-    0x40, 0x3E, 0x00, 0x7D, 0x02, 0xF0, 0x02, 0xF4, 0x0F, 0x80, 0x1F, 0xC0, 0xBC, 0x02, 0xFC, 0x03,
-    0xF0, 0x7F, 0xC0, 0x1F, 0xEF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x80, 0x7F, 0x00, 0x1F, 0x40, 0xFF, 0x9B, 0xF8, 0x02, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x80, 0x00, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0xD6, 0xF4, 0x00, 0x00,
-    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFA, 0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xFC,
-    0x00, 0x03, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAA,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFA, 0xAA, 0x80, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x04, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x03,
-    0xE0, 0x00, 0x7F, 0x56, 0xAB, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x0C, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x2F, 0xEB,
-    0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFC, 0x0B,
-    0xD0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0F, 0x80, 0x1F, 0xC0, 0x2F, 0x00, 0xBF,
-    0x00, 0x3F, 0x07, 0xFC, 0x00, 0x7F, 0xBF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x3F, 0xE6, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAB, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x10,
-    0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80,
-    0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x03, 0xFF, 0xFC, 0x00, 0xFC, 0x0B, 0xD0, 0x3E, 0x00, 0x7D, 0x0B, 0xC0, 0x0B, 0xD0, 0xF8, 0x01,
-    0xFC, 0x2F, 0x00, 0xBF, 0x03, 0xF0, 0x7F, 0xC0, 0x7F, 0xBF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0xBF,
-    0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x07, 0xF0, 0x01, 0xF4, 0x3F, 0xE6, 0xFE,
-    0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0xAB, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE5, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xC0, 0xBD, 0x03, 0xE0, 0x07, 0xD0, 0xBC, 0x00, 0xBD, 0x0F, 0x80,
-    0x1F, 0xC2, 0xF0, 0x0B, 0xF0, 0x3F, 0x07, 0xFC, 0x07, 0xFB, 0xFE, 0x00, 0x7F, 0xFD, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x20, 0x7F, 0x00, 0x1F, 0x43, 0xFE, 0x6F,
-    0xE0, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x06, 0x40, 0x00, 0x01, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0xBE, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F,
-    0xEA, 0xAB, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x0E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAB, 0xF8, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFE, 0xAA, 0xA0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0,
-    0x00, 0x1F, 0xD5, 0xAA, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x1F, 0x02, 0xF4, 0x00, 0x0F, 0x8B,
-    0xD0, 0x00, 0x0B, 0xEF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0F, 0x80, 0x1F,
-    0xC0, 0x2F, 0x00, 0xBF, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x7F, 0xBF, 0xE0, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x1F,
-    0x40, 0x3F, 0xE6, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x3E,
-    0x00, 0x00, 0x0F, 0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE9, 0x6F, 0xFC,
-    0x00, 0xBF, 0x40, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x00, 0x03, 0xD0,
-    0x3F, 0x40, 0x00, 0x00, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x2F, 0xFF, 0xDB, 0xE0, 0x00, 0x0F, 0xFF, 0xF3, 0xF8, 0x00, 0x00, 0x5B, 0xF4, 0xBF,
-    0x00, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x7E, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xFF,
-    0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0xE5, 0xAF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xD0,
-    0x00, 0x00, 0x1F, 0x40, 0x3D, 0x00, 0x00, 0x00, 0x90, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xF4, 0x0F, 0xD9, 0x00, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x07,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x02,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFE,
-    0x7F, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x0B, 0xD0,
-    0x00, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x40, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0xFE, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0xA5, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x02, 0x00, 0x00, 0x07, 0xD0, 0x07, 0x80,
-    0x00, 0x01, 0xFE, 0x5F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE9, 0x6F, 0xFC, 0x00,
-    0xBF, 0x40, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x00, 0x03, 0xD0, 0x3F,
-    0x40, 0x00, 0x00, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x2F, 0xFF, 0xDB, 0xE0, 0x00, 0x0F, 0xFF, 0xF3, 0xF8, 0x00, 0x00, 0x5B, 0xF4, 0xBF, 0x00,
-    0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x7E, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xFF, 0x00,
-    0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0xE5, 0xAF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x34, 0x00, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00,
-    0x00, 0xBF, 0xAF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x40, 0xFD, 0x90,
-    0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x01, 0xFC, 0x0B, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE7, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x02,
-    0xFF, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x00,
-    0x02, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0xEA, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xA5, 0xBF, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x00,
-    0x00, 0x0F, 0x40, 0xFD, 0x00, 0x00, 0x03, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0xFF, 0x6F, 0x80, 0x00, 0x3F, 0xFF, 0xCF, 0xE0, 0x00, 0x01,
-    0x6F, 0xD2, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0xE0, 0x00, 0x00,
-    0xBD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xC0, 0x0B, 0xFF, 0x96, 0xBF,
-    0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF4, 0x0F, 0xD9, 0x00, 0x00, 0xBD,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0x80, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x40,
-    0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xFE, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x6A, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE9, 0x6F, 0xFC, 0x00, 0xBF, 0x40, 0x00,
-    0x3F, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x00, 0x03, 0xD0, 0x3F, 0x40, 0x00, 0x00,
-    0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xFF,
-    0xDB, 0xE0, 0x00, 0x0F, 0xFF, 0xF3, 0xF8, 0x00, 0x00, 0x5B, 0xF4, 0xBF, 0x00, 0x00, 0x00, 0xFC,
-    0x2F, 0xC0, 0x00, 0x00, 0x7E, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xFF, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0xF4, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0xE5, 0xAF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x40,
-    0xFD, 0x90, 0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x40,
-    0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x01, 0xFC,
-    0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE7, 0xFF, 0xC0, 0x00, 0x2F,
-    0xD0, 0x02, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80, 0x0B,
-    0xE0, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0xEA, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x03, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1B, 0xF4, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xE5, 0x55, 0x55, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x07, 0xF7, 0xF0, 0x00, 0x02, 0xFC, 0x1F, 0x80, 0x00, 0xBE, 0x00, 0x7C, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x7F, 0xC0, 0x01, 0xF4, 0x3F, 0xFE, 0x00, 0x2F, 0x0F, 0xEF, 0xF0, 0x03, 0xF3, 0xE0,
-    0x3F, 0x00, 0x3E, 0xB8, 0x03, 0xE0, 0x07, 0xEF, 0x00, 0x7D, 0x00, 0xBF, 0xC0, 0x0B, 0xC0, 0x0F,
-    0xF4, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0x2F,
-    0x00, 0x2F, 0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x08, 0x3F, 0x00, 0x07, 0xD2, 0xD7, 0xE0,
-    0x00, 0xBF, 0xFC, 0xBD, 0x00, 0x0B, 0xFF, 0x0F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x6F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x56, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xAF,
-    0xFA, 0x90, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x2A, 0x40, 0x01, 0xF4, 0x1F, 0xFD, 0x00, 0x2F, 0x0B, 0xFF, 0xF0, 0x03, 0xF2,
-    0xF4, 0x7F, 0x00, 0x3E, 0xBC, 0x07, 0xE0, 0x07, 0xEF, 0x00, 0x7D, 0x00, 0xBF, 0xC0, 0x0B, 0xD0,
-    0x0F, 0xF8, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x0F, 0xD0, 0x01, 0xF4, 0x01, 0xFC, 0x00,
-    0x2F, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x08, 0x3F, 0x00, 0x07, 0xD2, 0xD7,
-    0xE0, 0x00, 0xBF, 0xFC, 0xBD, 0x00, 0x0B, 0xFF, 0x0F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x02, 0xF4, 0x0D, 0x00, 0x0B, 0xFD, 0x1E, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x1E,
-    0x0F, 0xFC, 0x00, 0x0C, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x7F, 0x81, 0xC0, 0x7F, 0xF4, 0xF4, 0x3F, 0x3F, 0xFC, 0x0F, 0x03, 0xFC, 0x00, 0x40,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x57, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x0B, 0xE0, 0x80, 0x03, 0xF4, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x01, 0x55,
-    0x55, 0x02, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x3F, 0xFD, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x08, 0x00, 0x3F,
-    0x4F, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0x00, 0x0F, 0x80, 0x0E, 0x00, 0x0F, 0xE5, 0xBD,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x90, 0x7D, 0x00, 0xB4, 0x1F, 0xFB, 0xF8, 0x02, 0xFF, 0xF8,
-    0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x57, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x80, 0x03, 0xF4, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xF8,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x6F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBF, 0x54,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0xD0, 0x03, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xC0, 0x3F, 0xFD, 0x01, 0x5F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x20,
-    0x3F, 0x4F, 0x03, 0xFF, 0xE0, 0x3F, 0xF8, 0x03, 0xFE, 0x00, 0x0B, 0x80, 0x01, 0xE0, 0x00, 0x3C,
-    0x00, 0x07, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x03, 0xFF, 0xD0, 0x57, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x2F,
-    0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x83, 0xF4, 0xF0, 0xFF, 0xF8, 0x3F, 0xF8, 0x0F, 0xF4, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xD0, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x03, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x0F, 0xC0, 0x00,
-    0xBF, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x2F, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x6F, 0xE0, 0x3F, 0xFD, 0x01, 0xFF, 0xF0, 0x15, 0xFC,
-    0x00, 0x57, 0xE0, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x00, 0x1F,
-    0x40, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00,
-    0x2F, 0x82, 0x00, 0x7E, 0x00, 0x3F, 0x4F, 0x00, 0xBD, 0x00, 0x3F, 0xFE, 0x00, 0xFC, 0x00, 0x3F,
-    0xF8, 0x00, 0xFC, 0x00, 0x3F, 0xD0, 0x02, 0xF4, 0x00, 0x04, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x10, 0x0F, 0xC0, 0x00, 0x00, 0xB8, 0x7F,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x00, 0x7F,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x28, 0x03, 0xF0, 0x00,
-    0x00, 0x07, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0xF8, 0x00, 0x00, 0x0B, 0xD3, 0xF0,
-    0x00, 0x00, 0x7D, 0x07, 0xD0, 0x00, 0x07, 0xD0, 0x0B, 0x40, 0x00, 0x09, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x57, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x1E, 0x5B, 0xD0, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x00, 0x6F, 0xD0, 0x00,
-    0xFF, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x81, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xE0, 0x00, 0x00,
-    0x0F, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0xF8, 0x00,
-    0xF8, 0xBF, 0xFD, 0x00, 0xFB, 0xE0, 0xBD, 0x01, 0xFF, 0x40, 0x7D, 0x02, 0xFD, 0x00, 0xBC, 0x03,
-    0xF8, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x07, 0xD0, 0x7F, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x1F, 0x43, 0xF8, 0x00, 0x2F,
-    0x01, 0xFE, 0x00, 0x3F, 0x00, 0xBF, 0xD0, 0x3F, 0x00, 0x2F, 0xFF, 0x7D, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x3F, 0xC7, 0xFF, 0x80, 0x7F, 0xF0,
-    0x57, 0xE0, 0x7F, 0xFC, 0x01, 0xF4, 0x7E, 0x00, 0x00, 0x7C, 0x7D, 0x00, 0x00, 0x2F, 0x3D, 0x00,
-    0x00, 0x0F, 0xBD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xBE, 0xF8,
-    0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x07, 0xE0, 0xFD, 0x00, 0x42, 0xF4,
-    0x1F, 0xC0, 0xE0, 0xBC, 0x03, 0xFE, 0xF4, 0x3F, 0x00, 0x3F, 0xF8, 0x0F, 0x80, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xE0,
-    0x0B, 0xE0, 0x00, 0x0B, 0x80, 0x3F, 0x40, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x07, 0xF5,
-    0x6A, 0xAF, 0x82, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xF4, 0x03, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0,
-    0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00,
-    0x2F, 0x40, 0x00, 0x3F, 0x05, 0x00, 0x3F, 0x1E, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xF4, 0x00, 0x3F,
-    0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x6F, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x38, 0x02, 0xF8, 0x00, 0x02, 0xE0, 0x0F, 0xD0, 0x00, 0x0F, 0x40,
-    0x3F, 0x00, 0x00, 0xBC, 0x01, 0xFD, 0x5A, 0xAB, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
-    0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC1, 0x40, 0x3F, 0x1E, 0x01, 0xFF, 0xF4, 0x07,
-    0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0x7E, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0xFF,
-    0xF0, 0xBC, 0x00, 0x3F, 0xFF, 0xE0, 0xF8, 0x00, 0x06, 0xFD, 0x00, 0xF4, 0x00, 0x02, 0xF4, 0x00,
-    0xF0, 0x00, 0x03, 0xF4, 0x01, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x38, 0x00, 0xBE, 0x00, 0x00, 0xB8, 0x00, 0xFD, 0x00, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x02,
-    0xF0, 0x01, 0xFD, 0x5A, 0xAB, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x05, 0x40, 0xBC, 0x0B,
-    0xFF, 0x43, 0xE0, 0x3F, 0xFD, 0x0F, 0x00, 0x02, 0xF0, 0x78, 0x00, 0x0F, 0xC1, 0xC0, 0x00, 0x3F,
-    0x01, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x05, 0x00, 0x00, 0xFC, 0x78,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x14, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F,
-    0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x38, 0x00, 0xBE, 0x00, 0x00, 0xB8, 0x00, 0xFD, 0x00, 0x00, 0xF4,
-    0x00, 0xFC, 0x00, 0x02, 0xF0, 0x01, 0xFD, 0x5A, 0xAB, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x10, 0x03, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x03, 0xFC, 0x03, 0xE0, 0x3F, 0xC0, 0x7D, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x50,
-    0x00, 0x3F, 0x1E, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x6F, 0xD0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD1, 0xE0, 0x00, 0x00, 0x3F,
-    0xBF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x38, 0x02, 0xF8, 0x00, 0x02, 0xE0, 0x0F, 0xD0, 0x00, 0x0F, 0x40, 0x3F, 0x00,
-    0x00, 0xBC, 0x01, 0xFD, 0x5A, 0xAB, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xF9, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F,
-    0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07,
-    0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x14, 0x00, 0x3F, 0x1E, 0x00, 0x1F, 0xFF, 0x40, 0x07,
-    0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x3E, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0xCB, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0x42, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBE,
-    0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x83, 0xE0,
-    0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x07, 0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x80, 0x2F, 0xE0, 0x1F, 0xFE, 0x07, 0xFF, 0xD0, 0x15, 0xF8, 0x7F, 0xBF, 0x80, 0x07, 0xD7,
-    0xD0, 0xBD, 0x00, 0x1F, 0x7D, 0x02, 0xF4, 0x00, 0xBE, 0xD0, 0x0F, 0xC0, 0x03, 0xFE, 0x00, 0x3F,
-    0x00, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x7F, 0x40, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xD0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x2F, 0x42, 0x0B, 0xD0, 0x00,
-    0xFC, 0x7C, 0x2F, 0x00, 0x03, 0xFB, 0xE0, 0xFC, 0x00, 0x0F, 0xFE, 0x03, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xCB,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x42, 0xF8, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBE, 0x02, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x83, 0xE0, 0x00, 0x00, 0x7D,
-    0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x0B, 0xF8, 0x07, 0xFF,
-    0x81, 0xFF, 0xF4, 0x05, 0x7E, 0x1F, 0xEF, 0xE0, 0x01, 0xF5, 0xF4, 0x2F, 0x40, 0x07, 0xDF, 0x40,
-    0xBD, 0x00, 0x2F, 0xB4, 0x03, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x7E, 0x00,
-    0x1F, 0xD0, 0x02, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x01, 0xF8, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x82, 0xF4, 0x00, 0x3F, 0x1F, 0x0B, 0xC0, 0x00, 0xFE,
-    0xF8, 0x3F, 0x00, 0x03, 0xFF, 0x80, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xCB,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x42, 0xF8, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBE, 0x02, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x83, 0xE0, 0x00, 0x00, 0x7D,
-    0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x06, 0x40, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x00, 0x3D, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x00, 0x01, 0xFB, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x2F,
-    0xE0, 0x1F, 0xFE, 0x07, 0xFF, 0xD0, 0x15, 0xF8, 0x7F, 0xBF, 0x80, 0x07, 0xD7, 0xD0, 0xBD, 0x00,
-    0x1F, 0x7D, 0x02, 0xF4, 0x00, 0xBE, 0xD0, 0x0F, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0x00, 0x0F, 0xF0,
-    0x01, 0xF8, 0x00, 0x7F, 0x40, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x2F, 0x42, 0x0B, 0xD0, 0x00, 0xFC, 0x7C, 0x2F,
-    0x00, 0x03, 0xFB, 0xE0, 0xFC, 0x00, 0x0F, 0xFE, 0x03, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x01, 0xBF, 0x40, 0x2F, 0xE0, 0x1F, 0x01, 0xFF, 0xE0, 0x7F, 0xFD,
-    0x01, 0x00, 0x15, 0xF8, 0x7F, 0xBF, 0x40, 0x00, 0x00, 0x7D, 0x7D, 0x0B, 0xD0, 0x00, 0x00, 0x2F,
-    0x7D, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0xC0,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x2F, 0x02, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x3F, 0x00, 0x03,
-    0xFB, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC7,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x42, 0xF8, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBE, 0x02, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x83, 0xE0, 0x00, 0x00, 0x7D,
-    0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0xBF, 0x87,
-    0xFF, 0x81, 0xFF, 0xF4, 0x57, 0xE1, 0xFE, 0xFE, 0x01, 0xF5, 0xF4, 0x2F, 0x40, 0x7D, 0xF4, 0x0B,
-    0xD0, 0x2F, 0xB4, 0x03, 0xF0, 0x0F, 0xF8, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x7E, 0x01, 0xFD, 0x00,
-    0x2F, 0x40, 0xBF, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x07, 0xE0,
-    0x00, 0xBD, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xE0, 0x0F,
-    0x80, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x2D, 0x1F, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xE5, 0x5F, 0xFC, 0x00,
-    0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xE0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x01, 0xFF,
-    0x00, 0x02, 0xFF, 0x41, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x3F, 0x91, 0xFF, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x2F, 0x80, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0xBE,
-    0x0B, 0xD0, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x0B, 0xD1, 0xFC, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00,
-    0xFC, 0x2F, 0x80, 0x00, 0x7E, 0x0B, 0xE0, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x2F, 0x80, 0x7F, 0x00,
-    0x1F, 0xC0, 0x0F, 0xF0, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x20, 0x00,
-    0x00, 0x03, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xF5, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07,
-    0xF4, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x90, 0x00, 0x7D, 0x00, 0xB4, 0x00,
-    0x1F, 0xFB, 0xF8, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x03, 0xF9, 0x1F, 0xF0, 0x03, 0xF4, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x3F, 0x41, 0xFC, 0x00,
-    0x0B, 0xE0, 0xBD, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0xBD, 0x1F, 0xC0, 0x00, 0x3F, 0x47, 0xE0,
-    0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x02, 0xF8, 0x07,
-    0xF0, 0x01, 0xFC, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x0B,
-    0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF9,
-    0x57, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBF,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x07, 0xF0, 0xBF, 0x00,
-    0x00, 0x3F, 0x43, 0xF4, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xF4,
-    0x0F, 0x40, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x47, 0xFC, 0x00, 0x0F,
-    0xD0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x2F, 0x40, 0x00,
-    0xBE, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x3F, 0x00,
-    0xBE, 0x00, 0x01, 0xF8, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x1F, 0xC0,
-    0x07, 0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFA, 0x5B, 0xFA, 0xAA, 0xBF, 0x00, 0x0F, 0xF8,
-    0x00, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xE0, 0x0F, 0xF0, 0x00,
-    0x01, 0xF8, 0x00, 0x07, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xEA, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0x90, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x04, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x38, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x1F,
-    0x40, 0x0B, 0xFE, 0x00, 0x7F, 0xD5, 0xAA, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0x07, 0xFF, 0xF8, 0x03, 0xF9, 0x1F, 0xEB, 0xD0, 0x7F, 0x03, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xC2,
-    0xF8, 0x00, 0x3F, 0xD0, 0x07, 0xE1, 0xFC, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0xBD, 0x00, 0x02, 0xF8,
-    0x03, 0xF8, 0x3F, 0x00, 0x00, 0xBC, 0x0B, 0xF4, 0x1F, 0xC0, 0x00, 0x3F, 0x7F, 0xE0, 0x07, 0xE0,
-    0x00, 0x0F, 0xFF, 0x80, 0x02, 0xF8, 0x00, 0x07, 0xF9, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x02, 0xFF, 0x00, 0x01, 0x47, 0xF0, 0x01, 0xFF, 0xD0, 0x02, 0xF0, 0xFF, 0x02,
-    0xFF, 0xFE, 0x6F, 0xF0, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xF4, 0x07, 0xFF, 0xD0,
-    0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0x6F, 0x80, 0xBF, 0x80, 0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00,
-    0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00,
-    0x00, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0x9B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00,
-    0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xE0, 0x02,
-    0xFF, 0x4B, 0xFF, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF8, 0x0F, 0xD7, 0xFF, 0xC3, 0xFE, 0x15, 0xF8, 0xFF, 0xD0, 0x0F, 0x5F, 0x58, 0x01, 0xF7,
-    0xC0, 0x00, 0x1F, 0xB4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0x6F, 0x80,
-    0xBF, 0x80, 0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xFD,
-    0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x9B, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x00,
-    0xBD, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0x4B, 0xFF, 0xFE, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0xFD, 0x07, 0xFF, 0xC3, 0xFE, 0x01, 0x5F,
-    0x8F, 0xFD, 0x00, 0x0F, 0x5F, 0x58, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x1F, 0xB4, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x28, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00,
-    0x03, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0x6F, 0x80, 0xBF, 0x80,
-    0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0xBD,
-    0x00, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x2F,
-    0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x9B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00,
-    0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0x4B, 0xFF, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x00, 0x24, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x3F, 0x03, 0xF0,
-    0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x0F, 0xD0,
-    0x7F, 0xFC, 0x3F, 0xE0, 0x15, 0xF8, 0xFF, 0xD0, 0x00, 0xF5, 0xF5, 0x80, 0x01, 0xF7, 0xC0, 0x00,
-    0x01, 0xFB, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x01, 0xE0,
-    0x0F, 0xD0, 0x00, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x18, 0x00, 0x02, 0xFC, 0x0F, 0x00, 0x00, 0x3F, 0x07, 0xC0,
-    0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x03, 0xF0, 0x2F, 0xE4, 0x07, 0xF8, 0x07,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x01, 0xF9, 0x5F, 0x80, 0x0F, 0xC0,
-    0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x03,
-    0x40, 0x07, 0xE0, 0x2F, 0x00, 0x1F, 0x00, 0xBF, 0x91, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
-    0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF0,
-    0x00, 0xB4, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x40, 0x02, 0xFF, 0xFF, 0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0xBD, 0x00,
-    0x07, 0xC0, 0x3F, 0x00, 0x01, 0xE0, 0x0F, 0xD0, 0x00, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x18, 0x00, 0x02, 0xFC,
-    0x0F, 0x00, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x03,
-    0xF0, 0x2F, 0xE4, 0x07, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xBC, 0x0B, 0xC0, 0x0B, 0xC0, 0x0F, 0x00, 0x18, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0,
-    0x01, 0xF9, 0x5F, 0x80, 0x0F, 0xC0, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x02, 0xF8, 0x03, 0x40, 0x07, 0xE0, 0x2F, 0x00, 0x1F, 0x00, 0xBF, 0x91, 0xF8,
-    0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00,
-    0x1F, 0x40, 0xBD, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x01, 0xE0, 0x0F, 0xD0, 0x00, 0x60, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0,
-    0x18, 0x00, 0x02, 0xFC, 0x0F, 0x00, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07,
-    0xE0, 0xBE, 0x00, 0x03, 0xF0, 0x2F, 0xE4, 0x07, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x07, 0xFF, 0xF8, 0x07, 0xE5, 0x7E, 0x03, 0xF0, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0xBE, 0x0D, 0x00, 0x1F, 0x8B, 0xC0, 0x07, 0xC2, 0xFE, 0x47, 0xE0, 0x7F, 0xFF, 0xE0,
-    0x07, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xAF, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x01, 0x90, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00,
-    0x3F, 0x8F, 0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x0B, 0xF4, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0x2F, 0x40, 0x01, 0xF0,
-    0x03, 0xF0, 0x00, 0x1E, 0x00, 0x3F, 0x40, 0x01, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x18, 0x00, 0x02,
-    0xFC, 0x03, 0xC0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0xBE,
-    0x00, 0x03, 0xF0, 0x0B, 0xF9, 0x01, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x28, 0x00, 0x2E, 0x00, 0xFC, 0x00, 0x2F,
-    0x03, 0xF0, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xF9, 0x5F, 0x80, 0x03, 0xF0, 0x01, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x34, 0x00,
-    0x7E, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0xBF, 0x91, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00, 0xBE, 0x00, 0x3D, 0x3C, 0x00, 0xBD, 0x00, 0x3C, 0x3C,
-    0x00, 0xFD, 0x00, 0x3C, 0x38, 0x00, 0xFC, 0x00, 0x74, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xAF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF8, 0x56, 0xF9, 0x54,
-    0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x03,
-    0x80, 0xBD, 0x07, 0xE0, 0x2F, 0xEF, 0xF0, 0x0B, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xA0,
-    0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x7E, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00, 0xBE, 0x00, 0x3D, 0x3C, 0x00, 0xBD, 0x00,
-    0x3C, 0x3C, 0x00, 0xFD, 0x00, 0x3C, 0x38, 0x00, 0xFC, 0x00, 0x74, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x11, 0xF0,
-    0x00, 0x1F, 0x2D, 0x00, 0x03, 0xE2, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x1A, 0xFF,
-    0xFF, 0x0B, 0xFF, 0xFF, 0xE0, 0x56, 0xF9, 0x54, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x38, 0x02, 0xF4, 0x1F, 0x80, 0x2F,
-    0xEF, 0xF0, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00, 0xBE, 0x00,
-    0x3D, 0x3C, 0x00, 0xBD, 0x00, 0x3C, 0x3C, 0x00, 0xFC, 0x00, 0x3C, 0x38, 0x00, 0xFC, 0x00, 0x74,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x57, 0xF9, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xAF, 0xFA, 0x80, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00,
-    0x01, 0xAF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF8, 0x56, 0xF9, 0x54, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x5B, 0xF5, 0x54, 0xBF, 0xFF, 0xFE, 0x15, 0xFE, 0x55, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x03, 0x80, 0xBD, 0x07, 0xE0, 0x2F, 0xEF,
-    0xF0, 0x0B, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x60,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF0,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x1D, 0x00, 0x00, 0x3F, 0xF8, 0xF4, 0x00, 0x02, 0xF6, 0xFF, 0xC0, 0x00, 0x0B,
-    0x43, 0xFD, 0x00, 0x00, 0x04, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x05,
-    0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x7E,
-    0x00, 0xBB, 0xD0, 0x81, 0xF8, 0x0B, 0xCF, 0x0F, 0x07, 0xF5, 0xFC, 0x7E, 0xF8, 0x0F, 0xFF, 0xC0,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03,
-    0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9,
-    0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x02, 0xF0, 0x7F, 0xFC, 0x00, 0x1F,
-    0xC0, 0x57, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02,
-    0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00,
-    0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0xBF, 0x40,
-    0x07, 0xE0, 0x0B, 0xBD, 0x08, 0x1F, 0x80, 0xBC, 0xF0, 0xF0, 0x7F, 0x5F, 0xC7, 0xEF, 0x80, 0xFF,
-    0xFC, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x24, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0xBF, 0x5B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07,
-    0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F,
-    0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x7E, 0x00,
-    0xB4, 0x00, 0x00, 0xFF, 0xAF, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0,
-    0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x05, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F,
-    0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
-    0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFE, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0xBB, 0xD0, 0x81, 0xF8, 0x0B, 0xCF, 0x0F,
-    0x07, 0xF5, 0xFC, 0x7E, 0xF8, 0x0F, 0xFF, 0xC0, 0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xF8, 0x00, 0x04,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x2E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00,
-    0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01,
-    0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x3D, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0x1F, 0x07,
-    0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x02, 0xF0, 0x7F, 0xFC, 0x00, 0x1F, 0xC0, 0x57, 0xF0,
-    0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B,
-    0xD0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xE0, 0x0B,
-    0xBD, 0x08, 0x1F, 0x80, 0xBC, 0xF0, 0xF0, 0x7F, 0x5F, 0xC7, 0xEF, 0x80, 0xFF, 0xFC, 0x0F, 0xFC,
-    0x02, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x30, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xFC,
-    0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x02,
-    0xF8, 0x03, 0xF4, 0x00, 0x00, 0x01, 0x80, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03,
-    0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9,
-    0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x7C, 0x0B, 0xC0,
-    0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x1F,
-    0x81, 0xF8, 0x00, 0x00, 0xB8, 0x0F, 0x80, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xBC, 0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15,
-    0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
-    0x02, 0xF4, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8,
-    0x02, 0xEF, 0x42, 0x07, 0xE0, 0x2F, 0x3C, 0x3C, 0x1F, 0xD7, 0xF1, 0xFB, 0xE0, 0x3F, 0xFF, 0x03,
-    0xFF, 0x00, 0xBF, 0xE0, 0x0F, 0xE0, 0x00, 0x10, 0x00, 0x04, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD5,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x05, 0x7F, 0x00,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD,
-    0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0xBB,
-    0xD0, 0x81, 0xF8, 0x0B, 0xCF, 0x0F, 0x07, 0xF5, 0xFC, 0x7E, 0xF8, 0x0F, 0xFF, 0xC0, 0xFF, 0xC0,
-    0x2F, 0xF8, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x06, 0x40, 0x02, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0xF8,
-    0x00, 0x3F, 0xFF, 0xD0, 0x7F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xD0, 0x02, 0xF8, 0x00, 0x03,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0xFC, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x07, 0xDB, 0xD0, 0x03, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0xFC, 0xBD, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x47, 0xD0, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x7E, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x7D, 0x07, 0xE0, 0x2F, 0x00,
-    0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x3E, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x03, 0xF0, 0xBC,
-    0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xC7, 0xD0, 0x03, 0xF1,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x00, 0x02,
-    0xFB, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x90, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xBF, 0x00,
-    0x1F, 0xC0, 0x07, 0xF1, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0xFE, 0x16, 0xF8, 0x00, 0xFE, 0x00, 0x3F,
-    0x80, 0x3F, 0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x0F, 0xC0, 0x07, 0xF0, 0x02, 0xF4, 0x02, 0xF4, 0x02,
-    0xFC, 0x00, 0xBC, 0x00, 0x7E, 0x00, 0xFF, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x3F, 0xD0, 0x0F, 0x40,
-    0x03, 0xF0, 0x2F, 0xF8, 0x0B, 0xC0, 0x00, 0xBC, 0x0F, 0x7E, 0x03, 0xD0, 0x00, 0x2F, 0x0B, 0xCB,
-    0xC2, 0xF0, 0x00, 0x07, 0xC3, 0xC2, 0xF0, 0xF4, 0x00, 0x01, 0xF2, 0xE0, 0x7C, 0xF8, 0x00, 0x00,
-    0x7E, 0xF0, 0x1F, 0xBC, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x02, 0xFB, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x7D, 0x00, 0x00,
-    0x07, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFD, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x7F, 0x80,
-    0x0B, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF5, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xEF, 0x80, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x7E, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x02,
-    0xE0, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00,
-    0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00,
-    0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F,
-    0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xE0, 0x00, 0x00, 0x7F,
-    0x81, 0xFD, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xDF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x7E, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0x5F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBE, 0xAA, 0xAA, 0xFE, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB0, 0x02, 0xFC, 0x00, 0x00, 0xF0, 0x07,
-    0xF0, 0x00, 0x02, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0xEA, 0xAA, 0xAF, 0xD0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x7C, 0x0B, 0xFF, 0xF4, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x0F, 0x00, 0x7F, 0xE0, 0x0E, 0x00, 0x0F, 0xC0, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x50, 0x2F, 0xD0, 0x00, 0xF0, 0x7F, 0xFF, 0xFB,
-    0xF0, 0xFD, 0xFF, 0xFF, 0xF0, 0xB8, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBE, 0xAA, 0xAA, 0xFE, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB0, 0x02, 0xFC, 0x00, 0x00, 0xF0, 0x07,
-    0xF0, 0x00, 0x02, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0xEA, 0xAA, 0xAF, 0xD0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40,
-    0x7C, 0x0B, 0xFF, 0xF4, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x00, 0x7F, 0xE0, 0x0E, 0x00, 0x0F,
-    0xC0, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x50, 0x2F, 0xD0, 0x00, 0xF0, 0x7F, 0xFF, 0xFB, 0xF0, 0xFD, 0xFF, 0xFF, 0xF0, 0xB8, 0x1B, 0xFF,
-    0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x90, 0x00, 0x64, 0x00, 0x01, 0xF4, 0x02, 0xF8, 0x00,
-    0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xBE, 0xAA, 0xAA,
-    0xFE, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB0, 0x02, 0xFC, 0x00, 0x00, 0xF0, 0x07, 0xF0, 0x00, 0x02,
-    0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0xEA, 0xAA, 0xAF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x28, 0x00, 0x2E,
-    0x00, 0xFC, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x0B, 0xEF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x40, 0x7C, 0x0B, 0xFF, 0xF4, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x00,
-    0x7F, 0xE0, 0x0E, 0x00, 0x0F, 0xC0, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x50, 0x2F, 0xD0, 0x00, 0xF0, 0x7F, 0xFF, 0xFB, 0xF0, 0xFD, 0xFF,
-    0xFF, 0xF0, 0xB8, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x10, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xF0, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xD0, 0x0F,
-    0xC0, 0x0F, 0x40, 0x08, 0x00, 0x90, 0x0B, 0xC0, 0x7F, 0x03, 0xF4, 0x3F, 0x42, 0xF4, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xBE, 0xF8, 0x0B, 0xD3, 0xF0,
-    0x7D, 0x07, 0xD7, 0xD0, 0x0F, 0x49, 0x00, 0x04, 0x00, 0x40, 0x00, 0x0B, 0xF4, 0x2C, 0x2F, 0xFC,
-    0x7C, 0x3E, 0x7F, 0xF8, 0x3C, 0x1F, 0xF0, 0x00, 0x06, 0x40, 0x15, 0x55, 0x4F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xCB, 0xC0, 0x1F, 0x2F, 0xEB, 0xF4, 0x3F,
-    0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x0B, 0x82, 0xFC, 0x3F, 0xC3, 0xF4, 0x04, 0x00, 0x05, 0x00, 0x14,
-    0x2F, 0x80, 0xFC, 0x3F, 0x82, 0xFC, 0x3F, 0x02, 0xF8, 0x04, 0x00, 0x50, 0x01, 0x54, 0x03, 0xFF,
-    0x83, 0xF7, 0xF1, 0xF0, 0x7C, 0x34, 0x2F, 0x00, 0x2F, 0x40, 0x3F, 0x40, 0x3F, 0x00, 0x0F, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xFD, 0xBC, 0x2F, 0xF4, 0x1F, 0xF4, 0x1F, 0xF8,
-    0x3D, 0x7F, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x05, 0x00, 0x3E, 0x03, 0xD0, 0x2F, 0x82,
-    0xF8, 0x1F, 0xC1, 0xFC, 0x0F, 0xD0, 0xFD, 0x0F, 0xD0, 0xFD, 0x03, 0xC0, 0x7C, 0x00, 0x40, 0x04,
-    0x00, 0x14, 0x00, 0x61, 0xF0, 0x0B, 0xD7, 0xD0, 0xBD, 0x0F, 0xC7, 0xD0, 0x1F, 0xBE, 0x00, 0x3F,
-    0xE0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x02, 0xE0, 0xB8, 0x3F, 0x0F, 0xC3, 0xF0,
-    0xFC, 0x1F, 0x47, 0xD0, 0xF8, 0x3E, 0x03, 0xC0, 0xF0, 0x10, 0x04, 0x00, 0x15, 0x00, 0x0B, 0xFF,
-    0x80, 0xFF, 0xFF, 0x4F, 0xD0, 0xBE, 0x74, 0x00, 0xF8, 0x40, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x7D, 0x0F, 0x82, 0xF0, 0x3D, 0x0B, 0xD0, 0xFE, 0x0B, 0xF0, 0x3E, 0x00, 0x01, 0x90, 0x2F,
-    0xC0, 0x3F, 0x80, 0xFD, 0x03, 0xF0, 0x0F, 0x80, 0xBC, 0x07, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0x06,
-    0x42, 0xFD, 0x3F, 0x87, 0xE0, 0x7D, 0x07, 0xC0, 0x3D, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0xFC, 0x3D, 0x1F, 0x0B, 0x83, 0xC0, 0xE0, 0x10, 0x00, 0x06, 0xC0, 0xBE, 0x0B, 0xE0, 0xFC,
-    0x3F, 0x47, 0xC0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0x0B,
-    0x40, 0x78, 0x3F, 0x81, 0xFD, 0x7F, 0x42, 0xFC, 0x3E, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x0F, 0xF8, 0x3E, 0x7C, 0x78, 0x2D, 0x78, 0x2D, 0x7C, 0x7C, 0x2F, 0xF4, 0x06, 0x40, 0x00, 0x40,
-    0x0F, 0xC0, 0x3F, 0x40, 0xFC, 0x03, 0xE0, 0x2F, 0x02, 0xF0, 0x05, 0x00, 0x00, 0x40, 0x07, 0xF8,
-    0x06, 0xFC, 0x00, 0xBC, 0x00, 0xF8, 0x03, 0xF0, 0x2F, 0x80, 0x18, 0x00, 0x00, 0x50, 0x0E, 0x00,
-    0xF0, 0x0B, 0x40, 0x3D, 0x00, 0xF9, 0x03, 0xFF, 0x82, 0xF8, 0x00, 0x03, 0xF0, 0xF8, 0x3D, 0x1F,
-    0x0B, 0xC3, 0xF0, 0xA4, 0x00, 0x16, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xFE, 0x01, 0xFD, 0xFD, 0x1F,
-    0xC0, 0xFA, 0xF8, 0x01, 0xF1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x23, 0xD0, 0x03,
-    0x8F, 0xE5, 0xBD, 0x2F, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B,
-    0xF4, 0x2C, 0x2F, 0xFC, 0x7C, 0x3E, 0x7F, 0xF8, 0x3C, 0x1F, 0xF0, 0x00, 0x06, 0x40, 0x55, 0x55,
-    0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x0B, 0xFF, 0x80, 0xFF, 0xFF, 0x4F, 0xD0,
-    0xBE, 0x74, 0x00, 0xF8, 0x40, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x28, 0x3F, 0xC0, 0xFD, 0x7F, 0x82, 0xFD, 0x3F, 0x01, 0xFC, 0x04, 0x00,
-    0x50, 0x2A, 0x03, 0xD0, 0x7D, 0x0B, 0xE0, 0x7F, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFA, 0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00,
-    0xFC, 0x00, 0x03, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xAA, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFA, 0xAA, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x04, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00,
-    0x03, 0xE0, 0x00, 0x7F, 0x56, 0xAB, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x01, 0xFE,
-    0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00,
-    0x3D, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0xAB, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xFA, 0xAF, 0xFA, 0xAB, 0xE0, 0xF4, 0x03, 0xF4, 0x00, 0xF4, 0x3C, 0x00, 0xFC, 0x00, 0x3C, 0x0F,
-    0x00, 0x7F, 0x00, 0x0E, 0x01, 0x40, 0x1F, 0x80, 0x01, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x05, 0x40, 0x00, 0x00, 0x7F, 0x7F, 0xFF, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF9, 0x07, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0xFC, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x80, 0x0F,
-    0xD0, 0x00, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xC3, 0xFF, 0xFF, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2D,
-    0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x90, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFA,
-    0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0x02, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xB4, 0x00, 0x0B, 0xE0, 0x00, 0x14, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFA, 0x5B, 0xFE, 0x00,
-    0x7F, 0x80, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03, 0xF4, 0x00, 0x00, 0x7C, 0x0B, 0xE0,
-    0x00, 0x00, 0x74, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xAF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xAA, 0xAA, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x40, 0x3F, 0x80, 0x00, 0x02, 0xD0, 0x3F, 0xD0, 0x00, 0x03, 0xF0, 0x1F,
-    0xF4, 0x00, 0x1F, 0xE0, 0x0B, 0xFF, 0x96, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x6F,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x40, 0x02, 0xFF, 0xFF, 0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0xBD, 0x00,
-    0x07, 0xC0, 0x3F, 0x00, 0x01, 0xE0, 0x0F, 0xD0, 0x00, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x18, 0x00, 0x02, 0xFC,
-    0x0F, 0x00, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x03,
-    0xF0, 0x2F, 0xE4, 0x07, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x0F, 0xC0, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x1F, 0x40, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x28, 0x03, 0xF0, 0x00, 0x00,
-    0x7F, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x95, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x7E, 0x50,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xF0, 0x01, 0xFC, 0x00, 0x3F,
-    0x80, 0x00, 0x0F, 0x40, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x40, 0x00, 0xFC,
-    0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80,
-    0x02, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x0D, 0x2F, 0xC0, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x7F,
-    0xFC, 0x00, 0x03, 0xF9, 0x56, 0xFF, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x6F,
-    0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x95, 0x55, 0x6F,
-    0x80, 0x6F, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00,
-    0x03, 0xF4, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00,
-    0x7F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x01, 0xFD, 0x55, 0xBF,
-    0x40, 0xBF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xAA, 0xFF, 0xAA, 0xBE, 0x03, 0xD0, 0x0F, 0xD0, 0x03, 0xD0, 0x3C, 0x00,
-    0xFC, 0x00, 0x3C, 0x03, 0xC0, 0x1F, 0xC0, 0x03, 0xC0, 0x14, 0x01, 0xF8, 0x00, 0x10, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x06, 0xF9, 0x00, 0x00,
-    0x07, 0xFB, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x00,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xBD,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x01, 0xFF, 0xFF, 0x01, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF0, 0x00, 0x1B, 0xF4, 0x00,
-    0xFF, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0xFE, 0x04, 0x00, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3E, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x01,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0xBE,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3E, 0x01, 0xFC, 0x00, 0x00, 0x0B,
-    0xE0, 0x3E, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x7D,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x78, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0x4F, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00,
-    0x02, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x00,
-    0x00, 0x00, 0x2F, 0x41, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x7C,
-    0x00, 0x00, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xC0,
-    0x00, 0x6F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFE, 0x55, 0x56, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4,
-    0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xEA, 0xAB, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF5, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x1F, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x7E,
-    0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x03, 0xF0,
-    0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x55, 0xBF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xA6, 0xF8, 0x0B, 0xFC, 0x00, 0x03, 0xF4, 0x00,
-    0xFD, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x07, 0xE0, 0x00, 0xBD,
-    0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0x40, 0x1F, 0xF4, 0x00, 0x3F,
-    0x00, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00,
-    0x00, 0xFC, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x0B,
-    0xF0, 0x01, 0xFD, 0x51, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x50, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xE5,
-    0x6F, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x06, 0xFE, 0x55, 0x56, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x02, 0x80, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0xAB, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xF8, 0x00, 0x7F,
-    0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-    0x00, 0x07, 0xF4, 0x00, 0xFF, 0xFC, 0x00, 0x04, 0x1F, 0x80, 0x07, 0xE0, 0x03, 0xF8, 0x10, 0x00,
-    0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x80,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x1F, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x2F, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xBD, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFC,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x02, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x02,
-    0xFF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0x40, 0x0B, 0xFC,
-    0x00, 0x2F, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xF9, 0x5B, 0xFC, 0x00, 0xF4, 0x00, 0x7F, 0x00, 0x7C, 0x00, 0x0F, 0xD0, 0x1E, 0x00, 0x02,
-    0xF4, 0x03, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0x5B, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x83,
-    0xC0, 0x00, 0x0F, 0xD2, 0xF0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x07, 0xF4, 0x2F, 0xF4, 0x5F, 0xF8,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xD0,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0xBE, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD1, 0xF4,
-    0x00, 0xBD, 0x00, 0x00, 0x03, 0xF1, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0xF4, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x07, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0x06, 0xFD, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00,
-    0x3F, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x0F, 0x80, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x1F, 0x40,
-    0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xDF, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0xBF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF0, 0x00, 0x1B, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x02,
-    0xF4, 0x00, 0xFE, 0x04, 0x00, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x06, 0xF9, 0x5B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF4,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0x47, 0xF0,
-    0x00, 0x2F, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x7E, 0xF8, 0x00, 0x0F, 0xBF, 0x40, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00,
-    0xF8, 0xFC, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x02,
-    0xF0, 0xFC, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x03,
-    0xE0, 0xBD, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x7E, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x0F,
-    0xC0, 0x3F, 0x0F, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x40, 0x3F, 0x7C, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0x3F,
-    0x00, 0x2F, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x00, 0xBD, 0x00, 0x00, 0xBC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x95,
-    0x55, 0x56, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x8B, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00,
-    0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xEA, 0xAA, 0xBF,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xA6, 0xF8, 0x07, 0xFC, 0x00, 0x02, 0xF4,
-    0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00,
-    0x7F, 0x00, 0x0B, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x02, 0xF8,
-    0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x1F, 0xC5, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFA, 0x5B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03,
-    0xF4, 0x00, 0x00, 0x7C, 0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xAA, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00, 0xBE,
-    0x00, 0x3D, 0x3C, 0x00, 0xBD, 0x00, 0x3C, 0x3C, 0x00, 0xFD, 0x00, 0x3C, 0x38, 0x00, 0xFC, 0x00,
-    0x74, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xC0, 0x7F, 0xD0, 0x00,
-    0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xD0, 0x00, 0x00,
-    0x7F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x1F, 0x40, 0x00,
-    0x00, 0x07, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0D, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFE, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x7F, 0xE6, 0xFD, 0xBF, 0xE0, 0x01, 0xFE, 0x01, 0xF4, 0x0B, 0xF4, 0x07, 0xF0, 0x02, 0xF0, 0x02,
-    0xF8, 0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x07,
-    0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x07, 0xD0, 0x01, 0xFC, 0x3F, 0x00, 0x0B, 0xC0, 0x02, 0xF8, 0x3F,
-    0x40, 0x0F, 0xC0, 0x03, 0xF4, 0x3F, 0x80, 0x0F, 0xC0, 0x0B, 0xE0, 0x2F, 0xC0, 0x1F, 0x80, 0x2F,
-    0xC0, 0x0F, 0xF4, 0x1F, 0x42, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x90, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x00,
-    0x1F, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xBF,
-    0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xC0, 0x00, 0x6F, 0xD0, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x01, 0xFE, 0x55, 0x56, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xCB, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xE0,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xE0, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xEA, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0B, 0xFF, 0x9B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x0F, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x00, 0x6F, 0xC0, 0x02, 0xFD, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40,
-    0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x2F, 0x80, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x7F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x1F,
-    0x80, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFD, 0x55, 0x5F, 0xD5, 0x55, 0xFE, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xF0,
-    0x3F, 0xFF, 0x80, 0x00, 0x6F, 0xC0, 0x02, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x07,
-    0xE0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x02,
-    0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBD,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x01, 0xF8, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x40, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7E, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0xBD, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x40, 0x00,
-    0x01, 0xFD, 0x55, 0x5F, 0xD5, 0x55, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xAA, 0xFF, 0x40, 0x00, 0x3E, 0x00, 0xBD, 0x00, 0x00, 0x3C, 0x00, 0xFC, 0x00,
-    0x00, 0x3C, 0x00, 0xFC, 0x00, 0x00, 0x38, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF5, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xE0, 0x07, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0x0F,
-    0xC0, 0x00, 0xBE, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00, 0xBE, 0x00, 0x2F, 0x40,
-    0x00, 0xBD, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x55, 0x6F,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD4, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xF4, 0x00,
-    0x00, 0x2F, 0x80, 0x2F, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x00,
-    0x00, 0x7E, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xD0, 0x1F, 0xC0, 0x00,
-    0x01, 0xFD, 0x55, 0xBF, 0x40, 0x2F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD5,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0x80, 0x1F,
-    0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0xFC, 0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x55, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x96, 0xFF, 0xC0, 0x00, 0xF8, 0x00, 0x1F,
-    0xF0, 0x01, 0xF0, 0x00, 0x07, 0xF4, 0x01, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0xD0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x06, 0xAA, 0xAB, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xA5, 0x57, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x3C, 0x00, 0x00, 0x3F, 0x80, 0xBC, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x07, 0xFC,
-    0x00, 0xBF, 0xD1, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1B,
-    0xF4, 0x00, 0x7F, 0xE5, 0xBF, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0x02, 0xFE, 0x00, 0x00,
-    0xFD, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00,
-    0x1F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80,
-    0x03, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x0B, 0xE5, 0x5F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x03, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xF4, 0x00,
-    0x2F, 0x80, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0x95, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFA, 0xBF, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF8, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x57, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xD0, 0x00,
-    0x00, 0x2F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0xAF, 0xFD, 0x00, 0x1F,
-    0xC0, 0x00, 0xBF, 0xF4, 0x02, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF,
-    0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F,
-    0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0,
-    0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF,
-    0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xA4, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x7F, 0xF0, 0x00, 0x0B, 0xDF, 0xFF, 0xF0, 0x00, 0x3F, 0xF9, 0x1F, 0xF0, 0x01, 0xFF, 0x40, 0x1F,
-    0xC0, 0x0B, 0xF4, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x02, 0xF4, 0x03,
-    0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x01, 0xF8, 0x00,
-    0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x07, 0xF4, 0x00, 0x2F, 0xD0, 0xBF, 0x40,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0xBE, 0x03, 0xF0,
-    0x01, 0xF4, 0x2F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x7E, 0x0B, 0xC0, 0x0B, 0xF0, 0x3F, 0x5B, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0x47, 0xF4, 0x00, 0xBF, 0x2F, 0x40, 0x00, 0xFC, 0xBD, 0x00, 0x03, 0xF2,
-    0xF4, 0x00, 0x1F, 0x87, 0xF0, 0x00, 0xFC, 0x0F, 0xE0, 0x1F, 0xD0, 0x2F, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0x80, 0x7E, 0x42, 0xFC, 0x0B, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x28, 0x3F, 0x40, 0x0B, 0x83, 0xFD, 0x17, 0xF0, 0x1F,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xD0, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x02,
-    0xFE, 0x7F, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0xFE, 0x57, 0xFF, 0x03, 0xF4, 0x00, 0xBE, 0x0B, 0xD0,
-    0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x2F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x00, 0xFC, 0xBE, 0x00, 0x01, 0xF4, 0xBE, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x07, 0xE0, 0xBE, 0x00,
-    0x0F, 0xC0, 0x7F, 0x00, 0x2F, 0x40, 0x3F, 0xC0, 0xBE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF,
-    0xC0, 0x0F, 0xC0, 0xBD, 0x03, 0xE0, 0x07, 0xD0, 0xBC, 0x00, 0xBD, 0x0F, 0x80, 0x1F, 0xC2, 0xF0,
-    0x0B, 0xF0, 0x3F, 0x07, 0xFC, 0x07, 0xFB, 0xFE, 0x00, 0x7F, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x20, 0x7F, 0x00, 0x1F, 0x43, 0xFE, 0x6F, 0xE0, 0x2F, 0xFF,
-    0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0xB4, 0x00, 0x2F, 0xD0, 0x1F, 0xFF, 0x00, 0x3C, 0x00, 0x3F, 0xFC, 0x0F,
-    0xAF, 0xE0, 0x2F, 0x00, 0x3F, 0xBE, 0x0B, 0x40, 0xFC, 0x0F, 0xC0, 0x3D, 0x00, 0x01, 0x40, 0x2F,
-    0x0F, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xCB, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF3, 0xBC,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0xBB, 0x9F, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xCB, 0x8F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xD3, 0xDF, 0xB8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0xFF, 0x3D, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x7F, 0x4F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x83, 0xE0, 0x01, 0x00, 0x01,
-    0xF0, 0x0F, 0xC0, 0xFC, 0x02, 0xD2, 0xEA, 0xF4, 0x03, 0xD0, 0x2F, 0x9B, 0xF0, 0xFF, 0xF4, 0x01,
-    0xF0, 0x03, 0xFF, 0xE0, 0x2F, 0xF0, 0x00, 0xB8, 0x00, 0x7F, 0xD0, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0x41,
-    0xFD, 0x07, 0x40, 0x07, 0xE0, 0x10, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0x2B, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x15, 0x7F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F,
-    0xC3, 0x40, 0x01, 0xFC, 0xBC, 0x00, 0x3F, 0x8F, 0xE0, 0x1F, 0xF0, 0xBF, 0xFF, 0xF8, 0x02, 0xFF,
-    0xF9, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x2F, 0x07,
-    0xFF, 0xC0, 0x01, 0xFC, 0x05, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0,
-    0x00, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD,
-    0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F,
-    0xC0, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0xBB, 0xD0, 0x81, 0xF8, 0x0B, 0xCF, 0x0F, 0x07, 0xF5, 0xFC,
-    0x7E, 0xF8, 0x0F, 0xFF, 0xC0, 0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x2C, 0x00, 0x2C, 0x00,
-    0x02, 0xF0, 0x00, 0xF0, 0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x00, 0x1F, 0xE6, 0xF8, 0x00, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xC0, 0x00, 0xBC, 0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15, 0xFC, 0x00, 0x1F, 0x80, 0x03,
-    0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8, 0x02, 0xEF, 0x42, 0x07, 0xE0,
-    0x2F, 0x3C, 0x3C, 0x1F, 0xD7, 0xF1, 0xFB, 0xE0, 0x3F, 0xFF, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x0F,
-    0xE0, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x2F, 0xC7, 0xFF,
-    0x80, 0x3F, 0xF4, 0x57, 0xE0, 0x3F, 0xFC, 0x01, 0xF4, 0x3F, 0x41, 0x00, 0x7C, 0x2F, 0x00, 0x00,
-    0x2F, 0x1F, 0x00, 0x00, 0x0F, 0x8F, 0x00, 0x00, 0x03, 0xDF, 0x80, 0x00, 0x01, 0xFB, 0xF0, 0x00,
-    0x00, 0xBF, 0xBD, 0x00, 0x00, 0x3F, 0x4F, 0x80, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x07, 0xE0, 0x7E,
-    0x00, 0x42, 0xF4, 0x0F, 0xD0, 0xE0, 0xBC, 0x01, 0xFE, 0xF4, 0x3F, 0x00, 0x3F, 0xF8, 0x0F, 0x80,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xF0,
-    0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x01, 0xF0, 0x0B, 0xD0, 0x00,
-    0x02, 0xE0, 0x0F, 0xC0, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x1F, 0x80, 0x00, 0x0B,
-    0xC0, 0x2F, 0x40, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x05, 0x24, 0x7E, 0x00,
-    0x3E, 0x2E, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x3F, 0xF4, 0x00, 0x7F, 0xF4, 0x3F, 0xD0, 0x00, 0x3F,
-    0x80, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00,
-    0x00, 0xBF, 0x40, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xE0, 0x00,
-    0x07, 0xBF, 0x00, 0x3E, 0xF0, 0x00, 0x01, 0xEB, 0xC0, 0x1E, 0x7C, 0x00, 0x00, 0xB5, 0xF0, 0x0F,
-    0x2F, 0x00, 0x00, 0x3C, 0x3D, 0x0B, 0x4F, 0x80, 0x00, 0x0F, 0x0F, 0x83, 0xC3, 0xD0, 0x00, 0x07,
-    0xC3, 0xE2, 0xD1, 0xF0, 0x00, 0x01, 0xE0, 0xF8, 0xF0, 0x7C, 0x00, 0x00, 0xB4, 0x2F, 0xB4, 0x2F,
-    0x00, 0x00, 0x3C, 0x0B, 0xFC, 0x0F, 0xC0, 0x00, 0x1E, 0x02, 0xFD, 0x03, 0xE0, 0x51, 0x0F, 0x40,
-    0xBF, 0x00, 0xF8, 0xBA, 0xFF, 0xC0, 0x1F, 0x00, 0x3F, 0xFC, 0xFF, 0xD0, 0x07, 0x80, 0x0F, 0xFC,
-    0x2F, 0xD0, 0x01, 0x40, 0x03, 0xF8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF0, 0x00, 0x3E, 0x07, 0xFF, 0xC0, 0x00, 0xF8, 0x05, 0x7F, 0x00, 0x07, 0xE0,
-    0x01, 0xF8, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x0F, 0x80, 0x03, 0xFA, 0xAA, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xBE, 0x55, 0x5F,
-    0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x81,
-    0xF4, 0x00, 0x2F, 0x0F, 0x0B, 0xC0, 0x00, 0xFE, 0xF8, 0x3F, 0x00, 0x03, 0xFF, 0x80, 0xF8, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD,
-    0x1F, 0xC0, 0x00, 0xBE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD,
-    0x7E, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0,
-    0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x0B, 0xF8, 0x07, 0xFF, 0x81,
-    0xFF, 0xF4, 0x05, 0x7E, 0x1F, 0xEF, 0xE0, 0x01, 0xF5, 0xF4, 0x2F, 0x40, 0x07, 0xDF, 0x40, 0xBD,
-    0x00, 0x2F, 0xB4, 0x03, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x1F,
-    0xD0, 0x02, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01,
-    0xF8, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x82, 0xF4, 0x00, 0x3F, 0x1F, 0x0B, 0xC0, 0x00, 0xFE, 0xF8,
-    0x3F, 0x00, 0x03, 0xFF, 0x80, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x1F, 0xF0, 0x01, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x57,
-    0xD3, 0xFB, 0xFC, 0x00, 0x07, 0xDB, 0x80, 0xFD, 0x00, 0x07, 0xEE, 0x00, 0xBE, 0x00, 0x0B, 0xFC,
-    0x00, 0xBE, 0x00, 0x0F, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x90, 0xBF, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFA, 0xFF, 0xD0, 0x00, 0x01, 0xF4, 0x14, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xF9, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x03, 0xF9, 0xBE, 0x03, 0xF0,
-    0x01, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x87, 0xF0,
-    0x01, 0xF0, 0xFF, 0x9B, 0xF4, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x7F, 0xF8, 0x1F,
-    0xFF, 0x02, 0xFF, 0xD0, 0x15, 0xF8, 0x7F, 0xBF, 0x0F, 0xEF, 0xE0, 0x01, 0xF5, 0xF4, 0x3F, 0x3E,
-    0x07, 0xE0, 0x01, 0xF7, 0xD0, 0x3E, 0xB8, 0x0B, 0xD0, 0x02, 0xFB, 0x40, 0x3F, 0xF0, 0x0B, 0xC0,
-    0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x0F, 0x80, 0x07, 0xF4,
-    0x00, 0xFF, 0x00, 0x1F, 0x40, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x01, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7D,
-    0x08, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xBC, 0x3C, 0x2F, 0x00, 0x07, 0xE0, 0x00, 0xFE, 0xF8, 0x3F,
-    0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xE0, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC,
-    0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00,
-    0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0,
-    0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00,
-    0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFE, 0x7E, 0x6F, 0xF0, 0x03, 0xF8, 0x0F, 0x40, 0xFE, 0x03, 0xF4, 0x07, 0xD0, 0x0F, 0xC1,
-    0xF8, 0x01, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xBC, 0x00, 0xBD, 0x7E, 0x00, 0x3F, 0x00, 0x2F, 0x5F,
-    0x40, 0x0F, 0x80, 0x0B, 0xDB, 0xD0, 0x03, 0xE0, 0x03, 0xF2, 0xF4, 0x00, 0xF4, 0x00, 0xFC, 0xBE,
-    0x00, 0x7D, 0x00, 0xBD, 0x1F, 0xC0, 0x2F, 0x00, 0xBE, 0x03, 0xF8, 0x0B, 0xC0, 0xBF, 0x00, 0x7F,
-    0xD3, 0xF6, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x02, 0x80, 0xBC, 0x00, 0x00, 0x01, 0xFE, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x01, 0xFD, 0x03, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xEF, 0xE0, 0x2F, 0xEC, 0x00, 0x07, 0xF0,
-    0x7D, 0x00, 0x00, 0x03, 0xF4, 0xF8, 0x00, 0x00, 0x01, 0xFA, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xCF, 0xC0, 0x00, 0x00, 0x0F, 0x4B, 0xD0, 0x00, 0x00,
-    0x3E, 0x07, 0xF0, 0x00, 0x3A, 0xFC, 0x03, 0xFA, 0xF4, 0x3F, 0xF0, 0x02, 0xFF, 0xF0, 0x3F, 0xC0,
-    0x00, 0xFE, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00,
-    0x2F, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x05, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFE,
-    0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0xBB, 0xC1, 0xC1, 0xF8, 0x0B, 0xDF, 0x1F, 0x07,
-    0xF5, 0xFC, 0x7F, 0xF8, 0x0F, 0xFF, 0xC1, 0xFE, 0xD0, 0x2F, 0xF8, 0x03, 0xDB, 0x40, 0x04, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xF4, 0xBF, 0xF8, 0x00, 0x3F, 0x01, 0x5F, 0x40, 0x07,
-    0xE0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x07, 0xF8, 0x00, 0x3F, 0xEB, 0xFF, 0x40, 0x01, 0xFF, 0xFB, 0xF0,
-    0x00, 0x02, 0xA8, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x08, 0x00, 0x00,
-    0x0B, 0xD3, 0xC0, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x02, 0xF0,
-    0x00, 0xB8, 0x7F, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x81, 0x5F, 0xC0, 0x07, 0xE0, 0x03, 0xF4, 0x00,
-    0xFC, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC,
-    0x00, 0x7D, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFC, 0x00,
-    0x7D, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0xFD,
-    0x00, 0x7F, 0x00, 0x1F, 0x80, 0x2F, 0xC0, 0x0F, 0xF0, 0x01, 0xF4, 0x07, 0xFC, 0x02, 0xEF, 0x01,
-    0x2F, 0x41, 0xFB, 0xC0, 0xB6, 0xF1, 0xF2, 0xFD, 0xBC, 0xBE, 0x7E, 0x2F, 0xBD, 0x1F, 0xFF, 0x07,
-    0xFF, 0xC2, 0xFF, 0x40, 0xBF, 0x80, 0x3F, 0xE0, 0x1F, 0xD0, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x02, 0xF0, 0x00, 0xB8, 0x7F, 0xFC,
-    0x00, 0x3F, 0x00, 0x2F, 0x81, 0x5F, 0xC0, 0x07, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0xBD, 0x00,
-    0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x3F,
-    0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x3F, 0x00,
-    0x1F, 0x80, 0x0B, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x1F,
-    0x80, 0x2F, 0xC0, 0x0F, 0xF0, 0x01, 0xF4, 0x07, 0xFC, 0x02, 0xEF, 0x0A, 0x2F, 0x41, 0xFB, 0xC0,
-    0xB6, 0xF1, 0xE2, 0xFD, 0xBC, 0xBE, 0x7E, 0x2F, 0xBD, 0x1F, 0xFF, 0x07, 0xFF, 0xC2, 0xFF, 0xC0,
-    0xBF, 0x80, 0x3F, 0xE0, 0x0F, 0x3C, 0x00, 0x40, 0x00, 0x10, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0,
-    0xB9, 0x55, 0x6F, 0x80, 0xF8, 0x00, 0x7D, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x38, 0x0B, 0xC0, 0x00,
-    0x00, 0x1F, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0xAB, 0xFC, 0x00, 0xF4, 0x00, 0xFC,
-    0x02, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x01, 0xF8,
-    0x02, 0xF8, 0x07, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0xFC, 0x05, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00,
-    0x00, 0x7D, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF4, 0x01, 0xF1, 0xAA, 0x00, 0x0F, 0xC0, 0x0B, 0xFF,
-    0xFF, 0x40, 0x3F, 0x00, 0x3F, 0xE6, 0xFF, 0x01, 0xF8, 0x00, 0xF4, 0x00, 0xFD, 0x0B, 0xD0, 0x07,
-    0xD0, 0x02, 0xF4, 0x2F, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xF0,
-    0x82, 0xF0, 0x01, 0xF8, 0x1F, 0x8B, 0x47, 0xE0, 0x1F, 0xC0, 0x7F, 0xFC, 0x0F, 0xFF, 0xFC, 0x02,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x05, 0x6F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x6A, 0x80, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xE9, 0x7F, 0xC0, 0x7D, 0x00, 0x3F, 0x42, 0xF0, 0x00, 0x7D, 0x0F, 0xC0, 0x01, 0xF4, 0x3F,
-    0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x3F, 0x02, 0xF8, 0x07, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0xFD, 0x07, 0xF8, 0x07, 0x80, 0x07, 0xF0, 0x08, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xBD, 0x00, 0x1A, 0xAB, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0x55, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0xA0, 0x00, 0x3F, 0x07, 0xC0, 0x02, 0xF8, 0x2F, 0xD0,
-    0x2F, 0xC0, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x06, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0,
-    0x15, 0xF8, 0x00, 0xFF, 0x47, 0xFC, 0x01, 0xF8, 0x03, 0xF8, 0x00, 0xFC, 0x02, 0xF4, 0x0B, 0xE0,
-    0x00, 0xFD, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x2F, 0x80, 0x00, 0xBD, 0x03, 0xFA,
-    0xBF, 0x00, 0x00, 0xBD, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x0B, 0xEA, 0xBE, 0x00, 0x00, 0xFC,
-    0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x7F, 0x00,
-    0x0B, 0xE0, 0x1F, 0x40, 0x3F, 0x00, 0x1F, 0xC0, 0x2F, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x3F, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFD,
-    0x00, 0xF8, 0x00, 0x3F, 0x40, 0x1F, 0x40, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x7E, 0x00, 0x3F, 0x00,
-    0x07, 0xF0, 0x03, 0xE0, 0x00, 0x3F, 0x80, 0x7D, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x02, 0xF4, 0x1F, 0x01, 0x00,
-    0x7F, 0x02, 0xF1, 0xF3, 0xAF, 0xC0, 0x3F, 0xBD, 0x7F, 0xF4, 0x03, 0xFF, 0x43, 0xFC, 0x00, 0x2F,
-    0xC0, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0xFC,
-    0x00, 0xFC, 0x0B, 0xD0, 0x3E, 0x00, 0x7D, 0x0B, 0xC0, 0x0B, 0xD0, 0xF8, 0x01, 0xFC, 0x2F, 0x00,
-    0xBF, 0x03, 0xF0, 0x7F, 0xC0, 0x7F, 0xBF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0xBF, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x07, 0xF0, 0x01, 0xF4, 0x3F, 0xE6, 0xFE, 0x02, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x3F, 0x81, 0xFC,
-    0x00, 0x7F, 0x82, 0xFC, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0F, 0x80, 0x1F, 0xC0,
-    0x2F, 0x00, 0xBF, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x7F, 0xBF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x1F, 0x40,
-    0x3F, 0xE6, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0A, 0xBF, 0xAF, 0xE0, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0x06, 0xE0, 0x02, 0xF0, 0x7F, 0xFC,
-    0x03, 0xF1, 0xFF, 0xFC, 0x03, 0xE7, 0xE0, 0xFD, 0x07, 0xEF, 0x40, 0xBD, 0x0B, 0xFC, 0x00, 0xBE,
-    0x0F, 0xF4, 0x00, 0xBE, 0x0F, 0xF0, 0x00, 0xBD, 0x1F, 0xD0, 0x00, 0xBD, 0x1F, 0xC0, 0x00, 0xFD,
-    0x2F, 0x40, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x02, 0xF4,
-    0xBD, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x07, 0x41, 0xFC, 0x00, 0x0F, 0xEB, 0xF0, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x2F,
-    0xFF, 0xF8, 0x07, 0xE4, 0x6F, 0xC0, 0xB0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xE0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x02, 0x43, 0xF4, 0x00, 0xB8, 0x3F, 0xD1, 0xBF, 0x01,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x2F, 0xFF, 0xE0, 0x0F, 0xE9, 0xBD, 0x03, 0xF0, 0x00, 0x80, 0xBC, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x40, 0x7E, 0x55, 0x50,
-    0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x28, 0x7F, 0x00, 0x1F, 0x83, 0xFE,
-    0x6F, 0xF0, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x07, 0xE5, 0x7E, 0x03, 0xF0, 0x01, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBE, 0x0D, 0x00, 0x1F, 0x8B, 0xC0, 0x07, 0xC2, 0xFE, 0x47,
-    0xE0, 0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFC,
-    0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xC0, 0x3F, 0xFD, 0x01, 0x5F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02,
-    0xF8, 0x20, 0x3F, 0x4F, 0x03, 0xFF, 0xE0, 0x3F, 0xF8, 0x03, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x01,
-    0x40, 0x05, 0x02, 0xFC, 0x0F, 0xD0, 0xFF, 0x07, 0xF4, 0x3F, 0x41, 0xFC, 0x01, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x01,
-    0x5F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x2F, 0x82, 0x00, 0x0F, 0xD3, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x01, 0x5F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x04,
-    0x03, 0xF0, 0x00, 0x07, 0x96, 0xF4, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x3F, 0x04, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xF4,
-    0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7C, 0x02, 0xF0, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x0F, 0x40, 0x3F, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0xC2, 0x47, 0xE0, 0x03,
-    0xF0, 0x03, 0xE0, 0xFF, 0xF0, 0x00, 0xFD, 0x03, 0xF0, 0x3F, 0xF4, 0x00, 0x1F, 0xFF, 0xF4, 0x0F,
-    0xF4, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x50, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xC0, 0x03, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x7D, 0x00, 0x01, 0x5F, 0xC0, 0x0B,
-    0xC0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x01,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xFA, 0xAB, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xE5, 0x5B, 0xE0, 0x0F, 0xD0, 0xFC, 0x00, 0x7D, 0x00, 0xBD, 0x0F, 0xC0,
-    0x0B, 0xC0, 0x07, 0xD0, 0xF8, 0x00, 0xBC, 0x00, 0xBC, 0x1F, 0x40, 0x0B, 0xD0, 0x0F, 0xC2, 0xF0,
-    0x00, 0x7E, 0x02, 0xF4, 0x3F, 0x00, 0x03, 0xFF, 0xFD, 0x03, 0xE0, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xAB, 0xFA, 0xFE, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x01, 0xF4, 0x02, 0xE4, 0x00, 0x2F, 0x02, 0xFF, 0xD0, 0x03, 0xF0, 0xFF, 0xFE, 0x00,
-    0x3E, 0x3F, 0x07, 0xE0, 0x07, 0xDB, 0x80, 0x7E, 0x00, 0xBD, 0xF0, 0x0B, 0xD0, 0x0F, 0xFC, 0x00,
-    0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xC0, 0x1F, 0xE0, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0x2F, 0x00, 0x2F,
-    0x80, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x08, 0x3F, 0x00, 0x07, 0xD2, 0xD7, 0xE0, 0x00, 0xBF,
-    0xFC, 0xBD, 0x00, 0x0B, 0xFF, 0x0F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x0B, 0xF1, 0xFF, 0xE0,
-    0x0F, 0xFD, 0x15, 0xF8, 0x0F, 0xFF, 0x00, 0x7D, 0x0F, 0xD0, 0x40, 0x1F, 0x0B, 0xC0, 0x00, 0x0B,
-    0xC7, 0xC0, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00,
-    0x2F, 0xEF, 0x40, 0x00, 0x0F, 0xD3, 0xE0, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x01, 0xF8, 0x1F, 0x80,
-    0x10, 0xBD, 0x03, 0xF4, 0x38, 0x2F, 0x00, 0x7F, 0xBD, 0x0F, 0xC0, 0x0F, 0xFE, 0x03, 0xE0, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xBC, 0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15,
-    0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
-    0x02, 0xF4, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8,
-    0x02, 0xEF, 0x42, 0x07, 0xE0, 0x2F, 0x3C, 0x3C, 0x1F, 0xD7, 0xF1, 0xFB, 0xE0, 0x3F, 0xFF, 0x03,
-    0xFF, 0x00, 0xBF, 0xE0, 0x0F, 0xE0, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x28, 0x00, 0x38, 0x00, 0x00, 0xFC, 0x00, 0x74, 0x00,
-    0x00, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0xBF, 0x9F, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0,
-    0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00,
-    0x7E, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC,
-    0x00, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00,
-    0x00, 0x3E, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00,
-    0x2E, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xF0, 0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x05, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
-    0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0xBB, 0xD0, 0x81, 0xF8, 0x0B, 0xCF,
-    0x0F, 0x07, 0xF5, 0xFC, 0x7E, 0xF8, 0x0F, 0xFF, 0xC0, 0xFF, 0xC0, 0x2F, 0xF8, 0xA3, 0xF8, 0x00,
-    0x04, 0x03, 0x41, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x1F, 0x41, 0xFC, 0x02, 0xF0, 0x7C, 0x07, 0xE0, 0x07, 0xC2, 0xD0, 0x2F, 0x80, 0x2D,
-    0x07, 0x00, 0xFD, 0x00, 0x50, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xE5, 0x5B, 0xFC, 0x00, 0x3F, 0x00,
-    0x03, 0xF8, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x2F, 0x40, 0x00, 0x7F,
-    0x00, 0xFD, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0xBF,
-    0x55, 0x6F, 0xE0, 0x2F, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0xFF, 0x81,
-    0xFF, 0xE0, 0x00, 0x05, 0x7E, 0x1F, 0xBF, 0x80, 0x00, 0x01, 0xF5, 0xF0, 0x7E, 0x00, 0x00, 0x07,
-    0xDF, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x3E, 0x04, 0x00,
-    0x03, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xD0, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0x00, 0x2F, 0x00,
-    0x7F, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xF0, 0x7E, 0x00, 0x0F,
-    0x80, 0x0F, 0xC2, 0xF4, 0x00, 0x3F, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0xFD, 0x03, 0xF0, 0x3F, 0x00,
-    0x01, 0xFF, 0xFF, 0x40, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00,
-    0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x1F,
-    0xEA, 0xAA, 0xAA, 0xAB, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFD, 0x55, 0x55, 0x55, 0x7F,
-    0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00,
-    0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x07, 0xFE, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xFE, 0x02, 0xFC,
-    0x03, 0xF4, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x3F,
-    0x3F, 0xAA, 0xAA, 0xBF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7E, 0x55, 0x55, 0xBD, 0xBC, 0x00, 0x00, 0xFC,
-    0xBC, 0x00, 0x01, 0xF8, 0xBD, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x7F, 0x40,
-    0x1F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0xFF, 0xE0, 0x00, 0x1F, 0xFD, 0x07, 0xFD,
-    0x00, 0x00, 0x3F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x18, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x00,
-    0x02, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFD, 0x7F, 0xFC, 0x00, 0x07,
-    0xFE, 0x16, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0xBD, 0x00,
-    0x00, 0xFC, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0x00,
-    0xBC, 0x0F, 0x00, 0x00, 0x00, 0xBC, 0x2E, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x7C,
-    0xF0, 0x00, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x07, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xEF, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0x83,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0x80, 0x7F, 0x00,
-    0x00, 0x02, 0xF8, 0x0F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x1F, 0x40, 0x0B, 0xD0, 0x00, 0x00,
-    0x3F, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xDF, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x2C, 0x00,
-    0x2C, 0x00, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x00, 0x1F, 0xE6, 0xF8, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xBC, 0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15, 0xFC, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00,
-    0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8, 0x02, 0xEF, 0x46,
-    0x07, 0xE0, 0x2F, 0x3C, 0x3D, 0x1F, 0xD7, 0xF1, 0xFB, 0xF0, 0x3F, 0xFF, 0x03, 0xFF, 0xC0, 0xBF,
-    0xE0, 0x0F, 0xFD, 0x00, 0x10, 0x00, 0x05, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x06, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xD5, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x2F, 0x80, 0x1F, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x55, 0xBF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x6A, 0x90, 0x0B, 0xFF,
-    0xFF, 0x80, 0xFF, 0x96, 0xFD, 0x0F, 0x80, 0x07, 0xF0, 0xF4, 0x00, 0x3F, 0x1F, 0x40, 0x03, 0xF1,
-    0xF4, 0x00, 0x3E, 0x1F, 0x40, 0x0B, 0xC1, 0xFC, 0x02, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xA6, 0xF8, 0x07, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFE, 0x00, 0x03,
-    0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0,
-    0x40, 0x7E, 0x00, 0x0F, 0xD1, 0xD0, 0xFD, 0x00, 0x0F, 0xC1, 0xF2, 0xFC, 0x00, 0x0F, 0xC0, 0xFF,
-    0xF0, 0x00, 0x1F, 0xC5, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xAF, 0x00,
-    0x00, 0x3F, 0x00, 0x0F, 0x40, 0x00, 0x7F, 0x00, 0x07, 0x80, 0x00, 0x7E, 0x00, 0x02, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xD0, 0x1F, 0xF0, 0x01, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x57, 0xD3, 0xFB,
-    0xFC, 0x00, 0x07, 0xDB, 0x80, 0xFD, 0x00, 0x07, 0xDE, 0x00, 0xBE, 0x00, 0x0B, 0xFC, 0x00, 0xBE,
-    0x00, 0x0F, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00,
-    0x2F, 0x80, 0x01, 0xFC, 0x00, 0x2F, 0x03, 0x42, 0xF4, 0x00, 0x3F, 0x0B, 0xC3, 0xF0, 0x00, 0x3E,
-    0x03, 0xCB, 0xD0, 0x00, 0x7D, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0x91, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xFA, 0xFF, 0xFC, 0x00, 0x01, 0xF4, 0x14, 0x3D, 0x00, 0x02, 0xF4, 0x00, 0x1F,
-    0x00, 0x03, 0xF0, 0x00, 0x08, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xF9, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xEA, 0xAA, 0xA0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xBF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xE0, 0x01, 0x5F, 0xD5, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x75, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x50, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x56, 0xFD, 0x55, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0A, 0xBF, 0xEA, 0xA0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x7E, 0x42, 0xFC, 0x0B, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xFC, 0x00, 0x40, 0x2F, 0x80, 0x1F, 0x4F, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xFC,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0xFE, 0x0F, 0x40, 0x1F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x28, 0x3F,
-    0x40, 0x0B, 0x83, 0xFD, 0x17, 0xF0, 0x1F, 0xFF, 0xFD, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xEA, 0xAB,
-    0xF0, 0x00, 0x0B, 0xD0, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0x0F,
-    0x00, 0x00, 0x7F, 0x00, 0x01, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x15, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x2F, 0xE4, 0x1F, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xE0,
-    0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x80,
-    0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x0B,
-    0xFF, 0xF4, 0x00, 0x7F, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xB4, 0x1F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x06, 0xFD, 0x57, 0xF0, 0x01, 0xF8, 0x02, 0xE0, 0x02,
-    0xF4, 0x01, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07,
-    0xE7, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0x6F, 0xFC, 0x0F, 0xC0, 0x02, 0xFC, 0x0F,
-    0x80, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0xFD, 0x2F, 0x40, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0xFD, 0x3E,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0B, 0xD0, 0x02, 0xC0, 0x2F, 0x80, 0x03, 0xFA, 0xFE, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00,
-    0xAA, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xF8, 0x00,
-    0x7F, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFC, 0x00, 0x0F,
-    0xFF, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0xFC, 0x00, 0x04, 0x1F, 0x80, 0x07, 0xE0, 0x03, 0xF8, 0x10,
-    0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F,
-    0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x1F, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x2F, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xBD, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0x02, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0x40, 0x0B,
-    0xFE, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0xB4, 0x00, 0x2F, 0xD0, 0x1F, 0xFF, 0x00, 0x3C, 0x00, 0x3F, 0xFC,
-    0x0F, 0xAF, 0xE0, 0x2F, 0x00, 0x3F, 0xBE, 0x0B, 0x40, 0xFC, 0x0F, 0xC0, 0x3D, 0x00, 0x01, 0x40,
-    0x2F, 0x0F, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xCB, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF3,
-    0xBC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBB, 0x9F, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xCB, 0x8F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xDF, 0xB8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0xFF, 0x3D, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x7F, 0x4F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x83, 0xE0, 0x03, 0x40,
-    0x01, 0xF0, 0x0F, 0xC0, 0xFC, 0x03, 0xD2, 0xEA, 0xF4, 0x03, 0xD0, 0x2F, 0x9B, 0xF0, 0xFF, 0xF4,
-    0x01, 0xF0, 0x03, 0xFF, 0xF8, 0x2F, 0xF0, 0x00, 0xB8, 0x00, 0x7F, 0x9E, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xF9, 0x5B,
-    0xFC, 0x00, 0xF4, 0x00, 0x7F, 0x00, 0x7C, 0x00, 0x0F, 0xD0, 0x1E, 0x00, 0x02, 0xF4, 0x03, 0x40,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0x5B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x83, 0xC0, 0x00, 0x0F,
-    0xD2, 0xF0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x07, 0xF4, 0x2F, 0xF4, 0x5F, 0xF8, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x17, 0xD0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x04, 0x0F, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x3F,
-    0x41, 0xFD, 0x07, 0x40, 0x07, 0xE0, 0x10, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4,
-    0x00, 0x2B, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x15, 0x7F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x0F, 0xC3, 0x40, 0x01, 0xFC, 0xBC, 0x00, 0x3F, 0x8F, 0xE0, 0x1F, 0xF0, 0xBF, 0xFF, 0xF8, 0x02,
-    0xFF, 0xF9, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xD6, 0xE0,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF0, 0x00,
-    0x1B, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0xFE, 0x04, 0x00, 0x00, 0xFD, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x02,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x00, 0x2F, 0xC7, 0xFF, 0x80, 0x3F, 0xF4, 0x57, 0xE0, 0x3F, 0xFC, 0x01,
-    0xF4, 0x3F, 0x41, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x0F, 0x8F, 0x00, 0x00,
-    0x03, 0xDF, 0x80, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0xBF, 0xBC, 0x00, 0x00, 0x3F, 0x4F, 0x80,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0xD2, 0xF4, 0x0F, 0xD0, 0xF8, 0xBC, 0x02,
-    0xFE, 0xFC, 0x3F, 0x00, 0x3F, 0xFF, 0x0F, 0x80, 0x07, 0xF7, 0xC0, 0x00, 0x00, 0x10, 0xF0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x03, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x6F, 0x80,
-    0x00, 0x3F, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x40, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x3C, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xD3,
-    0x83, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x74, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0x4F, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0xE3, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x1E, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF1, 0xD0, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x2C, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xE2, 0x80, 0x3F, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xE0, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE0, 0x00, 0x1F, 0xC7, 0xFF, 0x80, 0x02, 0xFF, 0x45, 0x7E, 0x00, 0x2F, 0xFC, 0x01,
-    0xF4, 0x01, 0xF4, 0x10, 0x07, 0xC5, 0x0F, 0x40, 0x00, 0x2F, 0x38, 0xF4, 0x00, 0x00, 0xF9, 0xD7,
-    0x80, 0x00, 0x03, 0xEB, 0xBC, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xBC, 0xF7, 0xD0, 0x00,
-    0x03, 0xF3, 0x8F, 0xC0, 0x00, 0x0F, 0x9D, 0x2F, 0x40, 0x00, 0x7E, 0x10, 0x3F, 0x00, 0x82, 0xF4,
-    0x00, 0xBD, 0x0B, 0x0B, 0xC0, 0x00, 0xFE, 0xF8, 0x3F, 0x00, 0x02, 0xFF, 0xC0, 0xF8, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF0, 0x00, 0x1B, 0xF4, 0x00, 0xFF, 0xF8,
-    0x00, 0x02, 0xF4, 0x00, 0xFE, 0x04, 0x00, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xFF, 0xF4,
-    0x7D, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3E, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x00,
-    0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0xBF, 0xFF, 0x41, 0xFC, 0x3F, 0xFF, 0xC1, 0xFF, 0x40, 0x3E, 0x02, 0xFF, 0xC0, 0x0F,
-    0x41, 0xF4, 0x10, 0x07, 0xC1, 0xF0, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00,
-    0x3D, 0xF8, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x0B, 0xFB, 0xD0, 0x00, 0x03, 0xF4, 0xF8, 0x00,
-    0x00, 0xFC, 0x2F, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x04, 0x2F, 0x40, 0xFD, 0x0E, 0x0B, 0xC0, 0x1F,
-    0xEF, 0x43, 0xF0, 0x03, 0xFF, 0x80, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFC, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xC3, 0xFA, 0xAF, 0xF4, 0x00, 0xFF, 0xF8, 0x3E, 0x00, 0xFD, 0x00, 0x3F, 0x41, 0x03,
-    0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x3C, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x03, 0x80, 0x1F, 0xC0,
-    0x3E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x3F, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x1F, 0xD3, 0xFF, 0xFC, 0x01, 0xFF,
-    0xAE, 0x42, 0xF0, 0x2F, 0xFD, 0xF8, 0x0F, 0x81, 0xF8, 0x13, 0xF0, 0x3D, 0x1F, 0x40, 0x03, 0x81,
-    0xF0, 0xF4, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0xFB, 0xF4,
-    0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x80, 0x0F, 0x80, 0xBE, 0x0B, 0x00, 0x7D, 0x00, 0xFF, 0xF8, 0x02, 0xF4,
-    0x01, 0xFF, 0xC0, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xD0, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x56, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x3E,
-    0x07, 0xFF, 0xC0, 0x00, 0xF8, 0x05, 0x7F, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x2F, 0x40, 0x07,
-    0xD0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x03, 0xFA, 0xAA,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xBE, 0x55, 0x5F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0xD1, 0xF4, 0x00, 0x2F, 0x0F, 0x4B, 0xC0,
-    0x00, 0xFE, 0xFC, 0x3F, 0x00, 0x03, 0xFF, 0xE0, 0xF8, 0x00, 0x0B, 0xE7, 0x80, 0x00, 0x00, 0x04,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x6F, 0xD0, 0x00, 0x02, 0xFE, 0xAB, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0xBC, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x95, 0x55, 0x56, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF0, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x85, 0x7F, 0x00,
-    0x07, 0xE5, 0x6E, 0x01, 0xF8, 0x00, 0x2F, 0x40, 0xF4, 0x07, 0xD0, 0x00, 0xFC, 0x0F, 0xC0, 0x2F,
-    0x00, 0x03, 0xF0, 0x3D, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFA, 0xAA, 0xFD, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBE, 0x55, 0x5F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x80, 0x01, 0xF4, 0x00, 0x2F,
-    0x0F, 0x00, 0x0B, 0xC0, 0x00, 0xFE, 0xF8, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xF8, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAB,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x01, 0x54, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xD6, 0xFF, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0x80, 0x00, 0x1F, 0xF9, 0x06, 0xFF, 0x40, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x82, 0xFF, 0xFD, 0x02,
-    0xFF, 0xFE, 0x00, 0x03, 0xF4, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x80, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x1F, 0xFF, 0x40, 0x00, 0x01, 0x5F, 0x87, 0xFB,
-    0xF8, 0x00, 0x00, 0x01, 0xF5, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x1F, 0x7D, 0x02, 0xF4, 0x00, 0x00,
-    0x02, 0xFB, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xF1, 0xBE, 0x00, 0x03, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0x40, 0x07, 0xFF, 0xBF, 0xF4, 0x0B, 0xF0, 0x00, 0xBE, 0x00, 0x3F,
-    0xC0, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFD, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xE1, 0xF8, 0x00,
-    0x1F, 0x80, 0x00, 0xBE, 0x2F, 0x40, 0x02, 0xF4, 0x00, 0x0B, 0xE2, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0xBE, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2D, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFA, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x06, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xFF,
-    0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x7F, 0x40, 0x0F, 0xD0, 0x0F, 0xD0, 0x3F, 0x80,
-    0x07, 0xE0, 0x02, 0xF8, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xBE, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x2F,
-    0x83, 0xF4, 0x00, 0xBE, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0xBF, 0x00, 0x0F,
-    0xC0, 0x00, 0xFD, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x82,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x1F, 0xD0, 0x02, 0xF8,
-    0x03, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0xBF, 0x40, 0x0F, 0xD3, 0xF8, 0x00, 0x0F,
-    0xF4, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0x90, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xAA, 0xF0, 0x00, 0x7F, 0xFF, 0x9B, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xF9, 0x06, 0xE4, 0x00, 0x7F, 0x00,
-    0xFF, 0xF4, 0x07, 0xF0, 0x0F, 0x83, 0xF0, 0x3F, 0x00, 0xFC, 0x07, 0xD2, 0xF4, 0x07, 0xD0, 0x1F,
-    0x8F, 0xC0, 0x2F, 0x00, 0x7E, 0x3E, 0x00, 0xFC, 0x01, 0xF5, 0xF8, 0x03, 0xE0, 0x0B, 0xCB, 0xD0,
-    0x0F, 0x80, 0x3F, 0x2F, 0x80, 0x3E, 0x01, 0xF4, 0xBE, 0x00, 0xFC, 0x0F, 0xC1, 0xFC, 0x03, 0xF0,
-    0xBC, 0x03, 0xF4, 0x07, 0xEB, 0xD0, 0x0B, 0xF4, 0x0F, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF5, 0x6C,
-    0x07, 0xFF, 0xFB, 0xFF, 0xC0, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFA, 0x5B, 0xFE, 0x00, 0x7F,
-    0x80, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03, 0xF4, 0x00, 0x00, 0x7C, 0x0B, 0xE0, 0x00,
-    0x00, 0x74, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xE0, 0x1F, 0xF8,
-    0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xAA, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x40, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x03,
-    0xF9, 0xBE, 0x03, 0xF0, 0x01, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x87, 0xF0, 0x02, 0xF0, 0xFF, 0x9B, 0xF4, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xD0, 0x00,
-    0x05, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x4B, 0x80, 0x01, 0xFF, 0xC0, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00, 0xBE, 0x00, 0x3D, 0x3C, 0x00, 0xBD, 0x00, 0x3C,
-    0x3C, 0x00, 0xFD, 0x00, 0x3C, 0x38, 0x00, 0xFC, 0x00, 0x74, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x7F, 0xF8, 0x1F, 0xFF, 0x02,
-    0xFF, 0xD0, 0x15, 0xF8, 0x7F, 0xBF, 0x0F, 0xEF, 0xE0, 0x01, 0xF5, 0xF4, 0x3F, 0x3E, 0x07, 0xE0,
-    0x01, 0xF7, 0xD0, 0x3E, 0xB8, 0x0B, 0xD0, 0x02, 0xFB, 0x40, 0x3F, 0xF0, 0x0B, 0xC0, 0x03, 0xFE,
-    0x00, 0x7F, 0xC0, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x0F, 0x80, 0x07, 0xF4, 0x00, 0xFF,
-    0x00, 0x1F, 0x40, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7D, 0x0D, 0x2F,
-    0x40, 0x03, 0xF0, 0x00, 0xBC, 0x3D, 0x2F, 0x00, 0x07, 0xE0, 0x00, 0xFE, 0xFC, 0x3F, 0x00, 0x0B,
-    0xD0, 0x00, 0xFF, 0xF8, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xDF, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x00,
-    0x7E, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-    0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0xBC, 0x00, 0x00, 0x00, 0x3F, 0x5F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFC, 0x00, 0x3F, 0x87, 0xFF, 0x40, 0x0B, 0xF0, 0x5F, 0xE0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x03, 0xE0, 0x02, 0xF8, 0x02, 0xF0, 0x00, 0x7E, 0x00,
-    0xF8, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x3F,
-    0x1F, 0x40, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xF9, 0x00,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xDF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x7E, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xBD, 0x00,
-    0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0x6F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x6A, 0xFF, 0xEA, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x15, 0xFE, 0x54,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00,
-    0x3F, 0x87, 0xFF, 0x40, 0x0B, 0xF0, 0x5B, 0xE0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x03, 0xE0, 0x02, 0xF8, 0x02, 0xF0, 0x00, 0x7E, 0x00, 0xF8, 0x00,
-    0x0F, 0x80, 0x7C, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x2F, 0x1F, 0x40,
-    0x00, 0x0B, 0xCF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x06, 0xBF, 0xEA,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x57, 0xF5, 0x50, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x41, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x03, 0xFF, 0xC0,
-    0x0B, 0xFD, 0x03, 0xEF, 0xE0, 0x2F, 0xEC, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x00, 0x03, 0xF4, 0xF8,
-    0x00, 0x00, 0x01, 0xFA, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xCF, 0xC0, 0x00, 0x00, 0x0F, 0x4B, 0xD0, 0x78, 0x00, 0x3E, 0x07, 0xF2, 0xF4, 0x3A, 0xFC,
-    0x03, 0xFF, 0xF0, 0x3F, 0xF0, 0x02, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0xFD, 0xF0, 0x04, 0x00, 0x00,
-    0x11, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFC, 0x0F, 0xEA,
-    0xFE, 0xAF, 0x40, 0x7F, 0x80, 0x0F, 0x42, 0xF8, 0x0F, 0x40, 0x3F, 0x00, 0x0F, 0x02, 0xF4, 0x1F,
-    0x00, 0x3F, 0x00, 0x0F, 0x03, 0xF0, 0x1E, 0x00, 0x7E, 0x00, 0x0D, 0x03, 0xF0, 0x1C, 0x00, 0xBD,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xFE, 0x55, 0x55,
-    0x7F, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x02, 0xF0, 0x7F, 0xFC, 0x00, 0x1F, 0xC0, 0x57, 0xF0, 0x00,
-    0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0,
-    0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xE0, 0x0B, 0xBC,
-    0x1C, 0x1F, 0x80, 0xBD, 0xF1, 0xF0, 0x7F, 0x5F, 0xC7, 0xFF, 0x80, 0xFF, 0xFC, 0x1F, 0xED, 0x02,
-    0xFF, 0x80, 0x3D, 0xB4, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xCB, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xF8, 0x07, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0xBF, 0xEA, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0x9B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x01, 0xF4, 0xBF, 0xF8, 0x00, 0x3F, 0x01, 0x5F, 0x40, 0x07, 0xE0, 0x01, 0xF4, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x03,
-    0xF0, 0x07, 0xF8, 0x00, 0x3F, 0xEB, 0xFF, 0x40, 0x01, 0xFF, 0xFB, 0xF0, 0x00, 0x02, 0xA8, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x0D, 0x00, 0x00, 0x0B, 0xD3, 0xE0, 0x00,
-    0x00, 0xFE, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x7C, 0x00, 0x00, 0x01, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xCB, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0x00,
-    0xBE, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x0A, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0xF0, 0x2F, 0x80, 0x01, 0xFC, 0x1E,
-    0x03, 0xF4, 0x00, 0x0F, 0xE2, 0xD0, 0x3F, 0x00, 0x00, 0xBF, 0xFE, 0xBF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x9B, 0xE0, 0x00, 0x00, 0x07, 0x80, 0xFD, 0x00, 0x00, 0x00,
-    0xB4, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0x41, 0xFC, 0x00, 0x00, 0x00, 0xB0, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x01, 0xF4, 0xBF, 0xF8, 0x00, 0x3F, 0x01, 0x5F, 0x40, 0x07, 0xE0, 0x01, 0xF4, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x40, 0xFC, 0x00, 0x3F, 0x1D, 0x1F, 0xC0, 0x03,
-    0xF2, 0xC7, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFB, 0xF0, 0x00, 0x01, 0xB8, 0x3F,
-    0x00, 0x00, 0x07, 0x43, 0xE0, 0x00, 0x00, 0xB0, 0x7E, 0x08, 0x00, 0x0A, 0x0B, 0xD3, 0xC0, 0x00,
-    0x00, 0xFE, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x55, 0x00,
-    0x00, 0x03, 0xF6, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xE4, 0x1F, 0xF4,
-    0x00, 0x2F, 0x80, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x0F, 0xD0,
-    0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00,
-    0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x0B,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xDB, 0xFF, 0xFC, 0x0B, 0xFF, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0xC0, 0x01, 0xF4, 0x3F, 0xFE, 0x00, 0x2F, 0x0F, 0xEF, 0xF0,
-    0x03, 0xF3, 0xE0, 0x3F, 0x00, 0x3E, 0xB8, 0x03, 0xE0, 0x07, 0xEF, 0x00, 0x7D, 0x00, 0xBF, 0xC0,
-    0x0B, 0xC0, 0x0F, 0xF4, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x01, 0xF4, 0x01,
-    0xFC, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x08, 0x3F, 0x00, 0x07,
-    0xD2, 0xD7, 0xE0, 0x00, 0xBF, 0xFC, 0xBD, 0x00, 0x0B, 0xFF, 0x0F, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x5B, 0xFC, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0xFE, 0x0F, 0x40, 0x7F, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x7D, 0x02,
-    0xF8, 0x00, 0x00, 0xBF, 0x7D, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x7E, 0x0B, 0xE0, 0x00, 0x00, 0xFD,
-    0x3F, 0xEF, 0xE5, 0x55, 0x55, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xF4, 0x00,
-    0x1F, 0xD0, 0x00, 0x0B, 0xFF, 0xAB, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x01, 0xF4,
-    0x03, 0xF0, 0x14, 0x0F, 0x80, 0x0F, 0xC3, 0xD0, 0xBC, 0x00, 0xFD, 0x0F, 0x03, 0xE0, 0x0F, 0xE0,
-    0x7D, 0x2F, 0x42, 0xFE, 0x00, 0xFD, 0xFD, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x01, 0xBF,
-    0xE4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x03, 0xF4, 0x00,
-    0xBC, 0x00, 0x0B, 0xF9, 0xBF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x5B, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0x01, 0xFE, 0x0F, 0x40, 0x7F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x7D,
-    0x02, 0xF8, 0x00, 0x00, 0xBE, 0x7D, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x7E, 0x0B, 0xE0, 0x00, 0x00,
-    0xFD, 0x3F, 0xEF, 0xE5, 0x55, 0x55, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xF4,
-    0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFF, 0xAB, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x01, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x14, 0x0F, 0x80,
-    0x0F, 0xC3, 0xD0, 0xBC, 0x00, 0xFD, 0x0F, 0x03, 0xE0, 0x0F, 0xE0, 0x7D, 0x2F, 0x42, 0xFE, 0x00,
-    0xFD, 0xFD, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x03, 0xF4, 0x00, 0xBC, 0x00, 0x0B, 0xF9, 0xBF,
-    0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xF8,
-    0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFC, 0x00,
-    0x0F, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0xFC, 0x00, 0x04, 0x1F, 0x80, 0x07, 0xE0, 0x03, 0xF8,
-    0x10, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xC0,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x0F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x1F, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x2F, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xBD,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0x40,
-    0x0B, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE7, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x2D, 0x00, 0x0B, 0xF4, 0x07, 0xFF, 0xC0, 0x0F, 0x00, 0x0F, 0xFF, 0x03, 0xEB, 0xF8, 0x0B,
-    0xC0, 0x0F, 0xEF, 0x82, 0xD0, 0x3F, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x50, 0x0B, 0xC3, 0xF8, 0x0B,
-    0x80, 0x00, 0x00, 0x01, 0xF2, 0xFD, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0xEF, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x2E, 0xE7, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xE3, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0xF7, 0xEE, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x3F, 0xCF, 0x40, 0x00, 0x00, 0x00, 0xF8,
-    0x1F, 0xD3, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x0B, 0xE0, 0xF8, 0x00, 0x40, 0x00, 0x7C, 0x03, 0xF0,
-    0x3F, 0x00, 0xB4, 0xBA, 0xBD, 0x00, 0xF4, 0x0B, 0xE6, 0xFC, 0x3F, 0xFD, 0x00, 0x7C, 0x00, 0xFF,
-    0xF8, 0x0B, 0xFC, 0x00, 0x2E, 0x00, 0x1F, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFD,
-    0x00, 0xFF, 0xF0, 0x00, 0x1B, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0xFE, 0x04, 0x00,
-    0x00, 0xFD, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3E,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xC0,
-    0x00, 0x0B, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x0B, 0xE0, 0x02,
-    0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0x41, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x2F, 0x87, 0xFF, 0x80, 0x2F, 0xF0, 0x57,
-    0xE0, 0x2F, 0xFC, 0x01, 0xF4, 0x1F, 0x40, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x2F, 0x07, 0xC0, 0x00,
-    0x0F, 0x83, 0xD0, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x01, 0xFB, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x0F, 0x80, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0x7F, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0xBC, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x38, 0x03, 0xF4, 0x00, 0x2F, 0xEF, 0xF4, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x6A, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x06, 0xF9, 0x5B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0x47, 0xF0, 0x00,
-    0x2F, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x7F, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x7C,
-    0x03, 0xE0, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x01, 0xF0, 0x0B, 0xD0, 0x00, 0x02, 0xE0, 0x0F,
-    0xC0, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x1F, 0x80, 0x00, 0x0B, 0x80, 0x2F, 0x40,
-    0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x0E, 0x24, 0x3E, 0x00, 0x3F, 0x2F, 0x3F,
-    0xFC, 0x00, 0x7F, 0xBE, 0x3F, 0xF4, 0x00, 0x7F, 0xFD, 0x3F, 0xD0, 0x00, 0x3F, 0xBC, 0x05, 0x00,
-    0x00, 0x04, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x6F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x56, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x07, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0x00, 0x03, 0xE7, 0xFF, 0xC0, 0x00, 0xFC, 0x57, 0xF0, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x2F,
-    0x40, 0x7D, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xF8, 0x03, 0xFA, 0xAA,
-    0xBD, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xBE, 0x55, 0x5F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x0F, 0xC0,
-    0x00, 0xF8, 0x03, 0xE0, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x04, 0x0B, 0xC0, 0x00, 0x07, 0x87, 0xE0, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xD0, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0x95, 0x55, 0x56, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x3E, 0x07, 0xFF, 0xC0,
-    0x00, 0xF8, 0x05, 0x7F, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xFC,
-    0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x03, 0xFA, 0xAA, 0xFD, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBE, 0x55, 0x5F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01,
-    0xF8, 0x00, 0x3E, 0x00, 0x07, 0xD1, 0xC1, 0xF4, 0x00, 0x2F, 0x0F, 0x4B, 0xC0, 0x00, 0xBE, 0xFC,
-    0x3F, 0x00, 0x02, 0xFF, 0xF0, 0xF8, 0x00, 0x07, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF,
-    0xCB, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBE,
-    0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xEA, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x9B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xDB, 0xFF, 0x80, 0x03, 0xF0, 0x57, 0xD0, 0x01,
-    0xF8, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x07, 0xF0, 0x03, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0xAF, 0xFD, 0x00, 0x1F, 0xFF, 0xBF, 0x00, 0x00,
-    0xAA, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x7E, 0xF8, 0x00,
-    0x0F, 0xBF, 0x40, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00,
-    0x3E, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00,
-    0xF4, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0xBD, 0x03,
-    0xD0, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x7E, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x0F,
-    0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x3F, 0x7C,
-    0x00, 0xBE, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF0,
-    0x00, 0xBD, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xBF, 0x00, 0x3E, 0xF0, 0x00, 0x01, 0xEB, 0xC0, 0x1E, 0x7C,
-    0x00, 0x00, 0xB5, 0xF0, 0x0F, 0x2F, 0x00, 0x00, 0x3C, 0x3D, 0x0B, 0x4F, 0x80, 0x00, 0x0F, 0x0F,
-    0x83, 0xC3, 0xD0, 0x00, 0x07, 0xC3, 0xE2, 0xD1, 0xF0, 0x00, 0x01, 0xE0, 0xF8, 0xF0, 0x7C, 0x00,
-    0x00, 0xB4, 0x2F, 0xB4, 0x2F, 0x00, 0x00, 0x3C, 0x0B, 0xFC, 0x0F, 0xC0, 0x00, 0x1E, 0x02, 0xFD,
-    0x03, 0xE0, 0xE1, 0x0F, 0x40, 0xBF, 0x00, 0xF8, 0x7E, 0xFF, 0xC0, 0x1F, 0x00, 0x3F, 0xBE, 0xFF,
-    0xD0, 0x07, 0x80, 0x0F, 0xFF, 0x6F, 0xD0, 0x01, 0x40, 0x02, 0xFB, 0xC0, 0x40, 0x00, 0x00, 0x00,
-    0x12, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x07, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0x02, 0xF8,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0xEA, 0xAA, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x03, 0xFA, 0xAA, 0xAF, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xFD, 0x00, 0x06, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0xC0, 0x02, 0x80,
-    0x00, 0xFC, 0x00, 0x78, 0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0xBF, 0x9F, 0xD0, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE, 0xF0, 0x00, 0xFF, 0x5B, 0xFF, 0x00, 0x2F, 0x80, 0x0F,
-    0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xF8, 0x02, 0xF0,
-    0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F, 0xE0,
-    0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00, 0x7B, 0xD0, 0x8B, 0xF0, 0x2F, 0x3D, 0x2D, 0x7F, 0xEF,
-    0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x14, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x2F, 0x80,
-    0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02,
-    0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xCB, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x7F, 0x40,
-    0x00, 0xFD, 0x07, 0xF0, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE, 0xF0, 0x00,
-    0xFF, 0x5B, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x1F, 0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00, 0x7B, 0xD0,
-    0x8B, 0xF0, 0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x03, 0xF8, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xEA, 0xAB, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xFE, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0xAA,
-    0xA8, 0x00, 0x00, 0x00, 0x0F, 0xEA, 0xAF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xEA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE,
-    0x00, 0x00, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x74, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF8, 0x00, 0x02,
-    0xFD, 0x55, 0xAF, 0xC0, 0x07, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x7F,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0xFC, 0x00, 0xBF, 0x96, 0xFF, 0x80, 0xBD, 0x02, 0xFC, 0x00,
-    0x7E, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x01, 0xF4, 0x01, 0xFC, 0x1F,
-    0x80, 0x03, 0xF0, 0x0B, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x7F, 0xC0, 0x3F, 0x00, 0x0B, 0xEB, 0xFD,
-    0x00, 0x7E, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7E, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0xBE, 0x00, 0xFF, 0xD0, 0x00, 0x20, 0xBF, 0x03, 0xDB, 0xF0, 0x01, 0xF4, 0x7F,
-    0xAF, 0x83, 0xFD, 0x6F, 0xE0, 0x3F, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0xBF, 0xF8,
-    0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x74, 0x00, 0x00, 0x7D, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0xC0,
-    0x3E, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFE, 0xAA, 0xBF, 0x40, 0x00, 0xBD, 0x00, 0x03,
-    0xD0, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x38, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xEA, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFE, 0xAA, 0xA0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x01, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0xFD, 0x00, 0x01, 0xF0, 0x00,
-    0x3F, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xD5, 0xAA, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1A, 0x00,
-    0x0D, 0x00, 0x3E, 0x00, 0x2C, 0x00, 0x7F, 0x00, 0xB8, 0x00, 0x3F, 0xEB, 0xF0, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B,
-    0xD0, 0x0F, 0x80, 0x1F, 0xC0, 0x2F, 0x00, 0xBF, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x7F, 0xBF, 0xE0,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02,
-    0x00, 0x7F, 0x00, 0x1F, 0x40, 0x3F, 0xE6, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x95, 0xBF, 0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xF0, 0x02, 0xC0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0x95, 0x55, 0x57, 0xFC,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x00, 0x0F, 0xD0, 0x7E,
-    0x00, 0x00, 0x2F, 0xC0, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0,
-    0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xBF, 0x57,
-    0xFC, 0x03, 0xD0, 0x03, 0xF0, 0x08, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x06, 0xFD,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0xBF, 0xDF, 0xC0, 0x2F, 0xE0, 0x3F, 0x02, 0xFC, 0x01, 0xF8, 0x2F,
-    0x80, 0x0F, 0xC0, 0xFC, 0x00, 0x7E, 0x03, 0xF0, 0x07, 0xF0, 0x0F, 0xD0, 0xBF, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x07, 0xE0, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x1F, 0xE0, 0x00, 0x02,
-    0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x95, 0xBF,
-    0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xF0, 0x02, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0x95, 0x55, 0x57, 0xFC, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00,
-    0x07, 0xF0, 0x7E, 0x00, 0x00, 0x0F, 0xD0, 0x7E, 0x00, 0x00, 0x2F, 0xC0, 0x7E, 0x00, 0x00, 0x7F,
-    0x00, 0x3F, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0x3F,
-    0x41, 0xFC, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xBF,
-    0xFF, 0xD0, 0x02, 0xFD, 0x5F, 0xF0, 0x03, 0xD0, 0x03, 0xF0, 0x02, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xF7, 0xF0, 0x02, 0xFE,
-    0x03, 0xF0, 0x0B, 0xF0, 0x07, 0xE0, 0x2F, 0x80, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x3F, 0x00,
-    0x7F, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x82, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xFF,
-    0x80, 0x0B, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-    0x07, 0xF4, 0x00, 0xFF, 0xFC, 0x00, 0x04, 0x1F, 0x80, 0x07, 0xE0, 0x03, 0xF8, 0x10, 0x00, 0x00,
-    0x0B, 0xC0, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x1F, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x2F,
-    0x43, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xBD, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFC, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x02,
-    0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0x40, 0x0B, 0xFC, 0x00,
-    0x2F, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x02,
-    0xD0, 0x00, 0xBF, 0x40, 0x7F, 0xFC, 0x00, 0xF0, 0x00, 0xFF, 0xF0, 0x3E, 0xBF, 0x80, 0xBC, 0x00,
-    0xFE, 0xF8, 0x2D, 0x03, 0xF0, 0x3F, 0x00, 0xF4, 0x00, 0x05, 0x00, 0xBC, 0x3F, 0x80, 0xB8, 0x00,
-    0x00, 0x00, 0x1F, 0x2F, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xCE, 0xF0, 0x7D, 0x00, 0x00, 0x00,
-    0x02, 0xEE, 0x7C, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x2E, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x4F, 0x7E, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xFC, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFD,
-    0x3E, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xBE, 0x0F, 0x80, 0x04, 0x00, 0x07, 0xC0, 0x3F, 0x03, 0xF0,
-    0x0B, 0x4B, 0xAB, 0xD0, 0x0F, 0x40, 0xBE, 0x6F, 0xC3, 0xFF, 0xD0, 0x07, 0xC0, 0x0F, 0xFF, 0x80,
-    0xBF, 0xC0, 0x02, 0xE0, 0x01, 0xFF, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0x7F, 0x82, 0xFD,
-    0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xE5, 0x6F, 0xF0, 0x03, 0xD0,
-    0x01, 0xFC, 0x01, 0xF0, 0x00, 0x3F, 0x40, 0x78, 0x00, 0x0B, 0xD0, 0x0D, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x05, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0x00, 0x00, 0x3F, 0x4B, 0xC0, 0x00,
-    0x1F, 0xC3, 0xF8, 0x00, 0x1F, 0xD0, 0xBF, 0xD1, 0x7F, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0xFC, 0x0B, 0xF0, 0x0B,
-    0xF0, 0x3F, 0xC0, 0x2F, 0x80, 0xFD, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0x41, 0xFD,
-    0x01, 0xD0, 0x01, 0xF8, 0x01, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x0A, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x55, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x34, 0x00, 0x1F, 0xC2, 0xF0, 0x00, 0xFE, 0x0F, 0xE0, 0x1F, 0xF0, 0x2F, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xAA, 0xAA, 0xFD, 0x00, 0x3E, 0x00, 0x03, 0xF4, 0x00, 0x3C, 0x00,
-    0x0F, 0xD0, 0x00, 0x78, 0x00, 0x3F, 0x40, 0x00, 0x20, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x2B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0E, 0x00,
-    0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x01, 0xFE, 0x00, 0x3F, 0xE4, 0x5F,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0x95, 0x55, 0xFD, 0x00,
-    0xB8, 0x00, 0x0F, 0xE0, 0x03, 0xC0, 0x00, 0xBE, 0x00, 0x09, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x5F, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0D, 0x00, 0x00, 0xBE, 0x00,
-    0xBC, 0x00, 0x07, 0xF0, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBE,
-    0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xE0, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xE0, 0x1F,
-    0xC0, 0x00, 0x00, 0xBE, 0x03, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x47, 0xD0, 0x02, 0xF4, 0x00,
-    0x00, 0x0F, 0xC7, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF7, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x02, 0xF0, 0x7F, 0xFC, 0x00, 0x1F, 0xC0, 0x57, 0xF0, 0x00,
-    0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0,
-    0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xE0, 0x0B, 0xBD,
-    0x08, 0x1F, 0x80, 0xBC, 0xF0, 0xF0, 0x7F, 0x5F, 0xC7, 0xEF, 0x80, 0xFF, 0xFC, 0x0F, 0xFC, 0x02,
-    0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0x6F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0xFC, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0xF8,
-    0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xD1, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF1, 0xF4, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xFD, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00,
-    0x1F, 0xC0, 0xBE, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFC, 0x00, 0x0B, 0xC1, 0xFF, 0xF0, 0x00, 0x7F, 0x01, 0x5F, 0xC0, 0x01, 0xF8, 0x00, 0x3F,
-    0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x07,
-    0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x02, 0xFD, 0x00, 0x1F, 0x80, 0x2E, 0xF4, 0x20, 0x7E, 0x02,
-    0xF3, 0xC3, 0xC1, 0xFD, 0x7F, 0x1F, 0xBE, 0x03, 0xFF, 0xF0, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0xFE,
-    0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x02,
-    0xF0, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x7D,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0x95, 0x7F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x2F,
-    0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x00,
-    0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0x80, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x05, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0x3F, 0x41, 0xFC, 0x00,
-    0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xE4, 0x7F, 0xC0, 0x0F, 0xD0, 0x03,
-    0xF4, 0x0B, 0xE0, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x0B, 0xE0, 0xFC, 0x00,
-    0x02, 0xF4, 0x7F, 0x00, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x1F, 0x82, 0xF8,
-    0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x0B, 0xE0, 0x1F, 0xC0, 0x07, 0xF0, 0x03, 0xFC, 0x0B, 0xF0, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xF0, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xEA, 0xAA, 0xAA,
-    0xAB, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFD, 0x55, 0x55, 0x55, 0x7F, 0x8B, 0xE0, 0x00,
-    0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x81, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00,
-    0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x00,
-    0xBE, 0x0B, 0xD0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x3F, 0x3F, 0xAA, 0xAA,
-    0xBF, 0x7F, 0xFF, 0xFF, 0xFE, 0x7E, 0x55, 0x55, 0xBD, 0xBC, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x01,
-    0xF8, 0xBD, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x7F, 0x40, 0x1F, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x00,
-    0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x95, 0x7F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x01, 0xFD,
-    0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x03,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xC7, 0xFA, 0xAA, 0xAA, 0xAA, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x55, 0x55, 0x55,
-    0x5F, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00,
-    0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x3F,
-    0x40, 0xFC, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x0F, 0xE0, 0x2F, 0xC0,
-    0x0F, 0xD0, 0x02, 0xF8, 0x0B, 0xD0, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x03,
-    0xF0, 0xFE, 0xAA, 0xAA, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0x95, 0x55, 0x6F, 0x4B, 0xC0, 0x00,
-    0x0F, 0xC2, 0xF0, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x03, 0xF4, 0x03, 0xF8,
-    0x07, 0xF4, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x07, 0xF8, 0x2F, 0xD0, 0x00,
-    0x0B, 0xF4, 0x2F, 0xC0, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x00, 0xFF, 0x96, 0xFF, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0xF0, 0x01, 0xF0, 0x00, 0x07,
-    0xF4, 0x01, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x06, 0xAA, 0xAB, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xA5, 0x57, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3C, 0x00, 0x00,
-    0x3F, 0x80, 0xBC, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xD1, 0x7F, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x50, 0x01, 0xFC, 0x0B, 0xE0, 0x0F, 0xF0, 0x3F, 0x80, 0x2F, 0x80, 0xFC, 0x00,
-    0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0x41, 0xFE, 0x01, 0xE0, 0x01, 0xFC, 0x02, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x06, 0xAA, 0xFD, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x55, 0x5F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x28, 0x00, 0x0F, 0xC1, 0xF0,
-    0x00, 0xBE, 0x0B, 0xF4, 0x0B, 0xF0, 0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x02, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF0, 0x1F, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x0F,
-    0xC0, 0x00, 0x7F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF4, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x3F,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x3E, 0x00, 0x00, 0x00,
-    0x03, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0xF0,
-    0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00,
-    0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0xF4,
-    0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00,
-    0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x00,
-    0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0x80,
-    0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xC0, 0x7F,
-    0xD0, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xD0,
-    0x00, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x1F,
-    0x40, 0x00, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x0D, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x50, 0x00, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0x00, 0xFD, 0x07,
-    0xF0, 0x00, 0x00, 0x10, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFE, 0x00,
-    0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0x00, 0x00,
-    0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0x00, 0x7E,
-    0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x0F,
-    0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0xB8, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x74, 0x7F,
-    0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x02, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0xBF, 0xC0, 0x00,
-    0x0B, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x90, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0x4F, 0xFF, 0xF4, 0x03, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x00,
-    0x0F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x03, 0xE0, 0x3E,
-    0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x0F, 0xD1, 0xFD, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00,
-    0x00, 0xBD, 0x0F, 0xD0, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0xF0,
-    0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00,
-    0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0xF4,
-    0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00,
-    0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x00,
-    0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00,
-    0x00, 0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xCB, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x0B,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x2F, 0x80, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xEA,
-    0xBF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x9B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0x40, 0x04, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x01, 0xFC,
-    0x0F, 0xD0, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0x4B, 0xFF, 0x80, 0x03, 0xF0, 0x15, 0xF4, 0x00,
-    0x7E, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0x03, 0xFE, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xBF,
-    0x00, 0x00, 0x2A, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x80, 0x00,
-    0x00, 0xBD, 0x3C, 0x00, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x50, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x7E, 0x42,
-    0xFC, 0x0B, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xF0, 0x00,
-    0x0B, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x03, 0xF4, 0x00, 0xB0, 0x3F, 0x40, 0x1F, 0x03, 0xFD, 0x1B, 0xE0, 0x1F, 0xFF, 0xEC, 0x00, 0xBF,
-    0xF6, 0xC0, 0x00, 0x50, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x06, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x2F, 0xF0,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF4,
-    0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF4,
-    0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xD0, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x55, 0xBF, 0x40,
-    0x2F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50,
-    0x00, 0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x80,
-    0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xC2, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0x01, 0x6F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0,
-    0x03, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x7C, 0x6A, 0x80, 0x03,
-    0xF0, 0x02, 0xFF, 0xFF, 0xD0, 0x0F, 0xC0, 0x0F, 0xF9, 0xBF, 0xC0, 0x7E, 0x00, 0x3D, 0x00, 0x3F,
-    0x42, 0xF4, 0x01, 0xF4, 0x00, 0xBD, 0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x2F, 0x00,
-    0x0F, 0xC0, 0xFC, 0x20, 0xBC, 0x00, 0x7E, 0x07, 0xE2, 0xD1, 0xF8, 0x07, 0xF0, 0x1F, 0xFF, 0x03,
-    0xFF, 0xFF, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0xD0, 0x01, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB,
-    0xF4, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x0B,
-    0xC0, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x50, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x56, 0xFD, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0A, 0xBF, 0xEA, 0xA0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x80, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x7E, 0x42, 0xFC, 0x0B, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x40, 0x2F, 0x80, 0x1F, 0x4F, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x07,
-    0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0xFE, 0x0F, 0x40, 0x1F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x10,
-    0x3F, 0x40, 0x07, 0x43, 0xFD, 0x07, 0xF8, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFD, 0xB8, 0x00, 0x14,
-    0x0B, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x47, 0xD0, 0x00, 0x3F, 0xF8, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x03, 0xFF, 0xC0, 0x0B,
-    0xFD, 0x03, 0xEF, 0xE0, 0x2F, 0xEC, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x00, 0x03, 0xF4, 0xF8, 0x00,
-    0x00, 0x01, 0xFA, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07,
-    0xCF, 0xC0, 0x00, 0x00, 0x0F, 0x4B, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x3A, 0xFC, 0x03,
-    0xF0, 0x00, 0x3F, 0xF0, 0x02, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x04, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x07, 0x41, 0xF0, 0x00, 0x00, 0x0F, 0xEB, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x02, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x3F,
-    0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAF, 0xFA, 0xA9, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x5B, 0xFF, 0x95, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x03, 0xFF, 0xC0, 0x0B, 0xFD, 0x03,
-    0xEF, 0xE0, 0x2F, 0xEC, 0x00, 0x07, 0xF0, 0x7D, 0x00, 0x00, 0x03, 0xF4, 0xF8, 0x00, 0x00, 0x01,
-    0xFA, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x55, 0xFF, 0x95, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x55, 0xFF, 0x95, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xCF, 0xC0,
-    0x00, 0x00, 0x0F, 0x4B, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x3A, 0xFC, 0x03, 0xFA, 0xF4,
-    0x3F, 0xF0, 0x02, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0xFE, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x38,
-    0x2C, 0x1E, 0xB4, 0x07, 0xD0, 0x0B, 0xD0, 0x2F, 0xF4, 0x36, 0x9C, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x74, 0x3F, 0xFF, 0xFC, 0x75, 0x55, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03,
-    0x80, 0x70, 0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2E, 0x55, 0x5D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0,
-    0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE2, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x15, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAA, 0xA4, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8,
-    0x68, 0x01, 0xA2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F,
-    0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40,
-    0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4,
-    0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F,
-    0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2,
-    0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF1, 0x50, 0x05, 0x40, 0x55, 0x55,
-    0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x07, 0xC0, 0x3D, 0x03, 0xF0, 0x2F, 0x40, 0xFC, 0x0B, 0xE0, 0x3F, 0x80, 0xFF, 0x02,
-    0xFC, 0x01, 0x40, 0x00, 0x01, 0xE0, 0x2F, 0xD0, 0x7F, 0x80, 0xFD, 0x03, 0xF0, 0x1F, 0x40, 0xFC,
-    0x07, 0xD0, 0x3D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x2F, 0xD0, 0x7F, 0x40, 0xFC, 0x07,
-    0xF0, 0x2F, 0x00, 0xF8, 0x0B, 0xC0, 0x7C, 0x01, 0x80, 0x00, 0x05, 0x03, 0xFC, 0x7F, 0x87, 0xF0,
-    0x7F, 0x03, 0xF0, 0x2F, 0x00, 0xF4, 0x0B, 0xC0, 0x3D, 0x00, 0x40, 0x00, 0x10, 0x01, 0x00, 0x7C,
-    0x02, 0xE0, 0x3D, 0x02, 0xF0, 0x3F, 0x01, 0xF4, 0x2F, 0x40, 0xFC, 0x0F, 0xC0, 0x7E, 0x0B, 0xE0,
-    0x3F, 0x43, 0xF8, 0x1F, 0xD0, 0xFF, 0x07, 0xF8, 0x2F, 0xC0, 0xFE, 0x01, 0x40, 0x04, 0x00, 0x00,
-    0x40, 0x01, 0x00, 0x7F, 0x43, 0xFC, 0x07, 0xF8, 0x3F, 0xC0, 0x3F, 0x42, 0xFC, 0x03, 0xF0, 0x2F,
-    0x80, 0x7E, 0x02, 0xF4, 0x0B, 0xC0, 0x3E, 0x00, 0xF8, 0x0B, 0xC0, 0x2F, 0x00, 0xF4, 0x07, 0xC0,
-    0x3E, 0x00, 0x10, 0x01, 0x00, 0x00, 0x06, 0xF0, 0x1F, 0x40, 0xBF, 0x43, 0xFC, 0x07, 0xF4, 0x3F,
-    0xC0, 0x3F, 0x02, 0xFC, 0x07, 0xF0, 0x3F, 0x40, 0xBC, 0x03, 0xF0, 0x0F, 0x80, 0x7D, 0x02, 0xF0,
-    0x0F, 0x80, 0x7C, 0x02, 0xF0, 0x06, 0x00, 0x28, 0x00, 0x05, 0x00, 0x10, 0x0F, 0xF0, 0x3F, 0x47,
-    0xF8, 0x2F, 0xD1, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x0F, 0xC0, 0xBE, 0x02, 0xF0, 0x0F, 0x80,
-    0x3D, 0x02, 0xF0, 0x0B, 0xC0, 0x3E, 0x00, 0xF4, 0x07, 0xC0, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x40, 0x7C, 0x05, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xE5,
-    0x3D, 0x1A, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x01, 0x01, 0xF0, 0x14, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x0E, 0x53, 0xD1, 0xA4, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x10, 0x1F, 0x00, 0x40, 0xBF, 0xBF, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xE9, 0x3D, 0x5B, 0x80,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x02, 0x90, 0x1F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x3F, 0xF4, 0x0B, 0x90, 0x28, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x3F,
-    0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x3F, 0xFD,
-    0x00, 0x3F, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0xFF, 0xFE, 0xFD, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x03, 0xFC, 0x3F,
-    0x40, 0x3F, 0x80, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x0B, 0xCB, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x7F, 0xD0, 0x00, 0xFF, 0x40, 0x03,
-    0xFD, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x50, 0x00, 0x01, 0x40, 0x00, 0x05, 0x00, 0x00,
-    0x1F, 0xDB, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x74, 0x38, 0x1F, 0xFC, 0x74, 0x05, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03, 0x80, 0x70,
-    0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
-    0x3F, 0xF4, 0x1C, 0x2E, 0x50, 0x0D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0, 0x0D, 0x00,
-    0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x1F, 0x40, 0x07, 0xFC, 0x00, 0xEA, 0x70, 0x38, 0xA2, 0xCA, 0x0A, 0x0A,
-    0x40, 0xA0, 0x10, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0xD0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x3C, 0x38, 0xBF, 0xFF, 0xF0,
-    0xEB, 0x55, 0x6D, 0x2C, 0xA0, 0x07, 0x4B, 0x0A, 0x01, 0xD2, 0xC0, 0xA0, 0x74, 0xB0, 0x0A, 0x04,
-    0x04, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA0, 0x00,
-    0x2D, 0x3C, 0x00, 0x0B, 0x4F, 0x00, 0x02, 0xC3, 0xC0, 0x00, 0xB0, 0xFF, 0xFF, 0xE3, 0x87, 0x95,
-    0x5E, 0x0E, 0x1D, 0x00, 0xA0, 0x38, 0x74, 0x0A, 0x00, 0xE1, 0xD0, 0xA0, 0x01, 0x01, 0x0A, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x82, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x80,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x0F, 0x80, 0xBC, 0x00, 0x54, 0x00, 0x00, 0x15, 0x02, 0xF0, 0x07, 0xC0, 0x7C, 0x02, 0xFF,
-    0xC0, 0x00, 0xBF, 0xF0, 0x7E, 0x07, 0xD0, 0x3D, 0x03, 0xFA, 0xFC, 0x00, 0xFE, 0xBF, 0x0B, 0xFF,
-    0xD0, 0x2E, 0x03, 0xF0, 0x1F, 0x40, 0xBC, 0x07, 0xD0, 0xBF, 0x80, 0x1F, 0x01, 0xF0, 0x03, 0xE0,
-    0x7C, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0xF8, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x0F,
-    0x80, 0x3D, 0x00, 0x3E, 0x0F, 0x40, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x47, 0xC0,
-    0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x03, 0xD2, 0xF0, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x02,
-    0xF0, 0x02, 0xF0, 0xBC, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xF4, 0x2F, 0x00, 0x3D,
-    0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0xFC, 0x07, 0xD0, 0x3F, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xFA,
-    0xFC, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0B, 0xD0, 0x3F, 0x41, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF4,
-    0x0F, 0x80, 0xBC, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0A, 0x00, 0xBD, 0x03, 0xE0, 0x3F,
-    0x42, 0xFC, 0x1F, 0xC0, 0xFE, 0x0F, 0xE0, 0x7F, 0x07, 0xF0, 0x3F, 0x43, 0xF4, 0x1F, 0xC0, 0xF8,
-    0x0F, 0xC0, 0xBC, 0x03, 0xD0, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0A, 0x00,
-    0x60, 0x02, 0xF4, 0x0F, 0x80, 0xBC, 0x03, 0xF4, 0x2F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F, 0x82, 0xFC,
-    0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x1F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F, 0x41, 0xFC, 0x0F, 0xD0, 0x3E,
-    0x03, 0xF0, 0x1F, 0x80, 0xBC, 0x03, 0xD0, 0x2F, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x02, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFD, 0x00,
-    0xFC, 0x01, 0xF0, 0x02, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x60, 0x0B, 0xC0, 0x1F, 0x40, 0xFE, 0x02,
-    0xFC, 0x07, 0xF0, 0x1F, 0xD0, 0x3F, 0x80, 0xFE, 0x01, 0xFC, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0x80,
-    0x3F, 0x00, 0xFC, 0x01, 0xF0, 0x03, 0xD0, 0x0B, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-    0x60, 0x01, 0x80, 0x2F, 0x00, 0x7D, 0x01, 0xF8, 0x0F, 0xE0, 0x2F, 0xC0, 0x7F, 0x01, 0xFC, 0x07,
-    0xF4, 0x0F, 0xD0, 0x3F, 0x80, 0xFE, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x40, 0xFD, 0x02,
-    0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xBC, 0x01, 0xF0, 0x03, 0xD0, 0x0F, 0x80, 0x2C, 0x00,
-    0x70, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x1F, 0x8F, 0x80, 0x07, 0xE0, 0x3E, 0x01, 0xF8, 0x00, 0xF8, 0x2E, 0x00, 0x03,
-    0xD0, 0x00, 0x01, 0x00, 0x07, 0xD0, 0x0B, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0B, 0xF0,
-    0x02, 0xFC, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x1F,
-    0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x02, 0xC3, 0xC0, 0x00, 0x40, 0x02, 0xE0,
-    0x3C, 0x00, 0xF8, 0x02, 0xE0, 0x03, 0xC0, 0x7F, 0x01, 0xE0, 0x00, 0x7C, 0x0B, 0x41, 0xF0, 0x00,
-    0x07, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x00,
-    0x40, 0xB8, 0xF0, 0x00, 0x00, 0xFC, 0x0B, 0xF0, 0x1F, 0x40, 0x3F, 0x00, 0xF8, 0x0B, 0xE0, 0x0B,
-    0x80, 0xFF, 0x40, 0xF0, 0x00, 0x00, 0xB4, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x0F, 0x40, 0xF0, 0x00, 0x78,
-    0x07, 0xF0, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x1C, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x1F,
-    0xC0, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00,
-    0xF8, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x2F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-    0x01, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x1D, 0x00, 0x07, 0x80, 0x00, 0xA0,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x06,
-    0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x00,
-    0x10, 0x00, 0x04, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55,
-    0x55, 0x50, 0x7F, 0xF9, 0xBF, 0xFE, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x1A, 0x40,
-    0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xAF, 0xE0,
-    0x0F, 0xEB, 0xFC, 0x08, 0x00, 0xFC, 0x02, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xBC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7E, 0xA0, 0x00, 0x1F, 0xE8, 0x00, 0x1F, 0xF8,
-    0x00, 0x03, 0xFF, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x01, 0x90, 0x00, 0x0B, 0xF0, 0x00,
-    0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 0x90, 0x00,
-    0x00, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x0F, 0xEB, 0xF8,
-    0x00, 0x7F, 0x00, 0x80, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x00, 0x0B,
-    0xC0, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x00, 0x0B,
-    0xD0, 0x02, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0x3F,
-    0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x1F,
-    0xA8, 0x00, 0x07, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x78, 0x00, 0x0B, 0xE0, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x64, 0x00,
-    0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40,
-    0x01, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x06,
-    0x90, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0x00,
-    0x3F, 0xAF, 0xE0, 0x02, 0xF8, 0x00, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xE0, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x1F,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x7E, 0xA0, 0x00, 0x1D, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xA0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0xA4, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xF9, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0x40, 0x1F, 0x0B, 0xE5, 0xFF, 0xEB, 0xF8, 0x3C,
-    0x00, 0x6F, 0xFF, 0x80, 0x50, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x90, 0x0A, 0x00, 0x60, 0x02, 0x40,
-    0x2F, 0x40, 0xF8, 0x0B, 0xC0, 0x7E, 0x03, 0xF4, 0x2F, 0xC0, 0xFD, 0x0B, 0xE0, 0x7F, 0x03, 0xF8,
-    0x2F, 0xC0, 0xFD, 0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x2F, 0xC1, 0xFC, 0x0F, 0xD0, 0x7F, 0x03, 0xF4,
-    0x3F, 0x41, 0xFC, 0x0F, 0xD0, 0x7E, 0x03, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0xBC, 0x03, 0xD0,
-    0x2F, 0x01, 0xF4, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xD0, 0x0F, 0xD1, 0xFC, 0x0B, 0xC0,
-    0x2F, 0x03, 0xD0, 0x07, 0xC2, 0xF0, 0x01, 0xF0, 0xF8, 0x00, 0xBC, 0x3D, 0x00, 0x2F, 0x1F, 0x00,
-    0x0F, 0x87, 0xC0, 0x07, 0xD2, 0xF0, 0x03, 0xF0, 0x7D, 0x01, 0xF4, 0x0F, 0xD2, 0xF8, 0x02, 0xFF,
-    0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xEF, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x3D,
-    0x2E, 0x00, 0x0F, 0x83, 0xD0, 0x03, 0xE0, 0x3D, 0x00, 0xF8, 0x07, 0xC0, 0x3F, 0xAA, 0xFE, 0x83,
-    0xFF, 0xFF, 0xFC, 0x05, 0x55, 0xF9, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1A,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x1F, 0xFF, 0xC0, 0x0B, 0xEA, 0xA0, 0x03, 0xD0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2B, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x6F, 0xC0, 0x1F, 0xFF, 0x80, 0x03, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0xA0, 0x03,
-    0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF6, 0x90, 0x00, 0xFF, 0xFF, 0x00, 0x7D,
-    0x57, 0xF0, 0x2F, 0x00, 0x7D, 0x0B, 0x80, 0x0F, 0x43, 0xE0, 0x03, 0xD0, 0xBC, 0x02, 0xF0, 0x1F,
-    0x82, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFC, 0x3D, 0x55, 0xF8, 0x78, 0x02, 0xF0, 0x30, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x3E, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x0F, 0xEF, 0xE0, 0x0F, 0x80, 0xBC, 0x03, 0xC0, 0x2F, 0x00, 0xF4, 0x0F,
-    0x80, 0x3F, 0x0F, 0xC0, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x02, 0xE0, 0xFC, 0x02, 0xF0, 0x0F,
-    0x80, 0xF4, 0x03, 0xF0, 0x3D, 0x00, 0xF8, 0x0F, 0x80, 0xBC, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x07,
-    0xE0, 0x7E, 0x03, 0xE0, 0x0B, 0xC0, 0xF4, 0x01, 0xF0, 0x3D, 0x00, 0xBC, 0x0F, 0x80, 0x2F, 0x02,
-    0xF9, 0x6F, 0x80, 0x2F, 0xFF, 0xC0, 0x00, 0x57, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-    0x1B, 0xF0, 0x02, 0xBF, 0xE0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC0, 0xFC,
-    0x0B, 0xF5, 0xFF, 0x40, 0x3D, 0xE7, 0xD0, 0x0F, 0xD0, 0xF4, 0x07, 0xE0, 0x7C, 0x02, 0xF0, 0x2F,
-    0x00, 0xF8, 0x0F, 0x40, 0x3C, 0x03, 0xC0, 0x1F, 0x01, 0xF3, 0x4B, 0x80, 0x7F, 0xC3, 0xD0, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xEF, 0xE0, 0x1F, 0x80,
-    0xFC, 0x0F, 0xC0, 0x2F, 0x07, 0xD0, 0x07, 0xC3, 0xF0, 0x01, 0xF0, 0xF8, 0x00, 0xBC, 0x7D, 0x00,
-    0x3F, 0x1F, 0x00, 0x0F, 0x8B, 0xC0, 0x07, 0xC2, 0xF0, 0x03, 0xE0, 0x7E, 0x02, 0xF0, 0x0F, 0xEB,
-    0xF4, 0x01, 0xFF, 0xF4, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x01, 0x40, 0x06, 0xFC, 0x07, 0xFF, 0x80,
-    0x1A, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0xBF, 0xE0, 0x3F, 0xFF, 0x41, 0x55, 0x50,
-    0x00, 0x06, 0x50, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xEF, 0xE0, 0x1F, 0x40, 0xFC, 0x0B, 0x40, 0x2F,
-    0x00, 0x40, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF,
-    0x80, 0x55, 0x55, 0x00, 0x00, 0x06, 0x40, 0x00, 0xBF, 0xF4, 0x02, 0xFA, 0xFC, 0x03, 0xC0, 0x7C,
-    0x02, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0xF0, 0x00,
-    0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xE0, 0x15, 0xBF, 0xC0, 0x7F, 0xFE,
-    0x00, 0x2A, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x1F, 0xF0, 0x00, 0x07, 0xDF, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x7C, 0x3E, 0x00, 0x1F, 0x03, 0xD0,
-    0x07, 0xC0, 0x3C, 0x01, 0xF4, 0x07, 0xC0, 0x3F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x01, 0x7F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xE0, 0x05, 0xAF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0x69, 0x00, 0x00,
-    0x00, 0x00, 0x58, 0x00, 0x02, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xE0, 0x00,
-    0x03, 0xD0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x7C, 0x02, 0xF0, 0x2F, 0x00, 0x3D,
-    0x0F, 0x80, 0x0F, 0x42, 0xF0, 0x07, 0xC0, 0xBC, 0x03, 0xF0, 0x0F, 0xDB, 0xF0, 0x01, 0xFF, 0xF0,
-    0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3C, 0x00, 0xF4,
-    0x74, 0x03, 0xE0, 0x10, 0x0B, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0x02,
-    0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0x97, 0xF0, 0x0F, 0x40,
-    0xBC, 0x03, 0xC0, 0x2F, 0x00, 0xF4, 0x1F, 0x40, 0x2F, 0x9F, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xEF,
-    0xE0, 0x03, 0xD0, 0xBD, 0x03, 0xE0, 0x0F, 0xC0, 0xF0, 0x03, 0xF0, 0x3D, 0x00, 0xF8, 0x0F, 0xD1,
-    0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x06, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x0B, 0xFF, 0x80, 0x0F,
-    0xEB, 0xF4, 0x0B, 0xC0, 0x3E, 0x03, 0xE0, 0x0B, 0xC0, 0xF4, 0x01, 0xF0, 0x3D, 0x00, 0xBC, 0x0F,
-    0xC0, 0x3E, 0x01, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xE0, 0x00,
-    0x0B, 0xE0, 0x00, 0x6F, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x29, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-    0xF8, 0x00, 0x02, 0xF8, 0x00, 0x3D, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0x00, 0x01,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFD, 0x54, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xAF, 0xEA, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xAB, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x04, 0xBE, 0x00, 0x50, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x66, 0xFD, 0x56, 0x80, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0xBF, 0xAA, 0xA4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xFE,
-    0xAA, 0xBF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x5A, 0xFF, 0xFD, 0x00, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF9, 0x5F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0xBE, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x02, 0xF8, 0x1B, 0xFA, 0x80, 0x0B, 0xFC, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFE, 0x00, 0x1F, 0x80, 0xBF, 0xC0, 0xAF, 0xEA, 0x40, 0xF4, 0x1D, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x01, 0x00, 0x00,
-    0xF8, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0x4D, 0x00, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x7E, 0x6F, 0x2F, 0x40, 0xF0, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x1F, 0xFF, 0xD0, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFA, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xFA, 0xFF, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xD0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x20, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x55, 0x68, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x02, 0xAF, 0xFA, 0xAA, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x02, 0xC0, 0x00, 0x0F, 0xFE, 0x56, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x01, 0xF9, 0x56, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xAA,
-    0xAA, 0xAB, 0xFE, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x1F, 0x6D, 0x7D, 0x2F, 0x4B, 0x47, 0xD7, 0x42,
-    0xE0, 0x74, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD2, 0xAA, 0xAA, 0xA5, 0x5B, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFA, 0xAA, 0xAA, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x03, 0x42, 0xE0, 0x72, 0xF4,
-    0xB4, 0x7E, 0x2F, 0x2D, 0x7E, 0x02, 0xFB, 0xBE, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x0B, 0xC0,
-    0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x0B, 0xE5, 0x55,
-    0x55, 0x6F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0xAA, 0xAA, 0xAA, 0xF8, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00,
-    0xBC, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B,
-    0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x0B, 0xEE, 0xF8, 0x0F, 0xCB, 0x8F, 0xCB, 0xC2, 0xE0, 0xF8, 0xC0,
-    0xB8, 0x0C, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x80, 0xB8, 0x08, 0xBC, 0x2E, 0x0F, 0x8F,
-    0xCB, 0x8F, 0xC0, 0xFE, 0xEF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBE,
-    0xEF, 0x80, 0x0B, 0xDB, 0x9F, 0x80, 0xBD, 0x2E, 0x1F, 0x80, 0xD0, 0xB8, 0x1C, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x0D, 0x0B, 0x81, 0xC0, 0xBD, 0x2E, 0x1F, 0x80, 0xBD, 0xB9, 0xF8, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xB8, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2E,
-    0x00, 0x20, 0x0B, 0x80, 0x2F, 0x02, 0xE0, 0x2F, 0x40, 0xB8, 0x2F, 0x40, 0x2E, 0x1F, 0x40, 0x0B,
-    0x9F, 0x95, 0x57, 0xEF, 0xFF, 0xFF, 0xF9, 0xFA, 0xAA, 0xA9, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x02, 0x00, 0x2E, 0x03, 0xE0, 0x0B, 0x80, 0x7E, 0x02, 0xE0,
-    0x07, 0xD0, 0xB8, 0x00, 0x7D, 0x2F, 0x55, 0x5B, 0xDB, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xFD, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x80, 0x00, 0x2F, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00,
-    0x2F, 0x07, 0xE5, 0x55, 0x55, 0xBC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBE, 0xAA, 0xAA, 0xAA, 0x40,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xFA, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF7, 0xEA, 0xAA, 0xAA, 0xAA, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x55,
-    0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xEF, 0x40, 0x00, 0x7D, 0x1F, 0x40, 0x07,
-    0xF4, 0x7F, 0x40, 0x7F, 0xD1, 0xFF, 0x47, 0xDF, 0x47, 0xDF, 0x49, 0x3D, 0x1F, 0x18, 0x00, 0xF4,
-    0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xF4, 0x7C,
-    0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xF4, 0x7C, 0x00,
-    0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xFF, 0xFF, 0xFE, 0xBF, 0x43,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xAA, 0xAA, 0xAA, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x55, 0x55,
-    0x55, 0x55, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00,
-    0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xF4,
-    0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x05, 0x3D, 0x1F, 0x14, 0x7C, 0xF4, 0x7C,
-    0xF4, 0xBF, 0xD1, 0xFF, 0x80, 0xBF, 0x47, 0xF8, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0xBD, 0xF8, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x0F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x03, 0xFA, 0xAA,
-    0xAB, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFA, 0xAA, 0xAA, 0xAB, 0xE1, 0xF0, 0x00, 0x00,
-    0x00, 0x3D, 0x3E, 0x55, 0x55, 0x55, 0x6F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xC0, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00,
-    0x00, 0x2F, 0x81, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xF0,
-    0x00, 0x00, 0x2F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xE0, 0x00,
-    0x7F, 0xAA, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xAA, 0xAF, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x3E, 0x00, 0x00, 0x00, 0xBF, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFD,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xF2, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0x80,
-    0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xAF, 0x9F, 0xC0, 0x02, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFD, 0x5F, 0xFC, 0x03, 0xF4, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x07,
-    0xE0, 0xBD, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xF0, 0x00,
-    0x0F, 0x81, 0xF8, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x02, 0xF0, 0x03, 0xF0,
-    0x01, 0xF8, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xEA, 0xBF, 0xC0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF3, 0xFF, 0xFF, 0xBF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0x3A, 0xAA, 0xAB, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xBA,
-    0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x07, 0xFF, 0xF9, 0x02, 0xF4, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF1, 0xF8, 0x00, 0x3F, 0xFA, 0x5B, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0xE0, 0x0B, 0xE0, 0x00,
-    0x00, 0xFD, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0xFC, 0x0B, 0xE0,
-    0xBE, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x1F, 0x83, 0xF4, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x2F,
-    0x80, 0xFD, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x2F, 0xC0, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF,
-    0x80, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xFE, 0x41, 0x7F, 0xF0, 0x00, 0x7E, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7E, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x0A, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEF,
-    0xD0, 0x00, 0x00, 0x07, 0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0x43, 0xF8,
-    0x00, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0xFE, 0x00,
-    0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x03,
-    0xF0, 0x00, 0x1F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0x1F, 0x80,
-    0x00, 0x07, 0xF0, 0x2F, 0x40, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x95, 0x55,
-    0x5B, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFE, 0xAA, 0x5A, 0xAB, 0xF0, 0xFF, 0x00, 0x00, 0x01,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0xBD, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x00, 0x1F,
-    0x80, 0x1F, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0xBF, 0x00, 0x02, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0xE0, 0x0F, 0x80, 0x00, 0x02, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00,
-    0x00, 0x0F, 0xE1, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFA,
-    0xAA, 0xAA, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x01, 0xF8, 0x00, 0x03,
-    0xF0, 0x00, 0xBE, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0xEA, 0xAA, 0xFF, 0xBF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xBD, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x00,
-    0x00, 0x03, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0xEB, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFA, 0xAA,
-    0xAA, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xF9, 0x55, 0x55,
-    0x54, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xCB, 0xFA, 0xAA, 0xAA, 0xAB, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x55, 0x55, 0x55,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x55, 0x55, 0x50,
-    0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xEB, 0xFF, 0xEA, 0xAA, 0xAB, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0xAA, 0xAA, 0xAB, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xF8,
-    0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xAF, 0xFB, 0xFE,
-    0xAA, 0xAF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0xF4,
-    0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xF4,
-    0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0xFF, 0x00, 0x00, 0x01, 0xFA,
-    0xFF, 0x02, 0xAA, 0xAA, 0xBF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFA, 0xAA, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xD1, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC1, 0x7F, 0xFA, 0xAA, 0xAB, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF4, 0x02, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF2, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFA, 0xAA, 0xAA, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0xBC,
-    0x03, 0xFD, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x7F, 0xC0, 0x00, 0x18, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x1E, 0x03, 0xF8, 0x00, 0x00, 0x3E, 0x0B,
-    0xF0, 0x00, 0x00, 0x3E, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x15, 0x55, 0x55,
-    0x52, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x08, 0x03, 0xD0, 0x14, 0x7E, 0x0B, 0x43, 0xF0, 0xFF, 0x6D, 0xBF,
-    0x80, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x07,
-    0xF8, 0xB5, 0xFF, 0x0F, 0x43, 0xD0, 0xB8, 0x10, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x1F,
-    0x40, 0xFC, 0x3E, 0x00, 0x3D, 0x3D, 0x00, 0x3E, 0x3D, 0x00, 0x3E, 0x3E, 0x00, 0x3D, 0x2F, 0x40,
-    0xFC, 0x0F, 0xFF, 0xF4, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xE3, 0xFE,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xFE, 0x00, 0x0B, 0xD0, 0x0F, 0xFF, 0xC0, 0x03,
-    0xF0, 0x02, 0xAB, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x80, 0x3F,
-    0x00, 0x00, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x42, 0xF0,
-    0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0x00,
-    0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xB9, 0x00, 0x2F, 0x0F, 0xFF,
-    0x80, 0xBE, 0x2F, 0x9B, 0xE1, 0xF4, 0x3D, 0x01, 0xFB, 0xC0, 0x7C, 0x00, 0x7F, 0x40, 0xBC, 0x00,
-    0x3E, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0xFB, 0xC0, 0x3F, 0x9B, 0xD2, 0xF4, 0x1F, 0xFF,
-    0x40, 0xFE, 0x02, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB9, 0x00, 0x0B, 0xE0, 0x02,
-    0xFF, 0xE0, 0x1F, 0xFF, 0x02, 0xF9, 0xBE, 0x1F, 0x9F, 0xE0, 0xF8, 0x07, 0xEF, 0x00, 0xBC, 0x3C,
-    0x00, 0xBF, 0x00, 0x1F, 0x1F, 0x00, 0x0F, 0x80, 0x03, 0xC7, 0xC0, 0x07, 0xF4, 0x01, 0xF0, 0xF4,
-    0x07, 0xEF, 0x00, 0xBC, 0x3F, 0x9B, 0xD3, 0xF9, 0xBD, 0x03, 0xFF, 0xD0, 0x2F, 0xFE, 0x00, 0x2F,
-    0x80, 0x01, 0xBD, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x29, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x15, 0x29, 0x02, 0x93, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07,
-    0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3,
-    0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0,
-    0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E,
-    0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F,
-    0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE1, 0x50, 0x15, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01,
-    0xF7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0x00, 0x2F,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0x80, 0x00, 0x02, 0xF0,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x02, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x02, 0xF8, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD7, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x0B, 0xD2, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x7F, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x07,
-    0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x7D,
-    0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x0B, 0xD0,
-    0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBC, 0x00,
-    0x00, 0x00, 0x1F, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x95, 0xBF, 0xF0, 0x1F, 0xD0,
-    0x00, 0x1F, 0xD0, 0xFD, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00,
-    0xBD, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF,
-    0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00,
-    0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07,
-    0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4,
-    0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00,
-    0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E,
-    0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40,
-    0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00,
-    0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB,
-    0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00,
-    0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF9, 0x45, 0xBF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xE0,
-    0x7D, 0x00, 0x00, 0xFD, 0x01, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x80, 0x3F, 0x40, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x7F, 0xD0, 0x00, 0x00,
-    0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00,
-    0x14, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x00, 0x03,
-    0xFD, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0xA4, 0x0F, 0xF0, 0x7F, 0xC1, 0xFD, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xFC, 0x1F, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x14, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x0F, 0xF5,
-    0xFF, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0xFF,
-    0x00, 0x00, 0x03, 0xFD, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x50,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x01, 0x80, 0xFF, 0xFF,
-    0x40, 0x1F, 0x0B, 0xE5, 0xFF, 0xEB, 0xF8, 0x3C, 0x00, 0x6F, 0xFF, 0x80, 0x50, 0x00, 0x06, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x02, 0x80, 0xFF, 0xFF, 0x80, 0x1F, 0x0F,
-    0xD1, 0xBF, 0xFB, 0xF4, 0x3C, 0x00, 0x2F, 0xFF, 0x40, 0x50, 0x00, 0x05, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x04, 0x0B, 0xFF, 0x40, 0x2E, 0x2F,
-    0xFF, 0xF4, 0x7E, 0x3F, 0x07, 0xFF, 0xFC, 0x3C, 0x00, 0xBF, 0xF4, 0x04, 0x00, 0x05, 0x40, 0x02,
-    0xF8, 0x00, 0x08, 0x0F, 0xFF, 0x80, 0x3E, 0x3F, 0xFF, 0xF9, 0xBE, 0x3E, 0x02, 0xFF, 0xFC, 0x3C,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x40, 0x00, 0x5B,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA9, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xEA, 0xAA, 0xFF, 0xC2, 0x40, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x01, 0xF0, 0x05, 0x55, 0x5F, 0x94, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x55, 0xF9,
-    0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA,
-    0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00,
-    0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
-    0x4B, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B,
-    0x80, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x2F,
-    0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF,
-    0x40, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFD, 0x00,
-    0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xD0, 0x00,
-    0x2F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x55, 0x56, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x05, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x95, 0xBE, 0x55, 0x47, 0xF8,
-    0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00,
-    0x02, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x00,
-    0x2F, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0xC0, 0x07, 0xD0, 0x00, 0x03, 0xF8, 0x02,
-    0xF0, 0x00, 0x00, 0x7F, 0x80, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0xBE, 0x55, 0x55, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xE5, 0x55, 0x55, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x55, 0x55, 0x6F, 0xAF, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0x40, 0x00, 0x03, 0xE0,
-    0x0B, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x3E, 0x00,
-    0x07, 0xE0, 0x00, 0x1F, 0x40, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00,
-    0x2F, 0x80, 0x01, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xBC, 0x00, 0x0B, 0xF0, 0x00, 0x3E, 0x00, 0x0B,
-    0xF4, 0x15, 0x5F, 0x95, 0x6F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x01, 0x56, 0xF9, 0x55, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xAA, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x07, 0x41, 0xFD, 0x00, 0x01, 0xF4, 0x01, 0xD0,
-    0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x74, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x1D, 0x00, 0x0B, 0xC0, 0x7C,
-    0x00, 0x07, 0x40, 0x00, 0xF4, 0x2D, 0x00, 0x01, 0xD0, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x74, 0x00,
-    0x03, 0xC3, 0xC0, 0x00, 0x1D, 0x00, 0x00, 0xF1, 0xF5, 0x55, 0x5B, 0x95, 0x55, 0x7D, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xAA, 0xAA, 0xFE, 0xAA, 0xAB, 0xD3, 0xC0, 0x00, 0x1D, 0x00, 0x00,
-    0xF0, 0xF0, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x3D, 0x00, 0x01, 0xD0, 0x00, 0x1F, 0x07, 0x80, 0x00,
-    0x74, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x1D, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x07, 0x40, 0x03, 0xD0,
-    0x02, 0xF0, 0x01, 0xD0, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x74, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x6E,
-    0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA,
-    0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xF1, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x7D, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x55, 0x6F, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xFF, 0x80, 0x00,
-    0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0xFB, 0xE0, 0x00, 0x03, 0xFB, 0xC0, 0x7C, 0x3E, 0x00, 0x03, 0xF0, 0xF4, 0x2D,
-    0x03, 0xE0, 0x03, 0xF0, 0x1E, 0x0F, 0x00, 0x3E, 0x03, 0xF0, 0x03, 0xC3, 0xC0, 0x03, 0xE3, 0xF0,
-    0x00, 0xF1, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x2D, 0x78, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0x5E, 0x00,
-    0x03, 0xFE, 0x00, 0x02, 0xD3, 0xC0, 0x03, 0xF7, 0xE0, 0x00, 0xF0, 0xF0, 0x03, 0xF0, 0x3E, 0x00,
-    0x3C, 0x3D, 0x03, 0xF0, 0x03, 0xE0, 0x1F, 0x07, 0x83, 0xF0, 0x00, 0x3E, 0x0B, 0x40, 0xF7, 0xF0,
-    0x00, 0x03, 0xE7, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x55, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00,
-    0x01, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0xF4, 0x00, 0x00, 0x02, 0xFB, 0xC0, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0xF4, 0x2D, 0x00, 0x00, 0x02,
-    0xF0, 0x1E, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xC3, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0xF1, 0xE0,
-    0x00, 0x02, 0xF0, 0x00, 0x2D, 0x78, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0x5E, 0x00, 0x02, 0xF0, 0x00,
-    0x02, 0xD3, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x3C, 0x3D, 0x02,
-    0xF0, 0x00, 0x00, 0x1F, 0x07, 0x82, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0xF6, 0xF0, 0x00, 0x00, 0x07,
-    0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x55, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFC, 0x3F, 0xE3, 0xFE, 0x2F, 0xC0, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xDB, 0xFC, 0x00, 0x2F, 0xF0,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4,
-    0x10, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xF9,
-    0xBE, 0x40, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x43, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE4,
-    0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC2, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_16_italicBitmaps[41192] = {
+    0xA5, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0x3D, 0xF6, 0x64, 0x31, 0xC2, 0xC5, 0xA4, 0x88, 0x22,
+    0xA4, 0x15, 0xB8, 0x47, 0x24, 0xF3, 0x03, 0x79, 0xCF, 0x43, 0x1A, 0x0A, 0x9A, 0x6D, 0x9E, 0x28,
+    0x52, 0xD0, 0xD0, 0xA2, 0x6D, 0x28, 0x28, 0x5E, 0x62, 0xF3, 0x03, 0x28, 0x1F, 0x41, 0x45, 0x43,
+    0x93, 0x22, 0x12, 0x6F, 0xF7, 0x59, 0xA1, 0xA0, 0x40, 0x42, 0x6E, 0xA8, 0x68, 0xAC, 0x48, 0x11,
+    0x15, 0x8A, 0x0B, 0xA3, 0x78, 0x89, 0xED, 0xE1, 0x1C, 0xFB, 0x65, 0x37, 0x11, 0x05, 0x42, 0xCC,
+    0x6A, 0x67, 0xC6, 0x33, 0x73, 0xEF, 0x3D, 0xF7, 0xCC, 0xB9, 0xF3, 0x10, 0x79, 0x0C, 0xC8, 0x4B,
+    0xD3, 0xA2, 0x40, 0xDA, 0x70, 0x6E, 0x2B, 0xF4, 0xC8, 0x7C, 0xDC, 0xC2, 0xC1, 0x34, 0x58, 0xC1,
+    0x54, 0xD8, 0x22, 0x29, 0xF1, 0x25, 0xDE, 0xC1, 0xD2, 0x3E, 0x87, 0xAB, 0x0C, 0xAD, 0x3C, 0x3C,
+    0x50, 0xBE, 0x9B, 0x54, 0x3B, 0x5B, 0xF5, 0xF6, 0xEB, 0x2E, 0xBB, 0xDB, 0x66, 0x71, 0xEB, 0x4C,
+    0x73, 0xDB, 0x54, 0x2B, 0x53, 0xDD, 0xA1, 0x91, 0xDA, 0x09, 0x63, 0xE0, 0x0E, 0x5A, 0x20, 0xC3,
+    0x57, 0x40, 0x5A, 0xDE, 0x02, 0x4C, 0x6D, 0x81, 0xCD, 0x9F, 0x9F, 0xFE, 0xEA, 0xF7, 0x21, 0x84,
+    0xF6, 0x83, 0xFD, 0x77, 0xD3, 0xB7, 0xB0, 0x7E, 0xC5, 0x9D, 0x8A, 0x3B, 0x51, 0x9B, 0x54, 0xC0,
+    0xE3, 0xB8, 0x01, 0x01, 0x74, 0xB0, 0x3C, 0x33, 0x26, 0xEC, 0x02, 0xE2, 0x36, 0xA5, 0xD7, 0x47,
+    0xA6, 0xD6, 0x0E, 0x5D, 0x5A, 0x82, 0x43, 0x52, 0xDD, 0x66, 0x1C, 0x1F, 0xE1, 0xB2, 0xD1, 0x07,
+    0x9D, 0xB0, 0x63, 0x2C, 0x65, 0x80, 0xE3, 0xE0, 0xE5, 0xC6, 0x9B, 0x8B, 0x1F, 0x46, 0x9C, 0xD9,
+    0x4F, 0x5A, 0x5B, 0xB5, 0x79, 0xD4, 0xBF, 0x6F, 0x9A, 0xEC, 0x49, 0x7D, 0x1D, 0xE3, 0x87, 0xB4,
+    0x79, 0xC9, 0x73, 0xF9, 0x40, 0x83, 0x40, 0xCB, 0x38, 0x30, 0x84, 0x0D, 0x25, 0xA2, 0xDF, 0x07,
+    0xF8, 0x5B, 0xB6, 0xD9, 0x9A, 0x2A, 0xA4, 0xD5, 0x9D, 0xB4, 0x19, 0x93, 0x72, 0x4A, 0xDB, 0x47,
+    0x59, 0x55, 0x3C, 0xBF, 0xD7, 0x45, 0x44, 0xC6, 0xB3, 0x13, 0x0D, 0x08, 0x96, 0x98, 0x96, 0x70,
+    0x42, 0x05, 0x21, 0x25, 0xFA, 0xD7, 0xDA, 0x0D, 0xC0, 0x3D, 0xD4, 0xA9, 0x28, 0xF4, 0x20, 0xD9,
+    0x49, 0xB3, 0x63, 0x46, 0xB0, 0xE5, 0x0A, 0x49, 0x4D, 0xC2, 0xD7, 0x9C, 0x72, 0x77, 0xCD, 0x29,
+    0x3D, 0xAC, 0xE5, 0x65, 0x37, 0x33, 0xC0, 0x61, 0xCB, 0xDB, 0xE0, 0xD0, 0xA7, 0xD5, 0x91, 0xDF,
+    0x45, 0x6D, 0x86, 0x7D, 0xFB, 0x20, 0xA9, 0x57, 0xE6, 0xAF, 0xC1, 0x05, 0xFF, 0xD8, 0x56, 0xF7,
+    0xD3, 0x5E, 0xAB, 0x6B, 0x91, 0xBB, 0xD6, 0x20, 0xAF, 0x1C, 0x1C, 0xBD, 0xAC, 0xE4, 0x4E, 0x9E,
+    0xE8, 0x6A, 0xC7, 0x3F, 0x5E, 0xF7, 0x8E, 0xD3, 0x94, 0x57, 0xCB, 0x69, 0xE6, 0x91, 0x7F, 0x5F,
+    0xE9, 0x6C, 0x36, 0xCD, 0xC8, 0xA3, 0x93, 0x2B, 0xC8, 0xF1, 0xA8, 0x3E, 0x0A, 0x73, 0x1E, 0xE7,
+    0x99, 0x72, 0xB3, 0x7E, 0xA7, 0x8D, 0x36, 0xD5, 0xC7, 0x9A, 0x72, 0xE1, 0x0D, 0xD4, 0x4E, 0xFB,
+    0x14, 0x02, 0xAE, 0x21, 0xFD, 0x8D, 0x48, 0x1B, 0xEC, 0x3B, 0x05, 0xCF, 0x1A, 0x44, 0xFB, 0x3A,
+    0x9D, 0x90, 0x86, 0xD6, 0xBC, 0x68, 0xD3, 0xF0, 0x10, 0x7D, 0x1E, 0x4F, 0x0D, 0x5C, 0xD4, 0xDF,
+    0xBA, 0x2D, 0x21, 0xD4, 0xBC, 0xCC, 0x2D, 0xE5, 0xB7, 0x25, 0x1E, 0xD3, 0x93, 0x80, 0x1D, 0xEC,
+    0xD3, 0x56, 0xE0, 0x0A, 0xC6, 0x2E, 0x18, 0xBB, 0x84, 0x99, 0x36, 0xFB, 0x49, 0xF7, 0x11, 0x9E,
+    0x73, 0x70, 0xA1, 0x71, 0xF4, 0x73, 0xA4, 0xD9, 0x0C, 0xF2, 0xA6, 0x47, 0xB9, 0xA5, 0x08, 0xB3,
+    0x8F, 0x5A, 0x17, 0x37, 0xAB, 0xF9, 0x06, 0xE6, 0x26, 0x19, 0x9D, 0xD3, 0xAE, 0x46, 0xC4, 0x8B,
+    0xCD, 0x4A, 0x91, 0x2E, 0x89, 0x33, 0x86, 0x18, 0x47, 0xCE, 0xD4, 0xBA, 0x65, 0x65, 0xAD, 0x94,
+    0x2E, 0xA7, 0xCA, 0x4A, 0x84, 0x93, 0x1B, 0x3C, 0xB8, 0xFA, 0xD4, 0xAE, 0x32, 0xBD, 0x8F, 0xD9,
+    0x93, 0x6C, 0x49, 0xE0, 0xBC, 0x25, 0x77, 0xA9, 0xFE, 0xFD, 0x15, 0x79, 0xEF, 0x1D, 0x8E, 0x9E,
+    0x61, 0x8E, 0xF8, 0xBA, 0x89, 0xC8, 0x63, 0xAE, 0x42, 0xA0, 0x65, 0x85, 0x96, 0xB5, 0xE2, 0x9D,
+    0x1D, 0x3E, 0xAB, 0x65, 0xB7, 0xBF, 0x84, 0x8A, 0x03, 0xD4, 0xFB, 0x8B, 0x0B, 0x02, 0x89, 0xC5,
+    0xB1, 0x9F, 0x07, 0x96, 0x63, 0xD2, 0x2E, 0xD8, 0xE7, 0x96, 0xFA, 0xB7, 0x6D, 0xE5, 0xAC, 0xCF,
+    0x7F, 0x41, 0x32, 0x9E, 0x61, 0x3F, 0xA6, 0x7F, 0x7C, 0x91, 0x7F, 0x83, 0xCC, 0xE2, 0x1A, 0xE3,
+    0xB2, 0x96, 0x23, 0xBC, 0x91, 0xA9, 0xC0, 0xAC, 0x11, 0x6D, 0x2E, 0x36, 0x2E, 0x84, 0x81, 0x65,
+    0xD9, 0xFE, 0x73, 0xF7, 0x95, 0x9C, 0x87, 0x68, 0xC4, 0x48, 0xD8, 0x43, 0xDC, 0x26, 0x4D, 0x56,
+    0x9E, 0xE1, 0x3A, 0x8A, 0xF0, 0x34, 0x84, 0x9F, 0x54, 0x08, 0xE9, 0xCF, 0x2F, 0xC6, 0xE9, 0x68,
+    0xD6, 0x8E, 0x4A, 0x42, 0x19, 0xCD, 0x1A, 0x39, 0xC8, 0x65, 0x49, 0x6E, 0x59, 0x1E, 0xFE, 0xF3,
+    0x72, 0xF2, 0x2F, 0xCB, 0x38, 0x48, 0xF7, 0x2D, 0x02, 0xC1, 0x9E, 0x35, 0x6C, 0x02, 0xA5, 0x6B,
+    0x9B, 0x44, 0xAF, 0x5C, 0x3C, 0x48, 0x0C, 0xA3, 0xA4, 0x30, 0x1A, 0x66, 0x32, 0x89, 0xB0, 0x91,
+    0xCF, 0x1E, 0x46, 0x2A, 0x04, 0x03, 0xD5, 0x1D, 0x0D, 0xAE, 0x42, 0x3C, 0xE4, 0x94, 0x5C, 0xA7,
+    0xAE, 0x25, 0xAD, 0x69, 0xC3, 0x99, 0xAD, 0xD8, 0xB9, 0x32, 0xA7, 0x2A, 0xE1, 0x6A, 0x56, 0x85,
+    0xBD, 0x38, 0xED, 0xC0, 0x47, 0x89, 0x36, 0x41, 0x35, 0x72, 0xB4, 0xC4, 0xF5, 0x38, 0x6D, 0x92,
+    0xD0, 0x99, 0x30, 0xE0, 0xA8, 0x20, 0xC2, 0x4A, 0xCF, 0xAA, 0x82, 0x0D, 0xD2, 0xB2, 0x24, 0xF8,
+    0xC6, 0xB7, 0x2B, 0x25, 0x4E, 0xDD, 0xE6, 0xF2, 0x5D, 0xD4, 0x74, 0xF9, 0x63, 0x08, 0xC4, 0x74,
+    0x4C, 0xD2, 0x52, 0x11, 0x1A, 0xD8, 0xD9, 0x8E, 0x2F, 0xEE, 0x1E, 0x49, 0xA7, 0x7A, 0xAD, 0x13,
+    0x8F, 0x82, 0xA9, 0xC7, 0x4A, 0xDD, 0x8A, 0x64, 0x95, 0x41, 0x2A, 0x46, 0xF6, 0x5C, 0x4E, 0xBB,
+    0xC3, 0xC4, 0xB6, 0x87, 0x2D, 0x16, 0xE1, 0x52, 0xC8, 0x84, 0x8F, 0x44, 0x97, 0x51, 0xF0, 0x31,
+    0xBD, 0xCB, 0xFF, 0x41, 0xCF, 0x2A, 0x73, 0x9F, 0xA3, 0x39, 0x52, 0x95, 0x31, 0x23, 0xD3, 0x47,
+    0x13, 0x55, 0x9F, 0xB6, 0x7C, 0xC1, 0xCF, 0x79, 0xB7, 0x22, 0x47, 0xA4, 0x11, 0x00, 0x2D, 0xE9,
+    0xA2, 0x68, 0x84, 0xCA, 0x2F, 0xF0, 0x90, 0x29, 0x8C, 0xF0, 0x28, 0x2D, 0x25, 0x31, 0x07, 0x36,
+    0xA3, 0x1E, 0x51, 0x8F, 0x7B, 0xA1, 0x36, 0xCA, 0xC7, 0x29, 0xCC, 0x8D, 0xC3, 0xA3, 0xD2, 0x1C,
+    0xB0, 0x18, 0xD9, 0xE7, 0xD2, 0xD8, 0x4B, 0x49, 0xBC, 0x90, 0x0F, 0x06, 0xCA, 0x3F, 0x16, 0x47,
+    0x14, 0x76, 0xEE, 0x07, 0x98, 0x9E, 0x39, 0xBB, 0xD2, 0x56, 0x71, 0x4F, 0x50, 0xAE, 0x8C, 0xBB,
+    0x58, 0x3F, 0x53, 0x04, 0x1A, 0x26, 0xFD, 0x7A, 0xF4, 0x9B, 0xCD, 0x67, 0xCF, 0xFC, 0x5C, 0x00,
+    0x07, 0x31, 0x08, 0x8F, 0x2B, 0x0F, 0x75, 0x17, 0x6D, 0x36, 0x27, 0x54, 0xC2, 0xA4, 0xC7, 0xA3,
+    0x9E, 0xB3, 0x70, 0x7E, 0xA9, 0x9F, 0xB9, 0xA4, 0x12, 0x41, 0xD9, 0xF7, 0x7A, 0x5B, 0xD8, 0xDD,
+    0x14, 0xF1, 0x11, 0x51, 0x2F, 0x2C, 0x09, 0xE2, 0x4C, 0xB2, 0xBC, 0xCD, 0xD9, 0x89, 0x01, 0xA7,
+    0x3A, 0xED, 0x11, 0x9D, 0xEA, 0x51, 0x23, 0xBD, 0xC5, 0x74, 0xA5, 0xBB, 0xE3, 0x4E, 0x59, 0xD3,
+    0xC4, 0x4D, 0x74, 0xA2, 0x94, 0x93, 0xF1, 0x15, 0x45, 0xF2, 0x36, 0x5F, 0xC7, 0xEC, 0x92, 0xA4,
+    0x3C, 0x94, 0x7D, 0x0F, 0xFB, 0xEC, 0x78, 0x94, 0x50, 0x82, 0xC2, 0x14, 0xCA, 0x23, 0xBF, 0xEC,
+    0xE6, 0xCF, 0x73, 0x6D, 0xE8, 0x08, 0x35, 0x60, 0x3B, 0xFA, 0x32, 0x92, 0x1D, 0x4B, 0x5A, 0xE9,
+    0x79, 0xFC, 0x8F, 0xF6, 0x37, 0xA5, 0x55, 0x3D, 0x6F, 0xE5, 0x54, 0x10, 0x1D, 0xDB, 0x4A, 0x8C,
+    0x70, 0x71, 0x53, 0x04, 0x9A, 0x08, 0x5C, 0x53, 0xDD, 0x86, 0x32, 0xC4, 0xFE, 0x07, 0x7C, 0x48,
+    0x6F, 0x91, 0xE0, 0x17, 0x44, 0x14, 0x69, 0x28, 0xC3, 0xB3, 0x7F, 0x02, 0x0D, 0x7F, 0x61, 0x85,
+    0x92, 0x62, 0x5B, 0x8A, 0x7D, 0xCF, 0x96, 0xB6, 0xA4, 0x31, 0x2D, 0x14, 0x18, 0x29, 0x12, 0xDA,
+    0xD0, 0x5C, 0x90, 0x85, 0x1C, 0xB0, 0x7D, 0x39, 0x67, 0xEE, 0xCB, 0xCB, 0x66, 0x05, 0x15, 0x56,
+    0x3C, 0x79, 0xBE, 0x9E, 0x3B, 0x73, 0xE6, 0xCC, 0x99, 0xEB, 0x83, 0xD5, 0x6A, 0x95, 0x78, 0xEF,
+    0x7F, 0xC1, 0x3D, 0x6E, 0x56, 0x4F, 0xA6, 0x33, 0x91, 0xC9, 0x88, 0xCC, 0x69, 0x2D, 0xB3, 0x88,
+    0x6C, 0x71, 0x57, 0xBB, 0xBB, 0x28, 0x71, 0xD7, 0x22, 0xB6, 0x15, 0xC9, 0x71, 0x9B, 0x5E, 0x24,
+    0x73, 0x22, 0xE9, 0x20, 0x92, 0x4C, 0x22, 0x11, 0x37, 0x78, 0x3A, 0x97, 0xC1, 0x29, 0xED, 0xF0,
+    0xF0, 0x91, 0xF0, 0x3A, 0x19, 0xB1, 0xE4, 0x07, 0x31, 0x77, 0x4D, 0x97, 0x8C, 0xB2, 0x20, 0x70,
+    0xEA, 0x4C, 0x27, 0x6B, 0x64, 0xC9, 0x3A, 0xD3, 0x47, 0x93, 0x34, 0x65, 0x25, 0xC9, 0x52, 0xB5,
+    0x62, 0x3C, 0xF6, 0x35, 0xD8, 0x50, 0x35, 0x0E, 0x71, 0x9A, 0x36, 0xEB, 0xE3, 0x19, 0x0E, 0xC6,
+    0x01, 0x41, 0x93, 0x38, 0x24, 0x05, 0x9C, 0x05, 0x61, 0x6C, 0x6B, 0x87, 0x7C, 0x10, 0xEF, 0x27,
+    0x89, 0xFD, 0x7C, 0x9F, 0xCC, 0xDE, 0x00, 0x17, 0x96, 0xC4, 0x5F, 0x73, 0x13, 0xA0, 0x55, 0x48,
+    0x96, 0x20, 0x79, 0x67, 0x5A, 0x54, 0xC1, 0xCD, 0xF1, 0x24, 0xC9, 0x00, 0xF0, 0xA6, 0xCB, 0x3B,
+    0xBC, 0x2E, 0x3A, 0x2C, 0x54, 0x1E, 0x89, 0x61, 0x44, 0xDE, 0xFE, 0x74, 0x60, 0xBD, 0x28, 0x01,
+    0xCB, 0x08, 0x08, 0x3C, 0x09, 0xC3, 0x37, 0xF8, 0x71, 0x31, 0x49, 0xD4, 0xF8, 0x52, 0x52, 0xA2,
+    0x8C, 0x34, 0xE1, 0x71, 0x34, 0x27, 0x73, 0x32, 0xC5, 0x4E, 0x5E, 0xBB, 0x2C, 0x8A, 0xF2, 0xE5,
+    0x22, 0xC7, 0x0A, 0x0D, 0x99, 0x7C, 0x09, 0x34, 0x59, 0x27, 0xFF, 0x7A, 0xA1, 0x32, 0xB8, 0xA0,
+    0xC6, 0x89, 0x3F, 0xAD, 0x44, 0xA3, 0xE4, 0x75, 0x3C, 0x48, 0x14, 0x5E, 0x83, 0xD4, 0x9C, 0x69,
+    0x25, 0x22, 0xCC, 0x41, 0xF2, 0x19, 0x0F, 0xA5, 0x82, 0xAB, 0xD0, 0x89, 0x1C, 0x84, 0x65, 0x0B,
+    0x10, 0x7B, 0xB4, 0xA8, 0xE9, 0x03, 0xFC, 0x77, 0xB8, 0xF1, 0xAD, 0xD5, 0xEA, 0x13, 0xB4, 0xF7,
+    0x7B, 0xCF, 0xD2, 0xF6, 0xD7, 0x01, 0x3A, 0x6F, 0xC1, 0x1C, 0x0A, 0x76, 0x47, 0x78, 0x46, 0xC5,
+    0x29, 0x6A, 0x64, 0x48, 0x26, 0xD0, 0x98, 0x96, 0x31, 0xC1, 0x40, 0xEE, 0x24, 0x5D, 0xB0, 0x5C,
+    0x33, 0x30, 0x17, 0x99, 0xA7, 0xDE, 0x05, 0x3A, 0xC7, 0x9E, 0xD6, 0x78, 0x67, 0x7E, 0x1B, 0xDF,
+    0x00, 0x74, 0x79, 0xAE, 0x7F, 0x23, 0x6B, 0xC8, 0xB4, 0x9C, 0x99, 0x3F, 0xC1, 0x7C, 0x8E, 0x40,
+    0xDF, 0x12, 0x67, 0xD6, 0xEF, 0xB6, 0xBE, 0x59, 0x52, 0x27, 0xD0, 0x14, 0xBC, 0x8E, 0xC3, 0xD2,
+    0x4A, 0x19, 0x3D, 0x84, 0x1A, 0x85, 0x5D, 0xF4, 0x9E, 0xB8, 0x96, 0x92, 0x70, 0xE2, 0x25, 0x68,
+    0x8B, 0x55, 0x40, 0x0E, 0x94, 0xA2, 0x64, 0x10, 0x87, 0x9C, 0x1F, 0xC8, 0x1A, 0x64, 0x15, 0x8B,
+    0x4B, 0xFA, 0x42, 0xCC, 0xAF, 0x5E, 0xCE, 0xD2, 0x2E, 0x71, 0x59, 0x9F, 0xF4, 0x93, 0x6C, 0xE4,
+    0x54, 0xCE, 0x4C, 0x6D, 0xEA, 0xB4, 0x4D, 0x7E, 0x70, 0xD1, 0x20, 0xDF, 0xC9, 0xA5, 0x15, 0xB8,
+    0x95, 0xE6, 0x85, 0x4B, 0x1C, 0x9A, 0x36, 0x14, 0x72, 0x46, 0x0D, 0x24, 0xD8, 0x6E, 0x5C, 0xD6,
+    0x15, 0xF8, 0xF9, 0x73, 0x3C, 0xE0, 0x71, 0xF9, 0xFD, 0xEF, 0x19, 0xAE, 0x76, 0x32, 0x5E, 0xD0,
+    0x88, 0x73, 0x79, 0x2F, 0x28, 0x9F, 0xD7, 0x1C, 0xFE, 0x51, 0xFC, 0xDA, 0x6A, 0xD4, 0xF4, 0x2E,
+    0x25, 0x72, 0xB7, 0xA2, 0x4A, 0x22, 0x20, 0x67, 0x95, 0x90, 0xCA, 0xD7, 0x8F, 0xBB, 0x7C, 0xA4,
+    0x76, 0x52, 0x1B, 0xFA, 0x51, 0xA9, 0x1E, 0x0A, 0x0D, 0x64, 0xD7, 0xB4, 0xE6, 0x43, 0x26, 0xC9,
+    0x5E, 0x50, 0x50, 0x49, 0x47, 0xDF, 0xA4, 0xB7, 0xE8, 0x7F, 0xE4, 0x94, 0xBA, 0x31, 0xE2, 0xD2,
+    0x73, 0x20, 0x13, 0x20, 0x07, 0xB3, 0x62, 0xAF, 0xAE, 0xB1, 0xDD, 0x78, 0x0F, 0x8A, 0xCC, 0xED,
+    0x55, 0xD3, 0x72, 0xF6, 0x52, 0x47, 0xE2, 0x91, 0x0A, 0xD0, 0x83, 0xAC, 0x38, 0xB2, 0x1B, 0x0E,
+    0x6B, 0x0C, 0x5A, 0x4F, 0xFC, 0x1F, 0x70, 0x37, 0x3E, 0x40, 0xC1, 0x23, 0xDB, 0x0B, 0x31, 0xC8,
+    0xD3, 0x31, 0xE3, 0x74, 0x84, 0xBE, 0x6D, 0x83, 0x49, 0xB9, 0x11, 0xED, 0xC4, 0x40, 0x75, 0x31,
+    0x27, 0x09, 0x40, 0x90, 0xAE, 0x94, 0x9C, 0x43, 0x63, 0x4B, 0x4C, 0x61, 0xC1, 0x61, 0x29, 0x98,
+    0xAF, 0xA2, 0x59, 0xD3, 0x6C, 0xD8, 0x28, 0x0D, 0x06, 0xD9, 0xBB, 0x68, 0xFE, 0xB8, 0x6A, 0x2D,
+    0x41, 0x22, 0xCF, 0x63, 0x5A, 0x2E, 0xFC, 0x0D, 0x94, 0x8B, 0x37, 0xF9, 0x5F, 0x9F, 0x2F, 0x52,
+    0xD5, 0xF2, 0x15, 0x4F, 0x93, 0x4B, 0x6C, 0x94, 0x4B, 0xD6, 0xFC, 0x25, 0xAB, 0x14, 0x5B, 0xEF,
+    0x8E, 0x21, 0x2D, 0x5D, 0x0F, 0xA5, 0x60, 0x9A, 0xBD, 0x79, 0x58, 0x53, 0x7D, 0x14, 0xE0, 0xB6,
+    0xA7, 0xE4, 0xBA, 0xCC, 0x5F, 0xF9, 0x1A, 0x29, 0x66, 0x26, 0x7B, 0x38, 0x98, 0x76, 0xA5, 0x23,
+    0x45, 0xA3, 0xEC, 0x3D, 0x1D, 0x0F, 0x7D, 0x4B, 0xC6, 0xAC, 0xB2, 0x97, 0xAA, 0x8E, 0x51, 0x18,
+    0xC8, 0x04, 0x22, 0x42, 0x01, 0x67, 0x9D, 0xDA, 0xF6, 0xC1, 0xE6, 0x35, 0x05, 0x61, 0xD5, 0x02,
+    0x5F, 0xA4, 0x44, 0xE0, 0x80, 0xAA, 0x74, 0xAA, 0xD7, 0xF7, 0xC4, 0x43, 0xEC, 0xB3, 0xE2, 0x9C,
+    0x78, 0x9E, 0x44, 0x73, 0x54, 0x61, 0xCE, 0x3D, 0x69, 0x7C, 0x44, 0x48, 0x81, 0xA5, 0xDA, 0xA8,
+    0x82, 0x2E, 0x6E, 0xD1, 0x58, 0xF0, 0xFE, 0x81, 0xCE, 0x90, 0x6E, 0xAC, 0x43, 0x79, 0xCA, 0x05,
+    0x91, 0x68, 0x93, 0x01, 0xE2, 0x9A, 0x27, 0x26, 0xCB, 0xB3, 0xB7, 0x57, 0xAF, 0xBE, 0x51, 0xB1,
+    0x10, 0xC3, 0x11, 0xF7, 0x9C, 0xF2, 0x4D, 0xAE, 0xD1, 0xEA, 0x68, 0xFE, 0xEC, 0x59, 0xC7, 0x19,
+    0x73, 0x34, 0xA3, 0x26, 0x5E, 0x82, 0x39, 0x5C, 0xAE, 0x66, 0xB2, 0x70, 0x4A, 0x4F, 0x35, 0xEF,
+    0x93, 0x02, 0x09, 0xB3, 0xAB, 0xC1, 0xB5, 0x23, 0xE6, 0x47, 0xE4, 0xCA, 0x79, 0xB0, 0x68, 0xD6,
+    0xD7, 0x7A, 0xA3, 0x62, 0xDE, 0xEE, 0xA7, 0x65, 0xBA, 0x47, 0x63, 0xA1, 0x32, 0x94, 0xEC, 0x5E,
+    0xE9, 0xC0, 0x9D, 0x66, 0x1F, 0xA4, 0x7A, 0xF9, 0xC5, 0xCC, 0xFE, 0x5B, 0x4E, 0x7A, 0xD6, 0x22,
+    0x60, 0xDC, 0xB3, 0x54, 0xA7, 0xE9, 0x34, 0x7B, 0x32, 0xEC, 0x27, 0x48, 0xB3, 0x60, 0x22, 0x73,
+    0xFF, 0x13, 0x4E, 0x1B, 0xFF, 0x27, 0x16, 0x4F, 0x06, 0x2E, 0x4E, 0x1C, 0xD3, 0x02, 0x1D, 0x40,
+    0x6B, 0x40, 0x2F, 0x3E, 0x31, 0x6C, 0x64, 0xE4, 0x5F, 0x3E, 0x9B, 0x08, 0x77, 0x61, 0xFA, 0x1B,
+    0x1E, 0xDD, 0x81, 0xEF, 0x1E, 0xC2, 0x80, 0x9E, 0xF9, 0x29, 0xA9, 0xE5, 0xA2, 0x93, 0x18, 0x78,
+    0x79, 0x4C, 0x6F, 0x43, 0x36, 0x96, 0x35, 0x85, 0x8A, 0x43, 0x47, 0xC9, 0x24, 0x4E, 0x1C, 0x25,
+    0x62, 0x1B, 0x56, 0xE8, 0x03, 0x16, 0x3D, 0x7D, 0x48, 0x29, 0x7C, 0xBE, 0x59, 0x3D, 0xD9, 0xF9,
+    0x6C, 0xF6, 0x3E, 0xD1, 0x2E, 0x0E, 0xA8, 0x49, 0x43, 0x9C, 0x78, 0xE7, 0x33, 0xEF, 0x7C, 0x02,
+    0x47, 0xF8, 0x12, 0x64, 0xC0, 0xD3, 0xF8, 0x9A, 0x9F, 0xB2, 0xCA, 0xFF, 0xC7, 0x37, 0xE3, 0xFF,
+    0x5E, 0xFF, 0x00, 0xAD, 0x55, 0xB1, 0x8E, 0xE5, 0x44, 0x10, 0x6C, 0xDB, 0x02, 0x4B, 0x38, 0x30,
+    0x19, 0x48, 0x04, 0x93, 0x92, 0x39, 0xBD, 0x60, 0x79, 0x63, 0x91, 0x92, 0x90, 0x20, 0x24, 0x22,
+    0xFE, 0x60, 0x13, 0x42, 0xF6, 0xD9, 0xE8, 0x42, 0x12, 0x72, 0x72, 0x84, 0x8E, 0x80, 0x1F, 0x78,
+    0xEF, 0xD9, 0xE2, 0x44, 0x44, 0x80, 0x05, 0x01, 0xA9, 0x83, 0xCB, 0xB1, 0x4E, 0x46, 0xF2, 0x0A,
+    0xDB, 0x43, 0x55, 0xCD, 0xEE, 0xDE, 0x5E, 0x80, 0x48, 0xB0, 0xDE, 0xCE, 0x78, 0xED, 0x9E, 0xEE,
+    0xEA, 0xEA, 0xEA, 0xB6, 0xF9, 0x30, 0x59, 0x08, 0xB5, 0x5D, 0x0F, 0x66, 0x67, 0xB3, 0x6C, 0x36,
+    0x2B, 0x7B, 0xB3, 0xC6, 0x2C, 0x5D, 0x70, 0x8B, 0xA7, 0xDE, 0xCC, 0x56, 0xB3, 0x7C, 0x32, 0xAB,
+    0x5A, 0xB3, 0x0D, 0x46, 0xB8, 0x75, 0x30, 0x3A, 0xBE, 0x66, 0x94, 0xC0, 0xA8, 0x0B, 0x75, 0x11,
+    0x60, 0x81, 0x87, 0x61, 0xE5, 0x82, 0xD7, 0x49, 0x57, 0x9B, 0x6C, 0xCD, 0x2E, 0x5C, 0xF4, 0x1A,
+    0x2F, 0x75, 0x40, 0x0E, 0x2C, 0x45, 0x54, 0x85, 0x96, 0x6B, 0x85, 0xB2, 0x62, 0xB4, 0xE8, 0x5A,
+    0x78, 0xE2, 0xC2, 0xA0, 0x02, 0x61, 0x9E, 0x3E, 0x89, 0x8C, 0x48, 0xEF, 0x1C, 0xCB, 0x27, 0xDC,
+    0xBD, 0x4F, 0x27, 0x4D, 0x87, 0xA3, 0x4D, 0x80, 0x6D, 0xC5, 0x08, 0xF1, 0xF2, 0x61, 0xF4, 0xA1,
+    0x2F, 0xC3, 0xEC, 0xC2, 0xC0, 0x8C, 0x91, 0x77, 0x31, 0xD8, 0xAE, 0xD8, 0xBB, 0x3C, 0x10, 0x5C,
+    0x93, 0x70, 0xAD, 0xBE, 0xA2, 0xBF, 0xF2, 0x37, 0x9E, 0xCE, 0x5E, 0xCA, 0x47, 0x98, 0x15, 0x50,
+    0x09, 0x54, 0x3F, 0x0A, 0xD5, 0xEF, 0x7A, 0x3D, 0x35, 0x35, 0xD3, 0x29, 0x26, 0x25, 0x1A, 0x04,
+    0xD2, 0x8D, 0x84, 0x9F, 0xEE, 0xCA, 0xC9, 0x8F, 0xCC, 0x36, 0x0B, 0x56, 0x80, 0x16, 0x3F, 0x17,
+    0x21, 0x58, 0x1A, 0x04, 0xE9, 0x0D, 0xA2, 0xC2, 0xB9, 0x40, 0xA8, 0x2C, 0x02, 0xAB, 0x10, 0xB9,
+    0x50, 0xCA, 0xCD, 0x3D, 0x47, 0xA2, 0xC2, 0xDF, 0xE7, 0x29, 0x8A, 0xC4, 0xC4, 0x76, 0xCF, 0x9A,
+    0xC8, 0x01, 0xCD, 0x4F, 0x60, 0x9E, 0x8E, 0x30, 0x2F, 0x6B, 0x98, 0x9F, 0x92, 0xED, 0xB3, 0x1F,
+    0xC6, 0x2E, 0x84, 0xF0, 0x11, 0xFE, 0x70, 0x34, 0x63, 0xB4, 0x6E, 0xD3, 0x9E, 0xB0, 0x3E, 0x7E,
+    0xC6, 0x7D, 0xAB, 0x3D, 0x07, 0x21, 0x76, 0x5C, 0xAC, 0x64, 0xC9, 0xCE, 0x8B, 0x39, 0xC6, 0x5B,
+    0x56, 0x3B, 0xB0, 0xBC, 0xF3, 0x6A, 0x27, 0xEC, 0xE9, 0xB4, 0xDA, 0xEC, 0x19, 0xF3, 0x9C, 0x4E,
+    0xDC, 0xC7, 0x73, 0x36, 0x60, 0xCF, 0xFB, 0x63, 0xD1, 0x1F, 0x89, 0xDA, 0x97, 0x84, 0x51, 0xB6,
+    0xFE, 0xC0, 0xDD, 0xD5, 0xFE, 0x4B, 0xD6, 0xA7, 0xB2, 0x6A, 0x66, 0x6E, 0xDE, 0xAA, 0x89, 0xFB,
+    0x8D, 0xB9, 0x81, 0xFB, 0x89, 0x79, 0xAE, 0xCC, 0xAA, 0xE4, 0x92, 0x2C, 0x51, 0x23, 0x55, 0x40,
+    0x3A, 0x28, 0x53, 0xC3, 0xDD, 0xA3, 0x5C, 0x82, 0x09, 0xF2, 0x16, 0x6C, 0x8B, 0xE5, 0x38, 0x51,
+    0xD5, 0x96, 0xED, 0xE2, 0x04, 0xC4, 0xDA, 0xC1, 0x94, 0x06, 0xB6, 0xFC, 0xCF, 0x1E, 0xDE, 0xAD,
+    0xF8, 0x75, 0x80, 0x73, 0x2B, 0x7F, 0x99, 0xE8, 0xBE, 0x7C, 0x3A, 0x1B, 0x5C, 0xBB, 0x0F, 0x17,
+    0x03, 0xB7, 0xCE, 0xD6, 0x64, 0x26, 0xA6, 0x4B, 0x3A, 0xD1, 0x83, 0x27, 0x83, 0x07, 0xF3, 0x4F,
+    0x47, 0x01, 0x7B, 0x3E, 0x08, 0xD7, 0x1F, 0x3D, 0x11, 0xE5, 0x7F, 0x6B, 0xCB, 0x08, 0x64, 0x01,
+    0x65, 0xAD, 0xF1, 0x28, 0x98, 0xAA, 0x70, 0xDB, 0x51, 0xF3, 0x6D, 0xAC, 0x8B, 0xD9, 0xDB, 0x0F,
+    0x4A, 0x63, 0x27, 0xC0, 0x7F, 0xC0, 0xA1, 0x7C, 0xFF, 0x04, 0x6B, 0xD3, 0xE2, 0x97, 0xE3, 0x60,
+    0x67, 0x1E, 0x64, 0xEF, 0x29, 0x30, 0xA5, 0x2B, 0x4B, 0x5C, 0x4C, 0x1D, 0xAB, 0xF7, 0x9C, 0x25,
+    0x6F, 0xF8, 0x20, 0x59, 0x59, 0xF4, 0xE2, 0x25, 0xEB, 0xEC, 0xBF, 0x66, 0x69, 0xB7, 0xAA, 0x67,
+    0xC9, 0x69, 0xE7, 0x29, 0xCB, 0x64, 0x55, 0x9F, 0x0E, 0x25, 0x5E, 0xEE, 0x06, 0xA5, 0xB9, 0x09,
+    0xEC, 0xBE, 0xB3, 0x2B, 0xE2, 0x40, 0xDE, 0xA4, 0xD4, 0x8F, 0x1F, 0xD0, 0xBC, 0x47, 0x79, 0x41,
+    0x04, 0xB3, 0x7D, 0xB7, 0x80, 0xBA, 0x94, 0x72, 0x47, 0xCA, 0x4D, 0x5C, 0x72, 0x2E, 0xE8, 0xB7,
+    0x23, 0x45, 0xB6, 0xA1, 0x1E, 0x50, 0x50, 0xD9, 0x43, 0xCD, 0xEE, 0xE7, 0xAE, 0x87, 0xCB, 0x8D,
+    0x15, 0xF8, 0xE6, 0x71, 0xBF, 0xFD, 0x5B, 0x37, 0x57, 0x12, 0x17, 0x97, 0x87, 0xAB, 0xE2, 0x49,
+    0xA8, 0x9D, 0x52, 0x33, 0x77, 0xFB, 0x29, 0x65, 0x2F, 0x32, 0x2C, 0x21, 0xDE, 0xDE, 0xB2, 0x38,
+    0x42, 0xD8, 0x3C, 0xC8, 0x87, 0x32, 0xC7, 0x6D, 0x4C, 0x58, 0x6D, 0xCE, 0xCD, 0xF4, 0xB0, 0x89,
+    0x63, 0xA1, 0x8B, 0xDD, 0x70, 0x89, 0x2D, 0xC2, 0x0D, 0xD6, 0x5D, 0x1C, 0x0A, 0x34, 0xE9, 0x74,
+    0x47, 0x3C, 0x1E, 0xEC, 0xD3, 0xFB, 0x48, 0x8E, 0xAC, 0xD8, 0xDE, 0x64, 0x51, 0x52, 0xB5, 0xC1,
+    0xDD, 0x70, 0xC0, 0xCB, 0x38, 0x1E, 0x92, 0xF8, 0x9F, 0x55, 0x4A, 0x08, 0xD5, 0xFE, 0xEB, 0x0E,
+    0xFD, 0xFE, 0xFD, 0x2B, 0xF8, 0xE0, 0x71, 0xB4, 0xC7, 0x57, 0xD2, 0x85, 0x17, 0x4C, 0x18, 0x19,
+    0xBF, 0x75, 0xDD, 0x76, 0x2D, 0x1A, 0x57, 0x71, 0x89, 0x2F, 0x93, 0xCC, 0xC5, 0x29, 0x40, 0xAF,
+    0x12, 0x75, 0x1B, 0x79, 0xB5, 0x35, 0xDF, 0x58, 0xA5, 0x9D, 0x9E, 0x39, 0x78, 0xFC, 0xB7, 0x03,
+    0x3B, 0x8A, 0x79, 0x36, 0x2C, 0x6D, 0x3E, 0xB2, 0x9B, 0xCF, 0x1C, 0x25, 0x65, 0x4F, 0x82, 0x56,
+    0x55, 0x19, 0x69, 0xB6, 0x55, 0x18, 0x53, 0xF4, 0xF2, 0xAE, 0x16, 0xD0, 0xFC, 0x88, 0x7A, 0xDB,
+    0x6B, 0x82, 0x4C, 0xB7, 0x64, 0x03, 0x02, 0x57, 0x9F, 0xD1, 0x90, 0xDE, 0x12, 0xCE, 0x81, 0xCF,
+    0x33, 0x5A, 0x02, 0x9C, 0x95, 0x4C, 0x8E, 0x29, 0x14, 0x24, 0xA2, 0x99, 0x19, 0x1E, 0x37, 0x6E,
+    0x7A, 0x97, 0x5A, 0x04, 0x8C, 0xBC, 0xB7, 0xF2, 0x27, 0xCC, 0x81, 0xF1, 0x02, 0x34, 0xD5, 0x8B,
+    0x7C, 0xC9, 0x99, 0xB8, 0xE3, 0x11, 0x06, 0x72, 0x18, 0x21, 0xA1, 0xE2, 0xE2, 0x9F, 0x75, 0xCF,
+    0x2E, 0x07, 0x90, 0xFF, 0xC1, 0x15, 0x60, 0x5E, 0x5D, 0x21, 0xB9, 0xAB, 0x27, 0x40, 0xF9, 0xC5,
+    0xA3, 0xA9, 0xFE, 0x6A, 0xA0, 0xFF, 0xC7, 0x54, 0x6F, 0x5F, 0x9B, 0xEA, 0x9C, 0xA5, 0x1C, 0x93,
+    0xE0, 0x7E, 0x65, 0x95, 0x7A, 0xB4, 0x3D, 0x7A, 0x0C, 0x5D, 0xCF, 0xF6, 0x69, 0xEA, 0x4C, 0x1D,
+    0x9B, 0xAB, 0x61, 0x0B, 0xF5, 0x2B, 0xFD, 0xDD, 0xC8, 0xD7, 0x49, 0x53, 0x70, 0x95, 0xCB, 0x85,
+    0x03, 0x02, 0xAD, 0x4A, 0x2D, 0x48, 0x42, 0xA9, 0x14, 0x84, 0xE3, 0x47, 0x4E, 0x2D, 0x0A, 0x27,
+    0x97, 0x8A, 0x0A, 0x89, 0xA8, 0x54, 0x33, 0x7B, 0x89, 0x93, 0x82, 0xBF, 0xBD, 0xA6, 0x72, 0xD4,
+    0x4E, 0xB1, 0x46, 0x91, 0x6A, 0x7C, 0x42, 0xF2, 0xB0, 0x02, 0x55, 0x11, 0x96, 0xE2, 0x56, 0x78,
+    0x66, 0x56, 0x99, 0xEB, 0xCA, 0x95, 0xD3, 0x77, 0x61, 0x14, 0xAC, 0xF8, 0xB8, 0x80, 0x8E, 0x52,
+    0x90, 0x00, 0x06, 0x6B, 0xFC, 0x98, 0x9E, 0x38, 0xE6, 0x35, 0xE9, 0xCE, 0xA2, 0xE6, 0x98, 0x93,
+    0x96, 0xA3, 0xD8, 0xF0, 0x4E, 0x9F, 0x36, 0xF5, 0x9A, 0xBF, 0x91, 0x06, 0x55, 0x68, 0xA7, 0xA6,
+    0x72, 0xD2, 0x9F, 0x0C, 0xFF, 0x97, 0xEB, 0x1F, 0x9D, 0x55, 0x3D, 0x93, 0xDC, 0x44, 0x10, 0xED,
+    0xD1, 0x60, 0xC6, 0x85, 0x82, 0x21, 0x80, 0x58, 0xFE, 0x05, 0xCC, 0x2F, 0xB8, 0x1D, 0x51, 0xFC,
+    0x00, 0x08, 0x80, 0xD4, 0x09, 0xB9, 0x53, 0x82, 0x5B, 0x4B, 0x44, 0xA4, 0x97, 0x93, 0x12, 0x5D,
+    0x62, 0x42, 0x07, 0xBB, 0x27, 0x15, 0x84, 0x04, 0x08, 0x27, 0x0E, 0x51, 0x95, 0x03, 0x57, 0x39,
+    0xD9, 0x29, 0x4E, 0xAE, 0x92, 0x61, 0xA4, 0xE1, 0x75, 0xCF, 0xEE, 0xDD, 0xD9, 0x24, 0x14, 0xBA,
+    0xDA, 0xD1, 0x68, 0x3E, 0x5E, 0xBF, 0x7E, 0xFD, 0x71, 0x2E, 0x05, 0xFA, 0x86, 0x5C, 0x7A, 0x91,
+    0x56, 0xB2, 0xAD, 0x4E, 0x8B, 0x59, 0xA8, 0x88, 0x54, 0x2C, 0xE4, 0x5A, 0xF2, 0x3D, 0xB9, 0xBA,
+    0x98, 0xC9, 0x44, 0xD2, 0x81, 0x5C, 0x4F, 0xA9, 0xA7, 0x3D, 0xA9, 0x48, 0x55, 0x24, 0xDB, 0x53,
+    0xD5, 0xEB, 0xD4, 0xAB, 0x89, 0x17, 0xB6, 0x7B, 0xF2, 0x84, 0x05, 0xFB, 0xEB, 0x60, 0x06, 0xA2,
+    0xA8, 0xA6, 0x2D, 0x45, 0xC2, 0x21, 0x6F, 0x46, 0x5B, 0x63, 0xC1, 0x0C, 0x8F, 0x8B, 0xC0, 0x0B,
+    0x51, 0x8F, 0x67, 0x84, 0x85, 0xAA, 0xF6, 0x65, 0x8F, 0x85, 0x5F, 0x82, 0x0E, 0x13, 0x16, 0x76,
+    0x5B, 0xF2, 0x15, 0xDE, 0xE5, 0x6F, 0xBD, 0xBE, 0x1E, 0x31, 0xB9, 0x82, 0xC5, 0x1D, 0xDE, 0x66,
+    0xA5, 0x22, 0xB5, 0x98, 0x34, 0xB0, 0x18, 0x78, 0x61, 0x26, 0xB5, 0xE2, 0x9D, 0x2D, 0xD2, 0x9D,
+    0xC7, 0xA6, 0xD9, 0xC2, 0x9F, 0x26, 0xF5, 0x1E, 0x37, 0xAA, 0x89, 0x2C, 0x80, 0x1C, 0x73, 0xC6,
+    0xE1, 0xBA, 0x64, 0xD4, 0x8E, 0x1E, 0xF3, 0x49, 0xB0, 0xC0, 0x58, 0xCC, 0x9E, 0x3F, 0xF4, 0x35,
+    0xC3, 0x52, 0x99, 0x32, 0x88, 0x7C, 0xB0, 0xEF, 0xBC, 0x95, 0x6A, 0xF9, 0x68, 0x78, 0x2C, 0xC2,
+    0xC2, 0x2F, 0xF7, 0x69, 0xE4, 0x8F, 0x49, 0x33, 0xED, 0xAA, 0x35, 0x38, 0x0F, 0x05, 0xEC, 0x40,
+    0x59, 0x13, 0x52, 0x38, 0xE5, 0x5B, 0xEA, 0x52, 0x5D, 0xA5, 0xC9, 0xA4, 0x85, 0x12, 0x64, 0xEB,
+    0x98, 0xD3, 0x1F, 0x69, 0xD6, 0x69, 0x06, 0x2F, 0xB8, 0xD0, 0x11, 0x98, 0x00, 0x02, 0x77, 0x5C,
+    0x0B, 0x75, 0x01, 0x01, 0x9A, 0x76, 0xA8, 0xE0, 0xEA, 0x15, 0xBE, 0xA1, 0x38, 0x7B, 0xEF, 0x1F,
+    0x82, 0x80, 0x4A, 0xCC, 0xD6, 0xB2, 0x59, 0xBE, 0x07, 0xAA, 0xFC, 0x2D, 0x6E, 0x89, 0x5D, 0x22,
+    0xD9, 0x12, 0x31, 0x10, 0x2E, 0x12, 0xFB, 0x38, 0x9A, 0xB0, 0x57, 0x25, 0x21, 0xED, 0x13, 0xDE,
+    0x4D, 0x4A, 0x89, 0xAE, 0x2E, 0x2F, 0x57, 0x9A, 0x49, 0xCF, 0x34, 0x51, 0x19, 0x48, 0xE2, 0x7A,
+    0x41, 0xEC, 0x20, 0x13, 0x27, 0xF1, 0x8A, 0x75, 0xCB, 0x0A, 0xB0, 0x39, 0xC5, 0xE8, 0x66, 0x3A,
+    0x19, 0x13, 0x6C, 0x68, 0xF5, 0x13, 0xF2, 0x84, 0x02, 0xDC, 0x2F, 0x42, 0x35, 0x80, 0xAE, 0x7F,
+    0x75, 0xF9, 0x64, 0x60, 0x13, 0xF0, 0x34, 0x49, 0xC4, 0xF8, 0x01, 0x07, 0x64, 0x0B, 0xC7, 0x1E,
+    0x5A, 0xB3, 0xEA, 0x88, 0xBE, 0x01, 0x32, 0x9C, 0xB3, 0x38, 0x03, 0xB6, 0x55, 0x7D, 0x77, 0x7B,
+    0x0B, 0xEF, 0x6E, 0xB7, 0x61, 0xB4, 0x22, 0xD9, 0xDE, 0x60, 0x7B, 0xB8, 0xD9, 0x8E, 0xB2, 0x8D,
+    0xDC, 0x23, 0x47, 0x92, 0x1E, 0x5E, 0xDC, 0xA6, 0x6F, 0x05, 0x8E, 0x71, 0x18, 0xA0, 0xE6, 0xB4,
+    0xA5, 0x73, 0x39, 0xCB, 0x18, 0xDB, 0x9B, 0xD9, 0x59, 0xBE, 0x9F, 0x67, 0x00, 0x54, 0xD9, 0x02,
+    0x43, 0x4F, 0x32, 0x33, 0x79, 0x06, 0x74, 0x55, 0x9F, 0x9C, 0x90, 0xED, 0x59, 0x70, 0x8F, 0x96,
+    0x75, 0xBE, 0xC6, 0x29, 0x7F, 0xFE, 0xD6, 0x76, 0xC8, 0xDB, 0xE3, 0xCD, 0xF6, 0x4E, 0xB2, 0xE3,
+    0x8E, 0xBB, 0xEE, 0x1D, 0x35, 0xEE, 0x38, 0x41, 0x9C, 0x52, 0x25, 0x2C, 0x58, 0x7C, 0x73, 0x0D,
+    0x6C, 0x00, 0xB2, 0x85, 0x3E, 0x3B, 0xDC, 0x9D, 0x6D, 0x5B, 0x84, 0xB2, 0xD7, 0x41, 0x8F, 0x66,
+    0xD0, 0xC1, 0xA2, 0x00, 0xE1, 0x49, 0x04, 0xDC, 0xEE, 0x13, 0xC0, 0x7D, 0x85, 0x87, 0xE5, 0x3F,
+    0xE0, 0x87, 0xCA, 0x0C, 0x76, 0x70, 0x3D, 0xFE, 0xDA, 0x8A, 0xDE, 0xCB, 0xD8, 0xCD, 0xF8, 0x14,
+    0xE5, 0x7E, 0x20, 0xFB, 0xBA, 0x0B, 0xC8, 0x95, 0x15, 0x91, 0x2F, 0x7B, 0x50, 0x8B, 0x6A, 0x86,
+    0x24, 0x0E, 0x9E, 0xC1, 0x29, 0x8F, 0xDC, 0x34, 0xC1, 0x8C, 0xD8, 0xDE, 0x93, 0x1B, 0xCB, 0xD1,
+    0xEC, 0xEF, 0x77, 0xC5, 0xF5, 0xB3, 0xE7, 0x6B, 0xDC, 0x44, 0x9F, 0x74, 0x52, 0xA9, 0xF5, 0x2D,
+    0x94, 0x81, 0x36, 0xF7, 0xF0, 0xEB, 0x40, 0xD6, 0x2F, 0xB9, 0x24, 0xC5, 0x4F, 0x76, 0x4D, 0x49,
+    0x59, 0x9F, 0x16, 0xBF, 0x4B, 0xB5, 0xF9, 0x3D, 0x85, 0xE2, 0xCF, 0xBF, 0x56, 0x5A, 0x82, 0xEB,
+    0x37, 0xC8, 0x1C, 0x1B, 0x54, 0x44, 0x29, 0x34, 0x48, 0xA4, 0xAA, 0x5D, 0xA8, 0x1C, 0x3C, 0x14,
+    0x45, 0x01, 0xC4, 0x72, 0xA0, 0x3D, 0x68, 0x34, 0xD0, 0xCB, 0x53, 0x77, 0xD1, 0xD4, 0x70, 0xA9,
+    0xB6, 0x4F, 0xB8, 0xEA, 0x3F, 0xCA, 0x6E, 0xA8, 0x34, 0xE8, 0x14, 0xF5, 0x1B, 0x94, 0x8A, 0x62,
+    0x39, 0x67, 0x31, 0xC5, 0x1D, 0xA1, 0x25, 0xF0, 0xE6, 0x2A, 0xB8, 0x92, 0xDA, 0xFF, 0x3E, 0xA8,
+    0x90, 0x7E, 0x98, 0x1C, 0x4C, 0x23, 0x8A, 0xF7, 0xE4, 0x32, 0x53, 0xAE, 0x56, 0xAE, 0xEE, 0xF1,
+    0x58, 0x46, 0xCC, 0x59, 0x8A, 0x88, 0x93, 0x4E, 0x71, 0x18, 0x5C, 0x4D, 0xCD, 0x0B, 0x14, 0x07,
+    0x2A, 0xA6, 0x7C, 0xDD, 0x8D, 0x58, 0x5B, 0x00, 0x9F, 0xA5, 0xA2, 0xB7, 0xA4, 0xDA, 0xFC, 0x67,
+    0xA9, 0x44, 0xFF, 0x09, 0xB5, 0x08, 0x94, 0x3D, 0xC7, 0x6F, 0x47, 0x7B, 0xDB, 0x56, 0x3F, 0x87,
+    0x32, 0x78, 0x13, 0xCD, 0xDF, 0x08, 0xC6, 0x22, 0x81, 0x07, 0x25, 0x48, 0xF0, 0xA0, 0xA1, 0xEA,
+    0xB3, 0xF5, 0xD1, 0xE8, 0x12, 0xDA, 0x05, 0x38, 0x7D, 0x71, 0x74, 0xFD, 0x84, 0xC3, 0x99, 0xCF,
+    0x9C, 0xCB, 0x61, 0x27, 0xCC, 0x3F, 0x24, 0x49, 0xAB, 0xA3, 0xE2, 0x94, 0x3B, 0x5D, 0xEE, 0x12,
+    0x1F, 0xA4, 0x55, 0x1A, 0x02, 0x8F, 0x5F, 0xBF, 0xF9, 0x92, 0x8E, 0xD1, 0x91, 0x4C, 0xCC, 0x69,
+    0x7C, 0x1A, 0x8D, 0xB4, 0x96, 0x52, 0xBA, 0x8A, 0xA8, 0x72, 0x1A, 0xA5, 0xA0, 0x2B, 0x19, 0x5D,
+    0x7D, 0x6B, 0xE4, 0x5F, 0xA6, 0x72, 0x2F, 0xCA, 0xA3, 0x18, 0x39, 0x13, 0xE0, 0xE6, 0xD0, 0x4B,
+    0x1B, 0x12, 0x36, 0x3F, 0xDE, 0x69, 0xDA, 0x2A, 0xB1, 0x13, 0xD2, 0x31, 0x7C, 0xBD, 0x5C, 0xC0,
+    0x74, 0xAE, 0xA3, 0x73, 0x2E, 0x15, 0x4C, 0x41, 0x31, 0xB2, 0x49, 0x18, 0x55, 0x9C, 0x18, 0xE8,
+    0xF2, 0x8C, 0xEA, 0xE6, 0x1B, 0x27, 0x76, 0xB7, 0x7D, 0x90, 0x3B, 0x1E, 0x3D, 0xE2, 0xB1, 0x79,
+    0x89, 0xAE, 0xEB, 0x86, 0x22, 0x71, 0x35, 0x21, 0xC9, 0xF6, 0x4C, 0x1E, 0x7D, 0xB3, 0x98, 0xA8,
+    0xA9, 0xD1, 0xD6, 0x74, 0x7A, 0x85, 0x03, 0x65, 0xE2, 0x14, 0x78, 0xFF, 0x92, 0xA5, 0xFD, 0x98,
+    0x72, 0x22, 0x5B, 0xEE, 0xF9, 0xC2, 0xD9, 0x9F, 0xF4, 0x78, 0x27, 0x45, 0x1A, 0x14, 0x9D, 0x5F,
+    0xC9, 0xD9, 0x43, 0xC0, 0xFF, 0x2A, 0x64, 0xC0, 0x53, 0x04, 0xF3, 0x80, 0xF6, 0xD2, 0xF5, 0x48,
+    0x90, 0x09, 0xA7, 0x12, 0x4E, 0x71, 0x69, 0xA2, 0x75, 0x3A, 0x70, 0x47, 0xB5, 0x06, 0xDA, 0xDC,
+    0xF7, 0x64, 0x9E, 0x3D, 0x1F, 0xA9, 0x8B, 0x7B, 0x18, 0x06, 0x5E, 0xC3, 0x6A, 0xD6, 0x12, 0x51,
+    0x9C, 0x1B, 0x74, 0x3C, 0x2A, 0x9B, 0x75, 0xE9, 0x7A, 0xBF, 0xA8, 0x87, 0x9C, 0x6E, 0x55, 0x0B,
+    0xD6, 0x5C, 0x1B, 0xD0, 0x19, 0x0A, 0x60, 0xA1, 0x2F, 0xE6, 0x07, 0xFE, 0x73, 0xE4, 0xAF, 0x9F,
+    0xF5, 0x72, 0x2A, 0xED, 0xFF, 0xF3, 0xFC, 0x03, 0x7D, 0x55, 0xBF, 0x6F, 0xE4, 0x54, 0x10, 0x1E,
+    0xDB, 0x9B, 0xF3, 0x49, 0x16, 0x3C, 0x8A, 0xA4, 0xE1, 0x84, 0xDC, 0x53, 0xDC, 0x6B, 0x11, 0xBA,
+    0xEC, 0x7B, 0xE8, 0x8A, 0x2B, 0x68, 0x52, 0x5C, 0xA0, 0x48, 0x71, 0x7F, 0x42, 0x1A, 0xCA, 0xDD,
+    0xB5, 0x73, 0xCD, 0x15, 0x14, 0xA4, 0xE2, 0x2F, 0xA1, 0x88, 0xC4, 0xEE, 0xDA, 0x40, 0x41, 0x41,
+    0x11, 0x4B, 0x94, 0x14, 0xF8, 0x0A, 0x3A, 0x44, 0x1E, 0xC2, 0x11, 0x2F, 0x89, 0xED, 0xE1, 0x1B,
+    0x7B, 0x77, 0x13, 0x84, 0xC4, 0x26, 0xFE, 0xF1, 0x7E, 0xCC, 0x7C, 0xF3, 0xBE, 0xF9, 0x66, 0x4C,
+    0x44, 0x13, 0x22, 0x4A, 0x4B, 0x22, 0xE5, 0x88, 0xA2, 0x16, 0x83, 0x8E, 0xFE, 0xFB, 0x7B, 0x82,
+    0x05, 0xC5, 0x44, 0xC1, 0x2B, 0xEC, 0x8C, 0xB0, 0x33, 0xF0, 0x98, 0x9D, 0xE3, 0xD2, 0xB8, 0xD4,
+    0xC3, 0xC9, 0x15, 0x2E, 0xB3, 0x99, 0x8C, 0x6B, 0xA2, 0xB0, 0xC1, 0x40, 0xFC, 0x4E, 0x65, 0xB7,
+    0xDD, 0x2D, 0x4C, 0x60, 0x11, 0x7F, 0xDD, 0x50, 0xC4, 0xB0, 0x2A, 0x70, 0x3D, 0x3A, 0x17, 0xA4,
+    0x03, 0x2C, 0x72, 0x49, 0x09, 0xE7, 0x08, 0x2B, 0x1F, 0x2D, 0xCC, 0xC6, 0xE5, 0x02, 0xD7, 0x52,
+    0xAE, 0xD4, 0x93, 0x2F, 0x3A, 0xBA, 0xAB, 0x57, 0x01, 0xDB, 0x79, 0xD8, 0xD1, 0x32, 0xF2, 0x81,
+    0x8F, 0x5C, 0xEC, 0xE2, 0x2A, 0xCB, 0x13, 0xEE, 0x10, 0x6C, 0x45, 0xEA, 0xB2, 0x24, 0xF5, 0xA6,
+    0xA6, 0xF4, 0xB9, 0x27, 0x1D, 0xF4, 0x70, 0x51, 0x54, 0x86, 0x34, 0xCF, 0x29, 0x96, 0x33, 0x1E,
+    0xD1, 0x41, 0xC8, 0x15, 0x37, 0x70, 0x69, 0x10, 0x54, 0x5C, 0x23, 0xD2, 0x16, 0xAF, 0x69, 0x9E,
+    0x54, 0x88, 0xAD, 0x45, 0xC0, 0xA9, 0x4D, 0xCA, 0xE1, 0x75, 0x81, 0x38, 0xD4, 0x77, 0xCF, 0xFF,
+    0x7C, 0xCB, 0x4D, 0xD6, 0x80, 0x29, 0xBB, 0x23, 0xC6, 0x03, 0x3D, 0x2B, 0x33, 0x9F, 0x32, 0x9C,
+    0x1D, 0xF8, 0xAC, 0x50, 0x57, 0x75, 0x70, 0xDD, 0x98, 0x69, 0x5C, 0x07, 0x7F, 0x57, 0xD3, 0x8B,
+    0xA4, 0x0A, 0xEF, 0xAC, 0x71, 0xF0, 0xD3, 0x63, 0x9F, 0x2A, 0x41, 0x71, 0x61, 0x55, 0x1E, 0x37,
+    0xC4, 0xE2, 0xDE, 0x81, 0x6E, 0x4D, 0xAA, 0x0A, 0xDA, 0x21, 0x08, 0x84, 0x00, 0xD4, 0x1C, 0x98,
+    0xF3, 0xC7, 0xDA, 0xE2, 0xB1, 0x7C, 0xA6, 0x85, 0xAC, 0xDE, 0x1B, 0x4A, 0x2A, 0xE2, 0x7A, 0x2A,
+    0xF4, 0x15, 0x23, 0xFC, 0x7B, 0x63, 0x08, 0xA7, 0x75, 0xE2, 0x63, 0x3E, 0xE3, 0x66, 0x6F, 0x91,
+    0x0E, 0xD8, 0xDA, 0xC6, 0xBF, 0xDA, 0x15, 0xE9, 0x6F, 0x60, 0xCF, 0xF9, 0x00, 0xB9, 0xA0, 0xB4,
+    0x82, 0xEF, 0x02, 0xD6, 0x51, 0x33, 0x20, 0x21, 0x57, 0x0B, 0xB8, 0x7C, 0x8D, 0x51, 0x9A, 0x94,
+    0x03, 0x40, 0xC4, 0xB9, 0xA7, 0x44, 0xD2, 0x35, 0xD9, 0x9C, 0x2E, 0x46, 0x16, 0x0C, 0x3B, 0xEA,
+    0x5F, 0xB4, 0x30, 0xEB, 0x92, 0x9A, 0x3A, 0x48, 0x65, 0x8D, 0x9C, 0xAC, 0x91, 0x8F, 0x55, 0x06,
+    0xB1, 0x20, 0x27, 0xED, 0x1A, 0x99, 0x5F, 0x53, 0xD4, 0xAC, 0x29, 0xA9, 0x33, 0x88, 0xC9, 0x94,
+    0x05, 0xA5, 0xDC, 0xC2, 0xBC, 0x22, 0xDA, 0xDF, 0x52, 0x75, 0x5A, 0xA5, 0x2E, 0xE0, 0x1A, 0xF3,
+    0x9F, 0xFF, 0x7C, 0x87, 0xC5, 0x5F, 0xF2, 0x8E, 0xE2, 0x3F, 0x08, 0x46, 0x2D, 0x6E, 0x20, 0x75,
+    0x45, 0x0A, 0x00, 0x22, 0xC6, 0x96, 0x74, 0x2E, 0x37, 0x11, 0x8F, 0x11, 0x69, 0x4D, 0xE5, 0xF4,
+    0x73, 0x59, 0x2A, 0xCE, 0x0B, 0x22, 0x86, 0x13, 0xBA, 0x85, 0xF7, 0xA0, 0xD9, 0xDF, 0x28, 0x4C,
+    0xF4, 0xB7, 0xB9, 0xD5, 0xA2, 0xE8, 0x1B, 0x70, 0x54, 0x08, 0xFE, 0xF1, 0xF1, 0x36, 0x59, 0x01,
+    0xBF, 0xAE, 0x23, 0xEE, 0x5D, 0x74, 0x73, 0x8A, 0xE3, 0x04, 0x3D, 0x28, 0xD0, 0x40, 0x51, 0xE5,
+    0x1C, 0x36, 0x06, 0xBE, 0x40, 0x6D, 0x0B, 0xB2, 0x33, 0x2C, 0x98, 0x1C, 0x04, 0x56, 0x3A, 0x4F,
+    0x9B, 0xC4, 0xA5, 0xB3, 0xA0, 0xCF, 0x34, 0x88, 0x40, 0xDA, 0x7A, 0x78, 0xDF, 0x0F, 0x9A, 0x8D,
+    0x10, 0x1F, 0x8A, 0x3F, 0xE9, 0x2D, 0xB4, 0xE5, 0x68, 0xEF, 0xF8, 0xE5, 0x00, 0x56, 0xE4, 0x5D,
+    0xD6, 0x9A, 0xB7, 0xAF, 0xBE, 0xEA, 0xE8, 0xFA, 0x3A, 0x4F, 0x67, 0x14, 0xDC, 0x61, 0x43, 0x3D,
+    0xD4, 0x98, 0xC9, 0x29, 0x86, 0xC9, 0x7A, 0xB4, 0x6E, 0x07, 0xA5, 0xCB, 0x29, 0xCC, 0xE6, 0x08,
+    0xF8, 0x85, 0x5C, 0xC6, 0xEC, 0xE3, 0xDF, 0x16, 0x91, 0x0B, 0x64, 0x87, 0xB1, 0x94, 0xA0, 0x48,
+    0x50, 0x1A, 0x0A, 0xA3, 0xA2, 0x24, 0x28, 0x88, 0xD6, 0xEF, 0x50, 0xFA, 0x65, 0x19, 0x7F, 0xDF,
+    0xBF, 0xA8, 0x33, 0xAE, 0x85, 0xEE, 0x40, 0xA0, 0xE1, 0x6F, 0x28, 0xB7, 0xB9, 0x44, 0xF9, 0x3E,
+    0x73, 0xC1, 0xFD, 0x67, 0x37, 0x2F, 0x01, 0x00, 0xE7, 0x52, 0x75, 0x35, 0xC5, 0x15, 0x21, 0xE9,
+    0x6A, 0xF8, 0x07, 0xB6, 0xB6, 0x1F, 0xE9, 0x4F, 0xBC, 0xBE, 0x72, 0x9A, 0x4B, 0x85, 0xDA, 0xD8,
+    0x30, 0x76, 0xEA, 0x48, 0xA3, 0x18, 0x83, 0x76, 0x2F, 0x13, 0x23, 0x24, 0xC4, 0x6E, 0x1E, 0x43,
+    0x51, 0x0C, 0x3A, 0x5D, 0xED, 0x1E, 0x52, 0x29, 0x3D, 0x1C, 0x42, 0x41, 0x0B, 0xFA, 0xB6, 0x3A,
+    0xF3, 0xC9, 0xA5, 0x8A, 0xAF, 0xDB, 0x85, 0x57, 0x5C, 0x72, 0xA9, 0x7D, 0xE4, 0xA1, 0xAB, 0x60,
+    0xF4, 0xFC, 0x08, 0x72, 0x7F, 0xC3, 0x90, 0xFF, 0x09, 0xFC, 0x0D, 0xDA, 0x17, 0x4D, 0xA2, 0xEE,
+    0x50, 0x84, 0xA1, 0x83, 0xBD, 0x27, 0x95, 0xCF, 0x10, 0x2C, 0x4E, 0xD1, 0x82, 0x65, 0x9D, 0xE2,
+    0xF8, 0x97, 0xB9, 0xB0, 0x42, 0x28, 0xA3, 0xB1, 0x63, 0xC5, 0xF9, 0x83, 0x0E, 0x35, 0x81, 0x4B,
+    0x68, 0xEF, 0x47, 0xB6, 0xAA, 0x8A, 0xFC, 0x49, 0x0D, 0xB4, 0x1E, 0x31, 0x16, 0x50, 0x12, 0x4A,
+    0x1A, 0xAE, 0xF1, 0xE7, 0x42, 0x87, 0x2E, 0xD1, 0x0D, 0x55, 0xCE, 0xF6, 0x10, 0x88, 0x45, 0x0D,
+    0x8D, 0xB9, 0x43, 0xAF, 0x2C, 0x2D, 0xB5, 0x06, 0x25, 0xA9, 0x4A, 0x7E, 0xA8, 0x28, 0xFE, 0xE9,
+    0xEC, 0xAF, 0x1A, 0x09, 0x2B, 0x17, 0x4E, 0xE0, 0x52, 0x27, 0x80, 0x92, 0xB1, 0xA8, 0x24, 0xF7,
+    0xEF, 0xCE, 0x98, 0xD9, 0xA0, 0x8B, 0xB8, 0x4C, 0xBA, 0xE8, 0xAA, 0xD6, 0xBF, 0x23, 0xAD, 0x20,
+    0x3D, 0x6A, 0x90, 0xA9, 0xE0, 0x56, 0x76, 0x4A, 0xBC, 0x63, 0xBD, 0x66, 0xB2, 0x9B, 0xAD, 0x64,
+    0x16, 0x71, 0xC7, 0x97, 0xD2, 0x72, 0x3F, 0x85, 0x3E, 0xA7, 0xF0, 0xFB, 0x71, 0x1B, 0xDD, 0x36,
+    0xC6, 0x85, 0xEC, 0x0C, 0x4A, 0xD1, 0x4E, 0xEE, 0xDD, 0x9F, 0x82, 0x7D, 0x92, 0x0A, 0xA4, 0x13,
+    0x47, 0x52, 0x63, 0xE0, 0x06, 0x33, 0x73, 0x51, 0xCD, 0x4C, 0x6E, 0x4B, 0x49, 0x33, 0xA4, 0xB0,
+    0x08, 0x00, 0x37, 0x15, 0xED, 0x4F, 0x63, 0xB8, 0x36, 0x0A, 0x20, 0x06, 0x32, 0xA0, 0xA7, 0x87,
+    0x72, 0xBB, 0x90, 0x16, 0x2A, 0x01, 0x19, 0x09, 0xC8, 0xD8, 0x4D, 0x37, 0x25, 0xE9, 0xD8, 0xD2,
+    0xA5, 0xBF, 0xC8, 0xA4, 0x5E, 0xA4, 0x2D, 0xB2, 0x94, 0xCF, 0x87, 0x5B, 0xFC, 0xB0, 0xB7, 0xB3,
+    0x84, 0x9B, 0x56, 0x31, 0x7B, 0x45, 0x59, 0xFD, 0x2E, 0x48, 0x9B, 0x0C, 0xCD, 0xB8, 0x1D, 0xB5,
+    0x2A, 0x02, 0x36, 0x63, 0xDB, 0x17, 0x05, 0xA3, 0x4C, 0x8F, 0x74, 0x45, 0x2E, 0xE3, 0x3B, 0xD7,
+    0x31, 0xBB, 0x8B, 0x27, 0xC2, 0xC0, 0xA6, 0x07, 0x80, 0xC7, 0xB4, 0x41, 0x62, 0x45, 0x7B, 0x88,
+    0x54, 0x22, 0x5E, 0x0E, 0x45, 0x84, 0x71, 0x38, 0x0E, 0x90, 0x6F, 0xA4, 0x1A, 0x92, 0x44, 0x89,
+    0xA8, 0x6A, 0xAC, 0x0D, 0x44, 0x38, 0xAE, 0xFB, 0x41, 0xD2, 0x40, 0x83, 0x8B, 0xFB, 0xA9, 0xE9,
+    0x10, 0x44, 0xD8, 0xC3, 0x06, 0x3E, 0x8F, 0x46, 0xA8, 0xA5, 0xEC, 0x01, 0x96, 0x05, 0x88, 0x16,
+    0xB0, 0x43, 0xB1, 0x98, 0x09, 0x92, 0xDF, 0xCE, 0x86, 0xD2, 0x57, 0xA2, 0x6A, 0x37, 0x2B, 0x06,
+    0xE9, 0x6E, 0x76, 0x30, 0x18, 0x29, 0x18, 0x49, 0x69, 0xB7, 0xA1, 0x0A, 0xC9, 0x38, 0xEA, 0x6C,
+    0x0C, 0xC5, 0x0E, 0x53, 0x63, 0x28, 0x18, 0xA3, 0xA3, 0xCB, 0x17, 0xB4, 0x1F, 0xF6, 0xCF, 0x77,
+    0x26, 0xF7, 0xA1, 0xE6, 0x5B, 0xFB, 0xA5, 0xA4, 0xE0, 0x11, 0x13, 0x3E, 0x0C, 0x24, 0x2D, 0x23,
+    0xB8, 0xA0, 0xC7, 0x8A, 0xF3, 0xA7, 0x9A, 0x9B, 0xF5, 0x34, 0xE6, 0xF6, 0x19, 0x65, 0xB0, 0xDA,
+    0xB3, 0xA8, 0x19, 0xA9, 0x90, 0x12, 0x8A, 0xFE, 0x60, 0x93, 0x95, 0x73, 0xBC, 0x85, 0x12, 0x62,
+    0x74, 0x7F, 0xA6, 0x1C, 0x5D, 0x49, 0x0B, 0x10, 0xBE, 0x14, 0xD2, 0x46, 0xF1, 0x31, 0x11, 0x9D,
+    0x87, 0x96, 0xFE, 0xE7, 0xF7, 0x0F, 0xBD, 0x55, 0xBF, 0x6F, 0xE4, 0x44, 0x14, 0x7E, 0xE3, 0x39,
+    0xE2, 0xC2, 0x12, 0x93, 0x22, 0x29, 0xB8, 0x88, 0xF8, 0x1F, 0xB8, 0x64, 0xDA, 0x14, 0xBB, 0x6B,
+    0x5F, 0x28, 0xAE, 0xA0, 0xB8, 0x34, 0x2B, 0x44, 0x05, 0x05, 0x0D, 0x34, 0x69, 0xB7, 0xD8, 0xEC,
+    0x9A, 0xF0, 0x07, 0xE4, 0x1A, 0x44, 0x4B, 0x01, 0xD2, 0x29, 0x57, 0x1C, 0x45, 0x24, 0x16, 0x69,
+    0x93, 0x9D, 0x5C, 0x0A, 0x0A, 0x8A, 0x33, 0xBA, 0x92, 0xC6, 0xE1, 0x87, 0x10, 0x47, 0xC1, 0x04,
+    0x19, 0xE1, 0x03, 0xDB, 0xC3, 0xF7, 0xC6, 0x1B, 0x82, 0x84, 0x68, 0x99, 0xC4, 0xB3, 0xBB, 0xF3,
+    0x66, 0xE6, 0xBD, 0xEF, 0x7B, 0xDF, 0x7B, 0x26, 0xF2, 0xA3, 0xC4, 0xD3, 0xC3, 0x13, 0xE3, 0x89,
+    0x32, 0x22, 0x99, 0xE3, 0x8B, 0x25, 0x0A, 0x5C, 0x4E, 0x91, 0x73, 0x14, 0x3B, 0x67, 0xE2, 0x67,
+    0xE7, 0x85, 0x32, 0x96, 0x94, 0x19, 0x51, 0x58, 0x6C, 0x51, 0x60, 0x23, 0xA2, 0x5A, 0x1A, 0x4A,
+    0xA8, 0xF0, 0x8B, 0xD2, 0x6E, 0x61, 0x41, 0x11, 0x25, 0x1F, 0x98, 0x5E, 0xF8, 0xA2, 0x98, 0x90,
+    0x73, 0x2D, 0x29, 0xD7, 0x10, 0x4D, 0xBF, 0x27, 0x0A, 0x71, 0x6F, 0x50, 0xFC, 0x97, 0xB3, 0xE5,
+    0xD8, 0xA8, 0x30, 0x25, 0xCE, 0x60, 0x7A, 0x84, 0xAF, 0x09, 0x4D, 0xB1, 0x2F, 0x55, 0x06, 0x0E,
+    0xB0, 0x2D, 0xCC, 0x29, 0x85, 0x1B, 0xDE, 0x58, 0xF3, 0x34, 0xE1, 0x29, 0x49, 0x71, 0x05, 0x7B,
+    0x12, 0xCE, 0xB9, 0x94, 0x02, 0xBE, 0x81, 0x1A, 0x6F, 0xE1, 0x29, 0xCE, 0xD8, 0x0D, 0xBB, 0xF0,
+    0x07, 0x05, 0xBC, 0xA7, 0x49, 0x7B, 0xFC, 0xB8, 0x54, 0xD8, 0x5E, 0xCB, 0xFA, 0x36, 0xE2, 0xFB,
+    0xC4, 0xFB, 0xC6, 0x3D, 0xB7, 0xA8, 0x14, 0x7B, 0x91, 0xD1, 0x91, 0x3B, 0x32, 0x01, 0xEC, 0x19,
+    0xE9, 0x0C, 0xF7, 0xAB, 0x4C, 0x16, 0x14, 0x19, 0xAA, 0x08, 0x9F, 0x03, 0x46, 0x10, 0xA7, 0xD4,
+    0xE7, 0x15, 0x95, 0xE1, 0xEA, 0xB0, 0xDA, 0x00, 0x2D, 0x8E, 0x79, 0x3A, 0x74, 0x87, 0x56, 0xE2,
+    0xA2, 0x9D, 0x0E, 0xCE, 0xFA, 0x70, 0x6F, 0x7D, 0x78, 0xCF, 0x35, 0xD2, 0xD5, 0xBA, 0xA5, 0x8D,
+    0x96, 0x43, 0x4A, 0x48, 0x56, 0x1C, 0x50, 0x6C, 0x44, 0xC5, 0x38, 0xB0, 0x14, 0x81, 0x58, 0x18,
+    0x02, 0xC4, 0x26, 0x4B, 0x80, 0x52, 0xEE, 0x08, 0x14, 0xB8, 0xD6, 0x61, 0x21, 0xF2, 0x50, 0xA6,
+    0x19, 0xAF, 0x02, 0x24, 0x38, 0x65, 0x76, 0x22, 0x26, 0x92, 0x4E, 0x79, 0xE2, 0xA3, 0x4B, 0x3E,
+    0x34, 0x7F, 0xDD, 0x77, 0x05, 0xEF, 0x6D, 0x97, 0x8C, 0xCE, 0x11, 0x23, 0x02, 0x56, 0x24, 0x2C,
+    0x69, 0x8E, 0xBF, 0x4F, 0xA1, 0xA1, 0x31, 0x07, 0xBF, 0x47, 0xFF, 0x1C, 0x41, 0xD6, 0xAD, 0x56,
+    0xDD, 0x81, 0x18, 0x09, 0x06, 0x56, 0xB0, 0xEE, 0x0F, 0x10, 0xBD, 0x09, 0x2E, 0x5D, 0x26, 0xFF,
+    0x70, 0x69, 0x9F, 0xCE, 0xC0, 0x65, 0xA9, 0x8D, 0x34, 0x7F, 0x66, 0x14, 0x1E, 0xA5, 0xB4, 0x05,
+    0x96, 0x4F, 0xE2, 0x2C, 0xC8, 0x63, 0x13, 0x1A, 0xE5, 0xFF, 0x62, 0xA3, 0xB2, 0x38, 0x8F, 0x29,
+    0xCE, 0x7B, 0xA4, 0x72, 0x4B, 0xD1, 0x05, 0xD8, 0x7A, 0x8A, 0xC8, 0x66, 0x3D, 0xD2, 0x17, 0x96,
+    0x5A, 0x95, 0x87, 0x56, 0xFF, 0xB0, 0x40, 0xB6, 0x0B, 0xBA, 0x0D, 0x7D, 0xBC, 0x44, 0x6B, 0xDA,
+    0x34, 0xC9, 0x93, 0x26, 0xB9, 0x5B, 0xDF, 0xBA, 0x89, 0x2D, 0x76, 0xB0, 0xD1, 0xE2, 0xF9, 0x02,
+    0x29, 0x04, 0xA6, 0x33, 0x0F, 0x15, 0x30, 0x38, 0xCD, 0x03, 0x44, 0x3C, 0x2D, 0xA5, 0xE9, 0x83,
+    0x2B, 0x9A, 0xC5, 0x54, 0xC9, 0x4C, 0x45, 0xE9, 0x98, 0x8A, 0xE0, 0x99, 0xD9, 0xA6, 0x55, 0x1A,
+    0x59, 0x85, 0x5C, 0x6C, 0xF6, 0x58, 0x61, 0xE1, 0x53, 0x16, 0x9E, 0xF8, 0xCE, 0x20, 0x7F, 0x34,
+    0x3A, 0x01, 0x50, 0xDA, 0xDA, 0x14, 0x0D, 0xA5, 0x4A, 0x1A, 0xED, 0x6C, 0x68, 0x66, 0xC2, 0x95,
+    0x32, 0xE7, 0x03, 0x00, 0x5E, 0xFA, 0x19, 0xA8, 0x42, 0x88, 0xC6, 0x7D, 0xB8, 0x0F, 0x4A, 0x43,
+    0x96, 0x03, 0xC2, 0xFC, 0x74, 0x19, 0x98, 0xFA, 0xDD, 0xC4, 0x2E, 0x57, 0x77, 0x6D, 0x94, 0xCD,
+    0x10, 0x82, 0xB0, 0x8A, 0x66, 0x91, 0xD9, 0x0E, 0x2F, 0xA3, 0x6F, 0xBE, 0x38, 0x77, 0x47, 0x85,
+    0x7E, 0xCD, 0xE7, 0x88, 0x04, 0xC4, 0xF9, 0xC4, 0xA1, 0x90, 0x04, 0xAD, 0x41, 0x37, 0x73, 0x26,
+    0x4F, 0x56, 0xA0, 0xA7, 0x98, 0x52, 0x72, 0x58, 0xD3, 0x42, 0x96, 0x78, 0x2A, 0x02, 0x6C, 0xE4,
+    0x72, 0x02, 0x6C, 0x10, 0x57, 0x09, 0xCA, 0x57, 0x45, 0xBA, 0x70, 0xEE, 0x57, 0x24, 0xFC, 0x7C,
+    0x38, 0xDC, 0xC7, 0x4D, 0x63, 0xE2, 0x24, 0xFA, 0x6C, 0xC4, 0x5E, 0x14, 0xEE, 0x5B, 0xE7, 0xBE,
+    0xE4, 0x4C, 0x8B, 0x21, 0x73, 0x84, 0xF8, 0xD4, 0x03, 0x28, 0xAB, 0x24, 0x69, 0xA2, 0x95, 0x87,
+    0xD2, 0x8C, 0xF4, 0x69, 0xB8, 0x6B, 0x76, 0x46, 0x4A, 0xD1, 0x65, 0x71, 0xA7, 0x27, 0x7F, 0xA1,
+    0xCF, 0x0A, 0x65, 0x83, 0x0B, 0xB3, 0x63, 0xA3, 0x88, 0x2E, 0x6D, 0xEF, 0x55, 0x75, 0x79, 0x55,
+    0xF4, 0xD6, 0xEF, 0xDE, 0xE7, 0x82, 0x3C, 0xA1, 0x03, 0xD6, 0xB5, 0x66, 0xD5, 0xAD, 0x3C, 0x64,
+    0xF1, 0xEE, 0x3A, 0xF7, 0x15, 0x54, 0x8D, 0xFB, 0xCF, 0x52, 0xE5, 0x8A, 0xE4, 0x5E, 0x39, 0xA6,
+    0x7A, 0x4E, 0x63, 0xFF, 0x3F, 0x9F, 0x50, 0x95, 0xFC, 0x6C, 0x23, 0xC8, 0xF1, 0x9D, 0x8E, 0x11,
+    0x66, 0xB6, 0xF2, 0xC9, 0x61, 0x09, 0xE1, 0xA7, 0x18, 0xBE, 0x18, 0x6A, 0x54, 0x19, 0x60, 0xD8,
+    0x7F, 0x5B, 0xBB, 0x4E, 0xD0, 0x8D, 0xE1, 0x70, 0xF8, 0x3A, 0x80, 0xF2, 0x66, 0xFE, 0x09, 0xD1,
+    0x33, 0xB7, 0x5F, 0xD7, 0x51, 0xA6, 0x05, 0xC4, 0xC4, 0x95, 0x8F, 0x83, 0x48, 0x46, 0x58, 0xB0,
+    0xF6, 0x55, 0xCE, 0xB2, 0x8F, 0x9F, 0x1F, 0xA3, 0x26, 0xB2, 0xE3, 0xE3, 0xCC, 0x8B, 0xDF, 0x0A,
+    0xD4, 0x73, 0x31, 0x97, 0x10, 0x00, 0x54, 0x8F, 0xF4, 0xED, 0x1B, 0x01, 0x6D, 0x7D, 0x64, 0xB9,
+    0xE8, 0xF1, 0x0F, 0xCD, 0xEA, 0x7C, 0xEA, 0x52, 0x6E, 0x46, 0x18, 0x0F, 0x22, 0x33, 0x95, 0x65,
+    0xB2, 0x8B, 0xBC, 0x5D, 0x0F, 0x78, 0x39, 0xE0, 0x83, 0x09, 0x8B, 0x0C, 0x0E, 0x06, 0xEC, 0x0E,
+    0xB2, 0x2E, 0xD9, 0x32, 0xBF, 0xB1, 0x64, 0x9D, 0x45, 0x2D, 0x2D, 0x35, 0xE1, 0x73, 0xCA, 0xF2,
+    0x4C, 0xD0, 0x0D, 0xCD, 0xB6, 0x5D, 0x55, 0xCD, 0x34, 0x39, 0x85, 0x60, 0x54, 0x1B, 0xFC, 0xD8,
+    0x42, 0x64, 0xD5, 0x1A, 0x5A, 0xCB, 0xC0, 0xAB, 0x26, 0xEB, 0xFC, 0x10, 0x9F, 0xB9, 0xAE, 0x5B,
+    0xDF, 0xA8, 0x5E, 0x4E, 0xBB, 0x20, 0x56, 0xB8, 0x8B, 0x69, 0xAE, 0xF2, 0xA9, 0x9B, 0xA4, 0x98,
+    0xEE, 0x73, 0x47, 0x44, 0xF5, 0x68, 0x77, 0x05, 0x9F, 0xAE, 0x3E, 0x81, 0x14, 0xDB, 0x3E, 0x7A,
+    0x33, 0x5B, 0x16, 0x7F, 0x5B, 0x42, 0xB6, 0x10, 0x5B, 0xB0, 0x09, 0x16, 0xFA, 0xFC, 0x82, 0xCB,
+    0xF6, 0x8A, 0x55, 0xD8, 0x83, 0x85, 0x36, 0xFB, 0xCC, 0x2C, 0x5B, 0xE4, 0x8D, 0x65, 0xC4, 0x51,
+    0x6C, 0x8D, 0x39, 0x32, 0x98, 0x11, 0x38, 0xD1, 0xF6, 0x5B, 0x48, 0x53, 0xE4, 0xC5, 0xFE, 0xAE,
+    0x17, 0xB0, 0xA8, 0x93, 0x8B, 0x9A, 0x63, 0xDC, 0x93, 0xF5, 0x4A, 0x03, 0x19, 0xD6, 0xD2, 0x6A,
+    0xF3, 0x8A, 0xB7, 0xCD, 0x03, 0x67, 0x12, 0xEE, 0x87, 0x9E, 0x9C, 0xEB, 0xF6, 0x32, 0x67, 0xF6,
+    0x2A, 0x50, 0xA7, 0xDD, 0xEE, 0xF1, 0xC7, 0x9E, 0xDA, 0x16, 0x01, 0x16, 0x61, 0x3E, 0x87, 0xBC,
+    0x05, 0xAA, 0x6D, 0x1E, 0x58, 0x4D, 0x75, 0x64, 0x0E, 0x02, 0x3B, 0x01, 0x3C, 0x0A, 0x9B, 0x0E,
+    0xBD, 0x00, 0x2C, 0x83, 0x6A, 0x11, 0x20, 0x4C, 0xA2, 0x7D, 0x88, 0x12, 0x95, 0x7A, 0x8A, 0xD4,
+    0x25, 0xBB, 0x35, 0xFA, 0x5B, 0x8B, 0xB6, 0xD9, 0xFA, 0xB2, 0x69, 0x22, 0x2B, 0x4B, 0x54, 0x11,
+    0x2A, 0x66, 0x80, 0xE4, 0xAE, 0xD1, 0x92, 0x3E, 0x7A, 0xBB, 0x7B, 0xD5, 0xC0, 0xBD, 0x58, 0x18,
+    0xDF, 0xF5, 0x43, 0xC6, 0xC2, 0x9C, 0x43, 0xDD, 0x3E, 0x01, 0x7A, 0xC9, 0xB9, 0xF6, 0xFD, 0xD1,
+    0x6B, 0x91, 0xDF, 0x0B, 0x88, 0xDD, 0xCB, 0x13, 0x22, 0xE0, 0x46, 0x78, 0x87, 0x6D, 0x31, 0xBF,
+    0x4B, 0x6A, 0x36, 0xC9, 0x9A, 0xE5, 0x8B, 0xEE, 0x58, 0x43, 0xB7, 0x40, 0xDB, 0x9F, 0xC5, 0x2E,
+    0x05, 0xD6, 0xAA, 0x4C, 0x5C, 0xAA, 0x52, 0x59, 0x94, 0xFE, 0x26, 0xF5, 0xBE, 0xF5, 0xB7, 0x0E,
+    0xB0, 0x85, 0x6F, 0x6D, 0xDE, 0xF8, 0x8D, 0x6F, 0xE5, 0x97, 0x93, 0xEF, 0xD5, 0xEF, 0x3D, 0xFA,
+    0xA9, 0x73, 0xCC, 0x65, 0x7C, 0x40, 0xDE, 0x93, 0x57, 0x01, 0x07, 0x66, 0x97, 0x18, 0x56, 0xE9,
+    0x7F, 0x1A, 0x7F, 0x01, 0xD5, 0x55, 0xBB, 0x6E, 0xD4, 0x50, 0x10, 0x1D, 0xFB, 0xA2, 0x58, 0xC8,
+    0x12, 0x37, 0x0D, 0x0D, 0x29, 0xCC, 0x0F, 0x10, 0xF7, 0x88, 0xAC, 0x2D, 0xF1, 0x01, 0xA4, 0x49,
+    0x45, 0x41, 0x4D, 0x95, 0x26, 0xE5, 0x26, 0xEB, 0x8A, 0x9A, 0x4F, 0xA0, 0x44, 0x4E, 0xB1, 0x0D,
+    0x05, 0xC5, 0x26, 0x6B, 0x94, 0x92, 0xC6, 0x08, 0x24, 0x0A, 0x0A, 0x2C, 0x41, 0xB5, 0xD5, 0x15,
+    0x32, 0xC8, 0x59, 0xBC, 0x3B, 0xCC, 0x99, 0xEB, 0x3C, 0x04, 0x3F, 0x10, 0x56, 0xDA, 0xB9, 0x5E,
+    0x7B, 0x3C, 0x73, 0xCE, 0x99, 0xC7, 0x12, 0xC9, 0x27, 0xCC, 0x89, 0xA2, 0x42, 0xBE, 0x35, 0x05,
+    0xF3, 0x8A, 0xC8, 0x56, 0x14, 0xB1, 0xFC, 0xCE, 0xE4, 0x59, 0x22, 0xCF, 0x0E, 0xE5, 0x4C, 0xE5,
+    0xDB, 0xF9, 0xD3, 0x38, 0x39, 0x47, 0x44, 0xB1, 0xB8, 0xD2, 0x8E, 0x77, 0x81, 0xCF, 0x88, 0xB6,
+    0x5E, 0xD1, 0x8C, 0x68, 0x16, 0x70, 0x4F, 0x3D, 0x05, 0x2E, 0x3A, 0x5F, 0xCB, 0x3B, 0xA6, 0xB6,
+    0x45, 0x46, 0x2D, 0xD9, 0x22, 0xA6, 0x51, 0xC2, 0x39, 0x22, 0x1D, 0x66, 0x9C, 0x8F, 0x87, 0x88,
+    0xAD, 0x8F, 0x68, 0x1A, 0x89, 0x54, 0xF8, 0xA8, 0xA7, 0x3E, 0x71, 0xD8, 0xFA, 0x44, 0x16, 0x89,
+    0x7A, 0xA2, 0xC9, 0xDE, 0x2E, 0x85, 0xE2, 0xCA, 0xDC, 0x01, 0x2B, 0xCD, 0xD9, 0x51, 0x84, 0x67,
+    0x7F, 0x7F, 0xEE, 0x13, 0x6D, 0xB4, 0x1E, 0xAC, 0x05, 0x11, 0x89, 0x6B, 0x3F, 0x3B, 0x0D, 0x64,
+    0x8A, 0xF1, 0x80, 0x3C, 0x51, 0xC2, 0x9A, 0x08, 0xB9, 0x69, 0x3F, 0x57, 0x1C, 0x01, 0xD7, 0x9A,
+    0x84, 0x1E, 0xF6, 0xC0, 0x16, 0x56, 0x70, 0x10, 0x16, 0x2D, 0xBC, 0x67, 0x64, 0x7A, 0x78, 0x8D,
+    0xC9, 0x30, 0x45, 0xAD, 0xB0, 0x37, 0x5F, 0x5E, 0xCC, 0x3B, 0x01, 0x69, 0xBE, 0x7D, 0xE0, 0x46,
+    0x12, 0x9A, 0xA6, 0xBD, 0x8B, 0xD8, 0xA6, 0x01, 0x3F, 0x5B, 0x98, 0x06, 0x7C, 0x6D, 0x65, 0x7E,
+    0x3E, 0xFB, 0x84, 0xC4, 0x01, 0x33, 0x6B, 0xE2, 0x7B, 0xE5, 0x72, 0x48, 0x3C, 0x1E, 0x24, 0x15,
+    0x47, 0x65, 0x6C, 0x05, 0xF1, 0xDB, 0x81, 0xC9, 0xAD, 0x0B, 0x4A, 0x9B, 0x14, 0x39, 0xCA, 0x2A,
+    0x5A, 0x51, 0xF8, 0xD2, 0xDF, 0x11, 0x90, 0x99, 0xA3, 0x69, 0x25, 0xEF, 0x05, 0x9D, 0x50, 0x14,
+    0x93, 0x16, 0x7A, 0x25, 0x5A, 0x99, 0x1A, 0xB0, 0x8F, 0x68, 0x93, 0xA7, 0xEF, 0x78, 0x1D, 0x88,
+    0x50, 0xCF, 0xAF, 0xE4, 0xB9, 0xA3, 0x36, 0x6E, 0x34, 0x0A, 0xEB, 0x8F, 0xD4, 0xE9, 0x31, 0x57,
+    0x1B, 0xE4, 0xD7, 0xB4, 0xDC, 0x54, 0xDB, 0xAB, 0xF5, 0xBE, 0x13, 0xA8, 0x46, 0x59, 0xAB, 0xEF,
+    0x1D, 0xC1, 0xDA, 0x27, 0x10, 0x34, 0x3E, 0x43, 0x10, 0x53, 0xC3, 0x57, 0x68, 0x4B, 0x90, 0xC0,
+    0x69, 0x92, 0x2E, 0xC0, 0xAD, 0x99, 0xF6, 0xD3, 0x48, 0xAB, 0x99, 0x96, 0xC7, 0x2D, 0x6A, 0xC3,
+    0x6B, 0xB1, 0x8B, 0x52, 0x9A, 0x4E, 0x14, 0x11, 0x82, 0xD0, 0xA1, 0x57, 0x15, 0xB2, 0x1C, 0x39,
+    0x6D, 0x43, 0x27, 0x12, 0xAC, 0x0F, 0xB9, 0xA5, 0x2D, 0xFE, 0x21, 0xEE, 0x96, 0x3D, 0x14, 0x0F,
+    0xF1, 0x8D, 0xC2, 0x5D, 0xC3, 0x1A, 0xC6, 0xAD, 0x58, 0x6D, 0x74, 0x7E, 0xCD, 0xE7, 0x66, 0xF3,
+    0xD0, 0x4F, 0xE6, 0xAD, 0xD6, 0x20, 0x53, 0x70, 0x13, 0x4D, 0x38, 0xC1, 0x38, 0xD1, 0x36, 0xDD,
+    0xBE, 0xE9, 0x3C, 0x92, 0x02, 0x4D, 0x99, 0x76, 0xDA, 0xF3, 0x08, 0x42, 0xD1, 0x99, 0x82, 0xAB,
+    0x8F, 0xFE, 0x9D, 0x4E, 0x2D, 0x8B, 0x76, 0x3C, 0xA6, 0x09, 0x05, 0xD4, 0xA2, 0x11, 0x2B, 0x8F,
+    0x13, 0xEC, 0x04, 0xDA, 0x51, 0x49, 0x52, 0x9D, 0x7C, 0xFB, 0xD8, 0xE9, 0x54, 0x9C, 0x20, 0x6C,
+    0x95, 0x16, 0x60, 0x23, 0xD8, 0x30, 0x00, 0xBD, 0xEE, 0x10, 0xF8, 0x9E, 0x96, 0xD3, 0x1A, 0xE2,
+    0xC9, 0x6A, 0xA0, 0xAC, 0x2C, 0x59, 0xE7, 0x3A, 0xA9, 0x74, 0xE4, 0x1D, 0xC5, 0xF2, 0x6C, 0xA5,
+    0x39, 0xB3, 0x02, 0x6C, 0xAC, 0x8B, 0x25, 0xDB, 0x3E, 0xBF, 0x17, 0xF7, 0x8C, 0xDD, 0xB5, 0x42,
+    0x20, 0x62, 0x5A, 0x03, 0xBB, 0x75, 0x32, 0x6E, 0x14, 0xB4, 0x71, 0xF5, 0x9F, 0x30, 0xD8, 0xF5,
+    0xF3, 0x0C, 0x24, 0xC1, 0x52, 0xBB, 0xC1, 0x6D, 0xC3, 0x3E, 0xC2, 0x6E, 0x27, 0x1B, 0x02, 0x9C,
+    0xF9, 0xE5, 0xAE, 0x5A, 0x2D, 0xD8, 0xBD, 0xB6, 0x63, 0x86, 0x1E, 0x54, 0xB2, 0x89, 0xBE, 0x6D,
+    0x57, 0xBA, 0x26, 0xBE, 0xE2, 0x6D, 0xF3, 0xD1, 0xE9, 0xCA, 0x51, 0xB6, 0xAD, 0xFA, 0x76, 0x80,
+    0x44, 0xE3, 0xB0, 0xD3, 0x2E, 0x9A, 0xE8, 0x02, 0x03, 0x5B, 0xD9, 0x79, 0xE2, 0x1B, 0x2F, 0xCA,
+    0x15, 0x86, 0x92, 0x65, 0xFF, 0x9A, 0x65, 0x39, 0x75, 0xA2, 0x24, 0xA1, 0xEF, 0x7A, 0x4D, 0x25,
+    0x4A, 0xD8, 0x1A, 0x17, 0x46, 0xB6, 0x56, 0x8E, 0x4E, 0x9E, 0xAF, 0x68, 0x83, 0xFB, 0x39, 0x17,
+    0x86, 0xD9, 0x13, 0x61, 0x7F, 0x31, 0x97, 0xB3, 0xD2, 0x1B, 0x8B, 0x63, 0x37, 0xA8, 0xAC, 0xEB,
+    0xF1, 0xB7, 0xA3, 0x07, 0x3A, 0x0B, 0x3D, 0xC5, 0x38, 0x67, 0x43, 0xAF, 0x1D, 0x42, 0x60, 0x80,
+    0xB2, 0xB5, 0xE7, 0xE4, 0x2B, 0x25, 0xF0, 0xD6, 0x2A, 0x54, 0x92, 0x4F, 0x7C, 0xD3, 0xE6, 0x69,
+    0xF9, 0x1A, 0x3C, 0x17, 0x53, 0x75, 0x94, 0xF6, 0x57, 0x47, 0x81, 0xAE, 0x34, 0x65, 0x04, 0x4E,
+    0x51, 0x6B, 0x59, 0xD2, 0x02, 0xF1, 0x00, 0xE2, 0x0B, 0xBF, 0x1D, 0x54, 0x4D, 0x2E, 0x53, 0x12,
+    0xE6, 0xE1, 0x6A, 0x6F, 0x5A, 0x45, 0x5C, 0xC7, 0x82, 0xB1, 0x36, 0xDC, 0xE2, 0xBC, 0xEC, 0xA6,
+    0x7D, 0xFE, 0x0E, 0x16, 0x6B, 0x4A, 0x96, 0x4F, 0xD7, 0x34, 0x29, 0xE8, 0x30, 0x10, 0x49, 0xC6,
+    0xF2, 0x4F, 0x42, 0x63, 0xCC, 0xE1, 0x81, 0xF6, 0x86, 0x82, 0xCD, 0xF2, 0x8B, 0x0A, 0x4C, 0x2E,
+    0xCD, 0xFC, 0xD2, 0x5C, 0xDD, 0xCB, 0xD4, 0x59, 0xD0, 0x36, 0x49, 0x27, 0x2D, 0x11, 0x73, 0xC9,
+    0x85, 0xA4, 0x58, 0x21, 0x59, 0x7D, 0xD1, 0x02, 0xBB, 0x17, 0x6D, 0x19, 0xEA, 0x62, 0x1C, 0xA9,
+    0x36, 0x34, 0xFC, 0xB9, 0x24, 0x70, 0xBB, 0xDA, 0x27, 0x7F, 0x00, 0xCD, 0x55, 0xB1, 0x6E, 0xD4,
+    0x40, 0x14, 0x7C, 0xB6, 0x03, 0x96, 0x58, 0x81, 0x29, 0x90, 0x28, 0x52, 0xF8, 0x07, 0x40, 0x6E,
+    0x29, 0x20, 0x6B, 0xC1, 0x0F, 0xA4, 0x81, 0x82, 0x9F, 0xC8, 0x17, 0xE4, 0xCE, 0x28, 0x25, 0x4D,
+    0x3E, 0x21, 0x15, 0xC5, 0xA5, 0xA0, 0xA5, 0x88, 0xCE, 0x2B, 0x52, 0x52, 0x60, 0x0A, 0x44, 0x7B,
+    0x05, 0x55, 0x1A, 0x56, 0xC8, 0xC5, 0x29, 0xD8, 0x5E, 0x66, 0x9E, 0x2F, 0x70, 0x39, 0x42, 0x1B,
+    0x65, 0xA5, 0x7B, 0xF6, 0x79, 0x77, 0xDF, 0xCC, 0x9B, 0x37, 0x5E, 0x8B, 0x8C, 0x63, 0xC1, 0x30,
+    0x65, 0xC8, 0x3D, 0x42, 0x1C, 0x4A, 0x44, 0xC3, 0x5B, 0x79, 0x20, 0x6B, 0x23, 0x0B, 0x21, 0x2C,
+    0x12, 0x84, 0xA5, 0x6C, 0x9F, 0xCF, 0x7A, 0x89, 0x5B, 0xC9, 0x4A, 0xE9, 0x24, 0x71, 0x62, 0x99,
+    0x25, 0x77, 0xDC, 0xC7, 0x6C, 0x49, 0xCB, 0xF5, 0x1D, 0x83, 0x9D, 0x0D, 0xC8, 0x1B, 0x90, 0xD3,
+    0x9C, 0xCF, 0xAA, 0xF5, 0x99, 0x11, 0xB1, 0x92, 0x2D, 0xEE, 0xC9, 0x38, 0x93, 0x3A, 0x66, 0x5B,
+    0xC8, 0xF4, 0xD5, 0x71, 0x1B, 0x03, 0xA7, 0x63, 0x18, 0xFE, 0x12, 0x30, 0x24, 0x96, 0x13, 0xA0,
+    0x60, 0x9A, 0x29, 0x83, 0x3D, 0x44, 0xD8, 0x92, 0x9B, 0xC4, 0x33, 0xA1, 0x74, 0x49, 0xD0, 0xE0,
+    0x09, 0x32, 0x17, 0x49, 0xBD, 0x71, 0x12, 0x2F, 0xE4, 0xE8, 0xE6, 0xF0, 0x8C, 0xDB, 0xCC, 0x49,
+    0x34, 0x18, 0x64, 0xA8, 0x5F, 0x20, 0x43, 0x5E, 0xEE, 0xCB, 0xE6, 0xB0, 0xD8, 0x50, 0x29, 0x4F,
+    0xD9, 0x3B, 0x3B, 0x6E, 0xC5, 0x34, 0xF2, 0x8C, 0xF5, 0x65, 0xC4, 0x4C, 0xAA, 0x11, 0xB3, 0xA8,
+    0x58, 0x4C, 0x73, 0x51, 0xB9, 0x0C, 0xC7, 0x4B, 0xB0, 0x09, 0x3D, 0x66, 0xCE, 0x66, 0xEB, 0x33,
+    0x91, 0xF2, 0x9C, 0x88, 0xDC, 0xE7, 0x9E, 0xA7, 0x9C, 0xC9, 0x35, 0x5B, 0x15, 0xF5, 0xAF, 0xDF,
+    0x37, 0x06, 0x38, 0xDE, 0xA8, 0x1E, 0x3A, 0xEE, 0xE1, 0x37, 0xA7, 0x1F, 0x47, 0x35, 0x23, 0xDC,
+    0x63, 0xE7, 0xC5, 0x08, 0xC1, 0x25, 0xC0, 0x88, 0xEA, 0x92, 0xC2, 0x29, 0x8A, 0x1D, 0x21, 0x28,
+    0x99, 0x2D, 0x55, 0x15, 0xC2, 0x52, 0xC6, 0xF9, 0xA8, 0x21, 0x0A, 0x26, 0xE5, 0x68, 0x79, 0x69,
+    0x51, 0xEA, 0x81, 0xD1, 0x4B, 0x11, 0x54, 0x4B, 0x7A, 0xE9, 0x11, 0xD6, 0x80, 0x7E, 0x86, 0xC9,
+    0xBA, 0x85, 0x46, 0x78, 0x54, 0xAE, 0x8B, 0xE2, 0xF1, 0x6B, 0xE4, 0x76, 0x2F, 0x0A, 0xCD, 0xCC,
+    0x04, 0x42, 0x1E, 0x4D, 0x4B, 0x2A, 0x44, 0xE2, 0x8F, 0xE0, 0xD4, 0x87, 0x50, 0x76, 0xD5, 0xA4,
+    0xC9, 0x58, 0x97, 0xF4, 0x63, 0xE7, 0x48, 0xB9, 0x40, 0xBA, 0x3A, 0x34, 0x2B, 0x00, 0x6E, 0x9A,
+    0x7A, 0x89, 0x20, 0x44, 0xEA, 0x7B, 0xFC, 0xB5, 0xF2, 0x58, 0xEE, 0x5E, 0x1B, 0x7E, 0xE2, 0x33,
+    0x17, 0xF7, 0x99, 0x97, 0x90, 0x74, 0x70, 0xC5, 0x87, 0x4D, 0x4B, 0xA0, 0x61, 0x94, 0x6A, 0x0F,
+    0xCB, 0xE1, 0x87, 0xD1, 0x82, 0xDD, 0x2A, 0x37, 0xB1, 0x88, 0xAF, 0xFD, 0xBE, 0xEA, 0xA1, 0x7A,
+    0x60, 0x72, 0xC5, 0x43, 0x83, 0x9C, 0x86, 0xA6, 0x59, 0x8D, 0x6D, 0x9A, 0x0E, 0xA4, 0x68, 0xD8,
+    0x77, 0xCB, 0xDB, 0xC1, 0xB1, 0xD6, 0xC2, 0x73, 0x7D, 0xBA, 0x64, 0x8C, 0x3B, 0x56, 0x8C, 0x3E,
+    0xB1, 0xE6, 0x41, 0x73, 0x0D, 0x5A, 0xF3, 0x70, 0x6B, 0xEF, 0xEB, 0xAE, 0x0C, 0xB0, 0xAD, 0x97,
+    0xFE, 0x4E, 0x7D, 0x76, 0x84, 0x4A, 0x51, 0x3F, 0x40, 0xA0, 0x40, 0xB2, 0x24, 0x25, 0x6C, 0x07,
+    0x87, 0x6C, 0x41, 0x1D, 0x0A, 0x47, 0x25, 0x6A, 0x75, 0x34, 0xFC, 0xD4, 0x47, 0x90, 0xBE, 0x08,
+    0x7C, 0xC3, 0x00, 0x7E, 0xB8, 0x56, 0x79, 0x51, 0x3A, 0x35, 0xDE, 0xC7, 0x85, 0x9E, 0x92, 0x2A,
+    0x57, 0xFC, 0x25, 0xD0, 0xFD, 0x91, 0x9B, 0xC8, 0x7F, 0x86, 0x6D, 0xE1, 0x5E, 0x40, 0x83, 0x33,
+    0xFB, 0x49, 0xB1, 0x4B, 0x49, 0x06, 0x6D, 0x07, 0x6D, 0xBD, 0xC3, 0x4B, 0xC5, 0x4B, 0xFA, 0xC3,
+    0x09, 0x5E, 0x41, 0xF3, 0xB9, 0x91, 0x13, 0x90, 0xFB, 0xE4, 0x29, 0x60, 0x76, 0xD0, 0x0A, 0xEC,
+    0x9A, 0x3F, 0x5F, 0x0A, 0x74, 0xCE, 0xA5, 0x8B, 0x70, 0x29, 0x64, 0x1E, 0x7B, 0x66, 0xB0, 0x54,
+    0x6F, 0x47, 0xEC, 0x01, 0x28, 0xED, 0x4B, 0x7E, 0x0A, 0x4A, 0x27, 0x92, 0x7D, 0x73, 0x2C, 0x26,
+    0xFD, 0xA5, 0x97, 0x04, 0xCA, 0x21, 0x43, 0x04, 0x0C, 0x6E, 0x45, 0x59, 0x05, 0x6E, 0x6B, 0x4A,
+    0x5B, 0xA9, 0x25, 0x2E, 0xBD, 0x55, 0xF2, 0x44, 0xFE, 0xBC, 0xA8, 0xA9, 0x46, 0xA3, 0x2D, 0x89,
+    0xF5, 0x5E, 0x76, 0x37, 0x8A, 0xAB, 0xF9, 0xAD, 0x80, 0x58, 0x4E, 0xD2, 0xE1, 0x25, 0xE2, 0x14,
+    0x47, 0x42, 0x95, 0xF2, 0x44, 0x11, 0x0B, 0x5D, 0x06, 0x6E, 0x8B, 0x3B, 0x36, 0xC5, 0xF8, 0x9A,
+    0xCE, 0x3E, 0xD5, 0x83, 0x9B, 0x0F, 0xA2, 0x8E, 0xD6, 0x30, 0x3F, 0x99, 0xD8, 0xBE, 0xA5, 0x5D,
+    0x7A, 0x74, 0x02, 0x2D, 0xE5, 0x3A, 0xFB, 0x46, 0x8D, 0xA9, 0xEF, 0x6C, 0x03, 0x27, 0xA2, 0xB3,
+    0x38, 0xF7, 0xF1, 0x79, 0x2A, 0xDA, 0x87, 0x83, 0x22, 0x36, 0x3C, 0x05, 0xDB, 0x7F, 0x38, 0xC5,
+    0xE3, 0xC7, 0xAC, 0xBA, 0x20, 0x1E, 0x69, 0x97, 0xB2, 0xEF, 0x1B, 0x55, 0xDE, 0x50, 0xF6, 0xD7,
+    0x3B, 0x7E, 0x03, 0xD5, 0x55, 0x3D, 0x6E, 0x16, 0x31, 0x10, 0x1D, 0xAF, 0x09, 0x2E, 0x56, 0xC8,
+    0x0D, 0x12, 0xE5, 0x36, 0x14, 0x14, 0x91, 0x7C, 0x01, 0x14, 0x47, 0xA2, 0xA0, 0xA0, 0x49, 0x01,
+    0xE2, 0x18, 0x5C, 0x80, 0xC4, 0x9B, 0x9A, 0x9A, 0x9E, 0x83, 0xF0, 0x65, 0x57, 0xA2, 0xA4, 0x59,
+    0x71, 0x82, 0x15, 0xA2, 0xC7, 0xA0, 0x45, 0xDA, 0x84, 0xFD, 0xD6, 0xBC, 0x37, 0x89, 0x44, 0xA2,
+    0x2F, 0x07, 0x48, 0xAC, 0xD5, 0x68, 0x65, 0x8F, 0x67, 0xDE, 0xBC, 0xF9, 0xB1, 0xC8, 0xD5, 0xDA,
+    0x52, 0xF8, 0x85, 0x72, 0xA5, 0xF4, 0xDF, 0x66, 0x11, 0xB3, 0x54, 0x59, 0xA4, 0x6E, 0xAB, 0x56,
+    0x6E, 0xAC, 0xAE, 0x1C, 0x8A, 0x84, 0x52, 0x7A, 0x71, 0xEB, 0x1B, 0xC8, 0xD4, 0xE2, 0x73, 0x13,
+    0x0E, 0x24, 0x42, 0x75, 0xAD, 0x60, 0xA1, 0x5A, 0x7C, 0x8F, 0xBB, 0xB9, 0x83, 0x7E, 0xF3, 0x05,
+    0x67, 0x92, 0xB8, 0x61, 0x96, 0x84, 0xDF, 0xFA, 0x37, 0x7D, 0xC4, 0x0F, 0x99, 0x9E, 0x03, 0xB6,
+    0x9D, 0xEA, 0xC5, 0xD3, 0x85, 0x1A, 0x16, 0xDA, 0x7E, 0xF0, 0x38, 0x5C, 0xA5, 0x19, 0xA5, 0xC9,
+    0x12, 0xA6, 0x27, 0xAB, 0x7A, 0x1C, 0x60, 0xAC, 0xD0, 0x98, 0x1C, 0x29, 0x12, 0x37, 0x3E, 0xA3,
+    0xE5, 0x11, 0xBA, 0x96, 0x78, 0xC4, 0x6B, 0x0C, 0x4F, 0xE9, 0x6A, 0x77, 0x05, 0xDE, 0xAF, 0x4B,
+    0xC9, 0x62, 0xCA, 0xC7, 0x94, 0xD5, 0xF8, 0x68, 0x10, 0x7A, 0xE8, 0xFD, 0x08, 0xF7, 0x2D, 0x41,
+    0x74, 0x36, 0x13, 0xFD, 0x25, 0xAA, 0xAD, 0xA2, 0x27, 0xCC, 0xD4, 0xF4, 0xDC, 0xA6, 0x86, 0xFF,
+    0xAE, 0xE8, 0x5F, 0x65, 0x82, 0xA5, 0x9E, 0x1F, 0x19, 0x54, 0x22, 0x89, 0x76, 0xB2, 0x0B, 0x2D,
+    0xB9, 0x59, 0xDC, 0x22, 0xF5, 0x76, 0xAF, 0xB4, 0xF4, 0x08, 0xC8, 0xAE, 0x28, 0xC7, 0x8F, 0xAF,
+    0xE1, 0xD9, 0x90, 0x5E, 0x37, 0x07, 0xA0, 0x0A, 0x43, 0xC1, 0xC6, 0xB1, 0x99, 0xEE, 0x32, 0xEE,
+    0x07, 0xB0, 0x34, 0xCA, 0xF3, 0xA6, 0xF5, 0xFD, 0x99, 0xCD, 0xD5, 0x0C, 0xC5, 0x42, 0x10, 0x62,
+    0x91, 0x9D, 0x75, 0x92, 0x58, 0x0F, 0x7E, 0x08, 0x2F, 0x26, 0xD9, 0x3C, 0x92, 0x9B, 0x35, 0x83,
+    0x08, 0xF6, 0x35, 0x81, 0x5F, 0x7B, 0x69, 0xCE, 0xDF, 0x22, 0x92, 0x4B, 0x47, 0x06, 0x17, 0x63,
+    0xCF, 0xAA, 0xF1, 0x2B, 0x8A, 0x45, 0xEC, 0xDF, 0x2C, 0xC0, 0x81, 0x22, 0x81, 0xD5, 0x03, 0x97,
+    0x51, 0x0A, 0xBE, 0x4D, 0x80, 0x68, 0x47, 0x97, 0x5D, 0x36, 0x33, 0x4A, 0xAC, 0x93, 0x13, 0x20,
+    0xAF, 0x73, 0xD3, 0x02, 0x78, 0xE7, 0x06, 0x69, 0xFA, 0xFA, 0xD7, 0x24, 0x76, 0x96, 0xB4, 0x61,
+    0x34, 0x0E, 0xD5, 0xE9, 0x07, 0x89, 0x03, 0xB7, 0xAA, 0x15, 0x9C, 0x81, 0x1C, 0x0D, 0x28, 0x68,
+    0x05, 0xD9, 0x3E, 0x91, 0x4F, 0x91, 0xBD, 0xEB, 0x08, 0xF7, 0x55, 0xA6, 0x4B, 0xA9, 0xC7, 0x41,
+    0x73, 0x51, 0x69, 0x4F, 0x30, 0xF4, 0xEB, 0x2B, 0x95, 0xDE, 0x96, 0xA5, 0x2B, 0xAD, 0x2D, 0x33,
+    0x0B, 0x3F, 0x1D, 0x92, 0xFD, 0x08, 0xE6, 0x45, 0x0E, 0xA4, 0x46, 0x52, 0x8E, 0x89, 0x81, 0x12,
+    0x3C, 0x7F, 0x16, 0x26, 0x61, 0x11, 0x20, 0x96, 0x59, 0xC2, 0xA1, 0x20, 0xCD, 0x11, 0x32, 0xE3,
+    0x86, 0xA0, 0x06, 0xE0, 0x15, 0xD7, 0x4F, 0x20, 0x47, 0x39, 0x03, 0xE3, 0x03, 0x65, 0xDD, 0x53,
+    0xFA, 0x16, 0xF1, 0x52, 0x2D, 0x31, 0x5A, 0x89, 0xE7, 0xEF, 0xD0, 0x97, 0x5E, 0x1B, 0xA1, 0x2A,
+    0xEB, 0x4E, 0x14, 0x62, 0x46, 0x6D, 0xE4, 0xAC, 0x6D, 0xCA, 0x7F, 0x57, 0x98, 0x08, 0xFF, 0x63,
+    0x57, 0xF5, 0x0E, 0x47, 0xA1, 0x15, 0x67, 0x39, 0x65, 0xC4, 0xFF, 0x64, 0x2B, 0xC7, 0x97, 0x3A,
+    0x2A, 0x4C, 0xD6, 0x08, 0x3F, 0xDD, 0x8B, 0x28, 0x36, 0x15, 0xC0, 0x98, 0xD5, 0x71, 0x90, 0x6E,
+    0x6B, 0x16, 0xD3, 0xEC, 0x86, 0x5B, 0xBA, 0xFB, 0xCE, 0x66, 0xE1, 0xBD, 0x76, 0x01, 0xE9, 0x0F,
+    0x33, 0x33, 0x41, 0x15, 0xBB, 0x33, 0xC4, 0x38, 0x99, 0x16, 0x5B, 0xB6, 0xA5, 0xB4, 0xB1, 0x9C,
+    0x22, 0x67, 0xA9, 0x45, 0x23, 0xBB, 0x91, 0xA8, 0x16, 0xA9, 0x66, 0x3A, 0x44, 0x87, 0x0E, 0x4C,
+    0x1F, 0xCC, 0xD4, 0x63, 0x64, 0x3E, 0x81, 0x48, 0xEC, 0x1F, 0x92, 0xD2, 0xA8, 0x67, 0xCE, 0x6E,
+    0x0E, 0x00, 0xAC, 0x33, 0xB5, 0x39, 0xFC, 0x7F, 0x95, 0x78, 0x64, 0xB4, 0x0D, 0x03, 0x6B, 0xD9,
+    0xCE, 0xEA, 0x13, 0x67, 0x46, 0xB1, 0x4B, 0x2C, 0x1C, 0x82, 0xAC, 0xF3, 0x87, 0x3C, 0x22, 0xED,
+    0x62, 0x2F, 0x8E, 0xF4, 0x49, 0x68, 0xC5, 0x5D, 0x74, 0x19, 0xE6, 0x30, 0x6C, 0x7C, 0x6F, 0x28,
+    0x60, 0x55, 0x05, 0x18, 0x5C, 0x48, 0xE0, 0x02, 0x84, 0xB8, 0x13, 0xE9, 0x1E, 0xA3, 0x06, 0xCF,
+    0x59, 0xB7, 0xF2, 0x8D, 0x83, 0xD1, 0xED, 0x6B, 0x21, 0xD7, 0x57, 0xEE, 0x03, 0x41, 0x76, 0xE5,
+    0xD6, 0xA7, 0xE5, 0x9E, 0xAE, 0x7F, 0xB5, 0x55, 0xB1, 0x72, 0xE4, 0x44, 0x10, 0x7D, 0x23, 0xB1,
+    0x8C, 0xA9, 0x09, 0xE6, 0x02, 0x48, 0xB8, 0x40, 0x0E, 0x49, 0x8C, 0x7E, 0xE0, 0xEC, 0x19, 0xF8,
+    0x81, 0x23, 0x27, 0xE0, 0x13, 0xF8, 0x00, 0xB0, 0x25, 0x8E, 0x80, 0x80, 0x84, 0x88, 0x84, 0x94,
+    0xDC, 0x04, 0x04, 0x0E, 0x76, 0xAD, 0xA9, 0xF2, 0x0F, 0x08, 0x08, 0x08, 0x48, 0x14, 0xDD, 0x05,
+    0x04, 0x9E, 0x2A, 0x44, 0x95, 0xAE, 0x6E, 0xA4, 0xE1, 0xB5, 0xD6, 0x86, 0x3B, 0x13, 0x50, 0x45,
+    0x9D, 0x55, 0xAB, 0xAE, 0xDD, 0xED, 0x99, 0x7E, 0xFD, 0x7A, 0x5E, 0xF7, 0x00, 0xC0, 0xBB, 0x03,
+    0x0D, 0x9A, 0xDC, 0xD2, 0x76, 0xE7, 0x23, 0xED, 0x19, 0x2E, 0x69, 0x1D, 0x6C, 0x00, 0x6A, 0x5F,
+    0xD2, 0x6F, 0x83, 0xA2, 0x43, 0x0F, 0xB8, 0x00, 0x8A, 0x11, 0x8F, 0xE8, 0x4E, 0x38, 0x5E, 0x17,
+    0x89, 0xB5, 0xED, 0xFB, 0x10, 0xB7, 0xF5, 0xE2, 0xD6, 0xBD, 0xB8, 0x55, 0x5A, 0xDD, 0x8E, 0x31,
+    0xAA, 0xB6, 0xE4, 0x0F, 0xD3, 0xC3, 0xB5, 0x28, 0x22, 0xF4, 0x28, 0xBB, 0x05, 0xC3, 0xD1, 0x17,
+    0xE8, 0x06, 0x31, 0xCC, 0x4F, 0xBD, 0x8A, 0x28, 0xE3, 0x22, 0x48, 0xA9, 0xCE, 0xB4, 0x67, 0x45,
+    0x1E, 0x24, 0x03, 0xE5, 0xB1, 0xE6, 0x02, 0xBA, 0xC5, 0xCA, 0x0A, 0x68, 0x2F, 0x00, 0xC5, 0x32,
+    0xCB, 0x3F, 0xDD, 0x6A, 0xDF, 0xFC, 0x1E, 0xFB, 0x87, 0xEB, 0x71, 0x74, 0xBB, 0x5C, 0x32, 0xC0,
+    0x7C, 0xFB, 0xCB, 0x08, 0xCD, 0x07, 0xF8, 0xE7, 0xD1, 0x8B, 0x69, 0x8B, 0xBC, 0x44, 0xE4, 0x8F,
+    0x33, 0xEA, 0xD6, 0x0E, 0x3A, 0x62, 0xCB, 0xFC, 0x6C, 0x60, 0x5E, 0x13, 0xD3, 0xAD, 0xBC, 0xE3,
+    0x56, 0x72, 0x6F, 0x58, 0x18, 0x3B, 0x98, 0xBE, 0x58, 0x98, 0xFB, 0x67, 0xFD, 0xD7, 0xB1, 0x3E,
+    0x3E, 0x6A, 0xAE, 0xAF, 0xAE, 0xAF, 0x72, 0x74, 0xB1, 0x9A, 0xCA, 0x09, 0x6F, 0xE3, 0x0D, 0x09,
+    0xF9, 0x9E, 0x84, 0xED, 0x6F, 0x50, 0x1D, 0x93, 0x31, 0xC3, 0x4D, 0xD2, 0x47, 0xB8, 0xF3, 0xBC,
+    0x7E, 0x74, 0x29, 0x16, 0x16, 0xBE, 0x35, 0x01, 0xCD, 0x75, 0x20, 0xF0, 0x96, 0xA5, 0x64, 0x85,
+    0xD7, 0x53, 0xFA, 0x68, 0x2D, 0xCE, 0xBD, 0xA1, 0x4B, 0x65, 0xEB, 0xFE, 0x07, 0xE8, 0xFC, 0x18,
+    0x78, 0x9E, 0x23, 0xAC, 0xE6, 0x31, 0x3D, 0x78, 0xEB, 0x2E, 0xEF, 0x66, 0xB8, 0x40, 0x9D, 0xAF,
+    0x61, 0xFF, 0xEC, 0x62, 0x31, 0x31, 0xDF, 0x06, 0x26, 0xF0, 0x8C, 0x93, 0x9A, 0x98, 0x67, 0xCD,
+    0xA4, 0x79, 0x5A, 0x8E, 0xA0, 0x5A, 0xD0, 0x17, 0xEC, 0x50, 0x0F, 0x66, 0xD0, 0xBB, 0x83, 0xAE,
+    0xF8, 0xE3, 0xE7, 0x5F, 0x97, 0x74, 0x92, 0x5C, 0x2E, 0xB3, 0xCA, 0xAD, 0x6B, 0x49, 0xD8, 0x0B,
+    0xED, 0x0D, 0x65, 0x50, 0x8E, 0xB0, 0xB1, 0xF1, 0x98, 0x49, 0x44, 0x31, 0xA5, 0xFB, 0x2E, 0x36,
+    0x56, 0x09, 0x8A, 0x00, 0x27, 0x4A, 0x59, 0x07, 0x14, 0x03, 0x7B, 0xE3, 0xB8, 0xE4, 0x97, 0xC8,
+    0x56, 0xA9, 0xB2, 0x50, 0x6D, 0xEF, 0x93, 0xF7, 0x4D, 0x0E, 0xB9, 0x6D, 0x46, 0xC2, 0xBD, 0xC8,
+    0x09, 0xDD, 0xB7, 0xB9, 0xDD, 0x15, 0x89, 0x31, 0x4E, 0x19, 0x2B, 0x21, 0x49, 0xF3, 0xAA, 0xC4,
+    0x26, 0x8C, 0x26, 0xD6, 0xE4, 0xD7, 0x04, 0x07, 0xF3, 0xFB, 0x2C, 0x14, 0x73, 0x4F, 0x2B, 0x42,
+    0xD9, 0xA1, 0x09, 0xD2, 0x92, 0xFC, 0xE3, 0xB0, 0x2B, 0x7F, 0x8B, 0x6A, 0x6C, 0xCE, 0xBF, 0x9C,
+    0x3F, 0x1D, 0xDC, 0x52, 0xE4, 0xEC, 0xAB, 0x51, 0x08, 0x2A, 0x60, 0xB3, 0x87, 0x53, 0xB9, 0x2F,
+    0x73, 0x2A, 0x9F, 0x5F, 0x96, 0x51, 0xB1, 0x6C, 0x20, 0xF9, 0xED, 0xBE, 0x9B, 0x5B, 0x19, 0x12,
+    0x24, 0x26, 0xDD, 0x5D, 0x07, 0x7C, 0x15, 0x55, 0xCC, 0xDF, 0x8D, 0x75, 0x8E, 0x05, 0x23, 0x6F,
+    0xD6, 0xD6, 0x2C, 0xD8, 0x15, 0xE7, 0x41, 0x5A, 0x9E, 0xFD, 0x4E, 0xDA, 0x3C, 0x33, 0x7C, 0x23,
+    0x41, 0xF9, 0xC6, 0x75, 0x20, 0x48, 0xDF, 0xE8, 0x9B, 0xAF, 0x32, 0x5E, 0xFE, 0x2E, 0xA0, 0xCE,
+    0x9E, 0xB8, 0x48, 0xA6, 0x3F, 0xC1, 0xA9, 0x09, 0xA6, 0x9F, 0x54, 0xAA, 0x79, 0xEA, 0xA4, 0xD4,
+    0x74, 0x83, 0x26, 0x44, 0xE7, 0x65, 0xCE, 0x90, 0x4E, 0xA1, 0xC9, 0xC1, 0x3D, 0x95, 0xF4, 0x5B,
+    0xC3, 0xD9, 0xB6, 0xCF, 0x9C, 0x2E, 0xC3, 0xA0, 0xCD, 0x7E, 0x18, 0xB0, 0x35, 0x25, 0x7B, 0x7B,
+    0x47, 0x9A, 0xD4, 0x10, 0x85, 0x4B, 0x10, 0xDB, 0x56, 0x7E, 0x8B, 0x5D, 0x49, 0x9D, 0x10, 0x05,
+    0xA9, 0x8A, 0xFA, 0xC5, 0xC2, 0x2A, 0x7B, 0x81, 0x29, 0xC6, 0x75, 0xA4, 0x1D, 0x56, 0x41, 0xF7,
+    0xC4, 0x41, 0xC7, 0x59, 0x25, 0x2A, 0x58, 0x45, 0x47, 0x34, 0x45, 0x12, 0x96, 0xDA, 0x5F, 0x46,
+    0x98, 0xAB, 0x88, 0x9D, 0xE6, 0x3A, 0x8B, 0x83, 0x97, 0x44, 0xF9, 0x1A, 0x80, 0x36, 0xB4, 0xEE,
+    0x8B, 0x84, 0xE6, 0x09, 0xDF, 0x42, 0x54, 0xE9, 0x5F, 0x55, 0x3C, 0x43, 0xB8, 0x1C, 0x04, 0x83,
+    0xC1, 0x7B, 0x29, 0x19, 0xB1, 0x82, 0x80, 0x38, 0x36, 0x26, 0x8B, 0x86, 0x86, 0x79, 0x12, 0x85,
+    0x25, 0x5B, 0xCB, 0xC6, 0xDA, 0xB0, 0x0B, 0x08, 0x53, 0xE7, 0x09, 0x52, 0x38, 0x4E, 0x0C, 0x39,
+    0xB5, 0x1F, 0xE5, 0x3E, 0x88, 0x54, 0x24, 0xC5, 0x7A, 0xB1, 0xD7, 0xBE, 0xEA, 0x42, 0x1E, 0xDF,
+    0x49, 0x74, 0x54, 0x2D, 0xE3, 0x8B, 0xD6, 0x28, 0x26, 0x6F, 0x83, 0xA6, 0xB4, 0x0F, 0xE7, 0x47,
+    0x6E, 0xB1, 0x4B, 0x39, 0xAF, 0x23, 0x81, 0x13, 0xF1, 0x54, 0x8E, 0x95, 0x8D, 0xC3, 0x59, 0x58,
+    0xF9, 0x97, 0x07, 0xE1, 0x43, 0x46, 0x98, 0xC1, 0x38, 0xDC, 0x4F, 0x39, 0x90, 0x6E, 0x29, 0xF7,
+    0x80, 0x08, 0x89, 0xB4, 0x09, 0x47, 0x19, 0xD4, 0x4F, 0xE0, 0x1E, 0xC3, 0x2D, 0x70, 0x13, 0x5C,
+    0xBF, 0x87, 0xF7, 0x92, 0x0F, 0xB5, 0x7B, 0x96, 0x38, 0xE1, 0xCA, 0xE1, 0x84, 0xE3, 0x6D, 0x73,
+    0xDB, 0x94, 0xFF, 0x2F, 0x26, 0x67, 0x48, 0x91, 0x6C, 0x9F, 0xF5, 0xE8, 0x3E, 0x48, 0xAF, 0x8C,
+    0x0F, 0xC6, 0xB3, 0xD9, 0xAB, 0x4F, 0x82, 0x04, 0x61, 0x40, 0xA9, 0x96, 0x5B, 0x2F, 0x25, 0x91,
+    0xFB, 0xFE, 0x3E, 0xA3, 0xA8, 0x18, 0xD2, 0xFE, 0x12, 0x4A, 0x1E, 0x10, 0x3F, 0x8C, 0xA9, 0x6E,
+    0xF7, 0xAB, 0xE1, 0x80, 0xDC, 0x59, 0x02, 0xB9, 0xD6, 0xE4, 0x42, 0xEA, 0xB8, 0xF3, 0x19, 0x93,
+    0xF9, 0x50, 0xEE, 0x24, 0xB9, 0x19, 0xB6, 0x78, 0xB8, 0x7C, 0xCE, 0xB3, 0x9D, 0x8B, 0x59, 0xCF,
+    0x26, 0xAA, 0x85, 0xB1, 0x97, 0xDA, 0xE3, 0x92, 0x30, 0xBB, 0x33, 0xBE, 0x6C, 0xA8, 0x2D, 0x51,
+    0xD3, 0xCC, 0x19, 0x31, 0x53, 0xB7, 0x33, 0xA1, 0x3B, 0xF2, 0x70, 0x2D, 0x2D, 0x9B, 0x42, 0xD4,
+    0xFF, 0xAF, 0x89, 0xF7, 0x5F, 0xCF, 0x5F, 0xCD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x14, 0x9C, 0xB5,
+    0x73, 0xB8, 0x70, 0xB1, 0x29, 0x12, 0x09, 0x89, 0x62, 0x29, 0x28, 0x10, 0x82, 0xF8, 0x07, 0xC2,
+    0xF9, 0xA0, 0x49, 0x9B, 0xE6, 0x2A, 0x0A, 0x3E, 0x81, 0x86, 0x12, 0xCE, 0x4E, 0x5A, 0x1A, 0x3E,
+    0x86, 0x82, 0xE2, 0xEE, 0xBC, 0x81, 0x1F, 0xB0, 0x68, 0x28, 0x71, 0x81, 0x44, 0x91, 0x22, 0x06,
+    0x8C, 0x64, 0xC2, 0xFA, 0x96, 0x79, 0x3E, 0x07, 0xB8, 0xD4, 0x44, 0x8A, 0x25, 0xEF, 0xDE, 0xF9,
+    0xF6, 0xDE, 0xCC, 0x9B, 0x37, 0xEF, 0x19, 0xD8, 0x06, 0x10, 0x37, 0xF7, 0x81, 0xAC, 0xA9, 0x11,
+    0x7E, 0xF1, 0x16, 0x3A, 0x72, 0xC0, 0x56, 0x30, 0xC1, 0xE6, 0xF5, 0xAC, 0x8A, 0xDB, 0xC8, 0x1F,
+    0xF9, 0x66, 0x34, 0x33, 0x67, 0x95, 0xFA, 0xD1, 0x24, 0x93, 0xE8, 0xD3, 0x64, 0x81, 0xE4, 0x4D,
+    0x58, 0xC3, 0xE7, 0xDA, 0x86, 0x0E, 0x33, 0x98, 0x32, 0x68, 0x50, 0x80, 0xDF, 0x1A, 0xA4, 0xDC,
+    0x54, 0xCB, 0x87, 0x71, 0x79, 0xCC, 0x6F, 0x26, 0xB6, 0x58, 0xB5, 0x29, 0x42, 0x9F, 0xB7, 0x84,
+    0x64, 0xC8, 0x2D, 0x89, 0x4B, 0x9C, 0xA0, 0x04, 0x18, 0x04, 0x8C, 0x00, 0xAC, 0x78, 0xA7, 0x42,
+    0x2A, 0x07, 0xD4, 0x5F, 0xF8, 0xC8, 0xE7, 0x48, 0x7D, 0x8D, 0xD5, 0x81, 0x63, 0xE8, 0x2E, 0xAE,
+    0xD0, 0x19, 0x8B, 0x65, 0x32, 0xC1, 0x92, 0xA7, 0x17, 0x19, 0xD0, 0xCD, 0x00, 0xB7, 0x84, 0x6A,
+    0x97, 0x08, 0x9B, 0x25, 0xE2, 0x2A, 0x83, 0xB1, 0xA9, 0x2D, 0x60, 0xBC, 0xE3, 0xDF, 0x89, 0xB1,
+    0xD3, 0x47, 0xBA, 0xCB, 0xFB, 0x25, 0xEF, 0x8E, 0x80, 0x2D, 0x71, 0x2A, 0xC0, 0x90, 0xC4, 0x83,
+    0xCD, 0x74, 0xFF, 0x1F, 0x1E, 0x63, 0x6B, 0x26, 0x97, 0x30, 0xE3, 0x99, 0x83, 0x6A, 0xE6, 0x08,
+    0xAB, 0x31, 0x74, 0xBE, 0x87, 0xD1, 0x5A, 0x81, 0xFF, 0x8B, 0x27, 0x05, 0xCD, 0x8E, 0x2C, 0xEB,
+    0x49, 0xCD, 0x53, 0x07, 0x2D, 0xAA, 0x4E, 0xEE, 0x6C, 0x66, 0xA7, 0x7C, 0xC5, 0x3A, 0x78, 0x84,
+    0x3F, 0x4D, 0x2D, 0x70, 0x41, 0x8B, 0xF4, 0x91, 0x63, 0xCC, 0x05, 0x82, 0x56, 0xF0, 0x88, 0x9D,
+    0x1E, 0x54, 0xD0, 0xEF, 0x5A, 0x44, 0x95, 0x00, 0x26, 0x79, 0xD0, 0x46, 0xB5, 0x72, 0xF0, 0x81,
+    0xEB, 0x11, 0x95, 0x67, 0x42, 0x4A, 0x5C, 0xA2, 0x26, 0x23, 0x04, 0x4E, 0x97, 0xF0, 0x51, 0xD3,
+    0x87, 0x51, 0x43, 0xE6, 0x1B, 0xC9, 0x69, 0xFE, 0x47, 0x7F, 0xCE, 0xAC, 0x2E, 0xC3, 0x46, 0xB2,
+    0x8B, 0x6A, 0x24, 0xB4, 0x45, 0x5C, 0x39, 0x04, 0x8D, 0xA4, 0x67, 0x28, 0x00, 0x7F, 0x30, 0xC7,
+    0x2D, 0x74, 0x29, 0xF9, 0x19, 0x1B, 0xD5, 0xA1, 0x8B, 0x6B, 0x64, 0xD4, 0xA5, 0x4F, 0x70, 0x24,
+    0xC1, 0x6E, 0x10, 0xB3, 0xA0, 0x69, 0x58, 0x3F, 0xC6, 0x18, 0x3C, 0xA2, 0xA6, 0xD3, 0x69, 0xE2,
+    0xBD, 0x2B, 0x3C, 0xCF, 0x5E, 0x24, 0xF9, 0x9A, 0xAA, 0x5B, 0x1E, 0x9E, 0x50, 0xB4, 0x4D, 0x3A,
+    0x47, 0x25, 0xF9, 0xAC, 0x1A, 0x21, 0x54, 0x43, 0x18, 0x11, 0x2E, 0xEC, 0x18, 0x8F, 0xE6, 0x0C,
+    0x9A, 0xF0, 0xB4, 0x82, 0x8B, 0x3E, 0x34, 0xC8, 0xA2, 0xB2, 0x83, 0x79, 0x65, 0x53, 0xC4, 0xA7,
+    0xD6, 0xE4, 0x01, 0x6D, 0x5E, 0xA2, 0xC8, 0x49, 0x49, 0xB8, 0xC1, 0xB4, 0xB4, 0x71, 0x52, 0x10,
+    0x51, 0xF7, 0xF4, 0xD6, 0xFC, 0xA4, 0xE0, 0x88, 0x72, 0xB1, 0xB1, 0x7C, 0x2A, 0x30, 0x98, 0x1A,
+    0x0B, 0x59, 0xE6, 0xB2, 0x1C, 0xFE, 0x53, 0x89, 0xC2, 0x62, 0x6E, 0x3C, 0xA1, 0x77, 0xA9, 0x6B,
+    0xCE, 0x36, 0x58, 0x5C, 0x6C, 0x6C, 0xA2, 0x9A, 0xDD, 0xA3, 0x2D, 0x5B, 0x6A, 0xD8, 0x32, 0x79,
+    0xC8, 0x5A, 0x21, 0x29, 0x55, 0x1B, 0x9C, 0x3D, 0x8E, 0xAA, 0x64, 0x7F, 0xDF, 0x7C, 0xFC, 0xFA,
+    0xAB, 0x4A, 0x7D, 0xE8, 0x51, 0x54, 0xBA, 0xA2, 0x01, 0x7A, 0x57, 0xDD, 0x94, 0x45, 0xD2, 0xD6,
+    0xC2, 0x6C, 0x29, 0x9C, 0xE8, 0x74, 0x8C, 0x05, 0xB3, 0xBA, 0xD4, 0xDB, 0x57, 0x46, 0x42, 0x04,
+    0x90, 0x12, 0x28, 0x1A, 0x00, 0x46, 0xA4, 0x68, 0xD9, 0x7A, 0xDA, 0x92, 0x97, 0x53, 0x35, 0x9D,
+    0xA3, 0xAE, 0x9E, 0xC4, 0x21, 0xAB, 0x62, 0x2C, 0x05, 0xF0, 0x3C, 0x1F, 0xB4, 0xDA, 0xD2, 0x32,
+    0x5B, 0x97, 0x04, 0xB8, 0x45, 0xEF, 0x9F, 0xB0, 0x8E, 0x99, 0x7A, 0x2A, 0x23, 0x8B, 0xF5, 0x2E,
+    0x87, 0x0D, 0x8E, 0x1B, 0x95, 0x73, 0xE0, 0xBC, 0x1B, 0xB6, 0x5A, 0x1E, 0x92, 0x19, 0x2D, 0x68,
+    0xF2, 0xBD, 0xE6, 0xF6, 0x2C, 0xF8, 0xFE, 0xFE, 0xA4, 0xCB, 0xCC, 0x32, 0xF4, 0x75, 0x5A, 0xC7,
+    0x2B, 0x96, 0x5B, 0xAD, 0x73, 0x47, 0x3F, 0x46, 0x23, 0xA9, 0x00, 0x71, 0x07, 0x47, 0x88, 0x0F,
+    0x94, 0xCC, 0x3F, 0x99, 0x7B, 0x97, 0xA7, 0xAC, 0x95, 0x16, 0xE3, 0x18, 0xC0, 0x93, 0x1A, 0xD2,
+    0x77, 0xCC, 0x97, 0x4F, 0x28, 0x9A, 0xC3, 0x0B, 0x59, 0xE6, 0x32, 0xBC, 0x64, 0x94, 0x50, 0x3E,
+    0x8C, 0x43, 0x56, 0x72, 0x1C, 0x31, 0x72, 0xAA, 0x29, 0x70, 0x6A, 0x18, 0x61, 0xEF, 0xA1, 0x2C,
+    0x6F, 0x05, 0x4C, 0x3A, 0x21, 0xFD, 0x03, 0x3B, 0xBB, 0x30, 0x84, 0xF8, 0xE0, 0x79, 0x26, 0x5D,
+    0xC4, 0x16, 0x82, 0x17, 0x33, 0xDC, 0x5B, 0xA3, 0xEF, 0xCA, 0xDC, 0xF5, 0x32, 0xB0, 0x64, 0xE9,
+    0xC7, 0xF0, 0x7A, 0x99, 0x6D, 0xFA, 0xD7, 0xF5, 0xA1, 0x4C, 0xC3, 0x34, 0x0A, 0xB6, 0xEF, 0xB7,
+    0xF3, 0x15, 0x5F, 0x1D, 0x9C, 0x44, 0xE1, 0x19, 0xEB, 0xC2, 0xD7, 0x47, 0x86, 0xB8, 0x95, 0xA5,
+    0x2F, 0x5A, 0xD9, 0x17, 0x10, 0x52, 0x53, 0x66, 0x92, 0xB0, 0xDB, 0xD7, 0x8A, 0xCA, 0xEB, 0x01,
+    0x59, 0x49, 0x22, 0x85, 0x27, 0x91, 0x4E, 0x88, 0xB8, 0xAD, 0x81, 0xE3, 0x5A, 0x1F, 0x49, 0x40,
+    0x5E, 0x0C, 0x88, 0xCF, 0xC9, 0x27, 0x95, 0x13, 0xBB, 0xD3, 0x5E, 0xD7, 0x1D, 0xE9, 0xA1, 0x82,
+    0xF2, 0xF4, 0x43, 0xA7, 0x9F, 0x26, 0xD8, 0x56, 0x93, 0xEB, 0x25, 0xE7, 0xF5, 0xBF, 0x7E, 0x03,
+    0xCD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x9D, 0xDD, 0x0D, 0x72, 0x84, 0x91, 0x9C, 0x82, 0x02,
+    0x11, 0x24, 0x53, 0x50, 0xD0, 0xC0, 0xB6, 0x14, 0x10, 0xFB, 0x0F, 0xA0, 0x49, 0x45, 0x4B, 0x7F,
+    0x0D, 0x05, 0x45, 0x72, 0x76, 0x4F, 0xCB, 0x57, 0x5C, 0x7E, 0x80, 0x22, 0x89, 0x2D, 0xE5, 0x07,
+    0x0C, 0x0D, 0xAD, 0x0B, 0x14, 0x89, 0x34, 0xB1, 0xC0, 0x08, 0x27, 0xF8, 0x3C, 0xBC, 0x99, 0xBB,
+    0xCB, 0x25, 0x81, 0x06, 0x29, 0x82, 0x58, 0xBA, 0xB9, 0xBB, 0xF1, 0xEE, 0xCE, 0x7B, 0x6F, 0xF6,
+    0xED, 0x12, 0xCD, 0x9F, 0x84, 0x3B, 0xC4, 0x88, 0xA7, 0x88, 0x66, 0x73, 0x93, 0x2E, 0x3F, 0x46,
+    0x63, 0x54, 0x6A, 0x6C, 0x24, 0x06, 0x32, 0x94, 0x1C, 0xA7, 0x88, 0xF6, 0x47, 0x2D, 0x7F, 0xDA,
+    0x5E, 0xE2, 0x6E, 0x22, 0xF1, 0x99, 0x8E, 0xDD, 0xB0, 0x2D, 0x62, 0x4C, 0xFB, 0x32, 0x2D, 0x8F,
+    0x91, 0x0A, 0x4B, 0x87, 0xE9, 0xAE, 0x26, 0x8C, 0xB5, 0xA7, 0x93, 0x02, 0xD3, 0x99, 0x19, 0xD3,
+    0x87, 0xC9, 0x0E, 0x52, 0xDB, 0x44, 0x19, 0xD0, 0x68, 0x29, 0x9F, 0x92, 0x6B, 0xB5, 0xE6, 0x40,
+    0x61, 0x85, 0x6C, 0xE9, 0x39, 0x35, 0x05, 0x7B, 0x0C, 0x67, 0x2E, 0x67, 0x38, 0x0B, 0x6E, 0x28,
+    0x64, 0xA6, 0x3F, 0x3C, 0x59, 0xFD, 0x9E, 0x3C, 0x1F, 0x53, 0xF4, 0xBD, 0x68, 0x6C, 0x87, 0x45,
+    0x32, 0x54, 0xC7, 0x72, 0xBD, 0xE9, 0x00, 0xC6, 0x93, 0x69, 0x01, 0x25, 0xA1, 0x31, 0x05, 0x4D,
+    0x50, 0xE3, 0xF5, 0x1E, 0xF9, 0x3A, 0xAC, 0x83, 0xBD, 0xD5, 0xC2, 0x7E, 0xFB, 0xF8, 0x69, 0xE8,
+    0x37, 0xFA, 0x84, 0x1D, 0x1B, 0xCE, 0x93, 0xDC, 0xA4, 0x94, 0x2E, 0x17, 0xBE, 0x47, 0xB7, 0x94,
+    0x4F, 0x24, 0x02, 0x9C, 0x8C, 0xE4, 0x4D, 0xA6, 0x3A, 0x04, 0x1A, 0x69, 0xE5, 0x3C, 0x8A, 0x35,
+    0x8D, 0xAA, 0x0C, 0xCD, 0x60, 0x66, 0x95, 0x2A, 0x2E, 0xCA, 0x90, 0x1F, 0xAB, 0xA2, 0xCF, 0x45,
+    0xAC, 0xF0, 0x40, 0x84, 0x75, 0x95, 0x8C, 0x75, 0x35, 0xD8, 0x93, 0x69, 0x42, 0x11, 0xB6, 0x33,
+    0x92, 0xDA, 0x15, 0x59, 0x68, 0x43, 0x05, 0xF1, 0x93, 0x9D, 0x56, 0xDA, 0xC5, 0x03, 0xE2, 0xD1,
+    0xA4, 0x28, 0x29, 0xA8, 0x40, 0x83, 0x44, 0xDB, 0x9E, 0x44, 0xF4, 0x24, 0x95, 0x9A, 0x51, 0x0D,
+    0x56, 0xE4, 0x7A, 0xCB, 0x2D, 0xAD, 0xF3, 0x57, 0x0C, 0x8F, 0x78, 0x06, 0x85, 0x9E, 0xD0, 0x03,
+    0xA8, 0x0A, 0x0A, 0xD9, 0x71, 0x8D, 0x36, 0xA2, 0xFD, 0xC1, 0xC9, 0xBF, 0x50, 0xF0, 0x7A, 0xEA,
+    0x61, 0x75, 0x03, 0x3B, 0x45, 0xE2, 0xF4, 0x37, 0xB5, 0x33, 0x63, 0xBC, 0x53, 0x40, 0x33, 0xA4,
+    0xFB, 0x57, 0xAE, 0x4B, 0x09, 0x5D, 0x84, 0xE5, 0x53, 0xE1, 0x9B, 0xCF, 0xAB, 0x46, 0x02, 0x03,
+    0xFB, 0x9A, 0x6C, 0xB7, 0xEC, 0xC5, 0x1B, 0x41, 0x26, 0x58, 0x3D, 0x92, 0x46, 0x1C, 0xE3, 0xA4,
+    0x5F, 0x26, 0xBD, 0xD0, 0xB1, 0x11, 0x7F, 0x26, 0x2B, 0x32, 0xC4, 0xA7, 0x2F, 0x01, 0x2B, 0xA7,
+    0x6D, 0x03, 0x9F, 0x6E, 0xC1, 0x47, 0xB4, 0x25, 0xDA, 0xBD, 0x56, 0x5B, 0x7A, 0xA9, 0x94, 0xC8,
+    0x4C, 0xF5, 0x6A, 0x76, 0x16, 0x8A, 0xB3, 0xB0, 0xCC, 0x25, 0x3A, 0x18, 0x90, 0xEA, 0xB8, 0xC3,
+    0x8E, 0x09, 0x79, 0xC2, 0x39, 0x4A, 0x4C, 0xA5, 0x98, 0x00, 0x7D, 0xA1, 0x85, 0x2B, 0xB1, 0xB6,
+    0xCE, 0x10, 0xCD, 0xB1, 0xB6, 0xC5, 0x57, 0x74, 0x69, 0x3B, 0xC1, 0xCD, 0xA0, 0x35, 0x8C, 0xF2,
+    0xA8, 0x5C, 0x41, 0xFF, 0x54, 0x69, 0x3F, 0xDB, 0x0D, 0xD0, 0x89, 0xE2, 0x5C, 0x25, 0x16, 0xD6,
+    0x61, 0x43, 0xF7, 0xE3, 0x32, 0x28, 0x93, 0xC3, 0x29, 0x2C, 0x5E, 0x52, 0x01, 0x02, 0xB7, 0x97,
+    0x2B, 0x29, 0x76, 0xA9, 0xEE, 0x7E, 0x4A, 0x99, 0x0F, 0xBD, 0xA4, 0xB6, 0x45, 0xA4, 0x87, 0xD7,
+    0x41, 0x8D, 0x1B, 0xE8, 0x0B, 0x32, 0x11, 0x60, 0x0D, 0xAD, 0xEE, 0xE3, 0xBD, 0xA0, 0x0C, 0x60,
+    0xB6, 0xD5, 0x73, 0x24, 0xAE, 0x44, 0x8D, 0xBB, 0x0A, 0x31, 0x5D, 0x78, 0x49, 0xC3, 0xAB, 0xDF,
+    0x8F, 0xC2, 0xFF, 0x25, 0xC4, 0x23, 0x39, 0xB5, 0xE5, 0xC2, 0x90, 0x4A, 0x6B, 0xE7, 0x00, 0xE1,
+    0xA4, 0x04, 0xF9, 0xE8, 0xB0, 0x03, 0x77, 0xEC, 0x1B, 0x50, 0xB7, 0x6A, 0x55, 0x78, 0x46, 0x88,
+    0x03, 0x93, 0xF0, 0x2E, 0xC8, 0x82, 0xF6, 0xC1, 0x30, 0xAA, 0xC0, 0x3A, 0xC4, 0xE1, 0xAA, 0xA4,
+    0xEF, 0xD0, 0xCD, 0xF9, 0x6D, 0xE2, 0x5A, 0xB9, 0x52, 0x32, 0xC1, 0x1D, 0xB2, 0xE0, 0xD1, 0x10,
+    0xE5, 0x17, 0xB8, 0xAF, 0x33, 0x7C, 0xE2, 0xE5, 0x8E, 0xC9, 0xBE, 0x8C, 0x3A, 0x25, 0x4F, 0x59,
+    0x8A, 0x4B, 0x09, 0x4C, 0x83, 0x12, 0x73, 0x4D, 0xA5, 0xEC, 0xF5, 0x68, 0x71, 0xED, 0xD9, 0xE9,
+    0xA4, 0x2C, 0x63, 0x7D, 0x23, 0x0E, 0xB5, 0x97, 0x92, 0x4E, 0xBD, 0x09, 0x4C, 0x2E, 0x57, 0x01,
+    0x2C, 0x1F, 0x15, 0xB5, 0xD4, 0xA9, 0x08, 0x77, 0x54, 0xBA, 0x50, 0x60, 0x05, 0x70, 0x1F, 0xA3,
+    0xBB, 0x31, 0x0E, 0xA1, 0xE8, 0x6D, 0x45, 0xE1, 0x31, 0x66, 0xE0, 0x94, 0x32, 0xDD, 0xC5, 0x0E,
+    0xC9, 0xD5, 0x91, 0xA0, 0xB5, 0xD8, 0x0E, 0xAE, 0x31, 0xEA, 0x25, 0xE1, 0xE1, 0xE7, 0xCD, 0x18,
+    0xCF, 0x3F, 0xFB, 0xF3, 0x0F, 0x94, 0x01, 0x16, 0x70, 0xC0, 0x8E, 0xF0, 0x7A, 0x05, 0xA6, 0x0B,
+    0x27, 0xFE, 0xCD, 0xF3, 0x0B, 0xC5, 0x95, 0xBF, 0x8E, 0xDC, 0x54, 0x14, 0xC6, 0x3F, 0xDB, 0x99,
+    0x58, 0x5A, 0x23, 0x9C, 0x06, 0x09, 0x29, 0x42, 0xA6, 0xA5, 0x00, 0xBF, 0xC0, 0x26, 0xB6, 0xC4,
+    0x0B, 0xA4, 0x81, 0x22, 0x14, 0xE9, 0x69, 0xF6, 0x01, 0x92, 0xAC, 0xDD, 0xD3, 0xD0, 0xD3, 0xA4,
+    0x42, 0x68, 0xB6, 0xD8, 0x96, 0x62, 0x37, 0x36, 0xF0, 0x02, 0x16, 0x52, 0xA8, 0xDD, 0x10, 0x89,
+    0x4D, 0x31, 0x96, 0x30, 0x92, 0xB5, 0xF1, 0xF8, 0xF2, 0x7D, 0xE7, 0x4E, 0xD8, 0xD9, 0x45, 0x42,
+    0x42, 0x80, 0xB0, 0x34, 0x47, 0xA3, 0xB9, 0x73, 0xCF, 0xF9, 0xCE, 0xEF, 0xFC, 0x31, 0x10, 0x96,
+    0x41, 0x0D, 0x24, 0x6D, 0xDA, 0x01, 0x71, 0x5F, 0x94, 0x40, 0x34, 0xCD, 0xE0, 0xE3, 0x06, 0xD9,
+    0xAA, 0x95, 0xCD, 0x70, 0xFD, 0xB9, 0xEB, 0x5C, 0x0F, 0x34, 0xCE, 0x2D, 0xC0, 0xD7, 0xD3, 0x6D,
+    0xD7, 0x22, 0x1C, 0x91, 0x0F, 0x88, 0x06, 0xC4, 0x93, 0x6C, 0x38, 0x23, 0x1E, 0x10, 0x6C, 0x91,
+    0xF0, 0x7F, 0x0B, 0xE4, 0x9C, 0xB6, 0xBD, 0xB2, 0x19, 0x83, 0x6E, 0x91, 0x9B, 0x65, 0xD0, 0x60,
+    0x46, 0xA1, 0xC8, 0xA8, 0xA0, 0xEB, 0xC7, 0x40, 0xDA, 0xE3, 0x1C, 0xC8, 0x5B, 0x9E, 0xA3, 0x01,
+    0x66, 0x44, 0x5B, 0xFA, 0x0B, 0xAA, 0x01, 0xB9, 0x73, 0xAE, 0x54, 0xF0, 0x2F, 0xAF, 0x69, 0xBA,
+    0x63, 0xF6, 0x9E, 0xD9, 0xA7, 0xFC, 0xAC, 0xCA, 0x33, 0x20, 0x70, 0xFD, 0x44, 0x8F, 0xAE, 0x1F,
+    0xF9, 0x4B, 0xD2, 0x29, 0xA5, 0xF4, 0xBB, 0x4E, 0xB6, 0x2D, 0x65, 0x6B, 0xCB, 0xCE, 0x6C, 0xCE,
+    0x1F, 0xE2, 0xA5, 0xD0, 0x37, 0xE7, 0x68, 0x9B, 0xCF, 0x98, 0x5C, 0x30, 0x29, 0x3E, 0x15, 0x9D,
+    0xE9, 0x0A, 0x55, 0xE8, 0x0A, 0x3D, 0xE6, 0x08, 0xE8, 0xB1, 0xD0, 0x09, 0xEE, 0x2B, 0x55, 0x4A,
+    0xA6, 0x62, 0x4A, 0xCE, 0x69, 0x9F, 0xE3, 0x71, 0x57, 0xA3, 0x09, 0x7F, 0xFD, 0xB1, 0x43, 0xB5,
+    0xF9, 0x61, 0xD3, 0xA2, 0x70, 0x11, 0x7D, 0x66, 0x13, 0x33, 0x44, 0x50, 0xA2, 0xFC, 0x37, 0x48,
+    0xAE, 0x8E, 0x5E, 0x3C, 0xC0, 0x92, 0x3A, 0x16, 0x6A, 0x7B, 0xD0, 0x5C, 0x3C, 0xFB, 0x0B, 0x92,
+    0xCF, 0xFF, 0x06, 0xC9, 0x55, 0x69, 0xD8, 0x8C, 0x9A, 0x41, 0x33, 0x5A, 0xC0, 0xC1, 0xE9, 0x2F,
+    0x42, 0x33, 0xBF, 0x01, 0x46, 0x5E, 0xC1, 0xB7, 0x0C, 0x95, 0x39, 0x3A, 0xAD, 0x36, 0x0B, 0x23,
+    0x87, 0x5B, 0x85, 0x9C, 0x75, 0x67, 0xF6, 0xA0, 0x8C, 0x93, 0x61, 0x32, 0x4A, 0xC7, 0xBE, 0xAC,
+    0x79, 0xEF, 0x11, 0x19, 0x21, 0x03, 0x64, 0x7C, 0x0C, 0xCF, 0x3E, 0x9D, 0xC8, 0x91, 0x07, 0x8C,
+    0xD0, 0x3B, 0x9F, 0x3C, 0xC0, 0xCD, 0xC7, 0x89, 0x5A, 0x41, 0x5B, 0x07, 0xCD, 0xFA, 0xB4, 0x93,
+    0xA2, 0x51, 0x52, 0x0F, 0x15, 0xEF, 0x6D, 0x91, 0x80, 0x6A, 0xC1, 0xA7, 0x28, 0x77, 0x49, 0x20,
+    0xBA, 0x3C, 0xED, 0x99, 0x9E, 0x63, 0xF5, 0x9A, 0xF5, 0x37, 0xFB, 0x27, 0x2A, 0xA2, 0xEA, 0xCD,
+    0xF0, 0xBC, 0x33, 0xE8, 0xE4, 0x89, 0x4E, 0x28, 0xFC, 0xB7, 0xCF, 0x9B, 0x52, 0xAC, 0x5A, 0x19,
+    0x8A, 0x59, 0x51, 0x0C, 0xB1, 0x53, 0x5E, 0x7D, 0x43, 0x52, 0xE0, 0x3A, 0x2A, 0x6A, 0xA3, 0x21,
+    0x2F, 0xEF, 0xE3, 0x69, 0x38, 0x84, 0x63, 0x5A, 0x67, 0xED, 0x59, 0x38, 0x47, 0x43, 0xD5, 0x66,
+    0x1B, 0x56, 0x65, 0x0B, 0x52, 0x32, 0xAA, 0x94, 0x5B, 0x57, 0xC8, 0x4A, 0xF7, 0xD5, 0x14, 0xD2,
+    0x53, 0x28, 0xCF, 0x57, 0x49, 0x06, 0x1D, 0x6A, 0x15, 0x8B, 0xAA, 0x8A, 0x9F, 0xA8, 0x36, 0x76,
+    0x93, 0xC6, 0x51, 0x7D, 0xBC, 0xD7, 0x3E, 0x12, 0x2F, 0x4D, 0x94, 0xC2, 0xF3, 0xBB, 0x97, 0xEB,
+    0xAD, 0xFA, 0x27, 0x2D, 0x55, 0xE5, 0x56, 0x8D, 0xD0, 0x23, 0x53, 0x72, 0x6A, 0x1E, 0x44, 0x76,
+    0xD9, 0xA8, 0x14, 0xEB, 0x45, 0x95, 0x63, 0xF5, 0x93, 0xCB, 0x75, 0xBD, 0x7F, 0x52, 0xED, 0x26,
+    0xE2, 0x96, 0xEE, 0xA4, 0x3A, 0x89, 0xD5, 0xF7, 0x51, 0x8F, 0xEA, 0xD3, 0x93, 0x91, 0x42, 0xDD,
+    0x1C, 0x1A, 0x78, 0x7B, 0xDE, 0xC3, 0x5B, 0x8C, 0xF2, 0x04, 0xF9, 0x2B, 0x46, 0x65, 0xEE, 0xE1,
+    0x72, 0x9D, 0x47, 0xCC, 0x08, 0xE4, 0x81, 0x39, 0xE9, 0xA2, 0x3E, 0xEE, 0x92, 0x36, 0xE9, 0x04,
+    0x24, 0x67, 0x23, 0x16, 0xF1, 0x8C, 0xAA, 0xE9, 0x45, 0x04, 0x4D, 0xA9, 0xD1, 0xD1, 0x27, 0x84,
+    0x90, 0x14, 0x2F, 0x17, 0xB6, 0xDA, 0x84, 0x44, 0x80, 0x3D, 0x93, 0x03, 0x2B, 0x94, 0x6A, 0x14,
+    0x4B, 0x67, 0x60, 0x81, 0x3E, 0xF8, 0x53, 0x4F, 0xF8, 0x7E, 0x30, 0x26, 0x38, 0xBA, 0x38, 0x19,
+    0x45, 0xFA, 0x9E, 0xFA, 0x21, 0xB5, 0xCE, 0xAF, 0x7D, 0x7E, 0xDA, 0x3B, 0x36, 0x4A, 0x36, 0xC0,
+    0x9C, 0xA5, 0x13, 0xC2, 0xAD, 0x1C, 0x95, 0xE4, 0x17, 0xEB, 0xFD, 0x13, 0xDF, 0x43, 0xC7, 0xDA,
+    0x2E, 0xBC, 0x73, 0xA8, 0x93, 0xCC, 0xBC, 0xD5, 0xC1, 0xF6, 0xE1, 0x69, 0x97, 0x30, 0xCE, 0x90,
+    0x18, 0x7B, 0xE0, 0x43, 0xAF, 0xCF, 0xF9, 0xFB, 0x77, 0x6E, 0x60, 0x88, 0x38, 0x39, 0xA4, 0xC0,
+    0xAE, 0x10, 0x84, 0x29, 0x98, 0xC9, 0x40, 0x4D, 0x41, 0x04, 0x31, 0xC1, 0x91, 0x80, 0x7A, 0x82,
+    0x00, 0xE2, 0x21, 0x18, 0x99, 0xBF, 0x5A, 0x42, 0xE9, 0xAF, 0xFE, 0xD7, 0x9C, 0x60, 0x8D, 0x61,
+    0xFE, 0xA6, 0x3F, 0xD6, 0x6B, 0xFA, 0xB3, 0xCD, 0x66, 0xFB, 0x26, 0xA8, 0xEF, 0x4B, 0x96, 0x39,
+    0x6D, 0xCF, 0x55, 0xE5, 0x33, 0x9C, 0xB3, 0xC8, 0xDF, 0x0F, 0xC9, 0xC0, 0x1A, 0xC7, 0xAF, 0x17,
+    0x95, 0x38, 0x19, 0xAD, 0xC2, 0x54, 0xFE, 0x3E, 0x0B, 0xFC, 0xF1, 0x72, 0xD4, 0xAB, 0xBE, 0x0D,
+    0xD5, 0x3D, 0x2A, 0x11, 0xB2, 0x3B, 0x0F, 0xF5, 0x12, 0xB2, 0xFF, 0xA8, 0x67, 0x32, 0xA9, 0x3D,
+    0xC0, 0x6D, 0xEE, 0x98, 0x31, 0x9C, 0x34, 0xA1, 0x9A, 0xE3, 0x46, 0x3B, 0x3A, 0x72, 0xB6, 0x91,
+    0xC6, 0xAB, 0x6D, 0xBF, 0xB7, 0x2E, 0xE8, 0xD3, 0x60, 0x79, 0x4E, 0x7E, 0x14, 0x0A, 0x25, 0x60,
+    0x1B, 0xC1, 0x83, 0xB2, 0x59, 0xD0, 0x32, 0xDC, 0x0D, 0xBE, 0x27, 0x65, 0xC3, 0x10, 0x2E, 0xEB,
+    0x67, 0xBB, 0x9D, 0xE0, 0x21, 0xDA, 0x85, 0x98, 0x1B, 0x03, 0x7E, 0x29, 0x18, 0x2B, 0x3F, 0x0E,
+    0xD9, 0x0B, 0x0E, 0x9B, 0x6D, 0x85, 0x1D, 0xAC, 0x5B, 0x78, 0x17, 0x1F, 0xF1, 0x45, 0x91, 0x29,
+    0xEC, 0x17, 0x1D, 0x92, 0x4D, 0x89, 0xC8, 0xBF, 0x43, 0xFE, 0xA3, 0x99, 0xF8, 0xE7, 0xCF, 0xEF,
+    0xCD, 0x54, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0xDB, 0x11, 0x46, 0x72, 0xE1, 0x0A, 0x09, 0x29,
+    0x85, 0x7F, 0xC2, 0x36, 0xB4, 0x9C, 0xF7, 0x27, 0x50, 0x10, 0x1A, 0x0A, 0x28, 0x11, 0xCD, 0xB5,
+    0x14, 0x24, 0xB6, 0xC4, 0x1F, 0x48, 0x03, 0x35, 0x4D, 0x1A, 0x9A, 0xB4, 0x14, 0xDC, 0xD9, 0x12,
+    0x3F, 0x00, 0x2B, 0x0D, 0x42, 0x34, 0x2E, 0x88, 0x10, 0x34, 0xB1, 0x14, 0x4B, 0x18, 0xC9, 0x77,
+    0xC3, 0x7B, 0xEB, 0xCD, 0x1D, 0x1F, 0x29, 0x28, 0x6F, 0x23, 0x8D, 0xED, 0xDC, 0xDB, 0x99, 0x37,
+    0x6F, 0xDE, 0xAE, 0xC8, 0xB4, 0xB2, 0x92, 0x61, 0x60, 0x50, 0xBC, 0x9A, 0x17, 0x1D, 0x42, 0x39,
+    0x13, 0x49, 0x6D, 0x24, 0xBF, 0xAF, 0x7D, 0xFD, 0x29, 0x52, 0xA8, 0x76, 0x52, 0x7D, 0x9B, 0x8F,
+    0x52, 0x59, 0xC9, 0xA5, 0x02, 0xAC, 0x2C, 0x44, 0xA2, 0x26, 0xB7, 0x22, 0x6D, 0x56, 0x03, 0x97,
+    0x36, 0x08, 0x11, 0xB2, 0x48, 0x30, 0x72, 0xDF, 0x92, 0xC1, 0x94, 0x62, 0xF4, 0x73, 0x2B, 0xA9,
+    0x5E, 0xA2, 0xD4, 0xC3, 0x1E, 0x1B, 0x65, 0x34, 0x80, 0x1F, 0xC5, 0xF8, 0x36, 0x56, 0xB1, 0xAF,
+    0xCE, 0x7A, 0xEC, 0x0B, 0xF5, 0xFC, 0x74, 0x04, 0x58, 0x57, 0x22, 0x95, 0x7E, 0x01, 0xEE, 0xFE,
+    0x54, 0x3F, 0xB0, 0x8C, 0x6B, 0x86, 0x9C, 0xD9, 0x93, 0x0B, 0xD0, 0x0D, 0x7B, 0xD6, 0x38, 0x8C,
+    0x51, 0x33, 0xB3, 0x77, 0xF1, 0x7A, 0x2C, 0xF6, 0x0F, 0xD6, 0x99, 0x6A, 0x8D, 0xAA, 0x3A, 0x48,
+    0xD4, 0xA7, 0x9F, 0x44, 0x16, 0xF2, 0x8E, 0x9C, 0xE3, 0x5A, 0x82, 0x9E, 0xAF, 0x06, 0x75, 0x91,
+    0x25, 0xEC, 0x01, 0xAD, 0x17, 0xD8, 0xA0, 0x8A, 0x04, 0xA1, 0x3A, 0x55, 0x98, 0x2A, 0x61, 0x4F,
+    0xB2, 0x62, 0x48, 0x19, 0x6F, 0x90, 0x58, 0xBC, 0x2E, 0x46, 0x09, 0x57, 0x62, 0x3A, 0x41, 0xF7,
+    0x45, 0x99, 0x34, 0x12, 0x0C, 0xEC, 0xD4, 0xD8, 0xB8, 0x97, 0xA4, 0x93, 0x7C, 0x8D, 0x26, 0xC0,
+    0x9F, 0x74, 0x9F, 0x9E, 0x6C, 0xE9, 0x24, 0x12, 0x62, 0x77, 0x13, 0x97, 0x12, 0xAC, 0x1F, 0x21,
+    0x73, 0x0E, 0x76, 0xBE, 0xDA, 0x9E, 0xEC, 0x94, 0xDC, 0x6E, 0x3D, 0x93, 0x3B, 0x54, 0x20, 0xC3,
+    0x6B, 0x75, 0x8A, 0x42, 0x91, 0xF6, 0x6C, 0x62, 0x90, 0x7F, 0x57, 0xA0, 0x3A, 0x52, 0x3D, 0xF4,
+    0x92, 0xDB, 0xD5, 0xB1, 0x24, 0x0D, 0x95, 0x1B, 0xE4, 0x39, 0x75, 0xC4, 0x6B, 0xD8, 0xC9, 0xC8,
+    0xD2, 0xC6, 0x82, 0x28, 0xF4, 0x02, 0x37, 0xE6, 0x32, 0xCC, 0x15, 0xF0, 0x8D, 0xD3, 0xF0, 0xED,
+    0x88, 0x32, 0xCE, 0x19, 0x8B, 0xAF, 0x50, 0xC8, 0x34, 0xA1, 0x4A, 0xDC, 0x09, 0xC8, 0x2F, 0xE8,
+    0xD8, 0xA4, 0xC5, 0xC8, 0xA4, 0xB0, 0x10, 0x24, 0xD2, 0xEF, 0x00, 0x24, 0xAA, 0x2D, 0x46, 0xF3,
+    0xE6, 0x9E, 0xA3, 0xF2, 0x84, 0xA1, 0xA0, 0xA6, 0xA6, 0x65, 0x4A, 0x8A, 0x23, 0xAF, 0xAF, 0xE1,
+    0x3C, 0x47, 0xC3, 0xE0, 0xAD, 0x75, 0xA8, 0x27, 0x55, 0x87, 0x79, 0xCA, 0x18, 0x82, 0xE4, 0x8C,
+    0x4A, 0xA6, 0x16, 0x9F, 0x11, 0xD5, 0xC6, 0x94, 0x68, 0x84, 0x94, 0x6A, 0xC7, 0xCC, 0x15, 0x0E,
+    0x5E, 0xE8, 0x4A, 0xE7, 0xE8, 0x56, 0x3F, 0xB4, 0x12, 0xCC, 0xCF, 0x46, 0x8E, 0x01, 0x42, 0x07,
+    0x43, 0x86, 0xAA, 0x8B, 0x08, 0xDF, 0xB9, 0x14, 0x0D, 0xF6, 0x25, 0xFA, 0xAA, 0xC2, 0x18, 0x15,
+    0x0D, 0x87, 0xAA, 0xC7, 0x80, 0x4C, 0x3C, 0x13, 0x52, 0x0C, 0xDD, 0xD4, 0x72, 0x26, 0x8F, 0x9C,
+    0x0C, 0x7B, 0xD7, 0x10, 0xDD, 0x35, 0x1B, 0xEF, 0x80, 0x39, 0xDD, 0x4C, 0x92, 0xED, 0x38, 0x9C,
+    0x7B, 0x8E, 0x18, 0x78, 0x0D, 0xC8, 0xED, 0x2B, 0x9C, 0x9B, 0xFB, 0xA1, 0xEB, 0xDB, 0xC9, 0xED,
+    0xCC, 0x30, 0x73, 0xF2, 0x37, 0x9B, 0x0B, 0x25, 0xD9, 0xFE, 0x77, 0x27, 0x1D, 0xBD, 0xB1, 0x41,
+    0x3D, 0x3D, 0x46, 0x6F, 0x8A, 0xD2, 0x3D, 0xDE, 0xF7, 0xD3, 0x6F, 0xF9, 0x64, 0xAA, 0xC8, 0xFE,
+    0xED, 0x9E, 0x14, 0xBE, 0xA9, 0xB4, 0x8E, 0xA0, 0x63, 0x8E, 0xB4, 0xFB, 0xC0, 0x63, 0x64, 0x34,
+    0x0B, 0x66, 0x41, 0x53, 0x90, 0x63, 0x3E, 0x4D, 0x8A, 0x25, 0x90, 0x1E, 0x84, 0xA8, 0x66, 0xE4,
+    0x31, 0xA3, 0xC7, 0x28, 0x67, 0x4E, 0x37, 0x52, 0x9A, 0xE4, 0xFC, 0xE0, 0x60, 0xE9, 0x31, 0x76,
+    0x83, 0x29, 0x7C, 0x9E, 0xD2, 0xCD, 0x9C, 0x79, 0x3C, 0x26, 0xF7, 0x98, 0xDA, 0x61, 0x62, 0x1E,
+    0x06, 0x58, 0x4F, 0x5B, 0x9C, 0x09, 0x64, 0x04, 0x20, 0x78, 0xEC, 0xCF, 0x6D, 0x86, 0xA1, 0xC4,
+    0x3F, 0x3A, 0x9C, 0x0D, 0x64, 0x59, 0x42, 0xF0, 0x00, 0x7F, 0xD3, 0xBA, 0xC5, 0xAB, 0xA8, 0x67,
+    0x4B, 0xD6, 0x3B, 0x8B, 0x5D, 0xC7, 0x3C, 0xE7, 0x8B, 0xAB, 0x43, 0x3A, 0xBA, 0x61, 0x17, 0x75,
+    0xD0, 0xE7, 0x6B, 0x31, 0xE9, 0x45, 0x17, 0x5D, 0xB6, 0xB9, 0xCC, 0xDE, 0x46, 0x6D, 0x7C, 0x01,
+    0x2B, 0x54, 0x75, 0x52, 0xA7, 0x3D, 0x50, 0x0A, 0x54, 0x0A, 0x14, 0x78, 0x1A, 0x74, 0x10, 0x75,
+    0xC8, 0x37, 0xBB, 0x99, 0x4B, 0x7C, 0xF6, 0xB1, 0x95, 0x6A, 0x5C, 0x60, 0x08, 0xC8, 0xE7, 0x2E,
+    0x12, 0xCB, 0xDE, 0x1D, 0x53, 0x0E, 0x99, 0x96, 0x98, 0x37, 0x3C, 0x39, 0xCE, 0x44, 0xCB, 0x89,
+    0x09, 0xFA, 0xC3, 0x91, 0xC0, 0xB2, 0xC6, 0x3D, 0x1A, 0x2A, 0x87, 0xF3, 0xE4, 0x54, 0xD9, 0x62,
+    0xE8, 0x28, 0xDE, 0xFA, 0xC5, 0xA4, 0xA5, 0x79, 0x79, 0xF0, 0xC0, 0x63, 0x16, 0x1B, 0x4C, 0xE0,
+    0x75, 0x3A, 0x9A, 0x6E, 0x1C, 0xE4, 0x09, 0x3D, 0x66, 0xE5, 0x31, 0xD3, 0x89, 0xCA, 0x1A, 0x70,
+    0xEC, 0x31, 0xDB, 0x32, 0xC1, 0x40, 0x0A, 0x67, 0xB2, 0xFF, 0x5C, 0xBF, 0x00, 0xD5, 0x55, 0x3D,
+    0x6E, 0xD4, 0x40, 0x14, 0x7E, 0xB6, 0x93, 0x38, 0x30, 0x80, 0x69, 0x52, 0x21, 0xC5, 0x14, 0x14,
+    0x90, 0xC6, 0x17, 0x40, 0x19, 0xDF, 0x20, 0x0D, 0x51, 0x0A, 0x0A, 0x8E, 0x90, 0x13, 0x64, 0x6D,
+    0xE0, 0x02, 0x39, 0x04, 0x3D, 0x0D, 0x45, 0x8A, 0x64, 0xED, 0x23, 0x58, 0x50, 0xD0, 0xBA, 0x80,
+    0x1A, 0x2B, 0x72, 0x61, 0x11, 0x7B, 0x87, 0xEF, 0x7B, 0x93, 0x25, 0x59, 0x02, 0x5D, 0x14, 0x89,
+    0x91, 0xC6, 0xDA, 0xB1, 0xDF, 0xCF, 0xF7, 0xBE, 0x6F, 0xDE, 0x5B, 0xD9, 0x12, 0x91, 0xAA, 0x17,
+    0x49, 0x5C, 0x2E, 0x12, 0x75, 0x38, 0x59, 0x91, 0xF0, 0xE3, 0xCF, 0x63, 0xB1, 0x6E, 0xC2, 0xEB,
+    0x1A, 0x6F, 0x46, 0xEC, 0xA4, 0xDC, 0xC9, 0x83, 0x3E, 0x9D, 0x24, 0x33, 0xAE, 0x8B, 0xCE, 0xFB,
+    0x42, 0x76, 0x4F, 0xE3, 0x36, 0xFE, 0x21, 0x47, 0x52, 0xD5, 0xA6, 0x49, 0x06, 0x58, 0x39, 0x58,
+    0x25, 0x4D, 0xD0, 0x07, 0xA3, 0x64, 0x92, 0xE5, 0x51, 0x87, 0x78, 0xBB, 0x9B, 0x56, 0xE2, 0xCF,
+    0x5F, 0x5B, 0xA9, 0xC6, 0x33, 0x31, 0x0E, 0xF1, 0x8A, 0x12, 0xE1, 0x90, 0x2C, 0xEC, 0x1F, 0x8A,
+    0x99, 0xB6, 0x25, 0x75, 0x0B, 0xD9, 0x4E, 0x46, 0x79, 0x10, 0xB7, 0x72, 0x7D, 0x59, 0xD7, 0x61,
+    0x37, 0xB2, 0x31, 0xD1, 0x16, 0xE0, 0x7A, 0x0F, 0x30, 0xC6, 0x36, 0x30, 0x4D, 0x1A, 0x0F, 0x8F,
+    0x3B, 0xC5, 0xCE, 0x10, 0xD7, 0xE6, 0x8A, 0x5F, 0x0A, 0xEC, 0x19, 0xF6, 0x1C, 0x7B, 0xF2, 0x15,
+    0x00, 0x94, 0x64, 0x08, 0x57, 0x61, 0xCB, 0x63, 0x98, 0xBC, 0xAD, 0x8B, 0xBE, 0xB7, 0x76, 0x4C,
+    0xA2, 0x51, 0xF2, 0x67, 0x57, 0x79, 0x37, 0x9C, 0x44, 0xB0, 0x39, 0xE8, 0xD4, 0x0D, 0x51, 0xB2,
+    0x9C, 0x39, 0x90, 0x3A, 0x18, 0x44, 0xCE, 0x34, 0x01, 0xF2, 0x99, 0xB6, 0x8C, 0xFA, 0x4E, 0xDC,
+    0x20, 0x76, 0x90, 0xA4, 0xD7, 0x92, 0x74, 0x25, 0xA8, 0x27, 0x05, 0x77, 0xEB, 0xFB, 0xAF, 0xEE,
+    0xAA, 0x9E, 0x60, 0x7F, 0x3F, 0x74, 0xAE, 0xAE, 0x5C, 0xB7, 0x92, 0xF1, 0x10, 0x09, 0x81, 0xA3,
+    0xD0, 0x98, 0x60, 0x97, 0x59, 0x47, 0x8F, 0xBF, 0x14, 0xD3, 0x68, 0x49, 0x38, 0xCF, 0x37, 0xC5,
+    0xEE, 0x01, 0x76, 0x19, 0xB9, 0x52, 0x70, 0x0D, 0xD6, 0x96, 0xFE, 0x46, 0x22, 0x28, 0xFA, 0x48,
+    0x92, 0xEF, 0x94, 0xAE, 0x97, 0xD0, 0xD5, 0x4A, 0xDD, 0x5D, 0x28, 0x84, 0xD5, 0xC9, 0xF1, 0x91,
+    0x7C, 0x4A, 0x2F, 0x86, 0x10, 0x24, 0xA7, 0xDF, 0x6E, 0x47, 0x21, 0x62, 0x76, 0x28, 0xF2, 0xB0,
+    0x51, 0x4B, 0x42, 0x26, 0x3C, 0xC0, 0x09, 0x07, 0x8F, 0xD8, 0x7A, 0x34, 0x2C, 0x82, 0x80, 0x27,
+    0x5F, 0x13, 0xF1, 0xCF, 0x56, 0x8C, 0x08, 0xB7, 0x72, 0xB9, 0x61, 0x9B, 0xC4, 0x30, 0x3C, 0x81,
+    0x21, 0x8B, 0x64, 0x43, 0x41, 0x79, 0xD7, 0x4A, 0xB0, 0xC0, 0xEF, 0x80, 0xD1, 0xB2, 0x06, 0x97,
+    0x2C, 0xCB, 0x7F, 0x57, 0x10, 0x54, 0xB5, 0x9D, 0x82, 0x37, 0x35, 0x3E, 0xA5, 0x25, 0xA8, 0xB3,
+    0xCC, 0x31, 0xA3, 0x26, 0x78, 0x51, 0x87, 0xC3, 0x53, 0xBB, 0x17, 0xB9, 0xD6, 0x0E, 0xD1, 0x42,
+    0x4C, 0x19, 0xB4, 0xF2, 0x52, 0xE2, 0x1A, 0xDF, 0x23, 0x97, 0xA7, 0xE4, 0xE6, 0x3E, 0xB6, 0x03,
+    0xC7, 0x24, 0x0C, 0xE7, 0x17, 0x37, 0xEE, 0xD9, 0xED, 0x57, 0x48, 0xD6, 0x41, 0x3A, 0x38, 0x1F,
+    0x61, 0x95, 0xE5, 0x49, 0x1D, 0x75, 0x60, 0xFB, 0x0C, 0x76, 0x69, 0x6D, 0xDA, 0xF7, 0x7D, 0xE7,
+    0x06, 0x3B, 0x80, 0xE5, 0x5C, 0x11, 0x64, 0xB8, 0x2E, 0x00, 0x81, 0x4B, 0x49, 0x1C, 0x69, 0xBB,
+    0x94, 0x05, 0x68, 0x18, 0x35, 0xA9, 0xF5, 0x82, 0x14, 0x7A, 0x1F, 0x98, 0x71, 0xD4, 0xA4, 0x84,
+    0xE1, 0xB5, 0xE3, 0x8B, 0xB9, 0x42, 0x24, 0x7E, 0xA0, 0x64, 0x09, 0x93, 0x7A, 0x5C, 0xCA, 0x9C,
+    0xFA, 0x10, 0xB3, 0x3F, 0x42, 0xC4, 0x3E, 0x04, 0x3C, 0x98, 0x67, 0xD2, 0x02, 0xE0, 0xC1, 0x1A,
+    0x18, 0x56, 0x14, 0x88, 0x5C, 0x8E, 0xBA, 0xA0, 0xB6, 0x1C, 0x46, 0xC9, 0xC5, 0xE8, 0x89, 0x53,
+    0x83, 0xA2, 0xBF, 0x46, 0x26, 0xD4, 0x5B, 0x63, 0xEE, 0x8A, 0x44, 0x3B, 0xB1, 0x35, 0x34, 0x85,
+    0x8E, 0xA3, 0xFC, 0x65, 0x3D, 0x19, 0xE5, 0xB0, 0x85, 0xAC, 0xAE, 0xDB, 0x1A, 0xE5, 0xA0, 0x85,
+    0x51, 0xDC, 0x00, 0xA9, 0x69, 0x20, 0x30, 0xE9, 0xBA, 0x7C, 0x94, 0xE8, 0xC4, 0x34, 0x87, 0xD4,
+    0x19, 0x03, 0x93, 0x3E, 0x3C, 0xB2, 0x77, 0xA8, 0x04, 0x5D, 0x08, 0x3E, 0x17, 0x70, 0xB4, 0x1C,
+    0xA7, 0x96, 0x8E, 0x6B, 0x1E, 0x69, 0xC4, 0xD9, 0x68, 0x38, 0xB9, 0x48, 0xC4, 0x09, 0xBB, 0x47,
+    0x55, 0x71, 0x04, 0xBB, 0x93, 0x5F, 0x97, 0x5F, 0x67, 0x10, 0x01, 0x46, 0x3A, 0x0E, 0x26, 0x4A,
+    0x5C, 0xC8, 0x29, 0xDC, 0xCB, 0xB0, 0x5C, 0x01, 0x4C, 0x75, 0xD0, 0xF7, 0x03, 0xB1, 0x6B, 0xD1,
+    0x33, 0xED, 0x7A, 0x1D, 0xC3, 0x2A, 0xB9, 0x4E, 0xFF, 0x40, 0x8B, 0x65, 0x14, 0x6D, 0x72, 0xDF,
+    0xC2, 0x1E, 0x95, 0x76, 0xF1, 0x0D, 0x07, 0xCF, 0x8E, 0xB2, 0x4D, 0x5D, 0xFE, 0xE5, 0xE0, 0xAD,
+    0x10, 0xF6, 0xB9, 0xCE, 0x8C, 0x0B, 0x06, 0x28, 0x30, 0x81, 0x30, 0x66, 0x56, 0x60, 0xAE, 0xF3,
+    0xB1, 0x58, 0x16, 0x35, 0x47, 0x44, 0xF3, 0x05, 0x0E, 0x47, 0x31, 0xC4, 0x6E, 0x4C, 0x2E, 0xF7,
+    0xAE, 0x06, 0x96, 0x9F, 0x0D, 0x48, 0x48, 0x4B, 0x8E, 0x07, 0x0F, 0x88, 0x65, 0x05, 0x84, 0x6E,
+    0xEA, 0x25, 0x41, 0x34, 0xD0, 0xFF, 0x1B, 0x6D, 0xCA, 0x71, 0x89, 0x8F, 0x70, 0xF4, 0x82, 0xE8,
+    0x29, 0x59, 0x39, 0xE1, 0x5B, 0x40, 0xCB, 0xED, 0xD7, 0x90, 0x01, 0x33, 0x1E, 0x38, 0x11, 0x20,
+    0xF8, 0x20, 0xFF, 0xF3, 0xFA, 0x05, 0xBD, 0x55, 0x3D, 0x73, 0xDC, 0x36, 0x10, 0x5D, 0x92, 0x96,
+    0x58, 0xB0, 0x80, 0x0A, 0xA9, 0x35, 0x9B, 0x94, 0x99, 0x61, 0x9B, 0x46, 0x06, 0x47, 0x2E, 0xD3,
+    0xA8, 0xCB, 0x4C, 0x7E, 0x42, 0x1A, 0xB7, 0x2E, 0x7C, 0x22, 0x13, 0x17, 0x69, 0xF3, 0x3F, 0x52,
+    0xD8, 0x65, 0x8A, 0x3B, 0x1D, 0x33, 0x2E, 0x52, 0xA4, 0x30, 0x12, 0x17, 0x6E, 0xF1, 0x0F, 0xC2,
+    0xC9, 0x30, 0x33, 0xF4, 0x08, 0x3C, 0xE4, 0xBD, 0xC5, 0x9D, 0x24, 0x3B, 0x4D, 0xEC, 0xC2, 0x9C,
+    0xC3, 0x82, 0x04, 0x16, 0xD8, 0x7D, 0x6F, 0x3F, 0x4E, 0x6C, 0xF4, 0x36, 0x0E, 0x26, 0x4E, 0x75,
+    0x74, 0xF2, 0xC4, 0x49, 0x6C, 0xA5, 0x72, 0xB2, 0x13, 0x29, 0x26, 0x4A, 0x09, 0xB2, 0x40, 0x76,
+    0x19, 0x65, 0xF3, 0x7D, 0x80, 0x34, 0x7F, 0xCE, 0x90, 0xC5, 0xDF, 0x94, 0x12, 0x27, 0xCA, 0x8E,
+    0xBB, 0xD2, 0xBC, 0x18, 0xB8, 0xFD, 0x46, 0xB7, 0xC7, 0xAE, 0x15, 0xC9, 0x42, 0x35, 0xE2, 0xE3,
+    0x4A, 0x22, 0xB7, 0xFB, 0xDA, 0x63, 0xDB, 0xE5, 0xBC, 0x7C, 0x14, 0xEB, 0xB1, 0x2D, 0x45, 0x94,
+    0x2A, 0x06, 0xB1, 0x53, 0x15, 0xA3, 0xE4, 0x54, 0x13, 0x39, 0xC2, 0xC8, 0xF4, 0xAD, 0x18, 0x75,
+    0xD2, 0xDB, 0xC5, 0xB6, 0x94, 0x86, 0x36, 0xA4, 0x52, 0x59, 0xAA, 0xCC, 0x74, 0xFD, 0x0C, 0x9F,
+    0x71, 0xC0, 0x65, 0xBD, 0x48, 0x8D, 0xD1, 0x60, 0xD5, 0x4A, 0x1A, 0x57, 0x18, 0x6B, 0x8E, 0x7A,
+    0x96, 0x79, 0xBB, 0xC8, 0x8D, 0xDF, 0x64, 0xB1, 0x5D, 0xE5, 0x8B, 0xAC, 0x8B, 0x39, 0x9B, 0x8B,
+    0xB1, 0x1C, 0x4B, 0xD7, 0xF5, 0x55, 0x5C, 0xC4, 0x80, 0x05, 0xF3, 0x7A, 0x10, 0xF3, 0xA3, 0x97,
+    0xFA, 0xF1, 0x2C, 0x4D, 0xB6, 0xC3, 0x15, 0x5B, 0x67, 0xA5, 0x89, 0x2B, 0x29, 0xE9, 0xC9, 0xA5,
+    0x3A, 0xD7, 0xD0, 0xCE, 0x90, 0x6C, 0xD5, 0xB0, 0xF5, 0x08, 0x6B, 0x04, 0xFE, 0x93, 0xFA, 0x2A,
+    0xC7, 0x38, 0xF6, 0x5B, 0xEC, 0xBB, 0xF1, 0x1B, 0xDF, 0x85, 0x6C, 0x82, 0x07, 0xCF, 0x56, 0x38,
+    0x74, 0x0E, 0x00, 0x1B, 0x21, 0x6A, 0xC9, 0x60, 0x49, 0xAE, 0x71, 0xC4, 0x36, 0x58, 0x7C, 0xE5,
+    0xA5, 0xF4, 0x8B, 0x5C, 0x4C, 0xF5, 0xE0, 0xD7, 0xC5, 0x6E, 0xB2, 0x62, 0x67, 0xD3, 0x97, 0xBC,
+    0xF1, 0x84, 0xF7, 0x3D, 0xA0, 0x78, 0x89, 0x51, 0xBB, 0x74, 0x5C, 0xB6, 0x60, 0x5E, 0xF7, 0x1F,
+    0xC8, 0xFD, 0x27, 0x82, 0x84, 0x22, 0x82, 0xE2, 0x6C, 0x0B, 0xAF, 0x72, 0x86, 0xC7, 0xB8, 0x3D,
+    0x0F, 0x19, 0xC3, 0x57, 0xF9, 0x03, 0x97, 0xE1, 0xC0, 0x30, 0x71, 0xC8, 0xB5, 0x68, 0xCC, 0xF7,
+    0x0C, 0x77, 0x54, 0xC7, 0xED, 0x1E, 0xEA, 0x55, 0x0F, 0xF5, 0x73, 0xA8, 0xE7, 0x63, 0xF9, 0xCF,
+    0x77, 0x2F, 0x7E, 0x88, 0x31, 0x2E, 0x0D, 0x44, 0x0A, 0xCE, 0x97, 0x02, 0x1E, 0x9B, 0x25, 0x8B,
+    0x53, 0xF1, 0xEE, 0xE0, 0xC4, 0x19, 0xE2, 0xD0, 0x1A, 0xA4, 0x52, 0xA3, 0x86, 0xAD, 0x86, 0x60,
+    0xA3, 0x16, 0x03, 0xAF, 0x85, 0x5B, 0x30, 0xCC, 0x1F, 0x60, 0x3B, 0x46, 0xD3, 0xE8, 0x0F, 0x64,
+    0x22, 0x6E, 0xF6, 0x48, 0xEC, 0x43, 0xE6, 0x54, 0x37, 0x89, 0x1D, 0x14, 0x9F, 0xA5, 0xB1, 0xC8,
+    0xD8, 0x3E, 0x21, 0x98, 0xCD, 0x7F, 0x7C, 0xCD, 0xE7, 0xFB, 0x40, 0x15, 0x5A, 0x39, 0xEE, 0xC3,
+    0xA4, 0xF9, 0x73, 0x07, 0x14, 0xAE, 0x7C, 0x05, 0xF5, 0xDC, 0x43, 0xDD, 0xB4, 0x50, 0x5F, 0x67,
+    0xCB, 0xB7, 0x3F, 0xFB, 0x2D, 0x10, 0x7D, 0x8D, 0x11, 0xF6, 0x18, 0x48, 0x7B, 0x75, 0x7B, 0x48,
+    0xE9, 0xBB, 0xB5, 0x48, 0x63, 0x39, 0x29, 0xCC, 0x2E, 0xF3, 0xE8, 0x08, 0x74, 0x4D, 0x03, 0xD8,
+    0xBB, 0x22, 0x36, 0xCC, 0x96, 0x30, 0x51, 0x48, 0x96, 0xBE, 0x00, 0x65, 0xFD, 0xA1, 0xCA, 0xAF,
+    0xAD, 0x7D, 0x08, 0xCE, 0x4A, 0xF0, 0x34, 0x12, 0xE2, 0x09, 0xBD, 0x87, 0xB7, 0xD8, 0x1D, 0xA9,
+    0x3D, 0xC9, 0xF1, 0xDE, 0x91, 0x53, 0x8A, 0x73, 0x8A, 0x15, 0x79, 0x58, 0x43, 0xF8, 0x59, 0x8E,
+    0x17, 0xA8, 0xE0, 0x22, 0x70, 0x38, 0x65, 0x8E, 0x57, 0xB7, 0x09, 0xB1, 0xC6, 0x57, 0x99, 0x50,
+    0x57, 0x55, 0x28, 0x04, 0xA5, 0x42, 0x03, 0xAF, 0x14, 0x91, 0x35, 0xE5, 0x82, 0x91, 0xFF, 0x85,
+    0x1C, 0x4D, 0x1A, 0x62, 0x25, 0x83, 0xE1, 0x75, 0x64, 0x84, 0x07, 0xDB, 0x54, 0x69, 0x75, 0x7B,
+    0xD4, 0xAE, 0xAB, 0xF8, 0xD8, 0xDB, 0xC5, 0x40, 0xEF, 0x29, 0x30, 0x00, 0x67, 0xA6, 0x69, 0x02,
+    0xA4, 0x7A, 0x2B, 0xC8, 0x2B, 0x7D, 0x2A, 0xBE, 0x90, 0x38, 0x37, 0x3D, 0xFD, 0x26, 0x28, 0x75,
+    0xC5, 0xCA, 0x9D, 0x3E, 0xEA, 0x3C, 0x3C, 0x45, 0xD5, 0x3A, 0xA9, 0x61, 0x1D, 0x91, 0x4E, 0xA9,
+    0xAE, 0xB1, 0x06, 0x46, 0x21, 0xC6, 0x7D, 0x0A, 0x6B, 0xB0, 0x35, 0x84, 0x07, 0x8C, 0xA7, 0xC4,
+    0x88, 0x7A, 0x1D, 0x0A, 0x15, 0x01, 0x18, 0x11, 0x9F, 0x4F, 0xC4, 0x78, 0xA6, 0xE5, 0xC4, 0x38,
+    0xD2, 0x4F, 0x9B, 0x4C, 0x5D, 0x25, 0x37, 0x83, 0x3A, 0x4E, 0xA7, 0x9B, 0xF6, 0xA4, 0x18, 0xCD,
+    0x60, 0x8B, 0x50, 0x78, 0x3B, 0xAC, 0xF2, 0x91, 0x5D, 0xE8, 0xFE, 0x36, 0x8E, 0x5D, 0x32, 0x75,
+    0x09, 0x09, 0xB9, 0x0B, 0xA7, 0x52, 0x71, 0xFE, 0xCF, 0xEC, 0xFD, 0x03, 0x90, 0xED, 0x16, 0x5A,
+    0xC4, 0x5E, 0x61, 0xE9, 0x98, 0x47, 0xD0, 0x94, 0x24, 0x7F, 0xF3, 0x11, 0xD9, 0x9B, 0x5D, 0xA2,
+    0x1C, 0x15, 0x0C, 0xFC, 0x23, 0x90, 0xA0, 0xA7, 0xE0, 0x9E, 0xD1, 0xEF, 0xEC, 0x9D, 0x27, 0x5A,
+    0xF4, 0x5F, 0xF4, 0x92, 0x46, 0xDF, 0xCF, 0xD7, 0x8A, 0x1A, 0xFB, 0x88, 0x1E, 0x09, 0x0F, 0xA7,
+    0xC4, 0x51, 0xC7, 0x16, 0xF9, 0xC9, 0xE6, 0x7D, 0xE8, 0x31, 0x6D, 0x6A, 0xCB, 0xDA, 0x77, 0xA5,
+    0x49, 0xED, 0x37, 0xA6, 0x8E, 0xBC, 0x4B, 0x6B, 0xFE, 0x2E, 0x67, 0xDF, 0x7F, 0x2C, 0x08, 0x61,
+    0xA7, 0x9F, 0x31, 0xCD, 0x52, 0x86, 0x44, 0xD8, 0x2E, 0xD1, 0x1D, 0xB5, 0x81, 0x16, 0xC0, 0x8B,
+    0xA9, 0xFC, 0x6B, 0x60, 0xCA, 0x54, 0xAF, 0x1D, 0xBB, 0xB6, 0xF9, 0x7D, 0x54, 0x92, 0x9F, 0x4F,
+    0x2C, 0xBB, 0xFA, 0x62, 0x46, 0x0C, 0xA5, 0x96, 0xC0, 0x6A, 0x6C, 0xE4, 0x3A, 0x05, 0xCC, 0x12,
+    0xE7, 0x23, 0xB1, 0xCF, 0x3D, 0xB3, 0xAD, 0x7E, 0xE5, 0xD8, 0xF0, 0xCD, 0x5B, 0x8D, 0x4F, 0x79,
+    0xA3, 0x53, 0x41, 0x3F, 0x67, 0xB8, 0xDB, 0x6B, 0x21, 0xB3, 0x39, 0xE1, 0x75, 0x8B, 0xC8, 0x63,
+    0xB2, 0x77, 0x35, 0x2F, 0xF2, 0xC5, 0x7B, 0xB5, 0xCE, 0x1C, 0x64, 0x1E, 0xD0, 0x25, 0xC9, 0xDD,
+    0x07, 0xA8, 0xB2, 0x6D, 0xDF, 0xF8, 0x7A, 0x87, 0x88, 0x9F, 0xCD, 0xDD, 0xB6, 0x2F, 0xDF, 0xBA,
+    0x8D, 0xD4, 0x2B, 0x50, 0x78, 0xED, 0x90, 0x95, 0xFC, 0xEF, 0x30, 0x23, 0x92, 0xA3, 0x6B, 0x2B,
+    0x97, 0x07, 0x7E, 0x39, 0xE1, 0x54, 0x7A, 0x2C, 0x36, 0x17, 0xB8, 0x37, 0x3C, 0x6B, 0xA4, 0xB8,
+    0xF1, 0x41, 0xCC, 0x0E, 0x6D, 0xA2, 0x71, 0xB7, 0x5E, 0x7C, 0x9E, 0xE7, 0x5F, 0xD5, 0x54, 0x3D,
+    0x8F, 0xDD, 0x44, 0x14, 0x3D, 0x63, 0xB3, 0xB1, 0xC4, 0x20, 0x99, 0x02, 0x04, 0xDD, 0x50, 0x23,
+    0xA1, 0xF9, 0x05, 0x89, 0x9D, 0x34, 0xB4, 0x14, 0xAC, 0x52, 0xF2, 0x13, 0x68, 0x28, 0x79, 0x6B,
+    0x87, 0x2D, 0x28, 0x68, 0xE0, 0x1F, 0xE4, 0x47, 0xA4, 0xDC, 0xB7, 0xB6, 0x48, 0xB1, 0x05, 0x05,
+    0x86, 0x26, 0x25, 0x46, 0x82, 0x7A, 0x2D, 0xE4, 0x48, 0x8E, 0xD6, 0xF6, 0x70, 0xCE, 0x38, 0xCB,
+    0xBE, 0x0D, 0x14, 0x81, 0x8E, 0xD1, 0x7B, 0xBE, 0xF6, 0x7C, 0xDC, 0x7B, 0xE6, 0xDC, 0x73, 0x2F,
+    0x8A, 0x11, 0x69, 0x98, 0x51, 0x4C, 0x34, 0x13, 0xB2, 0x19, 0xF0, 0x25, 0xD2, 0x15, 0x28, 0xC0,
+    0x19, 0xE0, 0x9E, 0x4C, 0x2D, 0x93, 0x5D, 0xB6, 0xD8, 0x01, 0xF6, 0xC7, 0x0E, 0x67, 0x40, 0xFE,
+    0xC3, 0x00, 0x6E, 0xCE, 0x4F, 0x47, 0x4C, 0x80, 0x7B, 0x30, 0x61, 0xA4, 0xC1, 0x6C, 0x68, 0x3C,
+    0xCE, 0x93, 0x41, 0x1E, 0x8A, 0x74, 0x90, 0x87, 0xE2, 0xB4, 0x07, 0x8F, 0xBA, 0xA7, 0x1D, 0x78,
+    0x34, 0x7F, 0xD6, 0x82, 0x47, 0xB3, 0xAB, 0x68, 0xD2, 0x40, 0x33, 0xC1, 0x30, 0x86, 0x8E, 0x86,
+    0x12, 0x9E, 0xAF, 0x0D, 0xD0, 0xD0, 0x10, 0x83, 0xC6, 0xDB, 0x7A, 0x98, 0xED, 0x3D, 0x6F, 0x37,
+    0xD3, 0x6F, 0xA6, 0x3B, 0x9C, 0x24, 0x72, 0x8D, 0xDD, 0xB6, 0xF3, 0x13, 0x5C, 0x8F, 0xCF, 0x7B,
+    0x3B, 0x65, 0xE1, 0x51, 0x18, 0x8F, 0x4E, 0xDC, 0x65, 0x6F, 0x9E, 0x8F, 0xBE, 0xCC, 0x7E, 0x29,
+    0xF7, 0xF0, 0x4F, 0x88, 0x2F, 0xD4, 0x79, 0x9B, 0xCE, 0x38, 0x81, 0xEB, 0x92, 0x91, 0x81, 0xF9,
+    0x35, 0x32, 0x70, 0xDE, 0x9A, 0x89, 0x93, 0xB6, 0xFB, 0x8A, 0x5F, 0xCE, 0xB6, 0x58, 0xA7, 0x42,
+    0x4C, 0x4C, 0xB0, 0x84, 0x89, 0x37, 0xF8, 0x2F, 0xAF, 0x23, 0x17, 0x7A, 0xDB, 0xF3, 0xAF, 0xEB,
+    0xC2, 0xF1, 0x4B, 0x57, 0xC1, 0xD1, 0xCB, 0xF0, 0x35, 0x1E, 0xC7, 0xB5, 0x54, 0x93, 0xC9, 0xB4,
+    0x81, 0x5D, 0xAA, 0xB8, 0x56, 0xCD, 0xD1, 0xB8, 0x21, 0x1A, 0xDB, 0xE2, 0xD5, 0xF1, 0x7F, 0xC9,
+    0x8F, 0x29, 0xEF, 0x94, 0xF4, 0x4F, 0x00, 0x77, 0x33, 0x7A, 0x9B, 0x4F, 0x38, 0x75, 0xC5, 0x97,
+    0x24, 0x5C, 0xF3, 0x72, 0x38, 0x4C, 0x53, 0xFB, 0xDE, 0xAD, 0x59, 0xE8, 0xDE, 0x9D, 0xAA, 0xA6,
+    0xCE, 0x9E, 0x75, 0x7B, 0xB8, 0x1D, 0xF9, 0x3F, 0xEF, 0xC8, 0xFF, 0x2A, 0xFE, 0x07, 0xF2, 0x5F,
+    0x95, 0xB6, 0x4B, 0x66, 0x7D, 0x75, 0x90, 0xC9, 0x7A, 0x4E, 0xFA, 0x07, 0x96, 0x5F, 0x5F, 0x7A,
+    0xA4, 0x57, 0xFD, 0x8C, 0x7C, 0x4D, 0x7B, 0xF8, 0x6E, 0x43, 0x11, 0xF3, 0x6F, 0x96, 0x8D, 0xD9,
+    0xFA, 0x46, 0x20, 0x5B, 0x7C, 0x9E, 0xD5, 0x38, 0x8B, 0xCF, 0x7B, 0x9B, 0x62, 0x4C, 0x53, 0x12,
+    0x88, 0x09, 0x7D, 0xB5, 0x18, 0x08, 0x0B, 0x5D, 0xEC, 0x76, 0x0C, 0x00, 0x2F, 0x38, 0xC8, 0x17,
+    0xB1, 0x18, 0x11, 0xF1, 0xF2, 0x70, 0x74, 0x2A, 0x50, 0x5C, 0x6E, 0xE5, 0x34, 0xE2, 0x92, 0xFB,
+    0x5D, 0x74, 0xEF, 0x13, 0xE9, 0x20, 0xBF, 0x68, 0xB9, 0x9D, 0xE8, 0xA4, 0x8E, 0xD0, 0x13, 0x35,
+    0x8A, 0xEE, 0x5A, 0xC2, 0xFF, 0x39, 0x9F, 0x17, 0xAF, 0x9F, 0x4F, 0xBF, 0xE5, 0x33, 0x7F, 0xFD,
+    0x7C, 0x56, 0x5B, 0x3E, 0x37, 0x52, 0x70, 0x17, 0x37, 0x44, 0xBD, 0x19, 0xA5, 0x8C, 0xFC, 0x32,
+    0x16, 0x5C, 0x1E, 0x22, 0xAB, 0x76, 0xB9, 0x9D, 0xCE, 0x3B, 0x2B, 0x9A, 0xAF, 0x55, 0x60, 0x0F,
+    0x7F, 0x5D, 0xD7, 0x58, 0x5F, 0xBB, 0xD1, 0x76, 0x2A, 0xAF, 0x7C, 0xC2, 0xAC, 0xEA, 0x62, 0x52,
+    0x7C, 0xA9, 0xE2, 0x2A, 0x4A, 0x4E, 0xB2, 0xB6, 0x48, 0xCA, 0x3E, 0x51, 0xA1, 0x9D, 0x69, 0x92,
+    0x1C, 0xE5, 0xB5, 0xF8, 0xD6, 0x1D, 0x59, 0x76, 0xBA, 0x13, 0xA3, 0xD5, 0xF8, 0xC8, 0xB5, 0x0C,
+    0xDA, 0x6E, 0xB0, 0x3F, 0x2C, 0x6F, 0x42, 0x86, 0x30, 0x88, 0x29, 0xE1, 0x31, 0xC7, 0x9F, 0xE2,
+    0x1F, 0x86, 0x0D, 0xA3, 0xE4, 0x47, 0xB2, 0x51, 0xFD, 0xFE, 0x19, 0x09, 0x98, 0xF4, 0xAB, 0x4A,
+    0xD8, 0x21, 0x9D, 0xD4, 0x41, 0x7C, 0xAB, 0x34, 0x2A, 0x60, 0x63, 0xE9, 0xCC, 0xCC, 0xAA, 0xE3,
+    0x6C, 0xD0, 0x84, 0xBB, 0x90, 0x62, 0x1A, 0xED, 0x48, 0xA7, 0x46, 0x50, 0x7E, 0xD6, 0x74, 0xA5,
+    0x7D, 0xE9, 0x44, 0x4C, 0x70, 0xAD, 0x76, 0x2F, 0xD4, 0x04, 0x3D, 0x99, 0x95, 0x84, 0x32, 0xD6,
+    0xFD, 0xAA, 0x57, 0x44, 0xB2, 0x63, 0x42, 0x28, 0xFF, 0x6A, 0x01, 0xE6, 0xF8, 0x58, 0xD3, 0x2D,
+    0x39, 0x1E, 0xFE, 0x8E, 0xD3, 0x29, 0xF9, 0x5C, 0x28, 0xBE, 0x0B, 0xEC, 0x24, 0x79, 0xE7, 0xEB,
+    0x74, 0x64, 0x84, 0x73, 0xAA, 0xCC, 0x9F, 0x0E, 0xB0, 0x3F, 0x31, 0x69, 0x23, 0x29, 0x99, 0x7D,
+    0x8D, 0x13, 0x4B, 0x2D, 0x31, 0xF7, 0xBE, 0xAE, 0x88, 0x20, 0x1F, 0x7C, 0x6B, 0xE4, 0xD7, 0x29,
+    0xD8, 0x3B, 0x07, 0x3E, 0xBF, 0xC0, 0x07, 0xB1, 0xE3, 0x10, 0x68, 0xFE, 0xFC, 0x5C, 0x41, 0x82,
+    0xF2, 0xE7, 0x96, 0x83, 0x4E, 0x7A, 0x33, 0x1A, 0x1D, 0xF7, 0x72, 0x94, 0xAD, 0xC7, 0x7C, 0xB2,
+    0x74, 0xAA, 0x3A, 0x23, 0x7B, 0x0D, 0x0A, 0xF2, 0xBB, 0xB2, 0x04, 0x91, 0xCC, 0xEA, 0x5B, 0x76,
+    0x10, 0x19, 0xEE, 0xA9, 0x32, 0x55, 0x69, 0xC2, 0xCC, 0xEA, 0x63, 0xF6, 0x0F, 0xB1, 0x53, 0x7C,
+    0xA3, 0xDB, 0x2D, 0x22, 0x2D, 0x8B, 0xFB, 0x8A, 0x47, 0xB3, 0x76, 0xA8, 0xEF, 0xE5, 0x5D, 0xCE,
+    0xC5, 0x15, 0xAE, 0x57, 0xAF, 0xF3, 0xE3, 0x7B, 0x6B, 0x8C, 0xD8, 0x09, 0xD9, 0x78, 0xBB, 0x5B,
+    0x0F, 0xF8, 0x96, 0xE2, 0x7D, 0x02, 0x77, 0x35, 0x91, 0x35, 0x89, 0xFD, 0xB7, 0x57, 0x9A, 0x07,
+    0xEF, 0xC2, 0xCC, 0x23, 0x7D, 0xE1, 0xD4, 0x53, 0x97, 0x64, 0x42, 0x71, 0x7F, 0x86, 0xED, 0xF7,
+    0xEC, 0xAE, 0x2C, 0xA3, 0x3D, 0xD9, 0x2B, 0x3E, 0x66, 0xF5, 0x7D, 0xCF, 0x8C, 0xF7, 0xE7, 0x64,
+    0xCF, 0xD7, 0xC9, 0x94, 0x0D, 0x66, 0x46, 0xE0, 0x55, 0x1C, 0x15, 0x61, 0x14, 0xD4, 0x1C, 0xC8,
+    0x09, 0x6F, 0xE1, 0xFD, 0xA8, 0xBC, 0xBD, 0x34, 0x93, 0x92, 0x27, 0x3B, 0x3B, 0xC6, 0x2E, 0xFA,
+    0xAA, 0x13, 0x6E, 0x11, 0xF7, 0x98, 0xC0, 0x6E, 0x0F, 0xAF, 0x0B, 0x6C, 0x12, 0x73, 0x2F, 0x1E,
+    0x06, 0x6C, 0xCC, 0xA9, 0x01, 0xB1, 0x3D, 0x44, 0x8D, 0x49, 0x30, 0x76, 0xD8, 0xA8, 0xDB, 0x88,
+    0xD9, 0x44, 0xA6, 0x76, 0x92, 0x0D, 0x91, 0xBB, 0x48, 0x55, 0xDE, 0xC7, 0x67, 0x17, 0xE9, 0x6D,
+    0x23, 0x79, 0xB5, 0x56, 0x2B, 0x6C, 0x32, 0x2B, 0x58, 0x02, 0xD3, 0x4B, 0xF6, 0xEC, 0x72, 0x44,
+    0xD9, 0x6F, 0x3A, 0x43, 0x15, 0xBA, 0xDB, 0xF4, 0xFD, 0xBB, 0xF1, 0x27, 0xCD, 0x55, 0xBD, 0x6E,
+    0xD5, 0x30, 0x18, 0x3D, 0x4E, 0x5A, 0x19, 0x71, 0x05, 0x66, 0xA9, 0x54, 0xA9, 0x43, 0x16, 0x06,
+    0xB6, 0x2C, 0x0C, 0x2C, 0xE0, 0x48, 0x0C, 0x1D, 0x18, 0x58, 0x91, 0x18, 0xDA, 0x37, 0xE8, 0x0B,
+    0x94, 0x5E, 0x8B, 0x95, 0x81, 0x32, 0xF3, 0x06, 0x5D, 0x58, 0x3A, 0xD2, 0xC6, 0x6A, 0x5F, 0x20,
+    0x0B, 0x62, 0x35, 0x52, 0x59, 0x60, 0xC9, 0x90, 0x8A, 0xB4, 0xE4, 0x5E, 0x73, 0x3E, 0xE7, 0xAA,
+    0xBD, 0x4C, 0x2C, 0xA8, 0xAA, 0xA5, 0x38, 0x3F, 0xB6, 0xBF, 0xEF, 0x9C, 0xF3, 0xFD, 0x04, 0x58,
+    0x41, 0x05, 0x7C, 0x36, 0x0E, 0xBA, 0xAD, 0x01, 0xFB, 0xBC, 0x43, 0xDE, 0x5B, 0x87, 0xF2, 0x6D,
+    0x07, 0x74, 0xA6, 0x82, 0xC2, 0x03, 0x2C, 0x8D, 0x69, 0x0F, 0x98, 0x38, 0x00, 0xF3, 0xCD, 0x01,
+    0xA6, 0xC9, 0x3B, 0x1C, 0xF3, 0xA6, 0x5B, 0x94, 0xAE, 0xAC, 0xF8, 0x3C, 0x20, 0xEB, 0xF8, 0x66,
+    0x9A, 0xC2, 0xC1, 0xF2, 0x5D, 0xF5, 0x59, 0xCF, 0xB7, 0x49, 0xE0, 0x73, 0xE1, 0xB9, 0x62, 0x3D,
+    0xDD, 0x4C, 0x63, 0xCB, 0x69, 0x46, 0x7B, 0xAB, 0xC9, 0xEA, 0x46, 0xE4, 0xE8, 0xA0, 0xE5, 0x16,
+    0x1B, 0xD4, 0x97, 0xAF, 0x2F, 0x0F, 0x6A, 0x18, 0x9E, 0xF4, 0xD8, 0x45, 0xE4, 0x5E, 0xA8, 0x60,
+    0x5A, 0x5A, 0x83, 0xE6, 0x33, 0x26, 0x0D, 0x40, 0xD7, 0xB0, 0xC4, 0x5E, 0x78, 0xD0, 0x2B, 0x40,
+    0x6B, 0x34, 0x8F, 0x9C, 0x57, 0xF9, 0xA3, 0x4E, 0x9F, 0x6B, 0x02, 0xA5, 0xB7, 0xFC, 0xF2, 0x60,
+    0x3F, 0xE3, 0x16, 0x1A, 0xC3, 0x44, 0x1C, 0x73, 0x77, 0xE9, 0x41, 0x60, 0x90, 0x65, 0xD3, 0x60,
+    0x45, 0xF1, 0xB4, 0x05, 0x9E, 0xE4, 0x83, 0x18, 0xCB, 0x82, 0x1E, 0xA0, 0x03, 0x8A, 0x6A, 0x32,
+    0xC7, 0xF4, 0xCB, 0xC1, 0x80, 0x49, 0x42, 0x16, 0x16, 0x08, 0xE9, 0x75, 0xAD, 0x5A, 0x12, 0x45,
+    0xC5, 0x90, 0x45, 0x97, 0xC7, 0xA8, 0x63, 0x9F, 0x5F, 0x14, 0x3F, 0x9B, 0x29, 0xC1, 0x45, 0x6F,
+    0x4E, 0x7A, 0xD8, 0x46, 0x7F, 0xE3, 0xF1, 0x36, 0xEF, 0x8E, 0xE8, 0x90, 0xD2, 0x52, 0xEC, 0x49,
+    0x47, 0x70, 0x76, 0x1A, 0xE8, 0xC1, 0x44, 0x47, 0x18, 0xFA, 0x02, 0x94, 0x27, 0x27, 0x9E, 0xD2,
+    0x65, 0x11, 0x6A, 0xB3, 0x55, 0xB1, 0xC9, 0xDA, 0x98, 0xC5, 0xF9, 0x4E, 0x5B, 0xC4, 0xC1, 0x46,
+    0x7E, 0xE8, 0x34, 0x95, 0x51, 0x15, 0x03, 0x76, 0x3D, 0x0A, 0x99, 0x84, 0x12, 0x81, 0x71, 0xCA,
+    0xA3, 0xE3, 0x2C, 0xF0, 0x16, 0xBA, 0x5E, 0x23, 0xAC, 0xE3, 0x99, 0xE8, 0x41, 0xDD, 0xEF, 0xEE,
+    0xB8, 0xDA, 0x51, 0x3D, 0x35, 0x08, 0x65, 0x92, 0xA7, 0x62, 0x47, 0xC0, 0x9E, 0x3C, 0x32, 0x4C,
+    0x83, 0x28, 0x59, 0x3A, 0x8A, 0x25, 0x76, 0x07, 0x4D, 0x61, 0x8A, 0x38, 0x07, 0x32, 0x99, 0x60,
+    0x3F, 0x8A, 0xF2, 0xAD, 0x95, 0x4C, 0x90, 0x00, 0xE8, 0x20, 0x3A, 0x1F, 0x49, 0x88, 0x8C, 0x17,
+    0x02, 0x03, 0x8A, 0x20, 0xDA, 0xD7, 0xAE, 0x14, 0x51, 0x5E, 0xF0, 0x94, 0x96, 0xE8, 0x24, 0x40,
+    0x8A, 0xF0, 0x9E, 0x71, 0x67, 0x80, 0x84, 0x83, 0x61, 0x60, 0xDA, 0x21, 0x2C, 0xC1, 0xDC, 0xE8,
+    0xCD, 0xD7, 0x78, 0x3A, 0x5F, 0xEB, 0x63, 0x63, 0xB6, 0x5E, 0xA9, 0x5F, 0x1E, 0xC5, 0x21, 0x32,
+    0x3A, 0xB6, 0x3E, 0xC9, 0x23, 0xA1, 0x0F, 0x29, 0xDC, 0x8C, 0xA5, 0x12, 0xBD, 0xAA, 0x14, 0x70,
+    0x7B, 0xCB, 0x88, 0xA6, 0xE4, 0x90, 0x34, 0x4B, 0x59, 0xBA, 0xC0, 0x27, 0x40, 0x19, 0x7D, 0x99,
+    0xCA, 0x04, 0xB5, 0xBA, 0xC2, 0xEC, 0x66, 0x9A, 0xB4, 0xD5, 0xD6, 0xFB, 0x19, 0xC8, 0x1B, 0xC5,
+    0x2E, 0x84, 0x38, 0xCA, 0x90, 0x98, 0x83, 0xF5, 0x98, 0xAC, 0x1D, 0x63, 0x4C, 0x75, 0x5E, 0x42,
+    0x3E, 0xEB, 0x46, 0xA3, 0xA3, 0xE1, 0x71, 0x90, 0x5B, 0x92, 0x48, 0x2A, 0x44, 0xF2, 0xBD, 0xA0,
+    0x93, 0x37, 0xFC, 0xBE, 0x9D, 0x56, 0xB7, 0xF1, 0x48, 0x44, 0x17, 0x2A, 0xB3, 0x54, 0x2C, 0xE7,
+    0x62, 0xAE, 0x10, 0xC2, 0x24, 0xC2, 0x29, 0x0B, 0xB7, 0x2F, 0x6D, 0xEE, 0xE0, 0x21, 0x9E, 0x72,
+    0x87, 0xA5, 0xC7, 0xE2, 0xA5, 0x67, 0xCD, 0x20, 0x2D, 0x8E, 0xD2, 0x2E, 0xE7, 0x4E, 0x33, 0x1D,
+    0x6C, 0x90, 0xE4, 0xC1, 0xF9, 0xB9, 0x93, 0xEC, 0x51, 0xBF, 0xAB, 0x94, 0x3E, 0x52, 0xD6, 0xE2,
+    0x46, 0x38, 0x8B, 0x3A, 0xA2, 0x4C, 0x52, 0xC7, 0xA5, 0x14, 0x4A, 0xF1, 0x59, 0xE4, 0x90, 0x12,
+    0x15, 0xB8, 0xA4, 0x69, 0xDD, 0xF0, 0x58, 0x29, 0x4C, 0xC2, 0xF8, 0xFD, 0x6A, 0xD4, 0xF3, 0x2A,
+    0x8B, 0xB1, 0xCF, 0x66, 0x6A, 0x46, 0x3D, 0x8A, 0xEA, 0x08, 0xDA, 0x5B, 0x69, 0x51, 0x0D, 0xB6,
+    0xC5, 0x57, 0x12, 0xD3, 0x48, 0x7F, 0x8B, 0x12, 0x0B, 0xA9, 0xC8, 0x69, 0x27, 0x62, 0x48, 0xBF,
+    0x6A, 0xD7, 0x99, 0xFE, 0x86, 0x0E, 0x35, 0xB9, 0x9C, 0xB0, 0xEB, 0x05, 0xD6, 0x7E, 0x5B, 0x9E,
+    0xE9, 0x9E, 0xDD, 0xA5, 0xA7, 0x6C, 0xE1, 0xAA, 0x7C, 0x17, 0x30, 0xEB, 0x11, 0xB9, 0x1D, 0x43,
+    0x7D, 0xFF, 0xEF, 0xD2, 0xAE, 0x5B, 0x39, 0xA2, 0x2E, 0xB6, 0x9C, 0xF1, 0x2B, 0x89, 0x05, 0xFD,
+    0x26, 0xD2, 0x71, 0xBC, 0xD8, 0x51, 0x20, 0xFD, 0x8D, 0xED, 0xA7, 0xD2, 0xA1, 0x64, 0xD3, 0xA8,
+    0x3F, 0xF4, 0x2A, 0x46, 0xC7, 0x9E, 0x82, 0xEB, 0x76, 0x22, 0x81, 0x55, 0x91, 0x9A, 0x11, 0x83,
+    0x1A, 0x6C, 0xA5, 0x06, 0x3A, 0x3B, 0xC4, 0xE3, 0x1B, 0x67, 0xBD, 0x3A, 0x62, 0x11, 0xF1, 0x09,
+    0xD0, 0x9C, 0x06, 0x76, 0x4C, 0x3F, 0xF1, 0x06, 0xEB, 0x4B, 0xBF, 0xA2, 0xFF, 0xC5, 0xFA, 0x46,
+    0x38, 0x49, 0xA5, 0x5F, 0x19, 0xCB, 0xF9, 0x31, 0x6B, 0xC7, 0xEA, 0x95, 0x24, 0xC3, 0xFE, 0x02,
+    0x4A, 0x16, 0x3D, 0xFF, 0x1F, 0xFA, 0xFB, 0x5E, 0xDE, 0x2A, 0xA9, 0x27, 0xFE, 0xDC, 0x26, 0xCC,
+    0x59, 0x86, 0x44, 0xA4, 0xA8, 0x7D, 0xDA, 0x7D, 0x7C, 0x0F, 0xC5, 0x3B, 0xAF, 0x4F, 0xE6, 0x9B,
+    0x61, 0x1A, 0x43, 0xFA, 0x25, 0xA4, 0x7E, 0x93, 0x13, 0xE2, 0x27, 0x27, 0xC6, 0x55, 0xFA, 0x4D,
+    0x4A, 0x71, 0xEC, 0xE3, 0x9F, 0xE3, 0x0F, 0xD5, 0x54, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0x6B,
+    0x93, 0x18, 0xB4, 0x85, 0x83, 0x44, 0x24, 0x84, 0x04, 0x6E, 0x28, 0x68, 0xC0, 0x0D, 0x45, 0x8A,
+    0x23, 0x5E, 0x89, 0x5F, 0xC8, 0x91, 0x22, 0x45, 0xF8, 0x83, 0x34, 0x94, 0x49, 0xBC, 0xD4, 0x14,
+    0x84, 0x3F, 0x48, 0x9D, 0x26, 0x14, 0x74, 0xDC, 0x9D, 0xB7, 0xA3, 0xE4, 0x3E, 0xE1, 0xC4, 0x0F,
+    0xC4, 0x42, 0x0E, 0xF2, 0x21, 0xDF, 0x2D, 0x6F, 0x7C, 0xB9, 0x24, 0x10, 0x08, 0x54, 0x04, 0x56,
+    0xF6, 0x8C, 0xBC, 0xDE, 0x9D, 0x79, 0xEF, 0xCD, 0xEC, 0x22, 0x30, 0x6A, 0x0F, 0x3D, 0xF4, 0x11,
+    0x95, 0x99, 0x41, 0xF6, 0x7A, 0x08, 0xF8, 0x12, 0x88, 0x1A, 0x00, 0x09, 0xCE, 0x8D, 0xD4, 0xEF,
+    0xF1, 0xF5, 0x56, 0x57, 0x51, 0xA5, 0x1A, 0x24, 0x26, 0x35, 0xAA, 0x0C, 0x4B, 0xDC, 0x43, 0x66,
+    0x94, 0x0D, 0x65, 0x7D, 0x3A, 0xA2, 0xF1, 0x8C, 0x10, 0x7A, 0x0B, 0x68, 0x6F, 0x18, 0x62, 0x22,
+    0xF3, 0x15, 0x4D, 0xEE, 0x6E, 0x23, 0x68, 0x42, 0x87, 0xD8, 0x6D, 0x03, 0x8D, 0x1E, 0x22, 0xB1,
+    0x03, 0x84, 0xA5, 0x1E, 0xAB, 0x29, 0x72, 0x06, 0xA6, 0xE1, 0xAE, 0x05, 0xC9, 0x75, 0x0D, 0x0F,
+    0xF0, 0x08, 0x0D, 0x52, 0xC6, 0x4F, 0x5E, 0x71, 0xCB, 0x91, 0x41, 0xC8, 0x48, 0x41, 0x8D, 0xEF,
+    0x86, 0xF6, 0x90, 0x5D, 0x6A, 0xBC, 0x69, 0xC3, 0x52, 0x31, 0x18, 0x53, 0x33, 0x57, 0x30, 0x15,
+    0x1C, 0x0E, 0xC8, 0x38, 0xA1, 0x89, 0x4C, 0x09, 0x8A, 0x01, 0x1E, 0x63, 0x97, 0x54, 0xB7, 0x51,
+    0xBC, 0xA9, 0xB9, 0x6D, 0x84, 0x44, 0x10, 0x2E, 0x11, 0xA4, 0xE7, 0x48, 0xC5, 0x64, 0x07, 0xC5,
+    0xC1, 0x60, 0x95, 0x4B, 0x9F, 0x74, 0x28, 0x49, 0xA7, 0x83, 0x09, 0x3A, 0x2B, 0x04, 0xF2, 0x02,
+    0x4A, 0x08, 0xB6, 0xF9, 0x25, 0x43, 0x9B, 0x6A, 0x66, 0x22, 0x31, 0x5A, 0x98, 0xC7, 0x43, 0x31,
+    0x6E, 0x6E, 0x12, 0x2B, 0xD4, 0xC5, 0x50, 0x58, 0xE2, 0x34, 0x82, 0xB7, 0x11, 0x21, 0x9B, 0x39,
+    0xFE, 0x25, 0x9C, 0x80, 0x0D, 0xBC, 0x7C, 0x66, 0x62, 0x76, 0xF9, 0xB6, 0xC9, 0xDA, 0x98, 0x37,
+    0x66, 0x0B, 0x0D, 0x14, 0xD3, 0x30, 0xFB, 0x0E, 0xF7, 0x43, 0x1D, 0xFA, 0xCF, 0xDE, 0xD7, 0xCF,
+    0xC6, 0x6B, 0x04, 0x29, 0xBB, 0x98, 0x2F, 0x1A, 0x41, 0x11, 0x58, 0xEF, 0xDC, 0x77, 0x50, 0x85,
+    0xB6, 0x1F, 0x8D, 0xD2, 0xA3, 0x52, 0xB3, 0xA4, 0xAC, 0x8B, 0x82, 0x3C, 0x2C, 0xAD, 0x2A, 0xE8,
+    0x1C, 0xC2, 0x91, 0x50, 0x60, 0x1E, 0xB6, 0x00, 0x7F, 0x59, 0xEC, 0x73, 0x8A, 0x7C, 0xC2, 0x2A,
+    0x71, 0xC4, 0x20, 0x48, 0x8A, 0x7A, 0x5E, 0x57, 0x6D, 0xCF, 0x09, 0x7F, 0x65, 0x8A, 0xB1, 0x75,
+    0x34, 0x97, 0xF2, 0x3B, 0x36, 0xB8, 0xC9, 0xEE, 0x78, 0x88, 0xF0, 0x93, 0x13, 0x59, 0x38, 0x7D,
+    0xC7, 0x7B, 0xED, 0xFD, 0x48, 0x74, 0x49, 0x4D, 0x9B, 0x8B, 0x5A, 0x50, 0x88, 0x93, 0xDF, 0xED,
+    0x2E, 0x12, 0x23, 0xA4, 0xD4, 0xAC, 0x04, 0x55, 0x62, 0x29, 0x4D, 0xC0, 0xD8, 0xF1, 0x44, 0x5A,
+    0xEE, 0x32, 0x52, 0xCD, 0x2F, 0x48, 0xAD, 0x8F, 0x0D, 0x6B, 0x27, 0xD2, 0x1E, 0x7E, 0xB5, 0x17,
+    0x48, 0x25, 0x7F, 0x40, 0xEA, 0xF7, 0x95, 0xDD, 0x38, 0x5E, 0x2B, 0xFC, 0x74, 0x79, 0xDA, 0xBD,
+    0xBC, 0xB2, 0x92, 0xE9, 0xB9, 0x24, 0x28, 0x45, 0x5E, 0x2F, 0x87, 0x18, 0xA5, 0x1C, 0x46, 0xEC,
+    0xA7, 0x06, 0x17, 0x47, 0xEE, 0x5D, 0xE8, 0x9B, 0xC2, 0xDB, 0xD0, 0xD7, 0x51, 0x25, 0xC0, 0x66,
+    0x82, 0x49, 0x75, 0x56, 0x5B, 0x26, 0x3B, 0x2D, 0x95, 0x9D, 0x96, 0x4B, 0xAF, 0x25, 0xD3, 0xB4,
+    0x6C, 0x6A, 0x51, 0x97, 0xCD, 0x96, 0xB5, 0xD8, 0x09, 0x2A, 0x28, 0x91, 0xB7, 0xB5, 0x65, 0xC7,
+    0xB0, 0xA7, 0x06, 0x14, 0x7D, 0x28, 0x96, 0x9A, 0xD3, 0xC6, 0x16, 0x45, 0xCB, 0x25, 0xB7, 0x6C,
+    0x0E, 0x64, 0xE3, 0x2D, 0xB2, 0x8D, 0x45, 0x34, 0x4A, 0x27, 0xCD, 0x3F, 0x3B, 0xF3, 0xC0, 0x2D,
+    0xE9, 0x8D, 0xFA, 0x2E, 0x97, 0xD4, 0x15, 0x82, 0x2F, 0x3C, 0xC0, 0xFA, 0xA9, 0x54, 0x46, 0xD9,
+    0x1F, 0xA0, 0x6F, 0x95, 0x48, 0x23, 0xEF, 0x54, 0xB3, 0x90, 0x8B, 0x1A, 0xBC, 0x27, 0xCC, 0x89,
+    0x23, 0x06, 0xC1, 0x48, 0xD7, 0x3F, 0x75, 0x8E, 0x6E, 0x4A, 0x12, 0xBA, 0x22, 0xBE, 0xF7, 0xC3,
+    0x97, 0xB5, 0xFE, 0x18, 0x47, 0xC7, 0xCD, 0x6E, 0x1D, 0x7B, 0xE7, 0x5D, 0x5A, 0x87, 0x35, 0x8B,
+    0xAF, 0xCE, 0xA2, 0x17, 0xFE, 0x4C, 0xC0, 0xE5, 0xEE, 0x7F, 0x21, 0x9D, 0xEA, 0x76, 0xA5, 0x7D,
+    0x27, 0x02, 0xAD, 0xFC, 0x09, 0xE0, 0x45, 0xCF, 0x44, 0x39, 0x21, 0xB8, 0x75, 0xC9, 0x14, 0xBB,
+    0xA0, 0x9A, 0xBB, 0x8C, 0x8E, 0x27, 0x22, 0x83, 0x1E, 0xCE, 0x5D, 0x23, 0x93, 0xA2, 0x67, 0x41,
+    0x59, 0x75, 0xFF, 0x7A, 0x62, 0x7B, 0x65, 0x99, 0x6F, 0x7E, 0x38, 0xB2, 0xBE, 0x89, 0x9B, 0xC0,
+    0xDB, 0xCC, 0xB2, 0x6D, 0x97, 0x4E, 0xA3, 0xAF, 0xE0, 0x3E, 0x84, 0xE6, 0x5B, 0x11, 0x6F, 0x43,
+    0x8E, 0x40, 0x26, 0x37, 0xF9, 0xEC, 0xEE, 0x97, 0x0E, 0xFF, 0xC7, 0xFB, 0x4E, 0x46, 0x8C, 0x45,
+    0xB9, 0x7A, 0xDF, 0xB1, 0xF0, 0x87, 0x0E, 0x72, 0x29, 0xF0, 0x92, 0x34, 0x7F, 0xB5, 0xEF, 0xAE,
+    0x64, 0x7C, 0x03, 0xCD, 0x55, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x1D, 0x72, 0x6D, 0x33, 0x00, 0x61,
+    0xAC, 0x8B, 0x24, 0xED, 0x36, 0xA9, 0x02, 0x24, 0xCC, 0x07, 0x48, 0x5A, 0x22, 0x8D, 0xCB, 0xB8,
+    0x08, 0x90, 0x22, 0x85, 0x3F, 0x41, 0x4D, 0x4A, 0xE9, 0xB8, 0x42, 0x7E, 0x20, 0x7F, 0xE2, 0xD6,
+    0x80, 0xEF, 0x44, 0xDA, 0x2E, 0x5C, 0xB8, 0x30, 0x81, 0x20, 0x48, 0x91, 0x22, 0xFC, 0x03, 0xAD,
+    0x02, 0x1A, 0x60, 0xA0, 0xBD, 0xDB, 0xBC, 0xB7, 0xBC, 0xCB, 0xE9, 0xE4, 0x3A, 0x88, 0x57, 0xF0,
+    0xAC, 0xBC, 0xDC, 0x9D, 0x99, 0xF7, 0xE6, 0xCD, 0x48, 0x44, 0xBE, 0x17, 0xAC, 0x62, 0x43, 0xAB,
+    0x9F, 0x39, 0xD8, 0xAF, 0x8B, 0x0E, 0xF6, 0x48, 0xD1, 0x1E, 0xA7, 0xDF, 0xAB, 0x67, 0x35, 0xBF,
+    0xAE, 0x79, 0x27, 0x7B, 0x22, 0xDB, 0xD5, 0xC4, 0x4E, 0xC5, 0xD0, 0x46, 0xA7, 0xE2, 0x54, 0x8C,
+    0xF8, 0x7F, 0xAD, 0xBC, 0x88, 0x95, 0x02, 0xF6, 0x44, 0xCA, 0x41, 0xE4, 0x5C, 0x74, 0x9F, 0x2C,
+    0x9C, 0x2C, 0xC5, 0xC0, 0x06, 0x31, 0x08, 0x31, 0x49, 0x55, 0x4B, 0x36, 0x8A, 0x85, 0xF5, 0x78,
+    0x21, 0xB9, 0x97, 0x46, 0x04, 0xCF, 0x17, 0xB0, 0x83, 0x5C, 0x22, 0xA1, 0x9E, 0xB6, 0xEC, 0x68,
+    0xB5, 0x93, 0x96, 0x8E, 0xA5, 0x71, 0x82, 0x1C, 0xEC, 0xDF, 0xA7, 0x13, 0x0E, 0x63, 0x84, 0xEF,
+    0x3C, 0xA6, 0xC4, 0xEF, 0xCB, 0x7E, 0x35, 0x08, 0x53, 0x44, 0x98, 0x63, 0x4D, 0xF7, 0xC7, 0xF0,
+    0xE2, 0x90, 0x9D, 0x21, 0x12, 0x4B, 0x08, 0xB6, 0xDF, 0x5F, 0x7E, 0x10, 0x11, 0xBB, 0x41, 0x56,
+    0xDD, 0x0F, 0x0C, 0xAE, 0xBB, 0x7C, 0xDC, 0x6D, 0x16, 0x5B, 0x36, 0x61, 0x2B, 0xFB, 0xDD, 0x16,
+    0x78, 0x38, 0x00, 0x44, 0x5B, 0x17, 0x43, 0xB9, 0xFA, 0xC4, 0xB8, 0xA5, 0xF7, 0xCD, 0xD3, 0x37,
+    0x57, 0x2E, 0x06, 0x1D, 0xF2, 0xE8, 0xAC, 0x93, 0x5A, 0x1E, 0xED, 0xDD, 0x7F, 0x21, 0xDF, 0xC0,
+    0x06, 0x40, 0x95, 0x22, 0x94, 0xC8, 0xBA, 0x1A, 0x2D, 0xD8, 0x89, 0x17, 0xB1, 0x96, 0x7C, 0x52,
+    0x38, 0xCE, 0x5C, 0x5E, 0xCB, 0xED, 0xF5, 0xF1, 0xB1, 0x7A, 0x0F, 0x98, 0xE4, 0x0C, 0x8F, 0x94,
+    0x87, 0x3B, 0xFB, 0xF3, 0x24, 0x79, 0x00, 0x50, 0x73, 0x81, 0xFB, 0xCF, 0xE1, 0x45, 0xEA, 0x7B,
+    0xFB, 0xF4, 0xB3, 0xB6, 0x93, 0xA5, 0x89, 0x48, 0xF7, 0x33, 0x66, 0x85, 0xE0, 0xAB, 0xDD, 0xA6,
+    0x3B, 0x75, 0x97, 0xE3, 0x86, 0x87, 0x24, 0xB7, 0x02, 0xC7, 0xF9, 0xD5, 0xB7, 0xC5, 0x50, 0x1D,
+    0x1D, 0x99, 0xDF, 0xAF, 0x6F, 0x06, 0x1B, 0x55, 0x94, 0x76, 0x00, 0xDB, 0x8F, 0x90, 0xC0, 0xFF,
+    0x48, 0xCA, 0x78, 0x87, 0x14, 0x86, 0x4C, 0xB7, 0xD9, 0x11, 0x09, 0x72, 0x35, 0xDB, 0xDF, 0xD2,
+    0xC9, 0x7C, 0x67, 0xDA, 0xD1, 0x71, 0xEA, 0xA5, 0x82, 0x18, 0xB3, 0x70, 0xBF, 0x91, 0x82, 0xCA,
+    0xA9, 0xEA, 0xED, 0x86, 0x0C, 0xEE, 0x12, 0x64, 0x48, 0xD0, 0x06, 0x10, 0x4A, 0x12, 0xF4, 0xA2,
+    0xBF, 0x98, 0xCA, 0x77, 0xBA, 0x78, 0x1F, 0x16, 0x93, 0x8E, 0x5D, 0xEC, 0xAA, 0x49, 0x05, 0x70,
+    0x31, 0x77, 0x27, 0xFE, 0xA9, 0x7E, 0x97, 0xC2, 0x82, 0x26, 0x82, 0x85, 0x6C, 0x73, 0xA0, 0x25,
+    0x08, 0x76, 0x2B, 0x2A, 0x3F, 0xEF, 0x26, 0x3A, 0x99, 0x41, 0xA4, 0x5E, 0x46, 0x21, 0x41, 0x01,
+    0xD7, 0x57, 0xF2, 0x50, 0x3E, 0x5C, 0x79, 0x8C, 0xF2, 0xA0, 0x06, 0x70, 0x0B, 0xE7, 0x28, 0x53,
+    0xEC, 0x9B, 0x5E, 0xAA, 0x0E, 0xD5, 0xCA, 0x27, 0x41, 0x32, 0xA8, 0x60, 0xE5, 0xD8, 0x70, 0x16,
+    0x9E, 0x44, 0x07, 0xF4, 0x08, 0x40, 0x64, 0x68, 0xBE, 0xC0, 0xD8, 0x16, 0x00, 0x6B, 0x1C, 0x14,
+    0x7F, 0xF4, 0x00, 0x86, 0x83, 0xB0, 0x42, 0x85, 0x80, 0xCF, 0x3C, 0xEE, 0x59, 0xA7, 0xA0, 0xFC,
+    0x42, 0xC8, 0x6F, 0x77, 0x8E, 0xC2, 0xB3, 0x51, 0x74, 0x77, 0x42, 0x54, 0xFA, 0xE5, 0xA8, 0xFC,
+    0x92, 0x07, 0x56, 0x2C, 0xBA, 0x58, 0xCA, 0x37, 0xBD, 0xBA, 0x26, 0x86, 0x25, 0xBC, 0x9E, 0x90,
+    0xFF, 0x2B, 0xC9, 0x6F, 0x48, 0x44, 0x33, 0x48, 0x45, 0xB6, 0x0B, 0x44, 0x8C, 0x09, 0x2A, 0x94,
+    0x49, 0x4C, 0x73, 0xC4, 0xC3, 0x35, 0x0B, 0x5A, 0xA7, 0xFE, 0xD7, 0xE9, 0x63, 0x79, 0x45, 0x42,
+    0xCA, 0x5F, 0xE9, 0xBB, 0xE8, 0xCF, 0x93, 0x65, 0x40, 0xF9, 0x45, 0x0E, 0xDA, 0x32, 0xCB, 0x5A,
+    0x02, 0xB9, 0x8E, 0x3D, 0x9A, 0x76, 0xF3, 0xF9, 0x84, 0x32, 0x59, 0x07, 0xD9, 0x76, 0xE5, 0xA0,
+    0xBB, 0xC2, 0xE7, 0x23, 0x7E, 0x02, 0x84, 0xB7, 0x90, 0x58, 0x73, 0x70, 0x58, 0x78, 0x51, 0xBE,
+    0x9A, 0xA0, 0x93, 0xA5, 0x5E, 0x00, 0x53, 0x55, 0xBE, 0x7D, 0xE5, 0xA5, 0x78, 0xFD, 0xCA, 0x8F,
+    0x92, 0xFD, 0x35, 0x9C, 0x21, 0xE7, 0x85, 0x37, 0xC0, 0x68, 0x3C, 0x52, 0x47, 0x41, 0x52, 0xB2,
+    0x3E, 0x15, 0xF6, 0x60, 0x55, 0x29, 0x41, 0x96, 0x2B, 0xBF, 0x01, 0x57, 0x72, 0x49, 0x6D, 0xDB,
+    0x1A, 0xA9, 0x16, 0x5D, 0xE6, 0x6E, 0x5D, 0x2C, 0x63, 0x50, 0x71, 0x1D, 0x31, 0x84, 0xD2, 0x78,
+    0x69, 0x5C, 0xE9, 0x29, 0x39, 0x08, 0x1F, 0x85, 0x62, 0x8F, 0x01, 0x00, 0xEA, 0x23, 0x6B, 0x4C,
+    0x33, 0xB4, 0x8C, 0xE5, 0x24, 0xA4, 0x8C, 0xD5, 0x7B, 0xBA, 0x35, 0x49, 0x39, 0x1C, 0x9B, 0x52,
+    0x26, 0xB1, 0x5C, 0x26, 0x9F, 0x89, 0xAA, 0xA4, 0x15, 0x16, 0x6C, 0xCB, 0x68, 0x4A, 0x49, 0x4D,
+    0x29, 0x26, 0xBE, 0x65, 0xA9, 0x3D, 0xB0, 0x3E, 0xA5, 0xD9, 0x24, 0xDD, 0xEC, 0xA8, 0x35, 0xDF,
+    0xE1, 0x19, 0xF1, 0xCB, 0x94, 0xA3, 0x2A, 0x4F, 0x0E, 0x58, 0x3D, 0x45, 0x5F, 0x48, 0xA4, 0xE4,
+    0x7F, 0xF4, 0x88, 0xA7, 0xA8, 0x7A, 0x9C, 0x9C, 0xB3, 0x77, 0xCF, 0x68, 0x96, 0xEC, 0x68, 0x64,
+    0xB7, 0xC8, 0xD8, 0xE7, 0x94, 0xEA, 0x49, 0x9A, 0xE2, 0x1C, 0x3A, 0xD6, 0xF0, 0x4F, 0xD5, 0x31,
+    0xCD, 0x73, 0x42, 0x61, 0xD2, 0x96, 0x39, 0xDA, 0x7A, 0xD7, 0x11, 0x49, 0x17, 0x78, 0xF4, 0x53,
+    0x83, 0xA3, 0x76, 0xBD, 0xED, 0x11, 0xF9, 0xF2, 0x56, 0x0A, 0xC6, 0xAD, 0x00, 0x25, 0x50, 0x31,
+    0xCD, 0xC5, 0x9A, 0x13, 0x41, 0xBB, 0x0F, 0xDA, 0xA0, 0x8D, 0x9D, 0x8D, 0x7F, 0xC6, 0x09, 0xC3,
+    0xC7, 0x8C, 0x6C, 0xEE, 0x96, 0x01, 0x90, 0x2E, 0x38, 0xA9, 0xDC, 0x2C, 0xB4, 0x15, 0x75, 0xC5,
+    0x81, 0x73, 0xC9, 0xC9, 0x34, 0xAB, 0xD7, 0x3E, 0xAD, 0xC9, 0xCE, 0xF0, 0xAF, 0xDA, 0xDA, 0xC4,
+    0x69, 0xEA, 0xB8, 0xD5, 0x5E, 0x89, 0xE9, 0x13, 0xAB, 0xCA, 0x32, 0xF1, 0x99, 0x4B, 0x31, 0x7B,
+    0xB6, 0xEB, 0x5A, 0xFE, 0xDB, 0xF5, 0x0F, 0xCD, 0x54, 0xBF, 0x8F, 0x1B, 0x45, 0x14, 0x7E, 0xBB,
+    0xE3, 0x78, 0x11, 0x23, 0x65, 0x5C, 0x5C, 0x50, 0xA4, 0x14, 0x53, 0xD0, 0x44, 0x88, 0x63, 0x1A,
+    0xCA, 0xD8, 0xB3, 0x3A, 0x8A, 0x28, 0x55, 0xAE, 0xE0, 0x28, 0x68, 0x10, 0x12, 0x3D, 0x14, 0x14,
+    0x57, 0xD8, 0xEC, 0xE2, 0x14, 0x14, 0x14, 0xF8, 0x4F, 0x48, 0x71, 0x95, 0xAF, 0x08, 0x65, 0x8A,
+    0x3B, 0xDF, 0xA0, 0x2B, 0x52, 0xD0, 0x8C, 0xA0, 0x48, 0xBB, 0x05, 0x34, 0x47, 0x91, 0x89, 0xB4,
+    0x12, 0xC3, 0x31, 0xEB, 0xE1, 0xBD, 0xD9, 0x33, 0x98, 0x90, 0x36, 0x22, 0x23, 0xEB, 0x93, 0x77,
+    0x7E, 0xBC, 0xEF, 0xBD, 0xEF, 0xFD, 0x00, 0xE8, 0x57, 0x6E, 0x11, 0x64, 0x83, 0x70, 0x86, 0xFF,
+    0x8A, 0x58, 0x02, 0x88, 0x5F, 0xF0, 0x6B, 0x00, 0xDB, 0x4B, 0xC7, 0xD8, 0x41, 0x15, 0x63, 0x84,
+    0xD5, 0x72, 0xB9, 0x06, 0x0F, 0xCC, 0x43, 0x0B, 0xDC, 0x81, 0x03, 0x65, 0x60, 0x01, 0x15, 0xDE,
+    0xC9, 0x3A, 0x04, 0xD6, 0x22, 0x08, 0x32, 0xA7, 0x0D, 0xD9, 0xA4, 0xFD, 0x80, 0x50, 0xA4, 0x7D,
+    0xE2, 0xD2, 0x35, 0x42, 0x04, 0xF8, 0x3E, 0xC7, 0x7D, 0x57, 0x38, 0xC8, 0x9D, 0xB4, 0xC0, 0x9C,
+    0xBE, 0x58, 0x3E, 0xB2, 0x44, 0x61, 0x90, 0x2C, 0xD6, 0x1B, 0x66, 0xB4, 0xC2, 0x1C, 0x10, 0x15,
+    0x48, 0xFC, 0xAF, 0x71, 0x8B, 0xEC, 0xB9, 0x7F, 0xB9, 0x97, 0xAF, 0xCB, 0x29, 0x8F, 0x6D, 0x10,
+    0x31, 0x7A, 0x01, 0x55, 0x73, 0x1D, 0x84, 0x19, 0x6C, 0xEE, 0xD2, 0x73, 0x71, 0xF5, 0xF4, 0x14,
+    0xEF, 0xA2, 0x27, 0xDC, 0xC2, 0xBE, 0xB2, 0xE0, 0xAA, 0xF8, 0xA7, 0xEB, 0x62, 0x74, 0x8F, 0x6F,
+    0x45, 0xBC, 0xB0, 0x43, 0xA6, 0x8E, 0x28, 0x88, 0xE4, 0x71, 0x02, 0x4F, 0xD6, 0x17, 0xF0, 0xE2,
+    0xFA, 0xDF, 0xF4, 0xD8, 0xED, 0x2F, 0x67, 0xF1, 0xCA, 0xCE, 0xFE, 0x2B, 0xD2, 0x61, 0x01, 0x9F,
+    0x41, 0xD6, 0xE6, 0x18, 0x7E, 0xE0, 0xE8, 0xFD, 0x99, 0xC6, 0xBA, 0xD0, 0x14, 0x90, 0x20, 0xC7,
+    0x99, 0x7D, 0x1D, 0xC4, 0x18, 0xC0, 0x6D, 0x78, 0x0F, 0x23, 0x53, 0x18, 0x99, 0xF8, 0xD6, 0x00,
+    0x7F, 0x56, 0x02, 0x43, 0x1E, 0xF2, 0xFA, 0xD5, 0x14, 0x07, 0x64, 0x09, 0x2B, 0xF2, 0x37, 0x8F,
+    0xE4, 0x3A, 0xB7, 0x27, 0xE4, 0x7B, 0x3D, 0x42, 0x54, 0xBD, 0x1A, 0x09, 0xBF, 0x4A, 0x78, 0x9A,
+    0x30, 0x6C, 0x61, 0x72, 0x2D, 0x4B, 0x48, 0x5C, 0xBD, 0x03, 0x1B, 0x2C, 0x48, 0x1A, 0xE2, 0x27,
+    0x24, 0x85, 0x92, 0x6B, 0x1B, 0x94, 0x29, 0x6C, 0x55, 0xFE, 0x43, 0xD2, 0xE3, 0x24, 0xE1, 0xEC,
+    0x45, 0xAA, 0x8C, 0xCC, 0x8F, 0x93, 0xE1, 0xEA, 0x59, 0xD2, 0x96, 0x7A, 0x1B, 0xDE, 0x3C, 0xEA,
+    0xA5, 0x43, 0x71, 0x45, 0x23, 0xAD, 0x30, 0xA2, 0x7C, 0x03, 0x16, 0xDC, 0x54, 0xAC, 0xD5, 0x7B,
+    0xAD, 0xA0, 0xC3, 0x6B, 0x00, 0x6B, 0x10, 0x01, 0x56, 0x9E, 0xFF, 0xEC, 0x66, 0xC5, 0x53, 0x2B,
+    0xEE, 0xE1, 0x83, 0x12, 0x78, 0xFB, 0xAE, 0x0A, 0xD3, 0x49, 0xE5, 0xEF, 0x48, 0x07, 0xC3, 0xF2,
+    0xC6, 0xC1, 0x7D, 0xCC, 0x45, 0x4C, 0x3E, 0x67, 0x0D, 0xFC, 0x68, 0xA4, 0xFA, 0xAD, 0x45, 0x12,
+    0xD5, 0x00, 0x9F, 0x07, 0x7D, 0xDE, 0x0E, 0xD0, 0xD2, 0x8E, 0xAA, 0x83, 0xC6, 0xAF, 0xDC, 0x0F,
+    0x60, 0x3F, 0xFB, 0x90, 0xC5, 0x07, 0xBF, 0x3F, 0x77, 0xD3, 0xF7, 0x15, 0xC6, 0xA1, 0x4B, 0x0D,
+    0xC8, 0x47, 0x4E, 0x71, 0xAF, 0xBB, 0x13, 0xD5, 0xCA, 0x56, 0xFA, 0x71, 0x15, 0x14, 0x99, 0x1C,
+    0x5D, 0x83, 0x09, 0xB3, 0x6A, 0xEE, 0xE5, 0x0F, 0x41, 0xD8, 0x0E, 0x7F, 0xCC, 0x4C, 0xA1, 0x1C,
+    0x60, 0x22, 0x3E, 0x75, 0xFC, 0xA9, 0x3D, 0x15, 0x4F, 0xAC, 0x5C, 0x81, 0x6E, 0x52, 0x79, 0xC1,
+    0x20, 0xCB, 0x9B, 0xC7, 0x5A, 0x9C, 0xBB, 0x20, 0xEF, 0x5A, 0x3F, 0x61, 0xC6, 0x8D, 0x06, 0x70,
+    0x03, 0x78, 0xAC, 0x63, 0xBC, 0x6F, 0x57, 0x5F, 0x82, 0x2F, 0xB3, 0xA4, 0xDF, 0xC3, 0x99, 0x98,
+    0xBB, 0x31, 0xB7, 0x6B, 0xEE, 0x26, 0x90, 0x2D, 0x94, 0xD1, 0x75, 0xC7, 0x9C, 0xA8, 0x4F, 0x0A,
+    0x3B, 0xC6, 0xE3, 0xE1, 0x5E, 0xA7, 0xBF, 0x69, 0x66, 0x85, 0x19, 0xE7, 0x0D, 0x89, 0xC1, 0x9A,
+    0x30, 0x96, 0xFC, 0x81, 0x69, 0x46, 0x30, 0x34, 0x2B, 0xDE, 0x04, 0x7D, 0xD7, 0x3C, 0x4C, 0x1A,
+    0xEB, 0xF3, 0x80, 0xFA, 0xF3, 0xF2, 0x50, 0x7F, 0xDD, 0x55, 0x7B, 0x61, 0x92, 0xF4, 0x86, 0x52,
+    0xF8, 0xC9, 0xF4, 0x70, 0xF7, 0x70, 0x77, 0x3A, 0x55, 0xED, 0xB0, 0xC4, 0x6F, 0xA3, 0xCB, 0xC0,
+    0x1A, 0x95, 0x3B, 0x94, 0xB5, 0x2C, 0xFC, 0x30, 0xC0, 0x09, 0x78, 0xE6, 0x54, 0x7D, 0x13, 0xBB,
+    0xF7, 0x3A, 0x38, 0x5E, 0x8E, 0xE1, 0x0F, 0x16, 0xE7, 0xD8, 0x36, 0xCE, 0x23, 0xD7, 0xB9, 0x3B,
+    0x82, 0xB7, 0xA8, 0xC1, 0xE5, 0x3A, 0xEB, 0x3A, 0x69, 0x2E, 0x7D, 0xF6, 0xBC, 0xAF, 0xBB, 0x2F,
+    0xE0, 0x6D, 0xCB, 0xBE, 0xFB, 0xF5, 0x54, 0x45, 0xAB, 0x3A, 0xCA, 0x52, 0xF6, 0x9F, 0x9C, 0x1C,
+    0x1C, 0x7C, 0xD2, 0xE7, 0xE4, 0x65, 0xA1, 0xC3, 0xCD, 0x54, 0x32, 0x67, 0xD4, 0x74, 0x58, 0x17,
+    0x58, 0x61, 0x29, 0xDD, 0x43, 0xB8, 0xAD, 0x4D, 0x57, 0xCD, 0x3B, 0x9D, 0x05, 0x4C, 0xD2, 0x3B,
+    0xCC, 0xCE, 0x78, 0x53, 0xFD, 0xD4, 0x6E, 0xFA, 0x27, 0x25, 0x38, 0x89, 0x2C, 0x5D, 0xAA, 0xFB,
+    0x94, 0xB1, 0x54, 0xB0, 0x3B, 0xDB, 0x7D, 0x26, 0x88, 0x98, 0x21, 0x78, 0xB8, 0x75, 0xB9, 0xEC,
+    0xA8, 0xBE, 0x45, 0x89, 0xB5, 0xC8, 0x0C, 0xB1, 0x36, 0x69, 0x7C, 0x03, 0x0D, 0x93, 0x7E, 0x0E,
+    0xF4, 0x55, 0xAA, 0x71, 0x60, 0x80, 0x8C, 0x68, 0x93, 0x5F, 0x2E, 0xEB, 0xED, 0x93, 0xEA, 0xAA,
+    0xE6, 0x07, 0xF4, 0x46, 0xD0, 0x49, 0x61, 0xC8, 0x1A, 0x26, 0xFC, 0xA3, 0xE3, 0x36, 0x47, 0x9E,
+    0x40, 0xB0, 0xFE, 0xBB, 0xCD, 0x5B, 0x6C, 0x93, 0x6C, 0xCD, 0xD1, 0xC2, 0xD9, 0x07, 0x68, 0x41,
+    0x96, 0xB3, 0x97, 0x8D, 0xED, 0x58, 0x27, 0x3F, 0xE1, 0xF3, 0x8B, 0xE3, 0x96, 0x5A, 0x6D, 0x4C,
+    0x52, 0x08, 0xE2, 0x64, 0x75, 0xCF, 0xA9, 0xEA, 0xCD, 0x34, 0xEA, 0xBB, 0x72, 0x7D, 0x8C, 0xED,
+    0x5A, 0xE1, 0x88, 0x03, 0x75, 0xB1, 0xDC, 0x3E, 0x49, 0xB3, 0x8B, 0x3A, 0x7D, 0x44, 0x6F, 0xEE,
+    0xD0, 0x89, 0x4C, 0xD6, 0xEA, 0xAC, 0xFB, 0xF8, 0x91, 0xE5, 0xC8, 0xE3, 0x78, 0xD2, 0xE3, 0x35,
+    0x5C, 0x7F, 0x01, 0xD5, 0x54, 0x31, 0x72, 0xDC, 0x46, 0x10, 0x6C, 0x00, 0x92, 0x11, 0xA0, 0x2C,
+    0x38, 0x60, 0xE0, 0xB2, 0x02, 0xA4, 0x4A, 0x5C, 0xF8, 0x80, 0x74, 0x8B, 0x27, 0x38, 0xB0, 0x9C,
+    0x38, 0xF1, 0x0F, 0x98, 0x38, 0xE4, 0x11, 0x78, 0x82, 0x12, 0xF9, 0x11, 0xA7, 0x40, 0x89, 0x02,
+    0x05, 0xBE, 0x03, 0xCA, 0xFA, 0x00, 0x9E, 0x80, 0x80, 0x0F, 0x40, 0x80, 0xE0, 0x48, 0x03, 0xB7,
+    0xEE, 0x9E, 0xC5, 0x51, 0xA4, 0x2C, 0x3F, 0xC0, 0x28, 0xD6, 0xE0, 0x38, 0xBB, 0x98, 0xE9, 0x9E,
+    0xE9, 0x99, 0xC2, 0xF3, 0xC9, 0x64, 0x3E, 0xDD, 0xBD, 0xBF, 0x7B, 0x37, 0x4C, 0xC9, 0x84, 0xE9,
+    0x25, 0x66, 0xBC, 0xCC, 0x51, 0xE3, 0x59, 0x54, 0x15, 0x4D, 0x04, 0x64, 0x3D, 0x00, 0x9E, 0xF0,
+    0x99, 0x9F, 0x56, 0x40, 0x5D, 0x7B, 0xA0, 0xF4, 0x7E, 0x44, 0x76, 0x9B, 0x7A, 0x9D, 0x94, 0x1D,
+    0xBF, 0xE1, 0xBB, 0x06, 0x4E, 0x28, 0x1B, 0xB8, 0x26, 0xEF, 0x91, 0x0F, 0xC9, 0x28, 0xE7, 0x0C,
+    0x2C, 0x68, 0x01, 0x97, 0xFA, 0x19, 0xC5, 0x27, 0xEF, 0xD7, 0x80, 0x23, 0x4D, 0xAC, 0xA8, 0x31,
+    0x6F, 0xFC, 0x98, 0xD2, 0xE4, 0xBC, 0x80, 0xC4, 0xCB, 0xF7, 0xC3, 0x1B, 0x7C, 0x7E, 0x32, 0x26,
+    0x45, 0x31, 0xD0, 0x38, 0x9D, 0xD5, 0x32, 0x4E, 0x17, 0x9E, 0xE0, 0xE1, 0x93, 0x93, 0xC7, 0x90,
+    0xD0, 0x1C, 0xF1, 0xFC, 0x6E, 0xB7, 0x28, 0x78, 0x49, 0xC8, 0xC8, 0x3A, 0x38, 0xC4, 0x23, 0x8A,
+    0x0E, 0x1F, 0x90, 0x0D, 0xB8, 0x38, 0x93, 0x91, 0x71, 0x32, 0x3C, 0x81, 0x4E, 0xF0, 0xF0, 0xA4,
+    0xB6, 0x93, 0xE6, 0x3F, 0x4E, 0x62, 0xF2, 0x90, 0x69, 0xEE, 0xD3, 0x97, 0x7E, 0x90, 0xE3, 0x84,
+    0xE2, 0xEE, 0xD7, 0x13, 0xEA, 0x06, 0xDB, 0x68, 0x01, 0xAE, 0xF4, 0xDD, 0x95, 0x22, 0xFC, 0x9E,
+    0x2B, 0x4B, 0xA9, 0x0F, 0x9C, 0x08, 0xB9, 0xF7, 0xBE, 0x43, 0xED, 0x65, 0x76, 0x3B, 0xA8, 0x42,
+    0xAB, 0xA9, 0xCF, 0xA6, 0x72, 0x0D, 0xE2, 0xDE, 0xF5, 0xAC, 0x55, 0x31, 0xB1, 0x00, 0x99, 0xFF,
+    0xC3, 0x77, 0x4C, 0xC1, 0xCC, 0x97, 0xFE, 0x86, 0x17, 0x7E, 0x3E, 0xE7, 0x6E, 0x4F, 0x15, 0xFD,
+    0xC7, 0x78, 0x89, 0x96, 0x88, 0x45, 0xAE, 0xF6, 0x48, 0x3B, 0x87, 0x68, 0x60, 0x1B, 0x7E, 0x4B,
+    0x84, 0xB9, 0x65, 0xDA, 0x9C, 0x70, 0x40, 0x90, 0xC8, 0x7C, 0x15, 0xAA, 0x18, 0xEB, 0x47, 0x31,
+    0x7E, 0xCF, 0x16, 0xE4, 0x6A, 0x50, 0x87, 0xFC, 0xAF, 0x09, 0xE9, 0x70, 0x60, 0xC6, 0xF2, 0x26,
+    0x3D, 0xA6, 0xAA, 0x65, 0xA1, 0x4F, 0x9E, 0x5A, 0xAD, 0xD8, 0x72, 0xCF, 0x4F, 0x2E, 0xD9, 0xBF,
+    0x7D, 0xA8, 0x88, 0x38, 0x11, 0x6A, 0x7C, 0xE4, 0xCF, 0x3E, 0x54, 0x93, 0xE9, 0xD2, 0x31, 0x10,
+    0x5D, 0x42, 0x9B, 0x55, 0xDE, 0xEB, 0x47, 0x97, 0x08, 0x12, 0xAD, 0xAF, 0x32, 0xBF, 0xAC, 0x04,
+    0x92, 0x31, 0xEF, 0xE2, 0x25, 0x67, 0xFC, 0x44, 0xF8, 0x3F, 0x3E, 0x6A, 0xAC, 0x25, 0xCE, 0xA5,
+    0x0B, 0x65, 0x96, 0x7A, 0xAC, 0x19, 0xF3, 0x5A, 0x26, 0x65, 0x52, 0x5C, 0x53, 0xD4, 0xD7, 0x9C,
+    0xCA, 0x26, 0x00, 0xFF, 0x72, 0x66, 0x8C, 0xB9, 0x62, 0x30, 0xED, 0xE5, 0xA4, 0x8B, 0xA8, 0xAD,
+    0xD6, 0xEB, 0x38, 0xC8, 0x2C, 0xE7, 0xBE, 0x5B, 0x18, 0x91, 0x08, 0xB2, 0x35, 0x0C, 0x96, 0x53,
+    0x74, 0x83, 0x48, 0x14, 0xDC, 0x6A, 0x12, 0x4C, 0xF1, 0x45, 0xC7, 0xEF, 0xBB, 0x7B, 0xB8, 0x8F,
+    0xC9, 0x70, 0x2F, 0x14, 0xA4, 0x6E, 0xF9, 0x69, 0x2D, 0x39, 0x95, 0xC7, 0x87, 0xC4, 0xBD, 0x57,
+    0x48, 0x6F, 0x4D, 0x27, 0xFF, 0xB7, 0x06, 0x0E, 0x7F, 0x06, 0x21, 0xC6, 0x63, 0x3A, 0x18, 0xF8,
+    0xA6, 0x34, 0xF7, 0xD5, 0xD9, 0x6D, 0xB0, 0xE8, 0x36, 0x14, 0x78, 0x85, 0xEB, 0x9F, 0xCC, 0x1D,
+    0xF4, 0x4A, 0xB7, 0x45, 0xDD, 0x12, 0x50, 0xDD, 0xD3, 0x4D, 0x62, 0x54, 0x5A, 0x5E, 0x91, 0x42,
+    0xAD, 0xD8, 0x0C, 0xC6, 0x71, 0x1E, 0x68, 0xC8, 0xCC, 0x89, 0x63, 0xD9, 0x90, 0x32, 0xD9, 0x2C,
+    0xDF, 0x72, 0xD4, 0x0F, 0xE4, 0x5A, 0xF3, 0xC2, 0xED, 0x2F, 0x3E, 0xF6, 0x5D, 0xA4, 0xA9, 0xE3,
+    0xF4, 0x32, 0xE6, 0x0D, 0xA2, 0xCF, 0xC0, 0x87, 0x82, 0x4D, 0x23, 0x70, 0xF6, 0xB9, 0xB1, 0xC6,
+    0x95, 0x22, 0xB2, 0xB7, 0x3F, 0xD5, 0xCE, 0x20, 0x12, 0x9F, 0x41, 0xAC, 0x43, 0x71, 0x58, 0x5C,
+    0x15, 0x44, 0x65, 0xB4, 0x1D, 0xE1, 0xD6, 0xC2, 0x89, 0xBE, 0x7F, 0x83, 0xD4, 0xDE, 0x44, 0xF3,
+    0xF6, 0xF5, 0x65, 0x73, 0x39, 0xAA, 0x33, 0x7B, 0x14, 0xBD, 0xD6, 0x0C, 0x71, 0x56, 0x85, 0x05,
+    0x3B, 0xA8, 0x75, 0xD7, 0xCC, 0xC0, 0x60, 0xFC, 0xCB, 0x3B, 0xAD, 0xA2, 0x9E, 0x19, 0x14, 0x0C,
+    0xE9, 0x44, 0xB2, 0xD1, 0xF2, 0xBA, 0xAD, 0x5A, 0x21, 0xF3, 0x63, 0xE6, 0xE7, 0x44, 0x2A, 0x3F,
+    0x3F, 0x85, 0x52, 0xC4, 0x96, 0xC7, 0xED, 0xFC, 0xEE, 0x90, 0xF4, 0x79, 0x9F, 0xF4, 0xB6, 0x13,
+    0x93, 0xAE, 0xE8, 0x92, 0xEE, 0x82, 0x08, 0xBF, 0x5B, 0xBB, 0x1A, 0x76, 0x82, 0xFB, 0xE6, 0x96,
+    0x1A, 0xF8, 0xDB, 0x9B, 0xA6, 0xB5, 0x15, 0x8F, 0x9A, 0xE3, 0x45, 0xA7, 0xC4, 0xE3, 0x2A, 0x66,
+    0xB4, 0x12, 0xAA, 0x94, 0x9A, 0x2E, 0x21, 0xD9, 0xCB, 0x45, 0x58, 0xBA, 0xC8, 0x0A, 0x46, 0x7E,
+    0xA6, 0xC6, 0x9D, 0xB7, 0x76, 0xC1, 0x7A, 0x09, 0x6B, 0x61, 0x6C, 0x0D, 0x4D, 0xAD, 0xF9, 0x59,
+    0xB0, 0x86, 0x35, 0xAA, 0x1E, 0x0D, 0xC8, 0x85, 0x49, 0xB7, 0xED, 0x12, 0x8A, 0x99, 0x08, 0x9E,
+    0x4F, 0xE0, 0xBF, 0x6C, 0xD9, 0xE9, 0x89, 0x80, 0xEC, 0xAD, 0x94, 0x5B, 0x13, 0xE4, 0xC6, 0xA4,
+    0xBA, 0x31, 0xF0, 0xA5, 0xA9, 0x30, 0x37, 0x0E, 0x5A, 0x10, 0xB0, 0x96, 0xF1, 0x78, 0xB1, 0x63,
+    0x53, 0xEF, 0x6C, 0x1C, 0x6B, 0x53, 0x6C, 0xA1, 0xB5, 0xCE, 0x63, 0x81, 0xD2, 0xB6, 0xAF, 0xA4,
+    0xE1, 0x5C, 0xE2, 0x45, 0xE4, 0x6D, 0x23, 0x96, 0x92, 0x58, 0x17, 0x9F, 0x0C, 0xD4, 0xA3, 0xED,
+    0xFC, 0x2C, 0xBC, 0x6C, 0x54, 0xA0, 0xEB, 0x61, 0x67, 0x4E, 0xEB, 0xFE, 0x0A, 0xAF, 0x2F, 0x58,
+    0x85, 0xB9, 0x24, 0x2F, 0x6F, 0xC4, 0xA8, 0x29, 0x31, 0x03, 0x47, 0x40, 0x03, 0xB8, 0x2E, 0x98,
+    0x32, 0x6C, 0x94, 0x32, 0xEC, 0x99, 0x72, 0xB6, 0x49, 0x74, 0x07, 0x43, 0xE8, 0x74, 0x67, 0xC6,
+    0x26, 0x6C, 0x9D, 0x4D, 0xD8, 0x45, 0x1B, 0x9B, 0x7C, 0x96, 0xC0, 0xEE, 0x6C, 0xA5, 0x76, 0xCC,
+    0x5B, 0x1B, 0xDD, 0x7A, 0x1B, 0xF6, 0xD5, 0x12, 0xB6, 0xC3, 0x6C, 0x83, 0xAA, 0xFD, 0xE9, 0x8C,
+    0xEA, 0x79, 0xDB, 0xA5, 0x13, 0xC9, 0x2E, 0x5A, 0xF8, 0xE2, 0x5C, 0xF8, 0x09, 0xFF, 0xD3, 0xE7,
+    0x1F, 0x9D, 0x55, 0xBD, 0x8E, 0xDD, 0x44, 0x14, 0x3E, 0xB6, 0xD1, 0xBA, 0xB0, 0xD0, 0x6C, 0x41,
+    0x81, 0x14, 0x09, 0xBF, 0x01, 0xF3, 0x02, 0xD9, 0xD8, 0x88, 0x07, 0x08, 0x14, 0xA1, 0x20, 0x05,
+    0x8F, 0xB0, 0x2D, 0xC5, 0xEE, 0xF5, 0x88, 0xBC, 0x00, 0x4F, 0x91, 0x62, 0xB7, 0x48, 0x43, 0x41,
+    0xB1, 0x7B, 0x3D, 0x12, 0x25, 0x8D, 0xE1, 0x05, 0x70, 0x01, 0xCD, 0x36, 0x18, 0x32, 0x91, 0x1C,
+    0x69, 0x7C, 0x87, 0xEF, 0x3B, 0xB3, 0x81, 0x84, 0x6C, 0x9A, 0x58, 0x57, 0x73, 0xEF, 0x1D, 0x9F,
+    0x9F, 0xEF, 0x7C, 0xE7, 0x9B, 0x33, 0x22, 0xB7, 0x4F, 0xE1, 0x45, 0x5A, 0x31, 0xF8, 0x15, 0xE5,
+    0x5B, 0x91, 0x2A, 0x34, 0xD8, 0x68, 0xD2, 0x26, 0x5C, 0x9D, 0xBC, 0xF5, 0x54, 0xE9, 0x20, 0x63,
+    0x7A, 0x98, 0x42, 0x95, 0x62, 0x0D, 0xAB, 0xBD, 0x34, 0xB3, 0x54, 0x8B, 0xB4, 0x5E, 0x6C, 0x2F,
+    0x9D, 0xC8, 0x2A, 0xB2, 0x89, 0xF1, 0x52, 0xAE, 0x72, 0x2E, 0x52, 0x2F, 0xD5, 0x2C, 0xF8, 0x6B,
+    0xE1, 0x6A, 0x3F, 0x0B, 0x58, 0x77, 0x86, 0x51, 0xE3, 0x19, 0x63, 0x3D, 0x9F, 0x98, 0xE6, 0xC0,
+    0xB8, 0xED, 0xC2, 0xB5, 0xEB, 0xB9, 0xAE, 0x5C, 0x88, 0x43, 0xA6, 0x2B, 0xC5, 0x41, 0xB3, 0x8E,
+    0x90, 0x64, 0xE0, 0xAE, 0x1C, 0x67, 0x2C, 0x5D, 0x9A, 0xDB, 0x14, 0x24, 0xA5, 0x7E, 0x48, 0x5E,
+    0x4E, 0x27, 0x69, 0x91, 0xEB, 0x5A, 0x88, 0xA2, 0x0A, 0x52, 0x44, 0x26, 0x26, 0x3C, 0x19, 0x34,
+    0x32, 0x10, 0x09, 0xF7, 0x26, 0xE2, 0xA5, 0x51, 0xEB, 0x74, 0x63, 0x4F, 0x98, 0xF4, 0x10, 0xEB,
+    0xE8, 0x01, 0xFC, 0xF4, 0x80, 0x11, 0x3D, 0x50, 0x58, 0x83, 0xFC, 0x3B, 0xF5, 0x28, 0xC3, 0xAB,
+    0x10, 0x75, 0x0E, 0x01, 0x8F, 0xE2, 0xF0, 0xE8, 0x2B, 0x94, 0x30, 0x26, 0x3C, 0xBE, 0xE1, 0x9A,
+    0x80, 0xCD, 0xCC, 0x19, 0x62, 0x46, 0x1A, 0x33, 0x77, 0x79, 0xCF, 0xE4, 0xBD, 0xFB, 0xF9, 0x6B,
+    0xFA, 0x1F, 0xC1, 0xC7, 0xAF, 0x39, 0x24, 0x5D, 0x07, 0x35, 0xE9, 0x48, 0x9E, 0xD8, 0x9D, 0x46,
+    0x78, 0x48, 0x1A, 0x9A, 0x9F, 0xC8, 0x59, 0x35, 0x45, 0x0D, 0x0D, 0xF6, 0xA5, 0x58, 0x58, 0xAD,
+    0xAC, 0x2C, 0x5D, 0xAE, 0x34, 0xF9, 0x03, 0xAD, 0xC8, 0x5E, 0x5C, 0xC2, 0xDD, 0x24, 0x34, 0x4F,
+    0xCC, 0xCD, 0xC5, 0xE8, 0xA5, 0xD6, 0x12, 0x48, 0x44, 0xD4, 0xAA, 0xC0, 0x4F, 0x54, 0xD4, 0xE0,
+    0xAF, 0x8A, 0x25, 0x68, 0xBD, 0x97, 0xFE, 0x86, 0xB9, 0x49, 0x11, 0x3C, 0xA3, 0x24, 0xC3, 0xF2,
+    0xE4, 0xF4, 0xE6, 0x72, 0x21, 0x1F, 0x2B, 0x5D, 0x4F, 0xE8, 0x6C, 0x48, 0x56, 0xA1, 0x4C, 0x28,
+    0x31, 0x70, 0x7F, 0xC1, 0x2E, 0xA6, 0xF4, 0x3B, 0xDE, 0x24, 0x68, 0xC8, 0xBA, 0x36, 0xF0, 0xCD,
+    0x48, 0x1F, 0xE3, 0x01, 0x0E, 0xDF, 0x3B, 0xFA, 0xC2, 0x67, 0xE0, 0x9B, 0xAE, 0xC7, 0x8E, 0xF5,
+    0xC5, 0xF6, 0x68, 0x54, 0x06, 0x1D, 0x96, 0x97, 0x6F, 0xB0, 0x72, 0x8F, 0x81, 0x40, 0xF1, 0x22,
+    0x4F, 0xD7, 0x26, 0xB2, 0x59, 0x1B, 0xA3, 0xEC, 0xF3, 0x52, 0x13, 0x36, 0x50, 0x01, 0xCD, 0x54,
+    0x32, 0x17, 0x68, 0x00, 0xDE, 0x5E, 0xDA, 0x04, 0xED, 0xD8, 0x1E, 0xF9, 0x3B, 0x29, 0x23, 0x09,
+    0x89, 0x6C, 0x6D, 0xCC, 0xE9, 0xAF, 0xA9, 0x11, 0x0D, 0x16, 0xA5, 0x59, 0x8A, 0xED, 0xCB, 0xC1,
+    0xDB, 0xA4, 0xFA, 0x4E, 0xDF, 0xCB, 0x2B, 0x89, 0x21, 0x31, 0x4B, 0x9F, 0x59, 0x7A, 0x60, 0x92,
+    0x2B, 0xE6, 0xB4, 0xF4, 0x87, 0x44, 0x07, 0x29, 0x27, 0x96, 0xF1, 0xC5, 0x6D, 0xE9, 0xCB, 0xBF,
+    0xCD, 0x1B, 0xB4, 0x5D, 0xFF, 0x91, 0xC2, 0x37, 0xDA, 0x17, 0xD9, 0xBD, 0xEB, 0x4D, 0x03, 0xAE,
+    0xB1, 0xE8, 0x79, 0x20, 0x74, 0x54, 0xAB, 0xB2, 0x82, 0x69, 0xFB, 0xC7, 0x29, 0x6D, 0x4F, 0xD4,
+    0xB9, 0x58, 0xD8, 0x31, 0xA4, 0xA7, 0x30, 0xD1, 0x61, 0x15, 0x59, 0xD0, 0xB4, 0x8D, 0xAF, 0x67,
+    0xDD, 0xCB, 0x72, 0xD0, 0x3D, 0xE3, 0x34, 0xC5, 0xB9, 0x2A, 0x21, 0x53, 0x2F, 0x6D, 0xAF, 0x21,
+    0xA2, 0xEE, 0x41, 0x0B, 0x59, 0x2A, 0x05, 0xF4, 0x5E, 0x6A, 0x7F, 0x79, 0x36, 0x10, 0xE2, 0x08,
+    0xDA, 0xDE, 0xD8, 0x4B, 0x3C, 0x53, 0xAD, 0x5F, 0x3D, 0x91, 0x17, 0x24, 0x0F, 0x8E, 0x73, 0xB9,
+    0x68, 0x30, 0x3D, 0xAC, 0x57, 0xF2, 0x29, 0xD6, 0x72, 0x96, 0x1F, 0x98, 0xB4, 0x2F, 0x59, 0xE1,
+    0xC7, 0x77, 0x73, 0x78, 0xA2, 0x52, 0x60, 0xFE, 0xCA, 0xDD, 0xC9, 0x94, 0x1C, 0x2E, 0x57, 0xCA,
+    0x07, 0xC9, 0xED, 0xCD, 0xC5, 0x9D, 0x1C, 0x1E, 0xD3, 0xE7, 0x3E, 0xDF, 0xB4, 0x1A, 0xCD, 0x15,
+    0xDB, 0xD7, 0xCF, 0x26, 0xCA, 0x67, 0xE1, 0x02, 0xF7, 0x42, 0xA7, 0x09, 0x7B, 0xB3, 0x22, 0x94,
+    0x83, 0x6E, 0xCC, 0x06, 0x42, 0xFB, 0x0E, 0x3F, 0x92, 0xD4, 0x98, 0x1C, 0x51, 0x3E, 0x68, 0x5D,
+    0x3D, 0x57, 0xEB, 0x71, 0xA6, 0x53, 0x09, 0xAD, 0x26, 0xE3, 0x5B, 0xBA, 0x96, 0x8B, 0xF1, 0x0F,
+    0x34, 0xC4, 0x62, 0x9C, 0x0E, 0x25, 0xF9, 0xB1, 0xFD, 0x4E, 0xE1, 0xC9, 0x99, 0xFD, 0xDC, 0xE7,
+    0x33, 0x9A, 0xF2, 0x98, 0x2C, 0xF5, 0x7C, 0x90, 0x94, 0xB0, 0x53, 0xB4, 0x40, 0x76, 0x5E, 0xE7,
+    0xA9, 0xE6, 0xAF, 0xAB, 0x90, 0xCF, 0x73, 0x2C, 0x09, 0xBF, 0xDC, 0x50, 0xB9, 0x8E, 0xD8, 0x15,
+    0x94, 0x8F, 0x2C, 0x7F, 0x46, 0x3F, 0x06, 0x24, 0x1D, 0x3D, 0x28, 0xED, 0x30, 0x3E, 0x93, 0x16,
+    0x85, 0x0F, 0x14, 0x9B, 0x7A, 0x60, 0xB7, 0x33, 0x72, 0x49, 0x79, 0xE0, 0x61, 0x7B, 0x6D, 0x08,
+    0x1E, 0xA1, 0x52, 0x90, 0xEB, 0xAB, 0x97, 0x8F, 0x23, 0x44, 0x30, 0xC8, 0x19, 0x12, 0x7F, 0x82,
+    0x33, 0x5D, 0xE9, 0x89, 0x56, 0x76, 0x39, 0x56, 0x07, 0x87, 0x46, 0xF4, 0x30, 0x9D, 0xA5, 0x78,
+    0x4C, 0x89, 0x59, 0x80, 0xAC, 0x58, 0xD5, 0x9E, 0x7F, 0x9E, 0x78, 0x31, 0xBF, 0x2E, 0x98, 0x09,
+    0x07, 0x14, 0x60, 0xC3, 0x37, 0x6B, 0x95, 0x30, 0x03, 0x2C, 0xAC, 0xE5, 0xA3, 0xDB, 0x59, 0x5B,
+    0xEA, 0x14, 0xE0, 0xBC, 0x75, 0x1C, 0xB6, 0x28, 0x42, 0x95, 0xB2, 0xD7, 0x69, 0x2B, 0x63, 0xAF,
+    0xC2, 0xC7, 0x68, 0x61, 0xCA, 0x71, 0xD1, 0x96, 0x1E, 0x56, 0x6D, 0x5D, 0xDC, 0x6B, 0xF3, 0xD6,
+    0x4E, 0x6D, 0x56, 0xA3, 0x36, 0x6B, 0xAD, 0x36, 0x2B, 0x87, 0xAC, 0xF9, 0x25, 0xE8, 0xE0, 0xF9,
+    0x2B, 0x10, 0x6B, 0xB1, 0x05, 0xD5, 0xE5, 0x10, 0x74, 0xCC, 0xDA, 0x3C, 0x88, 0xC1, 0x05, 0x39,
+    0xBB, 0x9D, 0xDD, 0x94, 0x41, 0x3B, 0xE1, 0xB4, 0x04, 0x74, 0xD4, 0xF1, 0xE4, 0x0C, 0xE9, 0xCD,
+    0x51, 0xFA, 0xA1, 0xF6, 0xA0, 0xAF, 0x9D, 0x0A, 0xB5, 0xF2, 0xAA, 0x9D, 0x3C, 0x82, 0xBB, 0x34,
+    0xE7, 0xBB, 0x6C, 0x92, 0x77, 0x3C, 0xBC, 0xE6, 0x2C, 0xCE, 0x1F, 0xF4, 0x6E, 0x40, 0xF0, 0xD1,
+    0x96, 0xF9, 0x02, 0x46, 0x4E, 0x58, 0x60, 0x6C, 0x42, 0xBE, 0x5D, 0xA2, 0x5E, 0x1E, 0x0D, 0x26,
+    0x35, 0x30, 0x9A, 0x3F, 0x9D, 0xDE, 0x7E, 0x3F, 0xD3, 0x46, 0xCC, 0x13, 0xB5, 0x31, 0x4E, 0x6D,
+    0x8C, 0x1B, 0x68, 0x63, 0x1C, 0x95, 0xBE, 0xE1, 0xC8, 0x20, 0x5C, 0xD7, 0xF6, 0xA4, 0xAE, 0xFD,
+    0x4D, 0x5B, 0x55, 0xA3, 0x3D, 0xB4, 0x49, 0xF9, 0x34, 0xA4, 0xAC, 0xFA, 0x2E, 0x97, 0x8C, 0x6B,
+    0xA8, 0xD8, 0x38, 0x0E, 0xFA, 0x06, 0x78, 0xC6, 0xE4, 0x6B, 0xBD, 0xA3, 0xDF, 0xF7, 0xF9, 0x07,
+    0xAD, 0x55, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x1D, 0x92, 0x46, 0x36, 0x30, 0x11, 0x6C, 0x13, 0x20,
+    0x80, 0x5D, 0xEC, 0x27, 0xB0, 0x75, 0x21, 0x6B, 0x99, 0x34, 0x69, 0xD3, 0xC8, 0x8D, 0x3F, 0x42,
+    0x8D, 0x4B, 0x49, 0xA4, 0x6B, 0x37, 0x6E, 0xF2, 0x07, 0x81, 0x61, 0xDC, 0x37, 0xE8, 0x8E, 0x04,
+    0x82, 0x20, 0x2D, 0x3F, 0x81, 0x45, 0x90, 0x22, 0x15, 0x91, 0xB0, 0xA0, 0x83, 0x25, 0x37, 0xEF,
+    0xCD, 0xF2, 0x14, 0x3B, 0x70, 0x99, 0x2B, 0x66, 0xA5, 0xDB, 0xD9, 0x99, 0x37, 0xEF, 0xCD, 0xCC,
+    0x89, 0xE0, 0xF3, 0xB5, 0xD8, 0xB8, 0x48, 0xD7, 0x17, 0x71, 0x95, 0x38, 0xC9, 0xD3, 0x59, 0xF0,
+    0x6F, 0x3E, 0xCB, 0xF6, 0x48, 0x64, 0x95, 0x23, 0x3C, 0xBC, 0xDC, 0xC2, 0xBA, 0xFE, 0x12, 0xB6,
+    0x1C, 0x69, 0x8B, 0xB9, 0xE2, 0xD3, 0x60, 0x69, 0x7D, 0xD7, 0xF2, 0x1A, 0x6F, 0x79, 0xBD, 0xEA,
+    0xB5, 0xEB, 0x79, 0x5D, 0xCC, 0xB0, 0x8D, 0x9C, 0x78, 0xDD, 0xDA, 0x81, 0xD7, 0x79, 0xE0, 0xB5,
+    0x34, 0x35, 0xAE, 0xC5, 0x4E, 0xBC, 0xCE, 0xA2, 0xE4, 0x31, 0x4A, 0x35, 0xC1, 0xF6, 0xF9, 0xC6,
+    0x90, 0xF2, 0x48, 0x03, 0xC7, 0x18, 0x07, 0x29, 0x60, 0xF1, 0xE8, 0x8B, 0x0F, 0x2F, 0x17, 0x7C,
+    0x57, 0x01, 0x0D, 0x22, 0x4C, 0x86, 0xD9, 0x2E, 0x35, 0xB4, 0xE9, 0x19, 0x5A, 0xEE, 0x11, 0x50,
+    0xC4, 0xB6, 0x16, 0xA9, 0xB3, 0x39, 0x4B, 0xCE, 0x15, 0xA0, 0x15, 0xA3, 0xE2, 0xB8, 0xD5, 0x97,
+    0xB6, 0xD7, 0x97, 0xB3, 0xBE, 0xAC, 0xA4, 0x1C, 0x78, 0x2F, 0x04, 0x0D, 0x38, 0x78, 0x59, 0xD5,
+    0x59, 0x90, 0xE2, 0xFB, 0x89, 0x2F, 0x1B, 0xFC, 0xB5, 0x48, 0x19, 0xC5, 0x00, 0x40, 0xD3, 0x0B,
+    0xE0, 0x49, 0xAD, 0xF0, 0x00, 0x0A, 0x51, 0xBA, 0x55, 0xCF, 0x0C, 0x7C, 0x89, 0x9F, 0xF1, 0x77,
+    0xAB, 0xA7, 0x89, 0x70, 0xBA, 0x5B, 0xC4, 0x76, 0x38, 0x8F, 0x8B, 0x38, 0xE6, 0x5D, 0x82, 0x5C,
+    0x7A, 0x02, 0x0B, 0x72, 0x8F, 0x33, 0x9F, 0x82, 0xCC, 0x9E, 0x85, 0x1C, 0xF3, 0x89, 0xE7, 0x78,
+    0x2C, 0x06, 0xCF, 0x5A, 0xEE, 0xCA, 0xFE, 0x8E, 0x30, 0xBD, 0x15, 0x9E, 0xAD, 0xBF, 0xE4, 0xE9,
+    0x6A, 0x7F, 0x43, 0xC8, 0xA8, 0x68, 0xA6, 0x26, 0x1E, 0x74, 0xF1, 0xBC, 0x15, 0x37, 0xF0, 0xBC,
+    0x27, 0xF8, 0xA0, 0x45, 0xD0, 0x68, 0xF5, 0xA8, 0xAA, 0x02, 0x62, 0x28, 0x33, 0x34, 0x3C, 0x3D,
+    0xC8, 0xF4, 0x71, 0x24, 0xD7, 0x36, 0x42, 0x65, 0xC0, 0xBD, 0x1E, 0x24, 0x47, 0xED, 0x64, 0xE1,
+    0xA4, 0xBA, 0x88, 0x57, 0x61, 0x94, 0x8A, 0x86, 0xF0, 0x84, 0x44, 0x30, 0x9C, 0xDD, 0x7D, 0xA6,
+    0xE4, 0x03, 0x51, 0x18, 0xB3, 0xC1, 0x41, 0x9F, 0x1F, 0xAF, 0x5E, 0xEC, 0x3E, 0xC7, 0x07, 0x9F,
+    0x6C, 0x8F, 0x03, 0xF8, 0x26, 0xC5, 0xC9, 0x77, 0x9F, 0x75, 0xF7, 0x11, 0xF5, 0x41, 0x05, 0x25,
+    0xF0, 0x74, 0xB1, 0x2D, 0xC9, 0x73, 0x1C, 0xE4, 0xFC, 0xE9, 0xC8, 0x64, 0xC5, 0x44, 0x66, 0xBB,
+    0x82, 0x6D, 0xA0, 0x49, 0x6B, 0x80, 0xB2, 0x13, 0x0F, 0xAE, 0x37, 0x36, 0x53, 0x1E, 0x98, 0xA3,
+    0x9C, 0x3A, 0x36, 0xD9, 0xCF, 0xDA, 0x70, 0xDA, 0x01, 0xA1, 0x61, 0x3B, 0xFE, 0xC9, 0x9E, 0xF0,
+    0x6F, 0x28, 0xF9, 0x5A, 0xF5, 0x04, 0x42, 0x3F, 0xFF, 0x3A, 0xD0, 0x83, 0xF5, 0xDA, 0x81, 0x4D,
+    0xB8, 0x89, 0x1B, 0xC5, 0x41, 0xF4, 0xF9, 0x9B, 0x4D, 0x33, 0x0E, 0xA4, 0x8D, 0xC1, 0xE4, 0x87,
+    0x73, 0x27, 0x42, 0xE5, 0x98, 0xAA, 0xBE, 0xFE, 0xE3, 0xD0, 0x8D, 0x92, 0x64, 0x20, 0x69, 0x7B,
+    0xA1, 0x66, 0x54, 0xCE, 0xF6, 0x3A, 0x57, 0x2D, 0x75, 0x2F, 0x93, 0xE3, 0x10, 0x94, 0x3F, 0x30,
+    0x81, 0xD9, 0xA2, 0x13, 0x51, 0xAE, 0x29, 0xC4, 0x94, 0x78, 0xE8, 0x31, 0x1F, 0x4A, 0x17, 0xC8,
+    0x63, 0x88, 0xF0, 0x9F, 0x10, 0x59, 0x0A, 0x01, 0x56, 0xA0, 0x27, 0xB8, 0xC2, 0x64, 0x9C, 0x99,
+    0x7A, 0x4A, 0x35, 0xBB, 0x08, 0xC8, 0xEF, 0x16, 0x13, 0x74, 0x7C, 0xF9, 0xB0, 0x49, 0xC6, 0xD0,
+    0x20, 0xF6, 0x1D, 0xE3, 0xAD, 0xC8, 0x8C, 0xE8, 0xB6, 0x2F, 0x27, 0x71, 0xBF, 0x74, 0x3D, 0xCA,
+    0x25, 0x8C, 0xF8, 0x56, 0xD3, 0x68, 0x09, 0x0A, 0x42, 0x73, 0x29, 0x44, 0x45, 0xA2, 0xD9, 0xE1,
+    0xCB, 0xBE, 0xD7, 0x51, 0x4F, 0x9F, 0xEB, 0xF8, 0x1B, 0xA7, 0x17, 0x04, 0xFE, 0xFD, 0x72, 0xA3,
+    0x40, 0xB7, 0x19, 0x5E, 0xDC, 0x90, 0xDA, 0x1B, 0x56, 0xF3, 0x8A, 0x65, 0xEA, 0x18, 0x6A, 0xDB,
+    0x7C, 0x94, 0x42, 0x4D, 0xF7, 0x60, 0xFE, 0xFD, 0xCE, 0xAB, 0x33, 0x14, 0x18, 0x1D, 0xA6, 0x6F,
+    0x28, 0xE3, 0x21, 0xB6, 0x48, 0xB1, 0x32, 0xD9, 0x90, 0x14, 0x71, 0x14, 0xA2, 0xA2, 0xF1, 0x87,
+    0xEE, 0x70, 0xE2, 0x1E, 0x78, 0x7E, 0x01, 0x41, 0x2E, 0x2E, 0x80, 0xF7, 0xE2, 0x19, 0xF0, 0xBE,
+    0x4A, 0x78, 0x49, 0xA3, 0xF6, 0xB5, 0xD2, 0x98, 0x8C, 0x49, 0x8B, 0x4A, 0x52, 0x2F, 0xAA, 0x0E,
+    0xC9, 0xB8, 0xF6, 0x13, 0xA8, 0xDC, 0x51, 0xEC, 0x48, 0x14, 0x1D, 0x48, 0xD0, 0x88, 0x2E, 0x8D,
+    0xB1, 0xF6, 0xB1, 0x6F, 0x06, 0xBE, 0x3F, 0xB1, 0x9A, 0x4C, 0xC9, 0x46, 0x5C, 0xDB, 0x32, 0x1C,
+    0xBD, 0x5B, 0x33, 0xB0, 0x12, 0xEE, 0xC9, 0x90, 0x23, 0x57, 0x3E, 0x3B, 0x44, 0x32, 0x23, 0xA1,
+    0xD8, 0x5F, 0x99, 0xC8, 0x3F, 0xD7, 0xB2, 0x09, 0x21, 0x53, 0x09, 0x15, 0x21, 0x43, 0xE8, 0x1E,
+    0x13, 0xF9, 0xAA, 0xA4, 0x5B, 0xA7, 0xBB, 0x54, 0x6B, 0x36, 0x2C, 0x46, 0xB2, 0x9D, 0xF4, 0xC7,
+    0x87, 0xF7, 0x74, 0x4F, 0x32, 0xA8, 0x4A, 0xBA, 0xA7, 0xE5, 0xC9, 0xF6, 0x13, 0x21, 0x03, 0xA4,
+    0x34, 0xBF, 0xAF, 0xDD, 0x98, 0x6D, 0xD9, 0x5C, 0xCE, 0x66, 0xCA, 0xA7, 0x7C, 0xB1, 0x43, 0x31,
+    0x65, 0xC1, 0xF5, 0x80, 0x1A, 0xAA, 0x1A, 0xBD, 0x1A, 0x7C, 0x6D, 0x86, 0x2C, 0x78, 0x29, 0xD1,
+    0x0E, 0xBE, 0xB6, 0x7D, 0x31, 0x7B, 0x2C, 0xCF, 0x72, 0xAC, 0x7A, 0xD7, 0x56, 0xBD, 0x9D, 0xDD,
+    0x77, 0x51, 0x97, 0xEF, 0xC2, 0x31, 0xDF, 0xEA, 0xB3, 0x3C, 0xA9, 0x37, 0xB2, 0x53, 0xFD, 0xB0,
+    0xF4, 0x9F, 0x1C, 0xDE, 0x2A, 0x9C, 0x85, 0x88, 0xD0, 0x9A, 0x1E, 0xBD, 0xE8, 0x66, 0xB1, 0xA8,
+    0x0F, 0x33, 0xA7, 0xBF, 0x20, 0xB5, 0xF2, 0xDD, 0xA5, 0xB7, 0xA1, 0x18, 0x55, 0x1A, 0xED, 0x85,
+    0xE2, 0x2F, 0xAD, 0xA2, 0x4C, 0xAD, 0x6C, 0x53, 0x67, 0xF9, 0x3E, 0x2D, 0x59, 0xDD, 0xB6, 0x5E,
+    0xD3, 0xE6, 0x93, 0x76, 0x62, 0xF5, 0xAD, 0xCA, 0x3A, 0x2B, 0x63, 0xAE, 0xA5, 0x96, 0x90, 0x80,
+    0x42, 0x42, 0x42, 0xCE, 0xC8, 0xAA, 0x0D, 0x84, 0x19, 0xC1, 0xFC, 0x1A, 0xFE, 0xA4, 0xA5, 0xD5,
+    0x37, 0x3A, 0x5D, 0x79, 0x9C, 0x1C, 0x6E, 0x3D, 0xF7, 0x99, 0xF9, 0x2D, 0xD3, 0xFC, 0x7E, 0x76,
+    0xF8, 0xDA, 0x8F, 0xE6, 0xB7, 0xF8, 0x64, 0x7E, 0xD3, 0x96, 0xE4, 0x0B, 0xCE, 0xEF, 0x90, 0xE6,
+    0x57, 0x74, 0xC8, 0x53, 0x08, 0x93, 0x42, 0x70, 0x8D, 0x6E, 0x57, 0x2F, 0xC0, 0x63, 0xC7, 0xBE,
+    0x1D, 0x4B, 0x5D, 0x26, 0xAA, 0x78, 0x9A, 0xB1, 0xD4, 0x9C, 0xE7, 0x2E, 0xD0, 0x9F, 0x5C, 0xD4,
+    0x96, 0xBE, 0x33, 0xE9, 0xBB, 0x2F, 0xE5, 0xFF, 0xFD, 0xFC, 0x03, 0xD5, 0x55, 0xB1, 0x8E, 0xE4,
+    0x44, 0x10, 0x2D, 0xDB, 0xB0, 0x46, 0xEA, 0xC0, 0x04, 0x48, 0x20, 0x5D, 0x60, 0x42, 0x32, 0xA7,
+    0x04, 0xA7, 0xB3, 0x05, 0x01, 0x29, 0x01, 0xAB, 0x0D, 0x2E, 0xB8, 0x4F, 0xD8, 0x1F, 0xE0, 0xA6,
+    0x2D, 0x11, 0x90, 0x92, 0x40, 0x42, 0x0A, 0xC9, 0x11, 0x90, 0x12, 0xAC, 0xC7, 0x16, 0x29, 0x89,
+    0x41, 0x9C, 0x08, 0x71, 0x70, 0x97, 0x90, 0x60, 0x41, 0x9F, 0xE4, 0x3B, 0xDA, 0x2E, 0xDE, 0x2B,
+    0xCF, 0xAC, 0x56, 0xE2, 0x0B, 0xF0, 0xEE, 0x74, 0x8F, 0x3C, 0xED, 0x57, 0xAF, 0x5E, 0xBD, 0x2A,
+    0x7B, 0x1D, 0xBC, 0xFE, 0xA4, 0xC1, 0xE9, 0x92, 0x07, 0x71, 0x41, 0x0E, 0x22, 0x47, 0x71, 0x93,
+    0x14, 0xA3, 0xAC, 0x22, 0x51, 0x8A, 0x81, 0xFF, 0x51, 0x92, 0x28, 0xE5, 0x20, 0x55, 0x8B, 0x3D,
+    0x0B, 0x52, 0x4C, 0x52, 0x8B, 0xF4, 0x7F, 0xF4, 0xB3, 0x64, 0xAA, 0x9B, 0x88, 0xD3, 0xAF, 0x27,
+    0xC1, 0xB5, 0x72, 0xC1, 0x03, 0xC2, 0x07, 0x70, 0x55, 0x2D, 0x96, 0x34, 0xF0, 0x6B, 0xCD, 0x25,
+    0xE7, 0x57, 0x04, 0xC3, 0x4D, 0xD5, 0x06, 0x37, 0x75, 0xD0, 0xB5, 0xD0, 0x20, 0xBA, 0xE5, 0x3A,
+    0xD7, 0xDA, 0xCA, 0xF5, 0x90, 0xAE, 0x52, 0x8E, 0x22, 0x9D, 0xE4, 0x16, 0x25, 0x9B, 0xA5, 0x6A,
+    0x92, 0x45, 0x76, 0x1E, 0x0E, 0xBF, 0x78, 0xDE, 0xAB, 0x1B, 0x49, 0x17, 0x72, 0x42, 0x1C, 0x90,
+    0x3D, 0x4A, 0x3E, 0x33, 0x06, 0x62, 0x95, 0xED, 0x89, 0x78, 0x27, 0x3B, 0x04, 0x4E, 0x93, 0xF9,
+    0x62, 0xC4, 0x56, 0x66, 0xE7, 0x65, 0x87, 0x00, 0xC2, 0x0E, 0x01, 0x04, 0xA4, 0xCE, 0x7B, 0x72,
+    0x82, 0x88, 0xB2, 0x43, 0x00, 0x81, 0x10, 0x81, 0xA9, 0x24, 0xEB, 0xE5, 0xA3, 0xA7, 0x97, 0x48,
+    0xB7, 0x57, 0xBB, 0x06, 0xB7, 0xEF, 0x9B, 0xFC, 0xBF, 0x32, 0x69, 0xFE, 0x93, 0xC9, 0x74, 0xCA,
+    0x44, 0x59, 0xAF, 0xDB, 0x42, 0x8A, 0x81, 0xEF, 0x57, 0x79, 0xFE, 0xE5, 0xD3, 0xD3, 0x9E, 0x9C,
+    0x7F, 0x71, 0xCD, 0xE9, 0xCB, 0x3B, 0x38, 0xA5, 0x1A, 0xA5, 0x52, 0xC8, 0x50, 0x3F, 0x41, 0x7D,
+    0x1F, 0x90, 0xF9, 0x7D, 0x32, 0xB0, 0xE5, 0x7D, 0x33, 0x05, 0xA9, 0xEE, 0x9E, 0xC8, 0x5E, 0xE0,
+    0xD1, 0x8C, 0x41, 0x73, 0x3E, 0xE2, 0xA6, 0xDC, 0xF8, 0x6F, 0xE4, 0x7B, 0xE4, 0xE2, 0x19, 0xF6,
+    0x48, 0xC2, 0x1D, 0x65, 0x8A, 0xE4, 0xBF, 0x88, 0xBF, 0xBC, 0x36, 0xBE, 0x0D, 0x02, 0x3D, 0x3B,
+    0xC5, 0xAE, 0x95, 0x56, 0xDC, 0xB0, 0x8F, 0x00, 0x8B, 0x72, 0xC1, 0x04, 0x7C, 0xBB, 0xC7, 0xA1,
+    0xF6, 0xE7, 0x9D, 0xAC, 0x61, 0x72, 0x6A, 0x0C, 0x64, 0x4A, 0x68, 0xC9, 0x52, 0x36, 0x53, 0xEA,
+    0xD7, 0xDD, 0xBA, 0x85, 0xAE, 0x46, 0x14, 0x09, 0x0D, 0xC4, 0xA8, 0xDA, 0x6A, 0x26, 0x46, 0xDD,
+    0xE4, 0x21, 0x9B, 0x77, 0x21, 0x89, 0xE1, 0x71, 0x8A, 0x18, 0x90, 0x3C, 0x10, 0xE3, 0x88, 0x08,
+    0x7B, 0x71, 0x72, 0xDB, 0xD1, 0x36, 0x23, 0xEA, 0x02, 0xBD, 0xFB, 0x06, 0x0E, 0x02, 0xE3, 0x48,
+    0x7A, 0x90, 0xBD, 0x2D, 0x34, 0xCA, 0xED, 0x45, 0xFE, 0x46, 0x7E, 0x67, 0xBE, 0xCB, 0x13, 0xCE,
+    0x05, 0x30, 0xB6, 0x46, 0xD5, 0x78, 0x16, 0x4F, 0xB9, 0xE8, 0xD6, 0x90, 0xDE, 0x04, 0x6E, 0x65,
+    0xA0, 0x05, 0x28, 0x0F, 0x02, 0x7A, 0x2E, 0x07, 0x2E, 0x47, 0xA6, 0xB2, 0x12, 0x07, 0x76, 0x9B,
+    0xC9, 0x61, 0xA8, 0xE8, 0x56, 0x44, 0xFF, 0x42, 0xEE, 0x5C, 0xF7, 0xD8, 0x90, 0x3D, 0x1B, 0x52,
+    0xBF, 0xD2, 0x41, 0x60, 0xC6, 0x19, 0xD5, 0xCD, 0x03, 0x16, 0xC8, 0x3D, 0x4A, 0x1A, 0xCF, 0x0D,
+    0x7D, 0x5E, 0x2E, 0x9E, 0x7C, 0x07, 0x48, 0x16, 0xFB, 0xE2, 0xDB, 0xAB, 0xE5, 0xCC, 0xD5, 0x68,
+    0x16, 0xA4, 0x59, 0x0E, 0xF7, 0x91, 0x4E, 0x7B, 0x23, 0xA2, 0x28, 0x27, 0xCA, 0xDA, 0xFF, 0xEC,
+    0x61, 0x49, 0x86, 0xB0, 0xEE, 0x97, 0xB7, 0xEE, 0xC6, 0xA7, 0x12, 0xF7, 0x90, 0x48, 0x06, 0xD1,
+    0x71, 0x06, 0x84, 0x82, 0xF8, 0xE7, 0x18, 0x2E, 0x90, 0xC1, 0x37, 0xE9, 0x46, 0x39, 0x51, 0xFE,
+    0x7A, 0x40, 0x82, 0xD8, 0x31, 0x44, 0xCA, 0x81, 0x7E, 0xDC, 0xA0, 0x09, 0x45, 0xAE, 0xDA, 0xCC,
+    0x8A, 0x02, 0x85, 0x22, 0x95, 0x43, 0xE1, 0x6A, 0x5D, 0xAD, 0xC0, 0x25, 0xE1, 0x60, 0x20, 0xF7,
+    0xFC, 0x11, 0x0E, 0xBA, 0x71, 0x3F, 0x88, 0x4F, 0x64, 0xB5, 0xD1, 0x49, 0xDE, 0x06, 0x53, 0x07,
+    0xA3, 0x51, 0xDA, 0x1A, 0x18, 0x59, 0x64, 0x99, 0x91, 0x50, 0xDF, 0xB0, 0xE9, 0x61, 0x49, 0x6B,
+    0x7E, 0x54, 0x5A, 0xBF, 0xEC, 0xDB, 0x14, 0xC0, 0x10, 0xB1, 0xE1, 0xFC, 0x4A, 0xAC, 0xF3, 0x79,
+    0x7D, 0xBC, 0x6F, 0xD7, 0x2C, 0xA9, 0xC9, 0x22, 0xFE, 0x55, 0x6F, 0x0C, 0xE1, 0x5D, 0x68, 0xB8,
+    0x3B, 0xAF, 0xB6, 0x36, 0x3E, 0x90, 0x87, 0x3C, 0xB6, 0xEF, 0x37, 0x27, 0x2E, 0x82, 0x24, 0x29,
+    0xAD, 0x9A, 0x38, 0x95, 0x9A, 0x5B, 0xAF, 0x28, 0xE7, 0x63, 0x33, 0x40, 0xCC, 0x26, 0x9E, 0x64,
+    0x0B, 0xBB, 0x89, 0x93, 0xA3, 0x1A, 0x98, 0x78, 0xCF, 0x26, 0xF9, 0x7E, 0x65, 0xE7, 0xF7, 0x21,
+    0x45, 0x58, 0x8F, 0x91, 0x14, 0xE5, 0xB5, 0x3B, 0xDA, 0xFA, 0xE9, 0x07, 0xE0, 0xFD, 0x29, 0xC5,
+    0x8B, 0x7E, 0x86, 0x2E, 0x1B, 0xF2, 0x70, 0x7C, 0x36, 0x72, 0x8A, 0xB4, 0x95, 0x24, 0xC1, 0x88,
+    0x1D, 0x50, 0x3C, 0xA0, 0x6F, 0x50, 0xA2, 0x9A, 0xD0, 0x88, 0xDD, 0x1B, 0x7D, 0xFA, 0xF7, 0x2F,
+    0xBF, 0x6D, 0xF1, 0x41, 0xAC, 0x35, 0xD3, 0x44, 0xDB, 0xBA, 0x4D, 0x1A, 0x69, 0x6E, 0x71, 0x13,
+    0x0E, 0xF9, 0x9E, 0x1F, 0x26, 0x0B, 0xD7, 0x38, 0xFD, 0x06, 0x82, 0x37, 0x96, 0x9C, 0x30, 0x3D,
+    0x21, 0x67, 0xA9, 0x78, 0x78, 0x41, 0xF1, 0xDD, 0xEF, 0xB0, 0x78, 0xFD, 0x12, 0xD6, 0xD2, 0xA6,
+    0x1C, 0x1C, 0x1D, 0x8B, 0x82, 0xAE, 0xF8, 0x4B, 0x49, 0xA1, 0x60, 0x9B, 0x90, 0x47, 0x62, 0xCC,
+    0x46, 0xDC, 0xF2, 0xC8, 0x0E, 0xB5, 0xAE, 0x46, 0x14, 0xA2, 0xA6, 0x24, 0x15, 0xE5, 0x7E, 0xFD,
+    0xCC, 0xC0, 0x59, 0x11, 0x00, 0x73, 0xCC, 0xE6, 0x24, 0x54, 0x48, 0x6B, 0x91, 0x83, 0x1B, 0xDC,
+    0x5C, 0x3F, 0x54, 0x08, 0xA9, 0x1F, 0xA1, 0x82, 0x50, 0x3F, 0x76, 0x92, 0xFD, 0x05, 0xC7, 0x7C,
+    0x0E, 0x9D, 0x8B, 0xA9, 0x1C, 0x2B, 0x9B, 0x50, 0x18, 0x81, 0xA7, 0x5C, 0x52, 0x9D, 0x00, 0xD3,
+    0x1E, 0x3E, 0x88, 0xCE, 0xBA, 0x2B, 0xDA, 0x5B, 0xAB, 0x00, 0xE1, 0x45, 0xF2, 0x45, 0x30, 0xC3,
+    0xA1, 0x0A, 0x6F, 0xC1, 0x11, 0xEF, 0xD5, 0x8D, 0xFB, 0x6C, 0x7D, 0x7B, 0x2E, 0x61, 0x02, 0xBF,
+    0xED, 0x2E, 0x4E, 0x3E, 0x11, 0xC3, 0x43, 0x27, 0x26, 0x23, 0xDF, 0x6F, 0xD6, 0x2D, 0xD1, 0x4C,
+    0x65, 0xA3, 0x06, 0x9F, 0x74, 0xF3, 0x34, 0x8D, 0x6C, 0x57, 0x0A, 0x94, 0x23, 0x14, 0x3A, 0xC0,
+    0xBF, 0x1D, 0xB4, 0xE9, 0xD8, 0xB2, 0x6C, 0x56, 0xF4, 0x6A, 0xE0, 0xF0, 0xC0, 0xF8, 0x9F, 0x38,
+    0xFB, 0xF0, 0x00, 0xF4, 0xA1, 0x81, 0x03, 0x06, 0x1A, 0xAC, 0xF4, 0xE6, 0xB9, 0xA0, 0x81, 0xEF,
+    0x9A, 0x62, 0xE8, 0xB2, 0x29, 0x1F, 0x6F, 0xA4, 0x2B, 0xDA, 0xF2, 0xC7, 0x19, 0x49, 0xE7, 0x31,
+    0xFF, 0x07, 0xD5, 0x5D, 0xF9, 0x16, 0x67, 0x68, 0x04, 0x79, 0x17, 0xF3, 0xF3, 0xC3, 0xED, 0x7A,
+    0xAA, 0xE0, 0xAA, 0x7E, 0xB9, 0x75, 0xE9, 0x9D, 0xEB, 0x5F, 0xA5, 0x55, 0xBF, 0x6F, 0x1C, 0x45,
+    0x18, 0x7D, 0xB3, 0x8B, 0xD9, 0x48, 0x5B, 0xAC, 0x0B, 0x52, 0x45, 0xCA, 0x36, 0x54, 0x80, 0x3C,
+    0x3D, 0xB2, 0x6F, 0x36, 0x69, 0x28, 0x28, 0x08, 0x45, 0x94, 0x82, 0xC2, 0x7F, 0x82, 0x1B, 0xCA,
+    0xF8, 0x76, 0x4D, 0x0A, 0xCA, 0xA4, 0x4F, 0x41, 0x43, 0x81, 0x68, 0x68, 0x0C, 0xB2, 0xC8, 0xDD,
+    0xED, 0x3A, 0x29, 0x28, 0x52, 0x64, 0xC1, 0x05, 0x45, 0x0A, 0x8F, 0x10, 0xA2, 0x20, 0x08, 0x4F,
+    0xC2, 0x04, 0x36, 0xF6, 0xDE, 0x0D, 0xEF, 0x5B, 0xFB, 0x6C, 0x81, 0x44, 0xC5, 0x9E, 0x74, 0xA3,
+    0xD9, 0xF9, 0xF1, 0xBD, 0xEF, 0x7D, 0xEF, 0x7B, 0x0B, 0x9C, 0x3E, 0xA9, 0xC7, 0x2E, 0x74, 0x9B,
+    0x07, 0xAC, 0xC3, 0xF4, 0xD9, 0x57, 0x56, 0xC3, 0xCC, 0xD2, 0xA2, 0xCF, 0x9A, 0x0D, 0xA8, 0x42,
+    0x67, 0x76, 0x8D, 0x9B, 0x92, 0xC7, 0x5E, 0x73, 0x50, 0x7F, 0x4C, 0xF2, 0x82, 0xE3, 0x83, 0xCF,
+    0xF2, 0x86, 0x83, 0x7E, 0x7C, 0xD7, 0x72, 0xC8, 0x0E, 0x0E, 0xF7, 0x64, 0x4F, 0x1B, 0x36, 0x38,
+    0xC4, 0xB6, 0xFC, 0xA0, 0x02, 0x22, 0xA7, 0xEF, 0x58, 0x05, 0xE5, 0xB2, 0xA6, 0x8F, 0x7E, 0xF8,
+    0xD5, 0xC7, 0xAD, 0xBE, 0xEF, 0x82, 0x57, 0x2E, 0x0E, 0x56, 0x3B, 0xEC, 0xA1, 0x6C, 0x21, 0x57,
+    0xA9, 0x53, 0x14, 0x51, 0xB0, 0x2A, 0x84, 0xC6, 0x5C, 0x9B, 0x27, 0x45, 0x62, 0x57, 0xB1, 0xCD,
+    0x6B, 0x1B, 0x44, 0x1E, 0x6F, 0xF7, 0xE0, 0x09, 0x5C, 0x2E, 0x2B, 0xA8, 0x9E, 0x2F, 0x1F, 0x15,
+    0xAA, 0x9F, 0xC0, 0xDC, 0xB5, 0xB9, 0xAB, 0x43, 0x17, 0x85, 0x57, 0xC0, 0x8D, 0xB3, 0x4C, 0xB6,
+    0x1C, 0x74, 0x12, 0x1A, 0xD5, 0xAF, 0x94, 0x48, 0x2C, 0x7A, 0xE8, 0xE2, 0x6C, 0x88, 0x1D, 0x87,
+    0xBC, 0xE2, 0x30, 0x3D, 0x1F, 0x1A, 0x0E, 0x0B, 0x06, 0x61, 0xFE, 0x63, 0x3C, 0x68, 0x77, 0xBA,
+    0xF4, 0x49, 0x96, 0xBC, 0xEC, 0xC7, 0x5D, 0x16, 0x9A, 0xD0, 0xE8, 0x2E, 0xEE, 0xF0, 0xDA, 0x12,
+    0xDD, 0x80, 0x10, 0x78, 0x87, 0xBF, 0xC8, 0xC1, 0x21, 0x6D, 0xB3, 0x02, 0xF9, 0x2F, 0x1D, 0x29,
+    0x08, 0x4C, 0x62, 0xE5, 0xC6, 0xC5, 0x36, 0x55, 0x37, 0x98, 0x90, 0xCC, 0xC4, 0x5D, 0xFE, 0x77,
+    0xC8, 0x4C, 0x42, 0x8E, 0x39, 0x44, 0x7E, 0x39, 0x94, 0xF2, 0xB2, 0x83, 0x61, 0x01, 0x54, 0x17,
+    0x1D, 0x5D, 0x4F, 0xAC, 0x5E, 0x5F, 0xCF, 0x7F, 0x7C, 0x7E, 0x62, 0x4D, 0x88, 0x03, 0x6A, 0x9B,
+    0x59, 0xAC, 0x12, 0x87, 0x3C, 0xAF, 0x2F, 0xA0, 0xBF, 0x0B, 0x95, 0xF1, 0xB7, 0xAC, 0xE9, 0x95,
+    0x37, 0xD7, 0x70, 0x9B, 0x35, 0xD1, 0x39, 0x49, 0xB9, 0x4B, 0xDA, 0x0F, 0x49, 0xD0, 0x89, 0x03,
+    0xEA, 0x29, 0x60, 0x58, 0x81, 0xEC, 0xA1, 0x23, 0x0B, 0x63, 0x5C, 0xF7, 0x59, 0x6B, 0x27, 0x6A,
+    0xE1, 0x0D, 0x4C, 0x97, 0x55, 0x8C, 0x06, 0x5E, 0xB9, 0x44, 0x1B, 0xC8, 0x69, 0x1A, 0xF8, 0x2E,
+    0xBF, 0xC3, 0xB3, 0x1B, 0x04, 0x88, 0x49, 0xCC, 0xA2, 0xFA, 0xA4, 0x65, 0xED, 0xD2, 0x16, 0x91,
+    0x65, 0x1D, 0xE2, 0x96, 0x7F, 0x49, 0x93, 0x57, 0x48, 0x1B, 0x5D, 0x20, 0x2B, 0x24, 0x30, 0xCC,
+    0xCA, 0x9B, 0x63, 0x8C, 0xD6, 0x4C, 0x8F, 0xB2, 0x37, 0xCC, 0xC5, 0x9B, 0x16, 0xA6, 0x5A, 0xC1,
+    0x19, 0x5E, 0x3E, 0x57, 0x78, 0x7B, 0x5D, 0x90, 0x50, 0x90, 0x95, 0x9C, 0x5B, 0x2C, 0x92, 0x1A,
+    0x23, 0x07, 0xF5, 0xAC, 0xB9, 0x7A, 0x1B, 0xF8, 0xDA, 0x65, 0xBC, 0x69, 0x7D, 0x23, 0x15, 0xBC,
+    0xD9, 0x9D, 0x47, 0x2D, 0x92, 0x47, 0x3F, 0x7D, 0xCF, 0x65, 0xDB, 0x39, 0x2E, 0xEF, 0xEA, 0x5D,
+    0x59, 0x4E, 0xA9, 0x45, 0x5C, 0x8D, 0xE6, 0xB1, 0xFD, 0x30, 0x2B, 0x6A, 0x74, 0xDF, 0x86, 0x26,
+    0xA7, 0x54, 0x43, 0x9B, 0x54, 0x59, 0x4F, 0xE2, 0x0A, 0xE6, 0x54, 0x5C, 0x64, 0x45, 0x19, 0x8C,
+    0x28, 0x03, 0x74, 0x83, 0x0C, 0x54, 0x27, 0x32, 0x68, 0x45, 0x06, 0x18, 0x64, 0x40, 0x0A, 0x8E,
+    0xBF, 0x9C, 0x23, 0x0F, 0xC1, 0x63, 0x76, 0x73, 0x53, 0x6A, 0x62, 0x58, 0x05, 0xEE, 0x1B, 0xB1,
+    0xAE, 0x3B, 0x1E, 0x3A, 0x4B, 0x1B, 0x2C, 0x3A, 0x43, 0xDD, 0x55, 0x9D, 0xB4, 0xC7, 0x45, 0x42,
+    0x49, 0xA8, 0x60, 0x02, 0x75, 0xF3, 0x5E, 0x1F, 0x7B, 0xCC, 0x53, 0x8B, 0x39, 0x1B, 0x61, 0x46,
+    0x4A, 0x66, 0x06, 0x98, 0x96, 0xC0, 0x7C, 0x0C, 0xF4, 0x33, 0xA8, 0x6E, 0x86, 0xD8, 0xCF, 0x90,
+    0xDA, 0x92, 0x4A, 0x33, 0x4D, 0xCD, 0x78, 0x3D, 0x8F, 0xB7, 0xC0, 0x1B, 0x4B, 0xB5, 0xDA, 0xB4,
+    0x4B, 0xC2, 0x4E, 0xF0, 0x2B, 0xE3, 0xFC, 0xC8, 0xAA, 0x97, 0x9E, 0x30, 0x0F, 0x8B, 0x29, 0xF4,
+    0x2E, 0x11, 0x85, 0x8A, 0xBA, 0xE8, 0xA9, 0x92, 0xBC, 0xA5, 0x4A, 0x6A, 0x51, 0x89, 0x5F, 0xC2,
+    0x1C, 0x13, 0xE6, 0x27, 0x9C, 0xE5, 0xFF, 0x09, 0x13, 0x5B, 0x6D, 0xEE, 0x54, 0xB0, 0x0C, 0x79,
+    0xEB, 0xE0, 0x84, 0x71, 0x9F, 0x56, 0x73, 0x24, 0xBF, 0x83, 0x78, 0x7A, 0xFE, 0x65, 0x83, 0x18,
+    0x89, 0x9D, 0xD0, 0x84, 0x97, 0x6A, 0x20, 0x27, 0x92, 0x00, 0x0C, 0x2D, 0x2C, 0xB0, 0xFD, 0xB8,
+    0x54, 0xDF, 0xAB, 0x81, 0x20, 0x0A, 0x39, 0x26, 0x70, 0xE5, 0x89, 0x3C, 0x92, 0x30, 0x22, 0x92,
+    0xB3, 0x3F, 0x69, 0xFF, 0xFC, 0x15, 0xC9, 0xAF, 0x25, 0xB5, 0x9B, 0x37, 0x8B, 0xA5, 0xAC, 0xDA,
+    0x38, 0xF4, 0xF1, 0xAB, 0x59, 0xEC, 0x14, 0x1B, 0x06, 0xD4, 0xD7, 0x84, 0xAA, 0xE4, 0xDE, 0x4A,
+    0x3A, 0x33, 0xE2, 0x7C, 0x46, 0x05, 0x35, 0xF8, 0xD4, 0x29, 0x17, 0xEE, 0x7B, 0x1D, 0x5C, 0xC4,
+    0x0B, 0x56, 0xCE, 0xBB, 0xE8, 0x4A, 0x17, 0xCD, 0x51, 0x36, 0x65, 0x97, 0x07, 0x2E, 0x5C, 0xEE,
+    0xCA, 0x3A, 0x1B, 0x38, 0x32, 0x23, 0x56, 0xF4, 0xAF, 0x76, 0xB4, 0x97, 0xB6, 0xD1, 0x49, 0x61,
+    0x5C, 0xDA, 0xC4, 0x0B, 0xEE, 0x1B, 0xC8, 0xA2, 0xD0, 0xAA, 0xC4, 0x23, 0x20, 0x2F, 0x52, 0xC7,
+    0xE4, 0x34, 0xB2, 0x96, 0x96, 0x61, 0x4E, 0x3B, 0x6D, 0x74, 0xDA, 0x85, 0xDB, 0x97, 0x06, 0x37,
+    0x98, 0xAC, 0x6B, 0x01, 0x22, 0xF4, 0x31, 0xDB, 0x60, 0x47, 0xE2, 0x36, 0xF5, 0x29, 0xFA, 0x65,
+    0x73, 0x6C, 0xD1, 0x49, 0x20, 0xC5, 0xC6, 0x47, 0x0E, 0x52, 0x4E, 0x32, 0xCF, 0x37, 0x74, 0xA6,
+    0x1E, 0xB7, 0xE5, 0x8F, 0x29, 0x6D, 0x83, 0x84, 0x8C, 0x15, 0x53, 0x1C, 0x09, 0x17, 0xA3, 0x84,
+    0xB6, 0x68, 0x32, 0xDA, 0x9F, 0x61, 0x5B, 0x62, 0x4D, 0xFC, 0x70, 0x4D, 0xBC, 0xD1, 0x08, 0x5B,
+    0x46, 0x3C, 0xD3, 0x48, 0x90, 0xB1, 0xDC, 0x2F, 0x8D, 0x48, 0x0C, 0xF8, 0xB8, 0x14, 0xFE, 0xE6,
+    0x9C, 0x05, 0xA1, 0xF3, 0xAD, 0x25, 0x07, 0xAB, 0x83, 0x2D, 0xF2, 0x4C, 0x4C, 0xA5, 0xD2, 0x77,
+    0xD6, 0xC9, 0xAB, 0x5B, 0x1E, 0x84, 0x5C, 0x8D, 0xC1, 0x8C, 0x53, 0xB9, 0x76, 0x2B, 0xDC, 0x23,
+    0xEB, 0x21, 0x20, 0x5E, 0x8C, 0xB7, 0x5C, 0xDC, 0x65, 0xC5, 0x22, 0x66, 0x0F, 0x67, 0xFB, 0x9D,
+    0x72, 0x91, 0x17, 0xAC, 0xD3, 0xB1, 0xD8, 0xCC, 0x26, 0x49, 0x4A, 0x9F, 0xB6, 0xB1, 0x8D, 0x5F,
+    0x78, 0x62, 0xA7, 0x54, 0xB7, 0x31, 0xCD, 0x1B, 0x8D, 0x59, 0xDC, 0xA5, 0x94, 0x69, 0x79, 0xF0,
+    0x27, 0xBD, 0x2B, 0x04, 0xC2, 0xB9, 0x12, 0x7E, 0x5E, 0x86, 0x90, 0xB4, 0xC4, 0xF9, 0xF8, 0x08,
+    0x94, 0x8A, 0x99, 0xAB, 0xC5, 0x44, 0xB2, 0x11, 0xD8, 0xD1, 0xE7, 0x17, 0xF6, 0x57, 0x16, 0x6A,
+    0x1E, 0x87, 0x26, 0x9D, 0xC7, 0x47, 0x56, 0xFF, 0x46, 0x17, 0x24, 0x5D, 0xB1, 0x27, 0x62, 0x75,
+    0x2C, 0xC7, 0x25, 0x9D, 0x53, 0x9E, 0x4B, 0xD9, 0x2D, 0xE6, 0x19, 0xB1, 0xA7, 0x90, 0x3C, 0xE1,
+    0x42, 0xF6, 0x7E, 0x2B, 0x14, 0x3A, 0xBC, 0xDB, 0xC7, 0xC7, 0xDE, 0x50, 0x12, 0x8E, 0x94, 0x2D,
+    0x8A, 0x73, 0x59, 0xFF, 0x2F, 0x87, 0xDF, 0xDF, 0xEF, 0xD2, 0xC3, 0x9C, 0x0E, 0x5F, 0xD2, 0xE1,
+    0xF7, 0x17, 0x2D, 0x1D, 0xFE, 0xA9, 0x5C, 0xBD, 0xB1, 0xA4, 0x74, 0x10, 0x33, 0x7D, 0x7D, 0xF8,
+    0xCE, 0x88, 0x52, 0xCF, 0x9D, 0x3F, 0x14, 0xCA, 0xD7, 0x74, 0x69, 0xB5, 0xC9, 0x70, 0xCA, 0x93,
+    0x32, 0x4D, 0xD6, 0x87, 0x90, 0x66, 0x08, 0x93, 0x70, 0xF1, 0x19, 0x77, 0x05, 0x1A, 0x70, 0xF4,
+    0x85, 0x59, 0x5E, 0x36, 0xBE, 0xC4, 0xEA, 0x1C, 0x30, 0xB3, 0x85, 0x7C, 0xB9, 0x82, 0xA4, 0x5E,
+    0xE1, 0xE2, 0x9B, 0xC2, 0x4F, 0x05, 0x39, 0xDD, 0x2B, 0xE5, 0x16, 0xBD, 0xB3, 0xD9, 0x24, 0x96,
+    0x1A, 0xEB, 0x89, 0x9C, 0x97, 0xB2, 0xFF, 0x13, 0x1B, 0xC9, 0x74, 0x7B, 0x98, 0x4A, 0xB8, 0x7F,
+    0x4C, 0xCF, 0x56, 0xD9, 0x25, 0x9C, 0xEA, 0x26, 0x73, 0xCA, 0x27, 0x7D, 0x74, 0xA4, 0xF4, 0xB5,
+    0x93, 0xE6, 0x9B, 0xE7, 0x2F, 0xE6, 0x93, 0xD9, 0x58, 0x4F, 0xF3, 0x90, 0x84, 0x87, 0xA1, 0xA8,
+    0x2B, 0x63, 0x73, 0xF9, 0xDC, 0xAE, 0x5E, 0x14, 0x0A, 0x7F, 0x03, 0x75, 0x55, 0x31, 0x6F, 0x1C,
+    0x45, 0x14, 0x7E, 0xBB, 0x63, 0x7B, 0xA2, 0xAC, 0xD0, 0xA4, 0xC0, 0x0D, 0x29, 0x96, 0x92, 0x6E,
+    0xDA, 0x14, 0xE4, 0x66, 0x4D, 0x0A, 0x97, 0xB8, 0x71, 0x45, 0x11, 0x6A, 0x1A, 0xFF, 0x81, 0xF8,
+    0x76, 0x63, 0xCA, 0x34, 0x54, 0xD4, 0x94, 0x08, 0x17, 0xA1, 0x42, 0x41, 0xBA, 0xF5, 0x8E, 0xDC,
+    0xD0, 0x2E, 0xA4, 0xA0, 0xA0, 0x19, 0x41, 0x12, 0x14, 0x28, 0x3C, 0x16, 0x2B, 0xB1, 0x32, 0xB3,
+    0x37, 0x7C, 0x6F, 0xEE, 0x2E, 0x76, 0x84, 0x58, 0xDD, 0xAE, 0x6E, 0xE6, 0x76, 0xDE, 0xFB, 0xDE,
+    0xF7, 0x7D, 0xEF, 0x1D, 0x11, 0x5F, 0x59, 0x67, 0x73, 0x4F, 0xCF, 0xEA, 0x40, 0x86, 0xF4, 0xE3,
+    0x87, 0x56, 0x3A, 0x31, 0x50, 0xA0, 0x16, 0xCB, 0xB2, 0x51, 0x58, 0xE6, 0xBC, 0x3C, 0x4E, 0xCB,
+    0xC2, 0x0A, 0xFF, 0xD6, 0x72, 0xFD, 0xEB, 0x44, 0x35, 0x96, 0xDA, 0x2A, 0x9F, 0x0D, 0x32, 0xE4,
+    0x17, 0xB7, 0xF5, 0xDE, 0x3F, 0xF6, 0xBB, 0xCB, 0x5F, 0xA7, 0xC5, 0xD9, 0x5C, 0xB7, 0x65, 0x94,
+    0xF1, 0x3C, 0xDA, 0xAE, 0x31, 0x4E, 0x7D, 0x48, 0x15, 0xDD, 0x21, 0x61, 0x53, 0xEA, 0x47, 0xE9,
+    0x29, 0x57, 0x8B, 0x45, 0x7A, 0xEA, 0x8A, 0x9F, 0x45, 0x4F, 0xD7, 0x97, 0x8A, 0xD1, 0x1B, 0xDC,
+    0xDF, 0x1F, 0x1E, 0x35, 0x23, 0x32, 0x07, 0xC0, 0xBD, 0x57, 0xE0, 0x50, 0x79, 0x48, 0x64, 0xA2,
+    0xA7, 0xE5, 0x69, 0xA0, 0x21, 0x6D, 0xB7, 0xC2, 0xD3, 0x02, 0x77, 0x10, 0x3E, 0x1B, 0xF3, 0x51,
+    0x7A, 0x8A, 0xD1, 0x92, 0x99, 0x50, 0x65, 0xB5, 0x8E, 0xD6, 0x21, 0x74, 0x59, 0xC4, 0x86, 0x28,
+    0x6C, 0xB7, 0x44, 0xA8, 0xC7, 0x23, 0x05, 0x0A, 0x25, 0x84, 0xBE, 0x4F, 0x94, 0x0F, 0xD9, 0xE5,
+    0x37, 0xA4, 0x6C, 0x11, 0x63, 0x65, 0xC8, 0xBC, 0x8A, 0xD9, 0x88, 0xE0, 0x53, 0xD1, 0xCB, 0x3E,
+    0x1F, 0x34, 0x69, 0x60, 0x0B, 0xC0, 0x6A, 0x84, 0x3F, 0x41, 0x8E, 0xF2, 0xC9, 0xBE, 0x2B, 0x6D,
+    0x1D, 0x54, 0x0C, 0x79, 0xB4, 0x2A, 0x56, 0x72, 0xE4, 0x54, 0xD9, 0x2A, 0xD7, 0x91, 0x27, 0x11,
+    0x7B, 0xDA, 0x3E, 0xC2, 0xF7, 0x80, 0x5C, 0x0E, 0xA9, 0x81, 0x63, 0xF1, 0x59, 0x23, 0x62, 0xEC,
+    0xD5, 0xEB, 0xDA, 0x82, 0xC7, 0x8F, 0x3C, 0x1D, 0x2B, 0x9B, 0x0D, 0x86, 0x0A, 0x0B, 0x0D, 0x18,
+    0xB5, 0x8C, 0x91, 0x64, 0xC4, 0xDB, 0x07, 0x6B, 0xD0, 0xF5, 0x08, 0x16, 0x40, 0xB3, 0x1C, 0x65,
+    0x23, 0xFD, 0x2D, 0x62, 0xB4, 0xCC, 0x54, 0x4B, 0xEF, 0x9D, 0x0E, 0xA8, 0xB1, 0xCF, 0x0E, 0xEB,
+    0x55, 0x0E, 0xE9, 0xBE, 0x22, 0x23, 0x6D, 0x3E, 0xEA, 0x5E, 0xDB, 0x3A, 0x8E, 0x54, 0xC7, 0x37,
+    0x70, 0x70, 0xDD, 0x1D, 0x69, 0x27, 0x02, 0x2F, 0xE9, 0xE8, 0x77, 0x47, 0x8A, 0xFB, 0x21, 0x1B,
+    0xC5, 0x08, 0xEE, 0x86, 0xC2, 0xD1, 0x24, 0x3C, 0x02, 0x83, 0x43, 0xDD, 0xE0, 0x79, 0xD5, 0x21,
+    0x3E, 0x23, 0xA1, 0x50, 0xFC, 0x71, 0x86, 0xA7, 0xB2, 0x73, 0xCA, 0x46, 0x7E, 0x0A, 0x5F, 0x36,
+    0x35, 0x15, 0xAE, 0x04, 0x43, 0xA5, 0xD5, 0x64, 0x6C, 0xC7, 0x7E, 0x00, 0xC2, 0x19, 0x70, 0x27,
+    0xED, 0xDE, 0xDD, 0x64, 0xDC, 0xC1, 0xAE, 0x60, 0x15, 0x26, 0x1A, 0xC9, 0x54, 0x65, 0x95, 0x18,
+    0x9F, 0xE3, 0x7D, 0xE9, 0x41, 0x88, 0x69, 0x8E, 0x29, 0xE3, 0x9F, 0x05, 0xDE, 0xA3, 0x99, 0x6A,
+    0x50, 0xDB, 0x00, 0x11, 0xCA, 0x8C, 0xEA, 0xFC, 0xF2, 0xAF, 0xA7, 0xD6, 0xB4, 0xF5, 0x20, 0xE2,
+    0x03, 0x20, 0xB6, 0x5B, 0x04, 0xF3, 0xA4, 0x62, 0x20, 0x59, 0x09, 0x0A, 0xA0, 0xAB, 0x5C, 0x7F,
+    0x85, 0x72, 0xD4, 0x6C, 0x72, 0xCA, 0x58, 0x71, 0xB8, 0x50, 0xF4, 0x33, 0x3A, 0x2E, 0x6C, 0xD1,
+    0x8F, 0x59, 0xD0, 0xD4, 0x09, 0x5F, 0xDB, 0xBA, 0x73, 0x8C, 0xB0, 0xAB, 0x92, 0xC7, 0x5A, 0xCA,
+    0x25, 0x2C, 0x6B, 0x5E, 0x2D, 0xF3, 0x18, 0x1B, 0x76, 0xC5, 0x36, 0x8E, 0x6F, 0x03, 0xBD, 0x79,
+    0x1C, 0xA8, 0x3E, 0xC1, 0x9D, 0x8F, 0x58, 0x55, 0x74, 0xF3, 0x42, 0x78, 0xF8, 0xCE, 0x72, 0x7C,
+    0xE1, 0x64, 0xCF, 0x09, 0x54, 0xC3, 0x3C, 0x80, 0x05, 0x89, 0x23, 0x9D, 0xA3, 0x1A, 0xD0, 0xBA,
+    0x24, 0x50, 0x4A, 0xC2, 0xED, 0x51, 0x21, 0x0B, 0x68, 0x1F, 0x29, 0x99, 0x8F, 0x95, 0xDD, 0x85,
+    0xD1, 0x11, 0x0A, 0xAE, 0x81, 0x8F, 0x29, 0xDD, 0xB7, 0xBB, 0xA7, 0x4E, 0x43, 0x4F, 0x2E, 0x8D,
+    0xE5, 0x04, 0x67, 0x94, 0x0D, 0x3B, 0x2E, 0xF7, 0x75, 0x10, 0x97, 0x31, 0x88, 0xDF, 0xDD, 0x24,
+    0x2F, 0xAA, 0xB6, 0x08, 0x74, 0xA6, 0x06, 0xDC, 0xF0, 0x7C, 0xD9, 0xE3, 0x06, 0xBF, 0x30, 0x44,
+    0x40, 0x08, 0xDC, 0xD9, 0x38, 0x07, 0x85, 0x2D, 0x74, 0x0A, 0x30, 0xC4, 0xAA, 0x9D, 0x92, 0x65,
+    0x10, 0x70, 0x4E, 0x72, 0x2F, 0x90, 0xFA, 0xD3, 0x23, 0x6F, 0x43, 0xF9, 0xD7, 0x69, 0x04, 0x00,
+    0xD0, 0x0C, 0xAF, 0x38, 0x42, 0xB5, 0x78, 0x03, 0xFD, 0x40, 0x99, 0xBB, 0x59, 0xB2, 0x9E, 0x18,
+    0xBA, 0x7C, 0x71, 0x64, 0xBF, 0x65, 0x58, 0x08, 0xC6, 0x6F, 0xC2, 0x1B, 0x5D, 0x43, 0x75, 0x43,
+    0xBA, 0xDF, 0x1C, 0x36, 0x94, 0x3F, 0x18, 0xE8, 0x99, 0xF9, 0xB1, 0x83, 0xAA, 0x3D, 0x9B, 0x78,
+    0xD3, 0x79, 0xF0, 0xB0, 0x8E, 0x4E, 0xBD, 0xE6, 0x1E, 0x6D, 0xD0, 0xEC, 0xAA, 0x22, 0x6E, 0x3D,
+    0x13, 0x07, 0x98, 0xAC, 0x9A, 0x1F, 0x1E, 0xAC, 0x04, 0x81, 0xAD, 0xE8, 0x03, 0xD0, 0xF5, 0xF9,
+    0xF2, 0xC8, 0x33, 0x5B, 0xDD, 0xF8, 0xA6, 0x0D, 0xD0, 0x61, 0x12, 0x20, 0x5E, 0xCE, 0xD1, 0xDD,
+    0x8C, 0xC2, 0x40, 0x44, 0x46, 0x61, 0x49, 0x61, 0xD5, 0x59, 0x92, 0x03, 0xD1, 0xD9, 0x3B, 0x54,
+    0x3E, 0xB1, 0xF2, 0x7C, 0xB9, 0xEF, 0xEA, 0x98, 0xB4, 0x66, 0xC3, 0x64, 0xCC, 0xA6, 0xEE, 0x45,
+    0x58, 0x0F, 0x98, 0xCD, 0xE4, 0x33, 0x53, 0xF6, 0x10, 0x42, 0x62, 0x78, 0x61, 0x8E, 0x19, 0x10,
+    0x86, 0xEA, 0x81, 0x03, 0x1B, 0x68, 0xA1, 0xF7, 0xCD, 0xC7, 0x22, 0x3A, 0x33, 0x8A, 0x89, 0xB6,
+    0x78, 0x82, 0x6C, 0xE7, 0x41, 0xF5, 0x51, 0x0E, 0x66, 0x2F, 0x64, 0xD7, 0x06, 0x47, 0x53, 0x05,
+    0xD6, 0x90, 0x03, 0xE1, 0x3C, 0xC6, 0x05, 0x57, 0x61, 0x12, 0x49, 0x20, 0x1F, 0x71, 0x19, 0x2B,
+    0xDA, 0x53, 0x9F, 0x90, 0x7A, 0x6E, 0x11, 0x91, 0xF0, 0x31, 0xFD, 0xA6, 0x2B, 0x11, 0x3A, 0x39,
+    0x18, 0x52, 0x92, 0x60, 0xC9, 0x27, 0xFA, 0xEF, 0x75, 0x97, 0x49, 0x07, 0xDD, 0x9C, 0x84, 0xB3,
+    0xA4, 0x34, 0x18, 0x58, 0x2B, 0x4D, 0xD5, 0xCD, 0xCD, 0x76, 0xE5, 0xA4, 0xB4, 0xC9, 0xE2, 0x33,
+    0x80, 0x64, 0xA5, 0xD9, 0x7A, 0xBC, 0xAE, 0x7F, 0xD8, 0xC2, 0x09, 0xF9, 0xE5, 0x80, 0xC6, 0xC3,
+    0x29, 0x66, 0x79, 0xE7, 0x8B, 0x9B, 0x19, 0xEB, 0x98, 0xA6, 0x25, 0x7B, 0x93, 0xE6, 0x3C, 0x6D,
+    0xE9, 0x3E, 0xCF, 0x2F, 0xD2, 0x19, 0xC7, 0x53, 0xD5, 0x22, 0x4D, 0x6E, 0x03, 0xF4, 0xB9, 0x53,
+    0x1C, 0x82, 0x65, 0x6C, 0xE8, 0x51, 0xEE, 0xD1, 0x92, 0x1A, 0x09, 0x41, 0x0A, 0xC6, 0x03, 0xE6,
+    0xA5, 0xC5, 0x74, 0x3D, 0xDF, 0x77, 0x02, 0xED, 0x8E, 0x61, 0x8D, 0x21, 0x63, 0x06, 0xCC, 0x8A,
+    0x01, 0xF6, 0xCD, 0x40, 0xC4, 0xC1, 0xF5, 0x6C, 0x86, 0x1E, 0xF8, 0x63, 0xA8, 0xF9, 0xDF, 0x05,
+    0x75, 0x22, 0x27, 0xEA, 0x09, 0x3C, 0x32, 0x61, 0xC7, 0xDC, 0x73, 0x5E, 0x8E, 0x47, 0xE2, 0xEA,
+    0x34, 0x2E, 0x81, 0x2F, 0xC6, 0x50, 0xBC, 0xFC, 0xC4, 0xA9, 0x9E, 0x0F, 0xB4, 0x98, 0xD8, 0x56,
+    0xF6, 0x23, 0x46, 0xF3, 0xA2, 0xAC, 0xD0, 0x90, 0xE7, 0x90, 0x32, 0xC7, 0x50, 0x15, 0x71, 0x02,
+    0xEE, 0xD4, 0x63, 0xA9, 0xB9, 0x77, 0xB9, 0xAA, 0x81, 0x56, 0x3B, 0x4C, 0x5A, 0x22, 0xEB, 0xF4,
+    0x8A, 0x7B, 0x13, 0x66, 0x51, 0xFD, 0x9A, 0x2D, 0xE4, 0x44, 0xE7, 0xE5, 0x2F, 0x48, 0xE7, 0xB1,
+    0x17, 0x1E, 0x19, 0x67, 0x46, 0x3A, 0xF9, 0x4B, 0x33, 0xA7, 0xD6, 0x23, 0x3E, 0x17, 0x18, 0x2B,
+    0x65, 0x4B, 0x97, 0x0D, 0x19, 0x6C, 0x45, 0xBA, 0x41, 0x85, 0x9E, 0x66, 0xB7, 0x30, 0xD9, 0x7E,
+    0xFA, 0xD9, 0x51, 0x17, 0x5A, 0xB4, 0x37, 0xC8, 0xAE, 0x79, 0x2E, 0xA5, 0x12, 0x3F, 0x5D, 0x67,
+    0x33, 0xD8, 0xD1, 0x76, 0x2D, 0x3B, 0xBE, 0x8B, 0xE6, 0x2D, 0xB1, 0xB3, 0xAE, 0x29, 0x2E, 0xD1,
+    0x2A, 0xD3, 0xEE, 0x08, 0xCD, 0x8F, 0x55, 0x5F, 0x95, 0x20, 0xA3, 0xF8, 0x01, 0xFE, 0xFA, 0x0D,
+    0x27, 0xFE, 0x86, 0x0C, 0x73, 0x40, 0xD4, 0x17, 0x98, 0x1D, 0xCF, 0x1D, 0x8A, 0x58, 0x80, 0xA9,
+    0xB2, 0xB9, 0xD3, 0x8A, 0xE1, 0x9E, 0xA6, 0x1A, 0x54, 0xA8, 0x25, 0x6A, 0x5E, 0xAE, 0xCD, 0xF5,
+    0xBF, 0xD7, 0xBF, 0xAD, 0x55, 0x3D, 0x8C, 0xDC, 0x44, 0x18, 0xFD, 0x6C, 0xDF, 0x65, 0x90, 0x2C,
+    0x34, 0x14, 0x09, 0x42, 0x42, 0x30, 0x2D, 0x42, 0x90, 0x69, 0x29, 0xEE, 0xCE, 0x4E, 0x90, 0xA8,
+    0xD3, 0xAC, 0x28, 0x52, 0xD0, 0xD3, 0xA4, 0x49, 0xB9, 0xB7, 0xF6, 0x89, 0x92, 0x26, 0x34, 0xB4,
+    0x20, 0x21, 0x51, 0x1C, 0x05, 0x0D, 0x05, 0x12, 0x7B, 0x67, 0x27, 0x11, 0x55, 0x0A, 0x8C, 0x10,
+    0xA2, 0x40, 0x22, 0x2E, 0x80, 0x82, 0x26, 0x4E, 0xE4, 0x48, 0x86, 0x8C, 0x3D, 0xBC, 0x37, 0xDE,
+    0xCD, 0xE5, 0x10, 0x74, 0xF8, 0xCE, 0xDF, 0xDC, 0xCE, 0xCD, 0x7C, 0x3F, 0xEF, 0x7B, 0xDF, 0x5B,
+    0x91, 0x5C, 0x44, 0x54, 0x09, 0x93, 0xF1, 0xAF, 0x0A, 0xAF, 0x4C, 0x34, 0x27, 0x34, 0x6B, 0x9A,
+    0x6B, 0xF2, 0xF4, 0x89, 0xAA, 0x5A, 0xD6, 0xC6, 0x8B, 0xEA, 0x2E, 0x39, 0x31, 0x65, 0xD2, 0xE1,
+    0xD8, 0x66, 0xD1, 0x35, 0x96, 0x15, 0x96, 0xB8, 0xDF, 0x2E, 0x05, 0x37, 0x07, 0xC9, 0xC4, 0x36,
+    0xD1, 0x10, 0x3F, 0xB8, 0xAA, 0x5A, 0xBB, 0xB7, 0x67, 0x7E, 0x7A, 0xF8, 0xA4, 0xCD, 0x7C, 0xE2,
+    0xA5, 0x6A, 0x75, 0x2B, 0x2F, 0xC8, 0xCE, 0x99, 0xFB, 0x8B, 0x22, 0xAF, 0xC9, 0x5B, 0x22, 0x4E,
+    0x6E, 0xC2, 0x44, 0x1D, 0xF2, 0xF9, 0xA4, 0x11, 0xB1, 0x9E, 0xA1, 0x9F, 0x49, 0x43, 0xE4, 0x46,
+    0x1D, 0x39, 0xF1, 0x1D, 0x52, 0xBD, 0xDE, 0xC9, 0xA9, 0x24, 0x8C, 0x89, 0x9D, 0x43, 0xDE, 0x5D,
+    0xD2, 0x20, 0xF3, 0x43, 0xE9, 0x45, 0x56, 0xF4, 0x72, 0x90, 0xB4, 0x30, 0xAA, 0x46, 0x91, 0x1A,
+    0xA5, 0x66, 0x06, 0x1E, 0x2E, 0xEF, 0xD3, 0x7C, 0xCD, 0xC2, 0x3B, 0x9A, 0x7A, 0x0B, 0xC1, 0x8A,
+    0xFE, 0x07, 0xA2, 0x82, 0x4B, 0x37, 0x0B, 0x6C, 0x55, 0x23, 0x3E, 0x79, 0x7C, 0x92, 0xD7, 0xCF,
+    0x12, 0xE8, 0xC4, 0x2A, 0x8F, 0x2C, 0x76, 0x0B, 0x1E, 0x74, 0x62, 0xF3, 0xCD, 0x02, 0x18, 0xFE,
+    0x89, 0x8D, 0x21, 0x36, 0x13, 0xD0, 0x48, 0x99, 0xE7, 0x37, 0xCD, 0xD1, 0x90, 0x7E, 0xA7, 0xD5,
+    0x63, 0xB7, 0x1A, 0xB4, 0xAF, 0x7D, 0x6D, 0x87, 0xCF, 0x06, 0xD9, 0x49, 0xAE, 0xC0, 0xED, 0x2B,
+    0xF4, 0xFD, 0x15, 0xDE, 0x04, 0x75, 0x03, 0xC0, 0x39, 0x8B, 0xF9, 0xB1, 0xA8, 0x57, 0xBC, 0x47,
+    0x01, 0xB6, 0xDE, 0xE4, 0x09, 0x90, 0xB1, 0xE3, 0xFD, 0xDB, 0x78, 0x47, 0x73, 0xC5, 0xC5, 0xDD,
+    0x52, 0xB5, 0xEA, 0x4E, 0x63, 0xCB, 0x37, 0x95, 0x8C, 0xE8, 0x5C, 0xC2, 0xDA, 0x34, 0x8F, 0x17,
+    0xFE, 0x57, 0x89, 0xBD, 0x77, 0xA2, 0x7F, 0xBB, 0xEE, 0xD0, 0x13, 0x34, 0xC6, 0xA1, 0x8F, 0x70,
+    0x6F, 0x6A, 0x9B, 0x23, 0xD4, 0x28, 0xF1, 0x80, 0xE3, 0xBA, 0xC6, 0xF1, 0x49, 0xAA, 0xC5, 0x8D,
+    0xD6, 0xC2, 0x29, 0xAE, 0x4C, 0xF9, 0x39, 0xE4, 0xDB, 0xB4, 0x13, 0xE5, 0x8F, 0x80, 0xC7, 0xEE,
+    0xCA, 0x54, 0xA5, 0x44, 0x8F, 0x3B, 0xA4, 0xA2, 0xEE, 0x47, 0xC8, 0xC5, 0xF6, 0x29, 0x62, 0xF9,
+    0xF2, 0x60, 0x47, 0x12, 0xC7, 0x5C, 0x4D, 0xA3, 0x60, 0x2B, 0xB1, 0x52, 0xA0, 0x47, 0x4E, 0x1C,
+    0x69, 0x12, 0xE3, 0x82, 0x2E, 0xF5, 0x9D, 0x1E, 0x69, 0x1C, 0xE0, 0xC2, 0x98, 0x74, 0x99, 0x44,
+    0xDE, 0xE7, 0x03, 0x6C, 0xBB, 0x21, 0xC2, 0xF6, 0xA9, 0x7C, 0xCE, 0xD2, 0x7D, 0x2D, 0x6A, 0x5A,
+    0xC0, 0x16, 0x25, 0x7E, 0x55, 0x4F, 0x70, 0xD8, 0xAE, 0x29, 0x76, 0x80, 0xC1, 0xB1, 0x44, 0xD5,
+    0x9D, 0xE2, 0xBC, 0xB9, 0xDB, 0xB3, 0x5A, 0xF3, 0xC7, 0xF1, 0xF1, 0x17, 0xAE, 0x20, 0x38, 0x8F,
+    0xC6, 0xC5, 0x62, 0x51, 0x7C, 0x48, 0xC7, 0xA3, 0x2D, 0x79, 0x8E, 0x2C, 0xB7, 0x47, 0xB8, 0x18,
+    0x39, 0x7A, 0xD2, 0x8D, 0xEE, 0xC8, 0x7A, 0x03, 0x2C, 0xD0, 0xD6, 0x5E, 0x4D, 0x21, 0x22, 0x3A,
+    0x60, 0x7C, 0x7F, 0x6E, 0x02, 0x2E, 0x60, 0xD3, 0x62, 0x0F, 0x51, 0x51, 0xCE, 0x69, 0xDA, 0x04,
+    0x42, 0x65, 0x16, 0xD4, 0xC9, 0x8E, 0x8F, 0x2B, 0x84, 0x9B, 0x56, 0x8B, 0xC5, 0x09, 0xC8, 0xE7,
+    0xD6, 0x12, 0x0D, 0x27, 0xC0, 0x1F, 0x43, 0xD0, 0x64, 0x65, 0x91, 0x1B, 0x3F, 0x02, 0xB6, 0xF6,
+    0xAC, 0xB6, 0x6B, 0x19, 0xFA, 0x99, 0xB8, 0x0C, 0x7B, 0x66, 0x54, 0xA0, 0x58, 0xE6, 0xD0, 0x13,
+    0x99, 0x5E, 0x8A, 0x01, 0xC3, 0x80, 0x9A, 0xD8, 0x3C, 0x70, 0x5A, 0x35, 0xE4, 0x33, 0x0B, 0x04,
+    0xAD, 0x50, 0xF1, 0x08, 0xD4, 0x38, 0x9E, 0xE0, 0x3A, 0x98, 0xEF, 0x02, 0x13, 0x98, 0x65, 0x16,
+    0x07, 0x1E, 0x07, 0xE2, 0x64, 0x69, 0xA0, 0xB3, 0x66, 0xE7, 0xEC, 0x7B, 0x8C, 0x66, 0x0E, 0x83,
+    0xE5, 0x71, 0xD1, 0xA1, 0x28, 0xD6, 0xCC, 0xDA, 0xE5, 0xDC, 0x03, 0x86, 0xCA, 0x58, 0x20, 0xEA,
+    0xF4, 0x22, 0x82, 0x8E, 0xF0, 0x0F, 0x94, 0x1D, 0xD5, 0xC0, 0x31, 0x8A, 0xE3, 0x24, 0xAD, 0x39,
+    0x49, 0x6B, 0x4D, 0x7D, 0xB8, 0x0C, 0xB3, 0x5C, 0xD2, 0xD0, 0xDB, 0x8A, 0x18, 0x17, 0x81, 0x6D,
+    0x8C, 0xCC, 0x3C, 0x65, 0x4F, 0xFE, 0xE5, 0x79, 0x3E, 0x84, 0xCE, 0x83, 0xEE, 0xA8, 0x36, 0xE1,
+    0x8D, 0x28, 0xB8, 0xC6, 0xA5, 0x99, 0x01, 0x89, 0x6F, 0xE4, 0x3F, 0x9E, 0xC4, 0x4F, 0x61, 0x16,
+    0x40, 0x18, 0xED, 0x07, 0xB9, 0x00, 0xE8, 0x6C, 0x13, 0x04, 0x2B, 0x6D, 0xC3, 0x0C, 0xB3, 0x06,
+    0xE0, 0x95, 0x3A, 0xF6, 0x5A, 0x52, 0xA8, 0x07, 0x20, 0xD5, 0x0F, 0x4A, 0x62, 0xA7, 0xEF, 0xF1,
+    0x8C, 0xE8, 0x0F, 0xC2, 0x19, 0x5D, 0x86, 0x33, 0xBA, 0x2C, 0x78, 0x46, 0x97, 0xA4, 0xC7, 0x68,
+    0x72, 0xF4, 0x15, 0x22, 0x91, 0xA3, 0xC5, 0x62, 0xEE, 0xB3, 0x7C, 0x74, 0x8E, 0x23, 0x82, 0x01,
+    0x42, 0x2C, 0x9C, 0xF1, 0x33, 0x70, 0x28, 0x90, 0x03, 0x66, 0x6A, 0x89, 0xC6, 0xC0, 0xD4, 0x14,
+    0xF9, 0x54, 0xBE, 0x56, 0x7E, 0x9A, 0x53, 0x2D, 0x36, 0x93, 0x5B, 0x86, 0xC5, 0xD4, 0x61, 0xD1,
+    0xF3, 0x92, 0xCE, 0x05, 0x26, 0x9B, 0x3A, 0xCB, 0xB3, 0x02, 0x63, 0x91, 0x37, 0xF0, 0x83, 0x7E,
+    0x22, 0xFB, 0x06, 0x4D, 0x34, 0xBF, 0x0F, 0x64, 0x24, 0x30, 0xDD, 0xFD, 0xBF, 0xC4, 0xF8, 0x1D,
+    0x8A, 0xF1, 0x3E, 0xC5, 0xB8, 0xA3, 0x18, 0xD7, 0x10, 0xE3, 0x11, 0x62, 0xBC, 0xCB, 0x36, 0xA6,
+    0xCC, 0x65, 0xB9, 0xCD, 0xED, 0x55, 0xC6, 0xFA, 0x74, 0x13, 0x93, 0x9C, 0x85, 0xC1, 0x3E, 0x61,
+    0x0F, 0xFA, 0x43, 0xF1, 0xA5, 0x0A, 0xF5, 0x1C, 0xE1, 0x7E, 0x6E, 0xC2, 0x4C, 0x2B, 0xFD, 0x23,
+    0x0D, 0xF5, 0xC3, 0x78, 0x74, 0xD5, 0x96, 0x06, 0x13, 0x9F, 0xC7, 0x54, 0x1F, 0x60, 0x5A, 0xD0,
+    0xAC, 0x68, 0x4E, 0x49, 0xF3, 0x51, 0x82, 0x40, 0xA4, 0x5D, 0x34, 0x2E, 0xAA, 0x1A, 0xE3, 0x07,
+    0x0D, 0xF2, 0xFE, 0xD6, 0x26, 0xEE, 0x25, 0x60, 0x39, 0xA0, 0x95, 0x90, 0x1B, 0xCA, 0x0C, 0x82,
+    0xB6, 0x14, 0x78, 0xA8, 0x53, 0x99, 0x01, 0x73, 0x60, 0x44, 0x9D, 0xDF, 0xEE, 0xBF, 0x7F, 0x2B,
+    0xC5, 0x3F, 0xFC, 0xC7, 0xA3, 0x2E, 0x55, 0xD7, 0x87, 0x56, 0x3E, 0xEC, 0xE5, 0x00, 0x8D, 0xBD,
+    0xED, 0xE2, 0x5E, 0x93, 0x3F, 0xD3, 0x33, 0x22, 0xF3, 0x32, 0x45, 0xB5, 0x62, 0xF2, 0x9F, 0x0F,
+    0xCA, 0xB1, 0xA8, 0x89, 0x7D, 0x2D, 0x66, 0xA3, 0x68, 0xD2, 0x36, 0x07, 0x8E, 0xDF, 0x37, 0x20,
+    0xD0, 0xED, 0x47, 0x9C, 0x46, 0xE0, 0x60, 0xBE, 0x85, 0x1C, 0x59, 0xB6, 0x3A, 0xF3, 0x5F, 0x06,
+    0x52, 0x91, 0x23, 0xE0, 0xF4, 0x8A, 0x1D, 0xA4, 0x16, 0x09, 0x31, 0x0A, 0x23, 0x1A, 0xB9, 0xAD,
+    0x80, 0x57, 0xBE, 0x7B, 0x2A, 0xA5, 0x8D, 0xE9, 0x20, 0x78, 0xD0, 0xE4, 0x77, 0x7F, 0x78, 0x82,
+    0x91, 0xFB, 0xB9, 0x84, 0x44, 0xFC, 0x82, 0x9B, 0x29, 0x31, 0xD1, 0xA1, 0x91, 0x2D, 0x7C, 0x80,
+    0x37, 0xF8, 0x62, 0x29, 0xE1, 0xC3, 0x26, 0x57, 0x51, 0x4E, 0x7A, 0xB7, 0xC3, 0x57, 0xDA, 0xBD,
+    0x46, 0x0E, 0x63, 0x64, 0x50, 0x7D, 0xE4, 0x09, 0x3F, 0x02, 0xFC, 0x05, 0x13, 0xF5, 0x17, 0xF7,
+    0x59, 0x81, 0x61, 0xF2, 0xCF, 0xCD, 0xFA, 0x1F, 0x06, 0xCB, 0xFC, 0xC9, 0x6F, 0x32, 0x76, 0x6E,
+    0xB1, 0x38, 0x13, 0xF4, 0xBF, 0x01, 0xC5, 0x55, 0x31, 0x6F, 0x1E, 0x45, 0x10, 0x9D, 0xBD, 0xB5,
+    0x7C, 0x12, 0x5B, 0xAC, 0x8B, 0x44, 0x91, 0x00, 0xE5, 0x28, 0x91, 0x40, 0xD9, 0x96, 0x22, 0xF6,
+    0x6D, 0x40, 0xD4, 0xA6, 0x81, 0x14, 0x29, 0xDC, 0xD3, 0xB8, 0x01, 0x89, 0xC2, 0xFE, 0xEE, 0x14,
+    0xFF, 0x00, 0xFF, 0x00, 0x04, 0xA4, 0x0E, 0x05, 0x4D, 0x0A, 0x4B, 0xB1, 0xFD, 0x9D, 0x14, 0x21,
+    0x0A, 0x37, 0x27, 0x47, 0x40, 0x99, 0x13, 0x20, 0x21, 0x99, 0xE6, 0x50, 0x56, 0xCA, 0x19, 0xF6,
+    0x6E, 0x79, 0xB3, 0x7B, 0x4E, 0x6C, 0xF8, 0x01, 0x9C, 0xBE, 0x1B, 0xAD, 0xBE, 0xDD, 0x99, 0x7D,
+    0x33, 0xEF, 0xCD, 0x1C, 0xD1, 0xC5, 0xF3, 0x26, 0x1B, 0xD9, 0xB2, 0xDD, 0x61, 0xA3, 0x1A, 0x19,
+    0x42, 0x18, 0xA8, 0x84, 0xB5, 0xB4, 0x7D, 0xF6, 0xF0, 0x01, 0x65, 0x8E, 0x37, 0xCA, 0x78, 0xB0,
+    0x67, 0x5B, 0xC5, 0x83, 0x1D, 0xDB, 0x91, 0x8D, 0x6E, 0xD8, 0x7A, 0x36, 0x05, 0x2F, 0xB3, 0x21,
+    0x3A, 0xD8, 0xAB, 0x0E, 0x79, 0x74, 0x38, 0x8E, 0x0E, 0xED, 0x55, 0x07, 0x13, 0x70, 0x4C, 0x85,
+    0x90, 0x20, 0xAD, 0xE0, 0xDD, 0xE0, 0x7F, 0x79, 0x1B, 0xEF, 0x2D, 0x5A, 0x06, 0x9F, 0x85, 0xD0,
+    0x89, 0xAD, 0x1F, 0x19, 0x60, 0xBA, 0x50, 0xD7, 0xE9, 0x2D, 0x6C, 0x3A, 0x65, 0x66, 0x8C, 0xEC,
+    0xB9, 0x8E, 0xF7, 0x90, 0xE8, 0x73, 0xDC, 0xB0, 0x44, 0xE4, 0xAA, 0x4D, 0x41, 0x63, 0x52, 0xB5,
+    0x86, 0xE9, 0x90, 0xD9, 0xB7, 0x8E, 0x54, 0x8B, 0x63, 0x80, 0x68, 0x18, 0x0C, 0x02, 0x57, 0x94,
+    0xB5, 0x64, 0x6A, 0xFA, 0x28, 0x21, 0x8C, 0xE0, 0x3F, 0x19, 0x3F, 0x8E, 0x8E, 0x0D, 0xBD, 0xB6,
+    0x3C, 0x7B, 0x40, 0x97, 0x76, 0x44, 0x4C, 0x60, 0xC1, 0x06, 0x3E, 0xFF, 0xD9, 0x51, 0xC1, 0xB3,
+    0x99, 0xE6, 0x42, 0x67, 0xA1, 0x43, 0x0E, 0xF5, 0xE2, 0x7D, 0xAF, 0xE2, 0x49, 0x4F, 0xD6, 0xD4,
+    0xC5, 0x66, 0x4F, 0xD5, 0x40, 0xB9, 0xE7, 0x6D, 0x9A, 0xB4, 0x2D, 0x6A, 0x92, 0x8E, 0xDE, 0x2E,
+    0xAD, 0xDA, 0x1B, 0x6F, 0xF4, 0x45, 0x18, 0xA9, 0x42, 0x80, 0x6B, 0x33, 0x76, 0x62, 0xEC, 0x0D,
+    0x63, 0xEF, 0x19, 0xFB, 0xC0, 0xB7, 0xAD, 0x73, 0x28, 0xCD, 0x35, 0x16, 0x57, 0x71, 0x5C, 0x67,
+    0x7A, 0x10, 0x80, 0xAA, 0x10, 0x90, 0xD5, 0x6F, 0x85, 0xE7, 0x9D, 0xA5, 0x85, 0x8F, 0xEE, 0x80,
+    0x50, 0x0E, 0x8C, 0xFD, 0x98, 0x8C, 0x85, 0x1B, 0x76, 0x54, 0x87, 0x1D, 0xE9, 0x18, 0xBB, 0x57,
+    0xC1, 0x51, 0xA5, 0xE0, 0x9C, 0x02, 0x36, 0x17, 0x7C, 0x2B, 0x64, 0xF7, 0xA8, 0xE8, 0x19, 0x4D,
+    0x64, 0x8C, 0xFF, 0xFB, 0x94, 0x09, 0x08, 0xC1, 0x99, 0x10, 0xFA, 0xD5, 0xF1, 0x6E, 0x2F, 0x86,
+    0xAC, 0xCB, 0x9C, 0x68, 0xB8, 0x12, 0xF1, 0xC5, 0xA1, 0xFC, 0xF7, 0xD0, 0x80, 0xDF, 0x5E, 0x4F,
+    0xDB, 0x5E, 0x37, 0x99, 0x07, 0x71, 0x23, 0x52, 0x1D, 0x71, 0xF7, 0x08, 0xD2, 0xC6, 0x8D, 0xA4,
+    0x06, 0xBC, 0x2C, 0x36, 0xF6, 0x52, 0x6D, 0xD6, 0x98, 0x5A, 0xFE, 0x35, 0x91, 0x04, 0x16, 0x7A,
+    0x88, 0x4B, 0x84, 0x8D, 0x85, 0x04, 0x39, 0x03, 0x72, 0xAA, 0x15, 0xF2, 0x19, 0x21, 0x0D, 0x5B,
+    0x62, 0x11, 0x28, 0x77, 0x84, 0x82, 0xAF, 0x14, 0x75, 0xDE, 0xC9, 0x61, 0x8D, 0x75, 0xA2, 0x5A,
+    0x15, 0x2B, 0xD1, 0xEA, 0x86, 0x45, 0x42, 0x59, 0xAF, 0x9B, 0x8D, 0x18, 0xA2, 0xD7, 0x75, 0x94,
+    0x28, 0x1D, 0x14, 0xF7, 0xA3, 0x40, 0x69, 0xC7, 0x7C, 0x10, 0x45, 0x4C, 0xAC, 0x90, 0x44, 0x17,
+    0x57, 0x9A, 0x65, 0xEB, 0x16, 0x49, 0xAE, 0xBA, 0xDD, 0xCD, 0xE3, 0xE1, 0xB2, 0x39, 0x92, 0xB1,
+    0x25, 0x02, 0xF9, 0x8C, 0x61, 0x67, 0x23, 0x90, 0x73, 0x27, 0xA8, 0x41, 0x0C, 0xB4, 0x64, 0x3D,
+    0xA0, 0x02, 0x54, 0xE1, 0xD2, 0x65, 0x93, 0xF5, 0x70, 0x40, 0x38, 0xCE, 0x4A, 0xE3, 0xE7, 0x81,
+    0xDD, 0xAA, 0x09, 0x47, 0x70, 0x17, 0xFE, 0xAF, 0x45, 0xD2, 0x47, 0x59, 0xCF, 0x42, 0x29, 0xE9,
+    0xDF, 0x8B, 0xDD, 0x8B, 0xC5, 0xCE, 0xC5, 0xE2, 0x8B, 0x8B, 0xC5, 0x5B, 0x2F, 0x1B, 0x59, 0x39,
+    0x7A, 0x44, 0xA6, 0x2D, 0x02, 0xDD, 0xA6, 0xD2, 0xEB, 0xEF, 0x3A, 0x43, 0xE5, 0xB1, 0xB2, 0x28,
+    0xF7, 0x3A, 0x2A, 0x67, 0x74, 0x77, 0x8B, 0x93, 0x39, 0x71, 0xDC, 0x27, 0xE2, 0xF9, 0x61, 0xAC,
+    0xC8, 0xE3, 0x6F, 0x52, 0xFB, 0x9D, 0xEC, 0x33, 0x91, 0xFA, 0xE9, 0xB3, 0x03, 0x3E, 0xD3, 0x06,
+    0xEE, 0x1F, 0xD9, 0x55, 0x9B, 0x35, 0x17, 0xCD, 0xEC, 0x75, 0xD2, 0x0A, 0xD4, 0xCE, 0xCB, 0xD3,
+    0x33, 0x27, 0x5B, 0xF3, 0x65, 0x1F, 0x9C, 0xE8, 0x65, 0x18, 0x4C, 0x4F, 0x07, 0x54, 0x7D, 0x4D,
+    0x1C, 0x4A, 0xA8, 0x84, 0x3F, 0x4B, 0xF5, 0xE4, 0xF6, 0xA3, 0xB9, 0x1B, 0x5F, 0xA5, 0x52, 0x5A,
+    0xBA, 0xFC, 0xAC, 0x62, 0xCE, 0x40, 0xD1, 0x8D, 0x3C, 0xBF, 0xE7, 0x09, 0xF5, 0x42, 0x7E, 0xBA,
+    0xBD, 0x09, 0x09, 0x48, 0x1B, 0xE5, 0x50, 0xCD, 0x2E, 0x55, 0x0D, 0xBD, 0x59, 0x1C, 0xED, 0x48,
+    0xDC, 0xE3, 0x7E, 0x32, 0x20, 0x44, 0x0E, 0xF3, 0x34, 0x31, 0x7B, 0x0D, 0xE9, 0xD3, 0x9E, 0xF2,
+    0x7E, 0x02, 0x59, 0xC6, 0x6D, 0x0D, 0x98, 0x60, 0x0E, 0x33, 0x05, 0x39, 0xDD, 0x60, 0xE6, 0x0E,
+    0x12, 0x8E, 0x15, 0x6D, 0x29, 0x07, 0xA7, 0x82, 0x79, 0x7D, 0xDD, 0xBE, 0xEC, 0x4A, 0x01, 0x04,
+    0xE5, 0x9D, 0x31, 0xB7, 0x79, 0xB7, 0xC6, 0xA5, 0x86, 0xDA, 0x41, 0xDE, 0x3B, 0x68, 0x10, 0x44,
+    0xB8, 0x8E, 0xBB, 0xB9, 0x23, 0xF4, 0x13, 0x2B, 0xFC, 0x21, 0x95, 0xFB, 0x5D, 0xD1, 0x2F, 0xC3,
+    0x90, 0x85, 0x73, 0xA2, 0x2D, 0x56, 0x12, 0x71, 0xEF, 0xFD, 0xD4, 0x11, 0xBA, 0x8B, 0xC2, 0xA5,
+    0xF4, 0xAE, 0x01, 0x2E, 0xB4, 0x80, 0x69, 0x3A, 0x12, 0x7A, 0xE5, 0x0D, 0xA8, 0x73, 0xE0, 0xB8,
+    0xD3, 0x0A, 0x0F, 0xCD, 0xA3, 0x58, 0x93, 0xDD, 0x38, 0xFF, 0x36, 0x62, 0x73, 0xB1, 0x95, 0x91,
+    0x1C, 0xF2, 0x3A, 0xD6, 0x6A, 0xC9, 0x05, 0x2D, 0xB8, 0xCF, 0xB0, 0x3D, 0xC6, 0xED, 0xC8, 0x96,
+    0x8F, 0x23, 0xA6, 0x8A, 0xB9, 0x17, 0x35, 0xF7, 0xA6, 0xEA, 0x58, 0x86, 0x32, 0x29, 0xCE, 0xB3,
+    0xCA, 0x78, 0x1A, 0xB0, 0xB8, 0x02, 0x19, 0x07, 0xDB, 0x64, 0x49, 0xD4, 0x45, 0xFB, 0x6A, 0x88,
+    0x8B, 0xE1, 0x92, 0xB6, 0x4C, 0x92, 0x50, 0xC4, 0x2F, 0x12, 0x91, 0xAB, 0x90, 0xE8, 0x0F, 0xA1,
+    0x2E, 0xDD, 0xDD, 0xAE, 0xF4, 0xC2, 0x95, 0x77, 0xD0, 0x23, 0x38, 0x88, 0x51, 0xAB, 0xF7, 0x11,
+    0xE3, 0x19, 0xEA, 0xF2, 0x37, 0x02, 0x2D, 0x41, 0x74, 0x09, 0xA1, 0xE8, 0x27, 0x60, 0xA0, 0x5B,
+    0xD0, 0xA9, 0xD3, 0xED, 0x70, 0x98, 0x4D, 0xBE, 0x04, 0x67, 0xBA, 0xCE, 0x5F, 0x00, 0xDF, 0x5A,
+    0x3F, 0x6B, 0xB7, 0xA0, 0x34, 0xBF, 0x79, 0x96, 0xC4, 0xDE, 0x9C, 0x1F, 0x61, 0x25, 0xE6, 0x64,
+    0x36, 0xC1, 0xA5, 0xE1, 0x6A, 0x6D, 0x83, 0xF0, 0x89, 0xAB, 0xA5, 0x5B, 0x8B, 0x3A, 0xCD, 0x33,
+    0x81, 0xA1, 0x2E, 0x6E, 0x83, 0x45, 0x52, 0x4F, 0xF7, 0x58, 0xB0, 0xE3, 0x67, 0xAC, 0x32, 0x7D,
+    0xB2, 0xC9, 0x31, 0xA6, 0xD0, 0xC6, 0x7A, 0xB1, 0x3E, 0x32, 0xF7, 0x2B, 0x5F, 0x59, 0xDE, 0xC4,
+    0x8C, 0x21, 0xF9, 0x67, 0x1B, 0xC5, 0xF4, 0x2E, 0xDF, 0x9A, 0xFF, 0x52, 0xB3, 0x16, 0x8F, 0xE2,
+    0x37, 0x0A, 0xB5, 0x4B, 0x93, 0x18, 0x9D, 0xCC, 0x1F, 0x22, 0x48, 0x8A, 0xBF, 0x44, 0xA6, 0x8B,
+    0x53, 0x7B, 0x66, 0x73, 0xE6, 0x74, 0x1B, 0x14, 0xA3, 0x1C, 0x59, 0xF8, 0x70, 0x41, 0x06, 0xF5,
+    0x10, 0x6E, 0x2D, 0xFF, 0x1E, 0x58, 0xCC, 0x7B, 0x00, 0x77, 0xFE, 0x33, 0xC6, 0xF6, 0x1F, 0x87,
+    0x33, 0x5D, 0x87, 0x2F, 0x5A, 0x92, 0xCF, 0xF7, 0x11, 0xFC, 0x2B, 0xCC, 0xB7, 0xC5, 0x5A, 0x49,
+    0xF7, 0x1D, 0x1D, 0x29, 0x24, 0x3E, 0x0D, 0x48, 0x26, 0x34, 0x98, 0xDB, 0x8C, 0x48, 0xD0, 0xFF,
+    0xF6, 0xFC, 0x03, 0xAD, 0x95, 0xBF, 0x6F, 0xE4, 0x44, 0x14, 0xC7, 0x9F, 0x3D, 0xB9, 0xB8, 0xB0,
+    0xC4, 0x20, 0xC1, 0x49, 0x48, 0x57, 0xF8, 0x2F, 0x40, 0xF3, 0x0F, 0x90, 0xB5, 0x73, 0x94, 0x34,
+    0x57, 0x70, 0xD7, 0x50, 0x5C, 0x0D, 0x42, 0xA4, 0xA1, 0x4C, 0xD6, 0x73, 0x77, 0x42, 0x57, 0x50,
+    0x40, 0x43, 0x45, 0x4B, 0x95, 0x93, 0xA0, 0xA5, 0x48, 0x6C, 0x47, 0x94, 0x14, 0x18, 0x22, 0x51,
+    0xFB, 0x10, 0x88, 0x82, 0x02, 0x9F, 0x34, 0x91, 0x9C, 0xAC, 0xBD, 0x8F, 0xEF, 0x9B, 0xB1, 0x37,
+    0xD0, 0xB3, 0xD2, 0xCE, 0xC8, 0x33, 0xCF, 0xEF, 0xC7, 0xE7, 0xFD, 0x30, 0x11, 0x7E, 0x6F, 0x92,
+    0xE6, 0x81, 0xEA, 0x46, 0xF1, 0x44, 0xDC, 0xD3, 0x3D, 0x47, 0x78, 0x8C, 0x1D, 0x6D, 0xF7, 0x88,
+    0x26, 0x3A, 0x27, 0xCA, 0xD8, 0x9D, 0x10, 0xA5, 0x3C, 0xAE, 0x20, 0x9D, 0x76, 0xB2, 0x2A, 0x67,
+    0xE4, 0xD5, 0x51, 0xCB, 0x9A, 0xD7, 0x96, 0x44, 0xAA, 0xF7, 0xD7, 0x93, 0xBF, 0xCE, 0x1A, 0xB9,
+    0x56, 0x0E, 0x6B, 0x49, 0x95, 0x5C, 0x5B, 0xDD, 0xCA, 0x75, 0x3C, 0xCA, 0x35, 0x95, 0x05, 0xAE,
+    0x49, 0xF7, 0x72, 0x1D, 0x31, 0xC5, 0xCC, 0x64, 0x7A, 0xAC, 0x4D, 0xBC, 0x15, 0x95, 0x04, 0xDB,
+    0x74, 0x97, 0x70, 0x0E, 0x3D, 0x5E, 0xF1, 0x19, 0xFE, 0x62, 0x59, 0xE3, 0xC5, 0x04, 0x9A, 0x6A,
+    0x3E, 0x1C, 0x73, 0xBE, 0xE0, 0x62, 0x05, 0x19, 0x7D, 0xE8, 0x5E, 0x4F, 0x2E, 0x7A, 0x8A, 0x5F,
+    0x41, 0x74, 0xC0, 0xFF, 0x60, 0x80, 0xC5, 0x1A, 0xF6, 0x36, 0x2D, 0xAC, 0xE1, 0x61, 0x84, 0xBF,
+    0xEB, 0xA4, 0xDB, 0x33, 0xC5, 0xF4, 0x5A, 0xDA, 0x64, 0x7F, 0xBF, 0xDB, 0x2B, 0xB6, 0x03, 0xE5,
+    0xF0, 0x3C, 0xA2, 0xF0, 0xBB, 0x13, 0x31, 0xB3, 0x4D, 0x47, 0xC3, 0xEC, 0x14, 0xFF, 0x70, 0xF3,
+    0x9D, 0x80, 0x58, 0x01, 0x41, 0x7E, 0xA8, 0x1A, 0xDD, 0xA4, 0x2D, 0xBD, 0x43, 0x63, 0xE4, 0x48,
+    0xD9, 0xAC, 0x11, 0x4F, 0xE2, 0x41, 0x4B, 0xDC, 0xF9, 0x7D, 0x71, 0x4F, 0xF5, 0xC7, 0xB7, 0x28,
+    0x12, 0x1E, 0xE5, 0xA1, 0xD2, 0x02, 0x41, 0xB7, 0x95, 0x47, 0xA5, 0x44, 0x2C, 0x6B, 0x8C, 0x95,
+    0x37, 0x49, 0x04, 0x4C, 0x21, 0xF1, 0xCF, 0x30, 0x72, 0x52, 0x38, 0x4B, 0x7B, 0xCA, 0x7A, 0x41,
+    0x4D, 0xB5, 0xFD, 0x17, 0x8D, 0xC5, 0xC5, 0x9C, 0x8B, 0xEC, 0x92, 0xC7, 0x88, 0xBF, 0xBD, 0xDF,
+    0x9B, 0x69, 0xD0, 0x4F, 0x86, 0x37, 0xFA, 0x83, 0xAC, 0x50, 0x4F, 0x7A, 0x80, 0x4E, 0x7F, 0x82,
+    0x9A, 0x95, 0x70, 0xDA, 0xE0, 0x49, 0x6D, 0x3A, 0x98, 0xFB, 0x1C, 0x1E, 0x9C, 0x65, 0x05, 0xDC,
+    0xCB, 0xC9, 0x6A, 0x5B, 0xA5, 0x74, 0x82, 0xA0, 0x62, 0x17, 0x81, 0x59, 0x13, 0x8F, 0x3B, 0xB5,
+    0x9D, 0x24, 0x40, 0x33, 0x22, 0x66, 0x4B, 0x47, 0x2D, 0xC5, 0xC8, 0x22, 0x02, 0x96, 0xCC, 0x49,
+    0x0E, 0x73, 0x9F, 0x2D, 0x92, 0x78, 0x4A, 0x89, 0x15, 0xBE, 0x5B, 0x8A, 0x06, 0x09, 0x2E, 0xC8,
+    0xF4, 0x41, 0x06, 0x00, 0x25, 0x61, 0x25, 0x36, 0x91, 0xF9, 0xEA, 0xE1, 0xA3, 0x59, 0xE6, 0x7C,
+    0x27, 0x13, 0xCD, 0x7A, 0xD6, 0xC0, 0x14, 0xF4, 0xC4, 0xB3, 0xCC, 0x34, 0xCB, 0x90, 0x97, 0xC9,
+    0x5A, 0x60, 0x70, 0x48, 0x73, 0x2B, 0x34, 0x4A, 0x76, 0x01, 0xC4, 0xEC, 0xF2, 0x3A, 0x6C, 0xA6,
+    0xF0, 0x5B, 0xDA, 0xF8, 0x4D, 0x75, 0xE1, 0xB4, 0x0F, 0xDB, 0x5B, 0x73, 0x74, 0x47, 0x3D, 0xAD,
+    0x12, 0xB8, 0x35, 0xDC, 0x29, 0x29, 0xE9, 0xE0, 0xB5, 0x29, 0x50, 0x40, 0x23, 0x19, 0x31, 0x87,
+    0x1A, 0xB4, 0xEA, 0xE6, 0x74, 0x42, 0xF9, 0xC2, 0x44, 0xF5, 0xF0, 0x71, 0x83, 0xC3, 0x1C, 0x1E,
+    0x42, 0x6E, 0x05, 0x04, 0x3F, 0x3B, 0x32, 0xFA, 0xBD, 0x86, 0xB6, 0x23, 0x12, 0xC4, 0xDD, 0x40,
+    0xE9, 0x9F, 0x48, 0xE0, 0x9E, 0xAF, 0x7E, 0x41, 0x1D, 0x8B, 0x31, 0x5F, 0x07, 0x23, 0x85, 0x30,
+    0x6E, 0x81, 0x2E, 0x44, 0x61, 0x5B, 0x90, 0x6E, 0x5F, 0xF4, 0x33, 0xD3, 0xB3, 0x19, 0xEA, 0x6A,
+    0xA6, 0xAA, 0x67, 0xAC, 0xCA, 0x7A, 0xAE, 0x8B, 0xA6, 0x8A, 0x6E, 0xC9, 0x2E, 0x68, 0x17, 0xB6,
+    0x0B, 0xDC, 0x85, 0xEE, 0x4E, 0x70, 0xE1, 0xBB, 0x00, 0x5E, 0x08, 0x2F, 0x88, 0x17, 0xC6, 0x0B,
+    0xE4, 0x99, 0xB2, 0xA5, 0x80, 0x79, 0x0E, 0xC0, 0x53, 0xCB, 0xF9, 0x39, 0x4C, 0x32, 0x7F, 0x06,
+    0x6E, 0x7F, 0x7C, 0xE2, 0xC1, 0x39, 0x21, 0xA7, 0x1B, 0x41, 0x77, 0xE0, 0xD9, 0x91, 0x87, 0x17,
+    0xE8, 0x79, 0x7C, 0xE4, 0xF9, 0x05, 0x80, 0x9E, 0xA0, 0x8D, 0x04, 0xA1, 0xE4, 0x68, 0x3B, 0x48,
+    0x95, 0xC3, 0x14, 0x28, 0xBA, 0xA5, 0xC9, 0x61, 0x25, 0x44, 0xA4, 0x64, 0x97, 0x72, 0x4F, 0xB6,
+    0xA7, 0x2F, 0x26, 0x7F, 0x53, 0x90, 0x1F, 0x23, 0xD0, 0xE8, 0x23, 0x10, 0xBD, 0x9E, 0x05, 0xE2,
+    0xF2, 0xDD, 0x24, 0x84, 0x24, 0x14, 0x89, 0x2D, 0xF1, 0xC9, 0x47, 0x4C, 0xE7, 0xD1, 0xFB, 0x9E,
+    0x80, 0xFE, 0x15, 0x63, 0x4C, 0x9C, 0x80, 0xDA, 0x4E, 0x28, 0x64, 0xD7, 0xFB, 0x5C, 0x00, 0x3C,
+    0xCA, 0x5E, 0x89, 0x27, 0x52, 0x3D, 0xA6, 0x09, 0xBA, 0x00, 0x63, 0xED, 0x75, 0x65, 0xD2, 0xE7,
+    0xC2, 0x6D, 0x14, 0x58, 0x95, 0x1C, 0x88, 0xAE, 0x16, 0x12, 0xD2, 0x2E, 0x38, 0x33, 0x4F, 0x79,
+    0x8A, 0xE1, 0xA8, 0x72, 0x35, 0x37, 0x48, 0x74, 0xF0, 0xC0, 0x8F, 0x3E, 0xFA, 0x4F, 0x8D, 0x06,
+    0x5F, 0x89, 0x3A, 0x13, 0xA0, 0x9A, 0xA5, 0x86, 0x79, 0x16, 0xD8, 0xFF, 0x66, 0x81, 0x1D, 0xD5,
+    0xD6, 0xE0, 0xED, 0x72, 0xC8, 0x18, 0x1D, 0xF2, 0xF8, 0xF9, 0x06, 0x6E, 0x47, 0x57, 0x4E, 0xCA,
+    0x3B, 0x3B, 0xC1, 0x28, 0xA6, 0x78, 0x53, 0x88, 0x99, 0xBC, 0x53, 0xAF, 0x2A, 0x19, 0x14, 0x25,
+    0x1C, 0x28, 0x8B, 0x84, 0x6B, 0x87, 0x89, 0x51, 0x51, 0xDE, 0x4C, 0x42, 0x7C, 0x82, 0xAB, 0x48,
+    0xCA, 0xCB, 0x01, 0xD3, 0x96, 0x2A, 0x53, 0xE0, 0xCD, 0xF4, 0xB7, 0x1E, 0x85, 0x4E, 0x55, 0x2E,
+    0x51, 0xA6, 0x97, 0x1D, 0x85, 0x9A, 0xA3, 0xB9, 0x48, 0x28, 0x0A, 0x3E, 0x85, 0x18, 0xA4, 0x3A,
+    0xE9, 0x6D, 0xCF, 0x5A, 0xDD, 0x6C, 0xE7, 0x81, 0x23, 0xDB, 0x47, 0x7E, 0x7D, 0x20, 0xCB, 0x3D,
+    0x96, 0xB5, 0xBC, 0x96, 0xB5, 0x6E, 0xF6, 0x21, 0xC5, 0x45, 0x8A, 0xFC, 0xD5, 0xA4, 0xBB, 0x1A,
+    0x3E, 0xE9, 0x56, 0xB7, 0xB9, 0x4D, 0xBA, 0x78, 0xC8, 0xA4, 0x95, 0x2A, 0xDD, 0x81, 0x87, 0x79,
+    0x86, 0xDE, 0xA2, 0xF4, 0xE5, 0x08, 0x26, 0xE0, 0x26, 0xB6, 0x27, 0x23, 0xD7, 0x65, 0x2A, 0x2D,
+    0x68, 0x9E, 0x8E, 0xBE, 0xE7, 0x70, 0xD1, 0xA6, 0x5D, 0xD6, 0xC6, 0x03, 0x7A, 0x01, 0x41, 0x22,
+    0x59, 0x75, 0xA1, 0x2F, 0x07, 0xD2, 0x18, 0x58, 0x48, 0x26, 0x7F, 0x99, 0x0F, 0xBE, 0xD6, 0xF8,
+    0x14, 0xAF, 0xF2, 0xD7, 0x80, 0x8F, 0xAF, 0xD7, 0x5D, 0x0A, 0xDF, 0x0A, 0xCA, 0x10, 0x58, 0x72,
+    0xBD, 0xFF, 0x3B, 0x9A, 0x89, 0x5D, 0xD2, 0xEB, 0x67, 0x18, 0x7A, 0x63, 0xF2, 0x0B, 0x6A, 0x36,
+    0xFB, 0x02, 0x25, 0xBB, 0x5E, 0x61, 0x7C, 0x5F, 0x0D, 0xAA, 0x4B, 0x7F, 0x6C, 0xB5, 0xCD, 0x8D,
+    0x5D, 0x45, 0xAE, 0x42, 0x35, 0x5F, 0x60, 0x34, 0x9F, 0x29, 0x97, 0xFC, 0xD5, 0xA6, 0x4E, 0x4F,
+    0xE8, 0x03, 0xBE, 0xFA, 0x38, 0xE1, 0x0D, 0x4A, 0xFF, 0x41, 0x08, 0x39, 0x24, 0xAF, 0x93, 0x8F,
+    0xD4, 0x96, 0xB2, 0x9B, 0x0F, 0x80, 0xDE, 0xD2, 0x49, 0x84, 0x5A, 0x38, 0x96, 0x3E, 0x3E, 0x96,
+    0xC4, 0x7F, 0xEA, 0x71, 0x1A, 0xBB, 0xA4, 0xDD, 0x03, 0x2D, 0x77, 0x4B, 0xBD, 0x5B, 0x6E, 0xCF,
+    0x72, 0x2F, 0x0C, 0xE4, 0x5D, 0x86, 0x86, 0xC0, 0x98, 0x3B, 0x65, 0x99, 0xF9, 0x50, 0x7B, 0x24,
+    0x81, 0x91, 0x2F, 0xF9, 0xEF, 0x97, 0xA5, 0x90, 0x44, 0xF9, 0xCE, 0xF7, 0x3D, 0xFA, 0x21, 0xFD,
+    0x1F, 0xBF, 0x7F, 0x00, 0xAD, 0x55, 0x31, 0x8F, 0xDC, 0x54, 0x10, 0x9E, 0xE7, 0x17, 0xCE, 0x12,
+    0xD6, 0xC9, 0x50, 0xA4, 0x22, 0x8A, 0x7F, 0x82, 0x5B, 0x84, 0xF6, 0xD6, 0x86, 0x36, 0x4D, 0x0A,
+    0x56, 0x29, 0x28, 0xAE, 0xA7, 0xA1, 0xA1, 0x48, 0x91, 0xAC, 0x2D, 0x52, 0xA4, 0x4D, 0x9F, 0x3F,
+    0x10, 0xA5, 0x09, 0x45, 0x8A, 0x14, 0xB7, 0x6B, 0x77, 0x14, 0x14, 0xB1, 0xC4, 0x0F, 0xC0, 0xA2,
+    0x3C, 0x40, 0x79, 0x80, 0x23, 0x1C, 0x62, 0x7B, 0xF8, 0x66, 0x9E, 0xBD, 0xB9, 0x08, 0x45, 0x10,
+    0x94, 0xA7, 0xD3, 0xBC, 0xF5, 0xED, 0x78, 0x66, 0xBE, 0x6F, 0xBE, 0x99, 0x25, 0x22, 0x32, 0xDC,
+    0x58, 0x1E, 0xEC, 0x8B, 0xBD, 0x75, 0x26, 0x70, 0x44, 0x3D, 0xD1, 0x19, 0x51, 0x46, 0x94, 0x94,
+    0x14, 0xB6, 0x14, 0xE0, 0x79, 0x4F, 0x94, 0xD6, 0x74, 0xD7, 0x05, 0x8E, 0xEF, 0x77, 0x29, 0xBB,
+    0x80, 0x1B, 0x7A, 0x0F, 0xAE, 0x2B, 0xA2, 0x98, 0xEC, 0xB5, 0xD2, 0x70, 0x4D, 0x59, 0x43, 0x72,
+    0x12, 0xC6, 0x49, 0xC5, 0x64, 0x0F, 0xAB, 0x87, 0xFB, 0x35, 0xDE, 0x3D, 0x59, 0xD1, 0x8E, 0x56,
+    0x2B, 0x1A, 0x69, 0xF5, 0x31, 0x0D, 0xF4, 0x35, 0x99, 0x01, 0x8E, 0x12, 0x97, 0x6C, 0x27, 0xC6,
+    0x2D, 0x26, 0x14, 0x13, 0xB5, 0x30, 0xB1, 0x44, 0x8B, 0xEB, 0xC5, 0xA0, 0x14, 0x94, 0x20, 0x26,
+    0xCB, 0x61, 0x8A, 0x7B, 0x70, 0xE3, 0x09, 0xFF, 0x12, 0x43, 0x88, 0x8C, 0x33, 0x1C, 0x8C, 0x04,
+    0x35, 0x12, 0xCA, 0x48, 0x28, 0x2A, 0x69, 0x39, 0x1F, 0xF5, 0xC1, 0x48, 0x45, 0x5D, 0xF4, 0x09,
+    0x03, 0xC2, 0xE5, 0xBE, 0xA8, 0xE2, 0x67, 0xAD, 0x79, 0xDE, 0x65, 0xEB, 0xB0, 0x35, 0x7F, 0x36,
+    0xEB, 0x27, 0x51, 0x13, 0xBC, 0xCC, 0x33, 0x17, 0xD5, 0x76, 0x82, 0x5F, 0x5C, 0xDB, 0x81, 0xAA,
+    0x3C, 0x2E, 0xC3, 0x8E, 0x98, 0x92, 0x3C, 0x72, 0xC8, 0x94, 0xA2, 0x36, 0x00, 0xC8, 0x50, 0x58,
+    0xD0, 0xD1, 0x1A, 0xA5, 0xA1, 0xF4, 0xDB, 0xC7, 0x69, 0x8E, 0xEB, 0xEC, 0x24, 0x15, 0xCA, 0xA6,
+    0x21, 0xA3, 0xA8, 0x21, 0xEE, 0xD7, 0x52, 0xFD, 0xFE, 0xA6, 0xE6, 0xFE, 0xE0, 0x89, 0xAF, 0xE1,
+    0xEC, 0xB5, 0xAB, 0x57, 0xAB, 0xE0, 0x67, 0xA8, 0x72, 0x2A, 0xAE, 0x33, 0xFE, 0x91, 0x7B, 0xCB,
+    0x7D, 0xD2, 0x51, 0xD8, 0x53, 0x45, 0xB4, 0x15, 0xB2, 0xE0, 0x91, 0x4A, 0x3E, 0x14, 0xB0, 0x13,
+    0x92, 0x84, 0x97, 0xBD, 0xBC, 0x6D, 0x9D, 0x04, 0xCC, 0x4E, 0x73, 0xE9, 0xA7, 0x12, 0xA8, 0x4C,
+    0x54, 0xB4, 0x10, 0x2A, 0xFE, 0x33, 0xAD, 0x9E, 0xA4, 0xA4, 0x5E, 0x9A, 0x40, 0x59, 0xA9, 0x39,
+    0x1B, 0xE9, 0xDE, 0x38, 0x97, 0x70, 0x04, 0x88, 0x77, 0x19, 0x90, 0x4F, 0x5B, 0x1A, 0x14, 0xAF,
+    0x20, 0x8E, 0x1B, 0xDB, 0x06, 0x3D, 0x54, 0xB2, 0x45, 0xE5, 0x71, 0x79, 0x0B, 0x79, 0xD7, 0x88,
+    0x97, 0x22, 0x46, 0x92, 0x53, 0xF4, 0xB4, 0xA4, 0x00, 0x52, 0xA0, 0xAA, 0x56, 0xC1, 0x08, 0x09,
+    0x1E, 0x9B, 0x64, 0x5C, 0x4B, 0x52, 0xD4, 0x17, 0xE1, 0x8B, 0xF0, 0x85, 0xE4, 0x82, 0x88, 0x36,
+    0xD7, 0xFF, 0x1F, 0x5A, 0x09, 0x98, 0x7E, 0xF5, 0x3A, 0xDA, 0x2F, 0xF9, 0x5C, 0x64, 0xC1, 0x70,
+    0xB8, 0x3C, 0x7D, 0x7E, 0xE0, 0xF3, 0xAD, 0xD0, 0x7E, 0x71, 0x11, 0x6D, 0xF4, 0x46, 0xB4, 0xE9,
+    0x45, 0xB4, 0x45, 0x4D, 0x47, 0xD5, 0x39, 0x59, 0xC6, 0xC3, 0x8D, 0xE7, 0xD7, 0xFF, 0x05, 0x2D,
+    0xC5, 0xDC, 0xC7, 0xA8, 0xB1, 0x10, 0xD4, 0x25, 0x01, 0x71, 0xDC, 0x2A, 0x5B, 0x3B, 0x55, 0xB7,
+    0x36, 0xAB, 0x42, 0x46, 0xA9, 0xDC, 0xB6, 0x5A, 0x75, 0xA6, 0x1A, 0xF9, 0x43, 0x45, 0x12, 0xB1,
+    0x97, 0x8A, 0x57, 0x4C, 0xA6, 0x08, 0x2D, 0xE7, 0xFA, 0x50, 0x88, 0x0D, 0x9C, 0x82, 0x4A, 0x3F,
+    0xD5, 0x21, 0xEB, 0x74, 0xC2, 0x92, 0x52, 0x26, 0x0B, 0xB8, 0xA4, 0xFF, 0x60, 0x05, 0x6C, 0x98,
+    0x51, 0x99, 0xA8, 0x38, 0x4F, 0xB8, 0x0F, 0x41, 0x04, 0x2B, 0x91, 0xF3, 0x80, 0xCD, 0xAC, 0x89,
+    0x98, 0x95, 0x3D, 0xCF, 0xD2, 0x2D, 0xB5, 0x81, 0x1F, 0xF4, 0xA3, 0x65, 0xA8, 0x8A, 0xDC, 0x8C,
+    0x96, 0xEB, 0x68, 0xB4, 0xCF, 0xDA, 0xF4, 0x17, 0xCC, 0xF0, 0x56, 0xE6, 0x1A, 0x54, 0x9B, 0xBF,
+    0xA4, 0x48, 0x61, 0x08, 0x43, 0x24, 0x8E, 0xE2, 0x2D, 0xA5, 0x06, 0xC0, 0x4D, 0xE1, 0x53, 0x7C,
+    0x11, 0x5F, 0x6B, 0x6E, 0xD2, 0x3A, 0xFC, 0xBD, 0xFB, 0x64, 0xB0, 0xEC, 0x32, 0x2C, 0x16, 0x07,
+    0x48, 0xA3, 0xBB, 0x44, 0xF4, 0xA1, 0x3B, 0x4C, 0xB1, 0x53, 0x58, 0xE4, 0xF5, 0x44, 0xA9, 0x2F,
+    0x30, 0xC4, 0x8A, 0xF9, 0x86, 0x27, 0xF4, 0x9B, 0xEF, 0xF0, 0x10, 0x9F, 0x4F, 0x8F, 0xF2, 0xA2,
+    0x8C, 0x3F, 0xEB, 0xE3, 0x1C, 0xAD, 0x0B, 0xBA, 0x44, 0x3A, 0x68, 0xDD, 0x55, 0x30, 0x79, 0x6C,
+    0xDD, 0x15, 0x61, 0x57, 0xC0, 0x8C, 0x3E, 0xC8, 0xE0, 0xC5, 0xE1, 0x2F, 0xD3, 0xEB, 0x85, 0x69,
+    0x96, 0x3D, 0x23, 0xFA, 0x42, 0x0A, 0xB9, 0x32, 0x5A, 0x2E, 0x79, 0x75, 0xEB, 0x5F, 0xDD, 0xFA,
+    0x57, 0x77, 0x87, 0x08, 0x78, 0xC7, 0x4C, 0x9B, 0x0D, 0x76, 0x92, 0xAE, 0x3D, 0x46, 0x67, 0xF5,
+    0xA2, 0xC3, 0x66, 0x5A, 0xD8, 0x5C, 0xAE, 0x4E, 0xAD, 0xF1, 0x2D, 0xF4, 0x3B, 0x4A, 0xB7, 0x94,
+    0xD9, 0x6C, 0x66, 0x51, 0x16, 0xEC, 0xE8, 0x9F, 0xE7, 0x88, 0x41, 0x43, 0x31, 0xA0, 0x7D, 0x37,
+    0x44, 0x93, 0xBA, 0x80, 0xE6, 0x4B, 0xE4, 0x0A, 0x1C, 0xB2, 0x77, 0x96, 0x4B, 0x77, 0x14, 0xE4,
+    0x0C, 0xF2, 0xC3, 0x36, 0x3A, 0xBB, 0x92, 0x94, 0xBB, 0xDF, 0x5C, 0x71, 0xFA, 0x1D, 0x97, 0x3C,
+    0x24, 0xBF, 0xA2, 0x07, 0x27, 0x8F, 0x09, 0x38, 0x75, 0xD1, 0x96, 0xB3, 0x62, 0xB5, 0x34, 0x99,
+    0x15, 0xD3, 0xCF, 0xCD, 0xE5, 0xBA, 0xE0, 0xEF, 0xB9, 0x8B, 0x20, 0x92, 0x8E, 0x22, 0xC9, 0x87,
+    0x8D, 0x0E, 0x91, 0x42, 0x49, 0xA3, 0x00, 0x02, 0x09, 0xF8, 0x1B, 0x44, 0x5C, 0x89, 0x8C, 0x2B,
+    0x6E, 0xAB, 0x92, 0x06, 0x6B, 0xD5, 0x79, 0xE5, 0x64, 0x2C, 0x26, 0x91, 0xED, 0xFD, 0xE6, 0xC0,
+    0x87, 0xCE, 0xA5, 0xFE, 0x08, 0xF8, 0x9D, 0x1E, 0x28, 0x21, 0xAA, 0xF2, 0xB0, 0x53, 0x8D, 0x8F,
+    0x22, 0x12, 0x19, 0xD1, 0xD9, 0x2D, 0x79, 0xE5, 0x96, 0xAA, 0xE2, 0x95, 0xB4, 0x95, 0xF2, 0xE7,
+    0xD7, 0x7B, 0xC0, 0xB9, 0xE9, 0x2A, 0x40, 0x37, 0xA7, 0x80, 0x6B, 0x3A, 0xBA, 0x0D, 0x4F, 0xEC,
+    0x71, 0x47, 0xC2, 0x43, 0x82, 0x0F, 0x58, 0x2C, 0xD9, 0xCF, 0xF0, 0xE2, 0x97, 0x8E, 0x82, 0x07,
+    0xD9, 0x12, 0x65, 0x7B, 0x8C, 0x84, 0x3F, 0xE0, 0xD3, 0x24, 0x6A, 0xD0, 0xED, 0x05, 0x9D, 0x9B,
+    0xB0, 0x9E, 0x97, 0xB4, 0x0C, 0xB0, 0x36, 0x4E, 0x74, 0xE7, 0xF7, 0xE7, 0x7F, 0x66, 0xE5, 0x7D,
+    0x65, 0xC5, 0x09, 0x2B, 0x57, 0x85, 0x95, 0x9F, 0x1A, 0x61, 0x65, 0xBA, 0xC8, 0x0A, 0x12, 0x87,
+    0xA5, 0xB0, 0xF2, 0x58, 0x58, 0x89, 0x74, 0x6A, 0xBF, 0x7D, 0x03, 0x2B, 0xBD, 0xB2, 0x92, 0xD3,
+    0xBB, 0x3B, 0x7F, 0x03, 0xB5, 0x55, 0x3D, 0x8F, 0x1C, 0x45, 0x14, 0xAC, 0x9E, 0x36, 0x1E, 0xCB,
+    0x2D, 0x68, 0x07, 0x26, 0xB2, 0xAC, 0xE5, 0x0F, 0xE0, 0x4E, 0x09, 0xF0, 0xCD, 0x80, 0x03, 0x52,
+    0x27, 0x27, 0x02, 0x07, 0xE4, 0x24, 0xFC, 0x81, 0xFD, 0x92, 0x09, 0x48, 0xF9, 0x11, 0x64, 0x24,
+    0x04, 0x04, 0x27, 0xB4, 0x77, 0xD3, 0x92, 0x03, 0x87, 0x8C, 0x70, 0x40, 0x40, 0x32, 0x88, 0x03,
+    0x07, 0x48, 0xEC, 0xE8, 0x68, 0xC1, 0x58, 0x9E, 0xD9, 0xA6, 0x5E, 0xF7, 0x9E, 0x7D, 0x07, 0x0E,
+    0xCD, 0x68, 0xD5, 0x33, 0xDB, 0x5F, 0xAF, 0xAA, 0x5E, 0xBD, 0x6E, 0x00, 0x28, 0x62, 0xAD, 0x42,
+    0x33, 0xA0, 0x52, 0x9F, 0xD4, 0x65, 0xA7, 0x02, 0x16, 0x70, 0x30, 0x5E, 0xF7, 0xF5, 0x88, 0xEA,
+    0xF6, 0xCC, 0xEB, 0xB3, 0xC7, 0x1C, 0x8C, 0x9C, 0x15, 0x9F, 0xF7, 0x50, 0x47, 0x15, 0x50, 0xDE,
+    0xEB, 0x80, 0x6F, 0x96, 0xD7, 0x70, 0xDD, 0x3C, 0xF1, 0xC0, 0x6E, 0x04, 0x6C, 0xE4, 0x56, 0xCD,
+    0x1A, 0x50, 0x7C, 0x57, 0xB1, 0x97, 0x9E, 0xC0, 0xCF, 0xCF, 0x5A, 0x36, 0x46, 0x1A, 0xCD, 0x3E,
+    0x60, 0x94, 0x66, 0x25, 0x8D, 0xE3, 0x64, 0xD8, 0xF6, 0x90, 0x23, 0x7F, 0x45, 0x76, 0xC7, 0x18,
+    0x3D, 0x56, 0xA7, 0xB3, 0x20, 0x23, 0x3B, 0x8E, 0xA0, 0x5A, 0x73, 0x8D, 0x6D, 0xD5, 0x28, 0x6B,
+    0x97, 0xB2, 0x96, 0x23, 0x2B, 0x19, 0x71, 0x32, 0x62, 0xD2, 0x48, 0x30, 0xB1, 0xB7, 0xF1, 0xA7,
+    0x38, 0xF2, 0x8D, 0xB7, 0x05, 0x44, 0x90, 0xD8, 0xF5, 0x3E, 0x20, 0xD1, 0xA2, 0x24, 0x5A, 0x1C,
+    0x4B, 0x34, 0xBF, 0x47, 0x60, 0xD7, 0x2B, 0xAF, 0x42, 0xB5, 0x83, 0xB3, 0xDB, 0x5E, 0xFF, 0xD9,
+    0x55, 0x38, 0x38, 0xD2, 0x5D, 0xB9, 0x25, 0xF7, 0xC6, 0x1B, 0x6F, 0x03, 0x67, 0x45, 0xCE, 0xB2,
+    0x9C, 0xC5, 0x20, 0x0E, 0xAE, 0xD6, 0x3D, 0xF7, 0x3B, 0xB8, 0x56, 0xA1, 0xFC, 0xE1, 0xC7, 0x0E,
+    0xCD, 0x78, 0x0C, 0x13, 0xB9, 0xDF, 0x4A, 0x58, 0xD4, 0x78, 0xF1, 0xDC, 0x8A, 0xD2, 0x11, 0x85,
+    0x7B, 0x39, 0x3D, 0x60, 0xAC, 0x59, 0x8B, 0x9D, 0xAD, 0xC9, 0xB8, 0xA9, 0x24, 0x74, 0xB3, 0x28,
+    0x06, 0x69, 0x05, 0xDC, 0xC9, 0xD2, 0x10, 0xD9, 0x54, 0x6D, 0x7F, 0x3D, 0x3C, 0x1C, 0x2D, 0xF9,
+    0xC7, 0x51, 0x35, 0x51, 0xD6, 0x26, 0x6D, 0xC8, 0x3F, 0xB5, 0xF5, 0x85, 0x36, 0xF7, 0x90, 0xC6,
+    0x3B, 0x70, 0x2D, 0x14, 0xE5, 0x09, 0x12, 0xC1, 0xC4, 0xAF, 0xC9, 0xB8, 0x88, 0xA2, 0x23, 0x56,
+    0x09, 0x82, 0x7A, 0x09, 0xCA, 0xEC, 0xF8, 0x37, 0xB2, 0x71, 0x4C, 0xA9, 0x0A, 0xBA, 0xBF, 0x49,
+    0x66, 0x8F, 0xDA, 0x0D, 0x26, 0xAB, 0x3B, 0xDB, 0x2D, 0xDC, 0x87, 0x3B, 0x4C, 0x53, 0xE3, 0x55,
+    0x8C, 0xA7, 0x50, 0xCD, 0xE9, 0x5E, 0x36, 0xC2, 0x55, 0xD4, 0x17, 0x1B, 0x98, 0x67, 0x4D, 0x4B,
+    0x4D, 0x85, 0x8D, 0x08, 0xAB, 0x80, 0x57, 0x13, 0xDE, 0x65, 0xC2, 0x2A, 0x13, 0x8E, 0x17, 0x08,
+    0x9F, 0xFC, 0xFF, 0x84, 0xF5, 0x80, 0x17, 0x2E, 0xDB, 0xB7, 0x5D, 0x6A, 0xFD, 0x85, 0xB6, 0xC6,
+    0xE5, 0xE7, 0x35, 0x4A, 0xF3, 0xD2, 0x73, 0x56, 0xE0, 0xDC, 0x95, 0x69, 0xFD, 0x79, 0xE4, 0xB7,
+    0xE4, 0xDF, 0x8D, 0x7D, 0x69, 0xB0, 0x96, 0x52, 0x5D, 0xD0, 0x92, 0x3A, 0x64, 0x57, 0x52, 0x2E,
+    0x91, 0x89, 0xD6, 0x4E, 0xFB, 0x73, 0xBB, 0xB2, 0xCF, 0x25, 0x32, 0xE5, 0x4D, 0x67, 0x9C, 0xB4,
+    0xBC, 0x34, 0x49, 0x89, 0xB8, 0xB1, 0x36, 0x71, 0xC2, 0xBF, 0x9F, 0x37, 0xF3, 0xEB, 0x2E, 0x6E,
+    0xE7, 0x8F, 0x05, 0xDE, 0xCF, 0x1F, 0x0D, 0x86, 0xFC, 0x51, 0xC5, 0x2E, 0x7F, 0x24, 0xD4, 0xAF,
+    0x78, 0xF6, 0xF6, 0xB9, 0x0F, 0x3B, 0x88, 0xBE, 0x66, 0x84, 0x9D, 0x24, 0x5C, 0x35, 0x4A, 0xA9,
+    0x97, 0x01, 0xA4, 0x7C, 0x65, 0xB6, 0x2E, 0x3B, 0x3D, 0x90, 0x96, 0xF1, 0xA6, 0xCD, 0x45, 0xDE,
+    0x5A, 0x3F, 0x93, 0xA5, 0x45, 0x6F, 0xFD, 0x41, 0xDA, 0xA2, 0xB7, 0xEB, 0x1C, 0xF4, 0x68, 0xF6,
+    0x30, 0xA5, 0x05, 0x73, 0x77, 0x2F, 0x65, 0x43, 0x4A, 0x3E, 0xE5, 0xB7, 0x48, 0xB5, 0x2F, 0x95,
+    0x1A, 0x96, 0xC2, 0x4E, 0x38, 0x2E, 0xCA, 0x3E, 0xA7, 0xFE, 0x58, 0x34, 0xE2, 0x5C, 0x8C, 0x85,
+    0x24, 0xBB, 0x98, 0xA8, 0x8E, 0x50, 0x36, 0x83, 0x1A, 0x48, 0x88, 0x2A, 0x75, 0x45, 0xC0, 0x8A,
+    0x41, 0x1B, 0x5F, 0xF4, 0xE2, 0x95, 0x22, 0x8A, 0x64, 0x96, 0xBF, 0x91, 0xD8, 0x6B, 0x62, 0x77,
+    0x1D, 0x63, 0xA1, 0xD8, 0x9D, 0x5B, 0xF7, 0xC6, 0x25, 0xAE, 0x45, 0x6A, 0x7C, 0xE1, 0x93, 0x73,
+    0x54, 0x52, 0x66, 0x54, 0x29, 0xBC, 0x7B, 0x1A, 0x32, 0xC0, 0x8C, 0xFC, 0x8D, 0xFF, 0x8A, 0x45,
+    0x3C, 0xEF, 0xC2, 0x84, 0x32, 0x7A, 0x4B, 0x65, 0xF4, 0xEF, 0x03, 0x8F, 0x8F, 0xED, 0xC3, 0xB6,
+    0xD2, 0xBD, 0xAD, 0x71, 0xDF, 0x3C, 0x1A, 0x8C, 0x1C, 0x8A, 0x67, 0x93, 0x91, 0xDD, 0xE7, 0xDB,
+    0x52, 0xE8, 0xDD, 0x79, 0xFA, 0x58, 0xF6, 0x33, 0x67, 0xBF, 0x88, 0x32, 0x3A, 0xFC, 0xFD, 0x87,
+    0x28, 0x1E, 0xAA, 0xEF, 0x65, 0xFB, 0x61, 0xF6, 0x44, 0x10, 0x6C, 0x4C, 0x37, 0xF0, 0x60, 0x99,
+    0xEB, 0xBE, 0xC2, 0xB7, 0xDF, 0x1D, 0x23, 0x98, 0xDF, 0xC6, 0x6A, 0xC2, 0x1C, 0x71, 0x20, 0xA1,
+    0x3B, 0xE0, 0x39, 0x99, 0x58, 0xEC, 0x11, 0xDD, 0x64, 0x70, 0xCA, 0xE1, 0x35, 0xED, 0x40, 0xB0,
+    0xB7, 0x98, 0xA0, 0x01, 0xD4, 0x65, 0x77, 0x45, 0x2C, 0x74, 0x92, 0x7C, 0x4B, 0xFF, 0xD0, 0x47,
+    0x92, 0x15, 0xD3, 0x55, 0x29, 0xB0, 0x93, 0xA5, 0x53, 0x4A, 0x58, 0x95, 0x7C, 0x34, 0x8B, 0x62,
+    0x0C, 0xD3, 0x49, 0x5D, 0x50, 0x77, 0x29, 0xBC, 0x31, 0x55, 0x96, 0x1C, 0x60, 0x1C, 0x5E, 0x8B,
+    0x11, 0x59, 0xC4, 0x4C, 0x0E, 0x87, 0xC5, 0x82, 0x63, 0x1A, 0xE3, 0xCF, 0x79, 0xA6, 0x91, 0x63,
+    0x6C, 0x7D, 0xAE, 0x3F, 0x95, 0x0E, 0x7B, 0x64, 0x7F, 0x0A, 0x04, 0xFB, 0x81, 0xDC, 0x12, 0x3A,
+    0xC6, 0x94, 0xD0, 0xD4, 0x7F, 0xFD, 0xAB, 0xBD, 0x8E, 0x57, 0x79, 0x18, 0x7F, 0x11, 0xD7, 0xAE,
+    0xFF, 0xB8, 0x73, 0xA3, 0x0A, 0xC4, 0x34, 0xA7, 0x80, 0xAE, 0xF4, 0xB0, 0x9F, 0xB7, 0xD0, 0x3F,
+    0xF3, 0xEA, 0x79, 0x1E, 0x5B, 0x5A, 0x70, 0xE2, 0xD1, 0x50, 0x79, 0xBB, 0xD6, 0x03, 0xCF, 0xF5,
+    0x15, 0x29, 0x5A, 0xBF, 0x81, 0xA8, 0x84, 0x91, 0x85, 0x27, 0xEC, 0x84, 0x8F, 0x14, 0x95, 0xD4,
+    0x3F, 0x91, 0xBC, 0x47, 0xA4, 0x6E, 0x1B, 0x50, 0x4A, 0x12, 0x3F, 0xCD, 0x07, 0x0A, 0x0D, 0xD7,
+    0x0A, 0x10, 0x29, 0xDC, 0xAB, 0xCF, 0x1E, 0x48, 0x1A, 0x5C, 0xAA, 0x3C, 0xDD, 0x27, 0xDF, 0x1D,
+    0x24, 0xBC, 0xA5, 0x4F, 0x6E, 0xDC, 0xEC, 0xEF, 0x0C, 0xD9, 0x93, 0xF7, 0x41, 0x9E, 0x2C, 0xB5,
+    0xA9, 0xBB, 0xE4, 0xCD, 0x45, 0x5A, 0x69, 0x7D, 0x5A, 0x19, 0xD2, 0x4A, 0x97, 0xEE, 0x3C, 0x02,
+    0x18, 0x53, 0x35, 0xCB, 0x4A, 0x57, 0xCB, 0x75, 0xF5, 0x51, 0x9F, 0x2E, 0xB1, 0x24, 0xAA, 0x61,
+    0x21, 0x11, 0xC0, 0xCA, 0x43, 0xEC, 0x5F, 0x9F, 0x1F, 0x61, 0xF9, 0x7A, 0x44, 0x2E, 0x84, 0x22,
+    0xF9, 0x0F, 0xB9, 0x94, 0xD2, 0xC1, 0x02, 0x7C, 0x89, 0xD7, 0xF5, 0xFC, 0x03, 0xCD, 0x54, 0x31,
+    0x8F, 0xDC, 0x44, 0x14, 0xFE, 0x6C, 0x5F, 0x32, 0x11, 0x26, 0x8C, 0x84, 0xE8, 0x22, 0xC5, 0x14,
+    0x94, 0x20, 0xFF, 0x81, 0xDC, 0x8E, 0x7B, 0x0A, 0x68, 0x42, 0x0A, 0x8A, 0xFC, 0x84, 0x6B, 0x23,
+    0x71, 0xBB, 0xB6, 0x94, 0x82, 0x82, 0x86, 0x86, 0x8A, 0x82, 0x9A, 0x6B, 0xD2, 0x1C, 0x12, 0xC5,
+    0xEE, 0xDA, 0xD1, 0x95, 0x34, 0x8E, 0x52, 0xA6, 0xC0, 0xD0, 0x44, 0x4A, 0x8A, 0x9B, 0xC2, 0xC5,
+    0x08, 0xEC, 0x1B, 0xBE, 0x37, 0xE3, 0x3D, 0x1D, 0x94, 0x48, 0x48, 0x8C, 0xD6, 0xF3, 0x56, 0xE3,
+    0xE7, 0x79, 0xDF, 0xFB, 0xDE, 0xF7, 0x1E, 0x10, 0x56, 0xE2, 0x27, 0x20, 0xF7, 0x0E, 0x28, 0x9E,
+    0x5A, 0x60, 0x95, 0x71, 0x3B, 0xCD, 0x06, 0x60, 0x54, 0x3D, 0x12, 0x9B, 0xF7, 0x48, 0x07, 0xDD,
+    0x21, 0xEB, 0xB9, 0xA9, 0xAE, 0x68, 0x90, 0x37, 0x65, 0x05, 0x5D, 0x95, 0x40, 0x09, 0xF3, 0xDE,
+    0x47, 0x2B, 0x98, 0xD2, 0x4C, 0xA8, 0xF7, 0x66, 0x44, 0x3D, 0x9B, 0x1E, 0x66, 0x7B, 0x0B, 0x38,
+    0xFA, 0x59, 0xEE, 0x1E, 0xF9, 0xA4, 0xBC, 0x0A, 0x59, 0xC7, 0x4D, 0x57, 0xDC, 0xEE, 0xC6, 0xA8,
+    0x30, 0x7E, 0x48, 0xBD, 0x87, 0xF6, 0x23, 0xBC, 0x6F, 0x70, 0xC2, 0x30, 0x33, 0x71, 0xF4, 0xC0,
+    0x9E, 0xEE, 0xFC, 0xD0, 0xD0, 0x9B, 0xC8, 0x18, 0x15, 0x35, 0x4F, 0x88, 0xAA, 0x6C, 0x90, 0xC8,
+    0xC9, 0xE2, 0x63, 0xA3, 0x8F, 0xE7, 0x12, 0x1F, 0x1A, 0xF1, 0xF9, 0xEE, 0xE1, 0x17, 0x2E, 0xFA,
+    0xEC, 0xAE, 0x7D, 0x92, 0xE5, 0x9E, 0x0D, 0xA0, 0xE2, 0x3D, 0xE9, 0xE2, 0x33, 0x2F, 0x3E, 0x38,
+    0xF8, 0xE4, 0xC4, 0xA3, 0x06, 0x9A, 0x29, 0x80, 0x90, 0x35, 0x45, 0xB3, 0x59, 0x70, 0x87, 0xDD,
+    0x9A, 0x46, 0x4C, 0xED, 0x83, 0x29, 0xA2, 0xC1, 0x8F, 0x4B, 0x6E, 0xB8, 0xED, 0x91, 0xBD, 0x26,
+    0xAA, 0xE9, 0x91, 0xC5, 0x26, 0x71, 0x28, 0xAB, 0x35, 0xF2, 0xAE, 0x64, 0x2C, 0x86, 0x70, 0xD9,
+    0x1F, 0x67, 0xBB, 0x84, 0x70, 0xAB, 0xFD, 0xC3, 0xC7, 0x9D, 0x39, 0x1C, 0x0E, 0x58, 0x27, 0x23,
+    0x29, 0xDD, 0x12, 0x06, 0x0F, 0x07, 0xDD, 0x04, 0xFA, 0x4E, 0x21, 0x3C, 0x13, 0x5B, 0x83, 0xA3,
+    0x9C, 0x15, 0xF8, 0x7A, 0x40, 0x26, 0x89, 0xB6, 0x7C, 0xDE, 0xF9, 0xF6, 0xDF, 0x13, 0xE9, 0xFE,
+    0x4B, 0x22, 0x8B, 0x3E, 0x10, 0xD9, 0xFA, 0x46, 0x88, 0xAC, 0xFD, 0x10, 0x58, 0x91, 0x4F, 0x44,
+    0x0B, 0x2E, 0xEA, 0x6E, 0xFA, 0x1B, 0xBD, 0xBB, 0x68, 0x8E, 0xA3, 0xB9, 0x73, 0x60, 0xF2, 0xC4,
+    0x62, 0xA5, 0x08, 0xCB, 0xDD, 0xAA, 0x59, 0x97, 0x40, 0x25, 0x65, 0x39, 0x41, 0xB8, 0xA4, 0xD1,
+    0x0D, 0xC9, 0x9C, 0x59, 0x00, 0x46, 0x13, 0x36, 0x79, 0x68, 0x88, 0x90, 0x7E, 0x2B, 0xA8, 0x17,
+    0xCF, 0xC9, 0xA7, 0xFE, 0xB4, 0xC3, 0x7E, 0x32, 0x48, 0xBD, 0x75, 0x50, 0x97, 0x52, 0xA8, 0x07,
+    0x07, 0x55, 0xEA, 0x83, 0x46, 0x95, 0x1C, 0x7F, 0x1C, 0x23, 0xD6, 0xBE, 0xAB, 0xFD, 0x2F, 0x7E,
+    0x64, 0x4B, 0xA8, 0x11, 0xF9, 0x28, 0xC9, 0xEE, 0x91, 0x0F, 0x92, 0xE6, 0x2C, 0x70, 0x49, 0x00,
+    0x7F, 0x93, 0x24, 0x50, 0x74, 0xE4, 0x20, 0x09, 0x52, 0xD1, 0x83, 0x24, 0xDF, 0xBE, 0x61, 0x5D,
+    0x32, 0xEF, 0xAF, 0xA4, 0xA5, 0xBE, 0x0F, 0x69, 0xCF, 0xB2, 0x09, 0x69, 0x4B, 0xC6, 0xA5, 0xC4,
+    0x4A, 0xC7, 0x6B, 0x2D, 0x29, 0xF9, 0x7B, 0x4F, 0xFA, 0x8F, 0xDF, 0x55, 0xA1, 0x46, 0x10, 0x09,
+    0x72, 0xAD, 0xC3, 0x5F, 0xF9, 0x14, 0xA1, 0x9D, 0x54, 0x00, 0xF8, 0xE1, 0x42, 0x4D, 0x3E, 0x43,
+    0xBD, 0xF2, 0x4D, 0x66, 0x1F, 0xF5, 0x89, 0xA3, 0x74, 0xD6, 0x94, 0x4E, 0x19, 0xD2, 0xD7, 0x9D,
+    0xB2, 0x99, 0x55, 0x0E, 0xFE, 0x99, 0x70, 0xD3, 0x02, 0x67, 0x02, 0x40, 0x9A, 0x3A, 0x19, 0x17,
+    0xAE, 0x25, 0x76, 0xCD, 0x43, 0xA9, 0x75, 0xCD, 0xB0, 0x05, 0x1F, 0xEA, 0x2B, 0x12, 0x73, 0xBE,
+    0xB0, 0x14, 0xEB, 0x15, 0xE4, 0x36, 0x07, 0x9B, 0x08, 0x4E, 0x36, 0x7A, 0x26, 0x8A, 0xA7, 0x55,
+    0x82, 0x78, 0xE3, 0xA0, 0x5B, 0xDA, 0x9D, 0x43, 0x21, 0xD7, 0xBA, 0x09, 0x2B, 0x11, 0xC2, 0x38,
+    0x61, 0x4B, 0x9B, 0xDA, 0x09, 0xA3, 0x11, 0x7D, 0xEC, 0x52, 0x2B, 0x76, 0xD8, 0x65, 0xBD, 0x91,
+    0xC4, 0x36, 0x79, 0xB7, 0x11, 0x6E, 0x8C, 0x16, 0x92, 0x75, 0x63, 0x56, 0x62, 0x8B, 0xCA, 0x9C,
+    0x8A, 0x2E, 0x4B, 0x94, 0xA3, 0x40, 0x35, 0x28, 0xAD, 0xD8, 0xB5, 0xC8, 0x8A, 0x76, 0x1B, 0xE9,
+    0x97, 0x4A, 0xC8, 0x96, 0xB8, 0xC8, 0x72, 0x29, 0xE2, 0x2D, 0xBC, 0xAD, 0xC5, 0x9A, 0x45, 0x72,
+    0x41, 0x9B, 0xD7, 0xAC, 0x5F, 0xB7, 0xEF, 0x52, 0x95, 0x85, 0x0E, 0xC9, 0x71, 0x71, 0x4B, 0x0F,
+    0x49, 0xE3, 0x1E, 0x23, 0xB4, 0x95, 0xE6, 0x65, 0x6D, 0x87, 0x82, 0xA3, 0x6D, 0x80, 0x6A, 0xB1,
+    0x22, 0x05, 0x6F, 0xBB, 0xFB, 0x6C, 0xCA, 0x9F, 0xAC, 0x66, 0x5B, 0x3E, 0x38, 0xCE, 0x3F, 0x6B,
+    0xA0, 0xF5, 0xD3, 0x8B, 0x1E, 0xEA, 0xE2, 0xF7, 0x17, 0x7C, 0x3D, 0x38, 0xCB, 0xD7, 0xE7, 0xE5,
+    0xB9, 0xBC, 0xCE, 0x27, 0x62, 0xBD, 0x9F, 0xCE, 0xD9, 0xF0, 0x9B, 0xAE, 0x5A, 0xB8, 0x8D, 0xEF,
+    0x0A, 0x98, 0xBD, 0xEF, 0x55, 0xA3, 0xFD, 0x49, 0x9F, 0x54, 0xE9, 0x9F, 0x9D, 0x4C, 0xC5, 0xF7,
+    0x23, 0xDC, 0x88, 0x26, 0xD4, 0x7A, 0xE1, 0x3F, 0xF6, 0xC3, 0x5D, 0xDC, 0x58, 0x94, 0x09, 0x93,
+    0x6D, 0x24, 0xA5, 0xD0, 0xDE, 0xB1, 0xF3, 0x48, 0x1C, 0x35, 0x2A, 0xFC, 0x48, 0xA9, 0xA5, 0x07,
+    0x63, 0x73, 0x72, 0x56, 0x2F, 0x8D, 0x29, 0x9A, 0xDA, 0xC7, 0xC9, 0x10, 0xDB, 0x58, 0x98, 0xE3,
+    0x25, 0x24, 0x4E, 0xFB, 0xE9, 0x66, 0x84, 0x77, 0xC3, 0xB0, 0x56, 0xA2, 0x88, 0x5E, 0x26, 0x77,
+    0xEA, 0x82, 0x1E, 0xEB, 0x4B, 0xD9, 0x95, 0xEF, 0xF1, 0xCF, 0x75, 0x74, 0x83, 0x5B, 0x13, 0xF4,
+    0x5A, 0x84, 0x54, 0x74, 0xA0, 0x39, 0xFF, 0x55, 0xC8, 0xCF, 0x5E, 0x4A, 0xFB, 0x8B, 0x18, 0x24,
+    0xD1, 0xE0, 0xEB, 0x04, 0x0B, 0x4E, 0x05, 0x26, 0xFB, 0xB5, 0x0E, 0x93, 0x4E, 0xD0, 0xB3, 0xAB,
+    0xE9, 0x9B, 0xBF, 0x39, 0x9B, 0x43, 0xB6, 0xCC, 0x95, 0x5D, 0xFE, 0xCC, 0x4A, 0xB5, 0x92, 0x50,
+    0x78, 0x09, 0xB5, 0x0B, 0xC5, 0x35, 0x61, 0x9E, 0x94, 0x32, 0xBE, 0x44, 0xA3, 0xB7, 0xFD, 0xC4,
+    0xA1, 0x23, 0x0C, 0x1D, 0xD6, 0x1D, 0xA4, 0x5D, 0xDA, 0xF0, 0x9B, 0x27, 0xBC, 0xBA, 0x60, 0x4D,
+    0x7F, 0xE8, 0x65, 0x16, 0xB0, 0xF4, 0x9F, 0xDF, 0x48, 0x40, 0x5D, 0xE5, 0x4D, 0xEA, 0xAF, 0x2C,
+    0xFC, 0x97, 0x24, 0xB7, 0xD1, 0x03, 0x67, 0xD5, 0x36, 0xF4, 0x3A, 0x69, 0x74, 0xA9, 0x15, 0x51,
+    0x92, 0x47, 0xD2, 0x50, 0x93, 0x69, 0x3D, 0xE4, 0x7D, 0x7A, 0x45, 0x32, 0xBF, 0xEA, 0xBF, 0xB1,
+    0xE5, 0xF1, 0x27, 0xF5, 0xE5, 0xC5, 0xE5, 0x85, 0xB7, 0xC6, 0x16, 0x8E, 0x60, 0x3E, 0x58, 0xE8,
+    0xF8, 0xBF, 0xAF, 0xBF, 0x00, 0xC5, 0x55, 0xBF, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xDB, 0xB3, 0x73,
+    0x91, 0x4E, 0xD1, 0xBA, 0x70, 0x45, 0x8A, 0xE3, 0x0F, 0xC0, 0x6C, 0x4B, 0x81, 0xBD, 0x07, 0x2E,
+    0x53, 0x90, 0x82, 0x28, 0x05, 0x05, 0x7F, 0xC2, 0x6B, 0x28, 0x90, 0xC8, 0x7B, 0xB7, 0x84, 0x92,
+    0x3A, 0xD4, 0x94, 0xE8, 0xA5, 0x70, 0xEB, 0xC2, 0xEF, 0xDD, 0x4A, 0x2E, 0x23, 0xA1, 0xA5, 0xA0,
+    0xA2, 0xE0, 0x1A, 0x28, 0x1C, 0x89, 0x6C, 0x71, 0x12, 0x27, 0x65, 0xEF, 0x96, 0x6F, 0xF6, 0x6C,
+    0xC7, 0x31, 0xD0, 0x21, 0xB1, 0x7A, 0x6F, 0xF6, 0x74, 0xFB, 0x63, 0x66, 0xBE, 0xF9, 0xE6, 0x3B,
+    0xA2, 0xCB, 0xA1, 0x29, 0xC0, 0x2A, 0x17, 0x61, 0xA5, 0xD7, 0x96, 0x28, 0xEB, 0x4B, 0x4B, 0xB7,
+    0x47, 0xCD, 0x26, 0xF7, 0xC9, 0xF2, 0x01, 0xCA, 0x62, 0x7A, 0x15, 0x1D, 0xDB, 0xCD, 0xC0, 0xF6,
+    0x50, 0xB3, 0x55, 0x92, 0x4F, 0xCB, 0x63, 0xDE, 0x2B, 0xCD, 0x06, 0xB6, 0xB0, 0xCA, 0xE0, 0x58,
+    0x57, 0xE0, 0x95, 0xF0, 0xC9, 0xDF, 0x40, 0xBC, 0x77, 0xBB, 0x3E, 0xC1, 0x71, 0x1D, 0x23, 0x8E,
+    0xEB, 0xF5, 0x1A, 0x21, 0x54, 0x35, 0x55, 0x96, 0x70, 0x03, 0x5C, 0x95, 0x58, 0x1B, 0x93, 0x4F,
+    0x6D, 0x44, 0xCF, 0xD1, 0x95, 0xF0, 0xB6, 0x88, 0x2F, 0xB0, 0x5D, 0x47, 0x4F, 0x59, 0xBD, 0x4B,
+    0xD4, 0xE6, 0x3D, 0x16, 0x9A, 0x9A, 0x46, 0xDC, 0x9E, 0xD1, 0xFE, 0xAD, 0xB0, 0x8B, 0xA9, 0x34,
+    0x22, 0x4E, 0x9E, 0xE2, 0x67, 0x91, 0x94, 0x91, 0x1C, 0xC3, 0x19, 0x22, 0x90, 0xB6, 0x32, 0x34,
+    0x20, 0x98, 0xAA, 0xD6, 0x70, 0x51, 0x74, 0xD4, 0xD0, 0x8A, 0x64, 0x57, 0x3A, 0x31, 0xD1, 0x96,
+    0xBE, 0x72, 0xDF, 0x7A, 0x75, 0x78, 0xD0, 0xBC, 0x3A, 0x7F, 0x75, 0x1E, 0xBD, 0xF6, 0xD5, 0x90,
+    0x0F, 0xB8, 0x7B, 0x87, 0xAF, 0x14, 0x11, 0x83, 0x1F, 0x5A, 0xCC, 0x36, 0xBD, 0xB8, 0x78, 0xEE,
+    0x2F, 0xB1, 0x38, 0xE5, 0xF9, 0xB5, 0xA7, 0x03, 0x9E, 0x43, 0xA0, 0x92, 0xE7, 0xB3, 0xD5, 0x1C,
+    0xCC, 0x92, 0x61, 0xC0, 0x38, 0x92, 0x6E, 0x86, 0x7E, 0xC6, 0x93, 0x14, 0x4D, 0x91, 0x9F, 0xAA,
+    0xBA, 0x89, 0x21, 0xCD, 0x6A, 0xFD, 0x03, 0xA3, 0x77, 0x71, 0x92, 0x36, 0xCA, 0x98, 0x96, 0xA9,
+    0xBC, 0x58, 0x27, 0xE8, 0x0B, 0x87, 0x10, 0x51, 0x91, 0xBC, 0x23, 0x55, 0xD3, 0x17, 0x0C, 0x11,
+    0x10, 0x3B, 0x64, 0x6C, 0xF1, 0xA8, 0x48, 0x0C, 0x24, 0xC6, 0x47, 0x27, 0xB6, 0x88, 0xAE, 0x44,
+    0x8C, 0x2E, 0x8F, 0x3D, 0xCF, 0xFE, 0x0A, 0x14, 0x11, 0x4D, 0xD3, 0x53, 0x15, 0x5F, 0xC3, 0x5B,
+    0xFB, 0x5D, 0x34, 0x1B, 0x11, 0x90, 0xFC, 0x32, 0xE7, 0xD2, 0x04, 0x69, 0xB3, 0x3E, 0x0B, 0x95,
+    0xC9, 0x7D, 0xE9, 0x15, 0xEE, 0x6B, 0xAC, 0xA6, 0xF2, 0xE5, 0xC8, 0xE8, 0x20, 0xBF, 0x15, 0x29,
+    0x54, 0x62, 0x43, 0x0D, 0x12, 0xDF, 0x72, 0xC2, 0xEF, 0xB6, 0xF9, 0x2F, 0x3E, 0xEB, 0x9B, 0x93,
+    0x6F, 0xC6, 0x45, 0xA7, 0x27, 0x80, 0x53, 0x57, 0x3D, 0xB5, 0x03, 0x6A, 0x41, 0xBB, 0x37, 0x2B,
+    0x81, 0x4C, 0x7A, 0xC4, 0x4A, 0x4B, 0xFA, 0x10, 0x19, 0xDA, 0x23, 0x10, 0x22, 0x4E, 0x0C, 0xC2,
+    0xF8, 0x37, 0xAE, 0xE5, 0x91, 0x19, 0x01, 0x33, 0xD1, 0x9D, 0x69, 0xDD, 0xD6, 0xF0, 0x97, 0x3B,
+    0x26, 0x4C, 0xCA, 0xF3, 0x03, 0x62, 0x1E, 0x71, 0x92, 0xC4, 0xFC, 0x48, 0x14, 0x4E, 0x60, 0xB5,
+    0x86, 0x0A, 0x64, 0x4B, 0x62, 0x5A, 0x7F, 0x7F, 0x73, 0xA5, 0xE2, 0x22, 0xA1, 0xC2, 0x19, 0x9F,
+    0xC9, 0x2D, 0x56, 0x32, 0xCF, 0x2B, 0x03, 0x55, 0x3F, 0xAF, 0xC7, 0x54, 0xC6, 0x64, 0xCC, 0x95,
+    0xFF, 0xBB, 0xF4, 0x0E, 0xDD, 0xA3, 0x23, 0x7A, 0x0F, 0xA4, 0x38, 0x25, 0xFD, 0x12, 0x6E, 0xB1,
+    0x98, 0x7D, 0x7A, 0x83, 0x56, 0x20, 0xBF, 0x46, 0xF1, 0x43, 0xE9, 0x40, 0x6B, 0x57, 0xDA, 0xD2,
+    0x49, 0x53, 0x59, 0x45, 0x2D, 0xE9, 0x22, 0x50, 0xD3, 0x82, 0x4F, 0x08, 0x00, 0xA1, 0x13, 0x37,
+    0xC0, 0x86, 0x04, 0xAE, 0x02, 0xD5, 0x7E, 0x9F, 0x48, 0x21, 0xB5, 0x92, 0x7D, 0x3D, 0x7C, 0x53,
+    0x0E, 0xA4, 0xA2, 0x00, 0x1C, 0xC5, 0x67, 0xAD, 0x13, 0xCC, 0x67, 0x81, 0x06, 0xE0, 0xFC, 0x44,
+    0xAA, 0x77, 0xB8, 0xCE, 0xF4, 0x86, 0x41, 0xAA, 0x31, 0x48, 0x36, 0xEA, 0xD9, 0xA3, 0xC7, 0x01,
+    0xF9, 0xE4, 0x3D, 0x4C, 0xE1, 0x41, 0x36, 0xE9, 0x60, 0x94, 0x85, 0x69, 0x90, 0xA8, 0x18, 0x49,
+    0xBB, 0x8A, 0x93, 0x80, 0xDB, 0xE4, 0xEC, 0x4D, 0x65, 0xD4, 0x88, 0x60, 0x80, 0xC1, 0xE3, 0x90,
+    0xBB, 0xDC, 0xDF, 0x4D, 0x3D, 0x07, 0x4E, 0xDD, 0x19, 0xB1, 0x11, 0x65, 0xFC, 0xD5, 0xAA, 0x4E,
+    0x8B, 0x90, 0x0D, 0x68, 0x1D, 0x0B, 0x92, 0xA0, 0x53, 0xBC, 0x74, 0x2D, 0xA2, 0xF5, 0x7C, 0x74,
+    0x6E, 0x88, 0x34, 0xB2, 0x01, 0x08, 0xE7, 0x41, 0x82, 0x82, 0x43, 0xD5, 0x91, 0xE8, 0xA4, 0xB9,
+    0x5D, 0xD6, 0xFF, 0x2B, 0xCF, 0x5D, 0x40, 0xAD, 0x3F, 0x02, 0xD5, 0x8F, 0x03, 0x6D, 0x21, 0x17,
+    0xFB, 0xB3, 0x98, 0x5D, 0x8F, 0x12, 0x11, 0xB5, 0xD1, 0x89, 0xF1, 0x73, 0xCF, 0x20, 0x08, 0x62,
+    0xB1, 0xE1, 0xFF, 0xFD, 0x3E, 0xA1, 0xA0, 0xFE, 0xF4, 0x62, 0xE2, 0x76, 0x28, 0x3A, 0x86, 0x41,
+    0x53, 0x65, 0x34, 0x3B, 0xFC, 0x38, 0x24, 0x1C, 0xF8, 0xF8, 0xAD, 0x1B, 0x19, 0xC3, 0x30, 0x3F,
+    0x34, 0x4F, 0x2F, 0xF9, 0xCD, 0xDE, 0x67, 0x15, 0xC8, 0x7A, 0xFA, 0xA7, 0x91, 0xCD, 0x77, 0x3C,
+    0x24, 0x39, 0x50, 0x13, 0x4D, 0x09, 0x91, 0x62, 0x72, 0xD6, 0x1A, 0x0F, 0x91, 0x8A, 0x9E, 0xD0,
+    0xAD, 0x3B, 0x95, 0x29, 0xBA, 0x7C, 0xD8, 0x43, 0xD0, 0xA0, 0x1C, 0x17, 0x0B, 0x9D, 0x01, 0x2D,
+    0xE3, 0xA3, 0xC2, 0x4B, 0xEE, 0x2A, 0x0C, 0x2F, 0x4D, 0x6A, 0x0E, 0x3A, 0xAD, 0x9E, 0xCE, 0x4D,
+    0xFF, 0x44, 0x1D, 0xCF, 0x92, 0x7E, 0x45, 0x73, 0x71, 0xA9, 0x5D, 0xB8, 0x77, 0x35, 0xAB, 0x91,
+    0x74, 0xCB, 0xD4, 0x57, 0xA4, 0xED, 0x26, 0x4F, 0x11, 0x46, 0x0A, 0xA9, 0x2E, 0xC0, 0x35, 0xA4,
+    0x62, 0x94, 0x43, 0x36, 0x80, 0xE1, 0xC8, 0xAE, 0x03, 0x3C, 0xD0, 0x5C, 0x6A, 0x2D, 0x34, 0x07,
+    0xDF, 0x0C, 0x11, 0x93, 0x08, 0xE1, 0x07, 0xF2, 0xC7, 0x1A, 0xB1, 0xAB, 0x0E, 0xBE, 0xD0, 0x8A,
+    0xAC, 0x03, 0x3C, 0xF6, 0xD8, 0xEC, 0xCF, 0xA4, 0x57, 0x36, 0x61, 0x92, 0x64, 0x9B, 0xCB, 0x99,
+    0x1A, 0x94, 0xF6, 0xB2, 0x9A, 0xFE, 0x65, 0x28, 0x27, 0x1C, 0x9A, 0xA9, 0x09, 0x50, 0x80, 0xE8,
+    0x8F, 0x5A, 0x73, 0x46, 0xD3, 0x70, 0x90, 0x7B, 0x0D, 0x49, 0xD9, 0xA5, 0x33, 0x6D, 0x58, 0x76,
+    0x2B, 0xE5, 0xCE, 0x38, 0xA1, 0x1F, 0xFD, 0x92, 0x83, 0xFE, 0xE3, 0x49, 0x93, 0x60, 0x7F, 0x5F,
+    0x73, 0xC2, 0xFA, 0x93, 0x55, 0xC7, 0x7B, 0x8E, 0x03, 0xA7, 0x26, 0xBF, 0x1E, 0x19, 0xA9, 0xD2,
+    0x6E, 0xA5, 0xD9, 0xC1, 0xE7, 0x09, 0x42, 0x5C, 0x3E, 0x78, 0xEE, 0x64, 0xBD, 0x5D, 0x9C, 0x47,
+    0x57, 0x58, 0xB4, 0x3B, 0x32, 0xEB, 0xF0, 0x89, 0x4B, 0xD1, 0xEF, 0x5C, 0x73, 0x1C, 0x88, 0xC7,
+    0x62, 0x48, 0x45, 0x95, 0xE6, 0xF0, 0xED, 0x20, 0xEF, 0xC7, 0x8E, 0x3F, 0x65, 0x24, 0x7F, 0x5B,
+    0x80, 0x47, 0x59, 0x60, 0x91, 0xA9, 0xBF, 0x44, 0x47, 0xDD, 0x4B, 0xDF, 0xB0, 0x2C, 0xCC, 0x94,
+    0xCE, 0x20, 0x7A, 0xE8, 0x38, 0x6C, 0x35, 0xB4, 0xBB, 0xE0, 0x3A, 0xB1, 0x4A, 0xC8, 0xEE, 0x52,
+    0xD1, 0xB6, 0x12, 0x4B, 0x0F, 0x2C, 0x55, 0xE7, 0x90, 0x27, 0xD7, 0xFE, 0xD4, 0x74, 0x92, 0x35,
+    0xAD, 0x7D, 0x4B, 0x31, 0xFE, 0x83, 0xF1, 0x17, 0xA5, 0x55, 0x3D, 0xB3, 0xDC, 0x34, 0x14, 0xBD,
+    0xB2, 0xD8, 0x18, 0xF0, 0x80, 0x28, 0x5E, 0x97, 0xC2, 0xE9, 0x99, 0xC1, 0x0D, 0x65, 0x06, 0x39,
+    0x15, 0x45, 0x9A, 0xD7, 0xEC, 0xA4, 0xDC, 0x9A, 0x2A, 0x2D, 0x0D, 0xCF, 0x26, 0x2D, 0x0D, 0x4D,
+    0xF8, 0x07, 0x34, 0xCB, 0x1F, 0xA0, 0x78, 0x6F, 0xED, 0x90, 0xE2, 0xB5, 0xCE, 0x3F, 0xF0, 0x64,
+    0x52, 0xA5, 0x41, 0x04, 0xCD, 0xE0, 0x01, 0xD9, 0xE2, 0x1C, 0x6D, 0x36, 0xD9, 0x3C, 0x96, 0x06,
+    0x3C, 0x5E, 0xC9, 0x2B, 0x5D, 0xDD, 0x8F, 0x73, 0xCF, 0xBD, 0x92, 0x95, 0x9C, 0x4B, 0x28, 0x5C,
+    0xE1, 0x6C, 0x5F, 0xB5, 0xB3, 0x9C, 0x49, 0x2D, 0x47, 0x4F, 0xB5, 0x48, 0x1E, 0xA3, 0xD8, 0x7B,
+    0xB3, 0x1A, 0xD4, 0xA4, 0x24, 0x1F, 0x44, 0xAC, 0x48, 0xE6, 0xE5, 0xC3, 0x88, 0xAF, 0x45, 0x64,
+    0x8D, 0x9F, 0x0A, 0x22, 0xDA, 0x7D, 0x2E, 0xE5, 0x2F, 0x4E, 0x16, 0x33, 0x96, 0xAE, 0x8A, 0x8B,
+    0x54, 0xF1, 0x7B, 0x51, 0x54, 0x56, 0xC6, 0xF4, 0x8F, 0x6A, 0xB6, 0xDB, 0x59, 0xBE, 0x10, 0xED,
+    0xE5, 0xAE, 0x98, 0x41, 0xBE, 0x16, 0x5B, 0xCB, 0x1D, 0x99, 0x21, 0x83, 0x25, 0xE1, 0x12, 0x74,
+    0xB6, 0x18, 0x9A, 0x09, 0xC3, 0xA7, 0x91, 0x1E, 0x74, 0xFC, 0x5F, 0xF5, 0xD4, 0x73, 0x34, 0x7C,
+    0x8C, 0xB5, 0x16, 0x8E, 0x34, 0xB5, 0x6D, 0xD5, 0x22, 0xF6, 0xC5, 0x66, 0x12, 0x13, 0xE3, 0x20,
+    0x19, 0x6C, 0x89, 0xAC, 0xD2, 0xC9, 0x18, 0x9D, 0x86, 0xD9, 0xBE, 0x7C, 0xBC, 0x9E, 0xE5, 0x67,
+    0x31, 0xA3, 0xEE, 0x65, 0x27, 0x1F, 0x48, 0x31, 0x62, 0x77, 0x87, 0x5F, 0xEE, 0x68, 0x8B, 0xE6,
+    0xF9, 0x61, 0xB9, 0x1C, 0x69, 0x79, 0x43, 0x6F, 0x0A, 0xF7, 0xC6, 0x25, 0x46, 0x71, 0x75, 0x10,
+    0x33, 0xFD, 0x47, 0x3C, 0x7D, 0x89, 0xD3, 0xD9, 0x2C, 0x5D, 0x0D, 0x13, 0x5E, 0x74, 0x32, 0xFB,
+    0xD5, 0x3B, 0xD8, 0xD9, 0x18, 0x38, 0x99, 0xB4, 0x25, 0x6A, 0xBD, 0x96, 0x7F, 0x7B, 0x62, 0x6C,
+    0x0B, 0x08, 0xDB, 0x38, 0x50, 0x8F, 0xEA, 0x6A, 0x29, 0xE0, 0x41, 0x55, 0x4B, 0x36, 0x25, 0x17,
+    0x60, 0x87, 0xB6, 0xB3, 0x98, 0xA0, 0xCE, 0x62, 0x4F, 0x07, 0xF4, 0x5F, 0x23, 0x5D, 0xD3, 0xAF,
+    0x28, 0xD3, 0xEB, 0x31, 0xC9, 0xE8, 0xD1, 0x52, 0x46, 0x8F, 0xC4, 0x69, 0xA7, 0x47, 0x86, 0x6A,
+    0xBF, 0x1C, 0x90, 0x2F, 0x31, 0xD7, 0x03, 0xA1, 0xCE, 0xFF, 0x18, 0x98, 0x41, 0x05, 0xAC, 0x28,
+    0xD3, 0xF5, 0x09, 0x0E, 0xDB, 0xA7, 0x14, 0x18, 0xAC, 0x84, 0x3D, 0x2E, 0x4D, 0x8D, 0x9C, 0x0D,
+    0x59, 0x4A, 0x9D, 0x53, 0x31, 0xD6, 0xAF, 0x43, 0x28, 0x23, 0x94, 0x34, 0xD1, 0x9D, 0x08, 0xE3,
+    0x56, 0x94, 0xCC, 0x35, 0x01, 0x7A, 0x1F, 0x38, 0xB9, 0x80, 0x32, 0x98, 0x7D, 0x3D, 0x59, 0x4C,
+    0x6A, 0xC2, 0x54, 0x0C, 0x87, 0x29, 0x70, 0x71, 0x84, 0xB9, 0xAE, 0xCE, 0xC7, 0xE2, 0xEA, 0xFD,
+    0xB2, 0xBD, 0x74, 0xAE, 0xD9, 0x5C, 0xFF, 0xDA, 0xC6, 0x60, 0x42, 0x16, 0x5B, 0x30, 0xA1, 0x96,
+    0x4F, 0x8E, 0xC9, 0x58, 0x27, 0x40, 0xCB, 0xB1, 0x23, 0xCE, 0x85, 0xB7, 0xE4, 0x82, 0xF2, 0xE4,
+    0xE4, 0xE9, 0xC7, 0xC6, 0x31, 0x03, 0xED, 0x0C, 0x12, 0x04, 0x88, 0xE5, 0xE1, 0x1E, 0xC9, 0x62,
+    0x48, 0xD9, 0x67, 0xBC, 0x54, 0x14, 0x12, 0x08, 0xA4, 0x41, 0xE7, 0xC8, 0x2A, 0x59, 0xF6, 0xA0,
+    0x87, 0x5D, 0x02, 0x7D, 0xB2, 0x49, 0x66, 0x32, 0x49, 0x66, 0xCA, 0x93, 0xCC, 0x94, 0x12, 0xF3,
+    0xCC, 0x93, 0x15, 0xFA, 0x37, 0x4F, 0x86, 0xA8, 0xD9, 0x27, 0xF8, 0x1A, 0x9F, 0xE0, 0xAB, 0xDC,
+    0x3E, 0x79, 0xF8, 0xDC, 0x27, 0x2F, 0x81, 0x0E, 0x5B, 0xE5, 0x20, 0x05, 0xFC, 0xE9, 0xF6, 0x29,
+    0x6F, 0x22, 0x9D, 0x3F, 0x5F, 0x91, 0xD3, 0xB0, 0x17, 0xF5, 0x84, 0x63, 0x50, 0xA3, 0xE4, 0xBD,
+    0x1B, 0xB1, 0xDC, 0x0E, 0x52, 0x3C, 0x01, 0xEC, 0x8D, 0xDA, 0xDC, 0x40, 0x52, 0x88, 0x64, 0x4E,
+    0x24, 0xAB, 0xFA, 0x30, 0x39, 0x2E, 0xB6, 0x9A, 0x0C, 0x2D, 0xDB, 0xCF, 0xFC, 0x9D, 0x8B, 0xEC,
+    0xF7, 0xA7, 0x4F, 0xE6, 0xA6, 0xDC, 0xE9, 0xE8, 0xAC, 0x2B, 0x16, 0x01, 0xCD, 0xE4, 0xA8, 0xD4,
+    0xAF, 0x32, 0x78, 0x98, 0x4F, 0x15, 0xBC, 0xA9, 0x06, 0xD6, 0xDD, 0x37, 0xCA, 0x9F, 0x42, 0xB4,
+    0xA2, 0xBF, 0x05, 0x0A, 0x0B, 0x04, 0x7A, 0xDC, 0x38, 0xE4, 0x02, 0xAF, 0x9A, 0x59, 0xA1, 0x86,
+    0x34, 0x6A, 0x3B, 0x16, 0x1E, 0xC3, 0xCD, 0x02, 0x8B, 0x36, 0x77, 0xAC, 0xEE, 0xF2, 0x69, 0x2A,
+    0x34, 0xF2, 0x2D, 0x0B, 0x94, 0x30, 0xCF, 0x99, 0x49, 0x7B, 0xDF, 0x11, 0x13, 0xCA, 0x99, 0xB1,
+    0x49, 0xA5, 0x48, 0xAC, 0xBC, 0x0E, 0xD4, 0x94, 0x4F, 0x92, 0x23, 0xE6, 0x79, 0x85, 0xCC, 0x15,
+    0xAC, 0x31, 0x74, 0x22, 0x2A, 0x43, 0x8B, 0x62, 0xDA, 0xEB, 0x15, 0x74, 0x21, 0x4D, 0x31, 0x07,
+    0xFC, 0xF7, 0x02, 0xC2, 0x39, 0x7B, 0xD7, 0xD5, 0x1C, 0xE7, 0x0C, 0x20, 0x36, 0x2F, 0x9A, 0xDE,
+    0x0C, 0xDA, 0x83, 0xE6, 0x33, 0x70, 0xA9, 0x1E, 0x79, 0x30, 0x1E, 0x55, 0xE4, 0x61, 0x71, 0x2E,
+    0x5B, 0xB1, 0xD8, 0x28, 0x1F, 0xA1, 0x7D, 0x0C, 0x3B, 0x6C, 0x94, 0x7D, 0xEE, 0x34, 0xFA, 0x61,
+    0xA2, 0x78, 0xCE, 0x68, 0x57, 0x47, 0x3A, 0x3B, 0x96, 0x01, 0x5A, 0x59, 0x2F, 0xF9, 0xB2, 0xC6,
+    0xD8, 0xB4, 0x78, 0xE1, 0x00, 0x3C, 0x27, 0x4D, 0x96, 0x2C, 0x30, 0x42, 0x93, 0x02, 0xDF, 0xA5,
+    0xC0, 0x7D, 0x0A, 0xFC, 0xE5, 0x76, 0xFB, 0x53, 0x68, 0xD0, 0x8B, 0xE2, 0xAB, 0x79, 0xBD, 0x5E,
+    0x37, 0xDF, 0xB1, 0xD5, 0xCC, 0xE0, 0x1A, 0xE4, 0x88, 0x47, 0xF5, 0x6D, 0x20, 0x12, 0xD4, 0x64,
+    0x06, 0x72, 0x66, 0x49, 0xC8, 0xC2, 0x5B, 0x9F, 0x2F, 0xC9, 0xE2, 0xC0, 0xCA, 0x4B, 0x29, 0x39,
+    0x7F, 0x5B, 0x6E, 0x03, 0x76, 0x3C, 0xAD, 0x82, 0xCB, 0x3B, 0x10, 0xC1, 0x1A, 0x84, 0x53, 0x01,
+    0x3C, 0x34, 0xDA, 0x0E, 0xE6, 0x96, 0x8B, 0xF5, 0xFA, 0xEA, 0x12, 0xF4, 0xBD, 0x14, 0x35, 0x5D,
+    0x81, 0x85, 0x0D, 0xD4, 0xDB, 0xB6, 0xA9, 0x59, 0xC4, 0x79, 0x1C, 0xE5, 0x18, 0xB3, 0xFF, 0x4D,
+    0x81, 0xB2, 0x67, 0xB7, 0x3C, 0xA2, 0x00, 0x52, 0xDB, 0xBE, 0xA1, 0xC0, 0xF5, 0x9F, 0xDB, 0xED,
+    0x36, 0x96, 0xC4, 0x20, 0x74, 0xC0, 0x60, 0xF3, 0x7C, 0x4A, 0x14, 0x18, 0x0F, 0x14, 0x28, 0xF6,
+    0x14, 0x50, 0x27, 0x28, 0xA0, 0x4E, 0x52, 0x80, 0x65, 0xA3, 0x02, 0xB2, 0xC7, 0xAA, 0xB1, 0x75,
+    0xF8, 0x67, 0xD1, 0x10, 0xA1, 0x02, 0x27, 0xCC, 0x08, 0x7A, 0x0E, 0xD9, 0x44, 0x88, 0xF4, 0x28,
+    0x06, 0xD7, 0x94, 0x76, 0xCB, 0x76, 0xCB, 0x94, 0x2C, 0xB8, 0x1D, 0x1E, 0xDE, 0xEF, 0xD3, 0x62,
+    0x3E, 0x12, 0xA4, 0xB2, 0x87, 0xFD, 0x09, 0xB9, 0x68, 0x60, 0x31, 0xA1, 0xF4, 0x96, 0x02, 0x99,
+    0x87, 0x8E, 0x04, 0x52, 0xE1, 0xE1, 0x34, 0xFA, 0x6C, 0x7D, 0x13, 0x9F, 0xDB, 0xBC, 0x42, 0x3A,
+    0x36, 0xCC, 0xF8, 0x03, 0x28, 0x32, 0x21, 0x8D, 0x0A, 0xAA, 0x3D, 0x06, 0xF8, 0x89, 0x16, 0x44,
+    0xEA, 0xAB, 0xE3, 0xE1, 0x16, 0xC8, 0xC1, 0xF8, 0xF0, 0xF5, 0xE3, 0x83, 0xE9, 0x70, 0x1B, 0xA6,
+    0xCB, 0x89, 0x45, 0x05, 0x60, 0xEF, 0x12, 0x0D, 0x24, 0x32, 0x82, 0x18, 0x40, 0xA4, 0x7B, 0x06,
+    0xDC, 0x2D, 0x4D, 0x14, 0xE9, 0xBE, 0x3A, 0x93, 0xFF, 0xFC, 0xFC, 0x0D, 0xCD, 0x55, 0xB1, 0x8E,
+    0xD5, 0x46, 0x14, 0xBD, 0xB6, 0x01, 0x17, 0x23, 0x34, 0x5B, 0x40, 0x95, 0xC2, 0x2D, 0xA2, 0xC0,
+    0x3F, 0x00, 0x3B, 0x06, 0xCA, 0x14, 0xD9, 0x66, 0xAB, 0x14, 0x7C, 0x02, 0x0D, 0xE5, 0xAE, 0x6D,
+    0x89, 0x1F, 0x48, 0x9F, 0x3F, 0x48, 0x1A, 0x4A, 0x8A, 0x5D, 0x6C, 0x2A, 0x8A, 0x14, 0x31, 0x52,
+    0x3E, 0xC0, 0x35, 0x8A, 0xC4, 0xA0, 0x58, 0xC8, 0x85, 0xED, 0xCB, 0x39, 0xF7, 0xBD, 0xDD, 0x25,
+    0x40, 0xDA, 0x88, 0xD1, 0xD3, 0x3C, 0x3F, 0xCF, 0xCC, 0xB9, 0xE7, 0x9E, 0x7B, 0xE6, 0x3E, 0xB9,
+    0x2E, 0x47, 0xC9, 0xE2, 0x46, 0x1F, 0x43, 0x5B, 0xB6, 0x8B, 0x1C, 0x48, 0x25, 0x9F, 0x8D, 0x62,
+    0x93, 0x4C, 0x55, 0xC2, 0xC3, 0x2D, 0x19, 0x93, 0x25, 0x95, 0x2C, 0x8A, 0xB8, 0x41, 0xA4, 0xAC,
+    0x6E, 0xFC, 0xB6, 0x4A, 0xD0, 0x49, 0x8E, 0x9F, 0xF4, 0x22, 0x41, 0x24, 0x99, 0xEF, 0x88, 0x7F,
+    0x1D, 0xE5, 0x95, 0x9B, 0x5C, 0x2C, 0x74, 0x93, 0x42, 0xB1, 0xEF, 0x0A, 0x2C, 0x07, 0x0C, 0xCE,
+    0xE9, 0x82, 0xF9, 0xF6, 0xF1, 0x91, 0x7C, 0x35, 0xBC, 0xCE, 0xA9, 0xAE, 0x41, 0x07, 0xAF, 0xB1,
+    0x98, 0x24, 0x9D, 0xA5, 0x6C, 0xC5, 0xF7, 0xD2, 0x88, 0x9C, 0x8B, 0x2C, 0x92, 0x8D, 0x92, 0x4D,
+    0x8C, 0xE4, 0xC6, 0x64, 0x02, 0xB3, 0xDE, 0xB7, 0x0C, 0x7C, 0x86, 0xA3, 0xE7, 0xF9, 0x40, 0x02,
+    0x87, 0x78, 0xCC, 0x3E, 0x44, 0x62, 0xFD, 0xC9, 0xC0, 0xE5, 0x4C, 0xDC, 0xA6, 0xE7, 0xBC, 0x72,
+    0x02, 0x04, 0x5F, 0xF3, 0xE9, 0x51, 0x34, 0x36, 0xDC, 0x86, 0x24, 0x70, 0x5A, 0x8D, 0xC4, 0x05,
+    0x5F, 0x63, 0xD8, 0x69, 0xDC, 0x4F, 0xDF, 0x18, 0x4F, 0xFB, 0x64, 0x11, 0xAC, 0x6D, 0xF2, 0x33,
+    0x92, 0x26, 0xB5, 0x5A, 0xF0, 0xE6, 0x94, 0x54, 0x4F, 0x38, 0x81, 0xD8, 0xA9, 0x00, 0xBA, 0x4E,
+    0x00, 0x70, 0xC8, 0xD0, 0x87, 0x39, 0xA5, 0x32, 0xDA, 0x05, 0x10, 0xEE, 0x3D, 0xE0, 0xF4, 0x12,
+    0x53, 0x60, 0x88, 0x40, 0x9E, 0x81, 0x04, 0x6A, 0xE2, 0x93, 0x7B, 0x8E, 0x43, 0xCF, 0x1A, 0xBC,
+    0xEA, 0x48, 0x5F, 0xC9, 0xFE, 0xEE, 0x67, 0x14, 0xF2, 0x58, 0x10, 0xAB, 0x27, 0xF5, 0x2D, 0xC7,
+    0x81, 0x74, 0x24, 0xF8, 0x97, 0x23, 0xE8, 0xE8, 0x74, 0x52, 0xAD, 0x82, 0xF6, 0xCD, 0x00, 0xF9,
+    0x40, 0x17, 0xC2, 0x81, 0x6C, 0x3A, 0xB1, 0xA0, 0x38, 0xE3, 0x07, 0x10, 0x86, 0xDE, 0xD4, 0xB1,
+    0x11, 0xEA, 0xB8, 0xA4, 0xE0, 0x94, 0x4E, 0x45, 0x45, 0x16, 0xE4, 0xE2, 0xDF, 0x18, 0x3F, 0x72,
+    0x96, 0x6E, 0xBC, 0x54, 0x2C, 0x9B, 0xAC, 0x76, 0x16, 0x96, 0xA5, 0xB8, 0xE9, 0xB8, 0xCD, 0xF8,
+    0x66, 0x34, 0x80, 0xE4, 0x2C, 0xB8, 0x24, 0x7B, 0x2E, 0xB7, 0x84, 0xBA, 0xF2, 0x90, 0xE6, 0x98,
+    0xD6, 0x1C, 0x51, 0x0E, 0x92, 0xEA, 0x3B, 0x14, 0x57, 0x92, 0x36, 0x35, 0xB3, 0xC0, 0x71, 0xD9,
+    0xCA, 0x2C, 0x9A, 0xB1, 0xEB, 0xC5, 0x2D, 0x1E, 0x87, 0x9B, 0x6A, 0xC3, 0xDA, 0x2F, 0xE9, 0xBF,
+    0xD4, 0xCE, 0x60, 0xFA, 0x4E, 0x7F, 0xD2, 0x29, 0xD3, 0x25, 0x07, 0xE6, 0x2B, 0x4A, 0x0D, 0x7D,
+    0x8B, 0x1E, 0xD7, 0x85, 0x30, 0x33, 0x6D, 0x08, 0x47, 0xC3, 0xDA, 0xA7, 0xAC, 0x1E, 0x69, 0xFB,
+    0x9E, 0x76, 0x2C, 0x1F, 0x52, 0xC6, 0xDA, 0x64, 0x5C, 0x4E, 0x88, 0xF5, 0x0F, 0xB5, 0x73, 0x9B,
+    0xDD, 0x41, 0x33, 0xA0, 0x91, 0x37, 0xE2, 0x62, 0x12, 0x0F, 0x54, 0xDB, 0x99, 0xC4, 0x61, 0xBD,
+    0xF2, 0xF9, 0xC1, 0x05, 0x9B, 0xEA, 0x1A, 0xFD, 0x8E, 0x52, 0xBA, 0xD8, 0x21, 0xCC, 0x5B, 0xEC,
+    0x09, 0xCF, 0x11, 0xE5, 0x1C, 0xB5, 0x96, 0xC9, 0x57, 0xBB, 0x1D, 0xDF, 0x95, 0xE4, 0x65, 0x05,
+    0x95, 0xF3, 0xB9, 0x04, 0xC1, 0xEE, 0x31, 0x1F, 0x87, 0xE2, 0x2B, 0x67, 0x48, 0x03, 0x13, 0xEB,
+    0x1F, 0x3A, 0x39, 0x9D, 0xE1, 0x20, 0x47, 0x9A, 0x3B, 0xA5, 0x91, 0xD7, 0x4A, 0x9E, 0x10, 0x18,
+    0x9F, 0x85, 0xE4, 0xA9, 0x7C, 0x8B, 0x6F, 0x24, 0xE3, 0x47, 0x56, 0xA0, 0x7B, 0xD7, 0x45, 0x36,
+    0xB4, 0x8D, 0xD2, 0xFD, 0x3A, 0x5E, 0x36, 0x06, 0x4F, 0xAE, 0x89, 0x39, 0xB5, 0x64, 0x0D, 0x52,
+    0x73, 0x75, 0xB0, 0x4B, 0x36, 0x99, 0xCE, 0xBC, 0x5D, 0xCA, 0x76, 0x91, 0x50, 0x36, 0xFA, 0xB6,
+    0x18, 0x14, 0x47, 0x10, 0xF5, 0xFA, 0x95, 0xE8, 0xFB, 0x3C, 0x26, 0x29, 0x7E, 0xD4, 0x36, 0x8B,
+    0xB7, 0xC9, 0xAE, 0xA8, 0xF2, 0x01, 0x97, 0xE9, 0x0C, 0x70, 0xBE, 0xCF, 0x22, 0xA2, 0x04, 0x69,
+    0xDA, 0x6C, 0xEB, 0xB0, 0x4B, 0x51, 0x9A, 0xBB, 0xCF, 0xA9, 0xD6, 0xA1, 0xC9, 0x83, 0xD8, 0xE7,
+    0xF7, 0x41, 0xE7, 0x3D, 0xF8, 0xB0, 0xEF, 0xB8, 0x79, 0x57, 0xD2, 0xA0, 0xAA, 0xAD, 0xC7, 0x34,
+    0xCA, 0xD3, 0x77, 0xBF, 0x4F, 0x6C, 0xC1, 0x67, 0xB4, 0x56, 0xC9, 0x84, 0x1D, 0x7B, 0x64, 0x3A,
+    0x90, 0xF9, 0x11, 0x55, 0x10, 0xEB, 0xD2, 0x5C, 0xA1, 0x5C, 0x97, 0x39, 0x5D, 0xAD, 0xEC, 0x12,
+    0xAD, 0xBF, 0xB5, 0xB2, 0x5A, 0xB2, 0x26, 0x8F, 0xB6, 0x17, 0xC2, 0xEC, 0x96, 0xCC, 0x7A, 0x27,
+    0x17, 0x0D, 0x54, 0x5C, 0x65, 0x77, 0x64, 0x9F, 0x72, 0xAA, 0x23, 0xE4, 0x69, 0xEB, 0x47, 0x8B,
+    0x33, 0x38, 0xEB, 0x26, 0xE2, 0x23, 0x33, 0x40, 0x67, 0x4A, 0x81, 0xBB, 0xD9, 0x2B, 0x94, 0xE2,
+    0x45, 0xA8, 0x8A, 0x6C, 0xFD, 0x61, 0x2C, 0xF4, 0x6F, 0xE9, 0x3E, 0xF6, 0x72, 0x04, 0xDF, 0x64,
+    0x38, 0xF3, 0x80, 0x15, 0xB7, 0x38, 0xF5, 0x97, 0x45, 0x77, 0x43, 0x69, 0x4E, 0x28, 0xC6, 0xC6,
+    0x22, 0x16, 0x43, 0x57, 0xED, 0xFA, 0xCE, 0xA9, 0xFC, 0xF7, 0x08, 0x1A, 0xED, 0x52, 0xE2, 0x3F,
+    0x05, 0x7F, 0x3F, 0x8B, 0xDC, 0x60, 0x76, 0x00, 0xB0, 0xEA, 0x86, 0x7D, 0xEF, 0x0A, 0xFB, 0xFC,
+    0x6A, 0xDE, 0x48, 0xA1, 0x97, 0x68, 0x26, 0xF3, 0x85, 0xE9, 0x82, 0x4C, 0xFC, 0x5F, 0x3B, 0xCD,
+    0xBC, 0xAE, 0xBC, 0xBB, 0x28, 0x9B, 0xF6, 0xC4, 0x28, 0xDB, 0x32, 0x12, 0x23, 0x54, 0xF9, 0x44,
+    0x8C, 0x00, 0x44, 0x62, 0xA0, 0x1A, 0x33, 0x31, 0x6A, 0xFC, 0x26, 0x06, 0x6E, 0x53, 0xA4, 0x90,
+    0x2B, 0x22, 0xF0, 0x1B, 0xC6, 0x1C, 0x60, 0xCD, 0x64, 0x3D, 0xEE, 0x2A, 0x48, 0x52, 0x2A, 0xFA,
+    0x05, 0xE8, 0x75, 0x56, 0xE3, 0x45, 0xFE, 0xD7, 0xF1, 0x09, 0xAD, 0x55, 0x3F, 0x6C, 0xDE, 0x44,
+    0x14, 0xFF, 0x9D, 0x2F, 0xA9, 0xA5, 0x58, 0xA9, 0x33, 0x84, 0x05, 0xA1, 0x9A, 0xB1, 0x42, 0x80,
+    0x37, 0x54, 0xA1, 0x7E, 0x39, 0x37, 0x19, 0x3A, 0x30, 0x10, 0x09, 0x7D, 0x2C, 0x15, 0x3B, 0x62,
+    0x69, 0x06, 0xD8, 0x92, 0xCF, 0xDE, 0x58, 0xBB, 0x74, 0x63, 0x40, 0x55, 0x86, 0x02, 0x03, 0x0C,
+    0x1D, 0x3A, 0x7C, 0xC1, 0x27, 0x16, 0x86, 0x0E, 0x38, 0x62, 0x64, 0xB1, 0x2A, 0x31, 0x10, 0x90,
+    0x6A, 0xC0, 0x83, 0x89, 0xCE, 0xDF, 0xF1, 0x7B, 0xF6, 0x97, 0x50, 0xD1, 0x22, 0x41, 0xE9, 0xD9,
+    0x3E, 0xDF, 0xBF, 0xF7, 0x7B, 0xEF, 0xFD, 0xEE, 0xDE, 0x3B, 0x60, 0x15, 0xBB, 0x80, 0x72, 0x51,
+    0x0D, 0xC4, 0x8D, 0x29, 0x80, 0xB4, 0x70, 0x00, 0x36, 0x90, 0xE1, 0x89, 0x92, 0xB6, 0x40, 0xF8,
+    0x8D, 0xE7, 0x52, 0xA3, 0x6E, 0x72, 0xDE, 0x61, 0x0E, 0xE8, 0x5A, 0x37, 0x40, 0x92, 0xC5, 0x1C,
+    0x38, 0xC2, 0xFE, 0x07, 0x85, 0x6E, 0x02, 0xEF, 0xAB, 0xD8, 0xC6, 0x7F, 0x94, 0x76, 0x86, 0x09,
+    0xCC, 0x76, 0xAB, 0x5A, 0x1C, 0x45, 0x36, 0xB2, 0x41, 0x6B, 0x90, 0x22, 0xB6, 0xEE, 0xE5, 0x39,
+    0x66, 0xE1, 0xC3, 0xE3, 0x2E, 0x6C, 0x12, 0xAF, 0xBD, 0x47, 0xD9, 0x68, 0x5F, 0xA9, 0x05, 0xC4,
+    0x18, 0xE2, 0x18, 0xEF, 0x7D, 0x11, 0xB3, 0xAA, 0x71, 0xF3, 0xE4, 0x8B, 0x16, 0x51, 0x45, 0x4D,
+    0x54, 0x93, 0x8A, 0xCE, 0xC8, 0x22, 0x47, 0x50, 0xD1, 0x50, 0xAE, 0x8E, 0x2B, 0xDA, 0x25, 0x06,
+    0xE0, 0xDD, 0x7E, 0x3A, 0x08, 0x5A, 0xAC, 0x95, 0x27, 0x9F, 0xE2, 0xB1, 0x19, 0x25, 0x0E, 0x61,
+    0x36, 0x78, 0x40, 0x07, 0xFF, 0x3E, 0x13, 0xF9, 0x5E, 0x2A, 0x0A, 0xB2, 0xB4, 0x52, 0x5D, 0x95,
+    0x2A, 0x91, 0xF9, 0x88, 0xEB, 0x95, 0x97, 0xF5, 0xA5, 0x54, 0x6B, 0xC5, 0x92, 0x89, 0xC0, 0xD7,
+    0x74, 0xB2, 0x98, 0x6D, 0xBB, 0x68, 0x80, 0x73, 0xC8, 0xD2, 0x22, 0x79, 0xBB, 0x41, 0xDE, 0x21,
+    0x74, 0x32, 0x8D, 0x45, 0x9C, 0x25, 0x05, 0x74, 0x8B, 0x0D, 0x93, 0x85, 0x3B, 0x7D, 0xD8, 0x25,
+    0x14, 0xC8, 0xFB, 0xFB, 0xD8, 0x14, 0xD0, 0x7B, 0x34, 0x03, 0xEA, 0x7A, 0x05, 0xD3, 0x41, 0xF7,
+    0x23, 0x68, 0xEC, 0xBB, 0xD8, 0x13, 0xC2, 0x5B, 0xE3, 0x0B, 0x24, 0x2D, 0x62, 0x32, 0x9D, 0x5A,
+    0xB2, 0x4A, 0xC7, 0x32, 0xD9, 0x21, 0x94, 0xA3, 0x1B, 0x4E, 0x4B, 0x27, 0xE8, 0x8C, 0x74, 0xF4,
+    0xEF, 0xE2, 0x0A, 0x3D, 0x18, 0x41, 0x86, 0x0E, 0xCC, 0xE0, 0x8D, 0xF6, 0xC3, 0x2E, 0x9A, 0x7C,
+    0xB0, 0xB9, 0x19, 0xF4, 0xA4, 0xD7, 0xC4, 0xE9, 0xA0, 0xD5, 0xE2, 0x6A, 0x52, 0x84, 0xCD, 0x40,
+    0x83, 0x38, 0x11, 0x5B, 0xD1, 0xA6, 0xB8, 0x8A, 0xB8, 0x25, 0x45, 0x7B, 0x84, 0xE4, 0x26, 0x18,
+    0x38, 0x91, 0x3D, 0x18, 0xC4, 0x47, 0x5B, 0x07, 0x4A, 0xAF, 0x0E, 0x63, 0xCA, 0x2F, 0xA4, 0x13,
+    0x0E, 0x34, 0x21, 0x38, 0x3C, 0x3F, 0x2E, 0x79, 0xA6, 0x7A, 0xED, 0x6D, 0xD4, 0xEB, 0x47, 0x75,
+    0xFA, 0x0B, 0xC2, 0x86, 0xB6, 0xEB, 0xB6, 0xA3, 0xC4, 0xA9, 0x18, 0x39, 0x10, 0x5E, 0x8A, 0x81,
+    0x83, 0x79, 0x62, 0x6A, 0x40, 0xBF, 0x11, 0x7E, 0xC7, 0x89, 0xF8, 0x2D, 0xA2, 0x6D, 0xD1, 0xB8,
+    0x37, 0x1D, 0x77, 0xCA, 0x34, 0x41, 0x47, 0x97, 0x68, 0xE7, 0xCA, 0x52, 0xF5, 0x5F, 0x15, 0xF1,
+    0xC2, 0x6B, 0xC4, 0x8B, 0x7F, 0x96, 0x23, 0x2C, 0x00, 0xC1, 0xDD, 0xE7, 0x44, 0xE6, 0x2B, 0x5F,
+    0x9E, 0x7E, 0x26, 0xFE, 0x79, 0x4F, 0x0A, 0xD4, 0x0D, 0x7F, 0x3B, 0xFB, 0x4F, 0x64, 0x26, 0x4B,
+    0x32, 0x0B, 0x21, 0x33, 0xF1, 0xAD, 0x90, 0xB9, 0x3C, 0x66, 0x4F, 0x63, 0xE7, 0xE0, 0x09, 0x76,
+    0xA6, 0xFE, 0x36, 0x1B, 0x3C, 0x36, 0x63, 0xEB, 0xE9, 0xEC, 0x9C, 0xB6, 0x64, 0xC7, 0x37, 0xDC,
+    0xF0, 0x45, 0xB6, 0x22, 0xC0, 0x6B, 0x9F, 0x3F, 0x56, 0x18, 0x08, 0x57, 0x5E, 0xBD, 0x74, 0x2F,
+    0xAC, 0xA2, 0x2A, 0x6D, 0xDF, 0xF8, 0x24, 0x28, 0xFE, 0xFD, 0x43, 0xA8, 0x97, 0xC8, 0x44, 0x26,
+    0xB1, 0x86, 0x0F, 0x8D, 0x77, 0x1F, 0x4D, 0xEF, 0xEF, 0xA1, 0xDE, 0xD3, 0xC5, 0xDE, 0x45, 0xEC,
+    0x6D, 0x62, 0x0F, 0xCF, 0xFE, 0x4A, 0xB9, 0x02, 0xD4, 0x08, 0x0B, 0x5C, 0x92, 0xB0, 0x75, 0xAF,
+    0x4F, 0xDF, 0x8B, 0xB0, 0x1E, 0xD8, 0x75, 0x7C, 0xB5, 0x8E, 0xCD, 0x75, 0xE0, 0xFF, 0xBC, 0xDC,
+    0xF6, 0x87, 0xDE, 0x7F, 0xCB, 0x83, 0x79, 0xDE, 0x78, 0x61, 0x3A, 0x9D, 0xE6, 0xE4, 0x52, 0x3E,
+    0x21, 0x46, 0xFE, 0x27, 0xFC, 0x1F, 0x9E, 0x31, 0x55, 0xFA, 0xB1, 0x9C, 0x2E, 0xFB, 0x77, 0xFF,
+    0x71, 0xE2, 0x7D, 0x75, 0xA7, 0x8D, 0x1F, 0x54, 0x26, 0xCD, 0xDC, 0x91, 0xFE, 0xED, 0x79, 0x36,
+    0x7F, 0xDD, 0x5D, 0xCD, 0x68, 0xE7, 0x54, 0xF2, 0xDF, 0xA3, 0xF1, 0xD8, 0x8D, 0xE5, 0x6C, 0xA0,
+    0x1B, 0x7A, 0x1B, 0xA1, 0x9D, 0xE8, 0x86, 0x12, 0x51, 0x6D, 0x0A, 0x1F, 0x38, 0x95, 0x41, 0xD5,
+    0x69, 0x95, 0x17, 0xBD, 0x6E, 0x92, 0xCC, 0x85, 0xD5, 0x44, 0x49, 0x2C, 0x5E, 0x68, 0x38, 0xC6,
+    0x6E, 0x93, 0xA2, 0x8B, 0xEC, 0xBE, 0x2A, 0xB0, 0xAA, 0x5D, 0xFE, 0x71, 0x93, 0x53, 0x16, 0x6D,
+    0x64, 0x27, 0x4C, 0xB5, 0x1B, 0x0A, 0xFB, 0x41, 0x3D, 0x09, 0x1A, 0xA3, 0x5A, 0x02, 0xC6, 0x76,
+    0x46, 0xCC, 0x9D, 0x2E, 0xA9, 0x7C, 0xD8, 0xA5, 0x76, 0xA1, 0xE4, 0x48, 0x65, 0x0A, 0xF9, 0x8E,
+    0x0B, 0x3B, 0x63, 0xCD, 0x36, 0xA3, 0x31, 0x2D, 0x66, 0x01, 0xA5, 0xB7, 0x04, 0x94, 0x38, 0x21,
+    0x5B, 0x44, 0xA1, 0xB6, 0x24, 0x2B, 0xB9, 0xAC, 0xE5, 0xB2, 0x80, 0x4A, 0x4D, 0x36, 0xD7, 0x4D,
+    0x5C, 0x1C, 0x04, 0xAC, 0xF6, 0x83, 0xE6, 0x02, 0x2E, 0xF3, 0xAE, 0xD9, 0xE0, 0x1D, 0x73, 0xBD,
+    0x4B, 0x8F, 0x5D, 0x5C, 0xE7, 0xBA, 0x8D, 0xED, 0xD7, 0x32, 0x4B, 0xED, 0x02, 0x47, 0xA4, 0x15,
+    0xDE, 0x3B, 0x58, 0x66, 0x68, 0x33, 0x06, 0xB8, 0x04, 0x27, 0xAF, 0x96, 0x6C, 0x7F, 0x95, 0xF7,
+    0x81, 0x23, 0x0F, 0xCD, 0x8F, 0x93, 0x17, 0x33, 0x30, 0x44, 0xB4, 0x1D, 0x93, 0xF4, 0xFC, 0x7C,
+    0x11, 0x0E, 0x24, 0x30, 0x87, 0xD8, 0xC3, 0x96, 0x84, 0x34, 0xAD, 0x3A, 0xCB, 0xD8, 0xE8, 0x97,
+    0x09, 0xC3, 0x8D, 0x39, 0x83, 0x99, 0x5E, 0xA9, 0x66, 0x53, 0x40, 0xE5, 0xBB, 0xF8, 0xCE, 0xF1,
+    0x21, 0x74, 0x35, 0xA6, 0xB9, 0x65, 0xFC, 0x0E, 0x5F, 0x42, 0x8E, 0x12, 0x64, 0x65, 0x59, 0x5A,
+    0xF2, 0x6F, 0x7F, 0x9A, 0xDC, 0x28, 0x78, 0xA7, 0x01, 0xFB, 0xA3, 0x66, 0x81, 0x1B, 0x6E, 0x11,
+    0xA6, 0xBD, 0xE0, 0x56, 0xE2, 0xCC, 0xF8, 0xB4, 0xD1, 0xAD, 0xCB, 0x43, 0xE4, 0x33, 0xBD, 0x33,
+    0xFF, 0x18, 0xDF, 0x19, 0xBF, 0x30, 0xBE, 0x37, 0xBE, 0x32, 0x3D, 0x4C, 0x85, 0xD7, 0xC6, 0x64,
+    0x9A, 0xFA, 0x45, 0xBF, 0xB9, 0x4C, 0xA8, 0x73, 0x63, 0xD3, 0xEF, 0x9D, 0x76, 0x26, 0x33, 0x45,
+    0x76, 0x7E, 0xFD, 0xCE, 0xC5, 0xA3, 0xE8, 0x41, 0x8B, 0xB4, 0x42, 0x99, 0x57, 0x4C, 0x93, 0xBA,
+    0x5F, 0x40, 0x77, 0x88, 0xEA, 0x5D, 0x70, 0xE3, 0x57, 0x69, 0xE2, 0x0F, 0x0B, 0x9F, 0xE3, 0x99,
+    0xCA, 0x9F, 0xAD, 0x54, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0xC7, 0x78, 0xD1, 0xAD, 0xEC,
+    0x71, 0x61, 0xA4, 0x80, 0xEC, 0x4C, 0x43, 0x19, 0xBC, 0xED, 0x15, 0x77, 0xB7, 0x9B, 0x50, 0x50,
+    0x50, 0xE0, 0x02, 0xB7, 0x28, 0x05, 0x0D, 0x05, 0xE2, 0x0A, 0x17, 0x2E, 0x2E, 0xBE, 0x55, 0x1A,
+    0x4A, 0xDC, 0xD0, 0xAF, 0x10, 0x05, 0x1D, 0x2E, 0x52, 0xB8, 0x38, 0x73, 0x13, 0x51, 0x20, 0x51,
+    0xAD, 0xF2, 0x17, 0x2C, 0x82, 0x48, 0x08, 0x37, 0x53, 0x5C, 0xB1, 0x41, 0x7B, 0xB7, 0x7C, 0x6F,
+    0xCE, 0x89, 0x13, 0x89, 0x86, 0x84, 0xB9, 0xBD, 0x37, 0xB3, 0x3B, 0x6F, 0xE6, 0x7D, 0xEF, 0x7B,
+    0x3F, 0xB0, 0x07, 0x24, 0x39, 0xA2, 0x0A, 0x38, 0xEE, 0xDB, 0xF6, 0xF8, 0xAD, 0x8B, 0x31, 0xEA,
+    0xB1, 0x2E, 0xC6, 0xDB, 0x18, 0xEF, 0x62, 0x8C, 0xD7, 0x7F, 0x64, 0xF4, 0x81, 0x1A, 0x71, 0x81,
+    0xDB, 0x40, 0xB6, 0xD8, 0x3B, 0x38, 0xDC, 0x4A, 0xB0, 0x15, 0xB9, 0x2D, 0x9C, 0x6F, 0x61, 0x77,
+    0x0B, 0x78, 0x93, 0x07, 0x38, 0x84, 0xCD, 0xE3, 0x16, 0x7F, 0x8D, 0xFB, 0xDF, 0xFD, 0xDA, 0xEB,
+    0xE5, 0xE5, 0x4E, 0x0F, 0x28, 0xF1, 0x5A, 0x82, 0xA3, 0xAC, 0xA0, 0x7F, 0x29, 0x60, 0xB6, 0x81,
+    0x41, 0x7F, 0xDE, 0xF9, 0xAB, 0xA3, 0x2F, 0xEF, 0x94, 0xF1, 0xC7, 0x3D, 0xF5, 0xC4, 0x95, 0xC7,
+    0xE7, 0xBD, 0x8D, 0x0D, 0x6A, 0x06, 0xD5, 0x37, 0x9C, 0xC2, 0x18, 0x97, 0xF8, 0x60, 0x80, 0xE4,
+    0x13, 0x44, 0x3F, 0x3B, 0x9C, 0x77, 0xDD, 0xEF, 0x5F, 0x7F, 0xFB, 0xD9, 0xF6, 0x3E, 0xCA, 0xFE,
+    0x71, 0x0F, 0xBF, 0x55, 0xA5, 0x52, 0xFF, 0x83, 0xA1, 0x97, 0xED, 0x61, 0x37, 0xC8, 0xE4, 0x0F,
+    0xC0, 0xE4, 0xB2, 0xB2, 0x1D, 0x5D, 0x75, 0x61, 0xF5, 0xD0, 0x23, 0x09, 0x2B, 0x53, 0x0C, 0x11,
+    0x57, 0x41, 0xCF, 0x99, 0x42, 0xD7, 0xB2, 0xD2, 0x95, 0xAE, 0x23, 0x2F, 0x2B, 0xE5, 0xD1, 0xA8,
+    0xB0, 0xC2, 0x0C, 0x43, 0x2C, 0xC2, 0x2A, 0x85, 0x45, 0x83, 0xE7, 0x47, 0x66, 0xF8, 0x14, 0x78,
+    0x27, 0xF2, 0xB1, 0x9B, 0x44, 0x9D, 0xC3, 0xDC, 0x9F, 0xC6, 0xD5, 0x50, 0xFF, 0xDD, 0x62, 0x35,
+    0x4F, 0xBA, 0xEA, 0x40, 0x7B, 0x9B, 0xCF, 0xE2, 0x6A, 0x5E, 0x58, 0xE5, 0x75, 0x3D, 0x91, 0x83,
+    0x26, 0x6F, 0xD0, 0x8C, 0x30, 0x5A, 0x1B, 0x1F, 0x99, 0xDC, 0x14, 0xBC, 0xC9, 0xC2, 0x7C, 0xE4,
+    0x68, 0x3F, 0x76, 0x89, 0xD3, 0x4F, 0x3C, 0x6D, 0xE9, 0x2A, 0xF2, 0x91, 0x9F, 0xD1, 0xB2, 0xF6,
+    0x14, 0x8B, 0x94, 0x08, 0x08, 0xCB, 0xA2, 0x8D, 0xAB, 0x0C, 0x8A, 0x0A, 0xC1, 0x0A, 0xE4, 0xCE,
+    0x69, 0x03, 0xBB, 0x02, 0x26, 0x84, 0x7C, 0x08, 0x41, 0xF4, 0xD2, 0x38, 0x4B, 0xAA, 0xEC, 0x6E,
+    0x6B, 0xEA, 0xA9, 0x5E, 0x10, 0xAE, 0x0A, 0x6E, 0x9F, 0xF5, 0x70, 0xA9, 0xEB, 0xEC, 0x5E, 0x6B,
+    0xDD, 0x8A, 0x3B, 0xB1, 0xCF, 0x3E, 0x5C, 0x58, 0xD7, 0x18, 0x37, 0xD3, 0xD5, 0x1E, 0x6A, 0x5C,
+    0xEB, 0xDC, 0x8F, 0xE4, 0x88, 0x5E, 0xA4, 0x6E, 0x49, 0x95, 0x87, 0xEB, 0x4B, 0x6C, 0x78, 0xE1,
+    0x8D, 0xD5, 0x88, 0xDE, 0x71, 0xBB, 0x4A, 0xC1, 0xE2, 0xD9, 0x5B, 0x5B, 0xBB, 0x15, 0x79, 0x53,
+    0x5B, 0x97, 0x15, 0x53, 0x2C, 0xD1, 0x2A, 0x1F, 0xD1, 0xDE, 0x2D, 0xDC, 0xA7, 0x83, 0xF9, 0x2A,
+    0x6A, 0x63, 0x6F, 0xAB, 0xAC, 0x58, 0xA9, 0x56, 0x7B, 0x53, 0xA5, 0x45, 0x26, 0x1A, 0xBA, 0x4A,
+    0x10, 0x0E, 0x53, 0x4D, 0x15, 0x29, 0x1E, 0xA8, 0xC6, 0xD4, 0xA9, 0x9B, 0xAA, 0x36, 0x5E, 0x18,
+    0xD1, 0x96, 0x63, 0xC6, 0x65, 0xF9, 0x32, 0x6A, 0xC2, 0x02, 0x33, 0x39, 0x64, 0x8A, 0x3B, 0xAC,
+    0xB8, 0x6A, 0x6D, 0x75, 0x93, 0x8E, 0x0B, 0x0D, 0x35, 0xEC, 0x37, 0x45, 0x5C, 0x8F, 0xF8, 0xD2,
+    0x1C, 0x90, 0x41, 0x28, 0x46, 0x37, 0xA9, 0x4D, 0xF8, 0x25, 0x3E, 0x6A, 0x91, 0xE5, 0x64, 0x73,
+    0x24, 0x5B, 0x3B, 0xDC, 0x24, 0xA5, 0x24, 0x32, 0xA9, 0xF8, 0x99, 0x7B, 0xD6, 0xE9, 0x86, 0xA8,
+    0xB3, 0xDC, 0x48, 0x24, 0x76, 0xAF, 0xF9, 0x13, 0x6C, 0x92, 0xB2, 0x79, 0x54, 0x0F, 0xD0, 0x44,
+    0xB5, 0x26, 0xB4, 0x1A, 0x93, 0xE4, 0xAE, 0x67, 0xB0, 0x24, 0x3B, 0x4E, 0x40, 0x11, 0x17, 0x14,
+    0xF9, 0x05, 0x45, 0x9B, 0x30, 0xE6, 0x19, 0x9A, 0xA4, 0x4E, 0x8A, 0x2E, 0xE7, 0x87, 0x47, 0x92,
+    0x37, 0x8F, 0x0C, 0xC5, 0x85, 0x68, 0x5E, 0x80, 0xCB, 0x13, 0xC3, 0x9D, 0x13, 0xD2, 0xC1, 0x98,
+    0x31, 0xC5, 0x06, 0xDC, 0xBC, 0x2D, 0x86, 0xD6, 0xE1, 0xE1, 0x9C, 0xB3, 0xD4, 0x33, 0xA6, 0x2B,
+    0x11, 0xAD, 0x64, 0x5A, 0x60, 0x4A, 0x7C, 0x51, 0x83, 0x9F, 0xD6, 0x6F, 0xB2, 0xC7, 0xC8, 0x8F,
+    0xE8, 0x1F, 0x3D, 0x48, 0x25, 0x9D, 0x67, 0x9C, 0x88, 0xBB, 0x61, 0x86, 0xD1, 0xBD, 0x01, 0xCD,
+    0x10, 0xDD, 0x84, 0xC8, 0x08, 0x77, 0x5F, 0x3A, 0x52, 0x49, 0x8A, 0x6F, 0xC6, 0xBB, 0xD8, 0x14,
+    0xA7, 0xE7, 0x30, 0x5E, 0x0B, 0x2F, 0x46, 0x28, 0xD9, 0x00, 0x3A, 0x8E, 0x29, 0xFF, 0x4F, 0x8F,
+    0x8E, 0x8E, 0x0E, 0xA7, 0xCF, 0xE6, 0xAB, 0xE9, 0x52, 0xD4, 0xDF, 0x17, 0xF1, 0x40, 0x44, 0x2B,
+    0x84, 0x48, 0x55, 0x84, 0xC2, 0x61, 0xF6, 0xB2, 0xD1, 0xAD, 0x4B, 0x04, 0xC2, 0x26, 0x10, 0xCA,
+    0x28, 0xD4, 0x97, 0x95, 0xEF, 0x43, 0x11, 0xCD, 0x8B, 0x43, 0xF2, 0x3D, 0x14, 0xE4, 0xBF, 0x1C,
+    0x0A, 0xE5, 0x99, 0xCA, 0xE6, 0xA9, 0x6C, 0x4E, 0x6E, 0xD0, 0x7E, 0x01, 0xBC, 0x97, 0xAB, 0xCE,
+    0x83, 0x68, 0xBA, 0x0E, 0x59, 0xE7, 0xB2, 0x1F, 0x6B, 0x73, 0xD5, 0xBE, 0x8D, 0x36, 0x22, 0xDB,
+    0x74, 0x5D, 0x6E, 0xA6, 0x51, 0xFA, 0x2C, 0x57, 0x35, 0x52, 0x35, 0xBC, 0x3D, 0xE2, 0xDD, 0x97,
+    0xD0, 0x2F, 0xE4, 0x32, 0x7C, 0x5F, 0xCB, 0x4B, 0x51, 0x16, 0x78, 0xA7, 0x25, 0xEC, 0x9F, 0xB0,
+    0x3C, 0xD3, 0x81, 0x14, 0xAF, 0x8D, 0xDF, 0x8C, 0x5E, 0x0E, 0x75, 0x86, 0xC4, 0x83, 0x74, 0x31,
+    0x1E, 0xE8, 0xE4, 0x02, 0x32, 0x26, 0x29, 0xA2, 0xF0, 0x3C, 0x60, 0x9B, 0x67, 0xA4, 0x26, 0x66,
+    0x0F, 0x48, 0x0B, 0x02, 0x64, 0xB1, 0x5D, 0x35, 0x8C, 0x59, 0x61, 0x5C, 0x52, 0x0B, 0x90, 0x65,
+    0xE8, 0x17, 0x4E, 0x90, 0x35, 0xE2, 0xBB, 0xCD, 0x99, 0x77, 0x64, 0x44, 0x4B, 0xF4, 0x04, 0x50,
+    0x2D, 0x84, 0x0C, 0x85, 0x02, 0x1D, 0xD2, 0x6A, 0x00, 0xFB, 0x83, 0x04, 0x8F, 0x5D, 0xEB, 0x04,
+    0xBC, 0x63, 0xF3, 0x15, 0x4C, 0xDF, 0x03, 0x9F, 0x23, 0xA5, 0x31, 0xC9, 0x90, 0x10, 0x3F, 0x3E,
+    0xCC, 0x1A, 0xE4, 0x21, 0x79, 0x02, 0xBD, 0x44, 0xA4, 0x1B, 0xE1, 0xCC, 0x38, 0x23, 0xCC, 0x81,
+    0x94, 0xD1, 0x3D, 0x42, 0x12, 0x1C, 0x69, 0x08, 0xC0, 0x4C, 0xD0, 0xE8, 0x5A, 0x42, 0x99, 0x09,
+    0x10, 0xF2, 0x35, 0x13, 0xDF, 0x08, 0x87, 0xC8, 0x18, 0xA7, 0x4C, 0x90, 0x90, 0x2D, 0x25, 0xAD,
+    0x47, 0xB2, 0x88, 0x64, 0xED, 0x43, 0x50, 0x95, 0x81, 0xAB, 0x57, 0x32, 0x8A, 0xB0, 0xC8, 0x11,
+    0x99, 0x32, 0x1E, 0x59, 0x21, 0xA0, 0xE8, 0xF6, 0xCE, 0x35, 0x20, 0xA9, 0xD3, 0x67, 0x50, 0x64,
+    0x27, 0xB7, 0xC9, 0xD3, 0xEE, 0xAA, 0x19, 0xE0, 0xAB, 0xAE, 0x38, 0xC4, 0x66, 0x79, 0xDD, 0x6C,
+    0xF2, 0x34, 0x6F, 0x12, 0x77, 0x1A, 0xFA, 0x4D, 0xC2, 0x56, 0xD3, 0x70, 0x0E, 0x2D, 0x27, 0x7D,
+    0xCC, 0x6E, 0xC3, 0x39, 0x74, 0x9D, 0x53, 0x36, 0x2E, 0xB5, 0x6E, 0x55, 0xA9, 0x5A, 0xC4, 0xE8,
+    0x2B, 0xB7, 0x8D, 0xFF, 0x34, 0xFE, 0x01, 0x85, 0x55, 0x3D, 0x8F, 0xDC, 0x54, 0x14, 0x3D, 0xB6,
+    0x93, 0x75, 0x14, 0x83, 0x5E, 0x0A, 0x22, 0xA1, 0x2C, 0x91, 0x29, 0x68, 0xF8, 0x5A, 0xF3, 0x03,
+    0x32, 0x6B, 0x13, 0x0A, 0x8A, 0x08, 0x29, 0x05, 0x93, 0x20, 0x28, 0xA0, 0x42, 0x50, 0xA0, 0x95,
+    0x50, 0x0A, 0x8A, 0x9D, 0x9D, 0x07, 0x29, 0x28, 0x28, 0xB2, 0x1D, 0x65, 0x52, 0x84, 0xC6, 0x29,
+    0xB6, 0xA1, 0x58, 0xA4, 0x99, 0x9D, 0xA7, 0xA4, 0x4C, 0xE3, 0xA4, 0xA1, 0x48, 0x11, 0x17, 0x41,
+    0x48, 0x41, 0x62, 0x2D, 0x70, 0x90, 0x77, 0xF1, 0xF8, 0x71, 0xEE, 0xF3, 0xEC, 0x6E, 0x52, 0x44,
+    0x78, 0x77, 0x3C, 0xCF, 0xEF, 0xE3, 0xDE, 0x73, 0xCF, 0x39, 0xD7, 0x03, 0x00, 0xD1, 0x1C, 0xCA,
+    0x16, 0xEA, 0x5E, 0x1B, 0x99, 0x24, 0x28, 0xC2, 0xDB, 0x95, 0x57, 0x35, 0x98, 0x0C, 0x90, 0xC4,
+    0x50, 0xDF, 0x9B, 0xF0, 0x7E, 0x15, 0x54, 0x23, 0xAF, 0x56, 0xF7, 0x1B, 0xDF, 0x36, 0x48, 0x6A,
+    0x1C, 0x5D, 0x0D, 0x90, 0x6A, 0xA8, 0x1A, 0xC1, 0x2E, 0xF0, 0xA4, 0xC2, 0x60, 0x05, 0xEA, 0x6A,
+    0x11, 0x94, 0x03, 0x34, 0xA1, 0x49, 0xF3, 0xEE, 0xAA, 0xB5, 0xED, 0xF1, 0xE1, 0x1E, 0xA0, 0x00,
+    0xAF, 0x02, 0xCE, 0x70, 0xBF, 0xCD, 0x62, 0x6B, 0xA2, 0xC7, 0x37, 0x82, 0xC2, 0x4D, 0xCD, 0x0A,
+    0xBC, 0xD9, 0x71, 0x43, 0xE1, 0xA2, 0xAD, 0x02, 0x71, 0x06, 0x65, 0xB0, 0x66, 0x62, 0xAB, 0x83,
+    0x2E, 0x3B, 0x4C, 0x35, 0x33, 0xBE, 0xBD, 0x11, 0x34, 0x08, 0x98, 0xAC, 0x82, 0xF7, 0xCF, 0x26,
+    0xAC, 0xC5, 0xE8, 0x72, 0x95, 0x60, 0x14, 0x69, 0xF5, 0x5E, 0x19, 0x14, 0x13, 0xBF, 0x8A, 0xBF,
+    0xAB, 0x1D, 0xC6, 0x47, 0xEE, 0x48, 0x6C, 0x9B, 0xD4, 0xB6, 0x83, 0x61, 0xF3, 0x8D, 0x5F, 0xBD,
+    0x13, 0x1A, 0xA8, 0x4C, 0xE2, 0x4F, 0x24, 0x6D, 0x50, 0x22, 0xE2, 0x84, 0x46, 0xE2, 0x72, 0xBE,
+    0x75, 0x98, 0x26, 0xEC, 0xA0, 0x76, 0x4B, 0xA5, 0x27, 0x81, 0x49, 0x50, 0x2B, 0x9D, 0x2A, 0x13,
+    0x58, 0xED, 0x59, 0xE3, 0x97, 0xAD, 0x5F, 0x29, 0x5D, 0x07, 0x15, 0x8B, 0xE3, 0xBA, 0x6F, 0xE7,
+    0x88, 0x9B, 0xA3, 0x73, 0x16, 0x91, 0xAD, 0xC2, 0x72, 0x23, 0x28, 0x23, 0x53, 0x7B, 0xDC, 0x34,
+    0x51, 0x3A, 0xF1, 0xF7, 0xD6, 0x74, 0x62, 0x0D, 0x2E, 0x97, 0x02, 0x3A, 0xAC, 0xB0, 0x5C, 0xF9,
+    0xB3, 0x12, 0x33, 0xED, 0xCE, 0x2C, 0x9B, 0x36, 0x7A, 0x62, 0xB3, 0xC1, 0xEF, 0x85, 0x2A, 0xEA,
+    0xB0, 0x5C, 0xF7, 0x59, 0x4C, 0xA3, 0xB2, 0x73, 0x81, 0x89, 0xBD, 0xBF, 0x2F, 0xE8, 0xF1, 0x9D,
+    0x22, 0x76, 0x1B, 0x97, 0x36, 0x59, 0x0A, 0xE2, 0xDD, 0x32, 0xD6, 0xAD, 0x32, 0x49, 0x58, 0x84,
+    0x77, 0x7A, 0x89, 0x46, 0x48, 0x29, 0xD1, 0x0F, 0x86, 0x92, 0x05, 0xE5, 0x06, 0xE1, 0xFD, 0x51,
+    0x7B, 0xB6, 0xC6, 0xC9, 0x4D, 0xB2, 0x9D, 0x2D, 0xB5, 0xA1, 0xD5, 0x67, 0x6A, 0xC4, 0xF0, 0x2B,
+    0xA4, 0x52, 0xF1, 0x48, 0x6A, 0x9E, 0x48, 0xD5, 0x35, 0x66, 0x65, 0x6A, 0xDF, 0x1D, 0x5E, 0xC4,
+    0xD2, 0x45, 0x24, 0x16, 0x29, 0x63, 0x67, 0x6D, 0x94, 0x25, 0xC8, 0xB8, 0xCA, 0x5D, 0x51, 0x21,
+    0xFF, 0x14, 0x85, 0x52, 0x10, 0x44, 0x92, 0x71, 0x97, 0x8D, 0xAC, 0xD5, 0xC3, 0x21, 0xF1, 0x64,
+    0x98, 0xD5, 0xFE, 0x7E, 0x1B, 0x98, 0x75, 0x1F, 0xEB, 0xA2, 0x5B, 0xC8, 0x9A, 0x8C, 0x67, 0x2B,
+    0xF8, 0x35, 0xBC, 0x5A, 0x12, 0x86, 0xE5, 0xE9, 0x99, 0x19, 0x77, 0x78, 0x83, 0x58, 0xE0, 0x01,
+    0x3E, 0xA9, 0x9A, 0x65, 0x88, 0xB9, 0xF2, 0x10, 0xDE, 0x5F, 0x15, 0xD6, 0x57, 0x11, 0xD3, 0x6C,
+    0xE6, 0x9C, 0x57, 0xD3, 0x2A, 0xD6, 0xDE, 0xB6, 0x14, 0x8E, 0xC0, 0x0E, 0xAC, 0x72, 0x6C, 0x21,
+    0x61, 0x41, 0x5A, 0x89, 0x1D, 0x9C, 0x1A, 0x01, 0x49, 0x03, 0x6F, 0x6C, 0x24, 0x8D, 0xC8, 0x46,
+    0x41, 0x05, 0x6B, 0x79, 0x7C, 0xAB, 0x0C, 0x6D, 0x81, 0x2F, 0xE5, 0xC4, 0x47, 0xF0, 0xAD, 0x09,
+    0xE7, 0x88, 0x04, 0x03, 0x68, 0x32, 0x9F, 0x8C, 0x10, 0xB8, 0x63, 0x77, 0xA0, 0xB4, 0x3A, 0x5F,
+    0x85, 0x66, 0x12, 0x54, 0xEA, 0x41, 0x25, 0x80, 0x97, 0x04, 0x1F, 0x8B, 0x6B, 0xE9, 0x94, 0x73,
+    0xA8, 0xAF, 0x04, 0xE5, 0xA9, 0xC8, 0xB9, 0x62, 0x24, 0x75, 0x49, 0x21, 0x3D, 0x07, 0x19, 0x29,
+    0xC4, 0x00, 0x78, 0xF9, 0x48, 0x8F, 0x1F, 0x2B, 0x95, 0xF5, 0x36, 0x89, 0xB3, 0xE4, 0x7A, 0x16,
+    0x58, 0x76, 0x01, 0x6D, 0x38, 0x0D, 0x4A, 0x65, 0xAA, 0xDE, 0x26, 0xF7, 0x5A, 0x8F, 0x55, 0x49,
+    0x0E, 0x6F, 0x93, 0xFE, 0xD0, 0x14, 0x28, 0x32, 0xAB, 0x4F, 0x59, 0xC4, 0xAC, 0x7A, 0xD6, 0x35,
+    0x84, 0xE4, 0x21, 0xDE, 0xA8, 0xC4, 0x5A, 0x19, 0xF0, 0xF1, 0x75, 0xE6, 0x39, 0x3D, 0x24, 0xDB,
+    0xCA, 0x5A, 0x6B, 0xBC, 0x99, 0xB5, 0xCE, 0x3F, 0x8D, 0x10, 0x49, 0x18, 0x53, 0xA1, 0x29, 0x15,
+    0x62, 0x09, 0x0E, 0x72, 0xB2, 0xA7, 0x18, 0x2C, 0xB5, 0x95, 0x26, 0x9B, 0x3F, 0xB3, 0x22, 0x3D,
+    0x7B, 0x6C, 0xFE, 0x21, 0x24, 0x1A, 0xB1, 0x6C, 0x3D, 0x66, 0x5F, 0x45, 0x87, 0x2B, 0x98, 0xCB,
+    0x4B, 0x40, 0x8E, 0x84, 0x04, 0xD3, 0x5B, 0xB3, 0x71, 0xAC, 0x30, 0x42, 0x7A, 0x4B, 0x9A, 0x1C,
+    0x63, 0x3E, 0x66, 0x8C, 0xC8, 0x76, 0x70, 0xD6, 0xC8, 0xC4, 0xD0, 0xBC, 0x5A, 0x89, 0xBC, 0x83,
+    0x8B, 0x3C, 0xCF, 0xC4, 0xBE, 0xB5, 0xEC, 0xE5, 0x50, 0x56, 0x3E, 0x9F, 0x5F, 0xD2, 0xC4, 0x41,
+    0xD8, 0x27, 0x67, 0xF9, 0x4D, 0xC0, 0x59, 0x99, 0x07, 0xD1, 0x1F, 0xA4, 0x4B, 0x90, 0xA5, 0x5D,
+    0x3E, 0xAB, 0xA5, 0xC0, 0x36, 0x98, 0x7F, 0xCC, 0xFC, 0x37, 0x5D, 0xEE, 0xA5, 0xAD, 0xBD, 0x45,
+    0x53, 0x8D, 0xAD, 0x2D, 0xFB, 0x91, 0xDD, 0xFB, 0x74, 0xD1, 0x6B, 0x7E, 0xED, 0xB5, 0xFD, 0x88,
+    0x71, 0xBA, 0xC3, 0xD1, 0xCE, 0xA2, 0x0D, 0x4B, 0x8E, 0x1C, 0x30, 0x96, 0x37, 0xF5, 0xDD, 0x88,
+    0x2E, 0x6E, 0x03, 0x17, 0x47, 0x19, 0xBF, 0x59, 0xDE, 0xD7, 0x51, 0xCB, 0x51, 0x54, 0x59, 0x5B,
+    0xD0, 0xA0, 0xB1, 0x9E, 0x19, 0xF2, 0x51, 0x9F, 0x65, 0xB9, 0xEC, 0x7D, 0x23, 0xDE, 0x4B, 0xED,
+    0x26, 0xBB, 0x44, 0xB8, 0x49, 0xE1, 0x5C, 0x46, 0x6A, 0xC6, 0xE2, 0x46, 0x7E, 0x69, 0x97, 0x8A,
+    0x06, 0xA1, 0x95, 0xA7, 0x70, 0x3B, 0xF8, 0x4A, 0x12, 0x48, 0xAB, 0x9E, 0x58, 0x46, 0x46, 0x83,
+    0xF0, 0x03, 0x34, 0xBE, 0x8C, 0x36, 0xD6, 0x92, 0xAC, 0x4A, 0xAC, 0xC4, 0x9C, 0xD3, 0xCB, 0x33,
+    0x19, 0x25, 0x65, 0xD8, 0xE1, 0x99, 0x6B, 0x79, 0x5F, 0xF4, 0xA0, 0xCE, 0xF0, 0xEC, 0x3E, 0x05,
+    0x8A, 0x1F, 0x31, 0x8C, 0x37, 0x17, 0xF7, 0x0A, 0xE5, 0x4E, 0xA0, 0x57, 0x7B, 0x29, 0xA5, 0x15,
+    0xA5, 0x2D, 0x44, 0x65, 0x67, 0x8A, 0x7E, 0xE2, 0x78, 0x37, 0xFC, 0x62, 0x31, 0xE1, 0x6F, 0xED,
+    0xE7, 0x9C, 0x4A, 0x9D, 0x90, 0x8E, 0x96, 0x9E, 0xB0, 0xC0, 0x11, 0x18, 0xD1, 0x41, 0x0C, 0xD9,
+    0x5D, 0xB2, 0xCE, 0x0C, 0x95, 0x68, 0x2E, 0xF2, 0xE3, 0x25, 0x7E, 0x4E, 0xA1, 0xEF, 0x3D, 0xB1,
+    0xBB, 0x53, 0xA8, 0x1F, 0xEC, 0x5D, 0xCA, 0xF3, 0x2D, 0xAA, 0x64, 0x1F, 0xE6, 0xF9, 0xAD, 0x4E,
+    0xA6, 0xFA, 0xA4, 0xFD, 0x4D, 0x0E, 0xBF, 0x26, 0xB7, 0xB3, 0xDC, 0x5E, 0x20, 0x9E, 0x4B, 0xD3,
+    0xC6, 0x5F, 0x8D, 0x92, 0x0B, 0xEF, 0xFF, 0x7A, 0xBE, 0xBC, 0x82, 0x6D, 0x60, 0x85, 0x79, 0x35,
+    0x7C, 0xE2, 0x7F, 0xFE, 0x43, 0xE3, 0x1E, 0x16, 0x20, 0x02, 0xF1, 0x49, 0x78, 0x74, 0xBB, 0x9F,
+    0xE7, 0x3F, 0x7D, 0xF2, 0x50, 0x20, 0xEC, 0xEE, 0xE7, 0xF9, 0xF4, 0x60, 0x7E, 0xE3, 0xC0, 0xE0,
+    0xAB, 0x72, 0xF0, 0x33, 0x17, 0x41, 0xFD, 0x5F, 0xA2, 0x83, 0x87, 0xE0, 0x7C, 0xF9, 0x75, 0xFD,
+    0xF3, 0x46, 0xF2, 0xF6, 0x86, 0xFF, 0xEF, 0x0E, 0x92, 0x0E, 0xFE, 0xDC, 0xD5, 0x80, 0x13, 0xFC,
+    0x63, 0x98, 0xC8, 0xBD, 0x08, 0x9B, 0xFE, 0x77, 0x82, 0x37, 0x34, 0xD1, 0x6F, 0xC3, 0xE1, 0xDA,
+    0x55, 0x41, 0x51, 0x75, 0x79, 0x9E, 0x37, 0xD2, 0x60, 0xAD, 0x08, 0x2E, 0x7E, 0x92, 0x6F, 0xBE,
+    0x92, 0x17, 0xC7, 0x1D, 0xD5, 0x5A, 0xD8, 0x66, 0xD7, 0x47, 0x7F, 0x36, 0xEA, 0xEE, 0xB5, 0xBB,
+    0xB7, 0xCB, 0xC6, 0x6C, 0xBF, 0xF0, 0x1C, 0x58, 0x7A, 0xFB, 0xC4, 0x64, 0x45, 0x5D, 0xBB, 0x7B,
+    0xCD, 0x74, 0xBB, 0x46, 0xD1, 0x09, 0xD6, 0xB8, 0x06, 0x26, 0xC5, 0x21, 0x3F, 0xFC, 0xC5, 0x60,
+    0x20, 0xEC, 0xEC, 0xEA, 0xE8, 0xC1, 0x75, 0x3D, 0x5D, 0x89, 0x75, 0xB1, 0xFD, 0x8A, 0x0B, 0xC2,
+    0xE3, 0x8E, 0x38, 0x06, 0xE3, 0xE3, 0x8B, 0xD1, 0xB7, 0x46, 0x56, 0xA7, 0xBF, 0x34, 0x74, 0x83,
+    0xC6, 0x98, 0x22, 0x8E, 0x33, 0x59, 0xA5, 0x65, 0xE6, 0xEC, 0xA7, 0xFA, 0x59, 0xE7, 0xE1, 0x3F,
+    0xAD, 0x55, 0x3D, 0x6F, 0xE4, 0x64, 0x10, 0x1E, 0xDB, 0xA0, 0x57, 0xC2, 0x85, 0x1B, 0x90, 0x90,
+    0x28, 0x7C, 0xBF, 0x20, 0xEE, 0x91, 0x72, 0xF6, 0x11, 0x89, 0x88, 0x0A, 0x8A, 0xB3, 0x90, 0x48,
+    0xC1, 0x4F, 0xB8, 0x86, 0x32, 0x59, 0xFB, 0xC4, 0x1F, 0xA0, 0xB9, 0xFA, 0x4A, 0x84, 0x53, 0xA4,
+    0x8D, 0x50, 0x36, 0xB6, 0x44, 0x49, 0x71, 0x9B, 0x8A, 0xE2, 0x8A, 0xF8, 0x4E, 0x3A, 0x21, 0x25,
+    0x45, 0x0C, 0x58, 0x3A, 0x67, 0xCF, 0xEB, 0xE1, 0x79, 0x66, 0xB3, 0xAB, 0xD3, 0x09, 0x21, 0x0A,
+    0x5E, 0xED, 0x8E, 0xFD, 0x7E, 0xCD, 0xC7, 0x33, 0xCF, 0x8C, 0x45, 0xC2, 0x52, 0x82, 0x4E, 0x64,
+    0x14, 0x49, 0x45, 0xA2, 0x66, 0x33, 0xD9, 0x91, 0x7B, 0x61, 0x99, 0xF8, 0x6D, 0x92, 0x9D, 0x26,
+    0xD9, 0x4E, 0x9C, 0x85, 0x4F, 0x9F, 0x7C, 0x7D, 0xA3, 0x7A, 0xBB, 0xAC, 0x7E, 0x4A, 0x32, 0xF1,
+    0x7B, 0x11, 0x3E, 0x70, 0xF6, 0x9E, 0xC8, 0xE9, 0x3B, 0x77, 0xEF, 0x63, 0x02, 0xAD, 0xAD, 0xC8,
+    0xE0, 0xCB, 0x4E, 0xD0, 0x86, 0xE5, 0xCC, 0x6F, 0xDD, 0xE2, 0x54, 0x8E, 0x92, 0xFC, 0xE0, 0xB9,
+    0xEA, 0xAA, 0xAA, 0x56, 0x22, 0x47, 0x22, 0x33, 0xFB, 0xE1, 0xB8, 0x2F, 0x1C, 0x54, 0x27, 0x61,
+    0x23, 0xA5, 0x24, 0x7C, 0x9C, 0xC9, 0x1C, 0x4B, 0xE1, 0x02, 0xEF, 0x67, 0x30, 0xE7, 0x5E, 0xE5,
+    0xF9, 0x59, 0xAA, 0xAA, 0xDD, 0x79, 0x55, 0x55, 0xD9, 0x19, 0x6F, 0x98, 0x18, 0xB7, 0xA2, 0x94,
+    0xCD, 0xF8, 0x0E, 0x7F, 0xB7, 0x10, 0xB3, 0x22, 0x6E, 0xA9, 0x3A, 0x16, 0xB8, 0xF9, 0xFA, 0x0A,
+    0x37, 0xB9, 0x22, 0x47, 0x79, 0x9E, 0x3F, 0xE4, 0x52, 0x57, 0x43, 0x34, 0xA6, 0x67, 0x4E, 0x71,
+    0x4A, 0x91, 0x51, 0x38, 0xC8, 0x22, 0x13, 0x77, 0x93, 0xC9, 0x51, 0x9C, 0xB9, 0xBE, 0xC8, 0x8A,
+    0x0B, 0xDD, 0xBF, 0xDC, 0xBF, 0xFC, 0x62, 0x37, 0xFE, 0x58, 0xFA, 0x43, 0x09, 0x2E, 0x3A, 0x89,
+    0xF6, 0x1B, 0xD9, 0x8D, 0xE5, 0x5F, 0xA6, 0x77, 0x83, 0xDA, 0x24, 0x5E, 0x0B, 0xD5, 0xA9, 0xDE,
+    0x83, 0x59, 0xFD, 0x1C, 0xEE, 0x9C, 0xD8, 0x1A, 0xDC, 0xC9, 0x5F, 0x73, 0xE9, 0x4B, 0xFC, 0x07,
+    0x31, 0x00, 0xC5, 0xE3, 0x4B, 0xC8, 0xA0, 0xDE, 0x13, 0xF9, 0xCF, 0x16, 0xDF, 0xDF, 0x8D, 0x3F,
+    0x3C, 0xEC, 0x0F, 0xFB, 0xFA, 0x42, 0xCB, 0x7A, 0x7F, 0x90, 0x79, 0x5C, 0xCA, 0x7C, 0xB0, 0x58,
+    0x0C, 0x16, 0x1B, 0x41, 0x13, 0x41, 0x74, 0x48, 0x18, 0xD2, 0x94, 0x48, 0xB0, 0xAC, 0x8E, 0xBB,
+    0x80, 0xF6, 0xFD, 0x65, 0x55, 0x1D, 0xBF, 0x60, 0x22, 0x76, 0xEF, 0xC3, 0xA7, 0x47, 0xB6, 0x28,
+    0x84, 0x7D, 0x7D, 0x12, 0xD9, 0x4A, 0xEE, 0xAE, 0xDB, 0x48, 0x4B, 0xEA, 0xA9, 0xF1, 0x96, 0x3C,
+    0x5E, 0x31, 0x0F, 0x01, 0x32, 0xE1, 0xBA, 0xB0, 0x23, 0x41, 0xA2, 0x96, 0x89, 0x49, 0x1A, 0x71,
+    0xAD, 0x14, 0x55, 0x85, 0x53, 0x16, 0x9D, 0xAF, 0xD5, 0xC9, 0x42, 0x82, 0xDE, 0x58, 0xD3, 0x79,
+    0xE0, 0x52, 0xDC, 0x80, 0x3D, 0xD0, 0x05, 0x2A, 0x48, 0x6D, 0x34, 0x58, 0x71, 0x21, 0x18, 0x2C,
+    0x7D, 0x7F, 0x72, 0x21, 0xBA, 0x24, 0x10, 0x89, 0xE5, 0xB9, 0x68, 0x29, 0x95, 0xC8, 0x91, 0x89,
+    0x40, 0xCA, 0xC4, 0x43, 0xA0, 0xA5, 0xAD, 0x44, 0xF0, 0xD5, 0x95, 0x31, 0xCE, 0x78, 0x3C, 0x9D,
+    0xE2, 0x98, 0xDB, 0x4E, 0x44, 0x4E, 0x9E, 0x36, 0x3E, 0xF2, 0x1E, 0xAC, 0xBE, 0x1D, 0xE1, 0x42,
+    0x0D, 0x05, 0x51, 0x33, 0xE2, 0xC4, 0x5C, 0xBC, 0x1E, 0xDB, 0x73, 0x18, 0x4E, 0x1D, 0x90, 0x7C,
+    0x3C, 0x48, 0xB8, 0x98, 0x21, 0xB8, 0xB8, 0xF1, 0x01, 0x14, 0x92, 0xA1, 0x9F, 0x0D, 0x50, 0x0E,
+    0x28, 0x15, 0x46, 0x3D, 0xD2, 0x43, 0xF5, 0x0F, 0x44, 0xF4, 0xBB, 0x5E, 0xD5, 0xF0, 0x16, 0xE1,
+    0xF9, 0xB0, 0x61, 0xA1, 0xBF, 0x35, 0xFD, 0x4B, 0xB5, 0x7E, 0x86, 0x53, 0x9F, 0x56, 0xC7, 0xFF,
+    0xB0, 0xBB, 0x99, 0xFE, 0x5C, 0xFD, 0x48, 0xA4, 0x6F, 0x08, 0xF4, 0x5B, 0xC3, 0x2F, 0xC5, 0xE9,
+    0x2D, 0x7C, 0x4C, 0x60, 0x6A, 0x90, 0x74, 0x79, 0x00, 0xFB, 0x29, 0x62, 0x04, 0xAC, 0x0B, 0xF1,
+    0x54, 0x22, 0xCA, 0x36, 0x44, 0x7C, 0xAB, 0xD1, 0xCA, 0x2F, 0x7D, 0x00, 0xB5, 0x63, 0xD8, 0x9E,
+    0x43, 0x7A, 0x03, 0x8A, 0x74, 0x94, 0x19, 0x6A, 0x68, 0x94, 0xF8, 0xFB, 0x5E, 0xD6, 0x71, 0xAE,
+    0xC4, 0x1F, 0x92, 0x12, 0xD9, 0x5A, 0xB9, 0x6E, 0x4E, 0x4C, 0xC6, 0x39, 0xBD, 0x48, 0xB0, 0x12,
+    0x2D, 0x82, 0x89, 0x49, 0x91, 0xBA, 0x94, 0xB8, 0x93, 0x62, 0x7A, 0x50, 0x74, 0x32, 0x43, 0x9C,
+    0x90, 0x40, 0xED, 0x07, 0xF9, 0x40, 0xBC, 0x5C, 0xDE, 0x19, 0x09, 0x45, 0xCD, 0x6C, 0x28, 0x72,
+    0xE4, 0x2B, 0x33, 0x77, 0x83, 0xE2, 0x73, 0xCF, 0xE1, 0x50, 0xF4, 0x0B, 0xC5, 0x1E, 0x50, 0x4B,
+    0x7C, 0xEB, 0x0D, 0x23, 0x8B, 0x72, 0x22, 0x31, 0x0A, 0x34, 0x08, 0xA4, 0x07, 0xF9, 0x4E, 0x4B,
+    0xF8, 0x1E, 0x37, 0xA8, 0xD8, 0x68, 0x01, 0xFC, 0xA3, 0x0E, 0x9C, 0x75, 0x1D, 0x9C, 0x0F, 0x86,
+    0x94, 0x40, 0xD5, 0x4F, 0xF2, 0x83, 0x91, 0xF8, 0x4C, 0x26, 0x48, 0x47, 0x8D, 0x29, 0x7E, 0x9B,
+    0xAA, 0x6F, 0x8E, 0x3B, 0x65, 0x76, 0x09, 0xE3, 0x3C, 0x18, 0x18, 0x0F, 0xC0, 0x8D, 0xCB, 0x18,
+    0xCA, 0x1A, 0xCC, 0x41, 0xDB, 0x9A, 0x34, 0x89, 0x08, 0x02, 0xD8, 0x09, 0x4A, 0x15, 0x74, 0x39,
+    0x6A, 0x51, 0x63, 0xFE, 0x18, 0x92, 0x78, 0x7B, 0xF4, 0xF1, 0x05, 0xB3, 0x3A, 0xB2, 0x15, 0xA4,
+    0x33, 0x16, 0x1E, 0x13, 0xE1, 0x31, 0x22, 0x49, 0xD9, 0x49, 0xC2, 0xC5, 0xB6, 0x35, 0x3C, 0x52,
+    0x2D, 0x1D, 0x9B, 0x47, 0x48, 0x3E, 0x47, 0x56, 0xA6, 0xE4, 0xA1, 0x23, 0x51, 0xE9, 0xC2, 0x5D,
+    0x3F, 0x9A, 0x19, 0x3A, 0xD4, 0x10, 0xA2, 0xAC, 0xF4, 0x8D, 0x39, 0x5F, 0xB3, 0xE3, 0x58, 0xD5,
+    0xBB, 0x76, 0x7B, 0x32, 0xCD, 0x36, 0xD7, 0xE9, 0x3C, 0x9C, 0x31, 0x25, 0x8A, 0x5B, 0x6B, 0x43,
+    0xF2, 0x09, 0x5A, 0xD8, 0x16, 0x70, 0x6B, 0x57, 0xA8, 0x15, 0xAF, 0xD6, 0x49, 0x88, 0x43, 0x03,
+    0x7A, 0x68, 0x0B, 0x5E, 0xF4, 0xA4, 0xC5, 0x19, 0xA0, 0x04, 0x0A, 0xA8, 0xBE, 0x28, 0x03, 0xAE,
+    0x61, 0x03, 0xEE, 0xE2, 0x79, 0x4E, 0xB8, 0x93, 0xAB, 0x4A, 0x6B, 0xB2, 0x4C, 0x97, 0xC4, 0x72,
+    0x9A, 0x8B, 0x6B, 0x00, 0x16, 0x1B, 0x41, 0x87, 0x6D, 0x70, 0xE3, 0x90, 0xE5, 0x08, 0xD4, 0x83,
+    0x91, 0x3D, 0x28, 0xBD, 0x46, 0xD8, 0x01, 0x1D, 0x59, 0x1B, 0x92, 0x9A, 0xDE, 0x58, 0xC6, 0xB9,
+    0xBD, 0x6E, 0xB2, 0x22, 0x1F, 0xE5, 0x79, 0x46, 0x30, 0x3A, 0x1E, 0x1A, 0x93, 0x5B, 0x74, 0x57,
+    0x16, 0x20, 0x7D, 0xB8, 0x8B, 0xCB, 0xB7, 0x88, 0x18, 0xBB, 0x5A, 0xFA, 0x7E, 0x65, 0xA3, 0x79,
+    0x69, 0x8B, 0x85, 0x6C, 0x4E, 0x7A, 0x93, 0x21, 0x86, 0xEB, 0xB9, 0xC7, 0x43, 0xCD, 0x3A, 0x78,
+    0xC9, 0xF3, 0xAF, 0x10, 0x6A, 0x66, 0x7D, 0xC8, 0xEC, 0xAC, 0x95, 0xB1, 0xBB, 0xBA, 0x61, 0x8B,
+    0x5F, 0xD8, 0x6D, 0xF1, 0x4C, 0x6C, 0x7E, 0xAD, 0x57, 0xD5, 0xF1, 0x92, 0x8A, 0x94, 0x86, 0x6B,
+    0xCB, 0x44, 0xBB, 0xED, 0x1A, 0xE3, 0xD6, 0xB8, 0x5D, 0x67, 0x2B, 0x83, 0x4E, 0xB8, 0xA5, 0x8D,
+    0x19, 0x42, 0x23, 0xB9, 0xDD, 0x40, 0x3E, 0x6C, 0x88, 0xEE, 0xDB, 0x22, 0xB6, 0x57, 0x62, 0xA0,
+    0x03, 0x3F, 0x5F, 0xB9, 0x8F, 0x78, 0x53, 0xE2, 0x07, 0x3C, 0x41, 0x45, 0x43, 0x9C, 0xED, 0x84,
+    0x5F, 0xB2, 0xE4, 0xE4, 0xCD, 0x54, 0x9D, 0x5C, 0x6F, 0x08, 0x3C, 0x21, 0xCA, 0x1E, 0xA0, 0x63,
+    0xDF, 0xBE, 0x6E, 0xAC, 0xDB, 0xDE, 0xB3, 0x2F, 0xF0, 0x8A, 0x1F, 0x40, 0xD2, 0x79, 0xA9, 0x3E,
+    0x1A, 0xA6, 0xAE, 0x0D, 0xA5, 0x77, 0x01, 0xB3, 0x3D, 0x52, 0x1F, 0xF6, 0x7B, 0xF9, 0x5F, 0xC6,
+    0xDF, 0xCD, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0xDB, 0x48, 0x8E, 0xE4, 0x62, 0x53, 0x10,
+    0x09, 0xA5, 0x60, 0xEB, 0x34, 0xF8, 0x0F, 0xE4, 0x6E, 0x2D, 0x22, 0xFA, 0x08, 0xC9, 0x05, 0x3F,
+    0x02, 0xA5, 0xA5, 0x48, 0xCE, 0xFE, 0x07, 0x29, 0x10, 0x55, 0x0A, 0x6A, 0x92, 0x82, 0x0A, 0x89,
+    0x48, 0x77, 0xB1, 0xA9, 0x52, 0xD0, 0x98, 0xA4, 0xA0, 0x75, 0x94, 0x92, 0x22, 0x56, 0x64, 0x84,
+    0x93, 0xEC, 0xDD, 0x32, 0x6F, 0x2E, 0x3E, 0x1A, 0x44, 0x84, 0x04, 0x82, 0x53, 0x32, 0x9A, 0x9D,
+    0xDD, 0xF9, 0x7A, 0xFB, 0x66, 0x9D, 0xA6, 0x29, 0x91, 0x71, 0xCE, 0xE5, 0x8A, 0xC5, 0x94, 0xD2,
+    0x34, 0x2D, 0x6A, 0x22, 0xF2, 0xA7, 0x2C, 0x28, 0x2E, 0x59, 0x04, 0x2D, 0xD4, 0x23, 0x1C, 0x72,
+    0xBB, 0x10, 0x97, 0xD7, 0xFB, 0xFB, 0x07, 0x9D, 0x18, 0x21, 0x4C, 0xD2, 0x9F, 0x8C, 0x3F, 0x89,
+    0x3B, 0xCE, 0x54, 0x38, 0x9E, 0x78, 0x69, 0xCA, 0x9B, 0x19, 0x0C, 0x6E, 0x4B, 0xE4, 0x87, 0xEC,
+    0x7A, 0xFF, 0x60, 0x46, 0x51, 0x03, 0x3F, 0xDF, 0x12, 0xA9, 0x8A, 0x0A, 0xC9, 0x81, 0x08, 0xD3,
+    0x7F, 0xB2, 0x11, 0xB6, 0xBE, 0x9B, 0x91, 0x76, 0x97, 0xCE, 0x95, 0xCA, 0x49, 0xE3, 0xFC, 0x03,
+    0x1E, 0x56, 0x8B, 0xE0, 0x7E, 0x6D, 0xC4, 0x0D, 0x8F, 0x03, 0xDE, 0xDC, 0x26, 0x47, 0xB4, 0x4E,
+    0x59, 0x49, 0x0F, 0x28, 0x06, 0x54, 0x0A, 0xF8, 0x04, 0x1C, 0x8D, 0xBC, 0x19, 0x1C, 0x0B, 0xE0,
+    0x61, 0x80, 0x87, 0x86, 0x30, 0x39, 0x6C, 0xD8, 0xB5, 0x3D, 0x98, 0xAA, 0xEE, 0x11, 0xCB, 0x88,
+    0xEE, 0x71, 0x45, 0xF4, 0x30, 0xE0, 0xF0, 0x43, 0x14, 0x36, 0x84, 0xD3, 0x04, 0xE8, 0x59, 0x11,
+    0x31, 0x0B, 0xC1, 0x7A, 0x79, 0x25, 0x4D, 0x9F, 0xF2, 0xE2, 0x23, 0xFF, 0x63, 0xED, 0x23, 0x88,
+    0x46, 0x2E, 0x6C, 0x47, 0x88, 0x36, 0x84, 0xB9, 0xE9, 0xCD, 0xF6, 0xB7, 0xCD, 0xE1, 0x1D, 0x66,
+    0xDA, 0x84, 0x78, 0xC1, 0x0D, 0x24, 0x14, 0x70, 0xFA, 0xF1, 0x5C, 0x6B, 0x00, 0x0A, 0xA9, 0x5C,
+    0xDC, 0x76, 0x16, 0xDA, 0x80, 0xB5, 0x92, 0xBC, 0x46, 0x7C, 0x39, 0xA3, 0xD7, 0xF6, 0x1A, 0xCD,
+    0xB5, 0x70, 0xAE, 0xC5, 0x0C, 0x4D, 0x42, 0x51, 0x22, 0x1E, 0x6C, 0x58, 0x0A, 0xAA, 0xFB, 0xA3,
+    0x68, 0xA3, 0x71, 0xCF, 0x8B, 0x3C, 0x73, 0x35, 0x69, 0xEE, 0xAF, 0xE0, 0xBB, 0x73, 0xD3, 0xB0,
+    0x7B, 0xE7, 0xD4, 0x46, 0xF5, 0x7E, 0x59, 0x2D, 0x0E, 0xC3, 0x15, 0xD8, 0xBA, 0x2A, 0x72, 0xAD,
+    0x4E, 0xEC, 0x90, 0x06, 0x03, 0x1A, 0xF2, 0x1F, 0x2B, 0x71, 0x62, 0x95, 0xE3, 0xBB, 0xCD, 0xE5,
+    0x84, 0x35, 0xE7, 0x33, 0xC1, 0x9C, 0x68, 0x55, 0xEE, 0x17, 0x7A, 0x28, 0x5C, 0x17, 0x82, 0x5B,
+    0xE1, 0x32, 0xF5, 0x8D, 0xCB, 0x36, 0x5A, 0x23, 0x4F, 0xE0, 0x1F, 0xFF, 0xD8, 0xCE, 0x0D, 0x13,
+    0xB8, 0x52, 0xAE, 0x0C, 0x1A, 0xFF, 0xA0, 0x01, 0xFC, 0x53, 0xB4, 0x1D, 0xE7, 0xBC, 0x1D, 0x36,
+    0xDC, 0x3D, 0xD9, 0xB0, 0xE2, 0xF5, 0xE3, 0x06, 0x09, 0x10, 0xD7, 0xA2, 0x58, 0xB3, 0x85, 0x84,
+    0x17, 0x88, 0xEB, 0x90, 0xD6, 0x20, 0x78, 0x24, 0x69, 0x67, 0x8B, 0x39, 0x0A, 0xA5, 0x58, 0xF2,
+    0xBC, 0x43, 0x8A, 0x95, 0xCB, 0x8F, 0xE2, 0xBD, 0xB3, 0x76, 0xE0, 0xDD, 0x94, 0xDB, 0x94, 0x25,
+    0x63, 0x06, 0x6D, 0xCC, 0x35, 0xEC, 0xD0, 0x4D, 0x69, 0xF6, 0x4E, 0x5A, 0xED, 0x92, 0x99, 0xDF,
+    0xD1, 0x23, 0x71, 0x38, 0xA4, 0xA8, 0xF6, 0x5D, 0xAD, 0x9D, 0x7F, 0x75, 0xA4, 0x5F, 0xD7, 0x5D,
+    0x78, 0x41, 0xE3, 0x75, 0xE6, 0x9D, 0xD6, 0x7C, 0x1F, 0xC1, 0x71, 0x19, 0xB6, 0x5E, 0xD3, 0xC2,
+    0x68, 0xF6, 0x4E, 0xAF, 0x26, 0x81, 0xAB, 0xE2, 0x19, 0x57, 0xEC, 0x4D, 0x68, 0x22, 0x83, 0x8E,
+    0xDC, 0x51, 0xB5, 0x00, 0xE3, 0x6F, 0x18, 0x0B, 0xCC, 0x3F, 0xE8, 0x2C, 0x14, 0x76, 0xE8, 0x9E,
+    0x96, 0x68, 0x01, 0xBD, 0x12, 0x03, 0x06, 0x85, 0x07, 0x92, 0xFA, 0xC1, 0x91, 0xB9, 0x9A, 0xCF,
+    0x8A, 0x27, 0x93, 0x29, 0xB3, 0x43, 0x32, 0x01, 0x91, 0x78, 0x64, 0x02, 0x9B, 0xDC, 0x91, 0x0C,
+    0xDD, 0xAD, 0x47, 0xF5, 0x53, 0x0F, 0x24, 0xEE, 0xE4, 0x3D, 0x3A, 0x97, 0xE7, 0x28, 0x5F, 0x1B,
+    0xDE, 0xF1, 0x5B, 0x59, 0xF3, 0x5F, 0x36, 0x23, 0x13, 0x9E, 0xFF, 0x39, 0x71, 0xB6, 0xB9, 0xD2,
+    0x53, 0xA9, 0xEE, 0x29, 0x10, 0x38, 0x6E, 0xC3, 0xFB, 0x86, 0x8E, 0x2C, 0xA8, 0x36, 0xD4, 0xDC,
+    0x7D, 0x0C, 0xFE, 0xA9, 0x72, 0x02, 0x1A, 0xC9, 0x50, 0x61, 0x6D, 0x81, 0xEE, 0x04, 0xFC, 0x34,
+    0xE0, 0x27, 0x9F, 0x1B, 0x01, 0x65, 0xC5, 0x6C, 0x64, 0xA0, 0x41, 0xD6, 0x11, 0x00, 0x55, 0x25,
+    0x67, 0xF0, 0x3B, 0x5C, 0x82, 0x01, 0x97, 0xD5, 0xE7, 0x1A, 0x54, 0x1E, 0x21, 0xEB, 0x2E, 0xAF,
+    0xA3, 0x93, 0x16, 0xFC, 0xCE, 0x60, 0xC4, 0xBE, 0x85, 0xA7, 0x41, 0x59, 0x71, 0xC2, 0x23, 0xAA,
+    0x4A, 0x5E, 0xF3, 0x74, 0x18, 0x5C, 0x1E, 0x87, 0xB7, 0x78, 0x66, 0x76, 0x6E, 0x4F, 0x84, 0x95,
+    0x90, 0x1C, 0x77, 0x2B, 0x25, 0x86, 0x67, 0x5D, 0x5F, 0xB7, 0xCE, 0xFA, 0x66, 0xA8, 0x28, 0xFB,
+    0x0E, 0xE5, 0xD1, 0xF3, 0x52, 0x8C, 0xA9, 0xAB, 0x78, 0x90, 0x5D, 0x1D, 0xB8, 0x57, 0x45, 0xA3,
+    0x2B, 0xD2, 0x15, 0x5F, 0x91, 0x3E, 0xC6, 0x83, 0x8C, 0x86, 0x27, 0xDC, 0x9A, 0x77, 0xCD, 0xA7,
+    0xC3, 0x2F, 0x1C, 0x5B, 0xBF, 0xE5, 0x30, 0xA3, 0xFF, 0xC2, 0xC4, 0xB0, 0xF9, 0x5F, 0x81, 0xEA,
+    0x29, 0xDB, 0x33, 0x26, 0x5E, 0xD0, 0xA9, 0xAB, 0x27, 0x05, 0x7F, 0x2E, 0x9C, 0xA5, 0xD0, 0xA1,
+    0xDF, 0x67, 0xE8, 0xD9, 0x7B, 0x03, 0xAA, 0x59, 0x7C, 0x52, 0x6B, 0x86, 0x8F, 0x01, 0x9B, 0xF2,
+    0x03, 0x05, 0x7C, 0xE5, 0xF5, 0xD7, 0x7F, 0x55, 0xE1, 0xB7, 0x80, 0x72, 0x7E, 0x45, 0x4C, 0xC8,
+    0xF5, 0xE1, 0x3B, 0xA6, 0x51, 0xD7, 0x6A, 0x42, 0xBF, 0xF8, 0x7D, 0x07, 0xAD, 0x55, 0xBD, 0x8E,
+    0xDB, 0x46, 0x10, 0x9E, 0x25, 0xAD, 0x63, 0x10, 0x16, 0x6C, 0xE2, 0x26, 0x80, 0xCD, 0x94, 0x46,
+    0x00, 0x87, 0x2F, 0xA0, 0x3B, 0x31, 0x55, 0x8A, 0x14, 0x56, 0x91, 0x75, 0xE3, 0xE2, 0xDE, 0xC0,
+    0x6A, 0x5C, 0x9E, 0x4D, 0xBE, 0x41, 0x5C, 0xF8, 0x7A, 0x17, 0x6E, 0xCC, 0x14, 0x69, 0x53, 0x18,
+    0x47, 0xE5, 0x5C, 0xA4, 0x34, 0x83, 0xBC, 0x00, 0x8B, 0xB8, 0x71, 0x1A, 0x26, 0xA1, 0x01, 0x0A,
+    0x11, 0xB9, 0xF9, 0xBE, 0xA1, 0xA4, 0x93, 0x0E, 0x48, 0x10, 0x03, 0x19, 0x8C, 0x16, 0xDC, 0x9D,
+    0x9D, 0x99, 0x6F, 0xFE, 0x56, 0x22, 0x13, 0x01, 0xC5, 0x35, 0x96, 0x68, 0x8D, 0xC5, 0x1B, 0xB8,
+    0x3F, 0x91, 0x0F, 0x25, 0xD3, 0x89, 0x04, 0xB5, 0x13, 0xF1, 0xFB, 0xAC, 0x12, 0x71, 0xF7, 0x1A,
+    0x91, 0xD9, 0x72, 0x0E, 0x41, 0x4A, 0x0F, 0x9F, 0x44, 0xDC, 0xFF, 0xD4, 0xC3, 0xCB, 0x7B, 0xBD,
+    0x94, 0xA4, 0x22, 0x8F, 0x3F, 0xD8, 0x8B, 0xD7, 0x70, 0x71, 0xFC, 0x74, 0x4B, 0x2C, 0x49, 0x45,
+    0xD7, 0x30, 0x25, 0x2F, 0xA2, 0x26, 0xFB, 0xB1, 0xF7, 0x9E, 0x1E, 0xDE, 0xBF, 0x08, 0xD6, 0x71,
+    0x9D, 0xE1, 0xE3, 0x7F, 0xC3, 0xF0, 0x2F, 0x71, 0xAA, 0xFC, 0x68, 0x25, 0x26, 0x77, 0x2E, 0x8D,
+    0xC3, 0xB7, 0xEE, 0xB7, 0x6E, 0x2A, 0x0B, 0x97, 0xCF, 0xE5, 0xE8, 0xF9, 0xA8, 0x1C, 0xAE, 0xC4,
+    0x83, 0x30, 0x8F, 0xA3, 0x9F, 0xCB, 0xBF, 0xDA, 0xA9, 0x24, 0x2E, 0x9D, 0xCB, 0xE4, 0x1A, 0x66,
+    0x71, 0xA0, 0xD7, 0x5C, 0x26, 0xD6, 0xDA, 0x6F, 0x0E, 0x65, 0x11, 0x8E, 0xD7, 0x33, 0x2C, 0xCD,
+    0x88, 0xE6, 0x85, 0xDC, 0x08, 0x5D, 0xFA, 0x45, 0xE2, 0xDA, 0x27, 0xB3, 0xC0, 0xAD, 0xA7, 0x52,
+    0xB6, 0x37, 0x64, 0x92, 0x7A, 0x9D, 0x7C, 0x14, 0xB9, 0xFC, 0x64, 0xE6, 0x56, 0x17, 0x27, 0x1E,
+    0xCF, 0x33, 0x54, 0xD8, 0x8C, 0x36, 0x56, 0xA9, 0x3C, 0x50, 0xFB, 0x1E, 0x7E, 0xB5, 0x18, 0xBB,
+    0xEF, 0xE0, 0xD3, 0xE2, 0x25, 0x60, 0xE1, 0xDC, 0xBD, 0x2B, 0xDC, 0x25, 0x62, 0x3A, 0xDA, 0x08,
+    0xEE, 0x40, 0xBF, 0x99, 0xD8, 0xD3, 0x67, 0xA5, 0x73, 0x7F, 0xE0, 0xC2, 0x52, 0x8E, 0x51, 0x0A,
+    0x58, 0x8D, 0x45, 0xEC, 0xCA, 0x7E, 0x8D, 0xA3, 0x18, 0xD8, 0x7C, 0x24, 0xE5, 0x36, 0xAE, 0x7F,
+    0x86, 0xDF, 0xE7, 0x45, 0x51, 0x3C, 0xA7, 0xA3, 0x4B, 0x7C, 0x14, 0x87, 0x81, 0xF8, 0x3C, 0xD7,
+    0x68, 0x6E, 0x22, 0xCA, 0xF9, 0xA1, 0x50, 0x03, 0x74, 0xEA, 0x64, 0x43, 0x00, 0x12, 0xA7, 0x12,
+    0x38, 0x31, 0x40, 0x9C, 0xB5, 0x12, 0xF7, 0xD8, 0xA4, 0x5A, 0x7F, 0x46, 0x96, 0xA0, 0x2A, 0xE1,
+    0xC0, 0xD6, 0xC8, 0x45, 0xCA, 0x9A, 0x25, 0x11, 0xB9, 0xB5, 0x55, 0x86, 0x03, 0xC2, 0x43, 0x58,
+    0xEC, 0x70, 0x69, 0x51, 0x41, 0x34, 0x01, 0xF5, 0x0D, 0x3D, 0x94, 0x5B, 0x03, 0x90, 0xC6, 0x8D,
+    0x04, 0x03, 0x8E, 0x73, 0x9E, 0xF2, 0x90, 0x46, 0xF3, 0x2B, 0x64, 0xD7, 0x4C, 0x8D, 0x55, 0xCD,
+    0xC9, 0xE8, 0x4A, 0x36, 0x26, 0xD4, 0x46, 0x4D, 0x70, 0xD8, 0x93, 0x3D, 0x97, 0x82, 0x39, 0x62,
+    0x9C, 0xB2, 0x59, 0x4B, 0x26, 0xFE, 0x78, 0xC4, 0x40, 0x18, 0x80, 0xED, 0x6D, 0x90, 0x28, 0x98,
+    0x25, 0x59, 0x3E, 0x56, 0xDE, 0xA7, 0x1F, 0x94, 0xFD, 0x81, 0x3C, 0x2A, 0xE5, 0x3B, 0xA5, 0xB8,
+    0x23, 0x13, 0x7D, 0x40, 0x61, 0x4F, 0x96, 0xAC, 0x21, 0x8F, 0xCE, 0x46, 0x5F, 0xC6, 0x55, 0x02,
+    0x1E, 0x01, 0x32, 0xBA, 0x31, 0xC0, 0xFD, 0x18, 0x37, 0x15, 0x18, 0x52, 0x96, 0xA7, 0x37, 0xD6,
+    0xDE, 0x2F, 0x39, 0x66, 0xB4, 0xA7, 0xD8, 0x80, 0xA0, 0xD5, 0xE1, 0xD2, 0x97, 0x83, 0x8A, 0x41,
+    0xB3, 0x99, 0x8C, 0xCD, 0xE1, 0x2C, 0xDD, 0xDE, 0x4C, 0x2A, 0x64, 0xAC, 0xAC, 0x59, 0xCB, 0x8A,
+    0x55, 0xCD, 0x27, 0xDB, 0x96, 0x1E, 0xE7, 0x45, 0x0D, 0xBD, 0x52, 0x1D, 0x6D, 0x6F, 0x5A, 0x0B,
+    0x2B, 0x14, 0x00, 0x09, 0x0E, 0xA8, 0x15, 0x0C, 0xE7, 0x17, 0xF6, 0xAB, 0x0E, 0x62, 0xBF, 0x83,
+    0xD8, 0xAC, 0x25, 0xA8, 0xE0, 0x04, 0x0F, 0x01, 0xA6, 0x17, 0x27, 0x15, 0x26, 0xD8, 0x6B, 0x25,
+    0xA1, 0x67, 0x68, 0xC7, 0x4B, 0x88, 0xFD, 0x8E, 0xEF, 0x44, 0x96, 0x6B, 0x53, 0x5C, 0x58, 0x2B,
+    0x25, 0xFB, 0x89, 0xDD, 0x0E, 0xED, 0xB7, 0xD8, 0xEB, 0x33, 0x22, 0x5A, 0xC1, 0x63, 0x0D, 0x6A,
+    0x53, 0x46, 0xA5, 0xF9, 0xE1, 0x71, 0xA4, 0x01, 0xD7, 0xE3, 0xE3, 0xC3, 0x8C, 0x3C, 0xD5, 0xD6,
+    0x4D, 0xAD, 0x5D, 0x7C, 0xDF, 0x52, 0x8C, 0xFA, 0xF9, 0x75, 0xD8, 0x60, 0x3A, 0xA4, 0xA7, 0xD1,
+    0x24, 0xC7, 0xF3, 0x19, 0xA0, 0xDA, 0x29, 0xC0, 0x86, 0x4B, 0x79, 0x42, 0xED, 0x24, 0x37, 0x2D,
+    0xC1, 0xBE, 0x12, 0xDC, 0x3C, 0x91, 0xB0, 0xBD, 0x79, 0x7A, 0xBE, 0xE8, 0x98, 0x91, 0x96, 0x36,
+    0x6B, 0x73, 0x7F, 0x65, 0x0F, 0x32, 0x11, 0x33, 0x3D, 0x21, 0x7D, 0x73, 0xC6, 0xF8, 0xB0, 0x30,
+    0x7B, 0x9C, 0xCC, 0x86, 0x5A, 0xDD, 0xAC, 0xDA, 0xA6, 0x38, 0xAA, 0xB6, 0x15, 0xF0, 0x34, 0x9B,
+    0xFD, 0xAE, 0x02, 0x21, 0x35, 0xCD, 0xFA, 0x6A, 0xAF, 0x61, 0xB3, 0x67, 0x34, 0x90, 0x41, 0x32,
+    0x8E, 0x98, 0x29, 0xF8, 0x0A, 0xEC, 0x88, 0x43, 0x5B, 0x7C, 0xCB, 0x10, 0xFF, 0xE4, 0xB2, 0x46,
+    0xEE, 0x7E, 0xD5, 0x81, 0xAC, 0x43, 0xEE, 0x15, 0x9B, 0xDA, 0xD1, 0x3F, 0x8A, 0xF8, 0x7A, 0x3B,
+    0x70, 0x1F, 0x68, 0xB6, 0xBA, 0x1D, 0x98, 0x4C, 0x11, 0xD0, 0x6D, 0x79, 0xA9, 0x53, 0xAD, 0x09,
+    0x4C, 0xDC, 0xF0, 0x72, 0xBF, 0xE5, 0xE8, 0xB7, 0xA0, 0x23, 0xF7, 0xC6, 0xED, 0x1E, 0x38, 0xD0,
+    0x02, 0xFE, 0x85, 0x25, 0xCC, 0xC5, 0xF4, 0xC1, 0x97, 0xBD, 0x98, 0xD6, 0x54, 0xE8, 0x91, 0x56,
+    0x1E, 0xC9, 0x19, 0xD6, 0x5B, 0x48, 0xD3, 0x99, 0x04, 0xA9, 0xB4, 0x77, 0xC5, 0x54, 0x72, 0x3B,
+    0x12, 0x08, 0xFC, 0xD7, 0x4B, 0xCE, 0xFF, 0xEF, 0xEF, 0xED, 0x83, 0x73, 0xFB, 0x98, 0x71, 0x3A,
+    0x77, 0x5A, 0x14, 0x43, 0xF1, 0xDD, 0x2F, 0x2A, 0x68, 0x1A, 0x6A, 0x4C, 0x8F, 0xA9, 0x11, 0x07,
+    0x39, 0x34, 0xA2, 0x94, 0xA6, 0x82, 0x65, 0x0C, 0x81, 0x5F, 0x79, 0x8D, 0xA9, 0xB4, 0x6C, 0x8F,
+    0x90, 0x44, 0x33, 0x3C, 0x5C, 0x20, 0xC9, 0xA1, 0xD3, 0xD4, 0x4D, 0x9E, 0xED, 0x81, 0xDE, 0x80,
+    0x7B, 0xA7, 0xE0, 0x94, 0x3B, 0x6D, 0x60, 0x66, 0xE4, 0x4C, 0x3A, 0xAD, 0xE1, 0x99, 0x36, 0xFA,
+    0x5D, 0xAE, 0x04, 0x27, 0x0A, 0x4E, 0x14, 0x1C, 0xE8, 0x0A, 0x5C, 0xA1, 0xE0, 0x44, 0xC1, 0x81,
+    0xA6, 0xDA, 0x83, 0x04, 0x07, 0x23, 0x29, 0x0D, 0x12, 0x1C, 0xB4, 0x2B, 0xB6, 0xAF, 0x82, 0x13,
+    0x05, 0x67, 0xFF, 0x09, 0xDC, 0x7F, 0xA0, 0xBF, 0x01, 0xAD, 0x92, 0x4D, 0x4A, 0xC4, 0x40, 0x10,
+    0x85, 0x5F, 0x52, 0x48, 0x16, 0x11, 0xE2, 0x09, 0x9C, 0x13, 0x0C, 0xB9, 0xC0, 0xFC, 0x04, 0xBC,
+    0x80, 0x1B, 0xB7, 0x5E, 0x61, 0x36, 0x2E, 0x5C, 0xA8, 0x3D, 0xEA, 0x15, 0x3C, 0x8E, 0x3A, 0x41,
+    0x2F, 0x10, 0x70, 0xE9, 0x26, 0x30, 0x03, 0x82, 0x1B, 0x5B, 0x08, 0x8E, 0x32, 0x6D, 0xCA, 0xD7,
+    0x9D, 0x01, 0xC7, 0x85, 0xAE, 0x2C, 0xD2, 0xEF, 0xF1, 0xBA, 0x8B, 0xF4, 0x97, 0x22, 0x40, 0x57,
+    0x13, 0x5D, 0x50, 0x67, 0xCF, 0x3A, 0x45, 0xF4, 0x19, 0x9E, 0x06, 0x48, 0x2B, 0xB4, 0x80, 0x38,
+    0xAC, 0x6A, 0xC8, 0xAA, 0x3C, 0x19, 0x41, 0x6C, 0xD3, 0x97, 0x5A, 0xEC, 0x6E, 0x86, 0x91, 0x58,
+    0xB9, 0x2F, 0x65, 0x6E, 0xF1, 0x5A, 0x63, 0x6C, 0xD1, 0x3F, 0x46, 0x62, 0x91, 0x1E, 0x42, 0x5A,
+    0xC4, 0x0F, 0xA5, 0x2C, 0x6B, 0x58, 0x2B, 0x76, 0x84, 0xC1, 0x90, 0x9D, 0x75, 0x2F, 0xB9, 0xB4,
+    0x18, 0xA5, 0xC5, 0xD2, 0x42, 0x9E, 0xCA, 0x9E, 0x05, 0xC6, 0x55, 0xCC, 0x3B, 0x92, 0x1A, 0xF9,
+    0x14, 0x69, 0x8D, 0xA8, 0x3D, 0x98, 0x54, 0xBC, 0x53, 0x89, 0x00, 0x6C, 0x5D, 0xE1, 0xBB, 0x7E,
+    0x83, 0xA3, 0xC6, 0x2E, 0x28, 0xE1, 0xA8, 0x84, 0xF3, 0x4A, 0x38, 0x2A, 0xE1, 0xA8, 0x1E, 0x2E,
+    0x0E, 0x70, 0x71, 0x80, 0xA3, 0x12, 0x8E, 0x4A, 0x38, 0xAF, 0x83, 0xA1, 0xD7, 0x5E, 0x72, 0x41,
+    0x4D, 0x8B, 0x37, 0x6A, 0x12, 0xE0, 0x24, 0xC0, 0xC9, 0x9F, 0x70, 0x8E, 0x4B, 0xD8, 0x8B, 0xAC,
+    0xA4, 0x8C, 0xFF, 0x77, 0x4B, 0x7F, 0x54, 0x89, 0xC8, 0x8D, 0xE7, 0x6D, 0x5E, 0xEE, 0xAF, 0x47,
+    0x72, 0xE3, 0xBB, 0xD3, 0x47, 0x87, 0xDC, 0x62, 0xA6, 0x16, 0x5A, 0x8A, 0x9A, 0x82, 0xA3, 0x49,
+    0x9A, 0x1D, 0xA0, 0x40, 0xB4, 0x31, 0x3E, 0x6C, 0xAF, 0xDD, 0x75, 0x96, 0xAD, 0x5D, 0x3B, 0xCF,
+    0x5E, 0x3A, 0xB7, 0x51, 0x70, 0x0E, 0xEF, 0x7A, 0xDD, 0xEC, 0x3D, 0xFB, 0xB8, 0x2D, 0xFC, 0x3E,
+    0x21, 0xCE, 0xE9, 0x19, 0x7D, 0xCF, 0x85, 0xD8, 0xF2, 0x3D, 0x3E, 0xBA, 0xDC, 0x05, 0xDA, 0x4A,
+    0x9D, 0x8F, 0x0B, 0x51, 0x67, 0x98, 0x90, 0x6B, 0x63, 0x94, 0xFF, 0x82, 0x6A, 0x61, 0xF4, 0x1D,
+    0x46, 0x1B, 0xAE, 0x3A, 0x67, 0xA4, 0xDF, 0x29, 0x23, 0x3D, 0xF1, 0x11, 0xA6, 0xF5, 0xA7, 0x3E,
+    0x87, 0x08, 0xD3, 0x18, 0x1F, 0x61, 0xA6, 0x21, 0xE2, 0x4C, 0x42, 0xC4, 0x69, 0x1E, 0x22, 0xBA,
+    0x53, 0x7A, 0x17, 0x71, 0xB4, 0xF1, 0xB1, 0x5F,
+};
+
+static const uint32_t bookerly_16_italicBlockOffsets[44] = {
+    0, 1093, 2147, 3160, 4216, 5398, 6596, 7435,
+    8163, 8838, 9767, 10592, 11333, 12224, 13005, 13798,
+    14765, 15692, 16535, 17267, 18183, 19075, 20001, 21024,
+    22027, 23050, 24283, 25491, 26614, 27715, 28804, 29780,
+    30781, 31749, 32808, 33836, 34714, 35714, 36759, 37984,
+    39073, 39900, 40841, 41192,
+};
+
+static const uint16_t bookerly_16_italicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_italicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_16_italicPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_16_italicGlyphs[] = {
@@ -5264,725 +2782,725 @@ static const EpdGlyph bookerly_16_italicGlyphs[] = {
     { 19, 23, 21, 0, 23, 110, 1652 }, // 4
     { 18, 24, 21, 1, 23, 108, 1762 }, // 5
     { 20, 24, 21, 1, 23, 120, 1870 }, // 6
-    { 17, 24, 21, 4, 23, 102, 1990 }, // 7
-    { 18, 24, 21, 1, 23, 108, 2092 }, // 8
-    { 19, 24, 21, 0, 23, 114, 2200 }, // 9
-    { 8, 18, 10, 2, 17, 36, 2314 }, // :
-    { 11, 23, 10, -1, 17, 64, 2350 }, // ;
-    { 15, 16, 21, 3, 19, 60, 2414 }, // <
-    { 15, 9, 21, 3, 16, 34, 2474 }, // =
-    { 15, 16, 21, 3, 19, 60, 2508 }, // >
-    { 12, 25, 14, 2, 24, 75, 2568 }, // ?
-    { 30, 30, 32, 1, 23, 225, 2643 }, // @
-    { 25, 24, 24, -2, 24, 150, 2868 }, // A
-    { 20, 25, 20, -1, 24, 125, 3018 }, // B
-    { 20, 25, 21, 1, 24, 125, 3143 }, // C
-    { 24, 25, 24, -1, 24, 150, 3268 }, // D
-    { 21, 23, 20, -1, 23, 121, 3418 }, // E
-    { 20, 23, 18, -1, 23, 115, 3539 }, // F
-    { 21, 25, 23, 1, 24, 132, 3654 }, // G
-    { 29, 23, 26, -1, 23, 167, 3786 }, // H
-    { 15, 23, 12, -1, 23, 87, 3953 }, // I
-    { 20, 30, 12, -6, 23, 150, 4040 }, // J
-    { 25, 24, 23, -1, 23, 150, 4190 }, // K
-    { 19, 23, 19, -1, 23, 110, 4340 }, // L
-    { 32, 23, 30, -2, 23, 184, 4450 }, // M
-    { 28, 24, 25, -1, 23, 168, 4634 }, // N
-    { 23, 25, 24, 1, 24, 144, 4802 }, // O
-    { 20, 24, 20, -1, 24, 120, 4946 }, // P
-    { 28, 32, 24, 1, 24, 224, 5066 }, // Q
-    { 22, 25, 21, -1, 24, 138, 5290 }, // R
-    { 17, 25, 18, 0, 24, 107, 5428 }, // S
-    { 20, 23, 21, 2, 23, 115, 5535 }, // T
-    { 24, 24, 25, 3, 23, 144, 5650 }, // U
-    { 24, 24, 23, 2, 23, 144, 5794 }, // V
-    { 34, 24, 34, 2, 23, 204, 5938 }, // W
-    { 27, 23, 22, -3, 23, 156, 6142 }, // X
-    { 22, 23, 21, 2, 23, 127, 6298 }, // Y
-    { 20, 24, 19, -1, 23, 120, 6425 }, // Z
-    { 14, 32, 10, -2, 26, 112, 6545 }, // [
-    { 13, 26, 16, 2, 24, 85, 6657 }, // <backslash>
-    { 14, 32, 10, -2, 26, 112, 6742 }, // ]
-    { 16, 15, 21, 2, 21, 60, 6854 }, // ^
-    { 17, 3, 17, 0, -1, 13, 6914 }, // _
-    { 7, 8, 20, 7, 27, 14, 6927 }, // `
-    { 18, 19, 19, 1, 18, 86, 6941 }, // a
-    { 17, 27, 18, 0, 26, 115, 7027 }, // b
-    { 13, 19, 15, 1, 18, 62, 7142 }, // c
-    { 18, 27, 19, 1, 26, 122, 7204 }, // d
-    { 14, 19, 16, 1, 18, 67, 7326 }, // e
-    { 24, 34, 14, -6, 26, 204, 7393 }, // f
-    { 22, 26, 16, -3, 18, 143, 7597 }, // g
-    { 18, 27, 20, 1, 26, 122, 7740 }, // h
-    { 10, 27, 11, 1, 26, 68, 7862 }, // i
-    { 17, 34, 9, -6, 26, 145, 7930 }, // j
-    { 16, 27, 17, 1, 26, 108, 8075 }, // k
-    { 9, 27, 10, 1, 26, 61, 8183 }, // l
-    { 28, 19, 29, 1, 18, 133, 8244 }, // m
-    { 19, 19, 20, 1, 18, 91, 8377 }, // n
-    { 16, 19, 18, 1, 18, 76, 8468 }, // o
-    { 20, 26, 19, -2, 18, 130, 8544 }, // p
-    { 17, 26, 18, 1, 18, 111, 8674 }, // q
-    { 14, 18, 14, 1, 18, 63, 8785 }, // r
-    { 13, 19, 14, 0, 18, 62, 8848 }, // s
-    { 12, 23, 13, 1, 22, 69, 8910 }, // t
-    { 19, 19, 20, 1, 18, 91, 8979 }, // u
-    { 17, 19, 17, 0, 18, 81, 9070 }, // v
-    { 25, 19, 26, 0, 18, 119, 9151 }, // w
-    { 20, 19, 18, -1, 18, 95, 9270 }, // x
-    { 20, 26, 18, -3, 18, 130, 9365 }, // y
-    { 16, 19, 16, 0, 18, 76, 9495 }, // z
-    { 13, 33, 13, 1, 27, 108, 9571 }, // {
-    { 10, 30, 10, 0, 26, 75, 9679 }, // |
-    { 13, 33, 13, -1, 27, 108, 9754 }, // }
-    { 16, 6, 21, 2, 14, 24, 9862 }, // ~
-    { 0, 0, 7, 0, 0, 0, 9886 }, //  
-    { 10, 26, 10, -1, 18, 65, 9886 }, // ¡
-    { 17, 33, 21, 2, 26, 141, 9951 }, // ¢
-    { 21, 24, 21, -1, 23, 126, 10092 }, // £
-    { 21, 16, 21, 0, 19, 84, 10218 }, // ¤
-    { 22, 23, 21, 1, 23, 127, 10302 }, // ¥
-    { 10, 30, 10, 0, 26, 75, 10429 }, // ¦
-    { 15, 26, 16, 0, 23, 98, 10504 }, // §
-    { 12, 5, 20, 4, 25, 15, 10602 }, // ¨
-    { 25, 25, 26, 0, 24, 157, 10617 }, // ©
-    { 13, 16, 14, 1, 24, 52, 10774 }, // ª
-    { 16, 13, 17, 1, 15, 52, 10826 }, // «
-    { 15, 8, 21, 3, 15, 30, 10878 }, // ¬
-    { 11, 3, 12, 1, 10, 9, 10908 }, // ­
-    { 19, 18, 19, 0, 26, 86, 10917 }, // ®
-    { 11, 4, 20, 5, 24, 11, 11003 }, // ¯
-    { 12, 11, 17, 3, 23, 33, 11014 }, // °
-    { 15, 20, 21, 3, 20, 75, 11047 }, // ±
-    { 13, 16, 15, 1, 28, 52, 11122 }, // ²
-    { 12, 17, 15, 1, 28, 51, 11174 }, // ³
-    { 7, 8, 20, 7, 27, 14, 11225 }, // ´
-    { 21, 26, 20, -1, 18, 137, 11239 }, // µ
-    { 21, 28, 19, -1, 23, 147, 11376 }, // ¶
-    { 6, 6, 10, 2, 12, 9, 11523 }, // ·
-    { 8, 8, 20, 6, -1, 16, 11532 }, // ¸
-    { 10, 16, 15, 2, 28, 40, 11548 }, // ¹
-    { 13, 16, 15, 1, 24, 52, 11588 }, // º
-    { 16, 13, 17, 0, 15, 52, 11640 }, // »
-    { 32, 26, 36, 2, 24, 208, 11692 }, // ¼
-    { 32, 26, 36, 2, 24, 208, 11900 }, // ½
-    { 33, 26, 36, 1, 24, 215, 12108 }, // ¾
-    { 11, 25, 14, 0, 18, 69, 12323 }, // ¿
-    { 25, 32, 24, -2, 32, 200, 12392 }, // À
-    { 25, 32, 24, -2, 32, 200, 12592 }, // Á
-    { 25, 32, 24, -2, 32, 200, 12792 }, // Â
-    { 25, 31, 24, -2, 31, 194, 12992 }, // Ã
-    { 25, 31, 24, -2, 31, 194, 13186 }, // Ä
-    { 25, 33, 24, -2, 33, 207, 13380 }, // Å
-    { 33, 23, 30, -3, 23, 190, 13587 }, // Æ
-    { 20, 33, 21, 1, 24, 165, 13777 }, // Ç
-    { 21, 32, 20, -1, 32, 168, 13942 }, // È
-    { 21, 32, 20, -1, 32, 168, 14110 }, // É
-    { 21, 32, 20, -1, 32, 168, 14278 }, // Ê
-    { 21, 31, 20, -1, 31, 163, 14446 }, // Ë
-    { 15, 32, 12, -1, 32, 120, 14609 }, // Ì
-    { 16, 32, 12, -1, 32, 128, 14729 }, // Í
-    { 16, 32, 12, -1, 32, 128, 14857 }, // Î
-    { 17, 31, 12, -1, 31, 132, 14985 }, // Ï
-    { 24, 25, 24, -1, 24, 150, 15117 }, // Ð
-    { 28, 32, 25, -1, 31, 224, 15267 }, // Ñ
-    { 23, 33, 24, 1, 32, 190, 15491 }, // Ò
-    { 23, 33, 24, 1, 32, 190, 15681 }, // Ó
-    { 23, 33, 24, 1, 32, 190, 15871 }, // Ô
-    { 23, 32, 24, 1, 31, 184, 16061 }, // Õ
-    { 23, 32, 24, 1, 31, 184, 16245 }, // Ö
-    { 14, 14, 21, 3, 18, 49, 16429 }, // ×
-    { 26, 25, 24, -1, 24, 163, 16478 }, // Ø
-    { 24, 33, 25, 3, 32, 198, 16641 }, // Ù
-    { 24, 33, 25, 3, 32, 198, 16839 }, // Ú
-    { 24, 33, 25, 3, 32, 198, 17037 }, // Û
-    { 24, 32, 25, 3, 31, 192, 17235 }, // Ü
-    { 22, 32, 21, 2, 32, 176, 17427 }, // Ý
-    { 20, 23, 20, -1, 23, 115, 17603 }, // Þ
-    { 25, 34, 21, -5, 26, 213, 17718 }, // ß
-    { 18, 28, 19, 1, 27, 126, 17931 }, // à
-    { 18, 28, 19, 1, 27, 126, 18057 }, // á
-    { 18, 28, 19, 1, 27, 126, 18183 }, // â
-    { 18, 27, 19, 1, 26, 122, 18309 }, // ã
-    { 18, 26, 19, 1, 25, 117, 18431 }, // ä
-    { 18, 29, 19, 1, 28, 131, 18548 }, // å
-    { 24, 19, 25, 1, 18, 114, 18679 }, // æ
-    { 13, 27, 15, 1, 18, 88, 18793 }, // ç
-    { 14, 28, 16, 1, 27, 98, 18881 }, // è
-    { 15, 28, 16, 1, 27, 105, 18979 }, // é
-    { 15, 28, 16, 1, 27, 105, 19084 }, // ê
-    { 16, 26, 16, 1, 25, 104, 19189 }, // ë
-    { 9, 28, 11, 1, 27, 63, 19293 }, // ì
-    { 12, 28, 11, 1, 27, 84, 19356 }, // í
-    { 12, 28, 11, 1, 27, 84, 19440 }, // î
-    { 13, 26, 11, 1, 25, 85, 19524 }, // ï
-    { 16, 28, 18, 1, 27, 112, 19609 }, // ð
-    { 19, 27, 20, 1, 26, 129, 19721 }, // ñ
-    { 16, 28, 18, 1, 27, 112, 19850 }, // ò
-    { 16, 28, 18, 1, 27, 112, 19962 }, // ó
-    { 16, 28, 18, 1, 27, 112, 20074 }, // ô
-    { 17, 27, 18, 1, 26, 115, 20186 }, // õ
-    { 17, 26, 18, 1, 25, 111, 20301 }, // ö
-    { 15, 16, 21, 3, 19, 60, 20412 }, // ÷
-    { 21, 19, 18, -2, 18, 100, 20472 }, // ø
-    { 19, 28, 20, 1, 27, 133, 20572 }, // ù
-    { 19, 28, 20, 1, 27, 133, 20705 }, // ú
-    { 19, 28, 20, 1, 27, 133, 20838 }, // û
-    { 19, 26, 20, 1, 25, 124, 20971 }, // ü
-    { 20, 35, 18, -3, 27, 175, 21095 }, // ý
-    { 20, 34, 18, -3, 26, 170, 21270 }, // þ
-    { 20, 33, 18, -3, 25, 165, 21440 }, // ÿ
-    { 25, 30, 24, -2, 30, 188, 21605 }, // Ā
-    { 18, 25, 19, 1, 24, 113, 21793 }, // ā
-    { 25, 32, 24, -2, 32, 200, 21906 }, // Ă
-    { 18, 27, 19, 1, 26, 122, 22106 }, // ă
-    { 25, 31, 24, -2, 24, 194, 22228 }, // Ą
-    { 18, 25, 19, 1, 18, 113, 22422 }, // ą
-    { 20, 33, 21, 1, 32, 165, 22535 }, // Ć
-    { 15, 28, 15, 1, 27, 105, 22700 }, // ć
-    { 20, 33, 21, 1, 32, 165, 22805 }, // Ĉ
-    { 15, 28, 15, 1, 27, 105, 22970 }, // ĉ
-    { 20, 32, 21, 1, 31, 160, 23075 }, // Ċ
-    { 13, 26, 15, 1, 25, 85, 23235 }, // ċ
-    { 21, 33, 21, 1, 32, 174, 23320 }, // Č
-    { 16, 28, 15, 1, 27, 112, 23494 }, // č
-    { 24, 33, 24, -1, 32, 198, 23606 }, // Ď
-    { 24, 30, 20, 1, 29, 180, 23804 }, // ď
-    { 24, 25, 24, -1, 24, 150, 23984 }, // Đ
-    { 20, 27, 19, 1, 26, 135, 24134 }, // đ
-    { 21, 30, 20, -1, 30, 158, 24269 }, // Ē
-    { 15, 25, 16, 1, 24, 94, 24427 }, // ē
-    { 21, 32, 20, -1, 32, 168, 24521 }, // Ĕ
-    { 16, 27, 16, 1, 26, 108, 24689 }, // ĕ
-    { 21, 31, 20, -1, 31, 163, 24797 }, // Ė
-    { 14, 26, 16, 1, 25, 91, 24960 }, // ė
-    { 21, 30, 20, -1, 23, 158, 25051 }, // Ę
-    { 14, 25, 16, 1, 18, 88, 25209 }, // ę
-    { 22, 32, 20, -1, 32, 176, 25297 }, // Ě
-    { 16, 28, 16, 1, 27, 112, 25473 }, // ě
-    { 21, 33, 23, 2, 32, 174, 25585 }, // Ĝ
-    { 22, 35, 16, -3, 27, 193, 25759 }, // ĝ
-    { 21, 33, 23, 2, 32, 174, 25952 }, // Ğ
-    { 22, 34, 16, -3, 26, 187, 26126 }, // ğ
-    { 21, 32, 23, 2, 31, 168, 26313 }, // Ġ
-    { 22, 33, 16, -3, 25, 182, 26481 }, // ġ
-    { 21, 33, 23, 2, 24, 174, 26663 }, // Ģ
-    { 22, 36, 16, -3, 28, 198, 26837 }, // ģ
-    { 29, 32, 26, -1, 32, 232, 27035 }, // Ĥ
-    { 18, 35, 20, 1, 34, 158, 27267 }, // ĥ
-    { 29, 23, 26, -1, 23, 167, 27425 }, // Ħ
-    { 18, 27, 20, 1, 26, 122, 27592 }, // ħ
-    { 16, 31, 12, -1, 31, 124, 27714 }, // Ĩ
-    { 13, 27, 11, 1, 26, 88, 27838 }, // ĩ
-    { 16, 30, 12, -1, 30, 120, 27926 }, // Ī
-    { 13, 25, 11, 1, 24, 82, 28046 }, // ī
-    { 16, 32, 12, -1, 32, 128, 28128 }, // Ĭ
-    { 13, 27, 11, 1, 26, 88, 28256 }, // ĭ
-    { 15, 30, 12, -1, 23, 113, 28344 }, // Į
-    { 10, 33, 11, 1, 26, 83, 28457 }, // į
-    { 15, 31, 12, -1, 31, 117, 28540 }, // İ
-    { 9, 19, 11, 1, 18, 43, 28657 }, // ı
-    { 27, 30, 24, -1, 23, 203, 28700 }, // Ĳ
-    { 20, 34, 20, 1, 26, 170, 28903 }, // ĳ
-    { 22, 39, 12, -6, 32, 215, 29073 }, // Ĵ
-    { 19, 35, 9, -6, 27, 167, 29288 }, // ĵ
-    { 25, 32, 23, -1, 23, 200, 29455 }, // Ķ
-    { 16, 35, 17, 1, 26, 140, 29655 }, // ķ
-    { 17, 19, 18, 1, 18, 81, 29795 }, // ĸ
-    { 19, 32, 19, -1, 32, 152, 29876 }, // Ĺ
-    { 12, 35, 10, 1, 34, 105, 30028 }, // ĺ
-    { 19, 32, 19, -1, 23, 152, 30133 }, // Ļ
-    { 11, 35, 10, -1, 26, 97, 30285 }, // ļ
-    { 20, 26, 19, -1, 26, 130, 30382 }, // Ľ
-    { 15, 30, 11, 1, 29, 113, 30512 }, // ľ
-    { 20, 23, 19, -1, 23, 115, 30625 }, // Ŀ
-    { 14, 27, 13, 1, 26, 95, 30740 }, // ŀ
-    { 19, 23, 19, -1, 23, 110, 30835 }, // Ł
-    { 13, 27, 10, -1, 26, 88, 30945 }, // ł
-    { 28, 33, 25, -1, 32, 231, 31033 }, // Ń
-    { 19, 28, 20, 1, 27, 133, 31264 }, // ń
-    { 28, 32, 25, -1, 23, 224, 31397 }, // Ņ
-    { 19, 27, 20, 1, 18, 129, 31621 }, // ņ
-    { 28, 33, 25, -1, 32, 231, 31750 }, // Ň
-    { 19, 28, 20, 1, 27, 133, 31981 }, // ň
-    { 25, 26, 27, 2, 25, 163, 32114 }, // ŉ
-    { 28, 30, 25, -1, 23, 210, 32277 }, // Ŋ
-    { 17, 26, 19, 1, 18, 111, 32487 }, // ŋ
-    { 23, 31, 24, 1, 30, 179, 32598 }, // Ō
-    { 17, 25, 18, 1, 24, 107, 32777 }, // ō
-    { 23, 33, 24, 1, 32, 190, 32884 }, // Ŏ
-    { 17, 27, 18, 1, 26, 115, 33074 }, // ŏ
-    { 24, 34, 24, 1, 33, 204, 33189 }, // Ő
-    { 19, 28, 18, 1, 27, 133, 33393 }, // ő
-    { 31, 24, 32, 1, 23, 186, 33526 }, // Œ
-    { 25, 19, 27, 1, 18, 119, 33712 }, // œ
-    { 22, 33, 21, -1, 32, 182, 33831 }, // Ŕ
-    { 14, 27, 14, 1, 27, 95, 34013 }, // ŕ
-    { 22, 33, 21, -1, 24, 182, 34108 }, // Ŗ
-    { 16, 27, 14, -1, 18, 108, 34290 }, // ŗ
-    { 22, 33, 21, -1, 32, 182, 34398 }, // Ř
-    { 16, 27, 14, 1, 27, 108, 34580 }, // ř
-    { 17, 33, 18, 0, 32, 141, 34688 }, // Ś
-    { 15, 28, 14, 0, 27, 105, 34829 }, // ś
-    { 17, 33, 18, 0, 32, 141, 34934 }, // Ŝ
-    { 15, 28, 14, 0, 27, 105, 35075 }, // ŝ
-    { 17, 33, 18, 0, 24, 141, 35180 }, // Ş
-    { 13, 27, 14, 0, 18, 88, 35321 }, // ş
-    { 18, 33, 18, 0, 32, 149, 35409 }, // Š
-    { 16, 28, 14, 0, 27, 112, 35558 }, // š
-    { 20, 32, 21, 2, 23, 160, 35670 }, // Ţ
-    { 13, 31, 13, 0, 22, 101, 35830 }, // ţ
-    { 20, 32, 21, 2, 32, 160, 35931 }, // Ť
-    { 14, 28, 13, 1, 27, 98, 36091 }, // ť
-    { 20, 23, 21, 2, 23, 115, 36189 }, // Ŧ
-    { 13, 23, 13, 0, 22, 75, 36304 }, // ŧ
-    { 24, 32, 25, 3, 31, 192, 36379 }, // Ũ
-    { 19, 27, 20, 1, 26, 129, 36571 }, // ũ
-    { 24, 31, 25, 3, 30, 186, 36700 }, // Ū
-    { 19, 25, 20, 1, 24, 119, 36886 }, // ū
-    { 24, 33, 25, 3, 32, 198, 37005 }, // Ŭ
-    { 19, 27, 20, 1, 26, 129, 37203 }, // ŭ
-    { 24, 34, 25, 3, 33, 204, 37332 }, // Ů
-    { 19, 29, 20, 1, 28, 138, 37536 }, // ů
-    { 24, 34, 25, 3, 33, 204, 37674 }, // Ű
-    { 19, 28, 20, 1, 27, 133, 37878 }, // ű
-    { 24, 30, 25, 3, 23, 180, 38011 }, // Ų
-    { 19, 25, 20, 1, 18, 119, 38191 }, // ų
-    { 34, 33, 34, 2, 32, 281, 38310 }, // Ŵ
-    { 25, 28, 26, 0, 27, 175, 38591 }, // ŵ
-    { 22, 32, 21, 2, 32, 176, 38766 }, // Ŷ
-    { 20, 35, 18, -3, 27, 175, 38942 }, // ŷ
-    { 22, 31, 21, 2, 31, 171, 39117 }, // Ÿ
-    { 20, 33, 19, -1, 32, 165, 39288 }, // Ź
-    { 16, 28, 16, 0, 27, 112, 39453 }, // ź
-    { 20, 32, 19, -1, 31, 160, 39565 }, // Ż
-    { 16, 26, 16, 0, 25, 104, 39725 }, // ż
-    { 20, 33, 19, -1, 32, 165, 39829 }, // Ž
-    { 16, 28, 16, 0, 27, 112, 39994 }, // ž
-    { 24, 34, 14, -6, 26, 204, 40106 }, // ſ
-    { 7, 8, 0, -5, 27, 14, 40310 }, // ̀
-    { 7, 8, 0, -2, 27, 14, 40324 }, // ́
-    { 11, 8, 0, -6, 27, 22, 40338 }, // ̂
-    { 12, 6, 0, -6, 26, 18, 40360 }, // ̃
-    { 10, 4, 0, -5, 24, 10, 40378 }, // ̄
-    { 11, 6, 0, -5, 26, 17, 40388 }, // ̆
-    { 6, 5, 0, -3, 25, 8, 40405 }, // ̇
-    { 12, 5, 0, -6, 25, 15, 40413 }, // ̈
-    { 9, 10, 0, -4, 29, 23, 40428 }, // ̉
-    { 8, 10, 0, -4, 28, 20, 40451 }, // ̊
-    { 13, 8, 0, -6, 27, 26, 40471 }, // ̋
-    { 11, 8, 0, -5, 27, 22, 40497 }, // ̌
-    { 10, 8, 0, -7, 27, 20, 40519 }, // ̏
-    { 11, 7, 0, -6, 26, 20, 40539 }, // ̑
-    { 6, 9, 0, -3, 28, 14, 40559 }, // ̒
-    { 7, 10, 0, -3, 29, 18, 40573 }, // ̓
-    { 6, 10, 0, -4, 29, 15, 40591 }, // ̔
-    { 5, 9, 0, -3, 29, 12, 40606 }, // ̕
-    { 6, 8, 0, -3, 21, 12, 40618 }, // ̛
-    { 6, 6, 0, -3, -2, 9, 40630 }, // ̣
-    { 12, 5, 0, -6, -3, 15, 40639 }, // ̤
-    { 8, 8, 0, -4, -1, 16, 40654 }, // ̥
-    { 7, 8, 0, -4, -1, 14, 40670 }, // ̦
-    { 8, 8, 0, -4, -1, 16, 40684 }, // ̧
-    { 7, 8, 0, -4, 1, 14, 40700 }, // ̨
-    { 5, 8, 9, -1, -1, 10, 40714 }, // ̩
-    { 11, 7, 0, -6, -2, 20, 40724 }, // ̭
-    { 11, 7, 0, -6, -1, 20, 40744 }, // ̮
-    { 12, 6, 0, -6, -2, 18, 40764 }, // ̰
-    { 10, 3, 0, -5, -3, 8, 40782 }, // ̱
-    { 11, 7, 0, -6, 26, 20, 40790 }, // ͂
-    { 12, 13, 0, -7, 33, 39, 40810 }, // ̈́
-    { 6, 6, 0, -2, -2, 9, 40849 }, // ͅ
-    { 21, 32, 20, -1, 32, 168, 40858 }, // Ѐ
-    { 21, 31, 20, -1, 31, 163, 41026 }, // Ё
-    { 21, 30, 25, 2, 23, 158, 41189 }, // Ђ
-    { 21, 32, 19, -1, 32, 168, 41347 }, // Ѓ
-    { 20, 25, 21, 1, 24, 125, 41515 }, // Є
-    { 17, 25, 18, 0, 24, 107, 41640 }, // Ѕ
-    { 15, 23, 12, -1, 23, 87, 41747 }, // І
-    { 17, 31, 12, -1, 31, 132, 41834 }, // Ї
-    { 20, 30, 12, -6, 23, 150, 41966 }, // Ј
-    { 31, 24, 29, -2, 23, 186, 42116 }, // Љ
-    { 31, 24, 31, -1, 23, 186, 42302 }, // Њ
-    { 22, 23, 26, 2, 23, 127, 42488 }, // Ћ
-    { 25, 33, 22, -1, 32, 207, 42615 }, // Ќ
-    { 29, 32, 26, -1, 32, 232, 42822 }, // Ѝ
-    { 23, 34, 21, 1, 33, 196, 43054 }, // Ў
-    { 27, 31, 25, -1, 23, 210, 43250 }, // Џ
-    { 25, 24, 24, -2, 24, 150, 43460 }, // А
-    { 21, 24, 20, -1, 23, 126, 43610 }, // Б
-    { 20, 25, 20, -1, 24, 125, 43736 }, // В
-    { 21, 23, 19, -1, 23, 121, 43861 }, // Г
-    { 27, 30, 24, -2, 23, 203, 43982 }, // Д
-    { 21, 23, 20, -1, 23, 121, 44185 }, // Е
-    { 36, 25, 31, -3, 24, 225, 44306 }, // Ж
-    { 17, 25, 18, 0, 24, 107, 44531 }, // З
-    { 29, 23, 26, -1, 23, 167, 44638 }, // И
-    { 29, 33, 26, -1, 33, 240, 44805 }, // Й
-    { 25, 25, 22, -1, 24, 157, 45045 }, // К
-    { 26, 24, 23, -2, 23, 156, 45202 }, // Л
-    { 32, 23, 30, -2, 23, 184, 45358 }, // М
-    { 29, 23, 26, -1, 23, 167, 45542 }, // Н
-    { 23, 25, 24, 1, 24, 144, 45709 }, // О
-    { 27, 23, 25, -1, 23, 156, 45853 }, // П
-    { 20, 24, 20, -1, 24, 120, 46009 }, // Р
-    { 20, 25, 21, 1, 24, 125, 46129 }, // С
-    { 20, 23, 21, 2, 23, 115, 46254 }, // Т
-    { 23, 24, 21, 1, 23, 138, 46369 }, // У
-    { 24, 25, 24, 0, 24, 150, 46507 }, // Ф
-    { 27, 23, 22, -3, 23, 156, 46657 }, // Х
-    { 27, 30, 25, -1, 23, 203, 46813 }, // Ц
-    { 22, 23, 22, 2, 23, 127, 47016 }, // Ч
-    { 35, 23, 33, -1, 23, 202, 47143 }, // Ш
-    { 35, 30, 33, -1, 23, 263, 47345 }, // Щ
-    { 20, 24, 23, 2, 23, 120, 47608 }, // Ъ
-    { 32, 24, 30, -1, 23, 192, 47728 }, // Ы
-    { 20, 24, 19, -1, 23, 120, 47920 }, // Ь
-    { 20, 25, 20, 0, 24, 125, 48040 }, // Э
-    { 33, 25, 33, -1, 24, 207, 48165 }, // Ю
-    { 24, 24, 21, -2, 23, 144, 48372 }, // Я
-    { 18, 19, 19, 1, 18, 86, 48516 }, // а
-    { 19, 28, 18, 1, 27, 133, 48602 }, // б
-    { 15, 19, 17, 1, 18, 72, 48735 }, // в
-    { 14, 19, 14, 0, 18, 67, 48807 }, // г
-    { 16, 27, 18, 1, 26, 108, 48874 }, // д
-    { 14, 19, 16, 1, 18, 67, 48982 }, // е
-    { 29, 19, 29, 0, 18, 138, 49049 }, // ж
-    { 14, 19, 15, 0, 18, 67, 49187 }, // з
-    { 19, 19, 20, 1, 18, 91, 49254 }, // и
-    { 19, 28, 20, 1, 27, 133, 49345 }, // й
-    { 17, 19, 18, 1, 18, 81, 49478 }, // к
-    { 20, 19, 20, -1, 18, 95, 49559 }, // л
-    { 25, 19, 25, 0, 18, 119, 49654 }, // м
-    { 19, 19, 20, 1, 18, 91, 49773 }, // н
-    { 16, 19, 18, 1, 18, 76, 49864 }, // о
-    { 19, 19, 20, 1, 18, 91, 49940 }, // п
-    { 20, 26, 19, -2, 18, 130, 50031 }, // р
-    { 13, 19, 15, 1, 18, 62, 50161 }, // с
-    { 28, 19, 29, 1, 18, 133, 50223 }, // т
-    { 20, 26, 18, -3, 18, 130, 50356 }, // у
-    { 21, 34, 23, 1, 26, 179, 50486 }, // ф
-    { 20, 19, 18, -1, 18, 95, 50665 }, // х
-    { 19, 25, 20, 1, 18, 119, 50760 }, // ц
-    { 18, 19, 19, 1, 18, 86, 50879 }, // ч
-    { 26, 19, 28, 1, 18, 124, 50965 }, // ш
-    { 26, 25, 28, 1, 18, 163, 51089 }, // щ
-    { 16, 19, 17, 1, 18, 76, 51252 }, // ъ
-    { 23, 19, 25, 1, 18, 110, 51328 }, // ы
-    { 15, 19, 16, 0, 18, 72, 51438 }, // ь
-    { 15, 19, 16, 0, 18, 72, 51510 }, // э
-    { 24, 19, 26, 1, 18, 114, 51582 }, // ю
-    { 18, 19, 18, -1, 18, 86, 51696 }, // я
-    { 14, 28, 16, 1, 27, 98, 51782 }, // ѐ
-    { 16, 26, 16, 1, 25, 104, 51880 }, // ё
-    { 16, 34, 19, 1, 26, 136, 51984 }, // ђ
-    { 14, 28, 14, 0, 27, 98, 52120 }, // ѓ
-    { 14, 19, 16, 1, 18, 67, 52218 }, // є
-    { 13, 19, 14, 0, 18, 62, 52285 }, // ѕ
-    { 10, 27, 11, 1, 26, 68, 52347 }, // і
-    { 13, 26, 11, 1, 25, 85, 52415 }, // ї
-    { 17, 34, 9, -6, 26, 145, 52500 }, // ј
-    { 25, 19, 24, -1, 18, 119, 52645 }, // љ
-    { 22, 19, 24, 1, 18, 105, 52764 }, // њ
-    { 18, 27, 20, 1, 26, 122, 52869 }, // ћ
-    { 17, 28, 18, 1, 27, 119, 52991 }, // ќ
-    { 19, 28, 20, 1, 27, 133, 53110 }, // ѝ
-    { 20, 35, 18, -3, 27, 175, 53243 }, // ў
-    { 19, 25, 20, 1, 18, 119, 53418 }, // џ
-    { 19, 27, 22, 2, 26, 129, 53537 }, // Ѣ
-    { 23, 19, 24, 1, 18, 110, 53666 }, // ѣ
-    { 23, 25, 24, 1, 24, 144, 53776 }, // Ѳ
-    { 16, 19, 18, 1, 18, 76, 53920 }, // ѳ
-    { 24, 25, 24, 2, 24, 150, 53996 }, // Ѵ
-    { 20, 19, 18, 0, 18, 95, 54146 }, // ѵ
-    { 29, 40, 26, -1, 33, 290, 54241 }, // Ҋ
-    { 19, 34, 20, 1, 27, 162, 54531 }, // ҋ
-    { 20, 24, 19, -1, 23, 120, 54693 }, // Ҍ
-    { 14, 25, 16, 1, 24, 88, 54813 }, // ҍ
-    { 20, 24, 20, -1, 24, 120, 54901 }, // Ҏ
-    { 20, 26, 19, -2, 18, 130, 55021 }, // ҏ
-    { 22, 28, 18, -1, 28, 154, 55151 }, // Ґ
-    { 16, 23, 15, 0, 22, 92, 55305 }, // ґ
-    { 21, 23, 19, -1, 23, 121, 55397 }, // Ғ
-    { 14, 19, 14, 0, 18, 67, 55518 }, // ғ
-    { 21, 30, 20, -1, 23, 158, 55585 }, // Ҕ
-    { 16, 25, 18, 1, 17, 100, 55743 }, // ҕ
-    { 36, 31, 31, -3, 24, 279, 55843 }, // Җ
-    { 29, 25, 29, 0, 18, 182, 56122 }, // җ
-    { 17, 31, 18, 0, 24, 132, 56304 }, // Ҙ
-    { 14, 25, 15, 0, 18, 88, 56436 }, // ҙ
-    { 25, 31, 22, -1, 24, 194, 56524 }, // Қ
-    { 17, 25, 18, 1, 18, 107, 56718 }, // қ
-    { 26, 25, 24, -1, 24, 163, 56825 }, // Ҝ
-    { 19, 19, 20, 1, 18, 91, 56988 }, // ҝ
-    { 25, 25, 22, -1, 24, 157, 57079 }, // Ҟ
-    { 17, 25, 18, 1, 24, 107, 57236 }, // ҟ
-    { 26, 25, 26, 2, 24, 163, 57343 }, // Ҡ
-    { 19, 19, 20, 1, 18, 91, 57506 }, // ҡ
-    { 29, 30, 26, -1, 23, 218, 57597 }, // Ң
-    { 19, 25, 21, 1, 18, 119, 57815 }, // ң
-    { 33, 23, 30, -1, 23, 190, 57934 }, // Ҥ
-    { 23, 19, 24, 1, 18, 110, 58124 }, // ҥ
-    { 34, 30, 34, -1, 23, 255, 58234 }, // Ҧ
-    { 26, 26, 28, 1, 18, 169, 58489 }, // ҧ
-    { 25, 25, 26, 1, 24, 157, 58658 }, // Ҩ
-    { 19, 19, 21, 1, 18, 91, 58815 }, // ҩ
-    { 20, 31, 21, 1, 24, 155, 58906 }, // Ҫ
-    { 13, 25, 15, 1, 18, 82, 59061 }, // ҫ
-    { 20, 30, 21, 2, 23, 150, 59143 }, // Ҭ
-    { 28, 25, 30, 1, 18, 175, 59293 }, // ҭ
-    { 22, 23, 21, 2, 23, 127, 59468 }, // Ү
-    { 17, 26, 17, 0, 18, 111, 59595 }, // ү
-    { 22, 23, 21, 2, 23, 127, 59706 }, // Ұ
-    { 17, 26, 17, 0, 18, 111, 59833 }, // ұ
-    { 27, 30, 22, -3, 23, 203, 59944 }, // Ҳ
-    { 20, 25, 18, -1, 18, 125, 60147 }, // ҳ
-    { 28, 30, 28, 1, 23, 210, 60272 }, // Ҵ
-    { 19, 31, 20, 1, 24, 148, 60482 }, // ҵ
-    { 22, 30, 22, 2, 23, 165, 60630 }, // Ҷ
-    { 18, 25, 20, 1, 18, 113, 60795 }, // ҷ
-    { 22, 23, 22, 2, 23, 127, 60908 }, // Ҹ
-    { 18, 19, 19, 1, 18, 86, 61035 }, // ҹ
-    { 21, 23, 22, -1, 23, 121, 61121 }, // Һ
-    { 18, 27, 20, 1, 26, 122, 61242 }, // һ
-    { 24, 25, 26, 1, 24, 150, 61364 }, // Ҽ
-    { 19, 19, 19, 0, 18, 91, 61514 }, // ҽ
-    { 24, 32, 26, 1, 24, 192, 61605 }, // Ҿ
-    { 19, 25, 19, 0, 18, 119, 61797 }, // ҿ
-    { 15, 23, 12, -1, 23, 87, 61916 }, // Ӏ
-    { 36, 34, 31, -3, 33, 306, 62003 }, // Ӂ
-    { 29, 28, 29, 0, 27, 203, 62309 }, // ӂ
-    { 25, 31, 22, -1, 24, 194, 62512 }, // Ӄ
-    { 17, 26, 18, 1, 18, 111, 62706 }, // ӄ
-    { 26, 30, 23, -2, 23, 195, 62817 }, // Ӆ
-    { 20, 25, 20, -1, 18, 125, 63012 }, // ӆ
-    { 29, 30, 26, -1, 23, 218, 63137 }, // Ӈ
-    { 17, 26, 19, 1, 18, 111, 63355 }, // ӈ
-    { 29, 30, 26, -1, 23, 218, 63466 }, // Ӊ
-    { 19, 25, 21, 1, 18, 119, 63684 }, // ӊ
-    { 22, 30, 22, 2, 23, 165, 63803 }, // Ӌ
-    { 17, 25, 18, 1, 18, 107, 63968 }, // ӌ
-    { 32, 30, 30, -2, 23, 240, 64075 }, // Ӎ
-    { 25, 25, 25, 0, 18, 157, 64315 }, // ӎ
-    { 14, 26, 10, -1, 26, 91, 64472 }, // ӏ
-    { 25, 33, 24, -2, 33, 207, 64563 }, // Ӑ
-    { 18, 28, 19, 1, 27, 126, 64770 }, // ӑ
-    { 25, 31, 24, -2, 31, 194, 64896 }, // Ӓ
-    { 18, 26, 19, 1, 25, 117, 65090 }, // ӓ
-    { 33, 23, 30, -3, 23, 190, 65207 }, // Ӕ
-    { 24, 19, 25, 1, 18, 114, 65397 }, // ӕ
-    { 21, 33, 20, -1, 33, 174, 65511 }, // Ӗ
-    { 16, 28, 16, 1, 27, 112, 65685 }, // ӗ
-    { 20, 25, 21, 0, 24, 125, 65797 }, // Ә
-    { 15, 19, 16, 0, 18, 72, 65922 }, // ә
-    { 20, 32, 21, 0, 31, 160, 65994 }, // Ӛ
-    { 16, 26, 16, 0, 25, 104, 66154 }, // ӛ
-    { 36, 32, 31, -3, 31, 288, 66258 }, // Ӝ
-    { 29, 26, 29, 0, 25, 189, 66546 }, // ӝ
-    { 17, 32, 18, 0, 31, 136, 66735 }, // Ӟ
-    { 15, 26, 15, 0, 25, 98, 66871 }, // ӟ
-    { 20, 24, 19, -1, 23, 120, 66969 }, // Ӡ
-    { 19, 25, 17, -2, 17, 119, 67089 }, // ӡ
-    { 29, 30, 26, -1, 30, 218, 67208 }, // Ӣ
-    { 19, 25, 20, 1, 24, 119, 67426 }, // ӣ
-    { 29, 31, 26, -1, 31, 225, 67545 }, // Ӥ
-    { 19, 26, 20, 1, 25, 124, 67770 }, // ӥ
-    { 23, 32, 24, 1, 31, 184, 67894 }, // Ӧ
-    { 17, 26, 18, 1, 25, 111, 68078 }, // ӧ
-    { 23, 25, 24, 1, 24, 144, 68189 }, // Ө
-    { 16, 19, 18, 1, 18, 76, 68333 }, // ө
-    { 23, 32, 24, 1, 31, 184, 68409 }, // Ӫ
-    { 17, 26, 18, 1, 25, 111, 68593 }, // ӫ
-    { 20, 32, 20, 0, 31, 160, 68704 }, // Ӭ
-    { 15, 26, 16, 0, 25, 98, 68864 }, // ӭ
-    { 23, 31, 21, 1, 30, 179, 68962 }, // Ӯ
-    { 20, 32, 18, -3, 24, 160, 69141 }, // ӯ
-    { 23, 32, 21, 1, 31, 184, 69301 }, // Ӱ
-    { 20, 33, 18, -3, 25, 165, 69485 }, // ӱ
-    { 23, 34, 21, 1, 33, 196, 69650 }, // Ӳ
-    { 20, 35, 18, -3, 27, 175, 69846 }, // ӳ
-    { 22, 31, 22, 2, 31, 171, 70021 }, // Ӵ
-    { 18, 26, 19, 1, 25, 117, 70192 }, // ӵ
-    { 21, 30, 19, -1, 23, 158, 70309 }, // Ӷ
-    { 14, 25, 14, 0, 18, 88, 70467 }, // ӷ
-    { 32, 32, 30, -1, 31, 256, 70555 }, // Ӹ
-    { 23, 26, 25, 1, 25, 150, 70811 }, // ӹ
-    { 21, 30, 19, -1, 23, 158, 70961 }, // Ӻ
-    { 14, 25, 14, 0, 18, 88, 71119 }, // ӻ
-    { 27, 30, 22, -3, 23, 203, 71207 }, // Ӽ
-    { 20, 26, 18, -1, 18, 130, 71410 }, // ӽ
-    { 27, 23, 22, -3, 23, 156, 71540 }, // Ӿ
-    { 20, 19, 18, -1, 18, 95, 71696 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 71791 }, //  
-    { 0, 0, 33, 0, 0, 0, 71791 }, //  
-    { 0, 0, 17, 0, 0, 0, 71791 }, //  
-    { 0, 0, 33, 0, 0, 0, 71791 }, //  
-    { 0, 0, 11, 0, 0, 0, 71791 }, //  
-    { 0, 0, 8, 0, 0, 0, 71791 }, //  
-    { 0, 0, 5, 0, 0, 0, 71791 }, //  
-    { 0, 0, 21, 0, 0, 0, 71791 }, //  
-    { 0, 0, 9, 0, 0, 0, 71791 }, //  
-    { 0, 0, 7, 0, 0, 0, 71791 }, //  
-    { 0, 0, 2, 0, 0, 0, 71791 }, //  
-    { 0, 0, 0, 0, 0, 0, 71791 }, // ​
-    { 2, 28, 0, -1, 20, 14, 71791 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 71805 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 71865 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 71958 }, // ‏
-    { 11, 3, 12, 1, 10, 9, 72051 }, // ‐
-    { 11, 3, 12, 1, 10, 9, 72060 }, // ‑
-    { 16, 3, 21, 2, 13, 12, 72069 }, // ‒
-    { 17, 3, 17, 0, 10, 13, 72081 }, // –
-    { 33, 3, 33, 0, 10, 25, 72094 }, // —
-    { 33, 3, 33, 0, 10, 25, 72119 }, // ―
-    { 11, 34, 17, 3, 26, 94, 72144 }, // ‖
-    { 17, 8, 17, 0, -1, 34, 72238 }, // ‗
-    { 7, 11, 10, 3, 25, 20, 72272 }, // ‘
-    { 7, 11, 10, 2, 25, 20, 72292 }, // ’
-    { 7, 10, 10, 1, 4, 18, 72312 }, // ‚
-    { 6, 11, 8, 1, 25, 17, 72330 }, // ‛
-    { 13, 11, 17, 3, 25, 36, 72347 }, // “
-    { 14, 11, 17, 2, 25, 39, 72383 }, // ”
-    { 14, 10, 17, 1, 4, 35, 72422 }, // „
-    { 13, 11, 14, 1, 25, 36, 72457 }, // ‟
-    { 15, 22, 15, 1, 24, 83, 72493 }, // †
-    { 16, 26, 15, 0, 24, 104, 72576 }, // ‡
-    { 8, 7, 10, 1, 12, 14, 72680 }, // •
-    { 12, 12, 21, 4, 17, 36, 72694 }, // ‣
-    { 5, 5, 9, 2, 4, 7, 72730 }, // ․
-    { 14, 6, 17, 1, 5, 21, 72737 }, // ‥
-    { 27, 6, 33, 3, 5, 41, 72758 }, // …
-    { 5, 6, 9, 2, 12, 8, 72799 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 72807 }, //  
-    { 0, 0, 0, 0, 0, 0, 72807 }, //  
-    { 12, 31, 0, -6, 23, 93, 72807 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 72900 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 72993 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 73071 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 73180 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 73289 }, //  
-    { 41, 26, 45, 2, 24, 267, 73289 }, // ‰
-    { 7, 11, 9, 1, 23, 20, 73556 }, // ′
-    { 13, 11, 15, 1, 23, 36, 73576 }, // ″
-    { 20, 11, 22, 1, 23, 55, 73612 }, // ‴
-    { 7, 11, 9, 1, 23, 20, 73667 }, // ‵
-    { 14, 11, 16, 1, 23, 39, 73687 }, // ‶
-    { 21, 11, 23, 1, 23, 58, 73726 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 73784 }, // ‸
-    { 9, 13, 10, 1, 15, 30, 73809 }, // ‹
-    { 10, 13, 10, 0, 15, 33, 73839 }, // ›
-    { 21, 23, 21, 0, 22, 121, 73872 }, // ※
-    { 19, 26, 19, 1, 25, 124, 73993 }, // ‼
-    { 17, 3, 17, 0, 27, 13, 74117 }, // ‾
-    { 8, 3, 10, 1, 10, 6, 74130 }, // ⁃
-    { 20, 26, 8, -6, 24, 130, 74136 }, // ⁄
-    { 25, 25, 27, 2, 24, 157, 74266 }, // ⁇
-    { 22, 26, 23, 2, 25, 143, 74423 }, // ⁈
-    { 23, 26, 24, 1, 25, 150, 74566 }, // ⁉
-    { 19, 6, 33, 7, 13, 29, 74716 }, // ⁓
-    { 26, 11, 28, 1, 23, 72, 74745 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 74817 }, //  
-    { 0, 0, 0, 0, 0, 0, 74817 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 74817 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 74817 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 74817 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 74817 }, // ⁤
-    { 13, 17, 15, 1, 28, 56, 74817 }, // ⁰
-    { 14, 16, 15, 0, 28, 56, 74873 }, // ⁴
-    { 13, 16, 15, 1, 27, 52, 74929 }, // ⁵
-    { 13, 17, 15, 2, 28, 56, 74981 }, // ⁶
-    { 12, 16, 15, 3, 27, 48, 75037 }, // ⁷
-    { 13, 17, 15, 1, 28, 56, 75085 }, // ⁸
-    { 13, 17, 15, 0, 28, 56, 75141 }, // ⁹
-    { 13, 12, 19, 3, 23, 39, 75197 }, // ⁿ
-    { 13, 16, 15, 1, 11, 52, 75236 }, // ₀
-    { 10, 16, 15, 2, 11, 40, 75288 }, // ₁
-    { 13, 16, 15, 1, 11, 52, 75328 }, // ₂
-    { 12, 16, 15, 1, 11, 48, 75380 }, // ₃
-    { 14, 16, 15, 0, 11, 56, 75428 }, // ₄
-    { 13, 16, 15, 1, 11, 52, 75484 }, // ₅
-    { 13, 16, 15, 2, 11, 52, 75536 }, // ₆
-    { 12, 16, 15, 3, 11, 48, 75588 }, // ₇
-    { 13, 16, 15, 1, 11, 52, 75636 }, // ₈
-    { 13, 16, 15, 0, 11, 52, 75688 }, // ₉
-    { 21, 23, 21, 0, 23, 121, 75740 }, // ₣
-    { 21, 24, 21, -1, 23, 126, 75861 }, // ₤
-    { 40, 24, 41, 0, 23, 240, 75987 }, // ₧
-    { 23, 24, 21, -1, 23, 138, 76227 }, // €
-    { 19, 13, 33, 7, 18, 62, 76365 }, // ←
-    { 13, 21, 33, 10, 22, 69, 76427 }, // ↑
-    { 19, 13, 33, 7, 18, 62, 76496 }, // →
-    { 13, 21, 33, 10, 22, 69, 76558 }, // ↓
-    { 21, 13, 33, 6, 18, 69, 76627 }, // ↔
-    { 13, 23, 33, 10, 23, 75, 76696 }, // ↕
-    { 15, 22, 33, 9, 22, 83, 76771 }, // ↨
-    { 13, 21, 33, 10, 22, 69, 76854 }, // ↲
-    { 13, 21, 33, 10, 22, 69, 76923 }, // ↳
-    { 19, 15, 33, 7, 19, 72, 76992 }, // ↵
-    { 19, 15, 33, 7, 19, 72, 77064 }, // ⇐
-    { 15, 19, 33, 9, 21, 72, 77136 }, // ⇑
-    { 19, 15, 33, 7, 19, 72, 77208 }, // ⇒
-    { 15, 19, 33, 9, 21, 72, 77280 }, // ⇓
-    { 21, 15, 33, 6, 19, 79, 77352 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 77431 }, // ∀
-    { 17, 27, 21, 2, 26, 115, 77569 }, // ∂
-    { 15, 23, 33, 9, 23, 87, 77684 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 77771 }, // ∅
-    { 20, 24, 22, 1, 24, 120, 77940 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 78060 }, // ∇
-    { 21, 23, 33, 6, 23, 121, 78186 }, // ∈
-    { 21, 29, 33, 6, 26, 153, 78307 }, // ∉
-    { 21, 19, 33, 6, 21, 100, 78460 }, // ∊
-    { 21, 23, 33, 6, 23, 121, 78560 }, // ∋
-    { 21, 29, 33, 6, 26, 153, 78681 }, // ∌
-    { 21, 19, 33, 6, 21, 100, 78834 }, // ∍
-    { 25, 29, 27, 1, 23, 182, 78934 }, // ∏
-    { 20, 29, 20, 0, 23, 145, 79116 }, // ∑
-    { 15, 3, 21, 3, 13, 12, 79261 }, // −
-    { 19, 26, 16, -1, 24, 124, 79273 }, // ∕
-    { 13, 26, 16, 2, 24, 85, 79397 }, // ∖
-    { 15, 16, 21, 3, 19, 60, 79482 }, // ∗
-    { 12, 12, 21, 4, 17, 36, 79542 }, // ∘
-    { 6, 6, 21, 7, 12, 9, 79578 }, // ∙
-    { 21, 31, 21, 0, 27, 163, 79587 }, // √
-    { 16, 13, 21, 2, 17, 52, 79750 }, // ∝
-    { 21, 11, 21, 0, 16, 58, 79802 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 79860 }, // ∟
-    { 23, 23, 33, 4, 23, 133, 79981 }, // ∠
-    { 4, 34, 17, 6, 26, 34, 80114 }, // ∣
-    { 10, 34, 17, 3, 26, 85, 80148 }, // ∥
-    { 21, 23, 33, 6, 23, 121, 80233 }, // ∧
-    { 21, 23, 33, 6, 23, 121, 80354 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 80475 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 80589 }, // ∪
-    { 18, 34, 21, 1, 26, 153, 80703 }, // ∫
-    { 21, 19, 33, 6, 18, 100, 80856 }, // ∴
-    { 21, 19, 33, 6, 18, 100, 80956 }, // ∵
-    { 7, 18, 10, 1, 20, 32, 81056 }, // ∶
-    { 21, 19, 33, 6, 18, 100, 81088 }, // ∷
-    { 19, 6, 33, 7, 13, 29, 81188 }, // ∼
-    { 19, 18, 33, 7, 20, 86, 81217 }, // ≅
-    { 16, 12, 21, 2, 17, 48, 81303 }, // ≈
-    { 19, 11, 33, 7, 15, 53, 81351 }, // ≍
-    { 15, 15, 21, 3, 19, 57, 81404 }, // ≠
-    { 19, 15, 33, 7, 17, 72, 81461 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 81533 }, // ≤
-    { 15, 20, 21, 3, 20, 75, 81608 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 81683 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 81791 }, // ≫
-    { 21, 19, 33, 6, 21, 100, 81899 }, // ⊃
-    { 21, 29, 33, 6, 26, 153, 81999 }, // ⊄
-    { 21, 29, 33, 6, 26, 153, 82152 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 82305 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 82426 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 82547 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 82704 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 82861 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 83018 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 83175 }, // ⊥
-    { 6, 6, 21, 7, 12, 9, 83285 }, // ⋅
-    { 27, 6, 33, 3, 12, 41, 83294 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 83335 }, // �
+    { 17, 24, 21, 4, 23, 102, 2048 }, // 7
+    { 18, 24, 21, 1, 23, 108, 2150 }, // 8
+    { 19, 24, 21, 0, 23, 114, 2258 }, // 9
+    { 8, 18, 10, 2, 17, 36, 2372 }, // :
+    { 11, 23, 10, -1, 17, 64, 2408 }, // ;
+    { 15, 16, 21, 3, 19, 60, 2472 }, // <
+    { 15, 9, 21, 3, 16, 34, 2532 }, // =
+    { 15, 16, 21, 3, 19, 60, 2566 }, // >
+    { 12, 25, 14, 2, 24, 75, 2626 }, // ?
+    { 30, 30, 32, 1, 23, 225, 2701 }, // @
+    { 25, 24, 24, -2, 24, 150, 2926 }, // A
+    { 20, 25, 20, -1, 24, 125, 3076 }, // B
+    { 20, 25, 21, 1, 24, 125, 3201 }, // C
+    { 24, 25, 24, -1, 24, 150, 3326 }, // D
+    { 21, 23, 20, -1, 23, 121, 3476 }, // E
+    { 20, 23, 18, -1, 23, 115, 3597 }, // F
+    { 21, 25, 23, 1, 24, 132, 3712 }, // G
+    { 29, 23, 26, -1, 23, 167, 3844 }, // H
+    { 15, 23, 12, -1, 23, 87, 4096 }, // I
+    { 20, 30, 12, -6, 23, 150, 4183 }, // J
+    { 25, 24, 23, -1, 23, 150, 4333 }, // K
+    { 19, 23, 19, -1, 23, 110, 4483 }, // L
+    { 32, 23, 30, -2, 23, 184, 4593 }, // M
+    { 28, 24, 25, -1, 23, 168, 4777 }, // N
+    { 23, 25, 24, 1, 24, 144, 4945 }, // O
+    { 20, 24, 20, -1, 24, 120, 5089 }, // P
+    { 28, 32, 24, 1, 24, 224, 5209 }, // Q
+    { 22, 25, 21, -1, 24, 138, 5433 }, // R
+    { 17, 25, 18, 0, 24, 107, 5571 }, // S
+    { 20, 23, 21, 2, 23, 115, 5678 }, // T
+    { 24, 24, 25, 3, 23, 144, 5793 }, // U
+    { 24, 24, 23, 2, 23, 144, 5937 }, // V
+    { 34, 24, 34, 2, 23, 204, 6144 }, // W
+    { 27, 23, 22, -3, 23, 156, 6348 }, // X
+    { 22, 23, 21, 2, 23, 127, 6504 }, // Y
+    { 20, 24, 19, -1, 23, 120, 6631 }, // Z
+    { 14, 32, 10, -2, 26, 112, 6751 }, // [
+    { 13, 26, 16, 2, 24, 85, 6863 }, // <backslash>
+    { 14, 32, 10, -2, 26, 112, 6948 }, // ]
+    { 16, 15, 21, 2, 21, 60, 7060 }, // ^
+    { 17, 3, 17, 0, -1, 13, 7120 }, // _
+    { 7, 8, 20, 7, 27, 14, 7133 }, // `
+    { 18, 19, 19, 1, 18, 86, 7147 }, // a
+    { 17, 27, 18, 0, 26, 115, 7233 }, // b
+    { 13, 19, 15, 1, 18, 62, 7348 }, // c
+    { 18, 27, 19, 1, 26, 122, 7410 }, // d
+    { 14, 19, 16, 1, 18, 67, 7532 }, // e
+    { 24, 34, 14, -6, 26, 204, 7599 }, // f
+    { 22, 26, 16, -3, 18, 143, 7803 }, // g
+    { 18, 27, 20, 1, 26, 122, 7946 }, // h
+    { 10, 27, 11, 1, 26, 68, 8068 }, // i
+    { 17, 34, 9, -6, 26, 145, 8192 }, // j
+    { 16, 27, 17, 1, 26, 108, 8337 }, // k
+    { 9, 27, 10, 1, 26, 61, 8445 }, // l
+    { 28, 19, 29, 1, 18, 133, 8506 }, // m
+    { 19, 19, 20, 1, 18, 91, 8639 }, // n
+    { 16, 19, 18, 1, 18, 76, 8730 }, // o
+    { 20, 26, 19, -2, 18, 130, 8806 }, // p
+    { 17, 26, 18, 1, 18, 111, 8936 }, // q
+    { 14, 18, 14, 1, 18, 63, 9047 }, // r
+    { 13, 19, 14, 0, 18, 62, 9110 }, // s
+    { 12, 23, 13, 1, 22, 69, 9172 }, // t
+    { 19, 19, 20, 1, 18, 91, 9241 }, // u
+    { 17, 19, 17, 0, 18, 81, 9332 }, // v
+    { 25, 19, 26, 0, 18, 119, 9413 }, // w
+    { 20, 19, 18, -1, 18, 95, 9532 }, // x
+    { 20, 26, 18, -3, 18, 130, 9627 }, // y
+    { 16, 19, 16, 0, 18, 76, 9757 }, // z
+    { 13, 33, 13, 1, 27, 108, 9833 }, // {
+    { 10, 30, 10, 0, 26, 75, 9941 }, // |
+    { 13, 33, 13, -1, 27, 108, 10016 }, // }
+    { 16, 6, 21, 2, 14, 24, 10124 }, // ~
+    { 0, 0, 7, 0, 0, 0, 10148 }, //  
+    { 10, 26, 10, -1, 18, 65, 10148 }, // ¡
+    { 17, 33, 21, 2, 26, 141, 10240 }, // ¢
+    { 21, 24, 21, -1, 23, 126, 10381 }, // £
+    { 21, 16, 21, 0, 19, 84, 10507 }, // ¤
+    { 22, 23, 21, 1, 23, 127, 10591 }, // ¥
+    { 10, 30, 10, 0, 26, 75, 10718 }, // ¦
+    { 15, 26, 16, 0, 23, 98, 10793 }, // §
+    { 12, 5, 20, 4, 25, 15, 10891 }, // ¨
+    { 25, 25, 26, 0, 24, 157, 10906 }, // ©
+    { 13, 16, 14, 1, 24, 52, 11063 }, // ª
+    { 16, 13, 17, 1, 15, 52, 11115 }, // «
+    { 15, 8, 21, 3, 15, 30, 11167 }, // ¬
+    { 11, 3, 12, 1, 10, 9, 11197 }, // ­
+    { 19, 18, 19, 0, 26, 86, 11206 }, // ®
+    { 11, 4, 20, 5, 24, 11, 11292 }, // ¯
+    { 12, 11, 17, 3, 23, 33, 11303 }, // °
+    { 15, 20, 21, 3, 20, 75, 11336 }, // ±
+    { 13, 16, 15, 1, 28, 52, 11411 }, // ²
+    { 12, 17, 15, 1, 28, 51, 11463 }, // ³
+    { 7, 8, 20, 7, 27, 14, 11514 }, // ´
+    { 21, 26, 20, -1, 18, 137, 11528 }, // µ
+    { 21, 28, 19, -1, 23, 147, 11665 }, // ¶
+    { 6, 6, 10, 2, 12, 9, 11812 }, // ·
+    { 8, 8, 20, 6, -1, 16, 11821 }, // ¸
+    { 10, 16, 15, 2, 28, 40, 11837 }, // ¹
+    { 13, 16, 15, 1, 24, 52, 11877 }, // º
+    { 16, 13, 17, 0, 15, 52, 11929 }, // »
+    { 32, 26, 36, 2, 24, 208, 11981 }, // ¼
+    { 32, 26, 36, 2, 24, 208, 12288 }, // ½
+    { 33, 26, 36, 1, 24, 215, 12496 }, // ¾
+    { 11, 25, 14, 0, 18, 69, 12711 }, // ¿
+    { 25, 32, 24, -2, 32, 200, 12780 }, // À
+    { 25, 32, 24, -2, 32, 200, 12980 }, // Á
+    { 25, 32, 24, -2, 32, 200, 13180 }, // Â
+    { 25, 31, 24, -2, 31, 194, 13380 }, // Ã
+    { 25, 31, 24, -2, 31, 194, 13574 }, // Ä
+    { 25, 33, 24, -2, 33, 207, 13768 }, // Å
+    { 33, 23, 30, -3, 23, 190, 13975 }, // Æ
+    { 20, 33, 21, 1, 24, 165, 14165 }, // Ç
+    { 21, 32, 20, -1, 32, 168, 14336 }, // È
+    { 21, 32, 20, -1, 32, 168, 14504 }, // É
+    { 21, 32, 20, -1, 32, 168, 14672 }, // Ê
+    { 21, 31, 20, -1, 31, 163, 14840 }, // Ë
+    { 15, 32, 12, -1, 32, 120, 15003 }, // Ì
+    { 16, 32, 12, -1, 32, 128, 15123 }, // Í
+    { 16, 32, 12, -1, 32, 128, 15251 }, // Î
+    { 17, 31, 12, -1, 31, 132, 15379 }, // Ï
+    { 24, 25, 24, -1, 24, 150, 15511 }, // Ð
+    { 28, 32, 25, -1, 31, 224, 15661 }, // Ñ
+    { 23, 33, 24, 1, 32, 190, 15885 }, // Ò
+    { 23, 33, 24, 1, 32, 190, 16075 }, // Ó
+    { 23, 33, 24, 1, 32, 190, 16384 }, // Ô
+    { 23, 32, 24, 1, 31, 184, 16574 }, // Õ
+    { 23, 32, 24, 1, 31, 184, 16758 }, // Ö
+    { 14, 14, 21, 3, 18, 49, 16942 }, // ×
+    { 26, 25, 24, -1, 24, 163, 16991 }, // Ø
+    { 24, 33, 25, 3, 32, 198, 17154 }, // Ù
+    { 24, 33, 25, 3, 32, 198, 17352 }, // Ú
+    { 24, 33, 25, 3, 32, 198, 17550 }, // Û
+    { 24, 32, 25, 3, 31, 192, 17748 }, // Ü
+    { 22, 32, 21, 2, 32, 176, 17940 }, // Ý
+    { 20, 23, 20, -1, 23, 115, 18116 }, // Þ
+    { 25, 34, 21, -5, 26, 213, 18432 }, // ß
+    { 18, 28, 19, 1, 27, 126, 18645 }, // à
+    { 18, 28, 19, 1, 27, 126, 18771 }, // á
+    { 18, 28, 19, 1, 27, 126, 18897 }, // â
+    { 18, 27, 19, 1, 26, 122, 19023 }, // ã
+    { 18, 26, 19, 1, 25, 117, 19145 }, // ä
+    { 18, 29, 19, 1, 28, 131, 19262 }, // å
+    { 24, 19, 25, 1, 18, 114, 19393 }, // æ
+    { 13, 27, 15, 1, 18, 88, 19507 }, // ç
+    { 14, 28, 16, 1, 27, 98, 19595 }, // è
+    { 15, 28, 16, 1, 27, 105, 19693 }, // é
+    { 15, 28, 16, 1, 27, 105, 19798 }, // ê
+    { 16, 26, 16, 1, 25, 104, 19903 }, // ë
+    { 9, 28, 11, 1, 27, 63, 20007 }, // ì
+    { 12, 28, 11, 1, 27, 84, 20070 }, // í
+    { 12, 28, 11, 1, 27, 84, 20154 }, // î
+    { 13, 26, 11, 1, 25, 85, 20238 }, // ï
+    { 16, 28, 18, 1, 27, 112, 20323 }, // ð
+    { 19, 27, 20, 1, 26, 129, 20480 }, // ñ
+    { 16, 28, 18, 1, 27, 112, 20609 }, // ò
+    { 16, 28, 18, 1, 27, 112, 20721 }, // ó
+    { 16, 28, 18, 1, 27, 112, 20833 }, // ô
+    { 17, 27, 18, 1, 26, 115, 20945 }, // õ
+    { 17, 26, 18, 1, 25, 111, 21060 }, // ö
+    { 15, 16, 21, 3, 19, 60, 21171 }, // ÷
+    { 21, 19, 18, -2, 18, 100, 21231 }, // ø
+    { 19, 28, 20, 1, 27, 133, 21331 }, // ù
+    { 19, 28, 20, 1, 27, 133, 21464 }, // ú
+    { 19, 28, 20, 1, 27, 133, 21597 }, // û
+    { 19, 26, 20, 1, 25, 124, 21730 }, // ü
+    { 20, 35, 18, -3, 27, 175, 21854 }, // ý
+    { 20, 34, 18, -3, 26, 170, 22029 }, // þ
+    { 20, 33, 18, -3, 25, 165, 22199 }, // ÿ
+    { 25, 30, 24, -2, 30, 188, 22528 }, // Ā
+    { 18, 25, 19, 1, 24, 113, 22716 }, // ā
+    { 25, 32, 24, -2, 32, 200, 22829 }, // Ă
+    { 18, 27, 19, 1, 26, 122, 23029 }, // ă
+    { 25, 31, 24, -2, 24, 194, 23151 }, // Ą
+    { 18, 25, 19, 1, 18, 113, 23345 }, // ą
+    { 20, 33, 21, 1, 32, 165, 23458 }, // Ć
+    { 15, 28, 15, 1, 27, 105, 23623 }, // ć
+    { 20, 33, 21, 1, 32, 165, 23728 }, // Ĉ
+    { 15, 28, 15, 1, 27, 105, 23893 }, // ĉ
+    { 20, 32, 21, 1, 31, 160, 23998 }, // Ċ
+    { 13, 26, 15, 1, 25, 85, 24158 }, // ċ
+    { 21, 33, 21, 1, 32, 174, 24243 }, // Č
+    { 16, 28, 15, 1, 27, 112, 24417 }, // č
+    { 24, 33, 24, -1, 32, 198, 24576 }, // Ď
+    { 24, 30, 20, 1, 29, 180, 24774 }, // ď
+    { 24, 25, 24, -1, 24, 150, 24954 }, // Đ
+    { 20, 27, 19, 1, 26, 135, 25104 }, // đ
+    { 21, 30, 20, -1, 30, 158, 25239 }, // Ē
+    { 15, 25, 16, 1, 24, 94, 25397 }, // ē
+    { 21, 32, 20, -1, 32, 168, 25491 }, // Ĕ
+    { 16, 27, 16, 1, 26, 108, 25659 }, // ĕ
+    { 21, 31, 20, -1, 31, 163, 25767 }, // Ė
+    { 14, 26, 16, 1, 25, 91, 25930 }, // ė
+    { 21, 30, 20, -1, 23, 158, 26021 }, // Ę
+    { 14, 25, 16, 1, 18, 88, 26179 }, // ę
+    { 22, 32, 20, -1, 32, 176, 26267 }, // Ě
+    { 16, 28, 16, 1, 27, 112, 26443 }, // ě
+    { 21, 33, 23, 2, 32, 174, 26624 }, // Ĝ
+    { 22, 35, 16, -3, 27, 193, 26798 }, // ĝ
+    { 21, 33, 23, 2, 32, 174, 26991 }, // Ğ
+    { 22, 34, 16, -3, 26, 187, 27165 }, // ğ
+    { 21, 32, 23, 2, 31, 168, 27352 }, // Ġ
+    { 22, 33, 16, -3, 25, 182, 27520 }, // ġ
+    { 21, 33, 23, 2, 24, 174, 27702 }, // Ģ
+    { 22, 36, 16, -3, 28, 198, 27876 }, // ģ
+    { 29, 32, 26, -1, 32, 232, 28074 }, // Ĥ
+    { 18, 35, 20, 1, 34, 158, 28306 }, // ĥ
+    { 29, 23, 26, -1, 23, 167, 28464 }, // Ħ
+    { 18, 27, 20, 1, 26, 122, 28672 }, // ħ
+    { 16, 31, 12, -1, 31, 124, 28794 }, // Ĩ
+    { 13, 27, 11, 1, 26, 88, 28918 }, // ĩ
+    { 16, 30, 12, -1, 30, 120, 29006 }, // Ī
+    { 13, 25, 11, 1, 24, 82, 29126 }, // ī
+    { 16, 32, 12, -1, 32, 128, 29208 }, // Ĭ
+    { 13, 27, 11, 1, 26, 88, 29336 }, // ĭ
+    { 15, 30, 12, -1, 23, 113, 29424 }, // Į
+    { 10, 33, 11, 1, 26, 83, 29537 }, // į
+    { 15, 31, 12, -1, 31, 117, 29620 }, // İ
+    { 9, 19, 11, 1, 18, 43, 29737 }, // ı
+    { 27, 30, 24, -1, 23, 203, 29780 }, // Ĳ
+    { 20, 34, 20, 1, 26, 170, 29983 }, // ĳ
+    { 22, 39, 12, -6, 32, 215, 30153 }, // Ĵ
+    { 19, 35, 9, -6, 27, 167, 30368 }, // ĵ
+    { 25, 32, 23, -1, 23, 200, 30720 }, // Ķ
+    { 16, 35, 17, 1, 26, 140, 30920 }, // ķ
+    { 17, 19, 18, 1, 18, 81, 31060 }, // ĸ
+    { 19, 32, 19, -1, 32, 152, 31141 }, // Ĺ
+    { 12, 35, 10, 1, 34, 105, 31293 }, // ĺ
+    { 19, 32, 19, -1, 23, 152, 31398 }, // Ļ
+    { 11, 35, 10, -1, 26, 97, 31550 }, // ļ
+    { 20, 26, 19, -1, 26, 130, 31647 }, // Ľ
+    { 15, 30, 11, 1, 29, 113, 31777 }, // ľ
+    { 20, 23, 19, -1, 23, 115, 31890 }, // Ŀ
+    { 14, 27, 13, 1, 26, 95, 32005 }, // ŀ
+    { 19, 23, 19, -1, 23, 110, 32100 }, // Ł
+    { 13, 27, 10, -1, 26, 88, 32210 }, // ł
+    { 28, 33, 25, -1, 32, 231, 32298 }, // Ń
+    { 19, 28, 20, 1, 27, 133, 32529 }, // ń
+    { 28, 32, 25, -1, 23, 224, 32768 }, // Ņ
+    { 19, 27, 20, 1, 18, 129, 32992 }, // ņ
+    { 28, 33, 25, -1, 32, 231, 33121 }, // Ň
+    { 19, 28, 20, 1, 27, 133, 33352 }, // ň
+    { 25, 26, 27, 2, 25, 163, 33485 }, // ŉ
+    { 28, 30, 25, -1, 23, 210, 33648 }, // Ŋ
+    { 17, 26, 19, 1, 18, 111, 33858 }, // ŋ
+    { 23, 31, 24, 1, 30, 179, 33969 }, // Ō
+    { 17, 25, 18, 1, 24, 107, 34148 }, // ō
+    { 23, 33, 24, 1, 32, 190, 34255 }, // Ŏ
+    { 17, 27, 18, 1, 26, 115, 34445 }, // ŏ
+    { 24, 34, 24, 1, 33, 204, 34560 }, // Ő
+    { 19, 28, 18, 1, 27, 133, 34816 }, // ő
+    { 31, 24, 32, 1, 23, 186, 34949 }, // Œ
+    { 25, 19, 27, 1, 18, 119, 35135 }, // œ
+    { 22, 33, 21, -1, 32, 182, 35254 }, // Ŕ
+    { 14, 27, 14, 1, 27, 95, 35436 }, // ŕ
+    { 22, 33, 21, -1, 24, 182, 35531 }, // Ŗ
+    { 16, 27, 14, -1, 18, 108, 35713 }, // ŗ
+    { 22, 33, 21, -1, 32, 182, 35821 }, // Ř
+    { 16, 27, 14, 1, 27, 108, 36003 }, // ř
+    { 17, 33, 18, 0, 32, 141, 36111 }, // Ś
+    { 15, 28, 14, 0, 27, 105, 36252 }, // ś
+    { 17, 33, 18, 0, 32, 141, 36357 }, // Ŝ
+    { 15, 28, 14, 0, 27, 105, 36498 }, // ŝ
+    { 17, 33, 18, 0, 24, 141, 36603 }, // Ş
+    { 13, 27, 14, 0, 18, 88, 36744 }, // ş
+    { 18, 33, 18, 0, 32, 149, 36864 }, // Š
+    { 16, 28, 14, 0, 27, 112, 37013 }, // š
+    { 20, 32, 21, 2, 23, 160, 37125 }, // Ţ
+    { 13, 31, 13, 0, 22, 101, 37285 }, // ţ
+    { 20, 32, 21, 2, 32, 160, 37386 }, // Ť
+    { 14, 28, 13, 1, 27, 98, 37546 }, // ť
+    { 20, 23, 21, 2, 23, 115, 37644 }, // Ŧ
+    { 13, 23, 13, 0, 22, 75, 37759 }, // ŧ
+    { 24, 32, 25, 3, 31, 192, 37834 }, // Ũ
+    { 19, 27, 20, 1, 26, 129, 38026 }, // ũ
+    { 24, 31, 25, 3, 30, 186, 38155 }, // Ū
+    { 19, 25, 20, 1, 24, 119, 38341 }, // ū
+    { 24, 33, 25, 3, 32, 198, 38460 }, // Ŭ
+    { 19, 27, 20, 1, 26, 129, 38658 }, // ŭ
+    { 24, 34, 25, 3, 33, 204, 38912 }, // Ů
+    { 19, 29, 20, 1, 28, 138, 39116 }, // ů
+    { 24, 34, 25, 3, 33, 204, 39254 }, // Ű
+    { 19, 28, 20, 1, 27, 133, 39458 }, // ű
+    { 24, 30, 25, 3, 23, 180, 39591 }, // Ų
+    { 19, 25, 20, 1, 18, 119, 39771 }, // ų
+    { 34, 33, 34, 2, 32, 281, 39890 }, // Ŵ
+    { 25, 28, 26, 0, 27, 175, 40171 }, // ŵ
+    { 22, 32, 21, 2, 32, 176, 40346 }, // Ŷ
+    { 20, 35, 18, -3, 27, 175, 40522 }, // ŷ
+    { 22, 31, 21, 2, 31, 171, 40697 }, // Ÿ
+    { 20, 33, 19, -1, 32, 165, 40960 }, // Ź
+    { 16, 28, 16, 0, 27, 112, 41125 }, // ź
+    { 20, 32, 19, -1, 31, 160, 41237 }, // Ż
+    { 16, 26, 16, 0, 25, 104, 41397 }, // ż
+    { 20, 33, 19, -1, 32, 165, 41501 }, // Ž
+    { 16, 28, 16, 0, 27, 112, 41666 }, // ž
+    { 24, 34, 14, -6, 26, 204, 41778 }, // ſ
+    { 7, 8, 0, -5, 27, 14, 41982 }, // ̀
+    { 7, 8, 0, -2, 27, 14, 41996 }, // ́
+    { 11, 8, 0, -6, 27, 22, 42010 }, // ̂
+    { 12, 6, 0, -6, 26, 18, 42032 }, // ̃
+    { 10, 4, 0, -5, 24, 10, 42050 }, // ̄
+    { 11, 6, 0, -5, 26, 17, 42060 }, // ̆
+    { 6, 5, 0, -3, 25, 8, 42077 }, // ̇
+    { 12, 5, 0, -6, 25, 15, 42085 }, // ̈
+    { 9, 10, 0, -4, 29, 23, 42100 }, // ̉
+    { 8, 10, 0, -4, 28, 20, 42123 }, // ̊
+    { 13, 8, 0, -6, 27, 26, 42143 }, // ̋
+    { 11, 8, 0, -5, 27, 22, 42169 }, // ̌
+    { 10, 8, 0, -7, 27, 20, 42191 }, // ̏
+    { 11, 7, 0, -6, 26, 20, 42211 }, // ̑
+    { 6, 9, 0, -3, 28, 14, 42231 }, // ̒
+    { 7, 10, 0, -3, 29, 18, 42245 }, // ̓
+    { 6, 10, 0, -4, 29, 15, 42263 }, // ̔
+    { 5, 9, 0, -3, 29, 12, 42278 }, // ̕
+    { 6, 8, 0, -3, 21, 12, 42290 }, // ̛
+    { 6, 6, 0, -3, -2, 9, 42302 }, // ̣
+    { 12, 5, 0, -6, -3, 15, 42311 }, // ̤
+    { 8, 8, 0, -4, -1, 16, 42326 }, // ̥
+    { 7, 8, 0, -4, -1, 14, 42342 }, // ̦
+    { 8, 8, 0, -4, -1, 16, 42356 }, // ̧
+    { 7, 8, 0, -4, 1, 14, 42372 }, // ̨
+    { 5, 8, 9, -1, -1, 10, 42386 }, // ̩
+    { 11, 7, 0, -6, -2, 20, 42396 }, // ̭
+    { 11, 7, 0, -6, -1, 20, 42416 }, // ̮
+    { 12, 6, 0, -6, -2, 18, 42436 }, // ̰
+    { 10, 3, 0, -5, -3, 8, 42454 }, // ̱
+    { 11, 7, 0, -6, 26, 20, 42462 }, // ͂
+    { 12, 13, 0, -7, 33, 39, 42482 }, // ̈́
+    { 6, 6, 0, -2, -2, 9, 42521 }, // ͅ
+    { 21, 32, 20, -1, 32, 168, 42530 }, // Ѐ
+    { 21, 31, 20, -1, 31, 163, 42698 }, // Ё
+    { 21, 30, 25, 2, 23, 158, 43008 }, // Ђ
+    { 21, 32, 19, -1, 32, 168, 43166 }, // Ѓ
+    { 20, 25, 21, 1, 24, 125, 43334 }, // Є
+    { 17, 25, 18, 0, 24, 107, 43459 }, // Ѕ
+    { 15, 23, 12, -1, 23, 87, 43566 }, // І
+    { 17, 31, 12, -1, 31, 132, 43653 }, // Ї
+    { 20, 30, 12, -6, 23, 150, 43785 }, // Ј
+    { 31, 24, 29, -2, 23, 186, 43935 }, // Љ
+    { 31, 24, 31, -1, 23, 186, 44121 }, // Њ
+    { 22, 23, 26, 2, 23, 127, 44307 }, // Ћ
+    { 25, 33, 22, -1, 32, 207, 44434 }, // Ќ
+    { 29, 32, 26, -1, 32, 232, 44641 }, // Ѝ
+    { 23, 34, 21, 1, 33, 196, 45056 }, // Ў
+    { 27, 31, 25, -1, 23, 210, 45252 }, // Џ
+    { 25, 24, 24, -2, 24, 150, 45462 }, // А
+    { 21, 24, 20, -1, 23, 126, 45612 }, // Б
+    { 20, 25, 20, -1, 24, 125, 45738 }, // В
+    { 21, 23, 19, -1, 23, 121, 45863 }, // Г
+    { 27, 30, 24, -2, 23, 203, 45984 }, // Д
+    { 21, 23, 20, -1, 23, 121, 46187 }, // Е
+    { 36, 25, 31, -3, 24, 225, 46308 }, // Ж
+    { 17, 25, 18, 0, 24, 107, 46533 }, // З
+    { 29, 23, 26, -1, 23, 167, 46640 }, // И
+    { 29, 33, 26, -1, 33, 240, 46807 }, // Й
+    { 25, 25, 22, -1, 24, 157, 47104 }, // К
+    { 26, 24, 23, -2, 23, 156, 47261 }, // Л
+    { 32, 23, 30, -2, 23, 184, 47417 }, // М
+    { 29, 23, 26, -1, 23, 167, 47601 }, // Н
+    { 23, 25, 24, 1, 24, 144, 47768 }, // О
+    { 27, 23, 25, -1, 23, 156, 47912 }, // П
+    { 20, 24, 20, -1, 24, 120, 48068 }, // Р
+    { 20, 25, 21, 1, 24, 125, 48188 }, // С
+    { 20, 23, 21, 2, 23, 115, 48313 }, // Т
+    { 23, 24, 21, 1, 23, 138, 48428 }, // У
+    { 24, 25, 24, 0, 24, 150, 48566 }, // Ф
+    { 27, 23, 22, -3, 23, 156, 48716 }, // Х
+    { 27, 30, 25, -1, 23, 203, 48872 }, // Ц
+    { 22, 23, 22, 2, 23, 127, 49152 }, // Ч
+    { 35, 23, 33, -1, 23, 202, 49279 }, // Ш
+    { 35, 30, 33, -1, 23, 263, 49481 }, // Щ
+    { 20, 24, 23, 2, 23, 120, 49744 }, // Ъ
+    { 32, 24, 30, -1, 23, 192, 49864 }, // Ы
+    { 20, 24, 19, -1, 23, 120, 50056 }, // Ь
+    { 20, 25, 20, 0, 24, 125, 50176 }, // Э
+    { 33, 25, 33, -1, 24, 207, 50301 }, // Ю
+    { 24, 24, 21, -2, 23, 144, 50508 }, // Я
+    { 18, 19, 19, 1, 18, 86, 50652 }, // а
+    { 19, 28, 18, 1, 27, 133, 50738 }, // б
+    { 15, 19, 17, 1, 18, 72, 50871 }, // в
+    { 14, 19, 14, 0, 18, 67, 50943 }, // г
+    { 16, 27, 18, 1, 26, 108, 51010 }, // д
+    { 14, 19, 16, 1, 18, 67, 51118 }, // е
+    { 29, 19, 29, 0, 18, 138, 51200 }, // ж
+    { 14, 19, 15, 0, 18, 67, 51338 }, // з
+    { 19, 19, 20, 1, 18, 91, 51405 }, // и
+    { 19, 28, 20, 1, 27, 133, 51496 }, // й
+    { 17, 19, 18, 1, 18, 81, 51629 }, // к
+    { 20, 19, 20, -1, 18, 95, 51710 }, // л
+    { 25, 19, 25, 0, 18, 119, 51805 }, // м
+    { 19, 19, 20, 1, 18, 91, 51924 }, // н
+    { 16, 19, 18, 1, 18, 76, 52015 }, // о
+    { 19, 19, 20, 1, 18, 91, 52091 }, // п
+    { 20, 26, 19, -2, 18, 130, 52182 }, // р
+    { 13, 19, 15, 1, 18, 62, 52312 }, // с
+    { 28, 19, 29, 1, 18, 133, 52374 }, // т
+    { 20, 26, 18, -3, 18, 130, 52507 }, // у
+    { 21, 34, 23, 1, 26, 179, 52637 }, // ф
+    { 20, 19, 18, -1, 18, 95, 52816 }, // х
+    { 19, 25, 20, 1, 18, 119, 52911 }, // ц
+    { 18, 19, 19, 1, 18, 86, 53030 }, // ч
+    { 26, 19, 28, 1, 18, 124, 53116 }, // ш
+    { 26, 25, 28, 1, 18, 163, 53248 }, // щ
+    { 16, 19, 17, 1, 18, 76, 53411 }, // ъ
+    { 23, 19, 25, 1, 18, 110, 53487 }, // ы
+    { 15, 19, 16, 0, 18, 72, 53597 }, // ь
+    { 15, 19, 16, 0, 18, 72, 53669 }, // э
+    { 24, 19, 26, 1, 18, 114, 53741 }, // ю
+    { 18, 19, 18, -1, 18, 86, 53855 }, // я
+    { 14, 28, 16, 1, 27, 98, 53941 }, // ѐ
+    { 16, 26, 16, 1, 25, 104, 54039 }, // ё
+    { 16, 34, 19, 1, 26, 136, 54143 }, // ђ
+    { 14, 28, 14, 0, 27, 98, 54279 }, // ѓ
+    { 14, 19, 16, 1, 18, 67, 54377 }, // є
+    { 13, 19, 14, 0, 18, 62, 54444 }, // ѕ
+    { 10, 27, 11, 1, 26, 68, 54506 }, // і
+    { 13, 26, 11, 1, 25, 85, 54574 }, // ї
+    { 17, 34, 9, -6, 26, 145, 54659 }, // ј
+    { 25, 19, 24, -1, 18, 119, 54804 }, // љ
+    { 22, 19, 24, 1, 18, 105, 54923 }, // њ
+    { 18, 27, 20, 1, 26, 122, 55028 }, // ћ
+    { 17, 28, 18, 1, 27, 119, 55150 }, // ќ
+    { 19, 28, 20, 1, 27, 133, 55296 }, // ѝ
+    { 20, 35, 18, -3, 27, 175, 55429 }, // ў
+    { 19, 25, 20, 1, 18, 119, 55604 }, // џ
+    { 19, 27, 22, 2, 26, 129, 55723 }, // Ѣ
+    { 23, 19, 24, 1, 18, 110, 55852 }, // ѣ
+    { 23, 25, 24, 1, 24, 144, 55962 }, // Ѳ
+    { 16, 19, 18, 1, 18, 76, 56106 }, // ѳ
+    { 24, 25, 24, 2, 24, 150, 56182 }, // Ѵ
+    { 20, 19, 18, 0, 18, 95, 56332 }, // ѵ
+    { 29, 40, 26, -1, 33, 290, 56427 }, // Ҋ
+    { 19, 34, 20, 1, 27, 162, 56717 }, // ҋ
+    { 20, 24, 19, -1, 23, 120, 56879 }, // Ҍ
+    { 14, 25, 16, 1, 24, 88, 56999 }, // ҍ
+    { 20, 24, 20, -1, 24, 120, 57087 }, // Ҏ
+    { 20, 26, 19, -2, 18, 130, 57207 }, // ҏ
+    { 22, 28, 18, -1, 28, 154, 57344 }, // Ґ
+    { 16, 23, 15, 0, 22, 92, 57498 }, // ґ
+    { 21, 23, 19, -1, 23, 121, 57590 }, // Ғ
+    { 14, 19, 14, 0, 18, 67, 57711 }, // ғ
+    { 21, 30, 20, -1, 23, 158, 57778 }, // Ҕ
+    { 16, 25, 18, 1, 17, 100, 57936 }, // ҕ
+    { 36, 31, 31, -3, 24, 279, 58036 }, // Җ
+    { 29, 25, 29, 0, 18, 182, 58315 }, // җ
+    { 17, 31, 18, 0, 24, 132, 58497 }, // Ҙ
+    { 14, 25, 15, 0, 18, 88, 58629 }, // ҙ
+    { 25, 31, 22, -1, 24, 194, 58717 }, // Қ
+    { 17, 25, 18, 1, 18, 107, 58911 }, // қ
+    { 26, 25, 24, -1, 24, 163, 59018 }, // Ҝ
+    { 19, 19, 20, 1, 18, 91, 59181 }, // ҝ
+    { 25, 25, 22, -1, 24, 157, 59392 }, // Ҟ
+    { 17, 25, 18, 1, 24, 107, 59549 }, // ҟ
+    { 26, 25, 26, 2, 24, 163, 59656 }, // Ҡ
+    { 19, 19, 20, 1, 18, 91, 59819 }, // ҡ
+    { 29, 30, 26, -1, 23, 218, 59910 }, // Ң
+    { 19, 25, 21, 1, 18, 119, 60128 }, // ң
+    { 33, 23, 30, -1, 23, 190, 60247 }, // Ҥ
+    { 23, 19, 24, 1, 18, 110, 60437 }, // ҥ
+    { 34, 30, 34, -1, 23, 255, 60547 }, // Ҧ
+    { 26, 26, 28, 1, 18, 169, 60802 }, // ҧ
+    { 25, 25, 26, 1, 24, 157, 60971 }, // Ҩ
+    { 19, 19, 21, 1, 18, 91, 61128 }, // ҩ
+    { 20, 31, 21, 1, 24, 155, 61219 }, // Ҫ
+    { 13, 25, 15, 1, 18, 82, 61440 }, // ҫ
+    { 20, 30, 21, 2, 23, 150, 61522 }, // Ҭ
+    { 28, 25, 30, 1, 18, 175, 61672 }, // ҭ
+    { 22, 23, 21, 2, 23, 127, 61847 }, // Ү
+    { 17, 26, 17, 0, 18, 111, 61974 }, // ү
+    { 22, 23, 21, 2, 23, 127, 62085 }, // Ұ
+    { 17, 26, 17, 0, 18, 111, 62212 }, // ұ
+    { 27, 30, 22, -3, 23, 203, 62323 }, // Ҳ
+    { 20, 25, 18, -1, 18, 125, 62526 }, // ҳ
+    { 28, 30, 28, 1, 23, 210, 62651 }, // Ҵ
+    { 19, 31, 20, 1, 24, 148, 62861 }, // ҵ
+    { 22, 30, 22, 2, 23, 165, 63009 }, // Ҷ
+    { 18, 25, 20, 1, 18, 113, 63174 }, // ҷ
+    { 22, 23, 22, 2, 23, 127, 63287 }, // Ҹ
+    { 18, 19, 19, 1, 18, 86, 63488 }, // ҹ
+    { 21, 23, 22, -1, 23, 121, 63574 }, // Һ
+    { 18, 27, 20, 1, 26, 122, 63695 }, // һ
+    { 24, 25, 26, 1, 24, 150, 63817 }, // Ҽ
+    { 19, 19, 19, 0, 18, 91, 63967 }, // ҽ
+    { 24, 32, 26, 1, 24, 192, 64058 }, // Ҿ
+    { 19, 25, 19, 0, 18, 119, 64250 }, // ҿ
+    { 15, 23, 12, -1, 23, 87, 64369 }, // Ӏ
+    { 36, 34, 31, -3, 33, 306, 64456 }, // Ӂ
+    { 29, 28, 29, 0, 27, 203, 64762 }, // ӂ
+    { 25, 31, 22, -1, 24, 194, 64965 }, // Ӄ
+    { 17, 26, 18, 1, 18, 111, 65159 }, // ӄ
+    { 26, 30, 23, -2, 23, 195, 65270 }, // Ӆ
+    { 20, 25, 20, -1, 18, 125, 65536 }, // ӆ
+    { 29, 30, 26, -1, 23, 218, 65661 }, // Ӈ
+    { 17, 26, 19, 1, 18, 111, 65879 }, // ӈ
+    { 29, 30, 26, -1, 23, 218, 65990 }, // Ӊ
+    { 19, 25, 21, 1, 18, 119, 66208 }, // ӊ
+    { 22, 30, 22, 2, 23, 165, 66327 }, // Ӌ
+    { 17, 25, 18, 1, 18, 107, 66492 }, // ӌ
+    { 32, 30, 30, -2, 23, 240, 66599 }, // Ӎ
+    { 25, 25, 25, 0, 18, 157, 66839 }, // ӎ
+    { 14, 26, 10, -1, 26, 91, 66996 }, // ӏ
+    { 25, 33, 24, -2, 33, 207, 67087 }, // Ӑ
+    { 18, 28, 19, 1, 27, 126, 67294 }, // ӑ
+    { 25, 31, 24, -2, 31, 194, 67584 }, // Ӓ
+    { 18, 26, 19, 1, 25, 117, 67778 }, // ӓ
+    { 33, 23, 30, -3, 23, 190, 67895 }, // Ӕ
+    { 24, 19, 25, 1, 18, 114, 68085 }, // ӕ
+    { 21, 33, 20, -1, 33, 174, 68199 }, // Ӗ
+    { 16, 28, 16, 1, 27, 112, 68373 }, // ӗ
+    { 20, 25, 21, 0, 24, 125, 68485 }, // Ә
+    { 15, 19, 16, 0, 18, 72, 68610 }, // ә
+    { 20, 32, 21, 0, 31, 160, 68682 }, // Ӛ
+    { 16, 26, 16, 0, 25, 104, 68842 }, // ӛ
+    { 36, 32, 31, -3, 31, 288, 68946 }, // Ӝ
+    { 29, 26, 29, 0, 25, 189, 69234 }, // ӝ
+    { 17, 32, 18, 0, 31, 136, 69423 }, // Ӟ
+    { 15, 26, 15, 0, 25, 98, 69632 }, // ӟ
+    { 20, 24, 19, -1, 23, 120, 69730 }, // Ӡ
+    { 19, 25, 17, -2, 17, 119, 69850 }, // ӡ
+    { 29, 30, 26, -1, 30, 218, 69969 }, // Ӣ
+    { 19, 25, 20, 1, 24, 119, 70187 }, // ӣ
+    { 29, 31, 26, -1, 31, 225, 70306 }, // Ӥ
+    { 19, 26, 20, 1, 25, 124, 70531 }, // ӥ
+    { 23, 32, 24, 1, 31, 184, 70655 }, // Ӧ
+    { 17, 26, 18, 1, 25, 111, 70839 }, // ӧ
+    { 23, 25, 24, 1, 24, 144, 70950 }, // Ө
+    { 16, 19, 18, 1, 18, 76, 71094 }, // ө
+    { 23, 32, 24, 1, 31, 184, 71170 }, // Ӫ
+    { 17, 26, 18, 1, 25, 111, 71354 }, // ӫ
+    { 20, 32, 20, 0, 31, 160, 71465 }, // Ӭ
+    { 15, 26, 16, 0, 25, 98, 71680 }, // ӭ
+    { 23, 31, 21, 1, 30, 179, 71778 }, // Ӯ
+    { 20, 32, 18, -3, 24, 160, 71957 }, // ӯ
+    { 23, 32, 21, 1, 31, 184, 72117 }, // Ӱ
+    { 20, 33, 18, -3, 25, 165, 72301 }, // ӱ
+    { 23, 34, 21, 1, 33, 196, 72466 }, // Ӳ
+    { 20, 35, 18, -3, 27, 175, 72662 }, // ӳ
+    { 22, 31, 22, 2, 31, 171, 72837 }, // Ӵ
+    { 18, 26, 19, 1, 25, 117, 73008 }, // ӵ
+    { 21, 30, 19, -1, 23, 158, 73125 }, // Ӷ
+    { 14, 25, 14, 0, 18, 88, 73283 }, // ӷ
+    { 32, 32, 30, -1, 31, 256, 73371 }, // Ӹ
+    { 23, 26, 25, 1, 25, 150, 73728 }, // ӹ
+    { 21, 30, 19, -1, 23, 158, 73878 }, // Ӻ
+    { 14, 25, 14, 0, 18, 88, 74036 }, // ӻ
+    { 27, 30, 22, -3, 23, 203, 74124 }, // Ӽ
+    { 20, 26, 18, -1, 18, 130, 74327 }, // ӽ
+    { 27, 23, 22, -3, 23, 156, 74457 }, // Ӿ
+    { 20, 19, 18, -1, 18, 95, 74613 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 74708 }, //  
+    { 0, 0, 33, 0, 0, 0, 74708 }, //  
+    { 0, 0, 17, 0, 0, 0, 74708 }, //  
+    { 0, 0, 33, 0, 0, 0, 74708 }, //  
+    { 0, 0, 11, 0, 0, 0, 74708 }, //  
+    { 0, 0, 8, 0, 0, 0, 74708 }, //  
+    { 0, 0, 5, 0, 0, 0, 74708 }, //  
+    { 0, 0, 21, 0, 0, 0, 74708 }, //  
+    { 0, 0, 9, 0, 0, 0, 74708 }, //  
+    { 0, 0, 7, 0, 0, 0, 74708 }, //  
+    { 0, 0, 2, 0, 0, 0, 74708 }, //  
+    { 0, 0, 0, 0, 0, 0, 74708 }, // ​
+    { 2, 28, 0, -1, 20, 14, 74708 }, // ‌
+    { 8, 30, 0, -4, 22, 60, 74722 }, // ‍
+    { 12, 31, 0, -6, 23, 93, 74782 }, // ‎
+    { 12, 31, 0, -6, 23, 93, 74875 }, // ‏
+    { 11, 3, 12, 1, 10, 9, 74968 }, // ‐
+    { 11, 3, 12, 1, 10, 9, 74977 }, // ‑
+    { 16, 3, 21, 2, 13, 12, 74986 }, // ‒
+    { 17, 3, 17, 0, 10, 13, 74998 }, // –
+    { 33, 3, 33, 0, 10, 25, 75011 }, // —
+    { 33, 3, 33, 0, 10, 25, 75036 }, // ―
+    { 11, 34, 17, 3, 26, 94, 75061 }, // ‖
+    { 17, 8, 17, 0, -1, 34, 75155 }, // ‗
+    { 7, 11, 10, 3, 25, 20, 75189 }, // ‘
+    { 7, 11, 10, 2, 25, 20, 75209 }, // ’
+    { 7, 10, 10, 1, 4, 18, 75229 }, // ‚
+    { 6, 11, 8, 1, 25, 17, 75247 }, // ‛
+    { 13, 11, 17, 3, 25, 36, 75264 }, // “
+    { 14, 11, 17, 2, 25, 39, 75300 }, // ”
+    { 14, 10, 17, 1, 4, 35, 75339 }, // „
+    { 13, 11, 14, 1, 25, 36, 75374 }, // ‟
+    { 15, 22, 15, 1, 24, 83, 75410 }, // †
+    { 16, 26, 15, 0, 24, 104, 75493 }, // ‡
+    { 8, 7, 10, 1, 12, 14, 75597 }, // •
+    { 12, 12, 21, 4, 17, 36, 75611 }, // ‣
+    { 5, 5, 9, 2, 4, 7, 75647 }, // ․
+    { 14, 6, 17, 1, 5, 21, 75654 }, // ‥
+    { 27, 6, 33, 3, 5, 41, 75675 }, // …
+    { 5, 6, 9, 2, 12, 8, 75716 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 75724 }, //  
+    { 0, 0, 0, 0, 0, 0, 75724 }, //  
+    { 12, 31, 0, -6, 23, 93, 75776 }, // ‪
+    { 12, 31, 0, -6, 23, 93, 75869 }, // ‫
+    { 10, 31, 0, -5, 23, 78, 75962 }, // ‬
+    { 14, 31, 0, -7, 23, 109, 76040 }, // ‭
+    { 14, 31, 0, -7, 23, 109, 76149 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 76258 }, //  
+    { 41, 26, 45, 2, 24, 267, 76258 }, // ‰
+    { 7, 11, 9, 1, 23, 20, 76525 }, // ′
+    { 13, 11, 15, 1, 23, 36, 76545 }, // ″
+    { 20, 11, 22, 1, 23, 55, 76581 }, // ‴
+    { 7, 11, 9, 1, 23, 20, 76636 }, // ‵
+    { 14, 11, 16, 1, 23, 39, 76656 }, // ‶
+    { 21, 11, 23, 1, 23, 58, 76695 }, // ‷
+    { 14, 7, 16, 1, 0, 25, 76753 }, // ‸
+    { 9, 13, 10, 1, 15, 30, 76778 }, // ‹
+    { 10, 13, 10, 0, 15, 33, 76808 }, // ›
+    { 21, 23, 21, 0, 22, 121, 76841 }, // ※
+    { 19, 26, 19, 1, 25, 124, 76962 }, // ‼
+    { 17, 3, 17, 0, 27, 13, 77086 }, // ‾
+    { 8, 3, 10, 1, 10, 6, 77099 }, // ⁃
+    { 20, 26, 8, -6, 24, 130, 77105 }, // ⁄
+    { 25, 25, 27, 2, 24, 157, 77235 }, // ⁇
+    { 22, 26, 23, 2, 25, 143, 77392 }, // ⁈
+    { 23, 26, 24, 1, 25, 150, 77535 }, // ⁉
+    { 19, 6, 33, 7, 13, 29, 77685 }, // ⁓
+    { 26, 11, 28, 1, 23, 72, 77714 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 77786 }, //  
+    { 0, 0, 0, 0, 0, 0, 77786 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 77786 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 77786 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 77786 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 77786 }, // ⁤
+    { 13, 17, 15, 1, 28, 56, 77824 }, // ⁰
+    { 14, 16, 15, 0, 28, 56, 77880 }, // ⁴
+    { 13, 16, 15, 1, 27, 52, 77936 }, // ⁵
+    { 13, 17, 15, 2, 28, 56, 77988 }, // ⁶
+    { 12, 16, 15, 3, 27, 48, 78044 }, // ⁷
+    { 13, 17, 15, 1, 28, 56, 78092 }, // ⁸
+    { 13, 17, 15, 0, 28, 56, 78148 }, // ⁹
+    { 13, 12, 19, 3, 23, 39, 78204 }, // ⁿ
+    { 13, 16, 15, 1, 11, 52, 78243 }, // ₀
+    { 10, 16, 15, 2, 11, 40, 78295 }, // ₁
+    { 13, 16, 15, 1, 11, 52, 78335 }, // ₂
+    { 12, 16, 15, 1, 11, 48, 78387 }, // ₃
+    { 14, 16, 15, 0, 11, 56, 78435 }, // ₄
+    { 13, 16, 15, 1, 11, 52, 78491 }, // ₅
+    { 13, 16, 15, 2, 11, 52, 78543 }, // ₆
+    { 12, 16, 15, 3, 11, 48, 78595 }, // ₇
+    { 13, 16, 15, 1, 11, 52, 78643 }, // ₈
+    { 13, 16, 15, 0, 11, 52, 78695 }, // ₉
+    { 21, 23, 21, 0, 23, 121, 78747 }, // ₣
+    { 21, 24, 21, -1, 23, 126, 78868 }, // ₤
+    { 40, 24, 41, 0, 23, 240, 78994 }, // ₧
+    { 23, 24, 21, -1, 23, 138, 79234 }, // €
+    { 19, 13, 33, 7, 18, 62, 79372 }, // ←
+    { 13, 21, 33, 10, 22, 69, 79434 }, // ↑
+    { 19, 13, 33, 7, 18, 62, 79503 }, // →
+    { 13, 21, 33, 10, 22, 69, 79565 }, // ↓
+    { 21, 13, 33, 6, 18, 69, 79634 }, // ↔
+    { 13, 23, 33, 10, 23, 75, 79703 }, // ↕
+    { 15, 22, 33, 9, 22, 83, 79778 }, // ↨
+    { 13, 21, 33, 10, 22, 69, 79872 }, // ↲
+    { 13, 21, 33, 10, 22, 69, 79941 }, // ↳
+    { 19, 15, 33, 7, 19, 72, 80010 }, // ↵
+    { 19, 15, 33, 7, 19, 72, 80082 }, // ⇐
+    { 15, 19, 33, 9, 21, 72, 80154 }, // ⇑
+    { 19, 15, 33, 7, 19, 72, 80226 }, // ⇒
+    { 15, 19, 33, 9, 21, 72, 80298 }, // ⇓
+    { 21, 15, 33, 6, 19, 79, 80370 }, // ⇔
+    { 23, 24, 33, 5, 23, 138, 80449 }, // ∀
+    { 17, 27, 21, 2, 26, 115, 80587 }, // ∂
+    { 15, 23, 33, 9, 23, 87, 80702 }, // ∃
+    { 25, 27, 33, 4, 25, 169, 80789 }, // ∅
+    { 20, 24, 22, 1, 24, 120, 80958 }, // ∆
+    { 21, 24, 33, 6, 23, 126, 81078 }, // ∇
+    { 21, 23, 33, 6, 23, 121, 81204 }, // ∈
+    { 21, 29, 33, 6, 26, 153, 81325 }, // ∉
+    { 21, 19, 33, 6, 21, 100, 81478 }, // ∊
+    { 21, 23, 33, 6, 23, 121, 81578 }, // ∋
+    { 21, 29, 33, 6, 26, 153, 81699 }, // ∌
+    { 21, 19, 33, 6, 21, 100, 81920 }, // ∍
+    { 25, 29, 27, 1, 23, 182, 82020 }, // ∏
+    { 20, 29, 20, 0, 23, 145, 82202 }, // ∑
+    { 15, 3, 21, 3, 13, 12, 82347 }, // −
+    { 19, 26, 16, -1, 24, 124, 82359 }, // ∕
+    { 13, 26, 16, 2, 24, 85, 82483 }, // ∖
+    { 15, 16, 21, 3, 19, 60, 82568 }, // ∗
+    { 12, 12, 21, 4, 17, 36, 82628 }, // ∘
+    { 6, 6, 21, 7, 12, 9, 82664 }, // ∙
+    { 21, 31, 21, 0, 27, 163, 82673 }, // √
+    { 16, 13, 21, 2, 17, 52, 82836 }, // ∝
+    { 21, 11, 21, 0, 16, 58, 82888 }, // ∞
+    { 21, 23, 33, 6, 23, 121, 82946 }, // ∟
+    { 23, 23, 33, 4, 23, 133, 83067 }, // ∠
+    { 4, 34, 17, 6, 26, 34, 83200 }, // ∣
+    { 10, 34, 17, 3, 26, 85, 83234 }, // ∥
+    { 21, 23, 33, 6, 23, 121, 83319 }, // ∧
+    { 21, 23, 33, 6, 23, 121, 83440 }, // ∨
+    { 19, 24, 33, 7, 24, 114, 83561 }, // ∩
+    { 19, 24, 33, 7, 23, 114, 83675 }, // ∪
+    { 18, 34, 21, 1, 26, 153, 83789 }, // ∫
+    { 21, 19, 33, 6, 18, 100, 83968 }, // ∴
+    { 21, 19, 33, 6, 18, 100, 84068 }, // ∵
+    { 7, 18, 10, 1, 20, 32, 84168 }, // ∶
+    { 21, 19, 33, 6, 18, 100, 84200 }, // ∷
+    { 19, 6, 33, 7, 13, 29, 84300 }, // ∼
+    { 19, 18, 33, 7, 20, 86, 84329 }, // ≅
+    { 16, 12, 21, 2, 17, 48, 84415 }, // ≈
+    { 19, 11, 33, 7, 15, 53, 84463 }, // ≍
+    { 15, 15, 21, 3, 19, 57, 84516 }, // ≠
+    { 19, 15, 33, 7, 17, 72, 84573 }, // ≡
+    { 15, 20, 21, 3, 20, 75, 84645 }, // ≤
+    { 15, 20, 21, 3, 20, 75, 84720 }, // ≥
+    { 27, 16, 33, 3, 19, 108, 84795 }, // ≪
+    { 27, 16, 33, 3, 19, 108, 84903 }, // ≫
+    { 21, 19, 33, 6, 21, 100, 85011 }, // ⊃
+    { 21, 29, 33, 6, 26, 153, 85111 }, // ⊄
+    { 21, 29, 33, 6, 26, 153, 85264 }, // ⊅
+    { 21, 23, 33, 6, 23, 121, 85417 }, // ⊆
+    { 21, 23, 33, 6, 23, 121, 85538 }, // ⊇
+    { 25, 25, 33, 4, 24, 157, 85659 }, // ⊕
+    { 25, 25, 33, 4, 24, 157, 85816 }, // ⊖
+    { 25, 25, 33, 4, 24, 157, 86016 }, // ⊗
+    { 25, 25, 33, 4, 24, 157, 86173 }, // ⊘
+    { 19, 23, 33, 7, 23, 110, 86330 }, // ⊥
+    { 6, 6, 21, 7, 12, 9, 86440 }, // ⋅
+    { 27, 6, 33, 3, 12, 41, 86449 }, // ⋯
+    { 31, 32, 33, 1, 28, 248, 86490 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_italicIntervals[] = {
@@ -6061,4 +3579,9 @@ static const EpdFontData bookerly_16_italic = {
     36,
     -9,
     true,
+    bookerly_16_italicBlockOffsets,
+    bookerly_16_italicDirectGlyphs,
+    bookerly_16_italicGlyphPages,
+    256,
+    bookerly_16_italicPageGlyphs,
 };
@@ -2,5074 +2,2562 @@
  * generated by fontconvert.py
  * name: bookerly_16_regular
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_16_regular 16 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py bookerly_16_regular 16 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_regularBitmaps[80966] = {
-    0x0A, 0x83, 0xF8, 0x3F, 0x47, 0xF4, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
-    0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x2F, 0x02, 0xF0, 0x04, 0x00, 0x00, 0x00, 0x01,
-    0xA4, 0x3F, 0xC3, 0xFC, 0x3F, 0xC0, 0x50, 0x05, 0x01, 0x93, 0xE0, 0x7D, 0x7E, 0x0B, 0xD7, 0xE0,
-    0xBD, 0x7E, 0x0B, 0xC3, 0xD0, 0xBC, 0x3D, 0x0B, 0xC3, 0xD0, 0x7C, 0x3D, 0x07, 0xC3, 0xC0, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x78, 0x00, 0x00, 0x0B, 0x80, 0x2D, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0x55, 0xF5,
-    0x57, 0xD5, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2A, 0xBF, 0xAA, 0xFE, 0xA4, 0x00, 0x0F, 0x40,
-    0x3D, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x02,
-    0xE0, 0x00, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0xB4, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFB, 0xFC, 0x03, 0xF0, 0xF0, 0xFE, 0x0B, 0xC0, 0xF0, 0x3E, 0x0F, 0xC0, 0xF0, 0x3D, 0x0F, 0xC0,
-    0xF0, 0x24, 0x0F, 0xD0, 0xF0, 0x00, 0x0B, 0xF4, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0xE3, 0xFC, 0x00, 0x01,
-    0xD0, 0xFD, 0x0E, 0x01, 0xD0, 0x7E, 0x3F, 0x02, 0xD0, 0x7E, 0x3F, 0x02, 0xD0, 0xBD, 0x3F, 0x82,
-    0xD0, 0xFC, 0x2F, 0xF6, 0xD7, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0x40, 0x00,
-    0x2F, 0x87, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x7D,
-    0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0xB8, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x3C,
-    0x00, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x2D, 0x00, 0x64, 0x00, 0xBD, 0x00, 0xF8, 0x1F, 0x02, 0xFF,
-    0xE0, 0x0F, 0xC0, 0xFC, 0x0F, 0x02, 0xFA, 0xFF, 0x02, 0xFF, 0xFD, 0x07, 0x81, 0xF4, 0x0B, 0xD0,
-    0x1F, 0xFC, 0x03, 0xC0, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x3E, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xF0, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0xBC,
-    0x01, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x0F,
-    0xC0, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xAF,
-    0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x07,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x2F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x03, 0xF4, 0xFD, 0x00, 0x2F, 0x40, 0x02, 0xF8,
-    0x1F, 0xC0, 0x07, 0xD0, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x3D,
-    0x00, 0x0F, 0xC0, 0x03, 0xFD, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0xEB, 0xC0, 0x00, 0xFE, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFB, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xE0, 0x1F, 0xFD, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x14, 0x00, 0x05, 0x3E, 0x7E, 0x7E, 0x7E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00,
-    0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF0,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x03,
-    0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-    0xBC, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x0B,
-    0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x08, 0x0F, 0xC0, 0x2F, 0x0F, 0x40, 0x3F, 0xDE,
-    0x00, 0x07, 0xFD, 0xBC, 0x00, 0xBF, 0xFD, 0x0B, 0xEC, 0x6C, 0x3F, 0x8E, 0x00, 0x1E, 0x0F, 0x00,
-    0x04, 0x0F, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x01, 0x55, 0xF9, 0x55,
-    0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
-    0x40, 0x2D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x2F, 0x2F,
-    0xEF, 0xFE, 0xFD, 0x14, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x06, 0xBE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0x00, 0x7F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0x40, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x00,
-    0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x2F, 0xC7,
-    0xF0, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0xBF, 0x1F, 0xD0, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x0F,
-    0xD0, 0xFF, 0x00, 0x00, 0x7F, 0x02, 0xFD, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x07,
-    0xFD, 0x07, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x1B, 0xF0, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFE, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0xFE, 0x00, 0x01, 0xBF, 0xE5, 0x0F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x00, 0x1B, 0xF9,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xEB, 0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xE0, 0x3F, 0x00,
-    0x03, 0xFC, 0x1F, 0x80, 0x00, 0xFF, 0x07, 0xE0, 0x00, 0x2F, 0xC0, 0x64, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1B, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFE, 0xBF, 0xE0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F,
-    0x00, 0x03, 0xF0, 0x1C, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBA, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x01,
-    0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x02, 0xF8, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x7F, 0x00,
-    0x07, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xAA, 0xAA, 0xBF, 0xAA,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x55, 0x55, 0x54, 0x01,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x7F,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFE, 0x55, 0xBF, 0xD0, 0x7F, 0x00,
-    0x03, 0xFC, 0x1F, 0xC0, 0x00, 0x7F, 0x87, 0xF0, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x02, 0xFC, 0x7F,
-    0x40, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x0F, 0xE0, 0x7F, 0x80, 0x07, 0xF0,
-    0x0F, 0xFD, 0x0B, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xBE, 0xAA, 0xAA,
-    0xFD, 0xBC, 0x00, 0x03, 0xF8, 0xBC, 0x00, 0x07, 0xF0, 0xB8, 0x00, 0x0F, 0xD0, 0x10, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x0B, 0xFA, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xEA, 0xFF, 0x40, 0x2F, 0xC0,
-    0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x0F, 0xC0, 0x3F,
-    0x40, 0x07, 0xF0, 0x0B, 0xF8, 0x07, 0xF0, 0x00, 0xFF, 0xDB, 0xF4, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFE, 0xFF, 0xE0, 0x02, 0xFC, 0x07, 0xFE, 0x01, 0xFC, 0x00, 0x3F,
-    0xD0, 0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x0B, 0xF0, 0xFE, 0x00, 0x03, 0xF4, 0x2F, 0xF4, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x2F, 0xD0, 0x1F, 0xF4, 0x3F, 0x40, 0x03, 0xFC, 0x7F, 0x00, 0x02, 0xFC, 0xBF,
-    0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x3F,
-    0xC0, 0x00, 0xFE, 0x2F, 0xF0, 0x00, 0xFE, 0x0F, 0xFF, 0xEF, 0xFD, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1A, 0xAB, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x04, 0x1F, 0xDF, 0xFF, 0xFE, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xFB, 0xFF, 0xBF, 0x45, 0x00, 0x00, 0x50,
-    0x03, 0xFC, 0x07, 0xFD, 0x07, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0xFC,
-    0x02, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xF4,
-    0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x52, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x10, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07,
-    0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x3F, 0xFF, 0x40, 0x7F, 0xFF,
-    0xD0, 0x3E, 0xAF, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x1B, 0xFD, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x0F,
-    0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x06, 0xFF, 0x40,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x6A, 0x40, 0x00, 0xFC, 0x0F, 0xD0, 0x02,
-    0xFF, 0xF8, 0x00, 0x2F, 0x43, 0xF0, 0x03, 0xF9, 0x7F, 0x40, 0x07, 0xE2, 0xF8, 0x01, 0xF4, 0x07,
-    0xE0, 0x00, 0xFC, 0xFC, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x5F, 0x80, 0x03, 0xF7, 0xE0, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xF9,
-    0xF8, 0x00, 0x2F, 0xE6, 0xF8, 0x00, 0x7D, 0x7E, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x2F, 0x1F, 0xC0,
-    0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x83, 0xF0, 0x03, 0xF0, 0x0B, 0xF0, 0x1F, 0xC0, 0xFC, 0x00, 0xBF,
-    0x5F, 0xFF, 0xFF, 0xC0, 0x2F, 0x40, 0x0F, 0xFF, 0x8F, 0xFF, 0x80, 0x07, 0xF0, 0x00, 0xBE, 0x40,
-    0x69, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x01, 0xFF, 0xF9, 0x55, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x05, 0xFF, 0x00, 0xBF, 0xC0, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x00, 0xBE, 0x00,
-    0x2F, 0xC0, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x0B, 0xF0,
-    0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x0B, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0B, 0xF0, 0x56, 0xFF, 0x40, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x02,
-    0xFC, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x2F, 0xC0, 0x00, 0x3F, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x0B, 0xF5, 0x5B, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B, 0xFC, 0x01, 0xFE, 0x00,
-    0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0xB4,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x0B, 0xFF,
-    0xFA, 0xAF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x05, 0xFF, 0x05, 0xAF, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xF0,
-    0x00, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF5, 0x56, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00,
-    0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D,
-    0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE1, 0x7F, 0xEA, 0xAF, 0xF8, 0x0B, 0xF0, 0x00, 0x3E,
-    0x02, 0xFC, 0x00, 0x0B, 0x80, 0xBF, 0x00, 0x01, 0xD0, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xD5, 0x6A, 0x80, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0x95, 0x6F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xC0, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFD, 0x7F, 0x40,
-    0x00, 0xBF, 0xFF, 0xD7, 0xF4, 0x00, 0x01, 0xAF, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x43, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x0B,
-    0xFE, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17, 0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xAB, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x0B, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x00, 0x5F, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF2,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFE,
-    0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x2F,
-    0xC0, 0x00, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF3,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xFE,
-    0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFD, 0x00,
-    0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xDB, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xA4, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x74, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0x0F, 0x40, 0xBF,
-    0x00, 0x00, 0xBD, 0x02, 0xFD, 0x5A, 0xAB, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x3E, 0xFC, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x03, 0xCF, 0xD0, 0x00, 0x7C, 0xFC, 0x00, 0x00,
-    0x7C, 0xBE, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x07, 0xC7, 0xF0, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0xBC,
-    0x3F, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x0B, 0xC2, 0xF8, 0x03, 0xE0, 0xFD, 0x00, 0x00, 0xBC, 0x1F,
-    0xC0, 0x3C, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0xFC, 0x0B, 0xC0, 0xBD, 0x00, 0x00, 0xF8, 0x0B, 0xD0,
-    0xF8, 0x0B, 0xE0, 0x00, 0x0F, 0x80, 0x3F, 0x0F, 0x00, 0x7E, 0x00, 0x00, 0xF4, 0x03, 0xF2, 0xF0,
-    0x07, 0xE0, 0x00, 0x0F, 0x40, 0x2F, 0x7D, 0x00, 0x7F, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x03,
-    0xF0, 0x00, 0x1F, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xF8, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x00,
-    0x17, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00,
-    0x2F, 0xBF, 0x40, 0x00, 0x2F, 0x00, 0x02, 0xF2, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x0F, 0xF0,
-    0x00, 0x2F, 0x00, 0x02, 0xF0, 0x7F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x0F, 0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x00, 0x02, 0xF0, 0x02,
-    0xFD, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x82, 0xF0,
-    0x00, 0x2F, 0x00, 0x01, 0xFD, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xF2, 0xF0, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0xAF, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4,
-    0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07,
-    0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0x01, 0x7F,
-    0xC0, 0x6F, 0xFC, 0x02, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xC0, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x0F,
-    0xE0, 0x2F, 0xC0, 0x00, 0xBE, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0xFD, 0x02, 0xFC,
-    0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x07, 0xF4, 0x02, 0xFD, 0x5B, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFE, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x0B, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0x80,
-    0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x80,
-    0x00, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF9, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x7F, 0xC0, 0x6F, 0xF8, 0x00, 0x02, 0xFC, 0x00,
-    0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0,
-    0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0xFF, 0xF4, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x02,
-    0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00,
-    0x2F, 0xC0, 0x0B, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x5B,
-    0xFC, 0x0F, 0xD0, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0xF8, 0x2F, 0xC0, 0x00,
-    0xB0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFC, 0x04, 0x00, 0x02, 0xFD, 0x3C, 0x00, 0x00, 0xFD, 0x7D, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x01,
-    0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0xD0, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x5A, 0x90, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFA, 0xAF, 0xFA, 0xAF, 0xF2, 0xF0, 0x02, 0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xBF, 0x00, 0x2F, 0x2E,
-    0x00, 0x2F, 0xC0, 0x07, 0xC7, 0x40, 0x0B, 0xF0, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x6F, 0xD0, 0x00, 0x01, 0xBF,
-    0x40, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x56, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x03, 0xFF, 0xFE, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFE,
-    0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00,
-    0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x07,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xF4,
-    0x00, 0x3F, 0x00, 0x03, 0xFF, 0xFE, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFB, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xC0, 0x03,
-    0xF7, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xD3, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x07, 0xC2, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xC1, 0xFC, 0x02, 0xF4, 0x00,
-    0x00, 0x07, 0xF0, 0x0F, 0x80, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0x00, 0xBE, 0x03,
-    0xE0, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0x00, 0x7F, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x3E, 0x00,
-    0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xFD,
-    0xBC, 0x00, 0x1F, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x7E, 0xF8, 0x00, 0x0F, 0xDF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x06, 0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF,
-    0x80, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xC1, 0xBF, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00,
-    0x01, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x03,
-    0xF8, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xCB, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD4, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x43,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xAA, 0xFF, 0xC3, 0xF0, 0x00, 0x0B, 0xF0, 0x3D, 0x00, 0x01,
-    0xFD, 0x03, 0xC0, 0x00, 0x3F, 0x80, 0x18, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xC0, 0xBF, 0x40, 0x00, 0x3D, 0x1F, 0xE0, 0x00, 0x03,
-    0xD3, 0xFC, 0x00, 0x00, 0xBD, 0xBF, 0xAA, 0xAA, 0xAF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF6, 0xFF, 0xDB, 0xD0, 0x2F, 0x00, 0xBC, 0x02,
-    0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B,
-    0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F,
-    0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xFF, 0xDB, 0xFF, 0x40, 0x00, 0x7C,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x15, 0x3F, 0xF8, 0xFF, 0xE0, 0x0F, 0x80,
-    0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00,
-    0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03,
-    0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0xFF, 0xE7, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F,
-    0xBC, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0xF8,
-    0x0F, 0x80, 0x02, 0xF0, 0x0B, 0xC0, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0,
-    0x01, 0xF4, 0x0F, 0x80, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xBC, 0x2E, 0x00, 0x00, 0x3D, 0x55, 0x55,
-    0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1C, 0x00, 0x3F,
-    0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD,
-    0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-    0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54,
-    0x00, 0x10, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x50, 0x00,
-    0x00, 0xFC, 0x2F, 0xFF, 0x40, 0x00, 0xFD, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xF9, 0xBF, 0xF0, 0x00,
-    0xFF, 0x40, 0x0B, 0xF8, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0xFC,
-    0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x01, 0xFD, 0x07, 0xFC, 0x0F, 0xC0, 0x03, 0xF4, 0xBD, 0x00, 0x0B,
-    0xC3, 0xF0, 0x00, 0x14, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0x95, 0x6E, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x54, 0x7F, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xF9, 0x01, 0xFF, 0x00, 0x0F, 0xD0,
-    0x00, 0x7F, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x7F,
-    0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00,
-    0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xF9, 0x1B, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFD, 0x01,
-    0xFF, 0xFD, 0x2F, 0xFC, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0x80, 0x03, 0xF4, 0xFC, 0x00, 0x0B, 0xE3,
-    0xF0, 0x00, 0x1F, 0x9F, 0xD5, 0x55, 0xBE, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xDB, 0xE0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0x95, 0x6D, 0x0B, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x2F, 0x80,
-    0x3E, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x6A, 0xFE, 0xAA,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x00, 0xBF, 0x09, 0x03, 0xF0, 0x00, 0xBE,
-    0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x07,
-    0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xF4, 0x0B, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xAA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0xFD,
-    0x00, 0x01, 0xBF, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00,
-    0x2F, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xEB, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0x01, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x01, 0x54, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0x57, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0,
-    0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC3, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x10, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x03,
-    0xFF, 0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x00, 0x05, 0x00, 0x03,
-    0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x0B, 0xFF, 0x80, 0x1B, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00,
-    0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F,
-    0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x02, 0xFD, 0x01, 0xFF, 0x80, 0xBF, 0xD0, 0x02, 0x90,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x06, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x07, 0xFF, 0xFC, 0x01, 0xFC, 0x07, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x02,
-    0xFC, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x40, 0x00,
-    0x01, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x01,
-    0xFC, 0x01, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0xFF,
-    0xC0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x54, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0xC0,
-    0x01, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x2F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFE, 0x0B, 0xFF, 0xD0, 0x2F, 0xFF, 0x40,
-    0x03, 0xFF, 0xCF, 0xFF, 0xFC, 0x3F, 0xFF, 0xF4, 0x00, 0xAF, 0xFF, 0xE5, 0xFF, 0xFF, 0x97, 0xFF,
-    0x00, 0x00, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00,
-    0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0,
-    0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xE0, 0x00, 0x3F, 0x80, 0x1F, 0xFF, 0xE0, 0x2F, 0xFF, 0x80, 0xBF, 0xFF, 0x0F, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0x82, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFC, 0xFF, 0xFF, 0xE0, 0x02, 0xBF, 0xFF, 0x96, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02,
-    0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x1F, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xD3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8,
-    0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F,
-    0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40,
-    0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x6F, 0xC1, 0xFF, 0xF8, 0x0B, 0xFF, 0x6F, 0xFF, 0xFC, 0x1B, 0xFF, 0xF9, 0x6F,
-    0xF8, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x2F, 0x80, 0x00, 0x3F, 0x80,
-    0xBE, 0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x0B, 0xF0, 0x2F, 0x80,
-    0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0xFE, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x1F,
-    0xC0, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0xBF, 0x90, 0x6F, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x7F, 0xC0, 0x0F, 0xD0, 0x00,
-    0x7F, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x1F, 0xC0,
-    0xBF, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0xC0,
-    0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x2F,
-    0xF0, 0x07, 0xFE, 0x5B, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0xFF, 0xE1, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x01, 0x50, 0x2F, 0xE0, 0x7F, 0xE3, 0xFF, 0xC7,
-    0xFF, 0x8A, 0xFF, 0x7F, 0xFD, 0x00, 0xFF, 0xD0, 0x20, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x1F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xFF, 0x80, 0xF8, 0x01, 0xF8, 0x1F, 0x40, 0x0B, 0x82, 0xF4, 0x00, 0x70, 0x1F,
-    0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x1F, 0xFC, 0x1C, 0x00, 0x1F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xF4,
-    0x02, 0xF8, 0x3F, 0xFB, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x55, 0x40, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x06, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xF6, 0xAF, 0xFA, 0xA8, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF9, 0x56, 0x00, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80,
-    0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00,
-    0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x01, 0x54, 0x00, 0x50,
-    0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0,
-    0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x80, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3,
-    0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0x00,
-    0x1F, 0xFF, 0x8F, 0xFF, 0xD0, 0x07, 0xD0, 0x07, 0xFF, 0xE0, 0xBF, 0x40, 0x02, 0xF8, 0x00, 0x0F,
-    0xC0, 0x0F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xE0, 0x03, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xF4, 0x00,
-    0x7F, 0x00, 0x2F, 0xF8, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xBF, 0x00, 0x3E, 0x00, 0x03, 0xF8,
-    0x07, 0xCF, 0xD0, 0x2F, 0x00, 0x00, 0x7F, 0x02, 0xF1, 0xF8, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xF4,
-    0x3F, 0x03, 0xD0, 0x00, 0x02, 0xF4, 0x7C, 0x0B, 0xD1, 0xF0, 0x00, 0x00, 0x7E, 0x2E, 0x01, 0xF8,
-    0xF8, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x3F, 0x3D, 0x00, 0x00, 0x02, 0xFB, 0xC0, 0x0B, 0xEF, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x80, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x00,
-    0x3F, 0x00, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x00, 0x1F, 0xC2, 0xF0, 0x00, 0x00, 0x0B, 0xF7, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xEF, 0xD0, 0x00, 0x00, 0x0F, 0x87, 0xF4, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x80, 0x2F, 0xFE, 0x01, 0xFF, 0xFC, 0xBF, 0xFF,
-    0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00,
-    0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F,
-    0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00,
-    0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0xFE, 0x1F, 0x00, 0x0F, 0xF0, 0x78,
-    0x00, 0xBF, 0x00, 0x90, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x0D, 0x0F, 0xE0, 0x00,
-    0xB8, 0xBF, 0x00, 0x03, 0xD7, 0xF5, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0xC0, 0x7F, 0x40, 0x0B, 0xD0,
-    0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x03, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00,
-    0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x03,
-    0xFF, 0xA0, 0x0B, 0xFF, 0x00, 0x05, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x02,
-    0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00,
-    0x7E, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xC0,
-    0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x40, 0x01, 0xFC,
-    0x01, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x05, 0x40, 0x00, 0x01, 0xB8, 0x00, 0x08, 0x0F, 0xFF, 0x80,
-    0x2E, 0x2F, 0xFF, 0xF4, 0xBE, 0x3E, 0x07, 0xFF, 0xFC, 0x3C, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x05,
-    0x40, 0x05, 0x03, 0xFC, 0x3F, 0xC3, 0xFC, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xF8,
-    0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xD0, 0xFD, 0x0F,
-    0xD0, 0xFD, 0x1F, 0xD1, 0xFC, 0x2F, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF4, 0x07, 0xFA, 0xE7, 0xFC,
-    0x0F, 0xC1, 0xE0, 0xFC, 0x2F, 0x41, 0xE0, 0xB8, 0x3F, 0x01, 0xD0, 0x60, 0x7E, 0x01, 0xD0, 0x00,
-    0xBD, 0x01, 0xD0, 0x00, 0xBD, 0x01, 0xD0, 0x00, 0xFD, 0x01, 0xD0, 0x00, 0xBD, 0x02, 0xD0, 0x00,
-    0xBE, 0x02, 0xC0, 0x00, 0x7F, 0x02, 0xC0, 0x00, 0x3F, 0x82, 0xC0, 0x00, 0x3F, 0xE2, 0xC0, 0x18,
-    0x0F, 0xFF, 0xEB, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFA, 0xFE, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00,
-    0x07, 0xE0, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x01, 0x40,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2B, 0xFA, 0xAA, 0xAA, 0xD1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFE, 0xBF, 0xFF, 0xFC, 0x07, 0x80, 0x00, 0x15, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x80, 0xF4, 0x01, 0x50, 0x0F, 0x82, 0xF5, 0xFF, 0xFD, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0xF8, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x40,
-    0x0F, 0xC0, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x2F, 0xF8, 0x2F,
-    0x83, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x01, 0x55, 0x47,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x2F, 0xFD, 0x00, 0x01, 0xBF, 0x40, 0x3F, 0x80, 0x00, 0x0B, 0xD0,
-    0x02, 0xFD, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xE0,
-    0x00, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0x40, 0x00, 0x00, 0x7F, 0x03, 0xF0,
-    0x00, 0x00, 0xFF, 0xF4, 0x7F, 0xF8, 0x00, 0x0B, 0xFF, 0xCF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x06, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x06, 0xA4, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x2F, 0xAB, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x0F,
-    0x80, 0x07, 0x80, 0xBE, 0x00, 0x04, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xB9, 0xFE,
-    0x00, 0x02, 0xE2, 0xFF, 0x40, 0x0B, 0xC1, 0xFF, 0xC0, 0x1F, 0x00, 0x7F, 0xC0, 0x3F, 0x00, 0x2F,
-    0xC0, 0x7F, 0x00, 0x1F, 0x80, 0xBF, 0x80, 0x2F, 0x00, 0xBF, 0xD0, 0x3C, 0x00, 0x7F, 0xE0, 0xF4,
-    0x00, 0x2F, 0xF3, 0xD0, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x0B, 0xFC, 0x18, 0x00, 0x0F, 0xE0, 0xF8,
-    0x00, 0x3F, 0x07, 0xF0, 0x01, 0xF8, 0x0F, 0xF4, 0x1F, 0x80, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x05, 0x00, 0x14, 0x7F, 0x40, 0xFD, 0xBF, 0x81, 0xFE, 0x7F, 0x40, 0xFD, 0x04, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF,
-    0xEA, 0xBF, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7F, 0xF4, 0x03, 0xC0, 0x3D, 0x00, 0xFF,
-    0xFE, 0x00, 0xB8, 0x1F, 0x00, 0xF8, 0x03, 0x80, 0x0F, 0x0B, 0x40, 0x7C, 0x00, 0xE0, 0x02, 0xD3,
-    0xC0, 0x2E, 0x00, 0x10, 0x00, 0x78, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x1E, 0x3C, 0x03, 0xD0, 0x00,
-    0x00, 0x07, 0xCF, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xE3, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x78, 0xB4,
-    0x0B, 0xC0, 0x00, 0x00, 0x2D, 0x1E, 0x01, 0xFD, 0x00, 0x40, 0x0F, 0x03, 0xC0, 0x2F, 0xFF, 0xF0,
-    0x07, 0xC0, 0xB8, 0x01, 0xFF, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xF4,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x95, 0x6F, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x03, 0xF6, 0xF4, 0x1F, 0x03, 0xE0, 0x28, 0x0F, 0x80, 0x01, 0x7E, 0x01, 0xFF,
-    0xF8, 0x1F, 0x93, 0xE0, 0xFC, 0x0F, 0x83, 0xF0, 0x3F, 0x07, 0xFF, 0xFF, 0xC7, 0xF4, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x3F, 0xFF, 0xF4, 0x00, 0x04, 0x00, 0x04, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0xD0, 0x1F, 0xD0, 0x1F, 0xE0, 0x2F,
-    0xE0, 0x1F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x1F, 0xD0,
-    0x01, 0xFC, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x05, 0x00,
-    0x05, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x6F, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x0F, 0x90, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0x06, 0xA8, 0x03,
-    0xC0, 0x78, 0x2F, 0xBD, 0x07, 0x42, 0xC0, 0x38, 0x78, 0x0F, 0x0F, 0x00, 0xE1, 0xE0, 0x2C, 0x3C,
-    0x03, 0xEF, 0x00, 0xB0, 0xE0, 0x0F, 0xF0, 0x02, 0xC3, 0xC0, 0x38, 0xF0, 0x0B, 0x0B, 0x00, 0xE1,
-    0xF0, 0x3C, 0x1D, 0x0F, 0xE1, 0xF1, 0xE0, 0x3C, 0x15, 0x41, 0x4F, 0x00, 0x3C, 0x00, 0x00, 0xB4,
-    0x00, 0x7D, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x1A,
-    0xAA, 0xA4, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF,
-    0xE0, 0x3F, 0x47, 0xF4, 0x7C, 0x00, 0xFC, 0xBC, 0x00, 0x7C, 0xBC, 0x00, 0x7C, 0xBC, 0x00, 0xBC,
-    0x7E, 0x00, 0xF8, 0x3F, 0xEB, 0xF0, 0x0B, 0xFF, 0xC0, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x01, 0x55, 0xF9, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x2F, 0xFF, 0xE0,
-    0x7F, 0x07, 0xF0, 0xBC, 0x02, 0xF4, 0x7C, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFC, 0x2A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x03, 0xFF, 0xFD, 0x2F,
-    0x41, 0xF8, 0x74, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xFC, 0x01, 0xBF, 0xC0, 0x0B, 0xFF, 0xC0,
-    0x15, 0x6F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x01, 0xBF, 0x4B, 0xFF, 0xF4,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0xC0, 0xBF, 0x03, 0xF8, 0x3F, 0x82, 0xF8,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x03, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00,
-    0x07, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00,
-    0x7F, 0xF0, 0x00, 0xFF, 0xE0, 0xBF, 0x7F, 0x04, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0x1F, 0x6F, 0xFF,
-    0x02, 0xFF, 0x47, 0xE0, 0x54, 0x00, 0x15, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xBF, 0x40, 0x3F, 0xFF, 0xCB, 0x80, 0x2F, 0xFF,
-    0xF2, 0xE0, 0x0F, 0xFF, 0xFC, 0xB8, 0x03, 0xFF, 0xFF, 0x2E, 0x01, 0xFF, 0xFF, 0xCB, 0x80, 0x7F,
-    0xFF, 0xF2, 0xE0, 0x0F, 0xFF, 0xFC, 0xB8, 0x03, 0xFF, 0xFF, 0x2E, 0x00, 0x7F, 0xFF, 0xCB, 0x80,
-    0x0B, 0xFF, 0xF2, 0xE0, 0x00, 0xBF, 0xFC, 0xB8, 0x00, 0x06, 0xDF, 0x2E, 0x00, 0x00, 0x07, 0xCB,
-    0x80, 0x00, 0x01, 0xF2, 0xE0, 0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x07,
-    0xCB, 0x80, 0x00, 0x01, 0xF2, 0xE0, 0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0x1F, 0x2E, 0x00, 0x00,
-    0x07, 0xCB, 0x40, 0x00, 0x01, 0xF2, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x04, 0x07, 0xFC, 0x7F,
-    0xF0, 0x3F, 0x07, 0xE0, 0xFC, 0x7F, 0x02, 0x40, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x1B, 0xFD, 0x03,
-    0xFF, 0xC0, 0x05, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xD0, 0x1F, 0xFF, 0xF2, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xEF, 0xF0, 0x3E, 0x02, 0xF8, 0xBC, 0x00, 0xFC, 0xFC,
-    0x00, 0xFC, 0xF8, 0x00, 0xBC, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0xF8, 0x7F, 0x02, 0xF0, 0x2F, 0xFF,
-    0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0,
-    0x10, 0x00, 0x04, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x0F,
-    0xC0, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x03, 0xF4, 0x03, 0xF8, 0x03, 0xFC,
-    0x02, 0xFD, 0x02, 0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xF8,
-    0x00, 0xFC, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1A, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x01, 0x90, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0xD0,
-    0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0xD0,
-    0x00, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0xFB, 0xD0, 0x1B, 0xFF, 0xE0, 0x0B, 0x80, 0x03, 0xF3, 0xD0,
-    0x3F, 0xFF, 0xF0, 0x0F, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0x43, 0xD0,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x07, 0xD0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x06, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x1A, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x6F, 0x80,
-    0x00, 0xBC, 0x00, 0x00, 0xF4, 0x07, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x1F, 0xD7, 0xFC,
-    0x00, 0xBC, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x0B, 0x80, 0x3E, 0x00, 0xFC,
-    0x1B, 0xFF, 0xE0, 0x0F, 0x00, 0x05, 0x00, 0xFC, 0x3F, 0xFF, 0xF0, 0x2E, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0xD5, 0x55,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0xFF, 0xFD,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x01, 0xBE, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x02, 0xF9, 0x2F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x78, 0x03, 0xF0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x04, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x01, 0xAB, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0x68, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xC0,
-    0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x01, 0xF0,
-    0x00, 0x3F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0xF0, 0x00, 0x3F, 0xF8, 0x06, 0xBF, 0xF8, 0x00, 0xB8,
-    0x00, 0x2F, 0x3E, 0x02, 0xFF, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0x4F, 0x80, 0x15, 0x40, 0x00, 0x2E,
-    0x00, 0x0F, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0xE0, 0x02, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFC, 0x02, 0xFF, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFF, 0x9B, 0xC0, 0x2F,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0B,
-    0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA, 0xBF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x00, 0xFD, 0x03, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xD1, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x80, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x01, 0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xEB, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFB,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3E, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xAA, 0xAF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x1F, 0xEA, 0xAA, 0xBF, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x01, 0xFE, 0x01, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0xAA, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xEF,
-    0xC0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0xBF, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x1F, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xAA, 0xA8, 0x00, 0x00, 0x07, 0xFA, 0xAB, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xAA, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x10, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xD0,
-    0x07, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7D, 0x02,
-    0xF8, 0x00, 0x00, 0xFF, 0x56, 0xAB, 0xF0, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B, 0xFC, 0x01, 0xFE, 0x00, 0x03, 0xF0, 0x0F,
-    0xD0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0xB4, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x0B, 0xFF, 0xFA, 0xAF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0xFF, 0xAA, 0xAB, 0xFC, 0x02, 0xFC, 0x00,
-    0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xC0, 0x00, 0x1D, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xAA, 0xA4, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x40,
-    0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00, 0x3E, 0x02, 0xFC, 0x00, 0x01, 0xF4, 0x0B, 0xF5,
-    0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x05, 0xFF, 0xAA, 0xAB, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F,
-    0xC0, 0x00, 0x1D, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0B, 0xFA, 0xAA, 0xA4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00,
-    0x3E, 0x02, 0xFC, 0x00, 0x01, 0xF4, 0x0B, 0xF5, 0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0x83, 0xF4, 0x00, 0x02, 0xF8, 0x03, 0xF0,
-    0x00, 0x0B, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0xFF, 0xAA, 0xAB, 0xFC, 0x02, 0xFC, 0x00,
-    0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xC0, 0x00, 0x1D, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xAA, 0xA4, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x40,
-    0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00, 0x3E, 0x02, 0xFC, 0x00, 0x01, 0xF4, 0x0B, 0xF5,
-    0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00,
-    0xBD, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF,
-    0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00,
-    0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x10, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0x06, 0xFC,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFE, 0x05, 0xFF,
-    0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xF4, 0x07, 0xFF, 0xFF, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0xFF,
-    0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFE, 0x05, 0xFF, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF4, 0x07, 0xFF, 0xFF, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xFB, 0xF4, 0x0F, 0xD1, 0xFC, 0x2F,
-    0x80, 0x7E, 0x2D, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xF8, 0x05, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0xBD, 0x7F, 0x81, 0xFF, 0x7F, 0x81, 0xFF, 0x2F, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x05, 0xFF,
-    0x40, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x05,
-    0xFF, 0x05, 0xAF, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x15,
-    0xFF, 0x55, 0x40, 0x02, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x2A, 0xFF, 0xAA, 0x80, 0x02,
-    0xFC, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x55, 0x6F, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x02, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3C, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC7, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x00, 0x17, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBF, 0x40, 0x00, 0x2F, 0x00, 0x02, 0xF2,
-    0xFC, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x0F, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x7F, 0x40, 0x02,
-    0xF0, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x0F, 0xF0, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0x7F, 0x80, 0x2F, 0x00, 0x02, 0xF0, 0x02, 0xFD, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xF0,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x82, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xFD, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0xF2, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xAF, 0x00, 0x02, 0xF0, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x07,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF,
-    0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00,
-    0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00,
-    0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF,
-    0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F,
-    0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F,
-    0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x0B, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x03, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0x02, 0x80,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xE0,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x5A, 0x90, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x3C, 0x1F, 0x80, 0x0F, 0xC0,
-    0xBE, 0x03, 0xF0, 0x02, 0xF8, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0xFE, 0xF4, 0x00, 0x3F, 0x0B, 0xD0, 0x0F, 0xD0, 0x2F, 0x43, 0xF4, 0x00, 0xBD, 0x0D,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFD, 0x01, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xF1, 0xF4, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0xF4, 0x00,
-    0xBF, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x02,
-    0xFF, 0xC0, 0x1F, 0xD0, 0x00, 0x02, 0xFF, 0xF4, 0x0F, 0xF0, 0x00, 0x02, 0xF5, 0xFE, 0x03, 0xF8,
-    0x00, 0x02, 0xF4, 0x3F, 0xC0, 0xFD, 0x00, 0x02, 0xF4, 0x0F, 0xF0, 0x7F, 0x40, 0x02, 0xF4, 0x03,
-    0xFC, 0x1F, 0xD0, 0x02, 0xF4, 0x00, 0xBF, 0x07, 0xF4, 0x02, 0xF4, 0x00, 0x2F, 0xC1, 0xFE, 0x02,
-    0xF4, 0x00, 0x0F, 0xF0, 0x7F, 0x82, 0xF4, 0x00, 0x03, 0xF8, 0x0F, 0xF2, 0xF4, 0x00, 0x00, 0xFD,
-    0x03, 0xFE, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x00,
-    0x00, 0x2F, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xE0, 0x02,
-    0xF5, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xF4, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0x00, 0x16, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xF7, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x1B, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xF7, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x1B, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x40, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF7,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x1B, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40,
-    0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x6F,
-    0xD0, 0x00, 0x01, 0xBF, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00,
-    0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xF9, 0x56, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xCB, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x06, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xF0, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x7D, 0x00, 0x00,
-    0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x02, 0xFD, 0xA5, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xBF, 0xFF, 0x40,
-    0x2F, 0x80, 0x07, 0xFC, 0x02, 0xF8, 0x00, 0x1F, 0xE0, 0x2F, 0x80, 0x00, 0xBF, 0x02, 0xF8, 0x00,
-    0x07, 0xF0, 0x2F, 0x80, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x0B, 0xF0, 0x2F, 0x80, 0x00, 0xFE, 0x02,
-    0xF8, 0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x0B, 0xF4, 0x02, 0xFE, 0xAF, 0xFD, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x02, 0xFD, 0x54, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x00,
-    0x07, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x0F,
-    0x80, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFD,
-    0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xE0, 0x00, 0x03, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x7F,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x03, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x05, 0x00, 0x0F, 0xC0, 0x0F, 0xC3, 0xC0, 0x03,
-    0xF0, 0x07, 0xF0, 0xFC, 0x02, 0xF4, 0x1F, 0xFC, 0x3F, 0xFB, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0,
-    0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F,
-    0xD0, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFE, 0xFE, 0x00, 0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0,
-    0x07, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF,
-    0xD1, 0xFF, 0x00, 0x05, 0x40, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x2F, 0x02,
-    0xF4, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x24, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x2F,
-    0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0xFE,
-    0x00, 0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x07, 0xF0,
-    0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF, 0xD1, 0xFF,
-    0x00, 0x05, 0x40, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x74, 0x00, 0x0B, 0xFF,
-    0x4F, 0x80, 0x00, 0xFD, 0xBF, 0xF8, 0x00, 0x0B, 0x42, 0xFF, 0x00, 0x00, 0x10, 0x06, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02,
-    0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F,
-    0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F,
-    0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF,
-    0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x01,
-    0x40, 0x05, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xF8,
-    0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x2F, 0xC0,
-    0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0xFE, 0x00,
-    0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF, 0xD1, 0xFF, 0x00,
-    0x05, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x1F, 0x07, 0xD0, 0x00, 0x02, 0xE0, 0x3E, 0x00, 0x00, 0x2E, 0x03, 0xE0, 0x00, 0x01,
-    0xF4, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD,
-    0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00,
-    0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD,
-    0x1F, 0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x05, 0x50, 0x00, 0x15, 0x00, 0x00, 0x2F, 0xFF,
-    0x41, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x7F, 0x40, 0xBF, 0xF8, 0x07, 0xF8,
-    0x3F, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0x0B, 0xD0, 0x02, 0xFD, 0x00, 0x0F, 0xD0, 0x50, 0x00, 0xBF,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xC5, 0xAB, 0xFD, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xEA, 0x54, 0x00, 0xFF, 0xE5, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0xFF, 0x55, 0xBC, 0x2F, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0x02, 0xFF, 0xF8, 0x03, 0xFF, 0xFE, 0x00, 0x05, 0x50, 0x00, 0x05, 0x54, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x01, 0xFD, 0x07, 0xFC, 0x0F, 0xC0, 0x03,
-    0xF4, 0xBD, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x14, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x6E, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x3F, 0xC1, 0xF8, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xBE,
-    0x3F, 0x00, 0x01, 0xF9, 0xFD, 0x55, 0x5B, 0xEB, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFD, 0xBE,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x7F, 0xF9, 0x56, 0xD0, 0xBF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF4, 0x0F, 0xE0,
-    0x0F, 0xF0, 0x7E, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x7E, 0x7F, 0x55, 0x56,
-    0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x6F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB4, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7E, 0x3F, 0x40, 0x03, 0xF0, 0x3F,
-    0x00, 0x3F, 0x00, 0x3D, 0x00, 0x60, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF4, 0x0F, 0xE0, 0x0F, 0xF0, 0x7E, 0x00, 0x0F, 0xD3, 0xF0,
-    0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x7E, 0x7F, 0x55, 0x56, 0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF,
-    0xFF, 0x6F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB4, 0x2F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x50, 0x01, 0x40, 0x0F, 0xD0, 0x3F, 0x80, 0x7F, 0x81, 0xFE, 0x01, 0xFD,
-    0x03, 0xF4, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0xFE, 0x00, 0xFF, 0x07, 0xE0, 0x00, 0xFD,
-    0x3F, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x07, 0xE7, 0xF5, 0x55, 0x6F, 0xAF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xF6, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0x42, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x00,
-    0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x3F, 0xFD, 0x00, 0x6F, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x01, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFC, 0x00, 0x02, 0x40, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0,
-    0x0F, 0xFF, 0x40, 0x1B, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0x00,
-    0x07, 0xF4, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xF0, 0x0F, 0xCB, 0xE0, 0xFC, 0x0B, 0xCB, 0xD0, 0x0F,
-    0x48, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x0F, 0xFF, 0x40, 0x1B, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00,
-    0xFD, 0x00, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x05, 0x00, 0x14, 0x3F, 0x80, 0xFF, 0x7F, 0xC0,
-    0xFF, 0x3F, 0x80, 0xFE, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x06, 0xFF, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x07, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x00, 0x7F, 0x8F, 0xD0,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xBD,
-    0x2F, 0x80, 0x00, 0x07, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0xFD, 0xBD, 0x00, 0x1F, 0xFF, 0xFB, 0xF0, 0x07, 0xF9, 0x5B, 0xFF, 0x00, 0xFD, 0x00,
-    0x0F, 0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB,
-    0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00,
-    0x0F, 0xC7, 0xF4, 0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00, 0x3F, 0x03, 0xFD, 0x00, 0x07, 0xF0, 0x0F,
-    0xF8, 0x02, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xB0, 0x00, 0x00, 0x0B, 0xFF, 0x4F,
-    0x40, 0x00, 0x00, 0xFD, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x10, 0x06,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xBF, 0x82, 0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0xFF, 0xFF, 0xE0, 0x02, 0xBF, 0xFF,
-    0x96, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFD,
-    0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xD3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x7F, 0xE0, 0x0F,
-    0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x01,
-    0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0,
-    0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x7F,
-    0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x06,
-    0x94, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC, 0x00,
-    0x0F, 0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB,
-    0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00,
-    0x1F, 0xC7, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00, 0x07, 0xF0, 0x0F,
-    0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x00, 0xF8, 0x01, 0xF0,
-    0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x0F, 0xF4,
-    0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00,
-    0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xC7,
-    0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xF8, 0x02,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0E, 0x00, 0x00, 0xFF, 0xE2, 0xF0, 0x00, 0x1F, 0x6F, 0xFF,
-    0x00, 0x01, 0xE0, 0x7F, 0xD0, 0x00, 0x05, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0x40, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC,
-    0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00,
-    0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x2F, 0xC0,
-    0x7F, 0x00, 0x03, 0xFD, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x0F, 0xF4, 0x2F,
-    0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01,
-    0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xC7, 0xF4,
-    0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xF8, 0x02, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD1, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0x40, 0x7F, 0xF4, 0x03, 0xF0, 0x00,
-    0x3F, 0xD0, 0x2F, 0x40, 0x02, 0xFF, 0x80, 0xFC, 0x00, 0x2F, 0xFF, 0x07, 0xF0, 0x02, 0xF5, 0xFC,
-    0x2F, 0x80, 0x2F, 0x43, 0xF4, 0xBE, 0x02, 0xF4, 0x0F, 0xC2, 0xF8, 0x2F, 0x40, 0x3F, 0x0B, 0xF2,
-    0xF4, 0x00, 0xFC, 0x1F, 0xEF, 0x40, 0x07, 0xF0, 0x3F, 0xF4, 0x00, 0x2F, 0x40, 0xFF, 0x40, 0x01,
-    0xFC, 0x02, 0xFF, 0x40, 0x1F, 0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xF4, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x1A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06,
-    0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F,
-    0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F, 0xFC, 0x00,
-    0x01, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0xBF,
-    0xF0, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1B, 0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-    0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x3D, 0x00, 0x00, 0x01, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0x80, 0x1F, 0xFF,
-    0x00, 0x1B, 0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-    0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0,
-    0x02, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F,
-    0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x03,
-    0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0x00,
-    0x1B, 0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE,
-    0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x02,
-    0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F, 0xFF,
-    0x83, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F,
-    0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8,
-    0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4,
-    0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x01, 0x50, 0x00, 0x01, 0xFC, 0x3F, 0xFF, 0x00, 0x01, 0xFD, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xF9, 0xBF, 0xF0, 0x01, 0xFF, 0x40, 0x0F, 0xF4, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x01, 0xFC, 0x00,
-    0x02, 0xFC, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x01,
-    0xFC, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xF8,
-    0x01, 0xFC, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x51, 0xBF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00,
-    0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF,
-    0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00,
-    0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0x82, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xEA, 0xAB, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x07, 0xFA, 0xAA, 0xAF, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x3F, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xC0, 0x02, 0xAA, 0xA9, 0x40, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD,
-    0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-    0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x30, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xE5, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x28, 0x00, 0x0F, 0xD0, 0x0B, 0x80, 0x00, 0x7F, 0xEB, 0xF0, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC,
-    0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0,
-    0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00,
-    0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0,
-    0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00,
-    0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00,
-    0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B,
-    0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F,
-    0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFC, 0x1F, 0xF0, 0x00, 0x54, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x40, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B,
-    0xFC, 0x01, 0xFE, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07,
-    0xF0, 0x00, 0x00, 0xB4, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x14, 0x0B, 0xFF, 0xFA, 0xAF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFF, 0xFC, 0x07, 0xF4, 0x1F, 0xF0, 0x3F, 0x00, 0x0F, 0xD2, 0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0x50, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFE, 0x55, 0xB8, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xBF,
-    0x40, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x7E, 0x00, 0x00, 0xB4, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x01, 0xFF,
-    0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B, 0xFC, 0x01, 0xFE, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F,
-    0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0xB4, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x0B, 0xFF, 0xFA, 0xAF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x7E, 0x2F, 0x80, 0x03, 0xF0,
-    0x3F, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x60, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xF4, 0x1F, 0xF0, 0x3F, 0x00, 0x0F, 0xD2,
-    0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x50, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB8, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x56, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0xFC, 0x03, 0xF4, 0x00,
-    0x03, 0xF0, 0x3F, 0x80, 0x00, 0x0F, 0x81, 0xFC, 0x00, 0x00, 0x2D, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x05, 0x02, 0xFF, 0xFE, 0xAB, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xFF,
-    0xFF, 0xC0, 0x7F, 0x41, 0xFF, 0x03, 0xF0, 0x00, 0xFD, 0x2F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x05,
-    0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0xE5, 0x5B, 0x81, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x04,
-    0x00, 0x01, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x02, 0xFD, 0x7F,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x01, 0xFF,
-    0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B, 0xFC, 0x01, 0xFE, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F,
-    0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0xB4, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x0B, 0xFF, 0xFA, 0xAF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x01, 0x40, 0x01, 0x80, 0x0F,
-    0x40, 0x2F, 0x40, 0x3F, 0x41, 0xF8, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xF4, 0x1F, 0xF0, 0x3F, 0x00, 0x0F, 0xD2,
-    0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x50, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB8, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x05, 0xFF, 0x05, 0xAF, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4,
-    0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00,
-    0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF5, 0x56, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0x80, 0x00, 0x01,
-    0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xE0, 0x00,
-    0x00, 0x01, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xC0,
-    0x00, 0x01, 0x54, 0x7F, 0x01, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x01, 0xFE, 0x40, 0x7F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x01,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x46, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F,
-    0xFD, 0x00, 0x07, 0xFF, 0xF4, 0xBF, 0xF0, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x05, 0xFF, 0x05, 0xAF, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC,
-    0x15, 0xFF, 0x55, 0x40, 0x02, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x2A, 0xFF, 0xAA, 0x80,
-    0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x55, 0x6F,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x6A,
-    0xFF, 0xA8, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x06, 0xBA, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xF4, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xF9, 0x1B, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x7F,
-    0xFD, 0x01, 0xFF, 0xFD, 0x2F, 0xFC, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x5F, 0xFA, 0xAA, 0xBF, 0xC0, 0x2F, 0xC0, 0x00, 0x3F, 0x00,
-    0xBF, 0x00, 0x00, 0xB8, 0x02, 0xFC, 0x00, 0x01, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xAA, 0xAA, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x04, 0x02, 0xFC, 0x00,
-    0x00, 0xB4, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0x1F, 0x40, 0xBF, 0x56, 0xAA, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xAA, 0xAA, 0x40, 0x0F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x3F, 0xC1,
-    0xF8, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xBE, 0x3F, 0x00, 0x01, 0xF9, 0xFD, 0x55, 0x5B, 0xEB, 0xFF,
-    0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFD, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xF9, 0x56, 0xD0, 0xBF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0x50, 0x00, 0x0F, 0xC0, 0x07, 0x80, 0x00, 0x3F, 0xE5, 0xBD, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0xFF, 0xAA, 0xAB,
-    0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xC0, 0x00, 0x1D, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xAA, 0xA4,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00, 0x3E, 0x02, 0xFC, 0x00,
-    0x01, 0xF4, 0x0B, 0xF5, 0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0xFF, 0xAB, 0xF0, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0x80, 0x03,
-    0xF4, 0xFC, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x1F, 0x9F, 0xD5, 0x55, 0xBE, 0xBF, 0xFF, 0xFF, 0xFA,
-    0xFF, 0xFF, 0xFF, 0xDB, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x6D, 0x0B, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02,
-    0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00,
-    0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40,
-    0xFE, 0x00, 0xFF, 0x07, 0xE0, 0x00, 0xFD, 0x3F, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x07, 0xE7, 0xF5,
-    0x55, 0x6F, 0xAF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xF6, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xE5, 0x5B,
-    0x42, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02,
-    0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00,
-    0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x50, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0x80, 0x03, 0xF4, 0xFC, 0x00,
-    0x0B, 0xE3, 0xF0, 0x00, 0x1F, 0x9F, 0xD5, 0x55, 0xBE, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x6D, 0x0B, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x00,
-    0x5B, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F,
-    0xE5, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x40, 0x00, 0x14, 0x00, 0x07, 0xC0,
-    0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x1F, 0xD3, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0xFF, 0xAA,
-    0xAB, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xC0, 0x00, 0x1D,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xAA,
-    0xA4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00, 0x3E, 0x02, 0xFC,
-    0x00, 0x01, 0xF4, 0x0B, 0xF5, 0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0x40, 0x01, 0x80, 0x0F, 0x40, 0x2F, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x3F, 0x1F, 0x80,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF4, 0x0F, 0xE0,
-    0x0F, 0xF0, 0x7E, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x7E, 0x7F, 0x55, 0x56,
-    0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x6F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB4, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x7E, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x95, 0x6F, 0xE0, 0x01, 0xFF, 0x40, 0x00,
-    0x7E, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFD, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xD7, 0xF4, 0x00, 0x01, 0xAF, 0xF8, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0xFF,
-    0x40, 0x00, 0x03, 0xF4, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xFF, 0x95, 0x6F, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x0F,
-    0x40, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x01, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFE, 0x03, 0xF8, 0x02, 0xFC, 0x24, 0x0F, 0xC0,
-    0x02, 0xF8, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x7F,
-    0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0xD0, 0x2F, 0xC0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0xAA, 0xA9, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x03, 0xF4, 0x00, 0x06, 0xFC, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0xBD, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xAF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x06, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x08, 0x00, 0x00, 0x07, 0xD0, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xD5, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x95, 0x6F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x7E, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xC0, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFD,
-    0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xD7, 0xF4, 0x00, 0x01, 0xAF, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x43, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0x40, 0x00, 0x03,
-    0xF4, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0x40, 0x00, 0x2F, 0xFA, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFE, 0x00, 0xBF, 0x09, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00,
-    0xBE, 0x00, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xF4,
-    0x0B, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xAA, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0xFD, 0x00, 0x01, 0xBF, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x2F, 0x43, 0xFC, 0x00, 0x07, 0xF8,
-    0x07, 0xFF, 0xEB, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xAA, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xF9, 0x56, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x07,
-    0xE0, 0x03, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0xD0, 0x00, 0x00,
-    0x2C, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0xBF, 0xFF, 0xD7, 0xF4, 0x00, 0x0B, 0xFF, 0xFD, 0x7F, 0x40, 0x00, 0x1A, 0xFF, 0x83, 0xF8, 0x00,
-    0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x42, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0x40, 0xBF, 0xE0, 0x00, 0x03, 0xF4, 0x02, 0xFF, 0xF9, 0x56, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x14, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
-    0x80, 0x2F, 0xC2, 0x40, 0xFC, 0x00, 0x2F, 0x80, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x2F, 0x80, 0x00,
-    0xFC, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xFD, 0x02, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0x90, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x40, 0x00, 0x6F, 0xC2, 0xF4, 0x00, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0xFF, 0x00, 0x01, 0xFE, 0x01, 0xFF, 0xFA,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x95,
-    0x6F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xE0, 0x0B, 0xF0, 0x00,
-    0x00, 0x3E, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFD, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xD7, 0xF4,
-    0x00, 0x01, 0xAF, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x2F,
-    0xE0, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0x40,
-    0x2F, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x05, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xE0, 0x0B, 0xF0, 0x90, 0x3F, 0x00, 0x0B, 0xE0, 0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x00, 0x3F, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFF, 0x40, 0xBF,
-    0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFA, 0xAA, 0xA4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xD0, 0x00, 0x1B, 0xF0, 0xBD, 0x00, 0x00, 0x0F,
-    0xC3, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x7F,
-    0xFE, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0x01, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xEA, 0xAA, 0xAA, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40,
-    0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x01,
-    0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x55, 0x00, 0x00, 0x01,
-    0xFC, 0x2F, 0xFF, 0x40, 0x00, 0x07, 0xF7, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x57, 0xFE, 0x00,
-    0x00, 0x7F, 0xD0, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x07, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x80, 0x5F,
-    0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0xAA, 0xAA, 0xAA, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xC2, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xEA, 0x80, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x6F, 0x90, 0x00, 0x01, 0xFC, 0xBF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xD0, 0x2F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40,
-    0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F,
-    0x40, 0x1F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x0B, 0xE0, 0x28, 0x2F,
-    0xFC, 0x3D, 0x3F, 0xFF, 0xFD, 0x3D, 0x1F, 0xFC, 0x1C, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x05, 0xFF, 0x40, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x40, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x01, 0x00, 0x00, 0xFF, 0x42, 0xCB, 0xFF,
-    0x4F, 0xBF, 0x7F, 0xFD, 0xB4, 0x3F, 0xF0, 0x40, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF4, 0x03, 0xFF, 0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xC0, 0x05, 0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x05, 0xFF, 0x40, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x2A, 0xAA, 0x96, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x40, 0x3F, 0xFD, 0x00, 0x6F, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00,
-    0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x09, 0x3E, 0x00, 0x1D, 0x3F, 0xD5, 0xBC, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xD0, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x05, 0xFF,
-    0x40, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0xDF, 0xD0, 0x0B, 0x6F, 0xFA, 0xFC, 0x3F, 0xFF, 0xD0, 0x1B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x03, 0xFF, 0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF,
-    0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFD, 0x01, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFE, 0x50, 0x0B, 0xFF, 0xC0, 0x06, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF4, 0x03, 0xFF, 0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0,
-    0x02, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xE5, 0x00, 0x3F, 0xFD,
-    0x00, 0x1F, 0xE0, 0x00, 0xA4, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0x81, 0x7F,
-    0xD0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0x02, 0xFD, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x03, 0xFF,
-    0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x17, 0xFD, 0x00, 0x17, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0x80, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00,
-    0x3F, 0x80, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00,
-    0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFC,
-    0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0x00, 0x03, 0xF8, 0x07, 0xFF,
-    0xFF, 0x00, 0x3F, 0x80, 0xBF, 0xFF, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xE0,
-    0x03, 0xFE, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x0B, 0xFD, 0x3F, 0xFD, 0x03,
-    0xFF, 0xD1, 0xBF, 0xD0, 0x1B, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0xFD, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00,
-    0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0xFD, 0x1F, 0xFF, 0xF0, 0x0F,
-    0xD3, 0xFF, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0xFD, 0x1F, 0xC0, 0x3F, 0x40, 0x7E, 0x02, 0xD0,
-    0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80,
-    0x05, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1A, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xD0, 0x02,
-    0xF4, 0xFC, 0x01, 0xF8, 0x1F, 0x80, 0xF8, 0x01, 0xF0, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFE, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x0B, 0xE0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4, 0x00,
-    0x02, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x81,
-    0x7F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0,
-    0x00, 0x0B, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x02, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xF3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xFE, 0x00, 0x00,
-    0x02, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFE,
-    0x00, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xDB, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xFF, 0xFC, 0x01, 0xFC,
-    0x07, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x0B,
-    0xF0, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFD, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x40, 0x00, 0x01, 0xFC, 0x3F, 0xC0, 0x00,
-    0x01, 0xFC, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x01, 0xFF, 0x40, 0x01,
-    0xFC, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x6F, 0xF0, 0x00, 0xFE, 0x40,
-    0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00,
-    0x03, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xCB, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0xFC, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00, 0x03, 0xF4, 0x01, 0xFF, 0x80, 0x1B,
-    0xFF, 0xD0, 0x1F, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80,
-    0xBF, 0x00, 0x00, 0x3D, 0x02, 0xFC, 0x00, 0x02, 0xF4, 0x0B, 0xF5, 0x6A, 0xAF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x02, 0xFD, 0x00,
-    0xBF, 0xF4, 0x1F, 0xFF, 0x40, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0xBF, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x2F,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x74, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0x0F, 0x40,
-    0xBF, 0x00, 0x00, 0xBD, 0x02, 0xFD, 0x5A, 0xAB, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0xBF, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x2F,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00,
-    0x0B, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0xFF, 0xFC, 0x0F,
-    0xC0, 0xBF, 0xFF, 0xE0, 0x3D, 0x00, 0x5F, 0xF4, 0x01, 0xF0, 0x00, 0x2F, 0xC0, 0x07, 0x80, 0x00,
-    0xBF, 0x00, 0x1C, 0x00, 0x02, 0xFC, 0x00, 0x10, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1D, 0x02, 0xFC, 0x00,
-    0x00, 0xF8, 0x0B, 0xF0, 0x00, 0x03, 0xD0, 0x2F, 0xC0, 0x00, 0x2F, 0x40, 0xBF, 0x56, 0xAA, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x54, 0x01, 0x02, 0xFF, 0xC0,
-    0xBC, 0x7F, 0xFC, 0x0B, 0xC0, 0x6F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80, 0x1F, 0xC0, 0xF4, 0x01,
-    0xFC, 0x0F, 0x00, 0x1F, 0xC0, 0xD0, 0x01, 0xFC, 0x04, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x01, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x00, 0x0B, 0xD0, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x74, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0x0F, 0x40,
-    0xBF, 0x00, 0x00, 0xBD, 0x02, 0xFD, 0x5A, 0xAB, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x06,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x10, 0x01, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xFC, 0x01, 0xFC, 0x03, 0xFC, 0x01,
-    0xFC, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x40, 0x00, 0x00, 0x2F, 0xC2, 0xF0, 0x00, 0x00, 0x0B, 0xFB, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x02, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x07, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0xF4, 0x00,
-    0xBF, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0xD5, 0xAA, 0xBF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xF0, 0x00, 0x06, 0xFC,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x1F, 0xC2, 0x40, 0x07, 0xF3, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x1F,
-    0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0x7F, 0x00, 0x0A, 0x1F, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0x80, 0x7F, 0xF4, 0x00, 0x01, 0x7F, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x2F, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x2F, 0xC0, 0x00, 0x2F,
-    0x00, 0x02, 0xF0, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x07, 0xF4, 0x00, 0x2F, 0x00, 0x02, 0xF0,
-    0x2F, 0xC0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x07, 0xF8, 0x02,
-    0xF0, 0x00, 0x2F, 0x00, 0x2F, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0x03, 0xF8, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0xD2, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0xFF,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xFA, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x1F, 0xF0, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0B, 0xF8, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xCF, 0xFF,
-    0xFE, 0x00, 0x2B, 0xFF, 0xF9, 0x6F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0xFD, 0x00,
-    0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0,
-    0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD,
-    0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x00, 0x17, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBF, 0x40, 0x00, 0x2F, 0x00, 0x02, 0xF2, 0xFC, 0x00,
-    0x02, 0xF0, 0x00, 0x2F, 0x0F, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x7F, 0x40, 0x02, 0xF0, 0x00,
-    0x2F, 0x02, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x0F, 0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x7F,
-    0x80, 0x2F, 0x00, 0x02, 0xF0, 0x02, 0xFD, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xF0, 0x2F, 0x00,
-    0x02, 0xF0, 0x00, 0x3F, 0x82, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xFD, 0x2F, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0xF2, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xAF, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0x82, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFC, 0xFF, 0xFF, 0xE0, 0x02, 0xBF, 0xFF, 0x96, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02,
-    0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x1F, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xD3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xCB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x7F, 0xF4, 0x00, 0x01, 0x7F, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x2F, 0xC0, 0x00,
-    0x2F, 0x00, 0x02, 0xF0, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x07, 0xF4, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x2F, 0xC0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x07, 0xF8,
-    0x02, 0xF0, 0x00, 0x2F, 0x00, 0x2F, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0x02, 0xF0, 0x00,
-    0x2F, 0x00, 0x03, 0xF8, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0xD2, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0xFF, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xFA, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF0, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF4, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0B, 0xF8, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xCF,
-    0xFF, 0xFE, 0x00, 0x2B, 0xFF, 0xF9, 0x6F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0xFD,
-    0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x3D, 0x00, 0x2F, 0xD0, 0xBF, 0xFD, 0x00, 0x2E, 0x00, 0x7F, 0xF9, 0xFF, 0xFF, 0xD0, 0x01, 0x00,
-    0x0B, 0xFF, 0xFD, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x17, 0xF4, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBF, 0x00,
-    0x00, 0x2F, 0x00, 0x02, 0xF3, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x0F, 0xE0, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x7F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x0F,
-    0xE0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x7F, 0x40, 0x2F, 0x00, 0x02, 0xF0, 0x02, 0xFC, 0x02, 0xF0,
-    0x00, 0x2F, 0x00, 0x0F, 0xE0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x42, 0xF0, 0x00, 0x2F, 0x00,
-    0x01, 0xFC, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xE2, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x6F,
-    0x00, 0x02, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x2F, 0xE0, 0xBF, 0xFE, 0x03, 0xFF, 0xCF, 0xFF, 0xFE, 0x0A, 0xFF, 0xFE,
-    0x5B, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0xF4, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00, 0x3F,
-    0x80, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x0F,
-    0xD0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x03, 0xF4, 0x00,
-    0x0B, 0xE0, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0xBE, 0x1B, 0xFF, 0xE0, 0x02, 0xF8,
-    0xFF, 0xFF, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x55,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40,
-    0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0xC7,
-    0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00,
-    0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0x3F,
-    0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0xC0, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xF9, 0x5F, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD,
-    0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x07, 0x00, 0x01, 0xF8, 0x01, 0xF0, 0x00, 0x0F, 0xFA, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40,
-    0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0xC7,
-    0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00,
-    0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0x3F,
-    0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x03, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x00, 0x00,
-    0xBF, 0x81, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xD0, 0x00,
-    0x00, 0x02, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4,
-    0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x07, 0xF0, 0xBE, 0x00,
-    0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x1F, 0x82, 0xF4, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x3C, 0x07,
-    0x80, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x0F,
-    0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB, 0xF0,
-    0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x1F,
-    0xC7, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xF8,
-    0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFA, 0x5B, 0xFE, 0xAA, 0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xBC, 0x03, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x38, 0x1F, 0xD0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0x03, 0xFE, 0xAA,
-    0xA4, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x80,
-    0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1E, 0x0B, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xE0, 0x3F,
-    0xF0, 0x00, 0x3F, 0x40, 0x00, 0x3E, 0x00, 0xFF, 0xF5, 0x03, 0xF9, 0x5A, 0xAF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x15,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x2F,
-    0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x0B, 0xF4, 0x1B, 0xFB, 0xF8, 0x07, 0xFC,
-    0x1F, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0xFD, 0x3F, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x3F, 0xD5, 0x55, 0xFE, 0xBF, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFD, 0xBF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x07,
-    0xFF, 0xFF, 0x95, 0xAC, 0x0B, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x40, 0x7F,
-    0xFF, 0xE0, 0x00, 0x16, 0x90, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x7F, 0xC0, 0x6F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0xFE,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xC0,
-    0x0B, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0xBF, 0x81, 0xFF, 0x8F, 0xFF, 0x1F, 0xFE, 0x2B, 0xFD, 0xFF, 0xF4,
-    0x03, 0xFF, 0x40, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x7F, 0xC0, 0x6F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0xFE,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xC0,
-    0x0B, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x2F,
-    0xE0, 0x7F, 0xE3, 0xFF, 0xC7, 0xFF, 0x8A, 0xFF, 0x7F, 0xFD, 0x00, 0xFF, 0xD0, 0x20, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x7F, 0xC0,
-    0x6F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x02, 0xFC,
-    0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0xC0, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x02,
-    0xFE, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x00,
-    0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00,
-    0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xD0, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x02, 0x00, 0x02, 0x40, 0x3F, 0x00, 0x7E, 0x00, 0x7E,
-    0x03, 0xF0, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0xFE, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0xBF, 0x81, 0xFF,
-    0x8F, 0xFF, 0x1F, 0xFE, 0x2B, 0xFD, 0xFF, 0xF4, 0x03, 0xFF, 0x40, 0x80, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x5B, 0xFC, 0x0F, 0xD0, 0x00,
-    0xFC, 0x1F, 0xC0, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0xB0, 0x2F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x04, 0x00, 0x02,
-    0xFD, 0x3C, 0x00, 0x00, 0xFD, 0x7D, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03,
-    0xFC, 0x7F, 0xD0, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x90,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x0F, 0x80, 0x1F, 0x81, 0xF4,
-    0x00, 0xB8, 0x2F, 0x40, 0x07, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xC1, 0xC0, 0x01, 0xFC, 0x3C, 0x00,
-    0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x2F, 0x83, 0xFF, 0xBF, 0xF0, 0x1F, 0xFF, 0xF8, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0xBE, 0x1F, 0xD0, 0x02, 0xF8, 0x03, 0xF0, 0x02, 0xD0, 0x00, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFD, 0x5B, 0xFC, 0x0F, 0xD0, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0xF8, 0x2F,
-    0xC0, 0x00, 0xB0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x0B, 0xFC, 0x04, 0x00, 0x02, 0xFD, 0x3C, 0x00, 0x00, 0xFD, 0x7D, 0x00, 0x00, 0xFD, 0x7E,
-    0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0xD0, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xF8, 0xFD, 0x00, 0x3E, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0x00,
-    0x60, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xF8, 0x0F, 0x80, 0x1F, 0x81, 0xF4, 0x00, 0xB8, 0x2F, 0x40, 0x07, 0x01, 0xFD, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFF,
-    0xC1, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x2F, 0x83, 0xFF,
-    0xBF, 0xF0, 0x1F, 0xFF, 0xF8, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x5B, 0xFC, 0x0F, 0xD0, 0x00, 0xFC, 0x1F, 0xC0, 0x00,
-    0xFC, 0x2F, 0x80, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0xB0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x04, 0x00, 0x02, 0xFD, 0x3C, 0x00, 0x00,
-    0xFD, 0x7D, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0xD0, 0x1F,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x80, 0xF8, 0x01, 0xF8, 0x1F, 0x40, 0x0B, 0x82, 0xF4,
-    0x00, 0x70, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x1C, 0x00, 0x1F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00,
-    0x0F, 0xC3, 0xF4, 0x02, 0xF8, 0x3F, 0xFB, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x24, 0x00, 0x00, 0x01, 0x00, 0x00, 0x50,
-    0x0B, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xFD, 0x3F, 0x40, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x5B, 0xFC, 0x0F, 0xD0, 0x00, 0xFC,
-    0x1F, 0xC0, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0xB0, 0x2F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x04, 0x00, 0x02, 0xFD,
-    0x3C, 0x00, 0x00, 0xFD, 0x7D, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xFC,
-    0x7F, 0xD0, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x90, 0x00,
-    0x05, 0x00, 0x09, 0x01, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0xBD, 0x00, 0x7F, 0x1F, 0x80, 0x02, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x0F, 0x80, 0x1F, 0x81, 0xF4, 0x00,
-    0xB8, 0x2F, 0x40, 0x07, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xC1, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x2F, 0x83, 0xFF, 0xBF, 0xF0, 0x1F, 0xFF, 0xF8, 0x00, 0x05,
-    0x54, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFA, 0xAF, 0xFA,
-    0xAF, 0xF2, 0xF0, 0x02, 0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xBF, 0x00, 0x2F, 0x2E, 0x00, 0x2F, 0xC0,
-    0x07, 0xC7, 0x40, 0x0B, 0xF0, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xF6, 0xAF, 0xFA, 0xA8, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF9, 0x56, 0x00, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xC0, 0x00, 0x55, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x10, 0x00, 0x04, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x00,
-    0xBF, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFE, 0xAB, 0xFE, 0xAB, 0xFC, 0xBC, 0x00,
-    0xBF, 0x00, 0x2F, 0x2F, 0x00, 0x2F, 0xC0, 0x0B, 0xCB, 0x80, 0x0B, 0xF0, 0x01, 0xF1, 0xD0, 0x02,
-    0xFC, 0x00, 0x74, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x04, 0x1F, 0x00, 0x0F, 0x87, 0x80, 0x07, 0xE1,
-    0xC0, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xBF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFD, 0xAB, 0xFE,
-    0xAA, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFE, 0x55, 0x80, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x00,
-    0x15, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFA, 0xAF, 0xFA,
-    0xAF, 0xF2, 0xF0, 0x02, 0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xBF, 0x00, 0x2F, 0x2E, 0x00, 0x2F, 0xC0,
-    0x07, 0xC7, 0x40, 0x0B, 0xF0, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0x5F, 0xF5, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x2A, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xF6, 0xAF, 0xFA, 0xA8, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B,
-    0xE0, 0x00, 0x6B, 0xFE, 0xA8, 0x2F, 0xFF, 0xFF, 0x45, 0x7F, 0x95, 0x40, 0x0B, 0xE0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF9, 0x56, 0x00, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xC0, 0x00, 0x55, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x3C, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xC2, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xA0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x6F, 0xD0, 0x00, 0x01, 0xBF, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x56, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x3D, 0x00, 0x00, 0x03,
-    0xE7, 0xFF, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE,
-    0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x01, 0x54,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x81, 0xBF, 0x40, 0x00, 0x06,
-    0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x5B,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x0B, 0xFF,
-    0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-    0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x0B,
-    0x40, 0x00, 0x00, 0x03, 0xFD, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF7, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xF8, 0x1B, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x01,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xFF, 0xAF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE,
-    0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x01, 0x54,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x06, 0xFD,
-    0x00, 0x00, 0x1B, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
-    0xFF, 0x95, 0x6F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01,
-    0xBF, 0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE,
-    0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F,
-    0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8,
-    0x3F, 0xFC, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0C, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x1F,
-    0xC0, 0x3F, 0x40, 0x00, 0x00, 0x02, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFE, 0x06, 0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x95, 0x6F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x01, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC3, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0x40, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1B,
-    0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x02, 0xFE,
-    0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0x83,
-    0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xE0, 0x6F, 0xD0, 0x00, 0x01, 0xBF, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x56, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8,
-    0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00,
-    0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF,
-    0xC0, 0x02, 0xFF, 0xF8, 0x2F, 0xFC, 0x00, 0x01, 0x54, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF9, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xFE,
-    0x07, 0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80,
-    0x02, 0xFB, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF7, 0xF0, 0x00, 0xBD, 0x00, 0x00,
-    0x1F, 0xC0, 0x03, 0xD3, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xC2, 0xF8, 0x01, 0xF8,
-    0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xC1, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0x80, 0xFD,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0x00, 0xBE, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x2F,
-    0x00, 0x7F, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x3E, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x7D, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0xBC, 0x00, 0x1F, 0xCF, 0x40, 0x00,
-    0x00, 0x00, 0x7E, 0xF8, 0x00, 0x0F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0xF0, 0x01, 0xFF, 0xF8, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0x7F, 0xFE, 0x0B, 0xF4, 0x00,
-    0x2F, 0x80, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x07, 0xFD,
-    0x00, 0x2F, 0x40, 0x07, 0xF0, 0x02, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xFB, 0xF0, 0x03,
-    0xE0, 0x00, 0x3F, 0x80, 0x7C, 0xFD, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0x1F, 0x80, 0xFC, 0x00,
-    0x00, 0xFC, 0x0F, 0x43, 0xF0, 0x3D, 0x00, 0x00, 0x2F, 0x47, 0xC0, 0xBD, 0x1F, 0x00, 0x00, 0x07,
-    0xE2, 0xE0, 0x1F, 0x8F, 0x80, 0x00, 0x00, 0xFC, 0xF4, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0x2F, 0xBC,
-    0x00, 0xBE, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x7E, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xCB, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0x06, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xE0, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xE0,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xC7,
-    0xF0, 0x00, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x00, 0x24, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE,
-    0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03,
-    0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F,
-    0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1,
-    0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xE0, 0x00, 0x00,
-    0x0F, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xC1, 0xBF, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00,
-    0x01, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x03,
-    0xF8, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xCB, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD4, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xAA, 0xAF,
-    0xFC, 0x3F, 0x00, 0x00, 0xBF, 0x03, 0xD0, 0x00, 0x1F, 0xD0, 0x3C, 0x00, 0x03, 0xF8, 0x01, 0x80,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1C,
-    0x0B, 0xF4, 0x00, 0x03, 0xD1, 0xFE, 0x00, 0x00, 0x3D, 0x3F, 0xC0, 0x00, 0x0B, 0xDB, 0xFA, 0xAA,
-    0xAA, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3E, 0x55, 0x5F,
-    0xE1, 0xF0, 0x00, 0xFF, 0x07, 0x80, 0x0B, 0xF0, 0x09, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0xD0, 0xFE, 0x00, 0x0B, 0x8B, 0xF0, 0x00, 0x3D, 0x7F, 0x55, 0x57, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xAA, 0xFF, 0xC3, 0xF0, 0x00, 0x0B, 0xF0, 0x3D,
-    0x00, 0x01, 0xFD, 0x03, 0xC0, 0x00, 0x3F, 0x80, 0x18, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xC0, 0xBF, 0x40, 0x00, 0x3D, 0x1F, 0xE0,
-    0x00, 0x03, 0xD3, 0xFC, 0x00, 0x00, 0xBD, 0xBF, 0xAA, 0xAA, 0xAF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xE5,
-    0x55, 0xFE, 0x1F, 0x00, 0x0F, 0xF0, 0x78, 0x00, 0xBF, 0x00, 0x90, 0x07, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0xFE, 0x00, 0x0D, 0x0F, 0xE0, 0x00, 0xB8, 0xBF, 0x00, 0x03, 0xD7, 0xF5, 0x55, 0x7F, 0x7F,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00,
-    0x3D, 0x00, 0x2F, 0x40, 0x03, 0xF8, 0x0B, 0xE0, 0x00, 0x0F, 0xE2, 0xF8, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xAA, 0xAF,
-    0xFC, 0x3F, 0x00, 0x00, 0xBF, 0x03, 0xD0, 0x00, 0x1F, 0xD0, 0x3C, 0x00, 0x03, 0xF8, 0x01, 0x80,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1C,
-    0x0B, 0xF4, 0x00, 0x03, 0xD1, 0xFE, 0x00, 0x00, 0x3D, 0x3F, 0xC0, 0x00, 0x0B, 0xDB, 0xFA, 0xAA,
-    0xAA, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x06, 0x40, 0x3E, 0x00, 0x7E, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xFD, 0x3F, 0x00, 0x00,
-    0xFE, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3E, 0x55, 0x5F,
-    0xE1, 0xF0, 0x00, 0xFF, 0x07, 0x80, 0x0B, 0xF0, 0x09, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0xD0, 0xFE, 0x00, 0x0B, 0x8B, 0xF0, 0x00, 0x3D, 0x7F, 0x55, 0x57, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x2F, 0x80, 0x3E, 0x00, 0x3F, 0x00, 0x08, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xA0, 0x07, 0xE0, 0x2F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0x80, 0x1F, 0x00,
-    0x00, 0x00, 0xD0, 0x0B, 0xD0, 0x7F, 0x43, 0xF8, 0x2F, 0xC1, 0xF8, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x0B, 0xD3, 0xF4, 0x0F, 0x80,
-    0xFC, 0x3F, 0x00, 0x7C, 0x18, 0x00, 0x14, 0x01, 0x00, 0x00, 0x1F, 0xF0, 0x3C, 0x3F, 0xFC, 0x7C,
-    0x3E, 0x7F, 0xFC, 0x3C, 0x1F, 0xF8, 0x04, 0x02, 0x90, 0x1A, 0xAA, 0xA4, 0x3F, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0C, 0x3F, 0x00, 0x3C, 0x3F, 0xEA,
-    0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0x40, 0x1F, 0x43, 0xFC, 0x3F, 0xC3, 0xFC, 0x05, 0x00, 0x15,
-    0x00, 0x14, 0x7F, 0x41, 0xFD, 0xBF, 0x82, 0xFE, 0x7F, 0x01, 0xFD, 0x04, 0x00, 0x10, 0x01, 0x54,
-    0x00, 0xFF, 0xF4, 0x3F, 0xAF, 0xC3, 0xD0, 0xBD, 0x3C, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x7F, 0x00,
-    0x3F, 0x40, 0x01, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0x83, 0xE0,
-    0xBC, 0x3C, 0x07, 0xC3, 0xD0, 0x3C, 0x3F, 0x0B, 0xC1, 0xFF, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x14, 0x02, 0xF0, 0x3E, 0x03, 0xF0, 0x7F, 0x0B, 0xE0, 0xFD, 0x0F, 0xC2, 0xF8, 0x2F,
-    0x03, 0xF0, 0x3C, 0x07, 0xC0, 0x00, 0x01, 0x00, 0x14, 0x00, 0x24, 0x7C, 0x00, 0xFC, 0x3F, 0x02,
-    0xF4, 0x1F, 0xC7, 0xE0, 0x0B, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x02, 0x00, 0xBC, 0x0F, 0x80, 0xFD, 0x0F, 0xC0, 0x7F, 0x0B, 0xE0, 0x2F, 0x83, 0xF0, 0x0F,
-    0xC0, 0xF8, 0x03, 0xD0, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xF8, 0x3F, 0x46, 0xFC, 0x38, 0x00, 0xBC, 0x20, 0x00, 0x24, 0x02, 0x80, 0xBC, 0x1F, 0x43, 0xF0,
-    0x7E, 0x0B, 0xE0, 0xBF, 0x07, 0xFC, 0x1F, 0x80, 0x19, 0x07, 0xF8, 0x3F, 0xC0, 0xFC, 0x0F, 0xC0,
-    0xF8, 0x2F, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x06, 0x42, 0xFD, 0x3F, 0xC3, 0xF0, 0x3F, 0x02, 0xF0,
-    0x0F, 0x80, 0xBC, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x3F, 0x3F, 0x3D, 0x7C, 0x78, 0x70, 0x10, 0x0B,
-    0x40, 0xFC, 0x0F, 0xD0, 0xFC, 0x3F, 0x47, 0xD0, 0x60, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0xC3,
-    0xFC, 0x2F, 0x80, 0x00, 0x2E, 0x00, 0xB8, 0xBF, 0x41, 0xFE, 0xBF, 0x42, 0xFE, 0x3F, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0xF4, 0x3E, 0xBC, 0xB8, 0x2E, 0xB8, 0x2E, 0x7D, 0x7D, 0x2F,
-    0xF8, 0x06, 0x40, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0xFC, 0x0F, 0xC1, 0xF4, 0x3E, 0x02, 0x40, 0x04,
-    0x07, 0xFC, 0x7F, 0xF0, 0x3F, 0x07, 0xE0, 0xFC, 0x7F, 0x02, 0x40, 0x00, 0x10, 0x07, 0xC0, 0x2F,
-    0x00, 0x3E, 0x00, 0x7E, 0x00, 0x7F, 0x94, 0x3F, 0xFD, 0x07, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xEA, 0x00, 0x19, 0x00, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x03, 0xF7, 0xF0, 0x0F, 0xC0, 0xFC,
-    0x3F, 0x00, 0x7C, 0x04, 0x00, 0x10, 0x14, 0x00, 0x08, 0x3D, 0x00, 0x2C, 0x3F, 0x80, 0xBC, 0x2F,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x69, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xF0, 0x3C, 0x3F, 0xFC,
-    0x7C, 0x3E, 0x7F, 0xFC, 0x3C, 0x0F, 0xF8, 0x04, 0x01, 0x90, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8, 0x3F,
-    0x46, 0xFC, 0x38, 0x00, 0xBC, 0x20, 0x00, 0x24, 0x00, 0x00, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x64, 0xBF, 0x41, 0xFE, 0xBF, 0x82, 0xFE, 0x7F, 0x01, 0xFD, 0x04, 0x00, 0x10, 0x68,
-    0x0B, 0xC0, 0xBC, 0x0B, 0xE0, 0x7F, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0xFF, 0xAA, 0xAB,
-    0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xC0, 0x00, 0x1D, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xAA, 0xA4,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00, 0x3E, 0x02, 0xFC, 0x00,
-    0x01, 0xF4, 0x0B, 0xF5, 0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x7F,
-    0xC0, 0xFF, 0x00, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81,
-    0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0,
-    0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02,
-    0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F,
-    0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFA, 0xAF, 0xFA, 0xAF, 0xF0, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xFD,
-    0x00, 0x3E, 0x00, 0x2E, 0x00, 0x3F, 0x40, 0x0F, 0x40, 0x07, 0x40, 0x0F, 0xD0, 0x01, 0x40, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x45,
-    0x54, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0xFE, 0x41, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xD0, 0x00,
-    0x1F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x7F, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x1F, 0xC0, 0x07, 0xFF,
-    0xFF, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x5B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFC, 0x5F,
-    0xFA, 0xAF, 0xFF, 0x02, 0xFC, 0x00, 0x1F, 0x80, 0xBF, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0xF4,
-    0x0B, 0xF0, 0x00, 0x3D, 0x02, 0xFC, 0x00, 0x06, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x02, 0xFD, 0x00, 0x02,
-    0xF4, 0x07, 0xF4, 0x00, 0x01, 0xF4, 0x0F, 0xE0, 0x00, 0x00, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0xF0,
-    0x2F, 0x80, 0x00, 0x00, 0x50, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xAA, 0xBF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x38, 0x1F, 0xF0, 0x00, 0x00, 0x7D, 0x0B, 0xFC, 0x00, 0x01,
-    0xFD, 0x03, 0xFF, 0x90, 0x1B, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFD, 0x5B, 0xFC, 0x0F, 0xD0, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0xFC, 0x2F, 0x80, 0x00,
-    0xF8, 0x2F, 0xC0, 0x00, 0xB0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x04, 0x00, 0x02, 0xFD, 0x3C, 0x00, 0x00, 0xFD, 0x7D, 0x00, 0x00,
-    0xFD, 0x7E, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0xD0, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0x81, 0x7F,
-    0xD0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0x02, 0xFD, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBD, 0x7F,
-    0x81, 0xFF, 0x7F, 0x81, 0xFF, 0x2F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x05, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x40,
-    0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x00, 0x5F, 0xF4,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x5F, 0xFA, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x02, 0xFE, 0x95, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xF0, 0x00,
-    0xBE, 0x00, 0x6F, 0xF0, 0x00, 0x0B, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x00, 0x0B, 0xC0, 0x00, 0xBE,
-    0x00, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF0, 0x02, 0xF4, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x8E, 0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x03, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0x55,
-    0xBF, 0xD2, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
-    0x40, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x17, 0xFD, 0x00, 0x01, 0x7F, 0x80, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFD, 0x55, 0x55, 0x7F, 0x96, 0xBF,
-    0xF8, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0xFD, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0xFE, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x01,
-    0xFD, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x95, 0x7F,
-    0xF0, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFA, 0xAF, 0xFA, 0xAF, 0xF0, 0x00, 0x2F, 0x00, 0x3F,
-    0x40, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x03, 0xF4, 0x00, 0xF4,
-    0x00, 0x07, 0x40, 0x0F, 0xD0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x05, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x94, 0x1B, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xC0,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x0B, 0xFF,
-    0xFE, 0x00, 0x3F, 0xF0, 0x05, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xD5, 0x00,
-    0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x3E, 0x00,
-    0x00, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0xBC,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF0,
-    0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x02,
-    0xFC, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00,
-    0x00, 0xBF, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0F,
-    0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xF4, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0xFC, 0xBF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0x01, 0xBF,
-    0x40, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFB,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x2F,
-    0xC0, 0x0F, 0xD0, 0x7F, 0x00, 0x02, 0xFC, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0xFD, 0x00,
-    0x7F, 0x00, 0x02, 0xFC, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x7F, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x07, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xCB, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x00,
-    0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFD, 0x0B,
-    0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
-    0x01, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xD0, 0x00, 0x00,
-    0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x30, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x81,
-    0x7F, 0xD0, 0x00, 0x17, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x02, 0xFE, 0x95, 0x56, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x7F, 0xEA, 0xAF, 0xF8, 0x00, 0xBF, 0x00, 0x03, 0xE0, 0x02, 0xFC,
-    0x00, 0x0F, 0x40, 0x0B, 0xF0, 0x00, 0x2C, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x90, 0x00,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x02, 0xFC, 0x01, 0xBF, 0xE0, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x2F, 0xC0,
-    0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x02, 0xF8, 0x0B, 0xF0, 0x00, 0x0F,
-    0xE0, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x07, 0xFC, 0x02, 0xFD, 0x55, 0xFF, 0xC1, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x05, 0xFF, 0x00, 0xBF, 0xC0,
-    0x02, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x00, 0xBE, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0xBF,
-    0x00, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x0B,
-    0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xF0, 0x56, 0xFF, 0x40,
-    0x2F, 0xC0, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x0B, 0xF0,
-    0x00, 0x0F, 0xD0, 0x2F, 0xC0, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x2F,
-    0xE0, 0x0B, 0xF5, 0x5B, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF1, 0x7F, 0xEA, 0xBF,
-    0xFC, 0x0B, 0xF0, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x03, 0xD0, 0x2F, 0xC0,
-    0x00, 0xF4, 0x0B, 0xF0, 0x00, 0x18, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x05, 0xBF, 0xAA, 0xFF, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x7F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x7F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x06, 0xFE,
-    0x55, 0x5A, 0xBF, 0x50, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x08, 0x00, 0x00, 0x00, 0x00, 0x24, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00,
-    0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0,
-    0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xC0, 0x1F, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0xE0, 0x02, 0x6F, 0x80, 0x03, 0xF4, 0x00, 0x7F,
-    0x54, 0x00, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x1F,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xF4, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xFD, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F, 0x42,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3F,
-    0x41, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x03,
-    0xF4, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x40,
-    0x03, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0xFE, 0x40, 0x07, 0xFD, 0x00, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFD, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x07, 0xFE, 0x1A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0x90, 0x2F, 0xF0, 0x2F, 0x40, 0x01, 0xFE, 0x0B, 0xC0, 0x00, 0x3F,
-    0x82, 0xF0, 0x00, 0x0B, 0xE0, 0x78, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x01,
-    0xAB, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x0F, 0xF2, 0xC0, 0x00, 0x03, 0xF9, 0xF4, 0x00, 0x01, 0xFD, 0xFF, 0x00, 0x00, 0xFF,
-    0x2F, 0xF4, 0x01, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x1A, 0x94,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17,
-    0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x2F, 0xC0, 0x03,
-    0xF4, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x7F, 0x00,
-    0x02, 0xFC, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0xFD,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xF0,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x07, 0xFF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17, 0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x7F, 0x00, 0x02, 0xFC, 0x00,
-    0xFD, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x7F, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x07, 0xF0,
-    0x00, 0x2F, 0xC3, 0xF4, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x7F,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x0B, 0xF4, 0x07, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x0B, 0xFF, 0xFE,
-    0x00, 0x3F, 0xF0, 0x05, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xD5, 0x00, 0x0B,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x3E, 0x00, 0x00,
-    0x02, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0xBC, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x3F,
-    0x80, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC,
-    0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x00,
-    0xBF, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF4,
-    0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xF4, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x05,
-    0xFF, 0xAA, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x7F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x7F, 0x00, 0x38, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0x40,
-    0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xD0, 0x00, 0x3F, 0xFF, 0xFC, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x3E, 0xFC, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x03, 0xCF, 0xD0, 0x00, 0x7C, 0xFC, 0x00, 0x00,
-    0x7C, 0xBE, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x07, 0xC7, 0xF0, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0xBC,
-    0x3F, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x0B, 0xC2, 0xF8, 0x03, 0xE0, 0xFD, 0x00, 0x00, 0xBC, 0x1F,
-    0xC0, 0x3C, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0xFC, 0x0B, 0xC0, 0xBD, 0x00, 0x00, 0xF8, 0x0B, 0xD0,
-    0xF8, 0x0B, 0xE0, 0x00, 0x0F, 0x80, 0x3F, 0x0F, 0x00, 0x7E, 0x00, 0x00, 0xF4, 0x03, 0xF2, 0xF0,
-    0x07, 0xE0, 0x00, 0x0F, 0x40, 0x2F, 0x7D, 0x00, 0x7F, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x03,
-    0xF0, 0x00, 0x1F, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xF8, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17, 0xFD, 0x00, 0x00,
-    0x1B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA,
-    0xAA, 0xAB, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F,
-    0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F,
-    0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B,
-    0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00,
-    0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x7F, 0xFA, 0xAA, 0xAB, 0xFE, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xE4, 0x1F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0x01, 0x7F, 0xC0, 0x6F, 0xFC, 0x02, 0xFC, 0x00,
-    0x3F, 0xD0, 0x2F, 0xC0, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0xBE, 0x02,
-    0xFC, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x07,
-    0xF4, 0x02, 0xFD, 0x5B, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B, 0xFC, 0x01, 0xFE, 0x00, 0x03, 0xF0, 0x0F,
-    0xD0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0xB4, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x0B, 0xFF, 0xFA, 0xAF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFA, 0xAF, 0xFA, 0xAF, 0xF2, 0xF0, 0x02,
-    0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xBF, 0x00, 0x2F, 0x2E, 0x00, 0x2F, 0xC0, 0x07, 0xC7, 0x40, 0x0B,
-    0xF0, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0xBF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0,
-    0x07, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x30, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x5B, 0xF5, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xEF, 0xFB, 0xFF,
-    0xC0, 0x0B, 0xF8, 0x07, 0xE0, 0x1F, 0xF0, 0x2F, 0xD0, 0x07, 0xE0, 0x03, 0xFC, 0x3F, 0x80, 0x07,
-    0xE0, 0x01, 0xFD, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFE, 0xBF, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xBF,
-    0x00, 0x07, 0xE0, 0x00, 0xFF, 0xBF, 0x00, 0x07, 0xE0, 0x00, 0xFE, 0x7F, 0x40, 0x07, 0xE0, 0x00,
-    0xFD, 0x3F, 0xC0, 0x07, 0xE0, 0x03, 0xFC, 0x1F, 0xF0, 0x07, 0xE0, 0x0B, 0xF4, 0x0B, 0xFE, 0x07,
-    0xE0, 0x7F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x06, 0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00,
-    0xBF, 0x80, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x2F, 0xFF, 0xF4,
-    0x02, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0x17, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x02, 0xFE, 0x95, 0x56, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x6F,
-    0xD0, 0x00, 0x6F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF4, 0x00,
-    0x1F, 0xC0, 0x00, 0x1F, 0xF9, 0x55, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0xBF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xAF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF, 0xD1, 0x7F, 0xC0, 0x01, 0xBF, 0x80, 0x01, 0xFF,
-    0x40, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B,
-    0xE0, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0xBE, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00,
-    0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00,
-    0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x3F,
-    0x00, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x03,
-    0xF0, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x02, 0xFE, 0xA5,
-    0x57, 0xF9, 0x56, 0xAF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xD0, 0xBF, 0xFF, 0xC0, 0xFF, 0xFF, 0x8B, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF4, 0x17, 0xFC, 0x00, 0x1B, 0xF8, 0x00, 0x1F, 0xF4, 0x00,
-    0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B,
-    0xE0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00,
-    0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x03,
-    0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02,
-    0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00,
-    0x02, 0xFE, 0xA5, 0x57, 0xF9, 0x56, 0xAF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xAA, 0xFF, 0x40, 0x00, 0x00, 0xBC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x74, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xA5, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF,
-    0x55, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xAF, 0xFF, 0xF8, 0x00,
-    0x00, 0xFF, 0xFF, 0xD1, 0x7F, 0xD0, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xA5, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0xBF,
-    0xC0, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x0F, 0xE0,
-    0x00, 0xBF, 0x00, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x0B,
-    0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x02, 0xFD, 0x56, 0xFF, 0x80, 0x0F, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xEB, 0xFF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFA,
-    0x55, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFC, 0x00, 0x7F,
-    0xE0, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0xFE, 0x02,
-    0xFC, 0x00, 0x02, 0xF8, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0xBF, 0x00,
-    0x07, 0xFC, 0x02, 0xFD, 0x55, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xF9, 0x5B, 0xFF, 0x40, 0x1F, 0x80, 0x00, 0x7F, 0xD0, 0x1F, 0x40,
-    0x00, 0x1F, 0xF0, 0x1F, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0A, 0xAA, 0xAA, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1D,
-    0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x3F, 0xF4,
-    0x06, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x5F, 0xF4, 0x00, 0x0F, 0xFD,
-    0x5B, 0xFF, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF4,
-    0x00, 0x02, 0xFF, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xAA,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xF0,
-    0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x0B,
-    0xF0, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xE0, 0x00,
-    0xBF, 0x40, 0x03, 0xFF, 0x90, 0x6F, 0xE0, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x57,
-    0xFD, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x02, 0xF8, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0x80, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x00,
-    0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xE0, 0x02, 0xF8, 0x00, 0x00, 0xBF,
-    0xFA, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0xFD, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0x80, 0x00, 0x07, 0xF4, 0x02, 0xF8, 0x00, 0x00,
-    0xFF, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0xC0, 0x02, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0x80, 0x02,
-    0xFF, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x07, 0xFF, 0xFE, 0x3F, 0xE0, 0x00, 0xFF, 0xFF, 0xE1,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00,
-    0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07,
-    0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7,
-    0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x57, 0xD0, 0x00, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFC, 0x01, 0xFE, 0x5B, 0xF8,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0xF8, 0x00, 0xFE, 0xFF, 0xFF, 0xD0, 0x7F, 0xF9,
-    0x5B, 0xFD, 0x2F, 0xE0, 0x00, 0x7F, 0xCB, 0xF0, 0x00, 0x07, 0xF6, 0xF8, 0x00, 0x00, 0xFE, 0xBE,
-    0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0xBF,
-    0x3F, 0x40, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x0F, 0xD1, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0xE0, 0x0B,
-    0xF0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xE0, 0x07, 0xF0, 0x0B, 0xF8, 0x03, 0xF0,
-    0x01, 0xFC, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xF8, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xFF,
-    0xFB, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xF0, 0x17, 0xFC, 0x03, 0xF0, 0x00, 0xFE, 0x03, 0xF0,
-    0x00, 0x7E, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0xFD, 0x03, 0xF0, 0x07, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x7F, 0x95, 0xBF, 0x00, 0xFD, 0x00, 0xBC, 0x03, 0xF4, 0x01, 0xF0, 0x0F, 0xD0, 0x03,
-    0x80, 0x3F, 0x40, 0x08, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xBE, 0x56, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0x7E, 0x00, 0x00,
-    0x07, 0xC0, 0x1F, 0x80, 0x00, 0x01, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x7C, 0x01, 0xF8, 0x00, 0x00,
-    0x2E, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x00, 0x03, 0xD0, 0x07, 0xF0, 0x00, 0x01,
-    0xF0, 0x01, 0xFC, 0x00, 0x00, 0xB8, 0x00, 0x7F, 0x00, 0x00, 0x3D, 0x00, 0x1F, 0xC0, 0x00, 0x2F,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0x90, 0x06, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x07, 0x40, 0x00, 0x00, 0x07, 0x41, 0xC0, 0x00,
-    0x00, 0x00, 0xD0, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xF8,
-    0x03, 0xFC, 0x1F, 0x80, 0x03, 0xF4, 0xFC, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x1F, 0x9F, 0xD5, 0x55,
-    0xBE, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xDB, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x6D, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x7F, 0x40, 0x7F, 0xFF, 0x00, 0xBF, 0x01, 0xFF, 0x41, 0xFF, 0xF8, 0x0B, 0xFC, 0x01,
-    0x7F, 0x00, 0x7F, 0x00, 0x7E, 0x50, 0x00, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x03,
-    0xE0, 0x2F, 0x00, 0x00, 0x00, 0xB8, 0x0F, 0x80, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x3E, 0x0B, 0xC0,
-    0x00, 0x00, 0x02, 0xFA, 0xFE, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xBE, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0xF8,
-    0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x03, 0xE0, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x0F, 0x80, 0x3F, 0x80,
-    0x00, 0xFF, 0x00, 0x3E, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x0B, 0xFF, 0x80, 0x7F, 0x80, 0xFF, 0x00,
-    0xBF, 0xFF, 0x00, 0xBF, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x7F, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xE0, 0x0B, 0xF8, 0x34, 0x00, 0x2F, 0x80, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0xFC, 0x00, 0x0B, 0xFF, 0xF0, 0x00,
-    0x01, 0xBF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD2, 0x40, 0x00, 0xFD, 0xBC, 0x00, 0x0F,
-    0xCF, 0xE0, 0x07, 0xF8, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0xBF, 0xFF, 0x6F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0x7F, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x3F,
-    0x00, 0x2F, 0x7F, 0x00, 0x0F, 0xC0, 0x3F, 0x1F, 0xC0, 0x03, 0xF0, 0x3F, 0x07, 0xF0, 0x00, 0xFC,
-    0x3F, 0x01, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7F, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFE,
-    0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0xFD,
-    0x00, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x00, 0x1F,
-    0x80, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0x57, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x6F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x7F, 0x40,
-    0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0xFC, 0x00,
-    0x2F, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x7F, 0x00, 0x0F, 0xC0, 0x3F, 0x1F, 0xC0, 0x03, 0xF0, 0x3F,
-    0x07, 0xF0, 0x00, 0xFC, 0x3F, 0x01, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7F, 0x00, 0x0F, 0xFE, 0x00,
-    0x1F, 0xC0, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00,
-    0x7F, 0x00, 0xBF, 0xFD, 0x00, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x02, 0xFF, 0xFD, 0x00, 0xFE, 0x0B, 0xFF, 0xF0, 0x0F, 0xFC, 0x01, 0xFD, 0x00, 0xBE, 0x50,
-    0x03, 0xF0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x00, 0xFC,
-    0x0F, 0x40, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x47, 0xF0,
-    0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x00,
-    0x3F, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x7F, 0x40, 0x2F, 0xFF, 0x40, 0xBF, 0x42, 0xFF, 0xFD,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x1B, 0xD5, 0x7F, 0x80, 0x00, 0x07, 0xC0, 0x3F, 0x40, 0x00, 0x07, 0xC0, 0x3F,
-    0x40, 0x00, 0x07, 0xC0, 0x3F, 0x40, 0x00, 0x0B, 0x80, 0x3F, 0x40, 0x00, 0x0F, 0x80, 0x3F, 0x40,
-    0x00, 0x0F, 0x40, 0x3F, 0x40, 0x00, 0x0F, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0x00, 0x3F, 0x40, 0x00,
-    0x2F, 0x00, 0x3F, 0x40, 0x00, 0x3D, 0x00, 0x3F, 0x40, 0x20, 0xBC, 0x00, 0x3F, 0x40, 0x7F, 0xF4,
-    0x00, 0x3F, 0x80, 0x7F, 0xF0, 0x02, 0xFF, 0xFC, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x03, 0xFF,
-    0x00, 0x01, 0xFF, 0x80, 0x03, 0xEF, 0x40, 0x03, 0xEF, 0x40, 0x03, 0xDF, 0xC0, 0x07, 0xDF, 0x40,
-    0x03, 0xD7, 0xD0, 0x0F, 0x5F, 0x40, 0x03, 0xD3, 0xF0, 0x0F, 0x1F, 0x40, 0x03, 0xD2, 0xF4, 0x2D,
-    0x1F, 0x40, 0x03, 0xD0, 0xF8, 0x3C, 0x1F, 0x40, 0x03, 0xD0, 0xBC, 0xB4, 0x1F, 0x40, 0x03, 0xD0,
-    0x3F, 0xF0, 0x1F, 0x40, 0x03, 0xD0, 0x2F, 0xE0, 0x1F, 0x40, 0x03, 0xD0, 0x1F, 0xC0, 0x1F, 0x40,
-    0x03, 0xD0, 0x0F, 0x80, 0x1F, 0x40, 0x03, 0xE0, 0x05, 0x00, 0x1F, 0x80, 0x2F, 0xFF, 0x00, 0x01,
-    0xFF, 0xFC, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0xAF, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xD0, 0x7F, 0x80, 0x01, 0xBF, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00,
-    0x07, 0xF0, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x0F, 0xFA, 0xAA,
-    0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x55, 0x56, 0xFC, 0x00, 0x3F, 0x40, 0x00,
-    0x7F, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x01,
-    0xFC, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0xBF, 0xFE, 0x01, 0xFF, 0xFE, 0xBF, 0xFF, 0x80, 0xBF,
-    0xFF, 0x80, 0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0x40, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00,
-    0x2F, 0xC7, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF,
-    0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03,
-    0xF4, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x7F, 0x95, 0x55, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00,
-    0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x00,
-    0xBE, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x02,
-    0xF8, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0xBF, 0xFE, 0x01, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x6F, 0xC1, 0xFF, 0xF8, 0x0B, 0xFF, 0x6F, 0xFF, 0xFC,
-    0x1B, 0xFF, 0xF9, 0x6F, 0xF8, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x2F,
-    0x80, 0x00, 0x3F, 0x80, 0xBE, 0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00,
-    0x0B, 0xF0, 0x2F, 0x80, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0xFE, 0x02, 0xF8, 0x00, 0x03, 0xF4,
-    0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0xBF, 0x90, 0x6F, 0xE0, 0x02, 0xFF,
-    0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x01, 0xFD, 0x07, 0xFC, 0x0F, 0xC0, 0x03,
-    0xF4, 0xBD, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x14, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x6E, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xCB, 0xE9,
-    0xBF, 0x6A, 0xF3, 0xE0, 0x1F, 0xC0, 0x7C, 0xF8, 0x07, 0xF0, 0x0F, 0x2D, 0x01, 0xFC, 0x03, 0xC6,
-    0x00, 0x7F, 0x00, 0x90, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4,
-    0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00,
-    0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8,
-    0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00,
-    0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x10, 0x0F, 0xC0, 0x00, 0x00, 0xB9, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x97, 0xE6, 0xFF,
-    0xC0, 0x0F, 0xE0, 0x0F, 0x80, 0x7F, 0xC0, 0xBE, 0x00, 0x3E, 0x00, 0x7F, 0x43, 0xF0, 0x00, 0xF8,
-    0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xE0, 0x02, 0xFC, 0xBE, 0x00, 0x0F, 0x80, 0x07, 0xF2, 0xF8, 0x00,
-    0x3E, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0xF8, 0x00, 0x7F, 0x1F, 0xC0, 0x03, 0xE0, 0x01, 0xFC, 0x7F,
-    0x00, 0x0F, 0x80, 0x0B, 0xE0, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0x01, 0xFE, 0x00, 0xF8, 0x07, 0xF4,
-    0x02, 0xFF, 0x97, 0xE1, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFA, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00,
-    0x3F, 0xFF, 0x80, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0x2F, 0x80, 0x00,
-    0xFE, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x00, 0x1F, 0xC2, 0xF0, 0x00, 0x00, 0x0B,
-    0xF7, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xEF, 0xD0, 0x00, 0x00, 0x0F, 0x87, 0xF4, 0x00, 0x00, 0x3F, 0x02, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x80, 0x2F, 0xFE, 0x01, 0xFF, 0xFC,
-    0xBF, 0xFF, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x40, 0xFF, 0xFF, 0x2F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80,
-    0x7F, 0x80, 0x01, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x03,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F,
-    0x90, 0x05, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xBF, 0xFF,
-    0x03, 0xFF, 0xFA, 0xFF, 0xF8, 0x0F, 0xFF, 0xD1, 0xBF, 0x00, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0x96, 0xBF, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xAF,
-    0xA7, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x7F,
-    0xFF, 0x0B, 0xFF, 0xC2, 0xFF, 0xF9, 0xFF, 0xF8, 0x3F, 0xFE, 0x0F, 0xFF, 0xD0, 0x7F, 0x40, 0x1F,
-    0xD0, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x40,
-    0x0F, 0xC0, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0x0B, 0xFF, 0xC2, 0xFF, 0xF8, 0x7F, 0xFE, 0x0F, 0xFF, 0x83, 0xFF, 0xF4,
-    0x07, 0xF4, 0x01, 0xFD, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xE9, 0xBF, 0x00,
-    0x00, 0x3E, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x07, 0xF0, 0x00, 0x02, 0xD0, 0x1F, 0xC0, 0x00, 0x01,
-    0x00, 0x7F, 0x15, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFE, 0xBF, 0xF0, 0x00, 0x1F,
-    0xC0, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00,
-    0xFC, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x3F,
-    0x45, 0x40, 0x00, 0xBE, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0x80, 0x03, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xE0, 0x00, 0xFC, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x0F, 0xC0,
-    0x02, 0xF4, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0xBC, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x02, 0xF8,
-    0x00, 0x3F, 0x00, 0x7F, 0x80, 0xBF, 0x00, 0xBF, 0xFF, 0xFF, 0x81, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE,
-    0x40, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xF5, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xAF, 0xF8, 0x03, 0xF0,
-    0x01, 0xFC, 0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x7D, 0x03, 0xF0,
-    0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x1F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF8, 0x0F, 0x80, 0x1F,
-    0xF4, 0x34, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD,
-    0x00, 0xBF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0x55, 0x7F, 0x40, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x03, 0xF0, 0x90, 0x00, 0x1F, 0xCB, 0xC0, 0x00, 0xFD, 0x3F, 0xD0, 0x1F, 0xE0, 0x7F, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x7F, 0x80,
-    0x0F, 0xE0, 0x1F, 0xF0, 0x03, 0xF4, 0x02, 0xF8, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x00, 0x02,
-    0xFC, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0xBD, 0x00, 0x00, 0xFD, 0x03, 0xFA,
-    0xAF, 0xD0, 0x00, 0x0F, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xFD, 0x03, 0xFA, 0xAF, 0xD0, 0x00,
-    0x0F, 0xD0, 0x3F, 0x40, 0xFE, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x3F,
-    0x40, 0x7F, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x2F, 0xE0,
-    0x0F, 0xF0, 0x2F, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFE, 0x41, 0xFD, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x0F,
-    0xC0, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC,
-    0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0xBF, 0x01, 0xFF, 0xFE, 0x2F, 0xD0,
-    0x2F, 0xFF, 0xE0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x1F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x3F, 0xC1, 0xF8, 0x00, 0x3F, 0x4F,
-    0xC0, 0x00, 0xBE, 0x3F, 0x00, 0x01, 0xF9, 0xFD, 0x55, 0x5B, 0xEB, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF,
-    0xFF, 0xFD, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xF9, 0x56, 0xD0, 0xBF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x50, 0x01, 0x40, 0x0F, 0xD0, 0x3F, 0x80, 0x7F, 0x81, 0xFE, 0x01,
-    0xFD, 0x03, 0xF4, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0xFE, 0x00, 0xFF, 0x07, 0xE0, 0x00,
-    0xFD, 0x3F, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x07, 0xE7, 0xF5, 0x55, 0x6F, 0xAF, 0xFF, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xF6, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0x42, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0xFA,
-    0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xAE, 0x40, 0x00, 0x7F, 0x3F, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x41, 0xFF, 0x80, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x7F, 0x00,
-    0x01, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x3F,
-    0x80, 0x7F, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x1F,
-    0xC0, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x00, 0xFD, 0x1F, 0xFF, 0xC0, 0x03, 0xF0, 0xFF, 0xFF, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xF9, 0x5B, 0xF0, 0x0F, 0xD0, 0x0B, 0xC0, 0x3F, 0x40, 0x1F,
-    0x00, 0xFD, 0x00, 0x38, 0x03, 0xF4, 0x00, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x42, 0xF8, 0x00, 0xFF, 0x1F, 0x80, 0x00,
-    0xFC, 0xFC, 0x00, 0x02, 0xD3, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x6A, 0xA8, 0x02,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xFA, 0xAA, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x6E, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF,
-    0x80, 0xF8, 0x01, 0xF8, 0x1F, 0x40, 0x0B, 0x82, 0xF4, 0x00, 0x70, 0x1F, 0xD0, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x1F, 0xFC,
-    0x1C, 0x00, 0x1F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xF4, 0x02, 0xF8, 0x3F, 0xFB,
-    0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x55, 0x40, 0x00, 0x00, 0x10, 0x00, 0x07, 0xF4, 0x00, 0x3F,
-    0xE0, 0x00, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF4, 0x03, 0xFF, 0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xC0, 0x05, 0x00, 0x14, 0x3F, 0x80, 0xFF, 0x7F, 0xC0, 0xFF, 0x3F, 0x80, 0xFE, 0x05, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x06,
-    0xFF, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0x03,
-    0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x0B, 0xFF, 0x80, 0x1B, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00,
-    0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F,
-    0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x02, 0xFD, 0x01, 0xFF, 0x80, 0xBF, 0xD0, 0x02, 0x90,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B,
-    0xD5, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x3F, 0x55, 0x40, 0x00, 0x00,
-    0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x40, 0x3F, 0xFB, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xF0,
-    0x02, 0xFC, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x3D, 0x00, 0x3F, 0x00, 0x0F, 0xC2, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x7F, 0xF4, 0x00, 0x3F,
-    0x40, 0x7F, 0x47, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0xE0, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x41, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0x95, 0x56, 0xFC, 0x01, 0xFE, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x3F, 0x40,
-    0x00, 0xFC, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xFC, 0x00,
-    0x7E, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x2F, 0xC2, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF,
-    0x81, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xEA, 0xA9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x06, 0xF9, 0x00, 0x00, 0x1F, 0xCB, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFD, 0x01, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F,
-    0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x1F,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0B, 0xFF, 0xF4, 0x03, 0xF8, 0x2F, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x07, 0xF4, 0x02, 0xF9, 0x40, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0xF8,
-    0x00, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x01, 0xFD,
-    0x00, 0xBF, 0xFD, 0x02, 0xFD, 0x0B, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0xBF, 0xFF,
-    0x00, 0xBF, 0xFF, 0x01, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0,
-    0x00, 0xBF, 0xC0, 0x03, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0xFC, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0x00,
-    0xFC, 0x7F, 0x00, 0x0F, 0xC0, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0xFC, 0x07, 0xF0, 0x00, 0xFD, 0xF8,
-    0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00,
-    0x07, 0xF0, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x02, 0xFF, 0xF4, 0x03, 0xFF, 0xF6, 0xFF, 0xFD, 0x02,
-    0xFF, 0xFD, 0x00, 0xB4, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x00, 0xBF, 0x57, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F,
-    0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8,
-    0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4,
-    0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x10, 0x0F,
-    0xC0, 0x00, 0x00, 0xB9, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0xFF, 0xFF, 0x2F, 0xFF, 0xD0, 0x7F,
-    0xFF, 0x80, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x40, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x03, 0xF4,
-    0x00, 0x3F, 0x90, 0x05, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0x40, 0x3F,
-    0x40, 0x1F, 0x40, 0x7C, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0xF0, 0x02, 0x40,
-    0x0F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x95, 0xAF,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x55, 0x6F, 0xF4, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x6B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xE0, 0x7F, 0x01, 0xF0,
-    0x0B, 0x40, 0xFC, 0x03, 0xC0, 0x1C, 0x03, 0xF0, 0x0D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xC0,
-    0x1F, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40,
-    0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0xAA, 0xAA, 0xAA, 0xAB, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0x95, 0x55, 0x55, 0x57, 0xFC, 0x7F, 0x40, 0x00, 0x00,
-    0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0,
-    0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x7F, 0xE0,
-    0x0F, 0xC0, 0x00, 0xBF, 0x42, 0xF4, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x1F, 0xC7, 0xE0, 0x00,
-    0x00, 0xFC, 0xBF, 0xAA, 0xAA, 0xAF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x55, 0x55, 0x5F, 0xCB,
-    0xF0, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xC0, 0x00,
-    0x7F, 0x00, 0xFF, 0x40, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-    0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xCB, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0x86, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xE0, 0x00,
-    0x02, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0xBD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x00, 0x00,
-    0x0B, 0xE0, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xC7, 0xFF, 0xF8, 0x00, 0x3F,
-    0xF0, 0x2F, 0xD0, 0x00, 0x2F, 0xFC, 0x03, 0xF4, 0x00, 0x0F, 0x84, 0x00, 0xFE, 0x00, 0x0B, 0xC0,
-    0x00, 0x1F, 0xC0, 0x03, 0xE0, 0x00, 0x03, 0xF4, 0x01, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0x02, 0xF6, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17, 0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xBF, 0x00, 0x02, 0xFC, 0x00,
-    0x0F, 0xD7, 0xF0, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0xFD, 0x07, 0xF0,
-    0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x7F, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0xC3,
-    0xF4, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x7F,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B,
-    0xF4, 0x07, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x2D, 0x00, 0x2E,
-    0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0x57, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x6F, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xC0, 0x7F, 0x40, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xF0,
-    0x00, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x7F, 0x00, 0x0F, 0xC0, 0x3F, 0x1F, 0xC0,
-    0x03, 0xF0, 0x3F, 0x07, 0xF0, 0x00, 0xFC, 0x3F, 0x01, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7F, 0x00,
-    0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0xFD, 0x00, 0xFF, 0xFE, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xA5, 0x50,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0x1F, 0xF8,
-    0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00,
-    0xBF, 0x00, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0xBF,
-    0x00, 0x07, 0xFC, 0x00, 0xBF, 0x55, 0x7F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x6B, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0x55, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x07, 0xFE, 0xBF, 0xF0, 0x01, 0xF8, 0x00, 0xBF, 0x00,
-    0x7E, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x7F,
-    0x00, 0x7E, 0x00, 0x7F, 0x41, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0x01,
-    0x7F, 0xC0, 0x6F, 0xFC, 0x02, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xC0, 0x00, 0xFE, 0x02, 0xFC, 0x00,
-    0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0xBE, 0x02, 0xFC, 0x04, 0x0F, 0xE0, 0x2F, 0xC3, 0xD0, 0xFD, 0x02,
-    0xFC, 0x2F, 0x1F, 0xC0, 0x2F, 0xC0, 0xFF, 0xF4, 0x02, 0xFC, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFE, 0xBC, 0x00, 0x2F, 0xC0, 0x03, 0xE0, 0x02, 0xFC, 0x00, 0x1F, 0x00, 0x2F,
-    0xC0, 0x00, 0x50, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x6F, 0xC1, 0xFF, 0xF8, 0x0B, 0xFF, 0x6F, 0xFF, 0xFC, 0x1B, 0xFF, 0xF9, 0x6F,
-    0xF8, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x2F, 0x80, 0x00, 0x3F, 0x80,
-    0xBE, 0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x0B, 0xF0, 0x2F, 0x80,
-    0x00, 0x2F, 0x80, 0xBE, 0x03, 0xC0, 0xFE, 0x02, 0xF8, 0x0F, 0x83, 0xF4, 0x0B, 0xE0, 0x0F, 0x5F,
-    0xC0, 0x2F, 0x80, 0x1F, 0xFD, 0x00, 0xBF, 0x90, 0x7F, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0xF0, 0x02, 0xF8, 0x00,
-    0x01, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x9F,
-    0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF4, 0x5F, 0xFA, 0xAA, 0xAD, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x7F,
-    0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFE, 0x07, 0xF9, 0x55, 0x90, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x03, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xAA, 0xFF, 0xF0, 0x0B, 0xF0, 0x00, 0x7E, 0x00, 0xBF, 0x00,
-    0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x3D, 0x00, 0xBF, 0x00, 0x03, 0xD0, 0x0B, 0xF0, 0x00, 0x18, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x15, 0xFF, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2A, 0xFF, 0xAA, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x95, 0xBF, 0x00, 0xFD,
-    0x00, 0xBC, 0x03, 0xF4, 0x01, 0xF0, 0x0F, 0xD0, 0x03, 0x80, 0x3F, 0x40, 0x08, 0x1A, 0xFE, 0xA8,
-    0x00, 0xFF, 0xFF, 0xF4, 0x01, 0x5F, 0xE5, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x17, 0xFE, 0xAA,
-    0xFF, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0x40, 0x02, 0xFC, 0x00, 0x0F,
-    0x00, 0x02, 0xFC, 0x00, 0x05, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x15, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFD, 0x05, 0xBF, 0xF0, 0x02, 0xFC, 0x00, 0x0F, 0xF8, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x02, 0xFC,
-    0x00, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00,
-    0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x02, 0xFD, 0x00, 0x00, 0xFE, 0x7F, 0xFF, 0xF0, 0x00,
-    0xFD, 0xBF, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x07, 0xF9, 0x56, 0xFC, 0x00, 0x3F, 0x40, 0x07, 0x80, 0x03, 0xF4, 0x00, 0x34, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0x90, 0x2F, 0xF0, 0x03, 0xF4, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x02, 0xFC, 0x03,
-    0xF4, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x0F, 0xD2, 0xFF, 0xF8, 0x00,
-    0xFD, 0xBF, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0xD0, 0x0F, 0xFF, 0xFC,
-    0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0xE0, 0x02, 0x6F, 0x80, 0x03, 0xF4,
-    0x00, 0x7F, 0x54, 0x00, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x40, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x03,
-    0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xFD, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x3F, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x03,
-    0xF8, 0x03, 0xF4, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xD0, 0x02, 0xFE, 0x00, 0x00,
-    0xFF, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0xFE, 0x40, 0x07, 0xFD, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFD, 0x00, 0x7F, 0xD0, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x07, 0xFE,
-    0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x7F, 0x40, 0x7F, 0xFF, 0x00, 0xBF, 0x01, 0xFF, 0x41, 0xFF, 0xF8, 0x0B, 0xFC, 0x01, 0x7F,
-    0x00, 0x7F, 0x00, 0x7E, 0x50, 0x00, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x03, 0xE0,
-    0x2F, 0x00, 0x00, 0x00, 0xB8, 0x0F, 0x80, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x3E, 0x0B, 0xC0, 0x00,
-    0x00, 0x02, 0xFA, 0xFE, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBE,
-    0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0xF8, 0x0F,
-    0xD0, 0x00, 0x01, 0xFC, 0x03, 0xE0, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x0F, 0x80, 0x3F, 0x80, 0x00,
-    0xFF, 0x00, 0x3E, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x0B, 0xFF, 0x80, 0xBF, 0x80, 0xFF, 0x00, 0xBF,
-    0xFF, 0x00, 0xBF, 0xC1, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0x90, 0x2F, 0xF0, 0x2F, 0x40, 0x01,
-    0xFE, 0x0B, 0xC0, 0x00, 0x3F, 0x82, 0xF0, 0x00, 0x0B, 0xE0, 0x78, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x01, 0xAB, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF2, 0xC0, 0x00, 0x03, 0xF9, 0xF4, 0x00, 0x01,
-    0xFD, 0xFF, 0x00, 0x00, 0xFF, 0x2F, 0xF4, 0x01, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFE, 0x00, 0x00, 0x1A, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x42, 0xF0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xE0, 0x0B, 0xF8, 0x34, 0x00,
-    0x2F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0xFC, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD2, 0x40, 0x00,
-    0xFD, 0xBC, 0x00, 0x0F, 0xCF, 0xE0, 0x07, 0xF8, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x5F, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x65, 0xF4, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xC0, 0x03, 0xF8, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x05, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x02,
-    0xFC, 0x00, 0x1F, 0xD5, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xD0, 0x00,
-    0x00, 0xBF, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0x80,
-    0x00, 0x00, 0x2F, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4,
-    0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xF4, 0x2F, 0xFF, 0xFC, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02,
-    0xFF, 0xFD, 0x00, 0xFE, 0x0B, 0xFF, 0xF0, 0x0F, 0xFC, 0x01, 0xFD, 0x00, 0xBE, 0x50, 0x03, 0xF0,
-    0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x0F, 0x40,
-    0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00,
-    0xFC, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x3F, 0x00,
-    0x3F, 0x80, 0x00, 0xFC, 0x00, 0x7F, 0x40, 0x2F, 0xFF, 0x40, 0xBF, 0x42, 0xFF, 0xFD, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x17,
-    0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xF5, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x78, 0x2F, 0x00, 0x00, 0x02, 0xFC, 0x78,
-    0x3E, 0x00, 0x00, 0x02, 0xFC, 0x78, 0x7C, 0x00, 0x00, 0x02, 0xFC, 0x78, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x79, 0xFC, 0x00,
-    0x00, 0x02, 0xFC, 0x78, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x78, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x78,
-    0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x24, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x02,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF,
-    0x80, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0xBF, 0xFF, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x42, 0xFF, 0xFC, 0x00, 0x7F, 0x4B, 0xFF, 0xF0, 0x03,
-    0xFD, 0x01, 0xFC, 0x00, 0x2F, 0x50, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0xC5, 0x0B, 0x80, 0x00,
-    0x3F, 0x2C, 0x3C, 0x00, 0x00, 0xFC, 0xB2, 0xE0, 0x00, 0x03, 0xF7, 0xEF, 0x40, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x3F, 0x2D, 0xFC, 0x00, 0x00, 0xFC, 0xB1, 0xF8, 0x00, 0x03, 0xF2, 0xC3, 0xF4,
-    0x00, 0x0F, 0xC1, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xD0, 0x2F,
-    0xFF, 0x00, 0x3F, 0xC2, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x05,
-    0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xD5, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0x07, 0xD0, 0x00, 0x2F, 0xFF, 0xF8, 0x3E, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x2F,
-    0xC0, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF8,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF4, 0x07, 0xFF, 0xFF, 0x00,
-    0x1F, 0xF4, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xBE, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x10, 0x0F,
-    0xFF, 0xF4, 0x0B, 0xF0, 0x3F, 0xFF, 0xE0, 0xBF, 0xC0, 0x07, 0xE0, 0x07, 0xE6, 0x00, 0x1F, 0x80,
-    0x3E, 0x00, 0x00, 0x7E, 0x02, 0xF0, 0x00, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0x07, 0xE0, 0xF8, 0x00,
-    0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x07,
-    0xE0, 0xBE, 0x00, 0x00, 0x1F, 0x80, 0xFD, 0x00, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x01, 0xF8, 0x03,
-    0xF8, 0x00, 0x07, 0xF0, 0x07, 0xF4, 0x01, 0xFF, 0xF8, 0x0B, 0xF4, 0x0F, 0xFF, 0xF0, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xF8, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xEA, 0xBF, 0x80, 0x02, 0xFF, 0xC0,
-    0xBC, 0x00, 0xFD, 0x00, 0x1F, 0xD5, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0x80, 0x0F,
-    0xD0, 0x07, 0xD0, 0x00, 0x1D, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x1F, 0xF4,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x2F, 0xFF, 0xFF, 0x40, 0x7F, 0x4B, 0xFF, 0xFF, 0xC0, 0x7F, 0xD2, 0xFA, 0x7F,
-    0x40, 0x3F, 0x60, 0xF8, 0x0F, 0xC0, 0x2F, 0x00, 0x3E, 0x03, 0xF0, 0x1F, 0x40, 0x0B, 0x40, 0xFC,
-    0x0F, 0x80, 0x01, 0x80, 0x3F, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xEB, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0xBE, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x3F, 0xC0, 0x00, 0xBF, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17,
-    0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x02, 0xFE, 0xAA, 0xAA, 0xAB, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF5, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x8B, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4,
-    0x07, 0xF8, 0x00, 0x1B, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0,
-    0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xEA, 0xAA, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x95, 0x55, 0xBF, 0x00, 0x03, 0xF4, 0x00, 0x07,
-    0xF0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x00,
-    0x7F, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x02, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0xBF, 0xFF, 0x80,
-    0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFD, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x17, 0xFD, 0x00, 0x00, 0x1B, 0xFA, 0xAF, 0xE0, 0x2F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x3E, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xD0, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x3D, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFE,
-    0xAA, 0xAA, 0xAB, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0x40, 0xFF, 0xFF, 0xFE, 0x07, 0xF8, 0x00,
-    0x1B, 0xFA, 0xBE, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x2E, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x2E, 0x03,
-    0xF4, 0x00, 0x07, 0xF0, 0x2D, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x18, 0x03, 0xFE, 0xAA, 0xAF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xF9, 0x55, 0x5B, 0xF0, 0x00, 0x03, 0xF4, 0x00,
-    0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x03,
-    0xF4, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x7F, 0xFF,
-    0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x7F, 0xFA, 0xAA, 0xAF, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC5, 0x54, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-    0xE4, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x45,
-    0xBF, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xE0, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x02, 0xFD, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x7F, 0x1F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x00, 0x1F, 0xCB, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF9,
-    0x55, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x0B,
-    0xE1, 0xBF, 0x80, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0xFF, 0xFF, 0x80, 0x03, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x00,
-    0x7F, 0x80, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x1F,
-    0xC0, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC2,
-    0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x01, 0xFC, 0xBF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0x80, 0x0F, 0xD1,
-    0xFE, 0x00, 0x0B, 0xF0, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x2F,
-    0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x0F, 0xD0,
-    0x00, 0xFC, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x07,
-    0xF0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x7F, 0x40, 0x0F, 0xD0, 0x01, 0xF8, 0x07, 0xF4, 0x00, 0xBE,
-    0x00, 0x2F, 0x40, 0x3F, 0x80, 0x0B, 0xF0, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x1F, 0xE0, 0x02, 0xF8, 0x0B, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xC1, 0xF8, 0x00, 0x03, 0xFD, 0x00,
-    0x7F, 0x7F, 0x00, 0x00, 0x1F, 0xF9, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x9A,
-    0xC0, 0x00, 0x6F, 0xFF, 0xEB, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x02, 0xA4, 0x00, 0x03, 0xE0, 0x1F,
-    0xFF, 0x00, 0x0F, 0xC0, 0x7D, 0x1F, 0xC0, 0x2F, 0x40, 0xF8, 0x0B, 0xD0, 0x3F, 0x01, 0xF4, 0x03,
-    0xE0, 0x7E, 0x02, 0xF0, 0x03, 0xF0, 0x7E, 0x03, 0xF0, 0x03, 0xF0, 0xBD, 0x03, 0xF0, 0x03, 0xF0,
-    0xBE, 0x03, 0xF0, 0x03, 0xE0, 0xBE, 0x02, 0xF4, 0x07, 0xD0, 0x7F, 0x01, 0xF8, 0x0B, 0xC0, 0x3F,
-    0x00, 0xFC, 0x0F, 0x80, 0x2F, 0x80, 0xBD, 0x2F, 0x00, 0x0F, 0xE0, 0x3F, 0xBD, 0x00, 0x03, 0xFE,
-    0xAF, 0xF9, 0x59, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x94, 0x06, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B, 0xFC,
-    0x01, 0xFE, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF0,
-    0x00, 0x00, 0xB4, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x14, 0x0B, 0xFF, 0xFA, 0xAF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0x07,
-    0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x01, 0xFD, 0x07, 0xFC,
-    0x0F, 0xC0, 0x03, 0xF4, 0xBD, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x14, 0x1F, 0xC0, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x6E, 0x07, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x03, 0x5F, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFA, 0xAF, 0xFA, 0xAF, 0xF2, 0xF0,
-    0x02, 0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xBF, 0x00, 0x2F, 0x2E, 0x00, 0x2F, 0xC0, 0x07, 0xC7, 0x40,
-    0x0B, 0xF0, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x50, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xCB, 0xE9, 0xBF, 0x6A, 0xF3, 0xE0, 0x1F, 0xC0, 0x7C, 0xF8, 0x07,
-    0xF0, 0x0F, 0x2D, 0x01, 0xFC, 0x03, 0xC6, 0x00, 0x7F, 0x00, 0x90, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x06, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x28, 0x00, 0xBF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC1, 0xBF, 0xD0, 0x00, 0x0B, 0xF4,
-    0x00, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x0F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0x1F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xCB, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xD4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4,
-    0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00,
-    0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC,
-    0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00,
-    0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x55, 0x50,
-    0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC1, 0xBF, 0xD0, 0x00,
-    0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFD,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD,
-    0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x01,
-    0xFC, 0x00, 0x1F, 0x40, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-    0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xC2,
-    0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x2A, 0xFF, 0xA8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0xBE, 0x54, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x05,
-    0x55, 0x50, 0x00, 0x2F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x06,
-    0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x80, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFD,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xF8, 0x00, 0x00,
-    0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF,
-    0xD0, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3F, 0xFF, 0x80, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0xFF,
-    0xF8, 0x07, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0xFC, 0x00,
-    0x00, 0x1F, 0xC2, 0xF0, 0x00, 0x00, 0x0B, 0xF7, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xEF, 0xD0, 0x00, 0x00, 0x0F,
-    0x87, 0xF0, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0xF4, 0x00,
-    0x3F, 0x80, 0x2F, 0xFE, 0x01, 0xFF, 0xFC, 0xBF, 0xFF, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x34, 0x7F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF,
-    0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x4B, 0xE9, 0xFF, 0x5B, 0xD0, 0x07, 0xFD, 0x02,
-    0xF0, 0x3F, 0x80, 0xF4, 0x00, 0xFE, 0x00, 0xB8, 0x0F, 0xE0, 0x3D, 0x00, 0x3F, 0x80, 0x2E, 0x03,
-    0xF8, 0x0F, 0x00, 0x0F, 0xE0, 0x07, 0x40, 0xFE, 0x03, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xFA, 0x55, 0x56,
-    0xBF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-    0x0F, 0x83, 0xF8, 0x7E, 0x02, 0xFC, 0x03, 0xD0, 0xFD, 0x0F, 0x40, 0xBE, 0x00, 0xF0, 0x3F, 0x42,
-    0xD0, 0x2F, 0x80, 0x2C, 0x0F, 0xD0, 0xB0, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00,
-    0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF9, 0x00, 0x17,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
-    0x6F, 0xD0, 0x00, 0x6F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF4,
-    0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xF9, 0x55, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x40, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0xBF, 0xFE, 0x03, 0xFF, 0xF4, 0x1B, 0xF0, 0x00, 0x7F, 0x40,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x96, 0xBF, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0x0A, 0xFA, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xFF,
-    0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
-    0x6F, 0xD0, 0x00, 0x6F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0xFD, 0x07, 0x81, 0xFC, 0x00, 0x03, 0xF8, 0x1E, 0x07, 0xF0, 0x00, 0x0F, 0xF4,
-    0x78, 0x1F, 0xC0, 0x00, 0x1F, 0xFE, 0xF5, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x1E, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x03, 0xFF, 0xFA, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xD1, 0xBF, 0x00, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x07, 0x43, 0xF0, 0x00, 0xFE, 0x1D, 0x0F, 0xC0, 0x01,
-    0xFF, 0xBA, 0xBF, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xAF, 0xE7, 0xF0, 0x00, 0x00, 0x1D,
-    0x0F, 0xC0, 0x00, 0x00, 0x74, 0x3F, 0x00, 0x00, 0x00, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x17, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x15, 0x94, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xE4, 0x01, 0xFF, 0x40, 0x02, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00,
-    0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00,
-    0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x02, 0xFD, 0x00, 0x01, 0xFD, 0x07, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFE, 0xBF, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x01, 0x54, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0xF4, 0x00,
-    0x01, 0xFD, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x57, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xF0,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F,
-    0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x41,
-    0xBF, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFC, 0x0B,
-    0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC2, 0xE0, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x3E, 0x0B, 0xF0, 0x00,
-    0x00, 0x1F, 0xD3, 0xE0, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x3F, 0x9F, 0xF5, 0x55, 0x55, 0x6F, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x01,
-    0x40, 0x00, 0x07, 0xFF, 0xFA, 0xAF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xF4, 0x07, 0xF8, 0x0D,
-    0x0F, 0xD0, 0x01, 0xFC, 0x3D, 0x0F, 0xC0, 0x00, 0xFD, 0x3D, 0x2F, 0x80, 0x00, 0xFD, 0x3F, 0x7F,
-    0x95, 0x55, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xBC, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0x41, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x03,
-    0xFC, 0x0B, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC2, 0xE0, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x3E, 0x0B,
-    0xF0, 0x00, 0x00, 0x1F, 0xD3, 0xE0, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x3F, 0x9F, 0xF5, 0x55, 0x55,
-    0x6F, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x01, 0x40, 0x00, 0x07, 0xFF, 0xFA, 0xAF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xF4, 0x07, 0xF8, 0x0D, 0x0F, 0xD0, 0x01, 0xFC, 0x3D, 0x0F, 0xC0,
-    0x00, 0xFD, 0x3D, 0x2F, 0x80, 0x00, 0xFD, 0x3F, 0x7F, 0x95, 0x55, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x55, 0xBC, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xF4, 0x01, 0xFF, 0x40, 0x3F, 0xFF,
-    0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0x80, 0x02, 0xFF, 0x80, 0x09, 0xBE, 0x00, 0x0F,
-    0xD0, 0x01, 0xFD, 0x50, 0x00, 0x0B, 0xD0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0xFD, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x0F, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x03, 0xF4, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0xFD, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x0F, 0xD0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x0B, 0xF8, 0x00,
-    0x03, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xF9, 0x00, 0x1F, 0xF4,
-    0x03, 0xFF, 0x00, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x1F,
-    0xF8, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x95, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x1F,
-    0xD0, 0x1F, 0xFF, 0xC0, 0x2F, 0xC0, 0x7F, 0xD0, 0x7F, 0xFE, 0x02, 0xFF, 0x00, 0x5F, 0xC0, 0x1F,
-    0xC0, 0x1F, 0x94, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0x0B, 0xC0,
-    0x00, 0x00, 0x2E, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x82, 0xF0, 0x00, 0x00, 0x00,
-    0xBE, 0xBF, 0xAF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x87, 0xF0,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x81, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x3E, 0x03, 0xF4, 0x00,
-    0x00, 0x7F, 0x00, 0xF8, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0xE0, 0x0F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x0F, 0x80, 0x0F, 0xD0, 0x03, 0xFC, 0x02, 0xFF, 0xE0, 0x1F, 0xE0, 0x3F, 0xC0, 0x2F, 0xFF, 0xC0,
-    0x2F, 0xE0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x1F, 0xEB, 0xFF, 0xFE, 0x00, 0x2F, 0xFC, 0x5F, 0xF4, 0x00, 0x2F, 0xFF, 0x02, 0xFC,
-    0x00, 0x1F, 0xD1, 0x40, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x0F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xC2,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x95,
-    0xBF, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xC0, 0x0B, 0xF0, 0x00, 0x0F, 0xF4, 0x02, 0xFC, 0x00,
-    0x01, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00,
-    0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xC7, 0xFF, 0xFF, 0x00,
-    0x0F, 0xE2, 0xFF, 0xFF, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x5B, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x2F, 0xFF, 0xD0, 0x0F, 0xEB, 0xFF, 0xF0, 0x0F, 0xFC, 0x1F, 0xD0, 0x0F, 0xE5, 0x03, 0xF0, 0x07,
-    0xC0, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xF0, 0x00, 0x03, 0xFA,
-    0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xAA, 0xFF, 0xD0, 0x0F, 0xC0, 0x07, 0xFC, 0x03,
-    0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x7F,
-    0x2F, 0xFF, 0x40, 0x1F, 0xEF, 0xFF, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01,
-    0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0xFF, 0xAA, 0xFF, 0x80, 0x00, 0x00, 0xBC,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x7F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0x00, 0x38, 0xBF, 0x00,
-    0x00, 0x7F, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xFC, 0x7F,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFC, 0x19, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xD5, 0x7F, 0x80, 0x00, 0x07,
-    0xC0, 0x3F, 0x40, 0x00, 0x07, 0xC0, 0x3F, 0x40, 0x00, 0x07, 0xC0, 0x3F, 0x40, 0x00, 0x0B, 0x80,
-    0x3F, 0x40, 0x00, 0x0F, 0x80, 0x3F, 0x40, 0x00, 0x0F, 0x40, 0x3F, 0x40, 0x00, 0x0F, 0x00, 0x3F,
-    0x40, 0x00, 0x1F, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x3D, 0x00, 0x3F, 0x40,
-    0x20, 0xBC, 0x00, 0x3F, 0x40, 0x7F, 0xF4, 0x00, 0x3F, 0x80, 0x7F, 0xF0, 0x02, 0xFF, 0xFD, 0x7F,
-    0xC0, 0x0B, 0xFF, 0xFD, 0x15, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17,
-    0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x02, 0xFE, 0xAA, 0xAA, 0xAB, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0xAF, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0,
-    0x7F, 0x80, 0x01, 0xBF, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00,
-    0xFD, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x0F, 0xFA, 0xAA, 0xBF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x55, 0x56, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x0F,
-    0xD0, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x3F,
-    0x80, 0x00, 0x7F, 0x00, 0xBF, 0xFE, 0x00, 0x1F, 0xC0, 0xBF, 0xFF, 0x80, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17, 0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xAB, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B,
-    0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xBF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xAF, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x7F, 0x80, 0x01, 0xBF, 0x00, 0x0F, 0xD0, 0x00, 0x1F,
-    0xC0, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x00, 0x0F, 0xFA, 0xAA, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x55, 0x56, 0xFC,
-    0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x07, 0xF0,
-    0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0xBF, 0xFE, 0x01, 0xFF, 0xFE,
-    0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
-    0x80, 0x6F, 0xD0, 0x00, 0x6F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F,
-    0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xF9, 0x55, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0xBF, 0xFF, 0x03, 0xFF, 0xFA, 0xFF, 0xF8, 0x0F, 0xFF, 0xD1, 0xBF, 0x00, 0x07, 0xF4,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0x96, 0xBF, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xAF, 0xA7, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x7F, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3E,
-    0xFC, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x03, 0xCF, 0xD0, 0x00, 0x7C, 0xFC, 0x00, 0x00, 0x7C, 0xBE,
-    0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x07, 0xC7, 0xF0, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0xBC, 0x3F, 0x00,
-    0x2F, 0x0F, 0xC0, 0x00, 0x0B, 0xC2, 0xF8, 0x03, 0xE0, 0xFD, 0x00, 0x00, 0xBC, 0x1F, 0xC0, 0x3C,
-    0x0B, 0xD0, 0x00, 0x0F, 0x80, 0xFC, 0x0B, 0xC0, 0xBD, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0xF8, 0x0B,
-    0xE0, 0x00, 0x0F, 0x80, 0x3F, 0x0F, 0x00, 0x7E, 0x00, 0x00, 0xF4, 0x03, 0xF2, 0xF0, 0x07, 0xE0,
-    0x00, 0x0F, 0x40, 0x2F, 0x7D, 0x00, 0x7F, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xF0, 0x00,
-    0x1F, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x2F,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0x00,
-    0x01, 0xFF, 0x80, 0x03, 0xEF, 0x40, 0x03, 0xEF, 0x40, 0x03, 0xDF, 0xC0, 0x07, 0xDF, 0x40, 0x03,
-    0xD7, 0xD0, 0x0F, 0x5F, 0x40, 0x03, 0xD3, 0xF0, 0x0F, 0x1F, 0x40, 0x03, 0xD2, 0xF4, 0x2D, 0x1F,
-    0x40, 0x03, 0xD0, 0xF8, 0x3C, 0x1F, 0x40, 0x03, 0xD0, 0xBC, 0xB4, 0x1F, 0x40, 0x03, 0xD0, 0x3F,
-    0xF0, 0x1F, 0x40, 0x03, 0xD0, 0x2F, 0xE0, 0x1F, 0x40, 0x03, 0xD0, 0x1F, 0xC0, 0x1F, 0x40, 0x03,
-    0xD0, 0x0F, 0x80, 0x1F, 0x40, 0x03, 0xE0, 0x05, 0x00, 0x1F, 0x80, 0x2F, 0xFF, 0x00, 0x01, 0xFF,
-    0xFD, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xC7, 0xFF, 0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x2F, 0xFF, 0xF1,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x0B, 0x40, 0x07, 0x80, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x00, 0xBF, 0x57, 0xF8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00,
-    0x50, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFE, 0xFE, 0x00, 0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F,
-    0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F,
-    0xFC, 0x0B, 0xFF, 0xD1, 0xFF, 0x00, 0x05, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0xBF, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFA,
-    0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xAA, 0xAB, 0xF8, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x1F,
-    0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x01, 0x40, 0x05, 0x00,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x01, 0x40,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x03, 0xF8, 0x00,
-    0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0xFE, 0x00, 0x3F, 0xD0, 0x0B,
-    0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x3F,
-    0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF, 0xD1, 0xFF, 0x00, 0x05, 0x40, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0xAA, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x7D, 0xBF, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x07, 0x40,
-    0x00, 0x00, 0x1F, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0xBF, 0xAA, 0xA8, 0x00, 0x00, 0x07, 0xFA, 0xAB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0x10, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xD0, 0x07, 0xE0, 0x00,
-    0x0B, 0xF0, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7D, 0x02, 0xF8, 0x00, 0x00,
-    0xFF, 0x56, 0xAB, 0xF0, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x50, 0x00, 0x15, 0x00, 0x00, 0x2F, 0xFF, 0x41, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x7F, 0x40, 0xBF, 0xF8, 0x07, 0xF8, 0x3F, 0x80, 0x0F,
-    0xFC, 0x00, 0x7F, 0x0B, 0xD0, 0x02, 0xFD, 0x00, 0x0F, 0xD0, 0x50, 0x00, 0xBF, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x2F, 0xC5, 0xAB, 0xFD, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF,
-    0xEA, 0x54, 0x00, 0xFF, 0xE5, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0xFF, 0x41, 0xFF, 0xFF, 0x55, 0xBC, 0x2F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0x02, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFE, 0x00, 0x05, 0x50, 0x00, 0x05, 0x54, 0x00, 0x00, 0xB4, 0x00, 0x78, 0x00,
-    0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xFB, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00,
-    0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D,
-    0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xC0, 0x03, 0xD0, 0x2F, 0x40, 0x0F, 0xC0, 0xBE, 0x00, 0x7F, 0x00, 0xFE, 0x5B, 0xF4, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0x40, 0xFE, 0x00, 0xFF, 0x07, 0xE0, 0x00, 0xFD, 0x3F, 0x00, 0x02, 0xF8,
-    0xFC, 0x00, 0x07, 0xE7, 0xF5, 0x55, 0x6F, 0xAF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xF6, 0xF8,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0xE5, 0x5B, 0x42, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x1F, 0xF9, 0x16, 0xFF, 0xC0, 0x3F, 0x40, 0x00, 0x7F, 0xE0, 0x3D, 0x00, 0x00, 0x0F, 0xF4, 0x24,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x2A, 0xAA, 0xAA,
-    0xAA, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xAA, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xD0, 0x00, 0x1F, 0xE0, 0x0F, 0xF9, 0x01, 0xBF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF4, 0x0F, 0x90, 0x1F, 0xF4, 0x34, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xEF, 0xEA, 0xAA, 0xBE, 0xBE, 0x00, 0x02, 0xF6, 0xF8,
-    0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x7F, 0x0F, 0xF0, 0x07, 0xF0, 0x0F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xF0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00,
-    0x00, 0xFF, 0x42, 0xFD, 0x00, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x16, 0xFF, 0xC0, 0x3F, 0x40, 0x00,
-    0x7F, 0xE0, 0x3D, 0x00, 0x00, 0x0F, 0xF4, 0x24, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xAA, 0xAA, 0xAA, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x00,
-    0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xD0, 0x00,
-    0x1F, 0xE0, 0x0F, 0xF9, 0x01, 0xBF, 0x80, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x05, 0x40, 0x05, 0x00, 0x7F, 0x40, 0xFD, 0x02, 0xFE, 0x07,
-    0xF8, 0x07, 0xF4, 0x1F, 0xD0, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFD, 0x03, 0xE4, 0x07, 0xFD, 0x0D,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x7F, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB, 0xFA, 0xAA, 0xAF, 0xAF, 0x80, 0x00,
-    0xBD, 0xBE, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x1F, 0xC3, 0xFC, 0x01, 0xFC, 0x03, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xF4, 0x01, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0x80,
-    0x02, 0xFF, 0x80, 0x09, 0xBE, 0x00, 0x0F, 0xD0, 0x01, 0xFD, 0x50, 0x00, 0x0B, 0xD0, 0x03, 0xF4,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x3F,
-    0x40, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x03,
-    0xF4, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xFD, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x43, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x3F, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x1F, 0xD0, 0x00, 0x00, 0x0B,
-    0xF0, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0x40, 0x0B, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0x40, 0x03,
-    0xFE, 0x00, 0x03, 0xF9, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0x43,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x1F, 0xF8, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x1F, 0xD0, 0x1F, 0xFF, 0xC0, 0x2F, 0xC0, 0x7F, 0xD0, 0x7F,
-    0xFE, 0x02, 0xFF, 0x00, 0x5F, 0xC0, 0x1F, 0xC0, 0x1F, 0x94, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x2E, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x00,
-    0x3C, 0x0F, 0x82, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0xBF, 0xAF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x81, 0xFC, 0x00,
-    0x00, 0x0F, 0xD0, 0x3E, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0xF8, 0x07, 0xF0, 0x00, 0x03, 0xF4,
-    0x03, 0xE0, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0x80, 0x0F, 0xD0, 0x03, 0xFC, 0x02, 0xFF, 0xE0,
-    0x1F, 0xE0, 0x3F, 0xC0, 0x2F, 0xFF, 0xC0, 0x2F, 0xE0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x50, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFD, 0x01, 0xFE, 0x40, 0xBF, 0xC0, 0xBD,
-    0x00, 0x07, 0xF8, 0x2F, 0x00, 0x00, 0xFE, 0x0B, 0xC0, 0x00, 0x2F, 0x81, 0xE0, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x06, 0xAF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xCB, 0x00, 0x00, 0x0F, 0xE7, 0xD0,
-    0x00, 0x07, 0xF7, 0xFC, 0x00, 0x03, 0xFC, 0xBF, 0xD0, 0x07, 0xFD, 0x0F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x05, 0x00, 0x14, 0x03, 0xFC, 0x0B, 0xF0, 0x3F,
-    0xC0, 0xFF, 0x03, 0xFC, 0x0B, 0xF0, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x07, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x3E, 0x00, 0xBF, 0x83, 0x40,
-    0x02, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x24, 0x00,
-    0x0F, 0xDB, 0xC0, 0x00, 0xFC, 0xFE, 0x00, 0x7F, 0x87, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF4, 0x00,
-    0x05, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xAA, 0xAF, 0xF0,
-    0xFC, 0x00, 0x07, 0xF0, 0x3E, 0x00, 0x07, 0xF4, 0x0F, 0x40, 0x03, 0xF4, 0x01, 0x80, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x2B, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC7,
-    0x00, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x07, 0xF4, 0xFF, 0x90, 0x1B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0x6A, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x2F, 0x95, 0x5B, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0x3C, 0x00, 0x2F, 0x80, 0x18, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x04, 0x00, 0x02, 0xF8, 0x3C, 0x00, 0x07, 0xF0, 0x7F, 0x40, 0x2F,
-    0xD0, 0x3F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0x01, 0xBF, 0x40, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0xFD, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x2F, 0xC0, 0x0F, 0xD0,
-    0x7F, 0x00, 0x02, 0xFC, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x7F, 0x00, 0x02,
-    0xFC, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x07, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0xBF, 0x40, 0x7F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xCB, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x0A, 0xAA, 0xA5, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0xBF, 0xFF, 0x00, 0xBF, 0xFF, 0x01,
-    0xFD, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xC0, 0x03,
-    0xF0, 0x00, 0xBF, 0xF0, 0x00, 0xFC, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0x00, 0xFC, 0x7F, 0x00, 0x0F,
-    0xC0, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0xFC, 0x07, 0xF0, 0x00, 0xFD, 0xF8, 0x01, 0xFC, 0x00, 0x3F,
-    0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0xFC,
-    0x00, 0x01, 0xFC, 0x02, 0xFF, 0xF4, 0x03, 0xFF, 0xF6, 0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17,
-    0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x2F, 0xC0, 0x03,
-    0xF4, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x7F, 0x00,
-    0x02, 0xFC, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0xFD,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xF0,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x07, 0xFF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x05, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x6F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x7F, 0x40, 0x00,
-    0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0xFC, 0x00, 0x2F,
-    0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x7F, 0x00, 0x0F, 0xC0, 0x3F, 0x1F, 0xC0, 0x03, 0xF0, 0x3F, 0x07,
-    0xF0, 0x00, 0xFC, 0x3F, 0x01, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7F, 0x00, 0x0F, 0xFE, 0x00, 0x1F,
-    0xC0, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x7F,
-    0x00, 0xBF, 0xFD, 0x00, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD,
-    0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40,
-    0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x03, 0xFD, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x50,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC, 0x00,
-    0x0F, 0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB,
-    0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00,
-    0x1F, 0xC7, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00, 0x07, 0xF0, 0x0F,
-    0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07,
-    0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0xAA, 0xAA, 0xAA, 0xAB, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0x95, 0x55, 0x55, 0x57, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03,
-    0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xE0, 0x00,
-    0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02,
-    0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xBF, 0x42, 0xF4, 0x00,
-    0x03, 0xF8, 0x3F, 0x00, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x00, 0xFC, 0xBF, 0xAA, 0xAA, 0xAF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x55, 0x55, 0x5F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00,
-    0x1F, 0xC3, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0xFF, 0x40, 0x2F, 0xD0, 0x07,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0xAA, 0xAA, 0xAA, 0xAB, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0x95, 0x55, 0x55, 0x57, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07,
-    0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x50, 0x01,
-    0x40, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x03, 0xFD, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00,
-    0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC,
-    0x00, 0x0B, 0xF4, 0x2F, 0x40, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x01, 0xFC, 0x7E, 0x00, 0x00, 0x0F,
-    0xCB, 0xFA, 0xAA, 0xAA, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xCB, 0xF5, 0x55, 0x55, 0xFC, 0xBF, 0x00,
-    0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x2F, 0x43, 0xFC, 0x00, 0x07, 0xF0,
-    0x0F, 0xF4, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x0F, 0xF4,
-    0x00, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x01, 0xF4, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xF9, 0x5B, 0xFF, 0x40, 0x1F, 0x80, 0x00, 0x7F, 0xD0, 0x1F, 0x40,
-    0x00, 0x1F, 0xF0, 0x1F, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0A, 0xAA, 0xAA, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1D,
-    0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x3F, 0xF4,
-    0x06, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0xBF, 0x02, 0xFC, 0x03, 0xFC, 0x0F, 0xF4, 0x0B, 0xF0, 0x2F,
-    0xC0, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x06, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFE, 0x03, 0xE4, 0x07, 0xFD, 0x0D, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x55, 0x5F, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x24, 0x00, 0x03,
-    0xF2, 0xF0, 0x00, 0x3F, 0x4F, 0xF4, 0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF4, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFE, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xD0,
-    0x02, 0xFD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x0F,
-    0xE0, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x30, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0,
-    0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3,
-    0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x10, 0x0F, 0xC0, 0x00, 0x00, 0xB9, 0xBF, 0x40, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00,
-    0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFE, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xD0,
-    0x02, 0xFD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x0F,
-    0xE0, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x30, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x50, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x03,
-    0xFC, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD,
-    0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01,
-    0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3,
-    0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x10, 0x0F, 0xC0, 0x00, 0x00, 0xB9,
-    0xBF, 0x40, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x01, 0x80, 0x00,
-    0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0xBF,
-    0x80, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0x80,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x2F,
-    0xD0, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xF4, 0x00, 0x00,
-    0x0F, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xC0,
-    0x00, 0x00, 0x01, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x30, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x03,
-    0xF0, 0x7F, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0x82, 0xF4, 0x00, 0x00, 0x1E, 0x03,
-    0xD0, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0,
-    0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3,
-    0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x10, 0x0F, 0xC0, 0x00, 0x00, 0xB9, 0xBF, 0x40, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xBE, 0x00, 0x00, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x00,
-    0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xF0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x6F, 0xD0, 0x00, 0x6F, 0xD0, 0x00, 0x7F, 0x00,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00,
-    0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xF9, 0x55, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x40,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00,
-    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x03, 0xFF, 0xFA, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xD1, 0xBF, 0x00, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0x96,
-    0xBF, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xAF, 0xA7, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xF1, 0x7F, 0xEA, 0xBF, 0xFC, 0x0B, 0xF0, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0xBF, 0x00,
-    0x03, 0xD0, 0x2F, 0xC0, 0x00, 0xF4, 0x0B, 0xF0, 0x00, 0x18, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0x95, 0xBF, 0x00, 0xFD, 0x00, 0xBC, 0x03, 0xF4, 0x01, 0xF0, 0x0F, 0xD0, 0x03, 0x80, 0x3F,
-    0x40, 0x08, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x90, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF,
-    0xAF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD1, 0x7F, 0xD0, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xA5, 0x40, 0x00, 0x03,
-    0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x80,
-    0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x02, 0xFC, 0x00,
-    0x07, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0xFE,
-    0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x02, 0xFD, 0x56, 0xFF, 0x80, 0x0F,
-    0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xEB, 0xFF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFE,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x3F,
-    0x45, 0x40, 0x00, 0xBE, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0x80, 0x03, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xE0, 0x00, 0xFC, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x0F, 0xC0,
-    0x02, 0xF4, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0xBC, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x02, 0xF8,
-    0x00, 0x3F, 0x00, 0x7F, 0x80, 0xBF, 0x00, 0xBF, 0xFF, 0xFF, 0x81, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE,
-    0x40, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xAA, 0xFF, 0xF0, 0x0B, 0xF0, 0x00, 0x7E, 0x00, 0xBF, 0x00, 0x03,
-    0xE0, 0x0B, 0xF0, 0x00, 0x3D, 0x00, 0xBF, 0x00, 0x03, 0xD0, 0x0B, 0xF0, 0x00, 0x18, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x15, 0xFF, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2A, 0xFF, 0xAA, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x01, 0x0B, 0xC0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2A, 0x40,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x95, 0xBF, 0x00, 0xFD, 0x00, 0xBC,
-    0x03, 0xF4, 0x01, 0xF0, 0x0F, 0xD0, 0x03, 0x80, 0x3F, 0x40, 0x08, 0x1A, 0xFE, 0xA8, 0x00, 0xFF,
-    0xFF, 0xF4, 0x01, 0x5F, 0xE5, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF4,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x65, 0xF4, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x06, 0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x80,
-    0x00, 0xBE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xF0,
-    0x00, 0x00, 0x2F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0xBF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x16, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x3F,
-    0xFF, 0x80, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFE,
-    0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x00, 0x1F, 0xC2, 0xF0, 0x00, 0x00, 0x0B, 0xF7,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xEF, 0xD0, 0x00, 0x00, 0x0F, 0x87, 0xF4, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x80, 0x2F, 0xFE, 0x00, 0x1F, 0xD0, 0xBF,
-    0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x2F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x06, 0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF,
-    0x80, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0x07, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xAA, 0xBF, 0xFE, 0xAA, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x7F, 0xFD, 0x55, 0x00, 0x00, 0x00, 0xBD, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0x80, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0xFF, 0xF8,
-    0x07, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x00,
-    0x1F, 0xC2, 0xF0, 0x00, 0x00, 0x07, 0xE7, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0x02, 0xAB, 0xFF, 0xEA, 0x40, 0x00, 0x03, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x83,
-    0xF0, 0x00, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0x02, 0xF4, 0x00, 0x3F,
-    0x80, 0x2F, 0xFE, 0x01, 0xFF, 0xFC, 0xBF, 0xFF, 0x03, 0xFF, 0xFC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x38, 0x2C, 0x1E, 0xB4, 0x07,
-    0xD0, 0x0B, 0xD0, 0x2F, 0xF4, 0x36, 0x9C, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x74, 0x3F, 0xFF, 0xFC, 0x75, 0x55, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03, 0x80, 0x70, 0x0E, 0x00,
-    0x70, 0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x2E, 0x55, 0x5D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0, 0x0D, 0x00, 0x14, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE,
-    0x00, 0x15, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA,
-    0xAA, 0x7F, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAA, 0xA4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x68, 0x01, 0xA2, 0xF4,
-    0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F,
-    0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2,
-    0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F,
-    0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03,
-    0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0,
-    0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF1, 0x50, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x3E, 0x0B,
-    0xC0, 0xF4, 0x2F, 0x03, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x83, 0xFC, 0x05, 0x00, 0x05, 0x03, 0xF8,
-    0x3F, 0xC1, 0xFC, 0x0F, 0xC0, 0xFC, 0x1F, 0x42, 0xF0, 0x3D, 0x0B, 0x80, 0x10, 0x00, 0x2F, 0x43,
-    0xFC, 0x2F, 0xC0, 0xFC, 0x0F, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0A, 0x00, 0x05, 0x03, 0xFC,
-    0x7F, 0x87, 0xF0, 0x7F, 0x03, 0xF0, 0x2F, 0x00, 0xF4, 0x0B, 0xC0, 0x3D, 0x00, 0x40, 0x00, 0x40,
-    0x01, 0x00, 0xF8, 0x03, 0xC0, 0xBC, 0x03, 0xE0, 0x3D, 0x02, 0xF0, 0x2F, 0x00, 0xF8, 0x0F, 0xC0,
-    0x7E, 0x07, 0xF0, 0x2F, 0x41, 0xFC, 0x0F, 0xE0, 0x7F, 0x82, 0xFC, 0x0F, 0xF0, 0x3F, 0x80, 0x50,
-    0x01, 0x00, 0x05, 0x00, 0x10, 0x3F, 0x81, 0xFC, 0x3F, 0xC1, 0xFE, 0x1F, 0xC0, 0xBF, 0x0F, 0xC0,
-    0xBF, 0x0F, 0xC0, 0xBD, 0x1F, 0x40, 0xBC, 0x2F, 0x00, 0xF8, 0x3D, 0x01, 0xF0, 0xB8, 0x03, 0xD0,
-    0x10, 0x01, 0x00, 0x2F, 0x40, 0xB8, 0x3F, 0xC2, 0xFE, 0x2F, 0xC0, 0xFF, 0x0F, 0xC0, 0xBF, 0x0F,
-    0xC0, 0x7E, 0x0F, 0x80, 0xBD, 0x1F, 0x00, 0xFC, 0x3E, 0x01, 0xF4, 0x7C, 0x03, 0xE0, 0xA0, 0x03,
-    0x80, 0x05, 0x00, 0x10, 0x0F, 0xF0, 0x3F, 0x47, 0xF8, 0x2F, 0xD1, 0xFC, 0x0F, 0xE0, 0x7F, 0x03,
-    0xF4, 0x0F, 0xC0, 0xBE, 0x02, 0xF0, 0x0F, 0x80, 0x3D, 0x02, 0xF0, 0x0B, 0xC0, 0x3E, 0x00, 0xF4,
-    0x07, 0xC0, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x05, 0x40, 0xF4, 0x06, 0x3F,
-    0xFB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF6, 0xE5, 0x3D, 0x1A, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x05, 0x40,
-    0xF4, 0x06, 0x3F, 0xFB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF6, 0xE5, 0x3E, 0x1A, 0xC0, 0x00, 0xF8,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x50, 0x0F, 0x80, 0x63, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x6E,
-    0x93, 0xE1, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x29, 0x00, 0x00, 0x06, 0x90, 0x2F, 0xF8, 0x3F, 0xFC,
-    0x7F, 0xFD, 0x7F, 0xFC, 0x3F, 0xF8, 0x0B, 0x90, 0x28, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xF8,
-    0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0,
-    0x3F, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0xFF, 0xFE,
-    0xFD, 0x14, 0x00, 0x1F, 0x80, 0x0F, 0xC3, 0xFD, 0x03, 0xFE, 0x3F, 0xD0, 0x3F, 0xE3, 0xFC, 0x02,
-    0xFD, 0x05, 0x00, 0x05, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF2, 0xFE, 0x00, 0x0B, 0xF8,
-    0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xEF, 0xD0, 0x00, 0xBF, 0x40, 0x02, 0xFD,
-    0x14, 0x00, 0x00, 0x50, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xDB, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x74, 0x38, 0x1F, 0xFC, 0x74, 0x05,
-    0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xF4, 0x1C, 0x2E, 0x50, 0x0D, 0x0B, 0x00,
-    0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0, 0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0x40, 0x07, 0xFC,
-    0x00, 0xEA, 0x70, 0x38, 0xA2, 0xCA, 0x0A, 0x0A, 0x40, 0xA0, 0x10, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xD0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x0F,
-    0x0E, 0x00, 0x00, 0x3C, 0x38, 0xBF, 0xFF, 0xF0, 0xEB, 0x55, 0x6D, 0x2C, 0xA0, 0x07, 0x4B, 0x0A,
-    0x01, 0xD2, 0xC0, 0xA0, 0x74, 0xB0, 0x0A, 0x04, 0x04, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x2D, 0x3C, 0x00, 0x0B, 0x4F, 0x00, 0x02, 0xC3,
-    0xC0, 0x00, 0xB0, 0xFF, 0xFF, 0xE3, 0x87, 0x95, 0x5E, 0x0E, 0x1D, 0x00, 0xA0, 0x38, 0x74, 0x0A,
-    0x00, 0xE1, 0xD0, 0xA0, 0x01, 0x01, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x7F, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xD0,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0xBC, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF0,
-    0x2D, 0x00, 0x64, 0x00, 0x00, 0x1A, 0x40, 0x0B, 0xD0, 0x0F, 0x81, 0xF0, 0x2F, 0xFE, 0x00, 0x07,
-    0xFF, 0xD0, 0x0F, 0xC0, 0xFC, 0x0F, 0x02, 0xFA, 0xFF, 0x00, 0x7F, 0xAF, 0xD0, 0x2F, 0xFF, 0xD0,
-    0x78, 0x1F, 0x40, 0xBD, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0xFC, 0x03, 0xC0, 0xFC, 0x00, 0xF8, 0x1F,
-    0x40, 0x2F, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xE0, 0x03, 0xF0, 0xBC, 0x00, 0x7D, 0x00, 0x00, 0x01,
-    0xF0, 0x1F, 0x40, 0x0F, 0xC3, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x2F, 0x0F,
-    0xC0, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xFC, 0x3F, 0x00, 0x1F, 0x40, 0x00, 0x03,
-    0xD0, 0x03, 0xE0, 0x03, 0xE0, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x1F, 0x42,
-    0xF4, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x03, 0xF0, 0x1F, 0x40, 0x00, 0x0F,
-    0x80, 0x00, 0x3F, 0xAF, 0xD0, 0x0B, 0xFA, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0B, 0xD0, 0x3F, 0x41, 0xFC,
-    0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x0F, 0x80, 0xBC, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0A,
-    0x00, 0xBD, 0x03, 0xE0, 0x3F, 0x42, 0xFC, 0x1F, 0xC0, 0xFE, 0x0F, 0xE0, 0x7F, 0x07, 0xF0, 0x3F,
-    0x43, 0xF4, 0x1F, 0xC0, 0xF8, 0x0F, 0xC0, 0xBC, 0x03, 0xD0, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x0A, 0x00, 0x60, 0x02, 0xF4, 0x0F, 0x80, 0xBC, 0x03, 0xF4, 0x2F, 0xC0, 0xFD,
-    0x07, 0xF0, 0x3F, 0x82, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x1F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F,
-    0x41, 0xFC, 0x0F, 0xD0, 0x3E, 0x03, 0xF0, 0x1F, 0x80, 0xBC, 0x03, 0xD0, 0x2F, 0x00, 0x70, 0x03,
-    0x80, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F,
-    0x80, 0x7F, 0x00, 0xBD, 0x00, 0xFC, 0x01, 0xF0, 0x02, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x60, 0x0B,
-    0xC0, 0x1F, 0x40, 0xFE, 0x02, 0xFC, 0x07, 0xF0, 0x1F, 0xD0, 0x3F, 0x80, 0xFE, 0x01, 0xFC, 0x03,
-    0xF0, 0x0B, 0xD0, 0x2F, 0x80, 0x3F, 0x00, 0xFC, 0x01, 0xF0, 0x03, 0xD0, 0x0B, 0x00, 0x1C, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x2F, 0x00, 0x7D, 0x01, 0xF8, 0x0F, 0xE0, 0x2F,
-    0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF4, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x02, 0xFC, 0x07, 0xF0, 0x0F,
-    0xC0, 0x3F, 0x40, 0xBD, 0x02, 0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xBD, 0x01, 0xF0, 0x03,
-    0xD0, 0x0F, 0x80, 0x2C, 0x00, 0x70, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0x8F, 0x80, 0x07, 0xE0, 0x3E, 0x01, 0xF8,
-    0x00, 0xF8, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x04, 0x00, 0x3E, 0x00, 0xFC, 0x07, 0xF0, 0x1F, 0xD0,
-    0xBF, 0x80, 0xFF, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x07, 0xF0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x05,
-    0x10, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF4,
-    0x03, 0xFC, 0x02, 0xFD, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x02, 0xC3, 0xC0, 0x00, 0x40, 0x02, 0xE0, 0x3C, 0x00,
-    0xF8, 0x02, 0xE0, 0x03, 0xC0, 0x7F, 0x01, 0xE0, 0x00, 0x7C, 0x0B, 0x41, 0xF0, 0x00, 0x07, 0xC0,
-    0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x00, 0xB8,
-    0xF0, 0x00, 0x00, 0xFC, 0x0B, 0xF0, 0x1F, 0x40, 0x3F, 0x00, 0xF8, 0x0B, 0xE0, 0x0B, 0x80, 0xFF,
-    0x40, 0xF4, 0x00, 0x00, 0xB4, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0xF0, 0x00, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x0F, 0x40, 0xF0, 0x00, 0x78, 0x07, 0xF0,
-    0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x1C, 0x00, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x02, 0xA0, 0xFE, 0x00, 0x3F, 0x83, 0xF4,
-    0x00, 0xFD, 0x1F, 0xD0, 0x07, 0xF4, 0x7F, 0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x7F, 0x07, 0xF0, 0x01,
-    0xFC, 0x1F, 0xC0, 0x07, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xFC,
-    0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xFC, 0x0F,
-    0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x2F, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x0A, 0x43, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03,
-    0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0x14, 0x00, 0x05, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xE5, 0x55, 0x55, 0x55, 0x50, 0x7F, 0xF9, 0xBF, 0xFE, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x01, 0xFE, 0x40, 0x03, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFC, 0x03, 0xEA, 0xFF, 0x00, 0x7E,
-    0xAF, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x1B, 0xFD, 0x00, 0x02, 0xFF, 0xC0,
-    0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x2A, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0x80,
-    0x00, 0x0B, 0xF4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x46, 0xF9, 0x00, 0x00, 0x0F, 0xD3, 0xFF, 0xF4, 0x00, 0x0B, 0xF1, 0xFF, 0xFF, 0x40, 0x02, 0xFC,
-    0x3E, 0xAF, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xD0, 0x0B, 0xE0,
-    0x00, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x80,
-    0x00, 0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x6F, 0xF4, 0x01, 0xF4, 0x07, 0xFF, 0xF8, 0x00, 0x7D, 0x03,
-    0xFF, 0xF8, 0x00, 0x1F, 0x40, 0xFF, 0xD0, 0x00, 0x03, 0xD0, 0x2F, 0x40, 0x00, 0x00, 0xF4, 0x07,
-    0xC0, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0x80, 0x7F,
-    0x80, 0x00, 0x07, 0xF8, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x54,
-    0x00, 0x00, 0x05, 0x40, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xBE, 0x40, 0x03, 0xF4,
-    0x00, 0xFF, 0xFD, 0x01, 0xFD, 0x00, 0x7F, 0xFF, 0xD0, 0x7F, 0x00, 0x0F, 0xAB, 0xFC, 0x1F, 0xC0,
-    0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00,
-    0x00, 0x1B, 0xFD, 0x3F, 0x00, 0x01, 0xFF, 0xFE, 0x0F, 0xC0, 0x00, 0xFF, 0xFE, 0x03, 0xF0, 0x00,
-    0x3F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x3C, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x1A, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x01, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xF9, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0x40, 0x1F, 0x0B, 0xE5, 0xFF, 0xEB, 0xF8,
-    0x3C, 0x00, 0x6F, 0xFF, 0x80, 0x50, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x90, 0x0A, 0x00, 0x60, 0x02,
-    0x40, 0x2F, 0x40, 0xF8, 0x0B, 0xC0, 0x7E, 0x03, 0xF4, 0x2F, 0xC0, 0xFD, 0x0B, 0xE0, 0x7F, 0x03,
-    0xF8, 0x2F, 0xC0, 0xFD, 0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x2F, 0xC1, 0xFC, 0x0F, 0xD0, 0x7F, 0x03,
-    0xF4, 0x3F, 0x41, 0xFC, 0x0F, 0xD0, 0x7E, 0x03, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0xBC, 0x03,
-    0xD0, 0x2F, 0x01, 0xF4, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x7F, 0x47, 0xF8, 0x3F,
-    0x00, 0x3F, 0x1F, 0x80, 0x0B, 0xDB, 0xD0, 0x01, 0xF7, 0xF0, 0x00, 0x7E, 0xFC, 0x00, 0x1F, 0xBF,
-    0x00, 0x07, 0xEF, 0xC0, 0x02, 0xF6, 0xF4, 0x00, 0xFC, 0x7F, 0x00, 0x7F, 0x0F, 0xE0, 0x7F, 0x01,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xBC, 0x00, 0x2F, 0x2F,
-    0x00, 0x1F, 0x4B, 0xC0, 0x0F, 0x82, 0xF0, 0x0F, 0xC0, 0xBC, 0x0B, 0xE5, 0x7F, 0x52, 0xFF, 0xFF,
-    0xFE, 0x2A, 0xAB, 0xFA, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xD0, 0xFF, 0xFE, 0x0F, 0xAA, 0x90, 0xF4, 0x00, 0x0F, 0x00, 0x01, 0xFF,
-    0x90, 0x1F, 0xFF, 0x80, 0x06, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E,
-    0x00, 0x7F, 0xCF, 0xFF, 0xF0, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0,
-    0x00, 0xBF, 0xE4, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0xB9, 0x00, 0xBF,
-    0xFF, 0xD0, 0xFE, 0x5B, 0xF4, 0xFC, 0x01, 0xFC, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0xFC, 0xBD, 0x00,
-    0xFC, 0x7F, 0x42, 0xF4, 0x2F, 0xFF, 0xF0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFC, 0x3E, 0xAA, 0xFC, 0x3C, 0x01, 0xF4, 0x34, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x01, 0xFF, 0xFE, 0x0F, 0x80, 0xBC, 0x7D, 0x01, 0xF4, 0xF8, 0x07, 0xC3, 0xF8, 0x7E,
-    0x03, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0xBD, 0x7F, 0xCB, 0xD0, 0x2F, 0x7F, 0x00, 0x3E, 0xFC, 0x00,
-    0xFA, 0xF4, 0x0B, 0xD3, 0xFF, 0xFE, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x02, 0xFF, 0xFD, 0x1F, 0xC1, 0xFC, 0xBC, 0x01, 0xFB, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xEF,
-    0x80, 0x3F, 0x3F, 0xE6, 0xFC, 0x3F, 0xFF, 0xE0, 0x1B, 0xBF, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0,
-    0x02, 0xFD, 0x06, 0xFF, 0xD0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC7, 0xF8, 0x01, 0xFF,
-    0xBF, 0xF8, 0x01, 0xBF, 0x43, 0xF0, 0x01, 0xF4, 0x07, 0xC0, 0x07, 0xD0, 0x1F, 0x40, 0x1F, 0x40,
-    0x7D, 0x00, 0x7D, 0x01, 0xF4, 0x01, 0xF4, 0x07, 0xD0, 0x07, 0xD0, 0x1F, 0x40, 0x7F, 0xD0, 0xFF,
-    0x83, 0xFF, 0x8B, 0xFF, 0x00, 0x00, 0x19, 0x40, 0x00, 0xBF, 0xFD, 0x00, 0xFF, 0xFF, 0xD0, 0xBE,
-    0x02, 0xFC, 0x3F, 0x00, 0x3F, 0x1F, 0x40, 0x0B, 0xDB, 0xC0, 0x01, 0xFB, 0xF0, 0x00, 0x7E, 0xFC,
-    0x00, 0x1F, 0xBF, 0x00, 0x07, 0xDB, 0xC0, 0x02, 0xF6, 0xF8, 0x00, 0xFC, 0x3F, 0x00, 0xBE, 0x0B,
-    0xFA, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x04, 0x00, 0x1B, 0xD0, 0x3F, 0xFC,
-    0x02, 0xFF, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x6F, 0xF9, 0x3F, 0xFF, 0xF0, 0x55,
-    0x54, 0x00, 0x69, 0x00, 0x0B, 0xFF, 0xC0, 0x3F, 0xEF, 0xF0, 0xBD, 0x03, 0xF4, 0xBC, 0x02, 0xF4,
-    0x28, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xBE, 0x00, 0x02,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x15, 0x55,
-    0x50, 0x01, 0x64, 0x00, 0x7F, 0xFE, 0x07, 0xFA, 0xFE, 0x2E, 0x00, 0xFC, 0x20, 0x03, 0xE0, 0x00,
-    0x2F, 0x40, 0x07, 0xF4, 0x02, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x5A, 0xFF, 0x0B, 0xFF, 0xE0, 0x0B, 0xA4, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x3E, 0xBC,
-    0x00, 0x3F, 0x2F, 0x00, 0x2F, 0x0B, 0xC0, 0x1F, 0x42, 0xF0, 0x0F, 0x80, 0xBC, 0x0B, 0xFF, 0xFF,
-    0xF5, 0xFF, 0xFF, 0xFE, 0x05, 0x56, 0xF5, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0xF4, 0x00, 0x0F, 0x00, 0x01, 0xF9, 0x00,
-    0x1F, 0xFE, 0x01, 0xBF, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00,
-    0x0F, 0xD5, 0x6F, 0xF8, 0xFF, 0xFD, 0x02, 0xE9, 0x00, 0x00, 0x01, 0x90, 0x00, 0x2F, 0xF4, 0x01,
-    0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF,
-    0xF0, 0xFC, 0x07, 0xF8, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0xFC, 0xBE, 0x00, 0xF8,
-    0x3F, 0xDB, 0xF4, 0x0F, 0xFF, 0xD0, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFC, 0x3C, 0x00, 0xF8, 0x38, 0x02, 0xF0, 0x24, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x2F,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x65, 0x00, 0x2F, 0xFF, 0x42, 0xF9,
-    0xBF, 0x0F, 0x40, 0x7D, 0x7D, 0x01, 0xF0, 0xFC, 0x0B, 0xC1, 0xFD, 0xFC, 0x01, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xD0, 0xFC, 0x2F, 0xCB, 0xC0, 0x1F, 0xBE, 0x00, 0x3E, 0xFC, 0x00, 0xFA, 0xF9, 0x1F, 0xC3,
-    0xFF, 0xFC, 0x01, 0xAE, 0x40, 0x00, 0x64, 0x00, 0x3F, 0xFE, 0x03, 0xFE, 0xFE, 0x1F, 0x40, 0xBD,
-    0xFC, 0x00, 0xFB, 0xF0, 0x03, 0xFB, 0xC0, 0x0F, 0xDF, 0xC0, 0x3F, 0x2F, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xD0, 0x05, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x0B, 0xFC, 0x07, 0xFF, 0x80, 0x0B, 0xA0,
-    0x00, 0x15, 0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x1B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xD0, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x07, 0xC0, 0x0F, 0xD0, 0x00, 0x3C, 0x00, 0xFD, 0x00, 0x01,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFE, 0x55, 0x54, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x01, 0x5F, 0xE5, 0x40, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x01, 0xAF, 0xEA,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFA, 0xFE, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x02,
-    0xF0, 0x00, 0x2F, 0x40, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x15, 0xFD, 0x55, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0A, 0xAF, 0xEA, 0xA4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2B, 0xFA, 0xAA, 0xAA, 0xD1, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x43, 0xFE, 0xBF, 0xFF, 0xFC, 0x07, 0x80, 0x00, 0x15, 0x40, 0x16, 0xAF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x95, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xFA, 0xA4, 0x02, 0xFE, 0x40, 0x3F, 0x40, 0x1F,
-    0xE2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0xFE, 0x5B, 0xFE, 0x06, 0xBF, 0xAA, 0x03, 0xE0, 0x2E,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x74, 0x0F, 0xFF, 0xE4, 0x00, 0x03, 0xF0,
-    0x00, 0x7D, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFF,
-    0xF0, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x40, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0x80, 0x3F, 0x07, 0xF9,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x1E, 0x00, 0xF9, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFC, 0xBE,
-    0xAF, 0xCF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD1, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x7D, 0x00, 0x0F, 0xF0, 0x00, 0x3D, 0x00, 0x2F,
-    0xC0, 0x00, 0x3C, 0x00, 0x3F, 0x40, 0x00, 0x20, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x16, 0xFD, 0x55, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x6B, 0xFE, 0xAA, 0x80, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x55, 0xBD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x01, 0xF9, 0x56, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xAA,
-    0xAA, 0xAB, 0xFE, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x1F, 0x6D, 0x7D, 0x2F, 0x4B, 0x47, 0xD7, 0x42,
-    0xE0, 0x74, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD2, 0xAA, 0xAA, 0xA5, 0x5B, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFA, 0xAA, 0xAA, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x03, 0x42, 0xE0, 0x72, 0xF4,
-    0xB4, 0x7E, 0x2F, 0x2D, 0x7E, 0x02, 0xFB, 0xBE, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x0B, 0xC0,
-    0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x0B, 0xE5, 0x55,
-    0x55, 0x6F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0xAA, 0xAA, 0xAA, 0xF8, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00,
-    0xBC, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B,
-    0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x0B, 0xEE, 0xF8, 0x0F, 0xCB, 0x8F, 0xCB, 0xC2, 0xE0, 0xF8, 0xC0,
-    0xB8, 0x0C, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x80, 0xB8, 0x08, 0xBC, 0x2E, 0x0F, 0x8F,
-    0xCB, 0x8F, 0xC0, 0xFE, 0xEF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBE,
-    0xEF, 0x80, 0x0B, 0xDB, 0x9F, 0x80, 0xBD, 0x2E, 0x1F, 0x80, 0xD0, 0xB8, 0x1C, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x0D, 0x0B, 0x81, 0xC0, 0xBD, 0x2E, 0x1F, 0x80, 0xBD, 0xB9, 0xF8, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xB8, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2E,
-    0x00, 0x20, 0x0B, 0x80, 0x2F, 0x02, 0xE0, 0x2F, 0x40, 0xB8, 0x2F, 0x40, 0x2E, 0x1F, 0x40, 0x0B,
-    0x9F, 0x95, 0x57, 0xEF, 0xFF, 0xFF, 0xF9, 0xFA, 0xAA, 0xA9, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x02, 0x00, 0x2E, 0x03, 0xE0, 0x0B, 0x80, 0x7E, 0x02, 0xE0,
-    0x07, 0xD0, 0xB8, 0x00, 0x7D, 0x2F, 0x55, 0x5B, 0xDB, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xFD, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x80, 0x00, 0x2F, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00,
-    0x2F, 0x07, 0xE5, 0x55, 0x55, 0xBC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBE, 0xAA, 0xAA, 0xAA, 0x40,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xFA, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF7, 0xEA, 0xAA, 0xAA, 0xAA, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x55,
-    0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xEF, 0x40, 0x00, 0x7D, 0x1F, 0x40, 0x07,
-    0xF4, 0x7F, 0x40, 0x7F, 0xD1, 0xFF, 0x47, 0xDF, 0x47, 0xDF, 0x49, 0x3D, 0x1F, 0x18, 0x00, 0xF4,
-    0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xF4, 0x7C,
-    0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xF4, 0x7C, 0x00,
-    0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xFF, 0xFF, 0xFE, 0xBF, 0x43,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xAA, 0xAA, 0xAA, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x55, 0x55,
-    0x55, 0x55, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00,
-    0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xF4,
-    0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x05, 0x3D, 0x1F, 0x14, 0x7C, 0xF4, 0x7C,
-    0xF4, 0xBF, 0xD1, 0xFF, 0x80, 0xBF, 0x47, 0xF8, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0xBD, 0xF8, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x0F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x03, 0xFA, 0xAA,
-    0xAB, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFA, 0xAA, 0xAA, 0xAB, 0xE1, 0xF0, 0x00, 0x00,
-    0x00, 0x3D, 0x3E, 0x55, 0x55, 0x55, 0x6F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xC0, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00,
-    0x00, 0x2F, 0x81, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xF0,
-    0x00, 0x00, 0x2F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xE0, 0x00,
-    0x7F, 0xAA, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xAA, 0xAF, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x3E, 0x00, 0x00, 0x00, 0xBF, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFD,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xF2, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0x80,
-    0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xAF, 0x9F, 0xC0, 0x02, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFD, 0x5F, 0xFC, 0x03, 0xF4, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x07,
-    0xE0, 0xBD, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xF0, 0x00,
-    0x0F, 0x81, 0xF8, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x02, 0xF0, 0x03, 0xF0,
-    0x01, 0xF8, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xEA, 0xBF, 0xC0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF3, 0xFF, 0xFF, 0xBF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0x3A, 0xAA, 0xAB, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xBA,
-    0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x07, 0xFF, 0xF9, 0x02, 0xF4, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF1, 0xF8, 0x00, 0x3F, 0xFA, 0x5B, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0xE0, 0x0B, 0xE0, 0x00,
-    0x00, 0xFD, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0xFC, 0x0B, 0xE0,
-    0xBE, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x1F, 0x83, 0xF4, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x2F,
-    0x80, 0xFD, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x2F, 0xC0, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF,
-    0x80, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xFE, 0x41, 0x7F, 0xF0, 0x00, 0x7E, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7E, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x0A, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEF,
-    0xD0, 0x00, 0x00, 0x07, 0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0x43, 0xF8,
-    0x00, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0xFE, 0x00,
-    0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x03,
-    0xF0, 0x00, 0x1F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0x1F, 0x80,
-    0x00, 0x07, 0xF0, 0x2F, 0x40, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x95, 0x55,
-    0x5B, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFE, 0xAA, 0x5A, 0xAB, 0xF0, 0xFF, 0x00, 0x00, 0x01,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0xBD, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x00, 0x1F,
-    0x80, 0x1F, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0xBF, 0x00, 0x02, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0xE0, 0x0F, 0x80, 0x00, 0x02, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00,
-    0x00, 0x0F, 0xE1, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFA,
-    0xAA, 0xAA, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x01, 0xF8, 0x00, 0x03,
-    0xF0, 0x00, 0xBE, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0xEA, 0xAA, 0xFF, 0xBF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xBD, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x00,
-    0x00, 0x03, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0xEB, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFA, 0xAA,
-    0xAA, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xF9, 0x55, 0x55,
-    0x54, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xCB, 0xFA, 0xAA, 0xAA, 0xAB, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x55, 0x55, 0x55,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x55, 0x55, 0x50,
-    0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xEB, 0xFF, 0xEA, 0xAA, 0xAB, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0xAA, 0xAA, 0xAB, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xF8,
-    0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xAF, 0xFB, 0xFE,
-    0xAA, 0xAF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0xF4,
-    0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xF4,
-    0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0xFF, 0x00, 0x00, 0x01, 0xFA,
-    0xFF, 0x02, 0xAA, 0xAA, 0xBF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFA, 0xAA, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xD1, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC1, 0x7F, 0xFA, 0xAA, 0xAB, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF4, 0x02, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF2, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFA, 0xAA, 0xAA, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0xBC,
-    0x03, 0xFD, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x7F, 0xC0, 0x00, 0x18, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x1E, 0x03, 0xF8, 0x00, 0x00, 0x3E, 0x0B,
-    0xF0, 0x00, 0x00, 0x3E, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x15, 0x55, 0x55,
-    0x52, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x08, 0x03, 0xD0, 0x14, 0x7E, 0x0B, 0x43, 0xF0, 0xFF, 0x6D, 0xBF, 0x80, 0x7F, 0xFF, 0xE0,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x07, 0xF8, 0xB5, 0xFF, 0x0F,
-    0x43, 0xD0, 0xB8, 0x10, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x1F, 0x40, 0xFC, 0x3E, 0x00,
-    0x3D, 0x3D, 0x00, 0x3E, 0x3D, 0x00, 0x3E, 0x3E, 0x00, 0x3D, 0x2F, 0x40, 0xFC, 0x0F, 0xFF, 0xF4,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xE3, 0xFE, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x3F, 0xFE, 0x00, 0x0B, 0xD0, 0x0F, 0xFF, 0xC0, 0x03, 0xF0, 0x02, 0xAB, 0xF0,
-    0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xF0,
-    0x0F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x42, 0xF0, 0x00, 0x00, 0x07, 0xE0,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0x00, 0x00, 0x00, 0x07, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xB9, 0x00, 0x2F, 0x0F, 0xFF, 0x80, 0xBE, 0x2F, 0x9B,
-    0xE1, 0xF4, 0x3D, 0x01, 0xFB, 0xC0, 0x7C, 0x00, 0x7F, 0x40, 0xBC, 0x00, 0x3E, 0x00, 0xBC, 0x00,
-    0x3F, 0x00, 0x7D, 0x00, 0xFB, 0xC0, 0x3F, 0x9B, 0xD2, 0xF4, 0x1F, 0xFF, 0x40, 0xFE, 0x02, 0xF8,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB9, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0xE0, 0x1F, 0xFF,
-    0x02, 0xF9, 0xBE, 0x1F, 0x9F, 0xE0, 0xF8, 0x07, 0xEF, 0x00, 0xBC, 0x3C, 0x00, 0xBF, 0x00, 0x1F,
-    0x1F, 0x00, 0x0F, 0x80, 0x03, 0xC7, 0xC0, 0x07, 0xF4, 0x01, 0xF0, 0xF4, 0x07, 0xEF, 0x00, 0xBC,
-    0x3F, 0x9B, 0xD3, 0xF9, 0xBD, 0x03, 0xFF, 0xD0, 0x2F, 0xFE, 0x00, 0x2F, 0x80, 0x01, 0xBD, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x29, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x15,
-    0x29, 0x02, 0x93, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F,
-    0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07,
-    0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3,
-    0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0,
-    0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E,
-    0x3F, 0x07, 0xE1, 0x50, 0x15, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xF7, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0x80, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x01, 0xF8,
-    0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0x40,
-    0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD7, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x7E, 0x00,
-    0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x0B, 0xD2, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00,
-    0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00,
-    0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x03,
-    0xF0, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x7F,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x95, 0xBF, 0xF0, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0xFD,
-    0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00,
-    0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E,
-    0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40,
-    0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00,
-    0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB,
-    0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00,
-    0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01,
-    0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD,
-    0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00,
-    0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F,
-    0xAF, 0x40, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0x0F, 0xD3, 0xF4,
-    0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF9, 0x45, 0xBF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xE0, 0x7D, 0x00, 0x00, 0xFD,
-    0x01, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x80, 0x3F,
-    0x40, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x07, 0xE0, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x14, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x06, 0x43, 0xFC, 0x3F,
-    0xD3, 0xFC, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x3F, 0xD3, 0xFD, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0x40, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x7F, 0xD0, 0x00, 0x00, 0xFF,
-    0x4F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF9, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0x40, 0x1F, 0x0B, 0xE5, 0xFF, 0xEB, 0xF8, 0x3C, 0x00,
-    0x6F, 0xFF, 0x80, 0x50, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00,
-    0x02, 0x80, 0xFF, 0xFF, 0x80, 0x1F, 0x0F, 0xD1, 0xBF, 0xFB, 0xF4, 0x3C, 0x00, 0x2F, 0xFF, 0x40,
-    0x50, 0x00, 0x05, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0x55, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4,
-    0x00, 0x04, 0x0B, 0xFF, 0x40, 0x2E, 0x2F, 0xFF, 0xF4, 0x7E, 0x3F, 0x07, 0xFF, 0xFC, 0x3C, 0x00,
-    0xBF, 0xF0, 0x04, 0x00, 0x05, 0x40, 0x02, 0xF8, 0x00, 0x08, 0x0F, 0xFF, 0x80, 0x3E, 0x3F, 0xFF,
-    0xF9, 0xBE, 0x3E, 0x02, 0xFF, 0xFC, 0x3C, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF9, 0x40, 0x00, 0x5B, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xAA, 0xA9, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xEA, 0xAA, 0xFF, 0xC2, 0x40, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x01, 0xF0, 0x05, 0x55,
-    0x5F, 0x94, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x55, 0xF9, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xD0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA,
-    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xFF, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x0B,
-    0xFD, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x07, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xFF, 0x40,
-    0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x01, 0x55, 0x55, 0x56, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x05, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x07, 0xFE, 0x95, 0xBE, 0x55, 0x47, 0xF8, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x01,
-    0xFC, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0x80, 0x00, 0x1F,
-    0xC0, 0x07, 0xD0, 0x00, 0x03, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0xF8, 0x00, 0x00, 0x0B,
-    0xFE, 0xBE, 0x55, 0x55, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xE5, 0x55, 0x55, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x55, 0x55, 0x6F, 0xAF, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0xFF, 0x40, 0x00, 0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0xFD, 0x00, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x01, 0xFC, 0x00, 0x0B,
-    0xC0, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x01, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xBC,
-    0x00, 0x0B, 0xF0, 0x00, 0x3E, 0x00, 0x0B, 0xF4, 0x15, 0x5F, 0x95, 0x6F, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x56, 0xF9, 0x55, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x01, 0xAA, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x07,
-    0x41, 0xFD, 0x00, 0x01, 0xF4, 0x01, 0xD0, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x74, 0x00, 0x7C, 0x00,
-    0xF4, 0x00, 0x1D, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x07, 0x40, 0x00, 0xF4, 0x2D, 0x00, 0x01, 0xD0,
-    0x00, 0x1E, 0x0F, 0x00, 0x00, 0x74, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x1D, 0x00, 0x00, 0xF1, 0xF5,
-    0x55, 0x5B, 0x95, 0x55, 0x7D, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xAA, 0xAA, 0xFE, 0xAA,
-    0xAB, 0xD3, 0xC0, 0x00, 0x1D, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x3D, 0x00,
-    0x01, 0xD0, 0x00, 0x1F, 0x07, 0x80, 0x00, 0x74, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x1D, 0x00, 0x07,
-    0xC0, 0x1F, 0x00, 0x07, 0x40, 0x03, 0xD0, 0x02, 0xF0, 0x01, 0xD0, 0x03, 0xE0, 0x00, 0x2F, 0x80,
-    0x74, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x6E, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF5, 0x55, 0x55, 0x55,
-    0x55, 0x7D, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xD3, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x40, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0,
-    0x00, 0x01, 0xFE, 0x55, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05,
-    0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0xBF, 0xEA, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFB, 0xE0, 0x00, 0x03, 0xFB, 0xC0,
-    0x7C, 0x3E, 0x00, 0x03, 0xF0, 0xF4, 0x2D, 0x03, 0xE0, 0x03, 0xF0, 0x1E, 0x0F, 0x00, 0x3E, 0x03,
-    0xF0, 0x03, 0xC3, 0xC0, 0x03, 0xE3, 0xF0, 0x00, 0xF1, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x2D, 0x78,
-    0x00, 0x07, 0xF0, 0x00, 0x0B, 0x5E, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xD3, 0xC0, 0x03, 0xF7, 0xE0,
-    0x00, 0xF0, 0xF0, 0x03, 0xF0, 0x3E, 0x00, 0x3C, 0x3D, 0x03, 0xF0, 0x03, 0xE0, 0x1F, 0x07, 0x83,
-    0xF0, 0x00, 0x3E, 0x0B, 0x40, 0xF7, 0xF0, 0x00, 0x03, 0xE7, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFE,
-    0x55, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF,
-    0xEA, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xFB, 0xC0, 0x7C, 0x00, 0x00,
-    0x02, 0xF0, 0xF4, 0x2D, 0x00, 0x00, 0x02, 0xF0, 0x1E, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xC3,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0xF1, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x2D, 0x78, 0x00, 0x02, 0xF0,
-    0x00, 0x0B, 0x5E, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xD3, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xF0, 0xF0,
-    0x02, 0xF0, 0x00, 0x00, 0x3C, 0x3D, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x07, 0x82, 0xF0, 0x00, 0x00,
-    0x0B, 0x40, 0xF6, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF4,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x55, 0x6F, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFC, 0x3F,
-    0xE3, 0xFE, 0x2F, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xDB, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x10, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0xBE, 0x40, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x81, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE4, 0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC2, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_16_regularBitmaps[38099] = {
+    0xB5, 0x55, 0x3B, 0x8F, 0xDD, 0x44, 0x18, 0x3D, 0x63, 0x67, 0x63, 0x94, 0x91, 0x70, 0x8A, 0xA4,
+    0x5A, 0x84, 0x29, 0x68, 0x40, 0x5A, 0xFC, 0x07, 0x72, 0x77, 0x4C, 0x45, 0x9B, 0x22, 0x57, 0x94,
+    0x34, 0x29, 0x91, 0x68, 0x29, 0x92, 0xEB, 0x0B, 0x14, 0xE9, 0x68, 0xF8, 0x0B, 0xA9, 0x6E, 0x03,
+    0x05, 0xC5, 0x0A, 0xED, 0xAE, 0x47, 0xDA, 0x22, 0xED, 0x34, 0x68, 0x0B, 0x24, 0x64, 0x11, 0x68,
+    0x08, 0x12, 0x13, 0xC9, 0x20, 0x27, 0x19, 0x7B, 0x38, 0xDF, 0xDC, 0xBB, 0x64, 0x79, 0x14, 0x34,
+    0xCC, 0xCE, 0xF8, 0x7A, 0x1E, 0xFE, 0x1E, 0xE7, 0x9C, 0x6F, 0xF6, 0xDA, 0x67, 0xA3, 0x79, 0x6F,
+    0x68, 0x0B, 0xCF, 0x6E, 0xF2, 0x97, 0xBD, 0xCE, 0xFC, 0x15, 0x00, 0xEA, 0xA1, 0x39, 0x0B, 0xC6,
+    0xDE, 0xDE, 0x53, 0x5F, 0xF4, 0xF7, 0x57, 0xFA, 0xBC, 0x3F, 0x59, 0xE9, 0x33, 0x77, 0xBC, 0xE0,
+    0xE3, 0xDE, 0xA2, 0x38, 0xB3, 0xF7, 0x20, 0xED, 0xB6, 0x6A, 0x80, 0x5B, 0xF0, 0x40, 0x85, 0x8F,
+    0x01, 0xBD, 0x3E, 0x00, 0x72, 0x57, 0x02, 0xCB, 0xDF, 0xDE, 0xFF, 0xB6, 0xE9, 0x62, 0x8C, 0xFE,
+    0xED, 0x6E, 0x33, 0x3F, 0x44, 0xD9, 0x2C, 0xB8, 0x63, 0xB9, 0xA3, 0x7C, 0x61, 0x81, 0xA3, 0xAC,
+    0x07, 0x16, 0x18, 0x50, 0xF2, 0xCC, 0x54, 0xF0, 0x11, 0x91, 0x79, 0xBD, 0x06, 0xBE, 0xCE, 0x9D,
+    0xEC, 0xD0, 0x64, 0x09, 0x3A, 0x29, 0xEC, 0x3B, 0xF4, 0xD3, 0x28, 0x5C, 0xB4, 0x61, 0x37, 0xFC,
+    0x76, 0xEC, 0x3D, 0x03, 0xDA, 0xE8, 0x55, 0x7C, 0x11, 0x72, 0xEF, 0x67, 0x6D, 0xFD, 0x61, 0x69,
+    0xFD, 0x82, 0xE3, 0xCD, 0xD2, 0x79, 0xE8, 0xC1, 0x23, 0x8F, 0xF4, 0xD5, 0xF1, 0x5C, 0x15, 0x2D,
+    0x54, 0x1C, 0xA0, 0x1E, 0x07, 0x28, 0x37, 0xBD, 0xAA, 0xDC, 0xCA, 0x64, 0x69, 0x9C, 0x98, 0x4F,
+    0x5D, 0xA8, 0x7F, 0x3F, 0x1F, 0x74, 0x8C, 0x4E, 0x75, 0xB3, 0xC4, 0xFA, 0xEF, 0xE3, 0xA2, 0xBD,
+    0x01, 0xEC, 0xFF, 0x08, 0xD4, 0xEC, 0x71, 0x8D, 0xAA, 0x41, 0xFD, 0x80, 0xC9, 0xAC, 0xD9, 0x0D,
+    0x63, 0x86, 0xB6, 0xDA, 0xE6, 0x3D, 0x72, 0x9F, 0x79, 0xC5, 0x28, 0x03, 0xEE, 0x4B, 0xD0, 0x87,
+    0x3C, 0x78, 0xC4, 0xC4, 0xB8, 0x79, 0x0B, 0x69, 0xF3, 0x00, 0x77, 0x71, 0x82, 0xB1, 0xCA, 0x62,
+    0x5F, 0xDA, 0x50, 0x66, 0xCF, 0x63, 0x46, 0x38, 0x3E, 0x19, 0xB4, 0xAB, 0x42, 0x6E, 0x03, 0x46,
+    0x20, 0xEB, 0x0F, 0x61, 0x04, 0xB7, 0xAA, 0x29, 0x19, 0xC0, 0x50, 0xB8, 0x8C, 0x16, 0x8F, 0xD5,
+    0x40, 0xAB, 0x04, 0xEA, 0x90, 0x7F, 0xEC, 0xA5, 0x65, 0x0C, 0x15, 0xB2, 0x81, 0x67, 0x18, 0x86,
+    0xF9, 0xD2, 0x31, 0x06, 0xA6, 0xEE, 0x90, 0x11, 0xCF, 0x9B, 0xA4, 0xE9, 0xFA, 0x2E, 0xF2, 0xD6,
+    0x09, 0xBD, 0xC4, 0x9B, 0x6D, 0xFA, 0x40, 0x26, 0x41, 0xD1, 0x0D, 0x7D, 0xD0, 0x10, 0xAA, 0x35,
+    0xBF, 0x46, 0xD1, 0x0B, 0x49, 0x6A, 0x64, 0x0A, 0xFC, 0x40, 0xFC, 0xD1, 0x81, 0xBC, 0xE7, 0x72,
+    0x92, 0x66, 0x99, 0xB5, 0x25, 0xAE, 0x65, 0xF4, 0xF9, 0x30, 0xA1, 0x6E, 0xB2, 0xB1, 0xB2, 0x85,
+    0x43, 0xC8, 0x02, 0xF3, 0x34, 0x30, 0x76, 0xC1, 0x0F, 0xF2, 0xA9, 0x6A, 0x72, 0x0F, 0xF3, 0xC4,
+    0x62, 0x06, 0x33, 0x44, 0xED, 0x50, 0x4D, 0xC8, 0x67, 0x68, 0xB2, 0x60, 0x62, 0x7C, 0x11, 0xC7,
+    0x2C, 0xC6, 0x9E, 0x6B, 0x6A, 0x09, 0xDC, 0xC0, 0xDE, 0xE1, 0x6A, 0xB5, 0x5A, 0xB0, 0xDD, 0x4A,
+    0x91, 0x16, 0x0D, 0x56, 0x0C, 0x85, 0xF6, 0x68, 0xA5, 0x5A, 0x33, 0x5F, 0xBA, 0x20, 0x14, 0x23,
+    0x74, 0xFA, 0xE5, 0x3C, 0xAD, 0xAF, 0x18, 0x69, 0x7A, 0xB5, 0xB2, 0x3A, 0x21, 0x4B, 0xB3, 0xD2,
+    0xA1, 0xE6, 0x42, 0x83, 0x16, 0x60, 0xB2, 0x73, 0xEA, 0x84, 0x8C, 0x50, 0xE0, 0x48, 0x12, 0xD9,
+    0xF6, 0x62, 0x80, 0xBE, 0x74, 0xF8, 0x14, 0x2A, 0x88, 0x3B, 0x2E, 0x70, 0x76, 0x42, 0x40, 0xC5,
+    0x59, 0xDD, 0x60, 0xBB, 0x6A, 0x49, 0xA4, 0xFC, 0xAE, 0x71, 0x8C, 0x5C, 0x22, 0xE3, 0x7E, 0x8A,
+    0x8C, 0x60, 0x4B, 0xD9, 0x94, 0xCD, 0x2B, 0xA5, 0xAD, 0xCB, 0xC6, 0x7C, 0x8F, 0x62, 0x3A, 0x46,
+    0x37, 0xE9, 0x5F, 0x3E, 0x34, 0x9F, 0xE3, 0xF5, 0x12, 0x57, 0xF8, 0xCD, 0x35, 0x62, 0x0A, 0x24,
+    0x9C, 0x89, 0xA3, 0x80, 0x2B, 0x60, 0x1F, 0x32, 0xFB, 0x67, 0xCB, 0x3A, 0xC6, 0xC0, 0x82, 0xF1,
+    0xFF, 0xDC, 0x4D, 0x7A, 0x27, 0x17, 0x04, 0x57, 0x85, 0x6C, 0xCC, 0x7D, 0xD1, 0x0B, 0xDB, 0x07,
+    0x42, 0x4D, 0xFC, 0x21, 0xC6, 0x47, 0x71, 0x46, 0x5D, 0xFF, 0x3A, 0x4F, 0x37, 0x20, 0x6A, 0x01,
+    0x43, 0x94, 0x40, 0xC5, 0x48, 0xBD, 0xB5, 0x73, 0x92, 0x16, 0xA8, 0x18, 0xC1, 0x87, 0x80, 0x32,
+    0x78, 0xB1, 0x2D, 0xBC, 0xCA, 0x82, 0x4B, 0xB8, 0x50, 0x3F, 0xCC, 0x4C, 0xFC, 0xE9, 0xED, 0xC7,
+    0xBB, 0x05, 0x5A, 0xDB, 0x13, 0xCC, 0xAE, 0x9E, 0xF2, 0xC9, 0xF2, 0x60, 0x19, 0x91, 0xCA, 0x48,
+    0x1D, 0x11, 0x37, 0x63, 0x89, 0x52, 0x47, 0xD6, 0x31, 0x97, 0x94, 0xFB, 0xC8, 0x99, 0x7E, 0xCA,
+    0x59, 0xFD, 0x88, 0x5F, 0x76, 0x24, 0x44, 0x85, 0x0E, 0x7F, 0x59, 0x72, 0x72, 0x8A, 0x75, 0xE2,
+    0xA2, 0x28, 0x8B, 0x6A, 0x60, 0x62, 0xC4, 0xBE, 0x98, 0x8A, 0x09, 0x52, 0x7D, 0x28, 0xA2, 0x68,
+    0x6C, 0x29, 0xB9, 0x34, 0xD8, 0x67, 0x65, 0x8F, 0x39, 0x13, 0x6C, 0x59, 0x65, 0xC9, 0x43, 0xA2,
+    0xD1, 0xFC, 0xA7, 0x89, 0xEA, 0x7E, 0xE2, 0xF5, 0x72, 0x1E, 0x29, 0xB6, 0x7D, 0x96, 0x7F, 0x47,
+    0x70, 0xE3, 0x93, 0x88, 0x0E, 0xA6, 0xA7, 0xA4, 0x02, 0x79, 0x8B, 0x04, 0xA3, 0xB6, 0x77, 0x51,
+    0xFA, 0xAD, 0xB4, 0xC9, 0x7D, 0xB2, 0x22, 0x82, 0xE1, 0xB9, 0xDD, 0x68, 0x2E, 0xBD, 0x5F, 0x1A,
+    0x2D, 0x2F, 0x2D, 0xB9, 0xBE, 0xCE, 0xA2, 0x84, 0x4D, 0x0F, 0xD4, 0xF2, 0xBA, 0x9C, 0xBB, 0xDE,
+    0xD8, 0xD2, 0x8B, 0x66, 0x5F, 0x43, 0x4E, 0xC8, 0x29, 0x45, 0x68, 0x62, 0x5E, 0xCB, 0xE5, 0x03,
+    0x7C, 0x34, 0x09, 0x8A, 0x16, 0xDF, 0x74, 0x5C, 0x2F, 0x84, 0x68, 0xFA, 0xCC, 0x76, 0x43, 0x62,
+    0xD0, 0x42, 0x53, 0x4F, 0x18, 0xAC, 0x11, 0x62, 0x89, 0xB5, 0xBA, 0x23, 0xD5, 0xA0, 0xBE, 0xDA,
+    0xC5, 0x65, 0xC4, 0x60, 0x94, 0x1A, 0x16, 0xFE, 0x04, 0xDE, 0xC7, 0x9E, 0x91, 0x93, 0x49, 0x93,
+    0x84, 0x4B, 0x51, 0x52, 0x24, 0x94, 0xBD, 0x91, 0x1A, 0xF4, 0x99, 0x14, 0x64, 0xCB, 0x30, 0xB4,
+    0xDC, 0xB2, 0x12, 0xF4, 0xD3, 0xCD, 0xA6, 0xDB, 0x20, 0x91, 0x2B, 0xFC, 0xFF, 0xED, 0xE5, 0x2D,
+    0x82, 0xBF, 0xBC, 0xC3, 0x0B, 0x22, 0xC8, 0xC8, 0xE4, 0x06, 0x1A, 0xB6, 0x5B, 0x7F, 0x0E, 0xC6,
+    0x24, 0x9C, 0xE4, 0x92, 0xC7, 0x55, 0x89, 0xA2, 0x1A, 0x5E, 0xE6, 0x92, 0xEF, 0xF2, 0x60, 0x61,
+    0x25, 0x5C, 0x5B, 0xA1, 0xB4, 0x69, 0xE3, 0xC4, 0x8A, 0x77, 0xD8, 0x4B, 0xB9, 0xE8, 0x51, 0xE0,
+    0xB3, 0xE9, 0x56, 0xE6, 0x22, 0x48, 0x6E, 0x82, 0xB9, 0xE5, 0x30, 0x54, 0x1F, 0x85, 0x23, 0x62,
+    0x58, 0xD3, 0xC3, 0x84, 0x79, 0xD9, 0xB9, 0x56, 0xF8, 0xB2, 0x68, 0x1F, 0x30, 0x41, 0x8A, 0x29,
+    0x0B, 0x3C, 0xD9, 0x91, 0xE8, 0xFA, 0x2C, 0x90, 0xEF, 0x76, 0x5D, 0xF8, 0x72, 0xA2, 0xD1, 0x48,
+    0xED, 0xC8, 0xDD, 0x22, 0x17, 0xDE, 0x4D, 0x66, 0xC1, 0x6C, 0x67, 0x19, 0xA7, 0x9B, 0x0D, 0xAB,
+    0x31, 0x1F, 0x8F, 0x09, 0xC3, 0x11, 0x21, 0xBA, 0x8E, 0x9A, 0x1E, 0x5B, 0xB9, 0x01, 0xB7, 0xA4,
+    0x5F, 0x10, 0xC5, 0xB2, 0x4F, 0xCE, 0x29, 0xA3, 0x84, 0x48, 0xB7, 0xD3, 0xC3, 0xEE, 0x58, 0xD2,
+    0x87, 0xC8, 0x53, 0x4A, 0x4D, 0x3F, 0x97, 0xCB, 0x7F, 0x84, 0xF9, 0x39, 0x36, 0x35, 0x29, 0x67,
+    0x89, 0x4D, 0xB4, 0x61, 0xDE, 0x65, 0x48, 0x2C, 0x0B, 0x02, 0x3E, 0x72, 0x1A, 0xBF, 0xE3, 0x0D,
+    0x22, 0xFF, 0x81, 0x98, 0x89, 0x9A, 0x63, 0x9F, 0x85, 0x62, 0xA6, 0x19, 0xE3, 0x28, 0xFD, 0xD0,
+    0x6E, 0x8B, 0xA4, 0x62, 0x69, 0x68, 0x4F, 0x40, 0x87, 0x7A, 0xD0, 0x81, 0x32, 0x0A, 0x2C, 0xB2,
+    0x6D, 0x16, 0xFF, 0x5B, 0xFB, 0x03, 0xB5, 0x54, 0xBD, 0x8E, 0xE4, 0x64, 0x10, 0x2C, 0xDB, 0xEC,
+    0x39, 0x70, 0xE0, 0x0D, 0x58, 0x21, 0xB1, 0x42, 0x7E, 0x02, 0xF0, 0x0B, 0xA0, 0xB1, 0xD1, 0x89,
+    0xFC, 0x84, 0x6E, 0x2E, 0xE0, 0x82, 0x8D, 0xB9, 0x64, 0x5F, 0x80, 0x3D, 0x1B, 0xF1, 0x00, 0x44,
+    0xE4, 0x04, 0x24, 0xCC, 0x06, 0x93, 0x90, 0x72, 0xB6, 0x44, 0x78, 0x89, 0x13, 0x44, 0x40, 0x70,
+    0xE6, 0xB4, 0x02, 0xE9, 0x92, 0xFB, 0xC4, 0xCE, 0x0A, 0x0F, 0xD8, 0x6E, 0xAA, 0xBE, 0x99, 0x5D,
+    0x16, 0x08, 0xF8, 0x91, 0xB0, 0xE4, 0x6F, 0x66, 0x6A, 0xDA, 0xDD, 0x5D, 0xD5, 0xD5, 0x46, 0x7E,
+    0x81, 0xD0, 0xAC, 0x4C, 0xCD, 0xFA, 0xBC, 0xCB, 0x36, 0x45, 0x19, 0x8D, 0x15, 0xC2, 0xB1, 0x01,
+    0x26, 0xDE, 0xB3, 0xEE, 0x8A, 0x77, 0xD1, 0x62, 0xCE, 0x1D, 0xE6, 0xD4, 0x5E, 0x4E, 0x8C, 0x1F,
+    0xF1, 0xFA, 0xF9, 0x08, 0x44, 0x1B, 0x20, 0x75, 0x40, 0xDE, 0x01, 0x4D, 0x8D, 0x68, 0x06, 0x4E,
+    0x07, 0x9C, 0x5A, 0x87, 0x6A, 0x02, 0x0E, 0x4A, 0xE0, 0x95, 0xEC, 0x99, 0xCD, 0x05, 0x6E, 0xAE,
+    0xE4, 0xE9, 0xAF, 0xD6, 0xBC, 0x0B, 0xDC, 0x8B, 0xC6, 0x78, 0x8A, 0xC7, 0x70, 0x83, 0x3F, 0x5D,
+    0xC1, 0x10, 0x8D, 0xE1, 0x18, 0x8C, 0xE1, 0x10, 0xB9, 0xB8, 0x4F, 0xDB, 0xAC, 0x7C, 0x73, 0xF7,
+    0x07, 0x93, 0x65, 0x25, 0x62, 0x43, 0xA0, 0xF4, 0x1B, 0x64, 0x13, 0x7F, 0x94, 0xBE, 0x74, 0xD5,
+    0xF3, 0xBF, 0x81, 0xC9, 0x59, 0x3F, 0xB4, 0x9A, 0xBD, 0x10, 0x60, 0xC7, 0x78, 0x43, 0x0F, 0x1E,
+    0x2D, 0x97, 0xEF, 0x99, 0xD9, 0x53, 0xDE, 0xB7, 0xEA, 0x1C, 0x2C, 0x97, 0xCB, 0x9C, 0x44, 0x2A,
+    0x33, 0x77, 0xC8, 0xDF, 0x6C, 0x24, 0x66, 0xCF, 0x4A, 0xA9, 0x02, 0x3E, 0x67, 0xAE, 0x9C, 0xA4,
+    0x99, 0x39, 0xC4, 0x33, 0xE1, 0x5A, 0x89, 0x05, 0xAA, 0x4E, 0xBD, 0xCB, 0x73, 0x7C, 0x81, 0xC2,
+    0xCA, 0xCA, 0xBA, 0xC5, 0xDA, 0x51, 0x37, 0xE0, 0x2B, 0x60, 0x01, 0xBC, 0xC5, 0x06, 0x80, 0x27,
+    0x38, 0x9E, 0x62, 0x1B, 0x52, 0xEB, 0xD3, 0x09, 0x49, 0x87, 0xB8, 0x45, 0xD4, 0x22, 0xB8, 0xE1,
+    0xFA, 0x19, 0xE2, 0x41, 0x15, 0x78, 0x06, 0xF7, 0x7C, 0x57, 0xF7, 0x75, 0x52, 0xE0, 0xAD, 0xB4,
+    0x62, 0xC7, 0x14, 0x37, 0xDB, 0xE2, 0x8E, 0x88, 0xB2, 0xA1, 0x64, 0x83, 0x9C, 0xB4, 0xD0, 0xEC,
+    0x3E, 0x12, 0xEA, 0x83, 0x47, 0x25, 0xC6, 0xB4, 0x0B, 0x6D, 0x40, 0x7E, 0xD7, 0x45, 0xDB, 0xAA,
+    0x8C, 0x9F, 0x0F, 0xC1, 0x26, 0xEE, 0x31, 0x8E, 0x78, 0x1B, 0x03, 0x0A, 0xA9, 0xBF, 0x40, 0xFA,
+    0x8C, 0x4F, 0x9C, 0xD4, 0xD1, 0xCF, 0x3D, 0x8E, 0xAD, 0xC7, 0x96, 0xE1, 0x3F, 0x0C, 0x38, 0x7B,
+    0x4C, 0x51, 0x17, 0xC8, 0xB3, 0x36, 0x6D, 0xD3, 0x3A, 0xFB, 0xD8, 0x45, 0x2E, 0x71, 0x59, 0x3B,
+    0xA2, 0x39, 0x31, 0x6B, 0x73, 0xDA, 0xE2, 0x13, 0xAB, 0x63, 0x87, 0x27, 0xE5, 0x07, 0x9E, 0xB5,
+    0xAE, 0xAC, 0xF3, 0x1F, 0xE1, 0xFE, 0x67, 0x2E, 0xE5, 0x48, 0xCA, 0xB6, 0xCB, 0xC6, 0xED, 0x9A,
+    0xEE, 0xA5, 0x8B, 0xCD, 0x25, 0xFE, 0x72, 0x7D, 0xE8, 0xCF, 0xCA, 0x6B, 0x57, 0x38, 0x9F, 0x6D,
+    0xF2, 0xB6, 0x78, 0x29, 0x28, 0xFA, 0x51, 0x50, 0xE8, 0x3C, 0x34, 0x78, 0x8A, 0x67, 0xB1, 0xA0,
+    0xC2, 0xD7, 0x4E, 0x6B, 0x41, 0x49, 0x2B, 0xD7, 0x45, 0x4E, 0x50, 0x30, 0xAF, 0x1A, 0x42, 0x2C,
+    0x49, 0xA8, 0x5A, 0xAD, 0x08, 0xE5, 0xA5, 0xB4, 0xA1, 0x2E, 0x8C, 0xA2, 0xE2, 0x30, 0x85, 0x22,
+    0x6B, 0x03, 0x8E, 0x26, 0x1E, 0x62, 0x06, 0xE6, 0x76, 0x69, 0x13, 0x32, 0x7A, 0x18, 0x87, 0x08,
+    0x1A, 0xB3, 0x5A, 0x3D, 0x77, 0x07, 0x86, 0xA6, 0xE5, 0x00, 0xAB, 0x3A, 0x21, 0x5F, 0x26, 0xE1,
+    0x13, 0x0D, 0xE2, 0x9E, 0x50, 0x5E, 0x12, 0xE2, 0x47, 0xCB, 0x84, 0x8C, 0xD7, 0x7C, 0x8C, 0xD0,
+    0x03, 0x2B, 0x59, 0x8A, 0x8F, 0x81, 0x76, 0x1D, 0x59, 0x90, 0x51, 0x69, 0x47, 0xA8, 0x20, 0x14,
+    0x0A, 0xCA, 0xFB, 0xE4, 0xEA, 0xA1, 0xC5, 0x92, 0x84, 0x5E, 0x1B, 0x6E, 0x2B, 0x71, 0x87, 0xFA,
+    0x04, 0x66, 0x33, 0xC7, 0xFB, 0x70, 0x0C, 0x66, 0x76, 0x99, 0x76, 0x6C, 0x9B, 0x0C, 0x16, 0xA2,
+    0xFC, 0xA5, 0x67, 0x2F, 0xD6, 0x62, 0xBB, 0xD3, 0xBC, 0x92, 0x65, 0xD8, 0x35, 0xE2, 0x1B, 0xA8,
+    0x90, 0x6C, 0x76, 0x3D, 0x0D, 0xED, 0x1F, 0x07, 0x50, 0xE2, 0xD5, 0xC4, 0x7E, 0x59, 0xF7, 0xA2,
+    0xA5, 0x5E, 0x39, 0x8E, 0x23, 0xB9, 0x8B, 0x36, 0x17, 0xDD, 0x0B, 0x3F, 0xA3, 0x09, 0x07, 0x76,
+    0xB0, 0x9E, 0x65, 0x59, 0xAE, 0x0D, 0x3B, 0x8F, 0x26, 0x09, 0x17, 0x89, 0x34, 0x7D, 0x26, 0x27,
+    0xA7, 0x3D, 0x61, 0xEE, 0x91, 0x5A, 0x69, 0x04, 0x7B, 0x4E, 0x8C, 0x15, 0x9C, 0xFF, 0x0E, 0x47,
+    0x83, 0x8F, 0xEE, 0x04, 0x7B, 0x67, 0x46, 0x83, 0xE0, 0x42, 0x6A, 0xC6, 0x4C, 0x7F, 0xF5, 0xC0,
+    0xDA, 0xD8, 0xCF, 0x28, 0xDF, 0x19, 0x7B, 0x67, 0x02, 0x22, 0xCF, 0x79, 0xDB, 0x47, 0xD5, 0x8B,
+    0x95, 0x44, 0x84, 0xB2, 0x87, 0xAA, 0x19, 0x97, 0x7B, 0x97, 0xC3, 0x6F, 0x94, 0xBA, 0x83, 0x9E,
+    0x75, 0x52, 0xBF, 0x0E, 0xE7, 0xD5, 0x17, 0x7B, 0xE8, 0x76, 0xD4, 0x21, 0xA1, 0x50, 0xEA, 0xA7,
+    0x35, 0xA1, 0xB3, 0x70, 0x7A, 0xFF, 0xFC, 0xCA, 0xF6, 0x7B, 0x6F, 0xBE, 0xDA, 0x9A, 0xF7, 0xF7,
+    0xD5, 0x8B, 0xF5, 0xC0, 0xC8, 0x85, 0x78, 0x33, 0x30, 0xE8, 0xBC, 0xA7, 0xDC, 0xBE, 0x92, 0x92,
+    0xE5, 0xDF, 0x3C, 0x92, 0x23, 0x9C, 0x7F, 0xCD, 0x35, 0xFB, 0x32, 0x7F, 0x8C, 0xB8, 0x06, 0x68,
+    0xD4, 0x8C, 0x23, 0x64, 0xB4, 0x77, 0xF4, 0xE1, 0x6E, 0x69, 0x6B, 0x1D, 0x9C, 0xA8, 0x7D, 0x7A,
+    0xDA, 0x07, 0x9C, 0xC6, 0x63, 0x8D, 0x29, 0xF2, 0x62, 0x2E, 0xC0, 0x47, 0x42, 0x2F, 0x9D, 0x54,
+    0xD2, 0x04, 0xCB, 0xEB, 0x81, 0xFA, 0xF9, 0x82, 0xC3, 0x4F, 0x6C, 0xAA, 0x4A, 0x52, 0xFD, 0x76,
+    0x83, 0x60, 0x3D, 0x68, 0xC4, 0xC5, 0x5D, 0xFF, 0xB2, 0xD5, 0x2B, 0xA0, 0x28, 0x99, 0x91, 0x56,
+    0x9B, 0xF5, 0x35, 0x67, 0x89, 0x8D, 0x44, 0xA1, 0x05, 0x1A, 0xDF, 0xC4, 0xD1, 0x7D, 0x29, 0xDB,
+    0x43, 0xBC, 0x65, 0xF2, 0xE1, 0x35, 0x16, 0x3C, 0xDE, 0xBD, 0x36, 0x2A, 0xCF, 0x80, 0x05, 0xFE,
+    0xF6, 0x87, 0xF9, 0x37, 0x4F, 0xEE, 0x95, 0xA3, 0xDC, 0xAB, 0x73, 0xF7, 0x2F, 0x13, 0x4C, 0xF2,
+    0x10, 0x67, 0x4E, 0x2E, 0x63, 0x63, 0x8E, 0x46, 0x6F, 0x2B, 0xFB, 0x49, 0xB3, 0xEE, 0xFC, 0x6E,
+    0x48, 0x3E, 0x86, 0xFE, 0x93, 0xAF, 0x53, 0xE0, 0x67, 0xA8, 0xA6, 0xDA, 0x82, 0x3B, 0x74, 0xB2,
+    0xF1, 0x43, 0xD8, 0x99, 0xED, 0x3F, 0x7F, 0xA4, 0x94, 0x52, 0xD3, 0xF3, 0x66, 0xD5, 0x06, 0x35,
+    0x1D, 0x0A, 0xEA, 0xFD, 0xB9, 0xE4, 0x73, 0x99, 0x7A, 0xAD, 0x2B, 0xDF, 0x6E, 0xD6, 0x6B, 0xC1,
+    0xFD, 0xA2, 0x70, 0xE5, 0x12, 0x27, 0x6E, 0x7B, 0xF3, 0x8B, 0x73, 0x38, 0x7A, 0x37, 0x5C, 0x0E,
+    0xDE, 0xA2, 0xB2, 0x41, 0x33, 0xFB, 0x7D, 0xF4, 0xBB, 0x78, 0xA9, 0x33, 0xFF, 0x5A, 0x67, 0xA3,
+    0xED, 0x0C, 0x47, 0x9D, 0x89, 0xD3, 0x99, 0xB7, 0x3A, 0x1B, 0xFA, 0x44, 0x7A, 0x45, 0xF6, 0x0E,
+    0x09, 0x46, 0xF6, 0x9D, 0xA7, 0xAA, 0x3C, 0xEA, 0xE5, 0x7F, 0xBF, 0x7E, 0x03, 0x9D, 0x54, 0x31,
+    0x8E, 0xDD, 0x36, 0x10, 0x1D, 0x89, 0x89, 0x05, 0x44, 0x05, 0xD3, 0x04, 0x29, 0x5C, 0xE8, 0x06,
+    0xE6, 0x05, 0x8C, 0xA5, 0x6E, 0x10, 0x17, 0x81, 0x0B, 0xBB, 0x4D, 0xEF, 0x26, 0xA5, 0xF7, 0x4B,
+    0x48, 0xEB, 0xC2, 0xBE, 0x47, 0x8A, 0xCD, 0x01, 0xFE, 0x7E, 0x69, 0xDD, 0x6C, 0xE1, 0xC2, 0x02,
+    0x92, 0xDE, 0x2A, 0xDC, 0x87, 0x59, 0x08, 0x88, 0xEC, 0x48, 0x9A, 0xBC, 0x37, 0xF2, 0xC2, 0x4E,
+    0x90, 0xC6, 0xF9, 0xF8, 0xA2, 0x38, 0x23, 0x92, 0xF3, 0xF8, 0xE6, 0xCD, 0x34, 0x9A, 0x24, 0x57,
+    0x6D, 0x25, 0x6B, 0x06, 0x11, 0xE9, 0xF0, 0xE4, 0x0B, 0x86, 0x32, 0x61, 0x08, 0xFD, 0x67, 0xBB,
+    0x7E, 0x84, 0xCB, 0x8D, 0x70, 0xF9, 0x1A, 0xAE, 0xCB, 0x7C, 0x7D, 0xF4, 0xF3, 0x1F, 0x8A, 0xDF,
+    0x2B, 0x3C, 0x9B, 0x94, 0x88, 0x26, 0xDD, 0x2A, 0x9D, 0x8A, 0x78, 0xED, 0xA5, 0x99, 0x24, 0xD3,
+    0x41, 0x1C, 0xE2, 0xC7, 0x59, 0xE4, 0x6C, 0x11, 0xF7, 0x7B, 0x2F, 0xEE, 0xF5, 0x20, 0x4F, 0x71,
+    0xD6, 0xD3, 0x93, 0xF8, 0xE7, 0xBD, 0x14, 0xD7, 0x49, 0x26, 0x98, 0xC7, 0x28, 0xC1, 0xF7, 0x52,
+    0xBE, 0x9C, 0xDD, 0xB8, 0xC2, 0xAC, 0xFA, 0xFB, 0xE5, 0x20, 0xBE, 0x5D, 0xCA, 0xFE, 0x52, 0x64,
+    0x2E, 0x87, 0xB9, 0x1C, 0x61, 0x46, 0x2F, 0x07, 0x91, 0xC9, 0xDD, 0xA4, 0x02, 0x66, 0x1D, 0xCE,
+    0xA5, 0x91, 0x6C, 0x12, 0xED, 0x5D, 0x92, 0xAA, 0xF6, 0xB3, 0x44, 0xC9, 0x93, 0x34, 0x35, 0xCC,
+    0x20, 0x18, 0xA2, 0xB8, 0x49, 0xEE, 0x89, 0x9B, 0x0B, 0x45, 0x10, 0x0C, 0x1D, 0x80, 0x89, 0x6A,
+    0xDF, 0x2C, 0x7C, 0x5D, 0x2B, 0x4E, 0x51, 0x7C, 0xAC, 0xE5, 0xDB, 0x49, 0x02, 0x7C, 0x01, 0x84,
+    0x8D, 0x3C, 0x23, 0x74, 0x35, 0x8D, 0x9B, 0xC5, 0x0C, 0xCF, 0xF3, 0xF2, 0xD4, 0xD4, 0x34, 0x40,
+    0x05, 0x0D, 0x9F, 0x68, 0x48, 0xD3, 0xD2, 0xC8, 0x57, 0x33, 0x7C, 0xA2, 0x21, 0xF1, 0x27, 0x1A,
+    0xD9, 0x6A, 0x86, 0xBF, 0xA1, 0x21, 0xF1, 0x82, 0x46, 0xA6, 0x66, 0x94, 0x2A, 0xF9, 0x04, 0x5F,
+    0x2A, 0x74, 0x85, 0x0F, 0x9C, 0x0D, 0x3B, 0xDF, 0x22, 0x5F, 0xE3, 0xF9, 0xF2, 0x01, 0x19, 0x57,
+    0x7D, 0x21, 0x52, 0x29, 0x91, 0x77, 0x6F, 0xEF, 0x62, 0xC7, 0x06, 0xCC, 0x7D, 0x01, 0x2E, 0xE3,
+    0x08, 0x40, 0x08, 0x56, 0x21, 0xAD, 0xE5, 0x14, 0x71, 0xA5, 0x62, 0x8E, 0xAD, 0x88, 0x5B, 0x62,
+    0xCD, 0xB1, 0xA9, 0x99, 0xB0, 0x7F, 0x8F, 0xF0, 0x73, 0xCD, 0xCC, 0xF5, 0x6E, 0x8A, 0xDC, 0x9B,
+    0x2A, 0x9E, 0x33, 0xFA, 0x89, 0x99, 0x2E, 0x40, 0x7C, 0x57, 0xE7, 0x3A, 0x14, 0x08, 0xD4, 0xA8,
+    0x4E, 0xC4, 0x89, 0xEC, 0x89, 0x3C, 0x7A, 0x61, 0xD0, 0xE4, 0x0E, 0xF2, 0x5C, 0x77, 0xC8, 0x76,
+    0xD6, 0xF4, 0x4F, 0x16, 0xF0, 0x10, 0x07, 0xA8, 0x61, 0xC3, 0xC4, 0x53, 0x16, 0xA7, 0xDB, 0xC9,
+    0x8A, 0x49, 0xD5, 0xE3, 0xC4, 0x29, 0x5F, 0x1F, 0x6F, 0x12, 0x54, 0x71, 0xEC, 0x56, 0x9B, 0x9A,
+    0x4C, 0x5B, 0xFF, 0x31, 0x19, 0x18, 0x73, 0x62, 0xC4, 0x5A, 0x6E, 0x7F, 0x77, 0x15, 0x97, 0x25,
+    0x05, 0x78, 0x95, 0xDB, 0x43, 0xCA, 0x79, 0x03, 0x5D, 0xD0, 0x56, 0x2B, 0x6E, 0x13, 0x92, 0x50,
+    0xA5, 0x6C, 0xA5, 0x44, 0xEB, 0x60, 0x2C, 0x38, 0x6E, 0x88, 0xFD, 0x4E, 0x46, 0x31, 0x59, 0x84,
+    0x9D, 0x81, 0x4F, 0x0C, 0x7C, 0xB1, 0x65, 0xED, 0xCE, 0x84, 0xB3, 0x03, 0x64, 0xA7, 0x42, 0x10,
+    0xDE, 0x2D, 0x42, 0x0A, 0x30, 0xAB, 0xD6, 0xAC, 0x33, 0x60, 0xD4, 0x36, 0x5E, 0x6F, 0x89, 0x2A,
+    0x8C, 0x06, 0xCE, 0x6A, 0x0A, 0xAB, 0xEC, 0x95, 0xE9, 0xBB, 0xEF, 0xF7, 0x9C, 0xF5, 0xF6, 0x9A,
+    0xEC, 0xDB, 0x0F, 0x78, 0xEA, 0x9D, 0x36, 0x44, 0xE0, 0x48, 0xE2, 0x66, 0xDE, 0x18, 0xA1, 0x43,
+    0x0F, 0xE8, 0x46, 0x19, 0x69, 0xD8, 0x6C, 0x3A, 0xD0, 0xBB, 0xD8, 0x82, 0x16, 0x53, 0x84, 0xCA,
+    0x37, 0x1E, 0x16, 0x48, 0x41, 0xBE, 0x32, 0x81, 0xE1, 0x6A, 0xE5, 0x7D, 0x28, 0x97, 0xD0, 0xE3,
+    0x98, 0x7C, 0x81, 0x80, 0x30, 0x2D, 0xF7, 0x6D, 0x89, 0x54, 0xEA, 0xD0, 0x68, 0x72, 0xFA, 0x4C,
+    0x15, 0xBC, 0x11, 0xC9, 0x57, 0x3B, 0xA9, 0x41, 0x07, 0x40, 0x5C, 0x8A, 0xF5, 0xF1, 0x82, 0x50,
+    0x4B, 0xD5, 0xCB, 0x12, 0x5A, 0x99, 0x11, 0xFE, 0x17, 0xDE, 0xCA, 0x93, 0x67, 0x5C, 0xDB, 0xF0,
+    0x37, 0x98, 0x14, 0x28, 0x06, 0x69, 0xE8, 0x5D, 0xBE, 0x40, 0xF8, 0xFB, 0x22, 0xEB, 0x39, 0x9E,
+    0x83, 0x64, 0x4B, 0x43, 0x3D, 0x0D, 0x55, 0x02, 0x37, 0x43, 0xC5, 0xFB, 0x41, 0x24, 0x0D, 0xBB,
+    0x41, 0xB0, 0x96, 0xF0, 0xFE, 0xE2, 0xFD, 0xC5, 0x4D, 0x02, 0xA0, 0xE3, 0x11, 0xDC, 0x86, 0x7B,
+    0xD4, 0xD7, 0x75, 0x5D, 0xA6, 0x6C, 0xD8, 0xF3, 0x6D, 0x4D, 0x65, 0x6F, 0x2F, 0x26, 0xFC, 0xCF,
+    0x75, 0x52, 0x25, 0xA6, 0x95, 0x02, 0xF1, 0x25, 0x22, 0x3F, 0x9D, 0xBE, 0x01, 0x49, 0x51, 0xC7,
+    0x27, 0x83, 0x64, 0x5D, 0x5D, 0x30, 0x9D, 0xE4, 0x92, 0x7D, 0xA0, 0xC1, 0x0E, 0x4A, 0x12, 0x49,
+    0x97, 0xFF, 0xFB, 0x41, 0x40, 0x3B, 0x66, 0xC8, 0x4B, 0x3E, 0x9B, 0xF4, 0xAC, 0x72, 0x05, 0xFF,
+    0xF8, 0xEE, 0x21, 0x46, 0xA7, 0x26, 0xDD, 0xA0, 0x46, 0xF8, 0x37, 0x0F, 0x4C, 0xCF, 0x4E, 0xB7,
+    0x8E, 0x99, 0xD8, 0x98, 0x86, 0x6A, 0x20, 0xF6, 0xAA, 0xCF, 0x30, 0x47, 0xA1, 0x72, 0xA7, 0xDD,
+    0xEE, 0x60, 0xE6, 0x4A, 0xE1, 0xCA, 0xBE, 0x00, 0x8C, 0xFB, 0x01, 0x28, 0xA4, 0x1C, 0x39, 0x16,
+    0xA9, 0x18, 0xA8, 0x54, 0xCF, 0x6A, 0x99, 0x3D, 0x4B, 0x72, 0xA9, 0x98, 0xD1, 0x35, 0x32, 0xD6,
+    0xE1, 0x8C, 0x63, 0x3C, 0xDA, 0x68, 0xEC, 0x54, 0xD4, 0xB7, 0x81, 0x94, 0xDB, 0xBE, 0xC2, 0x6F,
+    0x6C, 0x25, 0xC4, 0x19, 0x91, 0x5F, 0xB4, 0x46, 0xDD, 0xD8, 0xF9, 0x22, 0x81, 0x09, 0x4B, 0xBE,
+    0xE5, 0x7D, 0x81, 0xAA, 0x83, 0x36, 0x5B, 0x02, 0x83, 0x98, 0x01, 0xAC, 0xA9, 0xD9, 0xC7, 0x23,
+    0x0B, 0x26, 0xFF, 0x2B, 0x11, 0x6D, 0xE8, 0xDD, 0x9F, 0x49, 0x2E, 0x09, 0xD5, 0xFD, 0x3A, 0x11,
+    0xB3, 0x1F, 0x8A, 0x97, 0x33, 0x61, 0x97, 0xA3, 0xBF, 0x5A, 0xD8, 0xDB, 0x8A, 0xE4, 0xDB, 0x95,
+    0xE0, 0xDD, 0x54, 0xC9, 0xC9, 0x8D, 0x44, 0x8E, 0x6E, 0xC9, 0x8B, 0x64, 0xCB, 0x99, 0xC4, 0x92,
+    0x09, 0x5D, 0xCE, 0x25, 0x7C, 0xC7, 0xC9, 0x7A, 0x94, 0xEA, 0x35, 0x6F, 0x74, 0x00, 0xB7, 0x6F,
+    0x0C, 0x2C, 0x7B, 0x81, 0x4D, 0x92, 0x55, 0x23, 0x82, 0x8D, 0xAC, 0x4C, 0xDE, 0xEB, 0x56, 0x43,
+    0x1F, 0x7E, 0x41, 0x17, 0xA7, 0x0B, 0x4A, 0xC4, 0xE9, 0x7C, 0x47, 0x09, 0x58, 0xBA, 0x56, 0x4E,
+    0xD8, 0x3A, 0x30, 0x9B, 0x3E, 0x19, 0x87, 0x54, 0x3C, 0x34, 0x1C, 0x18, 0x45, 0x0F, 0x1F, 0xB9,
+    0x0A, 0xC6, 0x8F, 0x9F, 0x3E, 0x7A, 0x4E, 0x8C, 0x9B, 0xCD, 0x1D, 0x5B, 0x45, 0x62, 0x8F, 0xF0,
+    0x3D, 0xA9, 0x0C, 0x2D, 0xDB, 0x06, 0x74, 0xBF, 0x52, 0x1A, 0x20, 0x8A, 0x66, 0x87, 0x4A, 0xEB,
+    0x4B, 0x66, 0xB9, 0xF7, 0x96, 0x6B, 0xAF, 0x37, 0x68, 0x9A, 0x51, 0xAF, 0xD0, 0x38, 0xCA, 0x89,
+    0x58, 0x22, 0xD7, 0x82, 0x1B, 0x54, 0xBB, 0x67, 0xB9, 0xCA, 0x39, 0xBB, 0xB0, 0x65, 0x37, 0x31,
+    0x8B, 0x7E, 0x64, 0xD4, 0xEA, 0x15, 0x79, 0x08, 0xA7, 0x0F, 0x57, 0xB6, 0x9E, 0x46, 0x18, 0x86,
+    0xA8, 0x30, 0x07, 0xD5, 0x28, 0xA6, 0xCC, 0x7F, 0xBA, 0x7F, 0xDB, 0x9B, 0x24, 0xEF, 0xA5, 0x9F,
+    0xF2, 0xF2, 0x37, 0xAD, 0x55, 0xBD, 0x8E, 0xDD, 0x44, 0x14, 0x3E, 0xE3, 0xD1, 0x5D, 0x83, 0x5C,
+    0x38, 0x45, 0x22, 0x21, 0x16, 0x69, 0xDE, 0x80, 0x79, 0x01, 0x76, 0xC7, 0x4A, 0x5E, 0x60, 0x8B,
+    0x5D, 0x51, 0xD2, 0x47, 0x82, 0xBC, 0x00, 0xC1, 0x23, 0x9E, 0x20, 0x45, 0x20, 0x25, 0x4D, 0xAA,
+    0xDB, 0xE4, 0x05, 0x76, 0x77, 0x46, 0x6C, 0x41, 0xB1, 0x05, 0x96, 0xA2, 0x54, 0xDB, 0x58, 0x42,
+    0x11, 0x05, 0x45, 0x8C, 0x64, 0x81, 0x37, 0x8C, 0x7D, 0xF8, 0x8E, 0x9D, 0x9B, 0x88, 0x64, 0x51,
+    0x6E, 0xA2, 0x58, 0xF2, 0xF1, 0x99, 0x33, 0x33, 0xE7, 0xE7, 0x3B, 0x3F, 0xB6, 0xCC, 0x7C, 0x0B,
+    0x6F, 0x72, 0xCF, 0xD7, 0x7C, 0xD6, 0x51, 0xD1, 0xED, 0x91, 0x1A, 0x75, 0x24, 0xE7, 0x3F, 0xA1,
+    0xB2, 0x23, 0xCA, 0x46, 0x22, 0x2C, 0x68, 0x59, 0x24, 0x2C, 0xEA, 0xEA, 0xF5, 0x45, 0x4B, 0xA4,
+    0x13, 0xA9, 0x18, 0x2A, 0xDA, 0x33, 0x2D, 0xE9, 0xC7, 0xD8, 0x39, 0x09, 0xEB, 0xF5, 0xA3, 0x73,
+    0xD1, 0x5C, 0x83, 0xE0, 0x3E, 0x51, 0xF8, 0x8B, 0x2F, 0x1A, 0x4B, 0xC7, 0x59, 0x57, 0xC4, 0x2D,
+    0x3F, 0x7C, 0xC1, 0x15, 0x7D, 0x0B, 0xF5, 0x30, 0xE1, 0x88, 0x54, 0x0F, 0x6B, 0x91, 0xE8, 0xEE,
+    0x22, 0xB1, 0x50, 0x3A, 0xBC, 0x92, 0xC0, 0x27, 0x03, 0x77, 0x60, 0xBC, 0x80, 0x64, 0x1F, 0x1E,
+    0x8A, 0xC4, 0xCF, 0x92, 0xBC, 0x99, 0x15, 0x64, 0xA2, 0x00, 0x92, 0xE3, 0x45, 0xC1, 0x0D, 0x37,
+    0x70, 0x5B, 0xFA, 0x7D, 0x1A, 0xF4, 0xD6, 0x1F, 0xFE, 0x5D, 0xA2, 0xC9, 0xA1, 0xBA, 0x10, 0x65,
+    0xB0, 0x6F, 0xA1, 0x6D, 0x1F, 0xE6, 0xEE, 0xC2, 0xC0, 0x31, 0x3C, 0x18, 0x4A, 0x2F, 0xFE, 0xEB,
+    0x4E, 0xB7, 0x79, 0xA3, 0xBB, 0x32, 0xAA, 0x1E, 0x36, 0x13, 0xBC, 0x3D, 0xFE, 0x9C, 0x68, 0xEF,
+    0x08, 0x8F, 0x03, 0x26, 0xCF, 0xF0, 0x42, 0xC3, 0x67, 0xF0, 0xAB, 0xF6, 0xAE, 0x29, 0x3A, 0x95,
+    0xE8, 0x0B, 0x44, 0xB4, 0x3A, 0x80, 0x6A, 0x6E, 0x29, 0x67, 0x8E, 0x6A, 0x04, 0xCA, 0xCE, 0x97,
+    0x0D, 0x1C, 0x3F, 0xA5, 0x15, 0x15, 0x70, 0x1A, 0x0C, 0xA9, 0xAF, 0x5A, 0xDA, 0xE5, 0x89, 0x4A,
+    0x7E, 0xD6, 0xEA, 0x11, 0x12, 0x87, 0x2D, 0xF8, 0x74, 0x4A, 0x35, 0xD2, 0xA1, 0xC7, 0x9C, 0xEF,
+    0x5B, 0xFE, 0x9B, 0x63, 0x18, 0x4D, 0x47, 0x87, 0x74, 0x8D, 0x40, 0x80, 0x85, 0x64, 0xCC, 0x09,
+    0x59, 0x09, 0xA1, 0x2B, 0x89, 0x82, 0xF9, 0x64, 0x01, 0xFB, 0xC8, 0xDC, 0x10, 0x5F, 0x86, 0x8E,
+    0xB8, 0x2A, 0x06, 0x1A, 0x25, 0xC7, 0xC8, 0xB2, 0x10, 0x2C, 0xFE, 0x43, 0x5E, 0x6E, 0x64, 0x42,
+    0x74, 0x0F, 0x52, 0x74, 0x34, 0x51, 0x1D, 0x15, 0x82, 0xAC, 0x28, 0x30, 0x60, 0x52, 0x47, 0x48,
+    0x8E, 0x82, 0x1F, 0x61, 0x22, 0xC3, 0xAC, 0xC6, 0x3C, 0x95, 0x51, 0xF7, 0x27, 0x54, 0xA0, 0xEE,
+    0xAE, 0x9B, 0x38, 0x07, 0x96, 0xE1, 0x20, 0xAE, 0x92, 0x8D, 0x4B, 0x6D, 0x31, 0x12, 0x35, 0x01,
+    0x6E, 0xFE, 0xE1, 0x1B, 0xE0, 0xD1, 0x67, 0xA2, 0x4D, 0xF4, 0x20, 0x77, 0x24, 0x30, 0x49, 0x54,
+    0x42, 0x54, 0x10, 0x59, 0xFD, 0x06, 0x51, 0x87, 0x20, 0x96, 0x99, 0x70, 0x93, 0x29, 0xBF, 0x54,
+    0x4C, 0x65, 0x83, 0x0D, 0xEB, 0x41, 0x9C, 0x1C, 0xA9, 0x85, 0x84, 0x2B, 0xC8, 0xBC, 0xE1, 0xE6,
+    0x73, 0xC0, 0x81, 0xCC, 0xE5, 0x2E, 0xC3, 0x20, 0xD7, 0xA3, 0xE2, 0xD1, 0x26, 0xBA, 0x51, 0xAD,
+    0xA0, 0xFE, 0x80, 0xB0, 0x22, 0xC7, 0xA3, 0x1E, 0x74, 0x32, 0x5E, 0xF7, 0x88, 0xFC, 0xB7, 0x8E,
+    0xCC, 0x4F, 0x4F, 0x8E, 0x4E, 0x03, 0xF3, 0x73, 0x58, 0xBD, 0x90, 0x4A, 0xF5, 0x8B, 0x4B, 0x68,
+    0x26, 0xA4, 0x4B, 0xC2, 0xF9, 0x1A, 0xAA, 0xBA, 0xFC, 0x65, 0x38, 0x9F, 0xDE, 0x83, 0x87, 0x89,
+    0xCA, 0x7F, 0x18, 0x67, 0xF7, 0xE1, 0xD9, 0x47, 0xF4, 0x1D, 0xC4, 0x27, 0xCB, 0x1D, 0x79, 0x71,
+    0x3E, 0xA2, 0x95, 0xE2, 0xED, 0x69, 0x5D, 0x6D, 0x64, 0xDB, 0xBE, 0x06, 0xAA, 0x1D, 0x5E, 0x81,
+    0xFF, 0x00, 0xD9, 0x40, 0xD1, 0x4B, 0x53, 0x4E, 0x14, 0x3E, 0xD6, 0x52, 0x34, 0xC6, 0x23, 0x7B,
+    0xA7, 0xE8, 0x20, 0xC0, 0x6F, 0xE2, 0x5C, 0x47, 0x65, 0x8F, 0x34, 0x94, 0xE2, 0x5F, 0x8D, 0x5A,
+    0x94, 0x66, 0x99, 0x9B, 0x4B, 0x72, 0x04, 0x4F, 0xD7, 0xEB, 0x4A, 0x43, 0x43, 0x2C, 0x44, 0xCD,
+    0x08, 0xF4, 0x0B, 0xF4, 0x57, 0x72, 0xD2, 0x84, 0xB0, 0x62, 0x6F, 0x25, 0xCA, 0x87, 0x9C, 0xFF,
+    0x60, 0x8F, 0x08, 0x5B, 0x52, 0xEB, 0x87, 0xB4, 0x54, 0x60, 0xC6, 0x51, 0xF2, 0x32, 0x57, 0xDA,
+    0x1D, 0x61, 0xD5, 0xCC, 0x9A, 0x37, 0x58, 0xA9, 0x13, 0xF3, 0x33, 0xFA, 0x43, 0xA1, 0x0C, 0x23,
+    0x02, 0xF8, 0x72, 0x02, 0xD2, 0x15, 0xE6, 0x0E, 0x0E, 0xD4, 0x72, 0x16, 0x55, 0x06, 0xD6, 0x55,
+    0xEF, 0xC2, 0x1A, 0x8E, 0x96, 0xCF, 0x38, 0x69, 0x60, 0x71, 0x8D, 0xF2, 0x9E, 0x5C, 0x4B, 0xEC,
+    0x17, 0xC3, 0x9B, 0xE7, 0x4E, 0xAF, 0xB9, 0xD9, 0x91, 0xFA, 0x97, 0x6B, 0x28, 0x16, 0xF7, 0x3F,
+    0xAC, 0xE1, 0x4E, 0x5C, 0x5B, 0x49, 0x5F, 0xD4, 0x31, 0x4F, 0xF3, 0x94, 0xDC, 0x3C, 0xBB, 0x43,
+    0xC1, 0x7E, 0x77, 0x40, 0x32, 0xB3, 0xB7, 0x13, 0x3D, 0x40, 0x5D, 0xD1, 0x65, 0xA8, 0x2C, 0x1F,
+    0x9A, 0xEC, 0xDE, 0x82, 0x95, 0x4D, 0x1B, 0xA8, 0x76, 0xD2, 0x06, 0x9E, 0xAB, 0x49, 0xCE, 0xE9,
+    0x05, 0xA1, 0x80, 0x68, 0x32, 0x69, 0x46, 0x64, 0x4F, 0x25, 0x78, 0xA4, 0x12, 0xF2, 0xAF, 0xE6,
+    0xDC, 0x8F, 0xC2, 0x25, 0x0C, 0x69, 0x6C, 0x44, 0x90, 0x52, 0x8E, 0xC8, 0xE0, 0x4E, 0x40, 0x16,
+    0x77, 0xEB, 0x16, 0xF8, 0x98, 0xC1, 0x71, 0xCC, 0x27, 0x9A, 0x13, 0x76, 0x48, 0x01, 0x35, 0x1A,
+    0xD1, 0x5C, 0xD8, 0xCE, 0x5F, 0x61, 0xBF, 0x2D, 0x5B, 0x59, 0xFE, 0x53, 0x30, 0x92, 0xBA, 0xC3,
+    0x58, 0xCB, 0xA6, 0x82, 0x1B, 0x8C, 0x16, 0xCD, 0xBF, 0xE2, 0x87, 0x83, 0xE4, 0x3E, 0xE2, 0xA7,
+    0xCC, 0x0F, 0xD0, 0xBF, 0xC8, 0x2C, 0xBA, 0x68, 0xCE, 0xD6, 0xDB, 0x60, 0x7F, 0x0F, 0xB6, 0x45,
+    0x6A, 0x0C, 0xB7, 0x16, 0xE8, 0x72, 0xC9, 0x43, 0xC9, 0xAD, 0x7B, 0xE1, 0x14, 0x85, 0xEF, 0x31,
+    0x9A, 0x5C, 0x42, 0x95, 0x66, 0x81, 0x7F, 0x14, 0x4F, 0x7C, 0xBE, 0x5C, 0xF6, 0x72, 0x79, 0x10,
+    0xD6, 0x0A, 0x9B, 0x6D, 0xCB, 0xC2, 0x90, 0xE1, 0xC7, 0x3C, 0x69, 0xCC, 0x05, 0xB1, 0x90, 0xC9,
+    0x17, 0xBF, 0x41, 0x0A, 0x55, 0xDD, 0xE2, 0x57, 0xC5, 0x37, 0x07, 0xE8, 0x45, 0xAB, 0xD8, 0x5F,
+    0x04, 0x7F, 0x8C, 0x1A, 0x73, 0x8E, 0x81, 0x27, 0x4C, 0x79, 0x2E, 0x12, 0x8C, 0x3D, 0x73, 0x86,
+    0x33, 0xBD, 0x93, 0x41, 0xC5, 0xDE, 0x36, 0x32, 0xF9, 0xD0, 0x8B, 0x18, 0x8D, 0x3B, 0xF7, 0xE9,
+    0xC3, 0x3E, 0xFF, 0x02, 0xCD, 0x55, 0x3D, 0x6F, 0x1E, 0x45, 0x10, 0x9E, 0xBD, 0xB5, 0x7D, 0x48,
+    0x2B, 0xB4, 0x14, 0x89, 0x14, 0x25, 0xA0, 0xA3, 0x47, 0xCA, 0xFE, 0x01, 0xE2, 0x3B, 0x94, 0x82,
+    0xD6, 0x45, 0x5E, 0x1A, 0x1A, 0xFE, 0x81, 0x29, 0x29, 0xC0, 0x7B, 0x31, 0x05, 0x12, 0x0D, 0xFE,
+    0x09, 0x14, 0x14, 0x28, 0x14, 0xB4, 0x46, 0xC2, 0xEF, 0xAD, 0xE3, 0x82, 0xD2, 0x6B, 0x51, 0xD0,
+    0x1E, 0x09, 0x88, 0x82, 0x22, 0x87, 0xB8, 0x90, 0xB3, 0xBD, 0x77, 0xC3, 0x33, 0xE7, 0x8F, 0x44,
+    0xC2, 0x91, 0x52, 0x72, 0x7A, 0x77, 0xDF, 0xBD, 0xD9, 0xD9, 0xF9, 0x78, 0xE6, 0xD9, 0x39, 0x22,
+    0xB5, 0x41, 0x9B, 0xFB, 0x3C, 0x18, 0xDE, 0xE4, 0x74, 0x8B, 0x8F, 0x37, 0x87, 0x8C, 0xC9, 0x76,
+    0xA6, 0xA3, 0x22, 0xBA, 0x9A, 0xCA, 0x7A, 0x49, 0xD4, 0x64, 0x03, 0x65, 0xC9, 0xB4, 0x64, 0x3A,
+    0x88, 0x9C, 0x88, 0x26, 0x88, 0x74, 0x0F, 0x51, 0x11, 0x20, 0x1A, 0xA9, 0xD9, 0xD9, 0x6C, 0x33,
+    0xE6, 0x89, 0x0C, 0xB3, 0xA8, 0x10, 0x11, 0xB4, 0x08, 0x5A, 0x44, 0xD0, 0xA2, 0x59, 0x94, 0xF1,
+    0x6F, 0x44, 0x9E, 0x3B, 0x52, 0x8B, 0x45, 0x05, 0x99, 0x5A, 0x60, 0x6A, 0x20, 0x74, 0xCC, 0x5D,
+    0x36, 0x55, 0x3E, 0xD8, 0x48, 0x1E, 0x07, 0x55, 0xD2, 0x1D, 0xE5, 0x5D, 0x11, 0x60, 0xBE, 0xC1,
+    0x91, 0x2C, 0x41, 0x64, 0x44, 0xE4, 0x44, 0xE4, 0x21, 0xA2, 0x89, 0x74, 0xD2, 0x23, 0xB9, 0x2E,
+    0x9F, 0x3E, 0xE4, 0x90, 0x33, 0x7B, 0xCA, 0xF9, 0xD7, 0x04, 0x8B, 0x79, 0x87, 0x09, 0x67, 0x45,
+    0x0B, 0x4E, 0x2E, 0x44, 0xAA, 0x41, 0x30, 0x25, 0xF7, 0x44, 0xB3, 0x77, 0xB5, 0xE1, 0x5A, 0xFF,
+    0x98, 0x7F, 0xE2, 0x2F, 0xD9, 0x8F, 0xC4, 0xF1, 0x6D, 0x18, 0x23, 0xF8, 0xA7, 0x12, 0x9B, 0x58,
+    0xEA, 0xFE, 0x65, 0xAF, 0x05, 0x43, 0x5F, 0xEC, 0xAC, 0x6E, 0x60, 0xDD, 0xC3, 0x75, 0x3D, 0xA8,
+    0xA1, 0xA8, 0xCC, 0x76, 0x4F, 0x1F, 0x17, 0xD0, 0xE1, 0x08, 0x18, 0x22, 0xF6, 0x22, 0x32, 0x83,
+    0x7E, 0x7A, 0x93, 0x8A, 0x83, 0x40, 0x69, 0x9D, 0xEC, 0x41, 0x9F, 0x0D, 0xE5, 0x29, 0x2B, 0x41,
+    0x49, 0xA2, 0x78, 0x83, 0x68, 0x1D, 0xC1, 0xD6, 0x02, 0x12, 0xC0, 0x5A, 0x63, 0x3E, 0x64, 0xFE,
+    0xE7, 0xFB, 0x93, 0x6F, 0x05, 0xB9, 0xE5, 0x0C, 0xDB, 0xD9, 0xCE, 0x7F, 0x5F, 0x02, 0x99, 0xE3,
+    0x0F, 0x10, 0x48, 0x70, 0x1C, 0x48, 0x90, 0x14, 0xBC, 0x9B, 0xDA, 0x30, 0x35, 0x83, 0xE2, 0x4E,
+    0x35, 0xF5, 0x1A, 0x30, 0x1A, 0xE4, 0x48, 0x59, 0xE3, 0xC4, 0x2B, 0x2E, 0x9D, 0x2C, 0x01, 0xB8,
+    0x43, 0x6D, 0xFB, 0x82, 0xA5, 0x40, 0xCF, 0x38, 0x64, 0x3C, 0x94, 0x28, 0xC2, 0x3D, 0xDA, 0x40,
+    0x01, 0xEB, 0x66, 0x92, 0x69, 0x34, 0x3D, 0x80, 0x05, 0x30, 0x26, 0xE2, 0xA8, 0x0D, 0x40, 0xBA,
+    0x10, 0x2E, 0x94, 0x38, 0x43, 0x5B, 0x80, 0x8A, 0x7E, 0x94, 0x98, 0x81, 0xBF, 0xDD, 0x17, 0xF4,
+    0x7E, 0x46, 0x11, 0xF2, 0xC7, 0xC0, 0x47, 0x9F, 0x06, 0x21, 0x83, 0x90, 0x84, 0xE9, 0x9C, 0x29,
+    0xF2, 0xC0, 0xA8, 0x05, 0x6A, 0x5F, 0x71, 0xCC, 0x63, 0xCE, 0x6D, 0x53, 0x65, 0x62, 0x16, 0xA8,
+    0x33, 0xE5, 0x2D, 0x5C, 0xF8, 0x98, 0xF5, 0xA8, 0xA9, 0x1B, 0x28, 0x89, 0xBC, 0x01, 0x74, 0x7A,
+    0xC8, 0x0F, 0xA3, 0x13, 0x8A, 0xFC, 0x35, 0xD8, 0x00, 0x69, 0x5F, 0xEA, 0x48, 0x59, 0xFF, 0xA9,
+    0x39, 0x82, 0xB7, 0xAD, 0xDB, 0x6A, 0x00, 0x5A, 0xF6, 0xB0, 0x2A, 0xEF, 0xC0, 0xE3, 0x69, 0x30,
+    0x4F, 0xE0, 0xA6, 0x6C, 0x95, 0xF8, 0xB6, 0x3D, 0x95, 0x08, 0x06, 0xA9, 0x9A, 0x8E, 0x2E, 0x9E,
+    0x92, 0x6B, 0x4E, 0x32, 0x0D, 0x79, 0x12, 0x28, 0x26, 0xC9, 0xC6, 0x57, 0xC8, 0xA1, 0x78, 0x08,
+    0x2D, 0xF3, 0x6C, 0x8E, 0xBC, 0x3A, 0x8F, 0x7C, 0xB6, 0xA3, 0x9F, 0xC0, 0x8A, 0xFD, 0x02, 0x19,
+    0x96, 0xB0, 0x85, 0xD0, 0x18, 0xFE, 0x81, 0xA8, 0x9B, 0x14, 0xA7, 0x86, 0x35, 0xA7, 0x57, 0x41,
+    0xCC, 0xBF, 0x80, 0xD8, 0x70, 0x35, 0x62, 0xEA, 0xD2, 0xEF, 0x19, 0x62, 0x42, 0x6C, 0x25, 0x17,
+    0x4C, 0xCF, 0x84, 0x6F, 0x45, 0x23, 0x48, 0xBD, 0xE4, 0x56, 0xC9, 0xE6, 0xCD, 0x9D, 0x39, 0x23,
+    0x6E, 0x99, 0xF9, 0xE0, 0xF7, 0xC5, 0x54, 0xE0, 0x62, 0x7F, 0x82, 0xDA, 0xEC, 0xE4, 0xFD, 0x4C,
+    0x64, 0xC4, 0x20, 0x34, 0x92, 0xA8, 0x85, 0xB6, 0x13, 0xBD, 0x6E, 0x5B, 0xDA, 0x6D, 0x48, 0xFF,
+    0xF2, 0x74, 0xE1, 0x3D, 0x4B, 0xF4, 0x7C, 0x01, 0x4D, 0x9E, 0x32, 0x0E, 0xBE, 0x32, 0x11, 0xE1,
+    0x02, 0xE8, 0x3D, 0xA4, 0x80, 0x88, 0xE1, 0xB9, 0x3C, 0x9B, 0x4C, 0x07, 0x33, 0x1E, 0x77, 0x52,
+    0xD0, 0x2C, 0x2F, 0x37, 0xB6, 0x44, 0x6F, 0x4F, 0x4E, 0x24, 0x59, 0x41, 0x81, 0xBF, 0x06, 0x43,
+    0x57, 0x2B, 0xCD, 0x57, 0x3D, 0xD2, 0x29, 0xB8, 0xD6, 0x72, 0x71, 0x82, 0x44, 0xB8, 0x14, 0xB6,
+    0xE3, 0x9C, 0xAB, 0x70, 0x1E, 0xE6, 0x80, 0xD6, 0x96, 0xE4, 0x8C, 0x25, 0xA0, 0x84, 0x27, 0x1F,
+    0x80, 0x26, 0xEE, 0xFA, 0x85, 0x14, 0x8E, 0x00, 0xE6, 0x9E, 0x54, 0x40, 0xB8, 0x5C, 0xA9, 0xA4,
+    0x9A, 0x68, 0x46, 0x38, 0x24, 0xB5, 0x4B, 0xAF, 0x59, 0xAE, 0x6F, 0x3B, 0xEE, 0x97, 0xEB, 0x39,
+    0xA7, 0x77, 0xC9, 0x23, 0xB9, 0xD5, 0x6A, 0x55, 0xA7, 0xF2, 0x20, 0xDD, 0x14, 0x6C, 0xC9, 0xD6,
+    0x60, 0x51, 0x7A, 0xFE, 0x8B, 0x23, 0x7E, 0xC5, 0x51, 0x72, 0x0F, 0xDB, 0x33, 0x18, 0xBA, 0xAB,
+    0xC7, 0x2D, 0x10, 0x01, 0x2D, 0x21, 0x3F, 0xF9, 0x23, 0xD9, 0xFD, 0x36, 0xB9, 0xF7, 0xDA, 0xDD,
+    0x52, 0xC5, 0x8F, 0xB6, 0x14, 0x92, 0x3F, 0x1F, 0xA3, 0xFC, 0x67, 0x91, 0x96, 0x59, 0x00, 0x5B,
+    0x11, 0xE6, 0x36, 0xC6, 0xA3, 0x70, 0xC3, 0xF2, 0x9F, 0x09, 0x60, 0x0C, 0xB4, 0x09, 0x1B, 0x1A,
+    0xF5, 0x7B, 0xD9, 0x98, 0x9F, 0xB5, 0x63, 0xA9, 0x32, 0x2A, 0x5C, 0x9C, 0x4C, 0xE8, 0x4B, 0x20,
+    0x50, 0xDE, 0x66, 0x33, 0xFE, 0x35, 0x10, 0x5A, 0xC1, 0xDB, 0x79, 0xAF, 0x05, 0x06, 0xD2, 0xB4,
+    0x54, 0x85, 0xF6, 0xC4, 0xB8, 0x54, 0x70, 0x40, 0xCF, 0x9B, 0xE3, 0xA5, 0x82, 0xBC, 0x59, 0x31,
+    0xFE, 0x19, 0xC6, 0x3B, 0x27, 0x0F, 0x1E, 0x1C, 0x49, 0x19, 0xEE, 0x4E, 0x0D, 0xA7, 0xBC, 0xA6,
+    0xEB, 0xD5, 0x35, 0x88, 0xEB, 0x5E, 0x6D, 0xD8, 0xED, 0xA7, 0x3C, 0x26, 0x78, 0xE6, 0x1A, 0x90,
+    0xA2, 0x96, 0x01, 0x5E, 0x71, 0xFD, 0x22, 0x81, 0xC7, 0xB5, 0x6E, 0xE9, 0x8E, 0xD0, 0xB9, 0x07,
+    0xE2, 0xB0, 0xD6, 0xDC, 0x67, 0xF9, 0x0E, 0x70, 0x95, 0xDC, 0xE0, 0x3E, 0x87, 0xF5, 0xB7, 0xE6,
+    0xD8, 0xAF, 0x2F, 0x2A, 0xB5, 0x78, 0x1F, 0x81, 0xF8, 0xD1, 0x8D, 0x68, 0xC7, 0x15, 0xBA, 0x8E,
+    0x89, 0x19, 0x9A, 0x2B, 0x6C, 0x74, 0x24, 0xB7, 0xB8, 0x82, 0x25, 0xF0, 0x48, 0x5A, 0x46, 0x2C,
+    0x50, 0x11, 0x2F, 0x01, 0x72, 0xEF, 0x41, 0x02, 0x34, 0x46, 0x08, 0x1A, 0x09, 0x58, 0x4F, 0x73,
+    0xB3, 0x00, 0x37, 0xB5, 0x7C, 0x72, 0xCE, 0x9B, 0xFD, 0xDC, 0xE8, 0x5F, 0x5C, 0xBA, 0x38, 0x7F,
+    0x5E, 0x70, 0xC2, 0x0A, 0x62, 0x97, 0x8C, 0xBB, 0x27, 0x38, 0xFA, 0x4B, 0xC6, 0xAD, 0x7D, 0x03,
+    0x44, 0x71, 0xD9, 0xBF, 0x4B, 0x59, 0xAF, 0x3B, 0x5B, 0xE7, 0xF8, 0xBE, 0xAD, 0x68, 0xB9, 0x13,
+    0x18, 0x3F, 0x4C, 0x94, 0x3D, 0xE2, 0xCA, 0xEC, 0x73, 0x28, 0x40, 0xB6, 0x12, 0xBC, 0xF4, 0x80,
+    0xAF, 0xA9, 0x1D, 0x35, 0x11, 0x0C, 0x6A, 0x91, 0xF2, 0xDF, 0x91, 0x2C, 0xFA, 0x8A, 0x49, 0x37,
+    0xC8, 0xB6, 0x03, 0x95, 0x79, 0xA7, 0x06, 0xDB, 0x17, 0x75, 0x81, 0x54, 0x0D, 0xC2, 0x5B, 0xA5,
+    0x6B, 0xBE, 0x1A, 0x9B, 0xFB, 0x13, 0xE6, 0x15, 0xE9, 0xF8, 0xFF, 0xA3, 0xE7, 0x5F, 0xAD, 0x55,
+    0x31, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0xF6, 0xDC, 0xAD, 0x23, 0xB9, 0x98, 0x2B, 0x72, 0x12, 0x22,
+    0x22, 0xD3, 0x22, 0x04, 0x67, 0xCA, 0x14, 0x9B, 0xB5, 0x43, 0x8A, 0x14, 0x29, 0x42, 0xC1, 0xFE,
+    0x03, 0x0A, 0xBA, 0x6B, 0x28, 0xAE, 0xD8, 0xC4, 0x16, 0xF9, 0x03, 0x27, 0x21, 0x2A, 0xDA, 0x20,
+    0x45, 0x47, 0x93, 0x22, 0xC5, 0x16, 0xCB, 0x79, 0x50, 0x8A, 0x14, 0x57, 0x60, 0x09, 0x21, 0xCA,
+    0xCC, 0x01, 0x12, 0x12, 0x14, 0x67, 0x12, 0x0B, 0x39, 0x62, 0xBC, 0x8F, 0xEF, 0x8D, 0x97, 0x13,
+    0xBA, 0x84, 0x0E, 0xFB, 0xCE, 0x6F, 0xF7, 0xED, 0xCC, 0x9B, 0xF7, 0x7D, 0xEF, 0x7B, 0xCF, 0x44,
+    0xE3, 0x65, 0xF8, 0x17, 0x3C, 0xEB, 0xDF, 0xEA, 0x86, 0x68, 0x4D, 0x74, 0x4C, 0xE4, 0x89, 0x94,
+    0xA3, 0x1E, 0xDE, 0x19, 0x2D, 0xA8, 0xEC, 0x94, 0xBD, 0x4E, 0xBC, 0xA6, 0xA5, 0xA1, 0x5E, 0x55,
+    0x3A, 0x2D, 0x16, 0xE4, 0xE2, 0xEF, 0xED, 0x1E, 0xED, 0xD0, 0x41, 0xAB, 0x0B, 0xA2, 0xAB, 0x53,
+    0x85, 0xBD, 0xC9, 0x77, 0xD4, 0x11, 0x45, 0x3F, 0xDB, 0x19, 0x36, 0x1E, 0x3C, 0x4E, 0x2D, 0xD1,
+    0x7B, 0x57, 0xA3, 0x81, 0x0A, 0xAD, 0x6C, 0xC6, 0x6D, 0x62, 0x97, 0x11, 0x77, 0xAA, 0x91, 0x0D,
+    0x71, 0x2B, 0x4B, 0xF1, 0x34, 0x15, 0x25, 0x2D, 0x11, 0x7F, 0xB1, 0xEF, 0x10, 0x80, 0xB9, 0xC2,
+    0xD6, 0xED, 0xAF, 0xC6, 0xBC, 0xB2, 0x5E, 0xFD, 0xD9, 0x19, 0xE5, 0xDE, 0xD6, 0x55, 0x74, 0x2F,
+    0xE2, 0xDE, 0x7C, 0xEE, 0xBC, 0xBE, 0xDF, 0xE6, 0x58, 0xF6, 0xB4, 0x5B, 0x86, 0x25, 0xB7, 0x99,
+    0x73, 0xEE, 0x68, 0x0B, 0xB7, 0xAE, 0x52, 0xAB, 0x71, 0x1B, 0xAB, 0x1B, 0xD3, 0x18, 0x97, 0x39,
+    0xE3, 0x74, 0x9B, 0xB6, 0xB1, 0x47, 0x0A, 0x99, 0x35, 0x4D, 0xE4, 0x23, 0x8F, 0xF3, 0xB4, 0x05,
+    0xB0, 0x15, 0x6D, 0xE3, 0xAE, 0x99, 0x9F, 0x33, 0xF3, 0xB7, 0xF3, 0xF9, 0x3E, 0x62, 0x2D, 0x90,
+    0x3B, 0x52, 0x49, 0x90, 0xB6, 0x91, 0xD8, 0x25, 0xFF, 0x84, 0x83, 0x00, 0x9B, 0xA2, 0xB9, 0xF0,
+    0x83, 0xDC, 0xF4, 0x61, 0xDA, 0x20, 0x71, 0x65, 0xD3, 0xC9, 0x43, 0x65, 0x0F, 0xB2, 0x6F, 0x92,
+    0x0F, 0xEC, 0xB5, 0x03, 0xAD, 0xE9, 0xD4, 0xBD, 0x3B, 0x55, 0x67, 0xF4, 0x08, 0x27, 0xC6, 0x4F,
+    0xEC, 0xB5, 0x36, 0x4D, 0xE9, 0xB4, 0x9D, 0xBE, 0xA5, 0x4F, 0xFF, 0x70, 0xD3, 0xDD, 0x1B, 0x77,
+    0x68, 0x4A, 0xF4, 0x98, 0xEE, 0x92, 0x29, 0x28, 0x43, 0xBA, 0x34, 0x79, 0x48, 0xF4, 0xE6, 0xD1,
+    0x83, 0x9C, 0x87, 0x9C, 0xC1, 0x35, 0x45, 0xC7, 0x85, 0x66, 0x97, 0xDF, 0xEA, 0x16, 0xE4, 0x57,
+    0xB4, 0x08, 0x7F, 0xAB, 0x7B, 0xD4, 0xE7, 0xBF, 0xB7, 0x29, 0x5B, 0xFA, 0x78, 0xE4, 0x43, 0x68,
+    0xED, 0x43, 0x65, 0x00, 0x56, 0xBE, 0x46, 0xF3, 0x97, 0xF3, 0x8C, 0xD9, 0x03, 0x47, 0xFB, 0xEA,
+    0xAF, 0x24, 0x14, 0x6F, 0xAE, 0xF9, 0x7C, 0x0E, 0xAA, 0x58, 0x16, 0xE3, 0x5B, 0xCC, 0x55, 0xC6,
+    0xAE, 0x4C, 0xDA, 0x55, 0xDC, 0x2D, 0x62, 0xE0, 0x69, 0x29, 0x71, 0x64, 0x2C, 0x95, 0x04, 0x8A,
+    0xF0, 0x31, 0xAB, 0x00, 0x17, 0x61, 0xFD, 0x3B, 0x47, 0x0F, 0xA4, 0x10, 0x83, 0xE2, 0x21, 0xBB,
+    0xD1, 0x7F, 0x8A, 0x85, 0xA6, 0x00, 0x8F, 0xB5, 0x45, 0x5A, 0xBB, 0xFB, 0x96, 0x32, 0x02, 0x95,
+    0xAA, 0x8D, 0xEA, 0xDB, 0xDC, 0x99, 0x75, 0x38, 0x0A, 0x04, 0xD7, 0xAA, 0xCF, 0x3F, 0xEB, 0xD3,
+    0x62, 0x73, 0x38, 0x38, 0xCB, 0x0A, 0xD5, 0x91, 0x6E, 0x68, 0x20, 0xD8, 0x9C, 0x60, 0x51, 0x86,
+    0xBC, 0x40, 0x3C, 0x38, 0xFD, 0xEB, 0x9D, 0x09, 0x9C, 0x45, 0x0C, 0xA7, 0x23, 0xAE, 0xD4, 0x40,
+    0x65, 0x4B, 0xEC, 0xEA, 0x72, 0x2B, 0x67, 0xD6, 0x6C, 0xF6, 0x39, 0xE6, 0x5B, 0xEE, 0x23, 0xDA,
+    0x8D, 0xFA, 0x50, 0xAC, 0x20, 0x64, 0x94, 0x2E, 0xC8, 0x49, 0x60, 0x48, 0xC9, 0xE4, 0xB1, 0x3B,
+    0x26, 0x31, 0x81, 0xB6, 0xB0, 0xB3, 0x29, 0xB9, 0x2E, 0x72, 0x3E, 0x01, 0x01, 0xCF, 0x9D, 0x66,
+    0xBF, 0x54, 0xCC, 0x7B, 0x11, 0xC3, 0x51, 0xFE, 0xCB, 0x81, 0xDA, 0x9F, 0x54, 0x29, 0x1C, 0x54,
+    0xFB, 0x25, 0x4D, 0x9E, 0xED, 0x21, 0xEC, 0x49, 0x45, 0x11, 0x1C, 0xB4, 0x80, 0xF2, 0xCC, 0xEB,
+    0x1D, 0x05, 0x1C, 0x36, 0x08, 0x29, 0x28, 0x28, 0x16, 0xFB, 0x8C, 0xD7, 0xC8, 0x6D, 0x2B, 0xF1,
+    0x25, 0x84, 0xEB, 0x7C, 0x19, 0x0B, 0x2B, 0x13, 0x7B, 0x05, 0x94, 0xDA, 0x6D, 0x4F, 0x68, 0x92,
+    0xD5, 0xC5, 0x07, 0xF4, 0x0B, 0x5D, 0x0A, 0x9B, 0x09, 0x57, 0xE6, 0xAC, 0x9D, 0xC5, 0xFD, 0x8A,
+    0xBC, 0x27, 0x0F, 0xDD, 0x7A, 0xF9, 0xD0, 0x97, 0x71, 0x9B, 0x71, 0x93, 0x8C, 0x84, 0xD3, 0x0E,
+    0x9A, 0x2B, 0xE7, 0x66, 0x47, 0x9A, 0xA0, 0x40, 0xED, 0x7B, 0x90, 0x87, 0x2E, 0xB0, 0xE7, 0xCA,
+    0x57, 0x9D, 0xEA, 0x95, 0x8F, 0x87, 0x78, 0x88, 0x06, 0x30, 0x33, 0xE0, 0x77, 0x1F, 0x56, 0x5D,
+    0xC6, 0x3D, 0x5E, 0x97, 0xF0, 0xFF, 0xC6, 0x98, 0xF7, 0x64, 0x18, 0xB5, 0x96, 0x0B, 0x87, 0x2B,
+    0x08, 0xD5, 0x6F, 0xA4, 0xB4, 0x0A, 0x1D, 0x1B, 0xAC, 0xB4, 0xBB, 0xD8, 0xB4, 0x1A, 0xAD, 0xA6,
+    0xD1, 0xEE, 0x51, 0x74, 0x28, 0x76, 0x21, 0x25, 0x5C, 0xC9, 0xB6, 0x4C, 0x2C, 0xFA, 0xAA, 0x14,
+    0xAB, 0x2C, 0xFD, 0xD5, 0x5C, 0x61, 0x97, 0x56, 0xEA, 0x45, 0x93, 0x73, 0xAB, 0x29, 0x7D, 0x22,
+    0x91, 0xF6, 0xC8, 0xDC, 0x6C, 0x42, 0x0B, 0xCE, 0x42, 0x64, 0xE4, 0x96, 0x34, 0xA1, 0x1D, 0x21,
+    0xDA, 0x70, 0x5A, 0x2D, 0x56, 0x26, 0x8A, 0xFC, 0x2E, 0x13, 0x44, 0x2C, 0x34, 0x13, 0xAC, 0x10,
+    0x1E, 0x15, 0x23, 0x80, 0x0B, 0xD7, 0xE5, 0x0D, 0xAE, 0xD9, 0x06, 0xD7, 0x6A, 0x83, 0xAB, 0x1B,
+    0x71, 0xFD, 0x17, 0x1E, 0xB3, 0xC1, 0x33, 0xDB, 0xD8, 0x05, 0xED, 0x57, 0x01, 0x4F, 0x82, 0xF6,
+    0x15, 0x3C, 0xE6, 0x47, 0x1F, 0xF0, 0xE4, 0x24, 0x36, 0xAD, 0x66, 0xE4, 0x81, 0x4B, 0x63, 0xA8,
+    0x78, 0xE0, 0x82, 0x1A, 0xA2, 0x6E, 0x1C, 0x29, 0xAA, 0x1D, 0x4F, 0x83, 0xB4, 0xC3, 0x78, 0x29,
+    0xC7, 0x9C, 0x83, 0x40, 0x81, 0x27, 0x85, 0x80, 0x04, 0x4F, 0xF6, 0xC3, 0x7C, 0x24, 0x5D, 0x70,
+    0x62, 0x5B, 0xC6, 0x43, 0x68, 0xE7, 0x70, 0xBD, 0xFF, 0x2A, 0xAE, 0x4B, 0x32, 0x34, 0xAA, 0x30,
+    0xAD, 0x62, 0x1E, 0xC7, 0x75, 0xFC, 0x12, 0x6D, 0x2B, 0x80, 0x0E, 0xE4, 0x4C, 0x1C, 0xB9, 0x25,
+    0x01, 0x56, 0xB2, 0x1A, 0x0B, 0xAE, 0x8B, 0xEC, 0xBC, 0x50, 0x8D, 0x73, 0x65, 0x94, 0x09, 0x67,
+    0x5F, 0xF7, 0x82, 0xF8, 0x13, 0x61, 0x12, 0x81, 0x8E, 0x25, 0x23, 0xE4, 0x56, 0x56, 0xD2, 0xD2,
+    0x2D, 0xE5, 0x4E, 0x7A, 0x10, 0xB6, 0x9F, 0xD4, 0x3D, 0x2D, 0x29, 0x9B, 0xC5, 0x40, 0x3F, 0x25,
+    0x73, 0xA7, 0xDA, 0x2D, 0x10, 0x48, 0xDF, 0x77, 0x41, 0x31, 0xDA, 0x4A, 0xA2, 0x98, 0xBF, 0x8D,
+    0x14, 0x24, 0xB1, 0xE8, 0xA0, 0x21, 0x80, 0x2C, 0x05, 0x4C, 0xA0, 0xB8, 0xDF, 0x48, 0x68, 0x36,
+    0x26, 0x13, 0x26, 0x54, 0xA8, 0xDA, 0x87, 0xC8, 0xEA, 0x02, 0x34, 0x54, 0x52, 0x61, 0x0D, 0xB6,
+    0xE6, 0x96, 0x26, 0x87, 0xE7, 0xFE, 0x22, 0xF0, 0x87, 0x49, 0x8A, 0x29, 0x5A, 0xBB, 0x98, 0x7B,
+    0xC5, 0x3E, 0xE6, 0x43, 0xC8, 0x59, 0xC0, 0x81, 0x43, 0x19, 0x7D, 0xA2, 0xC5, 0x06, 0x94, 0x7C,
+    0x29, 0x6F, 0x1C, 0x61, 0x26, 0xED, 0xCF, 0x03, 0x8C, 0xAF, 0x8C, 0xDC, 0x86, 0x99, 0x34, 0xF6,
+    0x4E, 0xDD, 0x86, 0x13, 0xD7, 0xFF, 0x1C, 0x7C, 0xF1, 0x5A, 0x84, 0x67, 0x59, 0x85, 0x8D, 0x61,
+    0xAD, 0x19, 0xC2, 0xF6, 0x33, 0x71, 0xA9, 0x5F, 0xC5, 0x15, 0xB7, 0xC1, 0xD5, 0x67, 0x12, 0xF8,
+    0x6E, 0x18, 0x3F, 0xB9, 0xBC, 0x47, 0x01, 0x52, 0x5C, 0xA0, 0xB4, 0x0B, 0x32, 0x90, 0x17, 0xC9,
+    0xFA, 0xA8, 0x86, 0x0B, 0xA2, 0x86, 0xAB, 0x3C, 0x3A, 0x82, 0x2B, 0x43, 0xED, 0xAD, 0xA8, 0x03,
+    0xAB, 0x30, 0x28, 0x01, 0x5B, 0xAA, 0x67, 0xAC, 0x08, 0x24, 0xE9, 0x45, 0x6E, 0x19, 0xBF, 0x00,
+    0x9F, 0x26, 0x4C, 0xEE, 0xFF, 0xF5, 0xFA, 0x1B, 0xD5, 0x55, 0x3D, 0x6F, 0xD3, 0x50, 0x14, 0xBD,
+    0x7E, 0x56, 0xEB, 0xE1, 0x0D, 0xCE, 0x00, 0x23, 0x7A, 0x0B, 0x03, 0x9B, 0x57, 0x16, 0x12, 0xC3,
+    0x2F, 0xE8, 0xC4, 0x00, 0xFF, 0x80, 0xDF, 0x40, 0x64, 0x23, 0x46, 0x7E, 0x04, 0x0B, 0x03, 0x38,
+    0x43, 0x17, 0xC6, 0x16, 0x5B, 0xEA, 0xD8, 0x81, 0x30, 0xB1, 0x46, 0x08, 0x09, 0xA9, 0x0C, 0x58,
+    0xE0, 0x4A, 0x6D, 0x70, 0x72, 0x39, 0xE7, 0x26, 0x29, 0x11, 0x05, 0x89, 0xAD, 0xE0, 0xE1, 0x26,
+    0x3E, 0xEF, 0xBE, 0xFB, 0xCE, 0xB9, 0x1F, 0xCF, 0x22, 0x12, 0x09, 0x9F, 0xB8, 0xA1, 0x4D, 0xCE,
+    0x68, 0xD3, 0x05, 0x6D, 0x30, 0x9B, 0x7E, 0xA4, 0x8D, 0x72, 0xB9, 0xF4, 0x3C, 0x36, 0x5B, 0x94,
+    0xB4, 0xA3, 0xF6, 0xE7, 0x0E, 0xFF, 0x85, 0x50, 0xFC, 0x89, 0x90, 0x6B, 0x0D, 0x3A, 0xCB, 0x18,
+    0x7D, 0x9C, 0x10, 0x1A, 0xC9, 0x92, 0x61, 0x4B, 0x42, 0xBE, 0x89, 0x3B, 0xB8, 0xB6, 0x84, 0xA2,
+    0x65, 0x55, 0x03, 0x52, 0x55, 0x40, 0x45, 0x55, 0x01, 0xCA, 0x72, 0x81, 0x57, 0xDA, 0x08, 0xBC,
+    0xFC, 0x14, 0x6B, 0x74, 0x95, 0xD0, 0x44, 0x3D, 0x99, 0x26, 0x70, 0xCC, 0xF4, 0x9B, 0x2E, 0x24,
+    0x68, 0xBF, 0x21, 0xE5, 0x4C, 0x40, 0xA4, 0x8D, 0x59, 0x83, 0xFB, 0x8C, 0x7C, 0x7A, 0x87, 0xB0,
+    0x72, 0x5B, 0x6E, 0xFD, 0xEB, 0x3A, 0x16, 0x31, 0x73, 0xAD, 0xEF, 0x78, 0x46, 0x61, 0x0A, 0x42,
+    0xCA, 0x93, 0x5C, 0xF9, 0x46, 0x7E, 0xFF, 0x44, 0x46, 0x3A, 0x5A, 0xDA, 0x8B, 0x29, 0x97, 0x82,
+    0x62, 0x25, 0xB3, 0x1D, 0xE9, 0x73, 0x42, 0xFE, 0x88, 0x50, 0x3C, 0xAB, 0xE9, 0xDA, 0x05, 0x42,
+    0x7D, 0xCC, 0x64, 0x0D, 0x85, 0x50, 0x26, 0x29, 0x88, 0xA5, 0x0D, 0xA1, 0x64, 0x5E, 0x29, 0x5C,
+    0xA1, 0x60, 0x4A, 0x35, 0x13, 0x40, 0x87, 0x42, 0xAF, 0x91, 0xD0, 0x0B, 0x6A, 0xE2, 0x9E, 0x6A,
+    0xA4, 0x10, 0x66, 0x22, 0xCC, 0x02, 0x1C, 0x6B, 0x7D, 0x0B, 0x1D, 0x85, 0xB6, 0x1B, 0x52, 0x67,
+    0xD4, 0x28, 0x7A, 0x8F, 0xB4, 0x46, 0xD3, 0x1A, 0xA2, 0x92, 0x59, 0x5A, 0xFE, 0x1F, 0x0A, 0x56,
+    0xED, 0xEE, 0x8D, 0x8F, 0xFF, 0x3C, 0xB5, 0xF1, 0x38, 0x30, 0x9E, 0x81, 0xD0, 0x1D, 0xCF, 0xC3,
+    0x53, 0x5B, 0x10, 0x9D, 0xD1, 0xEE, 0x6C, 0x0F, 0x48, 0x58, 0x59, 0x5B, 0x48, 0xAD, 0x07, 0x13,
+    0xE5, 0xBA, 0xFB, 0x6E, 0xD0, 0xB9, 0x41, 0x07, 0x23, 0x42, 0x43, 0x4F, 0xE9, 0xE1, 0x2E, 0xA1,
+    0xB4, 0x19, 0x95, 0x14, 0x48, 0xC8, 0xB5, 0xC2, 0x8E, 0xEB, 0x85, 0x50, 0x51, 0xED, 0x03, 0x1A,
+    0x29, 0x5A, 0x44, 0xC2, 0x49, 0x55, 0x97, 0xEC, 0x22, 0x78, 0x31, 0xC3, 0x0B, 0x61, 0x63, 0x8F,
+    0x1A, 0x61, 0x2F, 0xB5, 0x10, 0x04, 0xC1, 0x11, 0x1C, 0xBD, 0xF6, 0xAA, 0x79, 0xA2, 0x6A, 0x1C,
+    0x2D, 0x13, 0x96, 0x10, 0x2D, 0x39, 0x18, 0x73, 0xB6, 0x25, 0x3A, 0xBC, 0x11, 0x26, 0x70, 0x5C,
+    0x8B, 0x03, 0xB3, 0xF8, 0x6B, 0x2F, 0x09, 0x48, 0x05, 0xBF, 0x2A, 0xE2, 0xAA, 0xDB, 0xD1, 0xDC,
+    0xB5, 0xBD, 0x0E, 0x9D, 0xF1, 0x76, 0xAD, 0x57, 0x6A, 0x0E, 0x79, 0x66, 0xC1, 0x7A, 0xA9, 0xAB,
+    0x97, 0x4C, 0xF9, 0xC4, 0x96, 0xC1, 0xD2, 0x06, 0x66, 0x6E, 0x53, 0x80, 0xF9, 0x60, 0xDA, 0x07,
+    0xF0, 0xC2, 0x6E, 0x37, 0x4D, 0x66, 0xE4, 0x9D, 0xE6, 0xA8, 0x03, 0x82, 0x8F, 0x39, 0xAD, 0x7A,
+    0x7F, 0xD2, 0xD6, 0x9A, 0x17, 0xA0, 0x76, 0xA4, 0x0B, 0x87, 0x9F, 0xE5, 0x3A, 0x8D, 0xBB, 0xBA,
+    0xCC, 0x23, 0xBE, 0x86, 0xF3, 0x87, 0x3D, 0x9A, 0x23, 0x6E, 0x51, 0xBB, 0xB4, 0xC1, 0xF2, 0x90,
+    0x55, 0x7B, 0x6D, 0xF4, 0xE8, 0xCC, 0xE1, 0x93, 0xC0, 0x6A, 0x14, 0x2C, 0x12, 0x79, 0x24, 0x17,
+    0x10, 0x13, 0x28, 0xCC, 0x82, 0x33, 0x57, 0xD3, 0x8D, 0x6A, 0x5C, 0xF3, 0x3A, 0xDF, 0x9F, 0x41,
+    0x8A, 0x8A, 0x33, 0x3D, 0xD7, 0xF7, 0x84, 0x44, 0xB1, 0xD5, 0x66, 0xCE, 0x82, 0x58, 0x6D, 0xCA,
+    0x75, 0x48, 0x8B, 0x76, 0x73, 0x53, 0xE3, 0x6E, 0x73, 0x5B, 0x5A, 0x81, 0x57, 0x13, 0x6A, 0x09,
+    0x18, 0x6C, 0xB5, 0x35, 0xF3, 0xFD, 0x8C, 0x8A, 0x76, 0xB4, 0x9A, 0xF4, 0x58, 0x8F, 0x5B, 0xC8,
+    0xF7, 0xBC, 0x33, 0x6E, 0x58, 0xD3, 0xDA, 0x16, 0x4B, 0xB7, 0x89, 0xA9, 0x55, 0x1B, 0x47, 0xC5,
+    0x7E, 0x5E, 0xBD, 0x58, 0x43, 0xDB, 0x5E, 0x39, 0x20, 0x9F, 0xD7, 0xAB, 0x5A, 0x44, 0x9D, 0x3F,
+    0x7D, 0xB4, 0xFF, 0x9E, 0x67, 0xA0, 0x12, 0x17, 0x57, 0x60, 0xB2, 0xD9, 0x45, 0x09, 0x8E, 0x15,
+    0xB2, 0x46, 0x1C, 0xC8, 0xD5, 0xF2, 0xB2, 0x1A, 0x65, 0x1D, 0x29, 0xC1, 0x64, 0x4F, 0x3B, 0x5C,
+    0xD5, 0x31, 0xCF, 0x74, 0xE5, 0x55, 0xF2, 0x72, 0x1D, 0x5A, 0x32, 0xB4, 0x98, 0x9F, 0xA2, 0x41,
+    0x93, 0x1C, 0x46, 0xDD, 0x2F, 0x57, 0x13, 0xFB, 0xF2, 0x03, 0xF7, 0x3C, 0x29, 0x4E, 0x70, 0xA9,
+    0xD4, 0xFC, 0x92, 0xA0, 0x93, 0x39, 0xA4, 0x49, 0x7E, 0xF9, 0x44, 0xDC, 0xE4, 0xE8, 0x7F, 0xF0,
+    0x2A, 0xDD, 0xB2, 0x7A, 0xB5, 0x4D, 0x75, 0xED, 0x35, 0x00, 0xE4, 0xA6, 0xFC, 0x1C, 0x94, 0x80,
+    0xC6, 0x6E, 0xF1, 0x60, 0x72, 0xCA, 0xF0, 0xC7, 0x34, 0xAC, 0x12, 0xF4, 0x76, 0xAC, 0x1D, 0x3E,
+    0x42, 0xBB, 0xF0, 0xDF, 0xDB, 0x64, 0xE6, 0x98, 0x59, 0xC9, 0x11, 0x02, 0x01, 0xB0, 0xBD, 0x96,
+    0xBF, 0xFA, 0xDB, 0x25, 0x54, 0xDB, 0xCB, 0x9F, 0x9E, 0x1F, 0xD5, 0x55, 0x3D, 0x6E, 0xD6, 0x40,
+    0x10, 0x1D, 0xAF, 0xF3, 0xC9, 0x85, 0x15, 0x6D, 0x0A, 0x7E, 0x8A, 0x48, 0xB8, 0x47, 0x42, 0x7B,
+    0x81, 0x48, 0xB6, 0xC4, 0x05, 0x52, 0x24, 0x0D, 0x97, 0xC8, 0x0D, 0xE2, 0x25, 0x0D, 0x6D, 0x0E,
+    0x41, 0x45, 0x93, 0x13, 0x7C, 0xB1, 0x11, 0x05, 0x05, 0x8D, 0xB9, 0x81, 0x0B, 0x0E, 0x60, 0xA2,
+    0x8D, 0x30, 0xC2, 0xF6, 0xF0, 0xDE, 0x7E, 0x24, 0x84, 0x08, 0x24, 0x40, 0x14, 0x61, 0x65, 0x3D,
+    0x7B, 0xBC, 0x33, 0xB3, 0xF3, 0x66, 0x3C, 0x63, 0x11, 0x91, 0xDC, 0x8B, 0x4A, 0x31, 0xA5, 0xEA,
+    0x5D, 0x27, 0x3B, 0x12, 0x57, 0xA2, 0xFA, 0x4E, 0x97, 0x95, 0x56, 0x66, 0x92, 0x7C, 0x10, 0xD7,
+    0x4A, 0x23, 0xBF, 0xF5, 0x18, 0x32, 0x55, 0xA7, 0x13, 0x7D, 0x94, 0x22, 0xDA, 0xA5, 0x5F, 0x82,
+    0x7D, 0x3F, 0x39, 0x7F, 0xFC, 0x44, 0xB6, 0x37, 0xAE, 0x0B, 0x9D, 0x9C, 0x8E, 0x70, 0x0D, 0x8B,
+    0x3F, 0xBF, 0xAA, 0x68, 0x4E, 0xFF, 0x65, 0xB5, 0xAE, 0x9F, 0x2B, 0x2E, 0x27, 0x6B, 0xB9, 0x5A,
+    0xFF, 0xC8, 0xF9, 0x16, 0x5C, 0xED, 0xAA, 0x2E, 0x95, 0x38, 0x55, 0x0D, 0xB2, 0xD2, 0xD5, 0xD9,
+    0x42, 0x1D, 0xA3, 0x9E, 0x9A, 0x65, 0x47, 0xB4, 0x03, 0x31, 0x0F, 0xC4, 0x74, 0x8C, 0x38, 0x11,
+    0xCD, 0x74, 0x5F, 0x0F, 0x91, 0xB9, 0x52, 0xB5, 0x33, 0xD3, 0x63, 0x7D, 0xE5, 0xCD, 0xB7, 0xF7,
+    0x37, 0x34, 0xA3, 0x55, 0x1E, 0x3D, 0xD8, 0x3E, 0xFA, 0x64, 0x0A, 0x13, 0xC5, 0x29, 0x87, 0x47,
+    0x13, 0x88, 0xC0, 0x98, 0xA7, 0x7F, 0xBE, 0xE6, 0x26, 0x6B, 0xE3, 0xC9, 0x7B, 0xDC, 0x03, 0xA6,
+    0xAA, 0x2D, 0x6E, 0x7B, 0x8E, 0xA9, 0x30, 0xFE, 0x58, 0x7E, 0xBA, 0x6A, 0xEC, 0xAA, 0xBE, 0xD5,
+    0x5E, 0xAC, 0x8E, 0x19, 0xB2, 0xF2, 0x30, 0x08, 0x2D, 0x1C, 0x88, 0xF4, 0x62, 0x50, 0xB7, 0xA6,
+    0xA2, 0x70, 0x31, 0x45, 0x01, 0x84, 0x20, 0x0C, 0x75, 0x45, 0x01, 0xD1, 0x52, 0xB0, 0x03, 0x05,
+    0xA9, 0x3D, 0x05, 0x33, 0x47, 0xC1, 0x0E, 0x14, 0xA4, 0x3C, 0xA1, 0x90, 0xCC, 0x51, 0xB0, 0x17,
+    0x14, 0xA4, 0x3C, 0xA3, 0x90, 0x68, 0x14, 0x72, 0x15, 0x13, 0xF0, 0x6E, 0xC8, 0x74, 0x26, 0xB5,
+    0x06, 0x94, 0x40, 0x99, 0x6B, 0xE7, 0x2A, 0x44, 0xD3, 0x13, 0xD3, 0xF8, 0xC5, 0x30, 0xBB, 0x58,
+    0x4D, 0x54, 0xC9, 0xC6, 0xB8, 0x7F, 0xEF, 0x3B, 0x9B, 0xD5, 0x7E, 0xD4, 0xD1, 0x53, 0xD6, 0x99,
+    0x65, 0x6A, 0x3E, 0xEC, 0xE2, 0x04, 0x14, 0x46, 0x5B, 0x6A, 0x97, 0x3D, 0x08, 0x20, 0xB8, 0xA2,
+    0x63, 0x55, 0x90, 0x4F, 0xF8, 0x28, 0x3D, 0x9D, 0x97, 0x15, 0xB1, 0xAE, 0x58, 0x83, 0xDB, 0x88,
+    0xF7, 0xD4, 0x19, 0xA9, 0x9F, 0x86, 0x92, 0xB6, 0x43, 0x41, 0x3F, 0xBD, 0x45, 0xEC, 0xAE, 0xCD,
+    0x66, 0x7E, 0x19, 0x46, 0xBB, 0x0C, 0x07, 0xD5, 0xFC, 0x1A, 0xC0, 0x2B, 0x06, 0xFA, 0xEC, 0x74,
+    0xD3, 0x2B, 0x11, 0x6D, 0x15, 0x13, 0xEE, 0x63, 0x88, 0x7C, 0x2E, 0xE6, 0xD8, 0x04, 0xA7, 0xB7,
+    0x48, 0xDC, 0x55, 0x16, 0x71, 0xE5, 0xB1, 0x18, 0xC5, 0xA6, 0x7D, 0x95, 0x38, 0x39, 0x3A, 0x1C,
+    0x72, 0x38, 0x4C, 0xDB, 0xC4, 0xDF, 0x71, 0x16, 0x73, 0x4A, 0x27, 0xFA, 0x82, 0xC7, 0xC5, 0x06,
+    0xC9, 0xDE, 0x70, 0xD7, 0xF8, 0xF3, 0xDB, 0x9D, 0x71, 0x87, 0xAB, 0x90, 0x0D, 0x16, 0xE6, 0x36,
+    0xB8, 0x3E, 0x22, 0x9C, 0x64, 0xBD, 0xF5, 0xFF, 0x41, 0xFC, 0x5B, 0xB1, 0x9B, 0xF7, 0x0A, 0x6F,
+    0xDB, 0xF3, 0x74, 0x30, 0xE3, 0xC4, 0x01, 0xC0, 0x5F, 0x43, 0x0A, 0xED, 0x25, 0x48, 0x99, 0x77,
+    0xB6, 0x73, 0x4F, 0x83, 0xAC, 0xB7, 0xC5, 0x6C, 0x08, 0x25, 0x07, 0x44, 0xA7, 0x73, 0xD2, 0xD1,
+    0xDF, 0xC7, 0x10, 0x79, 0x00, 0xBD, 0x94, 0x81, 0xDD, 0x04, 0x53, 0x04, 0x63, 0xB4, 0x05, 0x11,
+    0xA3, 0x01, 0xA4, 0xCC, 0xE5, 0x82, 0x11, 0x6A, 0xC0, 0x69, 0x06, 0x5A, 0x4E, 0xAB, 0x90, 0x4E,
+    0x45, 0x87, 0x49, 0xD3, 0x64, 0x01, 0xE8, 0x5E, 0x2F, 0x40, 0x6C, 0x9C, 0x04, 0x50, 0xB1, 0x17,
+    0x81, 0xDF, 0x05, 0x8E, 0xC7, 0x78, 0xAD, 0x39, 0x8D, 0xBC, 0x1D, 0x19, 0x15, 0xBB, 0xD4, 0x75,
+    0x06, 0x93, 0xA9, 0xEE, 0xCD, 0x65, 0x1C, 0xB7, 0x21, 0x92, 0xD9, 0x92, 0x07, 0x2F, 0x6F, 0xCC,
+    0xA8, 0x47, 0x9B, 0xCE, 0x08, 0x37, 0x06, 0xD4, 0xA6, 0x41, 0xE4, 0xA8, 0x8D, 0xB7, 0xFD, 0x1F,
+    0x2B, 0x63, 0x51, 0x0D, 0xA7, 0x9F, 0x74, 0xE1, 0xCC, 0xDD, 0x85, 0xD9, 0x51, 0x97, 0x4C, 0xEC,
+    0x21, 0xA9, 0xD9, 0x4F, 0x52, 0xB4, 0xFC, 0x35, 0x66, 0xCC, 0x6A, 0xFB, 0xD7, 0x1B, 0x28, 0x22,
+    0x9E, 0xF0, 0xE3, 0x90, 0xF3, 0x38, 0x3B, 0x21, 0xD7, 0x2D, 0x33, 0x65, 0x97, 0xC3, 0xA6, 0xE5,
+    0xD0, 0xD7, 0xEE, 0xBA, 0x36, 0xAB, 0x03, 0xF9, 0xD5, 0xFA, 0x0A, 0xD5, 0x55, 0xB1, 0x6E, 0xD4,
+    0x40, 0x10, 0x1D, 0xDB, 0xDC, 0xB9, 0x30, 0xD2, 0xA6, 0x20, 0x0D, 0x29, 0xDC, 0x50, 0x50, 0x20,
+    0xF6, 0x0B, 0x60, 0x4D, 0x5A, 0x0A, 0xAE, 0xB8, 0xA3, 0x85, 0x2F, 0x20, 0x0D, 0x2D, 0xD8, 0x12,
+    0xBF, 0x00, 0x7F, 0x00, 0x15, 0x05, 0x0D, 0x25, 0x9C, 0x2D, 0x45, 0x54, 0x34, 0xE6, 0x0B, 0x70,
+    0x43, 0x43, 0x13, 0x23, 0x59, 0xC2, 0x11, 0xB6, 0x87, 0xF7, 0xF6, 0x92, 0x90, 0x00, 0x12, 0x12,
+    0x28, 0x05, 0xD6, 0xDD, 0x6A, 0x3D, 0xBB, 0x3B, 0xF3, 0xE6, 0xCD, 0x9B, 0xB5, 0x88, 0x48, 0x26,
+    0x7C, 0x5E, 0x73, 0x08, 0x26, 0x8E, 0xA1, 0x16, 0x18, 0x23, 0xE5, 0x42, 0x74, 0xE8, 0x57, 0x17,
+    0x72, 0xF6, 0x31, 0x3A, 0x88, 0xD5, 0xAF, 0x3A, 0x61, 0xD6, 0xEF, 0x74, 0x22, 0x7B, 0x75, 0x30,
+    0x60, 0x77, 0x2B, 0x39, 0x56, 0x07, 0x49, 0x2B, 0x11, 0x27, 0x71, 0x8B, 0x9D, 0xD5, 0x5F, 0x2F,
+    0xB8, 0x4C, 0x30, 0x33, 0x8D, 0xC8, 0x5A, 0x22, 0x98, 0xF0, 0x9E, 0x57, 0xE2, 0x2A, 0x31, 0xD3,
+    0xAA, 0xC4, 0x76, 0x55, 0xAD, 0x45, 0x12, 0xF5, 0x70, 0x67, 0xCB, 0xD3, 0xF8, 0x72, 0x3F, 0xBA,
+    0xD6, 0x8F, 0xEA, 0xC7, 0xDB, 0x7C, 0x71, 0xD9, 0x63, 0x8C, 0x89, 0xC4, 0xD9, 0xFF, 0x94, 0x8E,
+    0x93, 0x11, 0xA3, 0x6D, 0x72, 0xAC, 0x24, 0x5D, 0x0A, 0x0F, 0xD2, 0x87, 0xAD, 0xFC, 0xE6, 0x71,
+    0xDA, 0x4A, 0xA9, 0x1F, 0xB5, 0xC7, 0xAC, 0xD9, 0xAB, 0x25, 0x28, 0xB3, 0x7F, 0x44, 0xFD, 0xEB,
+    0x02, 0xC1, 0x60, 0xE6, 0x0A, 0x09, 0x7B, 0x31, 0x30, 0x8D, 0x12, 0x80, 0x62, 0xFC, 0xDC, 0xE1,
+    0x5D, 0xA5, 0x70, 0x94, 0xD2, 0xB1, 0xEA, 0xC5, 0xB4, 0xBD, 0x91, 0xCE, 0x85, 0x1F, 0x22, 0x4B,
+    0xDB, 0x13, 0x8D, 0xB9, 0xFE, 0x44, 0x62, 0xB3, 0xB3, 0x89, 0x84, 0xAA, 0x95, 0xD3, 0xF7, 0xF0,
+    0xA1, 0x3A, 0x87, 0x3B, 0x5B, 0x07, 0x23, 0x81, 0x80, 0xB8, 0xB8, 0x91, 0xB8, 0x03, 0x1A, 0x49,
+    0xDA, 0x00, 0xA5, 0x32, 0x0D, 0x20, 0x89, 0xAD, 0x1E, 0xD1, 0xDF, 0x13, 0xFA, 0xCE, 0x2D, 0x3D,
+    0xAC, 0xE9, 0x5B, 0xB4, 0xA2, 0x33, 0xD2, 0xE7, 0xD1, 0x8B, 0xCF, 0xE4, 0x48, 0x1F, 0xCC, 0xF0,
+    0x27, 0x33, 0xC1, 0xE6, 0x3A, 0xF8, 0x24, 0x90, 0xBB, 0x22, 0x94, 0x02, 0xDE, 0x9C, 0xBE, 0x6C,
+    0x41, 0x4F, 0x2F, 0x98, 0x99, 0x16, 0xA1, 0x96, 0x9A, 0xD9, 0x22, 0x1E, 0xC0, 0x41, 0xDA, 0x60,
+    0xA9, 0xC4, 0x24, 0x6E, 0x31, 0xC9, 0x31, 0x49, 0x38, 0x99, 0x30, 0xB1, 0x95, 0x2D, 0x92, 0x2E,
+    0x9C, 0x5E, 0x8D, 0x9E, 0x8F, 0x70, 0x5C, 0x1E, 0xF9, 0xE9, 0x99, 0x22, 0x08, 0x2A, 0xD5, 0x87,
+    0xBF, 0xFC, 0xDC, 0x07, 0x46, 0xFD, 0xCB, 0x83, 0x91, 0xF0, 0x20, 0x0B, 0xCF, 0x77, 0x5A, 0x20,
+    0x69, 0x53, 0xE3, 0x05, 0xB5, 0x00, 0x48, 0x5F, 0x0A, 0x47, 0xB3, 0xA9, 0x4C, 0x01, 0x23, 0x93,
+    0x1F, 0xB0, 0xB6, 0x11, 0x89, 0xA9, 0x5C, 0x03, 0x63, 0x3C, 0x91, 0xAB, 0xBC, 0xE5, 0x31, 0x65,
+    0xC9, 0x5C, 0x83, 0x2D, 0xE0, 0x8E, 0xB2, 0x13, 0x37, 0xE3, 0xE1, 0xFD, 0x0A, 0xFB, 0xDA, 0x21,
+    0xEC, 0xD2, 0xC1, 0x7D, 0xEB, 0x8D, 0x46, 0xDA, 0xB1, 0x5C, 0x47, 0x8D, 0x71, 0x51, 0x7C, 0xF5,
+    0x85, 0x65, 0x96, 0x90, 0x95, 0x4C, 0xBA, 0x63, 0x9A, 0xAE, 0x9D, 0x2E, 0xD4, 0x6C, 0x41, 0xCD,
+    0x92, 0x27, 0xAD, 0x82, 0x31, 0x1C, 0x70, 0xC0, 0xD4, 0x61, 0x07, 0x8D, 0xCF, 0x24, 0xA1, 0x52,
+    0xD7, 0x20, 0xFA, 0x5E, 0x23, 0x3B, 0xBE, 0xB9, 0x0E, 0x9A, 0x68, 0x84, 0xC5, 0x61, 0x09, 0xC9,
+    0xAD, 0x91, 0xA8, 0x81, 0x25, 0xD6, 0xA7, 0xEC, 0xBE, 0xAA, 0x1C, 0xA1, 0x8D, 0xA5, 0x6C, 0xE1,
+    0xD4, 0x55, 0xC6, 0xE7, 0x71, 0x36, 0xAF, 0x45, 0xD4, 0x88, 0xE1, 0x59, 0x47, 0x73, 0x46, 0x27,
+    0x2B, 0xFC, 0xCB, 0x69, 0x53, 0xB4, 0xB4, 0xB6, 0x55, 0xD4, 0x63, 0x93, 0xCD, 0x10, 0x79, 0xC1,
+    0xC8, 0x1E, 0xC2, 0xF6, 0x84, 0x3E, 0x00, 0x44, 0x9D, 0x26, 0x71, 0x75, 0x42, 0x2A, 0x18, 0xD9,
+    0x43, 0xA0, 0x25, 0x3F, 0xDC, 0x55, 0xCD, 0x87, 0x44, 0x3F, 0xA8, 0xCC, 0xB2, 0xE0, 0xE8, 0x4A,
+    0x64, 0x2C, 0x87, 0xA0, 0x31, 0x25, 0x34, 0xC0, 0x97, 0x45, 0x56, 0x71, 0x0D, 0xD2, 0xAF, 0x78,
+    0x84, 0xE7, 0x16, 0x9D, 0xCE, 0x5D, 0xFD, 0x10, 0xAC, 0xDE, 0x29, 0x64, 0x2C, 0xA1, 0xA6, 0x5D,
+    0x90, 0xB0, 0x35, 0x2F, 0xCE, 0x9B, 0xF5, 0x20, 0x43, 0x13, 0x2A, 0x54, 0x62, 0x5A, 0xC8, 0x6F,
+    0x42, 0x32, 0xDE, 0x72, 0xDE, 0x64, 0xFB, 0x6E, 0x67, 0xA5, 0x21, 0xCE, 0x34, 0xAE, 0x25, 0x6C,
+    0x6E, 0x8A, 0x5C, 0x47, 0xF1, 0x83, 0xEE, 0x06, 0xAF, 0x66, 0xE4, 0xED, 0x9A, 0x73, 0x55, 0x1B,
+    0xBC, 0x6E, 0xB3, 0xAD, 0x6F, 0x01, 0x42, 0xAE, 0x5F, 0xE0, 0x3B, 0xCF, 0xCA, 0x3E, 0xEE, 0xE1,
+    0x1C, 0x86, 0xA4, 0xC6, 0xFD, 0x61, 0xEA, 0x85, 0x94, 0x5E, 0x84, 0xF6, 0xDD, 0xCB, 0x51, 0xE6,
+    0x25, 0x2F, 0xB9, 0x5C, 0xF5, 0xF3, 0x52, 0xF4, 0xD3, 0xDA, 0xEB, 0x94, 0x7D, 0xBD, 0xB9, 0x23,
+    0xD3, 0xE3, 0x3B, 0x32, 0x47, 0x43, 0xC3, 0xAB, 0xAE, 0xDE, 0x58, 0x1D, 0xB1, 0x3B, 0xD4, 0x3E,
+    0x02, 0x32, 0xC4, 0xE3, 0xFD, 0x1E, 0x2C, 0x3D, 0x9D, 0xA9, 0x6A, 0x30, 0xC6, 0x83, 0xA9, 0xA2,
+    0xEE, 0xAD, 0x24, 0xFB, 0xAD, 0x5C, 0x62, 0x97, 0xAD, 0x37, 0x97, 0x44, 0xD2, 0x6E, 0xE4, 0x9F,
+    0x67, 0xBE, 0x15, 0xA2, 0x89, 0x82, 0x7C, 0xF6, 0x00, 0xF9, 0x77, 0x21, 0xAF, 0xD9, 0x55, 0xE6,
+    0x3F, 0xCE, 0x06, 0x5B, 0x2D, 0xC0, 0x25, 0x35, 0x31, 0x08, 0x18, 0xE1, 0xE7, 0x45, 0xEE, 0xCB,
+    0x1F, 0x9E, 0xEF, 0xC5, 0x55, 0xBD, 0x8E, 0xD6, 0x46, 0x14, 0x3D, 0x63, 0xB3, 0x6B, 0xA1, 0x4F,
+    0xCA, 0x50, 0x64, 0x1B, 0x52, 0xF8, 0x0D, 0x32, 0x6D, 0x1A, 0x34, 0x23, 0x68, 0xE8, 0xD8, 0x22,
+    0x1F, 0xCD, 0x36, 0xB4, 0xA9, 0x96, 0x07, 0x88, 0xD6, 0x26, 0x3C, 0x00, 0x14, 0x28, 0x4F, 0x90,
+    0x3E, 0x29, 0xD2, 0xEE, 0xDA, 0x84, 0x82, 0x62, 0x1B, 0x47, 0xBC, 0x80, 0x85, 0x84, 0x28, 0x28,
+    0xB0, 0x90, 0x21, 0xDE, 0x30, 0xF6, 0xE5, 0x5C, 0x1B, 0x7D, 0x0B, 0x4B, 0xA2, 0xA0, 0x28, 0xAB,
+    0x8C, 0x3C, 0xD6, 0xD5, 0xF8, 0xFA, 0xFE, 0x9C, 0x7B, 0xEE, 0x1D, 0x00, 0x30, 0x35, 0x90, 0x97,
+    0x40, 0x15, 0x00, 0xC1, 0xB2, 0x2B, 0xEE, 0xEF, 0xB1, 0x59, 0x3B, 0xD4, 0x90, 0x26, 0x15, 0x69,
+    0x7C, 0xE9, 0x1F, 0x0E, 0xF0, 0x37, 0x6A, 0x1C, 0x79, 0x98, 0x93, 0x71, 0xBD, 0xF7, 0x42, 0x44,
+    0x7E, 0x16, 0x19, 0x8F, 0x80, 0x64, 0x00, 0xB2, 0x0E, 0xB0, 0x0D, 0xE0, 0xB9, 0x8B, 0x93, 0x9B,
+    0x4D, 0x25, 0x82, 0x42, 0x7A, 0x6C, 0x7D, 0x4B, 0x3B, 0x17, 0xB9, 0x0F, 0x81, 0xB4, 0xE7, 0xF7,
+    0x1A, 0x49, 0xA4, 0x2A, 0x9D, 0x7F, 0x73, 0xEA, 0x68, 0x2B, 0x20, 0xA3, 0xB2, 0x48, 0x6F, 0x5B,
+    0xDB, 0x1D, 0xC0, 0x3E, 0xE9, 0xE0, 0xEE, 0xD5, 0x38, 0x28, 0xD6, 0x37, 0xFF, 0xA4, 0x23, 0x75,
+    0xB6, 0xCF, 0x58, 0xE9, 0xCC, 0xC4, 0xC5, 0x90, 0xE5, 0xCE, 0xA7, 0xF5, 0xAF, 0x4E, 0xA4, 0xCE,
+    0x65, 0x84, 0x59, 0xD3, 0x0E, 0x53, 0xC9, 0x69, 0x59, 0x6A, 0x58, 0x29, 0x71, 0xE0, 0x43, 0xDA,
+    0x79, 0x78, 0x5C, 0xC1, 0x2D, 0xEC, 0xFE, 0x97, 0x8E, 0x76, 0x4D, 0xB0, 0xC4, 0xA4, 0xB8, 0x33,
+    0x99, 0x91, 0x3A, 0xC1, 0x9C, 0xA6, 0xC2, 0x7C, 0x0B, 0x09, 0x56, 0x24, 0x4C, 0x90, 0xAC, 0xC5,
+    0xE8, 0x89, 0x4F, 0x44, 0xF6, 0xFC, 0xF5, 0x7A, 0x9F, 0x78, 0x4D, 0x04, 0xE6, 0x0D, 0xF1, 0x5A,
+    0xB5, 0x4B, 0xA8, 0x5E, 0xD1, 0x0F, 0x30, 0xF2, 0x6C, 0xEF, 0xAA, 0x48, 0x34, 0xC4, 0x1A, 0x3B,
+    0x73, 0xAC, 0xB7, 0x91, 0x76, 0xC8, 0x5B, 0xB8, 0x46, 0x1F, 0xEA, 0xDA, 0x8D, 0x8F, 0x6D, 0x09,
+    0x7E, 0xC4, 0x7E, 0xAF, 0x88, 0xD3, 0xC0, 0xA8, 0x71, 0xFE, 0xA5, 0x48, 0x73, 0x56, 0x22, 0x92,
+    0xA0, 0x95, 0x9E, 0xB0, 0xEA, 0x50, 0xA8, 0xD5, 0x53, 0x4B, 0xA6, 0x6A, 0xAC, 0x84, 0xAF, 0xFE,
+    0xDE, 0xC2, 0x46, 0x2C, 0xE4, 0x11, 0x4B, 0x8A, 0x0B, 0xC8, 0x7A, 0xF8, 0x2E, 0x91, 0xCE, 0x1E,
+    0xB7, 0x71, 0x75, 0xDC, 0xD8, 0xEB, 0x3C, 0xFB, 0x37, 0xA6, 0xB6, 0xF0, 0xA5, 0x2F, 0xA5, 0xA8,
+    0xC5, 0x97, 0x13, 0xE5, 0x0F, 0x93, 0xA3, 0x1D, 0xBE, 0x55, 0xF9, 0x9F, 0x9E, 0x4C, 0xA2, 0x26,
+    0xA8, 0x2B, 0xAD, 0xBF, 0x26, 0xF4, 0xF7, 0xC8, 0x3F, 0x21, 0xB6, 0x29, 0x0F, 0x8D, 0x90, 0x94,
+    0x87, 0xAE, 0x44, 0xA6, 0xF5, 0xD4, 0xC4, 0x67, 0xE2, 0xB9, 0xF1, 0x90, 0xB4, 0x7E, 0xDB, 0x65,
+    0x27, 0x7B, 0xC2, 0x68, 0x6C, 0x4F, 0x0D, 0x7F, 0xB7, 0x23, 0x2F, 0x0B, 0xD6, 0xE4, 0x98, 0x5A,
+    0x91, 0x7D, 0x60, 0x37, 0xC2, 0xE3, 0x1E, 0x66, 0xF0, 0xD4, 0x49, 0x47, 0xD2, 0xDC, 0x0E, 0xE4,
+    0x6F, 0xC1, 0xF2, 0x92, 0x44, 0x24, 0xCA, 0x77, 0xAC, 0xDF, 0xC2, 0x2D, 0x5F, 0xFF, 0xC2, 0xB2,
+    0xCA, 0x0D, 0x1E, 0x8C, 0xA2, 0xBC, 0x49, 0xB5, 0xA3, 0x2E, 0x6D, 0x07, 0x7C, 0xB4, 0x0C, 0x09,
+    0x52, 0xFD, 0x20, 0x6C, 0xA6, 0x28, 0xD2, 0x26, 0x95, 0xFC, 0x48, 0x35, 0x29, 0xB3, 0x05, 0x9E,
+    0x52, 0x91, 0x1A, 0x54, 0x74, 0x2A, 0x26, 0x9F, 0x2B, 0xE6, 0xD2, 0xE6, 0xF2, 0x44, 0xA6, 0x94,
+    0x04, 0x9D, 0xC1, 0x28, 0x97, 0x96, 0x83, 0xD5, 0xA4, 0x0B, 0x12, 0xCD, 0x4C, 0x58, 0xF8, 0x8C,
+    0xAC, 0x3C, 0x13, 0x4E, 0xA2, 0xAC, 0x26, 0xF9, 0x38, 0x0A, 0x8A, 0x96, 0x00, 0xC9, 0xD5, 0x81,
+    0x41, 0x78, 0xC0, 0x3D, 0xEE, 0xD8, 0x06, 0xD5, 0x19, 0x54, 0x4C, 0x2C, 0xC8, 0xA7, 0x47, 0xD4,
+    0xE9, 0xD9, 0xED, 0x05, 0x83, 0x77, 0x4D, 0xC6, 0x8E, 0x62, 0xCF, 0x91, 0xD8, 0xDB, 0x0F, 0xD4,
+    0x6C, 0xA2, 0x2F, 0xAD, 0x8B, 0xA3, 0x6B, 0x26, 0x04, 0xA8, 0x7B, 0x86, 0x8C, 0xA4, 0xF9, 0x10,
+    0x8D, 0x1D, 0xA2, 0xE3, 0x48, 0xF9, 0x9C, 0xCD, 0xB5, 0xEA, 0xB3, 0x89, 0xFF, 0x7C, 0x5A, 0x0F,
+    0xF3, 0x51, 0x3D, 0x72, 0xAD, 0x47, 0xD4, 0x7A, 0x5C, 0x7B, 0x5F, 0x8F, 0xF1, 0x6C, 0x3D, 0x2E,
+    0xCD, 0xE5, 0x60, 0xA6, 0xEA, 0x54, 0x6B, 0xE1, 0x38, 0xB8, 0xB2, 0xF6, 0x00, 0x18, 0x4C, 0x47,
+    0xE2, 0x5D, 0x38, 0x4F, 0xEF, 0x6A, 0x7C, 0x35, 0x7C, 0x41, 0xC7, 0x4F, 0xD9, 0xBF, 0xFB, 0x02,
+    0xD3, 0x16, 0x0D, 0x9D, 0xFE, 0x74, 0xEE, 0xA8, 0x73, 0x2A, 0x11, 0x6F, 0x76, 0xF8, 0xB8, 0xEA,
+    0x67, 0x61, 0x3E, 0x39, 0x67, 0xB0, 0x95, 0xDF, 0x54, 0xE4, 0xF9, 0x7C, 0x07, 0x2C, 0x93, 0xD0,
+    0xAC, 0xD7, 0x6B, 0xCE, 0xCB, 0xC8, 0x61, 0xD7, 0x6D, 0x72, 0xBE, 0xBF, 0xB0, 0x81, 0xF7, 0x8D,
+    0x89, 0xEF, 0xCF, 0x74, 0x66, 0x3B, 0xF9, 0x5D, 0x13, 0x91, 0x40, 0x1C, 0x7A, 0xF6, 0xA8, 0x6F,
+    0x5C, 0x48, 0xA4, 0x8C, 0xFC, 0x90, 0x75, 0xC9, 0xEB, 0xE8, 0x4A, 0x77, 0xAD, 0x3F, 0x4A, 0x7A,
+    0xFB, 0xDB, 0xE0, 0x82, 0x5F, 0xBD, 0xEA, 0x11, 0xF3, 0x97, 0x21, 0xEB, 0x3C, 0x73, 0x0C, 0x12,
+    0x4C, 0x4C, 0x24, 0xE4, 0x0D, 0xBD, 0x8D, 0xE8, 0xE7, 0xA8, 0x2E, 0xEF, 0x6E, 0x32, 0xBE, 0xAD,
+    0x2F, 0xBD, 0xE4, 0xE6, 0xF8, 0x96, 0x59, 0xBE, 0x50, 0x63, 0xB9, 0xEB, 0x80, 0x0E, 0x9F, 0xAC,
+    0xA4, 0x2A, 0x57, 0x82, 0x6A, 0xE0, 0xF8, 0x30, 0x55, 0xB9, 0x3D, 0x29, 0x7F, 0x39, 0xAE, 0x09,
+    0xC2, 0xD1, 0xE7, 0x8A, 0x4E, 0x45, 0xCE, 0x09, 0xD7, 0x22, 0xEF, 0x73, 0x36, 0x78, 0x25, 0x7F,
+    0x48, 0x9D, 0xC8, 0xE0, 0xA3, 0xD6, 0x7E, 0x17, 0xFF, 0xF3, 0x7A, 0x07, 0xCD, 0x55, 0xB1, 0x6E,
+    0xD4, 0x40, 0x10, 0x9D, 0xB5, 0xB9, 0x5C, 0xB1, 0xC5, 0x52, 0x24, 0x0D, 0x29, 0xDC, 0x22, 0x51,
+    0x98, 0x92, 0x02, 0xB2, 0xE6, 0x0F, 0x82, 0x94, 0xAB, 0x28, 0xF8, 0x04, 0x1A, 0x4A, 0x82, 0x0D,
+    0xFC, 0x40, 0x8A, 0x7C, 0x00, 0x2D, 0x47, 0x91, 0x86, 0x82, 0x22, 0x9C, 0xCD, 0x1F, 0x58, 0xE2,
+    0x07, 0x2C, 0x21, 0x84, 0x04, 0x45, 0x2C, 0x61, 0x84, 0x13, 0x6C, 0x0F, 0x6F, 0xE6, 0x2E, 0x17,
+    0x41, 0x0E, 0x89, 0x02, 0x85, 0xB8, 0x78, 0xDA, 0x9D, 0x9D, 0xDD, 0x9D, 0x7D, 0xF3, 0x66, 0x4C,
+    0x44, 0x7B, 0x84, 0x2F, 0x4E, 0x00, 0x61, 0x2B, 0x43, 0xD6, 0x79, 0x21, 0xF3, 0x5A, 0x86, 0xB7,
+    0xE8, 0xFC, 0x77, 0xA3, 0xA5, 0xBC, 0xB6, 0x9C, 0x45, 0x4C, 0x9B, 0x2D, 0x3D, 0xAC, 0xC8, 0x67,
+    0x34, 0x93, 0xFD, 0xF6, 0x6F, 0x87, 0x81, 0x0E, 0xE3, 0x22, 0x18, 0xC8, 0xF0, 0x5D, 0xAE, 0xC9,
+    0x32, 0xA7, 0x1D, 0xC5, 0xFC, 0x9C, 0x0B, 0xDA, 0x48, 0x46, 0xB8, 0xE4, 0x8A, 0xDC, 0x34, 0xD6,
+    0x18, 0x58, 0xC2, 0x89, 0x07, 0x99, 0x7F, 0x68, 0x80, 0x9D, 0x83, 0x21, 0xA6, 0x3B, 0x44, 0x26,
+    0x33, 0xC9, 0x45, 0x47, 0x36, 0xA2, 0x75, 0x21, 0xCB, 0x55, 0x44, 0xE9, 0x53, 0x04, 0x15, 0x36,
+    0xAE, 0x94, 0x70, 0xAF, 0xFE, 0x27, 0xA2, 0x4C, 0x76, 0x9A, 0x2C, 0x27, 0x10, 0x23, 0x18, 0xF2,
+    0xC2, 0x4A, 0x2F, 0x21, 0xD4, 0xE7, 0x82, 0x4A, 0x39, 0xCB, 0x07, 0x81, 0xDE, 0x36, 0x20, 0x38,
+    0x6C, 0xC8, 0x96, 0xB8, 0xD1, 0x15, 0xA6, 0xA3, 0x28, 0xC3, 0x2E, 0x0F, 0x1F, 0x7A, 0x82, 0x43,
+    0xE8, 0x10, 0xC7, 0x65, 0x90, 0x85, 0x7B, 0x07, 0xDA, 0xDD, 0xFB, 0x5A, 0x12, 0x80, 0xE3, 0xC3,
+    0x1F, 0xE0, 0xDF, 0x70, 0x72, 0x2A, 0x97, 0x99, 0x40, 0x27, 0xA1, 0xB4, 0xA7, 0xA1, 0x44, 0x95,
+    0x78, 0xC0, 0x2D, 0x17, 0x8F, 0x5C, 0x16, 0xAF, 0xA9, 0xD4, 0x76, 0x24, 0x44, 0x99, 0xA6, 0x02,
+    0x6B, 0xBA, 0x6B, 0x25, 0x98, 0x6D, 0x80, 0x67, 0x32, 0x3D, 0x73, 0x61, 0xF8, 0x38, 0xAF, 0x71,
+    0xA3, 0x6B, 0xB0, 0x1A, 0xB6, 0x80, 0xA0, 0x03, 0x98, 0x15, 0xA0, 0x0B, 0xEA, 0x12, 0xD6, 0x00,
+    0x57, 0x99, 0xE1, 0x5E, 0x8E, 0x03, 0x18, 0x47, 0x31, 0x37, 0x7F, 0xB8, 0x4D, 0xB4, 0xC5, 0x2F,
+    0xF0, 0x66, 0x78, 0xD0, 0xC6, 0x64, 0x1B, 0xF3, 0x75, 0x02, 0x72, 0xD8, 0x2D, 0x60, 0x10, 0x50,
+    0xDB, 0x65, 0xA2, 0xD3, 0x4C, 0x26, 0xBA, 0x8F, 0x6B, 0x0D, 0x45, 0x16, 0x46, 0x93, 0x1D, 0x5A,
+    0xFD, 0x8D, 0x0B, 0x45, 0xAD, 0xF3, 0x50, 0xAF, 0x32, 0x5C, 0xEA, 0x8D, 0x6A, 0xDA, 0x4A, 0xB5,
+    0xF6, 0x45, 0xCD, 0xE4, 0x9E, 0x29, 0x25, 0x65, 0xAA, 0x11, 0x88, 0xD6, 0xA9, 0x0D, 0xC4, 0x74,
+    0xA8, 0xDA, 0xF2, 0x24, 0xA6, 0xE8, 0xF3, 0x2B, 0x98, 0x1C, 0xA8, 0x4D, 0x68, 0x7C, 0x32, 0x3D,
+    0xA8, 0x28, 0x68, 0x48, 0xBC, 0x3A, 0x55, 0xE0, 0x5B, 0x55, 0xA4, 0x57, 0x7A, 0x23, 0x5C, 0x9D,
+    0x66, 0x29, 0x27, 0x01, 0xB3, 0xE7, 0x12, 0x99, 0x28, 0x82, 0xE9, 0xCB, 0x04, 0xEF, 0x69, 0xE5,
+    0x80, 0xE4, 0xB7, 0x48, 0x47, 0xA0, 0xD9, 0x72, 0x85, 0x9C, 0x20, 0xF7, 0x3D, 0x8E, 0xF4, 0x99,
+    0x2B, 0x71, 0xF8, 0x0C, 0xD5, 0x67, 0xAB, 0x39, 0x47, 0xE6, 0x41, 0x45, 0x9B, 0x3C, 0x60, 0xFB,
+    0x51, 0x15, 0xF6, 0xB0, 0x78, 0x2C, 0xA1, 0x61, 0xCC, 0x40, 0xB7, 0x83, 0x65, 0xCC, 0xFB, 0x31,
+    0x7F, 0xE7, 0x22, 0xEF, 0xA3, 0x1A, 0xB2, 0x3B, 0x2B, 0xCF, 0x3D, 0xBA, 0x09, 0xDC, 0xA5, 0xDB,
+    0x42, 0xEC, 0x47, 0x79, 0x21, 0x82, 0x92, 0x85, 0x68, 0xD0, 0xF5, 0x15, 0x85, 0xFC, 0x78, 0x9E,
+    0x6A, 0xA9, 0x34, 0xF2, 0x5A, 0x52, 0x91, 0x56, 0x97, 0x3D, 0xD2, 0xE2, 0xFB, 0x24, 0xA6, 0xA0,
+    0x56, 0x53, 0xAB, 0xCD, 0x73, 0x57, 0x3B, 0x97, 0x27, 0x39, 0xD1, 0x65, 0x62, 0xB2, 0x05, 0xA4,
+    0x21, 0xD9, 0x84, 0xC9, 0x0C, 0xD3, 0xBC, 0x90, 0xAC, 0x89, 0xDA, 0xD2, 0xE9, 0x74, 0xD0, 0x16,
+    0x0C, 0x2F, 0x34, 0x36, 0x15, 0x90, 0x28, 0x41, 0x12, 0x1F, 0x89, 0x8A, 0x90, 0xB1, 0x31, 0x1C,
+    0x63, 0xFE, 0xCA, 0x3D, 0x45, 0x9A, 0x63, 0xA2, 0x47, 0x74, 0x9D, 0x5C, 0x69, 0x33, 0x4A, 0xBF,
+    0xD4, 0x88, 0x1F, 0x57, 0xAF, 0x0D, 0x17, 0xC6, 0xE0, 0xE5, 0xE3, 0x23, 0xCA, 0xCE, 0xD0, 0xA9,
+    0xCC, 0xE7, 0xBF, 0x2F, 0xE2, 0x7D, 0x15, 0xF5, 0x5C, 0xED, 0xC3, 0x3F, 0xE6, 0xA5, 0x53, 0x5E,
+    0xA4, 0x78, 0xB6, 0xE4, 0xF1, 0xC5, 0xA2, 0x6E, 0xED, 0x37, 0x29, 0x11, 0x19, 0xE5, 0x4B, 0x61,
+    0xBF, 0x59, 0xF4, 0x67, 0xAD, 0x62, 0x8F, 0x2D, 0x81, 0xB0, 0x63, 0x7E, 0x51, 0xD9, 0x1A, 0x0F,
+    0x09, 0x2A, 0x63, 0xA0, 0xE8, 0xF8, 0x7E, 0x87, 0x60, 0x51, 0x78, 0x25, 0x5E, 0x83, 0xA8, 0xB7,
+    0x84, 0xBE, 0xD7, 0xCA, 0xA4, 0x30, 0x28, 0xCC, 0x51, 0x24, 0x75, 0x9A, 0x2E, 0xBB, 0xD7, 0xD2,
+    0xE4, 0xB3, 0x45, 0x23, 0x09, 0xD4, 0x55, 0xC0, 0xA2, 0xC0, 0xD6, 0x2D, 0x9F, 0x1C, 0x54, 0x56,
+    0xFA, 0x20, 0xE4, 0x8E, 0x97, 0x6E, 0x6C, 0xD3, 0x4F, 0xC5, 0x55, 0x31, 0x8F, 0xDC, 0x64, 0x10,
+    0x7D, 0x9F, 0x9D, 0x8D, 0x05, 0x2E, 0x7C, 0x05, 0x5B, 0x45, 0xD1, 0xF6, 0x48, 0xC8, 0x0D, 0x65,
+    0x88, 0x9D, 0x86, 0x96, 0x2B, 0x6E, 0xAF, 0xB9, 0x02, 0xEA, 0x48, 0x28, 0x2D, 0x0D, 0xB1, 0x53,
+    0xD3, 0xD0, 0x50, 0xD3, 0x50, 0xA0, 0xBD, 0xE2, 0x9A, 0x14, 0x11, 0x82, 0xB5, 0xF9, 0x07, 0x16,
+    0x12, 0xA2, 0xA0, 0x59, 0x89, 0xA4, 0xA2, 0x31, 0xC8, 0x91, 0xF6, 0x4E, 0xB6, 0x87, 0xF7, 0x3E,
+    0x67, 0xF7, 0xF6, 0x8E, 0x82, 0x26, 0x12, 0xAB, 0xDB, 0xD1, 0x69, 0x6E, 0xBE, 0x99, 0x37, 0xEF,
+    0xCD, 0xCC, 0x01, 0xEF, 0x00, 0xF8, 0x12, 0x08, 0xB7, 0x40, 0x56, 0xC3, 0xF5, 0x40, 0x52, 0x03,
+    0x0F, 0xB0, 0xFF, 0xCC, 0x8E, 0x11, 0xD8, 0x16, 0x85, 0xF5, 0x51, 0xB7, 0x68, 0x33, 0x24, 0xBF,
+    0x74, 0x48, 0x19, 0x73, 0x5C, 0x00, 0x01, 0x5F, 0xC5, 0x1B, 0x20, 0xE5, 0x93, 0x0A, 0x70, 0x03,
+    0x13, 0x29, 0x03, 0xDD, 0x8B, 0x71, 0xF9, 0x62, 0x61, 0xD6, 0xC4, 0x36, 0xC0, 0x2D, 0x77, 0xC9,
+    0x32, 0x7E, 0x43, 0xCB, 0xF9, 0x4B, 0x95, 0x23, 0xEC, 0x98, 0x22, 0x2D, 0x9F, 0x02, 0xCF, 0xF1,
+    0xE1, 0x75, 0x41, 0xDC, 0xB5, 0x31, 0x77, 0x66, 0x23, 0x16, 0x97, 0x67, 0xBD, 0x1B, 0x11, 0xB6,
+    0x49, 0x43, 0x54, 0x23, 0xF0, 0x30, 0x6A, 0x19, 0xAC, 0x6A, 0x18, 0x95, 0xA9, 0xA3, 0x59, 0x34,
+    0x34, 0x4C, 0xE4, 0xB1, 0x23, 0xDA, 0xBB, 0xB2, 0x92, 0xC6, 0xF8, 0x0D, 0x7C, 0xA8, 0x4C, 0xCC,
+    0xCA, 0xEF, 0xC5, 0x76, 0x75, 0xB1, 0x89, 0xCD, 0x8C, 0x6D, 0x19, 0xB1, 0xCF, 0x8F, 0xF9, 0x17,
+    0x22, 0x5A, 0x30, 0xAB, 0xD5, 0x8C, 0xA9, 0xF1, 0x34, 0x2D, 0x43, 0x76, 0x9A, 0xE2, 0x23, 0x7C,
+    0x86, 0xA3, 0xB7, 0xCA, 0xC2, 0xBB, 0xB9, 0x50, 0xD1, 0x84, 0x8C, 0x42, 0xD2, 0xED, 0x5C, 0x37,
+    0x3E, 0xAE, 0xB2, 0xAF, 0x59, 0xCA, 0xCA, 0x68, 0x3C, 0x35, 0x14, 0x25, 0x7A, 0x76, 0x4A, 0x44,
+    0x25, 0x92, 0x67, 0x4C, 0xFC, 0x41, 0xDC, 0xEE, 0xFA, 0x1B, 0xF6, 0x2D, 0xD7, 0x3B, 0x16, 0xF6,
+    0xAE, 0x64, 0x03, 0xAF, 0x29, 0x41, 0x79, 0x2A, 0x68, 0x02, 0x6B, 0x30, 0x0B, 0x6C, 0x3C, 0xDF,
+    0xB2, 0x77, 0x36, 0x5A, 0xB1, 0x25, 0xCC, 0x4E, 0x88, 0x86, 0xB1, 0x59, 0xE3, 0x91, 0x05, 0xAC,
+    0xE0, 0x0E, 0x20, 0x11, 0x75, 0x4A, 0x24, 0x0C, 0x2F, 0x1E, 0x59, 0xD8, 0x62, 0x48, 0xF3, 0xA0,
+    0xED, 0x31, 0x93, 0x14, 0x29, 0x73, 0xAE, 0xE1, 0x9F, 0x08, 0x93, 0x78, 0x57, 0x41, 0x96, 0x72,
+    0xF6, 0xEA, 0xEC, 0x99, 0xB1, 0xEB, 0x8A, 0x25, 0x45, 0xF1, 0x1D, 0x38, 0xE0, 0x47, 0x42, 0x74,
+    0x3D, 0x5F, 0x06, 0x83, 0x78, 0xB3, 0x56, 0x46, 0xA0, 0x3B, 0xFC, 0x9F, 0xFA, 0xBB, 0xDC, 0x95,
+    0x49, 0x9E, 0xE6, 0xD9, 0xA3, 0x2D, 0x32, 0x8A, 0x5A, 0x30, 0x53, 0xD1, 0xF8, 0xD6, 0xDE, 0xF2,
+    0x16, 0x1C, 0x91, 0x07, 0x92, 0x2D, 0xA8, 0x51, 0x2B, 0xCD, 0xE2, 0xBF, 0x7A, 0x0F, 0x4C, 0x2D,
+    0xC5, 0xFA, 0x15, 0x51, 0x7D, 0x5D, 0xF5, 0xC8, 0xCF, 0x82, 0xBD, 0x84, 0xF0, 0x0E, 0x98, 0xD9,
+    0xEC, 0x62, 0x14, 0xDB, 0xF1, 0x28, 0xBE, 0x39, 0x42, 0x2C, 0xC9, 0x52, 0x2C, 0x1A, 0x77, 0x12,
+    0x21, 0xD9, 0x48, 0x86, 0xAC, 0x9E, 0x90, 0x54, 0x52, 0x66, 0xD2, 0x46, 0xEE, 0xF4, 0xDA, 0x1D,
+    0x6E, 0x7D, 0x74, 0x23, 0x77, 0xE5, 0x93, 0x6C, 0xE5, 0xCE, 0x6A, 0xBA, 0x23, 0xA6, 0x7F, 0x7D,
+    0x6A, 0x35, 0x15, 0x37, 0xF6, 0x68, 0x76, 0x79, 0x20, 0xCD, 0x5C, 0x93, 0x91, 0xF6, 0xB1, 0x04,
+    0x6E, 0xB5, 0xCC, 0x4F, 0x6A, 0x81, 0x2E, 0x34, 0x3F, 0xAE, 0x4F, 0x04, 0xBF, 0xFD, 0xC2, 0x8F,
+    0x23, 0x6F, 0xC9, 0x49, 0x41, 0xC9, 0x2B, 0xEB, 0x35, 0x40, 0x94, 0xDA, 0x8D, 0x79, 0x51, 0xB3,
+    0xA8, 0xC4, 0x5A, 0x4B, 0x2D, 0x0E, 0x13, 0xF5, 0x24, 0x0B, 0xFC, 0xA9, 0xA4, 0x21, 0xAB, 0xD3,
+    0x1D, 0x7B, 0x77, 0xEA, 0xDD, 0x85, 0x97, 0x76, 0xF4, 0xD1, 0x03, 0x12, 0xFE, 0x65, 0xFC, 0xD8,
+    0x2F, 0xA9, 0x15, 0x03, 0x22, 0xEB, 0x2A, 0xA6, 0x3D, 0x81, 0x36, 0x58, 0xC4, 0xE2, 0x1E, 0xA7,
+    0x26, 0x57, 0x35, 0x22, 0x9F, 0xC8, 0x62, 0xE2, 0x80, 0xE3, 0x58, 0xF9, 0xF1, 0xA6, 0x65, 0x0A,
+    0xCF, 0xD6, 0xC4, 0x82, 0xB7, 0xFD, 0x44, 0xD4, 0xDC, 0x96, 0x79, 0xD0, 0x67, 0x14, 0x2B, 0xE8,
+    0xDF, 0xB7, 0x55, 0x19, 0xBC, 0xF1, 0x1F, 0x44, 0xFA, 0x57, 0xB1, 0xCF, 0xC0, 0xE5, 0xF2, 0x84,
+    0xD1, 0x3A, 0x0E, 0x59, 0xB5, 0x7C, 0xD2, 0x83, 0x42, 0x73, 0xD8, 0x6F, 0x33, 0xE6, 0xE5, 0x15,
+    0x25, 0x32, 0x7A, 0x34, 0x4D, 0xEB, 0x63, 0xFB, 0x1E, 0xD3, 0xFE, 0xED, 0x7D, 0x77, 0x7F, 0xA8,
+    0xE4, 0x32, 0x5E, 0x48, 0x9A, 0x44, 0xD5, 0x3C, 0x05, 0x59, 0x2E, 0xA3, 0x10, 0x4F, 0x47, 0x75,
+    0xD3, 0x78, 0x1F, 0x6F, 0x44, 0x21, 0x34, 0xC6, 0x9D, 0xB9, 0x67, 0x13, 0x3F, 0xCE, 0x86, 0xB4,
+    0xC7, 0x3C, 0x9F, 0x11, 0xC4, 0xF2, 0x78, 0x9A, 0xF6, 0xC4, 0xB8, 0x02, 0xF3, 0xE5, 0xC9, 0xAD,
+    0x83, 0x23, 0xE4, 0x5B, 0x56, 0xB6, 0xCD, 0xA7, 0x57, 0xAB, 0x4A, 0x73, 0x92, 0x29, 0xF9, 0x0B,
+    0x09, 0xE2, 0x87, 0xC4, 0xCF, 0xB6, 0x07, 0x1A, 0x4C, 0xF3, 0x4A, 0x55, 0x53, 0x25, 0xAC, 0x56,
+    0xAB, 0x7C, 0x72, 0x1D, 0x46, 0xDD, 0x91, 0xEB, 0xB9, 0x46, 0x74, 0x23, 0x1D, 0xF3, 0xEA, 0x74,
+    0x35, 0xF0, 0x9E, 0xD9, 0xDF, 0xA6, 0xB3, 0xE3, 0xF8, 0x46, 0x40, 0x32, 0xEB, 0x6F, 0xA0, 0x98,
+    0x0B, 0x48, 0xC3, 0xE6, 0x9B, 0xAC, 0xCC, 0x7E, 0xE6, 0x2A, 0x7E, 0x52, 0x63, 0x9D, 0xC1, 0x5D,
+    0x0E, 0xCB, 0xB3, 0x3F, 0xF9, 0xF0, 0x82, 0x3B, 0xB0, 0x9E, 0xD6, 0x4D, 0x77, 0x20, 0x69, 0xA6,
+    0x9B, 0x55, 0x5C, 0x9E, 0x36, 0x62, 0xAD, 0x90, 0xE8, 0x6F, 0x3A, 0x73, 0xDC, 0x4C, 0x9E, 0x8C,
+    0xA8, 0x44, 0xF6, 0xEA, 0x27, 0x86, 0x69, 0xD1, 0x53, 0x5D, 0x46, 0x77, 0x78, 0x66, 0x85, 0xE6,
+    0x2B, 0x7E, 0xC7, 0x99, 0xAD, 0xCE, 0xB5, 0x29, 0xA1, 0x16, 0x25, 0x2E, 0x89, 0xF9, 0xFE, 0x41,
+    0xB3, 0xD7, 0x9D, 0x11, 0x7C, 0xA0, 0xC3, 0x14, 0x5F, 0xAD, 0xBE, 0xBB, 0x4D, 0x09, 0xA3, 0x72,
+    0xBA, 0xE2, 0x9C, 0xAE, 0x87, 0x22, 0xAE, 0x8B, 0x5F, 0x3F, 0xBE, 0xF8, 0x4D, 0x35, 0x34, 0x90,
+    0xBE, 0xD5, 0x04, 0x21, 0x99, 0x7D, 0x00, 0x3B, 0x6F, 0x41, 0xC4, 0xFE, 0xC8, 0xEC, 0xC0, 0xF0,
+    0x0C, 0x71, 0xC5, 0x33, 0x1B, 0xC2, 0x6D, 0xD8, 0x2F, 0xCA, 0xB0, 0xE3, 0x26, 0xFC, 0xC1, 0xF5,
+    0xF8, 0xF6, 0xD7, 0xE5, 0x9A, 0x85, 0xAF, 0x98, 0xE3, 0xF7, 0xCD, 0x74, 0x72, 0x8B, 0xE9, 0xF2,
+    0xEB, 0x5F, 0x48, 0x64, 0xDF, 0x7C, 0x4E, 0x35, 0xDA, 0x48, 0xC2, 0x2E, 0xFF, 0xF5, 0x9F, 0xE4,
+    0xBF, 0x3E, 0xFF, 0x00, 0xCD, 0x54, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x9D, 0x5D, 0xC6, 0xDA, 0x04,
+    0x2C, 0xD6, 0x45, 0x0C, 0x18, 0x09, 0x02, 0x36, 0x29, 0x52, 0x18, 0xE0, 0x1F, 0x68, 0x17, 0xCE,
+    0x0F, 0x5C, 0xA1, 0x53, 0x11, 0xFF, 0x81, 0x01, 0x43, 0x5F, 0x20, 0x1D, 0x8D, 0x94, 0x2E, 0xEC,
+    0xC6, 0x75, 0x1A, 0x17, 0xF1, 0xB9, 0x50, 0x93, 0x36, 0x3A, 0xC2, 0x29, 0xD3, 0x10, 0x30, 0x0C,
+    0x17, 0x69, 0x88, 0x04, 0x46, 0x00, 0xBB, 0x61, 0x41, 0x05, 0xB4, 0xC0, 0xE3, 0xF8, 0xBD, 0x3D,
+    0xF9, 0x24, 0x2B, 0xBD, 0x61, 0x02, 0xDC, 0x23, 0xE6, 0x76, 0x66, 0xDE, 0xBC, 0x79, 0x33, 0x22,
+    0xBF, 0x8A, 0x48, 0x3E, 0xE0, 0x08, 0x2D, 0x8E, 0x55, 0xC4, 0xF1, 0x44, 0xAE, 0x3C, 0x0B, 0x55,
+    0xFD, 0x1B, 0xAF, 0xDE, 0x5F, 0xBC, 0x59, 0xAA, 0xAC, 0x44, 0x46, 0x3B, 0x8A, 0x6D, 0xF3, 0x4E,
+    0x5C, 0x2C, 0x6B, 0xFA, 0xE1, 0x85, 0x09, 0xA1, 0x3A, 0x1C, 0xA5, 0x6A, 0x27, 0x2B, 0xD5, 0xCA,
+    0x4E, 0xCB, 0xA7, 0xE7, 0xA6, 0xCB, 0xB7, 0xAE, 0xC3, 0x64, 0x1B, 0x98, 0x7C, 0x05, 0xD3, 0xA1,
+    0x5D, 0xFF, 0xF4, 0xEC, 0x94, 0xE1, 0xFF, 0xE4, 0x21, 0xE2, 0x80, 0x24, 0xE0, 0xBE, 0x46, 0xC9,
+    0x70, 0xDB, 0xC4, 0x0B, 0x24, 0x7B, 0x04, 0x13, 0xBD, 0x6A, 0x9C, 0x44, 0x71, 0x6F, 0x1D, 0xC4,
+    0x0E, 0xA3, 0xB8, 0x7F, 0x4F, 0xE7, 0x07, 0xC7, 0xAA, 0x13, 0x92, 0xFE, 0x87, 0x62, 0x72, 0x44,
+    0x28, 0x10, 0x21, 0xC4, 0x14, 0xC5, 0xE8, 0xEB, 0x3B, 0xB7, 0x55, 0x47, 0xA3, 0xDA, 0xC8, 0x8D,
+    0xD9, 0xA7, 0xAE, 0x47, 0x4A, 0xC0, 0xC8, 0xE8, 0x55, 0xB0, 0x94, 0x13, 0x7A, 0x4D, 0x33, 0x98,
+    0x80, 0x46, 0xEC, 0x1A, 0x15, 0xCE, 0x00, 0x71, 0x2D, 0x41, 0xD7, 0xD9, 0x90, 0x8D, 0x45, 0x95,
+    0xF5, 0xA3, 0xE4, 0xFF, 0x74, 0x52, 0xFC, 0xF2, 0x72, 0x7E, 0x82, 0xBC, 0x67, 0x08, 0xF3, 0x17,
+    0x4A, 0x2A, 0x2B, 0x94, 0x0F, 0x6F, 0xB8, 0x64, 0x78, 0x9D, 0x3E, 0xBE, 0x97, 0x03, 0x9A, 0x03,
+    0x1D, 0x72, 0x07, 0xF1, 0x4B, 0xFC, 0x37, 0x6C, 0xF8, 0x2B, 0x5E, 0xA3, 0x7A, 0xDC, 0x29, 0x5A,
+    0x89, 0xF2, 0xB5, 0xB8, 0x1A, 0xF9, 0x7D, 0x03, 0x3E, 0x8A, 0x17, 0x3D, 0xAC, 0x70, 0x90, 0x02,
+    0x1F, 0x40, 0x7C, 0x41, 0xAE, 0x21, 0xDC, 0x07, 0x78, 0xA7, 0x6B, 0xBA, 0x7C, 0x46, 0x4A, 0xB2,
+    0x0E, 0x95, 0xE5, 0x15, 0x2A, 0xFB, 0xEE, 0x2A, 0x25, 0xA9, 0x7E, 0xD5, 0xDA, 0xE2, 0xBA, 0xE4,
+    0x67, 0xCB, 0x27, 0xF2, 0x7F, 0xE2, 0xC8, 0x65, 0x1E, 0x61, 0xDA, 0x85, 0xC9, 0xF4, 0xF9, 0xE9,
+    0xDD, 0xE3, 0x57, 0xCC, 0x01, 0x3E, 0xD1, 0x8C, 0x68, 0x2A, 0x1F, 0x4B, 0x09, 0xB6, 0x97, 0x50,
+    0x54, 0xB2, 0x80, 0xD7, 0xAA, 0xDE, 0xD0, 0x73, 0xFE, 0x5C, 0x8B, 0xA8, 0xB1, 0x17, 0xD5, 0xDE,
+    0xB7, 0xBE, 0x3B, 0x12, 0xFF, 0xA2, 0x93, 0xF2, 0x61, 0x2D, 0x47, 0x8B, 0xF9, 0x3E, 0x39, 0x79,
+    0x8B, 0xF7, 0xA0, 0x4A, 0x2E, 0x06, 0xDE, 0x19, 0x0A, 0xF2, 0xAC, 0x6E, 0x9A, 0xFF, 0x86, 0x14,
+    0x75, 0x01, 0x4E, 0xCD, 0xFC, 0x42, 0xC5, 0x3C, 0x3C, 0xB1, 0x65, 0xCA, 0x12, 0xD6, 0x65, 0x52,
+    0xC8, 0x11, 0x00, 0x37, 0xA6, 0xD9, 0x5E, 0xBB, 0x4E, 0xF0, 0xE8, 0x35, 0x8F, 0x09, 0x57, 0x1F,
+    0x1F, 0xB4, 0x06, 0x74, 0x1D, 0x49, 0xA8, 0x24, 0xA3, 0x44, 0x64, 0x97, 0x0D, 0xB0, 0x75, 0xAA,
+    0x37, 0xE3, 0xE8, 0x24, 0x9D, 0x89, 0xEB, 0xB7, 0x59, 0x1C, 0x58, 0xD3, 0xF5, 0x22, 0x82, 0xA1,
+    0x57, 0xBD, 0x98, 0xE3, 0x01, 0xBE, 0x12, 0x7E, 0x4C, 0x18, 0x4B, 0xAA, 0x3B, 0x52, 0xDB, 0x7D,
+    0x3E, 0xF1, 0xB3, 0x44, 0x8A, 0x9E, 0x5C, 0x6A, 0x62, 0x14, 0x37, 0x6F, 0xEC, 0x7D, 0x00, 0xE2,
+    0x08, 0x34, 0xE0, 0xB0, 0x84, 0x5C, 0x3C, 0x00, 0xCC, 0xD1, 0x83, 0xD4, 0xDA, 0x47, 0xB9, 0x89,
+    0xBE, 0x9E, 0xF3, 0x34, 0x33, 0x11, 0x7D, 0xD0, 0x2A, 0x00, 0x72, 0x36, 0xD8, 0xF1, 0x7B, 0x5F,
+    0xDB, 0x01, 0x90, 0x5D, 0x87, 0x1F, 0x5F, 0x63, 0x1C, 0x16, 0x98, 0x07, 0x7C, 0x07, 0xAA, 0x34,
+    0x90, 0x17, 0x26, 0x4A, 0xCD, 0x3F, 0x64, 0xC7, 0x58, 0x45, 0x4E, 0x71, 0x7B, 0xC2, 0x28, 0x19,
+    0xA6, 0x97, 0x9D, 0x11, 0xC2, 0xCD, 0x3A, 0xA0, 0xF6, 0x7F, 0x20, 0xFB, 0xEF, 0x1E, 0x8A, 0x6C,
+    0x0B, 0x3D, 0x9E, 0xA0, 0x1F, 0x78, 0xEF, 0x2C, 0x1F, 0x6D, 0x49, 0xFB, 0x41, 0xBE, 0x04, 0xD8,
+    0xC6, 0x02, 0x5F, 0x78, 0x39, 0x12, 0x2E, 0x15, 0xE6, 0x58, 0xCC, 0x47, 0xF3, 0xFB, 0xD9, 0x90,
+    0xCB, 0xA2, 0x6B, 0x69, 0x40, 0x0E, 0x98, 0x2C, 0xCF, 0xE0, 0x1C, 0x14, 0x29, 0xBF, 0xED, 0x2F,
+    0xEF, 0x3D, 0xB3, 0x27, 0x33, 0x7A, 0xB5, 0x64, 0xA5, 0x9A, 0x64, 0xF5, 0x15, 0xA6, 0xE8, 0x44,
+    0x8A, 0x0A, 0x6A, 0x3B, 0x01, 0x33, 0xA0, 0xAD, 0xA8, 0x1D, 0x4D, 0xBE, 0x07, 0x76, 0xAE, 0x25,
+    0xEC, 0x96, 0x16, 0x95, 0x7C, 0x34, 0xEB, 0xBA, 0x5C, 0xC6, 0x0C, 0x11, 0xEA, 0x9C, 0x61, 0xC0,
+    0xFD, 0x2A, 0x67, 0x1F, 0x83, 0x6C, 0xC8, 0x2D, 0x01, 0xDD, 0x0D, 0x0E, 0x6A, 0xAE, 0x30, 0xC9,
+    0xAD, 0x98, 0x65, 0x5A, 0xC0, 0x36, 0xB1, 0xAB, 0x49, 0xB4, 0xFD, 0xF6, 0x73, 0xE7, 0xD1, 0x95,
+    0xDD, 0x6C, 0x24, 0x0D, 0xE2, 0x90, 0xCA, 0x6B, 0x25, 0xBC, 0xDB, 0x9F, 0x38, 0xD9, 0xAE, 0x25,
+    0x79, 0xBB, 0x9C, 0xC7, 0xAC, 0xF5, 0x48, 0x77, 0x2B, 0x4D, 0x25, 0x79, 0xDE, 0x0C, 0x0A, 0xC8,
+    0x8C, 0x1F, 0x04, 0x46, 0x5E, 0x13, 0x99, 0x1B, 0x5E, 0xBF, 0xD1, 0x9F, 0x07, 0x5E, 0xE2, 0x0E,
+    0x0E, 0xB7, 0x27, 0x7E, 0x12, 0x41, 0x88, 0x2B, 0x94, 0xD6, 0x5B, 0x7D, 0xB7, 0xAF, 0x91, 0xA5,
+    0xB0, 0x0F, 0x4C, 0x6C, 0xE6, 0x71, 0xB3, 0x78, 0x36, 0x40, 0x43, 0x73, 0xBE, 0x07, 0x40, 0xDE,
+    0xE5, 0x67, 0x0E, 0xBD, 0x42, 0x59, 0x03, 0xA9, 0x68, 0x43, 0x55, 0x3E, 0x8F, 0x23, 0x36, 0x9A,
+    0xA3, 0x36, 0xB1, 0xD8, 0xC8, 0xA8, 0xEB, 0x0C, 0x4D, 0xD9, 0x9A, 0xAB, 0x87, 0xBB, 0xBA, 0x60,
+    0x78, 0x06, 0x76, 0x8C, 0xC9, 0xF5, 0x27, 0xAB, 0x37, 0x90, 0x1D, 0x93, 0xDB, 0x14, 0x26, 0xCA,
+    0xC1, 0x73, 0x62, 0xC3, 0x50, 0x24, 0x46, 0xF3, 0x46, 0xC5, 0x4C, 0x06, 0x2B, 0x13, 0xC2, 0xA2,
+    0xF7, 0xDD, 0xA7, 0x9F, 0x97, 0xF0, 0xBE, 0x90, 0x6D, 0x03, 0xC8, 0x6F, 0x5A, 0x5C, 0x10, 0x4B,
+    0x6A, 0x4B, 0xEA, 0xC5, 0x61, 0x6A, 0xB3, 0x7C, 0x9A, 0xE7, 0x3D, 0xB5, 0x55, 0xBD, 0x6E, 0xD4,
+    0x40, 0x10, 0xFE, 0x7C, 0x26, 0x58, 0xC8, 0x85, 0x69, 0x22, 0x02, 0x01, 0xB9, 0x45, 0x34, 0x7E,
+    0x82, 0x64, 0x2D, 0x5E, 0x00, 0x8A, 0x44, 0x94, 0x3C, 0xC2, 0x3D, 0x82, 0xCD, 0x1B, 0xA4, 0xA2,
+    0xA6, 0x48, 0x83, 0x6B, 0x4A, 0xD0, 0x1A, 0x52, 0xA6, 0x59, 0x84, 0xA8, 0xB1, 0x84, 0x68, 0xD2,
+    0x60, 0xA1, 0x93, 0xB0, 0x82, 0x7D, 0xC3, 0x37, 0xEB, 0xE3, 0xC2, 0x49, 0xFC, 0x24, 0x47, 0x58,
+    0xED, 0xCD, 0xCD, 0xFE, 0xCD, 0x7E, 0xF3, 0xCD, 0x78, 0x16, 0xD8, 0x02, 0x30, 0x69, 0x29, 0xD2,
+    0x9C, 0xA2, 0xE7, 0x2F, 0xF4, 0xA3, 0x9A, 0xA2, 0xD0, 0x29, 0xE1, 0x2F, 0xE8, 0xB0, 0x68, 0x9B,
+    0xF9, 0x06, 0x62, 0x91, 0x39, 0x44, 0xA4, 0x4B, 0x9A, 0xB8, 0x3D, 0x30, 0x88, 0x1B, 0xAE, 0xA7,
+    0x75, 0xDC, 0xC0, 0x20, 0x2B, 0x83, 0x1E, 0x05, 0xA7, 0x20, 0xB9, 0xE5, 0x61, 0x99, 0x21, 0xE2,
+    0x6E, 0xEC, 0xAA, 0x95, 0x19, 0x05, 0x57, 0x80, 0xEC, 0xB4, 0x3A, 0x84, 0x11, 0xE9, 0x61, 0xD5,
+    0x8C, 0xC3, 0x76, 0xFB, 0x0A, 0x48, 0x8E, 0x78, 0xB3, 0x49, 0x6A, 0x4C, 0x66, 0xA6, 0x46, 0x51,
+    0x16, 0x73, 0xDB, 0xA1, 0xD0, 0xD3, 0xB7, 0xAA, 0x1C, 0xCB, 0x96, 0x95, 0x2A, 0x23, 0xC5, 0x85,
+    0x40, 0x14, 0x31, 0x0A, 0x6F, 0x35, 0xA9, 0x33, 0x6E, 0x0B, 0x1A, 0x3C, 0xC3, 0x4A, 0x53, 0x00,
+    0x89, 0xF4, 0x56, 0x5C, 0x20, 0xF2, 0xA4, 0x70, 0x08, 0x6C, 0x3E, 0xE1, 0xB9, 0xA8, 0x45, 0x46,
+    0x37, 0x0B, 0xFC, 0x7D, 0x40, 0x6F, 0x05, 0x13, 0x95, 0x1C, 0x9C, 0x54, 0x95, 0xC5, 0x05, 0x0D,
+    0x38, 0xC0, 0xE6, 0x05, 0x4F, 0x5B, 0x39, 0xA6, 0xA9, 0x94, 0xB8, 0x37, 0x15, 0x5B, 0x38, 0xA8,
+    0x4C, 0xBD, 0x1C, 0xD4, 0x97, 0xE4, 0xB5, 0xCA, 0x3E, 0x20, 0x15, 0x41, 0x1E, 0x9C, 0x39, 0xE1,
+    0x77, 0x67, 0xBD, 0xF7, 0x59, 0x03, 0x84, 0x69, 0xED, 0x3D, 0xF7, 0x2C, 0x78, 0x12, 0x22, 0x3F,
+    0x9D, 0x2E, 0xA6, 0xF7, 0x75, 0x3A, 0x93, 0x1C, 0xD1, 0x57, 0xDE, 0xC7, 0x0B, 0x1F, 0x91, 0xC7,
+    0xC2, 0x85, 0xBD, 0xEE, 0xE6, 0x56, 0x76, 0xF2, 0xCE, 0xDD, 0x26, 0x57, 0x23, 0x83, 0x4E, 0x87,
+    0xB3, 0x73, 0x4C, 0x47, 0xD2, 0xC6, 0xD2, 0x1A, 0xA9, 0xD9, 0x53, 0xE9, 0x18, 0xC6, 0x76, 0x64,
+    0xB6, 0x7C, 0xCC, 0xF8, 0x4E, 0xDD, 0xC2, 0x71, 0x58, 0x8F, 0x4B, 0x7C, 0xFB, 0x38, 0xFE, 0x95,
+    0x2B, 0x4B, 0x0B, 0x6A, 0x62, 0x5D, 0xA9, 0x17, 0x14, 0xC3, 0x56, 0x55, 0x75, 0xB6, 0xD4, 0x7A,
+    0x7F, 0x7E, 0x79, 0x6A, 0x75, 0x29, 0xC7, 0x64, 0xC0, 0x48, 0xEF, 0x1B, 0x5A, 0x8B, 0xD4, 0xD4,
+    0x9E, 0x66, 0xB6, 0xF8, 0x3C, 0xEE, 0x97, 0xCC, 0x78, 0xAA, 0x26, 0xF6, 0x84, 0x39, 0x64, 0x7C,
+    0xEE, 0x9C, 0xCD, 0x52, 0x9D, 0x1E, 0x50, 0xB5, 0x52, 0x92, 0x2E, 0xA1, 0xEB, 0xE2, 0xB2, 0x16,
+    0x69, 0xC3, 0x9B, 0x95, 0x85, 0x76, 0xF4, 0x7F, 0x24, 0xE4, 0x7C, 0x6A, 0x2A, 0x75, 0x26, 0x47,
+    0xD2, 0x87, 0xD2, 0xC7, 0xCD, 0xDD, 0xAC, 0xDF, 0x31, 0x32, 0xEC, 0xA4, 0xFD, 0xED, 0x68, 0xB6,
+    0x8C, 0x2B, 0x33, 0x21, 0x93, 0x6E, 0x83, 0x81, 0xB2, 0xB8, 0x78, 0xCF, 0xFD, 0xF1, 0x9E, 0x79,
+    0x22, 0xF7, 0x8F, 0xE5, 0x81, 0x2D, 0x86, 0x17, 0xA6, 0xCD, 0x6F, 0x2E, 0xAD, 0x4F, 0x67, 0xA1,
+    0xB8, 0xAB, 0x34, 0x3E, 0x28, 0x26, 0x86, 0xD0, 0xFC, 0x46, 0x4D, 0xA5, 0x25, 0x6F, 0x1B, 0xFB,
+    0x7B, 0x44, 0x48, 0x62, 0x36, 0xF7, 0xF7, 0x2E, 0x17, 0xE1, 0xBD, 0xEA, 0xA9, 0xC8, 0x67, 0x91,
+    0x9F, 0xBE, 0x63, 0xC2, 0x32, 0x03, 0x11, 0xFE, 0x09, 0x96, 0x57, 0x99, 0x5B, 0x89, 0x8F, 0xD5,
+    0x16, 0xAE, 0xED, 0xE2, 0x8E, 0x79, 0xFF, 0x92, 0x79, 0x37, 0x11, 0x87, 0x2B, 0x97, 0x89, 0x90,
+    0x69, 0xE1, 0xF0, 0xC1, 0xC5, 0xD3, 0xD3, 0xDE, 0x88, 0xDB, 0xEE, 0xD6, 0xE5, 0xB0, 0x90, 0x2F,
+    0x63, 0x95, 0xF1, 0x35, 0x22, 0xF6, 0x85, 0xE0, 0x3C, 0xEA, 0x40, 0x37, 0xB5, 0x34, 0xEC, 0x22,
+    0xA2, 0x31, 0x2D, 0xC5, 0xE1, 0xFC, 0x61, 0x2C, 0xF5, 0x55, 0x22, 0xB9, 0x0E, 0x66, 0x8C, 0x61,
+    0x4D, 0x2D, 0xC7, 0x4C, 0x5D, 0x13, 0xDA, 0xA4, 0x43, 0x06, 0x74, 0x88, 0x1A, 0xA4, 0x9F, 0x40,
+    0xF2, 0x99, 0xDB, 0x87, 0x48, 0x68, 0xDA, 0xB1, 0x5C, 0x53, 0xFD, 0xD1, 0xFE, 0xD5, 0x87, 0x75,
+    0x58, 0xA3, 0xFC, 0x26, 0xF3, 0x44, 0xE6, 0x37, 0x06, 0xB0, 0xD3, 0xA0, 0x29, 0x69, 0x3B, 0xEC,
+    0xFE, 0x87, 0xCA, 0xEB, 0x3B, 0x2D, 0x12, 0xA6, 0xB4, 0xD2, 0x86, 0xFE, 0x6B, 0x34, 0x2A, 0x62,
+    0x5F, 0x43, 0x7D, 0x35, 0x36, 0x5A, 0x18, 0x32, 0xFF, 0x16, 0x7A, 0xCE, 0x9F, 0x43, 0xE3, 0x10,
+    0x20, 0x75, 0xC1, 0x10, 0xCE, 0x19, 0x0D, 0xD3, 0x84, 0x73, 0x86, 0x63, 0x2C, 0xB8, 0x2B, 0x2D,
+    0xB0, 0x2E, 0x1E, 0xCC, 0x10, 0xCA, 0x5B, 0xEB, 0xB6, 0x07, 0x9A, 0x4B, 0x1C, 0x5D, 0xBD, 0x98,
+    0x42, 0x5A, 0x92, 0x77, 0x44, 0x38, 0xF8, 0x87, 0x6D, 0xF1, 0x34, 0xEB, 0x5D, 0x61, 0xB7, 0x78,
+    0x94, 0x2D, 0x07, 0x46, 0x9F, 0x89, 0x43, 0xAC, 0xDD, 0xBE, 0x03, 0xDD, 0x54, 0x31, 0x6E, 0xD5,
+    0x40, 0x10, 0x9D, 0xB5, 0x93, 0x58, 0xC2, 0x85, 0x53, 0x04, 0x21, 0x11, 0x90, 0x1B, 0x7A, 0x9F,
+    0x20, 0x78, 0x11, 0x17, 0xA0, 0xF8, 0xA2, 0xA0, 0xA1, 0xA7, 0x49, 0x43, 0x8D, 0xCD, 0x0D, 0x72,
+    0x08, 0xAA, 0x50, 0x70, 0x01, 0x12, 0xAF, 0x42, 0x41, 0x91, 0xC6, 0x42, 0xA2, 0xA2, 0xF1, 0x11,
+    0x9C, 0xC4, 0x91, 0x2C, 0x65, 0xED, 0xE1, 0x3D, 0xFB, 0xFF, 0x28, 0x20, 0x11, 0x25, 0x81, 0x8A,
+    0x95, 0x3C, 0x5E, 0x8F, 0x67, 0x67, 0xDE, 0x9B, 0x99, 0x1D, 0x11, 0xAC, 0x42, 0x24, 0xF1, 0x12,
+    0x5E, 0xB4, 0x32, 0xA4, 0x2E, 0xB7, 0xEF, 0x82, 0xDA, 0xD4, 0x32, 0xAF, 0x4C, 0x7D, 0xA8, 0x5A,
+    0xAE, 0xAB, 0x95, 0xB8, 0x15, 0xA9, 0xE4, 0xAF, 0x5E, 0x23, 0x02, 0xD5, 0x62, 0xBC, 0x48, 0x5E,
+    0x4A, 0xD2, 0x4A, 0x3C, 0x48, 0x08, 0xCF, 0x0F, 0x2D, 0x22, 0x19, 0xA1, 0x26, 0x1A, 0xA1, 0xA9,
+    0x83, 0xCE, 0x9B, 0x3E, 0x2D, 0x7B, 0xD3, 0x6E, 0xC9, 0xE6, 0x12, 0xC9, 0x76, 0x2F, 0xD9, 0x28,
+    0xA6, 0x2A, 0x25, 0x6E, 0x24, 0xE8, 0x45, 0x0E, 0x81, 0xEE, 0x66, 0x1F, 0x0C, 0x56, 0x13, 0x40,
+    0xDC, 0x49, 0x0A, 0x37, 0x9D, 0x04, 0x7B, 0x60, 0xAD, 0x6D, 0xAA, 0xA7, 0x20, 0x57, 0xE8, 0xFB,
+    0xA2, 0x96, 0xB4, 0x01, 0x4A, 0x33, 0x4A, 0xE0, 0x25, 0xA5, 0x71, 0x30, 0xC0, 0x8B, 0xCB, 0x1C,
+    0xC0, 0x43, 0x05, 0x35, 0xB7, 0xF1, 0x59, 0x3F, 0x25, 0xA5, 0x84, 0xAC, 0xC0, 0x46, 0x82, 0x91,
+    0x32, 0x3E, 0xA3, 0xCC, 0xBE, 0x50, 0x56, 0xE1, 0x48, 0x6B, 0xCA, 0xB8, 0xA5, 0xCC, 0x1C, 0x65,
+    0x05, 0x5E, 0x12, 0x90, 0xEF, 0x33, 0x55, 0x17, 0xEA, 0x0F, 0xC5, 0xE7, 0xE4, 0xC7, 0x7C, 0x58,
+    0x32, 0x24, 0x4E, 0x99, 0x72, 0x85, 0xE5, 0x29, 0xC2, 0x96, 0x32, 0x65, 0x7A, 0x84, 0x81, 0x25,
+    0xE0, 0x76, 0xC1, 0x58, 0xFC, 0x5F, 0x50, 0x6C, 0x50, 0x98, 0x3F, 0x8B, 0x48, 0xFD, 0x52, 0x48,
+    0x55, 0x1A, 0x0F, 0x2E, 0xC6, 0x23, 0x15, 0xC6, 0x23, 0x9A, 0xF1, 0x20, 0x69, 0x14, 0x86, 0x66,
+    0xE0, 0xCE, 0x57, 0x96, 0x3F, 0x1C, 0x44, 0x42, 0x93, 0x90, 0xC6, 0x46, 0x2D, 0xCE, 0x16, 0x4D,
+    0xAA, 0x2E, 0xED, 0x73, 0x75, 0x11, 0x59, 0x4E, 0x20, 0x2E, 0x31, 0x33, 0x35, 0x92, 0x5C, 0x8A,
+    0x09, 0xF0, 0x53, 0xFE, 0x7D, 0xB2, 0xB4, 0xDA, 0x50, 0x51, 0x7D, 0xAE, 0x0E, 0xC7, 0x77, 0x5B,
+    0x19, 0x2D, 0xE8, 0xC1, 0x4B, 0x2E, 0x03, 0x4F, 0x40, 0x84, 0x27, 0x10, 0x32, 0x52, 0xE4, 0x68,
+    0x08, 0x49, 0x8E, 0x3B, 0xB2, 0xE7, 0xD6, 0x27, 0xD8, 0xE6, 0x00, 0x01, 0xCB, 0xB4, 0x93, 0xB0,
+    0x33, 0x5A, 0x6E, 0x6B, 0x9D, 0xFA, 0x44, 0x7B, 0x51, 0x86, 0x5B, 0x87, 0x15, 0x23, 0xC6, 0x84,
+    0xA2, 0x84, 0x83, 0x5C, 0x85, 0xCC, 0x6D, 0xC6, 0x36, 0x7E, 0x21, 0x57, 0x96, 0x41, 0xF2, 0x25,
+    0x56, 0x04, 0x67, 0x4B, 0xB3, 0xD8, 0x73, 0x67, 0xCE, 0x14, 0x98, 0xFA, 0xDB, 0xA9, 0x4C, 0x0D,
+    0x55, 0x52, 0x42, 0xB5, 0x03, 0x55, 0xD0, 0xC5, 0xE7, 0x6F, 0x3E, 0x7D, 0x55, 0xAC, 0x0C, 0xCF,
+    0x54, 0xB2, 0x98, 0x55, 0xAF, 0xBA, 0x54, 0xED, 0xA1, 0x5D, 0x82, 0x58, 0x48, 0xD5, 0x46, 0xEA,
+    0x4C, 0xC5, 0x1A, 0x45, 0xAD, 0xA4, 0x0E, 0x57, 0xF0, 0x16, 0x5B, 0x9B, 0xE9, 0x09, 0x78, 0xA0,
+    0x81, 0xD1, 0x42, 0xE0, 0x69, 0x8A, 0xFA, 0x4E, 0xE0, 0x7F, 0x53, 0xBD, 0x85, 0x2A, 0x6C, 0xC8,
+    0xC7, 0x42, 0x75, 0x10, 0x0C, 0xAF, 0x3E, 0x9E, 0x90, 0xCA, 0x31, 0x9E, 0x71, 0x09, 0x9D, 0x14,
+    0x92, 0x66, 0x75, 0xB2, 0x58, 0xB5, 0x59, 0x5C, 0xAF, 0x2A, 0xBE, 0xF7, 0xEF, 0xF8, 0xC1, 0xD3,
+    0x1A, 0xB5, 0x61, 0xC7, 0xBB, 0x9C, 0x59, 0x5C, 0x01, 0xB4, 0xD7, 0xDC, 0x52, 0x5B, 0xAB, 0x2B,
+    0x11, 0xE2, 0x12, 0xFB, 0xC4, 0x55, 0xDA, 0xEC, 0xC8, 0xEB, 0xCE, 0xB4, 0x00, 0x16, 0x95, 0xA0,
+    0xF4, 0x88, 0x94, 0x36, 0xEF, 0x92, 0x8B, 0xC7, 0x54, 0xF5, 0xCC, 0x05, 0x6B, 0x9B, 0xD9, 0xEA,
+    0xE5, 0xBE, 0x2F, 0x90, 0x82, 0x53, 0xE6, 0xA2, 0x94, 0x85, 0x09, 0xD4, 0x7D, 0x2E, 0x7C, 0xEC,
+    0x76, 0x1D, 0x2E, 0x55, 0x52, 0xA6, 0xAE, 0xC3, 0x0B, 0xC0, 0x6B, 0xE3, 0xD7, 0x88, 0x9F, 0x19,
+    0xB9, 0xC5, 0xAB, 0xC6, 0x3C, 0x41, 0xBA, 0x54, 0x6E, 0x52, 0x4F, 0x63, 0xA1, 0xCA, 0x5D, 0xDC,
+    0x1A, 0x25, 0x53, 0xDC, 0x69, 0xE4, 0xFE, 0x6E, 0xF5, 0x5C, 0xCC, 0x53, 0x84, 0x43, 0x84, 0x33,
+    0xC4, 0x5C, 0xFF, 0x6C, 0x72, 0x74, 0x70, 0x22, 0xCC, 0x8F, 0xE9, 0xAE, 0xB5, 0xE7, 0xEC, 0x04,
+    0x1B, 0x32, 0x22, 0xB3, 0x99, 0x96, 0x3C, 0x18, 0x2E, 0xE7, 0xDB, 0x04, 0x74, 0x82, 0x3C, 0x81,
+    0x87, 0x12, 0x9D, 0x95, 0x1D, 0x41, 0x11, 0x5F, 0xF4, 0xB4, 0x6F, 0x78, 0x57, 0x71, 0x26, 0x62,
+    0x1F, 0x24, 0xF0, 0x23, 0xC1, 0x37, 0x7F, 0xF5, 0x78, 0x64, 0x27, 0x7A, 0x3C, 0xDE, 0x51, 0x79,
+    0x20, 0xD9, 0xF7, 0xFD, 0xCA, 0x90, 0x20, 0xBA, 0x41, 0xE1, 0xE0, 0x3E, 0xDC, 0x38, 0x83, 0xA3,
+    0xA4, 0x57, 0x4C, 0x09, 0x8F, 0xDA, 0x09, 0x1F, 0x3F, 0x8E, 0x6C, 0x74, 0xD6, 0xF2, 0x6F, 0xD1,
+    0x4C, 0x35, 0x68, 0x25, 0x47, 0x66, 0x0B, 0xB9, 0xF7, 0xAB, 0xD9, 0xFC, 0x31, 0x60, 0x66, 0xF8,
+    0x89, 0xC9, 0x7F, 0xB6, 0x7E, 0x02, 0xD5, 0x54, 0x31, 0x6E, 0xD5, 0x40, 0x10, 0x1D, 0xDB, 0x4A,
+    0x2C, 0xC5, 0xC5, 0x52, 0x80, 0x28, 0x52, 0xB8, 0xA1, 0x43, 0xC2, 0x27, 0x00, 0x5B, 0x39, 0x01,
+    0x45, 0xD2, 0x40, 0x01, 0x35, 0x4D, 0x6E, 0x80, 0xAD, 0x9C, 0x20, 0x05, 0xE2, 0x10, 0x34, 0x69,
+    0x28, 0x11, 0xFE, 0x12, 0x45, 0x8A, 0x14, 0x58, 0x70, 0x81, 0x15, 0xE2, 0x00, 0x56, 0x70, 0xE1,
+    0x80, 0xED, 0xE1, 0xCD, 0xDB, 0x7C, 0x10, 0x5F, 0x41, 0x0A, 0x0D, 0x52, 0x7E, 0x31, 0x7F, 0xDF,
+    0xD8, 0xDE, 0x7D, 0xF3, 0x66, 0xDE, 0x8A, 0x48, 0x24, 0xFC, 0xBD, 0x65, 0xAC, 0x1B, 0x8B, 0xC5,
+    0x68, 0xD1, 0xCD, 0x16, 0x93, 0x0B, 0x3E, 0xB8, 0x2D, 0x1B, 0xBF, 0x54, 0x57, 0xE2, 0x74, 0xAA,
+    0x17, 0x11, 0xD5, 0xA6, 0x1E, 0x24, 0xAA, 0xAB, 0x18, 0xB9, 0xB8, 0x97, 0x02, 0xB9, 0x42, 0xE2,
+    0x1F, 0x03, 0x41, 0xB1, 0x32, 0xD0, 0x2B, 0x41, 0x3A, 0x10, 0x14, 0x2B, 0x03, 0xA2, 0x04, 0xE9,
+    0x48, 0x50, 0x74, 0x06, 0x44, 0x09, 0x92, 0x91, 0x20, 0xFF, 0x64, 0x40, 0x94, 0x20, 0xF9, 0x4E,
+    0x90, 0x73, 0x27, 0x69, 0x01, 0x2A, 0x49, 0x54, 0x6A, 0xED, 0x24, 0xEF, 0x33, 0x05, 0xDB, 0x96,
+    0xCC, 0x42, 0x41, 0xF7, 0x48, 0xD2, 0x5B, 0x5C, 0x2C, 0x94, 0x2B, 0xC3, 0xBD, 0x2D, 0x27, 0x56,
+    0xB7, 0x59, 0xD0, 0x9D, 0x4A, 0xB2, 0xB1, 0xD0, 0x26, 0xD1, 0x8F, 0xBA, 0xC8, 0x7D, 0xBD, 0x38,
+    0xEC, 0xC5, 0x8D, 0x52, 0x57, 0x32, 0x83, 0x8E, 0xB8, 0x4E, 0xCA, 0x06, 0xCB, 0x98, 0xCB, 0xE2,
+    0x9A, 0xCB, 0x48, 0x97, 0x48, 0xE7, 0x52, 0x7D, 0xA9, 0x5D, 0x3D, 0x99, 0x54, 0xA7, 0xEA, 0xA1,
+    0xDB, 0x98, 0x6A, 0x25, 0x77, 0x21, 0xC6, 0x44, 0xA9, 0x90, 0xB3, 0xB2, 0xDB, 0xCA, 0xC0, 0xF9,
+    0x44, 0xE0, 0x7A, 0xAA, 0x03, 0x55, 0xB1, 0x88, 0x27, 0x02, 0xD7, 0x53, 0x9D, 0xBA, 0x31, 0x10,
+    0xCF, 0x04, 0xAE, 0xA7, 0x3A, 0xE5, 0x91, 0x81, 0x68, 0x26, 0x70, 0xE7, 0x94, 0xAA, 0x3C, 0x31,
+    0x10, 0x29, 0x41, 0x06, 0xDD, 0x06, 0xE4, 0xFA, 0x14, 0x52, 0x45, 0x2A, 0x2D, 0x74, 0xCB, 0xA8,
+    0x87, 0xDC, 0xB2, 0x50, 0x71, 0x59, 0xF2, 0x2F, 0xA1, 0x44, 0x92, 0xAF, 0xA8, 0x27, 0xA7, 0xC1,
+    0xB6, 0x30, 0x05, 0x3B, 0xFE, 0x3D, 0x0F, 0x4A, 0xEF, 0x43, 0xF3, 0x23, 0x1D, 0xA5, 0x9C, 0x54,
+    0x7D, 0xDC, 0xEA, 0x6B, 0x45, 0x89, 0x0D, 0x9A, 0xBC, 0x56, 0x2B, 0xF9, 0x27, 0xB5, 0xC2, 0x32,
+    0x57, 0x9F, 0xEB, 0x67, 0x5D, 0x12, 0x9D, 0xD7, 0xBD, 0x21, 0xC1, 0xC2, 0xD8, 0x44, 0xCC, 0xB9,
+    0xEE, 0x77, 0x1F, 0x6D, 0x62, 0x13, 0xFF, 0xAB, 0xE5, 0x51, 0xA8, 0x64, 0x94, 0x97, 0x88, 0x59,
+    0xCF, 0x8F, 0x8A, 0x33, 0xD6, 0xD9, 0xF2, 0x83, 0x58, 0xB9, 0x65, 0xB6, 0xBA, 0x51, 0x03, 0xBD,
+    0x25, 0xDB, 0x88, 0x83, 0x75, 0x30, 0xEB, 0xAC, 0xB4, 0xD2, 0xA1, 0x00, 0x6B, 0x2D, 0x98, 0x53,
+    0x93, 0xA2, 0xF9, 0xDF, 0x03, 0xBD, 0x15, 0xCE, 0x71, 0x14, 0x7F, 0x3D, 0x33, 0x52, 0x5F, 0x66,
+    0x83, 0xBE, 0x49, 0x98, 0xB0, 0x68, 0x08, 0xD9, 0x77, 0x81, 0xD7, 0x43, 0x88, 0xD3, 0xCE, 0xF2,
+    0x40, 0xEA, 0x0B, 0xD5, 0x2E, 0xC2, 0x6C, 0xCE, 0xCF, 0xEC, 0xF3, 0x7C, 0x60, 0xC9, 0xB0, 0x29,
+    0xAB, 0x9B, 0x24, 0x19, 0xC2, 0x8E, 0x73, 0x98, 0x46, 0x9B, 0x4E, 0x7B, 0xD8, 0x5D, 0xF7, 0x61,
+    0x65, 0xE6, 0x07, 0xE1, 0x58, 0x69, 0xBE, 0x4A, 0x21, 0xEF, 0x9F, 0x36, 0x94, 0x2B, 0x6C, 0x48,
+    0xF0, 0xED, 0xD2, 0x86, 0xFE, 0x0A, 0x1B, 0xFA, 0x60, 0xC3, 0x8A, 0x36, 0x9C, 0x82, 0x0D, 0x7D,
+    0xB0, 0xE1, 0x1E, 0x6D, 0x38, 0x05, 0x1B, 0x7E, 0x09, 0x36, 0x3C, 0xBC, 0x9E, 0x0D, 0x1F, 0x71,
+    0xD4, 0xE9, 0xB0, 0xB4, 0xA1, 0x9A, 0x7A, 0x62, 0x4D, 0x75, 0xEC, 0x32, 0x4C, 0xC6, 0xB7, 0xF6,
+    0x2F, 0x9D, 0x57, 0xF8, 0x76, 0x61, 0x6B, 0x77, 0x74, 0x79, 0x3A, 0xD1, 0x76, 0xA8, 0xD9, 0x79,
+    0xF6, 0x15, 0x5A, 0xBC, 0x67, 0xBF, 0x90, 0xCA, 0x3C, 0xDB, 0xF7, 0x97, 0xD4, 0x2E, 0x8C, 0x3B,
+    0x62, 0xE0, 0x33, 0xBF, 0x9E, 0xA1, 0x79, 0xDD, 0x36, 0xF3, 0x4E, 0x6C, 0x87, 0xB6, 0xA0, 0x94,
+    0x59, 0x7A, 0x07, 0x12, 0x47, 0x07, 0x07, 0x88, 0x89, 0xC2, 0x1A, 0xF0, 0x8C, 0x45, 0x64, 0x36,
+    0x2F, 0xD3, 0xAD, 0xC7, 0x74, 0x9A, 0x1E, 0xDB, 0x78, 0x9B, 0xF6, 0xED, 0xD7, 0x5D, 0x14, 0x6E,
+    0xDE, 0x5A, 0xA5, 0xB8, 0x4F, 0x4A, 0x8F, 0xEB, 0x0D, 0x57, 0x57, 0x6E, 0x3B, 0x0F, 0x76, 0x37,
+    0xA7, 0x23, 0xA6, 0x11, 0x43, 0x64, 0x5D, 0x4C, 0x26, 0x34, 0x0E, 0x47, 0x6F, 0x46, 0xE4, 0xED,
+    0x9D, 0xD1, 0xDE, 0x4F, 0x86, 0xD2, 0xBE, 0xED, 0x73, 0xDB, 0xC7, 0xBB, 0xC1, 0xE8, 0x9A, 0x11,
+    0x5A, 0x98, 0xB6, 0x4B, 0x71, 0x50, 0xAD, 0x6A, 0x66, 0x41, 0x69, 0xA0, 0xF2, 0x04, 0x44, 0xE4,
+    0xC5, 0x9B, 0x63, 0x63, 0x03, 0xD5, 0xD5, 0x6F, 0xF0, 0xB5, 0x9B, 0x2C, 0x66, 0x43, 0x40, 0xB6,
+    0xAD, 0x6A, 0x8F, 0xF9, 0xD3, 0xBD, 0xD1, 0xCE, 0xC2, 0xC6, 0xA7, 0xE8, 0xDE, 0x84, 0xA9, 0xC8,
+    0xED, 0x1E, 0xB1, 0x85, 0x3B, 0xB3, 0x0C, 0x28, 0xE5, 0x1F, 0xC6, 0xC0, 0xA4, 0x46, 0x03, 0x8A,
+    0x2E, 0xB5, 0x33, 0x31, 0x56, 0x22, 0xDB, 0xAF, 0xE4, 0x26, 0xFC, 0x7E, 0x02, 0xCD, 0x55, 0xBB,
+    0x6E, 0xD5, 0x40, 0x10, 0x1D, 0xDB, 0x09, 0x16, 0xB8, 0x30, 0x05, 0x20, 0x24, 0x24, 0x4C, 0x41,
+    0x47, 0xB1, 0x0D, 0x05, 0x45, 0x14, 0x5B, 0xF0, 0x03, 0x29, 0x92, 0x06, 0x0A, 0x6A, 0x2A, 0xBE,
+    0x80, 0x6B, 0x43, 0x3A, 0x28, 0x48, 0x01, 0x7F, 0x40, 0x85, 0x90, 0xA0, 0xA4, 0x40, 0xD8, 0x51,
+    0x8A, 0x14, 0x69, 0xDC, 0xD0, 0x9B, 0xC7, 0x07, 0x6C, 0x61, 0x24, 0x03, 0x5E, 0x0F, 0xE7, 0xAC,
+    0x2F, 0xCA, 0x45, 0x20, 0x2A, 0x8A, 0x58, 0xF7, 0xAE, 0x3D, 0xEB, 0xDD, 0x99, 0xB3, 0x67, 0xCE,
+    0x8C, 0x45, 0xFC, 0x15, 0x16, 0xD2, 0x88, 0xC4, 0x6D, 0xC4, 0xF1, 0xDB, 0x5D, 0x8C, 0xA1, 0x2A,
+    0x5F, 0x94, 0x03, 0xC7, 0x40, 0x8E, 0xAF, 0xF5, 0x2D, 0xF1, 0x6F, 0xF7, 0x44, 0x32, 0xD5, 0x51,
+    0xA4, 0xFE, 0x72, 0x49, 0x25, 0x9C, 0x44, 0xB4, 0x89, 0xB1, 0x3A, 0xEF, 0x52, 0x2B, 0x92, 0xDA,
+    0xAC, 0x15, 0x49, 0xFA, 0x9C, 0x0E, 0x87, 0xBC, 0x12, 0x89, 0xC6, 0xBC, 0xE0, 0x58, 0x62, 0x0C,
+    0xFF, 0x18, 0x31, 0xCF, 0x35, 0x03, 0xD7, 0x47, 0x7D, 0xCE, 0xBD, 0x36, 0xA3, 0x9F, 0x2E, 0xED,
+    0x45, 0x4C, 0x13, 0x3B, 0x04, 0x2A, 0x42, 0x6D, 0x63, 0x04, 0x2A, 0x55, 0x31, 0x99, 0xA8, 0x62,
+    0x8B, 0xDC, 0xDE, 0x5B, 0x02, 0x4B, 0x25, 0x96, 0x60, 0x08, 0xAC, 0xA4, 0xDF, 0xFD, 0x1A, 0xBC,
+    0xAC, 0xAB, 0x15, 0xE0, 0xC1, 0x36, 0x71, 0x3B, 0x09, 0x88, 0xBA, 0x2E, 0xCA, 0x2E, 0x6D, 0x44,
+    0x6F, 0x0E, 0x0C, 0x8A, 0x08, 0x87, 0x56, 0x82, 0xB1, 0xC6, 0x99, 0x8E, 0x10, 0x95, 0x0F, 0xE9,
+    0x11, 0x67, 0x80, 0x2D, 0x3B, 0x18, 0x66, 0x48, 0xA5, 0x68, 0x65, 0xDA, 0x98, 0xC1, 0x53, 0xC5,
+    0x49, 0x4F, 0x3D, 0x5B, 0x71, 0x5E, 0x45, 0x18, 0x63, 0xFA, 0x14, 0xD3, 0xF1, 0x14, 0xF5, 0x43,
+    0x10, 0x18, 0x3A, 0x52, 0x82, 0xE9, 0x96, 0x1C, 0x9F, 0x3E, 0xE1, 0x2C, 0x06, 0xC5, 0x59, 0x91,
+    0xCD, 0xA8, 0x95, 0xD8, 0xBE, 0x17, 0x71, 0x38, 0x4B, 0xF6, 0xA8, 0x97, 0xC8, 0x2E, 0x44, 0x36,
+    0xE2, 0x0A, 0x2A, 0x38, 0xBB, 0x44, 0x7F, 0x1E, 0xB1, 0x8C, 0xB6, 0x84, 0xDE, 0x24, 0x3D, 0x9C,
+    0x8D, 0x92, 0xF6, 0xA6, 0x92, 0x7C, 0xD7, 0x12, 0xC9, 0xCC, 0x62, 0xF0, 0x8B, 0x45, 0x4F, 0x67,
+    0x76, 0xD8, 0x63, 0x06, 0x47, 0xC8, 0x6F, 0x39, 0xF8, 0x4F, 0x87, 0xD0, 0x11, 0x41, 0x21, 0x3E,
+    0xFE, 0x3D, 0x38, 0x94, 0xFB, 0xAA, 0x34, 0x6A, 0xDE, 0x46, 0xC9, 0xBF, 0xDF, 0x99, 0x5E, 0xD6,
+    0x4D, 0xD6, 0x0B, 0x4E, 0xFC, 0x2E, 0x1A, 0x71, 0x20, 0x89, 0x1B, 0x70, 0x0A, 0xF3, 0x06, 0x68,
+    0x81, 0x89, 0x58, 0xDE, 0x14, 0xB8, 0xA5, 0xC9, 0x3F, 0x4D, 0x50, 0x11, 0xC1, 0x45, 0x8C, 0xD0,
+    0x39, 0x10, 0xD2, 0x9C, 0x5E, 0xBE, 0x88, 0xFB, 0xDF, 0x17, 0x2F, 0xF7, 0x9A, 0xC6, 0x9B, 0xD5,
+    0xEC, 0xF9, 0x72, 0xC2, 0x64, 0x4B, 0xD4, 0xE5, 0x96, 0xE6, 0xA6, 0xE8, 0xD7, 0xE8, 0xDB, 0xED,
+    0xD7, 0x6D, 0xA8, 0x33, 0xAA, 0xF9, 0x0E, 0x7A, 0xCF, 0x6F, 0x2D, 0x35, 0x45, 0x59, 0x41, 0x6C,
+    0x46, 0x2B, 0xBC, 0xB3, 0xF8, 0x25, 0xFD, 0xA5, 0x1F, 0x43, 0x3C, 0x66, 0x4D, 0xA0, 0x9D, 0x30,
+    0x5D, 0x75, 0x23, 0x0E, 0x12, 0x43, 0x52, 0xDE, 0x83, 0x9A, 0xFC, 0xC3, 0xCE, 0x54, 0x93, 0x3E,
+    0x75, 0xF3, 0x8D, 0xEC, 0x18, 0x8A, 0x75, 0xBE, 0x95, 0x7E, 0x25, 0x51, 0x96, 0x9D, 0x7F, 0x64,
+    0x96, 0xB2, 0x1E, 0xB2, 0x7B, 0xFE, 0x0A, 0xC9, 0xFA, 0x88, 0x0D, 0x50, 0x70, 0x51, 0xC2, 0xF9,
+    0x85, 0x3D, 0x09, 0x76, 0x08, 0x83, 0xEC, 0xC9, 0x06, 0x87, 0xAC, 0x63, 0x25, 0x38, 0x6A, 0x51,
+    0x39, 0x3B, 0x71, 0x58, 0x5F, 0xA9, 0x02, 0xD8, 0xA7, 0x54, 0x91, 0xFE, 0x9A, 0x63, 0x50, 0x36,
+    0xF7, 0x07, 0xD2, 0x88, 0x38, 0xA6, 0x09, 0x1C, 0x1F, 0xD3, 0x8E, 0x9C, 0x4C, 0xFE, 0xB1, 0xE5,
+    0xEC, 0xE8, 0x17, 0x54, 0x78, 0x34, 0x1D, 0x24, 0x4A, 0x3C, 0x86, 0xFA, 0x0F, 0x1D, 0xD5, 0x66,
+    0xF6, 0x1D, 0x13, 0x91, 0x58, 0x52, 0x09, 0x37, 0x21, 0xE0, 0xF1, 0x31, 0x99, 0xB7, 0x59, 0x31,
+    0xAD, 0x68, 0x5B, 0xAA, 0x8D, 0xF4, 0x09, 0x7A, 0x4A, 0x32, 0x11, 0xC5, 0x19, 0xC0, 0xB8, 0x88,
+    0xFB, 0x48, 0x8D, 0xCF, 0x09, 0xA3, 0x57, 0xCC, 0xDA, 0xD5, 0x56, 0x53, 0xA0, 0x88, 0x9E, 0x6A,
+    0x36, 0x5D, 0x73, 0xDA, 0x47, 0x5A, 0x54, 0xE9, 0x32, 0x85, 0x6E, 0xCE, 0x35, 0xAB, 0xEA, 0xEF,
+    0x66, 0xC9, 0xF5, 0x10, 0xE8, 0x49, 0x3A, 0xAF, 0x2F, 0x1E, 0x44, 0x82, 0x6A, 0x9C, 0xEF, 0x57,
+    0x84, 0x47, 0x06, 0x90, 0x35, 0x96, 0x60, 0xE4, 0x8F, 0x7E, 0x75, 0x6E, 0x27, 0x5B, 0xA6, 0x2B,
+    0x3F, 0xEB, 0xA1, 0x3E, 0xD6, 0xD2, 0xC1, 0xDD, 0x95, 0xC8, 0xFD, 0xEB, 0xB8, 0x2B, 0x66, 0x86,
+    0x0E, 0xE7, 0x0B, 0x1B, 0xD7, 0x9A, 0xCC, 0x6F, 0xD9, 0x82, 0xEC, 0x1C, 0x05, 0xE1, 0x12, 0x40,
+    0x38, 0x37, 0x4B, 0x01, 0x1A, 0xDE, 0xA4, 0xE8, 0xC2, 0x21, 0x81, 0x6E, 0xD2, 0x4F, 0x6C, 0xF6,
+    0xB9, 0x07, 0x4C, 0x89, 0x4B, 0x68, 0x4F, 0x9E, 0x6E, 0x42, 0xF4, 0xD1, 0x5C, 0x16, 0xB2, 0x00,
+    0x5D, 0xAC, 0xAA, 0x09, 0x5E, 0xD1, 0x34, 0x82, 0xF1, 0x3F, 0xEB, 0x86, 0x57, 0xDC, 0xF8, 0x02,
+    0x0C, 0x40, 0x06, 0xC3, 0xB3, 0x17, 0xAF, 0xAD, 0x84, 0x41, 0x07, 0x0C, 0xD9, 0x66, 0xDC, 0x9D,
+    0x11, 0x2E, 0x50, 0xF0, 0x32, 0x82, 0xCB, 0x01, 0x24, 0xBC, 0x31, 0xA4, 0x73, 0x60, 0x77, 0x2D,
+    0xD0, 0x32, 0x7A, 0x3A, 0x2E, 0x50, 0x91, 0xDD, 0xFC, 0x41, 0x4D, 0xC6, 0x35, 0x90, 0x80, 0x7A,
+    0x75, 0x0F, 0xF0, 0x5F, 0xF0, 0x33, 0xC3, 0xD6, 0xDD, 0x66, 0x16, 0x1D, 0xB1, 0xCD, 0xC8, 0xB2,
+    0xEF, 0xC7, 0xD7, 0xB1, 0xB4, 0xF5, 0x6A, 0x01, 0x0A, 0x10, 0x15, 0x60, 0xEF, 0xE5, 0xE3, 0xF8,
+    0x3B, 0x32, 0x37, 0x82, 0x21, 0xAD, 0xB2, 0x87, 0xBD, 0xBC, 0x35, 0x45, 0xCC, 0xB5, 0xAC, 0xFE,
+    0x9A, 0x9F, 0x39, 0xE7, 0x43, 0x07, 0xBA, 0x8F, 0x54, 0x6C, 0x48, 0x7A, 0xE0, 0xBB, 0x91, 0xD9,
+    0xD5, 0xDA, 0x66, 0x48, 0xC3, 0xFA, 0x36, 0x7D, 0xFC, 0x04, 0xBD, 0x55, 0x3D, 0x53, 0xD4, 0x50,
+    0x14, 0x3D, 0xC9, 0x2E, 0x64, 0x9C, 0x14, 0xB1, 0x90, 0xC2, 0x19, 0x67, 0x5E, 0x63, 0x65, 0x61,
+    0xFE, 0x00, 0x90, 0x34, 0xF6, 0x5B, 0xB0, 0x16, 0x52, 0x68, 0x6F, 0xA1, 0x85, 0xAD, 0x24, 0x68,
+    0x61, 0x4B, 0x63, 0x4F, 0xC9, 0x48, 0x81, 0xA5, 0x05, 0x92, 0x28, 0x85, 0x05, 0x85, 0xF9, 0x07,
+    0xAE, 0x85, 0x63, 0x1B, 0x71, 0xD5, 0x80, 0x2F, 0xB9, 0x9E, 0xFB, 0x56, 0xD0, 0x19, 0x18, 0x45,
+    0x50, 0xDF, 0xEC, 0xDE, 0x79, 0x9F, 0xF7, 0x9E, 0x7B, 0xEE, 0x47, 0x00, 0x8E, 0xDE, 0x18, 0x88,
+    0x5A, 0x20, 0x96, 0x14, 0x5B, 0xA6, 0xF2, 0x9B, 0x5E, 0xED, 0x57, 0xA8, 0x70, 0x30, 0x62, 0xA9,
+    0x7C, 0x11, 0x1B, 0xB4, 0x8B, 0x36, 0xAA, 0x60, 0x4D, 0x09, 0x1B, 0xE7, 0x68, 0xE2, 0x12, 0x4F,
+    0xE3, 0x11, 0x9F, 0x36, 0x40, 0xC8, 0xA7, 0xBE, 0x50, 0x4F, 0xC6, 0x49, 0x20, 0xDC, 0xCD, 0x74,
+    0xD7, 0xF6, 0xE1, 0xB7, 0xB3, 0x40, 0x7B, 0x9F, 0xFF, 0x25, 0x78, 0x36, 0x43, 0xCF, 0x66, 0x95,
+    0xA9, 0x33, 0x91, 0xCA, 0x48, 0x07, 0xDC, 0x58, 0x01, 0x3C, 0xC0, 0xB7, 0x40, 0x52, 0x23, 0x92,
+    0xDC, 0x6F, 0x5A, 0xCC, 0xF7, 0xEA, 0xA8, 0x34, 0xB8, 0x85, 0x81, 0xB3, 0x3F, 0x84, 0x27, 0x92,
+    0x66, 0xD2, 0x44, 0xB9, 0x59, 0x1E, 0xE3, 0x59, 0x9C, 0x06, 0x5E, 0x3B, 0x81, 0x5C, 0xB4, 0x3C,
+    0x6B, 0x9D, 0x69, 0x4F, 0x5E, 0x94, 0x9E, 0x9D, 0x45, 0xB4, 0x3D, 0x82, 0x4D, 0xD2, 0xF8, 0xA1,
+    0x14, 0xB5, 0x91, 0x06, 0x53, 0x0B, 0xFF, 0xC9, 0x8B, 0x94, 0x4A, 0xC6, 0x7A, 0x9D, 0xC6, 0xBE,
+    0xFF, 0x1D, 0xB3, 0x24, 0x72, 0x8A, 0xCB, 0xA9, 0x01, 0x8C, 0x8C, 0x03, 0x91, 0xBC, 0xF1, 0x1A,
+    0x93, 0x86, 0x0F, 0xC6, 0xB8, 0x6B, 0x78, 0x26, 0x15, 0xED, 0x56, 0x3C, 0xAB, 0x5C, 0x00, 0x8C,
+    0xBD, 0x04, 0xB3, 0x4D, 0x70, 0xF3, 0xF4, 0x64, 0xEC, 0x37, 0xC9, 0x57, 0xA1, 0xF7, 0x39, 0x86,
+    0x54, 0xCF, 0x5F, 0x56, 0x12, 0x18, 0x15, 0xD7, 0xC0, 0x12, 0x75, 0x73, 0xC5, 0xD9, 0x65, 0xC7,
+    0xE1, 0x20, 0x2C, 0x7B, 0xB5, 0x32, 0xE7, 0xB5, 0x49, 0x8A, 0x8C, 0xEC, 0x18, 0x9A, 0xEF, 0xFD,
+    0x88, 0xE3, 0xBF, 0xA6, 0x60, 0x0A, 0xE7, 0x3C, 0x07, 0xE0, 0x39, 0x32, 0x93, 0xFB, 0x52, 0x3B,
+    0x2E, 0xE2, 0xF4, 0xD0, 0xFE, 0x99, 0x03, 0x49, 0x6B, 0x22, 0xB1, 0x8A, 0x9D, 0xFD, 0x8D, 0xFD,
+    0x8D, 0xDD, 0x9A, 0x79, 0xB3, 0xB9, 0x89, 0x02, 0xF1, 0x55, 0xC4, 0x65, 0xF0, 0x2A, 0x0D, 0x6B,
+    0xAF, 0x72, 0xC9, 0x44, 0x8D, 0xCE, 0xE3, 0x92, 0x22, 0x24, 0x45, 0x7F, 0xBC, 0x49, 0xF7, 0x49,
+    0x86, 0x23, 0x41, 0x0E, 0x29, 0xBC, 0xA0, 0x22, 0xD3, 0xA5, 0x71, 0x97, 0x12, 0x15, 0x46, 0x5F,
+    0x46, 0x2A, 0x34, 0x9C, 0xF0, 0xD5, 0xDF, 0xF3, 0xC0, 0x3C, 0xD7, 0x39, 0xC2, 0x11, 0xFC, 0x06,
+    0xD3, 0x22, 0xAF, 0x45, 0x3E, 0x6F, 0xEC, 0xAF, 0x71, 0x81, 0x2D, 0x5A, 0x3B, 0x38, 0x39, 0xBA,
+    0x28, 0x11, 0xEE, 0x5D, 0x87, 0x48, 0x19, 0x4B, 0x49, 0xC6, 0xD0, 0xE7, 0x5E, 0x8D, 0xA0, 0x9B,
+    0x44, 0x7B, 0xA4, 0xA1, 0xD7, 0x98, 0xAF, 0xA8, 0x91, 0xBE, 0x42, 0x30, 0x9A, 0x04, 0x0A, 0xA2,
+    0x50, 0x11, 0x8A, 0x22, 0x29, 0x54, 0x04, 0x3F, 0x85, 0x9E, 0x60, 0x1C, 0x6D, 0x2A, 0x76, 0xBB,
+    0xF5, 0x6E, 0xDD, 0x3A, 0xDA, 0x62, 0xDA, 0x0B, 0x77, 0x72, 0xD2, 0xF6, 0xA1, 0xA2, 0xDF, 0xF7,
+    0xCE, 0x4C, 0x9B, 0xDB, 0x4C, 0x68, 0xD8, 0x57, 0xDA, 0x18, 0xEE, 0xF1, 0xC4, 0x7A, 0x94, 0xBA,
+    0x9C, 0xA5, 0x8F, 0x73, 0xE8, 0x1B, 0x44, 0x8F, 0xF2, 0xE0, 0x6D, 0x39, 0x71, 0xD9, 0x2B, 0xE4,
+    0xA3, 0x48, 0xBB, 0xDE, 0x3D, 0xF9, 0x0D, 0x33, 0xB9, 0x1A, 0xF2, 0xBB, 0x61, 0x9E, 0x48, 0x1D,
+    0x32, 0xBB, 0x66, 0xD2, 0x53, 0xE5, 0x83, 0x77, 0xF3, 0x13, 0x43, 0xE4, 0x90, 0x5D, 0x91, 0xB5,
+    0x53, 0xE6, 0xC3, 0xC9, 0x02, 0x7C, 0xBB, 0x5B, 0x23, 0xBA, 0x6B, 0xD9, 0xE3, 0xF4, 0x17, 0x01,
+    0x66, 0x85, 0xAC, 0x2A, 0x69, 0xCD, 0xAC, 0xF2, 0x24, 0xA2, 0x1D, 0xF9, 0xA5, 0x8B, 0xE2, 0x2A,
+    0xF5, 0x1F, 0x33, 0xE8, 0x3E, 0x0A, 0x79, 0xC3, 0x92, 0x48, 0x64, 0x74, 0x87, 0x2C, 0x17, 0xA9,
+    0x66, 0x04, 0x0B, 0xDF, 0xBA, 0xCE, 0x90, 0xB9, 0xE6, 0xA3, 0xC9, 0x90, 0xE0, 0xB4, 0x07, 0x60,
+    0x4D, 0x72, 0x96, 0xE4, 0x0A, 0x3B, 0xE2, 0x96, 0xD6, 0x27, 0x59, 0xE0, 0x8D, 0xBD, 0xEB, 0xDA,
+    0x80, 0x44, 0xB9, 0x60, 0x47, 0xE9, 0x14, 0xD1, 0x8C, 0x36, 0x6A, 0xCF, 0x15, 0xBA, 0xF8, 0xAA,
+    0xC5, 0xCE, 0xF1, 0xCA, 0x7B, 0x75, 0x62, 0x56, 0xBB, 0x0A, 0xD2, 0x8B, 0x47, 0xDD, 0xF0, 0x8B,
+    0x3C, 0x14, 0x14, 0x8D, 0x27, 0xB5, 0x57, 0xE4, 0xD3, 0x1D, 0x7A, 0x8D, 0x72, 0x46, 0x93, 0x5B,
+    0x27, 0x9D, 0xC6, 0x3A, 0x65, 0x7C, 0xD8, 0xBD, 0xCC, 0xD8, 0x10, 0x56, 0x21, 0x5F, 0xA4, 0xF4,
+    0xA5, 0x49, 0x2C, 0xBC, 0x05, 0xF7, 0xF9, 0x18, 0x0E, 0x07, 0x8E, 0xB2, 0x76, 0x52, 0x02, 0x8A,
+    0x73, 0x38, 0x4C, 0x8F, 0xA3, 0x55, 0xF4, 0xA5, 0x64, 0xEC, 0x79, 0x22, 0xCB, 0x45, 0x8A, 0xE9,
+    0xF6, 0x8C, 0x1C, 0x1E, 0x73, 0xA0, 0x1F, 0x04, 0xCE, 0x48, 0x9A, 0x3A, 0x52, 0xEA, 0x3A, 0xB0,
+    0x6C, 0xA5, 0xB4, 0xFE, 0x6E, 0xD1, 0xBA, 0xF0, 0x2B, 0xD0, 0x42, 0x1A, 0xD7, 0x2F, 0x8F, 0xC5,
+    0xF9, 0x37, 0xC7, 0x37, 0xD5, 0x55, 0x41, 0x6E, 0xD4, 0x30, 0x14, 0xFD, 0x71, 0x98, 0x46, 0x22,
+    0x48, 0x61, 0x03, 0x0B, 0x2A, 0x14, 0x16, 0x2C, 0x90, 0x10, 0xF2, 0x05, 0x00, 0xBB, 0x27, 0x80,
+    0x45, 0xCB, 0x96, 0x23, 0xCC, 0x09, 0x98, 0x44, 0xE2, 0x0C, 0xDC, 0x80, 0x15, 0x1B, 0xB6, 0x2C,
+    0x68, 0xE3, 0xC2, 0x01, 0x88, 0xE0, 0x00, 0xCD, 0x11, 0xBC, 0x88, 0x54, 0x17, 0x92, 0x98, 0xF7,
+    0x7F, 0xAA, 0xB6, 0x83, 0x8A, 0x04, 0xA8, 0xA2, 0x60, 0x8D, 0xAC, 0xEF, 0xD8, 0x63, 0xBF, 0xF7,
+    0xFE, 0xF3, 0x37, 0xDD, 0x7A, 0xF3, 0x9A, 0x28, 0x8D, 0xB1, 0x25, 0x32, 0x71, 0xA0, 0xF3, 0x9B,
+    0x6A, 0xEA, 0x3C, 0x52, 0x13, 0x92, 0xE8, 0x93, 0xA6, 0xDE, 0x98, 0x28, 0x0D, 0x94, 0x77, 0x64,
+    0x6A, 0xDA, 0xFB, 0xD5, 0x50, 0x73, 0xA8, 0x06, 0xD2, 0x1D, 0x95, 0x7D, 0x19, 0x89, 0x9A, 0x78,
+    0x18, 0x9D, 0x8A, 0xC1, 0x0C, 0x94, 0x6C, 0xD3, 0xD3, 0x93, 0xB3, 0xEE, 0xD1, 0x35, 0xF4, 0xA5,
+    0xCD, 0x2D, 0x70, 0x8D, 0xCF, 0x1D, 0xF1, 0x52, 0xA0, 0xA3, 0x2C, 0xD6, 0x3C, 0xBF, 0xF8, 0x01,
+    0x5B, 0x01, 0xD4, 0x1A, 0x7B, 0x4D, 0x88, 0xC2, 0x66, 0x4F, 0xB4, 0x6C, 0x13, 0xF0, 0x48, 0x3D,
+    0x55, 0x98, 0x1D, 0xA8, 0xC4, 0x0E, 0x86, 0x32, 0x8F, 0x95, 0xEE, 0x8F, 0x27, 0x8C, 0x25, 0x44,
+    0x45, 0x47, 0xCC, 0x07, 0x9F, 0x30, 0xAE, 0x1C, 0x19, 0x47, 0xC5, 0xB4, 0xD3, 0x60, 0x79, 0x14,
+    0x01, 0xF3, 0x28, 0x10, 0x17, 0xDB, 0xA7, 0xC2, 0x39, 0x92, 0xCD, 0x1E, 0xB1, 0xC6, 0x6F, 0x1D,
+    0xA3, 0xF5, 0xCC, 0xAE, 0xBF, 0x34, 0x8D, 0x05, 0x9B, 0x8A, 0x2C, 0xAB, 0xFA, 0x1A, 0x78, 0xD0,
+    0x97, 0xDC, 0x3F, 0x4C, 0xF9, 0x53, 0xB1, 0xE5, 0x4F, 0x27, 0x8C, 0xF4, 0xC9, 0x49, 0x6A, 0xE0,
+    0x12, 0x50, 0x1C, 0x41, 0x32, 0x8D, 0xD3, 0xC6, 0x48, 0x04, 0xB5, 0x2F, 0x50, 0xE3, 0x79, 0xA2,
+    0x80, 0x8E, 0x15, 0xF3, 0x61, 0x36, 0xA0, 0x80, 0x71, 0xE9, 0xA9, 0xF0, 0x38, 0xFD, 0xD5, 0xD2,
+    0xB3, 0x49, 0x63, 0xCF, 0x04, 0x62, 0xC7, 0xD8, 0x76, 0xCE, 0xF8, 0x20, 0x08, 0x44, 0xFE, 0xFC,
+    0x4E, 0xF3, 0xD8, 0xB2, 0xC8, 0x7D, 0xC1, 0xE1, 0x3E, 0xB3, 0xAA, 0x46, 0xFE, 0x47, 0xB4, 0x97,
+    0x65, 0x6C, 0xF8, 0xFA, 0x2E, 0xE7, 0xBE, 0x36, 0xDC, 0x77, 0x30, 0x0F, 0x98, 0x19, 0xD0, 0xD5,
+    0x73, 0xEC, 0x60, 0x2A, 0x52, 0xF6, 0xEA, 0xBA, 0x2D, 0xFE, 0x59, 0xD1, 0xEF, 0x24, 0x7C, 0x27,
+    0x1D, 0xAB, 0x3E, 0xF2, 0xC6, 0xFA, 0x63, 0xE0, 0x1D, 0x79, 0xC3, 0xDD, 0x82, 0x9D, 0x6E, 0x59,
+    0xF4, 0xEB, 0x57, 0xD6, 0xD8, 0xDC, 0x0F, 0xD4, 0xF8, 0x3C, 0xD6, 0xD0, 0x69, 0x33, 0xD0, 0xF2,
+    0xF7, 0x94, 0x96, 0x50, 0xCD, 0xA2, 0x3B, 0x35, 0x21, 0x97, 0x5B, 0xB8, 0x4D, 0xB8, 0x74, 0x15,
+    0x57, 0x80, 0x97, 0xF0, 0xF4, 0x0D, 0xBB, 0x00, 0x56, 0x8F, 0x14, 0x1C, 0xC4, 0x80, 0xA8, 0x5B,
+    0xB6, 0x94, 0x34, 0xF6, 0x42, 0x34, 0x3A, 0x3B, 0x41, 0xC8, 0x03, 0x22, 0x00, 0x02, 0x1C, 0xC8,
+    0x84, 0x71, 0x02, 0xD9, 0xF0, 0x33, 0x47, 0xCF, 0xA2, 0x24, 0x8D, 0x7D, 0xA6, 0x51, 0x94, 0xD0,
+    0x6E, 0xCE, 0x65, 0x75, 0xEE, 0x77, 0xA5, 0x37, 0xE2, 0xC2, 0xFC, 0xC8, 0x8A, 0x25, 0xBD, 0x0C,
+    0xFA, 0xBF, 0xE0, 0x49, 0x2D, 0x9E, 0x14, 0x0C, 0x5A, 0xDC, 0xC5, 0x85, 0x95, 0x56, 0xDC, 0x65,
+    0x02, 0xC6, 0x08, 0xCA, 0x66, 0xED, 0x92, 0x88, 0x00, 0xD2, 0xA4, 0x6C, 0x88, 0x29, 0xFD, 0xF1,
+    0xA5, 0xFB, 0x7C, 0xFC, 0x64, 0x18, 0xBB, 0x9A, 0x83, 0x07, 0x74, 0xFB, 0xDC, 0x27, 0x64, 0x7E,
+    0x5C, 0x20, 0x8C, 0x81, 0x95, 0x0C, 0x82, 0x29, 0x83, 0x44, 0xB8, 0x0A, 0x65, 0x4B, 0x50, 0xA9,
+    0xAA, 0x59, 0x60, 0x46, 0xEA, 0x18, 0x7D, 0x23, 0x67, 0x71, 0x95, 0xB5, 0x09, 0x2A, 0x2B, 0x96,
+    0x99, 0x5A, 0x7D, 0xF3, 0x8C, 0x54, 0xBB, 0xF4, 0xD0, 0x33, 0x85, 0xD2, 0xA5, 0x5F, 0x7A, 0x56,
+    0xB5, 0x68, 0xB3, 0x0F, 0x21, 0x81, 0xFB, 0xF2, 0xAE, 0xD8, 0x1F, 0x54, 0xCF, 0xB9, 0x29, 0xEA,
+    0x11, 0x99, 0xA3, 0x14, 0xC5, 0x6D, 0x2F, 0x85, 0x6B, 0x55, 0xD0, 0x54, 0x65, 0x60, 0x9B, 0x0C,
+    0x8F, 0xC9, 0xE4, 0xCC, 0x63, 0x78, 0x41, 0xFA, 0x09, 0x07, 0xE3, 0x7B, 0x2A, 0x3F, 0x31, 0xE3,
+    0x15, 0x92, 0x79, 0x20, 0x60, 0x7B, 0xD8, 0x4A, 0x02, 0x4F, 0x99, 0xE4, 0xB0, 0xEC, 0xA4, 0xEE,
+    0xCB, 0xD5, 0x50, 0x3F, 0x7B, 0x26, 0xFF, 0xC3, 0xF6, 0x1D, 0xC5, 0x55, 0xBF, 0x6F, 0xE4, 0x44,
+    0x18, 0xFD, 0xEC, 0xC9, 0x65, 0x40, 0x06, 0x39, 0xC5, 0x22, 0xDD, 0x9D, 0x90, 0x7C, 0x45, 0x0A,
+    0xAA, 0x4C, 0x4B, 0xB1, 0xBB, 0xE3, 0x4B, 0x24, 0xAE, 0xBD, 0x82, 0x88, 0x12, 0xFE, 0x04, 0x0A,
+    0x8A, 0x2B, 0x92, 0x78, 0x44, 0x4A, 0x0A, 0x52, 0xF0, 0x07, 0x5C, 0x41, 0xB5, 0x4D, 0x1A, 0x8A,
+    0x14, 0x9B, 0xD8, 0x21, 0x45, 0x8A, 0x34, 0x46, 0x41, 0xA2, 0xA0, 0x31, 0x87, 0x68, 0xAE, 0x1A,
+    0x1D, 0x46, 0x67, 0x5D, 0xC6, 0x1E, 0xDE, 0x37, 0xBB, 0x82, 0xFC, 0xA0, 0x03, 0x09, 0x4B, 0x33,
+    0xB3, 0x1E, 0xCF, 0x7E, 0xEF, 0xCD, 0xFB, 0xDE, 0x7C, 0x43, 0x44, 0x11, 0x85, 0x27, 0xAB, 0xC3,
+    0x90, 0xBA, 0x30, 0x24, 0xBE, 0xE2, 0x41, 0xBC, 0xEA, 0xC2, 0x60, 0x35, 0x0F, 0x71, 0x2B, 0xC2,
+    0xA2, 0x47, 0xB4, 0x46, 0xB7, 0x1E, 0xE9, 0x3B, 0xB2, 0x91, 0xEF, 0x7C, 0x4F, 0xBB, 0x54, 0x0C,
+    0x49, 0x4B, 0xCA, 0x90, 0xA3, 0x9E, 0x52, 0x4B, 0x7B, 0xA4, 0x8D, 0xEC, 0x49, 0xE5, 0xD2, 0xC6,
+    0xDE, 0xA4, 0x15, 0xE6, 0xAF, 0xAC, 0x68, 0x30, 0xBB, 0xD3, 0xC7, 0x96, 0xA4, 0x55, 0x99, 0x01,
+    0xAA, 0x4B, 0xB7, 0xEC, 0x84, 0x48, 0x3D, 0xA9, 0x8E, 0x33, 0x04, 0x7C, 0xD1, 0x64, 0x5F, 0x1B,
+    0xCC, 0xB6, 0xE2, 0x77, 0x80, 0xAA, 0x39, 0x9D, 0x58, 0x10, 0x19, 0x28, 0x63, 0x46, 0x3E, 0x17,
+    0x3D, 0x06, 0x55, 0x51, 0x79, 0x9B, 0x09, 0x15, 0x81, 0xB1, 0xE7, 0x5E, 0x73, 0x2F, 0x5A, 0x9E,
+    0xD1, 0xF9, 0x1E, 0xFA, 0xEF, 0xE8, 0x8B, 0xEB, 0x4B, 0x63, 0xEF, 0x2B, 0xED, 0x2F, 0xFC, 0x40,
+    0xDE, 0xAF, 0xFA, 0x9C, 0x54, 0x1D, 0x21, 0xAC, 0x23, 0xE1, 0x48, 0x36, 0x24, 0x5B, 0xC2, 0xB6,
+    0x13, 0x1B, 0xB5, 0x90, 0xA5, 0x01, 0x6F, 0xE0, 0xED, 0x72, 0xA8, 0x7D, 0xCB, 0x30, 0x8A, 0x23,
+    0x9C, 0x04, 0x7D, 0x82, 0x58, 0x71, 0x1F, 0x84, 0xB0, 0x41, 0xCC, 0xEA, 0x2F, 0x26, 0x91, 0xBB,
+    0x33, 0xFD, 0x94, 0x3B, 0xEF, 0x98, 0xA5, 0xE7, 0xF9, 0x15, 0x9E, 0xED, 0x03, 0x9F, 0x9C, 0xA5,
+    0xC4, 0xAA, 0xF4, 0x1C, 0x1F, 0xD4, 0x26, 0x90, 0x77, 0x09, 0x10, 0xEB, 0x37, 0x14, 0x2F, 0xBC,
+    0x29, 0x07, 0xEE, 0x7A, 0xE8, 0x2C, 0xAD, 0x68, 0x29, 0xA9, 0x45, 0x47, 0x69, 0x05, 0xAC, 0xCC,
+    0x20, 0x92, 0x66, 0x6C, 0xEC, 0x57, 0xD3, 0x1C, 0x51, 0x0C, 0x02, 0xA4, 0xA7, 0xBC, 0x89, 0x4B,
+    0x04, 0x95, 0xBF, 0x42, 0x4E, 0x71, 0x05, 0x8C, 0x88, 0xD1, 0x28, 0x08, 0x75, 0xC2, 0x1D, 0x13,
+    0x8D, 0xBA, 0x90, 0x6E, 0xE6, 0xDA, 0xF0, 0x0A, 0x2C, 0x2B, 0x79, 0x45, 0xC9, 0x1F, 0x1F, 0x1E,
+    0xFC, 0xCD, 0x41, 0x33, 0xE1, 0x78, 0x90, 0x98, 0x4F, 0x3A, 0x5E, 0x9B, 0x1A, 0x45, 0x77, 0x9F,
+    0xD2, 0xDB, 0xD4, 0xBF, 0xF2, 0xDE, 0x68, 0x7F, 0x5A, 0xD6, 0x04, 0xBE, 0x45, 0xCE, 0xF4, 0x3C,
+    0x23, 0x41, 0x6C, 0xA8, 0x1A, 0x3B, 0xEC, 0x91, 0x44, 0xC7, 0xA8, 0x89, 0xCD, 0x72, 0x16, 0x9B,
+    0xD1, 0xB2, 0x0B, 0x56, 0x4B, 0x05, 0x6A, 0x3A, 0xC8, 0x57, 0xE6, 0xFF, 0xAC, 0xE7, 0x1D, 0x99,
+    0x7F, 0xE4, 0xCE, 0x33, 0x6F, 0xEF, 0x17, 0x7E, 0xE6, 0x7F, 0x8E, 0x97, 0x2E, 0x4F, 0x7B, 0x16,
+    0x19, 0x33, 0x03, 0xDA, 0xBD, 0x9B, 0x76, 0xF0, 0xAD, 0x46, 0x77, 0xE6, 0x67, 0x87, 0x0E, 0x2C,
+    0x4B, 0xF8, 0x3D, 0xAB, 0xC7, 0x20, 0x17, 0x99, 0x20, 0x94, 0x62, 0xED, 0xBA, 0xA5, 0x6A, 0x70,
+    0x1F, 0x7B, 0xE4, 0xD6, 0xCB, 0xC0, 0x74, 0x2B, 0x7A, 0x1F, 0x5B, 0x15, 0x3F, 0xE0, 0x65, 0x82,
+    0x97, 0xE4, 0xE7, 0x37, 0xB3, 0x99, 0x2B, 0x11, 0xF9, 0x1C, 0xAD, 0x5B, 0xC2, 0x7D, 0x80, 0xC6,
+    0xA9, 0x01, 0xE7, 0x92, 0x6D, 0xCA, 0x26, 0x25, 0xB2, 0xD7, 0xE5, 0x83, 0x41, 0x86, 0x14, 0x7B,
+    0x98, 0x6E, 0x7F, 0xFA, 0x8B, 0x25, 0x2F, 0x4D, 0x62, 0xDF, 0x66, 0x05, 0xC3, 0x62, 0xC3, 0xD2,
+    0x31, 0x30, 0x9B, 0x36, 0x6D, 0xA8, 0x1E, 0x28, 0xF9, 0xCA, 0xD2, 0xA4, 0xD8, 0xFE, 0xE4, 0x35,
+    0x60, 0x2E, 0x7C, 0x50, 0x00, 0xD2, 0x3C, 0x67, 0x91, 0x98, 0x9F, 0x5B, 0xFE, 0x08, 0x33, 0xD7,
+    0x1F, 0x85, 0xB5, 0x5B, 0x68, 0x4E, 0xBF, 0x99, 0xF9, 0x33, 0x8B, 0x3C, 0x4C, 0x10, 0x55, 0x54,
+    0x00, 0xB9, 0x1F, 0x08, 0x06, 0x73, 0x03, 0x71, 0xF1, 0x12, 0xE2, 0xE4, 0xB7, 0x5F, 0x60, 0x02,
+    0x1C, 0x9C, 0xA8, 0x42, 0x9A, 0x26, 0x70, 0x84, 0xB8, 0xC4, 0x97, 0xE3, 0x72, 0x36, 0x3B, 0x64,
+    0x26, 0xAE, 0x40, 0x67, 0x16, 0xB5, 0x05, 0x43, 0x09, 0xF2, 0xC3, 0x42, 0xB1, 0xE8, 0x06, 0x13,
+    0xC8, 0xDF, 0x70, 0x06, 0x7E, 0xDB, 0x1E, 0x32, 0xC4, 0x7F, 0x06, 0x69, 0x0E, 0xE4, 0x42, 0x1A,
+    0x16, 0x5E, 0x05, 0xBF, 0x84, 0x34, 0x0E, 0xF4, 0x2E, 0x20, 0x8F, 0x4A, 0x12, 0x3F, 0xFD, 0xB1,
+    0x5D, 0x20, 0x3C, 0x0B, 0x6C, 0x97, 0xD9, 0x7E, 0x4A, 0x13, 0x14, 0x1C, 0xD1, 0x25, 0x0D, 0xA5,
+    0x2F, 0xF0, 0x3F, 0xCD, 0x69, 0x61, 0xFC, 0xD8, 0xFE, 0x4F, 0xF9, 0x8E, 0x69, 0x35, 0x9F, 0xE2,
+    0x50, 0x1E, 0xC3, 0xE7, 0x3D, 0xB0, 0x86, 0x16, 0xC7, 0xCB, 0x2C, 0x7D, 0xFB, 0x9F, 0xE6, 0x9B,
+    0xCF, 0x69, 0x0C, 0xDF, 0xA7, 0x57, 0x1E, 0x87, 0x7F, 0x8A, 0xE3, 0xF6, 0x56, 0x38, 0xE0, 0xC7,
+    0xCB, 0x2A, 0xF3, 0x2F, 0x5B, 0x86, 0xD0, 0x3A, 0x1C, 0xAB, 0xE7, 0xB2, 0x51, 0xB5, 0xAE, 0x74,
+    0xA5, 0x0C, 0x2A, 0x36, 0xD5, 0x49, 0x5D, 0x6C, 0x75, 0xEA, 0xB4, 0x93, 0x66, 0x51, 0xD4, 0x4A,
+    0xAE, 0x8C, 0xC2, 0x37, 0xC9, 0x65, 0x9B, 0x1A, 0xE8, 0xBB, 0x73, 0x9F, 0x46, 0xC8, 0x76, 0x66,
+    0xC7, 0xDA, 0xED, 0x4C, 0x0B, 0x37, 0xCE, 0xBA, 0x95, 0xF8, 0xE0, 0xE1, 0xEC, 0x5B, 0xCD, 0xF6,
+    0x58, 0x0A, 0x31, 0xA6, 0x77, 0x34, 0x8D, 0xF5, 0xCB, 0x2E, 0xF5, 0xB8, 0x50, 0xF2, 0x6C, 0xCB,
+    0xE9, 0x33, 0x77, 0x8F, 0xDE, 0xA3, 0x51, 0xF1, 0xB8, 0x2F, 0xBF, 0x1C, 0x8A, 0xA8, 0x5F, 0xA1,
+    0xB5, 0xE8, 0x63, 0x42, 0xEA, 0x0E, 0xCF, 0xEA, 0xE3, 0xB1, 0xAC, 0x51, 0xB9, 0x0A, 0x18, 0x24,
+    0x6A, 0x16, 0x95, 0xB4, 0x68, 0x32, 0xBF, 0xDF, 0xCC, 0xC7, 0xF2, 0xAC, 0x1E, 0xEB, 0xE4, 0xD4,
+    0xB7, 0x49, 0xA8, 0xCC, 0x66, 0x14, 0xDB, 0xA9, 0xB0, 0x45, 0xD2, 0xF4, 0xE9, 0xF7, 0x9D, 0x12,
+    0x76, 0x2C, 0x21, 0x25, 0x8D, 0x68, 0x7D, 0x87, 0x9C, 0x8E, 0xDB, 0xEC, 0xBC, 0xC1, 0xAD, 0x17,
+    0xFB, 0xC5, 0x46, 0x69, 0x14, 0xD3, 0x3C, 0x35, 0x7D, 0x5A, 0xE1, 0x0F, 0x6A, 0xDF, 0xA6, 0x55,
+    0x27, 0xE0, 0x0C, 0xF8, 0x7C, 0x04, 0x71, 0xEB, 0xCC, 0x77, 0xFA, 0x23, 0xF7, 0x21, 0xCD, 0x1F,
+    0xD1, 0x7A, 0x6C, 0xE6, 0xD9, 0x96, 0xDD, 0x4B, 0x9A, 0x52, 0xBA, 0xCC, 0x3C, 0x90, 0x9D, 0xAE,
+    0x1C, 0x96, 0x2B, 0xD1, 0x1C, 0x11, 0xAD, 0x6E, 0xF6, 0xFA, 0xCC, 0xEA, 0xD8, 0xA6, 0x66, 0x1E,
+    0x37, 0x6C, 0x0F, 0x3D, 0xD9, 0x79, 0xF6, 0xF9, 0x5A, 0x92, 0xBB, 0xB4, 0x76, 0xFA, 0x49, 0xFD,
+    0x19, 0x7B, 0xA3, 0xC3, 0x1E, 0x71, 0x61, 0x6E, 0xC0, 0xCE, 0x8F, 0x87, 0x72, 0x73, 0xD0, 0xA1,
+    0x18, 0x53, 0x9E, 0xB5, 0xD3, 0xF9, 0xD1, 0xC6, 0xD1, 0xC6, 0xEE, 0xAE, 0xEA, 0x56, 0xF9, 0x04,
+    0x28, 0x84, 0x3E, 0x6D, 0xA7, 0x71, 0xBE, 0x22, 0x5D, 0x61, 0xB5, 0x6C, 0x5C, 0x11, 0xE7, 0xB4,
+    0x26, 0x2B, 0x45, 0x6C, 0xAE, 0xE2, 0x1B, 0xDD, 0xCB, 0x0E, 0x2E, 0xF2, 0xFE, 0x25, 0x3D, 0xE0,
+    0x7B, 0x32, 0xF2, 0xB5, 0x78, 0x0D, 0xF6, 0x2C, 0xFF, 0xCA, 0xDD, 0x7B, 0xFB, 0x4F, 0xB5, 0x55,
+    0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xAF, 0xEF, 0xCE, 0x48, 0x2E, 0x7C, 0x45, 0x10, 0x42, 0x08,
+    0x39, 0x05, 0x65, 0x14, 0xB7, 0x29, 0x2E, 0xB7, 0x4E, 0x91, 0xD4, 0x57, 0xE4, 0x35, 0x49, 0x91,
+    0x86, 0x82, 0xD0, 0xE4, 0x1F, 0xE0, 0xB0, 0x43, 0x1B, 0x09, 0x5D, 0x41, 0xF8, 0x0B, 0xAE, 0xE1,
+    0xA5, 0x38, 0xFE, 0x80, 0x77, 0xB1, 0x7B, 0x1A, 0x0B, 0x09, 0xD1, 0x5A, 0x11, 0x34, 0x54, 0x16,
+    0xDA, 0x48, 0xCE, 0xB1, 0xEB, 0xE1, 0x9B, 0xB1, 0x5F, 0xB8, 0x08, 0x8A, 0x44, 0x11, 0xAB, 0xE7,
+    0xB5, 0x35, 0xB3, 0xF3, 0x63, 0xBF, 0xF9, 0x66, 0xDE, 0x15, 0xFA, 0xE0, 0x26, 0x5D, 0xB3, 0xF5,
+    0xA6, 0x60, 0x97, 0x72, 0x47, 0x0F, 0x29, 0x2A, 0x29, 0x1F, 0x0E, 0xAC, 0xFF, 0xEA, 0xB0, 0xF2,
+    0x07, 0xD9, 0xB8, 0x13, 0x9D, 0x7C, 0xB8, 0xBA, 0x6B, 0x39, 0x54, 0xEC, 0x09, 0xEB, 0x0A, 0x19,
+    0xEE, 0x72, 0x1E, 0xED, 0x1D, 0x7F, 0x83, 0x36, 0x57, 0xE9, 0x33, 0xA2, 0x96, 0xCC, 0x40, 0xF1,
+    0x40, 0x69, 0x4F, 0x59, 0x4B, 0x05, 0xD1, 0x35, 0x39, 0xF8, 0x31, 0x7D, 0xDE, 0xDC, 0x9A, 0x9A,
+    0x6F, 0xA6, 0x2A, 0x0A, 0x3B, 0xB4, 0xFF, 0x45, 0xDA, 0x6E, 0xD2, 0xBE, 0x7A, 0x31, 0x92, 0x2E,
+    0x87, 0x27, 0x91, 0xEF, 0x4C, 0xBC, 0x66, 0x13, 0x36, 0xA3, 0xFE, 0xF7, 0xE9, 0xF5, 0x8A, 0x18,
+    0xEB, 0x09, 0x9E, 0x69, 0x97, 0xD7, 0xCF, 0x3C, 0xF4, 0xF1, 0x90, 0x22, 0x4C, 0x5D, 0xB4, 0xF4,
+    0x29, 0x35, 0x5B, 0x13, 0x88, 0x88, 0x20, 0x22, 0x6A, 0x98, 0x5B, 0x83, 0xE3, 0x94, 0x5E, 0xAC,
+    0x4F, 0x17, 0xD1, 0xE5, 0x53, 0x25, 0x44, 0x69, 0x09, 0xD1, 0x21, 0x44, 0x91, 0x4B, 0x5F, 0x7E,
+    0x79, 0xF6, 0xAB, 0xC4, 0x28, 0xF0, 0x68, 0x70, 0x32, 0x2E, 0xE9, 0x71, 0x7D, 0xDB, 0x52, 0xD5,
+    0x32, 0xD1, 0x79, 0xE4, 0xE8, 0xCD, 0x55, 0xE1, 0xE8, 0x0B, 0xB1, 0x79, 0x5C, 0xFD, 0xB1, 0x66,
+    0x71, 0x2F, 0x79, 0x99, 0x1E, 0xEE, 0x93, 0xF2, 0xDF, 0x11, 0x09, 0xAE, 0x07, 0xC9, 0xAB, 0x36,
+    0xD3, 0xFA, 0x87, 0xCB, 0xA9, 0x2E, 0xA7, 0xF6, 0x21, 0x32, 0x1D, 0x44, 0x59, 0x0D, 0xD1, 0xB1,
+    0x09, 0xF7, 0x9E, 0xBD, 0x14, 0xF7, 0x3F, 0xC9, 0xA6, 0xD1, 0x58, 0x7C, 0xE0, 0x62, 0xE9, 0xC5,
+    0xD9, 0xC5, 0xD9, 0x60, 0x86, 0xD8, 0xD1, 0x48, 0x1B, 0x0A, 0x74, 0x48, 0xD7, 0xC9, 0x96, 0x59,
+    0x99, 0x94, 0x59, 0x87, 0xA2, 0x51, 0x3C, 0xE7, 0x1A, 0x74, 0xB7, 0xB7, 0xEF, 0x0A, 0xAE, 0xCC,
+    0xBF, 0x41, 0x01, 0xF3, 0x9A, 0x68, 0xBA, 0xD5, 0x00, 0x70, 0x5B, 0x46, 0x5C, 0x52, 0xD6, 0x51,
+    0xDE, 0x8B, 0x45, 0xEC, 0xD5, 0xA2, 0x12, 0x05, 0xE5, 0x9D, 0x28, 0x44, 0x0A, 0x57, 0x40, 0x68,
+    0x2A, 0xA1, 0x48, 0x39, 0x50, 0xDE, 0x26, 0xCC, 0x25, 0xEA, 0x4B, 0xDB, 0x30, 0x73, 0xB1, 0x22,
+    0x0D, 0x66, 0xA4, 0x7A, 0xD1, 0x7D, 0xD9, 0x89, 0x55, 0xB2, 0x77, 0xAA, 0x49, 0x20, 0x29, 0x1A,
+    0xE6, 0x53, 0x31, 0x82, 0x26, 0x78, 0xE2, 0x57, 0x90, 0x1D, 0xFD, 0x83, 0x67, 0x8E, 0xDC, 0xFE,
+    0x12, 0xF8, 0x1F, 0x5C, 0x9C, 0x31, 0x9C, 0xE6, 0x80, 0x21, 0xEE, 0x81, 0x87, 0x03, 0x30, 0x37,
+    0x21, 0xD8, 0x53, 0xA8, 0x04, 0x33, 0x01, 0x4F, 0xC3, 0xBE, 0x85, 0x40, 0x82, 0x01, 0x73, 0xE6,
+    0x7E, 0x89, 0x83, 0xCF, 0x52, 0x82, 0x39, 0x6A, 0x7E, 0x7F, 0xE4, 0x4C, 0x90, 0x4A, 0x3B, 0x70,
+    0x20, 0xC3, 0x01, 0x97, 0xC3, 0x76, 0x28, 0x00, 0xD1, 0x91, 0x95, 0x94, 0x75, 0xAB, 0xD6, 0x4D,
+    0x27, 0xF8, 0xEB, 0x56, 0x0B, 0x40, 0x90, 0xA9, 0xB6, 0x96, 0x4D, 0x6A, 0x58, 0x74, 0x44, 0x37,
+    0x72, 0xC4, 0x3C, 0x4E, 0x01, 0x56, 0x88, 0xF9, 0xE4, 0x13, 0x2F, 0xB5, 0x76, 0x12, 0x08, 0xA7,
+    0x56, 0xCB, 0x3D, 0x0B, 0xEE, 0x10, 0xDE, 0x27, 0xE1, 0xBE, 0x07, 0xBC, 0x1E, 0xD1, 0x3C, 0x82,
+    0x8D, 0xC8, 0xF8, 0xC7, 0x02, 0xE1, 0x33, 0x54, 0x25, 0x45, 0x76, 0x06, 0x86, 0x08, 0x26, 0xA9,
+    0x43, 0x5A, 0x89, 0xD4, 0xEF, 0x90, 0x09, 0x07, 0xA8, 0xD0, 0x31, 0x9E, 0xAF, 0x29, 0xF2, 0x15,
+    0x0A, 0x56, 0x75, 0xF9, 0x20, 0x89, 0xE5, 0x20, 0x3A, 0xDD, 0x3B, 0x81, 0xC9, 0x9F, 0x42, 0xC7,
+    0x0E, 0x30, 0xE0, 0xF2, 0xC0, 0x00, 0x8E, 0xDF, 0xE6, 0x33, 0x44, 0x4A, 0x33, 0x65, 0x4B, 0x79,
+    0x5E, 0x3D, 0x66, 0xFC, 0x0A, 0x3A, 0xBF, 0x54, 0x1A, 0x5F, 0xF0, 0xB8, 0x8B, 0x84, 0x1A, 0x7A,
+    0xF7, 0x5F, 0xA9, 0xE6, 0x1E, 0x17, 0x6F, 0x2D, 0x8F, 0xF4, 0xC0, 0xA9, 0x58, 0x2A, 0xF4, 0x1E,
+    0x2F, 0xA9, 0x16, 0xC8, 0x04, 0x04, 0x63, 0xC0, 0x83, 0xD4, 0x51, 0x23, 0x8B, 0x32, 0x9E, 0xCE,
+    0x9D, 0xC6, 0x32, 0x50, 0xA4, 0x59, 0x50, 0x18, 0x02, 0xA1, 0x94, 0xA9, 0x05, 0x49, 0x65, 0x09,
+    0x2D, 0xF3, 0x5C, 0x89, 0x30, 0x18, 0x1D, 0x41, 0x69, 0x3B, 0xD3, 0xD9, 0x2E, 0xEA, 0x71, 0x56,
+    0xC7, 0xBD, 0x99, 0x9E, 0x4A, 0xE7, 0xD4, 0xA9, 0x92, 0xE7, 0x78, 0xEE, 0xE0, 0x68, 0x80, 0xFA,
+    0x11, 0x66, 0x4F, 0x0B, 0x6B, 0xB4, 0x89, 0x95, 0x61, 0x67, 0x5B, 0x8C, 0x07, 0x58, 0x37, 0x10,
+    0x43, 0x0D, 0x6C, 0x2D, 0x41, 0x9D, 0x0E, 0xC6, 0xA9, 0xFA, 0x5B, 0xE0, 0x5C, 0xD4, 0x28, 0x18,
+    0x28, 0xC9, 0xAB, 0xE6, 0x67, 0xA4, 0x05, 0x76, 0x84, 0x24, 0x48, 0x47, 0x4E, 0xE5, 0x5E, 0xB9,
+    0x1D, 0x29, 0x7D, 0x26, 0xA5, 0x6C, 0xB8, 0xCB, 0xA4, 0x7D, 0x3E, 0x0A, 0x14, 0x55, 0xF5, 0xCC,
+    0x64, 0xA1, 0xE2, 0x3B, 0xBF, 0x05, 0x01, 0x7E, 0xB5, 0xBC, 0xC1, 0xBD, 0xB0, 0x5A, 0x55, 0xDF,
+    0x37, 0xE3, 0xAC, 0x8F, 0xFD, 0x72, 0x2E, 0x2C, 0xEF, 0xE9, 0xBF, 0xDF, 0xD1, 0xA2, 0x4F, 0x3C,
+    0x9A, 0x85, 0xEC, 0xD3, 0x0A, 0x9C, 0x1B, 0x12, 0x19, 0x44, 0x0D, 0x0F, 0x99, 0xF8, 0xBF, 0x3C,
+    0x12, 0x79, 0x8E, 0x06, 0x76, 0xE9, 0x94, 0x02, 0xE8, 0x98, 0x4C, 0xF5, 0x32, 0xA6, 0x4C, 0x8F,
+    0x99, 0xE1, 0x68, 0x3B, 0xA7, 0xE6, 0xFE, 0xDA, 0x0E, 0xAA, 0xD8, 0xED, 0x1E, 0xCD, 0x93, 0x4A,
+    0x1A, 0xD7, 0xB2, 0x0E, 0x10, 0xFE, 0x0E, 0x9D, 0x24, 0x93, 0x06, 0x3D, 0x2A, 0x23, 0x49, 0xEA,
+    0x0E, 0x2B, 0x69, 0xBD, 0xA0, 0x44, 0x80, 0x4A, 0xD2, 0x83, 0x4A, 0x98, 0x01, 0x15, 0xA0, 0x8E,
+    0x80, 0xA1, 0x90, 0x95, 0x5B, 0x34, 0x1C, 0x32, 0x8D, 0xA4, 0xE5, 0xB7, 0xEB, 0x40, 0x6B, 0xAE,
+    0x84, 0x60, 0xE9, 0xDD, 0x5C, 0xA3, 0xEB, 0xC8, 0x8A, 0xDE, 0x9C, 0xF0, 0x30, 0x6B, 0xE3, 0x31,
+    0x45, 0x45, 0xEC, 0x00, 0xF2, 0x1B, 0xFC, 0xA5, 0x60, 0x2C, 0xFD, 0x22, 0x81, 0xBC, 0x8C, 0x99,
+    0xA4, 0x93, 0x0C, 0x0E, 0x05, 0x6F, 0xB0, 0x02, 0x62, 0xDC, 0x13, 0xE2, 0x8D, 0xFE, 0xFF, 0x74,
+    0x0A, 0xBF, 0x8E, 0x22, 0xAB, 0xE2, 0x4A, 0xC7, 0x13, 0xEB, 0xE9, 0x20, 0x62, 0xA3, 0x4E, 0x64,
+    0xEC, 0x82, 0x36, 0xA3, 0xDC, 0x22, 0x73, 0x92, 0x58, 0xE6, 0x90, 0x32, 0xE5, 0x0E, 0x3D, 0x43,
+    0xB9, 0x32, 0x74, 0xAF, 0xA4, 0xFF, 0x7F, 0xFD, 0x0D, 0xCD, 0x55, 0xB1, 0x8E, 0xDE, 0x44, 0x10,
+    0x1E, 0xDB, 0x1C, 0x46, 0x72, 0xB1, 0xE9, 0x80, 0x43, 0xC2, 0x0D, 0x25, 0x92, 0x29, 0xE9, 0xD6,
+    0x40, 0x41, 0x9B, 0x22, 0x49, 0x11, 0x1E, 0x82, 0x96, 0xE2, 0xEE, 0xEC, 0xF0, 0x04, 0x29, 0xE0,
+    0x21, 0xF8, 0x53, 0xC0, 0x03, 0x1C, 0xB7, 0x06, 0xCA, 0x14, 0x6C, 0x47, 0x6B, 0xD1, 0x20, 0x5D,
+    0x13, 0x03, 0x3E, 0xC9, 0x28, 0x5E, 0x0F, 0xDF, 0x37, 0xBE, 0x0B, 0x49, 0x40, 0x54, 0x14, 0x58,
+    0xFA, 0xC7, 0xFF, 0x8C, 0x77, 0x67, 0x67, 0xBE, 0xF9, 0x66, 0x56, 0x64, 0x7F, 0xAA, 0xD6, 0x5E,
+    0x6A, 0xD2, 0x25, 0x7B, 0x35, 0x8B, 0xBD, 0xEA, 0xD1, 0x5E, 0xAF, 0xC8, 0x8B, 0x4F, 0xA9, 0x9B,
+    0xD4, 0xBA, 0x06, 0x8D, 0x99, 0xEA, 0x83, 0x2E, 0x4A, 0x16, 0xDA, 0x7C, 0x85, 0x7D, 0x92, 0x66,
+    0xA0, 0x27, 0x2A, 0xDE, 0x14, 0x67, 0x4A, 0xF1, 0xD4, 0x94, 0xD4, 0x51, 0xF1, 0x1F, 0x53, 0x71,
+    0x91, 0x4A, 0x31, 0xDB, 0x9E, 0x24, 0x54, 0x7C, 0x4B, 0xE5, 0xC7, 0x48, 0x45, 0x67, 0xF3, 0xB6,
+    0x89, 0x29, 0xBD, 0x29, 0xA3, 0x29, 0xD7, 0xE7, 0x44, 0x91, 0xD0, 0x76, 0x3A, 0x4A, 0xD0, 0xC7,
+    0x7B, 0x38, 0x92, 0x0F, 0x19, 0x96, 0x54, 0x31, 0x9F, 0x21, 0x27, 0x2C, 0x92, 0x42, 0x03, 0x33,
+    0x08, 0x6A, 0x29, 0xB6, 0x2F, 0x66, 0xD1, 0xE9, 0x54, 0xE8, 0x16, 0x28, 0x53, 0x85, 0xB4, 0x9B,
+    0x98, 0x53, 0xB6, 0x82, 0x43, 0x3D, 0x8F, 0x92, 0x6F, 0xF1, 0xA7, 0x17, 0x1C, 0x58, 0x0F, 0x19,
+    0x7C, 0xBA, 0xB1, 0x98, 0x78, 0x78, 0x89, 0xB3, 0x8B, 0xC5, 0x21, 0xD3, 0x6C, 0xAD, 0xE9, 0x74,
+    0x6B, 0xCC, 0xDF, 0x29, 0xA5, 0x5F, 0x0D, 0xC6, 0xD9, 0x90, 0x9D, 0x0C, 0xAD, 0x68, 0x16, 0x2C,
+    0x97, 0xF7, 0x6C, 0xE1, 0xD9, 0x05, 0x65, 0x30, 0x88, 0x3B, 0x43, 0xF8, 0x78, 0x8F, 0x67, 0x2C,
+    0x55, 0x1B, 0x9D, 0xF3, 0x1D, 0xD4, 0xD7, 0x93, 0x39, 0x08, 0x96, 0x32, 0xD0, 0x0B, 0xE6, 0x10,
+    0x7F, 0xA0, 0xFF, 0xF7, 0x1F, 0xB6, 0x2F, 0xEF, 0x85, 0x58, 0x2B, 0x9F, 0xC7, 0x26, 0x61, 0xF6,
+    0x83, 0x65, 0x61, 0x21, 0x66, 0x3B, 0x23, 0x4E, 0x77, 0x96, 0x18, 0x94, 0x85, 0x7D, 0x96, 0x6F,
+    0xE4, 0x6F, 0xCF, 0xC9, 0x0E, 0x70, 0x6F, 0x80, 0x18, 0x08, 0xB5, 0xF1, 0xAA, 0x7A, 0x42, 0x53,
+    0xF1, 0x0B, 0x4D, 0xF9, 0x64, 0xA6, 0x85, 0x8C, 0x91, 0x53, 0x56, 0x0B, 0xA8, 0x6F, 0x74, 0xDE,
+    0xD3, 0x54, 0x0D, 0x05, 0x30, 0x04, 0xE0, 0x30, 0x65, 0xDB, 0x21, 0x90, 0x57, 0x0A, 0x56, 0x48,
+    0x77, 0x38, 0x6C, 0x56, 0x26, 0xB2, 0x6B, 0x10, 0xAC, 0xAA, 0x22, 0x39, 0xC7, 0xDA, 0xA0, 0x4E,
+    0xA4, 0xC7, 0x52, 0x62, 0x61, 0xA3, 0xBF, 0x6B, 0x22, 0x2F, 0x3A, 0xEC, 0xFB, 0x9E, 0x19, 0x65,
+    0xDD, 0xE5, 0xD7, 0x0B, 0x72, 0x2D, 0x46, 0xA4, 0xED, 0x5A, 0x24, 0xFE, 0xAE, 0xF1, 0x95, 0x70,
+    0x18, 0x32, 0x52, 0x5D, 0xDD, 0x86, 0x6B, 0xD5, 0x87, 0xA0, 0x8C, 0x62, 0x55, 0x16, 0x46, 0xC3,
+    0x09, 0xAB, 0x7C, 0x8F, 0x55, 0x1B, 0x56, 0xE5, 0x0B, 0x4C, 0x6E, 0x84, 0xA9, 0x6B, 0x83, 0x94,
+    0x6B, 0x9E, 0xEE, 0xEA, 0x77, 0xF0, 0xBE, 0x56, 0xAA, 0xDB, 0x0D, 0x00, 0xB7, 0xD0, 0x12, 0xAA,
+    0x3D, 0x4C, 0x1A, 0x8F, 0x54, 0xC2, 0x80, 0x8D, 0x5D, 0x8F, 0x8D, 0x17, 0xF0, 0x86, 0x18, 0xB1,
+    0x91, 0x41, 0x34, 0x0C, 0x02, 0xAF, 0x01, 0x29, 0x60, 0x3D, 0x98, 0xAE, 0x0A, 0xD3, 0x3D, 0x6D,
+    0xE1, 0x1E, 0xDB, 0x40, 0x30, 0x76, 0xCF, 0xCC, 0x13, 0x23, 0x83, 0xB0, 0x12, 0x72, 0xE3, 0x58,
+    0x5D, 0x7D, 0xA2, 0xA0, 0x8B, 0x8E, 0x08, 0x77, 0xB9, 0x21, 0xB4, 0xEA, 0x13, 0xFC, 0x7E, 0xED,
+    0x2E, 0xC3, 0x8A, 0x2D, 0x67, 0x4C, 0x13, 0x61, 0x17, 0xDC, 0x4A, 0x1F, 0x6F, 0x58, 0x92, 0xCC,
+    0xD6, 0x10, 0x9E, 0xAE, 0xB3, 0xFE, 0x77, 0x03, 0xAA, 0x54, 0x23, 0x31, 0xA4, 0xD2, 0x1B, 0x36,
+    0x68, 0x34, 0xCA, 0x45, 0x8E, 0xC2, 0x81, 0xA6, 0x13, 0x76, 0xCA, 0xB5, 0x3C, 0x7F, 0x4E, 0xAE,
+    0x26, 0x17, 0x93, 0x33, 0x65, 0x66, 0x32, 0x9F, 0x28, 0x8B, 0x5D, 0x8E, 0x94, 0x25, 0x1B, 0x1E,
+    0xF5, 0xA6, 0x74, 0x3D, 0x25, 0x9A, 0xAA, 0xBB, 0xE9, 0xC1, 0x0B, 0xCA, 0x57, 0xB7, 0xBB, 0xF7,
+    0xC3, 0x6D, 0xCF, 0x22, 0x26, 0x93, 0x9B, 0x27, 0x03, 0xD3, 0xB5, 0x64, 0xF2, 0xAB, 0xB5, 0xD6,
+    0xB9, 0xC9, 0x93, 0xB7, 0x29, 0xDF, 0x7F, 0x8D, 0xF2, 0x1D, 0xA2, 0xF2, 0x33, 0xF7, 0x3C, 0xE8,
+    0x2E, 0x0F, 0xC4, 0x54, 0x08, 0x60, 0xCE, 0xC2, 0x96, 0xED, 0x4B, 0xE5, 0x27, 0x09, 0x1B, 0x52,
+    0x9F, 0xC5, 0xCB, 0xB7, 0xC3, 0x57, 0xD7, 0xA6, 0xE7, 0x57, 0xDD, 0x82, 0x29, 0x27, 0xA2, 0x84,
+    0x56, 0x4E, 0xF3, 0x74, 0xFF, 0xD1, 0xD5, 0xB3, 0xAE, 0xF9, 0xAB, 0x05, 0x12, 0x1C, 0xCD, 0x90,
+    0x5D, 0x74, 0x40, 0x4C, 0x87, 0x7A, 0xE5, 0x34, 0x0D, 0x63, 0xFE, 0x69, 0x0F, 0xCA, 0x76, 0x77,
+    0x24, 0xE7, 0x57, 0x6F, 0xAC, 0xF7, 0x2D, 0xC7, 0x48, 0x11, 0x5D, 0x74, 0xEC, 0x8F, 0x73, 0x14,
+    0x7C, 0xB0, 0x2E, 0x4B, 0x05, 0x67, 0x47, 0x36, 0xF9, 0x0F, 0xAD, 0x89, 0xBC, 0x35, 0x00, 0xEB,
+    0xB1, 0x9F, 0xE4, 0x62, 0x72, 0xD1, 0x3A, 0xD4, 0x7F, 0xC0, 0xF8, 0xCB, 0xC9, 0x45, 0x0C, 0x2C,
+    0x0C, 0x27, 0xCC, 0xD5, 0xD9, 0xC2, 0x4D, 0x8C, 0x3B, 0xDB, 0x70, 0x84, 0x9B, 0xD8, 0x25, 0x2E,
+    0xE6, 0x20, 0xA9, 0xB6, 0x88, 0xC1, 0x47, 0x41, 0xFD, 0xB6, 0xB6, 0x4C, 0x08, 0xAF, 0x42, 0xAF,
+    0x84, 0xA8, 0x43, 0x01, 0x02, 0x96, 0xDB, 0xF1, 0x3E, 0x2A, 0xDF, 0x14, 0x39, 0xBA, 0x63, 0x83,
+    0x32, 0x23, 0x31, 0xBB, 0x87, 0xCD, 0xD4, 0xB4, 0xD9, 0x86, 0xE0, 0xFC, 0xE7, 0x13, 0x4E, 0xFD,
+    0x0C, 0x27, 0x59, 0xAA, 0x3B, 0x3A, 0x1D, 0x27, 0x2D, 0xA3, 0x9B, 0x25, 0x7B, 0xC4, 0x91, 0x5B,
+    0x4F, 0x76, 0xB6, 0x4D, 0x51, 0x71, 0xBF, 0xA1, 0x59, 0xFF, 0xC0, 0xA7, 0x84, 0x35, 0xDA, 0xCC,
+    0x99, 0x7E, 0x44, 0xA7, 0xE4, 0x96, 0x1C, 0x7F, 0x61, 0xE3, 0x2F, 0x23, 0x8A, 0xEC, 0xD9, 0x05,
+    0xB3, 0x4F, 0xDE, 0x9A, 0x0D, 0xF8, 0x7D, 0xE4, 0x3B, 0x1B, 0x57, 0xC5, 0x7E, 0xB5, 0xA8, 0x29,
+    0xDE, 0xC6, 0x99, 0xFB, 0x89, 0x4A, 0x31, 0xDB, 0xB2, 0x64, 0xB7, 0x89, 0x6F, 0xA9, 0xB8, 0x48,
+    0xE5, 0x87, 0xD9, 0x1C, 0x24, 0xBB, 0x33, 0xB4, 0xB5, 0xDB, 0x64, 0x34, 0x65, 0x31, 0xD7, 0xDB,
+    0xB3, 0x5B, 0xAB, 0x33, 0xAA, 0x57, 0x73, 0x69, 0x64, 0xC7, 0xE5, 0xC6, 0x70, 0x30, 0x21, 0xA3,
+    0x10, 0xFB, 0x33, 0xA9, 0x09, 0xEC, 0x6C, 0x09, 0x37, 0x4F, 0x75, 0xEF, 0xB7, 0xFE, 0x9F, 0x6E,
+    0xC7, 0xFF, 0x6B, 0x26, 0x2F, 0x3F, 0x7F, 0x02, 0xB5, 0x55, 0xB1, 0x8E, 0xDD, 0x54, 0x10, 0x1D,
+    0xFB, 0x6A, 0xD7, 0xC5, 0x2D, 0xDC, 0x80, 0x22, 0x58, 0x09, 0xFF, 0x41, 0x4C, 0x49, 0x81, 0xF6,
+    0xDE, 0x4F, 0x48, 0x03, 0x05, 0xFB, 0x11, 0xFB, 0x03, 0xC9, 0xFA, 0xE5, 0x0B, 0x92, 0x86, 0x9F,
+    0x78, 0x29, 0xB6, 0xA1, 0xA0, 0x78, 0x59, 0x5F, 0x68, 0x52, 0x6C, 0x81, 0x1B, 0x2A, 0x1A, 0x17,
+    0xE9, 0x63, 0x45, 0x46, 0xF2, 0x2E, 0xB6, 0x87, 0x73, 0xC6, 0x59, 0x16, 0x05, 0x24, 0x88, 0x04,
+    0x96, 0x75, 0xDE, 0xBB, 0x63, 0xDF, 0x3B, 0x33, 0x67, 0xCE, 0x8C, 0x45, 0x70, 0x65, 0xAA, 0xC9,
+    0x4D, 0x5E, 0x57, 0x09, 0xC3, 0x91, 0xC6, 0x5C, 0x53, 0x3E, 0x4B, 0xF5, 0xB3, 0xF8, 0x41, 0x66,
+    0x91, 0x3A, 0x15, 0x9D, 0x48, 0x2B, 0xA7, 0x22, 0xF9, 0x9C, 0x0D, 0x02, 0x73, 0xB9, 0xA3, 0xF9,
+    0x80, 0xAD, 0xAD, 0xE2, 0x59, 0x8E, 0xFD, 0x34, 0x07, 0x33, 0x37, 0x34, 0x8B, 0xDA, 0xDB, 0x0B,
+    0xCD, 0xB9, 0x1D, 0xE2, 0x66, 0x9A, 0xFD, 0x04, 0xB3, 0x94, 0xA3, 0xF8, 0x11, 0x58, 0xA8, 0x4A,
+    0x35, 0xD6, 0x0A, 0x6F, 0x13, 0x03, 0x39, 0x8E, 0x52, 0xAB, 0x62, 0x19, 0x80, 0x93, 0x1C, 0xE9,
+    0x5E, 0x71, 0xE4, 0x41, 0x78, 0xE4, 0x5F, 0x71, 0x36, 0x9C, 0xDE, 0xC7, 0x6C, 0x34, 0x1C, 0x88,
+    0xB9, 0xA1, 0x33, 0x44, 0x16, 0x40, 0x9F, 0x88, 0xA5, 0x61, 0x1D, 0x81, 0x5F, 0xB4, 0x02, 0x6C,
+    0x18, 0x5D, 0x6C, 0x47, 0xA9, 0x74, 0x6E, 0x3A, 0xF8, 0x9F, 0x3F, 0x61, 0x40, 0xE2, 0x15, 0x09,
+    0xB7, 0x0B, 0xF2, 0xC4, 0x26, 0x64, 0xD9, 0x8C, 0x60, 0xAB, 0x13, 0x87, 0xB8, 0x02, 0x42, 0x3E,
+    0x9D, 0xC5, 0xBD, 0x49, 0xE2, 0x7E, 0xEA, 0xE4, 0x31, 0x4E, 0x78, 0x7C, 0x25, 0xE5, 0xB3, 0x24,
+    0xC5, 0xAB, 0x41, 0x46, 0x2C, 0x0F, 0x41, 0x6A, 0x78, 0xF2, 0x3F, 0x4E, 0xAE, 0x07, 0x13, 0x87,
+    0x2A, 0x7D, 0xE9, 0x3B, 0x29, 0x77, 0xB3, 0x4F, 0x2F, 0x11, 0xAC, 0xEF, 0x26, 0xDF, 0x63, 0x19,
+    0x4A, 0xB9, 0x10, 0x19, 0xDD, 0xDB, 0xA1, 0xC0, 0x32, 0xD6, 0x4F, 0x10, 0x0F, 0x92, 0x40, 0x4D,
+    0x06, 0xA9, 0x62, 0x39, 0x49, 0xB0, 0x3C, 0x22, 0x96, 0x35, 0x73, 0x09, 0xE2, 0x46, 0x79, 0x28,
+    0x6E, 0x2A, 0xC0, 0x94, 0x00, 0x5A, 0xD2, 0x8F, 0x1A, 0x34, 0xDA, 0xE3, 0xE7, 0x5A, 0x17, 0x64,
+    0x31, 0x3D, 0x80, 0xC7, 0x93, 0x11, 0xC4, 0x33, 0x3D, 0x96, 0xA0, 0x18, 0xFE, 0x79, 0x01, 0xDA,
+    0x91, 0x30, 0x6B, 0xA0, 0x92, 0xAF, 0xFB, 0xFD, 0x8B, 0xE1, 0x03, 0x0F, 0x60, 0xC1, 0xAD, 0xAC,
+    0x9E, 0x61, 0x0D, 0x99, 0x29, 0xE3, 0xE8, 0x91, 0x98, 0x48, 0x9E, 0x0B, 0x02, 0x63, 0xCC, 0xED,
+    0xEB, 0x13, 0x9E, 0x8F, 0xA0, 0x53, 0x01, 0x16, 0x43, 0x5F, 0x82, 0xE5, 0x72, 0xA8, 0x3A, 0xEE,
+    0x0E, 0xD8, 0x51, 0x4C, 0xD4, 0x92, 0x9B, 0x43, 0x24, 0x36, 0x91, 0x62, 0x7A, 0x1F, 0x61, 0xE7,
+    0x3B, 0x13, 0xDF, 0x77, 0x63, 0xE0, 0xDE, 0xA1, 0xE2, 0x39, 0x3D, 0xE4, 0x45, 0xD5, 0x2E, 0x2C,
+    0x69, 0xAE, 0x5D, 0x01, 0x47, 0x8D, 0xEA, 0xC8, 0x6A, 0x52, 0x4F, 0xF2, 0xCD, 0x73, 0x33, 0xE0,
+    0x3A, 0x37, 0xFC, 0xA1, 0xB9, 0xDD, 0xBF, 0x58, 0x29, 0x77, 0x09, 0x91, 0xF9, 0x94, 0x1D, 0xA4,
+    0x4A, 0x96, 0x99, 0xD5, 0xF2, 0x3F, 0x3C, 0x40, 0x68, 0xD5, 0x6B, 0x48, 0x0D, 0xBA, 0xBA, 0x06,
+    0x59, 0x81, 0x2A, 0x83, 0xFC, 0x55, 0xD7, 0xD8, 0x22, 0xA0, 0xAC, 0x49, 0xE7, 0x33, 0x76, 0x87,
+    0x0E, 0xBB, 0x56, 0x36, 0x4C, 0x8F, 0x3F, 0x57, 0x77, 0x7F, 0x16, 0xB6, 0x67, 0x42, 0x86, 0x63,
+    0xBE, 0x9C, 0xAD, 0x2C, 0x17, 0xD2, 0x5C, 0xA3, 0xB9, 0xA0, 0xCF, 0xBF, 0xFB, 0xD3, 0x31, 0xE5,
+    0x91, 0x0C, 0x44, 0xD9, 0xAE, 0x63, 0x6C, 0x41, 0x7D, 0x56, 0xA9, 0x6E, 0xCE, 0xE6, 0x6C, 0x85,
+    0xB2, 0x10, 0x6B, 0x99, 0x40, 0xD6, 0x29, 0xEA, 0x29, 0xDF, 0x71, 0xAF, 0x60, 0xC5, 0xE0, 0x11,
+    0x2E, 0x0E, 0xB0, 0x1E, 0xCB, 0x78, 0x5C, 0xF1, 0x87, 0x89, 0x75, 0x62, 0xB3, 0x5B, 0x39, 0xC5,
+    0xAD, 0xD6, 0x33, 0x51, 0x3E, 0xF2, 0x7A, 0x7B, 0xD9, 0x7B, 0xD3, 0x91, 0x42, 0x96, 0xF2, 0xF1,
+    0xA3, 0x8D, 0x72, 0xD3, 0xD6, 0xF5, 0xED, 0xE5, 0xED, 0xE5, 0x5B, 0x0E, 0x86, 0xC3, 0x01, 0xF4,
+    0xD4, 0x0F, 0x59, 0xAE, 0x57, 0xD1, 0x0F, 0x59, 0xB7, 0x85, 0x4B, 0xCE, 0xB6, 0xE8, 0x8D, 0xB1,
+    0x0F, 0x36, 0x32, 0x49, 0x4B, 0x15, 0x52, 0x44, 0xDB, 0xEB, 0xE0, 0x74, 0x6D, 0x89, 0x8B, 0x5F,
+    0x48, 0x06, 0x0B, 0x80, 0xEE, 0x47, 0xB4, 0xC1, 0xB2, 0x7A, 0x69, 0x89, 0x60, 0x6B, 0x95, 0xD0,
+    0x79, 0x60, 0x19, 0x6D, 0x06, 0x55, 0x73, 0xF0, 0xB9, 0x09, 0x2D, 0x8C, 0xAC, 0x2B, 0xF2, 0xB6,
+    0xD6, 0x3C, 0xBD, 0x79, 0x42, 0x0C, 0xE6, 0x89, 0x5A, 0x7B, 0xE7, 0x9A, 0x13, 0x46, 0x6C, 0xB6,
+    0x88, 0x7C, 0x6E, 0x2F, 0x5E, 0x5C, 0x59, 0x84, 0x36, 0xDB, 0x9A, 0x9E, 0xF8, 0xE9, 0xC6, 0xFD,
+    0x7E, 0xBF, 0xB3, 0xB1, 0x4B, 0xF2, 0xCE, 0xEC, 0x84, 0xC2, 0x1E, 0x9F, 0xFD, 0xCA, 0x64, 0x54,
+    0x6F, 0xC0, 0xDA, 0x9B, 0xDF, 0x34, 0xF9, 0xA9, 0xE8, 0xAB, 0xA1, 0xEE, 0x8A, 0x1E, 0xBD, 0xB0,
+    0x2B, 0xFA, 0x6C, 0x69, 0xF8, 0xE6, 0xDA, 0x12, 0xF5, 0x4F, 0xB8, 0x36, 0x11, 0xB8, 0x84, 0xC4,
+    0x37, 0x2B, 0x0C, 0x12, 0x3F, 0xFA, 0xB5, 0xE8, 0x9B, 0x2E, 0xB3, 0x5E, 0x96, 0x13, 0x2B, 0x82,
+    0xF8, 0xFE, 0xDE, 0x57, 0x75, 0xB3, 0x75, 0x25, 0x23, 0xD9, 0xEF, 0xE9, 0x76, 0x76, 0x3A, 0xD7,
+    0x3A, 0x39, 0x9D, 0x8E, 0x41, 0x1D, 0x7A, 0xAC, 0xDD, 0x09, 0x32, 0x08, 0x1D, 0x6B, 0x5E, 0x0E,
+    0xC6, 0xC9, 0x5C, 0x72, 0xE0, 0x2F, 0x35, 0xD9, 0xD0, 0x8B, 0x7B, 0x1E, 0xEA, 0xE1, 0x9E, 0x8D,
+    0xCD, 0x72, 0x45, 0x55, 0x64, 0x53, 0xCB, 0x56, 0x1D, 0xD8, 0xA4, 0x65, 0x62, 0x9B, 0xD7, 0x3B,
+    0xB6, 0x7C, 0x23, 0x6E, 0xE1, 0x04, 0x87, 0x74, 0xB8, 0x6C, 0xBB, 0x06, 0xC9, 0xB2, 0x46, 0xA9,
+    0xD4, 0x15, 0x73, 0xAC, 0xA0, 0x52, 0x46, 0x44, 0xF7, 0x14, 0xD3, 0xF8, 0xC1, 0xD6, 0x37, 0xAD,
+    0x6C, 0x5F, 0x12, 0x96, 0xDC, 0xDB, 0xC4, 0xC1, 0xFA, 0xBF, 0x7F, 0xB0, 0x7E, 0xFB, 0x75, 0xDB,
+    0x55, 0x36, 0x18, 0x7E, 0x31, 0xB4, 0x9C, 0xF8, 0x29, 0x13, 0x93, 0xCB, 0x5D, 0x89, 0x39, 0x8A,
+    0x79, 0x7D, 0x6F, 0xF8, 0x99, 0x61, 0x1E, 0xD1, 0xCA, 0xB8, 0xC1, 0x2A, 0xEE, 0xF3, 0x4E, 0xCE,
+    0xED, 0xA3, 0xD3, 0xB0, 0x6B, 0x70, 0xA3, 0xAF, 0x70, 0x57, 0x89, 0xB7, 0x99, 0x31, 0x11, 0x60,
+    0x76, 0x13, 0xCD, 0xE0, 0x8E, 0x4F, 0x6E, 0xBE, 0x52, 0x93, 0xC0, 0x6C, 0xC3, 0x92, 0x2E, 0x62,
+    0x65, 0xEE, 0x1A, 0xB9, 0xEB, 0x3E, 0xBE, 0xCD, 0x02, 0xDE, 0x9B, 0xA9, 0xE7, 0x77, 0x9F, 0xE1,
+    0x92, 0xE5, 0xFE, 0xD7, 0xD7, 0xEF, 0xC5, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xB6, 0xB5,
+    0x6B, 0x84, 0x8B, 0xA1, 0x00, 0xA5, 0x88, 0x90, 0xF9, 0x05, 0xEB, 0x5F, 0xC0, 0xDA, 0xF9, 0x07,
+    0x5B, 0xE4, 0x6D, 0x8A, 0x2D, 0xD2, 0x23, 0x21, 0x1A, 0x4A, 0xB4, 0x36, 0x35, 0x05, 0x5B, 0x90,
+    0x9A, 0x2A, 0xCD, 0x36, 0x69, 0x53, 0x84, 0x67, 0x23, 0x4A, 0x1A, 0xA7, 0xA0, 0x4A, 0x63, 0x04,
+    0x1D, 0x45, 0x46, 0xC8, 0x22, 0xDE, 0xC5, 0xE3, 0xCB, 0x39, 0xD7, 0xDE, 0x5D, 0x42, 0x47, 0x03,
+    0xD6, 0x9B, 0xF1, 0x78, 0x3E, 0xCE, 0x9C, 0x7B, 0xEF, 0xB9, 0xF7, 0xD5, 0xDA, 0xB7, 0xDA, 0xA9,
+    0x3E, 0x53, 0x5F, 0xEA, 0x50, 0xEB, 0xCB, 0xBA, 0x8B, 0xDA, 0x26, 0xD2, 0x2A, 0x1B, 0xC4, 0x75,
+    0x52, 0x34, 0xF1, 0x24, 0x89, 0x17, 0x7C, 0xED, 0x45, 0x66, 0xC1, 0x57, 0xD1, 0x48, 0x29, 0xF8,
+    0xFA, 0x2F, 0x37, 0x2C, 0x4F, 0x1F, 0x5D, 0x9D, 0x3E, 0x1B, 0x73, 0x5D, 0x9F, 0xDF, 0xB6, 0xF7,
+    0x54, 0x6F, 0xEC, 0xBF, 0xD2, 0xD9, 0xE9, 0x94, 0xEB, 0x78, 0x6F, 0x96, 0xFB, 0x93, 0xE4, 0xE3,
+    0x2D, 0xC4, 0x2D, 0xF6, 0xFF, 0x3D, 0xB1, 0x99, 0x90, 0x6E, 0xD4, 0xE7, 0x76, 0x1B, 0x74, 0x62,
+    0x4F, 0x34, 0xAF, 0x6F, 0xC9, 0xB7, 0x09, 0xB9, 0x99, 0x70, 0xCD, 0x36, 0x98, 0xB6, 0x77, 0x56,
+    0x6D, 0x83, 0x8F, 0x6A, 0xE0, 0x88, 0x00, 0x09, 0x4B, 0xED, 0xA5, 0x62, 0xFE, 0x85, 0xB4, 0x72,
+    0xD3, 0x3F, 0xB7, 0xFE, 0x73, 0xEB, 0xE5, 0xED, 0xFE, 0x29, 0x21, 0x5A, 0x5D, 0xAC, 0xD7, 0x9E,
+    0xF3, 0x85, 0x67, 0x9F, 0x10, 0x49, 0x62, 0xA2, 0x1A, 0xA5, 0xD6, 0x78, 0xDC, 0x8C, 0x13, 0xEB,
+    0xB3, 0x11, 0xFD, 0xAE, 0x45, 0x6C, 0x40, 0xBF, 0x92, 0x42, 0xF5, 0xD7, 0x8D, 0x50, 0xAD, 0x5E,
+    0x62, 0x6A, 0x09, 0x28, 0x0A, 0x29, 0x01, 0xF8, 0x00, 0x4A, 0x02, 0xB2, 0x94, 0x0D, 0x41, 0xC5,
+    0x0D, 0x46, 0x01, 0xD7, 0x14, 0xB4, 0x73, 0x91, 0x7F, 0x2E, 0x82, 0x19, 0x17, 0x55, 0x1B, 0x2E,
+    0xAA, 0x86, 0x75, 0xB1, 0xED, 0xEC, 0x64, 0x32, 0xAD, 0x27, 0xDB, 0xF5, 0x64, 0xDE, 0xD9, 0x62,
+    0xEA, 0x6D, 0x31, 0x9A, 0xD7, 0xC5, 0x65, 0x5D, 0x6C, 0x2B, 0x2C, 0x86, 0x53, 0x6D, 0x9C, 0xE9,
+    0xA6, 0xAA, 0x29, 0x9B, 0x2B, 0x29, 0x75, 0x7A, 0x9B, 0x6D, 0x23, 0x11, 0x89, 0x1A, 0x2F, 0xA3,
+    0x61, 0x94, 0x8C, 0xDE, 0xDD, 0xD4, 0xF5, 0x4E, 0x48, 0xAA, 0xA7, 0xBB, 0x3C, 0xA6, 0xEA, 0x01,
+    0xBB, 0x8A, 0x0E, 0xBB, 0xCA, 0x06, 0xBB, 0x96, 0x98, 0xBA, 0xC5, 0x94, 0x1B, 0x30, 0x55, 0x57,
+    0xAD, 0xA4, 0x73, 0x1C, 0x76, 0xFA, 0x3D, 0x23, 0x0D, 0x2B, 0x16, 0xB9, 0x7B, 0xA2, 0x56, 0x2F,
+    0xE8, 0xBA, 0x20, 0xF9, 0xD5, 0x99, 0x56, 0x79, 0x23, 0x75, 0x9F, 0x57, 0x92, 0xFB, 0x1C, 0xF7,
+    0x8C, 0x4E, 0xCC, 0xCB, 0xEB, 0xB5, 0x51, 0x58, 0xBB, 0x9C, 0xBB, 0x1D, 0x61, 0xDE, 0xBD, 0xBC,
+    0x0C, 0xB7, 0x0B, 0xB7, 0xFB, 0x92, 0xE9, 0x43, 0xD2, 0x2E, 0xE9, 0xC2, 0x1A, 0x78, 0x5D, 0x39,
+    0x1E, 0x2A, 0xF9, 0xCE, 0x72, 0xA8, 0xB8, 0x4D, 0x3E, 0x78, 0x78, 0x77, 0x7F, 0x0E, 0x07, 0xC4,
+    0xC0, 0xCB, 0xAC, 0xE9, 0x28, 0x8F, 0x47, 0x71, 0x01, 0x4C, 0x00, 0xE5, 0x46, 0xEA, 0xC0, 0x42,
+    0x1C, 0x03, 0xA0, 0xA3, 0x1C, 0xCA, 0x2E, 0xA3, 0xC5, 0x92, 0x4E, 0xE8, 0x69, 0x88, 0x62, 0x43,
+    0x59, 0x89, 0x99, 0x4F, 0xB5, 0x66, 0x1E, 0x30, 0x9E, 0xA4, 0x62, 0xD3, 0x23, 0xED, 0xBF, 0x54,
+    0x93, 0xB2, 0x79, 0x08, 0xF1, 0xC9, 0x7C, 0x3A, 0x92, 0x6B, 0x3C, 0x47, 0x8B, 0x85, 0x1D, 0x08,
+    0x1D, 0x37, 0x16, 0x1D, 0xD5, 0xC4, 0x2B, 0x00, 0x2B, 0x79, 0x8F, 0x2B, 0x40, 0x20, 0x47, 0x38,
+    0xAB, 0x44, 0x2F, 0x3E, 0x1B, 0x52, 0xD8, 0x5C, 0xAA, 0x0E, 0x8C, 0x53, 0xC4, 0x58, 0x99, 0x07,
+    0x77, 0xF6, 0xBA, 0x8F, 0x79, 0x1A, 0x09, 0xD7, 0x2C, 0x8F, 0x82, 0xC4, 0xC1, 0x92, 0xAD, 0x42,
+    0xEA, 0xA5, 0x9E, 0xC3, 0x96, 0x59, 0x98, 0xDD, 0x0D, 0x13, 0xAB, 0x0A, 0xC5, 0x10, 0x53, 0xE3,
+    0xD7, 0x2D, 0xE2, 0x6E, 0x89, 0x93, 0x19, 0x6C, 0x88, 0xCD, 0x54, 0x6C, 0x48, 0x47, 0x0E, 0xD5,
+    0xC0, 0x3A, 0x22, 0xB0, 0x1E, 0xC1, 0x1B, 0x49, 0x80, 0x0A, 0xC1, 0xA7, 0x1C, 0xA0, 0xED, 0x9F,
+    0x2F, 0x8C, 0xC2, 0xC1, 0x09, 0xCF, 0x0F, 0x82, 0xAC, 0xEE, 0x60, 0xFE, 0x0C, 0x35, 0xB8, 0x3E,
+    0x1E, 0x91, 0xEF, 0x07, 0x4C, 0x7E, 0x26, 0xBE, 0x44, 0x8F, 0x07, 0x50, 0x5D, 0x10, 0xBF, 0xD7,
+    0x03, 0x30, 0xF6, 0xA8, 0x07, 0xD9, 0x00, 0x86, 0x7B, 0xA9, 0x11, 0xAE, 0x24, 0xA4, 0xFA, 0x4D,
+    0xA1, 0x6F, 0xB4, 0x6B, 0x43, 0xEE, 0xE5, 0xA1, 0xBC, 0x67, 0x16, 0xA2, 0x3D, 0xA2, 0xD8, 0x3C,
+    0x38, 0xC2, 0x67, 0x67, 0x93, 0x95, 0x83, 0xEF, 0x98, 0x2B, 0x74, 0x2C, 0x08, 0x67, 0xF0, 0x5F,
+    0xE2, 0xDB, 0x49, 0x16, 0xC8, 0xB2, 0xBE, 0x3A, 0x0B, 0xC5, 0x20, 0xF5, 0x8F, 0x5E, 0xD2, 0x3F,
+    0xC0, 0x7E, 0xC1, 0xBD, 0xC5, 0xEB, 0x4E, 0xB2, 0x37, 0x90, 0x78, 0x60, 0xD6, 0x22, 0x60, 0xE5,
+    0xD7, 0xD0, 0xE7, 0xCB, 0x40, 0xA1, 0x40, 0xBD, 0x09, 0x43, 0x5F, 0x80, 0xBB, 0x7C, 0xB2, 0xD6,
+    0x13, 0x94, 0x83, 0x0A, 0xEA, 0x06, 0xB5, 0x6C, 0x4A, 0x3C, 0x92, 0xC9, 0x0B, 0x1B, 0xC7, 0xD8,
+    0xFC, 0xE7, 0x80, 0x03, 0x3E, 0xF1, 0xF7, 0x38, 0xB7, 0xA0, 0x9D, 0x6F, 0x2D, 0x24, 0x3E, 0x9D,
+    0x11, 0x05, 0xDF, 0x6E, 0xE1, 0xC1, 0xFB, 0x77, 0xD6, 0xB5, 0xFA, 0x49, 0x2B, 0x41, 0x5E, 0x24,
+    0x63, 0xE4, 0x5D, 0x9F, 0x34, 0x65, 0xF5, 0x0E, 0x3E, 0x19, 0x04, 0x71, 0x48, 0x37, 0x0A, 0xE8,
+    0xEF, 0x9F, 0x0D, 0xFC, 0x38, 0xD3, 0x60, 0x56, 0x0E, 0x66, 0x3D, 0x7A, 0x89, 0xF6, 0xA7, 0xE0,
+    0xEE, 0xE4, 0x1C, 0x1A, 0xEA, 0x60, 0x74, 0xE4, 0x53, 0xF0, 0xFD, 0x22, 0x82, 0x85, 0x47, 0x9C,
+    0x74, 0xCC, 0x9E, 0xA4, 0x87, 0x33, 0x23, 0xCF, 0x6C, 0x78, 0x0E, 0x97, 0xCA, 0xC7, 0x2C, 0xA1,
+    0x85, 0x69, 0xE0, 0xE2, 0x30, 0x88, 0x15, 0x5B, 0xA2, 0x29, 0xFE, 0x4A, 0xC4, 0xFD, 0xE0, 0xE9,
+    0x36, 0x3A, 0x73, 0x3E, 0x42, 0x77, 0x94, 0x82, 0x47, 0xFA, 0x80, 0xC9, 0xDE, 0x4B, 0x74, 0x02,
+    0x49, 0xF0, 0xEA, 0x80, 0x3A, 0x33, 0xE7, 0x4D, 0x32, 0xCE, 0x92, 0xFD, 0x02, 0x39, 0x7E, 0xFB,
+    0xD3, 0x6E, 0x0F, 0xB3, 0xAE, 0x01, 0xF2, 0x0A, 0x04, 0xA0, 0x0C, 0x5E, 0x64, 0xFC, 0xD1, 0x52,
+    0x7D, 0xF2, 0x29, 0x33, 0x20, 0x65, 0x35, 0xDC, 0x55, 0x08, 0x3D, 0x95, 0x01, 0x71, 0xD7, 0xC8,
+    0x94, 0x48, 0x1F, 0xE8, 0x94, 0xCD, 0x51, 0x8D, 0x13, 0xE7, 0x27, 0x72, 0x0C, 0x7F, 0xD2, 0x84,
+    0x64, 0x28, 0x58, 0xA1, 0x5D, 0x03, 0xFB, 0xC5, 0x1F, 0x33, 0x98, 0xF1, 0xF5, 0xC2, 0xF8, 0x3A,
+    0x13, 0xA5, 0xEC, 0xF3, 0x95, 0xE9, 0x31, 0xEC, 0x80, 0xB3, 0x26, 0x38, 0x09, 0x21, 0x19, 0x60,
+    0x9A, 0xEB, 0x5D, 0x03, 0x77, 0x29, 0xB0, 0xCA, 0xCA, 0x21, 0xF7, 0x9A, 0xBA, 0xC1, 0x45, 0xF8,
+    0x7D, 0x79, 0xC2, 0x9B, 0xDF, 0x97, 0x7F, 0xF3, 0xFC, 0x05, 0xB5, 0x55, 0x3D, 0x8F, 0xDD, 0x54,
+    0x10, 0x3D, 0xB6, 0xB5, 0x71, 0xE1, 0xE2, 0x52, 0x64, 0xAB, 0x14, 0xA6, 0x46, 0x5A, 0xDC, 0x50,
+    0x50, 0x84, 0xF8, 0x2A, 0x14, 0xB4, 0x5B, 0xB0, 0x50, 0xD2, 0x53, 0xF0, 0xFE, 0x40, 0x88, 0x2D,
+    0x51, 0xD0, 0x6E, 0x41, 0xC8, 0x4F, 0x40, 0xA2, 0x09, 0x05, 0x0D, 0xD2, 0xB2, 0x76, 0x12, 0x09,
+    0x8A, 0x2D, 0x30, 0x89, 0x10, 0x65, 0x8C, 0x40, 0x48, 0x54, 0xB1, 0xC0, 0x12, 0xCE, 0x62, 0x7B,
+    0x38, 0xE7, 0xBE, 0xB7, 0x52, 0x02, 0x4D, 0xC4, 0x87, 0xF5, 0x34, 0xD7, 0x3A, 0x6F, 0xEE, 0xDC,
+    0x99, 0x33, 0x67, 0xAE, 0xB1, 0xEF, 0x51, 0x59, 0x5B, 0x98, 0x25, 0x7D, 0x36, 0xBD, 0x82, 0xA2,
+    0x46, 0x34, 0x01, 0x05, 0x90, 0xF6, 0x68, 0x66, 0x64, 0x36, 0x20, 0x6A, 0x5A, 0x60, 0x06, 0xDC,
+    0x03, 0x8F, 0xE5, 0x04, 0xEE, 0x9B, 0x3E, 0x9D, 0x2A, 0x5B, 0x23, 0x33, 0x8F, 0x23, 0xA0, 0x31,
+    0xDF, 0xD8, 0x46, 0x31, 0xDA, 0x8A, 0xC1, 0xE0, 0x5A, 0x14, 0x6D, 0x32, 0xA0, 0x18, 0xB8, 0xA9,
+    0x98, 0x51, 0xA2, 0x10, 0x58, 0xE6, 0x04, 0xCB, 0x94, 0x60, 0x19, 0x11, 0xBC, 0x29, 0xCF, 0x15,
+    0x04, 0x57, 0x10, 0x5C, 0x21, 0x10, 0x04, 0x9B, 0x05, 0xB6, 0x84, 0x98, 0x1E, 0x07, 0x78, 0x19,
+    0xC8, 0x6B, 0x46, 0x4C, 0x06, 0x46, 0x84, 0xBD, 0xCD, 0xDC, 0x32, 0xA3, 0xC1, 0xFE, 0x21, 0x9E,
+    0x7A, 0xFE, 0xC7, 0x1C, 0x80, 0xBD, 0xD8, 0x16, 0xAC, 0x64, 0xC2, 0xCD, 0xD1, 0x82, 0xD3, 0xC3,
+    0x64, 0x48, 0x3B, 0x06, 0xBB, 0x06, 0x94, 0x11, 0x93, 0x9A, 0x9D, 0x47, 0x72, 0x2E, 0x7E, 0xC8,
+    0x15, 0xCA, 0x37, 0x02, 0xD4, 0x31, 0x63, 0x26, 0xE1, 0xDA, 0xA2, 0x65, 0xC8, 0xB2, 0x66, 0x1A,
+    0x95, 0x2F, 0x18, 0xF1, 0x3A, 0x63, 0x35, 0x35, 0xA3, 0x5E, 0x06, 0x09, 0xB4, 0x59, 0x66, 0xC2,
+    0x95, 0xEF, 0xAA, 0x1A, 0x69, 0x5B, 0xFA, 0xA7, 0x4C, 0x56, 0xD3, 0xB8, 0x60, 0xBC, 0x0C, 0x68,
+    0x72, 0x99, 0x42, 0xE6, 0x35, 0x9A, 0x17, 0x4F, 0x68, 0xAA, 0x91, 0xE1, 0xAB, 0x21, 0xB6, 0xB9,
+    0x6A, 0x33, 0x9B, 0xF7, 0x45, 0x47, 0xC9, 0x6C, 0xAA, 0xA9, 0x5C, 0xC9, 0xD8, 0x98, 0x18, 0x0F,
+    0xAA, 0x93, 0xC7, 0x5E, 0xBF, 0x47, 0x6D, 0xFA, 0xC8, 0x27, 0xDF, 0x77, 0xEE, 0x1D, 0x9F, 0x3C,
+    0x1C, 0x5C, 0xEE, 0x93, 0x07, 0xE3, 0x01, 0x6D, 0x37, 0x5D, 0x95, 0x3D, 0xF9, 0x5C, 0xB6, 0x1C,
+    0x64, 0x8B, 0x5E, 0x36, 0x6F, 0x65, 0x5D, 0x4D, 0xDB, 0xEF, 0xB1, 0x15, 0x85, 0xA2, 0xCD, 0x8D,
+    0x21, 0x91, 0x25, 0x41, 0x77, 0xAC, 0x2B, 0xAD, 0xAB, 0xEA, 0xA8, 0x01, 0x8B, 0x26, 0x95, 0xA3,
+    0xA8, 0x5C, 0x02, 0x95, 0xA1, 0x13, 0xE7, 0x9F, 0x36, 0x6D, 0xC2, 0x22, 0xC9, 0xEF, 0xD1, 0x5B,
+    0x17, 0xE0, 0x5F, 0x3D, 0x6B, 0x34, 0x68, 0xA8, 0xA8, 0xB5, 0xB1, 0x9A, 0x3F, 0x44, 0x6F, 0x02,
+    0x62, 0x9D, 0xEC, 0xCC, 0x68, 0x7C, 0xD5, 0x93, 0x4B, 0xBB, 0x3E, 0x21, 0x99, 0xD8, 0x9F, 0xE2,
+    0x6B, 0x6A, 0x72, 0x6E, 0xA8, 0x8C, 0x33, 0x71, 0xCD, 0x17, 0x77, 0x26, 0x84, 0x9D, 0xCF, 0xEF,
+    0xD3, 0x67, 0x2C, 0x3B, 0x9E, 0x61, 0x75, 0xD1, 0xA5, 0x66, 0x23, 0xDB, 0x42, 0xBD, 0x5C, 0xFA,
+    0x48, 0x22, 0xE1, 0xB3, 0x91, 0xA9, 0xAB, 0x5B, 0x47, 0xAB, 0xB2, 0x28, 0x6A, 0x66, 0x91, 0xF5,
+    0xCC, 0x22, 0x9E, 0x94, 0xDA, 0xE9, 0x73, 0x82, 0x35, 0xC5, 0xA2, 0x7C, 0xC9, 0x41, 0xAD, 0x31,
+    0x40, 0x74, 0x88, 0xCD, 0x5D, 0x9B, 0x32, 0xC6, 0x9F, 0xAF, 0xD8, 0x93, 0xCD, 0x14, 0x1B, 0xDC,
+    0x90, 0x0D, 0xC8, 0x3B, 0x8E, 0x54, 0x59, 0x9F, 0xF2, 0x78, 0x6E, 0x8C, 0x67, 0x86, 0xC8, 0x06,
+    0x42, 0x85, 0xA0, 0x35, 0x56, 0xBA, 0x84, 0xF2, 0x96, 0x10, 0x85, 0x71, 0xBC, 0xE9, 0x63, 0xB3,
+    0x95, 0x1A, 0x37, 0xB9, 0xB0, 0x95, 0xF4, 0xD2, 0x89, 0xD0, 0xD9, 0x08, 0x50, 0x6C, 0x3F, 0xB1,
+    0xBB, 0x9A, 0xCB, 0xA3, 0x23, 0xC9, 0x53, 0x5C, 0x35, 0x54, 0xB1, 0x59, 0xB4, 0xA4, 0xB3, 0x23,
+    0xAF, 0x5F, 0x22, 0xBB, 0x3F, 0xE0, 0x72, 0xDE, 0x86, 0xED, 0xDA, 0xCD, 0x44, 0x38, 0x10, 0xDC,
+    0xC6, 0x0D, 0x06, 0x50, 0xEF, 0x48, 0xED, 0xD6, 0x7B, 0xE2, 0x27, 0x0E, 0x63, 0xEC, 0x03, 0x3B,
+    0xBC, 0x06, 0xEC, 0xEC, 0x97, 0xE6, 0xDD, 0xDF, 0xFA, 0xBC, 0xBD, 0x31, 0xA5, 0x83, 0x3B, 0x88,
+    0xE6, 0xE4, 0x2B, 0x92, 0x79, 0x0C, 0x05, 0x63, 0xBB, 0xD4, 0x2D, 0x4D, 0x08, 0x9E, 0x05, 0xD8,
+    0x83, 0x4B, 0x26, 0x51, 0x58, 0xCB, 0xD4, 0xEA, 0x66, 0x95, 0x59, 0x32, 0x75, 0x58, 0xB4, 0x75,
+    0xC9, 0xC4, 0x51, 0xA0, 0x67, 0xAE, 0x2A, 0xC3, 0x88, 0xDD, 0xA4, 0x4A, 0x71, 0xA2, 0x8A, 0x98,
+    0x9E, 0xBB, 0x3B, 0xD2, 0x3C, 0x64, 0xB4, 0xF4, 0xC7, 0x8E, 0xE9, 0xFD, 0xC1, 0xD8, 0x51, 0x98,
+    0x3D, 0xC3, 0x8E, 0x03, 0x5D, 0x40, 0x88, 0xE8, 0x06, 0x5D, 0x04, 0x2F, 0x50, 0x0F, 0xF8, 0xA2,
+    0x51, 0x35, 0x8B, 0xBC, 0x08, 0xE1, 0x25, 0x1F, 0xAE, 0x82, 0x3D, 0x2D, 0xD9, 0xAA, 0xD7, 0x4A,
+    0xBC, 0xE9, 0x22, 0xE3, 0xE3, 0x44, 0x26, 0xAE, 0x05, 0x97, 0x00, 0x27, 0x01, 0x56, 0x15, 0xD8,
+    0x90, 0x71, 0xCA, 0x84, 0x9C, 0x47, 0x76, 0xFB, 0x67, 0x6B, 0x5D, 0xEF, 0xEA, 0xAA, 0x3D, 0xA5,
+    0x77, 0xF5, 0xFA, 0x40, 0xEF, 0x95, 0x62, 0xED, 0xE3, 0x99, 0x3A, 0xA8, 0xD3, 0x5F, 0x27, 0xC2,
+    0xF9, 0x59, 0x4F, 0xB8, 0x12, 0x4C, 0xD9, 0x11, 0xCE, 0x7A, 0x93, 0x77, 0xB4, 0x62, 0x4A, 0xC9,
+    0xE8, 0xED, 0x1F, 0x14, 0x4A, 0xE2, 0x23, 0x1B, 0x4A, 0x30, 0x90, 0xB4, 0x3B, 0xF2, 0x6F, 0x99,
+    0xE4, 0xE7, 0xCA, 0xD2, 0x54, 0xEA, 0xDE, 0x11, 0x9B, 0x59, 0x52, 0x53, 0xB3, 0xCC, 0x94, 0xCE,
+    0xEA, 0xF8, 0x1A, 0x18, 0xF3, 0x0C, 0x91, 0xDF, 0x63, 0xA1, 0xD9, 0xEF, 0xAD, 0x44, 0x70, 0xC1,
+    0x0E, 0x87, 0x9B, 0x91, 0x1F, 0x93, 0x36, 0xF7, 0x21, 0xCF, 0x2B, 0xE3, 0x59, 0x5C, 0x19, 0x62,
+    0xDD, 0x0B, 0xC5, 0x56, 0xA3, 0xDB, 0x61, 0x55, 0x7F, 0x3B, 0x36, 0x86, 0xC3, 0x1A, 0xC4, 0x5F,
+    0x7A, 0xF6, 0x86, 0xEB, 0x42, 0x0D, 0x4A, 0xE7, 0xCB, 0x73, 0x82, 0xC7, 0x7B, 0xAB, 0x97, 0x5A,
+    0xD6, 0x30, 0x50, 0xF5, 0x85, 0x36, 0x43, 0x73, 0xF0, 0x7E, 0x28, 0x31, 0x54, 0x2B, 0x6A, 0xF1,
+    0x99, 0x4E, 0x3F, 0xB7, 0xC9, 0xD9, 0xB7, 0x0D, 0xD2, 0x91, 0xA9, 0x39, 0x5D, 0xCC, 0xA5, 0xAE,
+    0x68, 0xDD, 0xB6, 0x89, 0xEE, 0x5D, 0x6A, 0xC3, 0x3E, 0x6E, 0x58, 0x14, 0xA7, 0x1D, 0x77, 0x3E,
+    0x51, 0x37, 0xD5, 0x60, 0xD5, 0xBD, 0x6D, 0x3C, 0x37, 0xF2, 0x5F, 0x76, 0x29, 0xE7, 0x35, 0x67,
+    0x99, 0xDD, 0xB3, 0x27, 0xC6, 0xFB, 0xCD, 0xB1, 0x1E, 0x9F, 0x77, 0x21, 0x6C, 0xB9, 0x0D, 0xFC,
+    0xEF, 0x5F, 0xBC, 0x6B, 0xD3, 0x31, 0x53, 0x69, 0xBB, 0x0A, 0x2F, 0x8E, 0x9C, 0x2A, 0x1E, 0xF8,
+    0x81, 0x8D, 0xE9, 0xC8, 0xCF, 0x40, 0xE5, 0x77, 0xDB, 0xFE, 0xA3, 0x65, 0xDC, 0x7D, 0x21, 0xF4,
+    0x2C, 0xDB, 0x63, 0x97, 0xED, 0xB7, 0x6D, 0xB7, 0x9C, 0x3C, 0xB3, 0xDC, 0xD8, 0x2E, 0x57, 0xB7,
+    0xCB, 0xAB, 0xF8, 0xA7, 0xCF, 0x9F, 0x85, 0x55, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x7D, 0x24, 0x21,
+    0xB1, 0x60, 0xC1, 0x14, 0x56, 0xA5, 0x00, 0xDB, 0xA4, 0x0C, 0x70, 0x4D, 0x8A, 0x34, 0xF6, 0xAE,
+    0x0C, 0x04, 0x29, 0xA3, 0xC2, 0xE7, 0x46, 0x7F, 0x90, 0x22, 0xCA, 0x07, 0x38, 0xE6, 0x3A, 0x5F,
+    0xE0, 0xC6, 0xFF, 0x90, 0xA8, 0x88, 0x7E, 0x20, 0x12, 0xD7, 0x76, 0xE9, 0x86, 0x40, 0x90, 0x9E,
+    0x4D, 0x10, 0x24, 0x6E, 0x58, 0xD0, 0x06, 0xA5, 0x2C, 0x39, 0x79, 0xB3, 0x77, 0x3E, 0x29, 0x06,
+    0x02, 0x2D, 0x6E, 0x0F, 0x9C, 0xD9, 0x9D, 0xD9, 0x9D, 0x37, 0x6F, 0x66, 0x5B, 0x11, 0x9F, 0x8B,
+    0xCC, 0xA8, 0xFE, 0x6A, 0x81, 0x07, 0x59, 0x04, 0xA6, 0x72, 0x40, 0xDE, 0x99, 0x80, 0x0C, 0xCD,
+    0x81, 0x43, 0x26, 0x32, 0xA0, 0x5C, 0xDA, 0x01, 0x26, 0xD4, 0x3D, 0x1A, 0xD4, 0x81, 0xBB, 0x2C,
+    0xB8, 0x2B, 0x52, 0x55, 0xAA, 0xAA, 0x85, 0x11, 0x19, 0x21, 0xB2, 0x20, 0x8D, 0x56, 0x02, 0xCD,
+    0x4E, 0x85, 0x6B, 0x12, 0x1A, 0xF5, 0x41, 0x2B, 0x60, 0xE5, 0x8B, 0x01, 0xA8, 0x7A, 0x1A, 0x22,
+    0x9F, 0x60, 0xBF, 0x72, 0xB8, 0x44, 0x2D, 0xE2, 0xB8, 0x40, 0xFB, 0xB4, 0xD0, 0xEA, 0x02, 0x77,
+    0x73, 0x21, 0xE4, 0x63, 0xB2, 0xF8, 0x35, 0x2D, 0xD8, 0xB4, 0xD0, 0xF8, 0x96, 0xDE, 0xE5, 0x99,
+    0xCC, 0xAD, 0x2C, 0x8E, 0xA6, 0xBB, 0x03, 0x39, 0x3D, 0xCA, 0x11, 0xD0, 0x33, 0x76, 0xF3, 0xDD,
+    0x1A, 0x74, 0xDD, 0x17, 0x72, 0x3E, 0x15, 0x43, 0x16, 0xA9, 0xBB, 0xE0, 0x7C, 0xCA, 0xF9, 0x03,
+    0x27, 0xE5, 0x72, 0x5A, 0x31, 0x40, 0x75, 0x96, 0x1C, 0x31, 0x60, 0x23, 0x23, 0x11, 0x99, 0x6A,
+    0x6F, 0xC6, 0x2F, 0x50, 0xD3, 0x09, 0xA1, 0x80, 0xE5, 0xF2, 0xCC, 0x23, 0x26, 0x2E, 0xF5, 0xF9,
+    0xBA, 0x49, 0x22, 0x8F, 0x78, 0x0E, 0xF3, 0x26, 0x60, 0xB6, 0x9D, 0xE9, 0x1B, 0x11, 0x86, 0xDB,
+    0x61, 0xEF, 0x78, 0x73, 0xA7, 0x35, 0x2A, 0x62, 0xD2, 0x8A, 0xFE, 0x1A, 0x22, 0xDC, 0xF8, 0xBA,
+    0x37, 0x43, 0x31, 0x6A, 0x1C, 0xDE, 0x3A, 0x8B, 0x3C, 0x16, 0x23, 0xE1, 0xAB, 0x83, 0x75, 0x17,
+    0x74, 0x57, 0x5C, 0x9F, 0x77, 0xA8, 0x3B, 0xCB, 0xAD, 0x37, 0x82, 0x5B, 0x54, 0x50, 0x68, 0x74,
+    0x5B, 0x03, 0x86, 0x30, 0x16, 0x74, 0xE0, 0xAC, 0x5B, 0xF5, 0xF5, 0xB0, 0x12, 0x2F, 0x12, 0x2B,
+    0xBD, 0x56, 0x82, 0x3E, 0xFB, 0x99, 0x7F, 0xFB, 0x29, 0x60, 0xBA, 0x59, 0x8E, 0x66, 0x62, 0x5E,
+    0x87, 0x62, 0x54, 0xFC, 0x1C, 0x01, 0x9D, 0x34, 0x67, 0x3D, 0x73, 0xD1, 0x08, 0x73, 0x20, 0x44,
+    0xAD, 0x0E, 0x91, 0xB9, 0xA0, 0xC6, 0x72, 0xA9, 0xEE, 0xB8, 0x27, 0x6A, 0xA0, 0x99, 0x2C, 0xAB,
+    0x6E, 0x25, 0xFD, 0x36, 0x16, 0x64, 0xC4, 0xC0, 0x78, 0x02, 0xCD, 0xC0, 0x05, 0x9B, 0x49, 0xC2,
+    0xE0, 0x09, 0x76, 0xE3, 0x80, 0x3B, 0xA4, 0xE3, 0xC1, 0x1D, 0xC3, 0x7B, 0xC9, 0x3B, 0x7E, 0x13,
+    0x70, 0x69, 0x91, 0x5D, 0xCD, 0xEB, 0x93, 0xB7, 0x22, 0x72, 0xCE, 0x2B, 0x5D, 0xA6, 0xC4, 0x2B,
+    0x77, 0x78, 0x16, 0x51, 0xE5, 0x6C, 0xAE, 0x1E, 0x77, 0x6D, 0x82, 0x6E, 0xC4, 0xDE, 0x23, 0xE0,
+    0x38, 0x73, 0x8C, 0xDB, 0x37, 0xCF, 0x96, 0x8C, 0x81, 0xC3, 0x65, 0x37, 0x27, 0x70, 0xB5, 0x11,
+    0xA7, 0x84, 0x59, 0x20, 0x44, 0x6E, 0x26, 0x86, 0x53, 0x44, 0xF9, 0xE7, 0xBB, 0xF5, 0x29, 0xBD,
+    0x2F, 0x74, 0xF3, 0x7E, 0x4A, 0x04, 0xDB, 0xE5, 0x4C, 0x94, 0x7C, 0x7F, 0x9C, 0x3C, 0x24, 0x4A,
+    0x64, 0x64, 0x87, 0x83, 0xE3, 0xE4, 0x06, 0xA4, 0x33, 0x4A, 0x86, 0x4F, 0x8F, 0x1A, 0x1D, 0xC1,
+    0xC0, 0xF9, 0xF5, 0x99, 0x2B, 0x12, 0x85, 0x77, 0x2A, 0xBD, 0x27, 0xCC, 0xCB, 0x5F, 0x1C, 0x1A,
+    0x2B, 0x1D, 0x1D, 0x48, 0x28, 0x97, 0x23, 0xF1, 0xA6, 0x23, 0x00, 0x9A, 0x0C, 0xEE, 0x62, 0x0E,
+    0x07, 0x30, 0xB3, 0x44, 0xD0, 0xD3, 0x70, 0x51, 0xD5, 0xB4, 0x53, 0x31, 0x65, 0x98, 0x8D, 0x84,
+    0x62, 0x90, 0x4D, 0x0D, 0x24, 0xE7, 0x39, 0x69, 0xBA, 0x91, 0x08, 0x08, 0x2A, 0x9E, 0xB2, 0xA7,
+    0x4C, 0x6E, 0x54, 0xAD, 0x19, 0xC4, 0x67, 0xBC, 0x00, 0x05, 0xD6, 0x9B, 0x22, 0xAD, 0x1B, 0x2C,
+    0xB5, 0x3D, 0x6E, 0x8D, 0x8A, 0xB7, 0x21, 0x75, 0x63, 0x79, 0x75, 0x32, 0xD4, 0x5D, 0x45, 0x76,
+    0x18, 0x26, 0xEE, 0x4B, 0x42, 0xE6, 0x13, 0xB4, 0x5B, 0x86, 0x8E, 0x5B, 0xA4, 0xB7, 0xE2, 0x94,
+    0x6A, 0x85, 0xB6, 0x1A, 0xE2, 0x23, 0xA5, 0x80, 0xA3, 0x93, 0x87, 0x13, 0x84, 0xD9, 0x8D, 0xA4,
+    0xC2, 0x6F, 0xC3, 0x26, 0xD1, 0x97, 0xDF, 0xFE, 0x44, 0xAA, 0x0F, 0xD5, 0xF5, 0x99, 0x5F, 0xF9,
+    0xCD, 0xAD, 0xD5, 0x5E, 0xA7, 0xBC, 0xF8, 0xAE, 0x94, 0x54, 0x24, 0x0E, 0x6B, 0xFA, 0x25, 0xE1,
+    0x59, 0x33, 0x54, 0xF9, 0x29, 0x9B, 0x8C, 0xAB, 0x7E, 0x1C, 0xF1, 0x3D, 0x11, 0x02, 0xE1, 0xAE,
+    0x38, 0x49, 0x0A, 0xAC, 0xB8, 0xD5, 0xC4, 0x4F, 0x61, 0x5E, 0x07, 0xC4, 0x07, 0xA8, 0x5F, 0xB3,
+    0x0A, 0xEC, 0x3F, 0x42, 0x44, 0x7D, 0x72, 0xF1, 0x89, 0x56, 0xAE, 0xED, 0x21, 0x3E, 0xE1, 0xBE,
+    0x1B, 0xA7, 0x63, 0x21, 0xDD, 0x3E, 0x8D, 0x67, 0x8D, 0x84, 0x81, 0xD8, 0xFF, 0xF9, 0x34, 0x42,
+    0x80, 0xC3, 0x1E, 0xEE, 0x59, 0x2F, 0x4D, 0x10, 0xEB, 0x17, 0x7E, 0xEF, 0xDC, 0xEC, 0x2B, 0x6B,
+    0x9C, 0xFA, 0xB1, 0x77, 0xFF, 0x4A, 0x89, 0x35, 0xAB, 0x63, 0x0F, 0x45, 0x44, 0x13, 0x4A, 0x56,
+    0x8E, 0xBF, 0xB9, 0xD0, 0xE1, 0x54, 0x89, 0x3F, 0x9C, 0x58, 0x56, 0xF9, 0xDD, 0x7F, 0xA9, 0x50,
+    0xAB, 0x21, 0x9F, 0x33, 0xF1, 0x6D, 0x97, 0x3F, 0xD7, 0x5E, 0xAA, 0x75, 0xC7, 0x66, 0xC9, 0xB8,
+    0x71, 0xF8, 0xBB, 0xB6, 0x11, 0x3C, 0xD1, 0x46, 0x85, 0x32, 0x68, 0x86, 0xB7, 0x42, 0xE5, 0xAD,
+    0xA2, 0x32, 0x69, 0x31, 0xA1, 0x76, 0x44, 0xCA, 0x61, 0x28, 0x06, 0x96, 0xA6, 0x49, 0xCD, 0x31,
+    0x1F, 0xB4, 0x79, 0xE1, 0xBE, 0x0A, 0xAF, 0xAA, 0xA0, 0x02, 0xB9, 0x43, 0xB2, 0x7D, 0x2D, 0x84,
+    0x5A, 0xFA, 0x46, 0x33, 0xDC, 0x67, 0xC7, 0xDB, 0xDE, 0x78, 0x44, 0x52, 0x57, 0x32, 0x68, 0x22,
+    0x08, 0xB3, 0xD9, 0xD0, 0x21, 0x26, 0x72, 0xD4, 0xE1, 0x63, 0xE1, 0xEC, 0x4C, 0x52, 0x15, 0x2B,
+    0xD9, 0xED, 0x8B, 0xC7, 0x31, 0x5B, 0xD2, 0x4A, 0x39, 0xA4, 0x6D, 0x36, 0x09, 0xC5, 0x46, 0x78,
+    0x9A, 0x84, 0xD5, 0x2B, 0x21, 0x28, 0x32, 0xB6, 0xEC, 0xCA, 0x32, 0xDD, 0xAA, 0x55, 0xE4, 0x9B,
+    0x02, 0x4B, 0x19, 0xD5, 0x82, 0xDC, 0x14, 0x55, 0xDE, 0xFE, 0x4D, 0x8E, 0x5B, 0x5E, 0xF0, 0xB6,
+    0xF6, 0xC3, 0xE7, 0xFE, 0x15, 0x3F, 0xDF, 0xD0, 0x8F, 0x62, 0x45, 0xF2, 0x10, 0x3B, 0x64, 0x8B,
+    0x96, 0x80, 0x96, 0x13, 0x52, 0xC1, 0xA5, 0x4F, 0x77, 0xE7, 0x27, 0xCB, 0x6E, 0x25, 0xAF, 0x25,
+    0x16, 0x8A, 0x79, 0xAE, 0x50, 0x1B, 0xFD, 0xD3, 0x46, 0xA9, 0x6D, 0x3D, 0x71, 0x3A, 0xC1, 0x5D,
+    0xE3, 0xBF, 0xE3, 0x1E, 0x1B, 0x77, 0xC1, 0x77, 0x21, 0xD8, 0xA1, 0x1C, 0xF3, 0x2B, 0x36, 0x4E,
+    0x1A, 0x5A, 0x30, 0xB6, 0x58, 0x06, 0x9A, 0xDC, 0xA7, 0xC9, 0x5B, 0xAD, 0x49, 0x8D, 0x6F, 0x36,
+    0xAA, 0x22, 0x1E, 0xB5, 0x66, 0xD0, 0x6A, 0x57, 0x8C, 0x3C, 0x83, 0xAF, 0x0D, 0xDB, 0xE8, 0x9C,
+    0xCF, 0xF4, 0x95, 0xA7, 0xDE, 0xFC, 0xA1, 0x95, 0x6A, 0x9C, 0x48, 0x21, 0x27, 0x62, 0x55, 0x09,
+    0x32, 0xED, 0xAB, 0x9B, 0x76, 0x83, 0xCF, 0xF1, 0xF1, 0xC8, 0x65, 0xCE, 0xF5, 0xC1, 0x63, 0x2A,
+    0xE9, 0x34, 0xBD, 0xBE, 0x3C, 0x86, 0xD9, 0x6A, 0x35, 0xF5, 0xAD, 0x52, 0xE1, 0x42, 0x95, 0x51,
+    0x1F, 0xE7, 0x68, 0xA8, 0x8C, 0x74, 0x35, 0x4F, 0xBA, 0x73, 0xD2, 0x17, 0x7B, 0x22, 0x20, 0x24,
+    0x63, 0x7A, 0xB2, 0xB3, 0x98, 0x33, 0x3A, 0x79, 0x9F, 0x7C, 0xE2, 0x5F, 0x9D, 0x55, 0x3D, 0x8F,
+    0xE4, 0x44, 0x10, 0x2D, 0xDB, 0xB7, 0x67, 0x21, 0x0B, 0x7C, 0x01, 0x88, 0x60, 0x91, 0x9C, 0x23,
+    0x81, 0xFF, 0x00, 0x7B, 0xDD, 0xF0, 0x07, 0x6E, 0x02, 0x46, 0x27, 0x91, 0xEC, 0x0F, 0xB8, 0x60,
+    0x52, 0x02, 0x98, 0xB6, 0x04, 0x22, 0xDE, 0x80, 0x8B, 0x89, 0x48, 0x06, 0xA1, 0x4B, 0x48, 0x90,
+    0x96, 0x6D, 0x9F, 0x36, 0xB8, 0x60, 0x13, 0x4B, 0x04, 0xA4, 0x96, 0xB8, 0x8C, 0xC4, 0x81, 0x85,
+    0x0C, 0xD7, 0x76, 0xF3, 0x5E, 0xCD, 0xCC, 0xDE, 0x8A, 0x08, 0xE1, 0xDD, 0xA9, 0x76, 0x57, 0x57,
+    0x57, 0xBF, 0x7E, 0xF5, 0x61, 0xF9, 0x49, 0x3E, 0x17, 0x99, 0xE4, 0x52, 0x24, 0xE0, 0x4F, 0xFC,
+    0xE3, 0x49, 0xA4, 0x8E, 0xBD, 0x48, 0xB2, 0x96, 0x3B, 0x8F, 0x8B, 0x8D, 0x5F, 0x28, 0xE6, 0x62,
+    0x94, 0x7C, 0xC8, 0x46, 0x29, 0xBA, 0x6C, 0x92, 0xB2, 0x4D, 0x82, 0x54, 0x8D, 0xCC, 0x62, 0x60,
+    0x23, 0x5B, 0xC1, 0x08, 0x57, 0x75, 0x03, 0x2F, 0xE5, 0xF3, 0x11, 0xE2, 0xD7, 0x41, 0x24, 0xFF,
+    0xBD, 0x13, 0xC9, 0x5E, 0xB5, 0x70, 0x1A, 0x2D, 0x9C, 0x45, 0x7A, 0xBC, 0xA2, 0xC0, 0x89, 0x92,
+    0xC0, 0x4C, 0x32, 0x98, 0x3D, 0x28, 0x61, 0xF1, 0xB3, 0x87, 0x45, 0x9C, 0x69, 0x05, 0x95, 0xBC,
+    0x4F, 0x7B, 0x1F, 0x6D, 0x8C, 0x75, 0xEC, 0x70, 0xBE, 0x6B, 0x92, 0x45, 0xCA, 0x4E, 0x8C, 0x05,
+    0x04, 0x8C, 0xB3, 0x60, 0x34, 0x16, 0xE3, 0x7F, 0x53, 0x5E, 0x9C, 0x2C, 0x70, 0x17, 0x63, 0xA0,
+    0x00, 0x8E, 0x0A, 0x47, 0x4A, 0xDE, 0x13, 0xCB, 0x44, 0x71, 0x46, 0x51, 0xF2, 0xD0, 0x94, 0x2B,
+    0xF2, 0x40, 0x48, 0x07, 0x11, 0xC6, 0xD8, 0x40, 0x56, 0x1D, 0xB5, 0x46, 0x39, 0x51, 0x90, 0x78,
+    0xA6, 0x8C, 0xB2, 0xAF, 0xAC, 0xB1, 0x95, 0xFD, 0x02, 0x77, 0x3A, 0x93, 0x01, 0xF7, 0x19, 0x52,
+    0x0B, 0x7A, 0x6E, 0xAD, 0x79, 0x55, 0x81, 0xE5, 0x05, 0xFC, 0x63, 0x0F, 0xD4, 0x4F, 0x9F, 0x05,
+    0xAA, 0x41, 0x28, 0xAC, 0x4B, 0xFC, 0xB7, 0x52, 0xB7, 0xB4, 0xF6, 0x54, 0xA7, 0x41, 0xD5, 0x3D,
+    0xD5, 0x00, 0x6A, 0xD6, 0x9B, 0x11, 0x48, 0x22, 0x08, 0x8C, 0xEA, 0xE4, 0xF5, 0x73, 0x9F, 0x7C,
+    0x3A, 0xFA, 0x7F, 0x42, 0xCA, 0xC8, 0xE2, 0xFE, 0xCC, 0x20, 0xBA, 0x83, 0x1B, 0x42, 0xD6, 0xBB,
+    0x64, 0x28, 0x6C, 0xC8, 0xDA, 0xF7, 0xB2, 0xE1, 0xCD, 0xBB, 0x56, 0x80, 0x4E, 0x5C, 0x3C, 0xBF,
+    0x1A, 0xA0, 0xC2, 0x4A, 0xC0, 0x80, 0xC3, 0x03, 0xDE, 0x31, 0x38, 0x71, 0xB6, 0x22, 0xE4, 0x18,
+    0x97, 0xE3, 0x99, 0x27, 0x2B, 0x52, 0xA4, 0x40, 0xB0, 0xC4, 0xC4, 0x79, 0x79, 0x1A, 0x25, 0xC5,
+    0x7A, 0x6C, 0x73, 0xD0, 0x65, 0x7A, 0x20, 0xC7, 0xA5, 0xC8, 0x6F, 0x31, 0x1A, 0xC8, 0x6C, 0x42,
+    0x44, 0x24, 0x0B, 0x0E, 0x32, 0x0D, 0x6E, 0xB7, 0xDB, 0xFD, 0x10, 0x1C, 0x89, 0x0B, 0xEE, 0xE9,
+    0x7A, 0xFD, 0xF8, 0xA8, 0xB7, 0x6A, 0x09, 0xAA, 0x33, 0xDD, 0x55, 0x0C, 0x15, 0xFD, 0xF4, 0x25,
+    0x7C, 0xD6, 0x6D, 0x0E, 0xCA, 0xBD, 0x4D, 0x63, 0x57, 0x2C, 0x4C, 0x49, 0xC6, 0xA5, 0xD8, 0xC7,
+    0xE5, 0x33, 0xE2, 0x49, 0x3E, 0x25, 0xA6, 0x19, 0x59, 0x06, 0x44, 0xDE, 0xBA, 0x1E, 0x57, 0xF1,
+    0x9F, 0x8C, 0x74, 0x08, 0x98, 0x2F, 0xE0, 0x28, 0xF8, 0xDD, 0xEE, 0xD9, 0x8D, 0xC6, 0x7F, 0xBD,
+    0x3E, 0xBF, 0x01, 0x5D, 0xC1, 0x61, 0xE9, 0x7A, 0x92, 0x94, 0xC7, 0x39, 0x89, 0xB6, 0xEE, 0x72,
+    0x3A, 0x2E, 0x19, 0xA2, 0xFB, 0xDF, 0x1E, 0xAE, 0xFB, 0x76, 0xC5, 0x94, 0xF4, 0x37, 0x4C, 0x19,
+    0x3F, 0xD6, 0x13, 0xF9, 0x46, 0x80, 0xC4, 0x7C, 0x23, 0xAE, 0x21, 0x63, 0x08, 0x5F, 0xD1, 0x1F,
+    0x62, 0x86, 0x94, 0x43, 0x55, 0x50, 0xF5, 0x0B, 0x30, 0x05, 0x65, 0xD9, 0x58, 0x12, 0x5E, 0xF4,
+    0x79, 0x47, 0x15, 0x8D, 0xA0, 0x62, 0xC6, 0x15, 0xFD, 0x97, 0x1A, 0xAA, 0x5A, 0xF3, 0xEA, 0x11,
+    0xEF, 0xA2, 0xE5, 0x22, 0xB2, 0x0C, 0xAA, 0xD2, 0xB4, 0xE4, 0xC5, 0x8F, 0x85, 0x83, 0xEA, 0xBA,
+    0x1B, 0x7D, 0x62, 0xEB, 0xC5, 0xBD, 0x00, 0x5E, 0x33, 0xD4, 0x9D, 0xD4, 0x81, 0xF9, 0xFE, 0xB5,
+    0x2C, 0x52, 0xB4, 0x48, 0xEF, 0x0C, 0xC1, 0x1D, 0x93, 0x81, 0xF5, 0x76, 0xC9, 0xA8, 0x9F, 0x91,
+    0xD9, 0x0A, 0xDB, 0xB6, 0x25, 0xDC, 0x94, 0xD7, 0x38, 0x2A, 0xFD, 0x93, 0x27, 0x3D, 0x64, 0x92,
+    0x97, 0x5A, 0x90, 0x1A, 0x65, 0x46, 0x6B, 0xFF, 0xA4, 0x9D, 0xD0, 0x60, 0xCB, 0x42, 0xC7, 0xE6,
+    0x8C, 0x88, 0xEA, 0x57, 0xF1, 0xD0, 0x16, 0x38, 0xDC, 0x93, 0x7F, 0x3D, 0x2E, 0xF6, 0x08, 0xC2,
+    0x0D, 0x48, 0xAB, 0xE2, 0xF4, 0x2E, 0xC0, 0x9F, 0x8E, 0xCC, 0x6D, 0x10, 0x9C, 0xEE, 0x99, 0xC1,
+    0x24, 0x8B, 0x3A, 0x89, 0x3A, 0x31, 0x9E, 0x93, 0xF2, 0x37, 0x4E, 0xB2, 0x51, 0xCD, 0xE6, 0x9C,
+    0x13, 0x63, 0x39, 0x29, 0x3B, 0x4E, 0xAE, 0x47, 0x75, 0x30, 0x0B, 0x27, 0x28, 0x04, 0x4C, 0x70,
+    0x75, 0x4E, 0x26, 0x75, 0x0D, 0xDC, 0xBA, 0x47, 0x27, 0x33, 0x13, 0x2F, 0x47, 0xC6, 0x16, 0x2C,
+    0x76, 0xC2, 0xD1, 0x82, 0x4E, 0xB5, 0x0E, 0x0F, 0xB7, 0xD3, 0x38, 0x88, 0x68, 0x04, 0xA4, 0xDC,
+    0xD3, 0xBA, 0x57, 0xBD, 0x21, 0xF2, 0x81, 0x7C, 0x88, 0xD4, 0x68, 0x10, 0xB7, 0x8C, 0xE5, 0x2C,
+    0x91, 0xAD, 0xB1, 0x60, 0x5A, 0xC8, 0x3B, 0xAB, 0xBB, 0x97, 0x45, 0x7B, 0xF2, 0x71, 0x13, 0xDB,
+    0x3A, 0xB6, 0x8E, 0xA0, 0xB4, 0x8E, 0xB1, 0xA3, 0x66, 0x05, 0xD5, 0x8C, 0x7F, 0x4D, 0xA5, 0x41,
+    0x30, 0x06, 0x03, 0x80, 0xC1, 0x30, 0x29, 0xB6, 0xB4, 0x5C, 0x18, 0xA1, 0x85, 0xA8, 0x97, 0x43,
+    0xA6, 0x38, 0xF1, 0xB3, 0xC4, 0x45, 0x7D, 0x12, 0x50, 0xD1, 0x1D, 0x71, 0x6A, 0x9F, 0x64, 0x10,
+    0x45, 0x3E, 0xA2, 0x78, 0x0B, 0xDC, 0x6A, 0x85, 0x03, 0xD1, 0x89, 0xF6, 0x55, 0x2F, 0x07, 0x61,
+    0x98, 0xA7, 0x2A, 0x5E, 0xEB, 0xC4, 0x7F, 0xBF, 0x22, 0x56, 0x58, 0x7A, 0x56, 0xBB, 0x97, 0x6A,
+    0x12, 0x65, 0x1D, 0xAB, 0xCB, 0xAD, 0xB8, 0x3A, 0xBE, 0x25, 0x33, 0x44, 0x8E, 0xD5, 0xB5, 0x1B,
+    0x50, 0xE2, 0xBC, 0x9E, 0xDE, 0xFD, 0xD8, 0x74, 0x48, 0x36, 0x11, 0x3E, 0xE1, 0xB7, 0x62, 0xD2,
+    0xFC, 0x10, 0xCD, 0x10, 0x3A, 0x37, 0x44, 0x76, 0x54, 0xE4, 0x47, 0x0B, 0xB7, 0xB6, 0xEC, 0x16,
+    0x36, 0x5F, 0xFC, 0x90, 0xF0, 0xF0, 0x2D, 0x7B, 0x4E, 0x93, 0x0D, 0xB0, 0x08, 0x50, 0xF0, 0x03,
+    0xE2, 0x3E, 0x66, 0x8F, 0xBB, 0xD3, 0x69, 0xD8, 0xDF, 0xE2, 0x62, 0xD9, 0xAF, 0x13, 0xD7, 0x6E,
+    0x58, 0x76, 0xA6, 0x43, 0x8C, 0x17, 0xE6, 0x4B, 0x8F, 0x97, 0xAB, 0x34, 0xDC, 0xC3, 0xCB, 0x75,
+    0x37, 0xA7, 0xA1, 0xAE, 0xDA, 0xBA, 0x8D, 0x63, 0x1A, 0x4E, 0x17, 0xB6, 0x3E, 0xB4, 0x8A, 0xE5,
+    0x92, 0xC1, 0xE8, 0x61, 0x5C, 0x31, 0x33, 0x56, 0x1A, 0x7F, 0xA6, 0xC8, 0xFE, 0xA5, 0x63, 0xAE,
+    0x8E, 0xEC, 0x22, 0x24, 0x30, 0x59, 0xC9, 0xE6, 0x79, 0x9C, 0x0A, 0x44, 0x33, 0x9C, 0xC6, 0xBF,
+    0x36, 0x53, 0x1A, 0x91, 0xAC, 0xC5, 0x80, 0xB6, 0x8F, 0xA2, 0x33, 0x0D, 0xBE, 0x59, 0x3E, 0x45,
+    0xAF, 0x08, 0xA8, 0xF5, 0x62, 0x80, 0xAA, 0x6E, 0xAE, 0xB2, 0x76, 0x49, 0xA7, 0xF2, 0xAB, 0xB1,
+    0xE8, 0xCB, 0xF3, 0xB6, 0x6E, 0x2A, 0xD0, 0x76, 0xE1, 0xFA, 0x34, 0x6A, 0xE6, 0x81, 0x06, 0x58,
+    0x4D, 0xFC, 0xD8, 0x0D, 0xD8, 0x98, 0xB0, 0x49, 0xEC, 0x0B, 0x38, 0x8D, 0x2F, 0x79, 0xF4, 0x80,
+    0xEF, 0xEC, 0xFA, 0xB6, 0xD2, 0xF6, 0x1F, 0x1D, 0x52, 0xF5, 0x90, 0xDC, 0x7D, 0x87, 0x3B, 0xFF,
+    0x81, 0xDF, 0x78, 0xFE, 0xF7, 0xEE, 0x47, 0xC5, 0xEB, 0x0F, 0xE0, 0x01, 0x49, 0xFE, 0xB7, 0xC2,
+    0x22, 0x70, 0xB1, 0x49, 0xD9, 0xF7, 0xE5, 0x1F, 0xBD, 0x55, 0xBF, 0x8F, 0xDE, 0x44, 0x10, 0x1D,
+    0x7B, 0xF5, 0xC5, 0x91, 0x5C, 0x2C, 0xCD, 0x09, 0x74, 0x48, 0x98, 0x82, 0x0A, 0x11, 0x99, 0xE2,
+    0x4A, 0x72, 0xBB, 0xB9, 0x14, 0x29, 0x68, 0xAE, 0x48, 0x68, 0x28, 0x52, 0xD1, 0xD0, 0xA4, 0x3D,
+    0xA4, 0xE8, 0x6C, 0xF1, 0x17, 0x5C, 0xC3, 0x7F, 0x40, 0x81, 0x8E, 0x0A, 0xAA, 0x14, 0xC7, 0xD9,
+    0x21, 0x4A, 0x1D, 0x2B, 0x12, 0xBD, 0x1B, 0xD2, 0xA4, 0xC8, 0xEA, 0x64, 0x84, 0x2F, 0xB2, 0x3D,
+    0xBC, 0xB7, 0xFE, 0x92, 0x48, 0x80, 0x04, 0x05, 0xC2, 0xBA, 0x6F, 0xBC, 0x1E, 0x8F, 0xE7, 0xC7,
+    0x9B, 0x37, 0x73, 0x22, 0xD2, 0x89, 0x14, 0x22, 0x69, 0x10, 0x71, 0x95, 0xEA, 0x73, 0xD5, 0x25,
+    0xBB, 0xBC, 0x73, 0xE2, 0xBC, 0x98, 0x01, 0xAA, 0x7F, 0xB8, 0x5D, 0x4A, 0xAA, 0xEA, 0x1B, 0x1D,
+    0xA4, 0x50, 0xD5, 0x0B, 0xFC, 0x74, 0xA3, 0xA7, 0x1A, 0xF2, 0x20, 0xC7, 0xD2, 0x88, 0xE9, 0x71,
+    0xB8, 0xCE, 0x43, 0x87, 0xC3, 0x3B, 0x38, 0x88, 0xE0, 0x20, 0x3B, 0x7A, 0xC7, 0x1B, 0xD5, 0x49,
+    0x3E, 0xD4, 0xD3, 0x3A, 0x6A, 0x5E, 0xBF, 0xFA, 0xBB, 0x83, 0x97, 0x44, 0xB5, 0x97, 0x52, 0x17,
+    0x3C, 0xAC, 0x61, 0xDA, 0xEA, 0x9B, 0x46, 0x66, 0x39, 0x33, 0x43, 0x12, 0x6C, 0x67, 0x6A, 0xE7,
+    0xAF, 0xEE, 0x2E, 0xDF, 0x89, 0xEA, 0x90, 0xDC, 0xFD, 0xD5, 0x33, 0x37, 0xBC, 0x8D, 0x69, 0x5A,
+    0x14, 0xE8, 0x10, 0x04, 0xD1, 0x1A, 0x0D, 0x52, 0xF1, 0xE3, 0x86, 0xE2, 0xED, 0xE5, 0x54, 0xEB,
+    0x74, 0x12, 0x1B, 0x85, 0xA7, 0x10, 0x88, 0x0D, 0x85, 0xBC, 0x12, 0x3B, 0x9E, 0x15, 0xCE, 0x14,
+    0xDA, 0xA6, 0xF3, 0xA6, 0x09, 0xB4, 0x1B, 0x21, 0xCC, 0x04, 0x91, 0xCC, 0xB4, 0x5B, 0xFE, 0x2C,
+    0x10, 0x7A, 0xA9, 0x10, 0x6C, 0x66, 0xC4, 0xD7, 0xDE, 0x98, 0x8D, 0x58, 0x56, 0x54, 0xB5, 0x22,
+    0x9F, 0xAB, 0xA0, 0xAC, 0x11, 0x4F, 0x5F, 0x7A, 0x56, 0x35, 0xE5, 0x0C, 0x91, 0x5D, 0x7E, 0x36,
+    0x21, 0xFB, 0xAC, 0x86, 0xF1, 0x5E, 0x2C, 0x23, 0x7E, 0xE5, 0x9A, 0x45, 0x0C, 0xF3, 0x70, 0x27,
+    0x65, 0x80, 0xC6, 0xA1, 0xE0, 0x74, 0xC2, 0xC1, 0x76, 0xB0, 0x99, 0xCD, 0x28, 0xF6, 0x29, 0x7C,
+    0x21, 0x5E, 0xCD, 0x7A, 0x63, 0xCC, 0x02, 0x41, 0x52, 0xFA, 0x77, 0x0C, 0xDB, 0x8B, 0xBC, 0x8B,
+    0x87, 0x12, 0x10, 0xCA, 0xA9, 0xBC, 0xB9, 0x66, 0xC0, 0x3A, 0x40, 0x56, 0x9D, 0x05, 0x42, 0xDA,
+    0x16, 0x93, 0x14, 0xBD, 0x34, 0x7D, 0x7A, 0x8F, 0x29, 0x54, 0xB7, 0x25, 0xE5, 0x5B, 0x17, 0xDD,
+    0x38, 0x5F, 0x30, 0xA1, 0xCE, 0x76, 0xB6, 0x86, 0x02, 0xE0, 0xE7, 0x2D, 0x7D, 0xFB, 0xD9, 0x30,
+    0x68, 0x12, 0xDC, 0x01, 0xAB, 0x13, 0x87, 0x36, 0xF0, 0x4E, 0x4E, 0xF0, 0x6E, 0xBB, 0x39, 0x66,
+    0x95, 0xF7, 0xEE, 0x06, 0x33, 0xCB, 0xD0, 0x32, 0xB4, 0x44, 0xCC, 0x68, 0x86, 0x6C, 0x88, 0xE8,
+    0xCC, 0x6C, 0x77, 0xB2, 0x20, 0x04, 0x01, 0x52, 0x7C, 0x92, 0x22, 0x53, 0xF5, 0xAC, 0xB5, 0x13,
+    0xAD, 0x65, 0xF1, 0xD9, 0x8C, 0xF4, 0x72, 0x65, 0xAA, 0xDA, 0x02, 0x0C, 0x9F, 0x2D, 0xBB, 0x3E,
+    0xD6, 0xE0, 0xDA, 0xB5, 0x96, 0x2C, 0xAC, 0xF7, 0x64, 0xDC, 0x16, 0x77, 0x7D, 0x7B, 0xB7, 0xAB,
+    0x9D, 0x98, 0xAD, 0xA1, 0xBC, 0xBF, 0xA1, 0xDC, 0x48, 0xE5, 0x2B, 0x95, 0x26, 0xD1, 0x1B, 0x3A,
+    0xE6, 0x53, 0x52, 0x49, 0x25, 0xC7, 0x87, 0xB2, 0x2F, 0xA3, 0x01, 0x5C, 0xF7, 0x4D, 0x5F, 0xC2,
+    0xE8, 0x81, 0xAD, 0x59, 0x4C, 0xD8, 0x67, 0xAD, 0xE9, 0xCB, 0xE5, 0x27, 0xFA, 0xD3, 0xD8, 0xB8,
+    0xF3, 0xE2, 0x11, 0x22, 0x9A, 0xB0, 0xCF, 0xC0, 0xCE, 0x8F, 0x28, 0x32, 0x99, 0x4C, 0x0F, 0xE0,
+    0x89, 0x10, 0x2A, 0x54, 0xF8, 0x62, 0x45, 0xB9, 0xD6, 0x4D, 0x8D, 0x40, 0xF8, 0x7B, 0x78, 0x28,
+    0xDB, 0x96, 0x6C, 0xDB, 0xB4, 0xCE, 0x1E, 0xD1, 0xA9, 0xE3, 0xED, 0xBD, 0xF5, 0xD5, 0x9E, 0x6C,
+    0x6E, 0x83, 0x28, 0x1A, 0x40, 0x7D, 0xF5, 0x15, 0xDA, 0x5E, 0xFA, 0x64, 0x41, 0x0E, 0xEE, 0xEB,
+    0x00, 0x20, 0x8F, 0x00, 0x5E, 0xEC, 0xDE, 0x3A, 0x27, 0x15, 0x07, 0x83, 0x80, 0x0F, 0x92, 0x7C,
+    0xAF, 0xA8, 0xB6, 0x08, 0x11, 0xCE, 0x48, 0x7D, 0xB1, 0x17, 0x2D, 0x46, 0x15, 0xAF, 0x66, 0xD8,
+    0x68, 0x39, 0x24, 0x7A, 0x93, 0x4E, 0x0B, 0xCE, 0xD3, 0x6E, 0xA4, 0x0A, 0xC1, 0x43, 0x79, 0x6C,
+    0x5F, 0x03, 0x45, 0x89, 0x5F, 0xFA, 0x2D, 0x94, 0xA0, 0x7F, 0xA5, 0x6D, 0xA9, 0x8A, 0x49, 0x1E,
+    0xF7, 0xA4, 0xAC, 0x23, 0xB6, 0x80, 0x25, 0xEB, 0x69, 0x98, 0x83, 0xDE, 0x49, 0xD3, 0xC6, 0x42,
+    0xEC, 0x53, 0x10, 0xF1, 0x4C, 0xEC, 0x93, 0x3E, 0x1B, 0x2B, 0x5D, 0x90, 0xB6, 0x97, 0xBB, 0x08,
+    0xFE, 0x20, 0x56, 0xF6, 0xC5, 0x00, 0x63, 0xE4, 0x59, 0xBF, 0x61, 0x1E, 0x2C, 0x5A, 0x33, 0xE6,
+    0x48, 0xC2, 0x85, 0x8D, 0xFA, 0x14, 0xF3, 0x05, 0xEE, 0xFD, 0xC2, 0x99, 0x67, 0x0A, 0x6D, 0xD6,
+    0xB1, 0xB6, 0x7D, 0xD2, 0x23, 0x09, 0x5C, 0x05, 0x24, 0x5D, 0xD9, 0x9E, 0xB1, 0x64, 0xC5, 0x3B,
+    0x8C, 0x64, 0x4B, 0xB5, 0x8B, 0xEA, 0x2A, 0x22, 0xA1, 0xD1, 0x7A, 0xA6, 0x3A, 0x8D, 0x4E, 0xCC,
+    0x44, 0x75, 0x3E, 0x92, 0x63, 0x16, 0x39, 0x60, 0x51, 0x0D, 0x19, 0x58, 0x59, 0x0C, 0x25, 0xE8,
+    0x5E, 0x44, 0xA2, 0xC4, 0x25, 0x13, 0xC7, 0x45, 0x18, 0x0E, 0x57, 0x54, 0x47, 0x4E, 0x4B, 0x1E,
+    0xA9, 0x73, 0x35, 0xD2, 0x25, 0x05, 0xF9, 0x16, 0xD4, 0x6C, 0x19, 0xE2, 0xFC, 0xD0, 0x04, 0xA4,
+    0x68, 0x5B, 0x7C, 0xE2, 0x98, 0xE0, 0x04, 0x96, 0x99, 0x97, 0x44, 0x42, 0x49, 0x87, 0x5B, 0x51,
+    0xD5, 0x81, 0x1E, 0x16, 0x7C, 0x68, 0xCB, 0x96, 0x03, 0x54, 0xA3, 0xB4, 0xCA, 0x97, 0x58, 0x99,
+    0x07, 0xF0, 0x45, 0xE4, 0xD8, 0xBA, 0x95, 0x08, 0xE4, 0xDC, 0x4A, 0x82, 0x6B, 0x54, 0x7D, 0xBC,
+    0xA2, 0xC4, 0x35, 0xE2, 0xEA, 0x06, 0xEB, 0x0F, 0x1B, 0x8B, 0x7B, 0x88, 0x28, 0x99, 0xDF, 0xB8,
+    0xAE, 0x40, 0x86, 0xB8, 0xB9, 0x20, 0x8F, 0x4A, 0x16, 0x7E, 0x14, 0xC1, 0x3A, 0xBA, 0x1F, 0xE5,
+    0x18, 0x11, 0x1A, 0xA2, 0xE4, 0x79, 0xFA, 0x6A, 0x8A, 0xFA, 0x26, 0x4A, 0xB7, 0x7E, 0x45, 0x0F,
+    0x1F, 0x60, 0x37, 0xD0, 0xDB, 0x20, 0x71, 0xAB, 0x51, 0x82, 0x39, 0xDC, 0x61, 0x5A, 0x57, 0x88,
+    0xEB, 0x7A, 0x46, 0xB7, 0x11, 0x93, 0xE4, 0x84, 0xE2, 0x00, 0xD0, 0x55, 0x9F, 0x6A, 0x30, 0x73,
+    0x32, 0x49, 0x09, 0x1C, 0x24, 0x88, 0x7D, 0x8C, 0xD4, 0xDD, 0x47, 0x9F, 0xA0, 0x96, 0x1F, 0x7B,
+    0x31, 0xBF, 0xBF, 0xF0, 0xC0, 0x01, 0xFC, 0x72, 0xD7, 0x10, 0x76, 0xFA, 0x61, 0x14, 0x73, 0xF1,
+    0x08, 0xEB, 0xEA, 0x21, 0x46, 0xC5, 0x71, 0x1B, 0x01, 0xFC, 0xAE, 0x54, 0x71, 0x3F, 0xC3, 0x97,
+    0x23, 0xD2, 0x3B, 0xFF, 0x82, 0x15, 0x98, 0x3B, 0x40, 0x5E, 0xEA, 0xF8, 0x9F, 0xB3, 0xC2, 0xFE,
+    0x85, 0x15, 0x57, 0xD6, 0x9D, 0x71, 0x0F, 0x5D, 0xC9, 0xB0, 0x7F, 0xE4, 0xCA, 0xF9, 0xAB, 0xCD,
+    0x92, 0xB1, 0x51, 0x45, 0x2D, 0x6F, 0x59, 0x1D, 0x10, 0x48, 0xFB, 0xA6, 0xCD, 0xFA, 0xEC, 0x19,
+    0x54, 0x48, 0xEB, 0x18, 0xD3, 0x9C, 0x8C, 0x05, 0xAD, 0x60, 0x5B, 0xBC, 0x68, 0xD9, 0x42, 0xFC,
+    0x03, 0x9B, 0x2A, 0xAA, 0xCE, 0xF9, 0xE1, 0x4C, 0x2B, 0x80, 0x3C, 0x62, 0x84, 0xB3, 0x90, 0x61,
+    0x1C, 0xC7, 0x7C, 0x00, 0x69, 0x72, 0x3A, 0x4F, 0xBC, 0xFC, 0x8F, 0xD7, 0x1F, 0xB5, 0x55, 0x3D,
+    0x8F, 0xE4, 0x44, 0x10, 0xAD, 0x76, 0xEB, 0xD6, 0x42, 0x1D, 0x38, 0x59, 0x09, 0xA4, 0x13, 0x72,
+    0x42, 0x7A, 0xE7, 0x3F, 0xC0, 0x6D, 0x3B, 0x21, 0x22, 0x99, 0x80, 0x0D, 0xD0, 0x06, 0x7B, 0x31,
+    0x01, 0x97, 0x12, 0xC0, 0xD9, 0x39, 0x09, 0x01, 0x97, 0x10, 0x5F, 0xC2, 0x10, 0x4C, 0x42, 0xB8,
+    0x33, 0x36, 0x20, 0x74, 0xC1, 0x26, 0x03, 0xD2, 0xE5, 0x46, 0x22, 0xBA, 0x4B, 0x5A, 0x27, 0x23,
+    0x79, 0x46, 0x1E, 0x17, 0xAF, 0xAA, 0x3D, 0xCB, 0x87, 0x16, 0xD0, 0x05, 0xCC, 0xAE, 0xBA, 0x5D,
+    0x5D, 0xED, 0xAA, 0x57, 0xAF, 0x3E, 0x4C, 0x24, 0x3F, 0xC3, 0xCC, 0xAD, 0x1D, 0x1C, 0xF3, 0x44,
+    0x3E, 0x14, 0x2F, 0x9A, 0x3A, 0xE1, 0xF6, 0x8A, 0x0E, 0x94, 0x3F, 0x4F, 0x82, 0xED, 0x69, 0x24,
+    0x57, 0x67, 0xDB, 0x74, 0x4B, 0x6F, 0x93, 0x2F, 0xBD, 0xBC, 0x71, 0x30, 0x01, 0xAB, 0xED, 0xB3,
+    0x1A, 0x5B, 0xB6, 0xBD, 0x92, 0x33, 0xCF, 0x9D, 0x6C, 0x30, 0xA5, 0x2A, 0x1F, 0x55, 0x95, 0xAA,
+    0x4A, 0xD6, 0xB7, 0xF0, 0x27, 0xAA, 0x64, 0x54, 0x95, 0x1D, 0x55, 0xE5, 0x06, 0x55, 0x65, 0x3D,
+    0x51, 0xDA, 0xCB, 0x96, 0x30, 0x53, 0xDE, 0x53, 0xCE, 0x23, 0xE5, 0x83, 0x02, 0x3C, 0x29, 0x65,
+    0x3D, 0x2D, 0x98, 0xCB, 0xEA, 0x7D, 0x38, 0xA8, 0x7E, 0xDE, 0x57, 0xA5, 0x7F, 0x38, 0x64, 0x6D,
+    0x41, 0x67, 0x36, 0xE4, 0xA5, 0x2B, 0xC7, 0xAC, 0x36, 0xB5, 0x4F, 0xE1, 0x3B, 0x7B, 0xB9, 0x85,
+    0x13, 0x16, 0xE3, 0x07, 0x8F, 0x17, 0x7D, 0x0A, 0xAC, 0x59, 0xBB, 0xC1, 0x61, 0xC8, 0xA0, 0x1A,
+    0xC5, 0xBD, 0x27, 0xDF, 0x52, 0x73, 0x00, 0x84, 0x06, 0x36, 0x05, 0xB1, 0x59, 0x54, 0x08, 0x80,
+    0xF9, 0x9A, 0x11, 0x37, 0x0F, 0x6F, 0x02, 0xEA, 0xDD, 0x9E, 0x0A, 0xA8, 0x2A, 0x92, 0x37, 0x60,
+    0xE5, 0x3F, 0x05, 0xF0, 0xC8, 0x10, 0x64, 0xA3, 0x64, 0x5A, 0x2E, 0xBF, 0x09, 0xAF, 0x69, 0x00,
+    0x4E, 0xDD, 0x6F, 0x29, 0xDE, 0x76, 0x7C, 0x68, 0x38, 0x20, 0x31, 0xCA, 0xA9, 0xF2, 0x26, 0x94,
+    0xE9, 0xA6, 0x6C, 0x93, 0x6B, 0x75, 0xFB, 0x54, 0x57, 0x1B, 0x85, 0x77, 0x10, 0x4C, 0xC3, 0x9F,
+    0x73, 0x9F, 0x71, 0x9F, 0x0E, 0x74, 0x37, 0x80, 0x5E, 0x98, 0x45, 0x0A, 0xD3, 0xBF, 0x3E, 0xBE,
+    0x58, 0x32, 0x28, 0x12, 0xB0, 0xFE, 0xC9, 0x79, 0x73, 0xCB, 0x05, 0x7D, 0x1C, 0xC8, 0xF5, 0x09,
+    0x0F, 0x29, 0x8F, 0x0D, 0xD7, 0x8D, 0xE6, 0x95, 0x46, 0x05, 0xF2, 0xC7, 0xA3, 0x93, 0x34, 0xD3,
+    0x27, 0x0A, 0xA2, 0x8C, 0x0C, 0xF2, 0x4B, 0xA5, 0x90, 0x27, 0xE5, 0x70, 0xBF, 0xEA, 0x62, 0x70,
+    0x67, 0x31, 0x54, 0xBB, 0x8D, 0xE2, 0x83, 0x59, 0xAC, 0xA3, 0x78, 0x24, 0x82, 0x8E, 0x62, 0xE4,
+    0x72, 0x26, 0xF3, 0xC8, 0x26, 0xFD, 0xC3, 0xE5, 0x7F, 0x17, 0x85, 0x55, 0x84, 0xA5, 0xB4, 0x4A,
+    0xC2, 0x85, 0xD7, 0x96, 0x94, 0xAB, 0x09, 0x2B, 0x90, 0x0A, 0x59, 0xFB, 0x8D, 0xC6, 0x7E, 0xFF,
+    0x4F, 0xEB, 0x3D, 0x5D, 0xDF, 0xB2, 0xD3, 0x72, 0x15, 0x66, 0xBE, 0xEC, 0xEE, 0xFC, 0x22, 0xCC,
+    0x2C, 0xDD, 0xB2, 0x82, 0x32, 0x29, 0x80, 0xBA, 0x12, 0xC2, 0xE4, 0xBF, 0x12, 0xFC, 0xE3, 0x1C,
+    0xC7, 0x84, 0x32, 0xAB, 0xF6, 0xCB, 0x55, 0x2F, 0xC4, 0x05, 0x32, 0xC2, 0xA0, 0x80, 0xD5, 0x26,
+    0x69, 0x88, 0x72, 0xE1, 0x15, 0xA8, 0x05, 0xFC, 0xED, 0x17, 0x7E, 0xFC, 0x20, 0x5E, 0x60, 0xFE,
+    0x55, 0x2F, 0xC0, 0x68, 0xAD, 0x17, 0xDE, 0x6B, 0x86, 0x68, 0xC1, 0xF0, 0x6C, 0x21, 0xEF, 0xA2,
+    0x05, 0x3B, 0xCE, 0x16, 0x9A, 0xD9, 0x45, 0xBE, 0x8D, 0x17, 0x6C, 0x3F, 0xBB, 0x18, 0x85, 0xA1,
+    0x06, 0x29, 0x47, 0xCB, 0x69, 0xF3, 0x5D, 0x33, 0x0B, 0x45, 0x2E, 0x16, 0x9F, 0xC4, 0xA6, 0x3F,
+    0xED, 0x5B, 0x69, 0x95, 0xC3, 0x2C, 0x4F, 0x51, 0xBC, 0x88, 0x3B, 0xF1, 0x7C, 0x7E, 0xF2, 0x14,
+    0xE6, 0x24, 0xDE, 0x12, 0x84, 0xB3, 0xD6, 0x70, 0xBA, 0x3B, 0xBF, 0xEC, 0xB4, 0xDD, 0x69, 0x13,
+    0x2D, 0xBA, 0xBF, 0x89, 0xBF, 0x34, 0xB5, 0x8A, 0x08, 0x48, 0x44, 0x9D, 0x45, 0x25, 0x35, 0x75,
+    0x1E, 0xE2, 0xE5, 0xAA, 0xD6, 0xCB, 0x76, 0x8C, 0x62, 0xDE, 0xAA, 0x68, 0x46, 0x50, 0x9E, 0x75,
+    0x94, 0x7D, 0x2F, 0x75, 0x1A, 0x8C, 0x54, 0xAA, 0x44, 0x10, 0xFB, 0xC1, 0xCC, 0x80, 0x8B, 0x3A,
+    0xC6, 0x11, 0xA2, 0xB8, 0x99, 0x4F, 0xE3, 0xA5, 0xCB, 0x18, 0x9D, 0x8F, 0xE0, 0xCD, 0xD7, 0xBA,
+    0x2D, 0xB4, 0xB6, 0x59, 0xE6, 0x8E, 0x9B, 0x64, 0xB5, 0x07, 0x6A, 0x80, 0x18, 0xA0, 0x50, 0x3A,
+    0xBE, 0xCE, 0x7E, 0x9A, 0xC0, 0x7F, 0xD2, 0xC3, 0xE4, 0x01, 0xC3, 0xA4, 0x40, 0x15, 0xA7, 0x9D,
+    0x82, 0x59, 0x2B, 0x34, 0xB4, 0xEA, 0x98, 0xCA, 0xE4, 0xCC, 0xDA, 0x4A, 0xDA, 0x65, 0x4C, 0xE5,
+    0x62, 0xDE, 0x56, 0xD0, 0x98, 0x01, 0x9A, 0x0D, 0x15, 0xA5, 0xAF, 0x5D, 0xB0, 0x01, 0x33, 0x08,
+    0xD3, 0x08, 0xE9, 0x4A, 0x06, 0xB7, 0x25, 0x2E, 0xB3, 0xEF, 0x06, 0xF1, 0x56, 0x21, 0x63, 0xF9,
+    0x2E, 0x91, 0xAE, 0xF3, 0x20, 0xE3, 0xAB, 0x96, 0x1E, 0xA1, 0xB1, 0x80, 0xF5, 0x4E, 0x69, 0x16,
+    0x33, 0xC2, 0x42, 0x47, 0x67, 0xF2, 0x94, 0x6C, 0x97, 0x33, 0xDC, 0x7C, 0x96, 0xB7, 0x45, 0x09,
+    0x2B, 0xDE, 0xF4, 0xB6, 0x7B, 0x8C, 0xD9, 0x1D, 0x1E, 0xC3, 0x7E, 0x58, 0xCB, 0xB2, 0xC1, 0xD2,
+    0x6D, 0x92, 0x3E, 0xDD, 0x56, 0x66, 0x70, 0xAD, 0x27, 0x4C, 0xCC, 0xA2, 0x5E, 0x17, 0x60, 0xCF,
+    0xAF, 0xC9, 0x4E, 0xAB, 0xDD, 0x87, 0x92, 0xB4, 0x91, 0xEE, 0x7C, 0x79, 0xB2, 0x98, 0xF3, 0xC8,
+    0x53, 0x69, 0x24, 0x11, 0xF9, 0xEE, 0x62, 0x34, 0x53, 0x9C, 0x9F, 0x59, 0x8B, 0x6C, 0x9F, 0x49,
+    0x85, 0x7E, 0xAB, 0x04, 0x4E, 0xC7, 0x02, 0xC9, 0x65, 0x3A, 0x55, 0x47, 0xD6, 0xD3, 0x9B, 0x23,
+    0xFD, 0x10, 0xF0, 0xB1, 0x5C, 0xEC, 0x34, 0x13, 0x7B, 0xEA, 0x18, 0xA3, 0xC1, 0xE9, 0xA8, 0xD4,
+    0x12, 0x29, 0xBE, 0x80, 0xE6, 0x81, 0xF8, 0x45, 0x54, 0x06, 0x5F, 0x1B, 0xCC, 0x10, 0xB1, 0x28,
+    0x86, 0x3E, 0xD2, 0xD4, 0xA0, 0xF6, 0x9B, 0x49, 0x26, 0x8B, 0x39, 0xA4, 0x63, 0xD6, 0xDA, 0x7E,
+    0x4D, 0xEE, 0x87, 0x40, 0xA7, 0x92, 0x6D, 0xE4, 0x34, 0x19, 0xB4, 0x69, 0x62, 0xDB, 0x97, 0xEA,
+    0x53, 0xBC, 0x59, 0x7E, 0xF2, 0x31, 0xFA, 0x05, 0x93, 0x0C, 0x5E, 0x1F, 0xE1, 0xFC, 0x5D, 0x98,
+    0x42, 0xF5, 0x5F, 0xA2, 0x13, 0x90, 0x73, 0x1F, 0x87, 0xAA, 0xF6, 0xA9, 0x36, 0xE9, 0xF5, 0x7E,
+    0xB5, 0x5F, 0xBD, 0x0A, 0x28, 0xF6, 0xAB, 0x2B, 0x74, 0x4C, 0x71, 0x1F, 0x06, 0xD3, 0x67, 0xA5,
+    0x0B, 0x66, 0x3B, 0x77, 0x40, 0x73, 0x53, 0x3D, 0xE2, 0xEE, 0xB5, 0x0F, 0x79, 0x21, 0x0C, 0x00,
+    0x4C, 0x1A, 0xC7, 0x7B, 0x6C, 0x2F, 0x2D, 0x3F, 0x7F, 0x33, 0xD9, 0xF5, 0x03, 0x1B, 0xE7, 0xEA,
+    0x1B, 0xF4, 0xBF, 0xFD, 0x7E, 0x07, 0xAD, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0x7B, 0x45,
+    0x2C, 0xE1, 0x62, 0xAB, 0x08, 0x24, 0x94, 0xB8, 0x45, 0x28, 0xE0, 0x86, 0x82, 0x02, 0x62, 0x8B,
+    0x94, 0x34, 0x14, 0x77, 0xA4, 0xE0, 0x1F, 0xA4, 0x49, 0x43, 0x91, 0xE2, 0x38, 0x1B, 0x51, 0xD0,
+    0xA6, 0x40, 0xFC, 0x06, 0x3A, 0x28, 0x23, 0x74, 0x7C, 0x76, 0x40, 0x82, 0x22, 0x8D, 0x11, 0xFC,
+    0x00, 0x4B, 0x20, 0x45, 0xA9, 0x62, 0x81, 0x11, 0x9B, 0xC3, 0xF6, 0xF0, 0xDE, 0x38, 0xF7, 0xE5,
+    0xBE, 0x84, 0x84, 0x9C, 0xC4, 0x69, 0xBF, 0xF1, 0x7A, 0x76, 0x77, 0xE6, 0xCD, 0xF3, 0x9B, 0xBD,
+    0x46, 0x55, 0x73, 0xFC, 0xEE, 0xDC, 0x6B, 0xAE, 0xFD, 0xD1, 0x67, 0xED, 0x41, 0x48, 0x06, 0xFF,
+    0x7A, 0x34, 0xB9, 0x1F, 0xA4, 0x92, 0x9B, 0x92, 0xB5, 0x22, 0xC9, 0x20, 0x12, 0x4D, 0x22, 0x70,
+    0xC8, 0xAE, 0xA3, 0x29, 0xE5, 0x9C, 0x6A, 0xE9, 0x54, 0x7B, 0x11, 0x37, 0xC2, 0xF3, 0x2D, 0xB7,
+    0xE0, 0x97, 0x60, 0x9B, 0x60, 0x9B, 0xBC, 0x2A, 0x8D, 0x0E, 0x5E, 0x7F, 0x57, 0xAD, 0x0B, 0xBD,
+    0xDD, 0x74, 0x92, 0x8E, 0x52, 0x95, 0x52, 0x88, 0xA8, 0x44, 0x41, 0xA2, 0x59, 0x7C, 0x2B, 0xF1,
+    0x24, 0x1F, 0x23, 0x40, 0x70, 0x38, 0x91, 0x0E, 0x59, 0x29, 0xE2, 0x7B, 0xC6, 0xCF, 0xEE, 0x30,
+    0x4C, 0xBE, 0x81, 0x91, 0x82, 0xD1, 0x98, 0xF1, 0x61, 0x6E, 0x43, 0xB1, 0xE2, 0x59, 0x91, 0xED,
+    0xBA, 0x7F, 0xA1, 0x51, 0x85, 0x55, 0x85, 0xBF, 0xD2, 0xBA, 0x59, 0x68, 0x66, 0xE4, 0x4F, 0x06,
+    0x60, 0x4D, 0x3B, 0x17, 0x90, 0x1B, 0x87, 0xB2, 0x5A, 0x66, 0x02, 0xAA, 0xE4, 0x10, 0x69, 0xE4,
+    0x08, 0x19, 0xEB, 0x00, 0x08, 0xB7, 0x51, 0x90, 0xFF, 0x19, 0xE1, 0x92, 0x5F, 0x3B, 0xA0, 0xFB,
+    0x1B, 0x99, 0x62, 0x65, 0x7E, 0x46, 0x95, 0xCD, 0xB3, 0x4C, 0xAC, 0x37, 0x99, 0x1E, 0x67, 0x5F,
+    0xD8, 0x7F, 0xFF, 0x0C, 0x0C, 0x8C, 0xA7, 0x18, 0xE8, 0x8C, 0x81, 0x1F, 0x8D, 0x81, 0x43, 0x2B,
+    0x72, 0xB0, 0x6A, 0xB4, 0x15, 0x10, 0xAE, 0xFF, 0xC5, 0x40, 0xFE, 0x1C, 0x0C, 0xC4, 0x27, 0x0C,
+    0x94, 0x27, 0x0C, 0x5C, 0x3E, 0x61, 0xA0, 0x34, 0x06, 0x88, 0xE6, 0xBB, 0x1D, 0x06, 0x22, 0x32,
+    0xF0, 0x9A, 0x7E, 0xC9, 0x80, 0xB3, 0xC8, 0xF9, 0xCD, 0xDE, 0xF3, 0x30, 0x90, 0xEB, 0xE4, 0x74,
+    0xCA, 0x35, 0x38, 0x0D, 0xE7, 0x10, 0x01, 0xF5, 0x37, 0x35, 0xF7, 0x15, 0x1D, 0x31, 0xFB, 0x81,
+    0x75, 0x27, 0x93, 0x47, 0x96, 0x78, 0xCE, 0x8D, 0x63, 0x2B, 0xB9, 0xB0, 0x82, 0x72, 0x2B, 0xC8,
+    0x8F, 0x8F, 0x3C, 0x1B, 0x96, 0x15, 0x05, 0xAA, 0xC1, 0x0D, 0x05, 0x60, 0xF9, 0xD6, 0x0F, 0xFC,
+    0x6E, 0x49, 0x60, 0x15, 0x0E, 0xC8, 0x26, 0xF2, 0xCB, 0xD7, 0xA6, 0xAB, 0xB4, 0x4D, 0x75, 0x69,
+    0xB4, 0xF5, 0x46, 0x87, 0xC8, 0x22, 0x5B, 0xAC, 0xA6, 0x58, 0x91, 0x03, 0xB3, 0x6F, 0x9F, 0xB2,
+    0x2F, 0x17, 0x5A, 0xEB, 0x44, 0x13, 0x92, 0x09, 0x91, 0x71, 0x88, 0x0C, 0x95, 0x88, 0x9B, 0x91,
+    0x92, 0xF4, 0xAF, 0x1D, 0x3D, 0x44, 0x5A, 0x03, 0xCB, 0x7D, 0x14, 0xE0, 0x3F, 0xC3, 0x6A, 0x81,
+    0x0F, 0x0A, 0x08, 0x2A, 0xF1, 0x28, 0x45, 0x9D, 0x2F, 0x91, 0x4E, 0x8D, 0x3A, 0x32, 0x66, 0xC8,
+    0x1E, 0x9A, 0x23, 0x9A, 0x5B, 0x34, 0x37, 0x68, 0xDE, 0xAC, 0x54, 0x67, 0xA7, 0x0B, 0xFB, 0xB1,
+    0x56, 0x7D, 0xEF, 0x9E, 0x7E, 0xD8, 0x25, 0x73, 0x3C, 0x14, 0xF5, 0x88, 0xEC, 0xB7, 0x7C, 0xFF,
+    0x0E, 0x62, 0xBD, 0xE1, 0x82, 0x47, 0x7B, 0x24, 0xE5, 0xE2, 0x4A, 0x28, 0x18, 0x1E, 0xAB, 0xC7,
+    0xF7, 0x36, 0xA5, 0x87, 0xD3, 0x45, 0xE4, 0xFF, 0x59, 0x3C, 0xDE, 0xFF, 0x00, 0x92, 0x05, 0x30,
+    0x0A, 0xAF, 0xB0, 0x87, 0x7D, 0x0D, 0x2A, 0x56, 0xB6, 0xC2, 0x13, 0x36, 0x11, 0xFF, 0x5C, 0xBF,
+    0xBE, 0x8E, 0xEB, 0xE3, 0xD2, 0xFA, 0x88, 0xD1, 0x02, 0xDA, 0xEB, 0x8C, 0xF3, 0xA1, 0x52, 0xFF,
+    0x69, 0x38, 0x8C, 0x27, 0xD7, 0xCD, 0xBE, 0xDC, 0xC8, 0x50, 0xBC, 0xDB, 0xE5, 0xF5, 0x25, 0xDF,
+    0x7D, 0x9D, 0xF6, 0xBC, 0x42, 0x20, 0x49, 0x68, 0xD1, 0xA4, 0x51, 0x92, 0x75, 0x48, 0xE2, 0x99,
+    0x0B, 0x0F, 0xE4, 0xA5, 0x59, 0x52, 0xC2, 0x9A, 0xCC, 0xAE, 0x1F, 0x78, 0xED, 0x09, 0xB7, 0x22,
+    0x0D, 0x66, 0x2F, 0x9B, 0x4D, 0x4B, 0x7B, 0xA0, 0x92, 0x01, 0xC3, 0x68, 0xAE, 0xAF, 0x77, 0x82,
+    0x51, 0xB1, 0x14, 0x88, 0x11, 0x03, 0x0D, 0x84, 0x81, 0x18, 0x18, 0xE6, 0x46, 0x62, 0xB8, 0x41,
+    0x0B, 0xDC, 0x90, 0x21, 0x57, 0x1E, 0xEC, 0x23, 0x53, 0x6E, 0x9D, 0x95, 0xAD, 0x94, 0x94, 0x4F,
+    0xBB, 0x8A, 0x1E, 0xB9, 0xE3, 0xB9, 0xA4, 0x66, 0x94, 0x2A, 0x51, 0x35, 0xC6, 0x4C, 0x11, 0x76,
+    0x75, 0xF2, 0x1A, 0xA0, 0xD8, 0x4F, 0xE9, 0xD1, 0xC8, 0x8C, 0x4B, 0x2A, 0x27, 0x34, 0x8B, 0xD3,
+    0xF1, 0x95, 0x01, 0x0A, 0x44, 0x59, 0x85, 0x3C, 0x6E, 0x02, 0x4C, 0xA4, 0x5F, 0x34, 0x42, 0xAA,
+    0x45, 0x5E, 0x3C, 0xB6, 0x84, 0xC5, 0xAE, 0x41, 0xDB, 0x81, 0xAB, 0x99, 0x90, 0xE7, 0x6D, 0xF2,
+    0xA3, 0xAD, 0x39, 0xD8, 0xAA, 0xFF, 0xAD, 0xB3, 0xF2, 0x93, 0x7C, 0x42, 0x7E, 0x2E, 0x1A, 0x3F,
+    0x37, 0xB8, 0xB2, 0xFC, 0xF9, 0x38, 0x3F, 0x47, 0x24, 0x22, 0xEA, 0x89, 0x8B, 0xBB, 0x45, 0x2E,
+    0xFE, 0x0B, 0x3F, 0x76, 0x73, 0x68, 0x6B, 0xFC, 0x08, 0xEB, 0x3E, 0xD6, 0xE0, 0xF5, 0xA7, 0x46,
+    0x92, 0x11, 0x2D, 0xE3, 0x5B, 0x2B, 0x16, 0x44, 0x4D, 0x52, 0x24, 0x57, 0x06, 0x59, 0x2E, 0xE0,
+    0xFE, 0xD2, 0x6F, 0x1A, 0x1E, 0x42, 0xC8, 0xAF, 0xEE, 0x22, 0xE2, 0x05, 0xF2, 0xF8, 0x11, 0xEB,
+    0x65, 0xAF, 0xF2, 0x20, 0x56, 0x17, 0xC2, 0x98, 0x2A, 0x02, 0x49, 0xF9, 0x42, 0xD5, 0x90, 0xEC,
+    0x76, 0xAB, 0xE4, 0x27, 0xA7, 0xE7, 0x3F, 0xB7, 0x0A, 0x02, 0x83, 0xE3, 0x60, 0xFE, 0x1B, 0xEE,
+    0x3E, 0x6C, 0x70, 0x13, 0x37, 0xE4, 0x6D, 0x6C, 0x5C, 0xE4, 0x64, 0xE1, 0x29, 0x53, 0xA8, 0x66,
+    0x4E, 0x14, 0xBD, 0x8F, 0xBB, 0xA7, 0x2F, 0xF0, 0x3F, 0x72, 0xCF, 0xCA, 0x63, 0xF4, 0xCA, 0x12,
+    0x5D, 0x6F, 0xB7, 0x5A, 0xC9, 0x9E, 0x98, 0x46, 0x7B, 0xBC, 0x69, 0x74, 0x44, 0x10, 0x32, 0x92,
+    0xE9, 0xD5, 0x85, 0xB7, 0xAF, 0x1F, 0x56, 0xDA, 0x29, 0x48, 0x93, 0x62, 0x51, 0x9E, 0x65, 0x9A,
+    0x69, 0x9B, 0xEB, 0xF7, 0x76, 0x1D, 0x9B, 0xC4, 0xFE, 0x01, 0xCD, 0x54, 0xB1, 0x8E, 0xE4, 0x44,
+    0x10, 0x2D, 0xBB, 0x35, 0x58, 0x87, 0x85, 0xFA, 0x92, 0x13, 0x42, 0x17, 0x34, 0x3F, 0x00, 0x4E,
+    0x09, 0x98, 0xE9, 0x46, 0xF7, 0x03, 0x04, 0x37, 0x24, 0x04, 0x97, 0x90, 0x70, 0x09, 0x5F, 0x00,
+    0xED, 0x23, 0xE1, 0x07, 0xD8, 0x98, 0x84, 0x68, 0x08, 0x36, 0x21, 0x5C, 0x6D, 0x5B, 0x97, 0x10,
+    0x90, 0x34, 0x3A, 0x91, 0x8F, 0x90, 0x88, 0x2E, 0xC0, 0x42, 0x3E, 0xC9, 0xAC, 0x6C, 0x17, 0xAF,
+    0xCA, 0xB3, 0xBB, 0xD2, 0x81, 0x04, 0x08, 0x21, 0xD1, 0x2B, 0x3D, 0xAF, 0x3D, 0xDD, 0xD5, 0xAF,
+    0x5E, 0xBD, 0x2A, 0x22, 0x2A, 0x1E, 0x12, 0x56, 0xCD, 0xB3, 0x22, 0x8F, 0x44, 0x25, 0xBF, 0x97,
+    0x8E, 0x44, 0x29, 0x10, 0x07, 0x72, 0x99, 0xCC, 0x54, 0x1B, 0x7C, 0x6E, 0x9E, 0x1E, 0x63, 0xA0,
+    0x62, 0xDE, 0xD5, 0x3D, 0x91, 0x7B, 0x76, 0x5C, 0x70, 0x76, 0xF6, 0x5F, 0xBD, 0xD8, 0xEF, 0x3F,
+    0x79, 0xC6, 0xB2, 0xA6, 0x5A, 0x1F, 0x1D, 0x2D, 0x12, 0x91, 0xEC, 0x51, 0x1F, 0xA7, 0x97, 0x5E,
+    0x1F, 0x88, 0x89, 0x65, 0x26, 0x7D, 0xF1, 0xEB, 0x06, 0xCE, 0x54, 0x04, 0xAA, 0xF8, 0xEA, 0x1C,
+    0x97, 0x38, 0x04, 0xC0, 0xB7, 0x86, 0x59, 0x76, 0x6E, 0xF6, 0xB2, 0x41, 0x19, 0x36, 0xDC, 0x52,
+    0xC1, 0xDC, 0x93, 0x19, 0xAA, 0xF1, 0x35, 0x9B, 0x8B, 0x69, 0x6B, 0x3B, 0x9A, 0xB7, 0x4D, 0x4B,
+    0xB3, 0x8F, 0x67, 0xFB, 0xD9, 0xE3, 0xE4, 0x2C, 0x0C, 0x26, 0xF2, 0x1A, 0x5D, 0x02, 0xF8, 0x56,
+    0x8E, 0x76, 0xD7, 0x04, 0xEA, 0x65, 0x7F, 0x41, 0x46, 0xB6, 0x50, 0x64, 0xDC, 0x5E, 0xDC, 0xC6,
+    0xFF, 0xBF, 0x29, 0xE0, 0x56, 0x05, 0xEA, 0x17, 0xBA, 0x23, 0x2A, 0x9A, 0x35, 0xC4, 0x6E, 0x7D,
+    0xC9, 0xFA, 0x78, 0x4B, 0x91, 0xDA, 0xFF, 0x56, 0x28, 0xC9, 0x9E, 0x4A, 0xF9, 0xA5, 0xB8, 0x01,
+    0xBA, 0x85, 0xBB, 0xD8, 0xF5, 0x2B, 0xF3, 0x93, 0x98, 0x29, 0x51, 0x39, 0x11, 0xF4, 0x41, 0xAC,
+    0xBF, 0xF3, 0xEF, 0x0C, 0xAA, 0xDF, 0x6B, 0xC2, 0x65, 0x26, 0x55, 0xA3, 0x18, 0xE9, 0xB3, 0x55,
+    0x9C, 0xA0, 0xA4, 0xC0, 0x85, 0xBB, 0x55, 0x04, 0x6E, 0xD7, 0x64, 0xEF, 0xD2, 0x9F, 0x2C, 0x33,
+    0x50, 0xE2, 0x6C, 0x86, 0x82, 0x83, 0xE7, 0xDE, 0x30, 0xC5, 0x9E, 0x62, 0x5B, 0x72, 0x7B, 0xE7,
+    0x92, 0xA0, 0xC2, 0xFC, 0x3E, 0xD5, 0xF8, 0x95, 0x44, 0xF8, 0x89, 0x66, 0xFA, 0x54, 0x52, 0x0D,
+    0x3E, 0xEC, 0x34, 0x31, 0x9B, 0x1B, 0x89, 0xB1, 0x35, 0x83, 0x15, 0x35, 0xAA, 0x6E, 0xAE, 0xF5,
+    0x4E, 0xA8, 0x94, 0xD7, 0xAB, 0x59, 0x2B, 0xE6, 0x1F, 0x0C, 0x2A, 0x57, 0xD3, 0xCE, 0x95, 0x64,
+    0xEE, 0x3A, 0x1F, 0x16, 0xAD, 0xB4, 0xCD, 0xF0, 0x09, 0xF2, 0x32, 0x03, 0xD2, 0xA3, 0x6A, 0xC4,
+    0x15, 0xBE, 0x93, 0x3A, 0xFB, 0x50, 0x8F, 0x64, 0x66, 0x70, 0x80, 0x99, 0xCC, 0x42, 0xE6, 0x37,
+    0x72, 0x03, 0xE8, 0x35, 0x3C, 0x94, 0xFC, 0x80, 0xC9, 0xC2, 0x77, 0x6E, 0xFC, 0x78, 0x4D, 0xE2,
+    0x23, 0xA2, 0x6F, 0xF1, 0x87, 0x00, 0xD9, 0xAC, 0xF1, 0x9D, 0xF0, 0xF0, 0x67, 0xE2, 0x4D, 0x1C,
+    0x51, 0x32, 0x9B, 0x87, 0x37, 0x49, 0x17, 0x41, 0xC1, 0x65, 0xC7, 0x5D, 0xD3, 0xC5, 0x1C, 0x97,
+    0x92, 0xE9, 0x11, 0x0E, 0xB9, 0x2F, 0xC9, 0xB6, 0x3B, 0x12, 0x3F, 0xD1, 0x28, 0xB9, 0xBC, 0x6D,
+    0x8E, 0x5B, 0xEC, 0x7D, 0xD7, 0x7E, 0x2E, 0x71, 0x2F, 0xD3, 0x39, 0x4E, 0xA2, 0xC0, 0x42, 0xBE,
+    0xF9, 0xA2, 0x57, 0x55, 0xEC, 0x13, 0x3C, 0x6C, 0xDE, 0x41, 0x25, 0x18, 0x6E, 0xAC, 0xC4, 0x42,
+    0xE6, 0x08, 0x13, 0xFB, 0xCE, 0xB6, 0x36, 0x9B, 0xA9, 0xE4, 0xA3, 0x3B, 0xFA, 0xAE, 0xC1, 0x5D,
+    0x47, 0xE5, 0xB0, 0x59, 0x59, 0x38, 0x88, 0xE3, 0x9E, 0x23, 0x56, 0x33, 0x3D, 0x1A, 0xC0, 0x12,
+    0x0A, 0xB8, 0x1F, 0x42, 0x22, 0xF8, 0xAE, 0xE9, 0x00, 0x75, 0x5F, 0x67, 0x54, 0xBD, 0x92, 0x96,
+    0x92, 0xB4, 0x9A, 0xA7, 0xE3, 0xA9, 0xD3, 0x4A, 0xED, 0x96, 0x74, 0x96, 0x26, 0xF1, 0x03, 0x77,
+    0xF0, 0x85, 0x15, 0x01, 0x8B, 0x05, 0xE6, 0xC0, 0xBD, 0x8D, 0x1E, 0xEE, 0x71, 0x58, 0x54, 0x4D,
+    0xD2, 0x3D, 0xCD, 0x77, 0xB0, 0x8B, 0xFD, 0x09, 0xE7, 0x84, 0xA7, 0x98, 0x09, 0x4B, 0xE5, 0x11,
+    0x17, 0x15, 0x02, 0x1F, 0x0A, 0x24, 0x49, 0xED, 0x95, 0xAF, 0x95, 0xE0, 0x06, 0xCA, 0xD9, 0xE7,
+    0xDC, 0xDB, 0xC9, 0x65, 0xFB, 0xB3, 0xE9, 0xAB, 0x8E, 0x26, 0xF4, 0x8F, 0x87, 0xA3, 0x6D, 0x87,
+    0x34, 0xAF, 0x16, 0x74, 0x3A, 0xEA, 0xE0, 0x0F, 0xD8, 0xD7, 0x55, 0x13, 0x48, 0xC6, 0x30, 0xA1,
+    0xAA, 0x1E, 0xF1, 0x91, 0x40, 0x6C, 0x38, 0xB8, 0x5F, 0x38, 0x4B, 0xCD, 0xCB, 0xF1, 0x74, 0x9F,
+    0x57, 0x1F, 0x68, 0xD7, 0x14, 0x09, 0xA5, 0x16, 0x97, 0x3E, 0x0E, 0x3A, 0xBB, 0xA4, 0xB5, 0x58,
+    0xF2, 0xDB, 0xF0, 0x41, 0x4C, 0x7B, 0xA1, 0x0D, 0xFC, 0x47, 0x9C, 0x14, 0xC7, 0x97, 0xB1, 0x18,
+    0x14, 0x7B, 0xC1, 0x52, 0xD1, 0x28, 0x56, 0x59, 0x10, 0xD5, 0x04, 0x5A, 0xC5, 0x26, 0x00, 0xDF,
+    0x49, 0x52, 0xAF, 0x28, 0x02, 0x85, 0x34, 0x48, 0x35, 0xD0, 0x87, 0x9E, 0xA7, 0x37, 0x44, 0x8F,
+    0xE9, 0xD4, 0x1B, 0x37, 0xE3, 0xA3, 0x52, 0x0F, 0xD5, 0xDA, 0x4A, 0x56, 0xD5, 0xB9, 0x23, 0xF3,
+    0x82, 0xA7, 0x42, 0x19, 0xDF, 0xFF, 0x31, 0xB6, 0xF0, 0x3F, 0x5C, 0x7E, 0x0B, 0x75, 0x0B, 0xB0,
+    0x0A, 0x41, 0x40, 0x46, 0x86, 0x13, 0x68, 0x04, 0xB6, 0x80, 0x37, 0x2F, 0x00, 0x71, 0xC0, 0x18,
+    0x89, 0x7D, 0xC9, 0x73, 0xEC, 0x30, 0x4D, 0xEF, 0x69, 0x82, 0x9A, 0xCD, 0x69, 0x76, 0xE8, 0xC8,
+    0x32, 0x62, 0xE8, 0x4A, 0xC7, 0x8A, 0xB4, 0x3E, 0xCC, 0xCF, 0xE3, 0xEB, 0xD0, 0xF3, 0xFE, 0xA0,
+    0xF3, 0x27, 0x6A, 0x45, 0xAB, 0xFE, 0xAF, 0x5F, 0x64, 0xD2, 0xF6, 0xAA, 0x36, 0x53, 0xB9, 0x1C,
+    0x0E, 0xDF, 0xF4, 0xFF, 0x30, 0xC0, 0x2C, 0x2F, 0x95, 0x0C, 0x9F, 0x88, 0xD1, 0xD1, 0x53, 0xB5,
+    0x8E, 0xD7, 0xCB, 0x75, 0x5C, 0xAB, 0x4C, 0xAB, 0xBB, 0xC4, 0x8B, 0x44, 0xF7, 0x92, 0xD2, 0x67,
+    0xD5, 0xF2, 0x55, 0x18, 0x2B, 0x71, 0x48, 0x7C, 0xCE, 0xD9, 0x73, 0x8E, 0x6D, 0x91, 0xE4, 0x88,
+    0x13, 0x53, 0x22, 0xCE, 0x2C, 0xC2, 0x7B, 0x29, 0x8E, 0xBD, 0x3A, 0xA4, 0xCE, 0x28, 0xD5, 0x65,
+    0xFF, 0xC1, 0xF5, 0xC7, 0x97, 0x77, 0xB6, 0x42, 0x61, 0xC1, 0xC7, 0xC4, 0x6D, 0x2D, 0x63, 0x50,
+    0x5D, 0xB6, 0xDA, 0x5A, 0x87, 0x74, 0x73, 0x3D, 0x9F, 0x0B, 0x61, 0x61, 0x74, 0x10, 0x3C, 0x0E,
+    0xF4, 0x6F, 0xD7, 0xEF, 0xD5, 0x55, 0xBD, 0x8E, 0xD5, 0x46, 0x14, 0x3E, 0xBE, 0xA3, 0x1B, 0x0B,
+    0x8D, 0x84, 0xD3, 0xA0, 0x14, 0x29, 0xFC, 0x04, 0xE0, 0x17, 0x80, 0x9D, 0x09, 0x4F, 0xB0, 0x05,
+    0x4B, 0xCA, 0x3C, 0x42, 0x28, 0x28, 0x77, 0x33, 0x7E, 0x03, 0x3A, 0x5A, 0x4A, 0xD0, 0xBD, 0x05,
+    0x4D, 0xCA, 0xCD, 0x8E, 0x15, 0x14, 0x51, 0xA4, 0x60, 0x08, 0x45, 0x4A, 0xDC, 0xA4, 0xA1, 0xC1,
+    0x41, 0x2E, 0xBC, 0x57, 0xB6, 0x0F, 0xDF, 0x39, 0xDE, 0xCB, 0x22, 0x84, 0x14, 0x51, 0x50, 0xC4,
+    0x1A, 0x1D, 0x7B, 0xCE, 0x9C, 0x39, 0x3F, 0xDF, 0xF9, 0x71, 0xE0, 0x96, 0x98, 0xFF, 0xE4, 0x89,
+    0x4A, 0x1E, 0xBE, 0x9B, 0x88, 0xBE, 0xEF, 0xA9, 0x6A, 0x88, 0x02, 0xAD, 0x46, 0xA2, 0xBC, 0xFB,
+    0xEF, 0x0D, 0xE3, 0xC1, 0x46, 0x5E, 0xB4, 0x9A, 0x37, 0x9B, 0x6D, 0xF7, 0x85, 0x0A, 0x60, 0xD4,
+    0xF6, 0x39, 0x6E, 0x5B, 0x1E, 0x23, 0x77, 0x19, 0x33, 0xF8, 0x44, 0xD9, 0x28, 0x94, 0x2A, 0x2F,
+    0xD4, 0x74, 0xBA, 0x39, 0x51, 0x6A, 0xF5, 0x9C, 0x16, 0xD6, 0x15, 0x8A, 0xEC, 0x23, 0x3F, 0xE5,
+    0xE4, 0x38, 0x85, 0x3A, 0x8B, 0x54, 0x24, 0x2A, 0x1B, 0xD3, 0x8B, 0x85, 0x49, 0xB4, 0x38, 0x0F,
+    0x2B, 0xC5, 0x6E, 0x13, 0x1B, 0xA3, 0xAE, 0xCE, 0x47, 0x77, 0xF7, 0xCC, 0x4F, 0x25, 0x6B, 0x8A,
+    0x14, 0xE7, 0x8C, 0xE7, 0xC8, 0x75, 0x54, 0x37, 0x6C, 0xFA, 0x60, 0xBD, 0x17, 0x72, 0x2C, 0xE4,
+    0xBA, 0x90, 0xAB, 0xE4, 0xB8, 0xC3, 0x62, 0xAE, 0xB1, 0x7E, 0x4E, 0x84, 0x15, 0x24, 0x20, 0x28,
+    0xC2, 0x82, 0x4E, 0xAC, 0xB2, 0x91, 0xA5, 0xEC, 0xC5, 0x84, 0x19, 0x84, 0x5D, 0xF4, 0x7A, 0x72,
+    0x7E, 0xC4, 0x24, 0xC8, 0x21, 0xD2, 0x52, 0x3C, 0x23, 0xF2, 0xA5, 0xC6, 0x16, 0x2E, 0x01, 0xC8,
+    0xD5, 0xF6, 0x47, 0x6C, 0xC1, 0x4B, 0x50, 0x6F, 0xF4, 0xD2, 0x9E, 0x4B, 0xE3, 0x25, 0x4C, 0x85,
+    0x0A, 0xDF, 0x50, 0xF6, 0x7D, 0xA5, 0x35, 0x01, 0x25, 0xC3, 0x3B, 0x1E, 0x0A, 0x7E, 0x19, 0x29,
+    0xEF, 0x21, 0x5E, 0x34, 0x90, 0x76, 0x22, 0x8C, 0xC0, 0xE5, 0xE6, 0x8C, 0xEF, 0x8C, 0x1F, 0x46,
+    0x51, 0x0E, 0x6D, 0x4F, 0x1F, 0x77, 0x7B, 0x5D, 0x6E, 0x6F, 0x00, 0x17, 0x71, 0x3A, 0x8B, 0xE5,
+    0xF1, 0xC2, 0xF0, 0x20, 0x66, 0x5B, 0x91, 0x94, 0x44, 0xDD, 0x12, 0xD6, 0x3D, 0xC0, 0x26, 0xD1,
+    0xC4, 0x09, 0x56, 0x71, 0x00, 0x57, 0x43, 0x4F, 0x19, 0x27, 0x32, 0x5C, 0x93, 0xC3, 0x8D, 0x03,
+    0x00, 0xF1, 0xB6, 0x21, 0xF3, 0x22, 0xD1, 0x31, 0x14, 0x1D, 0x9F, 0x51, 0xF1, 0xA0, 0xA1, 0xFC,
+    0x79, 0x47, 0x3D, 0xB6, 0xA7, 0x8E, 0x2A, 0xD8, 0xB5, 0xBF, 0x0F, 0xA6, 0x45, 0xB0, 0xA7, 0x65,
+    0x73, 0x13, 0x69, 0x28, 0xEA, 0xD1, 0x36, 0xBF, 0xC1, 0xA0, 0x4D, 0x83, 0x6D, 0xB1, 0x75, 0x05,
+    0xFD, 0x82, 0xAC, 0x98, 0x77, 0x5D, 0x8E, 0xAD, 0xAF, 0x4E, 0x04, 0xFB, 0x9E, 0x58, 0xE2, 0x2A,
+    0x7D, 0x31, 0xC0, 0xED, 0x55, 0x47, 0xC1, 0x63, 0x5B, 0x91, 0xC6, 0x8A, 0x54, 0xDF, 0x40, 0x06,
+    0x72, 0x71, 0x3E, 0xE7, 0x49, 0x33, 0x7C, 0x51, 0x6D, 0x5A, 0x93, 0xF2, 0x38, 0xAD, 0xB7, 0x7D,
+    0xC1, 0x5D, 0x54, 0x1C, 0xD9, 0x9A, 0x3E, 0xAA, 0x39, 0x14, 0x9D, 0x93, 0xF8, 0x07, 0x07, 0x28,
+    0xB8, 0x37, 0x8C, 0xE0, 0x6A, 0xF3, 0xD6, 0xCB, 0x7A, 0xDD, 0xE4, 0xAF, 0xBD, 0xF9, 0x3B, 0x15,
+    0x3F, 0x79, 0xF3, 0xAA, 0x2B, 0x4A, 0x6F, 0xFE, 0xEA, 0xAF, 0x83, 0xA6, 0xE1, 0xA6, 0xD0, 0xD3,
+    0x5F, 0x85, 0xBA, 0x4E, 0x68, 0xD5, 0x0A, 0x2D, 0x1B, 0xA1, 0x45, 0x0D, 0xDA, 0xAE, 0xA9, 0xAC,
+    0x2B, 0xD1, 0x06, 0xDF, 0x00, 0xD6, 0x74, 0x99, 0xD9, 0x6C, 0x50, 0x27, 0xD5, 0xBE, 0xC2, 0x4D,
+    0x46, 0xFD, 0x36, 0x70, 0x17, 0x1D, 0xF3, 0x9C, 0xCF, 0x97, 0xCA, 0x5B, 0x6A, 0xEE, 0x8B, 0x3E,
+    0x7D, 0xC5, 0xFF, 0x0A, 0x0A, 0xB6, 0x36, 0x49, 0x03, 0x17, 0x83, 0x13, 0x9D, 0x49, 0xD9, 0xED,
+    0xA4, 0xC0, 0xB2, 0x38, 0xD3, 0xE7, 0x9F, 0x4C, 0xFD, 0xC9, 0x96, 0xE3, 0x05, 0xC8, 0xA0, 0x6D,
+    0x52, 0x9D, 0x69, 0x21, 0x3E, 0xD2, 0x16, 0x7A, 0xD6, 0xAB, 0xD3, 0x51, 0x44, 0x7B, 0xAD, 0xE4,
+    0xD1, 0x48, 0x38, 0x07, 0x24, 0xAC, 0x4A, 0xDA, 0x50, 0xAA, 0x11, 0xAC, 0x7C, 0xB7, 0x81, 0x41,
+    0x69, 0xD3, 0x04, 0xAD, 0x9B, 0x2D, 0x58, 0xC8, 0x78, 0xD4, 0x0A, 0x84, 0x14, 0x66, 0x81, 0x19,
+    0xB5, 0x24, 0x83, 0xF6, 0x45, 0xD9, 0x96, 0x10, 0x8C, 0xFC, 0x82, 0x7B, 0x0A, 0xDC, 0x59, 0x9F,
+    0xD7, 0xC0, 0x49, 0x24, 0x20, 0x13, 0x7F, 0x1C, 0x96, 0x5A, 0xCD, 0x8E, 0xF6, 0xEE, 0xCA, 0x87,
+    0xC4, 0x12, 0x50, 0x00, 0x65, 0xAA, 0xC4, 0xE4, 0x04, 0xA5, 0xA8, 0xA6, 0x43, 0x0D, 0x17, 0x1F,
+    0x74, 0x6D, 0x46, 0xBC, 0x32, 0x14, 0xE7, 0x99, 0x5C, 0xB2, 0x2D, 0xF0, 0x38, 0x83, 0x39, 0xDB,
+    0xE6, 0xD2, 0x21, 0x2E, 0x85, 0xF3, 0xDB, 0xCC, 0x61, 0xB4, 0xFC, 0x92, 0x69, 0xED, 0xB3, 0x0F,
+    0x48, 0x0C, 0x5A, 0x31, 0x7C, 0x5B, 0xB0, 0x70, 0x29, 0x22, 0x2D, 0x79, 0x5B, 0xD4, 0xFF, 0x07,
+    0xD8, 0x32, 0xBF, 0x86, 0x17, 0x22, 0xD1, 0xB9, 0x86, 0x66, 0x28, 0x54, 0xCE, 0xE5, 0xF3, 0x95,
+    0x60, 0x63, 0xF5, 0x57, 0xDD, 0xC6, 0x58, 0x40, 0x15, 0xEF, 0x36, 0x82, 0x88, 0xC5, 0x60, 0x90,
+    0x30, 0x4F, 0x30, 0x88, 0xA0, 0xD8, 0xBC, 0x43, 0xA1, 0x02, 0xCD, 0xD2, 0x2E, 0xBD, 0x37, 0x54,
+    0xCD, 0xF2, 0x0F, 0x88, 0xBA, 0x3D, 0x58, 0xFA, 0x76, 0xD5, 0x59, 0x86, 0x75, 0xF4, 0x7D, 0xA5,
+    0xCA, 0x46, 0x8A, 0x9B, 0x27, 0x02, 0xCC, 0x56, 0x8F, 0xDD, 0x32, 0x5D, 0x57, 0xF2, 0x13, 0x10,
+    0x80, 0x65, 0xCE, 0xD3, 0xB7, 0x90, 0xC2, 0xED, 0x55, 0xC2, 0xF8, 0x80, 0xF2, 0xC2, 0x03, 0x2D,
+    0x28, 0x3F, 0x59, 0xC1, 0x3A, 0xDF, 0xDD, 0x76, 0xF8, 0xAF, 0x04, 0xB8, 0xF6, 0x8C, 0x27, 0xF9,
+    0xC7, 0xC1, 0xB5, 0xF5, 0x21, 0x5D, 0x93, 0x79, 0xFD, 0x03, 0x70, 0x08, 0xDA, 0x33, 0xC1, 0xC7,
+    0x21, 0x1F, 0x5C, 0x5D, 0x80, 0x61, 0x13, 0x26, 0x73, 0x91, 0x0E, 0xA1, 0x1A, 0x73, 0x86, 0xAA,
+    0x3F, 0xB6, 0x13, 0x7D, 0x13, 0x71, 0x53, 0xB4, 0xBC, 0xB9, 0x43, 0xFC, 0x8F, 0x60, 0xC5, 0x54,
+    0xD5, 0x92, 0x17, 0xCD, 0x43, 0x03, 0x1C, 0xE5, 0x2B, 0x00, 0x06, 0x68, 0xE5, 0xA3, 0xD3, 0x8A,
+    0x27, 0x48, 0xAF, 0x78, 0x30, 0x30, 0x08, 0x7B, 0xEB, 0x3B, 0xF4, 0x75, 0x9F, 0xF7, 0xCD, 0x55,
+    0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0xC9, 0xC5, 0x82, 0x15, 0x9A, 0x14, 0x09, 0x42, 0x4A,
+    0x31, 0x4D, 0x2A, 0x90, 0x70, 0x43, 0x79, 0x39, 0x5B, 0x49, 0x41, 0x7B, 0xC5, 0x6D, 0xC3, 0x15,
+    0x34, 0x34, 0x5C, 0x43, 0x4B, 0x93, 0xD8, 0x07, 0x45, 0xDA, 0x14, 0xF0, 0x13, 0x28, 0xB2, 0x14,
+    0xDB, 0xD0, 0xDE, 0xDA, 0x52, 0x8A, 0x14, 0x29, 0x18, 0x89, 0x92, 0xC6, 0x42, 0x41, 0x91, 0xD2,
+    0x60, 0x84, 0x13, 0x7C, 0x64, 0xEC, 0xC7, 0xF7, 0xE6, 0x36, 0x97, 0x43, 0x0A, 0x35, 0xAC, 0xCE,
+    0xB3, 0xF7, 0xDE, 0xCE, 0x9B, 0xF7, 0xBD, 0xEF, 0x7D, 0x6F, 0x8C, 0x1F, 0xF0, 0x25, 0x16, 0x3E,
+    0x1D, 0xE0, 0x5A, 0xEB, 0x51, 0xBC, 0x9C, 0x01, 0x27, 0x1E, 0x40, 0x89, 0xD7, 0x9F, 0x4A, 0x44,
+    0x7E, 0xE1, 0x23, 0xC7, 0xD5, 0xB3, 0x95, 0xA0, 0x01, 0x42, 0x1A, 0x90, 0x76, 0x8B, 0x1E, 0x59,
+    0x99, 0xB7, 0xDC, 0x41, 0x17, 0xE8, 0x02, 0xE8, 0x02, 0x72, 0x91, 0x1E, 0x8D, 0x48, 0x9D, 0xCE,
+    0xAB, 0x07, 0x5B, 0xD7, 0xC5, 0x5D, 0x57, 0xE8, 0x4A, 0x3D, 0x5D, 0xB6, 0xA6, 0xEB, 0x4E, 0x3A,
+    0x7D, 0xF2, 0xFD, 0x73, 0x3D, 0xFE, 0xB1, 0x2E, 0x48, 0x5B, 0xE3, 0xF3, 0xD2, 0xB6, 0x1B, 0x54,
+    0x98, 0x0F, 0x07, 0x88, 0x94, 0xB8, 0xB6, 0x85, 0x73, 0xA0, 0x60, 0x4A, 0x4B, 0xD7, 0x0C, 0xC9,
+    0x3A, 0x4C, 0x05, 0xD2, 0x31, 0x20, 0x7B, 0xFA, 0x7C, 0xF9, 0xC5, 0x5A, 0x64, 0x66, 0xD2, 0x17,
+    0x23, 0x51, 0x74, 0x2C, 0x83, 0x19, 0x0B, 0x86, 0x31, 0x3A, 0x91, 0x5F, 0x0F, 0x6F, 0x89, 0x84,
+    0x44, 0x58, 0xDA, 0xB5, 0x7D, 0x20, 0x59, 0xC6, 0xAA, 0x9E, 0xC0, 0x30, 0x06, 0xEE, 0xF4, 0x5D,
+    0x69, 0xB9, 0xB5, 0xEA, 0x6E, 0x02, 0x76, 0xB8, 0x01, 0x98, 0xF0, 0xAA, 0x9E, 0x64, 0xD2, 0xB4,
+    0xB3, 0x2E, 0x12, 0x97, 0xF7, 0x57, 0xAB, 0x95, 0x14, 0x0A, 0xB4, 0xD2, 0xFF, 0x2A, 0xFD, 0x55,
+    0x97, 0x89, 0x4B, 0x12, 0x0A, 0xC6, 0x8E, 0x45, 0x8D, 0xAC, 0xCF, 0x3D, 0x5C, 0x67, 0x4F, 0x93,
+    0xA6, 0x8E, 0x39, 0x48, 0x07, 0x31, 0x5D, 0x7E, 0xC0, 0x9D, 0xAC, 0x65, 0x21, 0x03, 0xB1, 0x0C,
+    0xF6, 0xBE, 0x1B, 0x3E, 0x82, 0x25, 0x3F, 0xE4, 0x1E, 0x0C, 0xC3, 0x46, 0x33, 0xF2, 0xEC, 0x97,
+    0x7C, 0x7E, 0x7B, 0xB6, 0xDA, 0x6C, 0x90, 0xB2, 0x1E, 0xFB, 0xA8, 0x47, 0x65, 0xFB, 0xAC, 0xD7,
+    0xC2, 0x17, 0xE4, 0x36, 0x39, 0x78, 0xD5, 0x9A, 0xBB, 0x20, 0x4A, 0xB9, 0x45, 0x94, 0x92, 0x4E,
+    0x6A, 0x8E, 0x17, 0xFA, 0xF6, 0x9F, 0xD6, 0xB9, 0x53, 0xEE, 0xA0, 0x2A, 0xA7, 0x74, 0xCE, 0xC6,
+    0x6C, 0x70, 0x3E, 0xC1, 0xA5, 0x73, 0x58, 0x3B, 0xFB, 0x48, 0x65, 0x22, 0xB0, 0xC9, 0x3C, 0xC9,
+    0xA6, 0x77, 0x22, 0x0C, 0x33, 0x10, 0x13, 0x43, 0x73, 0xB2, 0x50, 0x51, 0x70, 0xB3, 0xB2, 0xF0,
+    0xD7, 0x6A, 0xBD, 0xAE, 0x71, 0xB2, 0x81, 0xF9, 0x3D, 0xC0, 0x3D, 0x0C, 0x49, 0x60, 0x12, 0x9F,
+    0x0A, 0xF7, 0x2F, 0x2F, 0xD6, 0x89, 0xBB, 0x49, 0x88, 0xDF, 0x45, 0x2B, 0x51, 0x29, 0xB6, 0x2F,
+    0x7C, 0x24, 0x60, 0xA0, 0x48, 0xFE, 0xFD, 0xC3, 0xA4, 0x8D, 0x78, 0xC3, 0x66, 0x94, 0x85, 0xF4,
+    0x46, 0x50, 0x91, 0xE8, 0x3A, 0x95, 0xFA, 0xAD, 0x0D, 0x5B, 0x92, 0x4C, 0xFB, 0x9C, 0x0D, 0xEE,
+    0xD1, 0xB3, 0x03, 0x26, 0xDC, 0xD1, 0x93, 0xCB, 0xA2, 0xDC, 0x53, 0xD6, 0x7A, 0xEB, 0x73, 0x3D,
+    0xE3, 0xA6, 0x19, 0xAC, 0xE6, 0xCC, 0xDA, 0x69, 0xD1, 0x46, 0xEA, 0x24, 0x0E, 0x90, 0x4E, 0x4D,
+    0x04, 0x55, 0xDC, 0x1E, 0x54, 0x87, 0xAC, 0x6C, 0xCA, 0x74, 0x14, 0x1C, 0x7B, 0xA0, 0x44, 0xDB,
+    0xCE, 0x7A, 0xE7, 0x75, 0x64, 0xCC, 0xA0, 0x3D, 0xC8, 0x46, 0xA6, 0x28, 0x5A, 0x65, 0xA3, 0x28,
+    0x17, 0x23, 0xCC, 0xA4, 0xB2, 0x90, 0xD2, 0xCC, 0x30, 0xA7, 0x70, 0x03, 0xE1, 0xE5, 0x32, 0xA4,
+    0x72, 0x5B, 0x60, 0xC9, 0x9E, 0x1B, 0x3F, 0x3F, 0x2B, 0xE2, 0x33, 0xE0, 0x2A, 0xF6, 0xB5, 0x9A,
+    0x51, 0x09, 0x84, 0xEB, 0x2B, 0xC5, 0x71, 0x96, 0x04, 0x57, 0xE2, 0x4F, 0xFF, 0x10, 0x45, 0x19,
+    0x17, 0xE7, 0x9D, 0xB4, 0x79, 0x5B, 0xF9, 0x6A, 0x4E, 0x05, 0x9F, 0xB6, 0xAE, 0x75, 0xDF, 0x70,
+    0x20, 0xF7, 0x54, 0x41, 0x0E, 0xA3, 0xD6, 0xF2, 0xA1, 0x51, 0xA5, 0x60, 0xD7, 0x7E, 0xA5, 0xB8,
+    0x37, 0xCD, 0x9A, 0x91, 0x67, 0x5D, 0x46, 0x7E, 0xAF, 0x8F, 0xAC, 0xD8, 0xE3, 0xA0, 0xEA, 0xDD,
+    0xD3, 0xF6, 0x55, 0x18, 0x59, 0xA0, 0x19, 0x4C, 0x47, 0x1C, 0x45, 0x6B, 0x6B, 0xEB, 0x4D, 0x48,
+    0xA5, 0x73, 0x5D, 0xD1, 0xE6, 0xCC, 0xD5, 0x45, 0xD5, 0xEE, 0x9C, 0xA1, 0x38, 0x49, 0x46, 0xED,
+    0x96, 0x76, 0xAA, 0x4D, 0x87, 0xCC, 0xBF, 0xC6, 0xC7, 0x01, 0xE5, 0x70, 0xB4, 0x99, 0xC8, 0x94,
+    0xCC, 0x65, 0xD3, 0x9E, 0x90, 0x19, 0x32, 0x3D, 0x13, 0x51, 0x7E, 0xDC, 0x45, 0x91, 0x68, 0x36,
+    0xA5, 0x8C, 0x5D, 0x8F, 0x62, 0xA8, 0xC8, 0xF8, 0xE5, 0xB5, 0x4A, 0x58, 0x4B, 0xCF, 0xC6, 0xAD,
+    0x94, 0x8B, 0xC7, 0xC4, 0xF6, 0xD4, 0x23, 0xFB, 0x33, 0x90, 0xD5, 0xC6, 0x67, 0x13, 0x07, 0x48,
+    0x75, 0xC7, 0x0D, 0x47, 0xFB, 0x44, 0x72, 0xD5, 0x84, 0x05, 0xF3, 0x8B, 0x7E, 0xD1, 0x3A, 0x67,
+    0xE8, 0x00, 0x99, 0x10, 0xB9, 0xF4, 0x7B, 0x68, 0xBE, 0x2E, 0x53, 0x65, 0xA4, 0x66, 0xC7, 0x75,
+    0xBE, 0x16, 0xD2, 0x52, 0x33, 0xC0, 0x75, 0xAD, 0x9B, 0xC9, 0xA6, 0x1B, 0xB0, 0x3F, 0xB7, 0x08,
+    0x33, 0xAA, 0x7B, 0xC2, 0x5A, 0x65, 0x50, 0x79, 0x3B, 0x8A, 0x60, 0xC1, 0xE7, 0x27, 0x59, 0xAD,
+    0x49, 0x54, 0xC6, 0x83, 0x32, 0xCA, 0x84, 0x4A, 0xAB, 0x15, 0xFB, 0xF9, 0x33, 0xEB, 0xE5, 0x44,
+    0xDC, 0x1F, 0xE8, 0xD4, 0x64, 0x53, 0x54, 0xF0, 0xF6, 0x12, 0x8D, 0x06, 0x09, 0x77, 0x8F, 0xE8,
+    0xF8, 0x63, 0x60, 0xBC, 0xDC, 0xBF, 0x1E, 0x9C, 0x8A, 0xAA, 0x61, 0x92, 0xE4, 0xA8, 0xD4, 0x2C,
+    0x23, 0xEF, 0xDA, 0x90, 0x7F, 0x7B, 0x38, 0xEE, 0x91, 0x98, 0x5D, 0x6A, 0xEC, 0xBD, 0x78, 0x87,
+    0x10, 0xB1, 0x6A, 0xCD, 0x6E, 0xEF, 0xC0, 0x6A, 0x52, 0x8E, 0x74, 0xB2, 0x3A, 0x9D, 0xFC, 0xB3,
+    0xC1, 0xDF, 0x12, 0xB8, 0x7D, 0x2E, 0xF1, 0x22, 0xDD, 0x65, 0x50, 0x55, 0xE6, 0x9E, 0x63, 0x5F,
+    0x2F, 0x14, 0xD6, 0x91, 0x4A, 0x65, 0xB9, 0x54, 0x05, 0x31, 0x97, 0xAA, 0x5E, 0x14, 0x28, 0x76,
+    0x96, 0x07, 0x6F, 0x9C, 0xA7, 0x4C, 0x6F, 0x19, 0x09, 0x9C, 0xA9, 0x44, 0x5F, 0x16, 0x1E, 0x49,
+    0x53, 0x46, 0x69, 0xF7, 0xF1, 0x05, 0x20, 0x31, 0x67, 0x11, 0x0D, 0x1B, 0x0D, 0xF3, 0x32, 0x1A,
+    0xBC, 0x54, 0x68, 0x14, 0x1F, 0xAB, 0x61, 0xBD, 0x1A, 0x66, 0x88, 0x31, 0x6C, 0x16, 0x8D, 0xA2,
+    0x54, 0xE3, 0x47, 0xAF, 0x06, 0x4B, 0x57, 0x63, 0x46, 0x34, 0xEA, 0x68, 0x74, 0xD1, 0xD8, 0xE6,
+    0xA1, 0x92, 0x9A, 0xB2, 0x22, 0xCC, 0x86, 0xEF, 0x93, 0x08, 0x07, 0x6F, 0xAF, 0xBE, 0x23, 0x87,
+    0x2C, 0x4A, 0xD5, 0xEB, 0xDF, 0x88, 0x9C, 0xF7, 0x11, 0xFF, 0xD8, 0xD8, 0x46, 0x78, 0x15, 0x92,
+    0x92, 0x42, 0x5F, 0x57, 0xE4, 0xAF, 0x69, 0x0D, 0xDF, 0x65, 0x3D, 0xE7, 0xFF, 0x44, 0x9D, 0xA1,
+    0xA2, 0x33, 0x38, 0x3A, 0x03, 0x93, 0x4D, 0xA3, 0xEE, 0x1C, 0x99, 0xDD, 0x8E, 0x9C, 0x6B, 0x33,
+    0x2A, 0x82, 0xC0, 0x70, 0xC2, 0x34, 0xF2, 0x22, 0x9E, 0x89, 0xFF, 0xF3, 0xE7, 0x6F, 0xD5, 0x55,
+    0xB1, 0x8A, 0xD5, 0x50, 0x10, 0x9D, 0xBC, 0xB0, 0x1B, 0x30, 0x48, 0x2C, 0x14, 0xC1, 0x45, 0xD2,
+    0x58, 0x6D, 0x13, 0xFF, 0xE0, 0x06, 0xFD, 0x00, 0xB7, 0xD8, 0x20, 0x68, 0xB1, 0xB5, 0x95, 0x5F,
+    0xE0, 0xCB, 0x03, 0x7F, 0xC0, 0x42, 0xFF, 0xC0, 0x2A, 0x16, 0xD6, 0x82, 0x9A, 0x88, 0x85, 0xC5,
+    0x36, 0x01, 0x0B, 0xDB, 0x80, 0xFB, 0x01, 0x41, 0xAE, 0x10, 0x35, 0xC9, 0x78, 0xCE, 0x3C, 0x5D,
+    0x97, 0xF5, 0x81, 0xE0, 0x16, 0xE2, 0x2D, 0xE6, 0x65, 0xE6, 0xCD, 0x9D, 0x39, 0x73, 0x66, 0x32,
+    0x11, 0x59, 0x9F, 0x74, 0x55, 0x42, 0x86, 0x63, 0xE2, 0xF1, 0xE3, 0x1A, 0xCD, 0x45, 0x02, 0x1F,
+    0x75, 0xB2, 0xE9, 0x94, 0xDA, 0x05, 0xAA, 0x87, 0x3A, 0x49, 0xAA, 0xC3, 0xE5, 0x49, 0x64, 0xC7,
+    0x4B, 0xD6, 0xC0, 0x2E, 0x8B, 0x51, 0x24, 0xE9, 0xA9, 0x84, 0x6A, 0x8A, 0x9A, 0xE2, 0x6A, 0x2A,
+    0xC9, 0x07, 0x2A, 0xA1, 0x37, 0xB7, 0x29, 0xA2, 0xE2, 0x72, 0x2A, 0x49, 0x4B, 0xE5, 0xAD, 0xB7,
+    0x00, 0x93, 0x50, 0x41, 0x7E, 0x28, 0xDA, 0x99, 0x32, 0x58, 0xE8, 0x59, 0x4C, 0x59, 0xE7, 0x41,
+    0xD2, 0xD8, 0x47, 0x3A, 0x4B, 0xAC, 0x63, 0x6D, 0x70, 0x1A, 0xD9, 0x92, 0x8B, 0xCC, 0xEE, 0x1A,
+    0x96, 0xD1, 0x8B, 0xCC, 0x21, 0x2E, 0x9A, 0xF1, 0xD4, 0xA9, 0x35, 0xAF, 0xF5, 0xBE, 0x36, 0x99,
+    0x36, 0x25, 0xF3, 0x24, 0x0D, 0x71, 0x21, 0x76, 0x2F, 0xA3, 0x64, 0xA3, 0x38, 0xC9, 0x68, 0x74,
+    0x29, 0x8C, 0x0E, 0x39, 0x47, 0x17, 0xC0, 0xB8, 0xA4, 0xE7, 0x2C, 0x30, 0xCE, 0x04, 0x32, 0x0B,
+    0x8D, 0x04, 0x53, 0x4F, 0xA2, 0x93, 0xC5, 0xCC, 0x7F, 0x24, 0x88, 0x7A, 0x84, 0x94, 0xC4, 0x67,
+    0x9D, 0xC9, 0x16, 0x96, 0x2E, 0x59, 0x9D, 0x42, 0xB1, 0xB5, 0x07, 0xB1, 0x50, 0x7D, 0x04, 0xF2,
+    0x55, 0xC1, 0x55, 0x7D, 0xB4, 0xA3, 0x56, 0xA6, 0x36, 0x11, 0x90, 0xBB, 0x8E, 0x45, 0x24, 0x7D,
+    0xDA, 0xB2, 0x56, 0x54, 0x25, 0xD1, 0xE0, 0x56, 0xEC, 0x91, 0xCB, 0x29, 0x01, 0x1D, 0x74, 0x9D,
+    0x96, 0xB0, 0xD3, 0x67, 0xA0, 0x7F, 0xE8, 0x1D, 0xEF, 0xF6, 0x29, 0xE3, 0x74, 0xEC, 0x6C, 0xD6,
+    0x44, 0x60, 0xAE, 0xCE, 0x17, 0xDA, 0x46, 0x33, 0x1B, 0xA9, 0x30, 0xC6, 0xAA, 0xC4, 0x76, 0x07,
+    0x40, 0x64, 0x2F, 0xC8, 0xE1, 0x54, 0x4A, 0x38, 0xC5, 0xDE, 0x1E, 0xCC, 0xF2, 0xEB, 0x5C, 0x82,
+    0x92, 0x69, 0x4B, 0xC4, 0x0D, 0x1A, 0x30, 0x83, 0x30, 0x14, 0xB8, 0x12, 0xF7, 0xB0, 0x27, 0x00,
+    0x94, 0x72, 0xD8, 0x83, 0x98, 0x1A, 0x09, 0xF1, 0x20, 0x7C, 0x48, 0xDF, 0x79, 0x58, 0x80, 0xDC,
+    0xDD, 0x64, 0x6F, 0x93, 0x01, 0xCD, 0x43, 0xE2, 0x5C, 0x2C, 0xED, 0xBD, 0xFC, 0x4F, 0x54, 0x78,
+    0xA3, 0xA2, 0x33, 0x2A, 0x9A, 0x9F, 0x54, 0xA0, 0xC0, 0x93, 0x24, 0x54, 0x55, 0xF5, 0x6C, 0x44,
+    0x50, 0x5C, 0x2E, 0x9F, 0x14, 0xC5, 0xED, 0x93, 0x84, 0xAC, 0x49, 0xB3, 0x5B, 0xA0, 0xA2, 0xDB,
+    0x40, 0x45, 0xFC, 0x1B, 0x15, 0xC4, 0x13, 0xEC, 0x13, 0xD3, 0x24, 0x01, 0x11, 0xD5, 0x79, 0xD9,
+    0xA1, 0xA7, 0xF5, 0x0D, 0xCF, 0x80, 0x2C, 0xAA, 0x63, 0x75, 0x55, 0xF5, 0xFC, 0x90, 0x49, 0xEB,
+    0xA2, 0x38, 0xB0, 0x7A, 0xC9, 0xC0, 0xDB, 0x41, 0x16, 0x4C, 0x57, 0x8A, 0xE6, 0x59, 0x1B, 0x31,
+    0x70, 0xA2, 0x68, 0xE8, 0xF6, 0xE3, 0x63, 0x1A, 0xCF, 0x3E, 0x20, 0xFF, 0x8A, 0x95, 0xBF, 0x18,
+    0x90, 0xD8, 0x67, 0xB9, 0x0D, 0x48, 0x30, 0x2E, 0x39, 0x17, 0x5F, 0xAB, 0x0A, 0xEF, 0x2C, 0x16,
+    0xC8, 0xE7, 0xA2, 0xB0, 0x49, 0x79, 0xD7, 0xAF, 0x07, 0x24, 0xBB, 0x39, 0x92, 0x19, 0xFF, 0xFB,
+    0x80, 0xB0, 0x1D, 0x03, 0x5E, 0x3A, 0xDB, 0x4F, 0x26, 0x36, 0x2D, 0xA7, 0xA0, 0x06, 0x57, 0x89,
+    0x72, 0x2F, 0x7D, 0xB9, 0xAB, 0x79, 0xBA, 0x92, 0xB2, 0x4D, 0x73, 0x49, 0xFB, 0x94, 0x04, 0x25,
+    0x64, 0x86, 0x8C, 0x52, 0x04, 0xD3, 0x5A, 0xA4, 0xF4, 0xC6, 0x95, 0x59, 0xCE, 0x55, 0xD5, 0x74,
+    0xFC, 0xC7, 0xB1, 0x5F, 0x38, 0x5C, 0x25, 0x41, 0x8E, 0xFC, 0xE0, 0xC5, 0x2A, 0x1B, 0xE7, 0xB7,
+    0x15, 0x05, 0xA2, 0x1D, 0xDB, 0xD6, 0x99, 0x4B, 0xFB, 0xEB, 0x1D, 0x53, 0x2F, 0x46, 0xE2, 0x8A,
+    0xFB, 0xAC, 0x39, 0xB9, 0x72, 0xD0, 0xC3, 0x6D, 0x65, 0x39, 0x73, 0x78, 0x14, 0x4D, 0xE7, 0x0D,
+    0x41, 0xC4, 0xD7, 0x11, 0x2D, 0x77, 0xAB, 0x14, 0x79, 0x4B, 0x8C, 0x46, 0x71, 0x80, 0x5A, 0x40,
+    0x92, 0x8C, 0xD7, 0x24, 0xFC, 0xD4, 0x8B, 0xBB, 0xE5, 0xA3, 0x91, 0x0C, 0xA6, 0xA0, 0x9F, 0x73,
+    0x28, 0x52, 0x14, 0xB9, 0x0D, 0x03, 0x1C, 0x43, 0x05, 0xBF, 0x12, 0x98, 0x65, 0xC3, 0x6E, 0xEE,
+    0x43, 0x9D, 0x6B, 0xCA, 0x29, 0x46, 0x2D, 0x59, 0xCB, 0x5D, 0x89, 0xD8, 0xE8, 0xA6, 0x6D, 0x2B,
+    0x79, 0xC5, 0xCC, 0x68, 0x0B, 0x36, 0x59, 0xE0, 0x59, 0x17, 0x36, 0x1F, 0x30, 0x45, 0x2D, 0xAB,
+    0xE5, 0x58, 0x06, 0x63, 0xCA, 0xC8, 0x73, 0x66, 0xF1, 0x1E, 0x50, 0x3A, 0x72, 0x21, 0xF6, 0x6D,
+    0x00, 0x1B, 0x36, 0xC1, 0xAD, 0x59, 0xE0, 0x2E, 0xD7, 0xCD, 0x71, 0xF9, 0xDA, 0x56, 0xEB, 0x60,
+    0x97, 0xAC, 0x35, 0x57, 0x0C, 0xD0, 0x6E, 0xF5, 0x94, 0x1B, 0x17, 0x76, 0x9B, 0xA5, 0x8D, 0x90,
+    0x57, 0xF5, 0x4C, 0xC1, 0x91, 0x8A, 0xFA, 0xD0, 0x4B, 0xDC, 0x62, 0x75, 0x27, 0x0D, 0xDA, 0x80,
+    0x1E, 0x4E, 0x6B, 0xDC, 0x4B, 0xE2, 0x7F, 0x89, 0x52, 0x56, 0x08, 0x95, 0xBC, 0x21, 0xF2, 0xF7,
+    0x04, 0xFE, 0x91, 0xB8, 0xBF, 0x11, 0xB6, 0xAD, 0x5F, 0x65, 0x44, 0x83, 0x62, 0x6D, 0x66, 0x46,
+    0xD6, 0x77, 0x81, 0x48, 0x5F, 0xD4, 0xF0, 0x50, 0x36, 0x58, 0x59, 0xC3, 0xEE, 0x09, 0xFE, 0x16,
+    0x3E, 0x06, 0xE6, 0xC8, 0xBE, 0x1B, 0x6B, 0xB9, 0xE8, 0xE3, 0xF6, 0x7F, 0xE0, 0xF7, 0x8C, 0xE7,
+    0x3B, 0xCD, 0x55, 0xB1, 0x8E, 0xD6, 0x46, 0x10, 0x1E, 0x7B, 0x03, 0x8E, 0x64, 0x45, 0x4E, 0x91,
+    0x20, 0x74, 0x05, 0xEE, 0x29, 0x70, 0x5E, 0x20, 0xF1, 0x36, 0xE9, 0x69, 0xA0, 0x4D, 0x45, 0x7D,
+    0x2F, 0x90, 0x9C, 0x0D, 0x4D, 0xDA, 0x6B, 0xE0, 0x0D, 0x10, 0x88, 0x86, 0x3A, 0xD2, 0xE5, 0x76,
+    0x93, 0x27, 0x30, 0xCA, 0x0B, 0xFC, 0x52, 0x94, 0x86, 0x14, 0x38, 0x91, 0xA5, 0x98, 0x60, 0x7B,
+    0xF2, 0x7D, 0xB3, 0xF7, 0x87, 0x83, 0x03, 0x29, 0x52, 0x1A, 0x2C, 0xDF, 0xFC, 0x7B, 0x3B, 0xB3,
+    0xB3, 0xDF, 0xCC, 0x7C, 0x33, 0x96, 0xCF, 0xE4, 0xA6, 0x88, 0xBA, 0xE5, 0x4C, 0x6C, 0x14, 0xB6,
+    0xF7, 0xE6, 0xD3, 0x69, 0x1F, 0x36, 0x8A, 0xB5, 0x9C, 0xA4, 0x18, 0xDD, 0x24, 0xE5, 0xE0, 0x66,
+    0xA9, 0x62, 0xB6, 0x48, 0xDD, 0xCB, 0x2A, 0x2D, 0x6C, 0xE4, 0x48, 0xF0, 0x7B, 0x22, 0xD2, 0xF4,
+    0xB3, 0x48, 0xF5, 0xD3, 0x04, 0xF1, 0xCB, 0x28, 0x52, 0xFC, 0x3A, 0x88, 0xB8, 0x57, 0x51, 0x24,
+    0x53, 0x0F, 0x67, 0x4A, 0x8F, 0xA7, 0x14, 0xB8, 0x4C, 0x32, 0x98, 0x89, 0x83, 0xD9, 0xA7, 0x15,
+    0x2C, 0x7E, 0x08, 0xB0, 0xD0, 0x95, 0x56, 0xD8, 0x92, 0xEB, 0xFE, 0x3C, 0x8A, 0xE3, 0xAC, 0xA7,
+    0x69, 0x09, 0x77, 0xD5, 0xD8, 0x40, 0xB6, 0x43, 0xE8, 0xE1, 0xD4, 0xC1, 0xDE, 0x4D, 0xE5, 0x4E,
+    0x24, 0xEF, 0x2F, 0xBF, 0x0D, 0x7C, 0x74, 0xBA, 0x05, 0xCA, 0xB5, 0x84, 0x59, 0x33, 0xE4, 0x94,
+    0x5E, 0x36, 0x49, 0x98, 0xE5, 0x47, 0x2C, 0x7A, 0x22, 0xA9, 0x23, 0xA1, 0x54, 0x3B, 0x62, 0x29,
+    0xC6, 0x82, 0x98, 0x67, 0x42, 0xCA, 0x96, 0x9A, 0x28, 0xB6, 0xC6, 0xFC, 0x7D, 0x47, 0xD9, 0x12,
+    0xB8, 0x54, 0x44, 0x2E, 0x25, 0x71, 0x0A, 0xCD, 0xB1, 0x03, 0x73, 0xF9, 0xC2, 0x0C, 0x8F, 0x2C,
+    0xC0, 0x30, 0xDB, 0xA1, 0x1D, 0xE5, 0x41, 0x42, 0xE4, 0x3F, 0x86, 0x98, 0x6A, 0x60, 0x9D, 0x5B,
+    0x8F, 0x68, 0x00, 0xA1, 0x1C, 0xE0, 0xAF, 0xBA, 0x07, 0x77, 0xD7, 0x1C, 0xFC, 0x7C, 0x24, 0xFE,
+    0x03, 0x4B, 0x7D, 0xE3, 0x4F, 0xE9, 0x81, 0xE4, 0x28, 0x96, 0x0A, 0xDA, 0x32, 0xD6, 0x5E, 0x2E,
+    0x3C, 0xAD, 0x8E, 0x78, 0x55, 0x7B, 0xBC, 0x87, 0x83, 0xE0, 0xED, 0x88, 0x0D, 0x40, 0xF1, 0x16,
+    0x23, 0xDF, 0x3A, 0xF2, 0xB5, 0x6D, 0x40, 0xC7, 0x36, 0x42, 0xC1, 0x36, 0x52, 0x49, 0xCD, 0xCB,
+    0x5B, 0x00, 0xD8, 0xA8, 0xB2, 0x1A, 0x6A, 0x28, 0x7C, 0x1D, 0x2D, 0x09, 0x14, 0x99, 0x65, 0xBD,
+    0xB0, 0x7C, 0x9F, 0xDB, 0x66, 0x41, 0x25, 0x57, 0xC5, 0x4E, 0xA5, 0x9A, 0xE8, 0x8B, 0xCA, 0xE1,
+    0xAE, 0xB1, 0x8D, 0xA8, 0xED, 0xF6, 0x2E, 0x46, 0x07, 0x75, 0xFA, 0xB7, 0xCE, 0x95, 0x3E, 0x0B,
+    0x52, 0x4C, 0xC8, 0x46, 0x15, 0x91, 0x88, 0x96, 0x15, 0x5C, 0xF0, 0x83, 0xF5, 0xC6, 0x14, 0xEB,
+    0x83, 0x40, 0xD7, 0xB8, 0xF8, 0xE9, 0xA3, 0x71, 0x5F, 0xE0, 0x76, 0x9F, 0x3F, 0x1C, 0x84, 0x76,
+    0x23, 0xD8, 0xA5, 0x53, 0xD5, 0x17, 0xF8, 0xFB, 0xA3, 0x7B, 0x1E, 0x16, 0x70, 0xE2, 0x28, 0x87,
+    0xCF, 0x3E, 0x88, 0x1B, 0x9A, 0x28, 0x13, 0x36, 0xAE, 0xE6, 0x3C, 0x12, 0x98, 0xCD, 0x98, 0x58,
+    0xF3, 0x1F, 0x36, 0x56, 0xFA, 0xDE, 0xA4, 0x44, 0x42, 0x49, 0x4D, 0xD2, 0x5C, 0x8C, 0xB2, 0x52,
+    0xF3, 0x7E, 0xA2, 0x21, 0xAC, 0xAB, 0x0C, 0x48, 0xFF, 0xC4, 0xF5, 0xB1, 0xBB, 0x1F, 0x90, 0xD8,
+    0x13, 0x37, 0x65, 0x63, 0x35, 0xB8, 0xBE, 0x05, 0xDD, 0xD6, 0x74, 0xAC, 0x62, 0xC3, 0x78, 0x79,
+    0xE3, 0xDF, 0x63, 0xB8, 0x5E, 0x70, 0x76, 0x4A, 0xA1, 0x31, 0x32, 0x90, 0x28, 0x23, 0x73, 0x70,
+    0xE1, 0x27, 0xE7, 0x12, 0x56, 0xEC, 0x2C, 0xE5, 0x6E, 0x49, 0xAC, 0xB7, 0x9E, 0x03, 0x0A, 0xFF,
+    0x95, 0xBC, 0xE7, 0x41, 0xE7, 0x31, 0x75, 0x4F, 0x15, 0x84, 0x54, 0x7D, 0xD6, 0xE1, 0xBA, 0x4B,
+    0xEA, 0xAD, 0x5B, 0xDA, 0xDE, 0x22, 0x45, 0x3C, 0x0C, 0x16, 0x0C, 0x60, 0xBC, 0x48, 0xF8, 0xDB,
+    0xCA, 0x87, 0xDE, 0x94, 0x0C, 0xDE, 0x72, 0xB0, 0x26, 0x65, 0x88, 0x76, 0xD2, 0xCD, 0xE9, 0x64,
+    0x48, 0x27, 0xEB, 0x68, 0xCA, 0x62, 0x34, 0x65, 0xB6, 0x24, 0xE5, 0x96, 0x94, 0xC1, 0x43, 0xB9,
+    0xDE, 0xD6, 0xBE, 0x9A, 0x40, 0x2C, 0xF5, 0x9D, 0xFE, 0xAE, 0xFA, 0x12, 0x84, 0x9D, 0xFF, 0xC5,
+    0x7B, 0x33, 0xB3, 0x2E, 0x27, 0xC7, 0xA5, 0x8D, 0x6A, 0x10, 0x30, 0x18, 0xF6, 0x8A, 0x0B, 0x4F,
+    0x50, 0xD0, 0x43, 0x0F, 0x75, 0x87, 0x48, 0x63, 0xE7, 0xD1, 0x1E, 0x96, 0xC2, 0xA6, 0x67, 0x43,
+    0x61, 0x16, 0x2D, 0xEC, 0x70, 0x69, 0xBF, 0xF6, 0xE8, 0x37, 0xF0, 0xD2, 0x43, 0xA1, 0x3A, 0x99,
+    0x22, 0x50, 0x01, 0x6B, 0x28, 0x62, 0x3E, 0xD9, 0x89, 0x13, 0x53, 0xB4, 0xA6, 0xE8, 0x40, 0x1B,
+    0x94, 0xF3, 0xAE, 0xAE, 0x41, 0x37, 0xAF, 0x7A, 0x76, 0x3D, 0x81, 0xB3, 0xC4, 0x7A, 0x49, 0x9F,
+    0xE8, 0x48, 0x8A, 0x31, 0x09, 0x3B, 0x2C, 0xBE, 0xE4, 0x62, 0x20, 0xC7, 0x2C, 0xA1, 0x4C, 0xE3,
+    0xE7, 0x7A, 0xCB, 0x3B, 0x12, 0xF7, 0xBA, 0x3E, 0xE9, 0x53, 0x62, 0xF7, 0xAA, 0x77, 0x2D, 0x08,
+    0x1F, 0x24, 0x68, 0xAC, 0x8B, 0xE4, 0x5B, 0x56, 0xE5, 0x6C, 0x91, 0x95, 0x31, 0x8D, 0xB1, 0x72,
+    0x4B, 0x43, 0xE1, 0xFD, 0x44, 0x3B, 0xD8, 0x1E, 0xA3, 0xD2, 0x53, 0xF6, 0xCD, 0x6F, 0xFE, 0x02,
+    0xD1, 0x80, 0x01, 0xB9, 0x36, 0xA2, 0xE5, 0xBB, 0xC4, 0xAE, 0x1B, 0x22, 0x77, 0x26, 0x50, 0x24,
+    0x4A, 0x91, 0xAA, 0xD0, 0xE8, 0xE2, 0x74, 0x69, 0x74, 0x76, 0x3A, 0x5F, 0x46, 0xD4, 0x48, 0x2A,
+    0xC6, 0xFB, 0x29, 0xC7, 0x3C, 0x5B, 0xBF, 0x1A, 0x6D, 0x32, 0x2F, 0xF4, 0x97, 0xAF, 0x8D, 0x8D,
+    0xB3, 0xA3, 0xD7, 0xD3, 0xB8, 0x19, 0x5F, 0xCF, 0xE4, 0xB4, 0x73, 0xCA, 0x22, 0x66, 0x73, 0xB0,
+    0x8F, 0x46, 0xCB, 0xF1, 0x10, 0x39, 0xBB, 0x9A, 0x9E, 0xF7, 0x75, 0x42, 0x06, 0xF3, 0xBB, 0x67,
+    0xD7, 0x77, 0x3D, 0xAA, 0x88, 0xBA, 0xA3, 0xAA, 0x52, 0xA7, 0x59, 0x7E, 0x5E, 0xDA, 0xB4, 0x31,
+    0x96, 0x5E, 0xB1, 0x11, 0xDA, 0x19, 0xFB, 0x0F, 0x8E, 0xC1, 0xA0, 0x5E, 0x17, 0x8A, 0xB9, 0x58,
+    0xE0, 0x19, 0x6C, 0xE3, 0x38, 0xF6, 0x1C, 0x60, 0x3F, 0x93, 0x07, 0x7F, 0x45, 0x8E, 0x88, 0xFD,
+    0xE8, 0xCD, 0xD8, 0xC6, 0xEE, 0x05, 0xBF, 0x5F, 0xDF, 0x03, 0x68, 0x4B, 0xA6, 0x2F, 0xD0, 0xE4,
+    0x13, 0x32, 0xD4, 0x6C, 0xB8, 0x39, 0x68, 0xAA, 0x88, 0xF5, 0x79, 0x3E, 0x5B, 0x00, 0x5C, 0xED,
+    0x27, 0xB5, 0x1C, 0x32, 0x7B, 0x74, 0x93, 0x3F, 0x96, 0xFF, 0xFF, 0xFC, 0x03, 0xB5, 0x55, 0x3D,
+    0x6C, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0xC7, 0xE7, 0x95, 0x6E, 0x65, 0x8F, 0x0B, 0xA7, 0x89, 0x4C,
+    0x96, 0x12, 0xA4, 0xD8, 0xD3, 0xA1, 0x2B, 0xE2, 0x9B, 0x89, 0x53, 0x50, 0x50, 0x70, 0xCD, 0x95,
+    0xD0, 0x40, 0x41, 0x03, 0xBA, 0xC2, 0x48, 0x14, 0x89, 0x77, 0x43, 0x8A, 0xB4, 0x96, 0x10, 0x1D,
+    0xC5, 0x29, 0xA2, 0x88, 0x9C, 0x22, 0x2E, 0x28, 0x5C, 0xDC, 0x79, 0x27, 0x71, 0x11, 0x09, 0x9A,
+    0x85, 0x96, 0x22, 0x17, 0x22, 0x84, 0x64, 0x0A, 0x0F, 0xD1, 0x0A, 0xAD, 0xCC, 0xDC, 0x0E, 0x6F,
+    0xF6, 0xEC, 0x38, 0x14, 0x44, 0x28, 0x31, 0x6F, 0x77, 0xE7, 0xEF, 0xFD, 0xBF, 0x79, 0xEF, 0xAD,
+    0x70, 0x96, 0x39, 0x2B, 0x5C, 0xC5, 0x5C, 0x35, 0xEF, 0x14, 0x52, 0x85, 0x3C, 0xC3, 0x3E, 0x20,
+    0x8B, 0xC0, 0x02, 0xDC, 0x30, 0x03, 0x44, 0x15, 0xD7, 0x40, 0x38, 0x15, 0x0A, 0x80, 0xDB, 0xA2,
+    0x01, 0x92, 0x90, 0xD8, 0xC9, 0xEB, 0x1D, 0x3A, 0x20, 0x00, 0xFA, 0xE9, 0xB4, 0x4F, 0x47, 0xE3,
+    0x9A, 0x86, 0xA0, 0x22, 0x31, 0x60, 0x46, 0x10, 0x17, 0xD7, 0x9C, 0x24, 0x88, 0x2C, 0xAA, 0x80,
+    0x94, 0x64, 0x00, 0xC4, 0xE9, 0xE0, 0xB7, 0x79, 0x91, 0x3A, 0x1D, 0xBB, 0x3A, 0x77, 0x9A, 0xBB,
+    0x5A, 0xBA, 0xCC, 0x59, 0x3F, 0x54, 0x91, 0x25, 0x7A, 0xD4, 0x90, 0xC4, 0xA1, 0x88, 0x3A, 0x79,
+    0xE8, 0x6D, 0xF8, 0xCD, 0x9B, 0x40, 0x16, 0x32, 0x52, 0x97, 0x85, 0xF7, 0xDC, 0x21, 0x2D, 0x1F,
+    0x17, 0xA4, 0xE0, 0x16, 0x61, 0xA5, 0x37, 0xD6, 0x22, 0x47, 0x58, 0x42, 0x66, 0xA2, 0x0E, 0x9C,
+    0xCD, 0x1D, 0x39, 0xD6, 0xDE, 0x79, 0x01, 0x86, 0x40, 0xE7, 0xF2, 0xA5, 0xEF, 0xA2, 0x22, 0x2E,
+    0x44, 0xF9, 0xCE, 0x37, 0x61, 0xF6, 0xDF, 0x1F, 0x72, 0x6A, 0x05, 0x88, 0x15, 0x42, 0xD2, 0xB8,
+    0x29, 0x9D, 0xFD, 0xBC, 0xBF, 0x37, 0xC0, 0x64, 0xC0, 0xB2, 0xC1, 0x22, 0x06, 0xCB, 0x18, 0xE0,
+    0xD5, 0x5F, 0x0F, 0x1D, 0x60, 0x82, 0x28, 0xC3, 0x25, 0x72, 0xC5, 0xD9, 0xB5, 0xFE, 0x07, 0x31,
+    0x16, 0x42, 0xBD, 0x80, 0xDD, 0x05, 0x2C, 0x2F, 0x00, 0xAF, 0xF3, 0x22, 0x75, 0xBF, 0x38, 0xF7,
+    0xC8, 0xD5, 0x67, 0x8B, 0x0B, 0xFD, 0x7E, 0x3F, 0xA5, 0x30, 0xFA, 0xCF, 0x07, 0xC6, 0xCF, 0x87,
+    0x34, 0x7F, 0x7B, 0x1A, 0xA9, 0xDC, 0xCD, 0xE0, 0xF8, 0x64, 0x7F, 0xF7, 0x5F, 0x11, 0x9F, 0x04,
+    0x77, 0x4A, 0xFE, 0x43, 0x21, 0x85, 0xB2, 0x63, 0xF6, 0xEC, 0x3C, 0x97, 0x7F, 0xF4, 0x5A, 0x8A,
+    0xEC, 0xEC, 0x4B, 0x52, 0x77, 0x44, 0x5F, 0x89, 0x13, 0x38, 0x3D, 0xA8, 0x9A, 0x9D, 0xEA, 0xC6,
+    0xBA, 0x14, 0xCC, 0xA4, 0x91, 0x49, 0x6F, 0xD9, 0x16, 0x5A, 0xAC, 0x92, 0x0F, 0x2C, 0xD7, 0x36,
+    0xD9, 0x30, 0xEB, 0x71, 0xB6, 0x04, 0x71, 0xCD, 0x0A, 0x4D, 0x07, 0x55, 0xC2, 0x26, 0xD7, 0xDB,
+    0x84, 0xB7, 0xE9, 0x6D, 0x93, 0x52, 0x72, 0xA2, 0x8C, 0xF5, 0x3A, 0x14, 0x54, 0x80, 0x8A, 0xE9,
+    0x11, 0x9B, 0xAC, 0x87, 0x74, 0x48, 0xA9, 0xBE, 0x15, 0x19, 0x71, 0xD5, 0xF2, 0x49, 0xFA, 0xA5,
+    0xE5, 0x46, 0x66, 0xBD, 0x00, 0x2D, 0x2C, 0xC9, 0x9B, 0x56, 0x3E, 0xA8, 0x13, 0x9D, 0x73, 0xFF,
+    0x8E, 0x13, 0x35, 0x22, 0xDA, 0xF5, 0xC0, 0xEC, 0xB1, 0x62, 0x29, 0x80, 0x50, 0x7B, 0xF2, 0x61,
+    0x2D, 0xB4, 0x6B, 0xB0, 0x5B, 0x3C, 0x1B, 0x27, 0xB0, 0xDD, 0xA0, 0xBC, 0xCE, 0x26, 0x43, 0x96,
+    0x11, 0x3B, 0x09, 0x7A, 0xB7, 0x12, 0x3F, 0x7A, 0xA9, 0xAC, 0xE4, 0x7A, 0x3F, 0x34, 0x3C, 0x23,
+    0x7D, 0xB1, 0xEE, 0xA2, 0x8C, 0xF4, 0x1C, 0x96, 0x1A, 0x67, 0x72, 0x4A, 0x71, 0x4A, 0xE4, 0x88,
+    0x32, 0x3A, 0xA1, 0x9C, 0xEB, 0xA2, 0xA5, 0xCA, 0x79, 0xF9, 0x97, 0x9B, 0x92, 0xBB, 0x7F, 0xFE,
+    0xBA, 0x7E, 0x51, 0x83, 0xA2, 0xC0, 0x7C, 0xD2, 0x2B, 0x8F, 0x05, 0x28, 0x06, 0x6C, 0x42, 0xDB,
+    0x86, 0x18, 0xC1, 0x29, 0x2F, 0x95, 0xCA, 0xDB, 0x27, 0xD1, 0x7A, 0xB9, 0xC8, 0x2E, 0x89, 0xAC,
+    0xCE, 0x98, 0xD2, 0x99, 0x0C, 0x12, 0xD9, 0xE3, 0xD9, 0x47, 0x2E, 0x77, 0x8F, 0x89, 0xEA, 0xB3,
+    0xAF, 0x9E, 0x8C, 0x1A, 0x0D, 0x5B, 0x67, 0x1A, 0xC4, 0x4C, 0xC3, 0xFC, 0xB6, 0xA8, 0xA4, 0x4D,
+    0xA7, 0xA9, 0x95, 0x55, 0xBC, 0xFD, 0x16, 0xDD, 0x4D, 0x06, 0x59, 0xD1, 0x0D, 0x65, 0xD2, 0x55,
+    0xD2, 0xD7, 0xF4, 0x54, 0xBA, 0x42, 0x4E, 0xA9, 0x9B, 0x60, 0xB5, 0x31, 0x47, 0x08, 0x57, 0x4F,
+    0x97, 0xC9, 0x14, 0x7E, 0x30, 0x65, 0xB5, 0x2C, 0xE4, 0x53, 0x1B, 0x4E, 0xE9, 0xD6, 0x20, 0x80,
+    0x11, 0xC2, 0x67, 0x35, 0xE2, 0x0A, 0xE2, 0xC8, 0x42, 0x1A, 0xB8, 0xA3, 0x02, 0xB9, 0x0A, 0x89,
+    0x1C, 0x3D, 0x04, 0x0A, 0xC9, 0xCF, 0xB5, 0x4B, 0xFF, 0x59, 0x89, 0x9D, 0xC4, 0x6E, 0xB6, 0xFE,
+    0xB7, 0x4A, 0x2C, 0x57, 0xD6, 0x7A, 0x0B, 0xE7, 0x58, 0x89, 0xE4, 0x46, 0xA2, 0xA8, 0xBB, 0x1D,
+    0x0E, 0x3A, 0x77, 0xBE, 0x6F, 0xB7, 0xD5, 0x70, 0xA9, 0x0D, 0x0C, 0xF1, 0x4A, 0x03, 0xC1, 0xB0,
+    0x00, 0x7B, 0x94, 0x81, 0x2F, 0x02, 0x57, 0x3A, 0xB9, 0x33, 0xBF, 0xF7, 0x3F, 0xBD, 0x3C, 0x8C,
+    0xDE, 0x6B, 0x07, 0x3F, 0xE9, 0xE1, 0xE6, 0x6E, 0x7B, 0x6E, 0x8E, 0x28, 0x1B, 0xD2, 0xD7, 0x9C,
+    0x1A, 0x18, 0x0C, 0xB1, 0x7A, 0x05, 0xF1, 0xFB, 0x08, 0x0F, 0x34, 0x76, 0x9D, 0x7B, 0x7A, 0xFB,
+    0xEB, 0x0F, 0x17, 0xDF, 0xC0, 0xB0, 0xB3, 0xD9, 0xC6, 0x93, 0x62, 0x18, 0x04, 0xE7, 0xA0, 0xE8,
+    0x45, 0x7D, 0x78, 0xB3, 0x19, 0x83, 0x7D, 0xBA, 0x69, 0x33, 0x4B, 0x1D, 0x97, 0x51, 0xF8, 0xFC,
+    0x2A, 0xF4, 0xFF, 0x97, 0x59, 0xF9, 0xF3, 0x4C, 0x22, 0xD2, 0xCD, 0x72, 0x44, 0x4F, 0xB7, 0x59,
+    0x31, 0x13, 0x9A, 0x60, 0xC6, 0xC4, 0x75, 0x54, 0xF0, 0x86, 0x89, 0x70, 0x89, 0xDA, 0x9B, 0xC9,
+    0xB6, 0x18, 0x31, 0xFD, 0x9C, 0x74, 0x15, 0x1F, 0x03, 0x17, 0x55, 0x5C, 0xF0, 0x9B, 0x46, 0xD4,
+    0x88, 0x5C, 0x41, 0xED, 0x83, 0x87, 0xC7, 0x0E, 0xE9, 0xFD, 0x42, 0xB8, 0xE2, 0x8B, 0x44, 0x8D,
+    0x99, 0xE1, 0x3A, 0xB1, 0x4C, 0x5B, 0x54, 0x89, 0xA2, 0x5C, 0xC5, 0x1A, 0x9B, 0x30, 0x33, 0xC2,
+    0x0D, 0x32, 0xD1, 0x24, 0x8A, 0x1F, 0x98, 0xA0, 0xF4, 0x65, 0x79, 0x03, 0xC2, 0xAB, 0x24, 0x6B,
+    0x68, 0x6F, 0xA5, 0x37, 0x98, 0x15, 0x44, 0x3A, 0x21, 0x95, 0xDE, 0x04, 0x92, 0xB2, 0x51, 0xD2,
+    0x3F, 0x95, 0xCC, 0xA3, 0x2E, 0xC7, 0x88, 0xD5, 0x97, 0x96, 0xBC, 0x5F, 0xC4, 0xC7, 0x95, 0x77,
+    0x01, 0x54, 0x2C, 0x31, 0x39, 0xEA, 0xB3, 0xFB, 0x82, 0x42, 0xD0, 0x23, 0xF9, 0xCF, 0x43, 0x82,
+    0xED, 0xB8, 0x90, 0x57, 0x4F, 0x7A, 0x48, 0x36, 0x0A, 0x1A, 0x17, 0xB6, 0xDB, 0x18, 0xB3, 0x89,
+    0xDC, 0xB0, 0x89, 0xAE, 0x09, 0x13, 0x19, 0x79, 0xAD, 0x4C, 0x34, 0xB5, 0xB1, 0x11, 0x2B, 0x56,
+    0x28, 0x97, 0x5F, 0x0E, 0x7F, 0x03, 0xA5, 0x55, 0xBF, 0x8F, 0x16, 0x45, 0x18, 0x7E, 0x66, 0xD7,
+    0xBB, 0x4D, 0x98, 0xC4, 0xA5, 0x80, 0x44, 0x39, 0xE3, 0x5A, 0x50, 0x18, 0x62, 0xD8, 0xC6, 0x82,
+    0xE2, 0xF8, 0x66, 0x80, 0x44, 0x0B, 0x9B, 0x8B, 0xE1, 0x2C, 0xB4, 0xA1, 0xC0, 0x44, 0xAB, 0xA3,
+    0xA4, 0xE0, 0x6E, 0x37, 0x50, 0x5A, 0x78, 0x7F, 0x02, 0x85, 0x8D, 0x90, 0x68, 0x43, 0x01, 0xC9,
+    0x77, 0xF7, 0x0D, 0xA1, 0xA0, 0xA0, 0x60, 0x13, 0x62, 0x75, 0x85, 0x5B, 0x80, 0x89, 0x5A, 0xB0,
+    0xC6, 0x41, 0xF7, 0x60, 0xBE, 0x7D, 0x7D, 0x66, 0xEF, 0x2E, 0x80, 0xB1, 0x73, 0xB3, 0x3B, 0xBB,
+    0x33, 0xEF, 0xFC, 0x78, 0xDF, 0xE7, 0x79, 0xDF, 0x67, 0xB1, 0x79, 0x08, 0x17, 0x12, 0x9F, 0xD7,
+    0xD3, 0xD4, 0x97, 0x6E, 0x9E, 0x75, 0xE6, 0x6A, 0xC8, 0xDB, 0x2A, 0xF5, 0xC5, 0xD8, 0x39, 0x13,
+    0xF2, 0x66, 0x92, 0x76, 0x05, 0xCD, 0x4D, 0x89, 0x4B, 0x69, 0xFD, 0x0E, 0xC6, 0xEB, 0xAD, 0xA4,
+    0xCB, 0xDB, 0xC2, 0x99, 0xBA, 0xC2, 0x16, 0x82, 0xEA, 0x12, 0xC7, 0x31, 0x5C, 0xD0, 0xAE, 0xB0,
+    0x43, 0x12, 0xB2, 0xAE, 0x68, 0x4C, 0x3D, 0xA8, 0x90, 0x76, 0xBA, 0x29, 0x6B, 0x13, 0x67, 0xA4,
+    0x8D, 0xC6, 0xB8, 0x98, 0xD3, 0x54, 0x5D, 0x62, 0x5D, 0xF5, 0x79, 0x5B, 0xBA, 0x4A, 0x85, 0xCC,
+    0xE7, 0x2D, 0x67, 0xC7, 0x65, 0xB9, 0x33, 0x76, 0x2B, 0xE9, 0xC7, 0x0F, 0x6C, 0xC5, 0x45, 0x79,
+    0xFD, 0x01, 0x2E, 0xA1, 0xD9, 0x3B, 0x75, 0x11, 0x50, 0x3D, 0x50, 0xB5, 0x28, 0xBE, 0xAD, 0xB3,
+    0x76, 0xC2, 0x4E, 0x7F, 0x12, 0x69, 0x83, 0x37, 0x30, 0xC1, 0x78, 0xEA, 0xAC, 0x16, 0xCC, 0x50,
+    0xBA, 0xAC, 0xA3, 0x6D, 0x82, 0x85, 0xC3, 0xC8, 0x2D, 0x7A, 0x14, 0x2E, 0x09, 0x1C, 0x4D, 0x7D,
+    0x1A, 0x92, 0xB9, 0x0A, 0x08, 0x1C, 0x3B, 0xB2, 0xB7, 0xE7, 0xE8, 0x54, 0x72, 0xCF, 0xC1, 0x26,
+    0xED, 0x32, 0xFA, 0xA4, 0x4D, 0xE9, 0x53, 0x8B, 0x2B, 0xFA, 0x4C, 0x87, 0xCC, 0xA9, 0x0E, 0xB8,
+    0x0C, 0x36, 0x59, 0xCD, 0x06, 0xB7, 0xD9, 0x04, 0xDD, 0x15, 0xD6, 0xA0, 0xD7, 0xAD, 0xAE, 0xC5,
+    0x7A, 0xE0, 0x16, 0x1F, 0xDC, 0xCA, 0xA3, 0x39, 0xCE, 0xBC, 0x0D, 0x7E, 0x5E, 0xCE, 0x6D, 0x87,
+    0xCB, 0xF4, 0x08, 0x57, 0xD0, 0xAB, 0x6E, 0x99, 0xC6, 0x77, 0xE3, 0x41, 0xCA, 0x8D, 0x67, 0x1E,
+    0xAA, 0x93, 0xEB, 0x03, 0xCC, 0x35, 0x8F, 0x79, 0xD1, 0x64, 0xBE, 0x42, 0x71, 0x37, 0xA0, 0xA2,
+    0xD3, 0xA1, 0xA0, 0xEB, 0x06, 0xB9, 0x0B, 0x30, 0x69, 0x87, 0x90, 0xBB, 0xF4, 0xF5, 0x6E, 0xD2,
+    0x95, 0xD0, 0x6E, 0x8A, 0x12, 0x16, 0x87, 0xF7, 0x23, 0xC0, 0xD7, 0x38, 0x74, 0x2E, 0x40, 0xF2,
+    0x2E, 0x0D, 0xC6, 0xE5, 0xDD, 0x11, 0x2C, 0x40, 0x78, 0x55, 0x7C, 0x9E, 0xAC, 0xAE, 0xAE, 0xAE,
+    0x54, 0xBB, 0xB3, 0xA1, 0x9A, 0x8F, 0xD8, 0x83, 0xA8, 0x80, 0x4E, 0x81, 0x08, 0x20, 0x46, 0x47,
+    0xF4, 0xB8, 0x21, 0x22, 0x4E, 0xDC, 0x14, 0x58, 0x1E, 0xE3, 0x40, 0x8C, 0x24, 0xA1, 0x29, 0xDB,
+    0x37, 0x15, 0xAF, 0x9B, 0xD2, 0x76, 0xDF, 0x54, 0xEF, 0xAD, 0x3A, 0xCD, 0x67, 0xCA, 0xE7, 0xF8,
+    0xBE, 0x47, 0x4B, 0x8F, 0xA1, 0x06, 0x9B, 0x8A, 0x47, 0x25, 0xBC, 0x1B, 0x2D, 0x21, 0xFD, 0x4D,
+    0xB0, 0xF1, 0x63, 0x07, 0x32, 0x01, 0x53, 0x43, 0x73, 0xF3, 0x30, 0x7A, 0x43, 0x0F, 0x92, 0x76,
+    0xFC, 0x32, 0xE3, 0xC6, 0x9A, 0x9D, 0x2D, 0x2C, 0xCD, 0x91, 0x88, 0xAB, 0xA4, 0xD6, 0xD2, 0xE7,
+    0xD2, 0x42, 0xE6, 0x90, 0x06, 0xF9, 0xFC, 0x60, 0x21, 0x43, 0xD0, 0x35, 0x52, 0x37, 0x7E, 0x11,
+    0x09, 0x85, 0xD7, 0x2F, 0x75, 0x1D, 0x38, 0xC1, 0x5C, 0xE1, 0x49, 0x3D, 0x34, 0x17, 0xCC, 0xEA,
+    0xB1, 0xE3, 0xA1, 0x56, 0x70, 0x40, 0xFE, 0xB1, 0x8F, 0x76, 0x19, 0xC3, 0x23, 0xBA, 0xA9, 0xFF,
+    0x10, 0xB1, 0x49, 0x98, 0xD0, 0xC1, 0x19, 0xC6, 0x14, 0xE2, 0x41, 0xD1, 0x93, 0x3E, 0x21, 0x50,
+    0x27, 0xB1, 0xCD, 0x79, 0xAE, 0xE4, 0xFA, 0x96, 0xE7, 0xAF, 0x79, 0xE5, 0x33, 0xE9, 0xB1, 0x9E,
+    0xB2, 0x29, 0x2C, 0xFD, 0x62, 0x75, 0x10, 0x24, 0x1F, 0x21, 0x39, 0x1D, 0xF1, 0xC9, 0xED, 0xBF,
+    0x5D, 0xFA, 0x8A, 0xE9, 0x5B, 0xD3, 0x81, 0xAC, 0x2F, 0x89, 0x81, 0x64, 0x31, 0x8F, 0xED, 0x79,
+    0x60, 0xC1, 0x1E, 0x22, 0x86, 0xC8, 0x5B, 0xB5, 0x6D, 0x53, 0xCF, 0x30, 0xD5, 0x3C, 0x02, 0x56,
+    0x21, 0xBF, 0xC9, 0x64, 0x20, 0xBA, 0xF7, 0x23, 0x13, 0xCF, 0x42, 0x64, 0x8E, 0xF8, 0x40, 0x3F,
+    0xE4, 0x60, 0xFA, 0x67, 0x1C, 0xEC, 0x39, 0xB8, 0x34, 0x37, 0x50, 0x32, 0xE4, 0x0E, 0x32, 0x30,
+    0x43, 0x8C, 0x27, 0x36, 0xF4, 0xB0, 0x8C, 0xDC, 0x92, 0x56, 0x52, 0x66, 0x59, 0x1D, 0xAF, 0x5C,
+    0x8B, 0x9B, 0x38, 0x86, 0x34, 0xA0, 0x20, 0xA4, 0xC8, 0x98, 0x57, 0x4E, 0x0D, 0x50, 0x16, 0x47,
+    0x0F, 0xEC, 0xBB, 0x50, 0x35, 0xB1, 0x28, 0xF4, 0x13, 0xF9, 0xBD, 0x5F, 0xC6, 0x9A, 0xD4, 0x2B,
+    0x58, 0x24, 0x98, 0xA3, 0x50, 0xD8, 0xD2, 0xF6, 0xDA, 0x6D, 0x8C, 0x5A, 0xA1, 0x29, 0x13, 0x3D,
+    0xDF, 0xA3, 0x5C, 0x94, 0x77, 0xA9, 0x14, 0x7C, 0x8F, 0x8A, 0xB1, 0x91, 0xB6, 0x86, 0xE5, 0xED,
+    0xA2, 0x68, 0x10, 0x29, 0x9C, 0x52, 0xEE, 0xCD, 0x57, 0x7D, 0xA8, 0x7A, 0xCC, 0xC8, 0xED, 0xC7,
+    0xBD, 0x81, 0x29, 0x6A, 0xBD, 0xD3, 0xA8, 0xBF, 0x3B, 0x6C, 0xD0, 0xA7, 0x19, 0xB2, 0xA7, 0x2E,
+    0xF9, 0x8B, 0x41, 0x54, 0xA8, 0xB8, 0xAF, 0xA2, 0x23, 0x7A, 0x78, 0xB9, 0x70, 0x1A, 0xA9, 0x41,
+    0xE5, 0x60, 0x18, 0x2A, 0x8B, 0xA0, 0x44, 0xF1, 0x89, 0xCB, 0xAF, 0x52, 0x2E, 0xA6, 0xFA, 0x49,
+    0xF5, 0xA9, 0xC8, 0x70, 0xE2, 0xE6, 0x73, 0x1B, 0xA7, 0x95, 0x7B, 0x59, 0xCD, 0x56, 0x1A, 0xC2,
+    0x73, 0x63, 0xD3, 0xB3, 0x2C, 0x95, 0x6C, 0x16, 0x52, 0x2F, 0xCE, 0x11, 0x91, 0x8A, 0xCD, 0x06,
+    0xAA, 0x87, 0xD2, 0x55, 0xFE, 0x20, 0x6B, 0x49, 0xFE, 0xE3, 0xB4, 0x47, 0x4E, 0x00, 0x2D, 0xCC,
+    0x1D, 0x7A, 0xD9, 0x0C, 0x5F, 0xF8, 0xA0, 0x02, 0x25, 0x83, 0x37, 0xA5, 0xAE, 0x3A, 0xEB, 0x4B,
+    0xE9, 0x32, 0x21, 0xDB, 0x28, 0xA5, 0x37, 0x12, 0x26, 0x37, 0xC2, 0xB2, 0xF2, 0x1F, 0x32, 0x71,
+    0x49, 0x42, 0x61, 0x63, 0x1E, 0xAF, 0xC7, 0x0C, 0x55, 0x1E, 0x49, 0x17, 0x0F, 0xA1, 0x25, 0xDD,
+    0x17, 0x30, 0xE8, 0x21, 0x92, 0x55, 0x4F, 0xD7, 0x95, 0xEF, 0xB3, 0x7B, 0xFD, 0x46, 0x2A, 0x4D,
+    0x26, 0xF5, 0x56, 0xF5, 0xA0, 0x29, 0x2B, 0x4C, 0x02, 0x9E, 0x7B, 0xFD, 0x48, 0x86, 0x44, 0xF6,
+    0xE7, 0x17, 0xF3, 0x44, 0xE6, 0xD4, 0x86, 0xA9, 0x7A, 0xD1, 0xA5, 0xE2, 0xF2, 0xA7, 0xB5, 0x31,
+    0xBF, 0x04, 0x23, 0xED, 0xD2, 0x2C, 0x2A, 0x21, 0xE5, 0x60, 0xBE, 0x28, 0x4D, 0xDE, 0x8F, 0x9A,
+    0x72, 0xBF, 0x57, 0x32, 0xEB, 0xD5, 0xEC, 0x5C, 0x47, 0xCC, 0x5D, 0xD6, 0x14, 0xB6, 0xB0, 0xEB,
+    0xD4, 0xD9, 0x98, 0xAC, 0x4D, 0xEC, 0x56, 0x8D, 0x5C, 0x93, 0x6F, 0x04, 0x78, 0xDB, 0x62, 0xC6,
+    0x72, 0x92, 0x66, 0x3B, 0x09, 0x91, 0x02, 0xAB, 0x77, 0x1C, 0x4F, 0x38, 0xA0, 0x60, 0x87, 0x14,
+    0xF4, 0xA0, 0x65, 0x5B, 0x3F, 0xA7, 0x9C, 0x0A, 0x16, 0xBF, 0x07, 0x93, 0x68, 0xA9, 0x31, 0x81,
+    0x25, 0x49, 0x74, 0xF5, 0x7F, 0x34, 0x6B, 0xBB, 0x46, 0xBA, 0xD5, 0xF3, 0xD4, 0x22, 0x2D, 0xCE,
+    0x3C, 0xED, 0xB6, 0x52, 0x3F, 0x4D, 0xFC, 0xFB, 0x89, 0x8F, 0x10, 0xE8, 0x11, 0xD0, 0x6D, 0xB0,
+    0x47, 0x6C, 0x0D, 0x8F, 0x97, 0xC0, 0xFB, 0xE8, 0xEA, 0x8A, 0xBA, 0x88, 0x6A, 0xC8, 0x9E, 0x0F,
+    0x27, 0x11, 0xDE, 0x23, 0x50, 0xA5, 0xCD, 0x7C, 0x12, 0xE5, 0xA2, 0x89, 0x68, 0x96, 0x11, 0x47,
+    0xDD, 0x7E, 0x2E, 0x5A, 0x5A, 0xFD, 0x1D, 0x63, 0x5C, 0x19, 0x4B, 0x9F, 0x11, 0xCC, 0x1C, 0xAA,
+    0x0E, 0x93, 0x29, 0x4C, 0x89, 0x92, 0x7F, 0x9D, 0xB3, 0x1D, 0x41, 0xD5, 0x22, 0xCF, 0x98, 0x02,
+    0x0B, 0x9F, 0x3D, 0xC3, 0x7E, 0x0A, 0x64, 0xB1, 0xB4, 0x08, 0xB8, 0xB4, 0x23, 0xFD, 0xBB, 0x28,
+    0x06, 0x35, 0x8B, 0x5B, 0xEE, 0xD1, 0x3F, 0x41, 0xFE, 0xD3, 0x5A, 0x2F, 0xF3, 0xE4, 0x57, 0x16,
+    0xEB, 0x26, 0x4A, 0xAF, 0x98, 0x6E, 0x9E, 0x7F, 0x8B, 0xE8, 0x62, 0x25, 0x76, 0x26, 0x5D, 0xC8,
+    0xFA, 0x3D, 0xEE, 0x79, 0x6F, 0xA3, 0x37, 0x3B, 0x3E, 0x97, 0x46, 0xDD, 0x89, 0x80, 0x93, 0x7B,
+    0xDE, 0xFC, 0x67, 0x9C, 0x4A, 0xBA, 0xE3, 0x59, 0x13, 0xB5, 0xB0, 0x1C, 0x65, 0x6C, 0x1A, 0xC5,
+    0x55, 0xF9, 0x97, 0xDC, 0x47, 0xD5, 0xFF, 0x92, 0xE9, 0x72, 0x76, 0x77, 0x96, 0xDB, 0xF5, 0x75,
+    0xD5, 0x05, 0x7D, 0x77, 0x1E, 0x14, 0x09, 0x95, 0x26, 0x94, 0x0F, 0x5C, 0xB1, 0x3D, 0x72, 0xBF,
+    0x5B, 0xDC, 0x93, 0xA0, 0x7E, 0xB0, 0xB8, 0x08, 0x33, 0xA4, 0xC3, 0x50, 0xD8, 0xAD, 0x00, 0x12,
+    0xFF, 0xC2, 0xE5, 0x3F, 0x3B, 0xC3, 0x6C, 0x2B, 0xA5, 0x59, 0xA8, 0x58, 0xF7, 0x54, 0x27, 0x1D,
+    0x98, 0x37, 0xFA, 0x3A, 0xFE, 0xEF, 0xF5, 0x0F, 0xAD, 0x55, 0xBD, 0x8F, 0xE3, 0x54, 0x10, 0x1F,
+    0xDB, 0x70, 0x3E, 0x61, 0x90, 0x29, 0xD8, 0x13, 0x12, 0x1F, 0xBE, 0x82, 0x0E, 0x11, 0xF7, 0xE8,
+    0xB2, 0xB6, 0xF6, 0x24, 0x22, 0x44, 0xC1, 0x15, 0x6B, 0x28, 0xB6, 0x38, 0x7A, 0x84, 0x4E, 0x42,
+    0x5B, 0x6E, 0x62, 0xAF, 0xF8, 0x03, 0x96, 0xE6, 0xEA, 0x6D, 0x0E, 0x21, 0xDE, 0x16, 0x69, 0x28,
+    0x02, 0x4A, 0x62, 0x8B, 0x76, 0x0B, 0x1C, 0x1A, 0x8A, 0x2B, 0x62, 0x10, 0x27, 0xA4, 0x2D, 0x58,
+    0x03, 0x91, 0xCE, 0x1B, 0x1C, 0x0F, 0xBF, 0x79, 0x4E, 0x96, 0x43, 0x62, 0x05, 0x05, 0x4E, 0xF2,
+    0xF2, 0x3E, 0xE6, 0xCD, 0xC7, 0x6F, 0x66, 0x7E, 0xDE, 0x8A, 0xA2, 0xE8, 0x36, 0x33, 0xD7, 0x2F,
+    0x61, 0xC8, 0xDC, 0x9C, 0xC6, 0xB4, 0x22, 0x5B, 0x26, 0xB7, 0x30, 0x31, 0x08, 0x13, 0xC2, 0x84,
+    0xDA, 0x09, 0x73, 0x43, 0x2E, 0x73, 0x4E, 0x4D, 0xB4, 0x7B, 0x79, 0x64, 0xDC, 0x7D, 0x14, 0x52,
+    0xC0, 0x90, 0x1E, 0x9E, 0x25, 0x4F, 0x08, 0x37, 0x21, 0x99, 0xD0, 0x89, 0xA3, 0x1A, 0x2B, 0xBA,
+    0x76, 0x01, 0x51, 0x66, 0x1C, 0x2E, 0x1B, 0x48, 0x19, 0x35, 0xD9, 0x85, 0x59, 0x92, 0x1F, 0x3A,
+    0x09, 0xD5, 0xF4, 0x14, 0x59, 0x05, 0x84, 0x3C, 0x28, 0xA0, 0x09, 0xDD, 0x81, 0x25, 0x4E, 0x2C,
+    0x86, 0x52, 0x0A, 0xB0, 0xB3, 0xB5, 0x8A, 0x42, 0xE8, 0x62, 0x7A, 0x66, 0x78, 0xF6, 0x40, 0x04,
+    0x88, 0xAC, 0x52, 0xEC, 0x64, 0x18, 0xFA, 0xF8, 0xBD, 0xBE, 0x54, 0x6A, 0x06, 0x01, 0xBE, 0xDD,
+    0xA4, 0x5C, 0xDB, 0x09, 0x6D, 0x85, 0x37, 0x86, 0x70, 0x40, 0x1E, 0xA8, 0xE1, 0x5C, 0xCF, 0x6C,
+    0xBE, 0x9F, 0x16, 0x7A, 0x06, 0x2F, 0xFD, 0xAC, 0x3D, 0x5D, 0x50, 0x90, 0xE8, 0x19, 0x9C, 0x4E,
+    0xDB, 0xC3, 0x20, 0x34, 0x6A, 0x2B, 0x6B, 0xC5, 0xEC, 0xC2, 0x5B, 0x8B, 0xF9, 0xC9, 0x78, 0x2D,
+    0x56, 0xDB, 0xCB, 0x07, 0x66, 0x13, 0x06, 0xA1, 0xF7, 0x23, 0x73, 0x11, 0x73, 0xD2, 0xEC, 0x35,
+    0xD7, 0x52, 0x65, 0x15, 0x1D, 0x4B, 0x4C, 0xD5, 0xE4, 0xD1, 0xBE, 0xCB, 0x3F, 0x89, 0x8F, 0x7D,
+    0xD1, 0xA6, 0x1D, 0x6D, 0x5A, 0x68, 0x02, 0x80, 0x92, 0x43, 0x1B, 0x41, 0xCC, 0xE0, 0x52, 0x90,
+    0x92, 0x50, 0xFC, 0x62, 0x2D, 0x16, 0xBA, 0x59, 0x2B, 0x66, 0x27, 0x81, 0x0D, 0xC8, 0x68, 0x4A,
+    0xAF, 0xD2, 0x85, 0xE0, 0x68, 0x70, 0x3D, 0x1D, 0x7E, 0x2B, 0x08, 0x9A, 0x3C, 0x6B, 0x31, 0x25,
+    0xDA, 0xA5, 0x2D, 0x8C, 0x46, 0xFA, 0x29, 0x54, 0x20, 0x39, 0x3A, 0x43, 0xD6, 0x0A, 0x66, 0xDD,
+    0x92, 0xBA, 0x12, 0xE3, 0x2D, 0xB1, 0x7F, 0xB3, 0x8D, 0x4C, 0x14, 0xFB, 0xCC, 0x88, 0x98, 0xB9,
+    0x24, 0x43, 0x54, 0xDC, 0x58, 0x45, 0x77, 0x28, 0x16, 0xAF, 0x3F, 0x6C, 0xD4, 0x3A, 0x7B, 0xE2,
+    0x2A, 0xB5, 0x37, 0x62, 0x81, 0xC6, 0x17, 0xCC, 0xDC, 0x26, 0x9A, 0x08, 0x94, 0xB8, 0x14, 0x33,
+    0x36, 0x8C, 0x88, 0xE8, 0x79, 0x31, 0x2D, 0x79, 0xF0, 0xE0, 0xBB, 0xB1, 0xD8, 0x4C, 0x2E, 0xDE,
+    0x53, 0x6A, 0x28, 0xC9, 0x98, 0x2B, 0x75, 0xD2, 0xC8, 0x16, 0xB2, 0x7C, 0x39, 0x88, 0xDA, 0xD7,
+    0x64, 0x78, 0x05, 0xE2, 0x39, 0x79, 0x2B, 0xF2, 0x38, 0xF7, 0x3E, 0xEA, 0xFB, 0xEF, 0xF4, 0xBE,
+    0xDF, 0x29, 0xF6, 0x69, 0x44, 0xD4, 0x21, 0x42, 0x51, 0x98, 0xB0, 0x72, 0xF5, 0xA2, 0xD2, 0x0B,
+    0x6A, 0x9D, 0xB0, 0x24, 0xBF, 0xF6, 0x5F, 0xC3, 0x77, 0x4A, 0x7D, 0xB6, 0x37, 0x17, 0x17, 0xCE,
+    0x51, 0x18, 0x93, 0xCD, 0xFE, 0x40, 0x26, 0x12, 0xCC, 0xB6, 0x5C, 0xFC, 0x40, 0x6B, 0x70, 0xFF,
+    0xCD, 0xD0, 0x66, 0x61, 0xED, 0x14, 0x1F, 0x2F, 0xBE, 0x1C, 0xF8, 0x6F, 0x0C, 0xCC, 0x3F, 0xA6,
+    0xE4, 0x37, 0x64, 0xAE, 0x74, 0x0C, 0x74, 0x1D, 0x1F, 0xA8, 0x81, 0xB8, 0x93, 0xC1, 0x2D, 0x0C,
+    0x58, 0xA0, 0x7A, 0x2A, 0xE7, 0x51, 0x14, 0xDD, 0xFB, 0x44, 0xBC, 0x28, 0x1B, 0xA5, 0x54, 0x25,
+    0xD5, 0x5A, 0xE3, 0x83, 0x2F, 0xA6, 0xB5, 0xC4, 0x30, 0x5E, 0x5F, 0x97, 0x47, 0x14, 0xE0, 0x3A,
+    0x27, 0xCE, 0x2F, 0x95, 0x7B, 0x7A, 0x74, 0xFA, 0x4D, 0x51, 0x65, 0xA3, 0x67, 0xAF, 0x70, 0x2B,
+    0x19, 0x5D, 0x1F, 0x77, 0xDC, 0xA3, 0xD3, 0xA3, 0xAC, 0x39, 0xCF, 0x5C, 0x54, 0x07, 0xBE, 0xA2,
+    0x1F, 0x10, 0xDB, 0xF8, 0xA5, 0x89, 0x28, 0xA2, 0xE9, 0x79, 0xE2, 0x3C, 0x3C, 0x4E, 0x26, 0x1D,
+    0x2F, 0xC9, 0x47, 0x2F, 0x6B, 0x25, 0xB8, 0xAE, 0x81, 0x83, 0x32, 0x2C, 0x9F, 0x73, 0x0E, 0x33,
+    0x39, 0x9D, 0x7C, 0x55, 0x51, 0x8A, 0x0B, 0x31, 0x92, 0x18, 0x87, 0x72, 0xEA, 0xA1, 0xF9, 0x62,
+    0xA9, 0x95, 0x8D, 0x6F, 0x52, 0xA5, 0xB5, 0x6E, 0x47, 0xD8, 0x59, 0x2F, 0x3A, 0x74, 0xD3, 0x49,
+    0x7C, 0xB3, 0xF0, 0xC3, 0x91, 0x1F, 0x76, 0xBC, 0xD0, 0x39, 0xBE, 0xFF, 0xFE, 0x39, 0xF3, 0xC5,
+    0x52, 0x7D, 0x81, 0x64, 0x9B, 0x0B, 0x9D, 0x73, 0x34, 0x39, 0x0A, 0x50, 0x0C, 0xFE, 0xED, 0xEE,
+    0xB6, 0xC6, 0x5E, 0xBA, 0xBE, 0x32, 0xA9, 0x63, 0x15, 0x4E, 0x32, 0x30, 0x0B, 0x3B, 0x1F, 0x51,
+    0xDF, 0x8F, 0xF6, 0x1E, 0xC2, 0xBA, 0x52, 0x2B, 0xDD, 0xDC, 0x03, 0xFD, 0x85, 0xB8, 0xA9, 0x5D,
+    0x11, 0x75, 0x02, 0x72, 0x82, 0x52, 0xC2, 0xDF, 0x18, 0x6C, 0x60, 0x96, 0x4E, 0x8E, 0x39, 0xC0,
+    0xF4, 0x6D, 0x60, 0x3E, 0x0E, 0x04, 0xF2, 0x29, 0x20, 0x0F, 0x75, 0xC7, 0xEA, 0xA1, 0xBE, 0x1C,
+    0xDA, 0x6E, 0x97, 0x67, 0x7F, 0x53, 0x18, 0x42, 0x21, 0xF6, 0x12, 0xC5, 0x8D, 0x88, 0xF9, 0xF1,
+    0x19, 0x6E, 0xCA, 0x0E, 0xF5, 0x41, 0x8E, 0xBB, 0xB2, 0x55, 0xA6, 0xC2, 0x8E, 0x5A, 0x8F, 0x14,
+    0x93, 0xC4, 0xA2, 0xA1, 0x6E, 0xC1, 0x06, 0x60, 0xF6, 0x79, 0x48, 0x7D, 0x2F, 0xB4, 0x17, 0x71,
+    0x18, 0xCF, 0xB8, 0x37, 0xEF, 0xCD, 0xDF, 0xEE, 0x7A, 0x2F, 0xD2, 0xE2, 0x80, 0xAC, 0x59, 0x49,
+    0x6E, 0x2F, 0xA3, 0x2E, 0x68, 0xE4, 0xEA, 0xE5, 0xFA, 0x11, 0x6D, 0xBA, 0x87, 0x30, 0xA0, 0x93,
+    0x53, 0x61, 0x66, 0x7E, 0x0B, 0xEE, 0x0C, 0xF5, 0x1E, 0xDC, 0x89, 0x1E, 0xCB, 0xD6, 0xBB, 0xF8,
+    0x55, 0xA4, 0x01, 0x24, 0xA3, 0x6A, 0xF3, 0x43, 0xE0, 0x50, 0xFA, 0xCF, 0x16, 0x9F, 0xEE, 0x7A,
+    0x2F, 0x1C, 0x2C, 0x0E, 0x16, 0xE9, 0x8C, 0x93, 0xB4, 0x57, 0xD1, 0x04, 0xCC, 0x3B, 0xA9, 0xDA,
+    0xE4, 0xEF, 0x6F, 0xDC, 0xB1, 0x32, 0x57, 0xD8, 0x09, 0x09, 0x43, 0x9A, 0x7C, 0xB2, 0x96, 0xEA,
+    0xA4, 0x14, 0x36, 0x65, 0x13, 0x5D, 0x75, 0xF2, 0x83, 0x24, 0xA2, 0xBB, 0x0D, 0x9F, 0xEE, 0xE9,
+    0x4D, 0x61, 0x15, 0x6E, 0x25, 0x91, 0x2D, 0x7F, 0x7D, 0xBD, 0x25, 0xD4, 0x44, 0xF4, 0x08, 0xA3,
+    0xF8, 0x87, 0xC2, 0x30, 0xB5, 0x85, 0x4C, 0xD8, 0xA5, 0x23, 0xC4, 0x17, 0xBA, 0x85, 0x24, 0x06,
+    0x54, 0x85, 0xD6, 0x8C, 0x95, 0x4A, 0x85, 0xC4, 0x10, 0x9D, 0xC9, 0x6A, 0x98, 0x6B, 0x7A, 0x46,
+    0x9C, 0xA5, 0xB0, 0x8B, 0x97, 0x49, 0x85, 0x07, 0x89, 0x74, 0x6F, 0xAA, 0xCB, 0x60, 0x25, 0x1B,
+    0x56, 0xA5, 0xD3, 0xF7, 0x9B, 0x7E, 0x21, 0xCC, 0x35, 0x61, 0xE9, 0x3C, 0xC7, 0x9A, 0xEA, 0x59,
+    0x90, 0x33, 0x75, 0x19, 0x1B, 0x7A, 0xD8, 0x05, 0x5A, 0x20, 0x30, 0xBC, 0xC6, 0x40, 0xB1, 0x9E,
+    0x30, 0x59, 0x4D, 0x2D, 0x49, 0xDB, 0x97, 0x0B, 0xA2, 0xE1, 0x71, 0x86, 0x17, 0x4E, 0x69, 0xAD,
+    0xEE, 0xD6, 0x70, 0x21, 0x85, 0x02, 0x37, 0x93, 0x37, 0xD6, 0x04, 0x3C, 0x87, 0xE3, 0x09, 0x0C,
+    0x07, 0x36, 0x90, 0x3C, 0x44, 0xC7, 0xE6, 0x03, 0x04, 0xE7, 0x65, 0x26, 0x80, 0x42, 0x32, 0x78,
+    0xA7, 0x82, 0x72, 0x40, 0x29, 0xBD, 0x63, 0x48, 0x79, 0x30, 0xFF, 0x8A, 0x88, 0x7E, 0xE6, 0xB3,
+    0x34, 0xD3, 0xB4, 0x6A, 0xC2, 0x86, 0x0E, 0xFD, 0x89, 0xE5, 0xEF, 0xCC, 0x29, 0xB8, 0x9D, 0xDF,
+    0x54, 0x27, 0xFF, 0x70, 0xBA, 0x59, 0x7E, 0xAD, 0x3E, 0xD7, 0xA4, 0x26, 0x40, 0xFF, 0x3F, 0xCF,
+    0x9F, 0xC5, 0x55, 0x31, 0x8E, 0xE4, 0x54, 0x10, 0x2D, 0xDB, 0x20, 0x23, 0x1C, 0x78, 0x03, 0x90,
+    0x10, 0x48, 0xF8, 0x06, 0xF8, 0x02, 0x4C, 0xDB, 0xCB, 0x5C, 0x00, 0x21, 0x3A, 0x61, 0xCF, 0x80,
+    0xE6, 0x02, 0x33, 0x6D, 0x4B, 0x1C, 0x00, 0x12, 0xA2, 0xBD, 0x41, 0x77, 0x30, 0x11, 0x12, 0x48,
+    0xDD, 0x6D, 0x23, 0x42, 0x12, 0xB3, 0x09, 0x01, 0x89, 0x17, 0xB2, 0x9D, 0x60, 0xCC, 0xCA, 0x81,
+    0xA7, 0xE7, 0xB7, 0x8B, 0xF7, 0xCA, 0xD3, 0x5E, 0x76, 0x23, 0x32, 0xAC, 0x99, 0xDA, 0xF9, 0xBF,
+    0xEA, 0x57, 0xBD, 0x7A, 0xFF, 0xFD, 0x5A, 0x91, 0xF9, 0xF3, 0x4B, 0x09, 0xF5, 0xCE, 0xEF, 0x25,
+    0x55, 0xFD, 0x7B, 0x90, 0xEC, 0xF0, 0x44, 0x61, 0x5B, 0x89, 0x9D, 0xA4, 0x8D, 0x78, 0x2A, 0x31,
+    0x6D, 0x1B, 0xB5, 0x22, 0x47, 0x17, 0x74, 0x22, 0x2E, 0x7B, 0xEC, 0x60, 0xA3, 0x76, 0x0F, 0xEB,
+    0x0D, 0x69, 0x2E, 0x4E, 0x56, 0x51, 0x03, 0x9B, 0x7C, 0xD3, 0xC3, 0x86, 0xED, 0x4E, 0x8E, 0xE2,
+    0x0F, 0x69, 0x79, 0xC4, 0x91, 0xB0, 0xDB, 0x89, 0x64, 0xE2, 0x60, 0xD3, 0x3A, 0xC5, 0x4E, 0xDC,
+    0x04, 0x23, 0x6C, 0x27, 0x55, 0x29, 0x49, 0x27, 0xC5, 0xF8, 0xB8, 0xE8, 0x64, 0x55, 0xA8, 0xC2,
+    0xFA, 0xAA, 0xDF, 0xC9, 0xBB, 0xE2, 0x2D, 0xE5, 0x8D, 0x2F, 0xA5, 0xA9, 0x72, 0x18, 0x2D, 0x01,
+    0x59, 0x6B, 0x91, 0xE0, 0xB6, 0x11, 0x09, 0xFF, 0x00, 0xA0, 0xF8, 0x17, 0x9A, 0xF3, 0x01, 0x61,
+    0x3E, 0x90, 0x2D, 0x80, 0x41, 0xAE, 0x04, 0x45, 0x9C, 0x14, 0x22, 0x68, 0x26, 0xF7, 0x3B, 0xC9,
+    0x4A, 0x60, 0x4F, 0xEA, 0xB0, 0x01, 0x80, 0xB8, 0x46, 0xFD, 0x04, 0x7D, 0x77, 0x00, 0x1F, 0x0C,
+    0x19, 0x32, 0xBA, 0xEA, 0xFB, 0xE5, 0x13, 0xA7, 0xF8, 0x46, 0x33, 0x19, 0x6D, 0x42, 0xF3, 0xFB,
+    0xB8, 0xFE, 0x6A, 0xD3, 0xA9, 0x88, 0xE7, 0x52, 0x94, 0xDD, 0x05, 0x03, 0xFB, 0xA9, 0x44, 0x92,
+    0x32, 0x41, 0xB2, 0x1A, 0xEB, 0xA0, 0xC5, 0x1A, 0x0C, 0xC6, 0x24, 0x21, 0x70, 0x28, 0x8E, 0xC2,
+    0x80, 0x1C, 0xB7, 0x71, 0x89, 0xD4, 0x11, 0x8E, 0x65, 0xE7, 0xC4, 0xF8, 0xBC, 0x67, 0x9A, 0x2D,
+    0xDA, 0xC8, 0x56, 0x30, 0x11, 0xB2, 0x82, 0xDB, 0x92, 0xEB, 0x86, 0x6B, 0x1A, 0x61, 0x97, 0x72,
+    0xA1, 0x5A, 0x86, 0xA8, 0xDE, 0x45, 0x30, 0x43, 0x3C, 0xD0, 0x8B, 0xC3, 0x80, 0x0C, 0x43, 0x08,
+    0xEC, 0x0E, 0xDF, 0xCA, 0xD8, 0x61, 0x86, 0xE8, 0xB0, 0x5E, 0xEB, 0xBD, 0x81, 0xAF, 0x2A, 0xD8,
+    0x6B, 0xE6, 0x09, 0xDB, 0x39, 0x32, 0xCB, 0x4F, 0xC7, 0x09, 0x1E, 0x60, 0x2C, 0x89, 0xE2, 0xD4,
+    0x54, 0x48, 0x3E, 0x52, 0x75, 0x33, 0xE1, 0xC4, 0x08, 0x26, 0xC5, 0xAB, 0x74, 0x14, 0xF2, 0x50,
+    0x43, 0x1E, 0xDA, 0x42, 0x17, 0x3D, 0x65, 0xB1, 0x05, 0x95, 0x60, 0x21, 0x86, 0x4C, 0x72, 0xF0,
+    0x1A, 0xD5, 0x1E, 0x58, 0xE8, 0x64, 0x4F, 0xBA, 0xD3, 0x17, 0x6B, 0xAD, 0x6E, 0x09, 0xE4, 0x40,
+    0x2E, 0xC7, 0x9D, 0x84, 0x35, 0xC8, 0x82, 0x1B, 0x3F, 0x28, 0x7A, 0x94, 0x4B, 0x90, 0x57, 0x83,
+    0xF5, 0xC0, 0x81, 0x1F, 0xC9, 0x6E, 0xD0, 0x76, 0x40, 0x20, 0x53, 0x21, 0xA9, 0x88, 0xC6, 0x6E,
+    0x9C, 0x6E, 0x09, 0x8D, 0x15, 0x79, 0x7F, 0xB9, 0xCC, 0x49, 0x46, 0xC7, 0x20, 0x97, 0xDE, 0x2D,
+    0x97, 0x5F, 0x26, 0xEC, 0x2E, 0x6E, 0x4F, 0x7D, 0xF9, 0xD6, 0x11, 0x7B, 0x57, 0xBB, 0xBE, 0x5F,
+    0x91, 0x72, 0xF3, 0xA7, 0x6D, 0x16, 0x72, 0x8A, 0xF4, 0x46, 0x63, 0x0C, 0xC7, 0x97, 0x1E, 0x83,
+    0xEA, 0xA9, 0x79, 0x59, 0x2E, 0x3F, 0x47, 0xAB, 0xB9, 0xF0, 0xA4, 0xD5, 0x99, 0x92, 0xD5, 0x4C,
+    0x3E, 0xCC, 0xFC, 0x45, 0xDD, 0xCC, 0x67, 0x6A, 0xEB, 0x1B, 0x7D, 0xB1, 0xDE, 0x1C, 0x98, 0x48,
+    0x59, 0xB8, 0xB2, 0x9B, 0x60, 0x1D, 0xBF, 0x9F, 0x23, 0x8B, 0xF9, 0x78, 0x56, 0x5A, 0x4E, 0xC0,
+    0xD2, 0xDA, 0x0A, 0xC5, 0xAA, 0x77, 0x27, 0xCA, 0x87, 0x93, 0xD0, 0x7D, 0xDB, 0x84, 0xFB, 0x28,
+    0x46, 0x3A, 0xF8, 0xF3, 0x95, 0x7E, 0xF4, 0x9B, 0x91, 0x3F, 0xF0, 0x09, 0x29, 0x1A, 0xE3, 0x58,
+    0xEF, 0x40, 0xBF, 0xA4, 0xD7, 0xF7, 0xE3, 0xFA, 0xFA, 0xE6, 0x24, 0xE0, 0x11, 0x5D, 0xF6, 0x20,
+    0x1D, 0x7E, 0x88, 0x2A, 0xAA, 0xF9, 0x6E, 0x7B, 0xCF, 0x51, 0xB9, 0x78, 0x82, 0x51, 0x4D, 0x39,
+    0x1F, 0xD4, 0x5F, 0xAF, 0x2B, 0x9D, 0x0A, 0x65, 0x0F, 0x0D, 0x2F, 0x68, 0x28, 0x58, 0xF1, 0x7A,
+    0x92, 0x82, 0x97, 0x48, 0xA0, 0x65, 0x6C, 0x51, 0x58, 0x57, 0xD6, 0xDC, 0xD1, 0xB0, 0x32, 0x2C,
+    0xB0, 0x3E, 0xF7, 0x46, 0xF8, 0xB7, 0x34, 0x2F, 0xC9, 0xBA, 0xE5, 0xDA, 0xCF, 0x7D, 0x5B, 0x64,
+    0xFA, 0x9B, 0x1D, 0x67, 0x4C, 0x63, 0xCD, 0x7B, 0xB8, 0x51, 0xB0, 0x63, 0xE4, 0x5D, 0x98, 0xFD,
+    0xB9, 0x38, 0xAC, 0x37, 0xA3, 0xB1, 0x8C, 0x47, 0xEB, 0x38, 0x2C, 0x28, 0x56, 0xD4, 0x60, 0x86,
+    0xE3, 0xFF, 0xE2, 0x08, 0x7B, 0xDF, 0x9E, 0xC0, 0x4B, 0x68, 0x25, 0xD6, 0xE3, 0xC3, 0x65, 0x91,
+    0x0F, 0x67, 0x4A, 0x4C, 0xD0, 0xAF, 0x8B, 0xD0, 0xF0, 0x36, 0x80, 0xF3, 0x52, 0x40, 0xED, 0xA7,
+    0x52, 0xD4, 0xF2, 0x81, 0xA4, 0x26, 0x4F, 0xF2, 0x13, 0xB8, 0x59, 0x79, 0x36, 0xC4, 0x32, 0xF2,
+    0x91, 0xD4, 0xB3, 0x22, 0xE8, 0x75, 0x27, 0x32, 0x4D, 0xA6, 0xC6, 0x18, 0x84, 0xF3, 0x16, 0xEF,
+    0xEB, 0x63, 0x3E, 0xF8, 0x05, 0x81, 0x2D, 0x78, 0x68, 0x47, 0xF6, 0x9C, 0x99, 0xF4, 0x24, 0xD4,
+    0x47, 0x78, 0x1E, 0x5F, 0x50, 0xF3, 0xF8, 0xE5, 0x05, 0xB5, 0x1C, 0x81, 0x98, 0x4E, 0x26, 0x2B,
+    0x88, 0x0A, 0x23, 0x0A, 0x42, 0xE1, 0x06, 0xEF, 0x35, 0x9B, 0x26, 0xC3, 0xD6, 0x5E, 0x98, 0xDF,
+    0x4D, 0x1B, 0x8D, 0xC9, 0x35, 0xC9, 0x29, 0x2B, 0xEA, 0x20, 0x9A, 0x0E, 0x3F, 0x6C, 0x20, 0xDB,
+    0xDB, 0xB9, 0xFD, 0xC3, 0x4D, 0x9E, 0x61, 0x4A, 0xC6, 0x20, 0x80, 0xE7, 0xCD, 0xE5, 0xDE, 0x70,
+    0x95, 0xAF, 0xBB, 0xFA, 0x57, 0xAE, 0xF8, 0x75, 0x17, 0x51, 0xB1, 0x0C, 0x6A, 0x44, 0xC8, 0x77,
+    0x26, 0xD4, 0xEF, 0x3B, 0x41, 0xF3, 0xDE, 0x2A, 0x3A, 0xEF, 0xF4, 0xEB, 0xAA, 0x2C, 0xF0, 0x0E,
+    0x12, 0x54, 0xAE, 0xF8, 0x1F, 0xD5, 0x31, 0x1C, 0x7E, 0xD0, 0xF8, 0xBC, 0xF9, 0xF1, 0x51, 0x3C,
+    0x07, 0x8B, 0x67, 0x83, 0xD3, 0xD3, 0x26, 0xD2, 0x3E, 0xC9, 0xDD, 0x42, 0xCE, 0xCE, 0x64, 0x81,
+    0x1F, 0xFC, 0x91, 0xE6, 0x2E, 0x56, 0xDC, 0x63, 0x69, 0x11, 0x2E, 0xFB, 0x6B, 0x34, 0x7E, 0x45,
+    0x3E, 0xB4, 0xBB, 0xAC, 0x4F, 0x93, 0xF2, 0x5F, 0x8F, 0x96, 0xD8, 0xAC, 0xB5, 0xC9, 0x4D, 0x6C,
+    0xE2, 0x0D, 0xF3, 0x68, 0x9C, 0xDC, 0x65, 0x06, 0xB1, 0x36, 0xB1, 0xE2, 0x7D, 0xF9, 0x9B, 0x87,
+    0xE1, 0x76, 0xC5, 0x79, 0x4C, 0x3E, 0x3B, 0xB6, 0xE8, 0x48, 0x6B, 0xFA, 0x59, 0xC7, 0x02, 0xCC,
+    0xEB, 0x08, 0x36, 0xBB, 0x60, 0xC1, 0x5B, 0xE6, 0x55, 0x96, 0xCD, 0x98, 0x3C, 0xB2, 0xB2, 0xE3,
+    0xAB, 0x51, 0x6D, 0x60, 0xC5, 0xF3, 0x7E, 0x92, 0x34, 0xD6, 0x72, 0x9F, 0x3E, 0x7D, 0xDE, 0x9F,
+    0x79, 0xF7, 0xF5, 0xA5, 0x14, 0xF9, 0x16, 0xF7, 0xB3, 0x05, 0x86, 0x2B, 0xB9, 0xAF, 0xB3, 0xA7,
+    0xCF, 0xFA, 0x44, 0xF3, 0x11, 0xD3, 0xEF, 0x13, 0xF9, 0xAF, 0xDF, 0x3F, 0xCD, 0x55, 0xBD, 0x6E,
+    0xD3, 0x50, 0x14, 0x3E, 0xBE, 0x6E, 0xEA, 0x0A, 0x0F, 0x5E, 0xE8, 0x52, 0x09, 0x2E, 0x23, 0x65,
+    0xC0, 0x2F, 0x50, 0x62, 0x4B, 0x88, 0xA9, 0x03, 0x19, 0xC8, 0x80, 0x18, 0x78, 0x04, 0x9E, 0xA0,
+    0x89, 0xDF, 0x00, 0x24, 0x60, 0x62, 0xA0, 0x03, 0x4B, 0xB3, 0x30, 0x23, 0x35, 0xB5, 0x55, 0x86,
+    0x0E, 0x2C, 0x81, 0x0E, 0xAC, 0xAE, 0x2A, 0x16, 0x3A, 0x60, 0x21, 0x57, 0x38, 0xE0, 0xE4, 0xF2,
+    0x7D, 0xD7, 0x4D, 0xAB, 0x56, 0x08, 0x54, 0xA9, 0x95, 0xB8, 0xBA, 0x3E, 0xCA, 0x3D, 0xF7, 0xFC,
+    0x7C, 0xE7, 0xEF, 0xC6, 0x79, 0x27, 0x7E, 0xAE, 0x4C, 0xAE, 0x8D, 0x1A, 0x6F, 0xE9, 0xD7, 0x79,
+    0xE5, 0x7D, 0x93, 0xCD, 0x15, 0x49, 0x45, 0x6B, 0x09, 0x12, 0x77, 0x27, 0xF3, 0x4A, 0xA7, 0x28,
+    0xC9, 0x8C, 0x5E, 0xED, 0x8E, 0x87, 0xAE, 0x19, 0x85, 0x53, 0x09, 0x13, 0x67, 0x28, 0x43, 0xC1,
+    0x0A, 0x63, 0x10, 0x7F, 0x04, 0xA2, 0x4A, 0x9E, 0x2F, 0x83, 0x99, 0x1A, 0xAC, 0x90, 0xE4, 0x03,
+    0x49, 0x41, 0xDE, 0x02, 0x89, 0xD4, 0x24, 0x81, 0x65, 0xA4, 0x24, 0x9E, 0x95, 0x8F, 0x12, 0x10,
+    0xD7, 0xDE, 0x85, 0x19, 0x88, 0x33, 0xB1, 0x62, 0x39, 0xA9, 0x21, 0xF1, 0xAD, 0x46, 0x9F, 0x6E,
+    0xBC, 0xCA, 0x6A, 0x64, 0x27, 0x1A, 0xA3, 0x3F, 0x6A, 0xD0, 0x71, 0xD5, 0x27, 0xDD, 0x27, 0x31,
+    0xC9, 0x72, 0xFB, 0x1F, 0x6B, 0x71, 0x59, 0x3D, 0x2F, 0x7A, 0x91, 0xB7, 0x7F, 0x71, 0x64, 0xAF,
+    0xB3, 0x08, 0xAC, 0xC4, 0xA3, 0x09, 0xCD, 0x27, 0x60, 0xD7, 0x20, 0x0C, 0xE7, 0x07, 0x23, 0xAA,
+    0x37, 0x41, 0xDA, 0x1A, 0xD1, 0x87, 0x2E, 0xCE, 0x41, 0x86, 0x6C, 0x7A, 0x79, 0x90, 0x88, 0x2A,
+    0x78, 0xAE, 0x99, 0xDD, 0x21, 0xD8, 0x30, 0x81, 0x33, 0xE4, 0x7A, 0xCC, 0x72, 0x90, 0xE1, 0xA0,
+    0x4A, 0x07, 0x89, 0xE8, 0x31, 0xA1, 0x41, 0x06, 0x0F, 0xAA, 0x62, 0x11, 0x22, 0xC8, 0x4A, 0xF0,
+    0x19, 0xBE, 0x9C, 0xAA, 0x47, 0xAF, 0x4F, 0x71, 0xF6, 0x3F, 0x21, 0xC9, 0x6E, 0xD1, 0x27, 0x93,
+    0xF7, 0x35, 0x35, 0x23, 0xC2, 0x0A, 0x63, 0x3F, 0x83, 0x3A, 0xCE, 0x5E, 0x8E, 0x33, 0x8A, 0x07,
+    0xF3, 0xB0, 0x58, 0xC9, 0xDA, 0x91, 0x84, 0x37, 0x02, 0x1A, 0xA9, 0x59, 0x5B, 0x0B, 0xD1, 0xDB,
+    0xAB, 0x66, 0xB8, 0x75, 0x7F, 0x16, 0x8C, 0xA4, 0xD9, 0x2C, 0x42, 0x97, 0xF5, 0x74, 0xBA, 0xF8,
+    0x8C, 0x19, 0x09, 0x5A, 0x20, 0x77, 0xCD, 0xCB, 0xB4, 0xD0, 0x23, 0xD1, 0x23, 0x94, 0x48, 0xEF,
+    0xC0, 0x46, 0xC4, 0x80, 0x87, 0x08, 0xCD, 0xF9, 0x09, 0x69, 0xEF, 0x00, 0xB6, 0xF5, 0x5B, 0x98,
+    0xE9, 0xFD, 0x17, 0x2C, 0xA4, 0x4D, 0x1D, 0x32, 0xAB, 0xBB, 0xE0, 0xF7, 0xD1, 0x78, 0x6E, 0x15,
+    0x8C, 0xEF, 0xA5, 0x59, 0x60, 0x4C, 0x2D, 0x9E, 0x61, 0xBC, 0x0F, 0x19, 0xB3, 0xB3, 0xC1, 0x56,
+    0x83, 0x60, 0x64, 0x72, 0xA4, 0x0F, 0x09, 0x9B, 0x38, 0x31, 0x6B, 0x25, 0x0E, 0xAB, 0xAC, 0x2F,
+    0xF5, 0x87, 0x42, 0x15, 0x92, 0x28, 0x96, 0xC8, 0x03, 0x3E, 0xC3, 0xC4, 0x12, 0xD7, 0x12, 0x71,
+    0x49, 0xEB, 0xB8, 0xDD, 0x02, 0x8A, 0xAB, 0x29, 0xCF, 0x6D, 0x39, 0xEF, 0x62, 0x93, 0x78, 0x39,
+    0x66, 0xC9, 0x9D, 0xF4, 0x91, 0x1C, 0x73, 0x9F, 0x95, 0xCB, 0x3A, 0xB8, 0x88, 0xE9, 0xE1, 0x2A,
+    0x87, 0x38, 0xDA, 0x81, 0xEB, 0xE0, 0xD0, 0x0A, 0xB1, 0xFD, 0xD6, 0xCE, 0xED, 0x45, 0x71, 0x0C,
+    0x94, 0x9D, 0x58, 0x93, 0x1D, 0x0F, 0x33, 0x4C, 0xCD, 0xDF, 0xAD, 0xA3, 0xDD, 0xBA, 0x89, 0x68,
+    0x86, 0x08, 0x9C, 0x09, 0x06, 0xFF, 0xC2, 0xDC, 0xFF, 0x25, 0x44, 0x7B, 0x3F, 0x3F, 0x16, 0x27,
+    0x41, 0xC5, 0xB5, 0xFF, 0xC5, 0x1C, 0x54, 0x2B, 0xF2, 0xC4, 0x24, 0x1D, 0x99, 0x5F, 0x6F, 0x94,
+    0xFD, 0xB1, 0x28, 0x5C, 0x26, 0x3A, 0xF8, 0x98, 0xFE, 0x2A, 0x57, 0xD0, 0xEB, 0x71, 0x47, 0x5A,
+    0xCF, 0xCE, 0xB8, 0xE0, 0xCB, 0xF3, 0x9E, 0xA4, 0xD5, 0xED, 0x76, 0x1F, 0x9C, 0xBE, 0x43, 0x47,
+    0x99, 0x3A, 0x9A, 0xBD, 0x8F, 0xE2, 0xBC, 0x91, 0x39, 0xDF, 0xC4, 0xB7, 0x43, 0x53, 0xE2, 0xE5,
+    0x30, 0x35, 0x9E, 0xF4, 0x62, 0x4E, 0x5A, 0x31, 0x6A, 0xBD, 0x10, 0x98, 0xA4, 0x1D, 0x99, 0xF1,
+    0x56, 0x5B, 0x91, 0xDF, 0xE7, 0x7C, 0x37, 0x36, 0xC6, 0xB1, 0x3C, 0xB2, 0xF6, 0x15, 0xBE, 0xDC,
+    0x4E, 0xDE, 0xC9, 0x5A, 0x1A, 0x6C, 0x70, 0x04, 0x4D, 0x6E, 0xBE, 0x0E, 0xCC, 0x36, 0x93, 0x7A,
+    0x74, 0x71, 0x13, 0xFA, 0x45, 0xAB, 0xFB, 0xF8, 0x05, 0x1E, 0xEA, 0xEF, 0x10, 0xC8, 0xE4, 0x0E,
+    0xAA, 0x00, 0xAB, 0x5A, 0xA4, 0x3B, 0xEE, 0xAE, 0x82, 0xA5, 0x81, 0xCD, 0x45, 0x52, 0xAE, 0x43,
+    0xFC, 0x06, 0xBE, 0x5B, 0x83, 0xC1, 0x60, 0x9D, 0x8E, 0xB6, 0xF1, 0x63, 0x70, 0x3A, 0x10, 0x97,
+    0x7C, 0x1B, 0xCD, 0x22, 0xA2, 0xEC, 0x9C, 0xBE, 0xB4, 0x01, 0x1A, 0xEB, 0xE4, 0x68, 0x01, 0x88,
+    0x8E, 0x31, 0x4A, 0x78, 0x23, 0x72, 0xE9, 0x97, 0xA2, 0x27, 0x38, 0xC4, 0xB6, 0xF4, 0x8C, 0x2C,
+    0x44, 0x55, 0xFC, 0x29, 0xBB, 0x02, 0xCF, 0x44, 0x9A, 0x37, 0x6F, 0xFD, 0xB5, 0x99, 0x32, 0x1C,
+    0xAC, 0x36, 0x7F, 0x2E, 0xF6, 0xF1, 0xE7, 0xEC, 0xA2, 0x09, 0xA8, 0xEF, 0xD0, 0x43, 0x3A, 0x33,
+    0x80, 0x5B, 0x5D, 0x88, 0x37, 0x05, 0x3B, 0x21, 0x97, 0x4C, 0x1A, 0x4D, 0x4E, 0x90, 0x9D, 0x31,
+    0xD5, 0x54, 0x35, 0xE1, 0x46, 0x43, 0xB2, 0x27, 0xA1, 0xD6, 0x68, 0x62, 0xFB, 0x13, 0x6E, 0x65,
+    0x62, 0x6C, 0x4E, 0x17, 0x07, 0x2C, 0x2A, 0xB9, 0x89, 0x5F, 0x37, 0x18, 0x08, 0x03, 0xB0, 0xD5,
+    0x11, 0x12, 0x0B, 0x26, 0xB3, 0x7F, 0x69, 0x57, 0xEC, 0xBE, 0x90, 0xF5, 0x1B, 0xAD, 0x55, 0xBD,
+    0x8E, 0xD4, 0x48, 0x10, 0xAE, 0x76, 0x0B, 0x3A, 0x30, 0x92, 0x2F, 0xB9, 0x10, 0x9C, 0x23, 0xAD,
+    0xFC, 0x02, 0xBB, 0x33, 0x3E, 0x5D, 0x70, 0x29, 0x01, 0x26, 0x41, 0x82, 0x37, 0x60, 0x13, 0x02,
+    0x82, 0x59, 0x6C, 0xEE, 0x1E, 0xE0, 0x2E, 0xB8, 0x7D, 0x08, 0xE6, 0x82, 0x4B, 0x2F, 0x80, 0x1D,
+    0xEB, 0x78, 0x00, 0x2C, 0x11, 0x92, 0x58, 0x02, 0x84, 0x44, 0x42, 0x23, 0x0C, 0x18, 0xAD, 0xC7,
+    0xCD, 0xF7, 0x95, 0x67, 0xF6, 0x87, 0xE4, 0x4E, 0x82, 0x56, 0x6D, 0xF5, 0x54, 0x97, 0xAB, 0xFA,
+    0xEB, 0xAF, 0xAB, 0x6B, 0x45, 0x74, 0xFC, 0xA3, 0x62, 0x47, 0x8A, 0x44, 0xA1, 0x82, 0x88, 0xAC,
+    0x5A, 0x8A, 0xA4, 0x3D, 0x45, 0xDC, 0x48, 0x91, 0x68, 0x4D, 0x91, 0xD2, 0x53, 0xD2, 0x35, 0xC5,
+    0x85, 0x1C, 0x62, 0x42, 0x23, 0x90, 0xAC, 0xA7, 0xC8, 0xA8, 0x12, 0x55, 0x94, 0x73, 0x63, 0x1E,
+    0xC2, 0x98, 0x27, 0x21, 0x84, 0xB5, 0x29, 0x8A, 0x1B, 0xAB, 0x46, 0x34, 0x25, 0x46, 0x56, 0x43,
+    0xD9, 0x8E, 0x3F, 0x8F, 0xA8, 0x52, 0x06, 0x3A, 0x0F, 0x65, 0xFA, 0x93, 0xC5, 0x79, 0xBE, 0xFD,
+    0x32, 0x6B, 0x8A, 0xA2, 0x58, 0xB5, 0x48, 0x14, 0x1A, 0xE4, 0x0C, 0xD5, 0x85, 0xA2, 0xB8, 0xAE,
+    0x3B, 0x18, 0x7E, 0x23, 0x9A, 0xE8, 0x91, 0xC6, 0x50, 0x25, 0xCC, 0x16, 0x37, 0x62, 0xF0, 0xE9,
+    0xE0, 0x18, 0xE5, 0xC6, 0xC3, 0xA3, 0xE2, 0x97, 0x1E, 0x6E, 0xDB, 0xC3, 0x6D, 0x06, 0x71, 0x0D,
+    0x36, 0x89, 0xBC, 0x64, 0xB9, 0x60, 0xA5, 0x91, 0x03, 0x89, 0x3A, 0xC9, 0xB8, 0x33, 0xA2, 0xD3,
+    0x1A, 0x6E, 0xDB, 0xC3, 0x2D, 0x65, 0x05, 0x40, 0xF1, 0x78, 0x54, 0x14, 0xB2, 0x42, 0x22, 0x1F,
+    0x31, 0xA7, 0xB8, 0x57, 0xB0, 0xE9, 0x16, 0x19, 0xA8, 0xF6, 0xF4, 0x50, 0x54, 0xF1, 0x86, 0x82,
+    0x6B, 0xE7, 0x97, 0x13, 0x3D, 0x70, 0x4B, 0x02, 0xBC, 0x90, 0x91, 0x3F, 0x2C, 0x71, 0xE5, 0x45,
+    0xB1, 0xFF, 0x77, 0x47, 0x77, 0xC8, 0xE1, 0x8E, 0xBD, 0x18, 0x2F, 0x6B, 0x26, 0xCD, 0x2A, 0x99,
+    0x89, 0x6B, 0x25, 0xCD, 0x01, 0x36, 0xAE, 0xE5, 0x3E, 0xA3, 0xB3, 0xCA, 0x74, 0x04, 0xFB, 0x48,
+    0xF0, 0xE5, 0x4C, 0xE2, 0xEE, 0xC7, 0xDB, 0x87, 0xFB, 0x3D, 0x19, 0xE9, 0x98, 0xB3, 0x35, 0x37,
+    0x3E, 0x17, 0xE7, 0x98, 0x48, 0x49, 0x4F, 0xCC, 0xBD, 0xA3, 0x56, 0x61, 0x5D, 0x24, 0x7B, 0x19,
+    0x0F, 0xC2, 0xA8, 0x7E, 0xDE, 0x6C, 0x29, 0x4E, 0x9A, 0xED, 0x0D, 0x44, 0xCA, 0xE6, 0xFA, 0xE4,
+    0x06, 0x62, 0x46, 0x9A, 0xE1, 0xD4, 0xD6, 0x63, 0xB3, 0x66, 0xF4, 0x20, 0xA3, 0x94, 0xD0, 0xB5,
+    0x59, 0x62, 0xFF, 0xD3, 0x9B, 0xBF, 0xBA, 0xC4, 0xF8, 0x9D, 0x47, 0x7C, 0x4F, 0x35, 0x80, 0xBB,
+    0x97, 0x2C, 0x87, 0xD0, 0xC6, 0xB4, 0x15, 0x9B, 0xE6, 0x19, 0xF5, 0xE7, 0xD7, 0xE5, 0x40, 0xDB,
+    0x29, 0x5B, 0xFD, 0x09, 0x98, 0x52, 0x11, 0x70, 0xDB, 0xD5, 0xBF, 0xCC, 0x51, 0x2B, 0x81, 0x59,
+    0x18, 0x1F, 0x9E, 0x2D, 0x39, 0xEE, 0xBB, 0xE4, 0x46, 0xE1, 0x29, 0x95, 0xDF, 0xAE, 0xEF, 0x63,
+    0x7F, 0xE1, 0x15, 0x56, 0x62, 0xD6, 0xEE, 0xA7, 0xB5, 0x98, 0xCE, 0x34, 0xA8, 0x91, 0x4E, 0xEE,
+    0xCA, 0x02, 0xFA, 0x32, 0x68, 0x5A, 0x88, 0xCB, 0xA5, 0xDB, 0x11, 0xD3, 0xC8, 0x95, 0x44, 0xE0,
+    0xB0, 0x4F, 0x6A, 0x38, 0xE4, 0xDD, 0x87, 0xE2, 0xE6, 0x61, 0x71, 0xC0, 0x73, 0x86, 0x70, 0x7B,
+    0xB9, 0x1C, 0x97, 0x7F, 0x3D, 0x53, 0x87, 0xF7, 0x8C, 0xD8, 0xDD, 0x63, 0x44, 0xEA, 0x2A, 0x44,
+    0x24, 0x39, 0x53, 0xB9, 0x3A, 0x85, 0xC3, 0x36, 0x91, 0x37, 0x8D, 0x5E, 0xDB, 0x5D, 0x90, 0x68,
+    0xC6, 0x3B, 0xFB, 0x20, 0x39, 0x0E, 0x4A, 0xDD, 0x85, 0x3F, 0xCF, 0x80, 0xDE, 0x80, 0x7B, 0xA3,
+    0xE0, 0x54, 0x7A, 0x2D, 0x60, 0x32, 0xB2, 0x90, 0x5E, 0xEF, 0x70, 0xA1, 0x85, 0xBE, 0x43, 0x4D,
+    0x70, 0xA2, 0xE0, 0x44, 0xC1, 0x61, 0x9C, 0x82, 0x5B, 0x2A, 0x38, 0x51, 0x70, 0x18, 0xBB, 0x5A,
+    0x83, 0x04, 0x87, 0x24, 0x39, 0x13, 0x12, 0x1C, 0xA2, 0x1B, 0x96, 0xAF, 0x82, 0x13, 0x05, 0x57,
+    0xFC, 0x7F, 0x70, 0x9D, 0x82, 0xC3, 0xCD, 0xD9, 0x41, 0x8E, 0x5B, 0xB1, 0xC7, 0xF5, 0x62, 0x26,
+    0xD6, 0x77, 0x3B, 0xB6, 0xB5, 0x1E, 0xE0, 0x66, 0xD6, 0x03, 0x9C, 0x7D, 0xE1, 0xE5, 0x5D, 0x2B,
+    0x73, 0x2F, 0x3B, 0xF7, 0x58, 0x59, 0xF1, 0x2D, 0x36, 0x9C, 0xE8, 0x59, 0x6D, 0x3F, 0xB5, 0x00,
+    0x67, 0xFD, 0x0C, 0xE0, 0xF0, 0x65, 0x9B, 0xBA, 0xDF, 0x50, 0xCD, 0x71, 0xFE, 0xC9, 0x8B, 0x7D,
+    0x5D, 0xB3, 0x2C, 0xE6, 0x0D, 0x8B, 0xD0, 0x7D, 0x03, 0x38, 0xE8, 0x68, 0x50, 0x7D, 0x4C, 0xE6,
+    0x22, 0x4F, 0xE6, 0x22, 0x82, 0x83, 0x26, 0x73, 0x91, 0x82, 0x8B, 0x14, 0x5C, 0xA4, 0xE0, 0xA0,
+    0x01, 0x8E, 0xAC, 0x78, 0x4F, 0xBD, 0xBB, 0x47, 0x9D, 0xBA, 0x5F, 0x3D, 0x99, 0xFB, 0xE8, 0x95,
+    0x39, 0xAF, 0xCC, 0x75, 0xFF, 0xC5, 0x1C, 0x5F, 0x8B, 0xF5, 0xDB, 0x77, 0x3F, 0xFF, 0xBE, 0x4B,
+    0xE1, 0xDC, 0xA8, 0xF1, 0x36, 0xE7, 0x2F, 0xC6, 0xAC, 0xBE, 0xB6, 0xA1, 0xE4, 0x31, 0xBF, 0x8E,
+    0x9F, 0xA3, 0x85, 0x78, 0xD4, 0xBB, 0x97, 0x50, 0xDB, 0x50, 0xE6, 0xA0, 0xC6, 0x75, 0x3F, 0x88,
+    0xE4, 0x62, 0xCE, 0x3E, 0x97, 0x4B, 0x9B, 0x79, 0x98, 0xA6, 0x64, 0x33, 0x87, 0x69, 0x4E, 0xDE,
+    0x4E, 0xB3, 0x9F, 0x9E, 0x7F, 0xB2, 0x69, 0x2D, 0xC3, 0x34, 0x27, 0x9F, 0x8F, 0x72, 0xAE, 0x03,
+    0xC4, 0x83, 0x61, 0x6A, 0x06, 0x3F, 0x0F, 0x6A, 0x8E, 0xC8, 0x43, 0x73, 0xC8, 0x06, 0x45, 0xDB,
+    0x84, 0x81, 0xE6, 0x4B, 0x1B, 0x06, 0xD4, 0x29, 0xFE, 0x6F, 0x84, 0xAE, 0x44, 0xE3, 0x40, 0x2F,
+    0xCD, 0xCB, 0xD0, 0xA3, 0x81, 0x74, 0xF8, 0x6B, 0xD1, 0x96, 0x72, 0xCC, 0x78, 0xDC, 0xE0, 0xB7,
+    0x0C, 0x8E, 0xA6, 0x94, 0x23, 0xBD, 0xA2, 0x4D, 0x86, 0xDD, 0xA7, 0xEC, 0x4A, 0xED, 0x13, 0x65,
+    0xA5, 0xA6, 0xDC, 0x9F, 0xDA, 0x86, 0x1C, 0x64, 0x6A, 0xCA, 0xE4, 0xC5, 0x3C, 0x99, 0x78, 0x92,
+    0xA7, 0xE3, 0x0B,
+};
+
+static const uint32_t bookerly_16_regularBlockOffsets[42] = {
+    0, 1126, 2141, 3187, 4132, 5214, 6344, 7098,
+    7771, 8563, 9388, 10105, 11060, 11963, 12683, 13430,
+    14173, 15034, 15796, 16426, 17486, 18473, 19416, 20374,
+    21370, 22374, 23468, 24552, 25597, 26566, 27466, 28388,
+    29294, 30334, 31153, 32077, 33046, 34312, 35425, 36444,
+    37245, 38099,
+};
+
+static const uint16_t bookerly_16_regularDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+    277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_regularGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+};
+
+static const uint16_t bookerly_16_regularPageGlyphs[1536] = {
+    325, 326, 327, 328, 329, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 337,
+    0, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0,
+    0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 0, 0, 0, 351, 352, 0,
+    353, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 355, 0, 356, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+    406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421,
+    422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453,
+    0, 0, 454, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 456, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 0, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 0, 638, 0,
+    0, 0, 0, 639, 640, 0, 0, 641, 642, 643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 644, 0, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0, 646,
+    647, 648, 649, 650, 651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    652, 0, 0, 0, 653, 654, 655, 656, 657, 658, 0, 0, 0, 0, 0, 659,
+    660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 670, 671, 0, 0, 672, 0, 0, 0, 0, 673, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    674, 675, 676, 677, 678, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 681, 682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    684, 685, 686, 687, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 690, 691, 0, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 701,
+    0, 702, 703, 0, 0, 704, 705, 706, 707, 708, 709, 0, 0, 710, 711, 712,
+    713, 0, 0, 714, 0, 715, 0, 716, 717, 718, 719, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 721, 722, 723, 724, 0, 0, 0, 0, 725, 0, 0, 0,
+    0, 0, 0, 0, 0, 726, 0, 0, 727, 0, 0, 0, 0, 728, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    729, 730, 0, 0, 731, 732, 0, 0, 0, 0, 733, 734, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 735, 736, 737, 738, 739, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 740, 741, 742, 743, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 746,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0,
 };
 
 static const EpdGlyph bookerly_16_regularGlyphs[] = {
@@ -5103,723 +2591,723 @@ static const EpdGlyph bookerly_16_regularGlyphs[] = {
     { 17, 24, 21, 2, 23, 102, 1659 }, // 6
     { 16, 24, 21, 3, 23, 96, 1761 }, // 7
     { 17, 24, 21, 2, 23, 102, 1857 }, // 8
-    { 16, 24, 21, 2, 23, 96, 1959 }, // 9
-    { 5, 18, 9, 2, 17, 23, 2055 }, // :
-    { 8, 24, 9, 0, 17, 48, 2078 }, // ;
-    { 15, 16, 21, 3, 19, 60, 2126 }, // <
-    { 15, 9, 21, 3, 16, 34, 2186 }, // =
-    { 15, 16, 21, 3, 19, 60, 2220 }, // >
-    { 12, 25, 16, 2, 24, 75, 2280 }, // ?
-    { 29, 30, 32, 1, 23, 218, 2355 }, // @
-    { 25, 24, 24, 0, 24, 150, 2573 }, // A
-    { 19, 25, 20, 1, 24, 119, 2723 }, // B
-    { 19, 25, 21, 1, 24, 119, 2842 }, // C
-    { 23, 25, 25, 1, 24, 144, 2961 }, // D
-    { 19, 23, 21, 1, 23, 110, 3105 }, // E
-    { 17, 23, 19, 1, 23, 98, 3215 }, // F
-    { 22, 25, 24, 1, 24, 138, 3313 }, // G
-    { 26, 23, 28, 1, 23, 150, 3451 }, // H
-    { 11, 23, 12, 1, 23, 64, 3601 }, // I
-    { 14, 30, 12, -2, 23, 105, 3665 }, // J
-    { 23, 24, 24, 1, 23, 138, 3770 }, // K
-    { 19, 23, 20, 1, 23, 110, 3908 }, // L
-    { 30, 23, 30, 0, 23, 173, 4018 }, // M
-    { 26, 24, 27, 1, 23, 156, 4191 }, // N
-    { 24, 25, 26, 1, 24, 150, 4347 }, // O
-    { 18, 24, 20, 1, 24, 108, 4497 }, // P
-    { 26, 31, 26, 1, 24, 202, 4605 }, // Q
-    { 22, 25, 22, 1, 24, 138, 4807 }, // R
-    { 16, 25, 18, 1, 24, 100, 4945 }, // S
-    { 21, 23, 23, 1, 23, 121, 5045 }, // T
-    { 25, 24, 26, 0, 23, 150, 5166 }, // U
-    { 24, 24, 24, 0, 23, 144, 5316 }, // V
-    { 36, 24, 37, 0, 23, 216, 5460 }, // W
-    { 24, 23, 24, 0, 23, 138, 5676 }, // X
-    { 23, 23, 23, 0, 23, 133, 5814 }, // Y
-    { 18, 24, 20, 1, 23, 108, 5947 }, // Z
-    { 7, 32, 10, 2, 26, 56, 6055 }, // [
-    { 14, 26, 16, 1, 24, 91, 6111 }, // <backslash>
-    { 7, 32, 10, 1, 26, 56, 6202 }, // ]
-    { 16, 15, 21, 2, 21, 60, 6258 }, // ^
-    { 17, 3, 17, 0, -1, 13, 6318 }, // _
-    { 8, 9, 22, 7, 28, 18, 6331 }, // `
-    { 18, 19, 18, 1, 18, 86, 6349 }, // a
-    { 20, 27, 20, -1, 26, 135, 6435 }, // b
-    { 15, 19, 17, 1, 18, 72, 6570 }, // c
-    { 20, 27, 21, 1, 26, 135, 6642 }, // d
-    { 15, 19, 17, 1, 18, 72, 6777 }, // e
-    { 16, 26, 13, 0, 26, 104, 6849 }, // f
-    { 19, 26, 19, 0, 18, 124, 6953 }, // g
-    { 22, 26, 22, 0, 26, 143, 7077 }, // h
-    { 11, 26, 11, 0, 26, 72, 7220 }, // i
-    { 10, 34, 9, -2, 26, 85, 7292 }, // j
-    { 20, 27, 20, 0, 26, 135, 7377 }, // k
-    { 11, 26, 11, 0, 26, 72, 7512 }, // l
-    { 33, 18, 33, 0, 18, 149, 7584 }, // m
-    { 22, 18, 22, 0, 18, 99, 7733 }, // n
-    { 18, 19, 20, 1, 18, 86, 7832 }, // o
-    { 19, 26, 20, 0, 18, 124, 7918 }, // p
-    { 19, 26, 20, 1, 18, 124, 8042 }, // q
-    { 15, 18, 15, 0, 18, 68, 8166 }, // r
-    { 14, 19, 16, 1, 18, 67, 8234 }, // s
-    { 13, 23, 14, 0, 22, 75, 8301 }, // t
-    { 22, 19, 21, 0, 18, 105, 8376 }, // u
-    { 20, 18, 20, 0, 17, 90, 8481 }, // v
-    { 29, 18, 29, 0, 17, 131, 8571 }, // w
-    { 20, 17, 20, 0, 17, 85, 8702 }, // x
-    { 20, 25, 20, 0, 17, 125, 8787 }, // y
-    { 15, 18, 17, 1, 17, 68, 8912 }, // z
-    { 10, 33, 13, 2, 27, 83, 8980 }, // {
-    { 3, 30, 9, 3, 26, 23, 9063 }, // |
-    { 11, 33, 13, 0, 27, 91, 9086 }, // }
-    { 16, 6, 21, 2, 14, 24, 9177 }, // ~
-    { 0, 0, 7, 0, 0, 0, 9201 }, //  
-    { 6, 26, 9, 1, 18, 39, 9201 }, // ¡
-    { 16, 33, 21, 2, 26, 132, 9240 }, // ¢
-    { 19, 24, 21, 1, 23, 114, 9372 }, // £
-    { 19, 16, 21, 1, 19, 76, 9486 }, // ¤
-    { 22, 23, 21, -1, 23, 127, 9562 }, // ¥
-    { 3, 30, 9, 3, 26, 23, 9689 }, // ¦
-    { 15, 26, 17, 1, 23, 98, 9712 }, // §
-    { 12, 5, 22, 5, 25, 15, 9810 }, // ¨
-    { 25, 25, 26, 0, 24, 157, 9825 }, // ©
-    { 11, 16, 15, 2, 24, 44, 9982 }, // ª
-    { 17, 13, 17, 1, 15, 56, 10026 }, // «
-    { 15, 8, 21, 3, 15, 30, 10082 }, // ¬
-    { 11, 3, 12, 1, 10, 9, 10112 }, // ­
-    { 19, 18, 19, 0, 26, 86, 10121 }, // ®
-    { 12, 4, 22, 5, 24, 12, 10207 }, // ¯
-    { 12, 11, 17, 3, 23, 33, 10219 }, // °
-    { 15, 20, 21, 3, 20, 75, 10252 }, // ±
-    { 12, 16, 15, 2, 28, 48, 10327 }, // ²
-    { 11, 17, 15, 2, 28, 47, 10375 }, // ³
-    { 7, 8, 22, 8, 27, 14, 10422 }, // ´
-    { 21, 26, 22, 2, 18, 137, 10436 }, // µ
-    { 17, 28, 18, 0, 23, 119, 10573 }, // ¶
-    { 5, 6, 9, 2, 12, 8, 10692 }, // ·
-    { 6, 8, 22, 8, -1, 12, 10700 }, // ¸
-    { 10, 16, 15, 2, 28, 40, 10712 }, // ¹
-    { 12, 16, 15, 2, 24, 48, 10752 }, // º
-    { 17, 13, 17, 1, 15, 56, 10800 }, // »
-    { 32, 27, 36, 2, 24, 216, 10856 }, // ¼
-    { 32, 27, 36, 2, 24, 216, 11072 }, // ½
-    { 33, 27, 36, 2, 24, 223, 11288 }, // ¾
-    { 13, 25, 16, 1, 18, 82, 11511 }, // ¿
-    { 25, 32, 24, 0, 32, 200, 11593 }, // À
-    { 25, 32, 24, 0, 32, 200, 11793 }, // Á
-    { 25, 32, 24, 0, 32, 200, 11993 }, // Â
-    { 25, 31, 24, 0, 31, 194, 12193 }, // Ã
-    { 25, 31, 24, 0, 31, 194, 12387 }, // Ä
-    { 25, 33, 24, 0, 33, 207, 12581 }, // Å
-    { 31, 23, 31, -1, 23, 179, 12788 }, // Æ
-    { 19, 33, 21, 1, 24, 157, 12967 }, // Ç
-    { 19, 32, 21, 1, 32, 152, 13124 }, // È
-    { 19, 32, 21, 1, 32, 152, 13276 }, // É
-    { 19, 32, 21, 1, 32, 152, 13428 }, // Ê
-    { 19, 31, 21, 1, 31, 148, 13580 }, // Ë
-    { 11, 32, 12, 1, 32, 88, 13728 }, // Ì
-    { 11, 32, 12, 1, 32, 88, 13816 }, // Í
-    { 12, 32, 12, 0, 32, 96, 13904 }, // Î
-    { 12, 31, 12, 0, 31, 93, 14000 }, // Ï
-    { 24, 25, 25, 0, 24, 150, 14093 }, // Ð
-    { 26, 32, 27, 1, 31, 208, 14243 }, // Ñ
-    { 24, 33, 26, 1, 32, 198, 14451 }, // Ò
-    { 24, 33, 26, 1, 32, 198, 14649 }, // Ó
-    { 24, 33, 26, 1, 32, 198, 14847 }, // Ô
-    { 24, 32, 26, 1, 31, 192, 15045 }, // Õ
-    { 24, 32, 26, 1, 31, 192, 15237 }, // Ö
-    { 14, 14, 21, 3, 18, 49, 15429 }, // ×
-    { 25, 25, 26, 0, 24, 157, 15478 }, // Ø
-    { 25, 33, 26, 0, 32, 207, 15635 }, // Ù
-    { 25, 33, 26, 0, 32, 207, 15842 }, // Ú
-    { 25, 33, 26, 0, 32, 207, 16049 }, // Û
-    { 25, 32, 26, 0, 31, 200, 16256 }, // Ü
-    { 23, 32, 23, 0, 32, 184, 16456 }, // Ý
-    { 18, 23, 21, 1, 23, 104, 16640 }, // Þ
-    { 21, 27, 21, 0, 26, 142, 16744 }, // ß
-    { 18, 29, 18, 1, 28, 131, 16886 }, // à
-    { 18, 28, 18, 1, 27, 126, 17017 }, // á
-    { 18, 28, 18, 1, 27, 126, 17143 }, // â
-    { 18, 27, 18, 1, 26, 122, 17269 }, // ã
-    { 18, 26, 18, 1, 25, 117, 17391 }, // ä
-    { 18, 29, 18, 1, 28, 131, 17508 }, // å
-    { 25, 19, 27, 1, 18, 119, 17639 }, // æ
-    { 15, 27, 17, 1, 18, 102, 17758 }, // ç
-    { 15, 29, 17, 1, 28, 109, 17860 }, // è
-    { 15, 28, 17, 1, 27, 105, 17969 }, // é
-    { 15, 28, 17, 1, 27, 105, 18074 }, // ê
-    { 15, 26, 17, 1, 25, 98, 18179 }, // ë
-    { 11, 28, 11, 0, 28, 77, 18277 }, // ì
-    { 11, 27, 11, 0, 27, 75, 18354 }, // í
-    { 11, 27, 11, 0, 27, 75, 18429 }, // î
-    { 12, 25, 11, -1, 25, 75, 18504 }, // ï
-    { 18, 28, 20, 1, 27, 126, 18579 }, // ð
-    { 22, 26, 22, 0, 26, 143, 18705 }, // ñ
-    { 18, 29, 20, 1, 28, 131, 18848 }, // ò
-    { 18, 28, 20, 1, 27, 126, 18979 }, // ó
-    { 18, 28, 20, 1, 27, 126, 19105 }, // ô
-    { 18, 27, 20, 1, 26, 122, 19231 }, // õ
-    { 18, 26, 20, 1, 25, 117, 19353 }, // ö
-    { 15, 16, 21, 3, 19, 60, 19470 }, // ÷
-    { 19, 19, 20, 0, 18, 91, 19530 }, // ø
-    { 22, 29, 21, 0, 28, 160, 19621 }, // ù
-    { 22, 28, 21, 0, 27, 154, 19781 }, // ú
-    { 22, 28, 21, 0, 27, 154, 19935 }, // û
-    { 22, 26, 21, 0, 25, 143, 20089 }, // ü
-    { 20, 35, 20, 0, 27, 175, 20232 }, // ý
-    { 20, 34, 21, 0, 26, 170, 20407 }, // þ
-    { 20, 33, 20, 0, 25, 165, 20577 }, // ÿ
-    { 25, 30, 24, 0, 30, 188, 20742 }, // Ā
-    { 18, 25, 18, 1, 24, 113, 20930 }, // ā
-    { 25, 32, 24, 0, 32, 200, 21043 }, // Ă
-    { 18, 27, 18, 1, 26, 122, 21243 }, // ă
-    { 25, 31, 24, 0, 24, 194, 21365 }, // Ą
-    { 18, 25, 18, 1, 18, 113, 21559 }, // ą
-    { 19, 33, 21, 1, 32, 157, 21672 }, // Ć
-    { 15, 28, 17, 1, 27, 105, 21829 }, // ć
-    { 19, 33, 21, 1, 32, 157, 21934 }, // Ĉ
-    { 15, 28, 17, 1, 27, 105, 22091 }, // ĉ
-    { 19, 32, 21, 1, 31, 152, 22196 }, // Ċ
-    { 15, 26, 17, 1, 25, 98, 22348 }, // ċ
-    { 19, 33, 21, 1, 32, 157, 22446 }, // Č
-    { 15, 28, 17, 1, 27, 105, 22603 }, // č
-    { 23, 33, 25, 1, 32, 190, 22708 }, // Ď
-    { 23, 27, 21, 1, 26, 156, 22898 }, // ď
-    { 24, 25, 25, 0, 24, 150, 23054 }, // Đ
-    { 20, 27, 21, 1, 26, 135, 23204 }, // đ
-    { 19, 30, 21, 1, 30, 143, 23339 }, // Ē
-    { 15, 25, 17, 1, 24, 94, 23482 }, // ē
-    { 19, 32, 21, 1, 32, 152, 23576 }, // Ĕ
-    { 15, 27, 17, 1, 26, 102, 23728 }, // ĕ
-    { 19, 31, 21, 1, 31, 148, 23830 }, // Ė
-    { 15, 26, 17, 1, 25, 98, 23978 }, // ė
-    { 19, 30, 21, 1, 23, 143, 24076 }, // Ę
-    { 15, 25, 17, 1, 18, 94, 24219 }, // ę
-    { 19, 32, 21, 1, 32, 152, 24313 }, // Ě
-    { 15, 28, 17, 1, 27, 105, 24465 }, // ě
-    { 22, 33, 24, 1, 32, 182, 24570 }, // Ĝ
-    { 19, 35, 19, 0, 27, 167, 24752 }, // ĝ
-    { 22, 33, 24, 1, 32, 182, 24919 }, // Ğ
-    { 19, 34, 19, 0, 26, 162, 25101 }, // ğ
-    { 22, 32, 24, 1, 31, 176, 25263 }, // Ġ
-    { 19, 33, 19, 0, 25, 157, 25439 }, // ġ
-    { 22, 33, 24, 1, 24, 182, 25596 }, // Ģ
-    { 19, 36, 19, 0, 28, 171, 25778 }, // ģ
-    { 26, 32, 28, 1, 32, 208, 25949 }, // Ĥ
-    { 23, 34, 22, -1, 34, 196, 26157 }, // ĥ
-    { 27, 23, 28, 0, 23, 156, 26353 }, // Ħ
-    { 22, 26, 22, 0, 26, 143, 26509 }, // ħ
-    { 12, 31, 12, 0, 31, 93, 26652 }, // Ĩ
-    { 11, 26, 11, 0, 26, 72, 26745 }, // ĩ
-    { 12, 30, 12, 0, 30, 90, 26817 }, // Ī
-    { 11, 24, 11, 0, 24, 66, 26907 }, // ī
-    { 12, 32, 12, 0, 32, 96, 26973 }, // Ĭ
-    { 11, 26, 11, 0, 26, 72, 27069 }, // ĭ
-    { 11, 30, 12, 1, 23, 83, 27141 }, // Į
-    { 11, 33, 11, 0, 26, 91, 27224 }, // į
-    { 11, 31, 12, 1, 31, 86, 27315 }, // İ
-    { 11, 18, 11, 0, 18, 50, 27401 }, // ı
-    { 22, 30, 24, 1, 23, 165, 27451 }, // Ĳ
-    { 18, 34, 20, 0, 26, 153, 27616 }, // ĳ
-    { 14, 39, 12, -2, 32, 137, 27769 }, // Ĵ
-    { 13, 35, 9, -2, 27, 114, 27906 }, // ĵ
-    { 23, 32, 24, 1, 23, 184, 28020 }, // Ķ
-    { 20, 35, 20, 0, 26, 175, 28204 }, // ķ
-    { 21, 19, 20, 0, 18, 100, 28379 }, // ĸ
-    { 19, 32, 20, 1, 32, 152, 28479 }, // Ĺ
-    { 11, 34, 11, 0, 34, 94, 28631 }, // ĺ
-    { 19, 32, 20, 1, 23, 152, 28725 }, // Ļ
-    { 11, 35, 11, 0, 26, 97, 28877 }, // ļ
-    { 19, 26, 20, 1, 26, 124, 28974 }, // Ľ
-    { 14, 26, 11, 0, 26, 91, 29098 }, // ľ
-    { 19, 23, 20, 1, 23, 110, 29189 }, // Ŀ
-    { 16, 26, 15, 0, 26, 104, 29299 }, // ŀ
-    { 21, 23, 20, -1, 23, 121, 29403 }, // Ł
-    { 13, 26, 11, -1, 26, 85, 29524 }, // ł
-    { 26, 33, 27, 1, 32, 215, 29609 }, // Ń
-    { 22, 27, 22, 0, 27, 149, 29824 }, // ń
-    { 26, 32, 27, 1, 23, 208, 29973 }, // Ņ
-    { 22, 27, 22, 0, 18, 149, 30181 }, // ņ
-    { 26, 33, 27, 1, 32, 215, 30330 }, // Ň
-    { 22, 27, 22, 0, 27, 149, 30545 }, // ň
-    { 29, 25, 30, 1, 25, 182, 30694 }, // ŉ
-    { 26, 30, 27, 1, 23, 195, 30876 }, // Ŋ
-    { 19, 26, 21, 0, 18, 124, 31071 }, // ŋ
-    { 24, 31, 26, 1, 30, 186, 31195 }, // Ō
-    { 18, 25, 20, 1, 24, 113, 31381 }, // ō
-    { 24, 33, 26, 1, 32, 198, 31494 }, // Ŏ
-    { 18, 27, 20, 1, 26, 122, 31692 }, // ŏ
-    { 24, 34, 26, 1, 33, 204, 31814 }, // Ő
-    { 18, 28, 20, 1, 27, 126, 32018 }, // ő
-    { 30, 24, 32, 1, 23, 180, 32144 }, // Œ
-    { 28, 19, 30, 1, 18, 133, 32324 }, // œ
-    { 22, 33, 22, 1, 32, 182, 32457 }, // Ŕ
-    { 15, 27, 15, 0, 27, 102, 32639 }, // ŕ
-    { 22, 33, 22, 1, 24, 182, 32741 }, // Ŗ
-    { 15, 27, 15, 0, 18, 102, 32923 }, // ŗ
-    { 22, 33, 22, 1, 32, 182, 33025 }, // Ř
-    { 15, 27, 15, 0, 27, 102, 33207 }, // ř
-    { 16, 33, 18, 1, 32, 132, 33309 }, // Ś
-    { 14, 28, 16, 1, 27, 98, 33441 }, // ś
-    { 16, 33, 18, 1, 32, 132, 33539 }, // Ŝ
-    { 14, 28, 16, 1, 27, 98, 33671 }, // ŝ
-    { 16, 33, 18, 1, 24, 132, 33769 }, // Ş
-    { 14, 27, 16, 1, 18, 95, 33901 }, // ş
-    { 16, 33, 18, 1, 32, 132, 33996 }, // Š
-    { 14, 28, 16, 1, 27, 98, 34128 }, // š
-    { 21, 32, 23, 1, 23, 168, 34226 }, // Ţ
-    { 13, 31, 14, 0, 22, 101, 34394 }, // ţ
-    { 21, 32, 23, 1, 32, 168, 34495 }, // Ť
-    { 13, 28, 14, 0, 27, 91, 34663 }, // ť
-    { 21, 23, 23, 1, 23, 121, 34754 }, // Ŧ
-    { 13, 23, 14, 0, 22, 75, 34875 }, // ŧ
-    { 25, 32, 26, 0, 31, 200, 34950 }, // Ũ
-    { 22, 27, 21, 0, 26, 149, 35150 }, // ũ
-    { 25, 31, 26, 0, 30, 194, 35299 }, // Ū
-    { 22, 25, 21, 0, 24, 138, 35493 }, // ū
-    { 25, 33, 26, 0, 32, 207, 35631 }, // Ŭ
-    { 22, 27, 21, 0, 26, 149, 35838 }, // ŭ
-    { 25, 34, 26, 0, 33, 213, 35987 }, // Ů
-    { 22, 29, 21, 0, 28, 160, 36200 }, // ů
-    { 25, 34, 26, 0, 33, 213, 36360 }, // Ű
-    { 22, 28, 21, 0, 27, 154, 36573 }, // ű
-    { 25, 30, 26, 0, 23, 188, 36727 }, // Ų
-    { 22, 25, 21, 0, 18, 138, 36915 }, // ų
-    { 36, 33, 37, 0, 32, 297, 37053 }, // Ŵ
-    { 29, 28, 29, 0, 27, 203, 37350 }, // ŵ
-    { 23, 32, 23, 0, 32, 184, 37553 }, // Ŷ
-    { 20, 35, 20, 0, 27, 175, 37737 }, // ŷ
-    { 23, 31, 23, 0, 31, 179, 37912 }, // Ÿ
-    { 18, 33, 20, 1, 32, 149, 38091 }, // Ź
-    { 15, 28, 17, 1, 27, 105, 38240 }, // ź
-    { 18, 32, 20, 1, 31, 144, 38345 }, // Ż
-    { 15, 26, 17, 1, 25, 98, 38489 }, // ż
-    { 18, 33, 20, 1, 32, 149, 38587 }, // Ž
-    { 15, 28, 17, 1, 27, 105, 38736 }, // ž
-    { 16, 26, 13, 0, 26, 104, 38841 }, // ſ
-    { 7, 9, 0, -5, 28, 16, 38945 }, // ̀
-    { 7, 8, 0, -2, 27, 14, 38961 }, // ́
-    { 12, 8, 0, -6, 27, 24, 38975 }, // ̂
-    { 12, 6, 0, -6, 26, 18, 38999 }, // ̃
-    { 12, 4, 0, -6, 24, 12, 39017 }, // ̄
-    { 12, 6, 0, -6, 26, 18, 39029 }, // ̆
-    { 6, 5, 0, -3, 25, 8, 39047 }, // ̇
-    { 12, 5, 0, -6, 25, 15, 39055 }, // ̈
-    { 10, 10, 0, -5, 29, 25, 39070 }, // ̉
-    { 10, 10, 0, -5, 28, 25, 39095 }, // ̊
-    { 12, 8, 0, -5, 27, 24, 39120 }, // ̋
-    { 12, 8, 0, -6, 27, 24, 39144 }, // ̌
-    { 12, 8, 0, -7, 27, 24, 39168 }, // ̏
-    { 12, 6, 0, -6, 26, 18, 39192 }, // ̑
-    { 6, 9, 0, -3, 28, 14, 39210 }, // ̒
-    { 6, 10, 0, -2, 29, 15, 39224 }, // ̓
-    { 6, 10, 0, -4, 29, 15, 39239 }, // ̔
-    { 4, 9, 0, -2, 29, 9, 39254 }, // ̕
-    { 6, 8, 0, -3, 21, 12, 39263 }, // ̛
-    { 6, 6, 0, -3, -2, 9, 39275 }, // ̣
-    { 12, 5, 0, -6, -3, 15, 39284 }, // ̤
-    { 8, 8, 0, -4, -1, 16, 39299 }, // ̥
-    { 6, 8, 0, -3, -1, 12, 39315 }, // ̦
-    { 6, 8, 0, -3, -1, 12, 39327 }, // ̧
-    { 8, 8, 0, -4, 1, 16, 39339 }, // ̨
-    { 3, 8, 9, 3, -1, 6, 39355 }, // ̩
-    { 12, 7, 0, -6, -2, 21, 39361 }, // ̭
-    { 12, 6, 0, -6, -2, 18, 39382 }, // ̮
-    { 12, 6, 0, -6, -2, 18, 39400 }, // ̰
-    { 12, 4, 0, -6, -3, 12, 39418 }, // ̱
-    { 12, 6, 0, -6, 26, 18, 39430 }, // ͂
-    { 12, 13, 0, -6, 33, 39, 39448 }, // ̈́
-    { 6, 6, 0, -2, -2, 9, 39487 }, // ͅ
-    { 19, 32, 21, 1, 32, 152, 39496 }, // Ѐ
-    { 19, 31, 21, 1, 31, 148, 39648 }, // Ё
-    { 25, 30, 27, 1, 23, 188, 39796 }, // Ђ
-    { 17, 32, 19, 1, 32, 136, 39984 }, // Ѓ
-    { 20, 25, 22, 1, 24, 125, 40120 }, // Є
-    { 16, 25, 18, 1, 24, 100, 40245 }, // Ѕ
-    { 11, 23, 12, 1, 23, 64, 40345 }, // І
-    { 12, 31, 12, 0, 31, 93, 40409 }, // Ї
-    { 14, 30, 12, -2, 23, 105, 40502 }, // Ј
-    { 31, 24, 32, 0, 23, 186, 40607 }, // Љ
-    { 32, 24, 34, 1, 23, 192, 40793 }, // Њ
-    { 27, 23, 28, 1, 23, 156, 40985 }, // Ћ
-    { 23, 33, 24, 1, 32, 190, 41141 }, // Ќ
-    { 26, 32, 27, 1, 32, 208, 41331 }, // Ѝ
-    { 24, 32, 24, 0, 31, 192, 41539 }, // Ў
-    { 25, 31, 26, 1, 23, 194, 41731 }, // Џ
-    { 25, 24, 24, 0, 24, 150, 41925 }, // А
-    { 19, 24, 21, 1, 23, 114, 42075 }, // Б
-    { 19, 25, 20, 1, 24, 119, 42189 }, // В
-    { 17, 23, 19, 1, 23, 98, 42308 }, // Г
-    { 24, 30, 25, 0, 23, 180, 42406 }, // Д
-    { 19, 23, 21, 1, 23, 110, 42586 }, // Е
-    { 33, 25, 33, 0, 24, 207, 42696 }, // Ж
-    { 17, 25, 19, 1, 24, 107, 42903 }, // З
-    { 26, 23, 27, 1, 23, 150, 43010 }, // И
-    { 26, 31, 27, 1, 31, 202, 43160 }, // Й
-    { 23, 25, 24, 1, 24, 144, 43362 }, // К
-    { 24, 24, 24, 0, 23, 144, 43506 }, // Л
-    { 30, 23, 30, 0, 23, 173, 43650 }, // М
-    { 26, 23, 28, 1, 23, 150, 43823 }, // Н
-    { 24, 25, 26, 1, 24, 150, 43973 }, // О
-    { 25, 23, 27, 1, 23, 144, 44123 }, // П
-    { 18, 24, 20, 1, 24, 108, 44267 }, // Р
-    { 19, 25, 21, 1, 24, 119, 44375 }, // С
-    { 21, 23, 23, 1, 23, 121, 44494 }, // Т
-    { 24, 24, 24, 0, 23, 144, 44615 }, // У
-    { 24, 25, 26, 1, 24, 150, 44759 }, // Ф
-    { 24, 23, 24, 0, 23, 138, 44909 }, // Х
-    { 25, 30, 26, 1, 23, 188, 45047 }, // Ц
-    { 23, 23, 24, 0, 23, 133, 45235 }, // Ч
-    { 33, 23, 35, 1, 23, 190, 45368 }, // Ш
-    { 34, 30, 35, 1, 23, 255, 45558 }, // Щ
-    { 24, 24, 25, 1, 23, 144, 45813 }, // Ъ
-    { 29, 24, 31, 1, 23, 174, 45957 }, // Ы
-    { 19, 24, 21, 1, 23, 114, 46131 }, // Ь
-    { 20, 25, 22, 1, 24, 125, 46245 }, // Э
-    { 33, 25, 35, 1, 24, 207, 46370 }, // Ю
-    { 22, 24, 22, -1, 23, 132, 46577 }, // Я
-    { 18, 19, 18, 1, 18, 86, 46709 }, // а
-    { 17, 27, 19, 1, 26, 115, 46795 }, // б
-    { 16, 19, 18, 1, 18, 76, 46910 }, // в
-    { 15, 17, 16, 1, 17, 64, 46986 }, // г
-    { 21, 23, 21, 0, 17, 121, 47050 }, // д
-    { 15, 19, 17, 1, 18, 72, 47171 }, // е
-    { 27, 19, 27, 0, 18, 129, 47243 }, // ж
-    { 14, 19, 16, 1, 18, 67, 47372 }, // з
-    { 21, 17, 23, 1, 17, 90, 47439 }, // и
-    { 21, 25, 23, 1, 25, 132, 47529 }, // й
-    { 19, 19, 19, 1, 18, 91, 47661 }, // к
-    { 20, 18, 20, 0, 17, 90, 47752 }, // л
-    { 24, 17, 26, 1, 17, 102, 47842 }, // м
-    { 21, 17, 23, 1, 17, 90, 47944 }, // н
-    { 18, 19, 20, 1, 18, 86, 48034 }, // о
-    { 21, 17, 23, 1, 17, 90, 48120 }, // п
-    { 19, 26, 20, 0, 18, 124, 48210 }, // р
-    { 15, 19, 17, 1, 18, 72, 48334 }, // с
-    { 17, 17, 19, 1, 17, 73, 48406 }, // т
-    { 20, 25, 20, 0, 17, 125, 48479 }, // у
-    { 23, 34, 24, 1, 26, 196, 48604 }, // ф
-    { 20, 17, 20, 0, 17, 85, 48800 }, // х
-    { 21, 23, 23, 1, 17, 121, 48885 }, // ц
-    { 19, 17, 20, 0, 17, 81, 49006 }, // ч
-    { 27, 17, 29, 1, 17, 115, 49087 }, // ш
-    { 28, 23, 29, 1, 17, 161, 49202 }, // щ
-    { 19, 18, 21, 1, 17, 86, 49363 }, // ъ
-    { 25, 18, 27, 1, 17, 113, 49449 }, // ы
-    { 16, 18, 18, 1, 17, 72, 49562 }, // ь
-    { 15, 19, 17, 1, 18, 72, 49634 }, // э
-    { 26, 19, 28, 1, 18, 124, 49706 }, // ю
-    { 18, 18, 19, 0, 17, 81, 49830 }, // я
-    { 15, 29, 17, 1, 28, 109, 49911 }, // ѐ
-    { 15, 26, 17, 1, 25, 98, 50020 }, // ё
-    { 19, 34, 21, 0, 26, 162, 50118 }, // ђ
-    { 15, 27, 16, 1, 27, 102, 50280 }, // ѓ
-    { 15, 19, 17, 1, 18, 72, 50382 }, // є
-    { 14, 19, 16, 1, 18, 67, 50454 }, // ѕ
-    { 11, 26, 11, 0, 26, 72, 50521 }, // і
-    { 12, 25, 11, -1, 25, 75, 50593 }, // ї
-    { 10, 34, 9, -2, 26, 85, 50668 }, // ј
-    { 26, 18, 26, 0, 17, 117, 50753 }, // љ
-    { 26, 18, 28, 1, 17, 117, 50870 }, // њ
-    { 22, 26, 22, 0, 26, 143, 50987 }, // ћ
-    { 19, 28, 19, 1, 27, 133, 51130 }, // ќ
-    { 21, 28, 23, 1, 28, 147, 51263 }, // ѝ
-    { 20, 33, 20, 0, 25, 165, 51410 }, // ў
-    { 21, 24, 22, 1, 17, 126, 51575 }, // џ
-    { 23, 27, 24, 0, 26, 156, 51701 }, // Ѣ
-    { 19, 25, 20, 1, 24, 119, 51857 }, // ѣ
-    { 24, 25, 26, 1, 24, 150, 51976 }, // Ѳ
-    { 18, 19, 20, 1, 18, 86, 52126 }, // ѳ
-    { 25, 25, 25, 0, 24, 157, 52212 }, // Ѵ
-    { 21, 19, 20, 0, 18, 100, 52369 }, // ѵ
-    { 26, 38, 27, 1, 31, 247, 52469 }, // Ҋ
-    { 21, 31, 23, 1, 25, 163, 52716 }, // ҋ
-    { 20, 24, 21, 0, 23, 120, 52879 }, // Ҍ
-    { 17, 25, 17, 0, 24, 107, 52999 }, // ҍ
-    { 18, 24, 20, 1, 24, 108, 53106 }, // Ҏ
-    { 19, 26, 20, 0, 18, 124, 53214 }, // ҏ
-    { 17, 28, 19, 1, 28, 119, 53338 }, // Ґ
-    { 14, 21, 16, 1, 21, 74, 53457 }, // ґ
-    { 18, 23, 19, 0, 23, 104, 53531 }, // Ғ
-    { 15, 17, 16, 1, 17, 64, 53635 }, // ғ
-    { 20, 30, 22, 1, 23, 150, 53699 }, // Ҕ
-    { 18, 25, 20, 1, 17, 113, 53849 }, // ҕ
-    { 33, 31, 33, 0, 24, 256, 53962 }, // Җ
-    { 27, 24, 27, 0, 18, 162, 54218 }, // җ
-    { 17, 31, 19, 1, 24, 132, 54380 }, // Ҙ
-    { 14, 25, 16, 1, 18, 88, 54512 }, // ҙ
-    { 23, 31, 24, 1, 24, 179, 54600 }, // Қ
-    { 19, 24, 19, 1, 18, 114, 54779 }, // қ
-    { 24, 25, 25, 1, 24, 150, 54893 }, // Ҝ
-    { 19, 19, 20, 1, 18, 91, 55043 }, // ҝ
-    { 23, 25, 24, 1, 24, 144, 55134 }, // Ҟ
-    { 19, 25, 19, 0, 24, 119, 55278 }, // ҟ
-    { 27, 25, 28, 1, 24, 169, 55397 }, // Ҡ
-    { 21, 19, 22, 1, 18, 100, 55566 }, // ҡ
-    { 26, 30, 28, 1, 23, 195, 55666 }, // Ң
-    { 22, 23, 23, 1, 17, 127, 55861 }, // ң
-    { 30, 23, 32, 1, 23, 173, 55988 }, // Ҥ
-    { 24, 17, 26, 1, 17, 102, 56161 }, // ҥ
-    { 33, 30, 35, 1, 23, 248, 56263 }, // Ҧ
-    { 30, 25, 32, 1, 17, 188, 56511 }, // ҧ
-    { 26, 25, 27, 1, 24, 163, 56699 }, // Ҩ
-    { 20, 19, 21, 1, 18, 95, 56862 }, // ҩ
-    { 19, 31, 21, 1, 24, 148, 56957 }, // Ҫ
-    { 15, 25, 17, 1, 18, 94, 57105 }, // ҫ
-    { 21, 30, 23, 1, 23, 158, 57199 }, // Ҭ
-    { 17, 23, 18, 1, 17, 98, 57357 }, // ҭ
-    { 23, 23, 23, 0, 23, 133, 57455 }, // Ү
-    { 20, 25, 20, 0, 17, 125, 57588 }, // ү
-    { 23, 23, 23, 0, 23, 133, 57713 }, // Ұ
-    { 20, 25, 20, 0, 17, 125, 57846 }, // ұ
-    { 24, 30, 24, 0, 23, 180, 57971 }, // Ҳ
-    { 20, 23, 20, 0, 17, 115, 58151 }, // ҳ
-    { 29, 30, 30, 1, 23, 218, 58266 }, // Ҵ
-    { 25, 23, 26, 1, 17, 144, 58484 }, // ҵ
-    { 23, 30, 24, 0, 23, 173, 58628 }, // Ҷ
-    { 20, 23, 20, 0, 17, 115, 58801 }, // ҷ
-    { 23, 23, 24, 0, 23, 133, 58916 }, // Ҹ
-    { 19, 17, 20, 0, 17, 81, 59049 }, // ҹ
-    { 22, 23, 24, 1, 23, 127, 59130 }, // Һ
-    { 22, 26, 22, 0, 26, 143, 59257 }, // һ
-    { 26, 25, 27, 0, 24, 163, 59400 }, // Ҽ
-    { 20, 19, 21, 0, 18, 95, 59563 }, // ҽ
-    { 26, 31, 27, 0, 24, 202, 59658 }, // Ҿ
-    { 20, 25, 21, 0, 18, 125, 59860 }, // ҿ
-    { 11, 23, 12, 1, 23, 64, 59985 }, // Ӏ
-    { 33, 32, 33, 0, 31, 264, 60049 }, // Ӂ
-    { 27, 26, 27, 0, 25, 176, 60313 }, // ӂ
-    { 21, 31, 23, 1, 24, 163, 60489 }, // Ӄ
-    { 17, 26, 20, 1, 18, 111, 60652 }, // ӄ
-    { 24, 30, 24, 0, 23, 180, 60763 }, // Ӆ
-    { 20, 23, 20, 0, 17, 115, 60943 }, // ӆ
-    { 26, 30, 27, 1, 23, 195, 61058 }, // Ӈ
-    { 21, 25, 23, 1, 17, 132, 61253 }, // ӈ
-    { 26, 30, 28, 1, 23, 195, 61385 }, // Ӊ
-    { 21, 23, 23, 1, 17, 121, 61580 }, // ӊ
-    { 23, 30, 24, 0, 23, 173, 61701 }, // Ӌ
-    { 19, 23, 20, 0, 17, 110, 61874 }, // ӌ
-    { 30, 30, 30, 0, 23, 225, 61984 }, // Ӎ
-    { 24, 23, 26, 1, 17, 138, 62209 }, // ӎ
-    { 11, 26, 11, 0, 26, 72, 62347 }, // ӏ
-    { 25, 31, 24, 0, 31, 194, 62419 }, // Ӑ
-    { 18, 26, 18, 1, 25, 117, 62613 }, // ӑ
-    { 25, 31, 24, 0, 31, 194, 62730 }, // Ӓ
-    { 18, 26, 18, 1, 25, 117, 62924 }, // ӓ
-    { 31, 23, 31, -1, 23, 179, 63041 }, // Ӕ
-    { 25, 19, 27, 1, 18, 119, 63220 }, // ӕ
-    { 19, 31, 21, 1, 31, 148, 63339 }, // Ӗ
-    { 15, 26, 17, 1, 25, 98, 63487 }, // ӗ
-    { 20, 25, 23, 1, 24, 125, 63585 }, // Ә
-    { 15, 19, 17, 1, 18, 72, 63710 }, // ә
-    { 20, 32, 23, 1, 31, 160, 63782 }, // Ӛ
-    { 15, 26, 17, 1, 25, 98, 63942 }, // ӛ
-    { 33, 32, 33, 0, 31, 264, 64040 }, // Ӝ
-    { 27, 26, 27, 0, 25, 176, 64304 }, // ӝ
-    { 17, 32, 19, 1, 31, 136, 64480 }, // Ӟ
-    { 14, 26, 16, 1, 25, 91, 64616 }, // ӟ
-    { 17, 24, 19, 1, 23, 102, 64707 }, // Ӡ
-    { 16, 25, 17, 0, 17, 100, 64809 }, // ӡ
-    { 26, 30, 27, 1, 30, 195, 64909 }, // Ӣ
-    { 21, 24, 23, 1, 24, 126, 65104 }, // ӣ
-    { 26, 31, 27, 1, 31, 202, 65230 }, // Ӥ
-    { 21, 25, 23, 1, 25, 132, 65432 }, // ӥ
-    { 24, 32, 26, 1, 31, 192, 65564 }, // Ӧ
-    { 18, 26, 20, 1, 25, 117, 65756 }, // ӧ
-    { 24, 25, 26, 1, 24, 150, 65873 }, // Ө
-    { 18, 19, 20, 1, 18, 86, 66023 }, // ө
-    { 24, 32, 27, 1, 31, 192, 66109 }, // Ӫ
-    { 18, 26, 20, 1, 25, 117, 66301 }, // ӫ
-    { 20, 32, 22, 1, 31, 160, 66418 }, // Ӭ
-    { 15, 26, 17, 1, 25, 98, 66578 }, // ӭ
-    { 24, 31, 24, 0, 30, 186, 66676 }, // Ӯ
-    { 20, 32, 20, 0, 24, 160, 66862 }, // ӯ
-    { 24, 32, 24, 0, 31, 192, 67022 }, // Ӱ
-    { 20, 33, 20, 0, 25, 165, 67214 }, // ӱ
-    { 24, 34, 24, 0, 33, 204, 67379 }, // Ӳ
-    { 20, 35, 20, 0, 27, 175, 67583 }, // ӳ
-    { 23, 31, 24, 0, 31, 179, 67758 }, // Ӵ
-    { 19, 25, 21, 0, 25, 119, 67937 }, // ӵ
-    { 17, 30, 19, 1, 23, 128, 68056 }, // Ӷ
-    { 15, 23, 16, 1, 17, 87, 68184 }, // ӷ
-    { 29, 32, 32, 1, 31, 232, 68271 }, // Ӹ
-    { 25, 26, 27, 1, 25, 163, 68503 }, // ӹ
-    { 18, 30, 19, 0, 23, 135, 68666 }, // Ӻ
-    { 15, 24, 16, 1, 17, 90, 68801 }, // ӻ
-    { 24, 30, 23, 0, 23, 180, 68891 }, // Ӽ
-    { 20, 25, 19, 0, 17, 125, 69071 }, // ӽ
-    { 24, 23, 24, 0, 23, 138, 69196 }, // Ӿ
-    { 20, 17, 20, 0, 17, 85, 69334 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 69419 }, //  
-    { 0, 0, 33, 0, 0, 0, 69419 }, //  
-    { 0, 0, 17, 0, 0, 0, 69419 }, //  
-    { 0, 0, 33, 0, 0, 0, 69419 }, //  
-    { 0, 0, 11, 0, 0, 0, 69419 }, //  
-    { 0, 0, 8, 0, 0, 0, 69419 }, //  
-    { 0, 0, 5, 0, 0, 0, 69419 }, //  
-    { 0, 0, 21, 0, 0, 0, 69419 }, //  
-    { 0, 0, 9, 0, 0, 0, 69419 }, //  
-    { 0, 0, 7, 0, 0, 0, 69419 }, //  
-    { 0, 0, 2, 0, 0, 0, 69419 }, //  
-    { 0, 0, 0, 0, 0, 0, 69419 }, // ​
-    { 2, 28, 0, -1, 20, 14, 69419 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 69433 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 69493 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 69586 }, // ‏
-    { 11, 3, 12, 1, 10, 9, 69679 }, // ‐
-    { 11, 3, 12, 1, 10, 9, 69688 }, // ‑
-    { 16, 3, 21, 2, 13, 12, 69697 }, // ‒
-    { 17, 3, 17, 0, 10, 13, 69709 }, // –
-    { 33, 3, 33, 0, 10, 25, 69722 }, // —
-    { 33, 3, 33, 0, 10, 25, 69747 }, // ―
-    { 11, 34, 17, 3, 26, 94, 69772 }, // ‖
-    { 17, 8, 17, 0, -1, 34, 69866 }, // ‗
-    { 6, 11, 8, 1, 25, 17, 69900 }, // ‘
-    { 6, 11, 8, 1, 25, 17, 69917 }, // ’
-    { 6, 10, 8, 1, 4, 15, 69934 }, // ‚
-    { 6, 11, 8, 1, 25, 17, 69949 }, // ‛
-    { 13, 11, 14, 1, 25, 36, 69966 }, // “
-    { 12, 11, 14, 1, 25, 33, 70002 }, // ”
-    { 12, 10, 14, 1, 4, 30, 70035 }, // „
-    { 13, 11, 14, 1, 25, 36, 70065 }, // ‟
-    { 15, 22, 17, 1, 24, 83, 70101 }, // †
-    { 15, 26, 17, 1, 24, 98, 70184 }, // ‡
-    { 8, 7, 10, 1, 12, 14, 70282 }, // •
-    { 12, 12, 21, 4, 17, 36, 70296 }, // ‣
-    { 5, 5, 9, 2, 4, 7, 70332 }, // ․
-    { 14, 5, 17, 1, 4, 18, 70339 }, // ‥
-    { 27, 5, 33, 3, 4, 34, 70357 }, // …
-    { 5, 6, 9, 2, 12, 8, 70391 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 70399 }, //  
-    { 0, 0, 0, 0, 0, 0, 70399 }, //  
-    { 12, 31, 0, -6, 23, 93, 70399 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 70492 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 70585 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 70663 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 70772 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 70881 }, //  
-    { 43, 26, 45, 1, 24, 280, 70881 }, // ‰
-    { 7, 11, 9, 1, 23, 20, 71161 }, // ′
-    { 13, 11, 15, 1, 23, 36, 71181 }, // ″
-    { 20, 11, 22, 1, 23, 55, 71217 }, // ‴
-    { 7, 11, 9, 1, 23, 20, 71272 }, // ‵
-    { 14, 11, 16, 1, 23, 39, 71292 }, // ‶
-    { 21, 11, 23, 1, 23, 58, 71331 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 71389 }, // ‸
-    { 8, 13, 11, 1, 15, 26, 71414 }, // ‹
-    { 9, 13, 11, 1, 15, 30, 71440 }, // ›
-    { 21, 23, 21, 0, 22, 121, 71470 }, // ※
-    { 15, 26, 18, 2, 25, 98, 71591 }, // ‼
-    { 17, 3, 17, 0, 27, 13, 71689 }, // ‾
-    { 8, 3, 10, 1, 10, 6, 71702 }, // ⁃
-    { 16, 27, 6, -5, 24, 108, 71708 }, // ⁄
-    { 26, 25, 29, 2, 24, 163, 71816 }, // ⁇
-    { 21, 26, 25, 2, 25, 137, 71979 }, // ⁈
-    { 21, 26, 25, 2, 25, 137, 72116 }, // ⁉
-    { 19, 6, 33, 7, 13, 29, 72253 }, // ⁓
-    { 26, 11, 28, 1, 23, 72, 72282 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 72354 }, //  
-    { 0, 0, 0, 0, 0, 0, 72354 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 72354 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 72354 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 72354 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 72354 }, // ⁤
-    { 13, 17, 15, 1, 28, 56, 72354 }, // ⁰
-    { 13, 17, 15, 1, 28, 56, 72410 }, // ⁴
-    { 10, 16, 15, 2, 27, 40, 72466 }, // ⁵
-    { 12, 17, 15, 2, 28, 51, 72506 }, // ⁶
-    { 12, 16, 15, 2, 27, 48, 72557 }, // ⁷
-    { 11, 17, 15, 2, 28, 47, 72605 }, // ⁸
-    { 11, 17, 15, 2, 28, 47, 72652 }, // ⁹
-    { 15, 11, 19, 2, 23, 42, 72699 }, // ⁿ
-    { 13, 16, 15, 1, 11, 52, 72741 }, // ₀
-    { 10, 16, 15, 2, 11, 40, 72793 }, // ₁
-    { 12, 16, 15, 2, 11, 48, 72833 }, // ₂
-    { 11, 16, 15, 2, 11, 44, 72881 }, // ₃
-    { 13, 16, 15, 1, 11, 52, 72925 }, // ₄
-    { 10, 16, 15, 2, 11, 40, 72977 }, // ₅
-    { 12, 16, 15, 2, 11, 48, 73017 }, // ₆
-    { 12, 16, 15, 2, 11, 48, 73065 }, // ₇
-    { 11, 16, 15, 2, 11, 44, 73113 }, // ₈
-    { 11, 16, 15, 2, 11, 44, 73157 }, // ₉
-    { 18, 23, 21, 1, 23, 104, 73201 }, // ₣
-    { 19, 24, 21, 1, 23, 114, 73305 }, // ₤
-    { 39, 24, 41, 1, 23, 234, 73419 }, // ₧
-    { 20, 24, 21, 0, 23, 120, 73653 }, // €
-    { 19, 13, 33, 7, 18, 62, 73773 }, // ←
-    { 13, 21, 33, 10, 22, 69, 73835 }, // ↑
-    { 19, 13, 33, 7, 18, 62, 73904 }, // →
-    { 13, 21, 33, 10, 22, 69, 73966 }, // ↓
-    { 21, 13, 33, 6, 18, 69, 74035 }, // ↔
-    { 13, 23, 33, 10, 23, 75, 74104 }, // ↕
-    { 15, 22, 33, 9, 22, 83, 74179 }, // ↨
-    { 13, 21, 33, 10, 22, 69, 74262 }, // ↲
-    { 13, 21, 33, 10, 22, 69, 74331 }, // ↳
-    { 19, 15, 33, 7, 19, 72, 74400 }, // ↵
-    { 19, 15, 33, 7, 19, 72, 74472 }, // ⇐
-    { 15, 19, 33, 9, 21, 72, 74544 }, // ⇑
-    { 19, 15, 33, 7, 19, 72, 74616 }, // ⇒
-    { 15, 19, 33, 9, 21, 72, 74688 }, // ⇓
-    { 21, 15, 33, 6, 19, 79, 74760 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 74839 }, // ∀
-    { 17, 27, 21, 2, 26, 115, 74977 }, // ∂
-    { 15, 23, 33, 9, 23, 87, 75092 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 75179 }, // ∅
-    { 20, 24, 22, 1, 24, 120, 75348 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 75468 }, // ∇
-    { 21, 23, 33, 6, 23, 121, 75594 }, // ∈
-    { 21, 29, 33, 6, 26, 153, 75715 }, // ∉
-    { 21, 19, 33, 6, 21, 100, 75868 }, // ∊
-    { 21, 23, 33, 6, 23, 121, 75968 }, // ∋
-    { 21, 29, 33, 6, 26, 153, 76089 }, // ∌
-    { 21, 19, 33, 6, 21, 100, 76242 }, // ∍
-    { 25, 29, 27, 1, 23, 182, 76342 }, // ∏
-    { 20, 29, 20, 0, 23, 145, 76524 }, // ∑
-    { 15, 3, 21, 3, 13, 12, 76669 }, // −
-    { 14, 26, 16, 1, 24, 91, 76681 }, // ∕
-    { 15, 26, 17, 2, 24, 98, 76772 }, // ∖
-    { 15, 16, 21, 3, 19, 60, 76870 }, // ∗
-    { 12, 12, 21, 4, 17, 36, 76930 }, // ∘
-    { 6, 6, 21, 7, 12, 9, 76966 }, // ∙
-    { 21, 31, 21, 0, 27, 163, 76975 }, // √
-    { 16, 13, 21, 2, 17, 52, 77138 }, // ∝
-    { 21, 11, 21, 0, 16, 58, 77190 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 77248 }, // ∟
-    { 23, 23, 33, 4, 23, 133, 77369 }, // ∠
-    { 4, 34, 17, 6, 26, 34, 77502 }, // ∣
-    { 10, 34, 17, 3, 26, 85, 77536 }, // ∥
-    { 21, 23, 33, 6, 23, 121, 77621 }, // ∧
-    { 21, 23, 33, 6, 23, 121, 77742 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 77863 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 77977 }, // ∪
-    { 18, 34, 21, 1, 26, 153, 78091 }, // ∫
-    { 21, 19, 33, 6, 18, 100, 78244 }, // ∴
-    { 21, 19, 33, 6, 18, 100, 78344 }, // ∵
-    { 6, 18, 10, 2, 20, 27, 78444 }, // ∶
-    { 21, 19, 33, 6, 18, 100, 78471 }, // ∷
-    { 19, 6, 33, 7, 13, 29, 78571 }, // ∼
-    { 19, 18, 33, 7, 20, 86, 78600 }, // ≅
-    { 16, 12, 21, 2, 17, 48, 78686 }, // ≈
-    { 19, 11, 33, 7, 15, 53, 78734 }, // ≍
-    { 15, 15, 21, 3, 19, 57, 78787 }, // ≠
-    { 19, 15, 33, 7, 17, 72, 78844 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 78916 }, // ≤
-    { 15, 20, 21, 3, 20, 75, 78991 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 79066 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 79174 }, // ≫
-    { 21, 19, 33, 6, 21, 100, 79282 }, // ⊃
-    { 21, 29, 33, 6, 26, 153, 79382 }, // ⊄
-    { 21, 29, 33, 6, 26, 153, 79535 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 79688 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 79809 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 79930 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 80087 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 80244 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 80401 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 80558 }, // ⊥
-    { 6, 6, 21, 7, 12, 9, 80668 }, // ⋅
-    { 27, 6, 33, 3, 12, 41, 80677 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 80718 }, // �
+    { 16, 24, 21, 2, 23, 96, 2048 }, // 9
+    { 5, 18, 9, 2, 17, 23, 2144 }, // :
+    { 8, 24, 9, 0, 17, 48, 2167 }, // ;
+    { 15, 16, 21, 3, 19, 60, 2215 }, // <
+    { 15, 9, 21, 3, 16, 34, 2275 }, // =
+    { 15, 16, 21, 3, 19, 60, 2309 }, // >
+    { 12, 25, 16, 2, 24, 75, 2369 }, // ?
+    { 29, 30, 32, 1, 23, 218, 2444 }, // @
+    { 25, 24, 24, 0, 24, 150, 2662 }, // A
+    { 19, 25, 20, 1, 24, 119, 2812 }, // B
+    { 19, 25, 21, 1, 24, 119, 2931 }, // C
+    { 23, 25, 25, 1, 24, 144, 3050 }, // D
+    { 19, 23, 21, 1, 23, 110, 3194 }, // E
+    { 17, 23, 19, 1, 23, 98, 3304 }, // F
+    { 22, 25, 24, 1, 24, 138, 3402 }, // G
+    { 26, 23, 28, 1, 23, 150, 3540 }, // H
+    { 11, 23, 12, 1, 23, 64, 3690 }, // I
+    { 14, 30, 12, -2, 23, 105, 3754 }, // J
+    { 23, 24, 24, 1, 23, 138, 3859 }, // K
+    { 19, 23, 20, 1, 23, 110, 4096 }, // L
+    { 30, 23, 30, 0, 23, 173, 4206 }, // M
+    { 26, 24, 27, 1, 23, 156, 4379 }, // N
+    { 24, 25, 26, 1, 24, 150, 4535 }, // O
+    { 18, 24, 20, 1, 24, 108, 4685 }, // P
+    { 26, 31, 26, 1, 24, 202, 4793 }, // Q
+    { 22, 25, 22, 1, 24, 138, 4995 }, // R
+    { 16, 25, 18, 1, 24, 100, 5133 }, // S
+    { 21, 23, 23, 1, 23, 121, 5233 }, // T
+    { 25, 24, 26, 0, 23, 150, 5354 }, // U
+    { 24, 24, 24, 0, 23, 144, 5504 }, // V
+    { 36, 24, 37, 0, 23, 216, 5648 }, // W
+    { 24, 23, 24, 0, 23, 138, 5864 }, // X
+    { 23, 23, 23, 0, 23, 133, 6002 }, // Y
+    { 18, 24, 20, 1, 23, 108, 6144 }, // Z
+    { 7, 32, 10, 2, 26, 56, 6252 }, // [
+    { 14, 26, 16, 1, 24, 91, 6308 }, // <backslash>
+    { 7, 32, 10, 1, 26, 56, 6399 }, // ]
+    { 16, 15, 21, 2, 21, 60, 6455 }, // ^
+    { 17, 3, 17, 0, -1, 13, 6515 }, // _
+    { 8, 9, 22, 7, 28, 18, 6528 }, // `
+    { 18, 19, 18, 1, 18, 86, 6546 }, // a
+    { 20, 27, 20, -1, 26, 135, 6632 }, // b
+    { 15, 19, 17, 1, 18, 72, 6767 }, // c
+    { 20, 27, 21, 1, 26, 135, 6839 }, // d
+    { 15, 19, 17, 1, 18, 72, 6974 }, // e
+    { 16, 26, 13, 0, 26, 104, 7046 }, // f
+    { 19, 26, 19, 0, 18, 124, 7150 }, // g
+    { 22, 26, 22, 0, 26, 143, 7274 }, // h
+    { 11, 26, 11, 0, 26, 72, 7417 }, // i
+    { 10, 34, 9, -2, 26, 85, 7489 }, // j
+    { 20, 27, 20, 0, 26, 135, 7574 }, // k
+    { 11, 26, 11, 0, 26, 72, 7709 }, // l
+    { 33, 18, 33, 0, 18, 149, 7781 }, // m
+    { 22, 18, 22, 0, 18, 99, 7930 }, // n
+    { 18, 19, 20, 1, 18, 86, 8029 }, // o
+    { 19, 26, 20, 0, 18, 124, 8192 }, // p
+    { 19, 26, 20, 1, 18, 124, 8316 }, // q
+    { 15, 18, 15, 0, 18, 68, 8440 }, // r
+    { 14, 19, 16, 1, 18, 67, 8508 }, // s
+    { 13, 23, 14, 0, 22, 75, 8575 }, // t
+    { 22, 19, 21, 0, 18, 105, 8650 }, // u
+    { 20, 18, 20, 0, 17, 90, 8755 }, // v
+    { 29, 18, 29, 0, 17, 131, 8845 }, // w
+    { 20, 17, 20, 0, 17, 85, 8976 }, // x
+    { 20, 25, 20, 0, 17, 125, 9061 }, // y
+    { 15, 18, 17, 1, 17, 68, 9186 }, // z
+    { 10, 33, 13, 2, 27, 83, 9254 }, // {
+    { 3, 30, 9, 3, 26, 23, 9337 }, // |
+    { 11, 33, 13, 0, 27, 91, 9360 }, // }
+    { 16, 6, 21, 2, 14, 24, 9451 }, // ~
+    { 0, 0, 7, 0, 0, 0, 9475 }, //  
+    { 6, 26, 9, 1, 18, 39, 9475 }, // ¡
+    { 16, 33, 21, 2, 26, 132, 9514 }, // ¢
+    { 19, 24, 21, 1, 23, 114, 9646 }, // £
+    { 19, 16, 21, 1, 19, 76, 9760 }, // ¤
+    { 22, 23, 21, -1, 23, 127, 9836 }, // ¥
+    { 3, 30, 9, 3, 26, 23, 9963 }, // ¦
+    { 15, 26, 17, 1, 23, 98, 9986 }, // §
+    { 12, 5, 22, 5, 25, 15, 10084 }, // ¨
+    { 25, 25, 26, 0, 24, 157, 10240 }, // ©
+    { 11, 16, 15, 2, 24, 44, 10397 }, // ª
+    { 17, 13, 17, 1, 15, 56, 10441 }, // «
+    { 15, 8, 21, 3, 15, 30, 10497 }, // ¬
+    { 11, 3, 12, 1, 10, 9, 10527 }, // ­
+    { 19, 18, 19, 0, 26, 86, 10536 }, // ®
+    { 12, 4, 22, 5, 24, 12, 10622 }, // ¯
+    { 12, 11, 17, 3, 23, 33, 10634 }, // °
+    { 15, 20, 21, 3, 20, 75, 10667 }, // ±
+    { 12, 16, 15, 2, 28, 48, 10742 }, // ²
+    { 11, 17, 15, 2, 28, 47, 10790 }, // ³
+    { 7, 8, 22, 8, 27, 14, 10837 }, // ´
+    { 21, 26, 22, 2, 18, 137, 10851 }, // µ
+    { 17, 28, 18, 0, 23, 119, 10988 }, // ¶
+    { 5, 6, 9, 2, 12, 8, 11107 }, // ·
+    { 6, 8, 22, 8, -1, 12, 11115 }, // ¸
+    { 10, 16, 15, 2, 28, 40, 11127 }, // ¹
+    { 12, 16, 15, 2, 24, 48, 11167 }, // º
+    { 17, 13, 17, 1, 15, 56, 11215 }, // »
+    { 32, 27, 36, 2, 24, 216, 11271 }, // ¼
+    { 32, 27, 36, 2, 24, 216, 11487 }, // ½
+    { 33, 27, 36, 2, 24, 223, 11703 }, // ¾
+    { 13, 25, 16, 1, 18, 82, 11926 }, // ¿
+    { 25, 32, 24, 0, 32, 200, 12008 }, // À
+    { 25, 32, 24, 0, 32, 200, 12288 }, // Á
+    { 25, 32, 24, 0, 32, 200, 12488 }, // Â
+    { 25, 31, 24, 0, 31, 194, 12688 }, // Ã
+    { 25, 31, 24, 0, 31, 194, 12882 }, // Ä
+    { 25, 33, 24, 0, 33, 207, 13076 }, // Å
+    { 31, 23, 31, -1, 23, 179, 13283 }, // Æ
+    { 19, 33, 21, 1, 24, 157, 13462 }, // Ç
+    { 19, 32, 21, 1, 32, 152, 13619 }, // È
+    { 19, 32, 21, 1, 32, 152, 13771 }, // É
+    { 19, 32, 21, 1, 32, 152, 13923 }, // Ê
+    { 19, 31, 21, 1, 31, 148, 14075 }, // Ë
+    { 11, 32, 12, 1, 32, 88, 14223 }, // Ì
+    { 11, 32, 12, 1, 32, 88, 14336 }, // Í
+    { 12, 32, 12, 0, 32, 96, 14424 }, // Î
+    { 12, 31, 12, 0, 31, 93, 14520 }, // Ï
+    { 24, 25, 25, 0, 24, 150, 14613 }, // Ð
+    { 26, 32, 27, 1, 31, 208, 14763 }, // Ñ
+    { 24, 33, 26, 1, 32, 198, 14971 }, // Ò
+    { 24, 33, 26, 1, 32, 198, 15169 }, // Ó
+    { 24, 33, 26, 1, 32, 198, 15367 }, // Ô
+    { 24, 32, 26, 1, 31, 192, 15565 }, // Õ
+    { 24, 32, 26, 1, 31, 192, 15757 }, // Ö
+    { 14, 14, 21, 3, 18, 49, 15949 }, // ×
+    { 25, 25, 26, 0, 24, 157, 15998 }, // Ø
+    { 25, 33, 26, 0, 32, 207, 16155 }, // Ù
+    { 25, 33, 26, 0, 32, 207, 16384 }, // Ú
+    { 25, 33, 26, 0, 32, 207, 16591 }, // Û
+    { 25, 32, 26, 0, 31, 200, 16798 }, // Ü
+    { 23, 32, 23, 0, 32, 184, 16998 }, // Ý
+    { 18, 23, 21, 1, 23, 104, 17182 }, // Þ
+    { 21, 27, 21, 0, 26, 142, 17286 }, // ß
+    { 18, 29, 18, 1, 28, 131, 17428 }, // à
+    { 18, 28, 18, 1, 27, 126, 17559 }, // á
+    { 18, 28, 18, 1, 27, 126, 17685 }, // â
+    { 18, 27, 18, 1, 26, 122, 17811 }, // ã
+    { 18, 26, 18, 1, 25, 117, 17933 }, // ä
+    { 18, 29, 18, 1, 28, 131, 18050 }, // å
+    { 25, 19, 27, 1, 18, 119, 18181 }, // æ
+    { 15, 27, 17, 1, 18, 102, 18300 }, // ç
+    { 15, 29, 17, 1, 28, 109, 18432 }, // è
+    { 15, 28, 17, 1, 27, 105, 18541 }, // é
+    { 15, 28, 17, 1, 27, 105, 18646 }, // ê
+    { 15, 26, 17, 1, 25, 98, 18751 }, // ë
+    { 11, 28, 11, 0, 28, 77, 18849 }, // ì
+    { 11, 27, 11, 0, 27, 75, 18926 }, // í
+    { 11, 27, 11, 0, 27, 75, 19001 }, // î
+    { 12, 25, 11, -1, 25, 75, 19076 }, // ï
+    { 18, 28, 20, 1, 27, 126, 19151 }, // ð
+    { 22, 26, 22, 0, 26, 143, 19277 }, // ñ
+    { 18, 29, 20, 1, 28, 131, 19420 }, // ò
+    { 18, 28, 20, 1, 27, 126, 19551 }, // ó
+    { 18, 28, 20, 1, 27, 126, 19677 }, // ô
+    { 18, 27, 20, 1, 26, 122, 19803 }, // õ
+    { 18, 26, 20, 1, 25, 117, 19925 }, // ö
+    { 15, 16, 21, 3, 19, 60, 20042 }, // ÷
+    { 19, 19, 20, 0, 18, 91, 20102 }, // ø
+    { 22, 29, 21, 0, 28, 160, 20193 }, // ù
+    { 22, 28, 21, 0, 27, 154, 20480 }, // ú
+    { 22, 28, 21, 0, 27, 154, 20634 }, // û
+    { 22, 26, 21, 0, 25, 143, 20788 }, // ü
+    { 20, 35, 20, 0, 27, 175, 20931 }, // ý
+    { 20, 34, 21, 0, 26, 170, 21106 }, // þ
+    { 20, 33, 20, 0, 25, 165, 21276 }, // ÿ
+    { 25, 30, 24, 0, 30, 188, 21441 }, // Ā
+    { 18, 25, 18, 1, 24, 113, 21629 }, // ā
+    { 25, 32, 24, 0, 32, 200, 21742 }, // Ă
+    { 18, 27, 18, 1, 26, 122, 21942 }, // ă
+    { 25, 31, 24, 0, 24, 194, 22064 }, // Ą
+    { 18, 25, 18, 1, 18, 113, 22258 }, // ą
+    { 19, 33, 21, 1, 32, 157, 22371 }, // Ć
+    { 15, 28, 17, 1, 27, 105, 22528 }, // ć
+    { 19, 33, 21, 1, 32, 157, 22633 }, // Ĉ
+    { 15, 28, 17, 1, 27, 105, 22790 }, // ĉ
+    { 19, 32, 21, 1, 31, 152, 22895 }, // Ċ
+    { 15, 26, 17, 1, 25, 98, 23047 }, // ċ
+    { 19, 33, 21, 1, 32, 157, 23145 }, // Č
+    { 15, 28, 17, 1, 27, 105, 23302 }, // č
+    { 23, 33, 25, 1, 32, 190, 23407 }, // Ď
+    { 23, 27, 21, 1, 26, 156, 23597 }, // ď
+    { 24, 25, 25, 0, 24, 150, 23753 }, // Đ
+    { 20, 27, 21, 1, 26, 135, 23903 }, // đ
+    { 19, 30, 21, 1, 30, 143, 24038 }, // Ē
+    { 15, 25, 17, 1, 24, 94, 24181 }, // ē
+    { 19, 32, 21, 1, 32, 152, 24275 }, // Ĕ
+    { 15, 27, 17, 1, 26, 102, 24427 }, // ĕ
+    { 19, 31, 21, 1, 31, 148, 24576 }, // Ė
+    { 15, 26, 17, 1, 25, 98, 24724 }, // ė
+    { 19, 30, 21, 1, 23, 143, 24822 }, // Ę
+    { 15, 25, 17, 1, 18, 94, 24965 }, // ę
+    { 19, 32, 21, 1, 32, 152, 25059 }, // Ě
+    { 15, 28, 17, 1, 27, 105, 25211 }, // ě
+    { 22, 33, 24, 1, 32, 182, 25316 }, // Ĝ
+    { 19, 35, 19, 0, 27, 167, 25498 }, // ĝ
+    { 22, 33, 24, 1, 32, 182, 25665 }, // Ğ
+    { 19, 34, 19, 0, 26, 162, 25847 }, // ğ
+    { 22, 32, 24, 1, 31, 176, 26009 }, // Ġ
+    { 19, 33, 19, 0, 25, 157, 26185 }, // ġ
+    { 22, 33, 24, 1, 24, 182, 26342 }, // Ģ
+    { 19, 36, 19, 0, 28, 171, 26624 }, // ģ
+    { 26, 32, 28, 1, 32, 208, 26795 }, // Ĥ
+    { 23, 34, 22, -1, 34, 196, 27003 }, // ĥ
+    { 27, 23, 28, 0, 23, 156, 27199 }, // Ħ
+    { 22, 26, 22, 0, 26, 143, 27355 }, // ħ
+    { 12, 31, 12, 0, 31, 93, 27498 }, // Ĩ
+    { 11, 26, 11, 0, 26, 72, 27591 }, // ĩ
+    { 12, 30, 12, 0, 30, 90, 27663 }, // Ī
+    { 11, 24, 11, 0, 24, 66, 27753 }, // ī
+    { 12, 32, 12, 0, 32, 96, 27819 }, // Ĭ
+    { 11, 26, 11, 0, 26, 72, 27915 }, // ĭ
+    { 11, 30, 12, 1, 23, 83, 27987 }, // Į
+    { 11, 33, 11, 0, 26, 91, 28070 }, // į
+    { 11, 31, 12, 1, 31, 86, 28161 }, // İ
+    { 11, 18, 11, 0, 18, 50, 28247 }, // ı
+    { 22, 30, 24, 1, 23, 165, 28297 }, // Ĳ
+    { 18, 34, 20, 0, 26, 153, 28462 }, // ĳ
+    { 14, 39, 12, -2, 32, 137, 28672 }, // Ĵ
+    { 13, 35, 9, -2, 27, 114, 28809 }, // ĵ
+    { 23, 32, 24, 1, 23, 184, 28923 }, // Ķ
+    { 20, 35, 20, 0, 26, 175, 29107 }, // ķ
+    { 21, 19, 20, 0, 18, 100, 29282 }, // ĸ
+    { 19, 32, 20, 1, 32, 152, 29382 }, // Ĺ
+    { 11, 34, 11, 0, 34, 94, 29534 }, // ĺ
+    { 19, 32, 20, 1, 23, 152, 29628 }, // Ļ
+    { 11, 35, 11, 0, 26, 97, 29780 }, // ļ
+    { 19, 26, 20, 1, 26, 124, 29877 }, // Ľ
+    { 14, 26, 11, 0, 26, 91, 30001 }, // ľ
+    { 19, 23, 20, 1, 23, 110, 30092 }, // Ŀ
+    { 16, 26, 15, 0, 26, 104, 30202 }, // ŀ
+    { 21, 23, 20, -1, 23, 121, 30306 }, // Ł
+    { 13, 26, 11, -1, 26, 85, 30427 }, // ł
+    { 26, 33, 27, 1, 32, 215, 30720 }, // Ń
+    { 22, 27, 22, 0, 27, 149, 30935 }, // ń
+    { 26, 32, 27, 1, 23, 208, 31084 }, // Ņ
+    { 22, 27, 22, 0, 18, 149, 31292 }, // ņ
+    { 26, 33, 27, 1, 32, 215, 31441 }, // Ň
+    { 22, 27, 22, 0, 27, 149, 31656 }, // ň
+    { 29, 25, 30, 1, 25, 182, 31805 }, // ŉ
+    { 26, 30, 27, 1, 23, 195, 31987 }, // Ŋ
+    { 19, 26, 21, 0, 18, 124, 32182 }, // ŋ
+    { 24, 31, 26, 1, 30, 186, 32306 }, // Ō
+    { 18, 25, 20, 1, 24, 113, 32492 }, // ō
+    { 24, 33, 26, 1, 32, 198, 32768 }, // Ŏ
+    { 18, 27, 20, 1, 26, 122, 32966 }, // ŏ
+    { 24, 34, 26, 1, 33, 204, 33088 }, // Ő
+    { 18, 28, 20, 1, 27, 126, 33292 }, // ő
+    { 30, 24, 32, 1, 23, 180, 33418 }, // Œ
+    { 28, 19, 30, 1, 18, 133, 33598 }, // œ
+    { 22, 33, 22, 1, 32, 182, 33731 }, // Ŕ
+    { 15, 27, 15, 0, 27, 102, 33913 }, // ŕ
+    { 22, 33, 22, 1, 24, 182, 34015 }, // Ŗ
+    { 15, 27, 15, 0, 18, 102, 34197 }, // ŗ
+    { 22, 33, 22, 1, 32, 182, 34299 }, // Ř
+    { 15, 27, 15, 0, 27, 102, 34481 }, // ř
+    { 16, 33, 18, 1, 32, 132, 34583 }, // Ś
+    { 14, 28, 16, 1, 27, 98, 34715 }, // ś
+    { 16, 33, 18, 1, 32, 132, 34816 }, // Ŝ
+    { 14, 28, 16, 1, 27, 98, 34948 }, // ŝ
+    { 16, 33, 18, 1, 24, 132, 35046 }, // Ş
+    { 14, 27, 16, 1, 18, 95, 35178 }, // ş
+    { 16, 33, 18, 1, 32, 132, 35273 }, // Š
+    { 14, 28, 16, 1, 27, 98, 35405 }, // š
+    { 21, 32, 23, 1, 23, 168, 35503 }, // Ţ
+    { 13, 31, 14, 0, 22, 101, 35671 }, // ţ
+    { 21, 32, 23, 1, 32, 168, 35772 }, // Ť
+    { 13, 28, 14, 0, 27, 91, 35940 }, // ť
+    { 21, 23, 23, 1, 23, 121, 36031 }, // Ŧ
+    { 13, 23, 14, 0, 22, 75, 36152 }, // ŧ
+    { 25, 32, 26, 0, 31, 200, 36227 }, // Ũ
+    { 22, 27, 21, 0, 26, 149, 36427 }, // ũ
+    { 25, 31, 26, 0, 30, 194, 36576 }, // Ū
+    { 22, 25, 21, 0, 24, 138, 36864 }, // ū
+    { 25, 33, 26, 0, 32, 207, 37002 }, // Ŭ
+    { 22, 27, 21, 0, 26, 149, 37209 }, // ŭ
+    { 25, 34, 26, 0, 33, 213, 37358 }, // Ů
+    { 22, 29, 21, 0, 28, 160, 37571 }, // ů
+    { 25, 34, 26, 0, 33, 213, 37731 }, // Ű
+    { 22, 28, 21, 0, 27, 154, 37944 }, // ű
+    { 25, 30, 26, 0, 23, 188, 38098 }, // Ų
+    { 22, 25, 21, 0, 18, 138, 38286 }, // ų
+    { 36, 33, 37, 0, 32, 297, 38424 }, // Ŵ
+    { 29, 28, 29, 0, 27, 203, 38912 }, // ŵ
+    { 23, 32, 23, 0, 32, 184, 39115 }, // Ŷ
+    { 20, 35, 20, 0, 27, 175, 39299 }, // ŷ
+    { 23, 31, 23, 0, 31, 179, 39474 }, // Ÿ
+    { 18, 33, 20, 1, 32, 149, 39653 }, // Ź
+    { 15, 28, 17, 1, 27, 105, 39802 }, // ź
+    { 18, 32, 20, 1, 31, 144, 39907 }, // Ż
+    { 15, 26, 17, 1, 25, 98, 40051 }, // ż
+    { 18, 33, 20, 1, 32, 149, 40149 }, // Ž
+    { 15, 28, 17, 1, 27, 105, 40298 }, // ž
+    { 16, 26, 13, 0, 26, 104, 40403 }, // ſ
+    { 7, 9, 0, -5, 28, 16, 40507 }, // ̀
+    { 7, 8, 0, -2, 27, 14, 40523 }, // ́
+    { 12, 8, 0, -6, 27, 24, 40537 }, // ̂
+    { 12, 6, 0, -6, 26, 18, 40561 }, // ̃
+    { 12, 4, 0, -6, 24, 12, 40579 }, // ̄
+    { 12, 6, 0, -6, 26, 18, 40591 }, // ̆
+    { 6, 5, 0, -3, 25, 8, 40609 }, // ̇
+    { 12, 5, 0, -6, 25, 15, 40617 }, // ̈
+    { 10, 10, 0, -5, 29, 25, 40632 }, // ̉
+    { 10, 10, 0, -5, 28, 25, 40657 }, // ̊
+    { 12, 8, 0, -5, 27, 24, 40682 }, // ̋
+    { 12, 8, 0, -6, 27, 24, 40706 }, // ̌
+    { 12, 8, 0, -7, 27, 24, 40730 }, // ̏
+    { 12, 6, 0, -6, 26, 18, 40754 }, // ̑
+    { 6, 9, 0, -3, 28, 14, 40772 }, // ̒
+    { 6, 10, 0, -2, 29, 15, 40786 }, // ̓
+    { 6, 10, 0, -4, 29, 15, 40801 }, // ̔
+    { 4, 9, 0, -2, 29, 9, 40816 }, // ̕
+    { 6, 8, 0, -3, 21, 12, 40825 }, // ̛
+    { 6, 6, 0, -3, -2, 9, 40837 }, // ̣
+    { 12, 5, 0, -6, -3, 15, 40846 }, // ̤
+    { 8, 8, 0, -4, -1, 16, 40861 }, // ̥
+    { 6, 8, 0, -3, -1, 12, 40877 }, // ̦
+    { 6, 8, 0, -3, -1, 12, 40889 }, // ̧
+    { 8, 8, 0, -4, 1, 16, 40901 }, // ̨
+    { 3, 8, 9, 3, -1, 6, 40917 }, // ̩
+    { 12, 7, 0, -6, -2, 21, 40923 }, // ̭
+    { 12, 6, 0, -6, -2, 18, 40960 }, // ̮
+    { 12, 6, 0, -6, -2, 18, 40978 }, // ̰
+    { 12, 4, 0, -6, -3, 12, 40996 }, // ̱
+    { 12, 6, 0, -6, 26, 18, 41008 }, // ͂
+    { 12, 13, 0, -6, 33, 39, 41026 }, // ̈́
+    { 6, 6, 0, -2, -2, 9, 41065 }, // ͅ
+    { 19, 32, 21, 1, 32, 152, 41074 }, // Ѐ
+    { 19, 31, 21, 1, 31, 148, 41226 }, // Ё
+    { 25, 30, 27, 1, 23, 188, 41374 }, // Ђ
+    { 17, 32, 19, 1, 32, 136, 41562 }, // Ѓ
+    { 20, 25, 22, 1, 24, 125, 41698 }, // Є
+    { 16, 25, 18, 1, 24, 100, 41823 }, // Ѕ
+    { 11, 23, 12, 1, 23, 64, 41923 }, // І
+    { 12, 31, 12, 0, 31, 93, 41987 }, // Ї
+    { 14, 30, 12, -2, 23, 105, 42080 }, // Ј
+    { 31, 24, 32, 0, 23, 186, 42185 }, // Љ
+    { 32, 24, 34, 1, 23, 192, 42371 }, // Њ
+    { 27, 23, 28, 1, 23, 156, 42563 }, // Ћ
+    { 23, 33, 24, 1, 32, 190, 42719 }, // Ќ
+    { 26, 32, 27, 1, 32, 208, 43008 }, // Ѝ
+    { 24, 32, 24, 0, 31, 192, 43216 }, // Ў
+    { 25, 31, 26, 1, 23, 194, 43408 }, // Џ
+    { 25, 24, 24, 0, 24, 150, 43602 }, // А
+    { 19, 24, 21, 1, 23, 114, 43752 }, // Б
+    { 19, 25, 20, 1, 24, 119, 43866 }, // В
+    { 17, 23, 19, 1, 23, 98, 43985 }, // Г
+    { 24, 30, 25, 0, 23, 180, 44083 }, // Д
+    { 19, 23, 21, 1, 23, 110, 44263 }, // Е
+    { 33, 25, 33, 0, 24, 207, 44373 }, // Ж
+    { 17, 25, 19, 1, 24, 107, 44580 }, // З
+    { 26, 23, 27, 1, 23, 150, 44687 }, // И
+    { 26, 31, 27, 1, 31, 202, 44837 }, // Й
+    { 23, 25, 24, 1, 24, 144, 45056 }, // К
+    { 24, 24, 24, 0, 23, 144, 45200 }, // Л
+    { 30, 23, 30, 0, 23, 173, 45344 }, // М
+    { 26, 23, 28, 1, 23, 150, 45517 }, // Н
+    { 24, 25, 26, 1, 24, 150, 45667 }, // О
+    { 25, 23, 27, 1, 23, 144, 45817 }, // П
+    { 18, 24, 20, 1, 24, 108, 45961 }, // Р
+    { 19, 25, 21, 1, 24, 119, 46069 }, // С
+    { 21, 23, 23, 1, 23, 121, 46188 }, // Т
+    { 24, 24, 24, 0, 23, 144, 46309 }, // У
+    { 24, 25, 26, 1, 24, 150, 46453 }, // Ф
+    { 24, 23, 24, 0, 23, 138, 46603 }, // Х
+    { 25, 30, 26, 1, 23, 188, 46741 }, // Ц
+    { 23, 23, 24, 0, 23, 133, 46929 }, // Ч
+    { 33, 23, 35, 1, 23, 190, 47104 }, // Ш
+    { 34, 30, 35, 1, 23, 255, 47294 }, // Щ
+    { 24, 24, 25, 1, 23, 144, 47549 }, // Ъ
+    { 29, 24, 31, 1, 23, 174, 47693 }, // Ы
+    { 19, 24, 21, 1, 23, 114, 47867 }, // Ь
+    { 20, 25, 22, 1, 24, 125, 47981 }, // Э
+    { 33, 25, 35, 1, 24, 207, 48106 }, // Ю
+    { 22, 24, 22, -1, 23, 132, 48313 }, // Я
+    { 18, 19, 18, 1, 18, 86, 48445 }, // а
+    { 17, 27, 19, 1, 26, 115, 48531 }, // б
+    { 16, 19, 18, 1, 18, 76, 48646 }, // в
+    { 15, 17, 16, 1, 17, 64, 48722 }, // г
+    { 21, 23, 21, 0, 17, 121, 48786 }, // д
+    { 15, 19, 17, 1, 18, 72, 48907 }, // е
+    { 27, 19, 27, 0, 18, 129, 48979 }, // ж
+    { 14, 19, 16, 1, 18, 67, 49152 }, // з
+    { 21, 17, 23, 1, 17, 90, 49219 }, // и
+    { 21, 25, 23, 1, 25, 132, 49309 }, // й
+    { 19, 19, 19, 1, 18, 91, 49441 }, // к
+    { 20, 18, 20, 0, 17, 90, 49532 }, // л
+    { 24, 17, 26, 1, 17, 102, 49622 }, // м
+    { 21, 17, 23, 1, 17, 90, 49724 }, // н
+    { 18, 19, 20, 1, 18, 86, 49814 }, // о
+    { 21, 17, 23, 1, 17, 90, 49900 }, // п
+    { 19, 26, 20, 0, 18, 124, 49990 }, // р
+    { 15, 19, 17, 1, 18, 72, 50114 }, // с
+    { 17, 17, 19, 1, 17, 73, 50186 }, // т
+    { 20, 25, 20, 0, 17, 125, 50259 }, // у
+    { 23, 34, 24, 1, 26, 196, 50384 }, // ф
+    { 20, 17, 20, 0, 17, 85, 50580 }, // х
+    { 21, 23, 23, 1, 17, 121, 50665 }, // ц
+    { 19, 17, 20, 0, 17, 81, 50786 }, // ч
+    { 27, 17, 29, 1, 17, 115, 50867 }, // ш
+    { 28, 23, 29, 1, 17, 161, 50982 }, // щ
+    { 19, 18, 21, 1, 17, 86, 51200 }, // ъ
+    { 25, 18, 27, 1, 17, 113, 51286 }, // ы
+    { 16, 18, 18, 1, 17, 72, 51399 }, // ь
+    { 15, 19, 17, 1, 18, 72, 51471 }, // э
+    { 26, 19, 28, 1, 18, 124, 51543 }, // ю
+    { 18, 18, 19, 0, 17, 81, 51667 }, // я
+    { 15, 29, 17, 1, 28, 109, 51748 }, // ѐ
+    { 15, 26, 17, 1, 25, 98, 51857 }, // ё
+    { 19, 34, 21, 0, 26, 162, 51955 }, // ђ
+    { 15, 27, 16, 1, 27, 102, 52117 }, // ѓ
+    { 15, 19, 17, 1, 18, 72, 52219 }, // є
+    { 14, 19, 16, 1, 18, 67, 52291 }, // ѕ
+    { 11, 26, 11, 0, 26, 72, 52358 }, // і
+    { 12, 25, 11, -1, 25, 75, 52430 }, // ї
+    { 10, 34, 9, -2, 26, 85, 52505 }, // ј
+    { 26, 18, 26, 0, 17, 117, 52590 }, // љ
+    { 26, 18, 28, 1, 17, 117, 52707 }, // њ
+    { 22, 26, 22, 0, 26, 143, 52824 }, // ћ
+    { 19, 28, 19, 1, 27, 133, 52967 }, // ќ
+    { 21, 28, 23, 1, 28, 147, 53100 }, // ѝ
+    { 20, 33, 20, 0, 25, 165, 53248 }, // ў
+    { 21, 24, 22, 1, 17, 126, 53413 }, // џ
+    { 23, 27, 24, 0, 26, 156, 53539 }, // Ѣ
+    { 19, 25, 20, 1, 24, 119, 53695 }, // ѣ
+    { 24, 25, 26, 1, 24, 150, 53814 }, // Ѳ
+    { 18, 19, 20, 1, 18, 86, 53964 }, // ѳ
+    { 25, 25, 25, 0, 24, 157, 54050 }, // Ѵ
+    { 21, 19, 20, 0, 18, 100, 54207 }, // ѵ
+    { 26, 38, 27, 1, 31, 247, 54307 }, // Ҋ
+    { 21, 31, 23, 1, 25, 163, 54554 }, // ҋ
+    { 20, 24, 21, 0, 23, 120, 54717 }, // Ҍ
+    { 17, 25, 17, 0, 24, 107, 54837 }, // ҍ
+    { 18, 24, 20, 1, 24, 108, 54944 }, // Ҏ
+    { 19, 26, 20, 0, 18, 124, 55052 }, // ҏ
+    { 17, 28, 19, 1, 28, 119, 55176 }, // Ґ
+    { 14, 21, 16, 1, 21, 74, 55296 }, // ґ
+    { 18, 23, 19, 0, 23, 104, 55370 }, // Ғ
+    { 15, 17, 16, 1, 17, 64, 55474 }, // ғ
+    { 20, 30, 22, 1, 23, 150, 55538 }, // Ҕ
+    { 18, 25, 20, 1, 17, 113, 55688 }, // ҕ
+    { 33, 31, 33, 0, 24, 256, 55801 }, // Җ
+    { 27, 24, 27, 0, 18, 162, 56057 }, // җ
+    { 17, 31, 19, 1, 24, 132, 56219 }, // Ҙ
+    { 14, 25, 16, 1, 18, 88, 56351 }, // ҙ
+    { 23, 31, 24, 1, 24, 179, 56439 }, // Қ
+    { 19, 24, 19, 1, 18, 114, 56618 }, // қ
+    { 24, 25, 25, 1, 24, 150, 56732 }, // Ҝ
+    { 19, 19, 20, 1, 18, 91, 56882 }, // ҝ
+    { 23, 25, 24, 1, 24, 144, 56973 }, // Ҟ
+    { 19, 25, 19, 0, 24, 119, 57117 }, // ҟ
+    { 27, 25, 28, 1, 24, 169, 57344 }, // Ҡ
+    { 21, 19, 22, 1, 18, 100, 57513 }, // ҡ
+    { 26, 30, 28, 1, 23, 195, 57613 }, // Ң
+    { 22, 23, 23, 1, 17, 127, 57808 }, // ң
+    { 30, 23, 32, 1, 23, 173, 57935 }, // Ҥ
+    { 24, 17, 26, 1, 17, 102, 58108 }, // ҥ
+    { 33, 30, 35, 1, 23, 248, 58210 }, // Ҧ
+    { 30, 25, 32, 1, 17, 188, 58458 }, // ҧ
+    { 26, 25, 27, 1, 24, 163, 58646 }, // Ҩ
+    { 20, 19, 21, 1, 18, 95, 58809 }, // ҩ
+    { 19, 31, 21, 1, 24, 148, 58904 }, // Ҫ
+    { 15, 25, 17, 1, 18, 94, 59052 }, // ҫ
+    { 21, 30, 23, 1, 23, 158, 59146 }, // Ҭ
+    { 17, 23, 18, 1, 17, 98, 59392 }, // ҭ
+    { 23, 23, 23, 0, 23, 133, 59490 }, // Ү
+    { 20, 25, 20, 0, 17, 125, 59623 }, // ү
+    { 23, 23, 23, 0, 23, 133, 59748 }, // Ұ
+    { 20, 25, 20, 0, 17, 125, 59881 }, // ұ
+    { 24, 30, 24, 0, 23, 180, 60006 }, // Ҳ
+    { 20, 23, 20, 0, 17, 115, 60186 }, // ҳ
+    { 29, 30, 30, 1, 23, 218, 60301 }, // Ҵ
+    { 25, 23, 26, 1, 17, 144, 60519 }, // ҵ
+    { 23, 30, 24, 0, 23, 173, 60663 }, // Ҷ
+    { 20, 23, 20, 0, 17, 115, 60836 }, // ҷ
+    { 23, 23, 24, 0, 23, 133, 60951 }, // Ҹ
+    { 19, 17, 20, 0, 17, 81, 61084 }, // ҹ
+    { 22, 23, 24, 1, 23, 127, 61165 }, // Һ
+    { 22, 26, 22, 0, 26, 143, 61292 }, // һ
+    { 26, 25, 27, 0, 24, 163, 61440 }, // Ҽ
+    { 20, 19, 21, 0, 18, 95, 61603 }, // ҽ
+    { 26, 31, 27, 0, 24, 202, 61698 }, // Ҿ
+    { 20, 25, 21, 0, 18, 125, 61900 }, // ҿ
+    { 11, 23, 12, 1, 23, 64, 62025 }, // Ӏ
+    { 33, 32, 33, 0, 31, 264, 62089 }, // Ӂ
+    { 27, 26, 27, 0, 25, 176, 62353 }, // ӂ
+    { 21, 31, 23, 1, 24, 163, 62529 }, // Ӄ
+    { 17, 26, 20, 1, 18, 111, 62692 }, // ӄ
+    { 24, 30, 24, 0, 23, 180, 62803 }, // Ӆ
+    { 20, 23, 20, 0, 17, 115, 62983 }, // ӆ
+    { 26, 30, 27, 1, 23, 195, 63098 }, // Ӈ
+    { 21, 25, 23, 1, 17, 132, 63293 }, // ӈ
+    { 26, 30, 28, 1, 23, 195, 63488 }, // Ӊ
+    { 21, 23, 23, 1, 17, 121, 63683 }, // ӊ
+    { 23, 30, 24, 0, 23, 173, 63804 }, // Ӌ
+    { 19, 23, 20, 0, 17, 110, 63977 }, // ӌ
+    { 30, 30, 30, 0, 23, 225, 64087 }, // Ӎ
+    { 24, 23, 26, 1, 17, 138, 64312 }, // ӎ
+    { 11, 26, 11, 0, 26, 72, 64450 }, // ӏ
+    { 25, 31, 24, 0, 31, 194, 64522 }, // Ӑ
+    { 18, 26, 18, 1, 25, 117, 64716 }, // ӑ
+    { 25, 31, 24, 0, 31, 194, 64833 }, // Ӓ
+    { 18, 26, 18, 1, 25, 117, 65027 }, // ӓ
+    { 31, 23, 31, -1, 23, 179, 65144 }, // Ӕ
+    { 25, 19, 27, 1, 18, 119, 65323 }, // ӕ
+    { 19, 31, 21, 1, 31, 148, 65536 }, // Ӗ
+    { 15, 26, 17, 1, 25, 98, 65684 }, // ӗ
+    { 20, 25, 23, 1, 24, 125, 65782 }, // Ә
+    { 15, 19, 17, 1, 18, 72, 65907 }, // ә
+    { 20, 32, 23, 1, 31, 160, 65979 }, // Ӛ
+    { 15, 26, 17, 1, 25, 98, 66139 }, // ӛ
+    { 33, 32, 33, 0, 31, 264, 66237 }, // Ӝ
+    { 27, 26, 27, 0, 25, 176, 66501 }, // ӝ
+    { 17, 32, 19, 1, 31, 136, 66677 }, // Ӟ
+    { 14, 26, 16, 1, 25, 91, 66813 }, // ӟ
+    { 17, 24, 19, 1, 23, 102, 66904 }, // Ӡ
+    { 16, 25, 17, 0, 17, 100, 67006 }, // ӡ
+    { 26, 30, 27, 1, 30, 195, 67106 }, // Ӣ
+    { 21, 24, 23, 1, 24, 126, 67301 }, // ӣ
+    { 26, 31, 27, 1, 31, 202, 67584 }, // Ӥ
+    { 21, 25, 23, 1, 25, 132, 67786 }, // ӥ
+    { 24, 32, 26, 1, 31, 192, 67918 }, // Ӧ
+    { 18, 26, 20, 1, 25, 117, 68110 }, // ӧ
+    { 24, 25, 26, 1, 24, 150, 68227 }, // Ө
+    { 18, 19, 20, 1, 18, 86, 68377 }, // ө
+    { 24, 32, 27, 1, 31, 192, 68463 }, // Ӫ
+    { 18, 26, 20, 1, 25, 117, 68655 }, // ӫ
+    { 20, 32, 22, 1, 31, 160, 68772 }, // Ӭ
+    { 15, 26, 17, 1, 25, 98, 68932 }, // ӭ
+    { 24, 31, 24, 0, 30, 186, 69030 }, // Ӯ
+    { 20, 32, 20, 0, 24, 160, 69216 }, // ӯ
+    { 24, 32, 24, 0, 31, 192, 69376 }, // Ӱ
+    { 20, 33, 20, 0, 25, 165, 69632 }, // ӱ
+    { 24, 34, 24, 0, 33, 204, 69797 }, // Ӳ
+    { 20, 35, 20, 0, 27, 175, 70001 }, // ӳ
+    { 23, 31, 24, 0, 31, 179, 70176 }, // Ӵ
+    { 19, 25, 21, 0, 25, 119, 70355 }, // ӵ
+    { 17, 30, 19, 1, 23, 128, 70474 }, // Ӷ
+    { 15, 23, 16, 1, 17, 87, 70602 }, // ӷ
+    { 29, 32, 32, 1, 31, 232, 70689 }, // Ӹ
+    { 25, 26, 27, 1, 25, 163, 70921 }, // ӹ
+    { 18, 30, 19, 0, 23, 135, 71084 }, // Ӻ
+    { 15, 24, 16, 1, 17, 90, 71219 }, // ӻ
+    { 24, 30, 23, 0, 23, 180, 71309 }, // Ӽ
+    { 20, 25, 19, 0, 17, 125, 71489 }, // ӽ
+    { 24, 23, 24, 0, 23, 138, 71680 }, // Ӿ
+    { 20, 17, 20, 0, 17, 85, 71818 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 71903 }, //  
+    { 0, 0, 33, 0, 0, 0, 71903 }, //  
+    { 0, 0, 17, 0, 0, 0, 71903 }, //  
+    { 0, 0, 33, 0, 0, 0, 71903 }, //  
+    { 0, 0, 11, 0, 0, 0, 71903 }, //  
+    { 0, 0, 8, 0, 0, 0, 71903 }, //  
+    { 0, 0, 5, 0, 0, 0, 71903 }, //  
+    { 0, 0, 21, 0, 0, 0, 71903 }, //  
+    { 0, 0, 9, 0, 0, 0, 71903 }, //  
+    { 0, 0, 7, 0, 0, 0, 71903 }, //  
+    { 0, 0, 2, 0, 0, 0, 71903 }, //  
+    { 0, 0, 0, 0, 0, 0, 71903 }, // ​
+    { 2, 28, 0, -1, 20, 14, 71903 }, // ‌
+    { 8, 30, 0, -4, 22, 60, 71917 }, // ‍
+    { 12, 31, 0, -6, 23, 93, 71977 }, // ‎
+    { 12, 31, 0, -6, 23, 93, 72070 }, // ‏
+    { 11, 3, 12, 1, 10, 9, 72163 }, // ‐
+    { 11, 3, 12, 1, 10, 9, 72172 }, // ‑
+    { 16, 3, 21, 2, 13, 12, 72181 }, // ‒
+    { 17, 3, 17, 0, 10, 13, 72193 }, // –
+    { 33, 3, 33, 0, 10, 25, 72206 }, // —
+    { 33, 3, 33, 0, 10, 25, 72231 }, // ―
+    { 11, 34, 17, 3, 26, 94, 72256 }, // ‖
+    { 17, 8, 17, 0, -1, 34, 72350 }, // ‗
+    { 6, 11, 8, 1, 25, 17, 72384 }, // ‘
+    { 6, 11, 8, 1, 25, 17, 72401 }, // ’
+    { 6, 10, 8, 1, 4, 15, 72418 }, // ‚
+    { 6, 11, 8, 1, 25, 17, 72433 }, // ‛
+    { 13, 11, 14, 1, 25, 36, 72450 }, // “
+    { 12, 11, 14, 1, 25, 33, 72486 }, // ”
+    { 12, 10, 14, 1, 4, 30, 72519 }, // „
+    { 13, 11, 14, 1, 25, 36, 72549 }, // ‟
+    { 15, 22, 17, 1, 24, 83, 72585 }, // †
+    { 15, 26, 17, 1, 24, 98, 72668 }, // ‡
+    { 8, 7, 10, 1, 12, 14, 72766 }, // •
+    { 12, 12, 21, 4, 17, 36, 72780 }, // ‣
+    { 5, 5, 9, 2, 4, 7, 72816 }, // ․
+    { 14, 5, 17, 1, 4, 18, 72823 }, // ‥
+    { 27, 5, 33, 3, 4, 34, 72841 }, // …
+    { 5, 6, 9, 2, 12, 8, 72875 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 72883 }, //  
+    { 0, 0, 0, 0, 0, 0, 72883 }, //  
+    { 12, 31, 0, -6, 23, 93, 72883 }, // ‪
+    { 12, 31, 0, -6, 23, 93, 72976 }, // ‫
+    { 10, 31, 0, -5, 23, 78, 73069 }, // ‬
+    { 14, 31, 0, -7, 23, 109, 73147 }, // ‭
+    { 14, 31, 0, -7, 23, 109, 73256 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 73365 }, //  
+    { 43, 26, 45, 1, 24, 280, 73365 }, // ‰
+    { 7, 11, 9, 1, 23, 20, 73645 }, // ′
+    { 13, 11, 15, 1, 23, 36, 73665 }, // ″
+    { 20, 11, 22, 1, 23, 55, 73728 }, // ‴
+    { 7, 11, 9, 1, 23, 20, 73783 }, // ‵
+    { 14, 11, 16, 1, 23, 39, 73803 }, // ‶
+    { 21, 11, 23, 1, 23, 58, 73842 }, // ‷
+    { 14, 7, 16, 1, 0, 25, 73900 }, // ‸
+    { 8, 13, 11, 1, 15, 26, 73925 }, // ‹
+    { 9, 13, 11, 1, 15, 30, 73951 }, // ›
+    { 21, 23, 21, 0, 22, 121, 73981 }, // ※
+    { 15, 26, 18, 2, 25, 98, 74102 }, // ‼
+    { 17, 3, 17, 0, 27, 13, 74200 }, // ‾
+    { 8, 3, 10, 1, 10, 6, 74213 }, // ⁃
+    { 16, 27, 6, -5, 24, 108, 74219 }, // ⁄
+    { 26, 25, 29, 2, 24, 163, 74327 }, // ⁇
+    { 21, 26, 25, 2, 25, 137, 74490 }, // ⁈
+    { 21, 26, 25, 2, 25, 137, 74627 }, // ⁉
+    { 19, 6, 33, 7, 13, 29, 74764 }, // ⁓
+    { 26, 11, 28, 1, 23, 72, 74793 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 74865 }, //  
+    { 0, 0, 0, 0, 0, 0, 74865 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 74865 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 74865 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 74865 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 74865 }, // ⁤
+    { 13, 17, 15, 1, 28, 56, 74865 }, // ⁰
+    { 13, 17, 15, 1, 28, 56, 74921 }, // ⁴
+    { 10, 16, 15, 2, 27, 40, 74977 }, // ⁵
+    { 12, 17, 15, 2, 28, 51, 75017 }, // ⁶
+    { 12, 16, 15, 2, 27, 48, 75068 }, // ⁷
+    { 11, 17, 15, 2, 28, 47, 75116 }, // ⁸
+    { 11, 17, 15, 2, 28, 47, 75163 }, // ⁹
+    { 15, 11, 19, 2, 23, 42, 75210 }, // ⁿ
+    { 13, 16, 15, 1, 11, 52, 75252 }, // ₀
+    { 10, 16, 15, 2, 11, 40, 75304 }, // ₁
+    { 12, 16, 15, 2, 11, 48, 75344 }, // ₂
+    { 11, 16, 15, 2, 11, 44, 75392 }, // ₃
+    { 13, 16, 15, 1, 11, 52, 75436 }, // ₄
+    { 10, 16, 15, 2, 11, 40, 75488 }, // ₅
+    { 12, 16, 15, 2, 11, 48, 75528 }, // ₆
+    { 12, 16, 15, 2, 11, 48, 75576 }, // ₇
+    { 11, 16, 15, 2, 11, 44, 75624 }, // ₈
+    { 11, 16, 15, 2, 11, 44, 75668 }, // ₉
+    { 18, 23, 21, 1, 23, 104, 75776 }, // ₣
+    { 19, 24, 21, 1, 23, 114, 75880 }, // ₤
+    { 39, 24, 41, 1, 23, 234, 75994 }, // ₧
+    { 20, 24, 21, 0, 23, 120, 76228 }, // €
+    { 19, 13, 33, 7, 18, 62, 76348 }, // ←
+    { 13, 21, 33, 10, 22, 69, 76410 }, // ↑
+    { 19, 13, 33, 7, 18, 62, 76479 }, // →
+    { 13, 21, 33, 10, 22, 69, 76541 }, // ↓
+    { 21, 13, 33, 6, 18, 69, 76610 }, // ↔
+    { 13, 23, 33, 10, 23, 75, 76679 }, // ↕
+    { 15, 22, 33, 9, 22, 83, 76754 }, // ↨
+    { 13, 21, 33, 10, 22, 69, 76837 }, // ↲
+    { 13, 21, 33, 10, 22, 69, 76906 }, // ↳
+    { 19, 15, 33, 7, 19, 72, 76975 }, // ↵
+    { 19, 15, 33, 7, 19, 72, 77047 }, // ⇐
+    { 15, 19, 33, 9, 21, 72, 77119 }, // ⇑
+    { 19, 15, 33, 7, 19, 72, 77191 }, // ⇒
+    { 15, 19, 33, 9, 21, 72, 77263 }, // ⇓
+    { 21, 15, 33, 6, 19, 79, 77335 }, // ⇔
+    { 23, 24, 33, 5, 23, 138, 77414 }, // ∀
+    { 17, 27, 21, 2, 26, 115, 77552 }, // ∂
+    { 15, 23, 33, 9, 23, 87, 77667 }, // ∃
+    { 25, 27, 33, 4, 25, 169, 77824 }, // ∅
+    { 20, 24, 22, 1, 24, 120, 77993 }, // ∆
+    { 21, 24, 33, 6, 23, 126, 78113 }, // ∇
+    { 21, 23, 33, 6, 23, 121, 78239 }, // ∈
+    { 21, 29, 33, 6, 26, 153, 78360 }, // ∉
+    { 21, 19, 33, 6, 21, 100, 78513 }, // ∊
+    { 21, 23, 33, 6, 23, 121, 78613 }, // ∋
+    { 21, 29, 33, 6, 26, 153, 78734 }, // ∌
+    { 21, 19, 33, 6, 21, 100, 78887 }, // ∍
+    { 25, 29, 27, 1, 23, 182, 78987 }, // ∏
+    { 20, 29, 20, 0, 23, 145, 79169 }, // ∑
+    { 15, 3, 21, 3, 13, 12, 79314 }, // −
+    { 14, 26, 16, 1, 24, 91, 79326 }, // ∕
+    { 15, 26, 17, 2, 24, 98, 79417 }, // ∖
+    { 15, 16, 21, 3, 19, 60, 79515 }, // ∗
+    { 12, 12, 21, 4, 17, 36, 79575 }, // ∘
+    { 6, 6, 21, 7, 12, 9, 79611 }, // ∙
+    { 21, 31, 21, 0, 27, 163, 79620 }, // √
+    { 16, 13, 21, 2, 17, 52, 79783 }, // ∝
+    { 21, 11, 21, 0, 16, 58, 79872 }, // ∞
+    { 21, 23, 33, 6, 23, 121, 79930 }, // ∟
+    { 23, 23, 33, 4, 23, 133, 80051 }, // ∠
+    { 4, 34, 17, 6, 26, 34, 80184 }, // ∣
+    { 10, 34, 17, 3, 26, 85, 80218 }, // ∥
+    { 21, 23, 33, 6, 23, 121, 80303 }, // ∧
+    { 21, 23, 33, 6, 23, 121, 80424 }, // ∨
+    { 19, 24, 33, 7, 24, 114, 80545 }, // ∩
+    { 19, 24, 33, 7, 23, 114, 80659 }, // ∪
+    { 18, 34, 21, 1, 26, 153, 80773 }, // ∫
+    { 21, 19, 33, 6, 18, 100, 80926 }, // ∴
+    { 21, 19, 33, 6, 18, 100, 81026 }, // ∵
+    { 6, 18, 10, 2, 20, 27, 81126 }, // ∶
+    { 21, 19, 33, 6, 18, 100, 81153 }, // ∷
+    { 19, 6, 33, 7, 13, 29, 81253 }, // ∼
+    { 19, 18, 33, 7, 20, 86, 81282 }, // ≅
+    { 16, 12, 21, 2, 17, 48, 81368 }, // ≈
+    { 19, 11, 33, 7, 15, 53, 81416 }, // ≍
+    { 15, 15, 21, 3, 19, 57, 81469 }, // ≠
+    { 19, 15, 33, 7, 17, 72, 81526 }, // ≡
+    { 15, 20, 21, 3, 20, 75, 81598 }, // ≤
+    { 15, 20, 21, 3, 20, 75, 81673 }, // ≥
+    { 27, 16, 33, 3, 19, 108, 81748 }, // ≪
+    { 27, 16, 33, 3, 19, 108, 81920 }, // ≫
+    { 21, 19, 33, 6, 21, 100, 82028 }, // ⊃
+    { 21, 29, 33, 6, 26, 153, 82128 }, // ⊄
+    { 21, 29, 33, 6, 26, 153, 82281 }, // ⊅
+    { 21, 23, 33, 6, 23, 121, 82434 }, // ⊆
+    { 21, 23, 33, 6, 23, 121, 82555 }, // ⊇
+    { 25, 25, 33, 4, 24, 157, 82676 }, // ⊕
+    { 25, 25, 33, 4, 24, 157, 82833 }, // ⊖
+    { 25, 25, 33, 4, 24, 157, 82990 }, // ⊗
+    { 25, 25, 33, 4, 24, 157, 83147 }, // ⊘
+    { 19, 23, 33, 7, 23, 110, 83304 }, // ⊥
+    { 6, 6, 21, 7, 12, 9, 83414 }, // ⋅
+    { 27, 6, 33, 3, 12, 41, 83423 }, // ⋯
+    { 31, 32, 33, 1, 28, 248, 83464 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_regularIntervals[] = {
@@ -5898,4 +3386,9 @@ static const EpdFontData bookerly_16_regular = {
     36,
     -9,
     true,
+    bookerly_16_regularBlockOffsets,
+    bookerly_16_regularDirectGlyphs,
+    bookerly_16_regularGlyphPages,
+    256,
+    bookerly_16_regularPageGlyphs,
 };
@@ -2,3182 +2,1839 @@
  * generated by fontconvert.py
  * name: notosans_12_bold
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py notosans_12_bold 12 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_12_bold 12 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_boldBitmaps[50698] = {
-    0x7F, 0xAF, 0xE7, 0xF9, 0xFD, 0x7F, 0x5F, 0xD7, 0xF4, 0xFD, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x00,
-    0x00, 0x02, 0xE2, 0xFE, 0xBF, 0x9F, 0xD0, 0x40, 0x7F, 0x0F, 0xD7, 0xF0, 0xFD, 0x7F, 0x0F, 0xC3,
-    0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xE0, 0xBC, 0x29, 0x06, 0x80, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x1F,
-    0x47, 0xD0, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0x3F, 0x0F, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFE, 0x1A, 0xFE, 0xBF, 0xE9, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x15, 0xFD, 0x7F, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xF0,
-    0xBC, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x07, 0xD1,
-    0xF4, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFD, 0x3F, 0xCB, 0x06, 0x0F, 0xF2, 0xC0, 0x02, 0xFE, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x2D, 0xFF, 0x00, 0x0B, 0x1F, 0xDE,
-    0x42, 0xCB, 0xF3, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x06, 0xFF, 0xE4, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x7D, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xC0, 0x03, 0xFA, 0xF8, 0x02, 0xF4, 0x00, 0x3F, 0x0F, 0xC0,
-    0x3F, 0x00, 0x03, 0xE0, 0xFC, 0x0B, 0xD0, 0x00, 0x3E, 0x0B, 0xC1, 0xF8, 0x00, 0x03, 0xE0, 0xFC,
-    0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xC7, 0xE1, 0xFD, 0x02, 0xFA, 0xFC, 0xFC, 0xBF, 0xF8, 0x0F, 0xFF,
-    0x1F, 0x4F, 0xEF, 0xC0, 0x7F, 0xD3, 0xF1, 0xF4, 0x7E, 0x00, 0x00, 0xBD, 0x2F, 0x43, 0xE0, 0x00,
-    0x0F, 0xC2, 0xF4, 0x3F, 0x00, 0x02, 0xF4, 0x2F, 0x43, 0xF0, 0x00, 0x7E, 0x02, 0xF4, 0x7E, 0x00,
-    0x0F, 0xC0, 0x0F, 0xCF, 0xD0, 0x01, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00,
-    0x1F, 0xD1, 0xFD, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8,
-    0x02, 0xA8, 0x2F, 0xFF, 0xC0, 0x3F, 0x87, 0xFE, 0xFF, 0x0B, 0xF4, 0xFF, 0x47, 0xFC, 0xFF, 0x0F,
-    0xF0, 0x1F, 0xFF, 0xD0, 0xFF, 0x00, 0x7F, 0xF8, 0x0F, 0xF8, 0x03, 0xFF, 0x40, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xE4, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x1F, 0xC7, 0xF0, 0xFC, 0x3F, 0x0F, 0x82, 0x90, 0x02, 0xF4, 0x1F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F,
-    0x40, 0xFC, 0x07, 0xF0, 0x2F, 0x80, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x40, 0xFD, 0x03, 0xF4,
-    0x0B, 0xE0, 0x2F, 0xC0, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x0B, 0xD0, 0x3F,
-    0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x07, 0xF0, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0xFC, 0x00,
-    0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x02,
-    0xF8, 0x03, 0xF4, 0x07, 0xF0, 0x0B, 0xD0, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x90, 0x7C, 0x09, 0x3F, 0xFF, 0xBF, 0x8F, 0xFF, 0xFF, 0xE1, 0x6B,
-    0xFE, 0x54, 0x03, 0xFF, 0x40, 0x02, 0xFB, 0xF0, 0x01, 0xFC, 0x7F, 0x00, 0x7E, 0x0F, 0x80, 0x01,
-    0x01, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7E, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF1, 0xAA, 0xFE, 0xA8, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFD,
-    0x1F, 0xC2, 0xF8, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x15, 0x54, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFC,
-    0x2E, 0x2F, 0xEB, 0xF9, 0xFD, 0x04, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00,
-    0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0xBF, 0x42, 0xFC, 0x03,
-    0xFC, 0x3F, 0xC0, 0x2F, 0xC3, 0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F,
-    0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0xC0, 0x1F, 0xC3, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xC0, 0xFE, 0x07, 0xF8, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xFD, 0x02, 0xFF, 0xD0, 0xFF, 0xFD, 0x3F, 0xEF, 0xD3, 0xF1,
-    0xFD, 0x08, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD,
-    0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xD0, 0xBF,
-    0xC0, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x1F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF4,
-    0x0F, 0x40, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0xAB,
-    0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x05, 0x6F, 0xF8, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC2, 0x40, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0xFE, 0x00, 0x07, 0xEF, 0xE0, 0x00, 0xFC, 0xFE,
-    0x00, 0x2F, 0x4F, 0xE0, 0x07, 0xE0, 0xFE, 0x00, 0xFC, 0x0F, 0xE0, 0x3F, 0x40, 0xFE, 0x07, 0xFA,
-    0xAF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0xFF, 0x50, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xC0, 0xFE, 0x55, 0x50, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF5, 0x50, 0x01, 0xFF, 0xFF,
-    0x80, 0x7F, 0xFF, 0xFC, 0x0B, 0xEB, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x3F, 0xC9, 0x00, 0x2F, 0xE3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xBF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF0, 0x0B, 0xF9, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x69,
-    0x00, 0x3F, 0x6F, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xF5, 0xBF, 0xC3, 0xFC, 0x02, 0xFD, 0x3F,
-    0x80, 0x0F, 0xD3, 0xF8, 0x00, 0xFD, 0x2F, 0xC0, 0x1F, 0xD1, 0xFE, 0x03, 0xFC, 0x0F, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD1, 0x55, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F,
-    0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xEF, 0xF4, 0x2F, 0xD0, 0x3F, 0xC2, 0xFC, 0x02, 0xFC, 0x1F,
-    0xD0, 0x3F, 0x80, 0xFF, 0x4F, 0xF0, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0xFF, 0x6F, 0xF4, 0x2F, 0xC0, 0x3F, 0xC3, 0xF8, 0x01, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xFC,
-    0x02, 0xFD, 0x2F, 0xFA, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0,
-    0xBF, 0x83, 0xF8, 0x03, 0xFC, 0x3F, 0x40, 0x1F, 0xC3, 0xF4, 0x01, 0xFD, 0x3F, 0x80, 0x2F, 0xD3,
-    0xFD, 0x0B, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFD, 0xFC, 0x01, 0xBE, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xF0, 0x0E, 0xBF, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0xEB, 0xF9, 0xFD, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE2, 0xFE, 0xBF, 0x9F, 0xD0, 0x40, 0x0B, 0x81, 0xFE, 0x2F, 0xE0, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xD1, 0xFC, 0x2F, 0x83,
-    0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
-    0xF8, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xF9,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x6F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xF4, 0x0B, 0xFF, 0x90, 0x03,
-    0xFE, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80,
-    0xBF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFC, 0x39, 0x02, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0xBF, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF9, 0x56, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x05, 0x40, 0xFD,
-    0x0B, 0xD0, 0x7F, 0xFF, 0x0F, 0x83, 0xF0, 0xBF, 0xFF, 0xC2, 0xF1, 0xF4, 0x7F, 0x03, 0xF0, 0x7C,
-    0xBC, 0x2F, 0x40, 0xFC, 0x1F, 0x7F, 0x0F, 0xC0, 0x3F, 0x07, 0xDF, 0xC3, 0xF0, 0x0F, 0xC2, 0xF3,
-    0xF0, 0xFC, 0x07, 0xF0, 0xFC, 0xBC, 0x2F, 0x83, 0xFC, 0x7E, 0x2F, 0x43, 0xFF, 0xFF, 0xFF, 0x03,
-    0xF0, 0x3F, 0xE1, 0xFE, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0x00, 0x01,
-    0xFF, 0x95, 0x6F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0,
-    0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F,
-    0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC,
-    0xBF, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x4F, 0xF0, 0x1F, 0xFC, 0xFF, 0x00,
-    0x3F, 0xCF, 0xF0, 0x03, 0xFC, 0xFF, 0x00, 0xBF, 0x8F, 0xFA, 0xBF, 0xE0, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xBF, 0xCF, 0xF0, 0x03, 0xFC, 0xFF, 0x00, 0x2F, 0xDF, 0xF0, 0x03,
-    0xFD, 0xFF, 0x00, 0xBF, 0xCF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xFD,
-    0x02, 0xD0, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x24, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x03, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xD5, 0x7F, 0xF8, 0xFF, 0x00, 0x2F, 0xF3, 0xFC, 0x00, 0x3F,
-    0xDF, 0xF0, 0x00, 0x7F, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFE, 0xFF, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0xBF, 0xCF, 0xF0,
-    0x1F, 0xFD, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF5, 0x55, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE0,
-    0xBF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x7F, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xC0,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFE, 0x00, 0x70, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x40,
-    0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x3F, 0xC0, 0x02, 0xFC, 0x3F, 0xE0, 0x02, 0xFC, 0x1F, 0xF8,
-    0x02, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0xCF, 0xFF, 0xF2, 0xFF, 0xF4, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xFD, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00,
-    0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0xFF, 0xFD, 0x3F, 0xFE,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0xBF, 0x4F, 0xF0, 0x0B, 0xF8,
-    0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x3F, 0xD0, 0x0F, 0xF2, 0xFE, 0x00, 0x3F,
-    0xDF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0xFF, 0x00, 0x3F, 0xD2,
-    0xFE, 0x00, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xFC, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F, 0xC0, 0x1F,
-    0xF0, 0xFF, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x3F, 0xD0, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xD0, 0x00, 0x0F, 0xFD, 0xFF, 0xF0, 0x00, 0x1F, 0xFD, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFD, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0xFE, 0xFC, 0x00, 0xBD, 0xFD, 0xFE, 0xBD, 0x00,
-    0xFC, 0xFD, 0xFE, 0x7E, 0x00, 0xF8, 0xFD, 0xFE, 0x3F, 0x02, 0xF4, 0xFD, 0xFE, 0x3F, 0x43, 0xF0,
-    0xFD, 0xFE, 0x2F, 0x83, 0xE0, 0xFD, 0xFE, 0x0F, 0xCB, 0xD0, 0xFD, 0xFE, 0x0F, 0xCF, 0xC0, 0xFD,
-    0xFE, 0x0B, 0xEF, 0xC0, 0xFD, 0xFE, 0x07, 0xFF, 0x40, 0xFD, 0xFE, 0x03, 0xFF, 0x00, 0xFD, 0xFE,
-    0x02, 0xFF, 0x00, 0xFD, 0xFE, 0x01, 0xFD, 0x00, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0x3F, 0xFC, 0x00,
-    0x1F, 0xCF, 0xFF, 0x40, 0x07, 0xF3, 0xFF, 0xF0, 0x01, 0xFC, 0xFF, 0xFE, 0x00, 0x7F, 0x3F, 0x7F,
-    0xC0, 0x1F, 0xCF, 0xE7, 0xF8, 0x07, 0xF3, 0xF8, 0xFF, 0x41, 0xFC, 0xFE, 0x0F, 0xF0, 0x7F, 0x3F,
-    0x82, 0xFD, 0x1F, 0xCF, 0xE0, 0x3F, 0xC7, 0xF3, 0xF8, 0x07, 0xF8, 0xFC, 0xFE, 0x00, 0xFF, 0x7F,
-    0x3F, 0x80, 0x1F, 0xFF, 0xCF, 0xE0, 0x02, 0xFF, 0xF3, 0xF8, 0x00, 0x3F, 0xFC, 0xFE, 0x00, 0x0B,
-    0xFF, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0x0F,
-    0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xDB, 0xF4,
-    0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x3F,
-    0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x80, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE3, 0xFD, 0x5B, 0xFC, 0xFF, 0x00, 0xBF,
-    0x7F, 0xC0, 0x1F, 0xDF, 0xF0, 0x07, 0xF7, 0xFC, 0x03, 0xFC, 0xFF, 0x5B, 0xFF, 0x3F, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFF, 0x43, 0xFE, 0xA9, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07,
-    0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF,
-    0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02,
-    0xFD, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF,
-    0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xD0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x54, 0xBF, 0xFE, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xC0, 0x7F, 0xD0, 0xFF, 0x00, 0xBF, 0x83, 0xFC, 0x01, 0xFE, 0x0F, 0xF0, 0x07,
-    0xF4, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFE, 0x00,
-    0x3F, 0xC2, 0xFC, 0x00, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xE4, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0x80, 0x68, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFC, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x02, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xF4, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
-    0xFF, 0xF1, 0x57, 0xFD, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xFD, 0x00, 0x1F, 0xE7, 0xFD, 0x01, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x2F, 0xD0, 0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x0B, 0xF0, 0x2F,
-    0xC0, 0x03, 0xFC, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x3F, 0xC0,
-    0x03, 0xF4, 0x0F, 0xD0, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0xFD,
-    0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00,
-    0xBF, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC7, 0xF4, 0x01, 0xFF, 0x40, 0x0F, 0xE0, 0xFE, 0x00,
-    0xBF, 0xE0, 0x07, 0xF4, 0x3F, 0x80, 0x3F, 0xFC, 0x02, 0xFC, 0x0B, 0xF0, 0x0F, 0xEF, 0x40, 0xFF,
-    0x01, 0xFC, 0x07, 0xEB, 0xE0, 0x3F, 0x80, 0x3F, 0x42, 0xF9, 0xFC, 0x1F, 0xD0, 0x0F, 0xE0, 0xFD,
-    0x3F, 0x0B, 0xF0, 0x02, 0xFC, 0x3F, 0x0F, 0xD2, 0xFC, 0x00, 0x7F, 0x1F, 0xC2, 0xF8, 0xFE, 0x00,
-    0x0F, 0xDB, 0xE0, 0x7F, 0x3F, 0x40, 0x03, 0xFB, 0xF4, 0x0F, 0xDF, 0xC0, 0x00, 0xBE, 0xFC, 0x03,
-    0xFB, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x01, 0xFF,
-    0x0B, 0xF4, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x3F, 0xC0, 0x03, 0xFD, 0x2F,
-    0xD0, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01,
-    0xFE, 0x3F, 0xC0, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0xFF, 0x40, 0x7F, 0xC0, 0x1F, 0xF0,
-    0x3F, 0xD0, 0x02, 0xFE, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03,
-    0xFC, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F,
-    0xC0, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1, 0x55, 0x57, 0xFC, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xF9, 0xFF, 0xE7, 0xFA, 0x5F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01,
-    0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07,
-    0xF0, 0x1F, 0xE9, 0x7F, 0xF8, 0xFF, 0xE0, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0B,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00,
-    0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF5, 0xFF, 0xE6,
-    0xBF, 0x80, 0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x80, 0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x80,
-    0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x80, 0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x8A, 0xFE, 0x7F,
-    0xF9, 0xFF, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0xFB, 0xF0, 0x00, 0x2F, 0x1F, 0x80, 0x03, 0xE0, 0xFC, 0x00, 0xBD, 0x07, 0xE0, 0x0F,
-    0xC0, 0x3F, 0x01, 0xF4, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0xC2, 0x90, 0x00, 0x29, 0x3F, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xD0, 0x07, 0xF4, 0x00, 0xBC, 0x01, 0xBF, 0xD0,
-    0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x24, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x15, 0xBF,
-    0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFB, 0xFC, 0xFF, 0x40, 0xBF, 0x3F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F,
-    0xF3, 0xFF, 0xAF, 0xFC, 0x7F, 0xFF, 0x7F, 0x07, 0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF8, 0xBF, 0x40, 0x3F, 0xBF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xE0, 0x7F, 0xC3, 0xFC, 0x02,
-    0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x00, 0xFE, 0x3F, 0x80, 0x0F, 0xE3, 0xF8, 0x01, 0xFE, 0x3F,
-    0xC0, 0x2F, 0xD3, 0xFD, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0x83, 0xFB, 0xFF, 0xF0, 0x3F, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x60,
-    0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x7F, 0xC0, 0x18, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0xBF, 0x4F, 0xF0, 0xFF, 0xFA, 0xFC, 0xFF, 0xFF, 0xFF, 0x7F, 0xD1, 0xFF, 0xEF, 0xE0,
-    0x0F, 0xFB, 0xF0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFB, 0xF4,
-    0x03, 0xFD, 0xFF, 0x01, 0xFF, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFB, 0xF0, 0x7F, 0xF0, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x90, 0x02, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0xFF, 0x02, 0xFD, 0x7F,
-    0x40, 0x3F, 0xAF, 0xD5, 0x5F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x03, 0xFC, 0x00, 0x10, 0xBF, 0xEA, 0xBC, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x2F, 0xFF, 0x40, 0xFF, 0xFC, 0x07, 0xF8,
-    0x00, 0x1F, 0xD0, 0x00, 0xBF, 0xE9, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x2F, 0xD0, 0x00, 0x7F,
-    0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07,
-    0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x0A, 0x83, 0xFF, 0xFB,
-    0xF3, 0xFF, 0xFF, 0xFC, 0xFF, 0x42, 0xFF, 0xBF, 0x80, 0x3F, 0xEF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xEF, 0xD0, 0x0F, 0xF7, 0xFC, 0x07, 0xFC, 0xFF, 0xEF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xC1, 0xFF, 0xCF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x34, 0x00,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x6F, 0xFF, 0x40, 0x3F, 0x80, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x7F, 0x80,
-    0x3F, 0xBF, 0xFF, 0x43, 0xFF, 0xFF, 0xFC, 0x3F, 0xF4, 0x7F, 0xD3, 0xFC, 0x02, 0xFD, 0x3F, 0xC0,
-    0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3,
-    0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD0, 0x00, 0x0B,
-    0xD7, 0xFC, 0xFE, 0x1A, 0x00, 0x02, 0xA4, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3,
-    0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xFF, 0x00, 0xFE, 0x00,
-    0x68, 0x00, 0x00, 0x00, 0xA9, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00,
-    0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00,
-    0xFE, 0x00, 0xFE, 0x02, 0xFD, 0x7F, 0xFC, 0x7F, 0xF8, 0x3F, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x2A, 0x83, 0xF8, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0xC0, 0x3F, 0x83, 0xFD, 0x00, 0xFE, 0x3F, 0xD0,
-    0x03, 0xFA, 0xFD, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFC, 0x3F, 0xC0, 0x0F, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0xBF, 0x80, 0xFE, 0x00, 0xFF, 0x43, 0xF8,
-    0x00, 0xFF, 0x00, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3,
-    0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0x2A, 0x0B, 0xF8, 0x06, 0xF9,
-    0x03, 0xF7, 0xFF, 0xF2, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x0B, 0xFF, 0x43,
-    0xFD, 0x3F, 0xC0, 0x3F, 0xE0, 0x1F, 0xE3, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x3F, 0x80, 0x2F, 0xC0,
-    0x0F, 0xE3, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x3F, 0x80, 0x2F, 0xC0, 0x0F, 0xE3, 0xF8, 0x02, 0xFC,
-    0x00, 0xFE, 0x3F, 0x80, 0x2F, 0xC0, 0x0F, 0xE3, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x3F, 0x80, 0x2F,
-    0xC0, 0x0F, 0xE3, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x2A, 0x07, 0xF8, 0x03, 0xF3, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0x47, 0xFD, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F,
-    0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8,
-    0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00,
-    0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2,
-    0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0B,
-    0xF4, 0x03, 0xF7, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x83, 0xFE, 0x07, 0xFC, 0x3F, 0xC0, 0x2F, 0xD3,
-    0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x0F, 0xE3, 0xF8, 0x00, 0xFE, 0x3F, 0x80, 0x1F, 0xE3, 0xFC, 0x02,
-    0xFD, 0x3F, 0xD0, 0x3F, 0xC3, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xC0, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x0A, 0x83, 0xFF, 0xFB, 0xF3, 0xFF, 0xFF, 0xFC, 0xFF, 0x42,
-    0xFF, 0xBF, 0x80, 0x3F, 0xEF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x00,
-    0x2F, 0xEF, 0xD0, 0x0F, 0xF7, 0xFC, 0x07, 0xFC, 0xFF, 0xEF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC1, 0xFF,
-    0xCF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x2A, 0x07, 0xE3, 0xF2, 0xFE, 0x3F, 0xBF, 0xE3, 0xFF, 0xE9, 0x3F,
-    0xE0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x06, 0xFE, 0x40, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0x3F, 0xC0, 0x14, 0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x7F,
-    0xF4, 0x00, 0x1F, 0xD4, 0x00, 0x3F, 0x7F, 0xAB, 0xFC, 0xFF, 0xFF, 0xE1, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFE, 0xA8, 0x3F, 0xFF, 0xF1,
-    0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8,
-    0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD,
-    0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x0A, 0xA2, 0xFD, 0x00, 0x3F,
-    0xC3, 0xF8, 0x01, 0xFD, 0x0F, 0xF0, 0x0B, 0xF0, 0x1F, 0xD0, 0x3F, 0x80, 0x3F, 0x81, 0xFD, 0x00,
-    0xBF, 0x0B, 0xF0, 0x01, 0xFC, 0x3F, 0x80, 0x03, 0xF9, 0xFC, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x6A, 0x00,
-    0x6A, 0x80, 0x1A, 0x87, 0xF4, 0x0B, 0xFC, 0x03, 0xFC, 0x3F, 0x80, 0xFF, 0xD0, 0x3F, 0x83, 0xFC,
-    0x0F, 0xFE, 0x07, 0xF0, 0x2F, 0xC1, 0xF7, 0xF0, 0xBF, 0x01, 0xFD, 0x2F, 0x2F, 0x0F, 0xE0, 0x0F,
-    0xE3, 0xF1, 0xF4, 0xFD, 0x00, 0xBF, 0x3E, 0x1F, 0x9F, 0xC0, 0x07, 0xF7, 0xD0, 0xFA, 0xFC, 0x00,
-    0x3F, 0xBC, 0x0F, 0xEF, 0x80, 0x03, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0x2F, 0xF8, 0x07, 0xFF, 0x00,
-    0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x6A, 0x80, 0x0A, 0xA0, 0xFF,
-    0x40, 0xFF, 0x40, 0xFF, 0x07, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x03, 0xFE, 0xFD, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0xBF, 0x8F, 0xF0, 0x03, 0xFC, 0x1F, 0xE0, 0x3F, 0xD0, 0x3F, 0xD2, 0xFE, 0x00, 0x3F, 0xC0,
-    0xAA, 0x00, 0x06, 0xA2, 0xFD, 0x00, 0x3F, 0xC3, 0xF8, 0x01, 0xFD, 0x0B, 0xF0, 0x0B, 0xF0, 0x1F,
-    0xD0, 0x3F, 0x80, 0x3F, 0x81, 0xFD, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0xFD, 0x3F, 0x80, 0x02, 0xF9,
-    0xFC, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x1B, 0x80, 0x3F, 0xF0, 0x1F, 0xFC, 0x07, 0xF0, 0x02, 0xF8,
-    0x00, 0xBE, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x03, 0xF8, 0x17, 0xFD, 0x0B, 0xFD, 0x02, 0xFE, 0x40,
-    0x6F, 0xF4, 0x00, 0xFE, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0xC0,
-    0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x0B, 0xF0, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x68,
-    0xF9, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00,
-    0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFE, 0x40, 0x2F, 0xF4, 0x07, 0xFD, 0x0B, 0xFE, 0x43, 0xF8, 0x00,
-    0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x3F,
-    0x80, 0x00, 0x2F, 0xE0, 0x01, 0x3F, 0xFF, 0xA6, 0xCF, 0xFF, 0xFF, 0xF3, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x19, 0x1F, 0xEB, 0xF9, 0xFD, 0x15, 0x00, 0x01, 0x50, 0xFC, 0x3F, 0x0F, 0xC3,
-    0xF0, 0xFD, 0x7F, 0x5F, 0xD7, 0xF5, 0xFD, 0x7F, 0xAF, 0xE6, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x0F, 0x00, 0x01, 0xBF, 0xF9, 0x07, 0xFF, 0xFD, 0x1F, 0xFF, 0xFC, 0x2F, 0xE0, 0x04,
-    0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x2F, 0xF0, 0x19, 0x0F, 0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x00, 0xBF, 0xE4, 0x00, 0x0F,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x2F, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xF8, 0x0B, 0xF4, 0x04, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0xAF, 0xFA, 0xA4, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x69, 0x3C, 0x7F, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xF8, 0x1F, 0x81, 0xF8, 0x2F, 0x00, 0xFC, 0x3F, 0x00, 0xBC, 0x2F, 0x40, 0xF8, 0x1F, 0xEB, 0xF4,
-    0x3F, 0xFF, 0xFC, 0x7E, 0xFF, 0xBD, 0x14, 0x00, 0x14, 0xBF, 0x00, 0x0B, 0xF1, 0xFE, 0x00, 0x3F,
-    0x42, 0xFC, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xD0, 0x0B, 0xF0, 0xBF, 0x00, 0x0F, 0xD3, 0xF4, 0x00,
-    0x2F, 0x9F, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1B, 0xFF, 0xE8, 0x00, 0xBF,
-    0xFF, 0xF0, 0x01, 0x5F, 0xF5, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x5B, 0xF5, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x68, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x3F, 0xFF, 0xE7, 0xF4, 0x6C,
-    0xBE, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xF4, 0x3F, 0x7F, 0xD7, 0xD0, 0x7F, 0xBD,
-    0x03, 0xF7, 0xF4, 0x3F, 0x2F, 0xFB, 0xD0, 0x7F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0x00, 0x03,
-    0xFA, 0x40, 0xBE, 0xBF, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x0B, 0x7F, 0x87, 0xFB,
-    0xD1, 0xFC, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x0B, 0xE9,
-    0xBF, 0x80, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0x00, 0x69, 0x0B, 0xC0, 0xB4, 0x1F, 0xFF, 0x0B,
-    0x43, 0x81, 0xF4, 0x14, 0x0F, 0x1D, 0x0F, 0x40, 0x00, 0x2C, 0xB0, 0x3C, 0x00, 0x00, 0x77, 0xC1,
-    0xF0, 0x00, 0x00, 0xEF, 0x07, 0xC0, 0x00, 0x03, 0xAC, 0x0F, 0x00, 0x00, 0x1D, 0x74, 0x3D, 0x00,
-    0x00, 0xB4, 0xE0, 0xBC, 0x00, 0x03, 0xC2, 0xC0, 0xBF, 0xF8, 0x2E, 0x03, 0xC0, 0x6F, 0x81, 0xF0,
-    0x07, 0xD0, 0x00, 0x2F, 0x00, 0x07, 0xF9, 0x5B, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x41, 0xFF, 0xF0, 0x10, 0x3D, 0x06, 0xAF, 0x4F, 0xFF,
-    0xD7, 0xD0, 0xF5, 0xF4, 0xBD, 0x3F, 0xFF, 0x42, 0xE0, 0x90, 0x00, 0x10, 0x01, 0x00, 0x01, 0xF4,
-    0x0F, 0x80, 0x0F, 0xE0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x40, 0xBF, 0x47, 0xF8,
-    0x03, 0xFC, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0x80,
-    0x0B, 0xE0, 0x7F, 0x00, 0x09, 0x00, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xF1, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x7C, 0x15, 0x54, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x00, 0x00, 0x0B, 0xE9, 0xBF, 0x80, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0x0A, 0x94, 0x0B,
-    0xC0, 0xB4, 0x3F, 0xFD, 0x0B, 0x43, 0x80, 0xF1, 0xBC, 0x0F, 0x1D, 0x03, 0xC0, 0xF0, 0x2C, 0xB0,
-    0x0F, 0x03, 0xC0, 0x77, 0xC0, 0x3D, 0x7E, 0x00, 0xEF, 0x00, 0xFF, 0xE0, 0x03, 0xAC, 0x03, 0xDB,
-    0x80, 0x1D, 0x74, 0x0F, 0x0F, 0x40, 0xB4, 0xE0, 0x3C, 0x1F, 0x03, 0xC2, 0xC0, 0xF0, 0x3D, 0x2E,
-    0x03, 0xC2, 0x40, 0x25, 0xF0, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x07, 0xF9, 0x5B, 0xF0, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xFF, 0xE2, 0xF4, 0xBD, 0xF8, 0x0F, 0xBD, 0x03,
-    0xEF, 0xC1, 0xF5, 0xFF, 0xFC, 0x1F, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x29, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x14, 0x00, 0x2A, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x00, 0x50,
-    0x07, 0xFF, 0x43, 0xFF, 0xF0, 0x60, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0,
-    0x1F, 0xC0, 0x0F, 0xFF, 0xD7, 0xFF, 0xF8, 0xAA, 0xA9, 0x00, 0x50, 0x0B, 0xFF, 0x43, 0xFF, 0xF0,
-    0x50, 0x7D, 0x00, 0x1F, 0x01, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x7D, 0x00, 0x0F, 0x9E, 0x5B, 0xE7,
-    0xFF, 0xF0, 0x6F, 0x90, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xE0, 0x3F, 0x40, 0xBC, 0x00, 0x2A, 0x40,
-    0x0A, 0x93, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3,
-    0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x02,
-    0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xEF, 0xD3, 0xFB, 0xFC, 0xBD, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xD7, 0xC7, 0xFF,
-    0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xCB, 0xFF, 0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xCB, 0xFF, 0xFC, 0x3C,
-    0x7F, 0xFF, 0xC3, 0xC3, 0xFF, 0xFC, 0x3C, 0x2F, 0xFF, 0xC3, 0xC0, 0xBF, 0xFC, 0x3C, 0x00, 0x57,
-    0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0,
-    0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0xEB, 0xF9, 0xFD, 0x04, 0x00, 0x0F, 0x00, 0x7F, 0x00,
-    0x3F, 0x00, 0xFC, 0xBF, 0xF1, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xCB, 0xFF, 0x2E, 0xFC,
-    0x13, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x2A, 0x00, 0x00, 0x01, 0xFE,
-    0x02, 0xFF, 0xF0, 0xF8, 0x3E, 0x7D, 0x0B, 0xDF, 0x02, 0xF3, 0xD0, 0xBC, 0xFD, 0x7E, 0x1F, 0xFF,
-    0x00, 0xBE, 0x00, 0x01, 0x00, 0x10, 0x00, 0x7E, 0x07, 0xE0, 0x02, 0xFD, 0x1F, 0xE0, 0x03, 0xFC,
-    0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xBF, 0x00, 0xBF, 0x0B,
-    0xF4, 0x0B, 0xF4, 0x7F, 0x80, 0x7F, 0x83, 0xFC, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0x80, 0x08, 0x00,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xFE, 0x00, 0x0F, 0xC0, 0x02, 0xFF, 0x80, 0x0B, 0xD0, 0x00,
-    0xFB, 0xE0, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0xBC, 0x00, 0x00, 0x07, 0xE0, 0x7E, 0x03, 0xF0, 0x01, 0xF8, 0x3F, 0x02, 0xFC, 0x00,
-    0x7E, 0x1F, 0x81, 0xFF, 0x00, 0x1F, 0x4F, 0xC0, 0xFF, 0xC0, 0x00, 0x07, 0xD0, 0xB7, 0xF0, 0x00,
-    0x03, 0xF0, 0x78, 0xFC, 0x00, 0x02, 0xF4, 0x3C, 0x3F, 0x00, 0x00, 0xFC, 0x2F, 0xFF, 0xF4, 0x00,
-    0xBC, 0x0B, 0xFF, 0xFE, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x01,
-    0xF4, 0x00, 0x1F, 0x40, 0x01, 0xFE, 0x00, 0x0F, 0xC0, 0x02, 0xFF, 0x80, 0x0B, 0xD0, 0x00, 0xFB,
-    0xE0, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0x80, 0xBC, 0x00, 0x00, 0x07, 0xE0, 0x7E, 0x1F, 0xE4, 0x01, 0xF8, 0x3F, 0x2F, 0xFF, 0x00, 0x7E,
-    0x1F, 0x87, 0xDF, 0xE0, 0x1F, 0x4F, 0xC0, 0x01, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x03,
-    0xF0, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xBC,
-    0x00, 0x7F, 0x55, 0x00, 0x7E, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0x40, 0xBF, 0xFC, 0x00, 0x3F, 0x00, 0x24, 0x7D, 0x00,
-    0xBD, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x0A, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0xF4, 0x07, 0xE0,
-    0x00, 0x05, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x82, 0xF4, 0xD0, 0x7F, 0x3F, 0x07, 0xF4,
-    0xFF, 0xFD, 0xBD, 0x0F, 0xF4, 0x7F, 0xF4, 0xFC, 0x2E, 0xF4, 0x00, 0x02, 0xF4, 0x7E, 0xF4, 0x00,
-    0x03, 0xF0, 0xF2, 0xF4, 0x00, 0x0B, 0xC2, 0xD2, 0xF4, 0x00, 0x1F, 0x83, 0xFF, 0xFF, 0x00, 0x3F,
-    0x03, 0xFF, 0xFF, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0,
-    0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x14, 0x7F, 0xEA, 0xFC, 0x3F, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xF8, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03,
-    0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0,
-    0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9,
-    0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00,
-    0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE,
-    0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF,
-    0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x07, 0xF2, 0xF8, 0x00,
-    0x00, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00,
-    0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0x80, 0xE0, 0x00, 0x0B,
-    0xFF, 0xBE, 0x00, 0x00, 0xFA, 0xFF, 0xC0, 0x00, 0x0E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xBF, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00,
-    0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x7F, 0x95,
-    0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFE, 0x03,
-    0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x07, 0xFC, 0xFF, 0x40, 0x00,
-    0x3F, 0xC0, 0x00, 0x38, 0x0B, 0x40, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00,
-    0x01, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00,
-    0xBF, 0x2F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xFF,
-    0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x7F, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF,
-    0x47, 0xF8, 0x00, 0x07, 0xFC, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F,
-    0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00,
-    0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03,
-    0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x02,
-    0xFD, 0xBF, 0x95, 0x54, 0x00, 0x0F, 0xE1, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF4, 0x00, 0x00,
-    0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0x01, 0xFF, 0xFF,
-    0xF0, 0x03, 0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xE5, 0x6F, 0xE5, 0x54, 0x00, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00,
-    0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xFD, 0x7F, 0x40, 0x01, 0xFF, 0xFF, 0xF7, 0xFC,
-    0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xFD, 0x02, 0xD0, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x24, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF,
-    0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xF4, 0x00, 0x7F, 0x40,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55,
-    0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFC, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xF8, 0x0B,
-    0xE3, 0xF4, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB,
-    0xFD, 0x55, 0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFC, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x1E, 0x02, 0xD0, 0xFD, 0x2F, 0xC3, 0xF4,
-    0x7E, 0x01, 0x40, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF,
-    0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0x3F, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00,
-    0x0F, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0x2F, 0xFF, 0x40, 0xFF, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFF, 0xD3, 0xFF, 0xFC, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x2F, 0xFF, 0x40, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x01, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x7F, 0xFC, 0x07, 0xF2, 0xFC, 0x3E, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xFF, 0x40, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x2D, 0x0B, 0x8B,
-    0xF0, 0xFC, 0x7E, 0x0F, 0xC1, 0x40, 0x10, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xFF,
-    0xF4, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x1F,
-    0xFF, 0x43, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xD5, 0x7F, 0xF8, 0x0F, 0xF0, 0x02, 0xFF, 0x03, 0xFC, 0x00, 0x3F,
-    0xD0, 0xFF, 0x00, 0x07, 0xF8, 0x7F, 0xD5, 0x00, 0xFF, 0x7F, 0xFF, 0xD0, 0x3F, 0xDF, 0xFF, 0xF4,
-    0x0F, 0xF7, 0xFF, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0xFF, 0x43, 0xFC,
-    0x00, 0xBF, 0xC0, 0xFF, 0x01, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x2E, 0x02, 0xC0, 0x00, 0x3F, 0xFE, 0xF0, 0x00, 0x2F, 0xBF, 0xF8,
-    0x00, 0x0B, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xCF, 0xFF, 0x00,
-    0x07, 0xF3, 0xFF, 0xD0, 0x01, 0xFC, 0xFF, 0xFC, 0x00, 0x7F, 0x3F, 0xFF, 0x80, 0x1F, 0xCF, 0xDF,
-    0xF0, 0x07, 0xF3, 0xF9, 0xFE, 0x01, 0xFC, 0xFE, 0x3F, 0xD0, 0x7F, 0x3F, 0x83, 0xFC, 0x1F, 0xCF,
-    0xE0, 0xBF, 0x47, 0xF3, 0xF8, 0x0F, 0xF1, 0xFC, 0xFE, 0x01, 0xFE, 0x3F, 0x3F, 0x80, 0x3F, 0xDF,
-    0xCF, 0xE0, 0x07, 0xFF, 0xF3, 0xF8, 0x00, 0xBF, 0xFC, 0xFE, 0x00, 0x0F, 0xFF, 0x3F, 0x80, 0x02,
-    0xFF, 0xCF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF,
-    0x80, 0x7F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x3F,
-    0xCB, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40,
-    0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B, 0xF8,
-    0x1F, 0xF8, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01,
-    0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00,
-    0x3F, 0xCB, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF,
-    0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B,
-    0xF8, 0x1F, 0xF8, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80,
-    0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD,
-    0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00,
-    0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xF0, 0x00, 0x07, 0xFF,
-    0xBF, 0x00, 0x00, 0xFE, 0xFF, 0xD0, 0x00, 0x0F, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07,
-    0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF,
-    0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02,
-    0xFD, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF,
-    0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x7F,
-    0x0F, 0xC0, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xDB,
-    0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00,
-    0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x38, 0x3F, 0x40, 0xFD, 0x1F, 0xD3, 0xF8, 0x07, 0xFF, 0xE0,
-    0x01, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xD0, 0x0F, 0xE7, 0xF4, 0x3F, 0x81, 0xFD, 0x2E,
-    0x00, 0x7C, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0xFF, 0xFB, 0xF0, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0x7F, 0xF8,
-    0x3F, 0xC0, 0x0F, 0xFF, 0xC7, 0xF8, 0x03, 0xF3, 0xFC, 0xBF, 0x80, 0x7D, 0x3F, 0xDB, 0xF4, 0x0F,
-    0x82, 0xFD, 0xBF, 0x42, 0xF0, 0x2F, 0xDB, 0xF4, 0x7D, 0x02, 0xFD, 0x7F, 0x8F, 0x80, 0x3F, 0xC3,
-    0xFE, 0xF0, 0x03, 0xFC, 0x3F, 0xFD, 0x00, 0xBF, 0x81, 0xFF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xEF, 0xFF, 0x80, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xBF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFE, 0x7F,
-    0xD0, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFE, 0x7F, 0xD0, 0x1F,
-    0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xBE, 0x3F, 0x40, 0x07,
-    0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFE, 0x7F, 0xD0, 0x1F, 0xF0, 0xFF,
-    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x2C, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x0F, 0xEB, 0xF4, 0x00, 0x7F, 0x9F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xCF, 0xF0, 0x1F, 0xF7, 0xFC,
-    0x01, 0xFD, 0xFF, 0x00, 0x7F, 0xBF, 0xC0, 0x1F, 0xEF, 0xF0, 0x0F, 0xF7, 0xFE, 0xAF, 0xFC, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x0F, 0xF5, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x1F, 0xF0, 0x3F, 0x80, 0x0F, 0xF0, 0x3F, 0x80, 0x0F, 0xF0, 0x3F,
-    0x80, 0x7F, 0xC0, 0x3F, 0x81, 0xFF, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x3F,
-    0x83, 0xFF, 0x40, 0x3F, 0x81, 0xFF, 0xE0, 0x3F, 0x80, 0x2F, 0xFC, 0x3F, 0x80, 0x07, 0xFD, 0x3F,
-    0x80, 0x01, 0xFE, 0x3F, 0x80, 0x01, 0xFE, 0x3F, 0x8B, 0x9B, 0xFD, 0x3F, 0x8B, 0xFF, 0xFC, 0x3F,
-    0x87, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x7F, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x5B, 0xFC, 0x0F, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4, 0x0B, 0xF3, 0xFC, 0x02, 0xFC, 0xFF, 0x00, 0xFF, 0x3F, 0xFA,
-    0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40, 0x3F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x01, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4, 0x0B, 0xF3, 0xFC, 0x02, 0xFC,
-    0xFF, 0x00, 0xFF, 0x3F, 0xFA, 0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F, 0xF4, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0x8B, 0xE0, 0x1F, 0x40,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40,
-    0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4,
-    0x0B, 0xF3, 0xFC, 0x02, 0xFC, 0xFF, 0x00, 0xFF, 0x3F, 0xFA, 0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F,
-    0xF4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x1E, 0x02, 0xFF, 0xEF, 0x40, 0xFB, 0xFF, 0xC0,
-    0x74, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8,
-    0x09, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x05, 0x6F, 0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xFE, 0xFF,
-    0x3F, 0xD0, 0x2F, 0xCF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xFF, 0xEB, 0xFF, 0x1F, 0xFF, 0xDF,
-    0xC1, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x80, 0xB4, 0x03, 0xF4, 0x7F, 0x00, 0xFD, 0x1F,
-    0xC0, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF8, 0x09, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x05, 0x6F, 0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xFE,
-    0xFF, 0x3F, 0xD0, 0x2F, 0xCF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xFF, 0xEB, 0xFF, 0x1F, 0xFF,
-    0xDF, 0xC1, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x2D,
-    0x2E, 0x00, 0x0B, 0x4B, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x90, 0x0F, 0xF0, 0x00, 0x02, 0xFC, 0x00,
-    0x56, 0xFF, 0x03, 0xFF, 0xFF, 0xC3, 0xFF, 0xEF, 0xF3, 0xFD, 0x02, 0xFC, 0xFF, 0x00, 0xBF, 0x3F,
-    0xC0, 0x3F, 0xCF, 0xFE, 0xBF, 0xF1, 0xFF, 0xFD, 0xFC, 0x1F, 0xFD, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x7F, 0x90, 0x07, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x14, 0x03, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x15, 0x7F, 0xD5, 0x5F, 0xF1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xBF, 0x40, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x12, 0xFF, 0x6F, 0xFF, 0xEA, 0xBC, 0x7F,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x60, 0x7F, 0x80, 0x00, 0xBF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x18,
-    0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x0F, 0xF0, 0x2F, 0xD7, 0xF4, 0x03, 0xFA, 0xFD,
-    0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F,
-    0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x0F, 0xF0, 0x2F,
-    0xD7, 0xF4, 0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x2F,
-    0x8B, 0xE0, 0x1F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0x0F, 0xF0, 0x2F, 0xD7, 0xF4, 0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xB4, 0x03, 0xF4, 0x7F,
-    0x00, 0xFD, 0x1F, 0xC0, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFC, 0x3F, 0xC0, 0xBF, 0x5F, 0xD0, 0x0F, 0xEB, 0xF5, 0x57, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x2F, 0xFA,
-    0xAF, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0xBF, 0x40, 0x07, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0F, 0xE0, 0x03, 0xF8, 0x00,
-    0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x0B, 0xF4, 0x1F, 0xC0,
-    0x3E, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80,
-    0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xFC, 0x07, 0xF2, 0xF8, 0x3E, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0A, 0x90, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03,
-    0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x2C, 0x0B, 0x4B, 0xE0, 0xFC, 0xBE, 0x0F, 0xC1, 0x40,
-    0x10, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x41, 0xC0, 0x01, 0xFE,
-    0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xE0, 0xFE, 0x00,
-    0x00, 0x07, 0xF4, 0x02, 0xFF, 0xBF, 0x80, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xFF, 0xC7, 0xF8, 0x03,
-    0xFD, 0xBF, 0x00, 0x2F, 0xDF, 0xF0, 0x01, 0xFD, 0xFF, 0x00, 0x1F, 0xDB, 0xF0, 0x02, 0xFC, 0x7F,
-    0x80, 0x3F, 0xC3, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x0B, 0x00, 0x3F, 0xFE, 0xF0, 0x0B, 0xEF, 0xFE, 0x00, 0xB0, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xA0, 0x7F, 0x80, 0x3F, 0x3F, 0xFF, 0x43, 0xFF, 0xFF, 0xFC, 0x3F, 0xF4, 0x7F,
-    0xD3, 0xFC, 0x02, 0xFD, 0x3F, 0xC0, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8,
-    0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD,
-    0x3F, 0x80, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00,
-    0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2,
-    0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B,
-    0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF,
-    0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x7F, 0x1F, 0xC0, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90,
-    0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0,
-    0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC,
-    0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x0F, 0x00, 0x7F, 0xFB, 0xE0, 0x0F, 0xEF, 0xFD, 0x00, 0xF0, 0x2E, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0,
-    0xBF, 0x87, 0xF4, 0x03, 0xFC, 0xBF, 0x00, 0x2F, 0xDF, 0xF0, 0x01, 0xFD, 0xFF, 0x00, 0x1F, 0xDB,
-    0xF0, 0x02, 0xFD, 0xBF, 0x40, 0x2F, 0xC3, 0xFC, 0x07, 0xFC, 0x2F, 0xFA, 0xFF, 0x40, 0xFF, 0xFF,
-    0xE0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xB8, 0x00, 0xBF, 0x0F, 0xC0, 0x07,
-    0xE0, 0xFC, 0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0xBF, 0x87, 0xF4, 0x03, 0xFC, 0xBF, 0x00, 0x2F, 0xDF, 0xF0,
-    0x01, 0xFD, 0xFF, 0x00, 0x1F, 0xDB, 0xF0, 0x02, 0xFD, 0xBF, 0x40, 0x2F, 0xC3, 0xFC, 0x07, 0xFC,
-    0x2F, 0xFA, 0xFF, 0x40, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xF1, 0xAA, 0xAA, 0xA8, 0x00, 0x14, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0xE0,
-    0x0B, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xD1, 0xFF, 0x8B, 0xF4, 0x2F, 0xFC, 0xBF, 0x07,
-    0xFF, 0xCF, 0xF0, 0xF9, 0xFD, 0xFF, 0x2F, 0x1F, 0xDF, 0xF7, 0xD2, 0xFD, 0xBF, 0xF8, 0x3F, 0xC7,
-    0xFF, 0x07, 0xF8, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xF0, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F,
-    0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8,
-    0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80,
-    0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3,
-    0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x00,
-    0x3F, 0x4F, 0xC0, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01,
-    0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F,
-    0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F,
-    0xD3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x78, 0x00, 0x3F, 0x0F, 0xD0, 0x03, 0xF0, 0xFD, 0x00, 0x04, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xA4, 0x00, 0xA9, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8,
-    0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD,
-    0x3F, 0x80, 0x2F, 0xD3, 0xFC, 0x07, 0xFD, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFE, 0xFD, 0x07, 0xFF,
-    0x8B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x6A, 0x2F,
-    0xD0, 0x03, 0xFC, 0x3F, 0x80, 0x1F, 0xD0, 0xBF, 0x00, 0xBF, 0x01, 0xFD, 0x03, 0xF8, 0x03, 0xF8,
-    0x1F, 0xD0, 0x0B, 0xF0, 0xBF, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x7F, 0x40, 0x3F, 0xBF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xE0, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x00,
-    0xFE, 0x3F, 0x80, 0x0F, 0xE3, 0xF8, 0x01, 0xFE, 0x3F, 0xC0, 0x2F, 0xD3, 0xFE, 0x03, 0xFC, 0x3F,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x3F, 0x9F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02,
-    0xD0, 0x78, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x10, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xA8, 0x00, 0x1A, 0x8B, 0xF4, 0x00, 0xFF, 0x0F, 0xE0, 0x07, 0xF4, 0x2F, 0xC0, 0x2F,
-    0xC0, 0x7F, 0x40, 0xFE, 0x00, 0xFE, 0x07, 0xF4, 0x02, 0xFC, 0x2F, 0xC0, 0x03, 0xF4, 0xFE, 0x00,
-    0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFC,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x6A, 0xAA,
-    0x40, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0,
-    0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F,
-    0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC,
-    0x06, 0xAA, 0xA4, 0x02, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0,
-    0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x24, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x15, 0xBF,
-    0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFB, 0xFC, 0xFF, 0x40, 0xBF, 0x3F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F,
-    0xF3, 0xFF, 0xAF, 0xFC, 0x7F, 0xFF, 0x7F, 0x07, 0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x40, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00,
-    0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x05, 0x00, 0x04, 0x03, 0xD0, 0x0F,
-    0x40, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD,
-    0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x5B,
-    0xFC, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4, 0x0B, 0xF3, 0xFC, 0x02, 0xFC, 0xFF, 0x00,
-    0xFF, 0x3F, 0xFA, 0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0,
-    0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F,
-    0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xE8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xB8, 0x01, 0xBF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x24, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x15, 0xBF, 0xC0, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFB, 0xFC, 0xFF, 0x40, 0xBF, 0x3F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F, 0xF3, 0xFF,
-    0xAF, 0xFC, 0x7F, 0xFF, 0x7F, 0x07, 0xFF, 0x4B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x7E, 0x50, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xF4,
-    0x0B, 0x42, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x90, 0x3F, 0xFF, 0xFF, 0x80, 0x2F,
-    0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x60, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x18, 0x3F, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0x8F, 0xD0, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xF4, 0x0B, 0x42, 0xFE,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x90, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xD0,
-    0x0F, 0xD3, 0xF4, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xF8, 0x3F, 0xE0, 0x60, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x18, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9,
-    0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xF4, 0x0B, 0x42, 0xFE, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x90, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F,
-    0xE0, 0x60, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x18, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0x07, 0xF3, 0xF8, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xF4, 0x0B, 0x42, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x90, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x0B, 0xF3, 0xF8, 0x02, 0xFF, 0xE0, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x60, 0x7F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x7F, 0xC0, 0x18, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x00, 0x2F, 0xDF, 0xD0, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFD, 0x57, 0xFF, 0x8F, 0xF0, 0x02, 0xFF, 0x3F, 0xC0, 0x03, 0xFD, 0xFF, 0x00, 0x07,
-    0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0xFF, 0x7F, 0xC0, 0x0B, 0xFC, 0xFF, 0x01, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xF0, 0x00,
-    0x00, 0xFF, 0x1F, 0x80, 0x00, 0x03, 0xFC, 0xBC, 0x00, 0x00, 0x0F, 0xF3, 0xE0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0xFF, 0xFA, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xD1, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x0B, 0xF4, 0x03, 0xFC,
-    0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xBF, 0x00, 0x00,
-    0x7F, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xD5, 0x7F, 0xF8, 0x0F, 0xF0, 0x02, 0xFF, 0x03, 0xFC,
-    0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x07, 0xF8, 0x7F, 0xD5, 0x00, 0xFF, 0x7F, 0xFF, 0xD0, 0x3F, 0xDF,
-    0xFF, 0xF4, 0x0F, 0xF7, 0xFF, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0xFF,
-    0x43, 0xFC, 0x00, 0xBF, 0xC0, 0xFF, 0x01, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x15, 0x7F, 0xD4, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xE2, 0xFC,
-    0x07, 0xFF, 0xFB, 0xF0, 0x3F, 0xFF, 0xFF, 0xC1, 0xFF, 0x42, 0xFF, 0x0B, 0xF8, 0x03, 0xFC, 0x3F,
-    0xD0, 0x0B, 0xF0, 0xFF, 0x40, 0x2F, 0xC3, 0xFD, 0x00, 0xBF, 0x0B, 0xF8, 0x03, 0xFC, 0x1F, 0xF0,
-    0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE, 0xFF, 0x00, 0x7F, 0xE1, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xAA, 0x90, 0xBF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF5, 0x55, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE0, 0x06, 0xAA,
-    0xA4, 0x02, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x02, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0xFF, 0x02, 0xFD, 0x7F, 0x40, 0x3F, 0xAF, 0xD5, 0x5F, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x10, 0xBF,
-    0xEA, 0xBC, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0xF4,
-    0x03, 0xD2, 0xFF, 0xFF, 0x03, 0xFF, 0xF4, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x05, 0x00,
-    0x04, 0x03, 0xD0, 0x0F, 0x40, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0x00, 0x6F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x0F, 0xF0, 0x2F, 0xD7, 0xF4,
-    0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF,
-    0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0x0F, 0xF0, 0x2F, 0xD7, 0xF4, 0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xBF, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF5, 0x55, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE0, 0x00, 0x3D, 0x00, 0x03,
-    0xE0, 0x00, 0x1F, 0x00, 0x00, 0x7E, 0x50, 0x00, 0xFF, 0x80, 0x00, 0xB9, 0x00, 0xBF, 0x90, 0x02,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0xFF, 0x02, 0xFD, 0x7F, 0x40, 0x3F, 0xAF, 0xD5, 0x5F, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x10,
-    0xBF, 0xEA, 0xBC, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01,
-    0xF8, 0x0B, 0xE1, 0xFD, 0xBE, 0x02, 0xFF, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x7F, 0x6F, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x0F, 0xF0, 0x2F, 0xD7,
-    0xF4, 0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x3F, 0x1F, 0xC0, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0x00, 0x70, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xFC,
-    0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x3F, 0xC0, 0x02, 0xFC,
-    0x3F, 0xE0, 0x02, 0xFC, 0x1F, 0xF8, 0x02, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x1F,
-    0xFF, 0x00, 0x1F, 0xCB, 0xE0, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xA8, 0x3F,
-    0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xCF, 0xF4, 0x2F, 0xFB, 0xF8, 0x03, 0xFE, 0xFC, 0x00, 0xBF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xFE, 0xFD, 0x00, 0xFF, 0x7F, 0xC0, 0x7F, 0xCF,
-    0xFE, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x1F, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF3,
-    0x40, 0x0F, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x10, 0x00,
-    0x50, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x02, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFE, 0x00, 0x70, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x40, 0xFF,
-    0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x3F, 0xC0, 0x02, 0xFC, 0x3F, 0xE0, 0x02, 0xFC, 0x1F, 0xF8, 0x02,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x04, 0x02, 0xE0, 0x0B, 0x80, 0x7F, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xA8, 0x3F, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xCF, 0xF4,
-    0x2F, 0xFB, 0xF8, 0x03, 0xFE, 0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0,
-    0x02, 0xFE, 0xFD, 0x00, 0xFF, 0x7F, 0xC0, 0x7F, 0xCF, 0xFE, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF3, 0x40, 0x0F, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFD, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0x00, 0x70, 0x2F, 0xF0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40,
-    0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x3F, 0xC0,
-    0x02, 0xFC, 0x3F, 0xE0, 0x02, 0xFC, 0x1F, 0xF8, 0x02, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0xA8, 0x3F, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xCF, 0xF4, 0x2F, 0xFB, 0xF8, 0x03, 0xFE, 0xFC, 0x00,
-    0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xFE, 0xFD, 0x00, 0xFF, 0x7F, 0xC0,
-    0x7F, 0xCF, 0xFE, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x1F, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF3, 0x40, 0x0F, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x06, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFE, 0x00, 0x70, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC, 0x7F,
-    0x80, 0x02, 0xFC, 0x3F, 0xC0, 0x02, 0xFC, 0x3F, 0xE0, 0x02, 0xFC, 0x1F, 0xF8, 0x02, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xA8, 0x3F, 0xFF, 0x7F, 0x3F, 0xFF, 0xFF,
-    0xCF, 0xF4, 0x2F, 0xFB, 0xF8, 0x03, 0xFE, 0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xF0, 0x02, 0xFE, 0xFD, 0x00, 0xFF, 0x7F, 0xC0, 0x7F, 0xCF, 0xFE, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF3, 0x40, 0x0F, 0xF8, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFD, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0xBE, 0x2F, 0x80, 0x07, 0xD0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x57, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F,
-    0x2F, 0xC0, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x03, 0xF8, 0x7F, 0x80, 0x00, 0xFE, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFD,
-    0x1F, 0xF4, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x1F, 0xD0, 0x0F,
-    0xE0, 0x07, 0xF4, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x1F, 0xD0,
-    0x0F, 0xE0, 0x07, 0xF4, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x5F, 0xF9, 0x55, 0x7F, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xF5, 0x55, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x5F, 0xF5, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x2F,
-    0xF4, 0x03, 0xFB, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0x3F, 0xD0, 0xFF, 0x00, 0x7F,
-    0x83, 0xFC, 0x00, 0xFE, 0x0F, 0xE0, 0x03, 0xF8, 0x3F, 0x80, 0x0F, 0xE0, 0xFE, 0x00, 0x3F, 0x83,
-    0xF8, 0x00, 0xFE, 0x0F, 0xE0, 0x03, 0xF8, 0x3F, 0x80, 0x0F, 0xE0, 0xFE, 0x00, 0x3F, 0x80, 0x0B,
-    0x80, 0xB0, 0xFF, 0xFB, 0xCB, 0xEF, 0xFE, 0x2C, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0xFF, 0xFF, 0x02, 0xFF, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0x07,
-    0xE0, 0x3C, 0x7F, 0xFB, 0xE3, 0xEB, 0xFF, 0x0E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00,
-    0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8,
-    0x00, 0x0F, 0xE0, 0x00, 0x2A, 0xAA, 0x9F, 0xFF, 0xF7, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xCF,
-    0xFF, 0xF2, 0xFF, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F,
-    0xFD, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x2A, 0xAA, 0x9F, 0xFF, 0xF7, 0xFF, 0xFC, 0x00, 0x00, 0x02,
-    0xA4, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
-    0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x10,
-    0x00, 0x4B, 0x80, 0x2E, 0x7F, 0xFF, 0xD2, 0xFF, 0xF8, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x2F, 0xFF, 0x40, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x01, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x10, 0x00, 0x4B, 0x80, 0x2E,
-    0x7F, 0xFF, 0xD2, 0xFF, 0xF8, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8,
-    0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x3F, 0xFF, 0xCF,
-    0xFF, 0xF2, 0xFF, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F,
-    0xFD, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x02, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x3F, 0x50, 0x0F,
-    0xFC, 0x00, 0xBD, 0x00, 0x0B, 0xD7, 0xFC, 0xFE, 0x1A, 0x00, 0x02, 0xA4, 0xFE, 0x3F, 0x8F, 0xE3,
-    0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x2E, 0x1F, 0x0F, 0x83,
-    0xF6, 0xBF, 0xC6, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xA0, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0x2F, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x07, 0xFF, 0xD3, 0xFF, 0xFC, 0xFF, 0xFF, 0x2A, 0x4F, 0xE3, 0xF8, 0xFE, 0x3F,
-    0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE0, 0x3F, 0xFF, 0xC0, 0xBF,
-    0x0F, 0xFF, 0xF0, 0x2F, 0xC2, 0xFF, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0x02, 0xFC, 0x03, 0xFC, 0x00,
-    0xBF, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xF0, 0x02, 0xFC, 0x03, 0xFC,
-    0x00, 0xBF, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xF0, 0x02, 0xFC, 0x03,
-    0xFC, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x7F, 0xFD, 0x02, 0xFC,
-    0x3F, 0xFF, 0xC0, 0xBF, 0x0F, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xC7, 0xFC, 0x0B, 0xF4, 0xFE, 0x02, 0xFD, 0x1A,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x06, 0xA0, 0xFE, 0x02, 0xFC, 0x3F, 0x80, 0xBF, 0x0F,
-    0xE0, 0x2F, 0xC3, 0xF8, 0x0B, 0xF0, 0xFE, 0x02, 0xFC, 0x3F, 0x80, 0xBF, 0x0F, 0xE0, 0x2F, 0xC3,
-    0xF8, 0x0B, 0xF0, 0xFE, 0x02, 0xFC, 0x3F, 0x80, 0xBF, 0x0F, 0xE0, 0x2F, 0xC3, 0xF8, 0x0B, 0xF0,
-    0xFE, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xFC,
-    0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0xC0,
-    0x0F, 0xD7, 0xF0, 0x2F, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xFC, 0x07, 0xF2, 0xF8, 0x3E, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x0A, 0x90, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00,
-    0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xD0,
-    0x1F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0xBF,
-    0x4F, 0xF0, 0x0B, 0xF8, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x3F, 0xD0, 0x0F,
-    0xF2, 0xFE, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFE,
-    0xFF, 0x00, 0x3F, 0xD2, 0xFE, 0x00, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xFC, 0x0F, 0xF0, 0x0F,
-    0xF4, 0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x2A, 0x83, 0xF8, 0x03, 0xFC, 0x0F, 0xE0, 0x3F,
-    0xC0, 0x3F, 0x83, 0xFD, 0x00, 0xFE, 0x3F, 0xD0, 0x03, 0xFA, 0xFD, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xE0, 0x7F, 0xC0, 0x3F,
-    0x80, 0xBF, 0x80, 0xFE, 0x00, 0xFF, 0x43, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x2A, 0x40, 0x0A, 0xA0, 0xFE, 0x00, 0xFF, 0x03, 0xF8, 0x0B, 0xF4, 0x0F, 0xE0, 0x7F, 0x40,
-    0x3F, 0x87, 0xF8, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0xFF, 0x4F, 0xF0, 0x03, 0xF8, 0x1F, 0xF0, 0x0F, 0xE0, 0x2F, 0xE0, 0x3F, 0x80,
-    0x3F, 0xD0, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x0B, 0xF4, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80,
-    0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80,
-    0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x90, 0x00, 0x3F, 0x8F,
-    0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3,
-    0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0x00, 0x15, 0x4F, 0xE3, 0xF0, 0xF8, 0x28, 0x00, 0xBF, 0x00,
-    0xBE, 0xFF, 0x00, 0xFD, 0xFF, 0x00, 0xFC, 0xFF, 0x01, 0xF0, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFC, 0x3F, 0x8B, 0xF3, 0xF8, 0xBD, 0x3F, 0x8F, 0xC3, 0xF8, 0xF0, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8,
-    0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x03, 0xF0, 0xFF, 0x07, 0xF8, 0xFF,
-    0x07, 0xF4, 0xFF, 0x01, 0x90, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F,
-    0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x9F,
-    0xC3, 0xFA, 0xFD, 0x3F, 0xAF, 0xD3, 0xF8, 0xA4, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xF0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80,
-    0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x03, 0xFF, 0x40, 0xFF, 0xE0,
-    0xFF, 0xD0, 0xFF, 0xE0, 0x2F, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00,
-    0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x07, 0xF3, 0xFF, 0xC0, 0x01, 0xFC, 0xFF, 0xF4, 0x00, 0x7F, 0x3F, 0xFF, 0x00, 0x1F, 0xCF, 0xFF,
-    0xE0, 0x07, 0xF3, 0xF7, 0xFC, 0x01, 0xFC, 0xFE, 0x7F, 0x80, 0x7F, 0x3F, 0x8F, 0xF4, 0x1F, 0xCF,
-    0xE0, 0xFF, 0x07, 0xF3, 0xF8, 0x2F, 0xD1, 0xFC, 0xFE, 0x03, 0xFC, 0x7F, 0x3F, 0x80, 0x7F, 0x8F,
-    0xCF, 0xE0, 0x0F, 0xF7, 0xF3, 0xF8, 0x01, 0xFF, 0xFC, 0xFE, 0x00, 0x2F, 0xFF, 0x3F, 0x80, 0x03,
-    0xFF, 0xCF, 0xE0, 0x00, 0xBF, 0xF3, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x07, 0xF8, 0x03, 0xF3, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0x47, 0xFD, 0x3F, 0xC0, 0x2F,
-    0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8,
-    0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD,
-    0xBF, 0xC0, 0x00, 0x7F, 0x3F, 0xFC, 0x00, 0x1F, 0xCF, 0xFF, 0x40, 0x07, 0xF3, 0xFF, 0xF0, 0x01,
-    0xFC, 0xFF, 0xFE, 0x00, 0x7F, 0x3F, 0x7F, 0xC0, 0x1F, 0xCF, 0xE7, 0xF8, 0x07, 0xF3, 0xF8, 0xFF,
-    0x41, 0xFC, 0xFE, 0x0F, 0xF0, 0x7F, 0x3F, 0x82, 0xFD, 0x1F, 0xCF, 0xE0, 0x3F, 0xC7, 0xF3, 0xF8,
-    0x07, 0xF8, 0xFC, 0xFE, 0x00, 0xFF, 0x7F, 0x3F, 0x80, 0x1F, 0xFF, 0xCF, 0xE0, 0x02, 0xFF, 0xF3,
-    0xF8, 0x00, 0x3F, 0xFC, 0xFE, 0x00, 0x0B, 0xFF, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x2A, 0x07, 0xF8, 0x03, 0xF3, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0xC3, 0xFF, 0x47, 0xFD, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8,
-    0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD,
-    0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x02, 0xF4, 0x00, 0x0B, 0xE7, 0xF4, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF3, 0xFF, 0xC0, 0x01, 0xFC, 0xFF, 0xF4,
-    0x00, 0x7F, 0x3F, 0xFF, 0x00, 0x1F, 0xCF, 0xFF, 0xE0, 0x07, 0xF3, 0xF7, 0xFC, 0x01, 0xFC, 0xFE,
-    0x7F, 0x80, 0x7F, 0x3F, 0x8F, 0xF4, 0x1F, 0xCF, 0xE0, 0xFF, 0x07, 0xF3, 0xF8, 0x2F, 0xD1, 0xFC,
-    0xFE, 0x03, 0xFC, 0x7F, 0x3F, 0x80, 0x7F, 0x8F, 0xCF, 0xE0, 0x0F, 0xF7, 0xF3, 0xF8, 0x01, 0xFF,
-    0xFC, 0xFE, 0x00, 0x2F, 0xFF, 0x3F, 0x80, 0x03, 0xFF, 0xCF, 0xE0, 0x00, 0xBF, 0xF3, 0xF8, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x02, 0xFD, 0xFD, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x07, 0xF8, 0x03, 0xF3, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0x47, 0xFD, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3,
-    0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01,
-    0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x4A, 0x81, 0xFE, 0x40,
-    0xFC, 0x3F, 0x7F, 0xFF, 0x41, 0x40, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x47, 0xFD, 0x00, 0x0F,
-    0xF0, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0xBF, 0xD0,
-    0x00, 0x7F, 0x3F, 0xFC, 0x00, 0x1F, 0xCF, 0xFF, 0x80, 0x07, 0xF3, 0xFF, 0xF4, 0x01, 0xFC, 0xFF,
-    0xFF, 0x00, 0x7F, 0x3F, 0x7F, 0xF0, 0x1F, 0xCF, 0xE3, 0xFE, 0x07, 0xF3, 0xF8, 0x7F, 0xC1, 0xFC,
-    0xFE, 0x0B, 0xFC, 0x7F, 0x3F, 0x80, 0xFF, 0x8F, 0xCF, 0xE0, 0x1F, 0xFB, 0xF3, 0xF8, 0x02, 0xFF,
-    0xFC, 0xFE, 0x00, 0x3F, 0xFF, 0x3F, 0x80, 0x07, 0xFF, 0xCF, 0xE0, 0x00, 0xBF, 0xF3, 0xF8, 0x00,
-    0x0F, 0xFC, 0xFE, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0xEB, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x0B, 0xF8, 0x03, 0xF3, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0x47, 0xFD, 0x3F, 0xC0, 0x1F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD,
-    0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80,
-    0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x2A, 0xAA, 0x80, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0xE0,
-    0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x03, 0xFD,
-    0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00,
-    0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40,
-    0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB,
-    0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x0B, 0x80, 0x2F, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x80,
-    0x7F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xCB,
-    0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00,
-    0x2F, 0xD7, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B, 0xF8, 0x1F,
-    0xF8, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0xB8, 0x02, 0xE0, 0x07, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD,
-    0xFF, 0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0,
-    0x7F, 0xC2, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x0F, 0xC3,
-    0xE0, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0xE0, 0x00,
-    0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x03, 0xFD, 0xBF,
-    0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x03,
-    0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xE0, 0x07, 0xF2, 0xFC, 0x00, 0xFC, 0x7E, 0x00, 0x2E,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF, 0xF0,
-    0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF, 0xF4,
-    0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xF8, 0x07, 0xFD, 0x55, 0x43, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x03, 0xFF, 0xFF, 0xDB, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFD, 0xBF, 0x40, 0x03, 0xFF, 0xFF, 0xD7, 0xF4, 0x00, 0x3F, 0xD5, 0x54, 0x7F, 0x80, 0x03,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x40,
-    0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x1B, 0xF8, 0x00, 0x2F,
-    0xFF, 0xF7, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xF4, 0x2F, 0xFD, 0x03, 0xFC,
-    0xBF, 0x40, 0x3F, 0xE0, 0x07, 0xF2, 0xFC, 0x00, 0xBF, 0x95, 0x5F, 0xDF, 0xF0, 0x01, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xC0, 0x07, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0xFF,
-    0x80, 0x00, 0x03, 0xFC, 0x07, 0xFF, 0x40, 0x01, 0x0B, 0xFF, 0xFF, 0xFF, 0xAA, 0xF8, 0x0F, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0x80, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFC, 0x07, 0xFD, 0x0F, 0xF0, 0x0B, 0xF8, 0x3F, 0xC0, 0x1F, 0xE0, 0xFF, 0x00, 0x7F,
-    0x43, 0xFC, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFC, 0x2F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x80, 0xFF, 0x00, 0xFF, 0x03, 0xFC,
-    0x01, 0xFF, 0x0F, 0xF0, 0x03, 0xFD, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x03, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x7E, 0x0F, 0xCB, 0xF8,
-    0x3F, 0xBF, 0xE0, 0xFF, 0xFA, 0x43, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00,
-    0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0,
-    0x00, 0xBF, 0xFE, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xC0, 0x7F, 0xD0,
-    0xFF, 0x00, 0xBF, 0x83, 0xFC, 0x01, 0xFE, 0x0F, 0xF0, 0x07, 0xF4, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0xFF, 0x03,
-    0xFC, 0x03, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F,
-    0xD3, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x2A, 0x07, 0xE3, 0xF2, 0xFE,
-    0x3F, 0xBF, 0xE3, 0xFF, 0xE9, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F,
-    0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x02, 0xF4, 0x00, 0xBF, 0x3F, 0x80, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xFC,
-    0x07, 0xFD, 0x0F, 0xF0, 0x0B, 0xF8, 0x3F, 0xC0, 0x1F, 0xE0, 0xFF, 0x00, 0x7F, 0x43, 0xFC, 0x03,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFC, 0x2F, 0xC0,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x80, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x01, 0xFF, 0x0F,
-    0xF0, 0x03, 0xFD, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xD2, 0xFC, 0xFE, 0x02,
-    0xFF, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x7E, 0x0F, 0xCB, 0xF8, 0x3F, 0xBF, 0xE0,
-    0xFF, 0xFA, 0x43, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBE, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0x80, 0x68, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x02, 0xFE, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x03,
-    0xF8, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x0F, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xF3, 0xFC, 0x01, 0x4F, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x3F, 0xFF, 0x40, 0x2F, 0xFF, 0x80,
-    0x07, 0xFF, 0x40, 0x01, 0xFD, 0x40, 0x03, 0xF7, 0xFA, 0xBF, 0xCF, 0xFF, 0xFE, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x0F, 0xD7, 0xF0, 0x2E,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0x80,
-    0x68, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x80,
-    0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xF4,
-    0x02, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xF4, 0x0F, 0xD3, 0xF4, 0xBC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x6F,
-    0xE4, 0x0F, 0xFF, 0xFC, 0xBF, 0xFF, 0xF3, 0xFC, 0x01, 0x4F, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x3F,
-    0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x01, 0xFD, 0x40, 0x03, 0xF7, 0xFA, 0xBF, 0xCF,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0x80, 0x68, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x02, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF,
-    0x80, 0x00, 0xB8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x40, 0x03, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0x06, 0xFE, 0x40, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x3F, 0xC0, 0x14, 0xFF, 0x40,
-    0x02, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0xD4, 0x00,
-    0x3F, 0x7F, 0xAB, 0xFC, 0xFF, 0xFF, 0xE1, 0xFF, 0xFD, 0x00, 0x1F, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xFD,
-    0x0F, 0xE7, 0xF4, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0x80, 0x68, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x02, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF4, 0x6F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xD2, 0xFC, 0xFE, 0x02, 0xFF, 0xE0,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x0F, 0xFF, 0xFC, 0xBF, 0xFF, 0xF3, 0xFC, 0x01,
-    0x4F, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x3F, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x01,
-    0xFD, 0x40, 0x03, 0xF7, 0xFA, 0xBF, 0xCF, 0xFF, 0xFE, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x55, 0x00, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFE, 0xA8, 0x3F, 0xFF,
-    0xF1, 0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF,
-    0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x00,
-    0xFF, 0xF0, 0x00, 0x7C, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0x80,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x02, 0xF4, 0x02, 0xFC, 0xFE, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x0A,
-    0x00, 0xBC, 0x00, 0xBC, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xEA, 0x80, 0x03, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x55,
-    0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x57, 0xFD, 0x50, 0x0B, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFE, 0xA8, 0x3F, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xC0, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xFA, 0x80, 0xFF, 0xFF, 0x43, 0xFF, 0xFD, 0x02,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x0E, 0x00, 0x2F, 0xFE, 0xF8, 0x00, 0xFA, 0xFF, 0xC0, 0x03, 0x80,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xEB, 0xF4, 0x00, 0x7F, 0x9F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B,
-    0x00, 0x3F, 0xFE, 0xF0, 0x0B, 0xEF, 0xFE, 0x00, 0xB0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xA4,
-    0x00, 0xA9, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD,
-    0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x3F, 0x80,
-    0x2F, 0xD3, 0xFC, 0x07, 0xFD, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFE, 0xFD, 0x07, 0xFF, 0x8B, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0xA9, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0x00, 0x03, 0xFA, 0xFD, 0x00, 0x1F, 0xE7, 0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x3F, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F,
-    0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F,
-    0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01,
-    0x00, 0x0F, 0x00, 0x3D, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFE, 0x7F, 0xD0, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x7C,
-    0x01, 0xF0, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80,
-    0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3,
-    0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0x0F, 0x00,
-    0x00, 0x3C, 0x3C, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0xFE, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFE,
-    0xBF, 0x40, 0x07, 0xF9, 0xFF, 0x40, 0x7F, 0xC3, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xF0,
-    0xF0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA4, 0x00, 0xA9, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01,
-    0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x3F,
-    0x80, 0x2F, 0xD3, 0xFC, 0x07, 0xFD, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFE, 0xFD, 0x07, 0xFF, 0x8B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x3F, 0x8F, 0xD0, 0x02,
-    0xF4, 0xBD, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xBF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFE, 0x7F,
-    0xD0, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x03, 0xF5, 0xFC, 0x00, 0xFC, 0x3F, 0x00,
-    0x1E, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80,
-    0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7,
-    0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFB,
-    0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xFD, 0x00, 0x1F,
-    0xE7, 0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F,
-    0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8,
-    0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0x40,
-    0x1F, 0xF4, 0x00, 0xFE, 0x0F, 0xE0, 0x0B, 0xFE, 0x00, 0x7F, 0x43, 0xF8, 0x03, 0xFF, 0xC0, 0x2F,
-    0xC0, 0xBF, 0x00, 0xFE, 0xF4, 0x0F, 0xF0, 0x1F, 0xC0, 0x7E, 0xBE, 0x03, 0xF8, 0x03, 0xF4, 0x2F,
-    0x9F, 0xC1, 0xFD, 0x00, 0xFE, 0x0F, 0xD3, 0xF0, 0xBF, 0x00, 0x2F, 0xC3, 0xF0, 0xFD, 0x2F, 0xC0,
-    0x07, 0xF1, 0xFC, 0x2F, 0x8F, 0xE0, 0x00, 0xFD, 0xBE, 0x07, 0xF3, 0xF4, 0x00, 0x3F, 0xBF, 0x40,
-    0xFD, 0xFC, 0x00, 0x0B, 0xEF, 0xC0, 0x3F, 0xBF, 0x00, 0x01, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00,
-    0x3F, 0xF4, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x00, 0x6A, 0x80, 0x1A, 0x87, 0xF4, 0x0B, 0xFC, 0x03, 0xFC, 0x3F, 0x80,
-    0xFF, 0xD0, 0x3F, 0x83, 0xFC, 0x0F, 0xFE, 0x07, 0xF0, 0x2F, 0xC1, 0xF7, 0xF0, 0xBF, 0x01, 0xFD,
-    0x2F, 0x2F, 0x0F, 0xE0, 0x0F, 0xE3, 0xF1, 0xF4, 0xFD, 0x00, 0xBF, 0x3E, 0x1F, 0x9F, 0xC0, 0x07,
-    0xF7, 0xD0, 0xFA, 0xFC, 0x00, 0x3F, 0xBC, 0x0F, 0xEF, 0x80, 0x03, 0xFF, 0xC0, 0xBF, 0xF0, 0x00,
-    0x2F, 0xF8, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFC, 0x7F, 0x00,
-    0x03, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC,
-    0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0,
-    0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFD, 0x3F, 0x00, 0x0B,
-    0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x6A, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0x80,
-    0x1F, 0xD0, 0xBF, 0x00, 0xBF, 0x01, 0xFD, 0x03, 0xF8, 0x03, 0xF8, 0x1F, 0xD0, 0x0B, 0xF0, 0xBF,
-    0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0xFF, 0xF4, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xB4, 0x2E, 0x00, 0x02, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x50,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x2F, 0xD0,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x02, 0xFD,
-    0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1, 0x55, 0x57,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1, 0x55, 0x57,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x02, 0xF4, 0x02, 0xFC, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1, 0x55, 0x57,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x0B, 0xF3, 0xF8, 0x02, 0xFF, 0xE0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0xC3, 0xFF, 0xF4, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8,
-    0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x7F,
-    0x40, 0x7F, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xFC, 0x03, 0xF1,
-    0xFC, 0x3E, 0x00, 0xF8, 0x0B, 0xD0, 0x74, 0xFF, 0xFB, 0xD7, 0xEF, 0xFF, 0x1D, 0x06, 0xE0, 0x2A,
-    0xAA, 0x83, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC,
-    0x2A, 0xAA, 0xA8, 0x10, 0x00, 0x51, 0xF0, 0x07, 0xC3, 0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x02, 0xF9,
-    0x00, 0x00, 0x02, 0xF8, 0x3F, 0xC3, 0xFC, 0x0A, 0x00, 0x2D, 0x07, 0x87, 0xF0, 0xFD, 0x7F, 0x0F,
-    0xC1, 0x40, 0x14, 0x6A, 0x41, 0xFF, 0x81, 0x7F, 0x00, 0xFC, 0x1F, 0xD0, 0x7C, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0xFF, 0xD3, 0x83, 0xCE, 0x0F, 0x3F, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x8F,
-    0xE2, 0xF8, 0xFE, 0x1F, 0x87, 0xE0, 0xB4, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x0F,
-    0xE7, 0xF4, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x14, 0x7D, 0x7D, 0x7D, 0x7D, 0x00, 0x14, 0x14,
-    0x7C, 0x3D, 0x7C, 0x3D, 0x7C, 0x3D, 0x7C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xD0,
-    0x0F, 0xC7, 0xF0, 0x03, 0xE1, 0xF8, 0x00, 0xF0, 0x7C, 0x00, 0x40, 0x00, 0x1F, 0x40, 0x12, 0xF4,
-    0x47, 0x8A, 0x2D, 0x3E, 0x5B, 0xC1, 0xFF, 0xF4, 0x06, 0xF8, 0x00, 0x00, 0x10, 0x00, 0xBF, 0xF0,
-    0x3F, 0xFF, 0xC7, 0xE5, 0x7E, 0xB4, 0x01, 0xE0, 0x07, 0xD0, 0xFC, 0x0F, 0xC2, 0xF8, 0x3F, 0x87,
-    0xF4, 0x15, 0x00, 0x0F, 0xD1, 0xFC, 0x2F, 0xC3, 0xF4, 0x3F, 0x03, 0xE0, 0x14, 0x00, 0x7F, 0x03,
-    0xF4, 0x3F, 0x81, 0xFC, 0x0F, 0xC0, 0xBD, 0x01, 0x40, 0x0F, 0xD1, 0xFC, 0x2F, 0xC3, 0xF4, 0x3F,
-    0x03, 0xE0, 0x14, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0x40, 0x07, 0xF0, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x2F, 0x80, 0x7D, 0x00, 0x00, 0x40, 0x1C, 0x2B, 0xC3, 0xFC,
-    0x01, 0xC0, 0x04, 0x10, 0x03, 0x40, 0x3E, 0x83, 0xFC, 0x34, 0x01, 0x00, 0xBF, 0xF9, 0xAA, 0xE0,
-    0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0xF8, 0x1F, 0xD0, 0xFF, 0x0F, 0xF4, 0x7F, 0x40,
-    0x40, 0x00, 0x09, 0x3E, 0x78, 0xB4, 0x3D, 0x1D, 0x0A, 0x00, 0xF0, 0x1F, 0x4B, 0xFE, 0x00, 0x00,
-    0xBF, 0xE6, 0xF9, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x6F, 0x9B, 0xFE, 0x0F, 0x00,
-    0xA0, 0x15, 0x4B, 0xFE, 0x00, 0x00, 0x01, 0x50, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF6, 0xFF, 0xBF,
-    0xD7, 0xF4, 0x54, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xF9, 0x7F, 0xE1, 0xFD, 0x04, 0x1F,
-    0xDB, 0xF8, 0xFD, 0x04, 0x00, 0x2D, 0x07, 0x87, 0xF0, 0xFD, 0x7F, 0x0F, 0xC1, 0x40, 0x14, 0x0B,
-    0xD0, 0xFF, 0xD3, 0x83, 0xCE, 0x0F, 0x3F, 0xF4, 0x2F, 0x40, 0x05, 0x41, 0xFC, 0x2F, 0x43, 0xF0,
-    0x28, 0x00, 0x1E, 0x02, 0xF8, 0x07, 0xE0, 0x3F, 0xFF, 0xDB, 0xF4, 0x01, 0x00, 0xF4, 0x3D, 0x07,
-    0xC0, 0x7E, 0x53, 0xFE, 0x0B, 0x90, 0x14, 0x7D, 0x7D, 0x7D, 0x7D, 0x00, 0x7F, 0xFF, 0xD7, 0xEA,
-    0xBD, 0x70, 0x00, 0xD7, 0x00, 0x0D, 0x10, 0x00, 0x40, 0x50, 0x50, 0x5B, 0x0F, 0x0E, 0x3F, 0xFF,
-    0xC0, 0x50, 0x50, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xD2, 0xF9, 0xFD, 0x03, 0xFF, 0xD0, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xFC, 0x03, 0xF5, 0xFC, 0x2E, 0x00, 0xF8, 0x10,
-    0x00, 0x4B, 0x80, 0x2E, 0x7F, 0xFF, 0xD2, 0xFF, 0xF8, 0x06, 0xF9, 0x00, 0x00, 0x10, 0x00, 0xBF,
-    0xF0, 0x3F, 0xFF, 0xC7, 0xE5, 0x7E, 0xB4, 0x01, 0xE0, 0x07, 0xE0, 0x3C, 0x1F, 0xFE, 0xFC, 0x3F,
-    0xBF, 0xF4, 0x3C, 0x0B, 0x90, 0x2A, 0xAA, 0x83, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0xBF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xE1, 0x55, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFA, 0xAA, 0xAA, 0x90, 0x0B, 0x80, 0xB0, 0xFF, 0xFB, 0xCB, 0xEF, 0xFE, 0x2C, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x3F, 0xC0, 0x2F, 0xF4, 0x1F, 0xF8, 0x03, 0xFC, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00,
-    0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x60, 0xBC, 0x2D, 0x1D, 0x7C, 0x74, 0x70, 0x00, 0xD7, 0x00, 0x0D, 0x70, 0x00, 0xD7,
-    0xFF, 0xFD, 0x15, 0x55, 0x40, 0x15, 0x55, 0x4B, 0xFF, 0xFE, 0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xBA,
-    0xAA, 0xEA, 0xAA, 0xAA, 0x05, 0x05, 0x03, 0xFF, 0xFC, 0xB0, 0xF0, 0xE5, 0x05, 0x05, 0x00, 0x07,
-    0x5D, 0x2F, 0x81, 0xF4, 0x7A, 0xD1, 0x04, 0x09, 0x7D, 0xB0, 0x38, 0x2D, 0x0E, 0x7C, 0x50, 0x55,
-    0x55, 0x53, 0xFF, 0xFF, 0xE1, 0x55, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0x90,
-    0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xFD, 0x0F, 0xF0,
-    0x2F, 0xC0, 0x7E, 0x00, 0x1F, 0x80, 0xB0, 0xFF, 0xFB, 0xCB, 0xEF, 0xFD, 0x3C, 0x07, 0xD0, 0x15,
-    0x1F, 0xD1, 0xF8, 0x3D, 0x0E, 0x00, 0x00, 0x00, 0x05, 0x50, 0x01, 0xE1, 0xFE, 0x28, 0x3F, 0x1F,
-    0xCB, 0xE3, 0xF2, 0xF4, 0xBE, 0x04, 0x3E, 0x01, 0x40, 0xA8, 0x3F, 0x0F, 0xD3, 0xFD, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x79, 0x55, 0x6D, 0x70, 0x00, 0x0D, 0x70, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xE1, 0x55, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFA,
-    0xAA, 0xAA, 0x90, 0x14, 0x14, 0x7C, 0x3D, 0x7C, 0x3D, 0x7C, 0x3D, 0x7C, 0x3D, 0x00, 0x00, 0x2A,
-    0x87, 0xFD, 0x01, 0xD0, 0x1D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x13, 0x84, 0x2F, 0xF5, 0xD7, 0xAF,
-    0xFC, 0x72, 0xEE, 0x00, 0x14, 0x00, 0x00, 0xA0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x55, 0x09,
-    0x3F, 0xE6, 0xD7, 0xFF, 0xFC, 0xB0, 0x2F, 0x40, 0x0F, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x82, 0xFF, 0x7C, 0x39, 0xBF, 0x81, 0x00, 0x40, 0x1F, 0xD1, 0xD3, 0xFF,
-    0xFC, 0x34, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x1F, 0xAF, 0x43, 0xFF, 0xFC, 0x0A, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0xF0, 0x0F, 0x00, 0xF0, 0xFF, 0x03, 0xFC, 0x0F,
-    0xFE, 0x90, 0x1A, 0x40, 0x6B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x5A, 0x50, 0x07, 0x00, 0x15,
-    0x05, 0x40, 0x00, 0x06, 0x00, 0x09, 0x00, 0x01, 0x40, 0x00, 0x14, 0x0D, 0x14, 0x00, 0x01, 0x47,
-    0xD2, 0x00, 0x00, 0x08, 0x7D, 0x20, 0x00, 0x00, 0x87, 0xD0, 0x00, 0x00, 0x04, 0x70, 0x28, 0x00,
-    0x01, 0x80, 0x00, 0x50, 0x00, 0x50, 0x00, 0x05, 0x40, 0x15, 0x00, 0xD0, 0x09, 0xA6, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x07, 0xE5, 0x01, 0x54, 0x05, 0xBF, 0xF0, 0x3F, 0xC0, 0xFF, 0x20, 0x0F, 0x80,
-    0x7C, 0x7F, 0x38, 0x00, 0x00, 0x00, 0x1E, 0x3E, 0x78, 0x3C, 0x2E, 0x05, 0x00, 0x50, 0x00, 0xBF,
-    0xE0, 0x2F, 0xFF, 0x83, 0xC0, 0x3C, 0x75, 0xF5, 0xD0, 0x2F, 0x80, 0x00, 0xB0, 0x00, 0x00, 0x03,
-    0x5C, 0x2F, 0xC1, 0xF4, 0x3E, 0xC0, 0x04, 0x01, 0xCB, 0xE3, 0xD0, 0xBE, 0x01, 0xC0, 0x34, 0x0B,
-    0xD0, 0x7C, 0xBE, 0x34, 0x00, 0xA0, 0x06, 0x07, 0xE0, 0xF8, 0x0F, 0x8E, 0xC7, 0xE2, 0xCD, 0xA0,
-    0x34, 0xA0, 0x00, 0x78, 0x3E, 0x0F, 0x2E, 0x7C, 0x20, 0x00, 0x0F, 0xCB, 0xF6, 0xFD, 0x19, 0x00,
-    0x00, 0x00, 0xF0, 0x7F, 0xD6, 0xF9, 0x2F, 0x81, 0x54, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0xB0, 0xF0,
-    0xEE, 0x0A, 0x0B, 0xB5, 0xF5, 0xE2, 0xF5, 0xF8, 0x14, 0x03, 0x40, 0x3F, 0xC1, 0x6C, 0x02, 0x80,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x0F, 0xFE, 0x96, 0xBF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x3F,
-    0x80, 0x00, 0x02, 0xFC, 0x0F, 0xFE, 0x96, 0xBF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1B,
-    0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x6A, 0xAA, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0xFD, 0x6A,
-    0xAA, 0xAA, 0xA9, 0x0B, 0xFF, 0x94, 0x00, 0x1F, 0x3F, 0xFF, 0xFF, 0xFA, 0xFE, 0xBE, 0x6A, 0xFF,
-    0xFF, 0xFC, 0xB0, 0x00, 0x05, 0xAF, 0x90, 0x00, 0x06, 0xFF, 0xA4, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xAA, 0xFF, 0xF0, 0x3F, 0x90, 0x00, 0x07, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x06,
-    0xAA, 0xAA, 0xAA, 0xAF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xF2, 0xFF, 0xB4, 0xFB, 0xAF, 0x19, 0x10,
-    0x00, 0x00, 0xBF, 0x47, 0x4B, 0x2F, 0xFC, 0x74, 0x00, 0xFA, 0x80, 0x69, 0x00, 0x02, 0xC1, 0x2C,
-    0xB2, 0xCB, 0x2C, 0x60, 0x00, 0x00, 0xBF, 0x07, 0x4F, 0x2C, 0x2C, 0xB0, 0xB0, 0xFB, 0x80, 0xA4,
-    0x00, 0xB0, 0xB2, 0xC2, 0xCB, 0x0B, 0x2C, 0x3C, 0x7E, 0xF0, 0x64, 0x80, 0x00, 0x00, 0xFE, 0x3D,
-    0x03, 0x80, 0x38, 0x02, 0xEA, 0x06, 0x80, 0x00, 0x00, 0x0B, 0x00, 0xB3, 0xFF, 0xB4, 0xFF, 0x0B,
-    0xB0, 0xB7, 0xEF, 0x19, 0x20, 0x00, 0x02, 0xC0, 0x0B, 0x00, 0x2E, 0xF8, 0xB8, 0xF2, 0xC2, 0xCB,
-    0x0B, 0x2C, 0x2C, 0x60, 0x60, 0x00, 0x00, 0x07, 0xBE, 0xBD, 0x78, 0xF8, 0xF7, 0x4B, 0x0F, 0x74,
-    0xB0, 0xF7, 0x4B, 0x0F, 0x20, 0x60, 0x50, 0x00, 0x1D, 0xE7, 0xD1, 0xD0, 0x74, 0x1D, 0x02, 0x00,
-    0x00, 0x0A, 0x0B, 0xF4, 0xE0, 0x38, 0x0E, 0x03, 0xE4, 0x28, 0xB0, 0x75, 0xD3, 0xC3, 0x8D, 0x07,
-    0xB0, 0x0F, 0x80, 0x18, 0x00, 0x2D, 0x3C, 0x0F, 0xB0, 0x03, 0xE0, 0x0B, 0xF0, 0x1E, 0x38, 0x14,
-    0x18, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0x55, 0x53,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xFE, 0x1A, 0x02, 0x80, 0xFE, 0x2F, 0xC3, 0xF8, 0xBF, 0x06, 0x80, 0xA0, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xD5, 0x54, 0xFF,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x00, 0x05, 0x6F, 0xE5, 0x54, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xF8, 0x03, 0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x0F,
-    0xF0, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x01, 0xFF, 0x00, 0x1F, 0xD1, 0xFF, 0xF4, 0x00,
-    0x7F, 0x4B, 0xFF, 0xC0, 0x01, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF, 0x55, 0x54, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x1F, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x01, 0xD0, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0x02, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xE5, 0x55, 0x40, 0xBF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0xBF, 0x80, 0x78,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x03,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0xE4, 0x02,
-    0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x04, 0x7D, 0x3E, 0xBE, 0x7F, 0x7D, 0x3E, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,
-    0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0xFF, 0xFD, 0x3F, 0xFE,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF9, 0x57, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xFA, 0xA4,
-    0x00, 0x03, 0xF4, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0x00,
-    0x3F, 0xD6, 0xFF, 0xC0, 0x1F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0xFE,
-    0x02, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x7F, 0x80, 0x0F,
-    0xF0, 0x2F, 0xF7, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xF0, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0x07, 0xF8, 0x07, 0xFC, 0xFF, 0x00,
-    0x07, 0xF8, 0x02, 0xFD, 0xFF, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0xFF, 0x00, 0x07, 0xF8, 0x02, 0xFD,
-    0xFF, 0x00, 0x07, 0xF8, 0x1B, 0xFC, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xE0, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0x5B, 0xF9, 0x54, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x07, 0xFA, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xD0, 0x7F, 0xE0, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x7F,
-    0x40, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0xFF,
-    0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0xBF,
-    0x40, 0xFF, 0x01, 0xFE, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0xFF, 0x07, 0xFC,
-    0x00, 0xFF, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x3F,
-    0xE0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x1F, 0xFD, 0xFF, 0x00, 0x3F,
-    0xFD, 0xFF, 0x00, 0x7F, 0xFD, 0xFF, 0x00, 0xFE, 0xFD, 0xFF, 0x02, 0xFD, 0xFD, 0xFF, 0x03, 0xF5,
-    0xFD, 0xFF, 0x0B, 0xF1, 0xFD, 0xFF, 0x0F, 0xD1, 0xFD, 0xFF, 0x2F, 0xC1, 0xFD, 0xFF, 0x3F, 0x41,
-    0xFD, 0xFF, 0xBF, 0x01, 0xFD, 0xFF, 0xFC, 0x01, 0xFD, 0xFF, 0xF8, 0x01, 0xFD, 0xFF, 0xF0, 0x01,
-    0xFD, 0xFF, 0xE0, 0x01, 0xFD, 0xFF, 0xC0, 0x01, 0xFD, 0x00, 0x54, 0x05, 0x40, 0x00, 0x7F, 0x03,
-    0xF4, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x02, 0xFC, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x1F, 0xD0, 0x2F, 0xC0, 0x03, 0xFC, 0x0F, 0xD0,
-    0x00, 0x7F, 0x4B, 0xF0, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2,
-    0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F,
-    0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xF5, 0x55, 0x40, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0xFF, 0x01, 0xFF, 0xCF, 0xF0,
-    0x03, 0xFC, 0xFF, 0x00, 0x3F, 0xCF, 0xF0, 0x03, 0xFC, 0xFF, 0x01, 0xFF, 0x8F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0x4F, 0xF0, 0x1F, 0xFC, 0xFF, 0x00, 0x3F, 0xCF, 0xF0, 0x03, 0xFC, 0xFF, 0x00, 0x7F, 0x8F,
-    0xFA, 0xBF, 0xF0, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xBF, 0xCF, 0xF0, 0x03,
-    0xFD, 0xFF, 0x00, 0x2F, 0xDF, 0xF0, 0x02, 0xFD, 0xFF, 0x00, 0xBF, 0xCF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x40, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF,
-    0x55, 0x54, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x55, 0x7F, 0xC0,
-    0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00,
-    0xBF, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
-    0x00, 0x3F, 0xC0, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x02, 0xFC,
-    0xFF, 0x00, 0x00, 0x02, 0xFC, 0xAA, 0x00, 0x00, 0x01, 0xA8, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xBF, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF5, 0x55, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE0, 0x3F, 0xC0, 0x07, 0xF4,
-    0x00, 0xFE, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0xBF, 0x40, 0xBF, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x0F,
-    0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0x01, 0xFE, 0x07, 0xF4, 0x2F, 0xD0, 0x00, 0x2F, 0xC1, 0xFD, 0x1F,
-    0xE0, 0x00, 0x03, 0xFC, 0x7F, 0x4F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0xBF, 0x9F, 0xF0,
-    0x00, 0x02, 0xFE, 0x1F, 0xD2, 0xFE, 0x00, 0x01, 0xFF, 0x07, 0xF4, 0x3F, 0xC0, 0x00, 0xFF, 0x41,
-    0xFD, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x7F, 0x40, 0xFF, 0x40, 0x3F, 0xC0, 0x1F, 0xD0, 0x0F, 0xF0,
-    0x3F, 0xD0, 0x07, 0xF4, 0x02, 0xFF, 0x1F, 0xF0, 0x01, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF8, 0x39, 0x02, 0xFF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x06, 0xBF, 0xF8, 0x02, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0x80, 0x05, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF6, 0x40, 0x07,
-    0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x07, 0xFD, 0xFF, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x1F, 0xFD, 0xFF, 0x00, 0x3F, 0xFD, 0xFF, 0x00,
-    0x7F, 0xFD, 0xFF, 0x00, 0xFE, 0xFD, 0xFF, 0x02, 0xFD, 0xFD, 0xFF, 0x03, 0xF5, 0xFD, 0xFF, 0x0B,
-    0xF1, 0xFD, 0xFF, 0x0F, 0xD1, 0xFD, 0xFF, 0x2F, 0xC1, 0xFD, 0xFF, 0x3F, 0x41, 0xFD, 0xFF, 0xBF,
-    0x01, 0xFD, 0xFF, 0xFC, 0x01, 0xFD, 0xFF, 0xF8, 0x01, 0xFD, 0xFF, 0xF0, 0x01, 0xFD, 0xFF, 0xE0,
-    0x01, 0xFD, 0xFF, 0xC0, 0x01, 0xFD, 0x01, 0x50, 0x05, 0x40, 0x03, 0xF4, 0x2F, 0x80, 0x02, 0xFE,
-    0xBF, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x07, 0xFD, 0xFF, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x1F, 0xFD, 0xFF, 0x00, 0x3F, 0xFD, 0xFF, 0x00,
-    0x7F, 0xFD, 0xFF, 0x00, 0xFE, 0xFD, 0xFF, 0x02, 0xFD, 0xFD, 0xFF, 0x03, 0xF5, 0xFD, 0xFF, 0x0B,
-    0xF1, 0xFD, 0xFF, 0x0F, 0xD1, 0xFD, 0xFF, 0x2F, 0xC1, 0xFD, 0xFF, 0x3F, 0x41, 0xFD, 0xFF, 0xBF,
-    0x01, 0xFD, 0xFF, 0xFC, 0x01, 0xFD, 0xFF, 0xF8, 0x01, 0xFD, 0xFF, 0xF0, 0x01, 0xFD, 0xFF, 0xE0,
-    0x01, 0xFD, 0xFF, 0xC0, 0x01, 0xFD, 0xBF, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x1F, 0xE0, 0xFF, 0x00,
-    0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x40, 0xFF, 0x01, 0xFE, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0xFF, 0x0B,
-    0xF4, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0x5F,
-    0xF0, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0xFF, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0x7F, 0xC0, 0xFF, 0x00, 0x3F, 0xE0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xF9, 0x57, 0xFC, 0x00,
-    0xFD, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x0F, 0xD0, 0x0B, 0xF0, 0x07, 0xF0, 0x02, 0xFC,
-    0x01, 0xFC, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x0B, 0xF0, 0x0B, 0xF0, 0x02,
-    0xFC, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0xBF, 0x80, 0x0B, 0xF3, 0xFF, 0xD0,
-    0x02, 0xFC, 0xFF, 0xF0, 0x00, 0xBF, 0x3F, 0xE0, 0x00, 0x2F, 0xC0, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x0F, 0xFD, 0xFF, 0xF0, 0x00, 0x1F, 0xFD, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFD, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0xFE, 0xFC, 0x00, 0xBD, 0xFD, 0xFE, 0xBD, 0x00,
-    0xFC, 0xFD, 0xFE, 0x7E, 0x00, 0xF8, 0xFD, 0xFE, 0x3F, 0x02, 0xF4, 0xFD, 0xFE, 0x3F, 0x43, 0xF0,
-    0xFD, 0xFE, 0x2F, 0x83, 0xE0, 0xFD, 0xFE, 0x0F, 0xCB, 0xD0, 0xFD, 0xFE, 0x0F, 0xCF, 0xC0, 0xFD,
-    0xFE, 0x0B, 0xEF, 0xC0, 0xFD, 0xFE, 0x07, 0xFF, 0x40, 0xFD, 0xFE, 0x03, 0xFF, 0x00, 0xFD, 0xFE,
-    0x02, 0xFF, 0x00, 0xFD, 0xFE, 0x01, 0xFD, 0x00, 0xFD, 0xBF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
-    0x55, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x87, 0xF8, 0x00, 0x03,
-    0xFC, 0xBF, 0x40, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x00, 0x3F, 0xCB, 0xF4,
-    0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0xFF,
-    0x41, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD5, 0x55, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF0, 0xBF, 0xFE, 0x80, 0x3F, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xE3, 0xFD, 0x5B, 0xFC, 0xFF, 0x00, 0xBF, 0x7F, 0xC0, 0x1F, 0xDF, 0xF0,
-    0x07, 0xF7, 0xFC, 0x03, 0xFD, 0xFF, 0x57, 0xFF, 0x3F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0x43, 0xFF,
-    0xE9, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x1F, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xF8, 0x1F, 0xFD, 0x01, 0xC0, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x24, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x55, 0x00,
-    0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0xBF, 0x40, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x0F,
-    0xE0, 0x0F, 0xF0, 0x07, 0xF4, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x07, 0xF4,
-    0xBF, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x03, 0xFF, 0x4B, 0xF0, 0x7F, 0xD0, 0xFF, 0x02, 0xFC, 0x07, 0xFC, 0x7F, 0x40, 0xBF, 0x00, 0xFF,
-    0x2F, 0xC0, 0x2F, 0xC0, 0x2F, 0xCB, 0xF0, 0x0B, 0xF0, 0x0B, 0xF1, 0xFD, 0x02, 0xFC, 0x03, 0xFC,
-    0x3F, 0xC0, 0xBF, 0x01, 0xFF, 0x0F, 0xFD, 0x2F, 0xC2, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x0F, 0xF4,
-    0x00, 0xBF, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xC0, 0x03, 0xFC, 0x1F, 0xE0, 0x00,
-    0x3F, 0xCF, 0xF0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x01, 0xFD, 0x3F,
-    0xC0, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x7F, 0x80, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x02, 0xFE, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x03,
-    0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xA8, 0x3F, 0x40, 0x03, 0xF9, 0xFE, 0x00,
-    0x0F, 0xE7, 0xF8, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0xFE, 0x7F, 0x80, 0x03, 0xF9, 0xFE, 0x00, 0x0F,
-    0xE3, 0xF8, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0xFE, 0x3F, 0xF5, 0x6F, 0xF8, 0x7F, 0xFF, 0xFF, 0xE0,
-    0xBF, 0xFF, 0xFF, 0x80, 0x2B, 0xE5, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00,
-    0x1F, 0xC0, 0x03, 0xF7, 0xFC, 0x00, 0xBF, 0x00, 0x1F, 0xEF, 0xF0, 0x02, 0xFC, 0x00, 0x7F, 0xBF,
-    0xC0, 0x0B, 0xF0, 0x01, 0xFE, 0xFF, 0x00, 0x2F, 0xC0, 0x07, 0xFB, 0xFC, 0x00, 0xBF, 0x00, 0x1F,
-    0xEF, 0xF0, 0x02, 0xFC, 0x00, 0x7F, 0xBF, 0xC0, 0x0B, 0xF0, 0x01, 0xFE, 0xFF, 0x00, 0x2F, 0xC0,
-    0x07, 0xFB, 0xFC, 0x00, 0xBF, 0x00, 0x1F, 0xEF, 0xF0, 0x02, 0xFC, 0x00, 0x7F, 0xBF, 0xC0, 0x0B,
-    0xF0, 0x01, 0xFE, 0xFF, 0x00, 0x2F, 0xC0, 0x07, 0xFB, 0xFC, 0x00, 0xBF, 0x00, 0x1F, 0xEF, 0xF0,
-    0x02, 0xFD, 0x00, 0x7F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x3F, 0xC0, 0x0B, 0xF0,
-    0x02, 0xFD, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0xFF,
-    0x00, 0x2F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0B, 0xF0, 0x02, 0xFD, 0x0F, 0xF0, 0x02, 0xFC, 0x00,
-    0xBF, 0x43, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x2F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x02, 0xFD, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0xBF, 0x00, 0x2F,
-    0xD0, 0xFF, 0x00, 0x2F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0B, 0xF0, 0x02, 0xFD, 0x0F, 0xF0, 0x02,
-    0xFD, 0x00, 0xBF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x7F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x01, 0x57, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0x50, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0xAF, 0xFC, 0x00, 0x3F, 0xC0,
-    0x2F, 0xE0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC, 0x01, 0xFE, 0x00,
-    0x3F, 0xC0, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFE,
-    0x40, 0xBF, 0x00, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0xA4,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFD, 0x5B, 0xFD, 0x0F,
-    0xFF, 0xF0, 0x07, 0xF8, 0x3F, 0xFF, 0xC0, 0x0F, 0xF0, 0xFF, 0xFF, 0x00, 0x3F, 0xC3, 0xFF, 0xFC,
-    0x01, 0xFF, 0x0F, 0xFF, 0xF0, 0x1F, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFA, 0xA4, 0x03, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0xEA, 0xFF, 0xDF, 0xF0, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0,
-    0x39, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x06, 0xAA,
-    0xAF, 0xF0, 0xBF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC5, 0x00, 0x1F, 0xFC, 0xBF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x1B, 0xFF, 0x80, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0xD0, 0x3F, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0xFF,
-    0x01, 0xFF, 0x41, 0xFF, 0xC3, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0x4F, 0xF0, 0x3F, 0x80, 0x01, 0xFE,
-    0x3F, 0xC1, 0xFD, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF3, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xCF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x3F, 0xD6, 0xFC, 0x00, 0x03, 0xFC, 0xFF, 0x07, 0xF4,
-    0x00, 0x0F, 0xF3, 0xFC, 0x0F, 0xE0, 0x00, 0x7F, 0x8F, 0xF0, 0x3F, 0xC0, 0x03, 0xFD, 0x3F, 0xC0,
-    0x7F, 0xD0, 0x2F, 0xF0, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x43, 0xFC, 0x00, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xF0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC2, 0xFF, 0x55, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0,
-    0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC2, 0xFE, 0x00, 0xFF, 0x03, 0xFF, 0xAB, 0xFC, 0x07, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xF5, 0xFF, 0x00, 0xFF, 0x43, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x3F, 0xC3, 0xFD, 0x00, 0xFF, 0x2F, 0xE0, 0x03, 0xFC, 0xFF, 0x00, 0x0F, 0xF0, 0x01,
-    0xBF, 0xE4, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x80, 0x24, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x01, 0x5B, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFB, 0xFC, 0x3F, 0xD0, 0x2F, 0xC3, 0xFC,
-    0x02, 0xFC, 0x3F, 0xC0, 0x3F, 0xC3, 0xFF, 0xAF, 0xFC, 0x1F, 0xFF, 0xDF, 0xC0, 0x7F, 0xF4, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xF4, 0x0F, 0xFE, 0x50, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF1, 0xFF, 0x80,
-    0xBF, 0xBF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0xFF, 0xD0, 0x7F, 0xCF, 0xF4, 0x02, 0xFD, 0xFF, 0x00,
-    0x1F, 0xDB, 0xF0, 0x01, 0xFE, 0xBF, 0x00, 0x1F, 0xD7, 0xF4, 0x02, 0xFD, 0x3F, 0xC0, 0x3F, 0xC2,
-    0xFF, 0xBF, 0xF4, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0x90, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF4, 0xFE, 0x02, 0xFE, 0x3F, 0x80, 0x7F, 0x4F, 0xE5,
-    0x7F, 0xC3, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x3F, 0x81, 0xBF, 0x8F, 0xE0, 0x0F, 0xF3, 0xF8,
-    0x03, 0xFC, 0xFF, 0xAB, 0xFE, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFD, 0x00, 0xAA, 0xAA, 0x9F, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xDF, 0xF5, 0x54, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x01,
-    0xAA, 0xAA, 0x90, 0x02, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xF8, 0x0F, 0xF0, 0x03,
-    0xF8, 0x0F, 0xF0, 0x03, 0xF4, 0x0F, 0xF0, 0x03, 0xF4, 0x0F, 0xF0, 0x03, 0xF4, 0x0F, 0xF0, 0x03,
-    0xF0, 0x0F, 0xF0, 0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0xFE, 0xFE,
-    0x00, 0x00, 0xFE, 0x69, 0x00, 0x00, 0x69, 0x00, 0xBF, 0x90, 0x02, 0xFF, 0xFE, 0x02, 0xFF, 0xFF,
-    0xE0, 0xFF, 0x02, 0xFC, 0xBF, 0x00, 0x3F, 0x7F, 0xD5, 0x5F, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFE, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x10, 0xFF, 0xEA, 0xFC, 0x0F, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x2A, 0x40, 0x2A, 0x40, 0x2A, 0x82, 0xFC, 0x03,
-    0xF8, 0x0B, 0xF4, 0x0F, 0xF0, 0x3F, 0x80, 0xFE, 0x00, 0x3F, 0x83, 0xF8, 0x3F, 0xC0, 0x02, 0xFC,
-    0x3F, 0x8B, 0xF0, 0x00, 0x0F, 0xF7, 0xF9, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x7F, 0xEF, 0xF0, 0x00, 0x3F, 0xD3, 0xF8, 0xBF, 0x40, 0x07,
-    0xF8, 0x3F, 0x83, 0xFC, 0x00, 0xFF, 0x03, 0xF8, 0x1F, 0xF0, 0x3F, 0xD0, 0x3F, 0x80, 0xBF, 0x8B,
-    0xF8, 0x03, 0xF8, 0x03, 0xFC, 0x06, 0xFF, 0x90, 0x3F, 0xFF, 0xF8, 0x2F, 0xFF, 0xFD, 0x04, 0x01,
-    0xFE, 0x00, 0x00, 0xFD, 0x01, 0x57, 0xFC, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0x06, 0xFD,
-    0x00, 0x00, 0xFF, 0x10, 0x00, 0xFF, 0x3F, 0xAB, 0xFE, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0xA9, 0x00, 0x6A, 0xBF, 0x80, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xFF, 0x83, 0xFB, 0xFF, 0xE2, 0xF6, 0xFF, 0xF9, 0xF8, 0xBF, 0xFE, 0xFC, 0x3F, 0xFF,
-    0xBE, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x05, 0x40, 0x54, 0x07, 0xF0, 0x3F, 0x00, 0xFE, 0x7F, 0xC0, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x0A, 0x90, 0x06, 0xAB, 0xF8, 0x03, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0xFF,
-    0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x3F, 0xBF, 0xFE, 0x2F, 0x6F, 0xFF, 0x9F, 0x8B, 0xFF, 0xEF, 0xC3,
-    0xFF, 0xFB, 0xE0, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x00,
-    0xFF, 0xA9, 0x00, 0x2A, 0x4F, 0xE0, 0x0F, 0xF0, 0xFE, 0x02, 0xFD, 0x0F, 0xE0, 0x7F, 0x80, 0xFE,
-    0x0F, 0xF0, 0x0F, 0xF6, 0xFC, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0x7F, 0xD0,
-    0x0F, 0xE0, 0xFF, 0x00, 0xFE, 0x07, 0xFC, 0x0F, 0xE0, 0x2F, 0xE0, 0xFE, 0x00, 0xFF, 0x0F, 0xE0,
-    0x07, 0xFC, 0x02, 0xAA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0x95, 0xFF,
-    0x03, 0xF4, 0x0F, 0xF0, 0x3F, 0x00, 0xFF, 0x03, 0xF0, 0x0F, 0xF0, 0x7F, 0x00, 0xFF, 0x07, 0xF0,
-    0x0F, 0xF0, 0x7F, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0xAA, 0xBF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFE, 0xF8, 0x0B, 0xEF, 0xFF, 0x7F, 0x03, 0xFB,
-    0xFF, 0xDB, 0xD1, 0xFA, 0xFF, 0xF4, 0xFC, 0xBC, 0xBF, 0xFD, 0x3F, 0x3F, 0x2F, 0xFF, 0x47, 0xFF,
-    0x4B, 0xFF, 0xD0, 0xFF, 0xC2, 0xFF, 0xF4, 0x3F, 0xF0, 0xBF, 0xFD, 0x07, 0xF4, 0x2F, 0xFF, 0x40,
-    0xFC, 0x0B, 0xF0, 0xA9, 0x00, 0x2A, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD,
-    0xFE, 0x00, 0x7F, 0x7F, 0xD5, 0x6F, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0xAA, 0xBF,
-    0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F,
-    0xD0, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFC, 0x0B, 0xF8, 0xBF,
-    0x40, 0x3F, 0xCF, 0xF0, 0x01, 0xFD, 0xFF, 0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xFF, 0x00, 0x1F,
-    0xDB, 0xF0, 0x02, 0xFC, 0x7F, 0x80, 0x3F, 0xC3, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7,
-    0xFC, 0x02, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD,
-    0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F,
-    0x7F, 0x80, 0x1F, 0xD0, 0xA8, 0x1F, 0xE0, 0x3F, 0x6F, 0xFF, 0x0F, 0xFF, 0xFF, 0xE3, 0xFF, 0x07,
-    0xFC, 0xFF, 0x00, 0x7F, 0x7F, 0xC0, 0x0F, 0xEF, 0xE0, 0x03, 0xFB, 0xF8, 0x00, 0xFE, 0xFF, 0x00,
-    0x3F, 0xBF, 0xC0, 0x1F, 0xEF, 0xF8, 0x0F, 0xF7, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x3F, 0x9F,
-    0xFC, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x3F, 0xE0,
-    0x20, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x7F, 0xD0, 0x04, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF4, 0x02, 0xFD, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x2A, 0x80, 0x01, 0xA8, 0x2F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x07, 0xF4, 0x0F, 0xF0, 0x0B, 0xF0,
-    0x07, 0xF4, 0x0F, 0xE0, 0x03, 0xF8, 0x1F, 0xD0, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0xFD, 0x3F, 0x80,
-    0x00, 0xFE, 0x3F, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD2, 0xFC, 0x7F, 0xD2, 0xFD, 0x0B, 0xF0, 0x3F, 0xCF,
-    0xF0, 0x2F, 0xC0, 0xFF, 0x3F, 0xC0, 0xBF, 0x02, 0xFC, 0xFF, 0x02, 0xFC, 0x0B, 0xF3, 0xFC, 0x0B,
-    0xF0, 0x2F, 0xCB, 0xF4, 0x2F, 0xC0, 0xFF, 0x0F, 0xF0, 0xBF, 0x0B, 0xF4, 0x2F, 0xFB, 0xFE, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x6A, 0x40, 0x0A, 0xA0, 0xFF, 0x00, 0xBF, 0x41, 0xFF,
-    0x07, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x03, 0xFE, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0xBF, 0x4F, 0xF0,
-    0x03, 0xFC, 0x1F, 0xE0, 0x3F, 0xC0, 0x2F, 0xD2, 0xFE, 0x00, 0x3F, 0xC0, 0x2A, 0x40, 0x1A, 0x80,
-    0xFE, 0x00, 0xBF, 0x03, 0xF8, 0x02, 0xFC, 0x0F, 0xE0, 0x0B, 0xF0, 0x3F, 0x80, 0x2F, 0xC0, 0xFE,
-    0x00, 0xBF, 0x03, 0xF8, 0x02, 0xFC, 0x0F, 0xE0, 0x0B, 0xF0, 0x3F, 0x80, 0x2F, 0xC0, 0xFE, 0x00,
-    0xBF, 0x03, 0xF8, 0x02, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x06, 0xA0,
-    0x6A, 0x00, 0x2A, 0xAF, 0xC0, 0x0F, 0xFB, 0xF0, 0x03, 0xFE, 0xFC, 0x00, 0xFF, 0xBF, 0x00, 0x3F,
-    0xDF, 0xD0, 0x0F, 0xF7, 0xFE, 0x5B, 0xFC, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x5A, 0x4F,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0xA9, 0x00,
-    0xAA, 0x00, 0xAA, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF,
-    0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00,
-    0xFF, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0xFF,
-    0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0xFE,
-    0x00, 0xFE, 0x00, 0xFE, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x0F,
-    0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0,
-    0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6A, 0xA9, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xAB, 0xFD, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x00,
-    0xFE, 0x01, 0xFE, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x90, 0xA9,
-    0x00, 0x00, 0x0A, 0x8F, 0xE0, 0x00, 0x01, 0xFD, 0xFE, 0x00, 0x00, 0x1F, 0xDF, 0xE0, 0x00, 0x01,
-    0xFD, 0xFF, 0x54, 0x00, 0x1F, 0xDF, 0xFF, 0xFE, 0x01, 0xFD, 0xFF, 0xFF, 0xFC, 0x1F, 0xDF, 0xF5,
-    0xBF, 0xD1, 0xFD, 0xFE, 0x01, 0xFE, 0x1F, 0xDF, 0xE0, 0x0F, 0xE1, 0xFD, 0xFE, 0x02, 0xFD, 0x1F,
-    0xDF, 0xFF, 0xFF, 0xC1, 0xFD, 0xFF, 0xFF, 0xF4, 0x1F, 0xDF, 0xFF, 0xF8, 0x01, 0xFD, 0xA9, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x50, 0x00, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xAB, 0xFD, 0xFE, 0x01, 0xFE, 0xFE, 0x00, 0xFF, 0xFE, 0x01, 0xFE, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x90, 0x0B, 0xFE, 0x40, 0x0F, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xC0, 0x10, 0x1F, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFC, 0x01, 0x55, 0xFF, 0x00, 0x00, 0x3F, 0xC1, 0x00, 0x3F, 0xD0, 0xFE, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x1F, 0xE4, 0x03, 0xF8, 0x07,
-    0xFF, 0xFC, 0x0F, 0xE0, 0x3F, 0xFF, 0xFC, 0x3F, 0x82, 0xFE, 0x0B, 0xF4, 0xFE, 0x0F, 0xF0, 0x0F,
-    0xF3, 0xFD, 0x7F, 0x40, 0x2F, 0xCF, 0xFF, 0xFD, 0x00, 0xBF, 0x3F, 0xFF, 0xF4, 0x02, 0xFC, 0xFF,
-    0xAF, 0xD0, 0x0B, 0xF3, 0xF8, 0x3F, 0x80, 0x3F, 0xCF, 0xE0, 0xFF, 0x01, 0xFE, 0x3F, 0x81, 0xFF,
-    0xFF, 0xF0, 0xFE, 0x02, 0xFF, 0xFF, 0x43, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xAA, 0x80, 0x7F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD1, 0xFE, 0x01, 0xFD, 0x2F,
-    0xC0, 0x1F, 0xD2, 0xFD, 0x01, 0xFD, 0x0F, 0xFA, 0xBF, 0xD0, 0x7F, 0xFF, 0xFD, 0x01, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xD1, 0xFD, 0x07, 0xFC, 0x1F, 0xD0, 0xFF, 0x01, 0xFD, 0x2F, 0xD0, 0x1F, 0xD7, 0xFC,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x0F,
-    0xF0, 0x2F, 0xCB, 0xF0, 0x03, 0xF7, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0x0F, 0xFE, 0xAF, 0xC0, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x02, 0x80, 0xA0, 0x02, 0xF8, 0x7E, 0x00, 0xBE, 0x2F,
-    0xC0, 0x0A, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0xFF, 0x80, 0xBF, 0xFF,
-    0xF8, 0x3F, 0xC0, 0xBF, 0x2F, 0xC0, 0x0F, 0xDF, 0xF5, 0x57, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xBF, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x04, 0x3F, 0xFA, 0xBF, 0x03, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0x7F, 0xD5, 0x40, 0x0F,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x5F, 0xF5, 0x50, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x2F, 0xF4, 0x03, 0xFB, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x3F, 0xD0, 0xFF, 0x00,
-    0x7F, 0x43, 0xFC, 0x01, 0xFD, 0x0F, 0xF0, 0x07, 0xF4, 0x3F, 0x80, 0x1F, 0xD0, 0xFE, 0x00, 0x7F,
-    0x43, 0xF8, 0x01, 0xFD, 0x0F, 0xE0, 0x07, 0xF4, 0x3F, 0x80, 0x1F, 0xD0, 0xFE, 0x00, 0x7F, 0x40,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0x40, 0x0F, 0xC0,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x9F, 0xFF, 0xFD, 0xFF, 0xFF, 0xDF, 0xF5, 0x54, 0xFE,
-    0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00,
-    0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xF8, 0x3F, 0xD0, 0x10, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0,
-    0xFF, 0x55, 0x40, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFE, 0xFC, 0x0F, 0xFF, 0xFC, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x80, 0xFF, 0xFF, 0xCB, 0xFF, 0xFE, 0x3F, 0x80, 0x10,
-    0xFF, 0x00, 0x02, 0xFF, 0x90, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x2F,
-    0xD4, 0x00, 0x7F, 0x7F, 0xAB, 0xFC, 0xFF, 0xFF, 0xE2, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x4F, 0xF3, 0xFC, 0x68, 0x00, 0x0A, 0x93, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F,
-    0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0x3C, 0x7C, 0x7E, 0xBC, 0x7D, 0xBC, 0x28, 0x24, 0x00,
-    0x00, 0x0A, 0xA0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xBD, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x68, 0x00, 0x00, 0x00, 0xA9, 0x00, 0xFE, 0x00, 0xFE, 0x00,
-    0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00,
-    0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x02, 0xFD, 0x7F, 0xFC, 0x7F, 0xF8, 0x3F,
-    0xD0, 0x01, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0x81, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xE5, 0x40, 0x00, 0x3F, 0x40, 0xFF,
-    0xFF, 0xD0, 0x03, 0xF4, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0x40, 0xFF, 0x5B, 0xFC, 0x03, 0xF0, 0x0F,
-    0xE0, 0x2F, 0xD0, 0x3F, 0x00, 0xFE, 0x01, 0xFD, 0x0B, 0xF0, 0x0F, 0xE0, 0x3F, 0xDF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x0F, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x6A, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xA4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0x00,
-    0xBF, 0x00, 0xFF, 0x3F, 0x80, 0x2F, 0xC0, 0x2F, 0xCF, 0xE0, 0x0B, 0xF0, 0x0F, 0xF3, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFC, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x3F, 0x80, 0x2F, 0xFF, 0xF8, 0x00, 0x0F, 0xE0,
-    0x00, 0x01, 0x7F, 0xD5, 0x40, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x5F, 0xF5, 0x50,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x2F, 0xF4, 0x03, 0xFB, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xF0, 0x3F, 0xD0, 0xFF, 0x00, 0x7F, 0x43, 0xFC, 0x01, 0xFD, 0x0F, 0xF0, 0x07, 0xF4, 0x3F,
-    0x80, 0x1F, 0xD0, 0xFE, 0x00, 0x7F, 0x43, 0xF8, 0x01, 0xFD, 0x0F, 0xE0, 0x07, 0xF4, 0x3F, 0x80,
-    0x1F, 0xD0, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x2A, 0x4F, 0xE0,
-    0x0F, 0xF0, 0xFE, 0x02, 0xFD, 0x0F, 0xE0, 0x7F, 0x80, 0xFE, 0x0F, 0xF0, 0x0F, 0xF6, 0xFC, 0x00,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0x7F, 0xD0, 0x0F, 0xE0, 0xFF, 0x00, 0xFE, 0x07,
-    0xFC, 0x0F, 0xE0, 0x2F, 0xE0, 0xFE, 0x00, 0xFF, 0x0F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0A,
-    0x90, 0x06, 0xAB, 0xF8, 0x03, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF,
-    0xF8, 0x3F, 0xBF, 0xFE, 0x2F, 0x6F, 0xFF, 0x9F, 0x8B, 0xFF, 0xEF, 0xC3, 0xFF, 0xFB, 0xE0, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x54, 0x05,
-    0x40, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xFE, 0x6F, 0xC0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x01, 0xA8, 0x2F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x07,
-    0xF4, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xF4, 0x0F, 0xE0, 0x03, 0xF8, 0x1F, 0xD0, 0x02, 0xFC, 0x2F,
-    0xC0, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xA9, 0x00, 0x6A, 0x3F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8,
-    0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE,
-    0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x7F, 0x40, 0x1F, 0xE0, 0x02, 0xFC, 0x7F, 0x80, 0x1F, 0xE0, 0x02, 0xFD, 0x7F, 0x80, 0x0F, 0xF0,
-    0x02, 0xFC, 0x7F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF4, 0x03, 0xFC, 0x2F, 0xD0, 0x1F, 0xF8, 0x03, 0xF8,
-    0x1F, 0xE0, 0x3F, 0xFC, 0x07, 0xF4, 0x0F, 0xF0, 0x3F, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x7F, 0xFD,
-    0x0B, 0xF0, 0x07, 0xF8, 0xBE, 0xFE, 0x0F, 0xE0, 0x03, 0xFC, 0xFC, 0xFF, 0x1F, 0xD0, 0x02, 0xFD,
-    0xFC, 0x7F, 0x6F, 0xC0, 0x00, 0xFF, 0xF8, 0x3F, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x1F, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x6A, 0x00, 0x2A, 0x40,
-    0x1A, 0x87, 0xF4, 0x03, 0xFC, 0x02, 0xFC, 0x7F, 0x40, 0x3F, 0xC0, 0x3F, 0xC3, 0xF8, 0x03, 0xFC,
-    0x03, 0xFC, 0x3F, 0x80, 0x2F, 0xC0, 0x3F, 0x83, 0xFC, 0x02, 0xFD, 0x03, 0xF4, 0x2F, 0xC0, 0x3F,
-    0xE0, 0x7F, 0x00, 0xFD, 0x07, 0xFF, 0x0B, 0xF0, 0x0F, 0xF0, 0xFF, 0xF0, 0xFD, 0x00, 0x7F, 0x2F,
-    0xBF, 0x5F, 0xC0, 0x03, 0xFB, 0xF1, 0xFF, 0xF8, 0x00, 0x1F, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0xFF,
-    0xC0, 0x7F, 0xE0, 0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xAB, 0xFE, 0xA9, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x57, 0xFD, 0x54,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFC, 0x07, 0xFD, 0x03, 0xFC, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0xFE, 0x03, 0xFC, 0x01,
-    0xFE, 0x03, 0xFC, 0x07, 0xFD, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFE,
-    0x40, 0x01, 0x54, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xAB, 0xFE, 0xA8,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFD, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFC, 0x07,
-    0xFD, 0x03, 0xFC, 0x00, 0xFE, 0x03, 0xFC, 0x01, 0xFE, 0x03, 0xFE, 0xAB, 0xFD, 0x03, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x6F, 0xFE, 0x4F,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFB, 0xFC, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0xFF, 0xD0, 0x1F, 0x3F,
-    0xC0, 0xBF, 0x80, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFD,
-    0x6F, 0xE5, 0x55, 0x40, 0xFF, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
-    0x2F, 0xE0, 0x00, 0x03, 0xFC, 0x07, 0xFE, 0x00, 0x18, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x3F, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40,
-    0x02, 0xFF, 0x90, 0xFE, 0x00, 0xBF, 0xFF, 0xC3, 0xF8, 0x0B, 0xFF, 0xFE, 0x0F, 0xE0, 0x3F, 0xC0,
-    0x10, 0x3F, 0x81, 0xFD, 0x00, 0x00, 0xFF, 0x5F, 0xF5, 0x54, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xD7, 0xFD, 0x55, 0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x1F,
-    0xE0, 0x01, 0x0F, 0xE0, 0x3F, 0xFA, 0xBC, 0x3F, 0x80, 0x3F, 0xFF, 0xF0, 0xFE, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x01, 0xFC,
-    0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x3F, 0xAA, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x6F, 0xDF, 0xD0, 0x02, 0xFC, 0xBF, 0x2F, 0xC0, 0x0F,
-    0xE2, 0xFC, 0x3F, 0x00, 0x7F, 0x0B, 0xF0, 0xFE, 0x02, 0xFC, 0x2F, 0xC2, 0xFC, 0x0F, 0xE0, 0xBF,
-    0x07, 0xF4, 0x7F, 0x02, 0xFC, 0x0F, 0xE3, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x1A, 0xA0, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x01, 0xF8, 0x2F, 0x40, 0x03, 0xFE, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xCB, 0xE3, 0xF0, 0x2F, 0xCB, 0xE3, 0xF8, 0x3F, 0x4B, 0xE1, 0xFC, 0x7F, 0x0B, 0xE0, 0xFD,
-    0xFF, 0x0B, 0xE0, 0xFF, 0xBF, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x0B, 0xEB, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0x41, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFF, 0xAA, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0x56, 0xFD, 0xFF, 0x7F, 0x40, 0xFF, 0x02, 0xF8, 0xBE, 0x2F, 0x80, 0xFF, 0x03, 0xF4, 0xBE,
-    0x1F, 0xC0, 0xFF, 0x07, 0xF0, 0xBE, 0x0F, 0xD0, 0xFF, 0x0F, 0xE0, 0xBE, 0x0B, 0xF0, 0xFF, 0x0F,
-    0xD0, 0xBE, 0x07, 0xF0, 0xFF, 0x2F, 0xC0, 0xBE, 0x03, 0xF8, 0xFF, 0x3F, 0x80, 0xBE, 0x02, 0xFC,
-    0x2A, 0x00, 0x02, 0xAA, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0x00, 0x0B, 0xFF, 0x80,
-    0x03, 0xF0, 0x00, 0xFC, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x8B, 0xE0, 0x03, 0xF9, 0x57, 0xF4, 0x7F,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x56, 0xFD, 0xFE,
-    0xFC, 0x03, 0xF0, 0x2F, 0xCF, 0xCB, 0xE0, 0x3F, 0x03, 0xF4, 0xFC, 0x7F, 0x03, 0xF0, 0x7F, 0x0F,
-    0xC3, 0xF4, 0x3F, 0x0F, 0xE0, 0xFC, 0x2F, 0xC3, 0xF0, 0xFD, 0x0F, 0xC0, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFD, 0x55, 0x7F,
-    0x80, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFE, 0xFF, 0xBF, 0xC0, 0x07, 0xF8, 0xFF, 0x2F, 0xD0, 0x0B, 0xF0, 0xFF, 0x0F, 0xF0, 0x0F, 0xE0,
-    0xFF, 0x0B, 0xF0, 0x1F, 0xD0, 0xFF, 0x07, 0xF4, 0x2F, 0xC0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF,
-    0x02, 0xFC, 0x7F, 0x40, 0xFF, 0x01, 0xFD, 0x1A, 0xAA, 0xAA, 0xA4, 0x2F, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x07, 0xF0, 0x2F, 0xC0, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xCF, 0xD7, 0xF0, 0x2F,
-    0x8F, 0xD3, 0xF0, 0x3F, 0x0F, 0xD2, 0xF4, 0x3F, 0x0F, 0xD1, 0xFC, 0xBE, 0x0F, 0xD0, 0xFC, 0xBF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFC, 0x03, 0xFD, 0x55, 0xBF, 0x40, 0xFF, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0xC0,
-    0x03, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F, 0x6F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF5, 0x5F,
-    0xFB, 0xFF, 0xFE, 0x03, 0xFC, 0x0B, 0xF4, 0xFE, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x3F, 0x87, 0xF4,
-    0x3F, 0xC1, 0xFD, 0x0F, 0xE0, 0xFF, 0x0F, 0xF0, 0xBF, 0x03, 0xF8, 0x2F, 0xC3, 0xFC, 0x3F, 0xC0,
-    0xFE, 0x07, 0xF4, 0xFF, 0x1F, 0xE0, 0x3F, 0x80, 0xFF, 0x3F, 0xCB, 0xF0, 0x0F, 0xE0, 0x2F, 0xC0,
-    0x2A, 0x02, 0xAA, 0xAA, 0xAA, 0x0F, 0xC1, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0xFC, 0x03, 0xF8, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x4F, 0xE0, 0x0F, 0xE5, 0x5B, 0xFB, 0xE0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x56, 0xFE, 0xFF, 0xFC, 0x0F,
-    0xC0, 0xFD, 0x7F, 0x3F, 0x03, 0xF0, 0x3F, 0x1F, 0xCB, 0xE0, 0xFC, 0x1F, 0x87, 0xF0, 0xFC, 0x3F,
-    0x0F, 0xD1, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0x7F, 0x0B, 0xE0, 0x01, 0x40, 0x06, 0x80, 0x0F, 0xD0,
-    0xFF, 0x40, 0x0F, 0xDB, 0xD4, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x01, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00,
-    0x1B, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0xFF, 0x40, 0x6A, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x07, 0xF9, 0x40, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xEA, 0xA9, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xF4, 0x00,
-    0x05, 0x00, 0x40, 0x06, 0x40, 0x2F, 0x41, 0xF8, 0x3F, 0xD0, 0x2F, 0xBF, 0x40, 0x1B, 0xFF, 0x80,
-    0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xD0, 0x90, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x56, 0xFF,
-    0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x1A, 0xAF, 0xF8, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF4, 0x2F, 0xD4, 0x00, 0x0B, 0xE0, 0x00,
-    0x02, 0xFE, 0xAA, 0x90, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x00, 0x05, 0x40, 0x40, 0xBE, 0x02,
-    0xF8, 0x0B, 0xEF, 0xE0, 0x2F, 0x80, 0xBF, 0xFE, 0x02, 0xF8, 0x0B, 0xFF, 0xE0, 0x2F, 0x80, 0xBF,
-    0xFE, 0x02, 0xF8, 0x0B, 0xFF, 0xE0, 0x2F, 0x80, 0xBF, 0xFE, 0x02, 0xF8, 0x0B, 0xFF, 0xE0, 0x2F,
-    0x80, 0xFF, 0xBF, 0x02, 0xF8, 0x0F, 0xE7, 0xF8, 0x2F, 0x82, 0xFD, 0x3F, 0xFB, 0xFE, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0x7F, 0xD4, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xA8, 0x07, 0xF0, 0x2A, 0x07, 0xF4, 0x1F, 0xC0, 0xFE,
-    0x1F, 0xD0, 0x7F, 0x03, 0xFC, 0x7F, 0x41, 0xFC, 0x0B, 0xF1, 0xFD, 0x07, 0xF0, 0x2F, 0xC7, 0xF4,
-    0x1F, 0xC0, 0x7F, 0x1F, 0xD0, 0x7F, 0x01, 0xFC, 0x3F, 0x41, 0xFC, 0x07, 0xF0, 0xFD, 0x07, 0xF0,
-    0x2F, 0xC3, 0xF8, 0x1F, 0xC0, 0xFF, 0x0F, 0xF4, 0x7F, 0x0B, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x07,
-    0xF8, 0x3F, 0x80, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x02, 0xFC, 0xBF, 0xAA, 0xAA, 0xBF, 0xDB, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xF9, 0x55, 0x56, 0xFD, 0x7F, 0x40, 0x00, 0x2F,
-    0xC3, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x7F, 0x81, 0xFF, 0x40, 0x1F, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0xBF, 0x40,
-    0x3F, 0xCB, 0xF0, 0x02, 0xFC, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFD, 0xFF, 0x55, 0x7F, 0xDB,
-    0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x7F, 0x82, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xDB, 0xF4, 0x00, 0x07, 0xFE, 0x3F, 0x80,
-    0x00, 0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xE0, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80,
-    0x0F, 0xF0, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x3F, 0xC1,
-    0xFC, 0x00, 0x01, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
-    0x07, 0xFB, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xAA, 0x00, 0x01, 0xA8, 0xBF, 0x40, 0x0B, 0xFC, 0x3F, 0x80,
-    0x0F, 0xFC, 0x3F, 0xC0, 0x2F, 0xD4, 0x1F, 0xD0, 0x3F, 0xC0, 0x0F, 0xE0, 0x3F, 0x40, 0x0B, 0xF0,
-    0xBF, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x03, 0xF9, 0xFC, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x1F, 0x87, 0xD0, 0x00,
-    0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xDB, 0xF4, 0x00,
-    0x07, 0xFE, 0x3F, 0x80, 0x00, 0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xE0, 0x2F, 0xC0, 0x03, 0xFC, 0x00,
-    0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x03, 0xF4, 0x0F,
-    0xE0, 0x00, 0x3F, 0xC1, 0xFC, 0x00, 0x01, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00,
-    0xFE, 0x7F, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F,
-    0xD0, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAA, 0x00, 0x01, 0xA8, 0xBF, 0x40, 0x0B, 0xFC, 0x3F, 0x80, 0x0F, 0xFC, 0x3F, 0xC0,
-    0x2F, 0xD4, 0x1F, 0xD0, 0x3F, 0xC0, 0x0F, 0xE0, 0x3F, 0x40, 0x0B, 0xF0, 0xBF, 0x00, 0x07, 0xF0,
-    0xFE, 0x00, 0x03, 0xF9, 0xFC, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFE, 0x0A, 0xA0, 0x00, 0xAA, 0x3F, 0xC0, 0x00, 0xFF, 0x0F, 0xF0,
-    0x01, 0xFE, 0x7F, 0x80, 0x00, 0xBF, 0x07, 0xF8, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0xBF, 0x43, 0xFC,
-    0x03, 0xFC, 0xBF, 0x40, 0x00, 0x7F, 0x42, 0xFC, 0x07, 0xF4, 0xBF, 0x40, 0x00, 0x7F, 0x40, 0xFE,
-    0x0B, 0xF0, 0x7F, 0x40, 0x00, 0xBF, 0x40, 0xFF, 0x0F, 0xE0, 0x7F, 0x80, 0x00, 0xBF, 0x40, 0x7F,
-    0x1F, 0xD0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x3F, 0xAF, 0xC0, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x2F,
-    0xBF, 0x80, 0x1F, 0xF4, 0x07, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0x90, 0x06, 0xA0, 0x00, 0x6A, 0x02, 0xFF, 0xFF, 0x01, 0xFD, 0x00, 0x3F,
-    0xC2, 0xFF, 0xFF, 0xF0, 0x3F, 0xC0, 0x0F, 0xE0, 0xFF, 0x42, 0xFE, 0x0B, 0xF0, 0x0B, 0xF0, 0x7F,
-    0x40, 0x3F, 0xC0, 0xFD, 0x03, 0xFC, 0x2F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0xFD, 0x0F, 0xF0, 0x01,
-    0xFD, 0x07, 0xF0, 0x7F, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFD, 0x3F, 0x80, 0xBF, 0x00, 0x2F, 0xD0,
-    0x2F, 0xCF, 0xD0, 0x2F, 0xD0, 0x0B, 0xF0, 0x03, 0xFB, 0xF0, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0xFF,
-    0xF8, 0x00, 0xBF, 0xEB, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF9,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFB, 0xF7, 0xFF, 0x03,
-    0xFE, 0x05, 0x03, 0xFE, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x0F, 0xF2, 0xFD, 0x00,
-    0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x00, 0xBF, 0x6F, 0xD0, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x0F,
-    0xF5, 0xFE, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x04, 0x0F, 0xF8, 0x1F,
-    0xFD, 0xFD, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xD0, 0xFF,
-    0x7F, 0x7F, 0xC7, 0xF8, 0x10, 0x7F, 0xAF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFB, 0xF0, 0x00, 0x3F, 0xEF, 0xD0, 0x01, 0xFE, 0x3F, 0xCB, 0xCF, 0xF4, 0xBF, 0xFF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xC0, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x2F, 0xF0, 0x20, 0x02, 0x02,
-    0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xEB, 0xF0, 0x00, 0x2A, 0x40, 0x03, 0xF9, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x7F, 0x80, 0x07,
-    0xF4, 0x00, 0x7F, 0x4F, 0xF0, 0x01, 0xFD, 0x00, 0x2F, 0xD2, 0xFD, 0x00, 0x7F, 0x40, 0x1F, 0xF0,
-    0x7F, 0xE0, 0x3F, 0xF4, 0x1F, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xEF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xD0, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xEF, 0xFD, 0x00, 0x00,
-    0x01, 0xF1, 0x5B, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x06, 0xFE, 0x00, 0x0B, 0xFF, 0xD0, 0xFF, 0xFD, 0x02, 0xFF, 0xFC, 0x03, 0xFF,
-    0xF0, 0x3F, 0xD1, 0x00, 0x10, 0xBF, 0x87, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0xCF, 0xF0, 0x01, 0x50, 0x02, 0xFD, 0xFF, 0x00, 0x3F, 0x80, 0x2F, 0xDB, 0xF0, 0x03, 0xF8,
-    0x02, 0xFC, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0xC7, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x7F, 0xFF, 0xE0, 0x02, 0xFF, 0xD0, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xD7, 0xD7, 0x40, 0x00, 0x00, 0x00, 0x41, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x1F, 0xE0, 0x02, 0xFC, 0x7F, 0x80, 0x1F, 0xE0, 0x02, 0xFD, 0x7F, 0x80, 0x0F,
-    0xF0, 0x02, 0xFC, 0x7F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF4, 0x03, 0xFC, 0x2F, 0xD0, 0x1F, 0xF8, 0x03,
-    0xF8, 0x1F, 0xE0, 0x3F, 0xFC, 0x07, 0xF4, 0x0F, 0xF0, 0x3F, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x7F,
-    0xFD, 0x0B, 0xF0, 0x07, 0xF8, 0xBE, 0xFE, 0x0F, 0xE0, 0x03, 0xFC, 0xFC, 0xFF, 0x1F, 0xD0, 0x02,
-    0xFD, 0xFC, 0x7F, 0x6F, 0xC0, 0x00, 0xFF, 0xF8, 0x3F, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x1F, 0xFF,
-    0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x05, 0x55,
-    0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xAF, 0xAD, 0x00, 0x00, 0x00, 0x50,
-    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x02, 0xA4, 0x01, 0xA8, 0x7F, 0x40,
-    0x3F, 0xC0, 0x2F, 0xC7, 0xF4, 0x03, 0xFC, 0x03, 0xFC, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC3, 0xF8,
-    0x02, 0xFC, 0x03, 0xF8, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0x42, 0xFC, 0x03, 0xFE, 0x07, 0xF0, 0x0F,
-    0xD0, 0x7F, 0xF0, 0xBF, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0xD0, 0x07, 0xF2, 0xFB, 0xF5, 0xFC, 0x00,
-    0x3F, 0xBF, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x0F, 0xFD, 0x01, 0xB0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xBF, 0xE0, 0x0B, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFC, 0x7F, 0xD0, 0x64, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0,
-    0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0B, 0x40, 0x09, 0x03, 0xC0,
-    0x03, 0xE2, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x3C, 0x2E,
-    0x74, 0x2D, 0x00, 0x1F, 0xDF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x03, 0xDF, 0xD0,
-    0x02, 0xE0, 0xB0, 0x00, 0xF0, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x7F, 0xFF, 0xFB, 0xFF, 0xFD, 0x78, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xFF,
-    0xC7, 0xFF, 0xBF, 0x1E, 0x80, 0x3C, 0x2E, 0x1F, 0xCB, 0xD0, 0xF4, 0x0F, 0x40, 0x00, 0x2D, 0x2F,
-    0xC1, 0xF0, 0x7C, 0xB8, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xFF, 0xE9, 0xFE, 0xFF, 0xFF, 0x80, 0xBF,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xD0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xD1, 0xD0,
-    0x00, 0x00, 0xB4, 0x70, 0x00, 0x14, 0x05, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x43, 0x97, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x6C, 0x20, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xEB, 0xC0, 0x00, 0x00, 0x7A, 0xF0, 0x00, 0x28, 0x09,
-    0x00, 0x00, 0x09, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x64, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x2D,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x02, 0xA0, 0x00, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD6, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x1F, 0xF4, 0x03, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x3F, 0x80,
-    0x03, 0xFF, 0xD0, 0x0F, 0xE0, 0x03, 0xFF, 0xF4, 0x03, 0xF8, 0x01, 0xFD, 0xFD, 0x00, 0xFE, 0x00,
-    0xFF, 0x3F, 0x40, 0x3F, 0x80, 0xBF, 0x0F, 0xD0, 0x0F, 0xE0, 0x7F, 0x83, 0xF4, 0x03, 0xF8, 0x3F,
-    0xC0, 0xFD, 0x00, 0xFE, 0x2F, 0xD0, 0x3F, 0x40, 0x3F, 0x8F, 0xE0, 0x0F, 0xD0, 0x0F, 0xEB, 0xF0,
-    0x03, 0xF4, 0x03, 0xFF, 0xF8, 0x00, 0xFD, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0x55, 0x3F, 0xFD, 0x00,
-    0x0F, 0xFF, 0xCF, 0xFE, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x02,
-    0x90, 0x00, 0x2F, 0x80, 0x2F, 0xC0, 0x00, 0x7F, 0x96, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
-    0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x6A, 0x80, 0x0F, 0xE0,
-    0x03, 0xFF, 0x00, 0x3F, 0x80, 0x3F, 0xFC, 0x00, 0xFE, 0x01, 0xFF, 0xF0, 0x03, 0xF8, 0x0F, 0xFF,
-    0xC0, 0x0F, 0xE0, 0xFF, 0x7F, 0x00, 0x3F, 0x87, 0xF5, 0xFC, 0x00, 0xFD, 0x3F, 0x8B, 0xF0, 0x03,
-    0xF7, 0xFC, 0x2F, 0xC0, 0x0F, 0xFF, 0xD0, 0xBF, 0x00, 0x3F, 0xFE, 0x02, 0xFC, 0x00, 0xFF, 0xF0,
-    0x0B, 0xFA, 0x93, 0xFF, 0x40, 0x2F, 0xFF, 0x4F, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0x01, 0xFF, 0x43, 0xFC, 0x00,
-    0xFE, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xE0, 0xFF, 0x01, 0xFF, 0x43, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x05,
-    0xFF, 0x55, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x55,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0x80, 0x7F, 0xD0, 0xFE, 0x00, 0x7F,
-    0x43, 0xF8, 0x01, 0xFD, 0x0F, 0xFA, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0x90, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE3, 0xFD, 0x5B, 0xFC, 0xFF, 0x00, 0xBF,
-    0x7F, 0xC0, 0x1F, 0xEF, 0xF0, 0xD7, 0xFB, 0xFC, 0xBF, 0xFD, 0xFF, 0x6F, 0xFF, 0x3F, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFF, 0x83, 0xFE, 0xAB, 0xF0, 0xFF, 0x00, 0x38, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2A, 0x07, 0xF8, 0x03, 0xF6,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x83, 0xFE, 0x07, 0xFC, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x00, 0xFE,
-    0x3F, 0x80, 0x0F, 0xE3, 0xF8, 0x00, 0xFE, 0x3F, 0xC2, 0xDF, 0xE3, 0xFC, 0x7F, 0xFD, 0x3F, 0xE2,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xF4, 0x3F, 0x80, 0x0F, 0x83,
-    0xF8, 0x00, 0x10, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x2A, 0xAB,
-    0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8,
-    0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD0,
-    0xFF, 0x55, 0x54, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x55,
-    0x40, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x6F, 0xFA, 0xA8, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0A, 0xAA, 0xA9, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x1F, 0xE5, 0x55,
-    0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xD0, 0x1F,
-    0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x55, 0x54, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xE4, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x96, 0xFF, 0xF0, 0xFF, 0x00,
-    0x1F, 0xF4, 0xFF, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x02, 0xFC, 0xFF, 0x00,
-    0x02, 0xFC, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x50,
-    0x2F, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x55, 0x40,
-    0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
-    0xFE, 0x03, 0xFD, 0x6F, 0xF4, 0x3F, 0x80, 0x7F, 0xC3, 0xF8, 0x02, 0xFC, 0x3F, 0x80, 0x1F, 0xC3,
-    0xF8, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x40, 0xBF, 0x80, 0x0F, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xD0,
-    0x03, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xE0, 0x00,
-    0x7F, 0x40, 0xFE, 0x03, 0xFC, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0xFE,
-    0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x4F, 0xE3, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0xFE, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xCF,
-    0xE7, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0xFE, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xE0, 0xFF, 0x00,
-    0x00, 0x3F, 0xC0, 0xFE, 0x07, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0xE0, 0x3F, 0xD5, 0x41, 0xFE, 0x00,
-    0xFE, 0x00, 0xFF, 0xFC, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xFF, 0xCB, 0xF4, 0x00, 0xFE, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x0A, 0xA0, 0x06, 0xA4, 0x02, 0xFD,
-    0x03, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x3F, 0xC2, 0xFD,
-    0x00, 0x00, 0x7F, 0x4F, 0xF1, 0xFD, 0x00, 0x00, 0x0B, 0xF3, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xCF, 0xF3, 0xFC, 0x00,
-    0x00, 0x2F, 0xD3, 0xFC, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0xFF, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x3F,
-    0xC0, 0xFF, 0xFC, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF, 0x0B, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF8, 0x39, 0x02, 0xFF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x06, 0xBF, 0xF8, 0x02, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0x80, 0x05, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF6,
-    0x40, 0x07, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x05, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x06, 0xFF, 0x90, 0x3F, 0xFF, 0xF8, 0x2F, 0xFF, 0xFD, 0x04, 0x01, 0xFE, 0x00, 0x00, 0xFD,
-    0x01, 0x57, 0xFC, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0x06, 0xFD, 0x00, 0x00, 0xFF, 0x10,
-    0x00, 0xFF, 0x3F, 0xAB, 0xFE, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x0B, 0xC0, 0x00, 0x5F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xBD, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x3F, 0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x03,
-    0xFC, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x0F, 0xF3, 0xFD, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0xFF, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF5, 0x53, 0xFC, 0x01, 0xFF,
-    0xFD, 0xFF, 0x00, 0x2F, 0xFF, 0x7F, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0x40, 0x1A, 0x90, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0x80, 0xFF, 0x00, 0x3F,
-    0x82, 0xFD, 0x00, 0x3F, 0x87, 0xF8, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0x3F,
-    0xBF, 0xC0, 0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x3F, 0x87, 0xF8, 0x00, 0x3F, 0x82, 0xFE, 0x00, 0x3F,
-    0x80, 0xFF, 0xFC, 0x3F, 0x80, 0x3F, 0xFC, 0x3F, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xBF,
-    0x00, 0x0F, 0xF3, 0xFC, 0x00, 0xFF, 0x4F, 0xF2, 0xCB, 0xF8, 0x3F, 0xCB, 0x7F, 0xC0, 0xFF, 0x2F,
-    0xFC, 0x03, 0xFC, 0xBF, 0xD0, 0x0F, 0xF2, 0xFE, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
-    0x03, 0xFE, 0xFE, 0x00, 0x0F, 0xF3, 0xFD, 0x00, 0x3F, 0xCB, 0xFC, 0x00, 0xFF, 0x2F, 0xF8, 0x03,
-    0xFC, 0xBF, 0xF4, 0x0F, 0xF2, 0xDF, 0xF0, 0x3F, 0xC6, 0x1F, 0xF0, 0xFF, 0x00, 0x2F, 0xE3, 0xFC,
-    0x00, 0x3F, 0xD0, 0x2A, 0x40, 0x1A, 0x90, 0xFE, 0x24, 0xFF, 0x03, 0xF8, 0xEF, 0xF0, 0x0F, 0xE3,
-    0xFF, 0x40, 0x3F, 0x8F, 0xF8, 0x00, 0xFE, 0x7F, 0x80, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xEF, 0xF0,
-    0x00, 0x3F, 0x9F, 0xF0, 0x00, 0xFE, 0x3F, 0xE0, 0x03, 0xF8, 0xFF, 0xE0, 0x0F, 0xE3, 0xBF, 0xD0,
-    0x3F, 0x8D, 0x3F, 0xC0, 0xFE, 0x00, 0x7F, 0xC0, 0x2F, 0xC0, 0x02, 0xFC, 0x0F, 0xF0, 0x01, 0xFE,
-    0x0F, 0xFF, 0xC0, 0xFF, 0x03, 0xFF, 0xF0, 0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x80, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x3F, 0xC0, 0x03, 0xFC,
-    0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x5F, 0xF5, 0x40, 0x00, 0x0F, 0xF0, 0x02, 0xA8, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x2F, 0xD0, 0x0F, 0xF0, 0xBF, 0x80, 0x0F, 0xF1, 0xFE, 0x00, 0x0F, 0xF3, 0xFC,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x0F, 0xF1, 0xFF,
-    0x00, 0x0F, 0xF0, 0xBF, 0x80, 0x0F, 0xF0, 0x2F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03,
-    0xFC, 0xFF, 0xFE, 0x00, 0x0F, 0xE3, 0xFF, 0xFC, 0x00, 0xFF, 0x0F, 0xFF, 0xF0, 0x0B, 0xF4, 0x15,
-    0x7F, 0xC0, 0x7F, 0x80, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xF2,
-    0xFD, 0x00, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x03,
-    0xFC, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x00, 0xFF, 0x00,
-    0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0xAA, 0xAA, 0x00, 0x2A, 0x4F, 0xFF, 0xF0, 0x0F, 0xF0,
-    0xFF, 0xFF, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0xBF, 0x0F, 0xD0, 0x00, 0x0B, 0xF3,
-    0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0x3F, 0xC0, 0x00,
-    0x0B, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x2F, 0xD0, 0x00, 0xBF, 0x00,
-    0xFF, 0x00, 0x0B, 0xF0, 0x03, 0xFC, 0xBF, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF5, 0x55, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xD5, 0x3F, 0xC0, 0x00,
-    0xFF, 0xFE, 0xFF, 0x00, 0x03, 0xFF, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x90, 0x0F, 0xE0, 0x03, 0xF8,
-    0x03, 0xF8, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x0F, 0xE0, 0x0F, 0xF5, 0x57,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xD5, 0x5F, 0xE0, 0x0F, 0xE0,
-    0x03, 0xF8, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x3F, 0xEA, 0x3F, 0x80, 0x0F, 0xFF, 0xCF,
-    0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x03, 0xFF, 0xFB, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x55, 0xFF, 0x00, 0x03, 0xFC,
-    0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF5, 0x55, 0x7F, 0xC0, 0x3F, 0xC0, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x2A,
-    0x40, 0x0A, 0xAA, 0xA3, 0xF8, 0x00, 0xFF, 0xFF, 0x3F, 0x80, 0x0F, 0xFF, 0xF3, 0xF8, 0x00, 0xFE,
-    0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xFD, 0x55, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xD5, 0x5F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0,
-    0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x55, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xE5, 0xBF, 0xFC, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x80, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0xE4, 0x00,
-    0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0xFF, 0xFC, 0x0F, 0xE0, 0x0F, 0xF6, 0xFF, 0x83,
-    0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0xFE, 0x00, 0xFF, 0x01, 0xFC, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x4F,
-    0xE0, 0x0F, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0xBE, 0x40, 0x3F, 0xC0, 0x3F, 0xFE, 0x07, 0xF8, 0x0F, 0xFF, 0xF4, 0x7F, 0x40,
-    0xFE, 0x2F, 0xCB, 0xF4, 0x1F, 0xC1, 0xFC, 0xBF, 0x41, 0xFC, 0x1F, 0xC7, 0xF4, 0x1F, 0xC1, 0xFC,
-    0x7F, 0x81, 0xFC, 0x1F, 0xC3, 0xFC, 0x0F, 0xD3, 0xF8, 0x3F, 0xE0, 0xBF, 0x7F, 0x41, 0xFF, 0x83,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x15, 0x40, 0xBF, 0x42, 0xFF, 0xC2, 0xFC, 0x1F, 0xFF, 0x8F,
-    0xF0, 0xFE, 0x7F, 0x3F, 0xC3, 0xF0, 0xFC, 0xFF, 0x0F, 0xC3, 0xF2, 0xFC, 0x2F, 0x4F, 0xC7, 0xFC,
-    0x7F, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x6F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFD, 0x02, 0xD0, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x24, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0x90, 0x00,
-    0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x60, 0x7F, 0x80, 0x00, 0xBF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0,
-    0x18, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x0B, 0xC0, 0x00, 0x5F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xBE, 0x00, 0x7F, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xD5,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x6A, 0xAA, 0xAA, 0x87, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0xA0, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x02, 0xFD, 0xBF, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xAA, 0x00, 0x0A, 0xA2, 0xFE,
-    0x00, 0x3F, 0xC3, 0xFC, 0x01, 0xFE, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0x80, 0x3F, 0xC2,
-    0xFD, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xFD, 0xFC, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x2F, 0xD0,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x02, 0xFD,
-    0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x05, 0x6F, 0xF5, 0x50, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0A, 0xAF,
-    0xFA, 0x90, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xAA, 0x00,
-    0x0A, 0xA2, 0xFE, 0x00, 0x3F, 0xC3, 0xFC, 0x01, 0xFE, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F,
-    0x80, 0x3F, 0xC2, 0xFD, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xFD, 0xFC, 0x00,
-    0x07, 0xFB, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xBF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0xFF, 0x40,
-    0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x1F, 0xE0,
-    0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xEF,
-    0xD0, 0x00, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0xFF, 0x55,
-    0x07, 0xF8, 0x00, 0xFF, 0xFC, 0x3F, 0xC0, 0x02, 0xFF, 0xF2, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x0A, 0xA0, 0x3F,
-    0xD0, 0x2F, 0xE0, 0x0F, 0xF0, 0x7F, 0xC0, 0x07, 0xF8, 0xFF, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03,
-    0xFE, 0xFE, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x0F, 0xF0, 0x7F, 0xFD, 0x3F, 0xD0, 0x2F, 0xFE, 0x7F,
-    0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0xFF, 0xFF, 0xE2, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0x8B, 0xF0, 0x0B, 0xFF, 0xFF, 0xFE, 0x2F, 0xC0, 0x05, 0x5F, 0xF5, 0x50, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00,
-    0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x02,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD5, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0xA8, 0x6A, 0x00, 0x7F, 0xFF, 0xFC, 0xBF, 0x00, 0x7F, 0xFF, 0xFC, 0xBF, 0x00,
-    0x01, 0xFE, 0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x01,
-    0xFD, 0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x01, 0xFD,
-    0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xA9, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0xBF, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x2F, 0xC0,
-    0x00, 0xFF, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x3F,
-    0xC0, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x1B, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD5, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x0A, 0x90, 0x2F, 0xC0, 0x07, 0xF4, 0x0B, 0xF0, 0x01, 0xFD, 0x02, 0xFC,
-    0x00, 0x7F, 0x40, 0xBF, 0x00, 0x1F, 0xD0, 0x1F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x06, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBE, 0x87, 0xF4, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xEA, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x01, 0xF8, 0x7F, 0x40, 0x01, 0xFC, 0x7F, 0x40, 0x02, 0xFD, 0x7F, 0x40, 0x02, 0xFD, 0x7F,
-    0x40, 0x02, 0xFD, 0x7F, 0x40, 0x02, 0xFD, 0x7F, 0x43, 0xC2, 0xFD, 0x7F, 0x43, 0xC2, 0xFD, 0x7F,
-    0x83, 0xC2, 0xFD, 0x7F, 0xD3, 0xCB, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x06,
-    0xFF, 0xF6, 0xFD, 0x00, 0x03, 0xC2, 0xFD, 0x00, 0x03, 0xC2, 0xFD, 0x00, 0x03, 0xC2, 0xFD, 0x00,
-    0x03, 0x82, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x6A, 0x00, 0x0A, 0x9B, 0xF0,
-    0x00, 0xFE, 0xBF, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0xFE, 0xBF, 0x0F, 0x0F, 0xEB, 0xF0, 0xF0, 0xFE,
-    0xBF, 0x8F, 0x7F, 0xE7, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xE0, 0x6F, 0xF0, 0xFE, 0x00, 0x0F,
-    0x0F, 0xE0, 0x00, 0xF0, 0xFE, 0x00, 0x05, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xF1, 0xBF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x90,
-    0x7F, 0xEF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF0,
-    0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF8, 0x7F, 0x80, 0x3F, 0xBF, 0xFF, 0x43, 0xFF, 0xFF, 0xFC, 0x3F, 0xF4, 0x7F, 0xD3,
-    0xFC, 0x02, 0xFD, 0x3F, 0xC0, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01,
-    0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F,
-    0x80, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x01, 0xFF, 0x41, 0x41,
-    0xFE, 0x00, 0x03, 0xFC, 0xBD, 0x3F, 0xC0, 0x00, 0x1F, 0xCF, 0xD3, 0xFC, 0x00, 0x01, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x17, 0xFD, 0x55, 0x55, 0x54, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x80, 0x00, 0xFF, 0xD0, 0x01, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x81, 0xA1,
-    0xFE, 0x02, 0xFC, 0x3E, 0x2F, 0xC0, 0x0F, 0xD3, 0xF7, 0xFD, 0x55, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x40, 0x00, 0xFF, 0xEA, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x01, 0xFF,
-    0x41, 0x41, 0xFE, 0x00, 0x03, 0xFC, 0xBD, 0x3F, 0xC0, 0x00, 0x1F, 0xCF, 0xD3, 0xFC, 0x00, 0x01,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x17, 0xFD, 0x55, 0x55, 0x54, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x80, 0x00, 0xFF, 0xD0, 0x01, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE4, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x81, 0xA1, 0xFE, 0x02,
-    0xFC, 0x3E, 0x2F, 0xC0, 0x0F, 0xD3, 0xF7, 0xFD, 0x55, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x40, 0x00, 0xFF, 0xEA, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xF2, 0xFF, 0xF4, 0x0F, 0xF0, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xFD, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x00,
-    0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xE0, 0x7F, 0x80, 0x1F, 0xD0, 0x0B, 0xF4,
-    0x0B, 0xF0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xFF, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x7F,
-    0x42, 0xFD, 0x00, 0x02, 0xFC, 0x1F, 0xD1, 0xFE, 0x00, 0x00, 0x3F, 0xC7, 0xF4, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xDB, 0xF9, 0xFF, 0x00, 0x00, 0x2F, 0xE1, 0xFD, 0x2F, 0xE0, 0x00, 0x1F,
-    0xF0, 0x7F, 0x43, 0xFC, 0x00, 0x0F, 0xF4, 0x1F, 0xD0, 0x7F, 0xC0, 0x0B, 0xF8, 0x07, 0xF4, 0x0F,
-    0xF4, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x7F, 0x40, 0x2F, 0xF1, 0xFF, 0x00,
-    0x1F, 0xD0, 0x03, 0xFD, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF6, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x2A, 0x40, 0x2A, 0x82, 0xFC, 0x03, 0xF8, 0x0B, 0xF4,
-    0x0F, 0xF0, 0x3F, 0x80, 0xFE, 0x00, 0x3F, 0x83, 0xF8, 0x3F, 0xC0, 0x02, 0xFC, 0x3F, 0x8B, 0xF0,
-    0x00, 0x0F, 0xF7, 0xF9, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0x7F, 0xEF, 0xF0, 0x00, 0x3F, 0xD3, 0xF8, 0xBF, 0x40, 0x07, 0xF8, 0x3F, 0x83,
-    0xFC, 0x00, 0xFF, 0x03, 0xF8, 0x1F, 0xF0, 0x3F, 0xD0, 0x3F, 0x80, 0xBF, 0x8B, 0xF8, 0x03, 0xF8,
-    0x03, 0xFC, 0xBF, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x7F, 0xC0, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0xFF, 0x3F,
-    0x80, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xA6,
-    0xBF, 0xF4, 0xFF, 0x00, 0x0B, 0xFC, 0xFF, 0x00, 0x02, 0xFD, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x00,
-    0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x14, 0x1F, 0xFC, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x1A, 0xA0, 0xFE, 0x00, 0xFF, 0x43, 0xF8, 0x0F,
-    0xF4, 0x0F, 0xE0, 0xFF, 0x40, 0x3F, 0x8B, 0xF4, 0x00, 0xFE, 0xBF, 0x40, 0x03, 0xFF, 0xFD, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0x46, 0xFF, 0x83, 0xF8, 0x00, 0xFF, 0x0F,
-    0xE0, 0x02, 0xFC, 0x3F, 0x80, 0x07, 0xF4, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x10, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x56, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0x00,
-    0x2F, 0xC0, 0x1F, 0xD0, 0x00, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0x00,
-    0xFE, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x40, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x07, 0xF4, 0x00, 0x0B,
-    0xF0, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x7F,
-    0x40, 0x07, 0xF9, 0x53, 0xFF, 0xC0, 0x01, 0xFF, 0xFD, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x3F, 0xE0,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x03, 0xF8,
-    0x0B, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0xBF, 0x00,
-    0x0F, 0xF0, 0x0B, 0xF0, 0x0F, 0xFE, 0x00, 0xBF, 0xEA, 0xFF, 0xC0, 0x0B, 0xFF, 0xEF, 0xF4, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
-    0x55, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x02, 0xFE, 0x00, 0x50, 0x2F, 0xF0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x93, 0xF8, 0x00, 0xFE, 0x3F, 0x80,
-    0x0F, 0xE3, 0xF8, 0x00, 0xFE, 0x3F, 0x80, 0x0F, 0xE3, 0xFD, 0x55, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xD5, 0x5F, 0xE3, 0xF8, 0x00, 0xFE, 0x3F, 0x80, 0x0F, 0xE3, 0xF8, 0x00,
-    0xFE, 0x3F, 0x80, 0x0F, 0xE3, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFD, 0x00,
-    0x50, 0x7F, 0xC0, 0x0B, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xF5, 0x55, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xD5, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x90, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0,
-    0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xFD, 0x55, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD5, 0x5F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00,
-    0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFF, 0xA8, 0x3F, 0x80, 0x0F, 0xFF, 0xC3, 0xF8, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x01, 0xFC, 0x7F, 0x40, 0x02,
-    0xFD, 0x7F, 0x40, 0x02, 0xFD, 0x7F, 0x40, 0x02, 0xFD, 0x7F, 0x40, 0x02, 0xFD, 0x7F, 0x40, 0x02,
-    0xFD, 0x7F, 0x40, 0x02, 0xFD, 0x7F, 0x80, 0x02, 0xFD, 0x7F, 0xD0, 0x1B, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xE6, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x0A, 0x9B, 0xF0, 0x01, 0xFD,
-    0xBF, 0x00, 0x1F, 0xDB, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x1F, 0xD7, 0xF0, 0x01, 0xFD, 0x7F, 0x80,
-    0x6F, 0xD3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xA1, 0xFD, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x2B, 0xFD, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0x0F,
-    0xFD, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0xFE, 0xFC, 0x00, 0xBD, 0xFD, 0x00,
-    0xFE, 0xBD, 0x00, 0xFC, 0xFD, 0x00, 0xFE, 0x7E, 0x00, 0xF8, 0xFD, 0x00, 0xFE, 0x3F, 0x02, 0xF4,
-    0xFD, 0x00, 0xFE, 0x3F, 0x43, 0xF0, 0xFD, 0x00, 0xFE, 0x2F, 0x83, 0xE0, 0xFD, 0x00, 0xFE, 0x0F,
-    0xCB, 0xD0, 0xFD, 0x00, 0xFE, 0x0F, 0xCF, 0xC0, 0xFD, 0x00, 0xFE, 0x0B, 0xEF, 0xC0, 0xFD, 0x00,
-    0xFE, 0x07, 0xFF, 0x40, 0xFD, 0x54, 0xFE, 0x03, 0xFF, 0x00, 0xFF, 0xFC, 0xFE, 0x02, 0xFF, 0x00,
-    0xFF, 0xFC, 0xFE, 0x01, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x2A,
-    0xA0, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0xD0, 0x0F,
-    0xFF, 0x00, 0x3F, 0xBF, 0x01, 0xFB, 0xF0, 0x03, 0xF7, 0xF0, 0x3F, 0x7F, 0x00, 0x3F, 0x6F, 0x43,
-    0xE7, 0xF0, 0x03, 0xF4, 0xFC, 0xBD, 0x7F, 0x00, 0x3F, 0x4F, 0xDF, 0xC7, 0xF0, 0x03, 0xF4, 0x7F,
-    0xF8, 0x7F, 0x00, 0x3F, 0x43, 0xFF, 0x07, 0xF0, 0x03, 0xF4, 0x3F, 0xF0, 0x7F, 0xEA, 0x3F, 0x41,
-    0xFE, 0x07, 0xFF, 0xE3, 0xF4, 0x0F, 0xC0, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xF2, 0xFF, 0xF4, 0x0F, 0xF0, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xFD, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x54,
-    0x01, 0x50, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x00, 0xBF, 0xAF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00,
-    0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x01, 0x40, 0x15, 0x02, 0xF8, 0x2F,
-    0x80, 0x7F, 0x5F, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD,
-    0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x5B,
-    0xFC, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4, 0x0B, 0xF3, 0xFC, 0x02, 0xFC, 0xFF, 0x00,
-    0xFF, 0x3F, 0xFA, 0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x0B, 0x40, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0xBE, 0x1F, 0xC0, 0x00, 0x01, 0x40, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0xBF, 0x2F, 0xC0,
-    0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x03, 0xFC,
-    0x07, 0xF4, 0x00, 0x7F, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x47, 0xF8, 0x00,
-    0x07, 0xFC, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x07, 0x80, 0xB4, 0x03, 0xF4, 0x7F, 0x00, 0xFD, 0x1F,
-    0xC0, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF8, 0x09, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x05, 0x6F, 0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xFE,
-    0xFF, 0x3F, 0xD0, 0x2F, 0xCF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xFF, 0xEB, 0xFF, 0x1F, 0xFF,
-    0xDF, 0xC1, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFD, 0xBF, 0x95, 0x54, 0x00,
-    0x0F, 0xE1, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00,
-    0x00, 0x1F, 0xD0, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0x01, 0xFF, 0xFF, 0xF0, 0x03, 0xF8, 0x07, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xE5, 0x6F, 0xE5, 0x54, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFD, 0x7F, 0x40, 0x01, 0xFF, 0xFF, 0xF7, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0x80, 0x7F, 0x90, 0x07, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x14, 0x03, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x15, 0x7F, 0xD5, 0x5F, 0xF1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xBF, 0x40, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x12, 0xFF, 0x6F, 0xFF, 0xEA, 0xBC, 0x7F,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x01, 0x51, 0xFC, 0x0F, 0xC3, 0xFA, 0xFF, 0x07, 0xFF, 0xF0, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0x55, 0x53, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF,
-    0xFE, 0x05, 0x40, 0x14, 0x03, 0xF8, 0x2F, 0x80, 0x7F, 0x5F, 0xD0, 0x0F, 0xFF, 0xE0, 0x00, 0x6F,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x0F, 0xF0,
-    0x2F, 0xD7, 0xF4, 0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x0B, 0xFE, 0x08, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00,
-    0x1F, 0xE3, 0xF8, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x1F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x0F, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x90, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xEB, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xAA, 0xFF, 0xAF, 0xC0, 0x1F, 0xD7, 0xF0, 0x0F, 0xF0, 0xFF,
-    0x9F, 0xF8, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0E, 0x00,
-    0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90,
-    0x0B, 0xFE, 0x08, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x1F, 0xE3, 0xF8, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x1F,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0xE0, 0x03, 0xF0, 0xBE, 0x00, 0xFC, 0x2F, 0x80, 0x04, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x90, 0x03, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF4, 0x24, 0x01, 0xFF, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFA, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xEA, 0xBF, 0xEB,
-    0xF0, 0x07, 0xF5, 0xFC, 0x03, 0xFC, 0x3F, 0xE7, 0xFE, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xD1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x3F, 0x81, 0xFE, 0x00, 0x7F, 0x40, 0x2F, 0xD0, 0x2F,
-    0xC0, 0x1F, 0xD0, 0x1F, 0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x0F, 0xF0, 0x00, 0x7F, 0x81, 0xFD, 0x0B,
-    0xF4, 0x00, 0x0B, 0xF0, 0x7F, 0x47, 0xF8, 0x00, 0x00, 0xFF, 0x1F, 0xD3, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0x6F, 0xE7, 0xFC, 0x00, 0x00, 0xBF, 0x87, 0xF4, 0xBF, 0x80, 0x00, 0x7F, 0xC1,
-    0xFD, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x7F, 0x41, 0xFF, 0x00, 0x2F, 0xE0, 0x1F, 0xD0, 0x3F, 0xD0,
-    0x0F, 0xF0, 0x07, 0xF4, 0x03, 0xFC, 0x0F, 0xF4, 0x01, 0xFD, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x7F,
-    0x40, 0x0F, 0xF4, 0x00, 0x02, 0xC0, 0xB8, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xE0, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4,
-    0x02, 0xA4, 0x02, 0xA8, 0x2F, 0xC0, 0x3F, 0x80, 0xBF, 0x40, 0xFF, 0x03, 0xF8, 0x0F, 0xE0, 0x03,
-    0xF8, 0x3F, 0x83, 0xFC, 0x00, 0x2F, 0xC3, 0xF8, 0xBF, 0x00, 0x00, 0xFF, 0x7F, 0x9F, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF7, 0xFE, 0xFF, 0x00,
-    0x03, 0xFD, 0x3F, 0x8B, 0xF4, 0x00, 0x7F, 0x83, 0xF8, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0x81, 0xFF,
-    0x03, 0xFD, 0x03, 0xF8, 0x0B, 0xF8, 0xBF, 0x80, 0x3F, 0x80, 0x3F, 0xC0, 0x0B, 0x81, 0xE0, 0x03,
-    0xF0, 0xFE, 0x00, 0xFC, 0x2F, 0x40, 0x04, 0x01, 0x40, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF8, 0x39, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x07, 0xF8, 0x06, 0xBF, 0xF8, 0x02, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80, 0x05, 0x5F, 0xFC,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF6, 0x40, 0x07, 0xFC, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xE0, 0x0F, 0xC2, 0xF8,
-    0x0F, 0xC2, 0xF8, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x3F, 0xFF, 0xF8, 0x2F,
-    0xFF, 0xFD, 0x04, 0x01, 0xFE, 0x00, 0x00, 0xFD, 0x01, 0x57, 0xFC, 0x03, 0xFF, 0xE0, 0x03, 0xFF,
-    0xF8, 0x00, 0x06, 0xFD, 0x00, 0x00, 0xFF, 0x10, 0x00, 0xFF, 0x3F, 0xAB, 0xFE, 0x3F, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x55, 0x6F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F,
-    0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x64, 0x00, 0x3F, 0xD7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xE0, 0x01, 0xAB, 0xFF, 0x80,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02,
-    0xFD, 0x75, 0x00, 0xBF, 0xC7, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFD, 0x01, 0xBF, 0xFE, 0x00, 0x00,
-    0xAA, 0xAA, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x07, 0xFD, 0xFF, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x1F, 0xFD, 0xFF, 0x00, 0x3F, 0xFD, 0xFF,
-    0x00, 0x7F, 0xFD, 0xFF, 0x00, 0xFE, 0xFD, 0xFF, 0x02, 0xFD, 0xFD, 0xFF, 0x03, 0xF5, 0xFD, 0xFF,
-    0x0B, 0xF1, 0xFD, 0xFF, 0x0F, 0xD1, 0xFD, 0xFF, 0x2F, 0xC1, 0xFD, 0xFF, 0x3F, 0x41, 0xFD, 0xFF,
-    0xBF, 0x01, 0xFD, 0xFF, 0xFC, 0x01, 0xFD, 0xFF, 0xF8, 0x01, 0xFD, 0xFF, 0xF0, 0x01, 0xFD, 0xFF,
-    0xE0, 0x01, 0xFD, 0xFF, 0xC0, 0x01, 0xFD, 0x06, 0xAA, 0xA4, 0x02, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x6A, 0xBF, 0x80, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x83, 0xFB, 0xFF, 0xE2, 0xF6, 0xFF, 0xF9, 0xF8, 0xBF, 0xFE, 0xFC,
-    0x3F, 0xFF, 0xBE, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0,
-    0x0F, 0xF0, 0x00, 0xB0, 0x2E, 0x00, 0x02, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x50,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0x0F, 0xFD, 0xFF, 0x00,
-    0x1F, 0xFD, 0xFF, 0x00, 0x3F, 0xFD, 0xFF, 0x00, 0x7F, 0xFD, 0xFF, 0x00, 0xFE, 0xFD, 0xFF, 0x02,
-    0xFD, 0xFD, 0xFF, 0x03, 0xF5, 0xFD, 0xFF, 0x0B, 0xF1, 0xFD, 0xFF, 0x0F, 0xD1, 0xFD, 0xFF, 0x2F,
-    0xC1, 0xFD, 0xFF, 0x3F, 0x41, 0xFD, 0xFF, 0xBF, 0x01, 0xFD, 0xFF, 0xFC, 0x01, 0xFD, 0xFF, 0xF8,
-    0x01, 0xFD, 0xFF, 0xF0, 0x01, 0xFD, 0xFF, 0xE0, 0x01, 0xFD, 0xFF, 0xC0, 0x01, 0xFD, 0x07, 0x80,
-    0xB0, 0x03, 0xF4, 0xBF, 0x00, 0xFD, 0x1F, 0x80, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2A, 0x40,
-    0x1A, 0xAF, 0xE0, 0x0F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xE0,
-    0xFE, 0xFF, 0xF8, 0xBD, 0xBF, 0xFE, 0x7E, 0x2F, 0xFF, 0xBF, 0x0F, 0xFF, 0xEF, 0x83, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x2D, 0x07, 0x80,
-    0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00,
-    0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB,
-    0xF4, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00,
-    0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00,
-    0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xB8, 0x00, 0xBF, 0x0F, 0xC0, 0x07,
-    0xE0, 0xFC, 0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0xBF, 0x87, 0xF4, 0x03, 0xFC, 0xBF, 0x00, 0x2F, 0xDF, 0xF0,
-    0x01, 0xFD, 0xFF, 0x00, 0x1F, 0xDB, 0xF0, 0x02, 0xFD, 0xBF, 0x40, 0x2F, 0xC3, 0xFC, 0x07, 0xFC,
-    0x2F, 0xFA, 0xFF, 0x40, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xF4, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x3F, 0xC7, 0xF4, 0x00,
-    0x02, 0xFC, 0xBF, 0xAA, 0xAA, 0xBF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB,
-    0xF9, 0x55, 0x56, 0xFD, 0x7F, 0x40, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0x7F, 0x81, 0xFF, 0x40, 0x1F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00,
-    0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0xBF, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xFD, 0xFF, 0x55, 0x7F, 0xDB, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x7F, 0x82, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x07,
-    0x80, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xF4, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x3F, 0xC7, 0xF4,
-    0x00, 0x02, 0xFC, 0xBF, 0xAA, 0xAA, 0xBF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xF9, 0x55, 0x56, 0xFD, 0x7F, 0x40, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0,
-    0x00, 0x7F, 0x81, 0xFF, 0x40, 0x1F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0xB8, 0x00, 0xBF, 0x0F, 0xC0,
-    0x07, 0xE0, 0xFC, 0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0xBF, 0x8B, 0xF4, 0x03, 0xFC, 0xBF, 0x00, 0x2F, 0xCF,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xDF, 0xF5, 0x57, 0xFD, 0xBF, 0x00, 0x3F, 0xC3, 0xFC, 0x07,
-    0xF8, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x42, 0xE0, 0x02, 0xFC, 0x3F, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF9, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x39, 0x01, 0xFF, 0x80, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x06, 0xAA, 0xAF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x3F, 0xC5, 0x00, 0x1F, 0xFC, 0xBF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xC0, 0x6F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x41, 0xE0, 0x07, 0xF0, 0xFC, 0x01, 0xFC, 0x3F, 0x00, 0x14, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x03, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF0, 0x04, 0x07, 0xFD,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x55, 0x7F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x40, 0x0F, 0xF4, 0x3F, 0xBF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x3F, 0x82, 0xFC, 0x00,
-    0x2F, 0xC0, 0x3F, 0x80, 0x0F, 0xE0, 0x0F, 0xF0, 0x07, 0xF4, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F,
-    0xC0, 0xFD, 0x00, 0x07, 0xF4, 0xBF, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x1F, 0xDF, 0xC0, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x01, 0xA8, 0x2F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0,
-    0x07, 0xF4, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xF4, 0x0F, 0xE0, 0x03, 0xF8, 0x1F, 0xD0, 0x02, 0xFC,
-    0x2F, 0xC0, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x1E, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x0F,
-    0xC3, 0xF4, 0x00, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC3,
-    0xFC, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x03, 0xF8, 0x03, 0xFC, 0x01, 0xFD,
-    0x00, 0x7F, 0x40, 0xBF, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x3F, 0x8F,
-    0xE0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x1E, 0x00,
-    0x00, 0xFC, 0x3F, 0x40, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x80, 0x01, 0xA8, 0x2F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x07, 0xF4, 0x0F, 0xF0, 0x0B, 0xF0,
-    0x07, 0xF4, 0x0F, 0xE0, 0x03, 0xF8, 0x1F, 0xD0, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0xFD, 0x3F, 0x80,
-    0x00, 0xFE, 0x3F, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7E, 0x2F,
-    0x40, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0xFF, 0x00,
-    0x03, 0xF8, 0x2F, 0xC0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x1F,
-    0xD0, 0x2F, 0xC0, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x7F, 0x4B, 0xF0, 0x00, 0x0F, 0xE3, 0xF8, 0x00,
-    0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x3F, 0x80, 0x0B, 0xE3, 0xF8, 0x00, 0x7E, 0x2F, 0x40, 0x03, 0xD0, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xA0, 0x00, 0x6A, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0x80, 0x1F, 0xD0, 0xBF, 0x00, 0xBF,
-    0x01, 0xFD, 0x03, 0xF8, 0x03, 0xF8, 0x1F, 0xD0, 0x0B, 0xF0, 0xBF, 0x00, 0x0F, 0xD3, 0xF8, 0x00,
-    0x2F, 0x9F, 0xC0, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xB0, 0x2D,
-    0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0xFE, 0x7F, 0x80, 0x03, 0xF9, 0xFE,
-    0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFE, 0x3F, 0xC0, 0x03, 0xF8, 0xFF, 0xD5,
-    0xBF, 0xE1, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFE, 0x00, 0xAF, 0x97, 0xF8, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x80, 0x03, 0x80, 0xB4, 0x02, 0xF8, 0x7F, 0x00, 0xBE, 0x0F, 0xC0, 0x05, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x0A, 0xAB, 0xF0, 0x03, 0xFE, 0xFC, 0x00, 0xFF, 0xBF, 0x00,
-    0x3F, 0xEF, 0xC0, 0x0F, 0xF7, 0xF4, 0x03, 0xFD, 0xFF, 0x96, 0xFF, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xF0, 0x16, 0x93, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0x55, 0x54, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x54, 0x00, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA0, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0x4F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFA, 0x80, 0x3F, 0xFF, 0x00, 0xFF, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x1E, 0x02, 0xD0, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x01, 0x40,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xEA, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xF5, 0x6F, 0xF4, 0x3F, 0xFF, 0xC0, 0x1F, 0xE0, 0xFF, 0xFF, 0x00, 0x3F, 0xC3, 0xFF,
-    0xFC, 0x00, 0xFF, 0x0F, 0xFF, 0xF0, 0x07, 0xFC, 0x3F, 0xFF, 0xC0, 0x7F, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF9, 0x00, 0x3F, 0xC0, 0x00, 0x38, 0x0B,
-    0x40, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x01, 0x40, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0xA8, 0xFE, 0x00, 0x00, 0x1F, 0xDF, 0xE0, 0x00, 0x01,
-    0xFD, 0xFE, 0x00, 0x00, 0x1F, 0xDF, 0xF5, 0x40, 0x01, 0xFD, 0xFF, 0xFF, 0xE0, 0x1F, 0xDF, 0xFF,
-    0xFF, 0xC1, 0xFD, 0xFF, 0x5B, 0xFD, 0x1F, 0xDF, 0xE0, 0x1F, 0xE1, 0xFD, 0xFE, 0x00, 0xFE, 0x1F,
-    0xDF, 0xE0, 0x2F, 0xD1, 0xFD, 0xFF, 0xFF, 0xFC, 0x1F, 0xDF, 0xFF, 0xFF, 0x41, 0xFD, 0xFF, 0xFF,
-    0x80, 0x1F, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD0, 0xFF, 0x55,
-    0x54, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x55, 0x40, 0x7F,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x6F, 0xFA, 0xA8, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xFD, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA9, 0x1F, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFE, 0x1F, 0xE5, 0x55, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xD0, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xFA, 0x40, 0x1F,
-    0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x00, 0x02, 0xA4, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0xD0,
-    0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x03, 0xFD, 0x2F, 0xD0, 0x00, 0x0F, 0xF7,
-    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x01, 0xFE, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC2, 0xFE, 0x00, 0x0B, 0xF4, 0x0F, 0xF5, 0x41, 0xFF, 0x00, 0x7F, 0xFE, 0x3F,
-    0xD0, 0x02, 0xFF, 0xEB, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x0A, 0xA0, 0x3F, 0xD0, 0x3F, 0xD0,
-    0x0F, 0xF0, 0x7F, 0x80, 0x0B, 0xF4, 0xFF, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x0B, 0xF8, 0xFF, 0x00, 0x0F, 0xF0, 0x7F, 0xE8, 0x3F, 0xD0, 0x3F, 0xFD, 0xBF, 0x80, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0A, 0x90, 0x7F, 0xC0, 0x01, 0xFF, 0x0B, 0xF4, 0x00, 0xFF,
-    0x40, 0xFF, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x3F, 0xC0, 0x03, 0xFD, 0x2F, 0xD0, 0x00, 0x3F, 0xDF,
-    0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x6A, 0xFF, 0xFE, 0xA0, 0x2F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x41, 0x5B, 0xFF, 0xF5, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00,
-    0xFF, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0xFF, 0x40, 0x7F, 0xC0, 0x1F, 0xF0, 0x3F, 0xD0, 0x02, 0xFE,
-    0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x6A, 0x80, 0x0A, 0xA0, 0xFF, 0x40, 0xFF, 0x40, 0xFF, 0x07, 0xF8,
-    0x02, 0xFD, 0x3F, 0xC0, 0x03, 0xFE, 0xFD, 0x00, 0x1B, 0xFF, 0xF5, 0x03, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x1A, 0xFF, 0xFE, 0x80, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0x8F, 0xF0, 0x03, 0xFC,
-    0x1F, 0xE0, 0x3F, 0xD0, 0x3F, 0xD2, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0D, 0x00, 0x0D, 0x2F,
-    0xFC, 0xA0, 0xD2, 0x8C, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0,
-    0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1C, 0x01, 0xC0, 0x0F, 0xFE, 0x1C, 0x28, 0x1C, 0xA0, 0x02, 0x80, 0x0A, 0x00,
-    0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00,
-    0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0x00, 0x15, 0x54, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFC,
-    0x15, 0x54, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xF6, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x2A, 0xAA,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xA8, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB,
-    0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0,
-    0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D,
-    0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0x68,
-    0x02, 0x90, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x2A, 0xAA, 0xA8, 0x0B, 0xC0, 0xFC, 0x2F, 0x83, 0xF4, 0x7F, 0x0B, 0xF0, 0x15, 0x00, 0x1F,
-    0xC2, 0xFC, 0x3F, 0x43, 0xF0, 0x7E, 0x0B, 0xD0, 0x14, 0x00, 0x0F, 0xD1, 0xFC, 0x2F, 0xC3, 0xF4,
-    0x3F, 0x03, 0xE0, 0x14, 0x00, 0xBF, 0x07, 0xF0, 0x3F, 0x42, 0xF8, 0x1F, 0x80, 0xFC, 0x01, 0x40,
-    0x0B, 0xC0, 0xF8, 0x3F, 0x07, 0xE2, 0xF8, 0x3F, 0x4F, 0xD0, 0xFC, 0x7F, 0x0B, 0xF2, 0xFC, 0x3F,
-    0x81, 0x50, 0x54, 0x00, 0x1F, 0xC2, 0xF8, 0xBF, 0x0F, 0xE3, 0xF4, 0x3F, 0x0F, 0xC1, 0xFC, 0x7E,
-    0x0B, 0xD2, 0xF4, 0x3F, 0x01, 0x40, 0x50, 0x00, 0x0F, 0xD1, 0xFC, 0x0F, 0xD2, 0xFC, 0x1F, 0xC2,
-    0xF8, 0x2F, 0x83, 0xF4, 0x3F, 0x03, 0xF0, 0x3F, 0x07, 0xD0, 0x14, 0x01, 0x40, 0xBF, 0x0F, 0xE1,
-    0xFC, 0x2F, 0xC3, 0xF4, 0x7F, 0x0B, 0xE0, 0xFC, 0x1F, 0x82, 0xF4, 0x3F, 0x03, 0xE0, 0x14, 0x05,
-    0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x02, 0xFF,
-    0xFF, 0xDB, 0xFF, 0xFF, 0x5A, 0x7E, 0x69, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00,
-    0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2E,
-    0x00, 0x69, 0xFD, 0xA6, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x80, 0x2E, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2E, 0x00, 0xBF, 0xFF, 0xFA, 0xFF, 0xFF, 0xE6, 0x9F, 0xEA, 0x40,
-    0x2E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x3F, 0xF8, 0xBF,
-    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xBF, 0xFC, 0x3F, 0xF4, 0x0A, 0x90, 0x50, 0x00, 0x2E, 0x00, 0x0B,
-    0xF4, 0x02, 0xFF, 0xD0, 0xBF, 0xFE, 0x2F, 0xFE, 0x0B, 0xFD, 0x02, 0xF4, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x3F, 0xDF, 0xF6, 0xFC, 0x04, 0x00, 0x2E, 0x00, 0x7D, 0x2F, 0xE0, 0x3F, 0xCB,
-    0xF8, 0x0F, 0xF1, 0xFD, 0x03, 0xF8, 0x04, 0x00, 0x10, 0x00, 0x2E, 0x00, 0xB8, 0x02, 0xE2, 0xFE,
-    0x07, 0xF8, 0x1F, 0xFB, 0xF8, 0x1F, 0xF0, 0x7F, 0xDF, 0xD0, 0x3F, 0x40, 0xFE, 0x04, 0x00, 0x10,
-    0x00, 0x40, 0x2E, 0x2F, 0xEB, 0xF9, 0xFD, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xDA, 0x00, 0x28, 0x00,
-    0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02,
-    0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xAF, 0x80, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC3, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x0F, 0xC7, 0xE1, 0xFD, 0x00, 0x2F, 0x80, 0x2F, 0xAF, 0xCF, 0xCB, 0xFF, 0x80,
-    0xFF, 0xF0, 0x0F, 0xFF, 0x1F, 0x4F, 0xEF, 0xC2, 0xFA, 0xF8, 0x07, 0xFD, 0x3F, 0x1F, 0x47, 0xE3,
-    0xF0, 0xFC, 0x00, 0x00, 0xBD, 0x2F, 0x43, 0xE3, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x2F, 0x43, 0xF3,
-    0xE0, 0xBC, 0x00, 0x02, 0xF4, 0x2F, 0x43, 0xF3, 0xE0, 0xBC, 0x00, 0x07, 0xE0, 0x2F, 0x47, 0xE3,
-    0xF0, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xCF, 0xD3, 0xF5, 0xFC, 0x00, 0x1F, 0x80, 0x0B, 0xFF, 0xC1,
-    0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0xBF, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC7, 0xE1, 0xFE, 0x00, 0x2F, 0x80, 0x07, 0xF8, 0x0F, 0xEB,
-    0xF3, 0xF2, 0xFF, 0xF0, 0x3F, 0xFD, 0x0B, 0xFF, 0x80, 0xFF, 0xF5, 0xF8, 0xFE, 0xFD, 0x2F, 0xEF,
-    0xC3, 0xFB, 0xF4, 0x1F, 0xF4, 0xFC, 0x7E, 0x1F, 0x8F, 0xC3, 0xF1, 0xF8, 0x7E, 0x00, 0x00, 0xBD,
-    0x2F, 0x43, 0xF3, 0xF0, 0xBD, 0xBD, 0x0F, 0xC0, 0x00, 0x3F, 0x0B, 0xD0, 0xFC, 0xFC, 0x2F, 0x6F,
-    0x43, 0xF0, 0x00, 0x2F, 0x42, 0xF4, 0x3F, 0x3F, 0x0B, 0xDB, 0xD0, 0xFC, 0x00, 0x0F, 0xC0, 0x7E,
-    0x0F, 0xCF, 0xC2, 0xF5, 0xF8, 0x3F, 0x00, 0x0B, 0xC0, 0x0F, 0xDB, 0xE2, 0xF9, 0xFC, 0x3F, 0x6F,
-    0x80, 0x07, 0xE0, 0x02, 0xFF, 0xF0, 0x3F, 0xFE, 0x0B, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xF0,
-    0x07, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x1F, 0xC0, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF4, 0x06, 0x40, 0x00, 0x02, 0xF4, 0x7F, 0x01,
-    0xFC, 0x3F, 0x40, 0xFC, 0x1F, 0xC0, 0x7E, 0x0F, 0xC0, 0x3F, 0x07, 0xD0, 0x1F, 0x43, 0xF0, 0x06,
-    0x40, 0xA0, 0x00, 0x02, 0xF4, 0x7F, 0x0B, 0xD0, 0x7F, 0x0F, 0xD1, 0xFC, 0x0F, 0xC1, 0xFC, 0x3F,
-    0x41, 0xF8, 0x3F, 0x07, 0xE0, 0x3F, 0x07, 0xD0, 0xFC, 0x07, 0xD0, 0xFC, 0x1F, 0x40, 0x64, 0x0A,
-    0x01, 0x90, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x03, 0xD0, 0x06, 0x40,
-    0x7E, 0x0B, 0xD0, 0x0F, 0xD1, 0xFC, 0x00, 0xFC, 0x2F, 0x40, 0x2F, 0x43, 0xF0, 0x03, 0xF0, 0x7D,
-    0x00, 0x3D, 0x0B, 0xC0, 0x06, 0x40, 0xA0, 0x7E, 0x0B, 0xD1, 0xFC, 0x03, 0xF4, 0x7F, 0x0F, 0xD0,
-    0x0F, 0xC2, 0xF4, 0x3F, 0x00, 0xBD, 0x0F, 0xC1, 0xF4, 0x03, 0xF0, 0x7D, 0x0F, 0xC0, 0x0F, 0x42,
-    0xF0, 0x3D, 0x00, 0x64, 0x0A, 0x01, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xF4, 0x00, 0x3F,
-    0xC0, 0x07, 0xAD, 0x00, 0xF0, 0xF0, 0x1E, 0x0B, 0x43, 0xC0, 0x3C, 0x7C, 0x02, 0xD0, 0x00, 0x10,
-    0x00, 0x1F, 0x40, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x07, 0xF8, 0x00, 0x7F, 0x40, 0x0B, 0xE0, 0x00, 0x90, 0x01, 0x00, 0x07, 0xE0, 0x02, 0xFD, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF0, 0x0B, 0xF4, 0x07, 0xF8, 0x02,
-    0xF8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xF0, 0x01, 0x02, 0xF0, 0x0F,
-    0xD0, 0x2F, 0x0F, 0xF0, 0x3F, 0x42, 0xFC, 0x0F, 0xF0, 0x68, 0x2F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC,
-    0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x29, 0x0F, 0xFF, 0xC0, 0xA2, 0xFC,
-    0x0F, 0xFC, 0x0F, 0xFB, 0xF0, 0x2F, 0xF0, 0x3F, 0xDF, 0x82, 0xFF, 0xF0, 0x7E, 0x00, 0x2F, 0xDF,
-    0xF0, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x02, 0xFC, 0x04, 0x0F, 0xE0,
-    0x2F, 0xC0, 0xFC, 0x0F, 0xE0, 0xFC, 0x03, 0xF8, 0x0F, 0xC0, 0x80, 0x0F, 0xD0, 0x0C, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0xBF, 0x81, 0xFE, 0x7F, 0x81, 0xFE, 0x7F, 0x41, 0xFE, 0x7F,
-    0x40, 0xFE, 0x7F, 0x40, 0xFE, 0x7F, 0x40, 0xFD, 0x3F, 0x40, 0xFD, 0x3F, 0x00, 0xFD, 0x3F, 0x00,
-    0xFD, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xB8,
-    0xBF, 0x81, 0xFE, 0xBF, 0x81, 0xFF, 0x7F, 0x40, 0xFD, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0xBF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFC, 0x3B, 0xF1, 0xFC, 0x03, 0xF0, 0xFD, 0x03, 0xF0,
-    0xFC, 0x03, 0xF3, 0xFC, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x02, 0xFC, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB4, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x15, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0x0B, 0x03, 0xD0,
-    0x00, 0xF4, 0x03, 0xFA, 0xBF, 0x40, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x2B, 0xA4, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0xF8, 0x00, 0x7C, 0x0B, 0x00, 0x00, 0x3C, 0x70, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00,
-    0x3C, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x40, 0x00,
-    0xFF, 0x00, 0x07, 0x9D, 0x00, 0x3C, 0x3C, 0x01, 0xE0, 0xB4, 0x0B, 0x00, 0xF0, 0x38, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7C, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBE,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xA5, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x01,
-    0x01, 0x40, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x50, 0x3D, 0x06, 0x00, 0x90, 0xBC, 0x18, 0xBF, 0xBE, 0xFF, 0x00, 0xFF, 0xFE, 0xFD,
-    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFE, 0x5A, 0xFF, 0xA5, 0x00, 0x5B, 0xFF, 0xA4, 0x01, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFB, 0xD0, 0x00, 0x0B, 0xDF, 0xC0, 0x0F, 0xD3, 0xF0, 0x00,
-    0x1F, 0xCB, 0xE0, 0x0F, 0xC2, 0xF4, 0x00, 0x2F, 0x43, 0xE0, 0x01, 0x40, 0x40, 0x00, 0x02, 0x01,
-    0x00, 0x15, 0x52, 0xFF, 0xFB, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0xF9, 0xFF, 0xE7, 0xFA, 0x5F, 0xC0, 0x7F, 0x01,
-    0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFD, 0x47, 0xFF, 0x9F, 0xFE, 0x7F, 0x51, 0xFC, 0x07,
-    0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xE9, 0x7F, 0xF8, 0xFF, 0xE0, 0x7F, 0xF5,
-    0xFF, 0xE6, 0xBF, 0x80, 0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x80, 0xBE, 0x02, 0xF8, 0x5B, 0xE7,
-    0xFF, 0x9F, 0xFE, 0x17, 0xF8, 0x0B, 0xE0, 0x2F, 0x80, 0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x8A,
-    0xFE, 0x7F, 0xF9, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x1B, 0xFF,
-    0x80, 0xBF, 0xFF, 0xF4, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x39, 0x02, 0xFD,
-    0x38, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0xC0, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC,
-    0x00, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x02, 0xFD, 0xBF, 0xFF, 0xF4, 0x2F, 0xE7, 0xFF, 0xFF, 0xC2, 0xFD, 0x39,
-    0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x0F, 0xD1, 0xFD, 0x00, 0x01, 0xFD, 0x1F, 0xD0, 0x00, 0x3F, 0xC1,
-    0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xC0, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0xB8, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x3F, 0xD0, 0x02, 0xFE, 0x02, 0xFC,
-    0x00, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0B, 0xFF, 0xD0,
-    0xBF, 0x87, 0xFF, 0xFF, 0x87, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0x42, 0x90, 0x2F, 0xD7, 0xF4, 0x00,
-    0x00, 0xFE, 0x7F, 0x40, 0x00, 0x0F, 0xD7, 0xF4, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x01, 0xFF, 0x43,
-    0xF0, 0x00, 0x7F, 0xD0, 0x3F, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0xBF,
-    0x80, 0x2F, 0xD0, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x7F, 0x40, 0x1F, 0xC0, 0x00, 0x40, 0x00, 0x10,
-    0x00, 0xAA, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-    0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF4, 0x3D, 0x7F, 0xFF, 0xC3, 0xC3, 0xFF, 0xFD, 0x3C, 0x3F, 0xFF,
-    0xE3, 0xC3, 0xFF, 0xFF, 0x3C, 0x3F, 0xFF, 0xF3, 0xC3, 0xFF, 0xFE, 0x3C, 0x3F, 0xFF, 0xE3, 0xC3,
-    0xFF, 0xFD, 0x3C, 0x3F, 0xFF, 0xC3, 0xC3, 0xFF, 0xE0, 0x3C, 0x3D, 0x50, 0x03, 0xC3, 0xC0, 0x00,
-    0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C,
-    0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0xAA, 0x80, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFC, 0x3C, 0x7F, 0xFF,
-    0xC3, 0xCB, 0xFF, 0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xCB, 0xFF, 0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xC7,
-    0xFF, 0xFC, 0x3C, 0x3F, 0xFF, 0xEB, 0xC0, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0xAA, 0xAA,
-    0x90, 0x0F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0xFF, 0xF8, 0xF0, 0xFF, 0xFF, 0xCF,
-    0x0F, 0xFF, 0xFC, 0xF0, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF, 0xFC, 0xF0, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF,
-    0xF8, 0xFA, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x90, 0x7C, 0x09, 0x3F, 0xFF, 0xBF, 0x8F, 0xFF, 0xFF, 0xE1,
-    0x6B, 0xFE, 0x54, 0x03, 0xFF, 0x40, 0x02, 0xFB, 0xF0, 0x01, 0xFC, 0x7F, 0x00, 0x7E, 0x0F, 0x80,
-    0x01, 0x01, 0x00, 0x2E, 0x07, 0xF8, 0xBF, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x43, 0xF8, 0x1F, 0xC0, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x2B,
-    0xA4, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x7C, 0x0B, 0x00, 0x00, 0x3C, 0x70, 0x00, 0x00,
-    0x34, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0xE3, 0xC0, 0x00, 0x0B, 0x03, 0xD0, 0x00, 0xF4, 0x03, 0xFA, 0xBF, 0x40, 0x01, 0xBF, 0xD0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x90, 0x7C, 0x09, 0x3F, 0xFF, 0xBF,
-    0x8F, 0xFF, 0xFF, 0xE1, 0x6B, 0xFE, 0x54, 0x03, 0xFF, 0x40, 0x02, 0xFB, 0xF0, 0x01, 0xFC, 0x7F,
-    0x00, 0x7E, 0x0F, 0x80, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xBC, 0x00, 0x24, 0x1F, 0x02, 0x4F, 0xFF, 0xEF, 0xE3, 0xFF, 0xFF, 0xF8, 0x5A, 0xFF,
-    0x95, 0x00, 0xFF, 0xD0, 0x00, 0xBE, 0xFC, 0x00, 0x7F, 0x1F, 0xC0, 0x1F, 0x83, 0xE0, 0x00, 0x40,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xDF, 0xF4, 0x3F, 0x3F, 0xC1, 0xF4, 0x3E, 0x0F, 0xC0,
-    0x00, 0x7E, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0xB8, 0x3F, 0x0B,
-    0xF5, 0xF8, 0x2F, 0xDB, 0xD0, 0x7F, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFE, 0x40, 0x00, 0x3C, 0x3F, 0xFF, 0xFF, 0xFF, 0xAA, 0xF8, 0xBD, 0x01, 0xAF, 0xFF, 0xFF,
-    0xE0, 0xA0, 0x00, 0x00, 0x5B, 0xFE, 0x40, 0x00, 0x05, 0x50, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xBD,
-    0x01, 0xB8, 0x07, 0x40, 0x00, 0x78, 0x34, 0x00, 0x00, 0x34, 0x80, 0x00, 0x00, 0x50, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x4F, 0x1E, 0x00, 0xBD, 0xF7, 0xE0, 0x02, 0xFF, 0xF8, 0x01,
-    0x5F, 0xFF, 0x54, 0x7F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xD0, 0x0F, 0x8F, 0x2F, 0x00, 0x20, 0xF0, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xA0, 0x02, 0xF4, 0x7E,
-    0x0F, 0xC3, 0xF4, 0x1F, 0xC3, 0xF0, 0xFD, 0x2F, 0x80, 0xFC, 0x2F, 0x87, 0xF0, 0xFC, 0x07, 0xE0,
-    0xFC, 0x3F, 0x0B, 0xD0, 0x3F, 0x0B, 0xC1, 0xF4, 0x3E, 0x01, 0xF4, 0x3E, 0x0F, 0xC2, 0xF0, 0x06,
-    0x40, 0xA0, 0x28, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0xB8, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x3F, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x7F,
-    0x40, 0x00, 0x02, 0xFC, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x19, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0xBF,
-    0x80, 0x00, 0x03, 0xFD, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x19, 0x00, 0x00, 0x00, 0x64, 0x00, 0x0F,
-    0xDB, 0xFA, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x7F, 0xAF, 0xE3, 0xF4, 0x10, 0x00, 0x06, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x01, 0xA1, 0xFE, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x7F,
-    0xDF, 0xD0, 0x00, 0xFE, 0x04, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x43, 0xF0, 0x3F, 0x40, 0x2F, 0xE0, 0xFC, 0x1F, 0xF0, 0x0B, 0xF8, 0x3F, 0x07, 0xFC,
-    0x00, 0xBC, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x15, 0x55, 0x7F, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x55, 0x55, 0xFD, 0x55, 0x54, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2E, 0x03, 0xF0, 0x2E, 0x00, 0x1F, 0xE0, 0xFC, 0x1F, 0xF0, 0x0B, 0xF8, 0x3F, 0x07, 0xFC, 0x00,
-    0xFD, 0x0F, 0xC0, 0xFE, 0x00, 0x04, 0x03, 0xF0, 0x04, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x1F, 0xE7, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3F, 0x5F, 0xF7, 0xF8, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x68, 0x7F, 0xAF, 0xE7, 0xF4, 0x14, 0x04, 0x1F, 0xDB, 0xF9, 0xFD, 0x19, 0x01, 0x07,
-    0xF6, 0xFE, 0x7F, 0x46, 0x40, 0x41, 0xFD, 0xBF, 0x9F, 0xE1, 0x90, 0x10, 0x7F, 0x6F, 0xE7, 0xF8,
-    0x64, 0x00, 0x0B, 0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x3F, 0xC1, 0xF4, 0x0F, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0x02, 0xF8, 0x3F, 0xCB, 0xFE, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x35, 0xCA, 0x0A, 0x2A, 0x80, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x50, 0x03, 0xFF, 0x42, 0xFF, 0xF0, 0xFD, 0xBE,
-    0x7E, 0x0F, 0xDF, 0x83, 0xF7, 0xE0, 0xFD, 0xF8, 0x3F, 0x3F, 0x1F, 0x8F, 0xFF, 0xD1, 0xFF, 0xF0,
-    0x0B, 0xE0, 0x63, 0xE6, 0x14, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xAE, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xBF, 0x00, 0xF3, 0xF0, 0x3D, 0x3F, 0x0B, 0xD7, 0xF4, 0xBF,
-    0xFF, 0xD6, 0xAB, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0x90, 0x00, 0x00, 0x7F, 0xFC, 0x7F, 0xFC, 0xB8,
-    0x00, 0xB9, 0x40, 0xBF, 0xF8, 0x6A, 0xFD, 0x00, 0x3E, 0x00, 0x3E, 0xE5, 0xBD, 0xFF, 0xFC, 0x6F,
-    0x90, 0x00, 0x15, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFD, 0x00, 0x3E, 0x10, 0x1F, 0xBF, 0xC7, 0xFA,
-    0xF9, 0xF4, 0x3F, 0x7D, 0x0F, 0xCF, 0xDB, 0xE1, 0xFF, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xFF,
-    0xF7, 0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xF0, 0x02, 0xF4,
-    0x00, 0xFC, 0x00, 0xBD, 0x00, 0x2A, 0x00, 0x00, 0x50, 0x03, 0xFF, 0x83, 0xFB, 0xF4, 0xF8, 0x3E,
-    0x3F, 0x1F, 0x43, 0xFF, 0x41, 0xFF, 0xE0, 0xF8, 0xBE, 0x7C, 0x0B, 0xDF, 0x87, 0xF3, 0xFF, 0xF4,
-    0x1B, 0xE0, 0x00, 0x50, 0x03, 0xFF, 0x43, 0xFF, 0xF1, 0xF4, 0x3E, 0x7D, 0x0F, 0xDF, 0x87, 0xF3,
-    0xFF, 0xFC, 0x2E, 0x3E, 0x00, 0x1F, 0x45, 0x6F, 0xC2, 0xFF, 0xD0, 0x7E, 0x80, 0x01, 0x90, 0x00,
-    0xB4, 0x00, 0x2D, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x06, 0x40, 0x3F,
-    0xFF, 0x0F, 0xFF, 0xC0, 0x15, 0x55, 0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x55, 0x54, 0x3F, 0xFF, 0x05,
-    0x55, 0x40, 0x06, 0x83, 0xD2, 0xF0, 0xF4, 0x3C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x03, 0xC0,
-    0xF8, 0x1F, 0x03, 0xD0, 0x14, 0x64, 0x0F, 0x02, 0xE0, 0x7C, 0x0F, 0x03, 0xD0, 0xF4, 0x3D, 0x0F,
-    0x43, 0xD0, 0xF0, 0x7C, 0x3D, 0x1F, 0x05, 0x00, 0x50, 0x64, 0x3E, 0xFF, 0xCF, 0xE6, 0xF7, 0xF0,
-    0x3D, 0xF8, 0x0F, 0x7E, 0x03, 0xDF, 0x80, 0xF7, 0xE0, 0x3D, 0xB8, 0x0F, 0x40, 0x00, 0x50, 0x03,
-    0xFF, 0x42, 0xFF, 0xF0, 0xFD, 0xBE, 0x7E, 0x0F, 0xDF, 0x83, 0xF7, 0xE0, 0xFD, 0xF8, 0x3F, 0x3F,
-    0x1F, 0x8F, 0xFF, 0xD1, 0xFF, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xCB, 0xFF, 0x2E,
-    0xFC, 0x13, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x2A, 0x00, 0x50, 0x07,
-    0xFF, 0x43, 0xFF, 0xF0, 0x60, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F,
-    0xC0, 0x0F, 0xFF, 0xD7, 0xFF, 0xF8, 0xAA, 0xA9, 0x00, 0x50, 0x0B, 0xFF, 0x43, 0xFF, 0xF0, 0x50,
-    0x7D, 0x00, 0x1F, 0x01, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x7D, 0x00, 0x0F, 0x9E, 0x5B, 0xE7, 0xFF,
-    0xF0, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xBF, 0x00,
-    0xF3, 0xF0, 0x3D, 0x3F, 0x0B, 0xD7, 0xF4, 0xBF, 0xFF, 0xD6, 0xAB, 0xF8, 0x00, 0x3F, 0x00, 0x02,
-    0x90, 0x00, 0x00, 0x7F, 0xFC, 0x7F, 0xFC, 0xB8, 0x00, 0xB9, 0x40, 0xBF, 0xF8, 0x6A, 0xFD, 0x00,
-    0x3E, 0x00, 0x3E, 0xE5, 0xBD, 0xFF, 0xFC, 0x6F, 0x90, 0x00, 0x15, 0x00, 0xFF, 0xC0, 0xFF, 0xF0,
-    0xFD, 0x00, 0x3E, 0x10, 0x1F, 0xBF, 0xC7, 0xFA, 0xF9, 0xF4, 0x3F, 0x7D, 0x0F, 0xCF, 0xDB, 0xE1,
-    0xFF, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x00,
-    0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x2A, 0x00, 0x00,
-    0x50, 0x03, 0xFF, 0x83, 0xFB, 0xF4, 0xF8, 0x3E, 0x3F, 0x1F, 0x43, 0xFF, 0x41, 0xFF, 0xE0, 0xF8,
-    0xBE, 0x7C, 0x0B, 0xDF, 0x87, 0xF3, 0xFF, 0xF4, 0x1B, 0xE0, 0x00, 0x50, 0x03, 0xFF, 0x43, 0xFF,
-    0xF1, 0xF4, 0x3E, 0x7D, 0x0F, 0xDF, 0x87, 0xF3, 0xFF, 0xFC, 0x2E, 0x3E, 0x00, 0x1F, 0x45, 0x6F,
-    0xC2, 0xFF, 0xD0, 0x7E, 0x80, 0x01, 0x90, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0xFF, 0xFC, 0x3F, 0xFF,
-    0x00, 0xB4, 0x00, 0x2D, 0x00, 0x06, 0x40, 0x3F, 0xFF, 0x0F, 0xFF, 0xC0, 0x15, 0x55, 0x0F, 0xFF,
-    0xC1, 0x55, 0x50, 0x55, 0x54, 0x3F, 0xFF, 0x05, 0x55, 0x40, 0x06, 0x83, 0xD2, 0xF0, 0xF4, 0x3C,
-    0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x03, 0xC0, 0xF8, 0x1F, 0x03, 0xD0, 0x14, 0x64, 0x0F, 0x02,
-    0xE0, 0x7C, 0x0F, 0x03, 0xD0, 0xF4, 0x3D, 0x0F, 0x43, 0xD0, 0xF0, 0x7C, 0x3D, 0x1F, 0x05, 0x00,
-    0x0B, 0xFD, 0x03, 0xEF, 0xC0, 0x00, 0xF8, 0x1A, 0xBE, 0x3F, 0xAF, 0x9F, 0x43, 0xE7, 0xD1, 0xF8,
-    0xFF, 0xEE, 0x06, 0x41, 0x00, 0x06, 0xF9, 0x07, 0xFF, 0xD3, 0xE0, 0xBC, 0xFE, 0xBF, 0x3F, 0xFF,
-    0xCF, 0x40, 0x02, 0xF4, 0x14, 0x3F, 0xFD, 0x01, 0x65, 0x00, 0x06, 0xFD, 0x01, 0xFF, 0xF4, 0x3E,
-    0x0B, 0xC3, 0xD0, 0x3D, 0x3D, 0x03, 0xD3, 0xD0, 0x7C, 0x2F, 0x4F, 0xC0, 0xFF, 0xF0, 0x01, 0xA4,
-    0x00, 0x7C, 0x0B, 0x83, 0xF1, 0xF4, 0x0F, 0xBE, 0x00, 0x7F, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0xC0,
-    0x2F, 0x2F, 0x07, 0xD0, 0xF8, 0x54, 0x01, 0x40, 0x1B, 0xF8, 0x0F, 0xFF, 0xC0, 0x00, 0xF8, 0x55,
-    0x6F, 0x7F, 0xFF, 0xCF, 0x43, 0xF3, 0xE1, 0xF4, 0x7F, 0xF8, 0x01, 0x90, 0x00, 0xF8, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x03, 0xEB, 0xF0, 0xFF, 0xFF, 0x3F, 0x07, 0xDF, 0xC0, 0xF7, 0xE0, 0x3D, 0xF8,
-    0x0F, 0x7E, 0x03, 0xDF, 0x80, 0xF5, 0x50, 0x14, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B,
-    0x80, 0xF4, 0xB8, 0x3E, 0x0B, 0x8F, 0x80, 0xBB, 0xE0, 0x0B, 0xFF, 0x00, 0xBD, 0xF8, 0x0B, 0x83,
-    0xE0, 0xB8, 0x1F, 0x45, 0x40, 0x54, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0x95, 0xB2,
-    0xF8, 0x7F, 0x4F, 0xFF, 0xFF, 0xFD, 0xFC, 0x2F, 0x83, 0xEF, 0x81, 0xF0, 0x3E, 0xF8, 0x1F, 0x03,
-    0xEF, 0x81, 0xF0, 0x3E, 0xF8, 0x1F, 0x03, 0xEF, 0x81, 0xF0, 0x3E, 0x54, 0x05, 0x01, 0x50, 0xB2,
-    0xFD, 0x3F, 0xFF, 0xCF, 0xC1, 0xF7, 0xF0, 0x3D, 0xF8, 0x0F, 0x7E, 0x03, 0xDF, 0x80, 0xF7, 0xE0,
-    0x3D, 0x54, 0x05, 0x00, 0xB5, 0xF8, 0x3F, 0xFF, 0xCF, 0xC1, 0xF7, 0xE0, 0x3D, 0xF8, 0x0F, 0x7F,
-    0x03, 0xDF, 0xE7, 0xF3, 0xFF, 0xF4, 0xF8, 0x60, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x0B,
-    0xF8, 0x3F, 0xBC, 0x7D, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x00, 0x7D, 0x24, 0x3D, 0x7F, 0xFC, 0x16,
-    0x90, 0x06, 0x00, 0x3C, 0x02, 0xFF, 0x6F, 0xFD, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
-    0x50, 0x3F, 0xE0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x01, 0x55, 0x57, 0xF0, 0xBF,
-    0xFE, 0x7F, 0x0B, 0xFF, 0xE7, 0xF4, 0xBF, 0x55, 0x3F, 0x8B, 0xF0, 0x02, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0xBF, 0xFE, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xF0, 0xE0, 0x00, 0x03, 0xC7, 0x40,
-    0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xEF, 0x1E, 0x81, 0xFE,
-    0x3C, 0x74, 0x0F, 0xF0, 0xE2, 0xC0, 0x3F, 0xC7, 0x4F, 0x00, 0xFE, 0x2C, 0x38, 0x03, 0xF8, 0xF1,
-    0xE0, 0x0F, 0xE3, 0x87, 0x40, 0x3F, 0xDE, 0x2C, 0x00, 0xBF, 0xF4, 0xF0, 0x01, 0xFF, 0xC3, 0x80,
-    0x02, 0xFF, 0xEF, 0xF8, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x07, 0x5F, 0x50, 0x00,
-    0x2C, 0x38, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x0B, 0xFC, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC2, 0xE3, 0xE3, 0xF8, 0x3F, 0xBD, 0x3F, 0x83, 0xFF, 0xD3, 0xF8, 0x3F,
-    0xD0, 0x3F, 0xC3, 0xF8, 0x02, 0xFC, 0x3F, 0x80, 0x1F, 0xE3, 0xF8, 0x00, 0xFF, 0x7F, 0x84, 0x07,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xD5, 0x54, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xA9, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0xFF, 0x55,
-    0x50, 0x3F, 0xC0, 0x00, 0x1F, 0xF5, 0x50, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x2F,
-    0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x0B, 0xF4, 0x04, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xBF,
-    0xEA, 0x80, 0xFF, 0xFF, 0xF4, 0x2B, 0xFE, 0xA8, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xA0, 0xBF, 0x87, 0xFF, 0x90, 0x3F, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0xBF, 0xF4, 0x3F, 0xD3, 0xFC, 0x03, 0xFE,
-    0x01, 0xFE, 0x3F, 0xC0, 0x2F, 0xD0, 0x0F, 0xE3, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x3F, 0x80, 0x2F,
-    0xC0, 0x0F, 0xE3, 0xF8, 0x03, 0xFC, 0x00, 0xFE, 0x3F, 0x80, 0xBF, 0xC0, 0x0F, 0xE3, 0xF8, 0x0F,
-    0xFC, 0x00, 0xFE, 0x3F, 0x81, 0xFF, 0xC0, 0x0F, 0xE3, 0xF8, 0x3F, 0xFC, 0x00, 0xFE, 0x3F, 0x87,
-    0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0x80, 0x7F, 0xC0, 0x3E, 0x01, 0xFF, 0x40, 0xF8, 0x07,
-    0xFE, 0x03, 0xE0, 0x1F, 0xBC, 0x0F, 0x80, 0x7D, 0xF4, 0x3E, 0x0B, 0xFF, 0xFA, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x1F, 0x9F, 0x5F, 0x80, 0x7D, 0x3D, 0x3E, 0x0F, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0x43, 0xDF, 0x80, 0x7D, 0x0B, 0xBE, 0x01, 0xF4, 0x1F, 0xF8, 0x07, 0xD0, 0x3F, 0xE0,
-    0x1F, 0x40, 0xFF, 0x80, 0x7D, 0x01, 0xFE, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFE, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0xFF,
-    0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xC1, 0xF0, 0x03, 0xF8, 0x0B, 0xF0, 0xBC, 0x00, 0xFE, 0x03, 0xFC,
-    0x3F, 0x54, 0x3F, 0x9B, 0xFE, 0x7F, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xC3, 0xFF, 0xFF, 0x06,
-    0xFD, 0x50, 0xFF, 0xA4, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0x07,
-    0xF0, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0xE9, 0x3F, 0x80, 0x00, 0x0F,
-    0xFF, 0x4F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xF9, 0x7F, 0xC0,
-    0x00, 0x00, 0x3F, 0x41, 0xFC, 0x06, 0xFE, 0x03, 0xF4, 0x1F, 0xC2, 0xFF, 0xFC, 0x3F, 0x41, 0xFC,
-    0x7F, 0xFF, 0x83, 0xF4, 0x3F, 0xCB, 0xF0, 0x10, 0x3F, 0xFF, 0xF4, 0xBF, 0x00, 0x03, 0xFF, 0xFD,
-    0x07, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x2F, 0xFD, 0x03, 0xF9, 0xFD, 0x00, 0xBF, 0xF4, 0x3F, 0x4F,
-    0xF0, 0x00, 0xBF, 0xC3, 0xF4, 0xBF, 0x40, 0x02, 0xFC, 0x3F, 0x43, 0xF8, 0x00, 0x1F, 0xC3, 0xF4,
-    0x2F, 0xCB, 0x97, 0xFC, 0x3F, 0x40, 0xFE, 0xBF, 0xFF, 0x43, 0xF4, 0x0F, 0xF7, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x01, 0xFC, 0x03, 0xE1, 0xF8, 0x0B, 0xF0, 0x0F, 0x83, 0xF0,
-    0x3F, 0xC0, 0x7E, 0x0F, 0xC0, 0xFF, 0x41, 0xF4, 0x3F, 0x03, 0xEE, 0x0B, 0xC0, 0xBC, 0x1F, 0xB8,
-    0x2F, 0x02, 0xF4, 0x7D, 0xF0, 0xFC, 0x07, 0xD2, 0xE3, 0xC3, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0xF4, 0xF9, 0xF4, 0x02, 0xF7, 0xC2, 0xEB, 0xC0, 0x0B, 0xDF,
-    0x0B, 0xEF, 0x00, 0x1F, 0xBC, 0x1F, 0xF8, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xFF,
-    0x40, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0xBF, 0xFF, 0xE4, 0x01, 0xFB,
-    0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0x40, 0x0B, 0xF0, 0x7F, 0xFD, 0x05,
-    0x0F, 0xD1, 0xFF, 0xF4, 0xBE, 0x2F, 0x87, 0xFF, 0xD2, 0xF8, 0xBE, 0x1F, 0xFF, 0x4B, 0xE2, 0xF8,
-    0x7F, 0xFD, 0x2F, 0x8B, 0xE1, 0xFF, 0xF4, 0xBE, 0x2F, 0x87, 0xFF, 0xD2, 0xF8, 0xBE, 0x1F, 0xFF,
-    0x4B, 0xE2, 0xF8, 0x7F, 0xFD, 0x2F, 0x8B, 0xE2, 0xFF, 0xF4, 0xBE, 0x15, 0x4F, 0xEF, 0xD2, 0xF8,
-    0x00, 0x7F, 0x7F, 0x4B, 0xFA, 0xAF, 0xFC, 0xFD, 0x2F, 0xFF, 0xFF, 0xC3, 0xF4, 0xBF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0x00, 0x15, 0x7F, 0xD4, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xE2, 0xFC, 0x07, 0xFF, 0xFB, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xC1, 0xFF, 0x42, 0xFF, 0x0B, 0xF8, 0x03, 0xFC, 0x3F, 0xD0, 0x0B, 0xF0, 0xFF, 0x40,
-    0x2F, 0xC3, 0xFD, 0x00, 0xBF, 0x0B, 0xF8, 0x03, 0xFC, 0x1F, 0xF0, 0x1F, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFE, 0xFF, 0x00, 0x7F, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFD, 0x00, 0xBF, 0xD0, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFF,
-    0xAA, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFA, 0xA8, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x04,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x0B, 0xF0, 0x3F, 0x80, 0x7F, 0x40, 0xFE, 0x03, 0xFC, 0x03, 0xF8, 0x2F, 0xC0, 0x0F,
-    0xE0, 0xFE, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0xFE, 0x7F, 0x40, 0x03, 0xFB, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x94, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xE2, 0xFC,
-    0x00, 0x3F, 0x83, 0xF8, 0x00, 0xFE, 0x0B, 0xF4, 0x03, 0xF8, 0x0F, 0xF0, 0x0F, 0xE0, 0x2F, 0xD0,
-    0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0x57,
-    0xFD, 0x54, 0x00, 0x2F, 0xC5, 0x00, 0x02, 0xFE, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xFC, 0xF0, 0x0B, 0xFF, 0xFE, 0x00, 0x22, 0xFF, 0x40, 0x00, 0x3F,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x76, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x14, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x6A, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x0F,
-    0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x69, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0xFF, 0xF4, 0x0F, 0xE0,
-    0x0B, 0xF0, 0xFF, 0xFF, 0x03, 0xF4, 0x03, 0xFC, 0xBE, 0x0B, 0xD1, 0xFC, 0x03, 0xFD, 0x3F, 0x01,
-    0xF4, 0xBF, 0x0B, 0xFE, 0x0F, 0xC0, 0xBD, 0x3F, 0xFF, 0xFE, 0x07, 0xF4, 0x7F, 0x0F, 0xFF, 0xFD,
-    0x02, 0xFF, 0xFF, 0x87, 0xFF, 0xE4, 0x00, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x3F,
-    0x4B, 0xE0, 0x07, 0xF4, 0x7E, 0x00, 0x7F, 0x4B, 0xE0, 0x03, 0xF8, 0xBE, 0x00, 0x3F, 0xCF, 0xC0,
-    0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x01, 0x03, 0xFD, 0x00, 0x3C, 0x3F,
-    0xE0, 0x0B, 0xDB, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0x3F, 0xC3, 0xD7, 0xD1, 0xFD, 0xBC,
-    0x38, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xF4, 0x01,
-    0xFF, 0xFF, 0xF0, 0x07, 0xF4, 0x2F, 0xE0, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC1, 0xFD,
-    0x02, 0xFC, 0x1B, 0xFA, 0xAF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0x42, 0xFE, 0x01, 0xFE, 0xAF,
-    0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xF0, 0x70,
-    0x2F, 0xF1, 0xF0, 0x00, 0x3F, 0xD1, 0xF0, 0x00, 0x7F, 0xC1, 0xF0, 0x00, 0x7F, 0x81, 0xF0, 0x00,
-    0xBF, 0x41, 0xFF, 0xFC, 0xBF, 0x41, 0xFF, 0xFC, 0x7F, 0x41, 0xFF, 0xFC, 0x7F, 0x81, 0xF2, 0xFC,
-    0x3F, 0xC1, 0xF2, 0xFC, 0x3F, 0xE1, 0xF2, 0xFC, 0x1F, 0xF9, 0xF2, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x0F, 0xE7, 0xF4, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xAB, 0xFE, 0xBF, 0xEA, 0x00, 0xFD, 0x03, 0xF4, 0x06, 0xBF, 0xAA, 0xFF, 0xA3, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xE5, 0x57, 0xF9, 0x07, 0xF0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x2F, 0xC0,
-    0xFE, 0x00, 0x07, 0xF4, 0x7F, 0x40, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0x40, 0x7F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x2A, 0xAA, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xA0, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xF9, 0xF6, 0xC0, 0xBF, 0x87, 0xC0, 0x03, 0xFC,
-    0x1F, 0x00, 0x1F, 0xE0, 0x7C, 0x00, 0x7F, 0x41, 0xF0, 0x02, 0xFD, 0x07, 0xC0, 0x0B, 0xF4, 0x1F,
-    0x00, 0x1F, 0xD0, 0x7C, 0x00, 0x7F, 0x81, 0xF0, 0x00, 0xFF, 0x07, 0xC0, 0x03, 0xFD, 0x1F, 0x00,
-    0x07, 0xFE, 0x7C, 0x64, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xA0, 0x06, 0x40, 0x00, 0xBC, 0x03, 0xE0, 0x00,
-    0x3F, 0x02, 0xF8, 0x00, 0x2F, 0xEA, 0xFF, 0xA9, 0x3F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xBF, 0x07, 0xF8, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x0F,
-    0xE0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02, 0xFC,
-    0x0F, 0xF0, 0x00, 0xBF, 0x03, 0xFF, 0xB8, 0x2F, 0xC0, 0x7F, 0xFE, 0x0B, 0xF0, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x1B, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0x92,
-    0xE1, 0xE1, 0xFC, 0x7F, 0xFF, 0xFF, 0xCF, 0xD7, 0x7C, 0x3C, 0x3C, 0xFC, 0x3F, 0xC3, 0xC3, 0xEF,
-    0x80, 0xBF, 0xFE, 0xBF, 0xF0, 0x03, 0xEF, 0xFF, 0xF4, 0x00, 0x38, 0x3C, 0x3C, 0x00, 0x03, 0x83,
-    0xC3, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF1, 0x55, 0x55,
-    0x55, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x15,
-    0x7F, 0xD5, 0x50, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x7F, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x80, 0x6B, 0xFF, 0x00, 0x7F, 0xF8, 0x00,
-    0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
-    0xF1, 0xB0, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF6, 0xF0,
-    0x04, 0x7F, 0xFF, 0x00, 0x1F, 0xFE, 0x40, 0x0F, 0xFF, 0x00, 0xBE, 0xEB, 0xF0, 0x0F, 0xE0, 0x7F,
-    0x00, 0xFD, 0x07, 0xF0, 0x0F, 0xD0, 0x7F, 0x03, 0xFC, 0x07, 0xF0, 0xBF, 0x40, 0x7F, 0xFF, 0xE0,
-    0x07, 0xFF, 0xF8, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x38, 0xBC, 0x00, 0x00, 0x00, 0xB0, 0x3D, 0x00, 0x00, 0x00, 0xB4,
-    0x3E, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x01, 0x7E, 0x55, 0x55, 0xBE, 0x00, 0x3E, 0x04, 0x00, 0x0F, 0x00, 0x3E, 0x2E,
-    0x3C, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0x1E, 0x00, 0x2F, 0xD3, 0xEB, 0xFC, 0x00, 0x3F, 0x01, 0x81,
-    0xA0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xDF, 0xE4, 0x01, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0xFE, 0x1F, 0xF8, 0x3F, 0xC0, 0xFE, 0x03,
-    0xFC, 0x7F, 0x40, 0xFE, 0x01, 0xFD, 0xBF, 0x00, 0xFE, 0x00, 0xFD, 0xBF, 0x00, 0xFE, 0x00, 0xFE,
-    0xBF, 0x00, 0xBD, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0xBF,
-    0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xFD, 0x5B, 0xFD, 0x0F, 0xF0, 0x07, 0xF8, 0x3F, 0xC0, 0x1F, 0xE0,
-    0xFF, 0x00, 0x7F, 0x43, 0xFD, 0x1B, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xFF, 0x90, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0x00, 0x07, 0xFD, 0x54, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x04,
-    0x00, 0x00, 0x00, 0xB5, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xF5, 0xFF, 0xF0, 0x2F, 0xDB, 0x5E, 0xBF, 0x43, 0xFC, 0xB5, 0xE3,
-    0xFC, 0x7F, 0x8B, 0x5E, 0x2F, 0xCB, 0xF4, 0xB5, 0xE2, 0xFD, 0xBF, 0x4B, 0x5E, 0x1F, 0xDB, 0xF4,
-    0x10, 0x40, 0x54, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0x05, 0x00, 0x03, 0x8F, 0x00, 0x03, 0x8F, 0x00,
-    0xBF, 0xFF, 0x40, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0x5B, 0xFC, 0xFF, 0x03, 0xFC, 0xFF,
-    0x03, 0xFC, 0xFF, 0x03, 0xFC, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF4, 0xFF, 0x07,
-    0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x01, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x07, 0xFD, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x40, 0x03, 0x8F, 0x00, 0x03, 0x8F, 0x00, 0x01, 0x05, 0x00, 0x00,
-    0xBF, 0xE0, 0x0B, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x3F, 0xD0, 0x60, 0xBF, 0x40, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x14,
-    0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xF5, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xC6,
-    0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0x03, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x5F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x41, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+static const uint8_t notosans_12_boldBitmaps[26824] = {
+    0x95, 0x55, 0x31, 0x73, 0x1E, 0x35, 0x10, 0xDD, 0xBB, 0x23, 0x39, 0x98, 0x9B, 0x41, 0x14, 0xB8,
+    0x81, 0x42, 0x0D, 0x0D, 0x33, 0x80, 0x6A, 0x0A, 0xD0, 0x4D, 0x5C, 0xA4, 0x74, 0x0A, 0x1B, 0x0A,
+    0x0A, 0x68, 0x81, 0xC2, 0x7F, 0x20, 0xF8, 0x0E, 0x5C, 0x50, 0xC6, 0x0D, 0x35, 0x6D, 0x26, 0x14,
+    0xA1, 0xA0, 0x34, 0xE8, 0xB0, 0x8B, 0x0C, 0x93, 0xC2, 0xF2, 0x78, 0x32, 0xE9, 0xF0, 0x05, 0x32,
+    0xC3, 0x30, 0x29, 0x2C, 0xC7, 0x97, 0xC9, 0xD9, 0x91, 0xB4, 0x3C, 0xDD, 0x7D, 0x71, 0x4C, 0x41,
+    0x81, 0x3E, 0x7F, 0xD6, 0x7D, 0xAB, 0x93, 0xF6, 0xED, 0xDB, 0xB7, 0xAB, 0xE6, 0xF6, 0x5F, 0xA7,
+    0xA1, 0xF9, 0xF4, 0xFE, 0x10, 0xB4, 0xD8, 0x75, 0x9E, 0x28, 0xFF, 0x23, 0x9A, 0xEF, 0x6D, 0xDD,
+    0x88, 0xFB, 0x2E, 0x34, 0xC9, 0x04, 0x7B, 0xBF, 0xFD, 0xF6, 0xE5, 0x96, 0xC4, 0xB2, 0x25, 0x79,
+    0xD5, 0x92, 0x2A, 0x3B, 0x52, 0x55, 0x47, 0x5A, 0x74, 0x92, 0x39, 0x2A, 0x7C, 0xDF, 0x88, 0xE6,
+    0x6F, 0xDA, 0x56, 0x44, 0x5E, 0xD3, 0x52, 0x68, 0x56, 0x1B, 0x66, 0x9F, 0xBE, 0xB9, 0xDB, 0xA6,
+    0x02, 0xA7, 0x16, 0xFD, 0x48, 0x85, 0x1D, 0xA8, 0xDC, 0x1F, 0x88, 0xDE, 0x21, 0xAA, 0x88, 0x1A,
+    0x6E, 0x0D, 0x7B, 0xC3, 0x41, 0xDF, 0xBD, 0x2C, 0x1E, 0x77, 0x79, 0x74, 0xD4, 0x04, 0x2A, 0x79,
+    0x20, 0xC5, 0x1D, 0xB1, 0xA7, 0x77, 0x99, 0x2A, 0xF9, 0xFB, 0x95, 0xBB, 0x27, 0x38, 0x07, 0x7F,
+    0x97, 0xF9, 0x21, 0xE5, 0x1D, 0xD1, 0x8F, 0x44, 0xAF, 0xD3, 0x62, 0x34, 0x96, 0xBE, 0x22, 0xC9,
+    0x24, 0xBA, 0xE2, 0x6C, 0xCC, 0x87, 0x84, 0x48, 0xC3, 0x97, 0xAF, 0x2C, 0x7D, 0x58, 0xFD, 0x3A,
+    0xA6, 0x47, 0x4D, 0xB0, 0xDE, 0x79, 0x10, 0xF2, 0x33, 0xEF, 0xCD, 0x28, 0x58, 0xAE, 0x1C, 0x75,
+    0xCD, 0xC1, 0xF1, 0xB0, 0x41, 0xF4, 0xB3, 0x5A, 0xEE, 0x49, 0xEC, 0x0C, 0x9A, 0xF2, 0x41, 0x2D,
+    0x3B, 0xDA, 0xC8, 0x61, 0x15, 0x9D, 0xD8, 0xB3, 0xD9, 0x48, 0xC6, 0x13, 0xEC, 0x4C, 0x2F, 0x86,
+    0x8C, 0xC0, 0x0D, 0x5C, 0xC4, 0xDC, 0x93, 0xEC, 0x22, 0x65, 0x5E, 0xE0, 0x61, 0x3F, 0xC0, 0x62,
+    0x3A, 0x2A, 0xD8, 0x01, 0xD0, 0x98, 0xDF, 0x04, 0x7C, 0xFD, 0x6D, 0xE4, 0x6A, 0xE0, 0xAB, 0x9E,
+    0x85, 0x93, 0x6C, 0x19, 0x76, 0x31, 0x16, 0x5C, 0x4F, 0x94, 0x30, 0xF3, 0x50, 0xF2, 0x43, 0x60,
+    0x4F, 0x11, 0xC8, 0x3B, 0x89, 0xE1, 0x6F, 0xB6, 0xF2, 0x41, 0x76, 0xA1, 0x74, 0xBA, 0xF6, 0xA5,
+    0x53, 0x6D, 0x28, 0x06, 0x61, 0x75, 0x8D, 0xA9, 0xEA, 0x15, 0x62, 0x0A, 0xB9, 0x2F, 0x5C, 0xE9,
+    0x2A, 0xAB, 0xE1, 0x59, 0xD8, 0xD2, 0x15, 0x43, 0x3E, 0x66, 0x9E, 0x3C, 0x85, 0x0B, 0x1F, 0x9F,
+    0xF9, 0x7C, 0x2C, 0x86, 0xF4, 0x9E, 0xEC, 0x52, 0xE0, 0x35, 0x21, 0x4D, 0xB9, 0xA3, 0xAD, 0xEB,
+    0xAF, 0x68, 0x36, 0x37, 0x98, 0x1F, 0x7C, 0x19, 0x57, 0x81, 0x23, 0x7F, 0xE6, 0x32, 0xDF, 0xD0,
+    0x86, 0x68, 0xB3, 0x8C, 0xE8, 0x03, 0x22, 0x51, 0x23, 0x3D, 0x44, 0x48, 0xCE, 0x06, 0x69, 0xE6,
+    0x3D, 0xE6, 0xE3, 0x5B, 0xF1, 0xE6, 0xBF, 0x57, 0x30, 0x84, 0x0D, 0x72, 0x67, 0xD4, 0x05, 0x22,
+    0x5D, 0x5A, 0x6D, 0x02, 0x3E, 0xFE, 0x3D, 0xF5, 0xE8, 0x34, 0xBC, 0x44, 0x54, 0x3A, 0x52, 0x2D,
+    0x30, 0x60, 0xD6, 0x2D, 0x70, 0x55, 0x69, 0xCE, 0xE6, 0xB9, 0xC6, 0x0C, 0xAA, 0xCE, 0x67, 0xCA,
+    0xFD, 0x39, 0xAB, 0x55, 0x04, 0x73, 0x1E, 0x9C, 0x3A, 0xD9, 0x9B, 0x2B, 0xBE, 0xF0, 0xBA, 0x53,
+    0xBB, 0x3E, 0xF7, 0xBA, 0x95, 0x07, 0x63, 0x16, 0x9E, 0x4F, 0x9D, 0x4C, 0x46, 0x50, 0xD1, 0xC5,
+    0x12, 0x59, 0x64, 0xA0, 0xB4, 0x64, 0x66, 0x54, 0xD2, 0x96, 0x21, 0x07, 0xCB, 0x41, 0x1F, 0x1D,
+    0x1C, 0x87, 0x97, 0xA5, 0xCD, 0x02, 0xFD, 0xE7, 0x3F, 0x8C, 0x37, 0xB9, 0xAE, 0x38, 0x16, 0x48,
+    0x83, 0xB0, 0xA6, 0xFB, 0xAC, 0x00, 0x18, 0x8D, 0xFC, 0x8D, 0x44, 0xA6, 0x26, 0xD9, 0x53, 0x99,
+    0x72, 0x3C, 0xD9, 0x84, 0xA3, 0x62, 0xF1, 0x83, 0xF9, 0x80, 0xE1, 0x81, 0x79, 0x4A, 0x9B, 0x8A,
+    0xB5, 0xE2, 0x98, 0xA5, 0x23, 0x6A, 0xD3, 0x4E, 0x2F, 0x21, 0x6A, 0xC4, 0xFA, 0x43, 0x48, 0x3A,
+    0xC9, 0x38, 0xD2, 0xA5, 0xF5, 0x71, 0x3A, 0x23, 0x87, 0x4F, 0xBD, 0x53, 0x97, 0x1E, 0x7B, 0x37,
+    0x21, 0x1D, 0xC9, 0x33, 0x6A, 0x82, 0x9C, 0x14, 0x9C, 0x61, 0x82, 0x9E, 0x54, 0xA4, 0xF2, 0xA8,
+    0x27, 0x1F, 0x49, 0xAD, 0xF4, 0x65, 0x1F, 0x09, 0xDA, 0xD2, 0x75, 0x2C, 0xCF, 0x6E, 0x9F, 0x19,
+    0xE6, 0x67, 0xD0, 0xCC, 0xD2, 0x1A, 0x5F, 0x4B, 0xEC, 0xA5, 0x7D, 0xA2, 0x57, 0xEC, 0xC1, 0x02,
+    0x62, 0xE8, 0xE2, 0xDA, 0x35, 0xE4, 0x59, 0x58, 0x2A, 0x9E, 0x5C, 0x03, 0xA0, 0xB6, 0x61, 0x5F,
+    0x3D, 0xE2, 0x96, 0xE4, 0x8C, 0xDD, 0xC0, 0xFB, 0x6F, 0xA4, 0xFE, 0x04, 0xC1, 0x40, 0x2B, 0xE1,
+    0xEA, 0xF9, 0x30, 0x8E, 0x4C, 0xE2, 0xD1, 0x55, 0xA7, 0xD3, 0xA1, 0x12, 0x58, 0xC7, 0xCF, 0x49,
+    0xAF, 0x27, 0x6A, 0x46, 0xFD, 0xC4, 0x80, 0x71, 0xF0, 0x2F, 0x0E, 0x46, 0x0A, 0xAA, 0x93, 0xFB,
+    0xB1, 0x48, 0x2E, 0x5B, 0x6C, 0x20, 0x33, 0x4E, 0xDA, 0x65, 0xBE, 0x0F, 0x4E, 0x30, 0xED, 0xAF,
+    0x7D, 0x7C, 0xCE, 0xC0, 0x74, 0x94, 0x9D, 0x7C, 0x37, 0x75, 0x62, 0x30, 0x4B, 0x81, 0x2E, 0xF8,
+    0xA5, 0x64, 0x98, 0x18, 0xE9, 0xE6, 0xEC, 0x73, 0x5D, 0x82, 0x2B, 0x3E, 0x1A, 0x94, 0xD5, 0x3B,
+    0xC8, 0xB0, 0xB4, 0xBA, 0xE5, 0x15, 0x57, 0x70, 0x20, 0xC1, 0xB3, 0x32, 0xD6, 0x07, 0xA4, 0x7D,
+    0x37, 0x89, 0xA0, 0x16, 0x07, 0x80, 0xA4, 0xCE, 0xB8, 0x43, 0x34, 0x39, 0x8F, 0x17, 0x34, 0x54,
+    0xB2, 0x47, 0xF0, 0x4E, 0x5B, 0xB3, 0x39, 0x42, 0x43, 0xB5, 0xDC, 0x1D, 0x92, 0x78, 0xD4, 0x41,
+    0xA8, 0x02, 0x9A, 0x94, 0x35, 0xC1, 0x67, 0xBF, 0xA4, 0x08, 0xFD, 0x54, 0x16, 0xD2, 0xBD, 0x6A,
+    0x02, 0x44, 0x57, 0x0B, 0x30, 0x85, 0xF1, 0x5C, 0xC5, 0x69, 0x2C, 0x1A, 0x60, 0xF5, 0x75, 0x54,
+    0x7D, 0xB8, 0x50, 0xFF, 0x41, 0xEC, 0x7B, 0xB5, 0xE9, 0x74, 0x7A, 0x46, 0xD5, 0xA0, 0x09, 0x82,
+    0xE2, 0x66, 0xCC, 0xB8, 0x2F, 0x21, 0xA8, 0x40, 0x05, 0xE2, 0x6C, 0x40, 0x25, 0xC8, 0xC9, 0x79,
+    0x56, 0x91, 0x4C, 0xEF, 0x7E, 0x71, 0xEB, 0xD6, 0x5C, 0x52, 0x6E, 0x3E, 0x47, 0x4D, 0x3F, 0x52,
+    0x57, 0xAB, 0xE7, 0xDA, 0x1B, 0xA0, 0x17, 0x8B, 0x08, 0x00, 0x0B, 0xFE, 0xD6, 0x5D, 0xDA, 0xAA,
+    0x42, 0xC6, 0x43, 0xC5, 0x5B, 0xE9, 0x50, 0xE8, 0xE5, 0xB5, 0x45, 0xA0, 0xA9, 0x67, 0x0E, 0xC8,
+    0xF0, 0xFB, 0x89, 0xC3, 0x40, 0xD0, 0x33, 0x78, 0x4E, 0x30, 0x3A, 0x4A, 0xFD, 0x88, 0xB2, 0x73,
+    0x4E, 0x7E, 0x4A, 0x2B, 0x45, 0x98, 0x02, 0xC6, 0xEE, 0xDC, 0x3C, 0x4C, 0xDB, 0xE1, 0x47, 0x9E,
+    0x7E, 0x14, 0x53, 0x82, 0x44, 0x2F, 0xBA, 0x4B, 0x75, 0xA8, 0x6C, 0xC3, 0x62, 0xD3, 0x19, 0xDE,
+    0x39, 0x1E, 0x9A, 0xC2, 0x5D, 0xDF, 0x56, 0xB5, 0x97, 0x0D, 0xFA, 0x68, 0x79, 0xB8, 0xEB, 0xC4,
+    0xCE, 0x89, 0x43, 0x3F, 0xF2, 0xDB, 0x6A, 0xD3, 0x6F, 0xA8, 0x65, 0xA8, 0xB0, 0x70, 0xFA, 0x41,
+    0xA4, 0x89, 0x16, 0x68, 0x31, 0x03, 0xF2, 0xEF, 0xD6, 0x51, 0x27, 0x53, 0x70, 0x8A, 0xB7, 0x60,
+    0x4D, 0xA5, 0x9D, 0x8A, 0x44, 0xA1, 0x6A, 0x8A, 0x67, 0xA9, 0x27, 0x26, 0x5D, 0x3C, 0x86, 0x39,
+    0x82, 0x7F, 0x69, 0x23, 0x20, 0x41, 0x04, 0xBA, 0x6B, 0xEA, 0xF2, 0xF4, 0x13, 0x34, 0x5A, 0x68,
+    0x18, 0xFB, 0x11, 0x2F, 0x8A, 0x43, 0x5B, 0x62, 0xE0, 0xAE, 0x86, 0xA6, 0xA5, 0x66, 0x6F, 0x40,
+    0x0C, 0x86, 0xB7, 0xB0, 0xDA, 0x63, 0x71, 0xC5, 0x49, 0x0F, 0xBD, 0xEE, 0xB9, 0x02, 0x93, 0xB9,
+    0x71, 0x66, 0x60, 0x4C, 0xAD, 0xC0, 0x71, 0x66, 0x66, 0xA3, 0x3A, 0x74, 0x45, 0xC0, 0x1A, 0xE8,
+    0x1D, 0x71, 0x29, 0x09, 0x8E, 0xF5, 0x7C, 0x4D, 0xC4, 0x1A, 0x1A, 0xC8, 0xD2, 0xEB, 0x21, 0xB7,
+    0x8B, 0x7A, 0x45, 0xA1, 0xA7, 0x7A, 0x4F, 0x44, 0x56, 0x60, 0x58, 0x01, 0x32, 0x9C, 0xA6, 0x5A,
+    0x4F, 0x9C, 0xA3, 0x2C, 0xDF, 0x4A, 0x7E, 0x41, 0x59, 0x5B, 0xCE, 0x4A, 0x03, 0x92, 0xA9, 0x67,
+    0xA4, 0xE2, 0xB8, 0xD7, 0x8C, 0x70, 0x77, 0x82, 0x3B, 0xE2, 0x10, 0xE4, 0xA3, 0xFB, 0xF3, 0x2C,
+    0x56, 0x01, 0x1E, 0x34, 0x77, 0x59, 0xC4, 0x9D, 0xF4, 0xD4, 0x03, 0x89, 0x93, 0xA9, 0x67, 0x00,
+    0x69, 0x28, 0x12, 0x1A, 0xC3, 0x4F, 0x99, 0x8F, 0x98, 0xCD, 0xBD, 0x55, 0x4E, 0x28, 0x12, 0x11,
+    0xE9, 0x76, 0x83, 0x1A, 0xF6, 0x9E, 0xAC, 0xA1, 0x28, 0x5E, 0x58, 0xE3, 0x54, 0xF6, 0xFD, 0xB4,
+    0xE3, 0x90, 0xB9, 0xB9, 0xB0, 0x23, 0xB9, 0x3B, 0x99, 0x54, 0x74, 0x71, 0xC7, 0xE2, 0xF1, 0x7F,
+    0x8E, 0x7F, 0x00, 0xAD, 0x55, 0x31, 0x93, 0xDD, 0x34, 0x10, 0x5E, 0xDB, 0x85, 0x67, 0x70, 0x21,
+    0x1A, 0x66, 0x98, 0xA1, 0x50, 0x43, 0x43, 0xE5, 0x86, 0x5E, 0x26, 0x29, 0x29, 0xD2, 0x70, 0x93,
+    0x22, 0x45, 0x28, 0xE9, 0xC2, 0x2F, 0x40, 0x86, 0xEB, 0x68, 0xC8, 0xDF, 0xA0, 0xCA, 0x1F, 0x48,
+    0x4E, 0xE2, 0xAE, 0xB8, 0x82, 0xE2, 0x99, 0x64, 0xA8, 0x52, 0x9C, 0x98, 0xBB, 0xE1, 0x26, 0x50,
+    0x3C, 0x91, 0xE7, 0xCC, 0xE9, 0xEE, 0x49, 0x5A, 0x3E, 0xBD, 0x77, 0x97, 0x84, 0xE4, 0x60, 0x52,
+    0xE0, 0xB1, 0x6C, 0x59, 0xB2, 0x77, 0xBF, 0xDD, 0xFD, 0xF6, 0x33, 0x11, 0x8E, 0x8F, 0xD8, 0x11,
+    0x73, 0x6C, 0x98, 0x67, 0x91, 0xE9, 0xEB, 0xDE, 0x13, 0xA9, 0x89, 0x48, 0x5B, 0x8C, 0x91, 0xC8,
+    0x0C, 0x1C, 0xCB, 0xD0, 0x65, 0x8C, 0x75, 0x54, 0x16, 0xC3, 0xD5, 0x51, 0x86, 0x3A, 0x76, 0xF8,
+    0xAE, 0xC6, 0x20, 0xCD, 0x27, 0xC5, 0x94, 0xA1, 0x66, 0x1D, 0x49, 0xB0, 0x27, 0xC5, 0x16, 0x46,
+    0xA9, 0xE1, 0xAB, 0xC7, 0xD7, 0x8E, 0x17, 0x3B, 0xFA, 0xCD, 0xDD, 0x57, 0x8F, 0x5E, 0xF1, 0x82,
+    0x9F, 0x03, 0x8A, 0x6F, 0x22, 0x31, 0x29, 0xFB, 0xF6, 0x44, 0xA7, 0xF2, 0x8E, 0x87, 0xB7, 0xEB,
+    0x76, 0xAF, 0x9B, 0x74, 0x81, 0x93, 0xCA, 0x22, 0x6D, 0x20, 0x8A, 0x55, 0x24, 0x73, 0x0B, 0x6B,
+    0xB0, 0x64, 0xB9, 0x89, 0x4D, 0x54, 0x93, 0x78, 0x9E, 0x49, 0x1D, 0x95, 0x3C, 0x8C, 0xC8, 0x03,
+    0x89, 0x8C, 0xEF, 0x1E, 0x67, 0xDA, 0xEC, 0x76, 0x51, 0x78, 0x31, 0x2B, 0x2B, 0x3D, 0x53, 0x7F,
+    0x1C, 0x91, 0x1C, 0x43, 0xB0, 0xFB, 0xCE, 0x27, 0xC7, 0xED, 0x69, 0x26, 0x12, 0x09, 0xB0, 0x65,
+    0xB9, 0xF4, 0x89, 0x67, 0x52, 0x89, 0x03, 0xE9, 0x94, 0x23, 0x3D, 0x4A, 0xF9, 0x11, 0xC5, 0x94,
+    0xBF, 0xA1, 0x90, 0xB2, 0xAA, 0x67, 0x5C, 0x6E, 0xFA, 0x94, 0xFB, 0x5D, 0x97, 0xB2, 0xF8, 0x79,
+    0xC2, 0x65, 0x61, 0x53, 0xEE, 0x96, 0xB8, 0xB4, 0x3C, 0xA4, 0xDC, 0x30, 0xA5, 0x5C, 0x97, 0x4B,
+    0x95, 0x28, 0x19, 0x4B, 0x5A, 0x45, 0x92, 0x0B, 0x1E, 0xDA, 0x15, 0xFB, 0x2A, 0x72, 0xC6, 0x82,
+    0xB6, 0x72, 0x71, 0x1A, 0xDA, 0x55, 0xE0, 0xCF, 0x62, 0x16, 0x5E, 0xAB, 0xEF, 0x92, 0x5C, 0x38,
+    0x75, 0xB8, 0x0A, 0x6D, 0x88, 0x88, 0x4D, 0xAB, 0x51, 0xF2, 0xC2, 0xD5, 0xBC, 0x0A, 0xA4, 0xB0,
+    0xD0, 0xB1, 0x1A, 0x09, 0x95, 0x28, 0x47, 0x0D, 0x60, 0x28, 0xEC, 0x4C, 0x86, 0x79, 0x92, 0xA1,
+    0xE5, 0x26, 0x93, 0x40, 0xC2, 0x48, 0x1F, 0x06, 0x6A, 0xA2, 0x19, 0x49, 0x3D, 0x9D, 0xA9, 0x4E,
+    0x66, 0xA0, 0x7E, 0x33, 0x01, 0x53, 0xD4, 0x41, 0xC4, 0x96, 0x72, 0x64, 0xBE, 0xE5, 0xB1, 0xF7,
+    0xE0, 0x46, 0xA2, 0x1E, 0x09, 0xA5, 0x7B, 0x18, 0x1B, 0x76, 0xE4, 0x51, 0x71, 0x16, 0xCC, 0xC7,
+    0xE9, 0x4E, 0x64, 0x32, 0x00, 0x78, 0xE4, 0xDB, 0x33, 0xA4, 0x98, 0xEF, 0x30, 0x18, 0x72, 0x8B,
+    0xF9, 0x66, 0xFE, 0xB1, 0xE4, 0x0C, 0x8E, 0x84, 0x87, 0x31, 0xBA, 0x7C, 0xA0, 0xFF, 0x11, 0x54,
+    0xBE, 0x02, 0x35, 0x15, 0x8B, 0x30, 0x2B, 0xE0, 0x86, 0xF0, 0x06, 0x9C, 0x01, 0x67, 0xF5, 0x05,
+    0x60, 0x82, 0x03, 0x0E, 0x38, 0x3D, 0x18, 0x32, 0x01, 0xE8, 0x6E, 0xAC, 0x90, 0xC0, 0x16, 0x1C,
+    0x50, 0x16, 0x51, 0x61, 0x77, 0x12, 0xB0, 0xA3, 0xF6, 0xE3, 0x25, 0x43, 0x02, 0x18, 0xE2, 0xB7,
+    0x0C, 0x51, 0x4F, 0xE2, 0x16, 0x71, 0xCD, 0x27, 0x92, 0xB3, 0x2A, 0x4D, 0xF3, 0x95, 0x29, 0xBC,
+    0x23, 0x3D, 0xA1, 0xE2, 0x20, 0xFC, 0x58, 0x23, 0x06, 0x1D, 0xA9, 0xCD, 0x44, 0x38, 0x79, 0xAE,
+    0xF3, 0x86, 0x21, 0xF3, 0x36, 0x51, 0x9A, 0x79, 0x8D, 0x2E, 0x41, 0x90, 0x7F, 0xDD, 0x4E, 0x3B,
+    0xD4, 0x5B, 0xAA, 0x81, 0xF0, 0x9D, 0x6F, 0xFF, 0xD1, 0x83, 0xD7, 0x3E, 0x5E, 0x24, 0x92, 0xA7,
+    0xA9, 0x62, 0xC4, 0x1B, 0x30, 0xC6, 0x16, 0xE0, 0xB6, 0xBD, 0x4C, 0xA6, 0x07, 0xE2, 0x83, 0x40,
+    0x12, 0x49, 0xE8, 0x7C, 0x6F, 0x11, 0x6B, 0x00, 0xDF, 0x90, 0x11, 0xF8, 0x52, 0xB6, 0x99, 0xC5,
+    0x44, 0xDC, 0x81, 0xD1, 0x78, 0xA7, 0x99, 0xD1, 0x5D, 0x59, 0x13, 0xC9, 0xE5, 0x08, 0x1F, 0x48,
+    0x2E, 0x7C, 0x90, 0x0C, 0x44, 0x4D, 0xD9, 0xC0, 0xF7, 0x30, 0x07, 0x0B, 0xA4, 0x0E, 0xE7, 0x8A,
+    0x07, 0xE1, 0x32, 0x19, 0x87, 0x94, 0x8E, 0x2A, 0x42, 0x47, 0xBC, 0x58, 0x0E, 0x5C, 0xC5, 0xF6,
+    0x4F, 0x87, 0x85, 0x1B, 0xE7, 0x51, 0x4E, 0xC2, 0x25, 0xD5, 0x79, 0x48, 0x8D, 0x78, 0x0C, 0x79,
+    0x91, 0xFB, 0x01, 0xB5, 0x7E, 0xEA, 0xB4, 0x1A, 0x9A, 0xF5, 0x2C, 0x8E, 0x2C, 0xED, 0xC5, 0x66,
+    0x0D, 0xCF, 0xC0, 0x02, 0xDF, 0x3C, 0x48, 0x38, 0x61, 0x8B, 0xB6, 0x20, 0xE8, 0x17, 0x22, 0xD3,
+    0xB6, 0xE2, 0x6E, 0x26, 0x1E, 0x18, 0x22, 0x26, 0x1D, 0xC0, 0xA6, 0x12, 0xCC, 0x91, 0xA7, 0xB6,
+    0xE0, 0x02, 0x93, 0x36, 0x75, 0x6F, 0xF1, 0x41, 0x03, 0xFD, 0xAB, 0xC1, 0xD5, 0x2A, 0xA3, 0x6E,
+    0xDC, 0x85, 0xA2, 0x78, 0x03, 0xB8, 0xE9, 0xD5, 0x54, 0xE7, 0xDE, 0x95, 0x7E, 0x1F, 0xC0, 0x25,
+    0x60, 0xEF, 0xA7, 0x6E, 0x2E, 0x95, 0xEE, 0xE6, 0x7E, 0x6A, 0x8A, 0x10, 0xA6, 0xA2, 0x04, 0x28,
+    0xA1, 0x81, 0x29, 0x05, 0x93, 0x12, 0xA6, 0xC5, 0xBF, 0x0F, 0x70, 0xFC, 0x98, 0x0B, 0x27, 0xF8,
+    0xB7, 0x9D, 0xDB, 0xB1, 0x48, 0x2B, 0x49, 0x77, 0x45, 0xF3, 0x57, 0x33, 0x00, 0x6D, 0xC3, 0xCB,
+    0x19, 0xA8, 0x00, 0x46, 0x9C, 0xE1, 0xA6, 0xCE, 0xF9, 0xF4, 0xE2, 0xAE, 0xD5, 0xC8, 0x93, 0x97,
+    0xD7, 0xDE, 0x9E, 0xE9, 0xC0, 0x6E, 0x8F, 0x2A, 0x70, 0x7E, 0x2E, 0x19, 0x17, 0x96, 0xD0, 0xD3,
+    0x28, 0x4A, 0xA2, 0x3A, 0x50, 0x8B, 0x85, 0xA9, 0xB0, 0x44, 0x97, 0x82, 0x80, 0x2A, 0x0D, 0x16,
+    0x1C, 0xC9, 0xC2, 0x56, 0xFD, 0x82, 0x7F, 0x37, 0xE3, 0x5E, 0x1D, 0x3A, 0xD7, 0x5F, 0x7B, 0xFB,
+    0x3E, 0xEB, 0x73, 0x24, 0x4A, 0x82, 0xD8, 0xF3, 0xA6, 0x27, 0x3B, 0x64, 0x1C, 0x15, 0xE8, 0xE5,
+    0xD8, 0x38, 0x08, 0x58, 0xEB, 0x84, 0x55, 0xD5, 0x5C, 0x05, 0x45, 0x62, 0xFF, 0x3E, 0x7D, 0x02,
+    0xE2, 0x2B, 0x24, 0x95, 0xCC, 0x28, 0xA7, 0x76, 0xA6, 0x87, 0x95, 0x99, 0x10, 0x0A, 0x18, 0xE7,
+    0x3E, 0x2E, 0x61, 0x1A, 0xFA, 0xC0, 0xA0, 0x97, 0x3C, 0xAF, 0x23, 0x0F, 0x46, 0xD9, 0x7E, 0xE1,
+    0xC5, 0x8A, 0x1F, 0x44, 0xCD, 0xBA, 0xE5, 0xCF, 0x0B, 0x22, 0x00, 0x6F, 0xC2, 0x3F, 0x6F, 0x66,
+    0x50, 0x86, 0xD1, 0x7D, 0x41, 0x39, 0x7D, 0x10, 0xEB, 0x04, 0x01, 0x7B, 0x12, 0x28, 0xAB, 0x51,
+    0x1C, 0x87, 0x52, 0xBD, 0xFE, 0x49, 0x42, 0x59, 0x98, 0x77, 0xD7, 0x68, 0x5D, 0x19, 0xB7, 0x34,
+    0x3E, 0xE9, 0x38, 0xCA, 0xF2, 0xC9, 0x97, 0x90, 0x83, 0xD7, 0x95, 0x1B, 0xD9, 0xD7, 0xF6, 0x43,
+    0xE0, 0x14, 0xE5, 0x27, 0xB6, 0x25, 0xFD, 0x1B, 0xC2, 0x83, 0xDF, 0x04, 0x5F, 0xC4, 0x52, 0x81,
+    0x5F, 0x78, 0xE9, 0xC4, 0xDA, 0xD7, 0x68, 0x1E, 0x83, 0xDF, 0x00, 0xDB, 0x6E, 0x3D, 0x37, 0x89,
+    0xAB, 0xA2, 0x5B, 0x87, 0xBC, 0xF6, 0xDA, 0x6F, 0xDC, 0x99, 0xFB, 0x10, 0xA8, 0xBA, 0xC4, 0x05,
+    0xC6, 0x0C, 0xEA, 0xC1, 0xAF, 0x77, 0x97, 0xDB, 0x7F, 0x9E, 0xD9, 0x14, 0x13, 0x86, 0xDF, 0x37,
+    0x7F, 0x3C, 0x44, 0x9B, 0xA1, 0xCB, 0xC7, 0x2B, 0x55, 0x73, 0x3D, 0x68, 0x1A, 0xDB, 0xD2, 0x67,
+    0x64, 0x9E, 0x01, 0xAB, 0xC1, 0xD2, 0x44, 0x7A, 0x40, 0xAF, 0x21, 0x75, 0xF2, 0xED, 0x69, 0x9D,
+    0xDE, 0xDB, 0xE5, 0xF5, 0xAA, 0xA8, 0xC6, 0x0D, 0x36, 0xA3, 0x5A, 0xDA, 0x8E, 0x5F, 0x62, 0x5B,
+    0x4E, 0xE2, 0x2C, 0xB6, 0x91, 0x97, 0x2C, 0x99, 0x7F, 0xE2, 0xC5, 0x65, 0x3C, 0x9F, 0x12, 0xFF,
+    0xC0, 0x7C, 0x00, 0xED, 0xBA, 0xC7, 0xC3, 0xA5, 0xA2, 0xFE, 0x0D, 0x8D, 0x55, 0xB1, 0x6F, 0xD6,
+    0x46, 0x14, 0x7F, 0xF6, 0xD1, 0x58, 0xCD, 0x0D, 0xC7, 0xF0, 0xA1, 0x0A, 0x50, 0xE4, 0xA9, 0x43,
+    0x23, 0x84, 0xFF, 0x01, 0xD2, 0x73, 0xC9, 0xC0, 0xD8, 0x48, 0x2D, 0x13, 0x03, 0x1D, 0x01, 0x55,
+    0xCA, 0x82, 0x44, 0x07, 0xC0, 0x8E, 0x32, 0x30, 0x82, 0x54, 0xA4, 0x6E, 0x05, 0x55, 0xA8, 0x2A,
+    0x5F, 0x91, 0xC2, 0xC0, 0x98, 0x0F, 0x3B, 0x64, 0xE8, 0xC0, 0x80, 0xDB, 0x54, 0xCA, 0xC0, 0x50,
+    0xB7, 0xA9, 0x4A, 0x11, 0xC3, 0x77, 0x01, 0x47, 0xB9, 0x24, 0x67, 0xBF, 0xFE, 0xEC, 0x40, 0x42,
+    0x69, 0x40, 0x3D, 0xDF, 0xE7, 0xBB, 0xF3, 0x9D, 0xDE, 0xFD, 0xDE, 0xEF, 0xFD, 0xDE, 0xFB, 0x74,
+    0x4A, 0xC2, 0x12, 0xE9, 0xD7, 0x86, 0x24, 0xD5, 0x19, 0x4F, 0x32, 0x3B, 0x5D, 0x25, 0x4B, 0xCE,
+    0xAF, 0x75, 0x1E, 0x2E, 0x59, 0xAF, 0xD6, 0xE9, 0xDE, 0x43, 0x41, 0x72, 0xD9, 0x35, 0x87, 0xC8,
+    0xBF, 0xD5, 0xE8, 0xAB, 0x2B, 0xF6, 0xB5, 0x17, 0x11, 0x0D, 0x3C, 0xA6, 0x86, 0xCE, 0x60, 0x76,
+    0x1B, 0xE3, 0x3B, 0x1E, 0xBF, 0x4E, 0x5C, 0x62, 0x75, 0x01, 0x04, 0x58, 0x76, 0x60, 0x54, 0xD9,
+    0x01, 0xC2, 0x72, 0x7C, 0xD6, 0x0A, 0xA7, 0x4A, 0x9D, 0xEB, 0xD9, 0x9A, 0x1A, 0x5D, 0x88, 0xCD,
+    0x9A, 0x14, 0x1B, 0xD2, 0x5C, 0x12, 0x73, 0x21, 0x9C, 0xCE, 0x55, 0x99, 0xE4, 0x3A, 0xCD, 0xD2,
+    0x86, 0x78, 0xD2, 0x12, 0xD3, 0x1B, 0x50, 0x76, 0x5E, 0xE3, 0xD2, 0x8E, 0x6C, 0x88, 0x75, 0x7E,
+    0xCE, 0x56, 0x33, 0xDA, 0x22, 0x4B, 0x9E, 0x84, 0x8B, 0xBA, 0x0C, 0x57, 0xE0, 0x2B, 0xAC, 0xA7,
+    0x51, 0xAE, 0x56, 0xAC, 0xEF, 0xFE, 0xC7, 0x74, 0x3C, 0xB0, 0xE2, 0x05, 0x57, 0xBA, 0x35, 0x73,
+    0x02, 0x46, 0xA2, 0x25, 0xF7, 0x76, 0x9E, 0xDA, 0x81, 0xB2, 0x6B, 0x94, 0x71, 0x1E, 0x31, 0x8B,
+    0x5A, 0xDA, 0x24, 0xD6, 0x0F, 0x8D, 0x5F, 0x33, 0x85, 0xBF, 0x19, 0xAF, 0xCE, 0x28, 0x7A, 0x5C,
+    0xF9, 0x70, 0x25, 0x79, 0xC0, 0x73, 0x95, 0xE2, 0x86, 0x42, 0x8E, 0x41, 0x1C, 0x8D, 0xCB, 0x0A,
+    0x80, 0x0D, 0x6E, 0x99, 0x6D, 0x02, 0xD7, 0xDE, 0xD2, 0x19, 0x04, 0x86, 0x16, 0x4C, 0x07, 0x1B,
+    0xBC, 0x2D, 0x72, 0xE7, 0x91, 0xD8, 0xE0, 0x5C, 0xFF, 0x37, 0xA6, 0x44, 0x7E, 0x3D, 0x3A, 0xCB,
+    0x5B, 0x2F, 0x10, 0x56, 0x3E, 0xCE, 0x59, 0xAA, 0x87, 0xB9, 0x64, 0xE3, 0xB3, 0x03, 0x1E, 0x8A,
+    0x86, 0x85, 0x5A, 0x77, 0x81, 0xE3, 0x21, 0x87, 0xCC, 0x0B, 0xFC, 0xC8, 0x90, 0x70, 0x04, 0x16,
+    0x49, 0xE7, 0xA4, 0x5E, 0x2E, 0xC6, 0x83, 0x95, 0xE7, 0x8D, 0xCE, 0x56, 0xF8, 0xA9, 0x2E, 0xF1,
+    0x41, 0xA7, 0xB0, 0xFA, 0xC6, 0x6B, 0xA4, 0x89, 0x99, 0x1F, 0x32, 0xEB, 0xBC, 0xC7, 0xB1, 0x8F,
+    0xC0, 0x70, 0xE5, 0xB3, 0xA5, 0xA4, 0xA2, 0xF0, 0x57, 0xD2, 0xC9, 0x8F, 0x8E, 0xF9, 0x77, 0xAE,
+    0x5B, 0x9F, 0xE8, 0x26, 0xC9, 0x9C, 0x34, 0xF9, 0xCD, 0x0F, 0x9A, 0x57, 0x99, 0xF3, 0x8C, 0x40,
+    0xA8, 0x34, 0x14, 0xE5, 0xB4, 0x33, 0x2D, 0x28, 0x61, 0x02, 0x42, 0x44, 0x1A, 0x2C, 0xC4, 0xA3,
+    0xDF, 0xC0, 0xEF, 0x24, 0x0D, 0x97, 0xF7, 0x1A, 0x96, 0x6C, 0x2B, 0xD4, 0x64, 0x89, 0xB9, 0x0E,
+    0x79, 0x58, 0x24, 0x76, 0xD0, 0xDE, 0xD2, 0xA7, 0xD1, 0xEF, 0x6A, 0xD2, 0x8B, 0x38, 0xA3, 0x8C,
+    0x34, 0x21, 0xE4, 0xA5, 0x67, 0x10, 0x05, 0x69, 0x3C, 0x07, 0xC4, 0x1B, 0xB8, 0x67, 0xCB, 0x40,
+    0x4A, 0x31, 0x69, 0xB8, 0x98, 0x40, 0x70, 0x98, 0x9E, 0xA3, 0x73, 0xE9, 0xA1, 0x2B, 0x95, 0x74,
+    0xD0, 0x55, 0xCA, 0x85, 0x9E, 0x75, 0xAA, 0x09, 0x4C, 0xB4, 0xB0, 0x6E, 0x32, 0xAF, 0x8E, 0x22,
+    0x55, 0xAA, 0x95, 0xD5, 0x0A, 0x46, 0x3E, 0x0E, 0x6F, 0xE4, 0xC1, 0x7A, 0xB1, 0x09, 0x2E, 0xE6,
+    0xD5, 0x30, 0x15, 0x70, 0x02, 0xA0, 0x6D, 0xC0, 0xE4, 0x71, 0xAC, 0x4B, 0x10, 0x27, 0x6A, 0x98,
+    0x1A, 0xBD, 0xC9, 0x31, 0x9E, 0xA0, 0x03, 0x28, 0x9A, 0x9A, 0x02, 0xA8, 0x56, 0x82, 0xDB, 0xA8,
+    0x65, 0xD5, 0xE2, 0xF6, 0x8A, 0xB2, 0xAB, 0x46, 0xB8, 0xB0, 0x44, 0x18, 0x7F, 0x69, 0xC0, 0x79,
+    0x9F, 0x46, 0x5E, 0xC1, 0x96, 0xFF, 0x86, 0x4D, 0x08, 0xBC, 0x0F, 0xD8, 0xC1, 0x4B, 0xD8, 0xAD,
+    0x0D, 0x5C, 0x45, 0x59, 0xDC, 0x05, 0x29, 0x2C, 0x71, 0x77, 0x67, 0x55, 0x70, 0x4A, 0xAA, 0x02,
+    0x6D, 0x7D, 0x10, 0x5C, 0xA3, 0x53, 0xE0, 0xDA, 0x50, 0xB6, 0xA4, 0xA6, 0x88, 0x2C, 0x4E, 0xCB,
+    0xAA, 0x3D, 0x8F, 0xAD, 0x84, 0x1B, 0x74, 0x3A, 0x9C, 0x6A, 0x13, 0xBA, 0xC0, 0xF8, 0x96, 0xEE,
+    0x53, 0x94, 0xCA, 0x52, 0xD8, 0x0F, 0x6A, 0x59, 0xFB, 0x4D, 0x3C, 0x5D, 0x21, 0x09, 0xDB, 0x2F,
+    0xDD, 0x56, 0x98, 0x07, 0xC8, 0xB2, 0x5C, 0x9A, 0x8B, 0x6F, 0x69, 0x67, 0x36, 0x48, 0x1B, 0xE5,
+    0x28, 0x89, 0x55, 0x21, 0x2A, 0x82, 0x27, 0xB1, 0x2A, 0x61, 0x26, 0xAA, 0x82, 0x5A, 0x36, 0x48,
+    0xCF, 0xEE, 0x4B, 0xB7, 0x25, 0x10, 0xE0, 0x56, 0xAF, 0x51, 0xE9, 0x69, 0xFE, 0xFE, 0x11, 0xF3,
+    0x0B, 0x4A, 0x6C, 0x1B, 0xB9, 0x83, 0xE1, 0xB3, 0x8D, 0xFA, 0x00, 0x79, 0x53, 0x4E, 0xAB, 0x45,
+    0x53, 0x27, 0xA7, 0x97, 0xD7, 0xEA, 0x64, 0xEE, 0xAF, 0x5B, 0xED, 0x9E, 0x6A, 0xBB, 0x97, 0x6D,
+    0x04, 0x6D, 0xAC, 0x5D, 0x54, 0xEE, 0x83, 0x4A, 0x61, 0x63, 0xB7, 0xE7, 0x14, 0x99, 0x83, 0x8A,
+    0x6B, 0x1C, 0xA0, 0xEC, 0xCF, 0xED, 0xF3, 0xF4, 0x5E, 0xA7, 0xBB, 0x10, 0x30, 0xD8, 0x84, 0x6C,
+    0x65, 0xB5, 0x6F, 0x57, 0xE3, 0x73, 0x9B, 0xB7, 0xC0, 0x83, 0x62, 0xC4, 0x6D, 0x47, 0xF0, 0x35,
+    0x79, 0x28, 0x44, 0xFC, 0xAA, 0xE1, 0x0B, 0x4D, 0x9C, 0x3D, 0x96, 0xB4, 0x77, 0xDA, 0x70, 0xC6,
+    0x46, 0xE4, 0x34, 0xCD, 0x47, 0xB1, 0x0D, 0x9F, 0xA1, 0x00, 0xB8, 0xCB, 0x3C, 0xE8, 0x51, 0x2F,
+    0x23, 0xB9, 0x8A, 0x00, 0x1E, 0x77, 0xBE, 0x13, 0x95, 0x2A, 0xA4, 0xC9, 0x48, 0x2D, 0x55, 0x14,
+    0xDD, 0x00, 0x40, 0xE8, 0x1E, 0xFA, 0x38, 0xCC, 0x7F, 0x23, 0xE3, 0x8C, 0x77, 0x7A, 0x2D, 0x6E,
+    0xB5, 0x1E, 0x75, 0x09, 0x68, 0xE8, 0xD4, 0xF6, 0x12, 0xDA, 0xA7, 0x5D, 0x1E, 0x5B, 0xBC, 0xBD,
+    0x5D, 0x56, 0xB1, 0xCA, 0x90, 0xE2, 0x4F, 0xAA, 0x2F, 0xEF, 0x53, 0x00, 0xA3, 0x95, 0x87, 0xD2,
+    0x93, 0x2C, 0x17, 0xC9, 0x40, 0xAC, 0x57, 0x3A, 0xDA, 0x82, 0xE8, 0x29, 0x29, 0x60, 0x42, 0x6C,
+    0xC6, 0xF7, 0x33, 0xFE, 0x09, 0x32, 0x23, 0xFA, 0x4A, 0x26, 0x57, 0xB6, 0x7E, 0x76, 0x53, 0xBD,
+    0xCE, 0x7B, 0x9A, 0x86, 0x4B, 0xF2, 0x69, 0x96, 0x92, 0x45, 0xFE, 0x29, 0x3A, 0x2B, 0xF3, 0x7B,
+    0x21, 0xCB, 0xC9, 0x99, 0xAA, 0xA7, 0xC6, 0x54, 0x4C, 0x47, 0xEE, 0x1E, 0x23, 0xBA, 0xB0, 0x80,
+    0x7C, 0x1B, 0x06, 0x39, 0x89, 0x3B, 0xA0, 0x6D, 0xEC, 0xFC, 0x04, 0xD1, 0xBD, 0x72, 0x9E, 0xC4,
+    0x83, 0x3C, 0xB3, 0x47, 0x45, 0x3E, 0x3D, 0x63, 0x82, 0x82, 0x22, 0x0A, 0x36, 0x4E, 0x19, 0xA8,
+    0x6D, 0x3B, 0x9D, 0xD1, 0x46, 0xF8, 0x13, 0x36, 0xFB, 0x27, 0x46, 0xE6, 0x3E, 0xE5, 0xE5, 0x62,
+    0xAD, 0x1A, 0x68, 0x3E, 0x5E, 0x5E, 0xA3, 0xFD, 0x1E, 0x79, 0x95, 0x4A, 0x55, 0x89, 0x40, 0x2B,
+    0xA3, 0x4C, 0x16, 0x67, 0x27, 0x50, 0xCC, 0xA3, 0xAE, 0x68, 0x07, 0x16, 0xBF, 0x4A, 0x43, 0x58,
+    0x09, 0xBD, 0x4F, 0xD7, 0x60, 0x04, 0x15, 0x0C, 0x22, 0x58, 0xED, 0xF7, 0x5B, 0x31, 0x13, 0x01,
+    0x84, 0x07, 0x30, 0x17, 0x0F, 0x7C, 0x9E, 0xD4, 0x78, 0xDC, 0x5E, 0x4E, 0x8C, 0x5E, 0x87, 0x13,
+    0xBA, 0x96, 0x93, 0xE9, 0xEA, 0xBC, 0x1A, 0x13, 0xB9, 0x39, 0x72, 0x57, 0x89, 0xFC, 0x42, 0x3E,
+    0x71, 0x99, 0x86, 0xC4, 0xA5, 0xB8, 0x23, 0x1E, 0xA7, 0x63, 0xE7, 0x95, 0x8A, 0xEF, 0x95, 0xC7,
+    0x42, 0x38, 0x61, 0x26, 0x8E, 0x8A, 0x07, 0xF1, 0x87, 0x7B, 0x39, 0x71, 0xE0, 0xE4, 0xC9, 0xCF,
+    0x98, 0x1B, 0x80, 0x00, 0x75, 0x7E, 0x23, 0xF8, 0x8F, 0x6A, 0x60, 0xD5, 0x40, 0x0C, 0x17, 0xD6,
+    0xD8, 0x85, 0x8E, 0xA6, 0x88, 0x3E, 0x82, 0x96, 0x90, 0x6B, 0x05, 0x11, 0x92, 0x6B, 0xE2, 0x25,
+    0xDE, 0xE7, 0xAD, 0x3C, 0x26, 0x5E, 0xDF, 0xE9, 0x21, 0xF1, 0xFA, 0x57, 0x21, 0xE7, 0x76, 0x67,
+    0x2A, 0xC0, 0xDF, 0xA9, 0xF9, 0x02, 0xAA, 0x47, 0xEE, 0x6C, 0x3F, 0x8A, 0x97, 0xD9, 0xF6, 0x6F,
+    0xD3, 0x94, 0x6C, 0xB7, 0xA6, 0x2E, 0x51, 0x88, 0x9A, 0x81, 0xFA, 0x73, 0x89, 0xD4, 0xB7, 0xA7,
+    0x9E, 0xB0, 0x99, 0x06, 0x19, 0xD2, 0xA2, 0x22, 0xC4, 0xF3, 0x6D, 0xE5, 0xFB, 0xDA, 0xBE, 0xEB,
+    0x7F, 0x65, 0xA7, 0xF2, 0x69, 0x1E, 0x2E, 0x6D, 0xB9, 0xC1, 0x9E, 0xF5, 0xFF, 0x2D, 0xED, 0x1F,
+    0xB5, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0x3D, 0x1E, 0x83, 0x8C, 0xB0, 0x84, 0x23, 0x41, 0xBD,
+    0xD3, 0xA4, 0x42, 0x62, 0xDD, 0x52, 0x2C, 0x3B, 0x96, 0x52, 0xA4, 0x0C, 0x12, 0xBB, 0xA2, 0xE0,
+    0x47, 0xD0, 0xD2, 0xEC, 0x1B, 0xC3, 0x16, 0x14, 0xD4, 0xF9, 0x2D, 0x34, 0xBB, 0x6B, 0x27, 0x5B,
+    0x50, 0xA4, 0x78, 0x16, 0xD1, 0x8A, 0xF2, 0x39, 0x82, 0x34, 0x50, 0xE0, 0xEC, 0x1B, 0x29, 0x5E,
+    0x76, 0xEC, 0xCB, 0xB9, 0xEF, 0x05, 0x12, 0x04, 0x44, 0x28, 0x22, 0xD6, 0xDB, 0xB1, 0xF7, 0xEA,
+    0xCE, 0x39, 0xF7, 0xE3, 0xCC, 0x1D, 0x23, 0x72, 0x4F, 0x24, 0x3A, 0xF9, 0xE1, 0x3B, 0x89, 0x7B,
+    0x8D, 0x9C, 0x3F, 0x78, 0xFE, 0xF2, 0x72, 0x7E, 0xCE, 0x57, 0x29, 0xE7, 0x6D, 0x13, 0xF7, 0xF0,
+    0xE9, 0x79, 0x8B, 0xBD, 0x3D, 0xA4, 0x2F, 0x79, 0xF1, 0xD9, 0x2D, 0x7F, 0xB9, 0x9A, 0xDE, 0x40,
+    0x01, 0x0F, 0x87, 0xD8, 0x3C, 0x99, 0x69, 0xCB, 0x06, 0xFF, 0x40, 0x76, 0xE3, 0xBB, 0x43, 0xD1,
+    0xD2, 0x96, 0xF2, 0xF5, 0x3E, 0x90, 0xCC, 0x46, 0x86, 0x71, 0xFF, 0x28, 0x5F, 0x99, 0x75, 0x77,
+    0x32, 0x2D, 0xAC, 0xE0, 0x0C, 0x09, 0x6E, 0x60, 0x91, 0xF5, 0x66, 0xB2, 0x7D, 0x1A, 0xCB, 0x2E,
+    0x8D, 0xAE, 0xD5, 0xBF, 0x62, 0x68, 0xD0, 0xE4, 0x21, 0x0F, 0xBE, 0xF6, 0xC7, 0xD1, 0x8C, 0xB6,
+    0x45, 0xFD, 0x16, 0x92, 0x00, 0x5B, 0x25, 0x33, 0x8A, 0xD6, 0x48, 0x9D, 0x77, 0xB8, 0xEE, 0xD3,
+    0x01, 0xC9, 0x68, 0x02, 0xB0, 0x40, 0x04, 0x6C, 0x7D, 0x42, 0xEE, 0x7E, 0x91, 0x0E, 0xC9, 0xE8,
+    0x4C, 0xC4, 0xC2, 0x7E, 0x29, 0xB0, 0x77, 0x5A, 0x69, 0x91, 0x75, 0xDF, 0x0E, 0x48, 0x87, 0x2F,
+    0x22, 0x4C, 0xD8, 0x73, 0x40, 0x2C, 0x25, 0xE0, 0x24, 0x97, 0x99, 0x3B, 0xB9, 0x95, 0x16, 0xF7,
+    0x9F, 0xE1, 0xED, 0x4F, 0x84, 0x2F, 0x85, 0xF0, 0x5F, 0xAF, 0x7A, 0xC2, 0x27, 0x23, 0xE1, 0x71,
+    0x4A, 0x78, 0xFA, 0xD1, 0xDB, 0x2B, 0x22, 0x97, 0x13, 0xF8, 0x43, 0x5A, 0x9C, 0xB0, 0x08, 0x85,
+    0x0C, 0x5A, 0x2C, 0x94, 0xCA, 0xD1, 0x28, 0xE1, 0xCD, 0x23, 0x6E, 0xC1, 0x47, 0x18, 0xF1, 0xF6,
+    0x68, 0x06, 0xD8, 0x90, 0xF5, 0x78, 0xF3, 0xB4, 0x68, 0x19, 0x89, 0xFD, 0x2A, 0x74, 0xDE, 0x65,
+    0x41, 0xA6, 0xD3, 0x22, 0xF8, 0x10, 0x77, 0x03, 0x61, 0x17, 0x81, 0x04, 0x97, 0x01, 0xF9, 0xFD,
+    0xEF, 0x89, 0x71, 0x2C, 0x02, 0x97, 0x72, 0xD9, 0x30, 0x6A, 0x56, 0x28, 0x01, 0xDF, 0xEA, 0xCF,
+    0x55, 0xD8, 0x3E, 0xB6, 0xD2, 0x6F, 0x0F, 0xC3, 0x9C, 0x46, 0x94, 0x1D, 0x5C, 0xAD, 0x71, 0xF9,
+    0xEA, 0x3D, 0xFF, 0x33, 0x15, 0x30, 0xE7, 0x32, 0xE2, 0x70, 0xEB, 0x6A, 0x26, 0x2E, 0x79, 0xD0,
+    0x4D, 0x8C, 0x00, 0xFB, 0xCF, 0x10, 0x0A, 0xA6, 0x0D, 0xE9, 0x18, 0xB7, 0x00, 0xE9, 0x35, 0x73,
+    0xF0, 0xC4, 0xC8, 0x2F, 0x69, 0x9E, 0xE9, 0x68, 0xBB, 0x19, 0x26, 0x16, 0x03, 0x5C, 0xEB, 0xAB,
+    0xEC, 0xEA, 0xB3, 0x11, 0x8D, 0x48, 0x5B, 0x88, 0x4C, 0x89, 0x88, 0xF4, 0xAE, 0x83, 0xA4, 0x11,
+    0xDA, 0x45, 0xF8, 0x25, 0xE3, 0x8F, 0x5B, 0xD4, 0x54, 0xC9, 0x1A, 0xAD, 0x06, 0xB9, 0xD2, 0xFE,
+    0xB5, 0x72, 0x35, 0xED, 0x16, 0x30, 0xBB, 0x1C, 0x81, 0x91, 0x7D, 0x7A, 0x3D, 0x5C, 0xB6, 0xEE,
+    0x91, 0xCB, 0x19, 0xF0, 0x1B, 0xC5, 0xF6, 0x8E, 0xF9, 0x23, 0x27, 0xFE, 0x83, 0x82, 0xD9, 0x1A,
+    0x6D, 0xBF, 0x63, 0xCA, 0xD9, 0x9A, 0x61, 0x34, 0xCC, 0xBB, 0x78, 0x14, 0x91, 0x4C, 0x45, 0xCF,
+    0x1A, 0x08, 0x01, 0x32, 0xCA, 0xE6, 0x6E, 0x53, 0xE7, 0x3C, 0x9A, 0x20, 0x45, 0x67, 0x45, 0x66,
+    0x96, 0xA9, 0x18, 0x5C, 0x8B, 0xE6, 0x36, 0x05, 0x16, 0x85, 0xCD, 0x6C, 0xF1, 0x61, 0x5E, 0x21,
+    0xE7, 0x56, 0x9C, 0x51, 0x29, 0x49, 0xF5, 0xF1, 0xEB, 0xE2, 0xC9, 0xC2, 0xB3, 0x02, 0xED, 0xEC,
+    0xF0, 0xE4, 0x3E, 0xEA, 0xB7, 0xF0, 0xFF, 0x6F, 0x7B, 0x68, 0xA7, 0x9C, 0x35, 0x0A, 0x9E, 0x11,
+    0x91, 0xCA, 0x4C, 0xCD, 0xDD, 0x03, 0x06, 0xAC, 0x44, 0x5E, 0x03, 0x48, 0xA3, 0x25, 0x9F, 0xED,
+    0x3C, 0x75, 0xDA, 0x10, 0x66, 0x48, 0xC7, 0x8C, 0xA0, 0xE5, 0xE3, 0xCF, 0x1F, 0x1F, 0xE8, 0xEE,
+    0x4A, 0x77, 0xD3, 0xDB, 0x29, 0x50, 0x32, 0xC1, 0xF6, 0x4C, 0x04, 0x5E, 0x26, 0x5F, 0xD1, 0xFB,
+    0x69, 0x44, 0xA6, 0xD8, 0xFA, 0xF8, 0xB9, 0x62, 0xA6, 0x34, 0x8E, 0xC5, 0x64, 0xBA, 0xA6, 0xDE,
+    0xF0, 0xD3, 0x1D, 0x4D, 0xB5, 0x91, 0xBE, 0x2A, 0x9F, 0xE7, 0x03, 0x8C, 0x0E, 0x9A, 0x1E, 0x87,
+    0x58, 0x36, 0xE3, 0x26, 0xC3, 0xEF, 0x49, 0x51, 0x67, 0x0C, 0x00, 0x74, 0xD9, 0x04, 0xC5, 0xCC,
+    0x59, 0xFB, 0x4C, 0xB6, 0x00, 0x84, 0xA8, 0x15, 0xC5, 0xEB, 0x04, 0x81, 0x06, 0xE4, 0x65, 0x16,
+    0xB9, 0x9E, 0x0E, 0xEF, 0x68, 0x2D, 0x88, 0xC6, 0x53, 0xBA, 0x14, 0x71, 0x12, 0xE5, 0xF0, 0x93,
+    0x88, 0xE2, 0xB9, 0xF5, 0x57, 0x91, 0x46, 0xE6, 0x2D, 0x84, 0xF6, 0xA5, 0xDA, 0x1C, 0x85, 0x57,
+    0x42, 0xA0, 0x9E, 0x9B, 0x31, 0xFF, 0x31, 0x1C, 0x71, 0x92, 0xBC, 0x02, 0xC2, 0x8E, 0xE9, 0xA6,
+    0xF2, 0x3C, 0x2C, 0x36, 0x82, 0x32, 0x22, 0xAB, 0x8D, 0xF5, 0x45, 0x5F, 0x59, 0x6F, 0x11, 0x2E,
+    0x0E, 0x54, 0x45, 0x7F, 0x5A, 0xAF, 0x37, 0x08, 0x2C, 0x9A, 0x1D, 0xC0, 0x21, 0xD3, 0x73, 0xE6,
+    0x11, 0x35, 0x8A, 0x94, 0x52, 0x71, 0x40, 0x71, 0x8E, 0xD3, 0xF9, 0x6F, 0x1F, 0x99, 0x3C, 0x54,
+    0x1F, 0xBD, 0x28, 0x22, 0xB7, 0x39, 0x1D, 0xB6, 0xDA, 0x45, 0x5E, 0x3E, 0xDC, 0xA7, 0x37, 0x00,
+    0xFE, 0x6D, 0x49, 0x24, 0x6C, 0xFC, 0xB4, 0x50, 0x1C, 0xB2, 0x31, 0xBB, 0x8C, 0xFB, 0x9C, 0xBF,
+    0x2A, 0x26, 0xF2, 0xE6, 0xD2, 0xA5, 0x2F, 0xA4, 0xF7, 0x8F, 0x9F, 0x96, 0x91, 0xA9, 0xEF, 0x07,
+    0xF9, 0x37, 0x43, 0x5C, 0x14, 0xF7, 0xAA, 0x1B, 0x9B, 0x90, 0x9D, 0xDC, 0x97, 0xF0, 0x12, 0x62,
+    0x2E, 0x56, 0x6E, 0xA9, 0x5F, 0x9B, 0xCB, 0x95, 0x96, 0x2E, 0xA8, 0x04, 0x6B, 0x77, 0xE1, 0xC7,
+    0x62, 0x30, 0x2A, 0x6E, 0xD7, 0x09, 0xB2, 0xD1, 0x5F, 0x80, 0xE5, 0xEF, 0xDC, 0x4A, 0x42, 0xF1,
+    0x54, 0xA2, 0xDE, 0x66, 0xC9, 0x4C, 0x72, 0xB9, 0xC5, 0x1E, 0xB5, 0xD4, 0x60, 0x47, 0xB9, 0xF6,
+    0x54, 0x56, 0x97, 0xCA, 0xCC, 0x49, 0xBD, 0x6B, 0x38, 0xB1, 0xE7, 0x01, 0x65, 0x33, 0x22, 0x4F,
+    0xC2, 0xF6, 0x96, 0xE0, 0x7D, 0xB0, 0x24, 0xD8, 0x5A, 0xBA, 0x24, 0x32, 0x59, 0xEF, 0xA4, 0xB6,
+    0xCB, 0xD5, 0x90, 0xAD, 0xAF, 0xE6, 0x24, 0xCE, 0x8E, 0xB7, 0xC3, 0x71, 0xB4, 0xCB, 0xBE, 0xB9,
+    0xBD, 0x1E, 0x8B, 0x27, 0x71, 0x4E, 0x66, 0xE7, 0x6A, 0xB7, 0x5A, 0xF6, 0x99, 0xF0, 0xDC, 0x37,
+    0x91, 0xAD, 0x10, 0x57, 0x1B, 0x59, 0xF6, 0x70, 0x03, 0xFE, 0xF2, 0xFC, 0x0E, 0xB5, 0x55, 0x3D,
+    0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xB6, 0xD9, 0x18, 0xE4, 0x62, 0x10, 0x4A, 0x24, 0xA4, 0x08, 0xE6,
+    0x0F, 0x90, 0xB8, 0xA5, 0x81, 0xB1, 0x68, 0x28, 0xD2, 0xD0, 0x40, 0x43, 0x01, 0xFF, 0x60, 0x29,
+    0x28, 0x59, 0xCD, 0x2C, 0x14, 0x14, 0x5B, 0x90, 0x9E, 0x82, 0x1F, 0x40, 0x91, 0x86, 0x32, 0xC4,
+    0x8E, 0xB6, 0xD8, 0x82, 0x62, 0xAD, 0x20, 0x94, 0x82, 0x02, 0x17, 0x91, 0x22, 0x25, 0xC5, 0x9B,
+    0xD5, 0x1A, 0xAD, 0xC9, 0xCE, 0xF8, 0x70, 0xC6, 0xBB, 0x9B, 0x7D, 0x42, 0x7C, 0x48, 0x4B, 0xF6,
+    0xEA, 0xDD, 0x91, 0x67, 0x9E, 0xE7, 0x9C, 0x3B, 0xF7, 0x9E, 0xB9, 0x16, 0xA1, 0xE5, 0x33, 0x87,
+    0x72, 0xE4, 0xA0, 0x7A, 0x0E, 0xB5, 0x9C, 0x58, 0x0D, 0x47, 0x47, 0x53, 0x01, 0x31, 0x83, 0xB3,
+    0xDE, 0x0C, 0x82, 0xAF, 0x82, 0x94, 0xC1, 0x3A, 0x31, 0x3F, 0x4D, 0x52, 0xC4, 0xB6, 0x91, 0xFA,
+    0xD7, 0x51, 0xF2, 0xE5, 0xE1, 0x21, 0x57, 0x82, 0xE9, 0xC4, 0xEC, 0xCE, 0x52, 0x4D, 0x7A, 0xCA,
+    0x21, 0x2D, 0xD0, 0xE7, 0xC0, 0x24, 0x57, 0xE8, 0x6B, 0xB6, 0x30, 0xDA, 0x46, 0x44, 0x93, 0xB0,
+    0x18, 0x2E, 0x9F, 0xD0, 0x92, 0x47, 0x83, 0x5C, 0x07, 0x41, 0x64, 0x3A, 0x63, 0xBC, 0x1C, 0x42,
+    0xED, 0xBC, 0x94, 0x68, 0x45, 0x66, 0xF4, 0xA2, 0xF2, 0x47, 0xA7, 0x47, 0xE6, 0xFF, 0x7C, 0x71,
+    0x5C, 0x76, 0xE8, 0xA9, 0x44, 0x31, 0x8B, 0x9A, 0x08, 0x66, 0xF7, 0x12, 0x6A, 0x4B, 0xC2, 0xE7,
+    0x3C, 0xCB, 0x43, 0x0A, 0x61, 0x37, 0x24, 0xC2, 0x41, 0xDA, 0x6D, 0xB8, 0xDA, 0xA7, 0x30, 0x53,
+    0xBC, 0x4E, 0x36, 0xE9, 0x8B, 0xDD, 0x28, 0x9D, 0x94, 0x3E, 0xF2, 0x80, 0xAA, 0x93, 0xAC, 0x79,
+    0xF5, 0x32, 0xB9, 0x44, 0xDE, 0x90, 0xB7, 0x4D, 0x13, 0xF5, 0xCF, 0x44, 0x1C, 0x98, 0x2F, 0x41,
+    0x53, 0xA0, 0x57, 0x8F, 0x47, 0xB3, 0x1D, 0x6F, 0xCA, 0x17, 0x2F, 0x49, 0xA2, 0x7F, 0x99, 0xCC,
+    0xC7, 0x3E, 0x4F, 0xDB, 0xD7, 0xD8, 0x2D, 0xD9, 0x15, 0xF6, 0xA6, 0xE2, 0x90, 0xEC, 0x5B, 0x64,
+    0x57, 0x5F, 0xC6, 0xF6, 0x3D, 0x4F, 0xF6, 0x2D, 0xB2, 0x7F, 0xE3, 0x98, 0x51, 0x4F, 0xF6, 0x98,
+    0xD8, 0xBB, 0x53, 0x76, 0x4B, 0x76, 0xB5, 0x22, 0xCD, 0x67, 0xEB, 0x95, 0xAC, 0x98, 0xE6, 0x8A,
+    0x5A, 0x2D, 0xFD, 0x99, 0x72, 0x2A, 0x2F, 0xA6, 0xED, 0x04, 0x90, 0x02, 0x41, 0x14, 0x38, 0xC5,
+    0xBF, 0x4E, 0xEF, 0xF4, 0xD9, 0x6C, 0x7B, 0xED, 0x41, 0x82, 0x54, 0x3A, 0x8B, 0xE6, 0x1C, 0x9E,
+    0xD0, 0x4C, 0x4B, 0x42, 0x7F, 0x57, 0x5E, 0x38, 0x3A, 0x0F, 0xA3, 0xE8, 0xF7, 0x4C, 0x53, 0xF6,
+    0xF5, 0x8B, 0x44, 0xCF, 0x86, 0xB7, 0x44, 0x3D, 0x08, 0x62, 0xDE, 0x1F, 0xE4, 0xEA, 0xC6, 0xA2,
+    0x01, 0x6E, 0x58, 0xFD, 0x27, 0xDC, 0xDA, 0xF4, 0xE9, 0x28, 0xF6, 0xBB, 0xB1, 0x0C, 0x06, 0x18,
+    0x0C, 0x66, 0x5E, 0x97, 0xFE, 0x3C, 0xEB, 0x4C, 0x49, 0x1E, 0x4F, 0x92, 0xAE, 0xDC, 0xE9, 0x0A,
+    0x0B, 0xD7, 0x15, 0xA1, 0xEE, 0xAB, 0x51, 0x79, 0xE5, 0xAB, 0xB1, 0xEE, 0xD3, 0xE5, 0xA0, 0xAA,
+    0x78, 0x4E, 0xDE, 0xEF, 0x96, 0x37, 0xCD, 0xB0, 0x58, 0x3A, 0xED, 0xF9, 0x67, 0xE7, 0xDB, 0x14,
+    0x26, 0x1F, 0x0A, 0x5E, 0x44, 0x20, 0xD1, 0xEF, 0x7B, 0x7D, 0x14, 0xB2, 0x08, 0xB1, 0x6D, 0xA7,
+    0x57, 0x5E, 0x1D, 0xCD, 0x77, 0x02, 0x05, 0x61, 0x10, 0xD4, 0xEF, 0x1F, 0x14, 0x84, 0xC5, 0xB2,
+    0x67, 0xB1, 0xAC, 0x8D, 0x42, 0xB5, 0x74, 0x3A, 0x45, 0xCD, 0xBC, 0x18, 0xA7, 0x4E, 0xDD, 0x76,
+    0x66, 0x1B, 0x62, 0x78, 0x9D, 0x4F, 0x1C, 0x0D, 0xE7, 0x83, 0x71, 0x75, 0x30, 0xAE, 0x8C, 0xC6,
+    0x65, 0xF3, 0xE2, 0x3B, 0xDF, 0x46, 0xB3, 0x43, 0xDA, 0xAF, 0x31, 0x3C, 0xAF, 0x52, 0x93, 0xEA,
+    0x92, 0x22, 0x2B, 0x97, 0xB5, 0xEB, 0x49, 0x8B, 0x5E, 0x61, 0xCE, 0x1B, 0xD2, 0x56, 0x3E, 0xFB,
+    0x38, 0x28, 0x40, 0xA1, 0xDD, 0x1F, 0xAB, 0xC3, 0x90, 0x07, 0x08, 0xCC, 0x33, 0xEC, 0xE1, 0xC8,
+    0xDB, 0xF1, 0xEE, 0x79, 0xAD, 0x97, 0xDF, 0x3D, 0x91, 0x2D, 0xB9, 0x30, 0x88, 0xF1, 0x52, 0xCF,
+    0x52, 0xEF, 0x0C, 0xBA, 0xF9, 0xF1, 0x42, 0x20, 0xF9, 0xF8, 0x66, 0x8E, 0x55, 0x73, 0x8C, 0xEE,
+    0xF3, 0x6A, 0xA9, 0xDB, 0xE6, 0x98, 0x31, 0x5B, 0x06, 0xD3, 0x2B, 0x29, 0xBA, 0xBA, 0xDB, 0xD8,
+    0xF4, 0xCC, 0xAB, 0x99, 0x61, 0xFA, 0x7A, 0xDF, 0x13, 0xA4, 0x08, 0x78, 0x0A, 0x8D, 0xDF, 0xEE,
+    0xE3, 0x81, 0x4F, 0x9F, 0x05, 0xF7, 0x43, 0x31, 0x5A, 0x89, 0xBA, 0xDB, 0xC8, 0x9A, 0x8B, 0x00,
+    0xA4, 0x36, 0xCF, 0x63, 0xDC, 0xB8, 0x29, 0xD5, 0x2D, 0x76, 0x8C, 0x4E, 0xAE, 0x2F, 0x71, 0x5C,
+    0x41, 0xA3, 0x11, 0x58, 0x73, 0x77, 0x9B, 0xB5, 0xA7, 0x58, 0x3F, 0x02, 0x27, 0xBB, 0x58, 0x1D,
+    0xC6, 0x74, 0x8C, 0xD6, 0x74, 0x66, 0x7F, 0x6E, 0x0F, 0x10, 0x83, 0x8E, 0xF5, 0x49, 0x4F, 0x73,
+    0xF6, 0x76, 0x89, 0x99, 0x72, 0xA5, 0xF6, 0xE1, 0xAF, 0x16, 0xC8, 0x62, 0x92, 0xA1, 0x71, 0xD7,
+    0xEC, 0x2F, 0x9F, 0x1C, 0xA4, 0xC5, 0xC4, 0x0C, 0xB4, 0xCD, 0xA2, 0x29, 0xC3, 0xE6, 0xEB, 0x75,
+    0x90, 0xD7, 0xB0, 0x89, 0x27, 0x77, 0x2D, 0xB3, 0x82, 0x12, 0xCE, 0x9C, 0x75, 0xB3, 0xF6, 0x51,
+    0x85, 0xA0, 0x31, 0x99, 0xE1, 0x53, 0x76, 0xBF, 0xF6, 0xAC, 0x5E, 0x58, 0xB4, 0x6E, 0xBB, 0xD7,
+    0x93, 0xDA, 0x10, 0x72, 0x36, 0xD1, 0x77, 0x88, 0xD6, 0x08, 0xFB, 0x6B, 0xD5, 0x67, 0x8C, 0x7F,
+    0xFE, 0x5B, 0x8D, 0x54, 0x7F, 0xB0, 0x5B, 0x7A, 0x36, 0x4C, 0xE5, 0xEB, 0x87, 0x63, 0xF1, 0x2C,
+    0x7E, 0x38, 0x63, 0xB1, 0x63, 0xBF, 0xDC, 0x1C, 0xD3, 0x65, 0xD5, 0xFC, 0x7D, 0xC7, 0xC0, 0xCB,
+    0xB5, 0x2F, 0xD3, 0x5F, 0x34, 0x72, 0x31, 0x90, 0xFF, 0x63, 0x7F, 0x02, 0xB5, 0x55, 0xB1, 0x6E,
+    0x1D, 0x45, 0x14, 0x3D, 0xB3, 0x63, 0x67, 0x25, 0x6F, 0x31, 0x29, 0x42, 0x03, 0xC5, 0x36, 0x54,
+    0x11, 0x62, 0xBE, 0x00, 0xCF, 0x22, 0xCA, 0x14, 0xA4, 0x41, 0x14, 0x29, 0xD2, 0xA7, 0xA1, 0xA5,
+    0xCA, 0xAC, 0x44, 0x41, 0xE1, 0xC6, 0x1D, 0x65, 0x5C, 0xA4, 0x08, 0xA6, 0x30, 0x05, 0x85, 0x91,
+    0x08, 0x33, 0xE0, 0x22, 0x05, 0x85, 0x37, 0x79, 0x85, 0x8B, 0x14, 0x59, 0x09, 0x24, 0x90, 0x28,
+    0x3C, 0x24, 0x8B, 0xB2, 0xB6, 0x67, 0xE7, 0x72, 0x67, 0x1F, 0x8E, 0x00, 0xD9, 0x08, 0x1C, 0xD8,
+    0xF7, 0xF4, 0x76, 0x67, 0x76, 0xE6, 0xCC, 0xB9, 0xE7, 0xDE, 0x7B, 0x1E, 0x00, 0x98, 0x00, 0x9D,
+    0xA0, 0x37, 0xFA, 0xBA, 0xB9, 0xCF, 0x43, 0x54, 0x47, 0xD0, 0x14, 0x34, 0x91, 0x0A, 0xFA, 0x60,
+    0x90, 0xC7, 0xD3, 0x7B, 0x89, 0xE6, 0xEB, 0x24, 0xA0, 0x98, 0x78, 0xBD, 0x17, 0x55, 0xFA, 0xCC,
+    0x13, 0x85, 0x92, 0xC6, 0xBC, 0xA1, 0x6C, 0xBF, 0x90, 0x83, 0xC5, 0x54, 0xFB, 0x55, 0xD1, 0xE4,
+    0x09, 0xFD, 0x03, 0x1C, 0x79, 0x47, 0xD1, 0x78, 0x77, 0xB3, 0x53, 0x3F, 0xFF, 0xFA, 0xFE, 0xC9,
+    0x12, 0xE1, 0xD0, 0xA3, 0x1A, 0x00, 0xC2, 0x8A, 0x3E, 0xDE, 0x91, 0x44, 0xBE, 0xA6, 0x1E, 0xF3,
+    0x99, 0x23, 0x5C, 0x53, 0x06, 0xAC, 0xF3, 0xF3, 0xD5, 0x46, 0xF5, 0x72, 0x44, 0x82, 0x69, 0xCF,
+    0x7A, 0x00, 0xE4, 0x54, 0x0D, 0xB5, 0x5F, 0x2E, 0x35, 0xED, 0x79, 0x9F, 0x8C, 0x1A, 0x61, 0x63,
+    0xF9, 0x74, 0x5C, 0x17, 0x99, 0xE7, 0xDA, 0x26, 0xEF, 0x67, 0x10, 0x46, 0x62, 0x94, 0xF3, 0x1E,
+    0xDF, 0xA8, 0xAE, 0xF5, 0xF1, 0x6B, 0xF5, 0x4D, 0x73, 0x79, 0xC6, 0xE7, 0x69, 0xD3, 0xFE, 0xDD,
+    0xCF, 0xCC, 0xFE, 0x6D, 0x2F, 0x52, 0x42, 0x49, 0x2D, 0x6C, 0x40, 0x4D, 0x1E, 0x7D, 0x62, 0x59,
+    0x86, 0x82, 0x5C, 0x4B, 0xAC, 0xC2, 0x31, 0x3D, 0x18, 0xE5, 0xE4, 0xA0, 0x9F, 0x04, 0x31, 0x11,
+    0xEA, 0xC7, 0xA1, 0x88, 0xB6, 0x35, 0x7B, 0xB4, 0x33, 0x28, 0x9A, 0x58, 0xED, 0x59, 0x35, 0xEC,
+    0x56, 0x30, 0x29, 0x54, 0x87, 0x09, 0x9F, 0xD7, 0x79, 0xA6, 0xD8, 0xE2, 0x45, 0x86, 0xDE, 0xC9,
+    0x10, 0x83, 0x5D, 0xC4, 0x62, 0x32, 0xBE, 0x5E, 0x8C, 0x62, 0x32, 0xED, 0xD9, 0xB7, 0x6E, 0x16,
+    0x9F, 0x15, 0xB2, 0x0D, 0x44, 0x64, 0x80, 0x30, 0xE3, 0xBA, 0xCD, 0x9C, 0x0E, 0x4E, 0x28, 0x0B,
+    0x37, 0xDA, 0xC6, 0x7C, 0x17, 0x8A, 0xCC, 0x22, 0x93, 0x61, 0x4E, 0x8F, 0x87, 0x82, 0xF3, 0x64,
+    0xBF, 0x9D, 0xC9, 0x24, 0x66, 0xBF, 0x24, 0x33, 0x43, 0x75, 0x39, 0x5D, 0x19, 0x69, 0x1D, 0x2F,
+    0x85, 0xC4, 0x89, 0x10, 0x14, 0x60, 0x6B, 0xAF, 0xDA, 0xDB, 0x17, 0x46, 0x12, 0xA3, 0x82, 0x3D,
+    0xE9, 0xD5, 0xE1, 0x84, 0xF0, 0x66, 0xF3, 0x7B, 0xA9, 0x56, 0x14, 0x0B, 0x2E, 0x45, 0xD3, 0xB9,
+    0x8F, 0x07, 0x19, 0xFF, 0xA4, 0xF1, 0xE4, 0x1A, 0xBD, 0x17, 0xCB, 0xA8, 0x8F, 0xA9, 0x21, 0xEA,
+    0x05, 0x0D, 0x79, 0x4F, 0xD1, 0xED, 0xC2, 0x29, 0x5F, 0xF6, 0x11, 0x57, 0x04, 0x2E, 0x8A, 0x82,
+    0xB7, 0x58, 0x1E, 0xAE, 0x66, 0x16, 0x7B, 0x2B, 0x0F, 0x0D, 0xD1, 0x3E, 0xD1, 0x2F, 0xDB, 0xDB,
+    0xF7, 0x70, 0x05, 0xA8, 0x5B, 0x54, 0x01, 0x62, 0x7C, 0xA1, 0x64, 0x75, 0xD4, 0x57, 0x44, 0xF3,
+    0x11, 0x0F, 0x69, 0x63, 0xD0, 0xD1, 0x95, 0xB4, 0x1F, 0x8E, 0x26, 0xD2, 0xF5, 0x93, 0xE7, 0x8F,
+    0x26, 0x37, 0x9A, 0x07, 0x54, 0x8E, 0x2C, 0x07, 0x88, 0x3A, 0xEE, 0x3E, 0x6C, 0x2E, 0xF7, 0xD5,
+    0x9C, 0xC1, 0x5C, 0xCA, 0xE9, 0x34, 0x99, 0x57, 0x9B, 0xB5, 0x4F, 0x38, 0xD9, 0xB6, 0xAD, 0x0F,
+    0xCE, 0xBA, 0x2D, 0xC6, 0x5C, 0x24, 0x76, 0x41, 0x34, 0xD5, 0x74, 0xD8, 0xD9, 0xF1, 0xFE, 0x0B,
+    0x0A, 0x75, 0x8F, 0x92, 0x09, 0x71, 0x03, 0x6B, 0xBC, 0x14, 0x92, 0x64, 0x08, 0x16, 0xC1, 0xBC,
+    0xEB, 0x2B, 0xAF, 0x2F, 0x8C, 0x54, 0x74, 0x1F, 0xC2, 0xA8, 0x4E, 0x86, 0x09, 0x2B, 0xB3, 0x6B,
+    0x14, 0x77, 0xF1, 0xE9, 0x79, 0x10, 0x07, 0x73, 0x7D, 0xEB, 0x45, 0x2C, 0x27, 0x16, 0xFA, 0x21,
+    0xA5, 0xA9, 0xA4, 0x8D, 0xEE, 0x94, 0x50, 0x0E, 0xCB, 0xB6, 0x90, 0xC3, 0x69, 0x68, 0x6B, 0x5B,
+    0xB8, 0xA5, 0x3B, 0x19, 0x73, 0x4B, 0x38, 0x38, 0x31, 0xC9, 0x51, 0x8E, 0x75, 0x57, 0x05, 0x07,
+    0xB5, 0x18, 0xA1, 0xEF, 0x78, 0x58, 0x37, 0x07, 0x51, 0x70, 0xAF, 0x4A, 0x16, 0x37, 0xBB, 0x92,
+    0xF1, 0x10, 0x69, 0x96, 0x5C, 0x71, 0x23, 0x1B, 0x06, 0xCD, 0x65, 0xC7, 0xEA, 0xE7, 0x2E, 0xFF,
+    0xE3, 0x8D, 0xCB, 0xD5, 0x11, 0xBB, 0xD7, 0x68, 0x7A, 0xBB, 0x97, 0xBB, 0x32, 0xC7, 0x88, 0xC4,
+    0xE6, 0xF4, 0xFD, 0x28, 0x92, 0xF1, 0x7A, 0x91, 0xF8, 0x6C, 0xA2, 0x8F, 0x72, 0xBA, 0xEF, 0xC4,
+    0xBF, 0x6E, 0x5F, 0x66, 0x34, 0xC7, 0xAF, 0xF6, 0xD8, 0x44, 0xAA, 0x0E, 0x97, 0x57, 0x67, 0x45,
+    0xEE, 0xE1, 0xD5, 0x8D, 0x01, 0xA4, 0xFA, 0x72, 0xD0, 0x5E, 0x7B, 0xDB, 0x24, 0x24, 0x36, 0x91,
+    0xA8, 0xBD, 0x1C, 0x12, 0xAA, 0x1F, 0xD9, 0x5A, 0xD8, 0x40, 0x0D, 0xCB, 0xEF, 0xB8, 0x16, 0x98,
+    0x63, 0x76, 0x63, 0x15, 0xE6, 0xE0, 0xCB, 0x08, 0xC9, 0x5E, 0xAA, 0x38, 0x00, 0x93, 0x85, 0xB9,
+    0xB5, 0xDD, 0xE4, 0xA2, 0xE6, 0x77, 0xD4, 0x2E, 0x55, 0x52, 0x3C, 0x00, 0xF1, 0x3B, 0x4D, 0x9C,
+    0xC3, 0x93, 0xBC, 0x8D, 0x79, 0x54, 0x4F, 0x79, 0x3A, 0xD5, 0x1E, 0x75, 0x97, 0x50, 0x44, 0x46,
+    0xE3, 0x54, 0x35, 0xE5, 0xD1, 0x0D, 0x36, 0x64, 0xF6, 0x67, 0xC5, 0x49, 0x13, 0x6C, 0xDC, 0x3D,
+    0x83, 0x92, 0x8C, 0xAC, 0x13, 0x9F, 0x65, 0xF7, 0x07, 0xC8, 0x78, 0x69, 0xFB, 0x6E, 0xC1, 0xBD,
+    0xE9, 0x66, 0x7C, 0xE1, 0xBA, 0x72, 0x2E, 0xDE, 0xFE, 0x75, 0x5E, 0x05, 0x87, 0x57, 0x5C, 0xFE,
+    0x83, 0xA0, 0x93, 0x48, 0x8D, 0x63, 0x45, 0xF6, 0x83, 0x7A, 0x46, 0x3B, 0xD1, 0x92, 0x2D, 0xE9,
+    0x9A, 0xCF, 0x74, 0xAE, 0xA3, 0x81, 0x6A, 0xD6, 0x33, 0x41, 0xCF, 0x69, 0x60, 0xFD, 0x2F, 0x9D,
+    0xB6, 0xCB, 0x7F, 0xCD, 0x74, 0x15, 0x2B, 0xB2, 0x53, 0x8D, 0xCB, 0x8B, 0x3A, 0x7C, 0x30, 0xEB,
+    0xF1, 0xDA, 0xC4, 0x07, 0x07, 0x36, 0x97, 0xA2, 0xE1, 0xBC, 0x57, 0x41, 0xDC, 0x88, 0x8C, 0xA0,
+    0xC8, 0xED, 0x0F, 0xD5, 0xB3, 0x58, 0x44, 0x8E, 0x25, 0xDB, 0x36, 0x3D, 0x0F, 0x76, 0xF8, 0xEA,
+    0x7F, 0x61, 0x85, 0x65, 0xB5, 0x96, 0x59, 0x8D, 0x1C, 0xB9, 0xFA, 0x29, 0xDB, 0x22, 0x8F, 0xC4,
+    0xEE, 0xBF, 0x54, 0x53, 0x76, 0xF9, 0x2B, 0x98, 0xD1, 0xED, 0xEB, 0x50, 0x8C, 0xF5, 0x25, 0xFE,
+    0xE9, 0xF5, 0x1B, 0xAD, 0x94, 0xBF, 0x6E, 0x1D, 0x45, 0x14, 0xC6, 0xCF, 0xEE, 0x84, 0xDC, 0x62,
+    0x8A, 0x71, 0x01, 0x12, 0x84, 0x62, 0x6B, 0xAA, 0x7D, 0x02, 0x34, 0x2B, 0xF3, 0x00, 0x44, 0x22,
+    0x16, 0x25, 0x29, 0xD2, 0x3B, 0x0F, 0x40, 0x98, 0x15, 0x3C, 0x40, 0xFC, 0x10, 0x14, 0xC8, 0x14,
+    0xD4, 0x48, 0xB6, 0x77, 0x50, 0xCA, 0x14, 0x5E, 0x30, 0x57, 0x29, 0xBD, 0x46, 0xAE, 0xD2, 0x78,
+    0xD0, 0xDD, 0xC8, 0xEB, 0xDC, 0xD9, 0xFD, 0xF8, 0x66, 0xAF, 0x03, 0x75, 0x2E, 0x5E, 0xDD, 0xD5,
+    0xD5, 0xEC, 0xCC, 0x9C, 0xF3, 0x3B, 0x7F, 0xBE, 0x23, 0xC2, 0x27, 0x83, 0x88, 0xE9, 0x44, 0x26,
+    0x11, 0xDD, 0xCA, 0xE6, 0xCB, 0x8D, 0x38, 0xC4, 0x05, 0xD0, 0xD9, 0x5E, 0xEF, 0x72, 0xC3, 0x04,
+    0x11, 0x57, 0x4B, 0x3E, 0xF2, 0x4C, 0x2F, 0x52, 0xF2, 0x5C, 0x53, 0x49, 0xC6, 0x1D, 0x15, 0xB9,
+    0x3B, 0x88, 0x14, 0x83, 0x1C, 0x58, 0xA0, 0x2E, 0x31, 0x49, 0x81, 0x4E, 0x6E, 0x9F, 0x45, 0x4C,
+    0xB6, 0x6D, 0x2D, 0xC7, 0xF3, 0xB2, 0xB9, 0xD4, 0x88, 0x05, 0x06, 0xDB, 0x3D, 0xA6, 0xB9, 0x46,
+    0x04, 0xEF, 0x7E, 0x34, 0xE7, 0xFC, 0xC7, 0x16, 0xD1, 0x20, 0xE6, 0xE8, 0xDF, 0xDD, 0xB7, 0x9D,
+    0x28, 0xB4, 0x52, 0x3E, 0x6F, 0xB3, 0x5E, 0xFB, 0x3B, 0x86, 0x43, 0x4D, 0xDB, 0xE6, 0xAC, 0x2F,
+    0xAB, 0xA3, 0xAD, 0xE0, 0x8A, 0x7A, 0xDE, 0xCA, 0xE9, 0x25, 0x3F, 0xB8, 0xEB, 0xCC, 0x7D, 0x47,
+    0xCF, 0x55, 0xA2, 0xF8, 0x6C, 0xAB, 0xCC, 0x2D, 0xBA, 0xB2, 0x5E, 0xAC, 0x06, 0xD1, 0xA8, 0x45,
+    0xC7, 0x3B, 0x86, 0x2B, 0xEA, 0x63, 0xBD, 0x1A, 0x72, 0xAE, 0xE1, 0xB7, 0x81, 0x2B, 0xEB, 0x63,
+    0x29, 0xCF, 0x5B, 0xB1, 0xD3, 0x5C, 0x61, 0x3E, 0x9A, 0x6C, 0xF4, 0x53, 0x01, 0xF8, 0x61, 0xFC,
+    0x1A, 0xCF, 0x43, 0x0E, 0xEB, 0xD5, 0x08, 0x59, 0xAC, 0xD9, 0x41, 0x08, 0xDC, 0xF4, 0x02, 0xB0,
+    0x19, 0xA2, 0x14, 0x57, 0x41, 0xE0, 0xBC, 0x8E, 0xC8, 0x70, 0x06, 0x4C, 0x06, 0x68, 0x2D, 0x2E,
+    0x53, 0xB7, 0xBC, 0x60, 0x40, 0x60, 0x59, 0x54, 0x64, 0x45, 0xCD, 0x8A, 0xA6, 0xAD, 0x67, 0x68,
+    0x89, 0xE5, 0x6D, 0xB2, 0x43, 0x43, 0xEE, 0x77, 0xF8, 0x7C, 0x22, 0x9B, 0x0E, 0x2C, 0x9C, 0xF5,
+    0x9A, 0xC6, 0xA4, 0xF4, 0x0C, 0xB8, 0xE1, 0x49, 0xFE, 0x15, 0xA1, 0x48, 0xEE, 0xE8, 0xCF, 0x81,
+    0xA1, 0xB8, 0xB0, 0xC9, 0xDE, 0x8C, 0xA8, 0xC0, 0x18, 0xC8, 0x58, 0xDB, 0xA5, 0x1B, 0x0C, 0x21,
+    0x79, 0xDE, 0xB6, 0xA4, 0x1C, 0xDC, 0x92, 0x4C, 0xE4, 0x38, 0x47, 0x6F, 0xAE, 0x11, 0x55, 0xB4,
+    0x3E, 0x9B, 0x98, 0x5F, 0x7C, 0x41, 0xC3, 0x9E, 0xA4, 0x44, 0x44, 0x97, 0x50, 0x15, 0xA6, 0x4A,
+    0x66, 0x30, 0x3A, 0xCE, 0xE9, 0x47, 0x33, 0xAE, 0x8F, 0xDC, 0x9F, 0x69, 0x69, 0xFF, 0x62, 0x79,
+    0xD6, 0x81, 0x47, 0x7F, 0xC3, 0x2E, 0xF4, 0x40, 0x33, 0xAD, 0x0E, 0xA8, 0xCA, 0x17, 0xA3, 0x34,
+    0x69, 0x99, 0xE0, 0x12, 0x9B, 0x9B, 0x20, 0xEE, 0x62, 0x26, 0x7B, 0x70, 0x78, 0xD0, 0xE0, 0x7B,
+    0xD6, 0x87, 0xD9, 0xC6, 0x35, 0x70, 0x05, 0x34, 0xCB, 0x47, 0x48, 0x25, 0x34, 0x29, 0x90, 0x08,
+    0xAC, 0x80, 0xD3, 0x37, 0x7B, 0xF4, 0xF8, 0xDF, 0xD7, 0x09, 0x58, 0x13, 0xE8, 0xFE, 0xE1, 0x8F,
+    0x39, 0xAF, 0x36, 0xEC, 0x92, 0x74, 0xFF, 0x80, 0x3C, 0xFC, 0x05, 0xE4, 0xA3, 0xAB, 0xEC, 0x2F,
+    0xCB, 0x6F, 0x68, 0x2C, 0x3D, 0xCD, 0xDC, 0x1C, 0xBC, 0xBB, 0xD3, 0xBC, 0x3E, 0x62, 0x10, 0x4C,
+    0x4D, 0xBA, 0xF0, 0xA1, 0xEC, 0xF4, 0xEA, 0x0F, 0x40, 0xA1, 0xCF, 0x4E, 0xE6, 0x14, 0x31, 0x07,
+    0xC9, 0xF2, 0xB8, 0xF7, 0x65, 0x90, 0x8D, 0x3F, 0xBA, 0x06, 0x12, 0xC5, 0xDE, 0x57, 0x1B, 0xD7,
+    0xB7, 0x5F, 0x13, 0x26, 0xA6, 0x0F, 0xE4, 0x9E, 0x6A, 0x4D, 0xD5, 0xC0, 0x1B, 0xCA, 0x7C, 0x7F,
+    0xA6, 0xD0, 0x37, 0x52, 0x22, 0x94, 0x80, 0x09, 0xE5, 0xAB, 0x5E, 0xBD, 0x1D, 0xF7, 0xA6, 0x0D,
+    0xC5, 0x3A, 0xCC, 0xAD, 0xCA, 0xCC, 0xEA, 0xE9, 0x67, 0x4F, 0xCC, 0x05, 0x86, 0xDB, 0x8E, 0x52,
+    0x41, 0x8A, 0x4E, 0x5C, 0x25, 0x4F, 0xB6, 0xC2, 0x48, 0x26, 0x0C, 0x3B, 0x65, 0x90, 0x8C, 0x0E,
+    0x3E, 0x91, 0xAD, 0x30, 0xDE, 0x3F, 0xFB, 0xF2, 0xB9, 0xA8, 0x4E, 0x0A, 0x8A, 0xFD, 0x21, 0x87,
+    0x91, 0xFC, 0xFA, 0x9E, 0x05, 0x60, 0xA3, 0x73, 0x26, 0x2A, 0xAA, 0x76, 0xA8, 0xE6, 0x49, 0x49,
+    0x8C, 0x6C, 0xD0, 0x17, 0xE3, 0x49, 0x0E, 0xF6, 0xE6, 0xB6, 0x99, 0x50, 0xA1, 0xA8, 0xDD, 0xBE,
+    0x5F, 0x50, 0x01, 0x8D, 0xDF, 0xB6, 0x20, 0x9C, 0x40, 0xDC, 0x29, 0x08, 0x61, 0x0B, 0x2F, 0x83,
+    0xDA, 0x8C, 0x8E, 0x4F, 0xD3, 0xC8, 0xA0, 0x3A, 0x28, 0x23, 0x33, 0xC9, 0xD3, 0x92, 0x72, 0xB5,
+    0xC4, 0x77, 0x7E, 0x9E, 0x43, 0x9C, 0x16, 0x88, 0xE9, 0x75, 0xE9, 0xAD, 0x73, 0x6A, 0x88, 0x6F,
+    0x97, 0xC7, 0x62, 0xC8, 0x23, 0x43, 0xE1, 0x04, 0xA1, 0xFC, 0xDD, 0x2C, 0xF5, 0xCD, 0x1C, 0x09,
+    0xC9, 0x43, 0xF1, 0xB2, 0x33, 0xF5, 0xB3, 0x79, 0xDD, 0xFE, 0x64, 0xD1, 0x50, 0x1F, 0xA7, 0x7D,
+    0xB9, 0x1E, 0xD4, 0x44, 0xE9, 0x51, 0xDB, 0x49, 0x61, 0x21, 0x9F, 0xC6, 0x34, 0x34, 0xDC, 0xE9,
+    0x84, 0xBF, 0x69, 0xA5, 0x88, 0x98, 0x25, 0x68, 0x56, 0x95, 0x19, 0xB8, 0xB6, 0x18, 0xEF, 0xA7,
+    0xF1, 0xB4, 0x23, 0x0F, 0xE5, 0xDB, 0x2C, 0x95, 0xA8, 0xA5, 0x69, 0x8E, 0xC6, 0x1B, 0xB9, 0x6B,
+    0xF0, 0x4C, 0xEE, 0xE5, 0x9D, 0xAE, 0x39, 0x2C, 0xF4, 0xBF, 0x2D, 0xFF, 0xFF, 0xC1, 0xB7, 0x7A,
+    0xFE, 0x01, 0xAD, 0x55, 0xBD, 0x6E, 0x14, 0x31, 0x10, 0x9E, 0x5B, 0x8B, 0x9C, 0x94, 0x95, 0x30,
+    0x0D, 0x4D, 0x28, 0xB6, 0x85, 0x08, 0x65, 0x5F, 0x00, 0xC5, 0x2B, 0x51, 0x52, 0x84, 0x82, 0x88,
+    0x92, 0x57, 0xE0, 0x0D, 0x76, 0xA5, 0x2B, 0x28, 0xC3, 0x1B, 0x90, 0x82, 0x02, 0x51, 0x51, 0xD2,
+    0xC0, 0x5A, 0x20, 0x41, 0x41, 0x91, 0x15, 0x20, 0x51, 0xB2, 0x52, 0xE8, 0x28, 0x58, 0xC2, 0x02,
+    0x0E, 0xE7, 0xF5, 0xF0, 0x8D, 0xEF, 0xF2, 0x43, 0x94, 0x40, 0x10, 0x38, 0xB1, 0xE5, 0xF1, 0x7A,
+    0x66, 0x3E, 0xCF, 0xCF, 0x77, 0x44, 0x18, 0x89, 0x23, 0x52, 0x7E, 0x36, 0x69, 0x93, 0xE2, 0xB8,
+    0xC0, 0x2D, 0x31, 0x7B, 0xC5, 0xDC, 0xEB, 0x40, 0xB7, 0xF3, 0x8E, 0xC8, 0x34, 0x44, 0xA5, 0xC5,
+    0xAC, 0x88, 0xEA, 0x82, 0xBD, 0xCC, 0x52, 0x66, 0x95, 0x78, 0x63, 0x31, 0xDB, 0xC4, 0x67, 0x2E,
+    0xF1, 0x29, 0xF4, 0x12, 0x4C, 0x2A, 0xF9, 0x03, 0xCD, 0x47, 0xDA, 0xD0, 0x18, 0x5E, 0x02, 0xD1,
+    0x52, 0x94, 0xF3, 0xE6, 0x81, 0xE1, 0xDA, 0x30, 0x6F, 0xF5, 0xF9, 0xD4, 0xA9, 0xE0, 0xA9, 0x66,
+    0xCA, 0xD9, 0xA6, 0xDC, 0x25, 0x61, 0x20, 0x2E, 0x6D, 0xB9, 0x15, 0xF8, 0x33, 0xAC, 0x64, 0x9E,
+    0xE1, 0xDA, 0x92, 0xFE, 0x52, 0x68, 0x07, 0xD9, 0xF0, 0xB0, 0xC0, 0xFD, 0xFF, 0x07, 0x39, 0xBA,
+    0x31, 0x0F, 0x04, 0x8C, 0xA8, 0x16, 0xFB, 0x2A, 0x1E, 0x27, 0x10, 0x71, 0xFA, 0x14, 0x96, 0x8B,
+    0x7D, 0xE0, 0xE5, 0xBF, 0x02, 0x67, 0x4B, 0x29, 0x57, 0xF4, 0x34, 0xAF, 0xC6, 0x4D, 0x2E, 0x76,
+    0xD3, 0x8E, 0x4C, 0x6D, 0xF1, 0x18, 0x52, 0xC0, 0xA4, 0x19, 0x22, 0xCF, 0xC5, 0xC3, 0x63, 0xFD,
+    0xE6, 0xD1, 0xAF, 0x87, 0xC4, 0x68, 0xB9, 0x96, 0xB7, 0x23, 0x8F, 0x65, 0x6E, 0x69, 0x75, 0xE4,
+    0x66, 0xEE, 0x34, 0xDE, 0xA3, 0x64, 0x8F, 0xF8, 0x93, 0xA9, 0xF6, 0x0E, 0x10, 0xA3, 0xC0, 0x03,
+    0x94, 0xD9, 0xEA, 0x21, 0xEB, 0x95, 0x4F, 0xF0, 0x00, 0x2A, 0x0B, 0x53, 0x65, 0x8D, 0x6E, 0xC7,
+    0xBD, 0x72, 0xA3, 0x01, 0x2A, 0xC7, 0x1C, 0x08, 0x5C, 0xAB, 0x65, 0xB9, 0xB5, 0xBB, 0x5E, 0xBE,
+    0x15, 0x68, 0x3E, 0x2E, 0x7A, 0xFF, 0x83, 0x66, 0x31, 0x7B, 0xB0, 0x7C, 0x5D, 0x2F, 0xED, 0xA1,
+    0xAF, 0x27, 0x2E, 0x6D, 0x44, 0xA8, 0x39, 0x00, 0x97, 0xA3, 0x5B, 0x5F, 0x8B, 0x08, 0x38, 0xE4,
+    0xBD, 0x9A, 0xB2, 0x83, 0xA9, 0xCE, 0xB4, 0xA6, 0x01, 0xCA, 0x89, 0xA7, 0xA0, 0x5B, 0xE5, 0x4C,
+    0xA5, 0x5B, 0xDC, 0x9D, 0xB8, 0x5F, 0xC4, 0x2A, 0xAD, 0x1E, 0xF1, 0xF4, 0xD5, 0xA7, 0x70, 0x79,
+    0xDC, 0xC8, 0x9B, 0xD9, 0x32, 0x27, 0x88, 0x3E, 0x4B, 0x91, 0x47, 0x47, 0xC7, 0x6F, 0xC7, 0xDC,
+    0xC4, 0xBB, 0x34, 0x6E, 0xAF, 0x94, 0xD3, 0xED, 0x8F, 0x7C, 0x36, 0x69, 0xA5, 0x0A, 0xEE, 0x4B,
+    0xC8, 0x00, 0x24, 0x48, 0x1C, 0x4F, 0xDC, 0x2E, 0x3F, 0xBC, 0xC7, 0xDF, 0x91, 0x12, 0xF8, 0xDB,
+    0xE2, 0x1D, 0x14, 0x65, 0x07, 0xBB, 0x1C, 0x9F, 0x76, 0x74, 0x53, 0x0E, 0x72, 0xA7, 0xDB, 0xD7,
+    0x80, 0x07, 0x81, 0x2D, 0x4F, 0x38, 0x76, 0x73, 0x8E, 0xAE, 0x55, 0x2B, 0x25, 0xBF, 0x66, 0xB7,
+    0xB0, 0x1B, 0x1F, 0xF4, 0x9C, 0x7D, 0xCE, 0x85, 0xB1, 0xB0, 0x77, 0xD2, 0x32, 0xE2, 0x3E, 0xDE,
+    0x3B, 0xA2, 0x0B, 0x57, 0xA6, 0x82, 0xD1, 0xDF, 0x2C, 0xA7, 0xC6, 0x9F, 0xB4, 0x68, 0x90, 0x9E,
+    0xCC, 0x75, 0xED, 0xE9, 0x09, 0xA5, 0xEF, 0x7C, 0x58, 0x82, 0xFD, 0x60, 0x36, 0xB6, 0xDD, 0xA1,
+    0x65, 0x25, 0xD3, 0x93, 0x6F, 0xF5, 0x0B, 0x89, 0xE4, 0x93, 0x68, 0x64, 0x04, 0x96, 0x51, 0x52,
+    0x32, 0x78, 0xC2, 0xF1, 0xF6, 0x65, 0x33, 0xE6, 0x37, 0x72, 0x67, 0x79, 0xED, 0x17, 0x63, 0x66,
+    0xA3, 0x45, 0x8A, 0x6A, 0x94, 0x7D, 0xFE, 0x8C, 0xFB, 0xB4, 0xD3, 0x5D, 0xE2, 0xA1, 0x54, 0x43,
+    0x2D, 0xB7, 0xC6, 0x9E, 0xE6, 0xA0, 0x1C, 0x40, 0x04, 0x33, 0x1B, 0xC8, 0xBE, 0x64, 0x3E, 0xB2,
+    0x13, 0x7A, 0x81, 0x0C, 0x5A, 0x44, 0x87, 0x03, 0xDA, 0xD2, 0x2F, 0x7D, 0xDA, 0x87, 0x64, 0x58,
+    0xA2, 0x4B, 0x31, 0x74, 0x0B, 0x9B, 0x01, 0xBA, 0x55, 0xAD, 0xDB, 0xFC, 0xB9, 0x4B, 0xBB, 0xDF,
+    0x0A, 0xE8, 0x46, 0x10, 0x86, 0x15, 0xFB, 0xB5, 0xA7, 0x7C, 0xA0, 0x74, 0x37, 0x32, 0x0D, 0x17,
+    0x0A, 0x0D, 0xF1, 0xAE, 0xCB, 0xE9, 0x71, 0x6C, 0x59, 0x92, 0xDE, 0xFD, 0xFB, 0xFF, 0x24, 0x08,
+    0x62, 0x34, 0x09, 0x37, 0x7B, 0x70, 0x41, 0x67, 0x7E, 0xBC, 0xE3, 0x56, 0x47, 0xC2, 0x33, 0x8B,
+    0x77, 0xFF, 0x5C, 0xB1, 0x7B, 0xDB, 0xBC, 0xC9, 0xD0, 0x53, 0x30, 0x55, 0x00, 0x8E, 0xFE, 0x82,
+    0x60, 0xAD, 0x75, 0xA9, 0x43, 0x9A, 0x2D, 0x2B, 0xC4, 0xCE, 0x34, 0x7A, 0x07, 0xC5, 0xF8, 0x5E,
+    0xE8, 0xB6, 0x02, 0x25, 0x21, 0x44, 0x48, 0xD2, 0x6B, 0x00, 0x90, 0xAF, 0x29, 0xDA, 0x5E, 0xF7,
+    0xC6, 0x66, 0x1D, 0x02, 0xBC, 0xED, 0x23, 0x07, 0x13, 0x9D, 0xB9, 0x3E, 0xE3, 0x1A, 0x3F, 0xE3,
+    0xD3, 0xC5, 0x99, 0x14, 0x66, 0x4C, 0x34, 0x6F, 0x73, 0x88, 0xCB, 0x13, 0xA7, 0xBC, 0x6E, 0x8D,
+    0x35, 0x13, 0x70, 0x8B, 0x69, 0xD4, 0x8F, 0x61, 0x4E, 0x69, 0xE2, 0xAC, 0x81, 0x6F, 0x70, 0x42,
+    0x69, 0x11, 0xD8, 0x0A, 0xEE, 0xAE, 0xBA, 0x39, 0xCF, 0x9D, 0x2F, 0x22, 0x29, 0x0B, 0x5B, 0x6B,
+    0xD8, 0xB9, 0x48, 0xB4, 0x5C, 0x2C, 0x6E, 0x0A, 0x20, 0x97, 0xF6, 0x50, 0x28, 0xCC, 0x1D, 0xB4,
+    0x0D, 0xCA, 0x79, 0x2A, 0x0C, 0x89, 0x0A, 0x95, 0xE6, 0x5F, 0xEB, 0x94, 0xCB, 0x3A, 0x24, 0xA8,
+    0x45, 0x89, 0x37, 0x41, 0x5A, 0x5F, 0xE2, 0x5F, 0x81, 0xD1, 0x84, 0xDE, 0x57, 0x67, 0x8C, 0xEF,
+    0x63, 0x7C, 0x4D, 0xCC, 0x9B, 0x3A, 0x8D, 0xC0, 0x68, 0x32, 0xEE, 0xE4, 0xC7, 0x84, 0xD4, 0x90,
+    0xF6, 0x99, 0x5D, 0x8D, 0x34, 0x7B, 0x9A, 0xBF, 0xBF, 0xCB, 0xBD, 0x74, 0x83, 0x8F, 0x7E, 0x88,
+    0xD6, 0x89, 0x06, 0x09, 0xAE, 0xA4, 0x1A, 0x89, 0xDE, 0x38, 0xD2, 0x23, 0xF3, 0x85, 0xCE, 0xAF,
+    0x6D, 0x77, 0xEE, 0x22, 0x9D, 0x34, 0x7E, 0x02, 0xB5, 0x55, 0x3D, 0x6F, 0xD5, 0x30, 0x14, 0xBD,
+    0x49, 0xA0, 0x19, 0x32, 0x98, 0x9D, 0x21, 0x2B, 0x62, 0x20, 0x3F, 0xC1, 0x41, 0x1D, 0x90, 0x98,
+    0x18, 0x60, 0xE6, 0x27, 0xF0, 0x0F, 0x70, 0x80, 0x91, 0xA1, 0x5D, 0x98, 0x61, 0x60, 0x40, 0x5D,
+    0xBA, 0xB2, 0xB4, 0x31, 0xBC, 0x81, 0xA1, 0xC3, 0x7B, 0xA8, 0x42, 0x1D, 0x18, 0xB0, 0xC4, 0x50,
+    0x24, 0x96, 0x88, 0x44, 0xAA, 0x01, 0xDB, 0x97, 0x63, 0xBF, 0x56, 0xB4, 0xA2, 0xA8, 0x52, 0xA1,
+    0xD6, 0x7B, 0xF1, 0x8D, 0x3F, 0xCE, 0x3D, 0xE7, 0xDE, 0x6B, 0xA7, 0xA7, 0x6D, 0x26, 0xCF, 0xE4,
+    0x38, 0x1B, 0x98, 0xE8, 0x8C, 0x1F, 0xBB, 0xE5, 0x4F, 0x3E, 0x1D, 0xED, 0x96, 0x5C, 0x9B, 0xD9,
+    0x41, 0x76, 0x85, 0xA5, 0xB3, 0x1E, 0xD4, 0x9F, 0x8A, 0x56, 0x0C, 0x5C, 0x5A, 0x2E, 0x27, 0xCE,
+    0xD6, 0x4F, 0xF7, 0x72, 0x1A, 0xD8, 0xF3, 0xD9, 0x0F, 0x2F, 0x37, 0x77, 0xED, 0xCB, 0x3F, 0xBD,
+    0x54, 0x43, 0xDA, 0x2F, 0x8E, 0x75, 0x57, 0x48, 0x70, 0x4B, 0xEC, 0xD0, 0x51, 0x01, 0xAB, 0x1F,
+    0xD0, 0x11, 0xD5, 0xC7, 0x96, 0xB0, 0x17, 0xCC, 0x0B, 0x74, 0x00, 0x09, 0x80, 0x11, 0xE6, 0xC8,
+    0xB0, 0xD8, 0xC1, 0x06, 0x73, 0xA6, 0xB1, 0xD9, 0x89, 0x29, 0x4A, 0xAD, 0x31, 0x40, 0xC2, 0x5F,
+    0x2C, 0x88, 0x2A, 0x9D, 0x86, 0x2A, 0x47, 0xE5, 0xC8, 0x3A, 0x73, 0x3C, 0x91, 0x92, 0x4C, 0xF5,
+    0x9C, 0x4D, 0x39, 0x1E, 0xB8, 0xCC, 0x05, 0xD5, 0x29, 0xB9, 0x36, 0xD5, 0x73, 0xC3, 0xE5, 0x68,
+    0x9B, 0xF7, 0x2E, 0x14, 0x4E, 0xC9, 0x4E, 0xAD, 0xCD, 0x8D, 0x38, 0x18, 0x6D, 0xC6, 0x2E, 0x50,
+    0xC3, 0x90, 0xC2, 0x73, 0x43, 0xFD, 0x68, 0x49, 0xB8, 0x84, 0x08, 0x07, 0xA5, 0x25, 0xF2, 0x70,
+    0x97, 0xDE, 0xAF, 0x97, 0xB6, 0x18, 0x79, 0x92, 0xCC, 0x33, 0xBE, 0xE5, 0xA5, 0x6E, 0x76, 0x5D,
+    0xE6, 0x65, 0x57, 0xEF, 0xDA, 0xBF, 0x74, 0xBD, 0x06, 0x13, 0x17, 0x99, 0xB4, 0xA0, 0x36, 0x80,
+    0x5A, 0xC0, 0x80, 0xD2, 0xF5, 0x7C, 0xDF, 0x82, 0x09, 0xDF, 0x74, 0x41, 0x0C, 0x4A, 0x3E, 0xF6,
+    0xA0, 0x26, 0xDF, 0x8D, 0xB6, 0xB4, 0x60, 0xC2, 0xA0, 0x56, 0x83, 0x49, 0xCE, 0x60, 0x22, 0x31,
+    0x50, 0x81, 0x1A, 0xF1, 0x52, 0xE4, 0xE5, 0x96, 0xA8, 0x44, 0xE8, 0xF2, 0x09, 0x2F, 0x91, 0xE5,
+    0xB5, 0x73, 0xD0, 0x4A, 0x48, 0x77, 0xA1, 0x4F, 0x27, 0x1C, 0x09, 0xB8, 0xC3, 0xB0, 0x6E, 0xE3,
+    0xBD, 0xDA, 0xC7, 0x18, 0x43, 0xB7, 0xB0, 0x17, 0x13, 0x57, 0x38, 0xC9, 0xBD, 0x47, 0x59, 0x74,
+    0x24, 0xCD, 0xB9, 0xE2, 0x2A, 0xE2, 0x36, 0x89, 0x50, 0x64, 0x11, 0xB0, 0x8C, 0x6F, 0xCD, 0xED,
+    0x47, 0xA1, 0x75, 0x52, 0xF1, 0xCD, 0x96, 0x39, 0x16, 0xDC, 0x2D, 0x78, 0x18, 0x90, 0x3E, 0xA9,
+    0xB1, 0x9A, 0x97, 0x85, 0x1A, 0x28, 0x95, 0x51, 0xAC, 0xA6, 0x54, 0x4B, 0x27, 0x87, 0xFA, 0xC5,
+    0x51, 0xB6, 0x3A, 0x08, 0x9E, 0x20, 0x98, 0x63, 0xB6, 0x86, 0x7A, 0xFE, 0x39, 0x40, 0x9F, 0x7A,
+    0xE3, 0x42, 0x15, 0xF5, 0x31, 0xF4, 0xD5, 0x3F, 0x47, 0x9B, 0x47, 0x7D, 0x12, 0xFA, 0xCA, 0xDF,
+    0xFA, 0x02, 0x42, 0x87, 0x6C, 0x35, 0xFA, 0x30, 0x4D, 0xE0, 0xF7, 0x15, 0x63, 0x32, 0x56, 0x7C,
+    0x58, 0x16, 0x51, 0x75, 0x52, 0x6C, 0x7D, 0x76, 0xB6, 0xEA, 0x05, 0xC5, 0xAE, 0x01, 0x3F, 0xE4,
+    0x22, 0x86, 0x6D, 0x41, 0xD7, 0x37, 0x3A, 0x98, 0x2E, 0x42, 0xEB, 0xC3, 0x23, 0x81, 0x89, 0x86,
+    0xB9, 0xAD, 0x70, 0x9E, 0x32, 0xEE, 0xD4, 0x80, 0xE0, 0xF2, 0x13, 0x6C, 0x70, 0x0A, 0x3B, 0x76,
+    0x2C, 0x15, 0xBE, 0x6F, 0xA9, 0xF9, 0x38, 0x51, 0x9E, 0x8C, 0x3D, 0x8C, 0x38, 0xA9, 0x49, 0xCE,
+    0x50, 0x62, 0xB6, 0x86, 0x1C, 0xEA, 0x71, 0x1A, 0x73, 0x46, 0xEE, 0x57, 0x78, 0x99, 0x7B, 0xCA,
+    0x37, 0x5E, 0x91, 0x62, 0x9D, 0x3C, 0xA1, 0xF5, 0xEB, 0x58, 0xA3, 0xE1, 0xA5, 0xF0, 0x95, 0x55,
+    0xAD, 0xDC, 0x19, 0x72, 0x5C, 0x60, 0xF5, 0xA7, 0x01, 0xB5, 0x1E, 0xA1, 0x73, 0x00, 0xAA, 0xB7,
+    0xBC, 0x39, 0x09, 0x54, 0x7A, 0x8D, 0x43, 0x1F, 0xDB, 0x15, 0xBA, 0x43, 0x55, 0xD7, 0x44, 0xAA,
+    0x0B, 0xCA, 0x23, 0xF2, 0xCA, 0x77, 0xBA, 0x40, 0xCE, 0x19, 0x5D, 0xA2, 0xD7, 0xB9, 0x29, 0xD9,
+    0x27, 0xFC, 0x07, 0xEB, 0xE7, 0xA7, 0x1E, 0x5B, 0xE1, 0x90, 0x3C, 0x85, 0x8C, 0x8A, 0x99, 0xA1,
+    0xDC, 0xBC, 0xBE, 0x48, 0xEA, 0xB1, 0xC9, 0xB9, 0x29, 0xBF, 0x39, 0x72, 0x0F, 0xE9, 0x46, 0xD5,
+    0xFE, 0x1B, 0x75, 0x00, 0x33, 0x07, 0xB8, 0x60, 0x1E, 0xFA, 0xF8, 0xAC, 0x6D, 0xE9, 0xEF, 0xAD,
+    0x7A, 0x8A, 0x3C, 0x74, 0xE1, 0x28, 0x9D, 0x0F, 0x52, 0x6D, 0xC1, 0x0C, 0xA2, 0x92, 0xC1, 0x14,
+    0xE6, 0x1E, 0xCC, 0x0F, 0x77, 0x55, 0x87, 0x05, 0xF8, 0xC5, 0xB5, 0x0B, 0xF4, 0x19, 0xB7, 0x30,
+    0xAB, 0x04, 0x26, 0xE3, 0x13, 0x85, 0x01, 0x93, 0x0E, 0x29, 0x5E, 0xB5, 0x08, 0xC7, 0x01, 0xFB,
+    0xE4, 0xCD, 0x8B, 0xA9, 0xF1, 0x85, 0xEB, 0x5B, 0x99, 0xB4, 0xF4, 0xCF, 0xEE, 0x83, 0x2C, 0xC6,
+    0x15, 0x2A, 0x89, 0xC1, 0x1D, 0xA5, 0x9C, 0x7B, 0x42, 0x04, 0x0B, 0x57, 0x72, 0x9B, 0x45, 0xD0,
+    0x0D, 0x0B, 0xF6, 0xCC, 0xA6, 0xE2, 0xAE, 0x0F, 0x74, 0xAC, 0xC5, 0x0F, 0x46, 0x58, 0xDE, 0xF4,
+    0x5B, 0xCB, 0x0B, 0x89, 0xBF, 0x80, 0x2A, 0x2E, 0x4A, 0x04, 0xC4, 0x95, 0x5E, 0x0C, 0x95, 0xC5,
+    0x31, 0x32, 0xE0, 0xB3, 0xEA, 0x0A, 0x17, 0xBF, 0x28, 0x10, 0x82, 0x59, 0x53, 0xB8, 0x46, 0x8B,
+    0x41, 0x6A, 0xA9, 0xFB, 0x8E, 0xF1, 0xCD, 0x73, 0x19, 0x8B, 0xA1, 0xF0, 0x49, 0x39, 0x9A, 0xD2,
+    0xF1, 0xE0, 0xB7, 0x79, 0x94, 0x90, 0xBF, 0x78, 0x28, 0x76, 0xAC, 0xEC, 0x0D, 0xFF, 0x58, 0x0D,
+    0xF1, 0xE3, 0x84, 0x43, 0x1C, 0x08, 0xF3, 0xB8, 0x29, 0x8E, 0x99, 0xFF, 0xB5, 0xFD, 0x02, 0xAD,
+    0x55, 0xBD, 0x8E, 0xDD, 0x44, 0x18, 0x3D, 0x1E, 0x2B, 0x58, 0x8A, 0x25, 0xA6, 0xA1, 0xA1, 0x72,
+    0x9F, 0x02, 0xBF, 0x40, 0x60, 0x2C, 0xED, 0x03, 0x90, 0x02, 0x94, 0x57, 0xA0, 0xCB, 0x0B, 0x44,
+    0x6B, 0x4B, 0x29, 0x29, 0xA0, 0xA3, 0x24, 0x05, 0x45, 0x12, 0x0A, 0x28, 0xB7, 0xD8, 0x30, 0x23,
+    0x28, 0x53, 0x60, 0x58, 0xA4, 0xB4, 0x17, 0x25, 0x52, 0x20, 0x14, 0xEB, 0x80, 0x25, 0x9C, 0x1B,
+    0x7B, 0x0E, 0x67, 0x7C, 0x15, 0xB4, 0x40, 0x12, 0x96, 0x5D, 0x46, 0xBE, 0x77, 0xE6, 0xF3, 0x7C,
+    0x73, 0xBE, 0x33, 0xDF, 0x9F, 0x7D, 0xEC, 0x72, 0x72, 0x63, 0xC9, 0xC1, 0x85, 0xB6, 0x27, 0xFC,
+    0x8D, 0x39, 0x8B, 0x76, 0x28, 0x46, 0x17, 0x5C, 0x20, 0x17, 0xED, 0xF6, 0x96, 0x11, 0xEE, 0xEB,
+    0x19, 0xCC, 0xE7, 0x7C, 0x2E, 0x27, 0x3B, 0x58, 0x29, 0x57, 0x03, 0xE1, 0x8E, 0x66, 0xB8, 0x00,
+    0x8D, 0x0B, 0x57, 0x00, 0xD7, 0x00, 0x33, 0x50, 0xF4, 0xC0, 0x9B, 0xC0, 0xA5, 0xE2, 0xC1, 0xAF,
+    0xD1, 0xF9, 0x07, 0xFC, 0xD9, 0x6D, 0x72, 0xA9, 0x75, 0xF9, 0xF4, 0xF7, 0x3F, 0x20, 0x7B, 0x2F,
+    0xAD, 0x06, 0xBC, 0x03, 0xD3, 0x25, 0x18, 0xEC, 0x9B, 0x11, 0xDE, 0x75, 0xF0, 0xDA, 0xE5, 0x8A,
+    0x5C, 0xF2, 0x27, 0x38, 0x11, 0x20, 0x65, 0xBE, 0x58, 0xEC, 0x50, 0x4E, 0x32, 0xBE, 0x21, 0xDA,
+    0x3D, 0xB1, 0x11, 0xF1, 0xDE, 0x71, 0xD1, 0xAE, 0x8C, 0xD4, 0x21, 0x11, 0x73, 0xC1, 0x77, 0x4C,
+    0x5C, 0x33, 0xDA, 0x21, 0x5F, 0x5C, 0x90, 0x75, 0x98, 0xA9, 0xFC, 0x7E, 0x8E, 0x46, 0x5A, 0x51,
+    0x98, 0xE6, 0xE6, 0xBE, 0xBD, 0x37, 0x39, 0xBF, 0xE1, 0x76, 0x2F, 0xC2, 0x0E, 0x22, 0x81, 0x08,
+    0x31, 0xB2, 0x9B, 0x93, 0xCB, 0x34, 0xD2, 0x66, 0xC0, 0x57, 0xC8, 0xC6, 0x24, 0x19, 0x3E, 0xAC,
+    0x18, 0x1D, 0xE7, 0xB6, 0xFB, 0xC0, 0x03, 0x7A, 0xDA, 0x1E, 0x6E, 0x81, 0x65, 0x67, 0x38, 0xA2,
+    0x9D, 0x51, 0x08, 0x5F, 0x0F, 0x47, 0x13, 0xC9, 0x99, 0x1C, 0xAF, 0x71, 0x77, 0x33, 0xA9, 0x86,
+    0x74, 0xF1, 0xC6, 0x0C, 0x49, 0xB8, 0xF6, 0xD0, 0x72, 0xF6, 0xFC, 0x6D, 0xCE, 0xDE, 0x1D, 0x51,
+    0x2F, 0xBA, 0x62, 0x53, 0xB3, 0x2B, 0xD8, 0x64, 0x4B, 0x93, 0xFF, 0xBE, 0xF5, 0xDF, 0x32, 0x56,
+    0xEC, 0x77, 0x07, 0x33, 0x36, 0x39, 0x83, 0xBD, 0x3F, 0xBC, 0x85, 0xE9, 0x9C, 0x24, 0xEC, 0xA4,
+    0xB7, 0xF6, 0x68, 0x3C, 0x5C, 0x59, 0xFC, 0x17, 0x12, 0x67, 0xB4, 0x7A, 0xB0, 0xBE, 0xAB, 0x1B,
+    0x54, 0xBA, 0x03, 0xF2, 0x05, 0xAF, 0xC5, 0x86, 0xBC, 0x47, 0xBA, 0xF0, 0x06, 0x1B, 0xC3, 0x3E,
+    0x97, 0x3E, 0x27, 0xB4, 0x23, 0xAA, 0x1F, 0xE0, 0xDA, 0xCF, 0x75, 0xF0, 0x47, 0x05, 0xB4, 0x5A,
+    0x4D, 0xB8, 0x94, 0x51, 0x7E, 0x63, 0x52, 0xD0, 0x04, 0xB2, 0xD8, 0x47, 0x63, 0x2E, 0x42, 0xEB,
+    0x6D, 0xCE, 0xE1, 0x86, 0xBF, 0x66, 0xC3, 0xE9, 0xDD, 0xD0, 0x92, 0xCF, 0x94, 0x87, 0x9E, 0x7C,
+    0x72, 0x75, 0x79, 0x1F, 0x75, 0x80, 0x51, 0x6E, 0x9D, 0x7E, 0xB2, 0x58, 0x27, 0x25, 0x7C, 0xBA,
+    0x99, 0xDF, 0xA0, 0x54, 0x3C, 0x6F, 0xA2, 0x0C, 0x12, 0x4D, 0xBC, 0xE5, 0xF8, 0x84, 0x0C, 0x3E,
+    0xE9, 0x94, 0x43, 0x3A, 0xF3, 0xE7, 0xB2, 0x97, 0x69, 0x50, 0x15, 0x38, 0xE0, 0xBA, 0xD8, 0x23,
+    0x9B, 0x05, 0x62, 0xD8, 0xA5, 0xF3, 0xBB, 0xAA, 0x31, 0x73, 0x54, 0xA9, 0x74, 0x70, 0x6B, 0x76,
+    0x9D, 0x97, 0x28, 0x0A, 0xC1, 0x54, 0xDD, 0x45, 0x1C, 0xE2, 0x30, 0xDF, 0x24, 0xBE, 0xF5, 0xE3,
+    0xD4, 0x28, 0x50, 0x71, 0x25, 0x94, 0xF4, 0x92, 0xC7, 0x93, 0xEE, 0x49, 0x71, 0xD1, 0x49, 0x71,
+    0xB4, 0x2A, 0x5D, 0x4B, 0xBC, 0x92, 0xC9, 0xD5, 0xE5, 0x4A, 0x29, 0x40, 0xCF, 0x21, 0x4D, 0x2F,
+    0x65, 0xF2, 0x42, 0xEF, 0xD4, 0xDB, 0x8E, 0xDC, 0xE3, 0xF2, 0x4F, 0xEF, 0xA8, 0x58, 0xA6, 0xD7,
+    0x51, 0xC7, 0x09, 0x5B, 0x86, 0xBC, 0x3B, 0x58, 0xA3, 0x3D, 0xC3, 0x1E, 0xAB, 0x8C, 0x45, 0x4A,
+    0x96, 0x72, 0x29, 0x5A, 0xBE, 0x52, 0xFC, 0x45, 0xD9, 0xF3, 0xE9, 0x58, 0xCC, 0x4E, 0x5D, 0x25,
+    0xB5, 0x9E, 0xE7, 0x35, 0x70, 0x50, 0xC2, 0xC5, 0xA1, 0x3C, 0x8E, 0xF8, 0xB2, 0x6A, 0x12, 0xF0,
+    0x67, 0xB8, 0xDD, 0x76, 0xD5, 0xFD, 0x29, 0x5B, 0x5E, 0x38, 0xB9, 0xAE, 0x3E, 0x52, 0xCB, 0x12,
+    0xCC, 0x77, 0x8C, 0x4B, 0xC1, 0x0F, 0x13, 0x4C, 0x76, 0xE7, 0xB6, 0x02, 0x35, 0xA1, 0xDE, 0x81,
+    0x7A, 0xE4, 0xCF, 0xFE, 0x95, 0xD0, 0x09, 0x71, 0xAB, 0xD2, 0x78, 0xB4, 0xA8, 0xB5, 0x91, 0x93,
+    0x7E, 0xCA, 0xD2, 0x71, 0x97, 0xD2, 0x77, 0x6E, 0x49, 0xA7, 0x4F, 0xEA, 0x1A, 0x97, 0x9A, 0x8B,
+    0x9F, 0xBC, 0x8C, 0x95, 0xA6, 0xA3, 0xC9, 0xA8, 0x2F, 0xB6, 0x47, 0xEA, 0xEF, 0x15, 0x8F, 0xFB,
+    0x76, 0xBA, 0xBB, 0xB6, 0x99, 0x26, 0x53, 0x86, 0xBE, 0x2D, 0x66, 0xC9, 0x9C, 0xE2, 0xBF, 0x76,
+    0x40, 0x39, 0xD8, 0xF9, 0xD3, 0x7A, 0x2E, 0x89, 0x5F, 0xF4, 0x59, 0x6C, 0x7B, 0x7D, 0x1E, 0xC4,
+    0x8E, 0xA9, 0xB2, 0xD9, 0xAC, 0xE8, 0xB8, 0x80, 0xEB, 0xD9, 0x90, 0xAF, 0xFE, 0x0C, 0xA8, 0x3F,
+    0x3E, 0x33, 0x4F, 0xD4, 0x9D, 0x8A, 0x5F, 0x19, 0xA6, 0x72, 0xBA, 0x7C, 0x59, 0x2E, 0x54, 0xD8,
+    0xF7, 0x77, 0x1B, 0x01, 0xF1, 0xD4, 0x3C, 0x25, 0x46, 0xDF, 0x14, 0x4F, 0xD9, 0xB4, 0xDF, 0x90,
+    0x31, 0x7D, 0x06, 0x33, 0x35, 0x9E, 0xE7, 0x16, 0x4A, 0x79, 0x60, 0x18, 0x56, 0x23, 0x32, 0x60,
+    0xD6, 0x42, 0x3B, 0x53, 0xC0, 0xD3, 0xC8, 0x9F, 0xAA, 0xAB, 0x7C, 0xD4, 0x9B, 0xF1, 0x2E, 0xEC,
+    0x5E, 0xF8, 0x3F, 0xDD, 0x7A, 0xCE, 0xF1, 0x07, 0xAD, 0x55, 0x3F, 0x6C, 0xDE, 0x44, 0x14, 0xFF,
+    0xD9, 0x4E, 0x62, 0x35, 0x16, 0xB9, 0x08, 0x25, 0x0B, 0xA2, 0xF5, 0x0A, 0x85, 0xD4, 0x0B, 0x43,
+    0x87, 0xE6, 0x3B, 0x57, 0x1D, 0x18, 0xBA, 0x7C, 0xA8, 0xFD, 0xC4, 0x50, 0x21, 0x31, 0x67, 0x81,
+    0xA1, 0x43, 0x85, 0x92, 0x9C, 0xAB, 0x0C, 0x91, 0x58, 0x9A, 0x8D, 0x81, 0x21, 0x19, 0xD1, 0x37,
+    0x65, 0xC8, 0x80, 0x50, 0x53, 0x3B, 0x64, 0xE8, 0x50, 0x09, 0xB9, 0xCD, 0x90, 0xA1, 0x8B, 0x4B,
+    0x29, 0x95, 0xBA, 0xE4, 0x4A, 0x0F, 0xEA, 0xB4, 0x67, 0x3F, 0xDE, 0x39, 0x09, 0x8A, 0x00, 0x15,
+    0x15, 0xF5, 0x6C, 0x9F, 0xEF, 0xEF, 0x7B, 0xBF, 0xF7, 0xDE, 0xEF, 0xDE, 0x01, 0x40, 0x72, 0x47,
+    0x07, 0xBF, 0x5B, 0x58, 0x89, 0x53, 0x61, 0xC6, 0x7D, 0x9C, 0x4E, 0xC7, 0xBF, 0xA9, 0xBD, 0x46,
+    0x65, 0xF1, 0xEE, 0xBF, 0xFD, 0x76, 0x6A, 0xBF, 0x91, 0x85, 0xDA, 0x21, 0x6A, 0x62, 0xDA, 0x2B,
+    0x55, 0xBD, 0xE9, 0x36, 0xE5, 0x08, 0x5E, 0x5A, 0x08, 0xD2, 0x90, 0x54, 0x80, 0x08, 0x01, 0xBD,
+    0xB2, 0xFB, 0xA2, 0x41, 0xFC, 0xB8, 0xF1, 0x48, 0x10, 0xD5, 0xFC, 0x15, 0x21, 0xD5, 0x40, 0x54,
+    0x00, 0xB3, 0x80, 0xA7, 0x81, 0xF0, 0x17, 0x40, 0xF0, 0x50, 0x5C, 0xFE, 0x0F, 0x38, 0x02, 0x08,
+    0x4A, 0x60, 0x9E, 0x25, 0xB2, 0x18, 0x59, 0xC2, 0xFB, 0x1E, 0x87, 0x25, 0x6C, 0x5C, 0x1D, 0x30,
+    0x0A, 0xAE, 0xD9, 0x6C, 0xC0, 0xAF, 0x44, 0x76, 0x38, 0x29, 0x2A, 0xB6, 0x23, 0xFA, 0xCD, 0x42,
+    0x16, 0x81, 0x55, 0x69, 0x6C, 0xD0, 0x8A, 0x2A, 0x6A, 0xA1, 0x2E, 0xD4, 0xBC, 0x23, 0x29, 0x72,
+    0xB4, 0x46, 0xE8, 0xB8, 0x58, 0xBC, 0x15, 0xD4, 0x81, 0x49, 0x56, 0xB7, 0x1A, 0x5E, 0xB0, 0xA3,
+    0x73, 0x24, 0xDB, 0xBA, 0x49, 0x8A, 0xF0, 0xA9, 0x4D, 0x6E, 0x54, 0x68, 0x6E, 0x85, 0xCF, 0x0C,
+    0x64, 0x9E, 0x36, 0x16, 0xD1, 0x5E, 0x21, 0x73, 0x78, 0xA4, 0x23, 0xCA, 0x20, 0x8D, 0x47, 0x25,
+    0x04, 0x8B, 0xD7, 0xF0, 0xC9, 0x35, 0x0E, 0x4B, 0xE4, 0x5A, 0xBC, 0x88, 0x6B, 0x95, 0x30, 0x32,
+    0x91, 0x2D, 0x1E, 0xCE, 0xCC, 0x61, 0x2E, 0x7B, 0x67, 0xD9, 0x44, 0x36, 0xB0, 0x32, 0xA3, 0x52,
+    0x2E, 0x59, 0xD1, 0x86, 0x3A, 0xD9, 0x7A, 0xAE, 0x73, 0xAF, 0x49, 0x12, 0x51, 0x89, 0x87, 0x4F,
+    0x4D, 0x83, 0xBC, 0x17, 0xAF, 0x16, 0xE1, 0xF3, 0xF2, 0x05, 0xCB, 0xBE, 0x29, 0xF6, 0x32, 0x46,
+    0x9B, 0x6B, 0x24, 0x75, 0x48, 0x2C, 0x36, 0x95, 0x15, 0x84, 0x0E, 0x9A, 0x03, 0x89, 0x09, 0x6B,
+    0x51, 0x16, 0x9E, 0x55, 0x08, 0xAA, 0xB8, 0xB3, 0x3C, 0x4F, 0xFD, 0x46, 0xB1, 0xC5, 0x49, 0x19,
+    0xB1, 0x79, 0x42, 0x47, 0x26, 0x29, 0x59, 0x5F, 0xE1, 0x37, 0x39, 0x40, 0x2D, 0x2F, 0x60, 0x7C,
+    0xD2, 0x05, 0x83, 0xF7, 0x8A, 0x57, 0x7C, 0xAE, 0xB0, 0x9D, 0x82, 0x52, 0x34, 0x92, 0xA3, 0x99,
+    0xB8, 0x81, 0xF1, 0x35, 0xCC, 0x75, 0xF2, 0xB2, 0xB8, 0xCC, 0xC1, 0xB0, 0xD9, 0x77, 0x75, 0x5C,
+    0x46, 0xEC, 0x36, 0xB1, 0x53, 0x23, 0x59, 0x2D, 0xA0, 0x9C, 0x1E, 0xC3, 0x3E, 0x29, 0x10, 0xB0,
+    0xBA, 0xC8, 0xB0, 0xBA, 0x02, 0x5E, 0xDB, 0x69, 0x14, 0xCE, 0x73, 0xAC, 0x9C, 0x85, 0x02, 0x1B,
+    0x67, 0xE0, 0x33, 0x53, 0xBD, 0x5A, 0x02, 0xFD, 0x11, 0xBC, 0x71, 0xF4, 0xCC, 0x15, 0xD6, 0xEE,
+    0xF1, 0x8E, 0xDE, 0x41, 0x9F, 0xE8, 0x21, 0x51, 0xCB, 0xBF, 0x07, 0x83, 0x4F, 0xAD, 0x53, 0x86,
+    0xB8, 0x42, 0xC0, 0x2D, 0xC2, 0xB1, 0x56, 0x52, 0x22, 0xAC, 0xFF, 0x6A, 0x11, 0x91, 0x22, 0x7A,
+    0xCE, 0xBF, 0x8E, 0x71, 0xD6, 0xF1, 0x4A, 0xA6, 0xB8, 0xD9, 0x1D, 0xAE, 0xE1, 0x77, 0x92, 0x1A,
+    0x7E, 0xBB, 0x71, 0xED, 0xD6, 0xAB, 0x8C, 0x37, 0xB2, 0x20, 0x56, 0xCC, 0x12, 0x79, 0x4A, 0x51,
+    0xAB, 0x1C, 0x70, 0x2E, 0xB6, 0x93, 0xE8, 0x73, 0xEC, 0xC6, 0xD2, 0x37, 0x84, 0x67, 0xB1, 0x1B,
+    0xE7, 0xF7, 0xFD, 0xD7, 0xC7, 0xB3, 0xE8, 0x1B, 0xDF, 0xB6, 0xE8, 0xC8, 0xAC, 0xDF, 0x0C, 0x9E,
+    0x24, 0xDB, 0x8C, 0x9E, 0xD5, 0x3E, 0x55, 0x8E, 0x39, 0xAF, 0x89, 0x47, 0xD9, 0x98, 0xB6, 0xC9,
+    0xF0, 0x69, 0xAD, 0x21, 0xB3, 0xFF, 0xAC, 0x5C, 0x78, 0x23, 0xED, 0x5B, 0xE7, 0x02, 0xE4, 0x99,
+    0x4A, 0x55, 0xDA, 0x3B, 0x4A, 0x0A, 0xCA, 0x06, 0x4F, 0x6D, 0x0F, 0x75, 0x54, 0x5E, 0xA5, 0x97,
+    0xBB, 0x7B, 0x74, 0x72, 0xAC, 0x3A, 0x3D, 0x5C, 0x22, 0x2B, 0xBB, 0x4C, 0x21, 0x5D, 0xC3, 0x32,
+    0xB6, 0x49, 0x7C, 0xA2, 0xC3, 0x6D, 0x6A, 0x43, 0xD2, 0xFE, 0x3E, 0xE7, 0x8E, 0x5A, 0x6E, 0xDB,
+    0x71, 0xCC, 0x84, 0xCB, 0xBA, 0x51, 0x62, 0x2B, 0x9D, 0x9A, 0x3B, 0x4F, 0xD7, 0x15, 0x6C, 0x5C,
+    0xCE, 0xBB, 0x63, 0x5D, 0xD2, 0xCE, 0xD2, 0x4F, 0x42, 0x9A, 0xC4, 0xC5, 0x4E, 0xDE, 0xF8, 0xB9,
+    0x6E, 0xE3, 0xE5, 0x6A, 0x63, 0xB6, 0x3B, 0x86, 0xA9, 0x15, 0x8F, 0x4D, 0xC0, 0xF9, 0x80, 0xB2,
+    0xA9, 0x05, 0x2E, 0x98, 0x9A, 0x9A, 0x9F, 0x3D, 0x78, 0x0E, 0x98, 0x77, 0xA3, 0x14, 0xB7, 0x75,
+    0xF0, 0xA0, 0x86, 0x9E, 0x07, 0x7B, 0x35, 0x7D, 0xDB, 0x7C, 0xFC, 0xF5, 0x4C, 0xEF, 0xCA, 0x16,
+    0x99, 0x31, 0x36, 0x65, 0x12, 0xB9, 0x96, 0x74, 0xFB, 0xD1, 0xE2, 0x86, 0x57, 0x85, 0xA5, 0x15,
+    0x3F, 0xD6, 0x72, 0xD9, 0x4C, 0x43, 0xDC, 0xB5, 0xC9, 0xB6, 0x91, 0x41, 0x35, 0x05, 0x15, 0x18,
+    0x79, 0xDD, 0x8A, 0x62, 0xD3, 0x4B, 0x8F, 0x8D, 0x32, 0xAA, 0x1A, 0x2A, 0x0D, 0xD9, 0xB3, 0x2E,
+    0x03, 0x5A, 0xA1, 0x93, 0x6C, 0x01, 0x48, 0xDF, 0xFD, 0x60, 0xDB, 0x7A, 0xC5, 0xC8, 0x64, 0x90,
+    0xF6, 0x96, 0xEC, 0x47, 0x1E, 0xF2, 0xFD, 0x61, 0x15, 0x64, 0x13, 0x38, 0x8B, 0xCA, 0x9D, 0x56,
+    0x12, 0x46, 0xA5, 0x29, 0x4E, 0xF4, 0xAE, 0x6D, 0xCC, 0x9E, 0x1C, 0x87, 0x8E, 0x2F, 0xBA, 0x83,
+    0xF5, 0xEB, 0xBE, 0x40, 0x47, 0x03, 0xFD, 0xC5, 0xB7, 0xAD, 0xC0, 0xDA, 0xB4, 0x1B, 0xF5, 0xFA,
+    0x32, 0xD0, 0x32, 0xF8, 0x83, 0xF2, 0x5D, 0x73, 0x59, 0x14, 0xD6, 0xBD, 0xFB, 0xEA, 0x41, 0x33,
+    0x12, 0xDF, 0xAF, 0x9B, 0x91, 0x63, 0xBE, 0x3A, 0xE6, 0x9E, 0xD1, 0xF3, 0x36, 0xB9, 0xA0, 0xDF,
+    0xC3, 0x29, 0xBF, 0x0E, 0x2B, 0x49, 0xF7, 0x8D, 0x07, 0x33, 0x1B, 0x16, 0x8B, 0x97, 0xDA, 0x68,
+    0xE5, 0xC0, 0x3B, 0x8A, 0x76, 0x9F, 0x6C, 0x7E, 0x89, 0x5D, 0xBC, 0x35, 0x89, 0xB4, 0xDF, 0xBF,
+    0x22, 0x26, 0x38, 0x32, 0xFD, 0x3E, 0x87, 0xC0, 0x44, 0xF7, 0xF6, 0x1B, 0x76, 0x64, 0xD0, 0x1E,
+    0x86, 0x52, 0x5A, 0x4E, 0xEC, 0x67, 0x50, 0x4F, 0xE2, 0x62, 0x76, 0x46, 0xD1, 0x3D, 0xAA, 0xC7,
+    0xF6, 0xFF, 0xE6, 0xB0, 0xEA, 0x5C, 0xDC, 0x5A, 0x99, 0x9B, 0x73, 0xD1, 0xCA, 0x51, 0x94, 0x73,
+    0x6A, 0x99, 0x90, 0x83, 0xC1, 0x25, 0x47, 0xE5, 0x81, 0x4B, 0x64, 0xF4, 0x62, 0x38, 0x5C, 0x89,
+    0xB2, 0x75, 0x7A, 0x79, 0x67, 0xAF, 0xFD, 0x30, 0x2C, 0x8F, 0xF3, 0xE0, 0x28, 0x39, 0xB8, 0x3E,
+    0x57, 0xD3, 0x83, 0xC1, 0xE0, 0xB2, 0x1B, 0xBA, 0xC6, 0x89, 0x2B, 0x31, 0x71, 0xCD, 0x74, 0x9D,
+    0x39, 0xC8, 0x28, 0x4C, 0x04, 0x0E, 0x17, 0x27, 0x7C, 0xED, 0xEE, 0xA4, 0xB0, 0x40, 0xC4, 0x09,
+    0x32, 0x75, 0xDE, 0x9F, 0xED, 0x26, 0xF9, 0x66, 0x32, 0xEE, 0xC6, 0x0B, 0xAA, 0x6E, 0xB2, 0x70,
+    0x93, 0x71, 0x97, 0x7E, 0x38, 0x58, 0x9F, 0xDF, 0x9C, 0x39, 0x39, 0x7F, 0xB5, 0x33, 0x9B, 0x2B,
+    0x6A, 0xA6, 0x07, 0xE9, 0xF4, 0xE0, 0x22, 0xB5, 0x6B, 0x18, 0x62, 0xFC, 0x87, 0xE1, 0x93, 0xE1,
+    0x70, 0x74, 0x94, 0x6F, 0xD6, 0x75, 0xFD, 0x68, 0x74, 0x14, 0xE1, 0x67, 0xC9, 0x75, 0xF3, 0xD5,
+    0xDD, 0x91, 0x13, 0x0B, 0xEB, 0x67, 0x67, 0x26, 0xE6, 0xFB, 0xFF, 0xB0, 0xC5, 0x65, 0x55, 0xE1,
+    0xF8, 0xBF, 0x70, 0x74, 0xF1, 0xFC, 0x09, 0x8D, 0x55, 0x4F, 0x6C, 0x14, 0x55, 0x18, 0xFF, 0x66,
+    0xA6, 0xBB, 0x23, 0x1D, 0xE1, 0x99, 0xB8, 0x24, 0xFC, 0x09, 0x4C, 0x8F, 0x84, 0xD4, 0xCE, 0xA5,
+    0x87, 0x9A, 0x94, 0x9D, 0x31, 0x1E, 0x38, 0x70, 0xA0, 0x09, 0xDD, 0x98, 0x88, 0x89, 0x1C, 0xBC,
+    0x88, 0x1A, 0x88, 0x81, 0xA4, 0x26, 0x2D, 0x33, 0xA8, 0x09, 0x27, 0x4D, 0x0F, 0xC6, 0x73, 0x0F,
+    0x8D, 0xD1, 0xBD, 0x74, 0x83, 0x18, 0x3D, 0x48, 0x67, 0x2A, 0x07, 0x0F, 0x8D, 0x61, 0x2A, 0x11,
+    0xAE, 0x0B, 0x14, 0x4D, 0x38, 0xC0, 0x58, 0xA7, 0x32, 0xED, 0xCE, 0xCC, 0xE7, 0xEF, 0x9B, 0xA5,
+    0xA9, 0x9A, 0x90, 0xF2, 0x66, 0xDE, 0xDB, 0x79, 0xDF, 0xFB, 0xFE, 0x7F, 0xBF, 0xEF, 0x2D, 0x91,
+    0x51, 0xA8, 0xC4, 0x89, 0x2E, 0x91, 0x1D, 0x74, 0xB8, 0xB7, 0xFC, 0xB8, 0x18, 0x37, 0xE3, 0xBD,
+    0xF6, 0x4A, 0x76, 0x6C, 0x0F, 0x11, 0xD5, 0x26, 0xB4, 0xBB, 0xE5, 0x11, 0xD7, 0x5E, 0xBE, 0xBF,
+    0x96, 0x2E, 0x0E, 0x34, 0x35, 0xEF, 0x6B, 0x57, 0xDD, 0x2A, 0x7C, 0x0F, 0x47, 0x3E, 0x17, 0x1F,
+    0xB5, 0x3E, 0x38, 0x4F, 0xBB, 0xF1, 0x62, 0xDB, 0x6A, 0x9D, 0x62, 0xBE, 0xDB, 0x6A, 0xE1, 0x93,
+    0x79, 0xB3, 0xDD, 0x9E, 0x6D, 0x34, 0xA6, 0x8F, 0xF5, 0x1F, 0xA2, 0xA3, 0x57, 0x0A, 0x2D, 0x3E,
+    0xA4, 0xC5, 0x38, 0x7C, 0xF9, 0x53, 0x67, 0xFD, 0xCE, 0x42, 0xFE, 0xE1, 0x23, 0x6A, 0x10, 0xCD,
+    0x91, 0xED, 0x69, 0x29, 0xB5, 0x76, 0xB9, 0xBF, 0xDF, 0xE1, 0xBC, 0xE3, 0x78, 0x8A, 0xF4, 0x0C,
+    0x34, 0xB1, 0xEC, 0x7D, 0xCC, 0xD3, 0xAF, 0x86, 0x97, 0xC9, 0xB3, 0x57, 0x6E, 0x71, 0x3E, 0x3A,
+    0x02, 0x1A, 0x0D, 0x05, 0xF6, 0xC2, 0xEB, 0x9C, 0x0F, 0x0E, 0xCA, 0x86, 0x12, 0x37, 0x4A, 0x14,
+    0x25, 0x6C, 0xE4, 0xAA, 0x9C, 0x3D, 0xE0, 0xBD, 0x27, 0xEA, 0x67, 0xE8, 0xCD, 0x09, 0x93, 0xF6,
+    0xD6, 0x3C, 0xAA, 0xD3, 0x2E, 0xD2, 0x3C, 0x6A, 0xEC, 0x6E, 0x90, 0x76, 0xFC, 0x57, 0xA2, 0x17,
+    0x66, 0x86, 0x88, 0xAE, 0x80, 0x67, 0xE0, 0xFC, 0x11, 0xD2, 0x02, 0x9A, 0xC0, 0x53, 0xF3, 0xF6,
+    0x52, 0xBC, 0xEB, 0x2B, 0x48, 0x11, 0x99, 0x0F, 0xB4, 0xC9, 0x5A, 0x08, 0x9D, 0x3C, 0xA4, 0x82,
+    0x69, 0x7F, 0x0C, 0xA4, 0xC3, 0xCD, 0xA9, 0xF1, 0x91, 0x1A, 0xF8, 0xC2, 0xAE, 0xC3, 0x9F, 0x44,
+    0xE3, 0x17, 0xD7, 0x63, 0x27, 0xA0, 0x0E, 0x91, 0xF1, 0x96, 0xB3, 0x94, 0x36, 0xA3, 0x01, 0x6D,
+    0xF9, 0x7E, 0xBC, 0xA8, 0x45, 0xA3, 0x56, 0x3C, 0xBD, 0x38, 0x4A, 0x73, 0x75, 0xB3, 0x9B, 0xA9,
+    0xCF, 0x7F, 0xBE, 0xF7, 0xCB, 0xDC, 0xE8, 0x1C, 0x4D, 0x35, 0xD5, 0xC8, 0xF4, 0x10, 0xA9, 0xE5,
+    0xBF, 0x8B, 0xFD, 0xE2, 0xAC, 0x7F, 0x7B, 0xC3, 0xB9, 0x3C, 0x09, 0x59, 0x04, 0x9A, 0x3C, 0x1A,
+    0xB4, 0xBE, 0x5B, 0xBF, 0xB7, 0x9E, 0x35, 0x0C, 0xCF, 0x5D, 0x7A, 0x5F, 0x0F, 0xE8, 0x47, 0xB0,
+    0x34, 0xDD, 0x80, 0x74, 0xC4, 0xF2, 0x65, 0x98, 0xE8, 0xCC, 0x1C, 0xD0, 0x41, 0x5E, 0x7D, 0xF6,
+    0x81, 0xCF, 0x5C, 0x9C, 0x6D, 0xB7, 0xBF, 0xD9, 0xFA, 0xB5, 0xF8, 0x0B, 0xB2, 0x5D, 0xE4, 0xBE,
+    0x5C, 0x3C, 0xCB, 0xB0, 0x41, 0xB5, 0x85, 0x59, 0xAA, 0xF3, 0x3C, 0x69, 0x10, 0xF1, 0x14, 0xB7,
+    0x39, 0x71, 0x67, 0xC9, 0xCC, 0xAF, 0x43, 0xE1, 0x25, 0xFA, 0xCF, 0x78, 0xB1, 0xDE, 0x6E, 0xB7,
+    0x17, 0x56, 0xC0, 0xC7, 0xB9, 0xEC, 0xA7, 0x64, 0x19, 0x20, 0xD2, 0x0B, 0x5A, 0xE3, 0x6B, 0xBD,
+    0x85, 0xFD, 0x2F, 0x11, 0x85, 0xC7, 0x4F, 0x38, 0xF9, 0x05, 0xDA, 0x0C, 0xDE, 0x25, 0x7D, 0x69,
+    0xF8, 0xEA, 0xF2, 0xF0, 0x19, 0xD0, 0xCC, 0x93, 0xC3, 0xC3, 0x9D, 0x4E, 0x2F, 0x98, 0xA7, 0xCE,
+    0xD5, 0x9F, 0x96, 0xAD, 0xE1, 0xF1, 0x4B, 0xC9, 0x3B, 0x01, 0x51, 0x79, 0xCC, 0x08, 0xC6, 0xF4,
+    0x87, 0x75, 0x7C, 0x5A, 0xF4, 0x2D, 0x5F, 0x63, 0xAB, 0xF3, 0xFD, 0xE3, 0xFD, 0x43, 0xA4, 0x47,
+    0x16, 0x8D, 0x64, 0x3F, 0xAC, 0x09, 0xEB, 0xF0, 0x19, 0x28, 0x30, 0x17, 0xAF, 0x4F, 0x65, 0x4F,
+    0x4E, 0xA8, 0x0B, 0x1D, 0x2C, 0x43, 0x67, 0x26, 0xE8, 0xD0, 0x1F, 0x2B, 0xF1, 0x85, 0x43, 0x3A,
+    0xD1, 0xA0, 0x95, 0x76, 0xC7, 0xF6, 0x18, 0xAB, 0x47, 0x3A, 0x17, 0x6F, 0xDD, 0xF8, 0xCC, 0xEC,
+    0xA8, 0x60, 0x1F, 0xBD, 0x32, 0xAE, 0x3A, 0x46, 0xD7, 0x4A, 0x0E, 0x8F, 0x35, 0xF6, 0x09, 0x00,
+    0x03, 0x02, 0x10, 0x7D, 0xA4, 0x07, 0x1B, 0x8B, 0x39, 0xE4, 0x92, 0xB9, 0x57, 0xB4, 0x4E, 0x26,
+    0xE4, 0x46, 0xC4, 0x48, 0x34, 0xDF, 0x64, 0x76, 0x39, 0xE7, 0xD6, 0xA9, 0x9C, 0xD4, 0x36, 0xF5,
+    0x71, 0xC5, 0x7B, 0x40, 0x0F, 0x4A, 0xE7, 0x46, 0x16, 0xD6, 0x83, 0x39, 0x44, 0xBA, 0x45, 0xFD,
+    0x37, 0x2F, 0xFF, 0xD5, 0xD7, 0xF0, 0xDB, 0x24, 0xC4, 0xB6, 0xA9, 0xBD, 0x8A, 0x37, 0x40, 0xDE,
+    0xBB, 0x52, 0x8D, 0x08, 0xA6, 0x99, 0x6A, 0xE7, 0x1E, 0xA0, 0xB6, 0xD2, 0x18, 0x5A, 0x21, 0x60,
+    0x4A, 0xB1, 0xD8, 0x5C, 0x4A, 0x9B, 0xB0, 0x27, 0x15, 0x20, 0x33, 0x33, 0x4A, 0xB2, 0x63, 0x28,
+    0xF2, 0x3D, 0x95, 0x80, 0xCB, 0x8D, 0xCC, 0x54, 0x63, 0xB2, 0x57, 0x38, 0x25, 0xFF, 0x04, 0x47,
+    0x5A, 0xE1, 0x64, 0x02, 0xFC, 0x7E, 0x4D, 0xAC, 0x14, 0xCC, 0xE4, 0x7A, 0x15, 0x00, 0x28, 0x44,
+    0x14, 0x5C, 0xC8, 0xDB, 0x82, 0x33, 0xF4, 0x9C, 0x6F, 0x35, 0xC2, 0xD2, 0xB3, 0x99, 0xE1, 0x42,
+    0xAE, 0xD0, 0x84, 0x00, 0x0F, 0x3C, 0x20, 0xBB, 0x8B, 0x83, 0x87, 0x6D, 0xF8, 0x9F, 0xC3, 0xFD,
+    0xC4, 0x79, 0xD0, 0xF2, 0x42, 0x0F, 0x48, 0x01, 0x3C, 0xE1, 0xBE, 0x59, 0xD2, 0x3E, 0x05, 0x32,
+    0x8E, 0x22, 0x93, 0x37, 0x9E, 0x2A, 0xD2, 0x79, 0xD5, 0xE6, 0x02, 0xF9, 0x0C, 0x83, 0xA9, 0x10,
+    0xE2, 0x78, 0x23, 0x72, 0xD1, 0xAE, 0x1C, 0x18, 0x9C, 0x90, 0x9F, 0x93, 0x09, 0x59, 0x84, 0x5C,
+    0xAE, 0xEA, 0x70, 0x15, 0x0E, 0xA7, 0xE7, 0x60, 0x4E, 0x9C, 0xFF, 0xFF, 0xA0, 0x81, 0x99, 0xE6,
+    0xA2, 0x3F, 0xD3, 0x14, 0x90, 0x59, 0x89, 0xDA, 0xF1, 0x81, 0x31, 0x37, 0x52, 0x09, 0x3C, 0xE7,
+    0x9D, 0x3E, 0xAC, 0x0C, 0x3E, 0x96, 0xAA, 0xE8, 0x67, 0x0D, 0xDE, 0x10, 0x7A, 0x22, 0x22, 0x92,
+    0x78, 0x10, 0xDD, 0xC6, 0x1B, 0x82, 0xF0, 0xA2, 0xCA, 0x8E, 0xEB, 0xB9, 0x72, 0x10, 0xAB, 0xCD,
+    0x79, 0x32, 0x52, 0x00, 0xA3, 0x4B, 0xD0, 0x02, 0x19, 0x9F, 0xDC, 0xDB, 0x1C, 0xD9, 0x95, 0x36,
+    0x53, 0x54, 0x97, 0x7A, 0xA5, 0x3E, 0x10, 0x13, 0x76, 0xD7, 0x0F, 0x70, 0x61, 0x3E, 0xE1, 0xD8,
+    0x90, 0x20, 0x13, 0x48, 0xE4, 0x2E, 0xA0, 0x81, 0x96, 0xF4, 0xFA, 0x09, 0x87, 0x32, 0x49, 0xBF,
+    0x99, 0xED, 0xB8, 0xCA, 0xF0, 0xAA, 0x35, 0xA9, 0xD6, 0x4C, 0xE8, 0x66, 0x2E, 0x2B, 0x52, 0x88,
+    0x55, 0x2B, 0xB6, 0xBF, 0x0F, 0x0A, 0xBD, 0xCF, 0x03, 0x57, 0x65, 0x2D, 0x3D, 0x01, 0x61, 0x85,
+    0x3F, 0xE4, 0x38, 0xD1, 0x4E, 0x6F, 0x3C, 0xC5, 0x60, 0x05, 0xBF, 0xEA, 0x63, 0x13, 0x15, 0x10,
+    0x08, 0x9A, 0xD2, 0xDA, 0x7E, 0xEC, 0x77, 0x71, 0xC4, 0x15, 0x02, 0x9F, 0xF1, 0x21, 0x43, 0x10,
+    0x82, 0xA4, 0x93, 0x1D, 0xF5, 0x9B, 0xAB, 0x0A, 0xCA, 0x4A, 0x80, 0xD5, 0xAE, 0x64, 0x00, 0xD6,
+    0x3C, 0xD6, 0x4A, 0x62, 0x49, 0x3A, 0x70, 0x2A, 0x89, 0x93, 0x1C, 0x57, 0xBF, 0x6F, 0x23, 0x21,
+    0x26, 0xE8, 0x00, 0x3B, 0x57, 0x8F, 0x0F, 0x7E, 0x17, 0x72, 0x0A, 0xF2, 0x56, 0xDE, 0x57, 0x06,
+    0x54, 0x38, 0xB8, 0x89, 0x4D, 0xD8, 0xD0, 0xD2, 0xA7, 0xFA, 0x4D, 0x04, 0xA9, 0x30, 0x6D, 0x4C,
+    0x17, 0xD3, 0xC7, 0x2C, 0x0B, 0xD6, 0x8B, 0x82, 0x8D, 0xF5, 0x82, 0xAD, 0x3F, 0x0B, 0x56, 0x2B,
+    0x05, 0x3B, 0x4B, 0x05, 0xBB, 0xAF, 0x15, 0x1C, 0x22, 0x35, 0x39, 0xA6, 0xA4, 0x08, 0xDD, 0xC4,
+    0x5D, 0x4C, 0xB4, 0x10, 0x4D, 0xE2, 0xEA, 0xF7, 0x51, 0x00, 0xD5, 0xCB, 0x81, 0x67, 0xD8, 0xAB,
+    0xCF, 0x6F, 0xF5, 0x93, 0x44, 0x60, 0x64, 0x4E, 0xA4, 0xE7, 0x46, 0x46, 0x65, 0x15, 0xB4, 0x1D,
+    0x3B, 0x11, 0xFE, 0x3E, 0x62, 0x34, 0x60, 0x42, 0xEA, 0x7E, 0x86, 0xEE, 0x85, 0x88, 0x0B, 0xD8,
+    0x98, 0x8C, 0xF4, 0x09, 0x70, 0x5C, 0x38, 0xEA, 0x24, 0xD8, 0xA7, 0xD0, 0x07, 0x67, 0xFD, 0x74,
+    0xAB, 0xB1, 0xD0, 0x11, 0xB8, 0x15, 0x58, 0x6A, 0x2F, 0xC1, 0xCB, 0xCD, 0xFE, 0x5C, 0xDB, 0xED,
+    0x21, 0xD7, 0x40, 0x55, 0x2C, 0xB4, 0x3A, 0x1D, 0x85, 0x41, 0x25, 0x09, 0x62, 0xB1, 0x28, 0xAD,
+    0xD8, 0x43, 0x7E, 0x7C, 0xDC, 0xFD, 0xD6, 0x1A, 0xC8, 0x25, 0xAA, 0x61, 0xC7, 0xA5, 0xFC, 0x11,
+    0xC8, 0x45, 0xE4, 0x7B, 0xE6, 0xC6, 0xE9, 0x4C, 0xEA, 0x1E, 0x01, 0xDA, 0x85, 0x5C, 0x31, 0x5D,
+    0xB8, 0x2A, 0x35, 0xB1, 0x52, 0xB9, 0x1A, 0x6F, 0xA6, 0x55, 0x1D, 0x77, 0x1A, 0xFF, 0x00, 0xAD,
+    0x55, 0x3D, 0x6F, 0xDC, 0x46, 0x10, 0x1D, 0x2E, 0x61, 0x6F, 0xC1, 0x82, 0x7D, 0x1A, 0x36, 0xE9,
+    0x52, 0xB0, 0x4E, 0xB5, 0x14, 0x54, 0xA6, 0x50, 0x0A, 0x1F, 0x54, 0xA4, 0xF0, 0x4F, 0xC8, 0x3F,
+    0x08, 0x89, 0xA4, 0x48, 0x29, 0xFF, 0x03, 0xB7, 0x46, 0xFE, 0x83, 0xB1, 0x74, 0x9A, 0x14, 0x2A,
+    0xC4, 0x04, 0x70, 0x2D, 0x02, 0x4E, 0x10, 0xA4, 0xF2, 0x1A, 0xA6, 0x6C, 0x2A, 0xE6, 0xEE, 0xCB,
+    0x9B, 0x3D, 0xFB, 0x24, 0x04, 0x4E, 0x60, 0x38, 0xE1, 0xDD, 0x0E, 0x6F, 0x3F, 0x66, 0x67, 0xDE,
+    0xCC, 0x9B, 0x39, 0x8F, 0x54, 0x03, 0x01, 0x40, 0x7D, 0xB5, 0xEB, 0x20, 0x52, 0x07, 0x11, 0x7D,
+    0x21, 0x09, 0x10, 0xB9, 0xB7, 0xA0, 0xC0, 0x45, 0x28, 0x37, 0x88, 0xCB, 0xAF, 0x02, 0x67, 0x59,
+    0x21, 0xEA, 0x11, 0x8F, 0x07, 0x3C, 0x32, 0x53, 0xFD, 0x24, 0x34, 0x87, 0x23, 0xD2, 0x9F, 0xFD,
+    0xE9, 0x79, 0x64, 0xCD, 0x57, 0x17, 0x9E, 0x8B, 0x11, 0xD2, 0x5E, 0x06, 0xC3, 0x97, 0xBF, 0xE0,
+    0x06, 0xD4, 0x6C, 0xEA, 0x3C, 0x36, 0x5E, 0xA4, 0xDF, 0xDD, 0x3D, 0x64, 0xBB, 0x1F, 0xF2, 0x95,
+    0x1E, 0x18, 0x54, 0x8C, 0x6F, 0xC5, 0xAE, 0xA7, 0x10, 0x37, 0x8A, 0x7F, 0x8F, 0x48, 0x07, 0x11,
+    0x29, 0x8A, 0x8D, 0xA2, 0x54, 0x51, 0x2D, 0x14, 0x74, 0x5C, 0x5D, 0x38, 0x08, 0x11, 0x73, 0x4B,
+    0xFC, 0x20, 0x52, 0x3C, 0xF2, 0x78, 0x03, 0x3C, 0x07, 0xFC, 0x53, 0xBA, 0x48, 0x4D, 0x06, 0xC8,
+    0xE9, 0xF1, 0x97, 0xC0, 0xC5, 0xD5, 0x8E, 0xD7, 0xDE, 0xAC, 0x26, 0xE8, 0xD9, 0xD9, 0x8D, 0x76,
+    0x91, 0x64, 0xD7, 0x22, 0x8A, 0xEF, 0xBC, 0xF4, 0x5D, 0x3F, 0xD4, 0xA1, 0x99, 0x68, 0x3C, 0xD9,
+    0xA5, 0x9D, 0xA4, 0x7D, 0x12, 0x9B, 0x99, 0x4A, 0xFD, 0x49, 0xC8, 0x58, 0x16, 0x0D, 0x37, 0x36,
+    0x11, 0x4B, 0x1F, 0x3A, 0x29, 0xA3, 0x7F, 0x18, 0xC4, 0xA4, 0xE6, 0x97, 0x24, 0x05, 0xEC, 0xA2,
+    0x26, 0x8E, 0xA2, 0xDD, 0xC4, 0x0F, 0x7D, 0x87, 0xCE, 0x8D, 0xCD, 0x54, 0x07, 0x37, 0xD9, 0xC5,
+    0xA0, 0x09, 0xB4, 0xE1, 0x26, 0x86, 0xE4, 0x2E, 0x16, 0xDE, 0xF1, 0x84, 0xA1, 0xFD, 0xDC, 0xD0,
+    0x77, 0xEA, 0xD0, 0x23, 0xBB, 0xDE, 0xF5, 0xAB, 0xE1, 0xFD, 0x1E, 0xC3, 0x9D, 0xFB, 0x34, 0xE0,
+    0x3B, 0x69, 0x26, 0xA9, 0x5E, 0x75, 0x56, 0xF1, 0x3A, 0xC0, 0x22, 0x52, 0x99, 0x81, 0xB2, 0xCC,
+    0x4C, 0xCD, 0xD1, 0x70, 0x38, 0x8E, 0x9E, 0x23, 0x45, 0x98, 0x18, 0x51, 0x5E, 0x45, 0x54, 0x2F,
+    0x22, 0xEA, 0x9F, 0x23, 0xE8, 0x3A, 0xDC, 0x51, 0x84, 0x2F, 0x22, 0x36, 0x0E, 0x62, 0x04, 0x7D,
+    0xC0, 0xCC, 0x31, 0x16, 0xB1, 0xF8, 0xF2, 0x4E, 0x57, 0x2E, 0xED, 0x60, 0x12, 0x2D, 0xF9, 0x24,
+    0xF2, 0xC9, 0x03, 0xF9, 0x3F, 0xEF, 0xF7, 0x52, 0x05, 0xDE, 0x31, 0x43, 0x53, 0x47, 0x34, 0x28,
+    0xC8, 0x52, 0x46, 0x1F, 0x4C, 0x26, 0x03, 0x2F, 0xCA, 0x86, 0xFC, 0xBE, 0x1F, 0x04, 0x8C, 0x18,
+    0x4A, 0xEE, 0xE7, 0x4F, 0xCF, 0xF3, 0x8E, 0x7A, 0x35, 0xF5, 0x2B, 0x6E, 0x80, 0x53, 0x9E, 0x56,
+    0x82, 0x96, 0xD7, 0xA7, 0x1B, 0xB9, 0x41, 0xB2, 0x74, 0xED, 0x58, 0x4F, 0x55, 0xB0, 0xC1, 0x6C,
+    0xE4, 0x09, 0x33, 0x27, 0xED, 0xD8, 0x8C, 0x55, 0xA8, 0xB8, 0x60, 0x74, 0x81, 0x24, 0x1E, 0xFD,
+    0x50, 0xBD, 0xC4, 0x44, 0x86, 0x04, 0xF1, 0x6E, 0xE6, 0x42, 0xA7, 0x00, 0x27, 0x45, 0x17, 0x14,
+    0x5E, 0x90, 0x36, 0x32, 0xE4, 0x04, 0xB9, 0x12, 0x65, 0xDA, 0xE4, 0x71, 0x4C, 0x8F, 0x65, 0x8B,
+    0xE9, 0x1B, 0x59, 0x63, 0x72, 0x66, 0xA1, 0x38, 0x0E, 0x31, 0xB5, 0xDF, 0xCD, 0x31, 0xD5, 0xE7,
+    0x13, 0xC5, 0xC5, 0x18, 0x53, 0xF5, 0x9C, 0xC2, 0xA2, 0x8B, 0xA9, 0x84, 0xC4, 0x64, 0x54, 0x30,
+    0xB9, 0x84, 0x6C, 0x48, 0x8D, 0x1A, 0xCA, 0x2F, 0x05, 0x27, 0xE5, 0x61, 0x7A, 0xEB, 0xB9, 0xDA,
+    0xF5, 0x7F, 0xDF, 0xBD, 0x99, 0x86, 0x9C, 0x03, 0xE5, 0x81, 0x81, 0x7A, 0x4D, 0xDC, 0xCD, 0x6A,
+    0x35, 0x36, 0xB5, 0x92, 0xAB, 0xFF, 0x7E, 0x25, 0x19, 0x99, 0x30, 0x77, 0xBE, 0xDC, 0xFE, 0xD1,
+    0x0F, 0xE2, 0x7E, 0xDA, 0x48, 0x22, 0x12, 0x0C, 0x47, 0x18, 0xFA, 0x90, 0x59, 0xDA, 0x2A, 0x47,
+    0x7B, 0x16, 0x60, 0x4E, 0x6C, 0x66, 0xFC, 0xFE, 0x79, 0xBA, 0xFB, 0x07, 0xFB, 0xFF, 0x3E, 0x0D,
+    0x3E, 0x0D, 0x2E, 0x77, 0xA1, 0x67, 0xF1, 0x2B, 0xD6, 0x9D, 0xEF, 0xC7, 0xE6, 0x32, 0xD8, 0xD7,
+    0x1B, 0x7B, 0xC6, 0xA9, 0x72, 0xF4, 0x04, 0x38, 0xC6, 0x1F, 0x72, 0x60, 0x35, 0xF3, 0xFD, 0x76,
+    0xB2, 0x7F, 0x7C, 0xEA, 0x1A, 0x80, 0xD0, 0xD6, 0x26, 0x16, 0x23, 0x1D, 0xD3, 0x03, 0x2C, 0x30,
+    0x65, 0xBB, 0x21, 0xBD, 0xC9, 0x0D, 0x61, 0xD5, 0x09, 0xF1, 0x14, 0xD4, 0x23, 0x6C, 0xB1, 0x49,
+    0x3E, 0xD5, 0xBE, 0x55, 0xB1, 0x91, 0x58, 0x5C, 0xCB, 0xBE, 0xA7, 0x28, 0x12, 0x02, 0x7A, 0x71,
+    0x1A, 0x77, 0x4C, 0x2B, 0xEB, 0x5F, 0x3E, 0xFC, 0xA5, 0x7C, 0xD7, 0x1E, 0xF0, 0x2D, 0x03, 0x34,
+    0xBA, 0xA1, 0x9E, 0xEB, 0x60, 0x97, 0x22, 0x1A, 0xED, 0x34, 0x51, 0xEC, 0xE2, 0x45, 0x92, 0x1B,
+    0xA4, 0xB9, 0x1C, 0x89, 0x9A, 0xBE, 0xF5, 0x5A, 0xF4, 0xD4, 0x2E, 0xA3, 0x66, 0x46, 0xCD, 0xB3,
+    0x34, 0x39, 0xC8, 0x00, 0xB9, 0xFD, 0xB4, 0x8A, 0xB2, 0x62, 0x06, 0x0B, 0x8F, 0x5F, 0xA9, 0x0A,
+    0x4C, 0x2A, 0x48, 0x92, 0x2F, 0x42, 0x3F, 0xC1, 0x6C, 0x76, 0xEB, 0xD9, 0x63, 0xD0, 0x8E, 0xFC,
+    0x9C, 0x93, 0xA9, 0xAC, 0x24, 0xB3, 0x95, 0x9B, 0x1B, 0x7D, 0x81, 0x3A, 0xB6, 0x3F, 0xA2, 0xD3,
+    0xDC, 0x0C, 0x55, 0x6E, 0x2D, 0x6D, 0xC6, 0x7A, 0xB8, 0x53, 0xE4, 0x5E, 0x0E, 0x0B, 0xEA, 0x45,
+    0x8B, 0x89, 0xAE, 0x36, 0xB3, 0x76, 0x47, 0x06, 0x8F, 0x8D, 0x5C, 0x2A, 0xE8, 0x7F, 0xC1, 0xCA,
+    0x60, 0xD2, 0xD1, 0x4A, 0x43, 0x47, 0xCF, 0xCB, 0x14, 0xA5, 0x88, 0xDA, 0x93, 0xEC, 0xAA, 0x15,
+    0x91, 0x9B, 0x9B, 0x1B, 0x4D, 0x62, 0x88, 0xDD, 0xE4, 0xA5, 0x5C, 0x35, 0x0C, 0xA3, 0x36, 0xC5,
+    0x8F, 0xFC, 0xF1, 0xAE, 0x1B, 0x5F, 0x20, 0x37, 0xC5, 0xEC, 0xAE, 0x79, 0xF7, 0xA3, 0x78, 0xE4,
+    0xBA, 0xF2, 0x9A, 0xCC, 0xFD, 0x7D, 0x15, 0xF7, 0x70, 0x96, 0xD4, 0x0F, 0x79, 0xFA, 0x8C, 0xD3,
+    0xB3, 0xC0, 0x18, 0x5F, 0x7D, 0xBD, 0x32, 0x95, 0x33, 0xF3, 0x38, 0x7C, 0xF6, 0x1B, 0x53, 0x5D,
+    0xD2, 0xFF, 0x9A, 0x01, 0x67, 0xF0, 0xE5, 0x30, 0xF5, 0xD2, 0x8C, 0xE5, 0x6B, 0xAD, 0xE8, 0xE6,
+    0x39, 0x6B, 0x5B, 0x7A, 0xCF, 0x2A, 0x2F, 0x92, 0x96, 0xB7, 0x7D, 0xF3, 0x71, 0xCB, 0x91, 0xCB,
+    0xEA, 0x75, 0xCA, 0xB5, 0xB0, 0x2F, 0x0A, 0xDA, 0xE1, 0x11, 0xD6, 0x18, 0x1B, 0x48, 0xAC, 0x55,
+    0xD5, 0x1F, 0xEB, 0xF9, 0x76, 0x52, 0xDD, 0xEA, 0xBF, 0x6C, 0xB0, 0x5F, 0x1D, 0xE3, 0xC6, 0x1E,
+    0xFC, 0xDE, 0xA0, 0xE6, 0x54, 0x21, 0x4A, 0x06, 0x2B, 0x7B, 0xD8, 0xFB, 0x00, 0xBC, 0xFF, 0xF9,
+    0x0B, 0x95, 0x55, 0x21, 0x73, 0xDD, 0x46, 0x10, 0x5E, 0x49, 0xA9, 0x35, 0x13, 0x81, 0x0B, 0x6E,
+    0x80, 0x0A, 0x8A, 0x4C, 0x84, 0x8B, 0x4E, 0x99, 0x80, 0x82, 0x02, 0x1B, 0x24, 0xD3, 0x99, 0x18,
+    0x14, 0xDB, 0xC4, 0x3F, 0xE1, 0xD4, 0x1A, 0x06, 0xC4, 0xA4, 0x38, 0x01, 0x01, 0xB1, 0x0C, 0xFC,
+    0x07, 0x32, 0x3D, 0x35, 0x9E, 0xA2, 0x02, 0xAB, 0xEE, 0xA4, 0x05, 0x06, 0x4F, 0xD3, 0xA6, 0xC4,
+    0xE4, 0x5D, 0xC7, 0x4A, 0xAC, 0xE4, 0x9D, 0x6E, 0xFB, 0xAD, 0x9E, 0xED, 0xD6, 0x9D, 0x04, 0xE4,
+    0xBD, 0x27, 0xBD, 0xD3, 0xDD, 0xDE, 0x77, 0xBB, 0xDF, 0x7E, 0xBB, 0x32, 0x5C, 0x51, 0xC6, 0x9E,
+    0xC8, 0x72, 0x43, 0xD1, 0xD7, 0x18, 0x90, 0x6E, 0x88, 0x92, 0x69, 0x70, 0xBA, 0x4E, 0x09, 0x73,
+    0x4B, 0x9A, 0xB9, 0x4A, 0xC2, 0x81, 0xC7, 0x52, 0xD1, 0x61, 0x29, 0x60, 0xA0, 0x30, 0x88, 0x64,
+    0x60, 0x5B, 0xD8, 0x78, 0xB1, 0x81, 0x71, 0x28, 0x2D, 0x36, 0x2F, 0xB0, 0x5B, 0xB1, 0x03, 0x02,
+    0x40, 0x09, 0x0B, 0x58, 0x99, 0xA6, 0xDE, 0x3D, 0x15, 0xBB, 0x80, 0x29, 0xE6, 0x84, 0xC7, 0x8D,
+    0x11, 0x56, 0xE9, 0x00, 0x2B, 0xE5, 0x60, 0xA5, 0x0F, 0xD9, 0x47, 0x8C, 0xA9, 0xBC, 0x87, 0x15,
+    0x37, 0xB8, 0x3C, 0xB0, 0x43, 0xA9, 0x9C, 0x9D, 0xDC, 0x52, 0x6E, 0x72, 0x8C, 0x97, 0x0F, 0xEF,
+    0x9E, 0x62, 0xB1, 0x83, 0x91, 0x3E, 0xE5, 0x99, 0x4B, 0x71, 0x82, 0x60, 0x00, 0x0B, 0x00, 0x0B,
+    0x6C, 0x65, 0x1E, 0x35, 0xF7, 0x88, 0x83, 0x22, 0xFB, 0x16, 0x6B, 0x3E, 0x65, 0x76, 0x5F, 0x44,
+    0x08, 0x58, 0x40, 0xF2, 0x0E, 0x40, 0x2B, 0xF5, 0x81, 0xB3, 0xCC, 0x19, 0x16, 0xEE, 0xDF, 0x07,
+    0x2C, 0x0E, 0x40, 0x4C, 0xA4, 0x7F, 0xA2, 0xDC, 0x2F, 0xE7, 0x9B, 0x6D, 0xC4, 0x7F, 0xF9, 0x89,
+    0x3D, 0xDD, 0xE6, 0x4A, 0xB9, 0x18, 0xA4, 0x80, 0x0A, 0x71, 0x31, 0xE2, 0x3B, 0x7C, 0xE8, 0xB1,
+    0x8F, 0xD7, 0x9C, 0xAE, 0xA2, 0xA0, 0x7F, 0x1C, 0x01, 0x0F, 0x3C, 0x52, 0x67, 0x58, 0x27, 0x7D,
+    0x24, 0xE1, 0xB3, 0xFE, 0xCD, 0xCB, 0x74, 0xDA, 0x63, 0xDA, 0xAB, 0x8E, 0xCC, 0x23, 0xA7, 0x9B,
+    0x64, 0xD4, 0x8D, 0x69, 0x0B, 0xC7, 0xC2, 0xC7, 0x5D, 0x71, 0xBF, 0x07, 0x90, 0x09, 0x97, 0xC7,
+    0xDD, 0xE6, 0x41, 0x5C, 0x06, 0x17, 0x2F, 0xF8, 0x3E, 0x2B, 0x97, 0x78, 0x2D, 0x44, 0x91, 0x7E,
+    0x01, 0x06, 0x13, 0xDE, 0x9F, 0x02, 0x02, 0x07, 0x4D, 0xFE, 0x1A, 0x10, 0x77, 0x7D, 0x36, 0x28,
+    0xA0, 0xEA, 0xC3, 0x91, 0x58, 0xD2, 0xC4, 0x08, 0x27, 0xB2, 0xAF, 0x00, 0xEB, 0x10, 0x48, 0xF5,
+    0x79, 0x8A, 0xA8, 0x8B, 0x26, 0xDA, 0x10, 0x4E, 0x1B, 0x5E, 0x78, 0xDD, 0x16, 0x87, 0x3E, 0xF6,
+    0xB2, 0x83, 0x0F, 0x7C, 0xCE, 0xB3, 0xC6, 0xF4, 0xCF, 0xAF, 0x62, 0xDD, 0x76, 0x42, 0xA7, 0x81,
+    0x4B, 0x61, 0x3D, 0x1E, 0xC1, 0x49, 0x45, 0xE9, 0xDF, 0x5C, 0x59, 0x2B, 0xAC, 0x0C, 0xDC, 0x9A,
+    0xA3, 0x3E, 0x1E, 0x99, 0xF2, 0x13, 0x17, 0x05, 0x4B, 0xF9, 0xEF, 0x78, 0x02, 0xD2, 0x0B, 0xB6,
+    0x7D, 0x86, 0x04, 0xE7, 0x5C, 0x0A, 0xC8, 0x6A, 0xBD, 0xAB, 0x10, 0x1A, 0x02, 0x0B, 0x71, 0xD0,
+    0x95, 0x59, 0xFB, 0xCB, 0x1C, 0xC2, 0x15, 0x00, 0xE8, 0x6F, 0xED, 0xA3, 0x4E, 0x9D, 0x0D, 0x70,
+    0x73, 0x3F, 0x20, 0x42, 0xC5, 0x23, 0xD5, 0xF5, 0x63, 0x1E, 0x99, 0x67, 0xAF, 0xEF, 0x05, 0x02,
+    0x47, 0xEF, 0xBB, 0x45, 0x75, 0xBD, 0x0B, 0xF6, 0x25, 0x03, 0x2E, 0x41, 0xB8, 0xD3, 0xD5, 0xFF,
+    0xE7, 0x72, 0xCA, 0xA5, 0xB8, 0x54, 0xA7, 0x24, 0xB1, 0x81, 0x2F, 0x2E, 0x70, 0x7A, 0x75, 0x6D,
+    0x12, 0x6D, 0x92, 0x05, 0x4C, 0x88, 0x45, 0x3F, 0xB1, 0xB7, 0xA4, 0xCD, 0xCB, 0x6F, 0xE6, 0xCC,
+    0x0B, 0xB1, 0x16, 0x92, 0x08, 0x5C, 0xDD, 0xE2, 0x53, 0x0F, 0xE7, 0x51, 0x18, 0x25, 0xAD, 0xD3,
+    0x6A, 0x89, 0xEF, 0x77, 0x3E, 0x19, 0x32, 0x9C, 0xA2, 0x2B, 0x08, 0x7F, 0x67, 0xD0, 0x0D, 0xD8,
+    0x7B, 0x88, 0x4C, 0x9F, 0xBF, 0x15, 0xD1, 0x48, 0xBA, 0x53, 0x29, 0x05, 0x62, 0x33, 0x77, 0xA4,
+    0x7F, 0x1D, 0x6C, 0x09, 0x71, 0xEF, 0x20, 0xB1, 0xC9, 0x90, 0x3B, 0xDD, 0xEA, 0xCA, 0x3E, 0x1C,
+    0x12, 0x84, 0xBC, 0xC2, 0xBB, 0x9A, 0x87, 0x82, 0xC7, 0x1B, 0xA2, 0xB6, 0x11, 0x65, 0x97, 0x70,
+    0x97, 0xF0, 0x40, 0x2B, 0x20, 0x9A, 0x6F, 0x41, 0x2E, 0xC2, 0x89, 0x2F, 0x18, 0x1A, 0xA5, 0x3D,
+    0xDA, 0xB2, 0x95, 0xE6, 0xAE, 0xE0, 0x41, 0x71, 0x00, 0xF9, 0x3B, 0x0B, 0xFE, 0xE3, 0x0D, 0xBF,
+    0x1D, 0x6C, 0xF0, 0x9A, 0x7F, 0x50, 0x52, 0x49, 0x42, 0x69, 0x03, 0x1B, 0xE5, 0x3E, 0x29, 0xEF,
+    0xA5, 0x4E, 0x53, 0x30, 0x4D, 0x0E, 0x77, 0x6C, 0x05, 0x80, 0x9B, 0xBB, 0x2B, 0xFB, 0x43, 0x32,
+    0x45, 0x0B, 0xB3, 0xCE, 0x82, 0x7C, 0x1B, 0x8A, 0x6D, 0x7E, 0xFC, 0x90, 0xE7, 0x87, 0xBC, 0xE8,
+    0x26, 0x89, 0x01, 0x1B, 0x4E, 0x40, 0x57, 0x7B, 0xB4, 0xBA, 0x06, 0x9C, 0x10, 0x8F, 0xAA, 0x33,
+    0x55, 0x00, 0x95, 0x6F, 0x44, 0x99, 0xA5, 0x82, 0x7B, 0x6C, 0x5A, 0xD5, 0x31, 0x85, 0x14, 0x12,
+    0x2E, 0x3A, 0x18, 0xAB, 0x2E, 0xF5, 0x31, 0x52, 0xA2, 0x27, 0x27, 0x9C, 0xFE, 0x9E, 0x25, 0x09,
+    0x1A, 0x01, 0x23, 0x07, 0x86, 0x38, 0x5D, 0xFE, 0x01, 0x64, 0x2A, 0x7A, 0x94, 0x66, 0x2F, 0xD5,
+    0x4B, 0x54, 0x57, 0x54, 0xDB, 0x01, 0xDC, 0x4A, 0xC5, 0x72, 0x9B, 0x73, 0x18, 0xB2, 0x39, 0x9B,
+    0x64, 0xC1, 0x27, 0xBF, 0xBC, 0xE3, 0xDE, 0x3F, 0xB7, 0xA3, 0xD6, 0x05, 0x7F, 0xC9, 0x5F, 0x71,
+    0x0B, 0xF5, 0xF7, 0xDA, 0xD9, 0x31, 0xED, 0x0B, 0x2E, 0x7D, 0xE6, 0xE0, 0xA1, 0xA9, 0xF2, 0x59,
+    0x97, 0x9E, 0x0F, 0xD1, 0x18, 0xC8, 0x98, 0x97, 0xDB, 0x33, 0xE6, 0x73, 0x94, 0x3B, 0xD7, 0xF6,
+    0xFA, 0x4A, 0x95, 0xB7, 0xC8, 0xB4, 0xF4, 0x36, 0x14, 0x6B, 0x82, 0x02, 0xB1, 0xA5, 0x3E, 0x72,
+    0x91, 0xE8, 0x76, 0xB6, 0xFC, 0x3B, 0x71, 0xB1, 0x37, 0x95, 0x54, 0x40, 0x2F, 0x12, 0x2C, 0x96,
+    0xBA, 0xAD, 0xEB, 0x1A, 0x6E, 0x09, 0xAA, 0x8F, 0x2F, 0x80, 0xAE, 0xA1, 0x5E, 0x3F, 0xE2, 0x59,
+    0xDE, 0xE9, 0x6D, 0x28, 0x98, 0xFF, 0xE4, 0x14, 0x55, 0x67, 0x4C, 0xA3, 0xE6, 0x5D, 0xB2, 0x18,
+    0x08, 0x62, 0xD2, 0xB6, 0xC9, 0xE7, 0x83, 0x3A, 0x9F, 0xFA, 0x91, 0xD7, 0x8F, 0xA5, 0xF8, 0x93,
+    0x01, 0x2A, 0x9C, 0x2A, 0xEA, 0xE2, 0x81, 0xEC, 0xAB, 0x4C, 0xD2, 0x3D, 0xE8, 0xEE, 0x33, 0xA4,
+    0x8C, 0xE9, 0xDF, 0x9F, 0x2D, 0xC9, 0xB4, 0x37, 0x20, 0x06, 0xE4, 0x27, 0x9E, 0xBA, 0xD9, 0xD6,
+    0xA5, 0x6F, 0xBD, 0x94, 0xA5, 0x9D, 0xE4, 0x9A, 0x39, 0xE9, 0x4D, 0xEF, 0x7B, 0x58, 0xAD, 0xA2,
+    0x67, 0x45, 0x9B, 0xA0, 0x43, 0xA5, 0xC8, 0x4C, 0x26, 0xF7, 0x0E, 0x6A, 0x6C, 0x63, 0x8F, 0xC5,
+    0x11, 0x2E, 0x04, 0x4D, 0x64, 0xA4, 0xBD, 0x02, 0xAC, 0x90, 0x26, 0x0D, 0x7F, 0x14, 0xCE, 0x01,
+    0x8A, 0xB8, 0x47, 0x06, 0x9D, 0x16, 0x2D, 0x53, 0x85, 0xE5, 0xF4, 0x04, 0x3D, 0x2D, 0x0A, 0xFA,
+    0x74, 0xCA, 0x34, 0x15, 0xD9, 0x00, 0x4F, 0x21, 0x2F, 0x54, 0x00, 0x77, 0xFA, 0xD8, 0x9B, 0xE3,
+    0x31, 0x73, 0x20, 0xBB, 0x68, 0x18, 0xEF, 0x88, 0xD8, 0xA3, 0xCE, 0xB2, 0x33, 0x64, 0xAF, 0xF8,
+    0xB9, 0xC7, 0x14, 0xAA, 0x33, 0xEB, 0x8B, 0x45, 0x98, 0x12, 0xE3, 0xF1, 0x06, 0x12, 0xDE, 0xED,
+    0x87, 0xE1, 0xB7, 0xCA, 0x9B, 0x4F, 0x50, 0x8A, 0x77, 0x38, 0x1D, 0xA4, 0xCF, 0x24, 0x61, 0x44,
+    0xA9, 0x75, 0xD8, 0xB7, 0x74, 0x1A, 0xDA, 0x54, 0x8B, 0x9E, 0xEC, 0x1A, 0x7A, 0x24, 0x92, 0xD1,
+    0x14, 0xC7, 0xF2, 0x66, 0x5A, 0x2D, 0x3F, 0x45, 0xA1, 0xDA, 0x64, 0x88, 0xC1, 0x3A, 0x9C, 0xA9,
+    0x8A, 0xE6, 0x03, 0x8F, 0xF2, 0x12, 0x99, 0x32, 0x24, 0x2F, 0x2D, 0x39, 0xD8, 0x2E, 0x8F, 0x5D,
+    0x79, 0xB2, 0x45, 0xAB, 0x07, 0x8D, 0x5A, 0xB8, 0x24, 0xA0, 0x0A, 0xD0, 0x28, 0x66, 0xAD, 0x3A,
+    0x0F, 0x1B, 0x62, 0x89, 0x4D, 0xCD, 0x83, 0xB5, 0x6B, 0x6F, 0x24, 0x48, 0xB3, 0xA6, 0x1A, 0x4A,
+    0x27, 0xFE, 0xA8, 0xDB, 0xFF, 0x3E, 0x7B, 0xA8, 0xF9, 0x3D, 0x74, 0x30, 0x7C, 0x03, 0x84, 0x12,
+    0x3E, 0x6A, 0xC8, 0x17, 0x2D, 0x8F, 0x79, 0x3E, 0x0D, 0x45, 0xCE, 0x92, 0xC7, 0x49, 0x72, 0x97,
+    0xC3, 0xCD, 0xAB, 0x36, 0xFF, 0x0F, 0xAD, 0x55, 0xBD, 0x72, 0xDD, 0x44, 0x14, 0x3E, 0xD2, 0x92,
+    0x68, 0xC6, 0x2A, 0xD6, 0x05, 0x05, 0xE3, 0x46, 0x0D, 0x05, 0xE3, 0x46, 0x2F, 0xC0, 0xB0, 0x9A,
+    0x49, 0x49, 0xE1, 0x14, 0xF6, 0xA4, 0xA0, 0x70, 0x9B, 0x71, 0xE3, 0x17, 0x80, 0x48, 0x86, 0x82,
+    0x82, 0x22, 0x9E, 0xE1, 0x01, 0xE2, 0x82, 0x22, 0xB6, 0x8B, 0xBC, 0x80, 0xB1, 0x14, 0x5C, 0xBA,
+    0xB0, 0xCC, 0xC0, 0xA4, 0xBC, 0x9B, 0xD8, 0xA9, 0x23, 0xC6, 0x32, 0x5E, 0xEC, 0xDD, 0x3D, 0x7C,
+    0x47, 0xD7, 0x24, 0x14, 0x81, 0x06, 0x74, 0xEF, 0xAE, 0xF6, 0xF7, 0xFC, 0x7E, 0xDF, 0xD1, 0xC6,
+    0x2E, 0x11, 0xC7, 0x79, 0x23, 0x69, 0x7C, 0x1F, 0x8D, 0x2D, 0x9A, 0x27, 0xDE, 0x0F, 0x14, 0x93,
+    0x88, 0x75, 0x9E, 0xDE, 0xCC, 0x01, 0xCD, 0xA1, 0x6D, 0xE3, 0xDA, 0xC2, 0x63, 0x4B, 0x49, 0xC0,
+    0x9D, 0x62, 0x26, 0x03, 0x5E, 0xC5, 0x80, 0x23, 0x06, 0xEC, 0x8B, 0xD9, 0x65, 0x7B, 0x1A, 0x70,
+    0x05, 0x5B, 0xFA, 0x65, 0x88, 0x69, 0xC0, 0x16, 0x3F, 0xC7, 0xD6, 0x88, 0x81, 0x4B, 0xC2, 0xEE,
+    0xA4, 0x6C, 0xFE, 0x87, 0x46, 0x28, 0xC4, 0x2D, 0xA8, 0xC3, 0x15, 0xA8, 0x41, 0x0F, 0x55, 0xD0,
+    0x04, 0x45, 0x79, 0xAC, 0x34, 0xBB, 0x94, 0xB9, 0x5B, 0x2C, 0xC6, 0xE9, 0xBC, 0xE9, 0x0C, 0x0F,
+    0x9A, 0x7D, 0xB2, 0xC6, 0x98, 0x3C, 0x27, 0xD3, 0x47, 0x1E, 0xB0, 0x94, 0xC3, 0x6A, 0x3C, 0xBB,
+    0x54, 0x9C, 0x2B, 0x97, 0xB1, 0xD7, 0xD6, 0xB0, 0x37, 0x5F, 0xC7, 0x7C, 0x8C, 0x7A, 0xD0, 0x17,
+    0xA1, 0xAE, 0xCA, 0x13, 0x38, 0xD0, 0x1A, 0x1E, 0x53, 0xCF, 0xCF, 0xFA, 0xFC, 0xC2, 0x99, 0xC6,
+    0x9C, 0x58, 0x4E, 0xA2, 0xD9, 0x62, 0x1E, 0x22, 0x94, 0xDC, 0x73, 0x09, 0x0F, 0x34, 0x7F, 0x36,
+    0xF6, 0x9A, 0x9A, 0x83, 0x66, 0x3E, 0x85, 0x53, 0x65, 0x57, 0xFC, 0x1C, 0x92, 0xA0, 0xAF, 0xDB,
+    0x1E, 0x8B, 0x09, 0x73, 0x5F, 0x9E, 0x86, 0xCC, 0x17, 0x3D, 0x63, 0xAF, 0x2F, 0x5E, 0xF8, 0x24,
+    0xE0, 0x4A, 0x02, 0x8B, 0x0A, 0x58, 0xE1, 0x89, 0x74, 0x23, 0x32, 0xF2, 0x3F, 0xA8, 0x64, 0x5B,
+    0x32, 0x2C, 0x28, 0x8F, 0x07, 0x75, 0x15, 0xD6, 0xE0, 0x19, 0xB7, 0xCC, 0x6F, 0x06, 0x4A, 0x71,
+    0xAA, 0xEE, 0x12, 0x1D, 0x9F, 0x75, 0x2C, 0xD6, 0x8F, 0x74, 0x87, 0x28, 0x6D, 0x76, 0x52, 0xF7,
+    0x88, 0x0E, 0xCB, 0x6E, 0x21, 0x9D, 0x24, 0x94, 0xE7, 0xD4, 0x72, 0xD3, 0xB2, 0x33, 0x5D, 0x5B,
+    0x76, 0x7A, 0x76, 0xF9, 0xE0, 0x86, 0x79, 0x12, 0xD2, 0x51, 0x3E, 0x88, 0xC6, 0x0F, 0xCC, 0x75,
+    0xAB, 0x10, 0x9F, 0x92, 0x7B, 0xFA, 0x90, 0x34, 0x72, 0x51, 0xFF, 0x8A, 0x98, 0x31, 0xC1, 0x7D,
+    0x5A, 0xBF, 0xBC, 0x4F, 0x06, 0x82, 0x62, 0x39, 0xAA, 0x1B, 0x1E, 0xB1, 0x3C, 0x98, 0xC1, 0xF4,
+    0x4C, 0xF5, 0x3D, 0x98, 0xAC, 0x87, 0x6C, 0x34, 0x4D, 0xD1, 0x47, 0x4C, 0x91, 0x15, 0x6D, 0xDF,
+    0x4E, 0x2B, 0x12, 0x87, 0xB2, 0x51, 0xC2, 0x0D, 0x41, 0xC8, 0xD2, 0x48, 0x4A, 0xF0, 0x41, 0x2A,
+    0x60, 0x57, 0x77, 0xA9, 0x84, 0x69, 0x6F, 0xEF, 0x89, 0xE4, 0x69, 0x76, 0xB9, 0x1A, 0x45, 0xF1,
+    0xFB, 0x3A, 0x6A, 0xCF, 0x73, 0xF6, 0x25, 0xEC, 0xEF, 0x17, 0xDB, 0x8A, 0x44, 0x12, 0x77, 0xF2,
+    0x5F, 0xAB, 0x5A, 0xF1, 0x9F, 0x4C, 0xF4, 0x48, 0x66, 0x0A, 0xF9, 0x44, 0x77, 0x63, 0xC3, 0x7C,
+    0xCC, 0xD1, 0x34, 0x8B, 0x4C, 0x29, 0x6F, 0x2B, 0xA4, 0x0A, 0x78, 0xAB, 0x07, 0x2A, 0x7F, 0xA1,
+    0xBA, 0xDE, 0xF7, 0xCC, 0xAF, 0x38, 0x4C, 0x61, 0x59, 0xB9, 0xF0, 0x0F, 0x69, 0xE1, 0x7B, 0x17,
+    0xCD, 0xE3, 0xB3, 0xBF, 0x75, 0x9F, 0x7E, 0xF9, 0xE8, 0xE0, 0xAB, 0x83, 0x4F, 0x3E, 0x06, 0x3C,
+    0x77, 0x90, 0xF5, 0x7F, 0xF8, 0x41, 0xC0, 0x8F, 0x88, 0x5C, 0xA4, 0x87, 0x13, 0x60, 0xE2, 0xBF,
+    0xFD, 0xD2, 0x50, 0xFB, 0x1A, 0xD6, 0x27, 0x7B, 0x7B, 0xDB, 0xD0, 0x2B, 0x44, 0x51, 0x42, 0x10,
+    0x32, 0x5B, 0x32, 0x74, 0xFA, 0x75, 0x45, 0xA6, 0x02, 0x20, 0x94, 0x44, 0xB7, 0xC1, 0xF0, 0x0B,
+    0xAF, 0x06, 0x6D, 0xCB, 0xDE, 0x80, 0x34, 0x21, 0xC7, 0xD0, 0xCC, 0x58, 0xF8, 0xC4, 0x3D, 0x0E,
+    0xE8, 0x11, 0xC3, 0x66, 0x8E, 0xB0, 0x5D, 0xDA, 0x80, 0x98, 0xA6, 0xEC, 0x10, 0x28, 0xE4, 0x52,
+    0x39, 0x81, 0x44, 0x24, 0xC4, 0xC5, 0x20, 0xC1, 0x3F, 0xE0, 0x34, 0xF3, 0x91, 0x74, 0x4E, 0x16,
+    0x59, 0x4E, 0x96, 0x27, 0x38, 0xA9, 0x2F, 0x84, 0x10, 0x1E, 0x8B, 0x00, 0x78, 0x83, 0xD8, 0xFE,
+    0x7F, 0x59, 0x97, 0x07, 0x19, 0x47, 0x88, 0x52, 0x47, 0xF4, 0xD9, 0xAD, 0x99, 0xCB, 0x2B, 0x56,
+    0x83, 0x1F, 0x38, 0x5A, 0x37, 0x42, 0xA6, 0xDF, 0x51, 0x1B, 0x58, 0x78, 0x49, 0x5C, 0xF7, 0xDA,
+    0x22, 0x92, 0x19, 0xE8, 0x56, 0x5A, 0x70, 0x17, 0xD2, 0xE0, 0x04, 0xA5, 0x52, 0x17, 0x7A, 0x4A,
+    0xFE, 0x62, 0xC2, 0xC2, 0xF6, 0xDD, 0x7D, 0xA7, 0x58, 0x38, 0x86, 0x14, 0x5B, 0xC1, 0x73, 0x1B,
+    0xCB, 0x4D, 0x7E, 0xF2, 0x1D, 0xBF, 0x39, 0xE2, 0x1B, 0x2B, 0x16, 0xB2, 0x03, 0x10, 0x70, 0x06,
+    0x20, 0x59, 0xBD, 0x53, 0x91, 0xD7, 0x1D, 0xC5, 0xCD, 0x8E, 0x6A, 0xAE, 0x28, 0x77, 0x93, 0x25,
+    0xCB, 0x4D, 0xF2, 0xB4, 0xEC, 0x95, 0x17, 0x0F, 0xF4, 0x90, 0x4B, 0x6F, 0x95, 0x2B, 0xFA, 0xD4,
+    0x23, 0x86, 0x01, 0x1E, 0x47, 0x03, 0x4C, 0x49, 0xFC, 0x00, 0x92, 0x52, 0x74, 0xE3, 0x1E, 0x22,
+    0x2E, 0x4C, 0x99, 0xC0, 0x08, 0xBC, 0x69, 0x44, 0x5F, 0xC7, 0xF9, 0x32, 0x12, 0x00, 0xCF, 0x67,
+    0x36, 0xBB, 0x72, 0x52, 0xC9, 0xEA, 0xFA, 0x3D, 0x93, 0xA9, 0x12, 0x71, 0x8D, 0x04, 0xE7, 0x73,
+    0xCE, 0x42, 0xFC, 0x52, 0x85, 0x58, 0x15, 0x36, 0xF5, 0x38, 0x63, 0x01, 0x90, 0x46, 0x0F, 0x18,
+    0x77, 0xD2, 0x1B, 0xF4, 0xEA, 0x5D, 0x3F, 0x2A, 0x8F, 0xF2, 0xE0, 0x60, 0xA4, 0x35, 0x5E, 0x8C,
+    0x46, 0x0F, 0xC3, 0x6B, 0xE0, 0x22, 0x73, 0x87, 0x11, 0xE6, 0x7B, 0xCF, 0x70, 0x20, 0xF8, 0x1A,
+    0xAE, 0x22, 0x2A, 0xB0, 0xAE, 0x1D, 0x0B, 0xA9, 0x6C, 0x83, 0x0E, 0x52, 0x4D, 0x10, 0xCE, 0x0D,
+    0x5A, 0xAE, 0x96, 0xBE, 0x85, 0x28, 0x28, 0xA9, 0x50, 0xFE, 0x8E, 0x9C, 0xF2, 0x4A, 0x32, 0xDF,
+    0x99, 0x6F, 0x7C, 0x1A, 0xD4, 0x88, 0x81, 0xAD, 0x29, 0x64, 0x0C, 0x6C, 0x0C, 0x3C, 0x80, 0xA1,
+    0x65, 0xBB, 0xDE, 0xA9, 0x9B, 0xDF, 0x90, 0xA1, 0x22, 0x6A, 0x21, 0x5D, 0x57, 0x5B, 0xCA, 0x70,
+    0x6F, 0x72, 0x01, 0x2F, 0xDA, 0x8F, 0xBB, 0x48, 0x62, 0x9C, 0xDA, 0x83, 0xB0, 0x3A, 0xAD, 0x21,
+    0xF8, 0x15, 0xC0, 0x3D, 0xA0, 0x41, 0x41, 0x16, 0x94, 0x4F, 0x22, 0xD6, 0xE3, 0xFC, 0x8D, 0xB9,
+    0xAC, 0x4F, 0xFB, 0xB1, 0x4A, 0x56, 0xE7, 0x72, 0xE6, 0xB2, 0x9E, 0xDE, 0x7E, 0x1C, 0xC2, 0xDB,
+    0x35, 0x15, 0xD6, 0x26, 0xA2, 0xBC, 0x93, 0x75, 0x2B, 0x27, 0xEE, 0x8B, 0x1C, 0x80, 0x81, 0xB7,
+    0xA7, 0xA4, 0x22, 0x75, 0x9B, 0x71, 0x65, 0xC0, 0xE5, 0x1B, 0x81, 0x55, 0x00, 0x57, 0xFA, 0x02,
+    0xD5, 0x0E, 0x69, 0x1A, 0x00, 0x45, 0x64, 0xDB, 0x4A, 0xD1, 0x98, 0x10, 0x02, 0x59, 0x13, 0x2B,
+    0x54, 0xD8, 0x7C, 0xBD, 0x56, 0x71, 0xE6, 0x04, 0xAD, 0x70, 0x0F, 0xE5, 0xD5, 0xE2, 0x64, 0x16,
+    0xE9, 0x23, 0x06, 0x2B, 0xD8, 0x74, 0x39, 0xF3, 0xC9, 0x20, 0xC5, 0x77, 0x0E, 0x9C, 0x0A, 0xD5,
+    0x44, 0xF8, 0x72, 0xE4, 0x72, 0x14, 0x63, 0x6B, 0xBA, 0x45, 0xB3, 0x85, 0xF0, 0xF2, 0xFA, 0xE5,
+    0x2A, 0x0C, 0x99, 0x28, 0xC2, 0xBD, 0x79, 0x01, 0x9B, 0xE3, 0xC4, 0xC4, 0xC2, 0x26, 0x38, 0x75,
+    0x7D, 0x80, 0x2F, 0x04, 0xBE, 0x0C, 0x90, 0x73, 0x4B, 0xD9, 0x4C, 0x6A, 0xA0, 0x20, 0x4B, 0x0A,
+    0x22, 0xE5, 0x57, 0x52, 0x07, 0x56, 0x3A, 0xE0, 0xBC, 0x04, 0x48, 0x91, 0x03, 0x32, 0x7B, 0x01,
+    0x45, 0x59, 0x28, 0x09, 0x83, 0xC9, 0x6C, 0xCE, 0x00, 0x4E, 0x29, 0xDC, 0xAF, 0xBC, 0xA1, 0x3A,
+    0x07, 0x89, 0x7C, 0xF9, 0x13, 0x3C, 0x6A, 0xB3, 0xB1, 0x4E, 0xBD, 0x3E, 0xF3, 0xF9, 0x00, 0xFF,
+    0x97, 0x76, 0x20, 0x54, 0x7C, 0x81, 0xE0, 0xC3, 0x43, 0x7C, 0x3F, 0x0C, 0x25, 0xAE, 0xAC, 0x54,
+    0x6C, 0xBB, 0x0C, 0xB5, 0x12, 0xBE, 0x58, 0x7D, 0x7C, 0x86, 0x4F, 0xC8, 0x99, 0x33, 0x9F, 0xBF,
+    0xF4, 0x75, 0x6E, 0x03, 0xE7, 0xA0, 0xDD, 0x7F, 0x7F, 0xFE, 0x04, 0xD5, 0x54, 0xBD, 0x8E, 0x1D,
+    0x35, 0x14, 0x3E, 0x33, 0x4E, 0x76, 0x24, 0xA6, 0x70, 0xEA, 0xA4, 0x98, 0x3E, 0x05, 0x7E, 0x01,
+    0x24, 0x7B, 0xC3, 0x03, 0x50, 0xED, 0x52, 0x50, 0xD0, 0xA7, 0xD9, 0x17, 0x40, 0xF2, 0x90, 0x26,
+    0x05, 0x45, 0xF2, 0x08, 0x29, 0x28, 0xC2, 0x6D, 0xF2, 0x06, 0x77, 0x26, 0xDC, 0x62, 0x8B, 0x2D,
+    0x76, 0x20, 0x2B, 0x51, 0x6C, 0xC1, 0x20, 0x84, 0x22, 0x91, 0x22, 0x0E, 0x72, 0x84, 0x57, 0x6B,
+    0xCF, 0xE1, 0x3B, 0x73, 0x57, 0x88, 0x02, 0x2A, 0x44, 0x81, 0xAF, 0xC6, 0xF6, 0xF5, 0x8C, 0xBF,
+    0xF3, 0x9D, 0xEF, 0xFC, 0x0C, 0x54, 0xB1, 0x23, 0x26, 0xC5, 0xE3, 0x9F, 0x73, 0xFB, 0x66, 0xC6,
+    0xAC, 0x77, 0x01, 0x73, 0xB7, 0x8B, 0x98, 0xED, 0x61, 0x22, 0x66, 0xDE, 0x64, 0x99, 0x79, 0x59,
+    0x67, 0x26, 0x3E, 0x2E, 0xEC, 0x1D, 0xD7, 0x69, 0x6B, 0x7A, 0x56, 0x71, 0xDB, 0x8D, 0xDC, 0x84,
+    0xAD, 0x9E, 0x58, 0xCF, 0xDB, 0x36, 0xB0, 0x9E, 0xB6, 0x4D, 0x60, 0x33, 0x6E, 0x55, 0x62, 0xDB,
+    0x6F, 0xEB, 0x7C, 0x9F, 0xEA, 0x0D, 0xA9, 0x40, 0x36, 0x92, 0xA5, 0x96, 0x7B, 0x6C, 0x73, 0xC6,
+    0xB6, 0xFB, 0x6A, 0x56, 0x57, 0x9F, 0x46, 0x4F, 0x16, 0xA8, 0x51, 0x09, 0xF6, 0x68, 0x8F, 0xCB,
+    0x92, 0x55, 0x30, 0xE7, 0x67, 0xB3, 0x55, 0x31, 0x7B, 0x15, 0xBC, 0xDE, 0x45, 0xAB, 0xE7, 0x6C,
+    0x76, 0xA1, 0xE8, 0xB1, 0xB4, 0xF8, 0x2A, 0x68, 0x99, 0x1A, 0x4C, 0x53, 0x5D, 0x8E, 0x7C, 0x4F,
+    0x03, 0xB8, 0x92, 0x7D, 0x94, 0x89, 0xF4, 0xEB, 0x40, 0xB0, 0x31, 0xE3, 0x2F, 0x17, 0x12, 0xC2,
+    0x4E, 0x2D, 0x3C, 0x8C, 0x4D, 0x62, 0x33, 0x09, 0xB9, 0xA0, 0x67, 0x6E, 0x43, 0x37, 0x71, 0x13,
+    0xCD, 0xC8, 0x2A, 0xDB, 0x91, 0xEB, 0x0C, 0x6F, 0xAA, 0x72, 0x77, 0xB3, 0xF9, 0xDA, 0x80, 0x08,
+    0xC0, 0xE7, 0x26, 0x98, 0xB1, 0xCA, 0x9E, 0x68, 0x2B, 0x20, 0x0B, 0x04, 0xE2, 0x1E, 0xE7, 0x93,
+    0x3E, 0xFF, 0x21, 0x98, 0x27, 0xAF, 0x82, 0xD5, 0xDF, 0x83, 0xD4, 0x77, 0x19, 0x5E, 0xE7, 0x41,
+    0x98, 0x27, 0xE0, 0x40, 0x21, 0x1D, 0x80, 0x00, 0x54, 0x55, 0x8E, 0x06, 0x07, 0xFD, 0x7A, 0xFC,
+    0x46, 0x15, 0xED, 0xA8, 0x03, 0xF9, 0x93, 0x71, 0xF5, 0x71, 0xBA, 0x91, 0x51, 0xBC, 0x86, 0x2B,
+    0xEF, 0x3F, 0xBF, 0xE6, 0x45, 0xE5, 0x36, 0x2E, 0x76, 0xE5, 0xF3, 0x38, 0xDA, 0x97, 0x05, 0x24,
+    0x75, 0x18, 0x54, 0x32, 0x3B, 0x10, 0x5C, 0x9A, 0xC8, 0xDD, 0x6C, 0x7B, 0xB6, 0x67, 0x60, 0x6F,
+    0xC6, 0xFB, 0xF5, 0x66, 0xB3, 0xD1, 0x2F, 0x71, 0x7B, 0x27, 0xE6, 0xC6, 0xAC, 0x92, 0x9E, 0x2C,
+    0xD9, 0x4F, 0x66, 0xFD, 0xCB, 0x67, 0xD7, 0xB3, 0x18, 0xD9, 0x07, 0x0C, 0x6A, 0x2E, 0x9C, 0x21,
+    0x9A, 0xB7, 0x2A, 0xD8, 0xEE, 0x6C, 0xCE, 0xDD, 0xE3, 0x90, 0x85, 0xB7, 0x45, 0x94, 0x7D, 0x3B,
+    0x57, 0xEE, 0xA0, 0x47, 0xDC, 0x9C, 0xBE, 0xBC, 0x20, 0x5D, 0x90, 0x12, 0x57, 0x34, 0x80, 0x3E,
+    0x1C, 0x51, 0x53, 0x03, 0x35, 0x5B, 0x88, 0x69, 0x46, 0xAA, 0x16, 0xF2, 0x3C, 0x57, 0x9C, 0xA8,
+    0x81, 0x16, 0x74, 0x0F, 0x62, 0xD7, 0xD0, 0x45, 0x25, 0xE8, 0x0D, 0xA5, 0xD9, 0x3D, 0xE4, 0xDC,
+    0xC1, 0x1C, 0xC4, 0x6B, 0xAE, 0x1C, 0x75, 0x23, 0x91, 0xFF, 0xF5, 0x1B, 0x50, 0x28, 0x80, 0x8B,
+    0x74, 0x9B, 0xDC, 0x81, 0x33, 0x87, 0xC9, 0x4E, 0x66, 0x70, 0xF7, 0xB8, 0xB7, 0xBC, 0x20, 0x76,
+    0xD3, 0x53, 0xB9, 0x5F, 0xE8, 0x18, 0x4A, 0x2C, 0xA4, 0x11, 0xB2, 0x03, 0x60, 0xDB, 0x91, 0x74,
+    0xB8, 0xFB, 0x22, 0x79, 0xCE, 0x96, 0xA3, 0xB9, 0xA0, 0x76, 0xA6, 0x7A, 0xD9, 0x3C, 0xB5, 0x9C,
+    0x71, 0x87, 0x6E, 0x3B, 0xB7, 0xAD, 0x53, 0xFB, 0x76, 0x36, 0xFD, 0xB0, 0x60, 0xC3, 0x7F, 0xBB,
+    0xE1, 0xA1, 0x4E, 0xFA, 0x75, 0x32, 0x8F, 0x8A, 0xBD, 0x5E, 0x84, 0x16, 0x87, 0x1A, 0x21, 0xA2,
+    0xCA, 0x5F, 0x80, 0x39, 0xAC, 0x92, 0xE9, 0xFF, 0xB2, 0xA9, 0xE0, 0x29, 0x35, 0x70, 0x75, 0x65,
+    0x4E, 0x88, 0xFA, 0x7A, 0xF4, 0xBC, 0x09, 0xF7, 0x9B, 0xD8, 0x8D, 0x4B, 0x37, 0x79, 0x95, 0xFD,
+    0x61, 0x6E, 0xDF, 0x15, 0xE4, 0xC5, 0x29, 0x8E, 0x3C, 0x8E, 0xAA, 0x6C, 0x0F, 0x73, 0x13, 0xE4,
+    0x68, 0x97, 0x50, 0x02, 0x3A, 0xFA, 0x36, 0x75, 0xA2, 0xBA, 0x11, 0xFD, 0x91, 0xA7, 0x8E, 0x68,
+    0x70, 0xFF, 0x08, 0xBF, 0x8E, 0x1A, 0xAC, 0x40, 0x2D, 0x8A, 0xEC, 0x53, 0x17, 0x6B, 0x56, 0x85,
+    0x9A, 0x64, 0x7B, 0xB2, 0xA7, 0x91, 0xEA, 0x3C, 0x6C, 0x36, 0xC3, 0x25, 0x20, 0x0B, 0x5E, 0xF3,
+    0xE5, 0xD5, 0xD1, 0x71, 0xF1, 0x8E, 0x60, 0x8E, 0x24, 0x6F, 0xC9, 0x7F, 0xC9, 0xAE, 0x0B, 0xAD,
+    0xC8, 0x0C, 0x93, 0x3D, 0x9D, 0xE0, 0x59, 0xC7, 0xF0, 0x14, 0x78, 0x42, 0x43, 0x95, 0x36, 0x0D,
+    0x0E, 0x69, 0x53, 0x67, 0x00, 0xFC, 0x88, 0x2F, 0xF9, 0xC8, 0x5F, 0x06, 0xB9, 0xED, 0x1F, 0xAD,
+    0x75, 0x24, 0x57, 0xF7, 0x77, 0x40, 0xEF, 0x32, 0x52, 0xB3, 0xC0, 0x38, 0xFF, 0x9C, 0xA9, 0x43,
+    0xA2, 0xA9, 0x4C, 0x0B, 0x72, 0x58, 0x07, 0xB0, 0x97, 0x12, 0x53, 0x11, 0xE1, 0xB6, 0x2F, 0x33,
+    0xF8, 0x4B, 0x9C, 0x5E, 0x45, 0xA2, 0x05, 0xEE, 0x34, 0xD7, 0x70, 0xCE, 0x4A, 0x42, 0xA0, 0x8D,
+    0x50, 0x27, 0xB2, 0xC2, 0xF7, 0x0D, 0x55, 0xCF, 0x07, 0xD7, 0x66, 0xDC, 0xC7, 0xD7, 0xE6, 0xA2,
+    0x9B, 0x50, 0x05, 0xB3, 0x75, 0x6D, 0x18, 0xA0, 0x06, 0x4A, 0xEA, 0x2A, 0x23, 0xB2, 0x10, 0x02,
+    0xDE, 0xD3, 0x00, 0x04, 0x3F, 0xAF, 0xE1, 0x5F, 0x47, 0xB1, 0x8E, 0xD4, 0x3B, 0xBC, 0xEC, 0x1E,
+    0x4F, 0x44, 0x1F, 0x75, 0xF4, 0xDF, 0x70, 0x94, 0x61, 0x9F, 0x4C, 0xA4, 0x4F, 0x03, 0xA9, 0x9F,
+    0x70, 0x18, 0xBE, 0x58, 0xCF, 0xFE, 0x15, 0x77, 0x19, 0x27, 0x8B, 0xDB, 0x87, 0x57, 0x3A, 0x11,
+    0xAA, 0x44, 0xB2, 0x4F, 0x12, 0x20, 0x36, 0x65, 0xB5, 0x39, 0x55, 0xCB, 0x07, 0xCF, 0x68, 0x83,
+    0x2B, 0xA8, 0xF3, 0x6A, 0x91, 0x16, 0xD6, 0x24, 0xE9, 0x43, 0x34, 0x7C, 0x9C, 0x55, 0x46, 0xDA,
+    0xF8, 0x07, 0xB9, 0x89, 0xB2, 0xBA, 0xA5, 0x0D, 0x72, 0xEE, 0xD0, 0x5E, 0xE5, 0x3B, 0xE7, 0x85,
+    0x8D, 0x34, 0xE7, 0x17, 0x23, 0x70, 0x98, 0xCC, 0xD0, 0xAF, 0xB8, 0x9A, 0xF7, 0x76, 0xB4, 0xF4,
+    0x73, 0x0E, 0x24, 0xA6, 0x3C, 0x9C, 0x54, 0x37, 0xC9, 0xA6, 0xD2, 0x7E, 0x6D, 0xE3, 0x7E, 0xED,
+    0xC2, 0xBA, 0x34, 0x68, 0x48, 0xFB, 0x75, 0xAF, 0x47, 0x93, 0xD6, 0x0C, 0x3A, 0x78, 0x46, 0x0F,
+    0x41, 0xBF, 0x2A, 0x64, 0xBF, 0x05, 0x9A, 0xF8, 0xCF, 0x0F, 0x40, 0x45, 0xC8, 0xD8, 0xB1, 0xA8,
+    0x6C, 0xC6, 0x16, 0x7D, 0xAD, 0x80, 0x3E, 0x4A, 0x00, 0x05, 0x02, 0xA6, 0xC5, 0xF6, 0x03, 0x99,
+    0xC9, 0x9C, 0x4F, 0xD2, 0x6B, 0xD5, 0x35, 0x12, 0x0D, 0x5D, 0x04, 0x94, 0x86, 0x37, 0x85, 0xBA,
+    0x0C, 0x66, 0xD2, 0x49, 0xC1, 0xAA, 0xEC, 0x2B, 0x83, 0xD6, 0xEE, 0xB2, 0x0A, 0x34, 0xEF, 0x97,
+    0x3D, 0xB5, 0xBD, 0x58, 0x64, 0xF3, 0x5F, 0x0E, 0xEF, 0x88, 0x07, 0x60, 0x2C, 0x3D, 0x0A, 0x6E,
+    0x31, 0x49, 0xFB, 0x77, 0xF6, 0xFA, 0x77, 0x56, 0xCB, 0x6D, 0x85, 0xC6, 0x4B, 0x4D, 0x86, 0x3C,
+    0xFA, 0x37, 0x60, 0xDB, 0x4B, 0x09, 0xCB, 0xC9, 0x84, 0x2E, 0x05, 0x33, 0xFA, 0xBD, 0xF4, 0x95,
+    0x1D, 0x32, 0x82, 0x75, 0xBA, 0xA5, 0x53, 0x57, 0xCA, 0x5A, 0x1C, 0x6B, 0xD5, 0x4C, 0x28, 0xD4,
+    0x74, 0x53, 0x90, 0xD5, 0x4D, 0xF9, 0xD0, 0x87, 0x84, 0x5E, 0xE4, 0x2A, 0x29, 0x49, 0x3C, 0xEC,
+    0xFD, 0x69, 0xBA, 0xE3, 0x5F, 0x40, 0x73, 0x51, 0x16, 0x6E, 0x20, 0x97, 0xEC, 0x5B, 0x84, 0xD0,
+    0x9E, 0x9D, 0x47, 0x54, 0x66, 0x3F, 0x00, 0xC2, 0x20, 0xE2, 0x1A, 0xCE, 0xDC, 0xA2, 0xFF, 0xC5,
+    0xF8, 0x03, 0xA5, 0x55, 0xBF, 0x6F, 0xDF, 0x44, 0x14, 0x7F, 0xF6, 0x91, 0xB8, 0xE1, 0x0B, 0x72,
+    0x07, 0x16, 0x52, 0x09, 0x77, 0x60, 0x40, 0x11, 0x89, 0x57, 0x86, 0x48, 0x67, 0xC8, 0x1F, 0x90,
+    0x0E, 0xFD, 0x4E, 0x5D, 0x3B, 0x55, 0x48, 0xC9, 0xD0, 0xA1, 0x42, 0x91, 0xCE, 0x52, 0x86, 0x0E,
+    0x0C, 0x44, 0x42, 0x82, 0xB5, 0x43, 0x87, 0x90, 0x0A, 0x35, 0x03, 0x03, 0x53, 0x6D, 0xE8, 0x90,
+    0x81, 0x21, 0x2E, 0x48, 0x64, 0x60, 0x88, 0xD5, 0xC0, 0x80, 0x32, 0xE4, 0x00, 0x17, 0x9C, 0xE4,
+    0xEC, 0xC7, 0xE7, 0x9D, 0xBF, 0x49, 0x41, 0x41, 0x59, 0xB8, 0xEF, 0xF9, 0xBD, 0xAF, 0xDF, 0xDD,
+    0xBD, 0xF7, 0xEE, 0xFD, 0xF8, 0x98, 0x68, 0x76, 0x83, 0x30, 0x52, 0x16, 0x16, 0x73, 0x0F, 0xAA,
+    0xAA, 0x95, 0x1C, 0x2C, 0xB2, 0xB2, 0x10, 0x74, 0x42, 0x29, 0x1E, 0xA8, 0xC8, 0x69, 0x3A, 0x93,
+    0x03, 0x2D, 0x15, 0x35, 0x69, 0x2E, 0x99, 0x33, 0xCD, 0x75, 0xC2, 0x36, 0xB5, 0xD7, 0xC3, 0xB0,
+    0x8F, 0xE5, 0x94, 0x7E, 0xDA, 0x8A, 0x82, 0x17, 0xFE, 0x6C, 0x5F, 0x08, 0xD5, 0x8F, 0x4B, 0x51,
+    0x70, 0x68, 0x69, 0x2E, 0x53, 0xC7, 0x1D, 0x25, 0x15, 0xF5, 0x26, 0x8F, 0x1A, 0x32, 0xCB, 0x16,
+    0x36, 0xD2, 0xEF, 0x3B, 0x32, 0x59, 0x62, 0x4D, 0xAD, 0x9B, 0xA4, 0x1D, 0x31, 0x86, 0xA3, 0x82,
+    0x8F, 0x40, 0x23, 0xAE, 0xB8, 0xA5, 0xC9, 0x08, 0x8F, 0x85, 0x72, 0x0F, 0x17, 0x92, 0x23, 0xA8,
+    0x0F, 0x7E, 0xBB, 0x55, 0x41, 0xF0, 0x84, 0xCE, 0x1D, 0x4E, 0xFC, 0x5F, 0x31, 0x46, 0x37, 0xF0,
+    0x5C, 0x6B, 0xA6, 0x7B, 0x1A, 0x41, 0x45, 0x17, 0xB2, 0x53, 0x6C, 0xF5, 0x33, 0xBA, 0x5A, 0xDC,
+    0x87, 0x3E, 0xE5, 0xC4, 0xAF, 0x74, 0xD7, 0x06, 0x37, 0xC2, 0x8E, 0x49, 0xE7, 0xE9, 0x4F, 0x56,
+    0xB5, 0xA1, 0x2B, 0x32, 0x9D, 0xEB, 0x1D, 0x37, 0xC2, 0x4F, 0x8B, 0x1B, 0x19, 0xB3, 0xE1, 0x3A,
+    0xE4, 0xAA, 0x68, 0xCE, 0x7C, 0xD8, 0xDA, 0x42, 0x1C, 0x14, 0x33, 0x8C, 0x84, 0x7B, 0x7B, 0x12,
+    0x8D, 0xF7, 0xC3, 0x33, 0x07, 0x71, 0x89, 0x3A, 0x74, 0x26, 0x07, 0xED, 0x4C, 0x1E, 0x5B, 0xFC,
+    0x2F, 0x85, 0x6A, 0x50, 0xF5, 0x92, 0x36, 0xCA, 0xA5, 0x55, 0xD2, 0xAA, 0x36, 0xA9, 0xB5, 0x8B,
+    0x9A, 0xD8, 0x82, 0xDA, 0x91, 0x35, 0xDD, 0xC8, 0x46, 0xED, 0x93, 0x3E, 0xAE, 0x95, 0x73, 0x9C,
+    0x54, 0x61, 0xE7, 0xCC, 0x4A, 0x49, 0xDC, 0x6A, 0xCE, 0xA9, 0x68, 0x12, 0x46, 0x20, 0x6D, 0x8C,
+    0x7B, 0x27, 0x75, 0xE4, 0x88, 0xA6, 0xC6, 0x63, 0x84, 0x80, 0xB9, 0x46, 0x64, 0x1F, 0x7F, 0x29,
+    0x37, 0xCE, 0xF3, 0xC1, 0x8D, 0xE9, 0x07, 0xE1, 0xC3, 0x60, 0xD3, 0x64, 0xBA, 0x4C, 0x77, 0x60,
+    0x0B, 0x36, 0x73, 0x5D, 0x22, 0x2D, 0xA1, 0x53, 0x2D, 0x64, 0x95, 0xFE, 0xC0, 0xA9, 0x3E, 0xB2,
+    0x71, 0x65, 0x6C, 0x41, 0x1C, 0x73, 0x5C, 0x45, 0xBF, 0x9F, 0xBE, 0x70, 0xA4, 0x8B, 0x84, 0xF3,
+    0x80, 0x6B, 0xB6, 0x14, 0xBB, 0x08, 0xD5, 0x60, 0x70, 0x6E, 0x50, 0x79, 0x0D, 0x25, 0x82, 0xAC,
+    0x44, 0xCC, 0x6D, 0xDC, 0x05, 0xDB, 0x29, 0xA2, 0x2D, 0x4B, 0x26, 0x97, 0x4B, 0x13, 0x15, 0x93,
+    0x47, 0xFE, 0x8B, 0x4C, 0xD6, 0x34, 0x1C, 0x4B, 0x10, 0x6B, 0xE4, 0xB3, 0x0A, 0xF1, 0xA0, 0xCC,
+    0x90, 0xAD, 0xF4, 0x3F, 0x9F, 0xA0, 0xA8, 0x47, 0xEC, 0x52, 0x76, 0xA6, 0xBA, 0x0D, 0x3D, 0xB8,
+    0xE9, 0xF9, 0xC4, 0xAB, 0x29, 0x51, 0x6B, 0x36, 0x66, 0x1B, 0xC0, 0xB3, 0xD1, 0x85, 0x49, 0x57,
+    0x60, 0x24, 0x9B, 0x51, 0xA5, 0x7A, 0x0E, 0x23, 0xD6, 0x57, 0xAD, 0x69, 0x68, 0x71, 0xE1, 0xEE,
+    0x3C, 0x25, 0xFB, 0x5E, 0xC3, 0xA8, 0x25, 0xB5, 0x5F, 0x85, 0xF5, 0x36, 0x61, 0xFB, 0xDB, 0x74,
+    0x3E, 0x16, 0x0C, 0x9F, 0x72, 0x77, 0x4F, 0x52, 0x57, 0x16, 0xBC, 0xC3, 0xC5, 0x5B, 0xF9, 0xE2,
+    0x42, 0xF2, 0x5D, 0xD5, 0xC4, 0x19, 0xCD, 0xA7, 0xDF, 0xD8, 0xB5, 0xAF, 0x71, 0x87, 0x2A, 0xE2,
+    0x5F, 0x7B, 0xE6, 0x5C, 0x4A, 0xE6, 0xCD, 0xE1, 0xDC, 0xC8, 0x0D, 0xBC, 0xDA, 0xF6, 0xEC, 0x95,
+    0xC0, 0x53, 0x3C, 0x53, 0x48, 0x86, 0xD4, 0x57, 0x4F, 0xC1, 0x33, 0xDC, 0xEC, 0xAB, 0x55, 0x7A,
+    0x63, 0xEA, 0x6C, 0xFD, 0x92, 0x91, 0xF8, 0xEA, 0xE5, 0xA5, 0xCF, 0x25, 0x83, 0xF3, 0x1F, 0x5E,
+    0xBF, 0x22, 0x95, 0x46, 0xF9, 0xE5, 0x87, 0x22, 0x04, 0x38, 0x80, 0xB1, 0x43, 0x04, 0xFB, 0x23,
+    0x4B, 0xEF, 0xCC, 0x10, 0xCD, 0xA8, 0xEC, 0xE5, 0x7A, 0x38, 0xA9, 0x59, 0x09, 0x3B, 0xC6, 0x6B,
+    0xD1, 0xBF, 0x8F, 0x4F, 0x0D, 0xEC, 0xF5, 0x81, 0xBD, 0x3B, 0xB0, 0x45, 0x21, 0xAB, 0xB4, 0x26,
+    0xEC, 0x1E, 0xDD, 0xA6, 0x28, 0xF3, 0xA2, 0xC2, 0xB7, 0x96, 0x28, 0x14, 0x2C, 0xB8, 0xDC, 0x2F,
+    0x69, 0x4F, 0x8A, 0x2A, 0x49, 0x2C, 0x45, 0x7D, 0xE0, 0x11, 0x66, 0xF6, 0xD2, 0x13, 0xD2, 0x3F,
+    0x08, 0x64, 0x02, 0xBD, 0xCD, 0xD0, 0xCE, 0x6B, 0x14, 0xD4, 0x34, 0x3F, 0x38, 0xB5, 0x38, 0xB8,
+    0xB8, 0x38, 0xEC, 0xBD, 0x3B, 0xB0, 0x55, 0x29, 0xF3, 0x8D, 0xF0, 0x01, 0x05, 0x2E, 0x44, 0x2E,
+    0xF4, 0x8F, 0xA8, 0xD6, 0xC8, 0x03, 0xD8, 0xEC, 0xE6, 0x44, 0xEB, 0xA8, 0xA6, 0xA4, 0x51, 0x2D,
+    0xA1, 0x63, 0x04, 0x04, 0xD0, 0xD9, 0x8A, 0x2B, 0xF4, 0x16, 0x43, 0x18, 0x74, 0x22, 0x64, 0x0D,
+    0x61, 0x11, 0x43, 0x68, 0xD6, 0x1B, 0x69, 0x0D, 0x08, 0xD1, 0x1D, 0x99, 0xFE, 0xA4, 0x86, 0xF0,
+    0xD0, 0xAA, 0x46, 0x01, 0x7C, 0x3A, 0x02, 0x0E, 0xE9, 0xB1, 0xEE, 0x80, 0x90, 0xBB, 0x3D, 0x5A,
+    0xFF, 0x0F, 0x29, 0x4C, 0x0F, 0x4A, 0x1E, 0xE2, 0x8C, 0x47, 0x38, 0x0F, 0x70, 0xB5, 0x98, 0x9D,
+    0x44, 0x7D, 0x3A, 0x0F, 0x37, 0x28, 0xCD, 0xD3, 0x92, 0xCC, 0x67, 0xD8, 0x57, 0x48, 0x9F, 0xAE,
+    0x4C, 0xA0, 0x2C, 0x7C, 0x48, 0x77, 0x72, 0x71, 0x05, 0xC8, 0xA3, 0x1D, 0xF5, 0xA8, 0x6B, 0xD5,
+    0xC6, 0x5C, 0xC6, 0x35, 0x1B, 0xD2, 0xF7, 0xD1, 0x8A, 0x9D, 0xFE, 0xD8, 0xAA, 0xBF, 0x5C, 0x5A,
+    0xC6, 0xC0, 0x1E, 0xD2, 0x3D, 0x2E, 0xC9, 0x76, 0x74, 0xF2, 0x29, 0x67, 0x29, 0x2F, 0x03, 0x7D,
+    0xA5, 0xFE, 0x94, 0x14, 0x8D, 0x04, 0xCD, 0xFB, 0xA1, 0xC4, 0x6E, 0x52, 0x8E, 0x86, 0xCE, 0x94,
+    0x58, 0x24, 0x70, 0x12, 0xE8, 0xE5, 0x7D, 0x63, 0xC1, 0xAC, 0x3E, 0x8B, 0x81, 0x5B, 0x00, 0xB6,
+    0x92, 0x03, 0x5E, 0x82, 0xDD, 0x09, 0x1E, 0xD5, 0xF2, 0x8A, 0xEE, 0x1E, 0x56, 0x7F, 0xF6, 0xF7,
+    0xD0, 0x39, 0x4D, 0xF1, 0x18, 0x7D, 0x87, 0xEB, 0x73, 0x23, 0xAF, 0x08, 0x18, 0x21, 0x9C, 0x67,
+    0xAB, 0x84, 0x55, 0xC0, 0x60, 0x8D, 0x43, 0x56, 0xE7, 0xA6, 0xEA, 0xC9, 0x2C, 0x21, 0xAE, 0xF1,
+    0x49, 0x61, 0xB5, 0x07, 0xCE, 0x1A, 0x77, 0xDE, 0xD0, 0xDC, 0x63, 0xC3, 0x41, 0x77, 0xCB, 0x31,
+    0x15, 0xA6, 0x4C, 0x8E, 0xEC, 0xDE, 0xA9, 0x2B, 0x3A, 0x5E, 0x61, 0x6C, 0x5A, 0x66, 0x5E, 0xEF,
+    0x1F, 0x59, 0xA6, 0xF7, 0xE0, 0x22, 0xBE, 0x1D, 0xCA, 0x79, 0x47, 0xC5, 0xDF, 0xB9, 0xA8, 0x55,
+    0x7F, 0xB2, 0x68, 0x5A, 0xEF, 0x23, 0xF8, 0x98, 0xFE, 0x00, 0x77, 0x75, 0x1E, 0x1F, 0xB4, 0x60,
+    0xDF, 0xEE, 0x1F, 0x38, 0xD3, 0xE9, 0xE7, 0xFC, 0x14, 0x4E, 0x63, 0x8B, 0x3A, 0xE6, 0x06, 0x6B,
+    0xEB, 0x2D, 0x5D, 0x85, 0x63, 0xE2, 0xE3, 0x84, 0x11, 0xDD, 0xF1, 0xF9, 0x91, 0x59, 0xF0, 0xD9,
+    0x18, 0x8F, 0xFF, 0x89, 0x2F, 0x97, 0x4F, 0xA2, 0x9B, 0xF2, 0x69, 0x49, 0x90, 0xC5, 0xB9, 0x47,
+    0x8E, 0x91, 0x7B, 0xDE, 0xAD, 0x45, 0x7D, 0x2F, 0x06, 0xE2, 0x8B, 0x7F, 0x3D, 0xDC, 0x31, 0x77,
+    0xB1, 0xB0, 0xF1, 0x4D, 0xF9, 0x22, 0x42, 0x0D, 0x58, 0xC0, 0xE3, 0xCC, 0x78, 0x04, 0x2D, 0x57,
+    0x4E, 0x36, 0x27, 0xC2, 0x8B, 0xEC, 0xD5, 0xAD, 0x2F, 0x12, 0xEE, 0x65, 0xFE, 0x32, 0xC6, 0x67,
+    0x12, 0xD3, 0xEB, 0xAB, 0x41, 0x87, 0xD7, 0xF3, 0xF9, 0xFF, 0xC7, 0xDF, 0xAD, 0x55, 0x31, 0x6F,
+    0xE5, 0x44, 0x10, 0x9E, 0xE7, 0x25, 0xB1, 0x14, 0x17, 0x4B, 0x73, 0x0D, 0x8D, 0x1B, 0xAA, 0x2B,
+    0x70, 0x4D, 0xB5, 0x0E, 0x7F, 0xE0, 0x21, 0x41, 0x74, 0x65, 0x7E, 0xC2, 0xFD, 0x03, 0x6C, 0xEE,
+    0x0A, 0x2A, 0x74, 0xA9, 0x68, 0x0F, 0x09, 0x8A, 0xD3, 0xE3, 0x0F, 0xD0, 0xC0, 0xEE, 0xDD, 0x93,
+    0x48, 0x91, 0x22, 0x4F, 0x3A, 0xA5, 0x3E, 0x4B, 0x01, 0x21, 0xD1, 0x64, 0x93, 0x38, 0xA7, 0x95,
+    0x58, 0xEF, 0xF0, 0xCD, 0x3A, 0x89, 0xDE, 0x21, 0x68, 0x10, 0x96, 0xC6, 0xB2, 0x67, 0x77, 0x67,
+    0xBE, 0x99, 0xF9, 0x66, 0xD6, 0xF2, 0x44, 0x7C, 0x27, 0x07, 0x9F, 0x13, 0x13, 0xBD, 0x2B, 0xFC,
+    0x2B, 0x84, 0x45, 0x1C, 0x7F, 0xC3, 0x9E, 0xA9, 0x1E, 0x99, 0xCA, 0xC8, 0xA4, 0x20, 0xC5, 0xBD,
+    0x10, 0xFE, 0x89, 0xAA, 0x40, 0x9F, 0x36, 0x9E, 0x3A, 0x1E, 0x20, 0x8E, 0xBA, 0x89, 0xE4, 0x79,
+    0xB8, 0x7A, 0xA1, 0x70, 0xDC, 0x70, 0x54, 0xD3, 0x41, 0x6B, 0x7A, 0x52, 0x81, 0xC8, 0x70, 0x0F,
+    0x65, 0x6F, 0x38, 0xA9, 0xE9, 0xF1, 0x68, 0xFA, 0x6E, 0x1D, 0x8A, 0x68, 0xFA, 0x7A, 0x1D, 0x16,
+    0x30, 0xD4, 0x38, 0xB1, 0xD7, 0xDA, 0x5E, 0xB3, 0x27, 0x40, 0xAB, 0x52, 0xB6, 0xD4, 0xB5, 0x7A,
+    0xA3, 0xB0, 0x8F, 0x12, 0xD9, 0x56, 0x7B, 0x3D, 0x68, 0x38, 0x6A, 0x13, 0xB6, 0x16, 0x51, 0x0F,
+    0x96, 0x48, 0xFB, 0x54, 0x6F, 0x60, 0x7C, 0x79, 0x0E, 0x23, 0x45, 0x4C, 0x50, 0x91, 0x66, 0x86,
+    0x8A, 0x52, 0x12, 0x1B, 0xE6, 0xF4, 0xF7, 0x11, 0x38, 0xC7, 0x64, 0x1C, 0x2D, 0x92, 0x1E, 0x10,
+    0xA3, 0x71, 0xA9, 0x1C, 0xA1, 0xD2, 0x83, 0x39, 0xDB, 0x4F, 0x30, 0xCD, 0xD1, 0x38, 0x3D, 0x94,
+    0x7C, 0x32, 0xE2, 0xC7, 0xC4, 0xEC, 0xB9, 0x76, 0xF2, 0x5E, 0xFC, 0xEB, 0x0F, 0xD1, 0xDE, 0xD1,
+    0xDE, 0xB7, 0xBB, 0xDF, 0x17, 0x93, 0x8A, 0x65, 0x84, 0x4D, 0x06, 0x28, 0x15, 0xCC, 0x2B, 0xA4,
+    0xA0, 0x5B, 0x5E, 0xE2, 0x5D, 0x5D, 0xC7, 0x94, 0x13, 0x2A, 0x69, 0x35, 0xC8, 0x87, 0x80, 0xB9,
+    0x96, 0x58, 0x5F, 0xC7, 0xAE, 0xA7, 0x7A, 0xE0, 0x6A, 0x04, 0x7E, 0x9C, 0x8C, 0x88, 0xCC, 0x6B,
+    0xFC, 0xAA, 0xB8, 0xE0, 0x6C, 0xBD, 0xF4, 0x5B, 0x0E, 0xBB, 0x2D, 0xB7, 0x79, 0x61, 0x97, 0x47,
+    0xC4, 0xF8, 0x92, 0x39, 0x7C, 0x5C, 0xE4, 0x78, 0x60, 0x86, 0xCA, 0xB0, 0x6B, 0x43, 0xC1, 0x23,
+    0x59, 0xEE, 0x77, 0x0E, 0x71, 0xD2, 0xB6, 0x84, 0xD4, 0x54, 0x6F, 0x5B, 0x14, 0x8F, 0x19, 0x00,
+    0x4A, 0xE4, 0x95, 0x7E, 0x44, 0x7E, 0x7A, 0x2A, 0x3C, 0xED, 0x00, 0x2E, 0xF0, 0x7D, 0x21, 0xE6,
+    0x8E, 0x0C, 0x87, 0x86, 0xA7, 0xF7, 0x16, 0x50, 0x4C, 0x8B, 0x47, 0x51, 0xF1, 0xA0, 0x38, 0xD0,
+    0x2E, 0xF6, 0xF3, 0xFB, 0xC4, 0xE6, 0x87, 0x84, 0x5A, 0x36, 0x28, 0xF2, 0x47, 0xF9, 0x74, 0xE5,
+    0xE8, 0xD0, 0x11, 0xF7, 0xF4, 0x13, 0x59, 0xAA, 0x10, 0x01, 0x72, 0xE9, 0xCB, 0xA0, 0x22, 0x52,
+    0x20, 0x69, 0x90, 0x24, 0xE8, 0xCB, 0x94, 0x19, 0x43, 0x12, 0xBE, 0xB9, 0x18, 0x48, 0x5F, 0x4F,
+    0x50, 0x00, 0x2B, 0x97, 0x01, 0x90, 0x73, 0x39, 0x6F, 0x3E, 0x43, 0xC0, 0x13, 0x53, 0xC3, 0x9D,
+    0x53, 0x52, 0x34, 0xD4, 0x85, 0x16, 0x53, 0x2E, 0x3C, 0x09, 0xFA, 0xAC, 0x00, 0xA1, 0xDA, 0x0F,
+    0x8E, 0x4C, 0x6F, 0x9C, 0xE9, 0x99, 0xCC, 0x93, 0x89, 0xCC, 0x57, 0x30, 0xF1, 0x7C, 0x20, 0x63,
+    0xDD, 0x2C, 0xCF, 0xFD, 0xAC, 0x7B, 0x82, 0xFA, 0xF5, 0x28, 0x67, 0x6F, 0x84, 0x5A, 0x71, 0x4E,
+    0xE1, 0xB6, 0x50, 0xB4, 0x40, 0x02, 0x98, 0xCB, 0xAB, 0x93, 0x60, 0x4E, 0x3A, 0xC7, 0x0D, 0x50,
+    0xDB, 0x8D, 0xBE, 0xC2, 0xC9, 0x53, 0x2F, 0x68, 0x15, 0x78, 0x23, 0x60, 0xCD, 0x09, 0xB6, 0x35,
+    0x88, 0xCA, 0x8E, 0xFA, 0xEA, 0x8D, 0x37, 0xBF, 0xD4, 0x68, 0x86, 0x06, 0x3C, 0x33, 0x1B, 0xC1,
+    0x93, 0x3E, 0x64, 0x15, 0x2E, 0xBC, 0x3E, 0xE7, 0xD6, 0x3C, 0x0B, 0x94, 0xBA, 0x5E, 0xFD, 0x19,
+    0x49, 0x5F, 0xF8, 0x8C, 0x26, 0x99, 0x41, 0x05, 0x1E, 0xF4, 0xB9, 0xDD, 0x98, 0xAF, 0x41, 0x38,
+    0xEA, 0x5C, 0xE3, 0xC0, 0x59, 0x0F, 0x0E, 0xA2, 0xB1, 0x14, 0x7B, 0xDB, 0x32, 0x68, 0x20, 0xF5,
+    0x57, 0xB1, 0xD9, 0xC0, 0x31, 0xC2, 0x01, 0xF7, 0x35, 0x23, 0x6F, 0x53, 0x27, 0x69, 0xCA, 0xAC,
+    0xEA, 0x85, 0x1B, 0xC2, 0x0B, 0x74, 0xA7, 0x19, 0x64, 0x33, 0x6A, 0x6D, 0x1D, 0x5E, 0x52, 0x74,
+    0x12, 0xAA, 0x8B, 0x1C, 0xDE, 0xB4, 0xF8, 0x2F, 0x5E, 0x64, 0x26, 0xF9, 0x66, 0xA3, 0x3D, 0x5A,
+    0xE9, 0x32, 0xE5, 0x58, 0x75, 0x36, 0x3B, 0xCE, 0xDF, 0x97, 0x4C, 0x79, 0xCD, 0x37, 0x03, 0x76,
+    0x8E, 0x62, 0x1B, 0x1E, 0x11, 0x05, 0x82, 0xC5, 0xC6, 0x6A, 0x7C, 0xD0, 0x39, 0xB0, 0x33, 0xB3,
+    0x59, 0xAA, 0xA5, 0xAF, 0x50, 0x0E, 0xF3, 0x66, 0x98, 0x0B, 0xA9, 0x84, 0x42, 0x62, 0x87, 0xCC,
+    0x31, 0x7A, 0x5A, 0x18, 0x9C, 0x01, 0x69, 0x5F, 0x23, 0x6E, 0xD7, 0x0C, 0x82, 0x72, 0x23, 0x14,
+    0x70, 0xAB, 0x15, 0x3D, 0x5C, 0x32, 0xC0, 0x30, 0xA3, 0x7F, 0x2B, 0x8F, 0x8A, 0x5A, 0x0D, 0x3E,
+    0x5E, 0xE3, 0x9C, 0x85, 0xA9, 0x0A, 0xA8, 0xC8, 0xC2, 0x43, 0xE5, 0xC1, 0x3A, 0x2B, 0x1D, 0x09,
+    0xDC, 0x20, 0x14, 0xE3, 0x03, 0x49, 0x47, 0x33, 0xC1, 0x8E, 0x44, 0x03, 0x63, 0x42, 0x1B, 0x92,
+    0x11, 0xB4, 0xA5, 0xBA, 0x9D, 0x52, 0x20, 0x2B, 0xC3, 0xCD, 0xCD, 0x41, 0xF7, 0x0F, 0xBB, 0xCE,
+    0x44, 0x95, 0xA0, 0x62, 0xA9, 0x0D, 0x52, 0x0C, 0xE0, 0xBD, 0xCC, 0x06, 0x88, 0x0C, 0x25, 0xD2,
+    0xF7, 0x2A, 0x90, 0x6C, 0xEF, 0x48, 0xA3, 0x6A, 0xD0, 0xCB, 0x50, 0x00, 0x87, 0x7A, 0xCC, 0x9B,
+    0x9B, 0x47, 0x01, 0x0E, 0x92, 0x78, 0xEA, 0xCD, 0xD9, 0xE1, 0xB0, 0xBD, 0xE3, 0x0F, 0xEC, 0xE0,
+    0x53, 0xB4, 0x8A, 0xBF, 0x25, 0x57, 0x77, 0xDB, 0xA7, 0x65, 0x56, 0xD8, 0x3B, 0xB7, 0x58, 0xCF,
+    0xFD, 0xCF, 0x07, 0xFF, 0x21, 0x84, 0xBF, 0xA9, 0x04, 0xE6, 0xEA, 0xBB, 0x80, 0x63, 0xE2, 0xFC,
+    0x3A, 0x64, 0xA4, 0x00, 0x35, 0x1D, 0x24, 0x71, 0x32, 0x64, 0xB0, 0x02, 0x54, 0xDD, 0x2F, 0xBD,
+    0xF3, 0x61, 0x85, 0x68, 0xB2, 0x33, 0xE6, 0x41, 0x29, 0x35, 0x9D, 0xE0, 0x57, 0x86, 0xBF, 0xF0,
+    0x49, 0x08, 0x96, 0x99, 0xC5, 0x79, 0xC0, 0x9B, 0x79, 0x81, 0x53, 0x8B, 0x05, 0x96, 0x41, 0x25,
+    0x78, 0xD7, 0x58, 0xF8, 0xCD, 0x46, 0x39, 0xB1, 0xE0, 0x7C, 0xA2, 0xBE, 0x90, 0x13, 0x8A, 0xF3,
+    0x09, 0xCE, 0xA6, 0x0C, 0xBB, 0x19, 0xB0, 0x4C, 0x2D, 0x49, 0x35, 0x1C, 0xE1, 0xB5, 0x53, 0xCA,
+    0x38, 0x2C, 0x98, 0xD1, 0xE0, 0x32, 0xAA, 0xF0, 0x6E, 0xF2, 0xF7, 0x7C, 0x71, 0xAC, 0xFA, 0x39,
+    0x5F, 0x2A, 0x03, 0x4C, 0x02, 0x43, 0x1A, 0x1F, 0x75, 0x82, 0x25, 0x64, 0x1E, 0xB7, 0x93, 0xD4,
+    0x02, 0x93, 0x00, 0x13, 0x09, 0xCA, 0xB7, 0xFC, 0x34, 0x08, 0x03, 0xA1, 0x5C, 0x48, 0xDB, 0xBB,
+    0x6E, 0x29, 0xBC, 0x96, 0xF9, 0x9F, 0x47, 0x87, 0x5C, 0x54, 0x8B, 0x62, 0xBE, 0xD8, 0x5A, 0x89,
+    0xBB, 0x15, 0xE6, 0xDD, 0xF9, 0xA3, 0x3C, 0x4C, 0x1D, 0xE0, 0xC4, 0x19, 0x4C, 0x3D, 0x66, 0x98,
+    0x3F, 0x23, 0x5C, 0x93, 0xCA, 0x80, 0xAE, 0xC1, 0x6D, 0xD3, 0x9C, 0x8C, 0xF5, 0xCB, 0x68, 0xF7,
+    0x63, 0x7D, 0x2C, 0x1F, 0xDD, 0x97, 0xB1, 0x5E, 0x47, 0xFD, 0x3A, 0x98, 0xC1, 0x76, 0xFB, 0xFC,
+    0x94, 0x87, 0x4A, 0xC0, 0x36, 0x92, 0xF8, 0x2E, 0x67, 0x77, 0x77, 0xBE, 0xBC, 0x16, 0xB6, 0x87,
+    0x16, 0xC6, 0x03, 0xE9, 0xF1, 0x41, 0x6B, 0x3F, 0xE1, 0x57, 0xB1, 0xE6, 0x67, 0x3E, 0x75, 0x66,
+    0xED, 0x23, 0xEB, 0xF5, 0x55, 0x6C, 0x96, 0xC7, 0xB1, 0x4B, 0x12, 0x31, 0x24, 0x54, 0xF9, 0xF4,
+    0xE3, 0x6D, 0x74, 0xFF, 0xFB, 0xF3, 0x17, 0xCD, 0x54, 0x31, 0x8F, 0xD5, 0x46, 0x10, 0xFE, 0x6C,
+    0xEB, 0xB0, 0x74, 0x2E, 0xB6, 0x4C, 0xA4, 0x14, 0x6E, 0x52, 0xD1, 0xF8, 0x1F, 0xC4, 0x46, 0xFC,
+    0x80, 0x50, 0xE4, 0x29, 0x25, 0xA9, 0xAF, 0xB9, 0x9F, 0x60, 0x03, 0x05, 0x45, 0x8A, 0x5C, 0x9F,
+    0x86, 0xA4, 0x4A, 0xAE, 0xE1, 0x17, 0x84, 0x5D, 0x1D, 0x25, 0x05, 0x96, 0x9E, 0xAE, 0xB7, 0x22,
+    0xA4, 0x48, 0x50, 0x60, 0xD0, 0x03, 0x9C, 0xE0, 0xDD, 0xC9, 0x37, 0xEB, 0x77, 0xE1, 0x25, 0x77,
+    0x40, 0x22, 0xA4, 0x88, 0xD5, 0xDB, 0x9D, 0xF5, 0xBE, 0xD9, 0xD9, 0x99, 0x6F, 0xBE, 0x19, 0x80,
+    0xA3, 0x0D, 0x4D, 0x29, 0x92, 0x88, 0x4C, 0xC6, 0xA7, 0xBD, 0xED, 0x90, 0xCD, 0x40, 0x39, 0x00,
+    0xB6, 0x41, 0xEA, 0x81, 0x62, 0x03, 0x54, 0x3D, 0xF5, 0x3A, 0x40, 0x80, 0x2C, 0x00, 0x79, 0xC0,
+    0xE7, 0x46, 0x64, 0x28, 0x44, 0xBA, 0x5C, 0x26, 0x80, 0x3F, 0x50, 0x2D, 0xE3, 0xAD, 0xBB, 0x0E,
+    0x99, 0xDE, 0x3A, 0xA2, 0x81, 0x47, 0x85, 0xCC, 0xA5, 0x4C, 0xF5, 0xF0, 0x0D, 0x2F, 0xDB, 0x78,
+    0x7D, 0xF9, 0xD1, 0x74, 0xEB, 0x3E, 0xAD, 0x65, 0x36, 0x32, 0xA7, 0xB2, 0x41, 0x05, 0x98, 0x0E,
+    0x85, 0xC3, 0x75, 0x07, 0xE9, 0x70, 0x0F, 0xAD, 0xC8, 0x6B, 0x11, 0xB1, 0x22, 0xCF, 0xBE, 0xF6,
+    0x2B, 0x54, 0x0E, 0x29, 0xBD, 0x7A, 0xA7, 0x38, 0x45, 0x2A, 0x33, 0x2A, 0x71, 0x2A, 0x50, 0xBB,
+    0x18, 0xC7, 0x1B, 0x01, 0x1C, 0x1C, 0x1F, 0xDF, 0x16, 0xF1, 0x34, 0xDD, 0x67, 0x17, 0x69, 0x9C,
+    0x89, 0x70, 0x07, 0xB5, 0x20, 0x93, 0x91, 0x9F, 0x8C, 0x69, 0x57, 0xD8, 0x26, 0xF5, 0xAD, 0xCB,
+    0xE6, 0xAA, 0x2F, 0x36, 0x66, 0x34, 0x63, 0xB1, 0xA9, 0x68, 0xAB, 0x76, 0xA9, 0xD7, 0xE8, 0x88,
+    0x8C, 0x55, 0x1B, 0x44, 0xA3, 0xA4, 0xBA, 0x79, 0xFB, 0x3C, 0xC6, 0xFE, 0x8F, 0x01, 0xF5, 0xFD,
+    0x39, 0x09, 0x6A, 0xA6, 0x1C, 0xEA, 0xAE, 0x3E, 0xF1, 0xB0, 0x5F, 0x8E, 0x08, 0x75, 0x97, 0xF9,
+    0x19, 0xF9, 0xEB, 0x11, 0x46, 0x1A, 0x54, 0x34, 0xD8, 0x0E, 0x11, 0x34, 0x8D, 0xB2, 0x18, 0x63,
+    0xC0, 0x0A, 0xE6, 0xF6, 0xF3, 0xBF, 0xB8, 0xB4, 0x77, 0xF8, 0xE2, 0x9A, 0xE6, 0x4D, 0xE7, 0xFE,
+    0xDD, 0x3F, 0x8E, 0x3E, 0xD4, 0x25, 0x25, 0x4D, 0xBE, 0xD8, 0x6B, 0x76, 0x5C, 0x62, 0xB2, 0x05,
+    0xD2, 0x90, 0x38, 0x42, 0x40, 0x93, 0x40, 0x60, 0xB3, 0x99, 0x8C, 0xCA, 0x66, 0x46, 0x51, 0x28,
+    0xAE, 0x86, 0x49, 0x46, 0x49, 0x6D, 0x58, 0x7E, 0x65, 0x42, 0x6B, 0xF5, 0xD3, 0x1E, 0x89, 0x27,
+    0xFE, 0x66, 0x8C, 0x64, 0x91, 0x55, 0x3E, 0x41, 0x34, 0x10, 0x79, 0xEE, 0xA9, 0xA2, 0x19, 0xE4,
+    0x13, 0xF1, 0x8D, 0x08, 0x43, 0xC4, 0x21, 0x1E, 0x01, 0x97, 0xBB, 0xFD, 0x3B, 0x75, 0x5F, 0x0D,
+    0xBC, 0xEB, 0xF2, 0x89, 0xC9, 0x0B, 0x0C, 0x5C, 0x69, 0xA0, 0xE6, 0xDB, 0x31, 0xEE, 0xF5, 0x4C,
+    0xFF, 0xA3, 0x8E, 0xA7, 0x6E, 0x68, 0x9D, 0xA1, 0x12, 0xFE, 0x39, 0x95, 0x1F, 0xBF, 0x92, 0x94,
+    0x22, 0xDF, 0x8E, 0xE4, 0x77, 0xA8, 0xDC, 0xDE, 0xF5, 0x17, 0xD7, 0xAC, 0x52, 0x43, 0x9F, 0x16,
+    0x7D, 0x9B, 0x01, 0x55, 0xEA, 0x28, 0xFE, 0xF5, 0xF1, 0x29, 0x43, 0xE6, 0x20, 0xB1, 0x84, 0xAE,
+    0xE8, 0x56, 0x23, 0x58, 0x78, 0xA9, 0xB9, 0x45, 0x64, 0xDF, 0x92, 0x8C, 0xB3, 0x63, 0x12, 0xF6,
+    0xA7, 0x03, 0x56, 0xC2, 0x6C, 0x97, 0x25, 0x09, 0x34, 0x9C, 0xF8, 0xF7, 0x2F, 0xB4, 0xFE, 0xB3,
+    0x2E, 0x3E, 0x2E, 0x6A, 0xE9, 0xC2, 0xC5, 0x12, 0x4B, 0x3A, 0x49, 0xCA, 0x8C, 0x7C, 0x91, 0x9E,
+    0x0B, 0x2F, 0x67, 0xE7, 0x8E, 0xDC, 0x67, 0xB3, 0xDA, 0x19, 0x15, 0x12, 0x97, 0xC8, 0xEF, 0x72,
+    0xE6, 0x6C, 0xF4, 0xB5, 0x3E, 0xC5, 0x42, 0xB3, 0x4C, 0xFB, 0x80, 0xD1, 0x4C, 0xA2, 0xEE, 0xB6,
+    0x58, 0x66, 0xDA, 0x17, 0xCC, 0x5F, 0x47, 0x38, 0xC0, 0xFE, 0x51, 0xE5, 0xF2, 0x4D, 0x31, 0x26,
+    0x9E, 0xCF, 0xB4, 0x8D, 0x45, 0xD9, 0x97, 0x3C, 0xC8, 0xA7, 0x4B, 0x5E, 0x51, 0xD1, 0x4E, 0xD4,
+    0xE3, 0xDE, 0x6D, 0xF6, 0x92, 0x44, 0x9D, 0x6C, 0x1F, 0x93, 0x26, 0x4C, 0x7D, 0xAE, 0x70, 0xC5,
+    0xCC, 0xDB, 0x6D, 0xE2, 0x95, 0x01, 0xC9, 0xD4, 0x36, 0xC9, 0xDC, 0x6A, 0x01, 0xEC, 0xCE, 0xAB,
+    0x27, 0xCB, 0xBC, 0xC5, 0xB9, 0x7E, 0xE0, 0x09, 0xB9, 0xA7, 0x59, 0x7F, 0x49, 0x5E, 0x92, 0x47,
+    0x27, 0x3B, 0xF3, 0x26, 0x9F, 0x48, 0xE3, 0xA4, 0x63, 0xDF, 0x93, 0xE7, 0x16, 0xE6, 0x89, 0x0A,
+    0x43, 0x31, 0x06, 0xFB, 0x5D, 0xFB, 0x9B, 0x12, 0x80, 0x04, 0x3F, 0x1C, 0x03, 0x0C, 0x03, 0xA1,
+    0xD8, 0xD3, 0x78, 0xA8, 0x19, 0x31, 0x50, 0x08, 0x34, 0x59, 0xB2, 0xFD, 0x7C, 0x66, 0x37, 0x7C,
+    0x6E, 0x62, 0x24, 0xAF, 0xE4, 0xA8, 0x7D, 0x4A, 0x10, 0xE9, 0xBC, 0x68, 0x33, 0x21, 0xA8, 0xF2,
+    0xF7, 0xCF, 0x91, 0x98, 0x28, 0x40, 0xBB, 0xA2, 0xED, 0x6A, 0x2B, 0x57, 0x49, 0x91, 0x7A, 0xD3,
+    0xAE, 0xE7, 0x94, 0xE5, 0x50, 0xAE, 0x27, 0x56, 0x45, 0x77, 0xB1, 0xE8, 0xB1, 0x0C, 0x66, 0x05,
+    0xB1, 0x18, 0xA1, 0x04, 0x1B, 0x60, 0x98, 0xF9, 0x2B, 0x57, 0x02, 0x7D, 0xFA, 0x85, 0xDE, 0x95,
+    0x0F, 0xD7, 0x33, 0xE1, 0x54, 0xD2, 0xC9, 0x13, 0x5D, 0x34, 0x24, 0xAA, 0x7D, 0xE2, 0x57, 0xAB,
+    0xAF, 0x16, 0xAE, 0x2D, 0xE4, 0xD3, 0xA6, 0xC5, 0xD2, 0xED, 0x13, 0x16, 0x8B, 0x26, 0x5B, 0x39,
+    0xAB, 0x8D, 0x43, 0x97, 0x65, 0x1C, 0x3E, 0xD2, 0x17, 0x06, 0xFD, 0xE3, 0xC6, 0x0F, 0x21, 0x9D,
+    0xBF, 0xA8, 0x9C, 0x59, 0xBF, 0xF2, 0xAB, 0xA0, 0xBC, 0x1E, 0xD8, 0xAD, 0x43, 0xB4, 0x17, 0xCD,
+    0xB1, 0xE0, 0x1B, 0xC8, 0xE3, 0x68, 0xCB, 0xB1, 0xEC, 0x37, 0xD8, 0x19, 0xFF, 0x87, 0xC7, 0x11,
+    0x9E, 0x48, 0xA3, 0x73, 0xDB, 0x37, 0xD1, 0x54, 0x7C, 0xBC, 0xB8, 0x30, 0x1A, 0x79, 0x5F, 0x34,
+    0xA6, 0xDF, 0x96, 0xD2, 0xEE, 0xA6, 0x96, 0x87, 0xF2, 0x5C, 0xD8, 0x89, 0x79, 0x4B, 0xBB, 0xDF,
+    0xF9, 0x0D, 0xBB, 0x0F, 0x75, 0x46, 0x7C, 0x04, 0xE3, 0x4F, 0x9D, 0x55, 0x31, 0x6F, 0x1D, 0x45,
+    0x10, 0x9E, 0xBB, 0x93, 0x39, 0x91, 0x2B, 0x16, 0x21, 0xA7, 0x21, 0xC5, 0xF5, 0x50, 0x5C, 0x4B,
+    0xB7, 0x07, 0x96, 0xA0, 0xC4, 0x12, 0x0E, 0x4D, 0x0A, 0xF7, 0x34, 0xEF, 0x1F, 0xB0, 0x27, 0x5C,
+    0xBA, 0xB1, 0x84, 0x52, 0xD1, 0x18, 0x09, 0x21, 0x94, 0x86, 0x86, 0x32, 0xC9, 0x1E, 0xA2, 0x70,
+    0x41, 0xE1, 0x83, 0xC8, 0xA2, 0x48, 0x91, 0x8B, 0xAC, 0x80, 0x64, 0x0A, 0x6F, 0x92, 0x03, 0x9F,
+    0xE3, 0xDD, 0x1B, 0xBE, 0xD9, 0x7B, 0xC6, 0x0F, 0x92, 0x8A, 0x67, 0xEF, 0xBC, 0x7D, 0x7B, 0x7B,
+    0x33, 0xDF, 0x7C, 0x3B, 0xF3, 0x2D, 0xD1, 0x56, 0xB2, 0x49, 0x44, 0x3A, 0x1D, 0x61, 0x8B, 0x17,
+    0x1E, 0x96, 0x38, 0x88, 0x7D, 0xED, 0x6B, 0x5A, 0x7E, 0x32, 0x4F, 0xA6, 0x56, 0xBD, 0x69, 0xCA,
+    0xAE, 0x18, 0x0A, 0x97, 0x0F, 0xF9, 0x48, 0x9C, 0x04, 0x2C, 0x97, 0xBD, 0x79, 0x3F, 0x50, 0xEA,
+    0xCB, 0x9F, 0x27, 0xF8, 0x38, 0x18, 0x98, 0x28, 0x67, 0xE6, 0x1A, 0x3E, 0x98, 0x5B, 0x22, 0xC3,
+    0x3C, 0xE0, 0xC1, 0xC3, 0x73, 0x3C, 0xA8, 0x1E, 0x87, 0xAA, 0xA7, 0xD2, 0x99, 0x0D, 0x4F, 0x6A,
+    0x28, 0x3B, 0xD3, 0x16, 0x63, 0x3E, 0xA8, 0x21, 0xF3, 0x49, 0x20, 0xCE, 0x02, 0x62, 0x54, 0x4F,
+    0x99, 0xCA, 0x0E, 0xD3, 0xB5, 0x7A, 0x1D, 0x71, 0x83, 0xEA, 0x81, 0xE9, 0x2F, 0xC1, 0xA4, 0xB9,
+    0x81, 0x5D, 0xEC, 0x2D, 0x11, 0xBD, 0x5D, 0xE3, 0xEF, 0x73, 0x9F, 0x8D, 0xC5, 0xA0, 0x9C, 0x6E,
+    0x26, 0xD2, 0x3B, 0xA3, 0x6E, 0x53, 0xAF, 0x77, 0x1D, 0xA9, 0xB3, 0x73, 0x01, 0x23, 0xF1, 0x81,
+    0x05, 0x2F, 0xB3, 0x39, 0x75, 0xA4, 0x1F, 0x8C, 0xB6, 0xCE, 0x47, 0xBD, 0xE3, 0x11, 0x6B, 0x2C,
+    0x9D, 0xEE, 0x74, 0x63, 0x77, 0xC7, 0x6C, 0xCC, 0xBC, 0xA5, 0x02, 0xC0, 0xCB, 0x9E, 0xC9, 0xB4,
+    0x4C, 0xF8, 0x43, 0x62, 0x5C, 0x0C, 0xC4, 0x65, 0x47, 0xAC, 0x1B, 0xA4, 0xB2, 0x29, 0xE9, 0xD4,
+    0x18, 0x3D, 0x7F, 0x63, 0xB1, 0xB7, 0xF0, 0x4C, 0x69, 0x40, 0x4E, 0xD3, 0xEA, 0x20, 0x4A, 0x30,
+    0x80, 0x7E, 0xBD, 0xF4, 0x88, 0x3F, 0x60, 0x74, 0x54, 0x09, 0x19, 0x02, 0xF8, 0xAD, 0xFD, 0x89,
+    0x78, 0x63, 0x54, 0x83, 0xEA, 0xB9, 0xD6, 0xBB, 0x03, 0x4D, 0xB6, 0xCE, 0xC0, 0xB4, 0x62, 0x6E,
+    0x04, 0x2C, 0x7F, 0xC0, 0x3B, 0xA0, 0x55, 0xF5, 0xC8, 0xA2, 0xC9, 0x87, 0x09, 0x44, 0x80, 0xBF,
+    0x48, 0xFE, 0x1B, 0xE0, 0xCD, 0x22, 0x22, 0x5C, 0xE6, 0xD3, 0x4C, 0x80, 0x16, 0x92, 0xF1, 0x6A,
+    0x47, 0x99, 0x50, 0x9C, 0x84, 0x4F, 0x82, 0xEC, 0x36, 0x35, 0x55, 0x2D, 0x5E, 0x54, 0x38, 0x24,
+    0xCA, 0x46, 0x10, 0x0B, 0x58, 0x58, 0xD4, 0x35, 0x16, 0xCB, 0x0E, 0x8B, 0x85, 0xC3, 0x62, 0x3C,
+    0x50, 0x8A, 0x21, 0x4C, 0x9D, 0x9F, 0x7F, 0xCC, 0x6D, 0xC2, 0x81, 0x7B, 0x1C, 0x97, 0xC6, 0x09,
+    0xC9, 0xC1, 0x91, 0x42, 0x74, 0xCA, 0x1D, 0x4C, 0x1A, 0x6B, 0x22, 0xC6, 0xB5, 0xF5, 0x1C, 0xFD,
+    0xCE, 0x9D, 0x7D, 0x09, 0x4E, 0x09, 0xB3, 0xA3, 0xB2, 0xB5, 0xD8, 0x53, 0x38, 0x44, 0xB6, 0x88,
+    0x89, 0x09, 0x98, 0xA5, 0x0C, 0x85, 0x02, 0x40, 0x16, 0x50, 0x0A, 0xA7, 0x26, 0xB2, 0x27, 0xDC,
+    0x16, 0x7C, 0x3A, 0x90, 0x95, 0xE2, 0x52, 0x08, 0x91, 0x88, 0xDF, 0x0A, 0xC7, 0x9A, 0xA1, 0x44,
+    0xE2, 0xD6, 0xEC, 0x02, 0x95, 0x01, 0x8F, 0x1A, 0x08, 0xE0, 0x3D, 0xE3, 0xCB, 0x9F, 0x2B, 0x9F,
+    0x3F, 0x6F, 0x9A, 0xFF, 0x3E, 0xBD, 0xFA, 0x09, 0xB8, 0x38, 0xAF, 0x74, 0xA2, 0xCD, 0xCA, 0xA5,
+    0xE0, 0xB5, 0xE0, 0xF1, 0xEA, 0x00, 0xAE, 0x7D, 0x31, 0xD2, 0xA4, 0x1B, 0x75, 0xBC, 0xFC, 0x0A,
+    0x37, 0x27, 0x78, 0x3E, 0x66, 0x9E, 0xF4, 0xD1, 0xF6, 0xF1, 0xBF, 0x9F, 0x8D, 0x92, 0x2F, 0xAA,
+    0x2F, 0x0D, 0xB4, 0x89, 0x3A, 0x85, 0x1B, 0xF0, 0x9F, 0xCF, 0x9E, 0x24, 0xC9, 0x4C, 0x82, 0x21,
+    0x9C, 0x6E, 0x75, 0x2B, 0x15, 0x03, 0x46, 0x57, 0x96, 0x00, 0x53, 0x0A, 0xC6, 0xE3, 0x68, 0xD8,
+    0x29, 0x20, 0x7E, 0xC5, 0xAE, 0x23, 0x59, 0x8A, 0xB8, 0x63, 0xD2, 0x5D, 0xA4, 0x00, 0x5C, 0x8C,
+    0x97, 0xDC, 0xDB, 0xB9, 0xF1, 0x96, 0xD8, 0xF7, 0x32, 0x81, 0x04, 0x68, 0xFD, 0xD5, 0x04, 0x09,
+    0x08, 0x37, 0x3D, 0xC2, 0x60, 0x72, 0xB4, 0xDD, 0xAF, 0xEE, 0xE1, 0x6F, 0x31, 0xE1, 0x1F, 0x31,
+    0x11, 0x8F, 0x55, 0xFD, 0x0F, 0xCD, 0xE8, 0x28, 0x47, 0x73, 0x59, 0x24, 0xDE, 0xD4, 0x69, 0x78,
+    0xE5, 0x68, 0x30, 0xBA, 0x1B, 0x01, 0xEE, 0x43, 0x89, 0x91, 0xF3, 0x6F, 0x38, 0xB6, 0x74, 0x65,
+    0xD8, 0xD5, 0x41, 0x2F, 0x0F, 0xA2, 0x4F, 0xE9, 0xDA, 0x97, 0x28, 0x36, 0x4B, 0xE5, 0xC3, 0xF9,
+    0xEB, 0x57, 0x7C, 0x99, 0x66, 0xF1, 0x60, 0xF6, 0xD9, 0x55, 0x5F, 0xE1, 0x55, 0x54, 0xE0, 0x3B,
+    0xA8, 0x47, 0xE4, 0xAF, 0x43, 0x44, 0xA8, 0xEB, 0x95, 0x2F, 0x8B, 0x4A, 0x86, 0x36, 0xA0, 0xC6,
+    0xA2, 0xAD, 0x60, 0x07, 0xD9, 0x88, 0x9C, 0x4C, 0xA0, 0xC9, 0xD3, 0x3D, 0xD8, 0x7B, 0xE4, 0x61,
+    0x3F, 0xA3, 0x11, 0x56, 0xA7, 0x83, 0xD8, 0x0D, 0x07, 0x5B, 0xED, 0xF4, 0xB0, 0xEA, 0xA7, 0x4E,
+    0xEC, 0x61, 0x0B, 0x5B, 0x9C, 0x8A, 0xC5, 0x31, 0x86, 0xAD, 0x29, 0xC3, 0x79, 0xF8, 0x29, 0x8D,
+    0x36, 0x09, 0x33, 0x4B, 0x33, 0x45, 0x73, 0xD5, 0xC7, 0x62, 0x8A, 0x35, 0x20, 0xF4, 0x75, 0x4B,
+    0xD9, 0xD9, 0xC7, 0x7F, 0xC6, 0x4D, 0xCE, 0xA4, 0x3D, 0x59, 0x07, 0xDC, 0x0A, 0x53, 0x9B, 0x5C,
+    0xB8, 0xEC, 0xCC, 0x69, 0x43, 0x7A, 0xB1, 0xF1, 0xBB, 0xCB, 0x06, 0x7F, 0x0F, 0xD3, 0x8F, 0x1E,
+    0x1D, 0x60, 0x6A, 0x46, 0x4C, 0x37, 0x38, 0xC7, 0x54, 0x3B, 0x73, 0xA2, 0xDF, 0x43, 0xFC, 0xE3,
+    0x41, 0xB5, 0x26, 0x6A, 0xAC, 0xF4, 0xC1, 0xDC, 0x08, 0xB1, 0x13, 0x96, 0x00, 0xF0, 0x06, 0x1F,
+    0xF2, 0x33, 0x86, 0xB6, 0x89, 0x14, 0xA1, 0xA4, 0x5E, 0x9E, 0x98, 0x20, 0x7B, 0x5C, 0x94, 0x6F,
+    0xD5, 0xDD, 0x07, 0xE9, 0xDF, 0x75, 0x50, 0x08, 0xA4, 0x91, 0x5E, 0xEA, 0xB6, 0x12, 0xBF, 0x52,
+    0x59, 0x15, 0xD4, 0x29, 0xBB, 0x40, 0x3E, 0x06, 0xDD, 0x51, 0x3C, 0xC3, 0xF2, 0x54, 0xB6, 0xA0,
+    0x7E, 0x42, 0xDF, 0xC6, 0x8A, 0x15, 0x11, 0xB8, 0x25, 0x35, 0xCE, 0x2D, 0xDA, 0x3A, 0x24, 0xA2,
+    0x74, 0xBA, 0x8B, 0x42, 0x58, 0x0C, 0xA6, 0x21, 0x73, 0x08, 0x35, 0xF1, 0x49, 0x7D, 0x3D, 0x1D,
+    0xAB, 0xC6, 0x6C, 0x77, 0x05, 0xB4, 0x62, 0xD6, 0xE2, 0x1B, 0x90, 0x6D, 0xD4, 0x38, 0x4F, 0x69,
+    0x8D, 0x82, 0x86, 0xB8, 0xDC, 0xF2, 0xF0, 0xA0, 0xD8, 0x1E, 0x0E, 0xC5, 0x73, 0x9F, 0x42, 0x27,
+    0x59, 0xBF, 0xE0, 0x03, 0x3E, 0x73, 0x66, 0xB8, 0x1B, 0x51, 0xBD, 0x5B, 0xD4, 0x54, 0x3C, 0x06,
+    0x86, 0xFB, 0xC0, 0x90, 0xD4, 0x9B, 0x4B, 0xB0, 0x22, 0x3A, 0x4A, 0x6A, 0x8B, 0xA5, 0x89, 0x51,
+    0x41, 0xF9, 0x73, 0xE4, 0x62, 0xAB, 0x96, 0x14, 0x36, 0x27, 0x72, 0x15, 0x54, 0xAD, 0x74, 0x10,
+    0x34, 0xCC, 0xDC, 0xB6, 0x68, 0x6D, 0x34, 0x3C, 0x70, 0x76, 0x28, 0xA5, 0x09, 0x9A, 0x8B, 0x6B,
+    0xA0, 0x25, 0xFB, 0xE1, 0x48, 0xB9, 0x47, 0x9B, 0xEA, 0x36, 0x6F, 0xBE, 0x07, 0xF9, 0x14, 0xCA,
+    0x76, 0x2D, 0x89, 0x6D, 0xBB, 0x18, 0x90, 0x16, 0x7A, 0x73, 0x7C, 0x9D, 0xE4, 0x32, 0x6A, 0xD7,
+    0x16, 0x4E, 0xB3, 0xD7, 0x13, 0xEB, 0xAE, 0x3A, 0x74, 0x00, 0x9B, 0x79, 0xFE, 0x83, 0x4B, 0x7E,
+    0xF4, 0x03, 0xFF, 0xE2, 0x66, 0x48, 0xA2, 0xAC, 0x85, 0xC4, 0x88, 0x12, 0x84, 0xB6, 0xB0, 0xB7,
+    0xB7, 0x00, 0x47, 0x4E, 0xCE, 0x00, 0x06, 0xC0, 0x88, 0x46, 0xE3, 0x26, 0x13, 0x7D, 0x10, 0x2D,
+    0xCC, 0x46, 0xDC, 0x38, 0x6D, 0xF5, 0x64, 0xF1, 0x64, 0x2B, 0xDE, 0x18, 0xF2, 0x76, 0x88, 0x62,
+    0x2D, 0x12, 0x8D, 0x2B, 0x46, 0xAA, 0xCA, 0x30, 0x5A, 0x0C, 0xBB, 0xCF, 0xBC, 0xDC, 0x4F, 0x5D,
+    0xCA, 0x8D, 0xD9, 0xCB, 0x79, 0x9A, 0x35, 0x83, 0xDD, 0x7A, 0xC6, 0x22, 0xDB, 0xB6, 0xD6, 0xCD,
+    0x75, 0x73, 0xB4, 0xFD, 0x54, 0x16, 0x05, 0x19, 0xB3, 0xAD, 0x41, 0x0B, 0xE4, 0x45, 0xE4, 0x1D,
+    0x37, 0xCC, 0x9B, 0xBC, 0xE0, 0x93, 0xBB, 0x06, 0xE4, 0x72, 0x2E, 0x57, 0x48, 0x43, 0xFF, 0xE3,
+    0xF3, 0x37, 0xB5, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x18, 0xFD, 0x76, 0xD7, 0xBE, 0x45, 0x5A, 0x89,
+    0x49, 0xE1, 0x8A, 0x66, 0x1B, 0xAA, 0x48, 0xB0, 0x75, 0xAA, 0x59, 0xD3, 0x50, 0x50, 0x10, 0x84,
+    0x8E, 0x94, 0x69, 0xA8, 0x68, 0x5C, 0x21, 0xA5, 0x62, 0xF7, 0xE2, 0x82, 0x22, 0xCD, 0xFD, 0x83,
+    0x34, 0x29, 0xC8, 0xB9, 0x70, 0xCA, 0x34, 0x64, 0xD6, 0xB1, 0x90, 0x0B, 0x8A, 0x6C, 0x44, 0xE1,
+    0xC2, 0x85, 0x57, 0x50, 0x44, 0x22, 0x85, 0x07, 0x69, 0x1D, 0xD6, 0xF6, 0xCC, 0x3E, 0xDE, 0xDC,
+    0x5D, 0x40, 0x08, 0x14, 0x09, 0x29, 0xAC, 0x3D, 0x96, 0x6F, 0x76, 0xBE, 0xEF, 0x7B, 0xF3, 0xDE,
+    0xFB, 0xBE, 0xDB, 0x8A, 0x3E, 0x73, 0xEA, 0xF0, 0x12, 0x29, 0x6C, 0xF4, 0x50, 0x44, 0x32, 0xA0,
+    0xC2, 0x08, 0x5C, 0xF9, 0xE9, 0xA7, 0x56, 0x74, 0x23, 0x90, 0x04, 0x78, 0x06, 0x68, 0x38, 0x4C,
+    0x3F, 0x77, 0xA2, 0xFE, 0xDA, 0x3D, 0x03, 0x0C, 0xC6, 0xCD, 0x72, 0x2B, 0x19, 0x8A, 0xBA, 0xBA,
+    0xDD, 0x2A, 0x74, 0xB2, 0x33, 0x97, 0x90, 0xE5, 0x42, 0x0A, 0xD8, 0x02, 0x50, 0xB6, 0x38, 0xEE,
+    0x93, 0x4B, 0x3F, 0x65, 0xCA, 0xF0, 0x5C, 0x59, 0x89, 0xBD, 0x30, 0x43, 0x94, 0x8D, 0x7B, 0x0D,
+    0x60, 0x53, 0x0C, 0xF2, 0xFA, 0xA9, 0x50, 0xC7, 0xC0, 0x28, 0x3C, 0xD7, 0xE9, 0x79, 0x36, 0xBE,
+    0x13, 0x0E, 0x32, 0x59, 0xCF, 0x77, 0x23, 0x97, 0xC6, 0xDF, 0x1E, 0x6E, 0x9C, 0x35, 0x92, 0xFF,
+    0x32, 0x10, 0x13, 0xEA, 0x7C, 0x50, 0x80, 0x93, 0xB0, 0x32, 0xF4, 0xCB, 0x7C, 0x93, 0xB1, 0x54,
+    0xF0, 0x04, 0xDA, 0xCE, 0x53, 0x27, 0x62, 0x4A, 0x51, 0x2F, 0x09, 0x81, 0x25, 0xB0, 0xC0, 0x7E,
+    0x93, 0x1F, 0x5B, 0x06, 0xDE, 0x1F, 0x72, 0x86, 0x98, 0x15, 0x8A, 0x3B, 0xEF, 0x32, 0x69, 0xD6,
+    0x89, 0x7A, 0xCA, 0xCF, 0xE5, 0xD6, 0xFF, 0x03, 0x2B, 0xAD, 0xBB, 0xC4, 0x3E, 0x11, 0x57, 0xD4,
+    0x1B, 0x51, 0xC9, 0xCF, 0x91, 0x99, 0x13, 0x63, 0x09, 0xF4, 0xEF, 0x47, 0x8C, 0x2E, 0x5A, 0x49,
+    0x2E, 0x03, 0x46, 0xB2, 0xFB, 0xAB, 0x79, 0x69, 0xD3, 0x73, 0x97, 0x38, 0xFD, 0x62, 0x4C, 0x99,
+    0xBA, 0x18, 0x57, 0x90, 0xEE, 0x64, 0x21, 0x50, 0x7F, 0x62, 0xF9, 0x57, 0x3D, 0x5F, 0x62, 0xBF,
+    0xB9, 0xF5, 0x9A, 0x46, 0x65, 0x23, 0x2F, 0x7A, 0x36, 0x4A, 0x55, 0x16, 0x6D, 0xD1, 0xE4, 0x6D,
+    0xDE, 0x25, 0x2E, 0xED, 0x29, 0x5C, 0x35, 0xF3, 0x44, 0x9D, 0xD9, 0xEA, 0x63, 0x86, 0x20, 0xFF,
+    0x89, 0xA4, 0xE4, 0x00, 0xF5, 0x48, 0x96, 0xB8, 0x23, 0xFE, 0x6D, 0xF9, 0x62, 0xE7, 0x45, 0x60,
+    0xEB, 0xDB, 0xDE, 0xD4, 0x52, 0x1D, 0xF8, 0x20, 0x78, 0x5B, 0x6D, 0xB3, 0x78, 0x97, 0xB7, 0xBA,
+    0x55, 0x36, 0xED, 0x13, 0xA7, 0x7A, 0xD6, 0x30, 0x47, 0x8E, 0x35, 0x54, 0x2F, 0x71, 0xF3, 0x98,
+    0x75, 0x8D, 0x22, 0x2B, 0x69, 0xC7, 0x58, 0xD9, 0x8A, 0xD6, 0x58, 0xE2, 0x07, 0xFC, 0xF9, 0xAE,
+    0x68, 0x74, 0x6D, 0x4A, 0x24, 0x83, 0xEA, 0x92, 0x41, 0xEF, 0x3A, 0x29, 0x0E, 0x07, 0xC3, 0x42,
+    0xD5, 0xFD, 0x2E, 0x94, 0x76, 0x81, 0x63, 0x34, 0xA2, 0x7E, 0x1F, 0xE9, 0x2B, 0xAF, 0xEF, 0xF5,
+    0x52, 0xED, 0x0E, 0xBA, 0x51, 0x56, 0xCF, 0x90, 0xF8, 0x64, 0xC8, 0x06, 0x53, 0xEB, 0x5A, 0x37,
+    0xD9, 0x8C, 0xCC, 0x8D, 0x64, 0xAE, 0x5C, 0x31, 0x37, 0x41, 0x4F, 0x76, 0x0F, 0x80, 0xE1, 0x46,
+    0x8C, 0xA5, 0x2A, 0x04, 0x9B, 0x0E, 0x13, 0x33, 0xC4, 0xE4, 0xDA, 0xA0, 0xDE, 0xBC, 0xBD, 0xD2,
+    0x3D, 0x6F, 0x25, 0x7B, 0x55, 0xA6, 0x0E, 0xC1, 0xC7, 0xF4, 0xBA, 0x5F, 0xEB, 0x40, 0x9D, 0xF9,
+    0x1B, 0xC9, 0xCD, 0x65, 0xB2, 0xB9, 0xC6, 0x50, 0xC0, 0x6F, 0x44, 0x64, 0xD9, 0x47, 0xB7, 0x5C,
+    0x82, 0x2E, 0xA1, 0x3D, 0x27, 0x3C, 0x8D, 0x6B, 0x02, 0xBD, 0x37, 0xB2, 0x09, 0x0A, 0x9A, 0x9C,
+    0x22, 0x01, 0x4F, 0x11, 0x3E, 0xA0, 0x99, 0xEE, 0xB0, 0xA6, 0x93, 0x20, 0x5D, 0x45, 0xDD, 0xC9,
+    0x06, 0xD3, 0x17, 0x8C, 0x8B, 0x4C, 0x2B, 0x21, 0x15, 0x31, 0xC9, 0xF8, 0xA5, 0xE8, 0x63, 0x06,
+    0xF0, 0x9E, 0xF4, 0x52, 0x1D, 0xCA, 0x5F, 0x5F, 0x2C, 0x76, 0xB9, 0xA3, 0xC3, 0xCD, 0x19, 0x95,
+    0x10, 0xE9, 0x9F, 0x77, 0x08, 0xF0, 0x59, 0x28, 0xDA, 0xE3, 0xD1, 0x60, 0x5D, 0xE2, 0x0F, 0x56,
+    0xCB, 0x3B, 0x76, 0xCF, 0xD7, 0xE4, 0x9D, 0x5E, 0xA9, 0xE0, 0x23, 0xC3, 0xBD, 0xC5, 0x22, 0xE8,
+    0xB6, 0x5C, 0xE1, 0x31, 0x92, 0x7A, 0x88, 0xE2, 0xCA, 0xB9, 0x34, 0x57, 0xC5, 0x35, 0x7A, 0xC4,
+    0xDE, 0x23, 0x39, 0xF7, 0xC8, 0x7E, 0xF3, 0x50, 0xCF, 0x3D, 0x8A, 0x03, 0x0F, 0xBD, 0xED, 0x61,
+    0x22, 0x0F, 0xC7, 0x35, 0x70, 0xD1, 0x38, 0x2C, 0xEA, 0xD1, 0x44, 0x7E, 0xB2, 0x78, 0x10, 0xD3,
+    0xF3, 0x66, 0x89, 0xF5, 0xA1, 0x7C, 0x45, 0x01, 0xD0, 0xF1, 0x56, 0x0A, 0x23, 0x47, 0xC4, 0xEE,
+    0x15, 0x7E, 0x7E, 0x85, 0x8B, 0xC1, 0x8C, 0xC4, 0xFF, 0x84, 0x1A, 0x50, 0xC5, 0x9A, 0x17, 0xE1,
+    0x19, 0xA2, 0x7F, 0xF4, 0xA1, 0xC4, 0x4E, 0x4B, 0x34, 0x68, 0xDA, 0x72, 0xE3, 0xAD, 0xC2, 0x4A,
+    0xEB, 0x47, 0x49, 0x6F, 0xC4, 0xE7, 0xF5, 0xE6, 0xD2, 0x01, 0xD7, 0xCB, 0xF7, 0xF6, 0x3B, 0x85,
+    0x21, 0xC3, 0x48, 0x08, 0x77, 0xD9, 0xA1, 0x23, 0x86, 0xEF, 0xCD, 0xF8, 0x4D, 0x01, 0xA3, 0x70,
+    0x46, 0x82, 0x9B, 0xD0, 0xB5, 0xB0, 0x3C, 0x43, 0x86, 0x3F, 0x48, 0xC9, 0xA7, 0xA5, 0x9E, 0x15,
+    0xBD, 0x1A, 0x95, 0xD7, 0xD6, 0x26, 0xA5, 0x58, 0x54, 0x25, 0x38, 0x06, 0x6D, 0x3E, 0xA4, 0x48,
+    0x46, 0x51, 0xF4, 0x9F, 0x54, 0x47, 0x03, 0x75, 0x61, 0x1B, 0xE8, 0x13, 0xCA, 0xEA, 0x69, 0xA4,
+    0x62, 0xF9, 0x4F, 0xC5, 0x9D, 0x43, 0xC7, 0x57, 0xBA, 0x13, 0x33, 0x43, 0x5D, 0xD8, 0x0C, 0x4B,
+    0xD1, 0xC9, 0xD6, 0xCE, 0x4A, 0x5D, 0x89, 0xDB, 0xC7, 0xA1, 0x23, 0x42, 0x3F, 0xAC, 0xBB, 0x81,
+    0x43, 0x31, 0x83, 0x63, 0x21, 0xAB, 0x5B, 0x76, 0x17, 0x13, 0x4B, 0x71, 0x1A, 0xEE, 0x26, 0xF9,
+    0x89, 0x0D, 0xD9, 0x8B, 0x43, 0x97, 0xBA, 0xE2, 0x32, 0x8C, 0x82, 0x2E, 0x5A, 0x0F, 0x8B, 0x7F,
+    0xE2, 0xEB, 0x63, 0xF6, 0x04, 0x5D, 0xAE, 0x09, 0xE2, 0x88, 0x68, 0x9C, 0x59, 0x2C, 0xCC, 0x09,
+    0x9D, 0xED, 0xF9, 0x1A, 0x27, 0x17, 0xD3, 0x2F, 0x7C, 0x55, 0x86, 0x0E, 0x0B, 0xF8, 0x78, 0x87,
+    0x19, 0xCA, 0xFC, 0x5F, 0xF0, 0x89, 0x99, 0x33, 0x5F, 0xC3, 0xBD, 0xC4, 0xB3, 0xBF, 0x4A, 0xFD,
+    0xA3, 0x8D, 0x43, 0x7F, 0x9C, 0xF2, 0x24, 0xA6, 0xD5, 0x89, 0x0D, 0xD1, 0x15, 0x19, 0x25, 0x75,
+    0x21, 0x74, 0x15, 0xB4, 0x22, 0xD0, 0xBD, 0x91, 0xC0, 0xB7, 0x04, 0x30, 0x0C, 0x95, 0x37, 0x10,
+    0x78, 0x6F, 0x45, 0xE0, 0xB3, 0x00, 0x97, 0xA8, 0xCF, 0x6F, 0x79, 0x13, 0x44, 0x49, 0xD9, 0xC1,
+    0xE0, 0xB8, 0x6D, 0x63, 0xD8, 0x65, 0xCC, 0x47, 0x5D, 0xF0, 0x62, 0xBE, 0x6B, 0xD7, 0x56, 0x8C,
+    0xCC, 0x45, 0x98, 0xC6, 0x9C, 0xA6, 0xF6, 0x46, 0xC4, 0x52, 0xA1, 0xEF, 0xD8, 0x57, 0x82, 0xC9,
+    0x62, 0xDF, 0x12, 0x20, 0x81, 0xD8, 0xE9, 0x14, 0xCB, 0xB6, 0x0D, 0xDD, 0xAB, 0x7F, 0x90, 0xDC,
+    0xAD, 0xF6, 0x9B, 0x9D, 0x30, 0x1E, 0x99, 0x73, 0xBB, 0x23, 0x07, 0x11, 0xD3, 0xAE, 0x80, 0xC5,
+    0xE0, 0x00, 0x0F, 0xBD, 0x62, 0x37, 0xD2, 0xF0, 0xE5, 0x56, 0x33, 0x56, 0x81, 0xE3, 0x03, 0x32,
+    0xAD, 0x42, 0x3F, 0x73, 0x46, 0x6A, 0xE3, 0x54, 0xC0, 0xBE, 0xFA, 0x9E, 0x61, 0xD3, 0xF2, 0x6B,
+    0xA3, 0x15, 0xB5, 0x56, 0x99, 0xCE, 0x32, 0x61, 0xCE, 0xDE, 0xE5, 0x68, 0xE4, 0xAC, 0x54, 0x5D,
+    0x98, 0xB2, 0x91, 0x8F, 0x1D, 0xE7, 0x01, 0xA9, 0xA4, 0xE3, 0x65, 0x64, 0xDA, 0xFC, 0xB4, 0xE1,
+    0xBC, 0x24, 0xD8, 0x8A, 0x61, 0x8A, 0xC0, 0xC9, 0xB3, 0x84, 0xC9, 0x57, 0x81, 0x33, 0x8E, 0x2B,
+    0x45, 0x29, 0xFF, 0xED, 0xF9, 0x03, 0xB5, 0x55, 0xBF, 0x8F, 0x15, 0x37, 0x10, 0x9E, 0x5D, 0xDF,
+    0xE9, 0x49, 0x6F, 0x85, 0x4C, 0x71, 0x97, 0x82, 0x20, 0xB6, 0x45, 0x48, 0xB9, 0x6D, 0xD3, 0x10,
+    0x2F, 0x49, 0x99, 0x82, 0x2B, 0xDE, 0x35, 0xE1, 0x1F, 0x08, 0x34, 0xFC, 0x05, 0xB9, 0xDD, 0x40,
+    0x1B, 0x89, 0x93, 0x22, 0x25, 0x25, 0xAF, 0x88, 0xA2, 0xE3, 0xA5, 0x48, 0x0A, 0x8A, 0x14, 0x51,
+    0x76, 0xE1, 0xCA, 0x34, 0xCB, 0xA1, 0x54, 0x14, 0xB7, 0x07, 0xCA, 0x0F, 0x71, 0x05, 0x4E, 0xB4,
+    0x07, 0xE6, 0x62, 0x7B, 0xF2, 0xD9, 0x0B, 0xE8, 0x14, 0x41, 0x8A, 0x48, 0xF1, 0xB3, 0xD7, 0xF6,
+    0xCC, 0x78, 0xBE, 0x99, 0xF1, 0x8C, 0x1F, 0x2D, 0x16, 0x44, 0xCC, 0x25, 0x06, 0x85, 0x76, 0xAE,
+    0x4E, 0xB6, 0x8B, 0x4E, 0x58, 0xA9, 0x27, 0x83, 0xD4, 0x59, 0xF8, 0xF6, 0xC2, 0xE4, 0x5D, 0x6A,
+    0x8B, 0x96, 0x9C, 0xAA, 0xC9, 0x2B, 0xA2, 0xAA, 0x21, 0x52, 0x8E, 0xA8, 0xB0, 0x44, 0xD2, 0x60,
+    0x0C, 0x44, 0x99, 0xC6, 0xDC, 0x83, 0xD7, 0x92, 0xE4, 0x9A, 0xA4, 0x1F, 0xC9, 0x74, 0xFB, 0x0C,
+    0x64, 0x65, 0x47, 0x72, 0x07, 0xBB, 0x72, 0x25, 0x82, 0x14, 0x1D, 0x15, 0x3B, 0x16, 0xE2, 0x0D,
+    0x8E, 0x05, 0xFD, 0xC2, 0x26, 0x8E, 0xAA, 0xB2, 0x21, 0xA9, 0x55, 0x99, 0x38, 0x40, 0xA9, 0x1B,
+    0x3D, 0x4D, 0x9E, 0x41, 0x27, 0x43, 0x7F, 0x0E, 0x2C, 0x11, 0xEC, 0x83, 0x9D, 0xD4, 0xB4, 0x94,
+    0x73, 0x47, 0x13, 0x8C, 0x04, 0x63, 0x6C, 0x01, 0xC5, 0xAA, 0x32, 0x8E, 0x93, 0xCB, 0xFF, 0x8F,
+    0x27, 0xB1, 0xF9, 0xAA, 0xC4, 0xC1, 0x9A, 0x36, 0x8B, 0x92, 0xCE, 0xCB, 0x48, 0xCA, 0x06, 0x1C,
+    0x61, 0x12, 0xA6, 0x68, 0x53, 0x2B, 0x0C, 0x79, 0x62, 0xF8, 0x92, 0x77, 0x45, 0x0B, 0xF0, 0x8E,
+    0xAA, 0x0F, 0x35, 0xC9, 0x47, 0x86, 0x12, 0x07, 0x0C, 0x05, 0x65, 0x93, 0xE0, 0x05, 0xB7, 0xD8,
+    0xC0, 0xFA, 0x42, 0x63, 0x3F, 0xC0, 0x13, 0x20, 0x54, 0xAF, 0x50, 0x22, 0x92, 0xAA, 0x33, 0x1C,
+    0x03, 0x90, 0xE8, 0x22, 0x63, 0x3A, 0xA7, 0x2B, 0xC1, 0x21, 0x55, 0xE7, 0x5D, 0x43, 0x4D, 0xE2,
+    0x10, 0x37, 0xF8, 0x93, 0x69, 0x84, 0xED, 0xBE, 0xA1, 0xE2, 0x66, 0x1B, 0xDD, 0x81, 0xA6, 0x14,
+    0xDA, 0x85, 0x8F, 0x96, 0x91, 0x6A, 0x29, 0xC1, 0x32, 0xD7, 0xD1, 0x19, 0x65, 0xC6, 0x20, 0xD2,
+    0x77, 0xEF, 0x50, 0xD6, 0x5B, 0x2A, 0xAE, 0x6B, 0x5A, 0x49, 0x22, 0x9E, 0x23, 0xF9, 0x9B, 0x21,
+    0x75, 0xB3, 0x87, 0x8F, 0xB5, 0x78, 0xEE, 0xC7, 0x2D, 0xAE, 0xC1, 0xAB, 0x56, 0x18, 0xFE, 0xB9,
+    0xD9, 0x67, 0xE6, 0x6B, 0xCC, 0x9E, 0xBE, 0xFD, 0xD2, 0x8C, 0x11, 0x42, 0x1C, 0xE0, 0x2D, 0x3C,
+    0x7F, 0xB9, 0x15, 0xF5, 0xED, 0xD4, 0x54, 0xF4, 0xA3, 0x6C, 0x97, 0x93, 0x80, 0x72, 0xAA, 0x9E,
+    0x7E, 0xA3, 0x85, 0xB7, 0xC4, 0x0D, 0xA9, 0x27, 0xAD, 0x7C, 0x36, 0x08, 0xC7, 0x5F, 0xB0, 0x62,
+    0xDE, 0x61, 0xD6, 0x6F, 0x7D, 0x8E, 0x88, 0x70, 0x34, 0x51, 0x6A, 0x12, 0xB6, 0x61, 0x07, 0xF5,
+    0xA1, 0x6F, 0xCC, 0x38, 0x72, 0xDE, 0xD8, 0x67, 0x04, 0x3B, 0xC6, 0x4E, 0xFF, 0xE8, 0xB8, 0xF9,
+    0xC5, 0x9C, 0xF9, 0x3E, 0xF3, 0xC5, 0x3E, 0x58, 0xE8, 0x83, 0x7D, 0xF2, 0xD8, 0xF2, 0xA8, 0x56,
+    0x4C, 0x6C, 0x69, 0xA2, 0x29, 0x47, 0xC8, 0x28, 0x89, 0x4B, 0x3A, 0x93, 0xE2, 0x3A, 0x42, 0xEA,
+    0x89, 0x61, 0x93, 0x28, 0x29, 0xD7, 0x63, 0x54, 0xD2, 0x90, 0x18, 0x4F, 0xC0, 0x56, 0xE1, 0xC6,
+    0x42, 0x91, 0x08, 0x0E, 0x24, 0x8E, 0xA4, 0xC7, 0x5B, 0x20, 0xB1, 0x11, 0xF8, 0x58, 0xC9, 0x87,
+    0x57, 0x07, 0x48, 0xE5, 0x3D, 0xA4, 0xD4, 0x0E, 0xA4, 0x18, 0x52, 0x13, 0x0B, 0x52, 0xD5, 0x41,
+    0x80, 0x83, 0x94, 0x96, 0xCC, 0xCF, 0x83, 0xC3, 0xEF, 0x66, 0x25, 0x65, 0xFB, 0xD0, 0x84, 0x58,
+    0xBD, 0x02, 0x9B, 0x6E, 0x11, 0x6D, 0x87, 0xCB, 0xDA, 0xEB, 0x91, 0x2E, 0x71, 0x71, 0x88, 0x72,
+    0x60, 0xEE, 0xF3, 0x3D, 0xE6, 0x3B, 0x8E, 0x2F, 0x39, 0xB0, 0xF2, 0x7D, 0xB0, 0x3C, 0x16, 0xC5,
+    0x3D, 0xB0, 0x6C, 0x60, 0x5D, 0xC0, 0x02, 0x59, 0x91, 0x31, 0x03, 0xC9, 0xC9, 0x30, 0x6D, 0xCC,
+    0xA4, 0x8E, 0xB1, 0xC2, 0x94, 0xF0, 0x46, 0x59, 0xB1, 0x9D, 0x30, 0xB7, 0x57, 0x8F, 0xB6, 0x5F,
+    0x10, 0x5F, 0x4D, 0x1C, 0xBD, 0xE1, 0x63, 0xD4, 0x3E, 0xD4, 0x84, 0x80, 0xC3, 0x45, 0x3F, 0xDA,
+    0xB5, 0xB8, 0x95, 0xB3, 0x0F, 0xFD, 0x97, 0x8D, 0xBC, 0x23, 0xF4, 0x08, 0x04, 0x47, 0xBB, 0x71,
+    0x9B, 0x1F, 0x95, 0x39, 0x0C, 0x40, 0x82, 0x15, 0xB1, 0xAB, 0x52, 0x30, 0x3A, 0xA5, 0x5F, 0xA1,
+    0x8A, 0x12, 0x4E, 0x1D, 0x72, 0x1D, 0x75, 0x68, 0xA8, 0xAA, 0x51, 0x28, 0x0E, 0xF5, 0x2F, 0x9F,
+    0xC1, 0xF7, 0x2A, 0x86, 0x13, 0x18, 0x12, 0x9B, 0x24, 0x96, 0x44, 0xC8, 0xDA, 0x50, 0x0F, 0x48,
+    0x3A, 0x52, 0x77, 0x3D, 0x52, 0x58, 0x1E, 0x5E, 0x40, 0x3D, 0x79, 0xD5, 0xA5, 0x7C, 0x60, 0x62,
+    0x35, 0xC6, 0x64, 0x8B, 0x57, 0x9D, 0xF7, 0x63, 0xF9, 0x8A, 0x78, 0x76, 0x34, 0xF6, 0x4A, 0x3D,
+    0x9D, 0xAB, 0x2E, 0xE0, 0x55, 0x75, 0x36, 0x00, 0xCE, 0x3B, 0xE8, 0x46, 0x8A, 0x36, 0x7A, 0x1C,
+    0x58, 0x0B, 0x76, 0x94, 0x19, 0x38, 0xAE, 0xAB, 0xDF, 0x21, 0xEB, 0x9A, 0x5A, 0xBA, 0x58, 0x02,
+    0xE3, 0x80, 0x35, 0x79, 0x18, 0x26, 0x5C, 0x49, 0x70, 0x00, 0x85, 0xC4, 0x25, 0xAC, 0xA8, 0xF3,
+    0x1E, 0xC5, 0x10, 0xEC, 0x57, 0x7B, 0xA1, 0x70, 0x35, 0x5D, 0x61, 0x3F, 0x2F, 0x10, 0x73, 0x84,
+    0x9E, 0x2F, 0x5C, 0xE2, 0xC3, 0x32, 0xA8, 0x8E, 0xD6, 0x73, 0x66, 0xA8, 0x29, 0xB9, 0xAC, 0xDA,
+    0x5C, 0xC3, 0x78, 0x8F, 0x58, 0xAA, 0x2E, 0x18, 0x07, 0x4D, 0x25, 0x4F, 0x4C, 0xEA, 0xA0, 0x0A,
+    0xB6, 0xBD, 0xCD, 0x87, 0x22, 0xA6, 0x0F, 0xEB, 0x53, 0xEC, 0x6B, 0x09, 0xEF, 0x9B, 0x1B, 0x5A,
+    0x58, 0x40, 0x75, 0x6A, 0xD7, 0x87, 0x64, 0xA1, 0x13, 0x74, 0xA2, 0xB0, 0xF3, 0xDD, 0xCF, 0xA6,
+    0x74, 0x96, 0xE6, 0x69, 0xFD, 0x9A, 0x29, 0xBA, 0x7E, 0x3A, 0x69, 0xA5, 0x3F, 0x7D, 0xF6, 0xF4,
+    0xEB, 0x45, 0xC6, 0x89, 0x56, 0x67, 0x95, 0xC3, 0xCF, 0xBE, 0x9C, 0x29, 0x24, 0x32, 0x23, 0x89,
+    0x9E, 0x2E, 0x16, 0xB7, 0xE2, 0xC6, 0xA3, 0x9F, 0x8B, 0xEB, 0x10, 0xEB, 0x90, 0xBA, 0xA1, 0x5C,
+    0x43, 0xF6, 0x2E, 0x42, 0xDB, 0x7E, 0x23, 0xE3, 0x07, 0xF1, 0xA0, 0x3D, 0xFF, 0x1F, 0x3F, 0x1F,
+    0xA7, 0x5B, 0xAB, 0x1B, 0x33, 0xC5, 0x0E, 0xDF, 0x68, 0x85, 0x3B, 0xB7, 0xD8, 0xCE, 0x5A, 0x5B,
+    0x5C, 0x1F, 0xAA, 0x4C, 0xAF, 0x52, 0x7E, 0xD7, 0xAA, 0x0F, 0xF4, 0x66, 0xD6, 0xAD, 0x90, 0xBC,
+    0x67, 0x8B, 0x9D, 0x41, 0x89, 0x7E, 0x85, 0x9A, 0x89, 0x56, 0xEF, 0x9B, 0xBC, 0xB6, 0x49, 0x99,
+    0xB5, 0x46, 0x4D, 0x1E, 0x1A, 0x75, 0xB1, 0xB3, 0x55, 0xF6, 0xA7, 0x55, 0x9F, 0xAE, 0xCF, 0x70,
+    0xC8, 0x34, 0xF2, 0xD1, 0xA0, 0xE4, 0x1D, 0xBB, 0x99, 0xED, 0x0E, 0x2A, 0x14, 0x1A, 0x4E, 0xCB,
+    0x5D, 0x0B, 0x0E, 0x34, 0x2B, 0xA1, 0xD5, 0xA4, 0x5B, 0x49, 0xCA, 0x46, 0xEE, 0x07, 0x9D, 0x15,
+    0xDE, 0xC4, 0xFC, 0x5A, 0x54, 0xBD, 0x1C, 0xDE, 0x05, 0x81, 0x57, 0xB3, 0xA6, 0xF7, 0x88, 0x86,
+    0x94, 0xF9, 0x01, 0xF3, 0x47, 0x9B, 0x97, 0x69, 0x20, 0xD1, 0xBD, 0xA0, 0x22, 0x91, 0xFA, 0xB0,
+    0x54, 0x2F, 0xDE, 0x10, 0x3C, 0x27, 0x34, 0x1E, 0x6A, 0x69, 0x8D, 0x2E, 0xBB, 0xAF, 0x99, 0x0F,
+    0x50, 0x98, 0x6B, 0xC7, 0xA9, 0x0D, 0x1F, 0x31, 0xFF, 0x7A, 0xF3, 0x71, 0x79, 0x8C, 0x8A, 0xAB,
+    0x36, 0x8D, 0x65, 0xFC, 0x1A, 0xAB, 0x86, 0xE9, 0xD6, 0x3A, 0xE4, 0x32, 0x40, 0x76, 0x8D, 0x2F,
+    0x7C, 0xE6, 0xD2, 0x61, 0xBC, 0xDF, 0x35, 0xB5, 0xF7, 0xD4, 0x2E, 0x81, 0xF7, 0x49, 0xD1, 0xAB,
+    0x9F, 0x8C, 0xFC, 0x03, 0xFF, 0x00, 0x4B, 0x74, 0x12, 0x84, 0xEF, 0xD3, 0x87, 0x7E, 0x62, 0xF2,
+    0xBF, 0x4C, 0xAE, 0xAB, 0xBD, 0x4E, 0x95, 0x3E, 0x90, 0xCB, 0xB5, 0xE2, 0xE0, 0xB9, 0x5B, 0xA2,
+    0x7F, 0x6D, 0x7F, 0x03, 0xB5, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0x7E, 0xB3, 0x1B, 0xBC, 0x90,
+    0x89, 0x34, 0x69, 0x22, 0x40, 0x48, 0x6C, 0x0B, 0x42, 0x64, 0x29, 0x28, 0x82, 0x38, 0x33, 0x1B,
+    0x5F, 0x91, 0x32, 0xE1, 0x47, 0x1A, 0x52, 0xD0, 0x50, 0x20, 0x51, 0x84, 0x92, 0xC2, 0xB9, 0xDD,
+    0x90, 0x22, 0x12, 0x4D, 0xFC, 0x0F, 0x20, 0x2C, 0x14, 0x9A, 0x93, 0x50, 0x9A, 0x14, 0x2E, 0x62,
+    0xEF, 0xD8, 0x57, 0xB8, 0x48, 0xE1, 0x8D, 0x52, 0x44, 0x22, 0x45, 0x36, 0x04, 0x11, 0xA1, 0x14,
+    0x9E, 0xC4, 0x6B, 0x69, 0x63, 0xCF, 0xEE, 0xE3, 0x9B, 0x3D, 0x9B, 0x24, 0x22, 0x2E, 0x19, 0x8D,
+    0xEE, 0xDB, 0x99, 0x79, 0x7E, 0x3F, 0xBF, 0xF7, 0x4C, 0x01, 0xFF, 0x4E, 0xEF, 0xD0, 0x62, 0x90,
+    0x1F, 0x7E, 0x39, 0x60, 0x09, 0xAE, 0x0E, 0x7C, 0xEE, 0x81, 0x48, 0xF1, 0x74, 0x1D, 0xA6, 0xC5,
+    0x97, 0x6D, 0x08, 0x74, 0xE6, 0x08, 0x19, 0x75, 0xB0, 0x80, 0x64, 0xFA, 0x20, 0x24, 0x7D, 0xB0,
+    0xC0, 0xDE, 0x8A, 0x5A, 0x8A, 0x4A, 0x60, 0xCC, 0xA4, 0x0C, 0x50, 0x5F, 0xCB, 0x93, 0xD4, 0xA3,
+    0x32, 0xDA, 0xBF, 0x7F, 0xA2, 0xCC, 0x72, 0x8F, 0x72, 0xB5, 0x99, 0x9E, 0x27, 0x96, 0xFA, 0xF7,
+    0xF5, 0xFB, 0x2D, 0x25, 0x79, 0x72, 0x6D, 0xE3, 0x26, 0xE7, 0x6C, 0x15, 0xC7, 0xA7, 0x37, 0xD7,
+    0x76, 0x9A, 0xA8, 0xD5, 0xF1, 0xA9, 0x07, 0xD6, 0x11, 0x2D, 0x27, 0xC3, 0x1E, 0x5D, 0x32, 0xDC,
+    0xAA, 0x6E, 0x50, 0x50, 0x4F, 0x31, 0xAA, 0x92, 0xFE, 0x5D, 0x19, 0xB5, 0x71, 0x7B, 0xDB, 0x51,
+    0x9C, 0x4B, 0x5E, 0xE5, 0x9A, 0x34, 0x05, 0x4C, 0x59, 0x49, 0xFF, 0x59, 0x82, 0x53, 0x51, 0xEF,
+    0x7D, 0x59, 0x72, 0xD3, 0xCB, 0xAE, 0xA0, 0xE5, 0xE9, 0xD7, 0xBE, 0xA3, 0xC8, 0xC9, 0xC4, 0xF6,
+    0xAE, 0x23, 0xA8, 0x6A, 0xB9, 0x0F, 0x06, 0xCB, 0x69, 0x69, 0xF6, 0x05, 0xD7, 0xEF, 0x77, 0xF0,
+    0x38, 0x6A, 0xD4, 0xA3, 0xAD, 0x27, 0x6C, 0x75, 0x2B, 0xE1, 0xF8, 0x76, 0xD3, 0xB5, 0xC9, 0xE6,
+    0x64, 0xB7, 0x8E, 0x6B, 0x37, 0x8A, 0xAF, 0x4C, 0x1E, 0x37, 0xA3, 0xDE, 0xF5, 0x2D, 0xBB, 0xEC,
+    0x75, 0x68, 0x59, 0x3A, 0x97, 0x9C, 0x1F, 0x5A, 0x4A, 0xE6, 0x6A, 0xAD, 0xE5, 0xDD, 0xD2, 0x7B,
+    0x3E, 0x52, 0x1B, 0x6B, 0xDB, 0x8D, 0x26, 0x69, 0xD4, 0xDD, 0x3F, 0x9E, 0x3A, 0x7D, 0x3E, 0x8F,
+    0xAA, 0x00, 0x1A, 0x3B, 0xC9, 0x26, 0x84, 0xA8, 0x8D, 0x3A, 0x2A, 0xCC, 0xB3, 0x10, 0x82, 0x3A,
+    0x36, 0x2E, 0xAA, 0xB4, 0xA8, 0x67, 0x52, 0x1C, 0x32, 0xE1, 0x74, 0xEA, 0x62, 0xA8, 0x31, 0x3A,
+    0x2A, 0xE3, 0xA1, 0x9D, 0x49, 0x17, 0xFD, 0xB5, 0x2C, 0x33, 0x75, 0xCB, 0xA9, 0x55, 0xA7, 0x4F,
+    0x36, 0x1A, 0xE2, 0x51, 0xE9, 0xB0, 0xE3, 0xF4, 0xEB, 0xC3, 0x62, 0x81, 0x46, 0xD4, 0x92, 0x0B,
+    0xEA, 0xD0, 0x86, 0xE5, 0x4C, 0x3A, 0x92, 0x25, 0x24, 0x91, 0xDA, 0x34, 0x19, 0xDA, 0xD0, 0x5E,
+    0xA0, 0x59, 0x69, 0xA0, 0x64, 0x24, 0x6F, 0xB9, 0xB0, 0xCE, 0x54, 0xA9, 0xD6, 0x6A, 0x4D, 0xCB,
+    0x6A, 0x15, 0xE2, 0x17, 0x90, 0xE8, 0x39, 0x3B, 0x4B, 0xBD, 0x12, 0x24, 0x89, 0x90, 0x4C, 0x6D,
+    0xA2, 0xDF, 0xC8, 0xDA, 0xB7, 0xE5, 0xD0, 0x0C, 0xE6, 0x83, 0x92, 0x8E, 0x52, 0x9C, 0xAA, 0x4A,
+    0x59, 0x65, 0x65, 0x1D, 0x3A, 0xFF, 0xDC, 0x50, 0x96, 0xCA, 0x8A, 0x16, 0x04, 0x72, 0x19, 0xB4,
+    0xB8, 0xE9, 0xAF, 0xF1, 0x0E, 0x89, 0xA8, 0x09, 0x1A, 0x7A, 0x75, 0x1A, 0xD9, 0xD1, 0xD0, 0x8A,
+    0xC0, 0xAA, 0x32, 0x51, 0x56, 0xCF, 0x39, 0x65, 0xBF, 0x49, 0x20, 0x14, 0x20, 0x47, 0x36, 0x31,
+    0xA4, 0x9E, 0x38, 0x7A, 0x57, 0xB1, 0xF9, 0xC5, 0x29, 0xA7, 0x76, 0x6D, 0x62, 0xF5, 0xBD, 0x1F,
+    0xD8, 0x8E, 0x28, 0xB9, 0x67, 0x29, 0x70, 0xAA, 0x22, 0x08, 0x57, 0x81, 0x3B, 0xA4, 0xAA, 0xC4,
+    0xE0, 0xE8, 0xC2, 0x46, 0x99, 0x5C, 0x95, 0x47, 0x88, 0xDE, 0x24, 0xCA, 0x2E, 0x76, 0xC5, 0xC5,
+    0x0E, 0xBF, 0xD9, 0xC9, 0x2E, 0x4B, 0xA7, 0xBB, 0xD5, 0xD8, 0x34, 0xDD, 0x4E, 0xEF, 0x73, 0xE1,
+    0x38, 0x2D, 0x15, 0x5E, 0x98, 0x21, 0x70, 0x08, 0xB1, 0x78, 0xF2, 0xE7, 0x05, 0xD7, 0x19, 0xBB,
+    0x8F, 0x1F, 0xBB, 0xD0, 0xB6, 0xA1, 0x75, 0xE1, 0x96, 0x0B, 0xD9, 0x86, 0x28, 0x4F, 0x07, 0xD3,
+    0x14, 0x34, 0xFB, 0xE4, 0xBA, 0x4E, 0x88, 0x0C, 0x1B, 0x97, 0xF8, 0xD3, 0x63, 0x67, 0xCF, 0x7E,
+    0xCE, 0xDC, 0x69, 0xE6, 0xCA, 0x3F, 0xA2, 0x84, 0x0F, 0x0C, 0xC9, 0xB0, 0xA4, 0x3A, 0xDC, 0x29,
+    0x52, 0x51, 0x80, 0x9E, 0xEF, 0x5D, 0x85, 0x7A, 0x47, 0x0D, 0xCD, 0x4B, 0xA2, 0xC1, 0x77, 0x44,
+    0x1F, 0x82, 0x73, 0x3D, 0xED, 0x42, 0x43, 0xEF, 0x13, 0x59, 0x92, 0x29, 0x0D, 0x48, 0x94, 0x48,
+    0x35, 0x7D, 0xEF, 0x2F, 0xE3, 0x94, 0x98, 0xA2, 0x9F, 0x68, 0x30, 0x10, 0xD5, 0x75, 0x49, 0xF6,
+    0x44, 0xE0, 0x59, 0xBE, 0x47, 0xDF, 0x3D, 0x98, 0xEF, 0x7F, 0x17, 0xE6, 0x5F, 0xF1, 0xC0, 0x2B,
+    0x5D, 0x0F, 0xCC, 0x1E, 0xBE, 0xE4, 0x5F, 0x7B, 0x0E, 0x71, 0x6F, 0x24, 0xDA, 0xEC, 0x79, 0xA5,
+    0xD6, 0xFB, 0x2E, 0x8C, 0x2F, 0x79, 0x18, 0x09, 0x91, 0xC2, 0xFD, 0x91, 0xA7, 0x3B, 0xD1, 0x6C,
+    0x0F, 0x67, 0x66, 0x67, 0x68, 0xE1, 0xC6, 0x1B, 0xC5, 0x0A, 0x13, 0x77, 0x2D, 0x54, 0x09, 0xC4,
+    0xE5, 0x55, 0x9D, 0xE3, 0xAB, 0x82, 0x73, 0x0A, 0x99, 0xC2, 0xDD, 0x92, 0xE4, 0x3D, 0xA3, 0x6E,
+    0x5B, 0x8A, 0x6F, 0x56, 0xA0, 0x0C, 0x25, 0xC3, 0x4A, 0xA4, 0x60, 0xA8, 0xA0, 0x63, 0x9F, 0xF1,
+    0x2E, 0x6F, 0xC2, 0x0D, 0x95, 0x83, 0x99, 0x68, 0x7B, 0xF2, 0xE3, 0x41, 0x20, 0x6D, 0xDA, 0xB7,
+    0x57, 0x6F, 0x08, 0xCD, 0x06, 0xB2, 0xFB, 0x08, 0x20, 0xE4, 0xBF, 0x46, 0xCF, 0x0B, 0x49, 0x04,
+    0xA9, 0x9F, 0xF2, 0xC3, 0x9D, 0xAF, 0x0C, 0xF8, 0x1E, 0xD9, 0x18, 0xD0, 0x9E, 0xE2, 0x9F, 0xBB,
+    0xEC, 0xD3, 0xBD, 0x93, 0x87, 0xBF, 0xB3, 0x86, 0xAB, 0x6C, 0x9B, 0xFF, 0x2A, 0xF2, 0x95, 0xA0,
+    0x91, 0x55, 0xE2, 0xE1, 0xDC, 0x43, 0x88, 0xBD, 0xBE, 0x7F, 0x02, 0xFC, 0xD8, 0x65, 0x4F, 0xFB,
+    0x8A, 0x4C, 0x6B, 0xFB, 0x56, 0x5F, 0x5E, 0x66, 0x8B, 0x0A, 0x17, 0xEC, 0x3E, 0x0A, 0xDA, 0x13,
+    0xA8, 0x20, 0xFA, 0x43, 0x38, 0x12, 0xAD, 0x2F, 0x25, 0x8E, 0xA0, 0x70, 0xEC, 0x5B, 0x91, 0x32,
+    0xE3, 0x7B, 0xB1, 0x23, 0xD1, 0xF9, 0x77, 0x54, 0x1E, 0x0E, 0x06, 0xF5, 0x8B, 0x33, 0xE6, 0xBA,
+    0xEF, 0x8A, 0x29, 0x11, 0xC2, 0x76, 0x8F, 0x0E, 0x61, 0xE3, 0x19, 0x41, 0x67, 0xA6, 0x12, 0x45,
+    0x13, 0xB4, 0x30, 0x9A, 0x3C, 0x64, 0x5E, 0x6B, 0x61, 0x31, 0x41, 0x7D, 0x6F, 0xC1, 0x62, 0x1B,
+    0x97, 0xA4, 0x57, 0x31, 0xC6, 0x10, 0x52, 0x84, 0x8E, 0x84, 0x21, 0x65, 0x62, 0x43, 0x0E, 0x56,
+    0xD4, 0xB3, 0x11, 0x00, 0x4E, 0x2C, 0x41, 0x6D, 0x52, 0xEA, 0x32, 0xE8, 0xA0, 0x3C, 0x36, 0xA2,
+    0xD7, 0x8E, 0x64, 0x36, 0x92, 0xCB, 0xE2, 0x32, 0xF3, 0xE5, 0x46, 0xB3, 0xCB, 0xE6, 0x16, 0x92,
+    0x3B, 0x70, 0x0E, 0x64, 0x27, 0x75, 0xC7, 0xFB, 0xA4, 0x53, 0xC1, 0x18, 0x3F, 0x59, 0xA9, 0xD1,
+    0x54, 0xA1, 0x1F, 0x80, 0x1A, 0x33, 0xF3, 0xD9, 0x68, 0xA9, 0x68, 0x89, 0x8A, 0x3C, 0x29, 0x65,
+    0x03, 0xCF, 0xB3, 0x14, 0xA6, 0x53, 0x28, 0x1E, 0x8F, 0xC7, 0x20, 0xF1, 0x06, 0x72, 0x44, 0x61,
+    0xED, 0xE3, 0x46, 0x76, 0xA8, 0xE8, 0x0B, 0xA3, 0x73, 0x58, 0x27, 0x85, 0xDA, 0x5B, 0x8A, 0xEA,
+    0x3E, 0x4C, 0xCD, 0x4D, 0xC8, 0x5C, 0xCF, 0x66, 0x3C, 0x99, 0x70, 0x3B, 0xD0, 0xFC, 0x60, 0xC2,
+    0x0C, 0xD8, 0x9A, 0x70, 0x37, 0x3D, 0xF9, 0x4B, 0xBC, 0x55, 0x83, 0xD9, 0x33, 0xE1, 0xC4, 0x80,
+    0xCA, 0x74, 0x20, 0xF4, 0x6D, 0x35, 0x1E, 0xE7, 0xCC, 0x0E, 0x2E, 0x4C, 0xD8, 0x0D, 0xA0, 0xF6,
+    0x26, 0xA0, 0xF8, 0x17, 0xD6, 0x01, 0x9A, 0x1F, 0x19, 0x88, 0x04, 0xCC, 0x66, 0x3C, 0x5E, 0xC0,
+    0x3F, 0xBC, 0x12, 0x24, 0x55, 0x8A, 0x1B, 0x0B, 0xBF, 0x15, 0xBB, 0x17, 0xA0, 0xD9, 0x61, 0x3E,
+    0x8D, 0xA6, 0x64, 0xFE, 0x13, 0xDE, 0xA6, 0x18, 0xBC, 0x14, 0x58, 0xB4, 0xCB, 0x6B, 0x9A, 0x8B,
+    0x2B, 0xCC, 0xF7, 0xBF, 0xED, 0xBE, 0x08, 0x39, 0x0D, 0x76, 0xAD, 0x70, 0x19, 0x8D, 0x54, 0x2E,
+    0x04, 0x1D, 0x8F, 0x9A, 0xE2, 0xD2, 0x73, 0x65, 0x8E, 0xAC, 0x1E, 0x36, 0x18, 0xC3, 0xD2, 0xD0,
+    0xFF, 0xB8, 0xFE, 0x01, 0xE5, 0x55, 0x31, 0x6C, 0x1C, 0x45, 0x14, 0x7D, 0x7B, 0x6B, 0xDF, 0x09,
+    0x4F, 0x31, 0x96, 0x38, 0x23, 0x25, 0x91, 0x58, 0x8A, 0x14, 0x51, 0x10, 0xBE, 0x26, 0x74, 0xBE,
+    0x9B, 0x0D, 0x56, 0x68, 0xBD, 0xC5, 0x5D, 0x43, 0x8A, 0x44, 0xC2, 0x48, 0x08, 0x0A, 0x53, 0x52,
+    0x9C, 0xBD, 0x8B, 0xAE, 0x48, 0x69, 0x37, 0x69, 0x89, 0x91, 0xD2, 0x10, 0x24, 0x2C, 0x45, 0x20,
+    0x1D, 0xC2, 0xE7, 0x5B, 0xC7, 0x05, 0x12, 0x29, 0xBC, 0x21, 0x12, 0x29, 0x5C, 0xDC, 0x5A, 0x11,
+    0x71, 0x81, 0x84, 0x27, 0xCA, 0x06, 0x4F, 0xE2, 0xDD, 0xFD, 0xFC, 0x3D, 0x27, 0xC8, 0x96, 0x63,
+    0x90, 0x68, 0x99, 0x5D, 0xCD, 0x1F, 0xCD, 0xFC, 0xFF, 0xFE, 0x9F, 0xF7, 0xFF, 0xCC, 0xE0, 0xED,
+    0x9B, 0x10, 0x94, 0xC2, 0xA0, 0x2D, 0x80, 0xA9, 0xCF, 0x80, 0x0B, 0x2E, 0xC0, 0xFF, 0x7F, 0x6A,
+    0x56, 0x08, 0x3C, 0x0C, 0x21, 0xEC, 0x08, 0x89, 0xFD, 0xBC, 0xEF, 0x5A, 0xFD, 0x08, 0x50, 0x2E,
+    0x44, 0x88, 0x92, 0xC6, 0x52, 0xFB, 0x35, 0x45, 0xFD, 0x45, 0xA2, 0xED, 0x4F, 0xF3, 0xA6, 0x4D,
+    0x6E, 0x69, 0x5F, 0x5B, 0xA9, 0x8F, 0x05, 0x19, 0x58, 0xD6, 0xD0, 0x5C, 0x46, 0x85, 0x1A, 0x56,
+    0x71, 0xD6, 0x29, 0xCD, 0xD0, 0xEE, 0x43, 0x22, 0xF3, 0x01, 0x5D, 0x07, 0x45, 0x58, 0x4B, 0xE1,
+    0x3B, 0xA1, 0xD3, 0x89, 0xE1, 0x16, 0xB1, 0x59, 0xA9, 0x18, 0x24, 0x4A, 0xAD, 0x27, 0x0D, 0x19,
+    0x62, 0xA1, 0x30, 0x62, 0xD9, 0x83, 0xAD, 0xE1, 0x04, 0x48, 0x0B, 0x59, 0x73, 0x59, 0x56, 0xE2,
+    0xAE, 0x12, 0x4F, 0x4D, 0x6D, 0x2B, 0xF2, 0x81, 0x71, 0x54, 0x0B, 0x1F, 0x82, 0x72, 0x17, 0x53,
+    0x8A, 0x88, 0x6E, 0x99, 0x9E, 0xB5, 0x42, 0x14, 0x2F, 0x03, 0x97, 0x79, 0x6E, 0xD4, 0x43, 0x85,
+    0x12, 0xF4, 0xAC, 0x6E, 0xC5, 0xC5, 0xE7, 0x17, 0x98, 0x88, 0x00, 0xF0, 0x30, 0xC6, 0x36, 0x1A,
+    0x62, 0xE6, 0x4D, 0xF4, 0xF6, 0xE2, 0x12, 0x19, 0xEB, 0x0A, 0x35, 0x7D, 0xA2, 0xFB, 0x44, 0xA9,
+    0xC5, 0xEA, 0x3E, 0x45, 0x72, 0xB1, 0x86, 0xB7, 0x74, 0x00, 0x59, 0xC0, 0xB3, 0x0F, 0x15, 0x42,
+    0x6A, 0xD8, 0x29, 0x0E, 0x1C, 0x1E, 0xB4, 0x49, 0xC0, 0x89, 0x21, 0x0C, 0x38, 0xAC, 0x23, 0x8D,
+    0xB7, 0x93, 0xBF, 0xB4, 0xC1, 0x72, 0x29, 0x59, 0x90, 0x1B, 0x89, 0xB3, 0xA1, 0xB3, 0x5A, 0x90,
+    0xD6, 0xAE, 0xE9, 0xB4, 0x12, 0xA7, 0x4A, 0x44, 0x4A, 0xF0, 0x56, 0x2D, 0xDE, 0xED, 0x1D, 0x5D,
+    0x76, 0x97, 0xCF, 0x8D, 0xB9, 0x78, 0x01, 0x4E, 0x47, 0xBB, 0xEA, 0xB1, 0x8C, 0xB0, 0x5F, 0x74,
+    0xFD, 0x00, 0x76, 0xD6, 0x2F, 0x3A, 0x55, 0x70, 0x77, 0x4C, 0x69, 0xBC, 0xE8, 0xF2, 0xA3, 0x50,
+    0xE7, 0x80, 0x11, 0x16, 0x9E, 0xEF, 0xA2, 0x94, 0x0E, 0x6D, 0x87, 0xA3, 0x53, 0x3C, 0x77, 0xF5,
+    0x18, 0xC0, 0xFC, 0x51, 0xDB, 0xDE, 0x31, 0x85, 0x02, 0x6A, 0xFC, 0x10, 0x54, 0xF0, 0x02, 0x6A,
+    0x16, 0x72, 0xEB, 0x79, 0xAE, 0x8E, 0xE8, 0x76, 0xFD, 0x95, 0x87, 0xC9, 0x38, 0xCA, 0x4C, 0x3F,
+    0xEB, 0x59, 0x8C, 0x68, 0x33, 0x6D, 0xD6, 0x91, 0x9A, 0x3C, 0x0F, 0xEB, 0xAB, 0x1C, 0x72, 0xDF,
+    0xC0, 0x1F, 0x44, 0xC8, 0x47, 0x8A, 0x4C, 0x1D, 0x6A, 0xE2, 0x90, 0x6D, 0xC2, 0xB6, 0xC5, 0xDC,
+    0xE9, 0x61, 0x85, 0x71, 0x81, 0xAA, 0x69, 0xAD, 0xDC, 0x5A, 0x9C, 0x3A, 0x5A, 0x18, 0x55, 0x49,
+    0xB1, 0x2A, 0x43, 0x0E, 0x98, 0x6B, 0x06, 0xC3, 0xE4, 0x4C, 0xB4, 0xFC, 0x56, 0x4B, 0x72, 0x7D,
+    0x14, 0x39, 0x26, 0x4A, 0x5A, 0xAD, 0xAC, 0xD5, 0x64, 0xAB, 0x97, 0xE6, 0x93, 0xB6, 0x9E, 0xE4,
+    0x5C, 0xFE, 0x6D, 0x9E, 0xC9, 0x30, 0xC7, 0x88, 0xAD, 0x8B, 0x2D, 0xAE, 0x02, 0x35, 0x67, 0xC7,
+    0x64, 0x43, 0x52, 0xD5, 0x95, 0x3D, 0xD3, 0x2D, 0x46, 0x1F, 0xFB, 0x2B, 0x3B, 0x49, 0x75, 0xC4,
+    0xD9, 0x7A, 0x96, 0x9D, 0xB2, 0x2A, 0x7F, 0xE6, 0xFE, 0xFB, 0xEE, 0xC5, 0xAC, 0x7F, 0x63, 0x7B,
+    0x69, 0xDC, 0x9F, 0xDB, 0x31, 0xB3, 0x10, 0xF9, 0x18, 0x96, 0xC7, 0x24, 0x15, 0xFD, 0x2B, 0x7E,
+    0x76, 0x4B, 0xE1, 0x94, 0x1D, 0xAA, 0x93, 0x15, 0x44, 0xCE, 0x67, 0x41, 0xBE, 0x7A, 0x75, 0xA8,
+    0x00, 0x4F, 0x96, 0x8C, 0xBA, 0x9B, 0x9F, 0xAC, 0xA0, 0xDF, 0xFD, 0x79, 0xEC, 0x7C, 0x70, 0x32,
+    0x82, 0x88, 0xFF, 0x25, 0x48, 0xCF, 0xA6, 0xF7, 0x48, 0x67, 0x6B, 0x0B, 0x72, 0xD0, 0xD9, 0x8B,
+    0x33, 0xA3, 0x94, 0xB3, 0x48, 0xF7, 0x48, 0x8B, 0xF8, 0xC3, 0x47, 0xD5, 0xFD, 0xDD, 0xB5, 0xFD,
+    0xDD, 0x6F, 0x0B, 0x18, 0xCD, 0x49, 0x51, 0x5A, 0xF4, 0xF1, 0x44, 0xD7, 0x95, 0x78, 0x90, 0xF4,
+    0xE9, 0xD7, 0x6F, 0x0C, 0xB3, 0x5B, 0x5A, 0xE2, 0x94, 0xA5, 0x7E, 0xDA, 0xC5, 0x0F, 0x6E, 0xDF,
+    0x7C, 0x92, 0xA1, 0x81, 0xC6, 0x6F, 0x3D, 0x4A, 0xE7, 0x96, 0x30, 0x01, 0x0A, 0x19, 0x19, 0x8D,
+    0x71, 0xA7, 0xFF, 0xD3, 0xF3, 0x67, 0x89, 0x9A, 0x97, 0x9B, 0x5B, 0xDB, 0x05, 0x32, 0x1F, 0x2A,
+    0xDA, 0xE3, 0xDB, 0xAB, 0x81, 0x1A, 0x64, 0x20, 0x42, 0x5B, 0x97, 0x12, 0xCE, 0x61, 0x8F, 0xEB,
+    0xA3, 0x88, 0xA7, 0xB3, 0x9F, 0x98, 0x86, 0x72, 0xA6, 0xE9, 0x22, 0xC5, 0x66, 0xAD, 0x2D, 0x06,
+    0xD7, 0x9E, 0x50, 0x72, 0x26, 0x2E, 0x96, 0xA6, 0xE9, 0x71, 0xD2, 0x98, 0x97, 0xC5, 0x4C, 0x3A,
+    0xD9, 0x80, 0x73, 0x69, 0xEE, 0x0E, 0x45, 0x0B, 0x81, 0xB5, 0x84, 0xEF, 0xF0, 0x0E, 0x28, 0x55,
+    0x34, 0x1C, 0x94, 0x5D, 0x45, 0xCC, 0xFE, 0x04, 0x17, 0xC4, 0x7A, 0xCB, 0x6B, 0x35, 0x15, 0x8D,
+    0xB6, 0xDC, 0x72, 0xE7, 0x17, 0x9D, 0x4C, 0x39, 0x95, 0x75, 0xDD, 0x76, 0xEC, 0xD0, 0x38, 0x76,
+    0x54, 0x9D, 0x95, 0xA5, 0xB8, 0x2D, 0xED, 0x28, 0xA9, 0xCB, 0xE9, 0x48, 0xB7, 0xEB, 0xCE, 0x28,
+    0xBC, 0xD9, 0x06, 0x6D, 0x3E, 0xDA, 0xD3, 0x75, 0x23, 0x17, 0xEC, 0x41, 0xB0, 0x17, 0xD7, 0xBB,
+    0xD2, 0xFD, 0x07, 0x96, 0x80, 0x8A, 0xF6, 0xEF, 0xD2, 0x64, 0xFA, 0xBA, 0x96, 0xA1, 0x42, 0x6A,
+    0xB3, 0x38, 0x0F, 0xAF, 0xC2, 0xA1, 0xEA, 0xAB, 0x19, 0x33, 0xC4, 0xF7, 0xDF, 0xF0, 0x93, 0xF4,
+    0x80, 0xCC, 0xAD, 0xAF, 0xE1, 0x89, 0x62, 0xC9, 0x9B, 0x87, 0x63, 0x91, 0xEB, 0xC7, 0x7C, 0x08,
+    0xE5, 0x97, 0x97, 0x77, 0x48, 0x33, 0x63, 0xFF, 0x27, 0x9E, 0x45, 0x66, 0xEF, 0x86, 0x30, 0xA7,
+    0xD7, 0xD4, 0xCA, 0x8D, 0xE9, 0x9D, 0x7B, 0x86, 0xFE, 0x28, 0x5F, 0x44, 0xF9, 0x59, 0x85, 0xEE,
+    0xC7, 0xAB, 0x79, 0x5F, 0xD1, 0xA6, 0x5B, 0x4A, 0xAA, 0x2A, 0xB3, 0x3E, 0x42, 0x39, 0xE3, 0x1B,
+    0xBB, 0x21, 0x36, 0xA2, 0x7A, 0xDD, 0xBE, 0x1F, 0xB5, 0x6B, 0x33, 0xBC, 0x5B, 0xEB, 0x26, 0x3F,
+    0x7C, 0x9D, 0xC7, 0x89, 0x5C, 0x83, 0x1F, 0xF2, 0x3D, 0x43, 0x61, 0xAD, 0x56, 0x89, 0x4C, 0xD3,
+    0x72, 0xCF, 0x18, 0x0E, 0x08, 0xA6, 0x35, 0xE7, 0xD3, 0xE6, 0xF4, 0x93, 0xED, 0xC4, 0x37, 0x1C,
+    0xB4, 0x61, 0x0A, 0x64, 0x60, 0xFF, 0xAE, 0x89, 0x54, 0x65, 0x10, 0x72, 0x52, 0x0F, 0xB2, 0xFB,
+    0xD4, 0xAB, 0x76, 0x8B, 0x5B, 0xA7, 0xE8, 0x92, 0x6E, 0x43, 0x2C, 0x06, 0x3F, 0xC6, 0x82, 0xD0,
+    0x33, 0xA2, 0x13, 0x77, 0x9D, 0x4B, 0x6E, 0x73, 0x78, 0x00, 0xF8, 0xBF, 0x7E, 0xDB, 0xF8, 0x33,
+    0x44, 0x59, 0x5A, 0xEB, 0xEC, 0x7E, 0xA1, 0x1B, 0xBC, 0xA9, 0x43, 0xA2, 0x39, 0x6A, 0x79, 0xB7,
+    0x33, 0x0E, 0x79, 0xFD, 0x70, 0xD9, 0x34, 0x47, 0xF1, 0xBD, 0x19, 0x4E, 0x16, 0xDE, 0x7C, 0x7B,
+    0xB0, 0xC3, 0xEC, 0x9A, 0xAB, 0xC3, 0x40, 0x8A, 0x27, 0x45, 0xAD, 0xCE, 0x43, 0x45, 0x22, 0xC5,
+    0xFC, 0xD9, 0xBA, 0x9F, 0xBE, 0xB1, 0x54, 0xC6, 0x54, 0x89, 0xE6, 0x32, 0x07, 0x6D, 0x4B, 0x57,
+    0x42, 0xC7, 0x53, 0xF1, 0xA9, 0x93, 0x5F, 0xEC, 0xBF, 0x00, 0x75, 0x55, 0x3F, 0x6C, 0xDF, 0x44,
+    0x14, 0x7E, 0xF6, 0x95, 0x58, 0xC2, 0x83, 0x19, 0xE8, 0x54, 0x09, 0x4B, 0x8C, 0x50, 0xC9, 0x6B,
+    0x86, 0x90, 0x73, 0xDA, 0x31, 0x43, 0x32, 0x34, 0xEA, 0x58, 0x06, 0x16, 0x98, 0x18, 0x10, 0x53,
+    0xD2, 0x73, 0x14, 0xA4, 0x0C, 0x5D, 0x2A, 0x84, 0xC4, 0xC0, 0x40, 0x25, 0x18, 0xDA, 0x32, 0x74,
+    0xED, 0x90, 0xC6, 0x4E, 0x7E, 0x42, 0x1D, 0x3A, 0xD4, 0x69, 0xA9, 0x3A, 0x20, 0x51, 0xE7, 0x0F,
+    0xAA, 0x48, 0x25, 0x72, 0x89, 0x0E, 0xEA, 0x5F, 0x6A, 0xDF, 0xE3, 0x7B, 0xFE, 0xB5, 0x03, 0x42,
+    0x58, 0x3A, 0xDF, 0xBF, 0x77, 0xEF, 0xBE, 0xF7, 0xDE, 0xF7, 0xDE, 0x11, 0x11, 0xA5, 0x9E, 0x62,
+    0xB6, 0x21, 0x7B, 0xD2, 0x15, 0x45, 0x8E, 0xC8, 0x04, 0x4B, 0x97, 0x6D, 0xE9, 0x4D, 0xCC, 0xCF,
+    0x5D, 0xB9, 0xA4, 0xAF, 0x61, 0x8F, 0xFB, 0x84, 0xB9, 0x4E, 0xB9, 0xA7, 0xD8, 0x12, 0x95, 0x84,
+    0x13, 0x0D, 0x95, 0x7E, 0xE8, 0xC8, 0x36, 0xA4, 0xEE, 0xE7, 0x81, 0x28, 0xE0, 0x5E, 0x31, 0x5B,
+    0x7D, 0xF4, 0xDE, 0xAA, 0x9F, 0xF9, 0x22, 0xB1, 0x7B, 0x95, 0xBE, 0xBF, 0x40, 0xFE, 0xFC, 0xB4,
+    0x6A, 0x8F, 0x9B, 0x64, 0x7F, 0x3D, 0xD7, 0xBF, 0x9D, 0xA7, 0xD2, 0xD9, 0x80, 0x47, 0x45, 0xC8,
+    0x47, 0x2D, 0x14, 0x37, 0x68, 0x45, 0x74, 0x65, 0x91, 0xCE, 0x4F, 0x13, 0x2D, 0xE6, 0x24, 0x5F,
+    0xC0, 0x2D, 0x61, 0x47, 0x73, 0x17, 0x77, 0x41, 0xC1, 0x44, 0x59, 0x4D, 0xAA, 0x23, 0xD2, 0xDB,
+    0xFB, 0xFB, 0xAD, 0xBE, 0xA7, 0xD7, 0xF8, 0x71, 0xAB, 0x6B, 0x3D, 0x6A, 0xC3, 0x4E, 0x17, 0xE9,
+    0x3E, 0x84, 0xCD, 0x57, 0x11, 0x73, 0x95, 0x71, 0x47, 0x86, 0x0B, 0x12, 0x78, 0x3C, 0x02, 0x10,
+    0xE6, 0x4E, 0x3F, 0xB9, 0x94, 0xD8, 0xE1, 0x34, 0xF4, 0xE8, 0xC3, 0x5B, 0xB0, 0x63, 0x0D, 0xBA,
+    0x79, 0x69, 0x11, 0xD6, 0xA6, 0x7F, 0x2D, 0xE2, 0x4C, 0x34, 0x31, 0xFD, 0xB5, 0x18, 0x0D, 0x2E,
+    0xC9, 0x33, 0xB6, 0x29, 0xB7, 0xB1, 0x3B, 0x33, 0x39, 0x1A, 0x96, 0x87, 0x05, 0xB3, 0xFB, 0xD0,
+    0xDF, 0xC4, 0x04, 0x36, 0xD6, 0x98, 0xC8, 0x4E, 0x4F, 0x81, 0xC7, 0xFE, 0x9B, 0x4F, 0xCE, 0xBF,
+    0x2D, 0x46, 0x04, 0x56, 0xF4, 0xCC, 0x52, 0x78, 0xA3, 0x5C, 0xE7, 0xEB, 0xDA, 0xF0, 0x70, 0xAD,
+    0xE0, 0xB1, 0xA5, 0xD3, 0x8F, 0x3B, 0xE5, 0x03, 0xAF, 0xAB, 0xAC, 0x4E, 0xF6, 0x61, 0x04, 0x79,
+    0x5D, 0x64, 0x15, 0x86, 0x6A, 0x18, 0x96, 0x32, 0x4C, 0x64, 0xB8, 0xCA, 0x32, 0xD4, 0x32, 0x5C,
+    0xC7, 0xB0, 0xA1, 0x76, 0x40, 0x27, 0xBF, 0xB0, 0x91, 0x51, 0x93, 0x14, 0xA6, 0x9A, 0x0D, 0x38,
+    0x6F, 0x23, 0xAF, 0x9A, 0x74, 0x23, 0x29, 0x56, 0xDC, 0x6C, 0xCC, 0xA7, 0x5E, 0xE3, 0xAA, 0xF4,
+    0xFB, 0x2B, 0xC5, 0xCA, 0x47, 0xB3, 0xB0, 0x98, 0x33, 0x99, 0x5E, 0x7C, 0x56, 0xAC, 0xC4, 0x9B,
+    0x81, 0x4B, 0xDB, 0xA8, 0xD6, 0x4D, 0x9A, 0x73, 0xB1, 0x02, 0xF0, 0xDA, 0x03, 0x6F, 0x82, 0xC8,
+    0x0E, 0x66, 0x11, 0xF9, 0x54, 0x3C, 0x2D, 0x5E, 0x4F, 0x9A, 0x6C, 0xCB, 0xAA, 0x36, 0xB6, 0x1B,
+    0xE4, 0x55, 0xA7, 0x2F, 0xE9, 0xEF, 0xBC, 0x61, 0x68, 0xD3, 0xE2, 0xDB, 0xA9, 0x7E, 0x91, 0x7F,
+    0x24, 0x03, 0x49, 0x4A, 0x05, 0x59, 0x04, 0x49, 0x0A, 0x80, 0x14, 0xFC, 0xF9, 0x03, 0x8B, 0x09,
+    0x2F, 0x00, 0x21, 0x57, 0x83, 0x3F, 0x87, 0x3B, 0xA0, 0x5E, 0x86, 0x88, 0x2D, 0xA9, 0xB1, 0xC1,
+    0x86, 0x9E, 0xEB, 0xA6, 0xBC, 0x72, 0xE9, 0x36, 0xBC, 0x32, 0xD7, 0x19, 0x5E, 0x73, 0xFA, 0x81,
+    0x7D, 0x47, 0xB3, 0x2B, 0x21, 0xDB, 0x47, 0x3D, 0x64, 0xAB, 0xAC, 0x57, 0xE3, 0x1E, 0x94, 0xD1,
+    0x0B, 0x96, 0xCA, 0x91, 0x2B, 0x73, 0x84, 0xFC, 0x62, 0x4B, 0xE9, 0xC8, 0x65, 0x0F, 0xBE, 0xED,
+    0x74, 0xEE, 0x4B, 0xBE, 0xE8, 0x92, 0x97, 0x02, 0x5C, 0xBE, 0x95, 0xA0, 0x53, 0xBB, 0x40, 0x9C,
+    0xAC, 0x59, 0x5D, 0x5D, 0x4D, 0x2A, 0x9E, 0x73, 0x5A, 0xFD, 0x19, 0x57, 0x1B, 0xE9, 0xDD, 0x2C,
+    0x74, 0x2B, 0xB6, 0x8B, 0x1E, 0xED, 0x8F, 0x9A, 0x12, 0x1E, 0x39, 0x91, 0x68, 0x54, 0x9D, 0x1B,
+    0xBB, 0xF0, 0xE5, 0xF6, 0x8B, 0x2A, 0x7E, 0x16, 0x1F, 0x51, 0xBA, 0x91, 0xB6, 0xA4, 0x1B, 0xDD,
+    0x10, 0xE7, 0x9C, 0xAB, 0x1E, 0xE1, 0x88, 0x2D, 0x08, 0x5F, 0xF2, 0x41, 0xF0, 0x8A, 0xB9, 0x05,
+    0xC7, 0xB8, 0x4D, 0x39, 0x8F, 0xAD, 0xE9, 0xDF, 0x4A, 0x76, 0xD8, 0x6D, 0x66, 0xEB, 0xFC, 0xA8,
+    0xDD, 0x4C, 0x79, 0x7E, 0xAF, 0x35, 0x7D, 0x76, 0x6D, 0xF7, 0xBF, 0x4B, 0x7B, 0x58, 0x3A, 0xBB,
+    0x70, 0xF4, 0xA8, 0x25, 0x63, 0xE6, 0x4F, 0xEF, 0x74, 0x3D, 0x42, 0x01, 0x3B, 0xD8, 0x89, 0x2F,
+    0xAA, 0x81, 0x5A, 0xC0, 0x01, 0xBE, 0xD2, 0x59, 0xF3, 0x8B, 0x4C, 0xF5, 0x1E, 0x08, 0xF9, 0xCA,
+    0x22, 0x80, 0x5B, 0x7C, 0x81, 0x63, 0x70, 0x42, 0xD7, 0xB1, 0xE5, 0x3C, 0x1B, 0xC1, 0x0F, 0x32,
+    0x4D, 0x6D, 0x2A, 0xBB, 0x95, 0xF1, 0x4C, 0x66, 0xF7, 0x35, 0x63, 0xC5, 0xB1, 0x1D, 0x78, 0x08,
+    0xDA, 0x4D, 0x21, 0x03, 0x4A, 0xB0, 0x05, 0x21, 0x2D, 0xEB, 0x8F, 0x85, 0xA4, 0x69, 0x8D, 0x4B,
+    0x6E, 0x17, 0x08, 0x1D, 0x65, 0xA7, 0x37, 0xE5, 0x5A, 0xC4, 0x22, 0x17, 0x81, 0xD8, 0x49, 0x98,
+    0x91, 0x60, 0xCD, 0x19, 0x28, 0x70, 0xC8, 0x9E, 0x9A, 0x32, 0x1E, 0xB2, 0x30, 0xC1, 0xAD, 0xBA,
+    0x30, 0x39, 0x42, 0xAF, 0x5A, 0xB0, 0xB3, 0x01, 0x55, 0xAE, 0x59, 0xF2, 0x26, 0x57, 0xAF, 0x24,
+    0x3D, 0x85, 0x04, 0x3C, 0xC5, 0xFC, 0x8D, 0x6A, 0x3D, 0x25, 0x7B, 0x1D, 0xE9, 0xB5, 0x96, 0x7C,
+    0xEC, 0x54, 0x9B, 0x58, 0x30, 0xA7, 0xD6, 0x85, 0xAE, 0x40, 0xFB, 0x17, 0x90, 0x82, 0xBF, 0x8F,
+    0x2F, 0xF7, 0x97, 0x28, 0xFB, 0x99, 0x42, 0x6F, 0x29, 0xEB, 0xD1, 0x0D, 0xD6, 0x67, 0x9D, 0x8D,
+    0x91, 0x7C, 0xEF, 0xE3, 0x46, 0xCC, 0xE2, 0x8E, 0x22, 0x10, 0xE6, 0x4B, 0x20, 0xCE, 0x2A, 0x0A,
+    0xDF, 0x58, 0x36, 0xC5, 0x63, 0xFC, 0xA3, 0xC1, 0x36, 0xB9, 0x17, 0xFF, 0x77, 0xC9, 0xC8, 0xE4,
+    0x33, 0x05, 0xD6, 0x42, 0xD6, 0x14, 0x62, 0x85, 0xD8, 0xA1, 0x86, 0xA4, 0x04, 0x0D, 0x45, 0xAA,
+    0x04, 0x39, 0x3F, 0x85, 0xE2, 0xB4, 0x61, 0x97, 0x34, 0xF0, 0x21, 0xCB, 0xF6, 0x66, 0xBC, 0xD3,
+    0xA9, 0x5E, 0x07, 0xAE, 0x8C, 0x7D, 0x52, 0xDD, 0xD3, 0xEC, 0x23, 0x67, 0xE0, 0x0B, 0x84, 0x61,
+    0x9D, 0x0F, 0xC8, 0x0F, 0xD6, 0xEB, 0x49, 0x19, 0x18, 0xD8, 0x1B, 0x35, 0x43, 0xBE, 0xB9, 0x61,
+    0x69, 0x02, 0x4A, 0xBF, 0x71, 0xBA, 0x69, 0x28, 0xE5, 0x0A, 0x6C, 0x25, 0x3D, 0xDF, 0x44, 0xEE,
+    0x2A, 0x99, 0xF9, 0x46, 0xB5, 0x9B, 0xA4, 0x1F, 0x56, 0x01, 0xE2, 0x91, 0xB0, 0x88, 0x04, 0x80,
+    0x39, 0xA3, 0x9B, 0xF8, 0x57, 0x06, 0xFC, 0x36, 0x63, 0x3D, 0x7A, 0xBA, 0xD3, 0x6F, 0x4C, 0x0B,
+    0x5E, 0xC9, 0x32, 0x2B, 0x5D, 0x80, 0x42, 0x9A, 0x75, 0x52, 0x4C, 0x52, 0xBE, 0x8E, 0x30, 0xB8,
+    0x00, 0xF6, 0x46, 0x2E, 0x6B, 0x5E, 0x53, 0x75, 0xAB, 0x0F, 0xBB, 0x73, 0xA7, 0x77, 0x5A, 0x0C,
+    0xAD, 0xB9, 0x80, 0xE2, 0x71, 0xC7, 0xC2, 0x23, 0x79, 0x8A, 0x63, 0x26, 0xA7, 0x00, 0x7E, 0x90,
+    0xCA, 0x8D, 0x40, 0xCB, 0x74, 0x52, 0x7E, 0xCE, 0x61, 0x0F, 0x69, 0x8F, 0x50, 0xBB, 0xC4, 0xDB,
+    0xCF, 0xB3, 0x63, 0x4B, 0x7A, 0xC7, 0x92, 0xD9, 0x42, 0x5B, 0x05, 0xA9, 0xE7, 0xB8, 0x93, 0x66,
+    0xA4, 0xAD, 0x9E, 0x74, 0x7A, 0x0B, 0x6D, 0xF7, 0xA4, 0x4B, 0xC7, 0x27, 0x1D, 0xE8, 0xD8, 0x85,
+    0x3C, 0x54, 0xD3, 0x83, 0x41, 0x97, 0xB4, 0x04, 0x17, 0x44, 0x5E, 0xF2, 0x58, 0x68, 0x2B, 0xEF,
+    0xC4, 0x26, 0x3C, 0xF1, 0x3D, 0x0A, 0xE7, 0x73, 0xA7, 0xA4, 0xB4, 0xFD, 0xE4, 0xCB, 0x43, 0xEA,
+    0x95, 0x9B, 0x2A, 0x6F, 0xF3, 0x0F, 0xB2, 0x90, 0xFE, 0x7E, 0x79, 0x1C, 0x59, 0x29, 0x1E, 0x08,
+    0x92, 0x07, 0x42, 0x60, 0xF3, 0x12, 0xF6, 0xC1, 0xAF, 0x31, 0xD7, 0x30, 0xB2, 0x91, 0xAA, 0x13,
+    0xE7, 0x66, 0x48, 0x05, 0x14, 0xE0, 0x0F, 0x6E, 0x97, 0x83, 0x91, 0x11, 0x6E, 0xD0, 0xF2, 0xA2,
+    0x00, 0x25, 0xA6, 0x78, 0x72, 0x84, 0x10, 0x71, 0x1B, 0xDC, 0x48, 0x86, 0x4A, 0xCF, 0x70, 0xD4,
+    0xC1, 0xE4, 0xB5, 0x90, 0x17, 0xA9, 0xC7, 0x94, 0xA1, 0xAE, 0x4D, 0xC6, 0x7F, 0x57, 0xE5, 0x7A,
+    0x85, 0x34, 0x41, 0x75, 0x5C, 0x26, 0x33, 0x67, 0xC3, 0x3E, 0xAA, 0x62, 0x87, 0x69, 0xBD, 0x3C,
+    0x18, 0xCE, 0x51, 0xA5, 0xFA, 0x14, 0xA6, 0x2C, 0x7F, 0x22, 0x8F, 0x1A, 0x5A, 0x1E, 0x49, 0x51,
+    0x5A, 0x9E, 0xA8, 0xBA, 0x31, 0x95, 0xD3, 0x86, 0x6A, 0x48, 0x87, 0x2D, 0x65, 0x87, 0x7C, 0x0B,
+    0x08, 0xF8, 0x0A, 0x5A, 0x5D, 0x46, 0xED, 0x60, 0x86, 0xA4, 0x45, 0xD8, 0x21, 0x7A, 0xA5, 0xFA,
+    0xD7, 0x02, 0x5C, 0xAA, 0xF8, 0x2E, 0xD8, 0xE8, 0x51, 0x34, 0x26, 0x39, 0x34, 0xF9, 0x22, 0xAE,
+    0x87, 0x24, 0x47, 0x56, 0xB6, 0xF0, 0xE2, 0x39, 0x92, 0x22, 0x39, 0xA4, 0x1D, 0xC9, 0x63, 0x15,
+    0xC9, 0x6F, 0x48, 0x3A, 0x23, 0xEB, 0x46, 0x6A, 0x7C, 0xB9, 0xFD, 0xF5, 0xEE, 0x2E, 0x4A, 0x22,
+    0x3F, 0x7C, 0xBA, 0x3C, 0x33, 0xD3, 0xE9, 0xD1, 0xE8, 0xA8, 0x28, 0x7D, 0x69, 0xD5, 0x11, 0xDC,
+    0x32, 0x3D, 0x33, 0x43, 0x6A, 0x6D, 0x54, 0x21, 0x3A, 0xFC, 0x1C, 0xC8, 0xD0, 0x1D, 0x2F, 0x2D,
+    0x2D, 0x4D, 0x92, 0x04, 0x25, 0x9A, 0x5F, 0x62, 0xF1, 0xAC, 0x79, 0xB2, 0x38, 0xBC, 0x99, 0x15,
+    0xFD, 0x6F, 0x47, 0xF4, 0x0F, 0x65, 0x92, 0x3F, 0x6F, 0xD4, 0x40, 0x10, 0xC5, 0x9F, 0xCF, 0x87,
+    0xB6, 0xB8, 0xC2, 0x14, 0x74, 0x48, 0x98, 0x4F, 0x10, 0xB7, 0x14, 0xE4, 0xD6, 0x90, 0x92, 0xF6,
+    0xAE, 0x8A, 0x74, 0xD0, 0xE7, 0x3B, 0xB0, 0x07, 0x2D, 0x05, 0x7C, 0x04, 0x4A, 0x94, 0x2A, 0x05,
+    0xD7, 0xC1, 0xF9, 0x68, 0x68, 0x68, 0x2C, 0x51, 0xA6, 0x88, 0x45, 0xE8, 0xD2, 0x18, 0xC9, 0x41,
+    0x8E, 0xB4, 0xDE, 0xC7, 0x5B, 0x47, 0x09, 0x45, 0xAC, 0xF5, 0x4F, 0xB3, 0x7F, 0x66, 0xE6, 0xCD,
+    0xEC, 0x3A, 0xD2, 0x91, 0xA8, 0x4A, 0xD8, 0x9D, 0x63, 0x88, 0x76, 0xB1, 0x83, 0x5B, 0x1F, 0x11,
+    0xAE, 0xD7, 0x1A, 0x8A, 0x1A, 0x59, 0x0B, 0xD3, 0x23, 0x1D, 0x90, 0x10, 0xA8, 0xD6, 0xB0, 0xB5,
+    0x69, 0x01, 0x07, 0x98, 0x3F, 0x27, 0x70, 0xC4, 0x8C, 0xEB, 0x8C, 0x25, 0xF8, 0xB7, 0x9D, 0x6A,
+    0x96, 0x87, 0x32, 0x23, 0xB6, 0x17, 0x6D, 0xD6, 0x38, 0x0C, 0xA6, 0xCD, 0x6A, 0x97, 0x7A, 0xD3,
+    0x56, 0xA5, 0x63, 0x63, 0xD8, 0xC3, 0x5D, 0xE1, 0xF6, 0xCB, 0x15, 0x07, 0x4F, 0xBE, 0x08, 0x27,
+    0xFB, 0xC2, 0xE7, 0xB9, 0x50, 0x91, 0x5C, 0x5B, 0xA1, 0xCB, 0x05, 0x9F, 0xBC, 0x5E, 0x2E, 0xB7,
+    0x98, 0x4F, 0x91, 0x61, 0xBE, 0xF7, 0x34, 0x83, 0x76, 0x1E, 0xA1, 0xF8, 0x79, 0xE1, 0x61, 0x93,
+    0x37, 0x1F, 0xC1, 0x35, 0x30, 0x39, 0xFB, 0x9D, 0x00, 0xA9, 0xA4, 0x4B, 0xA1, 0x80, 0x82, 0x37,
+    0x09, 0xB6, 0x11, 0xE1, 0x2E, 0x0A, 0x5E, 0x61, 0x12, 0x13, 0x65, 0x42, 0x5B, 0x74, 0x21, 0xEF,
+    0xED, 0x2E, 0xA4, 0xDE, 0x95, 0x21, 0x19, 0x2A, 0x1D, 0x19, 0x11, 0x2A, 0x7C, 0x8D, 0xC0, 0x1D,
+    0xCC, 0xE4, 0x2F, 0x25, 0x90, 0x77, 0x3A, 0x1C, 0x0E, 0x59, 0x6B, 0xE4, 0x9F, 0x37, 0x6A, 0xDA,
+    0xC1, 0xF0, 0xD0, 0x6B, 0xF5, 0x9C, 0xD4, 0x21, 0x7E, 0x48, 0x3D, 0x62, 0xFF, 0x24, 0x6E, 0xA7,
+    0x54, 0x30, 0xC3, 0x22, 0x4E, 0x63, 0x63, 0x25, 0x76, 0x2A, 0x6C, 0x1A, 0x1D, 0x90, 0xA4, 0x19,
+    0x03, 0x8C, 0xEA, 0x05, 0x2F, 0x25, 0xE8, 0x74, 0x55, 0x1D, 0xF8, 0xCD, 0xB9, 0x77, 0xEF, 0x56,
+    0xC5, 0x8F, 0x6E, 0xF3, 0x6B, 0xA8, 0x5E, 0xAC, 0xF2, 0xD3, 0xEE, 0x7E, 0xB9, 0x70, 0xA5, 0x4A,
+    0xF5, 0xB1, 0x84, 0x18, 0x22, 0x16, 0x9A, 0x86, 0xB1, 0x6E, 0x76, 0x85, 0xF0, 0x3C, 0x1A, 0xC9,
+    0x3D, 0xA4, 0xEF, 0xE3, 0xA8, 0x58, 0x92, 0x0D, 0xD9, 0xF3, 0xD0, 0x33, 0xBD, 0x19, 0xEC, 0xC8,
+    0x3A, 0xD2, 0x78, 0x4E, 0x06, 0x26, 0x43, 0xA4, 0x19, 0x94, 0x5C, 0xBD, 0x20, 0xCB, 0x6B, 0x5F,
+    0x05, 0x41, 0xD5, 0xCC, 0xE8, 0x0B, 0x76, 0xB6, 0x7E, 0xA5, 0x17, 0x42, 0xFC, 0x1F, 0x9A, 0xBA,
+    0xDD, 0x03, 0xCB, 0x3E, 0x63, 0x3F, 0x61, 0x77, 0xDD, 0xED, 0x31, 0x82, 0x5F, 0x2E, 0x17, 0xB2,
+    0xD5, 0x9D, 0x33, 0xF2, 0xF2, 0xF8, 0xF8, 0x93, 0x14, 0x8E, 0xBB, 0x36, 0x22, 0x1D, 0xAF, 0xC6,
+    0x8E, 0xBA, 0xC7, 0xBB, 0xDA, 0x47, 0x21, 0xB3, 0x89, 0xB4, 0xDF, 0x6B, 0x17, 0x57, 0xBF, 0x51,
+    0x07, 0x82, 0xA1, 0xCC, 0xC6, 0xB2, 0x60, 0x48, 0x19, 0x2C, 0xDB, 0x71, 0xBC, 0x65, 0xDC, 0x7C,
+    0xC9, 0x36, 0x26, 0x90, 0xBF, 0x55, 0xB7, 0xC4, 0x67, 0x63, 0xA8, 0xF8, 0x2C, 0x31, 0xAF, 0xC6,
+    0x0C, 0xED, 0x6D, 0x4A, 0x3C, 0xD6, 0xFF, 0x0F,
+};
+
+static const uint32_t notosans_12_boldBlockOffsets[27] = {
+    0, 1235, 2331, 3552, 4509, 5324, 6259, 7042,
+    7896, 8719, 9512, 10615, 11855, 12833, 14006, 15179,
+    16274, 17388, 18487, 19338, 20498, 21606, 22740, 23924,
+    25018, 26357, 26824,
+};
+
+static const uint16_t notosans_12_boldDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_12_boldGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_12_boldPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 0,
 };
 
 static const EpdGlyph notosans_12_boldGlyphs[] = {
@@ -3222,842 +1879,842 @@ static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 15, 18, 18, 2, 18, 68, 1834 }, // D
     { 11, 18, 14, 2, 18, 50, 1902 }, // E
     { 11, 18, 14, 2, 18, 50, 1952 }, // F
-    { 16, 20, 18, 1, 19, 80, 2002 }, // G
-    { 15, 18, 19, 2, 18, 68, 2082 }, // H
-    { 9, 18, 10, 0, 18, 41, 2150 }, // I
-    { 9, 24, 8, -2, 18, 54, 2191 }, // J
-    { 15, 18, 17, 2, 18, 68, 2245 }, // K
-    { 12, 18, 14, 2, 18, 54, 2313 }, // L
-    { 20, 18, 24, 2, 18, 90, 2367 }, // M
-    { 17, 18, 20, 2, 18, 77, 2457 }, // N
-    { 18, 20, 20, 1, 19, 90, 2534 }, // O
-    { 13, 18, 16, 2, 18, 59, 2624 }, // P
-    { 18, 24, 20, 1, 19, 108, 2683 }, // Q
-    { 15, 18, 16, 2, 18, 68, 2791 }, // R
-    { 12, 20, 14, 1, 19, 60, 2859 }, // S
-    { 14, 18, 14, 0, 18, 63, 2919 }, // T
-    { 15, 19, 19, 2, 18, 72, 2982 }, // U
-    { 17, 18, 16, 0, 18, 77, 3054 }, // V
-    { 25, 18, 24, 0, 18, 113, 3131 }, // W
-    { 17, 18, 17, 0, 18, 77, 3244 }, // X
-    { 16, 18, 16, 0, 18, 72, 3321 }, // Y
-    { 14, 18, 14, 0, 18, 63, 3393 }, // Z
-    { 7, 22, 8, 1, 18, 39, 3456 }, // [
-    { 11, 19, 10, 0, 18, 53, 3495 }, // <backslash>
-    { 7, 22, 8, 0, 18, 39, 3548 }, // ]
-    { 14, 12, 14, 0, 18, 42, 3587 }, // ^
-    { 12, 2, 10, -1, -2, 6, 3629 }, // _
-    { 8, 5, 9, 1, 20, 10, 3635 }, // `
-    { 13, 15, 15, 1, 14, 49, 3645 }, // a
-    { 14, 20, 16, 1, 19, 70, 3694 }, // b
-    { 12, 15, 13, 1, 14, 45, 3764 }, // c
-    { 13, 20, 16, 1, 19, 65, 3809 }, // d
-    { 13, 15, 15, 1, 14, 49, 3874 }, // e
-    { 11, 20, 10, 0, 20, 55, 3923 }, // f
-    { 13, 20, 16, 1, 14, 65, 3978 }, // g
-    { 14, 19, 16, 1, 19, 67, 4043 }, // h
-    { 5, 20, 7, 1, 20, 25, 4110 }, // i
-    { 8, 26, 7, -2, 20, 52, 4135 }, // j
-    { 15, 19, 16, 1, 19, 72, 4187 }, // k
-    { 5, 19, 7, 1, 19, 24, 4259 }, // l
-    { 22, 14, 24, 1, 14, 77, 4283 }, // m
-    { 14, 14, 16, 1, 14, 49, 4360 }, // n
-    { 14, 15, 16, 1, 14, 53, 4409 }, // o
-    { 14, 20, 16, 1, 14, 70, 4462 }, // p
-    { 13, 20, 16, 1, 14, 65, 4532 }, // q
-    { 10, 14, 11, 1, 14, 35, 4597 }, // r
-    { 11, 15, 13, 1, 14, 42, 4632 }, // s
-    { 11, 18, 11, 0, 17, 50, 4674 }, // t
-    { 14, 15, 16, 1, 14, 53, 4724 }, // u
-    { 15, 14, 14, 0, 14, 53, 4777 }, // v
-    { 22, 14, 21, 0, 14, 77, 4830 }, // w
-    { 15, 14, 14, 0, 14, 53, 4907 }, // x
-    { 15, 20, 14, 0, 14, 75, 4960 }, // y
-    { 12, 14, 12, 0, 14, 42, 5035 }, // z
-    { 9, 22, 10, 0, 18, 50, 5077 }, // {
-    { 4, 25, 14, 5, 19, 25, 5127 }, // |
-    { 9, 22, 10, 1, 18, 50, 5152 }, // }
-    { 13, 5, 14, 1, 11, 17, 5202 }, // ~
-    { 0, 0, 7, 0, 0, 0, 5219 }, //  
-    { 5, 19, 7, 1, 14, 24, 5219 }, // ¡
-    { 12, 20, 14, 1, 19, 60, 5243 }, // ¢
-    { 13, 19, 14, 1, 19, 62, 5303 }, // £
-    { 12, 12, 14, 1, 15, 36, 5365 }, // ¤
-    { 15, 18, 14, 0, 18, 68, 5401 }, // ¥
-    { 4, 25, 14, 5, 19, 25, 5469 }, // ¦
-    { 10, 21, 12, 1, 20, 53, 5494 }, // §
-    { 9, 4, 15, 3, 19, 9, 5547 }, // ¨
-    { 19, 20, 21, 1, 19, 95, 5556 }, // ©
-    { 9, 10, 10, 0, 19, 23, 5651 }, // ª
-    { 15, 12, 15, 0, 13, 45, 5674 }, // «
-    { 13, 8, 14, 1, 11, 26, 5719 }, // ¬
-    { 8, 4, 8, 0, 9, 8, 5745 }, // ­
-    { 19, 20, 21, 1, 19, 95, 5753 }, // ®
-    { 14, 3, 13, -1, 22, 11, 5848 }, // ¯
-    { 9, 10, 11, 1, 19, 23, 5859 }, // °
-    { 13, 16, 14, 1, 16, 52, 5882 }, // ±
-    { 9, 12, 9, 0, 22, 27, 5934 }, // ²
-    { 9, 12, 10, 0, 22, 27, 5961 }, // ³
-    { 8, 5, 9, 1, 20, 10, 5988 }, // ´
-    { 14, 20, 16, 1, 14, 70, 5998 }, // µ
-    { 14, 23, 16, 1, 19, 81, 6068 }, // ¶
-    { 5, 5, 7, 1, 11, 7, 6149 }, // ·
-    { 7, 6, 7, 0, 0, 11, 6156 }, // ¸
-    { 7, 12, 10, 0, 22, 21, 6167 }, // ¹
-    { 9, 10, 10, 0, 19, 23, 6188 }, // º
-    { 15, 12, 15, 0, 13, 45, 6211 }, // »
-    { 21, 18, 21, 0, 18, 95, 6256 }, // ¼
-    { 21, 18, 22, 0, 18, 95, 6351 }, // ½
-    { 20, 19, 21, 1, 19, 95, 6446 }, // ¾
-    { 12, 19, 12, 0, 14, 57, 6541 }, // ¿
-    { 18, 24, 17, 0, 24, 108, 6598 }, // À
-    { 18, 24, 17, 0, 24, 108, 6706 }, // Á
-    { 18, 24, 17, 0, 24, 108, 6814 }, // Â
-    { 18, 23, 17, 0, 23, 104, 6922 }, // Ã
-    { 18, 23, 17, 0, 23, 104, 7026 }, // Ä
-    { 18, 22, 17, 0, 22, 99, 7130 }, // Å
-    { 23, 18, 24, 0, 18, 104, 7229 }, // Æ
-    { 15, 25, 16, 1, 19, 94, 7333 }, // Ç
-    { 11, 24, 14, 2, 24, 66, 7427 }, // È
-    { 11, 24, 14, 2, 24, 66, 7493 }, // É
-    { 11, 24, 14, 2, 24, 66, 7559 }, // Ê
-    { 11, 23, 14, 2, 23, 64, 7625 }, // Ë
-    { 9, 24, 10, 0, 24, 54, 7689 }, // Ì
-    { 10, 24, 10, 0, 24, 60, 7743 }, // Í
-    { 11, 24, 10, -1, 24, 66, 7803 }, // Î
-    { 10, 23, 10, 0, 23, 58, 7869 }, // Ï
-    { 17, 18, 18, 0, 18, 77, 7927 }, // Ð
-    { 17, 23, 20, 2, 23, 98, 8004 }, // Ñ
-    { 18, 25, 20, 1, 24, 113, 8102 }, // Ò
-    { 18, 25, 20, 1, 24, 113, 8215 }, // Ó
-    { 18, 25, 20, 1, 24, 113, 8328 }, // Ô
-    { 18, 24, 20, 1, 23, 108, 8441 }, // Õ
-    { 18, 24, 20, 1, 23, 108, 8549 }, // Ö
-    { 12, 12, 14, 1, 15, 36, 8657 }, // ×
-    { 18, 21, 20, 1, 19, 95, 8693 }, // Ø
-    { 15, 25, 19, 2, 24, 94, 8788 }, // Ù
-    { 15, 25, 19, 2, 24, 94, 8882 }, // Ú
-    { 15, 25, 19, 2, 24, 94, 8976 }, // Û
-    { 15, 24, 19, 2, 23, 90, 9070 }, // Ü
-    { 16, 24, 16, 0, 24, 96, 9160 }, // Ý
-    { 13, 18, 16, 2, 18, 59, 9256 }, // Þ
-    { 16, 21, 18, 1, 20, 84, 9315 }, // ß
-    { 13, 21, 15, 1, 20, 69, 9399 }, // à
-    { 13, 21, 15, 1, 20, 69, 9468 }, // á
-    { 13, 21, 15, 1, 20, 69, 9537 }, // â
-    { 13, 20, 15, 1, 19, 65, 9606 }, // ã
-    { 13, 20, 15, 1, 19, 65, 9671 }, // ä
-    { 13, 22, 15, 1, 21, 72, 9736 }, // å
-    { 21, 15, 23, 1, 14, 79, 9808 }, // æ
-    { 12, 20, 13, 1, 14, 60, 9887 }, // ç
-    { 13, 21, 15, 1, 20, 69, 9947 }, // è
-    { 13, 21, 15, 1, 20, 69, 10016 }, // é
-    { 13, 21, 15, 1, 20, 69, 10085 }, // ê
-    { 13, 20, 15, 1, 19, 65, 10154 }, // ë
-    { 9, 20, 7, -1, 20, 45, 10219 }, // ì
-    { 8, 20, 7, 1, 20, 40, 10264 }, // í
-    { 11, 20, 7, -2, 20, 55, 10304 }, // î
-    { 10, 19, 7, -1, 19, 48, 10359 }, // ï
-    { 14, 21, 16, 1, 20, 74, 10407 }, // ð
-    { 14, 19, 16, 1, 19, 67, 10481 }, // ñ
-    { 14, 21, 16, 1, 20, 74, 10548 }, // ò
-    { 14, 21, 16, 1, 20, 74, 10622 }, // ó
-    { 14, 21, 16, 1, 20, 74, 10696 }, // ô
-    { 14, 20, 16, 1, 19, 70, 10770 }, // õ
-    { 14, 20, 16, 1, 19, 70, 10840 }, // ö
-    { 13, 13, 14, 1, 15, 43, 10910 }, // ÷
-    { 14, 16, 15, 1, 15, 56, 10953 }, // ø
-    { 14, 21, 16, 1, 20, 74, 11009 }, // ù
-    { 14, 21, 16, 1, 20, 74, 11083 }, // ú
-    { 14, 21, 16, 1, 20, 74, 11157 }, // û
-    { 14, 20, 16, 1, 19, 70, 11231 }, // ü
-    { 15, 26, 14, 0, 20, 98, 11301 }, // ý
-    { 14, 25, 16, 1, 19, 88, 11399 }, // þ
-    { 15, 25, 14, 0, 19, 94, 11487 }, // ÿ
-    { 18, 22, 17, 0, 22, 99, 11581 }, // Ā
-    { 13, 19, 15, 1, 18, 62, 11680 }, // ā
-    { 18, 24, 17, 0, 24, 108, 11742 }, // Ă
-    { 13, 21, 15, 1, 20, 69, 11850 }, // ă
-    { 18, 24, 17, 0, 18, 108, 11919 }, // Ą
-    { 13, 20, 15, 1, 14, 65, 12027 }, // ą
-    { 15, 25, 16, 1, 24, 94, 12092 }, // Ć
-    { 12, 21, 13, 1, 20, 63, 12186 }, // ć
-    { 15, 25, 16, 1, 24, 94, 12249 }, // Ĉ
-    { 12, 21, 13, 1, 20, 63, 12343 }, // ĉ
-    { 15, 25, 16, 1, 24, 94, 12406 }, // Ċ
-    { 12, 21, 13, 1, 20, 63, 12500 }, // ċ
-    { 15, 25, 16, 1, 24, 94, 12563 }, // Č
-    { 12, 21, 13, 1, 20, 63, 12657 }, // č
-    { 15, 24, 18, 2, 24, 90, 12720 }, // Ď
-    { 19, 20, 16, 1, 19, 95, 12810 }, // ď
-    { 17, 18, 18, 0, 18, 77, 12905 }, // Đ
-    { 15, 20, 16, 1, 19, 75, 12982 }, // đ
-    { 11, 22, 14, 2, 22, 61, 13057 }, // Ē
-    { 13, 19, 15, 1, 18, 62, 13118 }, // ē
-    { 11, 24, 14, 2, 24, 66, 13180 }, // Ĕ
-    { 13, 21, 15, 1, 20, 69, 13246 }, // ĕ
-    { 11, 24, 14, 2, 24, 66, 13315 }, // Ė
-    { 13, 21, 15, 1, 20, 69, 13381 }, // ė
-    { 11, 24, 14, 2, 18, 66, 13450 }, // Ę
-    { 13, 20, 15, 1, 14, 65, 13516 }, // ę
-    { 11, 24, 14, 2, 24, 66, 13581 }, // Ě
-    { 13, 21, 15, 1, 20, 69, 13647 }, // ě
-    { 16, 25, 18, 1, 24, 100, 13716 }, // Ĝ
-    { 13, 26, 16, 1, 20, 85, 13816 }, // ĝ
-    { 16, 25, 18, 1, 24, 100, 13901 }, // Ğ
-    { 13, 26, 16, 1, 20, 85, 14001 }, // ğ
-    { 16, 25, 18, 1, 24, 100, 14086 }, // Ġ
-    { 13, 26, 16, 1, 20, 85, 14186 }, // ġ
-    { 16, 25, 18, 1, 19, 100, 14271 }, // Ģ
-    { 13, 26, 16, 1, 20, 85, 14371 }, // ģ
-    { 15, 24, 19, 2, 24, 90, 14456 }, // Ĥ
-    { 17, 25, 16, -2, 25, 107, 14546 }, // ĥ
-    { 20, 18, 19, 0, 18, 90, 14653 }, // Ħ
-    { 15, 19, 16, 0, 19, 72, 14743 }, // ħ
-    { 11, 23, 10, -1, 23, 64, 14815 }, // Ĩ
-    { 11, 19, 7, -2, 19, 53, 14879 }, // ĩ
-    { 9, 22, 10, 0, 22, 50, 14932 }, // Ī
-    { 9, 18, 7, -1, 18, 41, 14982 }, // ī
-    { 10, 24, 10, 0, 24, 60, 15023 }, // Ĭ
-    { 10, 20, 7, -1, 20, 50, 15083 }, // ĭ
-    { 9, 24, 10, 0, 18, 54, 15133 }, // Į
-    { 5, 26, 7, 1, 20, 33, 15187 }, // į
-    { 9, 24, 10, 0, 24, 54, 15220 }, // İ
-    { 5, 14, 7, 1, 14, 18, 15274 }, // ı
-    { 17, 24, 18, 0, 18, 102, 15292 }, // Ĳ
-    { 13, 26, 15, 1, 20, 85, 15394 }, // ĳ
-    { 12, 30, 8, -2, 24, 90, 15479 }, // Ĵ
-    { 11, 26, 7, -2, 20, 72, 15569 }, // ĵ
-    { 15, 24, 17, 2, 18, 90, 15641 }, // Ķ
-    { 15, 25, 16, 1, 19, 94, 15731 }, // ķ
-    { 15, 14, 16, 1, 14, 53, 15825 }, // ĸ
-    { 13, 24, 14, 1, 24, 78, 15878 }, // Ĺ
-    { 8, 25, 7, 1, 25, 50, 15956 }, // ĺ
-    { 12, 24, 14, 2, 18, 72, 16006 }, // Ļ
-    { 5, 25, 7, 1, 19, 32, 16078 }, // ļ
-    { 12, 18, 14, 2, 18, 54, 16110 }, // Ľ
-    { 10, 19, 7, 1, 19, 48, 16164 }, // ľ
-    { 12, 18, 14, 2, 18, 54, 16212 }, // Ŀ
-    { 10, 19, 9, 1, 19, 48, 16266 }, // ŀ
-    { 14, 18, 14, 0, 18, 63, 16314 }, // Ł
-    { 9, 19, 8, -1, 19, 43, 16377 }, // ł
-    { 17, 24, 20, 2, 24, 102, 16420 }, // Ń
-    { 14, 20, 16, 1, 20, 70, 16522 }, // ń
-    { 17, 24, 20, 2, 18, 102, 16592 }, // Ņ
-    { 14, 20, 16, 1, 14, 70, 16694 }, // ņ
-    { 17, 24, 20, 2, 24, 102, 16764 }, // Ň
-    { 14, 20, 16, 1, 20, 70, 16866 }, // ň
-    { 19, 18, 19, -1, 18, 86, 16936 }, // ŉ
-    { 17, 24, 20, 2, 18, 102, 17022 }, // Ŋ
-    { 14, 20, 16, 1, 14, 70, 17124 }, // ŋ
-    { 18, 23, 20, 1, 22, 104, 17194 }, // Ō
-    { 14, 19, 16, 1, 18, 67, 17298 }, // ō
-    { 18, 25, 20, 1, 24, 113, 17365 }, // Ŏ
-    { 14, 21, 16, 1, 20, 74, 17478 }, // ŏ
-    { 18, 25, 20, 1, 24, 113, 17552 }, // Ő
-    { 14, 21, 16, 1, 20, 74, 17665 }, // ő
-    { 22, 20, 24, 1, 19, 110, 17739 }, // Œ
-    { 23, 15, 24, 1, 14, 87, 17849 }, // œ
-    { 15, 24, 16, 2, 24, 90, 17936 }, // Ŕ
-    { 11, 20, 11, 1, 20, 55, 18026 }, // ŕ
-    { 15, 24, 16, 2, 18, 90, 18081 }, // Ŗ
-    { 10, 20, 11, 1, 14, 50, 18171 }, // ŗ
-    { 15, 24, 16, 2, 24, 90, 18221 }, // Ř
-    { 11, 20, 11, 1, 20, 55, 18311 }, // ř
-    { 12, 25, 14, 1, 24, 75, 18366 }, // Ś
-    { 11, 21, 13, 1, 20, 58, 18441 }, // ś
-    { 12, 25, 14, 1, 24, 75, 18499 }, // Ŝ
-    { 11, 21, 13, 1, 20, 58, 18574 }, // ŝ
-    { 12, 25, 14, 1, 19, 75, 18632 }, // Ş
-    { 11, 20, 13, 1, 14, 55, 18707 }, // ş
-    { 12, 25, 14, 1, 24, 75, 18762 }, // Š
-    { 11, 21, 13, 1, 20, 58, 18837 }, // š
-    { 14, 24, 14, 0, 18, 84, 18895 }, // Ţ
-    { 11, 23, 11, 0, 17, 64, 18979 }, // ţ
-    { 14, 24, 14, 0, 24, 84, 19043 }, // Ť
-    { 15, 20, 11, 0, 19, 75, 19127 }, // ť
-    { 14, 18, 14, 0, 18, 63, 19202 }, // Ŧ
-    { 11, 18, 11, 0, 17, 50, 19265 }, // ŧ
-    { 15, 24, 19, 2, 23, 90, 19315 }, // Ũ
-    { 14, 20, 16, 1, 19, 70, 19405 }, // ũ
-    { 15, 23, 19, 2, 22, 87, 19475 }, // Ū
-    { 14, 19, 16, 1, 18, 67, 19562 }, // ū
-    { 15, 25, 19, 2, 24, 94, 19629 }, // Ŭ
-    { 14, 21, 16, 1, 20, 74, 19723 }, // ŭ
-    { 15, 26, 19, 2, 25, 98, 19797 }, // Ů
-    { 14, 22, 16, 1, 21, 77, 19895 }, // ů
-    { 15, 25, 19, 2, 24, 94, 19972 }, // Ű
-    { 14, 21, 16, 1, 20, 74, 20066 }, // ű
-    { 15, 24, 19, 2, 18, 90, 20140 }, // Ų
-    { 14, 20, 16, 1, 14, 70, 20230 }, // ų
-    { 25, 24, 24, 0, 24, 150, 20300 }, // Ŵ
-    { 22, 20, 21, 0, 20, 110, 20450 }, // ŵ
-    { 16, 24, 16, 0, 24, 96, 20560 }, // Ŷ
-    { 15, 26, 14, 0, 20, 98, 20656 }, // ŷ
-    { 16, 23, 16, 0, 23, 92, 20754 }, // Ÿ
-    { 14, 24, 14, 0, 24, 84, 20846 }, // Ź
-    { 12, 20, 12, 0, 20, 60, 20930 }, // ź
-    { 14, 24, 14, 0, 24, 84, 20990 }, // Ż
-    { 12, 20, 12, 0, 20, 60, 21074 }, // ż
-    { 14, 24, 14, 0, 24, 84, 21134 }, // Ž
-    { 12, 20, 12, 0, 20, 60, 21218 }, // ž
-    { 10, 20, 10, 1, 20, 50, 21278 }, // ſ
-    { 8, 5, 0, -14, 20, 10, 21328 }, // ̀
-    { 9, 5, 0, -10, 20, 12, 21338 }, // ́
-    { 11, 5, 0, -6, 20, 14, 21350 }, // ̂
-    { 11, 4, 0, -14, 19, 11, 21364 }, // ̃
-    { 10, 3, 0, -5, 18, 8, 21375 }, // ̄
-    { 12, 4, 0, -6, 22, 12, 21383 }, // ̅
-    { 11, 5, 0, -5, 20, 14, 21395 }, // ̆
-    { 6, 5, 0, -3, 20, 8, 21409 }, // ̇
-    { 10, 4, 0, -5, 19, 10, 21417 }, // ̈
-    { 7, 7, 0, -11, 21, 13, 21427 }, // ̉
-    { 7, 6, 0, -4, 21, 11, 21440 }, // ̊
-    { 11, 5, 0, -4, 20, 14, 21451 }, // ̋
-    { 12, 5, 0, -6, 20, 15, 21465 }, // ̌
-    { 4, 6, 0, -2, 20, 6, 21480 }, // ̍
-    { 8, 6, 0, -4, 20, 12, 21486 }, // ̎
-    { 12, 5, 0, -15, 20, 15, 21498 }, // ̏
-    { 10, 7, 0, -5, 22, 18, 21513 }, // ̐
-    { 10, 5, 0, -5, 20, 13, 21531 }, // ̑
-    { 6, 7, 0, -3, 18, 11, 21544 }, // ̒
-    { 6, 7, 0, -3, 18, 11, 21555 }, // ̓
-    { 6, 7, 0, -3, 18, 11, 21566 }, // ̔
-    { 6, 7, 0, -3, 18, 11, 21577 }, // ̕
-    { 9, 5, 0, -5, 0, 12, 21588 }, // ̖
-    { 8, 5, 0, -4, 0, 10, 21600 }, // ̗
-    { 6, 6, 0, -3, 0, 9, 21610 }, // ̘
-    { 6, 6, 0, -3, 0, 9, 21619 }, // ̙
-    { 7, 6, 8, 0, 19, 11, 21628 }, // ̚
-    { 7, 6, 0, -3, 19, 11, 21639 }, // ̛
-    { 4, 6, 0, -2, 0, 6, 21650 }, // ̜
-    { 6, 5, 0, -3, -1, 8, 21656 }, // ̝
-    { 6, 5, 0, -3, -1, 8, 21664 }, // ̞
-    { 6, 6, 0, -3, 0, 9, 21672 }, // ̟
-    { 6, 3, 0, -3, -2, 5, 21681 }, // ̠
-    { 6, 8, 0, -6, 2, 12, 21686 }, // ̡
-    { 6, 8, 0, 0, 2, 12, 21698 }, // ̢
-    { 5, 5, 0, -11, -1, 7, 21710 }, // ̣
-    { 10, 4, 0, -5, -1, 10, 21717 }, // ̤
-    { 7, 6, 0, -4, 0, 11, 21727 }, // ̥
-    { 6, 5, 0, -3, -1, 8, 21738 }, // ̦
-    { 6, 6, 0, -3, 0, 9, 21746 }, // ̧
-    { 6, 7, 0, -3, 1, 11, 21755 }, // ̨
-    { 4, 6, 0, -2, 0, 6, 21766 }, // ̩
-    { 10, 5, 0, -5, -1, 13, 21772 }, // ̪
-    { 10, 4, 0, -5, -1, 10, 21785 }, // ̫
-    { 11, 5, 0, -5, 0, 14, 21795 }, // ̬
-    { 11, 5, 0, -6, 0, 14, 21809 }, // ̭
-    { 10, 5, 0, -5, 0, 13, 21823 }, // ̮
-    { 10, 5, 0, -5, -1, 13, 21836 }, // ̯
-    { 12, 4, 0, -6, -1, 12, 21849 }, // ̰
-    { 10, 3, 0, -5, -2, 8, 21861 }, // ̱
-    { 12, 2, 0, -6, -2, 6, 21869 }, // ̲
-    { 11, 6, 0, -6, 0, 17, 21875 }, // ̳
-    { 11, 4, 0, -5, 9, 11, 21892 }, // ̴
-    { 12, 4, 0, -6, 9, 12, 21903 }, // ̵
-    { 20, 4, 0, -10, 9, 20, 21915 }, // ̶
-    { 10, 8, 0, -5, 11, 20, 21935 }, // ̷
-    { 12, 21, 0, -6, 19, 63, 21955 }, // ̸
-    { 4, 6, 0, -2, 0, 6, 22018 }, // ̹
-    { 10, 5, 0, -5, -1, 13, 22024 }, // ̺
-    { 10, 6, 0, -5, 0, 15, 22037 }, // ̻
-    { 10, 4, 0, -5, -1, 10, 22052 }, // ̼
-    { 6, 6, 0, -3, 20, 9, 22062 }, // ̽
-    { 4, 8, 0, -2, 22, 8, 22071 }, // ̾
-    { 11, 6, 0, -6, 25, 17, 22079 }, // ̿
-    { 8, 5, 0, -6, 20, 10, 22096 }, // ̀
-    { 8, 5, 0, -2, 20, 10, 22106 }, // ́
-    { 11, 4, 0, -5, 19, 11, 22116 }, // ͂
-    { 5, 6, 0, -3, 20, 8, 22127 }, // ̓
-    { 14, 5, 0, -6, 20, 18, 22135 }, // ̈́
-    { 5, 5, 0, -1, -1, 7, 22153 }, // ͅ
-    { 12, 6, 0, -6, 20, 18, 22160 }, // ͆
-    { 11, 6, 0, -6, 0, 17, 22178 }, // ͇
-    { 8, 6, 0, -4, 0, 12, 22195 }, // ͈
-    { 6, 5, 0, -3, -1, 8, 22207 }, // ͉
-    { 10, 6, 0, -5, 20, 15, 22215 }, // ͊
-    { 10, 11, 0, -5, 24, 28, 22230 }, // ͋
-    { 10, 7, 0, -5, 22, 18, 22258 }, // ͌
-    { 10, 6, 0, -5, 0, 15, 22276 }, // ͍
-    { 6, 6, 0, -3, 0, 9, 22291 }, // ͎
-    { 18, 18, 0, -9, 18, 81, 22300 }, // ͏
-    { 5, 6, 0, -3, 20, 8, 22381 }, // ͐
-    { 4, 7, 0, -2, 21, 7, 22389 }, // ͑
-    { 10, 7, 0, -5, 22, 18, 22396 }, // ͒
-    { 6, 6, 0, -3, 0, 9, 22414 }, // ͓
-    { 5, 5, 0, -3, -1, 7, 22423 }, // ͔
-    { 5, 5, 0, -3, -1, 7, 22430 }, // ͕
-    { 10, 5, 0, -5, -1, 13, 22437 }, // ͖
-    { 4, 7, 0, -2, 21, 7, 22450 }, // ͗
-    { 5, 5, 0, 2, 20, 7, 22457 }, // ͘
-    { 6, 6, 0, -3, 0, 9, 22464 }, // ͙
-    { 10, 6, 0, -5, 0, 15, 22473 }, // ͚
-    { 6, 6, 0, -3, 20, 9, 22488 }, // ͛
-    { 20, 5, 0, -10, -1, 25, 22497 }, // ͜
-    { 20, 5, 0, -10, 20, 25, 22522 }, // ͝
-    { 16, 2, 0, -8, 17, 8, 22547 }, // ͞
-    { 16, 2, 0, -8, -2, 8, 22555 }, // ͟
-    { 20, 4, 0, -10, 19, 20, 22563 }, // ͠
-    { 20, 6, 0, -10, 22, 30, 22583 }, // ͡
-    { 21, 6, 0, -10, 0, 32, 22613 }, // ͢
-    { 6, 7, 0, -3, 22, 11, 22645 }, // ͣ
-    { 7, 7, 0, -3, 22, 13, 22656 }, // ͤ
-    { 3, 9, 0, -1, 24, 7, 22669 }, // ͥ
-    { 7, 7, 0, -3, 22, 13, 22676 }, // ͦ
-    { 7, 6, 0, -3, 21, 11, 22689 }, // ͧ
-    { 6, 7, 0, -3, 22, 11, 22700 }, // ͨ
-    { 6, 9, 0, -3, 24, 14, 22711 }, // ͩ
-    { 7, 9, 0, -3, 24, 16, 22725 }, // ͪ
-    { 10, 7, 0, -5, 22, 18, 22741 }, // ͫ
-    { 5, 7, 0, -2, 22, 9, 22759 }, // ͬ
-    { 5, 8, 0, -2, 23, 10, 22768 }, // ͭ
-    { 7, 6, 0, -3, 21, 11, 22778 }, // ͮ
-    { 8, 6, 0, -4, 21, 12, 22789 }, // ͯ
-    { 11, 24, 14, 2, 24, 66, 22801 }, // Ѐ
-    { 11, 23, 14, 2, 23, 64, 22867 }, // Ё
-    { 19, 19, 19, 0, 18, 91, 22931 }, // Ђ
-    { 12, 24, 14, 2, 24, 72, 23022 }, // Ѓ
-    { 15, 20, 16, 1, 19, 75, 23094 }, // Є
-    { 12, 20, 14, 1, 19, 60, 23169 }, // Ѕ
-    { 4, 18, 8, 2, 18, 18, 23229 }, // І
-    { 8, 24, 8, 0, 24, 48, 23247 }, // Ї
-    { 9, 24, 8, -2, 18, 54, 23295 }, // Ј
-    { 25, 19, 26, 0, 18, 119, 23349 }, // Љ
-    { 24, 18, 27, 2, 18, 108, 23468 }, // Њ
-    { 18, 18, 19, 0, 18, 81, 23576 }, // Ћ
-    { 16, 24, 17, 2, 24, 96, 23657 }, // Ќ
-    { 16, 24, 20, 2, 24, 96, 23753 }, // Ѝ
-    { 17, 25, 16, 0, 24, 107, 23849 }, // Ў
-    { 15, 22, 19, 2, 18, 83, 23956 }, // Џ
-    { 18, 18, 17, 0, 18, 81, 24039 }, // А
-    { 14, 18, 16, 2, 18, 63, 24120 }, // Б
-    { 14, 18, 17, 2, 18, 63, 24183 }, // В
-    { 12, 18, 14, 2, 18, 54, 24246 }, // Г
-    { 20, 22, 19, 0, 18, 110, 24300 }, // Д
-    { 11, 18, 14, 2, 18, 50, 24410 }, // Е
-    { 25, 18, 25, 0, 18, 113, 24460 }, // Ж
-    { 13, 20, 15, 1, 19, 65, 24573 }, // З
-    { 16, 18, 20, 2, 18, 72, 24638 }, // И
-    { 16, 24, 20, 2, 24, 96, 24710 }, // Й
-    { 16, 18, 17, 2, 18, 72, 24806 }, // К
-    { 17, 19, 18, 0, 18, 81, 24878 }, // Л
-    { 20, 18, 24, 2, 18, 90, 24959 }, // М
-    { 15, 18, 19, 2, 18, 68, 25049 }, // Н
-    { 18, 20, 19, 1, 19, 90, 25117 }, // О
-    { 15, 18, 19, 2, 18, 68, 25207 }, // П
-    { 13, 18, 16, 2, 18, 59, 25275 }, // Р
-    { 15, 20, 16, 1, 19, 75, 25334 }, // С
-    { 14, 18, 14, 0, 18, 63, 25409 }, // Т
-    { 17, 19, 16, 0, 18, 81, 25472 }, // У
-    { 21, 20, 23, 1, 19, 105, 25553 }, // Ф
-    { 17, 18, 17, 0, 18, 77, 25658 }, // Х
-    { 18, 22, 19, 2, 18, 99, 25735 }, // Ц
-    { 15, 18, 18, 1, 18, 68, 25834 }, // Ч
-    { 23, 18, 27, 2, 18, 104, 25902 }, // Ш
-    { 25, 22, 27, 2, 18, 138, 26006 }, // Щ
-    { 18, 18, 19, 0, 18, 81, 26144 }, // Ъ
-    { 19, 18, 23, 2, 18, 86, 26225 }, // Ы
-    { 13, 18, 16, 2, 18, 59, 26311 }, // Ь
-    { 14, 20, 16, 1, 19, 70, 26370 }, // Э
-    { 23, 20, 25, 2, 19, 115, 26440 }, // Ю
-    { 15, 18, 17, 0, 18, 68, 26555 }, // Я
-    { 14, 15, 15, 0, 14, 53, 26623 }, // а
-    { 14, 21, 16, 1, 20, 74, 26676 }, // б
-    { 13, 14, 15, 1, 14, 46, 26750 }, // в
-    { 10, 14, 12, 2, 14, 35, 26796 }, // г
-    { 16, 18, 16, 0, 14, 72, 26831 }, // д
-    { 13, 15, 15, 1, 14, 49, 26903 }, // е
-    { 22, 14, 22, 0, 14, 77, 26952 }, // ж
-    { 12, 15, 13, 0, 14, 45, 27029 }, // з
-    { 13, 14, 17, 2, 14, 46, 27074 }, // и
-    { 13, 20, 17, 2, 20, 65, 27120 }, // й
-    { 14, 14, 15, 2, 14, 49, 27185 }, // к
-    { 14, 15, 16, 0, 14, 53, 27234 }, // л
-    { 17, 14, 21, 2, 14, 60, 27287 }, // м
-    { 13, 14, 16, 2, 14, 46, 27347 }, // н
-    { 14, 15, 16, 1, 14, 53, 27393 }, // о
-    { 13, 14, 16, 2, 14, 46, 27446 }, // п
-    { 13, 20, 16, 2, 14, 65, 27492 }, // р
-    { 12, 15, 13, 1, 14, 45, 27557 }, // с
-    { 13, 14, 13, 0, 14, 46, 27602 }, // т
-    { 16, 20, 14, -1, 14, 80, 27648 }, // у
-    { 19, 25, 20, 1, 19, 119, 27728 }, // ф
-    { 15, 14, 14, 0, 14, 53, 27847 }, // х
-    { 15, 18, 16, 1, 14, 68, 27900 }, // ц
-    { 13, 14, 16, 1, 14, 46, 27968 }, // ч
-    { 20, 14, 24, 2, 14, 70, 28014 }, // ш
-    { 22, 18, 24, 2, 14, 99, 28084 }, // щ
-    { 16, 14, 17, 0, 14, 56, 28183 }, // ъ
-    { 18, 14, 21, 2, 14, 63, 28239 }, // ы
-    { 12, 14, 15, 2, 14, 42, 28302 }, // ь
-    { 13, 15, 13, 0, 14, 49, 28344 }, // э
-    { 19, 15, 21, 2, 14, 72, 28393 }, // ю
-    { 14, 14, 15, 0, 14, 49, 28465 }, // я
-    { 13, 21, 15, 1, 20, 69, 28514 }, // ѐ
-    { 13, 20, 15, 1, 19, 65, 28583 }, // ё
-    { 15, 25, 16, 0, 19, 94, 28648 }, // ђ
-    { 10, 20, 12, 2, 20, 50, 28742 }, // ѓ
-    { 12, 15, 13, 1, 14, 45, 28792 }, // є
-    { 11, 15, 12, 1, 14, 42, 28837 }, // ѕ
-    { 5, 19, 8, 1, 19, 24, 28879 }, // і
-    { 8, 19, 7, 0, 19, 38, 28903 }, // ї
-    { 8, 26, 7, -2, 20, 52, 28941 }, // ј
-    { 22, 15, 22, 0, 14, 83, 28993 }, // љ
-    { 21, 14, 23, 2, 14, 74, 29076 }, // њ
-    { 15, 19, 16, 0, 19, 72, 29150 }, // ћ
-    { 14, 20, 15, 2, 20, 70, 29222 }, // ќ
-    { 13, 20, 17, 2, 20, 65, 29292 }, // ѝ
-    { 16, 26, 14, -1, 20, 104, 29357 }, // ў
-    { 13, 18, 16, 2, 14, 59, 29461 }, // џ
-    { 24, 18, 24, 0, 18, 108, 29520 }, // Ѡ
-    { 22, 14, 22, 0, 14, 77, 29628 }, // ѡ
-    { 16, 18, 17, 0, 18, 72, 29705 }, // Ѣ
-    { 16, 17, 17, 0, 17, 68, 29777 }, // ѣ
-    { 21, 20, 24, 2, 19, 105, 29845 }, // Ѥ
-    { 19, 15, 20, 1, 14, 72, 29950 }, // ѥ
-    { 19, 18, 18, 0, 18, 86, 30022 }, // Ѧ
-    { 16, 14, 16, 0, 14, 56, 30108 }, // ѧ
-    { 24, 18, 25, 2, 18, 108, 30164 }, // Ѩ
-    { 22, 14, 23, 1, 14, 77, 30272 }, // ѩ
-    { 20, 18, 20, 0, 18, 90, 30349 }, // Ѫ
-    { 16, 14, 16, 0, 14, 56, 30439 }, // ѫ
-    { 25, 18, 27, 2, 18, 113, 30495 }, // Ѭ
-    { 21, 14, 22, 1, 14, 74, 30608 }, // ѭ
-    { 15, 28, 16, 0, 22, 105, 30682 }, // Ѯ
-    { 13, 23, 14, 0, 17, 75, 30787 }, // ѯ
-    { 18, 18, 22, 2, 18, 81, 30862 }, // Ѱ
-    { 19, 25, 21, 1, 19, 119, 30943 }, // ѱ
-    { 18, 20, 20, 1, 19, 90, 31062 }, // Ѳ
-    { 14, 15, 15, 1, 14, 53, 31152 }, // ѳ
-    { 18, 18, 18, 0, 18, 81, 31205 }, // Ѵ
-    { 16, 14, 15, 0, 14, 56, 31286 }, // ѵ
-    { 18, 24, 18, 0, 24, 108, 31342 }, // Ѷ
-    { 16, 20, 15, 0, 20, 80, 31450 }, // ѷ
-    { 32, 25, 33, 1, 19, 200, 31530 }, // Ѹ
-    { 29, 20, 29, 1, 14, 145, 31730 }, // ѹ
-    { 19, 22, 21, 1, 20, 105, 31875 }, // Ѻ
-    { 15, 18, 17, 1, 16, 68, 31980 }, // ѻ
-    { 25, 28, 27, 1, 27, 175, 32048 }, // Ѽ
-    { 22, 24, 24, 1, 23, 132, 32223 }, // ѽ
-    { 24, 23, 24, 0, 23, 138, 32355 }, // Ѿ
-    { 22, 19, 22, 0, 19, 105, 32493 }, // ѿ
-    { 16, 25, 17, 1, 19, 100, 32598 }, // Ҁ
-    { 12, 20, 13, 1, 14, 60, 32698 }, // ҁ
-    { 13, 17, 15, 1, 16, 56, 32758 }, // ҂
-    { 10, 5, 0, -12, 19, 13, 32814 }, // ҃
-    { 11, 4, 0, -12, 19, 11, 32827 }, // ҄
-    { 5, 6, 0, -9, 20, 8, 32838 }, // ҅
-    { 5, 6, 0, -9, 20, 8, 32846 }, // ҆
-    { 10, 4, 0, -5, 23, 10, 32854 }, // ҇
-    { 30, 27, 0, -15, 20, 203, 32864 }, // ҈
-    { 28, 28, 0, -14, 21, 196, 33067 }, // ҉
-    { 21, 30, 23, 2, 24, 158, 33263 }, // Ҋ
-    { 19, 25, 20, 1, 20, 119, 33421 }, // ҋ
-    { 15, 18, 16, 0, 18, 68, 33540 }, // Ҍ
-    { 15, 19, 15, 0, 19, 72, 33608 }, // ҍ
-    { 13, 18, 16, 2, 18, 59, 33680 }, // Ҏ
-    { 14, 20, 16, 1, 14, 70, 33739 }, // ҏ
-    { 12, 22, 14, 2, 22, 66, 33809 }, // Ґ
-    { 11, 18, 13, 1, 18, 50, 33875 }, // ґ
-    { 14, 18, 14, 0, 18, 63, 33925 }, // Ғ
-    { 12, 14, 12, 0, 14, 42, 33988 }, // ғ
-    { 16, 25, 18, 2, 18, 100, 34030 }, // Ҕ
-    { 14, 21, 15, 1, 14, 74, 34130 }, // ҕ
-    { 26, 24, 26, 0, 18, 156, 34204 }, // Җ
-    { 25, 19, 23, -1, 14, 119, 34360 }, // җ
-    { 13, 25, 15, 1, 19, 82, 34479 }, // Ҙ
-    { 12, 20, 13, 0, 14, 60, 34561 }, // ҙ
-    { 17, 24, 19, 2, 18, 102, 34621 }, // Қ
-    { 16, 19, 16, 1, 14, 76, 34723 }, // қ
-    { 15, 18, 17, 2, 18, 68, 34799 }, // Ҝ
-    { 15, 14, 15, 1, 14, 53, 34867 }, // ҝ
-    { 17, 18, 17, 1, 18, 77, 34920 }, // Ҟ
-    { 16, 19, 16, 0, 19, 76, 34997 }, // ҟ
-    { 19, 18, 18, 0, 18, 86, 35073 }, // Ҡ
-    { 18, 14, 17, 0, 14, 63, 35159 }, // ҡ
-    { 19, 24, 21, 2, 18, 114, 35222 }, // Ң
-    { 17, 19, 19, 1, 14, 81, 35336 }, // ң
-    { 19, 18, 21, 2, 18, 86, 35417 }, // Ҥ
-    { 18, 14, 19, 1, 14, 63, 35503 }, // ҥ
-    { 25, 25, 28, 2, 18, 157, 35566 }, // Ҧ
-    { 21, 21, 22, 1, 14, 111, 35723 }, // ҧ
-    { 18, 21, 19, 1, 19, 95, 35834 }, // Ҩ
-    { 15, 15, 16, 1, 14, 57, 35929 }, // ҩ
-    { 15, 25, 16, 1, 19, 94, 35986 }, // Ҫ
-    { 12, 20, 13, 1, 14, 60, 36080 }, // ҫ
-    { 14, 24, 14, 0, 18, 84, 36140 }, // Ҭ
-    { 14, 19, 14, 0, 14, 67, 36224 }, // ҭ
-    { 16, 18, 16, 0, 18, 72, 36291 }, // Ү
-    { 15, 20, 14, 0, 14, 75, 36363 }, // ү
-    { 16, 18, 16, 0, 18, 72, 36438 }, // Ұ
-    { 15, 20, 14, 0, 14, 75, 36510 }, // ұ
-    { 19, 24, 19, 0, 18, 114, 36585 }, // Ҳ
-    { 16, 19, 16, 0, 14, 76, 36699 }, // ҳ
-    { 23, 24, 23, 0, 18, 138, 36775 }, // Ҵ
-    { 20, 19, 20, 0, 14, 95, 36913 }, // ҵ
-    { 19, 24, 20, 1, 18, 114, 37008 }, // Ҷ
-    { 17, 19, 18, 1, 14, 81, 37122 }, // ҷ
-    { 16, 18, 18, 1, 18, 72, 37203 }, // Ҹ
-    { 14, 14, 16, 1, 14, 49, 37275 }, // ҹ
-    { 15, 18, 18, 2, 18, 68, 37324 }, // Һ
-    { 14, 19, 16, 1, 19, 67, 37392 }, // һ
-    { 22, 20, 24, 0, 19, 110, 37459 }, // Ҽ
-    { 18, 15, 18, -1, 14, 68, 37569 }, // ҽ
-    { 22, 25, 24, 0, 19, 138, 37637 }, // Ҿ
-    { 18, 19, 18, -1, 14, 86, 37775 }, // ҿ
-    { 9, 18, 10, 0, 18, 41, 37861 }, // Ӏ
-    { 25, 24, 25, 0, 24, 150, 37902 }, // Ӂ
-    { 22, 20, 22, 0, 20, 110, 38052 }, // ӂ
-    { 16, 25, 19, 2, 18, 100, 38162 }, // Ӄ
-    { 15, 21, 16, 1, 14, 79, 38262 }, // ӄ
-    { 21, 24, 21, 0, 18, 126, 38341 }, // Ӆ
-    { 18, 19, 18, 0, 14, 86, 38467 }, // ӆ
-    { 15, 25, 19, 2, 18, 94, 38553 }, // Ӈ
-    { 14, 21, 17, 1, 14, 74, 38647 }, // ӈ
-    { 19, 24, 21, 2, 18, 114, 38721 }, // Ӊ
-    { 18, 19, 19, 1, 14, 86, 38835 }, // ӊ
-    { 16, 24, 18, 1, 18, 96, 38921 }, // Ӌ
-    { 14, 19, 16, 1, 14, 67, 39017 }, // ӌ
-    { 24, 24, 26, 2, 18, 144, 39084 }, // Ӎ
-    { 22, 19, 23, 1, 14, 105, 39228 }, // ӎ
-    { 9, 18, 10, 0, 18, 41, 39333 }, // ӏ
-    { 18, 24, 17, 0, 24, 108, 39374 }, // Ӑ
-    { 13, 21, 15, 1, 20, 69, 39482 }, // ӑ
-    { 18, 23, 17, 0, 23, 104, 39551 }, // Ӓ
-    { 13, 20, 15, 1, 19, 65, 39655 }, // ӓ
-    { 23, 18, 24, 0, 18, 104, 39720 }, // Ӕ
-    { 21, 15, 23, 1, 14, 79, 39824 }, // ӕ
-    { 11, 24, 14, 2, 24, 66, 39903 }, // Ӗ
-    { 13, 21, 15, 1, 20, 69, 39969 }, // ӗ
-    { 17, 20, 20, 2, 19, 85, 40038 }, // Ә
-    { 13, 15, 15, 1, 14, 49, 40123 }, // ә
-    { 17, 24, 20, 2, 23, 102, 40172 }, // Ӛ
-    { 13, 20, 15, 1, 19, 65, 40274 }, // ӛ
-    { 25, 23, 25, 0, 23, 144, 40339 }, // Ӝ
-    { 22, 19, 22, 0, 19, 105, 40483 }, // ӝ
-    { 13, 24, 15, 1, 23, 78, 40588 }, // Ӟ
-    { 12, 20, 13, 0, 19, 60, 40666 }, // ӟ
-    { 14, 19, 15, 0, 18, 67, 40726 }, // Ӡ
-    { 14, 20, 15, 0, 14, 70, 40793 }, // ӡ
-    { 16, 22, 20, 2, 22, 88, 40863 }, // Ӣ
-    { 13, 18, 17, 2, 18, 59, 40951 }, // ӣ
-    { 16, 23, 20, 2, 23, 92, 41010 }, // Ӥ
-    { 13, 19, 17, 2, 19, 62, 41102 }, // ӥ
-    { 18, 24, 20, 1, 23, 108, 41164 }, // Ӧ
-    { 14, 20, 16, 1, 19, 70, 41272 }, // ӧ
-    { 18, 20, 20, 1, 19, 90, 41342 }, // Ө
-    { 14, 15, 15, 1, 14, 53, 41432 }, // ө
-    { 18, 24, 20, 1, 23, 108, 41485 }, // Ӫ
-    { 14, 20, 15, 1, 19, 70, 41593 }, // ӫ
-    { 14, 24, 16, 1, 23, 84, 41663 }, // Ӭ
-    { 13, 20, 13, 0, 19, 65, 41747 }, // ӭ
-    { 17, 23, 16, 0, 22, 98, 41812 }, // Ӯ
-    { 16, 24, 14, -1, 18, 96, 41910 }, // ӯ
-    { 17, 24, 16, 0, 23, 102, 42006 }, // Ӱ
-    { 16, 25, 14, -1, 19, 100, 42108 }, // ӱ
-    { 17, 25, 16, 0, 24, 107, 42208 }, // Ӳ
-    { 15, 26, 14, 0, 20, 98, 42315 }, // ӳ
-    { 15, 23, 18, 1, 23, 87, 42413 }, // Ӵ
-    { 13, 19, 16, 1, 19, 62, 42500 }, // ӵ
-    { 12, 24, 14, 2, 18, 72, 42562 }, // Ӷ
-    { 11, 19, 12, 1, 14, 53, 42634 }, // ӷ
-    { 19, 23, 23, 2, 23, 110, 42687 }, // Ӹ
-    { 18, 19, 21, 2, 19, 86, 42797 }, // ӹ
-    { 14, 25, 14, 0, 18, 88, 42883 }, // Ӻ
-    { 12, 20, 12, 0, 14, 60, 42971 }, // ӻ
-    { 18, 25, 18, 0, 18, 113, 43031 }, // Ӽ
-    { 16, 20, 16, 0, 14, 80, 43144 }, // ӽ
-    { 17, 18, 17, 0, 18, 77, 43224 }, // Ӿ
-    { 15, 14, 14, 0, 14, 53, 43301 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 43354 }, //  
-    { 0, 0, 25, 0, 0, 0, 43354 }, //  
-    { 0, 0, 13, 0, 0, 0, 43354 }, //  
-    { 0, 0, 25, 0, 0, 0, 43354 }, //  
-    { 0, 0, 8, 0, 0, 0, 43354 }, //  
-    { 0, 0, 6, 0, 0, 0, 43354 }, //  
-    { 0, 0, 4, 0, 0, 0, 43354 }, //  
-    { 0, 0, 14, 0, 0, 0, 43354 }, //  
-    { 0, 0, 7, 0, 0, 0, 43354 }, //  
-    { 0, 0, 4, 0, 0, 0, 43354 }, //  
-    { 0, 0, 3, 0, 0, 0, 43354 }, //  
-    { 0, 0, 0, 0, 0, 0, 43354 }, // ​
-    { 0, 0, 0, 0, 0, 0, 43354 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 43354 }, // ‍
-    { 7, 22, 0, -1, 18, 39, 43354 }, // ‎
-    { 7, 22, 0, -6, 18, 39, 43393 }, // ‏
-    { 8, 4, 8, 0, 9, 8, 43432 }, // ‐
-    { 8, 4, 8, 0, 9, 8, 43440 }, // ‑
-    { 13, 4, 14, 1, 11, 13, 43448 }, // ‒
-    { 12, 4, 13, 0, 9, 12, 43461 }, // –
-    { 25, 4, 25, 0, 9, 25, 43473 }, // —
-    { 25, 4, 25, 0, 9, 25, 43498 }, // ―
-    { 10, 25, 14, 2, 19, 63, 43523 }, // ‖
-    { 12, 6, 10, -1, 0, 18, 43586 }, // ‗
-    { 6, 7, 5, 0, 18, 11, 43604 }, // ‘
-    { 6, 7, 5, 0, 18, 11, 43615 }, // ’
-    { 6, 7, 7, 0, 4, 11, 43626 }, // ‚
-    { 6, 7, 5, 0, 18, 11, 43637 }, // ‛
-    { 11, 7, 11, 0, 18, 20, 43648 }, // “
-    { 11, 7, 11, 0, 18, 20, 43668 }, // ”
-    { 12, 7, 13, 0, 3, 21, 43688 }, // „
-    { 11, 7, 11, 0, 18, 20, 43709 }, // ‟
-    { 11, 19, 13, 1, 19, 53, 43729 }, // †
-    { 11, 19, 13, 1, 19, 53, 43782 }, // ‡
-    { 8, 8, 9, 1, 13, 16, 43835 }, // •
-    { 9, 10, 9, 1, 14, 23, 43851 }, // ‣
-    { 5, 5, 13, 4, 4, 7, 43874 }, // ․
-    { 13, 5, 14, 1, 4, 17, 43881 }, // ‥
-    { 19, 5, 21, 1, 4, 24, 43898 }, // …
-    { 5, 5, 7, 1, 9, 7, 43922 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 43929 }, //  
-    { 0, 0, 15, 0, 0, 0, 43929 }, //  
-    { 7, 20, 0, -1, 16, 35, 43929 }, // ‪
-    { 7, 20, 0, -6, 16, 35, 43964 }, // ‫
-    { 6, 22, 0, -3, 18, 33, 43999 }, // ‬
-    { 6, 22, 0, -3, 18, 33, 44032 }, // ‭
-    { 6, 22, 0, -3, 18, 33, 44065 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 44098 }, //  
-    { 32, 20, 32, 0, 19, 160, 44098 }, // ‰
-    { 41, 20, 42, 0, 19, 205, 44258 }, // ‱
-    { 7, 7, 8, 1, 18, 13, 44463 }, // ′
-    { 13, 7, 13, 1, 18, 23, 44476 }, // ″
-    { 18, 7, 19, 1, 18, 32, 44499 }, // ‴
-    { 7, 7, 11, 1, 18, 13, 44531 }, // ‵
-    { 13, 7, 16, 1, 18, 23, 44544 }, // ‶
-    { 18, 7, 22, 1, 18, 32, 44567 }, // ‷
-    { 10, 9, 10, 0, 3, 23, 44599 }, // ‸
-    { 9, 12, 9, 0, 13, 27, 44622 }, // ‹
-    { 9, 12, 9, 0, 13, 27, 44649 }, // ›
-    { 19, 20, 21, 1, 19, 95, 44676 }, // ※
-    { 12, 19, 14, 1, 18, 57, 44771 }, // ‼
-    { 12, 20, 12, 0, 19, 60, 44828 }, // ‽
-    { 14, 3, 13, -1, 22, 11, 44888 }, // ‾
-    { 15, 6, 15, 0, 0, 23, 44899 }, // ‿
-    { 15, 6, 15, 0, 20, 23, 44922 }, // ⁀
-    { 11, 17, 11, 0, 11, 47, 44945 }, // ⁁
-    { 28, 23, 28, 0, 19, 161, 44992 }, // ⁂
-    { 7, 4, 8, 1, 9, 7, 45153 }, // ⁃
-    { 14, 18, 3, -5, 18, 63, 45160 }, // ⁄
-    { 7, 22, 8, 1, 18, 39, 45223 }, // ⁅
-    { 7, 22, 8, 0, 18, 39, 45262 }, // ⁆
-    { 24, 20, 24, 0, 19, 120, 45301 }, // ⁇
-    { 18, 20, 19, 0, 19, 90, 45421 }, // ⁈
-    { 18, 20, 19, 1, 19, 90, 45511 }, // ⁉
-    { 13, 14, 15, 1, 14, 46, 45601 }, // ⁊
-    { 14, 23, 16, 1, 19, 81, 45647 }, // ⁋
-    { 14, 13, 16, 1, 14, 46, 45728 }, // ⁌
-    { 14, 13, 16, 2, 14, 46, 45774 }, // ⁍
-    { 13, 12, 14, 0, 7, 39, 45820 }, // ⁎
-    { 6, 18, 7, 1, 14, 27, 45859 }, // ⁏
-    { 15, 26, 15, 0, 20, 98, 45886 }, // ⁐
-    { 13, 25, 14, 0, 19, 82, 45984 }, // ⁑
-    { 11, 20, 11, 0, 19, 55, 46066 }, // ⁒
-    { 24, 5, 25, 1, 10, 30, 46121 }, // ⁓
-    { 15, 6, 15, 0, 0, 23, 46151 }, // ⁔
-    { 14, 13, 14, 0, 13, 46, 46174 }, // ⁕
-    { 13, 20, 14, 1, 19, 65, 46220 }, // ⁖
-    { 23, 7, 23, 1, 18, 41, 46285 }, // ⁗
-    { 20, 20, 22, 1, 19, 100, 46326 }, // ⁘
-    { 20, 20, 22, 1, 19, 100, 46426 }, // ⁙
-    { 5, 20, 7, 1, 19, 25, 46526 }, // ⁚
-    { 15, 21, 17, 1, 20, 79, 46551 }, // ⁛
-    { 21, 20, 21, 0, 19, 105, 46630 }, // ⁜
-    { 5, 20, 7, 1, 19, 25, 46735 }, // ⁝
-    { 5, 20, 7, 1, 19, 25, 46760 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 46785 }, //  
-    { 0, 0, 15, 0, 0, 0, 46785 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 46785 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 46785 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 46785 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 46785 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 46785 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 46785 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 46785 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 46785 }, // ⁩
-    { 6, 22, 0, -3, 18, 33, 46785 }, // ⁪
-    { 6, 22, 0, -3, 18, 33, 46818 }, // ⁫
-    { 6, 22, 0, -3, 18, 33, 46851 }, // ⁬
-    { 6, 22, 0, -3, 18, 33, 46884 }, // ⁭
-    { 6, 22, 0, -3, 18, 33, 46917 }, // ⁮
-    { 6, 22, 0, -3, 18, 33, 46950 }, // ⁯
-    { 9, 12, 9, 0, 22, 27, 46983 }, // ⁰
-    { 3, 12, 5, 1, 19, 9, 47010 }, // ⁱ
-    { 10, 12, 10, 0, 22, 30, 47019 }, // ⁴
-    { 8, 12, 10, 1, 22, 24, 47049 }, // ⁵
-    { 9, 12, 10, 0, 22, 27, 47073 }, // ⁶
-    { 9, 12, 10, 0, 22, 27, 47100 }, // ⁷
-    { 9, 12, 10, 0, 22, 27, 47127 }, // ⁸
-    { 9, 12, 10, 0, 22, 27, 47154 }, // ⁹
-    { 9, 8, 9, 0, 19, 18, 47181 }, // ⁺
-    { 9, 2, 9, 0, 16, 5, 47199 }, // ⁻
-    { 9, 6, 9, 0, 18, 14, 47204 }, // ⁼
-    { 5, 15, 6, 1, 23, 19, 47218 }, // ⁽
-    { 5, 15, 6, 0, 23, 19, 47237 }, // ⁾
-    { 9, 9, 11, 1, 16, 21, 47256 }, // ⁿ
-    { 9, 12, 9, 0, 8, 27, 47277 }, // ₀
-    { 7, 12, 10, 0, 8, 21, 47304 }, // ₁
-    { 9, 12, 9, 0, 8, 27, 47325 }, // ₂
-    { 9, 12, 10, 0, 8, 27, 47352 }, // ₃
-    { 10, 12, 10, 0, 8, 30, 47379 }, // ₄
-    { 8, 12, 10, 1, 8, 24, 47409 }, // ₅
-    { 9, 12, 10, 0, 8, 27, 47433 }, // ₆
-    { 9, 12, 10, 0, 8, 27, 47460 }, // ₇
-    { 9, 12, 10, 0, 8, 27, 47487 }, // ₈
-    { 9, 12, 10, 0, 8, 27, 47514 }, // ₉
-    { 9, 8, 9, 0, 6, 18, 47541 }, // ₊
-    { 9, 2, 9, 0, 3, 5, 47559 }, // ₋
-    { 9, 6, 9, 0, 5, 14, 47564 }, // ₌
-    { 5, 15, 6, 1, 9, 19, 47578 }, // ₍
-    { 5, 15, 6, 0, 9, 19, 47597 }, // ₎
-    { 9, 9, 10, 0, 6, 21, 47616 }, // ₐ
-    { 9, 9, 10, 0, 6, 21, 47637 }, // ₑ
-    { 10, 9, 10, 0, 6, 23, 47658 }, // ₒ
-    { 10, 9, 9, 0, 6, 23, 47681 }, // ₓ
-    { 9, 9, 10, 0, 6, 21, 47704 }, // ₔ
-    { 9, 12, 11, 1, 9, 27, 47725 }, // ₕ
-    { 10, 12, 10, 1, 9, 30, 47752 }, // ₖ
-    { 3, 12, 5, 1, 9, 9, 47782 }, // ₗ
-    { 14, 9, 16, 1, 6, 32, 47791 }, // ₘ
-    { 9, 9, 11, 1, 6, 21, 47823 }, // ₙ
-    { 9, 12, 10, 1, 6, 27, 47844 }, // ₚ
-    { 8, 9, 8, 0, 6, 18, 47871 }, // ₛ
-    { 7, 11, 7, 0, 8, 20, 47889 }, // ₜ
-    { 14, 19, 14, 0, 19, 67, 47909 }, // ₠
-    { 15, 21, 15, 0, 19, 79, 47976 }, // ₡
-    { 14, 20, 14, 0, 19, 70, 48055 }, // ₢
-    { 13, 18, 14, 0, 18, 59, 48125 }, // ₣
-    { 13, 19, 14, 1, 19, 62, 48184 }, // ₤
-    { 22, 20, 24, 1, 17, 110, 48246 }, // ₥
-    { 15, 18, 14, 0, 18, 68, 48356 }, // ₦
-    { 21, 19, 22, 1, 18, 100, 48424 }, // ₧
-    { 22, 19, 23, 1, 18, 105, 48524 }, // ₨
-    { 19, 18, 18, 0, 18, 86, 48629 }, // ₩
-    { 19, 18, 23, 2, 18, 86, 48715 }, // ₪
-    { 15, 23, 16, 1, 19, 87, 48801 }, // ₫
-    { 15, 19, 14, 0, 18, 72, 48888 }, // €
-    { 15, 18, 14, 0, 18, 68, 48960 }, // ₭
-    { 14, 18, 14, 0, 18, 63, 49028 }, // ₮
-    { 25, 25, 25, 0, 19, 157, 49091 }, // ₯
-    { 14, 25, 15, 0, 19, 88, 49248 }, // ₰
-    { 15, 18, 14, 0, 18, 68, 49336 }, // ₱
-    { 16, 21, 18, 1, 19, 84, 49404 }, // ₲
-    { 17, 18, 16, 0, 18, 77, 49488 }, // ₳
-    { 15, 20, 14, 0, 19, 75, 49565 }, // ₴
-    { 15, 21, 16, 1, 19, 79, 49640 }, // ₵
-    { 17, 18, 17, 0, 17, 77, 49719 }, // ₶
-    { 18, 21, 18, 0, 19, 95, 49796 }, // ₷
-    { 14, 18, 14, 0, 18, 63, 49891 }, // ₸
-    { 12, 18, 14, 1, 18, 54, 49954 }, // ₹
-    { 14, 19, 14, 0, 18, 67, 50008 }, // ₺
-    { 20, 20, 20, 0, 19, 100, 50075 }, // ₻
-    { 20, 18, 22, 1, 18, 90, 50175 }, // ₼
-    { 15, 18, 15, 0, 18, 68, 50265 }, // ₽
-    { 18, 20, 20, 1, 20, 90, 50333 }, // ₾
-    { 12, 24, 14, 2, 21, 72, 50423 }, // ₿
-    { 12, 19, 13, 1, 14, 57, 50495 }, // ⃀
-    { 13, 4, 15, 1, 11, 13, 50552 }, // −
-    { 23, 23, 25, 1, 19, 133, 50565 }, // �
+    { 16, 20, 18, 1, 19, 80, 2048 }, // G
+    { 15, 18, 19, 2, 18, 68, 2128 }, // H
+    { 9, 18, 10, 0, 18, 41, 2196 }, // I
+    { 9, 24, 8, -2, 18, 54, 2237 }, // J
+    { 15, 18, 17, 2, 18, 68, 2291 }, // K
+    { 12, 18, 14, 2, 18, 54, 2359 }, // L
+    { 20, 18, 24, 2, 18, 90, 2413 }, // M
+    { 17, 18, 20, 2, 18, 77, 2503 }, // N
+    { 18, 20, 20, 1, 19, 90, 2580 }, // O
+    { 13, 18, 16, 2, 18, 59, 2670 }, // P
+    { 18, 24, 20, 1, 19, 108, 2729 }, // Q
+    { 15, 18, 16, 2, 18, 68, 2837 }, // R
+    { 12, 20, 14, 1, 19, 60, 2905 }, // S
+    { 14, 18, 14, 0, 18, 63, 2965 }, // T
+    { 15, 19, 19, 2, 18, 72, 3028 }, // U
+    { 17, 18, 16, 0, 18, 77, 3100 }, // V
+    { 25, 18, 24, 0, 18, 113, 3177 }, // W
+    { 17, 18, 17, 0, 18, 77, 3290 }, // X
+    { 16, 18, 16, 0, 18, 72, 3367 }, // Y
+    { 14, 18, 14, 0, 18, 63, 3439 }, // Z
+    { 7, 22, 8, 1, 18, 39, 3502 }, // [
+    { 11, 19, 10, 0, 18, 53, 3541 }, // <backslash>
+    { 7, 22, 8, 0, 18, 39, 3594 }, // ]
+    { 14, 12, 14, 0, 18, 42, 3633 }, // ^
+    { 12, 2, 10, -1, -2, 6, 3675 }, // _
+    { 8, 5, 9, 1, 20, 10, 3681 }, // `
+    { 13, 15, 15, 1, 14, 49, 3691 }, // a
+    { 14, 20, 16, 1, 19, 70, 3740 }, // b
+    { 12, 15, 13, 1, 14, 45, 3810 }, // c
+    { 13, 20, 16, 1, 19, 65, 3855 }, // d
+    { 13, 15, 15, 1, 14, 49, 3920 }, // e
+    { 11, 20, 10, 0, 20, 55, 3969 }, // f
+    { 13, 20, 16, 1, 14, 65, 4024 }, // g
+    { 14, 19, 16, 1, 19, 67, 4096 }, // h
+    { 5, 20, 7, 1, 20, 25, 4163 }, // i
+    { 8, 26, 7, -2, 20, 52, 4188 }, // j
+    { 15, 19, 16, 1, 19, 72, 4240 }, // k
+    { 5, 19, 7, 1, 19, 24, 4312 }, // l
+    { 22, 14, 24, 1, 14, 77, 4336 }, // m
+    { 14, 14, 16, 1, 14, 49, 4413 }, // n
+    { 14, 15, 16, 1, 14, 53, 4462 }, // o
+    { 14, 20, 16, 1, 14, 70, 4515 }, // p
+    { 13, 20, 16, 1, 14, 65, 4585 }, // q
+    { 10, 14, 11, 1, 14, 35, 4650 }, // r
+    { 11, 15, 13, 1, 14, 42, 4685 }, // s
+    { 11, 18, 11, 0, 17, 50, 4727 }, // t
+    { 14, 15, 16, 1, 14, 53, 4777 }, // u
+    { 15, 14, 14, 0, 14, 53, 4830 }, // v
+    { 22, 14, 21, 0, 14, 77, 4883 }, // w
+    { 15, 14, 14, 0, 14, 53, 4960 }, // x
+    { 15, 20, 14, 0, 14, 75, 5013 }, // y
+    { 12, 14, 12, 0, 14, 42, 5088 }, // z
+    { 9, 22, 10, 0, 18, 50, 5130 }, // {
+    { 4, 25, 14, 5, 19, 25, 5180 }, // |
+    { 9, 22, 10, 1, 18, 50, 5205 }, // }
+    { 13, 5, 14, 1, 11, 17, 5255 }, // ~
+    { 0, 0, 7, 0, 0, 0, 5272 }, //  
+    { 5, 19, 7, 1, 14, 24, 5272 }, // ¡
+    { 12, 20, 14, 1, 19, 60, 5296 }, // ¢
+    { 13, 19, 14, 1, 19, 62, 5356 }, // £
+    { 12, 12, 14, 1, 15, 36, 5418 }, // ¤
+    { 15, 18, 14, 0, 18, 68, 5454 }, // ¥
+    { 4, 25, 14, 5, 19, 25, 5522 }, // ¦
+    { 10, 21, 12, 1, 20, 53, 5547 }, // §
+    { 9, 4, 15, 3, 19, 9, 5600 }, // ¨
+    { 19, 20, 21, 1, 19, 95, 5609 }, // ©
+    { 9, 10, 10, 0, 19, 23, 5704 }, // ª
+    { 15, 12, 15, 0, 13, 45, 5727 }, // «
+    { 13, 8, 14, 1, 11, 26, 5772 }, // ¬
+    { 8, 4, 8, 0, 9, 8, 5798 }, // ­
+    { 19, 20, 21, 1, 19, 95, 5806 }, // ®
+    { 14, 3, 13, -1, 22, 11, 5901 }, // ¯
+    { 9, 10, 11, 1, 19, 23, 5912 }, // °
+    { 13, 16, 14, 1, 16, 52, 5935 }, // ±
+    { 9, 12, 9, 0, 22, 27, 5987 }, // ²
+    { 9, 12, 10, 0, 22, 27, 6014 }, // ³
+    { 8, 5, 9, 1, 20, 10, 6041 }, // ´
+    { 14, 20, 16, 1, 14, 70, 6051 }, // µ
+    { 14, 23, 16, 1, 19, 81, 6144 }, // ¶
+    { 5, 5, 7, 1, 11, 7, 6225 }, // ·
+    { 7, 6, 7, 0, 0, 11, 6232 }, // ¸
+    { 7, 12, 10, 0, 22, 21, 6243 }, // ¹
+    { 9, 10, 10, 0, 19, 23, 6264 }, // º
+    { 15, 12, 15, 0, 13, 45, 6287 }, // »
+    { 21, 18, 21, 0, 18, 95, 6332 }, // ¼
+    { 21, 18, 22, 0, 18, 95, 6427 }, // ½
+    { 20, 19, 21, 1, 19, 95, 6522 }, // ¾
+    { 12, 19, 12, 0, 14, 57, 6617 }, // ¿
+    { 18, 24, 17, 0, 24, 108, 6674 }, // À
+    { 18, 24, 17, 0, 24, 108, 6782 }, // Á
+    { 18, 24, 17, 0, 24, 108, 6890 }, // Â
+    { 18, 23, 17, 0, 23, 104, 6998 }, // Ã
+    { 18, 23, 17, 0, 23, 104, 7102 }, // Ä
+    { 18, 22, 17, 0, 22, 99, 7206 }, // Å
+    { 23, 18, 24, 0, 18, 104, 7305 }, // Æ
+    { 15, 25, 16, 1, 19, 94, 7409 }, // Ç
+    { 11, 24, 14, 2, 24, 66, 7503 }, // È
+    { 11, 24, 14, 2, 24, 66, 7569 }, // É
+    { 11, 24, 14, 2, 24, 66, 7635 }, // Ê
+    { 11, 23, 14, 2, 23, 64, 7701 }, // Ë
+    { 9, 24, 10, 0, 24, 54, 7765 }, // Ì
+    { 10, 24, 10, 0, 24, 60, 7819 }, // Í
+    { 11, 24, 10, -1, 24, 66, 7879 }, // Î
+    { 10, 23, 10, 0, 23, 58, 7945 }, // Ï
+    { 17, 18, 18, 0, 18, 77, 8003 }, // Ð
+    { 17, 23, 20, 2, 23, 98, 8080 }, // Ñ
+    { 18, 25, 20, 1, 24, 113, 8192 }, // Ò
+    { 18, 25, 20, 1, 24, 113, 8305 }, // Ó
+    { 18, 25, 20, 1, 24, 113, 8418 }, // Ô
+    { 18, 24, 20, 1, 23, 108, 8531 }, // Õ
+    { 18, 24, 20, 1, 23, 108, 8639 }, // Ö
+    { 12, 12, 14, 1, 15, 36, 8747 }, // ×
+    { 18, 21, 20, 1, 19, 95, 8783 }, // Ø
+    { 15, 25, 19, 2, 24, 94, 8878 }, // Ù
+    { 15, 25, 19, 2, 24, 94, 8972 }, // Ú
+    { 15, 25, 19, 2, 24, 94, 9066 }, // Û
+    { 15, 24, 19, 2, 23, 90, 9160 }, // Ü
+    { 16, 24, 16, 0, 24, 96, 9250 }, // Ý
+    { 13, 18, 16, 2, 18, 59, 9346 }, // Þ
+    { 16, 21, 18, 1, 20, 84, 9405 }, // ß
+    { 13, 21, 15, 1, 20, 69, 9489 }, // à
+    { 13, 21, 15, 1, 20, 69, 9558 }, // á
+    { 13, 21, 15, 1, 20, 69, 9627 }, // â
+    { 13, 20, 15, 1, 19, 65, 9696 }, // ã
+    { 13, 20, 15, 1, 19, 65, 9761 }, // ä
+    { 13, 22, 15, 1, 21, 72, 9826 }, // å
+    { 21, 15, 23, 1, 14, 79, 9898 }, // æ
+    { 12, 20, 13, 1, 14, 60, 9977 }, // ç
+    { 13, 21, 15, 1, 20, 69, 10037 }, // è
+    { 13, 21, 15, 1, 20, 69, 10106 }, // é
+    { 13, 21, 15, 1, 20, 69, 10240 }, // ê
+    { 13, 20, 15, 1, 19, 65, 10309 }, // ë
+    { 9, 20, 7, -1, 20, 45, 10374 }, // ì
+    { 8, 20, 7, 1, 20, 40, 10419 }, // í
+    { 11, 20, 7, -2, 20, 55, 10459 }, // î
+    { 10, 19, 7, -1, 19, 48, 10514 }, // ï
+    { 14, 21, 16, 1, 20, 74, 10562 }, // ð
+    { 14, 19, 16, 1, 19, 67, 10636 }, // ñ
+    { 14, 21, 16, 1, 20, 74, 10703 }, // ò
+    { 14, 21, 16, 1, 20, 74, 10777 }, // ó
+    { 14, 21, 16, 1, 20, 74, 10851 }, // ô
+    { 14, 20, 16, 1, 19, 70, 10925 }, // õ
+    { 14, 20, 16, 1, 19, 70, 10995 }, // ö
+    { 13, 13, 14, 1, 15, 43, 11065 }, // ÷
+    { 14, 16, 15, 1, 15, 56, 11108 }, // ø
+    { 14, 21, 16, 1, 20, 74, 11164 }, // ù
+    { 14, 21, 16, 1, 20, 74, 11238 }, // ú
+    { 14, 21, 16, 1, 20, 74, 11312 }, // û
+    { 14, 20, 16, 1, 19, 70, 11386 }, // ü
+    { 15, 26, 14, 0, 20, 98, 11456 }, // ý
+    { 14, 25, 16, 1, 19, 88, 11554 }, // þ
+    { 15, 25, 14, 0, 19, 94, 11642 }, // ÿ
+    { 18, 22, 17, 0, 22, 99, 11736 }, // Ā
+    { 13, 19, 15, 1, 18, 62, 11835 }, // ā
+    { 18, 24, 17, 0, 24, 108, 11897 }, // Ă
+    { 13, 21, 15, 1, 20, 69, 12005 }, // ă
+    { 18, 24, 17, 0, 18, 108, 12074 }, // Ą
+    { 13, 20, 15, 1, 14, 65, 12182 }, // ą
+    { 15, 25, 16, 1, 24, 94, 12288 }, // Ć
+    { 12, 21, 13, 1, 20, 63, 12382 }, // ć
+    { 15, 25, 16, 1, 24, 94, 12445 }, // Ĉ
+    { 12, 21, 13, 1, 20, 63, 12539 }, // ĉ
+    { 15, 25, 16, 1, 24, 94, 12602 }, // Ċ
+    { 12, 21, 13, 1, 20, 63, 12696 }, // ċ
+    { 15, 25, 16, 1, 24, 94, 12759 }, // Č
+    { 12, 21, 13, 1, 20, 63, 12853 }, // č
+    { 15, 24, 18, 2, 24, 90, 12916 }, // Ď
+    { 19, 20, 16, 1, 19, 95, 13006 }, // ď
+    { 17, 18, 18, 0, 18, 77, 13101 }, // Đ
+    { 15, 20, 16, 1, 19, 75, 13178 }, // đ
+    { 11, 22, 14, 2, 22, 61, 13253 }, // Ē
+    { 13, 19, 15, 1, 18, 62, 13314 }, // ē
+    { 11, 24, 14, 2, 24, 66, 13376 }, // Ĕ
+    { 13, 21, 15, 1, 20, 69, 13442 }, // ĕ
+    { 11, 24, 14, 2, 24, 66, 13511 }, // Ė
+    { 13, 21, 15, 1, 20, 69, 13577 }, // ė
+    { 11, 24, 14, 2, 18, 66, 13646 }, // Ę
+    { 13, 20, 15, 1, 14, 65, 13712 }, // ę
+    { 11, 24, 14, 2, 24, 66, 13777 }, // Ě
+    { 13, 21, 15, 1, 20, 69, 13843 }, // ě
+    { 16, 25, 18, 1, 24, 100, 13912 }, // Ĝ
+    { 13, 26, 16, 1, 20, 85, 14012 }, // ĝ
+    { 16, 25, 18, 1, 24, 100, 14097 }, // Ğ
+    { 13, 26, 16, 1, 20, 85, 14197 }, // ğ
+    { 16, 25, 18, 1, 24, 100, 14336 }, // Ġ
+    { 13, 26, 16, 1, 20, 85, 14436 }, // ġ
+    { 16, 25, 18, 1, 19, 100, 14521 }, // Ģ
+    { 13, 26, 16, 1, 20, 85, 14621 }, // ģ
+    { 15, 24, 19, 2, 24, 90, 14706 }, // Ĥ
+    { 17, 25, 16, -2, 25, 107, 14796 }, // ĥ
+    { 20, 18, 19, 0, 18, 90, 14903 }, // Ħ
+    { 15, 19, 16, 0, 19, 72, 14993 }, // ħ
+    { 11, 23, 10, -1, 23, 64, 15065 }, // Ĩ
+    { 11, 19, 7, -2, 19, 53, 15129 }, // ĩ
+    { 9, 22, 10, 0, 22, 50, 15182 }, // Ī
+    { 9, 18, 7, -1, 18, 41, 15232 }, // ī
+    { 10, 24, 10, 0, 24, 60, 15273 }, // Ĭ
+    { 10, 20, 7, -1, 20, 50, 15333 }, // ĭ
+    { 9, 24, 10, 0, 18, 54, 15383 }, // Į
+    { 5, 26, 7, 1, 20, 33, 15437 }, // į
+    { 9, 24, 10, 0, 24, 54, 15470 }, // İ
+    { 5, 14, 7, 1, 14, 18, 15524 }, // ı
+    { 17, 24, 18, 0, 18, 102, 15542 }, // Ĳ
+    { 13, 26, 15, 1, 20, 85, 15644 }, // ĳ
+    { 12, 30, 8, -2, 24, 90, 15729 }, // Ĵ
+    { 11, 26, 7, -2, 20, 72, 15819 }, // ĵ
+    { 15, 24, 17, 2, 18, 90, 15891 }, // Ķ
+    { 15, 25, 16, 1, 19, 94, 15981 }, // ķ
+    { 15, 14, 16, 1, 14, 53, 16075 }, // ĸ
+    { 13, 24, 14, 1, 24, 78, 16128 }, // Ĺ
+    { 8, 25, 7, 1, 25, 50, 16206 }, // ĺ
+    { 12, 24, 14, 2, 18, 72, 16256 }, // Ļ
+    { 5, 25, 7, 1, 19, 32, 16328 }, // ļ
+    { 12, 18, 14, 2, 18, 54, 16384 }, // Ľ
+    { 10, 19, 7, 1, 19, 48, 16438 }, // ľ
+    { 12, 18, 14, 2, 18, 54, 16486 }, // Ŀ
+    { 10, 19, 9, 1, 19, 48, 16540 }, // ŀ
+    { 14, 18, 14, 0, 18, 63, 16588 }, // Ł
+    { 9, 19, 8, -1, 19, 43, 16651 }, // ł
+    { 17, 24, 20, 2, 24, 102, 16694 }, // Ń
+    { 14, 20, 16, 1, 20, 70, 16796 }, // ń
+    { 17, 24, 20, 2, 18, 102, 16866 }, // Ņ
+    { 14, 20, 16, 1, 14, 70, 16968 }, // ņ
+    { 17, 24, 20, 2, 24, 102, 17038 }, // Ň
+    { 14, 20, 16, 1, 20, 70, 17140 }, // ň
+    { 19, 18, 19, -1, 18, 86, 17210 }, // ŉ
+    { 17, 24, 20, 2, 18, 102, 17296 }, // Ŋ
+    { 14, 20, 16, 1, 14, 70, 17398 }, // ŋ
+    { 18, 23, 20, 1, 22, 104, 17468 }, // Ō
+    { 14, 19, 16, 1, 18, 67, 17572 }, // ō
+    { 18, 25, 20, 1, 24, 113, 17639 }, // Ŏ
+    { 14, 21, 16, 1, 20, 74, 17752 }, // ŏ
+    { 18, 25, 20, 1, 24, 113, 17826 }, // Ő
+    { 14, 21, 16, 1, 20, 74, 17939 }, // ő
+    { 22, 20, 24, 1, 19, 110, 18013 }, // Œ
+    { 23, 15, 24, 1, 14, 87, 18123 }, // œ
+    { 15, 24, 16, 2, 24, 90, 18210 }, // Ŕ
+    { 11, 20, 11, 1, 20, 55, 18300 }, // ŕ
+    { 15, 24, 16, 2, 18, 90, 18432 }, // Ŗ
+    { 10, 20, 11, 1, 14, 50, 18522 }, // ŗ
+    { 15, 24, 16, 2, 24, 90, 18572 }, // Ř
+    { 11, 20, 11, 1, 20, 55, 18662 }, // ř
+    { 12, 25, 14, 1, 24, 75, 18717 }, // Ś
+    { 11, 21, 13, 1, 20, 58, 18792 }, // ś
+    { 12, 25, 14, 1, 24, 75, 18850 }, // Ŝ
+    { 11, 21, 13, 1, 20, 58, 18925 }, // ŝ
+    { 12, 25, 14, 1, 19, 75, 18983 }, // Ş
+    { 11, 20, 13, 1, 14, 55, 19058 }, // ş
+    { 12, 25, 14, 1, 24, 75, 19113 }, // Š
+    { 11, 21, 13, 1, 20, 58, 19188 }, // š
+    { 14, 24, 14, 0, 18, 84, 19246 }, // Ţ
+    { 11, 23, 11, 0, 17, 64, 19330 }, // ţ
+    { 14, 24, 14, 0, 24, 84, 19394 }, // Ť
+    { 15, 20, 11, 0, 19, 75, 19478 }, // ť
+    { 14, 18, 14, 0, 18, 63, 19553 }, // Ŧ
+    { 11, 18, 11, 0, 17, 50, 19616 }, // ŧ
+    { 15, 24, 19, 2, 23, 90, 19666 }, // Ũ
+    { 14, 20, 16, 1, 19, 70, 19756 }, // ũ
+    { 15, 23, 19, 2, 22, 87, 19826 }, // Ū
+    { 14, 19, 16, 1, 18, 67, 19913 }, // ū
+    { 15, 25, 19, 2, 24, 94, 19980 }, // Ŭ
+    { 14, 21, 16, 1, 20, 74, 20074 }, // ŭ
+    { 15, 26, 19, 2, 25, 98, 20148 }, // Ů
+    { 14, 22, 16, 1, 21, 77, 20246 }, // ů
+    { 15, 25, 19, 2, 24, 94, 20323 }, // Ű
+    { 14, 21, 16, 1, 20, 74, 20480 }, // ű
+    { 15, 24, 19, 2, 18, 90, 20554 }, // Ų
+    { 14, 20, 16, 1, 14, 70, 20644 }, // ų
+    { 25, 24, 24, 0, 24, 150, 20714 }, // Ŵ
+    { 22, 20, 21, 0, 20, 110, 20864 }, // ŵ
+    { 16, 24, 16, 0, 24, 96, 20974 }, // Ŷ
+    { 15, 26, 14, 0, 20, 98, 21070 }, // ŷ
+    { 16, 23, 16, 0, 23, 92, 21168 }, // Ÿ
+    { 14, 24, 14, 0, 24, 84, 21260 }, // Ź
+    { 12, 20, 12, 0, 20, 60, 21344 }, // ź
+    { 14, 24, 14, 0, 24, 84, 21404 }, // Ż
+    { 12, 20, 12, 0, 20, 60, 21488 }, // ż
+    { 14, 24, 14, 0, 24, 84, 21548 }, // Ž
+    { 12, 20, 12, 0, 20, 60, 21632 }, // ž
+    { 10, 20, 10, 1, 20, 50, 21692 }, // ſ
+    { 8, 5, 0, -14, 20, 10, 21742 }, // ̀
+    { 9, 5, 0, -10, 20, 12, 21752 }, // ́
+    { 11, 5, 0, -6, 20, 14, 21764 }, // ̂
+    { 11, 4, 0, -14, 19, 11, 21778 }, // ̃
+    { 10, 3, 0, -5, 18, 8, 21789 }, // ̄
+    { 12, 4, 0, -6, 22, 12, 21797 }, // ̅
+    { 11, 5, 0, -5, 20, 14, 21809 }, // ̆
+    { 6, 5, 0, -3, 20, 8, 21823 }, // ̇
+    { 10, 4, 0, -5, 19, 10, 21831 }, // ̈
+    { 7, 7, 0, -11, 21, 13, 21841 }, // ̉
+    { 7, 6, 0, -4, 21, 11, 21854 }, // ̊
+    { 11, 5, 0, -4, 20, 14, 21865 }, // ̋
+    { 12, 5, 0, -6, 20, 15, 21879 }, // ̌
+    { 4, 6, 0, -2, 20, 6, 21894 }, // ̍
+    { 8, 6, 0, -4, 20, 12, 21900 }, // ̎
+    { 12, 5, 0, -15, 20, 15, 21912 }, // ̏
+    { 10, 7, 0, -5, 22, 18, 21927 }, // ̐
+    { 10, 5, 0, -5, 20, 13, 21945 }, // ̑
+    { 6, 7, 0, -3, 18, 11, 21958 }, // ̒
+    { 6, 7, 0, -3, 18, 11, 21969 }, // ̓
+    { 6, 7, 0, -3, 18, 11, 21980 }, // ̔
+    { 6, 7, 0, -3, 18, 11, 21991 }, // ̕
+    { 9, 5, 0, -5, 0, 12, 22002 }, // ̖
+    { 8, 5, 0, -4, 0, 10, 22014 }, // ̗
+    { 6, 6, 0, -3, 0, 9, 22024 }, // ̘
+    { 6, 6, 0, -3, 0, 9, 22033 }, // ̙
+    { 7, 6, 8, 0, 19, 11, 22042 }, // ̚
+    { 7, 6, 0, -3, 19, 11, 22053 }, // ̛
+    { 4, 6, 0, -2, 0, 6, 22064 }, // ̜
+    { 6, 5, 0, -3, -1, 8, 22070 }, // ̝
+    { 6, 5, 0, -3, -1, 8, 22078 }, // ̞
+    { 6, 6, 0, -3, 0, 9, 22086 }, // ̟
+    { 6, 3, 0, -3, -2, 5, 22095 }, // ̠
+    { 6, 8, 0, -6, 2, 12, 22100 }, // ̡
+    { 6, 8, 0, 0, 2, 12, 22112 }, // ̢
+    { 5, 5, 0, -11, -1, 7, 22124 }, // ̣
+    { 10, 4, 0, -5, -1, 10, 22131 }, // ̤
+    { 7, 6, 0, -4, 0, 11, 22141 }, // ̥
+    { 6, 5, 0, -3, -1, 8, 22152 }, // ̦
+    { 6, 6, 0, -3, 0, 9, 22160 }, // ̧
+    { 6, 7, 0, -3, 1, 11, 22169 }, // ̨
+    { 4, 6, 0, -2, 0, 6, 22180 }, // ̩
+    { 10, 5, 0, -5, -1, 13, 22186 }, // ̪
+    { 10, 4, 0, -5, -1, 10, 22199 }, // ̫
+    { 11, 5, 0, -5, 0, 14, 22209 }, // ̬
+    { 11, 5, 0, -6, 0, 14, 22223 }, // ̭
+    { 10, 5, 0, -5, 0, 13, 22237 }, // ̮
+    { 10, 5, 0, -5, -1, 13, 22250 }, // ̯
+    { 12, 4, 0, -6, -1, 12, 22263 }, // ̰
+    { 10, 3, 0, -5, -2, 8, 22275 }, // ̱
+    { 12, 2, 0, -6, -2, 6, 22283 }, // ̲
+    { 11, 6, 0, -6, 0, 17, 22289 }, // ̳
+    { 11, 4, 0, -5, 9, 11, 22306 }, // ̴
+    { 12, 4, 0, -6, 9, 12, 22317 }, // ̵
+    { 20, 4, 0, -10, 9, 20, 22329 }, // ̶
+    { 10, 8, 0, -5, 11, 20, 22349 }, // ̷
+    { 12, 21, 0, -6, 19, 63, 22369 }, // ̸
+    { 4, 6, 0, -2, 0, 6, 22432 }, // ̹
+    { 10, 5, 0, -5, -1, 13, 22438 }, // ̺
+    { 10, 6, 0, -5, 0, 15, 22451 }, // ̻
+    { 10, 4, 0, -5, -1, 10, 22466 }, // ̼
+    { 6, 6, 0, -3, 20, 9, 22476 }, // ̽
+    { 4, 8, 0, -2, 22, 8, 22485 }, // ̾
+    { 11, 6, 0, -6, 25, 17, 22493 }, // ̿
+    { 8, 5, 0, -6, 20, 10, 22510 }, // ̀
+    { 8, 5, 0, -2, 20, 10, 22528 }, // ́
+    { 11, 4, 0, -5, 19, 11, 22538 }, // ͂
+    { 5, 6, 0, -3, 20, 8, 22549 }, // ̓
+    { 14, 5, 0, -6, 20, 18, 22557 }, // ̈́
+    { 5, 5, 0, -1, -1, 7, 22575 }, // ͅ
+    { 12, 6, 0, -6, 20, 18, 22582 }, // ͆
+    { 11, 6, 0, -6, 0, 17, 22600 }, // ͇
+    { 8, 6, 0, -4, 0, 12, 22617 }, // ͈
+    { 6, 5, 0, -3, -1, 8, 22629 }, // ͉
+    { 10, 6, 0, -5, 20, 15, 22637 }, // ͊
+    { 10, 11, 0, -5, 24, 28, 22652 }, // ͋
+    { 10, 7, 0, -5, 22, 18, 22680 }, // ͌
+    { 10, 6, 0, -5, 0, 15, 22698 }, // ͍
+    { 6, 6, 0, -3, 0, 9, 22713 }, // ͎
+    { 18, 18, 0, -9, 18, 81, 22722 }, // ͏
+    { 5, 6, 0, -3, 20, 8, 22803 }, // ͐
+    { 4, 7, 0, -2, 21, 7, 22811 }, // ͑
+    { 10, 7, 0, -5, 22, 18, 22818 }, // ͒
+    { 6, 6, 0, -3, 0, 9, 22836 }, // ͓
+    { 5, 5, 0, -3, -1, 7, 22845 }, // ͔
+    { 5, 5, 0, -3, -1, 7, 22852 }, // ͕
+    { 10, 5, 0, -5, -1, 13, 22859 }, // ͖
+    { 4, 7, 0, -2, 21, 7, 22872 }, // ͗
+    { 5, 5, 0, 2, 20, 7, 22879 }, // ͘
+    { 6, 6, 0, -3, 0, 9, 22886 }, // ͙
+    { 10, 6, 0, -5, 0, 15, 22895 }, // ͚
+    { 6, 6, 0, -3, 20, 9, 22910 }, // ͛
+    { 20, 5, 0, -10, -1, 25, 22919 }, // ͜
+    { 20, 5, 0, -10, 20, 25, 22944 }, // ͝
+    { 16, 2, 0, -8, 17, 8, 22969 }, // ͞
+    { 16, 2, 0, -8, -2, 8, 22977 }, // ͟
+    { 20, 4, 0, -10, 19, 20, 22985 }, // ͠
+    { 20, 6, 0, -10, 22, 30, 23005 }, // ͡
+    { 21, 6, 0, -10, 0, 32, 23035 }, // ͢
+    { 6, 7, 0, -3, 22, 11, 23067 }, // ͣ
+    { 7, 7, 0, -3, 22, 13, 23078 }, // ͤ
+    { 3, 9, 0, -1, 24, 7, 23091 }, // ͥ
+    { 7, 7, 0, -3, 22, 13, 23098 }, // ͦ
+    { 7, 6, 0, -3, 21, 11, 23111 }, // ͧ
+    { 6, 7, 0, -3, 22, 11, 23122 }, // ͨ
+    { 6, 9, 0, -3, 24, 14, 23133 }, // ͩ
+    { 7, 9, 0, -3, 24, 16, 23147 }, // ͪ
+    { 10, 7, 0, -5, 22, 18, 23163 }, // ͫ
+    { 5, 7, 0, -2, 22, 9, 23181 }, // ͬ
+    { 5, 8, 0, -2, 23, 10, 23190 }, // ͭ
+    { 7, 6, 0, -3, 21, 11, 23200 }, // ͮ
+    { 8, 6, 0, -4, 21, 12, 23211 }, // ͯ
+    { 11, 24, 14, 2, 24, 66, 23223 }, // Ѐ
+    { 11, 23, 14, 2, 23, 64, 23289 }, // Ё
+    { 19, 19, 19, 0, 18, 91, 23353 }, // Ђ
+    { 12, 24, 14, 2, 24, 72, 23444 }, // Ѓ
+    { 15, 20, 16, 1, 19, 75, 23516 }, // Є
+    { 12, 20, 14, 1, 19, 60, 23591 }, // Ѕ
+    { 4, 18, 8, 2, 18, 18, 23651 }, // І
+    { 8, 24, 8, 0, 24, 48, 23669 }, // Ї
+    { 9, 24, 8, -2, 18, 54, 23717 }, // Ј
+    { 25, 19, 26, 0, 18, 119, 23771 }, // Љ
+    { 24, 18, 27, 2, 18, 108, 23890 }, // Њ
+    { 18, 18, 19, 0, 18, 81, 23998 }, // Ћ
+    { 16, 24, 17, 2, 24, 96, 24079 }, // Ќ
+    { 16, 24, 20, 2, 24, 96, 24175 }, // Ѝ
+    { 17, 25, 16, 0, 24, 107, 24271 }, // Ў
+    { 15, 22, 19, 2, 18, 83, 24378 }, // Џ
+    { 18, 18, 17, 0, 18, 81, 24461 }, // А
+    { 14, 18, 16, 2, 18, 63, 24576 }, // Б
+    { 14, 18, 17, 2, 18, 63, 24639 }, // В
+    { 12, 18, 14, 2, 18, 54, 24702 }, // Г
+    { 20, 22, 19, 0, 18, 110, 24756 }, // Д
+    { 11, 18, 14, 2, 18, 50, 24866 }, // Е
+    { 25, 18, 25, 0, 18, 113, 24916 }, // Ж
+    { 13, 20, 15, 1, 19, 65, 25029 }, // З
+    { 16, 18, 20, 2, 18, 72, 25094 }, // И
+    { 16, 24, 20, 2, 24, 96, 25166 }, // Й
+    { 16, 18, 17, 2, 18, 72, 25262 }, // К
+    { 17, 19, 18, 0, 18, 81, 25334 }, // Л
+    { 20, 18, 24, 2, 18, 90, 25415 }, // М
+    { 15, 18, 19, 2, 18, 68, 25505 }, // Н
+    { 18, 20, 19, 1, 19, 90, 25573 }, // О
+    { 15, 18, 19, 2, 18, 68, 25663 }, // П
+    { 13, 18, 16, 2, 18, 59, 25731 }, // Р
+    { 15, 20, 16, 1, 19, 75, 25790 }, // С
+    { 14, 18, 14, 0, 18, 63, 25865 }, // Т
+    { 17, 19, 16, 0, 18, 81, 25928 }, // У
+    { 21, 20, 23, 1, 19, 105, 26009 }, // Ф
+    { 17, 18, 17, 0, 18, 77, 26114 }, // Х
+    { 18, 22, 19, 2, 18, 99, 26191 }, // Ц
+    { 15, 18, 18, 1, 18, 68, 26290 }, // Ч
+    { 23, 18, 27, 2, 18, 104, 26358 }, // Ш
+    { 25, 22, 27, 2, 18, 138, 26462 }, // Щ
+    { 18, 18, 19, 0, 18, 81, 26624 }, // Ъ
+    { 19, 18, 23, 2, 18, 86, 26705 }, // Ы
+    { 13, 18, 16, 2, 18, 59, 26791 }, // Ь
+    { 14, 20, 16, 1, 19, 70, 26850 }, // Э
+    { 23, 20, 25, 2, 19, 115, 26920 }, // Ю
+    { 15, 18, 17, 0, 18, 68, 27035 }, // Я
+    { 14, 15, 15, 0, 14, 53, 27103 }, // а
+    { 14, 21, 16, 1, 20, 74, 27156 }, // б
+    { 13, 14, 15, 1, 14, 46, 27230 }, // в
+    { 10, 14, 12, 2, 14, 35, 27276 }, // г
+    { 16, 18, 16, 0, 14, 72, 27311 }, // д
+    { 13, 15, 15, 1, 14, 49, 27383 }, // е
+    { 22, 14, 22, 0, 14, 77, 27432 }, // ж
+    { 12, 15, 13, 0, 14, 45, 27509 }, // з
+    { 13, 14, 17, 2, 14, 46, 27554 }, // и
+    { 13, 20, 17, 2, 20, 65, 27600 }, // й
+    { 14, 14, 15, 2, 14, 49, 27665 }, // к
+    { 14, 15, 16, 0, 14, 53, 27714 }, // л
+    { 17, 14, 21, 2, 14, 60, 27767 }, // м
+    { 13, 14, 16, 2, 14, 46, 27827 }, // н
+    { 14, 15, 16, 1, 14, 53, 27873 }, // о
+    { 13, 14, 16, 2, 14, 46, 27926 }, // п
+    { 13, 20, 16, 2, 14, 65, 27972 }, // р
+    { 12, 15, 13, 1, 14, 45, 28037 }, // с
+    { 13, 14, 13, 0, 14, 46, 28082 }, // т
+    { 16, 20, 14, -1, 14, 80, 28128 }, // у
+    { 19, 25, 20, 1, 19, 119, 28208 }, // ф
+    { 15, 14, 14, 0, 14, 53, 28327 }, // х
+    { 15, 18, 16, 1, 14, 68, 28380 }, // ц
+    { 13, 14, 16, 1, 14, 46, 28448 }, // ч
+    { 20, 14, 24, 2, 14, 70, 28494 }, // ш
+    { 22, 18, 24, 2, 14, 99, 28564 }, // щ
+    { 16, 14, 17, 0, 14, 56, 28672 }, // ъ
+    { 18, 14, 21, 2, 14, 63, 28728 }, // ы
+    { 12, 14, 15, 2, 14, 42, 28791 }, // ь
+    { 13, 15, 13, 0, 14, 49, 28833 }, // э
+    { 19, 15, 21, 2, 14, 72, 28882 }, // ю
+    { 14, 14, 15, 0, 14, 49, 28954 }, // я
+    { 13, 21, 15, 1, 20, 69, 29003 }, // ѐ
+    { 13, 20, 15, 1, 19, 65, 29072 }, // ё
+    { 15, 25, 16, 0, 19, 94, 29137 }, // ђ
+    { 10, 20, 12, 2, 20, 50, 29231 }, // ѓ
+    { 12, 15, 13, 1, 14, 45, 29281 }, // є
+    { 11, 15, 12, 1, 14, 42, 29326 }, // ѕ
+    { 5, 19, 8, 1, 19, 24, 29368 }, // і
+    { 8, 19, 7, 0, 19, 38, 29392 }, // ї
+    { 8, 26, 7, -2, 20, 52, 29430 }, // ј
+    { 22, 15, 22, 0, 14, 83, 29482 }, // љ
+    { 21, 14, 23, 2, 14, 74, 29565 }, // њ
+    { 15, 19, 16, 0, 19, 72, 29639 }, // ћ
+    { 14, 20, 15, 2, 20, 70, 29711 }, // ќ
+    { 13, 20, 17, 2, 20, 65, 29781 }, // ѝ
+    { 16, 26, 14, -1, 20, 104, 29846 }, // ў
+    { 13, 18, 16, 2, 14, 59, 29950 }, // џ
+    { 24, 18, 24, 0, 18, 108, 30009 }, // Ѡ
+    { 22, 14, 22, 0, 14, 77, 30117 }, // ѡ
+    { 16, 18, 17, 0, 18, 72, 30194 }, // Ѣ
+    { 16, 17, 17, 0, 17, 68, 30266 }, // ѣ
+    { 21, 20, 24, 2, 19, 105, 30334 }, // Ѥ
+    { 19, 15, 20, 1, 14, 72, 30439 }, // ѥ
+    { 19, 18, 18, 0, 18, 86, 30511 }, // Ѧ
+    { 16, 14, 16, 0, 14, 56, 30597 }, // ѧ
+    { 24, 18, 25, 2, 18, 108, 30720 }, // Ѩ
+    { 22, 14, 23, 1, 14, 77, 30828 }, // ѩ
+    { 20, 18, 20, 0, 18, 90, 30905 }, // Ѫ
+    { 16, 14, 16, 0, 14, 56, 30995 }, // ѫ
+    { 25, 18, 27, 2, 18, 113, 31051 }, // Ѭ
+    { 21, 14, 22, 1, 14, 74, 31164 }, // ѭ
+    { 15, 28, 16, 0, 22, 105, 31238 }, // Ѯ
+    { 13, 23, 14, 0, 17, 75, 31343 }, // ѯ
+    { 18, 18, 22, 2, 18, 81, 31418 }, // Ѱ
+    { 19, 25, 21, 1, 19, 119, 31499 }, // ѱ
+    { 18, 20, 20, 1, 19, 90, 31618 }, // Ѳ
+    { 14, 15, 15, 1, 14, 53, 31708 }, // ѳ
+    { 18, 18, 18, 0, 18, 81, 31761 }, // Ѵ
+    { 16, 14, 15, 0, 14, 56, 31842 }, // ѵ
+    { 18, 24, 18, 0, 24, 108, 31898 }, // Ѷ
+    { 16, 20, 15, 0, 20, 80, 32006 }, // ѷ
+    { 32, 25, 33, 1, 19, 200, 32086 }, // Ѹ
+    { 29, 20, 29, 1, 14, 145, 32286 }, // ѹ
+    { 19, 22, 21, 1, 20, 105, 32431 }, // Ѻ
+    { 15, 18, 17, 1, 16, 68, 32536 }, // ѻ
+    { 25, 28, 27, 1, 27, 175, 32768 }, // Ѽ
+    { 22, 24, 24, 1, 23, 132, 32943 }, // ѽ
+    { 24, 23, 24, 0, 23, 138, 33075 }, // Ѿ
+    { 22, 19, 22, 0, 19, 105, 33213 }, // ѿ
+    { 16, 25, 17, 1, 19, 100, 33318 }, // Ҁ
+    { 12, 20, 13, 1, 14, 60, 33418 }, // ҁ
+    { 13, 17, 15, 1, 16, 56, 33478 }, // ҂
+    { 10, 5, 0, -12, 19, 13, 33534 }, // ҃
+    { 11, 4, 0, -12, 19, 11, 33547 }, // ҄
+    { 5, 6, 0, -9, 20, 8, 33558 }, // ҅
+    { 5, 6, 0, -9, 20, 8, 33566 }, // ҆
+    { 10, 4, 0, -5, 23, 10, 33574 }, // ҇
+    { 30, 27, 0, -15, 20, 203, 33584 }, // ҈
+    { 28, 28, 0, -14, 21, 196, 33787 }, // ҉
+    { 21, 30, 23, 2, 24, 158, 33983 }, // Ҋ
+    { 19, 25, 20, 1, 20, 119, 34141 }, // ҋ
+    { 15, 18, 16, 0, 18, 68, 34260 }, // Ҍ
+    { 15, 19, 15, 0, 19, 72, 34328 }, // ҍ
+    { 13, 18, 16, 2, 18, 59, 34400 }, // Ҏ
+    { 14, 20, 16, 1, 14, 70, 34459 }, // ҏ
+    { 12, 22, 14, 2, 22, 66, 34529 }, // Ґ
+    { 11, 18, 13, 1, 18, 50, 34595 }, // ґ
+    { 14, 18, 14, 0, 18, 63, 34645 }, // Ғ
+    { 12, 14, 12, 0, 14, 42, 34708 }, // ғ
+    { 16, 25, 18, 2, 18, 100, 34816 }, // Ҕ
+    { 14, 21, 15, 1, 14, 74, 34916 }, // ҕ
+    { 26, 24, 26, 0, 18, 156, 34990 }, // Җ
+    { 25, 19, 23, -1, 14, 119, 35146 }, // җ
+    { 13, 25, 15, 1, 19, 82, 35265 }, // Ҙ
+    { 12, 20, 13, 0, 14, 60, 35347 }, // ҙ
+    { 17, 24, 19, 2, 18, 102, 35407 }, // Қ
+    { 16, 19, 16, 1, 14, 76, 35509 }, // қ
+    { 15, 18, 17, 2, 18, 68, 35585 }, // Ҝ
+    { 15, 14, 15, 1, 14, 53, 35653 }, // ҝ
+    { 17, 18, 17, 1, 18, 77, 35706 }, // Ҟ
+    { 16, 19, 16, 0, 19, 76, 35783 }, // ҟ
+    { 19, 18, 18, 0, 18, 86, 35859 }, // Ҡ
+    { 18, 14, 17, 0, 14, 63, 35945 }, // ҡ
+    { 19, 24, 21, 2, 18, 114, 36008 }, // Ң
+    { 17, 19, 19, 1, 14, 81, 36122 }, // ң
+    { 19, 18, 21, 2, 18, 86, 36203 }, // Ҥ
+    { 18, 14, 19, 1, 14, 63, 36289 }, // ҥ
+    { 25, 25, 28, 2, 18, 157, 36352 }, // Ҧ
+    { 21, 21, 22, 1, 14, 111, 36509 }, // ҧ
+    { 18, 21, 19, 1, 19, 95, 36620 }, // Ҩ
+    { 15, 15, 16, 1, 14, 57, 36715 }, // ҩ
+    { 15, 25, 16, 1, 19, 94, 36864 }, // Ҫ
+    { 12, 20, 13, 1, 14, 60, 36958 }, // ҫ
+    { 14, 24, 14, 0, 18, 84, 37018 }, // Ҭ
+    { 14, 19, 14, 0, 14, 67, 37102 }, // ҭ
+    { 16, 18, 16, 0, 18, 72, 37169 }, // Ү
+    { 15, 20, 14, 0, 14, 75, 37241 }, // ү
+    { 16, 18, 16, 0, 18, 72, 37316 }, // Ұ
+    { 15, 20, 14, 0, 14, 75, 37388 }, // ұ
+    { 19, 24, 19, 0, 18, 114, 37463 }, // Ҳ
+    { 16, 19, 16, 0, 14, 76, 37577 }, // ҳ
+    { 23, 24, 23, 0, 18, 138, 37653 }, // Ҵ
+    { 20, 19, 20, 0, 14, 95, 37791 }, // ҵ
+    { 19, 24, 20, 1, 18, 114, 37886 }, // Ҷ
+    { 17, 19, 18, 1, 14, 81, 38000 }, // ҷ
+    { 16, 18, 18, 1, 18, 72, 38081 }, // Ҹ
+    { 14, 14, 16, 1, 14, 49, 38153 }, // ҹ
+    { 15, 18, 18, 2, 18, 68, 38202 }, // Һ
+    { 14, 19, 16, 1, 19, 67, 38270 }, // һ
+    { 22, 20, 24, 0, 19, 110, 38337 }, // Ҽ
+    { 18, 15, 18, -1, 14, 68, 38447 }, // ҽ
+    { 22, 25, 24, 0, 19, 138, 38515 }, // Ҿ
+    { 18, 19, 18, -1, 14, 86, 38653 }, // ҿ
+    { 9, 18, 10, 0, 18, 41, 38739 }, // Ӏ
+    { 25, 24, 25, 0, 24, 150, 38912 }, // Ӂ
+    { 22, 20, 22, 0, 20, 110, 39062 }, // ӂ
+    { 16, 25, 19, 2, 18, 100, 39172 }, // Ӄ
+    { 15, 21, 16, 1, 14, 79, 39272 }, // ӄ
+    { 21, 24, 21, 0, 18, 126, 39351 }, // Ӆ
+    { 18, 19, 18, 0, 14, 86, 39477 }, // ӆ
+    { 15, 25, 19, 2, 18, 94, 39563 }, // Ӈ
+    { 14, 21, 17, 1, 14, 74, 39657 }, // ӈ
+    { 19, 24, 21, 2, 18, 114, 39731 }, // Ӊ
+    { 18, 19, 19, 1, 14, 86, 39845 }, // ӊ
+    { 16, 24, 18, 1, 18, 96, 39931 }, // Ӌ
+    { 14, 19, 16, 1, 14, 67, 40027 }, // ӌ
+    { 24, 24, 26, 2, 18, 144, 40094 }, // Ӎ
+    { 22, 19, 23, 1, 14, 105, 40238 }, // ӎ
+    { 9, 18, 10, 0, 18, 41, 40343 }, // ӏ
+    { 18, 24, 17, 0, 24, 108, 40384 }, // Ӑ
+    { 13, 21, 15, 1, 20, 69, 40492 }, // ӑ
+    { 18, 23, 17, 0, 23, 104, 40561 }, // Ӓ
+    { 13, 20, 15, 1, 19, 65, 40665 }, // ӓ
+    { 23, 18, 24, 0, 18, 104, 40730 }, // Ӕ
+    { 21, 15, 23, 1, 14, 79, 40834 }, // ӕ
+    { 11, 24, 14, 2, 24, 66, 40960 }, // Ӗ
+    { 13, 21, 15, 1, 20, 69, 41026 }, // ӗ
+    { 17, 20, 20, 2, 19, 85, 41095 }, // Ә
+    { 13, 15, 15, 1, 14, 49, 41180 }, // ә
+    { 17, 24, 20, 2, 23, 102, 41229 }, // Ӛ
+    { 13, 20, 15, 1, 19, 65, 41331 }, // ӛ
+    { 25, 23, 25, 0, 23, 144, 41396 }, // Ӝ
+    { 22, 19, 22, 0, 19, 105, 41540 }, // ӝ
+    { 13, 24, 15, 1, 23, 78, 41645 }, // Ӟ
+    { 12, 20, 13, 0, 19, 60, 41723 }, // ӟ
+    { 14, 19, 15, 0, 18, 67, 41783 }, // Ӡ
+    { 14, 20, 15, 0, 14, 70, 41850 }, // ӡ
+    { 16, 22, 20, 2, 22, 88, 41920 }, // Ӣ
+    { 13, 18, 17, 2, 18, 59, 42008 }, // ӣ
+    { 16, 23, 20, 2, 23, 92, 42067 }, // Ӥ
+    { 13, 19, 17, 2, 19, 62, 42159 }, // ӥ
+    { 18, 24, 20, 1, 23, 108, 42221 }, // Ӧ
+    { 14, 20, 16, 1, 19, 70, 42329 }, // ӧ
+    { 18, 20, 20, 1, 19, 90, 42399 }, // Ө
+    { 14, 15, 15, 1, 14, 53, 42489 }, // ө
+    { 18, 24, 20, 1, 23, 108, 42542 }, // Ӫ
+    { 14, 20, 15, 1, 19, 70, 42650 }, // ӫ
+    { 14, 24, 16, 1, 23, 84, 42720 }, // Ӭ
+    { 13, 20, 13, 0, 19, 65, 42804 }, // ӭ
+    { 17, 23, 16, 0, 22, 98, 42869 }, // Ӯ
+    { 16, 24, 14, -1, 18, 96, 43008 }, // ӯ
+    { 17, 24, 16, 0, 23, 102, 43104 }, // Ӱ
+    { 16, 25, 14, -1, 19, 100, 43206 }, // ӱ
+    { 17, 25, 16, 0, 24, 107, 43306 }, // Ӳ
+    { 15, 26, 14, 0, 20, 98, 43413 }, // ӳ
+    { 15, 23, 18, 1, 23, 87, 43511 }, // Ӵ
+    { 13, 19, 16, 1, 19, 62, 43598 }, // ӵ
+    { 12, 24, 14, 2, 18, 72, 43660 }, // Ӷ
+    { 11, 19, 12, 1, 14, 53, 43732 }, // ӷ
+    { 19, 23, 23, 2, 23, 110, 43785 }, // Ӹ
+    { 18, 19, 21, 2, 19, 86, 43895 }, // ӹ
+    { 14, 25, 14, 0, 18, 88, 43981 }, // Ӻ
+    { 12, 20, 12, 0, 14, 60, 44069 }, // ӻ
+    { 18, 25, 18, 0, 18, 113, 44129 }, // Ӽ
+    { 16, 20, 16, 0, 14, 80, 44242 }, // ӽ
+    { 17, 18, 17, 0, 18, 77, 44322 }, // Ӿ
+    { 15, 14, 14, 0, 14, 53, 44399 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 44452 }, //  
+    { 0, 0, 25, 0, 0, 0, 44452 }, //  
+    { 0, 0, 13, 0, 0, 0, 44452 }, //  
+    { 0, 0, 25, 0, 0, 0, 44452 }, //  
+    { 0, 0, 8, 0, 0, 0, 44452 }, //  
+    { 0, 0, 6, 0, 0, 0, 44452 }, //  
+    { 0, 0, 4, 0, 0, 0, 44452 }, //  
+    { 0, 0, 14, 0, 0, 0, 44452 }, //  
+    { 0, 0, 7, 0, 0, 0, 44452 }, //  
+    { 0, 0, 4, 0, 0, 0, 44452 }, //  
+    { 0, 0, 3, 0, 0, 0, 44452 }, //  
+    { 0, 0, 0, 0, 0, 0, 44452 }, // ​
+    { 0, 0, 0, 0, 0, 0, 44452 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 44452 }, // ‍
+    { 7, 22, 0, -1, 18, 39, 44452 }, // ‎
+    { 7, 22, 0, -6, 18, 39, 44491 }, // ‏
+    { 8, 4, 8, 0, 9, 8, 44530 }, // ‐
+    { 8, 4, 8, 0, 9, 8, 44538 }, // ‑
+    { 13, 4, 14, 1, 11, 13, 44546 }, // ‒
+    { 12, 4, 13, 0, 9, 12, 44559 }, // –
+    { 25, 4, 25, 0, 9, 25, 44571 }, // —
+    { 25, 4, 25, 0, 9, 25, 44596 }, // ―
+    { 10, 25, 14, 2, 19, 63, 44621 }, // ‖
+    { 12, 6, 10, -1, 0, 18, 44684 }, // ‗
+    { 6, 7, 5, 0, 18, 11, 44702 }, // ‘
+    { 6, 7, 5, 0, 18, 11, 44713 }, // ’
+    { 6, 7, 7, 0, 4, 11, 44724 }, // ‚
+    { 6, 7, 5, 0, 18, 11, 44735 }, // ‛
+    { 11, 7, 11, 0, 18, 20, 44746 }, // “
+    { 11, 7, 11, 0, 18, 20, 44766 }, // ”
+    { 12, 7, 13, 0, 3, 21, 44786 }, // „
+    { 11, 7, 11, 0, 18, 20, 44807 }, // ‟
+    { 11, 19, 13, 1, 19, 53, 44827 }, // †
+    { 11, 19, 13, 1, 19, 53, 44880 }, // ‡
+    { 8, 8, 9, 1, 13, 16, 44933 }, // •
+    { 9, 10, 9, 1, 14, 23, 44949 }, // ‣
+    { 5, 5, 13, 4, 4, 7, 44972 }, // ․
+    { 13, 5, 14, 1, 4, 17, 44979 }, // ‥
+    { 19, 5, 21, 1, 4, 24, 44996 }, // …
+    { 5, 5, 7, 1, 9, 7, 45020 }, // ‧
+    { 0, 0, 15, 0, 0, 0, 45027 }, //  
+    { 0, 0, 15, 0, 0, 0, 45027 }, //  
+    { 7, 20, 0, -1, 16, 35, 45056 }, // ‪
+    { 7, 20, 0, -6, 16, 35, 45091 }, // ‫
+    { 6, 22, 0, -3, 18, 33, 45126 }, // ‬
+    { 6, 22, 0, -3, 18, 33, 45159 }, // ‭
+    { 6, 22, 0, -3, 18, 33, 45192 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 45225 }, //  
+    { 32, 20, 32, 0, 19, 160, 45225 }, // ‰
+    { 41, 20, 42, 0, 19, 205, 45385 }, // ‱
+    { 7, 7, 8, 1, 18, 13, 45590 }, // ′
+    { 13, 7, 13, 1, 18, 23, 45603 }, // ″
+    { 18, 7, 19, 1, 18, 32, 45626 }, // ‴
+    { 7, 7, 11, 1, 18, 13, 45658 }, // ‵
+    { 13, 7, 16, 1, 18, 23, 45671 }, // ‶
+    { 18, 7, 22, 1, 18, 32, 45694 }, // ‷
+    { 10, 9, 10, 0, 3, 23, 45726 }, // ‸
+    { 9, 12, 9, 0, 13, 27, 45749 }, // ‹
+    { 9, 12, 9, 0, 13, 27, 45776 }, // ›
+    { 19, 20, 21, 1, 19, 95, 45803 }, // ※
+    { 12, 19, 14, 1, 18, 57, 45898 }, // ‼
+    { 12, 20, 12, 0, 19, 60, 45955 }, // ‽
+    { 14, 3, 13, -1, 22, 11, 46015 }, // ‾
+    { 15, 6, 15, 0, 0, 23, 46026 }, // ‿
+    { 15, 6, 15, 0, 20, 23, 46049 }, // ⁀
+    { 11, 17, 11, 0, 11, 47, 46072 }, // ⁁
+    { 28, 23, 28, 0, 19, 161, 46119 }, // ⁂
+    { 7, 4, 8, 1, 9, 7, 46280 }, // ⁃
+    { 14, 18, 3, -5, 18, 63, 46287 }, // ⁄
+    { 7, 22, 8, 1, 18, 39, 46350 }, // ⁅
+    { 7, 22, 8, 0, 18, 39, 46389 }, // ⁆
+    { 24, 20, 24, 0, 19, 120, 46428 }, // ⁇
+    { 18, 20, 19, 0, 19, 90, 46548 }, // ⁈
+    { 18, 20, 19, 1, 19, 90, 46638 }, // ⁉
+    { 13, 14, 15, 1, 14, 46, 46728 }, // ⁊
+    { 14, 23, 16, 1, 19, 81, 46774 }, // ⁋
+    { 14, 13, 16, 1, 14, 46, 46855 }, // ⁌
+    { 14, 13, 16, 2, 14, 46, 46901 }, // ⁍
+    { 13, 12, 14, 0, 7, 39, 46947 }, // ⁎
+    { 6, 18, 7, 1, 14, 27, 46986 }, // ⁏
+    { 15, 26, 15, 0, 20, 98, 47104 }, // ⁐
+    { 13, 25, 14, 0, 19, 82, 47202 }, // ⁑
+    { 11, 20, 11, 0, 19, 55, 47284 }, // ⁒
+    { 24, 5, 25, 1, 10, 30, 47339 }, // ⁓
+    { 15, 6, 15, 0, 0, 23, 47369 }, // ⁔
+    { 14, 13, 14, 0, 13, 46, 47392 }, // ⁕
+    { 13, 20, 14, 1, 19, 65, 47438 }, // ⁖
+    { 23, 7, 23, 1, 18, 41, 47503 }, // ⁗
+    { 20, 20, 22, 1, 19, 100, 47544 }, // ⁘
+    { 20, 20, 22, 1, 19, 100, 47644 }, // ⁙
+    { 5, 20, 7, 1, 19, 25, 47744 }, // ⁚
+    { 15, 21, 17, 1, 20, 79, 47769 }, // ⁛
+    { 21, 20, 21, 0, 19, 105, 47848 }, // ⁜
+    { 5, 20, 7, 1, 19, 25, 47953 }, // ⁝
+    { 5, 20, 7, 1, 19, 25, 47978 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 48003 }, //  
+    { 0, 0, 15, 0, 0, 0, 48003 }, // ⁠
+    { 0, 0, 15, 0, 0, 0, 48003 }, // ⁡
+    { 0, 0, 15, 0, 0, 0, 48003 }, // ⁢
+    { 0, 0, 15, 0, 0, 0, 48003 }, // ⁣
+    { 0, 0, 15, 0, 0, 0, 48003 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 48003 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 48003 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 48003 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 48003 }, // ⁩
+    { 6, 22, 0, -3, 18, 33, 48003 }, // ⁪
+    { 6, 22, 0, -3, 18, 33, 48036 }, // ⁫
+    { 6, 22, 0, -3, 18, 33, 48069 }, // ⁬
+    { 6, 22, 0, -3, 18, 33, 48102 }, // ⁭
+    { 6, 22, 0, -3, 18, 33, 48135 }, // ⁮
+    { 6, 22, 0, -3, 18, 33, 48168 }, // ⁯
+    { 9, 12, 9, 0, 22, 27, 48201 }, // ⁰
+    { 3, 12, 5, 1, 19, 9, 48228 }, // ⁱ
+    { 10, 12, 10, 0, 22, 30, 48237 }, // ⁴
+    { 8, 12, 10, 1, 22, 24, 48267 }, // ⁵
+    { 9, 12, 10, 0, 22, 27, 48291 }, // ⁶
+    { 9, 12, 10, 0, 22, 27, 48318 }, // ⁷
+    { 9, 12, 10, 0, 22, 27, 48345 }, // ⁸
+    { 9, 12, 10, 0, 22, 27, 48372 }, // ⁹
+    { 9, 8, 9, 0, 19, 18, 48399 }, // ⁺
+    { 9, 2, 9, 0, 16, 5, 48417 }, // ⁻
+    { 9, 6, 9, 0, 18, 14, 48422 }, // ⁼
+    { 5, 15, 6, 1, 23, 19, 48436 }, // ⁽
+    { 5, 15, 6, 0, 23, 19, 48455 }, // ⁾
+    { 9, 9, 11, 1, 16, 21, 48474 }, // ⁿ
+    { 9, 12, 9, 0, 8, 27, 48495 }, // ₀
+    { 7, 12, 10, 0, 8, 21, 48522 }, // ₁
+    { 9, 12, 9, 0, 8, 27, 48543 }, // ₂
+    { 9, 12, 10, 0, 8, 27, 48570 }, // ₃
+    { 10, 12, 10, 0, 8, 30, 48597 }, // ₄
+    { 8, 12, 10, 1, 8, 24, 48627 }, // ₅
+    { 9, 12, 10, 0, 8, 27, 48651 }, // ₆
+    { 9, 12, 10, 0, 8, 27, 48678 }, // ₇
+    { 9, 12, 10, 0, 8, 27, 48705 }, // ₈
+    { 9, 12, 10, 0, 8, 27, 48732 }, // ₉
+    { 9, 8, 9, 0, 6, 18, 48759 }, // ₊
+    { 9, 2, 9, 0, 3, 5, 48777 }, // ₋
+    { 9, 6, 9, 0, 5, 14, 48782 }, // ₌
+    { 5, 15, 6, 1, 9, 19, 48796 }, // ₍
+    { 5, 15, 6, 0, 9, 19, 48815 }, // ₎
+    { 9, 9, 10, 0, 6, 21, 48834 }, // ₐ
+    { 9, 9, 10, 0, 6, 21, 48855 }, // ₑ
+    { 10, 9, 10, 0, 6, 23, 48876 }, // ₒ
+    { 10, 9, 9, 0, 6, 23, 48899 }, // ₓ
+    { 9, 9, 10, 0, 6, 21, 48922 }, // ₔ
+    { 9, 12, 11, 1, 9, 27, 48943 }, // ₕ
+    { 10, 12, 10, 1, 9, 30, 48970 }, // ₖ
+    { 3, 12, 5, 1, 9, 9, 49000 }, // ₗ
+    { 14, 9, 16, 1, 6, 32, 49009 }, // ₘ
+    { 9, 9, 11, 1, 6, 21, 49041 }, // ₙ
+    { 9, 12, 10, 1, 6, 27, 49062 }, // ₚ
+    { 8, 9, 8, 0, 6, 18, 49089 }, // ₛ
+    { 7, 11, 7, 0, 8, 20, 49107 }, // ₜ
+    { 14, 19, 14, 0, 19, 67, 49152 }, // ₠
+    { 15, 21, 15, 0, 19, 79, 49219 }, // ₡
+    { 14, 20, 14, 0, 19, 70, 49298 }, // ₢
+    { 13, 18, 14, 0, 18, 59, 49368 }, // ₣
+    { 13, 19, 14, 1, 19, 62, 49427 }, // ₤
+    { 22, 20, 24, 1, 17, 110, 49489 }, // ₥
+    { 15, 18, 14, 0, 18, 68, 49599 }, // ₦
+    { 21, 19, 22, 1, 18, 100, 49667 }, // ₧
+    { 22, 19, 23, 1, 18, 105, 49767 }, // ₨
+    { 19, 18, 18, 0, 18, 86, 49872 }, // ₩
+    { 19, 18, 23, 2, 18, 86, 49958 }, // ₪
+    { 15, 23, 16, 1, 19, 87, 50044 }, // ₫
+    { 15, 19, 14, 0, 18, 72, 50131 }, // €
+    { 15, 18, 14, 0, 18, 68, 50203 }, // ₭
+    { 14, 18, 14, 0, 18, 63, 50271 }, // ₮
+    { 25, 25, 25, 0, 19, 157, 50334 }, // ₯
+    { 14, 25, 15, 0, 19, 88, 50491 }, // ₰
+    { 15, 18, 14, 0, 18, 68, 50579 }, // ₱
+    { 16, 21, 18, 1, 19, 84, 50647 }, // ₲
+    { 17, 18, 16, 0, 18, 77, 50731 }, // ₳
+    { 15, 20, 14, 0, 19, 75, 50808 }, // ₴
+    { 15, 21, 16, 1, 19, 79, 50883 }, // ₵
+    { 17, 18, 17, 0, 17, 77, 50962 }, // ₶
+    { 18, 21, 18, 0, 19, 95, 51039 }, // ₷
+    { 14, 18, 14, 0, 18, 63, 51134 }, // ₸
+    { 12, 18, 14, 1, 18, 54, 51200 }, // ₹
+    { 14, 19, 14, 0, 18, 67, 51254 }, // ₺
+    { 20, 20, 20, 0, 19, 100, 51321 }, // ₻
+    { 20, 18, 22, 1, 18, 90, 51421 }, // ₼
+    { 15, 18, 15, 0, 18, 68, 51511 }, // ₽
+    { 18, 20, 20, 1, 20, 90, 51579 }, // ₾
+    { 12, 24, 14, 2, 21, 72, 51669 }, // ₿
+    { 12, 19, 13, 1, 14, 57, 51741 }, // ⃀
+    { 13, 4, 15, 1, 11, 13, 51798 }, // −
+    { 23, 23, 25, 1, 19, 133, 51811 }, // �
 };
 
 static const EpdUnicodeInterval notosans_12_boldIntervals[] = {
@@ -4087,4 +2744,9 @@ static const EpdFontData notosans_12_bold = {
     27,
     -8,
     true,
+    notosans_12_boldBlockOffsets,
+    notosans_12_boldDirectGlyphs,
+    notosans_12_boldGlyphPages,
+    256,
+    notosans_12_boldPageGlyphs,
 };
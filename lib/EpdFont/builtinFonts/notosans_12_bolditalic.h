@@ -2,3390 +2,2058 @@
  * generated by fontconvert.py
  * name: notosans_12_bolditalic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py notosans_12_bolditalic 12 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_12_bolditalic 12 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_bolditalicBitmaps[54017] = {
-    0x01, 0xFE, 0x02, 0xFE, 0x02, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0,
-    0x0B, 0xF0, 0x0F, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x7F, 0x80,
-    0xBF, 0x80, 0x7F, 0x00, 0x04, 0x00, 0x2F, 0x4B, 0xD3, 0xF4, 0xFD, 0x3F, 0x0F, 0xC3, 0xE0, 0xF8,
-    0x7D, 0x1F, 0x47, 0xC1, 0xF0, 0x68, 0x1A, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x01, 0xF4, 0x3D,
-    0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0x43, 0xE0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x2A, 0xFE, 0xBF, 0xA8, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0x2F,
-    0x0B, 0xC0, 0x02, 0xAF, 0xEB, 0xFA, 0x41, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBC, 0x2F, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x0B, 0xC2, 0xF0, 0x00,
-    0x03, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC0, 0x7F, 0x9D, 0x14, 0x07, 0xF2, 0xC0, 0x00, 0x7F, 0xBC,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x0F, 0x7F, 0x80, 0x00, 0xE3, 0xF8, 0x74, 0x1D, 0xBF, 0x47, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC,
-    0x01, 0xBF, 0xF9, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xE0, 0x0F, 0xFF, 0x80, 0x0F, 0xC0, 0x1F, 0xEF,
-    0xC0, 0x2F, 0x00, 0x3F, 0x0F, 0xC0, 0x7D, 0x00, 0x7F, 0x0F, 0xC0, 0xF8, 0x00, 0x7E, 0x0F, 0xC3,
-    0xF0, 0x00, 0xBD, 0x1F, 0x8B, 0xD0, 0x00, 0xBD, 0x3F, 0x5F, 0x8B, 0xE0, 0x7F, 0xBF, 0x3F, 0x7F,
-    0xFC, 0x3F, 0xFD, 0xFC, 0xFE, 0xFD, 0x1F, 0xF2, 0xF5, 0xFC, 0xBD, 0x00, 0x07, 0xE3, 0xF4, 0xBD,
-    0x00, 0x0F, 0xC3, 0xF0, 0xBD, 0x00, 0x3F, 0x03, 0xF0, 0xFC, 0x00, 0xBD, 0x03, 0xF0, 0xFC, 0x01,
-    0xF8, 0x03, 0xF7, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0xFE,
-    0x0F, 0xE0, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0xA8,
-    0x03, 0xFF, 0xF0, 0x2F, 0xC0, 0xFF, 0xBF, 0x83, 0xF4, 0x2F, 0xD2, 0xFD, 0xFF, 0x03, 0xFC, 0x0F,
-    0xFF, 0xD0, 0x3F, 0x80, 0x7F, 0xF8, 0x03, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x4F, 0xD3,
-    0xF0, 0xF8, 0x7D, 0x1F, 0x06, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2F,
-    0x80, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F,
-    0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00,
-    0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0F, 0xD0,
-    0x01, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x80, 0xBC, 0x00, 0x7E, 0x2F, 0x00, 0x2F, 0xFF, 0x95,
-    0x81, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0x05, 0x07, 0xF7, 0xE0, 0x03, 0xF4, 0xFC,
-    0x00, 0x28, 0x2F, 0x40, 0x00, 0x07, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF5, 0xAA,
-    0xFE, 0xA8, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xD0, 0xBF, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x00,
-    0x05, 0x54, 0x3F, 0xFD, 0x7F, 0xFC, 0x7F, 0xFC, 0x2E, 0x2F, 0xEF, 0xFA, 0xFC, 0x14, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x7F,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x03, 0xFC, 0x2F, 0xD0, 0xBF, 0x40, 0xFD, 0x0F, 0xF0, 0x0F, 0xE1,
-    0xFD, 0x00, 0xFE, 0x2F, 0xC0, 0x1F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0xC0, 0x2F, 0xC3, 0xF8, 0x03,
-    0xFC, 0x3F, 0x80, 0x3F, 0xC3, 0xF8, 0x07, 0xF4, 0x3F, 0x80, 0xFF, 0x03, 0xFC, 0x2F, 0xE0, 0x2F,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0xFF, 0xC0, 0x2F, 0xFE, 0x07, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0xFD, 0xBF, 0x01, 0x83, 0xFC,
-    0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
-    0x00, 0x07, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD,
-    0x0F, 0xF4, 0x01, 0x80, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x81, 0xFF,
-    0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x00, 0xD0, 0x2F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x5B, 0xFF, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x6F,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x49, 0x00, 0x1F, 0xF0, 0xFF,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x3F, 0xBF, 0x40, 0x02, 0xFD, 0xFC, 0x00, 0x1F, 0xCB, 0xF0, 0x01, 0xFC, 0x3F, 0x80, 0x0F,
-    0xD0, 0xFD, 0x00, 0xFD, 0x07, 0xF4, 0x0B, 0xFA, 0xBF, 0xE8, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFF, 0x81, 0x55, 0x5F, 0xE4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xD0, 0x1F, 0xD5, 0x54, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0F, 0xFF, 0xFE,
-    0x00, 0x7E, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x0F, 0xF0, 0x90, 0x02, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF4, 0x06, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xF8, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x69, 0x00,
-    0x3F, 0x7F, 0xF8, 0x07, 0xFF, 0xFF, 0xD0, 0xBF, 0xE6, 0xFE, 0x0F, 0xF4, 0x0F, 0xF0, 0xFF, 0x00,
-    0xFF, 0x0F, 0xE0, 0x0F, 0xE0, 0xFF, 0x01, 0xFD, 0x0B, 0xF0, 0x3F, 0xC0, 0x7F, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
-    0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0x40, 0x55, 0x5B, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xC0, 0x1F, 0xFB, 0xFD, 0x03, 0xFC, 0x0F, 0xE0,
-    0x3F, 0x40, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x2F, 0xC3, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0x40, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x5F, 0xF0, 0x3F, 0xC0, 0x7F, 0x43, 0xF4, 0x03, 0xF8, 0x7F,
-    0x40, 0x3F, 0x87, 0xF8, 0x07, 0xF4, 0x3F, 0xFA, 0xFF, 0x01, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF8, 0x2F, 0xD0, 0xFF, 0x0F, 0xE0, 0x1F, 0xD7, 0xF4, 0x07, 0xF5, 0xFC, 0x02, 0xFD, 0x7F, 0x40,
-    0xFF, 0x1F, 0xF1, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x7F, 0xFB, 0xF8, 0x02, 0xA4, 0xFD, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xF0, 0xBF, 0x81, 0xFD, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x2F, 0xE0, 0xFF, 0x82, 0xFC, 0x01, 0x40, 0x00,
-    0x00, 0x1F, 0x40, 0x1F, 0xF0, 0x0B, 0xF8, 0x01, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x03, 0xF8, 0x00,
-    0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x02,
-    0xFE, 0x40, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF,
-    0xFD, 0x40, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x2F, 0xFE, 0x01, 0xBF,
-    0xF4, 0x07, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x2F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x0E, 0x02, 0xFD, 0x00, 0x01,
-    0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE9, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFE, 0x9A, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x0B, 0xF0,
-    0x0B, 0xF0, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x1F, 0xFE, 0x0F, 0xC3, 0xF0, 0x2F, 0xFF, 0xC2, 0xF0,
-    0xF8, 0x2F, 0x83, 0xF0, 0xBC, 0x7D, 0x1F, 0x80, 0xF8, 0x2F, 0x2F, 0x0B, 0xC0, 0x7D, 0x0B, 0xCF,
-    0xC3, 0xF0, 0x2F, 0x03, 0xF3, 0xF0, 0xF8, 0x0F, 0xC1, 0xF4, 0xFC, 0x3F, 0x0B, 0xE0, 0xFC, 0x2F,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x0B, 0xD0, 0xFF, 0x8F, 0xFD, 0x00, 0xFC, 0x05, 0x40, 0x54, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x1D, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-    0x00, 0xFD, 0x7F, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x2F, 0xC0, 0xFC,
-    0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x0B, 0xF9, 0x5F, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x2F, 0xC0,
-    0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFE, 0x57, 0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x02, 0xFC, 0x03,
-    0xFC, 0x07, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x80, 0x0F,
-    0xF0, 0x6F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x2F,
-    0xC0, 0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xF9, 0x6F, 0xF4,
-    0x01, 0xFD, 0x01, 0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xE0, 0x02,
-    0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x0B, 0xF4, 0x0F, 0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFE, 0x02, 0xFD, 0x1B, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01, 0xFD, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0xFF, 0x55, 0x50, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01,
-    0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40, 0x6C, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC,
-    0xBF, 0x40, 0xFF, 0xF8, 0xBF, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x3F, 0xE0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0xFE, 0x00,
-    0x2F, 0xC0, 0x1F, 0xE0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x07, 0xF4, 0x03,
-    0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xF5, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC, 0x01, 0xFD,
-    0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xF0,
-    0x03, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x2F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x0F, 0xF4, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x1F, 0xD0, 0xBF, 0xC0, 0x01, 0xFC, 0x1F, 0xF0, 0x00,
-    0x2F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0xFF, 0x40, 0x00, 0x3F, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x0F,
-    0xE0, 0xFF, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x03, 0xFC,
-    0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x03, 0xF4, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0,
-    0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8,
-    0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x0F,
-    0xFE, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x0B, 0xEF, 0x80,
-    0x2F, 0xBF, 0x00, 0x3F, 0x7E, 0x00, 0xFE, 0xFC, 0x00, 0xFC, 0xFC, 0x0B, 0xDF, 0xE0, 0x07, 0xF3,
-    0xF0, 0x3F, 0x3F, 0x40, 0x2F, 0xCF, 0xC2, 0xF1, 0xFC, 0x00, 0xFE, 0x3F, 0x1F, 0x8B, 0xF0, 0x03,
-    0xF4, 0xFC, 0xFC, 0x2F, 0x80, 0x0F, 0xC3, 0xF7, 0xE0, 0xFE, 0x00, 0x7F, 0x0B, 0xFF, 0x03, 0xF4,
-    0x02, 0xF8, 0x2F, 0xF8, 0x1F, 0xC0, 0x0F, 0xE0, 0xBF, 0xC0, 0xBF, 0x00, 0x3F, 0x42, 0xFE, 0x03,
-    0xF8, 0x00, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xC0,
-    0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xF8, 0x01, 0xFF, 0xF0, 0x03, 0xF4, 0x02, 0xFF, 0xF0, 0x07,
-    0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0, 0x03, 0xF6, 0xFC, 0x0B, 0xE0, 0x03, 0xF1, 0xFC, 0x0F, 0xE0,
-    0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B, 0xF0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F, 0x2F, 0xC0, 0x0F,
-    0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0, 0x3F, 0xFF, 0x40, 0x1F, 0xC0, 0x1F, 0xFF, 0x40, 0x2F, 0xC0,
-    0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xFE, 0x00, 0x7F, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4,
-    0xBF, 0x40, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x0B,
-    0xF6, 0xFD, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47, 0xFC, 0x00,
-    0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFE, 0x5B, 0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x01, 0xFD, 0x03,
-    0xFC, 0x02, 0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x07, 0xF9, 0x6F, 0xF8, 0x0B, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFA, 0xA4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFE, 0x42, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x01,
-    0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x0B, 0xF6, 0xFD, 0x00,
-    0x03, 0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0xBF, 0xC0, 0xFF,
-    0x80, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xFA, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0x40, 0x7F, 0x82, 0xFE, 0x01, 0xFD, 0x03, 0xFC, 0x0B, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0x80,
-    0xFE, 0x03, 0xFD, 0x07, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFC,
-    0x7F, 0x40, 0x0F, 0xE0, 0xFF, 0x00, 0x7F, 0x42, 0xFD, 0x02, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x3F, 0x80, 0x2F, 0xE0, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4,
-    0x00, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFC, 0x03, 0xFD, 0x06, 0x40, 0x7F, 0x80, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFD, 0x06, 0x40, 0x3F,
-    0xD0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x85, 0x5F, 0xF5, 0x50, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x7F, 0x40, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x0F, 0xF0, 0x1F, 0xD0, 0x03, 0xFC, 0x0B,
-    0xF0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0,
-    0x2F, 0xD0, 0x03, 0xF8, 0x0B, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F,
-    0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x03, 0xFA, 0xFC, 0x00, 0x2F, 0xDB, 0xF0, 0x00, 0xFF, 0x1F, 0xC0, 0x07, 0xF4, 0x7F, 0x00,
-    0x3F, 0xC1, 0xFC, 0x01, 0xFD, 0x03, 0xF0, 0x0F, 0xF0, 0x0F, 0xD0, 0x7F, 0x00, 0x3F, 0x43, 0xF8,
-    0x00, 0xFD, 0x1F, 0xC0, 0x03, 0xF4, 0xFE, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x2F, 0xBF, 0x80, 0x00,
-    0xBE, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x03, 0xF6, 0xFC, 0x00, 0xFF, 0x00, 0x2F, 0xCB, 0xF0,
-    0x07, 0xFC, 0x00, 0xFE, 0x2F, 0xC0, 0x2F, 0xF0, 0x07, 0xF0, 0xBF, 0x00, 0xFF, 0xC0, 0x3F, 0xC2,
-    0xFC, 0x0B, 0xFF, 0x01, 0xFD, 0x0B, 0xF0, 0x3F, 0xBC, 0x0B, 0xF0, 0x2F, 0xC2, 0xFA, 0xF4, 0x3F,
-    0x40, 0x7F, 0x0F, 0xCB, 0xD2, 0xFC, 0x01, 0xFC, 0x7E, 0x2F, 0x4F, 0xE0, 0x07, 0xF3, 0xF4, 0xBD,
-    0x7F, 0x00, 0x1F, 0xDF, 0xC2, 0xF7, 0xF8, 0x00, 0x7F, 0xBD, 0x0B, 0xDF, 0xC0, 0x01, 0xFF, 0xF0,
-    0x2F, 0xBF, 0x00, 0x07, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x7F,
-    0xE0, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF8,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x3F, 0xD0, 0x00, 0x0F, 0xE0, 0x7F, 0x80, 0x00,
-    0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x2F, 0xEF, 0xD0, 0x00, 0x00, 0x7F, 0x8F, 0xF0, 0x00, 0x00, 0xFF, 0x0B, 0xF0,
-    0x00, 0x03, 0xFD, 0x07, 0xF8, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00,
-    0x3F, 0xC0, 0x01, 0xFE, 0x00, 0xBF, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0xBF, 0x43, 0xF8, 0x07, 0xFC,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xC2, 0xFD, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFD, 0xFF, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x5F, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xE0, 0x07, 0xFA, 0x40, 0x2F, 0x80, 0x00, 0xBD, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-    0xBE, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xEA, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0x40, 0x7E, 0x01, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x40,
-    0xBD, 0x02, 0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xD0, 0x06, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x1F, 0xC0, 0x0A, 0xFE, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xBC, 0x00, 0x0B,
-    0xD7, 0xD0, 0x00, 0xF8, 0x3E, 0x00, 0x3F, 0x02, 0xF0, 0x0B, 0xD0, 0x1F, 0x00, 0xFC, 0x00, 0xF8,
-    0x3F, 0x00, 0x0F, 0xC2, 0x90, 0x00, 0x68, 0x2F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xF8,
-    0x1F, 0xC0, 0xBD, 0x02, 0xE0, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1,
-    0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B,
-    0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xCB, 0xE0, 0x03,
-    0xFB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFD, 0x07, 0xFD, 0x2F, 0xE0, 0xBF, 0x40, 0xFF, 0x0F, 0xF0, 0x0F,
-    0xF0, 0xFE, 0x00, 0xFE, 0x0F, 0xD0, 0x0F, 0xE1, 0xFC, 0x02, 0xFD, 0x2F, 0xC0, 0x3F, 0xC3, 0xFE,
-    0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x7D, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE4, 0x02, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x2F, 0xF4, 0x24, 0x3F, 0xC0, 0x00, 0x7F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x40, 0x7F, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x01, 0xF8, 0x3F, 0x40, 0x3F, 0xFD, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xF0, 0xFF, 0xC0, 0xFF,
-    0x01, 0xFE, 0x07, 0xF8, 0x07, 0xF4, 0x2F, 0xC0, 0x1F, 0xC0, 0xFF, 0x00, 0xBF, 0x03, 0xFC, 0x03,
-    0xF8, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0xFF, 0x40, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFB, 0xF0,
-    0x01, 0xFF, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xF0, 0x7F, 0x81, 0xFD, 0x3F, 0xC0, 0x7F, 0x1F, 0xD0, 0x7F, 0xCB, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x80, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x01, 0xFF, 0xAB, 0xD0, 0x3F,
-    0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x07, 0xFE, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0x81, 0xA4, 0x03, 0xFF, 0xDF, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0x4F, 0xFC,
-    0x0F, 0xF0, 0x1F, 0xE0, 0x7F, 0x80, 0x7F, 0x42, 0xFD, 0x01, 0xFC, 0x0F, 0xF0, 0x0B, 0xF0, 0x3F,
-    0xC0, 0x3F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x1F, 0xF4, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0x00, 0x1F, 0xF3, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x50, 0x07, 0xFC,
-    0x02, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC7,
-    0xE0, 0x03, 0xFB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x07, 0xFE, 0x1F, 0xF0, 0xBF, 0xC0, 0xFF, 0x0F,
-    0xF0, 0x0F, 0xE0, 0xFF, 0x00, 0xFD, 0x0F, 0xE0, 0x1F, 0xD1, 0xFD, 0x02, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x3F, 0x43, 0xF4, 0x07, 0xF0, 0x7F, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x68, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x0F,
-    0xF0, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x01, 0xFD,
-    0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xA8, 0x03, 0xFC, 0x0F, 0xF4, 0x03, 0xF8, 0x3F,
-    0xD0, 0x07, 0xF4, 0xBF, 0x40, 0x0B, 0xF2, 0xFD, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x3F, 0xC3, 0xFC,
-    0x00, 0x3F, 0x81, 0xFE, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00,
-    0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07,
-    0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0x80, 0x1F, 0xD0, 0x07, 0xF4, 0x00, 0x01, 0xA0, 0xBE, 0x00, 0xBE, 0x00, 0x3F, 0x3F,
-    0xFC, 0x7F, 0xF8, 0x03, 0xFB, 0xFF, 0xEF, 0xFF, 0xC0, 0x7F, 0xE1, 0xFF, 0xD2, 0xFD, 0x0B, 0xFC,
-    0x0F, 0xF4, 0x1F, 0xD0, 0xFF, 0x00, 0xFF, 0x01, 0xFC, 0x0F, 0xF0, 0x1F, 0xD0, 0x2F, 0xC0, 0xFE,
-    0x02, 0xFC, 0x03, 0xFC, 0x1F, 0xD0, 0x2F, 0xC0, 0x3F, 0x82, 0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x3F,
-    0xC0, 0x3F, 0x80, 0x7F, 0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x3F, 0x40, 0xBF, 0x00, 0xFF, 0x07,
-    0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x01, 0xA0, 0xBE, 0x00, 0x3F, 0x3F, 0xFC, 0x03, 0xFB, 0xFF, 0xE0,
-    0x7F, 0xE1, 0xFF, 0x0B, 0xFC, 0x0F, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x0F, 0xD0, 0xFE, 0x01,
-    0xFD, 0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF4, 0x3F,
-    0x40, 0x7F, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x6F, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xC3, 0xFC, 0x3F, 0xC0, 0x7F, 0x5F, 0xD0, 0x0F, 0xEB, 0xF0, 0x03, 0xF7, 0xFC, 0x01, 0xFD,
-    0xFF, 0x00, 0xBF, 0x3F, 0xC0, 0x3F, 0xCB, 0xF0, 0x2F, 0xD1, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x2F, 0x80, 0x03, 0xF7, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x7F, 0xD2, 0xFE, 0x02, 0xFD, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0x80,
-    0x3F, 0x80, 0xFD, 0x00, 0xFE, 0x07, 0xF0, 0x0B, 0xF4, 0x2F, 0xC0, 0x3F, 0xC0, 0xFF, 0x82, 0xFE,
-    0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xEF, 0xFF, 0x00, 0x7F, 0x2F, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x46, 0x80, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x0F, 0xFC,
-    0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x00, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00,
-    0xFE, 0x0F, 0xF0, 0x1F, 0xD0, 0xFF, 0x03, 0xFD, 0x0B, 0xFE, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x01,
-    0xFF, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xA0, 0xBD, 0x03, 0xF7, 0xFC, 0x03, 0xFF,
-    0xFC, 0x07, 0xFF, 0xA8, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
-    0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xE0, 0x14, 0x1F, 0xE0,
-    0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0,
-    0x40, 0x0B, 0xF0, 0xBE, 0xBF, 0xF0, 0xBF, 0xFF, 0xC0, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0xBF, 0xE9, 0x7F, 0xFF, 0xDB, 0xFF, 0xFD, 0x0F, 0xE0,
-    0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x0B,
-    0xF4, 0x00, 0xBF, 0xED, 0x07, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90,
-    0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03,
-    0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B, 0xF0, 0x1F, 0xE0, 0xBF,
-    0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x2A, 0x8B, 0xF0, 0x07, 0xF8, 0x7F, 0x00, 0xFF, 0x07, 0xF0, 0x1F, 0xE0, 0x3F,
-    0x03, 0xFC, 0x03, 0xF4, 0x7F, 0x40, 0x3F, 0x4F, 0xF0, 0x03, 0xF5, 0xFD, 0x00, 0x3F, 0x6F, 0xC0,
-    0x02, 0xFB, 0xF4, 0x00, 0x2F, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x6A, 0x00, 0xAA, 0x00, 0xAA, 0x7F, 0x01, 0xFF, 0x01, 0xFD, 0x7F, 0x03, 0xFF, 0x02,
-    0xFC, 0x7F, 0x07, 0xFF, 0x03, 0xF4, 0x7F, 0x0B, 0xEF, 0x0B, 0xF0, 0x3F, 0x0F, 0xAF, 0x0F, 0xE0,
-    0x3F, 0x2F, 0x6F, 0x1F, 0xC0, 0x3F, 0x3F, 0x2F, 0x3F, 0x80, 0x3F, 0x7D, 0x2F, 0x7F, 0x00, 0x3F,
-    0xBC, 0x2F, 0xBE, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x2F, 0xD0, 0xBF,
-    0x80, 0x07, 0xF8, 0x7F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x1F, 0xE7, 0xF4, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x0F,
-    0xF4, 0x07, 0xF8, 0x00, 0x01, 0xA8, 0x00, 0xAA, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x1F, 0xC0, 0x3F,
-    0xC0, 0x07, 0xF0, 0x1F, 0xE0, 0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0x0F, 0xE2,
-    0xFC, 0x00, 0x02, 0xF8, 0xFD, 0x00, 0x00, 0xBE, 0xBF, 0x00, 0x00, 0x1F, 0xBF, 0x40, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x80, 0x7F, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFD, 0x00,
-    0x02, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0xBE, 0x00, 0x1B, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x1B, 0xF0, 0x00, 0x03, 0xF4,
-    0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00,
-    0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBD, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x68, 0x00, 0x79, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x90, 0x00, 0xBF,
-    0xC0, 0x06, 0xFE, 0x00, 0x7F, 0xE0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8,
-    0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x01, 0xF8, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x6F, 0xFF, 0xE6, 0xDB, 0xFF, 0xFF, 0xF6, 0x40, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x01, 0xFE, 0x02, 0xFE, 0x01, 0xFD, 0x00, 0x50, 0x00, 0x00, 0x01, 0x50, 0x03, 0xF0,
-    0x07, 0xF0, 0x0B, 0xE0, 0x0F, 0xE0, 0x0F, 0xD0, 0x1F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80,
-    0x7F, 0x80, 0xBF, 0x40, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0xBF, 0xF8, 0x07, 0xFF, 0xFC, 0x0F, 0xFE, 0xF4, 0x2F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x40,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0xC0,
-    0x7F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x08, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x1A, 0xFE, 0xA8, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x3D, 0x69, 0x3D, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x1F,
-    0x81, 0xF8, 0x2F, 0x00, 0xBC, 0x2F, 0x00, 0xBC, 0x1F, 0x40, 0xFC, 0x0F, 0xEB, 0xF8, 0x3F, 0xFF,
-    0xFD, 0x3E, 0xBF, 0xBD, 0x08, 0x00, 0x14, 0x1F, 0xC0, 0x07, 0xF4, 0x7F, 0x40, 0x3F, 0xC0, 0xFD,
-    0x02, 0xFC, 0x02, 0xF8, 0x0F, 0xD0, 0x07, 0xF0, 0xFF, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x3F, 0x7F,
-    0x40, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xAF, 0xFF, 0xA0, 0x03, 0xFF, 0xFF, 0xC0,
-    0x05, 0xBF, 0x95, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x15,
-    0xFE, 0x50, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x0B, 0xF5,
-    0x7C, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFF, 0xD0, 0x07, 0xF7,
-    0xFC, 0x03, 0xF0, 0x3F, 0x40, 0xFC, 0x0B, 0xD0, 0x3F, 0x43, 0xF0, 0x0B, 0xFF, 0xF4, 0x00, 0xBF,
-    0xF4, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x3D, 0x07, 0xFC, 0x0F, 0xFF,
-    0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1E, 0x3F, 0x4F, 0xCF, 0xC3, 0xF0,
-    0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x0B, 0xE9, 0xBF, 0x80,
-    0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0x00, 0x69, 0x0B, 0xC0, 0xB4, 0x1F, 0xFF, 0x0B, 0x43, 0x81,
-    0xF4, 0x14, 0x0F, 0x1D, 0x0F, 0x40, 0x00, 0x2C, 0xB0, 0x3C, 0x00, 0x00, 0x77, 0xC1, 0xF0, 0x00,
-    0x00, 0xEF, 0x07, 0xC0, 0x00, 0x03, 0xAC, 0x0F, 0x00, 0x00, 0x1D, 0x74, 0x3D, 0x00, 0x00, 0xB4,
-    0xE0, 0xBC, 0x00, 0x03, 0xC2, 0xC0, 0xBF, 0xF8, 0x2E, 0x03, 0xC0, 0x6F, 0x81, 0xF0, 0x07, 0xD0,
-    0x00, 0x2F, 0x00, 0x07, 0xF9, 0x5B, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x9E, 0x0F, 0xFF, 0xD1, 0xF4, 0xBC, 0x3F, 0x07, 0xC3, 0xE0, 0xBC,
-    0x3D, 0x0F, 0x83, 0xE2, 0xF4, 0x3F, 0xFF, 0x00, 0xB8, 0xA0, 0x00, 0x10, 0x01, 0x00, 0x00, 0xF4,
-    0x1F, 0x40, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xF4, 0xFF, 0x40, 0xBF, 0x4B, 0xF4,
-    0x03, 0xFC, 0x3F, 0xC0, 0x0B, 0xF0, 0xBF, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x2F, 0xC2, 0xFC, 0x00,
-    0x7F, 0x07, 0xF0, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xF5, 0xAA, 0xAA, 0xBD, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x05, 0x54, 0x3F, 0xFD, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x00, 0x00, 0x0B, 0xE9, 0xBF, 0x80, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0x0A, 0x94, 0x0B,
-    0xC0, 0xB4, 0x3F, 0xFD, 0x0B, 0x43, 0x80, 0xF1, 0xBC, 0x0F, 0x1D, 0x03, 0xC0, 0xF0, 0x2C, 0xB0,
-    0x0F, 0x03, 0xC0, 0x77, 0xC0, 0x3D, 0x7E, 0x00, 0xEF, 0x00, 0xFF, 0xE0, 0x03, 0xAC, 0x03, 0xDB,
-    0x80, 0x1D, 0x74, 0x0F, 0x0F, 0x40, 0xB4, 0xE0, 0x3C, 0x1F, 0x03, 0xC2, 0xC0, 0xF0, 0x3D, 0x2E,
-    0x03, 0xC2, 0x40, 0x25, 0xF0, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x07, 0xF9, 0x5B, 0xF0, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xFF, 0xE2, 0xF4, 0xBD, 0xF8, 0x0F, 0xBD,
-    0x03, 0xEF, 0xC1, 0xF5, 0xFF, 0xFC, 0x1F, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x29, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x15, 0x00, 0x1A, 0xAA, 0xAA, 0x9B, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x00,
-    0x14, 0x00, 0x3F, 0xF8, 0x0B, 0xFF, 0xD0, 0x34, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x7F,
-    0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0x86, 0xAA, 0xA0, 0x00, 0x14, 0x00,
-    0x3F, 0xF8, 0x07, 0xFF, 0xD0, 0x10, 0x7E, 0x00, 0x07, 0xD0, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x01,
-    0xF8, 0x00, 0x0F, 0xC3, 0x97, 0xF8, 0x3F, 0xFF, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0B,
-    0xF4, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x6A, 0x00, 0xA9, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFE, 0x01,
-    0xFD, 0x01, 0xFD, 0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF8, 0x03,
-    0xF8, 0x03, 0xF8, 0x07, 0xF4, 0x07, 0xF4, 0x0F, 0xF0, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFB, 0xC0, 0x1F, 0xEF, 0xCF, 0xC0, 0x2F, 0xC0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xF6, 0xE3,
-    0xFF, 0xFE, 0x1E, 0x3F, 0xFF, 0xE1, 0xE3, 0xFF, 0xFE, 0x1E, 0x3F, 0xFF, 0xE1, 0xE3, 0xFF, 0xFE,
-    0x1E, 0x3F, 0xFF, 0xE1, 0xE2, 0xFF, 0xFE, 0x1E, 0x0F, 0xFF, 0xE1, 0xE0, 0x7F, 0xFE, 0x1E, 0x00,
-    0x55, 0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1,
-    0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00,
-    0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xFC, 0x7F, 0xC3, 0xF4, 0x04, 0x00, 0x0B, 0x80,
-    0x3F, 0x80, 0x3F, 0x00, 0xFC, 0xBF, 0xF1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xFD, 0x3F,
-    0xFC, 0x7E, 0xFC, 0x25, 0xF8, 0x02, 0xF4, 0x02, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xE0, 0x06,
-    0x90, 0x07, 0xF8, 0x2F, 0xFE, 0x7E, 0x3F, 0xBC, 0x2F, 0xF8, 0x2F, 0xF8, 0x3E, 0xFC, 0xBD, 0x7F,
-    0xF8, 0x1F, 0xD0, 0x00, 0x40, 0x04, 0x00, 0xBC, 0x0B, 0xC0, 0x0F, 0xE0, 0xFE, 0x00, 0xBF, 0x0B,
-    0xF0, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0xC3, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x2F,
-    0xD3, 0xFD, 0x0B, 0xF4, 0xBF, 0x40, 0x7E, 0x07, 0xE0, 0x00, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0x2F, 0xF0, 0x00, 0xFC, 0x0B, 0xFF, 0x80, 0x0F, 0xC0,
-    0x3F, 0xFD, 0x00, 0xBD, 0x00, 0x63, 0xF0, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x2F, 0x42, 0xFC, 0x0B, 0xD1, 0xF8, 0x2F, 0xE0, 0x3F, 0x0F, 0xC1,
-    0xFF, 0x40, 0xA8, 0xFC, 0x1F, 0xFC, 0x00, 0x0B, 0xD0, 0xF7, 0xF0, 0x00, 0x7E, 0x0F, 0x8F, 0xC0,
-    0x03, 0xF0, 0xFD, 0xBE, 0x40, 0x2F, 0x03, 0xFF, 0xFF, 0x02, 0xF4, 0x0F, 0xFF, 0xF4, 0x1F, 0x80,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x01, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0xFD, 0x00,
-    0xBD, 0x00, 0x06, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0x01, 0x40, 0x01, 0xF8, 0x2F, 0x5F, 0xFD, 0x00, 0xBD, 0x1F, 0x8F, 0xFF, 0xC0, 0x3F, 0x0F, 0xC1,
-    0x83, 0xF0, 0x0A, 0x8F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x00, 0x07, 0xE0, 0x00,
-    0xBE, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0xF4, 0x01, 0xFF,
-    0xFD, 0x01, 0xF8, 0x00, 0xBF, 0xFF, 0x00, 0xFC, 0x00, 0x2A, 0xAA, 0x80, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x02, 0xF0, 0x0F, 0xFF, 0xC0, 0x07, 0xE0, 0x04, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x0F, 0x80, 0x3F, 0x00, 0x03, 0xFE, 0x00, 0xBD, 0x00, 0x07, 0xFD, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0xFE, 0xE5, 0xBF, 0x2F, 0x43, 0xFD, 0xFF, 0xFD,
-    0x7E, 0x0B, 0xFC, 0x6F, 0xA0, 0xFC, 0x2F, 0xFC, 0x00, 0x03, 0xF0, 0x7D, 0xF8, 0x00, 0x0B, 0xD1,
-    0xF5, 0xF4, 0x00, 0x1F, 0x83, 0xE6, 0xF4, 0x00, 0x3F, 0x07, 0xFF, 0xFE, 0x00, 0xFC, 0x07, 0xFF,
-    0xFD, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x06, 0x90, 0x00, 0x02, 0xF0, 0x00, 0x1F,
-    0xE0, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0x7F, 0x80, 0x02, 0xFC,
-    0x00, 0x0B, 0xF0, 0x05, 0x2F, 0xFA, 0xFC, 0x3F, 0xFF, 0xF4, 0x7F, 0xFF, 0x40, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00,
-    0x0F, 0xD7, 0xF0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x02, 0xFC, 0x0F, 0xC0,
-    0x00, 0xFE, 0x03, 0xF4, 0x00, 0xBF, 0x95, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0B, 0xF0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x2F, 0xC2, 0xFC, 0x00,
-    0x0B, 0xF0, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x0F, 0xEF, 0x80, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07, 0xF0, 0xFC,
-    0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0xBF,
-    0x95, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xF0, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03, 0xF8, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x07, 0xF1, 0xF8, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00,
-    0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0xFE, 0x0F,
-    0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0xBF, 0x95, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xF0, 0x00, 0xBF,
-    0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x1F, 0x80, 0xF0, 0x00, 0x07, 0xFF, 0xBE, 0x00, 0x00, 0xFA, 0xFF, 0xC0, 0x00, 0x0E, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x03, 0xF5, 0xFC, 0x00,
-    0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x80,
-    0xFD, 0x00, 0x0B, 0xF9, 0x5F, 0xD0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1E, 0x0B, 0x40, 0x00, 0x0F, 0xC7, 0xF0, 0x00,
-    0x03, 0xF1, 0xF8, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x7F, 0x7F,
-    0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x0B, 0xF0,
-    0x3F, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x02, 0xFE, 0x57, 0xF4, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xC0, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0xBF, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x03, 0xF5, 0xFC, 0x00,
-    0x01, 0xFC, 0x3F, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0xFD,
-    0x00, 0x2F, 0xE5, 0x7F, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x02, 0xFC, 0x3F, 0x80,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFE, 0xBF, 0x55, 0x50, 0x00, 0x00, 0x3F,
-    0xCB, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xF4, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE5, 0x7F, 0xD5, 0x50, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9,
-    0x55, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9, 0x55, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xF5, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xF1, 0xFC, 0x00,
-    0x3E, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xF0, 0x07, 0xF9, 0x55, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x55, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x82, 0xD0, 0x00, 0x3F,
-    0x5F, 0xC0, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFE, 0x55, 0x40, 0x07, 0xF4, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xF0, 0x03, 0xFD, 0x55, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x2F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xE2, 0xF4, 0x02, 0xF4, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x2D, 0x0A, 0x00, 0x1F, 0xCB, 0xE0, 0x07, 0xE2, 0xF4, 0x00, 0x50, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xF9, 0x6F, 0xF4, 0x01, 0xFD, 0x01,
-    0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x5F, 0xF5, 0x02, 0xFC, 0x3F, 0xFF,
-    0xD0, 0xFF, 0x1F, 0xFF, 0xF0, 0x3F, 0xC6, 0xFF, 0xA8, 0x0F, 0xF0, 0x3F, 0xC0, 0x0B, 0xF4, 0x0F,
-    0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFE, 0x02, 0xFD, 0x1B, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xE0, 0x00, 0x00,
-    0xBF, 0xFB, 0xD0, 0x00, 0x00, 0xFB, 0xFF, 0xC0, 0x00, 0x01, 0xD0, 0x6E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03,
-    0xF8, 0x01, 0xFF, 0xF0, 0x03, 0xF4, 0x02, 0xFF, 0xF0, 0x07, 0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0,
-    0x03, 0xF6, 0xFC, 0x0B, 0xE0, 0x03, 0xF1, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B,
-    0xF0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F, 0x2F, 0xC0, 0x0F, 0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0,
-    0x3F, 0xFF, 0x40, 0x1F, 0xC0, 0x1F, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F,
-    0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xFE, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F,
-    0xD0, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x02, 0xFD,
-    0xBF, 0x40, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x2F, 0xD1, 0xFF, 0x00, 0x1F,
-    0xF0, 0x3F, 0xE0, 0x2F, 0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80,
-    0xBF, 0xC0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x7F, 0x4F, 0xF0,
-    0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0xFF, 0x2F,
-    0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x2F, 0xD1, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x2F, 0xF4,
-    0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x1F, 0xC7, 0xF0, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0xFF, 0x80, 0x0F,
-    0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x1F, 0xD3, 0xF8, 0x00,
-    0x07, 0xF5, 0xFD, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4,
-    0x00, 0x2F, 0xD1, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x2F, 0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x0F, 0x00, 0x00, 0xFF, 0xEF, 0xC0, 0x00, 0xBE, 0xFF, 0xD0, 0x00, 0x3C, 0x0B, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFE, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x01, 0xFD,
-    0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x0B, 0xF6, 0xFD, 0x00, 0x03,
-    0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47, 0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0x80,
-    0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0xB8, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xC0,
-    0x00, 0x01, 0x41, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00,
-    0x0B, 0xF4, 0xBF, 0x40, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4,
-    0x00, 0x0B, 0xF6, 0xFD, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47,
-    0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x3C, 0x3F,
-    0x80, 0xFE, 0x0F, 0xE3, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFF,
-    0xE0, 0x0F, 0xF7, 0xF8, 0x3F, 0xC0, 0xFE, 0x2F, 0x00, 0x3D, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x01, 0xFF, 0xE7, 0xD0, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFE,
-    0x02, 0xFF, 0x03, 0xFD, 0x01, 0xFF, 0xD1, 0xFE, 0x00, 0xFF, 0xF4, 0xBF, 0x00, 0xFD, 0xFD, 0x3F,
-    0xC0, 0xBD, 0x3F, 0x4F, 0xE0, 0x7E, 0x1F, 0xD7, 0xF4, 0x3E, 0x07, 0xF1, 0xFC, 0x3F, 0x02, 0xFC,
-    0x7F, 0x3F, 0x00, 0xFE, 0x1F, 0xFF, 0x40, 0xBF, 0x47, 0xFF, 0x80, 0x7F, 0xC0, 0xFF, 0xC0, 0x7F,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xEF, 0xFF, 0x80, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x01, 0xFD, 0x00,
-    0x3F, 0xC0, 0xBF, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8,
-    0x00, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F,
-    0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x7F, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xF4,
-    0x0F, 0xF0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x0F,
-    0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x02, 0xFD, 0x00,
-    0x3F, 0x80, 0xBF, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8,
-    0x00, 0xFF, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x2F,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x02, 0xFC, 0x03,
-    0xF8, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x07, 0xF4,
-    0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x1F,
-    0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x01, 0xFE, 0x00,
-    0x7F, 0x80, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xA0, 0x00, 0x01, 0xFC, 0xFE,
-    0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x1F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x02, 0xFC,
-    0x00, 0x3F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x0B, 0xF0, 0x1F, 0xE0, 0x03, 0xFC, 0x0B,
-    0xF4, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x0B, 0xF0,
-    0x1F, 0xE0, 0x03, 0xFC, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x1F, 0xD0, 0x0B, 0xF4, 0x3F, 0x80, 0x7F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x02, 0xFC, 0x2F, 0xD0, 0x07, 0xF4, 0xFE, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x80, 0x3F,
-    0xC1, 0xFF, 0x00, 0xFE, 0x02, 0xFD, 0x07, 0xF4, 0x0B, 0xF4, 0x2F, 0xC0, 0x3F, 0xC0, 0xFF, 0x01,
-    0xFF, 0x03, 0xFE, 0xBF, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xE0, 0x02, 0xFE, 0x54, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x01, 0xFE, 0x00,
-    0x03, 0xFC, 0x0B, 0xFC, 0x00, 0x03, 0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xF4, 0xFF, 0x40, 0x00, 0x0B,
-    0xF1, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0xBF, 0xD0, 0x00, 0x0F, 0xE0,
-    0x3F, 0xF4, 0x00, 0x1F, 0xD0, 0x0B, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x02,
-    0xFC, 0x00, 0x3F, 0xCE, 0xAB, 0xF8, 0x00, 0x3F, 0x8F, 0xFF, 0xF0, 0x00, 0x7F, 0x4F, 0xFF, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F,
-    0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF,
-    0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC,
-    0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46,
-    0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8,
-    0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0,
-    0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xD3, 0xF0,
-    0x02, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F,
-    0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xE0,
-    0x0B, 0xFF, 0xBD, 0x00, 0xFB, 0xFF, 0x80, 0x1D, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4,
-    0x69, 0x03, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4, 0xFF, 0xC3, 0xFC, 0x07, 0xF8, 0x7F,
-    0x80, 0x7F, 0x4B, 0xF4, 0x07, 0xF0, 0xFF, 0x00, 0xBF, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF, 0x01, 0xFE,
-    0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEF, 0xC0, 0x1F, 0xF5, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x1A, 0x00, 0x0B, 0xE3, 0xF4, 0x00, 0xBE, 0x3F, 0x00, 0x01, 0x40, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x69, 0x03, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4,
-    0xFF, 0xC3, 0xFC, 0x07, 0xF8, 0x7F, 0x80, 0x7F, 0x4B, 0xF4, 0x07, 0xF0, 0xFF, 0x00, 0xBF, 0x0F,
-    0xF0, 0x0F, 0xE0, 0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEF,
-    0xC0, 0x1F, 0xF5, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x2D, 0x2D, 0x00, 0x02, 0xD2, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE4, 0x69, 0x03, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4, 0xFF, 0xC3, 0xFC,
-    0x07, 0xF8, 0x7F, 0x80, 0x7F, 0x4B, 0xF4, 0x07, 0xF0, 0xFF, 0x00, 0xBF, 0x0F, 0xF0, 0x0F, 0xE0,
-    0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEF, 0xC0, 0x1F, 0xF5,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x46, 0x5B, 0xE4, 0x00, 0xFF, 0xF7, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xC3, 0xFF, 0x81, 0xFC, 0x3F, 0xC0, 0x7F, 0x80, 0xBF, 0x1F,
-    0xE0, 0x1F, 0xD0, 0x7F, 0xCB, 0xF0, 0x07, 0xFF, 0xFF, 0xC3, 0xFC, 0x02, 0xFF, 0xFF, 0x80, 0xFF,
-    0x00, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0x01, 0x02, 0xFF,
-    0xFF, 0xFF, 0xAB, 0xC0, 0x3F, 0xFE, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x7D, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x02, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x2F, 0xF4, 0x24,
-    0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xBF, 0x40, 0x40, 0x7F, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x03, 0xE0,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x0B, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x07, 0xF8, 0x1F,
-    0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xF8, 0x0F, 0xFA, 0x50,
-    0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x1F, 0xFA, 0xBD, 0x03, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xD0, 0x00,
-    0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x0B, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0x07, 0xF8, 0x1F, 0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xF8, 0x0F, 0xFA, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x1F, 0xFA, 0xBD, 0x03,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0xD0, 0x03, 0xF4, 0xFC, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x40, 0x0B, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x07, 0xF8, 0x1F, 0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07,
-    0xFC, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xF8, 0x0F, 0xFA, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x10, 0x1F, 0xFA, 0xBD, 0x03, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x1E, 0x00, 0x3F, 0x8F, 0xC0, 0x0F, 0xD3, 0xF0, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0xFF, 0xFC, 0x1F, 0xE0, 0x7F, 0x4F, 0xF0, 0x1F, 0xC7,
-    0xF4, 0x1F, 0xF2, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE0, 0x3F, 0xE9, 0x40, 0x0F, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x40, 0x7F, 0xEA, 0xF4, 0x0F, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xA8, 0x03, 0xFC,
-    0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xD0, 0x2F, 0xC0,
-    0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x40, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFC,
-    0x00, 0x2F, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xF8,
-    0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFD,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xFC, 0x0B, 0xE1, 0xF8, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x1A, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0x82, 0xD0, 0xFC, 0xBE, 0x0F, 0xCB, 0xE0, 0x50, 0x14,
-    0x00, 0x00, 0x00, 0x1A, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x80,
-    0x03, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x02, 0x40, 0x00, 0xBF,
-    0xBF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x01, 0xE1, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0xDB, 0xD0, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xEF, 0xFE, 0x07,
-    0xFC, 0x0F, 0xF8, 0x3F, 0xC0, 0x2F, 0xD0, 0xFF, 0x00, 0xBF, 0x43, 0xF8, 0x03, 0xFC, 0x0F, 0xE0,
-    0x0F, 0xE0, 0x3F, 0xC0, 0xFF, 0x40, 0xBF, 0xEF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x3C, 0x00, 0x7F, 0xFB, 0xE0, 0x03, 0xEB, 0xFF,
-    0x00, 0x0E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x82, 0xF8, 0x00, 0x3F, 0x3F, 0xFC, 0x00,
-    0xFE, 0xFF, 0xF8, 0x07, 0xFE, 0x1F, 0xF0, 0x2F, 0xF0, 0x3F, 0xC0, 0xFF, 0x00, 0xFE, 0x03, 0xFC,
-    0x03, 0xF4, 0x0F, 0xE0, 0x1F, 0xD0, 0x7F, 0x40, 0xBF, 0x02, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F,
-    0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x0B, 0xFC, 0x3F, 0xC3, 0xFC, 0x07,
-    0xF5, 0xFD, 0x00, 0xFE, 0xBF, 0x00, 0x3F, 0x7F, 0xC0, 0x1F, 0xDF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03,
-    0xFC, 0xBF, 0x02, 0xFD, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xC0, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x0B,
-    0xFC, 0x3F, 0xC3, 0xFC, 0x07, 0xF5, 0xFD, 0x00, 0xFE, 0xBF, 0x00, 0x3F, 0x7F, 0xC0, 0x1F, 0xDF,
-    0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xBF, 0x02, 0xFD, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF,
-    0xD0, 0x03, 0xF4, 0xFC, 0x03, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0x0B, 0xFC, 0x3F, 0xC3, 0xFC, 0x07, 0xF5, 0xFD, 0x00, 0xFE, 0xBF, 0x00,
-    0x3F, 0x7F, 0xC0, 0x1F, 0xDF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xBF, 0x02, 0xFD, 0x1F, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x42, 0xD0,
-    0x0F, 0xFF, 0xFC, 0x01, 0xFB, 0xFF, 0x40, 0x2C, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x2F, 0xF0, 0xFF, 0x03, 0xFC, 0x07, 0xF4, 0x7F,
-    0x40, 0x3F, 0x8B, 0xF0, 0x03, 0xF4, 0xFF, 0x00, 0x7F, 0x4F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFF,
-    0x0B, 0xF0, 0x2F, 0xD0, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x1E, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x00, 0x50, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x2F, 0xF0, 0xFF, 0x0F,
-    0xF0, 0x1F, 0xD7, 0xF4, 0x03, 0xFA, 0xFC, 0x00, 0xFD, 0xFF, 0x00, 0x7F, 0x7F, 0xC0, 0x2F, 0xCF,
-    0xF0, 0x0F, 0xF2, 0xFC, 0x0B, 0xF4, 0x7F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF5, 0xAA, 0xAA, 0xA8, 0x00, 0x04, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xAC, 0x00, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x0B, 0xF8, 0x3F, 0xC0,
-    0xFE, 0x0F, 0xFD, 0x1F, 0xD2, 0xFF, 0xE2, 0xFC, 0x7D, 0xFD, 0x3F, 0xDF, 0x5F, 0xD3, 0xFF, 0xE2,
-    0xFC, 0x3F, 0xFC, 0x3F, 0xC2, 0xFF, 0x0B, 0xF4, 0x1F, 0xFB, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xE0, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xA0, 0x0A, 0x90, 0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B, 0xF0,
-    0x1F, 0xE0, 0xBF, 0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90, 0xFE, 0x00, 0xFD,
-    0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80,
-    0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B, 0xF0, 0x1F, 0xE0, 0xBF, 0x03, 0xFE, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xE2, 0xF4, 0x02, 0xF4, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90, 0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02,
-    0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F,
-    0x00, 0xFF, 0x0B, 0xF0, 0x1F, 0xE0, 0xBF, 0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC,
-    0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0A, 0x00, 0x07, 0xF3, 0xF4, 0x00,
-    0xBE, 0x3F, 0x40, 0x01, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xA9, 0x0F, 0xE0, 0x0F,
-    0xD1, 0xFD, 0x01, 0xFC, 0x1F, 0xC0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8,
-    0x07, 0xF4, 0x7F, 0x40, 0xBF, 0x07, 0xF0, 0x0F, 0xF0, 0xBF, 0x01, 0xFE, 0x0B, 0xF0, 0x3F, 0xE0,
-    0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xDF, 0xC0, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x0A, 0xA0, 0x0B, 0xF0, 0x07, 0xF8,
-    0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x01, 0xFE, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x03, 0xF4, 0x3F,
-    0x80, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B, 0xEB, 0xF0, 0x00, 0x01, 0xFB,
-    0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x02, 0xFC, 0xBE, 0x00, 0x0F, 0xEF, 0xFF, 0x00, 0x3F, 0xFF, 0xFD, 0x01, 0xFF, 0x8B, 0xF8, 0x0B,
-    0xF8, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xFE, 0x00, 0xFE, 0x03, 0xF4, 0x07, 0xF8, 0x1F, 0xC0,
-    0x2F, 0xD0, 0xBF, 0x00, 0xFF, 0x03, 0xFE, 0x0B, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xBF, 0xFD,
-    0x01, 0xFC, 0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x06, 0x81, 0xE0, 0x00,
-    0x03, 0xF4, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x2A, 0x80, 0x2F, 0xC0, 0x1F, 0xE0, 0x07, 0xF0, 0x0F, 0xF0, 0x01, 0xFC, 0x07,
-    0xF8, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x00, 0xBE,
-    0x3F, 0x40, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x07, 0xEF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x40, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0xFD, 0x7F,
-    0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x0F, 0xE0,
-    0x3F, 0x40, 0x0B, 0xF9, 0x5F, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0xBF, 0x0F,
-    0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x2A, 0xAA, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC,
-    0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00,
-    0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01,
-    0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7C,
-    0x00, 0x00, 0x7F, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x0F, 0xEF, 0x80, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07, 0xF0,
-    0xFC, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00,
-    0xBF, 0x95, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03, 0xF8,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0xBF, 0xBF, 0x40, 0x03, 0xFF,
-    0xE0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F,
-    0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x01,
-    0xFD, 0xFC, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3F, 0x83, 0xF0, 0x00,
-    0x2F, 0xC0, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x0B, 0xF9, 0x5F, 0xD0, 0x03, 0xFF, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02,
-    0xFC, 0x2F, 0xC0, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F,
-    0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x02, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xF8, 0x2F, 0xF4, 0x24, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x40, 0x7F, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xF8, 0x03, 0xF8, 0xFD, 0x0B, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x02, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xF8, 0x2F, 0xF4, 0x24, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x40, 0x7F, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x41, 0xB0,
-    0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xE4, 0x02, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x2F, 0xF4, 0x24, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x40, 0x7F,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0xBD, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xCF, 0xD0, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x0B, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x0B, 0xFD, 0x09, 0x03,
-    0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x40, 0x1F, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x1F, 0x9F,
-    0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x96, 0xFF, 0x40, 0x1F,
-    0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x2F, 0xC0,
-    0x7F, 0x40, 0x0F, 0xF0, 0x2F, 0xC0, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0xBF,
-    0x40, 0xFE, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0xE0, 0x2F, 0xD1, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xFE, 0x00,
-    0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xF2, 0xF4, 0x00, 0x00, 0x0F, 0xF3, 0xD0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0x03, 0xFF, 0xDF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x7F, 0x40,
-    0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00,
-    0xFF, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFE, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xF9, 0x6F, 0xF4, 0x01,
-    0xFD, 0x01, 0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x5F, 0xF5, 0x02, 0xFC,
-    0x3F, 0xFF, 0xD0, 0xFF, 0x1F, 0xFF, 0xF0, 0x3F, 0xC6, 0xFF, 0xA8, 0x0F, 0xF0, 0x3F, 0xC0, 0x0B,
-    0xF4, 0x0F, 0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFE, 0x02, 0xFD, 0x1B, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x05, 0x5F, 0xE4, 0x00,
-    0x00, 0x0F, 0xD0, 0x01, 0xFF, 0x5F, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x3F,
-    0xE0, 0xBF, 0x80, 0x3F, 0x80, 0x7F, 0x40, 0xBF, 0x40, 0x7F, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0xFF,
-    0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFE, 0xFC, 0x00, 0x1F, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xA0, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0xFF, 0x55, 0x50, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6A,
-    0xAA, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF,
-    0xFF, 0x40, 0xBF, 0xFF, 0xF0, 0x7F, 0x81, 0xFD, 0x3F, 0xC0, 0x7F, 0x1F, 0xD0, 0x7F, 0xCB, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x80, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x01, 0xFF,
-    0xAB, 0xD0, 0x3F, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x03, 0xD0, 0x00, 0xFE, 0xBF, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9,
-    0x55, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xE0, 0x0F, 0xEB, 0xF0,
-    0x01, 0xFF, 0xF4, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x0B, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x07, 0xF8, 0x1F, 0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xF8, 0x0F, 0xFA, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x1F, 0xFA, 0xBD,
-    0x03, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9, 0x55,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x3F, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x0B, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0x07, 0xF8, 0x1F, 0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xF8, 0x0F, 0xFA, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x1F, 0xFA, 0xBD, 0x03,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0xFF, 0x55, 0x50, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xF0, 0x7F, 0x81, 0xFD, 0x3F, 0xC0, 0x7F, 0x1F, 0xD0, 0x7F, 0xCB, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x80, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x01, 0xFF, 0xAB, 0xD0, 0x3F,
-    0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0xFC, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x55,
-    0x40, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xF5, 0x55, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFD,
-    0x00, 0x7E, 0x7F, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x01, 0xFE, 0x07, 0xF4, 0x3F, 0xC0, 0x7F, 0x07,
-    0xF4, 0x1F, 0xF0, 0xBF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xA5, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xBF, 0x00, 0x10, 0x07, 0xFE, 0xAF, 0x40, 0x3F, 0xFF, 0xF4, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x07, 0xF0, 0xFC, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40, 0x6C, 0x0B, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x7F,
-    0x40, 0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xF8, 0xBF, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x0B, 0xF0, 0x7F,
-    0xC0, 0x0F, 0xF0, 0x3F, 0xE0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x1A, 0x40, 0x3F, 0xFD, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xF4, 0xFF, 0xC0, 0xFF, 0x01, 0xFE,
-    0x07, 0xF8, 0x07, 0xF4, 0x2F, 0xD0, 0x1F, 0xC0, 0xFF, 0x00, 0xBF, 0x03, 0xFC, 0x03, 0xF8, 0x0F,
-    0xF0, 0x1F, 0xE0, 0x3F, 0xC1, 0xFF, 0x40, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x05, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x3E, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40,
-    0x6C, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xF8, 0xBF, 0x40, 0x07,
-    0xF4, 0x7F, 0x40, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F, 0xF0, 0x3F, 0xE0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x02, 0xFE, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x02, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x1A, 0x40, 0x3F, 0xFD, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xF4, 0xFF, 0xC0, 0xFF, 0x01, 0xFE, 0x07, 0xF8, 0x07, 0xF4, 0x2F, 0xD0, 0x1F, 0xC0, 0xFF, 0x00,
-    0xBF, 0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC1, 0xFF, 0x40, 0xBF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x05,
-    0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40, 0x6C, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC, 0xBF,
-    0x40, 0xFF, 0xF8, 0xBF, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F, 0xF0, 0x3F,
-    0xE0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x1A, 0x40, 0x3F, 0xFD,
-    0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xF4, 0xFF, 0xC0, 0xFF, 0x01, 0xFE, 0x07, 0xF8, 0x07, 0xF4,
-    0x2F, 0xD0, 0x1F, 0xC0, 0xFF, 0x00, 0xBF, 0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F,
-    0xC1, 0xFF, 0x40, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x3F, 0x80, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x05, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40, 0x6C, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x7F, 0x40, 0xFF,
-    0xFC, 0xBF, 0x40, 0xFF, 0xF8, 0xBF, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F,
-    0xF0, 0x3F, 0xE0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x1A, 0x40, 0x3F, 0xFD, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xF4, 0xFF, 0xC0, 0xFF,
-    0x01, 0xFE, 0x07, 0xF8, 0x07, 0xF4, 0x2F, 0xD0, 0x1F, 0xC0, 0xFF, 0x00, 0xBF, 0x03, 0xFC, 0x03,
-    0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC1, 0xFF, 0x40, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x05, 0x00, 0x7F, 0xC0, 0x2F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x8B, 0xD0, 0x00, 0x0B, 0xD0,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x01, 0xFD, 0x00,
-    0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xE0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x07,
-    0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xF5, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC,
-    0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0x80,
-    0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x7F, 0x1F, 0x80, 0x1F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC7,
-    0xE0, 0x03, 0xFB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x07, 0xFE, 0x1F, 0xF0, 0xBF, 0xC0, 0xFF, 0x0F,
-    0xF0, 0x0F, 0xE0, 0xFF, 0x00, 0xFD, 0x0F, 0xE0, 0x1F, 0xD1, 0xFD, 0x02, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x3F, 0x43, 0xF4, 0x07, 0xF0, 0x7F, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xD0, 0x0A, 0xFF, 0xAA, 0xBF, 0xE8, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00,
-    0x7F, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xF5, 0x56, 0xFD, 0x00, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00,
-    0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x3F,
-    0x80, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x06, 0xFD, 0x54, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8,
-    0xFF, 0x40, 0x3F, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0xBF, 0xD0, 0xFE, 0x0B, 0xF4, 0x0F, 0xE0,
-    0xFF, 0x00, 0xFD, 0x0F, 0xE0, 0x1F, 0xD1, 0xFD, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03,
-    0xF8, 0x3F, 0x80, 0x3F, 0x43, 0xF4, 0x07, 0xF0, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0x41, 0xE0,
-    0x0B, 0xFF, 0xBD, 0x00, 0xFB, 0xFF, 0xC0, 0x1D, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x07, 0xE0, 0x3C,
-    0x1F, 0xFE, 0xF8, 0x3E, 0xBF, 0xF0, 0x38, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2A, 0xAA, 0x40, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x0A, 0xAA,
-    0x90, 0xFF, 0xFD, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00,
-    0x7F, 0x40, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0xBC, 0x00, 0xBF, 0xBF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x03, 0xC1, 0xFE, 0xBF, 0x03, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x01, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x90, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1A, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xD0,
-    0x01, 0xFD, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0xD4, 0x00, 0xBF, 0xC0, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x07,
-    0xF4, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x01, 0xA8, 0x03,
-    0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xD0, 0x2F,
-    0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x40, 0x7F, 0x40, 0x00, 0xFF, 0xFE, 0x02, 0xFC, 0x00, 0xFF,
-    0xFE, 0x03, 0xFC, 0x00, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x1F,
-    0xE0, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0xC0,
-    0x01, 0xFD, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0xFE, 0x00, 0xBF, 0xFF,
-    0x41, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xBC, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0xFF, 0x02,
-    0xFD, 0x00, 0x68, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x02, 0xA4, 0x03, 0xFC, 0x07,
-    0xF4, 0x03, 0xF8, 0x0B, 0xF0, 0x07, 0xF4, 0x0F, 0xF0, 0x0B, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F,
-    0xE0, 0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xE0, 0x2F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x2F, 0xC0, 0x3F,
-    0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x7F, 0x40, 0xFF,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x0B, 0xE1, 0xF8,
-    0x00, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF4, 0x00, 0xFE, 0x02, 0xFE,
-    0x00, 0x1F, 0xD0, 0xBF, 0xC0, 0x01, 0xFC, 0x1F, 0xF0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x03, 0xFC,
-    0xFF, 0x40, 0x00, 0x3F, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x01, 0xFD, 0x0F,
-    0xF0, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x03,
-    0xF4, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xA8, 0x03, 0xFC, 0x0F, 0xF4, 0x03, 0xF8, 0x3F, 0xD0, 0x07,
-    0xF4, 0xBF, 0x40, 0x0B, 0xF2, 0xFD, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F,
-    0x81, 0xFE, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x01, 0xA8, 0x02, 0xA8, 0x03, 0xFC, 0x0F, 0xF4, 0x03, 0xF8, 0x3F, 0xD0, 0x07,
-    0xF4, 0xBF, 0x40, 0x0B, 0xF2, 0xFD, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F,
-    0x81, 0xFE, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00,
-    0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0,
-    0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x0B,
-    0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x03, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00, 0xA4, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xF0, 0x03,
-    0xFC, 0x2F, 0x80, 0x0F, 0xE0, 0xFC, 0x00, 0x7F, 0x47, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0x1F, 0xC0, 0x0F, 0xF2, 0xF8, 0x00, 0xFE, 0x3F, 0x00, 0x1F, 0xDB, 0xC0, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0xBD, 0x07, 0xF4, 0x7F, 0x82,
-    0xFC, 0x1F, 0xD0, 0xFF, 0x02, 0x90, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0xBD, 0x0B, 0xF1, 0xFE, 0x0F, 0xF1, 0xFE, 0x0F, 0xF0,
-    0x64, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC4, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xE0,
-    0x01, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xF8, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x7F, 0x40, 0x2F,
-    0xC0, 0x0F, 0xF8, 0x03, 0xFF, 0x41, 0xFF, 0xE2, 0xFF, 0xD3, 0xFF, 0xC0, 0x7F, 0xF0, 0x0B, 0xF8,
-    0x01, 0xFD, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00,
-    0xFF, 0xC0, 0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xF8, 0x01, 0xFF, 0xF0, 0x03, 0xF4, 0x02, 0xFF,
-    0xF0, 0x07, 0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0, 0x03, 0xF6, 0xFC, 0x0B, 0xE0, 0x03, 0xF1, 0xFC,
-    0x0F, 0xE0, 0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B, 0xF0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F, 0x2F,
-    0xC0, 0x0F, 0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0, 0x3F, 0xFF, 0x40, 0x1F, 0xC0, 0x1F, 0xFF, 0x40,
-    0x2F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xFE, 0x00, 0x7F,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0B, 0xE0, 0x00, 0xFC,
-    0xFF, 0xF0, 0x03, 0xFB, 0xFF, 0xE0, 0x1F, 0xF8, 0x7F, 0xC0, 0xBF, 0xC0, 0xFF, 0x03, 0xFC, 0x03,
-    0xF8, 0x0F, 0xF0, 0x0F, 0xD0, 0x3F, 0x80, 0x7F, 0x41, 0xFD, 0x02, 0xFC, 0x0B, 0xF0, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x3F, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x07, 0xF0, 0x1F, 0xC0, 0x2F, 0xC0, 0x00,
-    0xBF, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xF8, 0x01, 0xFF,
-    0xF0, 0x03, 0xF4, 0x02, 0xFF, 0xF0, 0x07, 0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0, 0x03, 0xF6, 0xFC,
-    0x0B, 0xE0, 0x03, 0xF1, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B, 0xF0, 0xFF, 0x1F,
-    0xC0, 0x0F, 0xE0, 0x7F, 0x2F, 0xC0, 0x0F, 0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0, 0x3F, 0xFF, 0x40,
-    0x1F, 0xC0, 0x1F, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0x00, 0x3F,
-    0x40, 0x0B, 0xFE, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0xA0, 0xBE, 0x00, 0x3F, 0x3F, 0xFC, 0x03, 0xFB,
-    0xFF, 0xE0, 0x7F, 0xE1, 0xFF, 0x0B, 0xFC, 0x0F, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x0F, 0xD0,
-    0xFE, 0x01, 0xFD, 0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03,
-    0xF4, 0x3F, 0x40, 0x7F, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFC,
-    0x00, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xF8, 0x01, 0xFF, 0xF0, 0x03, 0xF4, 0x02,
-    0xFF, 0xF0, 0x07, 0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0, 0x03, 0xF6, 0xFC, 0x0B, 0xE0, 0x03, 0xF1,
-    0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B, 0xF0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F,
-    0x2F, 0xC0, 0x0F, 0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0, 0x3F, 0xFF, 0x40, 0x1F, 0xC0, 0x1F, 0xFF,
-    0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xFE, 0x00,
-    0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x0F, 0xDB,
-    0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0xBE,
-    0x00, 0x03, 0xF3, 0xFF, 0xC0, 0x03, 0xFB, 0xFF, 0xE0, 0x07, 0xFE, 0x1F, 0xF0, 0x0B, 0xFC, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xD0, 0x0F, 0xE0, 0x1F, 0xD0, 0x1F, 0xD0, 0x2F,
-    0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x40, 0x7F,
-    0x00, 0x7F, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x4A, 0x42, 0xF8, 0x0F, 0xC7, 0xE7, 0xFF, 0x81, 0x42,
-    0xFB, 0xFF, 0xF0, 0x00, 0xFF, 0xD2, 0xFD, 0x00, 0x3F, 0xD0, 0x7F, 0x40, 0x0F, 0xF0, 0x1F, 0xC0,
-    0x07, 0xF4, 0x0B, 0xF0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x7F,
-    0x40, 0x1F, 0xD0, 0x1F, 0xC0, 0x07, 0xF0, 0x0B, 0xF0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0xFE, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x03, 0xFF, 0x00, 0x0B, 0xE0, 0x0F, 0xFD, 0x00, 0x3F,
-    0x80, 0x7F, 0xF8, 0x00, 0xFD, 0x01, 0xFF, 0xF0, 0x07, 0xF0, 0x0B, 0xDF, 0xE0, 0x2F, 0xC0, 0x3F,
-    0x6F, 0xC0, 0xFE, 0x00, 0xFC, 0x3F, 0x43, 0xF4, 0x07, 0xF0, 0xFE, 0x0F, 0xC0, 0x2F, 0xC1, 0xFC,
-    0x7F, 0x00, 0xFE, 0x03, 0xF6, 0xFC, 0x03, 0xF4, 0x0B, 0xFB, 0xE0, 0x0F, 0xC0, 0x1F, 0xFF, 0x40,
-    0x7F, 0x00, 0x3F, 0xFC, 0x02, 0xF8, 0x00, 0xBF, 0xF0, 0x0F, 0xE0, 0x00, 0xFF, 0xC0, 0x3F, 0x40,
-    0x03, 0xFE, 0x00, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xBF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0xBE, 0x00, 0x3F, 0x3F, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x7F,
-    0xE1, 0xFF, 0x0B, 0xFC, 0x0F, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x0F, 0xD0, 0xFE, 0x01, 0xFD,
-    0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF4, 0x3F, 0x40,
-    0x7F, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFD, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xAA, 0xA4, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00,
-    0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x0B, 0xFC, 0x0F, 0xF8, 0x00, 0xFF,
-    0x07, 0xFC, 0x00, 0x2F, 0xD2, 0xFD, 0x00, 0x07, 0xF4, 0xFF, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00,
-    0x7F, 0x5F, 0xD0, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x0F, 0xF2, 0xFD, 0x00, 0x07, 0xFC, 0x7F, 0x40,
-    0x02, 0xFD, 0x1F, 0xF0, 0x01, 0xFF, 0x03, 0xFE, 0x02, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x00,
-    0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xC3, 0xFC, 0x3F, 0xC0, 0x7F, 0x5F, 0xD0, 0x0F, 0xEB, 0xF0, 0x03, 0xF7,
-    0xFC, 0x01, 0xFD, 0xFF, 0x00, 0xBF, 0x3F, 0xC0, 0x3F, 0xCB, 0xF0, 0x2F, 0xD1, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x0F, 0x40, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0xFF, 0x80, 0xBF, 0xC0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F, 0xD0, 0x00,
-    0x7F, 0x4F, 0xF0, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x02, 0xFD, 0xBF, 0x40,
-    0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x2F, 0xD1, 0xFF, 0x00, 0x1F, 0xF0, 0x3F,
-    0xE0, 0x2F, 0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x0F, 0xEB, 0xF0, 0x01,
-    0xFF, 0xF8, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0x0B, 0xFC, 0x3F, 0xC3, 0xFC, 0x07, 0xF5, 0xFD, 0x00, 0xFE, 0xBF, 0x00, 0x3F, 0x7F,
-    0xC0, 0x1F, 0xDF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xBF, 0x02, 0xFD, 0x1F, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x03, 0xD0,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF8, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x07, 0xFC,
-    0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x07,
-    0xF4, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0xBF, 0x40, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x07, 0xFC, 0x07,
-    0xF4, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x2F, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0xB8, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x7F, 0x40, 0x3F,
-    0x80, 0xBF, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0xBF, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFE, 0x02, 0xFE,
-    0x55, 0x40, 0x3F, 0xE0, 0x0B, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF4, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x07, 0xF4,
-    0x00, 0xBF, 0xFF, 0xF0, 0x1F, 0xD0, 0x03, 0xFD, 0x55, 0x00, 0x7F, 0x40, 0x0F, 0xE0, 0x00, 0x01,
-    0xFD, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x0B, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x2F, 0xE4, 0x00, 0xFF, 0xFE,
-    0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0x83, 0xFF, 0xC0, 0xFD, 0x3F, 0xC0, 0xBF,
-    0xC0, 0x7F, 0x5F, 0xD0, 0x1F, 0xE0, 0x7F, 0xCB, 0xF0, 0x07, 0xFF, 0xFF, 0xD3, 0xFC, 0x02, 0xFF,
-    0xFF, 0xD0, 0xFF, 0x00, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x3F, 0xF4,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xAB, 0xD0, 0x3F, 0xFF, 0xEF, 0xFF, 0xF4, 0x02, 0xFF, 0xD1, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFA, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x01, 0xFE, 0x0B, 0xF8, 0x01,
-    0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF8, 0x0F, 0xF4, 0x07,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x0F,
-    0xE0, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0x40, 0x2F, 0xC0, 0x7F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F,
-    0x80, 0x2F, 0xE0, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0B, 0xD0, 0x0F, 0xDF,
-    0xF0, 0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xEA, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0x40, 0x7F, 0x82, 0xFE, 0x01, 0xFD, 0x03, 0xFC, 0x0B, 0xF0, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x3F, 0x80, 0xFE, 0x03, 0xFD, 0x07, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFC, 0x7F, 0x40, 0x0F, 0xE0, 0xFF, 0x00, 0x7F, 0x42, 0xFD, 0x02, 0xFC, 0x07, 0xF8,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0x80, 0x2F, 0xE0, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x68, 0x2F, 0x40, 0x3F, 0x7F, 0xC0, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xA8, 0x02,
-    0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x2F, 0x80,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0x82, 0xFE, 0x00, 0x1F, 0xD0,
-    0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0xFE, 0x03, 0xFD, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00,
-    0xFE, 0x0F, 0xF0, 0x00, 0x7F, 0x42, 0xFD, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x03, 0xF8, 0x02, 0xFE, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x81, 0xFC,
-    0x00, 0xBD, 0x7F, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0,
-    0xBD, 0x00, 0x3F, 0x7F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFA, 0x80, 0x0B, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xD0, 0x64, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x64, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFC, 0x03, 0xF8, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x40, 0x0B, 0xF0, 0x2F, 0xAF,
-    0xFC, 0x0B, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xF4, 0xFC, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xD0, 0x64, 0x07,
-    0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x1F, 0xD0, 0x64, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xE2,
-    0xF4, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFC, 0x03, 0xF8, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF,
-    0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x40, 0x0B, 0xF0, 0x2F, 0xAF, 0xFC, 0x0B, 0xFF,
-    0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4,
-    0x00, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFC, 0x03, 0xFD, 0x06, 0x40, 0x7F, 0x80, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFD, 0x06, 0x40, 0x3F,
-    0xD0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xE0, 0x14, 0x1F, 0xE0, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x40,
-    0x0B, 0xF0, 0xBE, 0xBF, 0xF0, 0xBF, 0xFF, 0xC0, 0x7F, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x01, 0xFC, 0xFD, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xF4, 0x19, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x64, 0x03, 0xFD, 0x02, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x0B, 0xE0, 0x0F, 0xCF, 0xE0, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0x03, 0xF8, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x40,
-    0x0B, 0xF0, 0x2F, 0xAF, 0xFC, 0x0B, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x05, 0x5F, 0xF5, 0x50, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x0F, 0x80, 0x02,
-    0xF4, 0x00, 0xBF, 0xE9, 0x7F, 0xFF, 0xDB, 0xFF, 0xFD, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xC0,
-    0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x0B, 0xF4, 0x00, 0xBF, 0xED, 0x07,
-    0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x0F, 0xFE,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF8, 0x00, 0xFC, 0xFE, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0x85, 0x5F, 0xF5, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x06,
-    0x4F, 0xC0, 0x03, 0xE3, 0xD0, 0x02, 0xF4, 0x00, 0x02, 0xFF, 0xA4, 0x07, 0xFF, 0xFD, 0x02, 0xFF,
-    0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0xED, 0x00, 0x1F,
-    0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFE, 0x05, 0x5F, 0xF5, 0x50, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x01, 0x6F, 0xD5, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0xBF, 0xE9, 0x1F, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x3F, 0x80,
-    0x01, 0xFD, 0x00, 0x2B, 0xFA, 0x41, 0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x1F, 0xD0,
-    0x00, 0xBF, 0x40, 0x02, 0xFF, 0xB4, 0x07, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x1E, 0x00, 0x02, 0xFF, 0xEF, 0x00, 0x00, 0xFB, 0xFF, 0x80, 0x00, 0x74, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xE0, 0x03,
-    0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0x80,
-    0x0B, 0xF0, 0x1F, 0xE0, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0xFF,
-    0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x0B, 0xF0, 0x1F, 0xE0, 0x03, 0xFC, 0x07, 0xF8, 0x01, 0xFE, 0x00,
-    0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xE0, 0x0B, 0xFF, 0xBD, 0x00, 0xFB, 0xFF, 0xC0,
-    0x1D, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xA9, 0x0F, 0xE0, 0x0F, 0xD1, 0xFD, 0x01,
-    0xFC, 0x1F, 0xC0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x07, 0xF4, 0x7F,
-    0x40, 0xBF, 0x07, 0xF0, 0x0F, 0xF0, 0xBF, 0x01, 0xFE, 0x0B, 0xF0, 0x3F, 0xE0, 0xBF, 0xFF, 0xFD,
-    0x03, 0xFF, 0xDF, 0xC0, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA0, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F,
-    0x40, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x0F, 0xF0, 0x1F, 0xD0, 0x03, 0xFC, 0x0B, 0xF0, 0x00,
-    0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x2F, 0xD0,
-    0x03, 0xF8, 0x0B, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F, 0xC0, 0x7F,
-    0x80, 0x0F, 0xF0, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90, 0xFE,
-    0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xF8,
-    0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B, 0xF0, 0x1F, 0xE0, 0xBF, 0x03,
-    0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xBF, 0xBF, 0x40, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0,
-    0x02, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x0F, 0xE0, 0x3F,
-    0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0x80,
-    0xBF, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF,
-    0x01, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x7C, 0x00, 0xBF, 0xBF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xA0, 0x0A, 0x90, 0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0,
-    0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B,
-    0xF0, 0x1F, 0xE0, 0xBF, 0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2D,
-    0x2D, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x3F, 0xC0,
-    0x7F, 0x40, 0x0F, 0xF0, 0x2F, 0xC0, 0x03, 0xF8, 0x0F, 0xF0, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0xBF,
-    0x01, 0xFE, 0x00, 0x3F, 0xC0, 0xBF, 0x40, 0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF8, 0x0F, 0xF0, 0x01,
-    0xFD, 0x03, 0xF8, 0x00, 0xBF, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x1F, 0xE0, 0x0F, 0xF4,
-    0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2D, 0x2D, 0x00, 0x02,
-    0xD2, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xA9,
-    0x0F, 0xE0, 0x0F, 0xD1, 0xFD, 0x01, 0xFC, 0x1F, 0xC0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0,
-    0x3F, 0x83, 0xF8, 0x07, 0xF4, 0x7F, 0x40, 0xBF, 0x07, 0xF0, 0x0F, 0xF0, 0xBF, 0x01, 0xFE, 0x0B,
-    0xF0, 0x3F, 0xE0, 0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xDF, 0xC0, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00,
-    0x3F, 0x0B, 0xD0, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F,
-    0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x0B, 0xF0,
-    0x00, 0xFE, 0x00, 0xFF, 0x00, 0x1F, 0xD0, 0x0F, 0xE0, 0x02, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x07, 0xF4, 0x03, 0xF8, 0x00,
-    0xBF, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x2F,
-    0x4B, 0xD0, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90, 0x0F, 0xE0,
-    0x0F, 0xD0, 0x1F, 0xD0, 0x1F, 0xC0, 0x1F, 0xC0, 0x2F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x40, 0x7F, 0x40, 0xBF, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0xBF, 0x01,
-    0xFE, 0x00, 0xBF, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFD, 0xFC, 0x00, 0x1F, 0xF4,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x2F, 0xC0, 0x3F,
-    0x80, 0x0F, 0xF0, 0x1F, 0xD0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40,
-    0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x2F, 0xD0, 0x03, 0xF8, 0x0B, 0xF0, 0x01, 0xFE,
-    0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x1F, 0xE0, 0x07,
-    0xF8, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0xBE, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xA0, 0x0A, 0x90, 0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F,
-    0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF,
-    0x0B, 0xF0, 0x1F, 0xE0, 0xBF, 0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF,
-    0x4F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF5, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01,
-    0xFC, 0x00, 0x3F, 0x6F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC, 0xBF, 0x00, 0x7F, 0xC0, 0x0F, 0xE2, 0xFC,
-    0x02, 0xFF, 0x00, 0x7F, 0x0B, 0xF0, 0x0F, 0xFC, 0x03, 0xFC, 0x2F, 0xC0, 0xBF, 0xF0, 0x1F, 0xD0,
-    0xBF, 0x03, 0xFB, 0xC0, 0xBF, 0x02, 0xFC, 0x2F, 0xAF, 0x43, 0xF4, 0x07, 0xF0, 0xFC, 0xBD, 0x2F,
-    0xC0, 0x1F, 0xC7, 0xE2, 0xF4, 0xFE, 0x00, 0x7F, 0x3F, 0x4B, 0xD7, 0xF0, 0x01, 0xFD, 0xFC, 0x2F,
-    0x7F, 0x80, 0x07, 0xFB, 0xD0, 0xBD, 0xFC, 0x00, 0x1F, 0xFF, 0x02, 0xFB, 0xF0, 0x00, 0x7F, 0xF4,
-    0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x0F,
-    0xF0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x00, 0xAA, 0x00, 0xAA, 0x7F, 0x01, 0xFF, 0x01, 0xFD, 0x7F, 0x03, 0xFF,
-    0x02, 0xFC, 0x7F, 0x07, 0xFF, 0x03, 0xF4, 0x7F, 0x0B, 0xEF, 0x0B, 0xF0, 0x3F, 0x0F, 0xAF, 0x0F,
-    0xE0, 0x3F, 0x2F, 0x6F, 0x1F, 0xC0, 0x3F, 0x3F, 0x2F, 0x3F, 0x80, 0x3F, 0x7D, 0x2F, 0x7F, 0x00,
-    0x3F, 0xBC, 0x2F, 0xBE, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xBE, 0x1F, 0x80, 0x07, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0xFF, 0x1F, 0xD0, 0x0B, 0xF4, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x02, 0xFC,
-    0x2F, 0xD0, 0x07, 0xF4, 0xFE, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0xF8,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x0A,
-    0xA0, 0x0B, 0xF0, 0x07, 0xF8, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x01, 0xFE, 0x00, 0x0F, 0xD0,
-    0xBF, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B,
-    0xEB, 0xF0, 0x00, 0x01, 0xFB, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x2D, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x14, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC7, 0xF4, 0x02, 0xFD, 0x0F, 0xE0, 0x1F, 0xF0,
-    0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x0B, 0xF4, 0x01, 0xFD, 0x3F, 0x80, 0x03, 0xF7, 0xFC, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x5F,
-    0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0xAA, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x5F, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA8, 0x07, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xE0, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x1F, 0x80, 0x00, 0x3F, 0x6F, 0x80, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x57, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0xC0, 0x02, 0xF6,
-    0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA8,
-    0x00, 0x7F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0xBD, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x0F,
-    0xE0, 0x3F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFD, 0x03, 0xF4, 0xFC,
-    0x3E, 0x00, 0xF4, 0x0F, 0x80, 0xF0, 0xFF, 0xFF, 0xCB, 0xEF, 0xFD, 0x3C, 0x0B, 0xD0, 0x1A, 0xAA,
-    0x8F, 0xFF, 0xE3, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x5A, 0xAA, 0xA8,
-    0x00, 0x00, 0x03, 0xD0, 0x2E, 0x3F, 0xAF, 0xC1, 0xFF, 0xF8, 0x06, 0xF9, 0x00, 0x00, 0x0F, 0xCF,
-    0xF7, 0xFC, 0x28, 0x00, 0x28, 0x1E, 0x3F, 0x4F, 0xCF, 0xD3, 0xF0, 0x50, 0x50, 0x2A, 0x47, 0xFE,
-    0x17, 0xF0, 0x3E, 0x2F, 0xC3, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0xFF, 0xCB, 0x47, 0x6D, 0x2D, 0x3F,
-    0xF0, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xFE, 0x0F, 0xD3, 0xF4, 0x2F, 0x4B, 0xD0, 0x78,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC1, 0xF9, 0xFC, 0x03, 0xFF, 0xC0, 0x07, 0xFC, 0x00,
-    0x05, 0x07, 0xC2, 0xF0, 0xF8, 0x3D, 0x1F, 0x47, 0xC1, 0xA0, 0x04, 0x05, 0x0F, 0x8B, 0xC3, 0xD3,
-    0xE1, 0xF0, 0xF4, 0xBC, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x01, 0xFC, 0xBD,
-    0x02, 0xF0, 0xFC, 0x02, 0xD0, 0xF0, 0x00, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x13, 0xCA, 0x5E, 0xB8,
-    0x1F, 0x0F, 0xFF, 0x40, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xFF, 0xC3, 0xE5, 0xBD,
-    0x78, 0x03, 0xD0, 0x01, 0xF4, 0x0F, 0xC0, 0x7F, 0x03, 0xF4, 0x2F, 0xC0, 0xFE, 0x01, 0x50, 0x00,
-    0x03, 0xF4, 0x1F, 0xC0, 0xFE, 0x03, 0xF0, 0x2F, 0x80, 0xFC, 0x01, 0x40, 0x00, 0xFD, 0xFD, 0xFD,
-    0xBD, 0x7D, 0x3D, 0x14, 0x03, 0xF4, 0x1F, 0xC0, 0xFE, 0x03, 0xF0, 0x2F, 0x80, 0xFC, 0x01, 0x40,
-    0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x40, 0xFC, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x2F,
-    0xC0, 0x3E, 0x00, 0x00, 0x40, 0x0E, 0x2B, 0xD3, 0xFC, 0x03, 0xC0, 0x14, 0x04, 0x03, 0xC0, 0x3E,
-    0x87, 0xFC, 0xB0, 0x05, 0x00, 0xBF, 0xFE, 0x6A, 0xAD, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x38, 0x00,
-    0x34, 0x00, 0x70, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x07, 0xF4, 0x3F, 0xE0, 0x7F, 0x40, 0x54,
-    0x00, 0x01, 0x07, 0xC3, 0xD0, 0xE0, 0x3D, 0x07, 0x40, 0x00, 0x01, 0xC0, 0x0B, 0x00, 0x7D, 0x0F,
-    0xFD, 0x00, 0x00, 0x3F, 0xE6, 0xFA, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x70, 0x6F, 0x9B,
-    0xFE, 0x0E, 0x00, 0x90, 0x15, 0x50, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0xFC, 0x00, 0xFC,
-    0x01, 0xFC, 0x02, 0xF8, 0x2F, 0xF0, 0x3F, 0xE0, 0x3F, 0x80, 0x15, 0x03, 0xF0, 0x7F, 0x07, 0xE0,
-    0xBE, 0x0B, 0xFE, 0x3F, 0xE0, 0xA9, 0x05, 0x0F, 0xE7, 0xF8, 0xFD, 0x04, 0x00, 0x1E, 0x0B, 0x4F,
-    0xC7, 0xF3, 0xF1, 0xF8, 0x50, 0x14, 0x0B, 0xE0, 0xFF, 0xE3, 0xC3, 0xCF, 0x0F, 0x2F, 0xF8, 0x2F,
-    0x40, 0x05, 0x41, 0xFC, 0x3F, 0x43, 0xE0, 0x64, 0x00, 0x0B, 0x80, 0x7F, 0x40, 0x3F, 0x00, 0xFC,
-    0xBF, 0xE2, 0xFE, 0x00, 0x0B, 0xC2, 0xF0, 0x7D, 0x07, 0xE4, 0x7F, 0xD2, 0xFC, 0x00, 0x00, 0x05,
-    0x0B, 0xC3, 0xE0, 0xF4, 0x3D, 0x1F, 0x0B, 0xC2, 0x90, 0x3F, 0xFF, 0xE7, 0xEA, 0xBE, 0xB0, 0x01,
-    0xDF, 0x00, 0x2C, 0x50, 0x01, 0x40, 0x10, 0x10, 0x1B, 0x0F, 0x0F, 0x3F, 0xFF, 0xC0, 0x50, 0x50,
-    0x00, 0x00, 0x00, 0xF8, 0x0F, 0xC2, 0xF9, 0xFC, 0x03, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFD, 0x07, 0xF0, 0xFC, 0x3E, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xD0,
-    0x3E, 0x3F, 0xAF, 0xC1, 0xFF, 0xF8, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xFF,
-    0xC3, 0xE5, 0xBD, 0x78, 0x03, 0xD0, 0x07, 0xE0, 0x3C, 0x1F, 0xFE, 0xF8, 0x3E, 0xBF, 0xF0, 0x38,
-    0x0B, 0x80, 0x1A, 0xAA, 0x8F, 0xFF, 0xE3, 0xFF, 0xF4, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x05,
-    0x55, 0x55, 0x03, 0xFF, 0xFF, 0xC0, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x0A,
-    0xAA, 0xAA, 0x00, 0x07, 0xE0, 0x3C, 0x1F, 0xFE, 0xF8, 0x3F, 0xBF, 0xF0, 0x3C, 0x0B, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x9A, 0xAA, 0xA8, 0x15, 0x55, 0x55, 0x55, 0x54, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x2F, 0xF4, 0x03, 0xF8, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x2F, 0x0F, 0x2E, 0xB8, 0x00, 0x34, 0x00, 0xA3,
-    0x40, 0x0E, 0x74, 0x00, 0xDB, 0xFF, 0xFC, 0x55, 0x55, 0x40, 0x05, 0x55, 0x43, 0xFF, 0xFE, 0x34,
-    0x00, 0xD7, 0x00, 0x1C, 0xBA, 0xAB, 0xCA, 0xAA, 0xA8, 0x01, 0x41, 0x42, 0xFF, 0xFE, 0x70, 0xB0,
-    0xB5, 0x01, 0x01, 0x00, 0x00, 0xB2, 0xC1, 0xFD, 0x03, 0xE0, 0x7A, 0xD0, 0x41, 0x00, 0x00, 0x90,
-    0x7D, 0x0F, 0x00, 0xF0, 0x07, 0x40, 0x38, 0x2F, 0x02, 0x40, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFC,
-    0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0xAA, 0xAA, 0xA0, 0x00, 0x0B, 0xF0, 0x3F,
-    0x80, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0xD1, 0xFD, 0x0F, 0xD0, 0xBC, 0x00, 0x07, 0xE0, 0x3C,
-    0x1F, 0xFE, 0xF8, 0x3F, 0xBF, 0xF0, 0x3C, 0x0B, 0x80, 0x14, 0x2F, 0xC6, 0xF4, 0x3C, 0x1D, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x02, 0xD1, 0xFE, 0x28, 0x7F, 0x2F, 0xCF, 0xDB, 0xE3, 0xF0, 0xFC, 0x14,
-    0x7C, 0x01, 0x00, 0x05, 0x02, 0xF4, 0x3F, 0x43, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFE, 0x3D, 0x55, 0x6D, 0x38, 0x00, 0x2C, 0x34, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54,
-    0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0xAA, 0xAA, 0xA0, 0x04,
-    0x04, 0x3D, 0x3E, 0x7C, 0x3D, 0xBC, 0x7C, 0xFC, 0x7C, 0x00, 0x00, 0x1A, 0x93, 0xFD, 0x01, 0xD0,
-    0x2C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x12, 0x85, 0x1F, 0xF4, 0xD3, 0xEF, 0xFC, 0x72, 0xDE, 0x00,
-    0x14, 0x00, 0x00, 0x14, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x55, 0x04, 0x0F, 0xF0, 0xF0,
-    0xB7, 0xFF, 0x43, 0x41, 0xB4, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x01, 0x40,
-    0x20, 0x2F, 0xF7, 0xC1, 0xD7, 0xFC, 0x01, 0x01, 0x40, 0x0F, 0xD1, 0xD0, 0xFF, 0xFE, 0x03, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0x1F, 0xAF, 0x83, 0xFF, 0xFC, 0x0A, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x87, 0xF4, 0xB0, 0x3C, 0x0E, 0x00, 0xFF, 0x03, 0xFC, 0x0F, 0xFE, 0x90, 0x1A,
-    0x40, 0x6B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x5A, 0x50, 0x07, 0x00, 0x15, 0x05, 0x40, 0x00,
-    0x06, 0x00, 0x09, 0x00, 0x01, 0x40, 0x00, 0x14, 0x0D, 0x14, 0x00, 0x01, 0x47, 0xD2, 0x00, 0x00,
-    0x08, 0x7D, 0x20, 0x00, 0x00, 0x87, 0xD0, 0x00, 0x00, 0x04, 0x70, 0x28, 0x00, 0x01, 0x80, 0x00,
-    0x50, 0x00, 0x50, 0x00, 0x05, 0x40, 0x15, 0x00, 0xD0, 0x09, 0xA6, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x07, 0xE5, 0x01, 0x54, 0x05, 0xBF, 0xF0, 0x3F, 0xC0, 0xFF, 0x80, 0x2E, 0x41, 0xF1, 0xFC, 0xE0,
-    0x00, 0x00, 0x05, 0x3E, 0x78, 0xB4, 0xBC, 0x3C, 0x00, 0x00, 0x14, 0x00, 0x7F, 0xF4, 0x1F, 0xEF,
-    0xC3, 0xD0, 0x2D, 0x38, 0xF9, 0xD0, 0x1F, 0x80, 0x00, 0xB0, 0x00, 0x00, 0x1C, 0xD7, 0xF4, 0xFC,
-    0xBB, 0x84, 0x40, 0x02, 0x5F, 0xCB, 0x81, 0xBC, 0x02, 0x40, 0x34, 0x0B, 0xE0, 0x7C, 0xBE, 0x34,
-    0x00, 0xD0, 0x0A, 0x07, 0xE0, 0xF4, 0x0F, 0x5F, 0x87, 0xE3, 0x9C, 0xD0, 0x70, 0xD0, 0x00, 0x0B,
-    0x81, 0xF0, 0x3C, 0x2F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xF3, 0xFC, 0x28, 0x00, 0x00, 0x00,
-    0xB0, 0x3B, 0xD2, 0xF9, 0x2F, 0xC1, 0x98, 0x00, 0x01, 0x03, 0xFE, 0xFD, 0x70, 0xF0, 0xBA, 0x0B,
-    0x07, 0x75, 0xF5, 0xE2, 0xF9, 0xF8, 0x20, 0x1C, 0x0B, 0xF9, 0x5D, 0x03, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xFA, 0x5A, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x80, 0x00, 0x07,
-    0xF4, 0x0F, 0xFE, 0x56, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xA0, 0x00,
-    0x2A, 0xAA, 0xAA, 0xA3, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xD0, 0x2A, 0xAA, 0xAA, 0xA3, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xA4, 0x00, 0x0F, 0x03, 0xFF, 0xFF, 0xFE, 0xAF,
-    0x83, 0xF9, 0xAF, 0xFF, 0xFF, 0x80, 0xE0, 0x00, 0x06, 0xBE, 0x40, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x1B, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x02, 0xAA, 0xAA, 0xAA, 0xAF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3E, 0xD3, 0xDB, 0x1D, 0x2C,
-    0x74, 0xF1, 0xFF, 0x81, 0x88, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xD7, 0x4F, 0xB8, 0x39, 0x00, 0xFA,
-    0x40, 0x64, 0x00, 0x00, 0x01, 0xD0, 0x10, 0x3C, 0x0E, 0x07, 0x42, 0xC0, 0xF0, 0x14, 0x00, 0x00,
-    0x00, 0x3F, 0x43, 0xCB, 0x1D, 0x2C, 0x74, 0xF0, 0xFB, 0x40, 0xA0, 0x00, 0x2C, 0x34, 0xF1, 0xD3,
-    0x8B, 0x1D, 0x3C, 0x7F, 0xE0, 0x61, 0x00, 0x00, 0x01, 0xFC, 0x78, 0x4B, 0x00, 0xF0, 0x0B, 0xA4,
-    0x19, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x38, 0x0F, 0xB4, 0x3C, 0xB0, 0x74, 0xB0, 0x74, 0xF0,
-    0x7F, 0xE0, 0x18, 0x40, 0x00, 0x00, 0x38, 0x01, 0xD0, 0x0B, 0xBC, 0x3D, 0xB0, 0xE2, 0xC7, 0x4F,
-    0x2C, 0x38, 0x50, 0x80, 0x00, 0x00, 0x01, 0xDF, 0x7E, 0x2E, 0x7C, 0xF3, 0xC7, 0x4F, 0x38, 0xB0,
-    0xE3, 0x4F, 0x1D, 0x20, 0x51, 0x80, 0x00, 0x02, 0xEC, 0x3E, 0x43, 0x80, 0x74, 0x0B, 0x00, 0x50,
-    0x00, 0x00, 0x03, 0x83, 0xFC, 0xB0, 0x3C, 0x0E, 0x03, 0xE0, 0x64, 0xE0, 0xEB, 0x2C, 0xB3, 0x47,
-    0xB0, 0x7C, 0x02, 0x40, 0x0B, 0x1E, 0x03, 0xB8, 0x02, 0xE0, 0x07, 0xF0, 0x1E, 0x74, 0x14, 0x24,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xF0, 0x07, 0xF9, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x54, 0x00,
-    0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F,
-    0x1F, 0x40, 0x01, 0xFC, 0xFD, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9, 0x55, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x7F,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x54, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFC, 0x15,
-    0x7F, 0xD5, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0x81, 0xFF, 0x41, 0xFD, 0x00,
-    0xFE, 0x0B, 0xF0, 0x03, 0xF8, 0x3F, 0xC0, 0x1F, 0xE0, 0xFE, 0x00, 0xFF, 0x47, 0xF4, 0xFF, 0xFC,
-    0x2F, 0xC3, 0xFF, 0xC0, 0xBF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9,
-    0x55, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x00, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xEA, 0xA8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xAA, 0xA4, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFC, 0x03, 0xFD, 0x06, 0x40, 0x7F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x06, 0x40, 0x3F, 0xD0, 0xBF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F,
-    0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xE0, 0x07, 0xF4,
-    0x02, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xD0, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0x3F, 0x80, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xD0, 0x2F, 0xAF, 0x80, 0xBC, 0xBC,
-    0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF4,
-    0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x02, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xFF,
-    0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xFF, 0x80,
-    0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xD5, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xFD, 0x01, 0xFE, 0x50, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x2F, 0xC0,
-    0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0x0F, 0xFB, 0xFF, 0x80, 0x07, 0xF4, 0x07, 0xF4, 0x0F, 0xF0,
-    0x02, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F,
-    0xC0, 0x3F, 0xC5, 0x7F, 0xC0, 0x0F, 0xE0, 0x7F, 0xD3, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0,
-    0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x3F, 0xC1,
-    0xFF, 0x03, 0xF8, 0x00, 0xFE, 0x02, 0xFD, 0x1F, 0xD0, 0x07, 0xF4, 0x0B, 0xF4, 0xBF, 0x40, 0x2F,
-    0xD0, 0x3F, 0xC2, 0xFC, 0x00, 0xBF, 0x02, 0xFF, 0x0F, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0x80,
-    0x0F, 0xFF, 0xFF, 0x41, 0xFD, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xFC, 0x15, 0x7F, 0xD5, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x3F, 0x81, 0xFF, 0x81, 0xFD, 0x01, 0xFE, 0x0B, 0xF0, 0x07, 0xF4, 0x3F, 0xC0, 0x1F, 0xD0, 0xFE,
-    0x00, 0xBF, 0x07, 0xF4, 0x03, 0xFC, 0x2F, 0xC0, 0x0F, 0xE0, 0xBF, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0F, 0xF0,
-    0x0B, 0xF8, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x02, 0xFC, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC2, 0xFD, 0x00, 0x03, 0xF8, 0x7F, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xF6, 0xFD, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x1F,
-    0xD0, 0xFF, 0x00, 0x01, 0xFD, 0x07, 0xF8, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC,
-    0x00, 0x3F, 0x80, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0xE0, 0x0F, 0xD0, 0x0B, 0xFE, 0x00, 0xFD,
-    0x01, 0xFF, 0xD0, 0x1F, 0xC0, 0x3F, 0xFC, 0x02, 0xFC, 0x0B, 0xFF, 0xC0, 0x3F, 0x80, 0xFE, 0xF8,
-    0x03, 0xF4, 0x3F, 0x7F, 0x80, 0x7F, 0x0B, 0xF3, 0xF4, 0x07, 0xF0, 0xFC, 0x7F, 0x00, 0xBF, 0x3F,
-    0x8B, 0xF0, 0x0F, 0xE7, 0xF0, 0xFE, 0x00, 0xFD, 0xFD, 0x0F, 0xD0, 0x1F, 0xFF, 0x80, 0xFD, 0x02,
-    0xFF, 0xF0, 0x1F, 0xC0, 0x3F, 0xFD, 0x02, 0xFC, 0x03, 0xFF, 0x80, 0x3F, 0x80, 0x3F, 0xF0, 0x03,
-    0xF4, 0x07, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x00, 0x54, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00,
-    0x0F, 0xD7, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x0B, 0xF4, 0x03, 0xF4, 0x00, 0xFF, 0x00, 0x3F,
-    0x80, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0xFD, 0x1F, 0xE0,
-    0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC,
-    0x00, 0xFE, 0x00, 0x3F, 0x80, 0x1F, 0xD0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xE0, 0x07, 0xF4, 0x01, 0xFD, 0x00,
-    0xBF, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xD0, 0x03,
-    0xF8, 0x02, 0xFD, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x0B, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-    0x00, 0xFE, 0x3F, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x1F, 0xC0, 0xFD,
-    0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x0B, 0xF9, 0x5F, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x2F, 0xC0,
-    0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0x00, 0x7F, 0x55, 0x50, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0x07, 0xFE,
-    0x03, 0xF8, 0x07, 0xF8, 0x1F, 0xD0, 0x1F, 0xE0, 0x7F, 0x00, 0xBF, 0x42, 0xFC, 0x0B, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFE, 0x5B, 0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02,
-    0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0x80, 0x0F, 0xF0, 0x6F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x1F,
-    0xD0, 0x0F, 0xF0, 0x2F, 0xC0, 0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F,
-    0x95, 0x50, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFE, 0x57, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x07,
-    0xF4, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0x3F,
-    0x80, 0x00, 0x3F, 0xC0, 0x1F, 0xD0, 0x00, 0x1F, 0xE0, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0xFC,
-    0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0xBF, 0x00, 0x00, 0x0B, 0xF0,
-    0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0xFF, 0x55, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0x80, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0xBF, 0x40, 0x00, 0xFE, 0x01,
-    0xFC, 0x07, 0xF8, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0x00, 0x03, 0xF4, 0x3F, 0x83, 0xFC,
-    0x00, 0x00, 0x0B, 0xF0, 0xFE, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xD7, 0xF5, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xEB, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0x4F, 0xF0, 0x00,
-    0x00, 0x3F, 0xD2, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0x2F, 0xF0,
-    0x3F, 0x80, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x07, 0xF0, 0x0B,
-    0xF8, 0x00, 0xFF, 0x80, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xAB, 0xFF, 0x80, 0x03, 0xFF, 0xD0, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x15, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xFC, 0x14, 0x00, 0x3F, 0xD0, 0xBF, 0xAF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0xE0, 0x0F, 0xD0, 0x0B, 0xFE, 0x00, 0xFD, 0x01,
-    0xFF, 0xD0, 0x1F, 0xC0, 0x3F, 0xFC, 0x02, 0xFC, 0x0B, 0xFF, 0xC0, 0x3F, 0x80, 0xFE, 0xF8, 0x03,
-    0xF4, 0x3F, 0x7F, 0x80, 0x7F, 0x0B, 0xF3, 0xF4, 0x07, 0xF0, 0xFC, 0x7F, 0x00, 0xBF, 0x3F, 0x8B,
-    0xF0, 0x0F, 0xE7, 0xF0, 0xFE, 0x00, 0xFD, 0xFD, 0x0F, 0xD0, 0x1F, 0xFF, 0x80, 0xFD, 0x02, 0xFF,
-    0xF0, 0x1F, 0xC0, 0x3F, 0xFD, 0x02, 0xFC, 0x03, 0xFF, 0x80, 0x3F, 0x80, 0x3F, 0xF0, 0x03, 0xF4,
-    0x07, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x02,
-    0xF9, 0xBF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x3F, 0xE0, 0x0F, 0xD0, 0x0B, 0xFE, 0x00, 0xFD, 0x01, 0xFF, 0xD0, 0x1F, 0xC0,
-    0x3F, 0xFC, 0x02, 0xFC, 0x0B, 0xFF, 0xC0, 0x3F, 0x80, 0xFE, 0xF8, 0x03, 0xF4, 0x3F, 0x7F, 0x80,
-    0x7F, 0x0B, 0xF3, 0xF4, 0x07, 0xF0, 0xFC, 0x7F, 0x00, 0xBF, 0x3F, 0x8B, 0xF0, 0x0F, 0xE7, 0xF0,
-    0xFE, 0x00, 0xFD, 0xFD, 0x0F, 0xD0, 0x1F, 0xFF, 0x80, 0xFD, 0x02, 0xFF, 0xF0, 0x1F, 0xC0, 0x3F,
-    0xFD, 0x02, 0xFC, 0x03, 0xFF, 0x80, 0x3F, 0x80, 0x3F, 0xF0, 0x03, 0xF4, 0x07, 0xFD, 0x00, 0x7F,
-    0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x1F,
-    0xD0, 0x3F, 0xC0, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x03, 0xF8, 0x7F, 0x80,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xF6,
-    0xFD, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x01, 0xFD, 0x07, 0xF8, 0x00,
-    0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x1F, 0xE0, 0x07, 0xF4, 0x00,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x01, 0xFD, 0x57, 0xFC, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x01,
-    0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0xFF, 0x00, 0x07, 0xF4, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00,
-    0x07, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0x3F, 0x80, 0xFF, 0xF0,
-    0x01, 0xFD, 0x03, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x7F,
-    0xF4, 0x00, 0xFF, 0xF4, 0x02, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x0F, 0xEF, 0x80, 0x3F, 0xBF, 0x00,
-    0x3F, 0x7E, 0x01, 0xFA, 0xF8, 0x00, 0xFC, 0xF8, 0x0F, 0xCF, 0xE0, 0x07, 0xF3, 0xF0, 0x7E, 0x3F,
-    0x40, 0x2F, 0x8F, 0xC3, 0xF1, 0xFC, 0x00, 0xFE, 0x3F, 0x1F, 0x8B, 0xF0, 0x03, 0xF4, 0xFC, 0xFC,
-    0x3F, 0x80, 0x1F, 0xC3, 0xF7, 0xE0, 0xFD, 0x00, 0x7F, 0x0F, 0xFF, 0x03, 0xF0, 0x02, 0xF8, 0x2F,
-    0xF8, 0x1F, 0xC0, 0x0F, 0xD0, 0xBF, 0xC0, 0xBF, 0x00, 0x3F, 0x02, 0xFE, 0x03, 0xF8, 0x01, 0xFC,
-    0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0xFE,
-    0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x07, 0xF4,
-    0x03, 0xF8, 0x00, 0xBF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xF5, 0x56, 0xFD, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x03, 0xFC, 0x02,
-    0xFD, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x0B,
-    0xF0, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x03, 0xFE, 0x03, 0xFD, 0x00, 0x3F, 0xC1,
-    0xFE, 0x00, 0x0B, 0xF4, 0xBF, 0x00, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x5F, 0xE0, 0x00, 0x2F,
-    0xD7, 0xF4, 0x00, 0x0B, 0xF2, 0xFD, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x01, 0xFE, 0x1F, 0xD0, 0x00,
-    0xBF, 0x47, 0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xE5, 0x5B, 0xF8, 0x02, 0xFC, 0x00,
-    0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xE0, 0x07,
-    0xF4, 0x01, 0xFE, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x3F,
-    0xC0, 0x1F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x0B, 0xF0, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0xF9, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x01, 0xFE, 0x5F, 0xF8, 0x02, 0xFC, 0x03, 0xFC,
-    0x03, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xFC, 0x03, 0xF8, 0x0B, 0xF8, 0x07, 0xFA, 0xBF, 0xF0,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0xFA, 0x90, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x00, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x85, 0x5F,
-    0xF5, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x0B, 0xF4, 0x03, 0xF4, 0x00, 0xFF,
-    0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0xFD,
-    0x1F, 0xE0, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x92, 0xFC, 0x7F, 0xF0, 0xBF, 0x40,
-    0xBE, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x40, 0x7F, 0x5F, 0xD0, 0x0F, 0xD0, 0x1F, 0xD7, 0xF4, 0x07,
-    0xF0, 0x0B, 0xF1, 0xFD, 0x02, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0xFE, 0x02, 0xFE, 0x0F, 0xFD, 0x3F,
-    0x47, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x3F,
-    0xD0, 0x00, 0x0F, 0xE0, 0xBF, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x0B, 0xF7, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xEF, 0xD0, 0x00, 0x00, 0x7F,
-    0x8F, 0xF0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x07, 0xF8, 0x00, 0x0B, 0xF8, 0x03,
-    0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x2F,
-    0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x1F, 0xD0, 0x07, 0xF4, 0x02, 0xFC,
-    0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xE0,
-    0x07, 0xF4, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00,
-    0x3F, 0xC0, 0x1F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF4, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0F,
-    0xD0, 0x03, 0xF8, 0x7F, 0x40, 0x0F, 0xE2, 0xFC, 0x00, 0x7F, 0x4F, 0xF0, 0x02, 0xFC, 0x3F, 0x80,
-    0x0F, 0xF1, 0xFD, 0x00, 0x3F, 0x87, 0xF4, 0x01, 0xFD, 0x2F, 0xD0, 0x0B, 0xF4, 0x7F, 0xE5, 0xBF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xAF, 0xAF, 0xD0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F, 0xE0,
-    0x0F, 0xE0, 0x0B, 0xF0, 0x07, 0xF4, 0x07, 0xF4, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0xFE,
-    0x00, 0xFF, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xC0, 0x0F, 0xE0, 0x0F,
-    0xE0, 0x0F, 0xF0, 0x07, 0xF4, 0x07, 0xF4, 0x03, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0xFE, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x3F, 0x80, 0x2F, 0xC0, 0x0F, 0xE0, 0x0F, 0xE0,
-    0x0F, 0xF0, 0x07, 0xF4, 0x07, 0xF4, 0x03, 0xF8, 0x02, 0xFC, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F,
-    0xD0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xF4, 0x03, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x01,
-    0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x2F, 0xC0, 0x1F, 0xD0,
-    0x0F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xF4, 0x03, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0xFD,
-    0x00, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F,
-    0xD0, 0x0F, 0xE0, 0x0B, 0xF0, 0x07, 0xF0, 0x03, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x02, 0xFD, 0x01,
-    0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x7F, 0xFF,
-    0x80, 0x02, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x15, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE5, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFA, 0xFF, 0xC0, 0x3F, 0x80, 0xFF, 0x41, 0xFD, 0x02, 0xFD, 0x0B, 0xF0, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x3F, 0xC0, 0xFE, 0x07, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xE0,
-    0x00, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xD4, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xE0,
-    0x07, 0xFF, 0xFF, 0x80, 0x7F, 0x40, 0x2F, 0xEB, 0xFF, 0x02, 0xFD, 0x00, 0xFF, 0x02, 0xFE, 0x0F,
-    0xF0, 0x03, 0xF8, 0x07, 0xF8, 0x3F, 0xC0, 0x1F, 0xD0, 0x1F, 0xD0, 0xFE, 0x00, 0x7F, 0x40, 0xFF,
-    0x47, 0xF4, 0x02, 0xFC, 0x0B, 0xFC, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFD, 0x03, 0xFC, 0x01, 0xFF, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xD5, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x2F, 0xEB, 0xFF, 0x40,
-    0xFF, 0x02, 0xFE, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0xD0, 0x0F, 0xE0, 0x7F, 0x40, 0xBF, 0x42, 0xFC,
-    0x0B, 0xFC, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x01, 0x90,
-    0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x6A,
-    0xAB, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xAA, 0xAF, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x60, 0x01, 0xFF, 0x80, 0x7F, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0xFF,
-    0x00, 0x03, 0xF8, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFD, 0x03, 0xFE, 0x07, 0xFE, 0x00, 0xBF, 0x02,
-    0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0xBF, 0x40, 0x02, 0xFC,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0xFF, 0xF8,
-    0x00, 0x0F, 0xF0, 0x3F, 0xD6, 0xFE, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x7F, 0x80, 0x02, 0xFD, 0x07,
-    0xF4, 0x1F, 0xE0, 0x00, 0xFF, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0xBF, 0x00, 0xBF, 0x80,
-    0xBF, 0xC0, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x07, 0xF4,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0x42, 0xFC, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x03, 0xFC, 0x07, 0xF4, 0x00,
-    0x1F, 0xFA, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x6F,
-    0xD0, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0x0B, 0xF8, 0x3F, 0xC0, 0x02, 0xFF, 0x03, 0xFC, 0x00, 0x7F,
-    0xC0, 0x3F, 0x80, 0x0F, 0xF4, 0x07, 0xF4, 0x03, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0x81, 0xA0,
-    0x07, 0xFF, 0xDF, 0xC0, 0x3F, 0xFF, 0xFE, 0x03, 0xFE, 0x1F, 0xF8, 0x1F, 0xE0, 0x2F, 0xD0, 0xBF,
-    0x00, 0xBF, 0x03, 0xFC, 0x02, 0xFC, 0x0F, 0xE0, 0x0B, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFE, 0x01,
-    0xFD, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xBE, 0x00, 0x2F, 0xF5, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBC, 0x00, 0x1B, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFC, 0x02, 0xFF, 0xE9, 0x40, 0x7F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFC, 0x2A,
-    0x00, 0x3F, 0xAF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x7F, 0xE0, 0xFF, 0x0B, 0xF8, 0x0B, 0xF0, 0xFF,
-    0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xE0, 0xBF, 0x02, 0xFC,
-    0x07, 0xFE, 0xFF, 0x80, 0x2F, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF8, 0x00, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0x42, 0xFC, 0x1F, 0xE0, 0x2F,
-    0xC2, 0xFD, 0x5B, 0xF8, 0x3F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0x81, 0xFF, 0x03, 0xF8,
-    0x07, 0xF4, 0x3F, 0xC0, 0x7F, 0x42, 0xFE, 0x5F, 0xF0, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF0, 0x01, 0x02,
-    0xFD, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xC0, 0x1B, 0xFF, 0xD0, 0x2F, 0xFF, 0x80, 0x1F, 0xFD,
-    0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x40, 0xBF, 0x9B, 0xE0, 0x0F, 0xFF, 0xF8, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x06, 0xE4,
-    0xFF, 0x02, 0xFF, 0xEB, 0xF0, 0xBF, 0xFF, 0xFF, 0x1F, 0xF4, 0x3F, 0xF2, 0xFD, 0x01, 0xFE, 0x3F,
-    0xC0, 0x1F, 0xE3, 0xF8, 0x02, 0xFD, 0x3F, 0x80, 0x3F, 0xC3, 0xF8, 0x07, 0xF8, 0x3F, 0xC0, 0xFF,
-    0x02, 0xFF, 0xBF, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x2F, 0xD0, 0xFF, 0x0F, 0xE0, 0x3F, 0x8B,
-    0xF4, 0x2F, 0xD3, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xD0, 0x3F, 0xE9, 0x40, 0x0F, 0xE0, 0x00, 0x03,
-    0xFC, 0x00, 0x40, 0xBF, 0xEA, 0xF0, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x6A, 0x00, 0x2F, 0xC0, 0x3F, 0xF4, 0x0B, 0xF0, 0x2F, 0xFC, 0x03, 0xFF, 0xC0,
-    0xFE, 0x0B, 0xFF, 0x80, 0x02, 0xFD, 0x0F, 0xD0, 0xFF, 0x00, 0x00, 0x0F, 0xD1, 0xFD, 0x2F, 0xC0,
-    0x00, 0x00, 0xFE, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xEB, 0xFE, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x4B, 0xF0, 0xBF, 0x40, 0x01, 0xBF, 0xE0, 0xFF, 0x03, 0xFE, 0x80, 0x3F, 0xFC,
-    0x0F, 0xE0, 0x2F, 0xFC, 0x07, 0xFE, 0x00, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xBF, 0x90, 0x0F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFE, 0x01, 0x00, 0xFF, 0x00, 0x00,
-    0xFE, 0x00, 0x56, 0xFC, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x01, 0x5B, 0xF8, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xFC, 0xBE, 0xBF, 0xF8, 0xBF, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0A,
-    0x90, 0x0A, 0x90, 0xFE, 0x01, 0xFD, 0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F,
-    0x83, 0xF8, 0x03, 0xF4, 0x3F, 0x40, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0xBF, 0x00, 0xFF, 0x0F, 0xF0,
-    0x2F, 0xE0, 0xFF, 0x07, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x7F, 0xFC, 0xFC, 0x02, 0xFF, 0x4F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x0F, 0x80, 0xFC, 0x00, 0xFD, 0x2F, 0x80, 0x0B,
-    0xFF, 0xF0, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x0A, 0x90, 0xFE, 0x01, 0xFD,
-    0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF4, 0x3F, 0x40,
-    0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0xBF, 0x00, 0xFF, 0x0F, 0xF0, 0x2F, 0xE0, 0xFF, 0x07, 0xFD, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFC, 0xFC, 0x02, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8,
-    0x02, 0xA8, 0x03, 0xF8, 0x0F, 0xF0, 0x03, 0xF4, 0x3F, 0xD0, 0x07, 0xF0, 0xBF, 0x80, 0x0B, 0xF1,
-    0xFE, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x2F, 0xDF,
-    0xF0, 0x00, 0x2F, 0xC7, 0xF8, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x3F, 0x82, 0xFD, 0x00, 0x7F, 0x40,
-    0xFF, 0x00, 0xBF, 0x00, 0xBF, 0x40, 0x00, 0x1A, 0xAA, 0xAA, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0xFD,
-    0x03, 0xF8, 0x01, 0xFC, 0x07, 0xF4, 0x02, 0xFC, 0x0B, 0xF0, 0x03, 0xF8, 0x0B, 0xF0, 0x07, 0xF4,
-    0x0F, 0xE0, 0xBF, 0xF0, 0x0F, 0xE0, 0xBF, 0xD0, 0x1F, 0xD0, 0xBF, 0x40, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xAA, 0x00, 0x1A, 0xA8, 0x0F, 0xFD, 0x00, 0xFF, 0xF0, 0x7F, 0xF4, 0x07, 0xFF,
-    0x81, 0xFF, 0xD0, 0x3F, 0xFD, 0x0B, 0xFF, 0x81, 0xFF, 0xF0, 0x3F, 0xBE, 0x0F, 0xEF, 0xC0, 0xFD,
-    0xF8, 0x7E, 0xBE, 0x07, 0xF3, 0xE3, 0xF3, 0xF4, 0x2F, 0xCF, 0x9F, 0x8F, 0xD0, 0xBE, 0x3F, 0xFC,
-    0x7F, 0x03, 0xF4, 0xFF, 0xE2, 0xFC, 0x0F, 0xC3, 0xFF, 0x0F, 0xE0, 0x7F, 0x0F, 0xF8, 0x3F, 0x42,
-    0xFC, 0x3F, 0xC0, 0xFC, 0x00, 0x02, 0xA8, 0x02, 0xA0, 0x0F, 0xE0, 0x2F, 0xC0, 0x7F, 0x40, 0xFF,
-    0x02, 0xFC, 0x03, 0xFC, 0x0B, 0xF0, 0x0F, 0xE0, 0x3F, 0xD5, 0xBF, 0x40, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xD5, 0x7F, 0x80, 0xFF, 0x01, 0xFD, 0x03, 0xFC, 0x07, 0xF4, 0x0F, 0xE0,
-    0x2F, 0xC0, 0x7F, 0x40, 0xFF, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x0F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0x83, 0xFC, 0x1F, 0xE0, 0x2F, 0xD2, 0xFD, 0x01, 0xFD, 0x3F,
-    0xC0, 0x1F, 0xD3, 0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x3F, 0xC3, 0xF8, 0x07, 0xF8, 0x3F, 0xC0, 0xFF,
-    0x02, 0xFF, 0xBF, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA0, 0xBE, 0x00, 0x3F, 0x3F, 0xFC, 0x07, 0xFF, 0xFF, 0xD0, 0x7F, 0xE1, 0xFE, 0x0B, 0xF8, 0x0F,
-    0xE0, 0xFF, 0x00, 0xFE, 0x0F, 0xE0, 0x1F, 0xD1, 0xFD, 0x02, 0xFC, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC,
-    0x03, 0xF8, 0x3F, 0x80, 0x3F, 0x83, 0xF8, 0x07, 0xF4, 0x7F, 0x40, 0xBF, 0x0B, 0xF0, 0x0F, 0xF0,
-    0x00, 0x68, 0x2F, 0x80, 0x00, 0xFC, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x47, 0xFC,
-    0x02, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xF8, 0x03, 0xFC, 0x03, 0xF4, 0x03, 0xFC,
-    0x07, 0xF4, 0x03, 0xF8, 0x0B, 0xF4, 0x0B, 0xF4, 0x0F, 0xF8, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xEF, 0xFF, 0x40, 0x1F, 0xCB, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFD, 0x0F, 0xF8, 0x08, 0x1F, 0xE0, 0x00, 0x2F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0,
-    0x10, 0x2F, 0xFB, 0xF0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xA0, 0xBE,
-    0x01, 0xBD, 0x00, 0x3F, 0x3F, 0xFC, 0x7F, 0xF8, 0x07, 0xFF, 0xFF, 0xEF, 0xFF, 0xC0, 0x7F, 0xE2,
-    0xFF, 0xD3, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x2F, 0xC0, 0xFF, 0x01, 0xFE, 0x02, 0xFC, 0x0F, 0xE0,
-    0x1F, 0xD0, 0x3F, 0xC1, 0xFD, 0x02, 0xFC, 0x03, 0xF8, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0x42, 0xFC,
-    0x03, 0xF8, 0x07, 0xF0, 0x3F, 0x80, 0x7F, 0x40, 0xBF, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xF0, 0x7F,
-    0x40, 0xBF, 0x00, 0xFE, 0x0B, 0xF0, 0x0F, 0xF0, 0x1F, 0xD0, 0x01, 0xA8, 0x00, 0x6A, 0x00, 0x7F,
-    0x40, 0x3F, 0xC0, 0x1F, 0xD0, 0x2F, 0xD0, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0xFE, 0x07, 0xF4, 0x00,
-    0x3F, 0x83, 0xFC, 0x00, 0x0B, 0xF1, 0xFD, 0x00, 0x02, 0xFC, 0xFE, 0x00, 0x00, 0x7F, 0x7F, 0x00,
-    0x00, 0x0F, 0xEF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x6B, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x0B, 0xF8, 0xBF, 0x7F, 0xC0, 0xFE, 0x0F, 0xE1, 0xFE, 0x2F, 0xC0, 0xFD, 0x0F,
-    0xE3, 0xFC, 0x1F, 0xC0, 0xFE, 0x3F, 0x82, 0xFC, 0x0F, 0xE3, 0xF8, 0x2F, 0x81, 0xFD, 0x3F, 0xC3,
-    0xF8, 0x3F, 0xC3, 0xFD, 0x3F, 0x4F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0xA9, 0x00, 0xAA, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x0B, 0xF4, 0xBF, 0x80, 0x00, 0xFE, 0x3F,
-    0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xDB, 0xF0, 0x00, 0x1F,
-    0xE1, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF4, 0x00, 0x0A, 0x90, 0x0A, 0x90,
-    0xFE, 0x01, 0xFD, 0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03,
-    0xF4, 0x3F, 0x40, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0xBF, 0x00, 0xFF, 0x0F, 0xF0, 0x2F, 0xE0, 0xFF,
-    0x07, 0xFE, 0x0B, 0xFF, 0xFF, 0xFC, 0x7F, 0xFD, 0xFF, 0xC2, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x50, 0x0A, 0x80, 0x1A, 0x82, 0xFC,
-    0x02, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF8, 0x3F, 0x80, 0xBF, 0x43, 0xF4, 0x0F, 0xF0,
-    0x3F, 0xC3, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xFE, 0xFD, 0x00, 0x7E, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x0A, 0x90, 0x0A, 0x80,
-    0x1A, 0x80, 0xFE, 0x02, 0xFC, 0x03, 0xFC, 0x1F, 0xD0, 0x2F, 0xC0, 0x3F, 0x82, 0xFC, 0x03, 0xF8,
-    0x07, 0xF4, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x3F, 0x40, 0xBF,
-    0x00, 0xFF, 0x07, 0xF4, 0x0F, 0xF0, 0x0F, 0xE0, 0xBF, 0x00, 0xFE, 0x02, 0xFD, 0x0B, 0xF0, 0x2F,
-    0xE0, 0x3F, 0xC0, 0xFF, 0x07, 0xFE, 0x0B, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFC,
-    0xBF, 0xF9, 0xF4, 0x02, 0xFF, 0x03, 0xFE, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x90, 0x0A, 0x80, 0x1A, 0x80, 0xFE, 0x02, 0xFC, 0x03, 0xFC, 0x1F, 0xD0, 0x2F, 0xC0, 0x3F, 0x82,
-    0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0,
-    0x3F, 0x40, 0xBF, 0x00, 0xFF, 0x07, 0xF4, 0x0F, 0xF0, 0x0F, 0xE0, 0xBF, 0x00, 0xFE, 0x02, 0xFD,
-    0x0B, 0xF0, 0x2F, 0xE0, 0x3F, 0xC0, 0xFF, 0x07, 0xFE, 0x0B, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x7F, 0xFC, 0xBF, 0xF9, 0xFF, 0x82, 0xFF, 0x03, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x1A, 0xAA, 0x40, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0xBF, 0xEB, 0xFD,
-    0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x0F, 0xE0, 0x3F, 0xC0, 0x7F, 0x40, 0xBF, 0x97, 0xFC, 0x00,
-    0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0xA9,
-    0x03, 0xF8, 0x00, 0x00, 0xFD, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x0F,
-    0xF0, 0x00, 0x03, 0xFC, 0x0F, 0xFF, 0xF4, 0x03, 0xF8, 0x0F, 0xFF, 0xFE, 0x07, 0xF4, 0x1F, 0xFA,
-    0xFF, 0x07, 0xF0, 0x2F, 0xC0, 0x7F, 0x4B, 0xF0, 0x3F, 0xC0, 0x7F, 0x4F, 0xF0, 0x3F, 0xC0, 0xBF,
-    0x0F, 0xE0, 0x2F, 0xE6, 0xFF, 0x1F, 0xD0, 0x0F, 0xFF, 0xFC, 0x2F, 0xC0, 0x03, 0xFF, 0xE0, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x7F, 0xEB, 0xFE,
-    0x2F, 0xC0, 0x3F, 0xCF, 0xF0, 0x0F, 0xE3, 0xFC, 0x03, 0xF8, 0xBF, 0x97, 0xFC, 0x0F, 0xFF, 0xFD,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF0,
-    0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x01,
-    0x5B, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xF0, 0x7A, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x01, 0xBF, 0x40, 0x03, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xF4,
-    0x3F, 0xFF, 0xF8, 0x07, 0xF0, 0x7F, 0x83, 0xFC, 0x0B, 0xF0, 0xFF, 0x01, 0xFD, 0x0F, 0xF6, 0xFE,
-    0x01, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xFD, 0x1F, 0xFF, 0xFC, 0x02, 0xFC, 0x2F, 0xE7, 0xFC, 0x03,
-    0xFC, 0x2F, 0xC2, 0xFC, 0x03, 0xF8, 0x3F, 0xC1, 0xFD, 0x0B, 0xF0, 0x3F, 0x80, 0xFF, 0xBF, 0xE0,
-    0x7F, 0x40, 0xBF, 0xFF, 0xC0, 0xBF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0xA9, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0x03, 0xFC, 0x01,
-    0xFD, 0x03, 0xF8, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0x4F, 0xE0, 0x01, 0xFE, 0x1F, 0xD0, 0x03, 0xFC, 0x2F, 0xC0, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x3F, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x03, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0x82, 0xFD, 0x0F, 0xF0, 0xFE, 0x03, 0xF8, 0xBF, 0x42, 0xFD, 0x3F, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFD, 0x03, 0xFE, 0x94, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x04, 0x0B, 0xFE,
-    0xAF, 0x00, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0A, 0x00,
-    0x0F, 0xCB, 0xE0, 0x07, 0xF2, 0xF4, 0x00, 0x60, 0x28, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00,
-    0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x0B, 0xF4, 0x3F, 0xC3, 0xF8, 0x0F, 0xE2, 0xFD, 0x0B, 0xF4,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0F, 0xFA, 0x50, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x10,
-    0x2F, 0xFA, 0xBC, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFD, 0x54, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xF9, 0xFF, 0x40, 0x3F, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xD0, 0xBF, 0xC1, 0xFE,
-    0x0F, 0xF4, 0x0F, 0xE0, 0xFF, 0x01, 0xFD, 0x1F, 0xE0, 0x1F, 0xC1, 0xFD, 0x02, 0xFC, 0x2F, 0xC0,
-    0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0xBF, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xFC, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x3F, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0x00, 0x04, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xF0, 0x01,
-    0xBF, 0xFD, 0x00, 0xBF, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x04,
-    0x02, 0xFE, 0x6F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF8, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFD, 0x0F, 0xF8, 0x08, 0x1F, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x3F, 0x95, 0x40, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x10,
-    0x3F, 0xFB, 0xF0, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x07,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x1F, 0xD0, 0x20, 0x2F, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF,
-    0x40, 0x02, 0xFF, 0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xF0, 0x40, 0x0F, 0xF0, 0xFA, 0xBF, 0xE0,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xF0,
-    0x03, 0xF8, 0x00, 0x64, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x0F, 0xE0, 0x07, 0xF4, 0x01, 0xFD, 0x00,
-    0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xE0, 0x07, 0xF4, 0x02, 0xFC, 0x00, 0x03, 0xC7, 0x80, 0x7E, 0xFC, 0x07, 0xDF, 0xC0, 0x24, 0x60,
-    0x00, 0x00, 0x00, 0x2A, 0x80, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0F,
-    0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x80,
-    0x07, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x0F, 0xE0,
-    0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xD0,
-    0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA9, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xC0,
-    0x00, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0xFF, 0x90, 0x00, 0xFD, 0x07, 0xFF,
-    0xFF, 0x80, 0x1F, 0xC0, 0xBF, 0xEB, 0xFC, 0x02, 0xFC, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0x80, 0xFE,
-    0x01, 0xFD, 0x07, 0xF4, 0x0F, 0xE0, 0x2F, 0xCB, 0xFF, 0x00, 0xFF, 0x9B, 0xFC, 0xBF, 0xD0, 0x07,
-    0xFF, 0xFF, 0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8,
-    0x06, 0xA0, 0x00, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x00, 0x2F, 0xC0,
-    0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xC0, 0x7F, 0x40, 0xFF, 0x0F, 0xF0, 0x1F,
-    0xD0, 0x3F, 0xC3, 0xF8, 0x07, 0xF4, 0x0F, 0xE0, 0xFE, 0x00, 0xFF, 0x5F, 0xF4, 0x7F, 0x40, 0x2F,
-    0xFF, 0xF8, 0x2F, 0xC0, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFD, 0x54, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xF9, 0xFF, 0x40, 0x3F, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xD0, 0xBF, 0xC1, 0xFE,
-    0x0F, 0xF4, 0x0F, 0xE0, 0xFF, 0x01, 0xFD, 0x1F, 0xE0, 0x1F, 0xC1, 0xFD, 0x02, 0xFC, 0x2F, 0xC0,
-    0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0xBF, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x02, 0xA8, 0x03, 0xF8, 0x0F, 0xF0,
-    0x03, 0xF4, 0x3F, 0xD0, 0x07, 0xF0, 0xBF, 0x80, 0x0B, 0xF1, 0xFE, 0x00, 0x0F, 0xFB, 0xFC, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x2F, 0xDF, 0xF0, 0x00, 0x2F, 0xC7, 0xF8, 0x00,
-    0x3F, 0x83, 0xFC, 0x00, 0x3F, 0x82, 0xFD, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0xBF, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x0A, 0x90, 0xFE, 0x01, 0xFD, 0x1F, 0xD0, 0x2F, 0xC2,
-    0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF4, 0x3F, 0x40, 0x7F, 0x47, 0xF4, 0x0B,
-    0xF0, 0xBF, 0x00, 0xFF, 0x0F, 0xF0, 0x2F, 0xE0, 0xFF, 0x07, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFC, 0xFC, 0x02, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xBE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x06, 0xA0, 0x07, 0xF4, 0x03, 0xFC, 0x01, 0xFD, 0x02, 0xFD,
-    0x00, 0x3F, 0x40, 0xFF, 0x00, 0x0F, 0xE0, 0x7F, 0x40, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0xBF, 0x1F,
-    0xD0, 0x00, 0x2F, 0xCF, 0xE0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x0A, 0x90, 0xFE, 0x01, 0xFD,
-    0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF4, 0x3F, 0x40,
-    0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0xBF, 0x00, 0xFF, 0x0F, 0xF0, 0x2F, 0xE0, 0xFF, 0x07, 0xFD, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFC, 0xFC, 0x02, 0xFF, 0x4F, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x2F, 0xC0,
-    0x0B, 0xF1, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x8B, 0xF4, 0x03, 0xF8, 0x01, 0xFD, 0x2F, 0xC0, 0x0F,
-    0xE0, 0x0B, 0xF0, 0xFF, 0x00, 0x7F, 0x40, 0x3F, 0xC3, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x0F, 0xF0,
-    0x0F, 0xF4, 0x0B, 0xF4, 0x3F, 0xC0, 0xBF, 0xD0, 0x3F, 0xC0, 0xFF, 0x03, 0xFF, 0x41, 0xFD, 0x03,
-    0xFC, 0x2F, 0xFD, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0xF4, 0x7F, 0x80, 0x2F, 0xCB, 0xEF, 0xD3, 0xFC,
-    0x00, 0x7F, 0x7F, 0x3F, 0x9F, 0xE0, 0x01, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xC2, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFE, 0x0B, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x3F, 0xC0, 0x00, 0x00, 0x2A, 0x40, 0x6A, 0x00, 0x6A, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F, 0xC3, 0xF4,
-    0x0B, 0xF0, 0x0F, 0xE1, 0xFD, 0x03, 0xFC, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x03, 0xFC, 0x1F, 0xC0,
-    0x7F, 0xC1, 0xFD, 0x03, 0xF4, 0x3F, 0xF0, 0xBF, 0x00, 0xFD, 0x2F, 0xFC, 0x3F, 0x40, 0x3F, 0x5F,
-    0xFF, 0x2F, 0xC0, 0x0F, 0xEF, 0xDF, 0xDF, 0xC0, 0x02, 0xFF, 0xE3, 0xFF, 0xE0, 0x00, 0x7F, 0xF0,
-    0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x2F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1A, 0xFF, 0xA9, 0x03, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFE, 0x01,
-    0x7F, 0xD5, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFC, 0x0F, 0xF0, 0x7F, 0xC0, 0xFE, 0x01, 0xFD, 0x1F, 0xD0, 0x1F, 0xD1, 0xFC, 0x02, 0xFC, 0x2F,
-    0xC1, 0xBF, 0xC3, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xF9, 0x00, 0x01, 0xA0, 0xBE,
-    0x00, 0x00, 0x03, 0xF3, 0xFF, 0xC0, 0x00, 0x03, 0xFB, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x1F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0xE5, 0x40, 0x0F, 0xF0, 0x0F, 0xFF, 0xF8,
-    0x0F, 0xE0, 0x1F, 0xFF, 0xFE, 0x1F, 0xD0, 0x2F, 0xD1, 0xFF, 0x2F, 0xC0, 0x2F, 0xC0, 0xFF, 0x3F,
-    0xC0, 0x3F, 0xC0, 0xFF, 0x3F, 0x80, 0x2F, 0xE6, 0xFD, 0x3F, 0x40, 0x0F, 0xFF, 0xF8, 0x7F, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFE, 0x01, 0xFF, 0xFF, 0xF8,
-    0x01, 0xFD, 0x07, 0xFE, 0x41, 0xB0, 0x01, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xE0,
-    0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF5, 0xBF, 0x55, 0x50, 0x00,
-    0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0x80,
-    0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xE0, 0x06, 0x00, 0x3F, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0x80,
-    0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA8, 0x00, 0x6F, 0xE0, 0x0F, 0xF0, 0x0F, 0xFF, 0xF0, 0x3F, 0x80, 0xFF, 0xFF, 0x41, 0xFD,
-    0x0F, 0xF8, 0x18, 0x0B, 0xF0, 0x7F, 0x80, 0x00, 0x2F, 0xD7, 0xFE, 0x54, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xE5, 0xFE, 0x55, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03,
-    0xFC, 0x0F, 0xF0, 0x04, 0x0F, 0xE0, 0x3F, 0xFB, 0xF0, 0x3F, 0x40, 0x7F, 0xFF, 0xC1, 0xFD, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xFD, 0xBD, 0x00, 0x00,
-    0x2F, 0xCB, 0xE0, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0xBF, 0xAF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xBF, 0xBF, 0x40, 0x0F, 0xF3, 0xF3, 0xF4, 0x01, 0xFD,
-    0x7F, 0x3F, 0x80, 0x3F, 0xCB, 0xE2, 0xF8, 0x0B, 0xF4, 0xFE, 0x2F, 0xC0, 0xFE, 0x0F, 0xD1, 0xFC,
-    0x2F, 0xC1, 0xFC, 0x1F, 0xC3, 0xF8, 0x2F, 0xC1, 0xFC, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x07, 0xFB, 0xD0, 0x00, 0x0F, 0xD7, 0xE0, 0x00, 0x2F, 0xC7,
-    0xF0, 0x00, 0x3F, 0xEB, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF4, 0x03, 0xFA, 0xFB,
-    0xF4, 0x07, 0xF3, 0xF6, 0xF8, 0x0F, 0xE3, 0xF2, 0xFC, 0x2F, 0xC7, 0xF1, 0xFC, 0x3F, 0x47, 0xF0,
-    0xFC, 0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xFE, 0x00, 0x2F,
-    0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFB, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0x7F, 0x00, 0x2F, 0xC0, 0x0F,
-    0xD3, 0xF0, 0x03, 0xF8, 0x03, 0xFC, 0x3F, 0x00, 0x3F, 0xFF, 0xFF, 0xEB, 0xF4, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xF5, 0x7F, 0xFF, 0xEF, 0x80, 0xFE, 0x0B,
-    0xF3, 0xF6, 0xFC, 0x0F, 0xD0, 0xFE, 0x3F, 0x5F, 0xC1, 0xFC, 0x2F, 0xC7, 0xF1, 0xFC, 0x2F, 0xC3,
-    0xF8, 0xBF, 0x0F, 0xC3, 0xFC, 0xFF, 0x0B, 0xE0, 0xFD, 0x3F, 0x9F, 0xE0, 0xFD, 0x0F, 0xD3, 0xF7,
-    0xFC, 0x0F, 0xD0, 0xFE, 0x01, 0xA4, 0x00, 0x2A, 0x90, 0x03, 0xF4, 0x00, 0xFF, 0xE0, 0x03, 0xF0,
-    0x01, 0xFF, 0xE0, 0x07, 0xF0, 0x03, 0xFB, 0xF0, 0x0B, 0xF0, 0x0B, 0xF3, 0xF0, 0x0F, 0xF5, 0x5F,
-    0xE7, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xD5, 0xFE, 0xFF,
-    0xF8, 0x2F, 0x81, 0xFD, 0xFD, 0xFC, 0x3F, 0x83, 0xF9, 0xFD, 0xFC, 0x3F, 0x4B, 0xF2, 0xF8, 0xFC,
-    0x3F, 0x0F, 0xD3, 0xF4, 0xFD, 0x7F, 0x3F, 0xC3, 0xF0, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xE5, 0x5F, 0xF0, 0x00,
-    0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFA, 0xFD, 0xFE, 0x00, 0x03, 0xF8, 0xBF, 0x2F, 0xC0, 0x01, 0xFC, 0x3F, 0xC7, 0xF0, 0x00, 0xFE,
-    0x0F, 0xE1, 0xFC, 0x00, 0x7F, 0x47, 0xF4, 0x7F, 0x00, 0x3F, 0xC2, 0xFC, 0x1F, 0xD0, 0x1F, 0xD0,
-    0xFF, 0x07, 0xF4, 0x0F, 0xF0, 0x3F, 0xC0, 0xFD, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x80, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x7E, 0x0B, 0xF0, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x01,
-    0xFB, 0xF0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFC, 0xBE, 0xBD, 0x00, 0xBE, 0x3F, 0x5F, 0x80, 0x3F, 0x0F, 0xC7, 0xE0, 0x2F, 0xC7, 0xF1, 0xFC,
-    0x0F, 0xD2, 0xF8, 0x3F, 0x00, 0x00, 0xBF, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xD0, 0x3F, 0xD5, 0x7F, 0xD0, 0x01,
-    0xFC, 0x01, 0xFC, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x0F, 0xE1, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x7F,
-    0x3F, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF5, 0x7F, 0xDF, 0xEB, 0xF0, 0x00, 0xFE, 0x0B, 0xF1,
-    0xFD, 0x3F, 0x40, 0x0F, 0xE0, 0xFE, 0x2F, 0xC3, 0xF4, 0x01, 0xFD, 0x2F, 0xC3, 0xFC, 0x3F, 0x40,
-    0x2F, 0xC3, 0xF8, 0x3F, 0xC3, 0xF8, 0x03, 0xFC, 0xBF, 0x43, 0xF8, 0x3F, 0x80, 0x3F, 0x8F, 0xF0,
-    0x7F, 0x43, 0xF8, 0x03, 0xF5, 0xFD, 0x0B, 0xF0, 0x3F, 0xC0, 0x01, 0xA4, 0x2A, 0xAA, 0xAA, 0x80,
-    0x3F, 0x43, 0xFF, 0xFF, 0xFC, 0x03, 0xF0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0xFC, 0x1F, 0xC0,
-    0x0B, 0xF0, 0x0B, 0xD3, 0xF0, 0x00, 0xFF, 0x55, 0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xD6, 0xFE, 0xFF, 0xF4, 0x02, 0xF8, 0x3F, 0x5F, 0x9F,
-    0x80, 0x3F, 0x87, 0xF2, 0xF8, 0xFC, 0x03, 0xF4, 0xFD, 0x3F, 0x4F, 0xC0, 0x3F, 0x1F, 0xC3, 0xF0,
-    0xFC, 0x07, 0xF3, 0xF8, 0x7F, 0x0F, 0xC0, 0x00, 0x01, 0x00, 0x29, 0x00, 0x03, 0xD1, 0xFE, 0x00,
-    0x02, 0xFB, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x78, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x6F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x7F, 0xF0, 0x01, 0xAF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF4, 0x00, 0xFF,
-    0x94, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xA0, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x09, 0x00, 0xBC, 0x00, 0x2E, 0x0F, 0xF0, 0x00,
-    0x3E, 0xFC, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0x40,
-    0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x05, 0x6F, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xAF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0x50, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xEA,
-    0xA9, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x05, 0x40, 0x40, 0x00, 0x0B, 0xE0,
-    0x2F, 0x80, 0x7F, 0x03, 0xF8, 0x0F, 0xE0, 0x2F, 0xC0, 0xFD, 0x03, 0xF4, 0x0F, 0xE0, 0x7F, 0x01,
-    0xFD, 0x03, 0xF4, 0x2F, 0xC0, 0xBF, 0x01, 0xFC, 0x0F, 0xE0, 0x2F, 0xC0, 0xBF, 0x03, 0xF8, 0x0F,
-    0xE0, 0x3F, 0xC0, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x41, 0xFC, 0x0B, 0xF0, 0x0F, 0xF0, 0xBF,
-    0x0B, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x06, 0xFD, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x2A, 0x81, 0xFC, 0x1A, 0x80, 0xFE, 0x0B, 0xF0, 0xBF, 0x07, 0xF4,
-    0x3F, 0x82, 0xFC, 0x1F, 0xC0, 0xFD, 0x0B, 0xF0, 0xBF, 0x07, 0xF4, 0x2F, 0xC3, 0xFC, 0x2F, 0xC0,
-    0xFF, 0x0F, 0xE0, 0xBF, 0x03, 0xF8, 0x7F, 0x43, 0xF8, 0x1F, 0xD2, 0xFC, 0x0F, 0xD0, 0xBF, 0x0B,
-    0xF0, 0x7F, 0x03, 0xFC, 0x2F, 0xD2, 0xFC, 0x3F, 0xC0, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x2F, 0xC1, 0xFE, 0x00,
-    0x07, 0xF4, 0xBF, 0x00, 0x00, 0xFD, 0x3F, 0xEA, 0xAA, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xF6, 0xFD, 0x55, 0x57, 0xFC, 0xBF, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47,
-    0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x7F, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xF0, 0xBF, 0x82, 0xFC, 0x3F, 0xC0, 0x3F, 0x5F, 0xD0, 0x0F, 0xEB, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFD, 0xFF, 0x55, 0xFF, 0x3F, 0xC0, 0x3F, 0xCB, 0xF0, 0x2F, 0xD1, 0xFF, 0xBF, 0xF0,
-    0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0xBF, 0x00,
-    0x03, 0xFF, 0xBF, 0x00, 0x0F, 0xFF, 0x7F, 0x00, 0x2F, 0xE0, 0x7F, 0x00, 0x3F, 0xC0, 0x7F, 0x00,
-    0xBF, 0x40, 0x3F, 0x00, 0xFF, 0x00, 0x3F, 0x41, 0xFD, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0x3F, 0x47,
-    0xF0, 0x00, 0x3F, 0x4F, 0xE0, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x2F, 0xBF,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x6A, 0x00, 0x0A, 0x9B, 0xF0, 0x03, 0xFE, 0x7F, 0x00, 0xBF, 0xE7, 0xF0, 0x1F, 0xF4,
-    0x3F, 0x03, 0xFC, 0x03, 0xF4, 0x7F, 0x40, 0x3F, 0x4F, 0xF0, 0x03, 0xF5, 0xFD, 0x00, 0x3F, 0x6F,
-    0xC0, 0x02, 0xFB, 0xF4, 0x00, 0x2F, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xCF, 0xE0, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x03,
-    0xE1, 0xF4, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0xBF,
-    0x00, 0x03, 0xFF, 0xBF, 0x00, 0x0F, 0xFF, 0x7F, 0x00, 0x2F, 0xE0, 0x7F, 0x00, 0x3F, 0xC0, 0x7F,
-    0x00, 0xBF, 0x40, 0x3F, 0x00, 0xFF, 0x00, 0x3F, 0x41, 0xFD, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0x3F,
-    0x47, 0xF0, 0x00, 0x3F, 0x4F, 0xE0, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x2F,
-    0xBF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0xFC, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0xFC, 0x3E,
-    0x00, 0x02, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x0A, 0x9B, 0xF0, 0x03, 0xFE, 0x7F,
-    0x00, 0xBF, 0xE7, 0xF0, 0x1F, 0xF4, 0x3F, 0x03, 0xFC, 0x03, 0xF4, 0x7F, 0x40, 0x3F, 0x4F, 0xF0,
-    0x03, 0xF5, 0xFD, 0x00, 0x3F, 0x6F, 0xC0, 0x02, 0xFB, 0xF4, 0x00, 0x2F, 0xFF, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x06, 0xA0, 0x01, 0xA8, 0x1F, 0xF0, 0x00, 0xBF, 0x47, 0xF0, 0x03,
-    0xFC, 0x2F, 0xD0, 0x00, 0x7F, 0x43, 0xF4, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x43, 0xF4, 0x0F,
-    0xF0, 0x3F, 0x80, 0x00, 0x7F, 0x43, 0xF8, 0x1F, 0xD0, 0x7F, 0x40, 0x00, 0xBF, 0x42, 0xF8, 0x3F,
-    0xC0, 0xBF, 0x40, 0x00, 0xFF, 0x02, 0xFC, 0x7F, 0x40, 0xBF, 0x40, 0x01, 0xFF, 0x01, 0xFC, 0xFE,
-    0x00, 0x7F, 0x40, 0x02, 0xFD, 0x01, 0xFD, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0xFE, 0xF8,
-    0x00, 0x3F, 0xE0, 0x2F, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE0, 0x02, 0xA4, 0x00, 0xA9, 0x03, 0xFF, 0xFC, 0x03, 0xF8, 0x02, 0xFD, 0x0F,
-    0xFF, 0xFF, 0x03, 0xF8, 0x03, 0xFC, 0x2F, 0xF0, 0xFF, 0x02, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0x7F,
-    0x42, 0xFC, 0x0F, 0xE0, 0x7F, 0x40, 0x3F, 0x81, 0xFC, 0x2F, 0xC0, 0xBF, 0x00, 0x3F, 0x40, 0xFC,
-    0x3F, 0x80, 0xFF, 0x00, 0x7F, 0x40, 0xFC, 0xBF, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0xFD, 0xFE, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0xFE, 0xFC, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0xBF, 0xF8, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xEB, 0xEF, 0xF4, 0x0F, 0xF8, 0x00, 0x7F, 0xC1, 0xFE, 0x00, 0x03,
-    0xFC, 0x3F, 0xC0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x02, 0xFC, 0x7F, 0x80, 0x00, 0x2F, 0xC7, 0xF4,
-    0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x07, 0xF8, 0x7F, 0x80, 0x00, 0xFF,
-    0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x3F, 0xF7, 0xDF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xD3, 0xFC, 0x10, 0xFE, 0x7F, 0x40, 0x0F, 0xEB, 0xF0, 0x00, 0xFE, 0xFF, 0x00, 0x0F, 0xEF,
-    0xF0, 0x01, 0xFD, 0xFF, 0x00, 0x3F, 0xCB, 0xF6, 0xDB, 0xF8, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x07, 0x41, 0xBD, 0x00, 0x00, 0x00,
-    0x01, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x01,
-    0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x0B, 0xFD,
-    0x08, 0x01, 0x47, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFE,
-    0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0x80, 0x00, 0x00,
-    0x01, 0xFD, 0x7F, 0x40, 0x0B, 0xE0, 0x02, 0xFD, 0x7F, 0x40, 0x0F, 0xE0, 0x03, 0xFC, 0x7F, 0x40,
-    0x1F, 0xD0, 0x03, 0xFC, 0x7F, 0x80, 0x2F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xF0,
-    0x3F, 0xE0, 0xBF, 0xD0, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFB, 0xFF,
-    0xFE, 0x00, 0x01, 0xFF, 0xD0, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x80, 0x00, 0x00, 0xE1, 0x1B, 0x80, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x6F, 0x80, 0x03, 0xFF, 0xE0, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xD0, 0xFF, 0xFC, 0x2F, 0xE0, 0x40, 0x53, 0xFD, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x7F,
-    0x40, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x54, 0x00, 0xFD, 0xFF, 0x00, 0xFE, 0x01, 0xFD, 0xFE, 0x00,
-    0xFD, 0x02, 0xFC, 0xFF, 0x01, 0xFC, 0x03, 0xFC, 0xFF, 0x03, 0xFD, 0x0B, 0xF4, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xBF, 0xFF, 0xC0, 0x0F, 0xFD, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0E, 0x6D,
-    0x7C, 0x00, 0x00, 0x00, 0x10, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0xBF, 0x00, 0x2F, 0xC7, 0xF4, 0x03, 0xFC, 0x00, 0xFE, 0x2F, 0xD0, 0x0F, 0xE0, 0x07, 0xF4, 0xBF,
-    0x00, 0x3F, 0x80, 0x2F, 0xC3, 0xFC, 0x01, 0xFD, 0x00, 0xFF, 0x0F, 0xF0, 0x0B, 0xF4, 0x03, 0xF8,
-    0x3F, 0xC0, 0x3F, 0xD0, 0x2F, 0xD0, 0xFF, 0x02, 0xFF, 0x40, 0xFF, 0x03, 0xFC, 0x0F, 0xFD, 0x07,
-    0xF4, 0x0F, 0xF0, 0xBF, 0xF4, 0x3F, 0xC0, 0x2F, 0xC3, 0xFF, 0xD1, 0xFE, 0x00, 0xBF, 0x2F, 0xBF,
-    0x4F, 0xF0, 0x01, 0xFD, 0xFC, 0xFE, 0x7F, 0x80, 0x07, 0xFF, 0xE3, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0x0B, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x2F, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xF0, 0x00, 0x01,
-    0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xF6, 0xF7, 0xD0, 0x00, 0x00, 0x14, 0x20, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x90, 0x1A, 0x80, 0x1A, 0x83, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0xFD, 0x02, 0xFC, 0x03, 0xF8,
-    0x7F, 0x40, 0xFF, 0x02, 0xFC, 0x1F, 0xC0, 0x3F, 0xC0, 0xFF, 0x07, 0xF0, 0x1F, 0xF0, 0x7F, 0x40,
-    0xFD, 0x0F, 0xFC, 0x2F, 0xC0, 0x3F, 0x4B, 0xFF, 0x0F, 0xD0, 0x0F, 0xD7, 0xFF, 0xCB, 0xF0, 0x03,
-    0xFB, 0xF7, 0xF7, 0xF0, 0x00, 0xBF, 0xF8, 0xFF, 0xF8, 0x00, 0x1F, 0xFC, 0x3F, 0xFC, 0x00, 0x03,
-    0xFD, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x41, 0xB0, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x04, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x6F,
-    0xE4, 0x02, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x1F, 0xF4, 0x24, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0x40, 0x3F, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD,
-    0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0B,
-    0x40, 0x09, 0x03, 0xC0, 0x03, 0xE2, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x3C, 0x2E, 0x74, 0x2D, 0x00, 0x1F, 0xDF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF8,
-    0x00, 0x03, 0xDF, 0xD0, 0x02, 0xE0, 0xB0, 0x00, 0xF0, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0xFF, 0xFB, 0xFF, 0xFD, 0x78, 0x00, 0x00, 0x00,
-    0x7F, 0x86, 0xBF, 0xFD, 0xBF, 0xFB, 0xEB, 0x90, 0x2E, 0x1E, 0x1F, 0xDB, 0xD1, 0xF0, 0x1F, 0x00,
-    0x00, 0x2E, 0x0F, 0xD1, 0xF4, 0x7C, 0xF8, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x7F, 0xFF, 0x53, 0xFB,
-    0xFF, 0x8F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x01, 0xD1, 0xD0, 0x00, 0x00, 0xB4, 0x70, 0x00, 0x14, 0x05, 0x00, 0x00, 0x04, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x43, 0x97, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x6C, 0x20, 0x08, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xEB, 0xC0, 0x00, 0x00, 0x7A,
-    0xF0, 0x00, 0x28, 0x09, 0x00, 0x00, 0x09, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x64, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x01, 0xE0, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x02, 0xA0, 0x00, 0x07, 0xF0, 0x0B, 0xE0, 0x00, 0x03, 0xFD,
-    0x7F, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x0B, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xFD, 0x00, 0x7F, 0xF8,
-    0x01, 0xFC, 0x00, 0xFF, 0xF4, 0x01, 0xFC, 0x02, 0xFF, 0xF0, 0x02, 0xF8, 0x07, 0xFB, 0xF0, 0x03,
-    0xF4, 0x0F, 0xDB, 0xE0, 0x03, 0xF4, 0x3F, 0xCF, 0xD0, 0x07, 0xF0, 0xBF, 0x0F, 0xC0, 0x0B, 0xF1,
-    0xFD, 0x1F, 0xC0, 0x0F, 0xE3, 0xF8, 0x2F, 0xC0, 0x0F, 0xDF, 0xF0, 0x3F, 0x80, 0x0F, 0xEF, 0xC0,
-    0x3F, 0x40, 0x1F, 0xFF, 0x40, 0x3F, 0x00, 0x2F, 0xFE, 0x00, 0x7F, 0x54, 0x3F, 0xFC, 0x00, 0xBF,
-    0xFD, 0x3F, 0xF4, 0x00, 0xFF, 0xFC, 0x3F, 0xE0, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x01, 0xA0, 0x0F, 0xD0, 0x1F,
-    0xC0, 0x2F, 0xD5, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x2B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xAA, 0x00, 0xA9, 0x03, 0xF8, 0x03, 0xF4, 0x1F, 0xD0, 0x1F, 0xC0, 0x7F, 0x00, 0xBF, 0x02, 0xFC,
-    0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x7F, 0x41, 0xFD, 0x02, 0xFC, 0x07, 0xF0, 0x0F,
-    0xF0, 0x2F, 0xC0, 0x7F, 0x80, 0xBF, 0x03, 0xFE, 0x02, 0xFF, 0xFF, 0xFE, 0x87, 0xFF, 0xDF, 0xFF,
-    0x07, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFC, 0x0F, 0xF0, 0x7F, 0xC0, 0xFF, 0x02,
-    0xFD, 0x0F, 0xE0, 0x1F, 0xD1, 0xFD, 0x03, 0xFC, 0x2F, 0xC0, 0xBF, 0xC3, 0xFF, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFD, 0x03, 0xFF, 0xF9, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x17, 0xFD, 0x50, 0x3F,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC5, 0x40, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFD, 0x7F, 0x82, 0xFE,
-    0xBF, 0x00, 0xFF, 0xBF, 0x00, 0xFE, 0x7F, 0xD7, 0xFC, 0x3F, 0xFF, 0xF8, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFE,
-    0x5B, 0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x01, 0xFD, 0x03, 0xFC, 0x22, 0xFD, 0x03, 0xF8,
-    0xFF, 0xFC, 0x07, 0xF9, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xFA,
-    0xAF, 0x80, 0x0F, 0xE0, 0x0B, 0x40, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x68, 0x2F, 0x80, 0x03, 0xF7,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x40, 0x7F, 0xD2, 0xFE, 0x02, 0xFD, 0x03, 0xFC, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x3F, 0x80, 0x3F, 0x80, 0xFD, 0x00, 0xFE, 0x07, 0xF0, 0x4B, 0xF4, 0x2F, 0xCB, 0xFF, 0xC0,
-    0xFF, 0x9F, 0xFE, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xEF, 0xFF, 0x00, 0x7F, 0x2F, 0xFC, 0x02, 0xFC,
-    0x00, 0xF8, 0x0F, 0xF0, 0x01, 0x80, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFE, 0x55, 0x40, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x01, 0xAA, 0xBF, 0x40, 0x3F,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x40, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x02, 0xFD, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0xFF, 0x54, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0xC0, 0x06, 0xFF, 0xAA, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xE5, 0x54, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFC, 0x1F, 0xFC, 0x0F, 0xE0,
-    0x0F, 0xF4, 0x7F, 0x40, 0x2F, 0xD2, 0xFC, 0x00, 0x7F, 0x8F, 0xF0, 0x01, 0xFE, 0x3F, 0x80, 0x07,
-    0xF4, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0x00, 0xBF, 0xC0,
-    0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x1F, 0xE5, 0x54, 0x0B, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFD, 0x0B, 0xF4, 0xBF, 0x83,
-    0xFC, 0x0F, 0xF0, 0xFE, 0x03, 0xFC, 0x3F, 0x40, 0xFF, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x0B, 0xF4, 0x04, 0x0B, 0xFC, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x2F, 0xD0, 0x03, 0xFC, 0x03, 0xF8, 0x07,
-    0xF8, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0xFF, 0x00, 0x00, 0xFE, 0x07, 0xF0, 0x3F, 0xC0, 0x00, 0x0B,
-    0xF0, 0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x4F, 0xF1, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0xFE, 0x7F,
-    0x80, 0x00, 0x00, 0x1F, 0xDF, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF7, 0xFA, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0x8F,
-    0xE0, 0x00, 0x00, 0x3F, 0xC7, 0xF4, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x07, 0xF4, 0x00, 0x02,
-    0xFD, 0x0B, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x80, 0xFE, 0x02, 0xFF, 0xD0, 0x1F, 0xF0, 0x0F, 0xD0,
-    0x0F, 0xFC, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x6A, 0x00, 0x2F, 0xC0, 0x7F, 0xF0, 0x0B, 0xF0, 0x1F, 0xFC, 0x07, 0xFF, 0xC0,
-    0xFE, 0x07, 0xFF, 0xC0, 0x03, 0xFC, 0x0F, 0xD0, 0xFF, 0x40, 0x00, 0x1F, 0xD0, 0xFD, 0x2F, 0xD0,
-    0x00, 0x00, 0xFD, 0x1F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xEB, 0xFA, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x07, 0xF0,
-    0x00, 0x00, 0xFF, 0x4B, 0xF0, 0x7F, 0x80, 0x02, 0xBF, 0xE0, 0xBF, 0x03, 0xFF, 0xE0, 0x3F, 0xFC,
-    0x0F, 0xE0, 0x2F, 0xFE, 0x03, 0xFE, 0x00, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0x80, 0x1F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xAB, 0xFF, 0x80, 0x03, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x15, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x14, 0x00, 0x3F, 0xD0, 0xBF, 0xAF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x17,
-    0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
-    0x90, 0x0F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFE, 0x01, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x56, 0xFC,
-    0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x01, 0x5B, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0xBE,
-    0xBF, 0xF8, 0xBF, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E,
-    0x00, 0x05, 0xBE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x7F, 0x80, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFE, 0x03, 0xFD, 0x00, 0x1F, 0xD0, 0xBF, 0x40, 0x01,
-    0xFC, 0x1F, 0xE0, 0x00, 0x2F, 0xC7, 0xFC, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xBF, 0xD0,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0xFE,
-    0x3F, 0xC0, 0x00, 0x0F, 0xE2, 0xFD, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0xFF, 0x40,
-    0x03, 0xFC, 0x07, 0xFF, 0xF0, 0x3F, 0x80, 0x3F, 0xFE, 0x03, 0xF4, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x02, 0xA8, 0x03, 0xFC, 0x0F,
-    0xF4, 0x03, 0xF8, 0x2F, 0xD0, 0x07, 0xF4, 0xBF, 0x80, 0x0B, 0xF1, 0xFE, 0x00, 0x0B, 0xF7, 0xFC,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x2F, 0xC7, 0xF8,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F, 0x82, 0xFF, 0xF0, 0x3F, 0x40, 0xFF, 0xF0, 0x7F, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x0F, 0xF0, 0x4B, 0xF8, 0x00, 0xFE,
-    0x3D, 0xFE, 0x00, 0x1F, 0xD3, 0xFF, 0xC0, 0x01, 0xFD, 0x3F, 0xF0, 0x00, 0x2F, 0xC7, 0xFC, 0x00,
-    0x03, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xAF, 0xD0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF,
-    0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x0F, 0xE3, 0xFE, 0x00, 0x01,
-    0xFD, 0x3F, 0xF0, 0x00, 0x2F, 0xC7, 0xFF, 0x80, 0x03, 0xFC, 0xB3, 0xFC, 0x00, 0x3F, 0x80, 0x1F,
-    0xD0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x02, 0xA4, 0x06, 0xA4, 0x0F, 0xD5, 0x3F, 0xC0, 0x7F, 0x7F,
-    0xFC, 0x02, 0xFC, 0xFF, 0xC0, 0x0F, 0xF7, 0xFD, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFF, 0xFE, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x2F, 0xDF, 0xE0, 0x00, 0xFE, 0x7F, 0xC0, 0x03, 0xFA, 0xFF, 0x80, 0x1F,
-    0xDF, 0xFF, 0x00, 0xBF, 0x39, 0xFE, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x0F, 0xF4, 0x0F, 0xFF, 0xD2, 0xFD, 0x00, 0xFF, 0xFC, 0xBF, 0x80, 0x0F, 0xFF, 0xDF,
-    0xF0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xAF, 0xD0, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0xFF, 0x3F, 0xC0,
-    0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0xBF, 0x40, 0x03, 0xFC,
-    0x07, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0xD0, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x06, 0xFE, 0x54, 0x00,
-    0x02, 0xFC, 0x02, 0xA8, 0x03, 0xFC, 0x0F, 0xF4, 0x03, 0xF8, 0x2F, 0xD0, 0x07, 0xF4, 0xBF, 0x80,
-    0x0B, 0xF1, 0xFE, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x1F, 0xDF, 0xF0, 0x00, 0x2F, 0xC7, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F, 0x82, 0xFE, 0x00,
-    0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x7F, 0xFF, 0x40, 0x3F, 0xCB, 0xFF, 0xF0, 0x0F,
-    0xF4, 0xFF, 0xFF, 0x02, 0xFE, 0x05, 0x5F, 0xE0, 0x7F, 0xC0, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x2F,
-    0xD3, 0xFC, 0x00, 0x02, 0xFC, 0xBF, 0x40, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x0F, 0xF0,
-    0xFF, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x7F, 0x80, 0x02, 0xFC, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x2F, 0xD0, 0x03, 0xF8, 0x01, 0xFF, 0x00, 0x1A, 0xAA, 0x80, 0x2A, 0x82, 0xFF, 0xFC,
-    0x0B, 0xF4, 0x3F, 0xFF, 0x82, 0xFE, 0x00, 0x07, 0xF8, 0x7F, 0x80, 0x00, 0x7F, 0x5F, 0xF0, 0x00,
-    0x0B, 0xF7, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFD, 0xFF,
-    0x00, 0x00, 0x1F, 0xC7, 0xF8, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x03,
-    0xF8, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x01,
-    0xFD, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x2F,
-    0xC0, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xF5, 0x56, 0xFD, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x0F, 0xE0,
-    0x02, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x7F, 0xFF,
-    0x3F, 0x80, 0x0B, 0xFF, 0xE3, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x02, 0xA8, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF4,
-    0x07, 0xF4, 0x07, 0xF4, 0x0B, 0xF0, 0x0B, 0xF0, 0x0F, 0xF5, 0x5F, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x1F, 0xE5, 0x6F, 0xC0, 0x2F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x3F, 0x80, 0x3F, 0xFD, 0x3F, 0x40, 0x7F, 0xFC, 0x7F, 0x40, 0xBF, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0xBF, 0x00, 0x0F, 0xFF, 0xD0, 0x0F, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0xFF,
-    0xC0, 0x1F, 0xD0, 0x03, 0xFD, 0x50, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x03, 0xF4,
-    0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xF5, 0x56, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x2F,
-    0xC0, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x03,
-    0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00,
-    0xFF, 0x00, 0x00, 0x01, 0xA8, 0x02, 0xAA, 0xA8, 0x03, 0xFC, 0x03, 0xFF, 0xFC, 0x03, 0xF8, 0x03,
-    0xFF, 0xF8, 0x07, 0xF4, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0xF5, 0x5F, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xE5, 0x6F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x3F,
-    0x40, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x55, 0x7F, 0x80,
-    0x00, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0xFE, 0x40, 0x0B,
-    0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x1F,
-    0xFC, 0x0F, 0xE0, 0x03, 0xF8, 0x03, 0xFD, 0x1F, 0xD0, 0x07, 0xF4, 0x01, 0xFE, 0x2F, 0xC0, 0x07,
-    0xF0, 0x00, 0xFE, 0x3F, 0xC0, 0x0B, 0xF0, 0x00, 0xFE, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0xFE, 0x3F,
-    0x40, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x40, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0xAA, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xF4,
-    0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x1F,
-    0xFF, 0x80, 0x0F, 0xE0, 0x1F, 0xFF, 0xF4, 0x1F, 0xD0, 0x2F, 0xFF, 0xFC, 0x2F, 0xC0, 0x3F, 0xC7,
-    0xFD, 0x3F, 0xC0, 0x3F, 0x81, 0xFE, 0x3F, 0x80, 0x7F, 0x40, 0xFE, 0x3F, 0x40, 0xBF, 0x00, 0xFE,
-    0x7F, 0x40, 0xBF, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x04, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x02,
-    0xF9, 0x01, 0xFF, 0x03, 0xFF, 0xD0, 0xBF, 0x43, 0xFF, 0xFC, 0x3F, 0xC2, 0xFC, 0x7F, 0x0F, 0xE0,
-    0xFE, 0x0F, 0xC7, 0xF4, 0x3F, 0x47, 0xF1, 0xFD, 0x0F, 0xC1, 0xFC, 0x7F, 0x43, 0xF0, 0xFE, 0x1F,
-    0xD0, 0xFC, 0x7F, 0x47, 0xF8, 0x3F, 0x7F, 0xC0, 0xFF, 0x4B, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x02, 0xFF, 0x01, 0x00,
-    0x3F, 0xC2, 0xFF, 0x07, 0xF4, 0xFF, 0xFC, 0xBF, 0x1F, 0xDF, 0xCF, 0xF2, 0xF8, 0xFC, 0xFF, 0x2F,
-    0x4F, 0xCF, 0xF2, 0xF5, 0xF8, 0xBF, 0x1F, 0xFF, 0x07, 0xFE, 0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x80,
-    0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x5B, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xE4, 0x02, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x2F, 0xF4, 0x24, 0x3F, 0xC0, 0x00, 0x7F, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x40,
-    0x7F, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x7C, 0x00, 0x05, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x85, 0x5F, 0xF5, 0x50, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA0, 0xBE, 0x00, 0xBE, 0x00, 0x0F, 0xCF, 0xFF, 0x1F, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0x87, 0xFF, 0x4B, 0xF4, 0x0B, 0xFC, 0x0F, 0xF4, 0x1F, 0xD0, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x7F, 0x00, 0xFF, 0x01, 0xFD, 0x02, 0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xF0,
-    0x1F, 0xD0, 0x2F, 0xC0, 0x3F, 0x80, 0xBF, 0x00, 0xFE, 0x01, 0xFD, 0x03, 0xFC, 0x03, 0xF8, 0x07,
-    0xF4, 0x0F, 0xE0, 0x1F, 0xD0, 0x1F, 0xFC, 0x3F, 0x40, 0xBF, 0x00, 0x7F, 0xF1, 0xFC, 0x03, 0xFC,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0xBF, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0xBF, 0x43, 0xF8, 0x07, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x2F,
-    0xC2, 0xFD, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFD, 0xFF, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x6A, 0x00, 0x2A, 0x8B, 0xF0, 0x07, 0xF8, 0x7F, 0x00, 0xFF, 0x07, 0xF0,
-    0x1F, 0xE0, 0x3F, 0x03, 0xFC, 0x03, 0xF4, 0x7F, 0x40, 0x3F, 0x4F, 0xF0, 0x03, 0xF5, 0xFD, 0x00,
-    0x2F, 0x6F, 0xC0, 0x02, 0xFB, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x01, 0xFD,
-    0x00, 0xBF, 0x40, 0x3F, 0x80, 0x7F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x02, 0xFC, 0x2F, 0xD0, 0x00,
-    0x7F, 0x4F, 0xE0, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x15, 0xFF, 0x54, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xAF, 0xFA, 0xA0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x06, 0xA0, 0x02, 0xA8, 0x0B, 0xF0, 0x07, 0xF8, 0x07,
-    0xF0, 0x0F, 0xF0, 0x07, 0xF0, 0x1F, 0xE0, 0x03, 0xF0, 0x3F, 0xC0, 0x03, 0xF4, 0x7F, 0x40, 0x03,
-    0xF4, 0xFF, 0x00, 0x03, 0xF5, 0xFD, 0x00, 0x02, 0xF6, 0xFC, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
-    0x00, 0x07, 0xF3, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x8F, 0xE0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x07,
-    0xF4, 0x00, 0x0B, 0xF8, 0x03, 0xFF, 0xE0, 0x1F, 0xF0, 0x03, 0xFF, 0xE0, 0x3F, 0xC0, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA8, 0x02, 0xA9, 0x01, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xBF, 0x2F, 0xD0, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xFC, 0xFE, 0x00, 0x0F, 0xF0, 0xFF, 0xFC, 0x2F,
-    0xD0, 0x7F, 0xF8, 0xBF, 0x80, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0xFF, 0xFF, 0x4B, 0xF2,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xCF, 0xFF, 0xFF, 0xF0, 0xFE, 0x15, 0x7F, 0xD5, 0x47, 0xF4, 0x00, 0xFF,
-    0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x0F,
-    0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x01,
-    0xFD, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0xFF, 0x00,
-    0x2F, 0xD4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA5,
-    0xA8, 0xBF, 0xFF, 0xF2, 0xFC, 0xBF, 0xFF, 0xF3, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF8, 0x07,
-    0xF4, 0x07, 0xF4, 0x0B, 0xF0, 0x0B, 0xF0, 0x0F, 0xF0, 0x0B, 0xF0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1F,
-    0xE0, 0x0F, 0xE0, 0x3F, 0xD0, 0x0F, 0xE0, 0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xCF,
-    0xF8, 0x03, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x02, 0xF8, 0x1F, 0xC0, 0x03,
-    0xF8, 0x2F, 0xC0, 0x07, 0xF4, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0x80, 0x0B, 0xF0, 0x7F, 0x40, 0x0F,
-    0xF0, 0xBF, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x1F, 0xD0, 0xBF, 0x40, 0x7F, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x2A, 0x5F, 0xD0, 0x1F, 0xC7,
-    0xF0, 0x0B, 0xF2, 0xFC, 0x03, 0xFC, 0xFF, 0x01, 0xFE, 0x3F, 0x80, 0xFF, 0x4F, 0xF4, 0xBF, 0xC3,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFB, 0xF8, 0x06, 0xE4, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xFF,
-    0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x02, 0xFC, 0xBF, 0x40, 0x0F, 0xE2, 0xFC,
-    0x00, 0x7F, 0x8F, 0xF0, 0x01, 0xFD, 0x3F, 0x80, 0x0B, 0xF1, 0xFD, 0x2C, 0x3F, 0xCB, 0xF4, 0xF0,
-    0xFE, 0x2F, 0xC3, 0x87, 0xF4, 0xBF, 0x9E, 0x7F, 0xC2, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFF, 0x9F, 0xE0, 0x00, 0x78, 0x7F, 0x40, 0x01, 0xD2, 0xFC, 0x00, 0x0B, 0x0F, 0xF0, 0x00,
-    0x3C, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x2A, 0x40, 0x2A, 0x5F, 0xD0,
-    0x0F, 0xD7, 0xF0, 0x07, 0xF2, 0xFC, 0x02, 0xFC, 0xFF, 0x38, 0xFF, 0x3F, 0x8E, 0xBF, 0x8F, 0xFB,
-    0xFF, 0xD2, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x02, 0xF8, 0xFE, 0x00, 0x0D, 0x3F, 0x80, 0x07,
-    0x1F, 0xD0, 0x01, 0x4B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x03, 0xFD, 0xBF, 0xE0, 0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x0B, 0xFD, 0x07,
-    0xFD, 0x0F, 0xF0, 0x01, 0xFD, 0x0F, 0xF0, 0x02, 0xFC, 0x0F, 0xE0, 0x02, 0xFC, 0x1F, 0xD0, 0x03,
-    0xFC, 0x2F, 0xC0, 0x03, 0xF8, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0x80, 0x0F,
-    0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x2F, 0xC7, 0xE0, 0x03, 0xFB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x07, 0xFE, 0x1F,
-    0xF0, 0xBF, 0xC0, 0xFF, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF, 0x00, 0xFD, 0x0F, 0xE0, 0x1F, 0xD1, 0xFD,
-    0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x3F, 0x43, 0xF4, 0x07, 0xF0,
-    0x7F, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x42, 0xFD, 0x05, 0x07, 0xFC,
-    0x01, 0xFD, 0x3F, 0x4F, 0xF0, 0x01, 0xFD, 0x3F, 0x1F, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xEA, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xD5, 0x40, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x02, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFE, 0x29, 0x3F, 0xD0, 0xBF, 0xBC, 0x7F, 0x40, 0xFF, 0xBC, 0xBF, 0x02, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0x06, 0xFF, 0xA4, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x10, 0x00, 0xFF, 0xEA, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x42, 0xFD, 0x05, 0x07, 0xFC,
-    0x01, 0xFD, 0x3F, 0x4F, 0xF0, 0x01, 0xFD, 0x3F, 0x1F, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xEA, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xD5, 0x40, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x02, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x29, 0x3F, 0xD0,
-    0xBF, 0xBC, 0x7F, 0x40, 0xFF, 0xBC, 0xBF, 0x02, 0xFE, 0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xE0, 0x06, 0xFF, 0xA4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x10, 0x00, 0xFF, 0xEA,
-    0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD,
-    0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xE6, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFD,
-    0x00, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x0B, 0xF4, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x7F, 0x80,
-    0x00, 0x2F, 0xC0, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x43, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF,
-    0x0F, 0xE2, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x5F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x07, 0xFD, 0xFE, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0xC7, 0xF4, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x2F,
-    0xC3, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x07, 0xF4, 0x00, 0x02, 0xFF, 0x03, 0xF8, 0x0F, 0xF0,
-    0x00, 0x1F, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x7F, 0x00, 0xBF, 0x80, 0x0F, 0xF8,
-    0x02, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x6A,
-    0x00, 0x2F, 0xC0, 0x3F, 0xF4, 0x0B, 0xF0, 0x2F, 0xFC, 0x03, 0xFF, 0xC0, 0xFE, 0x0B, 0xFF, 0x80,
-    0x02, 0xFD, 0x0F, 0xD0, 0xFF, 0x00, 0x00, 0x0F, 0xD1, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x2F,
-    0xC3, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x2F, 0xEB, 0xFE, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x4B,
-    0xF0, 0xBF, 0x40, 0x01, 0xBF, 0xE0, 0xFF, 0x03, 0xFE, 0x80, 0x3F, 0xFC, 0x0F, 0xE0, 0x2F, 0xFC,
-    0x07, 0xFE, 0x00, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFE, 0x03, 0xFD, 0x00, 0x1F, 0xD0, 0xBF, 0x40,
-    0x01, 0xFC, 0x1F, 0xE0, 0x00, 0x2F, 0xC7, 0xFC, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xBF,
-    0xD0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0x56, 0xFF, 0x40, 0x0F, 0xE0, 0x07, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x02,
-    0xFC, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA8, 0x02, 0xA8, 0x03, 0xFC, 0x0F, 0xF4, 0x03, 0xF8, 0x2F, 0xD0, 0x07, 0xF4, 0xBF, 0x80, 0x0B,
-    0xF1, 0xFE, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x2F, 0xD5, 0xFF, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x2F, 0xC0, 0x3F,
-    0x40, 0x1F, 0xC0, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x01,
-    0x01, 0xFF, 0x40, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFD, 0x5F, 0xF0, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x1F,
-    0xD0, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x3F, 0x80,
-    0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x03, 0xFD, 0x01, 0xFE, 0x54, 0xBF, 0xF8,
-    0x01, 0xFF, 0xFC, 0xFF, 0xF0, 0x02, 0xFF, 0xF4, 0xBF, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0x87, 0xF4, 0x00, 0x3F, 0x82, 0xFC,
-    0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x07, 0xF4, 0x0F, 0xD0, 0x02, 0xFC, 0x07,
-    0xF0, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x02, 0xFF, 0xC0, 0x3F, 0xE9, 0xBF, 0xD0,
-    0x1F, 0xFF, 0x2F, 0xD0, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x0F,
-    0xD0, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xE0, 0x03, 0xFC, 0x01, 0xFD,
-    0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xF5, 0x56, 0xFD, 0x00, 0xFF, 0x00,
-    0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x03, 0xF8, 0x03,
-    0xFC, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x01, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x02,
-    0xA8, 0x0F, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x81, 0xFD, 0x01, 0xFD, 0x0B, 0xF0, 0x0B, 0xF0,
-    0x3F, 0xD5, 0x7F, 0xC0, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF4, 0x1F, 0xE5, 0x6F, 0xC0, 0xBF,
-    0x00, 0xBF, 0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xE0, 0x0F, 0xE0, 0x3F, 0x40, 0x7F, 0x41, 0xFD, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0x07, 0xFD, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F,
-    0xD0, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x01,
-    0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x55, 0x6F, 0xD0,
-    0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x02, 0xFC,
-    0x00, 0x3F, 0x95, 0x0F, 0xF0, 0x01, 0xFF, 0xFC, 0x3F, 0x80, 0x0B, 0xFF, 0xD0, 0xFD, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8,
-    0x02, 0xA8, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF4, 0x07, 0xF4, 0x07, 0xF4, 0x0B, 0xF0,
-    0x0B, 0xF0, 0x0F, 0xF5, 0x5F, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x1F, 0xE5,
-    0x6F, 0xC0, 0x2F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0xFE, 0x3F, 0x40,
-    0x7F, 0xFC, 0x7F, 0x40, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xD0, 0x02, 0xF8, 0x7F, 0x00,
-    0x0F, 0xE2, 0xFC, 0x00, 0x7F, 0x4F, 0xF0, 0x01, 0xFC, 0x3F, 0x80, 0x0B, 0xF1, 0xFD, 0x00, 0x3F,
-    0xCB, 0xF0, 0x00, 0xFE, 0x2F, 0xC0, 0x07, 0xF4, 0xBF, 0x80, 0x7F, 0xC2, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x9F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x2A, 0x5F, 0xD0, 0x1F, 0xC7, 0xF0, 0x0B, 0xF2, 0xFC, 0x03,
-    0xFC, 0xFF, 0x01, 0xFE, 0x3F, 0x80, 0xFF, 0x4F, 0xF4, 0xBF, 0xC3, 0xFF, 0xFF, 0xF0, 0x7F, 0xFB,
-    0xF8, 0x06, 0xE4, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x0B, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0xFF,
-    0xF8, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x0F, 0xFD,
-    0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x0B,
-    0xEF, 0x80, 0x2F, 0xBF, 0x00, 0x3F, 0x7E, 0x00, 0xFE, 0xFC, 0x00, 0xFC, 0xFC, 0x0B, 0xDF, 0xE0,
-    0x07, 0xF3, 0xF0, 0x3F, 0x3F, 0x40, 0x2F, 0xCF, 0xC2, 0xF1, 0xFC, 0x00, 0xFE, 0x3F, 0x1F, 0x8B,
-    0xF0, 0x03, 0xF4, 0xFC, 0xFC, 0x2F, 0x80, 0x0F, 0xC3, 0xF7, 0xE0, 0xFE, 0x00, 0x7F, 0x0B, 0xFF,
-    0x03, 0xF4, 0x02, 0xF8, 0x2F, 0xF8, 0x1F, 0xD5, 0x0F, 0xE0, 0xBF, 0xC0, 0xBF, 0xFD, 0x3F, 0x42,
-    0xFE, 0x03, 0xFF, 0xF0, 0xFC, 0x07, 0xF0, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x0A,
-    0xA8, 0x00, 0xFF, 0xE0, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xC0, 0x0F, 0xFE, 0x02, 0xFF,
-    0xE0, 0x07, 0xFF, 0x80, 0xFF, 0xF4, 0x02, 0xFB, 0xF0, 0xBE, 0xFC, 0x00, 0xFD, 0xFC, 0x3F, 0x7F,
-    0x00, 0x3F, 0x3F, 0x2F, 0x6F, 0x80, 0x1F, 0xCF, 0xCF, 0xCF, 0xD0, 0x0B, 0xF3, 0xFB, 0xD3, 0xF4,
-    0x02, 0xF8, 0xBF, 0xF1, 0xFC, 0x00, 0xFD, 0x2F, 0xF4, 0xBF, 0xA8, 0x3F, 0x0B, 0xF8, 0x3F, 0xFE,
-    0x1F, 0xC2, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE,
-    0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00,
-    0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x0B, 0xD0, 0x7E, 0x00,
-    0x00, 0x7F, 0x6F, 0xC0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x0F, 0xEF, 0x80, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07, 0xF0, 0xFC,
-    0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0xBF,
-    0x95, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xF0, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03, 0xF8, 0x00,
-    0x07, 0xF0, 0x00, 0x14, 0x01, 0x40, 0x0F, 0xC0, 0xBD, 0x00, 0xBE, 0x1F, 0xC0, 0x03, 0xFF, 0xF0,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F,
-    0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0B,
-    0x40, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0xFE, 0xF8, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x1F, 0xC3, 0xF0, 0x00,
-    0x0F, 0xE0, 0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x02, 0xFE, 0x57, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xC0, 0x02,
-    0xFC, 0x0F, 0xE0, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x2D,
-    0x1A, 0x00, 0x0B, 0xE3, 0xF4, 0x00, 0xBE, 0x3F, 0x00, 0x01, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE4, 0x69, 0x03, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4, 0xFF, 0xC3, 0xFC, 0x07,
-    0xF8, 0x7F, 0x80, 0x7F, 0x4B, 0xF4, 0x07, 0xF0, 0xFF, 0x00, 0xBF, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF,
-    0x01, 0xFE, 0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEF, 0xC0, 0x1F, 0xF5, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFE, 0xBF, 0x55, 0x50, 0x00, 0x00,
-    0x3F, 0xCB, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xF4, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE5, 0x7F, 0xD5, 0x50, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x46, 0x5B, 0xE4, 0x00, 0xFF,
-    0xF7, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xC3, 0xFF, 0x81, 0xFC, 0x3F, 0xC0,
-    0x7F, 0x80, 0xBF, 0x1F, 0xE0, 0x1F, 0xD0, 0x7F, 0xCB, 0xF0, 0x07, 0xFF, 0xFF, 0xC3, 0xFC, 0x02,
-    0xFF, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x3F,
-    0xF0, 0x01, 0x02, 0xFF, 0xFF, 0xFF, 0xAB, 0xC0, 0x3F, 0xFE, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x7D,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x54, 0x00, 0x1F, 0x80, 0xFC,
-    0x00, 0x0F, 0xD7, 0xF4, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x55, 0x40,
-    0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xF5, 0x55, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x14, 0x01, 0x40, 0x0B, 0xD0, 0xBD, 0x00,
-    0xBE, 0x1F, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x01, 0xFE, 0x07, 0xF4, 0x3F, 0xC0, 0x7F, 0x07, 0xF4,
-    0x1F, 0xF0, 0xBF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xA5, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x10, 0x07, 0xFE, 0xAF, 0x40, 0x3F, 0xFF, 0xF4, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x7F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xEB, 0xFD, 0x3F, 0xE0, 0x03, 0xFC, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0x80, 0x1F, 0xF0, 0x3F, 0xC0,
-    0x7F, 0xD0, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x18, 0x02, 0xFE, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x1B, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x3F, 0xE5, 0xBF, 0x4F,
-    0xD0, 0x3F, 0xC7, 0xF0, 0x1F, 0xE0, 0xFE, 0x6F, 0xF0, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xB4, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x07, 0xF2, 0xF8, 0x00,
-    0x01, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x7F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xFF, 0xEB, 0xFD, 0x3F, 0xE0, 0x03, 0xFC, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0x80, 0x1F, 0xF0, 0x3F,
-    0xC0, 0x7F, 0xD0, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x40, 0x1F, 0xCB, 0xE0, 0x07, 0xF2, 0xF4, 0x00, 0x50, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x7F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x06, 0x00, 0xBF,
-    0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x06, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x8F, 0xF9, 0x6F,
-    0xD3, 0xF4, 0x0F, 0xF1, 0xFC, 0x07, 0xF8, 0x3F, 0x9B, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x01, 0xFC, 0x00,
-    0xFD, 0x02, 0xFD, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x1F, 0xE0, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0xFF,
-    0x00, 0x00, 0x0F, 0xD0, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0xBF, 0x40, 0x00, 0x00,
-    0x3F, 0x5F, 0xD7, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0xAF, 0xD0, 0x00,
-    0x00, 0x1F, 0xF1, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x4B, 0xF0, 0xFF, 0x00, 0x00, 0x0F, 0xF8,
-    0x3F, 0xC1, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0xFE, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xF4, 0x0F,
-    0xF0, 0x00, 0x3F, 0xD0, 0x1F, 0xC0, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xA0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x06, 0xA0, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0xBF, 0x02, 0xFF, 0xC0, 0x3F, 0xFC,
-    0x0F, 0xE0, 0xBF, 0xF8, 0x00, 0x2F, 0xD0, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x1F, 0xD2, 0xFC,
-    0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xF0, 0xBF,
-    0x00, 0x00, 0x0B, 0xF4, 0xBF, 0x0B, 0xF4, 0x00, 0x1B, 0xFE, 0x0F, 0xF0, 0x3F, 0xE8, 0x03, 0xFF,
-    0xC0, 0xFE, 0x02, 0xFF, 0xC0, 0x7F, 0xE0, 0x0F, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x42, 0x80, 0x00, 0x7F, 0x2F, 0x80, 0x01, 0xFC, 0xBD, 0x00, 0x01, 0x40,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8,
-    0x01, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0xAB, 0xFF, 0x80, 0x03, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x15, 0xBF, 0xD0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x14, 0x00, 0x3F, 0xD0, 0xBF, 0xAF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1E, 0x00,
-    0x2F, 0x8F, 0xC0, 0x0F, 0xD3, 0xF0, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE4, 0x00,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF8, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x05, 0x6F, 0xC0,
-    0x0B, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x56, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0xBE, 0xBF, 0xF8, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x55, 0x7F, 0xE0, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x24, 0x00, 0xBF, 0xC0, 0x3F, 0xEF, 0xFF, 0x40, 0x3F, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA8, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x2A, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x34, 0x02, 0xFF, 0x40, 0x3F, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0xA9, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x3F, 0xE0, 0x0F, 0xD0, 0x0B, 0xFE, 0x00, 0xFD, 0x01, 0xFF, 0xD0, 0x1F, 0xC0, 0x3F,
-    0xFC, 0x02, 0xFC, 0x0B, 0xFF, 0xC0, 0x3F, 0x80, 0xFE, 0xF8, 0x03, 0xF4, 0x3F, 0x7F, 0x80, 0x7F,
-    0x0B, 0xF3, 0xF4, 0x07, 0xF0, 0xFC, 0x7F, 0x00, 0xBF, 0x3F, 0x8B, 0xF0, 0x0F, 0xE7, 0xF0, 0xFE,
-    0x00, 0xFD, 0xFD, 0x0F, 0xD0, 0x1F, 0xFF, 0x80, 0xFD, 0x02, 0xFF, 0xF0, 0x1F, 0xC0, 0x3F, 0xFD,
-    0x02, 0xFC, 0x03, 0xFF, 0x80, 0x3F, 0x80, 0x3F, 0xF0, 0x03, 0xF4, 0x07, 0xFD, 0x00, 0x7F, 0x00,
-    0x00, 0x2A, 0xAA, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0,
-    0x0A, 0x90, 0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3,
-    0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B, 0xF0, 0x1F,
-    0xE0, 0xBF, 0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x28, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xBD,
-    0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xFE, 0x00, 0xFD,
-    0x00, 0xBF, 0xE0, 0x0F, 0xD0, 0x1F, 0xFD, 0x01, 0xFC, 0x03, 0xFF, 0xC0, 0x2F, 0xC0, 0xBF, 0xFC,
-    0x03, 0xF8, 0x0F, 0xEF, 0x80, 0x3F, 0x43, 0xF7, 0xF8, 0x07, 0xF0, 0xBF, 0x3F, 0x40, 0x7F, 0x0F,
-    0xC7, 0xF0, 0x0B, 0xF3, 0xF8, 0xBF, 0x00, 0xFE, 0x7F, 0x0F, 0xE0, 0x0F, 0xDF, 0xD0, 0xFD, 0x01,
-    0xFF, 0xF8, 0x0F, 0xD0, 0x2F, 0xFF, 0x01, 0xFC, 0x03, 0xFF, 0xD0, 0x2F, 0xC0, 0x3F, 0xF8, 0x03,
-    0xF8, 0x03, 0xFF, 0x00, 0x3F, 0x40, 0x7F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x2D, 0x0A, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0xBE, 0x3F, 0x40, 0x01, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xA9,
-    0x0F, 0xE0, 0x0F, 0xD1, 0xFD, 0x01, 0xFC, 0x1F, 0xC0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0,
-    0x3F, 0x83, 0xF8, 0x07, 0xF4, 0x7F, 0x40, 0xBF, 0x07, 0xF0, 0x0F, 0xF0, 0xBF, 0x01, 0xFE, 0x0B,
-    0xF0, 0x3F, 0xE0, 0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xDF, 0xC0, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xE0, 0xB4, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x01,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4,
-    0xBF, 0x40, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x0B,
-    0xF6, 0xFD, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47, 0xFC, 0x00,
-    0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1E, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3,
-    0xF0, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFC, 0x2F, 0xF0, 0xFF, 0x0F, 0xF0, 0x1F, 0xD7, 0xF4, 0x03, 0xFA, 0xFC, 0x00, 0xFD, 0xFF, 0x00,
-    0x7F, 0x7F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F, 0xF2, 0xFC, 0x0B, 0xF4, 0x7F, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFD, 0x00,
-    0x2F, 0xC1, 0xFE, 0x00, 0x07, 0xF4, 0xBF, 0x00, 0x00, 0xFD, 0x3F, 0xEA, 0xAA, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFD, 0x55, 0x57, 0xFC, 0xBF, 0x00, 0x00, 0xFF, 0x1F,
-    0xD0, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x7F, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0,
-    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0xBF, 0x82, 0xFC, 0x3F, 0xC0, 0x3F, 0x5F, 0xD0, 0x0F,
-    0xEB, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0x55, 0xFF, 0x3F, 0xC0, 0x3F, 0xCB, 0xF0, 0x2F,
-    0xD1, 0xFF, 0xBF, 0xF0, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xD1, 0xA0, 0x00, 0x02, 0xF8, 0xFD, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x05, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x2F, 0xC1, 0xFE, 0x00, 0x07, 0xF4, 0xBF, 0x00, 0x00,
-    0xFD, 0x3F, 0xEA, 0xAA, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFD, 0x55,
-    0x57, 0xFC, 0xBF, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x3F, 0xC0, 0xFF,
-    0x40, 0x7F, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2D, 0x00, 0x3F, 0x1F, 0xC0, 0x0F, 0xC7, 0xE0, 0x01, 0x40,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x2F, 0xE0,
-    0xBF, 0x0F, 0xF0, 0x0F, 0xD7, 0xF4, 0x03, 0xFA, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0xD5,
-    0x7F, 0xCF, 0xF0, 0x0F, 0xF2, 0xFC, 0x0B, 0xF4, 0x7F, 0xEF, 0xFC, 0x0B, 0xFF, 0xFC, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x07, 0x80, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x01, 0x90, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x6A, 0xAB, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xF4, 0x00, 0xAA, 0xAF, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F,
-    0xC0, 0x60, 0x01, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x28, 0x02, 0xFC, 0xFD, 0x02, 0xF8, 0xFC, 0x00, 0x50,
-    0x14, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF0, 0x00, 0x07, 0xF8,
-    0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x01, 0x5B, 0xF8, 0x00,
-    0x07, 0xF4, 0x00, 0x1F, 0xF0, 0x7A, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xAA, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x0B, 0xF4, 0x03, 0xF4, 0x00, 0xFF,
-    0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0xFD,
-    0x1F, 0xE0, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xA0, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0xAA, 0x00, 0xBF,
-    0x00, 0x7F, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x07, 0xF0, 0x1F, 0xE0, 0x00, 0xFD, 0x0B, 0xF0, 0x00,
-    0x3F, 0x43, 0xF8, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x02, 0xF8, 0xFD, 0x00, 0x00, 0xBE, 0xBF, 0x00,
-    0x00, 0x1F, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x81, 0xE0, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x14, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0xBF, 0x40, 0x3F,
-    0x40, 0x0F, 0xF0, 0x03, 0xF8, 0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x01, 0xFC, 0x0B, 0xF0,
-    0x00, 0x0F, 0xD1, 0xFE, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x0B, 0xF7, 0xF4, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x81, 0xE0, 0x00,
-    0x03, 0xF4, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x2A, 0x80, 0x2F, 0xC0, 0x1F, 0xE0, 0x07, 0xF0, 0x0F, 0xF0, 0x01, 0xFC, 0x07,
-    0xF8, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x00, 0xBE,
-    0x3F, 0x40, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x07, 0xEF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x0B, 0xF4, 0x03, 0xF4, 0x00, 0xFF, 0x00, 0x3F,
-    0x80, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0xFD, 0x1F, 0xE0,
-    0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFC,
-    0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x7E, 0x0F, 0x80, 0x00, 0x0F, 0x42, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA8, 0x00, 0xAA, 0x00, 0x2F, 0xC0, 0x1F, 0xE0, 0x01, 0xFC, 0x03, 0xFC, 0x00,
-    0x1F, 0xC0, 0x7F, 0x80, 0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0xFE, 0x2F,
-    0xC0, 0x00, 0x0B, 0xE3, 0xF4, 0x00, 0x00, 0xBE, 0xBF, 0x00, 0x00, 0x07, 0xEF, 0xD0, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0B, 0x40,
-    0x00, 0xFD, 0x7F, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x01, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xE1, 0xFD, 0x00, 0x3F, 0x8B, 0xF0, 0x01, 0xFD, 0x3F, 0xC0, 0x0B, 0xF0, 0xFE, 0x00,
-    0x3F, 0xC7, 0xF4, 0x00, 0xFE, 0x1F, 0xD0, 0x07, 0xF4, 0xBF, 0x40, 0x2F, 0xD1, 0xFF, 0x96, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xBE, 0xBF, 0x40, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x78, 0x2D, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0xFC, 0x7F, 0x00, 0x01, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x01, 0xA8, 0x2F, 0xC0, 0x2F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F,
-    0x80, 0x3F, 0x83, 0xF8, 0x0B, 0xF4, 0x3F, 0x40, 0xFF, 0x03, 0xFC, 0x3F, 0xF0, 0x3F, 0xFF, 0xFE,
-    0x02, 0xFF, 0xEF, 0xD0, 0x07, 0xE1, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x1F, 0xE5, 0x54, 0x0B, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x82, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x00,
-    0x1F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0xFF, 0x50,
-    0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0x80, 0x1F, 0xFF, 0xFE, 0x01, 0xFD, 0x00, 0xBF,
-    0xAF, 0xFC, 0x0B, 0xF4, 0x03, 0xFC, 0x0B, 0xF8, 0x3F, 0xC0, 0x0F, 0xE0, 0x1F, 0xE0, 0xFF, 0x00,
-    0x7F, 0x40, 0x7F, 0x43, 0xF8, 0x01, 0xFD, 0x03, 0xFD, 0x1F, 0xD0, 0x0B, 0xF0, 0x2F, 0xF0, 0xBF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x43, 0xFC, 0x00, 0xFF, 0xFF, 0xF4, 0x0F, 0xF0, 0x07, 0xFF, 0xFD, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x68, 0x1E, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00,
-    0xA9, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x02, 0xFC,
-    0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x0F, 0xFF, 0xF4, 0x03, 0xF8, 0x0F, 0xFF, 0xFE, 0x07, 0xF4, 0x1F,
-    0xFA, 0xFF, 0x07, 0xF0, 0x2F, 0xC0, 0x7F, 0x4B, 0xF0, 0x3F, 0xC0, 0x7F, 0x4F, 0xF0, 0x3F, 0xC0,
-    0xBF, 0x0F, 0xE0, 0x2F, 0xE6, 0xFF, 0x1F, 0xD0, 0x0F, 0xFF, 0xFC, 0x2F, 0xC0, 0x03, 0xFF, 0xE0,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x05, 0xFF, 0x54, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xAA, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFF, 0xA4, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xE5, 0x54, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x00, 0x0F,
-    0xE0, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF3, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x8F, 0xE0, 0x00,
-    0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x07, 0xFE, 0xA0, 0x0B, 0xF8, 0x03, 0xFF, 0xF0, 0x1F,
-    0xF0, 0x03, 0xFF, 0xE0, 0x3F, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xAA,
-    0x00, 0x2F, 0xC0, 0xBF, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xE7, 0xF4, 0x00, 0x0F, 0xF0, 0xFF, 0xFC, 0x0F,
-    0xF0, 0x3F, 0xFE, 0x0F, 0xF4, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x00, 0x1F, 0xD0, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00,
-    0x07, 0xF2, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xAB, 0xFF, 0xFA, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xAF, 0xFF, 0xEA, 0x00, 0x00, 0x2F, 0xEF,
-    0xD0, 0x00, 0x00, 0x7F, 0x8F, 0xF0, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x07, 0xF8,
-    0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00,
-    0x00, 0xAA, 0x00, 0xAA, 0x00, 0x2F, 0xC0, 0xBF, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x00, 0xFF, 0x3F,
-    0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x17, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x01, 0xBF, 0xFE, 0x90, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xE7, 0xF0, 0x00, 0x0F,
-    0xF0, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF4, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x0D, 0x2F, 0xFC, 0xA0, 0xD2, 0x8C, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28,
-    0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0xC0, 0x0F, 0xFE, 0x1C, 0x28, 0x1C, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00,
-    0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0x00, 0x05, 0x54, 0x3F, 0xFD, 0x7F, 0xFC,
-    0x7F, 0xFC, 0x05, 0x54, 0x3F, 0xFD, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFC, 0x6A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x6A, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xA8, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03,
-    0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB,
-    0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0,
-    0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D,
-    0x68, 0x02, 0x90, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF8, 0x6A, 0xAA, 0xA4, 0x02, 0xF0, 0x0F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F, 0x81, 0xFD, 0x01,
-    0x50, 0x00, 0x07, 0xF0, 0x3F, 0xC0, 0xFD, 0x0B, 0xE0, 0x3F, 0x01, 0xF8, 0x01, 0x40, 0x00, 0x03,
-    0xF8, 0x1F, 0xC0, 0xFE, 0x03, 0xF0, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC3, 0xF0,
-    0xFC, 0x2F, 0x0B, 0xC0, 0x50, 0x02, 0xF0, 0x3E, 0x03, 0xF0, 0xFC, 0x0F, 0xD1, 0xFC, 0x1F, 0xC3,
-    0xF4, 0x3F, 0x87, 0xF0, 0x7F, 0x4F, 0xE0, 0x15, 0x05, 0x40, 0x07, 0xF0, 0xFE, 0x0F, 0xE1, 0xFC,
-    0x0F, 0xC2, 0xF8, 0x2F, 0x83, 0xF0, 0x3F, 0x0B, 0xE0, 0x7E, 0x0F, 0xC0, 0x14, 0x05, 0x00, 0x03,
-    0xF8, 0xBF, 0x01, 0xFC, 0x3F, 0x80, 0xFE, 0x1F, 0xC0, 0x3F, 0x0B, 0xE0, 0x2F, 0x83, 0xF0, 0x0F,
-    0xC1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD7, 0xF0, 0xFD, 0x3F, 0x0F, 0xD3, 0xF0, 0xBD,
-    0x2F, 0x07, 0xE1, 0xF4, 0x3E, 0x05, 0x01, 0x40, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xE0,
-    0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x5A, 0x7E, 0x68, 0x00, 0xF0,
-    0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xAB, 0xEA, 0x80, 0x3F,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC0, 0x2A, 0xBD,
-    0xA8, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x0B, 0xF4, 0x2F, 0xFC, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x3F, 0xFD, 0x2F, 0xFC, 0x06, 0xA0,
-    0x08, 0x00, 0x0E, 0x00, 0x1F, 0xC0, 0x2F, 0xF0, 0x3F, 0xFC, 0x3F, 0xFD, 0x7F, 0xE0, 0xBE, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xFD, 0x3F, 0xD3, 0xFC, 0x04, 0x00, 0x2E, 0x00, 0x7D, 0xBF,
-    0x81, 0xFF, 0xFF, 0x82, 0xFF, 0xBF, 0x01, 0xFD, 0x14, 0x00, 0x10, 0x2E, 0x00, 0xB8, 0x02, 0xE2,
-    0xFE, 0x0B, 0xF4, 0x3F, 0xCF, 0xF8, 0x3F, 0xD0, 0xFF, 0x2F, 0xC0, 0xBF, 0x03, 0xF8, 0x14, 0x00,
-    0x50, 0x01, 0x00, 0x0B, 0x83, 0xFC, 0x3F, 0xC3, 0xF8, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xDA, 0x00,
-    0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00,
-    0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0,
-    0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x7E, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x3F,
-    0x5F, 0x8B, 0xE0, 0x02, 0xF8, 0x1F, 0xEF, 0xCF, 0xDF, 0xFF, 0x03, 0xFF, 0xC3, 0xFF, 0xDF, 0xCF,
-    0xEF, 0xD3, 0xFB, 0xF4, 0x7F, 0xCB, 0xD7, 0xF2, 0xF5, 0xFC, 0x7E, 0x00, 0x07, 0xE3, 0xF4, 0xBD,
-    0xBD, 0x1F, 0x80, 0x03, 0xF0, 0xFC, 0x2F, 0x7F, 0x0B, 0xD0, 0x03, 0xF0, 0x3F, 0x0F, 0xCF, 0xC3,
-    0xF0, 0x02, 0xF4, 0x0F, 0xC3, 0xF3, 0xF0, 0xFC, 0x01, 0xF8, 0x03, 0xF7, 0xF4, 0xFD, 0xFD, 0x00,
-    0xFC, 0x00, 0xBF, 0xFC, 0x2F, 0xFF, 0x00, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F,
-    0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x3F, 0x5F, 0x8B, 0xE0, 0x02, 0xF8, 0x00, 0xBE, 0x07, 0xFB, 0xF3, 0xF7, 0xFF, 0xC0,
-    0xFF, 0xF0, 0x3F, 0xFC, 0x3F, 0xFD, 0xFC, 0xFE, 0xFD, 0x3F, 0xBF, 0x4F, 0xFF, 0xD1, 0xFF, 0x2F,
-    0x5F, 0xCB, 0xD7, 0xF1, 0xF9, 0xFC, 0x7E, 0x00, 0x07, 0xE3, 0xF4, 0xBD, 0xBD, 0x1F, 0xAF, 0x47,
-    0xE0, 0x00, 0xFC, 0x3F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0x00, 0x3F, 0x03, 0xF0, 0xFC, 0xFC,
-    0x3F, 0x3F, 0x0F, 0xD0, 0x0B, 0xD0, 0x3F, 0x0F, 0xCF, 0xC3, 0xF3, 0xF0, 0xFC, 0x01, 0xF8, 0x03,
-    0xF7, 0xF4, 0xFD, 0xFD, 0x3F, 0x7F, 0x80, 0x3F, 0x00, 0x2F, 0xFF, 0x0B, 0xFF, 0xC2, 0xFF, 0xF0,
-    0x0F, 0xC0, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xF8, 0x03, 0xF0, 0x0B, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x28,
-    0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x1F, 0x82, 0xF4, 0x03, 0xF0, 0x7F, 0x00, 0xBD, 0x0F, 0xC0, 0x0F,
-    0x81, 0xF4, 0x03, 0xF0, 0x3E, 0x00, 0x28, 0x06, 0x80, 0x00, 0x00, 0xFD, 0x0F, 0xC1, 0xF8, 0x01,
-    0xF8, 0x2F, 0x43, 0xF0, 0x03, 0xF0, 0x7F, 0x0B, 0xE0, 0x0B, 0xD0, 0xFC, 0x0F, 0xC0, 0x0F, 0x81,
-    0xF4, 0x2F, 0x00, 0x3F, 0x03, 0xE0, 0x7D, 0x00, 0x28, 0x06, 0x80, 0x68, 0x00, 0x2F, 0x40, 0x7F,
-    0x00, 0xFD, 0x00, 0xF8, 0x02, 0xF0, 0x03, 0xD0, 0x06, 0x40, 0x2F, 0x43, 0xF0, 0x07, 0xF0, 0xBE,
-    0x00, 0xFD, 0x0F, 0xC0, 0x0F, 0x81, 0xF4, 0x02, 0xF0, 0x3F, 0x00, 0x3D, 0x07, 0xC0, 0x06, 0x40,
-    0xA4, 0x2F, 0x43, 0xF0, 0x7F, 0x00, 0x7F, 0x0B, 0xE0, 0xFD, 0x00, 0xFD, 0x0F, 0xC1, 0xFC, 0x00,
-    0xF8, 0x1F, 0x42, 0xF0, 0x02, 0xF0, 0x3F, 0x03, 0xE0, 0x03, 0xD0, 0x7C, 0x0B, 0xC0, 0x06, 0x40,
-    0xA4, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x03, 0xDC, 0x02, 0xC7,
-    0x41, 0xE0, 0xE0, 0xF0, 0x38, 0xB4, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x40, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x7F,
-    0x00, 0x09, 0x00, 0x00, 0x40, 0x0B, 0xC0, 0x0F, 0xE0, 0x0B, 0xF0, 0x03, 0xF8, 0x03, 0xFC, 0x03,
-    0xFC, 0x0F, 0xF0, 0x2F, 0xD0, 0xBF, 0x40, 0x7E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x80, 0x0F, 0xC0, 0x08, 0x00, 0xFC, 0x07, 0xF4, 0x0B, 0xC0, 0x3F, 0xC0, 0xFC, 0x0B, 0xF0,
-    0x03, 0xFC, 0x04, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x1A, 0x03, 0xFF, 0xF0, 0x29, 0x0F, 0xE0, 0x3F, 0xF0, 0x1F, 0xC3,
-    0xF8, 0x0B, 0xFC, 0x07, 0xF4, 0xBC, 0x0B, 0xFF, 0xC0, 0xF8, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00,
-    0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x0B,
-    0xF0, 0x2F, 0x03, 0xF8, 0x03, 0xF0, 0x1F, 0xD0, 0x3F, 0x00, 0x30, 0x07, 0xF4, 0x03, 0x40, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x0B, 0xF8, 0x2F, 0xD0, 0x2F, 0xD0, 0xFF, 0x00,
-    0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xE0, 0x0F, 0xE0, 0x7F, 0x40, 0x7F, 0x41, 0xFC, 0x02, 0xFC,
-    0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0x80, 0x3F, 0x80, 0xFD, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF0, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0x80, 0x1F, 0xE0, 0xBF, 0x40,
-    0xBF, 0x83, 0xFD, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x0B, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x3F, 0xE7, 0xF4, 0x2F, 0x4F, 0xC0, 0xFC, 0x7F, 0x03,
-    0xF7, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0xF8, 0x01, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x40, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x00,
-    0x05, 0x00, 0x00, 0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x38, 0x00, 0x03, 0x81, 0xE0, 0x01, 0xE0, 0x0B, 0xEA, 0xF8,
-    0x00, 0x1B, 0xF9, 0x00, 0x00, 0x6F, 0x90, 0x00, 0xFF, 0xFF, 0x00, 0xF4, 0x01, 0xE0, 0xE0, 0x00,
-    0x1D, 0xA0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0xF7, 0x40, 0x00, 0x3C, 0x34, 0x00, 0x07, 0x83, 0x80, 0x00, 0xF0, 0x3C, 0x00,
-    0x3D, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE5, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC1, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0B, 0x0B, 0xE0, 0x64, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0xD0,
-    0x1F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0xE0, 0xF8, 0x00, 0x03, 0xD2, 0xF0,
-    0x00, 0xFF, 0xBD, 0x00, 0x02, 0xFE, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFD, 0xA8, 0x00, 0x3F, 0xF5, 0xA0, 0x1F, 0xEF,
-    0x00, 0x00, 0x3F, 0xBD, 0x00, 0x0F, 0xD3, 0xE0, 0x00, 0x3F, 0x8F, 0xC0, 0x01, 0xF0, 0xFC, 0x00,
-    0x03, 0xC2, 0xF4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xE0, 0x07, 0xFA, 0x40,
-    0x2F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xE4, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xE0, 0x07, 0xF5, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xEA, 0x00, 0x3F, 0xF8,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xD0, 0x06, 0xBF, 0x00, 0x00, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x05, 0xBE, 0x00,
-    0x7F, 0xF8, 0x01, 0xFF, 0xD0, 0x01, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x0A, 0xFE, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFD, 0x02, 0xFF, 0xFF, 0x8B,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x0E, 0x02, 0xFD, 0x38, 0x0B, 0xF4, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00,
-    0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xD2, 0xFF, 0xFF,
-    0x80, 0xFF, 0x07, 0xFF, 0xFF, 0x03, 0xFC, 0x0E, 0x02, 0xFD, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x7F,
-    0x40, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x02, 0xFE, 0x0B, 0xF0, 0x00, 0x7F, 0xE0, 0x3F, 0x80, 0x07,
-    0xFD, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x2E, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x01, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x02, 0xFF, 0xD0, 0x02, 0xFE, 0x1F,
-    0xFF, 0xF8, 0x02, 0xFD, 0x0F, 0xFF, 0xFC, 0x03, 0xFC, 0x0E, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0x00,
-    0xFD, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x07, 0xF4, 0x00, 0x0B, 0xF8, 0x0B, 0xF0, 0x00, 0x3F, 0xF0,
-    0x0B, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xE0, 0x03, 0xFD, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x0F,
-    0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x0B, 0x80, 0x00, 0x7F, 0x80, 0x2F, 0xD0, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0x2F,
-    0xC0, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
-    0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F,
-    0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFC,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF0, 0x79, 0xBF, 0xFF, 0x87,
-    0x87, 0xFF, 0xFC, 0x78, 0x7F, 0xFF, 0xD7, 0x87, 0xFF, 0xFD, 0x78, 0x7F, 0xFF, 0xD7, 0x87, 0xFF,
-    0xFD, 0x78, 0x7F, 0xFF, 0xC7, 0x87, 0xFF, 0xFC, 0x78, 0x7F, 0xFF, 0x47, 0x87, 0xFF, 0xD0, 0x78,
-    0x79, 0x50, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00,
-    0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x80, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xEB,
-    0xC3, 0xFF, 0xFC, 0x3C, 0x7F, 0xFF, 0xC3, 0xCB, 0xFF, 0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xCB, 0xFF,
-    0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xC7, 0xFF, 0xFC, 0x3C, 0x3F, 0xFF, 0xD7, 0xC1, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xC0, 0x2A, 0xAA, 0xA4, 0x03, 0xFF, 0xFF, 0xF0, 0x3E, 0xBF, 0xFF, 0xC3, 0xC3,
-    0xFF, 0xFD, 0x3C, 0x3F, 0xFF, 0xE3, 0xC3, 0xFF, 0xFE, 0x3C, 0x3F, 0xFF, 0xE3, 0xC3, 0xFF, 0xFE,
-    0x3C, 0x3F, 0xFF, 0xE3, 0xC3, 0xFF, 0xFD, 0x3D, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x40, 0x3D, 0x00, 0x3E,
-    0x1F, 0x00, 0x1F, 0xFF, 0xD5, 0x41, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x03, 0xFF, 0x45, 0x03,
-    0xFB, 0xF0, 0x02, 0xFC, 0xBD, 0x00, 0x1C, 0x1F, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x01, 0xF4, 0x0F,
-    0xF0, 0x7F, 0xC0, 0xFD, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0x90, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF4, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x1D, 0x00, 0xA0,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x03, 0x80, 0x00, 0x38, 0x00, 0x78,
-    0x00, 0x78, 0x00, 0x0B, 0xEA, 0xF8, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x80, 0xBC, 0x00, 0x01, 0xF8, 0xBC, 0x00,
-    0x02, 0xFF, 0xF9, 0x58, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFC, 0x14,
-    0x00, 0x7F, 0x7E, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x28, 0x2F, 0x40, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x14, 0x0F, 0x80, 0x00,
-    0x3F, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0x55, 0x40, 0x1B, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0x45, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x1F, 0xCB, 0xD0, 0x00, 0x07, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xDF, 0xF4, 0x3F, 0x3F, 0xC1, 0xF4, 0x3E,
-    0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0xB8,
-    0x3F, 0x0B, 0xF5, 0xF8, 0x2F, 0xDB, 0xD0, 0x7F, 0x00, 0x00, 0x10, 0x00, 0xAA, 0x40, 0x00, 0x00,
-    0x14, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x7C, 0x3F, 0xFF, 0xFF, 0xFF, 0xEB, 0xF8, 0x7E, 0x41, 0xAF,
-    0xFF, 0xFF, 0xF0, 0xB8, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x0B, 0xFF, 0xC0, 0x03, 0xE4, 0x1F, 0x00, 0xE0, 0x00, 0x3C, 0x28, 0x00, 0x00,
-    0xC2, 0x00, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x00, 0x10, 0xF4, 0x40, 0x0F, 0x8F, 0x5F, 0x00, 0xFE,
-    0xFB, 0xF0, 0x03, 0xFF, 0xFC, 0x01, 0x6F, 0xFF, 0x95, 0xBF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFE,
-    0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xDF, 0x7F, 0x40, 0x70, 0xF4, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x64, 0x00, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0x07, 0xE1, 0xF8, 0x7F, 0x1F, 0xC0, 0x3F, 0x0F, 0xC3,
-    0xF0, 0xFC, 0x02, 0xF4, 0xBD, 0x2F, 0x4B, 0xD0, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x00, 0xFC, 0x3F,
-    0x0F, 0xC3, 0xF0, 0x02, 0x80, 0xA0, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x02, 0xF6, 0xFD, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x7F, 0xCF, 0xC0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x41, 0xFC, 0x00,
-    0x00, 0x0F, 0xEB, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0xFF, 0x19, 0x00, 0x00, 0x01,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x14, 0x7F, 0x40, 0x00, 0x03, 0xFA, 0xFE, 0x00, 0x00, 0x1F, 0xF7, 0xF4,
-    0x00, 0x00, 0x3F, 0x86, 0x40, 0x00, 0x00, 0x24, 0x04, 0x1F, 0xCB, 0xFA, 0xFD, 0x2A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xBF, 0x6F, 0xE7, 0xF4,
-    0x50, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x54, 0x7F, 0x40, 0x01, 0xFD, 0xBF, 0x80, 0x02, 0xFE, 0x7F, 0x40, 0x01,
-    0xFD, 0x19, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02,
-    0xE0, 0x3F, 0x02, 0xE0, 0x0B, 0xF4, 0x3F, 0x0B, 0xF4, 0x0B, 0xF4, 0x3F, 0x0B, 0xF4, 0x07, 0xF0,
-    0x3F, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x15, 0x55, 0x7F,
-    0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0x7F, 0x55,
-    0x55, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x07, 0xE0,
-    0x0B, 0xF4, 0x3F, 0x0F, 0xF4, 0x0B, 0xF4, 0x3F, 0x0F, 0xF4, 0x03, 0xF0, 0x3F, 0x07, 0xE0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x1F, 0xE7, 0xF8, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x3F, 0x5F, 0xF7, 0xF8, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x68, 0x7F, 0xAF, 0xE7,
-    0xF4, 0x14, 0x05, 0x0F, 0xE7, 0xFC, 0xFF, 0x09, 0x01, 0x43, 0xF9, 0xFF, 0x3F, 0xC2, 0x40, 0x40,
-    0xFE, 0x7F, 0xCF, 0xF0, 0x90, 0x10, 0x3F, 0x9F, 0xF3, 0xFC, 0x28, 0x00, 0x0B, 0xFE, 0x0A, 0x00,
-    0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x3F, 0xC1, 0xF4, 0x0F, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x0F, 0x02, 0xF8, 0x3F, 0xCB, 0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x35, 0xCA, 0x0A, 0x2A, 0x80, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0xFF, 0xC0, 0xFF, 0xF8, 0xBE, 0x7F, 0x3F, 0x0F, 0xDF, 0x83, 0xFB, 0xD1,
-    0xFE, 0xF4, 0xBE, 0xBD, 0x3F, 0x1F, 0xFF, 0x83, 0xFF, 0xC0, 0x2F, 0x80, 0x01, 0x80, 0x3E, 0x01,
-    0x80, 0x14, 0x0B, 0xC0, 0xF8, 0x0F, 0x40, 0xF0, 0x1F, 0x02, 0xF0, 0x3E, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0xBD, 0xF8, 0x1F, 0x1F, 0x43,
-    0xE7, 0xF4, 0xBF, 0xFF, 0xDB, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x03, 0xFF, 0xD0, 0x7C, 0x00, 0x0F, 0x90, 0x00, 0xFF, 0xF0, 0x0A, 0xBF, 0x80, 0x00, 0xFC,
-    0x00, 0x0F, 0x82, 0x57, 0xF4, 0x3F, 0xFE, 0x01, 0xBE, 0x40, 0x00, 0x05, 0x00, 0xBF, 0xF0, 0xFF,
-    0xF8, 0xBD, 0x00, 0x3E, 0x10, 0x1F, 0xBF, 0x8B, 0xFB, 0xF2, 0xF0, 0x7D, 0xBC, 0x1F, 0x5F, 0x9F,
-    0xC3, 0xFF, 0xD0, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x01, 0xFC, 0x00,
-    0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x40,
-    0x02, 0x90, 0x00, 0x00, 0x14, 0x00, 0x1F, 0xFC, 0x07, 0xFB, 0xE0, 0xBC, 0x3E, 0x07, 0xE7, 0xD0,
-    0x3F, 0xF4, 0x07, 0xFF, 0x42, 0xF9, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F, 0xFF, 0x40, 0x7F,
-    0x90, 0x00, 0x50, 0x02, 0xFF, 0x82, 0xFF, 0xF4, 0xFC, 0x3E, 0x3D, 0x0F, 0xCF, 0x87, 0xF3, 0xFF,
-    0xF8, 0x2E, 0xBD, 0x00, 0x3F, 0x15, 0xBF, 0x4B, 0xFF, 0x41, 0xF9, 0x00, 0x00, 0x80, 0x00, 0x74,
-    0x00, 0x1D, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x74, 0x00, 0x1D, 0x00, 0x02, 0x00, 0x2A, 0xAA,
-    0x0F, 0xFF, 0xC0, 0x55, 0x54, 0xFF, 0xFD, 0x55, 0x54, 0x55, 0x54, 0xFF, 0xFD, 0x55, 0x54, 0x00,
-    0x00, 0x2D, 0x07, 0x80, 0xF0, 0x2D, 0x03, 0xC0, 0x78, 0x0B, 0x40, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-    0x40, 0xB4, 0x03, 0x80, 0x14, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-    0xC0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x02, 0xE0, 0x0F, 0x00, 0xF0, 0x05, 0x00,
-    0x00, 0x01, 0x05, 0x00, 0xB7, 0xFC, 0x0F, 0xD7, 0xD0, 0xF8, 0x3C, 0x1F, 0x07, 0xC2, 0xF0, 0xBC,
-    0x3E, 0x0F, 0x83, 0xD0, 0xF4, 0x3C, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x82,
-    0xFD, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7E, 0x0F, 0xC7, 0xE1, 0xF8, 0xBE, 0x3F, 0x47, 0xFF,
-    0xF0, 0x3F, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0xF0, 0x7F, 0xFC, 0x2F,
-    0xBE, 0x02, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0A,
-    0x80, 0x00, 0x05, 0x00, 0x2F, 0xFC, 0x07, 0xFF, 0xF0, 0x24, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBD,
-    0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x07, 0xF0, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xAA, 0xA4, 0x00,
-    0x14, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xE0, 0x10, 0x3E, 0x00, 0x07, 0xD0, 0x1F, 0xF4, 0x02, 0xFE,
-    0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC3, 0x96, 0xF8, 0x3F, 0xFF, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x0B, 0xFD, 0x01, 0xFF, 0xC0, 0x7D, 0xFC, 0x0F, 0x4F, 0x83, 0xF6,
-    0xF8, 0x3F, 0xFF, 0xE7, 0xFF, 0xFD, 0x00, 0x3F, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x0F, 0xFF, 0x80, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xFF, 0xD0, 0x1A, 0xBF, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x0A, 0x5B, 0xE0, 0xFF, 0xFC, 0x06, 0xF9, 0x00, 0x00, 0x05, 0x00, 0x1F, 0xFC, 0x0B, 0xFF,
-    0xC1, 0xF8, 0x00, 0x3F, 0x14, 0x03, 0xFF, 0xF0, 0x7F, 0xAF, 0x87, 0xD0, 0xF8, 0x7D, 0x0F, 0x83,
-    0xE7, 0xF0, 0x2F, 0xFE, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x00,
-    0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xF0, 0x00, 0xFC, 0x00,
-    0x2F, 0x40, 0x02, 0xA0, 0x00, 0x00, 0x10, 0x01, 0xFF, 0xC0, 0xFE, 0xFC, 0x7D, 0x3F, 0x1F, 0x9F,
-    0x82, 0xFF, 0x81, 0xFF, 0xD1, 0xF9, 0xFC, 0xFC, 0x2F, 0x7F, 0x0F, 0xC7, 0xFF, 0xE0, 0x6F, 0x90,
-    0x00, 0x10, 0x01, 0xFF, 0x81, 0xFF, 0xF8, 0xFC, 0x3F, 0x3E, 0x0B, 0xCF, 0xC7, 0xF3, 0xFF, 0xFC,
-    0x2F, 0x7E, 0x00, 0x3F, 0x15, 0xBF, 0x4B, 0xFF, 0x41, 0xFA, 0x00, 0x02, 0x40, 0x03, 0x80, 0x03,
-    0x80, 0xFF, 0xFD, 0xBF, 0xFD, 0x03, 0x80, 0x03, 0x80, 0x02, 0x40, 0xAA, 0xA8, 0xFF, 0xFD, 0x15,
-    0x54, 0xBF, 0xFE, 0x15, 0x54, 0x15, 0x54, 0xBF, 0xFE, 0x15, 0x54, 0x00, 0x00, 0x07, 0x80, 0x7C,
-    0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0xB4, 0x02, 0xD0, 0x0B, 0x40, 0x2E, 0x00,
-    0x78, 0x00, 0xF0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0F, 0x00, 0x3C, 0x00, 0xF4, 0x03,
-    0xD0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0xB4, 0x01, 0x40,
-    0x00, 0x03, 0xE3, 0xC0, 0xFF, 0xFC, 0x3F, 0x0F, 0x87, 0xD0, 0xF4, 0x7C, 0x0F, 0x0B, 0xC2, 0xF0,
-    0x7D, 0xBE, 0x03, 0xFF, 0xD0, 0x09, 0x14, 0x00, 0x02, 0xFD, 0x03, 0xFB, 0xC3, 0xE0, 0xF5, 0xF5,
-    0xFC, 0xBF, 0xF8, 0x2F, 0x00, 0x07, 0xD0, 0x80, 0xFF, 0xF0, 0x06, 0x90, 0x00, 0x02, 0xF8, 0x07,
-    0xFF, 0xC3, 0xE0, 0xF5, 0xF0, 0x3D, 0xBC, 0x0F, 0x6F, 0x07, 0xC7, 0xD7, 0xE0, 0xFF, 0xE0, 0x06,
-    0x50, 0x00, 0x02, 0xE0, 0xB8, 0x02, 0xF2, 0xF0, 0x00, 0xFB, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0xBE,
-    0x00, 0x02, 0xFF, 0x00, 0x07, 0xCF, 0x80, 0x1F, 0x4B, 0xC0, 0x15, 0x01, 0x40, 0x0B, 0xF8, 0x0B,
-    0xFF, 0x80, 0x02, 0xF0, 0x06, 0xBC, 0x3F, 0xFF, 0x2F, 0x0F, 0x8F, 0x8B, 0xC2, 0xFF, 0xD0, 0x1A,
-    0x40, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x7D, 0xF8, 0x07, 0xFF, 0xD0, 0xBC,
-    0x3E, 0x0F, 0x83, 0xD0, 0xF0, 0x3C, 0x1F, 0x07, 0xC2, 0xE0, 0xBC, 0x3E, 0x0F, 0x81, 0x40, 0x50,
-    0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x7C, 0x0B, 0xC7, 0xD0, 0x3E, 0x7C,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xBD, 0x00, 0xB8, 0xBC, 0x03, 0xD0, 0xF4, 0x05, 0x01,
-    0x50, 0x02, 0xF0, 0x3E, 0x03, 0xD0, 0x7C, 0x07, 0xC0, 0xB8, 0x0F, 0x40, 0xF0, 0x1F, 0x02, 0xF0,
-    0x3E, 0x01, 0x40, 0x03, 0x5F, 0x87, 0xE0, 0x2F, 0xFF, 0xBF, 0xD0, 0xBC, 0x3F, 0x0F, 0x43, 0xE0,
-    0xF8, 0x3D, 0x0F, 0x03, 0xC0, 0xF0, 0x7C, 0x1F, 0x07, 0xC2, 0xF0, 0xB8, 0x2E, 0x0F, 0x83, 0xE0,
-    0xF4, 0x14, 0x05, 0x01, 0x40, 0x0E, 0x7E, 0x07, 0xFF, 0xE2, 0xF4, 0xF8, 0xF8, 0x3E, 0x3D, 0x0F,
-    0x5F, 0x07, 0xCB, 0xC1, 0xF3, 0xE0, 0xB8, 0x50, 0x14, 0x00, 0x03, 0x9F, 0x80, 0x7F, 0xFD, 0x0B,
-    0xC3, 0xE0, 0xF4, 0x3E, 0x0F, 0x03, 0xD1, 0xF0, 0x7C, 0x2F, 0x9F, 0x83, 0xFF, 0xF0, 0x3D, 0x64,
-    0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0x07, 0xF8, 0x1F, 0xBD, 0x2F, 0x00, 0x1F, 0xD0,
-    0x07, 0xF4, 0x00, 0xFC, 0x50, 0xFC, 0xBF, 0xF4, 0x1A, 0x40, 0x01, 0x40, 0x1E, 0x02, 0xFF, 0x5F,
-    0xFD, 0x1F, 0x00, 0xB8, 0x03, 0xD0, 0x0F, 0x00, 0x7D, 0x40, 0xFF, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xE0, 0x10, 0x03,
-    0xFC, 0x00, 0x00, 0x7F, 0x41, 0x55, 0x57, 0xF0, 0xBF, 0xFE, 0xBF, 0x0F, 0xFF, 0xDB, 0xF0, 0xFE,
-    0x54, 0x7F, 0x4F, 0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0x1D, 0x00, 0x00, 0x1E, 0x2C, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xF1, 0xF4, 0x0B, 0xFD, 0xE2, 0xC0, 0x0F, 0xF2, 0xC3,
-    0x80, 0x2F, 0xD3, 0x8B, 0x40, 0x3F, 0xCB, 0x4F, 0x00, 0x3F, 0xCF, 0x1E, 0x00, 0x3F, 0x9E, 0x2C,
-    0x00, 0x3F, 0xAC, 0x3C, 0x00, 0x3F, 0xFC, 0xB4, 0x00, 0x3F, 0xF4, 0xF1, 0x00, 0x1F, 0xFE, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xDF, 0x90, 0x00, 0x07, 0x4F, 0x00,
-    0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x40, 0xB4, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xC1, 0xF1, 0xF0, 0x3F, 0xC2, 0xF7, 0xE0, 0x3F, 0xC3, 0xFF,
-    0xD0, 0x3F, 0x83, 0xF8, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x3F, 0xCB, 0xE0,
-    0x00, 0x2F, 0xEF, 0xD6, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF,
-    0x40, 0x3F, 0xD5, 0x54, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0xAA, 0x90, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFD, 0x00, 0x7F, 0x95, 0x50, 0x02, 0xFC,
-    0x00, 0x00, 0x1F, 0xF5, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x08, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0A, 0xFF, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0xAF, 0xFA, 0xA0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1A, 0x0B, 0xE0, 0xFF, 0xE0,
-    0x03, 0xF3, 0xFF, 0xEF, 0xFF, 0x80, 0x3F, 0xBF, 0xFF, 0xFF, 0xFC, 0x07, 0xFE, 0x1F, 0xFD, 0x2F,
-    0xD0, 0xBF, 0xC0, 0xFF, 0x41, 0xFD, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xC0, 0xFF, 0x01, 0xFD, 0x02,
-    0xFC, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0xC1, 0xFD, 0x03, 0xFC, 0x03, 0xF8, 0x2F, 0xC0, 0xFF, 0x80,
-    0x7F, 0x43, 0xFC, 0x2F, 0xF8, 0x07, 0xF0, 0x3F, 0x83, 0xFF, 0x40, 0xBF, 0x03, 0xF4, 0xFF, 0xF0,
-    0x0F, 0xF0, 0x7F, 0x2F, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBC, 0x00, 0xFF, 0x40, 0xF8,
-    0x01, 0xFF, 0x41, 0xF4, 0x01, 0xFF, 0x41, 0xF4, 0x02, 0xFF, 0x82, 0xF0, 0x03, 0xEB, 0x83, 0xF0,
-    0x1B, 0xFF, 0xEB, 0xF8, 0x2F, 0xFF, 0xFF, 0xFC, 0x0B, 0xDB, 0xCB, 0xD0, 0x0B, 0xC7, 0xCF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0x43, 0xDF, 0x40, 0x2F, 0x03, 0xEF, 0x00,
-    0x3F, 0x03, 0xFF, 0x00, 0x3F, 0x03, 0xFE, 0x00, 0x3E, 0x03, 0xFE, 0x00, 0x7D, 0x03, 0xFD, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x0F, 0xD6, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x0B,
-    0x80, 0x03, 0xF8, 0x0F, 0xF1, 0xF4, 0x00, 0x3F, 0x41, 0xFE, 0x3F, 0x54, 0x07, 0xFA, 0xFF, 0xDF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xF7, 0xFF, 0xF8, 0x0B, 0xFF, 0xFD, 0x0F, 0xE0, 0x00, 0xFF, 0xA5, 0x00,
-    0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x02, 0xFE, 0x90, 0x3F, 0x80, 0x00, 0x1F, 0xFE, 0x03, 0xF4, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x5F, 0xF4, 0x00, 0x00,
-    0x03, 0xFC, 0x1F, 0xD0, 0xBF, 0x90, 0x0F, 0xE0, 0x7F, 0x4F, 0xFF, 0xD0, 0x3F, 0x42, 0xFD, 0xFF,
-    0xFF, 0x01, 0xFC, 0x1F, 0xF3, 0xF4, 0x14, 0x0B, 0xFF, 0xFF, 0x4F, 0xD0, 0x00, 0x3F, 0xFF, 0xF4,
-    0x3F, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0xBF, 0xE0, 0x07, 0xF5, 0xFD, 0x00, 0xBF, 0xE0, 0x2F, 0xC3,
-    0xF8, 0x00, 0x7F, 0xC0, 0xBF, 0x0F, 0xF0, 0x00, 0x7F, 0x03, 0xF8, 0x2F, 0xC4, 0x01, 0xFC, 0x0F,
-    0xE0, 0x7F, 0x2E, 0x6F, 0xF0, 0x7F, 0x41, 0xFD, 0xBF, 0xFF, 0x42, 0xFC, 0x03, 0xF9, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x1F, 0x80, 0x7D, 0x07, 0xD0, 0x3F, 0x80,
-    0xBC, 0x07, 0xD0, 0x3F, 0x80, 0xFC, 0x07, 0xD0, 0xBF, 0x81, 0xF4, 0x07, 0xC0, 0xFF, 0x43, 0xF0,
-    0x07, 0xC1, 0xFB, 0x43, 0xE0, 0x0B, 0xC3, 0xEF, 0x47, 0xD0, 0x0B, 0xC3, 0xCF, 0x4F, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xDF, 0x0F, 0x3F, 0x00, 0x0F, 0xAF,
-    0x0F, 0x7D, 0x00, 0x0F, 0xBD, 0x0F, 0xBC, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x1F,
-    0xF4, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x0F, 0xD0, 0x1F, 0xC0,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xD0, 0x0B, 0xFF, 0xFF, 0x40, 0xBD, 0x00, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xE0, 0xFC, 0x01, 0xFC, 0x14, 0x7F, 0x1F, 0xC0, 0x2F, 0x8F, 0xD7,
-    0xF2, 0xF8, 0x02, 0xF4, 0xFC, 0x7E, 0x3F, 0x40, 0x3F, 0x1F, 0xCB, 0xE3, 0xF0, 0x03, 0xF2, 0xF8,
-    0xFD, 0x3F, 0x00, 0x7F, 0x2F, 0x4F, 0xC7, 0xE0, 0x0B, 0xE3, 0xF1, 0xFC, 0xBD, 0x00, 0xFD, 0x3F,
-    0x1F, 0x8F, 0xD0, 0x0F, 0xC7, 0xF2, 0xF4, 0xFC, 0x00, 0xFC, 0xBE, 0x15, 0x2F, 0x80, 0x1F, 0x8F,
-    0xD0, 0x07, 0xF4, 0x02, 0xF4, 0xFF, 0xAB, 0xFE, 0x00, 0x3F, 0x4F, 0xFF, 0xFF, 0x80, 0x03, 0xF1,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0x57, 0xF9, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xFD,
-    0x7F, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xFE, 0x0B, 0xF8, 0x00, 0xFE,
-    0x01, 0xFD, 0x00, 0xBF, 0x40, 0x7F, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x0F, 0xF0, 0x0F, 0xE0, 0x03,
-    0xFC, 0x03, 0xF4, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xEF, 0xC0,
-    0x00, 0x7F, 0xD3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x3F, 0xD0, 0x60, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0B, 0xFE, 0xA8, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0xA8, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x07, 0xF8, 0x01, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x7F, 0xC0, 0x0F,
-    0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0xD0, 0x01, 0xFC, 0x2F, 0xE0, 0x00, 0xBF, 0x1F, 0xE0, 0x00,
-    0x3F, 0xCF, 0xF0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xD4, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x0F, 0xE1, 0xFD, 0x00, 0x07, 0xF4, 0x3F,
-    0xC0, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x0F, 0xD0,
-    0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x05,
-    0x5F, 0xF5, 0x50, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0xDE, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x09,
-    0x7F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2E,
-    0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x14, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x6A, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x03,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x69, 0x00,
-    0x3F, 0xC0, 0x1F, 0xE1, 0xFF, 0xF4, 0x0F, 0xE0, 0x0B, 0xF0, 0xFF, 0xFF, 0x03, 0xF4, 0x03, 0xFC,
-    0xBE, 0x0B, 0xD1, 0xFC, 0x03, 0xFD, 0x3F, 0x01, 0xF4, 0xBF, 0x0B, 0xFE, 0x0F, 0xC0, 0xBD, 0x3F,
-    0xFF, 0xFE, 0x07, 0xF0, 0x7F, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0x87, 0xFF, 0xE4, 0x00, 0xFE,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x1F, 0x80, 0x00, 0x7F,
-    0x47, 0xE0, 0x00, 0x1F, 0xD2, 0xF4, 0x00, 0x07, 0xF4, 0xFC, 0x00, 0x01, 0xFD, 0xBE, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x20, 0x7F, 0xC0, 0x00,
-    0x1D, 0x1F, 0xF0, 0x00, 0x0F, 0x9F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xCF, 0xE0,
-    0x07, 0xCB, 0xC3, 0xFC, 0x03, 0xD1, 0xC0, 0xFF, 0x00, 0x00, 0x10, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFC, 0x2F, 0xD0, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0x2F,
-    0xFA, 0xAF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0xFF, 0xFF, 0x1B, 0x00, 0xFF, 0xCB, 0x80, 0x00, 0x7F, 0xC3, 0xD0, 0x00, 0x3F, 0xD0, 0xF0,
-    0x00, 0x0F, 0xF0, 0x3C, 0x00, 0x07, 0xF8, 0x1F, 0xFF, 0xC1, 0xFD, 0x0B, 0xFF, 0xF0, 0xBF, 0x43,
-    0xFF, 0xFC, 0x2F, 0xD0, 0xF0, 0xFE, 0x0B, 0xF4, 0x7C, 0x7F, 0x41, 0xFF, 0x1E, 0x2F, 0xC0, 0x3F,
-    0xEB, 0x4F, 0xF0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0x7F, 0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x06, 0xBF, 0xEB,
-    0xFE, 0x80, 0x03, 0xF8, 0x2F, 0x80, 0x06, 0xFF, 0xAB, 0xFE, 0x40, 0xFF, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFD, 0x56, 0xFD, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x1F,
-    0xD0, 0x2F, 0xC0, 0x00, 0xFD, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xA4, 0x1F, 0xF0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0xFF, 0x0A, 0xAA, 0xAF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xE0, 0xFF, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0F, 0xF0, 0x06, 0x80, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xBC, 0xB0, 0x0F, 0xF8, 0x78, 0x00, 0x1F, 0xF0, 0xB8,
-    0x00, 0x2F, 0xD0, 0xF4, 0x00, 0x3F, 0xC0, 0xF0, 0x00, 0x3F, 0x81, 0xF0, 0x00, 0x7F, 0x42, 0xE0,
-    0x00, 0x7F, 0x42, 0xD0, 0x00, 0x7F, 0x43, 0xD0, 0x00, 0x7F, 0x43, 0xC0, 0x00, 0x7F, 0xC7, 0xC0,
-    0x00, 0x3F, 0xEB, 0x86, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x19, 0x00, 0xA4, 0x00, 0x03, 0xE0,
-    0x1F, 0x40, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0xFA, 0xFF, 0xA8, 0x1F, 0xFF, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xF8, 0x2F, 0xD0, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x07, 0xF0, 0x3F,
-    0xC0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0xFE, 0x07, 0xF0, 0x00, 0x1F,
-    0xD0, 0xBF, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0xFC, 0x03, 0xF8, 0x0B, 0xFF,
-    0xC0, 0x3F, 0x40, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0x41, 0x90, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x78, 0x68, 0x78, 0xFD, 0x07, 0xFF, 0xFB, 0xF3,
-    0xF4, 0x2D, 0xF2, 0xF3, 0xDF, 0xC0, 0x7F, 0xCB, 0x4F, 0xFE, 0x00, 0xBF, 0xFE, 0xBF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xC7, 0xCB, 0x40, 0x00, 0x1E, 0x2D, 0x2D, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE2, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x0A, 0xAF, 0xFA, 0x01, 0xFF,
-    0xFF, 0xF0, 0x05, 0x5F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x06, 0x00, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0xF8, 0x02, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFC, 0x6C, 0x00, 0x3F, 0xFF, 0xC0, 0x1B, 0xFF, 0xE0, 0x07, 0xFF, 0x40, 0x00, 0xAF,
-    0xF0, 0x0A, 0x90, 0xFE, 0x00, 0xFD, 0x0F, 0xE0, 0x2F, 0xC0, 0xFD, 0x07, 0xF8, 0x1F, 0xC2, 0xFF,
-    0x02, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x7C,
-    0x3C, 0x00, 0x00, 0x7F, 0xBE, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFE, 0x01,
-    0xFA, 0xAA, 0xBF, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0xF2, 0xCD, 0x0E, 0x01, 0xFF, 0xFF, 0x2D, 0x02,
-    0xFE, 0xFB, 0xFC, 0x02, 0xF0, 0x81, 0xA0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x04, 0x00, 0x04,
-    0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x40, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0x9F, 0xE7, 0xFE, 0x03, 0xFC, 0x0F, 0xD0,
-    0xFF, 0x07, 0xF4, 0x1F, 0xC0, 0xBF, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x0F, 0xE0, 0x3F, 0x80, 0xFF,
-    0x0F, 0xD0, 0x3F, 0x40, 0xFE, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x3F,
-    0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0x96, 0xFE, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x00,
-    0xFF, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0xFF, 0x03, 0xFD, 0x0A, 0xFF, 0xBF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFD, 0x50, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2B, 0xFE, 0xA0,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x2F, 0xFA, 0x90, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x70, 0xF0, 0x00, 0x00, 0x0B, 0x0E, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFD, 0x7F,
-    0xC0, 0x0F, 0xFB, 0xC3, 0x80, 0x02, 0xFF, 0x38, 0x74, 0x00, 0x3F, 0xC3, 0x8B, 0x00, 0x03, 0xFC,
-    0x20, 0xA0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x50, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x01, 0x41, 0x00, 0x00, 0x38, 0xB0, 0x00, 0x03, 0x4F, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x01, 0xFD, 0x6F, 0xE0, 0x1F, 0xC0, 0xFF, 0x02, 0xFC, 0x0F, 0xE0,
-    0x3F, 0x82, 0xFD, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0x1F,
-    0xF0, 0x0F, 0xE0, 0x7F, 0x80, 0xFD, 0x03, 0xF8, 0x1F, 0xC0, 0x7F, 0x42, 0xFC, 0x1F, 0xF0, 0x3F,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x90, 0x00, 0x34, 0xF0, 0x00, 0x07, 0x0E, 0x00,
-    0x00, 0x50, 0x40, 0x00, 0x05, 0x54, 0x3F, 0xFD, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xC6, 0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x2F, 0xFF, 0xFE, 0x03, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x5F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0x41, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00,
+static const uint8_t notosans_12_bolditalicBitmaps[30329] = {
+    0x55, 0x55, 0x3D, 0x8C, 0x1E, 0x35, 0x10, 0x9D, 0x5D, 0x27, 0xB7, 0xC5, 0x4A, 0x98, 0x22, 0x15,
+    0x28, 0xDA, 0x16, 0x51, 0xC4, 0x2D, 0x0D, 0xF1, 0x46, 0x29, 0x22, 0x44, 0x01, 0x45, 0x22, 0x8A,
+    0x14, 0xD7, 0x02, 0xCD, 0x35, 0x69, 0xEF, 0xBC, 0xE1, 0x0A, 0x8A, 0x14, 0xD0, 0xD0, 0x20, 0xD1,
+    0x51, 0x44, 0x69, 0xA0, 0xA4, 0xC8, 0xE1, 0x4D, 0xAE, 0xA4, 0x60, 0x45, 0x84, 0x28, 0x68, 0x1C,
+    0x25, 0x42, 0x20, 0x8A, 0x98, 0xB0, 0x21, 0x4E, 0x62, 0xEF, 0xF0, 0x66, 0xBF, 0xBB, 0xFC, 0xEC,
+    0xDD, 0x77, 0xF7, 0xED, 0xD8, 0x9E, 0x79, 0xF3, 0xE6, 0xCD, 0xB8, 0x5A, 0xEA, 0xA5, 0x2E, 0x2A,
+    0xE3, 0x27, 0x35, 0x73, 0x1B, 0xDB, 0xA8, 0x83, 0x9E, 0xF4, 0x48, 0x78, 0x0C, 0xB9, 0xC1, 0x0F,
+    0x8E, 0x4E, 0x90, 0x79, 0xFF, 0xCE, 0x5C, 0xAC, 0x3E, 0x0C, 0x69, 0xB7, 0xBB, 0x70, 0x2B, 0x7E,
+    0xFC, 0x06, 0x91, 0x0A, 0x89, 0xAA, 0xF9, 0x5D, 0xA2, 0x9B, 0x86, 0xC8, 0xE2, 0x80, 0x3E, 0x1F,
+    0x14, 0x33, 0x8F, 0xF8, 0xC4, 0xB7, 0x17, 0x7F, 0x9D, 0x76, 0x75, 0x4F, 0xA6, 0x1D, 0xEB, 0xEF,
+    0xFE, 0x7E, 0x7A, 0x4E, 0x8C, 0x8E, 0x39, 0xAF, 0xBB, 0xCF, 0xEA, 0x81, 0xBA, 0x0B, 0x13, 0xB5,
+    0xB7, 0x23, 0xA9, 0x98, 0x25, 0xD4, 0x15, 0xA2, 0x16, 0x01, 0x79, 0xD0, 0x5C, 0xE0, 0x65, 0x74,
+    0xDF, 0x9C, 0x6A, 0x1E, 0x8E, 0xE4, 0x6E, 0x92, 0xE2, 0x91, 0x3A, 0x1E, 0xC8, 0x32, 0x91, 0x9F,
+    0x49, 0xBB, 0x81, 0xEE, 0xA5, 0x2B, 0xA7, 0xFD, 0x85, 0xD5, 0x63, 0xAE, 0xFC, 0x13, 0xA2, 0x77,
+    0x88, 0x9A, 0x9E, 0xE8, 0x75, 0xDA, 0x3C, 0xF5, 0x02, 0x74, 0x1A, 0xBE, 0xC6, 0xEE, 0xC1, 0x68,
+    0x04, 0xDC, 0x2E, 0x39, 0x3D, 0x26, 0xDA, 0xD3, 0x87, 0x91, 0x0E, 0xBA, 0x6B, 0x13, 0x1D, 0xD8,
+    0xED, 0x6B, 0xC1, 0x79, 0xEB, 0xB2, 0x2D, 0x79, 0x29, 0xDD, 0xC3, 0x47, 0xF9, 0x80, 0x9A, 0x7B,
+    0xF3, 0x01, 0x61, 0xCB, 0x01, 0x59, 0x81, 0x75, 0x80, 0x3F, 0x55, 0x52, 0x8F, 0x67, 0x15, 0x6B,
+    0x8E, 0xC8, 0x10, 0x28, 0x5E, 0x3C, 0x6E, 0x16, 0xBC, 0x13, 0x35, 0xBC, 0x00, 0x58, 0x1B, 0x49,
+    0x07, 0x4F, 0xB4, 0xE8, 0x40, 0xED, 0x63, 0xA4, 0x24, 0x70, 0x5B, 0xEE, 0xAF, 0x2B, 0x8E, 0x66,
+    0x64, 0xBF, 0x3F, 0x9B, 0x5F, 0x0A, 0xAB, 0xAC, 0x79, 0xB2, 0x83, 0x4B, 0x0A, 0x49, 0x62, 0x0B,
+    0xCF, 0x95, 0x30, 0xD6, 0xF0, 0x5D, 0x5E, 0x7D, 0x9A, 0x0F, 0xEE, 0x44, 0x30, 0xBC, 0x35, 0x50,
+    0x13, 0xC8, 0x92, 0x9A, 0xC9, 0x0C, 0x55, 0x26, 0x3D, 0x91, 0x23, 0x95, 0x08, 0x10, 0x1C, 0xD5,
+    0x49, 0xDE, 0x6D, 0x4F, 0x19, 0xDC, 0x89, 0x09, 0x5F, 0x8B, 0x58, 0x9B, 0xF5, 0xAD, 0xEB, 0xC5,
+    0x11, 0x56, 0x36, 0x27, 0x47, 0xAC, 0x61, 0xFB, 0x8F, 0xD4, 0x06, 0xFC, 0x01, 0x38, 0xBC, 0x8E,
+    0x58, 0x30, 0x03, 0x9C, 0x3B, 0x2C, 0xE1, 0xBB, 0xED, 0x75, 0xA8, 0x33, 0xDE, 0xD6, 0xA7, 0x99,
+    0xA8, 0x4A, 0x34, 0xDC, 0xA4, 0x3D, 0x83, 0xFC, 0xBE, 0xBA, 0x0A, 0x9A, 0x1B, 0xCE, 0x0D, 0x9F,
+    0x6C, 0x1E, 0x07, 0x35, 0x67, 0x7A, 0xCB, 0xF4, 0x2B, 0xD9, 0x67, 0x89, 0x50, 0x46, 0x15, 0x88,
+    0x12, 0xB2, 0xC5, 0x56, 0xFE, 0x9D, 0xF9, 0xD1, 0x8D, 0xE5, 0xFA, 0xAB, 0x2B, 0x02, 0x26, 0x75,
+    0x93, 0x57, 0xB1, 0x1B, 0xA4, 0xD2, 0x27, 0x2F, 0xDA, 0xE2, 0xB2, 0xCB, 0x67, 0xCC, 0x83, 0xA7,
+    0xF9, 0x94, 0xC4, 0x8B, 0x38, 0x3E, 0x10, 0x70, 0x08, 0x50, 0x02, 0x87, 0x4A, 0x98, 0x85, 0x00,
+    0x0B, 0x09, 0x6A, 0xC1, 0x85, 0xDC, 0xA9, 0x3B, 0xB2, 0xC8, 0xF6, 0x9E, 0x6A, 0xD9, 0x0E, 0xCB,
+    0xF2, 0x52, 0x45, 0xC8, 0x83, 0x27, 0xEE, 0x3B, 0x86, 0x98, 0xCD, 0xE4, 0xFB, 0xA2, 0xA3, 0xBE,
+    0x5B, 0x68, 0x31, 0x63, 0x77, 0x27, 0x57, 0xC5, 0x8E, 0xE6, 0x30, 0xA9, 0x6C, 0x07, 0x7B, 0x08,
+    0xA5, 0xDB, 0x01, 0xD5, 0x30, 0xC1, 0x40, 0x92, 0xCC, 0x10, 0xD9, 0xA6, 0xB4, 0x00, 0xC3, 0xA3,
+    0x59, 0x1A, 0x9E, 0x3D, 0x4F, 0xC5, 0x57, 0xFB, 0x59, 0x38, 0x73, 0x3D, 0xD0, 0x21, 0xB0, 0x1D,
+    0x11, 0xAF, 0x99, 0x05, 0x1C, 0xAF, 0xF5, 0x08, 0x9B, 0xB8, 0xA6, 0xA0, 0xD4, 0x85, 0x3C, 0x7C,
+    0x15, 0x3D, 0x57, 0x43, 0x87, 0x3C, 0x5C, 0x4F, 0x0A, 0x18, 0x0D, 0xD8, 0x44, 0x6D, 0xBB, 0x48,
+    0x35, 0xFE, 0x99, 0x40, 0x0A, 0x88, 0xED, 0x44, 0xAA, 0x88, 0x44, 0x18, 0xEC, 0x96, 0x06, 0x32,
+    0x58, 0xDD, 0x6C, 0xF1, 0x04, 0xE9, 0x0F, 0x16, 0x6E, 0x26, 0x39, 0x57, 0xD6, 0xA4, 0xE1, 0xE5,
+    0x32, 0x8B, 0x94, 0x88, 0xC1, 0xC2, 0x4E, 0x5C, 0x09, 0x01, 0x08, 0xF2, 0xEF, 0xC1, 0x2D, 0xCE,
+    0x6B, 0x9C, 0x71, 0xC7, 0xD2, 0x6C, 0xB1, 0xE0, 0x46, 0x88, 0x12, 0xEE, 0x21, 0x10, 0x86, 0x8C,
+    0x7C, 0x5F, 0x97, 0x4C, 0xDD, 0x4F, 0xB1, 0x42, 0xEE, 0x7A, 0x2A, 0x54, 0xD0, 0xE7, 0x4F, 0xFD,
+    0x9F, 0x08, 0x8F, 0xE3, 0x7C, 0xF5, 0xD2, 0xF6, 0xFD, 0xD5, 0xE7, 0x4A, 0xA9, 0xB8, 0x67, 0xF4,
+    0x4E, 0x01, 0x2B, 0x53, 0xF7, 0xEB, 0x45, 0x31, 0x82, 0x6E, 0x29, 0x89, 0xE7, 0x5E, 0x43, 0xEB,
+    0x7B, 0x1E, 0x7B, 0x80, 0x46, 0x20, 0x20, 0x49, 0x1D, 0xBF, 0xAC, 0xB9, 0xC5, 0x66, 0xCF, 0xF3,
+    0x16, 0xA7, 0x97, 0xFA, 0x03, 0x8A, 0xE2, 0xB1, 0xE3, 0xD4, 0x20, 0x0F, 0xDE, 0xA4, 0x92, 0x3E,
+    0x21, 0xEB, 0x52, 0x23, 0xBB, 0xFF, 0x58, 0xF4, 0xAC, 0x23, 0x13, 0x63, 0xDC, 0x04, 0xAE, 0x4A,
+    0x1B, 0xED, 0xE8, 0x38, 0xD5, 0x88, 0x20, 0xB9, 0x8A, 0x6C, 0x98, 0x53, 0xC7, 0x1C, 0x3C, 0x73,
+    0x7F, 0xE9, 0xB2, 0xE0, 0x18, 0xA9, 0x5A, 0x36, 0x18, 0xFD, 0x86, 0xDD, 0x57, 0x2D, 0x4D, 0x5E,
+    0xA9, 0xAD, 0x5F, 0x58, 0xD6, 0xA7, 0x02, 0x09, 0x1E, 0x48, 0x9E, 0x61, 0xCA, 0xE9, 0x60, 0xFB,
+    0x45, 0x25, 0x1D, 0xCC, 0xE1, 0x5A, 0xF7, 0x86, 0x7B, 0x25, 0x0A, 0xD8, 0x96, 0xE8, 0xE7, 0x67,
+    0x95, 0x5C, 0x6F, 0x3F, 0x17, 0x75, 0x3C, 0x65, 0x74, 0xE6, 0xD4, 0x70, 0x38, 0x4E, 0xC7, 0x24,
+    0x49, 0xC7, 0x72, 0x32, 0x13, 0x20, 0x77, 0xBF, 0xCD, 0xCD, 0xA3, 0x5C, 0x17, 0xD7, 0x73, 0xF7,
+    0x0F, 0x1F, 0xCA, 0x28, 0x7A, 0x96, 0xEA, 0x6F, 0xCB, 0xAA, 0x5F, 0x4C, 0x28, 0x87, 0x29, 0x38,
+    0x59, 0x9E, 0xF4, 0xA6, 0x2E, 0xD5, 0xDC, 0x45, 0x7F, 0xB5, 0x50, 0x7F, 0xEC, 0xAD, 0x0E, 0x26,
+    0xF0, 0x67, 0xB9, 0x82, 0xA1, 0xEB, 0xBB, 0xD8, 0x26, 0x14, 0xFB, 0x04, 0xBD, 0xF2, 0xE8, 0xA9,
+    0x89, 0xD0, 0x58, 0x46, 0xDB, 0xDA, 0xE7, 0xC6, 0x7A, 0x92, 0x0A, 0x03, 0x8B, 0x0F, 0x35, 0x0F,
+    0xCD, 0x82, 0x64, 0x7B, 0x91, 0x1F, 0x79, 0x0C, 0x63, 0x8E, 0x24, 0x5C, 0xB7, 0x12, 0xE5, 0xD3,
+    0x1B, 0x37, 0x36, 0x1D, 0x39, 0x1F, 0xC1, 0x5F, 0x5F, 0xFE, 0x83, 0x5C, 0xB0, 0x7A, 0x06, 0x9B,
+    0xD2, 0xCA, 0x4B, 0x03, 0x7C, 0x2D, 0xF8, 0x32, 0xB3, 0x1C, 0x35, 0x4B, 0xE5, 0xE7, 0x86, 0x27,
+    0x61, 0xF0, 0x87, 0xE7, 0xE3, 0xB4, 0xE6, 0xC9, 0x48, 0x25, 0xF2, 0x6B, 0x75, 0x91, 0x36, 0x85,
+    0x24, 0x70, 0xDA, 0x85, 0x0A, 0xDC, 0x65, 0xE9, 0x98, 0xF6, 0x98, 0xA4, 0x76, 0x90, 0x8A, 0xC8,
+    0xEF, 0xB0, 0xC9, 0x66, 0xE7, 0x2F, 0x39, 0x2E, 0xB8, 0x96, 0xAF, 0xB9, 0x07, 0x72, 0xB9, 0x5F,
+    0x88, 0xF6, 0x30, 0x0C, 0x16, 0xCC, 0x59, 0xC3, 0xB7, 0x63, 0x32, 0xFB, 0xF1, 0xE6, 0x6E, 0x37,
+    0x24, 0x83, 0xAB, 0x62, 0xB7, 0xFD, 0x19, 0x56, 0xF5, 0x6F, 0x4C, 0xFA, 0xD6, 0x9C, 0x6D, 0x1B,
+    0xB2, 0x81, 0xBA, 0x4B, 0x3B, 0xF1, 0x17, 0x85, 0xF2, 0xC9, 0xFE, 0x22, 0xE6, 0x96, 0x28, 0xA3,
+    0xD0, 0xE9, 0xB5, 0x7D, 0x7A, 0x24, 0xB1, 0x32, 0xFC, 0xE1, 0x1A, 0xBF, 0x43, 0xB2, 0x1A, 0xD8,
+    0x25, 0x2B, 0xF5, 0x2C, 0xA0, 0x83, 0xA0, 0x88, 0x02, 0x69, 0x3B, 0x19, 0x93, 0xFB, 0x98, 0x89,
+    0xA3, 0xF4, 0xB3, 0xED, 0xDB, 0x27, 0xDB, 0xD2, 0x6A, 0x50, 0x1B, 0xE4, 0x26, 0x13, 0xD8, 0x03,
+    0x99, 0x1D, 0xEA, 0x8C, 0xCE, 0xF6, 0xE8, 0x6A, 0x68, 0xD5, 0x83, 0x58, 0x61, 0x0F, 0x77, 0x56,
+    0xB5, 0x7C, 0x94, 0x2B, 0x14, 0xBB, 0xCE, 0x35, 0x26, 0x4B, 0x93, 0xD4, 0x3A, 0x12, 0x91, 0x0F,
+    0x62, 0xEB, 0xB8, 0x13, 0x30, 0x66, 0xE4, 0xD2, 0x8C, 0xDD, 0xA4, 0x31, 0xEB, 0x5D, 0x00, 0x30,
+    0x08, 0x45, 0xE6, 0xFB, 0xFD, 0xA3, 0x91, 0x0A, 0xA6, 0xE5, 0xAA, 0x42, 0x44, 0xC5, 0xE7, 0xBE,
+    0xD7, 0x69, 0x1D, 0x08, 0x32, 0x1B, 0x84, 0x2C, 0x61, 0x4B, 0x3A, 0x69, 0x15, 0xAC, 0x7C, 0xE4,
+    0xBB, 0x13, 0x7B, 0xD8, 0xC2, 0xCD, 0x27, 0xBD, 0xCF, 0xC8, 0xB3, 0x1C, 0xCD, 0x38, 0x99, 0x1F,
+    0xE8, 0x33, 0x2D, 0xF7, 0xC6, 0x93, 0x9D, 0xB9, 0x2A, 0x98, 0x2F, 0x1E, 0x7E, 0xEC, 0x28, 0x57,
+    0x77, 0x9D, 0xD1, 0x97, 0x8C, 0x12, 0xD9, 0x91, 0xD1, 0x05, 0x30, 0xCE, 0x3A, 0x00, 0xF4, 0xAC,
+    0x70, 0xCB, 0xBF, 0xC9, 0x92, 0x2C, 0x8E, 0x2F, 0x38, 0x7E, 0x84, 0xED, 0x7F, 0x8D, 0x55, 0xB1,
+    0x6E, 0xE6, 0x44, 0x10, 0x1E, 0x7B, 0xA5, 0x58, 0x62, 0x8B, 0xA5, 0xA1, 0xF6, 0x23, 0xEC, 0x1B,
+    0xB0, 0xAB, 0x9C, 0x04, 0x65, 0xD2, 0x1C, 0x0D, 0x45, 0x5A, 0x0A, 0xA4, 0x7B, 0x02, 0xB2, 0x16,
+    0x12, 0xA2, 0xA0, 0xE0, 0x1A, 0xDE, 0x80, 0xC7, 0xB8, 0xC4, 0x7B, 0x7F, 0xCA, 0x14, 0x58, 0x34,
+    0x57, 0x50, 0x9C, 0x91, 0x90, 0x90, 0x68, 0x6E, 0x23, 0x7C, 0xC9, 0x92, 0x5B, 0x7B, 0xF8, 0x66,
+    0xFF, 0x24, 0x04, 0x04, 0x12, 0xBF, 0x6C, 0xFF, 0xB6, 0x77, 0x76, 0xE6, 0x9B, 0x6F, 0xBE, 0x19,
+    0xD3, 0xC8, 0x8B, 0x62, 0x8E, 0x86, 0x99, 0xC2, 0x77, 0xC7, 0xCD, 0x4A, 0xA4, 0x13, 0x91, 0x8B,
+    0x44, 0xCC, 0x53, 0x87, 0xB7, 0x96, 0x0B, 0xF1, 0xD3, 0x63, 0x55, 0x88, 0xCC, 0x4C, 0x14, 0x3C,
+    0xB5, 0x30, 0x12, 0x7B, 0x27, 0x2B, 0x0C, 0xEB, 0x91, 0xD3, 0x7F, 0xF8, 0xD8, 0x88, 0x1E, 0x7C,
+    0xF0, 0xFC, 0xD8, 0x87, 0xDC, 0x8A, 0xD1, 0x50, 0x8D, 0xF6, 0xBF, 0x03, 0xCE, 0x70, 0xCA, 0x30,
+    0x5D, 0x15, 0xFB, 0xCF, 0x35, 0x6C, 0x7A, 0xD8, 0xD8, 0x69, 0xEF, 0x2C, 0x0C, 0x5C, 0x82, 0xE7,
+    0x32, 0x7A, 0xCE, 0xA3, 0xEF, 0x96, 0xE0, 0x75, 0x0A, 0xD1, 0x24, 0x37, 0x9B, 0xB9, 0x07, 0x5A,
+    0x8D, 0xB3, 0xE1, 0xCD, 0x57, 0x5F, 0x23, 0x99, 0xC9, 0x24, 0x60, 0xD9, 0xC8, 0xC6, 0x1E, 0xA1,
+    0x71, 0xEB, 0x06, 0x1B, 0xBB, 0x05, 0x28, 0x82, 0x47, 0x98, 0x04, 0x64, 0x0C, 0xEC, 0x3C, 0x9B,
+    0xB7, 0x9F, 0xAC, 0x04, 0x94, 0xD1, 0xDC, 0xD9, 0x45, 0x1B, 0x55, 0xDE, 0xDB, 0x0D, 0x3A, 0xA9,
+    0x8C, 0x45, 0xE2, 0xAD, 0x1E, 0x19, 0x66, 0x82, 0x06, 0xC0, 0x9D, 0x97, 0x4C, 0x46, 0x92, 0xD5,
+    0x8D, 0xB0, 0x0F, 0x49, 0xE1, 0xC0, 0xBE, 0x7E, 0xA3, 0xC0, 0x7E, 0x64, 0x5F, 0x73, 0xC5, 0x06,
+    0xA4, 0x2A, 0xC9, 0x6F, 0x8F, 0x9F, 0x33, 0x35, 0x78, 0x1E, 0x1F, 0x3F, 0xAF, 0x82, 0x5B, 0xBC,
+    0xE3, 0xB9, 0xCB, 0xD4, 0x15, 0x09, 0xE9, 0x98, 0x0C, 0x0C, 0xDF, 0xAF, 0x49, 0x39, 0xE4, 0x6B,
+    0x16, 0xDA, 0xDA, 0x8D, 0xFA, 0x69, 0x8C, 0x4D, 0x01, 0x41, 0xF6, 0x42, 0x82, 0x22, 0x98, 0x1B,
+    0x27, 0xD0, 0x9D, 0xA5, 0x20, 0x03, 0x2A, 0x84, 0x80, 0x0C, 0xEE, 0xCC, 0xCC, 0xF0, 0x0C, 0x8F,
+    0x36, 0x86, 0x41, 0x15, 0xE0, 0x00, 0x0F, 0x93, 0x5A, 0x6A, 0xF4, 0xBF, 0xC0, 0x37, 0xF7, 0xE0,
+    0x01, 0xA4, 0x5B, 0xA4, 0x82, 0x66, 0x7F, 0xCC, 0x88, 0x54, 0x93, 0xE6, 0x52, 0x8F, 0x4C, 0x08,
+    0xE3, 0x50, 0x71, 0xDF, 0xA2, 0xE6, 0xAB, 0x80, 0x0B, 0x78, 0xB7, 0x34, 0x28, 0x30, 0x47, 0xFD,
+    0x66, 0xB0, 0x80, 0x79, 0x4A, 0x5B, 0xA1, 0x52, 0xF4, 0xEB, 0xB9, 0xFB, 0x3D, 0x39, 0xE7, 0xED,
+    0x0F, 0xBB, 0xAB, 0x42, 0x9B, 0xEB, 0xBF, 0x49, 0x6A, 0x29, 0xC5, 0x0E, 0xE6, 0xE2, 0x66, 0xC6,
+    0x46, 0xCD, 0x6A, 0x69, 0xB3, 0xCD, 0x3D, 0xB8, 0x1F, 0x23, 0x36, 0x1E, 0x6E, 0x88, 0x5F, 0xBA,
+    0x64, 0x50, 0xF4, 0x71, 0x00, 0x28, 0x8E, 0x80, 0xC5, 0x93, 0xCA, 0x0D, 0x54, 0xB6, 0xB4, 0x28,
+    0x5B, 0x6A, 0xDF, 0x2D, 0xA8, 0xCA, 0x75, 0xD1, 0xB3, 0xBA, 0x2A, 0x66, 0xEE, 0xD2, 0x6A, 0x26,
+    0x9D, 0x58, 0x7C, 0x04, 0x14, 0x71, 0x72, 0xCF, 0x06, 0x13, 0x1D, 0xFB, 0x3E, 0xF6, 0xEC, 0xF1,
+    0x02, 0x52, 0x1D, 0xE4, 0xE2, 0x35, 0x22, 0x92, 0x5A, 0xF7, 0x6A, 0x6B, 0xF8, 0x17, 0x11, 0xE7,
+    0x80, 0x73, 0x51, 0x5B, 0xCB, 0x0A, 0x54, 0xBF, 0x64, 0xD2, 0xCB, 0xE8, 0x9B, 0x15, 0x35, 0x08,
+    0x47, 0xC8, 0xFC, 0x15, 0x98, 0xB8, 0x5E, 0x41, 0x0B, 0x5E, 0x32, 0x78, 0x18, 0x3F, 0x86, 0x2A,
+    0x22, 0x0F, 0xE3, 0x04, 0xC5, 0xCD, 0x2D, 0x4E, 0xEA, 0x41, 0xF6, 0x5E, 0x72, 0x90, 0x9E, 0xF4,
+    0x03, 0x73, 0x6E, 0xB6, 0x4F, 0x4B, 0x53, 0xDA, 0xB5, 0x85, 0x9C, 0x14, 0xFE, 0x45, 0x4D, 0xDD,
+    0x1F, 0xCF, 0xB2, 0x16, 0xB5, 0x31, 0x7B, 0x73, 0xFB, 0x7D, 0xED, 0x04, 0x78, 0x14, 0x6A, 0xAB,
+    0xBC, 0xA5, 0x15, 0x9C, 0xA7, 0x7F, 0x03, 0x77, 0xF8, 0xFF, 0xC0, 0x31, 0xC0, 0x8D, 0xF7, 0xE0,
+    0x26, 0x80, 0x9B, 0x00, 0x0E, 0x9E, 0x35, 0x24, 0x21, 0x75, 0xAE, 0xDD, 0xA4, 0xA4, 0xDD, 0x3E,
+    0x00, 0xDA, 0x5B, 0x52, 0x82, 0x04, 0x67, 0xF8, 0x72, 0x13, 0x98, 0x3A, 0xA1, 0x97, 0xA2, 0x1B,
+    0x36, 0xB5, 0x22, 0xEC, 0x6C, 0x45, 0xEE, 0x20, 0x1E, 0x3D, 0x27, 0x12, 0x0A, 0x87, 0xC8, 0xA6,
+    0xCB, 0x46, 0x8C, 0x06, 0x8B, 0xDA, 0x09, 0xE6, 0x3D, 0x50, 0x58, 0xA1, 0xC3, 0xD5, 0x7A, 0xE0,
+    0xC3, 0x20, 0xDA, 0x01, 0x43, 0xF0, 0xED, 0xA5, 0x0D, 0x28, 0xE0, 0x11, 0x18, 0x84, 0xF4, 0x7E,
+    0x86, 0xCE, 0x0E, 0xBC, 0x9B, 0x46, 0x2E, 0xBA, 0x4E, 0x85, 0x4A, 0x5C, 0x60, 0xBE, 0x64, 0x2E,
+    0x68, 0xC6, 0xAF, 0x4E, 0xDE, 0x1E, 0x0B, 0x4E, 0x33, 0xD7, 0x56, 0x00, 0x31, 0xD2, 0x34, 0x88,
+    0x03, 0x49, 0x48, 0xE3, 0xC8, 0x54, 0xE1, 0x3A, 0x37, 0x44, 0xBB, 0x48, 0x58, 0xA6, 0x48, 0x2B,
+    0x6D, 0x2A, 0xCD, 0x8B, 0x1A, 0xA7, 0x7E, 0x92, 0x34, 0x68, 0xAB, 0xBD, 0xBB, 0x55, 0xC5, 0x9B,
+    0x04, 0xB1, 0x67, 0x9D, 0x9A, 0xBF, 0xBF, 0xEC, 0xE7, 0x2E, 0x23, 0x4F, 0x99, 0x4B, 0x1B, 0x7A,
+    0x45, 0x7A, 0xE1, 0x4E, 0x17, 0xE7, 0xA4, 0x6E, 0x0B, 0xD9, 0x9F, 0x50, 0xC8, 0x1E, 0xE3, 0x22,
+    0x80, 0x78, 0xA9, 0x22, 0xF2, 0x36, 0x13, 0x1E, 0x9E, 0x64, 0x5A, 0xFB, 0xA8, 0x16, 0xEC, 0xFA,
+    0x15, 0x3D, 0x35, 0x0E, 0x74, 0x8E, 0xCE, 0x81, 0x0E, 0x3A, 0x40, 0xEB, 0xF3, 0xBE, 0x96, 0xE7,
+    0x04, 0x93, 0xEB, 0x22, 0x43, 0xE5, 0x32, 0x21, 0xC8, 0x66, 0xA3, 0x85, 0x70, 0x47, 0x50, 0xE1,
+    0x76, 0x48, 0xBE, 0x59, 0x75, 0x72, 0x2F, 0x74, 0xB2, 0xBB, 0xDB, 0xC5, 0xF9, 0x60, 0x2E, 0x7F,
+    0x84, 0x5C, 0x4E, 0xED, 0x11, 0xBA, 0x65, 0x39, 0x0B, 0xD4, 0xBF, 0xDE, 0xDD, 0x64, 0x0A, 0x67,
+    0xFA, 0x75, 0x84, 0xEA, 0xD1, 0x4F, 0x1D, 0xA6, 0xC9, 0x42, 0x7D, 0x69, 0x40, 0x65, 0x98, 0xBB,
+    0x55, 0x78, 0x90, 0x62, 0x42, 0x34, 0x98, 0x13, 0x32, 0x14, 0x40, 0x87, 0x93, 0x5E, 0x47, 0x05,
+    0x4C, 0x02, 0x92, 0xEE, 0x06, 0xDC, 0x28, 0x5E, 0xE4, 0x02, 0xA1, 0xB5, 0xA2, 0x03, 0x25, 0x17,
+    0x23, 0x17, 0xFB, 0x06, 0xC2, 0x0B, 0xDF, 0x0A, 0x9F, 0xA0, 0x0B, 0x3C, 0x64, 0x88, 0x44, 0x06,
+    0x57, 0x52, 0x32, 0xFE, 0x40, 0x2F, 0xE6, 0xE7, 0xD5, 0x4A, 0xE3, 0x93, 0xDC, 0x15, 0x51, 0x85,
+    0xDD, 0xAD, 0x55, 0x73, 0x2B, 0x57, 0xA7, 0x1A, 0xA5, 0xEB, 0xA5, 0x36, 0x53, 0xAD, 0x88, 0xD4,
+    0x47, 0xA4, 0x8C, 0x71, 0x72, 0x3F, 0xE3, 0x45, 0xCD, 0x98, 0x43, 0xAB, 0x0C, 0xF3, 0x06, 0xE5,
+    0xA5, 0xA7, 0x27, 0xC0, 0x62, 0xB1, 0x32, 0x46, 0x88, 0x86, 0xAA, 0x22, 0x0C, 0xF6, 0xD9, 0x54,
+    0xF5, 0x42, 0x77, 0xAF, 0x44, 0xAB, 0x92, 0x19, 0x06, 0xF4, 0x00, 0x65, 0x0C, 0x98, 0xCF, 0x98,
+    0x90, 0x98, 0xC0, 0x73, 0x77, 0xEB, 0xED, 0x40, 0x67, 0xA4, 0x30, 0x93, 0xC0, 0x02, 0xB5, 0x19,
+    0x23, 0x9E, 0x1C, 0x51, 0xA1, 0x6E, 0x26, 0x2C, 0xAD, 0xB2, 0xD4, 0x47, 0x90, 0xDF, 0x2E, 0x64,
+    0x7E, 0x23, 0x87, 0x91, 0x21, 0x06, 0x05, 0xB5, 0x9B, 0xAC, 0x3F, 0x6D, 0xE4, 0x26, 0x3A, 0x7F,
+    0xD6, 0xE6, 0x4E, 0x6E, 0xB0, 0xB0, 0xE8, 0x59, 0x48, 0x14, 0xC3, 0x83, 0xB1, 0x7A, 0x4A, 0x0F,
+    0x9E, 0x10, 0xE4, 0xF4, 0x21, 0x48, 0xB3, 0x0F, 0xE2, 0x61, 0x52, 0x83, 0xBC, 0x87, 0x49, 0xB2,
+    0x54, 0x52, 0x1B, 0x01, 0x0B, 0xDC, 0x0B, 0x49, 0x71, 0xDC, 0x0B, 0xD2, 0xAF, 0x26, 0xCA, 0x1F,
+    0x92, 0x6B, 0x93, 0x9E, 0x7A, 0xD8, 0x67, 0x47, 0x66, 0xF7, 0x9C, 0x3E, 0xB3, 0x9C, 0xE5, 0x8B,
+    0xA9, 0x30, 0xEB, 0xCE, 0xDA, 0x99, 0x4E, 0x3F, 0x7A, 0xEE, 0xD6, 0x82, 0xF6, 0x7B, 0xC9, 0x47,
+    0xC5, 0xC5, 0xF0, 0x75, 0xEE, 0xD0, 0xDC, 0xC1, 0x24, 0x4C, 0x32, 0xDA, 0x44, 0xA0, 0xAC, 0x56,
+    0xB4, 0x49, 0x74, 0x1B, 0xCA, 0x7E, 0x32, 0xDC, 0x7D, 0xD5, 0xEA, 0x57, 0x73, 0xAF, 0x7E, 0x60,
+    0x82, 0xBC, 0x66, 0xF5, 0x0E, 0x36, 0xBC, 0x76, 0xAB, 0x9D, 0xF1, 0x65, 0x94, 0xFE, 0xDC, 0xB0,
+    0x7F, 0x32, 0x3F, 0x63, 0xEE, 0xA0, 0x2B, 0x2E, 0x36, 0x8D, 0xB8, 0x2C, 0x1F, 0xE8, 0x2F, 0x5C,
+    0xA2, 0x7F, 0xFC, 0xFE, 0x04, 0x75, 0x55, 0xBF, 0x8F, 0xD8, 0x34, 0x14, 0x7E, 0x49, 0x00, 0x57,
+    0xCD, 0xE0, 0xA5, 0x2C, 0xAD, 0x84, 0x17, 0x06, 0xC4, 0xE2, 0xBF, 0xA0, 0x38, 0xA2, 0x12, 0x8C,
+    0xBD, 0xFF, 0x80, 0x85, 0xE1, 0xE8, 0x72, 0x33, 0x52, 0x91, 0x73, 0x65, 0x60, 0x60, 0xE9, 0xC2,
+    0x7E, 0x03, 0x48, 0xA7, 0x63, 0xE8, 0x3F, 0xD0, 0x9E, 0x0D, 0x1D, 0x3A, 0x74, 0x20, 0x2D, 0x03,
+    0x43, 0x07, 0x02, 0xAA, 0x40, 0xA8, 0x42, 0xB5, 0x20, 0xA5, 0x91, 0xEA, 0xF8, 0xF1, 0xBD, 0xE4,
+    0xB8, 0xFE, 0x90, 0x88, 0x62, 0xC9, 0x89, 0xED, 0xF7, 0xE3, 0x7B, 0xDF, 0xF7, 0x4C, 0x7B, 0x0F,
+    0x6B, 0xCE, 0x9A, 0x67, 0x3B, 0xBD, 0xED, 0x22, 0xF9, 0x9E, 0x02, 0x11, 0xFF, 0xF7, 0x86, 0xAE,
+    0xF3, 0x3C, 0x38, 0x1E, 0x5A, 0xEE, 0x49, 0x9E, 0x66, 0x22, 0x32, 0x91, 0x64, 0x53, 0x93, 0x89,
+    0xF4, 0x58, 0xCD, 0xAE, 0x73, 0x4B, 0x6E, 0x98, 0x93, 0x49, 0x1C, 0xB9, 0x2A, 0x6A, 0x56, 0x93,
+    0x8D, 0x26, 0x32, 0x85, 0x26, 0x37, 0xB3, 0x4E, 0x66, 0x70, 0x91, 0xBB, 0xC0, 0x99, 0xF8, 0x59,
+    0xAA, 0xF8, 0xF2, 0x66, 0xC9, 0x3E, 0xA4, 0x20, 0x7F, 0x93, 0xDF, 0x5F, 0x5C, 0xF4, 0x66, 0xF0,
+    0x77, 0x99, 0x7F, 0x64, 0xEE, 0xF9, 0x1B, 0x42, 0x20, 0x6D, 0xAA, 0x2A, 0xFE, 0x16, 0xAE, 0xA7,
+    0x9A, 0x67, 0x3A, 0x7D, 0x2C, 0x9C, 0x06, 0x0C, 0x9E, 0xA8, 0x5E, 0xB6, 0x18, 0x54, 0xE9, 0xC9,
+    0x73, 0x84, 0xB5, 0x48, 0x3A, 0xD1, 0x36, 0x46, 0x84, 0x39, 0x60, 0x3B, 0x42, 0x75, 0x32, 0xFA,
+    0x6D, 0xF8, 0x6E, 0x0D, 0x5D, 0x52, 0xA3, 0x42, 0x54, 0x9D, 0x98, 0x10, 0x8B, 0x01, 0xC7, 0x82,
+    0x84, 0x66, 0xF7, 0xBF, 0x6E, 0xF8, 0xE7, 0xE8, 0x98, 0x11, 0x6B, 0x46, 0xF8, 0xA3, 0xEF, 0xFD,
+    0xFB, 0x4B, 0x85, 0x69, 0x9B, 0x5C, 0x74, 0x3D, 0x72, 0x6C, 0xB2, 0x99, 0x5A, 0xE6, 0xA8, 0x99,
+    0xC9, 0xFC, 0x8D, 0xF8, 0xF4, 0x20, 0x86, 0x77, 0x54, 0xAE, 0xF1, 0xB7, 0xE5, 0x85, 0x56, 0xC0,
+    0xC2, 0x16, 0x4D, 0x59, 0x83, 0xA9, 0xE0, 0xC4, 0xDE, 0x19, 0x9B, 0x67, 0x0C, 0xDB, 0x45, 0x15,
+    0x93, 0x42, 0x64, 0x9D, 0xF4, 0xC8, 0xB4, 0xE8, 0xD1, 0xDC, 0x5B, 0xEA, 0x6C, 0xA3, 0xBB, 0x0D,
+    0xC8, 0x5C, 0xEF, 0x2E, 0x4D, 0x2A, 0xF9, 0x35, 0x54, 0x32, 0xBD, 0x4E, 0x08, 0x72, 0x17, 0xD3,
+    0xF3, 0x32, 0x9D, 0x11, 0x75, 0x40, 0x56, 0x2F, 0x4E, 0xC7, 0x66, 0x92, 0x5C, 0xB6, 0xED, 0xE2,
+    0x53, 0xB2, 0xDA, 0x5D, 0xBF, 0xCF, 0x6F, 0xDF, 0xF3, 0x9A, 0xAC, 0x5F, 0x21, 0x79, 0xFE, 0x1D,
+    0x56, 0x78, 0x5E, 0xFD, 0xB6, 0x23, 0x71, 0x22, 0x37, 0x93, 0x46, 0xB5, 0x5F, 0xC5, 0x4B, 0xD2,
+    0xA8, 0x73, 0x7D, 0xD8, 0x64, 0x3D, 0x21, 0xD4, 0x41, 0x4D, 0xA1, 0x6B, 0xFF, 0x5A, 0x48, 0x3F,
+    0x9B, 0x48, 0xF3, 0x88, 0x91, 0xC8, 0xA0, 0x3C, 0xF6, 0xA7, 0x99, 0x90, 0x0D, 0xB9, 0xFD, 0x42,
+    0xAE, 0x63, 0xB8, 0x5E, 0xB9, 0x25, 0xC1, 0xAA, 0xE9, 0x34, 0x6E, 0x35, 0xD5, 0xA0, 0xC5, 0x4B,
+    0xD3, 0xDE, 0xC0, 0x26, 0x55, 0x07, 0xC7, 0x74, 0x4C, 0xCE, 0x65, 0x3F, 0x03, 0xB1, 0xC7, 0x1C,
+    0xFD, 0x2F, 0x7C, 0x7F, 0x69, 0xE1, 0xD4, 0x0C, 0x4C, 0x2C, 0xD5, 0x30, 0x83, 0x8D, 0xA5, 0xCE,
+    0xA8, 0x05, 0x26, 0xEE, 0x1A, 0x80, 0x53, 0x93, 0xD4, 0xC7, 0xCB, 0x04, 0xA5, 0xEA, 0x02, 0xB1,
+    0x4A, 0x82, 0xB0, 0x18, 0x83, 0x29, 0x18, 0x1A, 0x61, 0x06, 0x46, 0x12, 0x53, 0xC1, 0xC2, 0x50,
+    0xAA, 0x05, 0x87, 0xBF, 0x87, 0x0D, 0x1C, 0xFC, 0x7C, 0x6E, 0x26, 0xD7, 0x79, 0x85, 0x32, 0xD3,
+    0x1E, 0x20, 0x80, 0x1B, 0x4E, 0xE1, 0x36, 0x96, 0xFC, 0x47, 0x83, 0x7E, 0x94, 0x9A, 0xA7, 0xB9,
+    0x5A, 0xC0, 0x6A, 0x6C, 0xBD, 0x9B, 0xEC, 0x3D, 0x2C, 0x5A, 0x4E, 0x35, 0x52, 0x96, 0x67, 0xD7,
+    0xF6, 0xCD, 0xD3, 0x95, 0x10, 0x9D, 0xBF, 0x5F, 0xEA, 0x05, 0xF0, 0xC0, 0x35, 0x2A, 0xD9, 0x2F,
+    0x54, 0x60, 0x12, 0x92, 0x80, 0x0A, 0xAE, 0x15, 0x11, 0x8A, 0x7E, 0x0C, 0x38, 0x6C, 0xAA, 0xF3,
+    0x46, 0x0F, 0x10, 0x53, 0x80, 0x85, 0xD7, 0x95, 0xAF, 0xE4, 0x3F, 0xE8, 0xA1, 0x28, 0x58, 0xFA,
+    0x8E, 0xB5, 0x38, 0xFF, 0x02, 0xE9, 0x04, 0xF2, 0x42, 0xBF, 0x35, 0x6C, 0x00, 0xD0, 0x2C, 0x6D,
+    0x11, 0x1A, 0xE5, 0x8A, 0x71, 0x5A, 0x44, 0xE9, 0x37, 0x03, 0xBC, 0x72, 0x1F, 0xE6, 0xAA, 0x83,
+    0x5B, 0x88, 0xB7, 0xE1, 0xAC, 0xF8, 0xB0, 0xCD, 0x52, 0x49, 0xB8, 0xC2, 0x12, 0x88, 0x08, 0x27,
+    0x28, 0x32, 0xCE, 0xB9, 0x6E, 0x13, 0xC4, 0xA8, 0xA4, 0x03, 0x64, 0x3D, 0x9E, 0x33, 0xA8, 0x5F,
+    0x16, 0xEE, 0x4A, 0x5A, 0x0E, 0x07, 0x52, 0xD7, 0xA6, 0xE3, 0x90, 0xA0, 0x2D, 0x5F, 0xD6, 0x3C,
+    0x3F, 0x26, 0xDD, 0xD7, 0x13, 0x85, 0x3F, 0x3C, 0x3F, 0x60, 0xF0, 0x16, 0xAE, 0x6C, 0x44, 0x26,
+    0x2E, 0x82, 0x42, 0xBE, 0x6B, 0xB1, 0xF4, 0xA7, 0xE2, 0x41, 0x74, 0x4A, 0x67, 0x0F, 0xCE, 0x5E,
+    0x2F, 0x04, 0x84, 0xCD, 0x77, 0xF9, 0x05, 0x72, 0xFB, 0x0F, 0x51, 0x1D, 0x4F, 0xDC, 0x42, 0x5A,
+    0xA1, 0x29, 0xD0, 0xD1, 0x80, 0x7C, 0x21, 0x36, 0x49, 0x9E, 0xAE, 0xD0, 0xBB, 0x5F, 0x26, 0x35,
+    0x7B, 0xA9, 0x9D, 0x19, 0x1D, 0x5A, 0xC8, 0xE4, 0x3B, 0x77, 0x39, 0x35, 0x4F, 0x16, 0x72, 0x7B,
+    0xB1, 0x06, 0xCD, 0x2C, 0x53, 0x05, 0xB1, 0x9B, 0x79, 0xCD, 0xF7, 0x0A, 0x1D, 0xD1, 0x91, 0xAF,
+    0xB8, 0x5A, 0x7C, 0xC3, 0x75, 0xF6, 0x8A, 0x71, 0xA2, 0x7D, 0x0C, 0x02, 0xE8, 0x1B, 0x7A, 0x74,
+    0x76, 0xCF, 0x44, 0xE7, 0x2C, 0x2A, 0xF1, 0x99, 0xF5, 0xE4, 0x6E, 0x5A, 0x50, 0x61, 0x46, 0x78,
+    0x2E, 0x59, 0x10, 0x74, 0xB4, 0x20, 0xFA, 0x00, 0xC2, 0x8B, 0x11, 0xB2, 0x43, 0xE8, 0xE1, 0x3A,
+    0x12, 0x03, 0x20, 0x03, 0x17, 0x0D, 0x8B, 0xAE, 0xB1, 0xEA, 0xA4, 0x38, 0x40, 0xC0, 0x8A, 0xDF,
+    0xDF, 0x05, 0x4C, 0xC6, 0xB0, 0x51, 0x4F, 0x0A, 0xCA, 0x39, 0xC4, 0x59, 0x54, 0xA8, 0x87, 0xA7,
+    0x28, 0x51, 0xD3, 0x82, 0x5A, 0xB8, 0x4B, 0x10, 0xD0, 0xAF, 0x99, 0xEA, 0x19, 0xC5, 0x3D, 0x86,
+    0x8A, 0x4C, 0xE8, 0x48, 0xE1, 0x3C, 0x89, 0x51, 0x31, 0x28, 0xF2, 0x02, 0x6A, 0x24, 0x44, 0xA8,
+    0x57, 0xE3, 0x28, 0x22, 0x46, 0xBD, 0x4A, 0xF9, 0xE8, 0xA8, 0xF7, 0x3C, 0x5A, 0x74, 0x3F, 0x95,
+    0x45, 0xCF, 0xCD, 0x22, 0x0B, 0xD8, 0x57, 0x95, 0xD3, 0x0E, 0xCD, 0xA3, 0xE3, 0xD9, 0xB0, 0xEC,
+    0xBF, 0x25, 0xDB, 0x50, 0x3C, 0x29, 0xF0, 0x5A, 0x5A, 0xB7, 0x92, 0xE2, 0x98, 0x2E, 0x64, 0xB2,
+    0x13, 0x92, 0xA4, 0x0B, 0x49, 0x98, 0x22, 0x6F, 0x92, 0x57, 0x25, 0x61, 0x8C, 0x5A, 0xC4, 0x30,
+    0x4E, 0x5F, 0xFD, 0x9F, 0x67, 0x97, 0x3E, 0x05, 0xDA, 0x04, 0x0E, 0xE1, 0xA4, 0x06, 0x6F, 0xA4,
+    0x03, 0xB4, 0xA3, 0x38, 0xF1, 0xD7, 0x29, 0xC4, 0x37, 0x0A, 0xF9, 0x11, 0x59, 0x60, 0xC9, 0x23,
+    0x57, 0xE9, 0x84, 0x5E, 0xE2, 0xF0, 0x43, 0x85, 0xD4, 0x80, 0xC5, 0x1E, 0xFF, 0xF6, 0x80, 0xF9,
+    0x9F, 0x6E, 0x6F, 0x6B, 0xE3, 0xBB, 0x55, 0xA9, 0x21, 0x3B, 0xDA, 0x41, 0x2B, 0xD9, 0x69, 0x12,
+    0xA4, 0x31, 0xEA, 0x51, 0x0F, 0x26, 0x8A, 0x40, 0x40, 0x8E, 0x3E, 0x74, 0x57, 0xD6, 0x8D, 0x2D,
+    0x1A, 0x13, 0x3A, 0xC6, 0x2C, 0xE4, 0x2C, 0x13, 0x4A, 0x04, 0xC6, 0x02, 0xC1, 0x2D, 0xF3, 0x13,
+    0x08, 0xF6, 0x23, 0x3A, 0x3F, 0x6A, 0xA2, 0x0A, 0x35, 0x03, 0x35, 0x91, 0xAA, 0xEE, 0xE4, 0xA2,
+    0x30, 0xA5, 0x03, 0x9E, 0x5B, 0x2B, 0xD2, 0xD3, 0x99, 0x15, 0xE7, 0xB5, 0x45, 0x7A, 0xDA, 0x64,
+    0x06, 0xD6, 0xE1, 0xDA, 0x98, 0xE8, 0x7C, 0x39, 0xDC, 0x7A, 0x9C, 0xDC, 0x13, 0x72, 0x67, 0xAC,
+    0xF7, 0x06, 0x90, 0x85, 0x00, 0x27, 0xA8, 0x35, 0xD3, 0x6B, 0x44, 0x17, 0x3F, 0xB9, 0xE8, 0xB9,
+    0x18, 0x60, 0xBD, 0x3F, 0x5B, 0xBA, 0x89, 0xD7, 0x74, 0x59, 0x3F, 0x9A, 0x1D, 0x2F, 0xEF, 0x85,
+    0x5B, 0x67, 0xE8, 0x9C, 0x89, 0x4A, 0x68, 0x1A, 0xD1, 0xC4, 0xEB, 0x59, 0x0F, 0x4A, 0xE8, 0x71,
+    0x07, 0x1C, 0x80, 0xBE, 0x70, 0xB9, 0x08, 0x5B, 0x6F, 0xF0, 0x01, 0xAC, 0xC5, 0xD7, 0xC3, 0x57,
+    0xAB, 0x3C, 0x4F, 0x2E, 0x8F, 0x37, 0xCB, 0xCE, 0xE9, 0x9D, 0xFA, 0x1C, 0x73, 0x49, 0xE0, 0xDC,
+    0x0B, 0x15, 0x10, 0x34, 0xB8, 0xD7, 0x3C, 0xB5, 0x4F, 0xAE, 0xCA, 0x6E, 0xA4, 0x0E, 0xF2, 0x43,
+    0x66, 0x0A, 0x12, 0x47, 0xA3, 0xCB, 0xED, 0xE0, 0x2E, 0xA5, 0x16, 0xD9, 0x84, 0x09, 0xF7, 0xE1,
+    0x9A, 0xA0, 0x4A, 0x17, 0x95, 0xA8, 0xBA, 0x3A, 0xB9, 0x3E, 0xDF, 0x79, 0xCB, 0x5D, 0xFE, 0xE1,
+    0x76, 0xDA, 0xD9, 0xA1, 0x97, 0x9E, 0x7F, 0x01, 0xB5, 0x55, 0x3D, 0x8C, 0xDC, 0x44, 0x14, 0xFE,
+    0xEC, 0x49, 0xCE, 0x22, 0x23, 0x31, 0x29, 0x12, 0x09, 0x21, 0xDD, 0xB9, 0x4A, 0x01, 0x8A, 0xE2,
+    0x86, 0x32, 0x97, 0x31, 0x5C, 0x49, 0x93, 0x82, 0x13, 0x05, 0x45, 0x0A, 0x2A, 0x68, 0xD2, 0x44,
+    0x4A, 0xC5, 0xDA, 0x51, 0x24, 0xDA, 0xA4, 0x00, 0x51, 0x20, 0xA1, 0x14, 0x14, 0x70, 0x4A, 0x91,
+    0x22, 0x05, 0xC5, 0xED, 0x7A, 0x2E, 0x57, 0x50, 0x50, 0xB0, 0x11, 0x42, 0x14, 0x29, 0x70, 0x82,
+    0x82, 0x44, 0x75, 0x13, 0x69, 0x2E, 0x38, 0x61, 0xEC, 0xC7, 0x7B, 0xF6, 0x06, 0x05, 0x14, 0xD1,
+    0x20, 0x66, 0xE5, 0xF5, 0xCF, 0x8C, 0xDF, 0xF7, 0xBE, 0xEF, 0x7D, 0x6F, 0x0C, 0xC8, 0xB8, 0x38,
+    0x00, 0xFA, 0xB7, 0xA6, 0x46, 0x07, 0xED, 0x0C, 0x3E, 0xD0, 0xEE, 0x76, 0x4E, 0x7A, 0xEB, 0x4A,
+    0x38, 0x61, 0xD6, 0x4D, 0x89, 0xD3, 0xB7, 0xCE, 0x02, 0x97, 0xF7, 0x3C, 0x70, 0x90, 0x39, 0xA8,
+    0x9B, 0x06, 0x58, 0xBF, 0xB4, 0x09, 0xDC, 0x6E, 0x77, 0xA1, 0xEE, 0xB8, 0xA6, 0x3B, 0xA3, 0xDC,
+    0xC5, 0x2B, 0x3E, 0x5B, 0xA2, 0x40, 0xF6, 0xE4, 0x3D, 0x8F, 0x84, 0x7A, 0x3C, 0x1B, 0xC5, 0x17,
+    0x86, 0xEE, 0x86, 0x5D, 0x9B, 0xED, 0xB7, 0xBB, 0x9B, 0xE6, 0xEA, 0x83, 0x60, 0x09, 0xDF, 0xDC,
+    0xC0, 0xF1, 0x04, 0x08, 0x79, 0x69, 0x3C, 0x81, 0x8C, 0x37, 0x81, 0xCA, 0xE6, 0xED, 0xA0, 0xA2,
+    0x75, 0xDA, 0x37, 0x30, 0xED, 0x80, 0xE2, 0x4E, 0x44, 0x95, 0x79, 0x5C, 0x7F, 0x69, 0x8C, 0x42,
+    0x74, 0x8F, 0xE8, 0x70, 0x67, 0x67, 0x0E, 0x70, 0x46, 0x6A, 0xC9, 0x6F, 0x03, 0x9B, 0x47, 0xDF,
+    0xB1, 0x7D, 0x15, 0xAB, 0x88, 0x17, 0xD0, 0x38, 0xF6, 0x09, 0xD3, 0xB0, 0xBD, 0xDE, 0xAA, 0x1F,
+    0xED, 0x9A, 0x75, 0xE5, 0xFC, 0xE9, 0x5B, 0x46, 0xB9, 0xCB, 0x6E, 0x73, 0x86, 0x03, 0x50, 0xAB,
+    0x6E, 0xAA, 0x7B, 0xF5, 0xFA, 0x25, 0x63, 0xCA, 0xDB, 0xED, 0xD9, 0x9C, 0x69, 0xF8, 0xCD, 0x33,
+    0xEA, 0x4E, 0x79, 0xEA, 0x45, 0x34, 0x4E, 0x6E, 0x6F, 0x5B, 0x1A, 0xAA, 0xD5, 0x6D, 0x3A, 0x28,
+    0x7A, 0x10, 0xE6, 0x9D, 0x99, 0xAB, 0x83, 0xBD, 0x43, 0x8A, 0x79, 0xC4, 0x79, 0xE0, 0x35, 0x4E,
+    0xAC, 0x86, 0x6A, 0xC1, 0xE8, 0x38, 0xB7, 0x4A, 0xF8, 0x31, 0xF1, 0x3B, 0xE7, 0x9E, 0x9F, 0x39,
+    0x89, 0x57, 0x77, 0x76, 0x3E, 0x5F, 0xCD, 0x9C, 0x80, 0xED, 0x34, 0x2D, 0xDF, 0x58, 0x40, 0x2F,
+    0xC1, 0x74, 0x51, 0x38, 0xDD, 0x2A, 0xEA, 0x2A, 0xFA, 0x78, 0xE7, 0xC6, 0x38, 0x9B, 0xD1, 0xF2,
+    0xF8, 0x0C, 0xD9, 0x32, 0x0F, 0x6A, 0x40, 0xD2, 0xC1, 0xEC, 0x7F, 0xD6, 0x59, 0x4A, 0x16, 0x25,
+    0xA0, 0xA2, 0x0E, 0xB9, 0xE3, 0xE0, 0x1F, 0xE2, 0x6B, 0x10, 0x06, 0x0C, 0x49, 0x9F, 0xF4, 0x69,
+    0x94, 0x9F, 0x8A, 0xAA, 0x9B, 0x7E, 0x59, 0xC8, 0x82, 0xF1, 0xDA, 0x8B, 0xC6, 0xB6, 0x35, 0x44,
+    0x4B, 0x43, 0x7F, 0xB8, 0xFC, 0xE0, 0x7B, 0x57, 0x38, 0xC0, 0xCA, 0x51, 0x03, 0x15, 0xC7, 0x6B,
+    0x30, 0x1D, 0x09, 0x51, 0x4B, 0x34, 0xE4, 0xF4, 0xF8, 0x17, 0x1A, 0x36, 0x2C, 0xDD, 0xFF, 0xFB,
+    0xE9, 0x01, 0x9F, 0x0C, 0xDD, 0x6F, 0xAB, 0x61, 0x03, 0xDB, 0xF7, 0x5B, 0x6C, 0x6C, 0x20, 0xF9,
+    0x97, 0x13, 0x8F, 0x7C, 0x2B, 0x56, 0xFB, 0xE1, 0x08, 0x74, 0x6D, 0x6B, 0x8B, 0xD8, 0x3C, 0x1A,
+    0xE4, 0xE9, 0x22, 0xEB, 0x6D, 0x9C, 0xC5, 0x53, 0x5D, 0x1A, 0xD2, 0xA0, 0xBC, 0xF2, 0x59, 0xBB,
+    0x76, 0x3D, 0xEB, 0x8A, 0x61, 0x66, 0x77, 0x8B, 0xAE, 0xE8, 0xCE, 0xC5, 0x79, 0xD5, 0xE5, 0x4B,
+    0x94, 0x47, 0xB0, 0xCB, 0xD5, 0x64, 0x47, 0x34, 0xDA, 0xAB, 0xCE, 0x96, 0x76, 0x3F, 0x8A, 0x4F,
+    0xD8, 0x35, 0xC5, 0x0F, 0xBD, 0x0E, 0x4D, 0x39, 0xCB, 0x5A, 0xD4, 0xAF, 0x4C, 0x95, 0x4A, 0x22,
+    0xF2, 0xB2, 0xF0, 0x88, 0x9A, 0x6A, 0xE3, 0x6C, 0x8F, 0x39, 0xDE, 0xE7, 0xC8, 0xE0, 0x6B, 0x66,
+    0xAA, 0xB8, 0xA6, 0x5D, 0xF1, 0x56, 0xD4, 0x77, 0xBB, 0xA2, 0xB5, 0x66, 0x8F, 0xCA, 0xAF, 0xA4,
+    0x7A, 0x7A, 0xF9, 0xBB, 0xC7, 0xCC, 0x5C, 0x73, 0xCA, 0xF7, 0x8B, 0xB2, 0x50, 0x44, 0x69, 0x30,
+    0x14, 0xF2, 0x1A, 0x9C, 0x2E, 0xF0, 0xE5, 0xCA, 0xC9, 0xB9, 0x4B, 0x02, 0x24, 0x36, 0x9A, 0x8E,
+    0xFF, 0xC6, 0xE0, 0x6B, 0x16, 0x33, 0x4C, 0xD1, 0x95, 0xB7, 0x49, 0xC9, 0xE1, 0x2F, 0xF0, 0xF3,
+    0xFC, 0x1A, 0x39, 0x8E, 0x7F, 0xD5, 0x1F, 0xBB, 0xE6, 0x20, 0x00, 0x58, 0x80, 0xB3, 0x58, 0xF0,
+    0x22, 0x2E, 0x14, 0xFF, 0xF5, 0x48, 0x03, 0xDB, 0x8B, 0x2B, 0xDA, 0x10, 0x2F, 0x78, 0x7D, 0xA7,
+    0xC6, 0x71, 0x86, 0xD0, 0x84, 0xD4, 0x1B, 0x72, 0x59, 0x7B, 0xC4, 0x38, 0xE3, 0xD8, 0x37, 0x16,
+    0x5C, 0xF8, 0x39, 0x32, 0x59, 0x3A, 0x12, 0x40, 0x61, 0xDC, 0xF0, 0xB0, 0x29, 0xB6, 0x7A, 0xEA,
+    0x67, 0x3A, 0x5E, 0xBC, 0x11, 0x8B, 0xC8, 0x11, 0x3F, 0x62, 0xCF, 0xDF, 0x3D, 0x0C, 0xC8, 0xAF,
+    0xFE, 0x1A, 0x60, 0x33, 0x1A, 0x10, 0x33, 0xEA, 0xD3, 0xC0, 0xB0, 0x0C, 0xBC, 0x76, 0x9D, 0xE3,
+    0x22, 0x6F, 0xD1, 0xD4, 0xC9, 0xAA, 0x59, 0xD8, 0x34, 0x1C, 0xCD, 0xBA, 0x8C, 0xE9, 0x2C, 0x35,
+    0x9B, 0xAF, 0x4E, 0x39, 0x51, 0x7F, 0xB4, 0x78, 0x1A, 0x2D, 0x85, 0x8A, 0xCA, 0x93, 0xE5, 0x6A,
+    0x61, 0x16, 0x56, 0xCE, 0xE0, 0x84, 0xC6, 0xB6, 0x1B, 0x85, 0x26, 0x9E, 0x26, 0xF6, 0x74, 0x25,
+    0x79, 0x2D, 0x58, 0x9D, 0x9F, 0x39, 0xDD, 0x9F, 0x3C, 0x32, 0xCF, 0xE9, 0x74, 0x16, 0x69, 0xE4,
+    0xE5, 0x83, 0x0A, 0x68, 0x3E, 0xED, 0x61, 0x89, 0x6A, 0xEE, 0x08, 0xF1, 0x5F, 0xD4, 0x1E, 0x8D,
+    0xEA, 0xC6, 0xFE, 0xD6, 0x7E, 0xC0, 0x5F, 0xF9, 0x28, 0xB9, 0x20, 0xE9, 0x75, 0x36, 0x24, 0x37,
+    0xE1, 0x4A, 0x74, 0xC6, 0x53, 0x54, 0x4F, 0x38, 0xE6, 0xA0, 0x46, 0xD2, 0xF3, 0x3A, 0x7B, 0xC1,
+    0x8D, 0x40, 0x18, 0x18, 0xA4, 0x70, 0x82, 0x68, 0x96, 0x23, 0x12, 0x23, 0xB4, 0x29, 0xDB, 0x57,
+    0x20, 0xBD, 0x40, 0xB1, 0xDE, 0xDA, 0xB3, 0xD7, 0x05, 0x93, 0xB7, 0x93, 0x69, 0x34, 0x9C, 0x78,
+    0xCE, 0x58, 0xD9, 0xA3, 0x8E, 0x1D, 0xA1, 0xDD, 0xFF, 0x84, 0x95, 0xD7, 0xAC, 0x07, 0xB1, 0x38,
+    0x4F, 0xC9, 0xE1, 0xE5, 0xB4, 0x7D, 0x4E, 0x3A, 0xCB, 0x10, 0x99, 0x60, 0x0D, 0xDD, 0xA4, 0x9D,
+    0x3A, 0x64, 0x88, 0x4A, 0x6A, 0xDE, 0xC6, 0x49, 0x3C, 0x5B, 0xF7, 0xD0, 0x4F, 0x2E, 0x2C, 0x21,
+    0x10, 0xA2, 0x1E, 0x1B, 0x93, 0x18, 0x84, 0x9B, 0x99, 0x0B, 0x39, 0x56, 0x8B, 0x7B, 0xB7, 0xE2,
+    0x88, 0x1B, 0xBA, 0x84, 0xF9, 0xD6, 0x43, 0x31, 0x1D, 0x9C, 0x3F, 0xB1, 0x2A, 0x5B, 0x3F, 0xB1,
+    0x49, 0xA4, 0x4A, 0x82, 0x52, 0x55, 0x13, 0x99, 0x7C, 0xDF, 0x8F, 0x20, 0xFC, 0xFA, 0xC8, 0x25,
+    0x1D, 0xDE, 0x0D, 0x23, 0x46, 0xC3, 0x55, 0x12, 0x2A, 0x85, 0x63, 0xFC, 0x56, 0xFA, 0x0D, 0xC5,
+    0xFE, 0xC4, 0x24, 0x7D, 0x26, 0x8D, 0xE7, 0x9B, 0xB3, 0xFC, 0x39, 0x30, 0xB2, 0x17, 0xCE, 0x57,
+    0x72, 0x56, 0xCB, 0x89, 0x50, 0x3E, 0x4C, 0xBA, 0x65, 0xDC, 0x4F, 0xC2, 0x27, 0x89, 0x76, 0x92,
+    0xAD, 0x11, 0xAB, 0x31, 0x9D, 0xE2, 0x61, 0x55, 0x8A, 0x6A, 0x9A, 0xA8, 0x13, 0x36, 0x4C, 0xA2,
+    0x70, 0x22, 0x5A, 0xC3, 0x94, 0x57, 0x64, 0x78, 0xFF, 0x21, 0xD9, 0x96, 0xD8, 0x2A, 0xD2, 0x10,
+    0x24, 0x14, 0x86, 0x66, 0x9B, 0xB7, 0x58, 0xFB, 0x9D, 0xD4, 0x4F, 0x07, 0x31, 0x49, 0x32, 0x18,
+    0x91, 0xD3, 0xEE, 0xC9, 0x62, 0x1D, 0x0A, 0x59, 0x4C, 0xA9, 0xDC, 0xD8, 0x87, 0xD5, 0x8F, 0xE7,
+    0x59, 0x5B, 0xEA, 0xC4, 0x4F, 0x24, 0x62, 0xB3, 0x78, 0xFC, 0x66, 0xD6, 0x8D, 0xF6, 0x22, 0xA9,
+    0x1B, 0x0A, 0x91, 0xD5, 0xB3, 0xE7, 0x72, 0x1A, 0x56, 0x7A, 0xB1, 0x4E, 0x15, 0xC5, 0x64, 0x4C,
+    0xED, 0xCD, 0x5B, 0x46, 0xF8, 0x48, 0xBB, 0x2D, 0xFF, 0xB1, 0x4D, 0xAE, 0x0E, 0xB9, 0xAE, 0xE4,
+    0x79, 0xBB, 0xC6, 0x31, 0x48, 0x32, 0x9D, 0x3E, 0x18, 0x39, 0xA6, 0xC5, 0xDC, 0xF4, 0x72, 0x24,
+    0x42, 0x66, 0x78, 0xE6, 0x66, 0xCE, 0x79, 0xDC, 0x77, 0x21, 0xDF, 0x08, 0x8C, 0x1D, 0x4F, 0xA5,
+    0xE5, 0xE4, 0x39, 0x99, 0xEC, 0xC9, 0x36, 0x78, 0xC3, 0x93, 0x56, 0x93, 0x5E, 0x30, 0x1C, 0xAC,
+    0x22, 0x2F, 0x9C, 0xCC, 0xE1, 0xF6, 0x98, 0xC3, 0x30, 0x35, 0xA3, 0xA4, 0x24, 0xC9, 0xCB, 0x0C,
+    0x11, 0xFE, 0xCB, 0xF8, 0x13, 0xB5, 0x55, 0x3D, 0x6E, 0xDD, 0x46, 0x10, 0x1E, 0x92, 0x12, 0x16,
+    0xF0, 0x02, 0xD9, 0xC6, 0x5D, 0x8A, 0x3D, 0x41, 0xC0, 0x0B, 0xC8, 0x5A, 0xAA, 0x52, 0x29, 0x17,
+    0x51, 0xED, 0x1B, 0xC4, 0x27, 0x88, 0x48, 0xF8, 0x04, 0x3E, 0x82, 0x4A, 0x1F, 0x21, 0x45, 0x9C,
+    0xDD, 0x34, 0x71, 0x91, 0x66, 0x0D, 0x17, 0x2E, 0x4D, 0x28, 0x01, 0x52, 0x7A, 0x0D, 0xAC, 0x64,
+    0x0A, 0x5A, 0x72, 0xFC, 0x0D, 0x1F, 0x6D, 0xC8, 0x70, 0x15, 0xC0, 0xEF, 0xE1, 0xF1, 0x01, 0x6F,
+    0x38, 0xFB, 0xCD, 0xDF, 0x37, 0xDF, 0x12, 0xC9, 0xC7, 0x05, 0xAA, 0x0B, 0x91, 0x0D, 0x44, 0xD3,
+    0x6A, 0xD0, 0xCC, 0x9D, 0xE3, 0x42, 0xCC, 0x49, 0xDD, 0x9E, 0x93, 0x8D, 0x44, 0x9E, 0xA8, 0x81,
+    0x8F, 0xE1, 0x99, 0x7A, 0x4E, 0x35, 0x73, 0x30, 0xD7, 0xE7, 0x72, 0x92, 0x16, 0x22, 0x95, 0x89,
+    0x5A, 0x38, 0xC1, 0xBF, 0x91, 0x37, 0xCC, 0x2B, 0x0C, 0x29, 0xBC, 0xEB, 0x0B, 0xA9, 0x0F, 0x85,
+    0x8E, 0xAB, 0xFC, 0xBD, 0x90, 0xD5, 0xB3, 0x48, 0xEE, 0x49, 0xA0, 0xD2, 0x13, 0x75, 0x8F, 0x05,
+    0x15, 0x87, 0xA2, 0xBC, 0x02, 0x72, 0xB5, 0x9C, 0x77, 0xEB, 0x21, 0x9C, 0x87, 0x2F, 0x0E, 0x75,
+    0x16, 0xF1, 0x3C, 0xCE, 0xCF, 0xE7, 0x9D, 0x49, 0xA8, 0x76, 0xA0, 0x6A, 0x46, 0x26, 0x70, 0xDA,
+    0x32, 0x11, 0xE4, 0x35, 0x5F, 0x1C, 0x32, 0x23, 0x35, 0x89, 0x76, 0xC9, 0xF2, 0xB2, 0x7E, 0x27,
+    0xB1, 0x23, 0x1F, 0x1C, 0x74, 0x1D, 0xF5, 0x9D, 0x64, 0xCC, 0x92, 0x1D, 0x60, 0xD0, 0x37, 0x7C,
+    0x91, 0xBF, 0x5D, 0x90, 0x7D, 0xE7, 0xB9, 0xDB, 0x15, 0x3E, 0xAD, 0xD9, 0xE3, 0x84, 0x8A, 0xB4,
+    0x41, 0x19, 0x1E, 0x05, 0x4B, 0x3A, 0x0D, 0xB0, 0x06, 0x1E, 0x40, 0x93, 0x54, 0x01, 0x27, 0x79,
+    0xC1, 0x1F, 0xED, 0x90, 0xD7, 0x08, 0x07, 0xC4, 0x0A, 0xFE, 0x80, 0xD4, 0x9C, 0x77, 0xCD, 0xF4,
+    0x91, 0x5A, 0x26, 0x7D, 0x95, 0xEB, 0xAC, 0xC3, 0x77, 0xC0, 0xFC, 0xE9, 0x01, 0xD9, 0xBF, 0x47,
+    0x75, 0x95, 0xE9, 0xF1, 0xC3, 0x95, 0x05, 0x3C, 0x00, 0xAE, 0x81, 0x87, 0xB4, 0x21, 0xAD, 0x68,
+    0xE8, 0x13, 0xEA, 0xFD, 0xF2, 0x5F, 0xFA, 0xE6, 0x69, 0xFB, 0x8F, 0x8A, 0x2D, 0xC7, 0x15, 0xCA,
+    0x4B, 0xAD, 0xC8, 0x03, 0x33, 0x08, 0xEA, 0xF6, 0x69, 0xAE, 0xE6, 0x8A, 0xE1, 0xE8, 0x82, 0x0B,
+    0x3A, 0x3D, 0xB9, 0xAE, 0x8B, 0xE3, 0xC8, 0x96, 0x93, 0xFB, 0x8B, 0x5F, 0x98, 0x04, 0x63, 0x36,
+    0x63, 0x53, 0x54, 0x6E, 0x96, 0x7A, 0xFE, 0x91, 0x31, 0x02, 0x19, 0x9D, 0x54, 0xF3, 0xEF, 0x3A,
+    0x85, 0x93, 0x11, 0x90, 0x77, 0x68, 0xDC, 0x1D, 0xE6, 0x52, 0xC5, 0x5F, 0x68, 0x6B, 0xC0, 0x50,
+    0x61, 0x5C, 0x01, 0xD5, 0x70, 0x6C, 0xA6, 0x0A, 0x73, 0xCB, 0x35, 0x68, 0x94, 0xEA, 0xBB, 0xAC,
+    0x53, 0x73, 0x53, 0xF4, 0xD8, 0x7C, 0x28, 0x66, 0x54, 0x69, 0x36, 0x51, 0x27, 0xB6, 0xC1, 0x8C,
+    0x7D, 0x1B, 0x4C, 0x74, 0x4F, 0x07, 0x13, 0x1C, 0x78, 0x10, 0x2C, 0x77, 0x30, 0x20, 0xD8, 0x20,
+    0x3F, 0x9D, 0xC6, 0xCC, 0xA8, 0x99, 0x37, 0x78, 0x14, 0x4A, 0x1A, 0x3D, 0x23, 0x74, 0x8B, 0x4C,
+    0xB7, 0x19, 0x6F, 0xD1, 0x33, 0x1E, 0xF1, 0xCC, 0xC4, 0x83, 0x0F, 0xE8, 0x51, 0xEA, 0x43, 0x3D,
+    0x83, 0x93, 0xFD, 0x19, 0x7A, 0xF0, 0x66, 0x22, 0x75, 0x0D, 0x1A, 0xCC, 0xBE, 0x23, 0x16, 0xE3,
+    0xAB, 0x4C, 0xED, 0x6B, 0x26, 0x9B, 0xDC, 0xD8, 0x66, 0xC5, 0x68, 0x8A, 0xC7, 0xA3, 0xD0, 0xD5,
+    0xFB, 0x1F, 0xD9, 0x0F, 0x2F, 0xF0, 0x78, 0x8E, 0x69, 0x9F, 0xA1, 0x2C, 0xA6, 0x68, 0x11, 0xCE,
+    0xBE, 0x02, 0xC4, 0xF0, 0xEB, 0x9E, 0x42, 0x55, 0x93, 0x41, 0x51, 0xEF, 0x03, 0xFD, 0xC1, 0x91,
+    0x8E, 0xF4, 0xF3, 0x9D, 0x11, 0xE3, 0x84, 0xEF, 0x80, 0x47, 0x26, 0xCD, 0xCD, 0x42, 0xEE, 0x4F,
+    0x30, 0x38, 0xFB, 0xAE, 0x9A, 0x41, 0xD7, 0xFE, 0x6C, 0x24, 0xFB, 0x36, 0x93, 0xBE, 0x99, 0xC1,
+    0x4D, 0x18, 0x19, 0x5C, 0xF5, 0xA7, 0x85, 0x7A, 0x24, 0xE4, 0xA3, 0x45, 0x86, 0x58, 0x6C, 0xF8,
+    0xF0, 0xB0, 0x45, 0xB9, 0xFC, 0x0D, 0x94, 0x74, 0xE0, 0x9A, 0x01, 0x2F, 0x4E, 0xBA, 0xFD, 0x44,
+    0x21, 0xFA, 0x81, 0x8E, 0xDC, 0xB0, 0x98, 0x7F, 0x4A, 0xC3, 0x09, 0x84, 0x43, 0x8B, 0xB0, 0x15,
+    0xE6, 0xE3, 0xE4, 0xC2, 0xD2, 0xD2, 0xA3, 0x03, 0x3A, 0x80, 0xCF, 0x21, 0x02, 0xFF, 0x17, 0x95,
+    0xE8, 0x18, 0xDA, 0xB1, 0x06, 0x06, 0xE9, 0x5F, 0x43, 0x2E, 0xB2, 0xA7, 0x19, 0x81, 0x5F, 0xBA,
+    0xB3, 0xF1, 0x02, 0x81, 0x8F, 0xA1, 0x7E, 0xAE, 0x2E, 0xBD, 0xA3, 0x05, 0xF4, 0xF3, 0xA7, 0x3C,
+    0x20, 0x70, 0xE8, 0x63, 0x8B, 0xA0, 0xD8, 0x97, 0xA8, 0xDF, 0x23, 0xF0, 0x25, 0x7D, 0x43, 0x0F,
+    0x51, 0xE3, 0x4A, 0xE4, 0xB8, 0xA5, 0x4D, 0x9B, 0x54, 0x36, 0xA9, 0x2E, 0x58, 0x43, 0xC6, 0x1E,
+    0xBA, 0xE0, 0xA1, 0x55, 0x4E, 0x8C, 0x63, 0x5D, 0xA0, 0x37, 0x5C, 0xC3, 0x38, 0x78, 0xB2, 0x5F,
+    0x19, 0x2B, 0x50, 0x7C, 0x70, 0xB1, 0x17, 0xE5, 0x84, 0x54, 0xE0, 0xD1, 0x1C, 0xEF, 0x87, 0xC2,
+    0xA9, 0x75, 0xAD, 0x65, 0xD5, 0xE9, 0xF7, 0xBD, 0x86, 0x72, 0x22, 0xBE, 0xA2, 0x14, 0x67, 0x01,
+    0x45, 0x4D, 0x7B, 0x0A, 0x55, 0xC7, 0x4B, 0xAA, 0x0A, 0xC2, 0x5C, 0x40, 0x0A, 0x0F, 0xAB, 0x1D,
+    0x49, 0x00, 0x10, 0x45, 0x8B, 0x76, 0xB2, 0x03, 0xD4, 0x02, 0x54, 0x16, 0xE3, 0xA0, 0x93, 0x85,
+    0x11, 0xB7, 0xC1, 0x02, 0x63, 0xFF, 0x95, 0x51, 0x4D, 0x08, 0xC4, 0x27, 0x22, 0x4E, 0x42, 0x01,
+    0xCC, 0xA9, 0xDD, 0xF4, 0x7D, 0x27, 0xF2, 0x3B, 0xD5, 0xAD, 0x65, 0xC3, 0x56, 0x33, 0xD4, 0x03,
+    0xE4, 0xD2, 0xD9, 0xC9, 0x88, 0x9B, 0x52, 0x97, 0x36, 0xAA, 0x0C, 0x59, 0x7B, 0x97, 0x80, 0x80,
+    0x6B, 0x03, 0x02, 0x0A, 0x36, 0x89, 0xE0, 0xDC, 0xBF, 0x87, 0x12, 0x7D, 0xBE, 0xEC, 0x44, 0x71,
+    0xBF, 0x5C, 0x87, 0x58, 0xAD, 0x9E, 0x07, 0xAC, 0x68, 0xC0, 0x9D, 0x39, 0x08, 0xA5, 0x21, 0x96,
+    0x2A, 0xEB, 0xDC, 0x42, 0x55, 0xB9, 0x02, 0xCF, 0x7D, 0x46, 0xF9, 0x5D, 0x0F, 0xFE, 0x2E, 0x3F,
+    0x7F, 0x46, 0x14, 0x98, 0xFF, 0xF1, 0xF9, 0x04, 0xA5, 0x55, 0xB1, 0x8E, 0x1D, 0x35, 0x14, 0xBD,
+    0x33, 0x8E, 0x32, 0x52, 0x2C, 0x31, 0x14, 0x54, 0x41, 0xC4, 0x0D, 0x05, 0x05, 0x2B, 0xFF, 0x00,
+    0xC8, 0x03, 0x48, 0xA1, 0xA0, 0x78, 0xDB, 0x53, 0xA4, 0xA6, 0xE2, 0x0B, 0x36, 0x1E, 0xD2, 0x50,
+    0x50, 0x90, 0x4F, 0xA0, 0x41, 0x8A, 0x12, 0x4A, 0xDA, 0xC4, 0x13, 0xB6, 0xA0, 0x88, 0x04, 0x56,
+    0xB6, 0x48, 0x91, 0x62, 0x27, 0x61, 0x1B, 0xA0, 0x58, 0x27, 0x78, 0xC5, 0xB0, 0xEB, 0x99, 0xCB,
+    0xB1, 0xDF, 0x8B, 0xB2, 0x0D, 0x12, 0x79, 0xF1, 0x9B, 0x37, 0xEF, 0xC9, 0x63, 0x1F, 0xDF, 0x39,
+    0xF7, 0xDC, 0x73, 0x89, 0xCA, 0x68, 0x78, 0x24, 0x32, 0x9C, 0x88, 0x1C, 0x2F, 0x44, 0x5C, 0x31,
+    0x55, 0x33, 0x31, 0xD5, 0xA9, 0x5A, 0x48, 0x24, 0x99, 0x48, 0x4C, 0x26, 0x50, 0x13, 0xB9, 0x23,
+    0xF9, 0x0C, 0x2B, 0x64, 0xC0, 0xBF, 0x36, 0x38, 0x4F, 0xED, 0x68, 0x22, 0x29, 0x8F, 0x25, 0x7A,
+    0x10, 0x89, 0xCC, 0x50, 0xE3, 0xF6, 0xCB, 0x9D, 0x89, 0xCC, 0xB7, 0x1C, 0xC8, 0xAE, 0xB8, 0x27,
+    0x97, 0x8F, 0x60, 0x7C, 0x6B, 0xEC, 0x24, 0x93, 0xF2, 0x6D, 0xCA, 0x37, 0xBF, 0x3E, 0x1D, 0x27,
+    0x10, 0xA9, 0x81, 0xE8, 0x3A, 0x96, 0x84, 0x32, 0x73, 0xFD, 0xEA, 0x4D, 0x33, 0xA7, 0x96, 0xF9,
+    0x3E, 0xAF, 0x92, 0x19, 0xEC, 0xD7, 0x53, 0x13, 0x5D, 0x67, 0xDB, 0x80, 0x83, 0x69, 0x69, 0x83,
+    0x1A, 0x59, 0xCC, 0x92, 0x79, 0x30, 0x4B, 0xAA, 0xF8, 0x5A, 0x4F, 0x2F, 0x86, 0x9C, 0x72, 0xE4,
+    0x64, 0x10, 0xE7, 0xF0, 0x7A, 0x48, 0x3C, 0x90, 0x59, 0xA8, 0x3D, 0x08, 0x75, 0x68, 0xFB, 0xAD,
+    0x91, 0xF4, 0x47, 0xA3, 0xE4, 0xBB, 0x74, 0xC6, 0xFD, 0x3B, 0x17, 0xC7, 0x42, 0xF5, 0xD1, 0x17,
+    0x82, 0x0F, 0x07, 0xE6, 0xA4, 0x22, 0xEF, 0xA7, 0x66, 0xB2, 0xBD, 0xFD, 0x2C, 0x36, 0x80, 0x70,
+    0x6D, 0x68, 0x47, 0xAE, 0x80, 0x64, 0xBC, 0xE3, 0x24, 0xF8, 0x78, 0x50, 0x27, 0x53, 0x41, 0xD9,
+    0xB9, 0x4C, 0xF2, 0xB7, 0x48, 0xF7, 0x0C, 0x55, 0xDD, 0xEE, 0xD6, 0x28, 0xCD, 0x48, 0x15, 0xDE,
+    0x6A, 0x67, 0x87, 0xEA, 0x87, 0x9E, 0x54, 0x2A, 0x84, 0x6F, 0x0B, 0x66, 0xAF, 0x7E, 0x7E, 0x44,
+    0xFC, 0x37, 0x73, 0xC7, 0x18, 0xC1, 0xEE, 0xF3, 0x57, 0x99, 0x94, 0xDE, 0xA9, 0x51, 0x79, 0xFB,
+    0x20, 0x34, 0x0C, 0xA8, 0x9A, 0xB9, 0x67, 0xE2, 0xEF, 0x29, 0x3F, 0x81, 0x5E, 0x4C, 0xA8, 0x30,
+    0xC5, 0x77, 0x40, 0x11, 0xF6, 0x34, 0xF3, 0x1E, 0xC7, 0x0D, 0xDB, 0x5F, 0x1E, 0xD5, 0x0C, 0x6E,
+    0x27, 0x1D, 0xDF, 0x35, 0x03, 0xD9, 0x22, 0x1A, 0x7E, 0x71, 0xB9, 0xAE, 0xB3, 0xEC, 0x0D, 0x7B,
+    0xC9, 0xBD, 0x18, 0x21, 0x43, 0xA2, 0x94, 0x2F, 0x3D, 0x91, 0x2E, 0xA4, 0x02, 0x9A, 0x2A, 0x4C,
+    0xE9, 0x7E, 0x23, 0xA0, 0x7A, 0xE9, 0x24, 0x47, 0x24, 0xA3, 0x99, 0xD4, 0x41, 0x6A, 0x9E, 0xCD,
+    0x4D, 0x72, 0x3C, 0x1B, 0x9E, 0xDA, 0xD3, 0xDD, 0xAC, 0x36, 0x47, 0x6F, 0xAA, 0xD3, 0xBB, 0x02,
+    0xD1, 0x6B, 0x7E, 0x99, 0x72, 0x08, 0x52, 0xFB, 0xAC, 0xC4, 0x75, 0xC2, 0xB7, 0x02, 0x11, 0x8C,
+    0xCB, 0x8B, 0x98, 0xC4, 0x58, 0x50, 0x5E, 0x1D, 0xE4, 0xBD, 0x2B, 0xA8, 0x9D, 0x01, 0xC2, 0xA3,
+    0xDD, 0x92, 0x6B, 0xF9, 0x0F, 0x69, 0xF6, 0x1A, 0xD9, 0x19, 0xED, 0x2A, 0xA8, 0x9F, 0xA3, 0x7A,
+    0xCE, 0x1C, 0x99, 0x47, 0xF3, 0x7B, 0x87, 0xF7, 0x46, 0xBD, 0x75, 0xF6, 0x8F, 0xD8, 0xF2, 0x4C,
+    0x6E, 0xD9, 0x14, 0x41, 0x10, 0x13, 0xE8, 0xF9, 0x90, 0xA8, 0xBA, 0x25, 0x92, 0x80, 0x4E, 0x65,
+    0x68, 0xF3, 0x07, 0xA9, 0xD1, 0x83, 0x19, 0x4C, 0x6F, 0x3A, 0xDB, 0x95, 0x2C, 0xE6, 0x9A, 0xD5,
+    0x7D, 0x55, 0xD2, 0x70, 0xB9, 0x07, 0xD9, 0xD8, 0xA9, 0x3C, 0xA2, 0xC2, 0x3C, 0xC0, 0x4D, 0x8F,
+    0x6A, 0x92, 0xF8, 0x1D, 0x08, 0x46, 0x90, 0x0B, 0xBD, 0xE0, 0xE3, 0xA8, 0x24, 0x9F, 0x4C, 0x7B,
+    0x85, 0xEC, 0xFF, 0xB7, 0x4D, 0xDE, 0xF0, 0xE9, 0x5E, 0xFB, 0x60, 0xDC, 0x7D, 0xAB, 0x6C, 0xC9,
+    0x56, 0xD1, 0x23, 0x91, 0x2E, 0x2F, 0x67, 0xB8, 0x08, 0x36, 0xAC, 0x0D, 0xA4, 0xC7, 0xFA, 0x75,
+    0x70, 0x44, 0x6F, 0xD4, 0x1D, 0x39, 0x07, 0xD5, 0x22, 0xE9, 0x59, 0x07, 0x0B, 0x55, 0x4F, 0xC0,
+    0x19, 0x56, 0xB8, 0xC7, 0xBE, 0xCD, 0xE2, 0x3A, 0x5E, 0x9A, 0xD4, 0x4E, 0x66, 0xD0, 0x1E, 0x6A,
+    0xFD, 0x64, 0x12, 0xA9, 0x1D, 0xE1, 0x48, 0x03, 0x77, 0xEE, 0x78, 0x22, 0xD4, 0x22, 0xB9, 0x8D,
+    0xC2, 0x9A, 0xF1, 0x03, 0xB2, 0x67, 0xA3, 0xF8, 0x93, 0x81, 0x5A, 0x44, 0x73, 0xF1, 0x06, 0x4C,
+    0x0A, 0x6E, 0xB4, 0xF0, 0xD4, 0x2C, 0x2A, 0xE8, 0x80, 0x6D, 0xB4, 0x80, 0xAF, 0x98, 0x79, 0xB2,
+    0x9D, 0xAB, 0x13, 0xE0, 0x40, 0x5A, 0xA6, 0x6B, 0xAE, 0x52, 0x83, 0x42, 0x5F, 0x8B, 0x6D, 0xCC,
+    0xA4, 0x93, 0xEE, 0x68, 0x03, 0x04, 0x9B, 0xE0, 0x80, 0x70, 0x64, 0x32, 0x28, 0x9F, 0x93, 0x99,
+    0x16, 0x47, 0xC6, 0x0E, 0xEA, 0x30, 0xC8, 0xBF, 0x80, 0xE1, 0xEA, 0x59, 0x31, 0x43, 0xF8, 0xA4,
+    0x17, 0xFA, 0x2F, 0xB1, 0x6D, 0x05, 0x72, 0x5E, 0x6C, 0xDD, 0x56, 0x20, 0xFA, 0x63, 0xF0, 0x98,
+    0xAA, 0x33, 0xEE, 0xDE, 0x6F, 0xFC, 0x26, 0x0E, 0x81, 0x46, 0x80, 0xF2, 0xD4, 0x81, 0x45, 0x6A,
+    0xA2, 0xED, 0xCC, 0x37, 0x41, 0x44, 0x86, 0x97, 0x17, 0xA7, 0x63, 0x19, 0xB4, 0xB7, 0x9C, 0x6B,
+    0x9B, 0xE4, 0x39, 0xC9, 0xAE, 0xCE, 0x49, 0xF6, 0x6D, 0x30, 0x0B, 0x1F, 0xE4, 0x04, 0x0C, 0x18,
+    0xE3, 0xA3, 0x28, 0x4E, 0x13, 0xCD, 0x80, 0xB0, 0x83, 0xFE, 0x35, 0xB4, 0xCF, 0x93, 0x8C, 0x40,
+    0x90, 0x38, 0xC7, 0x6D, 0x0C, 0xAE, 0x34, 0x80, 0x06, 0xFC, 0xFE, 0x58, 0xA2, 0x62, 0x7E, 0xCC,
+    0x7C, 0x72, 0xFB, 0xF6, 0x2D, 0xBA, 0x00, 0xBE, 0xD7, 0x4F, 0x40, 0xF9, 0x85, 0x75, 0xD0, 0x95,
+    0xFB, 0x01, 0x01, 0xC2, 0x10, 0x92, 0x44, 0xEA, 0x97, 0x76, 0x56, 0x0F, 0xF9, 0x69, 0xDA, 0x9B,
+    0xCD, 0xE1, 0xB5, 0x03, 0xFC, 0x31, 0xC9, 0xFC, 0xC4, 0x32, 0xAA, 0x33, 0xF4, 0xB1, 0x1C, 0xC5,
+    0x58, 0x0F, 0x2F, 0x69, 0xCF, 0x35, 0xD7, 0xFA, 0x62, 0x7D, 0x55, 0x49, 0xE7, 0xA5, 0xEF, 0x2E,
+    0xDD, 0x5C, 0x68, 0x56, 0x5E, 0xDD, 0x4F, 0x75, 0x42, 0x79, 0xEC, 0xA3, 0x62, 0x4C, 0x6F, 0x3F,
+    0x45, 0xD1, 0xD8, 0xFC, 0xB6, 0x6A, 0x74, 0x62, 0x91, 0xF9, 0xBC, 0x19, 0xBE, 0xBE, 0x1A, 0xCE,
+    0xF7, 0x1A, 0xC8, 0xBB, 0xF4, 0x1A, 0xFF, 0x7A, 0x48, 0x9B, 0x5E, 0xF3, 0x34, 0xD6, 0xB1, 0xB4,
+    0xAD, 0xED, 0x91, 0x5E, 0x71, 0xFC, 0x0B, 0xB5, 0x55, 0x3F, 0x6F, 0xD7, 0x30, 0x10, 0xBD, 0xC4,
+    0x6A, 0x23, 0xEA, 0xC1, 0x3B, 0x0C, 0x59, 0x58, 0x40, 0x82, 0x7C, 0x04, 0x1B, 0x06, 0x56, 0xBA,
+    0x30, 0xFF, 0x76, 0x16, 0xBE, 0x00, 0x22, 0x41, 0x0C, 0x0C, 0x0C, 0xB0, 0xC0, 0x0A, 0x23, 0x74,
+    0x81, 0x0F, 0x00, 0xD8, 0x30, 0xB0, 0x12, 0xC4, 0x07, 0xC0, 0x43, 0x37, 0x86, 0x5A, 0x10, 0xA4,
+    0x20, 0x12, 0x1F, 0xEF, 0x12, 0xDA, 0x32, 0xA2, 0xAA, 0x44, 0x4D, 0x1B, 0x5D, 0x7D, 0xEF, 0xDE,
+    0xFD, 0x7B, 0xA6, 0x4B, 0x3B, 0x54, 0x7D, 0x1F, 0xE8, 0xAD, 0x75, 0x85, 0xDB, 0x25, 0x3C, 0x7B,
+    0xF4, 0xC2, 0x44, 0xF3, 0x69, 0x2E, 0xA6, 0x3A, 0x34, 0xEF, 0x27, 0x35, 0xD9, 0x60, 0xEF, 0x8D,
+    0xD5, 0xD0, 0x3A, 0x5F, 0x25, 0x93, 0x7C, 0x91, 0x75, 0xB2, 0xD1, 0xF3, 0xAC, 0xF8, 0x4B, 0xA8,
+    0x87, 0x89, 0x8E, 0x1E, 0x85, 0xEF, 0x12, 0x6F, 0x21, 0xB6, 0x71, 0xB5, 0x9D, 0xED, 0x76, 0x9E,
+    0xE9, 0x54, 0x8D, 0x05, 0x80, 0xA8, 0x2D, 0x32, 0x99, 0xDE, 0x93, 0x1A, 0x6C, 0x47, 0xB9, 0x09,
+    0xD4, 0x3C, 0xEC, 0x49, 0x7F, 0x4D, 0x54, 0xFC, 0x1A, 0x88, 0x5A, 0xB8, 0x99, 0x19, 0x30, 0x0C,
+    0x3F, 0x76, 0x44, 0x38, 0x44, 0x38, 0x44, 0x4D, 0xA4, 0x92, 0x13, 0x91, 0xC7, 0xDB, 0xF4, 0x82,
+    0x2A, 0x56, 0x9C, 0x52, 0x08, 0x52, 0xC3, 0xD0, 0x4A, 0xDC, 0xB7, 0x64, 0x0E, 0x98, 0x2C, 0xCF,
+    0x05, 0x3F, 0x18, 0xF5, 0x68, 0x12, 0x78, 0x87, 0x4C, 0x59, 0x0D, 0xD5, 0x88, 0x4C, 0x10, 0x96,
+    0x55, 0x86, 0x9D, 0x39, 0x58, 0x8F, 0xEC, 0x7C, 0xD0, 0xC0, 0xB3, 0x40, 0xCA, 0x44, 0xD5, 0xB0,
+    0x82, 0x7A, 0x41, 0xDF, 0xBE, 0x1B, 0x41, 0x11, 0x6C, 0x26, 0x4B, 0xB4, 0xB5, 0xB5, 0x26, 0x72,
+    0x93, 0x2E, 0x76, 0x4D, 0xA8, 0xA3, 0xD4, 0xA0, 0x98, 0xAA, 0x91, 0xEC, 0xD5, 0x09, 0xC9, 0x64,
+    0x90, 0x80, 0x13, 0xCA, 0x47, 0xCD, 0xCB, 0x40, 0xD5, 0x41, 0x4F, 0x85, 0x70, 0xB5, 0x00, 0x34,
+    0x80, 0x50, 0x48, 0x48, 0x02, 0x2C, 0xC8, 0xBE, 0x23, 0xCD, 0x01, 0xC9, 0x48, 0x24, 0xB7, 0xC0,
+    0x5E, 0xDC, 0x73, 0x64, 0xB8, 0x47, 0xD2, 0xC3, 0x1A, 0xA7, 0x16, 0x47, 0x61, 0xC4, 0x1D, 0xA9,
+    0x5F, 0x91, 0x8A, 0x19, 0x28, 0x33, 0x32, 0x6C, 0x4D, 0x20, 0x7B, 0x2F, 0x81, 0x26, 0xE2, 0x46,
+    0xEB, 0xF4, 0xCF, 0x4D, 0xAF, 0x98, 0xC7, 0x92, 0x39, 0x13, 0x23, 0x2B, 0x4F, 0x68, 0x4C, 0x57,
+    0x4E, 0xC8, 0xC3, 0x9B, 0x48, 0x75, 0x00, 0x38, 0xE2, 0x25, 0xF2, 0x79, 0x41, 0xBE, 0x73, 0xED,
+    0x91, 0x9D, 0x27, 0xE4, 0xFF, 0x8E, 0xAF, 0xA3, 0xA9, 0xED, 0x7D, 0x34, 0xD5, 0xBB, 0xD6, 0x24,
+    0x9D, 0x98, 0xB2, 0x49, 0x75, 0x64, 0x35, 0x6B, 0x29, 0x4F, 0x9E, 0x0A, 0xDE, 0x74, 0xC7, 0x8D,
+    0xD5, 0xE1, 0x36, 0xE2, 0x83, 0xBD, 0x92, 0xD4, 0xF4, 0x3E, 0x1D, 0x53, 0x55, 0xA0, 0x49, 0x2D,
+    0xFA, 0x60, 0x0E, 0xBA, 0x95, 0xAB, 0xDD, 0xA0, 0x0C, 0x09, 0x1F, 0x19, 0x84, 0x85, 0xAC, 0x1A,
+    0x4D, 0x4F, 0xFE, 0xF1, 0x8C, 0x3C, 0x39, 0x2E, 0x6C, 0x2D, 0x33, 0x82, 0xA2, 0x24, 0x19, 0x94,
+    0x85, 0x2E, 0x1A, 0x59, 0x25, 0x81, 0x34, 0xDD, 0x6B, 0xF2, 0xDE, 0x29, 0x8E, 0x87, 0x61, 0x4E,
+    0xC6, 0xFA, 0x34, 0xAB, 0x48, 0xB5, 0x5B, 0x5F, 0xB8, 0x62, 0x2E, 0x64, 0x38, 0x11, 0xA5, 0x8E,
+    0x74, 0x32, 0x7E, 0x0A, 0x03, 0x0B, 0x10, 0x8C, 0x96, 0xFA, 0x81, 0x3F, 0x71, 0x1D, 0x8F, 0xA3,
+    0x52, 0x8F, 0x2B, 0x34, 0xE6, 0x89, 0xDE, 0xAC, 0xA6, 0x0A, 0xC5, 0x68, 0x19, 0xCE, 0x3C, 0x2A,
+    0xBE, 0xF2, 0xCA, 0xC8, 0x89, 0x3F, 0x9B, 0x20, 0xD3, 0x2B, 0x5B, 0xD2, 0xBA, 0x75, 0xA0, 0xE4,
+    0x95, 0xEF, 0x56, 0xEC, 0x71, 0x9B, 0x6A, 0x66, 0x4C, 0x00, 0x63, 0x24, 0xE7, 0xA3, 0x08, 0x65,
+    0x26, 0x4C, 0x2F, 0x5A, 0xD2, 0x2C, 0x13, 0x78, 0x6B, 0xBF, 0x64, 0xD0, 0x1F, 0x9B, 0xE1, 0x3C,
+    0xD0, 0xDA, 0x4E, 0x06, 0x95, 0x0F, 0x7F, 0xBC, 0x73, 0x2D, 0xF7, 0x96, 0x7B, 0xCD, 0xC7, 0xE3,
+    0x80, 0xE9, 0x95, 0xFE, 0x98, 0xCF, 0x03, 0x35, 0x7F, 0xD6, 0xFC, 0x94, 0x29, 0xDA, 0x44, 0x00,
+    0x1A, 0x67, 0xDD, 0x5F, 0x3E, 0x19, 0x45, 0x14, 0x57, 0xCE, 0x2D, 0xC1, 0x2E, 0xFC, 0x97, 0x2A,
+    0x62, 0x16, 0xD0, 0x26, 0x78, 0xEF, 0x9C, 0xAC, 0x8A, 0x26, 0xBC, 0x21, 0x05, 0xDD, 0x2D, 0xB1,
+    0xFB, 0x8B, 0xD8, 0x9D, 0x3E, 0xC5, 0x49, 0xF7, 0xE6, 0x63, 0x2F, 0x01, 0xEC, 0x22, 0x9A, 0xDB,
+    0xD9, 0x41, 0x0D, 0x40, 0x52, 0xCF, 0x67, 0x20, 0xC6, 0xD0, 0x62, 0x61, 0x09, 0x64, 0x93, 0x16,
+    0xE9, 0x06, 0xCD, 0x9A, 0x07, 0x05, 0x84, 0xE6, 0xEF, 0x89, 0x9C, 0x30, 0x2A, 0xF5, 0x53, 0xE9,
+    0xB9, 0x28, 0x6D, 0xBF, 0x4E, 0x29, 0x98, 0x62, 0x6B, 0x3A, 0x6C, 0x0C, 0x54, 0xFD, 0x09, 0xBB,
+    0xBA, 0xAF, 0x31, 0xF0, 0x4A, 0x44, 0x5E, 0xB6, 0xBA, 0x09, 0xAD, 0x33, 0xD8, 0x6C, 0x35, 0x01,
+    0x9B, 0xC5, 0xE8, 0xB0, 0xF5, 0x30, 0xDA, 0xD8, 0x7C, 0xF2, 0xE0, 0xC0, 0x09, 0xEE, 0x91, 0x38,
+    0x4B, 0xE6, 0x6A, 0x90, 0x4D, 0x15, 0xC9, 0xD0, 0xDF, 0x64, 0x6F, 0xBF, 0x23, 0x08, 0x56, 0x8F,
+    0xEE, 0x18, 0xD1, 0xC5, 0x2F, 0x41, 0x84, 0x03, 0xE5, 0x4E, 0xF8, 0x05, 0x8C, 0x0E, 0xE5, 0x45,
+    0xEA, 0x5E, 0x54, 0x9F, 0xD7, 0x3A, 0xC3, 0x9D, 0x0B, 0x24, 0xCE, 0xA2, 0xB6, 0x9E, 0x45, 0x84,
+    0xF2, 0x24, 0x22, 0x30, 0x1E, 0x26, 0x21, 0x12, 0x68, 0x79, 0x5C, 0x90, 0xAA, 0x9F, 0xB7, 0x86,
+    0x02, 0xB7, 0x04, 0x7C, 0xE5, 0x8A, 0xD0, 0x69, 0xF3, 0xA3, 0x9C, 0xD0, 0x1D, 0xAE, 0x39, 0xD9,
+    0x0F, 0xFC, 0x5C, 0x6E, 0x0E, 0x3D, 0x98, 0xA8, 0xA6, 0x6A, 0x50, 0xB9, 0x9C, 0xCF, 0xB1, 0x08,
+    0x03, 0xDC, 0x71, 0x79, 0xF1, 0x22, 0x4A, 0x22, 0x02, 0xB8, 0x31, 0x2A, 0x58, 0x2B, 0x58, 0xB7,
+    0x36, 0xB0, 0x9A, 0x1E, 0xDB, 0x1D, 0x60, 0x0A, 0x88, 0xD1, 0xE1, 0x82, 0xEC, 0x2C, 0x68, 0x42,
+    0x09, 0x16, 0xA6, 0xC2, 0x91, 0x69, 0x5E, 0x18, 0x0A, 0x41, 0xE1, 0x77, 0x44, 0x6F, 0x7B, 0xEF,
+    0x19, 0xD0, 0x51, 0xCC, 0xB5, 0x77, 0x5E, 0x9A, 0xB0, 0xC0, 0x50, 0xFB, 0x78, 0x57, 0xF2, 0x3A,
+    0xBC, 0xA8, 0x98, 0x7B, 0x89, 0xD9, 0x00, 0x80, 0x6F, 0xEC, 0x4A, 0xCF, 0xA4, 0x4C, 0x28, 0x46,
+    0x89, 0x43, 0x66, 0xE1, 0x88, 0xFF, 0x70, 0xA2, 0x7F, 0x7F, 0x7E, 0x03, 0xB5, 0x95, 0xB1, 0xAE,
+    0xE5, 0x34, 0x10, 0x86, 0x27, 0xB1, 0xB8, 0x96, 0x36, 0x85, 0x69, 0x68, 0x40, 0xC8, 0x8F, 0x90,
+    0x96, 0x62, 0x75, 0x1D, 0xC4, 0x0B, 0x6C, 0xC1, 0xE5, 0x19, 0x10, 0x42, 0xE2, 0x05, 0x58, 0x9C,
+    0xAD, 0xA9, 0x79, 0x03, 0x90, 0xD0, 0x52, 0xF0, 0x02, 0x2C, 0x36, 0xA2, 0xA0, 0xA0, 0x09, 0xBA,
+    0x2F, 0x90, 0x02, 0x09, 0x24, 0x1A, 0x23, 0x79, 0xA5, 0xEC, 0xC5, 0xF1, 0xEC, 0x3F, 0x3E, 0x39,
+    0x97, 0x12, 0xB1, 0xDA, 0x63, 0x9D, 0xE4, 0x1C, 0x25, 0xF6, 0xEF, 0x6F, 0x66, 0x3C, 0xFF, 0xA1,
+    0x4F, 0x9E, 0xD2, 0xC8, 0xD1, 0xF0, 0x4A, 0x18, 0xE3, 0xEF, 0x14, 0x78, 0x0A, 0x9C, 0xFC, 0x93,
+    0xDD, 0x45, 0x6F, 0x17, 0xFF, 0x2B, 0xF3, 0x2D, 0xF3, 0xCC, 0xDF, 0x90, 0x8B, 0x34, 0xA4, 0xAE,
+    0xE3, 0xEF, 0x16, 0xC7, 0xB9, 0xE7, 0x8D, 0xCE, 0xE3, 0xA1, 0x5A, 0xA8, 0x06, 0xEA, 0x39, 0x53,
+    0xF7, 0x63, 0x7B, 0x32, 0x30, 0x4F, 0x8E, 0x0B, 0x31, 0x27, 0xFD, 0xE2, 0x86, 0xEC, 0x42, 0x14,
+    0x88, 0x54, 0x21, 0x32, 0xBC, 0x93, 0xE7, 0xD4, 0x33, 0xB6, 0x7C, 0x7E, 0x23, 0x9A, 0x54, 0x89,
+    0x74, 0xC6, 0xD6, 0x98, 0x84, 0xF9, 0x4A, 0xDE, 0x30, 0x1F, 0xC2, 0xAB, 0xF9, 0x2B, 0x75, 0xD0,
+    0x7D, 0xA7, 0xD1, 0xF5, 0x75, 0x1A, 0x38, 0x43, 0x5C, 0x6F, 0xF6, 0xB6, 0xE8, 0xBF, 0x77, 0x5D,
+    0x02, 0xEF, 0x8E, 0x37, 0x73, 0xF7, 0x48, 0xC4, 0x03, 0xBD, 0x69, 0xEF, 0x9E, 0x41, 0x61, 0x1A,
+    0x79, 0xBE, 0xC7, 0xEB, 0x40, 0x6A, 0x12, 0xB5, 0xBD, 0x3E, 0x7E, 0x9D, 0x78, 0x24, 0x5B, 0x4E,
+    0x32, 0xA9, 0x9F, 0x5F, 0x0D, 0x2F, 0x70, 0x3E, 0x0B, 0xFA, 0xAF, 0x1E, 0x75, 0x3B, 0xD0, 0x0E,
+    0x50, 0xE6, 0x45, 0xE3, 0xE9, 0x28, 0x94, 0x37, 0x6D, 0xB5, 0x41, 0x0A, 0xFC, 0x44, 0xFD, 0x2E,
+    0x94, 0x4C, 0x07, 0x3F, 0xD1, 0x63, 0xF0, 0x81, 0xED, 0x1A, 0x72, 0x78, 0xA5, 0x0E, 0xDC, 0xFF,
+    0x5D, 0xCC, 0x2E, 0xCB, 0x47, 0x42, 0x72, 0x13, 0x99, 0xAD, 0xC5, 0x2D, 0xC3, 0xCE, 0x85, 0x86,
+    0x3F, 0x12, 0x29, 0x8E, 0xD4, 0x1D, 0x71, 0x03, 0xBB, 0xED, 0x8D, 0xAB, 0xAB, 0x37, 0x93, 0x70,
+    0xF7, 0xE5, 0x94, 0x40, 0x89, 0x4E, 0xC0, 0x91, 0x05, 0x92, 0x0C, 0x4A, 0xE2, 0x85, 0x5C, 0x72,
+    0x2C, 0x29, 0x14, 0xEC, 0xF3, 0x25, 0xC3, 0xC4, 0x9D, 0xBE, 0xF0, 0x4D, 0xDD, 0xE6, 0x33, 0xF5,
+    0xC8, 0x0B, 0xD6, 0x77, 0x55, 0x67, 0x60, 0xEB, 0x6C, 0x13, 0xD2, 0x68, 0xB8, 0x12, 0xB8, 0x45,
+    0x0F, 0x79, 0xD4, 0xF5, 0x7B, 0x54, 0x30, 0x53, 0xA8, 0xF4, 0xEF, 0xF0, 0x2B, 0xC9, 0x59, 0xD1,
+    0xA9, 0x90, 0x99, 0x1F, 0xB7, 0x47, 0x57, 0x88, 0xCC, 0x01, 0x85, 0x79, 0x57, 0x3C, 0x7D, 0x3A,
+    0x60, 0x53, 0x9B, 0x0E, 0x12, 0x64, 0xD9, 0xCF, 0x5C, 0xFC, 0xC4, 0x25, 0x4C, 0xBC, 0x85, 0x49,
+    0x67, 0x3F, 0x0D, 0xC9, 0x47, 0x93, 0xDC, 0x6A, 0x56, 0xCB, 0x8D, 0x62, 0xE9, 0xB8, 0x4E, 0xF7,
+    0x5B, 0x18, 0x08, 0x40, 0xD2, 0xDC, 0x26, 0xDA, 0xD4, 0xE9, 0x4C, 0x6E, 0x6F, 0x4F, 0x6E, 0x2F,
+    0x88, 0x3B, 0xD9, 0xCC, 0x51, 0xA8, 0x37, 0x9D, 0xC7, 0xC5, 0x46, 0xA6, 0xA0, 0x8A, 0xDA, 0x4C,
+    0xB2, 0xAB, 0xFB, 0x49, 0xEA, 0xD0, 0x0A, 0xD6, 0xB1, 0x9B, 0x5B, 0xA5, 0x86, 0xF4, 0x06, 0xF9,
+    0x28, 0x05, 0x0E, 0xBC, 0x50, 0x38, 0xB7, 0x93, 0x8A, 0xD7, 0xA4, 0xEE, 0x4A, 0x8B, 0x84, 0x3E,
+    0x9B, 0x2F, 0x12, 0x45, 0x1E, 0x62, 0x5F, 0x77, 0xD2, 0xE8, 0xF9, 0xFE, 0x05, 0x5D, 0x22, 0x0A,
+    0x1C, 0x9B, 0x13, 0x9B, 0x5C, 0x0F, 0xE8, 0x22, 0x51, 0xA8, 0x63, 0x31, 0x5A, 0x97, 0xBE, 0xBE,
+    0x48, 0x14, 0xAF, 0x93, 0xF8, 0x2D, 0x7C, 0xC9, 0x6E, 0x0E, 0xBF, 0x7F, 0xB8, 0x27, 0xC6, 0x10,
+    0x77, 0x12, 0x31, 0x04, 0x94, 0x2F, 0x53, 0x0B, 0x25, 0x6D, 0x2B, 0x7E, 0xED, 0xBE, 0x5C, 0x68,
+    0x58, 0xC6, 0xA3, 0x89, 0xC9, 0x2C, 0x26, 0xA1, 0x77, 0x2B, 0x8D, 0xD1, 0xAE, 0xAA, 0xE0, 0xA7,
+    0x9B, 0xC7, 0xA8, 0x33, 0xFA, 0xD8, 0xA3, 0xBB, 0x60, 0x8E, 0x8C, 0xE0, 0x03, 0xF3, 0x6A, 0x9E,
+    0x7F, 0xB4, 0x13, 0xDC, 0x28, 0x9A, 0x63, 0x5E, 0x1C, 0xA3, 0xDA, 0x4E, 0xF3, 0xE6, 0x21, 0xA9,
+    0x8D, 0x4E, 0xCE, 0xA0, 0x2B, 0xCE, 0x6D, 0x22, 0x6F, 0x67, 0x3B, 0x7F, 0x7E, 0xEC, 0xD2, 0x5A,
+    0xB6, 0x36, 0x07, 0xE8, 0x90, 0xC0, 0xF1, 0x97, 0x55, 0xFD, 0xC3, 0xD1, 0x71, 0xD5, 0x15, 0x8D,
+    0x1D, 0xD9, 0x24, 0xB3, 0x32, 0xED, 0x48, 0xD9, 0x6F, 0x7B, 0x5F, 0xC6, 0xE8, 0x7E, 0x46, 0x88,
+    0x6E, 0x76, 0x1F, 0x64, 0x9D, 0xBC, 0xAC, 0x17, 0x50, 0xE8, 0xDB, 0xE5, 0x01, 0x3F, 0x0D, 0x7F,
+    0x22, 0xB1, 0x5C, 0x46, 0xB9, 0xC1, 0x72, 0xFC, 0xDC, 0x18, 0x94, 0x70, 0x36, 0x58, 0xA4, 0xBC,
+    0x52, 0xA3, 0x35, 0x09, 0xEF, 0x05, 0x17, 0x0B, 0x71, 0x13, 0x5E, 0x60, 0xC3, 0x1A, 0x05, 0x18,
+    0xB7, 0x93, 0x91, 0x08, 0x9C, 0x78, 0x3E, 0x4C, 0xF8, 0x6A, 0xFF, 0x10, 0xB3, 0x48, 0x6D, 0xF8,
+    0x6F, 0x08, 0x05, 0x6A, 0x6B, 0x58, 0xEA, 0x90, 0xFF, 0x03, 0x6E, 0x7C, 0x7F, 0x1D, 0xF8, 0x19,
+    0x21, 0xA2, 0x77, 0xAF, 0x9A, 0x1F, 0xC8, 0x1F, 0xA9, 0x30, 0xC0, 0xE1, 0x45, 0xAD, 0xB4, 0xAA,
+    0x4B, 0x65, 0xE1, 0xDD, 0x62, 0xEE, 0xDC, 0xFC, 0x50, 0x2C, 0x13, 0xAF, 0xC5, 0x35, 0x71, 0x92,
+    0x6C, 0x05, 0x7D, 0x16, 0xB3, 0x26, 0xBD, 0x3E, 0xB4, 0x75, 0xBB, 0x0E, 0xE9, 0xBD, 0x41, 0x7A,
+    0xBF, 0xFB, 0x56, 0x24, 0x80, 0x0E, 0x70, 0xAC, 0x36, 0xA7, 0xCF, 0x2A, 0xC9, 0xC4, 0x72, 0x2C,
+    0x85, 0x38, 0xFC, 0xDA, 0x4F, 0xF4, 0xAA, 0xE3, 0x25, 0x9D, 0x55, 0x3B, 0x8E, 0xE5, 0x44, 0x14,
+    0xBD, 0x76, 0x21, 0x2C, 0x8D, 0x83, 0x8A, 0x48, 0x3A, 0xA9, 0x9C, 0xC4, 0x3B, 0xA0, 0xAA, 0x23,
+    0x52, 0x82, 0x61, 0x07, 0x04, 0x88, 0x84, 0x0D, 0x30, 0xB8, 0x60, 0x05, 0xBD, 0x88, 0x09, 0x5A,
+    0xB3, 0x86, 0x19, 0x55, 0x21, 0x58, 0x80, 0x25, 0x90, 0x08, 0x48, 0x0C, 0x62, 0x01, 0x9E, 0x91,
+    0x85, 0x2C, 0xB5, 0x9F, 0xEF, 0x9C, 0x53, 0xF6, 0xEB, 0xD7, 0xCD, 0x0C, 0x42, 0x1A, 0xB7, 0xDB,
+    0xDD, 0xF5, 0x3B, 0xE7, 0xDE, 0x73, 0x3F, 0x25, 0x9F, 0xBE, 0x08, 0x4E, 0x87, 0x46, 0x27, 0xC1,
+    0xA3, 0x9B, 0x78, 0x8D, 0x56, 0xA3, 0x24, 0x11, 0x9F, 0xC5, 0x8E, 0x62, 0x66, 0xA9, 0x4E, 0x72,
+    0x19, 0x37, 0xB3, 0xD4, 0xEB, 0x79, 0xDC, 0x2F, 0xD2, 0x6B, 0xE8, 0x74, 0x90, 0x27, 0x2F, 0x6E,
+    0xF4, 0xE4, 0x34, 0x8B, 0x54, 0xB7, 0x58, 0x31, 0x58, 0x08, 0xED, 0x24, 0x2A, 0x76, 0x92, 0x4D,
+    0xDC, 0x80, 0x33, 0x65, 0xD6, 0x07, 0x00, 0xF0, 0x69, 0xE3, 0x4B, 0x49, 0x29, 0x1A, 0x10, 0xB7,
+    0x7F, 0xCB, 0x41, 0x6E, 0x75, 0x14, 0x5D, 0x0A, 0x01, 0xD0, 0xB1, 0x1D, 0xFB, 0xC9, 0x48, 0x3A,
+    0x00, 0x01, 0x09, 0x50, 0x65, 0xB9, 0xC3, 0xF2, 0x2A, 0x15, 0xF6, 0xC3, 0x80, 0x56, 0x0B, 0xE6,
+    0x77, 0xE6, 0xA7, 0x2D, 0x01, 0xB0, 0xDA, 0x38, 0xBA, 0x8A, 0x60, 0x07, 0x04, 0x0E, 0x24, 0xEE,
+    0xC5, 0x79, 0x1F, 0xE1, 0x0A, 0xAC, 0x02, 0xF6, 0x46, 0xC7, 0xB0, 0x44, 0x56, 0xBE, 0x0B, 0x11,
+    0x31, 0xEF, 0x23, 0x29, 0xFB, 0x40, 0x46, 0x25, 0x21, 0x4E, 0x80, 0x0F, 0x2F, 0x20, 0xDC, 0x46,
+    0xB6, 0xA4, 0xA1, 0x9A, 0xA5, 0x81, 0x1A, 0x51, 0xDC, 0x8D, 0xD8, 0x59, 0x0E, 0x97, 0xE0, 0xFB,
+    0x42, 0x2F, 0x57, 0xB9, 0xE2, 0xE0, 0x9B, 0xC7, 0xBE, 0xE3, 0x13, 0xB1, 0x31, 0xED, 0xB3, 0x76,
+    0x00, 0xB0, 0x8D, 0x66, 0x94, 0x97, 0x62, 0x7F, 0x93, 0x44, 0x6D, 0x8E, 0xA7, 0x06, 0xE0, 0x42,
+    0xCC, 0xEA, 0xE6, 0x90, 0xE5, 0x03, 0x0C, 0xBC, 0x35, 0xAB, 0x59, 0x9A, 0xB9, 0x9D, 0x2C, 0x7F,
+    0x46, 0x37, 0x74, 0xD9, 0x67, 0x1F, 0x7D, 0xC0, 0x49, 0xDD, 0xB0, 0x5B, 0x37, 0xEC, 0xD7, 0xC5,
+    0x10, 0x17, 0x5C, 0x3E, 0x53, 0x97, 0x48, 0x91, 0x02, 0xA2, 0xDC, 0x07, 0x37, 0x82, 0x01, 0x02,
+    0x29, 0x79, 0x91, 0x16, 0x19, 0x3C, 0x3E, 0xE2, 0x60, 0x1F, 0xF0, 0x29, 0x8A, 0x2A, 0xF9, 0x94,
+    0x8C, 0x9B, 0x24, 0xBD, 0x46, 0x96, 0x70, 0x16, 0xA1, 0xC5, 0xA7, 0x61, 0x48, 0x1A, 0x84, 0x07,
+    0x9F, 0x80, 0xB9, 0x2F, 0x0E, 0xE7, 0xBE, 0x87, 0xBF, 0x8A, 0x00, 0x69, 0x7D, 0x92, 0xAF, 0xE5,
+    0x79, 0x11, 0xED, 0xB6, 0x7E, 0x6E, 0xD6, 0x66, 0x36, 0x4B, 0x3B, 0x35, 0xB3, 0x9D, 0x60, 0xF3,
+    0x68, 0xCB, 0xAF, 0x1B, 0xEC, 0xD8, 0x65, 0x37, 0xF8, 0xDC, 0xD1, 0xF6, 0xDC, 0x07, 0x1F, 0x13,
+    0x0C, 0x4C, 0x30, 0x02, 0xBE, 0x33, 0x1D, 0x98, 0x9B, 0x24, 0x4D, 0x90, 0x2F, 0x21, 0x43, 0x52,
+    0x3C, 0x88, 0xFA, 0x09, 0xD9, 0x01, 0x25, 0x27, 0x44, 0x3E, 0x3E, 0x3B, 0xE6, 0x42, 0xC9, 0x24,
+    0xEA, 0x26, 0x0F, 0xCE, 0x33, 0x9F, 0x88, 0xC1, 0x10, 0x40, 0x79, 0x69, 0x61, 0x3A, 0xD4, 0x28,
+    0x19, 0x07, 0x2D, 0x4A, 0x9A, 0x40, 0x04, 0xAA, 0x5F, 0x7E, 0xFB, 0x08, 0xE8, 0x12, 0x18, 0x51,
+    0x1C, 0xA3, 0x93, 0x1F, 0x9D, 0x83, 0xD7, 0xB2, 0x56, 0x56, 0x69, 0xFF, 0x5C, 0xE4, 0x59, 0x5D,
+    0x6A, 0x8A, 0x89, 0x48, 0x36, 0xA2, 0x13, 0xA9, 0xDF, 0x09, 0x09, 0x8E, 0x58, 0x92, 0x9F, 0x5C,
+    0xC4, 0x7D, 0xB0, 0x29, 0xED, 0x16, 0x75, 0x23, 0x4A, 0x02, 0x8B, 0x98, 0x2D, 0x2A, 0xC2, 0xF9,
+    0x0C, 0x69, 0x66, 0xD9, 0x6A, 0x26, 0x56, 0xCA, 0xD5, 0xEA, 0x26, 0xE9, 0x7E, 0x66, 0xF0, 0xB1,
+    0xC1, 0xA7, 0x01, 0x72, 0x53, 0x09, 0x54, 0xB0, 0x2D, 0xB6, 0x75, 0x03, 0x5C, 0x50, 0xD0, 0x80,
+    0xAF, 0xCB, 0x7D, 0x44, 0x5A, 0x30, 0x11, 0xBB, 0xC1, 0xCC, 0x7B, 0x99, 0x40, 0x82, 0xA7, 0xF8,
+    0x78, 0xDA, 0x0E, 0x47, 0x84, 0x69, 0xF8, 0x44, 0xE4, 0x22, 0xD4, 0x21, 0x52, 0xB5, 0xD2, 0xEE,
+    0x1A, 0x79, 0x65, 0x11, 0x29, 0x3F, 0x34, 0x73, 0x0A, 0xED, 0x1B, 0xE4, 0xF0, 0xDD, 0x5C, 0xCA,
+    0xD6, 0xA2, 0x90, 0x1D, 0x04, 0xEF, 0x7E, 0x47, 0x0D, 0xC0, 0x20, 0xFF, 0x03, 0x92, 0x06, 0x51,
+    0xEA, 0x29, 0x17, 0x9F, 0x2F, 0x0F, 0x2C, 0xE2, 0xC0, 0xE1, 0x3A, 0x96, 0xC8, 0x7F, 0x38, 0x1E,
+    0xFE, 0xF8, 0xF2, 0xBA, 0x50, 0x84, 0x9F, 0x8A, 0x62, 0x5B, 0x89, 0xB2, 0xCB, 0x8F, 0xC7, 0x88,
+    0x9E, 0xFD, 0xF7, 0x58, 0xD5, 0xA8, 0x66, 0x65, 0xF4, 0xE4, 0xE8, 0x0F, 0x98, 0xFE, 0x4C, 0x0E,
+    0xDF, 0xCF, 0xB5, 0xB5, 0x97, 0x17, 0xD6, 0x4D, 0xA9, 0x49, 0xC0, 0xDA, 0xFD, 0x1D, 0x19, 0xA8,
+    0xFB, 0x9A, 0xEC, 0xC3, 0x39, 0xBB, 0xEE, 0x0F, 0xAE, 0xFF, 0x77, 0x50, 0xD7, 0xF2, 0x96, 0xC2,
+    0x7F, 0xCA, 0xFD, 0x68, 0x49, 0x68, 0x08, 0x1F, 0x07, 0xA6, 0xDB, 0xB9, 0x5F, 0x9C, 0xDB, 0xE8,
+    0x08, 0xC8, 0x7D, 0xF6, 0x61, 0x73, 0xE5, 0x2C, 0xF3, 0x45, 0x3E, 0x09, 0x6C, 0xAE, 0xD2, 0xE6,
+    0x52, 0x53, 0xC9, 0x4C, 0x66, 0xED, 0xA2, 0x1D, 0x51, 0xAE, 0x9F, 0x67, 0x4A, 0x7E, 0xCE, 0x31,
+    0xF8, 0xCF, 0x6E, 0xD5, 0x1D, 0xE9, 0xB6, 0xEE, 0x19, 0x0E, 0xD3, 0x4B, 0x4E, 0xAA, 0xD2, 0x2A,
+    0x29, 0xA2, 0x24, 0x97, 0xED, 0x9B, 0x45, 0x36, 0x2F, 0xEE, 0x0F, 0x16, 0xFF, 0xD1, 0x72, 0xE9,
+    0xEC, 0x83, 0x8E, 0xAC, 0x05, 0xE0, 0xDD, 0xE5, 0x7E, 0x4F, 0xD7, 0xCB, 0xA5, 0x51, 0xAD, 0x97,
+    0xF1, 0xAB, 0x66, 0xEE, 0x7F, 0x5C, 0xDD, 0xA0, 0xF5, 0xCD, 0xA3, 0x4B, 0x45, 0x75, 0x02, 0xBD,
+    0x65, 0x61, 0xFD, 0x67, 0x04, 0x5E, 0xB5, 0xAF, 0x37, 0x8B, 0x77, 0xFA, 0xEA, 0xFD, 0x11, 0x38,
+    0x42, 0xBD, 0x14, 0x9B, 0x50, 0x6B, 0xDD, 0x2F, 0x2C, 0x21, 0xA3, 0x23, 0xEE, 0x8A, 0x46, 0x71,
+    0xDF, 0xE0, 0xD6, 0x1A, 0x59, 0xE6, 0xE7, 0x5B, 0x8D, 0x84, 0x4C, 0x05, 0x22, 0x74, 0xE8, 0x82,
+    0x38, 0x7A, 0x2A, 0xFF, 0xDA, 0xC5, 0xE8, 0xB5, 0xFE, 0xA5, 0xBF, 0x6A, 0xEE, 0xA7, 0x76, 0xC1,
+    0xFE, 0x1E, 0xE8, 0x76, 0xBC, 0x74, 0xEA, 0xBD, 0xDB, 0xB0, 0x8C, 0x0C, 0x6F, 0x80, 0x76, 0xB8,
+    0x9F, 0x86, 0xB7, 0x9A, 0xD9, 0x65, 0x07, 0xB3, 0x54, 0x3A, 0x99, 0xB9, 0xD6, 0xA9, 0x99, 0xEA,
+    0x3B, 0x34, 0x64, 0xF3, 0xCF, 0xDA, 0x8E, 0xE6, 0xF5, 0x6A, 0xC7, 0x66, 0x3A, 0xD9, 0xA1, 0x9D,
+    0x14, 0x42, 0x8F, 0x3D, 0x90, 0x07, 0xFF, 0x6D, 0xB4, 0xD9, 0x6B, 0x70, 0xD9, 0x29, 0x0D, 0x50,
+    0x76, 0x64, 0x7C, 0x42, 0x8B, 0xBE, 0x2E, 0xE6, 0x74, 0x6E, 0x6D, 0xFB, 0xD5, 0xD8, 0xA1, 0x7B,
+    0xEC, 0x17, 0xCF, 0x15, 0x2A, 0x77, 0x05, 0xCB, 0x9D, 0x8E, 0x6E, 0xE9, 0x73, 0xCA, 0xCA, 0xEE,
+    0x8F, 0x46, 0x31, 0xF8, 0xD8, 0x5F, 0x9F, 0xEA, 0x95, 0xD7, 0x00, 0xDB, 0xFF, 0x26, 0x27, 0x33,
+    0x37, 0x93, 0xCB, 0x8C, 0x7F, 0x79, 0xDE, 0x02, 0xB5, 0x55, 0xB1, 0x92, 0xDD, 0x34, 0x14, 0xBD,
+    0xB6, 0x26, 0xB8, 0x50, 0xA1, 0x8A, 0x06, 0x0A, 0xB7, 0x54, 0xE8, 0x0B, 0x40, 0x66, 0xE9, 0x68,
+    0xA0, 0x49, 0x4D, 0xB3, 0x05, 0x43, 0xB3, 0x5F, 0xC0, 0xD8, 0x21, 0x3F, 0xB0, 0x9F, 0x90, 0x02,
+    0x66, 0x98, 0x50, 0xA4, 0x4D, 0x13, 0x2C, 0xD8, 0x22, 0x45, 0x1A, 0x87, 0x94, 0x29, 0xD6, 0xCC,
+    0x64, 0x86, 0x19, 0x28, 0xD0, 0x26, 0x06, 0x4C, 0x56, 0xF6, 0xE5, 0x1C, 0x7B, 0x77, 0x79, 0x74,
+    0x34, 0xC8, 0x2B, 0xBF, 0xB5, 0x9E, 0x7C, 0xEF, 0x39, 0xE7, 0x1E, 0xDD, 0x27, 0x7D, 0x57, 0x64,
+    0xD1, 0x58, 0xE2, 0x36, 0x98, 0xB9, 0xD0, 0x64, 0xA6, 0x52, 0x53, 0x95, 0xCA, 0xCB, 0xC9, 0x26,
+    0xF3, 0x47, 0xB6, 0xA3, 0xB9, 0xC8, 0x6E, 0xAC, 0xD2, 0xE2, 0x06, 0x9B, 0xB4, 0x8E, 0x6E, 0x6C,
+    0x7D, 0x74, 0x43, 0x38, 0xE9, 0x5C, 0x0C, 0xDA, 0xD4, 0xB1, 0xD6, 0x06, 0x0B, 0x2A, 0xA1, 0xE3,
+    0xAD, 0xB1, 0xAB, 0xB4, 0x62, 0x16, 0xD9, 0xC7, 0xAD, 0x4F, 0x70, 0x73, 0x11, 0x37, 0xDF, 0xE1,
+    0x16, 0xB8, 0xF6, 0x0E, 0x66, 0x71, 0xEF, 0x3B, 0x09, 0x21, 0x9B, 0x4B, 0x1D, 0xDB, 0x9F, 0xD4,
+    0x66, 0x97, 0x54, 0x56, 0x97, 0xDC, 0xB0, 0x16, 0x4B, 0x3D, 0xF8, 0x1F, 0xB2, 0xC9, 0x21, 0x86,
+    0xBB, 0xB3, 0x99, 0x42, 0xD3, 0x56, 0xC9, 0xA6, 0xEB, 0x60, 0xAB, 0x48, 0x1D, 0xA5, 0x4C, 0x7B,
+    0x98, 0x7D, 0x00, 0x24, 0x42, 0x87, 0x06, 0x49, 0x98, 0xD7, 0xCD, 0x57, 0xEB, 0xFF, 0x2F, 0x37,
+    0xFF, 0xC1, 0x2C, 0xEE, 0xF9, 0x28, 0x95, 0x76, 0x52, 0xAE, 0xDB, 0x12, 0x59, 0x99, 0x57, 0x1A,
+    0x49, 0xAB, 0x5A, 0xEB, 0x44, 0x5E, 0xB8, 0x46, 0x12, 0x73, 0x63, 0x3D, 0x80, 0x59, 0xF4, 0x31,
+    0xF0, 0xEA, 0x70, 0x35, 0xE0, 0x86, 0x80, 0xBD, 0x98, 0x09, 0xEF, 0x66, 0xD9, 0xD8, 0x61, 0x01,
+    0xB1, 0x3F, 0x3A, 0x9A, 0xDD, 0xE3, 0x9F, 0xF5, 0xCE, 0xD1, 0xA5, 0x26, 0xD1, 0x1F, 0x17, 0x09,
+    0x43, 0xDB, 0xB8, 0x54, 0xC7, 0x0A, 0xD0, 0x4B, 0xA8, 0x23, 0xD0, 0x0B, 0xB0, 0xDA, 0x06, 0x51,
+    0x23, 0x05, 0xBA, 0x59, 0xDC, 0x68, 0x1B, 0x15, 0x3B, 0xBA, 0x85, 0x3B, 0x66, 0x59, 0x0A, 0xB2,
+    0xB6, 0xE7, 0x23, 0x72, 0x9F, 0xC4, 0x55, 0x72, 0xF8, 0x70, 0xAA, 0xD2, 0xEA, 0xA2, 0xFF, 0x3E,
+    0xB7, 0xB2, 0x42, 0x09, 0x33, 0xD9, 0xCB, 0xD1, 0x91, 0x6E, 0x2B, 0x21, 0x97, 0xB3, 0xF4, 0x40,
+    0x0D, 0xE9, 0x42, 0x63, 0xB0, 0x5D, 0x2A, 0xE0, 0xA3, 0xEC, 0x82, 0x04, 0x52, 0xF5, 0x78, 0xC2,
+    0x4E, 0x20, 0x9D, 0xE4, 0x86, 0x36, 0x8B, 0xA9, 0xFF, 0xBD, 0x98, 0x88, 0x83, 0x04, 0xE5, 0x02,
+    0xF5, 0x22, 0xE3, 0x54, 0xA8, 0x59, 0x71, 0xFF, 0x2B, 0x7C, 0x01, 0x02, 0x81, 0xC1, 0x31, 0x2A,
+    0x3D, 0x45, 0xA2, 0x15, 0x53, 0x07, 0x37, 0x23, 0xEE, 0x2C, 0x5A, 0x65, 0xF1, 0x90, 0xA3, 0x9A,
+    0x54, 0x8A, 0x25, 0x74, 0xD2, 0x7E, 0x3A, 0x88, 0x7F, 0x3E, 0x89, 0x7B, 0x89, 0xC5, 0xDC, 0x36,
+    0xE5, 0x52, 0xA7, 0x42, 0xCD, 0x5A, 0x82, 0x8A, 0x6A, 0x67, 0x31, 0xA5, 0x5D, 0xAF, 0x0C, 0xF1,
+    0xF9, 0x7D, 0xF1, 0x8A, 0x7A, 0x8E, 0x7C, 0x38, 0x01, 0x41, 0xC5, 0x5F, 0xEA, 0xCF, 0x00, 0x0F,
+    0x71, 0xDC, 0xAF, 0xC9, 0xFC, 0x99, 0x8B, 0x45, 0xA5, 0x07, 0xDC, 0x27, 0xC9, 0x3F, 0xC5, 0x97,
+    0x5E, 0x53, 0xB9, 0xEF, 0xDF, 0x47, 0x72, 0x8D, 0x84, 0x07, 0x51, 0xAC, 0x0E, 0x08, 0xD1, 0xED,
+    0x8B, 0xED, 0x5F, 0x52, 0x80, 0x3C, 0xE6, 0x22, 0xDA, 0xF5, 0x51, 0x3B, 0x97, 0xDA, 0x58, 0x2E,
+    0x7E, 0x90, 0xF6, 0xE3, 0x24, 0xF5, 0xB3, 0x59, 0xAA, 0xDF, 0x17, 0xD0, 0xED, 0x1B, 0x51, 0x2E,
+    0x3E, 0x9E, 0x04, 0xD1, 0xA5, 0x4E, 0x61, 0xF4, 0x53, 0xA5, 0x0A, 0xC1, 0x31, 0xAB, 0xC3, 0x44,
+    0xEF, 0x95, 0x23, 0x00, 0x15, 0x58, 0x7E, 0xFB, 0x05, 0x9F, 0xDF, 0x58, 0xC5, 0x69, 0x72, 0x0A,
+    0x7D, 0xC3, 0x59, 0x66, 0xB8, 0xB5, 0x97, 0xD0, 0xC6, 0xFA, 0x3C, 0xD9, 0x57, 0x50, 0xB8, 0x07,
+    0x73, 0xD5, 0x12, 0x94, 0xFC, 0x2A, 0x07, 0xA3, 0xF7, 0x51, 0xAA, 0x0B, 0x98, 0xEB, 0x7D, 0xD7,
+    0x89, 0x19, 0x1E, 0xCA, 0x0D, 0xE4, 0x4D, 0xDB, 0x0D, 0x33, 0xC5, 0x15, 0x82, 0xA6, 0xBA, 0x03,
+    0x01, 0x36, 0x94, 0xD7, 0x00, 0xD2, 0x54, 0x43, 0xDF, 0x81, 0xB8, 0x59, 0xAC, 0x0C, 0x27, 0xF8,
+    0x81, 0x0A, 0x0B, 0x91, 0x0B, 0x25, 0xDE, 0xA0, 0xFF, 0xA3, 0xF1, 0x36, 0xEC, 0xCB, 0x2C, 0xF5,
+    0x59, 0x92, 0x80, 0xA3, 0xFF, 0xF0, 0xDD, 0x7D, 0x0D, 0x7A, 0x1B, 0xCD, 0x20, 0x01, 0x84, 0x30,
+    0x08, 0x24, 0x6F, 0xDA, 0x26, 0x74, 0x20, 0x81, 0x64, 0x4C, 0xD8, 0xC3, 0x15, 0xB8, 0x23, 0x4F,
+    0x8B, 0x7D, 0x10, 0x1E, 0x22, 0x77, 0x87, 0x51, 0xC1, 0x4F, 0x23, 0xD4, 0x42, 0x04, 0x24, 0xD6,
+    0x8C, 0x2A, 0xAF, 0xB7, 0x9B, 0x30, 0xC2, 0x50, 0x00, 0x04, 0x9E, 0x76, 0xA2, 0xB1, 0x42, 0x84,
+    0x13, 0x1B, 0xDA, 0x86, 0x70, 0x7B, 0x4D, 0xF5, 0x60, 0x96, 0xDB, 0x48, 0x01, 0xC7, 0x15, 0x3C,
+    0x12, 0x70, 0x1B, 0x3E, 0xC9, 0x3A, 0xED, 0x41, 0x99, 0x0D, 0xB5, 0xDE, 0xFE, 0xBF, 0xCE, 0x78,
+    0x72, 0xEA, 0x5F, 0xC0, 0x8D, 0xAD, 0x76, 0x4C, 0x98, 0xFA, 0xBB, 0x1A, 0x97, 0x10, 0x7B, 0x1A,
+    0xA5, 0x1E, 0xDB, 0x27, 0x09, 0x38, 0x9E, 0x65, 0xC8, 0x3D, 0x00, 0xF4, 0xD7, 0xC2, 0x33, 0x2D,
+    0x36, 0x85, 0x89, 0x82, 0xEA, 0xB7, 0x43, 0xD0, 0xDF, 0x14, 0xCD, 0xE6, 0xA9, 0xCE, 0x87, 0x04,
+    0xE8, 0x72, 0xC7, 0x5E, 0x85, 0x24, 0x5F, 0x5C, 0x95, 0xE7, 0x35, 0x3C, 0x0F, 0x2F, 0xA9, 0x4E,
+    0xC5, 0x6A, 0x81, 0xCB, 0x64, 0x9E, 0x64, 0x5C, 0xB3, 0x99, 0x1D, 0xBD, 0x31, 0xD2, 0xC3, 0x8E,
+    0x55, 0xBA, 0xC0, 0x1C, 0xE1, 0x1A, 0x94, 0xC3, 0xC7, 0xB6, 0xDB, 0xFB, 0x88, 0x1F, 0xD1, 0x9C,
+    0xB6, 0xF6, 0x08, 0x10, 0x14, 0x01, 0xE7, 0xD4, 0x6D, 0x24, 0xDE, 0xB2, 0x83, 0x3B, 0x4F, 0xD0,
+    0xBC, 0xD0, 0x5F, 0xA4, 0x8F, 0x68, 0x21, 0x82, 0x8D, 0x28, 0x2A, 0xC9, 0xF7, 0xDB, 0x76, 0x80,
+    0x41, 0xEF, 0xE1, 0x33, 0x81, 0x50, 0x36, 0x94, 0xA7, 0x69, 0xBF, 0x5C, 0x89, 0xC3, 0xA2, 0x77,
+    0x31, 0xC3, 0x6A, 0x16, 0xC2, 0xF0, 0x70, 0x0B, 0x90, 0x9A, 0x4C, 0x21, 0x51, 0x81, 0xA3, 0xA5,
+    0xCC, 0xD5, 0xCC, 0x06, 0x47, 0x10, 0x2B, 0xC3, 0xB1, 0x47, 0x37, 0x5B, 0x07, 0x63, 0x47, 0xAB,
+    0x81, 0xE2, 0x18, 0x4B, 0x9F, 0xF9, 0x06, 0x3E, 0x85, 0x79, 0x2B, 0xFD, 0xA6, 0x44, 0x7D, 0x70,
+    0xBA, 0xF7, 0xD4, 0xA8, 0x0E, 0x7A, 0xF3, 0x56, 0xB2, 0x4E, 0xDC, 0xB0, 0xB7, 0x19, 0x91, 0x37,
+    0xB7, 0x1F, 0x0B, 0x38, 0xC7, 0x0E, 0x52, 0x9C, 0x5E, 0x49, 0x57, 0x4E, 0x58, 0x0B, 0x98, 0x6C,
+    0xB7, 0x72, 0x55, 0x25, 0xAB, 0xF7, 0x36, 0xD0, 0x54, 0x4F, 0x80, 0x1A, 0xD2, 0x84, 0x48, 0xD8,
+    0x94, 0x0F, 0x8D, 0x8D, 0x4E, 0x5A, 0x85, 0xC0, 0xA9, 0x1F, 0x91, 0xB3, 0x2F, 0x11, 0xBA, 0x50,
+    0x40, 0x62, 0x37, 0x33, 0x7A, 0xF7, 0x35, 0xF8, 0xFA, 0x4E, 0x96, 0x47, 0xE8, 0xF0, 0xE8, 0x49,
+    0x3E, 0xED, 0x9D, 0xED, 0x11, 0xCF, 0x18, 0x7D, 0xDB, 0xBE, 0xEE, 0x6C, 0xDE, 0xC0, 0x53, 0x6D,
+    0xFE, 0x0C, 0x0D, 0x1B, 0x7A, 0xBC, 0x89, 0x5C, 0x30, 0xF1, 0x35, 0x7C, 0x61, 0x5B, 0x83, 0xDB,
+    0xC8, 0xA8, 0xDC, 0x0B, 0x53, 0xAF, 0xD0, 0x75, 0x81, 0x59, 0x62, 0x18, 0x8E, 0x69, 0x02, 0x7C,
+    0x5B, 0xF1, 0x5D, 0xDA, 0x85, 0xBF, 0x20, 0xD8, 0xCC, 0x47, 0xF0, 0xDD, 0x02, 0x1F, 0x9B, 0x05,
+    0x45, 0x8F, 0x3D, 0x7B, 0xCF, 0x81, 0x81, 0xDA, 0x8E, 0x42, 0x21, 0x93, 0xDF, 0xFA, 0xA3, 0xA5,
+    0xC5, 0xD1, 0x11, 0xC0, 0xF5, 0x16, 0xDF, 0x0B, 0xFB, 0x81, 0xE9, 0x67, 0x10, 0x20, 0xAE, 0xC6,
+    0x26, 0xFF, 0x20, 0x5B, 0xD6, 0xFF, 0x5F, 0x2E, 0x3C, 0x1C, 0x7F, 0x03, 0xB5, 0x95, 0x31, 0xAF,
+    0xDD, 0x34, 0x14, 0xC7, 0x4F, 0x62, 0xF5, 0x45, 0xAA, 0x07, 0x2F, 0x5D, 0x3A, 0x40, 0x76, 0x50,
+    0x95, 0x2F, 0x80, 0xE4, 0xBC, 0x89, 0xA1, 0x43, 0xFB, 0x0D, 0x58, 0xDE, 0xCE, 0xC2, 0xC0, 0x80,
+    0x9A, 0x20, 0xC4, 0xCE, 0x47, 0xE8, 0xC0, 0xC2, 0x5B, 0x58, 0x18, 0x4B, 0xED, 0xB6, 0x63, 0x07,
+    0x0C, 0x88, 0x89, 0x01, 0x0B, 0xBA, 0x30, 0x54, 0xF5, 0x90, 0x27, 0x59, 0xE0, 0xE4, 0xF0, 0x3F,
+    0xCE, 0x7D, 0x17, 0xDE, 0xD2, 0xE1, 0xD1, 0xE6, 0xEA, 0xEA, 0xC6, 0x27, 0x27, 0xE7, 0xFC, 0xFD,
+    0xF3, 0xDF, 0xBE, 0x44, 0xB8, 0x6C, 0x22, 0xC3, 0xB3, 0x5A, 0x0A, 0x3D, 0x52, 0x51, 0x02, 0xFD,
+    0x36, 0x1A, 0x5E, 0x5B, 0x66, 0x6F, 0xC3, 0x59, 0x97, 0x89, 0xA6, 0x91, 0xBA, 0x82, 0xC4, 0x85,
+    0x1A, 0x8E, 0xD4, 0xF1, 0x48, 0x46, 0x86, 0x81, 0x9A, 0x0D, 0xD9, 0xE1, 0x4C, 0xAD, 0x1A, 0xC9,
+    0x8E, 0x53, 0xCB, 0x99, 0x2E, 0x2F, 0xA4, 0x68, 0xF6, 0xFA, 0xF7, 0x45, 0x87, 0x41, 0xC6, 0x7A,
+    0xA3, 0x9E, 0x93, 0xE1, 0xA2, 0xF2, 0x0D, 0x79, 0x0F, 0x6D, 0x35, 0xCF, 0xE4, 0x32, 0x29, 0xC6,
+    0xC8, 0x8F, 0x3A, 0x0D, 0xDF, 0x16, 0xCD, 0xA5, 0xF9, 0x4F, 0x91, 0x86, 0x5F, 0x10, 0x73, 0x18,
+    0xF0, 0xD6, 0x7A, 0x32, 0x4E, 0x33, 0x75, 0x0B, 0xE4, 0x78, 0xBC, 0x32, 0x42, 0x26, 0x6E, 0x31,
+    0x64, 0x0C, 0x57, 0xE8, 0x88, 0xD4, 0x20, 0xC7, 0x06, 0xC7, 0xA8, 0xC2, 0x34, 0xA0, 0x78, 0x4F,
+    0xA4, 0xA0, 0x54, 0x63, 0x5A, 0x8F, 0x6B, 0xA2, 0x41, 0x3E, 0xB9, 0xD8, 0x71, 0x81, 0x10, 0x13,
+    0x6F, 0xE1, 0xA5, 0xAA, 0x73, 0x6E, 0x31, 0x31, 0x01, 0x91, 0x20, 0xE3, 0xB1, 0x4B, 0x8E, 0xFD,
+    0xB4, 0x11, 0x70, 0x48, 0xBF, 0x42, 0x4D, 0x21, 0x9B, 0x69, 0x08, 0xBB, 0xA8, 0xA2, 0x43, 0x53,
+    0x56, 0x6A, 0x39, 0xD4, 0xC6, 0x07, 0x99, 0x96, 0x17, 0x41, 0x66, 0x96, 0xDB, 0x04, 0x9D, 0x0D,
+    0x1E, 0x08, 0x33, 0x23, 0xCA, 0x84, 0xD2, 0x5A, 0x89, 0x54, 0x01, 0x68, 0x0A, 0xA4, 0xA0, 0x86,
+    0xFC, 0x24, 0x52, 0x35, 0xC7, 0xE3, 0x8C, 0x8B, 0x8E, 0xE6, 0x87, 0x58, 0xE5, 0xC4, 0x6B, 0x61,
+    0xEB, 0x51, 0xD4, 0x31, 0x3F, 0x63, 0xDE, 0x6E, 0x7C, 0x74, 0x71, 0x1F, 0x29, 0x44, 0x78, 0x4F,
+    0x26, 0x32, 0xE0, 0x96, 0x77, 0x24, 0xA6, 0x6A, 0xA0, 0x56, 0x6E, 0x93, 0xD4, 0xA9, 0x6B, 0x79,
+    0x99, 0xF4, 0x01, 0xD5, 0x27, 0x6D, 0xAE, 0xEC, 0x04, 0x76, 0x05, 0x77, 0x46, 0x66, 0x6E, 0x17,
+    0x72, 0x7F, 0x4E, 0xFC, 0x2B, 0xAF, 0x26, 0x62, 0x92, 0x83, 0x47, 0xA2, 0xF5, 0x2A, 0xA3, 0x9A,
+    0xC6, 0xA3, 0x97, 0x1D, 0x56, 0xAB, 0x50, 0x86, 0x2D, 0xC8, 0x92, 0x4A, 0x66, 0x23, 0x37, 0x57,
+    0x5D, 0x03, 0xAA, 0x95, 0x0D, 0xEE, 0x99, 0x0F, 0x33, 0x9B, 0x98, 0x9F, 0x33, 0x17, 0x66, 0xFE,
+    0x52, 0x74, 0x72, 0x15, 0x25, 0xDC, 0xA0, 0x40, 0x24, 0x42, 0x93, 0xDA, 0xCD, 0xA7, 0x53, 0xD5,
+    0x0D, 0xA1, 0xBB, 0xE1, 0xAA, 0x38, 0x24, 0xC0, 0x03, 0xFE, 0xE4, 0x9E, 0x57, 0x7F, 0x04, 0xA8,
+    0x6A, 0xF9, 0xEB, 0xAE, 0xBA, 0x76, 0x34, 0x75, 0xD9, 0x24, 0xC7, 0xD5, 0x2A, 0x87, 0x31, 0x2A,
+    0xBB, 0x97, 0xC0, 0x33, 0xB6, 0x30, 0xC2, 0x6B, 0x41, 0x35, 0x1F, 0xFF, 0x02, 0xFB, 0x14, 0x38,
+    0x2F, 0x2A, 0xD4, 0x7B, 0x0D, 0x28, 0xBA, 0x4D, 0x98, 0xAB, 0x0E, 0x60, 0xD2, 0xF3, 0xE2, 0x38,
+    0xD8, 0x19, 0x33, 0x78, 0xFF, 0xAF, 0x53, 0xE6, 0x8E, 0xB3, 0xAA, 0x18, 0x1C, 0x1A, 0x7E, 0x07,
+    0x2C, 0x9A, 0x2B, 0x87, 0x76, 0x79, 0x17, 0x5A, 0x5F, 0x11, 0xFD, 0x0D, 0x12, 0x9F, 0xF4, 0x3B,
+    0x1C, 0x87, 0x44, 0xEB, 0x75, 0x32, 0x51, 0x15, 0xD4, 0x66, 0x81, 0x3A, 0xB3, 0x04, 0x67, 0x9D,
+    0x7A, 0x04, 0xC1, 0x76, 0x43, 0x70, 0xBA, 0x12, 0xEC, 0x32, 0xB4, 0xF0, 0x29, 0xC3, 0x7B, 0xD8,
+    0xC0, 0xF8, 0x42, 0xF5, 0xB8, 0xDB, 0x68, 0x38, 0x8D, 0x9A, 0xBF, 0x47, 0x0F, 0xFF, 0xCE, 0x49,
+    0xA5, 0x7D, 0x4E, 0xDF, 0x98, 0x68, 0x7E, 0x5C, 0x9B, 0xD2, 0xFB, 0xE1, 0x69, 0x51, 0xC5, 0x7A,
+    0xFB, 0x45, 0xEE, 0x96, 0x69, 0x74, 0x5D, 0x32, 0xC9, 0x35, 0x9B, 0x4E, 0x36, 0x3A, 0x5E, 0x15,
+    0xFF, 0xE6, 0xFB, 0xA5, 0xEC, 0x5A, 0xCF, 0x1F, 0x42, 0xAB, 0x80, 0xDC, 0xF6, 0x31, 0x14, 0x8C,
+    0xD8, 0x5A, 0xDE, 0xCE, 0x26, 0xF5, 0x01, 0xB2, 0x12, 0x6D, 0x4A, 0x82, 0x1B, 0x82, 0x13, 0x82,
+    0x43, 0x50, 0x59, 0xA7, 0xE6, 0x6A, 0xB0, 0x8F, 0x5D, 0x56, 0x6B, 0x27, 0x40, 0x37, 0x9C, 0x35,
+    0xA8, 0xE5, 0xD6, 0x83, 0xDD, 0xDF, 0x3B, 0x87, 0x23, 0x12, 0xB9, 0xCA, 0xE6, 0xE6, 0xC3, 0x9B,
+    0x5F, 0x6D, 0xB4, 0xF6, 0xA1, 0x7F, 0x52, 0xDA, 0x82, 0x2E, 0xCF, 0xE0, 0x7A, 0x3B, 0x4F, 0x1F,
+    0x2E, 0x3A, 0x4D, 0xC4, 0x32, 0x69, 0xA7, 0x36, 0xEC, 0x98, 0x60, 0x57, 0xF8, 0xFD, 0x9E, 0x3F,
+    0xEE, 0x1A, 0x15, 0x71, 0xC6, 0x38, 0x37, 0xCA, 0x49, 0x86, 0xBD, 0xBE, 0x43, 0x18, 0x7C, 0xB7,
+    0x98, 0xD4, 0xA2, 0x06, 0x31, 0x56, 0xC5, 0x7A, 0x07, 0x2B, 0x58, 0x09, 0xC6, 0x16, 0xEC, 0x40,
+    0x19, 0xC1, 0x19, 0xE8, 0xAF, 0x04, 0x81, 0x74, 0x9A, 0x6D, 0x98, 0xBC, 0xC1, 0xF2, 0x8B, 0x05,
+    0xB0, 0xDF, 0xC2, 0xB1, 0x11, 0xE9, 0xF9, 0x33, 0x34, 0x02, 0x6D, 0xEC, 0xC3, 0x17, 0xFF, 0x43,
+    0xF4, 0x03, 0xD9, 0x01, 0x30, 0xD4, 0x9D, 0x3B, 0xA8, 0x79, 0x77, 0xC4, 0x11, 0x82, 0x07, 0x07,
+    0x37, 0x00, 0xE0, 0x0A, 0x80, 0x0E, 0x76, 0xB4, 0x7E, 0x1A, 0x41, 0x15, 0x1B, 0xCC, 0x48, 0x30,
+    0x13, 0x16, 0x4A, 0x66, 0x02, 0x93, 0x63, 0x7A, 0x57, 0x83, 0xD3, 0xDC, 0x47, 0xB3, 0xF4, 0x09,
+    0x4E, 0xC8, 0xB0, 0x44, 0xC6, 0xD2, 0x2D, 0x07, 0xD5, 0x5D, 0xAC, 0x0D, 0xD0, 0xAC, 0xFD, 0x29,
+    0x50, 0x5F, 0xF6, 0xFE, 0xD7, 0x74, 0xC5, 0x5E, 0xF1, 0x02, 0x4B, 0xB8, 0x62, 0x0B, 0x5A, 0xB8,
+    0xBF, 0xFB, 0x3C, 0xFE, 0xEB, 0x0F, 0xF1, 0xB1, 0x20, 0x27, 0x51, 0x2E, 0x06, 0x21, 0xF1, 0xAC,
+    0xE0, 0xAD, 0x2A, 0xC5, 0x21, 0xD5, 0xC9, 0x02, 0x5D, 0xB4, 0x93, 0x58, 0xA4, 0x5A, 0x59, 0xA8,
+    0x57, 0xF1, 0xD5, 0x23, 0x47, 0x2F, 0xEF, 0x2B, 0x9C, 0x61, 0x9D, 0x9F, 0x71, 0x08, 0xDF, 0x0D,
+    0xF4, 0xA9, 0xA1, 0x4B, 0xF2, 0x50, 0x1F, 0x80, 0xDE, 0x43, 0x3E, 0x3E, 0x56, 0x3E, 0x33, 0xE0,
+    0x8F, 0x98, 0x00, 0x81, 0x7E, 0x25, 0x03, 0xFC, 0x30, 0x18, 0xD6, 0x7A, 0x2D, 0x74, 0x74, 0xF6,
+    0x9B, 0x74, 0xB2, 0xC2, 0x3A, 0xB6, 0xF8, 0x36, 0x82, 0x5B, 0xCC, 0xD7, 0x27, 0x3A, 0x9C, 0x51,
+    0xD7, 0x32, 0x88, 0xFC, 0x0D, 0xE3, 0xE4, 0x83, 0xA5, 0xD5, 0x05, 0x7E, 0x52, 0x3D, 0x97, 0xDE,
+    0xC6, 0xF5, 0x0F, 0xAD, 0x55, 0x31, 0x6C, 0x1C, 0x45, 0x14, 0xFD, 0xB3, 0xEB, 0x63, 0xA5, 0xAC,
+    0xE4, 0x89, 0xC4, 0x59, 0x48, 0x26, 0x64, 0xDB, 0x08, 0x92, 0x4C, 0x93, 0xC2, 0x85, 0xEF, 0x66,
+    0x8D, 0x0B, 0x17, 0x29, 0x72, 0x45, 0x4E, 0x48, 0x14, 0xD0, 0x50, 0x45, 0x0A, 0x49, 0x41, 0x11,
+    0x21, 0x9B, 0x59, 0x2A, 0x0A, 0x8A, 0xA4, 0x86, 0xC6, 0x12, 0x4D, 0x38, 0x84, 0x62, 0x21, 0x21,
+    0x45, 0xC8, 0xE7, 0x5D, 0xDB, 0x12, 0x91, 0x92, 0xC2, 0x1B, 0x5C, 0xA4, 0x48, 0x91, 0xC5, 0x01,
+    0x22, 0x91, 0x22, 0x03, 0xAC, 0xC8, 0x06, 0xCF, 0xEE, 0xE7, 0xCF, 0xEC, 0xD9, 0x4A, 0x04, 0x12,
+    0x0D, 0xAB, 0xBB, 0xD5, 0xEE, 0x9F, 0x3F, 0xFF, 0xBF, 0xFF, 0xFE, 0xFB, 0xB3, 0x00, 0xED, 0xA5,
+    0x0A, 0xBA, 0x05, 0x98, 0xD9, 0xC7, 0x88, 0xEE, 0x7E, 0x11, 0xC5, 0xED, 0x4A, 0x58, 0x30, 0x03,
+    0xF2, 0x52, 0xC6, 0xB5, 0x67, 0x52, 0x50, 0x19, 0xDF, 0x33, 0x1E, 0x82, 0x0A, 0x35, 0x37, 0xBE,
+    0x11, 0x59, 0xAA, 0xA3, 0x3C, 0xF5, 0xF7, 0xB3, 0xD4, 0x33, 0xE2, 0xC6, 0x62, 0x19, 0x68, 0x33,
+    0x16, 0x59, 0x74, 0x6B, 0xAF, 0x6C, 0x40, 0xC9, 0xB3, 0xF7, 0x34, 0xAB, 0x8D, 0x50, 0x49, 0xB0,
+    0x9F, 0x8F, 0x0D, 0x44, 0xE8, 0xED, 0x6B, 0x50, 0x65, 0x88, 0x31, 0xC3, 0x2C, 0x32, 0x10, 0x90,
+    0x53, 0x0E, 0x5C, 0x33, 0x84, 0x83, 0x2B, 0xCD, 0x01, 0x3C, 0xD4, 0x94, 0x77, 0xAF, 0x02, 0x88,
+    0xE2, 0xF5, 0xD6, 0x7C, 0x01, 0x46, 0x30, 0x52, 0x0C, 0x59, 0xAD, 0x7C, 0xF4, 0x8C, 0x0A, 0xD0,
+    0x2F, 0x55, 0xF8, 0x24, 0xD4, 0x92, 0xDF, 0xE0, 0x85, 0x14, 0x97, 0xA2, 0x4C, 0x4A, 0x21, 0x13,
+    0xB9, 0x22, 0x14, 0xC8, 0x75, 0xB1, 0x01, 0xB2, 0x12, 0x84, 0x5B, 0x8B, 0x0A, 0x64, 0x21, 0x34,
+    0xC8, 0x5C, 0x14, 0x87, 0x19, 0x42, 0x2A, 0x74, 0x23, 0x4A, 0x82, 0x5C, 0xB8, 0x0A, 0x35, 0x60,
+    0x94, 0x87, 0xA5, 0x4C, 0x54, 0x86, 0xBE, 0xA1, 0x42, 0xF2, 0x80, 0xE0, 0xF3, 0x07, 0xB4, 0x0B,
+    0x63, 0x48, 0x2B, 0x20, 0xB4, 0xE0, 0xD7, 0x40, 0x48, 0x01, 0x64, 0x02, 0xAC, 0x76, 0x9B, 0x40,
+    0x12, 0x51, 0x0D, 0x71, 0x55, 0x1D, 0x80, 0x57, 0xD6, 0x48, 0x8B, 0x8A, 0x67, 0xD0, 0x67, 0xA5,
+    0xB3, 0xCD, 0x26, 0x47, 0x56, 0x43, 0x1D, 0x54, 0x8C, 0xE8, 0x02, 0xC5, 0x28, 0x6E, 0x9E, 0x82,
+    0x4F, 0xC9, 0xA0, 0x11, 0x19, 0x88, 0xAB, 0x84, 0xE6, 0xB1, 0x06, 0xB6, 0x4F, 0xDE, 0xCA, 0x50,
+    0x0A, 0xDA, 0xEE, 0x5B, 0x3A, 0x28, 0xB3, 0xCD, 0x05, 0xE4, 0x04, 0x04, 0xDD, 0x71, 0x92, 0xD2,
+    0x5F, 0xE4, 0x36, 0xEA, 0x95, 0x53, 0xE0, 0xFF, 0x6E, 0x80, 0xDF, 0x29, 0xA0, 0xDB, 0xB1, 0x06,
+    0x8F, 0x8A, 0xBD, 0x55, 0x7A, 0x35, 0x2F, 0x22, 0x2D, 0x33, 0x84, 0x34, 0x2C, 0x59, 0x2D, 0x13,
+    0xFF, 0x29, 0x39, 0x61, 0x0E, 0xA2, 0x69, 0xD1, 0x51, 0x54, 0xDF, 0x66, 0x21, 0x2E, 0x54, 0x6C,
+    0x37, 0x1D, 0xD4, 0x64, 0x0B, 0x99, 0x5C, 0x41, 0xD5, 0x3A, 0x58, 0xEB, 0xCA, 0x84, 0x33, 0xAC,
+    0x01, 0xB1, 0x66, 0x88, 0x06, 0x86, 0xEF, 0x96, 0x0E, 0x11, 0xA4, 0x19, 0xD8, 0xC6, 0x39, 0x62,
+    0x68, 0x0B, 0x91, 0x4C, 0xF2, 0xA0, 0x14, 0xAD, 0x29, 0xB4, 0xED, 0xB3, 0xB1, 0x11, 0x13, 0x45,
+    0xFF, 0x14, 0xB1, 0x55, 0x94, 0xCD, 0x8F, 0xAE, 0x2E, 0xBF, 0xED, 0xC8, 0x68, 0x94, 0x44, 0x58,
+    0x79, 0xE4, 0x63, 0x37, 0xB8, 0xE5, 0xD8, 0x96, 0x49, 0x11, 0x88, 0x2E, 0xCB, 0x32, 0x61, 0xF4,
+    0x69, 0x59, 0x62, 0x15, 0x1C, 0x44, 0x01, 0x11, 0xB7, 0x0D, 0x50, 0x84, 0x72, 0xF6, 0xFF, 0x47,
+    0xF9, 0xD1, 0x41, 0x62, 0xB6, 0x6A, 0x5F, 0x8F, 0x8C, 0xAE, 0x07, 0xD8, 0x38, 0x8C, 0xB4, 0x9B,
+    0x56, 0x64, 0x6E, 0x21, 0x52, 0x82, 0xA8, 0xB0, 0x5E, 0xF6, 0x87, 0x0D, 0x81, 0xFC, 0x18, 0xD1,
+    0x35, 0x08, 0xBC, 0x32, 0x4A, 0x68, 0x6E, 0x12, 0x9A, 0x2A, 0x42, 0x98, 0x26, 0xED, 0x30, 0xD1,
+    0x2A, 0x39, 0x95, 0x0E, 0xE2, 0xCC, 0x5B, 0x04, 0xC0, 0x6B, 0xAC, 0xDE, 0xC1, 0x61, 0x74, 0x3D,
+    0x77, 0xDE, 0x59, 0x0B, 0xD2, 0xD6, 0x47, 0x89, 0x5C, 0x1D, 0x16, 0x25, 0x47, 0x2C, 0x88, 0x01,
+    0xCB, 0x55, 0xED, 0xE2, 0xB1, 0x2A, 0xCA, 0xBC, 0x3F, 0x0D, 0xB1, 0x93, 0x41, 0x68, 0x60, 0x82,
+    0x14, 0x14, 0x16, 0x0E, 0x6A, 0x60, 0x5C, 0x0C, 0x5B, 0x28, 0x81, 0xB5, 0xA9, 0x08, 0xAD, 0x2D,
+    0xDD, 0x36, 0x9D, 0x62, 0x59, 0x52, 0xA3, 0x49, 0x28, 0x37, 0x18, 0xDC, 0xEA, 0xDD, 0xB4, 0x12,
+    0xA1, 0xBC, 0x0A, 0x9E, 0x97, 0x88, 0x95, 0x7D, 0xA0, 0x5B, 0x45, 0x4E, 0x64, 0x1F, 0x91, 0x53,
+    0x0A, 0x87, 0x92, 0x92, 0xF1, 0xE1, 0x6C, 0x58, 0x96, 0xE8, 0x11, 0x0B, 0x97, 0xDD, 0x7A, 0x47,
+    0xD9, 0xD8, 0x2B, 0x2C, 0xE3, 0x34, 0xAF, 0xF1, 0xD8, 0xD9, 0x90, 0x7C, 0xFC, 0xD2, 0xF4, 0xA1,
+    0xE4, 0x89, 0x46, 0xBC, 0xF3, 0xA4, 0x9E, 0x0F, 0xF3, 0xD9, 0xD1, 0x55, 0x7C, 0x88, 0xA5, 0xA5,
+    0x04, 0x1F, 0x23, 0xBE, 0x4D, 0xF5, 0x80, 0x9F, 0x9F, 0x96, 0x37, 0x36, 0xB1, 0x7A, 0xE9, 0x19,
+    0x25, 0xDA, 0x79, 0x6A, 0x4E, 0xC0, 0x89, 0xE3, 0xF2, 0xDC, 0xCE, 0xAE, 0x1E, 0x0C, 0x5E, 0x5F,
+    0x6A, 0x5E, 0xD1, 0x7D, 0xB1, 0x6D, 0x29, 0xCA, 0xF1, 0xCE, 0xD2, 0xC5, 0x53, 0x52, 0xBF, 0xEF,
+    0x64, 0x5C, 0x36, 0x7C, 0xB7, 0x14, 0x67, 0xF3, 0x2B, 0x91, 0x7D, 0x35, 0x7C, 0xF3, 0x99, 0x21,
+    0x9E, 0x88, 0x93, 0x4E, 0xB0, 0xA5, 0xAB, 0x5E, 0xB4, 0xB4, 0xB9, 0x3A, 0xD5, 0xE1, 0x9F, 0x6E,
+    0xEF, 0xFE, 0xA8, 0xCB, 0xF5, 0x89, 0xD0, 0x6B, 0xC5, 0xCC, 0xD8, 0xD3, 0xC6, 0xCB, 0x35, 0xC4,
+    0x40, 0x33, 0xF5, 0xF2, 0xED, 0x77, 0x6E, 0x46, 0x44, 0xCB, 0x46, 0x3B, 0xDF, 0x02, 0xB7, 0x7F,
+    0x1E, 0x5F, 0xF1, 0x73, 0x56, 0xF2, 0x4C, 0xF9, 0xA5, 0xC8, 0x1A, 0x36, 0xA0, 0x69, 0x8E, 0xB2,
+    0xC6, 0xD7, 0x22, 0x31, 0x2C, 0x86, 0xBA, 0xAE, 0xC7, 0x2B, 0xBD, 0xEE, 0x0B, 0x36, 0x62, 0x44,
+    0xC6, 0x26, 0xB0, 0xE7, 0xAA, 0xE1, 0x5A, 0x64, 0x7D, 0x80, 0x78, 0xFA, 0x8D, 0x5D, 0xE3, 0x67,
+    0xDD, 0x29, 0x3F, 0xEB, 0x7F, 0x62, 0xD6, 0x3A, 0x90, 0x36, 0x17, 0xBE, 0x86, 0x93, 0x30, 0x0F,
+    0x73, 0x70, 0x06, 0x2E, 0x13, 0xF1, 0xB5, 0x6F, 0x82, 0x52, 0x16, 0x2A, 0x3E, 0x0F, 0x2C, 0xD8,
+    0xCE, 0x8B, 0x5E, 0x40, 0xEC, 0x66, 0x21, 0xAC, 0xD8, 0x23, 0x42, 0xFE, 0xF2, 0xD7, 0x34, 0x50,
+    0xC9, 0x0C, 0x2E, 0x5F, 0xFA, 0xBC, 0x99, 0x86, 0x6B, 0x33, 0x03, 0xB4, 0xD3, 0xD4, 0x25, 0xCC,
+    0x86, 0x19, 0xAF, 0x12, 0x5A, 0x16, 0x32, 0x99, 0xF1, 0xB5, 0x0A, 0x8A, 0x8D, 0xB0, 0x91, 0xC5,
+    0x97, 0x1D, 0xFE, 0xA8, 0xAA, 0xA7, 0xE0, 0x78, 0x78, 0xEE, 0xD6, 0x1F, 0xBF, 0x55, 0x83, 0x6E,
+    0x58, 0xE0, 0xC3, 0xED, 0x1D, 0x2E, 0x2A, 0x11, 0x77, 0x16, 0x8C, 0x5C, 0x2C, 0xDE, 0x83, 0x30,
+    0x51, 0xB1, 0x04, 0x93, 0xEE, 0x35, 0x10, 0x6E, 0xE9, 0x95, 0xE0, 0x27, 0xF5, 0x03, 0x75, 0xB6,
+    0x13, 0x6E, 0x17, 0x65, 0x2F, 0x0A, 0xB7, 0xAE, 0x49, 0x7C, 0xF4, 0xEB, 0xC6, 0x1A, 0x7B, 0x00,
+    0x27, 0x07, 0x2C, 0x3E, 0x7A, 0xF4, 0x55, 0xCE, 0x25, 0x66, 0x83, 0x01, 0xE5, 0xAD, 0xF8, 0xD6,
+    0x01, 0xBB, 0xEE, 0x43, 0x42, 0x8D, 0xA5, 0x4F, 0x81, 0x3B, 0x03, 0xFD, 0xBC, 0x7F, 0xD8, 0xBB,
+    0xE7, 0x29, 0x0C, 0x8A, 0xF9, 0xA8, 0xA9, 0xFA, 0xA9, 0x9E, 0x0B, 0x93, 0x49, 0xCF, 0x25, 0x36,
+    0x0A, 0x9B, 0xCE, 0x70, 0x48, 0xC2, 0xCC, 0x86, 0x43, 0x3B, 0x89, 0x12, 0xEB, 0x23, 0xA3, 0x11,
+    0xB4, 0xCE, 0x32, 0xD5, 0xF3, 0x61, 0xE2, 0x94, 0xB1, 0x8F, 0xF8, 0xD9, 0xE8, 0xFA, 0xCC, 0x70,
+    0x38, 0x3C, 0x4F, 0xB3, 0x8B, 0xC6, 0xDD, 0x0E, 0x8F, 0xB0, 0x9B, 0xA4, 0x3F, 0xA1, 0x45, 0x49,
+    0x1A, 0x3D, 0x36, 0x31, 0xD9, 0x0F, 0x89, 0x06, 0x77, 0xE6, 0xD8, 0x46, 0x70, 0x7B, 0xB4, 0x92,
+    0xA9, 0xF7, 0x2F, 0x4B, 0xF1, 0x7F, 0x2E, 0x75, 0x6D, 0xC4, 0x9E, 0xE0, 0xA7, 0x6F, 0x52, 0xB3,
+    0xBE, 0x88, 0xA7, 0x3F, 0x80, 0xFB, 0x68, 0x08, 0x70, 0x67, 0xB8, 0x88, 0xCD, 0x19, 0xB8, 0x07,
+    0xC7, 0xBE, 0xFB, 0xEA, 0xF6, 0xE8, 0x3A, 0x5B, 0x78, 0x13, 0x9B, 0xCB, 0x6B, 0xDF, 0x32, 0x06,
+    0xF0, 0xCD, 0x66, 0xED, 0x17, 0x1F, 0xE6, 0x0B, 0x00, 0xD7, 0x56, 0x38, 0xE8, 0x20, 0x9E, 0x13,
+    0x5E, 0x3C, 0x63, 0xD1, 0x9B, 0x99, 0xE1, 0xC0, 0x9D, 0x5E, 0xE5, 0x68, 0xB4, 0x6A, 0xA5, 0x92,
+    0x98, 0xC0, 0x0E, 0xFD, 0xDD, 0x9A, 0xE7, 0xEB, 0x2F, 0x54, 0xDE, 0x15, 0xDF, 0x97, 0xF3, 0xAF,
+    0x91, 0x6F, 0x67, 0xE0, 0xDD, 0x6D, 0x4E, 0x28, 0xB1, 0x73, 0xFF, 0xA1, 0x36, 0xDD, 0x65, 0x06,
+    0x1D, 0xAF, 0x94, 0x8B, 0xC6, 0x7E, 0xB9, 0x41, 0x60, 0xD3, 0x1B, 0x5E, 0x9C, 0x83, 0x93, 0x67,
+    0x48, 0x4E, 0x00, 0xFF, 0x4C, 0x31, 0x35, 0xD5, 0xEB, 0x2F, 0xF7, 0xD6, 0x97, 0xCD, 0x32, 0xC0,
+    0xDF, 0xAD, 0x55, 0x4D, 0x68, 0x1D, 0x55, 0x14, 0x3E, 0x33, 0xD3, 0x64, 0x6C, 0x87, 0x76, 0x8A,
+    0xB4, 0xA0, 0xFD, 0x9B, 0x2C, 0x5C, 0x14, 0x89, 0x9D, 0x4D, 0x16, 0x11, 0xD3, 0xDC, 0x89, 0x5D,
+    0x74, 0xE1, 0x22, 0x11, 0x52, 0x17, 0x05, 0xA9, 0x42, 0x37, 0xE2, 0xA2, 0x41, 0x22, 0x74, 0x91,
+    0x3A, 0x13, 0xAA, 0x54, 0xE8, 0x26, 0xE0, 0xC6, 0x85, 0x8B, 0x82, 0x45, 0x24, 0x9B, 0x3C, 0x30,
+    0x60, 0xD1, 0xD0, 0x99, 0xB4, 0x48, 0x17, 0x5D, 0x78, 0x6D, 0x28, 0x59, 0x08, 0x3A, 0xA4, 0x88,
+    0xA0, 0x42, 0x6F, 0xE9, 0x54, 0x5F, 0xDA, 0x99, 0x39, 0x7E, 0xE7, 0xBE, 0x24, 0xAD, 0x28, 0xBA,
+    0x71, 0x5E, 0xE6, 0x65, 0xEE, 0xBB, 0xE7, 0x9E, 0xFB, 0x9D, 0xEF, 0xFB, 0xCE, 0x9D, 0x7D, 0x1F,
+    0x35, 0x8E, 0x1E, 0xF4, 0x0A, 0x22, 0x7A, 0xFA, 0x83, 0xA8, 0x5A, 0xB9, 0x5B, 0xBF, 0xF3, 0x03,
+    0xED, 0x21, 0xFC, 0x39, 0x5D, 0xF2, 0x4B, 0x3A, 0xB1, 0x2D, 0x34, 0xE6, 0x4B, 0x3E, 0x36, 0xB6,
+    0x48, 0x33, 0xE4, 0x55, 0xE4, 0x17, 0xE4, 0x24, 0x03, 0xF1, 0x1F, 0xCB, 0xAB, 0xB5, 0xE3, 0x24,
+    0xE1, 0x77, 0x9A, 0x5B, 0xCF, 0x2D, 0xB1, 0x9A, 0x06, 0xDE, 0x88, 0x16, 0xCE, 0x73, 0xBD, 0x63,
+    0xA7, 0x0C, 0xFC, 0x0B, 0x55, 0x67, 0x64, 0x17, 0xB1, 0x57, 0x87, 0xED, 0xDC, 0xBE, 0xE4, 0x6D,
+    0x8D, 0xDF, 0xCE, 0xD1, 0xC9, 0x09, 0x9F, 0xF6, 0xF6, 0x25, 0xD4, 0x4F, 0xDB, 0x91, 0x85, 0xF6,
+    0xEC, 0xC4, 0x2E, 0xC7, 0x6F, 0x11, 0x3D, 0x75, 0x6E, 0x80, 0xE8, 0x02, 0x62, 0xB6, 0x4D, 0x1D,
+    0x26, 0x27, 0xA3, 0x09, 0x7C, 0xFA, 0x92, 0xBD, 0xA4, 0xB7, 0x7F, 0x86, 0x55, 0xC8, 0xF6, 0x93,
+    0x33, 0xD9, 0x97, 0x1B, 0x55, 0x70, 0x76, 0x64, 0xEC, 0x5E, 0x8D, 0xED, 0xFA, 0x46, 0xCF, 0x2E,
+    0x2E, 0x8D, 0x08, 0xCC, 0xB4, 0x8A, 0xEE, 0x5E, 0xD7, 0x2F, 0x0C, 0xAF, 0xEB, 0x28, 0xA3, 0x0E,
+    0xD1, 0x81, 0xD5, 0xAA, 0xFE, 0xFA, 0xFD, 0xC4, 0x3D, 0x75, 0x73, 0x76, 0xC9, 0x4D, 0x86, 0x82,
+    0x72, 0xE6, 0xEA, 0x10, 0xE9, 0x1D, 0x7E, 0x59, 0x85, 0xA7, 0x2E, 0xDC, 0xF9, 0x44, 0x4F, 0x69,
+    0x0A, 0x66, 0xCD, 0x48, 0x1C, 0x21, 0x6F, 0xF4, 0xED, 0xFD, 0xFA, 0x30, 0xFE, 0x77, 0x5E, 0xBA,
+    0xB5, 0x1E, 0x2F, 0x7F, 0x4C, 0x8E, 0xD7, 0x36, 0x53, 0xE6, 0xAB, 0xC0, 0x7F, 0xF7, 0xC1, 0xDA,
+    0x7A, 0x77, 0xE0, 0x40, 0xB0, 0xFE, 0xBA, 0x47, 0xD4, 0x45, 0x44, 0x37, 0x25, 0x0A, 0x4C, 0xFC,
+    0xF0, 0x24, 0x67, 0x3E, 0x73, 0x43, 0x74, 0x86, 0xE7, 0xE8, 0xA8, 0x14, 0xA5, 0x32, 0xF2, 0xAB,
+    0xB0, 0x7D, 0x2D, 0xD7, 0x2E, 0x73, 0x4B, 0xB4, 0x9F, 0x2F, 0xD1, 0xF3, 0xF3, 0xF3, 0x9F, 0x62,
+    0x90, 0x32, 0xEB, 0x8D, 0x47, 0x85, 0x47, 0x97, 0x2F, 0x53, 0xE8, 0x61, 0xB0, 0x70, 0x7E, 0x7D,
+    0x81, 0x39, 0x2B, 0xA9, 0xFF, 0x6A, 0x42, 0x74, 0x22, 0x91, 0x6C, 0x2D, 0x61, 0x86, 0x75, 0x58,
+    0xD1, 0x7E, 0xA3, 0x90, 0xB7, 0x9E, 0x24, 0xA9, 0x6E, 0xF3, 0x3A, 0xEC, 0xCE, 0xCF, 0xCF, 0x2F,
+    0x2C, 0x23, 0x84, 0x05, 0x0E, 0x2D, 0xCA, 0xD7, 0x6E, 0xDC, 0xA3, 0x2B, 0xDF, 0x1F, 0x1C, 0x9C,
+    0xBE, 0xC7, 0xB3, 0x1F, 0x62, 0x10, 0x5F, 0x5B, 0x1D, 0xBF, 0xF2, 0x22, 0x3D, 0x4C, 0x4E, 0x13,
+    0x39, 0x7A, 0xF7, 0xC8, 0x2E, 0xFF, 0xE5, 0xC2, 0x48, 0x12, 0x75, 0xEC, 0x26, 0xA2, 0xCC, 0xA3,
+    0xE4, 0x12, 0x0D, 0x0E, 0xDD, 0x5B, 0xB9, 0x78, 0x70, 0x24, 0x2D, 0xDF, 0x44, 0x4C, 0x7D, 0xF6,
+    0x15, 0x32, 0xC1, 0xE5, 0x67, 0x25, 0xDB, 0x20, 0x0D, 0x87, 0x8B, 0x23, 0x9D, 0xE9, 0xCE, 0xB4,
+    0x49, 0xCB, 0x67, 0x00, 0x6A, 0xD8, 0xD1, 0xC1, 0xD2, 0xD1, 0xCE, 0xDA, 0x8D, 0xF1, 0xC1, 0xE1,
+    0x89, 0x0C, 0xD1, 0x3F, 0xBE, 0x77, 0x64, 0xE6, 0xFE, 0x8D, 0xF1, 0xE1, 0xCE, 0x9D, 0xF1, 0x83,
+    0x03, 0xAF, 0x66, 0xE4, 0xFE, 0x36, 0x7A, 0x2C, 0x9B, 0x0E, 0x20, 0x16, 0x79, 0xE7, 0x6B, 0xE8,
+    0xED, 0x95, 0xA7, 0xCB, 0x5F, 0x07, 0xBF, 0x38, 0xDE, 0x99, 0x71, 0x93, 0xE0, 0x90, 0x77, 0xC5,
+    0x2D, 0x7D, 0x73, 0x68, 0x7A, 0xCF, 0x73, 0xB6, 0x84, 0x08, 0xFA, 0x46, 0xF0, 0x59, 0x8C, 0xE7,
+    0xA3, 0xF6, 0x97, 0x80, 0x99, 0x14, 0xD7, 0xC4, 0x6C, 0xFC, 0xF5, 0x13, 0x14, 0x63, 0x92, 0x91,
+    0x0A, 0x05, 0x46, 0xA0, 0x38, 0x65, 0x03, 0x46, 0x8B, 0xF0, 0xC1, 0x24, 0x81, 0x63, 0xA7, 0x11,
+    0x01, 0xA8, 0x17, 0xC4, 0x06, 0x64, 0x15, 0x91, 0xD0, 0xED, 0x48, 0x75, 0x51, 0xE2, 0xD4, 0x0D,
+    0x79, 0x6B, 0xA6, 0x37, 0xFE, 0x5F, 0x32, 0x43, 0xBC, 0x35, 0xB0, 0x3D, 0xCE, 0x5C, 0xEF, 0x4D,
+    0x6F, 0x4F, 0x6C, 0xAD, 0x47, 0x15, 0x39, 0x67, 0x9E, 0x68, 0x85, 0x48, 0x35, 0xCB, 0x63, 0x0D,
+    0xB5, 0x81, 0xF1, 0xBA, 0xAA, 0x88, 0xCA, 0x96, 0xF8, 0x78, 0xC5, 0x75, 0x7C, 0x9D, 0x8B, 0x3C,
+    0xAC, 0xE9, 0xF1, 0xA5, 0x0A, 0x72, 0xEB, 0x5E, 0xFD, 0xDD, 0x7F, 0x42, 0x28, 0x13, 0x39, 0x76,
+    0x40, 0x4C, 0x08, 0x7B, 0xA7, 0x89, 0x0D, 0x0F, 0x01, 0x0B, 0x08, 0x09, 0x08, 0xFD, 0x8A, 0x9E,
+    0x2C, 0x23, 0xD4, 0x1B, 0x89, 0x7D, 0x2E, 0x01, 0xB5, 0x76, 0xE0, 0x0B, 0xAF, 0xA5, 0x4E, 0x28,
+    0x10, 0x37, 0x8A, 0x51, 0xBF, 0x7C, 0x2E, 0x53, 0xF6, 0xCE, 0xE7, 0x2F, 0x53, 0x9E, 0xD8, 0xC4,
+    0x94, 0xCA, 0x5C, 0xD9, 0x0F, 0x2A, 0xD8, 0xC2, 0x70, 0xC4, 0xCF, 0x1B, 0x97, 0xC3, 0x15, 0x20,
+    0xE9, 0x98, 0x6B, 0xAF, 0xE9, 0x4F, 0xD2, 0xCC, 0xEE, 0x8B, 0x05, 0x1E, 0x27, 0x14, 0x21, 0x2C,
+    0xC5, 0x90, 0x31, 0xC4, 0x63, 0x54, 0x92, 0xD3, 0xF6, 0x27, 0x4A, 0xE7, 0x5C, 0x4B, 0x9A, 0x98,
+    0x33, 0x9B, 0x22, 0x47, 0xB1, 0x61, 0xE9, 0x57, 0x28, 0x00, 0x25, 0x66, 0xD1, 0x13, 0x8F, 0x3A,
+    0xA8, 0xBC, 0xCD, 0x47, 0x0B, 0x7E, 0x55, 0xC7, 0x0B, 0xD9, 0xD2, 0x12, 0x25, 0x09, 0x59, 0x11,
+    0x40, 0x53, 0x2B, 0x5B, 0x02, 0x3E, 0x4B, 0x9D, 0xE0, 0x22, 0x4D, 0xB0, 0x1A, 0x44, 0xA8, 0x0C,
+    0x42, 0xF9, 0x66, 0x6B, 0xCA, 0x66, 0xC0, 0x97, 0xF0, 0x84, 0x65, 0x42, 0x0A, 0x8A, 0x13, 0xB8,
+    0x79, 0x8F, 0xB8, 0xF6, 0x2F, 0xD3, 0xB5, 0x65, 0xF2, 0x6F, 0xD3, 0x7E, 0x0D, 0x15, 0xA0, 0x26,
+    0xF2, 0x77, 0x7B, 0x0D, 0x05, 0x26, 0x11, 0x44, 0xB6, 0xC9, 0x31, 0xC7, 0xB2, 0xCB, 0x6D, 0xA1,
+    0x2C, 0x30, 0xA2, 0x8C, 0xD7, 0xF5, 0x64, 0xBA, 0x71, 0x5A, 0xB8, 0x3E, 0x15, 0x2B, 0x00, 0x91,
+    0x08, 0x19, 0x96, 0xE1, 0x23, 0x1C, 0x0E, 0x15, 0x0E, 0x03, 0xE3, 0xD6, 0x6E, 0x6D, 0x0B, 0xCD,
+    0x71, 0xA7, 0x99, 0x2A, 0xD4, 0x37, 0x29, 0x38, 0x49, 0x57, 0xB8, 0xC4, 0xE9, 0x61, 0xAC, 0xFD,
+    0x4A, 0x55, 0x62, 0x93, 0xB9, 0x4D, 0xE2, 0x73, 0x29, 0xCC, 0xAE, 0x41, 0xA6, 0x5E, 0x31, 0x3D,
+    0xF4, 0x16, 0xAE, 0x85, 0x5F, 0x00, 0xB6, 0x23, 0x27, 0x80, 0x1C, 0x41, 0xF0, 0x5E, 0x6C, 0xBF,
+    0xC1, 0xE6, 0x32, 0x63, 0x41, 0xEB, 0x36, 0x91, 0xF6, 0xAB, 0xA0, 0xCA, 0x93, 0x58, 0xAB, 0x6B,
+    0x58, 0xE8, 0x72, 0x28, 0x6E, 0x36, 0x2A, 0x83, 0x53, 0xC7, 0xC4, 0xF6, 0x73, 0xFF, 0xEE, 0xEA,
+    0x39, 0x44, 0x97, 0x88, 0xD5, 0x70, 0xF5, 0x2C, 0x2A, 0x0C, 0x8C, 0x5F, 0xC1, 0xD5, 0xBA, 0xA5,
+    0xDC, 0x87, 0x70, 0x31, 0x4A, 0xC8, 0xAD, 0x83, 0x7A, 0xFD, 0x2C, 0x6C, 0x58, 0x2E, 0x64, 0x90,
+    0x3C, 0x2E, 0x23, 0x34, 0x01, 0xE0, 0x38, 0x2D, 0xB2, 0xAA, 0xC2, 0xAD, 0x45, 0xBB, 0x6B, 0xE8,
+    0xCE, 0x2E, 0xDC, 0xA4, 0x40, 0xB4, 0x0F, 0xB2, 0xB0, 0x59, 0x41, 0xE1, 0xEF, 0x58, 0xD9, 0x62,
+    0x3A, 0xD2, 0x30, 0x61, 0xE3, 0x77, 0x85, 0xC9, 0xC2, 0x13, 0xE6, 0x7A, 0xB6, 0x11, 0x74, 0xBD,
+    0x66, 0x31, 0x72, 0xB8, 0x89, 0xBD, 0xA4, 0xA7, 0xBC, 0x0D, 0xEF, 0x5F, 0x85, 0x8B, 0x43, 0x1D,
+    0xB4, 0x10, 0x83, 0x75, 0x54, 0x28, 0x90, 0x1E, 0xA0, 0x23, 0xB3, 0x16, 0x12, 0xA9, 0x34, 0x4B,
+    0x83, 0xFB, 0x95, 0x6F, 0x6A, 0x68, 0xA4, 0x2E, 0x9A, 0xF0, 0x67, 0x83, 0xB8, 0x26, 0xD4, 0x11,
+    0x67, 0x8D, 0xCB, 0x06, 0xE1, 0x0D, 0x34, 0xE2, 0x4C, 0x65, 0xCA, 0x78, 0x95, 0x0F, 0x76, 0xF0,
+    0x52, 0xA1, 0x49, 0xBC, 0xF5, 0x42, 0x20, 0x5B, 0x15, 0x01, 0xE0, 0x10, 0x7A, 0x6B, 0x0B, 0x80,
+    0x2A, 0xD2, 0x04, 0xF6, 0xAD, 0xAC, 0x7D, 0x63, 0x8D, 0xC5, 0xF0, 0x60, 0x01, 0x75, 0x1A, 0x10,
+    0x11, 0xDE, 0x91, 0x9A, 0xC4, 0x7F, 0x2C, 0x2D, 0x8B, 0x81, 0x2B, 0xDD, 0x20, 0x9D, 0x28, 0xAD,
+    0x42, 0x79, 0x81, 0x4E, 0xC3, 0x20, 0x97, 0xB3, 0x86, 0xE9, 0x49, 0xD1, 0xAD, 0xB8, 0xAD, 0x6D,
+    0x09, 0xBF, 0x0B, 0xBD, 0xD3, 0x44, 0x15, 0x72, 0x9C, 0x58, 0xE7, 0x48, 0x1F, 0xC1, 0xF6, 0xBD,
+    0x38, 0xD7, 0xC6, 0x41, 0x0F, 0xAF, 0xEB, 0x02, 0x6F, 0x12, 0x4B, 0x1C, 0xDB, 0x73, 0x04, 0x87,
+    0x88, 0x7D, 0xF9, 0xC8, 0x61, 0x21, 0x7A, 0x5A, 0x95, 0x2C, 0x6B, 0xFF, 0x75, 0xFD, 0x09, 0xB5,
+    0x55, 0xB1, 0x92, 0xDD, 0x34, 0x14, 0xBD, 0xB2, 0x26, 0x71, 0xE1, 0x42, 0x0D, 0x34, 0x50, 0xF8,
+    0x13, 0xFC, 0x09, 0xF2, 0xD0, 0xA4, 0xCC, 0x36, 0x81, 0x22, 0xC5, 0x7E, 0x42, 0xFE, 0x20, 0x32,
+    0x93, 0x61, 0x28, 0x52, 0x24, 0xC3, 0x0C, 0x5F, 0x41, 0xB1, 0x7C, 0x41, 0x24, 0x48, 0x49, 0x81,
+    0x86, 0x66, 0x4B, 0x3C, 0x40, 0x86, 0x82, 0x22, 0x5A, 0xE2, 0x25, 0xDE, 0x45, 0xD2, 0xE5, 0x5C,
+    0xBD, 0x97, 0xD9, 0x0D, 0x43, 0x8B, 0x77, 0xEC, 0x59, 0x3F, 0x5F, 0x5D, 0x9D, 0x7B, 0xEE, 0xB9,
+    0x47, 0x44, 0xE3, 0x46, 0x64, 0x2A, 0x51, 0xCF, 0x0B, 0xE9, 0xBF, 0x13, 0xA9, 0x92, 0x89, 0xAA,
+    0x25, 0x72, 0x26, 0x90, 0x7D, 0x92, 0x68, 0x0C, 0x85, 0xCC, 0x6A, 0xE7, 0xE1, 0xEA, 0x34, 0x6A,
+    0xE6, 0xBD, 0x63, 0xAE, 0xC4, 0xCC, 0xC1, 0xD3, 0x90, 0xEC, 0xD2, 0xE5, 0x29, 0x20, 0x76, 0x45,
+    0x1C, 0x79, 0xDE, 0x10, 0x11, 0x0D, 0x33, 0xB9, 0x07, 0x27, 0x1D, 0x12, 0x99, 0x44, 0x64, 0x17,
+    0x22, 0x2C, 0xE9, 0x99, 0xE7, 0x09, 0x5F, 0xB8, 0xAF, 0x7A, 0xEF, 0xF7, 0x31, 0x8E, 0xAB, 0x23,
+    0xFF, 0x49, 0x1E, 0x32, 0xE2, 0xA3, 0xE5, 0xAA, 0x18, 0x10, 0xC8, 0xD7, 0x19, 0xD9, 0x13, 0xEE,
+    0xAC, 0xEA, 0xC3, 0xAC, 0x72, 0x57, 0xBA, 0xDC, 0x65, 0x9D, 0xF5, 0x8E, 0xDC, 0x49, 0xB2, 0x0C,
+    0x08, 0x34, 0xE9, 0xD1, 0x6A, 0x12, 0xFE, 0xF0, 0x1C, 0xA3, 0x49, 0x53, 0x70, 0xAB, 0x05, 0x28,
+    0xDC, 0xB3, 0x65, 0xD4, 0xE4, 0x39, 0x21, 0x3E, 0x34, 0x2C, 0x5F, 0x9F, 0x28, 0x60, 0x19, 0x04,
+    0x4B, 0x40, 0x71, 0x28, 0x16, 0x01, 0x80, 0x4D, 0x4C, 0xA4, 0x77, 0xA0, 0x8C, 0x28, 0x77, 0xA6,
+    0xDB, 0x80, 0x0B, 0xC9, 0x35, 0x0A, 0x24, 0xA4, 0x58, 0x09, 0xB9, 0x36, 0x52, 0xF5, 0x33, 0x84,
+    0x78, 0x59, 0x66, 0x03, 0xA2, 0x0C, 0x6A, 0xA0, 0x3E, 0x21, 0x9B, 0x40, 0x94, 0xCC, 0x2C, 0x89,
+    0xF0, 0xC5, 0x86, 0x31, 0xD2, 0xB8, 0x62, 0x4B, 0x93, 0x74, 0xA6, 0x61, 0xC7, 0x17, 0x40, 0x63,
+    0xA9, 0x95, 0xB9, 0x97, 0xC7, 0xE7, 0x58, 0x30, 0x46, 0x2F, 0xB8, 0x80, 0xAA, 0xCB, 0x02, 0xA2,
+    0xFE, 0x1B, 0xF7, 0x2D, 0x48, 0xA0, 0x27, 0x62, 0x21, 0x4D, 0x9C, 0x89, 0x1F, 0xCC, 0x82, 0x1B,
+    0x7B, 0x00, 0xCD, 0x01, 0x37, 0xCB, 0x06, 0x59, 0x09, 0x56, 0x9A, 0x16, 0x03, 0x4A, 0xC8, 0x91,
+    0x9D, 0xFD, 0x4C, 0x55, 0xE5, 0x7E, 0x47, 0x50, 0xDB, 0x47, 0x6F, 0xF6, 0x49, 0xE3, 0xA2, 0x4E,
+    0x58, 0x6C, 0xCE, 0x2F, 0xB1, 0xA5, 0x20, 0xC3, 0x1E, 0xD2, 0x54, 0x3C, 0xC1, 0x2E, 0x02, 0xC8,
+    0xFD, 0xFC, 0x07, 0x48, 0xEA, 0xB3, 0xBB, 0x2F, 0xDB, 0xFF, 0x94, 0x65, 0x6D, 0x35, 0x09, 0x34,
+    0x4D, 0xE8, 0x3A, 0x03, 0x0E, 0x15, 0x54, 0x66, 0xB6, 0x3E, 0x49, 0x75, 0xCB, 0x14, 0x04, 0x27,
+    0xAE, 0xBB, 0xBC, 0x93, 0x13, 0x8C, 0xBC, 0xAB, 0x65, 0x3C, 0x72, 0xCE, 0x8D, 0xF3, 0x6F, 0x78,
+    0xD1, 0x0C, 0x5E, 0x70, 0x7F, 0xE8, 0xE3, 0x51, 0x19, 0x68, 0x41, 0xFE, 0x80, 0x6C, 0xF4, 0x67,
+    0xDC, 0xB5, 0x06, 0xD7, 0x96, 0x86, 0x5E, 0x90, 0x5D, 0x4D, 0x1C, 0x2A, 0x15, 0xC5, 0x71, 0x0C,
+    0x16, 0x0C, 0x0F, 0xE8, 0xEF, 0x52, 0x77, 0xD4, 0xE0, 0x16, 0x37, 0xBC, 0xC1, 0xD6, 0x19, 0x12,
+    0xB2, 0x4F, 0x93, 0xF9, 0x3D, 0x21, 0xAE, 0xA0, 0x1F, 0xBC, 0x94, 0x8E, 0x13, 0xC2, 0xA1, 0x1A,
+    0xCD, 0x8B, 0x5D, 0x6C, 0xD2, 0x5B, 0x5F, 0xC0, 0x05, 0xA9, 0x93, 0x3B, 0xD8, 0xB2, 0x43, 0xB3,
+    0xAE, 0xBC, 0x10, 0x06, 0x58, 0x1F, 0x3D, 0xFF, 0x9F, 0xF6, 0xF2, 0x24, 0x7C, 0x80, 0x98, 0xAA,
+    0x2A, 0xDA, 0x64, 0x03, 0xFA, 0x9B, 0xC8, 0x7E, 0x5F, 0xA0, 0x37, 0x07, 0x79, 0x80, 0xEF, 0x5E,
+    0x68, 0xF6, 0x40, 0x61, 0xFE, 0x82, 0xD8, 0x40, 0x2D, 0xE2, 0x40, 0x6B, 0x41, 0xAF, 0xA6, 0x60,
+    0x03, 0x04, 0x9F, 0x41, 0xD0, 0xB8, 0x82, 0x37, 0x70, 0x04, 0x6A, 0xF6, 0x83, 0x12, 0x45, 0xE1,
+    0xAA, 0x40, 0x88, 0x43, 0x92, 0x94, 0xD8, 0x56, 0x15, 0x55, 0xF0, 0x06, 0xB1, 0x41, 0x95, 0xA1,
+    0xA9, 0xB0, 0xDF, 0xB4, 0xA4, 0x81, 0x40, 0x2A, 0xB0, 0xE0, 0x2D, 0x93, 0x03, 0x20, 0x5B, 0xB1,
+    0x80, 0x93, 0x2A, 0xBA, 0xB6, 0x71, 0x68, 0x17, 0x3A, 0xE1, 0xA0, 0xB9, 0x59, 0x43, 0x75, 0x85,
+    0xC6, 0x4A, 0x0E, 0x3B, 0x6E, 0x1D, 0xAF, 0x3D, 0x7E, 0x78, 0xBD, 0x58, 0x4F, 0xF6, 0xB1, 0xBA,
+    0xDE, 0x29, 0xEF, 0xE6, 0xC7, 0xB5, 0x7F, 0x93, 0x1E, 0xDB, 0x79, 0x7A, 0xF6, 0xF2, 0x22, 0xC3,
+    0x25, 0xC6, 0xA7, 0xA8, 0x38, 0x67, 0xC0, 0x7C, 0xF9, 0x76, 0x45, 0xE1, 0x86, 0x75, 0xEA, 0xF6,
+    0x69, 0x1F, 0x83, 0x89, 0x1E, 0x06, 0x61, 0x3B, 0xCC, 0xBA, 0x82, 0xF2, 0x4C, 0x53, 0xAA, 0x0C,
+    0x2A, 0xC4, 0x5A, 0x1B, 0x32, 0x2D, 0x23, 0x03, 0xF8, 0xA1, 0x61, 0xF5, 0xD0, 0x4C, 0x9B, 0x6E,
+    0x06, 0x27, 0xBC, 0x9A, 0xCB, 0x4F, 0xCB, 0x4D, 0x5C, 0x41, 0xDC, 0x14, 0x5A, 0x15, 0x1E, 0xD3,
+    0x35, 0xA4, 0x03, 0x27, 0x72, 0x01, 0x66, 0x73, 0x96, 0x5E, 0x56, 0x57, 0x5D, 0x35, 0x62, 0xBF,
+    0x43, 0x71, 0x9B, 0x07, 0x95, 0x20, 0xC3, 0x9D, 0xAE, 0x34, 0x9D, 0x6F, 0x34, 0xFC, 0x09, 0xEA,
+    0xB3, 0x9F, 0x55, 0x05, 0x27, 0xFE, 0x9E, 0xD0, 0xC1, 0x8B, 0x47, 0x0F, 0x79, 0xED, 0x84, 0xD5,
+    0x51, 0xBC, 0xA7, 0xB1, 0x71, 0x18, 0xBE, 0xDC, 0x2C, 0x6E, 0x7C, 0xF5, 0x70, 0x07, 0x4A, 0x8C,
+    0x74, 0x18, 0x92, 0x96, 0x21, 0x76, 0x8B, 0x41, 0x47, 0x94, 0xB0, 0x3A, 0xBD, 0xAB, 0x46, 0x86,
+    0x5D, 0x1F, 0xE2, 0x26, 0x89, 0xCB, 0x32, 0xEC, 0x70, 0x28, 0xA0, 0x94, 0x81, 0xBE, 0x92, 0xC9,
+    0x8A, 0xB8, 0xB1, 0xEC, 0x74, 0x6F, 0x56, 0x76, 0xB0, 0x33, 0xDC, 0xC3, 0xDE, 0x5F, 0xFB, 0x34,
+    0x1C, 0x4C, 0x73, 0x36, 0xD7, 0xCF, 0xDB, 0x4C, 0xC3, 0x4A, 0x9B, 0x3D, 0xC9, 0xE4, 0xC8, 0x8C,
+    0x60, 0xE8, 0x0E, 0x57, 0x0F, 0xA4, 0xAE, 0x4D, 0xF9, 0x8E, 0x0E, 0x7E, 0x6B, 0xC4, 0x03, 0xD2,
+    0x4D, 0xAC, 0x3B, 0xC6, 0xFA, 0xE3, 0x2D, 0xFF, 0x3B, 0xF9, 0xB6, 0xDE, 0x15, 0x2B, 0x93, 0xD1,
+    0xC6, 0xDC, 0x1E, 0xAC, 0x0D, 0x74, 0xFF, 0x80, 0x32, 0x51, 0xE5, 0x17, 0xA7, 0x97, 0x27, 0x42,
+    0x27, 0x3C, 0x1C, 0x3A, 0x92, 0x64, 0xA8, 0x40, 0xF2, 0x89, 0xC5, 0x20, 0x85, 0x08, 0xE5, 0xF8,
+    0x19, 0xE5, 0xC0, 0x36, 0xBA, 0x83, 0x99, 0xDA, 0xE0, 0xE6, 0x61, 0xD3, 0x5B, 0xAB, 0x76, 0x8A,
+    0x28, 0x6C, 0x07, 0x72, 0x8C, 0x56, 0x81, 0x2B, 0x9A, 0x5F, 0x45, 0xDD, 0x58, 0xDD, 0x8B, 0xB5,
+    0xD8, 0x2C, 0x9D, 0x5A, 0x0E, 0x68, 0xB5, 0x00, 0xF0, 0x01, 0x68, 0xF0, 0xE2, 0x8B, 0x38, 0x0E,
+    0xBD, 0x7F, 0x89, 0x5B, 0x37, 0x67, 0xA3, 0x8F, 0xF9, 0xAA, 0xB5, 0x24, 0x29, 0xB1, 0x4C, 0xE2,
+    0xAF, 0xB2, 0x4B, 0x7E, 0x7E, 0xA1, 0x61, 0x47, 0x76, 0x76, 0xA7, 0x11, 0x53, 0x78, 0x2E, 0x0E,
+    0x74, 0x21, 0x23, 0x88, 0x1F, 0x6B, 0x57, 0x4D, 0xB1, 0xF7, 0x98, 0x5A, 0xB8, 0x91, 0xA3, 0x8A,
+    0x1E, 0xF1, 0x6F, 0xD4, 0xAC, 0x15, 0x38, 0x84, 0xC8, 0x3B, 0xF2, 0xB0, 0x0B, 0xE6, 0xCC, 0x8A,
+    0x67, 0x4D, 0xD1, 0x46, 0x14, 0xE7, 0x61, 0xE7, 0x09, 0x40, 0x86, 0xB7, 0xD8, 0x5C, 0xCB, 0x09,
+    0xA2, 0xC5, 0x4A, 0x3B, 0xB1, 0x09, 0x2D, 0xD0, 0x9B, 0x61, 0x4C, 0xAF, 0xE5, 0xA8, 0x78, 0x26,
+    0x8C, 0x60, 0xA9, 0x96, 0x61, 0x1D, 0xD0, 0x48, 0xD4, 0x25, 0xD3, 0x1A, 0xBA, 0xFA, 0x6E, 0xF4,
+    0x75, 0x13, 0xC6, 0x32, 0xC6, 0x7E, 0xFB, 0x4F, 0x01, 0x95, 0xF7, 0xE2, 0x6E, 0x04, 0x84, 0x38,
+    0x39, 0x43, 0x79, 0xB3, 0xC7, 0x73, 0xA2, 0x19, 0x33, 0x35, 0xFA, 0x5B, 0x7B, 0x64, 0x15, 0x82,
+    0xDD, 0x6C, 0x7E, 0x41, 0xFC, 0x7D, 0x28, 0x10, 0x52, 0xBB, 0x80, 0xEA, 0xBF, 0x44, 0xD2, 0x29,
+    0x0E, 0x9B, 0x7B, 0xE5, 0x03, 0xD6, 0x89, 0x46, 0xE8, 0xEC, 0xEC, 0xD6, 0x09, 0x71, 0x3C, 0x46,
+    0x0A, 0xDD, 0x8C, 0x3E, 0xFD, 0x03, 0x9D, 0x55, 0x31, 0x73, 0x1E, 0x35, 0x10, 0xDD, 0xD3, 0xCD,
+    0xE4, 0x98, 0x5C, 0x21, 0x1A, 0x9A, 0xB8, 0xB8, 0x9E, 0x46, 0x3F, 0x41, 0x87, 0x1B, 0x17, 0x14,
+    0x50, 0xD1, 0xA4, 0x80, 0x92, 0xA1, 0xC9, 0x3F, 0x40, 0x67, 0x5C, 0x52, 0xE0, 0x9E, 0x02, 0x97,
+    0xC6, 0x14, 0xF9, 0x03, 0x60, 0x1D, 0x71, 0x41, 0x41, 0xC1, 0x25, 0x8E, 0x69, 0x73, 0x24, 0xA6,
+    0x08, 0x2E, 0xAC, 0x90, 0x63, 0xE6, 0x26, 0x91, 0xB4, 0xBC, 0xD5, 0xF7, 0x11, 0x60, 0x86, 0x34,
+    0xDC, 0xCC, 0x5D, 0xBE, 0x58, 0xD2, 0xEE, 0xDB, 0xB7, 0x6F, 0x9F, 0xC8, 0x93, 0xED, 0xED, 0x60,
+    0xC7, 0x6E, 0xD4, 0xB3, 0x9E, 0xDB, 0xD0, 0x2C, 0xCD, 0x52, 0x47, 0x15, 0xAB, 0x48, 0x99, 0x98,
+    0x3C, 0xB9, 0xDE, 0x8E, 0x76, 0x34, 0x65, 0x59, 0xBF, 0x5A, 0x56, 0x9B, 0x65, 0x96, 0xE5, 0xC1,
+    0x0E, 0xFF, 0x5A, 0x5E, 0xB1, 0x9C, 0xAA, 0xB2, 0x2C, 0xCF, 0x60, 0xE5, 0x3B, 0x69, 0xF9, 0x06,
+    0x92, 0x88, 0x92, 0x12, 0x11, 0xBB, 0x49, 0x8E, 0x48, 0xCA, 0x7A, 0x2D, 0x29, 0xD3, 0x36, 0xE5,
+    0x26, 0xE2, 0x6B, 0x97, 0x4B, 0xCA, 0xED, 0x79, 0x2C, 0x87, 0xCD, 0xF2, 0x26, 0xA5, 0x3C, 0xB1,
+    0x24, 0xCC, 0x5D, 0xF9, 0x4F, 0x4F, 0x78, 0xCC, 0x28, 0xDF, 0x36, 0xC8, 0xB7, 0x8E, 0xF2, 0xA5,
+    0xAF, 0xC9, 0xF1, 0xA0, 0x38, 0x91, 0x06, 0xA8, 0xB7, 0x1C, 0x36, 0x30, 0xD6, 0x56, 0xA2, 0xEE,
+    0x57, 0x60, 0xE4, 0xA9, 0x16, 0xC8, 0x2F, 0x78, 0xB4, 0x03, 0xBF, 0x93, 0x54, 0x6A, 0x43, 0xBB,
+    0x08, 0x0F, 0xB9, 0xC9, 0x0D, 0xCA, 0x40, 0x6C, 0x6C, 0x3A, 0x94, 0x6A, 0x10, 0x56, 0x42, 0x5A,
+    0x30, 0x40, 0x85, 0x0F, 0x6A, 0x40, 0x00, 0xE2, 0x4C, 0xBA, 0x54, 0x6B, 0x1F, 0x4A, 0x4A, 0x00,
+    0xD1, 0x33, 0x4E, 0x0E, 0xAE, 0x37, 0x57, 0xAC, 0x12, 0xB1, 0xCA, 0x1A, 0xC8, 0x9B, 0x15, 0xD4,
+    0x4F, 0xDD, 0x94, 0x71, 0x90, 0xF7, 0x16, 0x15, 0xDB, 0x08, 0x2E, 0x91, 0x9B, 0xC9, 0x72, 0xAA,
+    0x63, 0x55, 0x0E, 0x96, 0x3C, 0x92, 0x45, 0x7E, 0x22, 0x83, 0xC4, 0x97, 0xE8, 0xF6, 0x02, 0x29,
+    0x79, 0x90, 0xB8, 0x88, 0xDA, 0x23, 0xA6, 0x70, 0x21, 0xBC, 0xB8, 0xDE, 0xEF, 0x22, 0x96, 0x44,
+    0x42, 0x1C, 0x44, 0x19, 0x4A, 0xD5, 0x95, 0x4F, 0x84, 0xCA, 0x50, 0x38, 0xCF, 0xD5, 0xA1, 0x41,
+    0x88, 0x76, 0xD9, 0x94, 0x8D, 0xF7, 0x93, 0x6F, 0x56, 0x44, 0x93, 0x77, 0xA1, 0x93, 0xBB, 0x61,
+    0x93, 0xA2, 0x9B, 0xA5, 0xB6, 0x8F, 0x2A, 0x20, 0x47, 0xCD, 0x0E, 0xCB, 0x86, 0x27, 0xFA, 0xC7,
+    0x63, 0x46, 0xC5, 0x33, 0xB6, 0x02, 0x04, 0x82, 0x08, 0x39, 0x55, 0xAA, 0x41, 0x13, 0x79, 0x54,
+    0x29, 0x94, 0x31, 0x16, 0xF5, 0xEC, 0x7B, 0x15, 0x91, 0x79, 0x24, 0x5F, 0x89, 0x0C, 0xEC, 0xE8,
+    0x11, 0x4A, 0x07, 0xFB, 0x73, 0xC6, 0x29, 0xE0, 0x1D, 0x54, 0x6A, 0x16, 0x24, 0xE3, 0x2A, 0xA2,
+    0x50, 0x3F, 0x78, 0x79, 0x71, 0x5A, 0x2A, 0xD0, 0x33, 0xCE, 0x4C, 0xCD, 0x42, 0xED, 0xB6, 0x0C,
+    0x79, 0xEE, 0x20, 0xAB, 0xE5, 0x4C, 0xB2, 0xA1, 0xE2, 0xDD, 0x58, 0x72, 0xD5, 0x11, 0x75, 0xD8,
+    0xD1, 0xF5, 0x75, 0xC4, 0xF6, 0xEE, 0x05, 0x4B, 0x2F, 0x03, 0x35, 0xD8, 0x47, 0x7C, 0x67, 0x22,
+    0xFB, 0x20, 0x52, 0x0B, 0xCA, 0x15, 0x23, 0x89, 0x43, 0x73, 0xB5, 0x08, 0x36, 0x0B, 0xBD, 0x66,
+    0xFF, 0xA8, 0xE1, 0x47, 0x23, 0x42, 0xD6, 0xB9, 0x5B, 0xBB, 0xD9, 0x4C, 0x80, 0x20, 0xC2, 0x82,
+    0xC8, 0x66, 0x08, 0xAE, 0xCF, 0xA8, 0x2B, 0xA2, 0x14, 0x14, 0xD1, 0xF1, 0x29, 0x99, 0x3F, 0x96,
+    0xBF, 0x49, 0xB8, 0xF1, 0x2D, 0xED, 0xF0, 0xD8, 0x72, 0x54, 0xFC, 0xB4, 0x77, 0x93, 0x30, 0xA7,
+    0xE2, 0xDB, 0x64, 0xEF, 0x4A, 0xCD, 0xC1, 0xCD, 0xDC, 0xAE, 0x6D, 0xE0, 0xDE, 0x89, 0x9E, 0x31,
+    0x16, 0x85, 0x10, 0x15, 0x9B, 0x8C, 0xBE, 0x01, 0x9E, 0xDF, 0x46, 0xDA, 0x01, 0x23, 0xBC, 0x08,
+    0x4B, 0xA8, 0x07, 0x08, 0xEE, 0xA5, 0xDB, 0xAB, 0xE0, 0xC1, 0x1F, 0xEC, 0x3E, 0x83, 0x5C, 0x48,
+    0xD0, 0xED, 0xE6, 0x0F, 0x81, 0x21, 0xA1, 0x0D, 0xFD, 0x86, 0x87, 0x4B, 0x11, 0x17, 0xC2, 0x54,
+    0xE0, 0x1B, 0x85, 0x54, 0x3C, 0xEE, 0xF0, 0x64, 0x78, 0xE8, 0x92, 0x34, 0x17, 0x75, 0xF6, 0xFE,
+    0xCB, 0x59, 0xF3, 0x5A, 0x81, 0xF0, 0xED, 0xA3, 0xC1, 0x23, 0xDA, 0xA5, 0xE5, 0x2F, 0x16, 0xD2,
+    0xCF, 0xD2, 0xEB, 0x1B, 0x97, 0xAC, 0xF8, 0x2A, 0x78, 0xE6, 0x6E, 0xB1, 0xBF, 0x63, 0x9A, 0xA0,
+    0xCC, 0x27, 0xAB, 0x4A, 0xA8, 0xFD, 0xAC, 0xE8, 0x14, 0xCB, 0x5E, 0x02, 0x91, 0x49, 0xAF, 0xF0,
+    0x5A, 0x40, 0xE3, 0xD5, 0x4C, 0xAC, 0x67, 0xFB, 0xF9, 0x62, 0xCE, 0xA1, 0x2B, 0x91, 0xDC, 0x53,
+    0x11, 0x6D, 0x49, 0xFD, 0x1B, 0xC0, 0xA2, 0x9F, 0x25, 0xB5, 0x68, 0x0C, 0x7A, 0xB1, 0x4B, 0x1B,
+    0x0C, 0x88, 0x19, 0x33, 0xFA, 0xA9, 0x92, 0x86, 0xD6, 0x49, 0xDF, 0x4F, 0x32, 0xA4, 0xD9, 0x9C,
+    0xAD, 0x02, 0x0F, 0xE0, 0x50, 0x48, 0xF1, 0x0B, 0x73, 0x95, 0x65, 0x32, 0xA3, 0x93, 0xF1, 0xF5,
+    0xEF, 0x06, 0xDF, 0x57, 0x7E, 0xE6, 0x3A, 0x0F, 0x16, 0x9D, 0x31, 0xE0, 0x90, 0x12, 0xF9, 0x71,
+    0x5B, 0x98, 0xF2, 0x87, 0x48, 0xD7, 0x72, 0xAE, 0x64, 0x9C, 0x33, 0x7D, 0x80, 0x86, 0xCC, 0x35,
+    0xB4, 0x7E, 0x7B, 0x15, 0x38, 0x75, 0x3C, 0xF5, 0x2B, 0x04, 0xE1, 0x8A, 0x8E, 0x6E, 0x1E, 0xDE,
+    0x3C, 0x44, 0x53, 0xBB, 0xC9, 0xDC, 0x83, 0xE6, 0x20, 0x9F, 0x83, 0xB5, 0x5E, 0x6C, 0xEF, 0xF6,
+    0x80, 0xCF, 0x4B, 0x93, 0xCC, 0xCC, 0x4D, 0x6A, 0xC1, 0xBE, 0x8B, 0x88, 0xF3, 0xDE, 0x26, 0xC9,
+    0xFB, 0x55, 0xAF, 0x87, 0x48, 0xC9, 0x0C, 0x2D, 0xE0, 0xED, 0x5C, 0xD2, 0xFF, 0x8D, 0xA4, 0x8E,
+    0xD5, 0x31, 0xA4, 0x1F, 0xB0, 0x73, 0x6A, 0x82, 0x1F, 0xDA, 0x67, 0x10, 0xF3, 0xCB, 0x58, 0x0C,
+    0xA9, 0x83, 0xB8, 0xCD, 0xA3, 0x40, 0xE6, 0x07, 0x50, 0x7C, 0x00, 0x6D, 0x7F, 0x96, 0xC4, 0x20,
+    0xD0, 0x5E, 0xDF, 0xD3, 0xAD, 0x93, 0x13, 0x74, 0x3F, 0x8B, 0x41, 0x90, 0x85, 0xF0, 0x9D, 0x98,
+    0x31, 0xAA, 0x4B, 0xF5, 0x5A, 0x41, 0xF6, 0xF0, 0x10, 0x18, 0x8B, 0xF8, 0x26, 0x44, 0x26, 0x42,
+    0x83, 0xBD, 0xF8, 0x7E, 0x63, 0x81, 0xEA, 0x84, 0x6E, 0x1D, 0x6B, 0xB8, 0x4F, 0x70, 0x4B, 0xC3,
+    0xFB, 0xE8, 0x14, 0x50, 0xED, 0x73, 0xB0, 0xA7, 0xFA, 0x7A, 0x4C, 0xEB, 0xA7, 0xA7, 0xCD, 0xF3,
+    0x27, 0xCF, 0x17, 0xF3, 0xD3, 0x57, 0x5F, 0x4C, 0xA7, 0x36, 0xBA, 0x7A, 0xE1, 0xC7, 0x51, 0x9F,
+    0xA1, 0xB9, 0x4E, 0xAF, 0x48, 0x65, 0xC7, 0x28, 0xB0, 0x8F, 0x40, 0x3C, 0x66, 0x8C, 0x31, 0xD1,
+    0xC8, 0x85, 0xCE, 0x5F, 0xF8, 0x1E, 0xB6, 0x2B, 0xB3, 0x6F, 0x2E, 0xDC, 0xC0, 0x32, 0x28, 0x92,
+    0xFD, 0xAF, 0x4D, 0x68, 0xE9, 0xCE, 0x22, 0x75, 0x89, 0xF5, 0xF0, 0x81, 0x48, 0xFB, 0x41, 0xAA,
+    0x12, 0xF4, 0x75, 0x8E, 0xF9, 0x7A, 0xAD, 0xBE, 0xD4, 0xD1, 0x29, 0x59, 0x2B, 0x61, 0x27, 0xF7,
+    0x4B, 0x6E, 0xE1, 0x12, 0x4C, 0x59, 0xCF, 0xDD, 0xFD, 0xA4, 0x60, 0x92, 0x42, 0xF5, 0x8A, 0xB3,
+    0x07, 0x18, 0x0B, 0xB8, 0x1D, 0x70, 0x04, 0xFA, 0xD8, 0x0C, 0x14, 0x41, 0x1F, 0x8B, 0xDA, 0xF7,
+    0x70, 0x25, 0xC0, 0x0F, 0xA2, 0x00, 0xC0, 0xBF, 0x8B, 0x60, 0x02, 0x2F, 0x4B, 0xBB, 0xE8, 0xB5,
+    0x0B, 0xC5, 0x57, 0xAE, 0xB9, 0xEF, 0x7E, 0x4C, 0xE5, 0x7A, 0x90, 0x31, 0xB0, 0x43, 0x71, 0x57,
+    0x71, 0x83, 0xF2, 0x52, 0x87, 0x30, 0x5C, 0x73, 0xD2, 0xEB, 0x1B, 0xB0, 0x26, 0x6C, 0xC3, 0x2E,
+    0x6C, 0xB2, 0x7D, 0xF9, 0x8E, 0x6F, 0x9A, 0x97, 0xA1, 0x54, 0x35, 0x6D, 0xD0, 0x56, 0xDF, 0x09,
+    0x5E, 0x27, 0x26, 0x78, 0x8D, 0x56, 0x3F, 0xE6, 0xF3, 0x08, 0xD4, 0xC1, 0x8C, 0x5C, 0x65, 0xF1,
+    0x91, 0x6E, 0xB2, 0xDF, 0x27, 0x81, 0x83, 0x19, 0x18, 0x41, 0x27, 0x26, 0x3A, 0x58, 0xDC, 0x08,
+    0x5E, 0xDA, 0xA5, 0x03, 0x7E, 0x50, 0x96, 0x1F, 0xDD, 0x54, 0x1D, 0x63, 0x52, 0xE4, 0xE6, 0x85,
+    0xA4, 0xA6, 0x7A, 0x41, 0x69, 0x19, 0x7E, 0x26, 0x4A, 0x68, 0x9F, 0x25, 0x58, 0x0B, 0x06, 0xD6,
+    0x39, 0x0C, 0xCA, 0xF5, 0x00, 0x3B, 0x97, 0xBB, 0x4B, 0x5C, 0x5A, 0xDC, 0x7C, 0xDD, 0xDC, 0x13,
+    0xB8, 0x2B, 0x49, 0x61, 0x02, 0xC4, 0x24, 0x5A, 0xBC, 0xB8, 0x1A, 0xFF, 0xFB, 0xF9, 0x13, 0xBD,
+    0x55, 0x2D, 0x93, 0x1D, 0x45, 0x14, 0xBD, 0x33, 0xB3, 0xEC, 0x50, 0x3B, 0xA2, 0x23, 0x30, 0x2C,
+    0xA2, 0x11, 0x08, 0x2A, 0xA6, 0x7F, 0x42, 0x4F, 0x81, 0x88, 0x40, 0x6C, 0x44, 0x1C, 0x82, 0x88,
+    0x38, 0x44, 0x3C, 0x62, 0x67, 0xD8, 0xFD, 0x03, 0x2B, 0xA0, 0x10, 0x98, 0x88, 0x88, 0x64, 0x4D,
+    0xFE, 0x00, 0x95, 0xEE, 0xCD, 0x8A, 0x88, 0x88, 0x8C, 0x47, 0x64, 0x42, 0x28, 0x10, 0x6B, 0x1A,
+    0xAA, 0x0B, 0x26, 0x9B, 0xEE, 0xBE, 0x9C, 0x3B, 0xEF, 0x25, 0x45, 0x61, 0xA8, 0x02, 0x8A, 0xA9,
+    0x37, 0xAF, 0xE6, 0xA3, 0xFB, 0xDC, 0x7B, 0xCF, 0x39, 0xF7, 0x0E, 0x91, 0x9A, 0x89, 0x28, 0xE3,
+    0xD4, 0x9E, 0xA8, 0x4E, 0xB8, 0xB0, 0x23, 0xD1, 0xE7, 0x85, 0x68, 0xE0, 0x42, 0x86, 0x79, 0xE9,
+    0x16, 0x37, 0xF8, 0xA2, 0x9E, 0x17, 0xE3, 0xB3, 0x7A, 0x91, 0xB4, 0x2F, 0xF6, 0x28, 0xA9, 0x17,
+    0x8B, 0xF9, 0x32, 0xDB, 0xF3, 0xC5, 0x9E, 0x67, 0x7B, 0x10, 0x35, 0x63, 0xB1, 0x63, 0x1E, 0x2B,
+    0x9C, 0x44, 0xD8, 0x4D, 0x6A, 0x22, 0xAA, 0x04, 0xCF, 0x00, 0xB8, 0x59, 0xB6, 0xC0, 0x74, 0x9F,
+    0x4E, 0xC9, 0x7A, 0xEE, 0xBB, 0xE8, 0x46, 0x2A, 0x78, 0x64, 0xD8, 0x53, 0x8B, 0x93, 0x18, 0x1B,
+    0x6C, 0xC0, 0x89, 0x6C, 0x0C, 0x50, 0xCC, 0xF7, 0x81, 0xF4, 0xF3, 0x42, 0x2A, 0x58, 0xAF, 0x42,
+    0x17, 0x69, 0xEF, 0x64, 0xEF, 0xA4, 0x54, 0x59, 0x4F, 0xE6, 0x51, 0x6A, 0x92, 0xF5, 0xF6, 0x78,
+    0x69, 0xA2, 0xED, 0x87, 0x6B, 0xB1, 0x0B, 0x8E, 0x58, 0x05, 0x33, 0x73, 0x5B, 0x3A, 0xE6, 0x34,
+    0x64, 0x7E, 0xC4, 0xD7, 0xD2, 0x1A, 0xB2, 0x89, 0x28, 0x05, 0xA9, 0x5C, 0xDF, 0x1B, 0xF7, 0x8F,
+    0x52, 0xBD, 0xDD, 0xB7, 0xD8, 0xD1, 0x7D, 0x1C, 0x01, 0x7D, 0xCE, 0x0D, 0xF3, 0x6C, 0x4A, 0xA6,
+    0x43, 0x30, 0x20, 0x04, 0x58, 0xBF, 0xA6, 0x3B, 0xF4, 0x88, 0x37, 0xEE, 0x8F, 0xA5, 0x46, 0x30,
+    0xC4, 0xF4, 0xA8, 0xBA, 0x59, 0xDA, 0x88, 0xFD, 0xE3, 0x20, 0x17, 0x5D, 0xB0, 0x3D, 0xC2, 0xB6,
+    0x40, 0x51, 0xB3, 0xA3, 0x52, 0xE7, 0x0E, 0x19, 0xA0, 0x36, 0xE4, 0x90, 0x90, 0x05, 0x98, 0x18,
+    0x92, 0x7B, 0x19, 0x6B, 0x6E, 0x8A, 0xE9, 0x69, 0x3D, 0xFE, 0x35, 0xE4, 0x22, 0x90, 0x7C, 0x04,
+    0x48, 0x10, 0x42, 0x6B, 0x65, 0x44, 0x5D, 0x90, 0x7F, 0x21, 0x9D, 0xDE, 0xEA, 0xF7, 0x4F, 0x7B,
+    0x72, 0x99, 0x1A, 0x0E, 0x6B, 0x29, 0xC4, 0x60, 0x9F, 0x33, 0x69, 0x11, 0xE8, 0x22, 0x37, 0xA9,
+    0x5D, 0x04, 0xDC, 0xFA, 0xA1, 0x77, 0xDF, 0x24, 0x62, 0x9E, 0x2A, 0x5E, 0xD6, 0xDC, 0xEA, 0xBB,
+    0x50, 0x47, 0x2A, 0xCF, 0x6D, 0x84, 0x72, 0x00, 0xAD, 0x93, 0x0A, 0xD4, 0x24, 0xC5, 0xB1, 0x59,
+    0x14, 0x97, 0x36, 0xEA, 0x4B, 0x6E, 0x83, 0xF1, 0xC3, 0x27, 0x90, 0x64, 0x38, 0xC0, 0x9F, 0x53,
+    0xB3, 0xF9, 0x89, 0xF5, 0xA4, 0x38, 0x19, 0xDF, 0xF0, 0x2C, 0x01, 0xB7, 0x50, 0xE2, 0xA0, 0x5E,
+    0xC4, 0x17, 0x0C, 0x24, 0xC0, 0x1C, 0x86, 0x0B, 0x78, 0xC8, 0x3E, 0x0D, 0x70, 0x51, 0xB3, 0x20,
+    0xBA, 0x92, 0xC7, 0x6B, 0xF0, 0x5D, 0xC8, 0xCC, 0x53, 0x87, 0x9C, 0xDB, 0x05, 0x11, 0xF1, 0x6B,
+    0x38, 0xB5, 0x9C, 0xAA, 0x4F, 0x17, 0x42, 0x36, 0x3A, 0x7C, 0xC1, 0xD3, 0x00, 0x3E, 0xF3, 0x8A,
+    0x7E, 0xAF, 0x72, 0xBD, 0x64, 0x14, 0x20, 0x3F, 0x2F, 0x6D, 0x18, 0x8E, 0x91, 0x2D, 0x57, 0x59,
+    0xFD, 0x06, 0x7B, 0x00, 0x14, 0x1E, 0x61, 0x28, 0x6D, 0x7E, 0x06, 0xCD, 0xE2, 0x95, 0xC5, 0x9E,
+    0x81, 0x48, 0x3B, 0xB2, 0x9B, 0x51, 0x35, 0x7B, 0x47, 0xBA, 0x6C, 0xF4, 0xA0, 0xEA, 0xF4, 0x3E,
+    0xCC, 0x96, 0xE1, 0x5D, 0x70, 0xD1, 0xA4, 0x2A, 0x37, 0x4B, 0x25, 0xF5, 0xF3, 0x83, 0x80, 0x06,
+    0x08, 0x64, 0x71, 0xBA, 0x83, 0xB9, 0x2A, 0x7A, 0x02, 0x96, 0x17, 0x2F, 0xDA, 0x69, 0x35, 0xB2,
+    0xE4, 0x45, 0x0F, 0xE1, 0x73, 0x94, 0xBC, 0x4A, 0x51, 0xB9, 0x11, 0x49, 0xC3, 0x4D, 0x47, 0x59,
+    0x85, 0x82, 0x02, 0x3F, 0xCA, 0x96, 0x0B, 0xD2, 0x69, 0xCA, 0x57, 0xC2, 0x86, 0xF5, 0x3B, 0x5D,
+    0x79, 0x00, 0x1E, 0x7C, 0xC7, 0x2B, 0x00, 0xBD, 0xBB, 0x47, 0xEA, 0xC9, 0xDC, 0xFE, 0x1A, 0xE9,
+    0xE6, 0x87, 0x6F, 0x58, 0x08, 0x60, 0xBA, 0x8B, 0xE8, 0x2C, 0xF5, 0x43, 0xEE, 0x22, 0x14, 0xB7,
+    0x1C, 0xD5, 0xE5, 0x75, 0x11, 0x86, 0xE9, 0x8A, 0xB9, 0xFC, 0x0E, 0x11, 0xC8, 0x6C, 0xF2, 0x77,
+    0x24, 0xEC, 0x82, 0x7C, 0xB4, 0x9D, 0x6F, 0xF3, 0x8D, 0xD5, 0xBB, 0x2F, 0xB9, 0xB7, 0x0E, 0xE4,
+    0xF1, 0xE4, 0xCE, 0x8A, 0x8A, 0x6A, 0x06, 0x33, 0x7A, 0xD6, 0x67, 0x19, 0x8C, 0x78, 0x7B, 0x2E,
+    0x74, 0x8C, 0xDB, 0x9E, 0x91, 0xFD, 0x33, 0x6D, 0x92, 0x23, 0x97, 0xA8, 0x83, 0x59, 0x86, 0x4D,
+    0x6E, 0xA2, 0x82, 0x78, 0xC7, 0xA0, 0x83, 0xE6, 0xF5, 0xC1, 0xED, 0x1F, 0xC1, 0xC6, 0x54, 0x23,
+    0xFA, 0x8E, 0x78, 0x0F, 0x7B, 0x87, 0x50, 0xC1, 0x69, 0xAE, 0x90, 0xCE, 0x54, 0xE7, 0xB5, 0xC2,
+    0xBA, 0xDC, 0x1E, 0x15, 0x34, 0x1D, 0xB6, 0x04, 0xBF, 0xB7, 0xA0, 0x60, 0xC8, 0xAF, 0x96, 0xB7,
+    0xF5, 0x4C, 0x66, 0x12, 0x08, 0xCB, 0xDE, 0x7E, 0xDD, 0x83, 0x44, 0xEB, 0xAF, 0xD8, 0x57, 0x41,
+    0x73, 0x68, 0xA5, 0xF7, 0x01, 0x79, 0x02, 0xC9, 0xB1, 0x5B, 0x4F, 0xEF, 0x63, 0xA5, 0x5E, 0x50,
+    0x59, 0x5F, 0xE3, 0xD5, 0x80, 0x1A, 0x43, 0xAF, 0xC2, 0xA5, 0x9B, 0x51, 0xA7, 0x7B, 0xAD, 0x9D,
+    0xC1, 0x23, 0xD0, 0x72, 0x0B, 0x97, 0x57, 0x47, 0x35, 0xB7, 0xB1, 0x42, 0x32, 0x00, 0x95, 0x4B,
+    0x34, 0xF2, 0x9F, 0x2E, 0x9B, 0xC7, 0xE3, 0x61, 0x6A, 0x9F, 0xF9, 0x0F, 0x6E, 0xAE, 0x6B, 0xB1,
+    0x69, 0xE8, 0xE1, 0x6F, 0x27, 0xEC, 0x21, 0xFB, 0x09, 0x4B, 0xAC, 0xC7, 0x53, 0x3B, 0x42, 0x54,
+    0xF7, 0x06, 0x7E, 0xB5, 0x2E, 0x78, 0xBF, 0xB5, 0xDE, 0x5F, 0x1D, 0x85, 0x2C, 0xE9, 0x8D, 0xBC,
+    0x56, 0x0F, 0xCA, 0x36, 0xF7, 0x32, 0x34, 0xFE, 0x7A, 0xCF, 0xEB, 0xEC, 0x31, 0x68, 0x2E, 0xF8,
+    0x08, 0x06, 0x16, 0x87, 0xEC, 0xC3, 0x6B, 0x04, 0xFE, 0x64, 0xCE, 0xC1, 0x6E, 0x98, 0x4C, 0xD2,
+    0x2E, 0x83, 0x44, 0x80, 0x3B, 0xF9, 0x04, 0x8D, 0x87, 0x99, 0xA1, 0xBD, 0xBB, 0x48, 0xD2, 0x79,
+    0x1A, 0x3E, 0x2B, 0x62, 0x46, 0xF4, 0xD8, 0x13, 0x26, 0xFE, 0x36, 0xB9, 0x09, 0x0B, 0xC0, 0xBD,
+    0xDE, 0xFA, 0x07, 0x9D, 0xB0, 0x7B, 0x07, 0xF2, 0x89, 0x54, 0x43, 0x5F, 0x64, 0xD4, 0x22, 0x68,
+    0x87, 0x9D, 0xE8, 0x38, 0xE6, 0xBB, 0x24, 0x13, 0xC3, 0x0F, 0x32, 0x36, 0xD0, 0xB4, 0x3D, 0xAF,
+    0x98, 0xE7, 0x8B, 0x20, 0x16, 0xE2, 0xCF, 0xE2, 0xD0, 0x1B, 0x79, 0x53, 0x73, 0xDC, 0x96, 0xFC,
+    0x1F, 0xF8, 0x69, 0x3D, 0x20, 0xF5, 0x3A, 0xED, 0xD1, 0x1E, 0x55, 0xDC, 0x66, 0x5A, 0xDF, 0x43,
+    0xCB, 0x4A, 0xC7, 0x4E, 0x6D, 0x70, 0x63, 0xF7, 0x0B, 0xBC, 0xFE, 0x2A, 0x89, 0xDF, 0x51, 0x0E,
+    0x9C, 0xF1, 0x2C, 0x90, 0x79, 0x0C, 0x05, 0x8E, 0x21, 0xC5, 0x51, 0x46, 0x39, 0x0C, 0x34, 0xD7,
+    0xBF, 0x76, 0xA2, 0x7C, 0x4D, 0x0E, 0x81, 0x16, 0xB6, 0x53, 0xF4, 0xEF, 0x3F, 0x04, 0xB9, 0x93,
+    0xDA, 0x53, 0xAA, 0xF9, 0x60, 0x33, 0x94, 0x2A, 0x7A, 0x87, 0x9A, 0x60, 0x31, 0xDF, 0xE0, 0x69,
+    0x8D, 0x2F, 0x4E, 0xF5, 0x70, 0x33, 0x95, 0xF7, 0xC7, 0xDD, 0x3B, 0x6D, 0x94, 0xE6, 0x87, 0x89,
+    0x2D, 0x02, 0x2B, 0x8C, 0x09, 0x54, 0x85, 0x96, 0x00, 0x93, 0xE6, 0x29, 0x44, 0xFD, 0x1D, 0x71,
+    0x0B, 0x74, 0xB2, 0x92, 0x4A, 0x91, 0x89, 0x2A, 0x6C, 0x8D, 0x9B, 0x09, 0x8B, 0x45, 0x64, 0x30,
+    0x2D, 0x85, 0x46, 0x17, 0x37, 0xD5, 0xFF, 0x83, 0x1C, 0x77, 0xB0, 0x73, 0xF3, 0xB9, 0x42, 0x8E,
+    0x6D, 0xA0, 0xFF, 0xE3, 0xF8, 0x03, 0xAD, 0x55, 0x3D, 0x73, 0xD5, 0x46, 0x14, 0xBD, 0x7A, 0x02,
+    0x34, 0x89, 0x8A, 0x6D, 0x33, 0xA4, 0x50, 0x1D, 0x17, 0xD9, 0x7F, 0xC0, 0xCA, 0xE3, 0xC2, 0x45,
+    0x0A, 0x53, 0xC4, 0x93, 0xF2, 0xF5, 0x6E, 0xDC, 0x52, 0x65, 0x05, 0x29, 0x52, 0xA4, 0x20, 0x45,
+    0xBA, 0x14, 0x50, 0x50, 0x04, 0x37, 0xE4, 0x07, 0x04, 0x56, 0xE6, 0x15, 0x2E, 0x5C, 0x44, 0xC6,
+    0x43, 0x28, 0x91, 0x43, 0x08, 0x33, 0x50, 0xB0, 0xF0, 0x64, 0x10, 0xBC, 0xDD, 0xBD, 0x39, 0x57,
+    0x0E, 0x33, 0x69, 0x93, 0x89, 0x66, 0xB4, 0x7E, 0xD6, 0xC7, 0xBD, 0xE7, 0x9E, 0x73, 0xF6, 0xC8,
+    0xD6, 0xBA, 0x2D, 0x5F, 0x45, 0x62, 0x32, 0xDF, 0x0D, 0xF9, 0x98, 0x45, 0xDD, 0xAA, 0xBE, 0xF4,
+    0x4C, 0xB6, 0x36, 0x8B, 0x30, 0x8B, 0x94, 0x94, 0x57, 0x43, 0x39, 0x98, 0xD6, 0x75, 0xA6, 0xE5,
+    0x9C, 0xD7, 0x63, 0x1E, 0x74, 0x54, 0x1E, 0xCF, 0x0C, 0xB6, 0xD1, 0x87, 0x2F, 0x8F, 0x03, 0x59,
+    0x6B, 0x6E, 0xF4, 0x19, 0x8F, 0xCC, 0x94, 0xF3, 0x7D, 0x1E, 0x48, 0xA5, 0x92, 0x1B, 0xD2, 0x43,
+    0x15, 0x88, 0x6C, 0x6B, 0x5A, 0xA2, 0xB5, 0x7A, 0x87, 0x76, 0x54, 0xA7, 0x5B, 0xB3, 0x18, 0x4A,
+    0xAF, 0x4E, 0x50, 0xA5, 0xF4, 0x96, 0x38, 0x0F, 0x55, 0x6B, 0xF7, 0x63, 0x3E, 0x18, 0xEF, 0x28,
+    0xEA, 0x60, 0x6A, 0x33, 0x67, 0x60, 0x78, 0xF9, 0xF8, 0x71, 0x3B, 0xE3, 0x27, 0xDC, 0x93, 0xF5,
+    0xEC, 0x49, 0x0D, 0xDA, 0x53, 0x1E, 0x8A, 0x81, 0x88, 0x1C, 0x91, 0xF2, 0x74, 0x91, 0x6F, 0xE7,
+    0xCC, 0xDE, 0x72, 0xCA, 0xEC, 0xC3, 0x3A, 0x1F, 0x89, 0x0C, 0x37, 0x05, 0x10, 0x38, 0x0E, 0xCA,
+    0xDB, 0x36, 0x65, 0xB1, 0xEA, 0xAA, 0xA3, 0x30, 0x0B, 0x7A, 0xDF, 0x2D, 0x98, 0x07, 0xC3, 0xB1,
+    0xE0, 0x77, 0x94, 0xDD, 0xBC, 0x47, 0x94, 0x2F, 0xB9, 0xA5, 0x7C, 0x85, 0xEA, 0x45, 0xAA, 0x3C,
+    0x95, 0x78, 0x03, 0x35, 0xD5, 0xD3, 0x1A, 0x0B, 0x8F, 0xAA, 0xAF, 0x38, 0x55, 0x9D, 0x3E, 0x02,
+    0x10, 0xDD, 0xB2, 0xC1, 0x00, 0x6C, 0x1A, 0xFD, 0x67, 0x34, 0x35, 0xEE, 0x5A, 0x2A, 0xB8, 0xA3,
+    0x7F, 0x1C, 0x0E, 0x17, 0x7A, 0x10, 0x68, 0x39, 0x50, 0xCA, 0x98, 0x41, 0x62, 0x91, 0xD6, 0x7F,
+    0xCE, 0x82, 0x02, 0xA8, 0x59, 0xA8, 0x7A, 0xF4, 0x0B, 0xC2, 0x01, 0xF0, 0xE2, 0x91, 0x62, 0x5A,
+    0xCB, 0x69, 0x55, 0xA7, 0x6E, 0xFB, 0x32, 0xA9, 0x1E, 0x23, 0xC9, 0x5A, 0x13, 0x55, 0x9D, 0x6D,
+    0x88, 0x40, 0x53, 0x7F, 0x81, 0x4C, 0xAB, 0x31, 0x8F, 0x69, 0x94, 0xAC, 0x75, 0x06, 0xF0, 0x67,
+    0x47, 0xF6, 0x13, 0xED, 0xF6, 0x82, 0xD4, 0x9B, 0x86, 0x21, 0x88, 0x1A, 0x3F, 0x01, 0x97, 0xE0,
+    0xFB, 0x51, 0xFA, 0x92, 0x50, 0x77, 0x90, 0x46, 0x6D, 0xF5, 0x34, 0x6D, 0x93, 0x03, 0x31, 0x39,
+    0xA6, 0x3B, 0xA7, 0x7A, 0xB3, 0xF2, 0xA6, 0xB6, 0xBC, 0x1F, 0xC9, 0xC6, 0x0F, 0xD0, 0x15, 0xF4,
+    0xC9, 0x40, 0x05, 0x19, 0xFC, 0x28, 0x65, 0xAC, 0x78, 0x17, 0xDD, 0x0F, 0x7B, 0xCA, 0x31, 0x27,
+    0xB9, 0x3B, 0x9E, 0xAA, 0x49, 0x54, 0x48, 0x60, 0x9D, 0xAB, 0xD5, 0x72, 0x39, 0x64, 0xD1, 0x9A,
+    0xC6, 0x1C, 0xFE, 0x3E, 0x96, 0x43, 0xD2, 0x6D, 0x52, 0x47, 0x20, 0x38, 0x54, 0x8B, 0x11, 0x2B,
+    0xD1, 0x0E, 0xC0, 0x0B, 0xB5, 0x28, 0x55, 0xAC, 0x3A, 0x52, 0x8F, 0x7A, 0xD2, 0x07, 0x9E, 0xCC,
+    0x0B, 0x0F, 0x5D, 0x7C, 0x26, 0xD8, 0xDE, 0xAF, 0x86, 0x62, 0xF9, 0x66, 0x54, 0x4F, 0x5E, 0x07,
+    0x7D, 0xF0, 0x2A, 0x98, 0x4D, 0x1F, 0x84, 0xC2, 0x28, 0xA2, 0xE2, 0xB5, 0x44, 0x3A, 0x81, 0x85,
+    0x7C, 0xD5, 0x67, 0xB8, 0x6E, 0x41, 0x85, 0x3A, 0xF6, 0xF9, 0x08, 0x06, 0x21, 0x30, 0xBF, 0x18,
+    0x84, 0x3E, 0xAE, 0x1D, 0x96, 0x51, 0x9D, 0x5A, 0x7E, 0xD9, 0xA4, 0x72, 0xF9, 0x26, 0xA8, 0x2E,
+    0x99, 0xF9, 0xFE, 0x54, 0x50, 0x2F, 0x46, 0xA7, 0x16, 0x81, 0xCB, 0x3E, 0xC2, 0x95, 0x51, 0x1D,
+    0xBF, 0x95, 0xBB, 0xD9, 0x2D, 0x5A, 0xFB, 0x3E, 0x1F, 0x88, 0xFB, 0x1C, 0x30, 0xFA, 0xC2, 0xE7,
+    0x2B, 0x58, 0xB8, 0x5C, 0x7A, 0x75, 0x3A, 0x7F, 0x06, 0x2A, 0x81, 0x4C, 0x96, 0xB1, 0x7A, 0x98,
+    0x78, 0xD4, 0x57, 0x63, 0x0C, 0xE6, 0x9B, 0x77, 0x58, 0xBE, 0x78, 0x3D, 0x06, 0xA3, 0x8E, 0x07,
+    0x0C, 0xBD, 0xF0, 0x69, 0x92, 0xAD, 0x11, 0x7A, 0x3B, 0xCC, 0x03, 0x52, 0xAA, 0xA7, 0x73, 0xF8,
+    0x72, 0x04, 0x74, 0xB2, 0x25, 0x16, 0xF5, 0x0C, 0x0E, 0x9D, 0x61, 0x07, 0xC8, 0x93, 0x35, 0xA1,
+    0xE4, 0x40, 0xC5, 0xFB, 0x98, 0xF0, 0x8C, 0xD3, 0x6D, 0x16, 0x0C, 0xC8, 0x48, 0xEA, 0x04, 0x5B,
+    0x66, 0x73, 0xB0, 0x64, 0xEE, 0x07, 0x78, 0xB4, 0xE3, 0x62, 0x50, 0xDE, 0xB4, 0x50, 0x65, 0x6D,
+    0x6F, 0xAF, 0x01, 0xE1, 0x3D, 0x3A, 0xF4, 0xF4, 0x35, 0x0A, 0x2A, 0x3C, 0x9F, 0xAD, 0x70, 0xC2,
+    0x2C, 0x33, 0x88, 0x9A, 0x49, 0xD3, 0x70, 0xEF, 0x2E, 0xDD, 0x33, 0xF3, 0xC6, 0xA8, 0x83, 0x5E,
+    0x26, 0x56, 0x0F, 0x46, 0x03, 0xB1, 0x84, 0x99, 0x56, 0x79, 0x27, 0xC6, 0x4A, 0xF2, 0x4F, 0x5D,
+    0x75, 0xE6, 0xA1, 0xED, 0xB2, 0x90, 0x85, 0x72, 0x10, 0x22, 0x4F, 0x80, 0x03, 0xAD, 0x4D, 0x23,
+    0x54, 0x8A, 0xF9, 0x85, 0xCB, 0x46, 0x26, 0xE1, 0x04, 0x2F, 0xDA, 0xC7, 0x90, 0x29, 0x21, 0x0D,
+    0xE0, 0xF3, 0x3E, 0xE9, 0x05, 0xA4, 0xD6, 0x0B, 0xEC, 0x48, 0x30, 0x6A, 0x16, 0x50, 0xC0, 0x6D,
+    0x8C, 0x50, 0xFE, 0xBA, 0xB7, 0x1B, 0x63, 0x7E, 0x1A, 0x4B, 0x40, 0xCE, 0x6E, 0x09, 0x62, 0xB3,
+    0x81, 0x96, 0xB9, 0x47, 0x4D, 0xB2, 0x84, 0xFD, 0x0C, 0x5E, 0x8F, 0xA1, 0xE5, 0xB6, 0x0B, 0x42,
+    0x00, 0xA8, 0x92, 0x36, 0x54, 0xFD, 0x96, 0x78, 0x98, 0x8D, 0x66, 0x7E, 0xA3, 0x31, 0xDF, 0x82,
+    0xD5, 0x7C, 0x88, 0x66, 0xAB, 0x35, 0xD5, 0xC2, 0x87, 0x62, 0x39, 0x5A, 0xD5, 0x52, 0x46, 0x9F,
+    0x51, 0x7E, 0x94, 0x68, 0xB6, 0x02, 0x7F, 0xC0, 0x55, 0x4E, 0x2C, 0x8F, 0x78, 0x3D, 0xD2, 0x95,
+    0x59, 0x82, 0x55, 0xE5, 0x04, 0x4D, 0x45, 0x80, 0x2D, 0x3D, 0x8C, 0x52, 0xCB, 0xA6, 0x27, 0xDA,
+    0x05, 0xF3, 0xC2, 0xBE, 0xC4, 0x83, 0xC2, 0x69, 0x7D, 0x76, 0x87, 0x3B, 0x10, 0x09, 0xBF, 0x43,
+    0xF2, 0x1F, 0x50, 0x0D, 0x66, 0xE7, 0xBD, 0x9B, 0x53, 0x39, 0x8D, 0x93, 0x2E, 0x9F, 0x23, 0xFA,
+    0x88, 0x7E, 0xA1, 0xCF, 0x21, 0xDD, 0xA5, 0x40, 0x17, 0xA6, 0x56, 0xC8, 0x30, 0xEE, 0x66, 0xB5,
+    0xAD, 0xA5, 0xCB, 0xF9, 0xDD, 0x9E, 0x4C, 0x04, 0xF3, 0x28, 0xF8, 0xA9, 0x14, 0xC6, 0x3E, 0x76,
+    0x4D, 0x76, 0x27, 0xC8, 0x43, 0x95, 0xC0, 0xBA, 0x4C, 0xB9, 0x48, 0xFE, 0xFC, 0x36, 0x4A, 0x06,
+    0x9C, 0x9E, 0xCE, 0xD7, 0x35, 0x95, 0xBD, 0x6E, 0x2C, 0x2C, 0xD1, 0xEB, 0x16, 0xB1, 0xA6, 0x7A,
+    0x9B, 0xE1, 0x8F, 0x6E, 0x1D, 0xF2, 0x00, 0x97, 0x9C, 0xDC, 0x31, 0xD3, 0x9D, 0xCE, 0xAC, 0x23,
+    0x03, 0x21, 0x58, 0x39, 0x9E, 0x25, 0x83, 0x95, 0x41, 0xA1, 0x09, 0xE0, 0x5D, 0x88, 0xF5, 0x59,
+    0xD2, 0x61, 0x6B, 0x36, 0xB2, 0x51, 0x25, 0x71, 0xA6, 0xF4, 0x43, 0x44, 0xB4, 0x7F, 0xDF, 0x82,
+    0x96, 0x67, 0xB0, 0x90, 0x0E, 0xB4, 0x76, 0x35, 0x5C, 0xC4, 0x5E, 0xF0, 0xAE, 0x18, 0xCC, 0x35,
+    0x88, 0x10, 0xA7, 0x9F, 0xD0, 0x0F, 0x09, 0x86, 0x68, 0xC1, 0x7E, 0xDE, 0x18, 0xAB, 0x07, 0xD8,
+    0x0A, 0x0E, 0x59, 0x81, 0x08, 0x7F, 0x80, 0x48, 0x9A, 0x1A, 0x3A, 0x51, 0xC8, 0x4E, 0x96, 0x95,
+    0xFA, 0x5A, 0xAA, 0x27, 0xA9, 0x3E, 0x4A, 0x2F, 0xE9, 0x6B, 0x3F, 0xC4, 0x45, 0xC6, 0x7F, 0x08,
+    0x3E, 0x89, 0xD9, 0x21, 0x4F, 0x33, 0xCE, 0x23, 0xE9, 0xFD, 0x04, 0x5C, 0x40, 0x13, 0xCD, 0xF3,
+    0x3D, 0xDE, 0xC2, 0x1C, 0x8F, 0x70, 0xBE, 0x89, 0xDB, 0x5F, 0x05, 0x5C, 0x64, 0xBC, 0xEF, 0x36,
+    0x47, 0x24, 0x19, 0xA4, 0x10, 0x41, 0xFA, 0x99, 0xF8, 0xAE, 0x12, 0xD1, 0xE4, 0x00, 0xC5, 0x70,
+    0x06, 0x3C, 0xED, 0xAE, 0x01, 0x8E, 0x99, 0x77, 0xEA, 0x05, 0xF3, 0x5B, 0xA0, 0xE2, 0x6D, 0x89,
+    0xDD, 0x43, 0x8F, 0x0C, 0x76, 0x1E, 0xCC, 0xCE, 0x58, 0xC6, 0x24, 0x44, 0xB7, 0x73, 0x48, 0x17,
+    0x07, 0x63, 0x21, 0x1A, 0x7A, 0x6C, 0xA1, 0xD6, 0x92, 0xAB, 0x8D, 0x7C, 0xBF, 0xD6, 0x23, 0x99,
+    0x0D, 0xF4, 0xDA, 0x44, 0xDE, 0x6C, 0x41, 0xBB, 0x1B, 0x2D, 0x69, 0x87, 0x54, 0x04, 0x0E, 0x44,
+    0x0A, 0xC9, 0xB7, 0xA8, 0x1A, 0xA7, 0x6F, 0x07, 0xED, 0xD0, 0xC7, 0x3F, 0xFA, 0x3C, 0xE1, 0xD5,
+    0x67, 0xBE, 0x1A, 0x4C, 0x0E, 0x33, 0xE2, 0x7B, 0xB7, 0xE5, 0x61, 0x6B, 0x32, 0xBB, 0xAD, 0x18,
+    0x50, 0xF3, 0x94, 0x8C, 0xF2, 0x06, 0x9F, 0x81, 0xD5, 0xBF, 0xF6, 0x84, 0x2C, 0xA2, 0xFC, 0x04,
+    0x3C, 0xF9, 0x2B, 0xF4, 0x7F, 0x02, 0x12, 0x75, 0x5F, 0xC3, 0x43, 0xD7, 0x5B, 0x0A, 0x97, 0x68,
+    0xB6, 0x3F, 0x5D, 0xFA, 0x4F, 0x28, 0xFF, 0xE5, 0xF1, 0x17, 0x7D, 0x55, 0x31, 0x8C, 0xDD, 0x44,
+    0x10, 0x1D, 0x7B, 0x73, 0xF1, 0x05, 0x43, 0xF6, 0x8A, 0x48, 0x88, 0x43, 0xC2, 0x29, 0x52, 0x20,
+    0x41, 0xCE, 0x0D, 0xE5, 0x49, 0xEB, 0x24, 0x45, 0x0A, 0x0A, 0x90, 0x92, 0xF4, 0x29, 0x68, 0x90,
+    0x40, 0xB9, 0x22, 0x45, 0x84, 0x22, 0xAD, 0x01, 0x89, 0x94, 0x5C, 0x47, 0x7B, 0x45, 0x0A, 0x48,
+    0x95, 0x82, 0x0A, 0x89, 0xAC, 0xD1, 0x09, 0x51, 0xA4, 0xC0, 0x27, 0x84, 0x52, 0xA4, 0x38, 0x43,
+    0xD2, 0x5D, 0x91, 0x45, 0xB2, 0x72, 0x8E, 0x6E, 0xED, 0xE1, 0xCD, 0xFA, 0xFF, 0x04, 0x9A, 0xB3,
+    0xEC, 0x9D, 0xFF, 0xD7, 0xDE, 0x99, 0x37, 0x33, 0x6F, 0x66, 0x88, 0x16, 0x57, 0xC6, 0xDB, 0x51,
+    0x5A, 0x1E, 0x44, 0x24, 0xCC, 0xA3, 0x48, 0x35, 0xA5, 0x2C, 0x52, 0x0F, 0xC4, 0x27, 0x77, 0x92,
+    0xEF, 0x0B, 0x4F, 0xEE, 0xB2, 0x57, 0xA1, 0x6C, 0xC9, 0x5E, 0xEA, 0xF3, 0xDE, 0x34, 0x22, 0xB5,
+    0x37, 0x35, 0xE4, 0x50, 0xB4, 0xB6, 0x22, 0x77, 0x71, 0x30, 0x8D, 0xAB, 0x88, 0xD3, 0x60, 0x2B,
+    0x57, 0x25, 0x9C, 0x84, 0x89, 0x6C, 0x95, 0x8E, 0xC9, 0x18, 0xC8, 0x36, 0x59, 0xA0, 0x69, 0x20,
+    0xD3, 0x95, 0x3D, 0xB1, 0xA7, 0x82, 0xB9, 0x23, 0xDC, 0x39, 0x73, 0x4D, 0xAE, 0x81, 0x5D, 0x98,
+    0x77, 0xF5, 0x8C, 0x89, 0x67, 0x91, 0x8C, 0x0B, 0x88, 0x61, 0xFE, 0x8B, 0x63, 0xB3, 0x6C, 0x67,
+    0x39, 0xC9, 0x7A, 0xA3, 0x4B, 0xEF, 0xD2, 0x0F, 0x8A, 0x83, 0x1A, 0xD2, 0x51, 0x33, 0xAB, 0x01,
+    0x20, 0x3D, 0x30, 0xE4, 0xDE, 0x34, 0xF6, 0x62, 0xD0, 0x9D, 0xAD, 0xCC, 0x97, 0xA1, 0x6C, 0x1C,
+    0x99, 0x2A, 0x98, 0x9A, 0x01, 0x29, 0x38, 0x98, 0x70, 0x34, 0x4E, 0x10, 0x4C, 0x53, 0x20, 0x97,
+    0x8E, 0xE4, 0x06, 0xC4, 0x00, 0x40, 0x3D, 0x95, 0x30, 0x64, 0x5B, 0x40, 0xAB, 0x09, 0x6E, 0xC6,
+    0xE0, 0x54, 0xFF, 0xC1, 0xA5, 0x66, 0x58, 0x73, 0xBC, 0xC4, 0x07, 0xB9, 0xA6, 0xF8, 0xC5, 0x09,
+    0x79, 0xDD, 0x49, 0x50, 0x5B, 0x3C, 0xDC, 0x20, 0x9A, 0xB0, 0x77, 0xF0, 0xAC, 0x47, 0x18, 0xED,
+    0x2F, 0x13, 0xA9, 0x00, 0x85, 0xE5, 0x6E, 0x20, 0x84, 0xA8, 0xA6, 0xF2, 0xB7, 0x1E, 0x3B, 0xD0,
+    0x6D, 0xF0, 0x23, 0x1B, 0xB0, 0xC3, 0x2A, 0x50, 0xD9, 0x99, 0xC3, 0xFD, 0x40, 0x38, 0x59, 0x41,
+    0x85, 0xC0, 0x80, 0xBB, 0x5A, 0x70, 0x5C, 0xC7, 0x93, 0xD6, 0x94, 0x72, 0x95, 0x42, 0x2D, 0x73,
+    0x28, 0x99, 0xFF, 0x08, 0x6B, 0x93, 0xAD, 0xF4, 0x81, 0xA7, 0x89, 0x49, 0x3F, 0xF3, 0xC9, 0xC8,
+    0x64, 0x1E, 0x3E, 0x7F, 0x3C, 0x18, 0x66, 0x58, 0x6F, 0x32, 0xE0, 0xCB, 0xA0, 0x60, 0x2D, 0xA2,
+    0xFC, 0x34, 0xE2, 0xE7, 0xA7, 0x12, 0xD4, 0x0B, 0x3F, 0x4B, 0x0C, 0x37, 0xE2, 0x7E, 0x11, 0xD7,
+    0xD3, 0x71, 0xFD, 0x60, 0xC9, 0x0C, 0x2A, 0xC6, 0x44, 0x92, 0xC3, 0x8A, 0xBD, 0xE2, 0x49, 0xF1,
+    0x90, 0x8F, 0xAB, 0xC9, 0xE5, 0xA0, 0x91, 0x86, 0x74, 0x2C, 0x3A, 0xC9, 0x80, 0xC4, 0xE7, 0xE5,
+    0x5A, 0x4B, 0xCA, 0x6C, 0x95, 0x77, 0x29, 0x56, 0xDD, 0x89, 0x6B, 0x45, 0x8B, 0xB5, 0x2E, 0x1B,
+    0x21, 0x8C, 0x69, 0x0A, 0x6F, 0x3A, 0xD7, 0xBA, 0x16, 0xC9, 0x47, 0xDA, 0x73, 0x3E, 0xE2, 0x49,
+    0xB2, 0x19, 0xF1, 0xCC, 0x57, 0x29, 0xA9, 0xFD, 0x69, 0x82, 0xA6, 0xBF, 0xDE, 0xC6, 0x92, 0x89,
+    0xDB, 0x69, 0x33, 0xFB, 0x4D, 0x74, 0x6A, 0xF9, 0x99, 0xDD, 0xBE, 0x51, 0x2B, 0xEE, 0xB8, 0xD7,
+    0x38, 0x1D, 0xCA, 0xAE, 0xBA, 0x32, 0x02, 0x43, 0x32, 0x49, 0x9E, 0x26, 0x47, 0x57, 0x09, 0x51,
+    0x98, 0x12, 0xE4, 0x77, 0x4C, 0x03, 0x68, 0xA8, 0x02, 0xAB, 0x31, 0xEF, 0x1D, 0xAC, 0x7A, 0xC3,
+    0x8E, 0x1B, 0x3D, 0xE6, 0xD3, 0x52, 0xD7, 0xBD, 0x7B, 0x3B, 0x12, 0x13, 0x78, 0x4A, 0xA7, 0x3F,
+    0xBF, 0x8D, 0x8D, 0xB5, 0xB5, 0xEA, 0x25, 0xFF, 0x9C, 0x24, 0x09, 0x49, 0x99, 0xCA, 0x56, 0x77,
+    0x59, 0x0F, 0x0E, 0xD5, 0x48, 0x1F, 0x5E, 0xB0, 0xF6, 0x79, 0xAF, 0x40, 0x78, 0xD3, 0x96, 0x2D,
+    0x23, 0x25, 0x48, 0x9D, 0x1E, 0x33, 0x54, 0x84, 0x83, 0xAB, 0xE5, 0x2E, 0xEF, 0x4D, 0xE4, 0x4A,
+    0xF7, 0x11, 0x12, 0x12, 0x26, 0x5B, 0x67, 0xFC, 0x04, 0xDC, 0xD2, 0x2C, 0xC9, 0x34, 0x43, 0x09,
+    0xE3, 0xAE, 0x05, 0xD3, 0x12, 0x9E, 0x39, 0xB5, 0x72, 0xED, 0x5A, 0xC4, 0x00, 0x4F, 0x9F, 0x1F,
+    0x22, 0x04, 0x67, 0xCE, 0x5E, 0x9F, 0x21, 0xBC, 0xB6, 0xBD, 0x5E, 0xAF, 0x7F, 0xDD, 0xE7, 0x5E,
+    0x7B, 0xB8, 0xA2, 0x06, 0x5B, 0x81, 0xD9, 0x05, 0x42, 0xC9, 0x99, 0x2F, 0xBC, 0xAD, 0x46, 0x0D,
+    0x66, 0x9B, 0x0F, 0x59, 0xB7, 0xFA, 0x11, 0x3F, 0xF4, 0xEA, 0xE8, 0xF0, 0x10, 0x85, 0x3A, 0x80,
+    0x9B, 0x45, 0x30, 0x01, 0x54, 0xCD, 0x51, 0x3B, 0xBC, 0x2C, 0x24, 0x12, 0x36, 0x80, 0xE4, 0x20,
+    0xC6, 0xA0, 0xF8, 0xC2, 0x7D, 0xB0, 0x92, 0x50, 0xD8, 0x31, 0xEA, 0x92, 0x43, 0xC9, 0xA0, 0x84,
+    0xD0, 0x2D, 0x1E, 0xF9, 0x6D, 0x65, 0xBF, 0x3B, 0x81, 0x82, 0x0D, 0xA0, 0xE2, 0x00, 0xC8, 0x3D,
+    0x51, 0x8E, 0x43, 0x7A, 0xF9, 0x80, 0x08, 0x05, 0x14, 0x94, 0xF8, 0xF0, 0xC6, 0xD3, 0x94, 0x83,
+    0xE6, 0xA1, 0xE8, 0xCF, 0x49, 0x83, 0x00, 0x79, 0x62, 0xD1, 0x2C, 0xEE, 0x0A, 0xB6, 0x2B, 0xC3,
+    0x50, 0x83, 0x2C, 0xC9, 0x0D, 0x5C, 0x29, 0x40, 0xE2, 0x96, 0x5A, 0x5A, 0x85, 0xDE, 0xEA, 0x94,
+    0x6A, 0xD4, 0xDF, 0x2D, 0x95, 0x3E, 0x56, 0xBF, 0xED, 0x69, 0x73, 0xE3, 0xE6, 0x79, 0x2A, 0xF6,
+    0x23, 0xA0, 0x7C, 0x20, 0xB5, 0xDF, 0xA6, 0xDD, 0x7D, 0x82, 0xDD, 0x73, 0xF4, 0x8A, 0xA8, 0x06,
+    0x54, 0x1A, 0x6F, 0x09, 0x31, 0xBE, 0x71, 0xA3, 0x3B, 0x3A, 0xD8, 0xDE, 0x78, 0xA7, 0x78, 0xBC,
+    0xE7, 0x41, 0xEB, 0x0D, 0xBD, 0xD7, 0xDF, 0x86, 0xF6, 0x93, 0x4F, 0x61, 0xFC, 0xCA, 0x11, 0x7F,
+    0x5B, 0x09, 0xED, 0xDF, 0x9A, 0xCF, 0xE5, 0x73, 0x63, 0xA1, 0xF6, 0x7E, 0x14, 0x27, 0x92, 0x65,
+    0x0D, 0xAF, 0xC4, 0xC6, 0x87, 0x26, 0x48, 0xC9, 0x1E, 0x5C, 0xFB, 0x71, 0x8B, 0xCE, 0xAC, 0x2C,
+    0xDF, 0x1F, 0x73, 0x15, 0xB1, 0x41, 0xF1, 0xA5, 0xEF, 0x84, 0xAC, 0xE7, 0x3F, 0x3B, 0xBB, 0x2A,
+    0xC4, 0xA5, 0xFA, 0xF8, 0x43, 0x99, 0x14, 0x12, 0x8C, 0x1D, 0x20, 0x7E, 0x5F, 0x78, 0x7A, 0x17,
+    0x24, 0x3F, 0xA5, 0xAA, 0x57, 0xEF, 0xD3, 0x7E, 0xD1, 0x14, 0xE7, 0xAE, 0xF7, 0x7A, 0xF6, 0xFF,
+    0xE3, 0x2B, 0xB3, 0x78, 0x63, 0x16, 0xEF, 0xCF, 0x62, 0x53, 0x96, 0x2D, 0x12, 0x36, 0xD3, 0x2D,
+    0xFA, 0x84, 0xB2, 0x2A, 0x6E, 0xB9, 0x58, 0xE9, 0xA2, 0x50, 0xE3, 0xDF, 0xF1, 0xB8, 0x62, 0x43,
+    0xCB, 0xDA, 0x58, 0x90, 0xD9, 0x94, 0xC4, 0x21, 0xB1, 0x7E, 0xEC, 0x89, 0x14, 0x0F, 0x02, 0x59,
+    0x40, 0x2F, 0x2C, 0x3C, 0xC0, 0xBF, 0xDB, 0x94, 0x74, 0x74, 0x7E, 0x06, 0xB5, 0x39, 0x43, 0xDC,
+    0x9C, 0xBF, 0xBD, 0x39, 0x8B, 0xAD, 0x78, 0x6E, 0x27, 0xDD, 0xA1, 0xCC, 0xE7, 0x1D, 0xE8, 0x6A,
+    0x65, 0x12, 0x80, 0x28, 0xB4, 0x7E, 0x77, 0xA1, 0xF5, 0x81, 0x64, 0x69, 0xA2, 0x72, 0xA0, 0x91,
+    0xEC, 0x90, 0xA0, 0x31, 0xF6, 0x49, 0x48, 0xD9, 0xA7, 0x43, 0x76, 0xE4, 0x55, 0xAF, 0x1F, 0x77,
+    0xAA, 0x37, 0xBF, 0xB7, 0x99, 0x77, 0xBA, 0xC9, 0xFF, 0x19, 0x8B, 0x46, 0x3F, 0x19, 0xCA, 0x46,
+    0xEF, 0x63, 0x32, 0xE9, 0x67, 0x8D, 0xA9, 0x0A, 0x50, 0x8E, 0x50, 0x70, 0xF6, 0x2A, 0xEA, 0xC1,
+    0x8D, 0x06, 0xD3, 0x27, 0x18, 0x8C, 0x1E, 0x89, 0xAA, 0xD0, 0x98, 0xB4, 0x78, 0x28, 0xE4, 0x15,
+    0xBE, 0xBE, 0x9C, 0x3D, 0xE9, 0x4E, 0xB2, 0xA3, 0xDB, 0xA2, 0x29, 0xFF, 0x9C, 0xC8, 0xA0, 0x6A,
+    0xDE, 0x7B, 0x31, 0x37, 0x0B, 0x8C, 0x9A, 0x41, 0xF5, 0x05, 0xDE, 0x58, 0x4C, 0x0D, 0x74, 0x16,
+    0xED, 0x75, 0x67, 0x6A, 0x7B, 0x01, 0xE5, 0x99, 0xA1, 0x4A, 0xCB, 0xC6, 0xD6, 0x4E, 0x86, 0x27,
+    0x4F, 0x77, 0x78, 0x9F, 0x33, 0x31, 0x18, 0xBB, 0x37, 0x08, 0x9F, 0xF9, 0x58, 0x62, 0x42, 0x6C,
+    0x17, 0x6B, 0x47, 0xB3, 0xF4, 0xF9, 0x5A, 0x03, 0x0C, 0x00, 0xA0, 0x0E, 0xC8, 0x4C, 0xD2, 0xF4,
+    0xD1, 0x73, 0xA1, 0xD7, 0x36, 0x8C, 0x89, 0xD6, 0x15, 0x7B, 0xA3, 0x92, 0xF1, 0xB5, 0xCB, 0xDC,
+    0x1B, 0x1E, 0x15, 0xBF, 0x58, 0x14, 0xCD, 0x9B, 0xE3, 0xC7, 0x86, 0xBD, 0x65, 0x0F, 0x37, 0x44,
+    0x59, 0x27, 0x65, 0x08, 0x3D, 0xE6, 0x57, 0x14, 0x99, 0x7C, 0x6A, 0xBF, 0x42, 0x2F, 0x64, 0x47,
+    0x93, 0x7D, 0x14, 0x0C, 0xBA, 0xF7, 0x82, 0x41, 0xF1, 0xFA, 0x17, 0x9D, 0x95, 0xBF, 0x6F, 0x1D,
+    0x45, 0x10, 0xC7, 0xE7, 0x6E, 0xB1, 0xAF, 0xB8, 0x62, 0x1B, 0x10, 0x12, 0xCD, 0x4A, 0x94, 0x34,
+    0x5B, 0x23, 0x01, 0x7B, 0xBD, 0x0B, 0x52, 0x98, 0x34, 0x29, 0xDC, 0xA2, 0x34, 0xFC, 0x03, 0x48,
+    0xBB, 0x0A, 0x7F, 0x40, 0x68, 0xA8, 0x69, 0x52, 0x58, 0x8F, 0xC2, 0x05, 0x0D, 0x55, 0xF6, 0x50,
+    0x0A, 0x17, 0x69, 0x4E, 0x89, 0xA8, 0x7D, 0x10, 0xA5, 0xA2, 0xF0, 0x45, 0x5C, 0xE4, 0x8B, 0xB5,
+    0xB7, 0xC3, 0x77, 0xF6, 0x9E, 0xAD, 0x44, 0xA9, 0xE0, 0x3D, 0xAD, 0xE4, 0xE7, 0x9B, 0xF9, 0xCE,
+    0x67, 0x7E, 0xED, 0x51, 0xCC, 0x1D, 0x31, 0x4F, 0x38, 0x4B, 0x95, 0xEF, 0xA5, 0x2A, 0xD5, 0x6B,
+    0x9D, 0xAA, 0x55, 0xA5, 0x4F, 0x57, 0xB5, 0x70, 0x6A, 0xDE, 0xF0, 0xD2, 0xE2, 0xB9, 0x66, 0x0E,
+    0xFA, 0xFA, 0x2C, 0xE8, 0xB1, 0xED, 0xCC, 0x40, 0x64, 0x7B, 0x22, 0x27, 0x27, 0xE0, 0x74, 0x44,
+    0xF4, 0xAD, 0x0D, 0xEA, 0x8A, 0x7B, 0xD8, 0x75, 0xFE, 0x59, 0xAE, 0x21, 0xA0, 0x27, 0x3D, 0xB9,
+    0xE0, 0xC2, 0x4A, 0xB9, 0x99, 0x8E, 0x66, 0xFB, 0x94, 0x7B, 0xFE, 0x39, 0x2B, 0x11, 0xBB, 0x64,
+    0xF2, 0x36, 0xD5, 0x89, 0x16, 0x3D, 0x55, 0x30, 0xA1, 0x6A, 0x25, 0x6A, 0xA7, 0x4D, 0x16, 0x9F,
+    0x53, 0x22, 0x3C, 0x24, 0xB5, 0xE0, 0xCC, 0x14, 0x0B, 0x5E, 0x39, 0x55, 0xFE, 0xA6, 0x13, 0xDB,
+    0xF2, 0x74, 0x6F, 0xD1, 0xCC, 0x9B, 0xAF, 0xBE, 0x39, 0x23, 0xD1, 0x7B, 0x88, 0x41, 0x64, 0x0F,
+    0xBA, 0xE2, 0x88, 0x1F, 0x6A, 0xAE, 0x76, 0xB1, 0x73, 0x3C, 0x01, 0x87, 0xFC, 0x4F, 0x9D, 0xF8,
+    0xF3, 0xE6, 0x9E, 0x8B, 0x77, 0xB1, 0xEB, 0x8B, 0x3E, 0xD2, 0x93, 0x10, 0x82, 0x01, 0x6B, 0xC9,
+    0x10, 0x1E, 0x77, 0xEA, 0x3D, 0x31, 0x8C, 0x0E, 0xF8, 0x98, 0x20, 0x55, 0xE1, 0xE1, 0x21, 0xEF,
+    0x0A, 0x97, 0x30, 0xF8, 0x2D, 0x9A, 0x68, 0x4A, 0xF8, 0x2C, 0x04, 0xF7, 0x77, 0x41, 0x73, 0x42,
+    0x26, 0xBD, 0x79, 0x79, 0x2C, 0x4F, 0x01, 0x69, 0x45, 0x37, 0x43, 0x61, 0xA0, 0x78, 0x8B, 0xA0,
+    0x07, 0xAA, 0xD2, 0x7B, 0x41, 0xE5, 0x5F, 0xFB, 0xA0, 0x62, 0xD4, 0xF0, 0x02, 0xEF, 0x0C, 0x39,
+    0x94, 0xDB, 0x24, 0x3D, 0xEA, 0xD9, 0x77, 0xF6, 0x59, 0x22, 0xFF, 0x10, 0x95, 0x72, 0xA1, 0x99,
+    0x57, 0xB2, 0x43, 0xC9, 0xAC, 0x5D, 0x2A, 0x8A, 0x90, 0x59, 0x4B, 0x1C, 0xF8, 0xC9, 0xA7, 0xDA,
+    0xED, 0x04, 0x05, 0xEC, 0xA0, 0x81, 0xAE, 0x90, 0xF3, 0x1B, 0x58, 0x8C, 0x86, 0xD7, 0x76, 0x8E,
+    0x3F, 0xA0, 0x87, 0x59, 0x25, 0xD7, 0xB1, 0xE9, 0x11, 0x12, 0x49, 0xB5, 0xF3, 0x07, 0x6D, 0x52,
+    0x50, 0x11, 0xA1, 0x4D, 0x04, 0xF5, 0xB1, 0xC1, 0x0E, 0x2A, 0xA9, 0xA5, 0x59, 0x08, 0x86, 0x1D,
+    0xC2, 0xA1, 0xE3, 0x70, 0x68, 0xA7, 0x58, 0x68, 0xBF, 0x7E, 0xB5, 0x4A, 0xBB, 0xB2, 0x47, 0x19,
+    0xCC, 0xC5, 0x25, 0xFE, 0x85, 0xB0, 0x92, 0x9D, 0x43, 0x74, 0xB0, 0x5D, 0x5D, 0xE3, 0x07, 0x80,
+    0x1F, 0xA2, 0x6A, 0xEE, 0x7C, 0x2E, 0x8D, 0xF0, 0xA8, 0x79, 0xBD, 0xB6, 0x22, 0x13, 0x43, 0xAE,
+    0x79, 0x30, 0x93, 0x1E, 0x74, 0x52, 0x98, 0x4D, 0xE2, 0x32, 0x25, 0x42, 0x4B, 0x37, 0xAD, 0x2D,
+    0x1D, 0x22, 0x29, 0x20, 0x6D, 0x35, 0x2C, 0x1F, 0xB4, 0xEF, 0x3E, 0x4A, 0xEC, 0xA7, 0x76, 0x32,
+    0xA9, 0xE1, 0x3E, 0xE3, 0x60, 0x30, 0x07, 0xEE, 0xD0, 0xE3, 0x55, 0x4A, 0xB3, 0x9A, 0x27, 0x90,
+    0x31, 0x8C, 0xB1, 0x25, 0x34, 0x90, 0x21, 0x63, 0xFF, 0xBE, 0x8E, 0xE2, 0xEA, 0x1B, 0x19, 0x8A,
+    0xA3, 0xC9, 0x87, 0x3A, 0x8E, 0x51, 0xF1, 0xE8, 0x50, 0x61, 0x9B, 0x55, 0xA6, 0x95, 0xFC, 0x50,
+    0xF4, 0x37, 0x02, 0x53, 0x70, 0xEA, 0xB7, 0x71, 0xD4, 0x86, 0x73, 0x88, 0x42, 0xFB, 0xD2, 0xEF,
+    0xA5, 0x0A, 0x66, 0xDF, 0x38, 0x2E, 0xB4, 0xBF, 0x70, 0x50, 0xE8, 0x84, 0xC1, 0xF9, 0x28, 0x0E,
+    0x9B, 0x1F, 0x4B, 0x52, 0x1F, 0x92, 0x1B, 0xE2, 0x19, 0xD7, 0x98, 0xF6, 0x86, 0x65, 0x18, 0xB1,
+    0x5D, 0x16, 0x5A, 0xDF, 0x13, 0x7D, 0x3C, 0x81, 0xB1, 0xA7, 0x66, 0x5F, 0xF8, 0x3A, 0xFE, 0x88,
+    0x61, 0x6A, 0x39, 0x57, 0xE2, 0x99, 0xE9, 0x6E, 0xAA, 0x79, 0x04, 0x67, 0x75, 0x6F, 0x91, 0xE2,
+    0xA8, 0xF4, 0x38, 0x2E, 0x98, 0x1F, 0xCF, 0x81, 0x7E, 0x23, 0xFA, 0x82, 0xE8, 0x2B, 0x3A, 0x78,
+    0x4C, 0x3A, 0x91, 0xBE, 0x29, 0x96, 0x0F, 0xB2, 0xA4, 0x94, 0xD5, 0x8A, 0x7A, 0xC4, 0xAE, 0x4A,
+    0x66, 0x24, 0x7B, 0x2E, 0xAE, 0x10, 0x74, 0xC0, 0x6A, 0xA4, 0x20, 0x11, 0xB5, 0xD1, 0x57, 0x08,
+    0x9A, 0x65, 0x08, 0xFE, 0x5A, 0xB1, 0xAD, 0x70, 0xB2, 0x3D, 0x77, 0x0A, 0x45, 0x95, 0x1D, 0xCF,
+    0x6A, 0x46, 0x68, 0x2A, 0x6B, 0x5C, 0xF6, 0xAE, 0xF4, 0x46, 0x52, 0xDA, 0xF7, 0xA5, 0x3A, 0xAD,
+    0x4F, 0x51, 0xF8, 0x59, 0x2D, 0x76, 0x68, 0xE6, 0x18, 0xDA, 0x57, 0x19, 0x6D, 0x07, 0x09, 0xD6,
+    0x5A, 0xC3, 0xD3, 0x5C, 0x40, 0xF0, 0x7C, 0x21, 0x87, 0x6E, 0xB8, 0x07, 0xD0, 0xEC, 0xC0, 0x4D,
+    0x11, 0x92, 0xED, 0x58, 0x96, 0x81, 0x74, 0xBF, 0x15, 0xDA, 0x06, 0x70, 0xDB, 0x41, 0x4F, 0x47,
+    0x0B, 0xE5, 0x2F, 0x33, 0x99, 0xE7, 0xDC, 0x57, 0xAB, 0x9B, 0xDE, 0xE2, 0x3E, 0xBB, 0xE5, 0x86,
+    0xDB, 0x3F, 0xE0, 0x66, 0xE1, 0x7E, 0x91, 0x69, 0x6F, 0x87, 0xCA, 0xA7, 0x5F, 0x11, 0x27, 0x98,
+    0x01, 0x03, 0xC2, 0x54, 0x3F, 0x3A, 0x7C, 0xA4, 0xFF, 0x70, 0xBD, 0xF7, 0xB8, 0x92, 0xB0, 0x6B,
+    0x57, 0xAB, 0x68, 0x54, 0x28, 0x7E, 0x0B, 0x3C, 0x7B, 0x31, 0x52, 0xF6, 0xBD, 0xBA, 0xE6, 0x60,
+    0x2E, 0x98, 0xE2, 0xE7, 0xD8, 0x08, 0x49, 0x2F, 0xA2, 0x99, 0xA8, 0xDE, 0xAC, 0xF9, 0x19, 0x26,
+    0x32, 0x45, 0x2C, 0xB6, 0x24, 0xF1, 0xE4, 0x1D, 0x8A, 0x65, 0x5F, 0xBD, 0x5B, 0x8A, 0x3F, 0xF3,
+    0x4D, 0xF5, 0xA2, 0x54, 0x4F, 0x28, 0x1C, 0x28, 0xAA, 0xBC, 0xCD, 0xAE, 0x10, 0x63, 0xB5, 0xE4,
+    0x8E, 0x38, 0xCC, 0xC7, 0x98, 0xA9, 0xFF, 0x52, 0x36, 0xDC, 0x21, 0xD8, 0x3D, 0x94, 0x2D, 0x78,
+    0xEE, 0xDC, 0x53, 0xDC, 0xB3, 0x33, 0x73, 0x9D, 0x0F, 0x4E, 0x46, 0xDF, 0x6F, 0x41, 0x9F, 0x27,
+    0x48, 0xC6, 0x8E, 0xDC, 0xE5, 0x48, 0x4A, 0xE0, 0x60, 0x58, 0x04, 0x89, 0xB1, 0x0C, 0x7A, 0x92,
+    0x31, 0x82, 0x9D, 0x19, 0x30, 0xF3, 0x92, 0xA4, 0xEB, 0xAD, 0xC0, 0x31, 0x7D, 0xB2, 0x0B, 0x9F,
+    0x3D, 0xC0, 0xAC, 0xCD, 0x8E, 0x11, 0xA6, 0x59, 0xB0, 0xC9, 0xFE, 0x64, 0xDA, 0xBB, 0x16, 0x68,
+    0x0C, 0xF7, 0x8A, 0x3F, 0x0C, 0x68, 0xEA, 0x84, 0x4C, 0xDD, 0xEF, 0x19, 0x3B, 0x04, 0x31, 0xDF,
+    0x79, 0x69, 0x19, 0x96, 0x77, 0xC2, 0x78, 0x64, 0x64, 0x8E, 0xB2, 0xE3, 0x3D, 0x83, 0xCC, 0x6D,
+    0xAF, 0x66, 0x44, 0xF1, 0xB8, 0x88, 0x65, 0xD8, 0x21, 0x14, 0x99, 0x47, 0xFD, 0xFA, 0xEE, 0x66,
+    0xA7, 0x47, 0x79, 0x13, 0x09, 0x44, 0xAF, 0x16, 0xB1, 0x63, 0x17, 0x5A, 0x7E, 0x31, 0xCB, 0xE5,
+    0xB3, 0x0D, 0x43, 0xD9, 0x39, 0xD9, 0x29, 0xB9, 0xA7, 0xE5, 0xC2, 0xBD, 0x1D, 0x35, 0x38, 0x2C,
+    0x6A, 0x6E, 0xF0, 0x6D, 0xB1, 0xFC, 0xFA, 0xF5, 0x89, 0xBC, 0xC1, 0x46, 0x9C, 0xC1, 0xBC, 0xFC,
+    0x0E, 0x82, 0x16, 0x17, 0x1A, 0xBE, 0xC1, 0xAD, 0xAE, 0xF3, 0xC9, 0x77, 0x31, 0xBD, 0xF3, 0xCA,
+    0x21, 0xD9, 0x7D, 0xDC, 0x5D, 0xE0, 0x66, 0x01, 0x47, 0x3F, 0x40, 0xC4, 0x82, 0xBE, 0xDE, 0x29,
+    0xEC, 0x24, 0xF0, 0x54, 0xE8, 0xE5, 0x1A, 0x9B, 0xA8, 0xF0, 0x97, 0x04, 0xA8, 0x64, 0x50, 0x52,
+    0x20, 0xC9, 0x81, 0x4A, 0x12, 0xE2, 0xB0, 0xDC, 0x38, 0x04, 0xB9, 0x6D, 0x67, 0x69, 0x37, 0x70,
+    0x77, 0xC2, 0xCB, 0x82, 0xCC, 0x8B, 0x10, 0x93, 0x20, 0x53, 0x0B, 0x66, 0xD2, 0x45, 0x8E, 0xE5,
+    0xA2, 0x00, 0x36, 0x09, 0x37, 0x09, 0xB8, 0x8C, 0x4D, 0x40, 0xBB, 0xA1, 0x85, 0xFA, 0xD2, 0xFF,
+    0xFF, 0xFC, 0x0B, 0x8D, 0x55, 0xB1, 0x6E, 0x1D, 0x45, 0x14, 0xBD, 0xBB, 0x4B, 0x3C, 0xC5, 0x0A,
+    0x0D, 0x4D, 0xEA, 0x69, 0x68, 0xB0, 0x90, 0xB6, 0xA5, 0x40, 0x9A, 0x05, 0x17, 0x2E, 0x5C, 0x98,
+    0x82, 0x54, 0x14, 0xE9, 0x69, 0xD2, 0x52, 0x20, 0xCD, 0x52, 0xA0, 0x14, 0x48, 0x98, 0x2F, 0x00,
+    0x17, 0x41, 0x32, 0x6E, 0xE0, 0x03, 0xA2, 0xCC, 0x62, 0x17, 0x2E, 0x52, 0x78, 0x89, 0x88, 0x28,
+    0xB3, 0x42, 0xA9, 0x52, 0x8D, 0x9D, 0x35, 0x5A, 0xF0, 0xEC, 0x5C, 0xCE, 0x9D, 0x7D, 0x4E, 0x22,
+    0xD1, 0xB0, 0x7A, 0x33, 0xEF, 0xBD, 0xDD, 0x99, 0x3B, 0xE7, 0x9E, 0x73, 0xEE, 0x5D, 0xF2, 0xCC,
+    0x3D, 0x11, 0xBF, 0x9E, 0x8B, 0x74, 0xC7, 0x75, 0x54, 0x44, 0x72, 0x2D, 0x95, 0x91, 0x3C, 0x51,
+    0x15, 0x89, 0x31, 0xCF, 0x94, 0x88, 0xD4, 0x44, 0x9C, 0xDA, 0x3A, 0x14, 0xCC, 0xA3, 0x0E, 0x25,
+    0xF3, 0xA4, 0x43, 0x15, 0x4D, 0xD4, 0x63, 0x35, 0x57, 0x8B, 0x19, 0xD4, 0x54, 0xA4, 0xA6, 0x57,
+    0x81, 0x92, 0xED, 0x6B, 0x99, 0x3B, 0x2D, 0x73, 0xAB, 0xC7, 0x62, 0x21, 0xCA, 0xB1, 0x70, 0xA9,
+    0x19, 0x53, 0x6B, 0x26, 0x92, 0x33, 0xC7, 0x3C, 0x77, 0x98, 0x7D, 0x5E, 0x82, 0xAB, 0x38, 0x3E,
+    0x7E, 0x40, 0x15, 0x82, 0xAF, 0x93, 0x9A, 0x10, 0xAA, 0x0E, 0x3A, 0x4F, 0x23, 0xE9, 0xD1, 0x70,
+    0x27, 0xD3, 0x64, 0x86, 0x86, 0x63, 0xD3, 0xDB, 0xB3, 0xC5, 0xF6, 0xF6, 0x2B, 0x1C, 0xE6, 0x5A,
+    0x9C, 0xE5, 0x29, 0x39, 0x99, 0x24, 0xD0, 0xB2, 0x39, 0xF3, 0x2D, 0x83, 0x23, 0x0D, 0x07, 0x99,
+    0x90, 0xA9, 0x49, 0xF4, 0xFA, 0x2A, 0x00, 0x41, 0xF1, 0x8C, 0x11, 0xA9, 0xC2, 0x83, 0x2A, 0x95,
+    0x7F, 0x17, 0x5C, 0xF1, 0xE0, 0x77, 0x38, 0xDA, 0x93, 0xE8, 0xF4, 0x98, 0xF4, 0xD9, 0x64, 0x77,
+    0x2F, 0x16, 0xFD, 0x6B, 0x74, 0x3B, 0x21, 0x99, 0x21, 0xBA, 0xDD, 0xD9, 0xBA, 0x9E, 0xF7, 0xB8,
+    0x37, 0x60, 0x0D, 0x44, 0x70, 0x8B, 0x1F, 0x03, 0x42, 0x87, 0x35, 0xEA, 0xBD, 0x91, 0x6C, 0x22,
+    0xCD, 0x43, 0xC9, 0x05, 0xD9, 0x13, 0x56, 0x13, 0x47, 0x6F, 0x9E, 0x9D, 0x5F, 0xCE, 0x91, 0x9B,
+    0xFD, 0xF3, 0xCB, 0xAB, 0xD9, 0x1B, 0x56, 0x89, 0x07, 0xCB, 0xA9, 0xF3, 0x38, 0x9A, 0x9A, 0x2E,
+    0x6F, 0x54, 0x80, 0xE3, 0x38, 0x82, 0xE1, 0xB9, 0xE2, 0x8F, 0x7E, 0xD1, 0xF3, 0x1A, 0xB3, 0x41,
+    0x6C, 0x0B, 0xE8, 0x16, 0xAB, 0x20, 0x0D, 0xF9, 0xCD, 0x90, 0xDF, 0x4E, 0xEE, 0x8F, 0x5B, 0xC8,
+    0x8D, 0xA9, 0xC6, 0x28, 0x18, 0x79, 0xD7, 0xB8, 0x59, 0x61, 0x53, 0x05, 0x82, 0x3F, 0xC3, 0x10,
+    0x70, 0xDC, 0x6E, 0xC0, 0x3D, 0x2F, 0x39, 0x6A, 0x9E, 0x9B, 0xE9, 0x5D, 0xC4, 0x84, 0xDE, 0x90,
+    0x99, 0x6F, 0x3E, 0xBE, 0x6D, 0x9D, 0xC0, 0x1A, 0x6A, 0xA8, 0x02, 0x8D, 0x1E, 0x12, 0x7D, 0x49,
+    0xB7, 0x22, 0x19, 0x7C, 0x44, 0x2C, 0xA0, 0xE3, 0xC7, 0xCC, 0x11, 0x39, 0x7F, 0x7D, 0xF7, 0xEA,
+    0x13, 0xD9, 0x02, 0x55, 0x84, 0xEA, 0xA6, 0xCF, 0x64, 0x23, 0x24, 0xDC, 0x22, 0xC8, 0xA0, 0xDB,
+    0xE6, 0x31, 0x21, 0x43, 0x23, 0x44, 0xFD, 0xE7, 0xC1, 0x2A, 0x7A, 0x71, 0xF8, 0x88, 0x1E, 0x91,
+    0x3E, 0x67, 0x48, 0x03, 0x46, 0x24, 0xFF, 0xFB, 0xBC, 0x37, 0xD5, 0x51, 0x43, 0x65, 0xA8, 0xDB,
+    0x3B, 0xE2, 0x62, 0x29, 0x63, 0x35, 0x8B, 0x11, 0x20, 0x7C, 0x6F, 0x3B, 0x68, 0x5C, 0x2C, 0x15,
+    0x6E, 0xA9, 0x09, 0x76, 0x18, 0x4C, 0x14, 0xED, 0xDD, 0x45, 0x04, 0x06, 0x9F, 0xB9, 0x5C, 0x2D,
+    0x97, 0x05, 0x31, 0xBD, 0xCC, 0x3E, 0xDF, 0x98, 0xF1, 0xAD, 0x2F, 0x16, 0xF2, 0x3B, 0xB3, 0x8A,
+    0x3A, 0xD8, 0xBE, 0x39, 0x59, 0xC8, 0xED, 0x8F, 0xB4, 0x30, 0x0C, 0x37, 0x91, 0xE4, 0x6D, 0x24,
+    0x8F, 0x81, 0x36, 0xCE, 0x27, 0x33, 0xD0, 0xA6, 0x14, 0x32, 0x66, 0x11, 0xE1, 0x73, 0xDA, 0xFE,
+    0x26, 0xA8, 0x19, 0xB8, 0x54, 0x30, 0xA3, 0x05, 0x8E, 0xC9, 0xB5, 0x76, 0x3F, 0x54, 0x57, 0x0B,
+    0x35, 0xF7, 0xFA, 0xF2, 0x7A, 0x12, 0x9B, 0x15, 0xB0, 0x9B, 0x48, 0xF8, 0x06, 0x49, 0xC3, 0x9B,
+    0x24, 0x81, 0x08, 0xE4, 0x05, 0xCE, 0x61, 0xDE, 0x5E, 0xB0, 0x94, 0x11, 0x0B, 0x04, 0x8C, 0x7E,
+    0x16, 0x32, 0x1A, 0xF2, 0x72, 0x3E, 0x76, 0x54, 0xD8, 0x7C, 0x9B, 0x3F, 0xA5, 0x06, 0x0A, 0x6B,
+    0x31, 0xDD, 0xCF, 0xFF, 0x1C, 0xAE, 0x05, 0x25, 0x6E, 0x16, 0x48, 0x5B, 0x87, 0xE5, 0x51, 0x0D,
+    0x4C, 0x0A, 0x14, 0x09, 0xA8, 0x0A, 0xF1, 0x04, 0x55, 0x35, 0x21, 0x31, 0xC0, 0x2A, 0xFF, 0x8A,
+    0x24, 0xB8, 0xC4, 0xF1, 0x45, 0xAE, 0xF8, 0x2E, 0x23, 0x83, 0xDD, 0xF2, 0xF0, 0x50, 0xA7, 0x8C,
+    0x6B, 0x9A, 0x02, 0x0E, 0x41, 0x51, 0xAA, 0x16, 0xB8, 0x80, 0x1A, 0xB0, 0xF4, 0x08, 0xAB, 0xE8,
+    0x80, 0x1D, 0xEA, 0xA5, 0x2C, 0x11, 0x74, 0x95, 0x14, 0x70, 0x29, 0xC1, 0x2A, 0x89, 0xA6, 0xE5,
+    0x57, 0x23, 0x5E, 0x73, 0x07, 0xA2, 0x3A, 0xB6, 0x56, 0x0B, 0xBA, 0x46, 0x0D, 0x33, 0x8F, 0x26,
+    0x60, 0xB2, 0x7D, 0x21, 0x8F, 0xC5, 0x2C, 0xAB, 0xA3, 0x33, 0x74, 0xB2, 0x62, 0x4D, 0xB7, 0xA9,
+    0xC8, 0xA3, 0xF2, 0xA7, 0x22, 0xA9, 0x98, 0xB7, 0x7B, 0x1C, 0x6C, 0x61, 0x5C, 0x54, 0x53, 0xA6,
+    0xA1, 0xC1, 0xA1, 0x2E, 0x02, 0x3F, 0xAA, 0x35, 0x26, 0x81, 0x03, 0xC6, 0xDC, 0xEC, 0x3B, 0x8B,
+    0x07, 0xE8, 0x3C, 0xD9, 0x5B, 0x22, 0x52, 0x1E, 0x03, 0xCC, 0xBA, 0x77, 0xC9, 0xBC, 0xD8, 0x73,
+    0xE6, 0x90, 0x6E, 0xBB, 0xA7, 0xBB, 0x68, 0x61, 0x38, 0x3C, 0xBB, 0xC0, 0x0C, 0xE2, 0x15, 0xAC,
+    0xAC, 0xA4, 0xDF, 0xA1, 0xA1, 0x45, 0x92, 0x8E, 0x05, 0x41, 0x6C, 0x87, 0x30, 0xF8, 0xEA, 0x55,
+    0x5E, 0xFE, 0x3B, 0x1A, 0x11, 0xFA, 0x8D, 0x74, 0x48, 0x74, 0x4C, 0xBE, 0xE9, 0x64, 0x72, 0x44,
+    0xAE, 0xC0, 0x32, 0xFF, 0x5B, 0x4B, 0x7F, 0xFB, 0xF8, 0xC7, 0x23, 0xCF, 0x97, 0xD1, 0xF3, 0xCB,
+    0x28, 0xEE, 0x14, 0x7F, 0x4A, 0x0B, 0x13, 0xE3, 0x4A, 0x03, 0x83, 0x57, 0x31, 0xEC, 0xA0, 0x47,
+    0xDF, 0x43, 0xC7, 0x58, 0xF3, 0xF9, 0x5C, 0xA5, 0x5A, 0xB8, 0x9C, 0x56, 0xBB, 0xE6, 0x2C, 0x32,
+    0x7A, 0x33, 0x94, 0xB3, 0x01, 0x56, 0xF4, 0xD4, 0x09, 0x58, 0x82, 0xC0, 0x12, 0xA0, 0x82, 0x59,
+    0xE0, 0xFB, 0xD6, 0x09, 0xA0, 0xDE, 0x62, 0xE8, 0xE4, 0x6E, 0x7A, 0x03, 0x65, 0x59, 0xA5, 0xE6,
+    0x64, 0x08, 0x55, 0x59, 0x4F, 0xE4, 0xB2, 0xB2, 0xB3, 0x61, 0x08, 0x58, 0xDB, 0xED, 0xBB, 0x83,
+    0x39, 0x0B, 0xF5, 0x25, 0xA0, 0x72, 0x81, 0x16, 0xCA, 0xFB, 0x93, 0x3F, 0x05, 0x55, 0xEE, 0x7A,
+    0xDE, 0x7A, 0x9E, 0x72, 0xBC, 0x46, 0xFC, 0xD6, 0xA1, 0x21, 0x0A, 0x38, 0xBC, 0x19, 0x24, 0x3E,
+    0x34, 0xCB, 0xE8, 0xA2, 0x6F, 0xF5, 0x9F, 0x20, 0xEF, 0x00, 0xA4, 0x01, 0xDC, 0xC5, 0xF2, 0xBE,
+    0x7D, 0x3C, 0x85, 0xD4, 0x9C, 0xDE, 0x9F, 0xFC, 0xF7, 0xEE, 0x04, 0x5C, 0x81, 0xB9, 0xA8, 0xF8,
+    0x87, 0x91, 0xBE, 0x70, 0x6D, 0xF1, 0x24, 0x52, 0x8D, 0xD3, 0x3F, 0x14, 0xDD, 0xD7, 0xD7, 0x49,
+    0x46, 0xA0, 0xFF, 0x08, 0xEA, 0x32, 0x96, 0x91, 0x3F, 0x60, 0xFB, 0xAD, 0x3F, 0xB8, 0xE6, 0x27,
+    0x40, 0x60, 0x39, 0x96, 0x73, 0xA2, 0xB7, 0x61, 0x42, 0x33, 0x14, 0x7B, 0x21, 0x53, 0x7E, 0x93,
+    0x1A, 0x36, 0x17, 0x69, 0x6D, 0xF0, 0xD9, 0xB1, 0x8B, 0x1F, 0xD7, 0x83, 0xC0, 0xE7, 0xA2, 0x16,
+    0xD1, 0x50, 0xE4, 0xD4, 0x63, 0x19, 0x45, 0x64, 0xD1, 0xDB, 0x66, 0x0E, 0xEB, 0x29, 0xBF, 0x93,
+    0xFC, 0xCA, 0x42, 0xCA, 0xA5, 0x2D, 0x39, 0x35, 0x67, 0x63, 0x75, 0x2D, 0x44, 0x26, 0x95, 0x4C,
+    0xF0, 0x3D, 0xAC, 0xA7, 0x47, 0xA6, 0x05, 0x6A, 0xFD, 0x86, 0xBE, 0x83, 0x7E, 0x73, 0x0A, 0x2D,
+    0x6D, 0x67, 0x77, 0x26, 0x15, 0xDC, 0xDA, 0x49, 0xE4, 0xDA, 0x12, 0x33, 0x37, 0x52, 0x09, 0x2C,
+    0x8E, 0xE4, 0x8F, 0x97, 0x5B, 0x2A, 0x82, 0x8B, 0x7D, 0x21, 0xC4, 0x8C, 0x2A, 0x5A, 0x7E, 0xC1,
+    0x33, 0xF4, 0xC1, 0x0B, 0x93, 0x59, 0x08, 0x7D, 0xDA, 0xDE, 0x58, 0xFE, 0x55, 0x05, 0x34, 0xA1,
+    0x6C, 0xA5, 0xA6, 0x3B, 0x74, 0x7F, 0xA9, 0x22, 0xFF, 0xEA, 0xFD, 0x84, 0xD7, 0x48, 0x85, 0xB8,
+    0x9A, 0xD3, 0x7B, 0x76, 0xF0, 0x0F, 0x5D, 0xCB, 0x0F, 0x7D, 0x99, 0x20, 0x39, 0xE2, 0xF2, 0xB8,
+    0xC5, 0x0F, 0xD6, 0x77, 0x1C, 0xD3, 0x3B, 0xC4, 0x2F, 0x02, 0x0A, 0x25, 0x60, 0xED, 0x77, 0xF4,
+    0x7F, 0xAF, 0x7F, 0x01, 0xB5, 0x55, 0xB1, 0x8E, 0x1C, 0x45, 0x10, 0xAD, 0x99, 0x96, 0x3D, 0x12,
+    0x13, 0x34, 0x01, 0xF9, 0xC4, 0x38, 0xE9, 0x4F, 0xE8, 0xC1, 0x48, 0x24, 0x04, 0x4E, 0x8C, 0xD3,
+    0xCD, 0x49, 0xEE, 0x0F, 0x6E, 0x1A, 0x12, 0x07, 0x24, 0x4E, 0x1C, 0x93, 0x38, 0x38, 0xF1, 0x0D,
+    0xC6, 0x3D, 0xDC, 0x05, 0x17, 0x10, 0xDC, 0x20, 0x74, 0x31, 0x2D, 0x0B, 0x90, 0x30, 0x81, 0xFB,
+    0xF0, 0x58, 0x1E, 0xE4, 0xEE, 0x2E, 0x5E, 0xF5, 0xEE, 0xDA, 0xC4, 0x48, 0xCC, 0xEC, 0xF6, 0xAE,
+    0x76, 0xBA, 0xAB, 0x5E, 0xBD, 0xF7, 0xAA, 0x96, 0xA8, 0x5E, 0xB7, 0x79, 0x21, 0x32, 0xBC, 0x12,
+    0x31, 0x27, 0x52, 0x7C, 0x37, 0xDF, 0xEA, 0x52, 0x93, 0xED, 0xBD, 0x88, 0x65, 0x08, 0x5D, 0xB2,
+    0xFC, 0x82, 0x37, 0xCB, 0xCC, 0x41, 0x33, 0x17, 0xA2, 0xE9, 0x7A, 0x24, 0xB2, 0x0E, 0x47, 0xED,
+    0x7C, 0x5C, 0x4C, 0x6C, 0x47, 0xC2, 0x63, 0x47, 0x9D, 0x2C, 0xE4, 0x0B, 0x1D, 0xF6, 0x4C, 0xD8,
+    0x4C, 0x5E, 0x12, 0xB1, 0x2C, 0x85, 0x8E, 0xD7, 0x49, 0x40, 0xB2, 0x84, 0x43, 0xE5, 0x63, 0xBB,
+    0xF8, 0xA7, 0xD3, 0xC8, 0x4F, 0x7D, 0x5B, 0x3C, 0x40, 0x20, 0x57, 0xB8, 0xCD, 0x4F, 0xA8, 0xC9,
+    0xF5, 0xD4, 0x87, 0xC4, 0x2F, 0x22, 0x59, 0x8E, 0xD8, 0xFB, 0x88, 0x14, 0x80, 0x76, 0x91, 0xA8,
+    0xC7, 0x5B, 0x07, 0xBC, 0x81, 0x1E, 0xA8, 0xE4, 0xB5, 0x91, 0x99, 0x05, 0x0E, 0xF2, 0xDA, 0x51,
+    0x12, 0xFB, 0x9A, 0xB4, 0x48, 0xA0, 0x36, 0xC9, 0x4B, 0x25, 0x1A, 0x0A, 0x4D, 0x3C, 0x7A, 0x16,
+    0x58, 0xF7, 0x1B, 0x59, 0x55, 0x34, 0xF2, 0xD1, 0xFF, 0x9E, 0x04, 0x96, 0xE6, 0xB9, 0xB2, 0xF2,
+    0xE4, 0x1D, 0xD0, 0x76, 0xA3, 0x8C, 0x38, 0x5D, 0x54, 0x6B, 0xBF, 0x22, 0xE7, 0x30, 0x4F, 0x0E,
+    0x99, 0x3C, 0x82, 0x91, 0xFD, 0x74, 0x93, 0xFA, 0xBD, 0x7E, 0x2E, 0x58, 0xF3, 0xB4, 0x03, 0x22,
+    0x05, 0xAA, 0x6A, 0x20, 0x20, 0xC6, 0x23, 0x96, 0x80, 0x5D, 0x2E, 0x1E, 0x49, 0xA6, 0xCB, 0x15,
+    0x8F, 0x54, 0x36, 0x17, 0x72, 0x36, 0x70, 0xB7, 0x52, 0xCB, 0x6A, 0xD3, 0x91, 0x86, 0xA8, 0x17,
+    0x44, 0xE2, 0x71, 0x22, 0xEF, 0xF4, 0x06, 0xAC, 0x12, 0xA3, 0x19, 0x6F, 0x09, 0x82, 0x53, 0x25,
+    0x91, 0xD4, 0x6B, 0xC9, 0x01, 0xA9, 0x5C, 0xA5, 0xEF, 0xD1, 0x11, 0x9F, 0xDA, 0xE8, 0x4B, 0xE0,
+    0xB1, 0x6B, 0x1F, 0x4D, 0x52, 0x3C, 0x97, 0x9E, 0x5D, 0x9B, 0xF5, 0x82, 0x00, 0xFA, 0xA7, 0x0C,
+    0x4A, 0xA8, 0x98, 0x8B, 0xAD, 0x02, 0xC2, 0x4F, 0x0D, 0x57, 0x5C, 0xE6, 0xCF, 0x22, 0x48, 0xD2,
+    0x24, 0x3C, 0xFA, 0xCF, 0xA3, 0x1F, 0x1B, 0x1F, 0x58, 0x15, 0x67, 0x93, 0x0E, 0x26, 0x75, 0x05,
+    0x35, 0xFB, 0xF9, 0x98, 0xC2, 0xD3, 0xE4, 0x74, 0x04, 0xCC, 0xA2, 0x32, 0x0D, 0x0B, 0x36, 0xA7,
+    0x21, 0x90, 0xB9, 0x14, 0x46, 0x11, 0xC6, 0xFA, 0x05, 0xBA, 0x27, 0x29, 0x76, 0xDB, 0xD7, 0xCD,
+    0x0F, 0x78, 0xD4, 0x41, 0x7C, 0x04, 0x41, 0xCC, 0xDC, 0x26, 0x90, 0x05, 0x88, 0x0E, 0x5F, 0xD6,
+    0xEA, 0x98, 0x6E, 0x13, 0x6D, 0xC5, 0x48, 0xA8, 0x1D, 0x47, 0x1B, 0xC1, 0xA6, 0xF7, 0xA5, 0x01,
+    0xE4, 0x59, 0x7B, 0xA6, 0x92, 0x5E, 0xD5, 0x66, 0x96, 0x6E, 0xF5, 0xAE, 0xBF, 0x29, 0xA4, 0xDF,
+    0x88, 0x59, 0xC4, 0x04, 0x80, 0x80, 0xDD, 0xE6, 0x9A, 0x67, 0x2B, 0xB7, 0x43, 0xE0, 0x11, 0xA2,
+    0x88, 0xFA, 0x35, 0xF6, 0xE4, 0x9A, 0x86, 0x47, 0x05, 0x4B, 0x28, 0xE0, 0x69, 0xC5, 0xDF, 0xF5,
+    0x62, 0x98, 0xBC, 0x11, 0x74, 0xAD, 0x2C, 0x2A, 0xEF, 0xB0, 0xAC, 0xF0, 0x50, 0x17, 0x87, 0x05,
+    0x7E, 0xC2, 0x71, 0x1D, 0x70, 0x7E, 0x58, 0xAC, 0xAB, 0x60, 0x11, 0x6C, 0x12, 0x1F, 0x79, 0x21,
+    0xA0, 0x1A, 0x09, 0x11, 0x73, 0x53, 0xEE, 0xFB, 0xAD, 0xE1, 0xC4, 0xB1, 0xE5, 0xD5, 0xCF, 0xAA,
+    0xAA, 0x2C, 0x2E, 0xAC, 0xF9, 0x91, 0xFC, 0x60, 0xF5, 0xE6, 0x9D, 0xD5, 0x4F, 0xFE, 0x96, 0xB4,
+    0x0E, 0xF9, 0x17, 0xF2, 0x0F, 0x51, 0xFF, 0xD7, 0x42, 0x06, 0x93, 0x8E, 0xD6, 0x75, 0xAB, 0x5E,
+    0xDA, 0x04, 0x43, 0x17, 0x48, 0xEE, 0x47, 0x6E, 0x51, 0xD4, 0x1F, 0x7E, 0x19, 0xD8, 0x2C, 0xBD,
+    0x18, 0x47, 0x02, 0x8B, 0xDD, 0xC5, 0xF6, 0x6D, 0xDA, 0x37, 0x90, 0xC7, 0xAF, 0x1A, 0xDD, 0x89,
+    0xEF, 0x66, 0x1E, 0x82, 0xAA, 0x2C, 0x83, 0x85, 0x6E, 0x05, 0xCB, 0xD3, 0x88, 0xF6, 0x89, 0x9D,
+    0x68, 0xED, 0xA5, 0x65, 0x5F, 0x3F, 0x10, 0xF3, 0x9A, 0x59, 0x1F, 0xF6, 0x41, 0x0D, 0xB5, 0xED,
+    0xF7, 0xB9, 0x3E, 0xC2, 0x3B, 0xD5, 0xAB, 0xB0, 0x6D, 0x9B, 0xA9, 0x11, 0xC9, 0x65, 0x14, 0xB4,
+    0xD2, 0xE7, 0xA6, 0xF6, 0xC8, 0x41, 0x0D, 0xA8, 0x1F, 0xAC, 0xB3, 0x5F, 0xE5, 0x26, 0xF7, 0xB1,
+    0x8F, 0xF6, 0x7A, 0x9A, 0x31, 0x0C, 0x60, 0xF5, 0x75, 0xF8, 0xED, 0x64, 0xF6, 0x84, 0x6E, 0x80,
+    0x60, 0x01, 0x9B, 0xC6, 0xE9, 0x93, 0x2C, 0x48, 0xE1, 0x16, 0xA0, 0x6A, 0xBA, 0x5C, 0x55, 0xB3,
+    0x48, 0xE3, 0xC3, 0xD1, 0x4D, 0x7A, 0xA9, 0x08, 0x74, 0x68, 0xEB, 0x47, 0x6C, 0x12, 0x09, 0x1A,
+    0x12, 0x7C, 0xE8, 0x09, 0x80, 0x9F, 0x6B, 0x05, 0x86, 0x21, 0x20, 0x7F, 0x71, 0xB2, 0x00, 0x27,
+    0x4E, 0x1D, 0xB7, 0xE3, 0xC3, 0x3E, 0xC6, 0x29, 0x8C, 0x0A, 0xD7, 0xF3, 0x92, 0x6B, 0x74, 0xE9,
+    0x83, 0x83, 0x06, 0xC2, 0xBC, 0xF8, 0x9A, 0xA6, 0xF9, 0x5F, 0x76, 0x42, 0xD9, 0x9B, 0x5A, 0x3B,
+    0xDC, 0x52, 0x81, 0x7E, 0xBD, 0x8B, 0x7A, 0x3F, 0xD3, 0x16, 0x29, 0xC1, 0xE0, 0xDE, 0xDB, 0xC9,
+    0x16, 0xD4, 0x90, 0x20, 0x7B, 0xDA, 0xD3, 0x5E, 0x27, 0xCD, 0xB2, 0x0F, 0x6D, 0xDD, 0xB0, 0xB4,
+    0xDB, 0x44, 0xFA, 0x39, 0x90, 0x60, 0x42, 0x0A, 0x80, 0x1B, 0xE4, 0xFF, 0x11, 0x02, 0x8A, 0x00,
+    0xDE, 0x4D, 0xE7, 0x00, 0x0E, 0x5E, 0xD0, 0x89, 0xDF, 0x86, 0x3A, 0xFE, 0x0E, 0x64, 0x0C, 0x70,
+    0x80, 0xCF, 0xB0, 0xE4, 0x5A, 0xE9, 0x7E, 0xFF, 0x60, 0x3F, 0x27, 0x89, 0xEE, 0x8C, 0x77, 0x76,
+    0xCB, 0x70, 0x19, 0xFB, 0xBF, 0x40, 0x25, 0x37, 0xC5, 0x3A, 0xBE, 0xB7, 0xFA, 0x0B, 0xA8, 0x39,
+    0xBD, 0xDD, 0x6E, 0xFF, 0x2A, 0x93, 0x77, 0x84, 0x27, 0xC4, 0x70, 0x60, 0x65, 0xAA, 0x80, 0x10,
+    0x49, 0x20, 0x8A, 0x31, 0xD0, 0x83, 0x36, 0x2A, 0x1E, 0xE1, 0x20, 0x0D, 0xCE, 0x31, 0xE6, 0xC0,
+    0xD9, 0xDA, 0x70, 0xC0, 0x48, 0xE8, 0x5F, 0x3A, 0xE3, 0xC9, 0x9E, 0x52, 0x49, 0x94, 0x52, 0xFF,
+    0x4B, 0xE8, 0x5E, 0x45, 0x6B, 0x47, 0x73, 0x75, 0x7E, 0x93, 0xA8, 0xD8, 0xE1, 0x1B, 0xCC, 0xB6,
+    0x94, 0x8C, 0xD3, 0x17, 0x6F, 0x02, 0x0E, 0xF6, 0xAC, 0xD6, 0x76, 0x33, 0xDB, 0x70, 0xAD, 0x83,
+    0x9F, 0x7D, 0xB6, 0x77, 0xA1, 0x74, 0x84, 0x4B, 0xF7, 0x0D, 0xDA, 0xEC, 0x07, 0x65, 0xA0, 0xE3,
+    0x64, 0xAF, 0xCC, 0x93, 0x3D, 0xF4, 0x59, 0xF3, 0xDD, 0xF8, 0xC1, 0x19, 0x71, 0xE8, 0x99, 0xEC,
+    0x86, 0xE4, 0xBA, 0xB4, 0x1C, 0x3A, 0x76, 0xBC, 0xB6, 0x6F, 0xE3, 0xB3, 0x44, 0x39, 0xD9, 0x89,
+    0xAC, 0x35, 0x27, 0x6E, 0xB8, 0xBA, 0xBA, 0x5A, 0xFA, 0x57, 0x6F, 0x7F, 0x46, 0x36, 0x0F, 0x24,
+    0xD9, 0xAC, 0xFE, 0xCC, 0xF6, 0x9B, 0x2D, 0xC3, 0x79, 0xD2, 0xF5, 0xFF, 0x62, 0x98, 0x8F, 0xDD,
+    0x55, 0x05, 0x95, 0x62, 0x2B, 0x6F, 0xFF, 0x71, 0xE4, 0x7F, 0x84, 0x89, 0xDF, 0x2F, 0xA7, 0xA0,
+    0xF2, 0x64, 0xAE, 0x52, 0xBC, 0x1F, 0xF4, 0xC3, 0x2A, 0xA3, 0x1B, 0xF5, 0x4D, 0x32, 0x2B, 0x5F,
+    0x3A, 0x84, 0x90, 0x21, 0xBD, 0x9B, 0xD1, 0x7F, 0xF8, 0x52, 0x34, 0x5A, 0x63, 0x46, 0xBC, 0x0D,
+    0x68, 0xFC, 0x63, 0x71, 0x35, 0x87, 0x56, 0xFE, 0x10, 0xA5, 0xDF, 0x00, 0xCE, 0x23, 0x6B, 0x1D,
+    0x22, 0x1E, 0x74, 0xA0, 0x65, 0x91, 0x4A, 0xCF, 0xDF, 0xD3, 0xB3, 0xA1, 0x2A, 0xD6, 0x57, 0x8A,
+    0xE8, 0xF4, 0xB3, 0x47, 0x36, 0xA3, 0x34, 0xFE, 0x81, 0xEF, 0x25, 0x8C, 0x97, 0x87, 0x1B, 0x3C,
+    0x33, 0x4E, 0x1A, 0x01, 0x18, 0x29, 0xE2, 0x80, 0x19, 0x9C, 0x7B, 0xD8, 0xDF, 0x96, 0xD4, 0xF0,
+    0xCE, 0xD1, 0xFF, 0x78, 0xFD, 0x03, 0xAD, 0x55, 0x31, 0x6F, 0x1E, 0x45, 0x10, 0x9D, 0xBB, 0x55,
+    0x7C, 0x92, 0xAF, 0x58, 0x8A, 0x44, 0x42, 0x58, 0xCA, 0x35, 0x14, 0x51, 0xA4, 0xE8, 0x1A, 0xFA,
+    0x3D, 0x81, 0x44, 0x8A, 0x14, 0x76, 0x81, 0x49, 0x41, 0x41, 0x1D, 0x1A, 0xFF, 0x02, 0xB4, 0x87,
+    0x28, 0x29, 0x42, 0x4F, 0x93, 0x06, 0x89, 0x38, 0x85, 0x1B, 0x17, 0x34, 0xF1, 0xAE, 0xE3, 0x22,
+    0x85, 0x0B, 0x0E, 0x22, 0xE4, 0x32, 0x27, 0x70, 0x04, 0x82, 0xC2, 0x1B, 0xE7, 0x92, 0x1C, 0x68,
+    0x6F, 0x87, 0x37, 0xF7, 0x7D, 0xFE, 0x28, 0x40, 0x54, 0xAC, 0xB4, 0x3A, 0xED, 0xDE, 0xCE, 0xEC,
+    0x9B, 0x99, 0xF7, 0x66, 0x89, 0xAE, 0x96, 0x0D, 0xE9, 0xC7, 0x81, 0xD4, 0xF3, 0x91, 0x68, 0xEB,
+    0x32, 0xCD, 0xA3, 0x98, 0x88, 0x14, 0xB7, 0x94, 0x71, 0x4F, 0x94, 0xF0, 0xC3, 0x5A, 0x22, 0xF3,
+    0xB1, 0xA7, 0xEA, 0x28, 0x90, 0xEE, 0x23, 0x95, 0xC1, 0x90, 0x1A, 0x75, 0x97, 0xA7, 0xDB, 0x03,
+    0x31, 0x27, 0x72, 0xCC, 0xAD, 0x61, 0x0E, 0xB5, 0xCF, 0xA3, 0xEE, 0xC9, 0x95, 0x81, 0xEA, 0xA3,
+    0x91, 0x8A, 0x40, 0x37, 0xDE, 0xA2, 0xF2, 0xE7, 0x81, 0x0E, 0x0C, 0x65, 0xCD, 0xD6, 0xEC, 0xFC,
+    0xF4, 0x8E, 0xE2, 0xA7, 0x9E, 0x39, 0x56, 0x03, 0x1F, 0xC5, 0x62, 0xB4, 0xAD, 0xBD, 0x35, 0x14,
+    0x81, 0xC9, 0xE9, 0xA0, 0x7B, 0xCE, 0x92, 0x0E, 0xA6, 0x73, 0x1C, 0x15, 0x9F, 0xF9, 0xEA, 0xE5,
+    0xB8, 0x80, 0x94, 0x31, 0xB3, 0x07, 0x08, 0x98, 0x11, 0x95, 0x58, 0x00, 0x5D, 0x72, 0xDB, 0xF0,
+    0x68, 0x8E, 0x03, 0xFE, 0x97, 0x03, 0xCB, 0xA9, 0x84, 0xCB, 0xB1, 0x75, 0x28, 0x87, 0xCB, 0xA1,
+    0x96, 0xC3, 0x9C, 0xCB, 0xC2, 0x3C, 0xB3, 0x3F, 0x6E, 0x51, 0xC1, 0x2C, 0xFE, 0x60, 0xDE, 0x10,
+    0xD5, 0xC0, 0x0B, 0x38, 0x23, 0x89, 0x25, 0x93, 0x66, 0xA6, 0xBA, 0xC3, 0xBF, 0xA0, 0x22, 0x55,
+    0x88, 0x89, 0xEC, 0xFB, 0x1F, 0x9D, 0x12, 0xBF, 0xC6, 0x61, 0x18, 0x70, 0xB0, 0x47, 0xFC, 0x59,
+    0x34, 0xDE, 0xB6, 0xAE, 0xEA, 0xAB, 0xCE, 0x1E, 0x07, 0x78, 0x3B, 0x8A, 0xF0, 0xDE, 0x32, 0xF1,
+    0xD7, 0x24, 0x7F, 0x08, 0xD0, 0x43, 0x86, 0x2D, 0x7E, 0xE0, 0x4D, 0x82, 0x4D, 0x31, 0x7D, 0xCA,
+    0xC3, 0x22, 0x02, 0xBA, 0x44, 0x1F, 0x50, 0xD5, 0x46, 0xD2, 0x27, 0x03, 0x22, 0x00, 0xCE, 0x3B,
+    0x8B, 0x7D, 0xC7, 0x92, 0xC3, 0x20, 0x33, 0x4B, 0xDB, 0x4D, 0x86, 0xE4, 0xE7, 0xC0, 0xAD, 0x64,
+    0xE2, 0x6E, 0xDC, 0x22, 0x01, 0x93, 0x7E, 0xB9, 0x0D, 0xF7, 0x44, 0x12, 0x61, 0xD5, 0x91, 0x60,
+    0x45, 0x3A, 0xE2, 0x6A, 0xD2, 0xE5, 0xAC, 0x29, 0xBB, 0x87, 0x74, 0x50, 0x79, 0x05, 0x8F, 0xE5,
+    0x22, 0x71, 0xF5, 0x29, 0xE2, 0xEC, 0x60, 0x9F, 0xA5, 0x62, 0x00, 0xC4, 0x62, 0xA8, 0x82, 0xE3,
+    0x49, 0x23, 0x3E, 0x60, 0x16, 0x7F, 0x8E, 0xDE, 0x28, 0xD2, 0x5E, 0x63, 0x60, 0xE3, 0x12, 0xAD,
+    0xC6, 0x0E, 0x52, 0xC4, 0x40, 0x29, 0x19, 0xEB, 0x4A, 0xB8, 0xCF, 0x81, 0x8B, 0xD2, 0x62, 0x5E,
+    0x49, 0x64, 0x39, 0x01, 0x19, 0x1C, 0xFD, 0x3E, 0x99, 0x5E, 0x21, 0x2F, 0xE5, 0x68, 0xDA, 0x2A,
+    0xE0, 0x8A, 0x0E, 0x45, 0x6A, 0x25, 0x81, 0x4A, 0x82, 0x9C, 0x23, 0xEC, 0x51, 0xBE, 0xC6, 0x72,
+    0x78, 0x33, 0x87, 0xB1, 0xF1, 0xB8, 0x77, 0x83, 0xA3, 0xE1, 0x64, 0x9E, 0xB9, 0xCD, 0xCE, 0x3C,
+    0x0E, 0x55, 0x9F, 0x76, 0x82, 0xE1, 0x90, 0x73, 0x37, 0x1B, 0xE4, 0xDD, 0x3E, 0xA9, 0x73, 0xF0,
+    0x07, 0x73, 0x49, 0x9B, 0xFF, 0x15, 0xD0, 0x8D, 0xB2, 0xA9, 0x8E, 0xFB, 0xE2, 0x7C, 0x58, 0x52,
+    0xBE, 0x1E, 0x61, 0xDE, 0x55, 0x1C, 0xD7, 0xC8, 0x49, 0x11, 0x91, 0xFC, 0x35, 0x66, 0x30, 0xE2,
+    0xEE, 0x1F, 0x3B, 0x4F, 0x06, 0xFD, 0x1C, 0x2C, 0x35, 0x5F, 0x45, 0x8D, 0x2C, 0xBB, 0x8B, 0x6A,
+    0xDE, 0x58, 0x9F, 0x81, 0x46, 0x01, 0x01, 0x86, 0x87, 0xB9, 0xC2, 0x59, 0xB3, 0xCA, 0xDF, 0x01,
+    0x99, 0xC6, 0xF8, 0x2C, 0xD2, 0x04, 0x9C, 0x6A, 0x2C, 0x10, 0x23, 0x64, 0x53, 0x7B, 0x90, 0x4D,
+    0x77, 0x49, 0x12, 0x0F, 0x81, 0xB8, 0x46, 0x74, 0x75, 0xB2, 0xE4, 0xA4, 0x9F, 0x0B, 0x1E, 0xE9,
+    0x82, 0x9A, 0x19, 0xDB, 0x3D, 0xE4, 0xA3, 0x7A, 0x3E, 0x21, 0x65, 0xC4, 0xB7, 0x82, 0xD8, 0x8E,
+    0xE6, 0x10, 0x57, 0x3A, 0x9F, 0xC0, 0x8F, 0x22, 0xAA, 0x01, 0x9E, 0x4C, 0x57, 0xF9, 0xBA, 0x57,
+    0x50, 0xA1, 0xE4, 0x16, 0x76, 0xF7, 0xBE, 0x15, 0x04, 0x66, 0x53, 0x16, 0x2A, 0xC4, 0x19, 0xDA,
+    0xA5, 0x15, 0x32, 0xD3, 0xAE, 0xDD, 0xCB, 0xA1, 0xAE, 0xC6, 0xE5, 0xEC, 0x0D, 0xE4, 0xEA, 0x46,
+    0x90, 0x69, 0x12, 0x48, 0x53, 0xF5, 0x03, 0x4E, 0xEB, 0x9F, 0xA2, 0x69, 0x67, 0x44, 0xD8, 0xAA,
+    0xF0, 0x41, 0x9C, 0xC9, 0x9D, 0x61, 0x81, 0x52, 0x39, 0xD1, 0x9A, 0x2B, 0x07, 0xDA, 0x10, 0x9D,
+    0xFE, 0xAA, 0xD8, 0x27, 0xB8, 0xB1, 0xBD, 0x9E, 0x6B, 0xB2, 0x18, 0xE5, 0xBB, 0x2D, 0xD9, 0xBA,
+    0xCD, 0xE2, 0xC3, 0x8B, 0xEA, 0xAD, 0xB1, 0x64, 0x38, 0x4A, 0xF1, 0x32, 0x14, 0x65, 0x26, 0x81,
+    0xE8, 0xAE, 0x18, 0xE8, 0x01, 0xB7, 0x0A, 0x65, 0xAF, 0x30, 0xAF, 0x38, 0xE1, 0x74, 0x3B, 0xFF,
+    0x51, 0xF1, 0x32, 0x02, 0x73, 0x7B, 0x22, 0x5F, 0x28, 0x6D, 0xC9, 0xCC, 0x6B, 0x57, 0xA9, 0xBE,
+    0xEB, 0xF5, 0x93, 0x40, 0x5B, 0xB3, 0xDF, 0x3D, 0x08, 0x94, 0x7D, 0x0D, 0xAF, 0x62, 0x63, 0xDA,
+    0x4B, 0x3B, 0xBE, 0x14, 0x7F, 0x3D, 0x7D, 0x78, 0xC1, 0xB4, 0x03, 0x37, 0xA2, 0x0F, 0x14, 0xBC,
+    0xD0, 0x83, 0x80, 0x70, 0x0B, 0x20, 0xB4, 0x6D, 0x41, 0x07, 0x94, 0x40, 0x88, 0xA4, 0x51, 0x57,
+    0x23, 0xB7, 0x4F, 0x72, 0x06, 0x10, 0xAC, 0x5F, 0x48, 0x6C, 0x96, 0x9A, 0x7F, 0x1B, 0x19, 0x37,
+    0x67, 0x0C, 0x95, 0x4C, 0x28, 0xCE, 0x92, 0x45, 0x9F, 0xEC, 0x7E, 0xB3, 0xF2, 0x45, 0x35, 0x36,
+    0xAD, 0x34, 0xA5, 0xB9, 0xA5, 0xCC, 0x66, 0xE6, 0x14, 0x5B, 0x58, 0x5F, 0xBF, 0xF0, 0x27, 0x41,
+    0xD7, 0xCB, 0xAF, 0x6D, 0xDF, 0xC9, 0xC5, 0x5F, 0x82, 0x78, 0x47, 0xDA, 0x90, 0x23, 0xF3, 0xD8,
+    0xBD, 0x0F, 0x30, 0xC8, 0x45, 0xC6, 0x71, 0x45, 0x24, 0x49, 0x6E, 0xA2, 0x29, 0x03, 0x45, 0x51,
+    0xB0, 0x3C, 0x96, 0xA8, 0x5B, 0x9B, 0x46, 0x35, 0x18, 0xF4, 0xCE, 0xF2, 0x05, 0x9A, 0x67, 0xB4,
+    0xE4, 0xCC, 0x17, 0x41, 0xFF, 0x12, 0x70, 0x6E, 0xD2, 0xA0, 0x72, 0x3B, 0xE5, 0x1C, 0x70, 0x7C,
+    0x92, 0x52, 0xB7, 0xA6, 0x35, 0x41, 0x0D, 0xE8, 0xEB, 0x68, 0xE4, 0xD7, 0x77, 0xD1, 0x07, 0x03,
+    0x90, 0x8B, 0xF7, 0xF5, 0x7B, 0xEB, 0x5F, 0xC2, 0xA4, 0xEA, 0xAA, 0x43, 0x38, 0xAE, 0xBD, 0x39,
+    0x8A, 0x0A, 0xBA, 0xB1, 0x37, 0x87, 0x32, 0x58, 0xE2, 0x12, 0xB4, 0x75, 0x2A, 0xA1, 0x7F, 0x74,
+    0x66, 0x8A, 0x19, 0xCF, 0x94, 0xC2, 0xD8, 0xBF, 0x86, 0x10, 0x8F, 0x7B, 0x92, 0x12, 0xAF, 0x68,
+    0x5F, 0x0A, 0x07, 0x27, 0xA8, 0x1D, 0xF7, 0x4F, 0x19, 0xAE, 0xF5, 0xB5, 0x77, 0x70, 0xA7, 0xCF,
+    0x5A, 0xF3, 0xDE, 0x6B, 0x48, 0xC0, 0x99, 0xC6, 0xE2, 0xB1, 0x29, 0x5F, 0x8C, 0x8E, 0x92, 0xD5,
+    0xBD, 0x7E, 0xDA, 0x21, 0x28, 0xBC, 0x23, 0x35, 0xCB, 0xF1, 0x0E, 0xD7, 0x8F, 0x6A, 0x54, 0x0C,
+    0xE9, 0xD8, 0x0E, 0x6F, 0x87, 0x88, 0xAC, 0x78, 0x21, 0x8F, 0x47, 0xB3, 0xE4, 0xD1, 0x2E, 0xDD,
+    0x87, 0xD9, 0xF7, 0xF0, 0x0E, 0xCA, 0x3F, 0x8A, 0x22, 0x73, 0xF3, 0xF9, 0x58, 0x0C, 0xB6, 0x71,
+    0x45, 0xD0, 0xC1, 0x65, 0x09, 0x4F, 0x53, 0x8F, 0x06, 0x27, 0x4F, 0x4C, 0x35, 0x2C, 0x52, 0x98,
+    0xF5, 0xFB, 0xA0, 0xB6, 0x3C, 0x61, 0x15, 0x0A, 0xB4, 0x04, 0x9B, 0xF1, 0xA9, 0x3C, 0x07, 0x2D,
+    0xE6, 0xA0, 0x40, 0x61, 0x40, 0xC7, 0xB3, 0x21, 0xDC, 0x46, 0x07, 0x46, 0x81, 0xEC, 0x66, 0x4F,
+    0x95, 0x74, 0xEA, 0x57, 0x90, 0x6F, 0xC4, 0x26, 0xA3, 0xA4, 0xEE, 0x66, 0x44, 0x21, 0xB9, 0x75,
+    0x48, 0x30, 0xF7, 0xB9, 0xB4, 0xA3, 0xEA, 0xA2, 0x72, 0xA0, 0x26, 0x14, 0xF7, 0x37, 0x35, 0x37,
+    0x46, 0x54, 0xD6, 0xA3, 0x33, 0xD7, 0x81, 0x75, 0x80, 0x2B, 0xF5, 0x27, 0x9A, 0x01, 0xE3, 0x2D,
+    0xF5, 0xF5, 0x77, 0x41, 0x9F, 0xC7, 0x72, 0x00, 0x19, 0x4B, 0xE1, 0xE3, 0xB8, 0xD2, 0xE6, 0x3F,
+    0x50, 0x81, 0x6E, 0x87, 0x09, 0x32, 0x81, 0xEC, 0x26, 0xF3, 0xDB, 0x2E, 0x6F, 0x42, 0x8E, 0x27,
+    0x98, 0xAF, 0xA6, 0xED, 0xDB, 0x11, 0x9B, 0x0B, 0x54, 0xB8, 0xCA, 0xA3, 0xC1, 0xFE, 0x0B, 0xAA,
+    0xFF, 0x1E, 0x7F, 0x01, 0xB5, 0x55, 0xBF, 0x6F, 0x1E, 0x45, 0x10, 0x9D, 0xBD, 0x93, 0x7D, 0x12,
+    0x57, 0x6C, 0xE3, 0x0E, 0x29, 0xDB, 0x22, 0xA4, 0xE8, 0xFE, 0x03, 0xF6, 0x14, 0x17, 0x14, 0x14,
+    0x76, 0x91, 0x88, 0x82, 0x02, 0xCA, 0xC8, 0x0D, 0x2D, 0xA2, 0xC8, 0x1D, 0xA6, 0xA4, 0x08, 0x0D,
+    0xD4, 0x2E, 0x52, 0x98, 0x2F, 0x85, 0x1B, 0xEA, 0xEC, 0x22, 0x8A, 0x14, 0x29, 0x38, 0x0B, 0x21,
+    0xB7, 0x17, 0xC2, 0x0F, 0x29, 0x14, 0x5E, 0x9C, 0x13, 0x39, 0x59, 0x7B, 0x37, 0xBC, 0xD9, 0xBB,
+    0xD8, 0x22, 0xD0, 0xF2, 0xC9, 0xFB, 0xE9, 0xDB, 0xDB, 0xDB, 0x79, 0xF3, 0xDE, 0xCC, 0x3C, 0xD3,
+    0xC7, 0x3D, 0x31, 0xE3, 0x2F, 0xB8, 0xC3, 0x68, 0xBD, 0xFD, 0xB0, 0xD3, 0x7F, 0x30, 0xBF, 0x64,
+    0x9E, 0xF8, 0x0E, 0x63, 0xFF, 0x24, 0x54, 0xA7, 0xEC, 0x42, 0xC5, 0x21, 0xE3, 0x9E, 0xE4, 0x93,
+    0x9D, 0x1E, 0x51, 0x36, 0x4E, 0x44, 0x8F, 0x2C, 0xD1, 0x96, 0xAA, 0xD3, 0x43, 0xC5, 0xBF, 0x50,
+    0xC1, 0xDC, 0x62, 0x0D, 0xF9, 0x9C, 0x71, 0x3E, 0x51, 0xF5, 0xDD, 0x4C, 0xC5, 0xE0, 0x88, 0x26,
+    0xFB, 0x7C, 0xC3, 0x7B, 0xCC, 0x7C, 0x86, 0xF5, 0xD7, 0x74, 0xE7, 0xFD, 0x88, 0x87, 0x6C, 0x3A,
+    0x72, 0xEF, 0x8E, 0x64, 0x3D, 0xD7, 0x4D, 0x67, 0x98, 0xFB, 0x0C, 0x8B, 0x0C, 0xB7, 0x29, 0x1E,
+    0x7D, 0x72, 0x93, 0xAC, 0xF1, 0xFA, 0x71, 0xAF, 0xEA, 0x7D, 0xD9, 0xBF, 0x89, 0x57, 0xD9, 0x5B,
+    0x8E, 0x55, 0xEF, 0x74, 0xD0, 0x67, 0x43, 0x7E, 0x29, 0x39, 0x32, 0x37, 0x3F, 0x35, 0x3F, 0x04,
+    0x7D, 0x11, 0xCB, 0xA1, 0x39, 0x8F, 0x25, 0x47, 0x72, 0x63, 0x0A, 0xF0, 0x46, 0xD1, 0x92, 0xDD,
+    0xF3, 0x64, 0xB5, 0xA7, 0xAD, 0xAD, 0x25, 0x49, 0x37, 0x51, 0x8E, 0x24, 0x05, 0x49, 0x7D, 0x59,
+    0x05, 0xA2, 0x72, 0x20, 0xCA, 0xC7, 0xB4, 0x0E, 0x1E, 0x8E, 0x50, 0x41, 0xD6, 0x40, 0x9B, 0x13,
+    0x9C, 0x69, 0x2C, 0x03, 0xCA, 0xD6, 0x7F, 0xA4, 0xB8, 0x6D, 0x20, 0x52, 0x83, 0xE3, 0x8A, 0xBB,
+    0x25, 0xC1, 0x6F, 0xDF, 0xCA, 0xE2, 0x94, 0x8D, 0x91, 0xF6, 0x77, 0xB0, 0xDB, 0x9E, 0x49, 0x73,
+    0x57, 0x72, 0xA0, 0x62, 0xA4, 0x3C, 0xE2, 0x2F, 0xE7, 0x58, 0x70, 0x54, 0x1F, 0x8C, 0x10, 0x81,
+    0x4C, 0xF8, 0x94, 0xBB, 0x06, 0x51, 0xA6, 0x74, 0x77, 0x7B, 0x73, 0x44, 0xA2, 0x3A, 0xEE, 0x2C,
+    0x9A, 0x96, 0x01, 0x30, 0x4D, 0x5D, 0x0E, 0xF9, 0x40, 0x4C, 0xB6, 0xAD, 0xBA, 0x2C, 0x22, 0x27,
+    0xE3, 0x45, 0x3E, 0x24, 0xA1, 0x9F, 0x45, 0x22, 0xD7, 0xD4, 0xD0, 0x18, 0x59, 0x59, 0x6C, 0x32,
+    0x11, 0xCA, 0x60, 0x93, 0x4B, 0x48, 0xE7, 0x49, 0xB0, 0x09, 0x04, 0xF1, 0x83, 0x5E, 0x7D, 0x04,
+    0x07, 0x79, 0x00, 0x6B, 0xC1, 0x55, 0xC7, 0xB4, 0x21, 0x47, 0x4D, 0x6B, 0xBC, 0xF5, 0x45, 0x40,
+    0xE0, 0x49, 0x90, 0x77, 0x47, 0xD2, 0x3F, 0xC7, 0xB5, 0xA8, 0x40, 0x34, 0x4E, 0x80, 0x3C, 0xAE,
+    0x81, 0xAB, 0x15, 0x29, 0x56, 0x99, 0x32, 0x01, 0x9E, 0x09, 0x22, 0x2C, 0x30, 0x59, 0x0A, 0x9B,
+    0x7D, 0x06, 0x12, 0x33, 0x9A, 0x41, 0xFF, 0x88, 0x77, 0x77, 0x76, 0x16, 0x6C, 0x07, 0x0D, 0xC0,
+    0xDC, 0xD5, 0xB6, 0xD6, 0x21, 0x1F, 0xF1, 0x6A, 0xE5, 0x6D, 0xAB, 0x22, 0x00, 0xF5, 0xE9, 0x2C,
+    0x17, 0x90, 0xF3, 0x4B, 0x04, 0x6E, 0x10, 0x28, 0x17, 0xB4, 0x6A, 0x94, 0x3E, 0xC2, 0x55, 0x0B,
+    0xD8, 0x52, 0x08, 0x27, 0x18, 0x6C, 0x5C, 0xB8, 0x62, 0x04, 0xAC, 0x7C, 0xC0, 0x59, 0x94, 0xE6,
+    0x5B, 0xCA, 0x4A, 0x07, 0xF4, 0x76, 0x5B, 0x79, 0xD3, 0x17, 0x41, 0x07, 0x15, 0x51, 0x00, 0x7B,
+    0x2B, 0x92, 0xEE, 0x66, 0xE4, 0xEC, 0xA4, 0x4D, 0x6B, 0xAA, 0x4E, 0x3C, 0x15, 0xE7, 0x1D, 0xC2,
+    0x8B, 0x7C, 0x00, 0xD5, 0x71, 0x55, 0x6E, 0x4E, 0xA9, 0x62, 0xB5, 0x80, 0xF2, 0x90, 0x15, 0x89,
+    0xB8, 0xFA, 0x4A, 0xC1, 0xF2, 0x22, 0x92, 0x8A, 0x0D, 0xD1, 0x3B, 0x68, 0xA3, 0xF2, 0xF0, 0x7F,
+    0xAD, 0x56, 0xFA, 0xE8, 0x17, 0x28, 0x84, 0x00, 0xDE, 0xD3, 0x2D, 0xE9, 0x5B, 0xDD, 0x75, 0xDD,
+    0x84, 0xA1, 0x8A, 0xE8, 0x2D, 0xE3, 0x9B, 0x36, 0x15, 0x4E, 0x28, 0xD2, 0x5C, 0x21, 0xDA, 0xB3,
+    0x61, 0xA9, 0x9C, 0x70, 0xA4, 0x46, 0xB8, 0x71, 0xBD, 0x94, 0x2E, 0x01, 0xDA, 0x36, 0x25, 0x9D,
+    0x6A, 0x57, 0x26, 0x86, 0x6B, 0xEF, 0x13, 0xDD, 0x28, 0x6B, 0x9A, 0x1A, 0xCA, 0xFF, 0x1C, 0x49,
+    0x2D, 0xB3, 0x8C, 0x7A, 0x3D, 0x9D, 0xC8, 0x7E, 0x11, 0xD4, 0x64, 0x7D, 0x19, 0x66, 0xB2, 0x8F,
+    0x07, 0x9A, 0x4D, 0x87, 0x59, 0xAE, 0xE1, 0x05, 0x5F, 0x33, 0x46, 0x08, 0xAD, 0x8D, 0x81, 0x7D,
+    0x04, 0xA1, 0xA4, 0x25, 0x24, 0x34, 0xAA, 0x29, 0x5A, 0xA2, 0xE2, 0x48, 0x34, 0x8D, 0xAF, 0x3E,
+    0x0B, 0x04, 0x22, 0x6B, 0xD4, 0x63, 0x75, 0x5C, 0xF9, 0xEA, 0x7B, 0xE8, 0x64, 0x5B, 0xFB, 0xF9,
+    0x58, 0x0E, 0xB6, 0xE6, 0x3C, 0xDA, 0x60, 0x19, 0x6E, 0x71, 0xDE, 0x15, 0x4F, 0x63, 0xBA, 0x08,
+    0x7A, 0x92, 0xAD, 0x84, 0x71, 0x1C, 0x80, 0xE4, 0xB5, 0x0C, 0xDE, 0x57, 0xFB, 0xEA, 0xBF, 0x71,
+    0x78, 0x69, 0x4C, 0x2D, 0xB4, 0x97, 0x64, 0x30, 0x86, 0x70, 0x0A, 0x9C, 0xC8, 0x6F, 0x19, 0xDF,
+    0x9A, 0xD4, 0x74, 0x7D, 0x57, 0xD4, 0xDC, 0x6C, 0x30, 0x7C, 0xF0, 0x92, 0x60, 0x7E, 0xBD, 0x8D,
+    0xE7, 0x82, 0x39, 0x27, 0x58, 0x78, 0xD2, 0xBA, 0x87, 0x09, 0xA0, 0x6E, 0x06, 0x71, 0x0C, 0xE4,
+    0x95, 0x9E, 0x43, 0xCB, 0x01, 0x43, 0xEE, 0x17, 0x87, 0x52, 0x15, 0xB8, 0x13, 0xBE, 0xE3, 0x3D,
+    0x79, 0xB2, 0x58, 0x14, 0x2D, 0x03, 0x52, 0x79, 0x71, 0x0E, 0xE9, 0x0B, 0x44, 0x12, 0x68, 0xD3,
+    0x0B, 0x78, 0x53, 0x03, 0x1E, 0xE7, 0xBC, 0x0F, 0x67, 0xC9, 0x31, 0x90, 0xB6, 0x35, 0x3C, 0xE3,
+    0xDC, 0x9D, 0xC0, 0xBB, 0xF2, 0x58, 0x8E, 0xD6, 0xEB, 0xDE, 0xF4, 0x60, 0x5B, 0x37, 0xBB, 0xA3,
+    0x9A, 0xF2, 0xC9, 0x74, 0x65, 0xA8, 0x82, 0x03, 0x1D, 0xDE, 0x8D, 0x62, 0x4C, 0x3A, 0x14, 0xE9,
+    0x22, 0x90, 0xEE, 0xDE, 0x20, 0x71, 0x56, 0x5A, 0x26, 0xE1, 0x6A, 0xEA, 0xB2, 0x07, 0x44, 0xDF,
+    0x88, 0x22, 0x13, 0x14, 0x4A, 0xC3, 0x96, 0x45, 0x2D, 0x94, 0x34, 0x7C, 0x79, 0xD4, 0x3C, 0x17,
+    0x83, 0xB9, 0xE4, 0x22, 0x54, 0xBE, 0x79, 0x2F, 0xA0, 0x89, 0xF7, 0xF0, 0xE5, 0x74, 0x5F, 0xFD,
+    0x06, 0x3F, 0xD6, 0x30, 0x57, 0x9F, 0x73, 0xBF, 0xCA, 0xF4, 0x5A, 0x01, 0xB2, 0x6B, 0x11, 0xB7,
+    0xF8, 0x36, 0x72, 0x0A, 0x0A, 0x87, 0xDB, 0xBC, 0x49, 0x7A, 0x89, 0xD2, 0x52, 0x00, 0x7E, 0x90,
+    0x3C, 0xCD, 0xA2, 0xFD, 0x52, 0x01, 0x42, 0xD2, 0x15, 0x77, 0x65, 0xF2, 0x0A, 0x3C, 0xD5, 0xC3,
+    0x2A, 0xD5, 0xC1, 0xA6, 0x05, 0xA0, 0x14, 0x02, 0x55, 0x58, 0x74, 0x83, 0xAF, 0x00, 0x11, 0x0D,
+    0x87, 0x12, 0xBA, 0xE5, 0x32, 0xE8, 0x6A, 0xF6, 0x8A, 0xAF, 0xDB, 0x82, 0x53, 0x28, 0x83, 0xB1,
+    0x9C, 0xD7, 0x48, 0xB6, 0x95, 0x91, 0x17, 0xD5, 0xAB, 0xAE, 0xEA, 0x90, 0x0A, 0xC6, 0x43, 0x07,
+    0x94, 0xAE, 0x78, 0x91, 0x26, 0x41, 0xCC, 0x4B, 0x7C, 0x36, 0xCD, 0x76, 0x2E, 0x93, 0xA8, 0x93,
+    0xDD, 0x88, 0xB3, 0x34, 0xF7, 0x71, 0xC0, 0xA2, 0xD0, 0x54, 0xCC, 0x47, 0xE5, 0x98, 0xA3, 0x29,
+    0x42, 0xD2, 0x40, 0x25, 0xA3, 0x97, 0x1E, 0x5B, 0xFA, 0xA6, 0x49, 0xF7, 0xD0, 0xCB, 0x5A, 0x70,
+    0xF5, 0xB8, 0x82, 0x6F, 0xD2, 0x64, 0xBA, 0x36, 0x1F, 0xF1, 0x02, 0xFE, 0x61, 0xA2, 0x67, 0xFC,
+    0x62, 0x67, 0x6E, 0x35, 0xCF, 0x4A, 0x5A, 0x00, 0x0F, 0xCC, 0xEF, 0x83, 0xA4, 0x85, 0x72, 0xD8,
+    0x59, 0x0F, 0xA2, 0x85, 0xF4, 0x56, 0xD2, 0xB4, 0x10, 0x7A, 0x93, 0xC4, 0x47, 0x82, 0xFF, 0xA6,
+    0x65, 0x5E, 0xA3, 0x75, 0xF1, 0x8A, 0xD6, 0x43, 0xBE, 0x84, 0xCE, 0xCC, 0xB5, 0x92, 0x2F, 0x3A,
+    0xE1, 0xE7, 0x80, 0x4B, 0x16, 0x70, 0x5F, 0xB4, 0x2B, 0x13, 0xAD, 0x91, 0x40, 0x0B, 0xBD, 0x1C,
+    0x60, 0x05, 0xA0, 0x35, 0xFF, 0xD3, 0x6F, 0xFE, 0x06, 0x9D, 0x55, 0xBD, 0x93, 0x15, 0x45, 0x10,
+    0xFF, 0xED, 0x0E, 0x77, 0x8B, 0x0C, 0x38, 0x04, 0x50, 0x96, 0x8A, 0xB5, 0x86, 0x68, 0xC0, 0x12,
+    0x18, 0x10, 0x70, 0x37, 0x8B, 0x06, 0x86, 0x5C, 0xC0, 0x25, 0x26, 0x24, 0x06, 0x14, 0x09, 0xFF,
+    0x00, 0x77, 0xBB, 0x07, 0x81, 0x01, 0x56, 0xC9, 0x9F, 0x70, 0x01, 0x01, 0x75, 0x06, 0x26, 0x06,
+    0x06, 0xBC, 0x7B, 0xC3, 0xBD, 0xC0, 0x80, 0xE0, 0x16, 0x2E, 0xA0, 0x4A, 0xAD, 0x62, 0x50, 0x2C,
+    0xAA, 0x48, 0x18, 0x65, 0xA9, 0x1B, 0x64, 0x76, 0xDB, 0x9E, 0x7D, 0xC7, 0x87, 0x25, 0x67, 0xE0,
+    0xBC, 0xB7, 0xD3, 0xBD, 0xFD, 0x35, 0x3D, 0xD3, 0xBF, 0xED, 0xC1, 0x1A, 0xD6, 0x50, 0x98, 0x71,
+    0x2D, 0x7C, 0x55, 0x83, 0xB4, 0x41, 0x4E, 0x06, 0xEF, 0xD0, 0x03, 0x14, 0x44, 0xA5, 0x24, 0x32,
+    0xC9, 0xB8, 0xBF, 0x3A, 0x08, 0xF3, 0x87, 0x0E, 0xCA, 0xF5, 0xFC, 0x68, 0xA3, 0xDA, 0xCC, 0x03,
+    0x38, 0x80, 0x03, 0x45, 0x58, 0xBD, 0xF3, 0xF5, 0x3E, 0x1C, 0xC5, 0x6A, 0x5A, 0xBF, 0x81, 0x20,
+    0x8E, 0x23, 0x89, 0x51, 0xFD, 0x91, 0xA3, 0x47, 0xDE, 0x6C, 0x32, 0x25, 0x98, 0x39, 0xA3, 0xBB,
+    0x2A, 0x54, 0xE1, 0x05, 0x65, 0xBF, 0x94, 0x28, 0x68, 0xA2, 0x8D, 0xB5, 0xB5, 0xEB, 0xFC, 0xA6,
+    0xA9, 0xAB, 0x28, 0x9C, 0x1F, 0xF8, 0xE1, 0x95, 0x07, 0x4B, 0x78, 0xB0, 0x70, 0x6D, 0x6D, 0x77,
+    0xF9, 0x0D, 0xF1, 0xB3, 0x99, 0xFB, 0x9F, 0xD3, 0xB9, 0xF4, 0xEA, 0xE1, 0xC5, 0x33, 0xBC, 0xF4,
+    0xCC, 0xE2, 0x19, 0x0E, 0x5E, 0x91, 0x3F, 0xBF, 0x76, 0x2D, 0x75, 0xCA, 0x74, 0x99, 0xD3, 0x2B,
+    0x5D, 0xB2, 0x00, 0xA6, 0xA6, 0x93, 0x56, 0x27, 0x3E, 0x29, 0x21, 0x7C, 0x6E, 0x7A, 0xE1, 0x8A,
+    0x3A, 0xA6, 0xAF, 0xD5, 0xC4, 0x85, 0x42, 0x9A, 0x85, 0xD4, 0xCD, 0x0B, 0x17, 0xD4, 0xED, 0x90,
+    0x4F, 0x5A, 0xFD, 0x95, 0xAB, 0x4E, 0xDB, 0xC3, 0x33, 0x65, 0xE6, 0x7A, 0x75, 0x3F, 0xA8, 0x0D,
+    0x5F, 0x5C, 0x76, 0x5A, 0xDA, 0x65, 0x65, 0x0E, 0xCD, 0xB0, 0xFF, 0x38, 0x09, 0xBA, 0xEE, 0x73,
+    0xC3, 0x22, 0x56, 0xA8, 0x9B, 0x6D, 0xDC, 0x53, 0xA5, 0xEE, 0xBA, 0x4E, 0xAB, 0x2D, 0x37, 0x2A,
+    0xB2, 0xFB, 0xED, 0xFC, 0x0C, 0xAF, 0xA4, 0x4B, 0x04, 0x08, 0x0B, 0x55, 0xE2, 0x22, 0x88, 0x1E,
+    0x12, 0x7D, 0xB1, 0x7C, 0x0E, 0x0E, 0x99, 0x41, 0x01, 0x78, 0x64, 0x16, 0xC5, 0x60, 0xE2, 0x90,
+    0x1B, 0xAC, 0x73, 0x64, 0x8E, 0x13, 0x27, 0x8D, 0x28, 0xC3, 0x1C, 0xD2, 0x6F, 0x1F, 0xD5, 0x9A,
+    0x42, 0x46, 0x54, 0xB3, 0x3D, 0xF2, 0x1A, 0x29, 0x13, 0x76, 0x4E, 0x1D, 0x17, 0xBF, 0x13, 0x5C,
+    0xFB, 0x8F, 0x47, 0xD7, 0x21, 0x0D, 0x38, 0x4C, 0x0C, 0x12, 0xD5, 0xB2, 0x2D, 0x82, 0xEE, 0x2B,
+    0xFE, 0xE9, 0xAE, 0x08, 0xB3, 0xAB, 0x7B, 0xF1, 0x36, 0xAB, 0x0A, 0xA7, 0x03, 0x57, 0xCD, 0xAE,
+    0x0F, 0x05, 0x97, 0x97, 0x3B, 0xBD, 0x15, 0xF6, 0xE0, 0x18, 0x96, 0xC6, 0x2B, 0x44, 0x97, 0x68,
+    0x9C, 0x74, 0x87, 0x70, 0xF0, 0x18, 0x7E, 0x48, 0x7F, 0xED, 0x65, 0xAB, 0x37, 0xBD, 0x6E, 0x88,
+    0x31, 0x27, 0xFC, 0x21, 0x2C, 0x24, 0x6C, 0x1E, 0xF4, 0xC4, 0xEF, 0x89, 0xE5, 0xFE, 0x69, 0x57,
+    0x1C, 0x45, 0xC2, 0x23, 0x21, 0xFB, 0x1F, 0x18, 0x62, 0x02, 0x28, 0x9A, 0x8E, 0x7D, 0x58, 0x7D,
+    0xD3, 0x9F, 0x0D, 0x7A, 0xB3, 0x1F, 0x46, 0xED, 0x6E, 0x20, 0x09, 0xC7, 0x05, 0xE3, 0x68, 0x57,
+    0x83, 0x9D, 0x31, 0x1E, 0xCE, 0x0D, 0xE4, 0xE3, 0xF9, 0xA0, 0x1A, 0xE3, 0xC6, 0x50, 0x74, 0xB3,
+    0xC4, 0x24, 0x9F, 0xB8, 0x79, 0x26, 0x99, 0x0D, 0x3A, 0x02, 0xB9, 0x5D, 0xE6, 0x62, 0x00, 0x23,
+    0x7D, 0xF6, 0x8A, 0x4D, 0x7D, 0xFE, 0x78, 0xF3, 0x1E, 0x09, 0x9A, 0xD0, 0xBD, 0xCD, 0xC7, 0x5B,
+    0xCF, 0xDB, 0xEA, 0xD6, 0xDD, 0x3F, 0x9F, 0x86, 0x65, 0x64, 0xBF, 0xB5, 0xA3, 0x51, 0x5E, 0x33,
+    0x54, 0x8A, 0x4A, 0x36, 0xC2, 0x69, 0xB5, 0x39, 0x71, 0x69, 0xAB, 0x26, 0x4F, 0x5C, 0x48, 0xBC,
+    0xD8, 0x6E, 0xBB, 0x8E, 0x57, 0x1A, 0x87, 0x82, 0x98, 0x28, 0x2F, 0x7A, 0xFC, 0x6B, 0x14, 0x16,
+    0xF3, 0x03, 0xA3, 0xA8, 0x56, 0x66, 0x38, 0xB1, 0x3E, 0x70, 0x3D, 0xF1, 0x2A, 0x33, 0x4E, 0x8A,
+    0xB1, 0x58, 0x0F, 0xDC, 0x32, 0x23, 0x74, 0x60, 0xE4, 0x6D, 0x3F, 0x9A, 0x46, 0xD8, 0x49, 0x11,
+    0xEB, 0xD9, 0xF3, 0x27, 0xDB, 0x64, 0x68, 0xA8, 0x6C, 0xE8, 0x3B, 0x3D, 0x3E, 0x4D, 0xB7, 0xA9,
+    0x38, 0x7B, 0xEB, 0xEE, 0x1F, 0xCF, 0x5E, 0xE6, 0xFA, 0xDD, 0xE7, 0x16, 0x41, 0xCB, 0x7B, 0x1B,
+    0xDB, 0x6E, 0x04, 0xCD, 0x89, 0x07, 0xAD, 0x55, 0x23, 0x9B, 0x98, 0xF9, 0xAB, 0xA4, 0x75, 0x55,
+    0x6B, 0x46, 0x94, 0xA4, 0x0D, 0xE2, 0x0F, 0x07, 0x54, 0x6B, 0x2B, 0xFD, 0x6B, 0x49, 0x77, 0x6C,
+    0xE7, 0x64, 0xA3, 0xD8, 0x8A, 0xFB, 0x40, 0xA7, 0x4C, 0x7E, 0xA9, 0x15, 0xAE, 0xC2, 0x48, 0x19,
+    0xB5, 0xC2, 0xDC, 0x3C, 0x8E, 0xCE, 0xD6, 0x51, 0x71, 0xD3, 0x27, 0xBE, 0xF8, 0xCC, 0xB1, 0x4E,
+    0x5A, 0xD9, 0x84, 0x41, 0x5D, 0xF0, 0xBA, 0x76, 0x29, 0x5A, 0x9C, 0x63, 0xC0, 0x57, 0xE8, 0xE0,
+    0x53, 0x27, 0x9A, 0xD9, 0x92, 0x0D, 0x33, 0xB7, 0x1E, 0xC3, 0xB1, 0x55, 0xEA, 0x34, 0xE6, 0x32,
+    0x33, 0x5B, 0x5E, 0x63, 0x71, 0x05, 0xF6, 0xEF, 0x62, 0xBC, 0x00, 0x9F, 0x7F, 0xEA, 0x58, 0x29,
+    0xAC, 0x68, 0x2E, 0xCA, 0xA8, 0x1F, 0xEA, 0x7B, 0x00, 0xAA, 0xCE, 0x9C, 0xF8, 0x25, 0xFD, 0xF1,
+    0x94, 0xB5, 0xEE, 0xC4, 0xF7, 0x0A, 0x38, 0xC8, 0x5F, 0x9A, 0x72, 0xFC, 0x6B, 0xA5, 0x17, 0x5C,
+    0x05, 0x28, 0x9B, 0x06, 0x54, 0x78, 0x0B, 0x28, 0xA5, 0x51, 0x56, 0x3A, 0xC1, 0x72, 0x11, 0x94,
+    0x2B, 0x9A, 0x71, 0xB9, 0x8C, 0xBD, 0x1C, 0x86, 0x31, 0x0D, 0x2E, 0xC3, 0x5E, 0x84, 0xAC, 0x95,
+    0x46, 0x9B, 0xC0, 0x46, 0x61, 0x8F, 0x74, 0xD0, 0x86, 0x27, 0xC1, 0xAF, 0x5C, 0x95, 0x5B, 0x0E,
+    0xEF, 0x09, 0x72, 0x1F, 0x29, 0xAB, 0x5D, 0x3E, 0xF1, 0x92, 0x6D, 0x6F, 0x48, 0x32, 0x1E, 0x72,
+    0x9B, 0x61, 0x25, 0x9D, 0xAE, 0x11, 0x63, 0x23, 0xBA, 0xD5, 0xD2, 0x15, 0xBC, 0x8C, 0xCB, 0x1B,
+    0x8D, 0xE3, 0x59, 0x2B, 0x18, 0x53, 0x5F, 0xC6, 0x12, 0x67, 0x5E, 0xFA, 0xA2, 0x29, 0x1A, 0x02,
+    0x0D, 0x39, 0x58, 0x65, 0xAB, 0xB2, 0x3A, 0x15, 0x52, 0x5E, 0x22, 0x46, 0xD0, 0x35, 0x6F, 0x57,
+    0xF0, 0xC1, 0xE5, 0x66, 0xE7, 0xCC, 0x53, 0x27, 0xEB, 0xDC, 0x8E, 0xCB, 0xF1, 0xE5, 0x2E, 0x89,
+    0x79, 0x94, 0x33, 0x53, 0xFC, 0x74, 0x92, 0xFA, 0x9C, 0xBB, 0xEE, 0xC3, 0xB6, 0x38, 0x6D, 0x42,
+    0x25, 0xB6, 0x3D, 0x23, 0x49, 0xFB, 0x84, 0xE2, 0xFA, 0x03, 0x86, 0x23, 0x5A, 0x6A, 0x8C, 0x4B,
+    0xD1, 0x45, 0x11, 0xBB, 0x1D, 0x5E, 0x5C, 0xD4, 0xD4, 0x57, 0xD4, 0x4D, 0x95, 0x02, 0xD8, 0x7F,
+    0x02, 0x62, 0xC5, 0x26, 0x56, 0x3E, 0xF2, 0x78, 0xFF, 0x19, 0x70, 0xE1, 0x2A, 0x77, 0x28, 0xB4,
+    0x89, 0xB5, 0xF8, 0x60, 0x15, 0x69, 0xFD, 0xB2, 0xF2, 0x27, 0x19, 0xA8, 0x9C, 0xBF, 0x9D, 0x72,
+    0xE5, 0x0B, 0x4E, 0x32, 0xE7, 0x86, 0x4E, 0x15, 0x4F, 0x68, 0xBB, 0xC4, 0xC9, 0x4F, 0x90, 0x5D,
+    0xAE, 0xE1, 0x4E, 0x62, 0x2E, 0x35, 0xAF, 0x21, 0x27, 0xD9, 0x81, 0xD1, 0xF2, 0x30, 0x7F, 0x98,
+    0x4F, 0xA1, 0x7F, 0x65, 0x30, 0x91, 0xF4, 0xFB, 0x42, 0xA4, 0x17, 0x28, 0x0C, 0x62, 0xCE, 0x60,
+    0x68, 0x20, 0x37, 0xE3, 0x26, 0x92, 0x6E, 0xEA, 0xD9, 0xC7, 0xAF, 0x13, 0xEF, 0x4A, 0x69, 0xF9,
+    0x1C, 0x65, 0x93, 0x34, 0xB1, 0x0B, 0xBA, 0x81, 0xB5, 0x1E, 0xE2, 0x8E, 0x03, 0x8D, 0x90, 0xF6,
+    0x3E, 0xDE, 0x86, 0x86, 0xEF, 0x14, 0xA6, 0x8E, 0x2F, 0x01, 0xA3, 0xBA, 0xEB, 0xD0, 0x4F, 0x57,
+    0xF3, 0xC7, 0x9C, 0xE5, 0x08, 0x6A, 0xCB, 0x42, 0x7F, 0x63, 0x12, 0xC7, 0xED, 0x76, 0x83, 0x1B,
+    0xF6, 0x31, 0x8E, 0xB9, 0xF4, 0x2A, 0x4B, 0xDD, 0xE9, 0xE9, 0x7D, 0x96, 0x97, 0x43, 0x9B, 0x45,
+    0xFC, 0x32, 0x63, 0x5B, 0xCD, 0x1A, 0xC4, 0x16, 0x3E, 0xF4, 0xE3, 0xB8, 0x6A, 0x12, 0x9B, 0x7D,
+    0x4C, 0x2C, 0x1A, 0x8F, 0x76, 0xF6, 0xA5, 0x77, 0x9E, 0xE2, 0x35, 0x67, 0x7E, 0xF3, 0x20, 0x9B,
+    0xFD, 0x55, 0x16, 0x35, 0x1B, 0xB2, 0x3F, 0x4B, 0xAB, 0xD8, 0xA0, 0xD5, 0x03, 0xE8, 0x41, 0xF5,
+    0x14, 0xAC, 0xEA, 0x5E, 0xB6, 0xFF, 0xB4, 0x85, 0x7A, 0x84, 0x58, 0xC8, 0xE6, 0x1F, 0x0D, 0xE3,
+    0x6F, 0x9D, 0x55, 0x3D, 0x6C, 0xDD, 0x54, 0x14, 0xFE, 0x6C, 0x27, 0x35, 0xC4, 0x88, 0x9B, 0x21,
+    0x1D, 0x2A, 0x40, 0x5E, 0x18, 0x42, 0x86, 0x98, 0x05, 0xA9, 0x43, 0xFB, 0xAE, 0x43, 0x85, 0x18,
+    0x3A, 0x90, 0x21, 0x11, 0x6C, 0x59, 0x3A, 0x20, 0x96, 0x30, 0x30, 0xA4, 0x52, 0x1B, 0x5B, 0xAD,
+    0x44, 0x86, 0x0E, 0x64, 0x61, 0x6E, 0x06, 0xA6, 0xB7, 0x74, 0xED, 0x90, 0x17, 0xBB, 0xCD, 0x50,
+    0x89, 0x0C, 0x35, 0x20, 0xD4, 0xA1, 0x43, 0x8C, 0xA8, 0xF4, 0x24, 0x32, 0xD4, 0xA2, 0x86, 0x3A,
+    0x8D, 0xED, 0xC3, 0x77, 0xFD, 0x48, 0xD3, 0x44, 0x8D, 0x90, 0xF0, 0x7B, 0xBE, 0xC7, 0xBE, 0xE7,
+    0xDC, 0xF3, 0x9D, 0x7F, 0x43, 0x57, 0x96, 0x64, 0x67, 0x12, 0xA0, 0x86, 0x5B, 0x20, 0x88, 0xD1,
+    0xC0, 0x29, 0xA0, 0xD2, 0xF1, 0x2D, 0x44, 0x86, 0x65, 0x45, 0xB0, 0xC8, 0xCA, 0x11, 0x84, 0x14,
+    0x21, 0xCB, 0x4F, 0x27, 0x5A, 0x44, 0xA5, 0x2D, 0x29, 0x46, 0x97, 0x27, 0x61, 0xD0, 0xD8, 0x22,
+    0xB7, 0xA4, 0x75, 0x45, 0x7C, 0xA9, 0xDF, 0xB6, 0x9B, 0xF3, 0x5E, 0x69, 0xD4, 0xF9, 0x19, 0x82,
+    0x14, 0x09, 0xEC, 0x16, 0x5E, 0x85, 0x28, 0xB7, 0x24, 0x76, 0x1B, 0xF8, 0x25, 0x74, 0x0A, 0xE9,
+    0xF4, 0x16, 0xF0, 0x72, 0x83, 0xFA, 0xCA, 0x65, 0xE7, 0xF0, 0xE2, 0x91, 0x04, 0xFF, 0x0E, 0x41,
+    0x2B, 0xA8, 0x1C, 0x16, 0x30, 0xF6, 0x0A, 0xE2, 0xCF, 0x22, 0xB1, 0x10, 0xCF, 0x31, 0x70, 0x64,
+    0xBB, 0x45, 0x14, 0x22, 0xB8, 0x5F, 0x13, 0xCB, 0x2B, 0x08, 0xA5, 0x0D, 0x52, 0x43, 0x35, 0x4E,
+    0x41, 0x1C, 0x3F, 0x25, 0xCC, 0xD6, 0x31, 0x8C, 0x59, 0xC3, 0xAB, 0x89, 0xA0, 0x0A, 0x02, 0xE8,
+    0x98, 0xFA, 0x27, 0x47, 0x4C, 0xAB, 0xB5, 0x25, 0xB3, 0x5B, 0x5F, 0x2A, 0x6A, 0x96, 0x9A, 0x08,
+    0x56, 0x43, 0x49, 0x34, 0x94, 0xB3, 0x6B, 0xB7, 0xA4, 0x2F, 0x84, 0xD0, 0x05, 0x17, 0x89, 0x55,
+    0xEE, 0x34, 0x50, 0x99, 0x6B, 0x62, 0x46, 0x8C, 0xA3, 0x2B, 0x30, 0x5E, 0x44, 0x71, 0x90, 0x21,
+    0x89, 0x75, 0x86, 0xC8, 0x44, 0x62, 0x0C, 0xE3, 0xC0, 0x57, 0xFD, 0xFE, 0x92, 0xC8, 0x50, 0xA4,
+    0x32, 0x11, 0xA0, 0x8D, 0xE4, 0x41, 0x87, 0x26, 0x0A, 0x7E, 0x6A, 0x3C, 0xA5, 0x5E, 0xA7, 0x24,
+    0x52, 0xC7, 0x8E, 0xA4, 0xA2, 0x97, 0xC5, 0xD5, 0x44, 0xD6, 0xD6, 0xA4, 0x5E, 0x89, 0xE4, 0xD1,
+    0x9A, 0x34, 0x47, 0xE4, 0xC1, 0x68, 0xF3, 0xD3, 0x35, 0xC9, 0x56, 0xAE, 0xCE, 0xBB, 0x6B, 0x31,
+    0x56, 0x56, 0x70, 0x2A, 0xE9, 0xBC, 0xEB, 0xF7, 0x63, 0x91, 0x3A, 0x90, 0xBD, 0x6D, 0xA9, 0x2F,
+    0x44, 0xB2, 0xBD, 0x43, 0x92, 0xBC, 0x24, 0x0F, 0x48, 0xB4, 0x3C, 0xBA, 0x47, 0x11, 0xE6, 0x34,
+    0x9D, 0xE9, 0xFF, 0xE0, 0x10, 0xBE, 0x47, 0xCE, 0xB6, 0x34, 0xE4, 0xFC, 0xBE, 0x2D, 0xED, 0x31,
+    0xD2, 0x5C, 0xA4, 0x0E, 0x91, 0x52, 0xD3, 0x1F, 0x73, 0x39, 0xB9, 0xA9, 0xA5, 0xF0, 0x22, 0x7A,
+    0x3E, 0x7C, 0xF9, 0x75, 0x2E, 0x91, 0xD2, 0x91, 0xC6, 0x91, 0x4F, 0x9C, 0x83, 0xC2, 0xAE, 0x07,
+    0x78, 0x97, 0x4E, 0x3A, 0x31, 0xAC, 0x52, 0x15, 0x51, 0xDA, 0x20, 0x3C, 0x8A, 0x98, 0xCA, 0x34,
+    0x6A, 0xA7, 0xF0, 0xD2, 0xA0, 0x7B, 0x5D, 0x5E, 0x67, 0xFE, 0x59, 0x03, 0xA5, 0x95, 0x23, 0xC7,
+    0x7B, 0xD8, 0x80, 0x7D, 0xAC, 0x4E, 0xFE, 0xE7, 0xF5, 0x16, 0xF0, 0x21, 0xF1, 0xCF, 0x63, 0x85,
+    0x3F, 0xEF, 0x0F, 0x1A, 0xBD, 0xFC, 0xE4, 0x90, 0x77, 0x9D, 0xF7, 0x2A, 0x10, 0x6F, 0xC2, 0xAA,
+    0x36, 0x61, 0xCB, 0xFE, 0x17, 0x8C, 0x3F, 0xAB, 0x94, 0xB7, 0x5F, 0x4F, 0x21, 0x22, 0xAF, 0xD1,
+    0xC0, 0x34, 0x7B, 0x81, 0x06, 0x8D, 0x8C, 0xA6, 0x4D, 0x2A, 0xC5, 0x14, 0xA9, 0xF6, 0x4D, 0xBA,
+    0x16, 0xC3, 0x77, 0x44, 0x42, 0x5A, 0x1E, 0xD2, 0x67, 0xA8, 0xA7, 0x29, 0xFC, 0x9D, 0x0C, 0x2E,
+    0x3B, 0x07, 0xCE, 0xBA, 0x89, 0x7F, 0xED, 0xED, 0x96, 0x5A, 0xDF, 0x2B, 0x7B, 0x3C, 0xB6, 0x0A,
+    0xDB, 0x14, 0x0E, 0x06, 0x5D, 0x67, 0xC5, 0xA3, 0x0E, 0xEB, 0x3A, 0xCD, 0xCD, 0xEF, 0x6A, 0xEF,
+    0xAF, 0x2A, 0x78, 0x9C, 0x45, 0xA6, 0x30, 0xFB, 0x44, 0x9C, 0xF2, 0x44, 0xD6, 0x71, 0x4D, 0x8B,
+    0xC8, 0x5E, 0xB5, 0x3A, 0x77, 0x87, 0x79, 0xB9, 0x4B, 0xEB, 0xE5, 0x30, 0x2A, 0xE3, 0xF3, 0xEC,
+    0x8C, 0xD4, 0x79, 0xE2, 0x33, 0x5C, 0x17, 0xA6, 0x81, 0xFB, 0xC0, 0x1B, 0x50, 0x3C, 0x5D, 0x86,
+    0xEA, 0xBB, 0x25, 0xB4, 0x07, 0x85, 0x23, 0xB5, 0xB5, 0x2C, 0xDF, 0x27, 0x5D, 0xF9, 0xB5, 0x16,
+    0x33, 0x16, 0x49, 0xAE, 0x76, 0xA3, 0xF0, 0xEB, 0x32, 0x87, 0x22, 0xC4, 0x3C, 0x0C, 0x98, 0xD5,
+    0x98, 0x8E, 0xB5, 0x5A, 0xE0, 0xCA, 0xCB, 0xB0, 0xCD, 0x02, 0x49, 0xC8, 0x52, 0x86, 0x3E, 0x16,
+    0xCD, 0x85, 0x43, 0xE1, 0xC6, 0x08, 0x37, 0xFA, 0xB3, 0x5F, 0x4A, 0xF7, 0xB7, 0x2A, 0xF2, 0x53,
+    0xAD, 0xB6, 0x8B, 0xDA, 0x2E, 0x07, 0xC1, 0xE5, 0x4C, 0xDD, 0xCC, 0xAB, 0x1E, 0x6A, 0xB3, 0x63,
+    0xC7, 0x1B, 0xD3, 0x13, 0xC0, 0xA8, 0xD5, 0xD8, 0x49, 0x6C, 0x13, 0xD3, 0x33, 0x91, 0xA9, 0x82,
+    0x2B, 0x27, 0x33, 0x45, 0x48, 0xFB, 0x6F, 0xEA, 0x55, 0x07, 0x14, 0x8C, 0x1E, 0x72, 0xDE, 0x0C,
+    0x4E, 0x8A, 0x9C, 0x35, 0x01, 0x6D, 0xCC, 0x48, 0x30, 0xC5, 0xC7, 0x71, 0x03, 0x9C, 0x1B, 0xCD,
+    0x89, 0x39, 0xF6, 0x8E, 0xDA, 0xE3, 0xAE, 0x7E, 0xCA, 0x5D, 0xE1, 0xAE, 0xB5, 0x71, 0xF2, 0xF4,
+    0xA6, 0x31, 0xA2, 0x3B, 0x68, 0x8C, 0xD0, 0x27, 0xD9, 0xE3, 0x26, 0xE6, 0x34, 0xCD, 0x79, 0xC1,
+    0x48, 0xF8, 0xCF, 0x69, 0x84, 0xFE, 0x96, 0x5B, 0xEF, 0x8F, 0xF9, 0x3B, 0x2F, 0x9A, 0x99, 0x63,
+    0xA2, 0x57, 0x92, 0xE5, 0x61, 0x39, 0x0F, 0x8B, 0x6C, 0x36, 0x30, 0x47, 0xCA, 0xE8, 0x3E, 0x51,
+    0xB0, 0xB4, 0x76, 0x21, 0x0A, 0xAD, 0x26, 0x89, 0xED, 0xD6, 0xD0, 0x73, 0x27, 0x9D, 0x36, 0xF2,
+    0x87, 0x67, 0x8D, 0x1E, 0xA3, 0x0F, 0x1F, 0x60, 0x64, 0x9C, 0x9D, 0x6B, 0x3B, 0xF7, 0x4A, 0xED,
+    0x95, 0xDD, 0xE2, 0x16, 0x9A, 0x43, 0x67, 0x64, 0x35, 0x97, 0xB3, 0x8B, 0xD1, 0xE2, 0x62, 0xC4,
+    0xD2, 0x90, 0x6E, 0xE9, 0x5E, 0x8F, 0xB8, 0x0E, 0x85, 0xCD, 0x59, 0x55, 0x76, 0x4B, 0xF7, 0xFA,
+    0x2F, 0xB7, 0xC7, 0x1C, 0xF8, 0xC3, 0xAA, 0xE9, 0xB2, 0xA2, 0x97, 0x9E, 0x57, 0x77, 0xCD, 0xD3,
+    0x97, 0xD1, 0x9D, 0x61, 0x39, 0x35, 0xAE, 0x86, 0xB5, 0xBC, 0x69, 0x5D, 0xDA, 0x17, 0x7D, 0x3F,
+    0x0C, 0xDB, 0xE8, 0x61, 0xB1, 0x3E, 0xA9, 0x6F, 0x3F, 0xAB, 0xA7, 0xE1, 0xB5, 0x13, 0xD8, 0x98,
+    0x50, 0x62, 0xD6, 0xD7, 0xFC, 0x69, 0xBE, 0xA4, 0x17, 0x9C, 0x54, 0x9F, 0x2E, 0xE0, 0xB5, 0xEC,
+    0x01, 0xF5, 0x7A, 0x6E, 0x27, 0x80, 0x79, 0x65, 0x57, 0x7A, 0xA7, 0x3D, 0x5D, 0xA0, 0xF8, 0xE8,
+    0xC7, 0x89, 0x99, 0xF8, 0x74, 0x0D, 0x5E, 0xFE, 0x1F, 0x46, 0x4E, 0x42, 0x52, 0xA9, 0xB6, 0x22,
+    0xAD, 0x76, 0x6F, 0x1E, 0xFC, 0xD4, 0x96, 0x5B, 0x03, 0xED, 0xCB, 0x4D, 0x49, 0x83, 0xD8, 0x8A,
+    0x7B, 0x56, 0x3C, 0xE5, 0xA5, 0x95, 0x0A, 0x0B, 0xDF, 0x2E, 0x7A, 0x8E, 0x29, 0xAD, 0xEE, 0x7B,
+    0xA2, 0x38, 0x17, 0xD3, 0x41, 0xE5, 0xFB, 0x97, 0x86, 0x65, 0x22, 0x8F, 0x39, 0x1A, 0x56, 0x71,
+    0xC6, 0xE4, 0x59, 0xB7, 0x8E, 0x64, 0xD7, 0xA0, 0xD6, 0x21, 0xC5, 0x44, 0x62, 0x7A, 0x59, 0xDD,
+    0xF8, 0xBC, 0xD4, 0xAD, 0xB5, 0x15, 0x72, 0xEC, 0x27, 0x85, 0x54, 0x03, 0xF4, 0x26, 0xFD, 0xE4,
+    0xD6, 0xC1, 0x9F, 0xC5, 0xF5, 0x4D, 0x7F, 0xE9, 0xF6, 0xB6, 0x64, 0xE6, 0xCB, 0x67, 0x49, 0x1B,
+    0xF0, 0x3B, 0x5B, 0x33, 0x1D, 0x4C, 0xCA, 0x11, 0x09, 0x6D, 0x8E, 0x8B, 0x29, 0x0E, 0x1E, 0xF7,
+    0x20, 0xDF, 0xEC, 0xB9, 0xC3, 0x4C, 0x97, 0xAE, 0x7C, 0xBC, 0xDF, 0xF5, 0x11, 0xC7, 0x77, 0x18,
+    0xAD, 0x63, 0xDE, 0x96, 0x1B, 0x52, 0xD6, 0xBD, 0x8B, 0xEA, 0xE1, 0xDA, 0x33, 0xA9, 0x66, 0x07,
+    0xD0, 0x67, 0x93, 0xCB, 0x32, 0xB7, 0xCF, 0x19, 0x86, 0x6F, 0x38, 0xA2, 0xA4, 0xD6, 0xD2, 0x3D,
+    0xD8, 0x98, 0xE9, 0x33, 0x25, 0x8B, 0x0B, 0xD2, 0x2C, 0x2E, 0x8C, 0xD6, 0xAE, 0xE2, 0xFE, 0x01,
+    0xA5, 0x55, 0xBD, 0x6F, 0x1C, 0x45, 0x14, 0x7F, 0xBB, 0x23, 0x7B, 0x20, 0x2B, 0x31, 0x29, 0xEC,
+    0x26, 0x08, 0x4F, 0x43, 0x19, 0x32, 0xFF, 0x80, 0x7D, 0x33, 0xC6, 0x45, 0x0A, 0x8A, 0x73, 0x61,
+    0x44, 0x41, 0x61, 0x0A, 0xFA, 0xB4, 0x29, 0x7C, 0xDE, 0x75, 0xAE, 0x48, 0x41, 0x11, 0x37, 0x50,
+    0x92, 0x14, 0x20, 0x45, 0x06, 0x29, 0x8D, 0x25, 0x5C, 0xD8, 0xDE, 0xB5, 0x0F, 0xE9, 0x0A, 0x17,
+    0x1E, 0x14, 0x48, 0x8A, 0x14, 0x99, 0x10, 0x24, 0x8A, 0x14, 0x1E, 0xDB, 0x1B, 0xD8, 0x24, 0xB3,
+    0xFB, 0x78, 0x73, 0x0E, 0xE2, 0x0F, 0x60, 0x4E, 0x6F, 0xE6, 0xE6, 0xEB, 0x7D, 0xFC, 0xDE, 0xEF,
+    0xCD, 0x02, 0x7C, 0xC4, 0x0B, 0xFF, 0x11, 0xAB, 0x6E, 0x66, 0xC6, 0x0B, 0xF0, 0xC2, 0x6C, 0xB3,
+    0x62, 0x06, 0x00, 0x32, 0x33, 0x07, 0xF3, 0xE0, 0x59, 0x25, 0x60, 0x3E, 0x71, 0x99, 0x99, 0x4F,
+    0x1D, 0x6D, 0x4F, 0x01, 0x24, 0x53, 0xF0, 0x53, 0x10, 0x8F, 0x6D, 0x33, 0x2F, 0xF9, 0xA1, 0xDF,
+    0xED, 0x89, 0xA1, 0xAD, 0xE7, 0x05, 0xC0, 0x65, 0xD0, 0x5E, 0xE0, 0xAD, 0x36, 0x68, 0x31, 0xF2,
+    0x61, 0x5D, 0x8C, 0x9F, 0x35, 0xFB, 0xFA, 0x3A, 0x7A, 0x1D, 0x60, 0x9F, 0xF4, 0x81, 0xAC, 0x94,
+    0xCF, 0x83, 0xDA, 0x4F, 0x95, 0x11, 0x15, 0xF3, 0x49, 0x03, 0xEB, 0xA0, 0xCC, 0xA5, 0x02, 0xA6,
+    0x40, 0x05, 0x8E, 0xFE, 0x43, 0x0D, 0xCC, 0xC3, 0x1E, 0x68, 0x23, 0x2C, 0xF7, 0x29, 0x06, 0x8D,
+    0x87, 0x5B, 0xDF, 0xC1, 0x0C, 0xE8, 0xC0, 0xD0, 0x5D, 0xEE, 0x01, 0xB7, 0xB2, 0x4E, 0x3B, 0xA0,
+    0x8B, 0x62, 0xF4, 0x4D, 0xA3, 0x31, 0xD9, 0x37, 0x51, 0x2F, 0x82, 0x72, 0x59, 0x9B, 0x60, 0x35,
+    0x08, 0xA2, 0x3F, 0xFC, 0x8B, 0x36, 0xFE, 0xC4, 0x16, 0x34, 0xA4, 0x9B, 0xB4, 0x59, 0x06, 0x81,
+    0x45, 0x0D, 0x12, 0x52, 0xB4, 0x57, 0xCA, 0x68, 0x40, 0x5F, 0xFA, 0xDC, 0x61, 0x98, 0x7E, 0x05,
+    0x64, 0x57, 0x86, 0x0C, 0x0F, 0x1A, 0xD0, 0x33, 0x0C, 0x7D, 0xFE, 0xE0, 0xB6, 0x6D, 0x06, 0x62,
+    0xF8, 0xA7, 0x57, 0x1D, 0xAC, 0x93, 0xE6, 0x04, 0x3B, 0x85, 0x16, 0x02, 0x39, 0xC9, 0xDD, 0xC5,
+    0xE0, 0x27, 0x43, 0x7A, 0x8F, 0x82, 0x25, 0x7B, 0x5D, 0x18, 0x68, 0x79, 0xF7, 0x16, 0x6E, 0xE0,
+    0x2F, 0xAF, 0x42, 0x50, 0xB9, 0x18, 0xA3, 0xBB, 0xB1, 0x19, 0xB7, 0x36, 0xB0, 0x09, 0xBA, 0x97,
+    0x1D, 0x8F, 0xCF, 0x31, 0xA8, 0x75, 0xD0, 0xB3, 0xE5, 0x27, 0xB8, 0xF8, 0x1A, 0x52, 0xC3, 0x0A,
+    0x56, 0x60, 0x5B, 0xB6, 0x71, 0x4C, 0xCD, 0xD6, 0x7D, 0x6C, 0x67, 0x57, 0xCA, 0x6E, 0x76, 0xE5,
+    0xA2, 0x07, 0xE0, 0xC5, 0x1A, 0xAB, 0xE6, 0x22, 0xEA, 0x73, 0xB0, 0x9D, 0xDA, 0xCC, 0x5C, 0x83,
+    0x9B, 0xE0, 0x93, 0x18, 0x27, 0x37, 0x94, 0x08, 0xA8, 0x99, 0x15, 0x86, 0xD2, 0xC2, 0x0B, 0x4A,
+    0x8A, 0x80, 0x6D, 0xDA, 0x62, 0xCF, 0x2B, 0xC2, 0x4A, 0xDC, 0xB6, 0xF5, 0x9A, 0xC8, 0x0E, 0xFD,
+    0x60, 0x9F, 0xA1, 0x7D, 0x77, 0x06, 0xD2, 0x96, 0xBD, 0x19, 0xB9, 0x97, 0x2F, 0x43, 0xD9, 0x28,
+    0x82, 0xAE, 0x40, 0x3F, 0xBD, 0x09, 0x69, 0xC3, 0x91, 0x16, 0xFD, 0xC2, 0xAE, 0xB8, 0xC1, 0xC7,
+    0x8F, 0x1D, 0xBA, 0xE9, 0x65, 0x48, 0xDD, 0x4E, 0x7A, 0xE6, 0xE1, 0x4D, 0x05, 0xA5, 0xA1, 0x54,
+    0xA5, 0x08, 0xFC, 0xB8, 0x90, 0x9F, 0x54, 0xB3, 0x89, 0xC9, 0x9A, 0x0C, 0x8B, 0xD4, 0x4F, 0xEF,
+    0x6A, 0x54, 0xE2, 0xCE, 0x57, 0x87, 0x04, 0xA2, 0x81, 0xD4, 0x43, 0x0F, 0x98, 0x85, 0x01, 0x29,
+    0xB3, 0x93, 0xFC, 0xFB, 0x48, 0x05, 0x47, 0x7F, 0x37, 0xCC, 0x32, 0xED, 0x8A, 0x02, 0x16, 0x20,
+    0xF1, 0x6B, 0xD9, 0xD8, 0xF6, 0xD6, 0x00, 0x2B, 0x86, 0x20, 0xF7, 0x60, 0x67, 0x97, 0xD9, 0x7A,
+    0x2A, 0xA1, 0x03, 0x3D, 0x66, 0xD7, 0x78, 0xB5, 0x23, 0x8C, 0x97, 0x34, 0x49, 0x0C, 0x5B, 0xBD,
+    0xED, 0x14, 0x96, 0x76, 0x57, 0x8B, 0x25, 0xD7, 0x2C, 0x08, 0x56, 0xF9, 0xB5, 0xC8, 0xAD, 0x9D,
+    0x6B, 0x62, 0xE8, 0xEA, 0x99, 0xA9, 0xC4, 0xBC, 0xB7, 0xCE, 0xF1, 0xF7, 0xBA, 0x69, 0x7A, 0x0B,
+    0x62, 0x95, 0x1F, 0x1D, 0x9C, 0xBB, 0x9D, 0xE5, 0x19, 0x60, 0x77, 0x8B, 0xBC, 0xCD, 0x46, 0xAE,
+    0xEE, 0x09, 0xF6, 0x8B, 0x5F, 0x53, 0x77, 0x87, 0xE8, 0x17, 0xBE, 0xE4, 0x15, 0xAC, 0x41, 0x56,
+    0x00, 0x6F, 0xE4, 0x9E, 0x02, 0x69, 0x79, 0x0D, 0x61, 0x39, 0x94, 0xF5, 0x15, 0x93, 0x98, 0xB9,
+    0x14, 0x57, 0x5B, 0x09, 0x3B, 0x04, 0x22, 0x0C, 0x0C, 0xC2, 0x77, 0x91, 0x3F, 0xC0, 0xB1, 0x60,
+    0xD8, 0x00, 0xA2, 0x91, 0xEE, 0x32, 0x0B, 0x00, 0xF9, 0xE2, 0xA7, 0x9F, 0xF9, 0xB2, 0x2B, 0x05,
+    0x3E, 0xF1, 0xDD, 0x4A, 0xDE, 0xA7, 0x00, 0xB0, 0x56, 0x88, 0x90, 0x23, 0xF1, 0x87, 0x2E, 0x78,
+    0x22, 0x56, 0x0B, 0x19, 0xB1, 0x03, 0xE9, 0x38, 0x88, 0x0F, 0x00, 0xE6, 0xAE, 0xC2, 0x34, 0x4D,
+    0x34, 0x51, 0x0F, 0x91, 0x08, 0x7B, 0x5A, 0x67, 0xED, 0xEF, 0x95, 0x38, 0x1B, 0x15, 0xEA, 0xE1,
+    0x57, 0x46, 0x1F, 0xF5, 0x41, 0x1F, 0xCF, 0x81, 0xFE, 0xF6, 0x2A, 0xE8, 0x1F, 0xE7, 0x89, 0xD2,
+    0xDB, 0xA0, 0xEB, 0x53, 0x90, 0x1D, 0x82, 0x20, 0xC5, 0x2C, 0xCA, 0xD3, 0x4D, 0xE0, 0x7D, 0xA2,
+    0xE5, 0x14, 0x5C, 0xB4, 0x69, 0xFC, 0x83, 0xF4, 0x85, 0x0B, 0x7D, 0x66, 0x9B, 0x93, 0x29, 0x41,
+    0x96, 0xA5, 0x03, 0x50, 0x07, 0xA7, 0x5E, 0x1F, 0xFE, 0xED, 0xF4, 0x08, 0xAD, 0x1E, 0x12, 0x83,
+    0x87, 0xE4, 0xD8, 0x98, 0xE4, 0xC8, 0x81, 0x3A, 0x79, 0x34, 0xD1, 0xC9, 0x49, 0x12, 0x72, 0x67,
+    0xD2, 0x34, 0x36, 0x09, 0xA2, 0xCD, 0x28, 0x48, 0xFD, 0xDB, 0x0A, 0x74, 0x14, 0x44, 0x4D, 0x6A,
+    0x2A, 0x0A, 0x64, 0x6B, 0x93, 0xAC, 0x17, 0x82, 0x4E, 0xE6, 0x5F, 0x2F, 0xA7, 0x64, 0x44, 0xBE,
+    0x34, 0x29, 0xDD, 0xCD, 0x08, 0x93, 0x7F, 0x0F, 0x21, 0xFC, 0xDB, 0x64, 0x67, 0x40, 0x11, 0x0C,
+    0x12, 0x6B, 0x10, 0xF5, 0x3B, 0xC0, 0x1A, 0xAA, 0x14, 0x32, 0x72, 0x09, 0xB7, 0x0C, 0xE9, 0xB1,
+    0xF0, 0xE0, 0xF5, 0xBD, 0xC9, 0xA2, 0xC2, 0x2E, 0xBA, 0x61, 0x40, 0xD3, 0x7D, 0x69, 0x2F, 0x84,
+    0x40, 0x74, 0xB4, 0x58, 0xD3, 0xC9, 0x30, 0x51, 0x37, 0xC9, 0x80, 0x9A, 0x64, 0xA1, 0x82, 0x2B,
+    0x19, 0x11, 0x92, 0x9D, 0xE3, 0x09, 0x16, 0xBA, 0xA4, 0x13, 0xBC, 0x93, 0xAD, 0xB2, 0x65, 0x85,
+    0x8B, 0xAD, 0xF0, 0xC2, 0xCB, 0x0A, 0x93, 0x36, 0x0D, 0xC2, 0xA9, 0x4A, 0x1F, 0xB4, 0x2C, 0xB0,
+    0x46, 0x55, 0x58, 0xE4, 0x4B, 0x41, 0x35, 0xDC, 0xEB, 0x21, 0x9A, 0x92, 0xD5, 0x48, 0xE7, 0x72,
+    0x85, 0x14, 0x20, 0x11, 0x94, 0x5A, 0x13, 0xBB, 0xB9, 0x89, 0xA9, 0x12, 0x76, 0x01, 0x0D, 0xC1,
+    0xB0, 0x58, 0x47, 0x49, 0xF1, 0x96, 0x67, 0x2F, 0x86, 0xFE, 0x7D, 0x7C, 0xD1, 0x90, 0x5B, 0x21,
+    0x7B, 0x72, 0x64, 0xB3, 0xF1, 0x71, 0x95, 0x23, 0xBD, 0x05, 0x24, 0x72, 0xE9, 0xA9, 0x51, 0xEC,
+    0x04, 0x34, 0xB1, 0x57, 0xB3, 0x0E, 0x7A, 0x24, 0x03, 0x46, 0x91, 0xE6, 0x51, 0xA7, 0xC0, 0xD8,
+    0xC7, 0x78, 0x41, 0x3C, 0x22, 0x74, 0x92, 0x90, 0xF9, 0x08, 0x55, 0x99, 0x15, 0xAC, 0x11, 0xA7,
+    0x35, 0xE8, 0xC5, 0x4E, 0xAF, 0xF0, 0xD7, 0xF8, 0x14, 0x49, 0xE3, 0xDF, 0x48, 0x75, 0xD4, 0x0A,
+    0x07, 0xF8, 0x3D, 0xB4, 0x20, 0x2C, 0x88, 0x2A, 0x09, 0x74, 0x27, 0x62, 0xAB, 0x2A, 0x42, 0x2B,
+    0xED, 0x36, 0x75, 0x41, 0xD8, 0x32, 0xC2, 0xBB, 0xB4, 0x6F, 0xA1, 0xA6, 0xF4, 0x03, 0x31, 0x23,
+    0x02, 0x25, 0x27, 0x7D, 0xB9, 0x4A, 0xDB, 0x2C, 0x48, 0x5B, 0x6E, 0x0A, 0x97, 0xF7, 0x29, 0xF5,
+    0x1F, 0xB7, 0x88, 0x49, 0x90, 0xE7, 0xF5, 0x0C, 0x65, 0xB6, 0x6F, 0x29, 0xCD, 0xB5, 0xB6, 0x91,
+    0xC9, 0xA5, 0xE3, 0x2F, 0x5B, 0x28, 0x9D, 0x1A, 0x35, 0x90, 0x57, 0x25, 0xF1, 0x26, 0x27, 0xB8,
+    0x7E, 0x4E, 0x08, 0xBD, 0xFC, 0xDA, 0x0D, 0x9F, 0x2F, 0xB6, 0x25, 0x7E, 0x1C, 0xD8, 0x2B, 0xCA,
+    0xE2, 0x45, 0x63, 0x56, 0x16, 0x03, 0x6E, 0x75, 0xB1, 0x1B, 0xBB, 0xC0, 0x6D, 0xB9, 0x51, 0xF3,
+    0x0A, 0x97, 0x3C, 0x3F, 0x78, 0xB3, 0xE4, 0xB2, 0xD1, 0xC9, 0x75, 0x9B, 0x8D, 0x8E, 0xFB, 0x95,
+    0xC6, 0x0B, 0x7C, 0x08, 0xE8, 0xA7, 0x42, 0x83, 0x78, 0x20, 0x06, 0x20, 0xF6, 0xC4, 0x2E, 0x88,
+    0x20, 0xE8, 0x61, 0x6E, 0x64, 0xA4, 0x85, 0xA4, 0x37, 0xC0, 0x13, 0x4F, 0x85, 0x95, 0x94, 0xFC,
+    0x1C, 0x0B, 0x3E, 0x61, 0xDE, 0x5E, 0xA4, 0xB2, 0xA8, 0xE8, 0xE7, 0x42, 0x12, 0x66, 0x72, 0xFA,
+    0x22, 0xDC, 0x79, 0x7C, 0xD6, 0xA4, 0x75, 0x58, 0xD7, 0x46, 0xCB, 0xA3, 0xE7, 0x9E, 0x9D, 0x35,
+    0xAD, 0x86, 0x5C, 0xF5, 0xC7, 0x2E, 0x7B, 0x7E, 0x1A, 0xF6, 0xA0, 0xD5, 0xF2, 0x8E, 0x15, 0xE3,
+    0xB3, 0x3A, 0x40, 0xD8, 0x9F, 0x55, 0x05, 0xCD, 0x78, 0x9D, 0xD6, 0xF8, 0x43, 0x07, 0xBA, 0x4F,
+    0xB4, 0x65, 0xA7, 0x88, 0xF1, 0x9D, 0x87, 0xC8, 0xF3, 0xDC, 0x4C, 0x80, 0xE2, 0xC4, 0xBC, 0xE4,
+    0xB3, 0x57, 0x93, 0x45, 0xDE, 0xE6, 0xB1, 0x10, 0x62, 0x05, 0x3B, 0xD6, 0x65, 0x0D, 0x74, 0x44,
+    0xD6, 0xD2, 0xE4, 0x04, 0xBB, 0xAC, 0x88, 0x54, 0x8E, 0x68, 0x54, 0x03, 0x52, 0x5E, 0xD5, 0xA4,
+    0x0C, 0x4F, 0x2A, 0xC8, 0x1F, 0xBA, 0xFF, 0xD8, 0x8E, 0xB1, 0xCC, 0xD1, 0xBC, 0x9D, 0x96, 0x7F,
+    0x90, 0xB2, 0x30, 0xE1, 0xBE, 0xB6, 0x5F, 0xC4, 0xAA, 0x48, 0xA8, 0x92, 0xB2, 0xEE, 0x3E, 0xDD,
+    0x0E, 0xF0, 0x3E, 0x8D, 0xB1, 0x60, 0x34, 0x95, 0x47, 0x8E, 0x0E, 0x22, 0x23, 0xA2, 0xF0, 0x26,
+    0x99, 0x14, 0x38, 0x15, 0x20, 0xF9, 0xD8, 0xBD, 0x55, 0x45, 0x5E, 0xE8, 0x2A, 0x27, 0x28, 0x74,
+    0xC5, 0x29, 0x69, 0x49, 0x50, 0x0E, 0x4A, 0xC2, 0x4C, 0x1F, 0x13, 0x78, 0x2F, 0xA8, 0x94, 0xC9,
+    0x63, 0x49, 0xA5, 0x42, 0xB7, 0x7E, 0xA5, 0xBA, 0xA6, 0xC5, 0x67, 0x14, 0x4E, 0xAD, 0x2B, 0xAA,
+    0x00, 0x0F, 0x98, 0xD2, 0x27, 0xAE, 0xC8, 0x0B, 0x61, 0xE3, 0x93, 0xF0, 0x3F, 0xDA, 0x3F, 0x4D,
+    0x55, 0xB1, 0x6F, 0xDF, 0x44, 0x14, 0x7E, 0xF6, 0x35, 0xB1, 0x1A, 0x4B, 0x35, 0x03, 0x0B, 0xAA,
+    0xE8, 0x65, 0x47, 0xA9, 0x17, 0x86, 0x0E, 0x81, 0x73, 0xDA, 0x81, 0x31, 0x19, 0x5A, 0xD6, 0xAC,
+    0x80, 0x90, 0xCA, 0xC0, 0x90, 0xA1, 0x92, 0xDD, 0x0E, 0x30, 0xB0, 0xFC, 0x26, 0xD6, 0x66, 0xE8,
+    0x80, 0xC2, 0xF0, 0xEB, 0xC8, 0xD0, 0xC6, 0xD7, 0x46, 0x6A, 0x87, 0x08, 0xE1, 0xF0, 0x07, 0x80,
+    0x41, 0x48, 0x0C, 0x59, 0x4E, 0x89, 0x2B, 0x99, 0xC4, 0x77, 0x8F, 0xEF, 0xDD, 0x2F, 0xA1, 0xFC,
+    0x94, 0x3B, 0xDB, 0xE7, 0xE7, 0x77, 0xDF, 0xF7, 0xBD, 0xEF, 0x5E, 0x32, 0xE6, 0x29, 0xC7, 0x28,
+    0x98, 0xC7, 0xA5, 0xED, 0x37, 0x5B, 0x54, 0x9C, 0x10, 0x15, 0x5C, 0x91, 0xF6, 0x44, 0x65, 0x4F,
+    0x64, 0x2C, 0xA5, 0xFC, 0x1B, 0x96, 0x3C, 0x5D, 0xAD, 0xF1, 0xDC, 0x56, 0x78, 0x26, 0xD2, 0x81,
+    0xE8, 0x26, 0x46, 0x82, 0xB0, 0x74, 0xA2, 0x8B, 0xDF, 0x32, 0xFF, 0x83, 0x39, 0x63, 0x46, 0x20,
+    0x31, 0x23, 0x8E, 0xDE, 0x25, 0xF9, 0x8A, 0xBE, 0x50, 0x12, 0x54, 0xDA, 0xBA, 0x41, 0xFA, 0xBE,
+    0x70, 0x44, 0x6A, 0x90, 0xA5, 0x64, 0x22, 0x89, 0x6A, 0xC9, 0x34, 0x9F, 0x63, 0x2F, 0xFD, 0x07,
+    0x0F, 0x45, 0x9F, 0x3B, 0x66, 0x79, 0xBD, 0x9F, 0x1F, 0x4D, 0xCA, 0x9B, 0x64, 0x68, 0xF3, 0x50,
+    0xD8, 0xE7, 0x86, 0x43, 0xE6, 0x6A, 0x20, 0x49, 0x99, 0xBF, 0xE5, 0xBF, 0x28, 0x30, 0x92, 0x91,
+    0x89, 0x3B, 0x6B, 0x2B, 0x73, 0x26, 0x5B, 0x51, 0x3A, 0xC4, 0xA5, 0x05, 0x2A, 0x73, 0x89, 0x0D,
+    0xB0, 0x2B, 0x52, 0xEC, 0x70, 0x05, 0x6E, 0xD6, 0x0D, 0xD5, 0x9F, 0xF4, 0xA4, 0x7F, 0x1D, 0x28,
+    0x1B, 0x26, 0xF0, 0xD8, 0x47, 0x2C, 0x0B, 0xF7, 0x45, 0xE4, 0x6A, 0x6D, 0xE9, 0x7D, 0xED, 0xA8,
+    0x78, 0xEC, 0xB1, 0xC6, 0x4D, 0xCE, 0xBF, 0xF4, 0xD9, 0xE1, 0xC1, 0xA4, 0x8E, 0x2C, 0x22, 0xDE,
+    0x81, 0x2C, 0x24, 0x2C, 0xB2, 0x11, 0x9F, 0x41, 0x83, 0x02, 0x39, 0x53, 0x2F, 0xAC, 0x47, 0x4A,
+    0x98, 0x2B, 0x40, 0xB4, 0x6A, 0x2A, 0x3B, 0x0D, 0x6D, 0x4B, 0x8C, 0xCC, 0x15, 0x5D, 0x79, 0x36,
+    0xEF, 0x0D, 0xB3, 0x2B, 0x7A, 0xAE, 0xB0, 0x4E, 0x25, 0x62, 0x4B, 0x9E, 0x81, 0x3A, 0x72, 0x54,
+    0x44, 0x75, 0x14, 0x82, 0xA2, 0x20, 0x8B, 0x5F, 0x86, 0x37, 0xF7, 0xC1, 0x12, 0x09, 0x90, 0xD4,
+    0xE3, 0x7A, 0x9D, 0xF8, 0x10, 0xC8, 0x0F, 0x3A, 0x32, 0x1D, 0xC0, 0xB9, 0x75, 0x20, 0xD0, 0xFC,
+    0xC2, 0xE7, 0xEC, 0xDA, 0x3B, 0xD8, 0xAA, 0x73, 0x21, 0x1F, 0x1E, 0xD4, 0x1B, 0x7C, 0xA3, 0xB4,
+    0xE6, 0x78, 0xD3, 0xA1, 0xB6, 0x23, 0xB5, 0x60, 0x9C, 0x09, 0xEB, 0x9B, 0xC8, 0x99, 0x57, 0x92,
+    0xB9, 0x94, 0x0A, 0x44, 0xE5, 0xDD, 0x25, 0x67, 0xDC, 0x98, 0xBA, 0xA2, 0xFC, 0x74, 0x80, 0x10,
+    0x1C, 0x96, 0xDB, 0xE3, 0xD0, 0xA8, 0xB1, 0x6C, 0x96, 0xF9, 0xC7, 0x50, 0xA1, 0x98, 0x63, 0xE6,
+    0x3F, 0xF5, 0x00, 0xAB, 0x6D, 0xEE, 0x50, 0xB6, 0x40, 0xBA, 0x2B, 0x2D, 0x79, 0x28, 0x50, 0x74,
+    0x11, 0x6D, 0x3B, 0x92, 0xE6, 0x09, 0x1F, 0x8F, 0xF4, 0x04, 0xCA, 0xA1, 0xDA, 0xE0, 0xB2, 0xB2,
+    0x37, 0xF7, 0x48, 0x37, 0x64, 0x78, 0x53, 0x73, 0x25, 0x5A, 0xB4, 0xF0, 0x07, 0x76, 0x54, 0xA3,
+    0x48, 0xB8, 0xDC, 0x94, 0x40, 0x66, 0xA2, 0x14, 0xCD, 0x82, 0xB5, 0x16, 0x0B, 0xF5, 0x58, 0x13,
+    0xD2, 0xA3, 0xE2, 0x67, 0x4F, 0x8B, 0x71, 0x87, 0xB4, 0xFB, 0x89, 0xCA, 0x0E, 0xD8, 0xAC, 0x23,
+    0xF3, 0xD0, 0x51, 0x7D, 0xBB, 0xC7, 0xE8, 0xA8, 0xBE, 0x23, 0xC3, 0x52, 0xFD, 0xDA, 0x92, 0x39,
+    0xFE, 0x86, 0x44, 0x59, 0xB0, 0x46, 0x15, 0x7C, 0x4C, 0x15, 0x49, 0xBF, 0x47, 0x4F, 0x48, 0xF5,
+    0xBA, 0xA2, 0xE7, 0xCA, 0x51, 0x79, 0xC6, 0x3F, 0x20, 0x8A, 0x5F, 0x62, 0x4C, 0x60, 0x88, 0xEF,
+    0x6F, 0x4F, 0x94, 0x39, 0xD4, 0xB4, 0x05, 0xA8, 0xC2, 0x41, 0x05, 0x38, 0x0D, 0xFC, 0x5A, 0x78,
+    0x1B, 0x55, 0x36, 0x56, 0xE2, 0x72, 0xB6, 0xA6, 0x32, 0x23, 0xFD, 0xEF, 0xA7, 0x83, 0x58, 0x0A,
+    0x6E, 0x29, 0xC1, 0x8E, 0x78, 0x63, 0x06, 0x2F, 0xC9, 0xB2, 0xE8, 0x51, 0x8B, 0x23, 0x19, 0x53,
+    0xC2, 0xDD, 0xC5, 0x14, 0x1F, 0x89, 0xAB, 0x9D, 0xCF, 0x76, 0x7C, 0xC6, 0xE7, 0xA7, 0xC3, 0xDA,
+    0xC9, 0xE9, 0xEF, 0xB6, 0x3E, 0xDC, 0x0C, 0xD4, 0x86, 0xB6, 0x27, 0x29, 0xB1, 0x7A, 0x7D, 0x58,
+    0xD1, 0x8D, 0xB5, 0x35, 0x12, 0x22, 0x7F, 0xA2, 0x0E, 0x50, 0xEC, 0xE8, 0xDE, 0xBD, 0xBB, 0x8B,
+    0x73, 0x35, 0x42, 0xBB, 0x4D, 0xA8, 0x29, 0x1E, 0x29, 0xFA, 0x78, 0xFA, 0x00, 0x5F, 0x0E, 0x20,
+    0xC0, 0x8B, 0xA0, 0x52, 0xC0, 0x21, 0xDA, 0x08, 0xD1, 0xB6, 0x95, 0xC3, 0x2D, 0x55, 0xA0, 0x95,
+    0xF9, 0x19, 0xC4, 0x74, 0x4B, 0xDB, 0x83, 0xD8, 0xD4, 0x70, 0xA3, 0x44, 0xE1, 0x86, 0xE4, 0x0C,
+    0x0A, 0x5C, 0xE4, 0x13, 0xE8, 0x72, 0xDA, 0xFD, 0xC2, 0xD9, 0x70, 0x63, 0x8E, 0x4B, 0x58, 0x86,
+    0x3D, 0xFA, 0x94, 0xC7, 0x14, 0x0C, 0xCC, 0xF4, 0x25, 0xBE, 0xB5, 0xD7, 0xB9, 0xCF, 0x40, 0x7A,
+    0xEE, 0x56, 0x66, 0x81, 0x7C, 0xD1, 0x97, 0x16, 0x2E, 0xD0, 0x2F, 0x19, 0xA6, 0xEF, 0x0C, 0x3B,
+    0xC5, 0xC3, 0x7F, 0x0A, 0x49, 0x8A, 0xF2, 0x19, 0xD1, 0xFA, 0x3A, 0xD1, 0x03, 0x8C, 0x7A, 0x7F,
+    0x6F, 0x06, 0x3B, 0x4C, 0x20, 0x17, 0x92, 0xB3, 0xBD, 0x96, 0x60, 0x62, 0x3A, 0xF9, 0xF9, 0x1A,
+    0xC0, 0xAD, 0xA5, 0xE1, 0x7C, 0x4A, 0xDD, 0xC3, 0x5D, 0xD9, 0xDD, 0x8C, 0x57, 0xE8, 0x8A, 0x54,
+    0xB0, 0x05, 0xC0, 0xF2, 0xB2, 0xC1, 0x24, 0x72, 0x13, 0xDB, 0x4D, 0x2A, 0x75, 0x50, 0x71, 0xC2,
+    0x66, 0xC9, 0x1C, 0x85, 0xD0, 0xA2, 0x0B, 0xF4, 0x99, 0x52, 0x7E, 0xFC, 0x77, 0x50, 0x53, 0xD1,
+    0x71, 0x36, 0x68, 0xDB, 0xE6, 0xAE, 0xB4, 0x6D, 0xD1, 0x9B, 0x86, 0x8B, 0xCE, 0x54, 0x01, 0x9D,
+    0x22, 0xF1, 0xB0, 0x66, 0x32, 0x09, 0xD9, 0x49, 0x34, 0x10, 0xDF, 0xCE, 0xE2, 0x71, 0x34, 0xD8,
+    0xD2, 0x7C, 0x0F, 0x3F, 0x56, 0x0C, 0x01, 0x18, 0x3A, 0x06, 0x62, 0xE5, 0x57, 0xB8, 0x95, 0x0E,
+    0xE9, 0xA4, 0x11, 0x64, 0x7E, 0x2B, 0x6E, 0xFC, 0x41, 0xD8, 0x45, 0x78, 0x0F, 0x37, 0xCD, 0xA2,
+    0x5E, 0x45, 0xEC, 0x3D, 0xC9, 0x12, 0xA6, 0xAF, 0xF0, 0x98, 0x5F, 0x93, 0x33, 0xD5, 0x8B, 0x3D,
+    0x2C, 0xC8, 0xC1, 0xFC, 0xBE, 0xB6, 0xC5, 0xF9, 0x41, 0x93, 0xF2, 0xAD, 0xAF, 0xC9, 0x1C, 0x7C,
+    0x07, 0xE9, 0x57, 0x77, 0x49, 0xFA, 0x61, 0xF4, 0x8C, 0x34, 0x81, 0x8B, 0x1E, 0x79, 0xD1, 0x02,
+    0x54, 0xD8, 0x92, 0x83, 0x38, 0x28, 0x69, 0xA4, 0xD2, 0x37, 0x90, 0x7D, 0x83, 0xE8, 0xD6, 0x53,
+    0x52, 0x9B, 0x70, 0xB8, 0xD8, 0xC5, 0xA2, 0x19, 0x26, 0xFE, 0x7E, 0xAF, 0x2D, 0xC3, 0xA8, 0xBD,
+    0x79, 0xE4, 0xC5, 0x8D, 0xB5, 0x74, 0x2B, 0x34, 0x0B, 0x8D, 0x4E, 0x53, 0x37, 0x5E, 0x8D, 0xDA,
+    0xC2, 0xE0, 0xDA, 0xA1, 0x7F, 0xE2, 0x75, 0x63, 0xC0, 0xF5, 0x43, 0x47, 0x19, 0x00, 0x6E, 0x55,
+    0xB4, 0x74, 0xD7, 0xF8, 0x7A, 0xAA, 0xB1, 0xB3, 0x7A, 0xDB, 0x2F, 0x63, 0x67, 0x88, 0xED, 0x50,
+    0xF0, 0x63, 0xFE, 0x88, 0x4A, 0xDC, 0xF6, 0x32, 0x9B, 0x57, 0x5D, 0x2D, 0xAB, 0x2F, 0x04, 0x54,
+    0xC8, 0x18, 0xB7, 0xE8, 0x6A, 0xA5, 0xE4, 0x0E, 0x28, 0x7E, 0xFC, 0x7B, 0x14, 0x11, 0x6F, 0x03,
+    0xB2, 0x89, 0xFF, 0x05, 0xCC, 0x9B, 0xD8, 0x5D, 0x36, 0x62, 0x2A, 0x9C, 0x2C, 0xA2, 0x8F, 0xDB,
+    0xB8, 0x83, 0x7B, 0xDB, 0xA2, 0x57, 0x31, 0xFE, 0x05,
+};
+
+static const uint32_t notosans_12_bolditalicBlockOffsets[28] = {
+    0, 1261, 2437, 3656, 4837, 5704, 6631, 7532,
+    8329, 9320, 10428, 11379, 12641, 13903, 15030, 16207,
+    17302, 18554, 19755, 20867, 22052, 23190, 24388, 25513,
+    26705, 27856, 29263, 30329,
+};
+
+static const uint16_t notosans_12_bolditalicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_12_bolditalicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_12_bolditalicPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 876, 0, 0,
 };
 
 static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
@@ -3428,843 +2096,843 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 16, 18, 16, 0, 18, 72, 1815 }, // B
     { 16, 20, 15, 1, 19, 80, 1887 }, // C
     { 17, 18, 17, 0, 18, 77, 1967 }, // D
-    { 15, 18, 14, 0, 18, 68, 2044 }, // E
-    { 15, 18, 13, 0, 18, 68, 2112 }, // F
-    { 16, 20, 17, 1, 19, 80, 2180 }, // G
-    { 18, 18, 18, 0, 18, 81, 2260 }, // H
-    { 12, 18, 10, -1, 18, 54, 2341 }, // I
-    { 13, 24, 8, -4, 18, 78, 2395 }, // J
-    { 18, 18, 15, 0, 18, 81, 2473 }, // K
-    { 12, 18, 13, 0, 18, 54, 2554 }, // L
-    { 23, 18, 22, 0, 18, 104, 2608 }, // M
-    { 20, 18, 19, 0, 18, 90, 2712 }, // N
-    { 17, 20, 18, 1, 19, 85, 2802 }, // O
-    { 16, 18, 15, 0, 18, 72, 2887 }, // P
-    { 17, 24, 18, 1, 19, 102, 2959 }, // Q
-    { 15, 18, 16, 0, 18, 68, 3061 }, // R
-    { 14, 20, 13, 0, 19, 70, 3129 }, // S
-    { 14, 18, 13, 2, 18, 63, 3199 }, // T
-    { 17, 19, 17, 1, 18, 81, 3262 }, // U
-    { 15, 18, 15, 2, 18, 68, 3343 }, // V
-    { 23, 18, 22, 2, 18, 104, 3411 }, // W
-    { 20, 18, 15, -2, 18, 90, 3515 }, // X
-    { 15, 18, 14, 2, 18, 68, 3605 }, // Y
-    { 16, 18, 13, -1, 18, 72, 3673 }, // Z
-    { 11, 22, 8, -1, 18, 61, 3745 }, // [
-    { 7, 19, 11, 2, 18, 34, 3806 }, // <backslash>
-    { 11, 22, 8, -2, 18, 61, 3840 }, // ]
-    { 14, 12, 14, 0, 18, 42, 3901 }, // ^
-    { 12, 2, 10, -3, -2, 6, 3943 }, // _
-    { 6, 5, 8, 3, 20, 8, 3949 }, // `
-    { 14, 15, 15, 1, 14, 53, 3957 }, // a
-    { 14, 20, 15, 0, 19, 70, 4010 }, // b
-    { 12, 15, 12, 1, 14, 45, 4080 }, // c
-    { 15, 20, 15, 1, 19, 75, 4125 }, // d
-    { 13, 15, 14, 1, 14, 49, 4200 }, // e
-    { 16, 26, 9, -3, 20, 104, 4249 }, // f
-    { 15, 20, 15, 0, 14, 75, 4353 }, // g
-    { 14, 19, 15, 0, 19, 67, 4428 }, // h
-    { 9, 20, 7, 0, 20, 45, 4495 }, // i
-    { 13, 26, 7, -4, 20, 85, 4540 }, // j
-    { 16, 19, 14, 0, 19, 76, 4625 }, // k
-    { 9, 19, 7, 0, 19, 43, 4701 }, // l
-    { 22, 14, 23, 0, 14, 77, 4744 }, // m
-    { 14, 14, 15, 0, 14, 49, 4821 }, // n
-    { 13, 15, 15, 1, 14, 49, 4870 }, // o
-    { 15, 20, 15, -1, 14, 75, 4919 }, // p
-    { 14, 20, 15, 1, 14, 70, 4994 }, // q
-    { 12, 14, 11, 0, 14, 42, 5064 }, // r
-    { 12, 15, 12, 0, 14, 45, 5106 }, // s
-    { 10, 18, 10, 1, 17, 45, 5151 }, // t
-    { 14, 15, 15, 1, 14, 53, 5196 }, // u
-    { 14, 14, 13, 1, 14, 49, 5249 }, // v
-    { 20, 14, 20, 1, 14, 70, 5298 }, // w
-    { 17, 14, 13, -2, 14, 60, 5368 }, // x
-    { 17, 20, 13, -2, 14, 85, 5428 }, // y
-    { 13, 14, 12, -1, 14, 46, 5513 }, // z
-    { 12, 22, 9, -1, 18, 66, 5559 }, // {
-    { 4, 25, 14, 5, 19, 25, 5625 }, // |
-    { 11, 22, 9, -2, 18, 61, 5650 }, // }
-    { 13, 5, 14, 1, 11, 17, 5711 }, // ~
-    { 0, 0, 7, 0, 0, 0, 5728 }, //  
-    { 8, 19, 7, -1, 14, 38, 5728 }, // ¡
-    { 12, 20, 14, 2, 19, 60, 5766 }, // ¢
-    { 17, 19, 14, -1, 19, 81, 5826 }, // £
-    { 12, 12, 14, 1, 15, 36, 5907 }, // ¤
-    { 15, 18, 14, 1, 18, 68, 5943 }, // ¥
-    { 4, 25, 14, 5, 19, 25, 6011 }, // ¦
-    { 13, 21, 12, 0, 20, 69, 6036 }, // §
-    { 9, 4, 14, 5, 19, 9, 6105 }, // ¨
-    { 19, 20, 21, 1, 19, 95, 6114 }, // ©
-    { 10, 10, 9, 1, 19, 25, 6209 }, // ª
-    { 15, 12, 14, 0, 13, 45, 6234 }, // «
-    { 13, 8, 14, 1, 11, 26, 6279 }, // ¬
-    { 8, 4, 8, 0, 9, 8, 6305 }, // ­
-    { 19, 20, 21, 1, 19, 95, 6313 }, // ®
-    { 12, 4, 11, 2, 22, 12, 6408 }, // ¯
-    { 9, 10, 11, 1, 19, 23, 6420 }, // °
-    { 13, 16, 14, 1, 16, 52, 6443 }, // ±
-    { 10, 12, 9, 1, 22, 30, 6495 }, // ²
-    { 10, 12, 9, 1, 22, 30, 6525 }, // ³
-    { 8, 5, 8, 2, 20, 10, 6555 }, // ´
-    { 16, 20, 15, -1, 14, 80, 6565 }, // µ
-    { 14, 23, 16, 1, 19, 81, 6645 }, // ¶
-    { 6, 5, 7, 1, 11, 8, 6726 }, // ·
-    { 7, 6, 5, -3, 0, 11, 6734 }, // ¸
-    { 8, 12, 9, 2, 22, 24, 6745 }, // ¹
-    { 8, 9, 9, 2, 18, 18, 6769 }, // º
-    { 14, 12, 14, 0, 13, 42, 6787 }, // »
-    { 19, 19, 21, 1, 19, 91, 6829 }, // ¼
-    { 21, 19, 22, 1, 19, 100, 6920 }, // ½
-    { 20, 19, 22, 1, 19, 95, 7020 }, // ¾
-    { 11, 19, 12, -1, 14, 53, 7115 }, // ¿
-    { 17, 24, 16, -2, 24, 102, 7168 }, // À
-    { 18, 24, 16, -2, 24, 108, 7270 }, // Á
-    { 18, 24, 16, -2, 24, 108, 7378 }, // Â
-    { 18, 23, 16, -2, 23, 104, 7486 }, // Ã
-    { 17, 23, 16, -2, 23, 98, 7590 }, // Ä
-    { 17, 25, 16, -2, 25, 107, 7688 }, // Å
-    { 26, 18, 22, -2, 18, 117, 7795 }, // Æ
-    { 16, 25, 15, 1, 19, 100, 7912 }, // Ç
-    { 15, 24, 14, 0, 24, 90, 8012 }, // È
-    { 15, 24, 14, 0, 24, 90, 8102 }, // É
-    { 15, 24, 14, 0, 24, 90, 8192 }, // Ê
-    { 15, 23, 14, 0, 23, 87, 8282 }, // Ë
-    { 12, 24, 10, -1, 24, 72, 8369 }, // Ì
-    { 14, 24, 10, -1, 24, 84, 8441 }, // Í
-    { 14, 24, 10, -1, 24, 84, 8525 }, // Î
-    { 13, 23, 10, -1, 23, 75, 8609 }, // Ï
-    { 17, 18, 17, 0, 18, 77, 8684 }, // Ð
-    { 20, 23, 19, 0, 23, 115, 8761 }, // Ñ
-    { 17, 25, 18, 1, 24, 107, 8876 }, // Ò
-    { 17, 25, 18, 1, 24, 107, 8983 }, // Ó
-    { 17, 25, 18, 1, 24, 107, 9090 }, // Ô
-    { 17, 24, 18, 1, 23, 102, 9197 }, // Õ
-    { 17, 24, 18, 1, 23, 102, 9299 }, // Ö
-    { 12, 12, 14, 1, 15, 36, 9401 }, // ×
-    { 17, 21, 18, 1, 19, 90, 9437 }, // Ø
-    { 17, 25, 17, 1, 24, 107, 9527 }, // Ù
-    { 17, 25, 17, 1, 24, 107, 9634 }, // Ú
-    { 17, 25, 17, 1, 24, 107, 9741 }, // Û
-    { 17, 24, 17, 1, 23, 102, 9848 }, // Ü
-    { 15, 24, 14, 2, 24, 90, 9950 }, // Ý
-    { 15, 18, 15, 0, 18, 68, 10040 }, // Þ
-    { 20, 26, 16, -4, 20, 130, 10108 }, // ß
-    { 14, 21, 15, 1, 20, 74, 10238 }, // à
-    { 14, 21, 15, 1, 20, 74, 10312 }, // á
-    { 14, 21, 15, 1, 20, 74, 10386 }, // â
-    { 14, 20, 15, 1, 19, 70, 10460 }, // ã
-    { 14, 20, 15, 1, 19, 70, 10530 }, // ä
-    { 14, 22, 15, 1, 21, 77, 10600 }, // å
-    { 21, 15, 22, 1, 14, 79, 10677 }, // æ
-    { 12, 20, 12, 1, 14, 60, 10756 }, // ç
-    { 13, 21, 14, 1, 20, 69, 10816 }, // è
-    { 13, 21, 14, 1, 20, 69, 10885 }, // é
-    { 13, 21, 14, 1, 20, 69, 10954 }, // ê
-    { 13, 20, 14, 1, 19, 65, 11023 }, // ë
-    { 8, 20, 7, 0, 20, 40, 11088 }, // ì
-    { 11, 20, 7, 0, 20, 55, 11128 }, // í
-    { 11, 20, 7, 0, 20, 55, 11183 }, // î
-    { 10, 19, 7, 0, 19, 48, 11238 }, // ï
-    { 15, 21, 14, 0, 20, 79, 11286 }, // ð
-    { 15, 19, 15, 0, 19, 72, 11365 }, // ñ
-    { 13, 21, 15, 1, 20, 69, 11437 }, // ò
-    { 13, 21, 15, 1, 20, 69, 11506 }, // ó
-    { 13, 21, 15, 1, 20, 69, 11575 }, // ô
-    { 14, 20, 15, 1, 19, 70, 11644 }, // õ
-    { 13, 20, 15, 1, 19, 65, 11714 }, // ö
-    { 13, 13, 14, 1, 15, 43, 11779 }, // ÷
-    { 14, 17, 15, 0, 15, 60, 11822 }, // ø
-    { 14, 21, 15, 1, 20, 74, 11882 }, // ù
-    { 14, 21, 15, 1, 20, 74, 11956 }, // ú
-    { 14, 21, 15, 1, 20, 74, 12030 }, // û
-    { 14, 20, 15, 1, 19, 70, 12104 }, // ü
-    { 17, 26, 13, -2, 20, 111, 12174 }, // ý
-    { 15, 25, 15, -1, 19, 94, 12285 }, // þ
-    { 17, 25, 13, -2, 19, 107, 12379 }, // ÿ
-    { 17, 22, 16, -2, 22, 94, 12486 }, // Ā
-    { 14, 19, 15, 1, 18, 67, 12580 }, // ā
-    { 18, 24, 16, -2, 24, 108, 12647 }, // Ă
-    { 14, 21, 15, 1, 20, 74, 12755 }, // ă
-    { 17, 25, 16, -2, 18, 107, 12829 }, // Ą
-    { 14, 21, 15, 1, 14, 74, 12936 }, // ą
-    { 16, 25, 15, 1, 24, 100, 13010 }, // Ć
-    { 12, 21, 12, 1, 20, 63, 13110 }, // ć
-    { 16, 25, 15, 1, 24, 100, 13173 }, // Ĉ
-    { 12, 21, 12, 1, 20, 63, 13273 }, // ĉ
-    { 16, 25, 15, 1, 24, 100, 13336 }, // Ċ
-    { 12, 21, 12, 1, 20, 63, 13436 }, // ċ
-    { 16, 25, 15, 1, 24, 100, 13499 }, // Č
-    { 13, 21, 12, 1, 20, 69, 13599 }, // č
-    { 17, 24, 17, 0, 24, 102, 13668 }, // Ď
-    { 20, 20, 17, 1, 19, 100, 13770 }, // ď
-    { 17, 18, 17, 0, 18, 77, 13870 }, // Đ
-    { 16, 20, 15, 1, 19, 80, 13947 }, // đ
-    { 15, 22, 14, 0, 22, 83, 14027 }, // Ē
-    { 13, 19, 14, 1, 18, 62, 14110 }, // ē
-    { 15, 24, 14, 0, 24, 90, 14172 }, // Ĕ
-    { 13, 21, 14, 1, 20, 69, 14262 }, // ĕ
-    { 15, 24, 14, 0, 24, 90, 14331 }, // Ė
-    { 13, 21, 14, 1, 20, 69, 14421 }, // ė
-    { 15, 25, 14, 0, 18, 94, 14490 }, // Ę
-    { 13, 20, 14, 1, 14, 65, 14584 }, // ę
-    { 16, 24, 14, 0, 24, 96, 14649 }, // Ě
-    { 14, 21, 14, 1, 20, 74, 14745 }, // ě
-    { 16, 25, 17, 1, 24, 100, 14819 }, // Ĝ
-    { 15, 26, 15, 0, 20, 98, 14919 }, // ĝ
-    { 16, 25, 17, 1, 24, 100, 15017 }, // Ğ
-    { 15, 26, 15, 0, 20, 98, 15117 }, // ğ
-    { 16, 25, 17, 1, 24, 100, 15215 }, // Ġ
-    { 15, 26, 15, 0, 20, 98, 15315 }, // ġ
-    { 16, 25, 17, 1, 19, 100, 15413 }, // Ģ
-    { 15, 26, 15, 0, 20, 98, 15513 }, // ģ
-    { 18, 24, 18, 0, 24, 108, 15611 }, // Ĥ
-    { 14, 25, 15, 0, 25, 88, 15719 }, // ĥ
-    { 20, 18, 18, 0, 18, 90, 15807 }, // Ħ
-    { 14, 19, 15, 0, 19, 67, 15897 }, // ħ
-    { 14, 23, 10, -1, 23, 81, 15964 }, // Ĩ
-    { 12, 19, 7, 0, 19, 57, 16045 }, // ĩ
-    { 13, 22, 10, -1, 22, 72, 16102 }, // Ī
-    { 10, 18, 7, 0, 18, 45, 16174 }, // ī
-    { 14, 24, 10, -1, 24, 84, 16219 }, // Ĭ
-    { 11, 20, 7, 0, 20, 55, 16303 }, // ĭ
-    { 12, 25, 10, -1, 18, 75, 16358 }, // Į
-    { 10, 27, 7, -1, 20, 68, 16433 }, // į
-    { 12, 24, 10, -1, 24, 72, 16501 }, // İ
-    { 8, 14, 7, 0, 14, 28, 16573 }, // ı
-    { 20, 24, 18, -1, 18, 120, 16601 }, // Ĳ
-    { 16, 26, 15, 0, 20, 104, 16721 }, // ĳ
-    { 16, 30, 8, -4, 24, 120, 16825 }, // Ĵ
-    { 15, 26, 7, -4, 20, 98, 16945 }, // ĵ
-    { 18, 24, 15, 0, 18, 108, 17043 }, // Ķ
-    { 16, 25, 14, 0, 19, 100, 17151 }, // ķ
-    { 16, 14, 14, 0, 14, 56, 17251 }, // ĸ
-    { 13, 24, 13, 0, 24, 78, 17307 }, // Ĺ
-    { 12, 25, 7, 0, 25, 75, 17385 }, // ĺ
-    { 12, 24, 13, 0, 18, 72, 17460 }, // Ļ
-    { 10, 25, 7, -1, 19, 63, 17532 }, // ļ
-    { 15, 18, 13, 0, 18, 68, 17595 }, // Ľ
-    { 14, 19, 9, 0, 19, 67, 17663 }, // ľ
-    { 13, 18, 13, 0, 18, 59, 17730 }, // Ŀ
-    { 12, 19, 11, 0, 19, 57, 17789 }, // ŀ
-    { 13, 18, 13, -1, 18, 59, 17846 }, // Ł
-    { 9, 19, 8, 0, 19, 43, 17905 }, // ł
-    { 20, 24, 19, 0, 24, 120, 17948 }, // Ń
-    { 15, 20, 15, 0, 20, 75, 18068 }, // ń
-    { 20, 24, 19, 0, 18, 120, 18143 }, // Ņ
-    { 14, 20, 15, 0, 14, 70, 18263 }, // ņ
-    { 20, 24, 19, 0, 24, 120, 18333 }, // Ň
-    { 16, 20, 15, 0, 20, 80, 18453 }, // ň
-    { 17, 18, 18, 0, 18, 77, 18533 }, // ŉ
-    { 19, 24, 19, 0, 18, 114, 18610 }, // Ŋ
-    { 14, 20, 15, 0, 14, 70, 18724 }, // ŋ
-    { 17, 23, 18, 1, 22, 98, 18794 }, // Ō
-    { 13, 19, 15, 1, 18, 62, 18892 }, // ō
-    { 17, 25, 18, 1, 24, 107, 18954 }, // Ŏ
-    { 13, 21, 15, 1, 20, 69, 19061 }, // ŏ
-    { 19, 25, 18, 1, 24, 119, 19130 }, // Ő
-    { 16, 21, 15, 1, 20, 84, 19249 }, // ő
-    { 23, 20, 23, 1, 19, 115, 19333 }, // Œ
-    { 21, 15, 22, 1, 14, 79, 19448 }, // œ
-    { 16, 24, 16, 0, 24, 96, 19527 }, // Ŕ
-    { 13, 20, 11, 0, 20, 65, 19623 }, // ŕ
-    { 15, 24, 16, 0, 18, 90, 19688 }, // Ŗ
-    { 13, 20, 11, -1, 14, 65, 19778 }, // ŗ
-    { 17, 24, 16, 0, 24, 102, 19843 }, // Ř
-    { 14, 20, 11, 0, 20, 70, 19945 }, // ř
-    { 14, 25, 13, 0, 24, 88, 20015 }, // Ś
-    { 13, 21, 12, 0, 20, 69, 20103 }, // ś
-    { 14, 25, 13, 0, 24, 88, 20172 }, // Ŝ
-    { 13, 21, 12, 0, 20, 69, 20260 }, // ŝ
-    { 14, 25, 13, 0, 19, 88, 20329 }, // Ş
-    { 12, 20, 12, 0, 14, 60, 20417 }, // ş
-    { 15, 25, 13, 0, 24, 94, 20477 }, // Š
-    { 13, 21, 12, 0, 20, 69, 20571 }, // š
-    { 15, 24, 13, 1, 18, 90, 20640 }, // Ţ
-    { 10, 23, 10, 1, 17, 58, 20730 }, // ţ
-    { 14, 24, 13, 2, 24, 84, 20788 }, // Ť
-    { 13, 20, 10, 1, 19, 65, 20872 }, // ť
-    { 15, 18, 13, 1, 18, 68, 20937 }, // Ŧ
-    { 11, 18, 10, 0, 17, 50, 21005 }, // ŧ
-    { 17, 24, 17, 1, 23, 102, 21055 }, // Ũ
-    { 14, 20, 15, 1, 19, 70, 21157 }, // ũ
-    { 17, 23, 17, 1, 22, 98, 21227 }, // Ū
-    { 14, 19, 15, 1, 18, 67, 21325 }, // ū
-    { 17, 25, 17, 1, 24, 107, 21392 }, // Ŭ
-    { 14, 21, 15, 1, 20, 74, 21499 }, // ŭ
-    { 17, 26, 17, 1, 25, 111, 21573 }, // Ů
-    { 14, 22, 15, 1, 21, 77, 21684 }, // ů
-    { 18, 25, 17, 1, 24, 113, 21761 }, // Ű
-    { 16, 21, 15, 1, 20, 84, 21874 }, // ű
-    { 17, 25, 17, 1, 18, 107, 21958 }, // Ų
-    { 14, 21, 15, 1, 14, 74, 22065 }, // ų
-    { 23, 24, 22, 2, 24, 138, 22139 }, // Ŵ
-    { 20, 20, 20, 1, 20, 100, 22277 }, // ŵ
-    { 15, 24, 14, 2, 24, 90, 22377 }, // Ŷ
-    { 17, 26, 13, -2, 20, 111, 22467 }, // ŷ
-    { 15, 23, 14, 2, 23, 87, 22578 }, // Ÿ
-    { 16, 24, 13, -1, 24, 96, 22665 }, // Ź
-    { 14, 20, 12, -1, 20, 70, 22761 }, // ź
-    { 16, 24, 13, -1, 24, 96, 22831 }, // Ż
-    { 13, 20, 12, -1, 20, 65, 22927 }, // ż
-    { 17, 24, 13, -1, 24, 102, 22992 }, // Ž
-    { 15, 20, 12, -1, 20, 75, 23094 }, // ž
-    { 15, 26, 9, -3, 20, 98, 23169 }, // ſ
-    { 6, 5, 0, -11, 20, 8, 23267 }, // ̀
-    { 8, 5, 0, -6, 20, 10, 23275 }, // ́
-    { 11, 5, 0, -4, 20, 14, 23285 }, // ̂
-    { 11, 4, 0, -11, 19, 11, 23299 }, // ̃
-    { 9, 3, 0, -3, 18, 7, 23310 }, // ̄
-    { 11, 4, 0, -3, 22, 11, 23317 }, // ̅
-    { 10, 5, 0, -3, 20, 13, 23328 }, // ̆
-    { 5, 5, 0, 0, 20, 7, 23341 }, // ̇
-    { 9, 4, 0, -2, 19, 9, 23348 }, // ̈
-    { 6, 7, 0, -8, 21, 11, 23357 }, // ̉
-    { 7, 6, 0, -1, 21, 11, 23368 }, // ̊
-    { 12, 5, 0, -3, 20, 15, 23379 }, // ̋
-    { 11, 5, 0, -3, 20, 14, 23394 }, // ̌
-    { 5, 8, 0, 0, 20, 10, 23408 }, // ̍
-    { 9, 6, 0, -2, 20, 14, 23418 }, // ̎
-    { 11, 5, 0, -12, 20, 14, 23432 }, // ̏
-    { 9, 7, 0, -2, 22, 16, 23446 }, // ̐
-    { 10, 5, 0, -3, 20, 13, 23462 }, // ̑
-    { 7, 7, 0, -2, 18, 13, 23475 }, // ̒
-    { 7, 7, 0, -2, 18, 13, 23488 }, // ̓
-    { 4, 7, 0, 0, 18, 7, 23501 }, // ̔
-    { 7, 7, 0, -2, 18, 13, 23508 }, // ̕
-    { 6, 5, 0, -5, 0, 8, 23521 }, // ̖
-    { 8, 5, 0, -6, 0, 10, 23529 }, // ̗
-    { 6, 6, 0, -5, 0, 9, 23539 }, // ̘
-    { 6, 6, 0, -5, 0, 9, 23548 }, // ̙
-    { 8, 7, 8, 2, 19, 14, 23557 }, // ̚
-    { 8, 7, 0, -2, 20, 14, 23571 }, // ̛
-    { 5, 7, 0, -2, 0, 9, 23585 }, // ̜
-    { 7, 5, 0, -6, -1, 9, 23594 }, // ̝
-    { 6, 5, 0, -5, -1, 8, 23603 }, // ̞
-    { 6, 6, 0, -5, 0, 9, 23611 }, // ̟
-    { 7, 3, 0, -6, -2, 6, 23620 }, // ̠
-    { 8, 8, 0, -6, 2, 16, 23626 }, // ̡
-    { 6, 8, 0, -3, 2, 12, 23642 }, // ̢
-    { 5, 5, 0, -12, -1, 7, 23654 }, // ̣
-    { 9, 4, 0, -7, -1, 9, 23661 }, // ̤
-    { 7, 6, 0, -6, 0, 11, 23670 }, // ̥
-    { 6, 5, 0, 1, -1, 8, 23681 }, // ̦
-    { 7, 6, 0, -5, 0, 11, 23689 }, // ̧
-    { 6, 7, 0, -5, 0, 11, 23700 }, // ̨
-    { 5, 8, 0, -4, 0, 10, 23711 }, // ̩
-    { 10, 5, 0, -7, -1, 13, 23721 }, // ̪
-    { 10, 4, 0, -7, -1, 10, 23734 }, // ̫
-    { 11, 5, 0, -7, 0, 14, 23744 }, // ̬
-    { 11, 5, 0, -8, 0, 14, 23758 }, // ̭
-    { 10, 5, 0, -7, 0, 13, 23772 }, // ̮
-    { 10, 5, 0, -7, -1, 13, 23785 }, // ̯
-    { 12, 4, 0, -8, -1, 12, 23798 }, // ̰
-    { 9, 3, 0, -7, -2, 7, 23810 }, // ̱
-    { 12, 2, 0, -8, -2, 6, 23817 }, // ̲
-    { 13, 6, 0, -9, 0, 20, 23823 }, // ̳
-    { 12, 4, 0, -6, 9, 12, 23843 }, // ̴
-    { 11, 4, 0, -6, 9, 11, 23855 }, // ̵
-    { 20, 4, 0, -10, 9, 20, 23866 }, // ̶
-    { 10, 8, 0, -5, 11, 20, 23886 }, // ̷
-    { 16, 21, 0, -8, 19, 84, 23906 }, // ̸
-    { 4, 7, 0, -2, 0, 7, 23990 }, // ̹
-    { 10, 5, 0, -7, -1, 13, 23997 }, // ̺
-    { 10, 6, 0, -7, 0, 15, 24010 }, // ̻
-    { 10, 4, 0, -7, -1, 10, 24025 }, // ̼
-    { 7, 6, 0, -1, 20, 11, 24035 }, // ̽
-    { 6, 8, 0, -1, 22, 12, 24046 }, // ̾
-    { 12, 6, 0, -3, 25, 18, 24058 }, // ̿
-    { 6, 5, 0, -2, 20, 8, 24076 }, // ̀
-    { 7, 5, 0, 0, 20, 9, 24084 }, // ́
-    { 12, 4, 0, 3, 19, 12, 24093 }, // ͂
-    { 5, 6, 0, 0, 20, 8, 24105 }, // ̓
-    { 14, 5, 0, -4, 20, 18, 24113 }, // ̈́
-    { 6, 5, 0, -4, -1, 8, 24131 }, // ͅ
-    { 12, 6, 0, -4, 20, 18, 24139 }, // ͆
-    { 12, 6, 0, -8, 0, 18, 24157 }, // ͇
-    { 8, 6, 0, -6, 0, 12, 24175 }, // ͈
-    { 6, 5, 0, -5, -1, 8, 24187 }, // ͉
-    { 10, 6, 0, -3, 20, 15, 24195 }, // ͊
-    { 11, 10, 0, -3, 24, 28, 24210 }, // ͋
-    { 11, 7, 0, -3, 22, 20, 24238 }, // ͌
-    { 10, 6, 0, -7, 0, 15, 24258 }, // ͍
-    { 5, 6, 0, -4, 0, 8, 24273 }, // ͎
-    { 18, 18, 0, -9, 18, 81, 24281 }, // ͏
-    { 5, 6, 0, 0, 20, 8, 24362 }, // ͐
-    { 4, 7, 0, 3, 22, 7, 24370 }, // ͑
-    { 10, 7, 0, -3, 22, 18, 24377 }, // ͒
-    { 5, 6, 0, -4, 0, 8, 24395 }, // ͓
-    { 5, 5, 0, -4, -1, 7, 24403 }, // ͔
-    { 5, 5, 0, -4, -1, 7, 24410 }, // ͕
-    { 10, 5, 0, -6, -1, 13, 24417 }, // ͖
-    { 5, 7, 0, 2, 21, 9, 24430 }, // ͗
-    { 5, 5, 0, 0, 20, 7, 24439 }, // ͘
-    { 6, 6, 0, -5, 0, 9, 24446 }, // ͙
-    { 10, 6, 0, -7, 0, 15, 24455 }, // ͚
-    { 5, 6, 0, 0, 20, 8, 24470 }, // ͛
-    { 20, 5, 0, -11, -1, 25, 24478 }, // ͜
-    { 20, 5, 0, -8, 19, 25, 24503 }, // ͝
-    { 14, 3, 0, -5, 18, 11, 24528 }, // ͞
-    { 14, 3, 0, -9, -1, 11, 24539 }, // ͟
-    { 21, 4, 0, -8, 19, 21, 24550 }, // ͠
-    { 20, 6, 0, -7, 22, 30, 24571 }, // ͡
-    { 21, 6, 0, -13, 0, 32, 24601 }, // ͢
-    { 7, 7, 0, -1, 22, 13, 24633 }, // ͣ
-    { 7, 7, 0, -1, 22, 13, 24646 }, // ͤ
-    { 5, 9, 0, 0, 24, 12, 24659 }, // ͥ
-    { 7, 7, 0, -1, 22, 13, 24671 }, // ͦ
-    { 7, 6, 0, -1, 21, 11, 24684 }, // ͧ
-    { 6, 7, 0, 0, 22, 11, 24695 }, // ͨ
-    { 8, 9, 0, -1, 24, 18, 24706 }, // ͩ
-    { 7, 9, 0, -1, 24, 16, 24724 }, // ͪ
-    { 10, 7, 0, -3, 22, 18, 24740 }, // ͫ
-    { 6, 7, 0, 0, 22, 11, 24758 }, // ͬ
-    { 5, 8, 0, 0, 23, 10, 24769 }, // ͭ
-    { 6, 6, 0, 0, 21, 9, 24779 }, // ͮ
-    { 8, 6, 0, -2, 21, 12, 24788 }, // ͯ
-    { 15, 24, 13, 0, 24, 90, 24800 }, // Ѐ
-    { 15, 24, 13, 0, 24, 90, 24890 }, // Ё
-    { 15, 19, 18, 2, 18, 72, 24980 }, // Ђ
-    { 15, 24, 13, 0, 24, 90, 25052 }, // Ѓ
-    { 16, 20, 15, 1, 19, 80, 25142 }, // Є
-    { 14, 20, 13, 0, 19, 70, 25222 }, // Ѕ
-    { 9, 18, 8, 0, 18, 41, 25292 }, // І
-    { 11, 24, 8, 0, 24, 66, 25333 }, // Ї
-    { 14, 24, 8, -5, 18, 84, 25399 }, // Ј
-    { 25, 19, 24, -1, 18, 119, 25483 }, // Љ
-    { 23, 18, 23, 0, 18, 104, 25602 }, // Њ
-    { 15, 18, 18, 2, 18, 68, 25706 }, // Ћ
-    { 18, 24, 16, 0, 24, 108, 25774 }, // Ќ
-    { 18, 24, 17, 0, 24, 108, 25882 }, // Ѝ
-    { 18, 25, 15, 0, 24, 113, 25990 }, // Ў
-    { 18, 22, 17, 0, 18, 99, 26103 }, // Џ
-    { 17, 18, 16, -2, 18, 77, 26202 }, // А
-    { 15, 18, 15, 0, 18, 68, 26279 }, // Б
-    { 16, 18, 15, 0, 18, 72, 26347 }, // В
-    { 15, 18, 13, 0, 18, 68, 26419 }, // Г
-    { 21, 22, 18, -3, 18, 116, 26487 }, // Д
-    { 15, 18, 13, 0, 18, 68, 26603 }, // Е
-    { 27, 18, 23, -2, 18, 122, 26671 }, // Ж
-    { 15, 20, 14, 0, 19, 75, 26793 }, // З
-    { 18, 18, 17, 0, 18, 81, 26868 }, // И
-    { 18, 24, 17, 0, 24, 108, 26949 }, // Й
-    { 18, 18, 16, 0, 18, 81, 27057 }, // К
-    { 19, 19, 17, -1, 18, 91, 27138 }, // Л
-    { 23, 18, 22, 0, 18, 104, 27229 }, // М
-    { 18, 18, 17, 0, 18, 81, 27333 }, // Н
-    { 17, 20, 18, 1, 19, 85, 27414 }, // О
-    { 18, 18, 17, 0, 18, 81, 27499 }, // П
-    { 16, 18, 15, 0, 18, 72, 27580 }, // Р
-    { 16, 20, 15, 1, 19, 80, 27652 }, // С
-    { 14, 18, 13, 2, 18, 63, 27732 }, // Т
-    { 18, 19, 15, 0, 18, 86, 27795 }, // У
-    { 21, 20, 22, 1, 19, 105, 27881 }, // Ф
-    { 20, 18, 15, -2, 18, 90, 27986 }, // Х
-    { 18, 22, 17, 0, 18, 99, 28076 }, // Ц
-    { 15, 18, 17, 2, 18, 68, 28175 }, // Ч
-    { 25, 18, 25, 0, 18, 113, 28243 }, // Ш
-    { 25, 22, 25, 0, 18, 138, 28356 }, // Щ
-    { 15, 18, 17, 2, 18, 68, 28494 }, // Ъ
-    { 23, 18, 22, 0, 18, 104, 28562 }, // Ы
-    { 15, 18, 15, 0, 18, 68, 28666 }, // Ь
-    { 16, 20, 15, 0, 19, 80, 28734 }, // Э
-    { 25, 20, 25, 0, 19, 125, 28814 }, // Ю
-    { 18, 18, 15, -2, 18, 81, 28939 }, // Я
-    { 15, 15, 15, 0, 14, 57, 29020 }, // а
-    { 14, 21, 14, 1, 20, 74, 29077 }, // б
-    { 14, 15, 14, 0, 14, 53, 29151 }, // в
-    { 13, 15, 12, -1, 14, 49, 29204 }, // г
-    { 14, 21, 14, 0, 20, 74, 29253 }, // д
-    { 13, 15, 13, 0, 14, 49, 29327 }, // е
-    { 26, 15, 24, -1, 14, 98, 29376 }, // ж
-    { 12, 15, 12, 0, 14, 45, 29474 }, // з
-    { 14, 15, 15, 1, 14, 53, 29519 }, // и
-    { 14, 21, 15, 1, 20, 74, 29572 }, // й
-    { 16, 14, 14, 0, 14, 56, 29646 }, // к
-    { 16, 15, 15, -1, 14, 60, 29702 }, // л
-    { 19, 14, 19, 0, 14, 67, 29762 }, // м
-    { 15, 14, 15, 0, 14, 53, 29829 }, // н
-    { 14, 15, 14, 0, 14, 53, 29882 }, // о
-    { 14, 14, 15, 0, 14, 49, 29935 }, // п
-    { 16, 20, 15, -1, 14, 80, 29984 }, // р
-    { 12, 15, 12, 0, 14, 45, 30064 }, // с
-    { 22, 14, 22, 0, 14, 77, 30109 }, // т
-    { 17, 20, 13, -2, 14, 85, 30186 }, // у
-    { 18, 25, 19, 0, 19, 113, 30271 }, // ф
-    { 17, 14, 13, -2, 14, 60, 30384 }, // х
-    { 14, 18, 15, 1, 14, 63, 30444 }, // ц
-    { 14, 14, 14, 1, 14, 49, 30507 }, // ч
-    { 22, 15, 22, 1, 14, 83, 30556 }, // ш
-    { 22, 18, 23, 1, 14, 99, 30639 }, // щ
-    { 15, 15, 16, 0, 14, 57, 30738 }, // ъ
-    { 20, 15, 20, 0, 14, 75, 30795 }, // ы
-    { 13, 15, 14, 0, 14, 49, 30870 }, // ь
-    { 12, 15, 12, 0, 14, 45, 30919 }, // э
-    { 20, 15, 20, 0, 14, 75, 30964 }, // ю
-    { 16, 14, 14, -2, 14, 56, 31039 }, // я
-    { 13, 21, 13, 0, 20, 69, 31095 }, // ѐ
-    { 13, 20, 13, 0, 19, 65, 31164 }, // ё
-    { 14, 25, 15, 0, 19, 88, 31229 }, // ђ
-    { 14, 21, 12, -1, 20, 74, 31317 }, // ѓ
-    { 12, 15, 12, 0, 14, 45, 31391 }, // є
-    { 12, 15, 11, 0, 14, 45, 31436 }, // ѕ
-    { 9, 20, 7, 0, 20, 45, 31481 }, // і
-    { 10, 19, 7, 0, 19, 48, 31526 }, // ї
-    { 13, 26, 7, -4, 20, 85, 31574 }, // ј
-    { 22, 15, 21, -1, 14, 83, 31659 }, // љ
-    { 21, 15, 21, 0, 14, 79, 31742 }, // њ
-    { 14, 19, 15, 0, 19, 67, 31821 }, // ћ
-    { 16, 20, 14, 0, 20, 80, 31888 }, // ќ
-    { 14, 21, 15, 1, 20, 74, 31968 }, // ѝ
-    { 17, 26, 13, -2, 20, 111, 32042 }, // ў
-    { 14, 19, 15, 1, 14, 67, 32153 }, // џ
-    { 23, 18, 22, 2, 18, 104, 32220 }, // Ѡ
-    { 21, 14, 20, 1, 14, 74, 32324 }, // ѡ
-    { 14, 18, 16, 1, 18, 63, 32398 }, // Ѣ
-    { 20, 15, 21, 0, 14, 75, 32461 }, // ѣ
-    { 24, 20, 22, 0, 19, 120, 32536 }, // Ѥ
-    { 19, 15, 19, 0, 14, 72, 32656 }, // ѥ
-    { 18, 18, 17, -2, 18, 81, 32728 }, // Ѧ
-    { 16, 14, 15, -2, 14, 56, 32809 }, // ѧ
-    { 22, 18, 23, 0, 18, 99, 32865 }, // Ѩ
-    { 20, 14, 21, 0, 14, 70, 32964 }, // ѩ
-    { 21, 18, 18, -2, 18, 95, 33034 }, // Ѫ
-    { 17, 14, 14, -2, 14, 60, 33129 }, // ѫ
-    { 26, 18, 25, 0, 18, 117, 33189 }, // Ѭ
-    { 22, 14, 21, 0, 14, 77, 33306 }, // ѭ
-    { 16, 28, 15, -1, 22, 112, 33383 }, // Ѯ
-    { 15, 23, 13, -2, 17, 87, 33495 }, // ѯ
-    { 21, 18, 21, 2, 18, 95, 33582 }, // Ѱ
-    { 19, 25, 20, 1, 19, 119, 33677 }, // ѱ
-    { 17, 20, 18, 1, 19, 85, 33796 }, // Ѳ
-    { 13, 15, 15, 1, 14, 49, 33881 }, // ѳ
-    { 16, 18, 16, 2, 18, 72, 33930 }, // Ѵ
-    { 14, 14, 14, 1, 14, 49, 34002 }, // ѵ
-    { 16, 24, 16, 2, 24, 96, 34051 }, // Ѷ
-    { 14, 20, 14, 1, 20, 70, 34147 }, // ѷ
-    { 32, 25, 31, 1, 19, 200, 34217 }, // Ѹ
-    { 28, 20, 28, 1, 14, 140, 34417 }, // ѹ
-    { 18, 22, 19, 1, 20, 99, 34557 }, // Ѻ
-    { 14, 17, 16, 1, 15, 60, 34656 }, // ѻ
-    { 24, 27, 25, 1, 26, 162, 34716 }, // Ѽ
-    { 20, 23, 22, 1, 22, 115, 34878 }, // ѽ
-    { 23, 23, 22, 2, 23, 133, 34993 }, // Ѿ
-    { 21, 19, 20, 1, 19, 100, 35126 }, // ѿ
-    { 16, 25, 15, 1, 19, 100, 35226 }, // Ҁ
-    { 12, 20, 12, 1, 14, 60, 35326 }, // ҁ
-    { 13, 17, 15, 1, 16, 56, 35386 }, // ҂
-    { 10, 5, 0, -10, 19, 13, 35442 }, // ҃
-    { 10, 4, 0, -10, 19, 10, 35455 }, // ҄
-    { 5, 6, 0, -7, 20, 8, 35465 }, // ҅
-    { 5, 6, 0, -7, 20, 8, 35473 }, // ҆
-    { 11, 4, 0, -3, 23, 11, 35481 }, // ҇
-    { 30, 27, 0, -15, 20, 203, 35492 }, // ҈
-    { 28, 28, 0, -14, 21, 196, 35695 }, // ҉
-    { 20, 30, 21, 0, 24, 150, 35891 }, // Ҋ
-    { 15, 25, 16, 1, 20, 94, 36041 }, // ҋ
-    { 14, 18, 15, 0, 18, 63, 36135 }, // Ҍ
-    { 12, 20, 14, 1, 19, 60, 36198 }, // ҍ
-    { 16, 18, 15, 0, 18, 72, 36258 }, // Ҏ
-    { 15, 20, 15, -1, 14, 75, 36330 }, // ҏ
-    { 16, 22, 13, 0, 22, 88, 36405 }, // Ґ
-    { 14, 18, 12, 0, 18, 63, 36493 }, // ґ
-    { 15, 18, 13, 0, 18, 68, 36556 }, // Ғ
-    { 14, 14, 12, -1, 14, 49, 36624 }, // ғ
-    { 15, 25, 17, 0, 18, 94, 36673 }, // Ҕ
-    { 13, 21, 14, 0, 14, 69, 36767 }, // ҕ
-    { 26, 24, 23, -2, 18, 156, 36836 }, // Җ
-    { 26, 19, 24, -1, 14, 124, 36992 }, // җ
-    { 15, 26, 14, 0, 19, 98, 37116 }, // Ҙ
-    { 12, 21, 12, 0, 14, 63, 37214 }, // ҙ
-    { 18, 24, 17, 0, 18, 108, 37277 }, // Қ
-    { 16, 19, 15, 0, 14, 76, 37385 }, // қ
-    { 18, 18, 16, 0, 18, 81, 37461 }, // Ҝ
-    { 15, 14, 15, 1, 14, 53, 37542 }, // ҝ
-    { 18, 18, 15, 0, 18, 81, 37595 }, // Ҟ
-    { 16, 19, 14, 0, 19, 76, 37676 }, // ҟ
-    { 18, 18, 18, 2, 18, 81, 37752 }, // Ҡ
-    { 18, 14, 16, 0, 14, 63, 37833 }, // ҡ
-    { 18, 24, 19, 0, 18, 108, 37896 }, // Ң
-    { 16, 19, 17, 0, 14, 76, 38004 }, // ң
-    { 22, 18, 19, 0, 18, 99, 38080 }, // Ҥ
-    { 20, 14, 18, 0, 14, 70, 38179 }, // ҥ
-    { 24, 25, 26, 0, 18, 150, 38249 }, // Ҧ
-    { 20, 21, 22, 0, 14, 105, 38399 }, // ҧ
-    { 17, 21, 18, 1, 19, 90, 38504 }, // Ҩ
-    { 14, 15, 15, 1, 14, 53, 38594 }, // ҩ
-    { 16, 26, 15, 1, 19, 104, 38647 }, // Ҫ
-    { 12, 21, 12, 1, 14, 63, 38751 }, // ҫ
-    { 14, 24, 13, 2, 18, 84, 38814 }, // Ҭ
-    { 23, 19, 23, 0, 14, 110, 38898 }, // ҭ
-    { 15, 18, 14, 2, 18, 68, 39008 }, // Ү
-    { 14, 20, 13, 1, 14, 70, 39076 }, // ү
-    { 17, 18, 14, 0, 18, 77, 39146 }, // Ұ
-    { 16, 20, 13, -1, 14, 80, 39223 }, // ұ
-    { 20, 24, 17, -2, 18, 120, 39303 }, // Ҳ
-    { 16, 19, 15, -1, 14, 76, 39423 }, // ҳ
-    { 19, 24, 21, 2, 18, 114, 39499 }, // Ҵ
-    { 16, 19, 17, 1, 14, 76, 39613 }, // ҵ
-    { 16, 24, 19, 2, 18, 96, 39689 }, // Ҷ
-    { 13, 19, 16, 2, 14, 62, 39785 }, // ҷ
-    { 15, 18, 17, 2, 18, 68, 39847 }, // Ҹ
-    { 13, 14, 15, 2, 14, 46, 39915 }, // ҹ
-    { 16, 18, 17, 0, 18, 72, 39961 }, // Һ
-    { 14, 19, 15, 0, 19, 67, 40033 }, // һ
-    { 20, 20, 19, 0, 19, 100, 40100 }, // Ҽ
-    { 16, 15, 17, 0, 14, 60, 40200 }, // ҽ
-    { 20, 25, 19, 0, 19, 125, 40260 }, // Ҿ
-    { 16, 19, 17, 0, 14, 76, 40385 }, // ҿ
-    { 12, 18, 10, -1, 18, 54, 40461 }, // Ӏ
-    { 27, 24, 23, -2, 24, 162, 40515 }, // Ӂ
-    { 26, 21, 24, -1, 20, 137, 40677 }, // ӂ
-    { 18, 25, 17, 0, 18, 113, 40814 }, // Ӄ
-    { 16, 21, 15, 0, 14, 84, 40927 }, // ӄ
-    { 20, 24, 19, -1, 18, 120, 41011 }, // Ӆ
-    { 17, 19, 16, -1, 14, 81, 41131 }, // ӆ
-    { 18, 25, 18, 0, 18, 113, 41212 }, // Ӈ
-    { 15, 21, 15, 0, 14, 79, 41325 }, // ӈ
-    { 19, 24, 19, 0, 18, 114, 41404 }, // Ӊ
-    { 16, 19, 17, 0, 14, 76, 41518 }, // ӊ
-    { 15, 24, 17, 2, 18, 90, 41594 }, // Ӌ
-    { 13, 19, 15, 2, 14, 62, 41684 }, // ӌ
-    { 23, 24, 24, 0, 18, 138, 41746 }, // Ӎ
-    { 21, 19, 21, 0, 14, 100, 41884 }, // ӎ
-    { 12, 18, 10, -1, 18, 54, 41984 }, // ӏ
-    { 18, 24, 16, -2, 24, 108, 42038 }, // Ӑ
-    { 14, 21, 15, 1, 20, 74, 42146 }, // ӑ
-    { 17, 23, 16, -2, 23, 98, 42220 }, // Ӓ
-    { 14, 20, 15, 1, 19, 70, 42318 }, // ӓ
-    { 26, 18, 22, -2, 18, 117, 42388 }, // Ӕ
-    { 21, 15, 22, 1, 14, 79, 42505 }, // ӕ
-    { 16, 24, 14, 0, 24, 96, 42584 }, // Ӗ
-    { 14, 21, 14, 1, 20, 74, 42680 }, // ӗ
-    { 16, 20, 17, 0, 19, 80, 42754 }, // Ә
-    { 13, 15, 14, 0, 14, 49, 42834 }, // ә
-    { 16, 24, 17, 0, 23, 96, 42883 }, // Ӛ
-    { 13, 20, 14, 0, 19, 65, 42979 }, // ӛ
-    { 27, 23, 23, -2, 23, 156, 43044 }, // Ӝ
-    { 26, 20, 24, -1, 19, 130, 43200 }, // ӝ
-    { 15, 24, 14, 0, 23, 90, 43330 }, // Ӟ
-    { 13, 20, 12, 0, 19, 65, 43420 }, // ӟ
-    { 16, 19, 14, -1, 18, 76, 43485 }, // Ӡ
-    { 16, 21, 14, -2, 14, 84, 43561 }, // ӡ
-    { 18, 22, 17, 0, 22, 99, 43645 }, // Ӣ
-    { 14, 19, 15, 1, 18, 67, 43744 }, // ӣ
-    { 18, 23, 17, 0, 23, 104, 43811 }, // Ӥ
-    { 14, 20, 15, 1, 19, 70, 43915 }, // ӥ
-    { 17, 24, 18, 1, 23, 102, 43985 }, // Ӧ
-    { 13, 20, 15, 1, 19, 65, 44087 }, // ӧ
-    { 17, 20, 18, 1, 19, 85, 44152 }, // Ө
-    { 13, 15, 15, 1, 14, 49, 44237 }, // ө
-    { 17, 24, 18, 1, 23, 102, 44286 }, // Ӫ
-    { 13, 20, 15, 1, 19, 65, 44388 }, // ӫ
-    { 16, 24, 15, 0, 23, 96, 44453 }, // Ӭ
-    { 12, 20, 12, 0, 19, 60, 44549 }, // ӭ
-    { 18, 23, 15, 0, 22, 104, 44609 }, // Ӯ
-    { 17, 24, 13, -2, 18, 102, 44713 }, // ӯ
-    { 18, 24, 15, 0, 23, 108, 44815 }, // Ӱ
-    { 17, 25, 13, -2, 19, 107, 44923 }, // ӱ
-    { 18, 25, 15, 0, 24, 113, 45030 }, // Ӳ
-    { 18, 26, 13, -2, 20, 117, 45143 }, // ӳ
-    { 15, 23, 17, 2, 23, 87, 45260 }, // Ӵ
-    { 14, 19, 14, 1, 19, 67, 45347 }, // ӵ
-    { 15, 24, 13, 0, 18, 90, 45414 }, // Ӷ
-    { 13, 19, 12, 0, 14, 62, 45504 }, // ӷ
-    { 23, 23, 22, 0, 23, 133, 45566 }, // Ӹ
-    { 20, 20, 20, 0, 19, 100, 45699 }, // ӹ
-    { 15, 25, 13, 0, 18, 94, 45799 }, // Ӻ
-    { 14, 21, 12, -1, 14, 74, 45893 }, // ӻ
-    { 20, 25, 17, -2, 18, 125, 45967 }, // Ӽ
-    { 17, 21, 15, -2, 14, 90, 46092 }, // ӽ
-    { 20, 18, 15, -2, 18, 90, 46182 }, // Ӿ
-    { 17, 14, 13, -2, 14, 60, 46272 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 46332 }, //  
-    { 0, 0, 25, 0, 0, 0, 46332 }, //  
-    { 0, 0, 13, 0, 0, 0, 46332 }, //  
-    { 0, 0, 25, 0, 0, 0, 46332 }, //  
-    { 0, 0, 8, 0, 0, 0, 46332 }, //  
-    { 0, 0, 6, 0, 0, 0, 46332 }, //  
-    { 0, 0, 4, 0, 0, 0, 46332 }, //  
-    { 0, 0, 14, 0, 0, 0, 46332 }, //  
-    { 0, 0, 7, 0, 0, 0, 46332 }, //  
-    { 0, 0, 4, 0, 0, 0, 46332 }, //  
-    { 0, 0, 3, 0, 0, 0, 46332 }, //  
-    { 0, 0, 0, 0, 0, 0, 46332 }, // ​
-    { 0, 0, 0, 0, 0, 0, 46332 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 46332 }, // ‍
-    { 7, 22, 0, -1, 18, 39, 46332 }, // ‎
-    { 7, 22, 0, -6, 18, 39, 46371 }, // ‏
-    { 8, 4, 8, 0, 9, 8, 46410 }, // ‐
-    { 8, 4, 8, 0, 9, 8, 46418 }, // ‑
-    { 14, 4, 14, 0, 11, 14, 46426 }, // ‒
-    { 12, 4, 12, 0, 9, 12, 46440 }, // –
-    { 24, 4, 24, 0, 9, 24, 46452 }, // —
-    { 24, 4, 24, 0, 9, 24, 46476 }, // ―
-    { 10, 25, 14, 2, 19, 63, 46500 }, // ‖
-    { 12, 6, 10, -3, 0, 18, 46563 }, // ‗
-    { 7, 7, 5, 1, 18, 13, 46581 }, // ‘
-    { 7, 7, 5, 1, 18, 13, 46594 }, // ’
-    { 7, 7, 7, -2, 3, 13, 46607 }, // ‚
-    { 5, 7, 5, 2, 18, 9, 46620 }, // ‛
-    { 12, 7, 11, 1, 18, 21, 46629 }, // “
-    { 12, 7, 11, 1, 18, 21, 46650 }, // ”
-    { 13, 7, 12, -2, 3, 23, 46671 }, // „
-    { 10, 7, 11, 2, 18, 18, 46694 }, // ‟
-    { 11, 19, 13, 2, 19, 53, 46712 }, // †
-    { 14, 19, 13, 0, 19, 67, 46765 }, // ‡
-    { 8, 8, 9, 1, 13, 16, 46832 }, // •
-    { 8, 10, 9, 1, 14, 20, 46848 }, // ‣
-    { 6, 5, 13, 2, 4, 8, 46868 }, // ․
-    { 12, 5, 14, 0, 4, 15, 46876 }, // ‥
-    { 19, 5, 21, 0, 4, 24, 46891 }, // …
-    { 6, 5, 8, 1, 9, 8, 46915 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 46923 }, //  
-    { 0, 0, 15, 0, 0, 0, 46923 }, //  
-    { 7, 20, 0, -1, 16, 35, 46923 }, // ‪
-    { 7, 20, 0, -6, 16, 35, 46958 }, // ‫
-    { 6, 22, 0, -3, 18, 33, 46993 }, // ‬
-    { 6, 22, 0, -3, 18, 33, 47026 }, // ‭
-    { 6, 22, 0, -3, 18, 33, 47059 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 47092 }, //  
-    { 29, 20, 30, 1, 19, 145, 47092 }, // ‰
-    { 38, 20, 40, 1, 19, 190, 47237 }, // ‱
-    { 8, 7, 7, 1, 18, 14, 47427 }, // ′
-    { 14, 7, 13, 1, 18, 25, 47441 }, // ″
-    { 20, 7, 19, 1, 18, 35, 47466 }, // ‴
-    { 7, 7, 7, 1, 18, 13, 47501 }, // ‵
-    { 13, 7, 13, 1, 18, 23, 47514 }, // ‶
-    { 19, 7, 19, 1, 18, 34, 47537 }, // ‷
-    { 9, 9, 9, -2, 3, 21, 47571 }, // ‸
-    { 9, 12, 8, 0, 13, 27, 47592 }, // ‹
-    { 8, 12, 8, 0, 13, 24, 47619 }, // ›
-    { 21, 20, 21, 0, 19, 105, 47643 }, // ※
-    { 15, 19, 14, 0, 18, 72, 47748 }, // ‼
-    { 11, 20, 12, 2, 19, 55, 47820 }, // ‽
-    { 12, 4, 11, 2, 22, 12, 47875 }, // ‾
-    { 14, 6, 13, -2, 0, 21, 47887 }, // ‿
-    { 13, 6, 13, 2, 20, 20, 47908 }, // ⁀
-    { 14, 17, 10, -3, 11, 60, 47928 }, // ⁁
-    { 29, 24, 29, -1, 20, 174, 47988 }, // ⁂
-    { 8, 4, 8, 0, 9, 8, 48162 }, // ⁃
-    { 17, 18, 3, -7, 18, 77, 48170 }, // ⁄
-    { 11, 22, 8, -1, 18, 61, 48247 }, // ⁅
-    { 11, 22, 8, -2, 18, 61, 48308 }, // ⁆
-    { 23, 20, 23, 1, 19, 115, 48369 }, // ⁇
-    { 19, 20, 19, 1, 19, 95, 48484 }, // ⁈
-    { 20, 20, 19, 0, 19, 100, 48579 }, // ⁉
-    { 13, 14, 13, 1, 14, 46, 48679 }, // ⁊
-    { 14, 23, 16, 2, 19, 81, 48725 }, // ⁋
-    { 14, 13, 16, 1, 14, 46, 48806 }, // ⁌
-    { 14, 13, 16, 1, 14, 46, 48852 }, // ⁍
-    { 13, 13, 14, -1, 8, 43, 48898 }, // ⁎
-    { 7, 18, 7, 0, 14, 32, 48941 }, // ⁏
-    { 17, 26, 13, -2, 20, 111, 48973 }, // ⁐
-    { 16, 26, 14, -1, 20, 104, 49084 }, // ⁑
-    { 11, 20, 11, 0, 19, 55, 49188 }, // ⁒
-    { 24, 6, 25, 1, 10, 36, 49243 }, // ⁓
-    { 14, 6, 13, -3, 0, 21, 49279 }, // ⁔
-    { 14, 14, 14, 0, 13, 49, 49300 }, // ⁕
-    { 12, 20, 14, 1, 19, 60, 49349 }, // ⁖
-    { 23, 7, 22, 1, 18, 41, 49409 }, // ⁗
-    { 19, 20, 21, 1, 19, 95, 49450 }, // ⁘
-    { 19, 20, 21, 1, 19, 95, 49545 }, // ⁙
-    { 5, 20, 7, 1, 19, 25, 49640 }, // ⁚
-    { 16, 21, 18, 1, 20, 84, 49665 }, // ⁛
-    { 20, 20, 21, 0, 19, 100, 49749 }, // ⁜
-    { 5, 20, 7, 1, 19, 25, 49849 }, // ⁝
-    { 5, 20, 7, 1, 19, 25, 49874 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 49899 }, //  
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁤
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁦
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁧
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁨
-    { 0, 0, 15, 0, 0, 0, 49899 }, // ⁩
-    { 6, 22, 0, -3, 18, 33, 49899 }, // ⁪
-    { 6, 22, 0, -3, 18, 33, 49932 }, // ⁫
-    { 6, 22, 0, -3, 18, 33, 49965 }, // ⁬
-    { 6, 22, 0, -3, 18, 33, 49998 }, // ⁭
-    { 6, 22, 0, -3, 18, 33, 50031 }, // ⁮
-    { 6, 22, 0, -3, 18, 33, 50064 }, // ⁯
-    { 9, 12, 9, 2, 22, 27, 50097 }, // ⁰
-    { 6, 12, 6, 1, 19, 18, 50124 }, // ⁱ
-    { 10, 12, 9, 1, 22, 30, 50142 }, // ⁴
-    { 10, 12, 9, 1, 22, 30, 50172 }, // ⁵
-    { 9, 12, 9, 2, 22, 27, 50202 }, // ⁶
-    { 10, 12, 9, 2, 22, 30, 50229 }, // ⁷
-    { 10, 12, 9, 1, 22, 30, 50259 }, // ⁸
-    { 9, 12, 9, 2, 22, 27, 50289 }, // ⁹
-    { 9, 8, 9, 2, 19, 18, 50316 }, // ⁺
-    { 9, 2, 9, 2, 16, 5, 50334 }, // ⁻
-    { 8, 6, 10, 3, 18, 12, 50339 }, // ⁼
-    { 6, 15, 6, 3, 23, 23, 50351 }, // ⁽
-    { 7, 15, 6, 0, 23, 27, 50374 }, // ⁾
-    { 10, 9, 10, 1, 16, 23, 50401 }, // ⁿ
-    { 10, 12, 9, -1, 8, 30, 50424 }, // ₀
-    { 9, 12, 9, -1, 8, 27, 50454 }, // ₁
-    { 10, 12, 9, -2, 8, 30, 50481 }, // ₂
-    { 10, 12, 9, -2, 8, 30, 50511 }, // ₃
-    { 10, 12, 9, -2, 8, 30, 50541 }, // ₄
-    { 10, 12, 9, -1, 8, 30, 50571 }, // ₅
-    { 10, 12, 9, -1, 8, 30, 50601 }, // ₆
-    { 10, 12, 9, -1, 8, 30, 50631 }, // ₇
-    { 9, 12, 9, -1, 8, 27, 50661 }, // ₈
-    { 9, 12, 9, -1, 8, 27, 50688 }, // ₉
-    { 8, 8, 9, 0, 6, 16, 50715 }, // ₊
-    { 8, 2, 9, 0, 3, 4, 50731 }, // ₋
-    { 8, 6, 10, 0, 5, 12, 50735 }, // ₌
-    { 7, 15, 6, 0, 10, 27, 50747 }, // ₍
-    { 7, 15, 6, -3, 10, 27, 50774 }, // ₎
-    { 10, 9, 10, -1, 6, 23, 50801 }, // ₐ
-    { 9, 9, 9, -1, 6, 21, 50824 }, // ₑ
-    { 9, 9, 10, -1, 6, 21, 50845 }, // ₒ
-    { 12, 9, 9, -3, 6, 27, 50866 }, // ₓ
-    { 9, 9, 9, -1, 6, 21, 50893 }, // ₔ
-    { 10, 12, 11, -1, 9, 30, 50914 }, // ₕ
-    { 11, 12, 10, -1, 9, 33, 50944 }, // ₖ
-    { 6, 12, 6, -1, 9, 18, 50977 }, // ₗ
-    { 15, 9, 16, -1, 6, 34, 50995 }, // ₘ
-    { 9, 9, 10, -1, 6, 21, 51029 }, // ₙ
-    { 10, 12, 10, -2, 6, 30, 51050 }, // ₚ
-    { 8, 9, 8, -1, 6, 18, 51080 }, // ₛ
-    { 7, 11, 7, -1, 8, 20, 51098 }, // ₜ
-    { 14, 19, 14, 1, 19, 67, 51118 }, // ₠
-    { 16, 21, 14, 0, 19, 84, 51185 }, // ₡
-    { 16, 20, 14, 0, 19, 80, 51269 }, // ₢
-    { 15, 18, 14, 0, 18, 68, 51349 }, // ₣
-    { 17, 19, 14, -1, 19, 81, 51417 }, // ₤
-    { 22, 20, 23, 0, 17, 110, 51498 }, // ₥
-    { 16, 18, 15, 0, 18, 72, 51608 }, // ₦
-    { 22, 19, 21, 0, 18, 105, 51680 }, // ₧
-    { 23, 19, 22, 0, 18, 110, 51785 }, // ₨
-    { 20, 18, 18, 0, 18, 90, 51895 }, // ₩
-    { 22, 18, 22, 0, 18, 99, 51985 }, // ₪
-    { 17, 23, 15, 0, 19, 98, 52084 }, // ₫
-    { 16, 20, 14, 0, 19, 80, 52182 }, // €
-    { 17, 18, 14, 0, 18, 77, 52262 }, // ₭
-    { 16, 18, 13, 0, 18, 72, 52339 }, // ₮
-    { 25, 25, 25, 0, 19, 157, 52411 }, // ₯
-    { 17, 25, 15, -2, 19, 107, 52568 }, // ₰
-    { 16, 18, 14, 0, 18, 72, 52675 }, // ₱
-    { 17, 22, 17, 1, 20, 94, 52747 }, // ₲
-    { 18, 18, 15, -2, 18, 81, 52841 }, // ₳
-    { 15, 20, 14, 0, 19, 75, 52922 }, // ₴
-    { 16, 21, 15, 1, 19, 84, 52997 }, // ₵
-    { 18, 18, 17, 0, 17, 81, 53081 }, // ₶
-    { 19, 21, 17, -1, 19, 100, 53162 }, // ₷
-    { 14, 18, 13, 1, 18, 63, 53262 }, // ₸
-    { 14, 18, 14, 1, 18, 63, 53325 }, // ₹
-    { 14, 19, 14, 0, 18, 67, 53388 }, // ₺
-    { 16, 20, 16, 1, 19, 80, 53455 }, // ₻
-    { 20, 18, 20, -1, 18, 90, 53535 }, // ₼
-    { 16, 18, 15, -1, 18, 72, 53625 }, // ₽
-    { 18, 21, 15, -1, 21, 95, 53697 }, // ₾
-    { 14, 24, 14, 0, 21, 84, 53792 }, // ₿
-    { 8, 4, 8, 0, 9, 8, 53876 }, // −
-    { 23, 23, 25, 1, 19, 133, 53884 }, // �
+    { 15, 18, 14, 0, 18, 68, 2048 }, // E
+    { 15, 18, 13, 0, 18, 68, 2116 }, // F
+    { 16, 20, 17, 1, 19, 80, 2184 }, // G
+    { 18, 18, 18, 0, 18, 81, 2264 }, // H
+    { 12, 18, 10, -1, 18, 54, 2345 }, // I
+    { 13, 24, 8, -4, 18, 78, 2399 }, // J
+    { 18, 18, 15, 0, 18, 81, 2477 }, // K
+    { 12, 18, 13, 0, 18, 54, 2558 }, // L
+    { 23, 18, 22, 0, 18, 104, 2612 }, // M
+    { 20, 18, 19, 0, 18, 90, 2716 }, // N
+    { 17, 20, 18, 1, 19, 85, 2806 }, // O
+    { 16, 18, 15, 0, 18, 72, 2891 }, // P
+    { 17, 24, 18, 1, 19, 102, 2963 }, // Q
+    { 15, 18, 16, 0, 18, 68, 3065 }, // R
+    { 14, 20, 13, 0, 19, 70, 3133 }, // S
+    { 14, 18, 13, 2, 18, 63, 3203 }, // T
+    { 17, 19, 17, 1, 18, 81, 3266 }, // U
+    { 15, 18, 15, 2, 18, 68, 3347 }, // V
+    { 23, 18, 22, 2, 18, 104, 3415 }, // W
+    { 20, 18, 15, -2, 18, 90, 3519 }, // X
+    { 15, 18, 14, 2, 18, 68, 3609 }, // Y
+    { 16, 18, 13, -1, 18, 72, 3677 }, // Z
+    { 11, 22, 8, -1, 18, 61, 3749 }, // [
+    { 7, 19, 11, 2, 18, 34, 3810 }, // <backslash>
+    { 11, 22, 8, -2, 18, 61, 3844 }, // ]
+    { 14, 12, 14, 0, 18, 42, 3905 }, // ^
+    { 12, 2, 10, -3, -2, 6, 3947 }, // _
+    { 6, 5, 8, 3, 20, 8, 3953 }, // `
+    { 14, 15, 15, 1, 14, 53, 3961 }, // a
+    { 14, 20, 15, 0, 19, 70, 4014 }, // b
+    { 12, 15, 12, 1, 14, 45, 4096 }, // c
+    { 15, 20, 15, 1, 19, 75, 4141 }, // d
+    { 13, 15, 14, 1, 14, 49, 4216 }, // e
+    { 16, 26, 9, -3, 20, 104, 4265 }, // f
+    { 15, 20, 15, 0, 14, 75, 4369 }, // g
+    { 14, 19, 15, 0, 19, 67, 4444 }, // h
+    { 9, 20, 7, 0, 20, 45, 4511 }, // i
+    { 13, 26, 7, -4, 20, 85, 4556 }, // j
+    { 16, 19, 14, 0, 19, 76, 4641 }, // k
+    { 9, 19, 7, 0, 19, 43, 4717 }, // l
+    { 22, 14, 23, 0, 14, 77, 4760 }, // m
+    { 14, 14, 15, 0, 14, 49, 4837 }, // n
+    { 13, 15, 15, 1, 14, 49, 4886 }, // o
+    { 15, 20, 15, -1, 14, 75, 4935 }, // p
+    { 14, 20, 15, 1, 14, 70, 5010 }, // q
+    { 12, 14, 11, 0, 14, 42, 5080 }, // r
+    { 12, 15, 12, 0, 14, 45, 5122 }, // s
+    { 10, 18, 10, 1, 17, 45, 5167 }, // t
+    { 14, 15, 15, 1, 14, 53, 5212 }, // u
+    { 14, 14, 13, 1, 14, 49, 5265 }, // v
+    { 20, 14, 20, 1, 14, 70, 5314 }, // w
+    { 17, 14, 13, -2, 14, 60, 5384 }, // x
+    { 17, 20, 13, -2, 14, 85, 5444 }, // y
+    { 13, 14, 12, -1, 14, 46, 5529 }, // z
+    { 12, 22, 9, -1, 18, 66, 5575 }, // {
+    { 4, 25, 14, 5, 19, 25, 5641 }, // |
+    { 11, 22, 9, -2, 18, 61, 5666 }, // }
+    { 13, 5, 14, 1, 11, 17, 5727 }, // ~
+    { 0, 0, 7, 0, 0, 0, 5744 }, //  
+    { 8, 19, 7, -1, 14, 38, 5744 }, // ¡
+    { 12, 20, 14, 2, 19, 60, 5782 }, // ¢
+    { 17, 19, 14, -1, 19, 81, 5842 }, // £
+    { 12, 12, 14, 1, 15, 36, 5923 }, // ¤
+    { 15, 18, 14, 1, 18, 68, 5959 }, // ¥
+    { 4, 25, 14, 5, 19, 25, 6027 }, // ¦
+    { 13, 21, 12, 0, 20, 69, 6052 }, // §
+    { 9, 4, 14, 5, 19, 9, 6121 }, // ¨
+    { 19, 20, 21, 1, 19, 95, 6144 }, // ©
+    { 10, 10, 9, 1, 19, 25, 6239 }, // ª
+    { 15, 12, 14, 0, 13, 45, 6264 }, // «
+    { 13, 8, 14, 1, 11, 26, 6309 }, // ¬
+    { 8, 4, 8, 0, 9, 8, 6335 }, // ­
+    { 19, 20, 21, 1, 19, 95, 6343 }, // ®
+    { 12, 4, 11, 2, 22, 12, 6438 }, // ¯
+    { 9, 10, 11, 1, 19, 23, 6450 }, // °
+    { 13, 16, 14, 1, 16, 52, 6473 }, // ±
+    { 10, 12, 9, 1, 22, 30, 6525 }, // ²
+    { 10, 12, 9, 1, 22, 30, 6555 }, // ³
+    { 8, 5, 8, 2, 20, 10, 6585 }, // ´
+    { 16, 20, 15, -1, 14, 80, 6595 }, // µ
+    { 14, 23, 16, 1, 19, 81, 6675 }, // ¶
+    { 6, 5, 7, 1, 11, 8, 6756 }, // ·
+    { 7, 6, 5, -3, 0, 11, 6764 }, // ¸
+    { 8, 12, 9, 2, 22, 24, 6775 }, // ¹
+    { 8, 9, 9, 2, 18, 18, 6799 }, // º
+    { 14, 12, 14, 0, 13, 42, 6817 }, // »
+    { 19, 19, 21, 1, 19, 91, 6859 }, // ¼
+    { 21, 19, 22, 1, 19, 100, 6950 }, // ½
+    { 20, 19, 22, 1, 19, 95, 7050 }, // ¾
+    { 11, 19, 12, -1, 14, 53, 7145 }, // ¿
+    { 17, 24, 16, -2, 24, 102, 7198 }, // À
+    { 18, 24, 16, -2, 24, 108, 7300 }, // Á
+    { 18, 24, 16, -2, 24, 108, 7408 }, // Â
+    { 18, 23, 16, -2, 23, 104, 7516 }, // Ã
+    { 17, 23, 16, -2, 23, 98, 7620 }, // Ä
+    { 17, 25, 16, -2, 25, 107, 7718 }, // Å
+    { 26, 18, 22, -2, 18, 117, 7825 }, // Æ
+    { 16, 25, 15, 1, 19, 100, 7942 }, // Ç
+    { 15, 24, 14, 0, 24, 90, 8042 }, // È
+    { 15, 24, 14, 0, 24, 90, 8192 }, // É
+    { 15, 24, 14, 0, 24, 90, 8282 }, // Ê
+    { 15, 23, 14, 0, 23, 87, 8372 }, // Ë
+    { 12, 24, 10, -1, 24, 72, 8459 }, // Ì
+    { 14, 24, 10, -1, 24, 84, 8531 }, // Í
+    { 14, 24, 10, -1, 24, 84, 8615 }, // Î
+    { 13, 23, 10, -1, 23, 75, 8699 }, // Ï
+    { 17, 18, 17, 0, 18, 77, 8774 }, // Ð
+    { 20, 23, 19, 0, 23, 115, 8851 }, // Ñ
+    { 17, 25, 18, 1, 24, 107, 8966 }, // Ò
+    { 17, 25, 18, 1, 24, 107, 9073 }, // Ó
+    { 17, 25, 18, 1, 24, 107, 9180 }, // Ô
+    { 17, 24, 18, 1, 23, 102, 9287 }, // Õ
+    { 17, 24, 18, 1, 23, 102, 9389 }, // Ö
+    { 12, 12, 14, 1, 15, 36, 9491 }, // ×
+    { 17, 21, 18, 1, 19, 90, 9527 }, // Ø
+    { 17, 25, 17, 1, 24, 107, 9617 }, // Ù
+    { 17, 25, 17, 1, 24, 107, 9724 }, // Ú
+    { 17, 25, 17, 1, 24, 107, 9831 }, // Û
+    { 17, 24, 17, 1, 23, 102, 9938 }, // Ü
+    { 15, 24, 14, 2, 24, 90, 10040 }, // Ý
+    { 15, 18, 15, 0, 18, 68, 10130 }, // Þ
+    { 20, 26, 16, -4, 20, 130, 10240 }, // ß
+    { 14, 21, 15, 1, 20, 74, 10370 }, // à
+    { 14, 21, 15, 1, 20, 74, 10444 }, // á
+    { 14, 21, 15, 1, 20, 74, 10518 }, // â
+    { 14, 20, 15, 1, 19, 70, 10592 }, // ã
+    { 14, 20, 15, 1, 19, 70, 10662 }, // ä
+    { 14, 22, 15, 1, 21, 77, 10732 }, // å
+    { 21, 15, 22, 1, 14, 79, 10809 }, // æ
+    { 12, 20, 12, 1, 14, 60, 10888 }, // ç
+    { 13, 21, 14, 1, 20, 69, 10948 }, // è
+    { 13, 21, 14, 1, 20, 69, 11017 }, // é
+    { 13, 21, 14, 1, 20, 69, 11086 }, // ê
+    { 13, 20, 14, 1, 19, 65, 11155 }, // ë
+    { 8, 20, 7, 0, 20, 40, 11220 }, // ì
+    { 11, 20, 7, 0, 20, 55, 11260 }, // í
+    { 11, 20, 7, 0, 20, 55, 11315 }, // î
+    { 10, 19, 7, 0, 19, 48, 11370 }, // ï
+    { 15, 21, 14, 0, 20, 79, 11418 }, // ð
+    { 15, 19, 15, 0, 19, 72, 11497 }, // ñ
+    { 13, 21, 15, 1, 20, 69, 11569 }, // ò
+    { 13, 21, 15, 1, 20, 69, 11638 }, // ó
+    { 13, 21, 15, 1, 20, 69, 11707 }, // ô
+    { 14, 20, 15, 1, 19, 70, 11776 }, // õ
+    { 13, 20, 15, 1, 19, 65, 11846 }, // ö
+    { 13, 13, 14, 1, 15, 43, 11911 }, // ÷
+    { 14, 17, 15, 0, 15, 60, 11954 }, // ø
+    { 14, 21, 15, 1, 20, 74, 12014 }, // ù
+    { 14, 21, 15, 1, 20, 74, 12088 }, // ú
+    { 14, 21, 15, 1, 20, 74, 12162 }, // û
+    { 14, 20, 15, 1, 19, 70, 12288 }, // ü
+    { 17, 26, 13, -2, 20, 111, 12358 }, // ý
+    { 15, 25, 15, -1, 19, 94, 12469 }, // þ
+    { 17, 25, 13, -2, 19, 107, 12563 }, // ÿ
+    { 17, 22, 16, -2, 22, 94, 12670 }, // Ā
+    { 14, 19, 15, 1, 18, 67, 12764 }, // ā
+    { 18, 24, 16, -2, 24, 108, 12831 }, // Ă
+    { 14, 21, 15, 1, 20, 74, 12939 }, // ă
+    { 17, 25, 16, -2, 18, 107, 13013 }, // Ą
+    { 14, 21, 15, 1, 14, 74, 13120 }, // ą
+    { 16, 25, 15, 1, 24, 100, 13194 }, // Ć
+    { 12, 21, 12, 1, 20, 63, 13294 }, // ć
+    { 16, 25, 15, 1, 24, 100, 13357 }, // Ĉ
+    { 12, 21, 12, 1, 20, 63, 13457 }, // ĉ
+    { 16, 25, 15, 1, 24, 100, 13520 }, // Ċ
+    { 12, 21, 12, 1, 20, 63, 13620 }, // ċ
+    { 16, 25, 15, 1, 24, 100, 13683 }, // Č
+    { 13, 21, 12, 1, 20, 69, 13783 }, // č
+    { 17, 24, 17, 0, 24, 102, 13852 }, // Ď
+    { 20, 20, 17, 1, 19, 100, 13954 }, // ď
+    { 17, 18, 17, 0, 18, 77, 14054 }, // Đ
+    { 16, 20, 15, 1, 19, 80, 14131 }, // đ
+    { 15, 22, 14, 0, 22, 83, 14211 }, // Ē
+    { 13, 19, 14, 1, 18, 62, 14336 }, // ē
+    { 15, 24, 14, 0, 24, 90, 14398 }, // Ĕ
+    { 13, 21, 14, 1, 20, 69, 14488 }, // ĕ
+    { 15, 24, 14, 0, 24, 90, 14557 }, // Ė
+    { 13, 21, 14, 1, 20, 69, 14647 }, // ė
+    { 15, 25, 14, 0, 18, 94, 14716 }, // Ę
+    { 13, 20, 14, 1, 14, 65, 14810 }, // ę
+    { 16, 24, 14, 0, 24, 96, 14875 }, // Ě
+    { 14, 21, 14, 1, 20, 74, 14971 }, // ě
+    { 16, 25, 17, 1, 24, 100, 15045 }, // Ĝ
+    { 15, 26, 15, 0, 20, 98, 15145 }, // ĝ
+    { 16, 25, 17, 1, 24, 100, 15243 }, // Ğ
+    { 15, 26, 15, 0, 20, 98, 15343 }, // ğ
+    { 16, 25, 17, 1, 24, 100, 15441 }, // Ġ
+    { 15, 26, 15, 0, 20, 98, 15541 }, // ġ
+    { 16, 25, 17, 1, 19, 100, 15639 }, // Ģ
+    { 15, 26, 15, 0, 20, 98, 15739 }, // ģ
+    { 18, 24, 18, 0, 24, 108, 15837 }, // Ĥ
+    { 14, 25, 15, 0, 25, 88, 15945 }, // ĥ
+    { 20, 18, 18, 0, 18, 90, 16033 }, // Ħ
+    { 14, 19, 15, 0, 19, 67, 16123 }, // ħ
+    { 14, 23, 10, -1, 23, 81, 16190 }, // Ĩ
+    { 12, 19, 7, 0, 19, 57, 16271 }, // ĩ
+    { 13, 22, 10, -1, 22, 72, 16384 }, // Ī
+    { 10, 18, 7, 0, 18, 45, 16456 }, // ī
+    { 14, 24, 10, -1, 24, 84, 16501 }, // Ĭ
+    { 11, 20, 7, 0, 20, 55, 16585 }, // ĭ
+    { 12, 25, 10, -1, 18, 75, 16640 }, // Į
+    { 10, 27, 7, -1, 20, 68, 16715 }, // į
+    { 12, 24, 10, -1, 24, 72, 16783 }, // İ
+    { 8, 14, 7, 0, 14, 28, 16855 }, // ı
+    { 20, 24, 18, -1, 18, 120, 16883 }, // Ĳ
+    { 16, 26, 15, 0, 20, 104, 17003 }, // ĳ
+    { 16, 30, 8, -4, 24, 120, 17107 }, // Ĵ
+    { 15, 26, 7, -4, 20, 98, 17227 }, // ĵ
+    { 18, 24, 15, 0, 18, 108, 17325 }, // Ķ
+    { 16, 25, 14, 0, 19, 100, 17433 }, // ķ
+    { 16, 14, 14, 0, 14, 56, 17533 }, // ĸ
+    { 13, 24, 13, 0, 24, 78, 17589 }, // Ĺ
+    { 12, 25, 7, 0, 25, 75, 17667 }, // ĺ
+    { 12, 24, 13, 0, 18, 72, 17742 }, // Ļ
+    { 10, 25, 7, -1, 19, 63, 17814 }, // ļ
+    { 15, 18, 13, 0, 18, 68, 17877 }, // Ľ
+    { 14, 19, 9, 0, 19, 67, 17945 }, // ľ
+    { 13, 18, 13, 0, 18, 59, 18012 }, // Ŀ
+    { 12, 19, 11, 0, 19, 57, 18071 }, // ŀ
+    { 13, 18, 13, -1, 18, 59, 18128 }, // Ł
+    { 9, 19, 8, 0, 19, 43, 18187 }, // ł
+    { 20, 24, 19, 0, 24, 120, 18230 }, // Ń
+    { 15, 20, 15, 0, 20, 75, 18350 }, // ń
+    { 20, 24, 19, 0, 18, 120, 18432 }, // Ņ
+    { 14, 20, 15, 0, 14, 70, 18552 }, // ņ
+    { 20, 24, 19, 0, 24, 120, 18622 }, // Ň
+    { 16, 20, 15, 0, 20, 80, 18742 }, // ň
+    { 17, 18, 18, 0, 18, 77, 18822 }, // ŉ
+    { 19, 24, 19, 0, 18, 114, 18899 }, // Ŋ
+    { 14, 20, 15, 0, 14, 70, 19013 }, // ŋ
+    { 17, 23, 18, 1, 22, 98, 19083 }, // Ō
+    { 13, 19, 15, 1, 18, 62, 19181 }, // ō
+    { 17, 25, 18, 1, 24, 107, 19243 }, // Ŏ
+    { 13, 21, 15, 1, 20, 69, 19350 }, // ŏ
+    { 19, 25, 18, 1, 24, 119, 19419 }, // Ő
+    { 16, 21, 15, 1, 20, 84, 19538 }, // ő
+    { 23, 20, 23, 1, 19, 115, 19622 }, // Œ
+    { 21, 15, 22, 1, 14, 79, 19737 }, // œ
+    { 16, 24, 16, 0, 24, 96, 19816 }, // Ŕ
+    { 13, 20, 11, 0, 20, 65, 19912 }, // ŕ
+    { 15, 24, 16, 0, 18, 90, 19977 }, // Ŗ
+    { 13, 20, 11, -1, 14, 65, 20067 }, // ŗ
+    { 17, 24, 16, 0, 24, 102, 20132 }, // Ř
+    { 14, 20, 11, 0, 20, 70, 20234 }, // ř
+    { 14, 25, 13, 0, 24, 88, 20304 }, // Ś
+    { 13, 21, 12, 0, 20, 69, 20392 }, // ś
+    { 14, 25, 13, 0, 24, 88, 20480 }, // Ŝ
+    { 13, 21, 12, 0, 20, 69, 20568 }, // ŝ
+    { 14, 25, 13, 0, 19, 88, 20637 }, // Ş
+    { 12, 20, 12, 0, 14, 60, 20725 }, // ş
+    { 15, 25, 13, 0, 24, 94, 20785 }, // Š
+    { 13, 21, 12, 0, 20, 69, 20879 }, // š
+    { 15, 24, 13, 1, 18, 90, 20948 }, // Ţ
+    { 10, 23, 10, 1, 17, 58, 21038 }, // ţ
+    { 14, 24, 13, 2, 24, 84, 21096 }, // Ť
+    { 13, 20, 10, 1, 19, 65, 21180 }, // ť
+    { 15, 18, 13, 1, 18, 68, 21245 }, // Ŧ
+    { 11, 18, 10, 0, 17, 50, 21313 }, // ŧ
+    { 17, 24, 17, 1, 23, 102, 21363 }, // Ũ
+    { 14, 20, 15, 1, 19, 70, 21465 }, // ũ
+    { 17, 23, 17, 1, 22, 98, 21535 }, // Ū
+    { 14, 19, 15, 1, 18, 67, 21633 }, // ū
+    { 17, 25, 17, 1, 24, 107, 21700 }, // Ŭ
+    { 14, 21, 15, 1, 20, 74, 21807 }, // ŭ
+    { 17, 26, 17, 1, 25, 111, 21881 }, // Ů
+    { 14, 22, 15, 1, 21, 77, 21992 }, // ů
+    { 18, 25, 17, 1, 24, 113, 22069 }, // Ű
+    { 16, 21, 15, 1, 20, 84, 22182 }, // ű
+    { 17, 25, 17, 1, 18, 107, 22266 }, // Ų
+    { 14, 21, 15, 1, 14, 74, 22373 }, // ų
+    { 23, 24, 22, 2, 24, 138, 22528 }, // Ŵ
+    { 20, 20, 20, 1, 20, 100, 22666 }, // ŵ
+    { 15, 24, 14, 2, 24, 90, 22766 }, // Ŷ
+    { 17, 26, 13, -2, 20, 111, 22856 }, // ŷ
+    { 15, 23, 14, 2, 23, 87, 22967 }, // Ÿ
+    { 16, 24, 13, -1, 24, 96, 23054 }, // Ź
+    { 14, 20, 12, -1, 20, 70, 23150 }, // ź
+    { 16, 24, 13, -1, 24, 96, 23220 }, // Ż
+    { 13, 20, 12, -1, 20, 65, 23316 }, // ż
+    { 17, 24, 13, -1, 24, 102, 23381 }, // Ž
+    { 15, 20, 12, -1, 20, 75, 23483 }, // ž
+    { 15, 26, 9, -3, 20, 98, 23558 }, // ſ
+    { 6, 5, 0, -11, 20, 8, 23656 }, // ̀
+    { 8, 5, 0, -6, 20, 10, 23664 }, // ́
+    { 11, 5, 0, -4, 20, 14, 23674 }, // ̂
+    { 11, 4, 0, -11, 19, 11, 23688 }, // ̃
+    { 9, 3, 0, -3, 18, 7, 23699 }, // ̄
+    { 11, 4, 0, -3, 22, 11, 23706 }, // ̅
+    { 10, 5, 0, -3, 20, 13, 23717 }, // ̆
+    { 5, 5, 0, 0, 20, 7, 23730 }, // ̇
+    { 9, 4, 0, -2, 19, 9, 23737 }, // ̈
+    { 6, 7, 0, -8, 21, 11, 23746 }, // ̉
+    { 7, 6, 0, -1, 21, 11, 23757 }, // ̊
+    { 12, 5, 0, -3, 20, 15, 23768 }, // ̋
+    { 11, 5, 0, -3, 20, 14, 23783 }, // ̌
+    { 5, 8, 0, 0, 20, 10, 23797 }, // ̍
+    { 9, 6, 0, -2, 20, 14, 23807 }, // ̎
+    { 11, 5, 0, -12, 20, 14, 23821 }, // ̏
+    { 9, 7, 0, -2, 22, 16, 23835 }, // ̐
+    { 10, 5, 0, -3, 20, 13, 23851 }, // ̑
+    { 7, 7, 0, -2, 18, 13, 23864 }, // ̒
+    { 7, 7, 0, -2, 18, 13, 23877 }, // ̓
+    { 4, 7, 0, 0, 18, 7, 23890 }, // ̔
+    { 7, 7, 0, -2, 18, 13, 23897 }, // ̕
+    { 6, 5, 0, -5, 0, 8, 23910 }, // ̖
+    { 8, 5, 0, -6, 0, 10, 23918 }, // ̗
+    { 6, 6, 0, -5, 0, 9, 23928 }, // ̘
+    { 6, 6, 0, -5, 0, 9, 23937 }, // ̙
+    { 8, 7, 8, 2, 19, 14, 23946 }, // ̚
+    { 8, 7, 0, -2, 20, 14, 23960 }, // ̛
+    { 5, 7, 0, -2, 0, 9, 23974 }, // ̜
+    { 7, 5, 0, -6, -1, 9, 23983 }, // ̝
+    { 6, 5, 0, -5, -1, 8, 23992 }, // ̞
+    { 6, 6, 0, -5, 0, 9, 24000 }, // ̟
+    { 7, 3, 0, -6, -2, 6, 24009 }, // ̠
+    { 8, 8, 0, -6, 2, 16, 24015 }, // ̡
+    { 6, 8, 0, -3, 2, 12, 24031 }, // ̢
+    { 5, 5, 0, -12, -1, 7, 24043 }, // ̣
+    { 9, 4, 0, -7, -1, 9, 24050 }, // ̤
+    { 7, 6, 0, -6, 0, 11, 24059 }, // ̥
+    { 6, 5, 0, 1, -1, 8, 24070 }, // ̦
+    { 7, 6, 0, -5, 0, 11, 24078 }, // ̧
+    { 6, 7, 0, -5, 0, 11, 24089 }, // ̨
+    { 5, 8, 0, -4, 0, 10, 24100 }, // ̩
+    { 10, 5, 0, -7, -1, 13, 24110 }, // ̪
+    { 10, 4, 0, -7, -1, 10, 24123 }, // ̫
+    { 11, 5, 0, -7, 0, 14, 24133 }, // ̬
+    { 11, 5, 0, -8, 0, 14, 24147 }, // ̭
+    { 10, 5, 0, -7, 0, 13, 24161 }, // ̮
+    { 10, 5, 0, -7, -1, 13, 24174 }, // ̯
+    { 12, 4, 0, -8, -1, 12, 24187 }, // ̰
+    { 9, 3, 0, -7, -2, 7, 24199 }, // ̱
+    { 12, 2, 0, -8, -2, 6, 24206 }, // ̲
+    { 13, 6, 0, -9, 0, 20, 24212 }, // ̳
+    { 12, 4, 0, -6, 9, 12, 24232 }, // ̴
+    { 11, 4, 0, -6, 9, 11, 24244 }, // ̵
+    { 20, 4, 0, -10, 9, 20, 24255 }, // ̶
+    { 10, 8, 0, -5, 11, 20, 24275 }, // ̷
+    { 16, 21, 0, -8, 19, 84, 24295 }, // ̸
+    { 4, 7, 0, -2, 0, 7, 24379 }, // ̹
+    { 10, 5, 0, -7, -1, 13, 24386 }, // ̺
+    { 10, 6, 0, -7, 0, 15, 24399 }, // ̻
+    { 10, 4, 0, -7, -1, 10, 24414 }, // ̼
+    { 7, 6, 0, -1, 20, 11, 24424 }, // ̽
+    { 6, 8, 0, -1, 22, 12, 24435 }, // ̾
+    { 12, 6, 0, -3, 25, 18, 24447 }, // ̿
+    { 6, 5, 0, -2, 20, 8, 24465 }, // ̀
+    { 7, 5, 0, 0, 20, 9, 24473 }, // ́
+    { 12, 4, 0, 3, 19, 12, 24482 }, // ͂
+    { 5, 6, 0, 0, 20, 8, 24494 }, // ̓
+    { 14, 5, 0, -4, 20, 18, 24502 }, // ̈́
+    { 6, 5, 0, -4, -1, 8, 24520 }, // ͅ
+    { 12, 6, 0, -4, 20, 18, 24528 }, // ͆
+    { 12, 6, 0, -8, 0, 18, 24546 }, // ͇
+    { 8, 6, 0, -6, 0, 12, 24564 }, // ͈
+    { 6, 5, 0, -5, -1, 8, 24576 }, // ͉
+    { 10, 6, 0, -3, 20, 15, 24584 }, // ͊
+    { 11, 10, 0, -3, 24, 28, 24599 }, // ͋
+    { 11, 7, 0, -3, 22, 20, 24627 }, // ͌
+    { 10, 6, 0, -7, 0, 15, 24647 }, // ͍
+    { 5, 6, 0, -4, 0, 8, 24662 }, // ͎
+    { 18, 18, 0, -9, 18, 81, 24670 }, // ͏
+    { 5, 6, 0, 0, 20, 8, 24751 }, // ͐
+    { 4, 7, 0, 3, 22, 7, 24759 }, // ͑
+    { 10, 7, 0, -3, 22, 18, 24766 }, // ͒
+    { 5, 6, 0, -4, 0, 8, 24784 }, // ͓
+    { 5, 5, 0, -4, -1, 7, 24792 }, // ͔
+    { 5, 5, 0, -4, -1, 7, 24799 }, // ͕
+    { 10, 5, 0, -6, -1, 13, 24806 }, // ͖
+    { 5, 7, 0, 2, 21, 9, 24819 }, // ͗
+    { 5, 5, 0, 0, 20, 7, 24828 }, // ͘
+    { 6, 6, 0, -5, 0, 9, 24835 }, // ͙
+    { 10, 6, 0, -7, 0, 15, 24844 }, // ͚
+    { 5, 6, 0, 0, 20, 8, 24859 }, // ͛
+    { 20, 5, 0, -11, -1, 25, 24867 }, // ͜
+    { 20, 5, 0, -8, 19, 25, 24892 }, // ͝
+    { 14, 3, 0, -5, 18, 11, 24917 }, // ͞
+    { 14, 3, 0, -9, -1, 11, 24928 }, // ͟
+    { 21, 4, 0, -8, 19, 21, 24939 }, // ͠
+    { 20, 6, 0, -7, 22, 30, 24960 }, // ͡
+    { 21, 6, 0, -13, 0, 32, 24990 }, // ͢
+    { 7, 7, 0, -1, 22, 13, 25022 }, // ͣ
+    { 7, 7, 0, -1, 22, 13, 25035 }, // ͤ
+    { 5, 9, 0, 0, 24, 12, 25048 }, // ͥ
+    { 7, 7, 0, -1, 22, 13, 25060 }, // ͦ
+    { 7, 6, 0, -1, 21, 11, 25073 }, // ͧ
+    { 6, 7, 0, 0, 22, 11, 25084 }, // ͨ
+    { 8, 9, 0, -1, 24, 18, 25095 }, // ͩ
+    { 7, 9, 0, -1, 24, 16, 25113 }, // ͪ
+    { 10, 7, 0, -3, 22, 18, 25129 }, // ͫ
+    { 6, 7, 0, 0, 22, 11, 25147 }, // ͬ
+    { 5, 8, 0, 0, 23, 10, 25158 }, // ͭ
+    { 6, 6, 0, 0, 21, 9, 25168 }, // ͮ
+    { 8, 6, 0, -2, 21, 12, 25177 }, // ͯ
+    { 15, 24, 13, 0, 24, 90, 25189 }, // Ѐ
+    { 15, 24, 13, 0, 24, 90, 25279 }, // Ё
+    { 15, 19, 18, 2, 18, 72, 25369 }, // Ђ
+    { 15, 24, 13, 0, 24, 90, 25441 }, // Ѓ
+    { 16, 20, 15, 1, 19, 80, 25531 }, // Є
+    { 14, 20, 13, 0, 19, 70, 25611 }, // Ѕ
+    { 9, 18, 8, 0, 18, 41, 25681 }, // І
+    { 11, 24, 8, 0, 24, 66, 25722 }, // Ї
+    { 14, 24, 8, -5, 18, 84, 25788 }, // Ј
+    { 25, 19, 24, -1, 18, 119, 25872 }, // Љ
+    { 23, 18, 23, 0, 18, 104, 25991 }, // Њ
+    { 15, 18, 18, 2, 18, 68, 26095 }, // Ћ
+    { 18, 24, 16, 0, 24, 108, 26163 }, // Ќ
+    { 18, 24, 17, 0, 24, 108, 26271 }, // Ѝ
+    { 18, 25, 15, 0, 24, 113, 26379 }, // Ў
+    { 18, 22, 17, 0, 18, 99, 26492 }, // Џ
+    { 17, 18, 16, -2, 18, 77, 26624 }, // А
+    { 15, 18, 15, 0, 18, 68, 26701 }, // Б
+    { 16, 18, 15, 0, 18, 72, 26769 }, // В
+    { 15, 18, 13, 0, 18, 68, 26841 }, // Г
+    { 21, 22, 18, -3, 18, 116, 26909 }, // Д
+    { 15, 18, 13, 0, 18, 68, 27025 }, // Е
+    { 27, 18, 23, -2, 18, 122, 27093 }, // Ж
+    { 15, 20, 14, 0, 19, 75, 27215 }, // З
+    { 18, 18, 17, 0, 18, 81, 27290 }, // И
+    { 18, 24, 17, 0, 24, 108, 27371 }, // Й
+    { 18, 18, 16, 0, 18, 81, 27479 }, // К
+    { 19, 19, 17, -1, 18, 91, 27560 }, // Л
+    { 23, 18, 22, 0, 18, 104, 27651 }, // М
+    { 18, 18, 17, 0, 18, 81, 27755 }, // Н
+    { 17, 20, 18, 1, 19, 85, 27836 }, // О
+    { 18, 18, 17, 0, 18, 81, 27921 }, // П
+    { 16, 18, 15, 0, 18, 72, 28002 }, // Р
+    { 16, 20, 15, 1, 19, 80, 28074 }, // С
+    { 14, 18, 13, 2, 18, 63, 28154 }, // Т
+    { 18, 19, 15, 0, 18, 86, 28217 }, // У
+    { 21, 20, 22, 1, 19, 105, 28303 }, // Ф
+    { 20, 18, 15, -2, 18, 90, 28408 }, // Х
+    { 18, 22, 17, 0, 18, 99, 28498 }, // Ц
+    { 15, 18, 17, 2, 18, 68, 28597 }, // Ч
+    { 25, 18, 25, 0, 18, 113, 28672 }, // Ш
+    { 25, 22, 25, 0, 18, 138, 28785 }, // Щ
+    { 15, 18, 17, 2, 18, 68, 28923 }, // Ъ
+    { 23, 18, 22, 0, 18, 104, 28991 }, // Ы
+    { 15, 18, 15, 0, 18, 68, 29095 }, // Ь
+    { 16, 20, 15, 0, 19, 80, 29163 }, // Э
+    { 25, 20, 25, 0, 19, 125, 29243 }, // Ю
+    { 18, 18, 15, -2, 18, 81, 29368 }, // Я
+    { 15, 15, 15, 0, 14, 57, 29449 }, // а
+    { 14, 21, 14, 1, 20, 74, 29506 }, // б
+    { 14, 15, 14, 0, 14, 53, 29580 }, // в
+    { 13, 15, 12, -1, 14, 49, 29633 }, // г
+    { 14, 21, 14, 0, 20, 74, 29682 }, // д
+    { 13, 15, 13, 0, 14, 49, 29756 }, // е
+    { 26, 15, 24, -1, 14, 98, 29805 }, // ж
+    { 12, 15, 12, 0, 14, 45, 29903 }, // з
+    { 14, 15, 15, 1, 14, 53, 29948 }, // и
+    { 14, 21, 15, 1, 20, 74, 30001 }, // й
+    { 16, 14, 14, 0, 14, 56, 30075 }, // к
+    { 16, 15, 15, -1, 14, 60, 30131 }, // л
+    { 19, 14, 19, 0, 14, 67, 30191 }, // м
+    { 15, 14, 15, 0, 14, 53, 30258 }, // н
+    { 14, 15, 14, 0, 14, 53, 30311 }, // о
+    { 14, 14, 15, 0, 14, 49, 30364 }, // п
+    { 16, 20, 15, -1, 14, 80, 30413 }, // р
+    { 12, 15, 12, 0, 14, 45, 30493 }, // с
+    { 22, 14, 22, 0, 14, 77, 30538 }, // т
+    { 17, 20, 13, -2, 14, 85, 30615 }, // у
+    { 18, 25, 19, 0, 19, 113, 30720 }, // ф
+    { 17, 14, 13, -2, 14, 60, 30833 }, // х
+    { 14, 18, 15, 1, 14, 63, 30893 }, // ц
+    { 14, 14, 14, 1, 14, 49, 30956 }, // ч
+    { 22, 15, 22, 1, 14, 83, 31005 }, // ш
+    { 22, 18, 23, 1, 14, 99, 31088 }, // щ
+    { 15, 15, 16, 0, 14, 57, 31187 }, // ъ
+    { 20, 15, 20, 0, 14, 75, 31244 }, // ы
+    { 13, 15, 14, 0, 14, 49, 31319 }, // ь
+    { 12, 15, 12, 0, 14, 45, 31368 }, // э
+    { 20, 15, 20, 0, 14, 75, 31413 }, // ю
+    { 16, 14, 14, -2, 14, 56, 31488 }, // я
+    { 13, 21, 13, 0, 20, 69, 31544 }, // ѐ
+    { 13, 20, 13, 0, 19, 65, 31613 }, // ё
+    { 14, 25, 15, 0, 19, 88, 31678 }, // ђ
+    { 14, 21, 12, -1, 20, 74, 31766 }, // ѓ
+    { 12, 15, 12, 0, 14, 45, 31840 }, // є
+    { 12, 15, 11, 0, 14, 45, 31885 }, // ѕ
+    { 9, 20, 7, 0, 20, 45, 31930 }, // і
+    { 10, 19, 7, 0, 19, 48, 31975 }, // ї
+    { 13, 26, 7, -4, 20, 85, 32023 }, // ј
+    { 22, 15, 21, -1, 14, 83, 32108 }, // љ
+    { 21, 15, 21, 0, 14, 79, 32191 }, // њ
+    { 14, 19, 15, 0, 19, 67, 32270 }, // ћ
+    { 16, 20, 14, 0, 20, 80, 32337 }, // ќ
+    { 14, 21, 15, 1, 20, 74, 32417 }, // ѝ
+    { 17, 26, 13, -2, 20, 111, 32491 }, // ў
+    { 14, 19, 15, 1, 14, 67, 32602 }, // џ
+    { 23, 18, 22, 2, 18, 104, 32768 }, // Ѡ
+    { 21, 14, 20, 1, 14, 74, 32872 }, // ѡ
+    { 14, 18, 16, 1, 18, 63, 32946 }, // Ѣ
+    { 20, 15, 21, 0, 14, 75, 33009 }, // ѣ
+    { 24, 20, 22, 0, 19, 120, 33084 }, // Ѥ
+    { 19, 15, 19, 0, 14, 72, 33204 }, // ѥ
+    { 18, 18, 17, -2, 18, 81, 33276 }, // Ѧ
+    { 16, 14, 15, -2, 14, 56, 33357 }, // ѧ
+    { 22, 18, 23, 0, 18, 99, 33413 }, // Ѩ
+    { 20, 14, 21, 0, 14, 70, 33512 }, // ѩ
+    { 21, 18, 18, -2, 18, 95, 33582 }, // Ѫ
+    { 17, 14, 14, -2, 14, 60, 33677 }, // ѫ
+    { 26, 18, 25, 0, 18, 117, 33737 }, // Ѭ
+    { 22, 14, 21, 0, 14, 77, 33854 }, // ѭ
+    { 16, 28, 15, -1, 22, 112, 33931 }, // Ѯ
+    { 15, 23, 13, -2, 17, 87, 34043 }, // ѯ
+    { 21, 18, 21, 2, 18, 95, 34130 }, // Ѱ
+    { 19, 25, 20, 1, 19, 119, 34225 }, // ѱ
+    { 17, 20, 18, 1, 19, 85, 34344 }, // Ѳ
+    { 13, 15, 15, 1, 14, 49, 34429 }, // ѳ
+    { 16, 18, 16, 2, 18, 72, 34478 }, // Ѵ
+    { 14, 14, 14, 1, 14, 49, 34550 }, // ѵ
+    { 16, 24, 16, 2, 24, 96, 34599 }, // Ѷ
+    { 14, 20, 14, 1, 20, 70, 34695 }, // ѷ
+    { 32, 25, 31, 1, 19, 200, 34816 }, // Ѹ
+    { 28, 20, 28, 1, 14, 140, 35016 }, // ѹ
+    { 18, 22, 19, 1, 20, 99, 35156 }, // Ѻ
+    { 14, 17, 16, 1, 15, 60, 35255 }, // ѻ
+    { 24, 27, 25, 1, 26, 162, 35315 }, // Ѽ
+    { 20, 23, 22, 1, 22, 115, 35477 }, // ѽ
+    { 23, 23, 22, 2, 23, 133, 35592 }, // Ѿ
+    { 21, 19, 20, 1, 19, 100, 35725 }, // ѿ
+    { 16, 25, 15, 1, 19, 100, 35825 }, // Ҁ
+    { 12, 20, 12, 1, 14, 60, 35925 }, // ҁ
+    { 13, 17, 15, 1, 16, 56, 35985 }, // ҂
+    { 10, 5, 0, -10, 19, 13, 36041 }, // ҃
+    { 10, 4, 0, -10, 19, 10, 36054 }, // ҄
+    { 5, 6, 0, -7, 20, 8, 36064 }, // ҅
+    { 5, 6, 0, -7, 20, 8, 36072 }, // ҆
+    { 11, 4, 0, -3, 23, 11, 36080 }, // ҇
+    { 30, 27, 0, -15, 20, 203, 36091 }, // ҈
+    { 28, 28, 0, -14, 21, 196, 36294 }, // ҉
+    { 20, 30, 21, 0, 24, 150, 36490 }, // Ҋ
+    { 15, 25, 16, 1, 20, 94, 36640 }, // ҋ
+    { 14, 18, 15, 0, 18, 63, 36734 }, // Ҍ
+    { 12, 20, 14, 1, 19, 60, 36797 }, // ҍ
+    { 16, 18, 15, 0, 18, 72, 36864 }, // Ҏ
+    { 15, 20, 15, -1, 14, 75, 36936 }, // ҏ
+    { 16, 22, 13, 0, 22, 88, 37011 }, // Ґ
+    { 14, 18, 12, 0, 18, 63, 37099 }, // ґ
+    { 15, 18, 13, 0, 18, 68, 37162 }, // Ғ
+    { 14, 14, 12, -1, 14, 49, 37230 }, // ғ
+    { 15, 25, 17, 0, 18, 94, 37279 }, // Ҕ
+    { 13, 21, 14, 0, 14, 69, 37373 }, // ҕ
+    { 26, 24, 23, -2, 18, 156, 37442 }, // Җ
+    { 26, 19, 24, -1, 14, 124, 37598 }, // җ
+    { 15, 26, 14, 0, 19, 98, 37722 }, // Ҙ
+    { 12, 21, 12, 0, 14, 63, 37820 }, // ҙ
+    { 18, 24, 17, 0, 18, 108, 37883 }, // Қ
+    { 16, 19, 15, 0, 14, 76, 37991 }, // қ
+    { 18, 18, 16, 0, 18, 81, 38067 }, // Ҝ
+    { 15, 14, 15, 1, 14, 53, 38148 }, // ҝ
+    { 18, 18, 15, 0, 18, 81, 38201 }, // Ҟ
+    { 16, 19, 14, 0, 19, 76, 38282 }, // ҟ
+    { 18, 18, 18, 2, 18, 81, 38358 }, // Ҡ
+    { 18, 14, 16, 0, 14, 63, 38439 }, // ҡ
+    { 18, 24, 19, 0, 18, 108, 38502 }, // Ң
+    { 16, 19, 17, 0, 14, 76, 38610 }, // ң
+    { 22, 18, 19, 0, 18, 99, 38686 }, // Ҥ
+    { 20, 14, 18, 0, 14, 70, 38785 }, // ҥ
+    { 24, 25, 26, 0, 18, 150, 38912 }, // Ҧ
+    { 20, 21, 22, 0, 14, 105, 39062 }, // ҧ
+    { 17, 21, 18, 1, 19, 90, 39167 }, // Ҩ
+    { 14, 15, 15, 1, 14, 53, 39257 }, // ҩ
+    { 16, 26, 15, 1, 19, 104, 39310 }, // Ҫ
+    { 12, 21, 12, 1, 14, 63, 39414 }, // ҫ
+    { 14, 24, 13, 2, 18, 84, 39477 }, // Ҭ
+    { 23, 19, 23, 0, 14, 110, 39561 }, // ҭ
+    { 15, 18, 14, 2, 18, 68, 39671 }, // Ү
+    { 14, 20, 13, 1, 14, 70, 39739 }, // ү
+    { 17, 18, 14, 0, 18, 77, 39809 }, // Ұ
+    { 16, 20, 13, -1, 14, 80, 39886 }, // ұ
+    { 20, 24, 17, -2, 18, 120, 39966 }, // Ҳ
+    { 16, 19, 15, -1, 14, 76, 40086 }, // ҳ
+    { 19, 24, 21, 2, 18, 114, 40162 }, // Ҵ
+    { 16, 19, 17, 1, 14, 76, 40276 }, // ҵ
+    { 16, 24, 19, 2, 18, 96, 40352 }, // Ҷ
+    { 13, 19, 16, 2, 14, 62, 40448 }, // ҷ
+    { 15, 18, 17, 2, 18, 68, 40510 }, // Ҹ
+    { 13, 14, 15, 2, 14, 46, 40578 }, // ҹ
+    { 16, 18, 17, 0, 18, 72, 40624 }, // Һ
+    { 14, 19, 15, 0, 19, 67, 40696 }, // һ
+    { 20, 20, 19, 0, 19, 100, 40763 }, // Ҽ
+    { 16, 15, 17, 0, 14, 60, 40863 }, // ҽ
+    { 20, 25, 19, 0, 19, 125, 40960 }, // Ҿ
+    { 16, 19, 17, 0, 14, 76, 41085 }, // ҿ
+    { 12, 18, 10, -1, 18, 54, 41161 }, // Ӏ
+    { 27, 24, 23, -2, 24, 162, 41215 }, // Ӂ
+    { 26, 21, 24, -1, 20, 137, 41377 }, // ӂ
+    { 18, 25, 17, 0, 18, 113, 41514 }, // Ӄ
+    { 16, 21, 15, 0, 14, 84, 41627 }, // ӄ
+    { 20, 24, 19, -1, 18, 120, 41711 }, // Ӆ
+    { 17, 19, 16, -1, 14, 81, 41831 }, // ӆ
+    { 18, 25, 18, 0, 18, 113, 41912 }, // Ӈ
+    { 15, 21, 15, 0, 14, 79, 42025 }, // ӈ
+    { 19, 24, 19, 0, 18, 114, 42104 }, // Ӊ
+    { 16, 19, 17, 0, 14, 76, 42218 }, // ӊ
+    { 15, 24, 17, 2, 18, 90, 42294 }, // Ӌ
+    { 13, 19, 15, 2, 14, 62, 42384 }, // ӌ
+    { 23, 24, 24, 0, 18, 138, 42446 }, // Ӎ
+    { 21, 19, 21, 0, 14, 100, 42584 }, // ӎ
+    { 12, 18, 10, -1, 18, 54, 42684 }, // ӏ
+    { 18, 24, 16, -2, 24, 108, 42738 }, // Ӑ
+    { 14, 21, 15, 1, 20, 74, 42846 }, // ӑ
+    { 17, 23, 16, -2, 23, 98, 43008 }, // Ӓ
+    { 14, 20, 15, 1, 19, 70, 43106 }, // ӓ
+    { 26, 18, 22, -2, 18, 117, 43176 }, // Ӕ
+    { 21, 15, 22, 1, 14, 79, 43293 }, // ӕ
+    { 16, 24, 14, 0, 24, 96, 43372 }, // Ӗ
+    { 14, 21, 14, 1, 20, 74, 43468 }, // ӗ
+    { 16, 20, 17, 0, 19, 80, 43542 }, // Ә
+    { 13, 15, 14, 0, 14, 49, 43622 }, // ә
+    { 16, 24, 17, 0, 23, 96, 43671 }, // Ӛ
+    { 13, 20, 14, 0, 19, 65, 43767 }, // ӛ
+    { 27, 23, 23, -2, 23, 156, 43832 }, // Ӝ
+    { 26, 20, 24, -1, 19, 130, 43988 }, // ӝ
+    { 15, 24, 14, 0, 23, 90, 44118 }, // Ӟ
+    { 13, 20, 12, 0, 19, 65, 44208 }, // ӟ
+    { 16, 19, 14, -1, 18, 76, 44273 }, // Ӡ
+    { 16, 21, 14, -2, 14, 84, 44349 }, // ӡ
+    { 18, 22, 17, 0, 22, 99, 44433 }, // Ӣ
+    { 14, 19, 15, 1, 18, 67, 44532 }, // ӣ
+    { 18, 23, 17, 0, 23, 104, 44599 }, // Ӥ
+    { 14, 20, 15, 1, 19, 70, 44703 }, // ӥ
+    { 17, 24, 18, 1, 23, 102, 44773 }, // Ӧ
+    { 13, 20, 15, 1, 19, 65, 44875 }, // ӧ
+    { 17, 20, 18, 1, 19, 85, 44940 }, // Ө
+    { 13, 15, 15, 1, 14, 49, 45056 }, // ө
+    { 17, 24, 18, 1, 23, 102, 45105 }, // Ӫ
+    { 13, 20, 15, 1, 19, 65, 45207 }, // ӫ
+    { 16, 24, 15, 0, 23, 96, 45272 }, // Ӭ
+    { 12, 20, 12, 0, 19, 60, 45368 }, // ӭ
+    { 18, 23, 15, 0, 22, 104, 45428 }, // Ӯ
+    { 17, 24, 13, -2, 18, 102, 45532 }, // ӯ
+    { 18, 24, 15, 0, 23, 108, 45634 }, // Ӱ
+    { 17, 25, 13, -2, 19, 107, 45742 }, // ӱ
+    { 18, 25, 15, 0, 24, 113, 45849 }, // Ӳ
+    { 18, 26, 13, -2, 20, 117, 45962 }, // ӳ
+    { 15, 23, 17, 2, 23, 87, 46079 }, // Ӵ
+    { 14, 19, 14, 1, 19, 67, 46166 }, // ӵ
+    { 15, 24, 13, 0, 18, 90, 46233 }, // Ӷ
+    { 13, 19, 12, 0, 14, 62, 46323 }, // ӷ
+    { 23, 23, 22, 0, 23, 133, 46385 }, // Ӹ
+    { 20, 20, 20, 0, 19, 100, 46518 }, // ӹ
+    { 15, 25, 13, 0, 18, 94, 46618 }, // Ӻ
+    { 14, 21, 12, -1, 14, 74, 46712 }, // ӻ
+    { 20, 25, 17, -2, 18, 125, 46786 }, // Ӽ
+    { 17, 21, 15, -2, 14, 90, 46911 }, // ӽ
+    { 20, 18, 15, -2, 18, 90, 47001 }, // Ӿ
+    { 17, 14, 13, -2, 14, 60, 47104 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 47164 }, //  
+    { 0, 0, 25, 0, 0, 0, 47164 }, //  
+    { 0, 0, 13, 0, 0, 0, 47164 }, //  
+    { 0, 0, 25, 0, 0, 0, 47164 }, //  
+    { 0, 0, 8, 0, 0, 0, 47164 }, //  
+    { 0, 0, 6, 0, 0, 0, 47164 }, //  
+    { 0, 0, 4, 0, 0, 0, 47164 }, //  
+    { 0, 0, 14, 0, 0, 0, 47164 }, //  
+    { 0, 0, 7, 0, 0, 0, 47164 }, //  
+    { 0, 0, 4, 0, 0, 0, 47164 }, //  
+    { 0, 0, 3, 0, 0, 0, 47164 }, //  
+    { 0, 0, 0, 0, 0, 0, 47164 }, // ​
+    { 0, 0, 0, 0, 0, 0, 47164 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 47164 }, // ‍
+    { 7, 22, 0, -1, 18, 39, 47164 }, // ‎
+    { 7, 22, 0, -6, 18, 39, 47203 }, // ‏
+    { 8, 4, 8, 0, 9, 8, 47242 }, // ‐
+    { 8, 4, 8, 0, 9, 8, 47250 }, // ‑
+    { 14, 4, 14, 0, 11, 14, 47258 }, // ‒
+    { 12, 4, 12, 0, 9, 12, 47272 }, // –
+    { 24, 4, 24, 0, 9, 24, 47284 }, // —
+    { 24, 4, 24, 0, 9, 24, 47308 }, // ―
+    { 10, 25, 14, 2, 19, 63, 47332 }, // ‖
+    { 12, 6, 10, -3, 0, 18, 47395 }, // ‗
+    { 7, 7, 5, 1, 18, 13, 47413 }, // ‘
+    { 7, 7, 5, 1, 18, 13, 47426 }, // ’
+    { 7, 7, 7, -2, 3, 13, 47439 }, // ‚
+    { 5, 7, 5, 2, 18, 9, 47452 }, // ‛
+    { 12, 7, 11, 1, 18, 21, 47461 }, // “
+    { 12, 7, 11, 1, 18, 21, 47482 }, // ”
+    { 13, 7, 12, -2, 3, 23, 47503 }, // „
+    { 10, 7, 11, 2, 18, 18, 47526 }, // ‟
+    { 11, 19, 13, 2, 19, 53, 47544 }, // †
+    { 14, 19, 13, 0, 19, 67, 47597 }, // ‡
+    { 8, 8, 9, 1, 13, 16, 47664 }, // •
+    { 8, 10, 9, 1, 14, 20, 47680 }, // ‣
+    { 6, 5, 13, 2, 4, 8, 47700 }, // ․
+    { 12, 5, 14, 0, 4, 15, 47708 }, // ‥
+    { 19, 5, 21, 0, 4, 24, 47723 }, // …
+    { 6, 5, 8, 1, 9, 8, 47747 }, // ‧
+    { 0, 0, 15, 0, 0, 0, 47755 }, //  
+    { 0, 0, 15, 0, 0, 0, 47755 }, //  
+    { 7, 20, 0, -1, 16, 35, 47755 }, // ‪
+    { 7, 20, 0, -6, 16, 35, 47790 }, // ‫
+    { 6, 22, 0, -3, 18, 33, 47825 }, // ‬
+    { 6, 22, 0, -3, 18, 33, 47858 }, // ‭
+    { 6, 22, 0, -3, 18, 33, 47891 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 47924 }, //  
+    { 29, 20, 30, 1, 19, 145, 47924 }, // ‰
+    { 38, 20, 40, 1, 19, 190, 48069 }, // ‱
+    { 8, 7, 7, 1, 18, 14, 48259 }, // ′
+    { 14, 7, 13, 1, 18, 25, 48273 }, // ″
+    { 20, 7, 19, 1, 18, 35, 48298 }, // ‴
+    { 7, 7, 7, 1, 18, 13, 48333 }, // ‵
+    { 13, 7, 13, 1, 18, 23, 48346 }, // ‶
+    { 19, 7, 19, 1, 18, 34, 48369 }, // ‷
+    { 9, 9, 9, -2, 3, 21, 48403 }, // ‸
+    { 9, 12, 8, 0, 13, 27, 48424 }, // ‹
+    { 8, 12, 8, 0, 13, 24, 48451 }, // ›
+    { 21, 20, 21, 0, 19, 105, 48475 }, // ※
+    { 15, 19, 14, 0, 18, 72, 48580 }, // ‼
+    { 11, 20, 12, 2, 19, 55, 48652 }, // ‽
+    { 12, 4, 11, 2, 22, 12, 48707 }, // ‾
+    { 14, 6, 13, -2, 0, 21, 48719 }, // ‿
+    { 13, 6, 13, 2, 20, 20, 48740 }, // ⁀
+    { 14, 17, 10, -3, 11, 60, 48760 }, // ⁁
+    { 29, 24, 29, -1, 20, 174, 48820 }, // ⁂
+    { 8, 4, 8, 0, 9, 8, 48994 }, // ⁃
+    { 17, 18, 3, -7, 18, 77, 49002 }, // ⁄
+    { 11, 22, 8, -1, 18, 61, 49079 }, // ⁅
+    { 11, 22, 8, -2, 18, 61, 49152 }, // ⁆
+    { 23, 20, 23, 1, 19, 115, 49213 }, // ⁇
+    { 19, 20, 19, 1, 19, 95, 49328 }, // ⁈
+    { 20, 20, 19, 0, 19, 100, 49423 }, // ⁉
+    { 13, 14, 13, 1, 14, 46, 49523 }, // ⁊
+    { 14, 23, 16, 2, 19, 81, 49569 }, // ⁋
+    { 14, 13, 16, 1, 14, 46, 49650 }, // ⁌
+    { 14, 13, 16, 1, 14, 46, 49696 }, // ⁍
+    { 13, 13, 14, -1, 8, 43, 49742 }, // ⁎
+    { 7, 18, 7, 0, 14, 32, 49785 }, // ⁏
+    { 17, 26, 13, -2, 20, 111, 49817 }, // ⁐
+    { 16, 26, 14, -1, 20, 104, 49928 }, // ⁑
+    { 11, 20, 11, 0, 19, 55, 50032 }, // ⁒
+    { 24, 6, 25, 1, 10, 36, 50087 }, // ⁓
+    { 14, 6, 13, -3, 0, 21, 50123 }, // ⁔
+    { 14, 14, 14, 0, 13, 49, 50144 }, // ⁕
+    { 12, 20, 14, 1, 19, 60, 50193 }, // ⁖
+    { 23, 7, 22, 1, 18, 41, 50253 }, // ⁗
+    { 19, 20, 21, 1, 19, 95, 50294 }, // ⁘
+    { 19, 20, 21, 1, 19, 95, 50389 }, // ⁙
+    { 5, 20, 7, 1, 19, 25, 50484 }, // ⁚
+    { 16, 21, 18, 1, 20, 84, 50509 }, // ⁛
+    { 20, 20, 21, 0, 19, 100, 50593 }, // ⁜
+    { 5, 20, 7, 1, 19, 25, 50693 }, // ⁝
+    { 5, 20, 7, 1, 19, 25, 50718 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 50743 }, //  
+    { 0, 0, 15, 0, 0, 0, 50743 }, // ⁠
+    { 0, 0, 15, 0, 0, 0, 50743 }, // ⁡
+    { 0, 0, 15, 0, 0, 0, 50743 }, // ⁢
+    { 0, 0, 15, 0, 0, 0, 50743 }, // ⁣
+    { 0, 0, 15, 0, 0, 0, 50743 }, // ⁤
+    { 0, 0, 15, 0, 0, 0, 50743 }, // ⁦
+    { 0, 0, 15, 0, 0, 0, 50743 }, // ⁧
+    { 0, 0, 15, 0, 0, 0, 50743 }, // ⁨
+    { 0, 0, 15, 0, 0, 0, 50743 }, // ⁩
+    { 6, 22, 0, -3, 18, 33, 50743 }, // ⁪
+    { 6, 22, 0, -3, 18, 33, 50776 }, // ⁫
+    { 6, 22, 0, -3, 18, 33, 50809 }, // ⁬
+    { 6, 22, 0, -3, 18, 33, 50842 }, // ⁭
+    { 6, 22, 0, -3, 18, 33, 50875 }, // ⁮
+    { 6, 22, 0, -3, 18, 33, 50908 }, // ⁯
+    { 9, 12, 9, 2, 22, 27, 50941 }, // ⁰
+    { 6, 12, 6, 1, 19, 18, 50968 }, // ⁱ
+    { 10, 12, 9, 1, 22, 30, 50986 }, // ⁴
+    { 10, 12, 9, 1, 22, 30, 51016 }, // ⁵
+    { 9, 12, 9, 2, 22, 27, 51046 }, // ⁶
+    { 10, 12, 9, 2, 22, 30, 51073 }, // ⁷
+    { 10, 12, 9, 1, 22, 30, 51103 }, // ⁸
+    { 9, 12, 9, 2, 22, 27, 51133 }, // ⁹
+    { 9, 8, 9, 2, 19, 18, 51160 }, // ⁺
+    { 9, 2, 9, 2, 16, 5, 51178 }, // ⁻
+    { 8, 6, 10, 3, 18, 12, 51183 }, // ⁼
+    { 6, 15, 6, 3, 23, 23, 51200 }, // ⁽
+    { 7, 15, 6, 0, 23, 27, 51223 }, // ⁾
+    { 10, 9, 10, 1, 16, 23, 51250 }, // ⁿ
+    { 10, 12, 9, -1, 8, 30, 51273 }, // ₀
+    { 9, 12, 9, -1, 8, 27, 51303 }, // ₁
+    { 10, 12, 9, -2, 8, 30, 51330 }, // ₂
+    { 10, 12, 9, -2, 8, 30, 51360 }, // ₃
+    { 10, 12, 9, -2, 8, 30, 51390 }, // ₄
+    { 10, 12, 9, -1, 8, 30, 51420 }, // ₅
+    { 10, 12, 9, -1, 8, 30, 51450 }, // ₆
+    { 10, 12, 9, -1, 8, 30, 51480 }, // ₇
+    { 9, 12, 9, -1, 8, 27, 51510 }, // ₈
+    { 9, 12, 9, -1, 8, 27, 51537 }, // ₉
+    { 8, 8, 9, 0, 6, 16, 51564 }, // ₊
+    { 8, 2, 9, 0, 3, 4, 51580 }, // ₋
+    { 8, 6, 10, 0, 5, 12, 51584 }, // ₌
+    { 7, 15, 6, 0, 10, 27, 51596 }, // ₍
+    { 7, 15, 6, -3, 10, 27, 51623 }, // ₎
+    { 10, 9, 10, -1, 6, 23, 51650 }, // ₐ
+    { 9, 9, 9, -1, 6, 21, 51673 }, // ₑ
+    { 9, 9, 10, -1, 6, 21, 51694 }, // ₒ
+    { 12, 9, 9, -3, 6, 27, 51715 }, // ₓ
+    { 9, 9, 9, -1, 6, 21, 51742 }, // ₔ
+    { 10, 12, 11, -1, 9, 30, 51763 }, // ₕ
+    { 11, 12, 10, -1, 9, 33, 51793 }, // ₖ
+    { 6, 12, 6, -1, 9, 18, 51826 }, // ₗ
+    { 15, 9, 16, -1, 6, 34, 51844 }, // ₘ
+    { 9, 9, 10, -1, 6, 21, 51878 }, // ₙ
+    { 10, 12, 10, -2, 6, 30, 51899 }, // ₚ
+    { 8, 9, 8, -1, 6, 18, 51929 }, // ₛ
+    { 7, 11, 7, -1, 8, 20, 51947 }, // ₜ
+    { 14, 19, 14, 1, 19, 67, 51967 }, // ₠
+    { 16, 21, 14, 0, 19, 84, 52034 }, // ₡
+    { 16, 20, 14, 0, 19, 80, 52118 }, // ₢
+    { 15, 18, 14, 0, 18, 68, 52198 }, // ₣
+    { 17, 19, 14, -1, 19, 81, 52266 }, // ₤
+    { 22, 20, 23, 0, 17, 110, 52347 }, // ₥
+    { 16, 18, 15, 0, 18, 72, 52457 }, // ₦
+    { 22, 19, 21, 0, 18, 105, 52529 }, // ₧
+    { 23, 19, 22, 0, 18, 110, 52634 }, // ₨
+    { 20, 18, 18, 0, 18, 90, 52744 }, // ₩
+    { 22, 18, 22, 0, 18, 99, 52834 }, // ₪
+    { 17, 23, 15, 0, 19, 98, 52933 }, // ₫
+    { 16, 20, 14, 0, 19, 80, 53031 }, // €
+    { 17, 18, 14, 0, 18, 77, 53111 }, // ₭
+    { 16, 18, 13, 0, 18, 72, 53248 }, // ₮
+    { 25, 25, 25, 0, 19, 157, 53320 }, // ₯
+    { 17, 25, 15, -2, 19, 107, 53477 }, // ₰
+    { 16, 18, 14, 0, 18, 72, 53584 }, // ₱
+    { 17, 22, 17, 1, 20, 94, 53656 }, // ₲
+    { 18, 18, 15, -2, 18, 81, 53750 }, // ₳
+    { 15, 20, 14, 0, 19, 75, 53831 }, // ₴
+    { 16, 21, 15, 1, 19, 84, 53906 }, // ₵
+    { 18, 18, 17, 0, 17, 81, 53990 }, // ₶
+    { 19, 21, 17, -1, 19, 100, 54071 }, // ₷
+    { 14, 18, 13, 1, 18, 63, 54171 }, // ₸
+    { 14, 18, 14, 1, 18, 63, 54234 }, // ₹
+    { 14, 19, 14, 0, 18, 67, 54297 }, // ₺
+    { 16, 20, 16, 1, 19, 80, 54364 }, // ₻
+    { 20, 18, 20, -1, 18, 90, 54444 }, // ₼
+    { 16, 18, 15, -1, 18, 72, 54534 }, // ₽
+    { 18, 21, 15, -1, 21, 95, 54606 }, // ₾
+    { 14, 24, 14, 0, 21, 84, 54701 }, // ₿
+    { 8, 4, 8, 0, 9, 8, 54785 }, // −
+    { 23, 23, 25, 1, 19, 133, 54793 }, // �
 };
 
 static const EpdUnicodeInterval notosans_12_bolditalicIntervals[] = {
@@ -4294,4 +2962,9 @@ static const EpdFontData notosans_12_bolditalic = {
     27,
     -8,
     true,
+    notosans_12_bolditalicBlockOffsets,
+    notosans_12_bolditalicDirectGlyphs,
+    notosans_12_bolditalicGlyphPages,
+    256,
+    notosans_12_bolditalicPageGlyphs,
 };
@@ -2,3103 +2,1922 @@
  * generated by fontconvert.py
  * name: notosans_12_italic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py notosans_12_italic 12 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_12_italic 12 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_italicBitmaps[49440] = {
-    0x00, 0xB8, 0x03, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xF0, 0x0F, 0x80, 0x3D, 0x00, 0xF0, 0x07, 0xC0,
-    0x1E, 0x00, 0xB4, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x7E, 0x01, 0xF4, 0x01,
-    0x00, 0x00, 0x1E, 0x0F, 0x0B, 0x87, 0xC2, 0xD1, 0xE0, 0xF0, 0xB4, 0x38, 0x2C, 0x0D, 0x0E, 0x02,
-    0x02, 0x40, 0x00, 0x02, 0xC0, 0x34, 0x00, 0x00, 0xF0, 0x1D, 0x00, 0x00, 0x38, 0x0B, 0x00, 0x00,
-    0x1D, 0x03, 0x80, 0x00, 0x0B, 0x01, 0xD0, 0x01, 0xAB, 0xEA, 0xFA, 0x80, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0xB0, 0x1E, 0x00, 0x00, 0x3C, 0x0B, 0x00, 0x00, 0x0E, 0x03, 0xC0, 0x00, 0x07, 0x40, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x74, 0x0F, 0x00, 0x00, 0x2C, 0x03,
-    0x80, 0x00, 0x0F, 0x02, 0xC0, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x01, 0xD0, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFF, 0xFC, 0x01, 0xF5, 0xC2,
-    0x40, 0x3C, 0x2C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3D, 0x38, 0x00, 0x02, 0xFB, 0x40, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xEB, 0xD0, 0x00, 0x0D, 0x2E, 0x00, 0x01, 0xD2, 0xE0,
-    0x00, 0x2C, 0x3D, 0x03, 0x93, 0xDF, 0xC0, 0x3F, 0xFF, 0xE0, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x03, 0x81, 0xFB, 0xD0, 0x03, 0xC0, 0xF0, 0x78, 0x02, 0xD0, 0x78, 0x0E, 0x01, 0xE0, 0x2C, 0x03,
-    0x80, 0xF0, 0x0F, 0x01, 0xD0, 0xF0, 0x03, 0xC0, 0xB0, 0xB4, 0x00, 0xF0, 0x3C, 0x78, 0xBE, 0x3C,
-    0x1D, 0x3C, 0xFB, 0xDB, 0xAF, 0x3C, 0xB4, 0x3C, 0xBE, 0x2D, 0x3C, 0x0F, 0x00, 0x1E, 0x1D, 0x03,
-    0xC0, 0x0F, 0x0B, 0x00, 0xE0, 0x0F, 0x03, 0xC0, 0x74, 0x0B, 0x40, 0xF0, 0x2C, 0x07, 0x80, 0x3C,
-    0x0E, 0x03, 0xC0, 0x0B, 0x9F, 0x03, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00,
-    0xB8, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0xF1, 0xF8, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x50, 0x3E, 0x0F, 0x80,
-    0xB8, 0x2E, 0x00, 0xF4, 0x3C, 0x0F, 0x00, 0x1F, 0x3E, 0x03, 0xC0, 0x02, 0xFE, 0x00, 0xF0, 0x00,
-    0x3F, 0x00, 0x3E, 0x00, 0x7F, 0xD0, 0x07, 0xFA, 0xFE, 0xBC, 0x00, 0x7F, 0xF8, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x2E, 0x2D, 0x3C, 0x38, 0x34, 0x20, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0F,
-    0x40, 0x0B, 0x80, 0x03, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0x1F, 0x00,
-    0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
-    0x3D, 0x00, 0x0B, 0x40, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x40, 0x00, 0x00, 0x38, 0x00, 0x0B,
-    0x00, 0x01, 0xD0, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x02, 0xE0,
-    0x00, 0xF0, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x40, 0x3C, 0x00, 0x3D, 0x0D, 0x00, 0x0B, 0xFB,
-    0x00, 0x00, 0x1B, 0xFF, 0xF0, 0x02, 0xF9, 0xA8, 0x02, 0xDF, 0x00, 0x03, 0xE2, 0xD0, 0x01, 0xF0,
-    0x7C, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x0A, 0xAF, 0xEA, 0x97, 0xFF, 0xFF, 0xF8,
-    0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x3D, 0x0B, 0xC0, 0xF4, 0x1E, 0x03, 0xC0, 0x00, 0x00, 0x2A,
-    0xA8, 0xFF, 0xE1, 0x55, 0x00, 0x00, 0x3D, 0x7E, 0x7D, 0x10, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x0F, 0xFF, 0xD0, 0x0F, 0xC0, 0xBC, 0x0B, 0xC0, 0x0F, 0x03, 0xD0, 0x03, 0xD1, 0xF0, 0x00, 0xF4,
-    0xF8, 0x00, 0x3D, 0x3D, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xC7, 0xC0, 0x01, 0xF1, 0xE0, 0x00, 0x7C,
-    0xB8, 0x00, 0x2E, 0x2E, 0x00, 0x0F, 0x4B, 0x80, 0x07, 0xC1, 0xF0, 0x03, 0xD0, 0x3D, 0x03, 0xF0,
-    0x0B, 0xEB, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0xC0, 0xBF,
-    0xE0, 0xFD, 0xF4, 0x3C, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x3C,
-    0x00, 0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0B, 0x80,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x0E, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xFF,
-    0x40, 0x0E, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xF4, 0x00, 0x01, 0xBD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x50, 0x00,
-    0xBC, 0x07, 0xFA, 0xBF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xB4, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xF4,
-    0xF0, 0x00, 0x3D, 0x1F, 0x00, 0x0B, 0x82, 0xE0, 0x02, 0xE0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x1F,
-    0x00, 0x3C, 0x03, 0xC0, 0x07, 0xC0, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x02,
-    0x00, 0x0B, 0xC0, 0x3F, 0xAB, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF4, 0x03, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x7F, 0xE0, 0x0F, 0xBE, 0xBF, 0x03, 0xF4,
-    0x03, 0xD1, 0xF4, 0x00, 0xF4, 0x7C, 0x00, 0x2D, 0x1F, 0x00, 0x0F, 0x47, 0xC0, 0x03, 0xC1, 0xF0,
-    0x01, 0xF0, 0x3E, 0x01, 0xF4, 0x07, 0xFB, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0x80, 0x7D, 0x03, 0xC0, 0x0B, 0x81, 0xF0, 0x02, 0xE0, 0x3C, 0x00,
-    0xF4, 0x0F, 0x80, 0xF8, 0x00, 0xFA, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xBE, 0x00, 0xBD, 0x07,
-    0xD0, 0x7C, 0x00, 0x7C, 0x2E, 0x00, 0x0F, 0x0F, 0x40, 0x03, 0xC3, 0xE0, 0x01, 0xF0, 0xBC, 0x00,
-    0xF8, 0x0F, 0xEA, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x2F, 0x00, 0xF8, 0x0F, 0x00, 0x1F, 0x0B, 0x80, 0x03, 0xC2, 0xD0,
-    0x00, 0xF0, 0xF4, 0x00, 0x7C, 0x3D, 0x00, 0x2F, 0x0B, 0xC0, 0x1F, 0xC0, 0xFD, 0x6F, 0xE0, 0x1F,
-    0xFD, 0xF4, 0x00, 0x54, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x0B, 0xC0, 0x3E, 0xBF, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x7E, 0x0B,
-    0xD0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x7E, 0x07,
-    0xD0, 0x10, 0x00, 0x00, 0x28, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x0B, 0x80, 0x0F,
-    0x00, 0x1E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x02,
-    0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x1B, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0xAA, 0xAA, 0xA8, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xE4, 0x00,
-    0xBF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFE, 0x01, 0xFF, 0xFE, 0x02, 0x40, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0xF4, 0x00, 0x07, 0x40,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xE8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7E,
-    0x40, 0x07, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x6F,
-    0xE4, 0x2D, 0x1E, 0x02, 0xFA, 0xF8, 0x1D, 0x3C, 0x0B, 0x80, 0xB4, 0x1E, 0x38, 0x1F, 0x00, 0xF0,
-    0x1E, 0x74, 0x2D, 0x00, 0xE0, 0x1D, 0xB4, 0x3C, 0x01, 0xD0, 0x2C, 0xB0, 0x3C, 0x03, 0xD0, 0x3C,
-    0xB0, 0x3C, 0x07, 0xC0, 0xB4, 0xB4, 0x2E, 0x1E, 0xE2, 0xF0, 0x78, 0x0F, 0xF4, 0xFF, 0x80, 0x3C,
-    0x01, 0x40, 0x14, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x00, 0x03, 0xFA,
-    0x5A, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x00, 0xF3, 0xC0,
-    0x00, 0x0B, 0x8F, 0x40, 0x00, 0x3C, 0x2D, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x1F, 0x01, 0xE0, 0x00,
-    0xF8, 0x07, 0xC0, 0x07, 0xEA, 0xAF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xF5, 0x55, 0xF0, 0x0F, 0x40,
-    0x03, 0xD0, 0xBC, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x01,
-    0xF0, 0x00, 0xFF, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xE0, 0x0B, 0xD0, 0x3D, 0x00, 0x3E, 0x03,
-    0xC0, 0x02, 0xE0, 0x7C, 0x00, 0x3E, 0x0B, 0x80, 0x07, 0xC0, 0xF9, 0x56, 0xF4, 0x0F, 0xFF, 0xF4,
-    0x00, 0xFA, 0xAF, 0xC0, 0x1F, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0xF4, 0x3D, 0x00, 0x0F, 0x83, 0xC0,
-    0x00, 0xF4, 0x3C, 0x00, 0x1F, 0x07, 0xC0, 0x07, 0xE0, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0x80, 0x08, 0x02,
-    0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xFB, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x2E, 0x01, 0xFE, 0x00, 0xF4, 0x00, 0xBC, 0x03, 0xC0, 0x00, 0xF8, 0x1F, 0x00,
-    0x02, 0xF0, 0xB8, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x1F, 0x0F, 0x40, 0x00, 0xBC, 0x3C, 0x00, 0x02,
-    0xE1, 0xF0, 0x00, 0x0F, 0x8B, 0x80, 0x00, 0x7C, 0x3D, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x2F, 0x43,
-    0xC0, 0x02, 0xF8, 0x1F, 0x00, 0x7F, 0x80, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3E, 0x55, 0x40, 0x0F, 0xFF, 0xF8, 0x03, 0xEA, 0xA9, 0x01,
-    0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0xE0, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0xAA, 0xA4, 0x03, 0xFF, 0xFD, 0x01, 0xF5, 0x55, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0xFE, 0x00, 0x18, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x15, 0x54, 0x3D, 0x00, 0x3F,
-    0xF4, 0x3C, 0x00, 0x2A, 0xF4, 0x3C, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x02,
-    0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x03, 0xC0, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x2E, 0x00,
-    0x02, 0xE0, 0x0F, 0x40, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0xB8,
-    0x00, 0x07, 0xC0, 0x2E, 0x55, 0x56, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xEA, 0xAA, 0xBC, 0x01,
-    0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x02, 0xD0, 0x0F, 0x00, 0x00, 0xF4,
-    0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00,
-    0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40,
-    0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x1B, 0xE4,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00,
-    0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00,
-    0x46, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xE0, 0x02,
-    0xF0, 0x02, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x2F, 0x00, 0x03, 0xC0, 0xBC, 0x00, 0x07, 0xC2, 0xF0,
-    0x00, 0x0B, 0x8B, 0xC0, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0x00,
-    0x00, 0x1F, 0x4B, 0x80, 0x00, 0x2E, 0x07, 0xC0, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x3C, 0x02, 0xF0,
-    0x00, 0x3C, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3E,
-    0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00,
-    0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D,
-    0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xFC, 0x01, 0xFC,
-    0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x2F, 0xE0, 0x0F, 0xB4,
-    0x00, 0x0F, 0xB4, 0x03, 0xDD, 0x00, 0x0B, 0x7C, 0x01, 0xE7, 0x80, 0x03, 0xCF, 0x00, 0xB8, 0xE0,
-    0x03, 0xD7, 0xC0, 0x3D, 0x3C, 0x01, 0xE2, 0xE0, 0x0F, 0x0F, 0x00, 0xF0, 0xF4, 0x03, 0xC3, 0xC0,
-    0x78, 0x3C, 0x01, 0xE0, 0xB0, 0x3C, 0x1F, 0x00, 0xB4, 0x2D, 0x2E, 0x07, 0xC0, 0x3D, 0x07, 0x4F,
-    0x02, 0xE0, 0x0F, 0x01, 0xEB, 0x40, 0xF4, 0x07, 0xC0, 0x7F, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0xD0,
-    0x1F, 0x00, 0xB4, 0x03, 0xF0, 0x0B, 0x80, 0x3C, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x01, 0xF4, 0x00,
-    0x07, 0x80, 0xBE, 0x00, 0x02, 0xE0, 0x2F, 0xC0, 0x00, 0xF4, 0x0F, 0xF4, 0x00, 0x3C, 0x03, 0xDF,
-    0x00, 0x1F, 0x01, 0xE3, 0xC0, 0x07, 0x80, 0xB8, 0xB8, 0x02, 0xD0, 0x3D, 0x1F, 0x00, 0xF4, 0x0F,
-    0x03, 0xD0, 0x3C, 0x03, 0xC0, 0xB8, 0x1F, 0x01, 0xE0, 0x0F, 0x0B, 0x80, 0xB4, 0x03, 0xD2, 0xD0,
-    0x3D, 0x00, 0x78, 0xF0, 0x0F, 0x00, 0x0F, 0x3C, 0x07, 0xC0, 0x02, 0xEF, 0x01, 0xE0, 0x00, 0x7F,
-    0x80, 0xB4, 0x00, 0x0F, 0xD0, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F,
-    0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00,
-    0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0,
-    0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xF0, 0x02, 0xE0, 0x1F, 0x80, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x03,
-    0xC0, 0x7C, 0x00, 0x3C, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xF8, 0x0F, 0x40, 0x7F, 0x00, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0x90, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C,
-    0x2E, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00,
-    0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00,
-    0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xF0, 0x02, 0xE0, 0x1F, 0xC0, 0x3D,
-    0x00, 0x7C, 0x03, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3C, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xF8,
-    0x0F, 0x55, 0xBE, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xAB, 0xC0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x02,
-    0xE0, 0x03, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x07, 0xC0, 0x0B, 0xC0, 0xB8, 0x00, 0x3C, 0x0F,
-    0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x0F, 0xFF, 0xF8, 0x0B, 0xD0, 0x09,
-    0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x50, 0x01, 0xF8, 0x2F, 0xEF, 0xF8, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xB4,
-    0x07, 0xC0, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x02,
-    0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0xF4, 0x00,
-    0x07, 0xC0, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0xBD, 0x00, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x0F, 0x47, 0x80, 0x00, 0xBC, 0x1F, 0x00, 0x03, 0xD0, 0x3C,
-    0x00, 0x2F, 0x00, 0xF0, 0x00, 0xF4, 0x03, 0xC0, 0x0B, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x3D, 0x02,
-    0xE0, 0x00, 0xB4, 0x0F, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x1E, 0x2E, 0x00,
-    0x00, 0x7C, 0xF0, 0x00, 0x00, 0xFB, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x03, 0xD7, 0xC0, 0x02, 0xF4, 0x00, 0x7C, 0x3C,
-    0x00, 0x3F, 0x40, 0x0F, 0x83, 0xC0, 0x0B, 0xF4, 0x00, 0xF0, 0x3C, 0x00, 0xF7, 0x40, 0x2E, 0x03,
-    0xC0, 0x2D, 0x78, 0x03, 0xC0, 0x3C, 0x03, 0xC7, 0x80, 0xB8, 0x03, 0xC0, 0x78, 0x78, 0x0F, 0x00,
-    0x3C, 0x0F, 0x07, 0x81, 0xF0, 0x03, 0xC1, 0xE0, 0x38, 0x3D, 0x00, 0x3C, 0x3C, 0x03, 0x87, 0xC0,
-    0x03, 0xC7, 0x80, 0x3C, 0xB4, 0x00, 0x3C, 0xB4, 0x03, 0xCF, 0x00, 0x03, 0xDF, 0x00, 0x3D, 0xE0,
-    0x00, 0x2E, 0xD0, 0x03, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0x0B, 0x82, 0xF0, 0x00, 0x00, 0x3C,
-    0x7C, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xF2, 0xD0, 0x00, 0x00, 0x3D, 0x1F,
-    0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x0F,
-    0x40, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x2E, 0x00, 0xB8, 0x00, 0x0B, 0x87, 0xC0, 0x01, 0xF0, 0x3C,
-    0x00, 0x3D, 0x03, 0xD0, 0x0B, 0x80, 0x2E, 0x01, 0xF0, 0x01, 0xF0, 0x3D, 0x00, 0x0F, 0x0B, 0x80,
-    0x00, 0xF5, 0xF0, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xD0, 0x00,
-    0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00,
-    0x01, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x38, 0x03, 0xC0, 0x3C,
-    0x03, 0xC0, 0x2D, 0x02, 0xD0, 0x1E, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xB4, 0x07, 0x80,
-    0x78, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x2D, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0x03, 0xC0, 0x00,
-    0x3C, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0,
-    0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2E, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0x6D, 0x00, 0x00, 0xF0, 0xF0, 0x00,
-    0x1E, 0x0B, 0x40, 0x03, 0xC0, 0x3C, 0x00, 0x78, 0x02, 0xD0, 0x0B, 0x00, 0x0F, 0x00, 0xE0, 0x00,
-    0xB4, 0x2D, 0x00, 0x03, 0xC1, 0x40, 0x00, 0x04, 0x2F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x00, 0x0F,
-    0x02, 0xE0, 0x3C, 0x03, 0x80, 0x00, 0x1A, 0x01, 0x40, 0x7F, 0xF5, 0xE0, 0x7E, 0x5B, 0xF4, 0x3D,
-    0x00, 0xFC, 0x2F, 0x00, 0x2F, 0x0F, 0x40, 0x0B, 0x87, 0xC0, 0x02, 0xE2, 0xE0, 0x00, 0xF4, 0xB8,
-    0x00, 0x7C, 0x3D, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0, 0x1F, 0xD0, 0x3F, 0xBD, 0xB0, 0x07,
-    0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x06, 0x80, 0x02, 0xD7, 0xFF, 0x00, 0x3E,
-    0xE5, 0xFC, 0x03, 0xF4, 0x03, 0xC0, 0x7E, 0x00, 0x3C, 0x0B, 0xC0, 0x03, 0xC0, 0xB8, 0x00, 0x3C,
-    0x0F, 0x40, 0x07, 0xC0, 0xF0, 0x00, 0xBC, 0x1F, 0x00, 0x0F, 0x42, 0xF0, 0x01, 0xF0, 0x3F, 0x80,
-    0x7D, 0x03, 0xDF, 0xBF, 0x80, 0x38, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x07,
-    0xFF, 0xD0, 0x7E, 0x46, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E,
-    0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xAB, 0x80,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xA0, 0x7C, 0x01, 0xFF, 0xDB, 0x80, 0xBE,
-    0x5B, 0xF4, 0x0F, 0x40, 0x3F, 0x03, 0xE0, 0x02, 0xF0, 0x3D, 0x00, 0x2E, 0x07, 0xC0, 0x02, 0xD0,
-    0xB8, 0x00, 0x3D, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xFC, 0x0B, 0x80, 0x1F, 0x80, 0xBC, 0x07,
-    0xF4, 0x03, 0xFB, 0xDB, 0x00, 0x1F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x07,
-    0xFF, 0xC0, 0x7E, 0x1F, 0x83, 0xD0, 0x1E, 0x2E, 0x00, 0xB8, 0xF0, 0x0B, 0xC7, 0xEB, 0xFD, 0x2F,
-    0xFF, 0x80, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x10, 0x3F, 0xAB, 0xC0,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B,
-    0xEE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7D, 0x50,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1B, 0xD4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x07, 0xFF, 0x5E, 0x02,
-    0xF9, 0x6F, 0xD0, 0x3D, 0x00, 0xFC, 0x0B, 0xC0, 0x0B, 0xC0, 0xF4, 0x00, 0xB8, 0x1F, 0x00, 0x0F,
-    0x82, 0xE0, 0x00, 0xF4, 0x2E, 0x00, 0x1F, 0x03, 0xD0, 0x03, 0xF0, 0x2E, 0x00, 0x7E, 0x02, 0xF0,
-    0x1F, 0xD0, 0x0F, 0xEF, 0x7C, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0xF0, 0x05, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x1E, 0x06, 0x80, 0x02, 0xD7, 0xFF, 0x40, 0x3E, 0xE5, 0xBC, 0x03, 0xF4, 0x03, 0xC0, 0x7E, 0x00,
-    0x3C, 0x0B, 0xC0, 0x07, 0xC0, 0xB8, 0x00, 0xB8, 0x0F, 0x40, 0x0F, 0x40, 0xF0, 0x00, 0xF0, 0x1F,
-    0x00, 0x0F, 0x02, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x2E, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3C,
-    0x00, 0x00, 0x10, 0x02, 0xE0, 0x0F, 0x80, 0x04, 0x00, 0x00, 0x01, 0x40, 0x2E, 0x00, 0xF4, 0x03,
-    0xC0, 0x1F, 0x00, 0x78, 0x02, 0xE0, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x3D, 0x00, 0xF0,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0x78, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00,
-    0x3D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00,
-    0x1F, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x54, 0x02, 0xE0, 0x1F,
-    0x40, 0x3D, 0x07, 0xD0, 0x03, 0xC1, 0xF4, 0x00, 0x7C, 0x7D, 0x00, 0x0B, 0x9F, 0x40, 0x00, 0xBB,
-    0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x1F, 0x07, 0xC0, 0x02, 0xE0, 0x3D, 0x00,
-    0x3D, 0x02, 0xF0, 0x03, 0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0x7C, 0x02, 0xE0, 0x0F,
-    0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x2E, 0x00, 0xF4, 0x03, 0xC0, 0x1F, 0x00, 0xB8, 0x02, 0xD0,
-    0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x40, 0xA8,
-    0x01, 0xA4, 0x00, 0xB1, 0xFF, 0xC2, 0xFF, 0xC0, 0x3D, 0xE5, 0xF6, 0xD1, 0xF4, 0x0F, 0xD0, 0x2F,
-    0xC0, 0x3D, 0x07, 0xE0, 0x0B, 0xD0, 0x0F, 0x41, 0xF0, 0x02, 0xF0, 0x03, 0xD0, 0xB8, 0x00, 0xF4,
-    0x00, 0xF0, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x07, 0xC0, 0x0B, 0x80,
-    0x0F, 0x42, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x3C, 0x00,
-    0x7C, 0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x01, 0x40, 0xA9, 0x00, 0x2D, 0x7F, 0xF4, 0x03, 0xEF,
-    0x5F, 0xC0, 0x3F, 0x80, 0x7C, 0x07, 0xE0, 0x07, 0xC0, 0xBC, 0x00, 0x7C, 0x0F, 0x80, 0x0B, 0x80,
-    0xF4, 0x00, 0xF8, 0x0F, 0x00, 0x0F, 0x41, 0xF0, 0x01, 0xF0, 0x2E, 0x00, 0x2F, 0x03, 0xD0, 0x02,
-    0xE0, 0x3D, 0x00, 0x3D, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5,
-    0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E,
-    0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1A, 0x00, 0x02, 0xC7, 0xFF, 0x00, 0x0F, 0x79, 0x7F,
-    0x00, 0x3F, 0x40, 0x3C, 0x01, 0xF8, 0x00, 0xF0, 0x07, 0xC0, 0x03, 0xC0, 0x2E, 0x00, 0x0F, 0x00,
-    0xF4, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xF0, 0x1F, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x7C, 0x03, 0xF8,
-    0x07, 0xD0, 0x0F, 0x7E, 0xFE, 0x00, 0x3C, 0x7F, 0xD0, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x01, 0x40, 0x7F, 0xF5, 0xE0, 0x7E, 0x5B, 0xB4, 0x3D, 0x00, 0xFC, 0x2F, 0x00, 0x2F,
-    0x0F, 0x40, 0x0B, 0x87, 0xC0, 0x03, 0xD2, 0xE0, 0x00, 0xF4, 0xB8, 0x00, 0x7C, 0x3D, 0x00, 0x3F,
-    0x0B, 0x80, 0x1F, 0x82, 0xF0, 0x1F, 0xD0, 0x3F, 0xBD, 0xF0, 0x07, 0xFD, 0x3C, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x40, 0xA4, 0x0B, 0x1F, 0xD0, 0x3D, 0xE5, 0x00, 0xFD, 0x00, 0x07, 0xE0, 0x00, 0x1F,
-    0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x0F, 0xFF, 0xC0, 0xFD, 0x1A,
-    0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-    0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x10, 0x02, 0xF0, 0xFA, 0xBF, 0x42, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x2F, 0x54, 0xBF, 0xFF, 0x07, 0xE5, 0x00,
-    0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E,
-    0x00, 0x0B, 0x80, 0x01, 0xFA, 0x80, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43, 0xD0,
-    0x02, 0xE0, 0xF0, 0x00, 0xF4, 0x3C, 0x00, 0x3C, 0x1F, 0x00, 0x1F, 0x0B, 0x80, 0x07, 0x83, 0xD0,
-    0x02, 0xE0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x7C, 0x1E, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0,
-    0x1F, 0xD0, 0x7F, 0xBD, 0xB0, 0x0B, 0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0xB4,
-    0x00, 0x3D, 0xB8, 0x00, 0x7C, 0x78, 0x00, 0xF4, 0x7C, 0x02, 0xF0, 0x3C, 0x03, 0xC0, 0x3C, 0x0B,
-    0x80, 0x3C, 0x0F, 0x00, 0x3C, 0x2E, 0x00, 0x3D, 0x3C, 0x00, 0x2D, 0xB8, 0x00, 0x2E, 0xF0, 0x00,
-    0x1F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x10, 0x00, 0x50, 0x00, 0x52, 0xE0, 0x0B, 0xD0, 0x0B, 0x8B,
-    0x80, 0x3F, 0x40, 0x3C, 0x1E, 0x01, 0xED, 0x02, 0xE0, 0x78, 0x0F, 0x78, 0x0F, 0x01, 0xE0, 0x78,
-    0xE0, 0x7C, 0x07, 0x83, 0xC3, 0x83, 0xD0, 0x1F, 0x1E, 0x0E, 0x1F, 0x00, 0x7C, 0xB0, 0x38, 0xF4,
-    0x00, 0xF3, 0x80, 0xF3, 0xC0, 0x03, 0xEC, 0x03, 0xED, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x3F,
-    0x40, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x2E, 0x00, 0xBC,
-    0x00, 0xF0, 0x1F, 0x00, 0x0B, 0x43, 0xD0, 0x00, 0x7C, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xD2, 0xE0, 0x00,
-    0xF8, 0x0F, 0x00, 0x2F, 0x00, 0xB8, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0x50, 0x00, 0x05, 0x00, 0xB8,
-    0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C,
-    0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x1D,
-    0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0xFF, 0xFF,
-    0x00, 0x55, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x3D, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xAA,
-    0xA0, 0x7F, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0xFE, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0x3C,
-    0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0x7F, 0x40, 0x0B,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x2E, 0x00, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB,
-    0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB4, 0x00, 0x00,
-    0xB8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D,
-    0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0xD0, 0x01, 0xBD, 0x00, 0x7D, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0xB8,
-    0x00, 0xFF, 0x00, 0x0F, 0x80, 0x00, 0x05, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0xA7, 0x96, 0xFF, 0xF4,
-    0x00, 0x0A, 0xE4, 0x00, 0x24, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x64, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0xD0, 0x01, 0xD0, 0x02, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x0B, 0x40, 0x0F, 0x40, 0x0F,
-    0x00, 0x1F, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x40, 0x00, 0x2F, 0xF8, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2F, 0x40, 0x80, 0x0F, 0xFF, 0xC0, 0x01, 0xFE, 0x40, 0x00, 0xD0, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x07, 0xD0, 0x04, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xBE, 0xA9, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xC1, 0x50, 0xDB, 0xFF, 0xFF, 0x0B, 0xD1, 0xF4, 0x3C, 0x00, 0xE0, 0xE0,
-    0x02, 0xC3, 0x40, 0x0B, 0x0F, 0x00, 0x3C, 0x2E, 0x03, 0xD0, 0xFF, 0xFF, 0xCB, 0x1B, 0x8B, 0x40,
-    0x00, 0x04, 0x0F, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0xBC, 0x00, 0xF0, 0x03,
-    0xC0, 0x03, 0xC0, 0x3D, 0x00, 0x0B, 0x42, 0xE0, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x3C, 0xF4, 0x00,
-    0x00, 0xFB, 0x80, 0x00, 0x17, 0xFE, 0x50, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB5, 0x80, 0x00, 0x00,
-    0x00, 0x18, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x0F, 0xEA, 0xF0, 0x07, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x03, 0xFF, 0x80, 0x03, 0xC1, 0xF8, 0x02, 0xC0, 0x0F, 0x00, 0xF0, 0x03, 0xC0, 0x3D, 0x01,
-    0xE0, 0x07, 0xE0, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0xF4, 0x07, 0xEA, 0xFC, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x3D, 0x78, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00,
-    0x00, 0x0F, 0x94, 0x6F, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x0E, 0x00, 0x55, 0x03, 0xC0, 0xB0,
-    0x1F, 0xFE, 0x07, 0x43, 0x40, 0xF4, 0x14, 0x0B, 0x1C, 0x0B, 0x40, 0x00, 0x1C, 0xB0, 0x3C, 0x00,
-    0x00, 0x37, 0x80, 0xF0, 0x00, 0x00, 0xEE, 0x03, 0xC0, 0x00, 0x03, 0xAC, 0x0F, 0x00, 0x00, 0x0D,
-    0x70, 0x3D, 0x00, 0x00, 0x34, 0xD0, 0x7C, 0x00, 0x02, 0xC2, 0xC0, 0xBF, 0xF8, 0x0E, 0x03, 0x80,
-    0x2A, 0x40, 0xF0, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x07, 0xE4, 0x06, 0xF0, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD9, 0x2D, 0x7D, 0x74, 0x2C, 0xB0, 0x2C,
-    0xE0, 0x38, 0xE0, 0x34, 0xF0, 0xF4, 0x7F, 0x70, 0x14, 0x10, 0x00, 0x40, 0x10, 0x07, 0x82, 0xD0,
-    0x7C, 0x1E, 0x0B, 0xC1, 0xF0, 0xBC, 0x1F, 0x03, 0xD0, 0xF4, 0x07, 0xC2, 0xE0, 0x0F, 0x43, 0xC0,
-    0x1E, 0x0B, 0x40, 0x3C, 0x0F, 0x00, 0x10, 0x14, 0x00, 0x2A, 0xAA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x34,
-    0x2A, 0xA8, 0xFF, 0xE1, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00,
-    0x0F, 0x94, 0x6F, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x0E, 0x05, 0x54, 0x03, 0xC0, 0xB0, 0x3F,
-    0xFD, 0x07, 0x43, 0x40, 0xF1, 0xBC, 0x0B, 0x1C, 0x03, 0xC0, 0xF0, 0x1C, 0xB0, 0x0F, 0x03, 0xC0,
-    0x37, 0x80, 0x3D, 0x6E, 0x00, 0xEE, 0x00, 0xFF, 0xE0, 0x03, 0xAC, 0x03, 0xC7, 0x80, 0x0D, 0x70,
-    0x0F, 0x0F, 0x40, 0x34, 0xD0, 0x3C, 0x1F, 0x02, 0xC2, 0xC0, 0xF0, 0x2D, 0x0E, 0x03, 0x82, 0x40,
-    0x24, 0xF0, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x07, 0xE4, 0x06, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA5, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x03,
-    0xD6, 0xE1, 0xD0, 0x2C, 0xB0, 0x07, 0x6C, 0x01, 0xD3, 0x80, 0xF0, 0x7F, 0xF4, 0x01, 0x90, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF8, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xF8, 0x00, 0x14, 0x00, 0xBF, 0xD0, 0x34, 0x7C, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x02,
-    0xD0, 0x02, 0xD0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xF0, 0xAA, 0xA4, 0x00, 0x50, 0x0F, 0xFD,
-    0x09, 0x1F, 0x00, 0x0F, 0x00, 0x0E, 0x06, 0xF8, 0x0A, 0xF4, 0x00, 0x3C, 0x00, 0x2C, 0x40, 0x3C,
-    0xFA, 0xF4, 0x6F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x07, 0xC0, 0x38, 0x00, 0x00, 0x14, 0x00,
-    0x14, 0x02, 0xE0, 0x01, 0xE0, 0x0F, 0x40, 0x0B, 0x80, 0x3C, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0xF0,
-    0x07, 0x80, 0x07, 0xC0, 0x2E, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0xF4, 0x03, 0xC0, 0x03, 0xC0, 0x1F,
-    0x00, 0x2F, 0x00, 0xBC, 0x01, 0xFC, 0x03, 0xF0, 0x1F, 0xE0, 0x0F, 0xFB, 0xEB, 0x40, 0x3E, 0xFD,
-    0x2C, 0x01, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xF8, 0x29, 0xFF, 0xFE, 0x0A, 0xBF, 0xFF, 0x82, 0xAF, 0xFF, 0xE0, 0xAB, 0xFF, 0xF8, 0x2A, 0xFF,
-    0xFE, 0x0A, 0x7F, 0xFF, 0x82, 0x8F, 0xFF, 0xE0, 0xA2, 0xFF, 0xF8, 0x28, 0x2F, 0xFE, 0x0A, 0x00,
-    0x57, 0x82, 0x80, 0x00, 0xA0, 0xA0, 0x00, 0x28, 0x28, 0x00, 0x0A, 0x0A, 0x00, 0x02, 0x82, 0x80,
-    0x00, 0xA0, 0xA0, 0x00, 0x28, 0x28, 0x00, 0x0A, 0x0A, 0x00, 0x02, 0x82, 0x80, 0x00, 0xA0, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0xFC, 0xFC, 0x10, 0x03, 0x80, 0x74, 0x02, 0xD0, 0x0E, 0x17, 0xD3,
-    0xF4, 0x00, 0x00, 0x2E, 0x1F, 0xD3, 0xAD, 0x02, 0xC0, 0x3C, 0x03, 0x80, 0x74, 0x0B, 0x00, 0xF0,
-    0x0F, 0x00, 0x90, 0x00, 0x00, 0x0B, 0xF0, 0x2D, 0x7C, 0x74, 0x1C, 0xB0, 0x0D, 0xE0, 0x1C, 0xE0,
-    0x2C, 0xB0, 0x74, 0x3F, 0xE0, 0x05, 0x00, 0x05, 0x02, 0x00, 0x3C, 0x0E, 0x00, 0x78, 0x2D, 0x00,
-    0xF0, 0x7C, 0x02, 0xE0, 0xF4, 0x0B, 0xC2, 0xF0, 0x7C, 0x1F, 0x43, 0xC0, 0xF4, 0x3D, 0x0F, 0x42,
-    0xD0, 0xF4, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x2C, 0x0F, 0xE0,
-    0x00, 0xB4, 0x3D, 0xD0, 0x01, 0xE0, 0x02, 0xD0, 0x03, 0xC0, 0x02, 0xC0, 0x0F, 0x00, 0x03, 0xC0,
-    0x2D, 0x00, 0x03, 0x80, 0x78, 0x00, 0x07, 0x40, 0xF0, 0x3C, 0x0B, 0x03, 0xC0, 0xFC, 0x0F, 0x0B,
-    0x42, 0xFC, 0x0A, 0x1E, 0x07, 0x78, 0x00, 0x3C, 0x1D, 0x74, 0x00, 0xF0, 0x38, 0xB0, 0x02, 0xD0,
-    0xF5, 0xF4, 0x07, 0x81, 0xFF, 0xFD, 0x0F, 0x00, 0x01, 0xE0, 0x2C, 0x00, 0x01, 0xD0, 0x74, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x02, 0xC0, 0x0F, 0xE0, 0x00, 0xB4, 0x03,
-    0xDD, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x03, 0xC0, 0x00, 0x2C, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x2D,
-    0x00, 0x00, 0x38, 0x07, 0x81, 0x40, 0x07, 0x40, 0xF2, 0xFF, 0x40, 0xB0, 0x2C, 0x34, 0x7C, 0x0F,
-    0x07, 0x40, 0x02, 0xC0, 0xA0, 0xE0, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x0B, 0x40, 0x0B, 0x40, 0x02,
-    0xE0, 0x01, 0xE0, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x02, 0xD0,
-    0x03, 0xFF, 0xF0, 0x78, 0x00, 0x2A, 0xAA, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x1E, 0x09, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x2B,
-    0x80, 0x03, 0x80, 0x06, 0xF8, 0x00, 0xF0, 0x00, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x1D, 0x07, 0x81,
-    0xF0, 0x02, 0xD0, 0xF0, 0x7E, 0xBE, 0xF8, 0x3C, 0x0F, 0xD2, 0xB9, 0x0B, 0x43, 0xAC, 0x00, 0x01,
-    0xE0, 0xF3, 0xC0, 0x00, 0x3C, 0x2C, 0x38, 0x00, 0x0F, 0x07, 0x97, 0x90, 0x02, 0xD0, 0xFF, 0xFF,
-    0x00, 0x78, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x09, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0x40,
-    0x00, 0xF0, 0x00, 0x2E, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x3D, 0x00, 0x07, 0xC0,
-    0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x7E, 0x06, 0xC2, 0xFF, 0xFC, 0x06, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xEF, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x03, 0xC2, 0xD0, 0x00,
-    0x2E, 0x0B, 0x80, 0x01, 0xF0, 0x1E, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x7E, 0xAA, 0xF0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x1F, 0x55, 0x5F, 0x00, 0xF4, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0xF4, 0x3D, 0x00, 0x02,
-    0xE2, 0xF0, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0,
-    0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0,
-    0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0,
-    0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8,
-    0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7C, 0x38, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0,
-    0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0,
-    0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0,
-    0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8,
-    0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x1F, 0xE0,
-    0xD0, 0x00, 0x0E, 0xBF, 0xF0, 0x00, 0x07, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00,
-    0x3C, 0xF0, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x0B, 0x82, 0xE0, 0x00,
-    0x07, 0xC0, 0x78, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x01, 0xFA, 0xAB, 0xC0, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7D, 0x55, 0x7C, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00,
-    0xB8, 0x0B, 0xC0, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x2D, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00,
-    0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x1F,
-    0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xF5,
-    0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8, 0x2F, 0x00,
-    0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02,
-    0x83, 0x80, 0x00, 0x0E, 0x0A, 0x00, 0x00, 0x1D, 0xB4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xBC, 0x00,
-    0x00, 0x3C, 0xF0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0xB8, 0x2E, 0x00, 0x07,
-    0xC0, 0x78, 0x00, 0x3E, 0x01, 0xF0, 0x01, 0xFA, 0xAB, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7D, 0x55,
-    0x7C, 0x03, 0xD0, 0x00, 0xF4, 0x2F, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x0B, 0x8B, 0xC0, 0x00, 0x2E,
-    0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x3D, 0x55, 0x40, 0x00, 0x07, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x0F, 0x40, 0x7E, 0xAA, 0x80,
-    0x00, 0x2F, 0xAA, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xF9, 0x56, 0xF0,
-    0x00, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80,
-    0x02, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3D, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0x80, 0x08, 0x02,
-    0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xFB, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x03, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x17, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xE5, 0x54, 0x00, 0xFF, 0xFF, 0x80, 0x3E,
-    0xAA, 0x90, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xE5, 0x54, 0x00, 0xFF, 0xFF, 0x80, 0x3E, 0xAA, 0x90,
-    0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x78, 0x78, 0x00, 0x74, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFE, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x03, 0xE5, 0x54, 0x00, 0xFF, 0xFF, 0x80, 0x3E, 0xAA, 0x90, 0x1F, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0xC0, 0x01,
-    0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x0B,
-    0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x95, 0x50, 0x03, 0xFF, 0xFE, 0x00, 0xFA, 0xAA, 0x40, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x01,
-    0xBE, 0x40, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x02,
-    0xD0, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0,
-    0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x1B, 0xE4, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x7C, 0x3C, 0x00, 0xE0, 0x1D, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x1B,
-    0xE4, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x7C, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xC0, 0x00, 0x1B, 0xE4, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFA, 0x00, 0x00, 0x7F,
-    0xFF, 0xE0, 0x00, 0xB8, 0x07, 0xF8, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0xF0, 0x00, 0x3E, 0x01, 0xF0,
-    0x00, 0x2F, 0x02, 0xE0, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x1F, 0x2F, 0xFF, 0xC0, 0x2F, 0x3F, 0xFF,
-    0xC0, 0x2E, 0x07, 0xC0, 0x00, 0x3E, 0x0B, 0x80, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0xFC, 0x0F, 0x00,
-    0x02, 0xF4, 0x0F, 0x00, 0x0B, 0xE0, 0x1F, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x7F, 0x83, 0x40, 0x00, 0x3A, 0xFF, 0xC0, 0x00,
-    0x1C, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xE0, 0x2F, 0x80, 0x00, 0xB8,
-    0x0B, 0xF0, 0x00, 0x3D, 0x03, 0xFD, 0x00, 0x0F, 0x00, 0xF7, 0xC0, 0x07, 0xC0, 0x78, 0xF0, 0x01,
-    0xE0, 0x2E, 0x2E, 0x00, 0xB4, 0x0F, 0x47, 0xC0, 0x3D, 0x03, 0xC0, 0xF4, 0x0F, 0x00, 0xF0, 0x2E,
-    0x07, 0xC0, 0x78, 0x03, 0xC2, 0xE0, 0x2D, 0x00, 0xF4, 0xB4, 0x0F, 0x40, 0x1E, 0x3C, 0x03, 0xC0,
-    0x03, 0xCF, 0x01, 0xF0, 0x00, 0xBB, 0xC0, 0x78, 0x00, 0x1F, 0xE0, 0x2D, 0x00, 0x03, 0xF4, 0x0F,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0xBC,
-    0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x03, 0xC3,
-    0xD0, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x0F,
-    0x83, 0xD0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x02,
-    0xF4, 0x00, 0x7F, 0xEF, 0xF4, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x02, 0xF0, 0x3D, 0x00,
-    0x00, 0x3C, 0x1F, 0x00, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0xF0, 0xF4,
-    0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0x07, 0xD0,
-    0xF8, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x7F, 0xEF, 0xF4,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xC3, 0x80, 0x00, 0x03, 0x80, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00,
-    0x0F, 0x0B, 0x80, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x7C, 0x3C, 0x00,
-    0x00, 0x2F, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x03, 0xF0, 0x2F,
-    0x00, 0x02, 0xF0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x7F, 0xEF, 0xF4, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x7F, 0x83, 0x40, 0x00, 0x3A,
-    0xFF, 0xC0, 0x00, 0x1C, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0,
-    0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x03,
-    0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00,
-    0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF,
-    0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00,
-    0x00, 0x0F, 0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C,
-    0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0,
-    0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x38, 0x7D, 0x00, 0xF8, 0x1F, 0x43, 0xE0, 0x07, 0xDF, 0x80,
-    0x01, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xEF, 0x40, 0x0F, 0x87, 0xD0, 0x3E, 0x01, 0xF4, 0xB8,
-    0x00, 0x7C, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0xFF, 0xE2, 0xE0, 0x03, 0xFF,
-    0xFF, 0xF0, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xFE, 0x02, 0xF0, 0x00, 0xFF, 0xC0, 0xF4,
-    0x00, 0xB8, 0xF0, 0x7C, 0x00, 0x7C, 0x3C, 0x2E, 0x00, 0x7C, 0x0F, 0x0F, 0x40, 0x3D, 0x03, 0xC3,
-    0xD0, 0x3D, 0x01, 0xF0, 0xF0, 0x2E, 0x00, 0xBC, 0x3C, 0x1F, 0x00, 0x3E, 0x0F, 0x5F, 0x00, 0x1F,
-    0x43, 0xEF, 0x40, 0x0F, 0xC0, 0xBF, 0x40, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x07, 0xFF, 0xBF,
-    0xD0, 0x07, 0xDB, 0xFF, 0x80, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00,
-    0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x2E, 0x00,
-    0x00, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x7C,
-    0x00, 0x03, 0xC0, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00,
-    0xF0, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xFF, 0xBF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E,
-    0x00, 0xF0, 0x00, 0x0B, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00,
-    0x7C, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xC0, 0x2E, 0x00,
-    0x00, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x3D,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x0B, 0x4F, 0x00, 0x00, 0x0B, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0B, 0x40,
-    0x7C, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xC0, 0x00, 0x2E,
-    0x00, 0xF0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00,
-    0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xD0, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x3C, 0x00, 0x00, 0x2D, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x01, 0xF0, 0x0F, 0x40,
-    0x00, 0xB8, 0x03, 0xC0, 0x00, 0x2D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x03, 0xC0, 0x3D,
-    0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x00,
-    0xB8, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D,
-    0x00, 0xF4, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0x87, 0xC0,
-    0x01, 0xF0, 0x3C, 0x00, 0x3D, 0x03, 0xD0, 0x0B, 0x80, 0x2E, 0x01, 0xF0, 0x01, 0xF0, 0x3D, 0x00,
-    0x0F, 0x0B, 0x80, 0x00, 0xF5, 0xF0, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0F, 0xFA, 0x40, 0x03, 0xFF, 0xFD, 0x01, 0xF0, 0x1F, 0xC0, 0xB8, 0x00,
-    0xF4, 0x3D, 0x00, 0x3E, 0x0F, 0x00, 0x0F, 0x83, 0xC0, 0x03, 0xD1, 0xF0, 0x02, 0xF0, 0xB8, 0x02,
-    0xF4, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x2F, 0xEF, 0xD0, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x3E,
-    0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x2E, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x3C,
-    0x2E, 0x00, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0x0B, 0x40, 0xFD, 0x00,
-    0x00, 0xF4, 0x02, 0xF0, 0x00, 0x0F, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00,
-    0x07, 0xC0, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x3C, 0x7A, 0xBF, 0x00, 0x03, 0xC3, 0xFF, 0x80, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0,
-    0x14, 0x07, 0xFF, 0x5E, 0x07, 0xE5, 0xBF, 0x43, 0xD0, 0x0F, 0xC2, 0xF0, 0x02, 0xF0, 0xF4, 0x00,
-    0xB8, 0x7C, 0x00, 0x2E, 0x2E, 0x00, 0x0F, 0x4B, 0x80, 0x07, 0xC3, 0xD0, 0x03, 0xF0, 0xB8, 0x01,
-    0xF8, 0x2F, 0x01, 0xFD, 0x03, 0xFB, 0xDB, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA0, 0x14, 0x07, 0xFF, 0x5E, 0x07, 0xE5, 0xBF, 0x43, 0xD0, 0x0F, 0xC2,
-    0xF0, 0x02, 0xF0, 0xF4, 0x00, 0xB8, 0x7C, 0x00, 0x2E, 0x2E, 0x00, 0x0F, 0x4B, 0x80, 0x07, 0xC3,
-    0xD0, 0x03, 0xF0, 0xB8, 0x01, 0xF8, 0x2F, 0x01, 0xFD, 0x03, 0xFB, 0xDB, 0x00, 0x7F, 0xD3, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xF0,
-    0xF0, 0x00, 0xE0, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x14, 0x07, 0xFF, 0x5E, 0x07, 0xE5,
-    0xBF, 0x43, 0xD0, 0x0F, 0xC2, 0xF0, 0x02, 0xF0, 0xF4, 0x00, 0xB8, 0x7C, 0x00, 0x2E, 0x2E, 0x00,
-    0x0F, 0x4B, 0x80, 0x07, 0xC3, 0xD0, 0x03, 0xF0, 0xB8, 0x01, 0xF8, 0x2F, 0x01, 0xFD, 0x03, 0xFB,
-    0xDB, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x1F, 0xE0, 0xD0,
-    0x0F, 0x7F, 0xF0, 0x03, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x1F, 0xFD, 0x78,
-    0x1F, 0x96, 0xFD, 0x0F, 0x40, 0x3F, 0x0B, 0xC0, 0x0B, 0xC3, 0xD0, 0x02, 0xE1, 0xF0, 0x00, 0xB8,
-    0xB8, 0x00, 0x3D, 0x2E, 0x00, 0x1F, 0x0F, 0x40, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4,
-    0x0F, 0xEF, 0x6C, 0x01, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0B,
-    0x80, 0x03, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x1F, 0xFD,
-    0x78, 0x1F, 0x96, 0xFD, 0x0F, 0x40, 0x3F, 0x0B, 0xC0, 0x0B, 0xC3, 0xD0, 0x02, 0xE1, 0xF0, 0x00,
-    0xB8, 0xB8, 0x00, 0x3D, 0x2E, 0x00, 0x1F, 0x0F, 0x40, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07,
-    0xF4, 0x0F, 0xEF, 0x6C, 0x01, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x02, 0xC3, 0x80, 0x00, 0xA0, 0xA0, 0x00, 0x1E, 0xB4, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x05, 0x01, 0xFF, 0xD7, 0x81, 0xF9, 0x6F, 0xD0, 0xF4, 0x03, 0xF0, 0xBC,
-    0x00, 0xBC, 0x3D, 0x00, 0x2E, 0x1F, 0x00, 0x0B, 0x8B, 0x80, 0x03, 0xD2, 0xE0, 0x01, 0xF0, 0xF4,
-    0x00, 0xFC, 0x2E, 0x00, 0x7E, 0x0B, 0xC0, 0x7F, 0x40, 0xFE, 0xF6, 0xC0, 0x1F, 0xF4, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x01, 0x0A, 0x80, 0x07, 0xFF, 0x3E, 0xFF, 0xD0, 0x7E, 0x5E, 0xFE,
-    0x4B, 0xC3, 0xD0, 0x1F, 0xE0, 0x1F, 0x2E, 0x00, 0x3F, 0x00, 0x7C, 0xF4, 0x00, 0xF4, 0x07, 0xD7,
-    0xC0, 0x03, 0xEB, 0xFD, 0x2E, 0x00, 0x1F, 0xFF, 0x80, 0xB8, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x07,
-    0xE0, 0x00, 0x0F, 0x80, 0x3F, 0xC0, 0x00, 0x2F, 0x02, 0xFF, 0x40, 0x10, 0x3F, 0xBD, 0xFF, 0xEB,
-    0xD0, 0x7F, 0x87, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x07, 0xFF,
-    0xD0, 0x7E, 0x46, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00,
-    0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xAB, 0x80, 0x2F,
-    0xFD, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x01, 0x6F, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x7F, 0xFC, 0x07, 0xE1, 0xF8, 0x3D, 0x01, 0xE2, 0xE0, 0x0B,
-    0x8F, 0x00, 0xBC, 0x7E, 0xBF, 0xD2, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00,
-    0x01, 0xF0, 0x01, 0x03, 0xFA, 0xBC, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x01, 0xFF, 0xF0, 0x07, 0xE1, 0xF8, 0x0F, 0x40, 0x78, 0x2E, 0x00, 0xB8, 0x3C, 0x02, 0xF0,
-    0x7E, 0xBF, 0xD0, 0xBF, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7C,
-    0x00, 0x40, 0x3F, 0xAB, 0xC0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x02, 0xFE, 0x00, 0x2D, 0x3C, 0x02, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x7F,
-    0xFC, 0x07, 0xE1, 0xF8, 0x3D, 0x01, 0xE2, 0xE0, 0x0B, 0x8F, 0x00, 0xBC, 0x7E, 0xBF, 0xD2, 0xFF,
-    0xF8, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x01, 0x03, 0xFA, 0xBC, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xF0, 0x0F, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x1F, 0xFF, 0x01, 0xF8, 0x7E, 0x0F, 0x40, 0x78, 0xB8, 0x02,
-    0xE3, 0xC0, 0x2F, 0x1F, 0xAF, 0xF4, 0xBF, 0xFE, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00,
-    0x00, 0x7C, 0x00, 0x40, 0xFE, 0xAF, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x3D, 0x00, 0x3C, 0x00, 0x74, 0x00, 0x00, 0x05, 0x00, 0xB8, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x01,
-    0xE0, 0x0B, 0x80, 0x3D, 0x00, 0xF0, 0x07, 0xC0, 0x2E, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x02, 0xE0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0,
-    0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0xD0, 0x3D, 0x3C, 0x28, 0x03, 0x40, 0x00, 0x00, 0x05, 0x00, 0x0B, 0x80, 0x03, 0xD0,
-    0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00,
-    0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0xF0, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00,
-    0x78, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x0F,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x90, 0x01, 0xFA, 0xF4, 0x00, 0x0F,
-    0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0x4F, 0x00, 0x01, 0x02, 0xD0, 0x00, 0x00, 0x78, 0x00, 0xAE,
-    0x4F, 0x01, 0xFF, 0xF7, 0xC1, 0xF8, 0x0B, 0xF0, 0xF4, 0x00, 0xFC, 0x7C, 0x00, 0x2F, 0x2E, 0x00,
-    0x0B, 0x8F, 0x40, 0x03, 0xD3, 0xD0, 0x00, 0xF0, 0xF4, 0x00, 0xB8, 0x2F, 0x00, 0x7C, 0x03, 0xFA,
-    0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0xFE, 0x0E,
-    0x00, 0x2D, 0xFF, 0xC0, 0x03, 0x41, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0A, 0x90, 0x02, 0xD7,
-    0xFF, 0x40, 0x3E, 0xF5, 0xFC, 0x03, 0xF8, 0x07, 0xC0, 0x7E, 0x00, 0x7C, 0x0B, 0xC0, 0x07, 0xC0,
-    0xF8, 0x00, 0xB8, 0x0F, 0x40, 0x0F, 0x80, 0xF0, 0x00, 0xF4, 0x1F, 0x00, 0x1F, 0x02, 0xE0, 0x02,
-    0xF0, 0x3D, 0x00, 0x2E, 0x03, 0xD0, 0x03, 0xD0, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F,
-    0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C,
-    0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40,
-    0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C,
-    0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01,
-    0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x2F, 0xF0, 0x00, 0xB8, 0xB4, 0x01, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01,
-    0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00,
-    0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0,
-    0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x2F, 0xD2, 0xC0,
-    0x1E, 0xBF, 0xD0, 0x0A, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0x40,
-    0x2F, 0x96, 0xF0, 0x1F, 0x40, 0x3E, 0x0F, 0x80, 0x07, 0xC3, 0xC0, 0x01, 0xF1, 0xF0, 0x00, 0x7C,
-    0xB8, 0x00, 0x2E, 0x3D, 0x00, 0x0F, 0x8F, 0x40, 0x03, 0xC2, 0xE0, 0x02, 0xE0, 0x7C, 0x01, 0xF0,
-    0x0B, 0xEB, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x3C,
-    0x00, 0xB4, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B,
-    0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00,
-    0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x97, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x69, 0x1C, 0x00, 0x7F, 0xFF, 0x80, 0x2F, 0x96, 0xF4, 0x07, 0xC0, 0x3F, 0x80, 0xF4,
-    0x0B, 0xBC, 0x0F, 0x01, 0xE7, 0xC1, 0xE0, 0x7C, 0x7C, 0x2D, 0x0F, 0x07, 0x83, 0xD3, 0xC0, 0xB4,
-    0x3D, 0xB4, 0x0F, 0x02, 0xFE, 0x02, 0xE0, 0x1F, 0xC0, 0x7C, 0x00, 0xFE, 0xBF, 0x40, 0x3E, 0xFF,
-    0x80, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x3D, 0x00, 0x2E, 0x0F,
-    0x00, 0x0F, 0x43, 0xC0, 0x03, 0xC1, 0xF0, 0x01, 0xF0, 0xB8, 0x00, 0x78, 0x3D, 0x00, 0x2E, 0x0F,
-    0x00, 0x0F, 0x47, 0xC0, 0x07, 0xC1, 0xE0, 0x03, 0xF0, 0xB8, 0x01, 0xF8, 0x2F, 0x01, 0xFD, 0x07,
-    0xFB, 0xDB, 0x00, 0xBF, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x0B, 0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x14, 0x3D, 0x00, 0x2E, 0x0F, 0x00, 0x0F, 0x43, 0xC0, 0x03, 0xC1, 0xF0, 0x01, 0xF0, 0xB8, 0x00,
-    0x78, 0x3D, 0x00, 0x2E, 0x0F, 0x00, 0x0F, 0x47, 0xC0, 0x07, 0xC1, 0xE0, 0x03, 0xF0, 0xB8, 0x01,
-    0xF8, 0x2F, 0x01, 0xFD, 0x07, 0xFB, 0xDB, 0x00, 0xBF, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xF4, 0xF0, 0x00, 0xA0, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x3D, 0x00, 0x2E, 0x0F, 0x00, 0x0F, 0x43, 0xC0, 0x03, 0xC1,
-    0xF0, 0x01, 0xF0, 0xB8, 0x00, 0x78, 0x3D, 0x00, 0x2E, 0x0F, 0x00, 0x0F, 0x47, 0xC0, 0x07, 0xC1,
-    0xE0, 0x03, 0xF0, 0xB8, 0x01, 0xF8, 0x2F, 0x01, 0xFD, 0x07, 0xFB, 0xDB, 0x00, 0xBF, 0xD3, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07, 0x80, 0x03, 0xC2, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x0F, 0x00,
-    0x0F, 0x07, 0xC0, 0x07, 0xC2, 0xE0, 0x01, 0xE0, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x1F, 0x00,
-    0x1F, 0x07, 0x80, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4, 0x1F, 0xEF, 0x6C, 0x02, 0xFF,
-    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x05, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02,
-    0xF0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E,
-    0x00, 0x00, 0x1D, 0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x01, 0xE0, 0x68, 0x00, 0x0B, 0x5F, 0xFC, 0x00, 0x3E, 0xE5, 0xFC, 0x00, 0xFD, 0x00, 0xF0, 0x07,
-    0xE0, 0x03, 0xC0, 0x1F, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x3C, 0x03, 0xD0, 0x01, 0xF0, 0x0F, 0x00,
-    0x0B, 0xC0, 0x7C, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x0F, 0xE0, 0x1F, 0x40, 0x3D, 0xFB, 0xF8,
-    0x00, 0xF1, 0xFF, 0x40, 0x07, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD1, 0xF0, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x05, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00,
-    0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00,
-    0x2D, 0x2E, 0x00, 0x00, 0x1D, 0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00,
-    0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xF5, 0x55, 0xF0, 0x03,
-    0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0xB8, 0x3D,
-    0x00, 0x00, 0x7C, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x05,
-    0x01, 0xFF, 0xD7, 0x81, 0xF9, 0x6F, 0xD0, 0xF4, 0x03, 0xF0, 0xBC, 0x00, 0xBC, 0x3D, 0x00, 0x2E,
-    0x1F, 0x00, 0x0B, 0x8B, 0x80, 0x03, 0xD2, 0xE0, 0x01, 0xF0, 0xF4, 0x00, 0xFC, 0x2E, 0x00, 0x7E,
-    0x0B, 0xC0, 0x7F, 0x40, 0xFE, 0xF6, 0xC0, 0x1F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x05, 0x00, 0x00, 0x74, 0x1D, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xBB, 0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B,
-    0x82, 0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF,
-    0xFF, 0xF0, 0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40,
-    0x00, 0xB8, 0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x20, 0x05, 0x00, 0x0D, 0x07,
-    0x80, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x1F, 0xFD,
-    0x78, 0x1F, 0x96, 0xFD, 0x0F, 0x40, 0x3F, 0x0B, 0xC0, 0x0B, 0xC3, 0xD0, 0x02, 0xE1, 0xF0, 0x00,
-    0xB8, 0xB8, 0x00, 0x3D, 0x2E, 0x00, 0x1F, 0x0F, 0x40, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07,
-    0xF4, 0x0F, 0xEF, 0x6C, 0x01, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x0B,
-    0x8F, 0x40, 0x00, 0x3C, 0x2D, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0xF8, 0x07,
-    0xC0, 0x07, 0xEA, 0xAF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xF5, 0x55, 0xF0, 0x0F, 0x40, 0x03, 0xD0,
-    0xBC, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1A, 0x01, 0x40, 0x7F, 0xF5, 0xE0, 0x7E, 0x5B, 0xF4, 0x3D,
-    0x00, 0xFC, 0x2F, 0x00, 0x2F, 0x0F, 0x40, 0x0B, 0x87, 0xC0, 0x02, 0xE2, 0xE0, 0x00, 0xF4, 0xB8,
-    0x00, 0x7C, 0x3D, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0, 0x1F, 0xD0, 0x3F, 0xBD, 0xB0, 0x07,
-    0xFD, 0x3C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x20, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2E, 0x00, 0x01, 0xE0, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x7F, 0xFD, 0x07, 0xE4, 0x60, 0x3D, 0x00, 0x03,
-    0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00,
-    0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFA, 0xB8, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xB8, 0xB4, 0x00, 0x07, 0x40,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x20,
-    0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xFD, 0x00, 0x3D, 0x3C, 0x02, 0x80, 0x34, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x7F, 0xFD, 0x07, 0xE4, 0x60, 0x3D, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFA, 0xB8,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0x80, 0x3F, 0x80, 0x08, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xFB, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x1F, 0xFF, 0x41, 0xF9, 0x18, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE,
-    0xAE, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x41, 0xE0, 0x00,
-    0x0F, 0x2E, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x20, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2C, 0x00, 0x78, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x01, 0xFF, 0xF4, 0x07, 0xE4, 0x60,
-    0x0F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0xAB, 0x80, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x1E, 0x3C, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x80, 0x00, 0x7F,
-    0xFF, 0xE0, 0x02, 0xE0, 0x1F, 0xE0, 0x0F, 0x40, 0x0B, 0xC0, 0x3C, 0x00, 0x0F, 0x81, 0xF0, 0x00,
-    0x2F, 0x0B, 0x80, 0x00, 0x7C, 0x3D, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0x2E,
-    0x1F, 0x00, 0x00, 0xF8, 0xB8, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x3F, 0x0F, 0x00, 0x02, 0xF4, 0x3C,
-    0x00, 0x2F, 0x81, 0xF0, 0x07, 0xF8, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0xF0, 0x00, 0x00, 0x0B, 0x8B, 0x40, 0x00, 0x00, 0x3D, 0x38, 0x00, 0x00, 0x00, 0xF2,
-    0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x68, 0x1F, 0x00, 0x00, 0x1F, 0xFD, 0xB8, 0x00, 0x02,
-    0xF9, 0x6F, 0xD0, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x02,
-    0xE0, 0x00, 0x1F, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x01, 0xF0, 0x00,
-    0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x2E, 0x00, 0x7E, 0x00, 0x00, 0xBC, 0x07, 0xF4, 0x00, 0x00, 0xFE,
-    0xF6, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFA,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xB8, 0x07, 0xF8, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0xF0, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x1F, 0x2F, 0xFF, 0xC0,
-    0x2F, 0x3F, 0xFF, 0xC0, 0x2E, 0x07, 0xC0, 0x00, 0x3E, 0x0B, 0x80, 0x00, 0x7C, 0x0F, 0x40, 0x00,
-    0xFC, 0x0F, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x0B, 0xE0, 0x1F, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2A, 0x07, 0xC0, 0x02, 0xFF, 0xDB,
-    0x80, 0x0B, 0xE0, 0xBF, 0x40, 0x1F, 0x40, 0x3F, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x2E,
-    0x00, 0x7C, 0x00, 0x2D, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0xFC,
-    0x00, 0xB8, 0x01, 0xF8, 0x00, 0xBC, 0x07, 0xF4, 0x00, 0x3F, 0xBD, 0xB0, 0x00, 0x1F, 0xF4, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF9, 0x55, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xAA, 0xA4, 0x07,
-    0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x06, 0x90, 0x01, 0xFF, 0xF0, 0x1F, 0x87, 0xE0, 0xF4, 0x07, 0x8B, 0x80, 0x2E,
-    0x3C, 0x02, 0xF1, 0xFA, 0xFF, 0x4B, 0xFF, 0xE0, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00,
-    0x07, 0xC0, 0x04, 0x0F, 0xEA, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40,
-    0x0B, 0x01, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xF8, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0F, 0x95, 0x50, 0x03, 0xFF, 0xFE, 0x00, 0xFA, 0xAA, 0x40, 0x7C, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x40, 0x08, 0x00, 0xE0, 0x2C, 0x00, 0xBF, 0xF4,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF0, 0x07, 0xE1, 0xF8, 0x0F,
-    0x40, 0x78, 0x2E, 0x00, 0xB8, 0x3C, 0x02, 0xF0, 0x7E, 0xBF, 0xD0, 0xBF, 0xFE, 0x00, 0xF8, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x3F, 0xAB, 0xC0, 0x0B, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x95, 0x50, 0x03, 0xFF, 0xFE,
-    0x00, 0xFA, 0xAA, 0x40, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x1F,
-    0xFF, 0x01, 0xF8, 0x7E, 0x0F, 0x40, 0x78, 0xB8, 0x02, 0xE3, 0xC0, 0x2F, 0x1F, 0xAF, 0xF4, 0xBF,
-    0xFE, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x40, 0xFE, 0xAF, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3E, 0x55, 0x40, 0x0F,
-    0xFF, 0xF8, 0x03, 0xEA, 0xA9, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x1A, 0x40, 0x07, 0xFF, 0xC0, 0x7E, 0x1F, 0x83, 0xD0, 0x1E, 0x2E, 0x00,
-    0xB8, 0xF0, 0x0B, 0xC7, 0xEB, 0xFD, 0x2F, 0xFF, 0x80, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0x00, 0x1F, 0x00, 0x10, 0x3F, 0xAB, 0xC0, 0x2F, 0xFE, 0x00, 0x02, 0xD0, 0x00, 0x1D, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0x78, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF9, 0x55, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFA,
-    0xAA, 0x40, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x2D, 0x00, 0x3C, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF0, 0x07, 0xE1, 0xF8, 0x0F, 0x40, 0x78, 0x2E, 0x00, 0xB8, 0x3C,
-    0x02, 0xF0, 0x7E, 0xBF, 0xD0, 0xBF, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x7C, 0x00, 0x40, 0x3F, 0xAB, 0xC0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x03, 0x80,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFE, 0x00,
-    0x18, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x15, 0x54, 0x3D, 0x00, 0x3F, 0xF4, 0x3C, 0x00, 0x2A,
-    0xF4, 0x3C, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x02, 0xE0, 0x2F, 0x00, 0x03,
-    0xD0, 0x0F, 0xC0, 0x03, 0xC0, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF0, 0xF0, 0x00,
-    0x38, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x07, 0xFF, 0x5E, 0x02, 0xF9, 0x6F,
-    0xD0, 0x3D, 0x00, 0xFC, 0x0B, 0xC0, 0x0B, 0xC0, 0xF4, 0x00, 0xB8, 0x1F, 0x00, 0x0F, 0x82, 0xE0,
-    0x00, 0xF4, 0x2E, 0x00, 0x1F, 0x03, 0xD0, 0x03, 0xF0, 0x2E, 0x00, 0x7E, 0x02, 0xF0, 0x1F, 0xD0,
-    0x0F, 0xEF, 0x7C, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0xF0, 0x05, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x80, 0x04,
-    0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFE, 0x00, 0x18, 0x02, 0xF4, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x15, 0x54, 0x3D, 0x00, 0x3F, 0xF4, 0x3C, 0x00, 0x2A, 0xF4, 0x3C, 0x00, 0x00, 0xF0,
-    0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x02, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x03, 0xC0,
-    0x07, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x40,
-    0x01, 0xD0, 0x74, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x05, 0x00, 0x7F, 0xF5, 0xE0, 0x2F, 0x96, 0xFD, 0x03, 0xD0, 0x0F, 0xC0, 0xBC, 0x00, 0xBC, 0x0F,
-    0x40, 0x0B, 0x81, 0xF0, 0x00, 0xF8, 0x2E, 0x00, 0x0F, 0x42, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x3F,
-    0x02, 0xE0, 0x07, 0xE0, 0x2F, 0x01, 0xFD, 0x00, 0xFE, 0xF7, 0xC0, 0x07, 0xFD, 0x3C, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x50, 0x03, 0xE0, 0x07, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD,
-    0x00, 0xFE, 0x00, 0x18, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x15, 0x54, 0x3D, 0x00, 0x3F, 0xF4,
-    0x3C, 0x00, 0x2A, 0xF4, 0x3C, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x02, 0xE0,
-    0x2F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x03, 0xC0, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x05, 0x00, 0x7F, 0xF5, 0xE0, 0x2F, 0x96, 0xFD,
-    0x03, 0xD0, 0x0F, 0xC0, 0xBC, 0x00, 0xBC, 0x0F, 0x40, 0x0B, 0x81, 0xF0, 0x00, 0xF8, 0x2E, 0x00,
-    0x0F, 0x42, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x3F, 0x02, 0xE0, 0x07, 0xE0, 0x2F, 0x01, 0xFD, 0x00,
-    0xFE, 0xF7, 0xC0, 0x07, 0xFD, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F,
-    0x00, 0x50, 0x03, 0xE0, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFE, 0x00, 0x18, 0x02, 0xF4, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x15, 0x54, 0x3D, 0x00, 0x3F, 0xF4, 0x3C, 0x00, 0x2A, 0xF4, 0x3C, 0x00, 0x00, 0xF0,
-    0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x02, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x03, 0xC0,
-    0x07, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x07, 0xFF, 0x5E, 0x02, 0xF9, 0x6F, 0xD0,
-    0x3D, 0x00, 0xFC, 0x0B, 0xC0, 0x0B, 0xC0, 0xF4, 0x00, 0xB8, 0x1F, 0x00, 0x0F, 0x82, 0xE0, 0x00,
-    0xF4, 0x2E, 0x00, 0x1F, 0x03, 0xD0, 0x03, 0xF0, 0x2E, 0x00, 0x7E, 0x02, 0xF0, 0x1F, 0xD0, 0x0F,
-    0xEF, 0x7C, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0,
-    0x05, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0x4F, 0x00, 0x00, 0x0B, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x7C, 0x02, 0xE0, 0x00,
-    0x2E, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x3C, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0x0B, 0x80,
-    0x00, 0x7C, 0x02, 0xE5, 0x55, 0x6E, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x3E, 0xAA, 0xAB, 0xC0, 0x1F,
-    0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x2D, 0x00, 0xF0, 0x00, 0x0F, 0x40,
-    0x3C, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3D, 0x3C, 0x00, 0x0B,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x68, 0x00, 0x2D,
-    0x7F, 0xF4, 0x03, 0xEE, 0x5B, 0xC0, 0x3F, 0x40, 0x3C, 0x07, 0xE0, 0x03, 0xC0, 0xBC, 0x00, 0x7C,
-    0x0B, 0x80, 0x0B, 0x80, 0xF4, 0x00, 0xF4, 0x0F, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0xF0, 0x2E, 0x00,
-    0x1F, 0x03, 0xD0, 0x02, 0xE0, 0x3C, 0x00, 0x3D, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x1E, 0x00, 0x01, 0xF0, 0x02, 0xE0, 0x00, 0x2E, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x7C, 0x00, 0x07, 0xC0, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0xF9, 0x55, 0x5F, 0x80,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0xFA, 0xAA, 0xAF, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x02, 0xE0, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x07,
-    0xC0, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x1E,
-    0x05, 0x40, 0x02, 0xD3, 0xFF, 0x00, 0x3D, 0xF5, 0xFC, 0x03, 0xF8, 0x07, 0xC0, 0x7E, 0x00, 0x3C,
-    0x07, 0xC0, 0x07, 0xC0, 0xB8, 0x00, 0xB8, 0x0F, 0x40, 0x0F, 0x40, 0xF0, 0x00, 0xF0, 0x1F, 0x00,
-    0x0F, 0x02, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x2E, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3C, 0x00,
-    0x00, 0x04, 0x01, 0x00, 0x1F, 0xE0, 0xD0, 0x0F, 0xBF, 0xF0, 0x07, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xC0, 0x00, 0x06, 0xF9, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0x00, 0x10, 0xFE, 0x0E,
-    0x3D, 0xFF, 0xC3, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03,
-    0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00,
-    0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xC0, 0x00, 0x1B, 0xE4, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x87, 0xFF, 0xD0, 0x00,
-    0x00, 0x01, 0x40, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x02, 0xE0,
-    0x00, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x10, 0x05, 0x00, 0x74, 0x1D, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00,
-    0x1B, 0xE4, 0x00, 0x7F, 0xFC, 0x00, 0x08, 0x00, 0x40, 0xE0, 0x38, 0x0F, 0xFF, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07,
-    0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00,
-    0x03, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0xF0, 0x00, 0x07,
-    0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x00, 0x1B, 0xE4, 0x01, 0xFF, 0xF0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x1D, 0x00, 0x00,
-    0xB4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x02, 0xE0,
-    0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00,
-    0x38, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0xBF, 0x00, 0x15, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0F, 0x40,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x03, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xE0,
-    0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xC0, 0x00, 0x6F, 0x90, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x50, 0x2E, 0x03, 0xD0, 0x3C,
-    0x07, 0xC0, 0x78, 0x0B, 0x80, 0xF4, 0x0F, 0x01, 0xF0, 0x2E, 0x03, 0xD0, 0x3C, 0x03, 0xC0, 0x00,
-    0xBF, 0xF4, 0x0F, 0x00, 0x1F, 0xF8, 0x07, 0xC0, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0xF4,
-    0x00, 0x2E, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x01, 0xF0, 0x02,
-    0xE0, 0x00, 0x78, 0x00, 0xF4, 0x00, 0x2E, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x1F, 0x00, 0x03, 0xC0,
-    0x07, 0xC0, 0x01, 0xF0, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x1F, 0x00, 0x1B, 0xE4, 0x0B, 0x80, 0x1F, 0xFF, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x15, 0xBD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x00, 0x00, 0x10, 0x01, 0x40, 0x0B, 0x80, 0x7C, 0x00, 0xF8, 0x07, 0xC0, 0x01, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x02, 0xE0, 0x0F, 0x00, 0x3D, 0x01, 0xF0, 0x03, 0xC0, 0x2E,
-    0x00, 0x7C, 0x03, 0xD0, 0x07, 0x80, 0x3C, 0x00, 0xB8, 0x07, 0xC0, 0x0F, 0x40, 0x78, 0x00, 0xF0,
-    0x0B, 0x40, 0x1F, 0x00, 0xF4, 0x02, 0xE0, 0x0F, 0x00, 0x3D, 0x01, 0xF0, 0x03, 0xC0, 0x2E, 0x00,
-    0x3C, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x3D, 0x3C, 0x00, 0x0B, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x46, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3D, 0x3C, 0x00, 0x28, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0xD0, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xE0, 0x02, 0xF0, 0x02, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x2F, 0x00, 0x03, 0xC0, 0xBC, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x0B, 0x8B, 0xC0, 0x00,
-    0x0F, 0x6F, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x1F, 0x4B, 0x80, 0x00,
-    0x2E, 0x07, 0xC0, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0xF4, 0x00,
-    0x7C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x54, 0x02, 0xE0, 0x1F, 0x40, 0x3D, 0x07, 0xD0,
-    0x03, 0xC1, 0xF4, 0x00, 0x7C, 0x7D, 0x00, 0x0B, 0x9F, 0x40, 0x00, 0xBB, 0xE0, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0xF8, 0xF4, 0x00, 0x1F, 0x07, 0xC0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x02, 0xF0, 0x03,
-    0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x40,
-    0x2E, 0x01, 0xF4, 0x03, 0xD0, 0x7D, 0x00, 0x3C, 0x1F, 0x40, 0x07, 0xC7, 0xD0, 0x00, 0xB9, 0xF4,
-    0x00, 0x0B, 0xBE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0x8F, 0x40, 0x01, 0xF0, 0x7C, 0x00, 0x2E,
-    0x03, 0xD0, 0x03, 0xD0, 0x2F, 0x00, 0x3C, 0x00, 0xF4, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E,
-    0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00,
-    0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x3C,
-    0x00, 0x07, 0xC0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0xBC, 0x00, 0x07, 0xC0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00,
-    0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xD0, 0x00,
-    0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00,
-    0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D,
-    0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x02, 0xD0, 0x00, 0x38, 0x00, 0x0B, 0x00, 0x00, 0x80, 0x00, 0x00, 0x1F, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x01,
-    0xF0, 0x02, 0xE0, 0x02, 0xD0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x70, 0x00, 0x50, 0x00, 0x00,
-    0xF0, 0x0E, 0x01, 0xE0, 0x2D, 0x02, 0xE0, 0x38, 0x03, 0xD0, 0xB0, 0x03, 0xC0, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xC0, 0x00, 0x7C, 0x7C, 0x02, 0xE3, 0xD0, 0x0F, 0x5E, 0x00, 0x3C, 0xE0,
-    0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80,
-    0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02,
-    0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x04, 0x0F, 0x41,
-    0xF0, 0xF0, 0x2F, 0x1F, 0x00, 0x42, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07,
-    0xC0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xFC, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0,
-    0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC1, 0x01, 0xF2, 0xE0, 0xB8, 0xF8,
-    0x2D, 0x04, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00,
-    0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF5, 0xE0, 0x03, 0xFF, 0x40, 0x1F, 0xD0, 0x02, 0xFC, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xC0, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0,
-    0x02, 0xE0, 0x03, 0xD4, 0x03, 0xFC, 0x07, 0xF4, 0x2F, 0xC0, 0xBF, 0x40, 0x1F, 0x40, 0x0F, 0x00,
-    0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x78, 0x0B, 0xE0, 0x00, 0x2E, 0x02, 0xFC, 0x00, 0x0F,
-    0x40, 0xFF, 0x40, 0x03, 0xC0, 0x3D, 0xF0, 0x01, 0xF0, 0x1E, 0x3C, 0x00, 0x78, 0x0B, 0x8B, 0x80,
-    0x2D, 0x03, 0xD1, 0xF0, 0x0F, 0x40, 0xF0, 0x3D, 0x03, 0xC0, 0x3C, 0x0B, 0x81, 0xF0, 0x1E, 0x00,
-    0xF0, 0xB8, 0x0B, 0x40, 0x3D, 0x2D, 0x03, 0xD0, 0x07, 0x8F, 0x00, 0xF0, 0x00, 0xF3, 0xC0, 0x7C,
-    0x00, 0x2E, 0xF0, 0x1E, 0x00, 0x07, 0xF8, 0x0B, 0x40, 0x00, 0xFD, 0x03, 0xC0, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xA9, 0x00, 0x2D, 0x7F, 0xF4, 0x03, 0xEF, 0x5F, 0xC0,
-    0x3F, 0x80, 0x7C, 0x07, 0xE0, 0x07, 0xC0, 0xBC, 0x00, 0x7C, 0x0F, 0x80, 0x0B, 0x80, 0xF4, 0x00,
-    0xF8, 0x0F, 0x00, 0x0F, 0x41, 0xF0, 0x01, 0xF0, 0x2E, 0x00, 0x2F, 0x03, 0xD0, 0x02, 0xE0, 0x3D,
-    0x00, 0x3D, 0x07, 0xC0, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x07, 0x80, 0xBE, 0x00, 0x02, 0xE0, 0x2F,
-    0xC0, 0x00, 0xF4, 0x0F, 0xF4, 0x00, 0x3C, 0x03, 0xDF, 0x00, 0x1F, 0x01, 0xE3, 0xC0, 0x07, 0x80,
-    0xB8, 0xB8, 0x02, 0xD0, 0x3D, 0x1F, 0x00, 0xF4, 0x0F, 0x03, 0xD0, 0x3C, 0x03, 0xC0, 0xB8, 0x1F,
-    0x01, 0xE0, 0x0F, 0x0B, 0x80, 0xB4, 0x03, 0xD2, 0xD0, 0x3D, 0x00, 0x78, 0xF0, 0x0F, 0x00, 0x0F,
-    0x3C, 0x07, 0xC0, 0x02, 0xEF, 0x01, 0xE0, 0x00, 0x7F, 0x80, 0xB4, 0x00, 0x0F, 0xD0, 0x3C, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x40, 0xA9, 0x00,
-    0x2D, 0x7F, 0xF4, 0x03, 0xEF, 0x5F, 0xC0, 0x3F, 0x80, 0x7C, 0x07, 0xE0, 0x07, 0xC0, 0xBC, 0x00,
-    0x7C, 0x0F, 0x80, 0x0B, 0x80, 0xF4, 0x00, 0xF8, 0x0F, 0x00, 0x0F, 0x41, 0xF0, 0x01, 0xF0, 0x2E,
-    0x00, 0x2F, 0x03, 0xD0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x1F, 0x00, 0x00, 0x0B, 0x5F, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x78,
-    0x0B, 0xE0, 0x00, 0x2E, 0x02, 0xFC, 0x00, 0x0F, 0x40, 0xFF, 0x40, 0x03, 0xC0, 0x3D, 0xF0, 0x01,
-    0xF0, 0x1E, 0x3C, 0x00, 0x78, 0x0B, 0x8B, 0x80, 0x2D, 0x03, 0xD1, 0xF0, 0x0F, 0x40, 0xF0, 0x3D,
-    0x03, 0xC0, 0x3C, 0x0B, 0x81, 0xF0, 0x1E, 0x00, 0xF0, 0xB8, 0x0B, 0x40, 0x3D, 0x2D, 0x03, 0xD0,
-    0x07, 0x8F, 0x00, 0xF0, 0x00, 0xF3, 0xC0, 0x7C, 0x00, 0x2E, 0xF0, 0x1E, 0x00, 0x07, 0xF8, 0x0B,
-    0x40, 0x00, 0xFD, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2D, 0x00,
-    0x07, 0x8F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xA9,
-    0x00, 0x2D, 0x7F, 0xF4, 0x03, 0xEF, 0x5F, 0xC0, 0x3F, 0x80, 0x7C, 0x07, 0xE0, 0x07, 0xC0, 0xBC,
-    0x00, 0x7C, 0x0F, 0x80, 0x0B, 0x80, 0xF4, 0x00, 0xF8, 0x0F, 0x00, 0x0F, 0x41, 0xF0, 0x01, 0xF0,
-    0x2E, 0x00, 0x2F, 0x03, 0xD0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x07, 0xC0, 0x03, 0xC0, 0x0B, 0xC0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x50, 0x2A,
-    0x42, 0xC3, 0xD7, 0xFF, 0x44, 0x0F, 0xB9, 0x7F, 0x00, 0x3F, 0x40, 0x7C, 0x01, 0xF8, 0x01, 0xF0,
-    0x0B, 0xC0, 0x07, 0xC0, 0x3E, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0xF4, 0x07, 0xC0, 0x03, 0xD0, 0x1F,
-    0x00, 0x1F, 0x00, 0xB8, 0x00, 0xBC, 0x03, 0xD0, 0x03, 0xE0, 0x0F, 0x00, 0x0F, 0x40, 0x7C, 0x00,
-    0x3C, 0x00, 0x01, 0xF4, 0x00, 0x07, 0x80, 0xBE, 0x00, 0x02, 0xE0, 0x2F, 0xC0, 0x00, 0xF4, 0x0F,
-    0xF4, 0x00, 0x3C, 0x03, 0xDF, 0x00, 0x1F, 0x01, 0xE3, 0xC0, 0x07, 0x80, 0xB4, 0xB8, 0x02, 0xD0,
-    0x3D, 0x0F, 0x00, 0xF4, 0x0F, 0x03, 0xD0, 0x3C, 0x03, 0xC0, 0x78, 0x1F, 0x01, 0xE0, 0x0F, 0x0B,
-    0x80, 0xB4, 0x02, 0xD2, 0xD0, 0x3D, 0x00, 0x7C, 0xF0, 0x0F, 0x00, 0x0F, 0x7C, 0x07, 0xC0, 0x02,
-    0xFF, 0x01, 0xE0, 0x00, 0x3F, 0x80, 0xB4, 0x00, 0x0F, 0xD0, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0xA9, 0x00, 0x00, 0x00, 0x40, 0x69, 0x00, 0x2C, 0x7F, 0xF4, 0x03, 0xDE, 0x5B, 0xC0, 0x3F,
-    0x40, 0x3C, 0x07, 0xE0, 0x03, 0xC0, 0x7C, 0x00, 0x7C, 0x0B, 0x80, 0x0B, 0x80, 0xF4, 0x00, 0xF4,
-    0x0F, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0xF0, 0x2E, 0x00, 0x1F, 0x03, 0xD0, 0x02, 0xE0, 0x3C, 0x00,
-    0x3D, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x0F,
-    0x07, 0xC0, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00,
-    0x1F, 0x0F, 0x00, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x01, 0xF4, 0x3E, 0x00,
-    0x00, 0xFC, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x1F, 0xFB, 0xFD, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F,
-    0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8,
-    0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x14, 0x00, 0x00, 0x74, 0x1D, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00,
-    0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00,
-    0x00, 0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC,
-    0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0xB0, 0x2C, 0x00, 0x7F, 0xF8, 0x00, 0x1B, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E,
-    0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00,
-    0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xB8, 0x00, 0x00, 0x2E, 0x1F, 0x00, 0x00, 0x07,
-    0x83, 0x80, 0x00, 0x00, 0xD0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x3D,
-    0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x2F, 0x03, 0xC0, 0x00, 0x03,
-    0xE0, 0x3D, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xFC,
-    0x00, 0xBD, 0x00, 0x07, 0xFE, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x0F, 0x4B, 0x40, 0x02, 0xD1, 0xD0, 0x00,
-    0x70, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x0B, 0xE5, 0xBC,
-    0x01, 0xF4, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x03, 0xC0, 0x01, 0xF0, 0x7C, 0x00, 0x1F, 0x0B, 0x80,
-    0x02, 0xE0, 0xF4, 0x00, 0x3E, 0x0F, 0x40, 0x03, 0xC0, 0xB8, 0x00, 0xB8, 0x07, 0xC0, 0x1F, 0x00,
-    0x2F, 0xAF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x0F, 0x00,
-    0x00, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x02, 0xE0,
-    0x00, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x03, 0xD5, 0x54, 0x03, 0xD0, 0x00, 0x7F,
-    0xFF, 0xD0, 0x3D, 0x00, 0x0B, 0xEA, 0xA8, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x02,
-    0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x06, 0x90, 0x01, 0xFF,
-    0xF4, 0x3F, 0xFD, 0x0B, 0xE5, 0xBD, 0xF9, 0x2F, 0x1F, 0x40, 0x3F, 0xD0, 0x1F, 0x3E, 0x00, 0x1F,
-    0x80, 0x1F, 0x3C, 0x00, 0x1F, 0x00, 0x7D, 0x78, 0x00, 0x1F, 0xAF, 0xF4, 0xB8, 0x00, 0x2F, 0xFF,
-    0x80, 0xF4, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0xB8, 0x00, 0xBF, 0x00, 0x00,
-    0x7C, 0x01, 0xFF, 0x40, 0x10, 0x2F, 0xAF, 0xCB, 0xFA, 0xF4, 0x0B, 0xFE, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xF0,
-    0x02, 0xE0, 0x1F, 0xC0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3C, 0x0B, 0x80,
-    0x07, 0xC0, 0xF4, 0x00, 0xF8, 0x0F, 0x55, 0xBE, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xAB, 0xC0, 0x02,
-    0xE0, 0x3D, 0x00, 0x3D, 0x02, 0xE0, 0x03, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x07, 0xC0, 0x0B,
-    0xC0, 0xB8, 0x00, 0x3C, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xA4, 0x02, 0xC7, 0xF4,
-    0x03, 0xDE, 0x50, 0x03, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F,
-    0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xF0, 0x02, 0xE0, 0x1F, 0xC0, 0x3D,
-    0x00, 0x7C, 0x03, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3C, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xF8,
-    0x0F, 0x55, 0xBE, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xAB, 0xC0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x02,
-    0xE0, 0x03, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x07, 0xC0, 0x0B, 0xC0, 0xB8, 0x00, 0x3C, 0x0F,
-    0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x29, 0x00, 0xB1, 0xFD, 0x00, 0xF7,
-    0x94, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00,
-    0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x07, 0x9F, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xF0,
-    0x02, 0xE0, 0x1F, 0xC0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3C, 0x0B, 0x80,
-    0x07, 0xC0, 0xF4, 0x00, 0xF8, 0x0F, 0x55, 0xBE, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xAB, 0xC0, 0x02,
-    0xE0, 0x3D, 0x00, 0x3D, 0x02, 0xE0, 0x03, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x07, 0xC0, 0x0B,
-    0xC0, 0xB8, 0x00, 0x3C, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x07, 0x80, 0x03,
-    0xCB, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x40, 0x0B,
-    0x1F, 0xD0, 0x03, 0xDE, 0x50, 0x00, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4,
-    0x03, 0xFF, 0xFE, 0x02, 0xF4, 0x02, 0x40, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x14, 0x00, 0x7E,
-    0x0B, 0xFB, 0xFE, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0xFF,
-    0xFC, 0x0F, 0xD1, 0xA0, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x03,
-    0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC1, 0x00, 0x2F, 0x0F, 0xAB, 0xF4, 0x2F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x3C, 0x3C, 0x00, 0x38, 0x07, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x03, 0xFF, 0xFE, 0x02,
-    0xF4, 0x02, 0x40, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x14, 0x00, 0x7E, 0x0B, 0xFB, 0xFE, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xFD, 0x00,
-    0x3C, 0x3C, 0x03, 0x80, 0x34, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0xFF, 0xFC, 0x0F, 0xD1, 0xA0,
-    0x3C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF8,
-    0x00, 0x01, 0xF0, 0x00, 0x03, 0xC1, 0x00, 0x2F, 0x0F, 0xAB, 0xF4, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x0F, 0xFF, 0xF8, 0x0B, 0xD0, 0x09, 0x03, 0xD0,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x02, 0xF0, 0x50, 0x01, 0xF8, 0x2F, 0xEF, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x03,
-    0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0x80, 0x00, 0x16, 0xD0, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x0F, 0xFF, 0xC0, 0xFD, 0x1A, 0x03, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00,
-    0x3C, 0x10, 0x02, 0xF0, 0xFA, 0xBF, 0x42, 0xFF, 0xF4, 0x00, 0x38, 0x00, 0x01, 0xE0, 0x00, 0x02,
-    0xE0, 0x00, 0x03, 0xC0, 0x01, 0x6E, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x3C, 0x00, 0x0B, 0x5F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x40, 0x0F, 0xFF, 0xF8, 0x02, 0xF4, 0x02, 0x40, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xBC, 0x05, 0x00, 0x1F, 0x80, 0xBF, 0xBF, 0xE0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x79, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x03, 0xFF, 0xF0, 0x0F, 0xD1, 0xA0, 0x0F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x07, 0xC0, 0x00, 0x03, 0xC0, 0x40, 0x0B, 0xC0, 0xFA, 0xBF, 0x40, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x74, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x17, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x54, 0x2F,
-    0xFF, 0xC0, 0x7E, 0x50, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40,
-    0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x2E, 0x00, 0x01, 0xFA, 0x80, 0x0B, 0xF8, 0x00,
-    0x34, 0x00, 0x0B, 0x40, 0x00, 0x7D, 0x00, 0x01, 0xD0, 0x01, 0x7C, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x0B, 0x00, 0x07, 0x8F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x0B, 0x40, 0x04, 0x38, 0x00, 0x72, 0xC0, 0x03, 0xC0, 0x00, 0x2F, 0x54, 0x0B, 0xFF, 0xF0,
-    0x07, 0xE5, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00,
-    0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xFA, 0x80, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xF4, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x54, 0x2F, 0xFF, 0xC0, 0x7E, 0x50, 0x03, 0xC0,
-    0x00, 0x7C, 0x00, 0x2F, 0xE9, 0x07, 0xFF, 0xD0, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02,
-    0xE0, 0x00, 0x2E, 0x00, 0x01, 0xFA, 0x80, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04,
-    0x00, 0x00, 0xFF, 0x4B, 0x00, 0x00, 0xBA, 0xFF, 0x40, 0x00, 0x34, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x03, 0xC0,
-    0x00, 0x2D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x01, 0xF0, 0x0F,
-    0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x03, 0xC0,
-    0x3D, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x2F, 0x40, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x0F, 0xE0, 0xE0, 0x0F, 0x7F, 0xF0, 0x03, 0x41, 0xF4, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x0F, 0x07,
-    0xC0, 0x07, 0xC2, 0xE0, 0x01, 0xE0, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x1F, 0x07,
-    0x80, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4, 0x1F, 0xEF, 0x6C, 0x02, 0xFF, 0x4F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x02,
-    0xD0, 0x1F, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0xF0, 0x00,
-    0x0B, 0x80, 0x3C, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x3C, 0x03, 0xD0,
-    0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x02, 0xF0, 0x02,
-    0xF0, 0x02, 0xF4, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x05, 0x0F, 0x40,
-    0x0B, 0x83, 0xC0, 0x03, 0xD0, 0xF0, 0x00, 0xF0, 0x7C, 0x00, 0x7C, 0x2E, 0x00, 0x1E, 0x0F, 0x40,
-    0x0B, 0x83, 0xC0, 0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x78, 0x00, 0xFC, 0x2E, 0x00, 0x7E, 0x0B, 0xC0,
-    0x7F, 0x41, 0xFE, 0xF6, 0xC0, 0x2F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0xE0, 0x2C, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x03, 0xC0,
-    0x00, 0x2D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x01, 0xF0, 0x0F,
-    0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x03, 0xC0,
-    0x3D, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x2F, 0x40, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x0E, 0x03, 0x80, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x0F, 0x07,
-    0xC0, 0x07, 0xC2, 0xE0, 0x01, 0xE0, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x1F, 0x07,
-    0x80, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4, 0x1F, 0xEF, 0x6C, 0x02, 0xFF, 0x4F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1C, 0x1C, 0x00,
-    0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0xE7, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x3C, 0x00,
-    0x02, 0xD0, 0x1F, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0xF0,
-    0x00, 0x0B, 0x80, 0x3C, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x3C, 0x03,
-    0xD0, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x02, 0xF0,
-    0x02, 0xF0, 0x02, 0xF4, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xC2, 0xC0, 0x00, 0xB0, 0x70, 0x00,
-    0x0E, 0x78, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x05, 0x0F, 0x40, 0x0B, 0x83,
-    0xC0, 0x03, 0xD0, 0xF0, 0x00, 0xF0, 0x7C, 0x00, 0x7C, 0x2E, 0x00, 0x1E, 0x0F, 0x40, 0x0B, 0x83,
-    0xC0, 0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x78, 0x00, 0xFC, 0x2E, 0x00, 0x7E, 0x0B, 0xC0, 0x7F, 0x41,
-    0xFE, 0xF6, 0xC0, 0x2F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC3, 0xC0, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x02, 0x81, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E,
-    0x00, 0xF0, 0x00, 0x0B, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00,
-    0x7C, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xC0, 0x2E, 0x00,
-    0x00, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x3D,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x87, 0xC0, 0x00, 0x7C, 0x3C,
-    0x00, 0x03, 0xC3, 0xC0, 0x00, 0x28, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x03,
-    0xD0, 0x02, 0xE0, 0x0F, 0x00, 0x0F, 0x40, 0x3C, 0x00, 0x3C, 0x01, 0xF0, 0x01, 0xF0, 0x0B, 0x80,
-    0x07, 0x80, 0x3D, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0xF4, 0x07, 0xC0, 0x07, 0xC0, 0x1E, 0x00, 0x3F,
-    0x00, 0xB8, 0x01, 0xF8, 0x02, 0xF0, 0x1F, 0xD0, 0x07, 0xFB, 0xDB, 0x00, 0x0B, 0xFD, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x02,
-    0xE0, 0x0F, 0x00, 0x00, 0xB4, 0x07, 0xC0, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0xF4, 0x00,
-    0x07, 0xC0, 0x3C, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x3C, 0x02, 0xE0,
-    0x00, 0x0F, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x03,
-    0xD0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43, 0xD0, 0x02,
-    0xE0, 0xF0, 0x00, 0xF4, 0x3C, 0x00, 0x3C, 0x1F, 0x00, 0x1F, 0x0B, 0x80, 0x07, 0x83, 0xD0, 0x02,
-    0xE0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x7C, 0x1E, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0, 0x1F,
-    0xD0, 0x7F, 0xBD, 0xB0, 0x0B, 0xFD, 0x3C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x8B, 0x40,
-    0x00, 0x00, 0x01, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0F, 0x00,
-    0x03, 0xD7, 0xC0, 0x02, 0xF4, 0x00, 0x7C, 0x3C, 0x00, 0x3F, 0x40, 0x0F, 0x83, 0xC0, 0x0B, 0xF4,
-    0x00, 0xF0, 0x3C, 0x00, 0xF7, 0x40, 0x2E, 0x03, 0xC0, 0x2D, 0x78, 0x03, 0xC0, 0x3C, 0x03, 0xC7,
-    0x80, 0xB8, 0x03, 0xC0, 0x78, 0x78, 0x0F, 0x00, 0x3C, 0x0F, 0x07, 0x81, 0xF0, 0x03, 0xC1, 0xE0,
-    0x38, 0x3D, 0x00, 0x3C, 0x3C, 0x03, 0x87, 0xC0, 0x03, 0xC7, 0x80, 0x3C, 0xB4, 0x00, 0x3C, 0xB4,
-    0x03, 0xCF, 0x00, 0x03, 0xDF, 0x00, 0x3D, 0xE0, 0x00, 0x2E, 0xD0, 0x03, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x3F, 0x80, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xE1,
-    0xE0, 0x00, 0x00, 0x1D, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05,
-    0x2E, 0x00, 0xBD, 0x00, 0xB8, 0xB8, 0x03, 0xF4, 0x03, 0xC1, 0xE0, 0x1E, 0xD0, 0x2E, 0x07, 0x80,
-    0xF7, 0x80, 0xF0, 0x1E, 0x07, 0x8E, 0x07, 0xC0, 0x78, 0x3C, 0x38, 0x3D, 0x01, 0xF1, 0xE0, 0xE1,
-    0xF0, 0x07, 0xCB, 0x03, 0x8F, 0x40, 0x0F, 0x38, 0x0F, 0x3C, 0x00, 0x3E, 0xC0, 0x3E, 0xD0, 0x00,
-    0xFE, 0x00, 0xFF, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0x4F, 0x00, 0x02, 0xC0, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0x87, 0xC0, 0x01, 0xF0, 0x3C, 0x00, 0x3D, 0x03, 0xD0, 0x0B,
-    0x80, 0x2E, 0x01, 0xF0, 0x01, 0xF0, 0x3D, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0xF5, 0xF0, 0x00, 0x0B,
-    0xBD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03,
-    0xD3, 0xC0, 0x00, 0x0B, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0xB8,
-    0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C,
-    0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x1D,
-    0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07,
-    0x80, 0x00, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x7C,
-    0x00, 0x1F, 0x03, 0xC0, 0x03, 0xD0, 0x3D, 0x00, 0xB8, 0x02, 0xE0, 0x1F, 0x00, 0x1F, 0x03, 0xD0,
-    0x00, 0xF0, 0xB8, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x50, 0x07, 0xFF, 0xFC, 0x00, 0x55, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07,
-    0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFA, 0xAA, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0xFF, 0xFF, 0x00, 0x55, 0x7D,
-    0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00,
-    0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xAA, 0xA0, 0x7F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x78, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x02, 0xD0, 0x00, 0xF2, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x50, 0x07, 0xFF, 0xFC, 0x00, 0x55, 0x7D, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F,
-    0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFA, 0xAA, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFB, 0x40, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x03, 0xD0, 0x3C, 0x07, 0x40, 0x00, 0x00, 0x3D, 0x0F, 0x42,
-    0xD0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xD0, 0x3D, 0x3C, 0x28, 0x03, 0x40, 0x01,
-    0x00, 0x11, 0xFE, 0x0D, 0x3D, 0xFF, 0xC3, 0x01, 0xE0, 0x7F, 0xFD, 0xBF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xE2, 0xAA, 0xAA, 0x40, 0x20, 0x01, 0x38, 0x0E, 0x3F, 0xFC, 0x0B, 0xE0, 0x04, 0x3D,
-    0x3D, 0x04, 0x00, 0x00, 0x3C, 0x2E, 0x3C, 0x2D, 0x00, 0x00, 0x15, 0x03, 0xFC, 0x02, 0xC0, 0x7C,
-    0x3E, 0x03, 0x80, 0x10, 0x00, 0x01, 0x00, 0xBF, 0x83, 0x47, 0x1C, 0x0C, 0x39, 0xF0, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x3D, 0x0F, 0x4B, 0x82, 0xD1, 0xD0, 0x70, 0x34, 0x00, 0x00, 0x00, 0x0F,
-    0x02, 0xC1, 0xE3, 0xC0, 0x2F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0x1E, 0x2D, 0x3C, 0x3C, 0x3C, 0x24,
-    0x1E, 0x1E, 0x1D, 0x2D, 0x2D, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xE0, 0x1E,
-    0x0F, 0x00, 0xB0, 0x74, 0x03, 0x82, 0xC0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x2F, 0x00, 0x86, 0x04,
-    0x38, 0x0F, 0x0B, 0xFF, 0x00, 0xBE, 0x00, 0x01, 0x50, 0x1F, 0xFC, 0x39, 0x6D, 0x60, 0x0D, 0x02,
-    0xC0, 0x78, 0x0F, 0x01, 0xF0, 0x3D, 0x07, 0xC0, 0x10, 0x00, 0x07, 0xC0, 0xB8, 0x0F, 0x02, 0xE0,
-    0x3C, 0x07, 0x40, 0x10, 0x00, 0x78, 0x7C, 0x7C, 0x3C, 0x3C, 0x2C, 0x04, 0x07, 0xC0, 0xB8, 0x0F,
-    0x02, 0xE0, 0x3C, 0x07, 0x40, 0x10, 0x00, 0x00, 0x1F, 0x02, 0xD0, 0x3C, 0x03, 0x40, 0x00, 0x00,
-    0x7D, 0x0F, 0x42, 0xD0, 0x74, 0x00, 0x00, 0x40, 0x0E, 0x2A, 0xD3, 0xFC, 0x02, 0xC0, 0x14, 0x04,
-    0x03, 0xC0, 0x3E, 0x93, 0xFC, 0x74, 0x05, 0x00, 0x7F, 0xFE, 0x2A, 0xAD, 0x00, 0x2C, 0x00, 0x2C,
-    0x00, 0x38, 0x00, 0x34, 0x00, 0x70, 0x03, 0xD0, 0x7C, 0x0F, 0x47, 0xE0, 0xF4, 0x00, 0x00, 0x06,
-    0x07, 0x83, 0x80, 0xD0, 0x2C, 0x02, 0x00, 0x07, 0x00, 0xB0, 0x1F, 0x4F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF1, 0xBE, 0x80, 0xF0, 0x03, 0x80, 0x00, 0x00, 0x01, 0x00, 0x74, 0x2F, 0x9B, 0xFE, 0x0E, 0x00,
-    0x90, 0x15, 0x4F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x3C, 0x03, 0xC0, 0xB8, 0xFF,
-    0x0B, 0xD0, 0x00, 0x0B, 0x43, 0xD0, 0xF0, 0x3C, 0x1F, 0x03, 0xFC, 0x7E, 0x14, 0x7C, 0x7C, 0x10,
-    0x00, 0x00, 0x3C, 0x2D, 0x7C, 0x3D, 0x00, 0x00, 0x05, 0x03, 0xFC, 0xB0, 0xEA, 0x0A, 0x7A, 0xD1,
-    0xF4, 0x01, 0x42, 0xD0, 0xE0, 0xB0, 0x20, 0x00, 0x03, 0x40, 0x74, 0x02, 0xD0, 0x1E, 0x17, 0xD3,
-    0xF4, 0x0B, 0x0F, 0x07, 0x42, 0xD0, 0x7F, 0x01, 0x40, 0x0F, 0x1E, 0x2D, 0x3C, 0x3C, 0x78, 0x64,
-    0x3F, 0xFF, 0xE3, 0xEA, 0xAE, 0x70, 0x00, 0xDB, 0x00, 0x1C, 0x50, 0x01, 0x40, 0x10, 0x10, 0x11,
-    0xC2, 0xC2, 0xC3, 0xFF, 0xFD, 0x01, 0x41, 0x40, 0x00, 0x00, 0x0E, 0x03, 0xC1, 0xE7, 0xC0, 0x3F,
-    0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xF4, 0x3D, 0x3C, 0xA0, 0x0E, 0x20, 0x01,
-    0x0E, 0x03, 0x83, 0xFF, 0xC0, 0x2F, 0x80, 0x01, 0x50, 0x1F, 0xFC, 0x3D, 0x6E, 0x70, 0x0A, 0x01,
-    0x00, 0x41, 0xFE, 0x1D, 0x3A, 0xFF, 0xC7, 0x02, 0xE0, 0x7F, 0xFD, 0x7F, 0xFC, 0x3F, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFC, 0x05, 0x55, 0x54, 0x2F, 0xFF, 0xFD, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF8, 0x2A, 0xAA, 0xA4, 0x01, 0x00, 0x41, 0xFE, 0x1D, 0x3A, 0xFF, 0xC7, 0x02, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xAA, 0xAA, 0xA0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x08, 0x00, 0xBD, 0x07, 0xF4, 0x3F, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x18, 0x1E, 0x0B, 0x0E, 0x7C, 0x10, 0x34, 0x00, 0xA3, 0x40,
-    0x0E, 0x74, 0x00, 0xDB, 0xFF, 0xFC, 0x55, 0x55, 0x40, 0x05, 0x55, 0x43, 0xFF, 0xFE, 0x34, 0x00,
-    0xD7, 0x00, 0x1C, 0xBA, 0xAB, 0xCA, 0xAA, 0xA8, 0x01, 0x41, 0x42, 0xFF, 0xFE, 0x70, 0xB0, 0xB5,
-    0x01, 0x01, 0x00, 0x00, 0xB2, 0xC1, 0xFD, 0x03, 0xE0, 0x7A, 0xD0, 0x41, 0x00, 0x00, 0x90, 0x7D,
-    0x0F, 0x00, 0xF0, 0x07, 0x80, 0x38, 0x2F, 0x02, 0x40, 0x05, 0x55, 0x54, 0x1F, 0xFF, 0xFE, 0x05,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA4, 0x00, 0x03, 0xE0, 0x0F, 0x00,
-    0x74, 0x02, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x07, 0xC0, 0x38, 0x00, 0x05, 0x00, 0x42, 0xFD,
-    0x1C, 0x7A, 0xFF, 0x8A, 0x02, 0xE0, 0x14, 0x0F, 0xC0, 0xB4, 0x2C, 0x0C, 0x00, 0x00, 0x15, 0x00,
-    0x03, 0xD0, 0x3D, 0xB9, 0xE3, 0xCF, 0x2D, 0x01, 0xC0, 0x00, 0x78, 0xB4, 0xBD, 0x7D, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x2D, 0x55, 0x6D, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x1F, 0xFF, 0xFE, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A,
-    0xAA, 0xA4, 0x2D, 0x2D, 0x2D, 0x3C, 0x3C, 0x3C, 0x3C, 0x78, 0x00, 0x00, 0x6A, 0x7F, 0xF0, 0x38,
-    0x1D, 0x07, 0x00, 0x00, 0x00, 0x00, 0x12, 0xC1, 0x0F, 0xF4, 0xE3, 0xDF, 0xFC, 0x31, 0xDE, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x03, 0xC0, 0x00, 0x40, 0x04, 0x0F, 0xF4, 0xB0,
-    0xBA, 0xFF, 0x43, 0x41, 0xB4, 0x00, 0x38, 0x00, 0x01, 0xF0, 0x00, 0x02, 0x40, 0x00, 0x00, 0x40,
-    0x10, 0x2F, 0xE2, 0xC0, 0xD6, 0xFD, 0x01, 0x00, 0x40, 0x0B, 0x80, 0x90, 0xBB, 0xFF, 0x03, 0x42,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0x1F, 0xAF, 0x83, 0xFF, 0xFC, 0x0A, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x87, 0xF4, 0xB0, 0x3C, 0x0E, 0x00, 0xFF, 0x03, 0xFC, 0x0F, 0xFE, 0x90, 0x1A,
-    0x40, 0x6B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x5A, 0x50, 0x07, 0x00, 0x15, 0x05, 0x40, 0x00,
-    0x06, 0x00, 0x09, 0x00, 0x01, 0x40, 0x00, 0x14, 0x0D, 0x14, 0x00, 0x01, 0x47, 0xD2, 0x00, 0x00,
-    0x08, 0x7D, 0x20, 0x00, 0x00, 0x87, 0xD0, 0x00, 0x00, 0x04, 0x70, 0x28, 0x00, 0x01, 0x80, 0x00,
-    0x50, 0x00, 0x50, 0x00, 0x05, 0x40, 0x15, 0x00, 0xD0, 0x09, 0xA6, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x07, 0xE5, 0x01, 0x54, 0x05, 0xBF, 0xF0, 0x3F, 0xC0, 0xFF, 0x80, 0x2E, 0x41, 0xF1, 0xFC, 0xE0,
-    0x00, 0x00, 0x09, 0x3C, 0xB0, 0xE0, 0x74, 0x14, 0x00, 0x00, 0x0B, 0xF8, 0x2F, 0xBD, 0x34, 0x0B,
-    0x12, 0xC0, 0x03, 0xD0, 0x02, 0x80, 0x00, 0x1C, 0xD7, 0xF4, 0xFC, 0xBB, 0x84, 0x40, 0x02, 0x5F,
-    0xCB, 0x81, 0xBC, 0x02, 0x40, 0x34, 0x0B, 0xE0, 0x7C, 0xBE, 0x34, 0x00, 0xD0, 0x0A, 0x07, 0xE0,
-    0xF4, 0x0F, 0x5F, 0x87, 0xE3, 0x9C, 0xD0, 0x70, 0xD0, 0x08, 0x0E, 0x07, 0x0B, 0x3D, 0x10, 0x04,
-    0x3D, 0x3D, 0x04, 0x00, 0x00, 0xB0, 0x3B, 0xD2, 0xF9, 0x2F, 0xC1, 0x98, 0x00, 0x01, 0x03, 0xFE,
-    0xFD, 0x70, 0xF0, 0xBA, 0x0B, 0x07, 0x75, 0xF5, 0xE2, 0xF9, 0xF8, 0x20, 0x1C, 0x0B, 0xF9, 0x5D,
-    0x03, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0x00, 0x1F, 0x40, 0xFD, 0x00, 0x07,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0xB4, 0x00, 0x00, 0x01, 0xE3,
-    0xC0, 0x00, 0x00, 0xBC, 0x1F, 0x90, 0x01, 0xBE, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x1A, 0xA9,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFC,
-    0x00, 0x54, 0x00, 0x00, 0x10, 0x7F, 0xFF, 0x90, 0x02, 0xC3, 0xD5, 0x6F, 0xFF, 0xFD, 0x28, 0x00,
-    0x01, 0xAF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xE5, 0x5B,
-    0xF4, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0xAA, 0xAA, 0xAA, 0xBE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x94, 0xA0,
-    0xC3, 0x03, 0x0C, 0x28, 0x31, 0xD0, 0x65, 0x00, 0x1F, 0x8C, 0x3A, 0xB7, 0x40, 0xA1, 0x06, 0x40,
-    0x0C, 0x00, 0x14, 0x24, 0x30, 0x30, 0x60, 0x40, 0x0B, 0xD0, 0x90, 0xC3, 0x03, 0x0C, 0x0C, 0x34,
-    0xD0, 0x28, 0x00, 0x18, 0x24, 0x90, 0xC3, 0x03, 0x0C, 0x28, 0x31, 0xD0, 0x61, 0x00, 0x0A, 0x83,
-    0x00, 0x60, 0x09, 0x00, 0x70, 0x01, 0x90, 0x00, 0x00, 0x00, 0x30, 0x01, 0x82, 0xE9, 0x28, 0x30,
-    0xC0, 0xC3, 0x0A, 0x0C, 0x74, 0x18, 0x40, 0x00, 0x00, 0x30, 0x00, 0xC0, 0x06, 0xB8, 0x2C, 0x30,
-    0xD0, 0xC3, 0x06, 0x08, 0x24, 0x10, 0x40, 0x09, 0xB2, 0xD0, 0xC3, 0x86, 0x18, 0x30, 0x62, 0x43,
-    0x09, 0x30, 0x60, 0xC1, 0x04, 0x04, 0x1A, 0x82, 0xC0, 0x34, 0x03, 0x00, 0x20, 0x01, 0x00, 0x00,
-    0x14, 0x79, 0x30, 0x60, 0x90, 0xD0, 0x24, 0x50, 0x96, 0x1C, 0x63, 0x02, 0x60, 0x3C, 0x01, 0x40,
-    0x08, 0x20, 0x27, 0x00, 0x74, 0x02, 0xD0, 0x24, 0xC0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x55, 0x40, 0x03, 0xFF, 0xFD, 0x00,
-    0x7E, 0xAA, 0x80, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x01, 0x41, 0x40, 0x00, 0x3C, 0x3C, 0x00, 0x07, 0x87, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xE5, 0x54, 0x00, 0x3F, 0xFF, 0xD0,
-    0x07, 0xEA, 0xA8, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0xBE, 0x40, 0x03, 0xFF, 0xFF, 0x00,
-    0x3D, 0x01, 0xF8, 0x07, 0xC0, 0x07, 0xC0, 0xB8, 0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF0, 0x00,
-    0x3C, 0x0F, 0x00, 0x0B, 0xC1, 0xF0, 0x01, 0xF4, 0x2E, 0x0E, 0xFE, 0x03, 0xD0, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFC, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0x40, 0x3F, 0x40, 0x08, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80,
-    0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0xFB, 0xF4, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x0F, 0xFF, 0xF8, 0x0B, 0xD0, 0x08, 0x03,
-    0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x50, 0x01, 0xF8, 0x2F, 0xEF, 0xF8, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x02, 0xE0, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x2E, 0x00,
-    0xF4, 0x03, 0xC0, 0x1F, 0x00, 0xB8, 0x03, 0xD0, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x3D,
-    0x00, 0xF0, 0x00, 0x00, 0x51, 0x40, 0x0F, 0x3C, 0x00, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x2E,
-    0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00,
-    0x0F, 0x00, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00,
-    0x02, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B,
-    0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x46, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0xAA,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xD0, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00,
-    0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x2D, 0x00, 0x3D, 0x02, 0xF4, 0x00, 0x3C,
-    0x00, 0x3C, 0x00, 0xB8, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x7C,
-    0x00, 0xF4, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0xF4, 0x03, 0xE0, 0x00, 0xF0,
-    0x07, 0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00, 0x00,
-    0xF4, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x00,
-    0x2E, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0xAA, 0xAF, 0xEA, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7D, 0x55, 0x5F, 0x56, 0xFC, 0x0B, 0x80, 0x00, 0xF0, 0x03,
-    0xE0, 0xF4, 0x00, 0x1F, 0x00, 0x2E, 0x0F, 0x00, 0x02, 0xE0, 0x02, 0xE0, 0xF0, 0x00, 0x3D, 0x00,
-    0x3D, 0x1F, 0x00, 0x03, 0xC0, 0x07, 0xC2, 0xE0, 0x00, 0x7C, 0x02, 0xF8, 0x3D, 0x00, 0x07, 0xFF,
-    0xFE, 0x03, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xB8,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x2F, 0xBF, 0x80, 0x03, 0xFF, 0xFF, 0x40, 0x3D, 0x01, 0xFC, 0x07, 0xC0, 0x03, 0xC0, 0xB8, 0x00,
-    0x3C, 0x0F, 0x40, 0x03, 0xC0, 0xF0, 0x00, 0x7C, 0x0F, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0xB4, 0x2E,
-    0x00, 0x0F, 0x43, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x02, 0xE0, 0x02, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x3C, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x02, 0xD0, 0xF8, 0x00, 0x00, 0xF9, 0xF8,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xAF, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x03, 0xD0,
-    0xBC, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x0B,
-    0x80, 0x0F, 0x40, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x0B, 0x80, 0x01, 0xFC,
-    0x00, 0xF4, 0x00, 0x3F, 0xC0, 0x0F, 0x00, 0x0F, 0xF8, 0x01, 0xF0, 0x02, 0xEB, 0x40, 0x2E, 0x00,
-    0x7C, 0xF0, 0x02, 0xE0, 0x0F, 0x0F, 0x00, 0x3D, 0x03, 0xD1, 0xE0, 0x03, 0xC0, 0xB8, 0x2E, 0x00,
-    0x7C, 0x1F, 0x03, 0xD0, 0x0B, 0x83, 0xC0, 0x3C, 0x00, 0xF4, 0xF4, 0x07, 0xC0, 0x0F, 0x2E, 0x00,
-    0xB8, 0x00, 0xF7, 0xC0, 0x0F, 0x40, 0x1F, 0xF0, 0x00, 0xF0, 0x02, 0xFD, 0x00, 0x0F, 0x00, 0x3F,
-    0x40, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0x03, 0xE1, 0xF4,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x0B, 0x80, 0x3C, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x03, 0xE0, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x7C,
-    0x00, 0xF4, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0xB8, 0x2E, 0x00, 0x00,
-    0x1F, 0x0F, 0x00, 0x00, 0x03, 0xCB, 0x40, 0x00, 0x00, 0xB7, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x0B, 0x40, 0x2E, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x7C, 0x01,
-    0xF0, 0x00, 0x1E, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x2E, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0xF0,
-    0x03, 0xC0, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x03,
-    0xD0, 0x0F, 0x40, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x00, 0xF3, 0xC0, 0x00,
-    0x0B, 0x8F, 0x40, 0x00, 0x3C, 0x2D, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0xF8,
-    0x07, 0xC0, 0x07, 0xEA, 0xAF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xF5, 0x55, 0xF0, 0x0F, 0x40, 0x03,
-    0xD0, 0xBC, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x01, 0xF0,
-    0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xFF, 0xA4, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x1F, 0x01, 0xFC, 0x00, 0xB8, 0x00, 0xF4, 0x03, 0xD0, 0x03, 0xE0, 0x0F, 0x00, 0x0F,
-    0x40, 0x3C, 0x00, 0x3D, 0x01, 0xF0, 0x02, 0xF0, 0x0B, 0x80, 0x2F, 0x40, 0x3F, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0x40, 0x7F, 0x00,
-    0x3C, 0x00, 0x7D, 0x01, 0xF0, 0x00, 0xF4, 0x0B, 0x80, 0x03, 0xC0, 0x2D, 0x00, 0x2E, 0x00, 0xF5,
-    0x57, 0xF0, 0x03, 0xFF, 0xF9, 0x00, 0x1F, 0xAA, 0xF4, 0x00, 0xB8, 0x00, 0xF4, 0x03, 0xD0, 0x01,
-    0xF0, 0x0F, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0xF8, 0x0B, 0x80, 0x0F, 0xC0,
-    0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFC, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x01, 0xF0, 0x02, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00,
-    0x3C, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x02,
-    0xE0, 0x00, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x1F,
-    0x00, 0x00, 0x0F, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x03, 0xD0,
-    0x3D, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFD, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x3E, 0x55, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x7E, 0xAA, 0x80, 0x0B, 0x80,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x2E,
-    0x00, 0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0x1F, 0x40, 0x00, 0x0F, 0x00,
-    0xF0, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0x7C, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x2E, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0x4F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF7, 0xDB, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x2E, 0x3D, 0x00, 0x00, 0x00,
-    0x3F, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x2F, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x1F, 0x01, 0xF0, 0x2E,
-    0x00, 0x00, 0x1F, 0x40, 0xB8, 0x03, 0xC0, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x00, 0x0F, 0x80,
-    0x0F, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x80, 0x04, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x6F, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x6A,
-    0xF8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x02, 0xF0, 0x10, 0x00, 0xBE, 0x03, 0xFE, 0xFF, 0x80, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x0B, 0x80, 0x01, 0xFC, 0x00, 0xF4, 0x00, 0x3F, 0xC0, 0x0F,
-    0x00, 0x0F, 0xF8, 0x01, 0xF0, 0x02, 0xEB, 0x40, 0x2E, 0x00, 0x7C, 0xF0, 0x02, 0xE0, 0x0F, 0x0F,
-    0x00, 0x3D, 0x03, 0xD1, 0xE0, 0x03, 0xC0, 0xB8, 0x2E, 0x00, 0x7C, 0x1F, 0x03, 0xD0, 0x0B, 0x83,
-    0xC0, 0x3C, 0x00, 0xF4, 0xF4, 0x07, 0xC0, 0x0F, 0x2E, 0x00, 0xB8, 0x00, 0xF7, 0xC0, 0x0F, 0x40,
-    0x1F, 0xF0, 0x00, 0xF0, 0x02, 0xFD, 0x00, 0x0F, 0x00, 0x3F, 0x40, 0x01, 0xF0, 0x03, 0xE0, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0x1F, 0xC0, 0x0F, 0x40, 0x03, 0xFC, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0x1F, 0x00, 0x2E, 0xB4, 0x02,
-    0xE0, 0x07, 0xCF, 0x00, 0x2E, 0x00, 0xF0, 0xF0, 0x03, 0xD0, 0x3D, 0x1E, 0x00, 0x3C, 0x0B, 0x82,
-    0xE0, 0x07, 0xC1, 0xF0, 0x3D, 0x00, 0xB8, 0x3C, 0x03, 0xC0, 0x0F, 0x4F, 0x40, 0x7C, 0x00, 0xF2,
-    0xE0, 0x0B, 0x80, 0x0F, 0x7C, 0x00, 0xF4, 0x01, 0xFF, 0x00, 0x0F, 0x00, 0x2F, 0xD0, 0x00, 0xF0,
-    0x03, 0xF4, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x2E, 0x00, 0x2E,
-    0x00, 0x2F, 0x00, 0x0F, 0x40, 0x1F, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00,
-    0xB8, 0x0F, 0x40, 0x00, 0x2D, 0x0F, 0x80, 0x00, 0x0F, 0x9F, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x01, 0xFA, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x0F, 0x00, 0xF0,
-    0x00, 0x03, 0xC0, 0x2E, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x3D, 0x00,
-    0x1F, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x02, 0xD0, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0xB8,
-    0x00, 0x7C, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x0F, 0x00,
-    0x02, 0xD0, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0x78, 0x00,
-    0x3D, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x0B, 0x80, 0xFF,
-    0xC0, 0x00, 0xF4, 0x0F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x0B, 0xF8, 0x03, 0xEC, 0x00,
-    0x07, 0xFD, 0x01, 0xEB, 0x40, 0x03, 0xDF, 0x00, 0xB9, 0xD0, 0x01, 0xE7, 0xC0, 0x2D, 0x78, 0x00,
-    0xF2, 0xE0, 0x0F, 0x1E, 0x00, 0x78, 0xB4, 0x03, 0xC3, 0xC0, 0x3C, 0x3D, 0x01, 0xF0, 0xF0, 0x2D,
-    0x0F, 0x00, 0xB8, 0x3C, 0x0F, 0x07, 0xC0, 0x3D, 0x0F, 0x0B, 0x42, 0xE0, 0x0F, 0x02, 0xC3, 0xC0,
-    0xF4, 0x03, 0xC0, 0xB6, 0xD0, 0x3C, 0x01, 0xE0, 0x1F, 0xE0, 0x0F, 0x00, 0xB4, 0x07, 0xF0, 0x07,
-    0xC0, 0x3D, 0x00, 0xF8, 0x02, 0xE0, 0x0F, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x00, 0x78, 0x00, 0x07,
-    0x80, 0x2E, 0x00, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0xB4, 0x03, 0xC0, 0x00, 0x3D, 0x01, 0xF0, 0x00,
-    0x0F, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x02, 0xE0, 0x0F, 0x95, 0x55, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFA, 0xAA, 0xBF, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x02, 0xE0, 0x0F,
-    0x00, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80,
-    0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x01, 0xF8, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x7C, 0x0B, 0xC0, 0x00,
-    0x3D, 0x0F, 0x40, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0x2E, 0x3E, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00,
-    0x2E, 0x7C, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00,
-    0xF8, 0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x1F, 0xC0, 0x0B, 0xFE, 0xFF,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x0F, 0x40, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8,
-    0x00, 0x0B, 0x80, 0x2E, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x7C, 0x01,
-    0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0xF0,
-    0x03, 0xC0, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x03,
-    0xD0, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0x41,
-    0xBD, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xF0, 0x01, 0xF0, 0x0B, 0x80, 0x0B, 0xC0, 0x2E, 0x00, 0x2E,
-    0x00, 0xF4, 0x00, 0xF4, 0x03, 0xC0, 0x1F, 0x80, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x40, 0x03,
-    0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0x40, 0x08, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0xFB, 0xF4, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE0, 0x03, 0xE0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x07,
-    0xC0, 0x01, 0xF0, 0x03, 0xD0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x02, 0xE0,
-    0xB8, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x0F, 0x2D, 0x00, 0x00, 0x02, 0xDF, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x01, 0xBF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0xF4, 0x7F, 0x00, 0xF8, 0x03,
-    0xC0, 0x3E, 0x0B, 0xC0, 0x1F, 0x00, 0x7C, 0x3D, 0x00, 0x7C, 0x00, 0xF0, 0xF0, 0x02, 0xE0, 0x07,
-    0xC7, 0xC0, 0x0F, 0x40, 0x1F, 0x1F, 0x00, 0x3C, 0x00, 0xB8, 0x3C, 0x01, 0xF0, 0x03, 0xC0, 0xF8,
-    0x0B, 0x80, 0x3E, 0x01, 0xFD, 0x3D, 0x1B, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xFE,
-    0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0xF0,
-    0x0F, 0x80, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x01, 0xF2, 0xE0, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x02,
-    0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x2E,
-    0x00, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x2E, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0xF0, 0x03, 0xC0,
-    0x00, 0x7C, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x2E, 0x00, 0x03, 0xD0, 0x0F,
-    0x40, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0xB8, 0x00, 0x0B, 0x40,
-    0x3D, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x2E,
-    0x00, 0xB8, 0x00, 0x0F, 0x40, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x0F,
-    0x00, 0x02, 0xD0, 0xF0, 0x00, 0x3D, 0x1F, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x7C, 0x3D, 0x00, 0x07,
-    0xC3, 0xC0, 0x00, 0xB8, 0x3C, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0xF0, 0x3E, 0x00, 0x1F, 0x01, 0xFE,
-    0xAF, 0xE0, 0x07, 0xFF, 0xFD, 0x00, 0x01, 0x43, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x78,
-    0x00, 0x3C, 0x00, 0x1E, 0x00, 0xB8, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3D,
-    0x00, 0xF0, 0x00, 0xB8, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0xF4,
-    0x00, 0x7C, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0xB8, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xF4, 0x03, 0xC0,
-    0x02, 0xE0, 0x00, 0xF0, 0x07, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x0B, 0x80, 0x03, 0xC0, 0x02, 0xE0,
-    0x0F, 0x40, 0x07, 0xC0, 0x02, 0xE0, 0x0F, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x0F, 0x00, 0x0B, 0x80,
-    0x03, 0xC0, 0x1F, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x2E, 0x00, 0x0F, 0x00, 0x0B, 0x80, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x3D, 0x00, 0x1E,
-    0x00, 0xB8, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0xB8,
-    0x00, 0x3C, 0x01, 0xF0, 0x00, 0xB4, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x02, 0xE0,
-    0x00, 0xF0, 0x00, 0xB8, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xF4, 0x03, 0xC0, 0x02, 0xE0, 0x00, 0xF0,
-    0x07, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x0B, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x0F, 0x40, 0x03, 0xC0,
-    0x02, 0xE0, 0x0F, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x0F, 0x00, 0x0B, 0x80, 0x03, 0xC0, 0x1F, 0x00,
-    0x0F, 0x40, 0x07, 0xC0, 0x2E, 0x00, 0x0F, 0x00, 0x0B, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F, 0xFC,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x03, 0xFF, 0xFD, 0x00, 0xF0, 0x1F, 0xC0, 0x7C,
-    0x00, 0xF4, 0x2E, 0x00, 0x2E, 0x0F, 0x40, 0x0F, 0x83, 0xD0, 0x03, 0xD0, 0xF0, 0x02, 0xF0, 0x7C,
-    0x02, 0xF4, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0xB8,
-    0x00, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x01, 0xF0, 0x00,
-    0x00, 0x3C, 0x02, 0xE0, 0x00, 0x00, 0x7C, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x03, 0xFF, 0x90, 0x00,
-    0xF4, 0x03, 0xFF, 0xFC, 0x00, 0xF0, 0x07, 0xC0, 0x7E, 0x01, 0xF0, 0x0B, 0x80, 0x1F, 0x01, 0xE0,
-    0x0F, 0x40, 0x0F, 0x42, 0xE0, 0x0F, 0x00, 0x0F, 0x03, 0xD0, 0x0F, 0x00, 0x1F, 0x03, 0xC0, 0x1F,
-    0x00, 0x3E, 0x07, 0xC0, 0x2E, 0x01, 0xFC, 0x0B, 0x80, 0x3F, 0xFF, 0xF4, 0x0F, 0x40, 0x3F, 0xFF,
-    0x40, 0x0F, 0x40, 0x00, 0x78, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x03, 0xFF, 0xFC,
-    0x01, 0xF0, 0x1F, 0xC0, 0xB8, 0x00, 0xF0, 0x3D, 0x00, 0x3D, 0x0F, 0x00, 0x0F, 0x43, 0xC0, 0x03,
-    0xC1, 0xF0, 0x02, 0xF0, 0xB8, 0x02, 0xF4, 0x3F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x50, 0x07, 0xF0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x02, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x0B, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0xFD, 0x01, 0xFC,
-    0x00, 0xF0, 0x0F, 0xC0, 0x01, 0xF4, 0x07, 0xC0, 0x7C, 0x00, 0x03, 0xE0, 0x2E, 0x03, 0xE0, 0x00,
-    0x0B, 0xC0, 0xB8, 0x0F, 0x00, 0x00, 0x1F, 0x03, 0xE5, 0xBC, 0x00, 0x00, 0xBC, 0x0F, 0xFF, 0xE0,
-    0x00, 0x02, 0xE0, 0x7E, 0xAF, 0x40, 0x00, 0x0F, 0x82, 0xE0, 0x3D, 0x00, 0x00, 0x3D, 0x0F, 0x40,
-    0xF4, 0x00, 0x01, 0xF0, 0x3C, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0xF0, 0x0F, 0x80, 0x00, 0x7C, 0x07,
-    0xC0, 0x1F, 0x00, 0x03, 0xE0, 0x2E, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0xF4, 0x00, 0x7F, 0xEF, 0xF0,
-    0x03, 0xC0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0x40, 0x7C, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0xB8,
-    0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x3F, 0x56, 0xE0,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xAB, 0xD0, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0xBC, 0x07, 0xC0,
-    0x01, 0xF0, 0x0B, 0x80, 0x03, 0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x40, 0x3F, 0x00, 0x0F, 0x00,
-    0xBC, 0x00, 0x1F, 0x00, 0x00, 0x19, 0x01, 0x00, 0xBF, 0xF1, 0xD0, 0xBE, 0x5F, 0xF0, 0x7D, 0x00,
-    0xFC, 0x3E, 0x00, 0x3E, 0x1F, 0x00, 0x0F, 0x8B, 0x80, 0x03, 0xD3, 0xD0, 0x00, 0xF0, 0xF4, 0x00,
-    0x7C, 0x3D, 0x00, 0x3E, 0x0F, 0x40, 0x2F, 0x42, 0xE0, 0x1F, 0xD0, 0x7F, 0xBD, 0xF0, 0x0B, 0xFC,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x1F, 0xFF, 0xC0,
-    0x0B, 0xF9, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF1, 0xBD,
-    0x00, 0x2E, 0xBF, 0xFC, 0x03, 0xFD, 0x07, 0xD0, 0x3F, 0x00, 0x2E, 0x07, 0xD0, 0x01, 0xF0, 0xBC,
-    0x00, 0x1F, 0x0B, 0x80, 0x02, 0xE0, 0xB4, 0x00, 0x3D, 0x0B, 0x40, 0x03, 0xC0, 0xB8, 0x00, 0xB8,
-    0x03, 0xC0, 0x1F, 0x00, 0x2F, 0xAF, 0xD0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x2F, 0xFF, 0x40, 0x2F, 0x57, 0xF0, 0x1F, 0x00, 0x3C, 0x0F, 0x40, 0x0F, 0x07,
-    0xC0, 0x0F, 0x82, 0xFA, 0xAF, 0x80, 0xFF, 0xFF, 0x80, 0x3D, 0x01, 0xFC, 0x0F, 0x40, 0x0F, 0x03,
-    0xD0, 0x03, 0xD0, 0xBC, 0x01, 0xF0, 0x0F, 0xEB, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x40, 0x1F, 0xFF, 0xC0, 0x39, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x0B,
-    0xC0, 0x07, 0xFC, 0x01, 0xFE, 0x40, 0x2F, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00,
-    0x10, 0x3F, 0xAB, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x2E, 0xAF, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xF4, 0x02, 0xF9, 0x3D, 0x07, 0xFF, 0xDF, 0x43, 0xE0, 0x2F, 0xD2, 0xE0, 0x03, 0xF0, 0xF0, 0x00,
-    0x7C, 0xB8, 0x00, 0x1F, 0x3D, 0x00, 0x0B, 0x8F, 0x40, 0x03, 0xD3, 0xD0, 0x01, 0xF0, 0xF4, 0x00,
-    0xF4, 0x2F, 0x00, 0xFC, 0x03, 0xFA, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x07, 0xFF, 0xC0, 0xBE, 0x5F, 0x47, 0xC0, 0x2E, 0x3E, 0x00, 0xF5, 0xF0, 0x0B, 0xCB,
-    0xEB, 0xFC, 0x3F, 0xFF, 0x40, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x10,
-    0x3F, 0xAB, 0xC0, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x50, 0x00, 0x64, 0x03,
-    0xFD, 0x00, 0xF4, 0x0B, 0xFC, 0x01, 0x2F, 0x00, 0xF0, 0x2F, 0x54, 0x00, 0x0F, 0x41, 0xF0, 0x3C,
-    0x00, 0x00, 0x0B, 0x81, 0xE0, 0xB4, 0x00, 0x00, 0x07, 0x82, 0xD0, 0xF0, 0x00, 0x00, 0x0B, 0xEB,
-    0xEA, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x47, 0xC3, 0xD0, 0x00, 0x00,
-    0x1F, 0x0B, 0x82, 0xD0, 0x00, 0x00, 0x2E, 0x0B, 0x42, 0xE0, 0x00, 0x00, 0x7C, 0x0F, 0x01, 0xF0,
-    0x00, 0x2B, 0xF0, 0x0F, 0x00, 0xFE, 0x80, 0x3F, 0xC0, 0x1E, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x3F, 0xFF, 0x40, 0xA4, 0x7F, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x3D, 0x00, 0x01, 0xF0, 0xFA, 0xBF, 0x42, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01,
-    0x43, 0xD0, 0x02, 0xD0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x3C, 0x2E, 0x00, 0x1F, 0x0B, 0x40, 0x0B,
-    0x83, 0xC0, 0x03, 0xD0, 0xF0, 0x00, 0xF0, 0x7C, 0x00, 0x7C, 0x2E, 0x00, 0x3F, 0x0B, 0x80, 0x1F,
-    0x82, 0xE0, 0x1F, 0xD0, 0x7F, 0xBD, 0xF0, 0x0B, 0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x0A, 0x00, 0x2D, 0x07, 0xC0, 0x03, 0xEB, 0xC0, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x50, 0xF4, 0x00, 0xB4, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x0F, 0x0B, 0x80, 0x07, 0xC2, 0xD0,
-    0x02, 0xE0, 0xF0, 0x00, 0xF4, 0x3C, 0x00, 0x3C, 0x1F, 0x00, 0x1F, 0x0B, 0x80, 0x0F, 0xC2, 0xE0,
-    0x07, 0xE0, 0xB8, 0x07, 0xF4, 0x1F, 0xEF, 0x7C, 0x02, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x01, 0x40, 0x3D, 0x00, 0xF8, 0x03, 0xC0, 0x2E, 0x00, 0x3C, 0x0B, 0xC0, 0x07, 0xC1, 0xF0,
-    0x00, 0xB8, 0x7C, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0x0F, 0x40, 0x01, 0xE0,
-    0xBC, 0x00, 0x2E, 0x03, 0xD0, 0x03, 0xD0, 0x2E, 0x00, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x0B, 0x80,
-    0x00, 0x01, 0x55, 0x54, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x07, 0xD5, 0xBC, 0x00, 0x0F, 0x40, 0x7C,
-    0x00, 0x0F, 0x00, 0x78, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0xF0,
-    0x00, 0x3C, 0x01, 0xF0, 0x00, 0x78, 0x02, 0xE0, 0x00, 0xF4, 0x03, 0xD0, 0x01, 0xF0, 0x03, 0xC0,
-    0x3F, 0xD0, 0x03, 0xC0, 0x3F, 0x40, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01,
-    0x50, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x0F, 0xB4, 0x07,
-    0xAC, 0x00, 0xB7, 0xC0, 0x2D, 0xB4, 0x03, 0xCF, 0x00, 0xF1, 0xD0, 0x3D, 0x7C, 0x03, 0xC3, 0x81,
-    0xE2, 0xE0, 0x0F, 0x0F, 0x0F, 0x0B, 0x40, 0x78, 0x3C, 0xB4, 0x3C, 0x02, 0xD0, 0xB7, 0xC0, 0xF0,
-    0x0F, 0x01, 0xFD, 0x07, 0x80, 0x3C, 0x07, 0xE0, 0x2E, 0x01, 0xF0, 0x0F, 0x00, 0xF4, 0x00, 0x01,
-    0x40, 0x00, 0x50, 0x3D, 0x00, 0x2E, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3C, 0x07, 0xC0, 0x07,
-    0xC0, 0xB8, 0x00, 0xB8, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0x0F, 0x01, 0xF0,
-    0x01, 0xF0, 0x2E, 0x00, 0x2E, 0x03, 0xD0, 0x03, 0xD0, 0x3C, 0x00, 0x3C, 0x07, 0xC0, 0x03, 0xC0,
-    0x00, 0x06, 0x90, 0x00, 0x0B, 0xFF, 0xD0, 0x02, 0xF4, 0x6F, 0x00, 0x7C, 0x00, 0xF8, 0x0F, 0x40,
-    0x07, 0xC1, 0xF0, 0x00, 0x7C, 0x2E, 0x00, 0x07, 0xC2, 0xD0, 0x00, 0xB8, 0x3D, 0x00, 0x0F, 0x43,
-    0xD0, 0x00, 0xF0, 0x2E, 0x00, 0x2E, 0x01, 0xF0, 0x07, 0xC0, 0x0B, 0xEB, 0xF4, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xA4, 0x00, 0xF2, 0xFF, 0xC0, 0x3E, 0xE5, 0xF8, 0x0F,
-    0xD0, 0x2F, 0x07, 0xD0, 0x0B, 0xC2, 0xF0, 0x02, 0xE0, 0xF8, 0x00, 0xF4, 0x3C, 0x00, 0x3C, 0x1F,
-    0x00, 0x1F, 0x07, 0x80, 0x07, 0xC2, 0xE0, 0x02, 0xE0, 0xF4, 0x00, 0xF4, 0x3C, 0x00, 0x3C, 0x1F,
-    0x00, 0x1F, 0x00, 0x00, 0x50, 0x19, 0x00, 0x03, 0xC7, 0xFF, 0x00, 0x0F, 0x79, 0x7F, 0x00, 0x3F,
-    0x40, 0x7C, 0x01, 0xF8, 0x00, 0xF4, 0x0B, 0xC0, 0x03, 0xD0, 0x3E, 0x00, 0x0F, 0x00, 0xF4, 0x00,
-    0x7C, 0x03, 0xC0, 0x02, 0xF0, 0x1F, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x7C, 0x03, 0xF8, 0x07, 0xD0,
-    0x0F, 0x7E, 0xFE, 0x00, 0x7C, 0xBF, 0xD0, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0xBF, 0xFC, 0x02, 0xF9, 0x58, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0xEA, 0xD0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x64, 0x01, 0xA4,
-    0x00, 0xF1, 0xFF, 0x83, 0xFF, 0x80, 0x3D, 0xE5, 0xF7, 0xD2, 0xF0, 0x0F, 0xC0, 0x2F, 0xC0, 0x3D,
-    0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0x42, 0xF0, 0x03, 0xE0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x01, 0xF0,
-    0x3C, 0x00, 0x7C, 0x00, 0x78, 0x1F, 0x00, 0x1E, 0x00, 0x2E, 0x07, 0x80, 0x0B, 0x40, 0x0F, 0x42,
-    0xE0, 0x03, 0xD0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x1F,
-    0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0x14, 0x00, 0x05, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x07, 0xC0,
-    0x07, 0xC0, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x02,
-    0xD0, 0x7C, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x1E, 0x1F, 0x00, 0x00, 0x07, 0x8F, 0x40, 0x00,
-    0x00, 0xF7, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01,
-    0xBD, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x02, 0xF9, 0xFA, 0xF4, 0x07, 0xD0, 0xF4, 0xBC, 0x0F, 0x40,
-    0xF0, 0x3D, 0x1F, 0x01, 0xF0, 0x2E, 0x2E, 0x02, 0xE0, 0x2E, 0x3D, 0x02, 0xD0, 0x2E, 0x3D, 0x03,
-    0xC0, 0x3D, 0x3D, 0x03, 0xC0, 0x7C, 0x2E, 0x07, 0xC0, 0xF8, 0x0F, 0x8B, 0x83, 0xF0, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x50, 0x03, 0xC0, 0x0F, 0x80, 0x0B, 0x80, 0xB8, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0x2D, 0x7C,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x02, 0xF7, 0xC0, 0x00, 0x1F, 0x0F, 0x40, 0x00, 0xF4, 0x1F, 0x00, 0x0F, 0x40, 0x3C, 0x00, 0xF8,
-    0x00, 0xB8, 0x00, 0x05, 0x00, 0x01, 0x43, 0xD0, 0x02, 0xD0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x3C,
-    0x2E, 0x00, 0x1F, 0x0B, 0x40, 0x0B, 0x83, 0xD0, 0x03, 0xD0, 0xF0, 0x00, 0xF0, 0x7C, 0x00, 0x7C,
-    0x2E, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xE0, 0x1F, 0xE0, 0x7F, 0xBD, 0xBE, 0x0B, 0xFD, 0x1F,
-    0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00,
-    0x05, 0x07, 0xC0, 0x03, 0xC1, 0xF0, 0x01, 0xF0, 0xB8, 0x00, 0xB8, 0x3D, 0x00, 0x3D, 0x0F, 0x00,
-    0x2F, 0x43, 0xD0, 0x1F, 0xC0, 0xFE, 0xBE, 0xF0, 0x0F, 0xFD, 0xB8, 0x00, 0x54, 0x3D, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x05, 0x00, 0x05, 0x00,
-    0x05, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x7C, 0x00, 0xB8, 0x00,
-    0xB4, 0x2E, 0x00, 0x2D, 0x00, 0x3C, 0x0B, 0x40, 0x0F, 0x40, 0x0F, 0x03, 0xD0, 0x03, 0xC0, 0x07,
-    0xC0, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x2E, 0x00, 0x3D, 0x00, 0x7C,
-    0x0B, 0x80, 0x2F, 0x40, 0x3F, 0x02, 0xE0, 0x2F, 0xE0, 0x3F, 0xC0, 0x7E, 0xBC, 0x7E, 0xB9, 0xE0,
-    0x0B, 0xFC, 0x0B, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05,
-    0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x7C, 0x00, 0xB8, 0x00, 0xB4,
-    0x2E, 0x00, 0x2D, 0x00, 0x3D, 0x0B, 0x40, 0x0F, 0x40, 0x0F, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0,
-    0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x2E, 0x00, 0x3D, 0x00, 0x7C, 0x0B,
-    0x80, 0x2F, 0x40, 0x3F, 0x02, 0xE0, 0x2F, 0xE0, 0x3F, 0xC0, 0x7E, 0xBC, 0x7E, 0xB9, 0xF9, 0x0B,
-    0xFC, 0x0B, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x54, 0x00, 0x2F, 0xFD, 0x00,
-    0x05, 0x5F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB9, 0x54, 0x00, 0x3F, 0xFF,
-    0xD0, 0x0F, 0x95, 0xBC, 0x03, 0xC0, 0x0F, 0x81, 0xF0, 0x02, 0xE0, 0x7C, 0x00, 0xF4, 0x0F, 0x00,
-    0x7C, 0x02, 0xFA, 0xBE, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x42,
-    0xD0, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x1F,
-    0x0B, 0x95, 0x40, 0x0B, 0x83, 0xFF, 0xFC, 0x02, 0xD0, 0xF9, 0x5F, 0xC0, 0xF4, 0x3C, 0x00, 0xF4,
-    0x3C, 0x1F, 0x00, 0x3D, 0x1F, 0x07, 0xC0, 0x0F, 0x0B, 0x80, 0xF0, 0x0B, 0xC3, 0xD0, 0x2F, 0xAF,
-    0xD0, 0xF0, 0x02, 0xFF, 0xD0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xB9, 0x54, 0x03, 0xFF, 0xFD, 0x0F, 0x95,
-    0xFC, 0x7C, 0x00, 0xF5, 0xE0, 0x03, 0xD7, 0xC0, 0x0F, 0x5F, 0x00, 0x7C, 0x3F, 0xAF, 0xD0, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x3F, 0xFF, 0x00, 0xA5, 0x7F, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x3F, 0xFF, 0x81, 0xFF, 0xFE, 0x00, 0x00, 0xF4, 0x00, 0x03,
-    0xC0, 0x00, 0x2E, 0x00, 0x01, 0xF0, 0x7A, 0xBF, 0x40, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x69, 0x00, 0x0B, 0x80, 0x2F, 0xFE, 0x00, 0x3D, 0x02, 0xF4, 0x7E, 0x00, 0xF0, 0x1F,
-    0x00, 0x7C, 0x07, 0xC0, 0xF4, 0x00, 0xF0, 0x1E, 0x07, 0xC0, 0x03, 0xD0, 0xBF, 0xFE, 0x00, 0x0F,
-    0x03, 0xFF, 0xF4, 0x00, 0x3C, 0x0F, 0x03, 0xD0, 0x01, 0xF0, 0x7C, 0x0F, 0x40, 0x0B, 0x82, 0xE0,
-    0x2D, 0x00, 0x3C, 0x0F, 0x40, 0x7C, 0x03, 0xE0, 0x3C, 0x00, 0xFE, 0xBF, 0x00, 0xF0, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x07, 0xFF, 0xFC, 0x01, 0xF9,
-    0x5B, 0xC0, 0x3D, 0x00, 0xB8, 0x03, 0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xE0, 0x1F, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0x83, 0xD0, 0x03, 0xE0, 0x3C, 0x00, 0xBC, 0x07,
-    0xC0, 0x2F, 0x00, 0xB8, 0x07, 0xD0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0,
-    0x00, 0x02, 0xD0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x7F, 0xFC, 0x0B, 0xE5,
-    0xF4, 0x7C, 0x02, 0xE3, 0xE0, 0x0F, 0x5F, 0x00, 0xBC, 0xBE, 0xBF, 0xC3, 0xFF, 0xF4, 0x0F, 0x40,
-    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x01, 0x03, 0xFA, 0xBC, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x3C, 0x00, 0xF4, 0x7C, 0x00, 0x10, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF0, 0x0B, 0xE5, 0xF4, 0x1F, 0x00, 0xB8, 0x3E, 0x00, 0xF4,
-    0x7C, 0x02, 0xF0, 0xBE, 0xBF, 0xC0, 0xFF, 0xFD, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x7C, 0x00, 0x40, 0x3F, 0xAB, 0xC0, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x2E, 0x2F, 0xE0, 0x0F, 0x7F, 0xFE, 0x03, 0xFC, 0x0B, 0xC1, 0xFC, 0x01, 0xF0, 0x7C,
-    0x00, 0x7C, 0x2E, 0x00, 0x2E, 0x0F, 0x40, 0x0F, 0x43, 0xC0, 0x03, 0xC1, 0xF0, 0x00, 0xF0, 0xB8,
-    0x00, 0x7C, 0x3D, 0x00, 0x2E, 0x0F, 0x00, 0x0F, 0x43, 0xC0, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xF0, 0x03, 0x91, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xF9, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x3F, 0xAB, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0xBF, 0xFD, 0x02, 0xF9, 0x58, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xEA, 0xE0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x0F,
-    0xFF, 0xC0, 0xFD, 0x5B, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x3F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x10, 0x02, 0xF0, 0xFA, 0xBF, 0x42,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0xE0, 0x0F, 0x80, 0x04, 0x00, 0x00, 0x01,
-    0x40, 0x2E, 0x00, 0xF4, 0x03, 0xC0, 0x1F, 0x00, 0x78, 0x02, 0xE0, 0x0F, 0x40, 0x3C, 0x01, 0xF0,
-    0x0B, 0x80, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x01, 0x04, 0x00, 0xF3, 0xC0, 0x7D, 0xE0, 0x04,
-    0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8,
-    0x00, 0x3D, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x0F, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x40, 0x00,
-    0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00,
-    0x2F, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xD5, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x07, 0x80, 0x00, 0x00, 0x0F,
-    0x00, 0xB4, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x55, 0x00, 0x00, 0x2E, 0x00, 0xFF, 0xFE, 0x00, 0x03,
-    0xD0, 0x1F, 0x56, 0xF8, 0x00, 0x3C, 0x02, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x2E, 0x00, 0x3C, 0x00,
-    0xF4, 0x02, 0xE0, 0x07, 0xC0, 0x1F, 0x00, 0x1F, 0x00, 0xF8, 0x3F, 0xD0, 0x00, 0xFE, 0xBF, 0x03,
-    0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x40, 0x00,
-    0x0B, 0x40, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x07, 0xC0,
-    0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xEA, 0xAF, 0xEA,
-    0xFC, 0x0F, 0x00, 0x2E, 0x00, 0xF8, 0x78, 0x00, 0xF4, 0x01, 0xF2, 0xE0, 0x03, 0xD0, 0x0B, 0x8F,
-    0x40, 0x0B, 0xC0, 0x3D, 0x3C, 0x00, 0x0F, 0xEB, 0xF1, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0x40, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x05, 0x40, 0x02, 0xD3, 0xFF, 0x00, 0x3D, 0xFA, 0xF8, 0x03,
-    0xF8, 0x07, 0xC0, 0x7E, 0x00, 0x3C, 0x07, 0xC0, 0x07, 0xC0, 0xB8, 0x00, 0xB8, 0x0F, 0x40, 0x0F,
-    0x40, 0xF0, 0x00, 0xF4, 0x1F, 0x00, 0x0F, 0x02, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x2E, 0x03, 0xC0,
-    0x03, 0xD0, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x3D,
-    0x00, 0xF8, 0x03, 0xC0, 0x2E, 0x00, 0x3C, 0x0B, 0xC0, 0x07, 0xC1, 0xF0, 0x00, 0xB8, 0x7C, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0x0F, 0x40, 0x01, 0xE0, 0xBC, 0x00, 0x2E, 0x03,
-    0xD0, 0x03, 0xD0, 0x2E, 0x00, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x14, 0x3D, 0x00, 0x2D, 0x0F, 0x00, 0x0F, 0x47, 0xC0, 0x03, 0xC2, 0xE0, 0x01, 0xF0,
-    0xB4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x0F, 0x07, 0xC0, 0x07, 0xC2, 0xE0, 0x03, 0xF0,
-    0xB8, 0x01, 0xF8, 0x2E, 0x01, 0xFD, 0x07, 0xFB, 0xDF, 0x00, 0xBF, 0xD3, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x80, 0x28, 0x00, 0x00, 0xB0, 0x1E, 0x00, 0x00, 0x1F, 0xAF, 0x00, 0x00, 0x01,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x40, 0x07, 0x80, 0x02, 0xE0, 0x01,
-    0xF0, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x3D, 0x00,
-    0x00, 0xB4, 0x1F, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x07, 0x87, 0xC0, 0x00, 0x01, 0xE3, 0xD0,
-    0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43,
-    0xD0, 0x02, 0xD0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x3C, 0x2E, 0x00, 0x1F, 0x0B, 0x40, 0x0B, 0x83,
-    0xC0, 0x03, 0xD0, 0xF0, 0x00, 0xF0, 0x7C, 0x00, 0x7C, 0x2E, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82,
-    0xE0, 0x1F, 0xD0, 0x7F, 0xBD, 0xF0, 0x0B, 0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0x00, 0xB8,
-    0xF0, 0x00, 0x3D, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xF4, 0x00, 0x0F, 0x1F, 0x00, 0x03, 0xD0, 0x00,
-    0x7C, 0x7C, 0x00, 0x0F, 0x40, 0x03, 0xE1, 0xF0, 0x00, 0x7D, 0x00, 0x0F, 0x07, 0xC0, 0x03, 0xF4,
-    0x00, 0xBC, 0x1F, 0x00, 0x1F, 0xD0, 0x03, 0xD0, 0x7C, 0x00, 0xFF, 0x40, 0x1F, 0x01, 0xF0, 0x0B,
-    0xBD, 0x00, 0xF8, 0x03, 0xC0, 0x3C, 0xF8, 0x03, 0xC0, 0x0F, 0x42, 0xD2, 0xE0, 0x2E, 0x00, 0x3D,
-    0x1F, 0x07, 0xC1, 0xF0, 0x00, 0xF8, 0xF0, 0x1F, 0x0F, 0x40, 0x02, 0xF7, 0x80, 0x3D, 0x7C, 0x00,
-    0x07, 0xFC, 0x00, 0xFB, 0xC0, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x3C, 0x00, 0x7C,
-    0x00, 0x3C, 0x3C, 0x00, 0x78, 0x00, 0x78, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x7C, 0x00, 0xB8, 0x00,
-    0xF0, 0x7C, 0x00, 0xB8, 0x02, 0xE0, 0x3C, 0x00, 0xF8, 0x03, 0xC0, 0x3C, 0x03, 0xF8, 0x07, 0x80,
-    0x3C, 0x0B, 0xBC, 0x0F, 0x00, 0x3D, 0x1E, 0x3C, 0x2E, 0x00, 0x2D, 0x3C, 0x3C, 0x7C, 0x00, 0x1E,
-    0xB0, 0x2D, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x2E, 0x00, 0x01, 0x5F, 0x95, 0x40, 0xFF, 0xFF, 0xF0, 0x2A, 0xFA, 0xA4, 0x00, 0x78,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x94, 0x00, 0x03, 0xFF, 0xF4, 0x01, 0xFA, 0xBF, 0x80, 0xB8,
-    0x02, 0xF0, 0x3D, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x43, 0xC0, 0x03, 0xC1, 0xF0, 0x02, 0xF0, 0xB8,
-    0x07, 0xF4, 0x3F, 0xFF, 0xF4, 0x0F, 0xFF, 0x90, 0x00, 0x01, 0x40, 0xA9, 0x00, 0x00, 0x02, 0xD7,
-    0xFF, 0x40, 0x00, 0x03, 0xEF, 0x5F, 0xC0, 0x00, 0x03, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xE0, 0x07,
-    0xC0, 0x00, 0x0B, 0xC0, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xEF, 0xD0, 0x0F, 0x40, 0x0F, 0xFF,
-    0xF8, 0x0F, 0x00, 0x0F, 0x00, 0x7C, 0x1F, 0x00, 0x0F, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0x00, 0x3C,
-    0x3D, 0x00, 0x0F, 0x00, 0x7C, 0x3D, 0x00, 0x0B, 0xEB, 0xF4, 0x7C, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xBF, 0xF8, 0x01,
-    0xE0, 0x00, 0xBF, 0xFF, 0xD0, 0x2E, 0x00, 0x3F, 0x80, 0x08, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0x00,
-    0x3C, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00,
-    0x0F, 0x95, 0xFD, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xAA, 0xFA, 0xAA, 0xA0,
-    0x01, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x7E, 0x00,
-    0x00, 0x0B, 0x80, 0x02, 0xFF, 0xBF, 0x40, 0xF4, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x6A, 0x40, 0x2E, 0x00, 0x7F, 0xFD, 0x03, 0xD0, 0x2F, 0x91, 0x80,
-    0x3C, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x2E,
-    0x02, 0xE0, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0xFE, 0xAE, 0x03, 0xC0, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x3E, 0xE0, 0x00, 0x00, 0xB9, 0xE0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x02,
-    0xE0, 0xF0, 0x00, 0x07, 0xD5, 0xF0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x1F, 0xBE, 0xF8, 0x00, 0x3C,
-    0x3C, 0x78, 0x00, 0xB8, 0x78, 0x3C, 0x00, 0xF0, 0x78, 0x3C, 0x03, 0xD0, 0xB4, 0x3C, 0x07, 0xC0,
-    0xF0, 0x3D, 0x0F, 0x40, 0xF0, 0x2E, 0x2F, 0x01, 0xE0, 0x1E, 0x3C, 0x02, 0xE0, 0x1F, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x0B, 0x8F, 0x00,
-    0x00, 0xF0, 0xF4, 0x00, 0x3F, 0xAF, 0x40, 0x07, 0xFF, 0xF8, 0x00, 0xF5, 0xD7, 0xC0, 0x2E, 0x2C,
-    0x3C, 0x03, 0xC3, 0xC3, 0xC0, 0xB8, 0x3C, 0x3D, 0x1F, 0x07, 0x82, 0xD3, 0xD0, 0xB4, 0x2E, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x00, 0xFD, 0x00, 0x2E, 0x00, 0x07, 0xF4, 0x00, 0xF4, 0x00,
-    0x3E, 0xE0, 0x03, 0xC0, 0x02, 0xE7, 0xC0, 0x1F, 0x00, 0x0F, 0x0F, 0x00, 0xB8, 0x00, 0xB8, 0x3C,
-    0x03, 0xE5, 0x57, 0xD5, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3E, 0xAB, 0xFB, 0xEF, 0x81, 0xF0,
-    0x0F, 0x0F, 0x1F, 0x0B, 0x80, 0xB8, 0x38, 0x3C, 0x3D, 0x03, 0xC1, 0xE0, 0xF0, 0xF0, 0x3E, 0x0B,
-    0x43, 0xD3, 0xC1, 0xF0, 0x3C, 0x0F, 0x5F, 0x0F, 0x40, 0xF0, 0x2E, 0xB8, 0xBC, 0x07, 0x80, 0x7F,
-    0xD3, 0xC0, 0x2E, 0x01, 0xF0, 0x00, 0x50, 0x00, 0x50, 0x00, 0xB8, 0x00, 0xFE, 0x00, 0x3D, 0x00,
-    0x7F, 0x80, 0x0F, 0x00, 0x3C, 0xF0, 0x07, 0xC0, 0x2D, 0x3C, 0x01, 0xE0, 0x0F, 0x0F, 0x00, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0x03, 0xCB, 0x5E, 0x07, 0xC2, 0xE3, 0xC3, 0xC2,
-    0xE0, 0xF0, 0xF0, 0xF0, 0xF4, 0xF4, 0x3C, 0x3C, 0x3C, 0x7C, 0x1E, 0x0B, 0x4F, 0x3D, 0x0B, 0x42,
-    0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xE0, 0x00, 0x7D, 0x00,
-    0x03, 0xC0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0x2E,
-    0x3D, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x02, 0xFA, 0xF7, 0xF0,
-    0x00, 0x1F, 0x0B, 0x83, 0xD0, 0x00, 0xF4, 0x3D, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x1E, 0x00, 0x3D,
-    0x03, 0xC0, 0x7C, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x0F, 0x40, 0xB8, 0x07, 0xC0, 0x7C, 0x03, 0xD0,
-    0x1F, 0x03, 0xE0, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x02, 0xE5, 0x5B, 0xE0, 0x00, 0x3C, 0x03, 0xE0, 0x00, 0x07, 0x83, 0xD0, 0x00, 0x00, 0xF7, 0xD0,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFB, 0xEF, 0xC0, 0x01, 0xF0, 0xF0, 0xF4, 0x00, 0xF4, 0x3C,
-    0x1E, 0x00, 0x7C, 0x1E, 0x07, 0xC0, 0x3C, 0x0B, 0x80, 0xF0, 0x2E, 0x02, 0xD0, 0x3C, 0x0F, 0x00,
-    0xF0, 0x0F, 0x40, 0x00, 0xF0, 0x1F, 0xFF, 0xFF, 0xF4, 0x07, 0x80, 0xBF, 0xFF, 0xFF, 0xC0, 0x2E,
-    0x01, 0xF0, 0x00, 0x7E, 0x00, 0xF4, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x3E, 0x00,
-    0x1F, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0xB8, 0x00, 0x1F, 0x2E, 0x00, 0x03, 0xE5, 0x55, 0x7F, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0xAB, 0xFA, 0xFA, 0xF4, 0x01, 0xF0, 0x0F, 0x47,
-    0xC2, 0xE0, 0x0B, 0x80, 0xB8, 0x1F, 0x07, 0xC0, 0x3D, 0x03, 0xC0, 0xB8, 0x0F, 0x00, 0xF0, 0x2E,
-    0x03, 0xD0, 0x3C, 0x03, 0xC0, 0xF0, 0x0F, 0x00, 0xF0, 0x1F, 0x0B, 0xC0, 0x7C, 0x03, 0xC0, 0xB8,
-    0x3D, 0x02, 0xE0, 0x0F, 0x03, 0xD2, 0xF0, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55,
-    0x02, 0xE0, 0xFF, 0xFF, 0xFE, 0x03, 0xD0, 0xBD, 0x55, 0xF8, 0x03, 0xC0, 0x3C, 0x02, 0xE0, 0x07,
-    0xC0, 0x1F, 0x0B, 0x80, 0x07, 0x80, 0x0B, 0x6E, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFB, 0xFB, 0xC0, 0x0F, 0x03, 0xD2, 0xD2, 0xE0, 0x1F, 0x0B, 0x83, 0xC0, 0xF0, 0x2E, 0x1F, 0x03,
-    0xC0, 0xF0, 0x3D, 0x3D, 0x07, 0x80, 0xF0, 0x3C, 0x7C, 0x0B, 0x40, 0xF4, 0x3C, 0xF4, 0x0B, 0x40,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0B, 0xC0, 0x00, 0x2D, 0xB8, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1B, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0xBF,
-    0xF8, 0x00, 0x02, 0xAF, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x01, 0x6F, 0xFD, 0x00,
-    0x7F, 0xFF, 0x80, 0x07, 0xE5, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x40, 0x01, 0xFF,
-    0xFF, 0xE0, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x80, 0x00, 0xF0,
-    0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0x51, 0xF8, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x01,
-    0xBF, 0x80, 0x0B, 0xFF, 0x90, 0x03, 0xF5, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xE5, 0x55, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x15, 0x56, 0x40, 0x07, 0x80, 0x2E, 0x00, 0xB4, 0x2E, 0x00, 0xF4, 0x03,
-    0xD0, 0xF4, 0x03, 0xD0, 0x0F, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x02, 0xE0, 0xB8,
-    0x02, 0xE0, 0x0F, 0x43, 0xE0, 0x0F, 0x40, 0x3C, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x3D, 0x01, 0xF0,
-    0x0F, 0x80, 0xF8, 0x0B, 0xC0, 0x7C, 0x01, 0xF4, 0x2E, 0x07, 0xD0, 0x03, 0xFE, 0xFE, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x05, 0x00, 0xF4, 0x14, 0x0F, 0x40, 0xF0, 0x2D, 0x0F, 0x00, 0xF0, 0x2E, 0x0F, 0x01, 0xE0,
-    0x2E, 0x1F, 0x02, 0xE0, 0x2D, 0x2E, 0x03, 0xD0, 0x3D, 0x3D, 0x03, 0xC0, 0x3C, 0x3C, 0x07, 0xC0,
-    0x3C, 0x3C, 0x07, 0x80, 0xB8, 0x7C, 0x0B, 0x40, 0xF4, 0x7C, 0x0F, 0x02, 0xE0, 0x3E, 0x0F, 0x0B,
-    0xC0, 0x2F, 0xEF, 0xBF, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4,
-    0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C,
-    0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F,
-    0x40, 0x2E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xFE, 0xE0, 0x00, 0x1F, 0xF7, 0x80, 0x00, 0xF4, 0x1F, 0x00,
-    0x0B, 0x80, 0x3C, 0x00, 0x3C, 0x00, 0xF0, 0x02, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x0F, 0x00, 0xB8,
-    0x00, 0x3D, 0x03, 0xD0, 0x00, 0xB4, 0x2F, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x07, 0x87, 0xC0, 0x00,
-    0x1E, 0x3D, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0xFB, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x2D, 0x00, 0x1F, 0xCB, 0x80, 0x0F,
-    0x41, 0xE0, 0x0B, 0x80, 0x7C, 0x03, 0xC0, 0x1F, 0x02, 0xE0, 0x03, 0xC0, 0xF0, 0x00, 0xF0, 0x7C,
-    0x00, 0x3C, 0x3D, 0x00, 0x0F, 0x5F, 0x00, 0x02, 0xDF, 0x40, 0x00, 0xBB, 0xC0, 0x00, 0x1F, 0xD0,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0xF4, 0xB8, 0x00,
-    0x00, 0xF0, 0xF0, 0x00, 0x01, 0xD0, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x1F, 0xEE,
-    0x00, 0x01, 0xFF, 0x78, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0xB8, 0x03, 0xC0, 0x03, 0xC0, 0x0F, 0x00,
-    0x2E, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xF0, 0x0B, 0x80, 0x03, 0xD0, 0x3D, 0x00, 0x0B, 0x42, 0xF0,
-    0x00, 0x2E, 0x0F, 0x40, 0x00, 0x78, 0x7C, 0x00, 0x01, 0xE3, 0xD0, 0x00, 0x07, 0xDF, 0x00, 0x00,
-    0x0F, 0xB4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x1F, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x78, 0x3C, 0x00, 0x0B, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x52, 0xD0, 0x01, 0xFC, 0xB8, 0x00, 0xF4, 0x1E, 0x00, 0xB8, 0x07,
-    0xC0, 0x3C, 0x01, 0xF0, 0x2E, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x07, 0xC0, 0x03, 0xC3, 0xD0, 0x00,
-    0xF5, 0xF0, 0x00, 0x2D, 0xF4, 0x00, 0x0B, 0xBC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x50, 0x00, 0x05, 0x0F, 0x40, 0x00,
-    0x0F, 0x0B, 0x80, 0x03, 0xD1, 0xF0, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0x0F,
-    0x07, 0xC0, 0x0F, 0x43, 0xD0, 0x00, 0x00, 0xF0, 0x3C, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x1F, 0x03,
-    0xC0, 0x3C, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x3C, 0x0B, 0x80, 0x3C, 0x00, 0x00, 0x3E, 0x02, 0xD0,
-    0xF0, 0x03, 0xD0, 0x00, 0x07, 0xD0, 0x2D, 0x2E, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x01, 0xE3, 0xC0,
-    0x02, 0xF0, 0x00, 0x2F, 0x00, 0x1E, 0xB8, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0xEF, 0x00, 0x00,
-    0x7F, 0xEF, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x05,
-    0x00, 0x00, 0x50, 0x1F, 0xFF, 0x40, 0xB8, 0x00, 0x3D, 0x0B, 0xE5, 0xBC, 0x07, 0x80, 0x07, 0xC1,
-    0xF4, 0x03, 0xE0, 0x7C, 0x00, 0xF4, 0x3E, 0x00, 0x1F, 0x03, 0xC0, 0x1F, 0x03, 0xC0, 0x01, 0xF0,
-    0x3C, 0x03, 0xD0, 0x7C, 0x00, 0x1F, 0x03, 0xD0, 0xB8, 0x0B, 0x80, 0x02, 0xE0, 0x2D, 0x0F, 0x00,
-    0xF4, 0x00, 0x3E, 0x02, 0xE2, 0xE0, 0x0F, 0x40, 0x03, 0xC0, 0x1E, 0x3C, 0x00, 0xB8, 0x00, 0xB8,
-    0x01, 0xEB, 0x80, 0x07, 0xC0, 0x1F, 0x00, 0x0E, 0xF0, 0x00, 0x2F, 0xAF, 0xD0, 0x00, 0xFD, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFD, 0x7D, 0xBE, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x3E,
-    0x1F, 0x00, 0x00, 0x0B, 0x8F, 0x80, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x00,
-    0x3E, 0x3C, 0x00, 0x00, 0x0F, 0x4F, 0x00, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x03, 0xF0, 0xF8, 0x00,
-    0x01, 0xF4, 0x2F, 0x00, 0x00, 0xF8, 0x03, 0xF2, 0xE1, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x07, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x2F, 0xBE, 0xF8, 0x1F, 0x40, 0x1F, 0x0F, 0x80, 0x03, 0xD3,
-    0xC0, 0x00, 0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x3D, 0x00, 0x07, 0xCF, 0x40, 0x02, 0xE2,
-    0xE0, 0x00, 0xF4, 0x7C, 0x24, 0xF8, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x50, 0x00,
-    0x00, 0x00, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x06, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0x00, 0x0F, 0x80,
-    0x80, 0x20, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x3E,
-    0x00, 0x00, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7C,
-    0x3E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0xF4, 0x00,
-    0x3D, 0x0F, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x3C, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0xB8,
-    0x00, 0x3D, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xD0, 0x2F, 0xC0, 0x3F, 0x00, 0x0F, 0xFB,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFE, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xAF, 0xE0, 0x00, 0x02, 0xC1, 0x2F, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x69, 0x00, 0x2F, 0xFC, 0x2F, 0xF8, 0x0B, 0xE5, 0x40,
-    0x97, 0xD1, 0xF4, 0x00, 0x00, 0x2E, 0x3E, 0x00, 0x00, 0x02, 0xF3, 0xC0, 0x00, 0x00, 0x1F, 0xBC,
-    0x00, 0x00, 0x02, 0xEB, 0x80, 0x0A, 0x00, 0x2E, 0xF4, 0x01, 0xF0, 0x03, 0xDF, 0x80, 0x2E, 0x00,
-    0x7C, 0xB8, 0x03, 0xD0, 0x0F, 0x87, 0xC0, 0x3D, 0x02, 0xF0, 0x3F, 0xAF, 0xFE, 0xFD, 0x00, 0xFF,
-    0xDB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0C, 0x0C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x02, 0xE3, 0xC0, 0x00, 0xF4, 0x00, 0x0F,
-    0x5F, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x7C, 0x00, 0x0F, 0x40, 0x01, 0xF1, 0xF0, 0x00, 0x3D, 0x00,
-    0x0F, 0x87, 0xC0, 0x01, 0xF4, 0x00, 0x3C, 0x1F, 0x00, 0x0F, 0xD0, 0x02, 0xF0, 0x7C, 0x00, 0x7F,
-    0x40, 0x0F, 0x41, 0xF0, 0x03, 0xFD, 0x00, 0x7C, 0x07, 0xC0, 0x2E, 0xF4, 0x03, 0xE0, 0x0F, 0x00,
-    0xF3, 0xE0, 0x0F, 0x00, 0x3D, 0x0B, 0x4B, 0x80, 0xB8, 0x00, 0xF4, 0x7C, 0x1F, 0x07, 0xC0, 0x03,
-    0xE3, 0xC0, 0x7C, 0x3D, 0x00, 0x0B, 0xDE, 0x00, 0xF5, 0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xEF, 0x00,
-    0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x00, 0x00, 0x0B, 0x5F, 0x5E, 0x00, 0x00, 0x04, 0x04, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x3C, 0x00, 0x7C, 0x00, 0x3C,
-    0x3C, 0x00, 0x78, 0x00, 0x78, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x7C, 0x00, 0xB8, 0x00, 0xF0, 0x7C,
-    0x00, 0xB8, 0x02, 0xE0, 0x3C, 0x00, 0xF8, 0x03, 0xC0, 0x3C, 0x03, 0xF8, 0x07, 0x80, 0x3C, 0x0B,
-    0xBC, 0x0F, 0x00, 0x3D, 0x1E, 0x3C, 0x2E, 0x00, 0x2D, 0x3C, 0x3C, 0x7C, 0x00, 0x1E, 0xB0, 0x2D,
-    0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0x80, 0x08, 0x02, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x07, 0xFF, 0xD0,
-    0xBE, 0x46, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00,
-    0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xEE, 0x00, 0x2F, 0xF4,
-    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x90, 0x3C, 0x00, 0x0F, 0xCB, 0x40, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xF0, 0xBC, 0x34, 0x1E, 0x00,
-    0x07, 0xF7, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xEF, 0xD0, 0x00, 0x78,
-    0x1D, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD6,
-    0xAA, 0xBD, 0xFE, 0xAA, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xBF, 0xD6, 0xCA, 0x40,
-    0x08, 0x10, 0xBC, 0xB0, 0x34, 0x08, 0x14, 0x3D, 0x1D, 0x2C, 0x60, 0x00, 0x00, 0x01, 0xFE, 0x40,
-    0x3E, 0xFF, 0x9B, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x01, 0xD1, 0xD0, 0x00, 0x00, 0xB4, 0x70, 0x00, 0x14, 0x05, 0x00, 0x00, 0x04, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x43, 0x97, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x6C, 0x20, 0x08,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xEB, 0xC0, 0x00, 0x00,
-    0x7A, 0xF0, 0x00, 0x28, 0x09, 0x00, 0x00, 0x09, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x64, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0xB8, 0x0B,
-    0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0xF4, 0x0B, 0x80, 0x00, 0xFD, 0x02, 0xD0, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xBF, 0xC0, 0x3C,
-    0x00, 0x7D, 0xE0, 0x1F, 0x00, 0x3C, 0xB8, 0x0B, 0x80, 0x3D, 0x3D, 0x03, 0xD0, 0x2E, 0x0F, 0x00,
-    0xF0, 0x1F, 0x03, 0xC0, 0x3C, 0x0F, 0x01, 0xE0, 0x1E, 0x0F, 0x40, 0xB4, 0x0B, 0x4B, 0x80, 0x3D,
-    0x03, 0xC7, 0xC0, 0x0F, 0x00, 0xF7, 0xC0, 0x07, 0xC0, 0x7F, 0xD0, 0x01, 0xE0, 0x1F, 0xE0, 0x00,
-    0xB4, 0x0B, 0xE0, 0x00, 0x3F, 0xD3, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x03, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x50, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x0F, 0x07, 0xC0, 0x07,
-    0xC2, 0xE0, 0x01, 0xE0, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x1F, 0x07, 0x80, 0x0F,
-    0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4, 0x1F, 0xEF, 0x6F, 0xC2, 0xFF, 0x4F, 0xF0, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x06, 0x40, 0x00, 0xF0,
-    0x00, 0x01, 0xE0, 0x00, 0x1B, 0xFA, 0x80, 0x3F, 0xFF, 0xC0, 0x17, 0xD5, 0x00, 0x07, 0xC0, 0x00,
-    0x0B, 0x80, 0x00, 0x0F, 0x94, 0x00, 0x0F, 0xFF, 0xE0, 0x0F, 0xAB, 0xF8, 0x1F, 0x00, 0xBC, 0x2E,
-    0x00, 0x3D, 0x3D, 0x00, 0x3D, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0xBC, 0x7C, 0x06, 0xF4, 0xBF, 0xFF,
-    0xD0, 0xFF, 0xF9, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3D, 0x00, 0x0F, 0xFF, 0xD0, 0x2F,
-    0xEA, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF1, 0xF0, 0x07, 0xD7, 0xC0, 0x0B, 0x5E, 0x00, 0x3D,
-    0x7C, 0x01, 0xF0, 0xFE, 0xBF, 0x40, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x1F,
-    0xFF, 0xF0, 0x02, 0xE0, 0x1F, 0x80, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3C,
-    0x0B, 0x80, 0x07, 0xC0, 0xB8, 0x3C, 0xF8, 0x0F, 0x42, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xF4, 0x02, 0xE0, 0x07, 0xC0, 0x3D, 0x00, 0x20, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x10, 0x1A, 0x00, 0x02, 0xC7,
-    0xFF, 0x00, 0x0F, 0x79, 0x7F, 0x00, 0x3F, 0x40, 0x3C, 0x01, 0xF8, 0x00, 0xF0, 0x07, 0xC0, 0x03,
-    0xC0, 0x2E, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xF0, 0x1F, 0x01, 0x0F, 0x40,
-    0xBC, 0x3C, 0x7C, 0x03, 0xF8, 0x7F, 0xD0, 0x0F, 0x7E, 0xFE, 0x00, 0x3C, 0x7F, 0xF0, 0x01, 0xF0,
-    0x02, 0xD0, 0x0B, 0x80, 0x03, 0x80, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF4, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x55,
-    0xB8, 0x02, 0xFF, 0xF4, 0x03, 0xD5, 0x50, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00,
-    0x0B, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xFD, 0x00,
-    0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x55, 0x54, 0x0B, 0xFF, 0xE0, 0x3E, 0x55, 0x00,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x06, 0xFE, 0x90, 0x3F, 0xFF, 0x80, 0x0F, 0x00, 0x00,
-    0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x03, 0xFF, 0xFC, 0x01, 0xF0,
-    0x1F, 0xC0, 0xB8, 0x00, 0xF8, 0x3D, 0x00, 0x2F, 0x0F, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0xF1, 0xF0,
-    0x00, 0x3C, 0xB8, 0x00, 0x1F, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0xFC, 0x03, 0xEB, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x54, 0x0B, 0xFF, 0xE0, 0x3E, 0x55, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00,
-    0x00, 0xBE, 0xE0, 0x03, 0xFF, 0xF4, 0x0F, 0x47, 0xF0, 0x7C, 0x03, 0xD2, 0xE0, 0x0B, 0x8F, 0x40,
-    0x2E, 0x3C, 0x00, 0xB8, 0xF0, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00,
-    0x2F, 0x01, 0xFF, 0xF4, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3D,
-    0x00, 0x2F, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x7C, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0xB8,
-    0x0F, 0xC0, 0x00, 0x03, 0xD0, 0xB4, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0xF0, 0xBC, 0x00, 0x00, 0x00,
-    0xF4, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xEF, 0x00, 0x00, 0x00, 0x02, 0xF3, 0xCF, 0x40, 0x00, 0x00, 0x0B, 0xC3, 0xC7,
-    0xC0, 0x00, 0x00, 0x1F, 0x47, 0x83, 0xD0, 0x00, 0x00, 0x7D, 0x0B, 0x41, 0xF0, 0x00, 0x00, 0xF8,
-    0x0F, 0x40, 0xF4, 0x00, 0x03, 0xE0, 0x0F, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x3F, 0xD0,
-    0x3F, 0x00, 0x1E, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x02, 0xA0, 0x00, 0x50, 0x01, 0xA4, 0x0F, 0xF8, 0x03, 0xC0, 0x7F, 0xE0,
-    0x12, 0xF0, 0x1E, 0x07, 0xE4, 0x00, 0x03, 0xE0, 0xB4, 0x3E, 0x00, 0x00, 0x0B, 0xC3, 0xC2, 0xF0,
-    0x00, 0x00, 0x1F, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0x7E, 0xBE, 0xBC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0x4B, 0x4B, 0xC0, 0x00, 0x00, 0x3C, 0x3C, 0x1F, 0x00, 0x00, 0x03, 0xE0,
-    0xF0, 0x7C, 0x00, 0x00, 0x2F, 0x03, 0x80, 0xF4, 0x00, 0x2B, 0xF4, 0x1E, 0x02, 0xFA, 0x81, 0xFF,
-    0x00, 0xB4, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x80, 0x04, 0x00, 0xBC,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x6F, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x6A, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x10, 0x00, 0xBE, 0x03, 0xFE, 0xFF,
-    0x80, 0x2F, 0xFF, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x69, 0x00, 0x3F, 0xFF, 0x40,
-    0xA4, 0x7F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0xFA, 0xBF, 0x42, 0xFF, 0xF4,
-    0x00, 0x1D, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x02, 0xFC, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xF0, 0x02, 0xF0, 0x02, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x2F,
-    0x00, 0x03, 0xC0, 0xBC, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x0B, 0x8B, 0xC0, 0x00, 0x0B, 0x9F, 0x00,
-    0x00, 0x0F, 0xBC, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x1F, 0x3D, 0x00, 0x00, 0x2E, 0x1F, 0x00,
-    0x00, 0x3D, 0x0F, 0x80, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0xF8,
-    0x00, 0xB8, 0x00, 0x7F, 0xC0, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x50, 0x05,
-    0x40, 0x2E, 0x01, 0xF4, 0x03, 0xD0, 0x7D, 0x00, 0x3C, 0x1F, 0x40, 0x07, 0xC7, 0xD0, 0x00, 0xB9,
-    0xF4, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0x3D, 0x00, 0x01, 0xF1, 0xF0, 0x00,
-    0x2E, 0x0B, 0x80, 0x03, 0xD0, 0x3D, 0x00, 0x3C, 0x01, 0xFF, 0x03, 0xC0, 0x0F, 0xF0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0xF0, 0x00, 0xB8, 0x01, 0xF0, 0x02, 0xF0, 0x02, 0xE0, 0x0B, 0xC0, 0x03, 0xD2, 0xAF, 0x00,
-    0x03, 0xC3, 0xFC, 0x00, 0x07, 0xC7, 0xF0, 0x00, 0x0B, 0x8B, 0xC0, 0x00, 0x0B, 0x6F, 0x00, 0x00,
-    0x0F, 0xBF, 0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x1F, 0x3D, 0x00, 0x00, 0x2E, 0x2F, 0x00, 0x00,
-    0x3D, 0x3F, 0x80, 0x00, 0x3C, 0x3F, 0xD0, 0x00, 0x3C, 0x16, 0xF0, 0x00, 0x7C, 0x00, 0xF8, 0x00,
-    0xB8, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x50, 0x01, 0x40, 0x2E, 0x10, 0xF8, 0x03,
-    0xDB, 0x3E, 0x00, 0x3C, 0xBF, 0x40, 0x07, 0xCF, 0xD0, 0x00, 0xB9, 0xF4, 0x00, 0x0B, 0xBD, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0x3D, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0x2E, 0x3F, 0x80, 0x03, 0xD7,
-    0x3D, 0x00, 0x3C, 0xB1, 0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xE0, 0x02,
-    0xF0, 0x1B, 0xF9, 0x0B, 0xC0, 0x2F, 0xFE, 0x2F, 0x00, 0x17, 0xD4, 0xBC, 0x00, 0x07, 0xC2, 0xF0,
-    0x00, 0x0B, 0x8B, 0xC0, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x0F, 0xB8, 0x00,
-    0x00, 0x1F, 0x3D, 0x00, 0x00, 0x2E, 0x1F, 0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x3C, 0x07, 0xC0,
-    0x00, 0x3C, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3E,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x1E, 0x00, 0x54, 0x02, 0xE0, 0x1F, 0x40, 0x3D, 0x07, 0xD0, 0x03, 0xC1, 0xF4,
-    0x00, 0x7C, 0x7D, 0x00, 0x07, 0x8F, 0x40, 0x00, 0xBB, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xF3,
-    0xE0, 0x00, 0x1F, 0x1F, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x3D, 0x03, 0xE0, 0x03, 0xC0, 0x1F, 0x00,
-    0x3C, 0x00, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x2E, 0x2F, 0xFE, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x3F,
-    0x00, 0x03, 0xC0, 0x3F, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x2E, 0x2F,
-    0x00, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xB8,
-    0xF0, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x01,
-    0xF0, 0x0F, 0x80, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x03, 0xE0,
-    0x00, 0x15, 0x55, 0x00, 0x14, 0x3F, 0xFE, 0x01, 0xF4, 0x15, 0x7D, 0x07, 0xD0, 0x00, 0x3C, 0x1F,
-    0x40, 0x00, 0x7C, 0x3D, 0x00, 0x00, 0x78, 0xF4, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xF3, 0xD0, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x02, 0xD0, 0x3D,
-    0x00, 0x03, 0xC0, 0x1F, 0x00, 0x03, 0xC0, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x7C, 0x00,
-    0x07, 0xC0, 0x2E, 0x00, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0,
-    0x00, 0x0F, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x2E, 0x55, 0x56, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x03,
-    0xEA, 0xAA, 0xBC, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x02, 0xD0,
-    0x0F, 0x00, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B,
-    0xF8, 0x3D, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x50, 0x00, 0x50, 0x0B,
-    0x80, 0x03, 0xC0, 0x3D, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x03, 0xD0, 0x1E, 0x00,
-    0x0F, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x3D,
-    0x02, 0xE0, 0x00, 0xF0, 0x0F, 0x40, 0x07, 0xC0, 0x3C, 0x00, 0x1F, 0xD0, 0xF0, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x78, 0x00, 0x07, 0xFF, 0xC0, 0x2E, 0x00,
-    0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00,
-    0x1F, 0x00, 0x00, 0xB8, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x55, 0x57, 0xE0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x03, 0xEA, 0xAA, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x0B,
-    0x80, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x3C,
-    0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x55, 0x50, 0x0B, 0x80, 0x03, 0xFF, 0xD0, 0x3D, 0x00, 0x1F, 0x55,
-    0x00, 0xF0, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x00, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x3D,
-    0x00, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00,
-    0xF0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x02, 0xE0, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00,
-    0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x00, 0xB4, 0x00, 0x0F, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0xFB, 0xE4, 0x00, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0x00, 0x02, 0xE0,
-    0x2F, 0x82, 0xE0, 0x00, 0x3D, 0x00, 0x7D, 0x3D, 0x00, 0x03, 0xC0, 0x03, 0xE3, 0xC0, 0x00, 0x7C,
-    0x00, 0x2F, 0x3C, 0x00, 0x07, 0xC0, 0x01, 0xF7, 0xC0, 0x00, 0xB8, 0x00, 0x1F, 0xB8, 0x00, 0x0F,
-    0x40, 0x02, 0xFF, 0x40, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x07, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x50, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x3E, 0x55, 0x7D, 0x00, 0x00, 0xF0, 0x00,
-    0xF0, 0x00, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x00, 0xB4, 0x00, 0xBE, 0xE0,
-    0x03, 0xD0, 0x03, 0xFF, 0xF4, 0x0F, 0x00, 0x0F, 0x43, 0xF0, 0x7C, 0x00, 0x7C, 0x03, 0xD2, 0xE0,
-    0x02, 0xE0, 0x0B, 0x8F, 0x40, 0x0B, 0x40, 0x1F, 0x3C, 0x00, 0x3D, 0x00, 0x7C, 0xF0, 0x00, 0xF0,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x01, 0x50, 0x02, 0xF0, 0x03, 0xFF, 0x00, 0xF4, 0x03, 0xF7,
-    0xE0, 0x7C, 0x02, 0xF0, 0x7C, 0x3E, 0x00, 0xF4, 0x0F, 0x0F, 0x40, 0x7C, 0x07, 0xC3, 0xD0, 0x2E,
-    0x01, 0xF0, 0xF0, 0x0B, 0x80, 0xBC, 0x3C, 0x03, 0xE0, 0x3E, 0x0F, 0x40, 0xF8, 0x1F, 0x43, 0xE0,
-    0x2E, 0x0F, 0xC0, 0xBC, 0x07, 0xCB, 0xC0, 0x0F, 0xC0, 0xFF, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40,
-    0x00, 0xBF, 0xF0, 0x00, 0xFD, 0x04, 0x00, 0x7C, 0x01, 0xA0, 0x3D, 0x03, 0xFF, 0x1F, 0x02, 0xF6,
-    0xEB, 0x80, 0xF0, 0x7E, 0xE0, 0x7C, 0x1F, 0xF4, 0x2E, 0x0B, 0xBD, 0x0B, 0x83, 0xDB, 0x82, 0xF2,
-    0xF1, 0xF4, 0x3E, 0xF0, 0x2F, 0xAF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0x80, 0x08, 0x02, 0xF0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xFB,
-    0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x07,
-    0xFF, 0xD0, 0x7E, 0x46, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E,
-    0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xAB, 0x80,
-    0x2F, 0xFD, 0x00, 0x0E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x01, 0xFC, 0x00,
-    0x01, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x40,
-    0xA8, 0x01, 0xA4, 0x00, 0xB1, 0xFF, 0xC2, 0xFF, 0xC0, 0x3D, 0xE5, 0xF6, 0xD1, 0xF4, 0x0F, 0xD0,
-    0x2F, 0xC0, 0x3D, 0x07, 0xE0, 0x0B, 0xD0, 0x0F, 0x41, 0xF0, 0x02, 0xF0, 0x03, 0xD0, 0xB8, 0x00,
-    0xF4, 0x00, 0xF0, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x07, 0xC0, 0x0B,
-    0x80, 0x0F, 0x42, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x3C,
-    0x00, 0x3E, 0x8F, 0x00, 0x1F, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0x90, 0xB8, 0x00, 0x0B, 0x87, 0xC0, 0x01, 0xF0, 0x3C, 0x00, 0x3D, 0x03, 0xD0, 0x0B, 0x80,
-    0x2E, 0x01, 0xF0, 0x01, 0xF0, 0x3D, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0xF5, 0xF0, 0x00, 0x0B, 0xBD,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x50, 0x00, 0x05, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0xBC, 0x7C, 0x00, 0xF0, 0x7C, 0x02, 0xE0,
-    0x3C, 0x03, 0xC0, 0x3C, 0x0F, 0x80, 0x3C, 0x1F, 0x00, 0x2D, 0x3D, 0x00, 0x2D, 0x7C, 0x00, 0x1E,
-    0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x02,
-    0xE0, 0x7C, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0xF4, 0x03, 0xD0, 0x0B, 0x80, 0x0B, 0x80, 0x7C, 0x00,
-    0x1F, 0x03, 0xD0, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x50, 0xB8, 0x00, 0x3D, 0x0B, 0x80, 0x0B, 0xC0, 0x7C, 0x00, 0xF0, 0x07,
-    0xC0, 0x2E, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0xC0, 0xF8, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xD3, 0xD0,
-    0x00, 0x2D, 0x7C, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x3F, 0xFF, 0xD0, 0x02, 0xBF, 0xA8, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0x0B, 0x82, 0xF0, 0x00, 0x00, 0x3C,
-    0x7C, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xF2, 0xD0, 0x00, 0x00, 0x3D, 0x1F,
-    0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x0F,
-    0x40, 0x03, 0xFC, 0x03, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x50, 0x00, 0x50, 0x03, 0xC0, 0x0F, 0x80, 0x0B, 0x80, 0xBC, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0x2D,
-    0x7C, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x02, 0xF7, 0xC0, 0x00, 0x1F, 0x0F, 0x40, 0x00, 0xF4, 0x1F, 0x00, 0x0F, 0x40, 0x3F, 0xC0,
-    0xF8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x01, 0x90, 0x00, 0x7F, 0xFF, 0xFF, 0x82, 0xDB, 0xFF, 0xFF, 0xF4, 0x3D,
-    0x00, 0x3D, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x0B, 0x80,
-    0x00, 0xF4, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x1F, 0x00,
-    0x1F, 0x00, 0x02, 0xE0, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x15,
-    0x55, 0x50, 0x52, 0xFF, 0xFF, 0xC3, 0xD5, 0x6F, 0x55, 0x0F, 0x00, 0x7C, 0x00, 0x3C, 0x02, 0xE0,
-    0x01, 0xF0, 0x0F, 0x40, 0x0B, 0x80, 0x3C, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0xF0, 0x07, 0x80, 0x07,
-    0xC0, 0x2E, 0x00, 0x3E, 0x00, 0xF4, 0x02, 0xF4, 0x02, 0xE0, 0x2F, 0xD0, 0x07, 0xEB, 0xDF, 0xE0,
-    0x0B, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x28, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x2E, 0x00, 0x07, 0xC0, 0xF4,
-    0x00, 0x2E, 0x03, 0xC0, 0x00, 0xF4, 0x1F, 0x00, 0x03, 0xD0, 0xB8, 0x00, 0x0F, 0x03, 0xD0, 0x00,
-    0x7C, 0x0F, 0x40, 0x02, 0xE0, 0x3D, 0x00, 0x0F, 0x40, 0xFD, 0x06, 0xFC, 0x01, 0xFF, 0xFF, 0xF0,
-    0x01, 0xBE, 0x47, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0x90, 0x00, 0x05, 0x00,
-    0x05, 0x07, 0xC0, 0x03, 0xC2, 0xE0, 0x01, 0xF0, 0xB4, 0x00, 0xB8, 0x3D, 0x00, 0x3D, 0x0F, 0x00,
-    0x2F, 0x03, 0xD0, 0x2F, 0xC0, 0xFE, 0xBE, 0xF0, 0x0F, 0xFD, 0xB8, 0x00, 0x50, 0x3D, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0A, 0x00, 0x07, 0x80, 0x00, 0xF0,
-    0x2E, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x2E, 0x03, 0xC0, 0x00, 0xF4, 0x1F, 0x00, 0x03, 0xD0, 0xB8,
-    0x14, 0x0F, 0x03, 0xD0, 0xF0, 0x7C, 0x0F, 0x43, 0x82, 0xE0, 0x3D, 0x1D, 0x0F, 0x40, 0xFD, 0xBA,
-    0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x47, 0xC0, 0x00, 0x38, 0x2E, 0x00, 0x01, 0xD0, 0xF4,
-    0x00, 0x0B, 0x03, 0xC0, 0x00, 0x14, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x05, 0x00, 0x05, 0x07, 0xC0, 0x03, 0xC2, 0xE0, 0x01, 0xF0, 0xB4, 0x00, 0xB8, 0x3D, 0x2C, 0x3D,
-    0x0F, 0x0E, 0x2F, 0x03, 0xD3, 0x5F, 0xC0, 0xFE, 0xFE, 0xF0, 0x0F, 0xFD, 0xB8, 0x00, 0x7C, 0x3D,
-    0x00, 0x0E, 0x0F, 0x00, 0x03, 0x47, 0xC0, 0x00, 0x42, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0B, 0x81, 0xA8, 0x00, 0xBF, 0xFF, 0xF4, 0x0F, 0xF9, 0x5F, 0xC0, 0xF0, 0x00,
-    0x3D, 0x1F, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x3C, 0x3D, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0xB8, 0x3C,
-    0x00, 0x0F, 0x47, 0xC0, 0x00, 0xF0, 0xB8, 0x00, 0x1F, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E,
-    0x06, 0x80, 0x02, 0xD7, 0xFF, 0x40, 0x3E, 0xE5, 0xBC, 0x03, 0xF4, 0x03, 0xC0, 0x7E, 0x00, 0x3C,
-    0x0B, 0xC0, 0x07, 0xC0, 0xB8, 0x00, 0xB8, 0x0F, 0x40, 0x0F, 0x40, 0xF0, 0x00, 0xF0, 0x1F, 0x00,
-    0x0F, 0x02, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x2E, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0x40, 0x7E, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0x28, 0x7C, 0x00, 0x02, 0xF7,
-    0x8F, 0x80, 0x00, 0xBD, 0x78, 0xF4, 0x01, 0xBF, 0x87, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFA,
-    0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x18, 0x00, 0x03, 0xFF, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0xFD, 0x2F, 0x00, 0x0B, 0xC0, 0x3D, 0x3C, 0x3C, 0x00, 0xF0, 0xF2, 0xE0, 0x1F,
-    0x83, 0xEF, 0xAB, 0xF8, 0x07, 0xFF, 0xFE, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x7F, 0xAF, 0x80, 0x00, 0x7F, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0x40, 0x7E, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0x28, 0x7C,
-    0x00, 0x02, 0xF7, 0x8F, 0x80, 0x00, 0xBD, 0x78, 0xF4, 0x01, 0xBF, 0x87, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xFA, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x18, 0x00,
-    0x03, 0xFF, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x40, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFD, 0x2F, 0x00, 0x0B, 0xC0, 0x3D, 0x3C, 0x3C,
-    0x00, 0xF0, 0xF2, 0xE0, 0x1F, 0x83, 0xEF, 0xAB, 0xF8, 0x07, 0xFF, 0xFE, 0x40, 0x01, 0xF0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x7F, 0xAF, 0x80,
-    0x00, 0x7F, 0xF9, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0xF0, 0x00,
-    0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00,
-    0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00,
-    0x00, 0xF0, 0x00, 0x1B, 0xE4, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0B, 0x80, 0x00,
-    0xF0, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0xF0, 0x07, 0xD0, 0x00, 0x03, 0xC0, 0x3C, 0x03,
-    0xD0, 0x00, 0x00, 0xB4, 0x1F, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x0B, 0x83, 0xE0, 0x00, 0x00, 0x03,
-    0xD3, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0xF6, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x8B, 0x8F, 0x40, 0x00, 0x00, 0x0F, 0xC3,
-    0xD1, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0xF0, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x0B, 0x80, 0x00,
-    0x07, 0xD0, 0x2E, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0x03, 0xE0, 0x03, 0xC0,
-    0x07, 0xC0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x50, 0x00, 0x64, 0x03, 0xFD, 0x00,
-    0xF4, 0x0B, 0xFC, 0x01, 0x2F, 0x00, 0xF0, 0x2F, 0x54, 0x00, 0x0F, 0x41, 0xF0, 0x3C, 0x00, 0x00,
-    0x0B, 0x81, 0xE0, 0xB4, 0x00, 0x00, 0x07, 0x82, 0xD0, 0xF0, 0x00, 0x00, 0x0B, 0xEB, 0xEA, 0xF0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x47, 0xC3, 0xD0, 0x00, 0x00, 0x1F, 0x0B,
-    0x82, 0xD0, 0x00, 0x00, 0x2E, 0x0B, 0x42, 0xE0, 0x00, 0x00, 0x7C, 0x0F, 0x01, 0xF0, 0x00, 0x2B,
-    0xF0, 0x0F, 0x00, 0xFE, 0x80, 0x3F, 0xC0, 0x1E, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xF0, 0x02, 0xF0, 0x02, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x2F,
-    0x00, 0x03, 0xC0, 0xBC, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x0B, 0x8B, 0xC0, 0x00, 0x0B, 0x6F, 0x00,
-    0x00, 0x0F, 0xBE, 0x40, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x1F, 0x96, 0xFD, 0x00, 0x2E, 0x00, 0x2F,
-    0x00, 0x3D, 0x00, 0x0F, 0x40, 0x3C, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x0B,
-    0xC0, 0xB8, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xBF, 0xE0, 0x00, 0x1F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x40, 0x2E, 0x01, 0xF4, 0x03, 0xD0, 0x7D, 0x00,
-    0x3C, 0x1F, 0x40, 0x07, 0xC7, 0xD0, 0x00, 0xB9, 0xF4, 0x00, 0x0B, 0xBE, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x0F, 0x42, 0xF4, 0x01, 0xF0, 0x0B, 0xC0, 0x2E, 0x00, 0x3C, 0x03, 0xD0, 0x03, 0xD0, 0x3C,
-    0x00, 0x3D, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF4,
-    0x00, 0x40, 0x7F, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x0B, 0xC0, 0x00, 0x1F, 0x00,
-    0xB8, 0x00, 0x02, 0xD0, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00,
-    0xB8, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x3C,
-    0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x0B, 0x80, 0x00, 0xF4,
-    0x00, 0xF4, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0xAF, 0xD0, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x2F, 0xE0,
-    0x10, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x2F, 0x5F, 0x40, 0x01, 0xF0, 0x3C, 0x00, 0x0B, 0x80, 0xF0, 0x00, 0x3C, 0x07, 0xC0, 0x01, 0xE0,
-    0x2E, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x3C, 0x03, 0xC0, 0x02, 0xE0, 0x0F, 0x00, 0x0F, 0x00, 0x7C,
-    0x00, 0xB8, 0x02, 0xE0, 0x3F, 0xC0, 0x0F, 0xF4, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0xF4,
-    0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x2E, 0x55, 0x56,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xEA, 0xAA, 0xBC, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00,
-    0x0B, 0x80, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x0B, 0x80,
-    0x03, 0xC0, 0x3D, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x03, 0xD0, 0x1E, 0x00, 0x0F,
-    0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x3D, 0x02,
-    0xE0, 0x00, 0xF0, 0x0F, 0x40, 0x07, 0xC0, 0x3C, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x04, 0x0B, 0xC0, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x7C, 0x00,
-    0x07, 0xC0, 0x2E, 0x00, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0,
-    0x00, 0x0F, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x2E, 0x55, 0x56, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x03,
-    0xEA, 0xAA, 0xBC, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x02, 0xD0,
-    0x0F, 0x00, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B,
-    0xFC, 0x3D, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x50, 0x00, 0x50, 0x0B,
-    0x80, 0x03, 0xC0, 0x3D, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x03, 0xD0, 0x1E, 0x00,
-    0x0F, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x3D,
-    0x02, 0xE0, 0x00, 0xF0, 0x0F, 0x40, 0x07, 0xC0, 0x3C, 0x00, 0x1F, 0xE0, 0xF0, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x2E, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x2E, 0x03, 0xC0,
-    0x00, 0xF4, 0x1F, 0x00, 0x03, 0xD0, 0xB8, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x7C, 0x0F, 0x40, 0x02,
-    0xE0, 0x3D, 0x00, 0x0F, 0x40, 0xFD, 0x06, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xBE, 0x47, 0xC0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x14, 0x00, 0x05, 0x3D, 0x00, 0x2E,
-    0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x3C, 0x7C, 0x00, 0xBC, 0xB8, 0x00, 0xF8, 0xBC, 0x03, 0xF8, 0x7E,
-    0x6F, 0xF4, 0x2F, 0xF8, 0xF0, 0x01, 0x41, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x2F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xA0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0,
-    0x00, 0x2F, 0xE0, 0x0F, 0xB4, 0x00, 0x0F, 0xB4, 0x03, 0xDD, 0x00, 0x0B, 0x7C, 0x01, 0xE7, 0x80,
-    0x03, 0xCF, 0x00, 0xB8, 0xE0, 0x03, 0xD7, 0xC0, 0x3D, 0x3C, 0x01, 0xE2, 0xE0, 0x0F, 0x0F, 0x00,
-    0xF0, 0xF4, 0x03, 0xC3, 0xC0, 0x78, 0x3C, 0x01, 0xE0, 0xB0, 0x3C, 0x1F, 0x00, 0xB4, 0x2D, 0x2E,
-    0x07, 0x80, 0x3D, 0x07, 0x4F, 0x02, 0xE0, 0x0F, 0x01, 0xEB, 0x40, 0xF4, 0x07, 0xC0, 0x7F, 0xC0,
-    0x3C, 0x01, 0xE0, 0x0F, 0xD0, 0x1F, 0x00, 0xB4, 0x03, 0xF0, 0x0B, 0xFC, 0x3C, 0x00, 0xF0, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x50, 0x00, 0x05,
-    0x40, 0xBE, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x07, 0xF4, 0x0E, 0xF0, 0x03, 0xFC, 0x07, 0xBC, 0x01,
-    0xDF, 0x01, 0xDB, 0x00, 0xF3, 0xC0, 0xB2, 0xC0, 0xB5, 0xE0, 0x3C, 0x74, 0x3C, 0xB4, 0x0F, 0x1D,
-    0x2C, 0x3C, 0x07, 0x83, 0x8E, 0x0F, 0x02, 0xD0, 0xEB, 0x07, 0x80, 0xF0, 0x3F, 0x81, 0xE0, 0x3C,
-    0x0F, 0xC0, 0xBF, 0x0F, 0x02, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0xBF, 0xF4,
-    0x01, 0xFF, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x1B, 0xE4, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0xF0, 0x0F, 0x00, 0x00, 0x2E, 0x1F, 0x40, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x0F,
-    0x0B, 0x40, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x07, 0xC0, 0x78, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x01,
-    0xFA, 0xAB, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7D, 0x55, 0x7C, 0x00, 0x3D, 0x00, 0x0F, 0x40,
-    0x2F, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0xB8, 0x0B, 0xC0, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x07,
-    0xC0, 0x00, 0x24, 0x06, 0x00, 0x1E, 0x03, 0xC0, 0x03, 0xEB, 0xD0, 0x00, 0x2F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x50, 0x1F, 0xFD, 0x78, 0x1F, 0x96, 0xFD, 0x0F, 0x40, 0x3F, 0x0B, 0xC0,
-    0x0B, 0xC3, 0xD0, 0x02, 0xE1, 0xF0, 0x00, 0xB8, 0xB8, 0x00, 0x3D, 0x2E, 0x00, 0x1F, 0x0F, 0x40,
-    0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4, 0x0F, 0xEF, 0x6C, 0x01, 0xFF, 0x4F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03,
-    0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E,
-    0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0,
-    0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x0B, 0x80, 0x03, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x50, 0x1F, 0xFD, 0x78, 0x1F, 0x96, 0xFD, 0x0F, 0x40, 0x3F, 0x0B, 0xC0, 0x0B, 0xC3, 0xD0,
-    0x02, 0xE1, 0xF0, 0x00, 0xB8, 0xB8, 0x00, 0x3D, 0x2E, 0x00, 0x1F, 0x0F, 0x40, 0x0F, 0xC2, 0xE0,
-    0x07, 0xE0, 0xBC, 0x07, 0xF4, 0x0F, 0xEF, 0x6C, 0x01, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xCF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x3D, 0x55, 0x40, 0x00,
-    0x07, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x0F, 0x40, 0x7E, 0xAA, 0x80, 0x00, 0x2F, 0xAA, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x01,
-    0xF0, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x02, 0xE0, 0x00, 0x00, 0x1F,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3D, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x2A, 0x01, 0x0A, 0x80,
-    0x07, 0xFF, 0x3E, 0xFF, 0xD0, 0x7E, 0x5E, 0xFE, 0x4B, 0xC3, 0xD0, 0x1F, 0xE0, 0x1F, 0x2E, 0x00,
-    0x3F, 0x00, 0x7C, 0xF4, 0x00, 0xF4, 0x07, 0xD7, 0xC0, 0x03, 0xEB, 0xFD, 0x2E, 0x00, 0x1F, 0xFF,
-    0x80, 0xB8, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x3F, 0xC0, 0x00, 0x2F,
-    0x02, 0xFF, 0x40, 0x10, 0x3F, 0xBD, 0xFF, 0xEB, 0xD0, 0x7F, 0x87, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0xC0, 0x01, 0xE0, 0xB8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2E, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x95, 0x50,
-    0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xAA, 0xA4, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x60, 0x0A, 0x00, 0x2D, 0x07, 0x80, 0x07, 0xEB, 0xC0, 0x00, 0x6F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0x87, 0xE0, 0x0F, 0x40,
-    0x78, 0x0B, 0x80, 0x2E, 0x03, 0xC0, 0x2F, 0x01, 0xFA, 0xFF, 0x40, 0xBF, 0xFE, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x0F, 0xEA, 0xF0, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x5A, 0xAF, 0xE0, 0x2F, 0xFF, 0xFF, 0x4B, 0xF9,
-    0x40, 0x7C, 0x7E, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0xBC, 0x3D, 0x00, 0x0B,
-    0xC0, 0xFC, 0x00, 0xBD, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x0B, 0xFF, 0xE0, 0x0A, 0x42, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x16, 0xBC, 0x03, 0xFF, 0xFC, 0x1F, 0xD4, 0xB8, 0x3D, 0x00, 0xF4, 0x7C, 0x01,
-    0xF0, 0x7C, 0x07, 0xD0, 0x3F, 0xBF, 0x40, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x0F, 0x00, 0x00, 0xB4, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x5A,
-    0xAF, 0xE0, 0x2F, 0xFF, 0xFF, 0x4B, 0xF9, 0x40, 0x7C, 0x7E, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x0F,
-    0x4F, 0x40, 0x00, 0xBC, 0x3D, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0xBD, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x78, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x0B, 0xFF, 0xE0, 0x0A, 0x42, 0xF4, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x16, 0xBC, 0x03, 0xFF, 0xFC, 0x1F, 0xD4,
-    0xB8, 0x3D, 0x00, 0xF4, 0x7C, 0x01, 0xF0, 0x7C, 0x07, 0xD0, 0x3F, 0xBF, 0x40, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0B, 0x80, 0x00, 0xF0, 0x03, 0xD0, 0x07, 0xC0, 0x00,
-    0x2E, 0x00, 0xF0, 0x07, 0xD0, 0x00, 0x03, 0xC0, 0x3C, 0x03, 0xD0, 0x00, 0x00, 0xB4, 0x1F, 0x03,
-    0xE0, 0x00, 0x00, 0x1F, 0x0B, 0x83, 0xE0, 0x00, 0x00, 0x03, 0xD3, 0xD2, 0xF0, 0x00, 0x00, 0x00,
-    0x7D, 0xF6, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xBC, 0x00,
-    0x00, 0x00, 0x0F, 0x8B, 0x8F, 0x40, 0x00, 0x00, 0x0F, 0xC3, 0xD1, 0xF0, 0x00, 0x00, 0x0B, 0xC0,
-    0xF0, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x0B, 0x80, 0x00, 0x07, 0xD0, 0x2E, 0x00, 0xF0, 0x00,
-    0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xF0,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA0, 0x00, 0x50, 0x00, 0x64, 0x03, 0xFD, 0x00, 0xF4, 0x0B, 0xFC, 0x01, 0x2F, 0x00,
-    0xF0, 0x2F, 0x54, 0x00, 0x0F, 0x41, 0xF0, 0x3C, 0x00, 0x00, 0x0B, 0x81, 0xE0, 0xB4, 0x00, 0x00,
-    0x07, 0x82, 0xD0, 0xF0, 0x00, 0x00, 0x0B, 0xEB, 0xEA, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x0F, 0x47, 0xC3, 0xD0, 0x00, 0x00, 0x1F, 0x0B, 0x82, 0xD0, 0x00, 0x00, 0x2E, 0x0B,
-    0x42, 0xE0, 0x00, 0x00, 0x7C, 0x0F, 0x01, 0xF0, 0x00, 0x2B, 0xF0, 0x0F, 0x00, 0xFE, 0x80, 0x3F,
-    0xC0, 0x1E, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x2D, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0x80, 0x04, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x6F, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x6A, 0xF8, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02,
-    0xF0, 0x10, 0x00, 0xBE, 0x03, 0xFE, 0xFF, 0x80, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC1, 0xE0, 0x0F, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00,
-    0xFF, 0xFD, 0x02, 0x91, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0xBF, 0xE0,
-    0x03, 0xFF, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC3, 0xEA, 0xFD,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0A, 0xBF, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x08, 0x00, 0x1F, 0xC0, 0xFE, 0xAF,
-    0xF0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x0F, 0xFF, 0xFC,
-    0x00, 0x55, 0x5F, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0xF8, 0x05, 0x00, 0x3F, 0x00, 0xBF, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x7C, 0x00, 0xB8, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x03, 0xFC, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0x1F,
-    0x00, 0x2E, 0xB4, 0x02, 0xE0, 0x07, 0xCF, 0x00, 0x2E, 0x00, 0xF0, 0xF0, 0x03, 0xD0, 0x3D, 0x1E,
-    0x00, 0x3C, 0x0B, 0x82, 0xE0, 0x07, 0xC1, 0xF0, 0x3D, 0x00, 0xB8, 0x3C, 0x03, 0xC0, 0x0F, 0x4F,
-    0x40, 0x7C, 0x00, 0xF2, 0xE0, 0x0B, 0x80, 0x0F, 0x7C, 0x00, 0xF4, 0x01, 0xFF, 0x00, 0x0F, 0x00,
-    0x2F, 0xD0, 0x00, 0xF0, 0x03, 0xF4, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x05, 0x0F, 0x40, 0x0B, 0x83, 0xC0,
-    0x03, 0xD0, 0xF0, 0x00, 0xF0, 0x7C, 0x00, 0x7C, 0x2E, 0x00, 0x1E, 0x0F, 0x40, 0x0B, 0x83, 0xC0,
-    0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x78, 0x00, 0xFC, 0x2E, 0x00, 0x7E, 0x0B, 0xC0, 0x7F, 0x41, 0xFE,
-    0xF6, 0xC0, 0x2F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x83, 0xC0, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x03, 0xFC, 0x00, 0xF0, 0x00,
-    0xFF, 0x80, 0x1F, 0x00, 0x2E, 0xB4, 0x02, 0xE0, 0x07, 0xCF, 0x00, 0x2E, 0x00, 0xF0, 0xF0, 0x03,
-    0xD0, 0x3D, 0x1E, 0x00, 0x3C, 0x0B, 0x82, 0xE0, 0x07, 0xC1, 0xF0, 0x3D, 0x00, 0xB8, 0x3C, 0x03,
-    0xC0, 0x0F, 0x4F, 0x40, 0x7C, 0x00, 0xF2, 0xE0, 0x0B, 0x80, 0x0F, 0x7C, 0x00, 0xF4, 0x01, 0xFF,
-    0x00, 0x0F, 0x00, 0x2F, 0xD0, 0x00, 0xF0, 0x03, 0xF4, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07, 0x80, 0x03, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x50, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x0F, 0x07, 0xC0,
-    0x07, 0xC2, 0xE0, 0x01, 0xE0, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x1F, 0x07, 0x80,
-    0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4, 0x1F, 0xEF, 0x6C, 0x02, 0xFF, 0x4F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0x1F, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00,
-    0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00,
-    0x01, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0,
-    0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0xB4,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC,
-    0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4,
-    0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00,
-    0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43,
-    0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B,
-    0xE5, 0xBC, 0x1F, 0x40, 0x2E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7F, 0xFF, 0xFF, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x2E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00,
-    0x3C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B,
-    0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40,
-    0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01,
-    0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x3C, 0x00, 0xB4, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF,
-    0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x2E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7F, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x2E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F,
-    0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3C, 0x00,
-    0x02, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x50, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0xC0, 0x2E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0xA4, 0x00, 0xFF, 0xFC, 0x02, 0x95, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x0B,
-    0x80, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x07,
-    0xC1, 0xEA, 0xFD, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0xF4,
-    0x00, 0x3E, 0x00, 0x2E, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0xF0, 0x07, 0xC0, 0x00,
-    0x3D, 0x03, 0xD0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0x3C, 0xB4, 0x00,
-    0x00, 0x0B, 0x7C, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00,
-    0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x1D, 0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00,
-    0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x00, 0x7C, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x03,
-    0xD0, 0x0F, 0x40, 0x03, 0xE0, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x0F, 0x00,
-    0x7C, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0xB8, 0x2E, 0x00, 0x00, 0x1F, 0x0F, 0x00, 0x00, 0x03,
-    0xCB, 0x40, 0x00, 0x00, 0xB7, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD1,
-    0xF0, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x05, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02,
-    0xF0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E,
-    0x00, 0x00, 0x1D, 0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x4B, 0x80, 0x00, 0x0B, 0x87, 0xC0, 0x00, 0x07, 0x83, 0x80, 0x00, 0x03,
-    0x42, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x03,
-    0xD0, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x1F, 0x00,
-    0x00, 0xF4, 0x0F, 0x40, 0x00, 0x2E, 0x0B, 0x80, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0x00, 0xF2, 0xD0,
-    0x00, 0x00, 0x2D, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC7,
-    0xC0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x03, 0xC2, 0xC0, 0x00, 0x02, 0x81, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x1F,
-    0x00, 0x3D, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x3C, 0x0B, 0x80, 0x00,
-    0x0F, 0x43, 0xC0, 0x00, 0x02, 0xD2, 0xE0, 0x00, 0x00, 0x74, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00,
-    0x00, 0x03, 0xBC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x1F,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2D, 0x0F, 0x00, 0x03, 0xD1,
-    0xF0, 0x00, 0x3C, 0x2E, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x7C, 0x3C, 0x00, 0x0B, 0x83, 0xC0, 0x00,
-    0xF4, 0x3C, 0x00, 0x0F, 0x03, 0xE0, 0x01, 0xF0, 0x1F, 0xEA, 0xFE, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x14, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0F, 0x00, 0x0F,
-    0x47, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x41, 0xF0, 0x00, 0xF0, 0x7C,
-    0x00, 0x7C, 0x2E, 0x00, 0x2E, 0x0F, 0x40, 0x0F, 0x43, 0xC0, 0x0B, 0xD0, 0xF4, 0x07, 0xF0, 0x3F,
-    0xAF, 0xBC, 0x03, 0xFF, 0x6E, 0x00, 0x15, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x2E, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0x90, 0x00,
-    0x00, 0x00, 0x55, 0x54, 0x0B, 0xFF, 0xE0, 0x3E, 0x55, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1E,
-    0x00, 0x00, 0xB4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00,
-    0x3C, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0B, 0x40,
-    0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x1E, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x00, 0x7C, 0x02, 0xE0, 0x00,
-    0x00, 0xB8, 0x03, 0xFF, 0x90, 0x00, 0xF4, 0x03, 0xFF, 0xFC, 0x00, 0xF0, 0x07, 0xC0, 0x7E, 0x01,
-    0xF0, 0x0B, 0x80, 0x1F, 0x01, 0xE0, 0x0F, 0x40, 0x0F, 0x42, 0xE0, 0x0F, 0x00, 0x0F, 0x03, 0xD0,
-    0x0F, 0x00, 0x1F, 0x03, 0xC0, 0x1F, 0x00, 0x3E, 0x07, 0xC0, 0x2E, 0x01, 0xFC, 0x0B, 0x80, 0x3F,
-    0xFF, 0xF4, 0x0F, 0x40, 0x3F, 0xFF, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0xB4, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x50, 0xB4, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x0F, 0x07,
-    0xC0, 0x00, 0x07, 0xC2, 0xE5, 0x50, 0x02, 0xE0, 0xFF, 0xFF, 0x00, 0xB4, 0x3E, 0x57, 0xF0, 0x3D,
-    0x0F, 0x00, 0x3D, 0x0F, 0x07, 0xC0, 0x0F, 0x47, 0xC1, 0xF0, 0x03, 0xC2, 0xE0, 0x3C, 0x02, 0xF0,
-    0xF4, 0x0B, 0xEB, 0xF4, 0x3C, 0x00, 0xBF, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFD, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x00, 0xBF, 0xFE, 0x00, 0xF9, 0x54, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0,
-    0x00, 0x1B, 0xFA, 0x40, 0x3F, 0xFF, 0x80, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00,
-    0x0F, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xD0, 0x00, 0x03,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x01,
-    0xF0, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0x0B, 0x82, 0xF0, 0x00, 0x00,
-    0x3C, 0x7C, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xF2, 0xD0, 0x00, 0x00, 0x3D,
-    0x1F, 0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x0F, 0x40, 0x03, 0xFC, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x01, 0x40, 0x01, 0x40, 0x2E, 0x00, 0xBC, 0x00, 0xF0, 0x1F, 0x00, 0x0B, 0x43, 0xD0, 0x00, 0x7C,
-    0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0F, 0x3C, 0x00, 0x03, 0xD2, 0xE0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x00, 0xBF, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x3D,
-    0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0x0B, 0x82, 0xF0, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x03,
-    0xEF, 0x00, 0x00, 0x05, 0x6F, 0xF5, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0A, 0xBF, 0xEA, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xF2, 0xD0, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x0F, 0x80,
-    0xF0, 0x00, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x03,
-    0xE0, 0x00, 0x2E, 0x00, 0x01, 0x40, 0x01, 0x40, 0x2E, 0x00, 0xBC, 0x00, 0xF0, 0x1F, 0x00, 0x0B,
-    0x43, 0xD0, 0x00, 0x7C, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x06, 0xBF, 0xEA, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xC0, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xD2, 0xE0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x00,
-    0xB8, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x0D, 0x00, 0x0D, 0x2F, 0xFC, 0xA0, 0xD2, 0x8C, 0x0A,
-    0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28,
-    0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x01,
-    0xC0, 0x0F, 0xFE, 0x1C, 0x28, 0x1C, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00,
-    0x28, 0x00, 0x00, 0x2A, 0xA8, 0xFF, 0xE1, 0x55, 0x00, 0x2A, 0xA8, 0xFF, 0xE1, 0x55, 0x00, 0x3F,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC0, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x2A,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x55,
-    0x50, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55,
-    0x55, 0x55, 0x50, 0x78, 0x0F, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x0F, 0x1E, 0x03,
-    0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x0F, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x0F,
-    0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x0F, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C,
-    0x78, 0x0F, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x54, 0x2F, 0xFF, 0xFC, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x6A, 0xAA, 0xA4,
-    0x01, 0xC0, 0x3C, 0x0B, 0x40, 0xF0, 0x3E, 0x07, 0xD0, 0x14, 0x00, 0x03, 0xD0, 0xBC, 0x0F, 0x41,
-    0xF0, 0x2D, 0x03, 0x80, 0x10, 0x00, 0x03, 0xE0, 0x7C, 0x0B, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x00,
-    0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x2C, 0x1D, 0x04, 0x01, 0xC0, 0xA0, 0x0F, 0x07, 0x40, 0xB4, 0x3C,
-    0x03, 0xC2, 0xE0, 0x3E, 0x0F, 0x01, 0xF4, 0xBC, 0x01, 0x40, 0x40, 0x00, 0x03, 0xD2, 0xF0, 0x2F,
-    0x0F, 0x80, 0xF4, 0x7C, 0x07, 0xC2, 0xD0, 0x2D, 0x0F, 0x00, 0xE0, 0xB0, 0x01, 0x00, 0x00, 0x00,
-    0x03, 0xE1, 0xF0, 0x1F, 0x0B, 0xC0, 0xB8, 0x3C, 0x03, 0xC1, 0xE0, 0x1E, 0x0F, 0x00, 0xF0, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x3C, 0x3D, 0x3C, 0x2D, 0x3C, 0x2D, 0x2C, 0x1E, 0x1D, 0x0E,
-    0x04, 0x04, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x03, 0xFF,
-    0xFF, 0x7A, 0xFA, 0xE0, 0x0E, 0x00, 0x00, 0xD0, 0x00, 0x1C, 0x00, 0x02, 0xC0, 0x00, 0x3C, 0x00,
-    0x03, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x00, 0x02,
-    0xA7, 0xAA, 0x00, 0xFF, 0xFF, 0xC0, 0x10, 0xB0, 0x50, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x14, 0x38, 0x10, 0x0F, 0xFF, 0xFC, 0x02,
-    0xAB, 0x6A, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0xFB, 0xFF, 0xBF, 0xF7, 0xFE, 0x1F, 0x80, 0x08, 0x00, 0x1F, 0x00, 0x1F,
-    0xD0, 0x2F, 0xF8, 0x3F, 0xFD, 0x3F, 0x90, 0x78, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x7E, 0x7D, 0x10,
-    0x00, 0x00, 0x03, 0xD0, 0x2E, 0x7E, 0x03, 0xF7, 0xD0, 0x3E, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x7C, 0x03, 0xC7, 0xE0, 0x3F, 0x02, 0xF5, 0xF4, 0x0F, 0x80, 0xBC, 0x10, 0x00,
-    0x40, 0x04, 0x00, 0x00, 0x2E, 0x3F, 0x3E, 0x04, 0x00, 0x02, 0xFF, 0xDA, 0x00, 0x28, 0x00, 0xA0,
-    0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x02,
-    0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A,
-    0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x1F, 0xBD,
-    0x00, 0x3C, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0x0B, 0x40, 0x00, 0x00, 0x78, 0x0E, 0x01, 0xE0, 0x00,
-    0x00, 0x0B, 0x00, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x1D, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x02,
-    0xC2, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x78, 0xBE, 0x00, 0xBE, 0x0F, 0x07, 0x4F, 0x3E, 0xF4,
-    0x3F, 0xF8, 0xBA, 0xF3, 0xCB, 0x43, 0xCB, 0x83, 0xC2, 0xF8, 0xB4, 0xF0, 0x3C, 0xF0, 0x3C, 0x00,
-    0x1E, 0x1D, 0x03, 0xDE, 0x03, 0xC0, 0x03, 0xC2, 0xC0, 0x39, 0xD0, 0x3C, 0x00, 0xF0, 0x3C, 0x07,
-    0x6C, 0x03, 0x80, 0x2D, 0x03, 0xC0, 0xB2, 0xC0, 0xB4, 0x07, 0x80, 0x3C, 0x0E, 0x2D, 0x0F, 0x00,
-    0xF0, 0x02, 0xE7, 0xC1, 0xF7, 0xD0, 0x3C, 0x00, 0x0F, 0xF4, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0E, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xE0,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1D, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x02,
-    0xC2, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x78, 0xBE, 0x00, 0xBE, 0x00, 0x7E, 0x0F,
-    0x07, 0x4F, 0x3E, 0xF4, 0x3F, 0xF8, 0x2F, 0xFC, 0xBA, 0xF3, 0xCB, 0x43, 0xCB, 0x83, 0xC7, 0x83,
-    0xC2, 0xF8, 0xB4, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x2C, 0x00, 0x1E, 0x1D, 0x03, 0xDE, 0x03, 0xCF,
-    0x02, 0xC0, 0x03, 0xC2, 0xC0, 0x39, 0xD0, 0x3D, 0xE0, 0x3C, 0x00, 0xF0, 0x3C, 0x07, 0x6C, 0x03,
-    0x9D, 0x03, 0xC0, 0x2D, 0x03, 0xC0, 0xB2, 0xC0, 0xB5, 0xD0, 0x74, 0x07, 0x80, 0x3C, 0x0E, 0x2D,
-    0x0F, 0x1D, 0x0F, 0x00, 0xF0, 0x02, 0xE7, 0xC1, 0xF7, 0xD0, 0xF6, 0xD0, 0x3C, 0x00, 0x0F, 0xF4,
-    0x0B, 0xF4, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0F,
-    0x40, 0x7C, 0x03, 0xC0, 0x1D, 0x00, 0xF0, 0x02, 0x00, 0x00, 0x01, 0xF0, 0xF0, 0x0F, 0x4B, 0x80,
-    0x7C, 0x3C, 0x03, 0xC2, 0xD0, 0x1D, 0x0E, 0x00, 0xF0, 0xB0, 0x02, 0x02, 0x40, 0x00, 0x01, 0xF0,
-    0xF0, 0xB4, 0x0F, 0x4B, 0x87, 0xC0, 0x7C, 0x3C, 0x3C, 0x03, 0xC2, 0xD1, 0xE0, 0x1D, 0x0E, 0x0F,
-    0x00, 0xF0, 0xB0, 0x74, 0x02, 0x02, 0x41, 0x40, 0x00, 0x74, 0x78, 0x3C, 0x2C, 0x1D, 0x0D, 0x05,
-    0x74, 0xB4, 0x78, 0x78, 0x3C, 0x3C, 0x2C, 0x3C, 0x1D, 0x2C, 0x0D, 0x0D, 0x05, 0x09, 0x74, 0xB4,
-    0xB0, 0x78, 0x78, 0xB4, 0x3C, 0x3C, 0x78, 0x2C, 0x3C, 0x3C, 0x1D, 0x2C, 0x2C, 0x0D, 0x0D, 0x1C,
-    0x05, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0x70, 0x00, 0xE3, 0x80,
-    0x2C, 0x2C, 0x07, 0x01, 0xC0, 0xD0, 0x0D, 0x38, 0x00, 0xE0, 0x00, 0x40, 0x1E, 0x07, 0xC1, 0xF0,
-    0x7C, 0x0F, 0x40, 0x7C, 0x03, 0xD0, 0x1E, 0x00, 0xF0, 0x01, 0x00, 0x05, 0x00, 0x3C, 0x00, 0x78,
-    0x00, 0xF0, 0x02, 0xE0, 0x07, 0xC0, 0x3E, 0x03, 0xE0, 0x3D, 0x02, 0xD0, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0xD0, 0x00, 0x43, 0xC0, 0x0F, 0x80, 0x0F, 0x07, 0xC0, 0x2D,
-    0x00, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x0F, 0x40,
-    0x00, 0x07, 0xC0, 0xF4, 0x00, 0x10, 0x07, 0xDF, 0x40, 0x12, 0xF0, 0x07, 0xF4, 0x03, 0xEB, 0xC0,
-    0x0F, 0xC0, 0x0F, 0x89, 0x00, 0xFB, 0xC0, 0x18, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0xF4, 0x07,
-    0xC0, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x60, 0x07, 0xC0,
-    0xF4, 0x03, 0xE0, 0x07, 0xC2, 0x40, 0x0F, 0x80, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xB8,
-    0x0F, 0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x41, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x2E, 0x00, 0xF8,
-    0x0F, 0x40, 0x3D, 0x03, 0xC0, 0x0F, 0x01, 0xF0, 0x07, 0xC0, 0x78, 0x01, 0xE0, 0x2D, 0x00, 0xB4,
-    0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x0F, 0x00, 0x7E, 0x0B, 0xD0, 0x1F, 0x42, 0xF0, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFE, 0x01, 0xFF, 0xFE, 0x02, 0x7D, 0x7C, 0x01, 0xF0, 0xF4, 0x07, 0xC3, 0xD0, 0x2E, 0x0F, 0x00,
-    0xF4, 0xF8, 0x03, 0xDF, 0xC0, 0x0F, 0xF8, 0x00, 0x7F, 0x40, 0x01, 0xF4, 0x00, 0x0B, 0x40, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00,
-    0x01, 0x00, 0x00, 0x2A, 0xAA, 0xA5, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0C,
-    0x38, 0x00, 0x03, 0x81, 0xD0, 0x00, 0xE0, 0x0B, 0x95, 0xB8, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x6F,
-    0x90, 0x00, 0xFA, 0x6F, 0x00, 0xE0, 0x00, 0xE0, 0xD0, 0x00, 0x0C, 0xA0, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0xA0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xCC, 0x00, 0x03, 0x4D, 0x00, 0x0E, 0x0D, 0x00, 0x1C,
-    0x0A, 0x00, 0x34, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x96, 0x80, 0x00, 0x00, 0x00, 0x02, 0xDB, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x02, 0xD0, 0x01, 0x01, 0xC0, 0x00, 0x14, 0x0B, 0x00, 0x2F, 0x4B, 0x00, 0x00, 0xFD, 0x28,
-    0x00, 0x6F, 0xF9, 0x55, 0x01, 0xBF, 0xE5, 0x50, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x1F,
-    0xC1, 0x50, 0x00, 0xBF, 0x05, 0x02, 0xE3, 0x40, 0x00, 0x0B, 0x5D, 0x00, 0x2F, 0x0F, 0x00, 0x00,
-    0xB8, 0x3C, 0x00, 0xB0, 0x2D, 0x00, 0x02, 0xC0, 0xF4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0xFF, 0xD1, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0,
-    0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
-    0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x07, 0xFD, 0x00, 0xBF, 0xC0,
-    0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01,
-    0xE0, 0x00, 0x2E, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xF8, 0x01, 0xFF, 0xD0, 0x1F, 0xFF, 0xE0, 0xBF, 0xFF, 0x40, 0x90, 0x1F, 0x02, 0x00, 0xBC, 0x00,
-    0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0,
-    0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80,
-    0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x40, 0x00, 0x2C, 0x00,
-    0x00, 0xB0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x03, 0xD1,
-    0xFF, 0xFE, 0x01, 0xF4, 0x24, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x3D, 0x0F,
-    0x80, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x1F, 0x80,
-    0x2E, 0x00, 0x1F, 0x80, 0x0B, 0x40, 0x0F, 0x40, 0x03, 0xC0, 0x07, 0x40, 0x00, 0xF0, 0x02, 0xC0,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x0F,
-    0xC0, 0x02, 0xF4, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0xBF, 0xF4, 0x00, 0xF8, 0x3F, 0xFF, 0xD0, 0x0F, 0x41, 0x40, 0x3E, 0x01, 0xF0,
-    0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x02, 0xE0, 0x3D, 0x00, 0x00, 0x7C,
-    0x03, 0xC0, 0x00, 0x1F, 0x40, 0x7C, 0x00, 0x0B, 0xD0, 0x07, 0x80, 0x02, 0xF0, 0x00, 0xB4, 0x00,
-    0x7C, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x7D,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x15, 0x55, 0x55, 0x5F, 0xFF, 0xFF, 0xE1, 0x55, 0x55, 0xF4,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x1F, 0xFF, 0xFF, 0x87, 0x07, 0xFF, 0xF1, 0xC1, 0xFF,
-    0xFE, 0x70, 0x7F, 0xFF, 0xDC, 0x1F, 0xFF, 0xF7, 0x07, 0xFF, 0xFD, 0xC1, 0xFF, 0xFF, 0x70, 0x7F,
-    0xFF, 0xDC, 0x1F, 0xFF, 0xD7, 0x07, 0xFF, 0xF1, 0xC1, 0xFF, 0xF0, 0x70, 0x75, 0x40, 0x1C, 0x1C,
-    0x00, 0x07, 0x07, 0x00, 0x01, 0xC1, 0xC0, 0x00, 0x70, 0x70, 0x00, 0x1C, 0x1C, 0x00, 0x07, 0x07,
-    0x00, 0x01, 0xC1, 0xC0, 0x00, 0x70, 0x70, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x42, 0xFF, 0xFF, 0xF2, 0xFF, 0xFD, 0x7C, 0xFF, 0xFF, 0x0F, 0x7F, 0xFF, 0xC3, 0xEF,
-    0xFF, 0xF0, 0xFB, 0xFF, 0xFC, 0x3E, 0xFF, 0xFF, 0x0F, 0xBF, 0xFF, 0xC3, 0xDF, 0xFF, 0xF0, 0xF3,
-    0xFF, 0xFC, 0x3C, 0x7F, 0xFF, 0xAF, 0x06, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40,
-    0x3F, 0xFF, 0xFE, 0x0F, 0x5F, 0xFF, 0xE3, 0x83, 0xFF, 0xFC, 0xE0, 0xFF, 0xFF, 0x78, 0x3F, 0xFF,
-    0xEE, 0x0F, 0xFF, 0xFB, 0x83, 0xFF, 0xFE, 0xE0, 0xFF, 0xFF, 0xB8, 0x3F, 0xFF, 0xDE, 0x0F, 0xFF,
-    0xF3, 0xEB, 0xFF, 0xF4, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2C, 0x00, 0x3E, 0x0E, 0x00, 0x0B, 0xFB, 0x40, 0x00, 0x0B,
-    0xFF, 0xF4, 0x01, 0xFD, 0x68, 0x01, 0xEB, 0x00, 0x02, 0xF0, 0xE0, 0x00, 0xF0, 0x3C, 0x00, 0x04,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x7E, 0x0B, 0xD0, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x2C, 0x00,
-    0x40, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0xFA, 0x6F, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xD0,
-    0x00, 0x0C, 0x00, 0xA0, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x03, 0x80,
-    0x00, 0x38, 0x00, 0x74, 0x00, 0x38, 0x00, 0x0B, 0x95, 0xB8, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x3C, 0x00, 0x03,
-    0xD0, 0xD0, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x00, 0x02, 0xF9, 0xA8, 0x00, 0x2D,
-    0xF0, 0x00, 0x03, 0xE2, 0xD0, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2C, 0x00, 0x02,
-    0xE0, 0xB0, 0x00, 0x0B, 0xFB, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x01, 0xFD, 0x69, 0x00, 0x1E,
-    0x70, 0x00, 0x01, 0xF0, 0xE0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x04, 0x0B, 0x80, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3C, 0xFC, 0x07, 0x87, 0x80, 0xB0, 0x00, 0x0F, 0x00, 0x02,
-    0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00,
-    0x07, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x07, 0x83, 0x80, 0xBC, 0xB4,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x0D, 0x2E,
-    0x56, 0xFF, 0xE4, 0x07, 0xC3, 0x40, 0x00, 0x6F, 0xFF, 0xF0, 0x60, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xD0, 0x0B, 0x40, 0xE0, 0x00, 0x2C, 0x28, 0x00,
-    0x00, 0xD2, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0B, 0x0B, 0x0B, 0x00,
-    0x7C, 0xB2, 0xD0, 0x01, 0xFF, 0xB4, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD2, 0xAB, 0xFE,
-    0xA8, 0x00, 0xBF, 0xF0, 0x00, 0x2D, 0xB7, 0xC0, 0x0B, 0x4B, 0x1F, 0x00, 0x10, 0xB0, 0x50, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x80, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0xF0,
-    0x00, 0x0B, 0xC0, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x14, 0x01, 0xF0, 0xF0,
-    0xF4, 0xB8, 0x0F, 0x4B, 0x87, 0xC3, 0xC0, 0x7C, 0x3C, 0x3C, 0x2D, 0x03, 0xC2, 0xD1, 0xD0, 0xE0,
-    0x1D, 0x0E, 0x0F, 0x0B, 0x00, 0xF0, 0xB0, 0x70, 0x34, 0x02, 0x02, 0x41, 0x41, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x42, 0xF0, 0x00, 0x00, 0x0B, 0xCB, 0xC0,
-    0x00, 0x00, 0x2F, 0x09, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x4A, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x92, 0xF0,
-    0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7C, 0xBC,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xBC, 0x7C,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x01, 0x92, 0xF0, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x2F, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8, 0x0F, 0x02, 0xF0, 0x03,
-    0xF0, 0x3C, 0x0F, 0xC0, 0x0B, 0x40, 0xF0, 0x1D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x18,
-    0x03, 0xC0, 0x60, 0x00, 0xF8, 0x0F, 0x03, 0xE0, 0x03, 0xE0, 0x3C, 0x0F, 0x80, 0x01, 0x00, 0xF0,
-    0x04, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x04, 0x3F, 0x3F, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x7C,
-    0xBD, 0x7C, 0x00, 0x00, 0x7C, 0xBD, 0xBC, 0x00, 0x00, 0x7C, 0xBD, 0xBC, 0x10, 0x00, 0x7C, 0xBD,
-    0xBC, 0x10, 0x00, 0x0B, 0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x3F, 0xC1, 0xF4, 0x0F, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0x02, 0xF8, 0x3F, 0xCB, 0xFE, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x35, 0xCA, 0x0A, 0x2A, 0x80, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x50, 0x01, 0xFF, 0x40, 0xF4, 0xF0, 0xB4,
-    0x2C, 0x3C, 0x0B, 0x0E, 0x02, 0xC7, 0x40, 0xF1, 0xD0, 0x38, 0x74, 0x1D, 0x1E, 0x0F, 0x03, 0xFF,
-    0x40, 0x2E, 0x00, 0x00, 0x0B, 0x01, 0x00, 0x1C, 0x2C, 0x28, 0x34, 0x30, 0x70, 0xB0, 0x90, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0xEB, 0x00, 0xF3, 0xC0, 0xB0, 0xE0, 0xB5,
-    0x78, 0x3F, 0xFF, 0x80, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xB5,
-    0x50, 0x38, 0x00, 0x0D, 0x00, 0x07, 0xFD, 0x00, 0x57, 0xC0, 0x00, 0x74, 0x00, 0x1D, 0x00, 0x0F,
-    0x0B, 0xAF, 0x40, 0xBE, 0x00, 0x00, 0x04, 0x00, 0x7F, 0xC0, 0x79, 0x10, 0x38, 0x00, 0x2C, 0x00,
-    0x0F, 0xFF, 0x03, 0xD2, 0xD1, 0xE0, 0x38, 0x74, 0x0D, 0x0E, 0x0B, 0x03, 0xEF, 0x80, 0x2E, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x55, 0xF4, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x1D, 0x00, 0x0F, 0x00,
-    0x0B, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0xA0, 0x00, 0x00, 0x50, 0x01, 0xFF, 0x40,
-    0xE0, 0xF0, 0x74, 0x2C, 0x0E, 0x0E, 0x01, 0xFE, 0x01, 0xFF, 0x41, 0xE0, 0xF0, 0xB0, 0x1D, 0x3C,
-    0x0B, 0x07, 0xEF, 0x80, 0x6E, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xF1, 0xE0, 0xB0, 0x2C, 0x3C,
-    0x0B, 0x0F, 0x03, 0xC2, 0xFB, 0xF0, 0x2E, 0x74, 0x00, 0x2C, 0x00, 0x2D, 0x0A, 0xBE, 0x01, 0xE8,
-    0x00, 0x01, 0x40, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x2B, 0xE8, 0x02, 0x80, 0x02, 0x80, 0x00,
-    0x00, 0x7F, 0xFD, 0x2A, 0xA8, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x15, 0x54, 0x7F, 0xFD, 0x00,
-    0x10, 0x03, 0x80, 0x3C, 0x01, 0xD0, 0x0F, 0x00, 0x74, 0x02, 0xC0, 0x0F, 0x00, 0x38, 0x00, 0xE0,
-    0x03, 0x80, 0x0F, 0x00, 0x2C, 0x00, 0x34, 0x00, 0x01, 0x00, 0x3C, 0x01, 0xC0, 0x1D, 0x00, 0xD0,
-    0x0D, 0x01, 0xD0, 0x1D, 0x02, 0xC0, 0x38, 0x0B, 0x40, 0xE0, 0x2C, 0x0B, 0x00, 0x00, 0x05, 0x02,
-    0xEF, 0xE0, 0xF8, 0x2C, 0x3C, 0x0F, 0x1D, 0x03, 0x8B, 0x00, 0xD2, 0xC0, 0x70, 0xE0, 0x2C, 0x34,
-    0x0A, 0x00, 0x00, 0x50, 0x00, 0xFF, 0x40, 0xF4, 0xF0, 0xB4, 0x2C, 0x3C, 0x0B, 0x0E, 0x02, 0xC7,
-    0x40, 0xB1, 0xD0, 0x3C, 0x74, 0x1E, 0x0E, 0x0F, 0x03, 0xFF, 0x40, 0x2E, 0x00, 0x00, 0x00, 0x1F,
-    0x0F, 0xE3, 0xDD, 0x02, 0xC0, 0x3C, 0x03, 0xC0, 0x38, 0x07, 0x40, 0xB0, 0x0F, 0x00, 0x90, 0x00,
-    0x14, 0x00, 0xBF, 0xD0, 0x34, 0x7C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x02, 0xD0, 0x02,
-    0xD0, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xFF, 0xF0, 0xAA, 0xA4, 0x00, 0x50, 0x0F, 0xFD, 0x09, 0x1F,
-    0x00, 0x0F, 0x00, 0x0E, 0x06, 0xB8, 0x06, 0xF4, 0x00, 0x2C, 0x00, 0x2C, 0x40, 0x3C, 0xFA, 0xF4,
-    0x6F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x03, 0xF8, 0x02, 0xDD, 0x02, 0xCB, 0x01,
-    0xD3, 0xC1, 0xE5, 0xF4, 0xBF, 0xFF, 0x00, 0x2D, 0x00, 0x0B, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0xB5, 0x50, 0x38, 0x00, 0x0D, 0x00, 0x07, 0xFD, 0x00, 0x57, 0xC0, 0x00, 0x74, 0x00,
-    0x1C, 0x00, 0x0F, 0x0B, 0xAF, 0x40, 0xBE, 0x00, 0x00, 0x04, 0x00, 0x7F, 0xD0, 0x7D, 0x10, 0x38,
-    0x00, 0x2C, 0x10, 0x0F, 0xFF, 0x03, 0xD1, 0xE0, 0xE0, 0x38, 0x34, 0x0E, 0x0E, 0x0B, 0x42, 0xFF,
-    0x80, 0x2E, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x55, 0xB4, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x1E,
-    0x00, 0x0F, 0x00, 0x0B, 0x40, 0x03, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x10,
-    0x01, 0xFF, 0x80, 0xF0, 0xB0, 0x38, 0x1D, 0x0F, 0x0F, 0x01, 0xFE, 0x00, 0xFF, 0x40, 0xE0, 0xB4,
-    0xB0, 0x1D, 0x2C, 0x0B, 0x43, 0xEB, 0x80, 0x2E, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xF5, 0xF0,
-    0xB0, 0x2C, 0x3C, 0x0B, 0x0F, 0x03, 0xC1, 0xFB, 0xF0, 0x1E, 0x78, 0x00, 0x2C, 0x00, 0x1E, 0x06,
-    0xBE, 0x01, 0xB8, 0x00, 0x00, 0x40, 0x01, 0xC0, 0x01, 0xC0, 0x3F, 0xFD, 0x2A, 0xE9, 0x01, 0xC0,
-    0x01, 0xC0, 0x00, 0x40, 0x3F, 0xFD, 0x2A, 0xA9, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x15, 0x54,
-    0x3F, 0xFE, 0x00, 0x40, 0x3C, 0x0B, 0x01, 0xD0, 0x3C, 0x07, 0x40, 0xB0, 0x0F, 0x00, 0xF0, 0x0F,
-    0x00, 0xF0, 0x0B, 0x00, 0x70, 0x03, 0x40, 0x01, 0x00, 0x2C, 0x01, 0xD0, 0x0D, 0x00, 0xE0, 0x0E,
-    0x00, 0xE0, 0x1D, 0x02, 0xC0, 0x3C, 0x07, 0x40, 0xF0, 0x2C, 0x07, 0x40, 0x02, 0xE1, 0x43, 0xD7,
-    0xD2, 0xC0, 0xB0, 0xD0, 0x2C, 0x70, 0x0E, 0x2C, 0x03, 0x47, 0x03, 0xC0, 0xFB, 0x70, 0x09, 0x04,
-    0x00, 0x02, 0xE4, 0x0F, 0x6C, 0x2C, 0x0D, 0x34, 0x7C, 0x7F, 0x90, 0xB0, 0x00, 0x70, 0x00, 0x3E,
-    0xB4, 0x06, 0x40, 0x02, 0xA4, 0x03, 0xD7, 0x83, 0xC0, 0xB0, 0xD0, 0x1C, 0x70, 0x0B, 0x2C, 0x03,
-    0x87, 0x01, 0xC0, 0xFA, 0xD0, 0x06, 0x40, 0x00, 0x09, 0x02, 0x41, 0xC2, 0xC0, 0x36, 0xC0, 0x07,
-    0xC0, 0x01, 0xE0, 0x01, 0xEC, 0x00, 0xD3, 0x40, 0xE0, 0xB0, 0x50, 0x04, 0x00, 0x1B, 0x90, 0x96,
-    0xD0, 0x02, 0xC0, 0x0B, 0x1F, 0xFE, 0xD0, 0xEE, 0x0B, 0x2E, 0xF0, 0x19, 0x00, 0x07, 0x00, 0x02,
-    0xC0, 0x00, 0xE0, 0x00, 0x35, 0xA4, 0x1E, 0x9B, 0x07, 0x81, 0xC2, 0xC0, 0x70, 0xD0, 0x2C, 0x30,
-    0x0E, 0x1C, 0x03, 0x4B, 0x01, 0xC1, 0x40, 0x10, 0x07, 0x00, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x34,
-    0x28, 0x1C, 0x2C, 0x0B, 0x2C, 0x02, 0xAC, 0x00, 0xFF, 0x00, 0x34, 0xD0, 0x1C, 0x2C, 0x0B, 0x03,
-    0x41, 0x40, 0x50, 0x07, 0x02, 0xC0, 0xE0, 0x34, 0x0C, 0x07, 0x02, 0x80, 0xD0, 0x34, 0x1C, 0x0B,
-    0x01, 0x40, 0x08, 0x78, 0x1E, 0x40, 0xE9, 0xEA, 0x7C, 0x1D, 0x07, 0x81, 0xC2, 0xC0, 0xB0, 0x2C,
-    0x38, 0x0E, 0x03, 0x83, 0x40, 0xD0, 0x34, 0x70, 0x1C, 0x07, 0x0B, 0x02, 0xC0, 0x70, 0x50, 0x14,
-    0x05, 0x00, 0x08, 0x7D, 0x07, 0xA6, 0xC2, 0xE0, 0x70, 0xF0, 0x1C, 0x38, 0x0B, 0x0D, 0x03, 0x87,
-    0x00, 0xD2, 0xC0, 0x70, 0x50, 0x04, 0x00, 0x02, 0x1A, 0x00, 0x7A, 0x6C, 0x07, 0x80, 0xD0, 0xB0,
-    0x0D, 0x0D, 0x01, 0xC0, 0xD0, 0x2C, 0x1D, 0x07, 0x42, 0xFA, 0xE0, 0x38, 0x60, 0x03, 0x40, 0x00,
-    0x70, 0x00, 0x0B, 0x00, 0x00, 0x06, 0xE4, 0x79, 0x62, 0xC0, 0x07, 0x80, 0x07, 0xD0, 0x02, 0xC0,
-    0x07, 0x2A, 0xB8, 0x19, 0x40, 0x01, 0x00, 0xA0, 0x2F, 0x92, 0xD4, 0x1C, 0x02, 0x80, 0x34, 0x03,
-    0x40, 0x70, 0x03, 0xA0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFA, 0xF0,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x01, 0x55, 0x43, 0xC0,
-    0x7F, 0xFC, 0x3C, 0x0B, 0x40, 0x03, 0xC0, 0xF0, 0x00, 0x3D, 0x0F, 0x00, 0x02, 0xF6, 0xF5, 0x40,
-    0x0B, 0xFF, 0xFE, 0x00, 0x07, 0xE5, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x0B, 0xEA, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xB0, 0xD0, 0x00, 0x0E, 0x2C,
-    0x00, 0x06, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0x4B, 0x80, 0x7D, 0xB0, 0xD0, 0x0F, 0x4E,
-    0x2C, 0x02, 0xF1, 0xC3, 0x80, 0x3D, 0x3C, 0x74, 0x03, 0xC3, 0x4B, 0x00, 0x7C, 0xB0, 0xD0, 0x0B,
-    0x8E, 0x2C, 0x00, 0xB9, 0xC3, 0x80, 0x07, 0xFC, 0x74, 0x00, 0x3F, 0x4B, 0x00, 0x03, 0xF0, 0xD0,
-    0x00, 0x1F, 0xFE, 0xF8, 0x01, 0xFF, 0xFF, 0x40, 0x3C, 0x74, 0x00, 0x03, 0x4B, 0x00, 0x00, 0x10,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0xD0, 0x1F, 0x80,
-    0x08, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D,
-    0x0B, 0x2F, 0x03, 0xC0, 0xFB, 0xF0, 0x7C, 0x0F, 0xC0, 0x07, 0xC0, 0xF4, 0x00, 0x7C, 0x1F, 0x00,
-    0x07, 0xC2, 0xD0, 0x00, 0x7C, 0x3C, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x2F, 0xBC, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xD0, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFA, 0xAA, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F,
-    0x55, 0x50, 0x00, 0xB4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x07, 0xD0, 0x04, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0x7D, 0x54, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x05, 0xF9, 0x54, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x02, 0xA0, 0x7A, 0x90, 0x02, 0xC7,
-    0xFF, 0x3F, 0xFF, 0x00, 0xF7, 0x97, 0xFF, 0x47, 0xD0, 0x3F, 0x40, 0xBF, 0x00, 0xF4, 0x1F, 0x80,
-    0x2F, 0x40, 0x3D, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0x42, 0xE0, 0x07, 0xD0, 0x03, 0xC0, 0xF4, 0x03,
-    0xF0, 0x01, 0xF0, 0x3C, 0x02, 0xFC, 0x00, 0xB8, 0x1F, 0x00, 0xFE, 0x00, 0x3D, 0x0B, 0x80, 0xFF,
-    0x40, 0x0F, 0x03, 0xD0, 0x77, 0xC0, 0x03, 0xC0, 0xF0, 0x38, 0xF0, 0x01, 0xF0, 0x3C, 0x2C, 0x7C,
-    0x00, 0xB8, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0xF0, 0x02, 0xF4, 0x03, 0x80, 0x0F, 0xD0, 0x1E, 0x00, 0x3F, 0x80,
-    0xB4, 0x01, 0xEE, 0x03, 0xC0, 0x0B, 0x7C, 0x0F, 0x01, 0xBE, 0xFA, 0xBE, 0x4B, 0xFF, 0xFF, 0xFC,
-    0x03, 0xCB, 0x4B, 0x00, 0x1E, 0x1D, 0x3C, 0x07, 0xFF, 0xFF, 0xFE, 0x1B, 0xEA, 0xFB, 0xE4, 0x0F,
-    0x03, 0xED, 0x00, 0x38, 0x0F, 0xB0, 0x01, 0xE0, 0x3F, 0xC0, 0x0B, 0x40, 0xBF, 0x00, 0x3C, 0x02,
-    0xF8, 0x00, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0xF0, 0x7F, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0xF4,
-    0x70, 0x03, 0xD0, 0x0F, 0x0F, 0x00, 0x3C, 0x02, 0xF2, 0xE5, 0x07, 0xC0, 0xBE, 0xFF, 0xF0, 0xBF,
-    0xFF, 0x47, 0xD4, 0x0B, 0xFF, 0x40, 0x3C, 0x00, 0xF4, 0x00, 0x07, 0x80, 0x0F, 0x00, 0x00, 0xB4,
-    0x01, 0xF0, 0x00, 0x0F, 0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3C, 0x00,
-    0x00, 0xFA, 0x43, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x3C, 0x00,
-    0x00, 0x01, 0xE0, 0x0F, 0x02, 0xA4, 0x00, 0xB4, 0x03, 0xC7, 0xFF, 0xC0, 0x3D, 0x01, 0xF3, 0xE1,
-    0x90, 0x0F, 0x00, 0xF9, 0xF0, 0x00, 0x07, 0xD5, 0xFC, 0x7C, 0x00, 0x02, 0xFF, 0xF8, 0x0F, 0x40,
-    0x00, 0xFE, 0xF8, 0x02, 0xF4, 0x00, 0x3C, 0x1F, 0x00, 0x2F, 0x80, 0x0F, 0x03, 0xC0, 0x01, 0xF4,
-    0x07, 0xC0, 0xF4, 0x00, 0x2E, 0x02, 0xE0, 0x2D, 0x00, 0x07, 0x80, 0xF4, 0x0B, 0x80, 0x03, 0xE0,
-    0x3C, 0x01, 0xF3, 0xEB, 0xF0, 0x0F, 0x00, 0x3C, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x3C, 0x01, 0xD0, 0x78, 0x07, 0xC0, 0x3C, 0x07, 0x80, 0xFC, 0x03, 0xC0, 0x74, 0x0E,
-    0xC0, 0xB4, 0x0B, 0x42, 0xDC, 0x0F, 0x00, 0xB4, 0x3A, 0xC0, 0xE0, 0x0B, 0x47, 0x6C, 0x2D, 0x00,
-    0xB0, 0xB2, 0xC3, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x06, 0xFB, 0xFB, 0xEF, 0xA0, 0x0F, 0x3C, 0x3C,
-    0xF0, 0x00, 0xF3, 0x83, 0x9D, 0x00, 0x0F, 0x70, 0x3A, 0xC0, 0x00, 0xEF, 0x03, 0xB8, 0x00, 0x0F,
-    0xD0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0xF4, 0x03, 0xD0,
-    0x00, 0x00, 0x7F, 0xFE, 0x40, 0x0B, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x1F, 0x00,
-    0xF0, 0x03, 0xC0, 0x02, 0xD0, 0x78, 0x01, 0xE0, 0x50, 0x74, 0x2D, 0x00, 0xB4, 0x3C, 0x2D, 0x0F,
-    0x00, 0x3C, 0x1E, 0x0B, 0x43, 0xC0, 0x0F, 0x0B, 0x83, 0xC1, 0xF0, 0x07, 0x82, 0xD0, 0xF0, 0x78,
-    0x01, 0xE0, 0xF0, 0x78, 0x2D, 0x00, 0xB4, 0x3C, 0x2D, 0x0F, 0x00, 0x3C, 0x1E, 0x0F, 0x03, 0xC0,
-    0x0F, 0x0B, 0x43, 0xC1, 0xE0, 0x07, 0x83, 0xC0, 0x50, 0xB4, 0x02, 0xD0, 0xF0, 0x00, 0x3C, 0x00,
-    0xF4, 0x3C, 0x00, 0x7D, 0x00, 0x3C, 0x1F, 0xAA, 0xFE, 0x00, 0x0F, 0x0B, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xA0, 0x7C, 0x00, 0x0B, 0xFF, 0x6E, 0x00, 0x0B, 0xE0,
-    0xBF, 0x40, 0x07, 0xD0, 0x0F, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x7C,
-    0x00, 0x2D, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x07, 0xC0, 0x03, 0xD0, 0x03, 0xF0, 0x00,
-    0xB8, 0x01, 0xF8, 0x00, 0x2F, 0x01, 0xFD, 0x00, 0x03, 0xFB, 0xDB, 0x00, 0x00, 0x7F, 0xD3, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
-    0xD0, 0x14, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x05, 0xF9,
-    0x54, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xE5, 0x50, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xBE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0x1E, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0x2F, 0x00, 0x03,
-    0xD0, 0x2F, 0x00, 0x00, 0xF0, 0x2F, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0x2E, 0x2F, 0x00, 0x00,
-    0x0F, 0x6F, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0A, 0xFF, 0xFE, 0xA0, 0x00, 0x7D, 0x2E, 0x00,
-    0x00, 0x2E, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0x00, 0xF0, 0x03,
-    0xD0, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x08,
-    0x00, 0x02, 0xEB, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFF,
-    0xCB, 0x00, 0x3D, 0xBF, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0xBE, 0xF0, 0x00, 0x05, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0,
-    0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x01, 0x00,
-    0x07, 0xC0, 0x02, 0xE0, 0x7F, 0xF0, 0x07, 0x80, 0x03, 0xD0, 0xF9, 0xFC, 0x0B, 0x40, 0x0B, 0xC3,
-    0xE0, 0x3D, 0x0F, 0x40, 0x0F, 0x43, 0xC0, 0x3D, 0x0F, 0x00, 0x7E, 0x07, 0xC0, 0x3C, 0x1F, 0x06,
-    0xFC, 0x0B, 0x80, 0xBC, 0x2F, 0xFF, 0xE0, 0x0F, 0xEB, 0xF4, 0x2F, 0xF9, 0x00, 0x0F, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xBE,
-    0x00, 0x00, 0x2D, 0x0F, 0x00, 0x00, 0x3C, 0x0E, 0x00, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0x38, 0x2C,
-    0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x30, 0x7E, 0x00, 0x00, 0xF0, 0xFF, 0x00,
-    0x02, 0xFB, 0xCF, 0x00, 0x07, 0xAF, 0x4F, 0x00, 0x0F, 0x1E, 0x0B, 0x40, 0x2D, 0x0C, 0x0B, 0x40,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0xF4, 0x0B, 0xC0, 0x05, 0xF5, 0x57, 0xD4, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xE0, 0x03, 0xC0,
-    0x02, 0xE0, 0x03, 0xC0, 0x2B, 0xFA, 0xAF, 0xE0, 0x2B, 0xEA, 0xAF, 0xA0, 0x07, 0xC0, 0x3E, 0x00,
-    0x0B, 0xEB, 0xFC, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFE, 0x3C, 0x18,
-    0x02, 0xF4, 0x38, 0x00, 0x07, 0xD0, 0x74, 0x00, 0x0F, 0x80, 0x70, 0x00, 0x1F, 0x00, 0xB0, 0x00,
-    0x2F, 0x00, 0xE0, 0x00, 0x3D, 0x00, 0xE5, 0x54, 0x3D, 0x01, 0xFF, 0xF4, 0x3C, 0x02, 0xEA, 0xF4,
-    0x3C, 0x03, 0xC0, 0xF0, 0x3D, 0x03, 0x81, 0xF0, 0x3E, 0x03, 0x42, 0xE0, 0x2F, 0x07, 0x03, 0xD0,
-    0x0F, 0xCB, 0x03, 0xC0, 0x07, 0xFF, 0xBF, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x02, 0xEF, 0x00, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x00, 0x7D,
-    0x2E, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0x6F, 0x56, 0xF5, 0x40, 0x0F, 0x80, 0x7C, 0x00, 0x6B,
-    0xEA, 0xAF, 0xA0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x3D, 0x00,
-    0xBC, 0x00, 0x0B, 0x40, 0x3D, 0x00, 0x02, 0xE0, 0x2F, 0x00, 0x00, 0xB8, 0x0F, 0x40, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x02, 0xAA, 0xAA, 0xFE, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x2F, 0xEA,
-    0xAA, 0x90, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x04,
-    0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0x8F, 0x08, 0x02, 0xF0, 0x38, 0x00, 0x1F,
-    0x40, 0xD0, 0x00, 0xF8, 0x07, 0x00, 0x07, 0xC0, 0x2C, 0x00, 0x2F, 0x00, 0xE0, 0x00, 0xF8, 0x03,
-    0x80, 0x03, 0xD0, 0x1D, 0x00, 0x0F, 0x00, 0xB0, 0x00, 0x3C, 0x02, 0xC0, 0x00, 0xF4, 0x0E, 0x00,
-    0x03, 0xE0, 0x34, 0x00, 0x0B, 0xC1, 0xD0, 0x00, 0x0F, 0xCB, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
-    0x70, 0x0B, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x02, 0xF5, 0x6F, 0x54, 0x2F, 0xFF, 0xFF, 0xFC, 0x07,
-    0xE5, 0x7D, 0x50, 0x03, 0xC0, 0x3C, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x0B,
-    0x80, 0xF4, 0x00, 0x0F, 0x40, 0xF0, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x2E,
-    0x02, 0xE0, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x3C, 0x01, 0xFA, 0x80, 0x3C, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x0F, 0xD0, 0x18, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xE2, 0x92,
-    0x81, 0xF0, 0x3B, 0x9B, 0x9B, 0x1F, 0x03, 0x74, 0x74, 0x72, 0xE0, 0x3F, 0x07, 0x0A, 0x7C, 0x01,
-    0xF9, 0xE0, 0xFF, 0x40, 0x0E, 0xFF, 0xFF, 0x80, 0x00, 0xC0, 0xD1, 0xC0, 0x00, 0x0C, 0x1C, 0x1C,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x1A, 0xAF,
-    0xE9, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x16, 0xFD, 0x00, 0x2F, 0xF8,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xB8, 0x06, 0x00, 0x0F, 0x9B, 0xE0, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0x40,
-    0x00, 0x3A, 0xF0, 0x6C, 0x00, 0x2F, 0xBF, 0x40, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x57,
-    0xC0, 0x02, 0xD0, 0x7C, 0x00, 0x3C, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xF4, 0x0F, 0x00, 0x3F,
-    0x01, 0xF0, 0x1F, 0xC0, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x70, 0x74, 0x00, 0x00, 0xB0,
-    0x74, 0x00, 0x00, 0x79, 0xB5, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xFA, 0xAA, 0xBC, 0x00,
-    0xE0, 0x00, 0x0E, 0x01, 0xD0, 0x00, 0x0A, 0x02, 0xC3, 0x08, 0x0A, 0x03, 0xDF, 0xBF, 0x0E, 0x03,
-    0xF6, 0xF7, 0xAC, 0x03, 0xC0, 0x81, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x3B, 0xC0, 0x00, 0x00, 0x12,
-    0xE0, 0x00, 0x00, 0x00, 0xFE, 0xBC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01, 0x7F, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x2F, 0xEB, 0xEB, 0xF4, 0x02, 0xF4, 0x1F, 0x02, 0xF0, 0x0F, 0x40, 0x7C, 0x03, 0xC0, 0x7C,
-    0x02, 0xE0, 0x0F, 0x03, 0xE0, 0x0F, 0x40, 0x3C, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x3C, 0x00, 0xF0,
-    0x0B, 0xC1, 0xF0, 0x00, 0x00, 0x2E, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xC0,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2E, 0x00,
-    0xBE, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0xB8, 0x00,
-    0x2E, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0xF4, 0x17, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xA8,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2B, 0xEA, 0x80,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x04, 0x00, 0x00, 0x03, 0x87, 0x00, 0x00, 0x00, 0xE1, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x0E, 0x90, 0x03, 0xF3, 0x87, 0x00, 0x02, 0xF0, 0xD2, 0xC0, 0x00,
-    0xF4, 0x34, 0xB0, 0x00, 0xBC, 0x1C, 0x38, 0x00, 0x3D, 0x06, 0x08, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x04, 0x00, 0x02, 0xC7, 0x00, 0x00, 0xE2,
-    0xC0, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0xB8, 0x0B, 0xD0, 0x3D, 0x00, 0xF8, 0x0F, 0x00,
-    0x2E, 0x07, 0xC0, 0x0B, 0x82, 0xE0, 0x07, 0xC0, 0xF9, 0x5B, 0xD0, 0x3F, 0xFF, 0x80, 0x0F, 0xAB,
-    0xF4, 0x07, 0xC0, 0x1F, 0x02, 0xE0, 0x03, 0xD0, 0xF4, 0x00, 0xF8, 0x3C, 0x00, 0x3D, 0x0F, 0x00,
-    0x1F, 0x07, 0xC0, 0x1F, 0x82, 0xFF, 0xFF, 0x80, 0xFF, 0xFE, 0x40, 0x03, 0x8B, 0x00, 0x00, 0xD3,
-    0x80, 0x00, 0x10, 0x40, 0x00, 0x2A, 0xA8, 0xFF, 0xE1, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x2F, 0x00, 0x00, 0x3F, 0xC6, 0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFE, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x5F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x41,
-    0xFF, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+static const uint8_t notosans_12_italicBitmaps[28157] = {
+    0x95, 0x55, 0x3D, 0x8F, 0x1B, 0x45, 0x18, 0x7E, 0x76, 0xA7, 0x58, 0xC4, 0xEA, 0x6E, 0x52, 0xD0,
+    0x45, 0xE7, 0xA5, 0xA0, 0x40, 0xC8, 0x1F, 0x4D, 0x0A, 0x17, 0x6B, 0x7B, 0xA5, 0x14, 0x14, 0x14,
+    0xA4, 0x20, 0x14, 0xFC, 0x05, 0x8A, 0x50, 0x5C, 0x71, 0x85, 0x73, 0x9E, 0x40, 0x41, 0x41, 0x41,
+    0x24, 0x0A, 0x4A, 0x28, 0x28, 0xC2, 0xA5, 0xB8, 0x2B, 0x5C, 0xB8, 0x70, 0xCE, 0x93, 0xA4, 0xA0,
+    0x64, 0x92, 0x36, 0x45, 0x26, 0x51, 0x8A, 0xE8, 0xD2, 0x4C, 0xC4, 0x22, 0xED, 0x7D, 0xD8, 0xC3,
+    0x33, 0xBB, 0x8E, 0x09, 0x42, 0x14, 0x8C, 0x64, 0xD9, 0x33, 0xEF, 0xD7, 0xF3, 0x3E, 0xEF, 0x87,
+    0x31, 0x13, 0x56, 0x16, 0xE3, 0xD8, 0x49, 0x35, 0x80, 0x4B, 0x74, 0x0B, 0x53, 0xA1, 0x25, 0x78,
+    0x64, 0xB1, 0x1F, 0x95, 0x11, 0xD0, 0x92, 0xE9, 0xB7, 0x0F, 0x1E, 0x59, 0x37, 0xED, 0xB7, 0xB7,
+    0xB6, 0xE3, 0xB8, 0x40, 0xAC, 0xAF, 0x00, 0x6E, 0x07, 0xE8, 0xA7, 0xC0, 0x8E, 0x50, 0x48, 0x23,
+    0x13, 0xDD, 0x3D, 0x39, 0x53, 0x0B, 0xEF, 0x1D, 0x8E, 0x5A, 0x40, 0x4E, 0xC1, 0xB6, 0xD0, 0x48,
+    0x0A, 0x0B, 0xCF, 0xC7, 0x91, 0xF7, 0x15, 0x76, 0xE9, 0xB5, 0x4D, 0x6D, 0x19, 0x6B, 0x08, 0xE5,
+    0x10, 0x99, 0x7E, 0x08, 0x73, 0xC4, 0x48, 0x40, 0x7A, 0x8A, 0xD4, 0x5F, 0x44, 0x7F, 0x3E, 0x28,
+    0xF2, 0x36, 0xC4, 0x43, 0x8D, 0x41, 0x1F, 0xF1, 0x79, 0x81, 0xB4, 0xA2, 0xB8, 0x04, 0x5E, 0x19,
+    0x6C, 0x75, 0x11, 0x3D, 0xB6, 0x68, 0x0F, 0xC4, 0x0F, 0x4F, 0xF5, 0xC8, 0x5B, 0xDC, 0xB0, 0xC0,
+    0x57, 0x34, 0xA5, 0x93, 0x6B, 0xA8, 0x4F, 0xB4, 0x82, 0xB8, 0x75, 0x6E, 0x84, 0x76, 0x7B, 0xB1,
+    0xD9, 0xDB, 0x8E, 0x2C, 0xE3, 0x39, 0x19, 0x19, 0x27, 0xF4, 0xD1, 0x14, 0x2E, 0xDF, 0x3B, 0xCE,
+    0x77, 0xF2, 0xF3, 0x27, 0x87, 0xF9, 0x34, 0x3F, 0xEE, 0xE4, 0x12, 0xAD, 0x1D, 0xE6, 0x9A, 0xC2,
+    0x4A, 0xA1, 0x77, 0xD3, 0xC2, 0xB5, 0x13, 0x95, 0x13, 0x76, 0xFA, 0x13, 0xA1, 0xFB, 0x02, 0x6F,
+    0x4E, 0xE4, 0x15, 0xE2, 0xB3, 0x0A, 0x91, 0xCB, 0x80, 0x19, 0x65, 0x1D, 0x38, 0xA4, 0x8A, 0xA8,
+    0x5E, 0x13, 0xDD, 0x88, 0xDF, 0x19, 0x91, 0xF4, 0xE6, 0xB8, 0x36, 0x94, 0x6A, 0xD6, 0x45, 0x49,
+    0xCF, 0xD9, 0x50, 0xE8, 0x78, 0x45, 0xBD, 0x11, 0x86, 0x98, 0x98, 0xE4, 0x6C, 0x35, 0xC7, 0xA4,
+    0x92, 0x2A, 0xF8, 0x6B, 0x75, 0x3B, 0x79, 0xFF, 0xCA, 0xFB, 0xD8, 0x66, 0xE2, 0xB2, 0x48, 0x95,
+    0xD0, 0xC2, 0x44, 0x0E, 0x53, 0xE4, 0xC8, 0xE8, 0x57, 0x18, 0x9A, 0xE5, 0x94, 0x31, 0x92, 0xC3,
+    0x00, 0x69, 0x11, 0x59, 0xDE, 0x13, 0x02, 0xEA, 0x33, 0xD9, 0xC8, 0xF0, 0x6B, 0x2D, 0xDC, 0x68,
+    0x8D, 0xD1, 0xA5, 0x2B, 0x86, 0xB4, 0xBC, 0xCC, 0x78, 0xCD, 0x09, 0xB2, 0xDB, 0xC0, 0xA7, 0x02,
+    0x1F, 0x8B, 0x1C, 0x83, 0x2D, 0xA4, 0xE7, 0xC0, 0x65, 0xEF, 0xE2, 0xD3, 0x3B, 0xF1, 0x53, 0x88,
+    0xE7, 0x0C, 0x3B, 0xC6, 0x25, 0xD2, 0xCF, 0x32, 0x63, 0x0B, 0x48, 0x14, 0x18, 0x0B, 0x7B, 0xC4,
+    0x88, 0x77, 0x0F, 0x4F, 0x7E, 0x0C, 0x65, 0xAB, 0x2F, 0x6F, 0x49, 0x78, 0x62, 0x3B, 0x48, 0x75,
+    0xD9, 0x0A, 0x8E, 0x3F, 0xBA, 0xE3, 0x9F, 0x5D, 0x07, 0x06, 0xFB, 0x37, 0x2F, 0xD5, 0x4A, 0x20,
+    0x1B, 0xDD, 0x26, 0xE6, 0xAC, 0x2E, 0xAC, 0xA0, 0xD5, 0x38, 0x34, 0x13, 0xE9, 0xA3, 0x1E, 0xCB,
+    0xA5, 0x02, 0x9C, 0x37, 0x4A, 0x24, 0x90, 0xA4, 0x32, 0xE5, 0xFA, 0xA4, 0x4B, 0x48, 0x6F, 0xA4,
+    0x9E, 0xA7, 0x5A, 0x0A, 0x23, 0x1E, 0x39, 0x94, 0x15, 0x06, 0x03, 0xC8, 0x4F, 0x21, 0x7E, 0xD3,
+    0xD1, 0x6B, 0x8B, 0xF1, 0x0C, 0x5D, 0xA6, 0xFA, 0x89, 0x4A, 0xEE, 0x3B, 0x61, 0x06, 0xC2, 0xA5,
+    0xAF, 0x1C, 0x16, 0xB6, 0xB6, 0xCE, 0x30, 0xD2, 0x0B, 0xBB, 0x2C, 0xF3, 0xC0, 0x63, 0xA2, 0xC8,
+    0x45, 0xF9, 0x4F, 0x4A, 0xD7, 0x3F, 0x9B, 0x9A, 0x1A, 0x76, 0x66, 0xB1, 0x8D, 0x8B, 0x06, 0x47,
+    0xBE, 0xC1, 0xDC, 0xC0, 0x89, 0x98, 0xC7, 0x4D, 0x5E, 0xD8, 0x81, 0x06, 0x31, 0xF1, 0xCE, 0x59,
+    0x69, 0x02, 0xF4, 0xDE, 0x78, 0x7F, 0xD1, 0xB0, 0xE0, 0x4D, 0x54, 0xBB, 0x98, 0x6F, 0x5C, 0x24,
+    0x3A, 0x10, 0x10, 0xDD, 0x43, 0xBA, 0x02, 0x0E, 0x69, 0x95, 0xF2, 0x61, 0x18, 0x08, 0x6B, 0x12,
+    0x36, 0xD7, 0x30, 0x4F, 0xCE, 0x16, 0x45, 0xCF, 0xAB, 0x75, 0xC2, 0x1A, 0x31, 0xBD, 0x4D, 0x14,
+    0xB2, 0x29, 0xC4, 0xEF, 0xB4, 0x66, 0xC5, 0x09, 0xF3, 0x6B, 0x4B, 0x8E, 0x31, 0x16, 0x3A, 0x43,
+    0x2E, 0x74, 0xA2, 0x39, 0x59, 0x4F, 0xEA, 0xB8, 0xAE, 0x06, 0x18, 0x4A, 0xD1, 0x21, 0x20, 0x6F,
+    0x04, 0x1F, 0x67, 0x35, 0xBD, 0x41, 0xC4, 0x42, 0xC5, 0xCC, 0x6F, 0xC4, 0x31, 0x08, 0xCA, 0x89,
+    0xAD, 0xB5, 0x83, 0x24, 0xD4, 0x98, 0x5F, 0xC3, 0x98, 0x21, 0x47, 0x77, 0xCB, 0x98, 0x85, 0xDD,
+    0xB4, 0xF7, 0xC2, 0xC6, 0xBE, 0x14, 0x65, 0x48, 0x33, 0xE8, 0x94, 0x75, 0xC1, 0xBA, 0x13, 0x2B,
+    0x8F, 0x17, 0xA2, 0x14, 0x8F, 0x4A, 0x94, 0x63, 0x74, 0x32, 0xC8, 0x8F, 0xB5, 0xB8, 0xEF, 0x22,
+    0x37, 0x8C, 0xCA, 0xE4, 0xBC, 0xC2, 0xA4, 0x0C, 0xC6, 0x9C, 0x6C, 0xE9, 0xBD, 0xAE, 0x29, 0x73,
+    0x75, 0xA4, 0x59, 0xCD, 0xC4, 0xA0, 0x8E, 0x4C, 0x58, 0x2C, 0x37, 0xC9, 0x61, 0x17, 0xAC, 0x5D,
+    0xCF, 0x6B, 0xD9, 0xBA, 0x35, 0x03, 0x4F, 0xD2, 0x73, 0xF5, 0xDC, 0xE4, 0xD4, 0xDD, 0x72, 0xB1,
+    0xCD, 0x51, 0x4A, 0x55, 0x81, 0xC3, 0xD6, 0x73, 0x98, 0x1C, 0xE3, 0x5E, 0x62, 0xC6, 0x18, 0xB3,
+    0xE0, 0x6C, 0xEE, 0x87, 0x36, 0x72, 0x73, 0x54, 0xF2, 0xE4, 0x02, 0x8B, 0x0D, 0xFA, 0x8C, 0x9A,
+    0x5E, 0xF7, 0xF8, 0x8C, 0x8C, 0xC5, 0x7D, 0xC0, 0x42, 0x97, 0x18, 0x0F, 0xD0, 0x4B, 0x75, 0xA6,
+    0x97, 0x37, 0x6C, 0xB6, 0x2C, 0xF1, 0x59, 0x5E, 0x07, 0x94, 0x75, 0xEF, 0xA5, 0x7A, 0xB8, 0xD0,
+    0xB2, 0xE1, 0x3F, 0x56, 0xFB, 0xA9, 0xF9, 0x60, 0x43, 0x04, 0x93, 0xD8, 0x4F, 0x0C, 0xFB, 0xF8,
+    0x43, 0xEC, 0xE3, 0x1E, 0xDE, 0x12, 0xD4, 0x42, 0x9B, 0xE8, 0x54, 0x71, 0x67, 0x84, 0xF4, 0xD6,
+    0xE7, 0x67, 0xC4, 0x25, 0x52, 0x8B, 0x9E, 0xC2, 0x31, 0xE2, 0xAA, 0x6E, 0xE7, 0xCB, 0x4C, 0xB2,
+    0x47, 0xE2, 0x27, 0xB7, 0xC3, 0x3A, 0x62, 0x8C, 0x46, 0x95, 0x2C, 0x3D, 0x3E, 0x38, 0xF8, 0xF9,
+    0x6F, 0x77, 0xDE, 0x97, 0x07, 0x07, 0x77, 0xF8, 0x8B, 0x8B, 0x54, 0x04, 0x1B, 0x16, 0x6E, 0xC1,
+    0x29, 0x59, 0xB2, 0x6E, 0xA4, 0x8A, 0xFE, 0x96, 0xC8, 0x5E, 0x60, 0xA1, 0xC0, 0x97, 0xDD, 0x8D,
+    0xDD, 0xE5, 0x55, 0xE4, 0x57, 0x71, 0x31, 0x0E, 0x64, 0x92, 0x74, 0x19, 0x62, 0x4A, 0x1D, 0x55,
+    0xC8, 0x14, 0x5F, 0xB8, 0x24, 0xDA, 0x6F, 0x98, 0x01, 0x7B, 0x3B, 0xF0, 0x1E, 0x2E, 0x5F, 0xBE,
+    0xAC, 0x7B, 0x57, 0x61, 0xBF, 0x48, 0x5C, 0xE8, 0xED, 0x59, 0xDD, 0xB1, 0x12, 0x37, 0x5E, 0x74,
+    0x5A, 0xDC, 0x6D, 0x3B, 0x79, 0xAA, 0xA6, 0xAD, 0x7E, 0x06, 0xD7, 0xDA, 0xED, 0xC0, 0xEE, 0x4C,
+    0xF3, 0xC8, 0xB4, 0x8F, 0x72, 0x61, 0xF2, 0xA3, 0x3C, 0xD1, 0xD3, 0x69, 0xB7, 0xF5, 0xDC, 0xED,
+    0xC9, 0xD2, 0xAB, 0x3C, 0x2A, 0xDE, 0x6B, 0xAA, 0xC7, 0x5D, 0x76, 0x09, 0xE2, 0xEC, 0x0B, 0x62,
+    0x9D, 0xF8, 0xDB, 0x7C, 0x28, 0xD6, 0xAF, 0x98, 0x30, 0x21, 0x76, 0x5F, 0x97, 0x92, 0x3F, 0x34,
+    0xD2, 0xEF, 0x0B, 0xE4, 0x1D, 0x8E, 0xC0, 0x0C, 0x19, 0xFB, 0xB6, 0x4A, 0x74, 0x72, 0x72, 0xC8,
+    0xBE, 0xE1, 0xB2, 0xBF, 0xEE, 0x58, 0x56, 0x33, 0x87, 0xBC, 0x6A, 0xD0, 0xED, 0x11, 0x54, 0x19,
+    0xBA, 0xC4, 0x9F, 0x22, 0xF3, 0x55, 0x6C, 0x53, 0x33, 0x40, 0xD8, 0xA2, 0x76, 0x8C, 0x61, 0xAA,
+    0x12, 0x7D, 0xFA, 0x79, 0x29, 0x7D, 0x89, 0xB3, 0x43, 0x0E, 0x45, 0x2F, 0x0C, 0x37, 0xF7, 0xC2,
+    0x37, 0x9A, 0xDB, 0x16, 0x19, 0x7D, 0xDA, 0x85, 0xAF, 0x24, 0x4D, 0x9B, 0xB6, 0xF2, 0x2A, 0x66,
+    0xB6, 0x23, 0xF5, 0x4E, 0x18, 0x5D, 0x0E, 0x71, 0x28, 0x4C, 0x18, 0x4E, 0x06, 0x09, 0x4D, 0x18,
+    0x96, 0x40, 0xF8, 0x8F, 0xCB, 0xD7, 0x57, 0xDB, 0x4C, 0xAA, 0xE4, 0x27, 0x63, 0x6B, 0x67, 0xBE,
+    0x59, 0x12, 0xFE, 0x25, 0x12, 0xBF, 0x42, 0x97, 0x75, 0x2C, 0x31, 0x27, 0x63, 0x55, 0xC6, 0x21,
+    0x99, 0x21, 0x79, 0x68, 0x90, 0xB1, 0xB7, 0xE7, 0x39, 0xE2, 0x67, 0x0E, 0xF2, 0x3B, 0x15, 0x5A,
+    0x4E, 0x38, 0x87, 0xDE, 0x55, 0x1D, 0x53, 0x69, 0xC2, 0xBF, 0xC2, 0x52, 0xD4, 0x68, 0x08, 0x63,
+    0xE2, 0x6D, 0xB7, 0x9E, 0x05, 0x7A, 0x88, 0x9A, 0x09, 0x19, 0x5E, 0x2F, 0xA4, 0xAF, 0xC4, 0xC9,
+    0xAF, 0xEB, 0xFB, 0xA0, 0xD9, 0x95, 0x8D, 0x7C, 0xE1, 0xCD, 0x88, 0x7F, 0xA4, 0xFF, 0x61, 0x1A,
+    0x54, 0x0F, 0x7E, 0x11, 0x7E, 0x49, 0xFE, 0xFE, 0x65, 0xDA, 0xDC, 0xFF, 0xCF, 0xF9, 0x0B, 0x9D,
+    0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0x01, 0x46, 0xC8, 0x12, 0x43, 0x83, 0x84, 0x2E,
+    0xD2, 0xB9, 0x47, 0xBA, 0x75, 0x7B, 0xC5, 0xF8, 0x6C, 0x81, 0x14, 0x0A, 0x0A, 0x52, 0x10, 0x9A,
+    0xFC, 0x0D, 0x88, 0x76, 0x8B, 0xCD, 0xED, 0x90, 0x2B, 0x52, 0xD0, 0xE4, 0x4F, 0xA0, 0x4E, 0x0A,
+    0x52, 0x6C, 0xE1, 0x62, 0x73, 0x3B, 0x21, 0x45, 0x4A, 0x46, 0x08, 0x29, 0x45, 0x84, 0x62, 0x85,
+    0x20, 0x24, 0x22, 0x11, 0x0B, 0x39, 0x62, 0xA5, 0xEC, 0xDD, 0xF0, 0x3D, 0xFB, 0x76, 0x05, 0x84,
+    0x0A, 0xEF, 0x5A, 0x77, 0xFB, 0xE6, 0xFD, 0xF8, 0xDE, 0x7B, 0xDF, 0x7B, 0x03, 0xF0, 0x49, 0x63,
+    0x8F, 0x22, 0x9E, 0xE1, 0x1C, 0xEF, 0xA7, 0x3D, 0xA0, 0x03, 0x60, 0x1C, 0x90, 0xF3, 0x68, 0xC2,
+    0xB7, 0xC4, 0x7B, 0x9F, 0x95, 0xA8, 0x7A, 0x8B, 0x0F, 0xF8, 0xA2, 0x2B, 0x91, 0x74, 0x47, 0x48,
+    0xDB, 0x02, 0x2A, 0x18, 0xAF, 0xBC, 0x3E, 0x8F, 0x1E, 0xAB, 0xF3, 0x5A, 0x5C, 0xA1, 0x83, 0xC1,
+    0x0C, 0xDA, 0x4F, 0xA8, 0x60, 0x6A, 0xF4, 0xCA, 0xC3, 0x26, 0x22, 0x6C, 0x44, 0x78, 0xF5, 0xF3,
+    0xD6, 0xC4, 0xD8, 0xAB, 0xDF, 0x6E, 0x2F, 0x29, 0xCC, 0x29, 0xCC, 0x5C, 0x89, 0x34, 0x18, 0xEC,
+    0x34, 0xB7, 0x42, 0x45, 0x14, 0xAB, 0x3E, 0x89, 0x8E, 0x2E, 0xB5, 0x17, 0x20, 0x3D, 0xA8, 0x42,
+    0x50, 0x53, 0xBA, 0x06, 0x7D, 0x5B, 0xE2, 0xA0, 0x2A, 0xF1, 0x51, 0xE5, 0xD2, 0xB3, 0x24, 0x76,
+    0x8C, 0x4F, 0x80, 0x33, 0xD0, 0x05, 0xB5, 0x29, 0xA5, 0x02, 0x75, 0xF9, 0xA5, 0x37, 0x1A, 0xD3,
+    0x0F, 0xF5, 0x69, 0xCA, 0x78, 0x66, 0x48, 0x70, 0x22, 0xE9, 0x89, 0xD1, 0x12, 0x97, 0x7B, 0xC4,
+    0x16, 0xB7, 0x87, 0x1C, 0x9A, 0xA4, 0x4D, 0xBB, 0xB4, 0xCD, 0xBC, 0x0A, 0xCC, 0xD2, 0x2F, 0xA1,
+    0xBF, 0x63, 0xA8, 0xAF, 0x3D, 0xCC, 0x97, 0xB4, 0x3C, 0xE7, 0xFB, 0x82, 0xE6, 0x9F, 0x38, 0x4C,
+    0xE8, 0xB2, 0xA4, 0x73, 0x9B, 0x76, 0xF4, 0xD2, 0x33, 0x76, 0xC3, 0xCF, 0x8C, 0xFF, 0x1D, 0x89,
+    0x9F, 0x7D, 0x89, 0x5D, 0x4A, 0xE8, 0x99, 0x44, 0xEE, 0x25, 0xB6, 0xA4, 0xB8, 0x95, 0x5A, 0x81,
+    0xB4, 0x8A, 0x4F, 0xE2, 0x26, 0xD9, 0x00, 0x73, 0xAC, 0x80, 0xCA, 0x17, 0x1E, 0x45, 0x6B, 0x16,
+    0x30, 0x0B, 0xF5, 0x13, 0xB2, 0x59, 0xF2, 0xAB, 0x53, 0xDF, 0xA3, 0x69, 0xD5, 0x23, 0x5F, 0xDA,
+    0xE4, 0x69, 0x6B, 0x0C, 0xBA, 0x5E, 0x3D, 0xF0, 0x53, 0x9B, 0xB4, 0x77, 0x6D, 0x8E, 0xC5, 0x01,
+    0x41, 0x94, 0xFA, 0x53, 0xD6, 0x3B, 0x79, 0x5E, 0xF7, 0xDA, 0xCF, 0x3D, 0x4F, 0x4C, 0xE0, 0x89,
+    0xEA, 0x32, 0x67, 0xC1, 0x44, 0x90, 0xF4, 0xD0, 0xEE, 0x54, 0x9A, 0xE6, 0xD1, 0x9B, 0x1E, 0x56,
+    0x3D, 0x41, 0x9E, 0xFC, 0xEC, 0xB5, 0x6B, 0x9A, 0x34, 0x94, 0x39, 0x85, 0x2A, 0x58, 0xE5, 0x9B,
+    0x9C, 0xA6, 0x99, 0x5B, 0xA8, 0x1F, 0x42, 0x89, 0x69, 0x67, 0x60, 0xAC, 0xF6, 0xE9, 0x8B, 0xA4,
+    0xC5, 0xDC, 0x11, 0x51, 0xB0, 0x48, 0xBB, 0xA1, 0xCF, 0x48, 0x58, 0x2C, 0x15, 0x63, 0xAD, 0x7A,
+    0xD5, 0xA9, 0x0E, 0x47, 0x94, 0x67, 0x5E, 0x8A, 0xCE, 0xF2, 0x5B, 0x96, 0xD5, 0x30, 0x55, 0xF5,
+    0x20, 0xB0, 0x05, 0x34, 0x58, 0xB2, 0xC2, 0x47, 0x14, 0xE4, 0x1F, 0xB1, 0x73, 0x2C, 0x67, 0xE6,
+    0x8D, 0xCF, 0x42, 0x12, 0x57, 0x01, 0x19, 0x3B, 0x3C, 0x3C, 0xF1, 0x19, 0xF2, 0x48, 0xAC, 0x39,
+    0x9B, 0x3F, 0x53, 0xE4, 0xD5, 0x0C, 0x36, 0x73, 0x9A, 0x3E, 0xD7, 0xA6, 0x9E, 0x23, 0x46, 0x9F,
+    0xC7, 0x5B, 0x4C, 0x45, 0x1A, 0xC6, 0xD2, 0x49, 0xD3, 0x58, 0x3C, 0x69, 0xB5, 0x19, 0xA9, 0xF7,
+    0x7F, 0x31, 0xA9, 0xFF, 0xC6, 0xA4, 0x19, 0x0A, 0xD7, 0xF9, 0x66, 0x8C, 0x02, 0xB6, 0x07, 0x6F,
+    0xFE, 0x0D, 0xA4, 0x7F, 0x1D, 0xE4, 0xD5, 0x53, 0x82, 0xAC, 0xF3, 0x3B, 0x3E, 0x6D, 0x4B, 0x94,
+    0x69, 0xAB, 0x7C, 0x2E, 0x9C, 0xD0, 0x3E, 0xF3, 0x0D, 0xAC, 0xA9, 0x95, 0x38, 0x84, 0x8E, 0xB7,
+    0x4C, 0x5C, 0x67, 0xE1, 0x6D, 0x25, 0x38, 0x06, 0xB6, 0x72, 0xD8, 0xD2, 0x35, 0x50, 0x50, 0x40,
+    0x6A, 0x65, 0xAD, 0xB0, 0x51, 0xF8, 0xC9, 0x2C, 0xD3, 0xEE, 0x4A, 0xB2, 0x2E, 0x5E, 0xAC, 0x35,
+    0x47, 0x94, 0xCF, 0x3C, 0xC6, 0x6F, 0x63, 0x0C, 0x32, 0x1B, 0xA3, 0xE9, 0x64, 0xC8, 0xFE, 0xB5,
+    0xDF, 0x7E, 0xEB, 0x7A, 0xF7, 0x1B, 0x6C, 0xE1, 0x38, 0x84, 0xA5, 0x4C, 0x26, 0xB0, 0x10, 0xE6,
+    0xCA, 0x20, 0x91, 0x95, 0xDA, 0xDB, 0x51, 0x48, 0xB0, 0xA4, 0xF2, 0x56, 0x78, 0xA1, 0xD9, 0xD3,
+    0xFD, 0x92, 0x9F, 0x7B, 0x30, 0xAF, 0xCE, 0x38, 0x94, 0x67, 0x63, 0xB1, 0x17, 0x48, 0x9F, 0x52,
+    0xF3, 0x63, 0x87, 0x65, 0x4E, 0x04, 0x16, 0x05, 0x31, 0x70, 0x8A, 0x33, 0x67, 0x98, 0xB6, 0xB8,
+    0x5E, 0x18, 0x3A, 0x60, 0xC8, 0x13, 0x8F, 0x7D, 0x02, 0x99, 0x11, 0xD2, 0x2B, 0x82, 0x61, 0x29,
+    0x0D, 0x01, 0x57, 0x90, 0x51, 0x36, 0x20, 0xAF, 0xB9, 0x75, 0x66, 0x16, 0x55, 0x6D, 0x4E, 0x7C,
+    0xD6, 0xA3, 0xB3, 0xF8, 0xB3, 0x9E, 0x28, 0x7F, 0x30, 0x55, 0xDE, 0xAA, 0x87, 0xAE, 0x51, 0x7E,
+    0x3A, 0xA5, 0x4F, 0xA3, 0xBF, 0xEA, 0xD4, 0xFD, 0xF6, 0xB0, 0x84, 0xB5, 0xEA, 0xA6, 0xE7, 0x89,
+    0x5D, 0xC0, 0x2E, 0x38, 0x1C, 0x24, 0x73, 0xD9, 0x62, 0x12, 0xE8, 0x3A, 0xDD, 0xA0, 0x72, 0x28,
+    0x6A, 0xB6, 0x9F, 0xDD, 0x3F, 0x1A, 0x36, 0x82, 0x76, 0x69, 0x3B, 0x6C, 0x16, 0xD9, 0x14, 0x2C,
+    0x76, 0x76, 0x83, 0x48, 0x2C, 0xAB, 0xA3, 0x38, 0xC5, 0xC8, 0x89, 0x05, 0x2C, 0x3F, 0x27, 0x8F,
+    0xC5, 0x27, 0xB8, 0xE4, 0x0F, 0x4A, 0x38, 0x12, 0xEC, 0x8B, 0x38, 0xE1, 0xDC, 0xCE, 0xF8, 0x61,
+    0xFF, 0x02, 0x3B, 0x38, 0x91, 0xF5, 0x74, 0xD3, 0x27, 0x04, 0xC9, 0xB9, 0xCF, 0xDC, 0x24, 0xE9,
+    0x12, 0x6E, 0x44, 0xCE, 0x0C, 0x5E, 0x92, 0x6D, 0xF7, 0xD8, 0x23, 0x07, 0x06, 0xDF, 0xB2, 0x94,
+    0x51, 0xB4, 0xDB, 0xB1, 0xB4, 0x1B, 0x7A, 0xB8, 0xE1, 0xC8, 0x4B, 0x1C, 0x06, 0x15, 0x4E, 0x08,
+    0xBF, 0xF2, 0x61, 0xCF, 0x0E, 0x38, 0xC4, 0xF8, 0x5F, 0xA2, 0x74, 0x2B, 0xA2, 0x8B, 0x2A, 0xC6,
+    0xE1, 0x45, 0xD1, 0x21, 0xFA, 0x71, 0x23, 0x36, 0x5C, 0xA1, 0x42, 0x18, 0x2B, 0x5D, 0xDE, 0x6E,
+    0x44, 0x1E, 0xED, 0x4B, 0x97, 0xF8, 0xD7, 0x08, 0x0E, 0x39, 0xAA, 0x51, 0xD1, 0xCA, 0xE1, 0x50,
+    0x2A, 0xEB, 0x0F, 0xD2, 0xB0, 0xCF, 0x82, 0xC8, 0x77, 0xA1, 0xDD, 0x74, 0x94, 0xA1, 0x0A, 0xFA,
+    0xEC, 0x62, 0x37, 0x39, 0x7A, 0x1E, 0x36, 0x96, 0x11, 0xEB, 0x83, 0xDD, 0xC6, 0x9A, 0x8A, 0xA7,
+    0x0B, 0xE9, 0x04, 0xF3, 0x20, 0x55, 0x7B, 0x07, 0xB2, 0x64, 0xA4, 0x88, 0xFA, 0x0B, 0x86, 0xE7,
+    0xEE, 0xCB, 0x6A, 0x7A, 0xC4, 0x34, 0x0D, 0x19, 0x35, 0xC9, 0x06, 0xDA, 0xDF, 0xAF, 0xF1, 0x46,
+    0x11, 0xD7, 0x91, 0x73, 0x6A, 0xD2, 0xD6, 0x2A, 0x87, 0xBD, 0xA4, 0x9E, 0xBF, 0x6C, 0x8F, 0xAF,
+    0xF5, 0x25, 0x36, 0x05, 0x0A, 0x53, 0xB3, 0xB8, 0xC2, 0xAB, 0x9E, 0x5B, 0x94, 0x97, 0x4E, 0xE6,
+    0xF2, 0x1B, 0x5D, 0x1E, 0xAA, 0x7B, 0x77, 0xF5, 0x99, 0x1D, 0x68, 0xC7, 0x82, 0x32, 0x43, 0x59,
+    0xEF, 0x66, 0x58, 0xD5, 0xD8, 0x7F, 0xCB, 0xA5, 0x8F, 0x22, 0x8E, 0x7E, 0xD9, 0x70, 0xEC, 0xFD,
+    0x31, 0xE7, 0x91, 0x55, 0x19, 0x06, 0x4E, 0xFB, 0x4E, 0xB8, 0x69, 0x3E, 0x64, 0x8B, 0x2A, 0x77,
+    0x5D, 0x3D, 0x59, 0xB9, 0xC3, 0x79, 0x18, 0xBC, 0xEC, 0xDD, 0xD2, 0x31, 0x1C, 0x5F, 0x26, 0xB3,
+    0x87, 0x3D, 0xBD, 0xBB, 0x60, 0x82, 0x38, 0x67, 0x45, 0xAB, 0x3B, 0xAE, 0xB8, 0xE0, 0xB9, 0x4C,
+    0x12, 0x0F, 0x65, 0xC6, 0xAC, 0xF4, 0x34, 0xF9, 0x66, 0x96, 0xC4, 0xC7, 0xEE, 0xF4, 0x5A, 0x6F,
+    0xEA, 0x4A, 0xF1, 0x9E, 0x28, 0xE5, 0x16, 0x48, 0x43, 0x83, 0x72, 0xDC, 0x04, 0x1B, 0x82, 0x76,
+    0x4B, 0xDD, 0xAB, 0x57, 0x8F, 0x91, 0xF7, 0xE3, 0xBA, 0xDC, 0xAB, 0x75, 0xF4, 0xC7, 0xF9, 0x49,
+    0xE0, 0x20, 0x34, 0x5D, 0xF6, 0xF0, 0xF9, 0x59, 0x11, 0xDD, 0x7A, 0x17, 0xEF, 0xDD, 0xEA, 0x8E,
+    0x2F, 0xCE, 0xB1, 0x7B, 0x56, 0xBC, 0xA8, 0x7E, 0x1F, 0x72, 0x95, 0x85, 0x27, 0xCC, 0xB9, 0x7E,
+    0x85, 0x8B, 0xC7, 0xE3, 0xD2, 0x8F, 0x60, 0x1F, 0x86, 0xF4, 0xD5, 0x05, 0x47, 0x9A, 0x11, 0x9B,
+    0x19, 0x2F, 0x3F, 0x41, 0x2B, 0xF5, 0x29, 0xC7, 0xE2, 0xC8, 0x86, 0x9C, 0x8C, 0xFA, 0xB4, 0x96,
+    0x2D, 0xF3, 0xCF, 0xE7, 0x2F, 0x7D, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xBB, 0x13, 0x7B,
+    0x45, 0x46, 0xF1, 0xB8, 0xB0, 0x04, 0x32, 0xE6, 0xB6, 0x49, 0x83, 0x65, 0xFB, 0x1A, 0x4B, 0x49,
+    0xB1, 0x6B, 0x0F, 0xF1, 0x1F, 0xB0, 0x50, 0x5C, 0x21, 0x91, 0x86, 0x0A, 0x01, 0x71, 0x41, 0x71,
+    0x48, 0x6B, 0xDF, 0xC8, 0x29, 0x28, 0xD2, 0x50, 0x20, 0x5A, 0x28, 0x82, 0x48, 0xAC, 0x48, 0x18,
+    0xC9, 0xA0, 0x93, 0x70, 0xF0, 0x38, 0x29, 0x52, 0xD0, 0x4C, 0x88, 0x44, 0x84, 0xD2, 0x6C, 0xA4,
+    0xB8, 0x89, 0x48, 0xB2, 0x28, 0x0B, 0x3A, 0x42, 0x7C, 0xC3, 0x9B, 0xBD, 0xC4, 0x10, 0x14, 0xB1,
+    0x77, 0xA7, 0xBB, 0x9D, 0xF9, 0xF6, 0xFB, 0xDE, 0xF7, 0xDE, 0xFB, 0xE6, 0x30, 0x6A, 0x96, 0x13,
+    0xFF, 0x76, 0xFC, 0xE7, 0x59, 0x97, 0xE3, 0x89, 0xB4, 0xD2, 0xD6, 0xE8, 0xA5, 0x50, 0x1B, 0x25,
+    0xEA, 0x39, 0xA4, 0xC2, 0x89, 0x6A, 0x0E, 0xEB, 0x71, 0x95, 0x3A, 0xF5, 0xB0, 0x40, 0xF7, 0xA6,
+    0x05, 0x0A, 0x40, 0x1A, 0xA0, 0x1A, 0xC1, 0x02, 0xBA, 0xDE, 0xC6, 0xDE, 0x1D, 0xAE, 0xD5, 0x80,
+    0x02, 0xB7, 0x80, 0xD6, 0xA8, 0x89, 0x6F, 0x79, 0xBD, 0xB0, 0xBF, 0x23, 0x6A, 0x61, 0xD7, 0x91,
+    0x49, 0x9B, 0xD8, 0x1E, 0x7A, 0x4A, 0x2B, 0x5D, 0xA1, 0x62, 0x85, 0xB8, 0x8C, 0xAA, 0x1C, 0x73,
+    0xC2, 0x0A, 0x97, 0x21, 0x03, 0xC6, 0xE3, 0x52, 0x99, 0x23, 0x40, 0xA4, 0xE7, 0xC0, 0x47, 0x52,
+    0x74, 0xB8, 0xA0, 0xB3, 0xA8, 0x92, 0x26, 0x47, 0x25, 0x58, 0x18, 0xE3, 0x88, 0x4B, 0x28, 0x03,
+    0x46, 0x85, 0x38, 0xCC, 0x85, 0x8A, 0xDC, 0x49, 0x81, 0x0E, 0x62, 0x07, 0xA5, 0x99, 0x28, 0xAA,
+    0x02, 0x94, 0x3C, 0xA0, 0x18, 0x6E, 0xF5, 0x20, 0x1C, 0xBF, 0x55, 0x8D, 0x45, 0xFD, 0x1F, 0xA4,
+    0x51, 0x40, 0x8A, 0xD3, 0x71, 0x99, 0xEA, 0x3C, 0x71, 0x62, 0xAF, 0x46, 0xB1, 0x06, 0xF9, 0xB9,
+    0xC6, 0xF7, 0xAC, 0xE3, 0x81, 0x7E, 0x8D, 0x34, 0xB1, 0x71, 0x99, 0x23, 0x8F, 0x09, 0x81, 0x70,
+    0x98, 0x0D, 0x45, 0x03, 0x0C, 0x55, 0x62, 0x9F, 0x22, 0xED, 0xC5, 0xEE, 0x79, 0xA4, 0xFA, 0x62,
+    0x74, 0x01, 0xDF, 0xF8, 0xAB, 0xDE, 0xE6, 0xFB, 0x7F, 0xDC, 0xA8, 0x95, 0x6B, 0xDB, 0x3C, 0x29,
+    0xA5, 0x53, 0x6F, 0x54, 0xCC, 0xE3, 0x7A, 0x2C, 0xCF, 0xDE, 0x33, 0x14, 0x8A, 0xC0, 0xE6, 0x12,
+    0x2B, 0x8D, 0x3A, 0x55, 0x92, 0x6B, 0x92, 0x4F, 0x72, 0xB2, 0xC3, 0x1D, 0x36, 0x79, 0x09, 0xB3,
+    0xDD, 0x5A, 0x3C, 0x3C, 0x63, 0x17, 0x4D, 0x91, 0x94, 0x89, 0xDD, 0xE1, 0x96, 0x91, 0xA6, 0x46,
+    0x5F, 0x81, 0xE9, 0x22, 0xCA, 0xD3, 0x16, 0xAE, 0x81, 0x98, 0x58, 0xD6, 0x9E, 0xD4, 0x91, 0xAF,
+    0xE5, 0xFE, 0x4E, 0xAA, 0x17, 0x16, 0x90, 0x66, 0x48, 0x0B, 0xA4, 0x3D, 0xCC, 0xD5, 0x58, 0xA8,
+    0x91, 0x51, 0x80, 0x22, 0xAA, 0xDA, 0x5F, 0x3B, 0x39, 0x08, 0x14, 0x62, 0x7C, 0x12, 0xF1, 0x75,
+    0x0F, 0xF5, 0x51, 0x97, 0xDC, 0x64, 0x51, 0x3F, 0xF4, 0x24, 0xD8, 0x95, 0x22, 0xC0, 0x42, 0xD8,
+    0x38, 0xE8, 0xA4, 0x59, 0x51, 0xF4, 0x13, 0xA7, 0xD6, 0x07, 0xC8, 0xBA, 0x2E, 0x50, 0x16, 0x08,
+    0xCC, 0x87, 0x3A, 0x87, 0x6E, 0x5B, 0x21, 0xD5, 0x64, 0xA4, 0xBB, 0xBF, 0x97, 0xEB, 0x6F, 0x6D,
+    0xD3, 0x46, 0x6D, 0xB4, 0x95, 0x96, 0x1F, 0x5B, 0xF1, 0x13, 0x5D, 0xD4, 0x43, 0x91, 0x63, 0x51,
+    0x9A, 0x74, 0x83, 0x26, 0x5A, 0xBC, 0x52, 0x25, 0x07, 0x14, 0x3B, 0x6D, 0x92, 0x50, 0x97, 0x90,
+    0x23, 0x6B, 0x52, 0xE8, 0x0B, 0x32, 0x75, 0xF9, 0x3E, 0x0E, 0x90, 0x94, 0x87, 0xB2, 0xA9, 0x20,
+    0x58, 0x10, 0x3D, 0x28, 0x1B, 0x62, 0xF1, 0xAE, 0x56, 0xDE, 0x1E, 0x4C, 0x0E, 0xA5, 0x5D, 0x00,
+    0xBA, 0x1A, 0x8B, 0x06, 0xA9, 0x09, 0xB7, 0xD9, 0x78, 0x5C, 0x3D, 0xDE, 0x3D, 0xE5, 0xEB, 0xA6,
+    0x39, 0x8D, 0x55, 0x3E, 0xD4, 0x3E, 0xBD, 0xEB, 0x93, 0x7D, 0x3E, 0x5A, 0x90, 0x4E, 0x69, 0x98,
+    0xF3, 0xD9, 0xCF, 0xE8, 0xB1, 0x69, 0x97, 0x8C, 0x1B, 0x41, 0xB4, 0x44, 0x02, 0x2B, 0xD4, 0x24,
+    0x3E, 0x45, 0x2A, 0x4D, 0x72, 0x6E, 0x78, 0x5F, 0xA0, 0x68, 0x1D, 0x42, 0xEF, 0x5E, 0xD9, 0x92,
+    0x01, 0x3A, 0xB0, 0x8C, 0x91, 0x6D, 0xE4, 0xEC, 0xAB, 0xC3, 0x90, 0xB8, 0xCA, 0x84, 0xCD, 0xA4,
+    0xC9, 0x14, 0xB2, 0x39, 0xE4, 0x19, 0x66, 0xC9, 0x76, 0x85, 0x94, 0x96, 0xB3, 0x34, 0xEC, 0x32,
+    0xDE, 0xA4, 0xEE, 0xF2, 0xBC, 0x21, 0xBF, 0xAD, 0xE8, 0x7E, 0x5C, 0x76, 0x54, 0x47, 0x45, 0x65,
+    0xA7, 0x2C, 0x92, 0x73, 0xD7, 0xCE, 0xB9, 0xB4, 0x35, 0x96, 0xA2, 0xD8, 0x3A, 0x59, 0xE3, 0x91,
+    0x79, 0x64, 0xC5, 0xAF, 0xE2, 0x3E, 0x54, 0xA9, 0x2A, 0xAA, 0xC1, 0xA6, 0x9E, 0xF0, 0x45, 0x07,
+    0x84, 0x81, 0xD8, 0x09, 0x23, 0x23, 0x97, 0x1C, 0x0A, 0x1A, 0x9E, 0xDA, 0xB1, 0xDF, 0x88, 0x5D,
+    0x76, 0x2D, 0x54, 0x86, 0x40, 0x33, 0xDD, 0xD0, 0x46, 0x4F, 0x06, 0x07, 0x10, 0x1E, 0xC9, 0xCB,
+    0xF9, 0x21, 0x7E, 0x0A, 0x99, 0xC5, 0x15, 0x88, 0x91, 0x23, 0xC8, 0xB1, 0x20, 0xA1, 0xB3, 0x1C,
+    0x9B, 0xD7, 0x02, 0xE7, 0xDB, 0xC0, 0x18, 0x29, 0x55, 0x54, 0x41, 0x51, 0x46, 0x72, 0xCC, 0x1C,
+    0x8D, 0x1C, 0xE8, 0x33, 0x37, 0xB7, 0xBA, 0x14, 0x1A, 0x2B, 0x2B, 0x91, 0xF7, 0x58, 0x59, 0x0B,
+    0xAB, 0x4C, 0x95, 0xD8, 0x10, 0x99, 0xFF, 0x73, 0x47, 0xE2, 0x17, 0x37, 0xBF, 0xE8, 0xFA, 0x32,
+    0xDC, 0x0F, 0x48, 0x6D, 0xA8, 0x85, 0xC4, 0x60, 0x3B, 0xC8, 0x57, 0x61, 0x8D, 0x1A, 0xC9, 0x32,
+    0xE8, 0xDD, 0xAC, 0x76, 0x20, 0x35, 0x57, 0x9B, 0x2D, 0x55, 0x32, 0xFC, 0xBB, 0xDB, 0xEF, 0xFF,
+    0xE7, 0xBD, 0x1D, 0xD4, 0x27, 0x0B, 0x69, 0x13, 0x83, 0xA8, 0xC4, 0xEC, 0x30, 0x69, 0x98, 0x71,
+    0x17, 0x5D, 0x61, 0xCA, 0xE6, 0xF1, 0x56, 0x58, 0xC8, 0xC2, 0x56, 0x0F, 0x3E, 0x1C, 0x0C, 0x23,
+    0x9A, 0x63, 0xAB, 0xBF, 0xFA, 0x8C, 0x0E, 0x38, 0x7A, 0x17, 0xC7, 0x1B, 0x06, 0xDF, 0x69, 0xAC,
+    0xE0, 0x22, 0x17, 0x93, 0x1C, 0x61, 0x13, 0x23, 0x79, 0x04, 0x85, 0xE9, 0x6A, 0xD3, 0x3E, 0xAF,
+    0x37, 0x4E, 0x11, 0xB4, 0xA2, 0x46, 0xBB, 0x1F, 0xF9, 0x7E, 0xD2, 0x1C, 0x30, 0xED, 0xC6, 0xDF,
+    0x59, 0x73, 0x5A, 0x0C, 0xDF, 0xBC, 0x6D, 0x6B, 0x43, 0xEB, 0x45, 0x03, 0x26, 0x43, 0xE4, 0x42,
+    0xD2, 0xE1, 0xD5, 0xAD, 0x11, 0xFB, 0x27, 0x48, 0xDC, 0x91, 0x86, 0xC2, 0x70, 0x00, 0x12, 0x78,
+    0x33, 0x15, 0x64, 0x3A, 0xFE, 0xE1, 0x12, 0xA4, 0x1F, 0x34, 0x49, 0xC2, 0xE1, 0x11, 0x4E, 0x9E,
+    0x60, 0x64, 0x9A, 0xBA, 0x99, 0xA3, 0x45, 0xEF, 0x4D, 0xF8, 0x70, 0x65, 0x6F, 0xF9, 0xB6, 0xF7,
+    0xF2, 0x06, 0x6D, 0x58, 0x96, 0xF1, 0x35, 0x2D, 0x83, 0xA3, 0x84, 0xF3, 0xFE, 0xC7, 0x57, 0xCF,
+    0x6B, 0x1C, 0x09, 0x1D, 0xE7, 0xAC, 0xD0, 0x0B, 0x66, 0x08, 0x9D, 0xE4, 0x90, 0xA7, 0x4A, 0xB4,
+    0xB8, 0x9E, 0x31, 0xE7, 0x5F, 0x06, 0x2F, 0x0F, 0x96, 0xE3, 0x90, 0x29, 0x54, 0xEF, 0x00, 0xDE,
+    0xDB, 0x24, 0x14, 0x66, 0x1B, 0x51, 0x28, 0x46, 0x6C, 0x43, 0x7A, 0xBF, 0x0D, 0xAA, 0xBE, 0x72,
+    0x48, 0x35, 0x2F, 0xE9, 0x8D, 0xBA, 0xC7, 0xD9, 0x6F, 0x02, 0xD9, 0xAA, 0xA4, 0xCB, 0xBC, 0x11,
+    0x7B, 0xFD, 0xD8, 0xAA, 0x50, 0x2C, 0x8F, 0xCA, 0x84, 0x03, 0xD1, 0x2D, 0x11, 0xD1, 0x92, 0x24,
+    0x28, 0xC4, 0xD5, 0xC9, 0xBD, 0x27, 0xD8, 0xAD, 0x9F, 0xB2, 0x50, 0xE4, 0x9D, 0xEC, 0xE9, 0x4F,
+    0x9C, 0x65, 0x55, 0xF5, 0xE9, 0x59, 0x83, 0xE0, 0x8F, 0x31, 0xAC, 0x08, 0xBB, 0x95, 0x0E, 0x92,
+    0x25, 0x5D, 0x4F, 0xC8, 0x29, 0xC2, 0x98, 0xDA, 0x62, 0xE4, 0x09, 0x43, 0x12, 0x1E, 0x50, 0x3A,
+    0x71, 0x99, 0x1D, 0x1C, 0x5B, 0x65, 0xD5, 0x79, 0xC7, 0x59, 0xBF, 0x6A, 0x77, 0xFB, 0x63, 0xC2,
+    0x4C, 0xEB, 0x8A, 0x5E, 0x51, 0x48, 0xEE, 0x8E, 0x56, 0x88, 0xFC, 0xC1, 0xB3, 0xD4, 0xF2, 0x97,
+    0xD9, 0xB5, 0x0F, 0x67, 0xB6, 0x66, 0xCA, 0x93, 0xE5, 0x7C, 0x55, 0x77, 0x57, 0x27, 0xC6, 0xA1,
+    0xC7, 0x93, 0x0D, 0x57, 0xB4, 0xE4, 0x5E, 0xB5, 0xC3, 0xFF, 0xAB, 0x3A, 0xB9, 0x5A, 0xAA, 0x25,
+    0xDB, 0x92, 0x9A, 0x13, 0x39, 0x3E, 0x81, 0xE9, 0xCD, 0xCD, 0x33, 0x9E, 0xDE, 0x0C, 0x8C, 0x50,
+    0x92, 0x64, 0x88, 0x7D, 0x7E, 0xFA, 0xA2, 0xBF, 0xB3, 0xF2, 0x42, 0xB8, 0x23, 0xA7, 0x09, 0x77,
+    0xF1, 0x80, 0x70, 0x7F, 0xDB, 0x91, 0x53, 0xC2, 0x56, 0x53, 0x5B, 0x4A, 0xD8, 0x13, 0x26, 0xFF,
+    0x00, 0x0F, 0xE0, 0x4B, 0x71, 0x59, 0x5C, 0x37, 0xC7, 0x56, 0x95, 0xD2, 0xF3, 0x2E, 0x4B, 0x09,
+    0xB7, 0x9A, 0x1D, 0x13, 0x1B, 0xFA, 0xF8, 0x8B, 0xE0, 0x4E, 0x6F, 0x7E, 0xD9, 0x94, 0x8E, 0x07,
+    0xE2, 0xE7, 0x3B, 0x6E, 0x66, 0x2B, 0x79, 0x2F, 0xBA, 0x69, 0xAA, 0x6E, 0x1D, 0x7D, 0xF2, 0x6F,
+    0x2C, 0x0D, 0x30, 0xE5, 0xFD, 0x2D, 0xEF, 0xFB, 0xCF, 0xA3, 0xEC, 0x84, 0x24, 0xCF, 0x76, 0x26,
+    0xB0, 0xEB, 0xE6, 0x0B, 0xD6, 0x10, 0x26, 0xB6, 0xB1, 0x8B, 0x5D, 0xF0, 0x80, 0xF0, 0xD5, 0xE6,
+    0x05, 0x2C, 0xAB, 0x83, 0x97, 0x78, 0x52, 0x63, 0x6C, 0xB4, 0x7F, 0x94, 0xF3, 0x8E, 0x19, 0x9D,
+    0x3D, 0xAE, 0xD9, 0x0F, 0xC7, 0xBA, 0x48, 0xEC, 0x49, 0xFC, 0xCF, 0xF5, 0x37, 0xB5, 0x95, 0x3F,
+    0x73, 0xDC, 0x44, 0x18, 0xC6, 0x1F, 0x49, 0xC4, 0x4B, 0x4E, 0x83, 0x37, 0x45, 0x66, 0x52, 0x60,
+    0x5B, 0xAD, 0x09, 0xE7, 0x53, 0x43, 0xE1, 0x42, 0xE7, 0xD3, 0x24, 0x5F, 0x20, 0x05, 0x86, 0x92,
+    0x2F, 0x71, 0xC5, 0x15, 0x8A, 0x4F, 0xB6, 0x4B, 0x8A, 0xB8, 0x61, 0x68, 0x3D, 0x94, 0x17, 0x18,
+    0xAE, 0x70, 0x61, 0x06, 0x4F, 0xBC, 0xE3, 0x2F, 0x80, 0x86, 0xD4, 0xCC, 0xEC, 0x10, 0xA8, 0x28,
+    0xD8, 0x01, 0x65, 0x46, 0x71, 0xCE, 0x5E, 0x9E, 0x57, 0x72, 0x9C, 0x86, 0x0A, 0x87, 0x95, 0xA5,
+    0xB9, 0x95, 0x76, 0x7F, 0xEF, 0xF3, 0xFE, 0xD9, 0xD7, 0xB8, 0x8B, 0xBB, 0xA1, 0x0D, 0xAC, 0xCE,
+    0xE3, 0x32, 0xC3, 0x30, 0x70, 0x70, 0xAA, 0x54, 0x66, 0x80, 0x01, 0x6A, 0xD4, 0x91, 0x89, 0x4C,
+    0x82, 0x14, 0x27, 0xC1, 0x22, 0x72, 0x89, 0xD5, 0xAF, 0xFF, 0xC8, 0xB7, 0x2E, 0xFA, 0x81, 0x05,
+    0xE2, 0x12, 0x18, 0x02, 0x70, 0x40, 0x64, 0x80, 0x35, 0xFE, 0x0C, 0xBD, 0xDF, 0xF7, 0xFE, 0x85,
+    0x6F, 0x3E, 0xF2, 0x97, 0xBD, 0x53, 0xBF, 0xF7, 0xBD, 0xB7, 0x4F, 0x7D, 0x73, 0x9F, 0x93, 0xA9,
+    0xDF, 0x7B, 0xE2, 0xED, 0x37, 0xBE, 0x59, 0x4F, 0x2F, 0x7B, 0xF8, 0x7C, 0xAF, 0xC4, 0xE1, 0x21,
+    0xD6, 0xD7, 0xD1, 0xEB, 0x21, 0xFC, 0x97, 0x09, 0x47, 0xB1, 0x58, 0xDC, 0x89, 0xCA, 0x71, 0x58,
+    0x2D, 0xDF, 0x7B, 0x5E, 0x03, 0x83, 0xE4, 0xF9, 0x77, 0xA1, 0xC9, 0xF8, 0x26, 0x86, 0xD3, 0x38,
+    0xA0, 0x7D, 0xB7, 0x51, 0x8C, 0x57, 0xE6, 0x1F, 0xD8, 0x15, 0xDB, 0x9F, 0x8F, 0x47, 0xF6, 0x16,
+    0x6E, 0x85, 0xC8, 0x96, 0x31, 0xD9, 0x80, 0x2B, 0x42, 0x5B, 0xC7, 0x67, 0xAE, 0x48, 0x1E, 0x9A,
+    0x7A, 0xA8, 0x1F, 0x54, 0x75, 0x80, 0x5C, 0xA0, 0xA0, 0x77, 0x7D, 0x6D, 0x71, 0x34, 0xAC, 0x02,
+    0x1B, 0x56, 0x91, 0x09, 0x8D, 0xA6, 0xFA, 0x0D, 0x44, 0xE5, 0x04, 0x2A, 0x77, 0x59, 0x1C, 0x99,
+    0x85, 0x8E, 0x1F, 0x2C, 0x7A, 0x6B, 0x6A, 0x82, 0x6C, 0x75, 0x0C, 0xB7, 0x39, 0x0F, 0xAB, 0x97,
+    0xB5, 0xDA, 0xF5, 0x17, 0x1A, 0x81, 0xED, 0x23, 0xA8, 0xC6, 0x08, 0xCA, 0x16, 0x96, 0x80, 0xDB,
+    0x09, 0x8B, 0x7E, 0xA1, 0xF7, 0x42, 0x43, 0x9F, 0xD1, 0x10, 0x1C, 0x36, 0xD5, 0x6E, 0xAE, 0xF2,
+    0xBF, 0x7C, 0x3E, 0xEF, 0x7F, 0x52, 0x68, 0x95, 0x87, 0xE6, 0xD0, 0x22, 0xE3, 0x15, 0xE7, 0x71,
+    0x2E, 0xD1, 0xC6, 0x11, 0x27, 0x1B, 0xD0, 0xBC, 0xB8, 0xD3, 0xBB, 0x09, 0xEE, 0xCF, 0x80, 0x47,
+    0xA4, 0x9E, 0x5A, 0xAC, 0xDD, 0x16, 0x55, 0x98, 0xF3, 0xD2, 0x58, 0xC5, 0xC7, 0x65, 0x54, 0x2E,
+    0x35, 0x44, 0x87, 0x15, 0xD1, 0xAB, 0x6A, 0xD7, 0x85, 0x95, 0xDB, 0x79, 0xD6, 0x64, 0xFA, 0xE7,
+    0x1F, 0xE2, 0x87, 0xDF, 0x52, 0xD6, 0xDF, 0x06, 0x59, 0x7F, 0x13, 0x5A, 0x7D, 0x7D, 0x10, 0x56,
+    0xDE, 0x63, 0x82, 0x98, 0x3B, 0xE1, 0x08, 0xB9, 0x4D, 0xA7, 0x0F, 0x30, 0x42, 0x64, 0xB1, 0x2E,
+    0xA2, 0xEF, 0xD0, 0x4F, 0xA2, 0x06, 0xD0, 0x46, 0xD9, 0xA0, 0x66, 0x0A, 0x95, 0xC1, 0xB1, 0x3C,
+    0x76, 0x96, 0xCE, 0xFC, 0x62, 0xE9, 0x15, 0xBA, 0x71, 0xDC, 0xA5, 0x56, 0x32, 0x1D, 0x98, 0xEE,
+    0x55, 0x03, 0x28, 0xBE, 0x1A, 0x19, 0x84, 0x7F, 0x02, 0x3A, 0xE3, 0xA2, 0x1A, 0xD1, 0x59, 0x85,
+    0x41, 0x5C, 0x06, 0x6E, 0x0D, 0xBA, 0x2C, 0xB0, 0x33, 0x73, 0x91, 0xF7, 0x26, 0xD9, 0xFE, 0x82,
+    0xD5, 0x33, 0x8C, 0x0D, 0xEA, 0x21, 0xC2, 0x5F, 0x1D, 0xE2, 0x27, 0x39, 0xE3, 0xD5, 0x0D, 0xA9,
+    0x1A, 0xA6, 0x34, 0xAC, 0x20, 0x5A, 0xDA, 0xA1, 0x19, 0xD1, 0xC4, 0xB4, 0x6C, 0xFC, 0xC8, 0x9B,
+    0x0E, 0x85, 0x2F, 0xAA, 0x16, 0x1E, 0xEF, 0x59, 0x24, 0x94, 0xB1, 0xC5, 0xDC, 0x91, 0x0E, 0xEF,
+    0x5D, 0xF0, 0x72, 0xDB, 0x45, 0x15, 0x6A, 0xC1, 0xEB, 0x1C, 0xC7, 0x29, 0x95, 0x10, 0x5A, 0x74,
+    0x2C, 0x45, 0xC9, 0x09, 0x75, 0x16, 0x9B, 0x80, 0x5D, 0x79, 0xB7, 0xFC, 0xF7, 0x02, 0x72, 0x6C,
+    0x85, 0xE5, 0x53, 0x07, 0x25, 0xB1, 0x91, 0x11, 0x49, 0x8C, 0x16, 0xFC, 0xE1, 0xD1, 0xD1, 0x33,
+    0x5A, 0x1F, 0x70, 0x83, 0x8E, 0xF3, 0x16, 0xAF, 0xCC, 0x84, 0x8B, 0x12, 0x04, 0xE7, 0x4F, 0x8D,
+    0xF0, 0xF1, 0x78, 0xBB, 0x60, 0x14, 0x74, 0x9E, 0x22, 0xAA, 0xC4, 0x00, 0x0D, 0x0D, 0x68, 0x50,
+    0x5D, 0x05, 0x3A, 0x63, 0x9A, 0x8B, 0x21, 0xAE, 0xC7, 0xBB, 0x52, 0x1F, 0xE4, 0x5D, 0xF6, 0xF6,
+    0x4B, 0x2C, 0xF7, 0x58, 0x49, 0x47, 0x40, 0x9A, 0x5F, 0xBB, 0x20, 0x16, 0xE8, 0x41, 0x7C, 0xD2,
+    0x3A, 0x20, 0x06, 0x44, 0xFF, 0xF1, 0xA0, 0x95, 0x4F, 0xBE, 0xA8, 0xD7, 0x2C, 0x2E, 0x8A, 0x17,
+    0xBC, 0x68, 0xAF, 0x11, 0x7F, 0x69, 0x5A, 0x57, 0x85, 0xEE, 0xFD, 0x05, 0x49, 0xED, 0x33, 0xFE,
+    0x49, 0xB8, 0x5A, 0x0B, 0x7B, 0xAB, 0xCD, 0x7B, 0x31, 0x90, 0x67, 0x2D, 0x5E, 0x85, 0x76, 0xB8,
+    0x9D, 0x93, 0x3A, 0xF5, 0x34, 0x91, 0xEF, 0xCC, 0x4A, 0xA4, 0x33, 0xD6, 0x16, 0xA6, 0x9E, 0x55,
+    0x81, 0x57, 0x9F, 0x31, 0x7A, 0xA1, 0x0B, 0xA4, 0xAF, 0x54, 0xA1, 0x13, 0xEF, 0x43, 0x51, 0x27,
+    0x64, 0x06, 0x4D, 0x9E, 0xED, 0x88, 0x7D, 0xC9, 0x7E, 0x53, 0x8E, 0xCA, 0xF7, 0x65, 0x51, 0x92,
+    0x77, 0xF5, 0x49, 0x1F, 0xD2, 0xAE, 0xBC, 0xA8, 0x51, 0xCE, 0x00, 0x8F, 0x59, 0x37, 0x95, 0x96,
+    0xC5, 0xAF, 0x9A, 0x77, 0xF2, 0xBA, 0x41, 0x42, 0xE3, 0x11, 0x37, 0x31, 0xD4, 0x78, 0xCC, 0x7B,
+    0x0C, 0xDC, 0x33, 0x08, 0x2E, 0xDE, 0xA6, 0x34, 0xEB, 0xCA, 0x73, 0xDE, 0x66, 0xC0, 0x37, 0xCA,
+    0x5F, 0x8A, 0x8E, 0xBA, 0xFD, 0x90, 0xB4, 0xFD, 0x2F, 0xFA, 0xFD, 0x53, 0x06, 0xBC, 0xDC, 0x9A,
+    0x1D, 0x5C, 0xCD, 0xAB, 0xF6, 0xCC, 0x5C, 0x7D, 0xF7, 0x17, 0xD7, 0x5A, 0x55, 0x25, 0xDF, 0xF8,
+    0xD7, 0x1D, 0xA5, 0x1B, 0xD2, 0x28, 0x77, 0x6A, 0x30, 0x99, 0x60, 0xAC, 0x6E, 0x4E, 0x53, 0xFB,
+    0x26, 0xB0, 0xEE, 0xAA, 0xD0, 0x46, 0xDE, 0x26, 0xBE, 0x79, 0xBB, 0x9A, 0x59, 0x65, 0xDA, 0xF4,
+    0x57, 0x8F, 0x22, 0x7F, 0x89, 0xF3, 0x59, 0x7E, 0x35, 0xCF, 0xDB, 0x8E, 0xDF, 0x7D, 0x4F, 0x7D,
+    0xAD, 0xFD, 0xE2, 0x4D, 0xCB, 0x70, 0xD2, 0x30, 0x5A, 0x27, 0x63, 0x9F, 0x27, 0x8D, 0x24, 0xA0,
+    0x60, 0xBE, 0x65, 0x4B, 0x26, 0xCD, 0x57, 0x95, 0x02, 0xA8, 0x65, 0x7F, 0x22, 0x1B, 0x68, 0x87,
+    0x6D, 0xF5, 0x59, 0x9E, 0xF8, 0xEB, 0xD6, 0x50, 0x4B, 0x63, 0xE8, 0xFA, 0xC2, 0x69, 0x8D, 0xA9,
+    0x15, 0x46, 0xD2, 0xDA, 0x1D, 0xB6, 0xF2, 0x69, 0x73, 0xD2, 0xDA, 0xAA, 0x5B, 0x73, 0x4E, 0xF0,
+    0x12, 0x5C, 0x83, 0x0F, 0x7F, 0xC3, 0x74, 0xF1, 0xA6, 0x05, 0x68, 0x87, 0x22, 0x83, 0x5D, 0xBD,
+    0x11, 0x87, 0x07, 0xF1, 0xFA, 0x1C, 0xFE, 0x37, 0xC8, 0xE8, 0x5C, 0xEA, 0xDA, 0xE2, 0x58, 0x35,
+    0x5C, 0x73, 0xC2, 0x45, 0x72, 0x52, 0x53, 0x2E, 0x4B, 0xB8, 0x2E, 0x49, 0xBD, 0x49, 0x47, 0xDE,
+    0x0C, 0x58, 0xB7, 0x5B, 0x0C, 0x7B, 0xC1, 0x38, 0x2D, 0xF8, 0x1F, 0xA1, 0xD6, 0x88, 0xD9, 0x2F,
+    0xA6, 0x65, 0xCA, 0xC3, 0x34, 0xF2, 0x07, 0xF8, 0x1F, 0xC7, 0x3F, 0xB5, 0x55, 0x31, 0x8F, 0xDC,
+    0x44, 0x14, 0xFE, 0xC6, 0x13, 0x18, 0x09, 0x0B, 0xE6, 0x0A, 0x2A, 0x94, 0x9C, 0x7B, 0xA4, 0xB3,
+    0xDB, 0x08, 0xAD, 0x77, 0x47, 0x8A, 0x04, 0x45, 0x8A, 0xF0, 0x0B, 0x42, 0x4B, 0x81, 0x14, 0x0A,
+    0x8A, 0x15, 0x72, 0x6E, 0x8D, 0x52, 0x5C, 0x41, 0x41, 0x2A, 0xEA, 0x2B, 0xE8, 0x68, 0xAF, 0xB0,
+    0xC4, 0x46, 0x3B, 0xBA, 0xFB, 0x01, 0x0C, 0xA1, 0x48, 0x91, 0x02, 0x27, 0x12, 0x55, 0x8A, 0x9B,
+    0xC2, 0xC0, 0x12, 0x76, 0x77, 0xF8, 0xC6, 0xDE, 0x5C, 0xF6, 0xE8, 0x88, 0x74, 0xF6, 0xCD, 0x49,
+    0xF3, 0xF6, 0xCD, 0xF7, 0xBD, 0xF7, 0xE6, 0x7B, 0xCF, 0xC0, 0xDE, 0x35, 0x60, 0xF6, 0xC0, 0xE0,
+    0xA3, 0x60, 0x71, 0x3D, 0xAD, 0x11, 0x9F, 0xFB, 0x10, 0x6D, 0x51, 0xA3, 0x49, 0x3D, 0x4A, 0xB9,
+    0x86, 0xC6, 0x5F, 0x56, 0xD9, 0xA9, 0x17, 0x6D, 0x9E, 0xE3, 0x44, 0x7F, 0x62, 0x4B, 0x69, 0x3B,
+    0x0D, 0x9F, 0xD3, 0x28, 0x4F, 0xDB, 0x03, 0x74, 0x27, 0xDA, 0xEC, 0x8F, 0xA4, 0x95, 0x3F, 0x0B,
+    0x8F, 0x9F, 0xEC, 0x14, 0x19, 0x8D, 0x92, 0x2E, 0x98, 0x63, 0x78, 0x72, 0x2E, 0x69, 0xF9, 0x6F,
+    0xCA, 0xA5, 0xB6, 0xC6, 0xD9, 0x12, 0x08, 0xC1, 0x61, 0x8D, 0x15, 0x5F, 0x5D, 0xCF, 0x91, 0xF8,
+    0x12, 0x18, 0x65, 0x80, 0x66, 0x24, 0xF2, 0xCC, 0x01, 0xBE, 0x03, 0xAA, 0x11, 0x50, 0x10, 0x4C,
+    0x3F, 0x70, 0x50, 0x6E, 0x09, 0xE9, 0x0B, 0x7A, 0x4A, 0x9F, 0x74, 0x98, 0x9D, 0x77, 0x48, 0x42,
+    0x8B, 0xDD, 0xA7, 0xDC, 0xAE, 0x03, 0xAE, 0x1B, 0x57, 0x4A, 0xA5, 0xB8, 0x53, 0x2B, 0xAE, 0x33,
+    0x42, 0xD4, 0x5F, 0x5E, 0x15, 0xD5, 0xA5, 0x2B, 0x52, 0xC3, 0x15, 0x09, 0xFE, 0x2C, 0x43, 0x30,
+    0xB2, 0x93, 0x3C, 0x83, 0x71, 0xE2, 0x91, 0x5A, 0xA2, 0xFA, 0x8A, 0x54, 0xAC, 0xB6, 0xD6, 0xA6,
+    0xA7, 0x12, 0xDE, 0xF3, 0x16, 0x48, 0x35, 0xA6, 0x21, 0xBB, 0xD5, 0x42, 0xDB, 0x39, 0x3D, 0xB5,
+    0x4D, 0x9D, 0x08, 0x0B, 0x87, 0x34, 0xD4, 0x3B, 0x09, 0xF5, 0x27, 0x53, 0x73, 0xB1, 0xBF, 0x02,
+    0x96, 0xAF, 0x70, 0xF3, 0x3E, 0x96, 0xF4, 0x51, 0xBF, 0xD5, 0x62, 0x03, 0x96, 0x49, 0x9E, 0x1B,
+    0x7D, 0xE4, 0xC6, 0xA2, 0x6B, 0x50, 0xED, 0x61, 0x8F, 0x3E, 0x09, 0x89, 0x9F, 0xB7, 0x24, 0xF6,
+    0x5B, 0xE2, 0x0D, 0x89, 0x03, 0x89, 0x1B, 0x12, 0x57, 0x24, 0xAE, 0x48, 0x5C, 0x92, 0xB8, 0x24,
+    0x71, 0x4E, 0xE2, 0x8C, 0xC4, 0x9F, 0x91, 0x98, 0x48, 0x76, 0x61, 0x06, 0x62, 0x45, 0x62, 0xF5,
+    0x94, 0xC4, 0x0F, 0x2F, 0xA9, 0x03, 0x8C, 0x12, 0xBD, 0xCE, 0x19, 0x32, 0xDE, 0x1D, 0x6C, 0xFB,
+    0xDC, 0xD1, 0x56, 0x49, 0x47, 0xA5, 0x32, 0x47, 0x53, 0x41, 0x3A, 0xE6, 0xE7, 0x99, 0x4E, 0x45,
+    0xDD, 0x46, 0xA3, 0x8E, 0x46, 0x7B, 0x61, 0x74, 0x5B, 0x63, 0xC9, 0x3C, 0xF9, 0x3A, 0x0C, 0x79,
+    0xBA, 0x4B, 0x5C, 0x51, 0xFE, 0xD5, 0x96, 0xF3, 0xE6, 0x95, 0x52, 0x69, 0x36, 0x57, 0x4A, 0xE5,
+    0xA5, 0x77, 0xB8, 0x70, 0x7C, 0x95, 0x54, 0x27, 0xCC, 0xE6, 0x40, 0xBF, 0xDE, 0x4F, 0x7B, 0x00,
+    0x11, 0x01, 0x1A, 0xA2, 0x1E, 0x88, 0x08, 0xD0, 0xD0, 0x58, 0x46, 0x23, 0x7A, 0x63, 0x19, 0x8D,
+    0xB8, 0x30, 0x0E, 0x9E, 0x25, 0x3A, 0x14, 0xF1, 0x35, 0x72, 0x13, 0x0C, 0x8A, 0x60, 0x76, 0xF2,
+    0xA9, 0xD9, 0x0C, 0xFD, 0xB8, 0x78, 0xAF, 0xDF, 0x37, 0x48, 0x8F, 0xAC, 0xF0, 0x23, 0x0E, 0x24,
+    0x97, 0xD6, 0xB9, 0xF0, 0x82, 0x4D, 0x15, 0xFB, 0xE9, 0x0F, 0x26, 0xF6, 0x88, 0xFD, 0xC1, 0xCE,
+    0xF2, 0x7D, 0xDF, 0xC7, 0x31, 0xC3, 0x9A, 0xC7, 0x3E, 0x69, 0x88, 0x63, 0x86, 0x8B, 0x1E, 0xB0,
+    0xA2, 0x64, 0x5F, 0x1A, 0x19, 0xD6, 0xC2, 0x67, 0xB6, 0x41, 0x57, 0x52, 0x37, 0x6C, 0x40, 0x2B,
+    0x7F, 0xF1, 0x89, 0x6F, 0x92, 0x6E, 0x12, 0x96, 0x3A, 0xB4, 0x44, 0x60, 0xB8, 0xF1, 0x74, 0xF9,
+    0x3A, 0xA0, 0x19, 0x65, 0x5F, 0x9C, 0xB3, 0x55, 0x63, 0xB1, 0xBA, 0x3E, 0x9D, 0x31, 0xDD, 0x52,
+    0x96, 0x91, 0xC4, 0x92, 0x0D, 0xDC, 0x77, 0x84, 0x8A, 0xED, 0xDD, 0x14, 0xBC, 0x04, 0xB3, 0xA6,
+    0x5F, 0x12, 0xFD, 0x34, 0x03, 0x67, 0x48, 0x39, 0xCF, 0xB2, 0xC0, 0x4B, 0x8C, 0xBE, 0x5E, 0xB0,
+    0x6B, 0xA8, 0xCC, 0xEA, 0x95, 0x14, 0x89, 0x0D, 0xCE, 0x07, 0x4C, 0x78, 0x58, 0x76, 0x5B, 0x46,
+    0x42, 0xC7, 0xB0, 0x99, 0xBF, 0xB0, 0x7D, 0x33, 0x1E, 0xBF, 0xAF, 0xC2, 0x5D, 0xF5, 0xFB, 0xE2,
+    0x96, 0xD3, 0xA7, 0x8C, 0x97, 0xED, 0x40, 0xD0, 0x1C, 0xFA, 0x76, 0x4D, 0x56, 0xE9, 0x1B, 0xB1,
+    0x2C, 0xC4, 0x5A, 0xFE, 0xF3, 0x14, 0xB3, 0x5F, 0xED, 0x6E, 0x21, 0xF9, 0x17, 0x07, 0x8F, 0x79,
+    0x73, 0x90, 0x38, 0xD2, 0x0C, 0xD8, 0xE4, 0xED, 0x8D, 0x37, 0x03, 0xB9, 0x06, 0x93, 0xB5, 0x4E,
+    0xCF, 0xBC, 0x14, 0xFD, 0x58, 0x7B, 0xBB, 0xFE, 0x34, 0x5B, 0x4F, 0xB3, 0xEF, 0xD7, 0xDA, 0x4C,
+    0xA8, 0xB3, 0x33, 0x97, 0x3C, 0xF3, 0x68, 0x1A, 0x94, 0x39, 0x32, 0x6D, 0xF4, 0x69, 0xAB, 0xDA,
+    0xB9, 0xEA, 0xF4, 0xF9, 0x17, 0x22, 0xDC, 0xB9, 0xC8, 0x24, 0xAD, 0xE5, 0xE9, 0x2B, 0x25, 0xFE,
+    0x6F, 0x00, 0xC1, 0x49, 0xB5, 0x42, 0xC2, 0x49, 0x7D, 0x7C, 0x8C, 0xFD, 0x13, 0x88, 0xA1, 0xCC,
+    0x9F, 0xBF, 0x25, 0xC2, 0x93, 0x6F, 0xFE, 0xBE, 0xE7, 0x38, 0x68, 0xE6, 0x98, 0x97, 0xC8, 0x33,
+    0xA4, 0xDF, 0xD6, 0xF2, 0x71, 0x2B, 0x98, 0xD6, 0x2A, 0xC7, 0x61, 0x6A, 0x67, 0x66, 0xF3, 0xA7,
+    0xCD, 0x3A, 0xDF, 0x1F, 0xF8, 0x50, 0xBC, 0x53, 0xAB, 0x30, 0x0E, 0xEE, 0xF0, 0xEE, 0xE6, 0xF6,
+    0x99, 0xCB, 0xDA, 0x2C, 0xC7, 0x04, 0x55, 0x87, 0x4E, 0x3D, 0xB1, 0xF2, 0xC5, 0x9A, 0xFC, 0xA1,
+    0x6E, 0x58, 0x31, 0xE9, 0xF8, 0x79, 0xD0, 0xF5, 0xC4, 0xA2, 0x48, 0x82, 0xD9, 0x9B, 0x3C, 0x0A,
+    0x2F, 0xDC, 0xEC, 0x28, 0xDB, 0x6C, 0x13, 0xF8, 0xE0, 0xA1, 0x22, 0xC6, 0xC7, 0x14, 0xC4, 0x38,
+    0x5E, 0xB3, 0x8A, 0xED, 0x48, 0x1D, 0x70, 0xCF, 0xBB, 0xA2, 0x16, 0x26, 0x3F, 0xD6, 0xC5, 0x1A,
+    0xD7, 0xE3, 0x6F, 0x54, 0x8F, 0xB4, 0xE2, 0x1E, 0xD2, 0xE1, 0x8B, 0xE0, 0x91, 0xB4, 0x51, 0xE5,
+    0xFD, 0x85, 0x8A, 0x1F, 0x30, 0x5B, 0xA9, 0x67, 0xCB, 0x52, 0x3C, 0x6F, 0xD3, 0xEF, 0x30, 0x3F,
+    0x5C, 0x3C, 0xA6, 0x86, 0xEB, 0xA8, 0xDC, 0x86, 0x07, 0x85, 0x7C, 0x39, 0xFF, 0xEF, 0xF7, 0x71,
+    0xF7, 0xF9, 0x17, 0xAD, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0x57, 0x97, 0x15, 0x1E,
+    0xC5, 0xE3, 0xC2, 0x55, 0x44, 0x3C, 0x29, 0x53, 0xD8, 0xB7, 0x2D, 0xC5, 0xEE, 0xDD, 0x20, 0x0A,
+    0x4A, 0xBB, 0xA1, 0xA2, 0xA0, 0x0D, 0x52, 0x24, 0x9A, 0x14, 0x2E, 0x96, 0xBB, 0x25, 0x14, 0x14,
+    0x14, 0x71, 0x65, 0x5A, 0x0A, 0x2A, 0x23, 0x61, 0x8A, 0x2B, 0x56, 0xE2, 0xE0, 0xC6, 0xCE, 0x1F,
+    0x58, 0xEC, 0x22, 0x05, 0xCD, 0x24, 0x51, 0x84, 0x04, 0x85, 0x27, 0x62, 0x0C, 0x87, 0x73, 0xB7,
+    0xCB, 0x9B, 0xDD, 0xF3, 0xB9, 0xC5, 0x56, 0x56, 0x77, 0xD2, 0xCE, 0xEE, 0xBC, 0xF7, 0xBE, 0x79,
+    0xDF, 0xF7, 0xBE, 0x05, 0xE8, 0x1A, 0x83, 0x59, 0x84, 0x1A, 0xAB, 0x7E, 0x81, 0x3B, 0x8A, 0xD5,
+    0x36, 0x7A, 0x3E, 0x15, 0x6A, 0xB7, 0x8B, 0x22, 0x09, 0xEC, 0x60, 0x52, 0x4E, 0x2A, 0x4C, 0x01,
+    0x07, 0x14, 0x40, 0x06, 0xD5, 0xFF, 0x5E, 0xF3, 0x3A, 0x47, 0x7B, 0xF5, 0x11, 0x54, 0xD8, 0x4A,
+    0x02, 0x7D, 0x9F, 0x16, 0xEC, 0x3B, 0x0C, 0x67, 0x14, 0x9C, 0xB2, 0x17, 0x86, 0x3F, 0xC1, 0x78,
+    0x30, 0x39, 0xA9, 0xA7, 0x22, 0x47, 0xEA, 0x43, 0x99, 0x65, 0xE1, 0xC5, 0x38, 0xA8, 0x4D, 0x1B,
+    0x18, 0x94, 0x56, 0x44, 0x8B, 0x2C, 0x9F, 0x42, 0xD6, 0x6C, 0x3A, 0xA0, 0x9A, 0x45, 0xF0, 0x52,
+    0xC7, 0xF2, 0xD0, 0x4D, 0xAA, 0xD0, 0x40, 0x28, 0x74, 0x9B, 0x8A, 0xD5, 0x21, 0x26, 0xD3, 0x66,
+    0xA7, 0xA4, 0x5C, 0x09, 0x1E, 0x01, 0x1D, 0x14, 0x61, 0x29, 0x90, 0x31, 0xC3, 0xF3, 0x14, 0x36,
+    0xD2, 0x5D, 0xB8, 0x50, 0x0B, 0xBF, 0x27, 0x34, 0x81, 0x61, 0x06, 0xBE, 0x4E, 0x07, 0x3C, 0x0F,
+    0x4B, 0x58, 0x4A, 0xB2, 0x71, 0x75, 0xDB, 0xA5, 0xCC, 0x74, 0x60, 0xDB, 0xE2, 0xEF, 0x97, 0x69,
+    0x72, 0x3F, 0x54, 0xFF, 0x63, 0x73, 0x78, 0x64, 0xEC, 0xA8, 0x81, 0xB1, 0xBE, 0x78, 0x4C, 0x9D,
+    0xDB, 0xBD, 0xBA, 0x2D, 0x08, 0x9C, 0xF0, 0xAD, 0x6C, 0x50, 0xA8, 0x3D, 0x76, 0xE1, 0x20, 0x0C,
+    0xA4, 0x83, 0xDC, 0x06, 0x0B, 0x4A, 0xD0, 0xE6, 0x1F, 0xB6, 0x59, 0xFD, 0xCF, 0xD1, 0x94, 0x5B,
+    0x87, 0x59, 0x86, 0xB8, 0x0B, 0xFE, 0x44, 0x85, 0xA7, 0x54, 0xCA, 0xA1, 0x88, 0x91, 0x85, 0x17,
+    0x73, 0xF4, 0xDB, 0xA3, 0x82, 0x61, 0x0D, 0xD5, 0x2A, 0xB6, 0x6A, 0x1D, 0xBE, 0xDF, 0x94, 0x5D,
+    0x5F, 0xD9, 0x0B, 0x9E, 0xD5, 0xAA, 0x77, 0x3E, 0x0B, 0xA7, 0x91, 0x1E, 0x20, 0xE3, 0x3A, 0xD2,
+    0x53, 0x14, 0x42, 0x89, 0xDC, 0xC2, 0x49, 0xC8, 0xC0, 0x04, 0x36, 0x45, 0x37, 0x2C, 0xC3, 0x32,
+    0xA3, 0x3E, 0xF9, 0x2B, 0xF5, 0x4D, 0x03, 0x57, 0x08, 0xF2, 0x4B, 0x7E, 0x1D, 0x7F, 0x35, 0x96,
+    0xAA, 0xD7, 0x83, 0x4C, 0x20, 0x33, 0xC8, 0x02, 0x5D, 0x87, 0x9E, 0x43, 0x52, 0xA0, 0xC8, 0x98,
+    0x8D, 0x0F, 0x4B, 0x5E, 0xE1, 0xF2, 0xBA, 0x94, 0xC7, 0x0A, 0x6E, 0x12, 0xCE, 0x35, 0x62, 0x6A,
+    0xCC, 0x88, 0x95, 0x9B, 0xD7, 0x0E, 0x5F, 0x67, 0x88, 0x4F, 0xF4, 0xC6, 0xA4, 0x5C, 0x09, 0x1A,
+    0xCD, 0xDC, 0xDA, 0x23, 0x99, 0xA8, 0x78, 0xDF, 0x52, 0xB4, 0xC8, 0xA3, 0xA7, 0x9A, 0xBD, 0x26,
+    0x82, 0x28, 0x9C, 0xBA, 0x4E, 0x4D, 0x3C, 0x26, 0xDA, 0x29, 0x9E, 0xFF, 0xE9, 0x30, 0x31, 0x97,
+    0xF5, 0x8B, 0x04, 0xA3, 0x64, 0x71, 0x7F, 0xAD, 0xE2, 0xEF, 0x34, 0xD8, 0x03, 0xA2, 0x7D, 0xCD,
+    0x2F, 0x57, 0x0E, 0x0E, 0xBE, 0xA9, 0xEB, 0x05, 0x31, 0x20, 0xDD, 0x86, 0xD6, 0xB3, 0xD9, 0xAA,
+    0xF7, 0x5D, 0x0C, 0xEB, 0x3C, 0xDE, 0x77, 0x91, 0xEE, 0xE7, 0x8E, 0x8F, 0x05, 0xFB, 0xFD, 0xC8,
+    0x64, 0xD9, 0x96, 0x88, 0xBE, 0x3C, 0xD5, 0xA3, 0x74, 0x24, 0x82, 0x2A, 0x30, 0x52, 0x67, 0xA8,
+    0x26, 0xAA, 0x57, 0xE7, 0x81, 0x5A, 0x24, 0xD1, 0xCD, 0x4C, 0x79, 0xC9, 0x96, 0x7E, 0xBD, 0x83,
+    0x75, 0xA2, 0x4E, 0x40, 0x7C, 0xA0, 0xC3, 0x23, 0xCB, 0x6C, 0x81, 0xDD, 0x76, 0xFD, 0xA1, 0x8E,
+    0x8E, 0x4C, 0x68, 0x0B, 0x36, 0x8D, 0xD9, 0x3C, 0x7A, 0xF3, 0x1B, 0x26, 0xA7, 0x7A, 0x49, 0x0F,
+    0x4D, 0x17, 0xCF, 0x1B, 0x40, 0xF9, 0xCD, 0x93, 0xCC, 0x80, 0x5A, 0xC1, 0x59, 0x7C, 0x7B, 0xFB,
+    0xC6, 0x49, 0x68, 0x98, 0x89, 0x82, 0x85, 0x72, 0x15, 0x76, 0x9C, 0xEF, 0x7D, 0x4A, 0x41, 0x91,
+    0x8E, 0x8E, 0x69, 0x1E, 0xDB, 0x35, 0x69, 0x34, 0xCA, 0xC5, 0xB1, 0x89, 0xCC, 0x38, 0x72, 0xF2,
+    0xEC, 0x61, 0x50, 0x6F, 0x2F, 0x51, 0x34, 0x3D, 0xA5, 0xA6, 0x7B, 0xBD, 0xE2, 0xBD, 0xF6, 0xD1,
+    0x8E, 0x1F, 0x74, 0xD2, 0x70, 0x41, 0x93, 0x98, 0x51, 0xBB, 0xC8, 0x90, 0x90, 0x90, 0x1A, 0x13,
+    0x3A, 0x34, 0x25, 0xC7, 0x16, 0x19, 0xC4, 0x5D, 0x22, 0x78, 0x83, 0x06, 0x64, 0x95, 0xC2, 0x05,
+    0xB5, 0x52, 0x50, 0x0A, 0xB2, 0x0E, 0xC4, 0x14, 0xEF, 0xB9, 0x27, 0xD6, 0x86, 0xF4, 0x6A, 0x98,
+    0xA3, 0x4D, 0x4D, 0x2E, 0x16, 0x96, 0x6D, 0xE3, 0xE9, 0x35, 0x33, 0x0F, 0xC0, 0x3F, 0x99, 0xA1,
+    0xF7, 0x6A, 0x86, 0x39, 0x19, 0x89, 0x09, 0xB5, 0xA4, 0x77, 0x05, 0x95, 0x29, 0x99, 0x15, 0x04,
+    0x28, 0x43, 0x1A, 0x50, 0x17, 0x84, 0x91, 0x2A, 0x7D, 0x33, 0xC5, 0xEB, 0x5A, 0x79, 0xEA, 0xA8,
+    0xB0, 0xA7, 0xCF, 0x4F, 0xBB, 0xCF, 0xB4, 0xBB, 0x3C, 0xC4, 0xAF, 0xD6, 0x1B, 0xC5, 0xF2, 0x50,
+    0x6F, 0xFB, 0x04, 0x18, 0xCE, 0x81, 0xC9, 0x6C, 0xC9, 0x3E, 0x24, 0x6D, 0xEE, 0xD3, 0xFF, 0x27,
+    0xFA, 0xFF, 0x45, 0x92, 0x7D, 0x59, 0x22, 0x3C, 0x2E, 0xC1, 0x1F, 0x93, 0xF3, 0x90, 0x0D, 0xF6,
+    0x68, 0x7C, 0x07, 0x07, 0x16, 0x75, 0x6D, 0xD9, 0xF9, 0x47, 0x96, 0x4E, 0xEE, 0xA8, 0xC7, 0x8E,
+    0xD2, 0x93, 0xDF, 0xA0, 0x48, 0xBD, 0xC1, 0x52, 0x4A, 0x59, 0x37, 0x09, 0x1F, 0x74, 0x58, 0xFD,
+    0xEC, 0x8B, 0x7F, 0x3F, 0x2B, 0x5D, 0x68, 0xC7, 0x18, 0x13, 0xED, 0x12, 0xFC, 0xEB, 0x3C, 0x3C,
+    0x31, 0xCC, 0x3B, 0x56, 0x17, 0x03, 0xAE, 0x87, 0xAA, 0xFA, 0x5B, 0x4B, 0x67, 0x5B, 0x08, 0x6B,
+    0x1D, 0xE0, 0xD1, 0x5D, 0x82, 0x40, 0x90, 0xB8, 0x79, 0xAB, 0xB0, 0xEE, 0x75, 0x70, 0x9B, 0x54,
+    0x55, 0x93, 0x87, 0x34, 0x27, 0xBF, 0x95, 0xEF, 0xC8, 0xF9, 0xAE, 0xDC, 0x9F, 0x0B, 0xD5, 0xE7,
+    0x9A, 0x3F, 0x2D, 0x83, 0xE7, 0xE4, 0x2D, 0xD4, 0xDC, 0x2E, 0x24, 0x79, 0xE0, 0x42, 0x55, 0xE2,
+    0xEC, 0x21, 0xBB, 0x54, 0x95, 0x07, 0x32, 0x24, 0x4E, 0x08, 0x5B, 0xD7, 0x36, 0x38, 0xC8, 0x6E,
+    0x91, 0x6C, 0x21, 0x30, 0x45, 0x03, 0x83, 0x7C, 0x34, 0xFA, 0xE3, 0x10, 0xFD, 0x7A, 0xE6, 0x51,
+    0x90, 0x8F, 0x97, 0x63, 0x92, 0x7D, 0x89, 0xAE, 0x07, 0xE1, 0xBC, 0xF5, 0x35, 0xDF, 0x45, 0xB3,
+    0x94, 0x0B, 0x7E, 0x69, 0x38, 0xBD, 0xC3, 0xD4, 0xF0, 0xDC, 0x0C, 0x3E, 0x76, 0x29, 0x66, 0x31,
+    0x62, 0xA1, 0xF8, 0x57, 0x3A, 0x78, 0x61, 0xE0, 0x88, 0xE6, 0x14, 0x7D, 0x9E, 0xCB, 0xC7, 0x56,
+    0x96, 0xFD, 0x9F, 0x7F, 0x8C, 0xE6, 0x14, 0xB4, 0xD9, 0xFC, 0xA8, 0x49, 0x91, 0x6A, 0x86, 0xAD,
+    0x83, 0x2B, 0x0B, 0x48, 0x5A, 0x0D, 0x6D, 0xB6, 0x4F, 0xE2, 0x0A, 0xBC, 0xAE, 0x50, 0xE1, 0x9E,
+    0x1F, 0x84, 0xCF, 0xFD, 0xC7, 0xAC, 0x15, 0xED, 0x78, 0x21, 0x5A, 0xD5, 0xA2, 0xB0, 0x8B, 0x65,
+    0xDE, 0x8A, 0xA4, 0xEF, 0x75, 0x71, 0x66, 0xC8, 0x87, 0x14, 0xAE, 0x71, 0xFD, 0x07, 0xAD, 0x55,
+    0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0x6C, 0xDF, 0xC5, 0x91, 0x2C, 0x31, 0x14, 0x41, 0x8A, 0x82,
+    0xC8, 0x50, 0x47, 0x17, 0xBB, 0xA1, 0x48, 0xB1, 0x5E, 0x3B, 0xB4, 0x14, 0x5C, 0x41, 0x5A, 0x44,
+    0x19, 0x28, 0xA0, 0xA1, 0xB8, 0x62, 0xB9, 0x75, 0xA0, 0xA0, 0x48, 0x93, 0x06, 0x7E, 0x41, 0x9A,
+    0x24, 0x12, 0x49, 0x41, 0xE1, 0x62, 0xA3, 0x1D, 0x29, 0x05, 0xAD, 0x25, 0x4A, 0x9A, 0x41, 0x50,
+    0x85, 0x22, 0x06, 0x19, 0xF0, 0x1D, 0xBB, 0x1E, 0xBE, 0x37, 0xF6, 0x5E, 0xEA, 0x28, 0xB7, 0x5A,
+    0xCB, 0x7E, 0x33, 0x9E, 0xF7, 0xBE, 0xF7, 0x7D, 0xEF, 0x3D, 0x03, 0x40, 0x64, 0x91, 0x22, 0xB0,
+    0x78, 0x83, 0xCF, 0x08, 0x1E, 0x60, 0xB9, 0x8D, 0x7F, 0xFF, 0x24, 0x97, 0x65, 0x05, 0x2C, 0x10,
+    0xF2, 0x5E, 0x22, 0x07, 0x6A, 0x04, 0x2D, 0xA2, 0xD3, 0x3A, 0x74, 0x0D, 0x76, 0xBF, 0xA7, 0x40,
+    0xB2, 0xE1, 0xD6, 0x8F, 0x88, 0xCB, 0x27, 0x7E, 0x25, 0x1B, 0x90, 0xB8, 0x01, 0x03, 0xDE, 0x4D,
+    0x0C, 0xF0, 0x95, 0x77, 0x0F, 0xCD, 0x8D, 0x15, 0x1F, 0x79, 0x90, 0xBE, 0x30, 0xA3, 0xD9, 0x4E,
+    0x66, 0xC5, 0x23, 0x34, 0x0B, 0x5E, 0xCB, 0x17, 0x16, 0x4B, 0x57, 0xEE, 0x7C, 0x17, 0x88, 0xB6,
+    0xC8, 0x67, 0x61, 0xF5, 0xDE, 0xAB, 0xE1, 0xDA, 0x87, 0x6C, 0xCB, 0x22, 0x82, 0xD1, 0x53, 0xE2,
+    0xAA, 0xD0, 0xB9, 0xAA, 0xA8, 0x2E, 0x86, 0x5C, 0xD4, 0x8C, 0xD0, 0x03, 0xB1, 0x19, 0x23, 0x77,
+    0x13, 0x10, 0x8C, 0xB8, 0xBA, 0x11, 0xB1, 0x80, 0x57, 0xBC, 0xF4, 0x7F, 0x3D, 0xF4, 0xE4, 0x98,
+    0xDE, 0xE6, 0xFE, 0x05, 0x0F, 0xF1, 0xB3, 0x52, 0xBB, 0x9B, 0x27, 0x97, 0x89, 0xA1, 0x47, 0x64,
+    0x24, 0xC5, 0x5A, 0x1C, 0xD1, 0x4E, 0x7D, 0xFC, 0xE1, 0x07, 0xAC, 0xBB, 0x5D, 0x2E, 0xC9, 0x4D,
+    0xA2, 0xE5, 0xBA, 0xA6, 0xEB, 0x14, 0xE7, 0x4C, 0x54, 0x7B, 0x80, 0xA3, 0x16, 0x85, 0xF1, 0x99,
+    0x01, 0x57, 0xEE, 0x05, 0xAE, 0x23, 0x55, 0x74, 0x30, 0xF7, 0x2E, 0x16, 0x02, 0x4D, 0x70, 0x77,
+    0xFE, 0x81, 0x66, 0xF1, 0xA8, 0x4A, 0x5E, 0x9E, 0x57, 0x61, 0x83, 0xAB, 0x7C, 0x2F, 0x23, 0x8E,
+    0x7C, 0x5C, 0x19, 0x2A, 0x06, 0xB0, 0xA1, 0xD5, 0x56, 0x95, 0x89, 0x99, 0x41, 0xDD, 0x69, 0x91,
+    0x25, 0x15, 0x16, 0x39, 0x79, 0xED, 0x90, 0x3C, 0x33, 0x48, 0x89, 0xB5, 0xAF, 0x11, 0x3F, 0x6B,
+    0x50, 0x28, 0x84, 0xDD, 0x0C, 0xD9, 0x9D, 0x36, 0xEE, 0x13, 0xE7, 0xCA, 0xC2, 0xDD, 0x13, 0xBA,
+    0x5A, 0x42, 0x4F, 0xEE, 0x32, 0x4C, 0x7E, 0x83, 0xE6, 0x5F, 0xF4, 0x4E, 0x9E, 0x70, 0x9B, 0xE7,
+    0xF4, 0xB6, 0x46, 0x78, 0xF2, 0x85, 0xB0, 0x55, 0x88, 0x18, 0x2B, 0xA6, 0x48, 0x3D, 0x35, 0x92,
+    0x92, 0x08, 0x73, 0x6A, 0x4B, 0xF5, 0x54, 0x49, 0x01, 0x52, 0x1C, 0x93, 0x91, 0x98, 0xC8, 0x87,
+    0x7F, 0x0C, 0x02, 0xF7, 0xE1, 0x59, 0x75, 0x9C, 0x42, 0x20, 0xA2, 0x8E, 0x7B, 0xE6, 0xB5, 0x22,
+    0x4D, 0x73, 0x9E, 0xC9, 0xC4, 0x0B, 0xE9, 0xD2, 0x99, 0x33, 0x59, 0xE1, 0x4C, 0x4A, 0x95, 0xE7,
+    0x82, 0x9B, 0x64, 0x6C, 0x04, 0xA5, 0x42, 0x62, 0x35, 0x96, 0x55, 0xE6, 0xB6, 0xD8, 0xC1, 0x84,
+    0xD4, 0x52, 0xE4, 0x36, 0x88, 0x79, 0x09, 0xC6, 0x6B, 0xB1, 0x09, 0xDD, 0x2F, 0x55, 0x62, 0xD7,
+    0xA5, 0x26, 0xC0, 0x39, 0x89, 0x9F, 0x11, 0xC9, 0x02, 0xD7, 0x3D, 0xBA, 0x9A, 0x4F, 0x1D, 0x36,
+    0xA8, 0x83, 0xDE, 0x43, 0x2B, 0x9E, 0x3E, 0x81, 0xEE, 0xDA, 0x49, 0x56, 0x47, 0x59, 0x8D, 0xB4,
+    0x95, 0x1B, 0x02, 0x16, 0x5D, 0xED, 0x39, 0x55, 0xBE, 0xDE, 0x18, 0x06, 0x27, 0xB7, 0x18, 0xD7,
+    0xAA, 0x87, 0xF7, 0x27, 0xBB, 0xF3, 0x12, 0x4D, 0xFB, 0xE4, 0xCE, 0xC9, 0x61, 0xD7, 0x47, 0xBE,
+    0xE6, 0x2E, 0x50, 0xCA, 0x56, 0x7F, 0x6B, 0xBB, 0xF8, 0x6E, 0x95, 0xCE, 0xC2, 0x3F, 0x4F, 0xDD,
+    0x07, 0xCE, 0xFA, 0x1A, 0xE4, 0xD1, 0xD8, 0xEC, 0xA9, 0xE7, 0x2D, 0x6B, 0x5B, 0xC2, 0x5E, 0x0A,
+    0xCA, 0x24, 0x68, 0x40, 0x42, 0xDE, 0xF6, 0xC5, 0xCA, 0x18, 0xDA, 0xF5, 0xCC, 0x5C, 0x6A, 0xA7,
+    0xF5, 0xA2, 0xB3, 0xEE, 0xD4, 0x77, 0x87, 0x84, 0x85, 0xD3, 0x87, 0xE5, 0x64, 0x97, 0x5E, 0x92,
+    0x71, 0x3F, 0x73, 0x9D, 0x12, 0x02, 0xCA, 0x8B, 0xB0, 0x07, 0x52, 0xBB, 0xDA, 0x7B, 0xBE, 0x52,
+    0x12, 0x43, 0xFC, 0x6B, 0xAF, 0xCA, 0xA3, 0x14, 0xF5, 0x2C, 0x6C, 0x8F, 0xD7, 0xCD, 0x7A, 0x90,
+    0x0E, 0xDA, 0x95, 0x53, 0x59, 0x3C, 0x32, 0x13, 0x0C, 0x1C, 0xFA, 0x74, 0xF4, 0xAE, 0xF5, 0x5E,
+    0x03, 0x46, 0xE0, 0xEB, 0xBD, 0x9E, 0xBA, 0xED, 0x53, 0x76, 0x61, 0xD0, 0x1F, 0x13, 0x44, 0x1D,
+    0xFE, 0x66, 0x32, 0xFD, 0xB8, 0x5B, 0x0F, 0x91, 0x3D, 0xEB, 0xB6, 0x72, 0x78, 0x8C, 0x75, 0x2F,
+    0x2F, 0x92, 0x72, 0x96, 0xC5, 0x99, 0x53, 0x51, 0x97, 0x3E, 0xE6, 0xB7, 0x4A, 0x45, 0x52, 0x9F,
+    0x3F, 0x98, 0xEC, 0x51, 0x92, 0x69, 0x7F, 0xED, 0x9A, 0xC2, 0xF1, 0x6E, 0xFD, 0x9F, 0x63, 0xEC,
+    0x80, 0x6A, 0xD0, 0xBE, 0x24, 0xC9, 0xC7, 0xCE, 0x1C, 0xEB, 0x6F, 0x9A, 0xAB, 0xCC, 0xBD, 0x4D,
+    0x7E, 0xFA, 0x63, 0x9B, 0xB9, 0xAA, 0x97, 0x6C, 0x98, 0x93, 0xC6, 0x9B, 0xCC, 0x9C, 0x7D, 0xCC,
+    0xFE, 0x79, 0x47, 0xE0, 0xD3, 0x9F, 0xB2, 0x7E, 0xFE, 0x10, 0x7E, 0x73, 0x04, 0xF5, 0x39, 0x19,
+    0xA8, 0xBC, 0xCC, 0x23, 0x32, 0x72, 0x21, 0x46, 0x3E, 0x76, 0x02, 0x93, 0xA5, 0x17, 0xA9, 0x08,
+    0x62, 0x13, 0x36, 0xB4, 0xAF, 0xC4, 0xDD, 0xF6, 0x6C, 0x9C, 0x51, 0x44, 0xE7, 0xF9, 0x90, 0x46,
+    0xBF, 0x8E, 0x59, 0x87, 0xCC, 0x0F, 0x99, 0x57, 0x56, 0xC6, 0xF7, 0x35, 0xFD, 0x15, 0xA2, 0x04,
+    0xB1, 0xFA, 0xB1, 0xCA, 0x80, 0x8E, 0x1E, 0xD9, 0x0C, 0x03, 0x2E, 0x87, 0x3C, 0x16, 0x4F, 0xA3,
+    0x46, 0x06, 0x91, 0x0C, 0xAA, 0x1C, 0x6F, 0x7D, 0x94, 0xA3, 0x60, 0x77, 0x5F, 0xE3, 0x85, 0x56,
+    0xFA, 0x7F, 0x4E, 0x94, 0x19, 0x39, 0x50, 0x26, 0x32, 0xF1, 0xC0, 0x7A, 0x5D, 0x0F, 0x67, 0xB3,
+    0x44, 0x8A, 0x26, 0xDA, 0xF8, 0xDE, 0xBF, 0x11, 0xFB, 0xD5, 0x0B, 0xD5, 0x61, 0xEC, 0x3E, 0x96,
+    0x6E, 0xCF, 0xB1, 0x49, 0x4C, 0x62, 0x3A, 0xD4, 0x1A, 0xEA, 0x6B, 0x8B, 0x2E, 0x95, 0x5E, 0x8D,
+    0x5A, 0xF6, 0x78, 0xD8, 0xEA, 0x46, 0xBD, 0x58, 0x60, 0xF9, 0xF3, 0x4B, 0x5E, 0xDA, 0x7D, 0x76,
+    0xDE, 0xD2, 0x99, 0x71, 0xAE, 0x57, 0x7B, 0x54, 0x87, 0x73, 0x44, 0x84, 0xCA, 0xAA, 0x73, 0x87,
+    0xBE, 0x17, 0x94, 0x41, 0xF3, 0x25, 0x85, 0x38, 0xF3, 0x7E, 0x7B, 0x1F, 0xCB, 0xBF, 0x6D, 0xF6,
+    0xFD, 0x56, 0xDE, 0x5E, 0x61, 0xC5, 0x41, 0xC8, 0x21, 0xD8, 0xA7, 0x50, 0xEF, 0x73, 0x3A, 0xD1,
+    0x71, 0x68, 0x63, 0x9B, 0x05, 0x0C, 0xFF, 0xAF, 0x89, 0xB7, 0x93, 0x58, 0xB5, 0xD4, 0xD5, 0x61,
+    0x64, 0x65, 0x92, 0x64, 0xDB, 0xE9, 0xA3, 0xE1, 0x51, 0x89, 0x64, 0xD3, 0xE7, 0xE8, 0xBC, 0x29,
+    0x7F, 0x8D, 0xDF, 0xFF, 0x9D, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0x33, 0xC3, 0x65, 0x91,
+    0x56, 0xCA, 0xB8, 0x88, 0x25, 0xA4, 0x28, 0xB7, 0x94, 0x08, 0x91, 0xBD, 0xD6, 0xC5, 0xAE, 0xBD,
+    0xA2, 0xA0, 0xA1, 0xE0, 0x8A, 0xA4, 0x42, 0x82, 0x36, 0x15, 0x4E, 0x41, 0xE1, 0xE2, 0x9C, 0x5B,
+    0x68, 0x28, 0x28, 0xA0, 0xA2, 0xA5, 0xC6, 0x14, 0x50, 0xA4, 0x38, 0x84, 0xE1, 0x16, 0x28, 0x68,
+    0x57, 0xCA, 0x1F, 0xC0, 0x16, 0xA1, 0x25, 0x53, 0x4C, 0xC4, 0x19, 0xDD, 0xDD, 0xF0, 0xBE, 0xB9,
+    0x1F, 0x39, 0xC7, 0x29, 0x02, 0x27, 0xAF, 0xED, 0x9D, 0xF9, 0xE6, 0xBD, 0xF7, 0xBD, 0xEF, 0xFB,
+    0xE6, 0x80, 0x3D, 0xC0, 0x56, 0x80, 0xC3, 0xE6, 0x73, 0xAF, 0x87, 0xF1, 0xD3, 0x6E, 0xF0, 0xD5,
+    0xC2, 0xB4, 0xB6, 0x39, 0xC7, 0xB9, 0xAD, 0xD2, 0x4F, 0x1C, 0x66, 0x39, 0xEC, 0xDB, 0x9D, 0x72,
+    0x25, 0x8E, 0x74, 0x97, 0x74, 0x03, 0xB5, 0xC0, 0xF2, 0xEF, 0x26, 0x59, 0x14, 0x40, 0xD2, 0x00,
+    0x13, 0xA2, 0x60, 0x68, 0xBA, 0x24, 0xCC, 0x31, 0x58, 0xAC, 0x91, 0x74, 0xF0, 0x18, 0x04, 0x06,
+    0xE2, 0x35, 0xED, 0x19, 0xD7, 0x32, 0xA8, 0x06, 0x32, 0x6E, 0xE5, 0x7C, 0x4A, 0xEC, 0xDF, 0x21,
+    0x9C, 0x2F, 0xF0, 0x26, 0x1F, 0x10, 0x5A, 0xB9, 0x43, 0xE8, 0x6E, 0x00, 0x61, 0x36, 0x4D, 0xB2,
+    0x0C, 0x0D, 0xA6, 0xCB, 0x2A, 0x62, 0xF5, 0x20, 0x0C, 0xC0, 0x6D, 0x3E, 0x07, 0x7C, 0x5E, 0x5F,
+    0x73, 0xA8, 0x26, 0xBE, 0x73, 0x4B, 0x75, 0x71, 0xE1, 0x5A, 0x3D, 0x4C, 0xC2, 0x07, 0xFA, 0xE2,
+    0xB8, 0x2D, 0x31, 0x4F, 0x9B, 0xB4, 0xF1, 0x98, 0x64, 0xB0, 0x9F, 0x76, 0xF0, 0x39, 0x32, 0xD3,
+    0x1A, 0x97, 0xE3, 0x81, 0x76, 0x59, 0x6B, 0x9F, 0x8C, 0x30, 0x7E, 0xC4, 0xE3, 0x23, 0x20, 0xA5,
+    0x2C, 0xD7, 0xC3, 0x21, 0xC6, 0xA1, 0xD1, 0xA1, 0x5D, 0x63, 0x5B, 0x6E, 0xDA, 0x19, 0x9F, 0xF7,
+    0x18, 0x81, 0x15, 0x3C, 0x89, 0x1C, 0x13, 0x1E, 0xE9, 0x8E, 0x39, 0x78, 0x5A, 0x57, 0xC0, 0x34,
+    0xCC, 0xC8, 0x11, 0x62, 0xA4, 0xFF, 0xBC, 0xFB, 0x11, 0x42, 0x08, 0xD5, 0xE1, 0xD9, 0xB7, 0x5C,
+    0x54, 0xB2, 0x38, 0x31, 0x2D, 0x45, 0xBB, 0x6D, 0xE4, 0x76, 0xB1, 0x8C, 0x78, 0x86, 0xC6, 0x87,
+    0x1A, 0x65, 0xB1, 0x65, 0xC0, 0x33, 0x47, 0x57, 0x75, 0x89, 0xB9, 0xDD, 0xC3, 0xED, 0xB1, 0x37,
+    0x7F, 0xBD, 0xDF, 0x1C, 0x55, 0x45, 0xD2, 0x19, 0x16, 0x66, 0x94, 0xD6, 0x69, 0xED, 0xE1, 0x2D,
+    0xAC, 0x72, 0x70, 0x31, 0x39, 0xDD, 0x15, 0x28, 0x0D, 0xBD, 0x13, 0x42, 0xF4, 0x49, 0x26, 0x3A,
+    0x0D, 0x25, 0x2D, 0xC7, 0xFC, 0xD5, 0x8E, 0x08, 0x2D, 0x42, 0x71, 0x71, 0xF7, 0xC3, 0xDA, 0x06,
+    0xD6, 0xE7, 0x9F, 0xB3, 0xEF, 0x90, 0xAD, 0xE3, 0x28, 0xC9, 0x10, 0x9A, 0x7F, 0x44, 0xAA, 0x64,
+    0x49, 0x15, 0x69, 0x4D, 0x19, 0x7E, 0xE3, 0x52, 0xC2, 0x23, 0xCC, 0x4F, 0x64, 0xF5, 0x7B, 0x95,
+    0x7E, 0x14, 0x50, 0x3E, 0x9D, 0x9B, 0x59, 0xD2, 0x3C, 0x40, 0x91, 0xF0, 0xC8, 0x04, 0x13, 0x5B,
+    0xD9, 0x8A, 0x7A, 0xE8, 0xB9, 0x8E, 0xFD, 0x92, 0x53, 0x4F, 0x5B, 0x10, 0x12, 0xAF, 0x28, 0x64,
+    0x5D, 0x6B, 0xA7, 0x2E, 0x59, 0xD5, 0x8A, 0x8D, 0x92, 0x2C, 0x21, 0x3B, 0x59, 0x04, 0xA7, 0x29,
+    0x02, 0x4C, 0xA6, 0xFE, 0x73, 0xEF, 0x79, 0x34, 0x83, 0xD2, 0xAE, 0x5D, 0x50, 0x42, 0x03, 0x85,
+    0xBD, 0xE5, 0xF5, 0x32, 0xFC, 0x16, 0x71, 0x7A, 0xEC, 0x19, 0x91, 0x2E, 0x7A, 0x13, 0x7A, 0x2B,
+    0xA1, 0x8E, 0x90, 0x9B, 0x55, 0xE2, 0x63, 0xBC, 0xC0, 0x78, 0x2E, 0x9C, 0x53, 0x8F, 0x71, 0x27,
+    0x96, 0x66, 0x11, 0xB5, 0x8C, 0xF4, 0x64, 0x38, 0x89, 0x8E, 0x7B, 0x21, 0xA4, 0x9B, 0x3C, 0x4A,
+    0x72, 0x9E, 0xBD, 0xF9, 0x58, 0xCE, 0xD9, 0xF0, 0x99, 0x34, 0x85, 0xAA, 0xB8, 0xEE, 0x79, 0x20,
+    0x23, 0xCF, 0xF6, 0xDF, 0xB4, 0x66, 0xA8, 0x8B, 0x2C, 0x7B, 0x3D, 0x7C, 0x7C, 0x0B, 0x47, 0x73,
+    0xA4, 0xDD, 0xFF, 0xE6, 0x7A, 0x15, 0x55, 0x77, 0x60, 0x03, 0x06, 0xF5, 0x4B, 0xA6, 0x36, 0xF5,
+    0x8A, 0x0D, 0xE4, 0xA4, 0x69, 0x72, 0x41, 0xE5, 0x72, 0x26, 0x1C, 0x8C, 0x61, 0x74, 0x21, 0x14,
+    0xF4, 0xB2, 0x14, 0xB6, 0x9B, 0x8F, 0x55, 0x70, 0x78, 0x4B, 0x42, 0x6E, 0x01, 0x0F, 0xA1, 0x68,
+    0xC9, 0x90, 0x75, 0xE1, 0xC1, 0x43, 0xFE, 0x06, 0x6E, 0x90, 0xC2, 0xC3, 0x29, 0xA7, 0x3A, 0xDD,
+    0x71, 0x56, 0x1A, 0x69, 0x17, 0x16, 0x94, 0x49, 0x5C, 0xE7, 0x98, 0x7D, 0x4F, 0x8C, 0x29, 0xF6,
+    0x19, 0x58, 0xAD, 0xB0, 0xD7, 0x63, 0xDE, 0xB2, 0x8C, 0x2B, 0xDA, 0x89, 0xE4, 0x62, 0x25, 0x4B,
+    0x96, 0x66, 0x43, 0xBB, 0xA3, 0xEC, 0xF8, 0x4B, 0x29, 0x1F, 0x86, 0x39, 0x5B, 0x22, 0x69, 0x4E,
+    0xD8, 0xC0, 0x6C, 0x5E, 0x79, 0xE1, 0xDE, 0x94, 0xAD, 0x9C, 0xB1, 0x95, 0x20, 0xCD, 0x38, 0x62,
+    0x7C, 0x4E, 0x06, 0x21, 0x17, 0x19, 0xB1, 0x43, 0x4F, 0xB6, 0x8B, 0xD9, 0xB3, 0x45, 0x51, 0x2C,
+    0x1D, 0xCB, 0xC3, 0x4C, 0x30, 0xAD, 0xB3, 0x20, 0x7D, 0x23, 0xF6, 0xE2, 0x1C, 0xD8, 0xFF, 0x89,
+    0xAD, 0xC3, 0x26, 0x53, 0xDF, 0x48, 0x7D, 0x54, 0x95, 0xD6, 0x23, 0x90, 0x43, 0xC9, 0xBD, 0x27,
+    0xFE, 0x0E, 0x75, 0x67, 0x51, 0x2A, 0x67, 0x9A, 0x1C, 0x23, 0xD3, 0x26, 0x75, 0x81, 0x49, 0xD2,
+    0xD8, 0xEA, 0x84, 0x13, 0x4D, 0x16, 0xBF, 0xB3, 0x5D, 0xE8, 0x36, 0x56, 0xD0, 0xAC, 0xEE, 0x0C,
+    0x1A, 0x30, 0x60, 0xF5, 0x66, 0xEB, 0x99, 0xBD, 0x3A, 0xC8, 0xC5, 0xF3, 0x83, 0x4C, 0x7F, 0xA8,
+    0x57, 0xBC, 0x30, 0xED, 0x0B, 0xB6, 0x65, 0xCE, 0xDD, 0xEE, 0x76, 0xDA, 0xE0, 0x1D, 0x1F, 0xD5,
+    0x9F, 0x6D, 0x6E, 0x86, 0x23, 0xFE, 0xB4, 0x42, 0xF2, 0x86, 0xA9, 0xD6, 0xD7, 0xE2, 0x95, 0xC1,
+    0xA9, 0x5E, 0x34, 0x38, 0x97, 0xDE, 0xC9, 0x4B, 0x14, 0x2B, 0x36, 0x39, 0x4C, 0x58, 0x6B, 0xFA,
+    0x98, 0x72, 0x4A, 0x79, 0xF3, 0xF2, 0x62, 0x49, 0x7E, 0x65, 0xC7, 0x7C, 0xDE, 0xC0, 0x1E, 0xAF,
+    0xAC, 0xB3, 0x4F, 0x28, 0xFD, 0xDD, 0x1A, 0x39, 0x8F, 0x95, 0x84, 0x2E, 0xB4, 0x74, 0xBB, 0x8F,
+    0xB7, 0xC3, 0x24, 0x16, 0xEA, 0x70, 0x25, 0x6E, 0x18, 0xF1, 0x20, 0x36, 0x19, 0x76, 0xAF, 0x92,
+    0xB5, 0xF5, 0xE5, 0xEA, 0xB7, 0xE9, 0xF5, 0x71, 0x47, 0x77, 0x59, 0x55, 0x26, 0xAD, 0xF9, 0x85,
+    0x18, 0xA7, 0x48, 0xBF, 0xAE, 0xF0, 0x23, 0x7B, 0x35, 0x00, 0x33, 0x8F, 0x2C, 0x69, 0x74, 0x57,
+    0xA2, 0xD4, 0xB4, 0x5C, 0xAE, 0xCC, 0x49, 0x44, 0xBE, 0x11, 0x65, 0xCB, 0xB4, 0xD3, 0x16, 0x1D,
+    0xB9, 0x7A, 0x55, 0xAE, 0xBC, 0x69, 0x4F, 0x51, 0x64, 0x55, 0xF2, 0x7B, 0x8B, 0x1F, 0x3C, 0xD2,
+    0x9F, 0x59, 0x02, 0x5E, 0x7C, 0x5F, 0x54, 0xCA, 0x8D, 0x78, 0xEF, 0xB4, 0x92, 0x11, 0x95, 0x1A,
+    0xB9, 0xF3, 0xF8, 0x39, 0x25, 0x08, 0xF5, 0xDF, 0x47, 0xD4, 0xD9, 0xDF, 0x99, 0x2D, 0xEE, 0xFB,
+    0xAB, 0xB3, 0xC5, 0x7C, 0xA7, 0xE1, 0x8F, 0x30, 0x5F, 0x7F, 0x17, 0x9C, 0xCB, 0xC2, 0xC1, 0xBA,
+    0x10, 0x3B, 0xBD, 0x7E, 0x69, 0xC4, 0x56, 0xBD, 0xFE, 0x70, 0x3B, 0x06, 0x9B, 0x29, 0x8C, 0x5F,
+    0xB0, 0xFF, 0x91, 0xB4, 0x27, 0x56, 0x1E, 0xB0, 0x9F, 0x10, 0xBF, 0x35, 0xF3, 0xD8, 0xE6, 0x45,
+    0xF4, 0x3D, 0x0E, 0xA9, 0xEE, 0x74, 0x7B, 0x79, 0x48, 0xE5, 0x4C, 0x9F, 0x21, 0xF7, 0x63, 0x2D,
+    0x5E, 0xE2, 0xF3, 0x2F, 0xAD, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xF6, 0x5C, 0x70, 0x31,
+    0x12, 0x93, 0x82, 0x0A, 0xC4, 0x0D, 0x2D, 0x28, 0xBB, 0x6E, 0x28, 0x28, 0xBC, 0xBB, 0x26, 0x49,
+    0x47, 0x73, 0x45, 0xA8, 0x90, 0x48, 0x4D, 0x47, 0x71, 0xC5, 0x15, 0x8E, 0xD6, 0x88, 0x92, 0x82,
+    0x14, 0xFC, 0x00, 0x0A, 0x0A, 0x22, 0x8A, 0x0B, 0xD2, 0x15, 0x46, 0xDA, 0xDC, 0x0E, 0x5C, 0x41,
+    0x41, 0xE3, 0x20, 0x10, 0x1D, 0x19, 0x29, 0xA4, 0xA1, 0xB9, 0x11, 0x18, 0xB1, 0xC0, 0xEE, 0x0D,
+    0xEF, 0xB3, 0xF7, 0xD0, 0x21, 0x44, 0x91, 0x28, 0xD6, 0x9E, 0xCE, 0xFE, 0xEC, 0xEF, 0x9B, 0xF7,
+    0xBD, 0xF7, 0xBE, 0x19, 0x84, 0x67, 0x13, 0x3F, 0x4A, 0xFD, 0x6B, 0xAA, 0xBD, 0xAB, 0x1C, 0x32,
+    0x07, 0x5D, 0xC3, 0x94, 0xFD, 0x0F, 0xB0, 0xC0, 0x18, 0x98, 0x00, 0x45, 0xFF, 0xAB, 0x80, 0x65,
+    0x6C, 0x63, 0x74, 0xA8, 0xAA, 0xF4, 0x61, 0x6B, 0xDE, 0x46, 0xE1, 0x11, 0x24, 0x89, 0x5F, 0x75,
+    0x60, 0x3E, 0x13, 0x1A, 0xA4, 0xAD, 0xA4, 0x17, 0x48, 0x82, 0x14, 0x63, 0x76, 0x90, 0x57, 0xF2,
+    0x6F, 0x17, 0xA9, 0x67, 0x80, 0x4F, 0x95, 0xBC, 0xEA, 0x76, 0xCC, 0xEB, 0x21, 0xE4, 0x16, 0x57,
+    0xB7, 0xD1, 0x42, 0x6A, 0x2D, 0xE3, 0x83, 0xB8, 0xE6, 0x07, 0x63, 0x56, 0x61, 0x2C, 0x9C, 0xDF,
+    0x7E, 0x99, 0xFC, 0xE2, 0x9B, 0xD5, 0x68, 0x47, 0xA2, 0x2C, 0xDD, 0x30, 0xC5, 0xF4, 0x85, 0x2B,
+    0xA9, 0x7A, 0xBE, 0xD2, 0x00, 0xE6, 0x37, 0xAF, 0x62, 0x69, 0xDB, 0x74, 0x8D, 0xDC, 0xC3, 0x0A,
+    0x98, 0xE1, 0x55, 0x1E, 0xBB, 0x1E, 0x3E, 0xB3, 0x3B, 0x46, 0x42, 0x12, 0x52, 0xAF, 0xBE, 0x53,
+    0xEB, 0xAC, 0xCB, 0xDD, 0xB2, 0xB4, 0xA5, 0x61, 0x07, 0x63, 0x16, 0x2A, 0x24, 0x63, 0xB8, 0x26,
+    0xDB, 0xBF, 0x11, 0xFF, 0x5E, 0x1C, 0x42, 0x2C, 0x78, 0xA0, 0x3D, 0xC6, 0x2C, 0x6F, 0xCA, 0x48,
+    0x38, 0x13, 0x16, 0xDA, 0x2D, 0x18, 0xFC, 0xA0, 0x1E, 0xA9, 0xFB, 0xC1, 0x94, 0x61, 0xA2, 0x5C,
+    0xA1, 0xDF, 0x0B, 0xBB, 0x08, 0x8D, 0x2E, 0x27, 0x23, 0xD5, 0x66, 0x1F, 0x72, 0xBD, 0x5F, 0x1D,
+    0x7B, 0x61, 0x30, 0x5B, 0xE9, 0x12, 0x1B, 0x62, 0xCF, 0xB7, 0x8B, 0xAC, 0x20, 0xB7, 0x59, 0x0D,
+    0x78, 0x79, 0x4C, 0xCA, 0x3B, 0x18, 0xCD, 0x3B, 0x75, 0x7A, 0xD3, 0xCD, 0xEA, 0x2A, 0xF3, 0x99,
+    0x5B, 0xA0, 0x32, 0xB5, 0xAE, 0x3B, 0xAC, 0x0C, 0x48, 0x5A, 0x12, 0xC6, 0xC8, 0x55, 0x9B, 0xFA,
+    0x09, 0x26, 0x99, 0x23, 0x1F, 0x1D, 0x93, 0x8F, 0xC9, 0x43, 0xEE, 0xD0, 0x99, 0x0E, 0x85, 0x7A,
+    0x00, 0x9B, 0x3C, 0x74, 0x59, 0xDD, 0x34, 0x69, 0x3B, 0xB1, 0x0C, 0xAA, 0xB6, 0x50, 0xAE, 0xB1,
+    0x89, 0x37, 0xBA, 0x3E, 0x52, 0xDF, 0xB6, 0x13, 0x1C, 0x04, 0xD6, 0x2A, 0x32, 0x97, 0x9E, 0x26,
+    0x1E, 0xF3, 0xFA, 0x08, 0xA6, 0x2D, 0x90, 0x86, 0x01, 0xD1, 0x0D, 0xF4, 0x92, 0x53, 0x32, 0x88,
+    0x13, 0x90, 0x3E, 0x09, 0xAC, 0xA1, 0x17, 0xE0, 0xA0, 0xAF, 0x91, 0xB4, 0xC0, 0x73, 0xE7, 0xB4,
+    0xEE, 0xD3, 0x2A, 0xFA, 0x26, 0x6F, 0x22, 0x70, 0x4E, 0xC3, 0x53, 0xE7, 0x35, 0x8C, 0xC0, 0xF7,
+    0x20, 0x29, 0x94, 0xFB, 0x49, 0x1A, 0xD0, 0xAE, 0x17, 0x9F, 0x76, 0x13, 0x4B, 0xA3, 0xD8, 0x7B,
+    0xE5, 0xEA, 0xC9, 0x0F, 0xF1, 0xBA, 0xF9, 0x62, 0x8E, 0x59, 0x59, 0x25, 0xAB, 0x24, 0x68, 0x97,
+    0xB9, 0x29, 0x3D, 0xD3, 0xA1, 0x63, 0x42, 0x6B, 0x69, 0xA0, 0x06, 0x0B, 0xD5, 0x2A, 0xCF, 0x82,
+    0x65, 0x25, 0x63, 0xF0, 0xBF, 0xDA, 0x1C, 0x89, 0x36, 0xE6, 0x5C, 0x9B, 0x83, 0xAD, 0x36, 0xA9,
+    0x68, 0x53, 0x89, 0x36, 0x15, 0xB5, 0x89, 0xD4, 0x66, 0xB6, 0xD5, 0x46, 0x60, 0xC8, 0x10, 0x62,
+    0x0A, 0x5C, 0x9A, 0x03, 0xF4, 0x38, 0x70, 0x87, 0xCF, 0xE5, 0x3B, 0xB8, 0xC2, 0xB6, 0x7E, 0x7C,
+    0xCB, 0xCD, 0xCA, 0x22, 0xF3, 0x8A, 0x74, 0x54, 0xBA, 0x6F, 0xAB, 0x63, 0x19, 0xA6, 0xB1, 0x2D,
+    0x2B, 0x6D, 0x15, 0x20, 0x81, 0xC3, 0xCC, 0xC8, 0x38, 0x88, 0xEF, 0xA8, 0xC3, 0xCC, 0x43, 0xF1,
+    0x2E, 0x89, 0x24, 0x69, 0xB9, 0xDE, 0x6A, 0x71, 0xC6, 0x38, 0x03, 0xB3, 0x72, 0x86, 0x19, 0x94,
+    0x27, 0xA3, 0x0B, 0xD9, 0x14, 0x98, 0xA5, 0xBE, 0xA2, 0x49, 0x03, 0xBF, 0x2D, 0x48, 0x8D, 0xA5,
+    0xB0, 0xFA, 0x84, 0x41, 0xDF, 0xB1, 0x53, 0x02, 0x5B, 0x93, 0xB3, 0x05, 0xD6, 0xB8, 0x07, 0xFB,
+    0xD7, 0x86, 0xF5, 0x56, 0x5B, 0xC1, 0x59, 0x38, 0xF6, 0xF7, 0xCF, 0x97, 0x5C, 0x48, 0x3F, 0x5A,
+    0xD8, 0x72, 0x3A, 0x85, 0x2D, 0x60, 0x2B, 0xD8, 0x06, 0xE3, 0x0E, 0x53, 0x72, 0xD3, 0xA0, 0xA9,
+    0x92, 0x90, 0x1F, 0xB6, 0xFA, 0x6C, 0x48, 0x2B, 0xE9, 0x98, 0x7D, 0xCE, 0x9D, 0x11, 0x9F, 0x1C,
+    0x0F, 0xB1, 0x24, 0x12, 0x70, 0xA4, 0x41, 0x3A, 0x15, 0x54, 0xC0, 0x94, 0x9E, 0xD5, 0x8E, 0x78,
+    0x02, 0xBB, 0x2A, 0x38, 0xFD, 0x86, 0x40, 0xD5, 0x49, 0x4B, 0xBE, 0x48, 0xD8, 0x82, 0x2E, 0x9E,
+    0x32, 0x60, 0xAF, 0x79, 0x18, 0xEA, 0xAD, 0x9D, 0x71, 0xBA, 0x4D, 0xE2, 0xB2, 0x85, 0x8E, 0xF5,
+    0x50, 0x70, 0x6F, 0x07, 0x77, 0xAF, 0x60, 0xBE, 0xC2, 0x0B, 0xB7, 0x1F, 0x1F, 0x61, 0x7F, 0x75,
+    0x0D, 0xB7, 0x4A, 0x52, 0x99, 0xBD, 0xCF, 0x92, 0xED, 0xC7, 0x43, 0x30, 0x63, 0x7D, 0xC1, 0x89,
+    0x0D, 0xF9, 0x10, 0x12, 0xB5, 0x38, 0x53, 0x80, 0xF2, 0x4B, 0x93, 0x0A, 0x8B, 0x64, 0x90, 0xEA,
+    0x13, 0x29, 0x51, 0xE6, 0x4A, 0x68, 0x64, 0xE4, 0x96, 0x12, 0xA8, 0xB9, 0xCC, 0xA2, 0xF0, 0x98,
+    0x9D, 0xB1, 0xC4, 0x3F, 0x58, 0xFB, 0x8B, 0xCC, 0x9B, 0x37, 0xCA, 0xF4, 0x7E, 0x8B, 0x77, 0x5F,
+    0xC5, 0x00, 0x19, 0x36, 0x96, 0xC4, 0x9C, 0x74, 0xCA, 0x13, 0xB4, 0x6C, 0x91, 0x44, 0xAD, 0xEB,
+    0x94, 0xBA, 0x4C, 0x65, 0xCB, 0x24, 0xEE, 0xCC, 0x59, 0x10, 0x38, 0x96, 0xFE, 0x42, 0x29, 0xCC,
+    0x63, 0xDC, 0x50, 0x6A, 0xEE, 0x8B, 0xA6, 0xA5, 0x98, 0x2A, 0x88, 0xCD, 0x16, 0xB2, 0x8B, 0x9A,
+    0x92, 0x18, 0xF9, 0x34, 0x91, 0x63, 0x40, 0x7D, 0x7F, 0x83, 0x40, 0xE7, 0x91, 0xE6, 0xD4, 0x3F,
+    0x7F, 0x4A, 0xA8, 0x62, 0x00, 0x19, 0x6B, 0x46, 0x83, 0x58, 0x92, 0x3D, 0xA5, 0x41, 0x9A, 0x32,
+    0x4E, 0xF6, 0xCB, 0xF9, 0x69, 0x8C, 0x72, 0x5E, 0xC4, 0xED, 0x86, 0x42, 0x88, 0xCF, 0xDC, 0x26,
+    0xAF, 0xB3, 0x8D, 0x7E, 0x74, 0xEF, 0x8F, 0xDC, 0x96, 0xB3, 0xD6, 0x32, 0xA9, 0x16, 0x7E, 0x71,
+    0xEB, 0x00, 0xF6, 0x90, 0x1C, 0xE6, 0x91, 0x9E, 0xED, 0x0F, 0x93, 0xA9, 0x9C, 0x24, 0x4B, 0x1A,
+    0x35, 0x89, 0xE5, 0xE5, 0xFC, 0xF0, 0x9B, 0x3F, 0x3B, 0x7D, 0x96, 0xC6, 0x8B, 0xC0, 0x57, 0xFD,
+    0x1C, 0x68, 0xE1, 0xBB, 0x7F, 0x8E, 0x3F, 0x91, 0x02, 0x02, 0xB0, 0x5C, 0xBE, 0x12, 0x97, 0x73,
+    0xF8, 0x74, 0x9D, 0x39, 0x99, 0xED, 0x37, 0x8F, 0x41, 0x1D, 0xEC, 0x67, 0xAE, 0x9F, 0x6C, 0xEE,
+    0xF9, 0x64, 0xA2, 0x90, 0x89, 0xD5, 0xE4, 0xA5, 0x20, 0x3D, 0x43, 0xE1, 0xAA, 0x3F, 0xC6, 0x68,
+    0x8C, 0xC1, 0x7A, 0x9F, 0xA4, 0x5F, 0x73, 0xA8, 0xF6, 0x14, 0x07, 0xD8, 0x5F, 0x38, 0x1A, 0xFF,
+    0x73, 0x2E, 0x3E, 0x85, 0xA5, 0x2F, 0xF5, 0xE7, 0xA3, 0x1C, 0x32, 0x8A, 0x0D, 0xBD, 0xC4, 0xA7,
+    0xCB, 0x2F, 0xE3, 0xF3, 0x0D, 0x7E, 0xFF, 0x88, 0xE6, 0x49, 0x56, 0xA2, 0x02, 0xA9, 0x25, 0xB4,
+    0x7F, 0x1D, 0xD2, 0xC3, 0xD6, 0xDC, 0x67, 0xEF, 0xF6, 0x48, 0xF6, 0xE9, 0x65, 0x3C, 0xCE, 0xF5,
+    0x37, 0xBD, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xC6, 0x73, 0x61, 0x04, 0x23, 0xCE, 0x29,
+    0x4E, 0x80, 0x50, 0x38, 0xA7, 0xA4, 0x80, 0x75, 0x73, 0xC5, 0x15, 0x76, 0x76, 0x42, 0x4B, 0xC1,
+    0x16, 0x50, 0xD3, 0x47, 0x08, 0x21, 0x44, 0x71, 0x48, 0xE6, 0xD6, 0x88, 0x82, 0x12, 0xFE, 0x41,
+    0x28, 0xE8, 0x52, 0x40, 0xB9, 0x42, 0xA7, 0xEC, 0x70, 0x29, 0x69, 0x9C, 0x1A, 0x09, 0x59, 0x28,
+    0x08, 0x51, 0x9D, 0x0B, 0x0B, 0x59, 0x97, 0xEC, 0x0E, 0xDF, 0x1B, 0xEF, 0x2D, 0x81, 0xA3, 0x09,
+    0x0A, 0xCC, 0x36, 0xFB, 0xBE, 0x99, 0xF7, 0xDE, 0xF7, 0xBE, 0x79, 0x6F, 0x0C, 0x70, 0xB5, 0x05,
+    0xCC, 0x6D, 0x60, 0xEA, 0xA1, 0x3A, 0xB1, 0x11, 0x1E, 0x20, 0x0B, 0x5D, 0xD2, 0x66, 0xBE, 0x44,
+    0xA5, 0xBD, 0xF6, 0x15, 0x0A, 0x5B, 0x1B, 0xDF, 0x63, 0x48, 0xDF, 0xB9, 0x8B, 0x10, 0x5C, 0x76,
+    0xC7, 0x27, 0x6D, 0x89, 0x32, 0x69, 0xB5, 0xCF, 0x50, 0xA0, 0x37, 0xDE, 0xFA, 0x05, 0x8A, 0xD4,
+    0xE9, 0x56, 0x22, 0xBC, 0x62, 0x6A, 0xFD, 0x43, 0x8D, 0x69, 0x0D, 0x5B, 0x8B, 0xBD, 0xF3, 0x9C,
+    0xB3, 0x59, 0xA3, 0x7F, 0x9A, 0x61, 0x05, 0x1C, 0x03, 0x19, 0x64, 0x43, 0x37, 0x00, 0x33, 0x56,
+    0xC0, 0x04, 0x48, 0x1D, 0xB4, 0x8F, 0x76, 0x5C, 0xDC, 0x63, 0xA8, 0xA4, 0x85, 0x6A, 0xC4, 0x54,
+    0xE1, 0x81, 0x0E, 0xEB, 0xA4, 0x4F, 0x5C, 0x1F, 0x1D, 0x18, 0x40, 0x32, 0xDD, 0x65, 0x1C, 0x02,
+    0xF3, 0x1A, 0xC9, 0x00, 0xE4, 0xB8, 0x08, 0x71, 0xB2, 0x87, 0x63, 0xFB, 0x70, 0xAD, 0xC2, 0x0A,
+    0x17, 0x8B, 0xC7, 0x6F, 0x48, 0xBC, 0xE7, 0xC5, 0x78, 0xE6, 0x6B, 0x84, 0x47, 0xE9, 0xFD, 0xAF,
+    0x0A, 0x29, 0x99, 0x3B, 0xA6, 0x87, 0x1E, 0xA0, 0x86, 0x68, 0x7E, 0x8F, 0x3C, 0xBD, 0xD3, 0xE7,
+    0xC1, 0x5D, 0xB8, 0x1E, 0x47, 0x71, 0x8A, 0x02, 0x87, 0xC6, 0x3D, 0x15, 0x2E, 0x37, 0xA0, 0x57,
+    0x8C, 0xA7, 0xEB, 0x83, 0x27, 0xE5, 0x62, 0xC2, 0x97, 0x69, 0x18, 0x6C, 0xF3, 0x2C, 0xF5, 0x51,
+    0xA3, 0x76, 0xE9, 0x26, 0x21, 0x81, 0x35, 0x29, 0x90, 0xC9, 0x09, 0xC1, 0x98, 0x3E, 0xE9, 0x66,
+    0x6A, 0xC8, 0xCF, 0x06, 0x13, 0x18, 0xB3, 0x86, 0x6A, 0xA3, 0xD2, 0xFC, 0xF7, 0x42, 0x83, 0x54,
+    0x74, 0xBD, 0xE5, 0xD2, 0xE0, 0x57, 0x2F, 0xF3, 0x68, 0x26, 0xAC, 0x30, 0x77, 0x72, 0x67, 0x59,
+    0x2D, 0x66, 0x71, 0x35, 0xE9, 0xCE, 0x97, 0x6F, 0xD0, 0xF5, 0x50, 0x3C, 0x29, 0x9D, 0xF6, 0xEA,
+    0xFD, 0xD1, 0x6F, 0xEC, 0x1A, 0xFB, 0xEE, 0xE3, 0x5D, 0x93, 0xAD, 0x19, 0x6C, 0x10, 0x59, 0x4A,
+    0xF2, 0xF4, 0x91, 0x9B, 0xE8, 0x92, 0xB3, 0x03, 0x96, 0x2E, 0x92, 0x13, 0x9E, 0x96, 0x3B, 0xC5,
+    0x28, 0xCE, 0xC9, 0x15, 0xA6, 0x5A, 0x2E, 0x5B, 0xA1, 0x77, 0xB1, 0x18, 0xF6, 0xE3, 0x4E, 0xA2,
+    0x66, 0xD1, 0xBC, 0xE5, 0x74, 0xE8, 0x28, 0x4E, 0x1A, 0x65, 0x66, 0xA9, 0x54, 0x07, 0x8C, 0x44,
+    0x8A, 0x4C, 0xA1, 0xBD, 0xB3, 0xFE, 0x7C, 0xE9, 0x96, 0x51, 0xDA, 0x2C, 0x84, 0x9F, 0x03, 0x55,
+    0x66, 0x27, 0x89, 0xEE, 0x3C, 0x4F, 0xCE, 0x28, 0x63, 0x2F, 0x49, 0x4A, 0xE1, 0xB4, 0xC0, 0x63,
+    0xDB, 0x42, 0x7C, 0xB2, 0xDD, 0xA6, 0x2C, 0xF8, 0x68, 0xF4, 0xD9, 0x05, 0x5E, 0x64, 0xFF, 0x09,
+    0xAB, 0xAB, 0x30, 0x72, 0x3C, 0x7F, 0x3B, 0x0F, 0xFE, 0x78, 0x46, 0xD6, 0x95, 0x74, 0xEE, 0x42,
+    0xA2, 0x74, 0x8C, 0xC1, 0xD3, 0x13, 0xA8, 0xF3, 0xDA, 0x0E, 0x38, 0x80, 0x75, 0xF8, 0x84, 0xFD,
+    0xAA, 0x2A, 0x4C, 0xC7, 0xFB, 0x2A, 0x2C, 0xCC, 0x17, 0x9C, 0x27, 0x66, 0x73, 0xF1, 0xF2, 0xC2,
+    0xB9, 0x10, 0x2C, 0xE3, 0xFD, 0x90, 0x8E, 0xE4, 0xEA, 0x71, 0xC9, 0x2E, 0x22, 0xBB, 0xBF, 0xD8,
+    0xC2, 0xC1, 0xBA, 0x9D, 0x43, 0x7C, 0xC8, 0x71, 0x24, 0x1B, 0x1B, 0x3A, 0xF3, 0x8B, 0x78, 0x55,
+    0x72, 0x88, 0x8C, 0x4A, 0x39, 0x41, 0x97, 0x89, 0xD4, 0x48, 0x42, 0xC9, 0x5A, 0x9C, 0xE6, 0x21,
+    0x7C, 0x13, 0x42, 0x73, 0x69, 0xD0, 0x1A, 0x2C, 0x43, 0x9B, 0x53, 0xF6, 0xED, 0xE0, 0xA9, 0xBF,
+    0x0F, 0xE2, 0x3F, 0x55, 0x9E, 0xFF, 0x66, 0x42, 0x73, 0xB9, 0x72, 0x59, 0x6E, 0x87, 0x75, 0xBE,
+    0x09, 0x7C, 0xC7, 0x56, 0x3D, 0xB0, 0x63, 0xF9, 0x47, 0x0C, 0xC4, 0x33, 0x1D, 0x3D, 0x16, 0xF4,
+    0x7F, 0x9D, 0x39, 0x52, 0xB7, 0x20, 0x58, 0x0A, 0x88, 0x08, 0x96, 0x02, 0x62, 0x0B, 0x8E, 0x27,
+    0x4B, 0x56, 0x9D, 0xCB, 0xCF, 0xE9, 0x35, 0xE3, 0x6D, 0xDB, 0x7F, 0x07, 0x2E, 0x6D, 0xDB, 0x74,
+    0xDE, 0xE9, 0x9B, 0x72, 0x37, 0xCA, 0x61, 0xD6, 0x63, 0x51, 0xA0, 0x4C, 0x91, 0x1A, 0x6F, 0x4E,
+    0x5B, 0xD5, 0x8E, 0x76, 0x86, 0xCC, 0xD4, 0xE9, 0x69, 0x6B, 0xDA, 0x13, 0xD3, 0x67, 0x67, 0xEF,
+    0x25, 0xE1, 0xAD, 0xF1, 0x11, 0x08, 0x54, 0x74, 0xD3, 0x6D, 0xA6, 0x46, 0xC1, 0x22, 0x32, 0xE6,
+    0xB2, 0x75, 0x81, 0xA4, 0xA1, 0xE6, 0x3D, 0x95, 0x2C, 0xA8, 0x4E, 0x26, 0x72, 0x13, 0xD4, 0x02,
+    0x76, 0x5B, 0xB0, 0xDF, 0x80, 0xA9, 0x4B, 0x3A, 0xFE, 0x7A, 0x4C, 0xCF, 0x7A, 0x24, 0xDB, 0xEE,
+    0x9D, 0xAE, 0xD9, 0x83, 0x42, 0x75, 0x0F, 0x57, 0x52, 0x67, 0x3F, 0xF3, 0xBA, 0xE9, 0xD0, 0x55,
+    0xA8, 0x26, 0xD8, 0x1F, 0xED, 0xFB, 0x9D, 0xEA, 0x8E, 0xF0, 0x68, 0xC2, 0x17, 0xC1, 0xCF, 0x6F,
+    0xAE, 0x7F, 0xF7, 0x79, 0x3F, 0x0E, 0x8F, 0xC2, 0x75, 0xF6, 0xFE, 0x6B, 0x9C, 0x16, 0xB6, 0xB2,
+    0x1A, 0x25, 0x7D, 0xFA, 0xFA, 0x5D, 0x57, 0xD8, 0xD5, 0x75, 0x12, 0x7C, 0x1C, 0xCA, 0x7F, 0xA1,
+    0x1F, 0x6F, 0x20, 0xBE, 0x34, 0xB8, 0x76, 0x8D, 0x02, 0xB2, 0x3F, 0xF0, 0xAB, 0xC7, 0xE6, 0x8D,
+    0xFF, 0x0F, 0x04, 0x25, 0x41, 0x3E, 0x94, 0xEA, 0xD4, 0xE3, 0xDB, 0x0F, 0xB0, 0x7B, 0xB4, 0x11,
+    0xE6, 0xC9, 0xD5, 0x1D, 0xE9, 0xDD, 0xE3, 0x83, 0x71, 0x8F, 0x63, 0x7D, 0xDA, 0x20, 0xF9, 0xD4,
+    0x47, 0x6C, 0x7F, 0x24, 0x53, 0x91, 0xCC, 0x24, 0x4E, 0x58, 0x45, 0x32, 0x9C, 0x01, 0x11, 0x92,
+    0x5F, 0xBE, 0x08, 0xA6, 0x02, 0xFA, 0x2D, 0xD8, 0x6C, 0xC0, 0x92, 0x2F, 0x19, 0x7F, 0x0D, 0xC2,
+    0xB2, 0x81, 0x0D, 0xCD, 0x9F, 0x89, 0x60, 0x3F, 0xE7, 0xB0, 0xB0, 0x2C, 0x26, 0x7C, 0xF5, 0xA5,
+    0x88, 0xCC, 0xB0, 0xA7, 0x9B, 0xA4, 0xA5, 0xCC, 0xAE, 0x40, 0xA1, 0xC8, 0x93, 0xDF, 0xD3, 0xBA,
+    0x8C, 0xA1, 0xF8, 0xED, 0x34, 0x7E, 0x1F, 0x53, 0x2C, 0xD4, 0x90, 0x74, 0x59, 0x63, 0x1E, 0xFE,
+    0x08, 0xBB, 0x2A, 0xF0, 0x7F, 0xAC, 0x3F, 0x00, 0xAD, 0x55, 0x31, 0x6C, 0x1C, 0x45, 0x14, 0x7D,
+    0xB3, 0xE3, 0x63, 0x51, 0x36, 0xB9, 0x71, 0x50, 0x22, 0x28, 0xEC, 0xBB, 0x14, 0x14, 0x51, 0xE4,
+    0xBB, 0x13, 0x92, 0x8B, 0x0B, 0x9A, 0xF5, 0xAE, 0x9D, 0x22, 0x05, 0x45, 0x5C, 0xE4, 0x6A, 0x28,
+    0xA8, 0x90, 0x82, 0x5C, 0xB8, 0x38, 0x45, 0x6B, 0x6E, 0xB1, 0x25, 0x22, 0x81, 0x04, 0x91, 0x28,
+    0x69, 0x22, 0x41, 0x81, 0x0E, 0x81, 0x2C, 0x74, 0x48, 0x07, 0xC4, 0xF1, 0x38, 0x29, 0x22, 0x41,
+    0x91, 0x89, 0x5C, 0xA4, 0x88, 0x44, 0x36, 0xB8, 0x40, 0x4A, 0xB5, 0x89, 0x16, 0xC5, 0x22, 0x7B,
+    0x37, 0xFC, 0xD9, 0x3D, 0x93, 0x10, 0xD1, 0x20, 0x65, 0x76, 0x67, 0xB5, 0xFB, 0xE7, 0xCF, 0x9F,
+    0xF7, 0xFF, 0x7B, 0x33, 0xCB, 0x12, 0x08, 0x0C, 0xE1, 0x2A, 0x1F, 0x4E, 0x22, 0x80, 0x81, 0xAB,
+    0xE0, 0x3B, 0xD6, 0x98, 0x91, 0x51, 0x96, 0xC6, 0x8C, 0x8C, 0xF2, 0x1F, 0xE3, 0xC4, 0x33, 0xE3,
+    0x1A, 0x57, 0xE9, 0xDA, 0x82, 0x78, 0x32, 0x02, 0xB6, 0xA9, 0xB3, 0xA4, 0xEC, 0x48, 0xA9, 0x4B,
+    0xEA, 0x9E, 0xFD, 0x58, 0x06, 0x2A, 0x60, 0x67, 0xB4, 0x93, 0xA4, 0xC8, 0x24, 0x64, 0x1D, 0x75,
+    0x2F, 0x76, 0x37, 0xCA, 0xEF, 0x08, 0x51, 0x0D, 0x81, 0x17, 0xD7, 0xD7, 0xD3, 0xBA, 0xEE, 0x6D,
+    0x6D, 0x7A, 0x23, 0x9A, 0x37, 0x57, 0xDC, 0xB3, 0x80, 0x1B, 0x02, 0xB9, 0x9D, 0x7E, 0xD0, 0xB6,
+    0xEC, 0xA3, 0x65, 0xC3, 0x7B, 0x9F, 0xD0, 0x18, 0xD3, 0x73, 0x93, 0x81, 0x2E, 0x81, 0xE3, 0x77,
+    0x94, 0x93, 0x21, 0x92, 0x08, 0x42, 0xB1, 0xA1, 0xBC, 0x0C, 0xA9, 0xC4, 0xE3, 0xB0, 0xC9, 0x55,
+    0xA3, 0xCB, 0x95, 0xE4, 0x37, 0xE3, 0x21, 0x57, 0xDD, 0xAE, 0x80, 0x14, 0xEE, 0x87, 0x29, 0xDF,
+    0x49, 0xDA, 0x3E, 0xA4, 0xE4, 0x97, 0x14, 0x8D, 0xC8, 0x01, 0xE4, 0x80, 0xDF, 0x02, 0xBF, 0x07,
+    0x3F, 0x41, 0x53, 0xF3, 0x1C, 0x4E, 0x8E, 0x20, 0x46, 0x2B, 0xE4, 0x29, 0x9C, 0x14, 0x0B, 0x07,
+    0x08, 0x58, 0x46, 0x8F, 0x3A, 0x21, 0x60, 0xF7, 0x29, 0xB9, 0x59, 0xA6, 0x4A, 0x2B, 0x61, 0xAC,
+    0x34, 0x09, 0xDE, 0x70, 0xC8, 0x33, 0x0A, 0x5D, 0xD3, 0x4D, 0x37, 0x7E, 0x1C, 0xA7, 0x35, 0xF7,
+    0x53, 0x57, 0x75, 0x65, 0xDB, 0x67, 0x0F, 0x93, 0xFB, 0xA9, 0xFB, 0x2B, 0xFF, 0x2C, 0x14, 0x6D,
+    0x21, 0xB1, 0xA0, 0x16, 0x34, 0xC6, 0x30, 0x20, 0xEF, 0x7D, 0x08, 0x25, 0xCA, 0x30, 0x36, 0xD9,
+    0x40, 0x43, 0x9C, 0x83, 0xA3, 0xDA, 0xF6, 0x7B, 0x08, 0xEF, 0x92, 0x62, 0x94, 0x87, 0xCF, 0xB5,
+    0x17, 0x37, 0x59, 0xCA, 0x52, 0x1F, 0xC2, 0x8B, 0xF1, 0x67, 0x0A, 0x8F, 0x8A, 0xD1, 0x8B, 0x41,
+    0xF8, 0xE0, 0x03, 0x9C, 0x22, 0x44, 0x54, 0xB1, 0xD8, 0x4E, 0x82, 0x08, 0x4B, 0x12, 0x8A, 0x16,
+    0x50, 0x37, 0xE4, 0xB8, 0xAB, 0xE0, 0x21, 0x29, 0x4C, 0xCB, 0x84, 0x77, 0x48, 0xD3, 0x86, 0x34,
+    0x27, 0x22, 0x56, 0x25, 0xA5, 0x28, 0x29, 0x84, 0xA4, 0xD0, 0x3E, 0x91, 0xDB, 0x68, 0x52, 0x6E,
+    0xC4, 0x44, 0x6D, 0x00, 0x54, 0x29, 0x90, 0xD0, 0xD4, 0x55, 0x19, 0xB7, 0x35, 0x21, 0x77, 0x9F,
+    0x96, 0x4F, 0x0B, 0x08, 0x45, 0x13, 0xB4, 0x74, 0xDA, 0x9D, 0x2C, 0x49, 0x61, 0x86, 0x11, 0xEA,
+    0x5C, 0x71, 0x4D, 0x8B, 0x38, 0x09, 0x71, 0x4E, 0x72, 0x49, 0x87, 0x10, 0x6F, 0x03, 0x3F, 0x6B,
+    0xB8, 0xFB, 0x05, 0x2C, 0xB2, 0xD9, 0x50, 0x24, 0x2F, 0x22, 0xD0, 0x4E, 0x22, 0x28, 0x44, 0xE4,
+    0x41, 0x23, 0x50, 0xC5, 0x98, 0xB5, 0x9C, 0x2C, 0x4D, 0x3D, 0x93, 0x63, 0x9B, 0x3A, 0x18, 0x45,
+    0xE0, 0x94, 0x8C, 0x47, 0xE3, 0x75, 0x14, 0x25, 0xB0, 0x88, 0x6C, 0x35, 0x9E, 0x33, 0x39, 0x07,
+    0x26, 0xC2, 0x1E, 0x18, 0x53, 0xF4, 0x12, 0xA4, 0xB2, 0xD1, 0x29, 0x6B, 0xA7, 0x48, 0xA1, 0xD2,
+    0x59, 0x76, 0x29, 0x72, 0x67, 0x0D, 0x96, 0xED, 0x56, 0x11, 0x83, 0xF2, 0xB5, 0x77, 0x3C, 0xF1,
+    0xB5, 0xEE, 0x7F, 0xF5, 0x99, 0xA1, 0x6A, 0x62, 0x0A, 0xE5, 0x2A, 0xB6, 0x1C, 0x53, 0x2F, 0x18,
+    0x5C, 0x08, 0x56, 0xA8, 0x8E, 0x5E, 0xA8, 0x75, 0x3A, 0xB4, 0x62, 0x81, 0x6B, 0xDF, 0x1A, 0x09,
+    0x04, 0x61, 0xF2, 0x9F, 0x7E, 0x51, 0xB8, 0xA0, 0x7F, 0xA5, 0x67, 0x4A, 0x6A, 0x1D, 0x45, 0xA5,
+    0x7C, 0x94, 0x94, 0xC4, 0x2C, 0xBC, 0xF0, 0xAA, 0x79, 0x8E, 0xC6, 0x23, 0x8D, 0xBA, 0x2E, 0xE2,
+    0xFC, 0xEF, 0xAA, 0x15, 0x68, 0x68, 0xEE, 0x93, 0x10, 0xCD, 0xF2, 0xA0, 0x70, 0x27, 0xEB, 0x0E,
+    0x4B, 0x39, 0x58, 0xAE, 0x49, 0xC7, 0x8E, 0x05, 0x19, 0x96, 0x68, 0x26, 0x4E, 0xD6, 0x3F, 0x2B,
+    0x85, 0xFE, 0x8C, 0x93, 0x55, 0xE4, 0xD5, 0x62, 0xD7, 0x60, 0x64, 0x83, 0x93, 0xCE, 0xA4, 0x3D,
+    0x36, 0x7C, 0xB1, 0xA4, 0x57, 0x4B, 0xF5, 0x07, 0xDA, 0x97, 0x27, 0x79, 0xC8, 0x70, 0x74, 0x7C,
+    0xC4, 0x37, 0x37, 0x58, 0xD2, 0x1B, 0x6D, 0xE7, 0x76, 0x4F, 0x98, 0xDF, 0xFB, 0xFD, 0xF0, 0x04,
+    0x6B, 0x57, 0x83, 0xDC, 0x4B, 0xA6, 0x7C, 0x9F, 0x68, 0x94, 0x4D, 0xD9, 0x00, 0x8E, 0xF3, 0xDC,
+    0x51, 0xD1, 0x02, 0x8F, 0xA7, 0x69, 0x67, 0x6F, 0x6F, 0x9C, 0x9D, 0x39, 0x7C, 0x3A, 0xB5, 0xCB,
+    0x43, 0xFA, 0xE2, 0xAD, 0xF5, 0xDB, 0x7A, 0x65, 0xDE, 0x0A, 0xDE, 0xD9, 0xD9, 0x53, 0x2D, 0xE5,
+    0xD2, 0x7E, 0xAD, 0x35, 0xA4, 0x94, 0xAF, 0xD7, 0x6A, 0xB3, 0x0D, 0xFB, 0x62, 0x1D, 0xF9, 0x6E,
+    0x52, 0x13, 0xD8, 0x5C, 0xE5, 0xEB, 0xAA, 0x38, 0x9D, 0x5A, 0xF8, 0x68, 0xAA, 0x2D, 0x3C, 0x83,
+    0x6B, 0x60, 0xCB, 0xF5, 0xFC, 0xF4, 0x85, 0x77, 0x8E, 0x10, 0x51, 0x82, 0xB6, 0xB3, 0xAB, 0xA6,
+    0x29, 0xBD, 0xA1, 0x70, 0x12, 0xC2, 0x3D, 0x8D, 0x6E, 0x14, 0x49, 0x39, 0x37, 0xF5, 0x8C, 0x05,
+    0x75, 0x47, 0x4B, 0x4E, 0x29, 0xAD, 0x95, 0x29, 0x85, 0xD5, 0x53, 0xBB, 0x04, 0xEF, 0xD8, 0x14,
+    0x57, 0x0B, 0x9F, 0xE7, 0xAB, 0x15, 0xF4, 0xC6, 0xA7, 0xBE, 0xA5, 0x03, 0x73, 0x0E, 0x6D, 0xCC,
+    0x63, 0x85, 0xEB, 0x48, 0x9C, 0x4D, 0xA8, 0x50, 0x2F, 0xB9, 0x1B, 0xB1, 0x9E, 0x73, 0xE0, 0x62,
+    0xB3, 0x7E, 0x8E, 0x6A, 0x13, 0x3C, 0xBC, 0x16, 0xA7, 0x3C, 0xB6, 0x87, 0xD5, 0x6A, 0xEB, 0x8B,
+    0x71, 0x15, 0x97, 0x8F, 0x9F, 0x1B, 0x5B, 0xAC, 0x0D, 0x2A, 0x19, 0x57, 0x43, 0xE3, 0x69, 0x78,
+    0x67, 0x74, 0x2A, 0xEB, 0x3C, 0xFF, 0xE0, 0x58, 0x14, 0xD1, 0xCA, 0xB2, 0x11, 0x11, 0x01, 0x15,
+    0x9E, 0x6F, 0x3E, 0x38, 0x74, 0xF1, 0x76, 0xC6, 0x96, 0x74, 0xB2, 0x79, 0x02, 0x3C, 0x5C, 0x75,
+    0x74, 0xED, 0xD5, 0xDD, 0xCC, 0x13, 0xEE, 0x92, 0xEE, 0xB1, 0xB0, 0xC8, 0xBF, 0xFB, 0x6E, 0x60,
+    0xF6, 0x1E, 0x7C, 0xB7, 0x82, 0xBB, 0x98, 0x59, 0x66, 0xE1, 0xF4, 0xF4, 0xD1, 0xEB, 0xD7, 0x6F,
+    0x98, 0x11, 0x5B, 0x24, 0xE4, 0x55, 0xBE, 0xF3, 0x87, 0x0A, 0x94, 0x65, 0x91, 0xB4, 0x26, 0x32,
+    0x5F, 0x5E, 0xA9, 0x9E, 0x60, 0x55, 0xBE, 0x61, 0x54, 0x2B, 0xB6, 0xF5, 0xF0, 0xDF, 0x5F, 0x39,
+    0xC4, 0xB0, 0x38, 0x9E, 0x7D, 0xD3, 0xDC, 0x74, 0x88, 0x9F, 0x5E, 0x1E, 0x18, 0x7B, 0x57, 0x3A,
+    0xE7, 0x5B, 0x66, 0x44, 0x4F, 0x4B, 0xA4, 0xD9, 0x3F, 0xD5, 0xFF, 0xEA, 0xA9, 0x17, 0x09, 0xC4,
+    0x98, 0x7E, 0xFF, 0x0A, 0x29, 0xD3, 0xDC, 0xA1, 0x9E, 0xE3, 0x65, 0x6C, 0xB9, 0x59, 0x10, 0x97,
+    0x87, 0x90, 0xFD, 0x11, 0xC9, 0x52, 0x44, 0x24, 0x20, 0x22, 0xD5, 0xA6, 0x4E, 0x6F, 0xB5, 0x52,
+    0x42, 0x83, 0x42, 0x45, 0x24, 0x66, 0xAA, 0x9A, 0x7D, 0xFB, 0x4F, 0x77, 0xFA, 0x75, 0xE1, 0xB5,
+    0x9A, 0x57, 0x8D, 0xA6, 0xE7, 0xF1, 0x65, 0x58, 0x5D, 0xC5, 0x5D, 0x93, 0x77, 0x3A, 0x61, 0xA5,
+    0x73, 0xC6, 0x8C, 0xE7, 0x71, 0x07, 0x33, 0x3F, 0x7D, 0xF3, 0x4B, 0xFF, 0x6B, 0xB6, 0xB8, 0x64,
+    0xC6, 0x2B, 0x9B, 0x3F, 0x30, 0x06, 0x7C, 0xBF, 0x33, 0xE2, 0xC9, 0x45, 0xBD, 0x08, 0x5C, 0x5E,
+    0x13, 0x48, 0xDD, 0xB8, 0xDD, 0x72, 0xC8, 0xFF, 0x7C, 0xDD, 0x8C, 0x0F, 0xB2, 0xC8, 0x29, 0x0B,
+    0xDA, 0x3C, 0x02, 0xAB, 0x8E, 0x95, 0xB2, 0x8A, 0x5C, 0x3A, 0xEB, 0x2B, 0x58, 0x1A, 0xCD, 0x5C,
+    0x34, 0x1F, 0x3B, 0xC9, 0x31, 0xA1, 0x06, 0x73, 0x87, 0x49, 0x83, 0xB4, 0x1D, 0xFC, 0x1F, 0xF7,
+    0x6E, 0x35, 0xE8, 0x17, 0xD3, 0x1D, 0x6C, 0xAD, 0x59, 0x6D, 0x9B, 0x71, 0xA3, 0x73, 0xA1, 0x8D,
+    0x99, 0xB6, 0xFD, 0x3F, 0xD2, 0xD6, 0xEB, 0x3C, 0x17, 0xB6, 0x51, 0xE8, 0x4F, 0x52, 0x01, 0xDE,
+    0xEB, 0xA5, 0xED, 0x59, 0xD7, 0xD6, 0xE1, 0x95, 0x1D, 0x91, 0xED, 0xDD, 0xCB, 0xDF, 0xF8, 0xED,
+    0xE0, 0x94, 0xFA, 0x57, 0xFB, 0x1B, 0x7D, 0x54, 0x4F, 0x68, 0x1C, 0x55, 0x1C, 0xFE, 0x66, 0x5E,
+    0x92, 0x49, 0x32, 0x69, 0x27, 0x48, 0x0A, 0x25, 0x04, 0x27, 0x87, 0x80, 0x3D, 0xD8, 0xDD, 0x15,
+    0x72, 0x10, 0x9D, 0xE9, 0xBE, 0x58, 0xD0, 0x6B, 0x84, 0x46, 0x41, 0x91, 0x46, 0xC5, 0x93, 0x07,
+    0x73, 0xA8, 0x10, 0x61, 0x63, 0xA6, 0x8D, 0xD8, 0x8B, 0xE0, 0x1E, 0x44, 0x3C, 0x78, 0x50, 0x10,
+    0xD1, 0xBD, 0x24, 0x48, 0xA1, 0x4B, 0x1B, 0x93, 0xA9, 0x39, 0xF6, 0x32, 0x56, 0xD4, 0xEB, 0x58,
+    0xE9, 0xC1, 0x7A, 0x70, 0xC4, 0x29, 0x6E, 0x70, 0xB3, 0xCF, 0xEF, 0xF7, 0x76, 0x63, 0x2A, 0x16,
+    0x5F, 0x32, 0xBB, 0x3B, 0xEF, 0xFD, 0xFE, 0x7C, 0xDF, 0xEF, 0xFB, 0xFD, 0x1E, 0x00, 0x6C, 0x41,
+    0xA5, 0xD0, 0x43, 0x41, 0xB9, 0x75, 0xCD, 0x9C, 0x5D, 0xB8, 0x82, 0xC7, 0xE1, 0x14, 0x70, 0x35,
+    0xA0, 0x27, 0xAB, 0xB7, 0xD3, 0x1F, 0x0E, 0x1C, 0x68, 0x3F, 0x69, 0x5E, 0x37, 0xEA, 0xA9, 0x9C,
+    0xD6, 0x98, 0x5D, 0x0E, 0x37, 0x37, 0x4C, 0x77, 0xFC, 0x98, 0xBC, 0x78, 0x97, 0xCB, 0xAD, 0xE8,
+    0x38, 0x8C, 0xEA, 0x06, 0xBD, 0xE6, 0xB4, 0x7E, 0x3D, 0xE3, 0xDE, 0x1A, 0x5E, 0x58, 0xF4, 0x70,
+    0x62, 0x58, 0x63, 0x04, 0x63, 0x70, 0x34, 0xA6, 0x8E, 0x4D, 0xC1, 0x79, 0xE6, 0x16, 0x30, 0xBA,
+    0x36, 0x0B, 0x5C, 0xA6, 0xCD, 0xD0, 0xCA, 0x29, 0x38, 0x09, 0x16, 0xF9, 0x37, 0xAC, 0x4F, 0x20,
+    0x1B, 0xFB, 0x9C, 0x5E, 0x8C, 0x76, 0xC7, 0x39, 0x37, 0xBC, 0x5B, 0xD4, 0x53, 0x93, 0x54, 0x16,
+    0x7E, 0xEF, 0x32, 0xDD, 0x58, 0xB4, 0x95, 0x5F, 0x98, 0x02, 0xFC, 0x4E, 0xF5, 0xEB, 0x79, 0xFF,
+    0xA1, 0x54, 0x65, 0x6E, 0x82, 0x99, 0x1F, 0xCB, 0xEE, 0xF5, 0x77, 0xB4, 0x7B, 0xFE, 0xE6, 0xC5,
+    0x6D, 0x57, 0xCF, 0xFB, 0x79, 0x63, 0x67, 0x1E, 0xD9, 0xB8, 0x97, 0x97, 0xC1, 0xF9, 0xCB, 0x3F,
+    0x7F, 0x9C, 0xAD, 0x64, 0xA3, 0xC7, 0x3D, 0x3F, 0x9E, 0x1C, 0x8A, 0xE3, 0x21, 0xD2, 0x7B, 0xF2,
+    0xD6, 0x7E, 0xF5, 0xC6, 0x47, 0x70, 0x54, 0xEF, 0x60, 0xA5, 0xB8, 0xE6, 0x7B, 0x6F, 0xDE, 0xBB,
+    0xBD, 0xDF, 0x99, 0x9D, 0xF1, 0xF7, 0x5F, 0x52, 0x20, 0x59, 0xA0, 0x68, 0x03, 0xA1, 0x3E, 0x80,
+    0x57, 0x62, 0xD7, 0xF4, 0x80, 0xE9, 0x96, 0xC6, 0x15, 0xC0, 0xF9, 0x39, 0x05, 0xB6, 0xC3, 0xA6,
+    0xB3, 0x83, 0xBA, 0x31, 0x1A, 0xD3, 0x5F, 0x42, 0x7E, 0x7C, 0x67, 0x4C, 0x77, 0xF0, 0x85, 0x73,
+    0xC0, 0xE4, 0xBA, 0x69, 0xBA, 0x7B, 0xDF, 0xBF, 0x61, 0x0E, 0x48, 0x69, 0x33, 0x01, 0x96, 0xE8,
+    0xB9, 0x6B, 0x72, 0xD4, 0xEF, 0xBC, 0x58, 0xAA, 0x1C, 0x4E, 0x19, 0x49, 0x0A, 0x96, 0x13, 0xF2,
+    0xD8, 0x35, 0x3C, 0xD2, 0x6A, 0xB5, 0x76, 0x18, 0x84, 0x21, 0x00, 0x32, 0x92, 0xE5, 0x7F, 0xF0,
+    0xC9, 0x9E, 0x9A, 0x38, 0xF5, 0x58, 0xF6, 0x1A, 0xC2, 0xF7, 0x9E, 0xB8, 0xAA, 0x3F, 0x1D, 0xD1,
+    0x13, 0x98, 0x9A, 0xAB, 0xD5, 0x96, 0xB5, 0x9F, 0x35, 0x79, 0x34, 0x31, 0x9F, 0x9D, 0xC2, 0xC9,
+    0xB9, 0x66, 0xDF, 0xEA, 0x65, 0x8C, 0x6F, 0x60, 0x79, 0x0C, 0x2B, 0x4E, 0x93, 0xCE, 0x35, 0xE7,
+    0xD2, 0x2F, 0xA7, 0x6A, 0xE9, 0xDE, 0xF8, 0xC4, 0x85, 0x93, 0x4C, 0x53, 0x43, 0x3A, 0xD2, 0x7E,
+    0xB4, 0x96, 0xED, 0x8D, 0x8C, 0xCE, 0x4D, 0xEA, 0xB1, 0xAF, 0xB2, 0xBD, 0x77, 0x4F, 0xD6, 0x5E,
+    0x39, 0x3B, 0x56, 0x5B, 0xBE, 0x31, 0x34, 0x34, 0x7D, 0x29, 0x9D, 0x57, 0x98, 0x75, 0x80, 0xA9,
+    0xB7, 0x6A, 0xCB, 0xCD, 0x6C, 0x6E, 0xF1, 0xC3, 0x99, 0x57, 0xDD, 0xE5, 0xC8, 0xD1, 0xA3, 0xB3,
+    0x8F, 0xE0, 0x82, 0x9B, 0xCD, 0xA5, 0x0B, 0x7D, 0x9C, 0x15, 0x41, 0x0E, 0x28, 0x02, 0x9C, 0xB1,
+    0x1B, 0xEB, 0x26, 0xF3, 0xCD, 0x01, 0x4A, 0x20, 0x80, 0x74, 0x89, 0x58, 0xB8, 0x94, 0xE9, 0xCC,
+    0x92, 0x56, 0xDC, 0x7F, 0xBB, 0x95, 0xF8, 0xB4, 0xED, 0x1F, 0x8B, 0x67, 0xD8, 0x3F, 0xAE, 0x9B,
+    0x42, 0x19, 0x43, 0x8F, 0x05, 0x8D, 0x28, 0x62, 0xD3, 0xA4, 0x98, 0xB4, 0xF1, 0x3C, 0x3A, 0xED,
+    0x9A, 0x2C, 0xD0, 0xF7, 0x5B, 0x33, 0xA6, 0xBA, 0x73, 0x8E, 0x4E, 0x99, 0x77, 0xF7, 0x0B, 0x50,
+    0x9B, 0xC1, 0xF1, 0x51, 0x4A, 0x09, 0xC6, 0x98, 0xA2, 0x86, 0x67, 0xF8, 0x7D, 0x64, 0x33, 0x08,
+    0x51, 0xDD, 0xD1, 0x62, 0x13, 0x3B, 0x1D, 0x2F, 0xF5, 0xD2, 0x36, 0xE2, 0x40, 0xAB, 0xAC, 0x40,
+    0x14, 0xC0, 0xBF, 0x51, 0x38, 0x65, 0xE5, 0x78, 0x4F, 0x65, 0x26, 0xC1, 0x3F, 0xAB, 0x61, 0xA3,
+    0x73, 0x0C, 0xB0, 0x72, 0xC4, 0xB3, 0xFB, 0x5F, 0x9E, 0x71, 0xDF, 0x88, 0xE6, 0x0F, 0xE4, 0x39,
+    0x38, 0xB6, 0x2B, 0x34, 0x09, 0x21, 0xE8, 0xBA, 0x1E, 0x55, 0x34, 0xA8, 0xC2, 0x9A, 0xFB, 0x3C,
+    0x3D, 0xC3, 0x9F, 0xC6, 0x16, 0x24, 0x09, 0xFB, 0xA9, 0x25, 0x81, 0xE2, 0x54, 0x04, 0x3C, 0x0D,
+    0x19, 0x37, 0xFC, 0xAB, 0xA4, 0xFB, 0x61, 0x20, 0xF8, 0xA6, 0x19, 0x98, 0x8E, 0x9F, 0x8D, 0xD2,
+    0x46, 0x4C, 0x05, 0x6C, 0x02, 0xB7, 0xC3, 0xA8, 0xDC, 0x60, 0xBF, 0xFA, 0xF4, 0xDD, 0x3E, 0x64,
+    0xE0, 0x16, 0x8B, 0x4E, 0xA7, 0xFA, 0x5B, 0xC7, 0x33, 0xA5, 0xF5, 0x5E, 0x75, 0xF3, 0x40, 0x47,
+    0x4E, 0xE1, 0x27, 0x15, 0x94, 0x2A, 0x0D, 0xD1, 0x56, 0xD9, 0x60, 0x23, 0x16, 0xE8, 0xCF, 0xEA,
+    0x20, 0xC2, 0x1F, 0xFD, 0x64, 0x5E, 0xC2, 0x52, 0xB2, 0x92, 0x05, 0x09, 0x91, 0x4F, 0x45, 0x50,
+    0x51, 0xAE, 0xB4, 0xBF, 0x5B, 0x32, 0x03, 0xF3, 0x0F, 0x76, 0xB9, 0x22, 0x8B, 0xA5, 0x6D, 0x99,
+    0x15, 0xF6, 0xD2, 0xC8, 0xE5, 0x9F, 0xC7, 0xC4, 0x41, 0x2F, 0xD6, 0x88, 0x6E, 0x81, 0x45, 0x16,
+    0xDA, 0x1A, 0xC6, 0xD6, 0x69, 0x1B, 0x4F, 0x97, 0xE0, 0x84, 0xB4, 0x60, 0x4B, 0xC1, 0xDC, 0x8E,
+    0xFD, 0x74, 0x33, 0x3A, 0xD1, 0x57, 0x6A, 0xEB, 0xA5, 0xA2, 0xA8, 0x9F, 0xC8, 0x67, 0xA0, 0xA5,
+    0xCC, 0x01, 0xC2, 0x9E, 0xC4, 0xA9, 0xD2, 0xF3, 0x34, 0x62, 0xB7, 0x64, 0xA8, 0x88, 0xD9, 0x23,
+    0x82, 0x68, 0x60, 0xD5, 0x7E, 0x96, 0x7C, 0x6F, 0x13, 0x4B, 0x09, 0x19, 0xBD, 0xC2, 0x2B, 0x4C,
+    0x2A, 0xA1, 0x0D, 0x5C, 0xB3, 0x7F, 0x58, 0xCE, 0x55, 0x81, 0xE3, 0x27, 0x52, 0xC9, 0x52, 0x30,
+    0x05, 0x82, 0x99, 0x6F, 0xB1, 0x20, 0x94, 0x02, 0xE6, 0xC2, 0xAA, 0xDE, 0xDA, 0xBC, 0x2B, 0x3D,
+    0x44, 0x09, 0xD7, 0x96, 0xCE, 0x3F, 0xD7, 0x25, 0xA6, 0x42, 0xE5, 0xD4, 0x05, 0x15, 0x71, 0x70,
+    0x73, 0x71, 0x88, 0x43, 0x3A, 0x78, 0xDF, 0xD0, 0xC1, 0xED, 0xC4, 0x6C, 0xE6, 0x1E, 0xDD, 0x77,
+    0x7B, 0xFF, 0xD3, 0x96, 0xBB, 0xB6, 0x27, 0x62, 0xA7, 0xEB, 0xA5, 0x8A, 0x6D, 0x19, 0xB1, 0x2D,
+    0xD3, 0x02, 0x0D, 0xB6, 0xE5, 0xC5, 0x02, 0x57, 0x2A, 0x08, 0xCE, 0x66, 0x62, 0x6E, 0x97, 0xF4,
+    0x09, 0x31, 0x91, 0x2B, 0x70, 0x0C, 0x03, 0x7D, 0x24, 0xB3, 0x4B, 0x7E, 0xC4, 0x4B, 0x09, 0x19,
+    0xB7, 0x24, 0x95, 0x92, 0x95, 0x63, 0x37, 0xEC, 0xF3, 0xA9, 0xF3, 0x42, 0x09, 0x37, 0xC9, 0x6F,
+    0x83, 0x22, 0x64, 0x6C, 0x8A, 0x82, 0x64, 0x23, 0xE6, 0x0E, 0x49, 0x4A, 0xAA, 0xA9, 0x32, 0xBA,
+    0x59, 0xB2, 0x76, 0xA9, 0x1C, 0xFD, 0x26, 0x66, 0x59, 0x88, 0x31, 0x3D, 0x2C, 0x91, 0x47, 0x11,
+    0x1C, 0x19, 0x80, 0x7A, 0x1A, 0x20, 0xE8, 0x38, 0x85, 0xFB, 0xAB, 0xAE, 0xA0, 0x51, 0xB0, 0x99,
+    0x02, 0xC4, 0xEA, 0xDB, 0x9C, 0xF0, 0xF9, 0x1E, 0xAA, 0xCC, 0xDF, 0x48, 0x23, 0x94, 0x25, 0xF5,
+    0xAA, 0x90, 0xF0, 0x9F, 0x94, 0x2D, 0x64, 0x02, 0xF7, 0x80, 0x51, 0xEB, 0xDA, 0x61, 0xCD, 0x6C,
+    0x8D, 0x99, 0x54, 0xFD, 0xC4, 0x36, 0xA9, 0xF3, 0x71, 0x16, 0x6D, 0x12, 0x27, 0x27, 0xA0, 0x08,
+    0xD2, 0x8D, 0x8A, 0xAC, 0x68, 0xD1, 0xB0, 0x2D, 0xD6, 0xE0, 0x16, 0xE1, 0x31, 0x3C, 0x42, 0x69,
+    0xE9, 0x9B, 0x2C, 0xE1, 0x55, 0x99, 0x8C, 0xAC, 0x0F, 0x57, 0x84, 0x93, 0x8E, 0x23, 0x3C, 0x4B,
+    0x37, 0xE8, 0x1C, 0x29, 0xEB, 0xEB, 0x8A, 0x0D, 0x48, 0xAD, 0x52, 0x34, 0x68, 0xF9, 0x30, 0x31,
+    0x49, 0xE7, 0xFF, 0x6B, 0xB3, 0x62, 0xFB, 0x39, 0x7E, 0xD0, 0x26, 0xA5, 0x4B, 0x03, 0xD1, 0xCE,
+    0xCA, 0xB0, 0x3A, 0x28, 0xBF, 0x2D, 0x90, 0x0C, 0x1D, 0xD6, 0x89, 0x81, 0x39, 0x2B, 0x3C, 0xE5,
+    0xCC, 0xF8, 0xEF, 0xF3, 0x3E, 0x3B, 0x4D, 0x69, 0xDB, 0x08, 0x49, 0x47, 0x2E, 0x9B, 0xBB, 0x9B,
+    0x94, 0xBF, 0xEB, 0xDC, 0x5B, 0x2A, 0xA4, 0xD6, 0xDB, 0x56, 0xD1, 0x0A, 0xA7, 0xBF, 0x5D, 0x0A,
+    0xF0, 0x75, 0x53, 0xB8, 0x92, 0x41, 0xDB, 0x39, 0x10, 0x26, 0xD2, 0xEB, 0x92, 0xC2, 0x7C, 0xC6,
+    0x5B, 0xAD, 0xCB, 0x30, 0x5D, 0xE2, 0x28, 0x55, 0xA6, 0x72, 0xD6, 0x5D, 0x47, 0xBC, 0xC2, 0x0A,
+    0x97, 0xA3, 0x5A, 0x25, 0x32, 0xCE, 0x4C, 0x4F, 0xEE, 0xA6, 0x7D, 0x76, 0xB3, 0xE1, 0xE1, 0x3A,
+    0x63, 0xAC, 0x31, 0x46, 0xE9, 0x27, 0x2A, 0x3D, 0x4D, 0x02, 0xF7, 0x9E, 0xE7, 0xAD, 0xB2, 0x8F,
+    0xB0, 0x55, 0xF6, 0x63, 0x38, 0x14, 0xDF, 0xA3, 0x3A, 0x21, 0x8D, 0x3A, 0x14, 0x3F, 0xAD, 0xF3,
+    0xBA, 0x35, 0xF7, 0xDF, 0x7B, 0xF8, 0x1B, 0x85, 0x95, 0xBF, 0x8E, 0xDD, 0x44, 0x14, 0xC6, 0x8F,
+    0x3D, 0x48, 0x46, 0x72, 0x31, 0xF4, 0x48, 0xEB, 0x27, 0x58, 0xDF, 0x17, 0xB0, 0xEF, 0x1D, 0x48,
+    0x41, 0x41, 0x11, 0x9A, 0xBC, 0x04, 0x0D, 0xED, 0x16, 0x56, 0xD6, 0x4A, 0x9E, 0x21, 0x75, 0xFA,
+    0x34, 0x34, 0x57, 0xC8, 0x48, 0xC0, 0x0E, 0x6C, 0x41, 0x89, 0xA9, 0x29, 0xE2, 0x8E, 0x22, 0x14,
+    0xA3, 0xC8, 0x52, 0x4C, 0xB8, 0x7B, 0x87, 0xDF, 0x19, 0x6F, 0x02, 0xFB, 0x07, 0xE1, 0x2B, 0x5B,
+    0xD7, 0x67, 0x66, 0xCE, 0xDF, 0xEF, 0xFB, 0x2C, 0xE7, 0x71, 0x2C, 0xE3, 0x41, 0x66, 0x11, 0x2B,
+    0x92, 0x05, 0x91, 0x5A, 0x24, 0x9F, 0x44, 0x5A, 0x11, 0xE3, 0x45, 0x3A, 0x91, 0xB2, 0x97, 0xEB,
+    0x65, 0x61, 0xB9, 0xBA, 0xB1, 0xCC, 0x6A, 0x8C, 0xFC, 0x8D, 0xD1, 0x73, 0x58, 0x17, 0xF6, 0xBA,
+    0xB7, 0xE1, 0xC7, 0x01, 0xF6, 0x16, 0x3D, 0xC7, 0xCD, 0xA8, 0x2B, 0x41, 0x57, 0x3A, 0x5D, 0xA9,
+    0x75, 0xC5, 0xAA, 0xE3, 0xB2, 0x37, 0xA3, 0x3A, 0x0A, 0x62, 0x26, 0x56, 0xF2, 0xC0, 0x8A, 0x8D,
+    0x31, 0x1E, 0xF0, 0x18, 0x8F, 0x9A, 0x4E, 0xD9, 0x0F, 0xF8, 0x1F, 0x5B, 0x8D, 0xAE, 0x29, 0x90,
+    0x50, 0x4A, 0xF9, 0xEA, 0x6E, 0xCA, 0xDB, 0x47, 0xCE, 0x60, 0x7F, 0xFC, 0xA2, 0xBF, 0x37, 0xE5,
+    0x5D, 0x0C, 0x46, 0x93, 0x3D, 0xE1, 0x57, 0x13, 0xD4, 0x3A, 0x16, 0x06, 0xE3, 0x2B, 0xC7, 0xC6,
+    0x60, 0x9D, 0xE4, 0x63, 0x67, 0x39, 0xD8, 0xD5, 0xFA, 0xB4, 0x0F, 0x3F, 0xA7, 0xBE, 0xEC, 0xCD,
+    0x6F, 0x5A, 0xE5, 0x79, 0xD4, 0xE7, 0xEE, 0x88, 0x33, 0xD9, 0xD6, 0x9A, 0xCB, 0xCE, 0x7E, 0x86,
+    0x69, 0x63, 0x3C, 0x61, 0xAA, 0x2C, 0x90, 0x41, 0xE5, 0xF0, 0x25, 0xD6, 0xB5, 0x44, 0xB6, 0xBD,
+    0x16, 0x6F, 0xBD, 0xF1, 0x94, 0xB7, 0x76, 0x69, 0x94, 0x18, 0xFB, 0x0F, 0xE4, 0x3B, 0xD1, 0x4A,
+    0x65, 0xAB, 0x35, 0xA5, 0x62, 0xBE, 0x92, 0xF2, 0xE8, 0xE4, 0xCB, 0x65, 0xCD, 0x51, 0x33, 0xD6,
+    0xC4, 0x49, 0x26, 0x7C, 0x24, 0x3F, 0x98, 0x63, 0xEC, 0x37, 0x71, 0x75, 0x71, 0x26, 0x85, 0x2F,
+    0xFB, 0x4C, 0x47, 0xB5, 0xF3, 0x56, 0xEC, 0x42, 0xBF, 0x5F, 0xB9, 0x5A, 0x3A, 0xDA, 0x6E, 0xAD,
+    0xB4, 0xE6, 0xD7, 0xC9, 0xF8, 0x81, 0xF7, 0xCA, 0x8C, 0xE5, 0x53, 0xDF, 0xC8, 0x3C, 0x17, 0xDE,
+    0xD6, 0x32, 0xC8, 0x1B, 0x2D, 0x35, 0x48, 0xC8, 0xAF, 0xF0, 0xBF, 0x73, 0x59, 0x20, 0x83, 0x5A,
+    0x5B, 0x73, 0x42, 0x24, 0x2D, 0xE3, 0x9C, 0x90, 0xF2, 0x45, 0x8A, 0xC2, 0xC0, 0xC8, 0x6A, 0x90,
+    0x8A, 0x33, 0xE6, 0x40, 0xF7, 0x62, 0x5F, 0x49, 0xBD, 0xCF, 0xA7, 0xE2, 0x17, 0xCE, 0x84, 0xC0,
+    0x24, 0x4E, 0xA4, 0x29, 0x9F, 0x4C, 0xC5, 0x8F, 0xA1, 0x95, 0xA1, 0xA1, 0x8D, 0x0F, 0x5D, 0x27,
+    0xAF, 0xA7, 0xB2, 0xB7, 0x9D, 0xCC, 0x59, 0x24, 0xC4, 0x66, 0x94, 0x60, 0x66, 0x1A, 0xB0, 0x4D,
+    0x35, 0x9D, 0x71, 0xB0, 0x96, 0x8D, 0x68, 0xBF, 0xE9, 0x36, 0x13, 0xA3, 0xBC, 0x81, 0xFB, 0x94,
+    0x3E, 0xDB, 0xE7, 0xC0, 0x43, 0xC1, 0xF3, 0x96, 0xDE, 0x0E, 0x74, 0xB6, 0x2D, 0xBD, 0x8E, 0x83,
+    0x9D, 0x35, 0x3B, 0x0B, 0x4F, 0x2E, 0x33, 0x68, 0xA3, 0x9B, 0xA9, 0x63, 0x74, 0x71, 0x92, 0x2A,
+    0x1E, 0x19, 0x16, 0xAF, 0x8A, 0xB3, 0xC2, 0xA7, 0x4D, 0x1D, 0xFE, 0x19, 0xBB, 0x82, 0x4C, 0xF7,
+    0xE6, 0x23, 0xC0, 0x68, 0xD2, 0x9C, 0xF3, 0x91, 0x14, 0x5A, 0x96, 0x13, 0xCE, 0x3A, 0xB2, 0x2A,
+    0x7B, 0x22, 0xCE, 0x36, 0xA4, 0x76, 0xEB, 0xF5, 0x98, 0x51, 0xFA, 0x0D, 0x81, 0x27, 0x8C, 0xE5,
+    0x62, 0xFE, 0x90, 0xE2, 0x2A, 0x7B, 0xE5, 0xCC, 0x4B, 0xF9, 0x76, 0xCC, 0x7E, 0xF7, 0xA7, 0x67,
+    0x14, 0x68, 0x4F, 0xE4, 0x6C, 0x6F, 0x2E, 0x7D, 0xD3, 0x66, 0x21, 0x9C, 0x5A, 0x6A, 0xB7, 0x85,
+    0x6F, 0x6D, 0xF9, 0xE9, 0x64, 0xF3, 0x4B, 0x3F, 0x1B, 0xFF, 0xCD, 0xD8, 0x64, 0x53, 0x35, 0x59,
+    0xD9, 0x17, 0xE4, 0xDD, 0xCA, 0xC2, 0x5C, 0x48, 0x61, 0x4E, 0xA3, 0xEB, 0x6B, 0x7A, 0x41, 0xCD,
+    0x7B, 0x92, 0xC0, 0x01, 0x91, 0x07, 0x32, 0x4F, 0xC6, 0x67, 0x8F, 0x66, 0x70, 0x79, 0xC8, 0xDE,
+    0xBE, 0xB8, 0x48, 0xC6, 0x56, 0x8D, 0xC0, 0x80, 0x9D, 0x4D, 0xA6, 0x84, 0x18, 0x48, 0xF8, 0x9D,
+    0x51, 0xAE, 0xE1, 0xE4, 0xC0, 0x64, 0xC8, 0x96, 0x6C, 0x61, 0x96, 0x1D, 0x2D, 0x6B, 0xF1, 0x5D,
+    0x6F, 0xA0, 0x02, 0xC8, 0x52, 0x80, 0xD6, 0x40, 0xAB, 0xE5, 0x6E, 0xB8, 0x3B, 0xEE, 0xA5, 0xA5,
+    0x9B, 0x5B, 0xB0, 0x57, 0xF5, 0x95, 0x2F, 0x8F, 0x51, 0xB2, 0x78, 0xED, 0xEB, 0x3C, 0x2A, 0xC6,
+    0xE2, 0x88, 0x83, 0x9B, 0x21, 0xE9, 0x9D, 0x1A, 0x03, 0xC6, 0xEE, 0x5F, 0x79, 0x60, 0x94, 0xF7,
+    0xC6, 0xFA, 0x86, 0x11, 0x67, 0x8B, 0xE4, 0x0C, 0xC7, 0x7E, 0xF2, 0x3D, 0x95, 0x83, 0xD0, 0x2C,
+    0x94, 0x7D, 0xE9, 0x75, 0xFE, 0xB3, 0x7A, 0x27, 0x78, 0x5C, 0xE4, 0xE2, 0xE8, 0x74, 0x94, 0xDA,
+    0xFC, 0x66, 0x25, 0xB0, 0xF2, 0xB5, 0x5D, 0xC9, 0xBA, 0x5E, 0x55, 0xEC, 0xE9, 0x89, 0xDB, 0xB9,
+    0x0F, 0x0D, 0xB6, 0xCD, 0xCA, 0x0A, 0xCA, 0x54, 0xE2, 0xE8, 0x5F, 0xD5, 0x9E, 0x6A, 0x55, 0x03,
+    0x3D, 0x9F, 0xDC, 0xA9, 0x09, 0x3F, 0xD5, 0x5F, 0x20, 0x20, 0xF1, 0x15, 0xC6, 0xC7, 0xE7, 0xE0,
+    0x45, 0x09, 0x97, 0x44, 0x49, 0x8F, 0x24, 0x39, 0xBA, 0xFB, 0x1E, 0x92, 0xAF, 0x7F, 0xDE, 0xA1,
+    0x01, 0x70, 0x4F, 0x74, 0xB6, 0xC8, 0x49, 0xE1, 0x61, 0xCD, 0x98, 0x9A, 0x63, 0xDD, 0xCC, 0x2C,
+    0x10, 0xA5, 0x4E, 0x35, 0xEE, 0x14, 0xDE, 0xBE, 0xD4, 0x2E, 0x3A, 0x5E, 0x88, 0x0E, 0x16, 0xD7,
+    0xF3, 0x38, 0x8C, 0xDC, 0xBB, 0x49, 0x6E, 0x5C, 0x5A, 0xA5, 0x06, 0xCB, 0x2E, 0xFE, 0x14, 0xB9,
+    0x40, 0x8E, 0xEC, 0x38, 0x9F, 0xCB, 0x62, 0xFC, 0xB6, 0x84, 0x1A, 0x5D, 0x4B, 0x16, 0x01, 0x42,
+    0x17, 0x3F, 0x2B, 0x67, 0x2B, 0x72, 0x1C, 0x88, 0x69, 0xFC, 0x52, 0xF6, 0xDB, 0xEC, 0xAA, 0xFD,
+    0x38, 0x64, 0xC8, 0x22, 0xA2, 0x81, 0x64, 0xA4, 0xFA, 0x69, 0x3F, 0x97, 0x4B, 0x9D, 0x2C, 0xFA,
+    0x7C, 0x4A, 0x73, 0x6A, 0x55, 0x2A, 0xD1, 0xD6, 0x27, 0xD3, 0x3A, 0x7F, 0xA3, 0x09, 0x56, 0x4A,
+    0x1E, 0x54, 0x06, 0xA0, 0x53, 0xE4, 0x81, 0x0C, 0x5E, 0xAB, 0x8C, 0xAB, 0x10, 0xF7, 0x01, 0xB5,
+    0x29, 0x95, 0xF7, 0x4A, 0x22, 0x33, 0xAE, 0xF2, 0x70, 0x26, 0xA5, 0xBB, 0x17, 0x02, 0xB7, 0x8C,
+    0x09, 0x02, 0xAE, 0xBD, 0x6B, 0xB4, 0x8E, 0xFE, 0x1F, 0x55, 0xCD, 0xDD, 0xF5, 0xC7, 0x22, 0xAC,
+    0x13, 0x63, 0x55, 0x09, 0x1A, 0x34, 0xBA, 0xF9, 0x69, 0xD2, 0xAA, 0x8B, 0x4B, 0x38, 0xDC, 0x88,
+    0x7D, 0x00, 0x45, 0xB7, 0x08, 0xEA, 0xF1, 0xEB, 0xA9, 0x40, 0xCA, 0xB3, 0x07, 0x63, 0x9A, 0x93,
+    0x76, 0x75, 0x48, 0xB2, 0xA8, 0x3E, 0xAC, 0x26, 0xD7, 0xA0, 0xE2, 0x43, 0x62, 0xF8, 0x8C, 0xCF,
+    0x16, 0xFB, 0x90, 0xC6, 0x33, 0x4B, 0x83, 0xE8, 0x60, 0x83, 0xF6, 0xD8, 0x8C, 0xEA, 0x00, 0xC8,
+    0xC3, 0x06, 0x29, 0xF5, 0x8D, 0x4F, 0x8E, 0x57, 0x2A, 0x16, 0xFA, 0x14, 0xB5, 0xE9, 0x97, 0x48,
+    0x85, 0x49, 0x6D, 0x75, 0xFA, 0x2E, 0x91, 0xB8, 0xA2, 0x4F, 0x9F, 0x92, 0xC4, 0xE3, 0xFE, 0x58,
+    0xFB, 0xF7, 0xB1, 0xA6, 0xFF, 0x8E, 0x95, 0x4D, 0xAA, 0x3C, 0xFF, 0x13, 0xEB, 0x90, 0x9E, 0x4B,
+    0x82, 0xC8, 0x3E, 0x3D, 0x57, 0x76, 0x26, 0x42, 0x64, 0x61, 0x77, 0x00, 0xD2, 0xB7, 0xB0, 0x5A,
+    0xAB, 0x0C, 0xF4, 0xFA, 0xC1, 0x0B, 0x95, 0x47, 0x7A, 0x21, 0x99, 0x75, 0xF6, 0x29, 0xB2, 0x18,
+    0xF2, 0xD0, 0xE5, 0xF3, 0x26, 0x2E, 0x36, 0xDE, 0x42, 0xDF, 0xDD, 0xEB, 0x6F, 0x8D, 0x55, 0xBF,
+    0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xF6, 0x28, 0x19, 0xC1, 0x14, 0x43, 0x41, 0x13, 0x8A, 0xF3, 0x1F,
+    0x80, 0xCE, 0xAE, 0x91, 0xD6, 0xEB, 0xE1, 0xAE, 0x48, 0xC9, 0x16, 0xC7, 0x8F, 0x2E, 0x14, 0x69,
+    0xA0, 0x49, 0x7B, 0x48, 0xE6, 0xD6, 0xB9, 0x94, 0x29, 0x92, 0x3F, 0x81, 0x22, 0x5D, 0x90, 0xAE,
+    0x39, 0x29, 0x46, 0xDA, 0xBB, 0x9D, 0x24, 0x05, 0x05, 0x05, 0xA3, 0x20, 0x6A, 0x2C, 0xA4, 0x34,
+    0xB9, 0x22, 0x73, 0xC8, 0x28, 0x7B, 0x27, 0xEF, 0x9A, 0x37, 0xEB, 0xBB, 0x04, 0x04, 0x08, 0xBC,
+    0xBB, 0xDE, 0xB5, 0x67, 0xE7, 0xFB, 0xDE, 0xF7, 0xBE, 0xF7, 0x3D, 0x63, 0x17, 0xD8, 0x40, 0x0D,
+    0xA4, 0x68, 0x81, 0x1C, 0x1E, 0x18, 0x45, 0xE1, 0x14, 0x37, 0x40, 0x19, 0x4E, 0xB5, 0xE8, 0xEF,
+    0xA3, 0x15, 0x7D, 0x07, 0x2F, 0xED, 0x5E, 0xE4, 0x55, 0x95, 0x44, 0x8D, 0x36, 0x7A, 0xAB, 0xD1,
+    0xD0, 0xC2, 0x69, 0x24, 0xC2, 0x26, 0x18, 0x4B, 0x9B, 0x46, 0x9D, 0xAA, 0x8A, 0xBE, 0xD5, 0xA6,
+    0xE8, 0x8D, 0x36, 0xD8, 0x0D, 0x41, 0xC1, 0x1F, 0xC2, 0x22, 0x84, 0xAC, 0x87, 0xEB, 0x95, 0x61,
+    0xAC, 0xC8, 0x27, 0xB6, 0x86, 0xCF, 0x91, 0x33, 0xC8, 0xB6, 0x15, 0x8F, 0x7D, 0xEC, 0xEB, 0xB8,
+    0x0D, 0xBB, 0x7B, 0xE6, 0xE4, 0xA1, 0xF8, 0xCD, 0x4B, 0x4C, 0x24, 0xB7, 0x0A, 0xC7, 0x1B, 0x16,
+    0x48, 0xB8, 0x50, 0x82, 0xD1, 0x44, 0xDF, 0x5B, 0xD5, 0xAF, 0x78, 0x49, 0xD4, 0x8C, 0x8F, 0x6C,
+    0xF8, 0xA9, 0x99, 0xAA, 0x8B, 0xB9, 0x28, 0xB9, 0xF5, 0xCD, 0x11, 0x35, 0x98, 0x2E, 0xA0, 0x2A,
+    0xCD, 0x2A, 0x72, 0x2C, 0x23, 0xD6, 0xA2, 0x6D, 0xD4, 0x4A, 0x5B, 0x42, 0x34, 0xA9, 0x68, 0x18,
+    0xBC, 0xD6, 0x0C, 0x2F, 0x9E, 0xCF, 0x80, 0x59, 0x80, 0x10, 0x37, 0x7B, 0x07, 0x06, 0x7A, 0xBF,
+    0xC9, 0xC9, 0x8A, 0x36, 0x2D, 0x73, 0x8E, 0x88, 0x42, 0x55, 0x5E, 0x57, 0x28, 0x25, 0x2B, 0xE6,
+    0x46, 0x14, 0x98, 0x32, 0xEB, 0xF4, 0xA5, 0x27, 0x84, 0x6C, 0xF9, 0x3A, 0xDB, 0x7C, 0x89, 0x90,
+    0xA9, 0x30, 0x25, 0x66, 0xC4, 0xDB, 0xB2, 0xF4, 0x76, 0xFD, 0xF2, 0x98, 0x91, 0x89, 0xE2, 0x93,
+    0x06, 0x21, 0x87, 0x7E, 0xE8, 0x30, 0xE6, 0xCE, 0x99, 0xB4, 0x81, 0x56, 0x72, 0x69, 0x74, 0x45,
+    0xF6, 0xA0, 0xB9, 0x8D, 0xA5, 0x5E, 0x8B, 0x30, 0x3F, 0x75, 0xC7, 0x37, 0xFC, 0xD7, 0xE8, 0xC6,
+    0x18, 0x27, 0xD0, 0x77, 0x2B, 0xF1, 0x93, 0x83, 0x6F, 0x51, 0xE6, 0x18, 0x6B, 0x93, 0x6D, 0x35,
+    0x89, 0x9B, 0x1E, 0x79, 0xD5, 0x8D, 0x5E, 0x97, 0x7A, 0xB5, 0x43, 0x42, 0x6E, 0xCE, 0x10, 0xB7,
+    0x6B, 0xAE, 0xC8, 0x7F, 0x74, 0x7A, 0x84, 0x74, 0xDE, 0x89, 0xA5, 0x74, 0x05, 0x52, 0xE9, 0x22,
+    0xCF, 0xF0, 0xAA, 0x8A, 0x9B, 0x43, 0xE4, 0xCA, 0x08, 0x36, 0xA2, 0x0E, 0x2D, 0xCC, 0x0E, 0x1C,
+    0xE6, 0xFE, 0x22, 0xCA, 0x7D, 0x64, 0xBD, 0xC9, 0x3E, 0xF5, 0x09, 0x46, 0x44, 0x25, 0xAD, 0xDE,
+    0x3F, 0x3F, 0xA8, 0xFA, 0xBE, 0xCA, 0xA3, 0x8E, 0xD7, 0xC2, 0x09, 0xC7, 0x4A, 0xF4, 0x49, 0x8B,
+    0xF9, 0xC0, 0xF3, 0x97, 0x86, 0x59, 0x3F, 0x48, 0xAA, 0x80, 0xBB, 0x26, 0x9D, 0xB2, 0x8B, 0x56,
+    0x26, 0xAB, 0x58, 0xB1, 0xB4, 0xBC, 0xF7, 0x4E, 0xF1, 0xD0, 0x16, 0xAB, 0x4B, 0x8C, 0xF3, 0x05,
+    0xD2, 0x83, 0x6A, 0xDD, 0xB0, 0x64, 0x68, 0x5F, 0x1B, 0x9F, 0xE5, 0xB2, 0xFF, 0x65, 0xBB, 0xC9,
+    0x9E, 0x35, 0xC2, 0x7B, 0x94, 0x35, 0x92, 0x1C, 0xEA, 0x9E, 0x61, 0xBD, 0x11, 0xEB, 0x6D, 0x33,
+    0x74, 0xE2, 0x9C, 0x94, 0x2E, 0x86, 0x08, 0xEF, 0x19, 0xD9, 0xDB, 0xE3, 0x1B, 0xD7, 0x6D, 0x3A,
+    0xC6, 0xEF, 0x5E, 0xFD, 0x70, 0xD2, 0x51, 0x73, 0x6D, 0xD0, 0x09, 0xEB, 0x1D, 0xD2, 0x0D, 0xFD,
+    0x88, 0xBE, 0xC1, 0x04, 0x37, 0xC5, 0x12, 0xAD, 0xEA, 0xA2, 0x0C, 0x3E, 0xDB, 0x81, 0xFE, 0xD0,
+    0x93, 0x2E, 0x75, 0x9B, 0xE5, 0x43, 0xEE, 0x3B, 0x56, 0xAC, 0x4E, 0x5E, 0x84, 0x73, 0x1F, 0xA4,
+    0xA7, 0xAF, 0x3F, 0xA5, 0xD8, 0x12, 0xB5, 0xCF, 0x73, 0xAA, 0xB6, 0xC2, 0x14, 0x68, 0xF6, 0xEC,
+    0x7D, 0xAF, 0xB1, 0xAA, 0x0A, 0xBB, 0x81, 0xC2, 0x5E, 0x74, 0xF9, 0x0B, 0xEA, 0xD3, 0x3C, 0x98,
+    0x72, 0x56, 0xC0, 0x32, 0x55, 0x95, 0x2D, 0xD0, 0xDB, 0x20, 0x53, 0x42, 0xC8, 0xA9, 0x97, 0xF3,
+    0xF9, 0xD6, 0x20, 0xC2, 0x2B, 0x88, 0xB6, 0x5D, 0xCC, 0x44, 0x6D, 0x89, 0x51, 0xCA, 0xD8, 0x46,
+    0xDD, 0xB1, 0x82, 0xD7, 0xBE, 0x44, 0x49, 0x11, 0x71, 0xA2, 0xF6, 0x2F, 0x1A, 0xB9, 0x1C, 0x1A,
+    0xF9, 0xF9, 0xDB, 0xD8, 0x94, 0x56, 0x9C, 0x58, 0xDC, 0xAA, 0x42, 0x2A, 0x83, 0x49, 0x8B, 0xC3,
+    0x11, 0x72, 0x6A, 0x40, 0x55, 0xF2, 0x89, 0x8B, 0x1B, 0x46, 0x1B, 0x61, 0x94, 0x84, 0x46, 0xEA,
+    0x27, 0x8D, 0x6C, 0x6A, 0xD9, 0x26, 0x2F, 0xCB, 0xB8, 0xFF, 0x68, 0x8D, 0xCD, 0x44, 0x26, 0xC7,
+    0x42, 0xD8, 0x14, 0x23, 0xF6, 0xE2, 0xB1, 0x47, 0x5D, 0x52, 0x72, 0x40, 0xEF, 0xA1, 0xB5, 0x89,
+    0x9A, 0x19, 0xD2, 0xD0, 0x43, 0x2E, 0x87, 0xA9, 0x56, 0x15, 0xA2, 0x8F, 0x77, 0x20, 0xFA, 0x25,
+    0xE4, 0xCF, 0x33, 0xE2, 0xE7, 0x9F, 0x39, 0xBE, 0x09, 0x3B, 0x19, 0x6C, 0x21, 0xB8, 0x42, 0x30,
+    0x85, 0x5D, 0xDA, 0x41, 0x2B, 0xD8, 0x0F, 0x61, 0x0B, 0xC7, 0x8F, 0x91, 0x6B, 0x2A, 0xA2, 0x09,
+    0xDF, 0x9A, 0xD3, 0x6A, 0x8B, 0x2A, 0x5A, 0xA1, 0x87, 0x3E, 0x94, 0xDF, 0xE2, 0x91, 0xDD, 0x3C,
+    0x14, 0x3F, 0xE2, 0xD4, 0xE5, 0xA5, 0x78, 0x7A, 0xFB, 0xD7, 0x46, 0x6B, 0xAD, 0xCC, 0xEE, 0xE8,
+    0x70, 0x14, 0xBB, 0x47, 0xD6, 0xEB, 0x68, 0x29, 0xAB, 0x91, 0x6C, 0x52, 0x8A, 0x88, 0x19, 0x42,
+    0x81, 0x39, 0x21, 0x91, 0x15, 0x16, 0x25, 0xAD, 0x0C, 0x9A, 0xD4, 0x7D, 0x6F, 0xFA, 0x9E, 0x0A,
+    0x24, 0xFF, 0x91, 0x4F, 0x07, 0xC4, 0xEB, 0x65, 0x2A, 0x86, 0x02, 0x55, 0xBD, 0x8B, 0xDB, 0x5B,
+    0xD4, 0xF8, 0x42, 0x9B, 0x50, 0x22, 0xA9, 0x24, 0x33, 0xA8, 0x73, 0x3A, 0x0A, 0x87, 0x84, 0x1B,
+    0xA2, 0x50, 0x1B, 0x35, 0x9A, 0x75, 0x43, 0xC7, 0xCC, 0x03, 0xFC, 0xD6, 0xDB, 0xF1, 0xF3, 0x85,
+    0x76, 0x99, 0x74, 0xEA, 0x89, 0x8F, 0x9B, 0xC5, 0x25, 0x8D, 0x92, 0xB4, 0x36, 0x71, 0xD3, 0x5E,
+    0x5E, 0x03, 0x93, 0x6B, 0x10, 0xDF, 0xB3, 0x9A, 0xAF, 0xA6, 0x61, 0x92, 0x23, 0xFE, 0x53, 0x11,
+    0xDF, 0x18, 0x01, 0x70, 0x29, 0x6C, 0x1C, 0x90, 0x19, 0xCE, 0xB7, 0x58, 0x48, 0xA7, 0xF7, 0x56,
+    0x28, 0xE7, 0x2E, 0xF8, 0xA5, 0x32, 0x6B, 0x45, 0x04, 0x27, 0x0D, 0xFC, 0xA4, 0x17, 0xE3, 0x34,
+    0xEF, 0xE2, 0xB3, 0xCF, 0xA4, 0x1D, 0xF4, 0x19, 0xEE, 0xE6, 0x97, 0xEF, 0xF1, 0xDA, 0xBD, 0xF4,
+    0x0B, 0x17, 0xF7, 0x6E, 0x8D, 0xF2, 0x66, 0xF4, 0x00, 0xA7, 0xFD, 0x1D, 0x0E, 0xDB, 0xF3, 0x57,
+    0xCF, 0x68, 0x54, 0x99, 0xCD, 0x89, 0xD6, 0xEA, 0x2D, 0x2F, 0x1A, 0x61, 0xE9, 0x22, 0xF4, 0x22,
+    0x96, 0xBD, 0x9B, 0xD0, 0xB9, 0x53, 0x59, 0xA9, 0xE0, 0xC5, 0xE4, 0xE6, 0xCD, 0x4A, 0x9D, 0x30,
+    0x01, 0x23, 0xBF, 0x4B, 0xE9, 0x6D, 0x50, 0x99, 0x81, 0x50, 0x70, 0xF3, 0xBA, 0x8B, 0xC1, 0xCC,
+    0x62, 0x47, 0x67, 0x20, 0x51, 0xD8, 0x20, 0x16, 0x79, 0x8F, 0x88, 0x5F, 0x51, 0x67, 0x41, 0xD9,
+    0xEC, 0x23, 0xE2, 0x60, 0x02, 0xF5, 0x60, 0xB5, 0x21, 0x0C, 0x6D, 0x8E, 0xDA, 0xE0, 0xF7, 0x30,
+    0xC0, 0x34, 0xCA, 0xB5, 0x11, 0xA7, 0x17, 0xAB, 0x2C, 0x36, 0x3A, 0x02, 0xA6, 0x6C, 0xC7, 0xD9,
+    0x79, 0x2B, 0x5D, 0x3B, 0xD3, 0xC6, 0xE7, 0x09, 0x5B, 0x96, 0xC6, 0x4D, 0x9A, 0xC7, 0x2E, 0xCD,
+    0x85, 0xCD, 0xF9, 0x29, 0x53, 0x69, 0x17, 0xFA, 0xEE, 0x1D, 0x2F, 0x69, 0xD0, 0x98, 0x9F, 0x0D,
+    0x61, 0x36, 0xFE, 0x1A, 0x6A, 0x9D, 0x74, 0x82, 0x89, 0xB0, 0xBA, 0x52, 0x55, 0x0D, 0x7A, 0x0F,
+    0x36, 0xCB, 0x01, 0x1C, 0x27, 0x5A, 0x10, 0x5B, 0xE6, 0x10, 0xBF, 0xA2, 0xAB, 0x90, 0xCA, 0x36,
+    0xF4, 0x60, 0x84, 0x05, 0xE1, 0xFE, 0xD3, 0x94, 0xB9, 0xBF, 0x4D, 0x59, 0x33, 0x3D, 0x3A, 0x56,
+    0xCB, 0x64, 0x78, 0x22, 0x0D, 0x4F, 0xA8, 0xAB, 0xDC, 0x7A, 0x45, 0x86, 0x67, 0x50, 0xE4, 0xEB,
+    0xC0, 0x0A, 0x9F, 0x49, 0xD9, 0xB6, 0x4B, 0xEC, 0xEA, 0xD8, 0xEB, 0x65, 0x8D, 0x9D, 0x7C, 0x5D,
+    0xB3, 0xBC, 0x7C, 0x8A, 0x5D, 0x09, 0xAF, 0xC0, 0xB7, 0xB4, 0xDC, 0x11, 0x37, 0xE4, 0x1B, 0x87,
+    0x29, 0x36, 0x39, 0x6A, 0x66, 0xF0, 0xC6, 0x3F, 0xAF, 0xB4, 0xA1, 0x13, 0x25, 0xDD, 0xC1, 0x14,
+    0x71, 0x93, 0x35, 0x85, 0xDD, 0x9B, 0xED, 0x7D, 0xD7, 0xA8, 0x4E, 0x2D, 0x0E, 0x07, 0x1F, 0xF9,
+    0xD7, 0x70, 0xF9, 0xFF, 0x0E, 0x77, 0x16, 0xC2, 0x15, 0xC1, 0x29, 0xC2, 0x83, 0x72, 0x2D, 0xBD,
+    0x81, 0x4B, 0xBC, 0x85, 0xFF, 0x38, 0xFE, 0x00, 0x4D, 0x55, 0x3D, 0x6F, 0xDB, 0x46, 0x18, 0x7E,
+    0xC8, 0xB3, 0xCB, 0x02, 0x04, 0x7A, 0x1E, 0xD2, 0xA5, 0x83, 0xB9, 0x16, 0x45, 0x4D, 0xAD, 0x1D,
+    0x8E, 0x16, 0x91, 0x0C, 0x5D, 0x3D, 0xC4, 0x6D, 0x81, 0x0C, 0x9E, 0x93, 0x5F, 0x20, 0x14, 0x4C,
+    0xC4, 0x24, 0x43, 0xC7, 0x24, 0x40, 0xBD, 0x77, 0x68, 0x87, 0x26, 0x40, 0x9D, 0x41, 0x03, 0x03,
+    0x28, 0xD6, 0x39, 0xFE, 0x03, 0x44, 0x8D, 0x20, 0x63, 0x59, 0x04, 0x41, 0x81, 0x64, 0xC8, 0xB5,
+    0x65, 0x50, 0x59, 0x91, 0x74, 0x7D, 0x5E, 0x4A, 0x41, 0x42, 0x5B, 0x82, 0x8E, 0xE2, 0xFB, 0xF5,
+    0x7C, 0xBC, 0xFA, 0xF4, 0x32, 0x7A, 0x0B, 0x6C, 0x1E, 0x00, 0xCA, 0x22, 0x70, 0xC0, 0xA3, 0xCB,
+    0xE8, 0xFB, 0x5A, 0x1F, 0x8E, 0x95, 0xD5, 0x37, 0x5D, 0xD8, 0x14, 0x68, 0x35, 0x8A, 0x70, 0x76,
+    0x2C, 0xCF, 0xF1, 0x0A, 0x72, 0x04, 0x17, 0x6B, 0x84, 0x0D, 0x9F, 0x6D, 0x0D, 0x60, 0x12, 0x20,
+    0x89, 0x0F, 0xF3, 0xF8, 0xB6, 0x9F, 0x87, 0xF5, 0xF9, 0x81, 0xE5, 0xCD, 0x96, 0x37, 0xB3, 0x24,
+    0xB2, 0x3A, 0x2E, 0x5D, 0x7C, 0x5A, 0xF7, 0x8E, 0x6A, 0x17, 0xFA, 0xDA, 0x48, 0x38, 0x36, 0x81,
+    0x0C, 0x70, 0x88, 0x2C, 0x52, 0xA9, 0xA6, 0xFC, 0x42, 0x1F, 0xCE, 0x0B, 0xBC, 0x69, 0xD4, 0x33,
+    0xAB, 0x0F, 0x50, 0xF4, 0x8F, 0xEA, 0x75, 0xA5, 0xAB, 0xEC, 0x04, 0xBF, 0x0C, 0xBB, 0x80, 0x8A,
+    0x15, 0xFB, 0xFE, 0xA6, 0x5F, 0xB2, 0xAA, 0xB4, 0x9A, 0xB2, 0xD9, 0xEF, 0x27, 0xB9, 0x77, 0x5D,
+    0xD2, 0x3D, 0x5C, 0x45, 0x5C, 0xF6, 0x96, 0xC8, 0xC2, 0xF6, 0x06, 0x5C, 0x82, 0x22, 0xB2, 0x2D,
+    0xDC, 0x76, 0x64, 0x55, 0x3D, 0x59, 0x42, 0x2B, 0xDF, 0xC2, 0x68, 0x55, 0x07, 0xAE, 0xD0, 0x79,
+    0x7C, 0xAB, 0xD9, 0xE1, 0x29, 0x2F, 0x54, 0x63, 0xB0, 0x9C, 0xB0, 0x97, 0x49, 0x83, 0xD5, 0xB5,
+    0xB9, 0x9F, 0x47, 0x7E, 0x1E, 0x9C, 0x5F, 0xB1, 0x19, 0x2A, 0x02, 0x90, 0x1B, 0x38, 0xD5, 0x24,
+    0xD0, 0xBE, 0xC1, 0x70, 0x01, 0x7D, 0xBB, 0x96, 0x98, 0x71, 0x64, 0x7B, 0xA8, 0xA2, 0x3A, 0xCE,
+    0x25, 0xA6, 0x15, 0xD8, 0x42, 0x22, 0x52, 0x4A, 0xCF, 0x3F, 0x63, 0x38, 0x8F, 0x5F, 0xB4, 0x45,
+    0xF8, 0xBC, 0xE1, 0x30, 0xE3, 0xE3, 0xC9, 0xA9, 0x6F, 0x75, 0x2E, 0x13, 0xC8, 0x73, 0x81, 0x9A,
+    0x8D, 0x89, 0xC4, 0xBA, 0xDA, 0x88, 0x48, 0x15, 0xD8, 0xDA, 0x92, 0xCF, 0x9F, 0xE5, 0x81, 0x77,
+    0x0C, 0x4C, 0x50, 0xED, 0xF2, 0x6E, 0xE8, 0x8E, 0x27, 0xD6, 0x2F, 0x18, 0xB4, 0xFE, 0x2F, 0x90,
+    0xF7, 0x1F, 0xD8, 0xD8, 0x77, 0x25, 0x0B, 0x08, 0x76, 0x43, 0x9F, 0x93, 0x29, 0xB6, 0xDF, 0x9D,
+    0x7B, 0x8D, 0x1E, 0x2E, 0xD5, 0x3C, 0x3E, 0x99, 0x73, 0x48, 0x14, 0x29, 0x52, 0x9D, 0xEB, 0x4B,
+    0x56, 0x9D, 0x38, 0xB8, 0x0A, 0x45, 0xC6, 0x33, 0xE4, 0xBC, 0x62, 0x79, 0x00, 0xEC, 0x92, 0x37,
+    0x04, 0xBE, 0x44, 0xBF, 0x5C, 0xB5, 0x33, 0x46, 0xD0, 0x20, 0x2A, 0xF1, 0x49, 0x77, 0xBA, 0x46,
+    0x24, 0x9C, 0xBA, 0x37, 0xED, 0xB2, 0x13, 0x7D, 0x87, 0xA1, 0x8D, 0xCE, 0xD1, 0x2B, 0x61, 0xBA,
+    0x5B, 0xAB, 0x86, 0xB4, 0xEF, 0x82, 0x3F, 0xBA, 0x8B, 0xC9, 0x22, 0x3C, 0xFF, 0x8E, 0xA4, 0x72,
+    0x58, 0x2A, 0xA2, 0xE7, 0x6D, 0xDF, 0x13, 0x44, 0x19, 0x9C, 0x85, 0x7A, 0x80, 0x7E, 0xD9, 0xAC,
+    0x27, 0xBF, 0x96, 0x6B, 0x6F, 0x17, 0x57, 0xD8, 0x49, 0xD2, 0x7D, 0x39, 0xCC, 0xA5, 0x85, 0xA4,
+    0x94, 0xA3, 0xD9, 0x0A, 0xDD, 0x6C, 0x72, 0x91, 0x74, 0xC9, 0xB5, 0x15, 0x36, 0xBA, 0xDC, 0x10,
+    0xCD, 0xA5, 0x68, 0x95, 0x4D, 0x30, 0xE0, 0x8D, 0xDC, 0x04, 0x2E, 0x2E, 0x33, 0x12, 0xC3, 0x51,
+    0x36, 0xF0, 0xAF, 0xBD, 0xDE, 0x6C, 0x6C, 0x75, 0x1A, 0xC8, 0xA0, 0x29, 0x0D, 0x8E, 0x57, 0x75,
+    0x1F, 0x23, 0xCB, 0x79, 0xDE, 0x7D, 0x94, 0x6C, 0x50, 0x8D, 0xB4, 0xB7, 0xF1, 0xA1, 0x0C, 0x57,
+    0x5D, 0x54, 0x50, 0x35, 0x1F, 0xE3, 0x50, 0x0C, 0x89, 0xF3, 0x0F, 0x15, 0x3A, 0x92, 0x47, 0x7A,
+    0x48, 0x5A, 0xF4, 0x89, 0x7D, 0xB0, 0x7F, 0x99, 0xC1, 0x1C, 0x0D, 0x88, 0x9E, 0x8E, 0x85, 0x7D,
+    0x02, 0xC6, 0xC8, 0x11, 0xBF, 0x72, 0x7A, 0x5F, 0x78, 0xA1, 0x44, 0x55, 0x9D, 0x7C, 0x33, 0x85,
+    0x09, 0x9B, 0xC8, 0x46, 0x65, 0x4A, 0xC0, 0x5A, 0xF9, 0x98, 0xB0, 0xD2, 0xB4, 0x5F, 0x53, 0x72,
+    0x8A, 0x12, 0xF6, 0x6B, 0xD4, 0x91, 0xD3, 0x51, 0x71, 0xCE, 0xE2, 0x46, 0x60, 0xA5, 0xE3, 0x58,
+    0x98, 0x5D, 0xA6, 0xD2, 0x84, 0xF7, 0x7E, 0xA1, 0x5E, 0x1E, 0xBD, 0x9C, 0x6B, 0x9E, 0xA7, 0x03,
+    0xB4, 0xC1, 0x3F, 0x8D, 0xAA, 0xE3, 0x3B, 0x79, 0x6C, 0x33, 0x03, 0xFD, 0xEA, 0x6F, 0x87, 0x64,
+    0xB9, 0xCE, 0xC3, 0xE0, 0xB8, 0x44, 0x44, 0xE8, 0x3C, 0x55, 0x42, 0x8E, 0xB7, 0x37, 0xF3, 0xF0,
+    0xCC, 0x23, 0x9B, 0x4D, 0xD5, 0x34, 0xB2, 0x37, 0x60, 0xD8, 0x8D, 0xAD, 0x50, 0x51, 0x17, 0xB9,
+    0x03, 0x95, 0xA6, 0xC3, 0x26, 0x70, 0x14, 0x86, 0xA2, 0x4B, 0x0C, 0xCC, 0x3A, 0xCF, 0xB4, 0x13,
+    0x97, 0x8C, 0x55, 0xAF, 0xFC, 0x1E, 0xE4, 0x19, 0xA6, 0xCA, 0x72, 0x8E, 0xD8, 0x46, 0x94, 0x53,
+    0x55, 0xD0, 0x0F, 0xEC, 0xCD, 0x41, 0xEB, 0x3C, 0x68, 0xC6, 0x4C, 0x50, 0xAB, 0x5A, 0xC6, 0x74,
+    0x91, 0x8D, 0xBB, 0xB1, 0x04, 0xEF, 0x4A, 0x70, 0x59, 0x27, 0xD9, 0xC3, 0x85, 0x0C, 0x3B, 0x14,
+    0xE0, 0xD7, 0x56, 0x3D, 0x61, 0xD1, 0x11, 0x2A, 0x83, 0x8C, 0x67, 0xB6, 0xF4, 0xA4, 0x51, 0xAE,
+    0x0A, 0xA6, 0x69, 0xB0, 0x88, 0xDE, 0xFE, 0x81, 0xC9, 0x99, 0xED, 0xBA, 0x08, 0xCA, 0xCF, 0x81,
+    0x87, 0xDB, 0xD4, 0xE8, 0x11, 0x0F, 0xC7, 0x6B, 0x7B, 0xB2, 0x9B, 0xA8, 0x94, 0xAE, 0x49, 0xB2,
+    0x61, 0xA7, 0xDC, 0x4C, 0x04, 0x9B, 0x40, 0x8D, 0x48, 0x22, 0x05, 0x8F, 0xE8, 0x07, 0x8A, 0xE2,
+    0x39, 0x6B, 0x66, 0xB4, 0xB4, 0x26, 0x08, 0x6A, 0xDA, 0x29, 0xBB, 0x9B, 0x49, 0x98, 0x16, 0x01,
+    0x40, 0xB3, 0x86, 0x50, 0xD8, 0x29, 0x9F, 0x49, 0x2F, 0xD5, 0x61, 0xED, 0xC4, 0x8B, 0x26, 0xE5,
+    0x2E, 0xE3, 0x2A, 0x23, 0x20, 0xB4, 0x4D, 0x67, 0xA3, 0x7E, 0x5C, 0x26, 0xB7, 0x9A, 0xA4, 0x1E,
+    0x3E, 0x76, 0xF1, 0xA2, 0xC3, 0x88, 0x7A, 0x20, 0x49, 0x62, 0x4A, 0x59, 0x7F, 0x02, 0x7A, 0xE5,
+    0x48, 0x16, 0xD7, 0x17, 0xEF, 0xE9, 0x44, 0xA4, 0x54, 0x10, 0xA2, 0x5C, 0xFD, 0xE9, 0x70, 0x5D,
+    0x46, 0x24, 0xDD, 0x63, 0x92, 0x4F, 0x90, 0x0A, 0xF8, 0x3C, 0xA1, 0x7C, 0x1F, 0x0B, 0xA0, 0x86,
+    0x2F, 0x7D, 0xF1, 0xF7, 0x26, 0x95, 0x5D, 0x49, 0x5C, 0xA7, 0x2E, 0xD1, 0x79, 0xF8, 0x5F, 0x99,
+    0x15, 0x88, 0xE6, 0x78, 0x4B, 0x2B, 0x35, 0xC1, 0x42, 0xBC, 0xA3, 0xDE, 0xAD, 0x27, 0x5C, 0x90,
+    0x3F, 0xD1, 0x89, 0x31, 0xB4, 0xF0, 0xA0, 0x20, 0xC8, 0xAD, 0xBC, 0xB1, 0xD5, 0x2A, 0xE4, 0x66,
+    0x92, 0xAC, 0x24, 0xBB, 0x34, 0xF1, 0x58, 0x23, 0xDB, 0xE6, 0x38, 0x3B, 0xC6, 0x14, 0xD8, 0x7E,
+    0xB8, 0x43, 0xB2, 0xEA, 0x84, 0x1A, 0x2F, 0x75, 0xD9, 0xB9, 0x9F, 0xFB, 0xF3, 0xE0, 0x30, 0xF7,
+    0xDE, 0x7D, 0x31, 0xFB, 0x79, 0x75, 0x86, 0xFE, 0x91, 0xAA, 0x6C, 0x83, 0xD9, 0xA4, 0xAC, 0x42,
+    0xCA, 0xC2, 0xAC, 0xF6, 0xC5, 0x89, 0x0B, 0x5D, 0x15, 0xB5, 0x7D, 0xAE, 0x31, 0x7F, 0x97, 0xF8,
+    0xFF, 0x0A, 0x84, 0xCF, 0x28, 0x30, 0xF5, 0xFA, 0xC0, 0x42, 0x84, 0x85, 0x88, 0xDA, 0x06, 0xA5,
+    0xC1, 0x86, 0xCB, 0xF8, 0x75, 0x4D, 0x79, 0xF9, 0xA9, 0x16, 0x6A, 0xA8, 0x30, 0x64, 0x29, 0xDF,
+    0x8C, 0x78, 0x90, 0x2B, 0x28, 0x7E, 0xC5, 0x6E, 0xDF, 0xEF, 0x3F, 0xB9, 0x34, 0x82, 0xC9, 0x94,
+    0xA6, 0x9B, 0x78, 0x2A, 0xA8, 0x5F, 0x7E, 0xAC, 0x6A, 0x21, 0xC7, 0xC8, 0x8E, 0x8A, 0x2C, 0x97,
+    0x03, 0xF7, 0x2C, 0xCF, 0xFA, 0x70, 0xB1, 0xBF, 0x27, 0x6E, 0xF0, 0xD0, 0xF7, 0x67, 0xF7, 0x7F,
+    0xA2, 0xD7, 0x84, 0x52, 0x79, 0x8A, 0x01, 0x10, 0x1A, 0x5A, 0x21, 0x46, 0x62, 0x0B, 0xDC, 0x10,
+    0x27, 0x84, 0x7E, 0x92, 0xB7, 0xB4, 0x83, 0x5B, 0x17, 0xDA, 0xE3, 0xDE, 0x49, 0xB9, 0xC4, 0x55,
+    0xDD, 0xBB, 0x57, 0x9A, 0xA8, 0x66, 0x7A, 0x4A, 0x63, 0xC0, 0xE0, 0x98, 0x26, 0x93, 0xDC, 0x96,
+    0x3F, 0x10, 0x10, 0x43, 0x20, 0x25, 0xBF, 0xF4, 0xB0, 0xA4, 0x5D, 0xFE, 0xA6, 0xEC, 0xFB, 0x8E,
+    0x95, 0x5D, 0x89, 0x87, 0x48, 0x62, 0x97, 0xAC, 0x3C, 0xE2, 0xCB, 0xB9, 0xEE, 0xC7, 0x30, 0x7A,
+    0x4A, 0x88, 0x69, 0xBE, 0xE4, 0x98, 0xCE, 0x37, 0x03, 0x54, 0x03, 0xFA, 0x61, 0x60, 0x54, 0x3D,
+    0xA2, 0xEF, 0x5C, 0x46, 0xCB, 0xA5, 0xBD, 0xA0, 0xD9, 0xE6, 0x52, 0x48, 0x84, 0x47, 0x92, 0xCB,
+    0xE5, 0xCB, 0x0A, 0x0E, 0xF1, 0x1D, 0x26, 0xE1, 0x7A, 0x39, 0xE2, 0xC6, 0x9D, 0xE2, 0xCD, 0x33,
+    0x9B, 0x7E, 0x69, 0xD4, 0xE9, 0xA9, 0xAD, 0x0C, 0x75, 0x71, 0xEB, 0xAC, 0x1E, 0xA5, 0x74, 0xB3,
+    0x16, 0x47, 0x2E, 0x48, 0x53, 0xD4, 0x72, 0xD4, 0xDD, 0x86, 0x5D, 0xFD, 0xC5, 0x8D, 0xA2, 0x35,
+    0xD9, 0xAF, 0x8C, 0x7A, 0xF1, 0xED, 0x53, 0xF2, 0xE3, 0x7D, 0xBD, 0xFB, 0xE0, 0xED, 0xEB, 0x9B,
+    0x4E, 0xEB, 0x24, 0x2E, 0xAB, 0xAF, 0x4C, 0xA6, 0x4E, 0x1A, 0xE7, 0x76, 0xE3, 0x4B, 0x67, 0x27,
+    0xCE, 0xE8, 0x03, 0x69, 0xA2, 0x1A, 0x47, 0xE5, 0xF0, 0xCC, 0x76, 0xD8, 0xF1, 0xFA, 0x1F, 0x8D,
+    0x55, 0x31, 0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xF6, 0x90, 0x0C, 0xCA, 0x44, 0x19, 0x0A, 0xD2, 0x10,
+    0x74, 0x43, 0x41, 0xBB, 0xF6, 0x1F, 0xB0, 0xF7, 0x9C, 0xA4, 0xA0, 0xA0, 0xC8, 0x81, 0x74, 0x34,
+    0x48, 0x50, 0xD3, 0x90, 0x86, 0xE2, 0x0A, 0x87, 0xB3, 0x44, 0x91, 0x12, 0x3A, 0xFE, 0x02, 0x12,
+    0xC5, 0x51, 0x5C, 0x61, 0x89, 0x23, 0x3B, 0x49, 0xCA, 0x14, 0x38, 0xA1, 0x44, 0x22, 0x03, 0xA7,
+    0xAB, 0x22, 0x71, 0x03, 0x99, 0x90, 0x25, 0xB7, 0xB7, 0xC3, 0x1B, 0xEF, 0x12, 0x92, 0x0E, 0xCB,
+    0xB3, 0x6B, 0x8F, 0xC7, 0xDF, 0xBC, 0xEF, 0xBD, 0xF7, 0x7D, 0xC6, 0x16, 0xB6, 0xD0, 0x63, 0x89,
+    0x1A, 0xBB, 0x9D, 0x46, 0xE5, 0xA5, 0x9D, 0x54, 0x99, 0xD3, 0x1A, 0xB3, 0x18, 0x87, 0xCD, 0x18,
+    0xE7, 0x5A, 0xDC, 0xFB, 0x48, 0xDE, 0x39, 0xBC, 0x7B, 0xC7, 0x79, 0xEF, 0x43, 0xA8, 0xAA, 0xAA,
+    0xDD, 0x50, 0xD7, 0x6A, 0x75, 0xC5, 0xA1, 0x8C, 0xD1, 0x23, 0xC6, 0x68, 0x73, 0x87, 0x1B, 0x10,
+    0x56, 0x0C, 0x50, 0x5D, 0x0D, 0x68, 0x5E, 0xA0, 0xE0, 0x05, 0x36, 0x1D, 0x60, 0x62, 0x40, 0xFE,
+    0xEC, 0xA9, 0x87, 0x51, 0x5F, 0x0C, 0x08, 0xB5, 0xEA, 0xA4, 0x0D, 0x1B, 0xA8, 0x85, 0x6D, 0x33,
+    0x6F, 0x32, 0xAF, 0x9B, 0x5E, 0xDA, 0x56, 0x0C, 0x46, 0x38, 0x02, 0x00, 0x2E, 0x6E, 0x6F, 0x43,
+    0x73, 0xF3, 0xFC, 0xE8, 0x43, 0x87, 0x4A, 0x38, 0x48, 0xBE, 0x86, 0xA7, 0x1C, 0xB3, 0x39, 0xF2,
+    0x93, 0x63, 0x9B, 0x11, 0x07, 0x42, 0xB5, 0x81, 0x76, 0x43, 0xDA, 0x4A, 0x75, 0xBE, 0xC8, 0x87,
+    0x4A, 0x83, 0x81, 0xE0, 0x4D, 0x8C, 0x41, 0x76, 0xC4, 0x6E, 0x8B, 0xCC, 0xE3, 0x73, 0x04, 0x31,
+    0x08, 0x27, 0xAC, 0xB4, 0x53, 0x18, 0xE8, 0xAB, 0x8E, 0xB9, 0x9A, 0x02, 0xE2, 0x68, 0x7B, 0xD7,
+    0xA7, 0x4D, 0xE2, 0x1C, 0xD3, 0x6F, 0x9F, 0x3D, 0x0B, 0x44, 0xF1, 0xCE, 0x1D, 0xA7, 0xBA, 0xDE,
+    0x48, 0x4B, 0x60, 0x3D, 0xA3, 0x15, 0x62, 0xA8, 0x84, 0xF5, 0xBC, 0x32, 0x8A, 0xF0, 0x6C, 0x5F,
+    0xE7, 0x4E, 0x8B, 0x07, 0x5E, 0x35, 0x4C, 0x6C, 0x6B, 0x7B, 0x7B, 0x3B, 0x77, 0x31, 0x2E, 0xC5,
+    0xF0, 0xC3, 0xF6, 0x5C, 0xD8, 0x2A, 0x77, 0xD2, 0x1A, 0x66, 0xD6, 0xA9, 0x4F, 0xA1, 0x38, 0xCF,
+    0xE0, 0x27, 0x27, 0x96, 0xEB, 0x1F, 0x38, 0xA6, 0x6D, 0x7D, 0x61, 0x18, 0xAB, 0xAE, 0x65, 0xE7,
+    0xAB, 0x56, 0x35, 0xA1, 0x0A, 0xAA, 0xD9, 0x47, 0x3A, 0x2E, 0x28, 0x8B, 0x49, 0x4F, 0xA6, 0x3A,
+    0x5C, 0x8A, 0x8D, 0x88, 0xB1, 0x51, 0xCD, 0x26, 0xE7, 0x5B, 0x0E, 0x0F, 0x48, 0x0B, 0x4A, 0x83,
+    0x4B, 0xC3, 0x98, 0xFC, 0x5E, 0x00, 0x32, 0x8E, 0x7C, 0xFD, 0xC4, 0x70, 0xD1, 0x9C, 0x7F, 0x43,
+    0x76, 0xFD, 0x14, 0xBB, 0xB1, 0x93, 0x47, 0x4D, 0x5A, 0x8D, 0x79, 0xD6, 0x64, 0x31, 0xBA, 0x6C,
+    0x16, 0xBB, 0x71, 0x93, 0x57, 0xF3, 0x0E, 0x7E, 0x01, 0x71, 0x0A, 0xAA, 0xCC, 0x85, 0x90, 0xEF,
+    0xF1, 0x35, 0xC5, 0x87, 0x7D, 0x0A, 0x92, 0x71, 0x59, 0xC9, 0x89, 0x24, 0x1B, 0x43, 0x66, 0x14,
+    0xED, 0x06, 0xB2, 0x59, 0xA7, 0xE2, 0x57, 0xE2, 0x09, 0x92, 0x26, 0x24, 0x6C, 0xD4, 0xF1, 0xE2,
+    0x07, 0x8D, 0xEC, 0x0A, 0xEC, 0x17, 0x89, 0x58, 0x9E, 0x5A, 0x58, 0x8D, 0xD6, 0xA0, 0xCD, 0x5D,
+    0x4F, 0x7A, 0xAE, 0x3A, 0xDD, 0x54, 0x3C, 0x33, 0x5F, 0x93, 0xD1, 0x6E, 0x4E, 0xE2, 0xB2, 0x50,
+    0xC8, 0x41, 0x2C, 0x97, 0xA7, 0xC8, 0x63, 0x42, 0x53, 0x36, 0x18, 0x77, 0x1D, 0x37, 0x83, 0x4E,
+    0x77, 0xD5, 0x88, 0x71, 0xB2, 0xBE, 0xAA, 0xD6, 0xC9, 0xF7, 0x38, 0x83, 0xF0, 0xBA, 0x6E, 0xFC,
+    0x24, 0x89, 0xA1, 0x33, 0x57, 0x98, 0xDC, 0x4D, 0xA8, 0x4A, 0x4D, 0x81, 0xAA, 0x4A, 0xA6, 0xD1,
+    0xF5, 0x89, 0xCC, 0x56, 0xE7, 0x6E, 0xAA, 0x95, 0x2D, 0x8F, 0x67, 0x90, 0x04, 0x39, 0x52, 0xF0,
+    0x72, 0x28, 0x20, 0x60, 0x75, 0x64, 0xD1, 0x21, 0xB1, 0x2C, 0x82, 0xF0, 0xC2, 0x63, 0x4A, 0x2A,
+    0x95, 0xE5, 0x43, 0xCF, 0x85, 0x55, 0x41, 0x44, 0xC9, 0x15, 0x77, 0x39, 0x3C, 0x39, 0x3E, 0x60,
+    0x84, 0x29, 0x31, 0x1A, 0x1A, 0x47, 0xDB, 0x03, 0xAE, 0xD4, 0x56, 0x0D, 0x59, 0x9C, 0xD1, 0xE8,
+    0x6B, 0x6A, 0xF1, 0x06, 0xA9, 0x0E, 0xEA, 0xE8, 0xC0, 0x34, 0x05, 0x3D, 0x56, 0xC1, 0xEC, 0xC6,
+    0x48, 0xFF, 0x05, 0x14, 0x01, 0x55, 0x8F, 0x9E, 0x26, 0x2F, 0xF7, 0x06, 0xB5, 0x4C, 0x6B, 0xF7,
+    0x91, 0x2D, 0x1D, 0xCC, 0xD3, 0x0E, 0xC1, 0x90, 0xFE, 0x8A, 0x08, 0x7D, 0xEE, 0x12, 0x87, 0x9A,
+    0x20, 0x6B, 0x52, 0xB2, 0x5F, 0x22, 0x77, 0x01, 0xF2, 0xA6, 0xC5, 0x06, 0xD3, 0xB8, 0x41, 0x10,
+    0x27, 0x0D, 0xC4, 0x82, 0xC0, 0xC8, 0x57, 0x32, 0xC6, 0x16, 0xCE, 0x4C, 0x60, 0xEE, 0x75, 0xFA,
+    0x32, 0xFD, 0x4A, 0x5F, 0x9A, 0x14, 0xC0, 0x27, 0xFC, 0x55, 0x0D, 0xFD, 0x31, 0xF2, 0x87, 0x0D,
+    0xBE, 0xB7, 0xF4, 0x04, 0xA4, 0x5F, 0x21, 0x6C, 0x99, 0x45, 0x20, 0x07, 0xCC, 0x28, 0x1B, 0x12,
+    0xEB, 0x50, 0x4C, 0xE9, 0x77, 0x52, 0xB1, 0x03, 0x7D, 0xD9, 0xA3, 0x67, 0xE5, 0x12, 0x42, 0x91,
+    0xD0, 0xC0, 0xAB, 0x8E, 0x14, 0x43, 0x5D, 0xF1, 0x28, 0x98, 0xF9, 0x4E, 0x8B, 0xEC, 0x90, 0xA1,
+    0x1E, 0x12, 0x00, 0x0D, 0xBB, 0x49, 0xD3, 0xD1, 0x44, 0x62, 0x15, 0xB9, 0x30, 0x10, 0x77, 0x07,
+    0xEC, 0x54, 0x50, 0x32, 0x09, 0x79, 0x06, 0x78, 0x7F, 0xC8, 0x16, 0x3D, 0x58, 0xDE, 0xAC, 0x69,
+    0xDA, 0x80, 0x31, 0x99, 0x9B, 0xB4, 0x69, 0xD9, 0x13, 0x8F, 0x49, 0x80, 0x3A, 0x40, 0x96, 0x6C,
+    0x88, 0xFF, 0x8E, 0xDD, 0xF9, 0xF8, 0xB7, 0x19, 0x47, 0x8D, 0xF4, 0xA0, 0x2D, 0xC6, 0x2D, 0xA6,
+    0xE9, 0xF6, 0x80, 0x66, 0x67, 0xCA, 0x84, 0xA2, 0x89, 0xEC, 0x3E, 0x37, 0xF6, 0x3B, 0x68, 0x93,
+    0x50, 0xD2, 0xEA, 0xAB, 0xCC, 0xC6, 0x57, 0xB9, 0x27, 0x53, 0xAC, 0x2F, 0x96, 0x2B, 0x17, 0x57,
+    0x89, 0x57, 0xEA, 0x3A, 0x78, 0xD2, 0x29, 0x87, 0x49, 0x91, 0xE2, 0x2C, 0xB2, 0x43, 0x4B, 0xA5,
+    0x4B, 0x6C, 0xF4, 0x48, 0x12, 0xE2, 0x98, 0xDB, 0x1E, 0x87, 0x91, 0x54, 0x16, 0x16, 0x16, 0x2B,
+    0x24, 0xA3, 0x1D, 0xE9, 0x91, 0x35, 0x71, 0xF5, 0x7A, 0x76, 0xA5, 0xF4, 0xEE, 0x6A, 0x56, 0xCC,
+    0x57, 0xAA, 0x33, 0xD9, 0x2D, 0x13, 0x1B, 0xCA, 0x46, 0xF1, 0x65, 0x27, 0x6F, 0x07, 0xE1, 0x5A,
+    0x84, 0x69, 0x42, 0xC2, 0x33, 0xF3, 0x95, 0x18, 0x5A, 0xDE, 0x0C, 0xBD, 0xEA, 0x68, 0x5C, 0x4D,
+    0x07, 0x4E, 0xF3, 0xDF, 0x58, 0x20, 0xC2, 0x6E, 0x54, 0x54, 0xBB, 0xCF, 0x1E, 0xB1, 0x11, 0x1A,
+    0x5C, 0x20, 0xAC, 0xBD, 0x21, 0xB1, 0x3A, 0x4B, 0x26, 0x1B, 0xF7, 0x58, 0x99, 0xD5, 0xAC, 0xF6,
+    0x1B, 0x15, 0xC3, 0xB8, 0xAB, 0x8C, 0x2B, 0xA6, 0x46, 0x40, 0xAF, 0x24, 0x68, 0x5C, 0x7F, 0xFD,
+    0x6F, 0xB0, 0x09, 0x3B, 0x9C, 0xDE, 0xB8, 0xC5, 0x3C, 0x14, 0x6D, 0xCA, 0x26, 0x4B, 0x06, 0xF8,
+    0xBA, 0xFA, 0xB2, 0x43, 0x4E, 0xF9, 0xD0, 0x33, 0xE2, 0x94, 0xB4, 0xE8, 0x6B, 0x0C, 0x42, 0x2D,
+    0x84, 0x9F, 0xB3, 0x91, 0x94, 0x0C, 0x2B, 0xFE, 0xFC, 0x75, 0xC1, 0x8E, 0xB0, 0x60, 0x79, 0x72,
+    0x8D, 0x61, 0xE4, 0x2C, 0x91, 0x70, 0xB6, 0x49, 0xF6, 0x31, 0xB1, 0x2B, 0x6F, 0xCD, 0x4D, 0x63,
+    0x74, 0x27, 0x7E, 0xB2, 0xF8, 0xCB, 0xA1, 0x26, 0x7F, 0x35, 0xE4, 0x8F, 0x0D, 0x53, 0x41, 0x68,
+    0xDF, 0x9E, 0x2B, 0xBE, 0x3A, 0x0B, 0x60, 0x9B, 0xC6, 0x6B, 0x23, 0x77, 0xDF, 0x8C, 0xD0, 0xE3,
+    0x56, 0xEA, 0x5F, 0x25, 0xE1, 0x65, 0xE6, 0x79, 0x79, 0x03, 0xDF, 0xA5, 0x9F, 0x73, 0xCF, 0x95,
+    0x57, 0xA7, 0x67, 0x97, 0xB4, 0xE1, 0xBC, 0x8C, 0x24, 0xB9, 0x7B, 0x6B, 0x3A, 0x66, 0xD9, 0xA6,
+    0xCE, 0x06, 0x9F, 0xD4, 0x17, 0xB7, 0x13, 0xE7, 0x2C, 0xED, 0x34, 0x3D, 0x1D, 0x95, 0x49, 0xD4,
+    0x8C, 0xDF, 0x11, 0xD4, 0x1A, 0x23, 0xCD, 0xE4, 0x29, 0x55, 0x70, 0xAA, 0x1F, 0x97, 0xBA, 0xBD,
+    0x1A, 0x4A, 0xBB, 0x09, 0x7D, 0x92, 0x3E, 0x4E, 0x6A, 0xA9, 0x97, 0x2F, 0x18, 0x8D, 0xD9, 0xE9,
+    0x3D, 0x87, 0xFC, 0x76, 0xB9, 0x66, 0x54, 0x24, 0x26, 0x3F, 0x4B, 0x1D, 0x12, 0xFF, 0x56, 0xF3,
+    0x27, 0x28, 0x17, 0xE5, 0x5C, 0x1D, 0x35, 0x5F, 0xDF, 0xE7, 0x5E, 0xAC, 0x69, 0xE4, 0x8F, 0x53,
+    0xAB, 0x25, 0xAD, 0xF9, 0xA3, 0xEE, 0x1C, 0xCB, 0x3A, 0xF3, 0xE2, 0x21, 0x9B, 0x60, 0xDB, 0xB3,
+    0xFF, 0xDD, 0xB4, 0x75, 0xEE, 0x37, 0xF7, 0xD8, 0xDE, 0xE2, 0xCF, 0x11, 0x2F, 0x1E, 0x72, 0x6C,
+    0x77, 0xE7, 0xCF, 0xBF, 0xF9, 0xD2, 0x2C, 0xAB, 0x8A, 0x8A, 0x58, 0xC2, 0x67, 0xA9, 0x52, 0xDA,
+    0xAA, 0xA5, 0xE9, 0xB2, 0x3F, 0x3C, 0xBD, 0xC6, 0x58, 0xEC, 0xED, 0x15, 0x3F, 0x53, 0x43, 0xCE,
+    0x6A, 0xDE, 0x6D, 0x58, 0x9B, 0xEC, 0xD8, 0xA4, 0xA3, 0x08, 0xE9, 0xD3, 0xF8, 0x98, 0xA3, 0x56,
+    0xEF, 0x76, 0x2C, 0xAF, 0x96, 0x9F, 0x29, 0x71, 0x68, 0x5B, 0xD6, 0xE9, 0x2F, 0xA9, 0xAE, 0x8C,
+    0x17, 0xC7, 0xC9, 0x16, 0x32, 0xA4, 0x82, 0x59, 0xFB, 0xF5, 0x7F, 0x1D, 0xFF, 0x00, 0x7D, 0x55,
+    0x3D, 0x8C, 0xDC, 0x44, 0x14, 0xFE, 0x6C, 0x5F, 0xE2, 0x4B, 0x0C, 0x9A, 0x13, 0x8A, 0x84, 0x08,
+    0xCA, 0x3A, 0x25, 0x12, 0xB9, 0x75, 0x93, 0x82, 0x62, 0x7C, 0x6B, 0x82, 0x94, 0x14, 0x29, 0x48,
+    0x41, 0xDA, 0x40, 0x41, 0x03, 0x42, 0x4A, 0x0A, 0x8A, 0x03, 0x39, 0x59, 0x23, 0x4A, 0x0A, 0xAE,
+    0x40, 0xA2, 0xA0, 0x20, 0x45, 0xAA, 0xA3, 0x49, 0xB1, 0xC5, 0x16, 0x9B, 0x5B, 0xEB, 0x52, 0x44,
+    0x82, 0x02, 0x03, 0x4A, 0x68, 0x5D, 0xA4, 0x22, 0x12, 0x99, 0x80, 0xA5, 0x2C, 0xA7, 0xCD, 0x0E,
+    0xDF, 0x9B, 0xD9, 0x4B, 0x72, 0xCD, 0xED, 0x9D, 0x3D, 0x9E, 0x9F, 0xF7, 0xBD, 0xBF, 0xEF, 0xBD,
+    0xC1, 0xF1, 0xED, 0x6D, 0x20, 0xF9, 0xF0, 0x0A, 0xB0, 0xB2, 0xB2, 0x02, 0xF7, 0x3B, 0x21, 0x7F,
+    0x1A, 0x25, 0xB4, 0xC6, 0x26, 0x36, 0x4B, 0x8C, 0xD1, 0xC9, 0xCB, 0xF0, 0x15, 0xB6, 0x1A, 0xB3,
+    0xA8, 0xD6, 0xD1, 0x2C, 0xAE, 0x74, 0x32, 0x51, 0xC8, 0x7B, 0xBA, 0x8F, 0x75, 0xAD, 0x4B, 0xF4,
+    0x6E, 0xAF, 0x1B, 0xA8, 0x26, 0x6D, 0xA0, 0x2A, 0x55, 0x79, 0xA8, 0xC4, 0x56, 0xA1, 0xB5, 0xD5,
+    0xA0, 0x5A, 0x0D, 0x0D, 0x90, 0x16, 0xC0, 0x0C, 0x88, 0x6B, 0x20, 0xE3, 0x66, 0x07, 0x44, 0x0D,
+    0xA0, 0xF8, 0xA9, 0x97, 0xD3, 0x96, 0x22, 0xDC, 0x55, 0x7C, 0x52, 0x5B, 0x40, 0xCD, 0x01, 0x11,
+    0x4C, 0x08, 0x97, 0xF3, 0x88, 0xF1, 0xC2, 0x29, 0x3F, 0x4F, 0x6E, 0xC5, 0xB6, 0xD9, 0x39, 0x4F,
+    0x80, 0x0D, 0x59, 0xE7, 0x72, 0x5F, 0x20, 0x38, 0xE7, 0x61, 0x1E, 0x18, 0xFC, 0x8D, 0x8C, 0xD3,
+    0x5A, 0xE0, 0x37, 0x11, 0xB6, 0x50, 0x85, 0xD3, 0xB2, 0x0A, 0x04, 0x2D, 0xB6, 0x34, 0xD4, 0x2F,
+    0x05, 0x32, 0x02, 0x0E, 0x0A, 0xC4, 0x54, 0x65, 0x26, 0x67, 0x7B, 0x88, 0x9F, 0xD6, 0x48, 0x68,
+    0x61, 0xDA, 0x22, 0x7A, 0xDC, 0x60, 0xF3, 0x94, 0x33, 0xEE, 0xA6, 0xF7, 0x05, 0xC1, 0x83, 0xED,
+    0x3B, 0x8B, 0xED, 0xF3, 0xEE, 0x3B, 0x9D, 0x4D, 0x1F, 0xFC, 0x5C, 0xAC, 0xAE, 0x4D, 0x6E, 0x9F,
+    0x5D, 0x3D, 0x91, 0x9F, 0x3A, 0xF3, 0x11, 0xB7, 0x17, 0xC5, 0x86, 0xFD, 0x01, 0xD7, 0xB9, 0xFB,
+    0xC6, 0xD2, 0xFB, 0xB9, 0x1F, 0x9B, 0xDB, 0x6E, 0x58, 0x09, 0xDC, 0x9B, 0xCF, 0x11, 0xBA, 0x48,
+    0x35, 0xD1, 0x02, 0xC1, 0x6F, 0x8C, 0xC0, 0xE8, 0x1A, 0x4E, 0x1C, 0xD9, 0xDF, 0x3F, 0xE4, 0x97,
+    0x1A, 0x79, 0xDB, 0xF7, 0xBE, 0x97, 0xE8, 0xAE, 0x7F, 0x76, 0x9A, 0xBE, 0x20, 0x44, 0x75, 0xB8,
+    0x50, 0xCC, 0x98, 0x06, 0x54, 0xF6, 0x88, 0x81, 0xFB, 0xD2, 0xE0, 0xAD, 0x63, 0xC0, 0xB1, 0xA8,
+    0x78, 0xB1, 0x1F, 0x76, 0x7E, 0xB4, 0x8D, 0x1B, 0x5E, 0x89, 0x0F, 0x8A, 0x1F, 0xF1, 0xC3, 0xAB,
+    0x7E, 0x38, 0xE3, 0x07, 0x09, 0x24, 0xAE, 0x91, 0x21, 0x90, 0xE0, 0x7E, 0x8C, 0xD8, 0xC7, 0x76,
+    0xEA, 0x52, 0x23, 0x80, 0x12, 0xB6, 0xC3, 0xED, 0x5A, 0x88, 0x09, 0x71, 0x93, 0x89, 0xD6, 0x78,
+    0x11, 0x6C, 0xC9, 0xDA, 0xC9, 0x43, 0x25, 0x42, 0x3E, 0x0C, 0x64, 0x5A, 0x39, 0xAA, 0xEC, 0x70,
+    0x56, 0x4A, 0x2A, 0xD7, 0xBD, 0x51, 0xDA, 0x9B, 0xA8, 0xFD, 0xD9, 0xCF, 0xFD, 0x70, 0x6D, 0x5F,
+    0x36, 0xAA, 0x69, 0xD1, 0x98, 0xCC, 0x50, 0x96, 0x61, 0xD8, 0xF6, 0xEE, 0xF7, 0x08, 0xC4, 0xA5,
+    0x67, 0x61, 0x03, 0x4B, 0x0A, 0x4D, 0x6B, 0x8D, 0xEB, 0x6D, 0x0A, 0xCD, 0x73, 0x79, 0x1E, 0x35,
+    0x7D, 0x05, 0x93, 0x92, 0xEA, 0x2A, 0x68, 0x7B, 0xAA, 0x18, 0x25, 0x17, 0xAB, 0x3C, 0xBA, 0x47,
+    0x9C, 0xA7, 0x75, 0x5C, 0x0F, 0x9B, 0xA0, 0x25, 0x49, 0x46, 0x49, 0x8B, 0xC1, 0x1F, 0x64, 0xBD,
+    0x24, 0x66, 0xB4, 0x54, 0x2F, 0x44, 0x15, 0x86, 0x1E, 0xA7, 0x16, 0x23, 0xA5, 0xD2, 0x24, 0xB6,
+    0xC5, 0x55, 0xF1, 0x30, 0x28, 0x70, 0xA9, 0xC3, 0x58, 0x23, 0x57, 0x50, 0x71, 0x1D, 0xEF, 0xB6,
+    0x41, 0xEB, 0xE7, 0x29, 0xD2, 0xB8, 0x52, 0xBB, 0x6D, 0xDC, 0x4E, 0xE2, 0x2E, 0x7D, 0x7C, 0x75,
+    0xD7, 0xBE, 0x6F, 0x9C, 0x1B, 0xDA, 0xD9, 0x49, 0xEB, 0x8F, 0x92, 0xA3, 0xE2, 0xEF, 0x9B, 0x7B,
+    0xD5, 0xC0, 0xD6, 0xAF, 0xDF, 0x17, 0xCA, 0x8B, 0x43, 0xDF, 0xD1, 0xA7, 0x56, 0xFD, 0x34, 0x4B,
+    0x31, 0xE9, 0x23, 0xCF, 0x91, 0x6B, 0xF9, 0x9F, 0x94, 0x47, 0xBB, 0xA9, 0x6D, 0xEC, 0x7F, 0x42,
+    0xFD, 0xA4, 0xA0, 0x51, 0xCA, 0x36, 0xD9, 0x5F, 0xCB, 0x22, 0x71, 0x55, 0x51, 0xBA, 0xAA, 0xB0,
+    0xED, 0xC0, 0x3E, 0x31, 0xF1, 0x9F, 0x75, 0x72, 0x05, 0x79, 0x19, 0x98, 0xC5, 0xB4, 0xB0, 0x8E,
+    0x11, 0xF6, 0x21, 0x4B, 0xD0, 0x84, 0x6D, 0x5A, 0xE5, 0x28, 0xA3, 0x3A, 0xAA, 0xD9, 0x0F, 0x92,
+    0x2A, 0xAE, 0xC7, 0x7A, 0xA6, 0xCE, 0x59, 0x58, 0x5B, 0xA7, 0xB6, 0x0B, 0xDB, 0xB8, 0xCE, 0x71,
+    0x9A, 0x80, 0x62, 0xA8, 0xD4, 0xE6, 0x18, 0x52, 0x69, 0xC0, 0xDA, 0x49, 0x84, 0xF7, 0x2C, 0xD4,
+    0x17, 0x43, 0x56, 0x98, 0x26, 0x01, 0x4D, 0x4C, 0x8C, 0x3E, 0x15, 0x77, 0x02, 0x17, 0x9A, 0x34,
+    0x50, 0xC5, 0x44, 0x97, 0xD1, 0x6C, 0xD8, 0xA8, 0x1B, 0x0B, 0xE8, 0xA1, 0x09, 0x4C, 0xD8, 0x24,
+    0x55, 0x54, 0x2D, 0x2B, 0x5D, 0x40, 0x7B, 0xBE, 0xF0, 0x7C, 0xF9, 0x7B, 0x2D, 0x6C, 0x27, 0x4E,
+    0xF1, 0xF3, 0xA5, 0xD2, 0xF7, 0x87, 0xCE, 0x2B, 0x36, 0x9E, 0x83, 0xED, 0x4B, 0x12, 0x07, 0xEC,
+    0x92, 0xFA, 0xCB, 0xDD, 0x6A, 0x89, 0xCB, 0xE3, 0xD0, 0x76, 0xD1, 0xFD, 0x4B, 0x3C, 0xC6, 0x23,
+    0x71, 0x25, 0x81, 0xE2, 0x21, 0xE5, 0x20, 0xFA, 0xFB, 0xE7, 0x24, 0xA7, 0x03, 0xDB, 0xC6, 0xF6,
+    0xD9, 0x3E, 0xC8, 0x01, 0x1D, 0x99, 0xAD, 0x23, 0x3B, 0x7F, 0x59, 0x87, 0x71, 0xF9, 0x0A, 0x8C,
+    0xC3, 0x90, 0x0E, 0x87, 0xCB, 0x1F, 0x90, 0x02, 0x1B, 0x97, 0xF7, 0xFB, 0xD4, 0xD1, 0xC5, 0xD6,
+    0xC0, 0x56, 0xCF, 0x53, 0xE0, 0x8A, 0x47, 0x18, 0x44, 0xD7, 0x86, 0xB6, 0xED, 0x3B, 0x14, 0xDA,
+    0x24, 0x08, 0x84, 0x5C, 0xE7, 0x7C, 0x51, 0x50, 0x47, 0x60, 0xD2, 0x7A, 0x8C, 0x59, 0x8E, 0x4C,
+    0x21, 0xBE, 0x5B, 0xE3, 0x89, 0x21, 0x57, 0x91, 0xE6, 0xD2, 0x32, 0xD9, 0x39, 0x03, 0x46, 0x60,
+    0x8E, 0x60, 0x1E, 0x3D, 0x9A, 0xC3, 0xCE, 0x3C, 0xEF, 0x0F, 0x28, 0x66, 0x30, 0x77, 0xDA, 0xC8,
+    0x76, 0xEA, 0x82, 0x29, 0xA3, 0xDF, 0xDB, 0xE4, 0xDB, 0xA2, 0xAF, 0x31, 0x36, 0xDE, 0x84, 0x52,
+    0x20, 0xB2, 0x80, 0xF1, 0x58, 0x2C, 0x4B, 0x9C, 0x3C, 0x62, 0x9B, 0x66, 0xBB, 0xE7, 0x76, 0xC9,
+    0xCD, 0xA4, 0x1E, 0xB3, 0x2F, 0x47, 0xCD, 0x28, 0x93, 0xA6, 0x6C, 0x26, 0xD2, 0xB2, 0xFF, 0x11,
+    0xB3, 0xEF, 0xB0, 0x6B, 0x4A, 0x88, 0x24, 0xBC, 0xD3, 0xC7, 0x52, 0xA9, 0xFF, 0xFE, 0xCA, 0xEF,
+    0xE4, 0xEE, 0x3D, 0xE9, 0xD5, 0x17, 0xBE, 0x66, 0x04, 0xAE, 0x27, 0xEF, 0xF2, 0xE4, 0x4C, 0x15,
+    0x24, 0x5F, 0xAB, 0xA8, 0x4C, 0x55, 0x29, 0x06, 0xCD, 0x80, 0x36, 0xA5, 0xB5, 0x2F, 0x50, 0xD7,
+    0xAB, 0x5C, 0xCF, 0x48, 0xDC, 0xDB, 0x67, 0xEB, 0x38, 0xC2, 0x9B, 0xB8, 0x14, 0xDC, 0x52, 0xBC,
+    0x74, 0x86, 0xED, 0x6B, 0xA6, 0x17, 0x3F, 0x24, 0xC2, 0x68, 0x43, 0xE0, 0x77, 0x25, 0x0F, 0x4A,
+    0xCE, 0xDD, 0xD8, 0xA1, 0x35, 0xBC, 0x68, 0x24, 0xF2, 0x17, 0x2F, 0x4A, 0xD2, 0x75, 0x2A, 0xB7,
+    0x09, 0x6F, 0x2C, 0x64, 0x51, 0xD5, 0xE1, 0xED, 0xAE, 0x17, 0xEE, 0x7D, 0x65, 0x31, 0x0A, 0xBD,
+    0x77, 0xDD, 0x0B, 0x9D, 0x0A, 0xBE, 0x8B, 0x09, 0xCF, 0xB6, 0x96, 0x97, 0x56, 0x23, 0xA9, 0x58,
+    0xC1, 0xC4, 0xDF, 0x48, 0x1B, 0x3E, 0x8B, 0xC4, 0xBA, 0x8A, 0x84, 0x7D, 0xEB, 0xD3, 0x99, 0x4F,
+    0xBE, 0xC2, 0x3E, 0xEB, 0x42, 0xB3, 0x86, 0x9D, 0x68, 0x61, 0xAB, 0x8C, 0xA2, 0x6C, 0x86, 0x78,
+    0xC7, 0xA3, 0x6F, 0xBA, 0x9E, 0xC8, 0xAA, 0x47, 0xF0, 0x89, 0x04, 0xE8, 0xD6, 0x10, 0x3E, 0xD7,
+    0x49, 0x95, 0xCD, 0xC0, 0x56, 0xC4, 0xCC, 0x29, 0x29, 0xCE, 0xC0, 0xEC, 0x4D, 0xCF, 0xB1, 0xEE,
+    0x4E, 0x39, 0x51, 0x66, 0xAB, 0x0A, 0xE7, 0x4E, 0xCE, 0x60, 0xCC, 0xB2, 0x60, 0x8E, 0x92, 0x3A,
+    0x6A, 0x32, 0x82, 0x4E, 0x10, 0xD3, 0xEF, 0xE4, 0x1B, 0xCA, 0xFE, 0x48, 0xDD, 0x13, 0xFF, 0x90,
+    0x04, 0xE8, 0xD3, 0xE5, 0x9C, 0x17, 0x2F, 0x1B, 0x0E, 0x34, 0x6F, 0xCD, 0x92, 0x99, 0x1B, 0x63,
+    0x58, 0x77, 0x18, 0x30, 0xA0, 0xA4, 0xB6, 0x33, 0x58, 0x2D, 0xBB, 0xD3, 0xF2, 0x8A, 0xFA, 0x1F,
+    0x65, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xE3, 0x21, 0x18, 0xC9, 0x12, 0x43, 0x41, 0x40,
+    0x80, 0xB8, 0x69, 0x28, 0xD2, 0xDC, 0xFA, 0x1F, 0xB0, 0x77, 0x0D, 0x91, 0xA8, 0xAF, 0x60, 0xE1,
+    0xCF, 0xA0, 0x4D, 0xE1, 0xCB, 0x59, 0x47, 0x41, 0x41, 0x91, 0xFC, 0x09, 0x57, 0x50, 0x44, 0x50,
+    0x44, 0x91, 0x28, 0x16, 0xB1, 0xB9, 0x1D, 0x92, 0x22, 0x05, 0x05, 0x43, 0x40, 0xA2, 0xB8, 0xC6,
+    0x12, 0xD0, 0x40, 0x91, 0x49, 0x62, 0x92, 0x45, 0xD9, 0xBB, 0xE1, 0x7D, 0xE3, 0xBB, 0x93, 0x0E,
+    0xAC, 0xF5, 0xEE, 0x7A, 0x7E, 0x7C, 0xDF, 0xFB, 0xDE, 0xF7, 0xE6, 0x19, 0x3B, 0x97, 0x9A, 0x89,
+    0x1A, 0xB4, 0xDF, 0x45, 0x65, 0x9B, 0xFC, 0x81, 0xC7, 0xB7, 0x03, 0x8A, 0xBB, 0x40, 0x74, 0x30,
+    0x35, 0xD4, 0xE3, 0x80, 0x49, 0xD1, 0x69, 0x5F, 0xA3, 0x52, 0x51, 0x3B, 0x13, 0x80, 0x09, 0xA0,
+    0x3D, 0x50, 0xF1, 0xC7, 0x01, 0xEF, 0x01, 0x01, 0x0B, 0x15, 0xB2, 0x90, 0xF5, 0x85, 0xD3, 0x0F,
+    0x6F, 0x43, 0xDF, 0xDF, 0x20, 0x7F, 0x10, 0x50, 0x7C, 0xE1, 0x50, 0x7C, 0x0A, 0x98, 0x15, 0xEF,
+    0x43, 0xC0, 0xD6, 0xDC, 0x5B, 0x02, 0xF5, 0xAC, 0x43, 0x35, 0xF3, 0xA8, 0xDE, 0x08, 0x68, 0xB1,
+    0xC6, 0x82, 0xDF, 0x03, 0x66, 0xC0, 0x8E, 0x6A, 0x26, 0xAF, 0xAD, 0xF5, 0xD1, 0x14, 0xD5, 0xAA,
+    0xC9, 0x7F, 0xFC, 0x2F, 0x94, 0xA7, 0x84, 0x32, 0xEB, 0xF4, 0xAF, 0x84, 0x72, 0x27, 0x10, 0x4A,
+    0x97, 0x12, 0xF7, 0x59, 0x78, 0xE7, 0x9F, 0xC2, 0x95, 0x27, 0x25, 0xDE, 0xFC, 0x65, 0x89, 0xFC,
+    0xDE, 0x98, 0xD8, 0x48, 0xE2, 0x25, 0xEF, 0xC5, 0x69, 0x62, 0xCB, 0xC4, 0xDC, 0x52, 0xE5, 0x0E,
+    0x55, 0x16, 0x52, 0xCA, 0x31, 0xF1, 0x14, 0xFC, 0x41, 0xD1, 0xA1, 0x88, 0x1E, 0xF1, 0x58, 0xCA,
+    0xC1, 0x16, 0x3E, 0xCA, 0x7A, 0xDB, 0xD4, 0xB9, 0xD7, 0xDF, 0x0F, 0x68, 0x77, 0x91, 0xDF, 0x68,
+    0xF0, 0x9D, 0x87, 0xD9, 0x00, 0x4F, 0x7B, 0x58, 0x8B, 0xAC, 0x5F, 0xA2, 0xD6, 0xBD, 0x76, 0x96,
+    0x44, 0x6C, 0xB0, 0xB7, 0x66, 0x69, 0x27, 0x2C, 0xC2, 0x34, 0x33, 0xD2, 0x32, 0x83, 0x0A, 0xAC,
+    0xF4, 0x5A, 0x39, 0x56, 0x2C, 0x60, 0xF4, 0x23, 0x40, 0xC5, 0x0E, 0x58, 0x30, 0x7E, 0x2D, 0x83,
+    0x57, 0x3D, 0x57, 0xB6, 0x5C, 0x49, 0x58, 0x0B, 0x02, 0xA9, 0x51, 0xC2, 0x40, 0xF7, 0xB8, 0x3C,
+    0xC7, 0xEB, 0xB3, 0x13, 0x35, 0x5C, 0xDE, 0xCD, 0xBD, 0x74, 0x05, 0x2D, 0x0B, 0xB8, 0x36, 0x40,
+    0x10, 0x08, 0x19, 0x78, 0xEA, 0x53, 0x63, 0xB2, 0x7E, 0x81, 0x8C, 0x9D, 0x11, 0x10, 0xDA, 0x15,
+    0x8E, 0xC8, 0x0D, 0x6B, 0xC9, 0xDD, 0x84, 0x53, 0xA6, 0xC1, 0xC0, 0xFE, 0x54, 0x4A, 0x06, 0x17,
+    0x32, 0x38, 0xFF, 0xB8, 0x37, 0x31, 0x0E, 0xFA, 0xCF, 0xAF, 0x96, 0x1C, 0xB4, 0x1C, 0x2C, 0xBA,
+    0x9A, 0x01, 0x0C, 0xCE, 0x57, 0xA6, 0xC1, 0x35, 0x23, 0x9E, 0x80, 0x00, 0x9B, 0xB1, 0xC3, 0x42,
+    0x08, 0xAE, 0xF1, 0x7E, 0x8B, 0x2D, 0xC2, 0x0E, 0xD5, 0xE0, 0x6A, 0xAE, 0x24, 0xF9, 0xB9, 0xD3,
+    0x7E, 0x8B, 0xE1, 0x57, 0x71, 0xA3, 0x63, 0x0C, 0x86, 0x01, 0x5B, 0xD4, 0x59, 0x8F, 0x60, 0x9A,
+    0xDC, 0x55, 0xB0, 0x3E, 0x60, 0xD5, 0x24, 0xA9, 0x30, 0x38, 0xF2, 0x2E, 0x89, 0x07, 0x07, 0x12,
+    0xD2, 0x44, 0xC6, 0xCC, 0x63, 0xC2, 0x2A, 0xA9, 0x06, 0xC9, 0x55, 0x21, 0x81, 0x10, 0xBC, 0x1D,
+    0xA6, 0xF3, 0x4F, 0x38, 0x43, 0xC4, 0x10, 0xC8, 0xE7, 0x33, 0xEC, 0x54, 0x2D, 0x02, 0x14, 0xD8,
+    0x17, 0xF7, 0x9C, 0xCD, 0x08, 0xCC, 0xB9, 0xE0, 0x8C, 0x24, 0xC7, 0xCE, 0x05, 0x29, 0x04, 0x2A,
+    0x04, 0xAB, 0x80, 0x85, 0xA0, 0x85, 0xC0, 0x25, 0x5D, 0xB5, 0x00, 0xE0, 0x53, 0x23, 0xCA, 0x90,
+    0x40, 0xB2, 0x9C, 0x3C, 0x47, 0x72, 0x60, 0x63, 0xEC, 0x65, 0x9A, 0xFC, 0x0B, 0xCD, 0xF2, 0x69,
+    0x45, 0x2E, 0xA2, 0x96, 0x8E, 0xE9, 0xF1, 0x8D, 0x44, 0x24, 0xFA, 0x17, 0xBF, 0x73, 0x9B, 0x8D,
+    0xBD, 0x08, 0xA3, 0xDC, 0x97, 0x0D, 0xBB, 0xB2, 0x41, 0xFF, 0x26, 0x1B, 0xCA, 0x8A, 0xE9, 0xD5,
+    0x73, 0xC7, 0xB8, 0x76, 0xC1, 0xD5, 0x59, 0x6C, 0xB8, 0x9A, 0xBA, 0x1B, 0x0F, 0x12, 0xB0, 0x94,
+    0x2F, 0x4B, 0x76, 0x90, 0x0B, 0x4D, 0x8F, 0xA8, 0x32, 0xEC, 0x1D, 0xE3, 0xF4, 0x9A, 0xCF, 0x77,
+    0xA8, 0xCD, 0x28, 0x84, 0xEC, 0x0A, 0xBA, 0x20, 0xC5, 0x38, 0x16, 0x63, 0x25, 0xFF, 0x61, 0xAF,
+    0xBD, 0x8E, 0x83, 0xA1, 0x9E, 0x42, 0x8B, 0x56, 0x3F, 0xEC, 0x79, 0x0E, 0x6F, 0x34, 0x45, 0x63,
+    0x2B, 0xA2, 0x68, 0xB9, 0x9C, 0xF8, 0xC7, 0x66, 0x4A, 0x1F, 0x90, 0x49, 0x37, 0xCB, 0x86, 0x5A,
+    0x24, 0xFC, 0xD4, 0xE7, 0xB3, 0x4B, 0xB1, 0x56, 0x1D, 0xD7, 0xD0, 0x32, 0x11, 0xD4, 0x4E, 0x16,
+    0x74, 0xA4, 0x32, 0x9E, 0xF7, 0x6D, 0x16, 0xDA, 0x29, 0x06, 0x63, 0x9A, 0x36, 0xBF, 0xEF, 0x27,
+    0x2A, 0x84, 0xA2, 0x5B, 0x56, 0xBA, 0x9F, 0x9A, 0x66, 0x6D, 0xAF, 0xF6, 0x13, 0xE3, 0x96, 0xF9,
+    0x0F, 0xCE, 0xB8, 0xE8, 0x55, 0x5C, 0x79, 0xC1, 0x4A, 0xD5, 0xD8, 0x30, 0x46, 0x7D, 0xBB, 0xC1,
+    0x2A, 0xE0, 0xF8, 0x25, 0xB4, 0xEA, 0xA0, 0xD6, 0xD1, 0x66, 0xCF, 0xFE, 0xEA, 0xC2, 0xF5, 0xBE,
+    0xB5, 0xC3, 0xA4, 0xB8, 0x5B, 0x7C, 0x76, 0xB4, 0xFF, 0xE4, 0xF1, 0x30, 0x0D, 0xE5, 0xED, 0x90,
+    0xC9, 0xB6, 0x97, 0x0F, 0xD2, 0xA6, 0x22, 0x76, 0x7C, 0xEC, 0x66, 0xDD, 0x2B, 0x02, 0x97, 0x27,
+    0x80, 0x36, 0xC1, 0xAA, 0x09, 0x1C, 0xD2, 0xF5, 0x44, 0x9B, 0x39, 0x2D, 0x48, 0x1E, 0x59, 0x21,
+    0xE5, 0x0F, 0x23, 0x79, 0x5F, 0xAC, 0xD9, 0x08, 0x9F, 0x94, 0x5B, 0x70, 0xFA, 0xDD, 0x51, 0xC0,
+    0xF4, 0x1C, 0xAA, 0x82, 0x70, 0x6E, 0xE6, 0xD1, 0x5F, 0xFF, 0x90, 0x01, 0xA6, 0x48, 0x4C, 0x8A,
+    0x22, 0x07, 0x09, 0xC8, 0x86, 0x92, 0xD0, 0xD9, 0xD7, 0x5D, 0x79, 0x8C, 0x57, 0x53, 0x68, 0x99,
+    0x56, 0x1B, 0xA8, 0x06, 0x7B, 0x31, 0xDE, 0x8E, 0xD1, 0x4B, 0xDA, 0x90, 0xEC, 0x62, 0x92, 0x18,
+    0xFD, 0xDF, 0xB3, 0x4B, 0x3A, 0x3F, 0x7D, 0x66, 0xD4, 0x4D, 0x82, 0x49, 0x2D, 0x4B, 0x0F, 0x08,
+    0xF4, 0x0A, 0x11, 0x34, 0xB7, 0xD4, 0x97, 0xB8, 0x13, 0xEF, 0x45, 0x57, 0xFF, 0xF1, 0xEC, 0xA7,
+    0xC1, 0xF8, 0xD2, 0xD5, 0x79, 0x5F, 0x78, 0xF3, 0x3E, 0x3D, 0x54, 0x7B, 0x71, 0x82, 0x40, 0x8B,
+    0x43, 0x6B, 0x88, 0x67, 0x92, 0xBB, 0xA2, 0x33, 0x1F, 0x48, 0x8F, 0xDD, 0x20, 0xBD, 0xAF, 0x38,
+    0x33, 0xBD, 0xC1, 0x99, 0x42, 0xBA, 0x9A, 0x94, 0x2A, 0xEA, 0x1C, 0xE9, 0x48, 0x14, 0x41, 0xDD,
+    0xE4, 0x51, 0xF8, 0xDC, 0x29, 0xAE, 0xAD, 0xB5, 0x2F, 0x3A, 0x36, 0x4C, 0x31, 0xA2, 0x61, 0x81,
+    0x7F, 0x87, 0x64, 0xA8, 0x7B, 0x1D, 0x1B, 0x9C, 0xF6, 0x09, 0x4B, 0xED, 0x78, 0x32, 0x17, 0xA3,
+    0x48, 0x82, 0xF0, 0x74, 0x69, 0x81, 0x7A, 0x81, 0x65, 0x8B, 0xD0, 0x66, 0x7D, 0xA5, 0x5D, 0x65,
+    0xBA, 0xCA, 0x62, 0xBB, 0xC6, 0x76, 0x8B, 0x2D, 0x0A, 0xBD, 0x17, 0xAA, 0x69, 0x5B, 0x4C, 0x6A,
+    0x53, 0xB1, 0xDB, 0x29, 0x5A, 0x25, 0xFF, 0xB3, 0xBE, 0x4D, 0xEE, 0x30, 0x48, 0x6E, 0x31, 0x04,
+    0x4B, 0x9A, 0x2A, 0xAE, 0x61, 0xF2, 0xEC, 0x51, 0x83, 0x7C, 0x3D, 0x36, 0x8A, 0xFC, 0xEF, 0xC5,
+    0x5E, 0x45, 0x1E, 0x86, 0xAD, 0xB1, 0x92, 0xB3, 0xAE, 0x5E, 0x22, 0x04, 0x02, 0xE0, 0x6E, 0xDA,
+    0x63, 0x10, 0x3B, 0x23, 0x04, 0xED, 0xD6, 0xF4, 0x42, 0xE8, 0x9F, 0xBD, 0x80, 0x50, 0x74, 0x53,
+    0xA2, 0x80, 0x10, 0xDC, 0x61, 0x16, 0x7D, 0xB6, 0xBA, 0x95, 0x48, 0xDE, 0x3E, 0x7F, 0x39, 0xF1,
+    0xCE, 0xBB, 0xAC, 0x4F, 0xE6, 0x40, 0x6C, 0xE2, 0xB2, 0xC5, 0x3E, 0xAB, 0xAB, 0xDA, 0xD1, 0x8C,
+    0xE9, 0x4E, 0x48, 0xBA, 0xC2, 0x4C, 0xA4, 0xC2, 0x48, 0xEA, 0x09, 0x47, 0x6A, 0x2B, 0x21, 0x09,
+    0x35, 0x24, 0x77, 0x68, 0x49, 0x8A, 0xDE, 0x50, 0x60, 0xA5, 0x3B, 0x75, 0xC1, 0xA2, 0x19, 0x45,
+    0x37, 0x32, 0x7E, 0x90, 0x3C, 0x51, 0xDE, 0x46, 0x3C, 0x13, 0x30, 0x6C, 0x00, 0xD1, 0x81, 0x6F,
+    0x37, 0x1C, 0x23, 0x91, 0x5C, 0x7A, 0x64, 0x3C, 0xFA, 0x56, 0x2C, 0xCE, 0xCA, 0xEB, 0x81, 0x75,
+    0x1C, 0x5E, 0xAC, 0x57, 0xEC, 0xF1, 0xA6, 0x68, 0x6C, 0xFF, 0x88, 0x6E, 0x57, 0x27, 0xAB, 0x49,
+    0x4E, 0x23, 0x46, 0x93, 0x7C, 0x66, 0xE0, 0x3A, 0xD3, 0x28, 0x39, 0xFB, 0x16, 0xE2, 0x31, 0xC9,
+    0x93, 0x2E, 0xAC, 0xCB, 0xC5, 0x5E, 0xC4, 0x5D, 0xE8, 0x98, 0x91, 0xEE, 0x15, 0xE5, 0xFC, 0x09,
+    0xB1, 0xE9, 0xF8, 0x8B, 0x44, 0x92, 0x97, 0x5F, 0xC1, 0xC5, 0xEB, 0x5F, 0xB5, 0x55, 0x31, 0x6C,
+    0x1C, 0x45, 0x14, 0x7D, 0xBB, 0x83, 0xBD, 0x12, 0x2B, 0x65, 0x52, 0x18, 0x09, 0x14, 0xC5, 0xDB,
+    0x46, 0x02, 0x6E, 0x5B, 0x8A, 0x5D, 0x7B, 0x93, 0x14, 0x69, 0x4F, 0x08, 0xD3, 0xBA, 0xA1, 0xA2,
+    0x71, 0x9B, 0x62, 0xED, 0x5B, 0x9C, 0x82, 0x22, 0x45, 0xA8, 0xA8, 0x5D, 0x50, 0x20, 0x28, 0xD2,
+    0xB8, 0x58, 0xD0, 0xC5, 0x37, 0xB2, 0x0B, 0xDA, 0x85, 0x08, 0x51, 0x32, 0x45, 0x68, 0xE2, 0x82,
+    0x11, 0x5A, 0xC1, 0x05, 0xDD, 0xDD, 0xF0, 0xFE, 0xDC, 0xD9, 0x96, 0x22, 0x1A, 0x02, 0x9C, 0xE5,
+    0xD1, 0xEE, 0xEC, 0xFC, 0x37, 0x6F, 0xFE, 0x7B, 0xFF, 0xCF, 0x1B, 0x3B, 0xC3, 0xF7, 0xBD, 0x3F,
+    0xFB, 0x71, 0x6F, 0x47, 0xA3, 0x46, 0x11, 0xDB, 0xC8, 0xE9, 0x2A, 0x6D, 0x0A, 0x94, 0x91, 0x83,
+    0x4B, 0x9A, 0xC4, 0x0C, 0xB0, 0x85, 0x3E, 0xEE, 0x63, 0x9B, 0x77, 0xC9, 0xF9, 0xCF, 0x36, 0x9D,
+    0x65, 0x06, 0xC8, 0x00, 0xB4, 0x80, 0xEA, 0x00, 0xCD, 0xC7, 0x5B, 0x48, 0x1A, 0xB8, 0x01, 0x12,
+    0xD3, 0x63, 0xA0, 0x0C, 0xFA, 0x8C, 0x9F, 0x5A, 0x68, 0x7E, 0xAF, 0x75, 0x15, 0xDB, 0x12, 0xBA,
+    0x9A, 0xAF, 0xCF, 0x22, 0xEF, 0x5D, 0x74, 0x72, 0x8F, 0xF1, 0x03, 0x06, 0xF5, 0x8C, 0x5F, 0x41,
+    0x4D, 0x0C, 0xE2, 0xC5, 0xD5, 0x94, 0x40, 0xDE, 0x07, 0xA2, 0xCF, 0xB0, 0x86, 0xB5, 0xC4, 0xA8,
+    0x53, 0xB2, 0x3A, 0x46, 0x5B, 0xA2, 0xD4, 0xC8, 0x55, 0x97, 0x9B, 0xC5, 0x89, 0xD3, 0xF3, 0x16,
+    0xC3, 0x32, 0xAC, 0x4D, 0x18, 0x3D, 0x27, 0x48, 0x25, 0xC1, 0xA4, 0x2D, 0xCC, 0xB8, 0xC1, 0xEB,
+    0x7F, 0x4B, 0x6A, 0x83, 0xA4, 0x5C, 0xAD, 0xEF, 0x1E, 0xDA, 0xF2, 0x26, 0x49, 0x7D, 0x1B, 0x48,
+    0x61, 0x42, 0x52, 0xEF, 0x0D, 0x10, 0x75, 0x3D, 0x52, 0x2E, 0xDD, 0x58, 0x9D, 0x2F, 0xB6, 0x2F,
+    0x31, 0x78, 0xA7, 0xD4, 0xD7, 0x72, 0xF5, 0x74, 0xD7, 0x2C, 0x16, 0x81, 0x41, 0x5D, 0xE2, 0x9A,
+    0x86, 0x62, 0xF4, 0x1D, 0x1B, 0x22, 0x5C, 0x38, 0x10, 0xE3, 0x50, 0x2E, 0xCF, 0x52, 0x03, 0xE9,
+    0x27, 0x5F, 0x62, 0xE2, 0x7B, 0xFD, 0x62, 0xD7, 0x38, 0x94, 0x64, 0x71, 0x6A, 0x51, 0x94, 0x48,
+    0xCE, 0x0C, 0xDA, 0x02, 0x9A, 0xC1, 0xAE, 0x45, 0xA6, 0x2B, 0x52, 0x97, 0xD5, 0x4D, 0xC8, 0x83,
+    0xE4, 0x80, 0x60, 0x9B, 0xEB, 0x4D, 0xFC, 0x93, 0xAF, 0xB6, 0x7E, 0x19, 0xAB, 0x5E, 0x99, 0x03,
+    0x14, 0xA9, 0x49, 0x4C, 0x8B, 0x56, 0x57, 0xBA, 0xA2, 0x40, 0x19, 0xB4, 0x48, 0x56, 0xCA, 0x01,
+    0x55, 0x57, 0xA0, 0xC0, 0xF2, 0x17, 0x79, 0x32, 0xF0, 0xDE, 0x60, 0x54, 0x1D, 0x40, 0x37, 0xB1,
+    0x53, 0x0E, 0xD9, 0xAD, 0x1A, 0xF1, 0x1F, 0x8F, 0x1A, 0x3C, 0xB9, 0xDF, 0x47, 0x93, 0x4F, 0xBD,
+    0xF7, 0x5D, 0xE6, 0xFF, 0xAC, 0x82, 0x16, 0x42, 0x18, 0xB9, 0x04, 0x72, 0x4F, 0x8A, 0xC5, 0xE1,
+    0x09, 0xDE, 0x84, 0xF2, 0x54, 0x26, 0xF5, 0xCF, 0x56, 0xA8, 0x1F, 0x57, 0xD0, 0xBE, 0xC1, 0x3C,
+    0x47, 0x6A, 0xCA, 0xA2, 0x80, 0xFB, 0xCD, 0x66, 0x0F, 0x7E, 0xFD, 0x7A, 0x9A, 0xF8, 0x85, 0x90,
+    0x17, 0x21, 0x02, 0xEF, 0x2D, 0x5C, 0xC7, 0xE8, 0x71, 0x83, 0xD1, 0x0B, 0x5C, 0xFD, 0xFE, 0x73,
+    0x4A, 0xBA, 0x59, 0x3A, 0x26, 0x6C, 0x19, 0x16, 0xBD, 0xF5, 0xAA, 0x24, 0xCB, 0x25, 0x40, 0xB2,
+    0x72, 0xE6, 0x17, 0x62, 0xC9, 0x3E, 0x22, 0x8A, 0x93, 0xB9, 0x81, 0x6C, 0x43, 0x2D, 0x33, 0x71,
+    0x25, 0x69, 0x91, 0x4B, 0x21, 0xEB, 0xA9, 0x54, 0x29, 0x22, 0xDD, 0x78, 0x16, 0x79, 0xD9, 0x3E,
+    0xB2, 0xEF, 0x0A, 0x81, 0x52, 0xCC, 0x83, 0xC4, 0x87, 0x53, 0x6F, 0x5C, 0x9E, 0x9F, 0xB5, 0xD4,
+    0x30, 0xC2, 0xA9, 0x2E, 0x40, 0xBA, 0xA4, 0x23, 0x66, 0x21, 0x15, 0x74, 0x9C, 0x29, 0x9E, 0x35,
+    0x4B, 0x1F, 0x70, 0x54, 0x4F, 0x7F, 0x10, 0xA8, 0xFD, 0xDF, 0x65, 0xCC, 0x02, 0xAC, 0xF6, 0x63,
+    0x19, 0x1F, 0x3E, 0x62, 0x0A, 0xF4, 0xD9, 0xF7, 0x9C, 0x4A, 0x0D, 0x15, 0x27, 0xB3, 0x9A, 0x78,
+    0x49, 0x47, 0x2C, 0x1A, 0x5B, 0x57, 0x25, 0x94, 0x55, 0x74, 0x07, 0xF3, 0xEA, 0x42, 0x5E, 0xD6,
+    0x71, 0xC4, 0x31, 0xAD, 0x04, 0x44, 0x9D, 0x1B, 0x61, 0x78, 0x72, 0xA9, 0xC6, 0x11, 0x86, 0xF8,
+    0x48, 0xCD, 0xD1, 0xA7, 0xB3, 0x28, 0x87, 0xCB, 0x3F, 0x80, 0xBE, 0xED, 0x0A, 0x31, 0xAB, 0x3D,
+    0x26, 0xF6, 0x61, 0x27, 0xFB, 0x9C, 0x3F, 0x97, 0xD1, 0x8B, 0x72, 0xFA, 0xDE, 0x59, 0x27, 0x24,
+    0x0F, 0x39, 0x0E, 0x52, 0x71, 0x7B, 0xAD, 0x99, 0x83, 0xB7, 0x9D, 0xC6, 0xA2, 0xD9, 0x36, 0x9B,
+    0xD8, 0x36, 0x2B, 0x68, 0x87, 0x36, 0x72, 0xB1, 0x8B, 0x6D, 0x4A, 0x4B, 0xE6, 0x3C, 0xE4, 0x18,
+    0xC9, 0x29, 0xB3, 0xF5, 0x90, 0xBA, 0xED, 0x11, 0xE8, 0x44, 0x04, 0xEA, 0x91, 0x7D, 0x3E, 0x67,
+    0x1A, 0x72, 0x48, 0x6F, 0x28, 0x20, 0x2D, 0x27, 0x35, 0x35, 0xFF, 0x5B, 0x3E, 0xF7, 0x41, 0x5C,
+    0xD1, 0x5C, 0x0C, 0xB0, 0x4F, 0x33, 0xCC, 0x90, 0x4D, 0x2C, 0x13, 0x52, 0x2D, 0xF7, 0x18, 0xAE,
+    0x55, 0x83, 0xA8, 0x57, 0xDD, 0x3E, 0x8A, 0xAC, 0x4A, 0xBE, 0xEB, 0xF0, 0x0D, 0x0B, 0x97, 0x87,
+    0xF3, 0x73, 0xE8, 0x3B, 0x7D, 0xE4, 0x52, 0xB6, 0x2D, 0xE6, 0x56, 0x4A, 0xA2, 0x64, 0x65, 0xAC,
+    0xEA, 0xD0, 0x88, 0x90, 0xD5, 0x88, 0xDB, 0x1B, 0x4C, 0xEC, 0x8A, 0xEE, 0x84, 0x2F, 0xDA, 0xCF,
+    0xC8, 0x3B, 0x15, 0x89, 0x5B, 0xC4, 0x5D, 0x10, 0x58, 0xA4, 0xA7, 0x92, 0x3C, 0x0B, 0x89, 0xD0,
+    0x02, 0x14, 0x8E, 0x9F, 0x0B, 0x26, 0x99, 0xFA, 0x15, 0x5C, 0x97, 0x18, 0xA6, 0xBF, 0xE7, 0x5F,
+    0x4E, 0x3F, 0x3D, 0xEE, 0x22, 0xAF, 0xF9, 0x68, 0xAF, 0x23, 0x14, 0xA1, 0x54, 0xB1, 0xD4, 0x2F,
+    0x6D, 0x46, 0xF6, 0xF2, 0xB2, 0x3E, 0x44, 0xCC, 0x44, 0xE6, 0xBB, 0x74, 0xA1, 0x9C, 0xD7, 0xA1,
+    0x48, 0x4C, 0x64, 0x07, 0x44, 0xEF, 0xC9, 0xD5, 0xC4, 0x56, 0x43, 0x7A, 0x70, 0x1B, 0xDB, 0x6D,
+    0xA3, 0xFB, 0x79, 0x48, 0xE8, 0xCD, 0x25, 0x0A, 0x1B, 0x59, 0x40, 0x3D, 0x92, 0x37, 0x59, 0x24,
+    0x6D, 0x99, 0x01, 0x15, 0xD8, 0x14, 0x50, 0x08, 0xC5, 0x40, 0x68, 0xB0, 0xF3, 0xA1, 0xD5, 0xDE,
+    0xF7, 0xEA, 0xF9, 0x57, 0x63, 0x4E, 0xCA, 0x69, 0xD2, 0xA6, 0x94, 0x95, 0xB8, 0x5C, 0x79, 0x31,
+    0x29, 0xCE, 0x0B, 0x0C, 0xC7, 0xCB, 0x14, 0xE3, 0x80, 0xFC, 0xD8, 0x84, 0x47, 0xF3, 0x0B, 0x8F,
+    0x0C, 0x31, 0x4C, 0x1B, 0x65, 0x4A, 0x86, 0x50, 0x53, 0x1A, 0xAB, 0xDB, 0xE4, 0x3E, 0x13, 0x3F,
+    0x53, 0x6C, 0x99, 0x9A, 0x20, 0x35, 0x4A, 0x96, 0x03, 0x2F, 0x8C, 0xC4, 0x14, 0xD8, 0x94, 0x45,
+    0x57, 0x57, 0x42, 0x8B, 0xD7, 0x98, 0xCF, 0x6D, 0x82, 0xF9, 0xEE, 0xC2, 0x17, 0xAF, 0xC0, 0xBC,
+    0x7B, 0x99, 0xF9, 0x8C, 0xCC, 0xE7, 0xAB, 0xA2, 0x4F, 0xAB, 0x65, 0xCD, 0x4A, 0xF9, 0xD0, 0xD0,
+    0xFF, 0x90, 0x70, 0x66, 0x9D, 0xDC, 0x19, 0x92, 0xD8, 0xA8, 0xBB, 0xBC, 0x74, 0xA8, 0xD5, 0xBF,
+    0xBA, 0xCB, 0xD2, 0x29, 0xB0, 0x6D, 0x43, 0x66, 0x65, 0x66, 0x73, 0x75, 0x91, 0x34, 0xD2, 0x0A,
+    0xD6, 0xD8, 0xA7, 0x69, 0x48, 0xB6, 0xE9, 0x1A, 0xE3, 0x16, 0xD3, 0xB1, 0x9A, 0x1E, 0xEC, 0xF5,
+    0xF9, 0xD4, 0x45, 0xB7, 0x9D, 0x34, 0x16, 0x6E, 0x91, 0x1B, 0xD1, 0xBD, 0x08, 0x7E, 0x6D, 0x03,
+    0xEE, 0x11, 0xFE, 0xCF, 0xDF, 0x5F, 0xAD, 0x55, 0xBF, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBB, 0xC5,
+    0x5E, 0xE4, 0x93, 0xD8, 0x14, 0x08, 0x09, 0x21, 0xBC, 0x0D, 0x15, 0xE0, 0xBB, 0x7F, 0xE0, 0xCE,
+    0xEF, 0x92, 0x86, 0x22, 0x85, 0x5D, 0x60, 0x0A, 0x0A, 0xA0, 0xA0, 0x8A, 0x22, 0xA5, 0xA1, 0x78,
+    0xC5, 0xC5, 0xDE, 0xD8, 0x45, 0x0A, 0x24, 0x12, 0x0A, 0xA8, 0x29, 0x52, 0x99, 0x22, 0x08, 0x3D,
+    0xA4, 0x93, 0x70, 0xF2, 0x36, 0xF1, 0x1F, 0x90, 0x0B, 0x20, 0xA5, 0x40, 0x88, 0xE5, 0x87, 0x84,
+    0x14, 0x17, 0x59, 0x91, 0x23, 0x7A, 0x89, 0xDE, 0x7B, 0xCB, 0x37, 0x77, 0x76, 0xEC, 0x94, 0x91,
+    0xB2, 0xD2, 0x8D, 0x7D, 0x7B, 0xBB, 0x33, 0xDF, 0x7C, 0xF3, 0xCD, 0xBC, 0x68, 0x4A, 0xB4, 0x45,
+    0x63, 0xA2, 0x81, 0xCD, 0x2C, 0x65, 0x4E, 0x8D, 0x48, 0x8D, 0xC4, 0x6F, 0x94, 0x54, 0xD1, 0x3F,
+    0x46, 0xDC, 0xA1, 0xDA, 0x89, 0x7B, 0xB6, 0xC8, 0xA3, 0x3F, 0x9D, 0x52, 0xE4, 0x5B, 0xB1, 0x6F,
+    0x87, 0x79, 0xE4, 0xBE, 0xCB, 0x35, 0x8D, 0x56, 0x52, 0x69, 0x0A, 0xB9, 0x16, 0x3B, 0x15, 0x1D,
+    0x94, 0xAD, 0xB4, 0x5B, 0x16, 0x5F, 0x54, 0x83, 0x2F, 0xC2, 0x27, 0xD3, 0x9C, 0x7C, 0x3C, 0x23,
+    0x2C, 0xC5, 0x26, 0x29, 0x61, 0xA4, 0x85, 0x11, 0x0E, 0x26, 0xFA, 0x86, 0x68, 0x9D, 0x16, 0xCA,
+    0x9B, 0xA4, 0xDC, 0xC0, 0xC8, 0xF6, 0x15, 0x2F, 0xA6, 0x72, 0x2F, 0xFA, 0x3D, 0xFA, 0x95, 0x1E,
+    0xDA, 0xEF, 0xED, 0x0F, 0x2E, 0xFF, 0x2C, 0x1F, 0xA9, 0x37, 0xDF, 0xCD, 0xE5, 0xCE, 0x17, 0x2A,
+    0x6E, 0x0E, 0xA4, 0xF1, 0x83, 0x4B, 0x2E, 0x57, 0x76, 0x8C, 0xB7, 0x01, 0xDC, 0x44, 0x0D, 0xBC,
+    0x78, 0x3C, 0x23, 0x3C, 0x39, 0x9E, 0xD7, 0x89, 0xC6, 0x6D, 0x14, 0x0C, 0x36, 0x11, 0x26, 0x25,
+    0x6A, 0x49, 0x58, 0xD2, 0x44, 0x43, 0x8A, 0x1D, 0xA9, 0x12, 0x87, 0x22, 0x4F, 0x89, 0xA1, 0x82,
+    0xEF, 0xBD, 0xF1, 0x77, 0x14, 0xF8, 0xB6, 0x07, 0xB8, 0x54, 0x97, 0x24, 0x70, 0x91, 0x16, 0xA8,
+    0x5F, 0x8C, 0x30, 0x02, 0x2D, 0x14, 0xF0, 0xFC, 0x88, 0x60, 0x39, 0x8E, 0xA6, 0xB8, 0xA7, 0x90,
+    0x45, 0xB2, 0xED, 0x10, 0x60, 0x88, 0x43, 0x9A, 0xA2, 0x27, 0xDF, 0x5A, 0x0A, 0x70, 0x74, 0x71,
+    0xA3, 0x82, 0x5F, 0x55, 0x66, 0x24, 0x1A, 0x84, 0xAA, 0x13, 0x20, 0x10, 0x0D, 0x03, 0x79, 0x6B,
+    0x91, 0x96, 0x85, 0x15, 0x07, 0x0D, 0x65, 0x57, 0xD9, 0xF7, 0xA2, 0x59, 0xD7, 0xB3, 0xA1, 0xFE,
+    0x7A, 0xA6, 0xCA, 0x41, 0x62, 0x93, 0xFD, 0x26, 0xFE, 0xC3, 0x53, 0x5D, 0x53, 0x91, 0x92, 0x56,
+    0xA5, 0xBA, 0xED, 0xA4, 0xDB, 0x93, 0xAD, 0x7A, 0x70, 0x3E, 0x0A, 0x6B, 0xF4, 0x74, 0xE5, 0x2B,
+    0x44, 0x55, 0x71, 0xFC, 0xAE, 0x80, 0x56, 0x5B, 0xAE, 0x59, 0x0F, 0xF0, 0xA1, 0xA5, 0xF8, 0xAF,
+    0x86, 0xC4, 0xED, 0xA6, 0xC3, 0xA7, 0x23, 0x47, 0xAB, 0xC8, 0x76, 0x73, 0xD7, 0x33, 0xBC, 0xE8,
+    0xBF, 0x0D, 0x0F, 0x34, 0x2D, 0x50, 0xB5, 0x8C, 0x2E, 0x23, 0xAA, 0xE1, 0xAC, 0xEA, 0x3C, 0x25,
+    0x86, 0x6F, 0xF5, 0xEB, 0xF9, 0xC1, 0x45, 0x21, 0xA0, 0xC6, 0xA2, 0xB3, 0xC9, 0x1D, 0xAE, 0xB1,
+    0xEA, 0xCA, 0xBD, 0xAA, 0xD9, 0x56, 0x29, 0xDB, 0x96, 0x81, 0xC7, 0xAE, 0xD8, 0x28, 0x41, 0xC8,
+    0x56, 0x68, 0xC0, 0xD3, 0xE6, 0xAE, 0xA1, 0x6C, 0x77, 0x82, 0xFD, 0xAD, 0xD0, 0xC2, 0x3E, 0xFE,
+    0x00, 0x0C, 0xC7, 0x1E, 0x90, 0x41, 0x60, 0xEC, 0x39, 0x41, 0x14, 0x0D, 0xD5, 0x83, 0x67, 0x10,
+    0xCB, 0x96, 0xDE, 0x8E, 0x96, 0x8C, 0x0C, 0xAB, 0xA1, 0xD9, 0xFC, 0x68, 0x7E, 0x76, 0xBF, 0xD1,
+    0x4E, 0xA7, 0x34, 0xA0, 0xAA, 0xA5, 0x56, 0xDE, 0x03, 0xC1, 0x33, 0x60, 0x0C, 0xA6, 0xA6, 0x09,
+    0x3C, 0x48, 0x14, 0xDC, 0x80, 0x9B, 0x2C, 0x0E, 0xE5, 0xA9, 0xC1, 0x8D, 0x70, 0xD0, 0x6C, 0x5D,
+    0xD6, 0xF3, 0xC3, 0x24, 0x57, 0x84, 0x8D, 0x5C, 0x4D, 0x6A, 0x7E, 0x54, 0x70, 0x15, 0x26, 0x48,
+    0xC3, 0xA4, 0x1C, 0xBB, 0xD3, 0x12, 0xCB, 0xB4, 0xC6, 0xFE, 0x57, 0xEB, 0x60, 0xCF, 0xA8, 0xDD,
+    0x6B, 0x8C, 0xEB, 0xF8, 0x33, 0x64, 0xC5, 0xDC, 0x25, 0xC8, 0x39, 0x04, 0xFC, 0xFF, 0xC9, 0x12,
+    0xAD, 0x48, 0x23, 0x0F, 0x2C, 0x5D, 0x30, 0x1D, 0x8B, 0x57, 0x81, 0x84, 0xF4, 0x65, 0xA7, 0xCA,
+    0x61, 0x62, 0x52, 0x61, 0xB3, 0xE8, 0x49, 0x28, 0xC7, 0x73, 0x5A, 0x25, 0xD6, 0x21, 0x27, 0x56,
+    0x51, 0xA9, 0xEE, 0x7B, 0x1A, 0x4F, 0x8E, 0x0A, 0xBA, 0x08, 0x1A, 0x06, 0x61, 0x42, 0x4D, 0x3C,
+    0x61, 0x22, 0xFA, 0x58, 0x5C, 0x65, 0x66, 0xB0, 0xA6, 0x0F, 0xAF, 0xBB, 0x2C, 0x84, 0xB3, 0x8F,
+    0xCB, 0x6A, 0x93, 0xE2, 0x87, 0x9E, 0xD4, 0x5A, 0x49, 0x7B, 0x05, 0x25, 0x76, 0x4A, 0x37, 0x00,
+    0xA2, 0xA1, 0x70, 0xE8, 0xE9, 0x1C, 0x60, 0xB9, 0xA5, 0x33, 0xE0, 0x74, 0xAF, 0xC3, 0x9A, 0xD3,
+    0x6B, 0x7B, 0x22, 0x4C, 0xF5, 0x2F, 0x28, 0x78, 0x5B, 0x45, 0xBE, 0x92, 0xCD, 0x60, 0x5C, 0xEA,
+    0xD9, 0x53, 0x25, 0xA5, 0x28, 0xD7, 0x28, 0x7F, 0xD1, 0x30, 0x7A, 0xC9, 0x0E, 0x8F, 0xFC, 0x3E,
+    0x37, 0xAA, 0x23, 0xCD, 0xF7, 0x2D, 0xF7, 0xCC, 0x02, 0xD3, 0x06, 0x5D, 0x0C, 0x41, 0x77, 0x6D,
+    0xEE, 0x25, 0x64, 0x6F, 0x73, 0xC6, 0x39, 0xD2, 0xDC, 0xB8, 0x3A, 0xD9, 0x81, 0x15, 0x3F, 0xFF,
+    0xC4, 0xED, 0x7D, 0xF1, 0x11, 0x5B, 0xDD, 0xB5, 0xBA, 0x0A, 0x7B, 0x6C, 0x3F, 0xBF, 0x02, 0x87,
+    0x6A, 0xFF, 0x2E, 0xB6, 0x12, 0xEB, 0x0B, 0xAE, 0x76, 0x05, 0x7F, 0xB2, 0x81, 0xAF, 0xAE, 0x7B,
+    0x21, 0x37, 0x27, 0xAC, 0xB4, 0xC2, 0x63, 0xA3, 0x3D, 0x8E, 0xBB, 0x63, 0x9F, 0xDA, 0xE3, 0x85,
+    0x39, 0xB6, 0x4E, 0x9F, 0x8A, 0x19, 0x9A, 0x6B, 0x1A, 0x65, 0xE4, 0xB3, 0xF7, 0x49, 0x9D, 0xF6,
+    0x48, 0x31, 0xB9, 0xE4, 0x30, 0x99, 0xE4, 0x76, 0xC3, 0x71, 0x0E, 0xEE, 0xB3, 0x0D, 0x01, 0xC0,
+    0xD4, 0x7B, 0xFB, 0x0D, 0x83, 0xDC, 0x86, 0x4D, 0x93, 0x33, 0xAC, 0x05, 0x05, 0x79, 0xBD, 0x83,
+    0x41, 0x34, 0x87, 0x64, 0x97, 0xBB, 0x96, 0x3E, 0xC9, 0xC1, 0x71, 0xC4, 0x84, 0x09, 0x0E, 0xE6,
+    0x25, 0x26, 0x91, 0x33, 0x5D, 0xED, 0xCB, 0x03, 0x29, 0x5E, 0xA0, 0x64, 0x5E, 0xD2, 0x39, 0xAE,
+    0x99, 0xEB, 0xE7, 0x6D, 0xDB, 0x4B, 0xCD, 0x9F, 0xA2, 0x9B, 0x62, 0x1E, 0x4C, 0x16, 0x8E, 0x5A,
+    0x5C, 0xDC, 0x72, 0x4A, 0x76, 0x32, 0xA5, 0x85, 0x6B, 0x14, 0x66, 0xF1, 0x97, 0x53, 0x9E, 0x87,
+    0x82, 0xB9, 0x1C, 0x3B, 0x81, 0x3E, 0xC3, 0x74, 0x28, 0xD8, 0x81, 0xDC, 0xBF, 0x3F, 0x4B, 0xFA,
+    0x7B, 0x28, 0xAD, 0xE6, 0x0E, 0xD7, 0xA6, 0x0B, 0x3C, 0xE9, 0x4E, 0x60, 0x6A, 0x82, 0x7B, 0xC2,
+    0x89, 0xA5, 0x31, 0x1C, 0x5E, 0xEC, 0x41, 0xA5, 0xFD, 0x9F, 0xE2, 0x65, 0xCC, 0xA7, 0xF9, 0x75,
+    0x2F, 0xC3, 0x21, 0x83, 0x1B, 0x1B, 0xA5, 0x0A, 0x53, 0xDA, 0xF8, 0xD8, 0x74, 0x18, 0xEB, 0xEE,
+    0x24, 0x78, 0x67, 0x91, 0x6D, 0x52, 0xD7, 0x8D, 0xAC, 0x39, 0x6E, 0xBD, 0xE2, 0x99, 0x4E, 0x9B,
+    0x2C, 0xA0, 0xCB, 0xC7, 0xC1, 0xC6, 0x1D, 0x94, 0xF1, 0x94, 0x79, 0x30, 0x87, 0x4A, 0x40, 0xEE,
+    0x35, 0xE2, 0xA8, 0x52, 0x4C, 0x91, 0x43, 0x30, 0x9A, 0xD2, 0x51, 0xEC, 0xE4, 0x1D, 0xD6, 0x05,
+    0x04, 0x52, 0x2C, 0x53, 0x8E, 0x71, 0x28, 0x6F, 0xA1, 0xCC, 0x75, 0x2E, 0x2C, 0xE4, 0x5A, 0xD1,
+    0xBF, 0x2E, 0x31, 0xAA, 0x22, 0xFC, 0x54, 0x80, 0xA8, 0xAC, 0x81, 0x90, 0x5A, 0xCC, 0x99, 0xD5,
+    0x0E, 0xD5, 0x60, 0x0E, 0xAD, 0xB0, 0xDE, 0x5E, 0xA5, 0x05, 0x55, 0x26, 0x3B, 0x56, 0xA0, 0x7C,
+    0xBE, 0xE2, 0x39, 0xB6, 0xDC, 0xBF, 0xDF, 0xC5, 0x8C, 0x1A, 0xD2, 0x34, 0xA5, 0xCD, 0xC4, 0x6E,
+    0x9D, 0x9E, 0x3F, 0xB2, 0x59, 0xEB, 0xE9, 0x59, 0x8D, 0xD4, 0xF9, 0x49, 0xB1, 0xBE, 0x68, 0x88,
+    0x2C, 0x61, 0x89, 0x91, 0xED, 0x0E, 0xF5, 0x57, 0xD2, 0x7A, 0xCB, 0x21, 0x0B, 0x85, 0x7D, 0x2B,
+    0x6F, 0xBB, 0xC8, 0xF5, 0xEF, 0x9A, 0xB4, 0x34, 0x47, 0x23, 0x5B, 0x3F, 0x38, 0x1F, 0x9F, 0xFC,
+    0x3D, 0x39, 0xB1, 0xFE, 0x07, 0xB5, 0x55, 0xB1, 0x8E, 0xDB, 0x46, 0x14, 0x1C, 0x72, 0x61, 0xB0,
+    0x58, 0xC0, 0xDB, 0xC4, 0x4D, 0x82, 0x1C, 0xBF, 0xE0, 0xA8, 0x1F, 0xA0, 0x28, 0xC6, 0x57, 0xB8,
+    0x48, 0x73, 0x85, 0x0F, 0xF9, 0x8B, 0x54, 0x2E, 0xAE, 0x20, 0x22, 0xC6, 0x2E, 0xD2, 0xBA, 0x49,
+    0x9F, 0x22, 0xBD, 0x1B, 0x01, 0x61, 0xA1, 0x40, 0x7B, 0x77, 0x45, 0x8A, 0x34, 0x8C, 0xBF, 0x80,
+    0x8D, 0x1B, 0xA7, 0xC8, 0xC2, 0xD8, 0x42, 0x09, 0x74, 0xDA, 0xCC, 0x5B, 0xF2, 0x4E, 0x4A, 0xE0,
+    0xC2, 0x41, 0xE0, 0xBD, 0x93, 0x40, 0xEE, 0xBE, 0x9D, 0x37, 0x3B, 0x6F, 0xDE, 0x0A, 0x90, 0x51,
+    0x9E, 0x02, 0xB9, 0xA9, 0x71, 0x37, 0x92, 0x30, 0x40, 0x85, 0x50, 0x2B, 0xAF, 0x9C, 0x72, 0xA8,
+    0x52, 0x07, 0x6D, 0x3D, 0xE0, 0x1A, 0xC6, 0x16, 0x80, 0x61, 0xAC, 0xBA, 0xE9, 0x91, 0x38, 0x07,
+    0xAC, 0x4B, 0xA0, 0xE2, 0x44, 0x7E, 0x36, 0xC0, 0xD8, 0x35, 0x23, 0x8D, 0xD5, 0x7D, 0x12, 0x36,
+    0x3D, 0x74, 0x68, 0xEF, 0x31, 0xBB, 0x12, 0xAB, 0x72, 0x7A, 0xFE, 0xB4, 0x4E, 0x82, 0xD7, 0x6F,
+    0xD6, 0x79, 0x5D, 0x55, 0xC8, 0x4B, 0xE4, 0x0D, 0xF2, 0x0E, 0x85, 0x47, 0xE5, 0x51, 0x76, 0xE8,
+    0x9A, 0xC4, 0xCD, 0x5E, 0xF5, 0x7A, 0xFF, 0x1F, 0x08, 0x85, 0x10, 0x6E, 0xF8, 0xF9, 0x50, 0x42,
+    0x07, 0x06, 0xC5, 0xC8, 0x60, 0x19, 0xC2, 0x26, 0x04, 0x2F, 0x24, 0xDE, 0xCB, 0x00, 0x5E, 0x52,
+    0x9D, 0xE0, 0xE3, 0x51, 0xE2, 0x58, 0xBD, 0x57, 0xA3, 0x0F, 0x64, 0x78, 0x59, 0x22, 0x1D, 0xDC,
+    0xDD, 0x9B, 0x26, 0xBD, 0x05, 0xA3, 0xCF, 0x33, 0x4E, 0xA9, 0x9E, 0x13, 0x96, 0x35, 0xE6, 0x02,
+    0xE9, 0x25, 0x8E, 0xC4, 0xAD, 0x0E, 0xB2, 0x97, 0x8C, 0x15, 0x57, 0x66, 0xE3, 0xA3, 0xB1, 0x48,
+    0x76, 0x29, 0x17, 0x33, 0x6E, 0x9D, 0x46, 0xF6, 0xC2, 0x16, 0x66, 0x7C, 0x7C, 0xF0, 0x23, 0xC2,
+    0x2E, 0xFD, 0x7E, 0x27, 0xB1, 0xE9, 0x00, 0xDD, 0x86, 0x7D, 0x16, 0xB6, 0x02, 0xCF, 0x80, 0x0E,
+    0xD9, 0xD5, 0xDB, 0x5B, 0x15, 0x6C, 0xDC, 0x14, 0x7A, 0xA4, 0x61, 0x64, 0x43, 0xD1, 0x3A, 0xE6,
+    0x98, 0x73, 0x53, 0x85, 0x82, 0x24, 0x32, 0x4B, 0x29, 0x5C, 0xC6, 0x29, 0xEE, 0xD4, 0xCF, 0x87,
+    0xD1, 0x47, 0xE5, 0x8A, 0x24, 0x85, 0xDD, 0x2D, 0xF7, 0x54, 0x18, 0xD9, 0x8A, 0x29, 0x73, 0x8B,
+    0x88, 0x7A, 0x10, 0x4A, 0x45, 0xED, 0xFB, 0xF8, 0x7C, 0x8E, 0x07, 0x4C, 0x3D, 0xE7, 0xA7, 0xE1,
+    0x1F, 0xB5, 0x61, 0x21, 0x4A, 0xA6, 0x2B, 0x75, 0x8B, 0x39, 0x69, 0x9D, 0xB2, 0x16, 0x9F, 0x53,
+    0xD4, 0x13, 0xC2, 0x3F, 0x64, 0x1A, 0xD3, 0xC7, 0x63, 0x46, 0x64, 0x39, 0xB5, 0xE8, 0xBD, 0x05,
+    0x96, 0x5C, 0x5A, 0xDE, 0x27, 0x70, 0x0C, 0x6E, 0xE6, 0x87, 0x5A, 0xCB, 0x59, 0x4B, 0x9E, 0xD3,
+    0xD4, 0x6A, 0x48, 0x87, 0xC4, 0xC5, 0x4C, 0x86, 0xDF, 0xAA, 0x67, 0x54, 0x57, 0x48, 0xFB, 0x90,
+    0xD6, 0xAF, 0xC4, 0xFC, 0x49, 0x74, 0x66, 0x0E, 0x35, 0x88, 0xD0, 0xA3, 0xAC, 0x09, 0x15, 0x5B,
+    0xF0, 0x63, 0xB6, 0x38, 0x1A, 0xEA, 0x37, 0x07, 0x75, 0x35, 0xDC, 0xBF, 0x7F, 0x94, 0x93, 0x98,
+    0x2F, 0x5B, 0xE8, 0xEF, 0x2C, 0xAB, 0xD8, 0x42, 0x3D, 0x1E, 0xA7, 0x2F, 0x59, 0x3C, 0xE2, 0x79,
+    0xAA, 0xBF, 0x8D, 0xD9, 0x72, 0x66, 0x55, 0x96, 0x7A, 0x7B, 0x62, 0x15, 0x4C, 0x97, 0xDD, 0x10,
+    0xF7, 0x1D, 0xF1, 0x4F, 0x09, 0x96, 0xF9, 0x11, 0x58, 0xAC, 0x03, 0x11, 0x65, 0x49, 0xD8, 0x40,
+    0xFE, 0x7B, 0xFC, 0x63, 0x64, 0xBF, 0xB0, 0x50, 0xDC, 0xA8, 0xAE, 0x2D, 0xD2, 0x6F, 0xED, 0xE8,
+    0x18, 0x1E, 0x8B, 0x4E, 0xF1, 0x47, 0x69, 0x48, 0xD5, 0x31, 0xBB, 0x9C, 0xCA, 0x9C, 0x31, 0xF2,
+    0x35, 0x15, 0x78, 0xE6, 0xC6, 0x63, 0xA9, 0x35, 0xF7, 0x48, 0xFD, 0x17, 0x53, 0xED, 0xC5, 0xB5,
+    0xE2, 0x4F, 0x51, 0x53, 0x0E, 0x96, 0x0F, 0x47, 0x25, 0x3A, 0x5C, 0x59, 0x0E, 0xA7, 0x26, 0xEA,
+    0xC9, 0xCE, 0xCB, 0x78, 0x31, 0x35, 0x25, 0xF4, 0x0B, 0x0B, 0x5F, 0xC2, 0x28, 0x96, 0x2B, 0x7F,
+    0xBB, 0xC7, 0x92, 0x7E, 0xF9, 0x64, 0x3E, 0xA2, 0xF1, 0x20, 0xCC, 0x1E, 0x0D, 0x1F, 0x37, 0xCB,
+    0x20, 0x80, 0x79, 0x62, 0xA7, 0x7A, 0xD7, 0xC9, 0x17, 0x4E, 0x3A, 0xB9, 0x29, 0x50, 0x98, 0x9A,
+    0x34, 0x75, 0xEF, 0x33, 0xB7, 0x78, 0xB5, 0x56, 0xE1, 0x6B, 0x3C, 0x92, 0xDB, 0xCF, 0xC6, 0xE2,
+    0x12, 0x88, 0x45, 0x09, 0xA1, 0x5D, 0x86, 0xA1, 0x88, 0x8C, 0xA7, 0x85, 0x8E, 0x80, 0xFF, 0x7A,
+    0x9F, 0xC7, 0x6C, 0xD3, 0xFB, 0xA6, 0xC5, 0xA2, 0x8F, 0xA9, 0xCB, 0x68, 0x74, 0xD2, 0x49, 0x5F,
+    0x32, 0xF3, 0xC5, 0x53, 0x36, 0x6E, 0x75, 0xC1, 0x05, 0xB6, 0x07, 0x1B, 0x67, 0x35, 0x35, 0x57,
+    0x23, 0xFD, 0x46, 0xB8, 0x85, 0x45, 0x10, 0xB4, 0x71, 0xB6, 0x44, 0xF2, 0xC3, 0xBD, 0xFC, 0x46,
+    0x53, 0x8D, 0x13, 0x73, 0x5C, 0x91, 0x4B, 0x69, 0xBE, 0x4E, 0x38, 0x7A, 0xC9, 0x2F, 0xD9, 0x24,
+    0x79, 0x49, 0x2C, 0x34, 0xF2, 0xD5, 0xA9, 0xF0, 0x92, 0x3E, 0x08, 0x3B, 0x69, 0xC7, 0x6F, 0x12,
+    0xA7, 0xDB, 0x3C, 0x19, 0x78, 0xE0, 0xC7, 0xF4, 0x87, 0xA1, 0xDD, 0x91, 0x8B, 0x2D, 0xAA, 0xCC,
+    0x16, 0xC9, 0x4E, 0xB7, 0xBC, 0x4F, 0x4C, 0xBD, 0x08, 0xF5, 0x9D, 0xEC, 0xD2, 0x25, 0xF2, 0xD3,
+    0x71, 0x30, 0x30, 0xCE, 0x57, 0xF1, 0xA6, 0x8F, 0x7E, 0x35, 0x3C, 0x42, 0x76, 0xFD, 0x86, 0xF5,
+    0x0F, 0x01, 0xAB, 0xEA, 0x2B, 0xC7, 0xC9, 0x39, 0x27, 0xCD, 0x93, 0x2B, 0xA7, 0xAE, 0x07, 0xDA,
+    0xDB, 0xEB, 0xDF, 0x59, 0xA2, 0x8D, 0x9F, 0x48, 0x2F, 0xC2, 0x90, 0x85, 0x5B, 0x21, 0x2C, 0x19,
+    0x5C, 0x14, 0x46, 0x58, 0x52, 0xB9, 0x59, 0xB0, 0xC2, 0x92, 0x88, 0x47, 0xCB, 0x66, 0xEC, 0xB0,
+    0x59, 0x0F, 0xB5, 0x1B, 0x0B, 0x5B, 0x46, 0x25, 0x35, 0x27, 0x7F, 0x16, 0xC0, 0x47, 0x17, 0xD8,
+    0xEC, 0xF1, 0xE7, 0x53, 0x06, 0x33, 0x90, 0x50, 0x9F, 0xFD, 0x45, 0xFE, 0x2D, 0x23, 0x09, 0x24,
+    0xFE, 0xAB, 0x61, 0x9C, 0xFC, 0x83, 0x77, 0x50, 0x2F, 0x08, 0xD4, 0xB7, 0x8A, 0xAD, 0x94, 0xB5,
+    0xB1, 0xCF, 0xC5, 0xB2, 0xB4, 0x2B, 0x31, 0x9F, 0x8B, 0x70, 0xAC, 0xB7, 0xFA, 0x03, 0x63, 0x83,
+    0xC7, 0x96, 0x60, 0x3C, 0x34, 0x93, 0x27, 0xD2, 0x2C, 0x73, 0xF2, 0x35, 0x2D, 0x13, 0x51, 0xC7,
+    0xD8, 0xC3, 0xBC, 0x2E, 0x76, 0x74, 0xEE, 0x4C, 0xDA, 0xEE, 0x99, 0x5C, 0xCA, 0xF5, 0x64, 0x37,
+    0xE9, 0x1C, 0x82, 0xD2, 0x67, 0x75, 0x81, 0x35, 0x5C, 0x0E, 0x7D, 0x46, 0xD7, 0xFA, 0xD8, 0x53,
+    0x39, 0x17, 0x58, 0xAF, 0xA5, 0x85, 0xE1, 0x9D, 0xC3, 0xF6, 0xD8, 0x1A, 0xF6, 0xF7, 0x46, 0x5B,
+    0x35, 0x9D, 0x79, 0x88, 0xE6, 0x62, 0xEA, 0x74, 0xC0, 0xFF, 0x1C, 0x7F, 0x03, 0xBD, 0x55, 0x4D,
+    0x6C, 0x1B, 0x45, 0x14, 0xFE, 0x76, 0x27, 0xEE, 0xB6, 0xD9, 0xD8, 0x63, 0xA1, 0x20, 0x21, 0xC5,
+    0x3F, 0xD7, 0x28, 0xF2, 0x0F, 0x87, 0x1E, 0x82, 0xB4, 0xB6, 0xB7, 0xE4, 0xC0, 0x21, 0x42, 0xE4,
+    0x40, 0x8E, 0x48, 0x9C, 0x2B, 0xA4, 0xF4, 0xE0, 0xC3, 0x0A, 0xB9, 0xF1, 0x16, 0x0E, 0x08, 0x89,
+    0x43, 0x2F, 0x70, 0x43, 0xCA, 0xA1, 0x88, 0x2A, 0x5C, 0x2C, 0x64, 0x24, 0x0B, 0x85, 0x7A, 0x62,
+    0x0E, 0x39, 0x14, 0x89, 0x69, 0x8F, 0x20, 0xD1, 0xAD, 0x2A, 0x84, 0x04, 0x07, 0x06, 0xD8, 0x12,
+    0xD3, 0x3A, 0x1E, 0xDE, 0x78, 0xD7, 0x11, 0xA0, 0x04, 0x89, 0x0B, 0x6F, 0xED, 0x99, 0x7D, 0xDF,
+    0xBC, 0x7D, 0xFB, 0xCD, 0xBC, 0x9F, 0x85, 0x07, 0x27, 0xB4, 0x23, 0x4B, 0xA1, 0x8C, 0x06, 0xA0,
+    0x78, 0x08, 0xF7, 0x2D, 0x05, 0x78, 0x1D, 0x80, 0xFD, 0x0C, 0x64, 0x76, 0x1E, 0xFB, 0xD0, 0x3A,
+    0xC6, 0xE2, 0xF0, 0x47, 0xC0, 0x9D, 0x00, 0xD6, 0xAF, 0x12, 0x68, 0x94, 0x01, 0x1E, 0x2A, 0xD8,
+    0xCA, 0x0D, 0xD1, 0xA1, 0x8B, 0xFB, 0x4C, 0xB2, 0x08, 0x35, 0x58, 0xBE, 0xE5, 0xD7, 0x70, 0x00,
+    0x55, 0x86, 0xBB, 0x21, 0xD1, 0x89, 0xC1, 0xA6, 0xB8, 0x40, 0x0F, 0x0F, 0x75, 0x84, 0xAE, 0x00,
+    0xF7, 0xC0, 0xEE, 0x47, 0x18, 0x73, 0xD4, 0x31, 0x70, 0x05, 0x13, 0x40, 0x16, 0xD9, 0xFA, 0x64,
+    0xEF, 0xFE, 0x7B, 0x8B, 0x58, 0xC5, 0x9E, 0x1D, 0x9E, 0x31, 0xC1, 0x48, 0xC1, 0x12, 0x7C, 0x5A,
+    0x58, 0x2D, 0x9C, 0x6D, 0x92, 0x4C, 0x58, 0xBB, 0xAD, 0x1F, 0x6E, 0xA7, 0x63, 0x4B, 0xEB, 0xB2,
+    0xD6, 0x62, 0x6D, 0xFF, 0x76, 0x4B, 0x4F, 0x9E, 0xDD, 0xDE, 0x5A, 0xDB, 0x27, 0xA1, 0x7B, 0x12,
+    0x52, 0x49, 0xCE, 0x40, 0x02, 0x5E, 0x62, 0x47, 0xE1, 0x2F, 0x91, 0xF7, 0x1F, 0x6F, 0x88, 0x5F,
+    0x66, 0xFB, 0xD5, 0xBA, 0x9E, 0xD0, 0x48, 0xF7, 0x5D, 0x3D, 0xBE, 0xBA, 0x7F, 0xCB, 0x12, 0x9E,
+    0xEB, 0xAB, 0xA6, 0x23, 0x97, 0xC1, 0xE4, 0x01, 0xBF, 0xA2, 0xAA, 0x2C, 0xCC, 0x83, 0x45, 0x1D,
+    0x37, 0x54, 0x25, 0xB3, 0x73, 0x8F, 0xA4, 0x52, 0x5C, 0xB0, 0xC4, 0x1E, 0x77, 0xFC, 0xBE, 0xC7,
+    0x46, 0x51, 0x93, 0x5B, 0xF1, 0x81, 0xE5, 0xFB, 0x74, 0x48, 0xAA, 0xCE, 0xC3, 0xB8, 0xE3, 0x8C,
+    0x64, 0x95, 0x23, 0xEA, 0x59, 0xE4, 0x95, 0x3D, 0x54, 0x65, 0x57, 0x0C, 0x3C, 0x76, 0x18, 0x95,
+    0x38, 0x54, 0xDB, 0x9C, 0x8A, 0xD7, 0xA0, 0xAB, 0xEA, 0x55, 0x2B, 0xA5, 0x62, 0x6E, 0x61, 0x01,
+    0x4D, 0x90, 0x5F, 0x3A, 0xE2, 0x10, 0xD7, 0x98, 0xD6, 0x6F, 0x3E, 0x89, 0x72, 0x80, 0x44, 0x01,
+    0x76, 0x8A, 0x0E, 0x28, 0x52, 0x30, 0xC1, 0xB6, 0x15, 0xD9, 0x92, 0xCB, 0x08, 0x88, 0xC9, 0x0B,
+    0x90, 0x83, 0xFD, 0xF1, 0x3E, 0x85, 0x5A, 0xE4, 0x7B, 0x5B, 0x46, 0x2F, 0x51, 0xB8, 0x43, 0xE2,
+    0x4D, 0x49, 0x81, 0xE5, 0xF5, 0x3C, 0xD7, 0x13, 0xFB, 0x93, 0xAB, 0xC6, 0x0F, 0xE9, 0x14, 0x70,
+    0x0A, 0x1F, 0x60, 0x4F, 0xBA, 0x4F, 0xF5, 0xF0, 0x78, 0x5A, 0x0E, 0x2F, 0x92, 0xCB, 0xB2, 0xAC,
+    0x8F, 0x5B, 0x27, 0xAD, 0x9B, 0x81, 0xE1, 0xD5, 0xD8, 0xBD, 0x9E, 0x27, 0xF7, 0xB2, 0xB6, 0xCB,
+    0x8E, 0x65, 0x33, 0x0F, 0xDF, 0x80, 0xDC, 0xEF, 0xB0, 0xA3, 0xA8, 0x65, 0x3F, 0x8E, 0x79, 0x78,
+    0x40, 0xD8, 0x02, 0x50, 0x6B, 0x35, 0x17, 0x60, 0xEB, 0x6F, 0xCE, 0x8D, 0xBD, 0x99, 0x48, 0x2C,
+    0x1D, 0xFD, 0x4B, 0xDC, 0x69, 0x22, 0xEF, 0x3A, 0x91, 0x45, 0xEC, 0x9D, 0xF5, 0x23, 0x83, 0xA9,
+    0x58, 0x82, 0xE0, 0xE7, 0x1B, 0xB8, 0x1A, 0xCF, 0x33, 0xCA, 0x9B, 0x73, 0x0D, 0x12, 0xE9, 0x86,
+    0xA0, 0x63, 0x2B, 0x7F, 0x61, 0x8E, 0x89, 0x62, 0xE1, 0xD2, 0xDE, 0x82, 0x9C, 0x45, 0x90, 0x8B,
+    0x88, 0x20, 0xA8, 0xA2, 0xC9, 0x07, 0x6E, 0x8F, 0xA4, 0x51, 0xBC, 0xE0, 0x0E, 0xEE, 0x70, 0xE7,
+    0x95, 0x66, 0xDC, 0x1A, 0x7F, 0xFE, 0xDB, 0xDD, 0x8D, 0xBB, 0x6F, 0x8F, 0xC6, 0x7D, 0xE5, 0x29,
+    0x0F, 0xA5, 0x22, 0xFB, 0x8E, 0x09, 0x36, 0x12, 0x2F, 0x48, 0x8F, 0xEC, 0x9C, 0x37, 0x58, 0x58,
+    0x65, 0xE2, 0x53, 0xD1, 0x77, 0x42, 0x2F, 0x47, 0x51, 0x57, 0xF6, 0x0F, 0x87, 0xC7, 0xB4, 0xC4,
+    0x63, 0x37, 0xC6, 0x3F, 0x24, 0xE1, 0x30, 0x67, 0x71, 0xCA, 0x63, 0xCE, 0xE4, 0x94, 0xCB, 0x9C,
+    0xCD, 0x29, 0x9F, 0x39, 0x23, 0xEC, 0xA6, 0x9C, 0xEA, 0x93, 0x84, 0xD5, 0xD1, 0x9C, 0x97, 0xAA,
+    0x24, 0xCC, 0xBE, 0xB6, 0x13, 0x6E, 0x8D, 0x28, 0x65, 0xF7, 0x21, 0x13, 0x33, 0x7E, 0x9F, 0xC9,
+    0x76, 0xC2, 0xB0, 0x38, 0xE7, 0xF8, 0x7B, 0xCA, 0xD2, 0x19, 0x9F, 0x12, 0xB4, 0x94, 0x89, 0xB6,
+    0x28, 0x92, 0x85, 0x51, 0x14, 0xDF, 0x0C, 0x3B, 0x94, 0xE1, 0xB2, 0x98, 0x83, 0xEA, 0xD9, 0xB6,
+    0x6F, 0xB0, 0x3E, 0xDF, 0x7C, 0x47, 0x74, 0x3C, 0x82, 0xEF, 0x45, 0xC5, 0x1C, 0x39, 0xEB, 0xB5,
+    0x6D, 0xFB, 0x8A, 0x8F, 0x76, 0x40, 0x65, 0x91, 0xCD, 0xB4, 0xFB, 0x41, 0x40, 0x05, 0xE2, 0x15,
+    0x2B, 0xD9, 0x6C, 0xE6, 0x52, 0xBB, 0xDF, 0x0B, 0x82, 0xBE, 0xE7, 0x05, 0x15, 0x8F, 0x10, 0x82,
+    0x0A, 0x99, 0x4B, 0x17, 0xCD, 0x9B, 0x22, 0xCA, 0x45, 0xE7, 0x1A, 0x1E, 0x85, 0x95, 0x8A, 0x63,
+    0x09, 0x99, 0x5D, 0x27, 0xC4, 0x2F, 0x39, 0x87, 0xAA, 0x63, 0x18, 0xC8, 0x12, 0x94, 0x85, 0x0C,
+    0x9D, 0x52, 0x40, 0x54, 0x22, 0x47, 0x34, 0x59, 0xD4, 0xB0, 0xA5, 0x95, 0xD2, 0xF4, 0x6D, 0x89,
+    0x0D, 0xC1, 0x43, 0xEE, 0x88, 0x2A, 0x94, 0x43, 0x0D, 0xCA, 0xA7, 0x21, 0x86, 0x23, 0xA8, 0x50,
+    0x1C, 0x11, 0x23, 0xEF, 0x3C, 0xF0, 0x9F, 0x51, 0x4E, 0xCC, 0x7E, 0x12, 0x5C, 0xF0, 0x77, 0xF1,
+    0x54, 0x3C, 0x07, 0xFE, 0x12, 0x95, 0x41, 0xFC, 0x77, 0xE3, 0xD7, 0xC9, 0x98, 0x45, 0xCE, 0xC8,
+    0xE7, 0xE1, 0x05, 0x80, 0x32, 0x1B, 0x03, 0x1E, 0x36, 0x99, 0xA4, 0xB2, 0x77, 0xC4, 0x81, 0xAD,
+    0x6A, 0xD4, 0xF3, 0xFC, 0x06, 0x13, 0xDC, 0x22, 0x3D, 0xB0, 0xA2, 0x2A, 0xFA, 0x1C, 0x1E, 0xE9,
+    0x49, 0x1C, 0x49, 0x62, 0x8E, 0x5D, 0x57, 0x96, 0x5F, 0x24, 0xBA, 0x79, 0xA3, 0xAF, 0x4C, 0x2D,
+    0x3D, 0xB5, 0xAF, 0x77, 0x2C, 0x15, 0x3B, 0x5F, 0xCA, 0x1A, 0x47, 0x3C, 0x66, 0x0F, 0x04, 0x1F,
+    0xA3, 0xEB, 0x5B, 0x31, 0x28, 0xDA, 0x95, 0xF4, 0x41, 0x6A, 0xC6, 0x13, 0x53, 0xC9, 0xB4, 0xA7,
+    0xB5, 0xFD, 0x8F, 0xB4, 0x36, 0x0E, 0x19, 0xB0, 0xB4, 0x0E, 0x76, 0x43, 0x22, 0x72, 0xDF, 0x1F,
+    0x60, 0x85, 0x02, 0xB3, 0x73, 0x13, 0x4F, 0x76, 0xE8, 0x6D, 0x91, 0xC4, 0xD2, 0x1E, 0x6C, 0x7F,
+    0x1E, 0x29, 0x6A, 0x11, 0xE4, 0xE9, 0x32, 0xA8, 0xCF, 0x5A, 0xC2, 0x34, 0x09, 0xD7, 0xF4, 0x64,
+    0x93, 0x56, 0x1D, 0xE3, 0xD8, 0xFE, 0x0A, 0xEC, 0x65, 0xE4, 0xB2, 0x28, 0x2C, 0xE2, 0xB2, 0xFB,
+    0x97, 0x14, 0xAC, 0x26, 0x93, 0x9A, 0x8D, 0xA6, 0x9D, 0x51, 0xD5, 0xE7, 0x66, 0xCA, 0xB0, 0x3F,
+    0x9B, 0x56, 0xF4, 0x6C, 0xAD, 0xFE, 0x41, 0x68, 0x7A, 0xC5, 0xB7, 0x33, 0xAC, 0x56, 0x4C, 0x73,
+    0x70, 0x96, 0x23, 0xA6, 0xF7, 0x10, 0x7D, 0x8B, 0x62, 0x63, 0x7E, 0x14, 0x16, 0x62, 0xB0, 0xEC,
+    0xA2, 0xBE, 0x09, 0x9C, 0xAC, 0x62, 0xE7, 0x8F, 0x6D, 0x6B, 0xF8, 0xFD, 0x16, 0xD3, 0x63, 0x94,
+    0xB5, 0x2C, 0x1F, 0x6E, 0x61, 0x98, 0xB1, 0x1F, 0xF9, 0x70, 0x5F, 0x43, 0x9D, 0x92, 0x7A, 0xE0,
+    0xA1, 0x57, 0xA5, 0x96, 0x14, 0xA7, 0x0F, 0xA7, 0xBC, 0xD6, 0x6E, 0xE9, 0x7B, 0xDB, 0xE6, 0x66,
+    0x9D, 0xFE, 0x3D, 0x7A, 0x0B, 0x2D, 0x30, 0xD3, 0x1F, 0x52, 0xCE, 0x41, 0x42, 0xDA, 0x30, 0x36,
+    0x25, 0x53, 0xC2, 0x6C, 0xAF, 0x06, 0x32, 0x2E, 0x9C, 0xD4, 0xD2, 0x40, 0xB3, 0x6D, 0xD4, 0x15,
+    0xB4, 0xF9, 0x4E, 0xD1, 0x29, 0x0F, 0x8C, 0x05, 0x37, 0x6B, 0x54, 0x63, 0xD4, 0x1D, 0x5B, 0xB4,
+    0x14, 0xD2, 0x52, 0xC9, 0x98, 0xD2, 0xCC, 0xCD, 0x91, 0x99, 0x25, 0x3F, 0x59, 0x02, 0x5A, 0xD2,
+    0x39, 0x49, 0x5A, 0xB2, 0x73, 0xDA, 0x7C, 0x39, 0x99, 0x10, 0x3A, 0x9C, 0xA1, 0x82, 0xE8, 0xB8,
+    0x73, 0x94, 0xBE, 0x9F, 0x5D, 0x69, 0x3E, 0xB2, 0xFF, 0x9B, 0xFC, 0x09, 0xA5, 0x55, 0x3D, 0x6C,
+    0x14, 0x47, 0x14, 0xFE, 0x66, 0xC7, 0x78, 0x85, 0x07, 0xDF, 0x5C, 0x41, 0xA4, 0x14, 0x1C, 0xDB,
+    0x50, 0x58, 0xE4, 0x6C, 0x28, 0x1C, 0xE9, 0x8A, 0xC5, 0x37, 0xA6, 0x0C, 0x8D, 0x0B, 0x9C, 0x94,
+    0xB8, 0x4C, 0x9A, 0xF8, 0x8A, 0x8B, 0x44, 0xA4, 0x03, 0xAF, 0x44, 0x41, 0x91, 0x06, 0x45, 0x4A,
+    0x4F, 0x41, 0x81, 0x92, 0x82, 0x4B, 0x64, 0x14, 0x17, 0x86, 0x1B, 0xE3, 0x22, 0x52, 0x68, 0x16,
+    0x37, 0x69, 0xF2, 0x33, 0x09, 0x14, 0x48, 0x48, 0xF1, 0x10, 0x9F, 0x14, 0x07, 0xFB, 0xEE, 0xE5,
+    0xCD, 0xFA, 0xB0, 0x2F, 0x0E, 0x56, 0x8A, 0xCC, 0xEC, 0xCE, 0xCE, 0xCF, 0xFB, 0xF9, 0xDE, 0xCF,
+    0xBC, 0x05, 0x42, 0x5B, 0xDC, 0x16, 0x94, 0x27, 0xE4, 0x3A, 0x64, 0x6E, 0x25, 0x11, 0x56, 0x81,
+    0x2E, 0xA4, 0x85, 0x36, 0x48, 0x01, 0x8F, 0xD8, 0x62, 0x26, 0x6C, 0x69, 0x8B, 0xEB, 0x88, 0x1D,
+    0x92, 0x4C, 0x6C, 0x43, 0xE5, 0xB8, 0x50, 0x1C, 0x1A, 0x54, 0x81, 0x76, 0xA0, 0x1F, 0x6A, 0x09,
+    0xB0, 0x02, 0xE9, 0x91, 0x0C, 0x58, 0x61, 0x20, 0xF6, 0x4E, 0x44, 0xC7, 0xC9, 0x27, 0xD4, 0x17,
+    0xDD, 0x33, 0xB1, 0x6D, 0xF1, 0xD1, 0x39, 0xE0, 0x82, 0xCE, 0xA0, 0x65, 0x0E, 0x9D, 0x79, 0xD6,
+    0xD1, 0x62, 0xF9, 0x53, 0xFC, 0x2A, 0xA3, 0x8D, 0xB4, 0x2C, 0xDE, 0x47, 0x16, 0xB5, 0x21, 0xC9,
+    0xD2, 0x6A, 0x1B, 0x75, 0xA5, 0x63, 0x9C, 0x65, 0x8C, 0xEC, 0xED, 0xAA, 0xAC, 0xD3, 0xC5, 0x76,
+    0x9D, 0x72, 0x3D, 0x6B, 0x66, 0x84, 0x87, 0xF0, 0x2C, 0x37, 0x61, 0x9A, 0xC8, 0x31, 0xCA, 0x16,
+    0x83, 0x4B, 0x4C, 0x8B, 0x31, 0xC7, 0x59, 0xE4, 0xB1, 0x8C, 0x16, 0x34, 0x77, 0x46, 0xEF, 0x0E,
+    0x20, 0x5F, 0xE0, 0x1E, 0x3B, 0x36, 0xEF, 0x1A, 0x77, 0x11, 0xE0, 0xBE, 0x35, 0x3F, 0x7F, 0x85,
+    0xE8, 0xD7, 0xF9, 0x79, 0xC6, 0x7F, 0x15, 0xC1, 0x17, 0x93, 0x85, 0x65, 0xEC, 0x17, 0x95, 0x05,
+    0x83, 0x19, 0x33, 0xEB, 0x0A, 0xE6, 0xAD, 0x00, 0x4B, 0xF4, 0x2C, 0x21, 0xBA, 0x19, 0xD3, 0xCB,
+    0x35, 0xEA, 0x37, 0x96, 0xE8, 0xC7, 0x84, 0xFE, 0x8C, 0xA9, 0xB7, 0x46, 0xB4, 0xB7, 0xF8, 0xA1,
+    0x38, 0xF1, 0x8D, 0x4F, 0xCC, 0xA9, 0x53, 0x88, 0x63, 0x88, 0x35, 0x8B, 0x46, 0x03, 0x87, 0x17,
+    0x45, 0x9B, 0x9F, 0xBF, 0x48, 0xF4, 0x07, 0xF5, 0x5A, 0x44, 0x7A, 0x89, 0xD6, 0x37, 0xC9, 0xEF,
+    0xD0, 0xEE, 0x0C, 0x2F, 0x3A, 0xB4, 0xFE, 0x0B, 0xF9, 0x2D, 0xDA, 0x4D, 0x97, 0xE8, 0xDE, 0x28,
+    0x91, 0x2D, 0x88, 0x4D, 0x9D, 0xFA, 0xFA, 0x0A, 0x3D, 0xBD, 0x41, 0xBB, 0x8E, 0xE8, 0x6A, 0x9D,
+    0x7E, 0xD7, 0xB4, 0x73, 0x83, 0xFA, 0xBC, 0x58, 0xA9, 0xD3, 0xCF, 0x9A, 0xB6, 0x5E, 0x50, 0x97,
+    0x68, 0xDF, 0x58, 0x91, 0x83, 0x9D, 0xC0, 0x71, 0x9B, 0x29, 0x41, 0xED, 0xB0, 0x35, 0xD4, 0x15,
+    0xBD, 0x0F, 0xC5, 0x0B, 0x44, 0xDE, 0xC1, 0xA7, 0x18, 0x51, 0x26, 0x90, 0x45, 0xD9, 0x75, 0x95,
+    0x9F, 0x39, 0xF0, 0x90, 0xB4, 0x69, 0xF1, 0x54, 0x39, 0x9A, 0x58, 0xBC, 0x05, 0xBC, 0x5A, 0x04,
+    0x7B, 0xD0, 0x21, 0xC7, 0x09, 0xDC, 0x46, 0x64, 0xF0, 0xFF, 0xDB, 0x09, 0xE0, 0xBC, 0xCC, 0x38,
+    0xDE, 0x4D, 0x7E, 0xD5, 0x17, 0xEC, 0xD7, 0x45, 0xB7, 0xAF, 0x1E, 0x21, 0x68, 0x26, 0x65, 0xBF,
+    0xE7, 0x8C, 0x3B, 0xE4, 0x12, 0x21, 0xFA, 0xEB, 0x2E, 0x26, 0x3D, 0xE4, 0x6F, 0x39, 0x12, 0x4E,
+    0xD4, 0x32, 0x53, 0x70, 0x5A, 0x14, 0x56, 0x32, 0x63, 0x9C, 0x05, 0x33, 0x23, 0xD7, 0x66, 0x7A,
+    0x9E, 0x72, 0x82, 0x8B, 0xDE, 0x47, 0x38, 0xDD, 0xE0, 0xB8, 0x39, 0xCE, 0x39, 0xCB, 0xA6, 0xF2,
+    0x76, 0x91, 0x44, 0xCA, 0xA6, 0xBB, 0xF1, 0xCD, 0xAC, 0xCD, 0x3A, 0xA2, 0x9C, 0x83, 0xCD, 0xAC,
+    0x61, 0x2E, 0x06, 0xF3, 0xE5, 0xC1, 0x3C, 0xBE, 0x91, 0xAD, 0x2E, 0xAB, 0xE0, 0xF7, 0xCB, 0x81,
+    0xAB, 0xD3, 0x37, 0x18, 0x9F, 0x7A, 0x9F, 0x9E, 0xC5, 0xEB, 0x06, 0x8B, 0xE4, 0x17, 0x80, 0xD1,
+    0x3B, 0xC0, 0xB1, 0x39, 0x76, 0x6A, 0x2E, 0x73, 0x65, 0x1C, 0xAA, 0x13, 0xC0, 0x46, 0x50, 0x32,
+    0x8A, 0x70, 0x51, 0x94, 0x52, 0x68, 0x7D, 0x93, 0x0B, 0x5A, 0x46, 0xDC, 0xE7, 0xAC, 0xA1, 0x8D,
+    0xAF, 0xFA, 0x77, 0xD1, 0xF1, 0x98, 0xFC, 0xD6, 0xAA, 0x4B, 0x09, 0xCA, 0x6D, 0xE6, 0x3D, 0xF0,
+    0x39, 0x9B, 0x95, 0x61, 0x62, 0xC8, 0x43, 0x65, 0x8E, 0x12, 0x83, 0xC5, 0xF1, 0x43, 0x9E, 0x5B,
+    0x00, 0xA7, 0x3B, 0xA7, 0xE6, 0x49, 0xE1, 0x7D, 0x77, 0x45, 0x5F, 0xBA, 0xB9, 0x6E, 0x5B, 0x69,
+    0x3A, 0x29, 0x1F, 0x3D, 0xC9, 0x5D, 0xA5, 0xA4, 0x15, 0x7C, 0xBB, 0x31, 0x1D, 0x45, 0xB3, 0xB3,
+    0xD9, 0x81, 0x68, 0x04, 0xE1, 0xF8, 0x87, 0xF8, 0x61, 0x45, 0xC0, 0x45, 0x4E, 0x6F, 0xF5, 0x98,
+    0xAD, 0x3D, 0x17, 0xD4, 0x9D, 0x79, 0x23, 0xDD, 0x42, 0x90, 0x15, 0x82, 0xA4, 0x43, 0x02, 0x9C,
+    0x1C, 0xA4, 0x18, 0x33, 0xC6, 0x81, 0x31, 0x79, 0xEF, 0x48, 0x05, 0x07, 0x8C, 0xD9, 0x01, 0xE3,
+    0xA1, 0x16, 0x54, 0x7E, 0xBE, 0x0F, 0x62, 0xA4, 0x80, 0xD5, 0x5A, 0x6D, 0x0D, 0x93, 0xD4, 0xC2,
+    0x72, 0x8C, 0x27, 0xD7, 0x50, 0xDC, 0x45, 0xFC, 0x2B, 0x0F, 0x27, 0x20, 0x58, 0x86, 0x66, 0x11,
+    0x41, 0x42, 0xF9, 0xF0, 0xF1, 0x30, 0x2F, 0x5E, 0x23, 0xF1, 0x83, 0x8C, 0xDB, 0xD6, 0x91, 0x97,
+    0x3E, 0xD5, 0x56, 0x19, 0x5F, 0xD9, 0xDB, 0x0A, 0x59, 0x58, 0x94, 0x03, 0xE2, 0xB6, 0x15, 0x06,
+    0xBB, 0xBF, 0x55, 0x30, 0xBE, 0x2D, 0xED, 0x02, 0x33, 0x4A, 0x27, 0x5D, 0xAA, 0x33, 0x01, 0x3F,
+    0x32, 0x60, 0x64, 0x27, 0x8E, 0xD4, 0xEB, 0x93, 0x81, 0x6C, 0xA6, 0x3E, 0x33, 0xF8, 0x8C, 0xA0,
+    0xF5, 0x80, 0x2D, 0x68, 0x3D, 0x58, 0x2D, 0x86, 0xF2, 0xDE, 0xA0, 0xFA, 0x63, 0xB8, 0x3D, 0xA6,
+    0x29, 0x8C, 0x6F, 0x78, 0x18, 0x04, 0x85, 0xBB, 0x58, 0x3F, 0x9A, 0x40, 0xF5, 0xEB, 0x6B, 0x5D,
+    0xFD, 0xE6, 0xD3, 0x82, 0x00, 0x73, 0x3A, 0xDA, 0xAE, 0x3F, 0xEE, 0x1F, 0x4D, 0xE0, 0xDF, 0xFD,
+    0x7E, 0xEC, 0x6C, 0x76, 0xB4, 0x04, 0xE5, 0xFE, 0x03, 0xE4, 0x9C, 0x20, 0xD3, 0xF5, 0xCB, 0xD5,
+    0x54, 0x95, 0xA2, 0xEF, 0xCC, 0xCB, 0xBC, 0xD6, 0xAC, 0x9C, 0xD6, 0x92, 0xCC, 0x14, 0xF3, 0x0A,
+    0x9C, 0xAA, 0x4E, 0x4C, 0x9F, 0x6F, 0xB4, 0x6F, 0x85, 0x5A, 0xE3, 0x44, 0x17, 0xBB, 0x78, 0x81,
+    0x2D, 0xDB, 0x76, 0xF7, 0xB9, 0x84, 0x65, 0x1A, 0x5C, 0x07, 0xF8, 0x48, 0x90, 0xBD, 0x3F, 0x57,
+    0xC3, 0x38, 0xE2, 0x1E, 0x3E, 0xB0, 0x5C, 0x17, 0x2A, 0xD0, 0xEA, 0x9E, 0x79, 0x18, 0x6E, 0xD4,
+    0x92, 0xFD, 0xB4, 0x5C, 0xE3, 0x0B, 0xAE, 0x49, 0x6E, 0x3C, 0x71, 0xB5, 0xE6, 0x78, 0x49, 0xC9,
+    0xCD, 0x6C, 0x8A, 0x13, 0x40, 0x92, 0xE3, 0xB2, 0x5D, 0xE3, 0x90, 0x30, 0x39, 0xDF, 0xA7, 0x38,
+    0x93, 0x96, 0xAF, 0xF5, 0xED, 0x3D, 0x48, 0xCE, 0x37, 0xAB, 0xA5, 0x92, 0xE8, 0x0B, 0x9A, 0x75,
+    0xBE, 0x5D, 0x49, 0x55, 0xBC, 0x99, 0x7D, 0x6C, 0x82, 0x2E, 0xF1, 0xD2, 0xB5, 0x19, 0xAD, 0x96,
+    0x8F, 0x76, 0xFC, 0x54, 0x93, 0x45, 0x4F, 0x8E, 0x3D, 0x14, 0xCF, 0x21, 0x4C, 0x94, 0x45, 0xD9,
+    0x52, 0xEF, 0x9D, 0xE7, 0xE1, 0xCB, 0xC5, 0xBE, 0x77, 0xF6, 0x6E, 0x18, 0xF9, 0x27, 0x71, 0x99,
+    0xC7, 0xB2, 0xCC, 0x52, 0x91, 0x6B, 0x34, 0x23, 0xAB, 0x59, 0xA9, 0x93, 0x8C, 0xBE, 0x8A, 0x69,
+    0xFE, 0x89, 0xA4, 0xC2, 0x56, 0x90, 0x8F, 0x8B, 0xBC, 0x12, 0xD9, 0x1A, 0x57, 0x83, 0x2A, 0x5F,
+    0xED, 0x63, 0xD1, 0xA6, 0xDB, 0xAE, 0xA6, 0xBA, 0x22, 0x3F, 0xC3, 0x86, 0x6D, 0xB8, 0xEA, 0x34,
+    0xBB, 0x6A, 0x0E, 0xC3, 0x9E, 0xFA, 0x3A, 0x4F, 0x9B, 0xA7, 0x4B, 0x03, 0x4F, 0x21, 0xD1, 0x4F,
+    0x7F, 0x8A, 0x42, 0xB4, 0x6B, 0xB1, 0x69, 0x6B, 0x76, 0xCA, 0x49, 0x74, 0xF2, 0xE9, 0xF0, 0x13,
+    0x0B, 0x46, 0x85, 0x2E, 0x73, 0x69, 0x25, 0xF9, 0x2F, 0xEF, 0x70, 0x4C, 0x7B, 0xC7, 0x13, 0x3E,
+    0x29, 0x8D, 0xAE, 0x8C, 0x76, 0x19, 0x44, 0xD5, 0xA4, 0xAF, 0xBA, 0x8B, 0xD9, 0x11, 0xE5, 0xF6,
+    0x6F, 0x55, 0x55, 0x4D, 0x8C, 0x1B, 0x45, 0x16, 0xFE, 0xAA, 0x2A, 0x99, 0x0A, 0x14, 0xE3, 0xCA,
+    0x21, 0x7B, 0xC8, 0x66, 0xC6, 0xBE, 0xAE, 0xA0, 0xC7, 0xE6, 0x30, 0x20, 0x0B, 0xB5, 0xE3, 0x22,
+    0x73, 0xC8, 0x61, 0x24, 0xF0, 0x21, 0x11, 0xD7, 0x15, 0xE7, 0x08, 0x7C, 0x18, 0x89, 0x01, 0x79,
+    0x70, 0x2F, 0x73, 0xE0, 0x86, 0x46, 0x1C, 0x96, 0x03, 0x42, 0x9A, 0x43, 0x84, 0xB4, 0x68, 0xA5,
+    0x58, 0x2B, 0x23, 0x0D, 0x12, 0x1A, 0xD7, 0x64, 0x0E, 0x1C, 0x72, 0xA0, 0x20, 0x59, 0x71, 0x58,
+    0x90, 0x1A, 0x94, 0x1C, 0xC8, 0xF0, 0x53, 0xBB, 0xE9, 0xB0, 0xF3, 0xE3, 0x71, 0xF1, 0xAA, 0x3D,
+    0x01, 0xD1, 0xF2, 0x2B, 0xB7, 0xEB, 0xE7, 0xD5, 0xF7, 0xDE, 0xF7, 0xBD, 0x67, 0x00, 0xD2, 0x8A,
+    0x5C, 0xEC, 0xF3, 0x6F, 0xF8, 0x2D, 0x76, 0x7B, 0xE7, 0x5E, 0x31, 0x0A, 0x58, 0x80, 0x02, 0xCB,
+    0x00, 0x16, 0xEC, 0xC7, 0x9D, 0x26, 0x66, 0x21, 0x8F, 0xF1, 0x92, 0xC5, 0x0A, 0xE6, 0xA0, 0xD5,
+    0x0D, 0xB3, 0x0D, 0x9C, 0x42, 0xDF, 0xAD, 0x9D, 0x6D, 0x22, 0x39, 0xAB, 0x83, 0xF8, 0x22, 0xCF,
+    0x9B, 0x8B, 0x95, 0x8A, 0xBA, 0x14, 0xB2, 0xBA, 0x01, 0x44, 0xC8, 0xAF, 0x0E, 0x41, 0x6B, 0xA8,
+    0x42, 0x43, 0x19, 0x91, 0x09, 0xCB, 0x72, 0x6C, 0x02, 0x67, 0x59, 0xC8, 0xFC, 0xA0, 0x39, 0xAF,
+    0x35, 0x9B, 0x20, 0x98, 0x7C, 0x38, 0x98, 0x4F, 0xD4, 0xD2, 0x5E, 0x79, 0x8A, 0x05, 0x3C, 0xF4,
+    0x83, 0x24, 0x55, 0x5A, 0xEC, 0x1C, 0xF9, 0xEA, 0x6A, 0x3C, 0x3E, 0xB3, 0xCD, 0xB6, 0x00, 0xC3,
+    0x2C, 0xB3, 0xED, 0xE3, 0x27, 0xBF, 0x8F, 0xDF, 0x30, 0xF4, 0xF6, 0x0F, 0xA0, 0x3D, 0x01, 0xFE,
+    0x74, 0x85, 0x46, 0x93, 0x2A, 0xE6, 0x52, 0x69, 0x06, 0x1A, 0x9E, 0x3E, 0x0A, 0x5D, 0x61, 0x18,
+    0x12, 0xE6, 0x66, 0x91, 0x57, 0x90, 0xCF, 0x73, 0x4B, 0x8B, 0x3E, 0x91, 0x86, 0x7F, 0xBB, 0xF4,
+    0xD5, 0x97, 0x76, 0xE0, 0x92, 0x6E, 0x25, 0x11, 0x97, 0x85, 0x3D, 0xEA, 0x3E, 0x76, 0x0A, 0xFC,
+    0xAE, 0xBE, 0x96, 0xCC, 0x2E, 0xF6, 0xFA, 0x1B, 0x03, 0x74, 0x71, 0x71, 0x38, 0x63, 0xF8, 0x75,
+    0xF1, 0xD5, 0x3A, 0x6D, 0x9B, 0xEB, 0xAA, 0x44, 0xBC, 0xCD, 0xEC, 0xA1, 0x9B, 0x31, 0x78, 0x8C,
+    0x3F, 0x7F, 0xD3, 0x3E, 0x6B, 0x25, 0xC5, 0xC1, 0x7E, 0xC0, 0x6D, 0x93, 0x0F, 0x3A, 0xA7, 0x70,
+    0x61, 0xE3, 0xEF, 0x8E, 0x5B, 0x55, 0x9B, 0xB8, 0x9F, 0x54, 0xDD, 0x9F, 0x87, 0x04, 0xB7, 0xC8,
+    0xF1, 0xCC, 0xF5, 0xEA, 0xFB, 0xF2, 0x6F, 0x37, 0x6D, 0xD7, 0x25, 0x4F, 0x57, 0xE6, 0xC4, 0x32,
+    0xDB, 0x31, 0x67, 0x4F, 0x96, 0x16, 0xFF, 0x32, 0x97, 0xA8, 0x84, 0xFF, 0x13, 0x01, 0x8B, 0x8E,
+    0x5E, 0xC5, 0xF3, 0xA6, 0x23, 0xB9, 0xCD, 0x17, 0x9F, 0x90, 0x3C, 0x73, 0x8B, 0x73, 0x8A, 0x99,
+    0x33, 0xAB, 0x55, 0xF3, 0xFD, 0xFD, 0xDE, 0x7C, 0xF4, 0x30, 0x48, 0x9A, 0x15, 0xB1, 0x6E, 0xDC,
+    0x62, 0x77, 0x4E, 0x2A, 0x6E, 0xBB, 0x9D, 0x73, 0xA7, 0x71, 0x66, 0x4D, 0x7E, 0x78, 0x33, 0xEF,
+    0xFA, 0xB9, 0xA6, 0x9A, 0x15, 0x6F, 0xE3, 0x4B, 0x9A, 0xA5, 0x28, 0xFE, 0x8C, 0x37, 0xAE, 0xC9,
+    0xCC, 0x0D, 0x66, 0x67, 0x99, 0x75, 0xC9, 0xBC, 0xBC, 0x74, 0x98, 0x37, 0xFF, 0x2A, 0x0C, 0x85,
+    0xA4, 0x80, 0x99, 0xBB, 0xAF, 0xBF, 0x6C, 0x65, 0x26, 0x09, 0xAC, 0x7C, 0x72, 0xEB, 0x3C, 0x65,
+    0x67, 0xB3, 0xF1, 0xEE, 0x9D, 0x39, 0x9E, 0x2D, 0x0A, 0xD3, 0x15, 0x9B, 0xE7, 0x11, 0x1F, 0x39,
+    0x81, 0x38, 0xF4, 0xF8, 0x14, 0x44, 0x19, 0x78, 0x0E, 0xB4, 0xD8, 0xD5, 0x25, 0xDB, 0x1F, 0xA7,
+    0xC4, 0x9F, 0xF5, 0x68, 0x69, 0xF0, 0x5F, 0x1E, 0x1A, 0x15, 0x26, 0x90, 0xF7, 0x0C, 0x52, 0x62,
+    0xD9, 0x02, 0xAB, 0x80, 0xBA, 0x9F, 0x21, 0xEC, 0x93, 0x83, 0x81, 0x43, 0x25, 0xC1, 0x4C, 0xB0,
+    0x22, 0x4C, 0x58, 0x58, 0xCE, 0xD6, 0x06, 0x4E, 0xBF, 0x90, 0xF0, 0xFF, 0xEE, 0x66, 0xAD, 0x74,
+    0x45, 0xEC, 0x2E, 0xA3, 0x37, 0x70, 0xEA, 0x9D, 0x04, 0x9F, 0xEC, 0x66, 0x72, 0xBC, 0x82, 0xF6,
+    0x32, 0x84, 0x77, 0xA8, 0x4D, 0xF6, 0x59, 0x08, 0x26, 0x5D, 0x81, 0x58, 0x26, 0x7D, 0x74, 0x30,
+    0x7D, 0x46, 0xFB, 0xE8, 0x07, 0x57, 0xCB, 0xCE, 0x08, 0x42, 0x42, 0xDE, 0x6B, 0x27, 0x98, 0x54,
+    0x83, 0x78, 0xF3, 0x3D, 0x4D, 0x4C, 0x14, 0xE8, 0xD5, 0x20, 0x6F, 0x3A, 0xF4, 0x52, 0x88, 0xDB,
+    0x16, 0x0D, 0x82, 0x4E, 0x9E, 0x78, 0xF0, 0xA5, 0x87, 0x5A, 0x28, 0x30, 0x0A, 0x4E, 0xB8, 0x32,
+    0xA0, 0x08, 0x98, 0x24, 0x48, 0x62, 0x24, 0x27, 0xF4, 0xF3, 0xF0, 0x23, 0xC8, 0x30, 0x46, 0xED,
+    0x6A, 0x07, 0xC3, 0x69, 0x28, 0xE1, 0x98, 0x66, 0x7C, 0x79, 0x8B, 0x36, 0xE5, 0xFE, 0x93, 0xA7,
+    0x5F, 0x80, 0xD3, 0x56, 0xE9, 0x4E, 0x95, 0x0B, 0xD1, 0x19, 0xA1, 0x21, 0x69, 0x93, 0xCE, 0x03,
+    0x9D, 0x99, 0x4C, 0x9D, 0xAF, 0x5D, 0x81, 0xA6, 0x6D, 0xA7, 0x0F, 0xAE, 0x00, 0x7E, 0x8A, 0x56,
+    0x52, 0x05, 0xB5, 0x43, 0xC8, 0xA2, 0xD1, 0x89, 0x58, 0x50, 0x20, 0x11, 0x20, 0x6E, 0x60, 0x7C,
+    0xF3, 0x8D, 0x0D, 0xFE, 0x59, 0x68, 0x07, 0xFC, 0xFF, 0xBD, 0x70, 0xD9, 0xB5, 0xCD, 0x08, 0x45,
+    0x2D, 0x6B, 0x98, 0x96, 0xB4, 0xDA, 0xEA, 0x4B, 0xB9, 0x74, 0xC2, 0x16, 0xC2, 0x33, 0x9F, 0xF2,
+    0x31, 0xB6, 0x6A, 0x98, 0x50, 0xF0, 0x59, 0x30, 0x5A, 0xB8, 0xD7, 0x2C, 0x11, 0xD2, 0x8C, 0x2B,
+    0x49, 0x0F, 0x5B, 0x98, 0x8F, 0x0E, 0x75, 0x49, 0x61, 0x89, 0xB7, 0x07, 0xCF, 0x0B, 0x91, 0x69,
+    0x57, 0x45, 0x3B, 0x1B, 0xB2, 0x9F, 0x84, 0x55, 0x3D, 0xCD, 0xB6, 0x0F, 0xB7, 0x97, 0x43, 0x18,
+    0x8B, 0x5B, 0xCB, 0xA8, 0xCE, 0xA7, 0x32, 0x84, 0xC9, 0x85, 0xFB, 0x47, 0x77, 0xB5, 0xF8, 0x11,
+    0x4D, 0x3D, 0x60, 0x79, 0xDB, 0x2A, 0x02, 0x90, 0xF2, 0x7D, 0x78, 0x49, 0x19, 0x1B, 0x6D, 0x90,
+    0xCB, 0x40, 0x59, 0xF1, 0xFD, 0xE8, 0x9B, 0xE0, 0xE6, 0x14, 0x7B, 0x1D, 0x45, 0x57, 0x38, 0xAD,
+    0x69, 0xDF, 0xFF, 0xEE, 0x49, 0xBB, 0x1D, 0xFC, 0x28, 0x5C, 0xBE, 0xA3, 0x88, 0x3D, 0x14, 0x14,
+    0x2C, 0x61, 0x18, 0x32, 0x4F, 0x49, 0xAA, 0xD3, 0x39, 0xCA, 0xBB, 0x8E, 0x79, 0x39, 0x5C, 0xB2,
+    0x50, 0xC5, 0x09, 0xA9, 0x31, 0xF6, 0x76, 0x88, 0x49, 0x14, 0x3E, 0xB6, 0x9D, 0x92, 0x14, 0xCD,
+    0xAF, 0x63, 0x28, 0x3E, 0x0B, 0xB6, 0xC5, 0x1E, 0x7C, 0xBB, 0xA1, 0x71, 0xE0, 0x21, 0xFF, 0x3D,
+    0xEE, 0x51, 0xD2, 0xF7, 0xE9, 0xCE, 0xC9, 0x3E, 0x2F, 0x90, 0xD6, 0xD0, 0xC8, 0x34, 0x35, 0x91,
+    0x22, 0xD2, 0x5E, 0xE7, 0xF9, 0x02, 0x5D, 0x57, 0xA8, 0x4C, 0xE4, 0x29, 0x7B, 0xB0, 0x47, 0x55,
+    0x9F, 0x8E, 0xA6, 0xA4, 0xD3, 0x74, 0xCA, 0xDC, 0x2A, 0x79, 0x96, 0xD9, 0x58, 0xD8, 0x95, 0x8A,
+    0x1D, 0xAA, 0x4B, 0x5F, 0x6B, 0x0C, 0x9F, 0xB3, 0xB9, 0xBA, 0x7C, 0x6D, 0x01, 0x83, 0x7F, 0xED,
+    0x5A, 0xA2, 0x23, 0xCC, 0x1C, 0x1D, 0xFD, 0xBC, 0xA9, 0xD3, 0xD4, 0xE3, 0xC1, 0xFA, 0x07, 0xD0,
+    0xDD, 0xE7, 0x2C, 0x7E, 0x16, 0x5B, 0xD0, 0xC4, 0x03, 0xC6, 0x04, 0x4E, 0x67, 0x17, 0x81, 0x22,
+    0x8A, 0xA7, 0x3F, 0x31, 0x8A, 0x40, 0x17, 0xC2, 0x6A, 0xE2, 0xDD, 0x0B, 0xCB, 0xDD, 0x2A, 0xCB,
+    0x3B, 0x2B, 0x0B, 0x18, 0xA6, 0x0B, 0x74, 0x73, 0x55, 0x2D, 0x59, 0xAD, 0xD6, 0x77, 0xBC, 0x7C,
+    0xCB, 0x79, 0x5A, 0xF1, 0xAB, 0xBF, 0xAD, 0x10, 0x62, 0xAD, 0x96, 0x76, 0x72, 0xB9, 0x6E, 0x3B,
+    0x43, 0xEE, 0x3C, 0xE5, 0xA3, 0x48, 0xB1, 0x46, 0xE1, 0x7C, 0x34, 0xA1, 0x3E, 0x1A, 0x0E, 0x4E,
+    0xF8, 0x02, 0x65, 0x96, 0xD2, 0xED, 0x4B, 0x49, 0x46, 0x71, 0xF0, 0xCD, 0x1E, 0x54, 0x78, 0x05,
+    0x2A, 0x1F, 0x19, 0xE9, 0x34, 0xB5, 0x67, 0xEE, 0x69, 0x7A, 0x8B, 0xF6, 0x2E, 0xD0, 0x5E, 0x6D,
+    0x54, 0x46, 0x3D, 0xDB, 0x11, 0xCE, 0x2D, 0xB6, 0x8F, 0x06, 0x3B, 0x86, 0x38, 0xFA, 0x0F, 0x41,
+    0xA5, 0x2A, 0x78, 0xF4, 0xD4, 0x48, 0xCF, 0x8A, 0xF4, 0xF9, 0xBB, 0x88, 0x05, 0x39, 0xD7, 0xEE,
+    0x1C, 0x1A, 0x27, 0x77, 0x52, 0x55, 0x45, 0xB1, 0xD6, 0xA2, 0xB6, 0xEF, 0x75, 0xCA, 0x1A, 0x68,
+    0x07, 0x57, 0x5A, 0x7C, 0x2F, 0x8D, 0x08, 0x63, 0x91, 0xBC, 0x40, 0x1D, 0xBF, 0x71, 0x3C, 0x75,
+    0x95, 0x12, 0x82, 0x2A, 0x79, 0x51, 0x59, 0x03, 0xC2, 0x91, 0x37, 0x4F, 0xD6, 0x23, 0xAB, 0x93,
+    0xE9, 0x57, 0x4B, 0xC9, 0xDB, 0xC7, 0xC3, 0x64, 0x13, 0x6B, 0x14, 0x56, 0x5D, 0x5A, 0xC2, 0x4B,
+    0xB7, 0xDB, 0xC6, 0x54, 0x15, 0x51, 0xB2, 0x75, 0xCA, 0xA4, 0x36, 0xE4, 0xBD, 0x16, 0xC2, 0x77,
+    0x81, 0x90, 0xC6, 0xC2, 0x22, 0x06, 0x6B, 0x67, 0xC0, 0xF7, 0x2C, 0xDA, 0x39, 0x44, 0x01, 0x46,
+    0xB9, 0x08, 0xB7, 0xD0, 0x1A, 0x91, 0x92, 0x72, 0x90, 0x0A, 0xE8, 0x0F, 0x02, 0xDB, 0x1E, 0xA7,
+    0xC9, 0x6B, 0x24, 0xE6, 0xB7, 0x0A, 0xBD, 0x10, 0x36, 0x4A, 0x5D, 0xC5, 0xDC, 0x9D, 0x43, 0x3F,
+    0x4E, 0x75, 0x74, 0xCC, 0x44, 0xBC, 0x8E, 0xC6, 0x58, 0x8A, 0xD4, 0xB6, 0xCB, 0xA2, 0x8C, 0xA3,
+    0x70, 0xE5, 0x68, 0x99, 0x67, 0xA4, 0x41, 0x9E, 0xF7, 0xBD, 0xCC, 0x84, 0x3B, 0x18, 0x2B, 0xA3,
+    0x76, 0xF3, 0x96, 0x36, 0x7A, 0xC9, 0x52, 0xB7, 0x7B, 0x93, 0x44, 0x54, 0x9B, 0x19, 0xAB, 0xEC,
+    0xD3, 0x46, 0xC8, 0xF5, 0x5E, 0xD1, 0x38, 0x80, 0x1E, 0xB9, 0x47, 0xA5, 0x16, 0xCB, 0x9F, 0x9E,
+    0x85, 0x72, 0x6C, 0x9D, 0xE4, 0xE5, 0x11, 0x9B, 0x53, 0x25, 0x52, 0x7E, 0x35, 0xA5, 0x8D, 0x94,
+    0x80, 0xB4, 0x42, 0x46, 0x27, 0x9A, 0x09, 0x59, 0x93, 0xDE, 0xE9, 0xFE, 0x16, 0xA1, 0x6A, 0x13,
+    0xCA, 0xC6, 0x94, 0xFE, 0xA7, 0xDF, 0x24, 0xA4, 0x01, 0xFC, 0xE8, 0x73, 0xC8, 0x1B, 0x2F, 0x42,
+    0x57, 0x95, 0x59, 0x78, 0x22, 0x76, 0xAB, 0x47, 0x16, 0x53, 0x44, 0x7D, 0x87, 0xFE, 0x88, 0x21,
+    0x89, 0x92, 0x3E, 0xB9, 0x1F, 0x51, 0x29, 0x15, 0xCA, 0x9E, 0x7E, 0xF8, 0xD2, 0x1D, 0x4D, 0xB5,
+    0xCD, 0x72, 0x12, 0x27, 0xD9, 0x53, 0x87, 0x37, 0xF2, 0xA7, 0xEE, 0xDF, 0xD8, 0x94, 0xF6, 0x22,
+    0xD4, 0xDE, 0x98, 0x64, 0xE0, 0xFE, 0xD0, 0xB9, 0xEA, 0x27, 0x90, 0xA7, 0x80, 0x7F, 0x05, 0x4D,
+    0x93, 0x3F, 0x6F, 0x1D, 0x45, 0x14, 0xC5, 0xCF, 0xEE, 0x04, 0xAF, 0xE5, 0x85, 0x37, 0x11, 0x05,
+    0x89, 0x90, 0x61, 0xA9, 0x01, 0xBD, 0x6D, 0x52, 0x58, 0xC9, 0x6E, 0x76, 0x49, 0x43, 0x4B, 0x91,
+    0x40, 0x41, 0xC1, 0x07, 0x00, 0xC9, 0x16, 0x72, 0x83, 0xF4, 0x22, 0xAF, 0xD3, 0xA4, 0xA0, 0xC0,
+    0x4A, 0xEB, 0x86, 0x32, 0x32, 0x48, 0x71, 0x83, 0xF4, 0x8A, 0xA7, 0xBC, 0x31, 0x48, 0x50, 0xA4,
+    0x59, 0xE0, 0x03, 0xB0, 0x89, 0x48, 0x81, 0x5D, 0x30, 0x52, 0xC6, 0xB0, 0x89, 0x9E, 0xF7, 0x72,
+    0x66, 0x9E, 0x15, 0xB1, 0xDA, 0x19, 0xCD, 0xCE, 0x9F, 0x73, 0xCF, 0xFD, 0xCD, 0x5D, 0xE0, 0x35,
+    0x20, 0x16, 0x87, 0x5C, 0xCE, 0x30, 0x14, 0x97, 0x63, 0xB7, 0x81, 0xA4, 0xDD, 0x86, 0x6E, 0xB6,
+    0x90, 0xE1, 0x10, 0x39, 0x3A, 0x94, 0x78, 0x7A, 0xB3, 0x8C, 0xC4, 0x15, 0xF1, 0xB1, 0x2B, 0x94,
+    0xB1, 0xA5, 0xDA, 0xB5, 0xD7, 0xD5, 0x8D, 0x2E, 0x4F, 0x54, 0xAB, 0x1F, 0x29, 0x93, 0xC8, 0xDC,
+    0x60, 0x3E, 0xD4, 0x78, 0x1B, 0xC0, 0x3A, 0x1B, 0x4F, 0x03, 0x89, 0x05, 0xD4, 0x82, 0xE2, 0x7F,
+    0x73, 0xE2, 0x99, 0x01, 0xA6, 0x0E, 0xB8, 0x3D, 0x86, 0x16, 0x91, 0x68, 0xF3, 0xE3, 0xD3, 0x5A,
+    0x37, 0x13, 0x7C, 0x7E, 0xFC, 0xE0, 0xDB, 0x4A, 0x64, 0x11, 0x59, 0x58, 0x38, 0x46, 0x9A, 0x21,
+    0xAD, 0x4B, 0xC4, 0x5D, 0xCE, 0xFD, 0xBA, 0xA6, 0x85, 0xF0, 0x6C, 0xF6, 0x50, 0xB2, 0xC0, 0x2B,
+    0xA0, 0x5E, 0xE4, 0x75, 0x29, 0x97, 0xC5, 0x07, 0x07, 0x43, 0x26, 0xD2, 0x23, 0x77, 0x48, 0xCF,
+    0xBC, 0xEE, 0x22, 0x3F, 0x3E, 0xD8, 0x9B, 0x30, 0x24, 0xB7, 0x24, 0x7E, 0x4B, 0x73, 0x01, 0xF9,
+    0x89, 0x65, 0x6E, 0xCD, 0x52, 0x87, 0xB9, 0xA6, 0xD2, 0xC4, 0x22, 0x4D, 0xF5, 0xCD, 0x6A, 0x6C,
+    0x37, 0x90, 0xD5, 0x2D, 0xFA, 0x84, 0x9B, 0xDF, 0x0F, 0x99, 0xF6, 0xAA, 0x51, 0xED, 0x5B, 0xD0,
+    0x4C, 0xBC, 0x88, 0x0D, 0xDC, 0x08, 0xAA, 0xBB, 0x82, 0xF4, 0xA8, 0x85, 0x7E, 0x44, 0x39, 0xC6,
+    0xCA, 0xA4, 0x45, 0xD2, 0x2C, 0xD3, 0xBC, 0x18, 0x01, 0x5B, 0x29, 0x60, 0x35, 0xE2, 0xD3, 0xCD,
+    0x9B, 0x39, 0x0D, 0x24, 0x4F, 0x6F, 0x7F, 0xA4, 0x4C, 0x41, 0xC1, 0x09, 0xD2, 0x66, 0xCA, 0xE6,
+    0xA0, 0x6B, 0x4B, 0x45, 0x8B, 0x8C, 0xCE, 0xC7, 0x31, 0x71, 0xB2, 0x15, 0xD1, 0x8B, 0xA6, 0xC0,
+    0xFC, 0xDC, 0x56, 0x78, 0xE6, 0x3D, 0x50, 0x49, 0x07, 0xDD, 0x5E, 0x0E, 0x39, 0xD2, 0xD0, 0x32,
+    0x13, 0x9A, 0x64, 0x37, 0x60, 0x89, 0x13, 0xA9, 0xF3, 0x80, 0x5B, 0x76, 0x55, 0xF4, 0xE4, 0xDE,
+    0xAE, 0xBD, 0xB6, 0xBF, 0x9F, 0xA9, 0xED, 0xED, 0x2F, 0xBB, 0x2A, 0x59, 0x9B, 0x44, 0xCF, 0x3B,
+    0xA9, 0x47, 0xCC, 0x0F, 0xE6, 0x57, 0x83, 0x57, 0xD7, 0xD7, 0xBD, 0x6B, 0xF9, 0x91, 0xCE, 0xCE,
+    0xA3, 0x10, 0xF6, 0x87, 0x22, 0x96, 0xA4, 0x03, 0x44, 0xC2, 0x4A, 0x69, 0x82, 0x92, 0x7A, 0x49,
+    0x96, 0xC0, 0x69, 0xEF, 0xFF, 0xCB, 0x22, 0x37, 0x44, 0x8C, 0x5F, 0x1B, 0xE3, 0xCD, 0x07, 0x7F,
+    0x11, 0x73, 0x0D, 0x5A, 0x9D, 0xE1, 0x8D, 0x33, 0xE4, 0x7D, 0xE0, 0xEC, 0xFC, 0x5A, 0x38, 0x30,
+    0x0D, 0x42, 0xAA, 0x0B, 0x47, 0x51, 0x2C, 0xAF, 0x61, 0xBA, 0x02, 0xBD, 0xDF, 0x41, 0xDA, 0x88,
+    0x47, 0xAF, 0xDA, 0x2F, 0x90, 0xCF, 0xEB, 0xE4, 0x0C, 0x09, 0x3D, 0x7D, 0x62, 0xE2, 0x76, 0x82,
+    0x22, 0x6D, 0x12, 0xE3, 0xE0, 0x34, 0x53, 0xB2, 0x99, 0xC9, 0xA5, 0x8B, 0xE5, 0xCF, 0x97, 0x60,
+    0x7C, 0xAE, 0x25, 0xC3, 0x6F, 0x6D, 0x03, 0x87, 0x6C, 0x5F, 0xFD, 0x70, 0xCB, 0xA7, 0xE1, 0x56,
+    0x5E, 0x1C, 0xCC, 0x78, 0x67, 0xA3, 0xA8, 0xC5, 0x5A, 0xFC, 0xD3, 0xEA, 0x9A, 0xFA, 0x63, 0x3E,
+    0x52, 0xFF, 0xFC, 0xFB, 0xBD, 0x32, 0xBB, 0x4E, 0x33, 0xEC, 0x35, 0xB6, 0xD7, 0x3B, 0x8F, 0x6E,
+    0x06, 0xEC, 0xF4, 0xE7, 0x6A, 0x91, 0x9F, 0xD1, 0x9E, 0x68, 0xE9, 0x3F, 0x3D, 0x5F, 0xEF, 0x31,
+    0xDA, 0xA9, 0x11, 0x89, 0xFF, 0x0F, 0x4E, 0x4E, 0x5C, 0xEC, 0xB2, 0xD8, 0xEA, 0x7A, 0xA2, 0xCC,
+    0x24, 0xEE, 0xB4, 0xEA, 0x74, 0x5D, 0xF0, 0x8D, 0x6C, 0x01, 0x9B, 0x1E, 0x79, 0x10, 0x81, 0x59,
+    0x60, 0xE4, 0x02, 0x32, 0x2D, 0x7B, 0xE4, 0xBC, 0x20, 0x85, 0x87, 0x94, 0xCD, 0x99, 0x78, 0x46,
+    0x00, 0x19, 0x71, 0x8C, 0x09, 0x67, 0x02, 0x77, 0xC9, 0xF1, 0x1A, 0xDA, 0x4C, 0xEE, 0x07, 0xBA,
+    0xAA, 0xF5, 0x17, 0xD1, 0xE2, 0xBD, 0xE3, 0x26, 0x04, 0xF7, 0x72, 0xC1, 0x12, 0xA2, 0x0B, 0x5C,
+    0xBD, 0xCB, 0xC1, 0x63, 0x4E, 0xCF, 0x1D, 0x7C, 0xA9, 0x2A, 0x19, 0xED, 0xA9, 0x67, 0x77, 0x59,
+    0x0B, 0xBF, 0xB1, 0x24, 0xAF, 0x1C, 0x62, 0xB6, 0xBE, 0x81, 0x72, 0x65, 0x35, 0x1C, 0xF1, 0xD0,
+    0x43, 0x12, 0xC5, 0x79, 0x5A, 0xA1, 0x74, 0xAE, 0xFB, 0xD2, 0xA1, 0x35, 0xFE, 0x6A, 0x86, 0xA8,
+    0xBA, 0x20, 0x1C, 0xFF, 0x02, 0x3C, 0x31, 0x4A, 0xBA, 0x48, 0x06, 0x4C, 0xD3, 0xB6, 0x44, 0xAF,
+    0x31, 0x4E, 0x4C, 0x7A, 0xA7, 0x4B, 0xCC, 0xF3, 0x4F, 0xDB, 0x4A, 0x1A, 0xFD, 0x9D, 0x4B, 0x4C,
+    0x16, 0x77, 0xAA, 0x75, 0xE8, 0x0B, 0x94, 0x1A, 0x19, 0xBF, 0xEF, 0xD0, 0x84, 0x0C, 0xB5, 0xFA,
+    0x1A, 0xF8, 0xBD, 0xC1, 0xC5, 0x1A, 0xEF, 0xDE, 0x97, 0xC7, 0xB7, 0x7C, 0x3D, 0x2E, 0x4B, 0xCA,
+    0x77, 0x4A, 0x96, 0xD5, 0x15, 0x86, 0x12, 0xE8, 0xE6, 0xA1, 0x10, 0xD8, 0x57, 0x3F, 0xB7, 0x3B,
+    0x7E, 0xF6, 0x48, 0xB8, 0x61, 0x48, 0x84, 0xC3, 0xAE, 0x92, 0x5C, 0x06, 0x25, 0x43, 0x25, 0x36,
+    0xBC, 0x8C, 0xC1, 0xC5, 0xCF, 0x58, 0x99, 0xF4, 0xCB, 0xF3, 0xD5, 0x29, 0x87, 0xA8, 0x3E, 0x08,
+    0x52, 0x49, 0xC8, 0x69, 0x1E, 0x22, 0xD8, 0x97, 0x21, 0xF1, 0x0E, 0xDB, 0x7F,
+};
+
+static const uint32_t notosans_12_italicBlockOffsets[26] = {
+    0, 1247, 2437, 3741, 4747, 5651, 6686, 7668,
+    8708, 9761, 10680, 11894, 13175, 14253, 15496, 16815,
+    18094, 19280, 20492, 21526, 22661, 23613, 24764, 25905,
+    27343, 28157,
+};
+
+static const uint16_t notosans_12_italicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_12_italicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_12_italicPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 876, 0, 0,
 };
 
 static const EpdGlyph notosans_12_italicGlyphs[] = {
@@ -3143,841 +1962,841 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 15, 18, 17, 1, 18, 68, 1819 }, // D
     { 13, 18, 13, 1, 18, 59, 1887 }, // E
     { 13, 18, 12, 1, 18, 59, 1946 }, // F
-    { 16, 20, 17, 1, 19, 80, 2005 }, // G
-    { 17, 18, 17, 1, 18, 77, 2085 }, // H
-    { 11, 18, 8, -1, 18, 50, 2162 }, // I
-    { 12, 23, 7, -4, 18, 69, 2212 }, // J
-    { 16, 18, 14, 1, 18, 72, 2281 }, // K
-    { 10, 18, 12, 1, 18, 45, 2353 }, // L
-    { 21, 18, 21, 1, 18, 95, 2398 }, // M
-    { 17, 18, 18, 1, 18, 77, 2493 }, // N
-    { 17, 20, 18, 1, 19, 85, 2570 }, // O
-    { 14, 18, 14, 1, 18, 63, 2655 }, // P
-    { 17, 24, 18, 1, 19, 102, 2718 }, // Q
-    { 14, 18, 14, 1, 18, 63, 2820 }, // R
-    { 13, 20, 13, 0, 19, 65, 2883 }, // S
-    { 13, 18, 13, 2, 18, 59, 2948 }, // T
-    { 17, 19, 17, 1, 18, 81, 3007 }, // U
-    { 15, 18, 14, 2, 18, 68, 3088 }, // V
-    { 22, 18, 21, 2, 18, 99, 3156 }, // W
-    { 18, 18, 13, -2, 18, 81, 3255 }, // X
-    { 14, 18, 13, 2, 18, 63, 3336 }, // Y
-    { 16, 18, 13, -1, 18, 72, 3399 }, // Z
-    { 11, 22, 7, -1, 18, 61, 3471 }, // [
-    { 6, 18, 9, 2, 18, 27, 3532 }, // <backslash>
-    { 10, 22, 7, -2, 18, 55, 3559 }, // ]
-    { 14, 12, 14, 0, 18, 42, 3614 }, // ^
-    { 11, 2, 10, -3, -2, 6, 3656 }, // _
-    { 5, 5, 7, 3, 20, 7, 3662 }, // `
-    { 13, 15, 14, 1, 14, 49, 3669 }, // a
-    { 14, 20, 14, 0, 19, 70, 3718 }, // b
-    { 11, 15, 11, 1, 14, 42, 3788 }, // c
-    { 14, 20, 14, 1, 19, 70, 3830 }, // d
-    { 11, 15, 12, 1, 14, 42, 3900 }, // e
-    { 15, 26, 8, -3, 20, 98, 3942 }, // f
-    { 14, 20, 14, 0, 14, 70, 4040 }, // g
-    { 14, 19, 14, 0, 19, 67, 4110 }, // h
-    { 7, 19, 6, 0, 19, 34, 4177 }, // i
-    { 11, 25, 6, -4, 19, 69, 4211 }, // j
-    { 14, 19, 12, 0, 19, 67, 4280 }, // k
-    { 7, 19, 6, 0, 19, 34, 4347 }, // l
-    { 21, 14, 22, 0, 14, 74, 4381 }, // m
-    { 14, 14, 14, 0, 14, 49, 4455 }, // n
-    { 12, 15, 14, 1, 14, 45, 4504 }, // o
-    { 15, 20, 14, -1, 14, 75, 4549 }, // p
-    { 13, 20, 14, 1, 14, 65, 4624 }, // q
-    { 11, 14, 10, 0, 14, 39, 4689 }, // r
-    { 11, 15, 11, 0, 14, 42, 4728 }, // s
-    { 9, 18, 8, 1, 17, 41, 4770 }, // t
-    { 13, 15, 14, 1, 14, 49, 4811 }, // u
-    { 12, 14, 12, 1, 14, 42, 4860 }, // v
-    { 19, 14, 18, 1, 14, 67, 4902 }, // w
-    { 14, 14, 12, -1, 14, 49, 4969 }, // x
-    { 16, 20, 12, -3, 14, 80, 5018 }, // y
-    { 12, 14, 11, -1, 14, 42, 5098 }, // z
-    { 10, 22, 9, 0, 18, 55, 5140 }, // {
-    { 3, 26, 14, 6, 19, 20, 5195 }, // |
-    { 10, 22, 9, -1, 18, 55, 5215 }, // }
-    { 13, 4, 14, 1, 11, 13, 5270 }, // ~
-    { 0, 0, 7, 0, 0, 0, 5283 }, //  
-    { 8, 19, 7, -1, 14, 38, 5283 }, // ¡
-    { 12, 20, 14, 2, 19, 60, 5321 }, // ¢
-    { 16, 19, 14, -1, 19, 76, 5381 }, // £
-    { 11, 12, 14, 2, 15, 33, 5457 }, // ¤
-    { 15, 18, 14, 1, 18, 68, 5490 }, // ¥
-    { 3, 26, 14, 6, 19, 20, 5558 }, // ¦
-    { 13, 21, 12, 0, 20, 69, 5578 }, // §
-    { 8, 4, 14, 5, 19, 8, 5647 }, // ¨
-    { 19, 20, 21, 1, 19, 95, 5655 }, // ©
-    { 8, 10, 8, 2, 19, 20, 5750 }, // ª
-    { 11, 11, 12, 1, 12, 31, 5770 }, // «
-    { 13, 7, 14, 1, 10, 23, 5801 }, // ¬
-    { 7, 3, 8, 0, 8, 6, 5824 }, // ­
-    { 19, 20, 21, 1, 19, 95, 5830 }, // ®
-    { 11, 2, 10, 2, 21, 6, 5925 }, // ¯
-    { 9, 9, 11, 1, 19, 21, 5931 }, // °
-    { 13, 15, 14, 1, 15, 49, 5952 }, // ±
-    { 9, 12, 9, 1, 22, 27, 6001 }, // ²
-    { 8, 12, 9, 2, 22, 24, 6028 }, // ³
-    { 7, 5, 7, 2, 20, 9, 6052 }, // ´
-    { 15, 20, 15, -1, 14, 75, 6061 }, // µ
-    { 13, 23, 16, 2, 19, 75, 6136 }, // ¶
-    { 4, 5, 6, 2, 11, 5, 6211 }, // ·
-    { 6, 6, 5, -3, 0, 9, 6216 }, // ¸
-    { 6, 12, 9, 3, 22, 18, 6225 }, // ¹
-    { 8, 10, 8, 2, 19, 20, 6243 }, // º
-    { 11, 11, 12, 0, 12, 31, 6263 }, // »
-    { 16, 19, 18, 2, 19, 76, 6294 }, // ¼
-    { 18, 19, 20, 2, 19, 86, 6370 }, // ½
-    { 18, 19, 20, 1, 19, 86, 6456 }, // ¾
-    { 10, 19, 11, -1, 14, 48, 6542 }, // ¿
-    { 15, 24, 14, -2, 24, 90, 6590 }, // À
-    { 16, 24, 14, -2, 24, 96, 6680 }, // Á
-    { 16, 24, 14, -2, 24, 96, 6776 }, // Â
-    { 17, 23, 14, -2, 23, 98, 6872 }, // Ã
-    { 16, 23, 14, -2, 23, 92, 6970 }, // Ä
-    { 15, 25, 14, -2, 25, 94, 7062 }, // Å
-    { 24, 18, 21, -2, 18, 108, 7156 }, // Æ
-    { 15, 25, 15, 1, 19, 94, 7264 }, // Ç
-    { 13, 24, 13, 1, 24, 78, 7358 }, // È
-    { 13, 24, 13, 1, 24, 78, 7436 }, // É
-    { 13, 24, 13, 1, 24, 78, 7514 }, // Ê
-    { 13, 23, 13, 1, 23, 75, 7592 }, // Ë
-    { 11, 24, 8, -1, 24, 66, 7667 }, // Ì
-    { 12, 24, 8, -1, 24, 72, 7733 }, // Í
-    { 12, 24, 8, -1, 24, 72, 7805 }, // Î
-    { 12, 23, 8, -1, 23, 69, 7877 }, // Ï
-    { 16, 18, 17, 0, 18, 72, 7946 }, // Ð
-    { 17, 23, 18, 1, 23, 98, 8018 }, // Ñ
-    { 17, 25, 18, 1, 24, 107, 8116 }, // Ò
-    { 17, 25, 18, 1, 24, 107, 8223 }, // Ó
-    { 17, 25, 18, 1, 24, 107, 8330 }, // Ô
-    { 17, 24, 18, 1, 23, 102, 8437 }, // Õ
-    { 17, 24, 18, 1, 23, 102, 8539 }, // Ö
-    { 12, 12, 14, 2, 15, 36, 8641 }, // ×
-    { 17, 21, 18, 1, 19, 90, 8677 }, // Ø
-    { 17, 25, 17, 1, 24, 107, 8767 }, // Ù
-    { 17, 25, 17, 1, 24, 107, 8874 }, // Ú
-    { 17, 25, 17, 1, 24, 107, 8981 }, // Û
-    { 17, 24, 17, 1, 23, 102, 9088 }, // Ü
-    { 14, 24, 13, 2, 24, 84, 9190 }, // Ý
-    { 13, 18, 14, 1, 18, 59, 9274 }, // Þ
-    { 18, 26, 15, -4, 20, 117, 9333 }, // ß
-    { 13, 21, 14, 1, 20, 69, 9450 }, // à
-    { 13, 21, 14, 1, 20, 69, 9519 }, // á
-    { 13, 21, 14, 1, 20, 69, 9588 }, // â
-    { 13, 20, 14, 1, 19, 65, 9657 }, // ã
-    { 13, 20, 14, 1, 19, 65, 9722 }, // ä
-    { 13, 22, 14, 1, 21, 72, 9787 }, // å
-    { 19, 15, 21, 1, 14, 72, 9859 }, // æ
-    { 11, 20, 11, 1, 14, 55, 9931 }, // ç
-    { 11, 21, 12, 1, 20, 58, 9986 }, // è
-    { 12, 21, 12, 1, 20, 63, 10044 }, // é
-    { 11, 21, 12, 1, 20, 58, 10107 }, // ê
-    { 11, 20, 12, 1, 19, 55, 10165 }, // ë
-    { 7, 20, 6, 0, 20, 35, 10220 }, // ì
-    { 9, 20, 6, 0, 20, 45, 10255 }, // í
-    { 9, 20, 6, 0, 20, 45, 10300 }, // î
-    { 9, 19, 6, 0, 19, 43, 10345 }, // ï
-    { 13, 21, 14, 1, 20, 69, 10388 }, // ð
-    { 14, 19, 14, 0, 19, 67, 10457 }, // ñ
-    { 12, 21, 14, 1, 20, 63, 10524 }, // ò
-    { 12, 21, 14, 1, 20, 63, 10587 }, // ó
-    { 12, 21, 14, 1, 20, 63, 10650 }, // ô
-    { 13, 20, 14, 1, 19, 65, 10713 }, // õ
-    { 12, 20, 14, 1, 19, 60, 10778 }, // ö
-    { 13, 12, 14, 1, 15, 39, 10838 }, // ÷
-    { 14, 16, 14, 0, 15, 56, 10877 }, // ø
-    { 13, 21, 14, 1, 20, 69, 10933 }, // ù
-    { 13, 21, 14, 1, 20, 69, 11002 }, // ú
-    { 13, 21, 14, 1, 20, 69, 11071 }, // û
-    { 13, 20, 14, 1, 19, 65, 11140 }, // ü
-    { 16, 26, 12, -3, 20, 104, 11205 }, // ý
-    { 15, 25, 14, -1, 19, 94, 11309 }, // þ
-    { 16, 25, 12, -3, 19, 100, 11403 }, // ÿ
-    { 16, 21, 14, -2, 21, 84, 11503 }, // Ā
-    { 13, 18, 14, 1, 17, 59, 11587 }, // ā
-    { 16, 23, 14, -2, 23, 92, 11646 }, // Ă
-    { 13, 20, 14, 1, 19, 65, 11738 }, // ă
-    { 15, 24, 14, -2, 18, 90, 11803 }, // Ą
-    { 13, 20, 14, 1, 14, 65, 11893 }, // ą
-    { 15, 25, 15, 1, 24, 94, 11958 }, // Ć
-    { 11, 21, 11, 1, 20, 58, 12052 }, // ć
-    { 15, 25, 15, 1, 24, 94, 12110 }, // Ĉ
-    { 11, 21, 11, 1, 20, 58, 12204 }, // ĉ
-    { 15, 24, 15, 1, 23, 90, 12262 }, // Ċ
-    { 11, 20, 11, 1, 19, 55, 12352 }, // ċ
-    { 15, 25, 15, 1, 24, 94, 12407 }, // Č
-    { 12, 21, 11, 1, 20, 63, 12501 }, // č
-    { 15, 24, 17, 1, 24, 90, 12564 }, // Ď
-    { 19, 20, 15, 1, 19, 95, 12654 }, // ď
-    { 16, 18, 17, 0, 18, 72, 12749 }, // Đ
-    { 16, 20, 14, 1, 19, 80, 12821 }, // đ
-    { 13, 21, 13, 1, 21, 69, 12901 }, // Ē
-    { 11, 18, 12, 1, 17, 50, 12970 }, // ē
-    { 13, 23, 13, 1, 23, 75, 13020 }, // Ĕ
-    { 12, 20, 12, 1, 19, 60, 13095 }, // ĕ
-    { 13, 23, 13, 1, 23, 75, 13155 }, // Ė
-    { 11, 20, 12, 1, 19, 55, 13230 }, // ė
-    { 13, 24, 13, 1, 18, 78, 13285 }, // Ę
-    { 11, 20, 12, 1, 14, 55, 13363 }, // ę
-    { 14, 24, 13, 1, 24, 84, 13418 }, // Ě
-    { 12, 21, 12, 1, 20, 63, 13502 }, // ě
-    { 16, 25, 17, 1, 24, 100, 13565 }, // Ĝ
-    { 14, 26, 14, 0, 20, 91, 13665 }, // ĝ
-    { 16, 24, 17, 1, 23, 96, 13756 }, // Ğ
-    { 14, 25, 14, 0, 19, 88, 13852 }, // ğ
-    { 16, 24, 17, 1, 23, 96, 13940 }, // Ġ
-    { 14, 25, 14, 0, 19, 88, 14036 }, // ġ
-    { 16, 25, 17, 1, 19, 100, 14124 }, // Ģ
-    { 14, 26, 14, 0, 20, 91, 14224 }, // ģ
-    { 17, 24, 17, 1, 24, 102, 14315 }, // Ĥ
-    { 14, 26, 14, 0, 26, 91, 14417 }, // ĥ
-    { 18, 18, 17, 1, 18, 81, 14508 }, // Ħ
-    { 14, 19, 14, 0, 19, 67, 14589 }, // ħ
-    { 13, 23, 8, -1, 23, 75, 14656 }, // Ĩ
-    { 10, 19, 6, 0, 19, 48, 14731 }, // ĩ
-    { 12, 21, 8, -1, 21, 63, 14779 }, // Ī
-    { 9, 17, 6, 0, 17, 39, 14842 }, // ī
-    { 12, 23, 8, -1, 23, 69, 14881 }, // Ĭ
-    { 10, 19, 6, 0, 19, 48, 14950 }, // ĭ
-    { 11, 24, 8, -1, 18, 66, 14998 }, // Į
-    { 8, 25, 6, -1, 19, 50, 15064 }, // į
-    { 11, 23, 8, -1, 23, 64, 15114 }, // İ
-    { 6, 14, 6, 0, 14, 21, 15178 }, // ı
-    { 17, 23, 15, -1, 18, 98, 15199 }, // Ĳ
-    { 14, 25, 13, 0, 19, 88, 15297 }, // ĳ
-    { 14, 29, 7, -4, 24, 102, 15385 }, // Ĵ
-    { 13, 26, 6, -4, 20, 85, 15487 }, // ĵ
-    { 16, 24, 14, 1, 18, 96, 15572 }, // Ķ
-    { 14, 25, 12, 0, 19, 88, 15668 }, // ķ
-    { 14, 14, 12, 0, 14, 49, 15756 }, // ĸ
-    { 10, 24, 12, 1, 24, 60, 15805 }, // Ĺ
-    { 11, 26, 6, 0, 26, 72, 15865 }, // ĺ
-    { 10, 24, 12, 1, 18, 60, 15937 }, // Ļ
-    { 8, 25, 6, -1, 19, 50, 15997 }, // ļ
-    { 12, 18, 12, 1, 18, 54, 16047 }, // Ľ
-    { 11, 19, 7, 0, 19, 53, 16101 }, // ľ
-    { 10, 18, 12, 1, 18, 45, 16154 }, // Ŀ
-    { 9, 19, 7, 0, 19, 43, 16199 }, // ŀ
-    { 11, 18, 12, 0, 18, 50, 16242 }, // Ł
-    { 8, 19, 6, 0, 19, 38, 16292 }, // ł
-    { 17, 24, 18, 1, 24, 102, 16330 }, // Ń
-    { 14, 20, 14, 0, 20, 70, 16432 }, // ń
-    { 17, 24, 18, 1, 18, 102, 16502 }, // Ņ
-    { 14, 20, 14, 0, 14, 70, 16604 }, // ņ
-    { 17, 24, 18, 1, 24, 102, 16674 }, // Ň
-    { 14, 20, 14, 0, 20, 70, 16776 }, // ň
-    { 15, 18, 16, 1, 18, 68, 16846 }, // ŉ
-    { 17, 23, 18, 1, 18, 98, 16914 }, // Ŋ
-    { 14, 20, 14, 0, 14, 70, 17012 }, // ŋ
-    { 17, 22, 18, 1, 21, 94, 17082 }, // Ō
-    { 12, 18, 14, 1, 17, 54, 17176 }, // ō
-    { 17, 24, 18, 1, 23, 102, 17230 }, // Ŏ
-    { 12, 20, 14, 1, 19, 60, 17332 }, // ŏ
-    { 18, 25, 18, 1, 24, 113, 17392 }, // Ő
-    { 14, 21, 14, 1, 20, 74, 17505 }, // ő
-    { 22, 20, 21, 1, 19, 110, 17579 }, // Œ
-    { 20, 15, 22, 1, 14, 75, 17689 }, // œ
-    { 14, 24, 14, 1, 24, 84, 17764 }, // Ŕ
-    { 12, 20, 10, 0, 20, 60, 17848 }, // ŕ
-    { 14, 24, 14, 1, 18, 84, 17908 }, // Ŗ
-    { 12, 20, 10, -1, 14, 60, 17992 }, // ŗ
-    { 14, 24, 14, 1, 24, 84, 18052 }, // Ř
-    { 13, 20, 10, 0, 20, 65, 18136 }, // ř
-    { 13, 25, 13, 0, 24, 82, 18201 }, // Ś
-    { 11, 21, 11, 0, 20, 58, 18283 }, // ś
-    { 13, 25, 13, 0, 24, 82, 18341 }, // Ŝ
-    { 11, 21, 11, 0, 20, 58, 18423 }, // ŝ
-    { 13, 25, 13, 0, 19, 82, 18481 }, // Ş
-    { 11, 20, 11, 0, 14, 55, 18563 }, // ş
-    { 14, 25, 13, 0, 24, 88, 18618 }, // Š
-    { 12, 21, 11, 0, 20, 63, 18706 }, // š
-    { 14, 24, 13, 1, 18, 84, 18769 }, // Ţ
-    { 10, 23, 8, 0, 17, 58, 18853 }, // ţ
-    { 13, 24, 13, 2, 24, 78, 18911 }, // Ť
-    { 11, 20, 8, 1, 19, 55, 18989 }, // ť
-    { 13, 18, 13, 2, 18, 59, 19044 }, // Ŧ
-    { 10, 18, 8, 0, 17, 45, 19103 }, // ŧ
-    { 17, 24, 17, 1, 23, 102, 19148 }, // Ũ
-    { 13, 20, 14, 1, 19, 65, 19250 }, // ũ
-    { 17, 22, 17, 1, 21, 94, 19315 }, // Ū
-    { 13, 18, 14, 1, 17, 59, 19409 }, // ū
-    { 17, 24, 17, 1, 23, 102, 19468 }, // Ŭ
-    { 13, 20, 14, 1, 19, 65, 19570 }, // ŭ
-    { 17, 26, 17, 1, 25, 111, 19635 }, // Ů
-    { 13, 22, 14, 1, 21, 72, 19746 }, // ů
-    { 17, 25, 17, 1, 24, 107, 19818 }, // Ű
-    { 15, 21, 14, 1, 20, 79, 19925 }, // ű
-    { 17, 24, 17, 1, 18, 102, 20004 }, // Ų
-    { 13, 20, 14, 1, 14, 65, 20106 }, // ų
-    { 22, 24, 21, 2, 24, 132, 20171 }, // Ŵ
-    { 19, 20, 18, 1, 20, 95, 20303 }, // ŵ
-    { 14, 24, 13, 2, 24, 84, 20398 }, // Ŷ
-    { 16, 26, 12, -3, 20, 104, 20482 }, // ŷ
-    { 14, 23, 13, 2, 23, 81, 20586 }, // Ÿ
-    { 16, 24, 13, -1, 24, 96, 20667 }, // Ź
-    { 13, 20, 11, -1, 20, 65, 20763 }, // ź
-    { 16, 23, 13, -1, 23, 92, 20828 }, // Ż
-    { 12, 19, 11, -1, 19, 57, 20920 }, // ż
-    { 16, 24, 13, -1, 24, 96, 20977 }, // Ž
-    { 13, 20, 11, -1, 20, 65, 21073 }, // ž
-    { 15, 26, 7, -4, 20, 98, 21138 }, // ſ
-    { 5, 5, 0, -10, 20, 7, 21236 }, // ̀
-    { 6, 5, 0, -6, 20, 8, 21243 }, // ́
-    { 9, 5, 0, -3, 20, 12, 21251 }, // ̂
-    { 10, 4, 0, -11, 19, 10, 21263 }, // ̃
-    { 8, 2, 0, -2, 17, 4, 21273 }, // ̄
-    { 11, 3, 0, -3, 22, 9, 21277 }, // ̅
-    { 8, 4, 0, -2, 19, 8, 21286 }, // ̆
-    { 4, 4, 0, 0, 19, 4, 21294 }, // ̇
-    { 8, 4, 0, -2, 19, 8, 21298 }, // ̈
-    { 6, 7, 0, -8, 21, 11, 21306 }, // ̉
-    { 7, 6, 0, -1, 21, 11, 21317 }, // ̊
-    { 10, 5, 0, -2, 20, 13, 21328 }, // ̋
-    { 9, 5, 0, -2, 20, 12, 21341 }, // ̌
-    { 4, 7, 0, 0, 19, 7, 21353 }, // ̍
-    { 8, 5, 0, -2, 19, 10, 21360 }, // ̎
-    { 10, 5, 0, -13, 20, 13, 21370 }, // ̏
-    { 9, 7, 0, -2, 22, 16, 21383 }, // ̐
-    { 8, 4, 0, -2, 19, 8, 21399 }, // ̑
-    { 6, 7, 0, -1, 18, 11, 21407 }, // ̒
-    { 6, 7, 0, -1, 18, 11, 21418 }, // ̓
-    { 4, 7, 0, 0, 18, 7, 21429 }, // ̔
-    { 6, 7, 0, -1, 18, 11, 21436 }, // ̕
-    { 5, 5, 0, -5, 0, 7, 21447 }, // ̖
-    { 6, 5, 0, -4, 0, 8, 21454 }, // ̗
-    { 6, 6, 0, -5, 0, 9, 21462 }, // ̘
-    { 6, 6, 0, -5, 0, 9, 21471 }, // ̙
-    { 8, 7, 8, 2, 19, 14, 21480 }, // ̚
-    { 6, 6, 0, -1, 19, 9, 21494 }, // ̛
-    { 5, 6, 0, -2, 0, 8, 21503 }, // ̜
-    { 6, 5, 0, -5, -1, 8, 21511 }, // ̝
-    { 7, 5, 0, -5, -1, 9, 21519 }, // ̞
-    { 6, 6, 0, -5, 0, 9, 21528 }, // ̟
-    { 6, 3, 0, -5, -2, 5, 21537 }, // ̠
-    { 6, 8, 0, -5, 2, 12, 21542 }, // ̡
-    { 5, 8, 0, -3, 2, 10, 21554 }, // ̢
-    { 4, 4, 0, -11, -1, 4, 21564 }, // ̣
-    { 8, 4, 0, -6, -1, 8, 21568 }, // ̤
-    { 6, 6, 0, -5, 0, 9, 21576 }, // ̥
-    { 5, 5, 0, 1, -1, 7, 21585 }, // ̦
-    { 6, 6, 0, -5, 0, 9, 21592 }, // ̧
-    { 5, 6, 0, -4, 0, 8, 21601 }, // ̨
-    { 4, 7, 0, -4, -1, 7, 21609 }, // ̩
-    { 10, 5, 0, -7, -1, 13, 21616 }, // ̪
-    { 11, 4, 0, -7, -1, 11, 21629 }, // ̫
-    { 9, 5, 0, -6, 0, 12, 21640 }, // ̬
-    { 8, 5, 0, -6, 0, 10, 21652 }, // ̭
-    { 9, 4, 0, -6, -1, 9, 21662 }, // ̮
-    { 8, 4, 0, -6, -1, 8, 21671 }, // ̯
-    { 10, 4, 0, -7, -1, 10, 21679 }, // ̰
-    { 8, 2, 0, -6, -2, 4, 21689 }, // ̱
-    { 12, 2, 0, -8, -2, 6, 21693 }, // ̲
-    { 12, 6, 0, -8, 0, 18, 21699 }, // ̳
-    { 10, 4, 0, -5, 9, 10, 21717 }, // ̴
-    { 10, 3, 0, -5, 9, 8, 21727 }, // ̵
-    { 18, 2, 0, -9, 8, 9, 21735 }, // ̶
-    { 8, 6, 0, -4, 10, 12, 21744 }, // ̷
-    { 14, 21, 0, -7, 19, 74, 21756 }, // ̸
-    { 4, 6, 0, -2, 0, 6, 21830 }, // ̹
-    { 10, 5, 0, -7, -1, 13, 21836 }, // ̺
-    { 10, 6, 0, -7, 0, 15, 21849 }, // ̻
-    { 10, 4, 0, -7, -1, 10, 21864 }, // ̼
-    { 7, 6, 0, -1, 20, 11, 21874 }, // ̽
-    { 6, 8, 0, -1, 22, 12, 21885 }, // ̾
-    { 12, 6, 0, -3, 25, 18, 21897 }, // ̿
-    { 6, 5, 0, -2, 20, 8, 21915 }, // ̀
-    { 7, 5, 0, 0, 20, 9, 21923 }, // ́
-    { 10, 4, 0, 4, 19, 10, 21932 }, // ͂
-    { 5, 5, 0, 0, 20, 7, 21942 }, // ̓
-    { 10, 5, 0, -3, 20, 13, 21949 }, // ̈́
-    { 4, 4, 0, -3, -2, 4, 21962 }, // ͅ
-    { 12, 6, 0, -4, 20, 18, 21966 }, // ͆
-    { 12, 6, 0, -8, 0, 18, 21984 }, // ͇
-    { 8, 5, 0, -6, -1, 10, 22002 }, // ͈
-    { 5, 5, 0, -4, -1, 7, 22012 }, // ͉
-    { 10, 6, 0, -3, 20, 15, 22019 }, // ͊
-    { 11, 10, 0, -3, 24, 28, 22034 }, // ͋
-    { 11, 7, 0, -3, 22, 20, 22062 }, // ͌
-    { 10, 6, 0, -7, 0, 15, 22082 }, // ͍
-    { 5, 6, 0, -4, 0, 8, 22097 }, // ͎
-    { 18, 18, 0, -9, 18, 81, 22105 }, // ͏
-    { 5, 6, 0, 0, 20, 8, 22186 }, // ͐
-    { 4, 6, 0, 3, 21, 6, 22194 }, // ͑
-    { 8, 7, 0, -2, 22, 14, 22200 }, // ͒
-    { 5, 6, 0, -4, 0, 8, 22214 }, // ͓
-    { 5, 5, 0, -4, -1, 7, 22222 }, // ͔
-    { 5, 5, 0, -4, -1, 7, 22229 }, // ͕
-    { 10, 5, 0, -6, -1, 13, 22236 }, // ͖
-    { 4, 6, 0, 2, 21, 6, 22249 }, // ͗
-    { 4, 4, 0, 0, 19, 4, 22255 }, // ͘
-    { 6, 6, 0, -5, 0, 9, 22259 }, // ͙
-    { 10, 6, 0, -7, 0, 15, 22268 }, // ͚
-    { 5, 6, 0, 0, 20, 8, 22283 }, // ͛
-    { 19, 5, 0, -11, -1, 24, 22291 }, // ͜
-    { 18, 5, 0, -7, 19, 23, 22315 }, // ͝
-    { 14, 2, 0, -5, 17, 7, 22338 }, // ͞
-    { 14, 2, 0, -9, -2, 7, 22345 }, // ͟
-    { 19, 4, 0, -7, 19, 19, 22352 }, // ͠
-    { 19, 6, 0, -7, 22, 29, 22371 }, // ͡
-    { 19, 6, 0, -12, 0, 29, 22400 }, // ͢
-    { 7, 6, 0, -1, 21, 11, 22429 }, // ͣ
-    { 5, 6, 0, 0, 21, 8, 22440 }, // ͤ
-    { 4, 8, 0, 1, 23, 8, 22448 }, // ͥ
-    { 7, 6, 0, -1, 21, 11, 22456 }, // ͦ
-    { 7, 6, 0, -1, 21, 11, 22467 }, // ͧ
-    { 6, 6, 0, 0, 21, 9, 22478 }, // ͨ
-    { 7, 9, 0, -1, 24, 16, 22487 }, // ͩ
-    { 7, 9, 0, -1, 24, 16, 22503 }, // ͪ
-    { 10, 6, 0, -3, 21, 15, 22519 }, // ͫ
-    { 6, 6, 0, 0, 21, 9, 22534 }, // ͬ
-    { 4, 8, 0, 1, 23, 8, 22543 }, // ͭ
-    { 6, 6, 0, 0, 21, 9, 22551 }, // ͮ
-    { 7, 6, 0, -1, 21, 11, 22560 }, // ͯ
-    { 14, 24, 13, 0, 24, 84, 22571 }, // Ѐ
-    { 14, 23, 13, 0, 23, 81, 22655 }, // Ё
-    { 14, 19, 17, 2, 18, 67, 22736 }, // Ђ
-    { 14, 24, 12, 0, 24, 84, 22803 }, // Ѓ
-    { 15, 20, 15, 1, 19, 75, 22887 }, // Є
-    { 13, 20, 13, 0, 19, 65, 22962 }, // Ѕ
-    { 7, 18, 7, 0, 18, 32, 23027 }, // І
-    { 10, 23, 7, 0, 23, 58, 23059 }, // Ї
-    { 12, 23, 7, -4, 18, 69, 23117 }, // Ј
-    { 24, 19, 23, -1, 18, 114, 23186 }, // Љ
-    { 22, 18, 23, 0, 18, 99, 23300 }, // Њ
-    { 14, 18, 17, 2, 18, 63, 23399 }, // Ћ
-    { 17, 24, 14, 0, 24, 102, 23462 }, // Ќ
-    { 18, 24, 17, 0, 24, 108, 23564 }, // Ѝ
-    { 17, 24, 14, 0, 23, 102, 23672 }, // Ў
-    { 17, 22, 17, 0, 18, 94, 23774 }, // Џ
-    { 15, 18, 14, -2, 18, 68, 23868 }, // А
-    { 15, 18, 14, 0, 18, 68, 23936 }, // Б
-    { 15, 18, 15, 0, 18, 68, 24004 }, // В
-    { 14, 18, 12, 0, 18, 63, 24072 }, // Г
-    { 21, 22, 17, -3, 18, 116, 24135 }, // Д
-    { 14, 18, 13, 0, 18, 63, 24251 }, // Е
-    { 25, 18, 20, -2, 18, 113, 24314 }, // Ж
-    { 14, 20, 13, -1, 19, 70, 24427 }, // З
-    { 18, 18, 17, 0, 18, 81, 24497 }, // И
-    { 18, 23, 17, 0, 23, 104, 24578 }, // Й
-    { 17, 18, 14, 0, 18, 77, 24682 }, // К
-    { 18, 19, 17, -1, 18, 86, 24759 }, // Л
-    { 21, 18, 21, 0, 18, 95, 24845 }, // М
-    { 17, 18, 17, 0, 18, 77, 24940 }, // Н
-    { 16, 20, 17, 1, 19, 80, 25017 }, // О
-    { 17, 18, 17, 0, 18, 77, 25097 }, // П
-    { 15, 18, 14, 0, 18, 68, 25174 }, // Р
-    { 15, 20, 15, 1, 19, 75, 25242 }, // С
-    { 13, 18, 13, 2, 18, 59, 25317 }, // Т
-    { 17, 19, 14, 0, 18, 81, 25376 }, // У
-    { 19, 20, 20, 1, 19, 95, 25457 }, // Ф
-    { 18, 18, 13, -2, 18, 81, 25552 }, // Х
-    { 17, 22, 17, 0, 18, 94, 25633 }, // Ц
-    { 14, 18, 16, 2, 18, 63, 25727 }, // Ч
-    { 24, 18, 24, 0, 18, 108, 25790 }, // Ш
-    { 24, 22, 24, 0, 18, 132, 25898 }, // Щ
-    { 13, 18, 16, 2, 18, 59, 26030 }, // Ъ
-    { 20, 18, 20, 0, 18, 90, 26089 }, // Ы
-    { 13, 18, 14, 0, 18, 59, 26179 }, // Ь
-    { 15, 20, 15, 0, 19, 75, 26238 }, // Э
-    { 23, 20, 24, 0, 19, 115, 26313 }, // Ю
-    { 16, 18, 14, -1, 18, 72, 26428 }, // Я
-    { 13, 15, 14, 1, 14, 49, 26500 }, // а
-    { 14, 21, 14, 1, 20, 74, 26549 }, // б
-    { 13, 15, 13, 0, 14, 49, 26623 }, // в
-    { 11, 15, 11, 0, 14, 42, 26672 }, // г
-    { 13, 21, 14, 1, 20, 69, 26714 }, // д
-    { 11, 15, 12, 1, 14, 42, 26783 }, // е
-    { 24, 15, 22, -1, 14, 90, 26825 }, // ж
-    { 11, 15, 11, 0, 14, 42, 26915 }, // з
-    { 13, 15, 14, 1, 14, 49, 26957 }, // и
-    { 13, 20, 14, 1, 19, 65, 27006 }, // й
-    { 14, 14, 13, 0, 14, 49, 27071 }, // к
-    { 16, 15, 14, -2, 14, 60, 27120 }, // л
-    { 19, 14, 19, 0, 14, 67, 27180 }, // м
-    { 14, 14, 14, 0, 14, 49, 27247 }, // н
-    { 14, 15, 14, 0, 14, 53, 27296 }, // о
-    { 13, 14, 14, 0, 14, 46, 27349 }, // п
-    { 15, 20, 14, -1, 14, 75, 27395 }, // р
-    { 12, 15, 12, 0, 14, 45, 27470 }, // с
-    { 21, 14, 22, 0, 14, 74, 27515 }, // т
-    { 17, 20, 12, -3, 14, 85, 27589 }, // у
-    { 16, 25, 17, 0, 19, 100, 27674 }, // ф
-    { 15, 14, 11, -2, 14, 53, 27774 }, // х
-    { 13, 18, 15, 1, 14, 59, 27827 }, // ц
-    { 13, 14, 14, 1, 14, 46, 27886 }, // ч
-    { 21, 15, 22, 1, 14, 79, 27932 }, // ш
-    { 21, 18, 22, 1, 14, 95, 28011 }, // щ
-    { 13, 15, 15, 1, 14, 49, 28106 }, // ъ
-    { 17, 15, 18, 1, 14, 64, 28155 }, // ы
-    { 11, 15, 13, 1, 14, 42, 28219 }, // ь
-    { 11, 15, 12, 0, 14, 42, 28261 }, // э
-    { 19, 15, 19, 0, 14, 72, 28303 }, // ю
-    { 14, 14, 13, -1, 14, 49, 28375 }, // я
-    { 11, 21, 12, 1, 20, 58, 28424 }, // ѐ
-    { 12, 20, 12, 1, 19, 60, 28482 }, // ё
-    { 13, 25, 14, 0, 19, 82, 28542 }, // ђ
-    { 12, 21, 11, 0, 20, 63, 28624 }, // ѓ
-    { 12, 15, 12, 0, 14, 45, 28687 }, // є
-    { 11, 15, 11, 0, 14, 42, 28732 }, // ѕ
-    { 7, 19, 6, 0, 19, 34, 28774 }, // і
-    { 9, 19, 6, 0, 19, 43, 28808 }, // ї
-    { 11, 25, 6, -4, 19, 69, 28851 }, // ј
-    { 22, 15, 20, -2, 14, 83, 28920 }, // љ
-    { 19, 15, 20, 0, 14, 72, 29003 }, // њ
-    { 14, 19, 14, 0, 19, 67, 29075 }, // ћ
-    { 14, 20, 13, 0, 20, 70, 29142 }, // ќ
-    { 13, 21, 14, 1, 20, 69, 29212 }, // ѝ
-    { 17, 25, 12, -3, 19, 107, 29281 }, // ў
-    { 13, 19, 14, 1, 14, 62, 29388 }, // џ
-    { 23, 19, 23, 2, 18, 110, 29450 }, // Ѡ
-    { 20, 14, 20, 1, 14, 70, 29560 }, // ѡ
-    { 13, 18, 15, 1, 18, 59, 29630 }, // Ѣ
-    { 20, 15, 21, 0, 14, 75, 29689 }, // ѣ
-    { 22, 20, 22, 1, 19, 110, 29764 }, // Ѥ
-    { 18, 15, 17, 0, 14, 68, 29874 }, // ѥ
-    { 16, 18, 15, -2, 18, 72, 29942 }, // Ѧ
-    { 14, 14, 13, -2, 14, 49, 30014 }, // ѧ
-    { 19, 18, 21, 1, 18, 86, 30063 }, // Ѩ
-    { 17, 14, 18, 0, 14, 60, 30149 }, // ѩ
-    { 19, 18, 17, -1, 18, 86, 30209 }, // Ѫ
-    { 17, 14, 15, -2, 14, 60, 30295 }, // ѫ
-    { 23, 18, 23, 1, 18, 104, 30355 }, // Ѭ
-    { 20, 14, 20, 0, 14, 70, 30459 }, // ѭ
-    { 15, 28, 13, -1, 22, 105, 30529 }, // Ѯ
-    { 14, 22, 11, -2, 17, 77, 30634 }, // ѯ
-    { 19, 18, 19, 2, 18, 86, 30711 }, // Ѱ
-    { 16, 25, 18, 1, 19, 100, 30797 }, // ѱ
-    { 17, 20, 18, 1, 19, 85, 30897 }, // Ѳ
-    { 12, 15, 14, 1, 14, 45, 30982 }, // ѳ
-    { 15, 18, 14, 2, 18, 68, 31027 }, // Ѵ
-    { 13, 14, 11, 1, 14, 46, 31095 }, // ѵ
-    { 15, 24, 14, 2, 24, 90, 31141 }, // Ѷ
-    { 13, 20, 11, 1, 20, 65, 31231 }, // ѷ
-    { 30, 25, 30, 1, 19, 188, 31296 }, // Ѹ
-    { 26, 20, 26, 1, 14, 130, 31484 }, // ѹ
-    { 17, 22, 19, 1, 20, 94, 31614 }, // Ѻ
-    { 13, 17, 15, 1, 15, 56, 31708 }, // ѻ
-    { 23, 27, 24, 1, 26, 156, 31764 }, // Ѽ
-    { 18, 23, 20, 1, 22, 104, 31920 }, // ѽ
-    { 23, 24, 23, 2, 23, 138, 32024 }, // Ѿ
-    { 20, 18, 20, 1, 18, 90, 32162 }, // ѿ
-    { 15, 25, 15, 1, 19, 94, 32252 }, // Ҁ
-    { 11, 20, 11, 1, 14, 55, 32346 }, // ҁ
-    { 14, 17, 15, 1, 16, 60, 32401 }, // ҂
-    { 10, 4, 0, -10, 18, 10, 32461 }, // ҃
-    { 10, 4, 0, -10, 19, 10, 32471 }, // ҄
-    { 4, 5, 0, -7, 20, 5, 32481 }, // ҅
-    { 4, 5, 0, -7, 20, 5, 32486 }, // ҆
-    { 10, 4, 0, -2, 23, 10, 32491 }, // ҇
-    { 30, 27, 0, -15, 20, 203, 32501 }, // ҈
-    { 28, 28, 0, -14, 21, 196, 32704 }, // ҉
-    { 17, 29, 18, 1, 24, 124, 32900 }, // Ҋ
-    { 13, 24, 15, 1, 19, 78, 33024 }, // ҋ
-    { 12, 18, 14, 1, 18, 54, 33102 }, // Ҍ
-    { 11, 20, 13, 1, 19, 55, 33156 }, // ҍ
-    { 14, 18, 14, 1, 18, 63, 33211 }, // Ҏ
-    { 15, 20, 14, -1, 14, 75, 33274 }, // ҏ
-    { 14, 22, 12, 1, 22, 77, 33349 }, // Ґ
-    { 12, 18, 10, 0, 18, 54, 33426 }, // ґ
-    { 14, 18, 12, 0, 18, 63, 33480 }, // Ғ
-    { 11, 14, 10, 0, 14, 39, 33543 }, // ғ
-    { 13, 25, 15, 1, 18, 82, 33582 }, // Ҕ
-    { 11, 21, 12, 0, 14, 58, 33664 }, // ҕ
-    { 24, 23, 21, -2, 18, 138, 33722 }, // Җ
-    { 23, 19, 21, -1, 14, 110, 33860 }, // җ
-    { 14, 25, 13, -1, 19, 88, 33970 }, // Ҙ
-    { 11, 20, 11, 0, 14, 55, 34058 }, // ҙ
-    { 16, 23, 15, 1, 18, 92, 34113 }, // Қ
-    { 14, 19, 13, 0, 14, 67, 34205 }, // қ
-    { 16, 18, 14, 1, 18, 72, 34272 }, // Ҝ
-    { 14, 14, 12, 0, 14, 49, 34344 }, // ҝ
-    { 16, 18, 14, 1, 18, 72, 34393 }, // Ҟ
-    { 14, 19, 12, 0, 19, 67, 34465 }, // ҟ
-    { 17, 18, 16, 2, 18, 77, 34532 }, // Ҡ
-    { 16, 14, 14, 0, 14, 56, 34609 }, // ҡ
-    { 17, 23, 17, 1, 18, 98, 34665 }, // Ң
-    { 15, 19, 15, 0, 14, 72, 34763 }, // ң
-    { 21, 18, 19, 1, 18, 95, 34835 }, // Ҥ
-    { 19, 14, 17, 0, 14, 67, 34930 }, // ҥ
-    { 22, 25, 25, 1, 18, 138, 34997 }, // Ҧ
-    { 19, 21, 21, 0, 14, 100, 35135 }, // ҧ
-    { 17, 21, 18, 1, 19, 90, 35235 }, // Ҩ
-    { 13, 15, 15, 1, 14, 49, 35325 }, // ҩ
-    { 15, 25, 15, 1, 19, 94, 35374 }, // Ҫ
-    { 11, 20, 11, 1, 14, 55, 35468 }, // ҫ
-    { 13, 23, 13, 2, 18, 75, 35523 }, // Ҭ
-    { 21, 19, 22, 0, 14, 100, 35598 }, // ҭ
-    { 14, 18, 13, 2, 18, 63, 35698 }, // Ү
-    { 12, 20, 12, 1, 14, 60, 35761 }, // ү
-    { 15, 18, 13, 1, 18, 68, 35821 }, // Ұ
-    { 14, 20, 12, -1, 14, 70, 35889 }, // ұ
-    { 18, 23, 15, -2, 18, 104, 35959 }, // Ҳ
-    { 15, 19, 13, -1, 14, 72, 36063 }, // ҳ
-    { 18, 23, 20, 2, 18, 104, 36135 }, // Ҵ
-    { 15, 19, 16, 1, 14, 72, 36239 }, // ҵ
-    { 15, 23, 16, 2, 18, 87, 36311 }, // Ҷ
-    { 13, 19, 14, 1, 14, 62, 36398 }, // ҷ
-    { 15, 18, 16, 2, 18, 68, 36460 }, // Ҹ
-    { 13, 14, 14, 1, 14, 46, 36528 }, // ҹ
-    { 14, 18, 16, 1, 18, 63, 36574 }, // Һ
-    { 14, 19, 14, 0, 19, 67, 36637 }, // һ
-    { 18, 20, 19, 1, 19, 90, 36704 }, // Ҽ
-    { 15, 15, 15, 0, 14, 57, 36794 }, // ҽ
-    { 18, 24, 19, 1, 19, 108, 36851 }, // Ҿ
-    { 15, 19, 15, 0, 14, 72, 36959 }, // ҿ
-    { 11, 18, 8, -1, 18, 50, 37031 }, // Ӏ
-    { 25, 23, 20, -2, 23, 144, 37081 }, // Ӂ
-    { 24, 20, 22, -1, 19, 120, 37225 }, // ӂ
-    { 16, 25, 16, 1, 18, 100, 37345 }, // Ӄ
-    { 14, 21, 13, 0, 14, 74, 37445 }, // ӄ
-    { 18, 23, 17, -1, 18, 104, 37519 }, // Ӆ
-    { 15, 19, 14, -2, 14, 72, 37623 }, // ӆ
-    { 17, 25, 17, 1, 18, 107, 37695 }, // Ӈ
-    { 15, 21, 15, 0, 14, 79, 37802 }, // ӈ
-    { 17, 23, 17, 1, 18, 98, 37881 }, // Ӊ
-    { 15, 19, 15, 0, 14, 72, 37979 }, // ӊ
-    { 15, 23, 16, 2, 18, 87, 38051 }, // Ӌ
-    { 12, 19, 15, 2, 14, 57, 38138 }, // ӌ
-    { 21, 23, 21, 1, 18, 121, 38195 }, // Ӎ
-    { 17, 19, 18, 0, 14, 81, 38316 }, // ӎ
-    { 11, 18, 8, -1, 18, 50, 38397 }, // ӏ
-    { 17, 23, 14, -2, 23, 98, 38447 }, // Ӑ
-    { 13, 20, 14, 1, 19, 65, 38545 }, // ӑ
-    { 16, 23, 14, -2, 23, 92, 38610 }, // Ӓ
-    { 13, 20, 14, 1, 19, 65, 38702 }, // ӓ
-    { 24, 18, 21, -2, 18, 108, 38767 }, // Ӕ
-    { 19, 15, 21, 1, 14, 72, 38875 }, // ӕ
-    { 14, 23, 13, 1, 23, 81, 38947 }, // Ӗ
-    { 13, 20, 12, 1, 19, 65, 39028 }, // ӗ
-    { 15, 20, 17, 1, 19, 75, 39093 }, // Ә
-    { 12, 15, 12, 0, 14, 45, 39168 }, // ә
-    { 15, 24, 17, 1, 23, 90, 39213 }, // Ӛ
-    { 12, 20, 12, 0, 19, 60, 39303 }, // ӛ
-    { 25, 23, 20, -2, 23, 144, 39363 }, // Ӝ
-    { 24, 20, 22, -1, 19, 120, 39507 }, // ӝ
-    { 14, 24, 13, -1, 23, 84, 39627 }, // Ӟ
-    { 11, 20, 11, 0, 19, 55, 39711 }, // ӟ
-    { 14, 19, 13, 0, 18, 67, 39766 }, // Ӡ
-    { 14, 20, 12, -2, 14, 70, 39833 }, // ӡ
-    { 18, 21, 17, 0, 21, 95, 39903 }, // Ӣ
-    { 13, 18, 14, 1, 17, 59, 39998 }, // ӣ
-    { 18, 23, 17, 0, 23, 104, 40057 }, // Ӥ
-    { 13, 20, 14, 1, 19, 65, 40161 }, // ӥ
-    { 17, 24, 18, 1, 23, 102, 40226 }, // Ӧ
-    { 12, 20, 14, 1, 19, 60, 40328 }, // ӧ
-    { 17, 20, 18, 1, 19, 85, 40388 }, // Ө
-    { 12, 15, 14, 1, 14, 45, 40473 }, // ө
-    { 17, 24, 18, 1, 23, 102, 40518 }, // Ӫ
-    { 12, 20, 14, 1, 19, 60, 40620 }, // ӫ
-    { 15, 24, 15, 0, 23, 90, 40680 }, // Ӭ
-    { 11, 20, 12, 0, 19, 55, 40770 }, // ӭ
-    { 17, 22, 14, 0, 21, 94, 40825 }, // Ӯ
-    { 16, 23, 12, -3, 17, 92, 40919 }, // ӯ
-    { 17, 24, 14, 0, 23, 102, 41011 }, // Ӱ
-    { 16, 25, 12, -3, 19, 100, 41113 }, // ӱ
-    { 17, 25, 14, 0, 24, 107, 41213 }, // Ӳ
-    { 17, 26, 12, -3, 20, 111, 41320 }, // ӳ
-    { 14, 23, 16, 2, 23, 81, 41431 }, // Ӵ
-    { 13, 19, 14, 1, 19, 62, 41512 }, // ӵ
-    { 13, 23, 12, 1, 18, 75, 41574 }, // Ӷ
-    { 11, 19, 10, 0, 14, 53, 41649 }, // ӷ
-    { 20, 23, 20, 0, 23, 115, 41702 }, // Ӹ
-    { 17, 20, 18, 1, 19, 85, 41817 }, // ӹ
-    { 14, 23, 12, 0, 18, 81, 41902 }, // Ӻ
-    { 12, 19, 10, -1, 14, 57, 41983 }, // ӻ
-    { 18, 23, 13, -2, 18, 104, 42040 }, // Ӽ
-    { 14, 19, 12, -1, 14, 67, 42144 }, // ӽ
-    { 18, 18, 13, -2, 18, 81, 42211 }, // Ӿ
-    { 14, 14, 12, -1, 14, 49, 42292 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 42341 }, //  
-    { 0, 0, 25, 0, 0, 0, 42341 }, //  
-    { 0, 0, 13, 0, 0, 0, 42341 }, //  
-    { 0, 0, 25, 0, 0, 0, 42341 }, //  
-    { 0, 0, 8, 0, 0, 0, 42341 }, //  
-    { 0, 0, 6, 0, 0, 0, 42341 }, //  
-    { 0, 0, 4, 0, 0, 0, 42341 }, //  
-    { 0, 0, 14, 0, 0, 0, 42341 }, //  
-    { 0, 0, 6, 0, 0, 0, 42341 }, //  
-    { 0, 0, 4, 0, 0, 0, 42341 }, //  
-    { 0, 0, 3, 0, 0, 0, 42341 }, //  
-    { 0, 0, 0, 0, 0, 0, 42341 }, // ​
-    { 0, 0, 0, 0, 0, 0, 42341 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 42341 }, // ‍
-    { 7, 22, 0, -1, 18, 39, 42341 }, // ‎
-    { 7, 22, 0, -6, 18, 39, 42380 }, // ‏
-    { 7, 3, 8, 0, 8, 6, 42419 }, // ‐
-    { 7, 3, 8, 0, 8, 6, 42425 }, // ‑
-    { 13, 2, 14, 1, 10, 7, 42431 }, // ‒
-    { 12, 3, 12, 0, 8, 9, 42438 }, // –
-    { 24, 3, 24, 0, 8, 18, 42447 }, // —
-    { 24, 3, 24, 0, 8, 18, 42465 }, // ―
-    { 9, 26, 14, 3, 19, 59, 42483 }, // ‖
-    { 12, 6, 10, -3, 0, 18, 42542 }, // ‗
-    { 6, 7, 4, 1, 18, 11, 42560 }, // ‘
-    { 6, 7, 4, 1, 18, 11, 42571 }, // ’
-    { 6, 7, 6, -2, 3, 11, 42582 }, // ‚
-    { 4, 7, 4, 2, 18, 7, 42593 }, // ‛
-    { 11, 7, 9, 1, 18, 20, 42600 }, // “
-    { 11, 7, 9, 1, 18, 20, 42620 }, // ”
-    { 11, 7, 11, -2, 3, 20, 42640 }, // „
-    { 8, 7, 9, 2, 18, 14, 42660 }, // ‟
-    { 10, 19, 12, 2, 19, 48, 42674 }, // †
-    { 13, 19, 12, 0, 19, 62, 42722 }, // ‡
-    { 6, 7, 9, 2, 13, 11, 42784 }, // •
-    { 8, 8, 9, 1, 13, 16, 42795 }, // ‣
-    { 4, 5, 13, 3, 4, 5, 42811 }, // ․
-    { 10, 5, 13, 0, 4, 13, 42816 }, // ‥
-    { 17, 5, 19, 0, 4, 22, 42829 }, // …
-    { 4, 5, 6, 1, 9, 5, 42851 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 42856 }, //  
-    { 0, 0, 15, 0, 0, 0, 42856 }, //  
-    { 7, 20, 0, -1, 16, 35, 42856 }, // ‪
-    { 7, 20, 0, -6, 16, 35, 42891 }, // ‫
-    { 6, 22, 0, -3, 18, 33, 42926 }, // ‬
-    { 6, 22, 0, -3, 18, 33, 42959 }, // ‭
-    { 6, 22, 0, -3, 18, 33, 42992 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 43025 }, //  
-    { 26, 20, 28, 2, 19, 130, 43025 }, // ‰
-    { 34, 20, 36, 2, 19, 170, 43155 }, // ‱
-    { 7, 7, 6, 1, 18, 13, 43325 }, // ′
-    { 11, 7, 10, 1, 18, 20, 43338 }, // ″
-    { 15, 7, 14, 1, 18, 27, 43358 }, // ‴
-    { 4, 7, 7, 3, 18, 7, 43385 }, // ‵
-    { 8, 7, 11, 3, 18, 14, 43392 }, // ‶
-    { 12, 7, 14, 3, 18, 21, 43406 }, // ‷
-    { 10, 9, 10, -3, 3, 23, 43427 }, // ‸
-    { 6, 11, 7, 1, 12, 17, 43450 }, // ‹
-    { 7, 11, 7, 0, 12, 20, 43467 }, // ›
-    { 19, 20, 21, 1, 19, 95, 43487 }, // ※
-    { 13, 19, 12, 0, 18, 62, 43582 }, // ‼
-    { 11, 20, 11, 1, 19, 55, 43644 }, // ‽
-    { 11, 2, 10, 2, 21, 6, 43699 }, // ‾
-    { 14, 6, 14, -2, 0, 21, 43705 }, // ‿
-    { 13, 6, 14, 2, 20, 20, 43726 }, // ⁀
-    { 12, 17, 9, -3, 11, 51, 43746 }, // ⁁
-    { 27, 24, 28, 0, 20, 162, 43797 }, // ⁂
-    { 7, 3, 7, 0, 8, 6, 43959 }, // ⁃
-    { 16, 18, 3, -6, 18, 72, 43965 }, // ⁄
-    { 11, 22, 7, -1, 18, 61, 44037 }, // ⁅
-    { 10, 22, 7, -2, 18, 55, 44098 }, // ⁆
-    { 22, 20, 22, 1, 19, 110, 44153 }, // ⁇
-    { 17, 20, 17, 1, 19, 85, 44263 }, // ⁈
-    { 18, 20, 17, 0, 19, 90, 44348 }, // ⁉
-    { 13, 14, 13, 1, 14, 46, 44438 }, // ⁊
-    { 13, 23, 15, 2, 19, 75, 44484 }, // ⁋
-    { 13, 14, 16, 1, 14, 46, 44559 }, // ⁌
-    { 13, 14, 16, 2, 14, 46, 44605 }, // ⁍
-    { 13, 13, 14, -1, 7, 43, 44651 }, // ⁎
-    { 6, 18, 6, 0, 14, 27, 44694 }, // ⁏
-    { 17, 26, 14, -2, 20, 111, 44721 }, // ⁐
-    { 15, 26, 14, 0, 20, 98, 44832 }, // ⁑
-    { 10, 20, 9, 0, 19, 50, 44930 }, // ⁒
-    { 22, 5, 25, 2, 10, 28, 44980 }, // ⁓
-    { 14, 6, 14, -3, 0, 21, 45008 }, // ⁔
-    { 14, 14, 14, 0, 13, 49, 45029 }, // ⁕
-    { 11, 20, 13, 1, 19, 55, 45078 }, // ⁖
-    { 19, 7, 18, 1, 18, 34, 45133 }, // ⁗
-    { 19, 20, 21, 1, 19, 95, 45167 }, // ⁘
-    { 19, 20, 21, 1, 19, 95, 45262 }, // ⁙
-    { 4, 20, 6, 1, 19, 20, 45357 }, // ⁚
-    { 15, 20, 16, 1, 19, 75, 45377 }, // ⁛
-    { 19, 20, 20, 0, 19, 95, 45452 }, // ⁜
-    { 4, 19, 7, 1, 18, 19, 45547 }, // ⁝
-    { 4, 20, 7, 2, 19, 20, 45566 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 45586 }, //  
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁤
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁦
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁧
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁨
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁩
-    { 6, 22, 0, -3, 18, 33, 45586 }, // ⁪
-    { 6, 22, 0, -3, 18, 33, 45619 }, // ⁫
-    { 6, 22, 0, -3, 18, 33, 45652 }, // ⁬
-    { 6, 22, 0, -3, 18, 33, 45685 }, // ⁭
-    { 6, 22, 0, -3, 18, 33, 45718 }, // ⁮
-    { 6, 22, 0, -3, 18, 33, 45751 }, // ⁯
-    { 9, 12, 9, 2, 22, 27, 45784 }, // ⁰
-    { 4, 12, 6, 2, 19, 12, 45811 }, // ⁱ
-    { 9, 12, 9, 1, 22, 27, 45823 }, // ⁴
-    { 9, 12, 9, 2, 22, 27, 45850 }, // ⁵
-    { 9, 12, 9, 2, 22, 27, 45877 }, // ⁶
-    { 9, 12, 9, 2, 22, 27, 45904 }, // ⁷
-    { 9, 12, 9, 2, 22, 27, 45931 }, // ⁸
-    { 9, 12, 9, 2, 22, 27, 45958 }, // ⁹
-    { 8, 8, 8, 2, 19, 16, 45985 }, // ⁺
-    { 8, 2, 8, 2, 16, 4, 46001 }, // ⁻
-    { 8, 5, 8, 2, 18, 10, 46005 }, // ⁼
-    { 7, 14, 5, 2, 23, 25, 46015 }, // ⁽
-    { 6, 14, 5, 0, 23, 21, 46040 }, // ⁾
-    { 9, 9, 9, 1, 16, 21, 46061 }, // ⁿ
-    { 9, 12, 9, -1, 8, 27, 46082 }, // ₀
-    { 6, 12, 9, 0, 8, 18, 46109 }, // ₁
-    { 9, 12, 9, -2, 8, 27, 46127 }, // ₂
-    { 8, 12, 9, -1, 8, 24, 46154 }, // ₃
-    { 9, 12, 9, -1, 8, 27, 46178 }, // ₄
-    { 9, 12, 9, -1, 8, 27, 46205 }, // ₅
-    { 9, 12, 9, -1, 8, 27, 46232 }, // ₆
-    { 9, 12, 9, -1, 8, 27, 46259 }, // ₇
-    { 9, 12, 9, -1, 8, 27, 46286 }, // ₈
-    { 9, 12, 9, -1, 8, 27, 46313 }, // ₉
-    { 8, 8, 8, -1, 6, 16, 46340 }, // ₊
-    { 8, 2, 8, -1, 3, 4, 46356 }, // ₋
-    { 8, 5, 8, -1, 5, 10, 46360 }, // ₌
-    { 6, 14, 5, 0, 9, 21, 46370 }, // ₍
-    { 6, 14, 5, -3, 9, 21, 46391 }, // ₎
-    { 9, 9, 9, -1, 6, 21, 46412 }, // ₐ
-    { 8, 9, 8, -1, 6, 18, 46433 }, // ₑ
-    { 9, 9, 9, -1, 6, 21, 46451 }, // ₒ
-    { 9, 9, 8, -2, 6, 21, 46472 }, // ₓ
-    { 7, 9, 8, -1, 6, 16, 46493 }, // ₔ
-    { 9, 12, 11, 0, 9, 27, 46509 }, // ₕ
-    { 9, 12, 9, 0, 9, 27, 46536 }, // ₖ
-    { 5, 12, 6, 0, 9, 15, 46563 }, // ₗ
-    { 14, 9, 16, 0, 6, 32, 46578 }, // ₘ
-    { 9, 9, 9, -1, 6, 21, 46610 }, // ₙ
-    { 10, 12, 9, -2, 6, 30, 46631 }, // ₚ
-    { 7, 9, 8, -1, 6, 16, 46661 }, // ₛ
-    { 6, 11, 5, -1, 8, 17, 46677 }, // ₜ
-    { 14, 19, 14, 1, 19, 67, 46694 }, // ₠
-    { 14, 21, 14, 1, 19, 74, 46761 }, // ₡
-    { 14, 20, 14, 1, 19, 70, 46835 }, // ₢
-    { 15, 18, 14, 0, 18, 68, 46905 }, // ₣
-    { 16, 19, 14, -1, 19, 76, 46973 }, // ₤
-    { 21, 20, 22, 0, 17, 105, 47049 }, // ₥
-    { 15, 18, 14, 0, 18, 68, 47154 }, // ₦
-    { 18, 19, 18, 0, 18, 86, 47222 }, // ₧
-    { 21, 19, 20, 0, 18, 100, 47308 }, // ₨
-    { 18, 18, 16, 0, 18, 81, 47408 }, // ₩
-    { 21, 18, 20, 0, 18, 95, 47489 }, // ₪
-    { 17, 23, 14, 0, 19, 98, 47584 }, // ₫
-    { 16, 20, 14, 0, 19, 80, 47682 }, // €
-    { 17, 18, 14, 0, 18, 77, 47762 }, // ₭
-    { 14, 18, 13, 1, 18, 63, 47839 }, // ₮
-    { 24, 25, 24, 0, 19, 150, 47902 }, // ₯
-    { 16, 25, 14, -2, 19, 100, 48052 }, // ₰
-    { 16, 18, 14, 0, 18, 72, 48152 }, // ₱
-    { 16, 21, 17, 1, 19, 84, 48224 }, // ₲
-    { 17, 18, 14, -2, 18, 77, 48308 }, // ₳
-    { 15, 20, 13, -1, 19, 75, 48385 }, // ₴
-    { 15, 21, 15, 1, 19, 79, 48460 }, // ₵
-    { 16, 18, 14, 0, 17, 72, 48539 }, // ₶
-    { 18, 21, 16, -1, 19, 95, 48611 }, // ₷
-    { 14, 18, 12, 1, 18, 63, 48706 }, // ₸
-    { 13, 18, 14, 2, 18, 59, 48769 }, // ₹
-    { 14, 19, 14, 0, 18, 67, 48828 }, // ₺
-    { 16, 20, 17, 1, 19, 80, 48895 }, // ₻
-    { 19, 18, 19, -1, 18, 86, 48975 }, // ₼
-    { 16, 18, 15, -1, 18, 72, 49061 }, // ₽
-    { 17, 21, 15, -1, 21, 90, 49133 }, // ₾
-    { 13, 24, 14, 1, 21, 78, 49223 }, // ₿
-    { 7, 3, 8, 0, 8, 6, 49301 }, // −
-    { 23, 23, 25, 1, 19, 133, 49307 }, // �
+    { 16, 20, 17, 1, 19, 80, 2048 }, // G
+    { 17, 18, 17, 1, 18, 77, 2128 }, // H
+    { 11, 18, 8, -1, 18, 50, 2205 }, // I
+    { 12, 23, 7, -4, 18, 69, 2255 }, // J
+    { 16, 18, 14, 1, 18, 72, 2324 }, // K
+    { 10, 18, 12, 1, 18, 45, 2396 }, // L
+    { 21, 18, 21, 1, 18, 95, 2441 }, // M
+    { 17, 18, 18, 1, 18, 77, 2536 }, // N
+    { 17, 20, 18, 1, 19, 85, 2613 }, // O
+    { 14, 18, 14, 1, 18, 63, 2698 }, // P
+    { 17, 24, 18, 1, 19, 102, 2761 }, // Q
+    { 14, 18, 14, 1, 18, 63, 2863 }, // R
+    { 13, 20, 13, 0, 19, 65, 2926 }, // S
+    { 13, 18, 13, 2, 18, 59, 2991 }, // T
+    { 17, 19, 17, 1, 18, 81, 3050 }, // U
+    { 15, 18, 14, 2, 18, 68, 3131 }, // V
+    { 22, 18, 21, 2, 18, 99, 3199 }, // W
+    { 18, 18, 13, -2, 18, 81, 3298 }, // X
+    { 14, 18, 13, 2, 18, 63, 3379 }, // Y
+    { 16, 18, 13, -1, 18, 72, 3442 }, // Z
+    { 11, 22, 7, -1, 18, 61, 3514 }, // [
+    { 6, 18, 9, 2, 18, 27, 3575 }, // <backslash>
+    { 10, 22, 7, -2, 18, 55, 3602 }, // ]
+    { 14, 12, 14, 0, 18, 42, 3657 }, // ^
+    { 11, 2, 10, -3, -2, 6, 3699 }, // _
+    { 5, 5, 7, 3, 20, 7, 3705 }, // `
+    { 13, 15, 14, 1, 14, 49, 3712 }, // a
+    { 14, 20, 14, 0, 19, 70, 3761 }, // b
+    { 11, 15, 11, 1, 14, 42, 3831 }, // c
+    { 14, 20, 14, 1, 19, 70, 3873 }, // d
+    { 11, 15, 12, 1, 14, 42, 3943 }, // e
+    { 15, 26, 8, -3, 20, 98, 3985 }, // f
+    { 14, 20, 14, 0, 14, 70, 4096 }, // g
+    { 14, 19, 14, 0, 19, 67, 4166 }, // h
+    { 7, 19, 6, 0, 19, 34, 4233 }, // i
+    { 11, 25, 6, -4, 19, 69, 4267 }, // j
+    { 14, 19, 12, 0, 19, 67, 4336 }, // k
+    { 7, 19, 6, 0, 19, 34, 4403 }, // l
+    { 21, 14, 22, 0, 14, 74, 4437 }, // m
+    { 14, 14, 14, 0, 14, 49, 4511 }, // n
+    { 12, 15, 14, 1, 14, 45, 4560 }, // o
+    { 15, 20, 14, -1, 14, 75, 4605 }, // p
+    { 13, 20, 14, 1, 14, 65, 4680 }, // q
+    { 11, 14, 10, 0, 14, 39, 4745 }, // r
+    { 11, 15, 11, 0, 14, 42, 4784 }, // s
+    { 9, 18, 8, 1, 17, 41, 4826 }, // t
+    { 13, 15, 14, 1, 14, 49, 4867 }, // u
+    { 12, 14, 12, 1, 14, 42, 4916 }, // v
+    { 19, 14, 18, 1, 14, 67, 4958 }, // w
+    { 14, 14, 12, -1, 14, 49, 5025 }, // x
+    { 16, 20, 12, -3, 14, 80, 5074 }, // y
+    { 12, 14, 11, -1, 14, 42, 5154 }, // z
+    { 10, 22, 9, 0, 18, 55, 5196 }, // {
+    { 3, 26, 14, 6, 19, 20, 5251 }, // |
+    { 10, 22, 9, -1, 18, 55, 5271 }, // }
+    { 13, 4, 14, 1, 11, 13, 5326 }, // ~
+    { 0, 0, 7, 0, 0, 0, 5339 }, //  
+    { 8, 19, 7, -1, 14, 38, 5339 }, // ¡
+    { 12, 20, 14, 2, 19, 60, 5377 }, // ¢
+    { 16, 19, 14, -1, 19, 76, 5437 }, // £
+    { 11, 12, 14, 2, 15, 33, 5513 }, // ¤
+    { 15, 18, 14, 1, 18, 68, 5546 }, // ¥
+    { 3, 26, 14, 6, 19, 20, 5614 }, // ¦
+    { 13, 21, 12, 0, 20, 69, 5634 }, // §
+    { 8, 4, 14, 5, 19, 8, 5703 }, // ¨
+    { 19, 20, 21, 1, 19, 95, 5711 }, // ©
+    { 8, 10, 8, 2, 19, 20, 5806 }, // ª
+    { 11, 11, 12, 1, 12, 31, 5826 }, // «
+    { 13, 7, 14, 1, 10, 23, 5857 }, // ¬
+    { 7, 3, 8, 0, 8, 6, 5880 }, // ­
+    { 19, 20, 21, 1, 19, 95, 5886 }, // ®
+    { 11, 2, 10, 2, 21, 6, 5981 }, // ¯
+    { 9, 9, 11, 1, 19, 21, 5987 }, // °
+    { 13, 15, 14, 1, 15, 49, 6008 }, // ±
+    { 9, 12, 9, 1, 22, 27, 6057 }, // ²
+    { 8, 12, 9, 2, 22, 24, 6084 }, // ³
+    { 7, 5, 7, 2, 20, 9, 6108 }, // ´
+    { 15, 20, 15, -1, 14, 75, 6144 }, // µ
+    { 13, 23, 16, 2, 19, 75, 6219 }, // ¶
+    { 4, 5, 6, 2, 11, 5, 6294 }, // ·
+    { 6, 6, 5, -3, 0, 9, 6299 }, // ¸
+    { 6, 12, 9, 3, 22, 18, 6308 }, // ¹
+    { 8, 10, 8, 2, 19, 20, 6326 }, // º
+    { 11, 11, 12, 0, 12, 31, 6346 }, // »
+    { 16, 19, 18, 2, 19, 76, 6377 }, // ¼
+    { 18, 19, 20, 2, 19, 86, 6453 }, // ½
+    { 18, 19, 20, 1, 19, 86, 6539 }, // ¾
+    { 10, 19, 11, -1, 14, 48, 6625 }, // ¿
+    { 15, 24, 14, -2, 24, 90, 6673 }, // À
+    { 16, 24, 14, -2, 24, 96, 6763 }, // Á
+    { 16, 24, 14, -2, 24, 96, 6859 }, // Â
+    { 17, 23, 14, -2, 23, 98, 6955 }, // Ã
+    { 16, 23, 14, -2, 23, 92, 7053 }, // Ä
+    { 15, 25, 14, -2, 25, 94, 7145 }, // Å
+    { 24, 18, 21, -2, 18, 108, 7239 }, // Æ
+    { 15, 25, 15, 1, 19, 94, 7347 }, // Ç
+    { 13, 24, 13, 1, 24, 78, 7441 }, // È
+    { 13, 24, 13, 1, 24, 78, 7519 }, // É
+    { 13, 24, 13, 1, 24, 78, 7597 }, // Ê
+    { 13, 23, 13, 1, 23, 75, 7675 }, // Ë
+    { 11, 24, 8, -1, 24, 66, 7750 }, // Ì
+    { 12, 24, 8, -1, 24, 72, 7816 }, // Í
+    { 12, 24, 8, -1, 24, 72, 7888 }, // Î
+    { 12, 23, 8, -1, 23, 69, 7960 }, // Ï
+    { 16, 18, 17, 0, 18, 72, 8029 }, // Ð
+    { 17, 23, 18, 1, 23, 98, 8192 }, // Ñ
+    { 17, 25, 18, 1, 24, 107, 8290 }, // Ò
+    { 17, 25, 18, 1, 24, 107, 8397 }, // Ó
+    { 17, 25, 18, 1, 24, 107, 8504 }, // Ô
+    { 17, 24, 18, 1, 23, 102, 8611 }, // Õ
+    { 17, 24, 18, 1, 23, 102, 8713 }, // Ö
+    { 12, 12, 14, 2, 15, 36, 8815 }, // ×
+    { 17, 21, 18, 1, 19, 90, 8851 }, // Ø
+    { 17, 25, 17, 1, 24, 107, 8941 }, // Ù
+    { 17, 25, 17, 1, 24, 107, 9048 }, // Ú
+    { 17, 25, 17, 1, 24, 107, 9155 }, // Û
+    { 17, 24, 17, 1, 23, 102, 9262 }, // Ü
+    { 14, 24, 13, 2, 24, 84, 9364 }, // Ý
+    { 13, 18, 14, 1, 18, 59, 9448 }, // Þ
+    { 18, 26, 15, -4, 20, 117, 9507 }, // ß
+    { 13, 21, 14, 1, 20, 69, 9624 }, // à
+    { 13, 21, 14, 1, 20, 69, 9693 }, // á
+    { 13, 21, 14, 1, 20, 69, 9762 }, // â
+    { 13, 20, 14, 1, 19, 65, 9831 }, // ã
+    { 13, 20, 14, 1, 19, 65, 9896 }, // ä
+    { 13, 22, 14, 1, 21, 72, 9961 }, // å
+    { 19, 15, 21, 1, 14, 72, 10033 }, // æ
+    { 11, 20, 11, 1, 14, 55, 10105 }, // ç
+    { 11, 21, 12, 1, 20, 58, 10160 }, // è
+    { 12, 21, 12, 1, 20, 63, 10240 }, // é
+    { 11, 21, 12, 1, 20, 58, 10303 }, // ê
+    { 11, 20, 12, 1, 19, 55, 10361 }, // ë
+    { 7, 20, 6, 0, 20, 35, 10416 }, // ì
+    { 9, 20, 6, 0, 20, 45, 10451 }, // í
+    { 9, 20, 6, 0, 20, 45, 10496 }, // î
+    { 9, 19, 6, 0, 19, 43, 10541 }, // ï
+    { 13, 21, 14, 1, 20, 69, 10584 }, // ð
+    { 14, 19, 14, 0, 19, 67, 10653 }, // ñ
+    { 12, 21, 14, 1, 20, 63, 10720 }, // ò
+    { 12, 21, 14, 1, 20, 63, 10783 }, // ó
+    { 12, 21, 14, 1, 20, 63, 10846 }, // ô
+    { 13, 20, 14, 1, 19, 65, 10909 }, // õ
+    { 12, 20, 14, 1, 19, 60, 10974 }, // ö
+    { 13, 12, 14, 1, 15, 39, 11034 }, // ÷
+    { 14, 16, 14, 0, 15, 56, 11073 }, // ø
+    { 13, 21, 14, 1, 20, 69, 11129 }, // ù
+    { 13, 21, 14, 1, 20, 69, 11198 }, // ú
+    { 13, 21, 14, 1, 20, 69, 11267 }, // û
+    { 13, 20, 14, 1, 19, 65, 11336 }, // ü
+    { 16, 26, 12, -3, 20, 104, 11401 }, // ý
+    { 15, 25, 14, -1, 19, 94, 11505 }, // þ
+    { 16, 25, 12, -3, 19, 100, 11599 }, // ÿ
+    { 16, 21, 14, -2, 21, 84, 11699 }, // Ā
+    { 13, 18, 14, 1, 17, 59, 11783 }, // ā
+    { 16, 23, 14, -2, 23, 92, 11842 }, // Ă
+    { 13, 20, 14, 1, 19, 65, 11934 }, // ă
+    { 15, 24, 14, -2, 18, 90, 11999 }, // Ą
+    { 13, 20, 14, 1, 14, 65, 12089 }, // ą
+    { 15, 25, 15, 1, 24, 94, 12154 }, // Ć
+    { 11, 21, 11, 1, 20, 58, 12288 }, // ć
+    { 15, 25, 15, 1, 24, 94, 12346 }, // Ĉ
+    { 11, 21, 11, 1, 20, 58, 12440 }, // ĉ
+    { 15, 24, 15, 1, 23, 90, 12498 }, // Ċ
+    { 11, 20, 11, 1, 19, 55, 12588 }, // ċ
+    { 15, 25, 15, 1, 24, 94, 12643 }, // Č
+    { 12, 21, 11, 1, 20, 63, 12737 }, // č
+    { 15, 24, 17, 1, 24, 90, 12800 }, // Ď
+    { 19, 20, 15, 1, 19, 95, 12890 }, // ď
+    { 16, 18, 17, 0, 18, 72, 12985 }, // Đ
+    { 16, 20, 14, 1, 19, 80, 13057 }, // đ
+    { 13, 21, 13, 1, 21, 69, 13137 }, // Ē
+    { 11, 18, 12, 1, 17, 50, 13206 }, // ē
+    { 13, 23, 13, 1, 23, 75, 13256 }, // Ĕ
+    { 12, 20, 12, 1, 19, 60, 13331 }, // ĕ
+    { 13, 23, 13, 1, 23, 75, 13391 }, // Ė
+    { 11, 20, 12, 1, 19, 55, 13466 }, // ė
+    { 13, 24, 13, 1, 18, 78, 13521 }, // Ę
+    { 11, 20, 12, 1, 14, 55, 13599 }, // ę
+    { 14, 24, 13, 1, 24, 84, 13654 }, // Ě
+    { 12, 21, 12, 1, 20, 63, 13738 }, // ě
+    { 16, 25, 17, 1, 24, 100, 13801 }, // Ĝ
+    { 14, 26, 14, 0, 20, 91, 13901 }, // ĝ
+    { 16, 24, 17, 1, 23, 96, 13992 }, // Ğ
+    { 14, 25, 14, 0, 19, 88, 14088 }, // ğ
+    { 16, 24, 17, 1, 23, 96, 14176 }, // Ġ
+    { 14, 25, 14, 0, 19, 88, 14336 }, // ġ
+    { 16, 25, 17, 1, 19, 100, 14424 }, // Ģ
+    { 14, 26, 14, 0, 20, 91, 14524 }, // ģ
+    { 17, 24, 17, 1, 24, 102, 14615 }, // Ĥ
+    { 14, 26, 14, 0, 26, 91, 14717 }, // ĥ
+    { 18, 18, 17, 1, 18, 81, 14808 }, // Ħ
+    { 14, 19, 14, 0, 19, 67, 14889 }, // ħ
+    { 13, 23, 8, -1, 23, 75, 14956 }, // Ĩ
+    { 10, 19, 6, 0, 19, 48, 15031 }, // ĩ
+    { 12, 21, 8, -1, 21, 63, 15079 }, // Ī
+    { 9, 17, 6, 0, 17, 39, 15142 }, // ī
+    { 12, 23, 8, -1, 23, 69, 15181 }, // Ĭ
+    { 10, 19, 6, 0, 19, 48, 15250 }, // ĭ
+    { 11, 24, 8, -1, 18, 66, 15298 }, // Į
+    { 8, 25, 6, -1, 19, 50, 15364 }, // į
+    { 11, 23, 8, -1, 23, 64, 15414 }, // İ
+    { 6, 14, 6, 0, 14, 21, 15478 }, // ı
+    { 17, 23, 15, -1, 18, 98, 15499 }, // Ĳ
+    { 14, 25, 13, 0, 19, 88, 15597 }, // ĳ
+    { 14, 29, 7, -4, 24, 102, 15685 }, // Ĵ
+    { 13, 26, 6, -4, 20, 85, 15787 }, // ĵ
+    { 16, 24, 14, 1, 18, 96, 15872 }, // Ķ
+    { 14, 25, 12, 0, 19, 88, 15968 }, // ķ
+    { 14, 14, 12, 0, 14, 49, 16056 }, // ĸ
+    { 10, 24, 12, 1, 24, 60, 16105 }, // Ĺ
+    { 11, 26, 6, 0, 26, 72, 16165 }, // ĺ
+    { 10, 24, 12, 1, 18, 60, 16237 }, // Ļ
+    { 8, 25, 6, -1, 19, 50, 16297 }, // ļ
+    { 12, 18, 12, 1, 18, 54, 16384 }, // Ľ
+    { 11, 19, 7, 0, 19, 53, 16438 }, // ľ
+    { 10, 18, 12, 1, 18, 45, 16491 }, // Ŀ
+    { 9, 19, 7, 0, 19, 43, 16536 }, // ŀ
+    { 11, 18, 12, 0, 18, 50, 16579 }, // Ł
+    { 8, 19, 6, 0, 19, 38, 16629 }, // ł
+    { 17, 24, 18, 1, 24, 102, 16667 }, // Ń
+    { 14, 20, 14, 0, 20, 70, 16769 }, // ń
+    { 17, 24, 18, 1, 18, 102, 16839 }, // Ņ
+    { 14, 20, 14, 0, 14, 70, 16941 }, // ņ
+    { 17, 24, 18, 1, 24, 102, 17011 }, // Ň
+    { 14, 20, 14, 0, 20, 70, 17113 }, // ň
+    { 15, 18, 16, 1, 18, 68, 17183 }, // ŉ
+    { 17, 23, 18, 1, 18, 98, 17251 }, // Ŋ
+    { 14, 20, 14, 0, 14, 70, 17349 }, // ŋ
+    { 17, 22, 18, 1, 21, 94, 17419 }, // Ō
+    { 12, 18, 14, 1, 17, 54, 17513 }, // ō
+    { 17, 24, 18, 1, 23, 102, 17567 }, // Ŏ
+    { 12, 20, 14, 1, 19, 60, 17669 }, // ŏ
+    { 18, 25, 18, 1, 24, 113, 17729 }, // Ő
+    { 14, 21, 14, 1, 20, 74, 17842 }, // ő
+    { 22, 20, 21, 1, 19, 110, 17916 }, // Œ
+    { 20, 15, 22, 1, 14, 75, 18026 }, // œ
+    { 14, 24, 14, 1, 24, 84, 18101 }, // Ŕ
+    { 12, 20, 10, 0, 20, 60, 18185 }, // ŕ
+    { 14, 24, 14, 1, 18, 84, 18245 }, // Ŗ
+    { 12, 20, 10, -1, 14, 60, 18329 }, // ŗ
+    { 14, 24, 14, 1, 24, 84, 18432 }, // Ř
+    { 13, 20, 10, 0, 20, 65, 18516 }, // ř
+    { 13, 25, 13, 0, 24, 82, 18581 }, // Ś
+    { 11, 21, 11, 0, 20, 58, 18663 }, // ś
+    { 13, 25, 13, 0, 24, 82, 18721 }, // Ŝ
+    { 11, 21, 11, 0, 20, 58, 18803 }, // ŝ
+    { 13, 25, 13, 0, 19, 82, 18861 }, // Ş
+    { 11, 20, 11, 0, 14, 55, 18943 }, // ş
+    { 14, 25, 13, 0, 24, 88, 18998 }, // Š
+    { 12, 21, 11, 0, 20, 63, 19086 }, // š
+    { 14, 24, 13, 1, 18, 84, 19149 }, // Ţ
+    { 10, 23, 8, 0, 17, 58, 19233 }, // ţ
+    { 13, 24, 13, 2, 24, 78, 19291 }, // Ť
+    { 11, 20, 8, 1, 19, 55, 19369 }, // ť
+    { 13, 18, 13, 2, 18, 59, 19424 }, // Ŧ
+    { 10, 18, 8, 0, 17, 45, 19483 }, // ŧ
+    { 17, 24, 17, 1, 23, 102, 19528 }, // Ũ
+    { 13, 20, 14, 1, 19, 65, 19630 }, // ũ
+    { 17, 22, 17, 1, 21, 94, 19695 }, // Ū
+    { 13, 18, 14, 1, 17, 59, 19789 }, // ū
+    { 17, 24, 17, 1, 23, 102, 19848 }, // Ŭ
+    { 13, 20, 14, 1, 19, 65, 19950 }, // ŭ
+    { 17, 26, 17, 1, 25, 111, 20015 }, // Ů
+    { 13, 22, 14, 1, 21, 72, 20126 }, // ů
+    { 17, 25, 17, 1, 24, 107, 20198 }, // Ű
+    { 15, 21, 14, 1, 20, 79, 20305 }, // ű
+    { 17, 24, 17, 1, 18, 102, 20480 }, // Ų
+    { 13, 20, 14, 1, 14, 65, 20582 }, // ų
+    { 22, 24, 21, 2, 24, 132, 20647 }, // Ŵ
+    { 19, 20, 18, 1, 20, 95, 20779 }, // ŵ
+    { 14, 24, 13, 2, 24, 84, 20874 }, // Ŷ
+    { 16, 26, 12, -3, 20, 104, 20958 }, // ŷ
+    { 14, 23, 13, 2, 23, 81, 21062 }, // Ÿ
+    { 16, 24, 13, -1, 24, 96, 21143 }, // Ź
+    { 13, 20, 11, -1, 20, 65, 21239 }, // ź
+    { 16, 23, 13, -1, 23, 92, 21304 }, // Ż
+    { 12, 19, 11, -1, 19, 57, 21396 }, // ż
+    { 16, 24, 13, -1, 24, 96, 21453 }, // Ž
+    { 13, 20, 11, -1, 20, 65, 21549 }, // ž
+    { 15, 26, 7, -4, 20, 98, 21614 }, // ſ
+    { 5, 5, 0, -10, 20, 7, 21712 }, // ̀
+    { 6, 5, 0, -6, 20, 8, 21719 }, // ́
+    { 9, 5, 0, -3, 20, 12, 21727 }, // ̂
+    { 10, 4, 0, -11, 19, 10, 21739 }, // ̃
+    { 8, 2, 0, -2, 17, 4, 21749 }, // ̄
+    { 11, 3, 0, -3, 22, 9, 21753 }, // ̅
+    { 8, 4, 0, -2, 19, 8, 21762 }, // ̆
+    { 4, 4, 0, 0, 19, 4, 21770 }, // ̇
+    { 8, 4, 0, -2, 19, 8, 21774 }, // ̈
+    { 6, 7, 0, -8, 21, 11, 21782 }, // ̉
+    { 7, 6, 0, -1, 21, 11, 21793 }, // ̊
+    { 10, 5, 0, -2, 20, 13, 21804 }, // ̋
+    { 9, 5, 0, -2, 20, 12, 21817 }, // ̌
+    { 4, 7, 0, 0, 19, 7, 21829 }, // ̍
+    { 8, 5, 0, -2, 19, 10, 21836 }, // ̎
+    { 10, 5, 0, -13, 20, 13, 21846 }, // ̏
+    { 9, 7, 0, -2, 22, 16, 21859 }, // ̐
+    { 8, 4, 0, -2, 19, 8, 21875 }, // ̑
+    { 6, 7, 0, -1, 18, 11, 21883 }, // ̒
+    { 6, 7, 0, -1, 18, 11, 21894 }, // ̓
+    { 4, 7, 0, 0, 18, 7, 21905 }, // ̔
+    { 6, 7, 0, -1, 18, 11, 21912 }, // ̕
+    { 5, 5, 0, -5, 0, 7, 21923 }, // ̖
+    { 6, 5, 0, -4, 0, 8, 21930 }, // ̗
+    { 6, 6, 0, -5, 0, 9, 21938 }, // ̘
+    { 6, 6, 0, -5, 0, 9, 21947 }, // ̙
+    { 8, 7, 8, 2, 19, 14, 21956 }, // ̚
+    { 6, 6, 0, -1, 19, 9, 21970 }, // ̛
+    { 5, 6, 0, -2, 0, 8, 21979 }, // ̜
+    { 6, 5, 0, -5, -1, 8, 21987 }, // ̝
+    { 7, 5, 0, -5, -1, 9, 21995 }, // ̞
+    { 6, 6, 0, -5, 0, 9, 22004 }, // ̟
+    { 6, 3, 0, -5, -2, 5, 22013 }, // ̠
+    { 6, 8, 0, -5, 2, 12, 22018 }, // ̡
+    { 5, 8, 0, -3, 2, 10, 22030 }, // ̢
+    { 4, 4, 0, -11, -1, 4, 22040 }, // ̣
+    { 8, 4, 0, -6, -1, 8, 22044 }, // ̤
+    { 6, 6, 0, -5, 0, 9, 22052 }, // ̥
+    { 5, 5, 0, 1, -1, 7, 22061 }, // ̦
+    { 6, 6, 0, -5, 0, 9, 22068 }, // ̧
+    { 5, 6, 0, -4, 0, 8, 22077 }, // ̨
+    { 4, 7, 0, -4, -1, 7, 22085 }, // ̩
+    { 10, 5, 0, -7, -1, 13, 22092 }, // ̪
+    { 11, 4, 0, -7, -1, 11, 22105 }, // ̫
+    { 9, 5, 0, -6, 0, 12, 22116 }, // ̬
+    { 8, 5, 0, -6, 0, 10, 22128 }, // ̭
+    { 9, 4, 0, -6, -1, 9, 22138 }, // ̮
+    { 8, 4, 0, -6, -1, 8, 22147 }, // ̯
+    { 10, 4, 0, -7, -1, 10, 22155 }, // ̰
+    { 8, 2, 0, -6, -2, 4, 22165 }, // ̱
+    { 12, 2, 0, -8, -2, 6, 22169 }, // ̲
+    { 12, 6, 0, -8, 0, 18, 22175 }, // ̳
+    { 10, 4, 0, -5, 9, 10, 22193 }, // ̴
+    { 10, 3, 0, -5, 9, 8, 22203 }, // ̵
+    { 18, 2, 0, -9, 8, 9, 22211 }, // ̶
+    { 8, 6, 0, -4, 10, 12, 22220 }, // ̷
+    { 14, 21, 0, -7, 19, 74, 22232 }, // ̸
+    { 4, 6, 0, -2, 0, 6, 22306 }, // ̹
+    { 10, 5, 0, -7, -1, 13, 22312 }, // ̺
+    { 10, 6, 0, -7, 0, 15, 22325 }, // ̻
+    { 10, 4, 0, -7, -1, 10, 22340 }, // ̼
+    { 7, 6, 0, -1, 20, 11, 22350 }, // ̽
+    { 6, 8, 0, -1, 22, 12, 22361 }, // ̾
+    { 12, 6, 0, -3, 25, 18, 22373 }, // ̿
+    { 6, 5, 0, -2, 20, 8, 22391 }, // ̀
+    { 7, 5, 0, 0, 20, 9, 22399 }, // ́
+    { 10, 4, 0, 4, 19, 10, 22408 }, // ͂
+    { 5, 5, 0, 0, 20, 7, 22418 }, // ̓
+    { 10, 5, 0, -3, 20, 13, 22425 }, // ̈́
+    { 4, 4, 0, -3, -2, 4, 22438 }, // ͅ
+    { 12, 6, 0, -4, 20, 18, 22442 }, // ͆
+    { 12, 6, 0, -8, 0, 18, 22460 }, // ͇
+    { 8, 5, 0, -6, -1, 10, 22478 }, // ͈
+    { 5, 5, 0, -4, -1, 7, 22488 }, // ͉
+    { 10, 6, 0, -3, 20, 15, 22495 }, // ͊
+    { 11, 10, 0, -3, 24, 28, 22528 }, // ͋
+    { 11, 7, 0, -3, 22, 20, 22556 }, // ͌
+    { 10, 6, 0, -7, 0, 15, 22576 }, // ͍
+    { 5, 6, 0, -4, 0, 8, 22591 }, // ͎
+    { 18, 18, 0, -9, 18, 81, 22599 }, // ͏
+    { 5, 6, 0, 0, 20, 8, 22680 }, // ͐
+    { 4, 6, 0, 3, 21, 6, 22688 }, // ͑
+    { 8, 7, 0, -2, 22, 14, 22694 }, // ͒
+    { 5, 6, 0, -4, 0, 8, 22708 }, // ͓
+    { 5, 5, 0, -4, -1, 7, 22716 }, // ͔
+    { 5, 5, 0, -4, -1, 7, 22723 }, // ͕
+    { 10, 5, 0, -6, -1, 13, 22730 }, // ͖
+    { 4, 6, 0, 2, 21, 6, 22743 }, // ͗
+    { 4, 4, 0, 0, 19, 4, 22749 }, // ͘
+    { 6, 6, 0, -5, 0, 9, 22753 }, // ͙
+    { 10, 6, 0, -7, 0, 15, 22762 }, // ͚
+    { 5, 6, 0, 0, 20, 8, 22777 }, // ͛
+    { 19, 5, 0, -11, -1, 24, 22785 }, // ͜
+    { 18, 5, 0, -7, 19, 23, 22809 }, // ͝
+    { 14, 2, 0, -5, 17, 7, 22832 }, // ͞
+    { 14, 2, 0, -9, -2, 7, 22839 }, // ͟
+    { 19, 4, 0, -7, 19, 19, 22846 }, // ͠
+    { 19, 6, 0, -7, 22, 29, 22865 }, // ͡
+    { 19, 6, 0, -12, 0, 29, 22894 }, // ͢
+    { 7, 6, 0, -1, 21, 11, 22923 }, // ͣ
+    { 5, 6, 0, 0, 21, 8, 22934 }, // ͤ
+    { 4, 8, 0, 1, 23, 8, 22942 }, // ͥ
+    { 7, 6, 0, -1, 21, 11, 22950 }, // ͦ
+    { 7, 6, 0, -1, 21, 11, 22961 }, // ͧ
+    { 6, 6, 0, 0, 21, 9, 22972 }, // ͨ
+    { 7, 9, 0, -1, 24, 16, 22981 }, // ͩ
+    { 7, 9, 0, -1, 24, 16, 22997 }, // ͪ
+    { 10, 6, 0, -3, 21, 15, 23013 }, // ͫ
+    { 6, 6, 0, 0, 21, 9, 23028 }, // ͬ
+    { 4, 8, 0, 1, 23, 8, 23037 }, // ͭ
+    { 6, 6, 0, 0, 21, 9, 23045 }, // ͮ
+    { 7, 6, 0, -1, 21, 11, 23054 }, // ͯ
+    { 14, 24, 13, 0, 24, 84, 23065 }, // Ѐ
+    { 14, 23, 13, 0, 23, 81, 23149 }, // Ё
+    { 14, 19, 17, 2, 18, 67, 23230 }, // Ђ
+    { 14, 24, 12, 0, 24, 84, 23297 }, // Ѓ
+    { 15, 20, 15, 1, 19, 75, 23381 }, // Є
+    { 13, 20, 13, 0, 19, 65, 23456 }, // Ѕ
+    { 7, 18, 7, 0, 18, 32, 23521 }, // І
+    { 10, 23, 7, 0, 23, 58, 23553 }, // Ї
+    { 12, 23, 7, -4, 18, 69, 23611 }, // Ј
+    { 24, 19, 23, -1, 18, 114, 23680 }, // Љ
+    { 22, 18, 23, 0, 18, 99, 23794 }, // Њ
+    { 14, 18, 17, 2, 18, 63, 23893 }, // Ћ
+    { 17, 24, 14, 0, 24, 102, 23956 }, // Ќ
+    { 18, 24, 17, 0, 24, 108, 24058 }, // Ѝ
+    { 17, 24, 14, 0, 23, 102, 24166 }, // Ў
+    { 17, 22, 17, 0, 18, 94, 24268 }, // Џ
+    { 15, 18, 14, -2, 18, 68, 24362 }, // А
+    { 15, 18, 14, 0, 18, 68, 24430 }, // Б
+    { 15, 18, 15, 0, 18, 68, 24498 }, // В
+    { 14, 18, 12, 0, 18, 63, 24576 }, // Г
+    { 21, 22, 17, -3, 18, 116, 24639 }, // Д
+    { 14, 18, 13, 0, 18, 63, 24755 }, // Е
+    { 25, 18, 20, -2, 18, 113, 24818 }, // Ж
+    { 14, 20, 13, -1, 19, 70, 24931 }, // З
+    { 18, 18, 17, 0, 18, 81, 25001 }, // И
+    { 18, 23, 17, 0, 23, 104, 25082 }, // Й
+    { 17, 18, 14, 0, 18, 77, 25186 }, // К
+    { 18, 19, 17, -1, 18, 86, 25263 }, // Л
+    { 21, 18, 21, 0, 18, 95, 25349 }, // М
+    { 17, 18, 17, 0, 18, 77, 25444 }, // Н
+    { 16, 20, 17, 1, 19, 80, 25521 }, // О
+    { 17, 18, 17, 0, 18, 77, 25601 }, // П
+    { 15, 18, 14, 0, 18, 68, 25678 }, // Р
+    { 15, 20, 15, 1, 19, 75, 25746 }, // С
+    { 13, 18, 13, 2, 18, 59, 25821 }, // Т
+    { 17, 19, 14, 0, 18, 81, 25880 }, // У
+    { 19, 20, 20, 1, 19, 95, 25961 }, // Ф
+    { 18, 18, 13, -2, 18, 81, 26056 }, // Х
+    { 17, 22, 17, 0, 18, 94, 26137 }, // Ц
+    { 14, 18, 16, 2, 18, 63, 26231 }, // Ч
+    { 24, 18, 24, 0, 18, 108, 26294 }, // Ш
+    { 24, 22, 24, 0, 18, 132, 26402 }, // Щ
+    { 13, 18, 16, 2, 18, 59, 26534 }, // Ъ
+    { 20, 18, 20, 0, 18, 90, 26624 }, // Ы
+    { 13, 18, 14, 0, 18, 59, 26714 }, // Ь
+    { 15, 20, 15, 0, 19, 75, 26773 }, // Э
+    { 23, 20, 24, 0, 19, 115, 26848 }, // Ю
+    { 16, 18, 14, -1, 18, 72, 26963 }, // Я
+    { 13, 15, 14, 1, 14, 49, 27035 }, // а
+    { 14, 21, 14, 1, 20, 74, 27084 }, // б
+    { 13, 15, 13, 0, 14, 49, 27158 }, // в
+    { 11, 15, 11, 0, 14, 42, 27207 }, // г
+    { 13, 21, 14, 1, 20, 69, 27249 }, // д
+    { 11, 15, 12, 1, 14, 42, 27318 }, // е
+    { 24, 15, 22, -1, 14, 90, 27360 }, // ж
+    { 11, 15, 11, 0, 14, 42, 27450 }, // з
+    { 13, 15, 14, 1, 14, 49, 27492 }, // и
+    { 13, 20, 14, 1, 19, 65, 27541 }, // й
+    { 14, 14, 13, 0, 14, 49, 27606 }, // к
+    { 16, 15, 14, -2, 14, 60, 27655 }, // л
+    { 19, 14, 19, 0, 14, 67, 27715 }, // м
+    { 14, 14, 14, 0, 14, 49, 27782 }, // н
+    { 14, 15, 14, 0, 14, 53, 27831 }, // о
+    { 13, 14, 14, 0, 14, 46, 27884 }, // п
+    { 15, 20, 14, -1, 14, 75, 27930 }, // р
+    { 12, 15, 12, 0, 14, 45, 28005 }, // с
+    { 21, 14, 22, 0, 14, 74, 28050 }, // т
+    { 17, 20, 12, -3, 14, 85, 28124 }, // у
+    { 16, 25, 17, 0, 19, 100, 28209 }, // ф
+    { 15, 14, 11, -2, 14, 53, 28309 }, // х
+    { 13, 18, 15, 1, 14, 59, 28362 }, // ц
+    { 13, 14, 14, 1, 14, 46, 28421 }, // ч
+    { 21, 15, 22, 1, 14, 79, 28467 }, // ш
+    { 21, 18, 22, 1, 14, 95, 28546 }, // щ
+    { 13, 15, 15, 1, 14, 49, 28672 }, // ъ
+    { 17, 15, 18, 1, 14, 64, 28721 }, // ы
+    { 11, 15, 13, 1, 14, 42, 28785 }, // ь
+    { 11, 15, 12, 0, 14, 42, 28827 }, // э
+    { 19, 15, 19, 0, 14, 72, 28869 }, // ю
+    { 14, 14, 13, -1, 14, 49, 28941 }, // я
+    { 11, 21, 12, 1, 20, 58, 28990 }, // ѐ
+    { 12, 20, 12, 1, 19, 60, 29048 }, // ё
+    { 13, 25, 14, 0, 19, 82, 29108 }, // ђ
+    { 12, 21, 11, 0, 20, 63, 29190 }, // ѓ
+    { 12, 15, 12, 0, 14, 45, 29253 }, // є
+    { 11, 15, 11, 0, 14, 42, 29298 }, // ѕ
+    { 7, 19, 6, 0, 19, 34, 29340 }, // і
+    { 9, 19, 6, 0, 19, 43, 29374 }, // ї
+    { 11, 25, 6, -4, 19, 69, 29417 }, // ј
+    { 22, 15, 20, -2, 14, 83, 29486 }, // љ
+    { 19, 15, 20, 0, 14, 72, 29569 }, // њ
+    { 14, 19, 14, 0, 19, 67, 29641 }, // ћ
+    { 14, 20, 13, 0, 20, 70, 29708 }, // ќ
+    { 13, 21, 14, 1, 20, 69, 29778 }, // ѝ
+    { 17, 25, 12, -3, 19, 107, 29847 }, // ў
+    { 13, 19, 14, 1, 14, 62, 29954 }, // џ
+    { 23, 19, 23, 2, 18, 110, 30016 }, // Ѡ
+    { 20, 14, 20, 1, 14, 70, 30126 }, // ѡ
+    { 13, 18, 15, 1, 18, 59, 30196 }, // Ѣ
+    { 20, 15, 21, 0, 14, 75, 30255 }, // ѣ
+    { 22, 20, 22, 1, 19, 110, 30330 }, // Ѥ
+    { 18, 15, 17, 0, 14, 68, 30440 }, // ѥ
+    { 16, 18, 15, -2, 18, 72, 30508 }, // Ѧ
+    { 14, 14, 13, -2, 14, 49, 30580 }, // ѧ
+    { 19, 18, 21, 1, 18, 86, 30629 }, // Ѩ
+    { 17, 14, 18, 0, 14, 60, 30720 }, // ѩ
+    { 19, 18, 17, -1, 18, 86, 30780 }, // Ѫ
+    { 17, 14, 15, -2, 14, 60, 30866 }, // ѫ
+    { 23, 18, 23, 1, 18, 104, 30926 }, // Ѭ
+    { 20, 14, 20, 0, 14, 70, 31030 }, // ѭ
+    { 15, 28, 13, -1, 22, 105, 31100 }, // Ѯ
+    { 14, 22, 11, -2, 17, 77, 31205 }, // ѯ
+    { 19, 18, 19, 2, 18, 86, 31282 }, // Ѱ
+    { 16, 25, 18, 1, 19, 100, 31368 }, // ѱ
+    { 17, 20, 18, 1, 19, 85, 31468 }, // Ѳ
+    { 12, 15, 14, 1, 14, 45, 31553 }, // ѳ
+    { 15, 18, 14, 2, 18, 68, 31598 }, // Ѵ
+    { 13, 14, 11, 1, 14, 46, 31666 }, // ѵ
+    { 15, 24, 14, 2, 24, 90, 31712 }, // Ѷ
+    { 13, 20, 11, 1, 20, 65, 31802 }, // ѷ
+    { 30, 25, 30, 1, 19, 188, 31867 }, // Ѹ
+    { 26, 20, 26, 1, 14, 130, 32055 }, // ѹ
+    { 17, 22, 19, 1, 20, 94, 32185 }, // Ѻ
+    { 13, 17, 15, 1, 15, 56, 32279 }, // ѻ
+    { 23, 27, 24, 1, 26, 156, 32335 }, // Ѽ
+    { 18, 23, 20, 1, 22, 104, 32491 }, // ѽ
+    { 23, 24, 23, 2, 23, 138, 32595 }, // Ѿ
+    { 20, 18, 20, 1, 18, 90, 32768 }, // ѿ
+    { 15, 25, 15, 1, 19, 94, 32858 }, // Ҁ
+    { 11, 20, 11, 1, 14, 55, 32952 }, // ҁ
+    { 14, 17, 15, 1, 16, 60, 33007 }, // ҂
+    { 10, 4, 0, -10, 18, 10, 33067 }, // ҃
+    { 10, 4, 0, -10, 19, 10, 33077 }, // ҄
+    { 4, 5, 0, -7, 20, 5, 33087 }, // ҅
+    { 4, 5, 0, -7, 20, 5, 33092 }, // ҆
+    { 10, 4, 0, -2, 23, 10, 33097 }, // ҇
+    { 30, 27, 0, -15, 20, 203, 33107 }, // ҈
+    { 28, 28, 0, -14, 21, 196, 33310 }, // ҉
+    { 17, 29, 18, 1, 24, 124, 33506 }, // Ҋ
+    { 13, 24, 15, 1, 19, 78, 33630 }, // ҋ
+    { 12, 18, 14, 1, 18, 54, 33708 }, // Ҍ
+    { 11, 20, 13, 1, 19, 55, 33762 }, // ҍ
+    { 14, 18, 14, 1, 18, 63, 33817 }, // Ҏ
+    { 15, 20, 14, -1, 14, 75, 33880 }, // ҏ
+    { 14, 22, 12, 1, 22, 77, 33955 }, // Ґ
+    { 12, 18, 10, 0, 18, 54, 34032 }, // ґ
+    { 14, 18, 12, 0, 18, 63, 34086 }, // Ғ
+    { 11, 14, 10, 0, 14, 39, 34149 }, // ғ
+    { 13, 25, 15, 1, 18, 82, 34188 }, // Ҕ
+    { 11, 21, 12, 0, 14, 58, 34270 }, // ҕ
+    { 24, 23, 21, -2, 18, 138, 34328 }, // Җ
+    { 23, 19, 21, -1, 14, 110, 34466 }, // җ
+    { 14, 25, 13, -1, 19, 88, 34576 }, // Ҙ
+    { 11, 20, 11, 0, 14, 55, 34664 }, // ҙ
+    { 16, 23, 15, 1, 18, 92, 34719 }, // Қ
+    { 14, 19, 13, 0, 14, 67, 34816 }, // қ
+    { 16, 18, 14, 1, 18, 72, 34883 }, // Ҝ
+    { 14, 14, 12, 0, 14, 49, 34955 }, // ҝ
+    { 16, 18, 14, 1, 18, 72, 35004 }, // Ҟ
+    { 14, 19, 12, 0, 19, 67, 35076 }, // ҟ
+    { 17, 18, 16, 2, 18, 77, 35143 }, // Ҡ
+    { 16, 14, 14, 0, 14, 56, 35220 }, // ҡ
+    { 17, 23, 17, 1, 18, 98, 35276 }, // Ң
+    { 15, 19, 15, 0, 14, 72, 35374 }, // ң
+    { 21, 18, 19, 1, 18, 95, 35446 }, // Ҥ
+    { 19, 14, 17, 0, 14, 67, 35541 }, // ҥ
+    { 22, 25, 25, 1, 18, 138, 35608 }, // Ҧ
+    { 19, 21, 21, 0, 14, 100, 35746 }, // ҧ
+    { 17, 21, 18, 1, 19, 90, 35846 }, // Ҩ
+    { 13, 15, 15, 1, 14, 49, 35936 }, // ҩ
+    { 15, 25, 15, 1, 19, 94, 35985 }, // Ҫ
+    { 11, 20, 11, 1, 14, 55, 36079 }, // ҫ
+    { 13, 23, 13, 2, 18, 75, 36134 }, // Ҭ
+    { 21, 19, 22, 0, 14, 100, 36209 }, // ҭ
+    { 14, 18, 13, 2, 18, 63, 36309 }, // Ү
+    { 12, 20, 12, 1, 14, 60, 36372 }, // ү
+    { 15, 18, 13, 1, 18, 68, 36432 }, // Ұ
+    { 14, 20, 12, -1, 14, 70, 36500 }, // ұ
+    { 18, 23, 15, -2, 18, 104, 36570 }, // Ҳ
+    { 15, 19, 13, -1, 14, 72, 36674 }, // ҳ
+    { 18, 23, 20, 2, 18, 104, 36746 }, // Ҵ
+    { 15, 19, 16, 1, 14, 72, 36864 }, // ҵ
+    { 15, 23, 16, 2, 18, 87, 36936 }, // Ҷ
+    { 13, 19, 14, 1, 14, 62, 37023 }, // ҷ
+    { 15, 18, 16, 2, 18, 68, 37085 }, // Ҹ
+    { 13, 14, 14, 1, 14, 46, 37153 }, // ҹ
+    { 14, 18, 16, 1, 18, 63, 37199 }, // Һ
+    { 14, 19, 14, 0, 19, 67, 37262 }, // һ
+    { 18, 20, 19, 1, 19, 90, 37329 }, // Ҽ
+    { 15, 15, 15, 0, 14, 57, 37419 }, // ҽ
+    { 18, 24, 19, 1, 19, 108, 37476 }, // Ҿ
+    { 15, 19, 15, 0, 14, 72, 37584 }, // ҿ
+    { 11, 18, 8, -1, 18, 50, 37656 }, // Ӏ
+    { 25, 23, 20, -2, 23, 144, 37706 }, // Ӂ
+    { 24, 20, 22, -1, 19, 120, 37850 }, // ӂ
+    { 16, 25, 16, 1, 18, 100, 37970 }, // Ӄ
+    { 14, 21, 13, 0, 14, 74, 38070 }, // ӄ
+    { 18, 23, 17, -1, 18, 104, 38144 }, // Ӆ
+    { 15, 19, 14, -2, 14, 72, 38248 }, // ӆ
+    { 17, 25, 17, 1, 18, 107, 38320 }, // Ӈ
+    { 15, 21, 15, 0, 14, 79, 38427 }, // ӈ
+    { 17, 23, 17, 1, 18, 98, 38506 }, // Ӊ
+    { 15, 19, 15, 0, 14, 72, 38604 }, // ӊ
+    { 15, 23, 16, 2, 18, 87, 38676 }, // Ӌ
+    { 12, 19, 15, 2, 14, 57, 38763 }, // ӌ
+    { 21, 23, 21, 1, 18, 121, 38912 }, // Ӎ
+    { 17, 19, 18, 0, 14, 81, 39033 }, // ӎ
+    { 11, 18, 8, -1, 18, 50, 39114 }, // ӏ
+    { 17, 23, 14, -2, 23, 98, 39164 }, // Ӑ
+    { 13, 20, 14, 1, 19, 65, 39262 }, // ӑ
+    { 16, 23, 14, -2, 23, 92, 39327 }, // Ӓ
+    { 13, 20, 14, 1, 19, 65, 39419 }, // ӓ
+    { 24, 18, 21, -2, 18, 108, 39484 }, // Ӕ
+    { 19, 15, 21, 1, 14, 72, 39592 }, // ӕ
+    { 14, 23, 13, 1, 23, 81, 39664 }, // Ӗ
+    { 13, 20, 12, 1, 19, 65, 39745 }, // ӗ
+    { 15, 20, 17, 1, 19, 75, 39810 }, // Ә
+    { 12, 15, 12, 0, 14, 45, 39885 }, // ә
+    { 15, 24, 17, 1, 23, 90, 39930 }, // Ӛ
+    { 12, 20, 12, 0, 19, 60, 40020 }, // ӛ
+    { 25, 23, 20, -2, 23, 144, 40080 }, // Ӝ
+    { 24, 20, 22, -1, 19, 120, 40224 }, // ӝ
+    { 14, 24, 13, -1, 23, 84, 40344 }, // Ӟ
+    { 11, 20, 11, 0, 19, 55, 40428 }, // ӟ
+    { 14, 19, 13, 0, 18, 67, 40483 }, // Ӡ
+    { 14, 20, 12, -2, 14, 70, 40550 }, // ӡ
+    { 18, 21, 17, 0, 21, 95, 40620 }, // Ӣ
+    { 13, 18, 14, 1, 17, 59, 40715 }, // ӣ
+    { 18, 23, 17, 0, 23, 104, 40774 }, // Ӥ
+    { 13, 20, 14, 1, 19, 65, 40878 }, // ӥ
+    { 17, 24, 18, 1, 23, 102, 40960 }, // Ӧ
+    { 12, 20, 14, 1, 19, 60, 41062 }, // ӧ
+    { 17, 20, 18, 1, 19, 85, 41122 }, // Ө
+    { 12, 15, 14, 1, 14, 45, 41207 }, // ө
+    { 17, 24, 18, 1, 23, 102, 41252 }, // Ӫ
+    { 12, 20, 14, 1, 19, 60, 41354 }, // ӫ
+    { 15, 24, 15, 0, 23, 90, 41414 }, // Ӭ
+    { 11, 20, 12, 0, 19, 55, 41504 }, // ӭ
+    { 17, 22, 14, 0, 21, 94, 41559 }, // Ӯ
+    { 16, 23, 12, -3, 17, 92, 41653 }, // ӯ
+    { 17, 24, 14, 0, 23, 102, 41745 }, // Ӱ
+    { 16, 25, 12, -3, 19, 100, 41847 }, // ӱ
+    { 17, 25, 14, 0, 24, 107, 41947 }, // Ӳ
+    { 17, 26, 12, -3, 20, 111, 42054 }, // ӳ
+    { 14, 23, 16, 2, 23, 81, 42165 }, // Ӵ
+    { 13, 19, 14, 1, 19, 62, 42246 }, // ӵ
+    { 13, 23, 12, 1, 18, 75, 42308 }, // Ӷ
+    { 11, 19, 10, 0, 14, 53, 42383 }, // ӷ
+    { 20, 23, 20, 0, 23, 115, 42436 }, // Ӹ
+    { 17, 20, 18, 1, 19, 85, 42551 }, // ӹ
+    { 14, 23, 12, 0, 18, 81, 42636 }, // Ӻ
+    { 12, 19, 10, -1, 14, 57, 42717 }, // ӻ
+    { 18, 23, 13, -2, 18, 104, 42774 }, // Ӽ
+    { 14, 19, 12, -1, 14, 67, 42878 }, // ӽ
+    { 18, 18, 13, -2, 18, 81, 43008 }, // Ӿ
+    { 14, 14, 12, -1, 14, 49, 43089 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 43138 }, //  
+    { 0, 0, 25, 0, 0, 0, 43138 }, //  
+    { 0, 0, 13, 0, 0, 0, 43138 }, //  
+    { 0, 0, 25, 0, 0, 0, 43138 }, //  
+    { 0, 0, 8, 0, 0, 0, 43138 }, //  
+    { 0, 0, 6, 0, 0, 0, 43138 }, //  
+    { 0, 0, 4, 0, 0, 0, 43138 }, //  
+    { 0, 0, 14, 0, 0, 0, 43138 }, //  
+    { 0, 0, 6, 0, 0, 0, 43138 }, //  
+    { 0, 0, 4, 0, 0, 0, 43138 }, //  
+    { 0, 0, 3, 0, 0, 0, 43138 }, //  
+    { 0, 0, 0, 0, 0, 0, 43138 }, // ​
+    { 0, 0, 0, 0, 0, 0, 43138 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 43138 }, // ‍
+    { 7, 22, 0, -1, 18, 39, 43138 }, // ‎
+    { 7, 22, 0, -6, 18, 39, 43177 }, // ‏
+    { 7, 3, 8, 0, 8, 6, 43216 }, // ‐
+    { 7, 3, 8, 0, 8, 6, 43222 }, // ‑
+    { 13, 2, 14, 1, 10, 7, 43228 }, // ‒
+    { 12, 3, 12, 0, 8, 9, 43235 }, // –
+    { 24, 3, 24, 0, 8, 18, 43244 }, // —
+    { 24, 3, 24, 0, 8, 18, 43262 }, // ―
+    { 9, 26, 14, 3, 19, 59, 43280 }, // ‖
+    { 12, 6, 10, -3, 0, 18, 43339 }, // ‗
+    { 6, 7, 4, 1, 18, 11, 43357 }, // ‘
+    { 6, 7, 4, 1, 18, 11, 43368 }, // ’
+    { 6, 7, 6, -2, 3, 11, 43379 }, // ‚
+    { 4, 7, 4, 2, 18, 7, 43390 }, // ‛
+    { 11, 7, 9, 1, 18, 20, 43397 }, // “
+    { 11, 7, 9, 1, 18, 20, 43417 }, // ”
+    { 11, 7, 11, -2, 3, 20, 43437 }, // „
+    { 8, 7, 9, 2, 18, 14, 43457 }, // ‟
+    { 10, 19, 12, 2, 19, 48, 43471 }, // †
+    { 13, 19, 12, 0, 19, 62, 43519 }, // ‡
+    { 6, 7, 9, 2, 13, 11, 43581 }, // •
+    { 8, 8, 9, 1, 13, 16, 43592 }, // ‣
+    { 4, 5, 13, 3, 4, 5, 43608 }, // ․
+    { 10, 5, 13, 0, 4, 13, 43613 }, // ‥
+    { 17, 5, 19, 0, 4, 22, 43626 }, // …
+    { 4, 5, 6, 1, 9, 5, 43648 }, // ‧
+    { 0, 0, 15, 0, 0, 0, 43653 }, //  
+    { 0, 0, 15, 0, 0, 0, 43653 }, //  
+    { 7, 20, 0, -1, 16, 35, 43653 }, // ‪
+    { 7, 20, 0, -6, 16, 35, 43688 }, // ‫
+    { 6, 22, 0, -3, 18, 33, 43723 }, // ‬
+    { 6, 22, 0, -3, 18, 33, 43756 }, // ‭
+    { 6, 22, 0, -3, 18, 33, 43789 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 43822 }, //  
+    { 26, 20, 28, 2, 19, 130, 43822 }, // ‰
+    { 34, 20, 36, 2, 19, 170, 43952 }, // ‱
+    { 7, 7, 6, 1, 18, 13, 44122 }, // ′
+    { 11, 7, 10, 1, 18, 20, 44135 }, // ″
+    { 15, 7, 14, 1, 18, 27, 44155 }, // ‴
+    { 4, 7, 7, 3, 18, 7, 44182 }, // ‵
+    { 8, 7, 11, 3, 18, 14, 44189 }, // ‶
+    { 12, 7, 14, 3, 18, 21, 44203 }, // ‷
+    { 10, 9, 10, -3, 3, 23, 44224 }, // ‸
+    { 6, 11, 7, 1, 12, 17, 44247 }, // ‹
+    { 7, 11, 7, 0, 12, 20, 44264 }, // ›
+    { 19, 20, 21, 1, 19, 95, 44284 }, // ※
+    { 13, 19, 12, 0, 18, 62, 44379 }, // ‼
+    { 11, 20, 11, 1, 19, 55, 44441 }, // ‽
+    { 11, 2, 10, 2, 21, 6, 44496 }, // ‾
+    { 14, 6, 14, -2, 0, 21, 44502 }, // ‿
+    { 13, 6, 14, 2, 20, 20, 44523 }, // ⁀
+    { 12, 17, 9, -3, 11, 51, 44543 }, // ⁁
+    { 27, 24, 28, 0, 20, 162, 44594 }, // ⁂
+    { 7, 3, 7, 0, 8, 6, 44756 }, // ⁃
+    { 16, 18, 3, -6, 18, 72, 44762 }, // ⁄
+    { 11, 22, 7, -1, 18, 61, 44834 }, // ⁅
+    { 10, 22, 7, -2, 18, 55, 44895 }, // ⁆
+    { 22, 20, 22, 1, 19, 110, 45056 }, // ⁇
+    { 17, 20, 17, 1, 19, 85, 45166 }, // ⁈
+    { 18, 20, 17, 0, 19, 90, 45251 }, // ⁉
+    { 13, 14, 13, 1, 14, 46, 45341 }, // ⁊
+    { 13, 23, 15, 2, 19, 75, 45387 }, // ⁋
+    { 13, 14, 16, 1, 14, 46, 45462 }, // ⁌
+    { 13, 14, 16, 2, 14, 46, 45508 }, // ⁍
+    { 13, 13, 14, -1, 7, 43, 45554 }, // ⁎
+    { 6, 18, 6, 0, 14, 27, 45597 }, // ⁏
+    { 17, 26, 14, -2, 20, 111, 45624 }, // ⁐
+    { 15, 26, 14, 0, 20, 98, 45735 }, // ⁑
+    { 10, 20, 9, 0, 19, 50, 45833 }, // ⁒
+    { 22, 5, 25, 2, 10, 28, 45883 }, // ⁓
+    { 14, 6, 14, -3, 0, 21, 45911 }, // ⁔
+    { 14, 14, 14, 0, 13, 49, 45932 }, // ⁕
+    { 11, 20, 13, 1, 19, 55, 45981 }, // ⁖
+    { 19, 7, 18, 1, 18, 34, 46036 }, // ⁗
+    { 19, 20, 21, 1, 19, 95, 46070 }, // ⁘
+    { 19, 20, 21, 1, 19, 95, 46165 }, // ⁙
+    { 4, 20, 6, 1, 19, 20, 46260 }, // ⁚
+    { 15, 20, 16, 1, 19, 75, 46280 }, // ⁛
+    { 19, 20, 20, 0, 19, 95, 46355 }, // ⁜
+    { 4, 19, 7, 1, 18, 19, 46450 }, // ⁝
+    { 4, 20, 7, 2, 19, 20, 46469 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 46489 }, //  
+    { 0, 0, 15, 0, 0, 0, 46489 }, // ⁠
+    { 0, 0, 15, 0, 0, 0, 46489 }, // ⁡
+    { 0, 0, 15, 0, 0, 0, 46489 }, // ⁢
+    { 0, 0, 15, 0, 0, 0, 46489 }, // ⁣
+    { 0, 0, 15, 0, 0, 0, 46489 }, // ⁤
+    { 0, 0, 15, 0, 0, 0, 46489 }, // ⁦
+    { 0, 0, 15, 0, 0, 0, 46489 }, // ⁧
+    { 0, 0, 15, 0, 0, 0, 46489 }, // ⁨
+    { 0, 0, 15, 0, 0, 0, 46489 }, // ⁩
+    { 6, 22, 0, -3, 18, 33, 46489 }, // ⁪
+    { 6, 22, 0, -3, 18, 33, 46522 }, // ⁫
+    { 6, 22, 0, -3, 18, 33, 46555 }, // ⁬
+    { 6, 22, 0, -3, 18, 33, 46588 }, // ⁭
+    { 6, 22, 0, -3, 18, 33, 46621 }, // ⁮
+    { 6, 22, 0, -3, 18, 33, 46654 }, // ⁯
+    { 9, 12, 9, 2, 22, 27, 46687 }, // ⁰
+    { 4, 12, 6, 2, 19, 12, 46714 }, // ⁱ
+    { 9, 12, 9, 1, 22, 27, 46726 }, // ⁴
+    { 9, 12, 9, 2, 22, 27, 46753 }, // ⁵
+    { 9, 12, 9, 2, 22, 27, 46780 }, // ⁶
+    { 9, 12, 9, 2, 22, 27, 46807 }, // ⁷
+    { 9, 12, 9, 2, 22, 27, 46834 }, // ⁸
+    { 9, 12, 9, 2, 22, 27, 46861 }, // ⁹
+    { 8, 8, 8, 2, 19, 16, 46888 }, // ⁺
+    { 8, 2, 8, 2, 16, 4, 46904 }, // ⁻
+    { 8, 5, 8, 2, 18, 10, 46908 }, // ⁼
+    { 7, 14, 5, 2, 23, 25, 46918 }, // ⁽
+    { 6, 14, 5, 0, 23, 21, 46943 }, // ⁾
+    { 9, 9, 9, 1, 16, 21, 46964 }, // ⁿ
+    { 9, 12, 9, -1, 8, 27, 46985 }, // ₀
+    { 6, 12, 9, 0, 8, 18, 47012 }, // ₁
+    { 9, 12, 9, -2, 8, 27, 47030 }, // ₂
+    { 8, 12, 9, -1, 8, 24, 47057 }, // ₃
+    { 9, 12, 9, -1, 8, 27, 47104 }, // ₄
+    { 9, 12, 9, -1, 8, 27, 47131 }, // ₅
+    { 9, 12, 9, -1, 8, 27, 47158 }, // ₆
+    { 9, 12, 9, -1, 8, 27, 47185 }, // ₇
+    { 9, 12, 9, -1, 8, 27, 47212 }, // ₈
+    { 9, 12, 9, -1, 8, 27, 47239 }, // ₉
+    { 8, 8, 8, -1, 6, 16, 47266 }, // ₊
+    { 8, 2, 8, -1, 3, 4, 47282 }, // ₋
+    { 8, 5, 8, -1, 5, 10, 47286 }, // ₌
+    { 6, 14, 5, 0, 9, 21, 47296 }, // ₍
+    { 6, 14, 5, -3, 9, 21, 47317 }, // ₎
+    { 9, 9, 9, -1, 6, 21, 47338 }, // ₐ
+    { 8, 9, 8, -1, 6, 18, 47359 }, // ₑ
+    { 9, 9, 9, -1, 6, 21, 47377 }, // ₒ
+    { 9, 9, 8, -2, 6, 21, 47398 }, // ₓ
+    { 7, 9, 8, -1, 6, 16, 47419 }, // ₔ
+    { 9, 12, 11, 0, 9, 27, 47435 }, // ₕ
+    { 9, 12, 9, 0, 9, 27, 47462 }, // ₖ
+    { 5, 12, 6, 0, 9, 15, 47489 }, // ₗ
+    { 14, 9, 16, 0, 6, 32, 47504 }, // ₘ
+    { 9, 9, 9, -1, 6, 21, 47536 }, // ₙ
+    { 10, 12, 9, -2, 6, 30, 47557 }, // ₚ
+    { 7, 9, 8, -1, 6, 16, 47587 }, // ₛ
+    { 6, 11, 5, -1, 8, 17, 47603 }, // ₜ
+    { 14, 19, 14, 1, 19, 67, 47620 }, // ₠
+    { 14, 21, 14, 1, 19, 74, 47687 }, // ₡
+    { 14, 20, 14, 1, 19, 70, 47761 }, // ₢
+    { 15, 18, 14, 0, 18, 68, 47831 }, // ₣
+    { 16, 19, 14, -1, 19, 76, 47899 }, // ₤
+    { 21, 20, 22, 0, 17, 105, 47975 }, // ₥
+    { 15, 18, 14, 0, 18, 68, 48080 }, // ₦
+    { 18, 19, 18, 0, 18, 86, 48148 }, // ₧
+    { 21, 19, 20, 0, 18, 100, 48234 }, // ₨
+    { 18, 18, 16, 0, 18, 81, 48334 }, // ₩
+    { 21, 18, 20, 0, 18, 95, 48415 }, // ₪
+    { 17, 23, 14, 0, 19, 98, 48510 }, // ₫
+    { 16, 20, 14, 0, 19, 80, 48608 }, // €
+    { 17, 18, 14, 0, 18, 77, 48688 }, // ₭
+    { 14, 18, 13, 1, 18, 63, 48765 }, // ₮
+    { 24, 25, 24, 0, 19, 150, 48828 }, // ₯
+    { 16, 25, 14, -2, 19, 100, 48978 }, // ₰
+    { 16, 18, 14, 0, 18, 72, 49078 }, // ₱
+    { 16, 21, 17, 1, 19, 84, 49152 }, // ₲
+    { 17, 18, 14, -2, 18, 77, 49236 }, // ₳
+    { 15, 20, 13, -1, 19, 75, 49313 }, // ₴
+    { 15, 21, 15, 1, 19, 79, 49388 }, // ₵
+    { 16, 18, 14, 0, 17, 72, 49467 }, // ₶
+    { 18, 21, 16, -1, 19, 95, 49539 }, // ₷
+    { 14, 18, 12, 1, 18, 63, 49634 }, // ₸
+    { 13, 18, 14, 2, 18, 59, 49697 }, // ₹
+    { 14, 19, 14, 0, 18, 67, 49756 }, // ₺
+    { 16, 20, 17, 1, 19, 80, 49823 }, // ₻
+    { 19, 18, 19, -1, 18, 86, 49903 }, // ₼
+    { 16, 18, 15, -1, 18, 72, 49989 }, // ₽
+    { 17, 21, 15, -1, 21, 90, 50061 }, // ₾
+    { 13, 24, 14, 1, 21, 78, 50151 }, // ₿
+    { 7, 3, 8, 0, 8, 6, 50229 }, // −
+    { 23, 23, 25, 1, 19, 133, 50235 }, // �
 };
 
 static const EpdUnicodeInterval notosans_12_italicIntervals[] = {
@@ -4007,4 +2826,9 @@ static const EpdFontData notosans_12_italic = {
     27,
     -8,
     true,
+    notosans_12_italicBlockOffsets,
+    notosans_12_italicDirectGlyphs,
+    notosans_12_italicGlyphPages,
+    256,
+    notosans_12_italicPageGlyphs,
 };
@@ -2,2899 +2,1708 @@
  * generated by fontconvert.py
  * name: notosans_12_regular
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py notosans_12_regular 12 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_12_regular 12 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_regularBitmaps[46164] = {
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x3E,
-    0x3F, 0x3E, 0x04, 0x7C, 0x2D, 0x7C, 0x2D, 0x3C, 0x2D, 0x38, 0x2D, 0x38, 0x1C, 0x38, 0x1C, 0x24,
-    0x08, 0x00, 0x0B, 0x01, 0xC0, 0x00, 0x0E, 0x02, 0xC0, 0x00, 0x0E, 0x03, 0xC0, 0x00, 0x1D, 0x03,
-    0x80, 0x00, 0x2C, 0x03, 0x80, 0x0A, 0xBE, 0xAB, 0xA9, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x78, 0x0F,
-    0x00, 0x00, 0x74, 0x0E, 0x00, 0x00, 0xB0, 0x0E, 0x00, 0x00, 0xF0, 0x1D, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x01, 0xD0, 0x3C, 0x00, 0x02, 0xC0, 0x38, 0x00, 0x02, 0xC0, 0x74,
-    0x00, 0x03, 0xC0, 0xB0, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x01,
-    0xBF, 0x90, 0x1F, 0xFF, 0xFC, 0x3E, 0x6C, 0x68, 0x7C, 0x2C, 0x00, 0x7C, 0x2C, 0x00, 0x7C, 0x2C,
-    0x00, 0x3F, 0xBC, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x2D, 0xFD, 0x00, 0x2C, 0x2F,
-    0x00, 0x2C, 0x1F, 0x00, 0x2C, 0x2F, 0x79, 0x2D, 0xBD, 0x7F, 0xFF, 0xF4, 0x1A, 0xBE, 0x40, 0x00,
-    0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0xB0, 0x03, 0xEB, 0x80, 0x07, 0x80, 0x1D, 0x0B, 0x00, 0x3C, 0x00, 0xB0, 0x1D, 0x01, 0xD0, 0x02,
-    0xC0, 0x38, 0x0F, 0x00, 0x0F, 0x00, 0xE0, 0xB4, 0x00, 0x2C, 0x03, 0x83, 0xC0, 0x00, 0xB0, 0x1D,
-    0x2C, 0x2F, 0x81, 0xE0, 0xB1, 0xE3, 0xEF, 0x83, 0xEB, 0xCF, 0x1E, 0x0F, 0x03, 0xF8, 0x78, 0xB0,
-    0x1D, 0x00, 0x03, 0xC3, 0xC0, 0x74, 0x00, 0x1D, 0x0F, 0x01, 0xE0, 0x00, 0xF0, 0x3C, 0x07, 0x80,
-    0x0B, 0x40, 0xB0, 0x1D, 0x00, 0x3C, 0x01, 0xD0, 0xB0, 0x02, 0xC0, 0x03, 0xDB, 0xC0, 0x1E, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x07, 0xFB, 0xF4, 0x00, 0x00, 0xF8, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x07,
-    0xC0, 0x00, 0x0B, 0x80, 0xF8, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xEF, 0x40, 0x0F, 0x03, 0xF0, 0x7E, 0x01, 0xE0, 0x7C, 0x01, 0xF8,
-    0x3D, 0x0B, 0x80, 0x07, 0xE7, 0xC0, 0xB8, 0x00, 0x1F, 0xF4, 0x0B, 0xC0, 0x00, 0xBF, 0x00, 0x3E,
-    0x00, 0x2F, 0xF8, 0x02, 0xFF, 0xBF, 0xD7, 0xE0, 0x07, 0xFF, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0xF3, 0xCE, 0x38, 0xE2, 0x40, 0x02, 0xD0, 0x7C, 0x0F, 0x41, 0xF0, 0x3D, 0x03, 0xC0,
-    0x7C, 0x0B, 0x80, 0xF4, 0x0F, 0x40, 0xF0, 0x0F, 0x00, 0xF4, 0x0F, 0x40, 0xB8, 0x0B, 0xC0, 0x3C,
-    0x03, 0xD0, 0x2F, 0x00, 0xF0, 0x07, 0xC0, 0x2D, 0x3C, 0x00, 0x7C, 0x00, 0xF4, 0x01, 0xF0, 0x03,
-    0xD0, 0x0B, 0x80, 0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x03, 0xD0, 0x0B, 0x40, 0x2D, 0x00, 0xF4, 0x03,
-    0xD0, 0x0F, 0x00, 0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xE0, 0x1F, 0x00, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x40, 0x38, 0x04, 0xFE, 0x79, 0xFE, 0xBF, 0xFF,
-    0xFE, 0x00, 0xFD, 0x00, 0x01, 0xEF, 0x00, 0x03, 0xC7, 0xC0, 0x0F, 0x83, 0xE0, 0x0B, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0xAA, 0xBE, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x3C, 0x7C, 0xB4, 0xF0,
-    0x00, 0xAA, 0xA3, 0xFF, 0xC5, 0x55, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x03, 0xC0, 0x00,
-    0xB8, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x40,
-    0x00, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x1E,
-    0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0xFF, 0xFF, 0x00, 0xBC, 0x03, 0xE0, 0x3D, 0x00, 0x3C, 0x1F, 0x00, 0x0B, 0x8B, 0x80, 0x01, 0xF2,
-    0xE0, 0x00, 0x7C, 0xB4, 0x00, 0x0F, 0x3D, 0x00, 0x03, 0xCF, 0x40, 0x00, 0xF2, 0xD0, 0x00, 0x3C,
-    0xB8, 0x00, 0x1F, 0x1E, 0x00, 0x07, 0xC7, 0xC0, 0x02, 0xE0, 0xF4, 0x00, 0xF4, 0x1F, 0x00, 0xBC,
-    0x03, 0xFA, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0B, 0xF0, 0xFF, 0xDF,
-    0x9F, 0x74, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00,
-    0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80,
-    0x3F, 0xFF, 0xF0, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D,
-    0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x7F, 0xFF, 0xF4, 0x38, 0x00, 0xBC, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x03, 0xFF,
-    0x40, 0x02, 0xBF, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x3E, 0x80, 0x00, 0xBC, 0xFE, 0xAB, 0xF4, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x0F, 0x3C,
-    0x00, 0x03, 0xC3, 0xC0, 0x00, 0xB8, 0x3C, 0x00, 0x1F, 0x03, 0xC0, 0x03, 0xC0, 0x3C, 0x00, 0xB4,
-    0x03, 0xC0, 0x1E, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0xC0, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x1F, 0xFF,
-    0xF8, 0x1F, 0xFF, 0xF8, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x50, 0x00, 0xBC, 0x7F, 0xAF,
-    0xF4, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x2F, 0xFB,
-    0x80, 0x2F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x78, 0xBF, 0xE0, 0x2E, 0xFA, 0xBF, 0x0B, 0xE0, 0x03, 0xE2, 0xF0, 0x00, 0x7C, 0xB8, 0x00,
-    0x0F, 0x1E, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF0, 0xF4, 0x00, 0x7C, 0x1F, 0x00, 0x3D, 0x02, 0xFA,
-    0xFE, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0xFE, 0xBF, 0x40, 0xF8, 0x01, 0xF0,
-    0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x0B, 0x43, 0xD0, 0x03, 0xC0, 0xBC, 0x02, 0xE0, 0x0B, 0xE7, 0xE0,
-    0x00, 0xBF, 0xE0, 0x00, 0x7E, 0xFE, 0x00, 0xBC, 0x07, 0xF0, 0x7C, 0x00, 0x3E, 0x2E, 0x00, 0x07,
-    0xCF, 0x40, 0x00, 0xF2, 0xE0, 0x00, 0x7C, 0x7C, 0x00, 0x3E, 0x0B, 0xEA, 0xBF, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x3E, 0x00, 0xF8,
-    0x7C, 0x00, 0x3C, 0xB8, 0x00, 0x2E, 0xB4, 0x00, 0x1F, 0xB4, 0x00, 0x0F, 0xB8, 0x00, 0x2F, 0x7C,
-    0x00, 0x7F, 0x2F, 0x96, 0xEF, 0x0B, 0xFF, 0x5F, 0x00, 0x50, 0x1E, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x1A, 0xAF, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x3F, 0x3F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x0A,
-    0x43, 0xF0, 0xFC, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x07,
-    0xC2, 0xE0, 0xF0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x6A, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0x40, 0x02,
-    0xF8, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x0B,
-    0xFF, 0xFD, 0x09, 0x00, 0xBC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xB8,
-    0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xBD,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x2F, 0xF9, 0x07,
-    0x42, 0xC0, 0x3F, 0xAF, 0x80, 0xE0, 0xF0, 0x3D, 0x01, 0xD0, 0x3C, 0x74, 0x0F, 0x00, 0x74, 0x0B,
-    0x1D, 0x07, 0x80, 0x2D, 0x02, 0xCB, 0x42, 0xD0, 0x0B, 0x40, 0xF2, 0xD0, 0x74, 0x03, 0xD0, 0x38,
-    0x74, 0x1F, 0x00, 0xF4, 0x1D, 0x1E, 0x03, 0xE5, 0xEF, 0x5F, 0x03, 0xC0, 0x3F, 0xE0, 0xFF, 0x00,
-    0xB4, 0x00, 0x40, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x01, 0x00, 0x00,
-    0x1F, 0xE9, 0x6B, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00,
-    0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00,
-    0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0,
-    0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C,
-    0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x7F, 0xFE, 0x90, 0x2F, 0xFF, 0xFF, 0x0B, 0x80,
-    0x0B, 0xF2, 0xE0, 0x00, 0x7C, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xCB, 0x80, 0x01, 0xF2, 0xF5,
-    0x56, 0xF0, 0xBF, 0xFF, 0xE0, 0x2F, 0xAA, 0xBF, 0x4B, 0x80, 0x01, 0xF6, 0xE0, 0x00, 0x2E, 0xB8,
-    0x00, 0x0B, 0xEE, 0x00, 0x02, 0xFB, 0x80, 0x00, 0xFA, 0xE0, 0x00, 0xFD, 0xBF, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFD,
-    0x00, 0x24, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0B, 0xFE, 0xBF, 0x40, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x90, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0x80, 0x1B, 0xF4, 0x2E, 0x00, 0x02, 0xF4, 0xB8, 0x00, 0x03,
-    0xF2, 0xE0, 0x00, 0x07, 0xCB, 0x80, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x3E, 0xB8, 0x00, 0x00, 0xBA,
-    0xE0, 0x00, 0x02, 0xEB, 0x80, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x01, 0xF2, 0xE0,
-    0x00, 0x0F, 0xCB, 0x80, 0x00, 0xBC, 0x2E, 0x00, 0x1F, 0xD0, 0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFE,
-    0x40, 0x00, 0x7F, 0xFF, 0xF6, 0xFF, 0xFF, 0xDB, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x55, 0x54, 0xBF, 0xFF, 0xF2, 0xFA, 0xAA, 0x8B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF,
-    0xF6, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF6, 0xFF, 0xFF, 0xDB, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBE, 0xAA, 0xA2, 0xFF, 0xFF, 0xCB,
-    0xD5, 0x55, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF,
-    0xFF, 0xFC, 0x03, 0xF8, 0x00, 0x64, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x15, 0x54, 0x7C, 0x00,
-    0x3F, 0xFD, 0x7C, 0x00, 0x1A, 0xBD, 0x7C, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00,
-    0x00, 0x3D, 0x0F, 0x80, 0x00, 0x3D, 0x07, 0xF4, 0x00, 0x3D, 0x01, 0xFF, 0xEB, 0xFD, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00,
-    0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F,
-    0x2F, 0x55, 0x55, 0x7C, 0xBF, 0xFF, 0xFF, 0xF2, 0xFA, 0xAA, 0xAB, 0xCB, 0x80, 0x00, 0x0F, 0x2E,
-    0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00,
-    0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xC0, 0xFF, 0xF6, 0xFF, 0x80, 0xF4, 0x03,
-    0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x6F, 0xE3, 0xFF, 0xD0, 0x00, 0xB4, 0x02, 0xE0, 0x0B, 0x80,
-    0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00,
-    0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x3D, 0x47, 0xF3, 0xFF,
-    0x4A, 0xA0, 0x00, 0x78, 0x00, 0x0B, 0x8B, 0x80, 0x02, 0xF0, 0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x1F,
-    0x00, 0xB8, 0x07, 0xD0, 0x0B, 0x80, 0xF4, 0x00, 0xB8, 0x3D, 0x00, 0x0B, 0x8F, 0x80, 0x00, 0xBB,
-    0xF8, 0x00, 0x0B, 0xFB, 0xD0, 0x00, 0xBD, 0x2F, 0x00, 0x0B, 0x80, 0xF8, 0x00, 0xB8, 0x07, 0xD0,
-    0x0B, 0x80, 0x2F, 0x00, 0xB8, 0x00, 0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80,
-    0x00, 0xBC, 0x78, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF,
-    0xF6, 0xFF, 0xFF, 0xD0, 0x7F, 0x00, 0x00, 0x03, 0xF2, 0xFD, 0x00, 0x00, 0x2F, 0xDB, 0xF8, 0x00,
-    0x00, 0xFF, 0x6E, 0xF0, 0x00, 0x07, 0xBD, 0xB7, 0xD0, 0x00, 0x2D, 0xF6, 0xD7, 0xC0, 0x00, 0xF3,
-    0xDB, 0x4F, 0x00, 0x07, 0x8F, 0x6E, 0x2E, 0x00, 0x3C, 0x3D, 0xB8, 0x7C, 0x01, 0xF0, 0xF6, 0xE0,
-    0xF4, 0x0B, 0x43, 0xDB, 0x82, 0xE0, 0x3C, 0x0F, 0x6E, 0x03, 0xC1, 0xE0, 0x3D, 0xB8, 0x0F, 0x4F,
-    0x40, 0xF6, 0xE0, 0x1F, 0x3C, 0x03, 0xDB, 0x80, 0x3E, 0xD0, 0x0F, 0x6E, 0x00, 0xBF, 0x00, 0x3D,
-    0xB8, 0x01, 0xF8, 0x00, 0xF6, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x76, 0xFC, 0x00,
-    0x02, 0xEB, 0xF8, 0x00, 0x0B, 0xAE, 0xF0, 0x00, 0x2E, 0xB6, 0xF0, 0x00, 0xBA, 0xD3, 0xD0, 0x02,
-    0xEB, 0x47, 0xC0, 0x0B, 0xAD, 0x0F, 0xC0, 0x2E, 0xB8, 0x0F, 0x40, 0xBA, 0xE0, 0x2F, 0x02, 0xEB,
-    0x80, 0x3E, 0x0B, 0xAE, 0x00, 0x3D, 0x2E, 0xB8, 0x00, 0xBC, 0x7A, 0xE0, 0x00, 0xF9, 0xEB, 0x80,
-    0x01, 0xFB, 0xAE, 0x00, 0x02, 0xFE, 0xB8, 0x00, 0x03, 0xFA, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0F,
-    0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x2F,
-    0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00,
-    0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D, 0x00,
-    0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0xBF, 0xFF, 0xF4, 0xB8, 0x01, 0xFC, 0xB8, 0x00, 0x3E, 0xB8,
-    0x00, 0x2F, 0xB8, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x3D, 0xB8, 0x01, 0xFC, 0xBF, 0xFF,
-    0xF0, 0xBF, 0xFE, 0x40, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0,
-    0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF,
-    0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B,
-    0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x01,
-    0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x7F,
-    0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0xB8, 0x01, 0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x2F,
-    0x0B, 0x80, 0x01, 0xF0, 0xB8, 0x00, 0x2E, 0x0B, 0x80, 0x03, 0xD0, 0xBD, 0x56, 0xF8, 0x0B, 0xFF,
-    0xFD, 0x00, 0xBE, 0xAF, 0x80, 0x0B, 0x80, 0x7C, 0x00, 0xB8, 0x02, 0xF0, 0x0B, 0x80, 0x0F, 0x40,
-    0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFC, 0x3E, 0x00, 0x14, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00,
-    0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00,
-    0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x7A,
-    0xF0, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0xBC, 0x1F, 0x00, 0x03, 0xD0, 0x3C,
-    0x00, 0x1F, 0x00, 0xB8, 0x00, 0xB8, 0x01, 0xF0, 0x03, 0xD0, 0x03, 0xD0, 0x1F, 0x00, 0x0B, 0x80,
-    0xB8, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0xF3, 0xC0,
-    0x00, 0x03, 0xEF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0xB8, 0x00, 0x0B, 0x80, 0x00, 0x79, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE3, 0xD0, 0x01, 0xFD, 0x00,
-    0x0F, 0x4F, 0x80, 0x0B, 0xB8, 0x00, 0x7C, 0x2F, 0x00, 0x3D, 0xF0, 0x02, 0xF0, 0x7C, 0x00, 0xF3,
-    0xD0, 0x0F, 0x80, 0xF4, 0x07, 0x8B, 0x80, 0x3C, 0x03, 0xE0, 0x3D, 0x0F, 0x01, 0xF0, 0x07, 0xC0,
-    0xF0, 0x3C, 0x0B, 0x80, 0x0F, 0x07, 0xC0, 0xB8, 0x3D, 0x00, 0x3D, 0x2D, 0x01, 0xF0, 0xF0, 0x00,
-    0xB8, 0xF0, 0x03, 0xC7, 0xC0, 0x01, 0xF3, 0xC0, 0x0B, 0x6E, 0x00, 0x03, 0xDE, 0x00, 0x1E, 0xB4,
-    0x00, 0x0F, 0xB4, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0xBC, 0x00, 0x0F, 0x40,
-    0xF4, 0x00, 0xB8, 0x01, 0xF0, 0x07, 0xC0, 0x02, 0xE0, 0x3D, 0x00, 0x03, 0xD2, 0xE0, 0x00, 0x07,
-    0xDF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xEF,
-    0x00, 0x00, 0x3E, 0x3D, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0xB8, 0x00, 0xF4,
-    0x07, 0xC0, 0x02, 0xF0, 0x3D, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x01, 0xF1,
-    0xF0, 0x00, 0x0F, 0x42, 0xE0, 0x00, 0xBC, 0x03, 0xC0, 0x03, 0xD0, 0x0B, 0x80, 0x2F, 0x00, 0x0F,
-    0x40, 0xF0, 0x00, 0x2F, 0x0B, 0x80, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xEF, 0xFE, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-    0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xEF, 0xFE,
-    0xB4, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0x3C, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x3C,
-    0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x7C, 0x7F, 0xF1, 0xFF,
-    0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
-    0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
-    0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0x6D, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x1E, 0x0B, 0x40, 0x03, 0xC0, 0x3C, 0x00, 0x78, 0x02, 0xD0,
-    0x0B, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0xB4, 0x2D, 0x00, 0x03, 0xC1, 0x40, 0x00, 0x04, 0x3F, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0xF4, 0x02, 0x80, 0x00, 0x6A, 0x40,
-    0x3F, 0xFF, 0xC0, 0xE4, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x2F, 0xFF,
-    0xCB, 0xFA, 0xAF, 0x7D, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x0B, 0xEF, 0x00, 0x7F, 0x7F, 0xAF,
-    0xBC, 0x7F, 0xF4, 0xB0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x6A, 0x40, 0xF7, 0xFF, 0xE0, 0xFF, 0x41, 0xFC, 0xFC,
-    0x00, 0x3D, 0xF8, 0x00, 0x2E, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3E, 0xFD, 0x00, 0xBC, 0xFB, 0xEB, 0xF4, 0xF1, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x1F, 0xFF, 0xC0, 0xFD, 0x5A, 0x0F, 0x80, 0x00, 0x3C, 0x00,
-    0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xFA, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x1A, 0x43,
-    0xD0, 0x7F, 0xFD, 0xF4, 0x7E, 0x47, 0xFD, 0x3E, 0x00, 0x3F, 0x5F, 0x00, 0x07, 0xD7, 0xC0, 0x00,
-    0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xF4, 0xF0, 0x00,
-    0x7D, 0x3F, 0x00, 0x3F, 0x43, 0xFA, 0xBF, 0xD0, 0x2F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F,
-    0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F,
-    0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x01, 0xFE, 0xD0, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0xD5, 0x0B, 0xFF, 0xF4, 0x17,
-    0xD5, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0,
-    0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x69, 0x01,
-    0x01, 0xFF, 0xF6, 0xD1, 0xF9, 0x1F, 0xF4, 0xF8, 0x00, 0xFD, 0x7C, 0x00, 0x1F, 0x5F, 0x00, 0x03,
-    0xDB, 0x80, 0x00, 0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x5F, 0x00, 0x03, 0xD3, 0xC0, 0x01,
-    0xF4, 0xFC, 0x00, 0xFD, 0x0F, 0xEA, 0xFF, 0x40, 0xBF, 0xE3, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x1F, 0x05, 0x00, 0x1F, 0x82, 0xFF, 0xFF, 0x80, 0x2F, 0xFE, 0x40, 0xF4, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x2A, 0x40,
-    0xF6, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3C, 0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00,
-    0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x04, 0x3D, 0x3D, 0x04, 0x00, 0x14, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x00, 0x10, 0x03, 0xD0, 0x0F, 0x40,
-    0x04, 0x00, 0x00, 0x01, 0x40, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00,
-    0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03,
-    0xD0, 0x1F, 0x1F, 0xF8, 0x7F, 0x80, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x50, 0xF4, 0x02, 0xF0, 0xF4, 0x0B, 0xC0, 0xF4, 0x2F,
-    0x00, 0xF4, 0xBC, 0x00, 0xF5, 0xF0, 0x00, 0xF7, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0xFC, 0xBC, 0x00,
-    0xF4, 0x3E, 0x00, 0xF4, 0x0F, 0x40, 0xF4, 0x07, 0xC0, 0xF4, 0x02, 0xF0, 0xF4, 0x00, 0xF8, 0xF7,
-    0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x40, 0x50, 0x6A,
-    0x40, 0x1A, 0x40, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0x46, 0xFB, 0x91, 0xFC, 0xFC, 0x00, 0xBE,
-    0x00, 0x3C, 0xF8, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00,
-    0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D,
-    0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4,
-    0x00, 0x7C, 0x00, 0x3D, 0x50, 0x6A, 0x40, 0xF2, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3C,
-    0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x00, 0x6A,
-    0x40, 0x01, 0xFF, 0xFD, 0x00, 0xF9, 0x1B, 0xD0, 0xF8, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0x5F, 0x00,
-    0x02, 0xEB, 0x80, 0x00, 0xBA, 0xE0, 0x00, 0x2F, 0xB8, 0x00, 0x0B, 0x9F, 0x00, 0x03, 0xE3, 0xD0,
-    0x00, 0xF0, 0xBC, 0x00, 0xFC, 0x0F, 0xEA, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x6A, 0x40, 0xF3, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x7D, 0xF8, 0x00, 0x2E, 0xF4, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3E,
-    0xFE, 0x00, 0xBC, 0xFB, 0xEB, 0xF4, 0xF5, 0xFF, 0xD0, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x69, 0x01, 0x01, 0xFF,
-    0xF6, 0xD1, 0xF9, 0x1F, 0xF4, 0xF8, 0x00, 0xFD, 0x7C, 0x00, 0x1F, 0x5F, 0x00, 0x03, 0xDB, 0x80,
-    0x00, 0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x5F, 0x00, 0x03, 0xD3, 0xC0, 0x01, 0xF4, 0xFC,
-    0x00, 0xFD, 0x0F, 0xEA, 0xFF, 0x40, 0xBF, 0xE3, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x50, 0x2A, 0xF1, 0xFF,
-    0xF7, 0xD5, 0xFE, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00,
-    0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x01, 0xA9, 0x02, 0xFF, 0xFD, 0x7D, 0x06, 0xCB,
-    0x40, 0x00, 0xB8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xD0, 0x00,
-    0x2E, 0x00, 0x01, 0xF4, 0x00, 0x2E, 0xBE, 0xAF, 0xC7, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0xE0, 0x00, 0x78, 0x00, 0x7E, 0x54, 0xBF, 0xFF, 0x47, 0xE5, 0x40, 0xB8, 0x00, 0x2E, 0x00,
-    0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xBC, 0x00,
-    0x0F, 0xE9, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x14, 0x00, 0x05, 0x0F, 0x00, 0x03, 0xD3, 0xC0, 0x00,
-    0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00,
-    0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xD0, 0x01, 0xF4, 0xBC, 0x00, 0xFD, 0x1F, 0xEA,
-    0xFF, 0x41, 0xFF, 0xE2, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x6E, 0x00, 0x03, 0xD7, 0xC0,
-    0x01, 0xF0, 0xF4, 0x00, 0xB8, 0x2F, 0x00, 0x3C, 0x03, 0xC0, 0x1F, 0x00, 0xF4, 0x0F, 0x40, 0x1F,
-    0x03, 0xC0, 0x03, 0xC1, 0xE0, 0x00, 0xB8, 0xF4, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xEE, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x54, 0x00, 0x14, 0x00, 0x14, 0x7C, 0x00, 0xBD, 0x00, 0x3C,
-    0x3C, 0x00, 0xFE, 0x00, 0x7C, 0x3D, 0x01, 0xEF, 0x00, 0xB8, 0x2E, 0x02, 0xDF, 0x00, 0xF4, 0x1F,
-    0x03, 0xC7, 0x80, 0xF0, 0x0F, 0x03, 0xC3, 0xC1, 0xE0, 0x0F, 0x4B, 0x83, 0xC2, 0xD0, 0x0B, 0x8F,
-    0x02, 0xD3, 0xC0, 0x07, 0xCF, 0x01, 0xF3, 0xC0, 0x03, 0xDE, 0x00, 0xF7, 0x80, 0x02, 0xFC, 0x00,
-    0xBF, 0x40, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x14, 0x00, 0x05, 0x0B,
-    0xC0, 0x0B, 0xC0, 0xF4, 0x03, 0xC0, 0x1F, 0x03, 0xD0, 0x02, 0xF2, 0xF0, 0x00, 0x3E, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7C, 0xF8, 0x00, 0x3D, 0x0F, 0x40,
-    0x3E, 0x01, 0xF0, 0x1F, 0x00, 0x2E, 0x0F, 0x40, 0x03, 0xD0, 0x50, 0x00, 0x05, 0x6E, 0x00, 0x03,
-    0xD3, 0xC0, 0x01, 0xF0, 0xF4, 0x00, 0xB8, 0x1F, 0x00, 0x3D, 0x03, 0xD0, 0x1F, 0x00, 0xB8, 0x0B,
-    0x80, 0x0F, 0x03, 0xC0, 0x03, 0xD1, 0xF0, 0x00, 0x78, 0xF4, 0x00, 0x0F, 0x3C, 0x00, 0x02, 0xEE,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x7C, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x05, 0x55, 0x50, 0xBF, 0xFF,
-    0xE0, 0x55, 0x5F, 0x40, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0xAA, 0xA8, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0A, 0x80, 0x1F, 0xE0, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-    0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0x07, 0xE0, 0x00,
-    0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x03, 0xE0, 0x00,
-    0x7F, 0x80, 0x02, 0xE0, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF,
-    0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0x00, 0x39, 0x00, 0x0F, 0xF0, 0x00, 0x7D, 0x00, 0x0B,
-    0x80, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x02,
-    0xF8, 0x00, 0xBF, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C,
-    0x00, 0x2E, 0x00, 0x1F, 0x40, 0x3F, 0xC0, 0x0F, 0x40, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFE, 0x41,
-    0xCF, 0x5B, 0xFF, 0xF1, 0x00, 0x1B, 0xE0, 0x18, 0x3F, 0x3F, 0x19, 0x00, 0x04, 0x1C, 0x1C, 0x2C,
-    0x2C, 0x2D, 0x2D, 0x2D, 0x3D, 0x3D, 0x3E, 0x3E, 0x3E, 0x29, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xC0, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xF0, 0xBD, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00,
-    0x02, 0xF8, 0x06, 0x02, 0xFF, 0xFC, 0x01, 0xBF, 0x80, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x1F, 0x40, 0x10, 0x02,
-    0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x02, 0xBF, 0xAA, 0x40, 0x3F, 0xFF, 0xF8, 0x00, 0x2D, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x38, 0x6A, 0x1D, 0x2F, 0xFF, 0xFC, 0x0F, 0x40, 0xF4,
-    0x1D, 0x00, 0x38, 0x2C, 0x00, 0x2C, 0x2C, 0x00, 0x2C, 0x2C, 0x00, 0x3C, 0x0F, 0x00, 0xB4, 0x1F,
-    0xEB, 0xF8, 0x3D, 0xBF, 0x6D, 0x10, 0x00, 0x08, 0x78, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x3C, 0x1F,
-    0x00, 0x0B, 0x80, 0xF4, 0x00, 0xF0, 0x07, 0xC0, 0x2E, 0x00, 0x3D, 0x03, 0xC0, 0x01, 0xF0, 0xB8,
-    0x00, 0x0F, 0x4F, 0x00, 0x00, 0x3E, 0xD0, 0x00, 0x57, 0xFD, 0x50, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0x90, 0x00,
-    0x00, 0x00, 0x09, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x42, 0xFA, 0xBE, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFF,
-    0xD0, 0x3C, 0x0B, 0xE1, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x0F, 0x40, 0x3C, 0x1F, 0xD2, 0xE0, 0x0B,
-    0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF1, 0x00, 0x07, 0xCB, 0xEA, 0xBD, 0x0B,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1E, 0x3C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x0F, 0x94, 0x6F, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0,
-    0x0E, 0x00, 0x55, 0x03, 0xC0, 0xB0, 0x1F, 0xFE, 0x07, 0x43, 0x40, 0xF4, 0x14, 0x0B, 0x1C, 0x0B,
-    0x40, 0x00, 0x1C, 0xB0, 0x3C, 0x00, 0x00, 0x37, 0x80, 0xF0, 0x00, 0x00, 0xEE, 0x03, 0xC0, 0x00,
-    0x03, 0xAC, 0x0F, 0x00, 0x00, 0x0D, 0x70, 0x3D, 0x00, 0x00, 0x34, 0xD0, 0x7C, 0x00, 0x02, 0xC2,
-    0xC0, 0xBF, 0xF8, 0x0E, 0x03, 0x80, 0x2A, 0x40, 0xF0, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x07, 0xE4,
-    0x06, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x19, 0x6D, 0x00, 0x0E, 0x06, 0xAE, 0x2E, 0x5E, 0x38, 0x0E, 0x38, 0x1E, 0x2F, 0xFE, 0x05, 0x40,
-    0x00, 0x80, 0x20, 0x0F, 0x43, 0xD0, 0xB8, 0x2E, 0x0B, 0xC2, 0xF0, 0x7C, 0x1F, 0x03, 0xD0, 0xF4,
-    0x03, 0xC1, 0xF0, 0x07, 0xC1, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0x82, 0xD0, 0x04, 0x01, 0x00, 0xAA,
-    0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x0B, 0xAA, 0xA3, 0xFF, 0xC5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFE, 0x00, 0x00, 0x0F, 0x94, 0x6F, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x0E, 0x05, 0x54,
-    0x03, 0xC0, 0xB0, 0x3F, 0xFD, 0x07, 0x43, 0x40, 0xF1, 0xBC, 0x0B, 0x1C, 0x03, 0xC0, 0xF0, 0x1C,
-    0xB0, 0x0F, 0x03, 0xC0, 0x37, 0x80, 0x3D, 0x6E, 0x00, 0xEE, 0x00, 0xFF, 0xE0, 0x03, 0xAC, 0x03,
-    0xC7, 0x80, 0x0D, 0x70, 0x0F, 0x0F, 0x40, 0x34, 0xD0, 0x3C, 0x1F, 0x02, 0xC2, 0xC0, 0xF0, 0x2D,
-    0x0E, 0x03, 0x82, 0x40, 0x24, 0xF0, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x07, 0xE4, 0x06, 0xF0, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFE, 0x03, 0xD6, 0xE1, 0xD0, 0x2C, 0xB0, 0x07, 0x6C, 0x01, 0xD3, 0x80, 0xF0,
-    0x7F, 0xF4, 0x01, 0x90, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x3C, 0x00, 0x2F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x01, 0x40, 0x2F, 0xF8, 0x38, 0x2D, 0x00, 0x0E, 0x00, 0x0E,
-    0x00, 0x2C, 0x00, 0xB4, 0x02, 0xD0, 0x0B, 0x40, 0x2D, 0x00, 0x7F, 0xFE, 0x2A, 0xA9, 0x01, 0x40,
-    0x0B, 0xFE, 0x03, 0x42, 0xE0, 0x00, 0x38, 0x00, 0x1D, 0x02, 0xBE, 0x00, 0xBF, 0xC0, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x03, 0xCB, 0xEB, 0xD0, 0xAF, 0x80, 0x00, 0x00, 0xF8, 0x2F, 0x07, 0xC0, 0xA0,
-    0x00, 0x50, 0x00, 0x14, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D,
-    0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF8,
-    0x00, 0x3D, 0xFC, 0x00, 0xFD, 0xFF, 0xAB, 0xED, 0xFB, 0xFE, 0x1D, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x87, 0xFF, 0xF5, 0xE3, 0xFF, 0xF8, 0x29, 0xFF, 0xFE, 0x0A, 0xBF, 0xFF, 0x82, 0xAF, 0xFF, 0xE0,
-    0xAB, 0xFF, 0xF8, 0x2A, 0xFF, 0xFE, 0x0A, 0x7F, 0xFF, 0x82, 0x8F, 0xFF, 0xE0, 0xA2, 0xFF, 0xF8,
-    0x28, 0x2F, 0xFE, 0x0A, 0x00, 0x57, 0x82, 0x80, 0x00, 0xA0, 0xA0, 0x00, 0x28, 0x28, 0x00, 0x0A,
-    0x0A, 0x00, 0x02, 0x82, 0x80, 0x00, 0xA0, 0xA0, 0x00, 0x28, 0x28, 0x00, 0x0A, 0x0A, 0x00, 0x02,
-    0x82, 0x80, 0x00, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x0E, 0x01, 0xE0,
-    0x07, 0xC0, 0x2D, 0x57, 0xCB, 0xE0, 0x00, 0x00, 0x2F, 0x0F, 0xF3, 0xCB, 0x00, 0xF0, 0x0F, 0x00,
-    0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x06, 0x00, 0x00, 0x01, 0xFE, 0x01, 0xE5, 0xF0, 0xE0,
-    0x1D, 0x34, 0x03, 0x8D, 0x00, 0xE3, 0x80, 0x34, 0xB0, 0x2C, 0x0F, 0xFD, 0x00, 0x54, 0x00, 0x08,
-    0x02, 0x00, 0x2E, 0x0F, 0x80, 0x0F, 0x43, 0xD0, 0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x7C, 0x00, 0xB8,
-    0x3E, 0x01, 0xF0, 0x7C, 0x07, 0xC1, 0xF0, 0x0F, 0x43, 0xD0, 0x3D, 0x0F, 0x40, 0x04, 0x01, 0x00,
-    0x01, 0xF0, 0x00, 0x0E, 0x00, 0x2F, 0xC0, 0x00, 0xF0, 0x03, 0xDF, 0x00, 0x07, 0x40, 0x04, 0x3C,
-    0x00, 0x3C, 0x00, 0x00, 0xF0, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x07, 0x40, 0xE0, 0x00, 0xF0, 0x3C, 0x0F, 0xC0, 0x03, 0xC2, 0xC0, 0xBF, 0x00,
-    0x0B, 0x1E, 0x03, 0x7C, 0x00, 0x00, 0xF0, 0x38, 0xF0, 0x00, 0x07, 0x42, 0xC3, 0xC0, 0x00, 0x3C,
-    0x1D, 0x0F, 0x00, 0x02, 0xC0, 0xFF, 0xFF, 0x40, 0x1E, 0x02, 0xAA, 0xF8, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00, 0x3C, 0x00, 0x3F, 0x80, 0x02, 0xD0, 0x03,
-    0xDE, 0x00, 0x0E, 0x00, 0x04, 0x38, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x07, 0x80, 0x00, 0x03, 0x80,
-    0x3C, 0x00, 0x00, 0x0E, 0x02, 0xD0, 0x00, 0x00, 0x38, 0x0E, 0x1F, 0xE0, 0x00, 0xE0, 0xF2, 0xFA,
-    0xF0, 0x03, 0x87, 0x41, 0x02, 0xC0, 0x0E, 0x3C, 0x00, 0x0B, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00,
-    0x0E, 0x00, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x07, 0x40, 0x02, 0xD0, 0x00, 0x3C, 0x00,
-    0x2D, 0x00, 0x02, 0xC0, 0x02, 0xFA, 0xA0, 0x1E, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x03, 0x80, 0x79, 0x7D, 0x00, 0x0B, 0x00, 0x00, 0x0E, 0x00, 0x1E, 0x00,
-    0x00, 0x1E, 0x00, 0x3C, 0x00, 0x05, 0xBC, 0x00, 0xB4, 0x00, 0x0F, 0xF8, 0x00, 0xF0, 0x00, 0x00,
-    0x2E, 0x02, 0xC0, 0x00, 0x00, 0x0F, 0x07, 0x80, 0xE0, 0x00, 0x0F, 0x0F, 0x03, 0xF0, 0xB9, 0x7D,
-    0x2D, 0x0B, 0xF0, 0x7F, 0xF4, 0x38, 0x1D, 0xF0, 0x00, 0x00, 0xF0, 0x38, 0xF0, 0x00, 0x01, 0xD0,
-    0xB0, 0xF0, 0x00, 0x03, 0xC1, 0xC0, 0xF0, 0x00, 0x0B, 0x43, 0xFF, 0xFD, 0x00, 0x0E, 0x02, 0xAA,
-    0xF8, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x74, 0x00, 0x00, 0xF0, 0x00, 0x18, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xD0, 0x00, 0x0B,
-    0x00, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x3D, 0x00, 0x01, 0xF0,
-    0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x41, 0xB0, 0x7F, 0xFF, 0xD0, 0x2B, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00,
-    0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80,
-    0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0,
-    0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00,
-    0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80,
-    0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0,
-    0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7C, 0x3C, 0x00,
-    0x00, 0xE0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00,
-    0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80,
-    0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0,
-    0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x04, 0x01, 0x00, 0x00, 0xBF, 0x43, 0x40, 0x01, 0xEB, 0xFF, 0x00, 0x01, 0x80, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00,
-    0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0,
-    0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8,
-    0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x3D, 0x00, 0x00, 0x78, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00,
-    0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00,
-    0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0,
-    0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C,
-    0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x28, 0x38, 0x00, 0x00, 0x38, 0x28, 0x00, 0x00, 0x1D, 0xB4, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00,
-    0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40,
-    0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0,
-    0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xB8, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x00,
-    0x00, 0x3C, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0x95, 0x54,
-    0x00, 0x2F, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xD0, 0x0F, 0xEA, 0xA8, 0x00, 0x7E, 0xAA, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xF5, 0x55, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x40,
-    0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0xFF,
-    0xFF, 0xE3, 0xE0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F,
-    0xFF, 0xFF, 0x01, 0xFD, 0x00, 0x24, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0xBF, 0x40, 0x06, 0xFF, 0xFC, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x6E,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0xB8, 0x00, 0x02, 0xE0, 0x00,
-    0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF5, 0x55, 0x4B, 0xFF, 0xFF, 0x2F, 0xAA,
-    0xA8, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0,
-    0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x40, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF5, 0x55, 0x4B, 0xFF, 0xFF,
-    0x2F, 0xAA, 0xA8, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F,
-    0xF0, 0x02, 0xE1, 0xF0, 0x1D, 0x01, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF5, 0x55, 0x4B,
-    0xFF, 0xFF, 0x2F, 0xAA, 0xA8, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3D, 0x0F,
-    0x00, 0xB4, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x6E, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBD, 0x55, 0x52, 0xFF,
-    0xFF, 0xCB, 0xEA, 0xAA, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xF0, 0x03, 0xE0,
-    0x03, 0xD0, 0x02, 0x80, 0x00, 0x0F, 0xFF, 0x6F, 0xF8, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0,
-    0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40,
-    0x3D, 0x06, 0xFE, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x01, 0xF0, 0x0E, 0x00, 0x00, 0x0F,
-    0xFF, 0x6F, 0xF8, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03,
-    0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x06, 0xFE, 0x3F, 0xFD, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0xFF, 0x80, 0xF4, 0xF4, 0xB0, 0x0B, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0xBF,
-    0xE0, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D,
-    0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4,
-    0x01, 0xBF, 0x80, 0xFF, 0xF4, 0x00, 0x00, 0x3C, 0x1E, 0x3C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFD, 0x2F, 0xF8, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03,
-    0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x1B,
-    0xF8, 0x3F, 0xFD, 0x07, 0xFF, 0xE9, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x7C, 0x01, 0xBF, 0x40,
-    0x1F, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00,
-    0xF4, 0x1F, 0x00, 0x00, 0x3E, 0x3F, 0xFF, 0xC0, 0x0B, 0x9F, 0xFF, 0xF4, 0x02, 0xE0, 0xBC, 0x00,
-    0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x7C,
-    0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x1F, 0xD0, 0x07, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x10, 0x01, 0x00, 0x03, 0xFC, 0x2C, 0x00, 0x3D, 0xBF, 0xE0, 0x00, 0xD0, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xDB, 0xF0, 0x00, 0x0B, 0xAF, 0xE0, 0x00, 0x2E, 0xBB, 0xC0,
-    0x00, 0xBA, 0xDB, 0xC0, 0x02, 0xEB, 0x4F, 0x40, 0x0B, 0xAD, 0x1F, 0x00, 0x2E, 0xB4, 0x3F, 0x00,
-    0xBA, 0xE0, 0x3D, 0x02, 0xEB, 0x80, 0xBC, 0x0B, 0xAE, 0x00, 0xF8, 0x2E, 0xB8, 0x00, 0xF4, 0xBA,
-    0xE0, 0x02, 0xF1, 0xEB, 0x80, 0x03, 0xE7, 0xAE, 0x00, 0x07, 0xEE, 0xB8, 0x00, 0x0B, 0xFA, 0xE0,
-    0x00, 0x0F, 0xEB, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x03, 0xE0, 0x00,
-    0x0F, 0x82, 0xF0, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x0B, 0xDF, 0x00,
-    0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x07, 0xDF,
-    0x00, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x7C, 0x1F, 0x40, 0x00, 0x3E,
-    0x02, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x03, 0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x01,
-    0xF0, 0xF4, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x0B, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00,
-    0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x02, 0xF3, 0xD0,
-    0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x7C, 0x1F, 0x40, 0x00, 0x3E, 0x02, 0xF8, 0x00, 0x7F, 0x00,
-    0x2F, 0xFA, 0xFF, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x78, 0x7C, 0x00, 0x00, 0x38,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x07,
-    0xE0, 0x01, 0xFC, 0x03, 0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x3E,
-    0x3C, 0x00, 0x00, 0x0B, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00,
-    0x1F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00,
-    0x00, 0x7C, 0x1F, 0x40, 0x00, 0x3E, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x01,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x40, 0x00, 0x0F, 0xF4, 0x70,
-    0x00, 0x07, 0x6F, 0xFC, 0x00, 0x02, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0,
-    0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF,
-    0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B,
-    0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01,
-    0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x02, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0,
-    0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00,
-    0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00,
-    0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D,
-    0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1D, 0x3E, 0x00, 0x7C, 0x0F, 0x81, 0xF0,
-    0x03, 0xE7, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xC3, 0xE0, 0x1F,
-    0x00, 0xF8, 0x3C, 0x00, 0x3D, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xFF, 0x97,
-    0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x02, 0xFE, 0x0B, 0xC0, 0x00,
-    0xF7, 0xC3, 0xD0, 0x00, 0xF4, 0xF8, 0xF0, 0x00, 0xB8, 0x2F, 0x7C, 0x00, 0x7C, 0x07, 0xDF, 0x00,
-    0x3C, 0x01, 0xF7, 0xC0, 0x2D, 0x00, 0x7D, 0xF0, 0x1E, 0x00, 0x1F, 0x7C, 0x0F, 0x00, 0x0B, 0xCF,
-    0x4F, 0x40, 0x03, 0xE2, 0xFB, 0x80, 0x01, 0xF0, 0x7F, 0xC0, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC,
-    0x02, 0xFF, 0xEB, 0xFC, 0x01, 0xF6, 0xFF, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB,
-    0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4,
-    0x00, 0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0x0F, 0x40, 0x02, 0x80, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB,
-    0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0x80, 0x00, 0xF0, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFB, 0x80, 0x00, 0x1F, 0xBC, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0, 0xFF,
-    0xAF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0xF4, 0x2E, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x3D, 0x00, 0xB8,
-    0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x00, 0x02, 0xF0, 0xB8, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x07, 0xEE,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x78, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xEA, 0x40, 0xBF,
-    0xFF, 0xF0, 0xB8, 0x06, 0xFC, 0xB8, 0x00, 0x3E, 0xB8, 0x00, 0x2F, 0xB8, 0x00, 0x1F, 0xB8, 0x00,
-    0x2F, 0xB8, 0x00, 0x3E, 0xB8, 0x00, 0xFC, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF, 0x80, 0xB8, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x03,
-    0xFE, 0xFF, 0x42, 0xF0, 0x02, 0xF0, 0xF4, 0x00, 0x3C, 0x3D, 0x00, 0x1F, 0x0F, 0x40, 0x0F, 0x43,
-    0xD0, 0x1F, 0x40, 0xF4, 0x0F, 0x40, 0x3D, 0x0B, 0x80, 0x0F, 0x41, 0xF0, 0x03, 0xD0, 0x3F, 0x40,
-    0xF4, 0x03, 0xF8, 0x3D, 0x00, 0x2F, 0x8F, 0x40, 0x01, 0xF7, 0xD0, 0x00, 0x2E, 0xF4, 0x00, 0x0B,
-    0xBD, 0x10, 0x03, 0xDF, 0x4B, 0xAB, 0xF3, 0xD1, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x03, 0xFF, 0xFC, 0x0E, 0x41, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x02,
-    0xFF, 0xFC, 0xBF, 0xAA, 0xF7, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xBE, 0xF0, 0x07, 0xF7,
-    0xFA, 0xFB, 0xC7, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xF8,
-    0x00, 0x0B, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x03, 0xFF, 0xFC, 0x0E, 0x41,
-    0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x02, 0xFF, 0xFC, 0xBF, 0xAA, 0xF7, 0xD0,
-    0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xBE, 0xF0, 0x07, 0xF7, 0xFA, 0xFB, 0xC7, 0xFF, 0x4B, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0xF0, 0xF4, 0x0E, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x06, 0xA4, 0x03, 0xFF, 0xFC, 0x0E, 0x41, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x0F, 0x02, 0xFF, 0xFC, 0xBF, 0xAA, 0xF7, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00,
-    0xBE, 0xF0, 0x07, 0xF7, 0xFA, 0xFB, 0xC7, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x2F,
-    0xD0, 0xD0, 0xE7, 0xFF, 0x06, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03,
-    0x90, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xBF, 0xFF, 0x2F, 0xEA, 0xBD,
-    0xF4, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x2F, 0xBC, 0x01, 0xFD, 0xFE, 0xBE, 0xF1, 0xFF, 0xD2,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0x40, 0x78, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03, 0x90, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xC0, 0xBF, 0xFF, 0x2F, 0xEA, 0xBD, 0xF4, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x2F, 0xBC,
-    0x01, 0xFD, 0xFE, 0xBE, 0xF1, 0xFF, 0xD2, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0xFC, 0x00,
-    0x2C, 0x38, 0x00, 0xA0, 0xB0, 0x01, 0xEB, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90,
-    0x0F, 0xFF, 0xF0, 0x39, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x0B, 0xFF,
-    0xF2, 0xFE, 0xAB, 0xDF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x02, 0xFB, 0xC0, 0x1F, 0xDF, 0xEB,
-    0xEF, 0x1F, 0xFD, 0x2C, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x69, 0x00, 0x1F, 0xFF, 0xD3, 0xFF,
-    0xD0, 0x1E, 0x46, 0xFF, 0x82, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x3C,
-    0x00, 0x00, 0xBC, 0x00, 0x3D, 0x06, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xE9, 0xFE, 0xAA, 0xA8, 0x7C,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xB8, 0x02,
-    0xFF, 0x00, 0x04, 0x7F, 0xAF, 0x8B, 0xFA, 0xF8, 0x1F, 0xFD, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x1F, 0xFF, 0xC0, 0xFD, 0x5A, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x01,
-    0xF0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00,
-    0x0B, 0xC0, 0x00, 0x0F, 0xFA, 0xF0, 0x0B, 0xFF, 0x80, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x1E, 0x00, 0x05, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF,
-    0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF,
-    0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F,
-    0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0,
-    0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE,
-    0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA,
-    0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x40,
-    0x03, 0xC3, 0xD0, 0x0A, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F,
-    0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA,
-    0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC2, 0xE0, 0x03, 0xC2, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00,
-    0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x3C, 0x00, 0xA0, 0x00, 0x01, 0x40, 0x3D, 0x03, 0xD0,
-    0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D,
-    0x00, 0x00, 0x3E, 0x0B, 0xC1, 0xF0, 0x38, 0x00, 0x00, 0x14, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D,
-    0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0xFF, 0x80, 0xF4, 0xF4, 0xB0, 0x0B, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0F, 0x40,
-    0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00,
-    0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x1E, 0x3C,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03,
-    0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x06, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0xBF,
-    0xE0, 0x00, 0xFC, 0x3D, 0x00, 0x04, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x01, 0xBE, 0x4F, 0x02, 0xFF,
-    0xFF, 0xD2, 0xF4, 0x07, 0xF8, 0xF0, 0x00, 0x3E, 0x7C, 0x00, 0x0B, 0xEE, 0x00, 0x01, 0xFB, 0x80,
-    0x00, 0x7A, 0xE0, 0x00, 0x2E, 0x3C, 0x00, 0x0F, 0x4F, 0x80, 0x0B, 0xC0, 0xFE, 0xAF, 0xC0, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x0F, 0xF4, 0x70, 0x2D, 0xBF, 0xF0, 0x24,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x50, 0x6A, 0x40, 0xF2, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00,
-    0x3C, 0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D,
-    0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0x91, 0xBD, 0x0F, 0x80, 0x0B, 0xC3,
-    0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xAE, 0x00, 0x02, 0xFB, 0x80, 0x00, 0xB9,
-    0xF0, 0x00, 0x3E, 0x3D, 0x00, 0x0F, 0x0B, 0xC0, 0x0F, 0xC0, 0xFE, 0xAF, 0xC0, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0x91,
-    0xBD, 0x0F, 0x80, 0x0B, 0xC3, 0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xAE, 0x00,
-    0x02, 0xFB, 0x80, 0x00, 0xB9, 0xF0, 0x00, 0x3E, 0x3D, 0x00, 0x0F, 0x0B, 0xC0, 0x0F, 0xC0, 0xFE,
-    0xAF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0x8B, 0x80, 0x07, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x1F, 0xFF, 0xD0, 0x0F, 0x91, 0xBD, 0x0F, 0x80, 0x0B, 0xC3, 0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x2E,
-    0xB8, 0x00, 0x0B, 0xAE, 0x00, 0x02, 0xFB, 0x80, 0x00, 0xB9, 0xF0, 0x00, 0x3E, 0x3D, 0x00, 0x0F,
-    0x0B, 0xC0, 0x0F, 0xC0, 0xFE, 0xAF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x04, 0x00, 0xFF, 0x47, 0x00, 0xB6, 0xFF, 0x80, 0x34, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x7F, 0xFF, 0x40, 0x3E, 0x46, 0xF4, 0x3E, 0x00, 0x2F, 0x0F, 0x00, 0x03, 0xD7, 0xC0,
-    0x00, 0xBA, 0xE0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xEE, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0xF8, 0xF4,
-    0x00, 0x3C, 0x2F, 0x00, 0x3F, 0x03, 0xFA, 0xBF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x90, 0x00, 0x7F, 0xFF, 0x40, 0x3E, 0x46, 0xF4, 0x3E, 0x00, 0x2F, 0x0F, 0x00, 0x03, 0xD7,
-    0xC0, 0x00, 0xBA, 0xE0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xEE, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0xF8,
-    0xF4, 0x00, 0x3C, 0x2F, 0x00, 0x3F, 0x03, 0xFA, 0xBF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x92, 0x80, 0x7F, 0xFF,
-    0xF0, 0x7E, 0x46, 0xF4, 0x3E, 0x00, 0xBF, 0x0F, 0x00, 0x7B, 0xD7, 0xC0, 0x3C, 0xBA, 0xE0, 0x3D,
-    0x2E, 0xB8, 0x2E, 0x0B, 0xEE, 0x1F, 0x02, 0xE7, 0xCF, 0x00, 0xF8, 0xFF, 0x40, 0x3C, 0x2F, 0x80,
-    0x3F, 0x03, 0xFA, 0xBF, 0x03, 0xEF, 0xFE, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x50, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0,
-    0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3D,
-    0x00, 0x1F, 0x4B, 0xC0, 0x0F, 0xD1, 0xFE, 0xAF, 0xF4, 0x1F, 0xFE, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03,
-    0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00,
-    0xF4, 0xF0, 0x00, 0x3D, 0x3D, 0x00, 0x1F, 0x4B, 0xC0, 0x0F, 0xD1, 0xFE, 0xAF, 0xF4, 0x1F, 0xFE,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x0B,
-    0x87, 0xC0, 0x07, 0x40, 0x38, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF0, 0x00, 0x3D, 0x3C,
-    0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F,
-    0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3D, 0x00, 0x1F, 0x4B, 0xC0, 0x0F, 0xD1,
-    0xFE, 0xAF, 0xF4, 0x1F, 0xFE, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x3C,
-    0x00, 0x2D, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43, 0xC0, 0x00,
-    0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00,
-    0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF4, 0x00, 0x7D, 0x2F, 0x00,
-    0x3F, 0x47, 0xFA, 0xBF, 0xD0, 0x7F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x56, 0xE0, 0x00, 0x3D, 0x3C, 0x00, 0x1F, 0x0F, 0x40, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x3D,
-    0x01, 0xF0, 0x0B, 0x80, 0xB8, 0x00, 0xF0, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x07, 0x8F, 0x40, 0x00,
-    0xF3, 0xC0, 0x00, 0x2E, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4,
-    0x6A, 0x40, 0xF6, 0xFF, 0xF0, 0xFF, 0x41, 0xFC, 0xFC, 0x00, 0x3D, 0xF8, 0x00, 0x2E, 0xF4, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3E,
-    0xFE, 0x00, 0xBC, 0xFB, 0xEB, 0xF4, 0xF5, 0xFF, 0xD0, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x7C, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x5B, 0x80,
-    0x00, 0xF4, 0xF0, 0x00, 0x7C, 0x3D, 0x00, 0x2E, 0x07, 0xC0, 0x0F, 0x40, 0xF4, 0x07, 0xC0, 0x2E,
-    0x02, 0xE0, 0x03, 0xC0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x1E, 0x3D, 0x00, 0x03, 0xCF, 0x00, 0x00,
-    0xBB, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x1F, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C,
-    0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B,
-    0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00,
-    0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00,
-    0x2F, 0x0B, 0xFF, 0xE0, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x0F, 0xFF, 0xF0, 0x39,
-    0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0xF2, 0xFE, 0xAB, 0xDF,
-    0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x02, 0xFB, 0xC0, 0x1F, 0xDF, 0xEB, 0xEF, 0x1F, 0xFD, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0xF0, 0x0E, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00,
-    0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03,
-    0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E,
-    0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x05,
-    0x00, 0x50, 0x2C, 0x03, 0x80, 0x3F, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0xFF, 0xFF, 0x03, 0x90, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xBF, 0xFF,
-    0x2F, 0xEA, 0xBD, 0xF4, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x2F, 0xBC, 0x01, 0xFD, 0xFE, 0xBE,
-    0xF1, 0xFF, 0xD2, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8,
-    0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA,
-    0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00,
-    0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x00, 0x6A, 0x40, 0x0F, 0xFF, 0xF0, 0x0E, 0x41, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x02, 0xFF, 0xFC, 0x2F, 0xEA, 0xBC, 0x7D, 0x00,
-    0x3C, 0xF8, 0x00, 0x3C, 0xF4, 0x00, 0xBC, 0xBC, 0x01, 0xFC, 0x7F, 0xAF, 0xBC, 0x1F, 0xFD, 0x2C,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xD0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFC,
-    0x07, 0xF4, 0x00, 0x90, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xFA, 0xFD, 0x00, 0x1B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA4, 0x01, 0xFF, 0xFC, 0x0F, 0xD5, 0xA0, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xFF, 0xAF, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0x74, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xF4, 0x00, 0x90, 0x3F, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xFA, 0xFD,
-    0x00, 0x1B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xF4,
-    0x00, 0xF0, 0xF4, 0x0E, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x01, 0xFF, 0xFC, 0x0F, 0xD5,
-    0xA0, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFD, 0x00, 0x24,
-    0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0B, 0xFE, 0xBF, 0x40, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0xF4, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x7F, 0xFF, 0x03,
-    0xF5, 0x68, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xEB, 0xC0, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x2D, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF,
-    0xFC, 0x07, 0xF4, 0x00, 0x90, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xFA, 0xFD, 0x00, 0x1B, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x03, 0xC0, 0x3D, 0x7C, 0x00, 0x3F, 0xC0, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA4, 0x01, 0xFF, 0xFC, 0x0F, 0xD5, 0xA0, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x41, 0xF0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xE9, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0xB8, 0x01, 0xBF, 0x42, 0xE0, 0x00, 0x2F,
-    0x4B, 0x80, 0x00, 0x3F, 0x2E, 0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x03, 0xEB,
-    0x80, 0x00, 0x0B, 0xAE, 0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0xFA, 0xE0, 0x00, 0x03, 0xDB, 0x80,
-    0x00, 0x1F, 0x2E, 0x00, 0x00, 0xFC, 0xB8, 0x00, 0x0B, 0xC2, 0xE0, 0x01, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0x00, 0x00, 0x03, 0xD3, 0x80, 0x00, 0x00,
-    0xF5, 0xD0, 0x00, 0x00, 0x3D, 0xA0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x1A, 0x43, 0xD0, 0x00, 0x7F,
-    0xFD, 0xF4, 0x00, 0x7E, 0x47, 0xFD, 0x00, 0x3E, 0x00, 0x3F, 0x40, 0x1F, 0x00, 0x07, 0xD0, 0x07,
-    0xC0, 0x00, 0xF4, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x2E, 0x00, 0x03, 0xD0,
-    0x07, 0xC0, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x03, 0xFA, 0xBF,
-    0xD0, 0x00, 0x2F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE9, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7C, 0x01, 0xBF, 0x40, 0x1F, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x3F, 0x01,
-    0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x00, 0x3E, 0x3F, 0xFF, 0xC0, 0x0B,
-    0x9F, 0xFF, 0xF4, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00,
-    0x1F, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x1F, 0xD0, 0x07, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xA4, 0x3D, 0x00, 0x7F, 0xFD,
-    0xF4, 0x07, 0xE5, 0x7F, 0xD0, 0x3E, 0x00, 0x3F, 0x41, 0xF0, 0x00, 0x7D, 0x07, 0xC0, 0x00, 0xF4,
-    0x2E, 0x00, 0x03, 0xD0, 0xB8, 0x00, 0x0F, 0x42, 0xE0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0xF4, 0x0F,
-    0x00, 0x07, 0xD0, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0xAB, 0xFD, 0x00, 0x2F, 0xF8, 0xB4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF6,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xD5, 0x55,
-    0x2F, 0xFF, 0xFC, 0xBE, 0xAA, 0xA2, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00,
-    0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x40, 0x38, 0x07, 0x40, 0xBF, 0xF8, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xBD, 0x55, 0x52, 0xFF, 0xFF, 0xCB, 0xEA, 0xAA, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0x40, 0x05, 0x00, 0x10, 0x0B, 0x00, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E,
-    0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0x6E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBD,
-    0x55, 0x52, 0xFF, 0xFF, 0xCB, 0xEA, 0xAA, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B,
-    0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x40, 0x00, 0x04,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF,
-    0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40,
-    0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF6, 0xFF, 0xFF, 0xDB,
-    0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x55, 0x54,
-    0xBF, 0xFF, 0xF2, 0xFA, 0xAA, 0x8B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00,
-    0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0x00, 0x2C, 0x00, 0x01,
-    0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x54, 0x00, 0x6A, 0x40, 0x07,
-    0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF,
-    0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04,
-    0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x78, 0x0B, 0x80, 0x7C, 0xB8,
-    0x00, 0xBF, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF5, 0x55, 0x4B, 0xFF,
-    0xFF, 0x2F, 0xAA, 0xA8, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xF0,
-    0x03, 0xD7, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07,
-    0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF,
-    0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04,
-    0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x28, 0x02, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xF8, 0x00, 0x64, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x15, 0x54, 0x7C, 0x00, 0x3F, 0xFD, 0x7C, 0x00, 0x1A, 0xBD, 0x7C, 0x00, 0x00,
-    0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x3D, 0x07, 0xF4, 0x00,
-    0x3D, 0x01, 0xFF, 0xEB, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x4B, 0x80, 0x0B, 0x40, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x90, 0x10, 0x1F, 0xFF, 0x6D, 0x1F, 0x91, 0xFF, 0x4F, 0x80, 0x0F, 0xD7, 0xC0, 0x01,
-    0xF5, 0xF0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xDB, 0x80, 0x00, 0xF5, 0xF0, 0x00,
-    0x3D, 0x3C, 0x00, 0x1F, 0x4F, 0xC0, 0x0F, 0xD0, 0xFE, 0xAF, 0xF4, 0x0B, 0xFE, 0x3D, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x50, 0x01, 0xF8, 0x2F, 0xFF, 0xF8, 0x02, 0xFF,
-    0xE4, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x2C, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xF8,
-    0x00, 0x64, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x15, 0x54, 0x7C, 0x00, 0x3F, 0xFD, 0x7C, 0x00,
-    0x1A, 0xBD, 0x7C, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x3D, 0x0F, 0x80,
-    0x00, 0x3D, 0x07, 0xF4, 0x00, 0x3D, 0x01, 0xFF, 0xEB, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x20, 0x01, 0xD0, 0x2C, 0x00, 0x3F, 0xFE, 0x00, 0x02, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x40, 0x7F, 0xFD, 0xB4, 0x7E, 0x47, 0xFD, 0x3E, 0x00, 0x3F, 0x5F,
-    0x00, 0x07, 0xD7, 0xC0, 0x00, 0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xD7,
-    0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x7D, 0x3F, 0x00, 0x3F, 0x43, 0xFA, 0xBF, 0xD0, 0x2F, 0xF8, 0xF4,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC1, 0x40, 0x07, 0xE0, 0xBF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFC,
-    0x03, 0xF8, 0x00, 0x64, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x15, 0x54, 0x7C, 0x00, 0x3F, 0xFD,
-    0x7C, 0x00, 0x1A, 0xBD, 0x7C, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x3D,
-    0x0F, 0x80, 0x00, 0x3D, 0x07, 0xF4, 0x00, 0x3D, 0x01, 0xFF, 0xEB, 0xFD, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x40, 0x7F, 0xFD, 0xB4, 0x7E, 0x47, 0xFD, 0x3E, 0x00,
-    0x3F, 0x5F, 0x00, 0x07, 0xD7, 0xC0, 0x00, 0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x6E, 0x00,
-    0x03, 0xD7, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x7D, 0x3F, 0x00, 0x3F, 0x43, 0xFA, 0xBF, 0xD0, 0x2F,
-    0xF8, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC1, 0x40, 0x07, 0xE0, 0xBF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF,
-    0xFF, 0xFC, 0x03, 0xF8, 0x00, 0x64, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x15, 0x54, 0x7C, 0x00,
-    0x3F, 0xFD, 0x7C, 0x00, 0x1A, 0xBD, 0x7C, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00,
-    0x00, 0x3D, 0x0F, 0x80, 0x00, 0x3D, 0x07, 0xF4, 0x00, 0x3D, 0x01, 0xFF, 0xEB, 0xFD, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90,
-    0x10, 0x1F, 0xFF, 0x6D, 0x1F, 0x91, 0xFF, 0x4F, 0x80, 0x0F, 0xD7, 0xC0, 0x01, 0xF5, 0xF0, 0x00,
-    0x3D, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xDB, 0x80, 0x00, 0xF5, 0xF0, 0x00, 0x3D, 0x3C, 0x00,
-    0x1F, 0x4F, 0xC0, 0x0F, 0xD0, 0xFE, 0xAF, 0xF4, 0x0B, 0xFE, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x01, 0xF0, 0x50, 0x01, 0xF8, 0x2F, 0xFF, 0xF8, 0x02, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x02, 0xC0,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00,
-    0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2,
-    0xF5, 0x55, 0x57, 0xCB, 0xFF, 0xFF, 0xFF, 0x2F, 0xAA, 0xAA, 0xBC, 0xB8, 0x00, 0x00, 0xF2, 0xE0,
-    0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00,
-    0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0xB0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0xA9, 0x00, 0x0F, 0x6F, 0xFF, 0x00, 0x3F, 0xD4,
-    0x7F, 0x00, 0xFC, 0x00, 0x3C, 0x03, 0xE0, 0x00, 0xF4, 0x0F, 0x40, 0x03, 0xD0, 0x3D, 0x00, 0x0F,
-    0x40, 0xF4, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0xF4, 0x0F, 0x40, 0x03, 0xD0, 0x3D, 0x00, 0x0F, 0x40,
-    0xF4, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0xF4, 0x0F, 0x40, 0x03, 0xD0, 0x07, 0x80, 0x00, 0x0F, 0x00,
-    0x2E, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x02, 0xF5, 0x55, 0x57,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xAA, 0xAA, 0xBC, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x02,
-    0xE0, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00,
-    0x00, 0xF0, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x3C,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFE, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x5F, 0xFD, 0x00, 0xFB, 0xFB, 0xF8, 0x0F, 0xE0, 0x0B,
-    0xC0, 0xFC, 0x00, 0x3D, 0x0F, 0x80, 0x03, 0xD0, 0xF4, 0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF4,
-    0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF4, 0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF4, 0x00, 0x3D,
-    0x0F, 0x40, 0x03, 0xD0, 0x01, 0x00, 0x11, 0xFE, 0x0E, 0x39, 0xFF, 0xD3, 0x01, 0xB4, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00,
-    0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F,
-    0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x6F, 0xE0, 0x0F, 0xFF, 0x40, 0x01, 0x00,
-    0x11, 0xFE, 0x0E, 0x39, 0xFF, 0xD3, 0x01, 0xB4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xF4, 0x00,
-    0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F,
-    0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x7F, 0xFF,
-    0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFD, 0x2F, 0xF8, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x1B, 0xF8, 0x3F, 0xFD, 0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0x40,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x50, 0x02, 0x1C, 0x02, 0xC3, 0xFF,
-    0xD0, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x42, 0xFF, 0x80, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4,
-    0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0,
-    0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x06, 0xFE, 0x03, 0xFF, 0xD0, 0x50, 0x02,
-    0x1C, 0x02, 0xC3, 0xFF, 0xD0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3D, 0x00, 0x0F, 0x40,
-    0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00,
-    0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0xFF, 0xF6, 0xFF, 0x80, 0xF4, 0x03, 0xD0,
-    0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40,
-    0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x6F, 0xE3, 0xFF, 0xD0, 0x1D, 0x00, 0xE0, 0x0B, 0x00, 0x2D, 0x00,
-    0x7F, 0x40, 0x14, 0x01, 0x03, 0xD0, 0xF4, 0x04, 0x00, 0x01, 0x40, 0xF4, 0x3D, 0x0F, 0x43, 0xD0,
-    0xF4, 0x3D, 0x0F, 0x43, 0xD0, 0xF4, 0x3D, 0x0F, 0x43, 0xD0, 0xF4, 0x38, 0x3C, 0x0E, 0x07, 0x80,
-    0xFF, 0x05, 0x40, 0x01, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xDB, 0xFE, 0x03,
-    0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x41, 0xBF, 0x8F, 0xFF, 0x40, 0x53, 0xDF, 0x7D, 0xF7,
-    0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xD0, 0xFF, 0xF4, 0x0F, 0x2F, 0xF8, 0x03, 0xC0, 0xF4, 0x00,
-    0xF0, 0x3D, 0x00, 0x3C, 0x0F, 0x40, 0x0F, 0x03, 0xD0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x3D, 0x00,
-    0x3C, 0x0F, 0x40, 0x0F, 0x03, 0xD0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x3D, 0x00, 0x3C, 0x0F, 0x40,
-    0x0F, 0x03, 0xD0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x3D, 0x00, 0x3C, 0x6F, 0xE0, 0x0F, 0x3F, 0xFD,
-    0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x04, 0xBD, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xA9, 0x00, 0x04, 0x00, 0x43, 0xD0, 0x2F, 0x3D, 0x01, 0xF0, 0x40, 0x04, 0x00, 0x00, 0x01, 0x40,
-    0x05, 0x3D, 0x01, 0xF3, 0xD0, 0x1F, 0x3D, 0x01, 0xF3, 0xD0, 0x1F, 0x3D, 0x01, 0xF3, 0xD0, 0x1F,
-    0x3D, 0x01, 0xF3, 0xD0, 0x1F, 0x3D, 0x01, 0xF3, 0xD0, 0x1F, 0x3D, 0x01, 0xF3, 0xD0, 0x1F, 0x3D,
-    0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x0F, 0xFC, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFE, 0x00, 0xF4, 0xB8, 0x2D, 0x01, 0xD0, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00,
-    0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8,
-    0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x47, 0xF0, 0x0F, 0xFD, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x03,
-    0xFE, 0x00, 0xF4, 0xF4, 0x2C, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0x40, 0x00, 0xF4,
-    0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00,
-    0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F,
-    0x40, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x7F, 0xE0, 0x07, 0xF8, 0x00, 0x78, 0x00, 0x0B, 0x8B, 0x80,
-    0x02, 0xF0, 0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x1F, 0x00, 0xB8, 0x07, 0xD0, 0x0B, 0x80, 0xF4, 0x00,
-    0xB8, 0x3D, 0x00, 0x0B, 0x8F, 0x80, 0x00, 0xBB, 0xF8, 0x00, 0x0B, 0xFB, 0xD0, 0x00, 0xBD, 0x2F,
-    0x00, 0x0B, 0x80, 0xF8, 0x00, 0xB8, 0x07, 0xD0, 0x0B, 0x80, 0x2F, 0x00, 0xB8, 0x00, 0xFC, 0x0B,
-    0x80, 0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0x50, 0xF4, 0x02, 0xF0, 0xF4, 0x0B, 0xC0, 0xF4, 0x2F, 0x00, 0xF4, 0xBC, 0x00, 0xF5, 0xF0, 0x00,
-    0xF7, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0xFC, 0xBC, 0x00, 0xF4, 0x3E, 0x00, 0xF4, 0x0F, 0x40, 0xF4,
-    0x07, 0xC0, 0xF4, 0x02, 0xF0, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xF0,
-    0x00, 0x01, 0xE0, 0x00, 0x02, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x50, 0x00, 0x50, 0xF4, 0x02, 0xF0,
-    0xF4, 0x0B, 0xC0, 0xF4, 0x1F, 0x40, 0xF4, 0x7D, 0x00, 0xF4, 0xF8, 0x00, 0xF7, 0xF0, 0x00, 0xFF,
-    0xF4, 0x00, 0xFD, 0xBC, 0x00, 0xF8, 0x3F, 0x00, 0xF4, 0x0F, 0x80, 0xF4, 0x07, 0xD0, 0xF4, 0x02,
-    0xF0, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B,
-    0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x3E, 0x0B, 0xC1, 0xF0, 0x38, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03,
-    0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x78, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x00, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x00, 0x05, 0x2E, 0x3C, 0x38, 0x20, 0x78, 0x00, 0xB6, 0xE0, 0x03, 0xCB, 0x80, 0x0E,
-    0x2E, 0x00, 0x70, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0xF4, 0xF7, 0xD3, 0xCF, 0x4D, 0x3D,
-    0xB0, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4,
-    0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0x78, 0x00, 0x02, 0xE0,
-    0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E,
-    0x00, 0x40, 0xB8, 0x0B, 0xC2, 0xE0, 0x2F, 0x0B, 0x80, 0x10, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0xF4, 0x0F,
-    0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x4F, 0x6F, 0xF6, 0xFF, 0x44,
-    0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x00, 0x07, 0x80, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x2E, 0x2E, 0x00, 0x0B, 0xFF, 0x40, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x1B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xD0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC4, 0x03, 0xFD, 0x03, 0xF8, 0x1F, 0xD0, 0x3F, 0xC0, 0x13, 0xC0,
-    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x07, 0x6F, 0xC0, 0x00, 0x2E, 0xBF, 0x80, 0x00, 0xBA, 0xEF, 0x00,
-    0x02, 0xEB, 0x6F, 0x00, 0x0B, 0xAD, 0x3D, 0x00, 0x2E, 0xB4, 0x7C, 0x00, 0xBA, 0xD0, 0xFC, 0x02,
-    0xEB, 0x80, 0xF4, 0x0B, 0xAE, 0x02, 0xF0, 0x2E, 0xB8, 0x03, 0xE0, 0xBA, 0xE0, 0x03, 0xD2, 0xEB,
-    0x80, 0x0B, 0xC7, 0xAE, 0x00, 0x0F, 0x9E, 0xB8, 0x00, 0x1F, 0xBA, 0xE0, 0x00, 0x2F, 0xEB, 0x80,
-    0x00, 0x3F, 0xAE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x3D, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x50, 0x6A, 0x40, 0xF2, 0xFF, 0xF0, 0xFF, 0x51,
-    0xFC, 0xFC, 0x00, 0x3C, 0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D,
-    0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0x7D, 0x00, 0x00, 0x76, 0xFC, 0x00, 0x02, 0xEB, 0xF8, 0x00, 0x0B, 0xAE, 0xF0, 0x00,
-    0x2E, 0xB6, 0xF0, 0x00, 0xBA, 0xD3, 0xD0, 0x02, 0xEB, 0x47, 0xC0, 0x0B, 0xAD, 0x0F, 0xC0, 0x2E,
-    0xB8, 0x0F, 0x40, 0xBA, 0xE0, 0x2F, 0x02, 0xEB, 0x80, 0x3E, 0x0B, 0xAE, 0x00, 0x3D, 0x2E, 0xB8,
-    0x00, 0xBC, 0x7A, 0xE0, 0x00, 0xF9, 0xEB, 0x80, 0x01, 0xFB, 0xAE, 0x00, 0x02, 0xFE, 0xB8, 0x00,
-    0x03, 0xFA, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x50, 0x6A, 0x40, 0xF2,
-    0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3C, 0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00,
-    0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D,
-    0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xB4, 0x00,
-    0x0B, 0xCF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x07, 0x6F, 0xC0, 0x00, 0x2E, 0xBF, 0x80, 0x00, 0xBA, 0xEF, 0x00, 0x02, 0xEB, 0x6F, 0x00,
-    0x0B, 0xAD, 0x3D, 0x00, 0x2E, 0xB4, 0x7C, 0x00, 0xBA, 0xD0, 0xFC, 0x02, 0xEB, 0x80, 0xF4, 0x0B,
-    0xAE, 0x02, 0xF0, 0x2E, 0xB8, 0x03, 0xE0, 0xBA, 0xE0, 0x03, 0xD2, 0xEB, 0x80, 0x0B, 0xC7, 0xAE,
-    0x00, 0x0F, 0x9E, 0xB8, 0x00, 0x1F, 0xBA, 0xE0, 0x00, 0x2F, 0xEB, 0x80, 0x00, 0x3F, 0xAE, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x07, 0xCB, 0x80, 0x01, 0xFF, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x6A, 0x40, 0xF2, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3C,
-    0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x2E, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB4, 0x50,
-    0x6A, 0x40, 0xF0, 0xF3, 0xFF, 0xF0, 0x40, 0xFF, 0x45, 0xF8, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0xF4,
-    0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x7D, 0x00, 0x00, 0x76, 0xFC, 0x00, 0x02, 0xEB, 0xF8, 0x00,
-    0x0B, 0xAE, 0xF4, 0x00, 0x2E, 0xB6, 0xF0, 0x00, 0xBA, 0xD3, 0xE0, 0x02, 0xEB, 0x47, 0xD0, 0x0B,
-    0xAD, 0x0B, 0xC0, 0x2E, 0xB8, 0x0F, 0x80, 0xBA, 0xE0, 0x1F, 0x42, 0xEB, 0x80, 0x2F, 0x0B, 0xAE,
-    0x00, 0x3E, 0x1E, 0xB8, 0x00, 0x7D, 0x7A, 0xE0, 0x00, 0xBD, 0xEB, 0x80, 0x00, 0xFF, 0xAE, 0x00,
-    0x00, 0xFE, 0xB8, 0x00, 0x02, 0xFA, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x46, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0A, 0xA0, 0x00, 0x50, 0x6A, 0x40,
-    0xF2, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3D, 0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00,
-    0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xF8,
-    0x00, 0x7F, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00, 0x0F, 0x8F,
-    0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x07,
-    0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00,
-    0x1F, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x1F, 0xC0, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0x6F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x07, 0xFF, 0xF4, 0x03, 0xE4, 0x6F, 0x43, 0xE0, 0x02, 0xF0, 0xF0, 0x00,
-    0x3D, 0x7C, 0x00, 0x0B, 0xAE, 0x00, 0x02, 0xEB, 0x80, 0x00, 0xBE, 0xE0, 0x00, 0x2E, 0x7C, 0x00,
-    0x0F, 0x8F, 0x40, 0x03, 0xC2, 0xF0, 0x03, 0xF0, 0x3F, 0xAB, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x01, 0x40, 0x00, 0x0E, 0x01, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00,
-    0xF8, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00,
-    0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0,
-    0x00, 0x01, 0xF0, 0x7D, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00,
-    0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0xD0, 0x1C, 0x00, 0x2F,
-    0xFE, 0x00, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x7F, 0xFF, 0x40, 0x3E,
-    0x46, 0xF4, 0x3E, 0x00, 0x2F, 0x0F, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xBA, 0xE0, 0x00, 0x2E, 0xB8,
-    0x00, 0x0B, 0xEE, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0xF8, 0xF4, 0x00, 0x3C, 0x2F, 0x00, 0x3F, 0x03,
-    0xFA, 0xBF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1,
-    0xF0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x00, 0xB0, 0x34, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x03,
-    0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x0B,
-    0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00,
-    0x07, 0xDF, 0x00, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x7C, 0x1F, 0x40,
-    0x00, 0x3E, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x2E, 0x0F, 0x00, 0x0E, 0x0F,
-    0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0x91,
-    0xBD, 0x0F, 0x80, 0x0B, 0xC3, 0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xAE, 0x00,
-    0x02, 0xFB, 0x80, 0x00, 0xB9, 0xF0, 0x00, 0x3E, 0x3D, 0x00, 0x0F, 0x0B, 0xC0, 0x0F, 0xC0, 0xFE,
-    0xAF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0x80, 0x0F, 0x80, 0x00, 0x0F, 0x80,
-    0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0x01, 0xF0, 0x00,
-    0x0B, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xE5, 0x55, 0x1F, 0x00, 0x00, 0xBF, 0xFF, 0xC7, 0xC0, 0x00,
-    0x2F, 0xAA, 0xA1, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00,
-    0xB8, 0x00, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xE0, 0x02,
-    0xE0, 0x00, 0x00, 0xBF, 0xEB, 0xFF, 0xFF, 0xE0, 0x06, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x06, 0x90, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xD0, 0x1F, 0x91, 0xFD,
-    0xF4, 0x2F, 0x43, 0xE0, 0x02, 0xFD, 0x00, 0xBC, 0x7C, 0x00, 0x0F, 0xC0, 0x03, 0xCB, 0xC0, 0x00,
-    0xF8, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0xFF, 0xFF, 0xDB, 0x80, 0x00, 0xFE, 0xAA, 0xA8, 0xB8, 0x00,
-    0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF0,
-    0x03, 0xFF, 0x00, 0x04, 0x0F, 0xEA, 0xF8, 0xFE, 0xAF, 0xC0, 0x2F, 0xFD, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x0B, 0xFF, 0xFF,
-    0x40, 0xB8, 0x01, 0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x2F, 0x0B, 0x80, 0x01, 0xF0, 0xB8,
-    0x00, 0x2E, 0x0B, 0x80, 0x03, 0xD0, 0xBD, 0x56, 0xF8, 0x0B, 0xFF, 0xFD, 0x00, 0xBE, 0xAF, 0x80,
-    0x0B, 0x80, 0x7C, 0x00, 0xB8, 0x02, 0xF0, 0x0B, 0x80, 0x0F, 0x40, 0xB8, 0x00, 0xBC, 0x0B, 0x80,
-    0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x02,
-    0xE0, 0x03, 0x80, 0x00, 0x00, 0x50, 0x2A, 0xF1, 0xFF, 0xF7, 0xD5, 0xFE, 0x00, 0xFC, 0x00, 0xF4,
-    0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4,
-    0x00, 0x7F, 0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0xB8, 0x01, 0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8,
-    0x00, 0x2F, 0x0B, 0x80, 0x01, 0xF0, 0xB8, 0x00, 0x2E, 0x0B, 0x80, 0x03, 0xD0, 0xBD, 0x56, 0xF8,
-    0x0B, 0xFF, 0xFD, 0x00, 0xBE, 0xAF, 0x80, 0x0B, 0x80, 0x7C, 0x00, 0xB8, 0x02, 0xF0, 0x0B, 0x80,
-    0x0F, 0x40, 0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x14, 0x0A, 0x8F, 0x1F, 0xF3, 0xDF, 0x54, 0xFE, 0x00, 0x3F, 0x00,
-    0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00,
-    0x3D, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x03, 0x40, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x07, 0xCB, 0x80, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0xB8, 0x01,
-    0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x2F, 0x0B, 0x80, 0x01, 0xF0, 0xB8, 0x00, 0x2E, 0x0B,
-    0x80, 0x03, 0xD0, 0xBD, 0x56, 0xF8, 0x0B, 0xFF, 0xFD, 0x00, 0xBE, 0xAF, 0x80, 0x0B, 0x80, 0x7C,
-    0x00, 0xB8, 0x02, 0xF0, 0x0B, 0x80, 0x0F, 0x40, 0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x03, 0xE0, 0xB8,
-    0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x0F, 0x5F, 0x00, 0x3F, 0xC0,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x14, 0x0A, 0x83, 0xC7, 0xFC, 0x3D, 0xF5, 0x43, 0xF8, 0x00, 0x3F,
-    0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFC,
-    0x3E, 0x00, 0x14, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00, 0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0B, 0x80, 0x00, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0xA9, 0x02, 0xFF, 0xFD, 0x7D, 0x06, 0xCB, 0x40, 0x00, 0xB8, 0x00, 0x07, 0xE0,
-    0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x2E, 0x00, 0x01, 0xF4, 0x00, 0x2E,
-    0xBE, 0xAF, 0xC7, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFF,
-    0x40, 0x03, 0xC3, 0xD0, 0x0A, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFC,
-    0x3E, 0x00, 0x14, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00, 0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xFD, 0x01, 0xF0, 0xF0, 0x38, 0x02, 0xC0,
-    0x00, 0x00, 0x01, 0xA9, 0x02, 0xFF, 0xFD, 0x7D, 0x06, 0xCB, 0x40, 0x00, 0xB8, 0x00, 0x07, 0xE0,
-    0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x2E, 0x00, 0x01, 0xF4, 0x00, 0x2E,
-    0xBE, 0xAF, 0xC7, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF,
-    0xFC, 0x3E, 0x00, 0x14, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00, 0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF,
-    0x80, 0x00, 0xB4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x6E, 0x00,
-    0x03, 0xF8, 0x00, 0x01, 0xA9, 0x02, 0xFF, 0xFD, 0x7D, 0x06, 0xCB, 0x40, 0x00, 0xB8, 0x00, 0x07,
-    0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x2E, 0x00, 0x01, 0xF4, 0x00,
-    0x2E, 0xBE, 0xAF, 0xC7, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xD0,
-    0x01, 0x7C, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xF0, 0x03, 0xD7, 0xC0, 0x00, 0xFF,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFC, 0x3E, 0x00, 0x14,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00, 0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x7C, 0x0F, 0x5F, 0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xA9, 0x02, 0xFF, 0xFD, 0x7D, 0x06, 0xCB, 0x40, 0x00, 0xB8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF4,
-    0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x2E, 0x00, 0x01, 0xF4, 0x00, 0x2E, 0xBE, 0xAF, 0xC7,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x17, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x78, 0x00,
-    0x7E, 0x54, 0xBF, 0xFF, 0x47, 0xE5, 0x40, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00,
-    0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0xE9, 0x01, 0xFF, 0x40,
-    0x1D, 0x00, 0x0F, 0x40, 0x01, 0xB8, 0x00, 0x0F, 0x00, 0x5B, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x07, 0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2D, 0x01, 0x00, 0x3C, 0x03, 0x80, 0x34, 0x07, 0x80, 0x00,
-    0x1F, 0x95, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0x95, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B,
-    0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80,
-    0x00, 0x0B, 0xC0, 0x00, 0x03, 0xFA, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x00, 0x00, 0xE0,
-    0x00, 0x78, 0x00, 0x7E, 0x54, 0xBF, 0xFF, 0x47, 0xE5, 0x40, 0xB8, 0x00, 0x2E, 0x00, 0x6F, 0xEA,
-    0x1F, 0xFF, 0xC0, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0xE9,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x2F, 0xE0, 0xE0, 0x03, 0x9F, 0xFC, 0x00,
-    0x70, 0x1B, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFB, 0x80, 0x00, 0x1F, 0xBC, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0, 0xFF,
-    0xAF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0xFF, 0x47, 0x00,
-    0xB6, 0xFF, 0xC0, 0x24, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43, 0xC0, 0x00, 0xF4,
-    0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D,
-    0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF4, 0x00, 0x7D, 0x2F, 0x00, 0x3F,
-    0x47, 0xFA, 0xBF, 0xD0, 0x7F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFB, 0x80,
-    0x00, 0x1F, 0xBC, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0, 0xFF, 0xAF, 0xF0,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x14, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00,
-    0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00,
-    0x0F, 0x4F, 0x40, 0x07, 0xD2, 0xF0, 0x03, 0xF4, 0x7F, 0xAB, 0xFD, 0x07, 0xFF, 0x8B, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x04, 0x00, 0x2C, 0x03, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFB, 0x80, 0x00,
-    0x1F, 0xBC, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0, 0xFF, 0xAF, 0xF0, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0xE0, 0x1D, 0x00, 0x1F, 0xFF, 0x00,
-    0x01, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D,
-    0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F,
-    0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF4, 0x00, 0x7D, 0x2F, 0x00, 0x3F, 0x47, 0xFA, 0xBF,
-    0xD0, 0x7F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xB0,
-    0xB0, 0x00, 0x0B, 0x0B, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x1F, 0xBC, 0x00, 0x01,
-    0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0, 0xFF, 0xAF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0E, 0x0D, 0x00, 0x03, 0x43, 0x40, 0x00,
-    0xB6, 0xC0, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x3C, 0x00, 0x0F, 0x4F,
-    0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3,
-    0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x40, 0x07, 0xD2, 0xF0, 0x03, 0xF4,
-    0x7F, 0xAB, 0xFD, 0x07, 0xFF, 0x8B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3,
-    0xD0, 0x00, 0xF0, 0xB8, 0x00, 0x2D, 0x1E, 0x00, 0x03, 0x42, 0x80, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x1F,
-    0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x1E, 0x0F, 0x00, 0x0F, 0x0B, 0x40, 0x0A,
-    0x03, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F,
-    0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3,
-    0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3D, 0x00, 0x1F, 0x4B, 0xC0, 0x0F, 0xD1, 0xFE, 0xAF, 0xF4,
-    0x1F, 0xFE, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xB8, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0xFC, 0x0F,
-    0xFA, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x50, 0x14, 0x00, 0x05, 0x0F, 0x00,
-    0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0,
-    0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xD0, 0x01, 0xF4, 0xBC,
-    0x00, 0xFD, 0x1F, 0xEA, 0xFF, 0x41, 0xFF, 0xE2, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x1F, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0xB8, 0x00, 0x07, 0x9F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x3D, 0x00, 0x1F, 0xD0, 0x00, 0xF4,
-    0xF8, 0x00, 0xBB, 0x80, 0x07, 0xC2, 0xF0, 0x03, 0xDF, 0x00, 0x2F, 0x07, 0xC0, 0x0F, 0x3D, 0x00,
-    0xF8, 0x0F, 0x40, 0x78, 0xB8, 0x03, 0xC0, 0x3E, 0x03, 0xD0, 0xF0, 0x1F, 0x00, 0x7C, 0x0F, 0x03,
-    0xC0, 0xB8, 0x00, 0xF0, 0x7C, 0x0B, 0x83, 0xD0, 0x03, 0xD2, 0xD0, 0x1F, 0x0F, 0x00, 0x0B, 0x8F,
-    0x00, 0x3C, 0x7C, 0x00, 0x1F, 0x3C, 0x00, 0xB6, 0xE0, 0x00, 0x3D, 0xE0, 0x01, 0xEB, 0x40, 0x00,
-    0xFB, 0x40, 0x03, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x14, 0x00, 0x14, 0x7C, 0x00, 0xBD, 0x00, 0x3C, 0x3C, 0x00,
-    0xFE, 0x00, 0x7C, 0x3D, 0x01, 0xEF, 0x00, 0xB8, 0x2E, 0x02, 0xDF, 0x00, 0xF4, 0x1F, 0x03, 0xC7,
-    0x80, 0xF0, 0x0F, 0x03, 0xC3, 0xC1, 0xE0, 0x0F, 0x4B, 0x83, 0xC2, 0xD0, 0x0B, 0x8F, 0x02, 0xD3,
-    0xC0, 0x07, 0xCF, 0x01, 0xF3, 0xC0, 0x03, 0xDE, 0x00, 0xF7, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0x40,
-    0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x03, 0x80, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0xF4, 0x2E, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x3D, 0x00,
-    0xB8, 0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x00, 0x02, 0xF0, 0xB8, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x07,
-    0xEE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x4B,
-    0x80, 0x0B, 0x40, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x56, 0xE0, 0x00, 0x3D, 0x3C, 0x00,
-    0x1F, 0x0F, 0x40, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x3D, 0x01, 0xF0, 0x0B, 0x80, 0xB8, 0x00, 0xF0,
-    0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x07, 0x8F, 0x40, 0x00, 0xF3, 0xC0, 0x00, 0x2E, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07,
-    0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC2, 0xD0,
-    0x00, 0x1F, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xC7,
-    0xC0, 0x00, 0x3D, 0x0B, 0x80, 0x02, 0xF0, 0x0F, 0x00, 0x0F, 0x40, 0x2E, 0x00, 0xBC, 0x00, 0x3D,
-    0x03, 0xC0, 0x00, 0xBC, 0x2E, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x40, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x0B, 0xFF, 0xFE, 0x05, 0x55, 0xF4, 0x00, 0x0B, 0x80,
-    0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00,
-    0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xFA, 0xAA, 0x8F, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x10, 0x00, 0x01,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x42, 0xFF, 0xFF, 0x81,
-    0x55, 0x7D, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
-    0x03, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xFE, 0xAA, 0xA3, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0xC0, 0x00, 0xB8, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x3C, 0x7C, 0x00, 0x7F, 0xC0,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x0B, 0xFF, 0xFE, 0x05, 0x55, 0xF4, 0x00, 0x0B,
-    0x80, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF4,
-    0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xFA, 0xAA, 0x8F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0x3F, 0xB8, 0xBC, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00,
-    0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00,
-    0xF4, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0x40, 0x7C, 0x01, 0xD0, 0x00, 0x00, 0x3E, 0x0B,
-    0x81, 0xF0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xFD, 0x00, 0xF0, 0xF4, 0x38, 0x02,
-    0xC0, 0x01, 0x00, 0x11, 0xFE, 0x0A, 0x3D, 0xFF, 0xD3, 0x01, 0xB4, 0xBF, 0xFE, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0x50, 0x05, 0xB0, 0x0E, 0x3F, 0xFC, 0x0B, 0xE0,
-    0x14, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x2D, 0x78, 0x2D, 0x00, 0x00, 0x29, 0x07, 0xFC, 0x02,
-    0xC0, 0x3C, 0x1F, 0x41, 0xC0, 0x04, 0x00, 0x05, 0x03, 0xFC, 0xB0, 0xEA, 0x0B, 0x7A, 0xD1, 0xF4,
-    0x00, 0x00, 0x00, 0x7C, 0x3E, 0x0F, 0x47, 0xC1, 0xE0, 0xF0, 0x34, 0x28, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x7C, 0x0F, 0x5F, 0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0x0F,
-    0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC7, 0xC0, 0x3D, 0x2E, 0x00, 0xF0, 0xB4, 0x03,
-    0x42, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x52, 0x85, 0xB0, 0x0E, 0x3F, 0xFC, 0x0B, 0xE0,
-    0x05, 0x50, 0x2F, 0xFC, 0xB9, 0x5E, 0xA0, 0x06, 0x0E, 0x1D, 0x3D, 0x3C, 0xBC, 0xF8, 0x50, 0x2E,
-    0x3E, 0x3C, 0x7C, 0x74, 0xB0, 0x00, 0xF8, 0xBC, 0x7C, 0x3C, 0x2D, 0x0E, 0x00, 0x2E, 0x3E, 0x3D,
-    0x3C, 0x78, 0xB0, 0x00, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x78, 0x01, 0xD0, 0x00, 0x00, 0x7C, 0x0F,
-    0x42, 0xD0, 0x74, 0x00, 0x00, 0x40, 0x1C, 0x2B, 0xC3, 0xFC, 0x01, 0xC0, 0x04, 0x10, 0x03, 0x40,
-    0x3E, 0x83, 0xFC, 0x34, 0x01, 0x00, 0xBF, 0xFD, 0xAA, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
-    0xF0, 0x03, 0xE0, 0x3D, 0x0B, 0xC7, 0xF0, 0xB8, 0x00, 0x00, 0x09, 0x3D, 0x70, 0x70, 0x3D, 0x05,
-    0x0A, 0x00, 0xF0, 0x1F, 0x4B, 0xFE, 0x00, 0x00, 0xBF, 0xE6, 0xF9, 0x0F, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x6F, 0x9B, 0xFE, 0x0F, 0x00, 0xA0, 0x15, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF7, 0xF9, 0xF8, 0x00, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0B,
-    0xF4, 0xBD, 0x12, 0xEB, 0x84, 0x00, 0x00, 0x78, 0x2D, 0x78, 0x2D, 0x00, 0x00, 0x05, 0x03, 0xFC,
-    0xB0, 0xEA, 0x0B, 0x7A, 0xD1, 0xF4, 0x15, 0x2D, 0x3C, 0x74, 0x50, 0x0A, 0x00, 0xE0, 0x07, 0xC0,
-    0x1D, 0x17, 0xC7, 0xF4, 0x01, 0x00, 0xB0, 0x2C, 0x03, 0xC0, 0x3C, 0x02, 0xFC, 0x05, 0x40, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xD7, 0xEA, 0xBD, 0x70, 0x00, 0xD7, 0x00, 0x0D, 0x10, 0x00, 0x40, 0x50,
-    0x50, 0x5B, 0x0F, 0x0E, 0x3F, 0xFF, 0xC0, 0x50, 0x50, 0x00, 0x00, 0x03, 0xD0, 0x7C, 0x0F, 0x5F,
-    0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xFD, 0x01, 0xF0, 0xF0,
-    0x38, 0x02, 0xC0, 0x40, 0x05, 0xB0, 0x0E, 0x3F, 0xFC, 0x0B, 0xE0, 0x05, 0x50, 0x2F, 0xFC, 0xB9,
-    0x5E, 0xA0, 0x06, 0x01, 0x00, 0x42, 0xFD, 0x0D, 0x79, 0xFF, 0xC6, 0x01, 0xE0, 0xBF, 0xFE, 0xBF,
-    0xFE, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0x01, 0x00, 0x12, 0xFE, 0x0E, 0x39, 0xFF,
-    0xC7, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x08, 0x00, 0xBD, 0x07, 0xF4, 0x3F, 0x80, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x00, 0x00, 0xF0,
-    0x00, 0x1D, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x1D, 0x00, 0x03,
-    0xC0, 0x00, 0x38, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00,
-    0x0B, 0x40, 0x00, 0x50, 0x00, 0x00, 0x20, 0x3C, 0x0D, 0x0D, 0x3C, 0x20, 0x70, 0x00, 0xD7, 0x00,
-    0x0D, 0x70, 0x00, 0xD7, 0xFF, 0xFD, 0x15, 0x55, 0x40, 0x15, 0x55, 0x4B, 0xFF, 0xFE, 0xA0, 0x00,
-    0xAA, 0x00, 0x0A, 0xBA, 0xAA, 0xEA, 0xAA, 0xAA, 0x05, 0x05, 0x03, 0xFF, 0xFC, 0xB0, 0xF0, 0xE5,
-    0x05, 0x05, 0x00, 0x07, 0x5D, 0x2F, 0x81, 0xF4, 0x7A, 0xD1, 0x04, 0x09, 0x7D, 0xB0, 0x38, 0x2D,
-    0x0E, 0x7C, 0x50, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0xF4, 0x02, 0x80, 0x00, 0x00, 0xF8,
-    0x2F, 0x07, 0xC0, 0xA0, 0x00, 0x01, 0x00, 0x42, 0xFD, 0x0D, 0x79, 0xFF, 0xC6, 0x01, 0xE0, 0x54,
-    0xFD, 0x1E, 0x1D, 0x24, 0x00, 0x54, 0x00, 0x3D, 0x0B, 0x5F, 0x7E, 0xDB, 0x1F, 0x03, 0x80, 0x00,
-    0xF0, 0xF0, 0xF9, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x79, 0x55, 0x6D, 0x70, 0x00, 0x0D,
-    0x70, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x54, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x00, 0x00,
-    0x2A, 0x87, 0xFD, 0x01, 0xD0, 0x1D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x13, 0x84, 0x2F, 0xF0, 0xD7,
-    0xAF, 0xFC, 0x62, 0xDE, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x14,
-    0x04, 0x2F, 0xD0, 0xD7, 0xAF, 0xFC, 0x60, 0x1E, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x05, 0x00,
-    0x05, 0x00, 0x82, 0xFE, 0x6C, 0x38, 0xBF, 0x41, 0x00, 0x40, 0x0F, 0x81, 0xC3, 0xEF, 0xFC, 0x30,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x1F, 0xAF, 0x43, 0xFF, 0xFC, 0x0A, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0xF0, 0x0F, 0x00, 0xF0, 0xFF, 0x03, 0xFC, 0x0F, 0xFE, 0x90,
-    0x1A, 0x40, 0x6B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x5A, 0x50, 0x07, 0x00, 0x15, 0x05, 0x40,
-    0x00, 0x06, 0x00, 0x09, 0x00, 0x01, 0x40, 0x00, 0x14, 0x0D, 0x14, 0x00, 0x01, 0x47, 0xD2, 0x00,
-    0x00, 0x08, 0x7D, 0x20, 0x00, 0x00, 0x87, 0xD0, 0x00, 0x00, 0x04, 0x70, 0x28, 0x00, 0x01, 0x80,
-    0x00, 0x50, 0x00, 0x50, 0x00, 0x05, 0x40, 0x15, 0x00, 0xD0, 0x09, 0xA6, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x07, 0xE5, 0x01, 0x54, 0x05, 0xBF, 0xF0, 0x3F, 0xC0, 0xFF, 0x20, 0x0F, 0x80, 0x7C, 0x7F,
-    0x38, 0x00, 0x00, 0x05, 0x2D, 0x34, 0x34, 0x2D, 0x05, 0x1F, 0xF4, 0x7F, 0xFD, 0xB0, 0x0E, 0x43,
-    0xC1, 0x07, 0xD0, 0x02, 0x80, 0x00, 0x03, 0x5C, 0x2F, 0xC1, 0xF4, 0x3E, 0xC0, 0x04, 0x01, 0xCB,
-    0xE3, 0xD0, 0xBE, 0x01, 0xC0, 0x34, 0x0B, 0xD0, 0x7C, 0xBE, 0x34, 0x00, 0xA0, 0x06, 0x07, 0xE0,
-    0xF8, 0x0F, 0x8E, 0xC7, 0xE2, 0xCD, 0xA0, 0x34, 0xA0, 0x20, 0x3C, 0x0E, 0x0E, 0x3C, 0x20, 0x12,
-    0xFB, 0xC4, 0x00, 0x00, 0xF0, 0x7F, 0xD6, 0xF9, 0x2F, 0x81, 0x54, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-    0xB0, 0xF0, 0xEE, 0x0A, 0x0B, 0xB5, 0xF5, 0xE2, 0xF5, 0xF8, 0x14, 0x03, 0x40, 0x3F, 0xC1, 0x6C,
-    0x02, 0x80, 0x00, 0x74, 0x00, 0x00, 0x00, 0x1D, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0xE4, 0x00,
-    0x1B, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xAA, 0x90, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x1D, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0xE4, 0x00, 0x1B, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x06, 0xAA, 0x90, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x15, 0x55, 0x55, 0x54, 0x01, 0x54, 0x00, 0x00, 0x05, 0x1F, 0xFF, 0xE9, 0x00, 0x1D, 0x3D,
-    0x56, 0xBF, 0xFF, 0xF8, 0x60, 0x00, 0x01, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xAA, 0xFF, 0xC0, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x3C, 0x00, 0x00,
-    0x00, 0x3C, 0x60, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x02, 0xAA, 0xAA, 0xAA, 0xAB, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x09, 0x1A, 0xE3, 0x06, 0x70, 0xE1, 0x91,
-    0x1A, 0x83, 0x06, 0x7A, 0xF3, 0x00, 0x34, 0x00, 0x68, 0x20, 0x27, 0x77, 0x71, 0x1E, 0x81, 0xC1,
-    0xCA, 0x03, 0x18, 0x0C, 0x34, 0xA0, 0x29, 0x00, 0x60, 0x26, 0x03, 0x60, 0x36, 0x07, 0x30, 0xB1,
-    0xA1, 0x2F, 0x68, 0x0C, 0x03, 0x40, 0x70, 0x06, 0x80, 0x00, 0x00, 0x03, 0x00, 0x32, 0xEB, 0x70,
-    0xB9, 0x03, 0xA0, 0x73, 0x0B, 0x0A, 0x10, 0x00, 0x06, 0x00, 0x60, 0x07, 0xAD, 0x70, 0x76, 0x03,
-    0x60, 0x36, 0x03, 0x10, 0x10, 0x2A, 0xDA, 0xC3, 0x07, 0x06, 0x30, 0x30, 0x63, 0x03, 0x06, 0x30,
-    0x30, 0x61, 0x01, 0x01, 0x2B, 0x4D, 0x03, 0x00, 0xC0, 0x30, 0x04, 0x00, 0x00, 0x09, 0x07, 0xE0,
-    0xD0, 0x34, 0x0D, 0x02, 0x80, 0x28, 0x60, 0x30, 0xC1, 0x82, 0x4C, 0x03, 0x60, 0x0F, 0x40, 0x04,
-    0x00, 0x30, 0x50, 0x67, 0x00, 0xB0, 0x03, 0x90, 0x24, 0xC0, 0x40, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFD, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xF5, 0x55, 0x4B, 0xFF, 0xFF, 0x2F, 0xAA, 0xA8, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x01, 0x01,
-    0x00, 0x2E, 0x1F, 0x00, 0xB8, 0x7C, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0x6E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBD,
-    0x55, 0x52, 0xFF, 0xFF, 0xCB, 0xEA, 0xAA, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B,
-    0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x40, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01, 0xF6, 0xFE, 0x40,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0x40, 0x1F, 0xC0, 0x07, 0xC0, 0x01, 0xF4, 0x01, 0xF0, 0x00,
-    0x3E, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x1F, 0x00, 0x02, 0xE0, 0x07, 0xC0, 0x00, 0xF4, 0x01, 0xF0,
-    0x00, 0xBC, 0x00, 0x7C, 0x2A, 0xFD, 0x00, 0x1F, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFC, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00,
-    0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x7F, 0x40, 0x08, 0x0F,
-    0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x50, 0x2F, 0xFE, 0xFE,
-    0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFC,
-    0x3E, 0x00, 0x14, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00, 0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x7A, 0xEB, 0xAE, 0xBA, 0xEB, 0xAE, 0xBA, 0xEB, 0xAE, 0xBA, 0xEB, 0xAE, 0xBA,
-    0xE0, 0x14, 0x50, 0xF3, 0xD3, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xB8, 0x02, 0xE0, 0x0B,
-    0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E,
-    0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x00, 0x00, 0xB4, 0x02, 0xE0, 0x0B, 0x80,
-    0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00,
-    0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x3D, 0x47, 0xF3, 0xFF,
-    0x4A, 0xA0, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x7F, 0xFE, 0x40, 0x00, 0xF0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xF0, 0x00, 0x7C, 0x01, 0xFC, 0x00,
-    0xF0, 0x00, 0x7C, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x7C, 0x00,
-    0x1F, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x1F, 0x02, 0xD0, 0x00, 0x7C, 0x00, 0x3E, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0xFC, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0,
-    0x00, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0xAA, 0xAA,
-    0xFA, 0xA9, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0xF5, 0x55, 0x5F, 0x55, 0x7F, 0x4B, 0x80,
-    0x00, 0x3C, 0x00, 0x2F, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x3D, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0xF6,
-    0xE0, 0x00, 0x0F, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x3C, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0xF0, 0x01,
-    0xF8, 0xB8, 0x00, 0x03, 0xFF, 0xFF, 0x82, 0xE0, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01, 0xF6, 0xFE, 0x40, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0x40, 0x1F, 0xC0, 0x07, 0xC0, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x3D,
-    0x00, 0x7C, 0x00, 0x0B, 0x40, 0x1F, 0x00, 0x02, 0xE0, 0x07, 0xC0, 0x00, 0xB8, 0x01, 0xF0, 0x00,
-    0x2E, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x0B, 0x4B, 0x80, 0x01, 0xF0, 0xB8, 0x00, 0x3D, 0x0B, 0x80, 0x0F, 0x80, 0xB8, 0x02, 0xF0,
-    0x0B, 0x80, 0x3C, 0x00, 0xB8, 0x0F, 0x80, 0x0B, 0xD6, 0xF0, 0x00, 0xBF, 0xFD, 0x00, 0x0B, 0xEB,
-    0xF0, 0x00, 0xB8, 0x0F, 0x40, 0x0B, 0x80, 0xBC, 0x00, 0xB8, 0x03, 0xE0, 0x0B, 0x80, 0x0F, 0x40,
-    0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x0F, 0x4B, 0x80, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0xFD, 0xB8, 0x00, 0x07, 0xF6,
-    0xE0, 0x00, 0x3F, 0xDB, 0x80, 0x02, 0xDB, 0x6E, 0x00, 0x1F, 0x2D, 0xB8, 0x00, 0xF0, 0xB6, 0xE0,
-    0x0B, 0x83, 0xDB, 0x80, 0x7C, 0x0F, 0x6E, 0x03, 0xD0, 0x3D, 0xB8, 0x2E, 0x00, 0xF6, 0xE0, 0xF0,
-    0x03, 0xDB, 0x8F, 0x40, 0x0F, 0x6E, 0x78, 0x00, 0x3D, 0xBB, 0xC0, 0x00, 0xF6, 0xFD, 0x00, 0x03,
-    0xDB, 0xF0, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x3D, 0x00, 0x60, 0x0A, 0x00, 0x00, 0xB8, 0x1F, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C,
-    0x3D, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x01, 0xF0, 0x0B, 0xC0, 0x03, 0xD0,
-    0x03, 0xD0, 0x07, 0xC0, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0xBC, 0x2E, 0x00,
-    0x00, 0x3D, 0x3C, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x78, 0x00, 0x01, 0xEB, 0x80, 0x00, 0x1F, 0xB8,
-    0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01,
-    0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80,
-    0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F,
-    0xBF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D,
-    0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB,
-    0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00,
-    0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x7F, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0xF4, 0x2E, 0x00, 0x7F, 0x4B, 0x80, 0x03,
-    0xF2, 0xE0, 0x00, 0x7C, 0xB8, 0x00, 0x0F, 0x2E, 0x00, 0x07, 0xCB, 0x80, 0x02, 0xF2, 0xE0, 0x02,
-    0xF4, 0xBF, 0xFF, 0xF4, 0x2F, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x90, 0x2F, 0xFF, 0xFF, 0x0B, 0x80,
-    0x0B, 0xF2, 0xE0, 0x00, 0x7C, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xCB, 0x80, 0x01, 0xF2, 0xF5,
-    0x56, 0xF0, 0xBF, 0xFF, 0xE0, 0x2F, 0xAA, 0xBF, 0x4B, 0x80, 0x01, 0xF6, 0xE0, 0x00, 0x2E, 0xB8,
-    0x00, 0x07, 0xEE, 0x00, 0x02, 0xFB, 0x80, 0x00, 0xFA, 0xE0, 0x00, 0xBD, 0xBF, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xCB, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3C,
-    0x00, 0x2E, 0x00, 0x03, 0xC0, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x07, 0xC0, 0x02, 0xE0,
-    0x00, 0x78, 0x00, 0x2E, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x00, 0x78, 0x00, 0x2E, 0x00, 0x0B, 0x80,
-    0x02, 0xE0, 0x00, 0xB4, 0x00, 0x2E, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0x2E, 0x00,
-    0x2E, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x02, 0xE0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0xFB, 0x40, 0x00, 0x00, 0x0F, 0x7F, 0xFF, 0xF6, 0xFF, 0xFF, 0xDB, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x55, 0x54, 0xBF, 0xFF,
-    0xF2, 0xFA, 0xAA, 0x8B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0x3C, 0x00, 0x0B, 0x40, 0x02, 0xE0,
-    0xBC, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x0B,
-    0xC0, 0x02, 0xF0, 0x0F, 0x40, 0x3C, 0x00, 0x03, 0xD0, 0x3D, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0xF4,
-    0x2F, 0x00, 0x00, 0x0B, 0xD7, 0xE5, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBE,
-    0xBF, 0xBF, 0x00, 0x00, 0x03, 0xD0, 0xF4, 0x3E, 0x00, 0x00, 0x3E, 0x03, 0xD0, 0x3D, 0x00, 0x01,
-    0xF0, 0x0F, 0x40, 0xBC, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xF4, 0x01, 0xF4,
-    0x07, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x3E, 0x00, 0x0F, 0x40, 0x03, 0xE2, 0xF0, 0x00, 0x3D, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xD0, 0x20, 0x01, 0xFC, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x05, 0xFC, 0x00,
-    0xFF, 0xF8, 0x00, 0x1A, 0xBF, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x2F, 0x4F, 0xFA, 0xFF, 0x82, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x0F, 0xDB, 0x80, 0x00, 0x7F, 0x6E, 0x00,
-    0x03, 0xFD, 0xB8, 0x00, 0x2D, 0xB6, 0xE0, 0x01, 0xF2, 0xDB, 0x80, 0x0F, 0x0B, 0x6E, 0x00, 0xB8,
-    0x3D, 0xB8, 0x07, 0xC0, 0xF6, 0xE0, 0x3D, 0x03, 0xDB, 0x82, 0xE0, 0x0F, 0x6E, 0x0F, 0x00, 0x3D,
-    0xB8, 0xF4, 0x00, 0xF6, 0xE7, 0x80, 0x03, 0xDB, 0xBC, 0x00, 0x0F, 0x6F, 0xD0, 0x00, 0x3D, 0xBF,
-    0x00, 0x00, 0xF6, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x90, 0x18, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xDB, 0x80, 0x00,
-    0x3F, 0x6E, 0x00, 0x01, 0xFD, 0xB8, 0x00, 0x0F, 0xF6, 0xE0, 0x00, 0xB6, 0xDB, 0x80, 0x07, 0xCB,
-    0x6E, 0x00, 0x3C, 0x2D, 0xB8, 0x02, 0xE0, 0xF6, 0xE0, 0x1F, 0x03, 0xDB, 0x80, 0xF4, 0x0F, 0x6E,
-    0x0B, 0x80, 0x3D, 0xB8, 0x3C, 0x00, 0xF6, 0xE3, 0xD0, 0x03, 0xDB, 0x9E, 0x00, 0x0F, 0x6E, 0xF0,
-    0x00, 0x3D, 0xBF, 0x40, 0x00, 0xF6, 0xFC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x0F, 0x40, 0x78, 0x00,
-    0x0B, 0x4B, 0x80, 0x01, 0xF0, 0xB8, 0x00, 0x3D, 0x0B, 0x80, 0x0F, 0x80, 0xB8, 0x02, 0xF0, 0x0B,
-    0x80, 0x3C, 0x00, 0xB8, 0x0F, 0x80, 0x0B, 0xD6, 0xF0, 0x00, 0xBF, 0xFD, 0x00, 0x0B, 0xEB, 0xF0,
-    0x00, 0xB8, 0x0F, 0x40, 0x0B, 0x80, 0xBC, 0x00, 0xB8, 0x03, 0xE0, 0x0B, 0x80, 0x0F, 0x40, 0xB8,
-    0x00, 0xBC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x0F, 0x4B, 0x80, 0x00, 0xBC, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0xF4, 0x00,
-    0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00,
-    0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x3C, 0x01, 0xE0, 0x00,
-    0x3C, 0x01, 0xE0, 0x00, 0x3C, 0x02, 0xD0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0xFF, 0xC0, 0x00,
-    0x3C, 0xFF, 0x00, 0x00, 0x3C, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF2, 0xFD, 0x00,
-    0x00, 0x2F, 0xDB, 0xF8, 0x00, 0x00, 0xFF, 0x6E, 0xF0, 0x00, 0x07, 0xBD, 0xB7, 0xD0, 0x00, 0x2D,
-    0xF6, 0xD7, 0xC0, 0x00, 0xF3, 0xDB, 0x4F, 0x00, 0x07, 0x8F, 0x6E, 0x2E, 0x00, 0x3C, 0x3D, 0xB8,
-    0x7C, 0x01, 0xF0, 0xF6, 0xE0, 0xF4, 0x0B, 0x43, 0xDB, 0x82, 0xE0, 0x3C, 0x0F, 0x6E, 0x03, 0xC1,
-    0xE0, 0x3D, 0xB8, 0x0F, 0x4F, 0x40, 0xF6, 0xE0, 0x1F, 0x3C, 0x03, 0xDB, 0x80, 0x3E, 0xD0, 0x0F,
-    0x6E, 0x00, 0xBF, 0x00, 0x3D, 0xB8, 0x01, 0xF8, 0x00, 0xF6, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x78,
-    0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00,
-    0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2F, 0x55, 0x55, 0x7C, 0xBF, 0xFF, 0xFF,
-    0xF2, 0xFA, 0xAA, 0xAB, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2,
-    0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x1F, 0x80, 0x0B, 0xE0, 0x0F, 0x80, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0x01,
-    0xF1, 0xF0, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x03, 0xE7, 0xC0, 0x00,
-    0x00, 0xF9, 0xF0, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x07, 0xC2, 0xF0,
-    0x00, 0x02, 0xF0, 0x7D, 0x00, 0x01, 0xF4, 0x0B, 0xE0, 0x01, 0xF8, 0x00, 0xBF, 0xEF, 0xF8, 0x00,
-    0x06, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xB8,
-    0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01,
-    0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80,
-    0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F,
-    0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0x7F, 0xFE, 0x40, 0xBF, 0xFF, 0xF4, 0xB8, 0x01, 0xFC,
-    0xB8, 0x00, 0x3E, 0xB8, 0x00, 0x2F, 0xB8, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x3D, 0xB8,
-    0x01, 0xFC, 0xBF, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF9, 0x01, 0xFF, 0xFF, 0xE0, 0x7F, 0x40, 0x08, 0x0F, 0x80, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x50, 0x2F, 0xFE, 0xFE, 0x00, 0x6F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0xF4, 0x0F, 0x40,
-    0x01, 0xF0, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0xF4,
-    0x0F, 0x00, 0x00, 0xBC, 0x2E, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1A, 0xFF, 0xE4,
-    0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x43, 0xD1, 0xBE, 0x03, 0xE0, 0x0F, 0x40, 0x7D, 0x1F,
-    0x00, 0x3D, 0x00, 0xBC, 0xB8, 0x00, 0xF4, 0x01, 0xF2, 0xE0, 0x03, 0xD0, 0x03, 0xCB, 0x80, 0x0F,
-    0x40, 0x0F, 0x2F, 0x00, 0x3D, 0x00, 0x7C, 0x7C, 0x00, 0xF4, 0x02, 0xE0, 0xFC, 0x03, 0xD0, 0x1F,
-    0x40, 0xFD, 0x0F, 0x46, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6B, 0xFF, 0x90, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3C, 0x00, 0x01,
-    0xE0, 0xBC, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0xB8, 0x01, 0xF0, 0x07, 0xC0, 0x02, 0xE0, 0x3D, 0x00,
-    0x03, 0xD2, 0xE0, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x0F, 0x40,
-    0xB8, 0x00, 0xB8, 0x00, 0xF4, 0x07, 0xC0, 0x01, 0xF0, 0x3D, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x07,
-    0xD0, 0x78, 0x00, 0x01, 0xE0, 0x2E, 0x00, 0x00, 0x7C, 0x0B, 0x80, 0x00, 0x1F, 0x02, 0xE0, 0x00,
-    0x07, 0xC0, 0xB8, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x7C, 0x0B, 0x80, 0x00, 0x1F, 0x02, 0xE0,
-    0x00, 0x07, 0xC0, 0xB8, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x7C, 0x0B, 0x80, 0x00, 0x1F, 0x02,
-    0xE0, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x7C, 0x0B, 0x80, 0x00, 0x1F,
-    0x02, 0xE0, 0x00, 0x07, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x3C,
-    0x00, 0x02, 0xD3, 0xC0, 0x00, 0x3D, 0x3C, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x3D, 0x3C, 0x00, 0x03,
-    0xD3, 0xC0, 0x00, 0x3D, 0x3C, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3D, 0x2F, 0x00, 0x07, 0xD0, 0xFF,
-    0xAF, 0xFD, 0x02, 0xFF, 0xFB, 0xD0, 0x00, 0x40, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x78, 0x00,
-    0x0F, 0x00, 0x02, 0xDB, 0x80, 0x00, 0xF0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x00, 0x03, 0xDB, 0x80,
-    0x00, 0xF0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x00, 0x03, 0xDB, 0x80, 0x00, 0xF0, 0x00, 0x3D, 0xB8,
-    0x00, 0x0F, 0x00, 0x03, 0xDB, 0x80, 0x00, 0xF0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x00, 0x03, 0xDB,
-    0x80, 0x00, 0xF0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x00, 0x03, 0xDB, 0x80, 0x00, 0xF0, 0x00, 0x3D,
-    0xB8, 0x00, 0x0F, 0x00, 0x03, 0xDB, 0x80, 0x00, 0xF0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x00, 0x03,
-    0xDB, 0x80, 0x00, 0xF0, 0x00, 0x3D, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x78, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F,
-    0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8,
-    0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07,
-    0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F,
-    0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8,
-    0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x1F, 0x00, 0x07,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xB8, 0x01, 0xFC, 0x00, 0xB8, 0x00,
-    0x3E, 0x00, 0xB8, 0x00, 0x2F, 0x00, 0xB8, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x2F, 0x00, 0xB8, 0x00,
-    0x3E, 0x00, 0xB8, 0x01, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x78, 0x00, 0x00,
-    0x07, 0xAE, 0x00, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x1F, 0xB8, 0x00,
-    0x00, 0x07, 0xEE, 0x00, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x00, 0x7E, 0xFF, 0xF9, 0x00, 0x1F, 0xBF,
-    0xFF, 0xF4, 0x07, 0xEE, 0x00, 0x7F, 0x01, 0xFB, 0x80, 0x03, 0xE0, 0x7E, 0xE0, 0x00, 0xBC, 0x1F,
-    0xB8, 0x00, 0x1F, 0x07, 0xEE, 0x00, 0x0B, 0xC1, 0xFB, 0x80, 0x03, 0xE0, 0x7E, 0xE0, 0x07, 0xF0,
-    0x1F, 0xBF, 0xFF, 0xF4, 0x07, 0xEF, 0xFF, 0xD0, 0x01, 0xF0, 0x78, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF,
-    0xFE, 0x40, 0xBF, 0xFF, 0xF4, 0xB8, 0x01, 0xFC, 0xB8, 0x00, 0x3E, 0xB8, 0x00, 0x2F, 0xB8, 0x00,
-    0x1F, 0xB8, 0x00, 0x2F, 0xB8, 0x00, 0x3E, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x02, 0x00, 0x1B, 0xE0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0,
-    0x7F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x40, 0x00, 0xBE, 0x0B, 0xFB, 0xFF, 0x80, 0x7F,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0xBF, 0xF9,
-    0x00, 0xB8, 0x00, 0x7F, 0xFF, 0xF8, 0x0B, 0x80, 0x1F, 0x80, 0x0B, 0xE0, 0xB8, 0x03, 0xE0, 0x00,
-    0x1F, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0xF8, 0xB8, 0x0B, 0x80, 0x00, 0x07, 0xCB, 0x80, 0xF4, 0x00,
-    0x00, 0x3D, 0xBD, 0x5F, 0x00, 0x00, 0x03, 0xDB, 0xFF, 0xF0, 0x00, 0x00, 0x3D, 0xBE, 0xAF, 0x00,
-    0x00, 0x03, 0xDB, 0x80, 0xF0, 0x00, 0x00, 0x3D, 0xB8, 0x0F, 0x40, 0x00, 0x03, 0xDB, 0x80, 0xF8,
-    0x00, 0x00, 0x7C, 0xB8, 0x07, 0xC0, 0x00, 0x0F, 0x8B, 0x80, 0x3E, 0x00, 0x01, 0xF4, 0xB8, 0x01,
-    0xF8, 0x00, 0x7E, 0x0B, 0x80, 0x07, 0xFE, 0xFF, 0x80, 0xB8, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x07, 0xE4, 0x02, 0xE0, 0xF8,
-    0x00, 0x2E, 0x0F, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x2E, 0x0F, 0x40, 0x02, 0xE0, 0xFC, 0x00, 0x2E,
-    0x03, 0xF5, 0x03, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0x2F, 0xAB, 0xE0, 0x03, 0xD0, 0x2E, 0x00, 0xBC,
-    0x02, 0xE0, 0x1F, 0x00, 0x2E, 0x03, 0xE0, 0x02, 0xE0, 0xBC, 0x00, 0x2E, 0x1F, 0x40, 0x02, 0xE3,
-    0xE0, 0x00, 0x2E, 0x01, 0xA9, 0x00, 0xBF, 0xFF, 0x81, 0xE4, 0x2F, 0x40, 0x00, 0x2E, 0x00, 0x00,
-    0x7C, 0x00, 0x01, 0xF0, 0x6F, 0xFF, 0xCB, 0xFA, 0xAF, 0x7D, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x40,
-    0x0B, 0xEF, 0x00, 0x7F, 0x7F, 0xAF, 0x7C, 0x7F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xBF, 0x80, 0x0F, 0xFF, 0xE0, 0x1F, 0xE4, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0x80, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0xF2, 0xFF, 0x80, 0x7B, 0xFB, 0xFC, 0x2F, 0xC0, 0x0F, 0xCB, 0xD0, 0x00,
-    0xF6, 0xF0, 0x00, 0x3E, 0xB8, 0x00, 0x0B, 0xAE, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0xB8, 0xF0, 0x00,
-    0x3D, 0x3D, 0x00, 0x1F, 0x07, 0xC0, 0x0F, 0x80, 0xBE, 0xAF, 0xC0, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x54, 0x03, 0xFF, 0xFF, 0x4F, 0x95, 0xBF, 0x3D, 0x00, 0x3E, 0xF4, 0x00, 0xF7,
-    0xD0, 0x07, 0xCF, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0xF4, 0x01, 0xFB, 0xD0, 0x01, 0xFF, 0x40, 0x07,
-    0xFD, 0x00, 0x3E, 0xFF, 0xFF, 0xF3, 0xFF, 0xFE, 0x00, 0x55, 0x55, 0x3F, 0xFF, 0xDF, 0x95, 0x53,
-    0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F,
-    0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF,
-    0x00, 0x0F, 0x55, 0xBC, 0x00, 0x78, 0x01, 0xF0, 0x01, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x1F, 0x00,
-    0x1E, 0x00, 0x7C, 0x00, 0xB4, 0x01, 0xF0, 0x02, 0xD0, 0x07, 0xC0, 0x0F, 0x00, 0x1F, 0x00, 0x7C,
-    0x00, 0x7C, 0x03, 0xD0, 0x01, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3D, 0x80, 0x00, 0x00, 0x90, 0x00, 0x6A, 0x00,
-    0x07, 0xFF, 0xE0, 0x1F, 0x81, 0xF8, 0x3D, 0x00, 0x7C, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x2E, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xB8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x00,
-    0x04, 0x0F, 0xFA, 0xFC, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x50, 0xF4,
-    0x02, 0xE0, 0x07, 0xC0, 0xF0, 0x0B, 0x80, 0x3C, 0x02, 0xF0, 0x2E, 0x03, 0xD0, 0x03, 0xD0, 0xB8,
-    0x1F, 0x00, 0x03, 0xC2, 0xE0, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0xF4, 0xB8, 0x7C, 0x00, 0x0F, 0x82, 0xE0, 0xBC, 0x00, 0x7C, 0x0B, 0x80, 0xF4, 0x03, 0xD0,
-    0x2E, 0x01, 0xF0, 0x3E, 0x00, 0xB8, 0x02, 0xF1, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x05, 0xA9, 0x00,
-    0x3F, 0xFF, 0xD0, 0x29, 0x06, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xFC, 0x3E, 0xAB, 0xF4, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0xF4, 0x00, 0xFD,
-    0xF4, 0x01, 0xFD, 0xF4, 0x03, 0xFD, 0xF4, 0x0B, 0x7D, 0xF4, 0x0F, 0x3D, 0xF4, 0x3C, 0x3D, 0xF4,
-    0x78, 0x3D, 0xF4, 0xF0, 0x3D, 0xF6, 0xD0, 0x3D, 0xF7, 0xC0, 0x3D, 0xFF, 0x40, 0x3D, 0xFE, 0x00,
-    0x3D, 0xFC, 0x00, 0x3D, 0x09, 0x00, 0x90, 0x0F, 0x02, 0xD0, 0x07, 0xEF, 0xC0, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0xF4, 0x00, 0xFD, 0xF4, 0x01, 0xFD, 0xF4, 0x03, 0xFD, 0xF4,
-    0x0B, 0x7D, 0xF4, 0x0F, 0x3D, 0xF4, 0x3C, 0x3D, 0xF4, 0x78, 0x3D, 0xF4, 0xF0, 0x3D, 0xF6, 0xD0,
-    0x3D, 0xF7, 0xC0, 0x3D, 0xFF, 0x40, 0x3D, 0xFE, 0x00, 0x3D, 0xFC, 0x00, 0x3D, 0x50, 0x00, 0x54,
-    0xF4, 0x00, 0xF0, 0xF4, 0x03, 0xD0, 0xF4, 0x0B, 0x80, 0xF4, 0x1F, 0x00, 0xF4, 0x3D, 0x00, 0xFF,
-    0xF8, 0x00, 0xFF, 0xF8, 0x00, 0xF4, 0x7D, 0x00, 0xF4, 0x1F, 0x00, 0xF4, 0x0F, 0x80, 0xF4, 0x03,
-    0xD0, 0xF4, 0x01, 0xF0, 0xF4, 0x00, 0xF8, 0x00, 0x55, 0x55, 0x00, 0xBF, 0xFF, 0xE0, 0x2E, 0x55,
-    0xF8, 0x0B, 0x40, 0x2E, 0x02, 0xD0, 0x0B, 0x80, 0xF0, 0x02, 0xE0, 0x3C, 0x00, 0xB8, 0x0F, 0x00,
-    0x2E, 0x03, 0xC0, 0x0B, 0x80, 0xF0, 0x02, 0xE0, 0x7C, 0x00, 0xB8, 0x2E, 0x00, 0x2E, 0xFF, 0x00,
-    0x0B, 0xBF, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x54, 0xFE, 0x00, 0x01, 0xFC,
-    0xFF, 0x00, 0x02, 0xFC, 0xFF, 0x40, 0x03, 0xFC, 0xF7, 0x80, 0x0B, 0xBC, 0xF3, 0xC0, 0x0F, 0x3C,
-    0xF1, 0xE0, 0x1E, 0x3C, 0xF0, 0xF0, 0x3C, 0x3C, 0xF0, 0xB4, 0x3C, 0x3C, 0xF0, 0x3C, 0xB4, 0x3C,
-    0xF0, 0x3D, 0xF0, 0x3C, 0xF0, 0x1F, 0xE0, 0x3C, 0xF0, 0x0F, 0xC0, 0x3C, 0xF0, 0x0B, 0x80, 0x3C,
-    0x50, 0x00, 0x14, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4,
-    0x00, 0x3C, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00,
-    0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0x00, 0x6A, 0x40, 0x01, 0xFF, 0xFC,
-    0x01, 0xF9, 0x1B, 0xC0, 0xF8, 0x00, 0xBC, 0x7C, 0x00, 0x0F, 0x2E, 0x00, 0x03, 0xDF, 0x80, 0x00,
-    0xBB, 0xE0, 0x00, 0x2E, 0xB8, 0x00, 0x0F, 0xAF, 0x00, 0x03, 0xD3, 0xC0, 0x01, 0xF0, 0xBC, 0x00,
-    0xF8, 0x0F, 0xEA, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0xFF, 0xFF,
-    0xFC, 0xF9, 0x55, 0xBC, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C,
-    0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4,
-    0x00, 0x3C, 0xF4, 0x00, 0x3C, 0x50, 0x6A, 0x40, 0xF3, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00,
-    0x7D, 0xF8, 0x00, 0x2E, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F,
-    0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3E, 0xFE, 0x00, 0xBC, 0xFB, 0xEB, 0xF4, 0xF5, 0xFF, 0xD0, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x1F, 0xFF, 0xC1, 0xF9, 0x16, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xE0,
-    0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xEA, 0xF0, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0xBF, 0xFF,
-    0xFD, 0x55, 0xBD, 0x54, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x50, 0x00, 0x05, 0x6E, 0x00, 0x03, 0xD3, 0xC0, 0x01, 0xF0, 0xF4,
-    0x00, 0xB8, 0x1F, 0x00, 0x3C, 0x03, 0xC0, 0x1F, 0x00, 0xB8, 0x0F, 0x40, 0x0F, 0x03, 0xC0, 0x03,
-    0xD1, 0xE0, 0x00, 0x78, 0xF4, 0x00, 0x0F, 0x3C, 0x00, 0x02, 0xEE, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBC, 0x00, 0x0B,
-    0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x06, 0xF9, 0x40, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0x3F, 0x9F, 0x5F, 0xD0, 0x3F, 0x03, 0xD0, 0xBC, 0x1F, 0x00, 0xF4, 0x0B,
-    0x8B, 0xC0, 0x3D, 0x01, 0xF2, 0xE0, 0x0F, 0x40, 0x3C, 0xF8, 0x03, 0xD0, 0x0F, 0x2E, 0x00, 0xF4,
-    0x03, 0xCB, 0xC0, 0x3D, 0x01, 0xF0, 0xF4, 0x0F, 0x40, 0xF8, 0x2F, 0x43, 0xD0, 0xBC, 0x02, 0xFE,
-    0xFA, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x14, 0x00, 0x05, 0x0F, 0x80, 0x0F, 0x80, 0xF4, 0x07, 0xC0, 0x1F, 0x03, 0xD0, 0x03, 0xE3,
-    0xE0, 0x00, 0x3E, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBC,
-    0xF4, 0x00, 0x7C, 0x1F, 0x00, 0x3D, 0x02, 0xF0, 0x2E, 0x00, 0x3D, 0x1F, 0x00, 0x07, 0xC0, 0x50,
-    0x00, 0x14, 0x0F, 0x40, 0x03, 0xC0, 0xF4, 0x00, 0x3C, 0x0F, 0x40, 0x03, 0xC0, 0xF4, 0x00, 0x3C,
-    0x0F, 0x40, 0x03, 0xC0, 0xF4, 0x00, 0x3C, 0x0F, 0x40, 0x03, 0xC0, 0xF4, 0x00, 0x3C, 0x0F, 0x40,
-    0x03, 0xC0, 0xF4, 0x00, 0x3C, 0x0F, 0x40, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x28, 0x14, 0x00,
-    0x04, 0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x2E, 0x7C, 0x00, 0x2E,
-    0x7C, 0x00, 0x2E, 0x3F, 0x96, 0xFE, 0x0F, 0xFF, 0xFE, 0x00, 0x54, 0x2E, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x50, 0x00, 0x50, 0x00, 0x53, 0xD0, 0x03, 0xD0,
-    0x03, 0xDF, 0x40, 0x0F, 0x40, 0x0F, 0x7D, 0x00, 0x3D, 0x00, 0x3D, 0xF4, 0x00, 0xF4, 0x00, 0xF7,
-    0xD0, 0x03, 0xD0, 0x03, 0xDF, 0x40, 0x0F, 0x40, 0x0F, 0x7D, 0x00, 0x3D, 0x00, 0x3D, 0xF4, 0x00,
-    0xF4, 0x00, 0xF7, 0xD0, 0x03, 0xD0, 0x03, 0xDF, 0x40, 0x0F, 0x40, 0x0F, 0x7D, 0x00, 0x3D, 0x00,
-    0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x50, 0x00, 0x50, 0x00, 0x50,
-    0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xC0,
-    0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x03,
-    0xD0, 0x03, 0xC0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x0F,
-    0x40, 0x0F, 0x00, 0x0F, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x55, 0x50, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x05, 0x5F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE5, 0x50,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x3E, 0x56, 0xFC, 0x00, 0xF4, 0x00, 0xF4, 0x03, 0xD0, 0x03, 0xD0,
-    0x0F, 0x40, 0x0F, 0x40, 0x3D, 0x00, 0xBC, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xF8, 0x00, 0x50,
-    0x00, 0x00, 0x17, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x7F, 0xEA, 0x90, 0x01, 0xFF, 0xFF, 0xFC, 0x07, 0xFE, 0x55, 0xFC, 0x1F, 0xF4, 0x00, 0xF4,
-    0x7F, 0xD0, 0x03, 0xD1, 0xFF, 0x40, 0x0F, 0x47, 0xFD, 0x00, 0xBC, 0x1F, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xF8, 0x01, 0xF0, 0x50, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xE5, 0x50, 0x0F, 0xFF, 0xFC, 0x3E, 0x56, 0xFC, 0xF4, 0x00, 0xF7, 0xD0, 0x03, 0xDF,
-    0x40, 0x0F, 0x7D, 0x00, 0xBC, 0xFF, 0xFF, 0xD3, 0xFF, 0xF8, 0x00, 0x1A, 0x90, 0x03, 0xFF, 0xF8,
-    0x06, 0x46, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC2, 0xFF, 0xFF, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0xFA, 0xBF, 0x42, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x2A, 0x40, 0x3D, 0x00, 0xBF, 0xFD, 0x0F, 0x40, 0xFD,
-    0x0B, 0xD3, 0xD0, 0x7C, 0x00, 0x7C, 0xF4, 0x3E, 0x00, 0x0F, 0x7D, 0x0F, 0x40, 0x02, 0xEF, 0xFF,
-    0xC0, 0x00, 0xBB, 0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x3C, 0x00, 0x0B, 0xBD, 0x0F, 0x40, 0x03, 0xEF,
-    0x42, 0xE0, 0x00, 0xF7, 0xD0, 0x3D, 0x00, 0xBC, 0xF4, 0x07, 0xFA, 0xFC, 0x3D, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0xFF, 0xFF, 0xD0, 0xFE, 0x55, 0xF4, 0x7C,
-    0x00, 0x3D, 0x1F, 0x00, 0x0F, 0x47, 0xC0, 0x03, 0xD0, 0xF8, 0x00, 0xF4, 0x1F, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0x40, 0x3D, 0x03, 0xD0, 0x2F, 0x00, 0xF4, 0x1F, 0x00, 0x3D, 0x0F, 0x40, 0x0F, 0x4F,
-    0x80, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0x81, 0xF8, 0x3D, 0x00,
-    0x7C, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x2E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xB8, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x00, 0x04, 0x0F, 0xFA, 0xFC, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC2, 0xE0, 0x03, 0xC2, 0xE0, 0x01, 0x40, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0x81, 0xF8, 0x3D, 0x00, 0x7C, 0x7C, 0x00, 0x3D,
-    0xB8, 0x00, 0x2E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xB8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x3F, 0x00, 0x04, 0x0F, 0xFA, 0xFC, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x5F, 0xFD, 0x00, 0xFB, 0xFB, 0xF8, 0x0F, 0xE0, 0x0B, 0xC0, 0xFC, 0x00,
-    0x3D, 0x0F, 0x80, 0x03, 0xD0, 0xF4, 0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF4, 0x00, 0x3D, 0x0F,
-    0x40, 0x03, 0xD0, 0xF4, 0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF4, 0x00, 0x3D, 0x0F, 0x40, 0x03,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x3F, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xC0, 0x02,
-    0x80, 0x00, 0x00, 0x05, 0x55, 0x53, 0xFF, 0xFD, 0xF9, 0x55, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0,
-    0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40,
-    0x03, 0xD0, 0x00, 0x00, 0x6A, 0x40, 0x1F, 0xFF, 0xC1, 0xF9, 0x06, 0x0F, 0x80, 0x00, 0x7C, 0x00,
-    0x02, 0xE0, 0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xEA, 0xF0, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xA9, 0x03,
-    0xFF, 0xFC, 0xBD, 0x06, 0xCF, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x2F,
-    0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xE4, 0x00, 0x3D, 0xFE, 0xAF, 0xCB, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x04, 0x3D, 0x3D, 0x04, 0x00, 0x14, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x10, 0x47, 0xDF, 0x7D, 0xF1, 0x04, 0x00, 0x00, 0x50, 0x0F,
-    0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40,
-    0xF4, 0x0F, 0x40, 0x00, 0x10, 0x03, 0xD0, 0x0F, 0x40, 0x04, 0x00, 0x00, 0x01, 0x40, 0x0F, 0x40,
-    0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00,
-    0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x1F, 0x1F, 0xF8, 0x7F, 0x80, 0x00,
-    0x55, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x2E, 0x55, 0xF4, 0x00, 0x00, 0x0B,
-    0x40, 0x3D, 0x00, 0x00, 0x02, 0xD0, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x03, 0xEA, 0x50, 0x00, 0x3C,
-    0x00, 0xFF, 0xFF, 0x80, 0x0F, 0x00, 0x3D, 0x56, 0xFC, 0x03, 0xC0, 0x0F, 0x40, 0x0F, 0x00, 0xF0,
-    0x03, 0xD0, 0x03, 0xD0, 0x7C, 0x00, 0xF4, 0x00, 0xF4, 0x2E, 0x00, 0x3D, 0x00, 0xBC, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFD, 0x3F, 0x40, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x14, 0x00, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00, 0x3C,
-    0x00, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xFE, 0xAA, 0xFE, 0xAB, 0xF4, 0xF4, 0x00, 0x3C, 0x00, 0xBC, 0xF4, 0x00, 0x3C, 0x00, 0x3C,
-    0xF4, 0x00, 0x3C, 0x00, 0x7C, 0xF4, 0x00, 0x3C, 0x00, 0xFC, 0xF4, 0x00, 0x3F, 0xFF, 0xF0, 0xF4,
-    0x00, 0x3F, 0xFF, 0x80, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFD, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x4B, 0xFE, 0x00, 0xFB, 0xFB, 0xF8,
-    0x0F, 0xE0, 0x07, 0xC0, 0xFC, 0x00, 0x3D, 0x0F, 0x80, 0x02, 0xD0, 0xF4, 0x00, 0x2E, 0x0F, 0x40,
-    0x02, 0xE0, 0xF4, 0x00, 0x2E, 0x0F, 0x40, 0x02, 0xE0, 0xF4, 0x00, 0x2E, 0x0F, 0x40, 0x02, 0xE0,
-    0xF4, 0x00, 0x2E, 0x0F, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x54, 0xF4, 0x00, 0xF0, 0xF4,
-    0x03, 0xD0, 0xF4, 0x0B, 0x80, 0xF4, 0x1F, 0x00, 0xF4, 0x3D, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8,
-    0x00, 0xF4, 0x7D, 0x00, 0xF4, 0x1F, 0x00, 0xF4, 0x0F, 0x80, 0xF4, 0x03, 0xD0, 0xF4, 0x01, 0xF0,
-    0xF4, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0xF4, 0x00, 0xFD, 0xF4, 0x01, 0xFD, 0xF4, 0x03,
-    0xFD, 0xF4, 0x0B, 0x7D, 0xF4, 0x0F, 0x3D, 0xF4, 0x3C, 0x3D, 0xF4, 0x78, 0x3D, 0xF4, 0xF0, 0x3D,
-    0xF6, 0xD0, 0x3D, 0xF7, 0xC0, 0x3D, 0xFF, 0x40, 0x3D, 0xFE, 0x00, 0x3D, 0xFC, 0x00, 0x3D, 0x02,
-    0x40, 0x60, 0x00, 0xF0, 0x3C, 0x00, 0x2F, 0xBE, 0x00, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x01, 0x5B, 0x80, 0x00, 0xF4, 0xF0, 0x00, 0x7C, 0x3D, 0x00, 0x2E, 0x07, 0xC0, 0x0F, 0x00,
-    0xF0, 0x07, 0xC0, 0x2E, 0x03, 0xD0, 0x03, 0xC0, 0xF0, 0x00, 0xF4, 0x78, 0x00, 0x1E, 0x3D, 0x00,
-    0x03, 0xCF, 0x00, 0x00, 0xBB, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x50, 0x00, 0x14, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C,
-    0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4,
-    0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x00, 0x78, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x24, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x00, 0xF5, 0xF0, 0x00, 0x3D,
-    0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x0F, 0x40, 0x02, 0xE0, 0x00, 0x3C, 0x3D, 0x00,
-    0x0B, 0xC0, 0x01, 0xF0, 0xB8, 0x00, 0x2F, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0xFD, 0x00, 0x2F, 0x07,
-    0xC0, 0x03, 0xF8, 0x00, 0xB8, 0x0F, 0x40, 0x2F, 0xF0, 0x03, 0xD0, 0x2E, 0x00, 0xF7, 0xC0, 0x0F,
-    0x00, 0x7C, 0x07, 0xCF, 0x40, 0x7C, 0x00, 0xF4, 0x2D, 0x2F, 0x02, 0xE0, 0x02, 0xE0, 0xF0, 0x3C,
-    0x0F, 0x00, 0x07, 0xC7, 0x80, 0xF8, 0x7C, 0x00, 0x0F, 0x6D, 0x01, 0xF3, 0xD0, 0x00, 0x1F, 0xF0,
-    0x03, 0xEF, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x14, 0x78, 0x00, 0xB8, 0x00, 0x3C, 0x7C,
-    0x00, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x00, 0xB8, 0x3D, 0x00,
-    0x3C, 0x00, 0xF4, 0x2E, 0x00, 0x7D, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x01, 0xF0, 0x0F, 0x41, 0xEF,
-    0x02, 0xD0, 0x07, 0x83, 0xCB, 0x43, 0xC0, 0x03, 0xC7, 0x87, 0xCB, 0x80, 0x02, 0xEF, 0x03, 0xDF,
-    0x00, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x15, 0xF9, 0x54, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x6A, 0xFA, 0xA8, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF9, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00,
-    0xFE, 0xAF, 0xF4, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x3E, 0x00,
-    0xF4, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0xF4, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x15, 0xF9,
-    0x50, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0x5F, 0x95, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xF4, 0x00, 0x7D,
-    0x03, 0xD0, 0x00, 0xB8, 0x0F, 0x40, 0x02, 0xD0, 0x3D, 0x00, 0x1F, 0x00, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x6F, 0xFE, 0x4B, 0x80, 0x00,
-    0xFF, 0xFF, 0xF2, 0xE0, 0x00, 0xFD, 0x00, 0x28, 0xB8, 0x00, 0xFC, 0x00, 0x00, 0x2E, 0x00, 0x7C,
-    0x00, 0x00, 0x0B, 0x80, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0xBD, 0x57, 0xD5,
-    0x55, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xEA, 0xBE, 0xAA, 0xA9, 0x02, 0xE0, 0x0F, 0x00,
-    0x00, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x00, 0x2E, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0x80, 0x1F, 0x00,
-    0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x7F, 0x40, 0x00, 0x2E, 0x00, 0x07, 0xFF,
-    0xBF, 0x8B, 0x80, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0xA4,
-    0xF4, 0x00, 0xBF, 0xFE, 0xF4, 0x03, 0xF5, 0x58, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00,
-    0xF4, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xF4, 0x0F, 0x00, 0x00,
-    0xF4, 0x0F, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0xF4, 0x02, 0xFE, 0xBE,
-    0xF4, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x00, 0x1F, 0x3D, 0x00, 0x00, 0x03,
-    0xD1, 0xF0, 0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xD2, 0xE1, 0xF0, 0x00, 0x7C, 0x2E, 0x0F, 0x40, 0x0B, 0x82,
-    0xE0, 0xBC, 0x00, 0xF0, 0x2E, 0x03, 0xC0, 0x2F, 0x02, 0xE0, 0x2E, 0x03, 0xD0, 0x2E, 0x01, 0xF0,
-    0x7C, 0x02, 0xE0, 0x0F, 0x4F, 0x80, 0x2E, 0x00, 0xBC, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xED, 0x00, 0x00, 0x1E, 0x78, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x07, 0xC2, 0xE0, 0x00,
-    0x2F, 0xAF, 0xC0, 0x00, 0xFF, 0xFF, 0x40, 0x0B, 0x8F, 0x1F, 0x00, 0x3C, 0x3C, 0x3D, 0x01, 0xF0,
-    0xF0, 0xB8, 0x0F, 0x43, 0xC0, 0xF0, 0x7C, 0x0F, 0x02, 0xE2, 0xE0, 0x3C, 0x07, 0xC0, 0x78, 0x00,
-    0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3F, 0x40, 0x00, 0xB8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0x80,
-    0x00, 0xF7, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0xF0, 0x00, 0xB8,
-    0x00, 0x3C, 0x0F, 0x40, 0x0B, 0xD5, 0x5B, 0xD5, 0xBC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xEA, 0xBF, 0xBF, 0xBE, 0x00, 0xB8, 0x02, 0xE1, 0xE1, 0xF0, 0x0B, 0x80, 0x3C, 0x1E, 0x0F, 0x80,
-    0xB8, 0x0B, 0xC1, 0xE0, 0x7C, 0x0B, 0x80, 0xF4, 0x1E, 0x03, 0xD0, 0xB8, 0x1F, 0x01, 0xE0, 0x2F,
-    0x0B, 0x83, 0xE0, 0x1E, 0x00, 0xF0, 0xB8, 0x3C, 0x01, 0xE0, 0x0F, 0x8B, 0x8B, 0xC0, 0x1E, 0x00,
-    0x7C, 0x50, 0x00, 0x15, 0x00, 0x0F, 0x40, 0x07, 0xF0, 0x00, 0xF4, 0x00, 0xFB, 0x40, 0x0F, 0x40,
-    0x1F, 0x3C, 0x00, 0xF4, 0x02, 0xD3, 0xD0, 0x0F, 0x40, 0x3C, 0x1E, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0xF4, 0x1F, 0x2D, 0x3C, 0x0F, 0x43, 0xD2, 0xD3, 0xD0, 0xF4, 0x3C,
-    0x2D, 0x1F, 0x0F, 0x4B, 0x82, 0xD0, 0xF4, 0xF4, 0xF0, 0x2D, 0x0B, 0x8F, 0x6E, 0x02, 0xD0, 0x3C,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x2E, 0x00,
-    0x0B, 0xC0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xAF, 0xAF, 0xC0, 0x07, 0xC0, 0xF0,
-    0x3E, 0x00, 0xF8, 0x0F, 0x01, 0xF0, 0x0F, 0x40, 0xF0, 0x0F, 0x41, 0xF0, 0x0F, 0x00, 0xB8, 0x2E,
-    0x00, 0xF0, 0x07, 0xC3, 0xD0, 0x0F, 0x00, 0x3C, 0x7C, 0x00, 0xF0, 0x03, 0xDB, 0xC0, 0x0F, 0x00,
-    0x2F, 0x05, 0x55, 0x55, 0x50, 0x0F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD5, 0x57, 0xE0, 0x02, 0xE0, 0x0B,
-    0x80, 0x00, 0xF4, 0x2E, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xEF,
-    0xC0, 0x0B, 0x83, 0xC3, 0xE0, 0x0F, 0x03, 0xC0, 0xF0, 0x2E, 0x03, 0xC0, 0xF4, 0x3D, 0x03, 0xC0,
-    0x7C, 0x7C, 0x03, 0xC0, 0x3C, 0xB8, 0x03, 0xC0, 0x2E, 0x78, 0x07, 0xFF, 0xFF, 0xFF, 0x82, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x0B, 0x80, 0x3E, 0x00, 0x01, 0xF4, 0x2E, 0x00, 0x3D, 0x00, 0x0F, 0x40,
-    0xB8, 0x00, 0x7C, 0x00, 0xF8, 0x02, 0xE0, 0x00, 0x7C, 0x0B, 0x80, 0x0B, 0x80, 0x00, 0xB8, 0x7C,
-    0x00, 0x2F, 0x55, 0x55, 0xFB, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFA, 0xAB, 0xFB,
-    0xFA, 0xF4, 0x0B, 0x80, 0x2E, 0x0B, 0xC1, 0xF0, 0x2E, 0x00, 0xF0, 0x2F, 0x03, 0xD0, 0xB8, 0x07,
-    0xC0, 0xBC, 0x07, 0xC2, 0xE0, 0x3D, 0x02, 0xF0, 0x0F, 0x0B, 0x80, 0xF0, 0x0B, 0xC0, 0x3D, 0x2E,
-    0x07, 0xC0, 0x2F, 0x00, 0xB8, 0xB8, 0x2E, 0x00, 0xBC, 0x00, 0xF2, 0xE0, 0xF4, 0x02, 0xF0, 0x03,
-    0xD0, 0x50, 0x15, 0x55, 0x55, 0x40, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xF4, 0x1F, 0x55, 0x5B, 0xC0,
-    0xF4, 0x07, 0xC0, 0x1F, 0x00, 0xF4, 0x02, 0xE0, 0x7C, 0x00, 0xF4, 0x00, 0xB9, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xF4, 0x1F, 0x0F, 0x4B, 0xC0, 0xF4, 0x3D,
-    0x0F, 0x43, 0xD0, 0xF4, 0x3C, 0x0F, 0x41, 0xE0, 0xF4, 0xB8, 0x0F, 0x40, 0xF0, 0xF4, 0xF0, 0x0F,
-    0x40, 0xB8, 0xF5, 0xF0, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x04, 0x00, 0x3D, 0x07, 0xF0, 0x00, 0xF5,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xE0, 0x1E, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1B,
-    0xD0, 0x03, 0xFF, 0xD0, 0x00, 0x2A, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF8, 0x01, 0xAB, 0xFF,
-    0x01, 0xFF, 0xFE, 0x40, 0x3F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xF8, 0x06, 0xFF, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x64, 0x0B, 0x43, 0xF8, 0x02,
-    0xEF, 0x80, 0x06, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x19, 0x06, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x78, 0x00, 0x01, 0xF0, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x01, 0xAB, 0xF4, 0x2F, 0xFF, 0x80, 0x7D, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0xBD, 0x55, 0x50, 0x3F, 0xFF, 0xFC, 0x05, 0x55, 0x58, 0xB4, 0x02, 0xD0, 0x0F, 0x3E,
-    0x00, 0xF4, 0x03, 0xDF, 0x80, 0x3D, 0x00, 0xF7, 0xE0, 0x0F, 0x40, 0x3D, 0xF8, 0x03, 0xD0, 0x0F,
-    0x7E, 0x00, 0xF4, 0x03, 0xDB, 0x80, 0x3D, 0x00, 0xF2, 0xE0, 0x0F, 0x40, 0x3C, 0x7C, 0x03, 0xD0,
-    0x1F, 0x0F, 0x40, 0xF4, 0x0F, 0x82, 0xF4, 0x3D, 0x0B, 0xC0, 0x3F, 0xEF, 0xAF, 0xD0, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x14, 0x03, 0xD0, 0x14,
-    0x3C, 0x03, 0xD0, 0x3D, 0x3C, 0x03, 0xD0, 0x2E, 0x3C, 0x03, 0xD0, 0x1F, 0x3C, 0x03, 0xD0, 0x1F,
-    0x3C, 0x03, 0xD0, 0x0F, 0x3C, 0x03, 0xD0, 0x0F, 0x3C, 0x03, 0xD0, 0x0F, 0x3C, 0x03, 0xD0, 0x1F,
-    0x3D, 0x03, 0xD0, 0x2E, 0x2E, 0x03, 0xD0, 0x3D, 0x0F, 0x83, 0xD0, 0xFC, 0x07, 0xFB, 0xFF, 0xF0,
-    0x01, 0xBF, 0xFF, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00,
-    0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00,
-    0x00, 0x0B, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0, 0x00, 0x00, 0x1F, 0x7C,
-    0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D, 0x00, 0x00, 0xF8,
-    0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x01, 0xFF, 0xFD, 0x01, 0xF9, 0x1B, 0xD0, 0xF8, 0x00, 0x7C, 0x3C, 0x00,
-    0x0F, 0x5F, 0x00, 0x02, 0xEB, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x0B, 0x9F, 0x00,
-    0x02, 0xE3, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0xBC, 0x0F, 0xEA, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x2F, 0xAF, 0x00, 0x00, 0x2F, 0xE3, 0xC0, 0x00, 0x0F, 0x00, 0xF8,
-    0x00, 0x0B, 0x80, 0x1F, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0xB8, 0x00,
-    0x1F, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0xB8, 0x0B, 0x80, 0x00, 0x1F, 0x03, 0xD0,
-    0x00, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0xBC, 0x78, 0x00, 0x00, 0x0F, 0x3D, 0x00, 0x00, 0x03, 0xDF,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x50,
-    0x00, 0x01, 0x8B, 0x80, 0x00, 0xFD, 0x7C, 0x00, 0x1F, 0x03, 0xD0, 0x03, 0xD0, 0x2E, 0x00, 0x3C,
-    0x00, 0xF0, 0x0B, 0x80, 0x0F, 0x40, 0xF4, 0x00, 0x7C, 0x0F, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x2D,
-    0x3D, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xF4, 0x00, 0x00, 0x2D, 0x1F, 0x00, 0x00, 0x03, 0xC1, 0xD0,
-    0x00, 0x00, 0x28, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xFA, 0xF0, 0x00,
-    0x02, 0xFE, 0x3C, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0xB8, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x3D,
-    0x00, 0x1F, 0x00, 0x0B, 0x80, 0x0B, 0x80, 0x01, 0xF0, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0xF0, 0x00,
-    0x0B, 0x80, 0xB8, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x0B, 0xC7, 0x80,
-    0x00, 0x00, 0xF3, 0xD0, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x0F, 0x0B, 0x80,
-    0x00, 0x3C, 0x3C, 0x00, 0x01, 0xD0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x8B, 0x80,
-    0x00, 0xFD, 0x7C, 0x00, 0x1F, 0x03, 0xD0, 0x03, 0xD0, 0x2E, 0x00, 0x3C, 0x00, 0xF0, 0x0B, 0x80,
-    0x0F, 0x40, 0xF4, 0x00, 0x7C, 0x0F, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x2D, 0x3D, 0x00, 0x01, 0xF3,
-    0xC0, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x07, 0xC1, 0x40, 0x00, 0x14, 0x3D, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x07,
-    0xC7, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0xB8, 0x7C, 0x00, 0x00, 0x2E, 0x0F, 0x00, 0x0F, 0x47,
-    0xC0, 0x00, 0x02, 0xE0, 0xB8, 0x01, 0xF0, 0x7C, 0x00, 0x00, 0x2E, 0x07, 0xC0, 0x2E, 0x07, 0xC0,
-    0x00, 0x02, 0xE0, 0x3D, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x3E, 0x02, 0xE0, 0x7C, 0x03, 0xD0, 0x00,
-    0x03, 0xD0, 0x0F, 0x0B, 0x40, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0xB4, 0xF0, 0x01, 0xF4, 0x00, 0x0F,
-    0x80, 0x07, 0xDE, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x3E, 0xD0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x05, 0x00, 0x00, 0x50, 0x1F,
-    0xFF, 0xD0, 0x3D, 0x00, 0x07, 0xC0, 0xF9, 0x1B, 0xD0, 0xB8, 0x00, 0x2E, 0x0F, 0x80, 0x0B, 0xC0,
-    0xF0, 0x00, 0xF4, 0x3C, 0x00, 0x0F, 0x43, 0xD0, 0x07, 0xC1, 0xF0, 0x00, 0x2E, 0x07, 0xC0, 0x3E,
-    0x0B, 0x80, 0x00, 0xB8, 0x0F, 0x40, 0xF0, 0x2E, 0x00, 0x02, 0xF0, 0x2E, 0x07, 0xC0, 0xB8, 0x00,
-    0x0B, 0x80, 0x3C, 0x3D, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0xF4, 0xF0, 0x03, 0xD0, 0x00, 0xF0, 0x01,
-    0xE7, 0x80, 0x0B, 0xC0, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xEA, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x07, 0xF5, 0xF8, 0xBE, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x07, 0xC3, 0xD0,
-    0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x01,
-    0xF7, 0xC0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x00, 0x2F, 0x3D, 0x00,
-    0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x7E, 0x0F, 0x87, 0xF0,
-    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x03, 0xFB, 0xFB,
-    0xD0, 0x3E, 0x01, 0x07, 0xC0, 0xF0, 0x00, 0x0B, 0x87, 0xC0, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x3C,
-    0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x1F, 0x0F, 0x40, 0x00, 0xF8, 0x1F,
-    0x4A, 0x0B, 0xC0, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xF4, 0x2F, 0xFF, 0x80, 0x0F, 0xC0,
-    0x10, 0x04, 0x07, 0xD0, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x7C, 0x00,
-    0x07, 0xC0, 0x00, 0x3C, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xB8,
-    0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x1F, 0x40, 0x07, 0xC0, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0,
-    0x0B, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF8, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0xFA, 0xFE, 0x80, 0x00, 0x00, 0x38, 0x16, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x90, 0x00, 0x7F, 0xF4, 0x0F, 0xFF, 0x00, 0x7E, 0x18,
-    0x01, 0x47, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00,
-    0x00, 0x01, 0xF2, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x2D, 0x00, 0x0F, 0x1F, 0x00, 0x0F,
-    0x40, 0x03, 0xC7, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0xF4, 0x00, 0xF4, 0x00, 0xF8, 0x2F, 0x00, 0x7F,
-    0x00, 0x7C, 0x03, 0xFA, 0xFE, 0xFA, 0xFE, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x34,
-    0x34, 0x70, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x3D, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xF4, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xE0, 0x00, 0x3C,
-    0x3D, 0x00, 0x0B, 0x80, 0x00, 0xF0, 0xF4, 0x00, 0x2F, 0x00, 0x07, 0xC2, 0xE0, 0x00, 0xBC, 0x00,
-    0x1F, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0xBC, 0x1F, 0x00, 0x0F, 0xE0, 0x02, 0xE0, 0x3D, 0x00, 0xBF,
-    0xC0, 0x0F, 0x40, 0xB8, 0x03, 0xDF, 0x00, 0x3C, 0x01, 0xF0, 0x1F, 0x3D, 0x01, 0xF0, 0x03, 0xD0,
-    0xB4, 0xBC, 0x0B, 0x80, 0x0B, 0x83, 0xC0, 0xF0, 0x3C, 0x00, 0x1F, 0x1E, 0x03, 0xE1, 0xF0, 0x00,
-    0x3D, 0xB4, 0x07, 0xCF, 0x40, 0x00, 0x7F, 0xC0, 0x0F, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0,
-    0x00, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA4,
-    0x00, 0x00, 0x3E, 0xBA, 0xB4, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x50, 0x00, 0x14, 0x78, 0x00, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0xB8, 0x00, 0x3C, 0x7C,
-    0x00, 0x7C, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x00, 0xB8, 0x3D, 0x00, 0x3C, 0x00, 0xF4, 0x2E, 0x00,
-    0x7D, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x01, 0xF0, 0x0F, 0x41, 0xEF, 0x02, 0xD0, 0x07, 0x83, 0xCB,
-    0x43, 0xC0, 0x03, 0xC7, 0x87, 0xCB, 0x80, 0x02, 0xEF, 0x03, 0xDF, 0x00, 0x00, 0xFE, 0x01, 0xFE,
-    0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x0F, 0xFF,
-    0xFF, 0x00, 0xFD, 0x00, 0x28, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x6A, 0x50, 0x1F, 0xFF, 0xD0, 0xFD, 0x5A, 0x0F, 0x80, 0x00, 0x7C,
-    0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03,
-    0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xFA, 0xC0, 0x0B, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0,
-    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x0B, 0x40, 0x08, 0x03, 0xC0, 0x03, 0xE2, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x7B, 0xF0, 0x00, 0x3C, 0x2E, 0x74, 0x2D, 0x00, 0x1F, 0x9F, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07,
-    0xF4, 0x00, 0x03, 0xDF, 0xC0, 0x01, 0xE0, 0x70, 0x00, 0xF0, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xD2, 0xAA, 0xBE, 0x7E, 0xAA, 0x82, 0x40, 0x00, 0x00, 0x05, 0x00,
-    0x1F, 0xFC, 0x7F, 0xE5, 0xE6, 0x40, 0x09, 0x14, 0x7C, 0xB4, 0x34, 0x09, 0x14, 0x7D, 0x1D, 0x2C,
-    0x60, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x7E, 0xFF, 0x9B, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xD1, 0xD0, 0x00, 0x00, 0xB4, 0x70, 0x00,
-    0x14, 0x05, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x43, 0x97, 0x80, 0x00,
-    0x00, 0x00, 0x2D, 0x6C, 0x20, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0xEB, 0xC0, 0x00, 0x00, 0x7A, 0xF0, 0x00, 0x28, 0x09, 0x00, 0x00, 0x09, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x64, 0x00, 0x07, 0x40,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0xF0, 0x00, 0x02, 0xE0, 0x1F, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1A, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xF8, 0x0B, 0x80, 0x00, 0x2F, 0xC0, 0xB8, 0x00,
-    0x07, 0xFC, 0x0B, 0x80, 0x00, 0xFB, 0xC0, 0xB8, 0x00, 0x2F, 0x3C, 0x0B, 0x80, 0x07, 0xD3, 0xC0,
-    0xB8, 0x00, 0xF8, 0x7C, 0x0B, 0x80, 0x2F, 0x07, 0xC0, 0xB8, 0x07, 0xD0, 0x7C, 0x0B, 0x80, 0xF8,
-    0x07, 0xC0, 0xB8, 0x2F, 0x00, 0x7C, 0x0B, 0x87, 0xD0, 0x07, 0xC0, 0xB4, 0xF8, 0x00, 0x7C, 0x0B,
-    0x6F, 0x00, 0x07, 0xC0, 0xBB, 0xD0, 0x00, 0x7C, 0x0B, 0xF8, 0x00, 0x07, 0xC0, 0xBF, 0x00, 0x00,
-    0x7F, 0xCB, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x1E, 0x00, 0x3C,
-    0x00, 0x3C, 0x02, 0xE0, 0x00, 0xBE, 0xBF, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x54, 0x0F, 0x00, 0x07, 0xF0, 0x3C, 0x00, 0x3F, 0xC0, 0xF0, 0x02, 0xEF, 0x03, 0xC0,
-    0x1F, 0x3C, 0x0F, 0x00, 0xF0, 0xF0, 0x3C, 0x0B, 0x83, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC3, 0xD0,
-    0x3C, 0x0F, 0x1E, 0x00, 0xF0, 0x3D, 0xF0, 0x03, 0xC0, 0xFF, 0x40, 0x0F, 0x03, 0xFC, 0x00, 0x3F,
-    0xCF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0x90, 0x07, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x06, 0xFE,
-    0xA4, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x1B, 0xD5, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x02, 0xF5, 0x40, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xAB, 0xFF, 0x00, 0xB8, 0x00, 0x7E,
-    0x02, 0xE0, 0x00, 0xBC, 0x0B, 0x80, 0x01, 0xF0, 0x2E, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x2F, 0x02,
-    0xE0, 0x02, 0xF4, 0x0B, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xAF, 0xEA, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0xFF, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0x80, 0xF4, 0x00, 0x7D, 0x0F, 0x40, 0x03, 0xE0,
-    0xF4, 0x00, 0x2D, 0x0F, 0x40, 0x07, 0xC0, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xF9, 0x00, 0x7F, 0xFE,
-    0x40, 0x2F, 0xFF, 0xFD, 0x0B, 0x80, 0x1F, 0xD2, 0xE0, 0x00, 0xF8, 0xB8, 0x00, 0x1F, 0x2E, 0x00,
-    0x07, 0xCB, 0x80, 0x41, 0xF2, 0xE0, 0xB8, 0xF8, 0xB8, 0x0F, 0xFC, 0x2F, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xFE, 0x02, 0xE0, 0x02, 0xD0, 0xB8, 0x00, 0x30, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x50, 0x6A, 0x40, 0xF2, 0xFF, 0xF0, 0xFF,
-    0x51, 0xFC, 0xFC, 0x00, 0x3D, 0xF8, 0x00, 0x2E, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xFC, 0x0F, 0x3E, 0xFE, 0x07, 0xFC, 0xFB, 0xEB, 0xF4,
-    0xF5, 0xFF, 0xF0, 0xF4, 0x00, 0x7C, 0xF4, 0x00, 0x28, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E,
-    0x7F, 0xFF, 0xFA, 0xFF, 0xFF, 0xEB, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00,
-    0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x55, 0x5F, 0x7F, 0xFF, 0xDF,
-    0x95, 0x53, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D,
-    0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF,
-    0xFF, 0xE0, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x05, 0x55, 0x50, 0x3F, 0xFF, 0xD0, 0xF9, 0x55, 0x03, 0xD0,
-    0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x06, 0xFA, 0xA4, 0x3F, 0xFF, 0xE0, 0x0F, 0x40, 0x00, 0x3D,
-    0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
-    0x0B, 0xFF, 0xFF, 0xC0, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xBE, 0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0x40,
-    0xBC, 0x06, 0xFD, 0x0B, 0x80, 0x02, 0xF0, 0xB8, 0x00, 0x0F, 0x8B, 0x80, 0x00, 0x7C, 0xB8, 0x00,
-    0x03, 0xCB, 0x80, 0x00, 0x3D, 0xB8, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x03, 0xFF, 0xFD, 0x0F, 0x95, 0x50, 0x3D, 0x00, 0x00,
-    0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0xEE, 0x40, 0x3F, 0xFF, 0xD0, 0xF8, 0x1F, 0xD3, 0xD0, 0x0B,
-    0xCF, 0x40, 0x0F, 0x7D, 0x00, 0x3D, 0xF4, 0x00, 0xBB, 0xD0, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x3D, 0x00, 0x00, 0xF0, 0x10, 0x0F, 0x80, 0xFF, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x1E, 0x00, 0x0B, 0x80, 0xBC, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x07, 0xC0,
-    0x00, 0xF4, 0x07, 0xC0, 0x3D, 0x00, 0x01, 0xF0, 0x1F, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x7C, 0x2F,
-    0x00, 0x00, 0x02, 0xF1, 0xF1, 0xF0, 0x00, 0x00, 0x03, 0xE7, 0xCF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xF5, 0xF3, 0xD0, 0x00, 0x00, 0x0F,
-    0x87, 0xC7, 0xD0, 0x00, 0x00, 0xBC, 0x1F, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x7C, 0x0B, 0xC0, 0x00,
-    0x3D, 0x01, 0xF0, 0x0F, 0x80, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x40, 0x3E, 0x00, 0x1F, 0x00, 0x1F,
-    0xF2, 0xF0, 0x00, 0x7C, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x14, 0x00, 0x50, 0x00, 0x50, 0x2E, 0x00, 0xB4, 0x03, 0xD0, 0x0F, 0x40,
-    0xB4, 0x0F, 0x80, 0x03, 0xD0, 0xB4, 0x2E, 0x00, 0x00, 0xF0, 0xB4, 0x7C, 0x00, 0x00, 0x7C, 0xB5,
-    0xF0, 0x00, 0x00, 0x1F, 0xBB, 0xC0, 0x00, 0x00, 0x1F, 0xFB, 0xC0, 0x00, 0x00, 0x3C, 0xB6, 0xF0,
-    0x00, 0x00, 0xF4, 0xB4, 0xB8, 0x00, 0x03, 0xE0, 0xB4, 0x3E, 0x00, 0x0F, 0x80, 0xB4, 0x0F, 0x40,
-    0x2F, 0x00, 0xB4, 0x03, 0xFD, 0xBC, 0x00, 0xB4, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xD0, 0x20, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x05, 0xFC,
-    0x00, 0xFF, 0xF8, 0x00, 0x1A, 0xBF, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x2F, 0x4F, 0xFA, 0xFF, 0x82, 0xFF, 0xFE,
-    0x40, 0x00, 0x78, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x05, 0xA9, 0x00, 0x3F, 0xFF, 0xD0, 0x29, 0x06, 0xF4, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x3E, 0xAB, 0xF4, 0x2F, 0xFF, 0x80, 0x00,
-    0x78, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x50,
-    0x00, 0x78, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0xBC, 0x0B, 0x80, 0x0B, 0xC0, 0x2E, 0x00, 0xBC, 0x00,
-    0xB8, 0x07, 0xC0, 0x02, 0xE0, 0x7D, 0x00, 0x0B, 0x87, 0xD0, 0x00, 0x2E, 0x3E, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xEF, 0xC0, 0x00, 0x0B, 0x8F, 0xC0, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0xB8, 0x0F,
-    0x80, 0x02, 0xE0, 0x1F, 0x40, 0x0B, 0x80, 0x1F, 0x40, 0x2E, 0x00, 0x1F, 0x40, 0xB8, 0x00, 0x2F,
-    0xF6, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0A, 0x40, 0x50, 0x00, 0x50, 0xF4, 0x02, 0xE0, 0xF4, 0x0B,
-    0x80, 0xF4, 0x2F, 0x00, 0xF4, 0x7C, 0x00, 0xF5, 0xF0, 0x00, 0xFB, 0xC0, 0x00, 0xFB, 0xC0, 0x00,
-    0xF6, 0xF0, 0x00, 0xF4, 0xBC, 0x00, 0xF4, 0x2F, 0x00, 0xF4, 0x0F, 0x80, 0xF4, 0x03, 0xFD, 0xF4,
-    0x00, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x19, 0x78, 0x00, 0x0B, 0x8B, 0x80, 0x02, 0xF0, 0xB8, 0x00, 0xBC, 0x0B, 0x8E, 0x2F, 0x00, 0xB8,
-    0xE7, 0xC0, 0x0B, 0x8F, 0xF4, 0x00, 0xB8, 0xFD, 0x00, 0x0B, 0x8F, 0x80, 0x00, 0xBF, 0xF0, 0x00,
-    0x0B, 0xBF, 0x00, 0x00, 0xB8, 0xFC, 0x00, 0x0B, 0x8F, 0xE0, 0x00, 0xB8, 0xFF, 0x80, 0x0B, 0x8E,
-    0x7D, 0x00, 0xB8, 0x51, 0xF4, 0x0B, 0x80, 0x07, 0xD0, 0xB8, 0x00, 0x2F, 0x0B, 0x80, 0x00, 0xBC,
-    0x50, 0x00, 0x53, 0xD1, 0x0B, 0x8F, 0x5D, 0xB8, 0x3D, 0x7F, 0xC0, 0xF5, 0xFC, 0x03, 0xD7, 0xC0,
-    0x0F, 0xBD, 0x00, 0x3E, 0xF4, 0x00, 0xF6, 0xF0, 0x03, 0xD7, 0xF0, 0x0F, 0x5F, 0xF0, 0x3D, 0x77,
-    0xE0, 0xF4, 0xD3, 0xE3, 0xD0, 0x03, 0xD0, 0x07, 0x80, 0x00, 0xB4, 0x0B, 0x80, 0x01, 0xF0, 0x6F,
-    0xE8, 0x03, 0xD0, 0xBF, 0xFC, 0x0F, 0x80, 0x1B, 0xD4, 0x2F, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x0B,
-    0x80, 0xF8, 0x00, 0x0B, 0xD6, 0xF0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0B, 0xEB, 0xF0, 0x00, 0x0B,
-    0x80, 0xF4, 0x00, 0x0B, 0x80, 0xBC, 0x00, 0x0B, 0x80, 0x3E, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x0B,
-    0x80, 0x0B, 0xC0, 0x0B, 0x80, 0x03, 0xE0, 0x0B, 0x80, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0xBC, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x01, 0x40, 0xF4, 0x02, 0xE0, 0x3D, 0x02, 0xE0, 0x0F, 0x42, 0xF0, 0x03, 0xD1, 0xF0, 0x00,
-    0xF5, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x0F, 0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0xF4, 0xBC, 0x00,
-    0x3D, 0x0B, 0xC0, 0x0F, 0x40, 0xF8, 0x03, 0xD0, 0x0F, 0x80, 0xF4, 0x00, 0xF4, 0xBF, 0xF4, 0x00,
-    0x0F, 0x4F, 0xFF, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x0B, 0x80, 0x2F, 0x00, 0x00,
-    0xB8, 0x0B, 0xC0, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0xB8, 0x7D, 0x00, 0x00, 0x0B, 0x9F, 0x40,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xBF, 0x00, 0x00, 0x00, 0xB8, 0xF8, 0x00, 0x00, 0x0B,
-    0x83, 0xE0, 0x00, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x0B, 0x80, 0x7D, 0x00, 0x00, 0xB8, 0x02, 0xF0,
-    0x00, 0x0B, 0x80, 0x0B, 0xC0, 0x00, 0xB8, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0x00, 0xFC, 0x15, 0x54,
-    0x00, 0x14, 0xBF, 0xFC, 0x00, 0xF0, 0x15, 0xBC, 0x03, 0xD0, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x7C,
-    0x3E, 0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7C,
-    0xF8, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x7C, 0x07, 0xD0, 0x00, 0x7C,
-    0x01, 0xF0, 0x00, 0x7C, 0x00, 0x7C, 0x78, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0x3C, 0x0B, 0x80,
-    0x00, 0x0F, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0xB8, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0x3C, 0x0B,
-    0x80, 0x00, 0x0F, 0x02, 0xF5, 0x55, 0x57, 0xC0, 0xBF, 0xFF, 0xFF, 0xF0, 0x2F, 0xAA, 0xAA, 0xBC,
-    0x0B, 0x80, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0xB8, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00,
-    0x3C, 0x0B, 0x80, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0xB8, 0x00, 0x00, 0xFF, 0x2E, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0x50, 0x00, 0x05, 0x0F, 0x40, 0x01, 0xF0, 0xF4,
-    0x00, 0x1F, 0x0F, 0x40, 0x01, 0xF0, 0xF4, 0x00, 0x1F, 0x0F, 0x40, 0x01, 0xF0, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xF0, 0xF4, 0x00, 0x1F, 0x0F, 0x40, 0x01, 0xF0, 0xF4, 0x00, 0x1F, 0x0F, 0x40,
-    0x01, 0xF0, 0xF4, 0x00, 0x1F, 0xEF, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x90, 0x78, 0x00, 0x00, 0xFF, 0xF2,
-    0xE0, 0x00, 0x03, 0xFF, 0xCB, 0x80, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00,
-    0x00, 0xF0, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x2F, 0x55, 0x55, 0x7C,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFA, 0xAA, 0xAB, 0xC0, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x2E,
-    0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00,
-    0x0F, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x03, 0xC0,
-    0x00, 0x50, 0x00, 0x05, 0x55, 0x3D, 0x00, 0x07, 0xFF, 0xCF, 0x40, 0x01, 0xF5, 0x53, 0xD0, 0x00,
-    0x7C, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x01, 0xF0, 0x03,
-    0xD0, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x03,
-    0xFF, 0xE4, 0x00, 0xB8, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0xB8, 0x00, 0x03, 0xD0, 0x1F, 0xE0, 0xB8,
-    0x00, 0x03, 0xC0, 0x02, 0xF4, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0xBC, 0xB8, 0x00, 0x03, 0xC0, 0x00,
-    0x7C, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0xB8, 0x00, 0x03,
-    0xC0, 0x00, 0x3D, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x95, 0x5B, 0xC0,
-    0x00, 0x3D, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x0F,
-    0x40, 0x03, 0xEE, 0x80, 0x3D, 0x00, 0x0F, 0xFF, 0xE0, 0xF4, 0x00, 0x3D, 0x0B, 0xE3, 0xD0, 0x00,
-    0xF0, 0x07, 0xCF, 0x40, 0x03, 0xC0, 0x0F, 0xBD, 0x00, 0x0F, 0x00, 0x2E, 0xF4, 0x00, 0x3C, 0x00,
-    0x7F, 0xD0, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x04, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x01, 0x90, 0x02, 0xF0, 0x02,
-    0xFF, 0xC0, 0x3D, 0x00, 0x7E, 0x7F, 0x03, 0xC0, 0x0F, 0x80, 0xF4, 0x7C, 0x00, 0xF4, 0x0B, 0x87,
-    0xC0, 0x0F, 0x00, 0x7C, 0x7C, 0x01, 0xF0, 0x07, 0xC7, 0xC0, 0x0F, 0x00, 0x7C, 0x7C, 0x00, 0xF0,
-    0x0B, 0xC3, 0xD0, 0x0F, 0x40, 0xF8, 0x2F, 0x00, 0xBC, 0x0F, 0x01, 0xF4, 0x03, 0xD3, 0xE0, 0x0B,
-    0xE0, 0x2F, 0xFC, 0x00, 0x2F, 0xFB, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xF9, 0x10,
-    0x00, 0x0F, 0x40, 0x1A, 0x40, 0x3C, 0x03, 0xFF, 0x81, 0xF0, 0x2F, 0x1F, 0x4B, 0x80, 0xF4, 0x2E,
-    0x2E, 0x03, 0xD0, 0x78, 0xB8, 0x0F, 0x41, 0xE1, 0xF0, 0x3D, 0x0B, 0x83, 0xC0, 0x7C, 0x3C, 0x0B,
-    0xC0, 0xFB, 0xD0, 0x0F, 0xEB, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x6A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFD, 0x00, 0x24, 0x0F, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B,
-    0xFE, 0xBF, 0x40, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x6A, 0x40,
-    0x1F, 0xFF, 0xC0, 0xFD, 0x5A, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xFA,
-    0xF0, 0x0B, 0xFF, 0x80, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x2C, 0x00, 0x0B,
-    0xF0, 0x00, 0x15, 0x00, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x15, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0x15, 0xBD, 0x54, 0x00, 0x3C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x02, 0x80, 0xB8, 0x00,
-    0x01, 0xF1, 0xF0, 0x00, 0x0F, 0x42, 0xE0, 0x00, 0xBC, 0x03, 0xC0, 0x03, 0xD0, 0x0B, 0x80, 0x2F,
-    0x00, 0x0F, 0x40, 0xF0, 0x00, 0x2F, 0x0B, 0x80, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x7E, 0xE0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x50, 0x00, 0x05, 0x6E, 0x00, 0x03, 0xD7, 0xC0, 0x01, 0xF0, 0xF4, 0x00, 0xB8, 0x1F,
-    0x00, 0x3C, 0x03, 0xC0, 0x1F, 0x00, 0xB8, 0x0F, 0x40, 0x1F, 0x03, 0xC0, 0x03, 0xD2, 0xE0, 0x00,
-    0xB8, 0xF0, 0x00, 0x0F, 0x3C, 0x00, 0x02, 0xED, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0xB8, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x0F, 0x42, 0xE0, 0x00, 0xBC, 0x03, 0xC0,
-    0x03, 0xD0, 0x0B, 0x80, 0x2F, 0x00, 0x0F, 0x40, 0xF0, 0x00, 0x2F, 0x0B, 0x80, 0x00, 0x3D, 0x3C,
-    0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x50, 0x00, 0x05, 0x6E, 0x00, 0x03, 0xD7, 0xC0, 0x01,
-    0xF0, 0xF4, 0x00, 0xB8, 0x1F, 0x00, 0x3C, 0x03, 0xC0, 0x1F, 0x00, 0xB8, 0x0F, 0x40, 0x1F, 0x03,
-    0xC0, 0x03, 0xD2, 0xE0, 0x00, 0xB8, 0xF0, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x2A, 0xFE, 0xA0, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x2F, 0x00, 0x03, 0xD0,
-    0x0F, 0x40, 0x0B, 0x80, 0x07, 0xC0, 0x1F, 0x00, 0x02, 0xE0, 0x3D, 0x00, 0x00, 0xF4, 0xB8, 0x00,
-    0x00, 0x7D, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3E, 0xF0, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x03, 0xD0, 0x2E, 0x00,
-    0x0B, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x03, 0xFD, 0xBC, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x29, 0x14, 0x00, 0x05, 0x02, 0xF0, 0x02, 0xF0, 0x0F, 0x40, 0x3C, 0x00, 0x7C,
-    0x0F, 0x40, 0x02, 0xF2, 0xF0, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x1F, 0x3E, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0xF8, 0x07, 0xC0, 0x1F, 0x00,
-    0x2F, 0xD3, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x90, 0xBF, 0xFF, 0xFF, 0xD0, 0x78, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x2F, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x00,
-    0xBC, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0xB8, 0x00, 0x02,
-    0xF0, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x00, 0x02, 0xE0, 0x00, 0x0B,
-    0xC0, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0x80, 0x00, 0x2F,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x15, 0x55, 0x54, 0x05, 0x0B, 0xFF, 0xFF, 0xC2, 0xE0, 0x15, 0xF9, 0x54, 0x2E, 0x00, 0x0B, 0x80,
-    0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00,
-    0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00,
-    0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x01, 0x90, 0xF0, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x03, 0xC0, 0xF4, 0x00,
-    0x03, 0xC0, 0xF4, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x03, 0xC0, 0xF4, 0x00,
-    0x03, 0xC0, 0xF4, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xBE, 0x41, 0xBF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x06, 0xFA, 0x43, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x28, 0x14, 0x00, 0x05, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0xF0, 0x0F, 0x00, 0x03,
-    0xC0, 0x3C, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x01, 0xF0, 0x0B, 0xD1, 0x7F, 0xC0,
-    0x0F, 0xFF, 0xDF, 0x00, 0x06, 0x94, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0A, 0x00, 0xF0, 0x00, 0x03, 0xCF, 0x40, 0x00,
-    0x7C, 0xF4, 0x00, 0x07, 0xCF, 0x40, 0x00, 0x7C, 0xF4, 0x00, 0x07, 0xCF, 0x40, 0x40, 0x7C, 0xF4,
-    0x1C, 0x07, 0xCF, 0x41, 0xC0, 0x7C, 0xF8, 0x1C, 0x07, 0xCB, 0xE5, 0xD6, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x2B, 0xE4, 0x7C, 0x00, 0x1C, 0x07, 0xC0, 0x01, 0xC0, 0x7C, 0x00, 0x1C, 0x07, 0xC0, 0x00,
-    0x40, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x14, 0x00, 0x05, 0x3C, 0x00, 0x0F, 0x3C,
-    0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x1C, 0x0F, 0x3C, 0x2C, 0x0F, 0x3C, 0x2C, 0x2F, 0x3F, 0x6E,
-    0xFF, 0x0F, 0xFF, 0xDF, 0x01, 0xBC, 0x0F, 0x00, 0x2C, 0x0F, 0x00, 0x2C, 0x0F, 0x00, 0x04, 0x0F,
-    0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xB8, 0x1A, 0xA4, 0x0B, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xE5, 0x6F, 0xCB, 0xC0, 0x00, 0x3D, 0xB8, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x3D, 0xB8, 0x00, 0x03,
-    0xDB, 0x80, 0x00, 0x3D, 0xB8, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x3D, 0xB8, 0x00, 0x03, 0xDB, 0x80,
-    0x00, 0x3D, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xF4, 0x2A, 0x40, 0xF6, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3C, 0xF8, 0x00, 0x3D,
-    0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00,
-    0x0F, 0x40, 0x00, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x28, 0x3C, 0x00, 0x00, 0x3D, 0x78, 0x7C,
-    0x00, 0x00, 0x3E, 0x7C, 0xBC, 0x00, 0x00, 0x2E, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x14,
-    0x00, 0x02, 0xFF, 0xAF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x3F, 0x42, 0xF4, 0x24, 0x7C, 0x00, 0xBC, 0x74,
-    0xB8, 0x00, 0x3C, 0x78, 0xF4, 0x00, 0x3D, 0x3F, 0xFF, 0xFF, 0xFD, 0x0A, 0xFE, 0xAA, 0xA8, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x04, 0x00,
-    0x1F, 0xEA, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00,
-    0x1F, 0x40, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x28, 0x3C, 0x00, 0x00, 0x3D, 0x78, 0x7C,
-    0x00, 0x00, 0x3E, 0x7C, 0xBC, 0x00, 0x00, 0x2E, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x14,
-    0x00, 0x02, 0xFF, 0xAF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x2F, 0x42, 0xF4, 0x24,
-    0x7C, 0x00, 0xBC, 0x74, 0xB8, 0x00, 0x3C, 0x78, 0xF4, 0x00, 0x3D, 0x3F, 0xFF, 0xFF, 0xFD, 0x0A,
-    0xFE, 0xAA, 0xA8, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x04, 0x00, 0x1F, 0xEA, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xFF,
-    0xF6, 0xFF, 0x80, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D,
-    0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x6F, 0xE3, 0xFF, 0xD0, 0x00,
-    0x01, 0x90, 0x18, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2D, 0x00,
-    0x0B, 0x82, 0xF0, 0x00, 0xF4, 0x00, 0x3C, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x0F,
-    0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0xF4, 0x0F, 0x80, 0x00, 0x1F,
-    0x03, 0xD0, 0xBC, 0x00, 0x00, 0x2F, 0x5F, 0x97, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x02, 0xFA, 0xFE, 0xFC, 0x00, 0x00, 0x0F, 0x43, 0xD0, 0xF8, 0x00, 0x00, 0xF8, 0x0F, 0x40, 0xF4,
-    0x00, 0x07, 0xC0, 0x3D, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0xF4, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0,
-    0x07, 0xD0, 0x1F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0x8B, 0xC0, 0x00,
-    0xF4, 0x00, 0x1F, 0x00, 0x00, 0x09, 0x01, 0x80, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0xBE,
-    0xF8, 0x00, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x01,
-    0x43, 0xD0, 0x0B, 0x80, 0x1F, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0xC0, 0xB8, 0x0F, 0x40, 0x0F,
-    0x42, 0xE0, 0x7C, 0x00, 0x0F, 0x0B, 0x83, 0xC0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x03, 0xD2, 0xE1, 0xF0, 0x00, 0x3E, 0x0B, 0x82, 0xF0, 0x01, 0xF0, 0x2E, 0x03, 0xD0,
-    0x0F, 0x40, 0xB8, 0x07, 0xC0, 0xF8, 0x02, 0xE0, 0x0B, 0xC7, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x78,
-    0x00, 0x0B, 0x82, 0xE0, 0x00, 0xBC, 0x0B, 0x80, 0x0B, 0xC0, 0x2E, 0x00, 0xBC, 0x00, 0xB8, 0x07,
-    0xC0, 0x02, 0xE0, 0x7C, 0x00, 0x0B, 0x87, 0xD0, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0xBB, 0xF5, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x0B, 0xE5, 0x6F, 0xF0, 0x2E, 0x00, 0x07, 0xF0, 0xB8, 0x00, 0x07, 0xD2,
-    0xE0, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x7E, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50,
-    0xF4, 0x02, 0xE0, 0xF4, 0x0B, 0x80, 0xF4, 0x2F, 0x00, 0xF4, 0x7C, 0x00, 0xF5, 0xF0, 0x00, 0xFB,
-    0xE4, 0x00, 0xFF, 0xFF, 0x80, 0xF9, 0x5B, 0xF0, 0xF4, 0x01, 0xF4, 0xF4, 0x00, 0xBC, 0xF4, 0x00,
-    0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8,
-    0x00, 0x01, 0xF0, 0x03, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x3C,
-    0x00, 0x3D, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x07, 0x80, 0x03, 0xD0,
-    0x00, 0xB8, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x0F, 0x00,
-    0x03, 0xD0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0x3D, 0x00,
-    0x3C, 0x00, 0x03, 0xD0, 0xAF, 0x80, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x03, 0xFD, 0x10, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x55, 0x55, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0x55, 0xF4, 0x00,
-    0x3C, 0x03, 0xD0, 0x00, 0xF0, 0x0F, 0x40, 0x07, 0xC0, 0x3D, 0x00, 0x1E, 0x00, 0xF4, 0x00, 0xB8,
-    0x03, 0xD0, 0x02, 0xD0, 0x0F, 0x40, 0x0F, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0xF4, 0x03, 0xE0, 0x03,
-    0xD0, 0xBF, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x28, 0x00, 0x78, 0x00, 0x00, 0xF2,
-    0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0,
-    0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2F, 0x55, 0x55, 0x7C, 0xBF, 0xFF, 0xFF, 0xF2, 0xFA, 0xAA,
-    0xAB, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03,
-    0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x0F,
-    0xEF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0xF4, 0x00, 0x1F,
-    0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x40, 0xBC,
-    0x00, 0xFF, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00,
-    0x3C, 0x0B, 0x80, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0xB8, 0x00, 0x00, 0xF0, 0x2E, 0x00,
-    0x00, 0x3C, 0x0B, 0x80, 0x00, 0x0F, 0x02, 0xF5, 0x55, 0x57, 0xC0, 0xBF, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xAA, 0xAA, 0xBC, 0x0B, 0x80, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0xB8, 0x00, 0x00, 0xF0,
-    0x2E, 0x00, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0xB8, 0x00, 0x00,
-    0xFF, 0x6E, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x50, 0x00, 0x05, 0x03, 0xD0,
-    0x00, 0x7C, 0x0F, 0x40, 0x01, 0xF0, 0x3D, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x1F, 0x03, 0xD0, 0x00,
-    0x7C, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xF4, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x7C,
-    0x0F, 0x40, 0x01, 0xF0, 0x3D, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x1F, 0xF3, 0xD0, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0xF0, 0x00, 0x03, 0xCF, 0x40, 0x00, 0x3C, 0xF4, 0x00, 0x03, 0xCF, 0x40, 0x00,
-    0x3C, 0xF4, 0x00, 0x03, 0xCF, 0x40, 0x00, 0x3C, 0xF4, 0x00, 0x03, 0xCF, 0x40, 0x00, 0x3C, 0xF8,
-    0x00, 0x07, 0xCB, 0xE4, 0x1B, 0xFC, 0x2F, 0xFF, 0xFF, 0xC0, 0x6F, 0xA4, 0x3C, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x28, 0x00, 0x14, 0x00, 0x05, 0x0F, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0xF0, 0xF0, 0x00,
-    0x3C, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xC3, 0xD0, 0x01, 0xF0, 0xBD, 0x17, 0xFC, 0x0F, 0xFF,
-    0xDF, 0x00, 0x69, 0x43, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x0A, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x0B, 0xF8, 0x00, 0x00,
-    0xFF, 0x42, 0xEF, 0x00, 0x00, 0x7B, 0xD0, 0xB7, 0xD0, 0x00, 0x2D, 0xF4, 0x2D, 0x7C, 0x00, 0x0F,
-    0x3D, 0x0B, 0x4F, 0x00, 0x07, 0x8F, 0x42, 0xE2, 0xE0, 0x03, 0xC3, 0xD0, 0xB8, 0x7C, 0x00, 0xF0,
-    0xF4, 0x2E, 0x0F, 0x40, 0xB4, 0x3D, 0x0B, 0x82, 0xE0, 0x3C, 0x0F, 0x42, 0xE0, 0x3C, 0x1E, 0x03,
-    0xD0, 0xB8, 0x0F, 0x4F, 0x40, 0xF4, 0x2E, 0x01, 0xF3, 0xC0, 0x3D, 0x0B, 0x80, 0x3E, 0xD0, 0x0F,
-    0x42, 0xE0, 0x0B, 0xF0, 0x03, 0xD0, 0xB8, 0x01, 0xF8, 0x00, 0xFF, 0xAE, 0x00, 0x3D, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x54, 0x00, 0x00, 0x50, 0x3F,
-    0x40, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x2F, 0xE0, 0xF7, 0x80, 0x0F, 0xB8,
-    0x3C, 0xF0, 0x07, 0x9E, 0x0F, 0x2D, 0x03, 0xD7, 0x83, 0xC3, 0xC0, 0xF1, 0xE0, 0xF0, 0xF0, 0xB4,
-    0x78, 0x3C, 0x1E, 0x3C, 0x1E, 0x0F, 0x03, 0xDE, 0x07, 0x83, 0xC0, 0xBF, 0x01, 0xE0, 0xF0, 0x0F,
-    0xC0, 0x7F, 0xBC, 0x03, 0xD0, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x02, 0x80, 0xFF, 0xF6, 0xFF, 0x80,
-    0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03,
-    0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x6F, 0xE3, 0xFF, 0xD0, 0x00, 0xA0, 0x09, 0x00,
-    0x00, 0xB4, 0x2E, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00,
-    0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00,
-    0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0,
-    0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C,
-    0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x06, 0x00, 0x50, 0x1E, 0x07, 0xC0, 0x3E, 0xBD,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03, 0x90, 0x7E, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xBF, 0xFF, 0x2F, 0xEA, 0xBD, 0xF4, 0x00, 0xFF, 0x80,
-    0x03, 0xFD, 0x00, 0x2F, 0xBC, 0x01, 0xFD, 0xFE, 0xBE, 0xF1, 0xFF, 0xD2, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x3D, 0x00, 0x00, 0x78, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00,
-    0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07,
-    0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C,
-    0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x0B,
-    0x40, 0x78, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03, 0x90,
-    0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xBF, 0xFF, 0x2F, 0xEA, 0xBD, 0xF4,
-    0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x2F, 0xBC, 0x01, 0xFD, 0xFE, 0xBE, 0xF1, 0xFF, 0xD2, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xB8,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x00, 0x00, 0x3C,
-    0x0F, 0x40, 0x00, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0x95, 0x54, 0x00, 0x2F,
-    0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xD0, 0x0F, 0xEA, 0xA8, 0x00, 0x7E, 0xAA, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x40, 0x00, 0x01, 0xF5, 0x55, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0xE3,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFE, 0x01, 0xA9, 0x00, 0x69, 0x00, 0x1F, 0xFF, 0xD3, 0xFF, 0xD0, 0x1E,
-    0x46, 0xFF, 0x82, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x3C, 0x00, 0x00,
-    0xBC, 0x00, 0x3D, 0x06, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xE9, 0xFE, 0xAA, 0xA8, 0x7C, 0x00, 0xBC,
-    0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xB8, 0x02, 0xFF, 0x00,
-    0x04, 0x7F, 0xAF, 0x8B, 0xFA, 0xF8, 0x1F, 0xFD, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x01, 0x90, 0x3C, 0x0F, 0x40, 0x7F, 0xF8, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00,
-    0x00, 0xBD, 0x55, 0x52, 0xFF, 0xFF, 0xCB, 0xEA, 0xAA, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0,
-    0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x40,
-    0x02, 0x00, 0x60, 0x07, 0x80, 0xF0, 0x02, 0xFB, 0xD0, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00,
-    0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xF9, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x19, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2F,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x2E,
-    0x3C, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x07, 0xF0,
-    0x03, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x3F,
-    0xFF, 0xD0, 0x39, 0x07, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x2E, 0xBF, 0xFF, 0xFE, 0xBE, 0xAA, 0xBE, 0xB8, 0x00, 0x3D, 0x7C, 0x00, 0x3C, 0x3E, 0x00, 0xB8,
-    0x1F, 0xEB, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x3C,
-    0x00, 0x00, 0xB4, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x19, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x2E, 0x3C, 0x00, 0x00,
-    0x3D, 0x3D, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x07, 0xF0, 0x03, 0xFE, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x0B,
-    0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x3F, 0xFF, 0xD0, 0x39, 0x07,
-    0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0xBF, 0xFF, 0xFE,
-    0xBE, 0xAA, 0xBE, 0xB8, 0x00, 0x3D, 0x7C, 0x00, 0x3C, 0x3E, 0x00, 0xB8, 0x1F, 0xEB, 0xF0, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x0B, 0x82, 0xF0, 0x00, 0xF4, 0x00, 0x3C, 0x03, 0xD0, 0x03,
-    0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x0F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0xF0, 0x00, 0x0F,
-    0x40, 0xF4, 0x0F, 0x80, 0x00, 0x1F, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x2F, 0x5F, 0x97, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFA, 0xFE, 0xFC, 0x00, 0x00, 0x0F, 0x43, 0xD0, 0xF8,
-    0x00, 0x00, 0xF8, 0x0F, 0x40, 0xF4, 0x00, 0x07, 0xC0, 0x3D, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0xF4,
-    0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x07, 0xD0, 0x1F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0xF8, 0x00,
-    0x3D, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x40, 0x01, 0x43, 0xD0, 0x0B, 0x80, 0x1F, 0x03, 0xC0, 0x2E, 0x00, 0xF0,
-    0x0B, 0xC0, 0xB8, 0x0F, 0x40, 0x0F, 0x42, 0xE0, 0x7C, 0x00, 0x0F, 0x0B, 0x83, 0xC0, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x03, 0xD2, 0xE1, 0xF0, 0x00, 0x3E, 0x0B, 0x82,
-    0xF0, 0x01, 0xF0, 0x2E, 0x03, 0xD0, 0x0F, 0x40, 0xB8, 0x07, 0xC0, 0xF8, 0x02, 0xE0, 0x0B, 0xC7,
-    0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x3C, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xD0, 0x20, 0x01, 0xFC, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x05, 0xFC, 0x00,
-    0xFF, 0xF8, 0x00, 0x1A, 0xBF, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x2F, 0x4F, 0xFA, 0xFF, 0x82, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x0B, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA9, 0x00, 0x3F, 0xFF, 0xD0, 0x29, 0x06, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xB8, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x3E, 0xAB, 0xF4, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x0A,
-    0xBF, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x0B, 0xC2, 0x00, 0x01, 0xF8, 0x3F, 0xAA, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x54, 0x7F, 0xFF, 0xFC, 0x15, 0x55, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xF9, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x06, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x7C, 0x50, 0x01, 0xF8, 0xBF, 0xFF, 0xE0, 0x2F, 0xFE, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x03,
-    0xF6, 0xE0, 0x00, 0x1F, 0xDB, 0x80, 0x00, 0xFF, 0x6E, 0x00, 0x0B, 0x6D, 0xB8, 0x00, 0x7C, 0xB6,
-    0xE0, 0x03, 0xC2, 0xDB, 0x80, 0x2E, 0x0F, 0x6E, 0x01, 0xF0, 0x3D, 0xB8, 0x0F, 0x40, 0xF6, 0xE0,
-    0xB8, 0x03, 0xDB, 0x83, 0xC0, 0x0F, 0x6E, 0x3D, 0x00, 0x3D, 0xB9, 0xE0, 0x00, 0xF6, 0xEF, 0x00,
-    0x03, 0xDB, 0xF4, 0x00, 0x0F, 0x6F, 0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0xF4, 0x0F, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0xF4, 0x00, 0xFD, 0xF4, 0x01, 0xFD, 0xF4,
-    0x03, 0xFD, 0xF4, 0x0B, 0x7D, 0xF4, 0x0F, 0x3D, 0xF4, 0x3C, 0x3D, 0xF4, 0x78, 0x3D, 0xF4, 0xF0,
-    0x3D, 0xF6, 0xD0, 0x3D, 0xF7, 0xC0, 0x3D, 0xFF, 0x40, 0x3D, 0xFE, 0x00, 0x3D, 0xFC, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x3F, 0x6E, 0x00, 0x01, 0xFD, 0xB8, 0x00,
-    0x0F, 0xF6, 0xE0, 0x00, 0xB6, 0xDB, 0x80, 0x07, 0xCB, 0x6E, 0x00, 0x3C, 0x2D, 0xB8, 0x02, 0xE0,
-    0xF6, 0xE0, 0x1F, 0x03, 0xDB, 0x80, 0xF4, 0x0F, 0x6E, 0x0B, 0x80, 0x3D, 0xB8, 0x3C, 0x00, 0xF6,
-    0xE3, 0xD0, 0x03, 0xDB, 0x9E, 0x00, 0x0F, 0x6E, 0xF0, 0x00, 0x3D, 0xBF, 0x40, 0x00, 0xF6, 0xFC,
-    0x00, 0x03, 0xDB, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x0B, 0x43, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0xF4, 0x00, 0xFD, 0xF4, 0x01, 0xFD, 0xF4,
-    0x03, 0xFD, 0xF4, 0x0B, 0x7D, 0xF4, 0x0F, 0x3D, 0xF4, 0x3C, 0x3D, 0xF4, 0x78, 0x3D, 0xF4, 0xF0,
-    0x3D, 0xF6, 0xD0, 0x3D, 0xF7, 0xC0, 0x3D, 0xFF, 0x40, 0x3D, 0xFE, 0x00, 0x3D, 0xFC, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x02, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80,
-    0x07, 0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0,
-    0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D,
-    0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01,
-    0xF0, 0x7D, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x3D, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x7F, 0xFF, 0x40, 0x3E, 0x46, 0xF4,
-    0x3E, 0x00, 0x2F, 0x0F, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xBA, 0xE0, 0x00, 0x2E, 0xB8, 0x00, 0x0B,
-    0xEE, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0xF8, 0xF4, 0x00, 0x3C, 0x2F, 0x00, 0x3F, 0x03, 0xFA, 0xBF,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07,
-    0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0B, 0xDF, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40,
-    0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00,
-    0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x01,
-    0xFF, 0xFD, 0x01, 0xF9, 0x1B, 0xD0, 0xF8, 0x00, 0x7C, 0x3C, 0x00, 0x0F, 0x5F, 0x00, 0x02, 0xEB,
-    0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x0B, 0x9F, 0x00, 0x02, 0xE3, 0xC0, 0x00, 0xF0,
-    0xBC, 0x00, 0xBC, 0x0F, 0xEA, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x02, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0F,
-    0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x2F,
-    0x7C, 0x00, 0x00, 0x0B, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0, 0x00, 0x00,
-    0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D, 0x00,
-    0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x7F, 0xFF, 0x40, 0x7E, 0x46, 0xF4, 0x3E, 0x00, 0x1F,
-    0x0F, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xBA, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xEE, 0x00, 0x02,
-    0xE7, 0xC0, 0x00, 0xB8, 0xF0, 0x00, 0x3C, 0x2F, 0x00, 0x2F, 0x03, 0xFA, 0xBF, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x02, 0x00, 0x1B, 0xE0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x03, 0xE0, 0x7F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x40, 0x00, 0xBE, 0x0B, 0xFB, 0xFF,
-    0x80, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x78, 0x03, 0xC1, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x0F, 0xFF, 0xE0, 0x19, 0x1B, 0xE0, 0x00, 0x03,
-    0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x0B, 0xFF, 0xFC, 0x2F, 0xFF, 0xF0, 0x00, 0x03, 0xC0, 0x00,
-    0x1F, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0xC3, 0xEA, 0xFD, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x3D,
-    0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x01, 0xF0, 0x0B, 0xC0, 0x03, 0xD0, 0x03,
-    0xD0, 0x07, 0xC0, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0xBC, 0x2E, 0x00, 0x00,
-    0x3D, 0x3C, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x15, 0xB8, 0x00, 0x0F, 0x4F, 0x00, 0x07, 0xC3, 0xD0, 0x02, 0xE0, 0x7C, 0x00,
-    0xF0, 0x0F, 0x00, 0x7C, 0x02, 0xE0, 0x3D, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x47, 0x80, 0x01, 0xE3,
-    0xD0, 0x00, 0x3C, 0xF0, 0x00, 0x0B, 0xB8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0xB4, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0xBC, 0x2F, 0x00,
-    0x00, 0xF4, 0x0F, 0x40, 0x01, 0xF0, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x02, 0xF0,
-    0x0F, 0x80, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0xBC, 0x2E, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x2F,
-    0x7C, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x01, 0x5B, 0x80, 0x00, 0xF4, 0xF0, 0x00, 0x7C, 0x3D, 0x00, 0x2E, 0x07,
-    0xC0, 0x0F, 0x00, 0xF0, 0x07, 0xC0, 0x2E, 0x03, 0xD0, 0x03, 0xC0, 0xF0, 0x00, 0xF4, 0x78, 0x00,
-    0x1E, 0x3D, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xBB, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD2, 0xE0, 0x00, 0x0B, 0x87, 0xC0,
-    0x00, 0x1E, 0x0F, 0x00, 0x00, 0x28, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C,
-    0x3D, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x01, 0xF0, 0x0B, 0xC0, 0x03, 0xD0,
-    0x03, 0xD0, 0x07, 0xC0, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0xBC, 0x2E, 0x00,
-    0x00, 0x3D, 0x3C, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x07,
-    0xC3, 0xC0, 0x03, 0xC2, 0xD0, 0x02, 0xC0, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x56, 0xE0,
-    0x00, 0x3D, 0x3C, 0x00, 0x1F, 0x0F, 0x40, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x3D, 0x01, 0xF0, 0x0B,
-    0x80, 0xB8, 0x00, 0xF0, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x07, 0x8F, 0x40, 0x00, 0xF3, 0xC0, 0x00,
-    0x2E, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x07, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x0B, 0x80, 0x00, 0xF0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x2D, 0x3C, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x3D, 0x3C, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x3D,
-    0x3C, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x7D, 0x0F, 0xFA,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xBD, 0x00, 0x04, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xC2, 0xD0, 0x07, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04,
-    0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x2E, 0x7C, 0x00, 0x2E, 0x7C,
-    0x00, 0x2E, 0x3F, 0x96, 0xFE, 0x0F, 0xFF, 0xFE, 0x00, 0x54, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x7F, 0xFF, 0xFA, 0xFF, 0xFF, 0xEB, 0x80, 0x00, 0x2E,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0x28, 0x00, 0x00, 0x55, 0x55, 0x3F, 0xFF, 0xDF, 0x95, 0x53, 0xD0, 0x00,
-    0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03,
-    0xD0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xEB, 0x80, 0x00, 0x00, 0x7E,
-    0xE0, 0x00, 0x00, 0x1F, 0xB8, 0x00, 0x00, 0x07, 0xEE, 0x00, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x00,
-    0x7E, 0xE0, 0x00, 0x00, 0x1F, 0xBF, 0xFE, 0x40, 0x07, 0xEF, 0xFF, 0xFD, 0x01, 0xFB, 0x80, 0x1F,
-    0xC0, 0x7E, 0xE0, 0x00, 0xF8, 0x1F, 0xB8, 0x00, 0x2F, 0x07, 0xEE, 0x00, 0x07, 0xC1, 0xFB, 0x80,
-    0x02, 0xF0, 0x7E, 0xE0, 0x00, 0xF8, 0x1F, 0xB8, 0x01, 0xFC, 0x07, 0xEF, 0xFF, 0xFD, 0x01, 0xFB,
-    0xFF, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x0F, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0xAA, 0x40, 0x07, 0xFF, 0xFF, 0xF0,
-    0x1F, 0xF9, 0x57, 0xF0, 0x7F, 0xD0, 0x03, 0xD1, 0xFF, 0x40, 0x0F, 0x47, 0xFD, 0x00, 0x3D, 0x1F,
-    0xF4, 0x02, 0xF0, 0x7F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xE0, 0x07, 0xC0, 0x07, 0xFF, 0xFF, 0x82,
-    0xFF, 0xFF, 0xE0, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x00, 0xB8, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xB8, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x05, 0x55, 0x50, 0x3F, 0xFF, 0xD0, 0xF9, 0x55, 0x03,
-    0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x06, 0xFA, 0xA4, 0x3F, 0xFF, 0xE0, 0x0F, 0x40, 0x00,
-    0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0,
-    0x2F, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x0B, 0x80, 0x07, 0xC0, 0x1F, 0x00, 0x02, 0xE0, 0x3D, 0x00,
-    0x00, 0xF4, 0xB8, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x01, 0xF0, 0x7C, 0x00,
-    0x03, 0xD0, 0x2E, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x03, 0xFC,
-    0xBC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x14, 0x00, 0x05, 0x02, 0xF0, 0x02, 0xF0, 0x0F,
-    0x40, 0x3C, 0x00, 0x7C, 0x0F, 0x40, 0x02, 0xF2, 0xF0, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0x3E, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0xF8,
-    0x07, 0xC0, 0x1F, 0x00, 0x2F, 0x93, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x3C, 0x00, 0x01, 0xE0, 0xBC,
-    0x00, 0x0F, 0x40, 0xF4, 0x00, 0xB8, 0x01, 0xF0, 0x07, 0xC0, 0x02, 0xE0, 0x3D, 0x00, 0x03, 0xD2,
-    0xE0, 0x00, 0x07, 0xDF, 0x00, 0x01, 0x5F, 0xF9, 0x50, 0x1F, 0xFF, 0xFF, 0xC0, 0x6A, 0xFF, 0xAA,
-    0x00, 0x03, 0xEF, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x0F, 0x40, 0xB8, 0x00,
-    0xB8, 0x00, 0xF4, 0x07, 0xC0, 0x02, 0xF0, 0x3D, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x07, 0xC0, 0x14,
-    0x00, 0x05, 0x0B, 0xC0, 0x0B, 0xC0, 0xF4, 0x03, 0xC0, 0x1F, 0x03, 0xD0, 0x02, 0xF2, 0xE0, 0x00,
-    0x3E, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7C, 0xF8, 0x00,
-    0x3D, 0x0F, 0x40, 0x3E, 0x01, 0xF0, 0x1F, 0x00, 0x2E, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x0D,
-    0x00, 0x0D, 0x2F, 0xFC, 0xA0, 0xD2, 0x8C, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00,
-    0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0xC0, 0x0F, 0xFE, 0x1C, 0x28, 0x1C, 0xA0, 0x02,
-    0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A,
-    0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0x00, 0xAA, 0xA3, 0xFF, 0xC5, 0x55,
-    0x00, 0xAA, 0xA3, 0xFF, 0xC5, 0x55, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xD0, 0xAA, 0xAA,
-    0xA7, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
-    0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
-    0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
-    0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0x00, 0x00, 0x15,
-    0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x2A, 0xAA,
-    0xA8, 0x0B, 0x03, 0xC2, 0xE0, 0xF4, 0x7C, 0x2F, 0x01, 0x00, 0x1F, 0x0B, 0xC3, 0xD0, 0xF0, 0x78,
-    0x2D, 0x01, 0x00, 0x0F, 0x43, 0xC1, 0xF0, 0xB8, 0x3C, 0x0E, 0x01, 0x00, 0xBC, 0x1F, 0x03, 0xD0,
-    0xB4, 0x1E, 0x03, 0xC0, 0x10, 0x0B, 0x03, 0x43, 0x82, 0xD2, 0xE0, 0xF0, 0xF4, 0x7C, 0x7C, 0x2E,
-    0x2F, 0x0F, 0x81, 0x01, 0x40, 0x1F, 0x0F, 0x4B, 0x83, 0xD3, 0xD1, 0xF0, 0xF0, 0x78, 0x78, 0x2D,
-    0x2C, 0x0F, 0x01, 0x01, 0x00, 0x0F, 0x47, 0xC0, 0xF0, 0xBC, 0x1F, 0x0F, 0x82, 0xE0, 0xF0, 0x3C,
-    0x0E, 0x03, 0x81, 0xD0, 0x10, 0x04, 0x00, 0xB8, 0x3D, 0x1F, 0x0F, 0x83, 0xC1, 0xF0, 0xB4, 0x3C,
-    0x1E, 0x0B, 0x43, 0xC1, 0xD0, 0x10, 0x10, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x70, 0x01, 0xFF, 0xFF, 0xC7, 0xAB, 0xAF, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00,
-    0x01, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xB0, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40,
-    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x02,
-    0xD0, 0x00, 0x0B, 0x40, 0x00, 0x1C, 0x00, 0x69, 0xB5, 0xA2, 0xFF, 0xFF, 0xD1, 0x07, 0x05, 0x00,
-    0x2D, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x2C, 0x00, 0x10, 0x70, 0x52,
-    0xFF, 0xFF, 0xD6, 0x9B, 0x5A, 0x00, 0x1C, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x4F, 0xFD, 0x3F, 0xF4, 0xFF, 0xC0, 0xBD, 0x00, 0x60, 0x00,
-    0x7D, 0x00, 0x7F, 0xD0, 0x7F, 0xF8, 0x7F, 0xE0, 0x7F, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x7F, 0x3E, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xD3, 0xF0, 0x1F, 0x8F, 0x80, 0x7D, 0x04, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x7C, 0x02, 0xE3, 0xF0, 0x2F, 0x40, 0xFC, 0xF8, 0x07,
-    0xD0, 0x3F, 0x04, 0x00, 0x40, 0x01, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x02, 0xFF, 0xDA,
-    0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28,
-    0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00,
-    0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xFF, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x3E, 0xB8, 0x00, 0x78, 0x00, 0x00, 0x00, 0x74, 0x2C, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xB0, 0x1D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0xB0, 0x0E, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0,
-    0x0E, 0x0B, 0x40, 0x00, 0x00, 0x00, 0xB0, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x1D, 0x2C,
-    0x2F, 0x80, 0x1F, 0xD0, 0x78, 0x2C, 0x78, 0xFB, 0xE0, 0x7E, 0xF0, 0x3E, 0xBC, 0xF1, 0xE0, 0xF0,
-    0xF0, 0x38, 0x0F, 0xE1, 0xE2, 0xC0, 0x74, 0xF0, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x74, 0xE0, 0x2C,
-    0x00, 0x07, 0x43, 0xC0, 0x78, 0xE0, 0x2C, 0x00, 0x0F, 0x03, 0xC0, 0x78, 0xE0, 0x2C, 0x00, 0x2D,
-    0x02, 0xC0, 0x74, 0xF0, 0x3C, 0x00, 0x3C, 0x01, 0xD0, 0xB0, 0xF0, 0x3C, 0x00, 0xB0, 0x00, 0xF6,
-    0xF0, 0x79, 0xF4, 0x01, 0xE0, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xB4, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x1E, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x03, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xE0, 0x74, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x78, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x1E, 0x2D, 0x2F, 0x80,
-    0x0B, 0xE0, 0x07, 0xF4, 0x1E, 0x0B, 0x4F, 0x2F, 0xFC, 0x0F, 0xFE, 0x03, 0xFF, 0x43, 0xEB, 0xCB,
-    0x0F, 0x0B, 0x47, 0x83, 0xC2, 0xD0, 0xF0, 0x3F, 0x83, 0x87, 0x40, 0xF2, 0xC0, 0x78, 0xF0, 0x2C,
-    0x00, 0x02, 0xC2, 0xD0, 0x3C, 0xF0, 0x1E, 0x3C, 0x0B, 0x40, 0x01, 0xE0, 0xB4, 0x0F, 0x3C, 0x03,
-    0x8F, 0x01, 0xD0, 0x00, 0xF0, 0x2D, 0x03, 0xCF, 0x01, 0xE3, 0xC0, 0xB4, 0x00, 0x74, 0x07, 0x40,
-    0xF2, 0xC0, 0x78, 0xF0, 0x2D, 0x00, 0x3C, 0x00, 0xE0, 0x78, 0x74, 0x2D, 0x3C, 0x0F, 0x00, 0x2D,
-    0x00, 0x3E, 0x7C, 0x0F, 0x6F, 0x07, 0xDB, 0x80, 0x0F, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01,
-    0xD0, 0x0E, 0x00, 0x70, 0x02, 0x40, 0x00, 0x00, 0xF0, 0xB8, 0x07, 0x83, 0xC0, 0x3C, 0x2D, 0x01,
-    0xD0, 0xF0, 0x0E, 0x0B, 0x00, 0x70, 0x38, 0x02, 0x41, 0x80, 0x00, 0x00, 0xF0, 0xB4, 0x3C, 0x01,
-    0xE0, 0xF0, 0xB4, 0x03, 0xC2, 0xD0, 0xF0, 0x07, 0x43, 0xC2, 0xC0, 0x0E, 0x0B, 0x03, 0x80, 0x1C,
-    0x0E, 0x0B, 0x00, 0x24, 0x18, 0x08, 0x00, 0x78, 0x03, 0xD0, 0x0F, 0x00, 0xB4, 0x03, 0xC0, 0x1D,
-    0x00, 0x50, 0x78, 0x78, 0x03, 0xD2, 0xD0, 0x0F, 0x0F, 0x00, 0xB4, 0x74, 0x03, 0xC3, 0xC0, 0x1D,
-    0x0D, 0x00, 0x50, 0x50, 0x78, 0x78, 0x3C, 0x03, 0xD2, 0xD2, 0xD0, 0x0F, 0x0F, 0x0F, 0x00, 0xB4,
-    0x74, 0x74, 0x03, 0xC3, 0xC3, 0xC0, 0x1D, 0x0D, 0x0D, 0x00, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x01, 0xF4, 0x00, 0x3A, 0xC0, 0x07, 0x0D, 0x00, 0xE0, 0xA0, 0x1D, 0x03, 0x03, 0xC0,
-    0x38, 0x74, 0x01, 0xC0, 0x00, 0x80, 0x3D, 0x0B, 0x82, 0xF0, 0x7C, 0x0F, 0x40, 0x3C, 0x01, 0xF0,
-    0x0B, 0xC0, 0x2E, 0x00, 0x40, 0x08, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF4, 0x01, 0xF0, 0x02, 0xE0,
-    0x1F, 0x01, 0xF0, 0x0F, 0x40, 0xF4, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02,
-    0xD0, 0x00, 0x43, 0xC0, 0x0F, 0x80, 0x0F, 0x07, 0xC0, 0x2D, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x0F,
-    0x40, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x10,
-    0x07, 0xDF, 0x40, 0x12, 0xF0, 0x07, 0xF4, 0x03, 0xEB, 0xC0, 0x0F, 0xC0, 0x0F, 0x89, 0x00, 0xFB,
-    0xC0, 0x18, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x07, 0xC0,
-    0x00, 0xF4, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x60, 0x07, 0xC0, 0xF4, 0x03, 0xE0, 0x07, 0xC2, 0x40,
-    0x0F, 0x80, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3E, 0x03, 0xD3, 0xE0, 0x3D, 0x3E, 0x03, 0xD3,
-    0xE0, 0x3D, 0x3D, 0x03, 0xC2, 0xD0, 0x3C, 0x2D, 0x03, 0xC2, 0xD0, 0x3C, 0x2D, 0x03, 0xC2, 0xC0,
-    0x3C, 0x1C, 0x02, 0xC1, 0xC0, 0x2C, 0x1C, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3D,
-    0x3F, 0x07, 0xE3, 0xE0, 0x7D, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x07, 0xFE, 0xBD,
-    0x04, 0xF4, 0x3C, 0x02, 0xD0, 0xB4, 0x0B, 0x42, 0xD0, 0x2D, 0x0F, 0x00, 0xB4, 0x7C, 0x02, 0xC7,
-    0xC0, 0x0B, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x10, 0x00, 0x2A,
-    0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xD2, 0x80, 0x00,
-    0x0B, 0x03, 0xC0, 0x00, 0xB0, 0x03, 0xE5, 0x6F, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x2B, 0xA4,
-    0x00, 0x0B, 0xEA, 0xFC, 0x00, 0xB4, 0x00, 0x3C, 0x0B, 0x00, 0x00, 0x2C, 0x30, 0x00, 0x00, 0x34,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x0D, 0x00,
-    0x0B, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x74, 0x00, 0x3E, 0x00, 0x0E, 0xC0, 0x0B,
-    0x34, 0x03, 0x4B, 0x02, 0xC0, 0xD0, 0xE0, 0x28, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x3C, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x7D, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x7D, 0x2C, 0x6F, 0x00, 0xF9, 0x34, 0xBD, 0xBF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFD, 0x01, 0xBF, 0x40, 0x00, 0x05, 0xFD, 0x40, 0x00, 0xFB, 0x40, 0x00, 0x01, 0xEE, 0x00,
-    0x02, 0xE3, 0xC0, 0x00, 0x03, 0xCB, 0x80, 0x07, 0xC2, 0xF0, 0x00, 0x0F, 0x83, 0xD0, 0x0B, 0x80,
-    0xF0, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0xAA, 0xA3, 0xFF, 0xC5,
-    0x55, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x38, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x03, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF,
-    0xD3, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xFF,
-    0x4F, 0xFD, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-    0x3F, 0xF4, 0xFF, 0xD0, 0x7F, 0xF1, 0xFF, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD7, 0xFF, 0x5F, 0xFD, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D,
-    0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x7F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0x80, 0x2F, 0xFE, 0x0B, 0xFF, 0xFD, 0x3F, 0xFF, 0xF0, 0x90, 0x0B, 0xC5, 0x00, 0x7D,
-    0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xB8,
-    0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x7D, 0x00,
-    0x0F, 0x80, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x2D, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0x00, 0x00,
-    0x74, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0xBC, 0xBF, 0xFF, 0xD0, 0xBC,
-    0x24, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0xF0, 0xBC, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0x00, 0xF0, 0x78,
-    0x00, 0x02, 0xE0, 0x78, 0x00, 0x0B, 0xC0, 0x78, 0x00, 0x3F, 0x00, 0x78, 0x00, 0xF8, 0x00, 0x74,
-    0x01, 0xF0, 0x00, 0x34, 0x01, 0xD0, 0x00, 0x34, 0x01, 0xD0, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0xB8, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x06, 0xFF, 0xD0, 0x3E, 0x1F, 0xFF, 0xF4,
-    0x3E, 0x09, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x2D, 0x2D, 0x00, 0x00, 0x3D,
-    0x2D, 0x00, 0x00, 0xBC, 0x2D, 0x00, 0x02, 0xF0, 0x2D, 0x00, 0x0B, 0xC0, 0x2C, 0x00, 0x2F, 0x00,
-    0x1C, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0xBC, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0x15, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0xB8, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07,
-    0xC0, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x2D, 0x7F, 0xFF, 0x4B, 0x0B, 0xFF, 0xF2, 0xC2, 0xFF, 0xFD, 0xB0,
-    0xBF, 0xFF, 0xAC, 0x2F, 0xFF, 0xEB, 0x0B, 0xFF, 0xFA, 0xC2, 0xFF, 0xFE, 0xB0, 0xBF, 0xFF, 0x6C,
-    0x2F, 0xFF, 0xCB, 0x0B, 0xFF, 0xE2, 0xC2, 0xFF, 0xE0, 0xB0, 0xB5, 0x40, 0x2C, 0x2C, 0x00, 0x0B,
-    0x0B, 0x00, 0x02, 0xC2, 0xC0, 0x00, 0xB0, 0xB0, 0x00, 0x2C, 0x2C, 0x00, 0x0B, 0x0B, 0x00, 0x02,
-    0xC2, 0xC0, 0x00, 0xB0, 0xB0, 0x00, 0x2C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x42, 0xFF, 0xFF, 0xF2, 0xFF, 0xFD, 0x7C, 0xFF, 0xFF, 0x0F, 0x7F, 0xFF, 0xC3, 0xEF, 0xFF, 0xF0,
-    0xFB, 0xFF, 0xFC, 0x3E, 0xFF, 0xFF, 0x0F, 0xBF, 0xFF, 0xC3, 0xDF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFC,
-    0x3C, 0x7F, 0xFF, 0xAF, 0x06, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x3F, 0xFF,
-    0xFE, 0x0F, 0x5F, 0xFF, 0xE3, 0x83, 0xFF, 0xFC, 0xE0, 0xFF, 0xFF, 0x78, 0x3F, 0xFF, 0xEE, 0x0F,
-    0xFF, 0xFB, 0x83, 0xFF, 0xFE, 0xE0, 0xFF, 0xFF, 0xB8, 0x3F, 0xFF, 0xDE, 0x0F, 0xFF, 0xF3, 0xEB,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x40, 0x38, 0x04, 0xFE, 0x79, 0xFE, 0xBF, 0xFF, 0xFE, 0x00, 0xFD, 0x00, 0x01, 0xEF,
-    0x00, 0x03, 0xC7, 0xC0, 0x0F, 0x83, 0xE0, 0x0B, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x68, 0x3F, 0x0F,
-    0xC0, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x0F, 0x42, 0xE0,
-    0x3C, 0x0F, 0x00, 0x00, 0x00, 0x2B, 0xA4, 0x00, 0x0B, 0xEA, 0xFC, 0x00, 0xB4, 0x00, 0x3C, 0x0B,
-    0x00, 0x00, 0x2C, 0x30, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xD2, 0x80, 0x00, 0x0B, 0x03, 0xC0, 0x00, 0xB0, 0x03, 0xE5,
-    0x6F, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x40,
-    0x38, 0x04, 0xFE, 0x79, 0xFE, 0xBF, 0xFF, 0xFE, 0x00, 0xFD, 0x00, 0x01, 0xEF, 0x00, 0x03, 0xC7,
-    0xC0, 0x0F, 0x83, 0xE0, 0x0B, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x40, 0x38, 0x04, 0xFE, 0x79, 0xFE, 0xBF, 0xFF, 0xFE, 0x00,
-    0xFD, 0x00, 0x01, 0xEF, 0x00, 0x03, 0xC7, 0xC0, 0x0F, 0x83, 0xE0, 0x0B, 0x01, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3C, 0xFC, 0x07, 0x87, 0x80, 0xB0, 0x00, 0x0F, 0x00, 0x02, 0xD0,
-    0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x07,
-    0x80, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x07, 0x83, 0x80, 0xBC, 0xB4, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x02, 0xC0, 0xF5,
-    0x6F, 0xFE, 0x40, 0x2D, 0x0B, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x20, 0x00, 0x00, 0x06, 0xA8, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x78, 0x00, 0x78, 0x07, 0x40, 0x00, 0x38, 0x34,
-    0x00, 0x00, 0x34, 0x80, 0x00, 0x00, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0B, 0x0B,
-    0x0B, 0x00, 0x7C, 0xB2, 0xD0, 0x01, 0xFF, 0xB4, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD2,
-    0xAB, 0xFE, 0xA8, 0x00, 0xBF, 0xF0, 0x00, 0x2D, 0xB7, 0xC0, 0x0B, 0x4B, 0x1F, 0x00, 0x10, 0xB0,
-    0x50, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1F,
-    0x80, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x14, 0x00,
-    0xF0, 0xB4, 0x78, 0x3C, 0x01, 0xE0, 0xF0, 0xF0, 0xB4, 0x03, 0xC2, 0xC1, 0xD0, 0xE0, 0x07, 0x43,
-    0x83, 0xC2, 0xC0, 0x0E, 0x0B, 0x07, 0x03, 0x40, 0x1C, 0x0D, 0x0E, 0x0B, 0x00, 0x24, 0x18, 0x08,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x42, 0xF0, 0x00, 0x00,
-    0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x2F, 0x09, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x4A,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x92, 0xF0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x7C, 0xBC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0xBC, 0x7C, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x01, 0x92, 0xF0, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x2F, 0x04, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8, 0x0F,
-    0x02, 0xF0, 0x03, 0xF0, 0x3C, 0x0F, 0xC0, 0x0B, 0x40, 0xF0, 0x1D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x18, 0x03, 0xC0, 0x60, 0x00, 0xF8, 0x0F, 0x03, 0xE0, 0x03, 0xE0, 0x3C, 0x0F, 0x80,
-    0x01, 0x00, 0xF0, 0x04, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x04, 0x3F,
-    0x3F, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E,
-    0x04, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x3E, 0x3F, 0x3E, 0x04,
-    0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x0B, 0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x3F, 0xC1, 0xF4, 0x0F, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0x02, 0xF8, 0x3F, 0xCB,
-    0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x35, 0xCA, 0x0A, 0x2A,
-    0x80, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x40, 0x03, 0xFE, 0x03,
-    0xE6, 0xD0, 0xE0, 0x3C, 0x74, 0x0B, 0x2D, 0x02, 0xCB, 0x40, 0xB1, 0xD0, 0x2C, 0x78, 0x0F, 0x0F,
-    0x07, 0x81, 0xFF, 0xC0, 0x1B, 0x80, 0x0B, 0x10, 0xBB, 0xBB, 0xBB, 0xBA, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x07, 0x3C, 0x03, 0x8F, 0x03, 0xC3, 0xC1, 0xD5, 0xF4, 0xFF, 0xFF,
-    0x80, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xA0, 0x00, 0x00, 0x2F, 0xFD, 0x2D, 0x54, 0x38, 0x00, 0x38,
-    0x00, 0x3F, 0xF8, 0x15, 0x7E, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x7E, 0xBD, 0x1B, 0xE0, 0x00,
-    0x14, 0x01, 0xFF, 0x41, 0xF4, 0x00, 0xF0, 0x00, 0x34, 0x40, 0x1E, 0xFF, 0x47, 0xD1, 0xF1, 0xD0,
-    0x1C, 0x74, 0x07, 0x4F, 0x03, 0xC1, 0xFB, 0xE0, 0x1B, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xC1, 0x55,
-    0xF0, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x00, 0xF0,
-    0x00, 0xB4, 0x00, 0x28, 0x00, 0x00, 0x40, 0x03, 0xFF, 0x03, 0xD1, 0xE0, 0xE0, 0x3C, 0x3D, 0x1E,
-    0x03, 0xFE, 0x00, 0xFF, 0xC0, 0xF0, 0x7C, 0x74, 0x0B, 0x1E, 0x03, 0xC3, 0xEB, 0xE0, 0x1B, 0x90,
-    0x01, 0x40, 0x07, 0xFE, 0x03, 0xC1, 0xE1, 0xC0, 0x2C, 0xB0, 0x0B, 0x1D, 0x03, 0xC3, 0xEB, 0xF0,
-    0x2A, 0x6C, 0x00, 0x0F, 0x00, 0x0B, 0x42, 0xAF, 0x80, 0x7E, 0x40, 0x00, 0x40, 0x01, 0xC0, 0x01,
-    0xC0, 0x2A, 0xE9, 0x3F, 0xFD, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x40, 0x2A, 0xA9, 0x3F, 0xFD, 0x3F,
-    0xFE, 0x15, 0x54, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x06, 0x03, 0x82, 0xC0, 0xE0, 0x34, 0x1C,
-    0x07, 0x01, 0xC0, 0x70, 0x0D, 0x03, 0x80, 0xB0, 0x0E, 0x01, 0x80, 0x60, 0x0E, 0x01, 0xC0, 0x38,
-    0x0F, 0x02, 0xC0, 0x70, 0x1C, 0x0B, 0x02, 0xC0, 0xE0, 0x70, 0x38, 0x18, 0x00, 0x00, 0x50, 0xAF,
-    0xFC, 0xB4, 0x0E, 0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0xA0, 0x0A, 0x00,
-    0x40, 0x03, 0xFE, 0x03, 0xE6, 0xD0, 0xE0, 0x3C, 0x74, 0x0B, 0x2D, 0x02, 0xCB, 0x40, 0xB1, 0xD0,
-    0x2C, 0x78, 0x0F, 0x0F, 0x07, 0x81, 0xFF, 0xC0, 0x1B, 0x80, 0x00, 0x00, 0x2F, 0x0F, 0xF3, 0xCB,
-    0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x06, 0x01, 0x40, 0x2F, 0xF8,
-    0x38, 0x2D, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0xB4, 0x02, 0xD0, 0x0B, 0x40, 0x2D, 0x00,
-    0x7F, 0xFE, 0x2A, 0xA9, 0x01, 0x40, 0x0B, 0xFE, 0x03, 0x42, 0xE0, 0x00, 0x38, 0x00, 0x1D, 0x02,
-    0xBE, 0x00, 0xBF, 0xC0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xCB, 0xEB, 0xD0, 0xAF, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x07, 0x3C, 0x03, 0x8F, 0x03, 0xC3, 0xC1, 0xD5,
-    0xF4, 0xFF, 0xFF, 0x80, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xA0, 0x00, 0x00, 0x2F, 0xFD, 0x2D, 0x54,
-    0x38, 0x00, 0x38, 0x00, 0x3F, 0xF8, 0x15, 0x7E, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x7E, 0xBD,
-    0x1B, 0xE0, 0x00, 0x14, 0x01, 0xFF, 0x41, 0xF4, 0x00, 0xF0, 0x00, 0x34, 0x40, 0x1E, 0xFF, 0x47,
-    0xD1, 0xF1, 0xD0, 0x1C, 0x74, 0x07, 0x4F, 0x03, 0xC1, 0xFB, 0xE0, 0x1B, 0x90, 0x00, 0x00, 0x1F,
-    0xFF, 0xC1, 0x55, 0xF0, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x02,
-    0xC0, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x28, 0x00, 0x00, 0x40, 0x03, 0xFF, 0x03, 0xD1, 0xE0, 0xE0,
-    0x3C, 0x3D, 0x1E, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0xF0, 0x7C, 0x74, 0x0B, 0x1E, 0x03, 0xC3, 0xEB,
-    0xE0, 0x1B, 0x90, 0x01, 0x40, 0x07, 0xFE, 0x03, 0xC1, 0xE1, 0xC0, 0x2C, 0xB0, 0x0B, 0x1D, 0x03,
-    0xC3, 0xEB, 0xF0, 0x2A, 0x6C, 0x00, 0x0F, 0x00, 0x0B, 0x42, 0xAF, 0x80, 0x7E, 0x40, 0x00, 0x40,
-    0x01, 0xC0, 0x01, 0xC0, 0x2A, 0xE9, 0x3F, 0xFD, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x40, 0x2A, 0xA9,
-    0x3F, 0xFD, 0x3F, 0xFE, 0x15, 0x54, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x06, 0x03, 0x82, 0xC0,
-    0xE0, 0x34, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x0D, 0x03, 0x80, 0xB0, 0x0E, 0x01, 0x80, 0x60, 0x0E,
-    0x01, 0xC0, 0x38, 0x0F, 0x02, 0xC0, 0x70, 0x1C, 0x0B, 0x02, 0xC0, 0xE0, 0x70, 0x38, 0x18, 0x00,
-    0x06, 0xE4, 0x09, 0x5D, 0x00, 0x0B, 0x01, 0x5F, 0x1E, 0xAF, 0x34, 0x0B, 0x34, 0x0F, 0x3E, 0xBB,
-    0x06, 0x41, 0x02, 0xE4, 0x03, 0x97, 0x83, 0x80, 0x70, 0xE5, 0x6D, 0x3E, 0xAA, 0x0E, 0x00, 0x02,
-    0xC0, 0x00, 0x3E, 0xAC, 0x01, 0xA4, 0x00, 0x02, 0xF8, 0x03, 0x97, 0xC3, 0xC0, 0x38, 0xD0, 0x0B,
-    0x34, 0x02, 0xCE, 0x00, 0xB2, 0xC0, 0x38, 0x3E, 0xB8, 0x01, 0xA4, 0x00, 0x20, 0x06, 0x0B, 0x07,
-    0x40, 0xE3, 0x80, 0x0F, 0x80, 0x03, 0xD0, 0x01, 0xEC, 0x01, 0xD2, 0xC0, 0xE0, 0x38, 0x10, 0x01,
-    0x00, 0x1B, 0xE0, 0x0A, 0x5B, 0x40, 0x00, 0xB0, 0x00, 0x1C, 0x3F, 0xFF, 0x4D, 0x01, 0xC3, 0x80,
-    0xB0, 0x7A, 0xF0, 0x01, 0x90, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB2, 0xE4, 0xBD, 0x6D,
-    0xB0, 0x0E, 0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0x50, 0x05, 0xB0, 0x00,
-    0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x18, 0xB0, 0xB0, 0xB2, 0xC0, 0xBB, 0x00, 0xBF, 0x40, 0xB2, 0xC0,
-    0xB0, 0xB0, 0xB0, 0x3C, 0x50, 0x04, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB5, 0x52, 0xE0, 0xBD, 0x2F,
-    0x5F, 0xE5, 0xEB, 0x00, 0xE0, 0x2E, 0xC0, 0x34, 0x0B, 0xB0, 0x0D, 0x02, 0xEC, 0x03, 0x40, 0xBB,
-    0x00, 0xD0, 0x2E, 0xC0, 0x34, 0x0B, 0x50, 0x04, 0x00, 0x40, 0x52, 0xE4, 0xBD, 0x6D, 0xB0, 0x0E,
-    0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0x50, 0x05, 0x52, 0xE0, 0x2F, 0x5B,
-    0x4B, 0x00, 0xF2, 0xC0, 0x1C, 0xB0, 0x07, 0x2C, 0x02, 0xCB, 0x40, 0xE2, 0xFA, 0xF0, 0xB1, 0x90,
-    0x2C, 0x00, 0x0B, 0x00, 0x02, 0xC0, 0x00, 0x0B, 0xE4, 0x39, 0x64, 0x34, 0x00, 0x2E, 0x00, 0x06,
-    0xF0, 0x00, 0x3C, 0x00, 0x1C, 0x3A, 0xB8, 0x16, 0x40, 0x04, 0x01, 0xC0, 0x7E, 0x96, 0xD4, 0x2C,
-    0x02, 0xC0, 0x2C, 0x02, 0xC0, 0x1C, 0x00, 0xF9, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x0B, 0xEB, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C,
-    0x01, 0x55, 0x43, 0xC0, 0x3F, 0xFD, 0x3C, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x2F, 0x03, 0xC0,
-    0x00, 0xFD, 0x7D, 0x54, 0x02, 0xFF, 0xFF, 0xC0, 0x01, 0x7D, 0x54, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3E, 0xA8, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x0B, 0x0E,
-    0x00, 0x03, 0x83, 0x40, 0x02, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x0F, 0xFC, 0x3E, 0x0B, 0xCB, 0x0E,
-    0x03, 0xD3, 0x83, 0x41, 0xF0, 0xE1, 0xC0, 0xB8, 0x74, 0xB0, 0x2E, 0x1C, 0x38, 0x0B, 0x4B, 0x0E,
-    0x02, 0xE3, 0x83, 0x40, 0x7C, 0xE1, 0xC0, 0x0F, 0x74, 0xB0, 0x03, 0xFC, 0x38, 0x00, 0x7F, 0x0E,
-    0x00, 0x07, 0xFF, 0xEF, 0x00, 0xFF, 0xFF, 0xC0, 0x74, 0xB0, 0x00, 0x1C, 0x38, 0x00, 0x05, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x2F, 0x40, 0x14, 0x1F,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x0E, 0x7F, 0x2E,
-    0x03, 0xFF, 0xCB, 0x80, 0xFC, 0x02, 0xE0, 0x3C, 0x00, 0x7C, 0x0F, 0x00, 0x0F, 0x03, 0xC0, 0x03,
-    0xD0, 0xF0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xDF, 0x00, 0x00, 0xFF, 0xEF, 0x80, 0x0B, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F,
-    0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xEA, 0xA9, 0x0F, 0xFF,
-    0xFD, 0x0F, 0x95, 0x54, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x00,
-    0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFF, 0x80, 0x0F, 0x40, 0x10, 0x01, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x02, 0xBF, 0xAA, 0x40, 0x02, 0xE0, 0x00, 0x01,
-    0x7E, 0x55, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0x7E, 0x55, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x50, 0x6A, 0x43, 0xDA, 0x40,
-    0xF3, 0xFF, 0xE7, 0xFF, 0xF0, 0xFF, 0x46, 0xFF, 0x91, 0xFC, 0xFC, 0x00, 0xBE, 0x00, 0x3C, 0xF8,
-    0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0xF4, 0x00,
-    0xFC, 0x00, 0x3D, 0xF4, 0x02, 0xFC, 0x00, 0x3D, 0xF4, 0x03, 0xFC, 0x00, 0x3D, 0xF4, 0x0B, 0xBC,
-    0x00, 0x3D, 0xF4, 0x0E, 0x7C, 0x00, 0x3D, 0xF4, 0x2C, 0x7C, 0x00, 0x3D, 0xF4, 0x3C, 0x7C, 0x00,
-    0x3D, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x0B, 0x00, 0x3F, 0x40, 0x3C, 0x00, 0xFE, 0x00, 0xF0, 0x03, 0xFC, 0x03, 0xC0, 0x0F,
-    0xB4, 0x0F, 0x00, 0x3C, 0xF0, 0x3C, 0x0A, 0xFB, 0xEA, 0xFA, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0x0F,
-    0x0F, 0x00, 0x3C, 0x2D, 0x3C, 0x0F, 0xFF, 0xFF, 0xFF, 0x1B, 0xEA, 0xFB, 0xE8, 0x0F, 0x02, 0xDF,
-    0x00, 0x3C, 0x03, 0xFC, 0x00, 0xF0, 0x0F, 0xF0, 0x03, 0xC0, 0x1F, 0xC0, 0x0F, 0x00, 0x3F, 0x00,
-    0x3C, 0x00, 0xBC, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3C, 0x07, 0xF0,
-    0x00, 0x03, 0xC0, 0x1F, 0x40, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0x83, 0x40, 0x3C,
-    0x00, 0xF4, 0x74, 0x03, 0xC0, 0x0F, 0x0B, 0x94, 0x3C, 0x07, 0xE7, 0xFF, 0xC3, 0xFF, 0xFC, 0x1F,
-    0x94, 0x3F, 0xFD, 0x00, 0xB4, 0x03, 0xC0, 0x00, 0x0B, 0x40, 0x3C, 0x00, 0x00, 0xB4, 0x03, 0xC0,
-    0x00, 0x0B, 0x40, 0x3C, 0x00, 0x00, 0xB4, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x00, 0x7E,
-    0x93, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0xF0, 0x1F, 0x80, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x6A,
-    0x4F, 0x00, 0x3C, 0x2F, 0xFE, 0xF0, 0x03, 0xC7, 0xD1, 0x8F, 0x00, 0xB8, 0xB8, 0x00, 0xF5, 0x6F,
-    0x0B, 0x80, 0x0F, 0xFF, 0xD0, 0x3E, 0x00, 0xFA, 0xF8, 0x02, 0xFD, 0x0F, 0x03, 0xC0, 0x07, 0xF8,
-    0xF0, 0x2E, 0x00, 0x0B, 0xDF, 0x01, 0xF0, 0x00, 0x2F, 0xF0, 0x0F, 0x40, 0x01, 0xFF, 0x00, 0x7C,
-    0x40, 0x2E, 0xF0, 0x03, 0xDB, 0xAB, 0xDF, 0x00, 0x2E, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x02, 0xE0, 0x0B, 0x1E, 0x00, 0xFC, 0x03, 0xC3, 0xC0, 0x3F, 0x00, 0xF0, 0xF0, 0x1E, 0xC0,
-    0x38, 0x3C, 0x0B, 0x74, 0x1E, 0x0B, 0x42, 0xCE, 0x0B, 0x41, 0xD0, 0xF3, 0x82, 0xC0, 0x78, 0x38,
-    0xF0, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x6B, 0xEF, 0xEF, 0xFF, 0x90, 0xF2, 0xC1, 0xD3, 0x80, 0x2C,
-    0xF0, 0x39, 0xD0, 0x07, 0x7C, 0x0E, 0x70, 0x00, 0xEE, 0x02, 0xEC, 0x00, 0x3F, 0x40, 0xBF, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0xBF, 0xFE, 0x40,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF0, 0x01, 0xF4, 0x0F, 0xF0, 0x00, 0x7C, 0x0F, 0xF0, 0x10, 0x3C,
-    0x0F, 0xF0, 0x78, 0x3C, 0x0F, 0xF0, 0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x3D,
-    0x0F, 0xF0, 0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x3D,
-    0x0F, 0xF0, 0x78, 0x14, 0x0F, 0xF0, 0x78, 0x00, 0x2E, 0xF0, 0x78, 0x00, 0x7C, 0xF0, 0x7E, 0xAB,
-    0xF4, 0xF0, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xA4, 0x3D, 0x00, 0x7F, 0xFD, 0xF4, 0x07,
-    0xE5, 0x7F, 0xD0, 0x3E, 0x00, 0x3F, 0x41, 0xF0, 0x00, 0x7D, 0x07, 0xC0, 0x00, 0xF4, 0x2E, 0x00,
-    0x03, 0xD0, 0xB8, 0x00, 0x0F, 0x42, 0xE0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x07,
-    0xD0, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0xAB, 0xFD, 0x00, 0x2F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xD0, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x01, 0xBD, 0x55, 0x40, 0x7F, 0xFF, 0xFC, 0x01, 0xB9, 0x55, 0x00, 0x0B,
-    0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x1E, 0x00, 0x1F, 0x00, 0x78, 0x01, 0xF0, 0x01, 0xE0, 0x0F,
-    0x40, 0x07, 0x80, 0xF8, 0x00, 0x1E, 0x0B, 0x80, 0x00, 0x78, 0x7C, 0x00, 0x01, 0xE7, 0xC0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC1, 0xBF, 0xFF, 0xAA, 0x00, 0x7D, 0x7C, 0x00, 0x01, 0xE0, 0xB8, 0x00, 0x07,
-    0x80, 0xF4, 0x00, 0x1E, 0x01, 0xF0, 0x00, 0x78, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xE0, 0x07, 0x80,
-    0x07, 0xC0, 0x1E, 0x00, 0x0B, 0xC0, 0x7F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x45, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xF4, 0xF0, 0x0B, 0x8F, 0xBD, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x07, 0xDF, 0x40, 0x00, 0x20, 0xF4, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x00, 0x01,
-    0xE0, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x01, 0xF0, 0x01, 0x00, 0x07, 0xC0, 0x02, 0xE0, 0x7F, 0xF0, 0x07, 0x80, 0x03,
-    0xD0, 0xF9, 0xFC, 0x0B, 0x40, 0x0B, 0xC3, 0xE0, 0x3D, 0x0F, 0x40, 0x0F, 0x43, 0xC0, 0x3D, 0x0F,
-    0x00, 0x7E, 0x07, 0xC0, 0x3C, 0x1F, 0x06, 0xFC, 0x0B, 0x80, 0xBC, 0x2F, 0xFF, 0xE0, 0x0F, 0xEB,
-    0xF4, 0x2F, 0xF9, 0x00, 0x0F, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x7E, 0xF4, 0x00, 0x3D, 0x1E, 0x00, 0x0F, 0x03, 0xC0, 0x03, 0xC0, 0xF0, 0x00,
-    0xF0, 0x78, 0x00, 0x2D, 0x2D, 0x00, 0x07, 0x8F, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x3F, 0xC0, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0xA0, 0xBE, 0x00, 0x7C, 0x3F, 0xC0, 0x3F, 0xBC, 0xB4, 0x1E,
-    0xBE, 0x1F, 0x0F, 0x0F, 0x03, 0xC7, 0x82, 0x40, 0xB4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0x90,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0xB8, 0x07, 0xE0, 0x06, 0xE5, 0x5B, 0xD4, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x2E, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0xB4, 0x2B, 0xFA, 0xAB, 0xF8, 0x6F, 0xEA, 0xBF, 0xA0, 0x2E,
-    0x00, 0xF8, 0x00, 0xBE, 0xBF, 0xC0, 0x02, 0xFF, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xF8, 0xB0,
-    0x64, 0x0F, 0xC0, 0xB0, 0x00, 0x2F, 0x00, 0xB0, 0x00, 0x3E, 0x00, 0xB0, 0x00, 0x3C, 0x00, 0xB0,
-    0x00, 0x7C, 0x00, 0xB0, 0x00, 0x7C, 0x00, 0xB5, 0x54, 0x7C, 0x00, 0xBF, 0xFD, 0x7C, 0x00, 0xBA,
-    0xBD, 0x7C, 0x00, 0xB0, 0x3D, 0x3D, 0x00, 0xB0, 0x3D, 0x2F, 0x00, 0xB0, 0x3D, 0x0F, 0x80, 0xB0,
-    0x3D, 0x07, 0xF4, 0xB0, 0x3D, 0x01, 0xFF, 0xFB, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x3C, 0xF4, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0xF8, 0x7C,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x57, 0xF5, 0x6F, 0x54, 0x03, 0xD0, 0x0F, 0x00, 0x6B, 0xEA, 0xAF,
-    0xA8, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0x40, 0x03, 0xD0, 0x1F, 0x00, 0x03, 0xE0, 0x2E, 0x00, 0x01,
-    0xF0, 0x3C, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00, 0xB8, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xFF, 0xFE, 0x00, 0x60, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x0F, 0x4B, 0xFF, 0xFF, 0xFD, 0x6A, 0xAB, 0xFE, 0x90, 0x01, 0xFE, 0x00,
-    0x02, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xD2, 0xE0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x01, 0x40, 0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFD,
-    0x38, 0x24, 0x0F, 0xC0, 0xE0, 0x00, 0xBC, 0x03, 0x80, 0x03, 0xE0, 0x0E, 0x00, 0x0F, 0x00, 0x38,
-    0x00, 0x7C, 0x00, 0xE0, 0x01, 0xF0, 0x03, 0x80, 0x07, 0xC0, 0x0E, 0x00, 0x1F, 0x00, 0x38, 0x00,
-    0x7C, 0x00, 0xE0, 0x00, 0xF4, 0x03, 0x80, 0x02, 0xF0, 0x0E, 0x00, 0x07, 0xE0, 0x38, 0x00, 0x0B,
-    0xE0, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x01, 0x40, 0x14, 0x00, 0x0E, 0x00, 0xE0, 0x00, 0x38, 0x07, 0x80, 0x02, 0xF5, 0x6F,
-    0x54, 0x7F, 0xFF, 0xFF, 0xF4, 0x6F, 0x57, 0xE5, 0x40, 0xB8, 0x0B, 0x80, 0x02, 0xE0, 0x2E, 0x00,
-    0x0B, 0x80, 0xB8, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0xB8, 0x0B, 0x80, 0x02, 0xE0, 0x2E, 0x00, 0x0B,
-    0x80, 0xB8, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0xB8, 0x0B, 0xC0, 0x02, 0xE0, 0x0F, 0xEA, 0x0B, 0x80,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0x2F, 0x40, 0x18, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8A, 0x4B, 0x47,
-    0x81, 0xF7, 0xBD, 0xBE, 0x78, 0x3D, 0xDD, 0x0F, 0x07, 0x1F, 0x3F, 0x03, 0x81, 0xCF, 0x43, 0xF9,
-    0xE0, 0xBF, 0x80, 0x3B, 0xFF, 0xFE, 0x40, 0x0C, 0x0E, 0x0B, 0x00, 0x03, 0x03, 0x81, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x2A, 0xAF, 0xA8, 0x3F, 0xFF,
-    0xFD, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x16, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x2E, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x24, 0x00,
-    0x3D, 0xBF, 0x40, 0x03, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0xBB, 0xD1, 0xB4, 0x00, 0x3E, 0xFE,
-    0x00, 0x0B, 0xF9, 0x00, 0x07, 0xFD, 0x00, 0x1D, 0x53, 0xD0, 0x02, 0xD0, 0x3D, 0x00, 0x3D, 0x03,
-    0xD0, 0x03, 0xC0, 0x3D, 0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x40, 0x3D, 0x07, 0xE0, 0x03, 0xFF, 0xF8,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x39, 0xF4, 0x00, 0x00, 0x00, 0xB0, 0x3C, 0x00, 0x00, 0x00, 0xB0, 0x3C, 0x00, 0x00,
-    0x00, 0x7D, 0x7D, 0x55, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x05, 0xBE, 0xAA, 0xAB, 0xF0,
-    0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x00, 0x2C, 0x00, 0x3C, 0x34, 0x30, 0x1C, 0x00,
-    0x3D, 0xFD, 0xFC, 0x2C, 0x00, 0x2F, 0xCF, 0xDF, 0xB8, 0x00, 0x2F, 0x03, 0x02, 0xE0, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x02, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0xBD, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x9F, 0xAF, 0xE0,
-    0x1F, 0x80, 0xF0, 0x2F, 0x43, 0xE0, 0x0F, 0x00, 0xBC, 0x3C, 0x00, 0xF0, 0x03, 0xC7, 0xC0, 0x0F,
-    0x00, 0x3D, 0x7C, 0x00, 0xF0, 0x02, 0xEB, 0x80, 0x0F, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x02, 0xEB,
-    0x80, 0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x02, 0xEB, 0x80, 0x00, 0x00, 0x2E, 0x07, 0xFF, 0xE4,
-    0x00, 0xBF, 0xFF, 0xF0, 0x0B, 0x80, 0x1F, 0xC0, 0xB8, 0x00, 0x7D, 0x0B, 0x80, 0x03, 0xE0, 0xB8,
-    0x00, 0x3E, 0x0B, 0x80, 0x03, 0xD0, 0xB8, 0x00, 0x7C, 0x0B, 0xD0, 0x6F, 0x8F, 0xFF, 0xFF, 0xE0,
-    0xBF, 0xFE, 0x90, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x6F, 0xEA,
-    0x40, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x03, 0x87, 0x40, 0x00, 0x00, 0xFA, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x1F,
-    0xF4, 0x03, 0xF3, 0x87, 0x5F, 0x01, 0xF0, 0xE1, 0xD2, 0xF0, 0xF8, 0x38, 0x74, 0x3C, 0x3C, 0x0E,
-    0x1D, 0x0F, 0x5F, 0x03, 0x87, 0x42, 0xE7, 0xC0, 0xE1, 0xD0, 0xB9, 0xF0, 0x10, 0x10, 0x04, 0x3C,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x01, 0x05, 0x00, 0x07, 0x4E, 0x00, 0x07, 0x4E, 0x00, 0x7F, 0xFF, 0x00, 0xBF, 0xFF, 0xE0,
-    0xB8, 0x06, 0xF4, 0xB8, 0x00, 0xFC, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0xBC, 0xB8, 0x00, 0xF4, 0xBD,
-    0x57, 0xF0, 0xBF, 0xFF, 0x80, 0xBE, 0xAF, 0xF0, 0xB8, 0x00, 0xFC, 0xB8, 0x00, 0x3C, 0xB8, 0x00,
-    0x3D, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x7C, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xF0, 0xBF, 0xFF, 0x80,
-    0x07, 0x4E, 0x00, 0x07, 0x4E, 0x00, 0x01, 0x05, 0x00, 0x00, 0x6A, 0x40, 0x7F, 0xFF, 0x1F, 0x95,
-    0x93, 0xE0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x0B,
-    0x80, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xEA, 0xF0, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF6, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xC6, 0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xFF,
-    0xC1, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x2F, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x82, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0x5F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0x41, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00,
+static const uint8_t notosans_12_regularBitmaps[24744] = {
+    0x6D, 0x55, 0x31, 0x8C, 0xDC, 0x44, 0x14, 0x7D, 0xF6, 0x44, 0x31, 0xC4, 0x52, 0x4C, 0x01, 0x52,
+    0x48, 0x6E, 0xCF, 0x4D, 0x0A, 0x8A, 0xDD, 0x75, 0xBB, 0x85, 0xBD, 0x6B, 0x92, 0x92, 0x26, 0x45,
+    0x2E, 0x6D, 0x1A, 0x0A, 0x04, 0x88, 0x34, 0x5B, 0x5C, 0x84, 0xC9, 0x0E, 0x4A, 0x99, 0xE6, 0x1A,
+    0x68, 0x41, 0x50, 0x65, 0x4F, 0x22, 0x87, 0x74, 0xC5, 0x0A, 0x6D, 0xCE, 0x16, 0x08, 0xA5, 0x38,
+    0x89, 0xB8, 0x41, 0x14, 0x29, 0xB0, 0x92, 0xA0, 0x88, 0x9C, 0xC4, 0x59, 0x87, 0x09, 0xCB, 0x65,
+    0x77, 0x87, 0xF7, 0xBD, 0xCB, 0x91, 0x28, 0x19, 0x8D, 0xED, 0x99, 0xF1, 0xCC, 0xFF, 0xEF, 0xBF,
+    0xFF, 0xBE, 0xDD, 0xED, 0x76, 0xBB, 0x51, 0x8B, 0xAD, 0xB9, 0xB2, 0xB2, 0x02, 0x74, 0x7B, 0xDD,
+    0x63, 0x49, 0x2B, 0x69, 0x85, 0xAD, 0x4E, 0xAB, 0xB3, 0xD2, 0x59, 0x39, 0xFB, 0x0A, 0x5C, 0x2B,
+    0xC3, 0x49, 0x9B, 0x97, 0xCA, 0xD0, 0x50, 0x1A, 0x4D, 0xA5, 0x4F, 0xEC, 0x6C, 0xDE, 0xF4, 0x8D,
+    0x99, 0x63, 0xDD, 0x03, 0xFA, 0x27, 0x81, 0x2D, 0x5E, 0x65, 0x03, 0x03, 0x63, 0x26, 0x72, 0x59,
+    0x79, 0x08, 0x3B, 0xEB, 0xF0, 0xEA, 0x43, 0x65, 0x5B, 0x50, 0xBA, 0x04, 0x9A, 0xD2, 0xAD, 0x74,
+    0xC3, 0x37, 0xD3, 0xEE, 0x87, 0xEF, 0x25, 0x4D, 0x2C, 0x7A, 0x6F, 0x0C, 0x77, 0x1E, 0x23, 0xAD,
+    0xD0, 0x9A, 0xA1, 0x19, 0xA0, 0xE9, 0xF3, 0x7E, 0xB5, 0x75, 0x7B, 0x60, 0xAA, 0xD3, 0x3B, 0xF1,
+    0xE2, 0x14, 0x5E, 0x47, 0xDD, 0x7A, 0x1A, 0x5B, 0x6A, 0x4F, 0x3B, 0xBA, 0xE1, 0x22, 0xC4, 0x56,
+    0xC3, 0xCA, 0xE9, 0xC5, 0x83, 0x87, 0x62, 0x9B, 0xB0, 0xAE, 0x67, 0x5C, 0x6A, 0x06, 0x9F, 0x16,
+    0xDF, 0x3E, 0xD8, 0xBF, 0xBE, 0x77, 0x77, 0xD5, 0x53, 0x93, 0xF5, 0xAD, 0x06, 0xD4, 0x0F, 0x44,
+    0xD1, 0xF0, 0xAC, 0x02, 0x65, 0xE8, 0x68, 0x37, 0xE6, 0x52, 0x68, 0xE5, 0x5B, 0x76, 0xA6, 0xEE,
+    0x65, 0xAB, 0x70, 0xA6, 0x38, 0x6A, 0xFE, 0x0C, 0x70, 0x9E, 0x56, 0xC0, 0xC4, 0xD5, 0x34, 0x9A,
+    0x00, 0x95, 0x93, 0xC1, 0xD5, 0x13, 0x20, 0xEA, 0x01, 0x96, 0xD1, 0xDC, 0x53, 0x00, 0xDE, 0x7E,
+    0xEC, 0xA9, 0xF2, 0x9A, 0x55, 0x24, 0xD6, 0x24, 0x72, 0xB5, 0xF3, 0x28, 0x1B, 0xC1, 0xAF, 0xDC,
+    0x0C, 0x29, 0xBA, 0x08, 0x26, 0xB6, 0x49, 0x7F, 0x29, 0x1C, 0x53, 0xF8, 0x5A, 0x8C, 0x7E, 0xF2,
+    0xE7, 0x4F, 0x9D, 0xFB, 0xB1, 0x9D, 0x27, 0xDE, 0xDB, 0x65, 0xA4, 0xB2, 0xC4, 0xD5, 0x95, 0x17,
+    0x97, 0x1E, 0x78, 0x1F, 0xB9, 0x59, 0xA8, 0xF2, 0x00, 0xA5, 0x93, 0xB5, 0x42, 0xBA, 0xAB, 0xAC,
+    0x52, 0xE5, 0xAE, 0xF6, 0x19, 0x5B, 0xC5, 0x41, 0xDC, 0x92, 0x07, 0x71, 0xD8, 0x85, 0x17, 0xF3,
+    0xE6, 0x83, 0x2C, 0x12, 0x54, 0x28, 0x3D, 0xEE, 0x1C, 0x9B, 0x5F, 0x9D, 0xA7, 0xCC, 0xC1, 0x0C,
+    0xD6, 0x3E, 0xD4, 0x9D, 0xCC, 0xBB, 0x5E, 0xB8, 0x56, 0x2E, 0x2E, 0x9B, 0xCB, 0x3D, 0x8B, 0x3E,
+    0xDC, 0x19, 0x1A, 0x63, 0x9E, 0x5D, 0x91, 0x0E, 0xB4, 0xA3, 0x30, 0xD9, 0x2E, 0x31, 0xFC, 0xDA,
+    0xFC, 0xB8, 0xB6, 0x48, 0x3C, 0x73, 0x85, 0x11, 0x03, 0xB7, 0x4A, 0xB4, 0x64, 0xBC, 0x0E, 0x2F,
+    0xA6, 0xCF, 0xB6, 0x8C, 0x13, 0xB8, 0x32, 0x5E, 0x85, 0xCA, 0x79, 0xDC, 0xAD, 0x43, 0x43, 0x5A,
+    0x80, 0x96, 0xC7, 0xAA, 0x88, 0x10, 0xFA, 0x70, 0x6F, 0x68, 0xEB, 0xA0, 0x40, 0xB2, 0x0D, 0x2F,
+    0x82, 0xBA, 0x1B, 0xE3, 0x80, 0x5B, 0xC9, 0x0C, 0x49, 0xBE, 0x93, 0xD9, 0x45, 0x85, 0xCA, 0xE7,
+    0xDE, 0xC3, 0x29, 0x82, 0x05, 0xE7, 0xEB, 0x6E, 0x69, 0x7E, 0xFD, 0xA2, 0x9F, 0x58, 0x8C, 0xDF,
+    0xC7, 0x0B, 0x0F, 0xEE, 0x38, 0x6E, 0x74, 0xCF, 0x94, 0x11, 0xA6, 0x35, 0xE4, 0xA8, 0xBE, 0x93,
+    0x80, 0x91, 0x20, 0x74, 0x72, 0x41, 0xC7, 0xB5, 0x4A, 0x20, 0x2D, 0x86, 0xA6, 0x6E, 0x3C, 0xE8,
+    0x1A, 0x4D, 0xFD, 0x74, 0x30, 0x7E, 0xE6, 0xE0, 0x18, 0x4E, 0xA9, 0x4C, 0x6C, 0xA7, 0xA5, 0x8C,
+    0x19, 0x15, 0xFC, 0xBA, 0x77, 0x35, 0xC6, 0xF3, 0xCD, 0x6A, 0x60, 0x36, 0x6A, 0x54, 0xB4, 0xEF,
+    0x65, 0x50, 0x74, 0xF9, 0x71, 0x06, 0x2F, 0x14, 0xF9, 0x60, 0x14, 0xC2, 0x57, 0x99, 0xCA, 0x42,
+    0x6C, 0x2B, 0x6A, 0x26, 0x94, 0x31, 0x75, 0xFE, 0x77, 0xED, 0x8C, 0xA6, 0xC9, 0xCF, 0xE2, 0xE1,
+    0x9B, 0x09, 0x3B, 0x4D, 0xB7, 0xEA, 0xBE, 0x70, 0xDC, 0x93, 0x28, 0x2A, 0x58, 0x34, 0xD9, 0x05,
+    0x82, 0x23, 0xBF, 0x17, 0x30, 0x1E, 0xDC, 0xAA, 0x02, 0xA3, 0x97, 0xF2, 0x73, 0xE7, 0x08, 0x9E,
+    0xEA, 0x20, 0x66, 0x06, 0x84, 0x60, 0x1A, 0x15, 0x12, 0xD6, 0xD3, 0xA2, 0x7D, 0x98, 0xBA, 0x85,
+    0xBA, 0x5F, 0x22, 0x61, 0x76, 0x56, 0x25, 0xD7, 0x28, 0x2B, 0x24, 0x3E, 0x22, 0xFB, 0x70, 0x5E,
+    0xAB, 0xB6, 0x0E, 0xBD, 0x67, 0x4C, 0x06, 0xBB, 0x14, 0x46, 0x24, 0x8A, 0xA8, 0xF6, 0xE2, 0xD5,
+    0x86, 0x6C, 0xAA, 0xB6, 0x14, 0xE2, 0x64, 0x95, 0x08, 0x48, 0x17, 0x95, 0xAD, 0x8A, 0xDA, 0x43,
+    0x9D, 0xC9, 0x87, 0x98, 0xA7, 0xF1, 0xC4, 0x2A, 0x43, 0x44, 0x1E, 0xDC, 0xF3, 0xB9, 0xCA, 0xC6,
+    0x76, 0xE1, 0x3E, 0x2A, 0x24, 0xC7, 0xD7, 0xE6, 0x18, 0x3B, 0x65, 0x82, 0x6E, 0x1B, 0x8E, 0xA4,
+    0x95, 0x39, 0xE6, 0xC4, 0x7D, 0x9C, 0x62, 0x30, 0x5F, 0x62, 0xB7, 0x8D, 0xF6, 0x4C, 0xD9, 0xC5,
+    0x24, 0x91, 0x94, 0xB7, 0xB7, 0xE1, 0x53, 0x05, 0x23, 0x04, 0x09, 0x06, 0xC1, 0xE7, 0xFB, 0xAE,
+    0xB9, 0x8C, 0x0B, 0xAB, 0x35, 0x25, 0xA1, 0xA0, 0xB0, 0xCB, 0xD3, 0xB7, 0x32, 0xBF, 0x3E, 0xFB,
+    0x66, 0xAF, 0x77, 0x6A, 0x69, 0x43, 0x24, 0x78, 0xE2, 0x7C, 0x39, 0x3D, 0x75, 0x54, 0x90, 0x91,
+    0xE7, 0x7C, 0x5F, 0x94, 0x9D, 0xE5, 0x8C, 0xDF, 0x21, 0xA7, 0x84, 0x9F, 0x63, 0x10, 0x5B, 0x33,
+    0x38, 0x15, 0xEC, 0x6A, 0x51, 0x8F, 0x03, 0x66, 0x2E, 0x8D, 0x61, 0x93, 0x60, 0x67, 0xB9, 0x37,
+    0x35, 0xE6, 0xFD, 0xE1, 0xF0, 0xC8, 0x50, 0x3D, 0xBD, 0xC9, 0xC1, 0x5B, 0xA4, 0x56, 0x4E, 0x68,
+    0x58, 0x74, 0x6F, 0x4F, 0xEA, 0x29, 0x33, 0xE3, 0x4C, 0x10, 0xE4, 0x16, 0xD5, 0xC1, 0x95, 0x2F,
+    0x8F, 0x8E, 0x5D, 0x99, 0xB8, 0x66, 0xF6, 0xAA, 0xA8, 0xA5, 0x14, 0x16, 0x3D, 0xC1, 0xCE, 0x32,
+    0x9F, 0x0A, 0xAB, 0x09, 0x58, 0x6C, 0x4E, 0xBC, 0x0C, 0xBF, 0x10, 0xD1, 0xF0, 0x1B, 0xF1, 0x1A,
+    0x61, 0x92, 0x4B, 0x38, 0xC6, 0x50, 0x94, 0x39, 0x6E, 0x0B, 0xD5, 0x52, 0xCB, 0x8C, 0xDC, 0xD1,
+    0xC1, 0x3F, 0xCE, 0xB9, 0xAC, 0x77, 0x4B, 0x17, 0x65, 0xC4, 0x4F, 0x64, 0xDF, 0x43, 0xDF, 0x6D,
+    0x38, 0xBA, 0x65, 0xEF, 0x9E, 0xE3, 0x8E, 0x83, 0xBC, 0xAF, 0xF2, 0x4E, 0xDF, 0x47, 0xD5, 0x58,
+    0x55, 0xBF, 0xED, 0x5F, 0x56, 0x59, 0xAF, 0x30, 0xD8, 0x46, 0x7C, 0x4C, 0x1C, 0xD3, 0x2E, 0x25,
+    0xC4, 0x78, 0x7F, 0xFF, 0x80, 0x62, 0x1B, 0x98, 0xFC, 0x3F, 0x8C, 0xA2, 0x3D, 0x09, 0xC9, 0x63,
+    0x26, 0x57, 0xB7, 0xC9, 0xD9, 0x3A, 0x5D, 0x09, 0xCB, 0x24, 0x9B, 0x05, 0x67, 0x95, 0x5E, 0xCC,
+    0x44, 0x6A, 0xF5, 0x78, 0x33, 0x13, 0x50, 0xDE, 0x67, 0x97, 0x4A, 0xCA, 0xA2, 0xA4, 0x46, 0x47,
+    0x52, 0x4D, 0x22, 0x14, 0xD2, 0x18, 0x0C, 0xE6, 0x1B, 0x81, 0x31, 0xAE, 0x76, 0x25, 0xBB, 0x94,
+    0xD9, 0x47, 0x50, 0xBB, 0x2C, 0xE7, 0xBF, 0x2E, 0x95, 0xA9, 0x29, 0x82, 0x61, 0xFA, 0x8E, 0xB6,
+    0x9E, 0x14, 0x68, 0x33, 0xFE, 0x3F, 0x60, 0x3F, 0xD5, 0x38, 0x2C, 0x30, 0x4B, 0xCD, 0x2C, 0x30,
+    0x93, 0x05, 0x8C, 0xC1, 0x3C, 0xE6, 0x1F, 0x81, 0x79, 0x39, 0x4B, 0x22, 0x84, 0x31, 0x25, 0x98,
+    0x16, 0xF5, 0x24, 0x22, 0xA3, 0xDC, 0x44, 0x8E, 0x32, 0x15, 0x7D, 0x8A, 0x4C, 0x9D, 0x62, 0x81,
+    0xDC, 0xA5, 0xF2, 0x8E, 0x9B, 0xE9, 0xC2, 0xCA, 0x86, 0x6D, 0x4C, 0xE5, 0xEA, 0x33, 0x55, 0x9B,
+    0xE9, 0x1D, 0x41, 0x11, 0x8E, 0xB3, 0xAB, 0x05, 0x0F, 0xBA, 0x94, 0xEF, 0x77, 0x05, 0xEC, 0x3D,
+    0x4E, 0xBF, 0x21, 0x6C, 0x7E, 0x06, 0xF8, 0xD6, 0xE3, 0xDB, 0x71, 0x9B, 0xB2, 0x20, 0x1A, 0xDB,
+    0xF0, 0x4F, 0x32, 0x30, 0x4F, 0x8C, 0xB9, 0xA7, 0xA5, 0xC0, 0x47, 0x92, 0x18, 0x96, 0x52, 0xB0,
+    0x76, 0x31, 0x35, 0x07, 0x87, 0xC3, 0x1B, 0xCF, 0xAD, 0xB6, 0x45, 0x17, 0xDC, 0x9B, 0xBF, 0xE4,
+    0x04, 0x87, 0x3B, 0xC3, 0xAF, 0x8C, 0xD9, 0xFD, 0x79, 0xED, 0xF9, 0xD5, 0x7A, 0xB8, 0x68, 0x67,
+    0xCC, 0x43, 0x96, 0xDD, 0x54, 0x4D, 0xF0, 0xAE, 0xC4, 0x1C, 0xA0, 0xAE, 0xEF, 0xFA, 0xE3, 0x9A,
+    0xD4, 0xD7, 0x1B, 0x17, 0x13, 0xF4, 0x66, 0x09, 0x4E, 0xDF, 0x16, 0x96, 0x59, 0x79, 0x51, 0x20,
+    0x9A, 0xD6, 0x88, 0x28, 0xDE, 0xC8, 0x32, 0x7B, 0x33, 0x2C, 0xF9, 0x63, 0xCE, 0x18, 0x8A, 0x92,
+    0x40, 0xE9, 0x83, 0x15, 0x74, 0x34, 0x0D, 0xD6, 0xD6, 0x12, 0xAA, 0x97, 0xE0, 0x37, 0x5F, 0xF2,
+    0xF6, 0x99, 0x69, 0xC6, 0x20, 0xB4, 0xFC, 0x2F, 0xE2, 0x08, 0x2F, 0x3C, 0xAE, 0x3C, 0xF8, 0x5F,
+    0x30, 0xCF, 0xB7, 0x7F, 0x01, 0xAD, 0x54, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0xC7, 0xB0,
+    0xC5, 0x48, 0x0C, 0x45, 0x24, 0xA4, 0x14, 0xD9, 0x1E, 0xC9, 0xB7, 0x7F, 0x60, 0xF7, 0x6E, 0x20,
+    0x12, 0x91, 0xA0, 0xB0, 0x69, 0x28, 0x68, 0x52, 0x13, 0x09, 0x97, 0x28, 0x44, 0xE7, 0xDC, 0x28,
+    0x6D, 0x8A, 0x28, 0xFF, 0x80, 0x3A, 0x12, 0x31, 0xC5, 0x09, 0x56, 0xE1, 0xEC, 0x9B, 0x28, 0x05,
+    0x05, 0x05, 0x0B, 0x56, 0x44, 0x61, 0x89, 0xAC, 0xE2, 0x54, 0xB8, 0xF0, 0x24, 0x1E, 0xCE, 0x1B,
+    0x7B, 0xEF, 0x1E, 0x6F, 0xEE, 0xC0, 0x0A, 0x16, 0x26, 0x89, 0xC4, 0x6A, 0x76, 0x67, 0xDE, 0xCC,
+    0xCE, 0xBC, 0xEF, 0x7D, 0xDF, 0x7B, 0x83, 0x61, 0x5C, 0x4B, 0xD3, 0x41, 0x79, 0x66, 0x57, 0x5C,
+    0x3A, 0xA0, 0x0F, 0xBF, 0xC2, 0x55, 0xC8, 0x9B, 0x26, 0x76, 0x25, 0x46, 0xD2, 0xA4, 0x28, 0x93,
+    0x4A, 0x1A, 0x8F, 0xB2, 0x80, 0xBC, 0x65, 0xF0, 0x7D, 0x03, 0x79, 0x5C, 0x61, 0x33, 0x83, 0x34,
+    0xCD, 0x62, 0x2D, 0x43, 0x89, 0x56, 0x1A, 0x51, 0x97, 0x48, 0x3F, 0x32, 0x18, 0x5D, 0x45, 0x5C,
+    0xF3, 0x2A, 0x3A, 0xE0, 0x85, 0x97, 0x0C, 0xC7, 0x34, 0x21, 0xAA, 0x06, 0x80, 0x78, 0x36, 0x05,
+    0xB2, 0x9D, 0x06, 0xA0, 0x35, 0x87, 0x64, 0xF3, 0xBB, 0x0A, 0xCB, 0x93, 0x5F, 0x2D, 0x0E, 0x76,
+    0x56, 0x90, 0xDC, 0x5A, 0xEB, 0x20, 0x2F, 0xCA, 0x7E, 0xE4, 0x26, 0xB5, 0x97, 0x17, 0x77, 0x6E,
+    0xD4, 0xB9, 0x5A, 0x13, 0xF7, 0xEB, 0xA2, 0x54, 0x2B, 0x7A, 0x52, 0xA7, 0xB9, 0xD8, 0x31, 0xDD,
+    0x4A, 0xAD, 0x61, 0x8C, 0xA2, 0x8C, 0x1A, 0x4C, 0x6A, 0x51, 0x89, 0x6A, 0x1D, 0xF8, 0xA2, 0x45,
+    0xBC, 0xC7, 0x88, 0xEF, 0x3A, 0x74, 0xBE, 0x75, 0xB8, 0xB7, 0x5D, 0xC5, 0x7B, 0x97, 0xAC, 0xFC,
+    0x5A, 0xD9, 0x4E, 0xA9, 0xF4, 0xBD, 0x3A, 0x8B, 0xF7, 0x4C, 0x57, 0xDE, 0x45, 0xD1, 0xE1, 0x60,
+    0xAF, 0xD5, 0x78, 0xBE, 0x67, 0xA2, 0xE3, 0xBB, 0x88, 0x67, 0x25, 0xC4, 0x51, 0x8D, 0xA4, 0x46,
+    0x78, 0x24, 0x55, 0x48, 0x89, 0x90, 0x9A, 0xC4, 0x29, 0x83, 0xAE, 0xB4, 0x48, 0x1E, 0x54, 0x40,
+    0xE3, 0x18, 0x72, 0x1F, 0x48, 0x1E, 0x01, 0xD1, 0xA1, 0x05, 0xD6, 0x79, 0x22, 0xE5, 0x09, 0xF9,
+    0x93, 0x86, 0x78, 0xEC, 0x10, 0x39, 0xC6, 0xD0, 0xC8, 0x3A, 0x6A, 0x31, 0xDE, 0x6B, 0xF1, 0x26,
+    0x35, 0xF3, 0xF3, 0x06, 0x33, 0x3D, 0x26, 0x5F, 0x46, 0x6D, 0x89, 0x6E, 0x89, 0x8C, 0x69, 0x2B,
+    0xC1, 0x00, 0x18, 0x7A, 0x3B, 0x26, 0x37, 0x9E, 0xE9, 0x32, 0x70, 0x74, 0xBA, 0xFD, 0x0F, 0x50,
+    0xDA, 0x53, 0x50, 0xD6, 0xC3, 0x89, 0xBC, 0x1B, 0x9B, 0xFC, 0xAA, 0x30, 0x58, 0x65, 0x6C, 0x92,
+    0x48, 0x33, 0x94, 0x85, 0xA2, 0x99, 0x34, 0x11, 0x67, 0x42, 0x87, 0xAD, 0x6A, 0xF3, 0x93, 0x46,
+    0xD2, 0x14, 0x5B, 0x1B, 0x46, 0x9A, 0x3E, 0x67, 0x8C, 0x93, 0x46, 0xE9, 0x79, 0x96, 0x9C, 0x68,
+    0xCF, 0x47, 0xC4, 0xF4, 0x24, 0xA5, 0xB6, 0x8B, 0x73, 0xEC, 0x7D, 0xD1, 0xBA, 0x8C, 0xAD, 0x42,
+    0x32, 0x63, 0xB9, 0x99, 0xD3, 0x66, 0xEE, 0xB7, 0x40, 0x90, 0xBF, 0x58, 0xC5, 0x68, 0xBC, 0xE1,
+    0x07, 0x64, 0x10, 0x72, 0x81, 0xF6, 0x89, 0x66, 0x48, 0x79, 0xCC, 0xE8, 0xD5, 0x6B, 0x76, 0x43,
+    0x4E, 0x1D, 0x03, 0xD5, 0xBC, 0xBC, 0x2B, 0x11, 0x1D, 0x5B, 0xA4, 0x39, 0xC4, 0x2F, 0x1E, 0xAD,
+    0x3A, 0x22, 0x64, 0x73, 0x00, 0xE1, 0x88, 0x6B, 0x0E, 0x62, 0xD7, 0x42, 0x31, 0xB9, 0xA3, 0x14,
+    0xA2, 0xCA, 0x19, 0x4E, 0x89, 0x32, 0x72, 0x21, 0xA3, 0x52, 0xCE, 0x5A, 0x0E, 0x54, 0x54, 0x28,
+    0x18, 0x64, 0xC9, 0xA2, 0x1C, 0x58, 0x88, 0x7D, 0x26, 0x91, 0x4F, 0x56, 0xCC, 0x7A, 0x2F, 0x28,
+    0xC5, 0x99, 0xFD, 0xA5, 0xE3, 0xA1, 0xD8, 0xAD, 0xA2, 0x29, 0xD4, 0x8A, 0x91, 0x25, 0xFA, 0x19,
+    0x0A, 0x17, 0xBB, 0x3E, 0x0E, 0x2A, 0x65, 0x7C, 0x72, 0xD3, 0xE4, 0xA2, 0x2E, 0x54, 0xE4, 0x12,
+    0xEB, 0x72, 0x66, 0x31, 0xB1, 0x5C, 0x5E, 0xC5, 0x72, 0xE4, 0x1C, 0x4A, 0x27, 0x7E, 0xB0, 0xD1,
+    0x81, 0x95, 0x6B, 0x10, 0xBF, 0xE1, 0xC2, 0x10, 0x6A, 0x88, 0x9E, 0x45, 0x66, 0x41, 0xC0, 0x75,
+    0xC4, 0xEC, 0xC9, 0x33, 0x2E, 0xE4, 0x88, 0xEA, 0x11, 0x94, 0xF6, 0x01, 0x5C, 0x62, 0xE3, 0xBA,
+    0xE0, 0x70, 0xEA, 0x79, 0x02, 0x28, 0xBF, 0x40, 0x13, 0xCA, 0x8A, 0xC1, 0x75, 0x0B, 0x56, 0xBF,
+    0x8F, 0x20, 0x55, 0x09, 0xCF, 0xBF, 0xBA, 0x62, 0x9E, 0x12, 0xEC, 0x14, 0xD1, 0x53, 0x07, 0xF5,
+    0x7E, 0x8D, 0x91, 0xB0, 0x62, 0x5E, 0xCA, 0x4A, 0xBB, 0xA0, 0x39, 0x8A, 0x9C, 0xBD, 0x71, 0xFA,
+    0xB3, 0x53, 0x2E, 0x28, 0x08, 0xBB, 0xA0, 0x39, 0x5F, 0x30, 0xFE, 0x82, 0x99, 0x11, 0x3D, 0x20,
+    0x6A, 0xD9, 0x36, 0x88, 0xDD, 0x5C, 0xD8, 0x57, 0x1A, 0xF5, 0x88, 0xB6, 0x89, 0xA6, 0xB4, 0x3F,
+    0x73, 0x0A, 0x67, 0x35, 0x5E, 0x1D, 0x32, 0x4E, 0xDE, 0xC6, 0x37, 0x86, 0x0A, 0x91, 0xB3, 0x91,
+    0x07, 0x23, 0x0D, 0x06, 0xE3, 0xCC, 0x03, 0x17, 0x69, 0x00, 0xC5, 0x46, 0x7F, 0xF0, 0x94, 0xAC,
+    0xE2, 0x39, 0x27, 0xCE, 0xEC, 0xC2, 0x2F, 0x78, 0x8B, 0xA3, 0x62, 0x92, 0x98, 0xD7, 0xE4, 0x73,
+    0xDE, 0xEB, 0x70, 0x41, 0x6A, 0x61, 0x73, 0x5C, 0x8D, 0x2B, 0xC9, 0x7E, 0x6A, 0x0C, 0x97, 0x21,
+    0xEE, 0x6B, 0x2C, 0x31, 0x4A, 0x45, 0xBC, 0x41, 0xDA, 0x2E, 0x7C, 0x6C, 0x70, 0x45, 0xF7, 0xC8,
+    0x3E, 0x49, 0x4D, 0x70, 0xC9, 0xC1, 0xBB, 0x8C, 0x7E, 0x3C, 0xDA, 0x58, 0x47, 0xAF, 0x06, 0x69,
+    0xB9, 0x8F, 0xC1, 0x60, 0x63, 0x34, 0xF0, 0xDF, 0x20, 0x80, 0xFB, 0x67, 0xBB, 0xA2, 0x0F, 0xA9,
+    0xA6, 0xF7, 0xDA, 0x16, 0x45, 0x83, 0x8E, 0x47, 0x7A, 0xD2, 0x1A, 0x64, 0x2D, 0xBA, 0x53, 0x8C,
+    0x8E, 0xF7, 0xFC, 0x53, 0x0A, 0x45, 0xC8, 0x5E, 0x52, 0xB2, 0xD3, 0x4F, 0x55, 0x08, 0x2F, 0x72,
+    0x27, 0xB7, 0x26, 0x0F, 0x39, 0x58, 0x2E, 0x79, 0x75, 0xE4, 0xE4, 0x22, 0x63, 0x59, 0xAF, 0x30,
+    0x17, 0x5C, 0x04, 0x6A, 0xF5, 0xF9, 0x8B, 0xD5, 0x60, 0xEA, 0xAF, 0x5F, 0x9A, 0x76, 0xD1, 0xBB,
+    0x8C, 0x84, 0x2F, 0xD0, 0x49, 0xCD, 0x17, 0x0B, 0xF8, 0x6E, 0x14, 0x6C, 0x78, 0x87, 0xF5, 0x1E,
+    0x7A, 0x17, 0x8F, 0xC6, 0x55, 0xD6, 0x0C, 0x17, 0xAE, 0x12, 0xAA, 0xD5, 0xED, 0xA6, 0x1B, 0x14,
+    0xEF, 0xF4, 0x91, 0x71, 0x15, 0x6E, 0xDD, 0xB9, 0x53, 0xCE, 0x0B, 0x97, 0x8F, 0xCC, 0xF4, 0x92,
+    0x3A, 0x1A, 0x45, 0x7F, 0xDD, 0x5C, 0x48, 0xA6, 0xD1, 0xAC, 0x2A, 0x82, 0xFE, 0x7D, 0xC8, 0x87,
+    0x92, 0xFC, 0x3B, 0x0F, 0x79, 0x94, 0xD8, 0x33, 0x3E, 0xF8, 0x2C, 0x8A, 0x68, 0xF2, 0xF3, 0xF3,
+    0xD4, 0x37, 0x98, 0xF6, 0x91, 0x5E, 0x06, 0xDF, 0xD4, 0x7F, 0x43, 0x62, 0x63, 0xDB, 0x46, 0xBE,
+    0xC5, 0x54, 0xFD, 0x4E, 0x7A, 0xBC, 0x5B, 0xCD, 0x53, 0x8B, 0x59, 0x4D, 0xDF, 0x40, 0x7A, 0x83,
+    0xC8, 0x64, 0x33, 0x7D, 0x9A, 0xC6, 0x77, 0xF5, 0x84, 0x1C, 0x7D, 0xCC, 0x34, 0xE6, 0x0D, 0x0A,
+    0x7F, 0x76, 0x5B, 0x2A, 0x8A, 0x25, 0x9C, 0x2B, 0x5E, 0x7C, 0xF0, 0xB6, 0xA8, 0x94, 0x5E, 0x62,
+    0xE9, 0xB5, 0xD2, 0x05, 0x7C, 0xB0, 0xFE, 0xA5, 0x4B, 0xD3, 0x66, 0x60, 0x4E, 0xFB, 0xC5, 0xAA,
+    0x8F, 0x9D, 0x97, 0xD6, 0x67, 0xF0, 0x23, 0xFC, 0xE1, 0x70, 0xC8, 0x8A, 0x3B, 0xB4, 0x23, 0x78,
+    0x4E, 0x0C, 0xAE, 0xC2, 0xC4, 0x86, 0x1F, 0xD0, 0x1C, 0x3E, 0x5A, 0x7F, 0xA1, 0xE9, 0xD5, 0x2B,
+    0xFA, 0xBC, 0x3E, 0xA0, 0xC7, 0x0C, 0xFA, 0x83, 0xE3, 0xDB, 0x0C, 0x7B, 0x2B, 0x00, 0xEF, 0x07,
+    0x88, 0xAF, 0xF1, 0xE1, 0x53, 0x9E, 0xBD, 0x5A, 0xD8, 0xF8, 0x8F, 0xE7, 0x4F, 0x95, 0x55, 0x3D,
+    0x6C, 0x14, 0x47, 0x14, 0xFE, 0x76, 0xC6, 0xF6, 0x12, 0xAF, 0xB8, 0x71, 0xE1, 0x02, 0x84, 0xED,
+    0x4D, 0x91, 0x02, 0x9C, 0xFB, 0x69, 0x2C, 0x71, 0x91, 0xF6, 0xEE, 0xC6, 0x50, 0xA4, 0x48, 0x11,
+    0x47, 0xC2, 0xA2, 0x88, 0x14, 0xEA, 0xA0, 0xF0, 0x53, 0xA4, 0x20, 0xD2, 0x39, 0xB7, 0x72, 0x0A,
+    0xAA, 0x08, 0xA4, 0xA4, 0x8F, 0x95, 0x34, 0xE1, 0x40, 0xE1, 0x0A, 0x8A, 0x4B, 0x74, 0x70, 0x6B,
+    0x50, 0x44, 0xE1, 0xC2, 0x4B, 0xAC, 0x24, 0x45, 0xA4, 0xB0, 0x04, 0x28, 0x62, 0x2B, 0x64, 0x8C,
+    0x17, 0x58, 0xE0, 0x6E, 0x27, 0x6F, 0xEE, 0x6C, 0xCB, 0x72, 0x48, 0x91, 0xB9, 0xD1, 0xED, 0xBE,
+    0xDD, 0xB9, 0xF7, 0xBE, 0xF7, 0xBD, 0xF7, 0xBD, 0xC3, 0x49, 0x69, 0xE9, 0x2E, 0x9E, 0x1F, 0x08,
+    0x13, 0xB4, 0x3C, 0x88, 0x13, 0x60, 0x6B, 0x3E, 0x7E, 0x88, 0x50, 0x68, 0xC2, 0xF9, 0x0A, 0xFC,
+    0x7E, 0x08, 0xD5, 0x42, 0x47, 0xAC, 0x76, 0x50, 0x4B, 0x40, 0x6B, 0xE6, 0xA4, 0xDC, 0xD0, 0x4A,
+    0xBF, 0xD7, 0xE9, 0x60, 0x2E, 0x41, 0x3E, 0x86, 0xBB, 0xBD, 0x13, 0x14, 0x3A, 0x28, 0xA7, 0x68,
+    0xBD, 0x5C, 0x8B, 0x9F, 0xE8, 0x30, 0x06, 0x76, 0x6D, 0x7C, 0x68, 0x59, 0xFA, 0xE9, 0x9D, 0xE7,
+    0x6E, 0x9C, 0xA0, 0x5B, 0x85, 0x7B, 0x02, 0xFC, 0x37, 0x1F, 0x4F, 0x23, 0x94, 0x9A, 0x26, 0x32,
+    0x5F, 0x09, 0xAC, 0xB8, 0x83, 0xAE, 0x58, 0xD5, 0xB2, 0x4D, 0x81, 0xCD, 0x4F, 0x4A, 0x80, 0x90,
+    0xE0, 0x9B, 0xC6, 0xCC, 0xE4, 0xBA, 0x7E, 0xF6, 0x73, 0x8A, 0x0E, 0x59, 0xBB, 0x3F, 0xD6, 0x25,
+    0xA6, 0xBB, 0x73, 0x43, 0x4B, 0x12, 0x4D, 0xD8, 0x91, 0x01, 0x54, 0x20, 0x4C, 0x21, 0xF2, 0xB0,
+    0x62, 0xE4, 0x6F, 0x5C, 0xBD, 0xAD, 0x23, 0x42, 0x60, 0x01, 0x11, 0xCE, 0xE1, 0xD3, 0x63, 0x6D,
+    0xFD, 0xF6, 0x43, 0xD9, 0xA4, 0xB7, 0x8E, 0xCF, 0x22, 0x6C, 0xDF, 0xB4, 0x20, 0xFE, 0xB4, 0xB4,
+    0x04, 0x46, 0x31, 0x28, 0x0C, 0x22, 0xC4, 0x0A, 0x25, 0x22, 0xE6, 0xDD, 0xDD, 0x46, 0x68, 0xC5,
+    0x2D, 0x74, 0xDD, 0x55, 0x3D, 0xAD, 0xFF, 0x08, 0x0D, 0x31, 0x18, 0x3C, 0x0D, 0xFE, 0x6B, 0x60,
+    0xA9, 0x18, 0xCD, 0x02, 0x3C, 0x1E, 0xB8, 0x88, 0x85, 0x74, 0x79, 0xC0, 0x17, 0x29, 0x00, 0x61,
+    0xF1, 0xC0, 0x1F, 0x01, 0x35, 0xCA, 0x28, 0xC0, 0x31, 0x0A, 0x30, 0x5A, 0xC5, 0x75, 0x78, 0x1E,
+    0x52, 0x54, 0x4B, 0xD6, 0xDF, 0x68, 0xE6, 0xD9, 0x5D, 0xC4, 0x2E, 0xBF, 0xED, 0x2B, 0xC1, 0x6F,
+    0x2D, 0x46, 0xE2, 0x9D, 0xCF, 0x6E, 0x86, 0xCE, 0x05, 0xB6, 0x12, 0xD8, 0xCB, 0xD6, 0x46, 0xC0,
+    0x7F, 0xC7, 0x33, 0x9F, 0x75, 0xD0, 0x96, 0x56, 0xC7, 0x38, 0x49, 0x50, 0x31, 0x20, 0x9D, 0xC0,
+    0x09, 0x62, 0x8A, 0xC5, 0x43, 0xF6, 0x58, 0xA1, 0xAC, 0xC0, 0x89, 0xA8, 0x0E, 0xD0, 0x0E, 0x50,
+    0x4D, 0x50, 0x12, 0xB2, 0x6C, 0x29, 0x17, 0x79, 0x21, 0x79, 0xD8, 0x47, 0xB8, 0xD2, 0x47, 0xE8,
+    0xA2, 0xC4, 0x43, 0x17, 0x4D, 0xC7, 0x17, 0x84, 0xF0, 0x8E, 0xC2, 0xB9, 0x18, 0xC2, 0x03, 0x23,
+    0x84, 0x95, 0x1E, 0x42, 0xC3, 0xB9, 0x02, 0x31, 0x83, 0x2A, 0x9C, 0x2E, 0x58, 0x17, 0x18, 0x9C,
+    0x9D, 0x69, 0xEB, 0x68, 0xF6, 0x44, 0x8F, 0xE2, 0x80, 0x6A, 0xC3, 0x89, 0x67, 0x73, 0x8A, 0x4A,
+    0xD4, 0x32, 0x4F, 0x2A, 0xF5, 0x6F, 0xB5, 0x56, 0x18, 0xF6, 0xDD, 0x48, 0xF8, 0x9C, 0x02, 0xD1,
+    0x6F, 0x5D, 0x7A, 0x41, 0x37, 0x89, 0x1D, 0x5B, 0x5D, 0x53, 0x98, 0xED, 0x27, 0x55, 0x08, 0xE3,
+    0xA0, 0x46, 0xB4, 0x7B, 0x1B, 0xCB, 0xBB, 0x37, 0xDE, 0x82, 0x50, 0x98, 0xA3, 0xAA, 0xEC, 0xF4,
+    0x52, 0x02, 0x4B, 0xD0, 0xA6, 0xDC, 0x77, 0x78, 0xC9, 0xC3, 0x95, 0x95, 0x80, 0x20, 0x0C, 0x4A,
+    0xB8, 0xE9, 0xF4, 0xF2, 0xFB, 0x7A, 0x1D, 0x07, 0xA2, 0x7D, 0x95, 0xCA, 0x7E, 0x0C, 0x8C, 0x8D,
+    0x65, 0xB3, 0xB9, 0x5C, 0xAE, 0x54, 0x2A, 0x97, 0xCB, 0x87, 0x4C, 0xFB, 0x12, 0x3F, 0x01, 0xDA,
+    0x89, 0xD0, 0xEA, 0xBA, 0xB9, 0x73, 0x4D, 0x82, 0x54, 0x76, 0xC7, 0x27, 0x37, 0xE4, 0x8B, 0xFA,
+    0x88, 0x25, 0x43, 0x4C, 0x77, 0xAC, 0xB6, 0xDF, 0x3F, 0xDB, 0x5F, 0x16, 0x35, 0x4F, 0x5B, 0xFB,
+    0xAE, 0x1C, 0xA1, 0xC3, 0xC8, 0x01, 0x2C, 0xDC, 0xBA, 0xB0, 0x76, 0x5D, 0x56, 0x74, 0xB2, 0xE3,
+    0xA1, 0x61, 0xCE, 0xEB, 0xF7, 0xAD, 0xD6, 0xDD, 0x8A, 0xD6, 0xA6, 0x3D, 0x8A, 0x27, 0xC7, 0x0B,
+    0xBA, 0x23, 0x64, 0x3C, 0x8E, 0x62, 0x16, 0xD9, 0xDE, 0xF6, 0x04, 0xAE, 0xB9, 0x6B, 0x49, 0xA9,
+    0x7D, 0x6A, 0x04, 0x7B, 0xCE, 0x81, 0x51, 0xCF, 0x7B, 0x2E, 0x61, 0x89, 0xA1, 0xEC, 0x20, 0x4F,
+    0x05, 0xA2, 0x04, 0x9B, 0xA6, 0xDB, 0x50, 0x0E, 0x71, 0xBC, 0x3B, 0xE3, 0x68, 0xDD, 0xD3, 0x81,
+    0xA0, 0xF2, 0x6A, 0xD5, 0xB3, 0x54, 0xCF, 0xA2, 0xCB, 0x26, 0x6D, 0x17, 0xC9, 0x78, 0x6D, 0x8B,
+    0x42, 0x5A, 0x05, 0x7D, 0xE4, 0xC5, 0x0D, 0xD1, 0xC3, 0x43, 0x4D, 0xA1, 0x25, 0xD7, 0xA1, 0xE7,
+    0xDC, 0x8B, 0xA8, 0xC9, 0x84, 0x90, 0x9E, 0xFB, 0x53, 0xE4, 0xA4, 0xA0, 0xBA, 0x50, 0xF9, 0xB0,
+    0x0E, 0x7B, 0x69, 0xF5, 0xBA, 0xA3, 0x2F, 0xF6, 0x32, 0xF6, 0x26, 0xBC, 0x89, 0xCD, 0xE4, 0x71,
+    0x26, 0xA5, 0x28, 0x5F, 0x9E, 0x31, 0x8C, 0xD8, 0x41, 0x06, 0xB3, 0x3C, 0x68, 0xB8, 0xA9, 0x7D,
+    0x54, 0xC6, 0xA3, 0xCE, 0x98, 0x23, 0x31, 0xD6, 0x20, 0xEF, 0x87, 0x7D, 0x82, 0xF2, 0x88, 0x08,
+    0xE3, 0x57, 0x28, 0xDC, 0xDE, 0xB3, 0x24, 0xDC, 0xA9, 0xB0, 0x0A, 0x76, 0x33, 0x68, 0x27, 0x19,
+    0xEE, 0x4F, 0x4A, 0x65, 0xFB, 0x04, 0xD5, 0x7E, 0x30, 0xA4, 0x60, 0x26, 0xCE, 0xE6, 0x72, 0x93,
+    0xFD, 0xA7, 0x90, 0x19, 0xFA, 0x2E, 0xFF, 0x41, 0x31, 0x53, 0x9C, 0x28, 0xA4, 0x54, 0x43, 0xFF,
+    0x75, 0x71, 0x34, 0x6C, 0xE6, 0x9D, 0x9B, 0xAA, 0x4A, 0x5D, 0x1D, 0xF3, 0x45, 0x65, 0x2F, 0x2A,
+    0xB2, 0x9C, 0xF9, 0x70, 0xC0, 0x42, 0xBD, 0x5E, 0xD7, 0x26, 0x71, 0xB1, 0x63, 0x3B, 0xF5, 0x6F,
+    0xF4, 0x8F, 0xB3, 0xAF, 0x04, 0x3B, 0x78, 0x8C, 0xC0, 0x56, 0xBA, 0x04, 0x76, 0xBD, 0xE5, 0x8C,
+    0xF1, 0x40, 0x8D, 0x35, 0xA8, 0xDF, 0x0F, 0xFB, 0xA5, 0xD3, 0x78, 0x04, 0x1D, 0xF1, 0x2B, 0xC4,
+    0xC4, 0xDE, 0xB3, 0xC4, 0xC5, 0x54, 0xE8, 0xB9, 0x04, 0x56, 0xE5, 0x32, 0x7C, 0x5E, 0xBE, 0xF1,
+    0x2A, 0xB0, 0x93, 0xF5, 0xFA, 0x17, 0x5A, 0x93, 0x77, 0x96, 0xF2, 0x5F, 0xEE, 0x85, 0xD9, 0x86,
+    0xFD, 0x91, 0xB5, 0xE2, 0xAB, 0x5A, 0x6C, 0x11, 0x63, 0xD9, 0x1E, 0x10, 0xD3, 0x2F, 0xCA, 0x90,
+    0x5D, 0xD0, 0x7A, 0xD9, 0x28, 0x41, 0xF5, 0x3B, 0x61, 0xFB, 0x0D, 0xB6, 0xDE, 0x58, 0xB2, 0x90,
+    0x14, 0x73, 0xC8, 0xD0, 0x27, 0x8B, 0x6B, 0x2C, 0x74, 0x64, 0x0E, 0xB5, 0x74, 0xF2, 0x92, 0x25,
+    0x9D, 0x94, 0x1F, 0x89, 0x50, 0xC4, 0x38, 0xBB, 0x61, 0x44, 0xEC, 0x19, 0x95, 0x2C, 0xAD, 0x85,
+    0x57, 0x7D, 0x92, 0x7C, 0xC1, 0x0E, 0x16, 0x68, 0xD0, 0x8C, 0xC6, 0x28, 0xFD, 0xD7, 0x26, 0xCD,
+    0xD3, 0x08, 0xD5, 0x97, 0xFF, 0x7A, 0x99, 0x8E, 0xFF, 0x7B, 0x02, 0x33, 0xAD, 0xCF, 0xEB, 0x27,
+    0xF7, 0x75, 0x72, 0x48, 0xA7, 0xC3, 0x6D, 0x3D, 0x7F, 0x55, 0x47, 0x97, 0x75, 0x32, 0x49, 0x46,
+    0x4D, 0xCF, 0x5F, 0xD0, 0xD1, 0xD7, 0x3A, 0x39, 0x58, 0x48, 0x87, 0x71, 0x7C, 0xDE, 0xC7, 0xC2,
+    0x02, 0x0E, 0x1E, 0xC4, 0xF0, 0x30, 0xD8, 0x2B, 0x0C, 0x5A, 0xE5, 0x4A, 0x79, 0x20, 0x63, 0x45,
+    0x76, 0x90, 0x3B, 0xBE, 0x44, 0xA2, 0x28, 0x88, 0x8D, 0x25, 0x28, 0xB1, 0xB5, 0x87, 0x48, 0x34,
+    0xA9, 0xF5, 0x50, 0x45, 0xE3, 0x53, 0xFC, 0x73, 0xDC, 0xF7, 0xA7, 0x1A, 0x59, 0xD1, 0xA5, 0xB1,
+    0xB7, 0x87, 0xD1, 0x30, 0xF2, 0xA9, 0xC2, 0x54, 0x5A, 0x4B, 0x55, 0xD1, 0xA4, 0xF9, 0x54, 0xA5,
+    0x02, 0xD3, 0x13, 0x1A, 0x56, 0x54, 0x60, 0xD2, 0x74, 0x06, 0x85, 0x00, 0x8A, 0xDF, 0x85, 0x2D,
+    0x07, 0x3C, 0x43, 0xA0, 0x22, 0x65, 0x71, 0xEA, 0x3C, 0xE2, 0xC2, 0x30, 0x6A, 0xCB, 0x08, 0xCA,
+    0x13, 0x01, 0xA7, 0xE6, 0x82, 0x33, 0xC1, 0x49, 0xB7, 0xAA, 0x48, 0xE5, 0x3E, 0x72, 0x8B, 0xF8,
+    0x1A, 0x17, 0x60, 0x81, 0xD6, 0x72, 0x82, 0xD5, 0x93, 0x9E, 0x84, 0xA9, 0x43, 0x85, 0xD1, 0xB8,
+    0x87, 0x8A, 0xCF, 0x42, 0x1A, 0xA3, 0x19, 0x0C, 0x14, 0xD1, 0xA0, 0x3F, 0x02, 0x2A, 0x32, 0xF7,
+    0xC9, 0x7D, 0xC6, 0x08, 0xB7, 0x98, 0x71, 0x23, 0x44, 0x8F, 0x5F, 0x28, 0x7E, 0x7E, 0x9A, 0x05,
+    0x19, 0x0F, 0x8E, 0xD1, 0xB3, 0x47, 0xA7, 0xE9, 0xA2, 0x48, 0xD7, 0xB6, 0xEC, 0xD9, 0x39, 0x72,
+    0xCF, 0x5E, 0x2C, 0x4C, 0x40, 0xE8, 0xFE, 0x74, 0xA0, 0x7F, 0x1A, 0xEE, 0x7F, 0x42, 0x93, 0x8A,
+    0x1C, 0x81, 0x34, 0x33, 0x41, 0x87, 0x06, 0x5B, 0xB8, 0x06, 0x61, 0xE2, 0x23, 0xCF, 0xE8, 0x98,
+    0xB0, 0xFD, 0x08, 0x42, 0x70, 0xF5, 0xFD, 0x5C, 0xCE, 0xA1, 0x96, 0x29, 0x8E, 0xAB, 0x3E, 0x66,
+    0x2B, 0x6C, 0x10, 0xC6, 0xC5, 0x40, 0xC1, 0x39, 0x4A, 0x8D, 0x96, 0x31, 0xA0, 0x4D, 0xC2, 0xF8,
+    0xD8, 0x7C, 0xED, 0x33, 0xAA, 0xE5, 0x0A, 0x43, 0xD2, 0x04, 0x1A, 0xA1, 0xD3, 0x26, 0x4A, 0x15,
+    0x76, 0x48, 0x93, 0x91, 0xBE, 0x4A, 0x86, 0x2D, 0xCA, 0x82, 0xC6, 0x58, 0x65, 0xBA, 0x51, 0xD3,
+    0xE1, 0x9B, 0x0F, 0xF0, 0xFF, 0xD6, 0x3F, 0xB5, 0x55, 0x31, 0x6F, 0xD4, 0x48, 0x14, 0xFE, 0x66,
+    0x26, 0xC4, 0xC5, 0x48, 0x38, 0xFD, 0x5D, 0xE2, 0x86, 0x82, 0x82, 0xAC, 0xDB, 0x14, 0xEB, 0x5D,
+    0x4B, 0x57, 0x5E, 0x81, 0x84, 0x08, 0x3F, 0x83, 0x50, 0x50, 0xA4, 0x58, 0xC8, 0x00, 0xBF, 0x01,
+    0x51, 0xD2, 0xA2, 0x9C, 0xE0, 0xAE, 0x48, 0xB1, 0xCA, 0x71, 0x67, 0x4B, 0x94, 0x14, 0xB8, 0x4F,
+    0x81, 0x81, 0x02, 0x91, 0x95, 0x90, 0x11, 0x06, 0x2C, 0xD8, 0xDD, 0xC7, 0x37, 0x76, 0x40, 0x09,
+    0xBA, 0x93, 0x10, 0x5A, 0x66, 0x35, 0xF2, 0xF3, 0x9B, 0x37, 0xDF, 0xF7, 0xDE, 0x9B, 0xCF, 0xB3,
+    0x00, 0xC7, 0x80, 0x33, 0x4C, 0x81, 0x20, 0xA7, 0x51, 0xA2, 0x1D, 0x86, 0xB6, 0xA5, 0x1D, 0x56,
+    0xC0, 0xDA, 0x1E, 0x90, 0x6C, 0x03, 0xFD, 0x3E, 0x30, 0x5E, 0x07, 0xEA, 0x08, 0xAA, 0x0A, 0x53,
+    0x5D, 0x5A, 0x67, 0x0E, 0xFF, 0xC8, 0x03, 0x91, 0x22, 0xBC, 0x7D, 0xA9, 0x8A, 0x80, 0xAA, 0xC7,
+    0x08, 0x46, 0x8D, 0x46, 0xDC, 0x51, 0x03, 0x71, 0x07, 0x76, 0x8D, 0xB3, 0x01, 0x34, 0xF1, 0x4C,
+    0xBA, 0x78, 0x7C, 0x5B, 0x00, 0x11, 0xDF, 0x46, 0x5C, 0x29, 0xED, 0x62, 0xF1, 0x97, 0x14, 0x90,
+    0xFD, 0x96, 0xAA, 0x89, 0x40, 0xB9, 0xED, 0xC5, 0xE7, 0xBE, 0x9D, 0x70, 0xAE, 0xE3, 0xEB, 0x58,
+    0x14, 0xB6, 0x4A, 0x3B, 0x8C, 0xB3, 0x1B, 0xC0, 0xC6, 0x59, 0x60, 0x75, 0xAF, 0xC3, 0x5D, 0x48,
+    0xDE, 0x31, 0x57, 0x61, 0x44, 0xE6, 0x5C, 0x69, 0xBC, 0x78, 0xBC, 0x7A, 0x74, 0xC9, 0x45, 0xF4,
+    0xBD, 0x69, 0x9D, 0x37, 0xEB, 0xF0, 0xF6, 0x45, 0x46, 0x8B, 0xE4, 0xA6, 0x08, 0x0F, 0xEF, 0xE1,
+    0xFA, 0x2E, 0xBD, 0xA1, 0x48, 0x0A, 0xF5, 0x6E, 0x93, 0x66, 0xE2, 0x45, 0x47, 0xCD, 0xD5, 0x5E,
+    0x1C, 0x34, 0xC9, 0x25, 0xF2, 0xA2, 0x64, 0xC8, 0xBC, 0x6D, 0xC5, 0xCE, 0x3C, 0x8D, 0x44, 0xD4,
+    0x0C, 0x67, 0x42, 0x36, 0xE5, 0x21, 0x7B, 0xE3, 0x73, 0xE7, 0x02, 0x13, 0x51, 0x55, 0x27, 0xD7,
+    0xA8, 0x7B, 0xF5, 0x18, 0xDA, 0xBB, 0x8E, 0x2A, 0xB4, 0xF3, 0x2C, 0x5D, 0x96, 0x29, 0xC0, 0x2A,
+    0x0D, 0xD5, 0xB1, 0x5C, 0xB6, 0x9D, 0x55, 0x97, 0x09, 0xD0, 0x0A, 0x3C, 0x4A, 0x7D, 0x1D, 0xAC,
+    0xEC, 0x57, 0xBE, 0xB0, 0xD8, 0x2D, 0x99, 0x8D, 0xBD, 0x3E, 0xAD, 0xF3, 0x4E, 0x9A, 0xEF, 0x36,
+    0x7F, 0x17, 0x89, 0x77, 0xEF, 0x9D, 0xF4, 0xD2, 0x6C, 0x63, 0x3D, 0x44, 0xEC, 0x93, 0x60, 0xDA,
+    0x57, 0x7E, 0x14, 0xC1, 0x54, 0x88, 0x2B, 0xFD, 0xAC, 0x5A, 0x55, 0xE5, 0x0F, 0x22, 0x24, 0x21,
+    0xF6, 0xFA, 0x6D, 0xAF, 0x94, 0xC8, 0x81, 0xC8, 0xE5, 0x2F, 0x01, 0x6D, 0xEC, 0x3F, 0x9B, 0x17,
+    0x44, 0x1E, 0x1F, 0xEE, 0xF6, 0x4E, 0x78, 0x69, 0xB6, 0xB1, 0x29, 0x1B, 0x66, 0x4A, 0x53, 0x68,
+    0xC7, 0x86, 0x6F, 0x35, 0x61, 0x9A, 0xA0, 0xE6, 0x39, 0x7D, 0xFB, 0x58, 0x9E, 0x0F, 0x67, 0xBE,
+    0xF3, 0xB1, 0xAA, 0x4E, 0xE3, 0x3B, 0x22, 0xD5, 0x14, 0xE2, 0xEA, 0xFA, 0x2F, 0x7E, 0x86, 0x46,
+    0x8A, 0x8C, 0x04, 0x3C, 0x1B, 0x7F, 0xD2, 0xFF, 0x6D, 0xA8, 0xCC, 0x09, 0xCF, 0xAE, 0xBF, 0xD6,
+    0x5F, 0xF3, 0x65, 0x0C, 0x67, 0x71, 0x63, 0x8A, 0xFF, 0xFF, 0xFD, 0xD2, 0x0C, 0x67, 0x81, 0xBC,
+    0xF2, 0xE5, 0xD6, 0x18, 0xA9, 0x2C, 0x8D, 0x58, 0x05, 0x75, 0x30, 0xE4, 0x51, 0x04, 0xF9, 0xA8,
+    0x95, 0x31, 0x06, 0x43, 0xC9, 0xED, 0x5D, 0xA9, 0x75, 0x49, 0xCD, 0x34, 0x74, 0x24, 0x8C, 0x88,
+    0xFC, 0x61, 0x31, 0xC2, 0xE6, 0x11, 0xA2, 0xC2, 0xCB, 0x5B, 0xC9, 0x9C, 0x52, 0x5D, 0x51, 0x30,
+    0xD3, 0x73, 0x48, 0xB2, 0x12, 0x45, 0xAF, 0xED, 0x64, 0x0D, 0x75, 0x50, 0xC1, 0xFE, 0x59, 0xA2,
+    0xF7, 0x77, 0x8E, 0xFD, 0x83, 0x5C, 0x4F, 0xCE, 0xA7, 0xF6, 0x7E, 0x84, 0xDE, 0xDE, 0x10, 0xFB,
+    0x65, 0xA2, 0x27, 0xEE, 0xA1, 0x7D, 0x80, 0xA6, 0x37, 0x46, 0xBD, 0x5F, 0xEA, 0x37, 0x13, 0x67,
+    0x5E, 0x3E, 0x40, 0xF0, 0x7A, 0x0C, 0xFB, 0x91, 0xE2, 0x9D, 0x38, 0x44, 0xAE, 0xFB, 0x94, 0xCB,
+    0x23, 0x71, 0xB6, 0xF7, 0xEA, 0xD5, 0xEE, 0xFB, 0xD6, 0x4C, 0x9C, 0xEC, 0x79, 0x50, 0xAA, 0x29,
+    0x03, 0xC2, 0x9B, 0x15, 0x65, 0xC4, 0x0E, 0x0C, 0x78, 0x8E, 0xF6, 0x29, 0xE9, 0x3F, 0x30, 0xF8,
+    0x1A, 0xA5, 0x1C, 0x71, 0x67, 0x40, 0x87, 0x7E, 0x4B, 0xFD, 0x36, 0xAC, 0x64, 0x44, 0xCD, 0x0E,
+    0x74, 0x83, 0x1D, 0xC4, 0x1F, 0x79, 0x19, 0x65, 0x73, 0x1C, 0x1B, 0x36, 0xEF, 0x84, 0xEE, 0xA7,
+    0x2A, 0x7E, 0x2A, 0x95, 0x17, 0x5E, 0xC6, 0x9D, 0xDB, 0xDC, 0xB5, 0x61, 0xDC, 0x4F, 0xA2, 0x3A,
+    0x85, 0x14, 0x61, 0x7D, 0x05, 0xC1, 0xD6, 0x14, 0xDA, 0x8D, 0x8F, 0xAA, 0xE4, 0xB5, 0xC3, 0x2B,
+    0x81, 0x0D, 0x0E, 0xAA, 0xD0, 0x61, 0xC0, 0xAA, 0x83, 0x47, 0x1E, 0x88, 0xC8, 0xF1, 0x11, 0xF2,
+    0x09, 0x2A, 0xFB, 0x24, 0x85, 0x79, 0xEE, 0x93, 0xE1, 0x5F, 0x50, 0x63, 0x99, 0x1D, 0xB2, 0xC9,
+    0x14, 0xCB, 0xD2, 0x1C, 0x6B, 0xDD, 0xAD, 0x1C, 0xBA, 0xA8, 0x8E, 0x39, 0x16, 0xCF, 0xB2, 0x81,
+    0xD5, 0x01, 0x46, 0xE1, 0x8D, 0xCA, 0xBC, 0xCC, 0x21, 0xC0, 0xBF, 0x54, 0xB0, 0x0B, 0x1E, 0x95,
+    0x11, 0x9A, 0x3E, 0x92, 0x15, 0x2C, 0x31, 0x66, 0x89, 0xC4, 0x77, 0x1C, 0x89, 0xF3, 0x8E, 0x58,
+    0xCF, 0x49, 0xFC, 0x81, 0xC4, 0x35, 0x89, 0xC7, 0x24, 0x1E, 0x91, 0xB8, 0x4F, 0xE2, 0x75, 0x12,
+    0xAF, 0x91, 0x38, 0x24, 0xF1, 0xF9, 0xD4, 0x3C, 0xFF, 0xE4, 0x54, 0xB5, 0x93, 0x77, 0xC4, 0x5A,
+    0x26, 0x53, 0xF5, 0x9E, 0xC4, 0x2B, 0xF8, 0xAE, 0xF1, 0x19, 0xAD, 0x54, 0x31, 0x8F, 0xDC, 0x44,
+    0x14, 0xFE, 0xEC, 0x39, 0xD6, 0x12, 0x96, 0x6E, 0xAE, 0x48, 0x81, 0x28, 0xD6, 0x0D, 0x15, 0xBA,
+    0xAC, 0x1B, 0x8A, 0x43, 0xB2, 0xF7, 0x26, 0x41, 0x0A, 0x45, 0x8A, 0x84, 0x96, 0x7F, 0x40, 0x2A,
+    0xCA, 0x13, 0x1C, 0x77, 0x16, 0x6D, 0x8A, 0x24, 0xFC, 0x82, 0x14, 0x14, 0xB0, 0x91, 0xB8, 0x2B,
+    0x22, 0x64, 0xA2, 0xBD, 0xF3, 0x90, 0x14, 0x94, 0x98, 0x4B, 0x91, 0xF2, 0xDC, 0x9D, 0x48, 0xA4,
+    0xCB, 0x90, 0x0C, 0x3A, 0x6B, 0xCF, 0xBB, 0x8F, 0x37, 0xDE, 0xDD, 0x10, 0x01, 0x11, 0xD9, 0x24,
+    0xF6, 0xC8, 0xE3, 0x19, 0xFB, 0x7D, 0xEF, 0xCD, 0xF7, 0xBE, 0xF7, 0x00, 0x40, 0x6A, 0x20, 0xE5,
+    0xD9, 0x00, 0x22, 0xE3, 0x19, 0xB7, 0x01, 0xCA, 0x20, 0xEB, 0xFF, 0x9F, 0x72, 0x78, 0xA7, 0x1A,
+    0x51, 0x02, 0x71, 0x60, 0xD1, 0xC8, 0x11, 0x21, 0xA6, 0x16, 0xA2, 0xBD, 0x64, 0x06, 0x51, 0x01,
+    0x1B, 0xC0, 0x32, 0xDE, 0x20, 0xAE, 0xC7, 0x3F, 0xAD, 0x97, 0x90, 0x52, 0xF9, 0xD9, 0xEA, 0x1B,
+    0xC4, 0x8D, 0xC2, 0x0C, 0x26, 0x9F, 0x2D, 0x42, 0xF5, 0x52, 0x80, 0x3C, 0x9D, 0x66, 0x88, 0x86,
+    0xF0, 0x9E, 0x6A, 0xA4, 0xB1, 0x92, 0x9A, 0x76, 0x8C, 0x4F, 0xF5, 0x33, 0x0E, 0x44, 0x09, 0xF4,
+    0x39, 0xE6, 0x6A, 0x4E, 0x02, 0x3B, 0x89, 0x22, 0xC0, 0xF6, 0x10, 0xEA, 0x84, 0x79, 0xCF, 0x7D,
+    0x03, 0x2B, 0xE1, 0xB3, 0x67, 0x71, 0x5F, 0x23, 0x38, 0x66, 0xDE, 0x38, 0x13, 0x11, 0x87, 0x95,
+    0xCC, 0x92, 0xC2, 0xF9, 0x91, 0x78, 0x7E, 0xC9, 0x8C, 0xE6, 0xED, 0x28, 0x1E, 0xAA, 0x82, 0x4C,
+    0xDE, 0x69, 0x72, 0xF4, 0x73, 0xC4, 0x39, 0xA2, 0xF6, 0xC9, 0xEF, 0x4D, 0x41, 0xB6, 0xA0, 0x2C,
+    0x9F, 0xFF, 0x39, 0x3D, 0x97, 0x4F, 0x95, 0x98, 0xD0, 0x79, 0xE3, 0x1B, 0x8B, 0x24, 0x45, 0x24,
+    0x95, 0xFC, 0xA8, 0x8C, 0x94, 0x95, 0x2A, 0x0D, 0x33, 0x79, 0xCE, 0x88, 0x72, 0x5D, 0x59, 0x51,
+    0xA7, 0x88, 0xAF, 0x29, 0xEF, 0xA4, 0x44, 0xCF, 0x22, 0xDC, 0x5B, 0x11, 0x87, 0x17, 0x6F, 0x3D,
+    0xFD, 0x8D, 0xCC, 0x3C, 0xAD, 0x1A, 0x52, 0xB9, 0x88, 0xDA, 0x03, 0x75, 0xBE, 0x15, 0xD4, 0x2C,
+    0x9F, 0xAB, 0xE1, 0x19, 0x17, 0x9A, 0xF4, 0xA9, 0x29, 0x06, 0x27, 0xA5, 0x98, 0x40, 0x5A, 0xEC,
+    0x9B, 0xE0, 0x64, 0x74, 0xFA, 0x0B, 0x5D, 0x9C, 0x53, 0xAC, 0x50, 0x3B, 0x06, 0xD6, 0x16, 0xB5,
+    0xF4, 0x6B, 0x44, 0x16, 0xC6, 0x2E, 0x63, 0x77, 0x21, 0x4B, 0xB5, 0x12, 0x97, 0xE5, 0x11, 0x75,
+    0x1C, 0xFF, 0xF0, 0xBE, 0x07, 0x91, 0xB8, 0xBE, 0x05, 0x6C, 0x3A, 0x26, 0x85, 0x2E, 0x28, 0x7E,
+    0xB8, 0x67, 0x39, 0x91, 0x62, 0x8C, 0x78, 0xE8, 0x8D, 0x27, 0xFB, 0x7F, 0xD0, 0x81, 0x9E, 0x89,
+    0x41, 0x6D, 0x9C, 0x9D, 0xE9, 0xED, 0xA5, 0xCD, 0xCE, 0x40, 0x34, 0x58, 0x5D, 0xC3, 0xCD, 0x5D,
+    0xEF, 0x91, 0xF2, 0xAC, 0x33, 0x7E, 0xF7, 0xBA, 0x24, 0xF3, 0x61, 0x50, 0x21, 0xD0, 0x8E, 0xB2,
+    0x24, 0xA4, 0x27, 0x93, 0x5B, 0x87, 0x8A, 0x85, 0xB3, 0x5E, 0xFA, 0xA7, 0x3A, 0x3A, 0x7C, 0xF4,
+    0x38, 0x1A, 0xAF, 0x4E, 0xBD, 0x7C, 0x86, 0x88, 0xEE, 0x53, 0xD9, 0xBD, 0x40, 0x5F, 0xB3, 0xED,
+    0x04, 0x43, 0xF0, 0x48, 0xDC, 0x23, 0xED, 0x10, 0xD1, 0x38, 0xFE, 0x7D, 0x32, 0xF8, 0x6E, 0xD3,
+    0x6D, 0xD7, 0xEE, 0x61, 0x31, 0xE6, 0xBC, 0xFA, 0x84, 0xA5, 0xED, 0x9D, 0xAB, 0xA3, 0x3A, 0x1A,
+    0xFB, 0x64, 0xA7, 0x11, 0x5F, 0x51, 0x11, 0xE9, 0xF1, 0xA7, 0x5C, 0x7F, 0x89, 0xA3, 0x88, 0x09,
+    0xEF, 0x39, 0x05, 0x38, 0xB6, 0x4A, 0x96, 0x1D, 0xE4, 0xC8, 0x84, 0x1C, 0x7D, 0x1B, 0x11, 0xA7,
+    0xA4, 0x8B, 0xB7, 0x2C, 0xB6, 0x95, 0x53, 0xAB, 0x71, 0xB0, 0xCE, 0xE7, 0xF2, 0x0C, 0x28, 0xA0,
+    0x4A, 0xDE, 0xA8, 0xFB, 0x48, 0x13, 0xF4, 0x36, 0x11, 0x17, 0x44, 0xFB, 0x83, 0x41, 0xDE, 0x52,
+    0xC1, 0x3D, 0x23, 0x56, 0x4B, 0x72, 0x34, 0xF4, 0x9E, 0xE9, 0x9D, 0xCB, 0x9D, 0x9D, 0x76, 0x31,
+    0x4D, 0xF0, 0xC2, 0xE6, 0x5B, 0xF0, 0x48, 0x89, 0x7B, 0xE5, 0xDB, 0x6D, 0x96, 0x17, 0x35, 0x0F,
+    0xEE, 0x56, 0xE2, 0x6E, 0x05, 0x2C, 0xEE, 0xDA, 0x37, 0x32, 0x4B, 0x70, 0x13, 0x9E, 0x4A, 0x45,
+    0xF9, 0xCF, 0xC1, 0xF5, 0x1B, 0xFE, 0x6C, 0xF8, 0x40, 0x67, 0xFE, 0xFD, 0xCD, 0x55, 0x37, 0xB7,
+    0x23, 0xCA, 0xAC, 0xDD, 0x0D, 0x5B, 0x01, 0x48, 0xC5, 0x7B, 0x96, 0x3D, 0xFC, 0xD7, 0x0B, 0x33,
+    0xDB, 0x4D, 0xBA, 0xAD, 0xA6, 0x78, 0xF3, 0x45, 0xB7, 0xFB, 0xBE, 0xD6, 0x81, 0x3C, 0xD4, 0x28,
+    0x14, 0x8A, 0x0A, 0x4D, 0x8A, 0x25, 0x96, 0x0F, 0x72, 0x6F, 0xFF, 0x92, 0x4F, 0x74, 0x60, 0x83,
+    0xDA, 0xA0, 0xBF, 0x89, 0xF0, 0x98, 0xDB, 0x59, 0x86, 0x2F, 0x2A, 0xF4, 0x12, 0xC8, 0x4B, 0x59,
+    0xA8, 0x27, 0x3B, 0x3A, 0x9C, 0x36, 0x34, 0x4F, 0xAD, 0x48, 0xFB, 0xF9, 0xD9, 0xC2, 0xBC, 0x17,
+    0xBA, 0xF5, 0xE5, 0x2B, 0xEA, 0x09, 0x19, 0xFA, 0xA4, 0x69, 0x90, 0xD4, 0x48, 0xED, 0x8B, 0x87,
+    0x33, 0xFE, 0x0A, 0x4E, 0x25, 0xAE, 0x67, 0x84, 0x98, 0x56, 0x2A, 0x2B, 0xB3, 0x94, 0x37, 0xF6,
+    0x64, 0x16, 0xDE, 0xD3, 0xF8, 0xD3, 0xA0, 0x97, 0x23, 0xFC, 0x01, 0x3E, 0x7B, 0xFF, 0x89, 0x43,
+    0xE1, 0xB3, 0x85, 0x5A, 0x3A, 0xEF, 0xC1, 0x73, 0xED, 0x7F, 0xD8, 0x72, 0xCD, 0x5A, 0x5A, 0x7D,
+    0x75, 0x10, 0xD7, 0x6B, 0x1A, 0x84, 0x57, 0xB3, 0x40, 0x6D, 0xBC, 0x1A, 0x88, 0x5A, 0x02, 0x7D,
+    0x8C, 0x1F, 0x29, 0xFB, 0xA0, 0x25, 0x82, 0x0B, 0x12, 0xDB, 0xA4, 0xFA, 0x17, 0x6C, 0x1F, 0xB1,
+    0x84, 0x78, 0xA0, 0x71, 0xA7, 0x6A, 0x41, 0x8E, 0xE1, 0x1F, 0x69, 0xD4, 0xDC, 0x18, 0x63, 0xAC,
+    0x8B, 0x51, 0x81, 0x68, 0x32, 0x8F, 0xC2, 0x72, 0xA3, 0x96, 0xF3, 0xC5, 0xC2, 0x00, 0xEF, 0xC0,
+    0xA5, 0xDE, 0xE5, 0xF5, 0xB2, 0x5B, 0xBE, 0x3F, 0x18, 0x5C, 0xA3, 0xBF, 0x9B, 0x29, 0xEB, 0xB6,
+    0x6C, 0xFB, 0xBA, 0x83, 0xFE, 0x26, 0xDB, 0x26, 0xB3, 0xE5, 0xA0, 0x0B, 0x89, 0x2F, 0x1F, 0xE8,
+    0xE4, 0x4E, 0x95, 0xF6, 0xF2, 0x5E, 0x78, 0x1C, 0xF9, 0x47, 0xBF, 0xA2, 0x26, 0x95, 0xC4, 0x99,
+    0x83, 0x16, 0x8F, 0x27, 0x53, 0xB0, 0xD7, 0xBD, 0xFE, 0x02, 0xAD, 0x55, 0xBF, 0x73, 0xDC, 0x44,
+    0x14, 0xFE, 0x56, 0x4A, 0xA2, 0x42, 0x33, 0x5E, 0x0A, 0x68, 0xC2, 0x10, 0x35, 0x14, 0x14, 0xF1,
+    0xA9, 0x0D, 0x33, 0xD2, 0x69, 0x4D, 0x8A, 0x14, 0x29, 0x92, 0x86, 0x34, 0x14, 0xB4, 0x8C, 0x6B,
+    0x0A, 0x0A, 0x5D, 0x4E, 0x54, 0x14, 0x14, 0x98, 0x82, 0x9A, 0x0C, 0x93, 0x06, 0x7B, 0x06, 0x53,
+    0xA4, 0xB8, 0x99, 0x5C, 0x2C, 0x0D, 0xFF, 0x00, 0x82, 0x4C, 0x2A, 0x8A, 0xA8, 0x80, 0x02, 0xBB,
+    0x40, 0x90, 0xB5, 0x47, 0x38, 0x3A, 0x3D, 0xDE, 0xDB, 0xF3, 0x19, 0x08, 0x34, 0xF1, 0x78, 0x47,
+    0x9A, 0xF3, 0xAE, 0xDE, 0xFB, 0xF6, 0x7B, 0xDF, 0xFB, 0x61, 0x00, 0x98, 0x00, 0x41, 0x05, 0x7C,
+    0xC4, 0x3F, 0x86, 0xB7, 0xCA, 0xE0, 0x76, 0x8B, 0x34, 0x81, 0xBE, 0x05, 0xFF, 0x71, 0x05, 0xFB,
+    0xE2, 0x26, 0x45, 0x74, 0xB3, 0xD2, 0x3F, 0x0C, 0xBB, 0x36, 0x1A, 0xD6, 0xB1, 0x5A, 0x73, 0x20,
+    0x75, 0xCF, 0x1B, 0x38, 0x33, 0x88, 0xAE, 0x11, 0xF6, 0x08, 0x3F, 0xA9, 0x02, 0x73, 0xED, 0xCC,
+    0x20, 0x0F, 0x12, 0xAC, 0xEB, 0x93, 0xBF, 0x2F, 0x42, 0x5D, 0xFF, 0x1F, 0xBF, 0xBF, 0x37, 0x16,
+    0x93, 0x18, 0xD9, 0x8D, 0xE3, 0xB2, 0x9E, 0x76, 0x0F, 0x56, 0x08, 0xBD, 0x8B, 0x26, 0x01, 0xDE,
+    0x5A, 0x62, 0xE0, 0x4E, 0x23, 0x3E, 0x91, 0x36, 0xE1, 0xC7, 0xAD, 0x5F, 0xA7, 0xAA, 0x0D, 0x8B,
+    0x19, 0xDA, 0x04, 0x69, 0x84, 0xE0, 0x33, 0x83, 0x67, 0x15, 0x46, 0x0D, 0xFC, 0xD6, 0x79, 0xB2,
+    0x02, 0x7C, 0x7B, 0x58, 0x88, 0xA6, 0x65, 0x8D, 0xB8, 0x06, 0xEC, 0x0B, 0xCF, 0xA6, 0x39, 0xA2,
+    0x96, 0x36, 0xFA, 0x1E, 0x69, 0x87, 0x91, 0x45, 0x74, 0xFA, 0x74, 0x88, 0x7B, 0x8C, 0x07, 0xCC,
+    0x9F, 0x1F, 0xD8, 0x43, 0xAA, 0xED, 0x7F, 0x7C, 0x65, 0xB5, 0x39, 0x92, 0xE8, 0x84, 0xEA, 0xAB,
+    0x50, 0xEF, 0x15, 0x12, 0x53, 0x9E, 0x62, 0x14, 0x54, 0xDA, 0xD8, 0xA0, 0x1A, 0x79, 0x8D, 0x5F,
+    0xB5, 0xB0, 0x39, 0xAE, 0xA4, 0xF0, 0xBF, 0x07, 0x1E, 0x16, 0xD0, 0x95, 0xE3, 0x67, 0x5D, 0x58,
+    0x23, 0x20, 0x82, 0x47, 0x06, 0xA5, 0xE4, 0xBB, 0x1C, 0x96, 0xAF, 0x2C, 0x9F, 0xEB, 0x20, 0x6C,
+    0x38, 0x02, 0xB6, 0xBD, 0xC2, 0x7A, 0xA4, 0x5C, 0x14, 0x09, 0x7B, 0xCC, 0x58, 0x5D, 0x1B, 0x41,
+    0xB5, 0xDA, 0x78, 0x4D, 0x58, 0xF8, 0xFB, 0x3B, 0x55, 0x40, 0x54, 0xEB, 0x2F, 0xEE, 0xB4, 0xCC,
+    0xA4, 0x65, 0xC0, 0x19, 0x5B, 0xE5, 0x39, 0x7B, 0xF0, 0x15, 0x71, 0x48, 0x4D, 0x4C, 0x05, 0xE3,
+    0x5D, 0xDE, 0xD2, 0xD4, 0xBE, 0x1D, 0x34, 0x22, 0x06, 0xAB, 0x92, 0x84, 0xF4, 0xC7, 0xB0, 0xF3,
+    0xD4, 0xE8, 0x0E, 0x59, 0xED, 0x3D, 0xAF, 0xA2, 0xA7, 0x07, 0xBF, 0x45, 0x8B, 0xAB, 0x72, 0xB3,
+    0x61, 0x99, 0xDB, 0x35, 0x60, 0xDA, 0x2F, 0x19, 0x9C, 0x23, 0x9B, 0x8B, 0xB8, 0x7D, 0xD5, 0x2F,
+    0xB2, 0x1E, 0xB1, 0x50, 0x52, 0x5F, 0x83, 0xC8, 0xDF, 0xBA, 0xCB, 0x06, 0x6C, 0xCB, 0x77, 0x94,
+    0x14, 0xEF, 0x3F, 0xB2, 0xA0, 0xC2, 0x5F, 0x20, 0x9E, 0xAB, 0xC5, 0xB0, 0xF7, 0x3B, 0xFD, 0x58,
+    0x9D, 0xDF, 0xF5, 0x70, 0x9A, 0xE3, 0x5B, 0x7E, 0x25, 0x2E, 0x06, 0x03, 0xF1, 0xFB, 0x1A, 0x36,
+    0x0D, 0x8B, 0xB3, 0xB6, 0xD1, 0x39, 0x26, 0x6C, 0x92, 0x78, 0xD4, 0xC7, 0xFB, 0xF3, 0x09, 0x92,
+    0x0E, 0x89, 0xC5, 0x7C, 0xAE, 0xFA, 0xE9, 0xEE, 0xDC, 0xE9, 0x73, 0x4D, 0x7C, 0x55, 0x0D, 0xC5,
+    0x08, 0x83, 0x64, 0x7D, 0x55, 0xA7, 0xD2, 0xB8, 0xEC, 0xEA, 0x55, 0xEE, 0x40, 0xD1, 0x9F, 0x98,
+    0x52, 0x1F, 0x58, 0x6C, 0x65, 0x7C, 0xC8, 0x57, 0xE9, 0xC2, 0x7D, 0x57, 0xED, 0xD2, 0x54, 0xCA,
+    0x26, 0x5F, 0x6E, 0x7D, 0x2E, 0xCC, 0x50, 0x8E, 0xD8, 0x42, 0x84, 0x89, 0x8F, 0x17, 0x78, 0x9D,
+    0xDA, 0xD3, 0x56, 0x2C, 0xD0, 0x21, 0x28, 0xE4, 0x66, 0xE0, 0xD2, 0x7D, 0x45, 0xBD, 0x7E, 0x72,
+    0xAF, 0x13, 0x4D, 0x18, 0x63, 0x06, 0xAF, 0x91, 0x12, 0x8F, 0x5C, 0xB9, 0x73, 0xAF, 0xD0, 0x2E,
+    0xCA, 0xEE, 0xD4, 0x95, 0x51, 0xA9, 0x42, 0xF8, 0x69, 0x81, 0x0F, 0xDD, 0x44, 0x39, 0x47, 0x5E,
+    0xAA, 0x93, 0x3E, 0x69, 0xED, 0x9A, 0xD3, 0xF3, 0x25, 0x78, 0x19, 0xD7, 0x93, 0x52, 0xFA, 0x78,
+    0x65, 0x09, 0x35, 0x1D, 0x4C, 0x44, 0xA4, 0x16, 0x78, 0x53, 0x08, 0xB3, 0xB1, 0xDF, 0xB8, 0xD6,
+    0x5D, 0x11, 0xF9, 0x07, 0x2F, 0xE9, 0x1B, 0x61, 0xCD, 0x85, 0xEC, 0x2A, 0x22, 0x1C, 0x4A, 0x73,
+    0x89, 0x7A, 0x07, 0x73, 0x41, 0xBE, 0x32, 0x69, 0x85, 0x65, 0x71, 0x4D, 0xC9, 0x3F, 0xFC, 0x60,
+    0x2C, 0x79, 0x66, 0x80, 0xD1, 0x09, 0x27, 0x29, 0x7F, 0x23, 0xA5, 0x90, 0x1D, 0x54, 0xF1, 0xB0,
+    0x8A, 0xA5, 0x59, 0x87, 0xF7, 0xAC, 0x86, 0xC7, 0x07, 0x5E, 0x73, 0xCE, 0x09, 0x4C, 0xFD, 0x2A,
+    0xCD, 0x91, 0x55, 0x32, 0xDD, 0x5F, 0x32, 0x81, 0x7A, 0xA3, 0x85, 0x7E, 0x7F, 0x59, 0xF7, 0x91,
+    0xCB, 0x5F, 0x40, 0xBF, 0x22, 0x26, 0x32, 0x33, 0x55, 0xBE, 0xD3, 0x20, 0xBE, 0x59, 0x20, 0xE3,
+    0xC8, 0xF2, 0x19, 0x70, 0xC4, 0x73, 0xEF, 0xA0, 0x40, 0xF8, 0x0D, 0x4B, 0xCB, 0xDB, 0x63, 0xDE,
+    0xFE, 0xC4, 0xB0, 0xFC, 0xB5, 0x9F, 0x21, 0xFC, 0xAE, 0x51, 0x8B, 0x90, 0x5B, 0x23, 0xA6, 0x9F,
+    0x05, 0xF7, 0x16, 0x93, 0x7E, 0xCC, 0x4C, 0x0F, 0x99, 0x79, 0x7A, 0x0F, 0x22, 0xC9, 0xE5, 0xEB,
+    0x35, 0xA6, 0x0B, 0x8B, 0xBB, 0x37, 0x16, 0x18, 0x23, 0x33, 0x3C, 0x50, 0x6B, 0x8E, 0xD3, 0x32,
+    0xBD, 0x94, 0x59, 0x6A, 0x33, 0xE2, 0x38, 0xE5, 0x80, 0xF5, 0x9C, 0x20, 0x63, 0x0B, 0xFF, 0x58,
+    0xA6, 0xEA, 0xC9, 0xB0, 0x16, 0x62, 0x8A, 0xC8, 0x22, 0x57, 0x25, 0xFB, 0x7A, 0x2D, 0x9B, 0x66,
+    0x4A, 0xA4, 0xCF, 0x5D, 0x8F, 0x62, 0x9C, 0x51, 0x15, 0x7E, 0x49, 0x8C, 0xC7, 0x41, 0x76, 0x12,
+    0x2E, 0x5B, 0x44, 0x6C, 0xA1, 0xD9, 0x22, 0xAC, 0x22, 0x44, 0xB5, 0xF4, 0xAE, 0xA2, 0x41, 0x02,
+    0x65, 0x42, 0x7C, 0xAD, 0x4F, 0x04, 0x2D, 0xD9, 0xD5, 0x46, 0xDD, 0x4F, 0x85, 0x5E, 0xF0, 0xCB,
+    0xB4, 0x66, 0x76, 0xAC, 0xCB, 0x44, 0xB8, 0x08, 0x27, 0xE6, 0xC6, 0x52, 0x08, 0x9A, 0xD5, 0xCC,
+    0x59, 0x98, 0x65, 0x3B, 0x8B, 0x15, 0x31, 0x4D, 0x75, 0xC6, 0xF3, 0x15, 0x11, 0x2D, 0x4A, 0x3A,
+    0x72, 0x52, 0xAF, 0x4A, 0x21, 0x7C, 0xF2, 0x6E, 0x4C, 0xFD, 0xDE, 0xF6, 0x57, 0xFF, 0x3E, 0x2D,
+    0x58, 0x60, 0xB6, 0xB5, 0x21, 0xB5, 0x3C, 0x3D, 0x05, 0x63, 0xD3, 0x04, 0xD4, 0xE8, 0xCF, 0xBB,
+    0xB1, 0xFC, 0xEF, 0x19, 0xE5, 0x88, 0x4B, 0xA2, 0xBD, 0xED, 0xED, 0x99, 0x2B, 0x00, 0xCE, 0x5A,
+    0x6C, 0x2E, 0xE8, 0xE3, 0xB9, 0xA2, 0xD3, 0xBE, 0x3B, 0xCB, 0xFA, 0x0B, 0xAD, 0x55, 0x31, 0x6F,
+    0xD3, 0x50, 0x10, 0xFE, 0x6C, 0xA7, 0x35, 0x92, 0xA5, 0xBE, 0x20, 0x95, 0xA5, 0x05, 0x85, 0x91,
+    0xA1, 0xAD, 0xD7, 0x22, 0xC5, 0xF5, 0x83, 0x0E, 0x0C, 0x1D, 0x5A, 0x41, 0xA3, 0x8E, 0x5D, 0x98,
+    0x90, 0x68, 0x16, 0x06, 0x86, 0x94, 0x78, 0x67, 0xA0, 0xFC, 0x0B, 0x9A, 0x05, 0x86, 0x0E, 0x19,
+    0xDA, 0xDA, 0x88, 0xB1, 0x8B, 0x25, 0x90, 0x3A, 0x74, 0xC0, 0x12, 0x4C, 0xB0, 0x58, 0x95, 0x5B,
+    0x4C, 0x1B, 0xE7, 0xB8, 0xE7, 0xB4, 0x25, 0x81, 0x44, 0xA5, 0x28, 0x2F, 0x7E, 0xCE, 0xBB, 0xF3,
+    0xDD, 0x77, 0xDF, 0xBB, 0x77, 0x67, 0x5F, 0x83, 0x9C, 0x35, 0xA5, 0x9F, 0xA2, 0x2A, 0x01, 0x8D,
+    0xE8, 0x80, 0x68, 0x0D, 0x68, 0x42, 0x8F, 0x60, 0x79, 0x98, 0x01, 0x76, 0x2A, 0x0F, 0x89, 0xF6,
+    0xBE, 0x35, 0x66, 0x7A, 0xB4, 0xBC, 0xCC, 0x6D, 0xE5, 0x08, 0x8A, 0x16, 0x62, 0x83, 0x02, 0xEC,
+    0x42, 0x8D, 0x27, 0xD2, 0xA4, 0x48, 0xBC, 0x4E, 0xE7, 0xE0, 0x94, 0x31, 0x53, 0x83, 0xED, 0x13,
+    0xED, 0x36, 0x1A, 0x4D, 0xA0, 0x06, 0x38, 0x80, 0x2D, 0x0B, 0xE2, 0x64, 0x5B, 0xA3, 0x54, 0x19,
+    0x17, 0xA1, 0xC7, 0xB0, 0x02, 0x14, 0xF0, 0x5F, 0xB1, 0x95, 0x9F, 0x93, 0x5F, 0x85, 0x2B, 0xC7,
+    0xAE, 0xD3, 0x31, 0x83, 0x9C, 0xE3, 0xE5, 0xD0, 0x76, 0x65, 0xD9, 0xA7, 0xC3, 0x93, 0xC6, 0xCB,
+    0x1E, 0x2D, 0x2F, 0x7D, 0x65, 0x1B, 0x62, 0x0A, 0x5A, 0x08, 0x01, 0x94, 0xD9, 0x5B, 0x62, 0xF9,
+    0x9F, 0xC3, 0xB5, 0xA0, 0xC5, 0xD0, 0x03, 0x18, 0xF9, 0xA5, 0xB7, 0xC0, 0xBE, 0xC0, 0x73, 0xCB,
+    0xAB, 0x35, 0xE1, 0x7B, 0xD8, 0x66, 0xC1, 0x24, 0xAA, 0x52, 0xD6, 0xBB, 0xC7, 0xA3, 0xCA, 0x02,
+    0x91, 0xDD, 0x78, 0xD3, 0xAB, 0xE5, 0x65, 0x6E, 0xCB, 0x4E, 0x42, 0xC6, 0xC6, 0x7E, 0x00, 0x02,
+    0xD6, 0xAF, 0x9E, 0x7A, 0x35, 0x34, 0x5E, 0x99, 0x8C, 0x24, 0x84, 0xC4, 0x1D, 0x26, 0xA8, 0xC6,
+    0x24, 0x7D, 0x05, 0x51, 0xCB, 0x48, 0xF1, 0x58, 0xB0, 0xC6, 0x66, 0xD5, 0x1C, 0xF2, 0x3D, 0x2B,
+    0x14, 0x9E, 0x37, 0x96, 0x6B, 0x70, 0xB3, 0x1A, 0x26, 0x76, 0x14, 0xAA, 0x4A, 0x3F, 0xDB, 0x38,
+    0xC2, 0x83, 0x63, 0x26, 0x70, 0x34, 0xFA, 0x9E, 0xC1, 0xFE, 0x1D, 0x82, 0x31, 0x44, 0x0A, 0xB1,
+    0xE0, 0x59, 0xF2, 0x99, 0x92, 0x47, 0x37, 0x8A, 0x25, 0x7A, 0x5A, 0x7A, 0x4D, 0x8B, 0x9E, 0xD8,
+    0x0F, 0xB4, 0xA3, 0x18, 0x4E, 0x13, 0x62, 0x0D, 0x06, 0x1F, 0x85, 0x12, 0xCA, 0x28, 0x2D, 0x06,
+    0x22, 0x6C, 0xBF, 0x4D, 0xAC, 0x36, 0x63, 0x73, 0xB6, 0x39, 0x65, 0x5A, 0xBC, 0xA4, 0xA5, 0x0C,
+    0xAA, 0x33, 0x37, 0x8C, 0x43, 0x62, 0x8A, 0x95, 0x82, 0xF7, 0xAD, 0x9F, 0xC5, 0x19, 0x22, 0x69,
+    0x0D, 0xB7, 0xB5, 0x70, 0x0A, 0x6E, 0x1B, 0xFA, 0xCF, 0x1C, 0x7B, 0x42, 0xCA, 0x7A, 0xB6, 0xF5,
+    0xE2, 0x41, 0x36, 0x07, 0x77, 0x15, 0x26, 0x27, 0xFC, 0x38, 0x3A, 0x27, 0xCD, 0x42, 0x12, 0x63,
+    0xDD, 0x85, 0x3B, 0x7F, 0xE2, 0x87, 0x76, 0x9A, 0xE4, 0x31, 0x99, 0xB4, 0xF9, 0x5E, 0x9A, 0x91,
+    0x4F, 0x91, 0x45, 0x1B, 0x79, 0x99, 0x03, 0xC9, 0xD9, 0x2C, 0x0E, 0x9D, 0xB1, 0x2A, 0x7E, 0xD6,
+    0x73, 0x65, 0x9C, 0x81, 0x0F, 0x81, 0xF1, 0xB0, 0x0B, 0x41, 0x15, 0xFC, 0x16, 0xCF, 0x18, 0xAA,
+    0x87, 0xA0, 0xC9, 0x5C, 0xAB, 0x4A, 0x2E, 0xCA, 0x1F, 0x94, 0x31, 0x9C, 0xE2, 0x50, 0xA3, 0xCE,
+    0xEA, 0x76, 0xCE, 0x48, 0x0F, 0xA6, 0x95, 0xC2, 0xF4, 0x20, 0xB8, 0x79, 0xCA, 0xDC, 0x08, 0x87,
+    0x11, 0x8C, 0xBD, 0x2E, 0xF1, 0xA8, 0xB2, 0xB2, 0x47, 0xAA, 0xCB, 0x1A, 0xDB, 0x7D, 0x9E, 0x76,
+    0x89, 0x0A, 0xA7, 0xC4, 0x74, 0x89, 0xE5, 0x45, 0x89, 0x77, 0x16, 0x2E, 0x06, 0xA7, 0xD0, 0x08,
+    0x55, 0x37, 0xE6, 0x4D, 0xD6, 0x11, 0x37, 0x21, 0xAA, 0x04, 0xF7, 0x53, 0x1D, 0x2D, 0x94, 0x8D,
+    0x08, 0x89, 0x90, 0x46, 0xE8, 0xB0, 0x0D, 0x67, 0x86, 0x8D, 0xFB, 0x89, 0x8A, 0x25, 0xF2, 0x50,
+    0x1C, 0x3A, 0x76, 0x99, 0x55, 0xC6, 0x93, 0x92, 0x0B, 0x15, 0xBF, 0x10, 0x56, 0x02, 0x6E, 0x7E,
+    0x82, 0xA2, 0xDB, 0x51, 0x31, 0xC3, 0xC0, 0xEA, 0x71, 0xFC, 0x43, 0xA5, 0x58, 0x25, 0xEA, 0x0D,
+    0x16, 0x5A, 0xD4, 0x3E, 0x97, 0xC4, 0x6A, 0x86, 0xD3, 0xD3, 0x54, 0x44, 0x56, 0xD0, 0x52, 0x27,
+    0x66, 0x84, 0xCC, 0x43, 0x71, 0xE8, 0xFB, 0xA7, 0xE1, 0x7A, 0x7B, 0xEC, 0x2E, 0x7D, 0xD4, 0xD4,
+    0x01, 0x12, 0xA7, 0x5E, 0xC1, 0x24, 0x97, 0xDC, 0xAA, 0x91, 0x20, 0xD9, 0xE3, 0x39, 0x82, 0x4B,
+    0x9D, 0xEA, 0x54, 0xE7, 0xA6, 0x76, 0x33, 0x3B, 0x35, 0xC2, 0xC1, 0xBF, 0xC9, 0xD4, 0xCD, 0x3A,
+    0x96, 0x9A, 0x1C, 0x6C, 0xB5, 0xA4, 0xDF, 0xD4, 0x3F, 0x50, 0x68, 0x7B, 0xBC, 0x5D, 0xBA, 0x4F,
+    0x9E, 0xDA, 0x09, 0x87, 0x50, 0x49, 0xEF, 0xB7, 0x18, 0x6D, 0x1B, 0xD4, 0xED, 0x83, 0xA5, 0x81,
+    0xA6, 0xF9, 0x82, 0xBF, 0x08, 0x5E, 0x62, 0x84, 0x42, 0x3A, 0xF8, 0xEB, 0xAF, 0xFA, 0x85, 0xC2,
+    0x5B, 0x88, 0x2C, 0x4C, 0xF3, 0x77, 0x62, 0x5C, 0xE3, 0x44, 0x16, 0x98, 0x6A, 0xE2, 0x88, 0xF9,
+    0xB0, 0xEB, 0x36, 0x5B, 0x1E, 0x33, 0x3D, 0x1A, 0xE1, 0x24, 0xB1, 0x13, 0xBF, 0xD3, 0x0C, 0x3A,
+    0x68, 0x0F, 0x00, 0x14, 0xF7, 0xFC, 0x57, 0x24, 0x1F, 0x7D, 0x5E, 0xFF, 0xD1, 0xB9, 0x42, 0x4A,
+    0x04, 0xE7, 0x28, 0x48, 0x10, 0x3B, 0x28, 0x0B, 0x29, 0x78, 0xC3, 0x97, 0x0A, 0x7C, 0x22, 0x6E,
+    0x96, 0xF7, 0x0B, 0xF8, 0x93, 0x53, 0xD8, 0x81, 0xC9, 0x4D, 0xB2, 0x89, 0x5F, 0xAD, 0x55, 0x41,
+    0x6F, 0x1C, 0x35, 0x14, 0xFE, 0xC6, 0x6E, 0x3A, 0x52, 0x2D, 0xC5, 0x95, 0xE0, 0x44, 0x51, 0x27,
+    0x3F, 0x80, 0xCE, 0x5C, 0x38, 0xF4, 0x90, 0xD9, 0x1D, 0xB5, 0xD0, 0x1E, 0x10, 0x22, 0xFC, 0x0D,
+    0x2E, 0xCB, 0x01, 0xA1, 0x08, 0x25, 0xC4, 0xE2, 0xCA, 0xA1, 0xF0, 0x07, 0x10, 0x07, 0x2E, 0x05,
+    0x65, 0xE9, 0x21, 0xAA, 0x86, 0x65, 0xD3, 0x35, 0x2D, 0x12, 0x87, 0x1E, 0x3A, 0xA2, 0x07, 0x8E,
+    0x18, 0x84, 0xC4, 0x61, 0x25, 0xB0, 0x88, 0x69, 0x86, 0x64, 0x76, 0xCD, 0xF3, 0x6C, 0xD2, 0x24,
+    0x25, 0x21, 0x41, 0xC2, 0xF1, 0x3A, 0xE3, 0x37, 0xF6, 0x7B, 0x9F, 0xBF, 0xF7, 0xF9, 0xCD, 0x39,
+    0x5C, 0xAF, 0xB2, 0x3C, 0xB2, 0xC5, 0x39, 0x20, 0x2A, 0xE6, 0xF2, 0x68, 0xAB, 0x4A, 0xFE, 0x65,
+    0xB0, 0x48, 0xD0, 0x0E, 0xDC, 0xC8, 0x06, 0xBE, 0x00, 0x20, 0x35, 0x9F, 0xC2, 0x95, 0x57, 0xA2,
+    0x8A, 0x26, 0x1B, 0x10, 0x0A, 0xE5, 0x99, 0x07, 0x59, 0xDC, 0xB4, 0x72, 0x82, 0xCF, 0x11, 0x5A,
+    0xA2, 0x82, 0x23, 0xF7, 0x12, 0xD3, 0x34, 0x59, 0xA2, 0x77, 0x70, 0x67, 0x19, 0x12, 0xAC, 0x99,
+    0xB8, 0xC6, 0x32, 0xC4, 0x87, 0x8A, 0xD9, 0x12, 0x43, 0xA1, 0x12, 0x94, 0x71, 0x25, 0x94, 0x43,
+    0x99, 0x43, 0xDC, 0x52, 0xF8, 0xBA, 0x86, 0xD8, 0xAD, 0xB0, 0x99, 0x51, 0xD4, 0x7A, 0xF6, 0x2E,
+    0xA3, 0xE8, 0x8D, 0x50, 0xDC, 0x94, 0x48, 0x5E, 0x53, 0x18, 0xB6, 0x08, 0x96, 0x80, 0xCB, 0x00,
+    0xA7, 0xF8, 0x57, 0x01, 0x06, 0x72, 0xFE, 0x4C, 0x5F, 0x72, 0xCC, 0x3A, 0xA1, 0x5D, 0x06, 0x37,
+    0xC4, 0x9F, 0x16, 0xDB, 0x06, 0xDE, 0xA2, 0x19, 0xC2, 0x75, 0xE0, 0x64, 0xE1, 0x62, 0x1D, 0x16,
+    0xA0, 0xDE, 0x73, 0x66, 0x11, 0x19, 0xD0, 0x71, 0xA2, 0x30, 0xDB, 0xDF, 0x9B, 0x14, 0x6E, 0x15,
+    0xAE, 0xC6, 0xB6, 0x85, 0x77, 0x98, 0x0C, 0x51, 0x77, 0x69, 0xAF, 0x72, 0x71, 0xF5, 0x74, 0x6F,
+    0x37, 0x70, 0x2C, 0x81, 0x3B, 0xC1, 0x4F, 0xAC, 0x90, 0x82, 0xD0, 0x32, 0x13, 0x38, 0x3B, 0xE5,
+    0xD1, 0xFB, 0x9E, 0x9F, 0x00, 0x1D, 0xF1, 0x8D, 0xA5, 0x23, 0x80, 0x57, 0xF9, 0xC9, 0x7D, 0xF9,
+    0x6C, 0x2E, 0xDB, 0xC7, 0x91, 0x7F, 0xE2, 0x7D, 0x48, 0xF0, 0x1C, 0xB0, 0x08, 0x56, 0x05, 0x74,
+    0x0B, 0xC8, 0xFF, 0xD9, 0x30, 0x97, 0x2E, 0x5E, 0x5D, 0x58, 0xC6, 0x5D, 0xC3, 0x1F, 0xAA, 0xF9,
+    0x14, 0x6F, 0x9F, 0xD1, 0xB5, 0xDB, 0x7E, 0xFC, 0xE8, 0xF5, 0xFC, 0x8E, 0xE3, 0x95, 0x2C, 0x72,
+    0x1C, 0xF3, 0x0F, 0xC7, 0xC2, 0x2D, 0x4A, 0x71, 0xDF, 0x64, 0x42, 0x5D, 0x3C, 0xD6, 0x27, 0x65,
+    0xE4, 0x69, 0x7F, 0xA3, 0xF7, 0xC4, 0xBF, 0x72, 0x30, 0x0D, 0xB4, 0xD2, 0x72, 0xDA, 0x14, 0xD6,
+    0x8B, 0x83, 0x49, 0x4A, 0x24, 0x16, 0x6C, 0x02, 0xD6, 0x20, 0x9A, 0x02, 0x97, 0x8E, 0x2C, 0xF3,
+    0xFE, 0x1A, 0xF9, 0xE5, 0xFA, 0xC8, 0xDF, 0xB7, 0x7C, 0xC2, 0xEB, 0xA4, 0xEA, 0xEA, 0xE7, 0x8E,
+    0xD8, 0x5B, 0x45, 0x71, 0x4B, 0xBA, 0x46, 0x50, 0x02, 0x44, 0x6B, 0x88, 0x2B, 0xC4, 0x3D, 0x8D,
+    0x74, 0xA4, 0x30, 0xF8, 0x1D, 0x6C, 0xDC, 0x83, 0x58, 0xCF, 0x91, 0x6E, 0xAC, 0x60, 0x50, 0x35,
+    0x6C, 0xAC, 0x9C, 0xE8, 0x33, 0x9B, 0x96, 0xDC, 0x0C, 0x0C, 0xFF, 0x7E, 0xAC, 0xC4, 0x77, 0x7D,
+    0xC8, 0x4F, 0x48, 0xA3, 0x03, 0x83, 0x6C, 0xAC, 0xD0, 0xED, 0x03, 0xEF, 0x07, 0x3F, 0x42, 0x07,
+    0xF5, 0xE7, 0xC0, 0x3B, 0xAD, 0xD6, 0xDE, 0x2A, 0xFE, 0xF0, 0xD6, 0xBF, 0xD9, 0x34, 0x58, 0xAC,
+    0x91, 0xBB, 0x93, 0xFB, 0x2A, 0xF0, 0x6E, 0x43, 0x71, 0xE9, 0x46, 0xF4, 0x2D, 0xD2, 0xBB, 0x16,
+    0x83, 0xC7, 0x15, 0x1B, 0xDF, 0xD4, 0x62, 0x5D, 0xEA, 0xB4, 0x94, 0xC5, 0xC0, 0x64, 0x04, 0xA3,
+    0x23, 0xFA, 0xC8, 0x53, 0xBA, 0x4C, 0xEF, 0x19, 0xFC, 0x35, 0x56, 0xD1, 0x6E, 0x1F, 0x6C, 0x5A,
+    0x82, 0xEF, 0x18, 0xC4, 0x66, 0xFF, 0xAE, 0x84, 0x33, 0x5E, 0x99, 0x1D, 0x8E, 0xFD, 0x17, 0x0C,
+    0x61, 0xFB, 0xF3, 0x41, 0x47, 0x94, 0xD3, 0xA0, 0xF1, 0xA5, 0x19, 0x33, 0x8A, 0x8A, 0xC7, 0xA3,
+    0x02, 0xA2, 0x6E, 0xF3, 0xF1, 0xFF, 0x71, 0x25, 0x23, 0x13, 0x3F, 0x54, 0x91, 0xC7, 0xEC, 0x96,
+    0x9F, 0x1D, 0x27, 0x65, 0xBC, 0x05, 0x4B, 0x40, 0xB1, 0x12, 0x8A, 0x1B, 0x6D, 0xB5, 0x5B, 0xDE,
+    0x16, 0xFE, 0xD5, 0x1A, 0x0D, 0x99, 0x1C, 0xBD, 0xB2, 0xA7, 0xFF, 0x0E, 0x73, 0xEE, 0xF6, 0x38,
+    0x37, 0xC4, 0x79, 0x25, 0xD6, 0x45, 0xE0, 0x5C, 0x0D, 0x4C, 0x72, 0x6D, 0xAC, 0x32, 0xE2, 0xBC,
+    0x73, 0xB9, 0xC4, 0x2A, 0x71, 0xBE, 0x49, 0xF8, 0x3D, 0xE1, 0x27, 0xCE, 0x19, 0x71, 0xCE, 0xCD,
+    0x8C, 0x13, 0x42, 0x73, 0xC3, 0x82, 0x53, 0xDD, 0xBD, 0xF0, 0xE9, 0xE1, 0x83, 0xE4, 0xA7, 0x11,
+    0x7E, 0xA8, 0x53, 0xDD, 0x96, 0x06, 0x5D, 0xF2, 0x21, 0xDB, 0x1B, 0x4D, 0x6D, 0x34, 0x41, 0xE4,
+    0xBD, 0x8D, 0x6A, 0xAC, 0x51, 0xFD, 0xE1, 0x86, 0x78, 0x5A, 0xA1, 0xB5, 0xF2, 0x16, 0x25, 0x76,
+    0x9B, 0x92, 0xBC, 0x1A, 0x54, 0x4C, 0x0C, 0xC4, 0x3F, 0xD2, 0x47, 0x22, 0x18, 0x86, 0x54, 0x0D,
+    0x3B, 0x19, 0x19, 0x29, 0x45, 0x52, 0xDD, 0x43, 0xA2, 0xC5, 0x74, 0xA4, 0xD1, 0xF3, 0x6A, 0xA6,
+    0x7A, 0x2A, 0x8A, 0xBE, 0x09, 0x4F, 0xD1, 0x6D, 0xC4, 0xDE, 0xF1, 0x5F, 0x7A, 0xD7, 0x0D, 0xB3,
+    0x16, 0xF9, 0x0A, 0x51, 0x40, 0x4C, 0x28, 0xDC, 0x33, 0x48, 0x57, 0x28, 0x42, 0xC1, 0xEF, 0x5B,
+    0x6E, 0xBB, 0x5F, 0xD8, 0xC8, 0xCF, 0x74, 0xB5, 0x10, 0x15, 0x98, 0xA7, 0x6F, 0x49, 0x44, 0x3E,
+    0x70, 0x69, 0x66, 0xA3, 0x8B, 0x57, 0x21, 0xF1, 0x9E, 0x3E, 0x11, 0xB1, 0x95, 0x8A, 0xCA, 0x9B,
+    0x46, 0xFC, 0x80, 0xC0, 0xD7, 0xB4, 0x26, 0x3B, 0x0C, 0x6C, 0x1F, 0x69, 0x10, 0x12, 0xFF, 0x99,
+    0xEA, 0xAF, 0x25, 0xF2, 0x6B, 0x61, 0xA2, 0x06, 0xA3, 0x71, 0x83, 0xF3, 0xBE, 0x2D, 0xCD, 0x24,
+    0xD7, 0x8B, 0xA8, 0x5E, 0x44, 0x36, 0x45, 0xB4, 0xD9, 0x1A, 0x5E, 0xF8, 0x08, 0x6B, 0xBE, 0xE8,
+    0xDC, 0xA0, 0x3A, 0x9E, 0x49, 0xF0, 0x1F, 0x34, 0x48, 0x44, 0xA4, 0x7F, 0xF1, 0x1B, 0xD8, 0xAF,
+    0x1A, 0x35, 0x65, 0x3A, 0x43, 0x97, 0xEF, 0x8C, 0x90, 0x4C, 0xB1, 0xDF, 0xF8, 0x4F, 0x21, 0x00,
+    0x45, 0xB4, 0x1B, 0xA4, 0xE3, 0x97, 0x67, 0x46, 0x46, 0x45, 0x3D, 0xF6, 0x5E, 0xC7, 0x14, 0x93,
+    0xD2, 0x26, 0x3F, 0x08, 0x6B, 0x02, 0x5D, 0xA4, 0x22, 0xF1, 0x2C, 0xCC, 0x80, 0x9B, 0x6D, 0x85,
+    0x83, 0x04, 0xCA, 0x93, 0x02, 0x1D, 0x16, 0x72, 0x90, 0xED, 0x78, 0x44, 0xA3, 0x83, 0x40, 0xC8,
+    0x33, 0xA4, 0x12, 0xF3, 0x12, 0x17, 0xE2, 0x76, 0x7E, 0xFE, 0x33, 0xA2, 0xA3, 0x92, 0x1F, 0x6F,
+    0x4A, 0x25, 0x1E, 0xE8, 0xF0, 0x25, 0x0A, 0x58, 0x89, 0xD9, 0x5D, 0x85, 0xAF, 0x2C, 0x3A, 0x94,
+    0x65, 0xA1, 0xA5, 0x9E, 0x7E, 0xA9, 0xE3, 0xBD, 0x94, 0x9C, 0xD4, 0xFE, 0x06, 0xAD, 0x54, 0x3D,
+    0x4C, 0x14, 0x41, 0x18, 0x7D, 0xB3, 0x83, 0x6C, 0xC2, 0x26, 0x8E, 0xC5, 0x25, 0x16, 0x06, 0xB6,
+    0xB1, 0x32, 0x72, 0xDB, 0x58, 0x50, 0xDC, 0x71, 0x93, 0x50, 0x50, 0x58, 0x48, 0x81, 0x36, 0x16,
+    0xF6, 0x16, 0x68, 0x61, 0xA1, 0xC9, 0xC1, 0x4D, 0x62, 0x69, 0xA1, 0x16, 0xD6, 0xC6, 0x4E, 0xB0,
+    0x38, 0x0A, 0x62, 0xB6, 0x38, 0xB8, 0x49, 0x2C, 0x28, 0x68, 0x2E, 0x1A, 0x63, 0x61, 0xE1, 0x14,
+    0x52, 0x88, 0x85, 0x6B, 0x58, 0xE2, 0x06, 0xEF, 0x6E, 0xFC, 0x66, 0x39, 0xFF, 0x00, 0xE5, 0xE7,
+    0x98, 0xDD, 0xEC, 0xCE, 0x4C, 0x66, 0xDF, 0xFB, 0xDE, 0xF7, 0xBD, 0xFD, 0x00, 0x37, 0x02, 0x6B,
+    0xAD, 0x89, 0xE8, 0x91, 0x45, 0x4A, 0x28, 0x08, 0xE5, 0x19, 0x04, 0x1A, 0x31, 0x78, 0x0B, 0x45,
+    0xB0, 0x04, 0x81, 0x42, 0x15, 0xDE, 0xFA, 0xD5, 0x10, 0x68, 0xDA, 0x55, 0x8D, 0x68, 0xE1, 0xD9,
+    0xCF, 0x4D, 0x03, 0x21, 0xE9, 0xA4, 0x97, 0xD0, 0x49, 0x94, 0xDD, 0x66, 0x60, 0x68, 0x13, 0xCD,
+    0xCF, 0x84, 0x39, 0xE8, 0x30, 0x73, 0x0A, 0xDC, 0x94, 0x83, 0x8F, 0x50, 0xB3, 0xBE, 0x6D, 0x85,
+    0x8F, 0x3B, 0x69, 0x34, 0x61, 0xBC, 0x0E, 0x1A, 0x55, 0x08, 0xCD, 0xD7, 0x34, 0x32, 0x94, 0x63,
+    0x08, 0x6B, 0xDF, 0x2B, 0x74, 0x17, 0x9E, 0xD3, 0x54, 0xC1, 0x77, 0xBB, 0x28, 0x21, 0xD4, 0x84,
+    0xCD, 0x2D, 0x06, 0xC4, 0x46, 0xD6, 0xAD, 0xEB, 0xA8, 0xE3, 0xD9, 0x14, 0xBF, 0x47, 0x03, 0x8E,
+    0x9F, 0xE2, 0xC4, 0x9D, 0x7C, 0x5D, 0xEB, 0x4A, 0x52, 0x23, 0x63, 0xD6, 0x0E, 0x14, 0x37, 0x31,
+    0xA2, 0x40, 0xB1, 0x24, 0x46, 0x91, 0x56, 0xAD, 0xE5, 0x6B, 0x59, 0x60, 0x3B, 0x58, 0xA9, 0xAB,
+    0x40, 0x55, 0x11, 0x7B, 0x49, 0xA0, 0x84, 0x8C, 0xD1, 0xD8, 0x39, 0x19, 0x5E, 0x56, 0x0E, 0x0D,
+    0xB3, 0xC8, 0x3C, 0xC3, 0x15, 0x30, 0x75, 0xE1, 0xAB, 0xFD, 0xF6, 0xB6, 0x8B, 0x36, 0xD2, 0x3D,
+    0x57, 0xFF, 0x34, 0x84, 0x0F, 0x97, 0x32, 0xAE, 0x81, 0x31, 0xC0, 0x03, 0x0A, 0x43, 0x0F, 0xC3,
+    0xCD, 0x0F, 0xD3, 0x5D, 0x54, 0x48, 0x12, 0x29, 0x4A, 0x29, 0x9D, 0x7F, 0x4C, 0xE8, 0x8B, 0x02,
+    0x46, 0x21, 0xC0, 0x25, 0x64, 0x0E, 0x90, 0x8C, 0xC0, 0x5F, 0x53, 0x08, 0x13, 0xF4, 0x10, 0xFB,
+    0x8E, 0x8A, 0xEB, 0xAA, 0xB8, 0x81, 0x8A, 0x66, 0x2E, 0xC5, 0x85, 0xA1, 0xFB, 0xAB, 0xED, 0xF2,
+    0xD6, 0x44, 0x46, 0x01, 0x51, 0x14, 0xE5, 0x7D, 0x1E, 0x6E, 0x70, 0xE3, 0xCA, 0x35, 0x92, 0xAB,
+    0x20, 0x1D, 0xF6, 0x63, 0x68, 0xDB, 0xE3, 0x28, 0x54, 0x81, 0x9D, 0x7B, 0x1C, 0x88, 0x5A, 0xF0,
+    0xBB, 0x64, 0x09, 0x03, 0x3F, 0x73, 0x09, 0xA6, 0x8F, 0x73, 0xB7, 0x4C, 0xA1, 0xD1, 0xAC, 0xA7,
+    0x35, 0xAB, 0x76, 0x6A, 0x49, 0xAC, 0xE3, 0xCE, 0x40, 0xC6, 0xCD, 0xE7, 0x3D, 0xDB, 0x99, 0x1D,
+    0x5C, 0x73, 0xDE, 0xF2, 0x0D, 0xC2, 0x14, 0x51, 0x8A, 0x30, 0xB7, 0x63, 0x8A, 0xE2, 0x4A, 0x7D,
+    0xD5, 0x9A, 0x9E, 0x03, 0xE6, 0xC0, 0xAC, 0xE4, 0xAF, 0x5A, 0x43, 0x58, 0xEC, 0x93, 0x3F, 0x52,
+    0x7E, 0x87, 0x25, 0xC9, 0x98, 0xA7, 0x8F, 0xC0, 0x7F, 0x4C, 0xC2, 0x25, 0x50, 0x59, 0x31, 0x43,
+    0xEE, 0x05, 0x9B, 0x01, 0xCF, 0x0E, 0x45, 0x68, 0x5C, 0x9A, 0xAB, 0x60, 0x2D, 0x56, 0x45, 0xCD,
+    0x79, 0x40, 0xC8, 0x84, 0xBF, 0xD3, 0xB0, 0x39, 0x47, 0x5F, 0xE2, 0xFF, 0xAA, 0xFC, 0xE1, 0xC4,
+    0x37, 0xAD, 0xFD, 0x62, 0x6D, 0x17, 0xA1, 0xB3, 0xA2, 0x13, 0x72, 0xC4, 0xD7, 0x69, 0x22, 0x22,
+    0x1C, 0xFA, 0xD1, 0x31, 0x0C, 0x9C, 0xD5, 0xF0, 0x53, 0x30, 0x90, 0xC8, 0xBB, 0x98, 0x9B, 0x6E,
+    0xDA, 0xC9, 0x75, 0xB2, 0x67, 0x91, 0xFC, 0x40, 0xDD, 0xE4, 0xD7, 0xA4, 0x01, 0xF1, 0x89, 0xCA,
+    0x3D, 0x4C, 0xCA, 0x19, 0xB5, 0x09, 0x5C, 0x57, 0x95, 0x3C, 0xFE, 0x12, 0xA1, 0x6C, 0x25, 0xE0,
+    0x6D, 0x20, 0xCC, 0x7F, 0x8E, 0x7E, 0x83, 0x73, 0x99, 0x1E, 0x65, 0x28, 0x71, 0x75, 0xC9, 0xA7,
+    0x5F, 0xEC, 0x09, 0x01, 0x4A, 0x7A, 0xBA, 0xF6, 0xB6, 0xEF, 0xAD, 0xC1, 0xB7, 0x25, 0x45, 0x76,
+    0x00, 0xB5, 0xA0, 0x7D, 0xEA, 0x8B, 0xFF, 0xA3, 0xDE, 0x9B, 0x82, 0x5B, 0x1B, 0xA1, 0xD5, 0xBB,
+    0x53, 0x40, 0x67, 0xCF, 0x30, 0x44, 0xC6, 0xF0, 0xA7, 0x6D, 0xDC, 0x3E, 0xE7, 0xD6, 0x81, 0x84,
+    0xA0, 0x12, 0x53, 0x45, 0x0F, 0x7A, 0x7D, 0x27, 0x49, 0x0D, 0xB0, 0x4D, 0x8D, 0x72, 0x24, 0x85,
+    0xB6, 0xF5, 0xC4, 0xEB, 0xF5, 0xE9, 0xA9, 0x01, 0xD8, 0x49, 0xBC, 0xB4, 0xFA, 0x7C, 0xE0, 0x12,
+    0x7B, 0x0A, 0x6C, 0x42, 0x23, 0x4D, 0x50, 0x2E, 0x41, 0x5C, 0x01, 0x7F, 0xB3, 0x7B, 0x91, 0x62,
+    0x36, 0x42, 0x65, 0x72, 0xBB, 0xD9, 0xAA, 0x65, 0x4B, 0xB9, 0x05, 0xDB, 0x08, 0x73, 0x4F, 0x9D,
+    0x40, 0x34, 0x9C, 0x5A, 0x3D, 0xF5, 0xAC, 0xBC, 0x57, 0x16, 0xFE, 0x11, 0x40, 0x6F, 0x21, 0xFD,
+    0xD7, 0x09, 0x4F, 0x6B, 0x2F, 0x3A, 0xBE, 0x7D, 0xE0, 0x72, 0xC1, 0xE4, 0x00, 0x2E, 0x52, 0x6F,
+    0x25, 0x04, 0x2F, 0xC7, 0x3A, 0x81, 0x70, 0x3C, 0x6A, 0xC0, 0x66, 0x98, 0xE4, 0x81, 0x2D, 0xE3,
+    0x38, 0xC9, 0xA1, 0x2F, 0xC0, 0x49, 0xCF, 0xE2, 0x22, 0x82, 0x00, 0xB8, 0x67, 0xC0, 0x4E, 0x2A,
+    0xB6, 0x63, 0x8E, 0x1F, 0xAD, 0x54, 0xCF, 0x6F, 0x1B, 0x45, 0x18, 0x7D, 0xEB, 0xC9, 0xB2, 0x34,
+    0x2B, 0x7B, 0x42, 0x15, 0x8B, 0x0B, 0xC9, 0xF6, 0xC0, 0x81, 0x1F, 0xB5, 0x7D, 0xE9, 0x21, 0x48,
+    0xBB, 0xF6, 0x36, 0x1C, 0x38, 0xE4, 0x50, 0x0B, 0xC5, 0x5C, 0x10, 0xF4, 0x2F, 0x40, 0xE4, 0x90,
+    0x83, 0x5B, 0x6D, 0x9B, 0x8D, 0x02, 0x27, 0x0E, 0xE1, 0xCE, 0x81, 0x48, 0x5C, 0x90, 0x39, 0xE0,
+    0x43, 0x54, 0x19, 0x70, 0xF0, 0x34, 0x91, 0xF0, 0x91, 0x4D, 0x72, 0xE8, 0x01, 0x89, 0xAE, 0x90,
+    0xE0, 0x90, 0x4A, 0x30, 0x52, 0x57, 0xAA, 0xD3, 0xAE, 0x3D, 0xFD, 0xC6, 0x8E, 0xDD, 0x92, 0xF2,
+    0x23, 0x12, 0x8C, 0xAD, 0xD9, 0x99, 0xB1, 0xF7, 0xFB, 0xDE, 0x7B, 0xDF, 0xFB, 0x06, 0x26, 0xE0,
+    0x48, 0xE4, 0xB2, 0x60, 0x6F, 0xFA, 0xB8, 0x25, 0x60, 0x7F, 0x0A, 0x1A, 0x55, 0xCC, 0xBA, 0xE0,
+    0x57, 0xC0, 0x0E, 0x05, 0x12, 0x09, 0xEF, 0x99, 0x8D, 0x6F, 0x1D, 0x48, 0x96, 0xAC, 0x7D, 0xD5,
+    0xB7, 0xD4, 0x27, 0x3E, 0x46, 0xC3, 0xDE, 0x8B, 0x20, 0x5B, 0x28, 0xCC, 0x83, 0x2D, 0x86, 0xFA,
+    0x60, 0x1B, 0x50, 0x21, 0x78, 0xEF, 0xDF, 0x1F, 0x2D, 0x18, 0x8F, 0x04, 0x1C, 0x17, 0xEC, 0x20,
+    0x41, 0xCA, 0x1F, 0x2A, 0x94, 0x54, 0x78, 0x12, 0x16, 0xE5, 0x12, 0xE6, 0x39, 0xB8, 0xED, 0x4F,
+    0x33, 0x9D, 0xCA, 0xF0, 0x51, 0xFD, 0x2B, 0x48, 0x93, 0x8D, 0x07, 0x67, 0x49, 0xF0, 0xFD, 0xC1,
+    0xD7, 0x89, 0x33, 0x28, 0xFC, 0x77, 0x1C, 0x02, 0x58, 0x05, 0x38, 0xC5, 0x89, 0x47, 0x0F, 0x45,
+    0x18, 0xAA, 0xB3, 0x30, 0xF9, 0xDF, 0xCB, 0x43, 0x9B, 0xC8, 0x48, 0xDA, 0xE8, 0x3B, 0x47, 0xEA,
+    0xB2, 0xFA, 0x25, 0x82, 0x11, 0x0D, 0x5F, 0x27, 0x24, 0x84, 0x88, 0x51, 0xB6, 0xD9, 0x31, 0xBB,
+    0x8A, 0x9E, 0x32, 0x4A, 0xCF, 0x45, 0x47, 0xD3, 0x8B, 0xE6, 0xC7, 0x7A, 0x86, 0x68, 0xC1, 0xFA,
+    0x1C, 0x4C, 0xA2, 0x4C, 0x9C, 0x22, 0x24, 0x3D, 0x7C, 0x17, 0x5A, 0xBB, 0x92, 0xDD, 0x45, 0xC9,
+    0x12, 0xDC, 0x43, 0x8F, 0xFB, 0xF5, 0x16, 0x13, 0x65, 0x16, 0x49, 0x07, 0x01, 0x67, 0xA2, 0x05,
+    0x19, 0xD8, 0x1B, 0x11, 0x3B, 0x88, 0x1C, 0x0E, 0x7B, 0x13, 0x6E, 0xA0, 0xC9, 0xDC, 0x8A, 0xE1,
+    0xC5, 0xC6, 0x3D, 0x1F, 0x8F, 0x7C, 0x96, 0x22, 0x93, 0x82, 0x4B, 0x58, 0x31, 0x4A, 0x44, 0xD8,
+    0x87, 0x37, 0x06, 0xD2, 0x1F, 0xE3, 0xB0, 0xBA, 0x44, 0x39, 0xA7, 0xE1, 0xEA, 0xB1, 0x4C, 0x50,
+    0x67, 0x03, 0xEC, 0xC0, 0x75, 0x31, 0x40, 0xE0, 0x19, 0x7F, 0xA0, 0x55, 0xCC, 0xDC, 0x45, 0xE2,
+    0xB0, 0x6E, 0x28, 0x39, 0xDB, 0xBB, 0x1D, 0xF3, 0xA5, 0x8D, 0xDD, 0xC8, 0xDE, 0xCC, 0x1C, 0x0A,
+    0xEB, 0x47, 0xE3, 0xBE, 0x60, 0x3F, 0xE3, 0x41, 0x48, 0x59, 0x3A, 0xBE, 0x91, 0x62, 0x0D, 0xE8,
+    0x8D, 0x38, 0x02, 0xDF, 0x53, 0x6C, 0xCA, 0xE2, 0x7A, 0x60, 0xE1, 0xC5, 0x13, 0x86, 0x0E, 0x71,
+    0x4E, 0x8A, 0xB0, 0x85, 0x4B, 0x48, 0x5A, 0x19, 0x89, 0x84, 0x23, 0x43, 0x2E, 0xD2, 0x6A, 0x5A,
+    0xBF, 0x43, 0x43, 0x85, 0x43, 0x56, 0x70, 0xE9, 0xEF, 0xB4, 0x64, 0x62, 0x54, 0x83, 0xA7, 0xB6,
+    0x34, 0xB8, 0xD0, 0x15, 0xE4, 0x4B, 0xA1, 0xED, 0x53, 0xA9, 0x40, 0x9E, 0x7E, 0x27, 0xD6, 0x85,
+    0x70, 0xB8, 0x6F, 0xAF, 0x4B, 0x16, 0x79, 0x86, 0xB4, 0x43, 0xD2, 0x86, 0x72, 0x38, 0xB0, 0x36,
+    0x7D, 0xDC, 0x17, 0x28, 0xC6, 0x5A, 0x58, 0xA4, 0xD0, 0x0A, 0xF0, 0x21, 0x16, 0x4B, 0xA0, 0x13,
+    0xA1, 0x14, 0x8D, 0xD0, 0x5A, 0xBB, 0x11, 0x1C, 0x7B, 0x6C, 0xEE, 0x4C, 0x3C, 0xD4, 0xC5, 0xB3,
+    0xC3, 0x8C, 0x24, 0x33, 0xFA, 0x45, 0xB4, 0xE1, 0x51, 0xFA, 0x76, 0x11, 0xBA, 0xEA, 0xC6, 0xA3,
+    0x10, 0xA4, 0xAD, 0x96, 0xF5, 0x34, 0xBE, 0xA7, 0xB6, 0x23, 0xB0, 0x21, 0x11, 0x04, 0x02, 0xAD,
+    0xB1, 0x1E, 0x25, 0xA5, 0xF6, 0x94, 0x4A, 0x27, 0x3F, 0x78, 0x67, 0x5C, 0x55, 0x94, 0x3A, 0x54,
+    0x4A, 0x57, 0x0D, 0x8E, 0x8F, 0x04, 0x04, 0x55, 0x93, 0x47, 0xAD, 0x66, 0xAB, 0x81, 0x59, 0x4B,
+    0x34, 0xA3, 0x00, 0x2C, 0x42, 0x19, 0x86, 0xD4, 0x28, 0xE8, 0x44, 0xE8, 0x93, 0x87, 0x8D, 0x4D,
+    0xA5, 0x60, 0x40, 0x9F, 0x68, 0x07, 0x60, 0x66, 0x64, 0x41, 0x95, 0x52, 0x48, 0xA1, 0xEB, 0x85,
+    0x12, 0xF4, 0x8B, 0x67, 0x5B, 0x11, 0x06, 0x7A, 0x2F, 0xA2, 0x28, 0x94, 0x86, 0x24, 0x9C, 0xD2,
+    0xD1, 0xF2, 0xB5, 0x45, 0xA5, 0xD6, 0x6B, 0x37, 0xB4, 0x6E, 0xBA, 0xC2, 0x1A, 0x74, 0xA0, 0xE5,
+    0xF0, 0x34, 0x76, 0x3A, 0x19, 0x34, 0xBE, 0x18, 0x26, 0xA3, 0x86, 0xA0, 0xD3, 0x56, 0x02, 0xD6,
+    0x1F, 0x32, 0xFB, 0x5F, 0x04, 0x71, 0xAD, 0x90, 0x9C, 0xBF, 0xA6, 0xD9, 0x9E, 0x5D, 0x10, 0xF0,
+    0xB4, 0xD2, 0x6A, 0xD3, 0xE1, 0x3F, 0x7F, 0xC0, 0x62, 0xEE, 0x07, 0xBA, 0x9F, 0xCB, 0xE4, 0xAD,
+    0x85, 0x21, 0xE0, 0x90, 0x6C, 0x2D, 0x93, 0x85, 0x8C, 0x30, 0xF0, 0xC2, 0x60, 0xDA, 0x53, 0x87,
+    0xC6, 0x76, 0x67, 0xD0, 0x19, 0xE8, 0xEE, 0x56, 0xE9, 0x6B, 0x8D, 0x2F, 0xAB, 0x66, 0x33, 0x57,
+    0x49, 0xED, 0x78, 0xD6, 0xD5, 0x46, 0xA8, 0x17, 0xEA, 0x74, 0x09, 0xBC, 0x6A, 0xA5, 0x19, 0xE1,
+    0x3A, 0x97, 0xC5, 0x14, 0x4C, 0x96, 0x36, 0x8F, 0xEC, 0xEB, 0xFB, 0x14, 0x1C, 0x41, 0x99, 0xBF,
+    0x75, 0x3B, 0x96, 0x97, 0x5E, 0x81, 0x76, 0x4F, 0xC0, 0xAF, 0xA2, 0x22, 0x8C, 0x04, 0x84, 0x4F,
+    0x2A, 0x4E, 0xDF, 0x61, 0xDB, 0x74, 0x85, 0x57, 0x84, 0xDC, 0x66, 0x8B, 0x42, 0xFF, 0x89, 0x45,
+    0x6F, 0x7F, 0x3C, 0x8A, 0x6F, 0x56, 0x4B, 0xE9, 0x37, 0xEF, 0x6F, 0x3D, 0x97, 0x9B, 0xF3, 0xDC,
+    0x76, 0xAF, 0x5A, 0x2C, 0xBB, 0xC1, 0x6A, 0x13, 0xBD, 0x76, 0xE0, 0x16, 0x72, 0x28, 0x96, 0x3D,
+    0xB7, 0xDE, 0xD4, 0xA5, 0x73, 0x50, 0xD7, 0xF8, 0x03, 0xBE, 0x18, 0x91, 0x63, 0xFC, 0x97, 0x5E,
+    0xDF, 0x4B, 0x0D, 0x31, 0x35, 0xC3, 0xFC, 0xF2, 0x46, 0x7A, 0xC9, 0x40, 0xA7, 0xDF, 0x90, 0x4C,
+    0x70, 0x32, 0xAD, 0x64, 0xB1, 0x67, 0x77, 0xA9, 0x1B, 0x71, 0xCE, 0x5B, 0x59, 0xF1, 0xCC, 0x69,
+    0x48, 0x67, 0x89, 0x68, 0x75, 0x7E, 0x3B, 0xE6, 0x23, 0x3F, 0xCB, 0x0F, 0x3F, 0x1B, 0x70, 0x6C,
+    0xE5, 0xAF, 0x0C, 0x2F, 0x30, 0xE9, 0xD2, 0x1D, 0xF4, 0xE0, 0xB8, 0x07, 0xFD, 0x94, 0xAE, 0x9D,
+    0xEC, 0x9C, 0xBF, 0xF7, 0xD1, 0x98, 0xF0, 0x84, 0x65, 0xBE, 0xE0, 0xAE, 0x56, 0xA7, 0x11, 0x5B,
+    0x62, 0xEE, 0xC5, 0x6E, 0x62, 0xA0, 0x79, 0x91, 0x09, 0x37, 0x93, 0x9A, 0x3E, 0x91, 0x5C, 0x53,
+    0x77, 0x8E, 0x76, 0x56, 0x70, 0x07, 0xD9, 0x19, 0xF8, 0xD5, 0xEA, 0xBB, 0x3C, 0x57, 0x51, 0xA2,
+    0x5A, 0xD5, 0xA8, 0x27, 0x5A, 0x9C, 0x28, 0x6E, 0x48, 0x49, 0x8A, 0xFB, 0xE6, 0x9F, 0xA9, 0x1B,
+    0x58, 0xEC, 0x67, 0xAF, 0xA9, 0x1F, 0x8C, 0x58, 0x57, 0x60, 0x4D, 0xF5, 0x3B, 0x6A, 0x90, 0xAF,
+    0x2D, 0x53, 0x1D, 0x68, 0x9E, 0x14, 0xC4, 0xC0, 0xF9, 0x41, 0xEE, 0x0D, 0xD5, 0x1D, 0x46, 0x1B,
+    0x1D, 0xA9, 0xF1, 0xC0, 0xF3, 0xD8, 0xB1, 0x92, 0x4A, 0x58, 0x1F, 0x76, 0x67, 0x4C, 0x17, 0x36,
+    0x19, 0xB4, 0x0E, 0x5B, 0x77, 0xF0, 0xDC, 0xE9, 0xF5, 0x82, 0x6E, 0x3B, 0x89, 0xF9, 0xC9, 0x9A,
+    0xA0, 0x5E, 0x70, 0xB3, 0x59, 0xF7, 0xC2, 0x90, 0x04, 0x4D, 0xAA, 0x9F, 0xAF, 0xF9, 0xF9, 0xDA,
+    0x92, 0x1A, 0x6C, 0xA1, 0x81, 0xE9, 0x6F, 0x1B, 0x47, 0x8D, 0x86, 0x69, 0x32, 0x95, 0x36, 0xE5,
+    0xAF, 0xA6, 0x09, 0xEB, 0xBD, 0xD2, 0x7A, 0x72, 0x7D, 0x7F, 0xEA, 0xDC, 0x8D, 0xE6, 0x42, 0x21,
+    0x17, 0x54, 0x9F, 0xC5, 0x4A, 0x26, 0x2D, 0x23, 0xC9, 0x50, 0x6B, 0xF4, 0xE8, 0xD6, 0xDF, 0xC2,
+    0x13, 0x86, 0xCB, 0xFD, 0xF9, 0xB9, 0x97, 0xE9, 0x82, 0xF6, 0xEC, 0xAB, 0x37, 0x7F, 0x72, 0x58,
+    0x08, 0x29, 0x8F, 0x6F, 0xD2, 0x7B, 0xC4, 0xFA, 0x5A, 0xED, 0x83, 0x15, 0x9D, 0x3E, 0x3B, 0xEC,
+    0xC5, 0xD3, 0x21, 0x9F, 0x58, 0xE9, 0x31, 0x95, 0x55, 0x51, 0x68, 0x1C, 0x55, 0x14, 0xBD, 0x6F,
+    0x26, 0xBB, 0xD3, 0x64, 0xDA, 0x4C, 0xD0, 0x2D, 0x48, 0x34, 0x99, 0x7C, 0x88, 0xD6, 0x4A, 0x76,
+    0x16, 0x59, 0x24, 0x1F, 0xBB, 0xD9, 0xD1, 0x7E, 0x14, 0xAC, 0x42, 0x90, 0xA4, 0x1F, 0x22, 0xB8,
+    0xEA, 0x87, 0x05, 0x4B, 0x1A, 0x51, 0x34, 0x94, 0x2D, 0xFB, 0x9A, 0x0A, 0xFD, 0xD3, 0xF8, 0xE1,
+    0x7F, 0xFC, 0x11, 0xDD, 0xA2, 0x89, 0x10, 0x65, 0xD4, 0x6D, 0x77, 0x42, 0x05, 0xC1, 0x50, 0x1C,
+    0x14, 0x2A, 0x18, 0x90, 0xB1, 0x8D, 0x1F, 0x36, 0x50, 0x87, 0x74, 0x53, 0xB6, 0xCD, 0xEE, 0x3E,
+    0xCF, 0x9D, 0x4D, 0x22, 0x51, 0x5A, 0xEC, 0xDB, 0xF0, 0xE6, 0xBE, 0x3B, 0xF7, 0xDD, 0x39, 0xF7,
+    0xDC, 0xF3, 0x5E, 0x0E, 0x9E, 0x6D, 0x89, 0x60, 0x40, 0x04, 0x44, 0x74, 0xFF, 0xBB, 0x4E, 0xF4,
+    0xCB, 0x7C, 0xF3, 0x95, 0xDF, 0x28, 0x85, 0x15, 0x59, 0x44, 0x11, 0xA5, 0xBA, 0x9C, 0x00, 0xBE,
+    0xE2, 0x60, 0x67, 0x99, 0xC0, 0x6F, 0xA6, 0x7D, 0x7C, 0xA4, 0xF6, 0x14, 0xB9, 0xD6, 0xE9, 0x8B,
+    0x7F, 0x35, 0x33, 0x69, 0x0E, 0x1D, 0x92, 0xF6, 0xFC, 0x21, 0xD5, 0xEC, 0xE9, 0xE1, 0x05, 0x45,
+    0x05, 0x3F, 0xB2, 0x28, 0x52, 0x7A, 0xD3, 0x6A, 0xCF, 0xF6, 0xBB, 0xAF, 0x73, 0xEE, 0x53, 0xF4,
+    0xC2, 0x98, 0x41, 0xFB, 0x13, 0x2E, 0x25, 0xA9, 0x9B, 0x84, 0x4B, 0xA9, 0x7D, 0x29, 0x12, 0x87,
+    0x7F, 0x22, 0xDA, 0x73, 0x6A, 0x88, 0xE8, 0x2C, 0x62, 0xBA, 0xA6, 0x0E, 0x90, 0x90, 0x34, 0x86,
+    0x5F, 0xC2, 0xDD, 0x4F, 0x41, 0xF7, 0xC7, 0xD8, 0x45, 0x64, 0xFC, 0x21, 0xC6, 0x13, 0x35, 0xE4,
+    0x54, 0x43, 0x96, 0x2C, 0x95, 0x47, 0x88, 0x12, 0xC3, 0xD9, 0xEC, 0x70, 0xC2, 0xAE, 0x97, 0x5B,
+    0x0B, 0xBD, 0x87, 0x96, 0x8C, 0x40, 0x93, 0xA4, 0xBF, 0xE8, 0x2C, 0xD5, 0x47, 0xFD, 0x2E, 0xB1,
+    0x7C, 0x35, 0xB8, 0x20, 0xFC, 0xAC, 0x19, 0x94, 0x2E, 0x64, 0x69, 0x2E, 0x69, 0x84, 0x0D, 0xEB,
+    0xBD, 0xEF, 0xAF, 0x5C, 0x9A, 0xCB, 0xCE, 0x0D, 0xE5, 0x7A, 0x7B, 0x73, 0x43, 0xF7, 0x6D, 0x7E,
+    0x07, 0x80, 0xE5, 0xCB, 0xB7, 0x9C, 0xD3, 0xE3, 0x44, 0xBA, 0x6A, 0x2E, 0x44, 0xD7, 0x7B, 0xCC,
+    0x2F, 0x37, 0xAE, 0x6C, 0x34, 0x52, 0xBA, 0x5B, 0x58, 0x3A, 0x8E, 0x64, 0x6F, 0xE1, 0xAB, 0x03,
+    0x5C, 0x97, 0x67, 0xAE, 0xD2, 0x83, 0xA1, 0x50, 0x4A, 0x01, 0x76, 0x65, 0xF6, 0xCE, 0x2F, 0xCA,
+    0x4A, 0xB5, 0xF6, 0x4F, 0x4C, 0x8C, 0x6F, 0x3F, 0x05, 0x72, 0x27, 0x6C, 0xF5, 0x27, 0x0D, 0xE4,
+    0x8F, 0xD6, 0x54, 0xA3, 0x48, 0x62, 0x7E, 0x36, 0xA6, 0x86, 0x1C, 0xD5, 0x20, 0x4D, 0x55, 0x94,
+    0x6F, 0x49, 0xD2, 0xEA, 0x39, 0x78, 0x72, 0x45, 0x4C, 0xDD, 0xB4, 0x3D, 0xF6, 0x68, 0x95, 0x4A,
+    0xE5, 0x5C, 0x80, 0xD4, 0x88, 0xC4, 0xC8, 0x76, 0xDC, 0xFD, 0xB2, 0xBB, 0xFF, 0x6A, 0x72, 0xEA,
+    0xF7, 0x0F, 0xFA, 0xCF, 0x24, 0x4F, 0xDE, 0x80, 0xF7, 0xD8, 0xD0, 0xA3, 0xEF, 0xBC, 0x31, 0x78,
+    0x7A, 0xE9, 0x07, 0xFD, 0x81, 0xBD, 0xD9, 0xB9, 0xC7, 0xA8, 0xF8, 0x88, 0x5E, 0x7C, 0xD2, 0xC8,
+    0x7C, 0xF1, 0x91, 0x73, 0x6C, 0xAF, 0xEE, 0x4E, 0x25, 0x25, 0xAA, 0xA3, 0x27, 0xD6, 0xA6, 0xBE,
+    0xD6, 0xE7, 0xDE, 0x34, 0x7B, 0xFA, 0x40, 0x7B, 0xD1, 0xF8, 0x6C, 0xEA, 0x6D, 0x04, 0xE9, 0x7D,
+    0x7D, 0x07, 0x7F, 0xBD, 0x68, 0x24, 0x33, 0x99, 0x57, 0x75, 0x4C, 0x2F, 0x0B, 0xF1, 0xF8, 0x73,
+    0x3A, 0xF9, 0x99, 0x2E, 0xC0, 0x30, 0xC2, 0x20, 0xBB, 0x4F, 0x93, 0x07, 0x8A, 0x99, 0xA5, 0x99,
+    0x67, 0xF5, 0xA2, 0xE5, 0x76, 0x51, 0x66, 0xEC, 0x35, 0x5A, 0xD0, 0x67, 0x1F, 0xF6, 0x5D, 0x17,
+    0x38, 0x6C, 0x97, 0x6C, 0xA2, 0x41, 0xA2, 0x87, 0xB8, 0x35, 0x4A, 0x9D, 0x50, 0x2D, 0x8F, 0xB4,
+    0x90, 0x4C, 0x49, 0x20, 0x06, 0xE6, 0xC6, 0xC4, 0x11, 0xA5, 0x9C, 0xCA, 0x27, 0xBB, 0xBD, 0x30,
+    0xE3, 0x58, 0x21, 0x28, 0x6D, 0x93, 0x57, 0x22, 0x4E, 0x06, 0xFE, 0x56, 0x94, 0x9A, 0xDC, 0x0E,
+    0x88, 0x63, 0xCF, 0x4F, 0x3C, 0xAF, 0xD4, 0xF2, 0xB5, 0x4A, 0x7A, 0x97, 0x17, 0x66, 0x1C, 0xEB,
+    0xD6, 0x94, 0xF2, 0x0B, 0x4A, 0x45, 0x64, 0xFA, 0xD8, 0x1F, 0x01, 0x43, 0x89, 0x41, 0x31, 0x16,
+    0x76, 0xDC, 0x6C, 0xBB, 0xE8, 0x45, 0x13, 0x28, 0x6D, 0xDF, 0xF0, 0x45, 0x1D, 0x11, 0xA3, 0x88,
+    0x30, 0xA5, 0x8D, 0x5C, 0x88, 0x60, 0x47, 0x95, 0x4A, 0x07, 0x5B, 0x64, 0x5B, 0x2D, 0x6C, 0xEA,
+    0x8B, 0xB9, 0x1D, 0x25, 0x2D, 0x62, 0x79, 0x2F, 0x74, 0x4A, 0x72, 0x54, 0xF3, 0x3F, 0xE0, 0xEF,
+    0x62, 0xF2, 0x10, 0xAA, 0x81, 0x62, 0xC2, 0xB2, 0xBB, 0x87, 0xDB, 0x0A, 0x58, 0x79, 0xB0, 0xEF,
+    0xC7, 0xE0, 0x0C, 0xF6, 0xAB, 0xB6, 0xD1, 0x59, 0xE9, 0xD0, 0x79, 0x01, 0xF1, 0x68, 0xAD, 0x19,
+    0xD2, 0x98, 0xD3, 0x6E, 0xD3, 0x09, 0x15, 0x74, 0x92, 0x68, 0x6A, 0xD5, 0x56, 0xCD, 0x51, 0x4A,
+    0x95, 0xE2, 0xD0, 0x12, 0x03, 0x23, 0x27, 0x20, 0xA3, 0x4D, 0x54, 0x0B, 0xC9, 0x68, 0xF0, 0x29,
+    0xE2, 0xCC, 0xF8, 0x68, 0x7E, 0x8C, 0xAA, 0xB5, 0xF9, 0x7A, 0x59, 0xA1, 0xCD, 0x74, 0x72, 0xED,
+    0xF3, 0x6F, 0x76, 0xFE, 0xC2, 0xD4, 0xD8, 0x8D, 0x9F, 0x7F, 0xE4, 0x7C, 0x83, 0xE4, 0x69, 0xA1,
+    0x29, 0xD3, 0x77, 0x78, 0x10, 0x2D, 0xDE, 0xED, 0x35, 0x3F, 0xF2, 0x87, 0x6F, 0xA8, 0x67, 0xE6,
+    0xF0, 0xF5, 0x58, 0x8A, 0x35, 0x10, 0x4B, 0x54, 0x07, 0x81, 0x3C, 0x97, 0x76, 0xE6, 0x68, 0xD7,
+    0x5C, 0x46, 0x0B, 0x30, 0xAB, 0x3A, 0x7B, 0x44, 0x33, 0xF6, 0x8F, 0x0A, 0x9E, 0x6D, 0x11, 0xFE,
+    0x33, 0x6B, 0x01, 0xFB, 0xC1, 0x51, 0x89, 0x9A, 0xCA, 0xE7, 0x78, 0x45, 0x98, 0x65, 0xA7, 0x23,
+    0xD3, 0xCC, 0x1E, 0x18, 0x46, 0x53, 0x40, 0x72, 0x2E, 0x2E, 0x39, 0x62, 0xD6, 0xFF, 0xE5, 0x76,
+    0x2A, 0x95, 0xDB, 0x9F, 0x02, 0x18, 0xC6, 0xD3, 0x1B, 0x13, 0x2F, 0x4D, 0x94, 0x8F, 0xB0, 0xDB,
+    0x89, 0xA3, 0xF3, 0x71, 0xF4, 0x4D, 0x8E, 0xD6, 0x57, 0xD8, 0x6D, 0xB3, 0x5B, 0x34, 0xE0, 0x56,
+    0x6A, 0x06, 0x6E, 0xB5, 0x4A, 0xF7, 0x24, 0x27, 0x6C, 0x46, 0x56, 0x96, 0x93, 0xBB, 0x25, 0x27,
+    0x0F, 0x8E, 0xF4, 0x8E, 0xBE, 0xB6, 0xB4, 0x44, 0x90, 0x00, 0x6A, 0xA4, 0x91, 0xAD, 0x4A, 0xCC,
+    0x23, 0x52, 0x44, 0x1E, 0xE5, 0x4D, 0x69, 0x49, 0x4F, 0x8B, 0x4C, 0x99, 0x23, 0xCF, 0x92, 0xE6,
+    0xE5, 0x88, 0x6A, 0x2D, 0x32, 0xD7, 0x22, 0xAC, 0x5C, 0x53, 0x56, 0xC9, 0xD3, 0xC1, 0xB8, 0xE5,
+    0x7A, 0x54, 0x35, 0xA5, 0x1E, 0x7A, 0x64, 0xA1, 0x96, 0x6A, 0x2C, 0xAE, 0x7A, 0x07, 0x1B, 0x27,
+    0x15, 0x3E, 0x7B, 0x0C, 0x49, 0x16, 0x8E, 0x0D, 0x4E, 0x9E, 0x81, 0xFA, 0x0A, 0x2B, 0x52, 0x5B,
+    0x99, 0x24, 0x7B, 0xD8, 0xA3, 0xE8, 0xAB, 0xD0, 0x3C, 0xB3, 0x22, 0x4B, 0xD6, 0xA4, 0x1E, 0xE4,
+    0xBD, 0x34, 0xAA, 0x8F, 0xF4, 0x95, 0xF7, 0x5D, 0x6B, 0x72, 0x9A, 0xF2, 0xDF, 0x82, 0x8C, 0x16,
+    0xA8, 0x80, 0xD4, 0x4F, 0xB0, 0x8C, 0x8A, 0xB8, 0xAC, 0x3D, 0x94, 0x5A, 0x40, 0x57, 0x93, 0x9D,
+    0xDB, 0x09, 0x9A, 0xC8, 0x41, 0x5F, 0x55, 0x07, 0xAD, 0xB5, 0x5C, 0x11, 0x99, 0xBE, 0x1E, 0xE8,
+    0x81, 0xE1, 0x6B, 0x11, 0x6A, 0xAA, 0x83, 0xF5, 0x2A, 0x4B, 0x8F, 0x79, 0x07, 0x4D, 0x16, 0x60,
+    0x99, 0x51, 0x47, 0xD2, 0x4C, 0x1F, 0x6E, 0x06, 0x0B, 0x4A, 0xB5, 0x20, 0x15, 0x11, 0x17, 0x2E,
+    0xD6, 0x24, 0xD9, 0x1E, 0x89, 0xCD, 0x7B, 0x7A, 0xA0, 0x25, 0x9B, 0x68, 0x27, 0xF7, 0x98, 0x5B,
+    0xBE, 0xF5, 0xE0, 0xC3, 0x84, 0x03, 0x43, 0x16, 0xEC, 0xC1, 0x45, 0x80, 0x98, 0x06, 0x54, 0x00,
+    0xF1, 0x86, 0x01, 0xD5, 0x06, 0x3D, 0x96, 0xCB, 0x82, 0xD5, 0xAF, 0x9D, 0xF3, 0x71, 0xE0, 0x02,
+    0xEB, 0xC3, 0xA3, 0x11, 0x4A, 0x8B, 0xF8, 0xA4, 0x22, 0xAA, 0x04, 0xB8, 0x79, 0xC0, 0x75, 0xD0,
+    0x4C, 0x47, 0x29, 0x68, 0x87, 0xBB, 0xE5, 0xC5, 0xB2, 0xE2, 0x85, 0xBA, 0x05, 0x25, 0xD4, 0xD3,
+    0x04, 0xF9, 0xE8, 0xEB, 0x90, 0x27, 0xC8, 0x4F, 0x93, 0xB1, 0x2C, 0xB5, 0xF5, 0x50, 0xAB, 0xE3,
+    0x8D, 0xA3, 0x42, 0xE8, 0x7A, 0x36, 0xDE, 0x6A, 0x6E, 0x05, 0x4C, 0x92, 0xBE, 0x2C, 0xC5, 0xFA,
+    0xC6, 0xD1, 0xA8, 0xA6, 0x42, 0xA7, 0x52, 0x43, 0x97, 0xD1, 0x8B, 0x34, 0x5A, 0x72, 0x9D, 0x34,
+    0x14, 0x72, 0x3B, 0xA4, 0xF3, 0x35, 0xD5, 0xE2, 0xFB, 0xBE, 0xAC, 0xD6, 0x71, 0xA7, 0xFD, 0xBF,
+    0xDB, 0xC4, 0xEB, 0x08, 0xA9, 0xA0, 0xDA, 0x2C, 0xD3, 0x10, 0xB2, 0x4D, 0xA3, 0x78, 0x8D, 0xCF,
+    0x0C, 0x20, 0xB1, 0x31, 0xCD, 0x86, 0xDC, 0x32, 0x4C, 0x36, 0x16, 0x61, 0x58, 0xBC, 0x8F, 0xD5,
+    0x98, 0x86, 0x81, 0x96, 0xA4, 0xA1, 0x1D, 0x2D, 0x8C, 0x4F, 0x06, 0x0F, 0x14, 0x4F, 0xF8, 0x5F,
+    0x15, 0x37, 0x8D, 0x36, 0xDD, 0x0E, 0xAF, 0xF1, 0xF8, 0x1B, 0xAD, 0x55, 0xBD, 0x8E, 0xDB, 0x46,
+    0x10, 0xFE, 0x96, 0x8B, 0x98, 0x01, 0xB6, 0x58, 0x17, 0x2E, 0x02, 0x07, 0x88, 0xF2, 0x02, 0x77,
+    0x7C, 0x01, 0x52, 0x47, 0xC0, 0x40, 0x1A, 0x17, 0x97, 0x22, 0x57, 0xE7, 0x01, 0x02, 0xC8, 0xAD,
+    0x0A, 0x9D, 0xB5, 0x70, 0x4A, 0x17, 0xF1, 0x13, 0xA4, 0x4A, 0x95, 0x00, 0x71, 0xE7, 0x6C, 0x21,
+    0x1F, 0x69, 0xB7, 0xD7, 0x30, 0x09, 0x10, 0x17, 0x2C, 0xB2, 0xC8, 0x0F, 0x5C, 0x04, 0xC8, 0x6D,
+    0x14, 0x42, 0xD0, 0xF9, 0x24, 0x6D, 0xBE, 0xA5, 0x7C, 0xB0, 0x7D, 0xBE, 0x22, 0x07, 0x98, 0xD2,
+    0x70, 0xB9, 0xB3, 0xC3, 0x99, 0x6F, 0x7E, 0x39, 0x0D, 0x8B, 0x10, 0x5A, 0x83, 0x5D, 0xC0, 0x22,
+    0x71, 0x50, 0x06, 0xD9, 0xC1, 0x67, 0x55, 0x98, 0xBF, 0xF8, 0xF6, 0xFE, 0x1B, 0x5C, 0x3E, 0x56,
+    0x51, 0xB6, 0xC9, 0xA1, 0xCA, 0xC4, 0xCD, 0x50, 0x40, 0xA3, 0x8B, 0x3F, 0xE1, 0x65, 0xA3, 0xEA,
+    0xC4, 0xEB, 0x32, 0x87, 0x6C, 0x0A, 0xE9, 0x90, 0xD6, 0x5D, 0x06, 0xA8, 0x67, 0x7F, 0x7A, 0x40,
+    0x87, 0x60, 0x80, 0xA3, 0xAA, 0x02, 0x0F, 0xBB, 0x21, 0x30, 0xA4, 0x0C, 0x04, 0xA5, 0x67, 0xD0,
+    0x65, 0x81, 0x25, 0x66, 0x54, 0xD1, 0xA5, 0xB5, 0x6C, 0x12, 0x3F, 0x24, 0x4B, 0xFE, 0xE6, 0xA9,
+    0x3B, 0xAD, 0x01, 0x5C, 0x0B, 0xCB, 0x84, 0x16, 0x3F, 0x16, 0x2B, 0xEA, 0x29, 0xF9, 0x3E, 0x40,
+    0x8D, 0x33, 0xBC, 0xB7, 0x42, 0x58, 0xE2, 0x66, 0xD5, 0xC4, 0x4D, 0x04, 0x27, 0xC8, 0x9E, 0x00,
+    0x7B, 0xD7, 0x91, 0xED, 0xBF, 0x08, 0xF7, 0xC2, 0xA6, 0xE4, 0xDB, 0x63, 0x60, 0xE1, 0xA0, 0xE9,
+    0xDC, 0x74, 0x04, 0xB9, 0xB6, 0xD8, 0x79, 0xE4, 0xC4, 0xBC, 0x35, 0x5A, 0x8D, 0x60, 0x0B, 0x9B,
+    0xD6, 0x0B, 0x57, 0xC8, 0xF6, 0x9E, 0xD3, 0x23, 0x8D, 0xC2, 0x76, 0x58, 0x3C, 0x37, 0xB2, 0x25,
+    0xA8, 0x3B, 0x0D, 0x0A, 0xA2, 0x5D, 0xF8, 0x68, 0xF0, 0xC1, 0x07, 0x90, 0xB5, 0x87, 0xA2, 0x13,
+    0xD7, 0xBE, 0xA1, 0x52, 0x08, 0x07, 0x49, 0x95, 0x7B, 0x23, 0x08, 0xAA, 0xD4, 0xB4, 0xF0, 0xA8,
+    0x35, 0xE9, 0xF1, 0x08, 0xF9, 0x8E, 0x4D, 0xDC, 0xC2, 0x0D, 0x78, 0xDA, 0xE9, 0x91, 0x32, 0x85,
+    0xCD, 0xB1, 0xF8, 0xBD, 0x91, 0xED, 0xD7, 0xD0, 0x23, 0xBA, 0x54, 0x95, 0x58, 0xAC, 0xF8, 0x6E,
+    0x4D, 0x57, 0xC6, 0x50, 0xB7, 0x8D, 0xF0, 0x16, 0x85, 0x32, 0xDA, 0xD8, 0xC4, 0x2B, 0x93, 0xC3,
+    0x6A, 0xA3, 0x7E, 0xF1, 0xA8, 0xD6, 0x50, 0x7F, 0x79, 0xEE, 0x4A, 0x65, 0x66, 0xB0, 0xD2, 0x51,
+    0xA4, 0xB4, 0x98, 0x29, 0x23, 0x1D, 0x0D, 0xDE, 0x36, 0xF4, 0xB9, 0x0A, 0xAB, 0x9E, 0x3A, 0x7A,
+    0xDD, 0x21, 0xEF, 0xC9, 0x5F, 0x4E, 0x22, 0x92, 0xDB, 0x52, 0xD2, 0x20, 0x97, 0x35, 0xF2, 0x10,
+    0x09, 0xC8, 0xAF, 0xD3, 0x9F, 0x29, 0xF3, 0x32, 0x5F, 0x03, 0x59, 0xBB, 0x04, 0x02, 0x81, 0xA6,
+    0x8F, 0x7F, 0x68, 0xB0, 0xB3, 0x78, 0x56, 0xE3, 0xDF, 0x76, 0x1F, 0xE9, 0x57, 0xA3, 0x5D, 0xE4,
+    0x85, 0x9D, 0x08, 0xBF, 0x70, 0x9D, 0xBA, 0xC5, 0x78, 0xE5, 0x7A, 0x24, 0x9F, 0xB8, 0xC2, 0xEA,
+    0xFD, 0x92, 0xEE, 0xE6, 0xF4, 0x77, 0xD8, 0xE8, 0x11, 0x2A, 0x06, 0x51, 0x2C, 0x19, 0x72, 0xD9,
+    0xC8, 0x86, 0xB1, 0x9F, 0x33, 0x50, 0xC7, 0x06, 0x9A, 0x85, 0x93, 0xDB, 0x57, 0xDB, 0xEC, 0xE0,
+    0x60, 0x52, 0x85, 0x58, 0x5F, 0xDF, 0x5D, 0x72, 0xFA, 0xDA, 0x36, 0x16, 0x00, 0xFA, 0xC0, 0x0F,
+    0xC2, 0x06, 0x03, 0xA3, 0x9C, 0x36, 0x38, 0x54, 0x0C, 0xDF, 0x97, 0x0D, 0xC4, 0x3F, 0xCC, 0x78,
+    0xC1, 0x94, 0xEB, 0xCF, 0x89, 0xFF, 0x39, 0x65, 0x4F, 0xCF, 0x19, 0xFB, 0x25, 0xD2, 0xA7, 0x1E,
+    0x89, 0x3F, 0x84, 0xE8, 0x94, 0x23, 0xA4, 0xEA, 0x64, 0xC9, 0x52, 0xEA, 0x7A, 0x7D, 0xD3, 0x10,
+    0xCE, 0x42, 0x08, 0x16, 0xE2, 0x8C, 0x8A, 0xAF, 0xBC, 0x4C, 0x37, 0x65, 0x15, 0x3A, 0x2B, 0x56,
+    0x16, 0x43, 0x8B, 0xCC, 0xC6, 0x83, 0x5D, 0x1B, 0x3D, 0x5F, 0x55, 0xC1, 0x57, 0x81, 0x89, 0xC2,
+    0xDB, 0xFF, 0xBE, 0x6E, 0xC2, 0xA9, 0x08, 0xC1, 0x4D, 0xCB, 0xF7, 0xE9, 0x46, 0x12, 0xC1, 0xA2,
+    0xF7, 0x91, 0x90, 0xD3, 0x37, 0x96, 0x58, 0xE5, 0x7B, 0x94, 0x67, 0x3A, 0x94, 0xC3, 0xA7, 0xD9,
+    0x66, 0x83, 0x3B, 0x81, 0x3C, 0x26, 0x3C, 0x9C, 0x84, 0x18, 0x0A, 0xF4, 0x6D, 0xA0, 0xAF, 0xB8,
+    0x10, 0x47, 0x4E, 0x9B, 0x33, 0x76, 0x66, 0xA7, 0x4B, 0xE1, 0x55, 0x1D, 0x13, 0x95, 0xC6, 0xC6,
+    0x35, 0xE4, 0xF0, 0x84, 0xC1, 0x2F, 0x72, 0x56, 0x42, 0x8C, 0x22, 0xA3, 0xA5, 0xFC, 0x16, 0x0C,
+    0x43, 0x8E, 0x41, 0x09, 0xBD, 0x21, 0x9B, 0xA0, 0x04, 0xCE, 0xAF, 0x78, 0x18, 0xFB, 0x12, 0x37,
+    0xC3, 0x1F, 0x90, 0x21, 0xAC, 0xB1, 0x77, 0xEB, 0xC7, 0x23, 0xE9, 0x74, 0x79, 0x38, 0xA0, 0x7B,
+    0x33, 0xCB, 0xC6, 0x9E, 0xC7, 0x72, 0x38, 0x66, 0x05, 0xEB, 0x8C, 0xAC, 0x09, 0xCB, 0x35, 0x71,
+    0x2B, 0xD9, 0x0C, 0xCA, 0xB5, 0xFE, 0x64, 0x09, 0x66, 0xA2, 0xC4, 0x17, 0xE1, 0xC1, 0x6B, 0xBA,
+    0x70, 0x83, 0x38, 0xD9, 0x65, 0x71, 0x3A, 0x74, 0xB0, 0xC2, 0x13, 0xA1, 0x2B, 0x20, 0x7F, 0xE2,
+    0x58, 0xF9, 0x95, 0x60, 0x08, 0x4C, 0xD7, 0xDB, 0xB2, 0x3D, 0x01, 0x76, 0xE3, 0x28, 0x99, 0x20,
+    0x36, 0x08, 0xAD, 0xA5, 0xB5, 0xF0, 0x14, 0xE5, 0x00, 0x49, 0x59, 0x81, 0xC2, 0xD1, 0xA1, 0x09,
+    0xA7, 0xC3, 0x20, 0x89, 0x23, 0x89, 0x19, 0xF4, 0x57, 0x64, 0x30, 0xE2, 0x21, 0x23, 0x45, 0x6C,
+    0xB1, 0x7C, 0x8A, 0x97, 0x18, 0x65, 0x9D, 0x23, 0xF9, 0xB9, 0x8E, 0xD1, 0x92, 0x17, 0x16, 0xCE,
+    0x8E, 0x8C, 0xD6, 0xC3, 0xC3, 0x75, 0x12, 0xCE, 0x1A, 0x94, 0xC5, 0xD6, 0xB5, 0x0B, 0xCB, 0x98,
+    0x39, 0x49, 0x38, 0x45, 0x38, 0x16, 0xD8, 0xD2, 0xFD, 0x40, 0x79, 0x27, 0x8F, 0x11, 0x70, 0x68,
+    0xE3, 0x6D, 0x3D, 0xC6, 0x47, 0xC4, 0xC9, 0x02, 0xED, 0x1D, 0x7B, 0xF7, 0xF7, 0xDE, 0xD4, 0x7A,
+    0x7B, 0xEF, 0xAB, 0xA1, 0x78, 0xEB, 0xBE, 0x53, 0xC5, 0x91, 0x42, 0xEA, 0x7B, 0xE0, 0x22, 0x55,
+    0x1C, 0xD2, 0xEC, 0x25, 0xA6, 0x78, 0xC5, 0xFD, 0x90, 0x94, 0x21, 0xAA, 0xDE, 0xAE, 0xC3, 0x9E,
+    0x1F, 0xCF, 0xD9, 0x54, 0x9C, 0x26, 0xE9, 0xF7, 0xE8, 0x3B, 0x10, 0x77, 0x1D, 0x62, 0xD3, 0x21,
+    0xFD, 0xFB, 0x9C, 0x11, 0x4E, 0x31, 0xA0, 0x20, 0x19, 0x53, 0x32, 0xA4, 0xA3, 0xC4, 0x8C, 0x12,
+    0x03, 0x32, 0xD4, 0x93, 0x2D, 0x23, 0xF5, 0xBD, 0xC4, 0x49, 0x68, 0x84, 0x1F, 0x5F, 0xD6, 0xA1,
+    0xD5, 0x25, 0x7D, 0x9D, 0xC5, 0xE7, 0xD8, 0xD7, 0x1D, 0x21, 0x10, 0x70, 0x42, 0x57, 0x2A, 0x7E,
+    0x91, 0xF0, 0x21, 0x21, 0x64, 0xE4, 0xAC, 0xB6, 0x3D, 0x1B, 0x93, 0xEA, 0xA6, 0x61, 0x93, 0xB2,
+    0xBD, 0xF9, 0x79, 0xDB, 0xA6, 0x38, 0xEF, 0xFB, 0x46, 0x74, 0x25, 0x8E, 0xD4, 0x59, 0x30, 0xD3,
+    0x58, 0xE3, 0x2F, 0xAF, 0xD4, 0xA0, 0x3A, 0xA5, 0xD1, 0x69, 0x58, 0x2A, 0x13, 0xE7, 0x1A, 0x67,
+    0x3C, 0x06, 0xCA, 0xB0, 0xED, 0x96, 0x96, 0xB5, 0x97, 0x1E, 0x1B, 0x16, 0x5B, 0xF1, 0x38, 0x4E,
+    0xB6, 0x36, 0xC4, 0x49, 0x71, 0xF4, 0x30, 0x3E, 0x9A, 0xF8, 0x68, 0xE3, 0x77, 0xB0, 0x35, 0x0C,
+    0xEA, 0x84, 0x5F, 0x30, 0xE8, 0xFB, 0x66, 0x48, 0x2B, 0x71, 0xF0, 0xDE, 0x55, 0x26, 0xDD, 0x04,
+    0x63, 0x39, 0x32, 0x1B, 0xFC, 0xEF, 0xEB, 0x3F, 0x95, 0x55, 0xCF, 0x6F, 0xDC, 0x44, 0x18, 0x7D,
+    0xF6, 0x34, 0x59, 0x81, 0x0F, 0xC3, 0x21, 0x80, 0x44, 0xA5, 0xFA, 0x0A, 0x1C, 0xBC, 0xFF, 0x80,
+    0x67, 0xD7, 0x2A, 0x12, 0x3D, 0x76, 0x51, 0xD6, 0x5C, 0x73, 0xCF, 0x01, 0xAE, 0x91, 0xD8, 0x68,
+    0x5D, 0xAE, 0x5C, 0x72, 0x29, 0x57, 0xCE, 0x55, 0x25, 0x72, 0xC9, 0x61, 0xA5, 0xBA, 0x5D, 0x93,
+    0x6B, 0x0E, 0x75, 0x95, 0x3F, 0x20, 0x96, 0x08, 0x42, 0x0A, 0x12, 0x99, 0x36, 0xD3, 0xC6, 0x49,
+    0xBC, 0x3B, 0xBC, 0xF1, 0x86, 0x1F, 0x0A, 0x44, 0x25, 0xD6, 0x17, 0xCF, 0xCE, 0xC4, 0xFE, 0x7E,
+    0xBC, 0xEF, 0x7D, 0xCF, 0xB8, 0x6D, 0xCB, 0xAE, 0x9D, 0x77, 0x0E, 0xFD, 0xAA, 0x46, 0x24, 0xE1,
+    0x57, 0x9A, 0x4B, 0xE2, 0x57, 0x0D, 0x22, 0xF1, 0x5A, 0x54, 0xD2, 0xCE, 0xD1, 0x7D, 0x5C, 0x89,
+    0x32, 0x42, 0xEE, 0x57, 0x21, 0x0F, 0x2B, 0xBF, 0xCA, 0x11, 0x85, 0x89, 0xFF, 0x73, 0x85, 0xC8,
+    0x7B, 0x84, 0xA9, 0x7D, 0x70, 0xD8, 0x4D, 0x10, 0x01, 0x23, 0x78, 0xFA, 0x6B, 0xBB, 0x77, 0xBE,
+    0xBD, 0x89, 0x71, 0xE5, 0xD9, 0x24, 0x38, 0xC6, 0x78, 0xBC, 0x3D, 0x1A, 0x1B, 0x8D, 0xC5, 0xE5,
+    0x4F, 0x33, 0x69, 0xAB, 0xF0, 0x10, 0x32, 0x41, 0x90, 0x41, 0x14, 0xC0, 0x2B, 0x9B, 0x7D, 0x73,
+    0xD1, 0x74, 0x0B, 0xB9, 0x57, 0xE2, 0x8D, 0x46, 0x6F, 0x82, 0xE0, 0x47, 0xF8, 0xBF, 0x16, 0x98,
+    0x68, 0x28, 0x85, 0xB0, 0x53, 0xC8, 0xEC, 0xD9, 0x76, 0x11, 0xD8, 0xCC, 0x39, 0x48, 0x87, 0xC2,
+    0xDA, 0xFB, 0x0F, 0xA7, 0x0A, 0x3D, 0x83, 0xD3, 0xB2, 0xF3, 0xDC, 0xD6, 0x7D, 0x6B, 0x8C, 0x77,
+    0x51, 0x32, 0x5C, 0x67, 0x86, 0x9E, 0xB5, 0x27, 0x4C, 0x38, 0x4D, 0xFB, 0xF6, 0xE0, 0xE1, 0x6A,
+    0x09, 0x03, 0xC5, 0x58, 0xE2, 0xCA, 0x0F, 0xFA, 0x49, 0x13, 0x3A, 0x82, 0x4C, 0x73, 0x6C, 0x78,
+    0xDA, 0xAB, 0x3A, 0x45, 0x27, 0x0B, 0x71, 0x87, 0x15, 0xEC, 0x78, 0xDA, 0x2F, 0x19, 0x14, 0x21,
+    0x37, 0x23, 0x51, 0x7A, 0x7A, 0x6A, 0x17, 0x57, 0x02, 0x31, 0x03, 0xA4, 0x01, 0x14, 0x73, 0xD9,
+    0xC2, 0x3A, 0x3A, 0xAC, 0xE5, 0x41, 0xAD, 0x30, 0x1A, 0x41, 0x4D, 0x10, 0x59, 0x3B, 0xA7, 0x4D,
+    0x80, 0xDC, 0x41, 0x81, 0x3E, 0x6E, 0xC9, 0xF3, 0xC6, 0xB7, 0x35, 0xE3, 0xAD, 0xE0, 0x3D, 0x0C,
+    0x8C, 0xCF, 0x38, 0x3A, 0xC8, 0x62, 0x5F, 0x47, 0xA2, 0x14, 0xE5, 0x24, 0x84, 0xD8, 0x25, 0xDC,
+    0x1D, 0xE7, 0x3B, 0xB4, 0x74, 0x6E, 0x26, 0x23, 0xC8, 0x6F, 0x09, 0xEF, 0x28, 0xC8, 0x0C, 0x21,
+    0xF7, 0x74, 0x0F, 0x13, 0xFF, 0xA5, 0xF6, 0x89, 0xFF, 0xD2, 0x23, 0xF4, 0x6D, 0xF9, 0xC9, 0x32,
+    0xE3, 0xD3, 0xE3, 0x84, 0x50, 0x0B, 0x9B, 0x09, 0x5B, 0xC2, 0x33, 0x6D, 0x38, 0x5A, 0xD3, 0x7B,
+    0x6C, 0xBA, 0x2D, 0x50, 0x03, 0xAC, 0x18, 0xCC, 0x8C, 0x37, 0x33, 0x62, 0x66, 0x82, 0x4D, 0x23,
+    0x95, 0x89, 0x95, 0xD9, 0x50, 0x46, 0xAB, 0x37, 0xA5, 0x3A, 0x2D, 0x94, 0x4D, 0xD4, 0x1C, 0xAA,
+    0x81, 0x7A, 0x07, 0x5B, 0x92, 0x05, 0x1F, 0x17, 0x78, 0x86, 0x1B, 0xBD, 0x38, 0xC0, 0xD0, 0x40,
+    0x33, 0x4B, 0xC3, 0x5C, 0x43, 0x18, 0x05, 0x56, 0x4A, 0x33, 0x9B, 0x70, 0x5B, 0xE9, 0x0A, 0x30,
+    0x9E, 0x36, 0xCC, 0x36, 0x4D, 0x49, 0x92, 0x2A, 0x4A, 0xEB, 0x20, 0x89, 0xFC, 0x32, 0xC8, 0x58,
+    0x4F, 0x8C, 0x89, 0x24, 0x97, 0x8A, 0x76, 0x33, 0xC2, 0x24, 0x22, 0x7C, 0x08, 0xA6, 0xE4, 0x1D,
+    0x93, 0x18, 0xD2, 0xE6, 0xF0, 0x1A, 0x0B, 0xBF, 0xB1, 0x89, 0x68, 0x4E, 0xB3, 0x20, 0x3F, 0x29,
+    0x64, 0xFC, 0xB2, 0xBA, 0x13, 0x6B, 0x1D, 0xC7, 0x7A, 0x87, 0x7F, 0xF1, 0x4E, 0xAC, 0x95, 0x8E,
+    0x75, 0x58, 0xC5, 0x5A, 0x16, 0xB1, 0xC3, 0xB5, 0x4D, 0x3E, 0xFE, 0xA7, 0x59, 0xDB, 0xD0, 0xAE,
+    0x1C, 0xD2, 0xB0, 0x9E, 0x78, 0xB6, 0xF1, 0xCE, 0x6E, 0x17, 0x35, 0x72, 0x62, 0x1E, 0x41, 0x1C,
+    0x64, 0x78, 0x42, 0x42, 0x4F, 0x20, 0xB7, 0x21, 0xF6, 0x0B, 0x4F, 0xE7, 0xA8, 0xE5, 0x51, 0x83,
+    0x69, 0xDD, 0x12, 0x2F, 0x1D, 0xD2, 0xD1, 0x59, 0x9A, 0xFF, 0xDB, 0xD7, 0x15, 0x1B, 0xAC, 0x27,
+    0x27, 0x56, 0xDB, 0x2F, 0x9A, 0x06, 0x9B, 0x9C, 0x28, 0x83, 0xF0, 0x2F, 0xAB, 0xD1, 0x6D, 0xD0,
+    0x9B, 0x23, 0xBF, 0xF8, 0xCD, 0xBC, 0xB6, 0x25, 0xFB, 0x76, 0xC5, 0x98, 0x56, 0x68, 0x7F, 0x3A,
+    0xFB, 0x40, 0x66, 0x6C, 0x27, 0xA1, 0xE0, 0xAA, 0x5C, 0xAF, 0xF9, 0xB3, 0x53, 0x40, 0xD2, 0x8E,
+    0x74, 0x60, 0x8B, 0x45, 0x3E, 0x53, 0x3B, 0x4B, 0x9F, 0x0E, 0x2F, 0x5B, 0x7F, 0xBD, 0x0D, 0xB0,
+    0xF4, 0xD5, 0xA2, 0x20, 0x03, 0x32, 0x2E, 0x16, 0x45, 0x48, 0xEC, 0x13, 0x29, 0x0A, 0xF1, 0xA2,
+    0xC2, 0x86, 0x81, 0x8C, 0xE1, 0xFF, 0xEE, 0xE8, 0xEA, 0x02, 0x70, 0x42, 0xA0, 0x5D, 0x48, 0x92,
+    0x38, 0x98, 0xC1, 0x27, 0x29, 0xDB, 0xB3, 0x36, 0x3B, 0x37, 0x39, 0x9C, 0xDC, 0xF6, 0x60, 0xF9,
+    0x2C, 0x41, 0x97, 0x9C, 0xED, 0xFF, 0xB0, 0x56, 0xF6, 0x45, 0x99, 0xB3, 0xE5, 0xC1, 0x77, 0x85,
+    0xF2, 0x5E, 0x55, 0x32, 0x89, 0x6B, 0x51, 0x12, 0x52, 0x23, 0xF6, 0x78, 0xA0, 0x8D, 0x4C, 0xEA,
+    0xEE, 0x67, 0x65, 0xEE, 0xCF, 0xCF, 0x1B, 0xD2, 0x9C, 0x70, 0x86, 0xD9, 0x35, 0x4E, 0x57, 0xB0,
+    0x24, 0x33, 0x32, 0xA7, 0x53, 0x84, 0x1C, 0x10, 0xEA, 0x4B, 0x8F, 0xD3, 0xC1, 0x74, 0x1A, 0x80,
+    0xB4, 0x26, 0xF6, 0xA3, 0x10, 0x8A, 0xD3, 0x03, 0x15, 0x12, 0x10, 0xB6, 0x9B, 0x23, 0x5D, 0x10,
+    0xF3, 0xB7, 0x2D, 0x9C, 0xDE, 0xE7, 0x6C, 0x1F, 0x5A, 0xC5, 0x89, 0x17, 0xCB, 0xC7, 0x2B, 0xB8,
+    0x35, 0x71, 0xFD, 0xBE, 0xB4, 0x51, 0x6B, 0xFD, 0xEF, 0xE7, 0x4E, 0xF1, 0x86, 0x54, 0xB3, 0xBF,
+    0x6D, 0x40, 0x10, 0x57, 0x39, 0xB0, 0xE2, 0x20, 0x21, 0x70, 0x9B, 0x4C, 0x59, 0x19, 0x38, 0xFD,
+    0x79, 0xDB, 0x91, 0x93, 0x8D, 0x53, 0x77, 0x2B, 0x9D, 0x8B, 0x81, 0x62, 0x6C, 0xE6, 0x23, 0x21,
+    0xF9, 0x54, 0xE1, 0xB2, 0xD3, 0xD0, 0xFF, 0xEB, 0xB0, 0x15, 0xA0, 0xBE, 0xBB, 0xB9, 0xE6, 0xA3,
+    0xD5, 0xD3, 0xD8, 0xDD, 0xA4, 0xBB, 0x79, 0x59, 0x3A, 0x80, 0x4F, 0x29, 0x58, 0x5A, 0x4B, 0x16,
+    0x80, 0x12, 0x58, 0xF1, 0xCB, 0x00, 0x92, 0x68, 0xF7, 0xBE, 0x6C, 0xB8, 0x35, 0x4E, 0x70, 0xE8,
+    0x30, 0x51, 0x6C, 0x2C, 0xF3, 0x11, 0xFC, 0xCF, 0x00, 0xF8, 0x90, 0xF2, 0x41, 0xF1, 0xA1, 0x72,
+    0x3A, 0x82, 0x62, 0x7C, 0xB4, 0xE5, 0x11, 0xA7, 0xCE, 0x3C, 0x6D, 0xB8, 0x35, 0xE3, 0x52, 0xBC,
+    0xB0, 0x89, 0xBC, 0x37, 0x43, 0x1E, 0xF2, 0x9D, 0xB1, 0xAD, 0x3D, 0x3D, 0x70, 0x8D, 0x62, 0xBF,
+    0x94, 0x0B, 0xC2, 0x18, 0xD2, 0x36, 0x8C, 0xD0, 0x56, 0x7E, 0xE0, 0xAA, 0xCE, 0xAD, 0xDD, 0xA7,
+    0xEF, 0x8F, 0xB6, 0x18, 0x61, 0xF9, 0xF3, 0xDA, 0x3D, 0xE5, 0xB3, 0x89, 0xBB, 0xD6, 0x06, 0xAE,
+    0x01, 0xDA, 0x11, 0x39, 0xE2, 0xD1, 0xF9, 0xF4, 0xAE, 0xD5, 0x0B, 0xC5, 0xF9, 0x94, 0x49, 0x4D,
+    0x67, 0x32, 0x99, 0x05, 0xFB, 0x25, 0x35, 0xD7, 0xF4, 0x20, 0x37, 0xF9, 0x05, 0x3A, 0x66, 0xAD,
+    0x4F, 0xF8, 0x4C, 0xD7, 0xC4, 0x08, 0x9E, 0xB2, 0x8D, 0xC7, 0x77, 0x2B, 0x86, 0x61, 0x01, 0xA6,
+    0x73, 0xDE, 0x28, 0x8C, 0xEB, 0xC5, 0x47, 0xE5, 0xFD, 0xD4, 0x15, 0x34, 0x4F, 0xCD, 0xC8, 0xD1,
+    0x42, 0xDE, 0x2B, 0x44, 0x49, 0x15, 0x72, 0x7A, 0x3A, 0xA5, 0x58, 0x89, 0xB2, 0xEB, 0xF4, 0x48,
+    0xB1, 0xF6, 0xFB, 0x59, 0x4B, 0x3A, 0x7F, 0xC1, 0x6F, 0x16, 0xF0, 0x6E, 0xFB, 0xFE, 0x4D, 0x74,
+    0xDC, 0x4D, 0xC3, 0x6E, 0x45, 0xF3, 0x92, 0xE4, 0xA6, 0xEF, 0x3A, 0x92, 0x13, 0x63, 0xB6, 0x90,
+    0x98, 0xFD, 0xB9, 0x93, 0x6B, 0x33, 0x5C, 0x5C, 0xD4, 0xB2, 0x0A, 0x0A, 0x6A, 0xAA, 0x64, 0x86,
+    0xC6, 0xE5, 0x7A, 0xCD, 0xD2, 0x66, 0x7D, 0xB9, 0x10, 0xC7, 0x7E, 0x0D, 0x7F, 0xDE, 0xB2, 0x20,
+    0x0B, 0x48, 0x12, 0x9F, 0x63, 0xB5, 0x94, 0xAE, 0xDA, 0xD9, 0x59, 0xFA, 0x5F, 0x5F, 0xBD, 0x85,
+    0x83, 0xAB, 0xD7, 0x1F, 0xAD, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0xC7, 0xF1, 0x0A,
+    0x6D, 0x31, 0x29, 0x9C, 0x02, 0x21, 0x6E, 0x1B, 0x0A, 0x84, 0xE4, 0xDB, 0x3F, 0xB0, 0xE3, 0xDB,
+    0xC8, 0x05, 0x45, 0x0A, 0xAE, 0xC8, 0x91, 0x48, 0x29, 0xA0, 0xA0, 0x8A, 0x04, 0xB4, 0x2E, 0xD6,
+    0x78, 0xE5, 0x14, 0x14, 0x29, 0x42, 0xC3, 0x3F, 0xA0, 0x20, 0x71, 0x61, 0x8A, 0x14, 0x1B, 0x71,
+    0xB1, 0x37, 0xA4, 0x48, 0x91, 0x22, 0x4B, 0x22, 0x57, 0x29, 0xB2, 0x41, 0xA9, 0x8C, 0x90, 0x87,
+    0x30, 0xC1, 0xE7, 0xF8, 0xEE, 0x86, 0xEF, 0xAD, 0x2D, 0x84, 0x44, 0x44, 0xC5, 0xDE, 0xCC, 0xDC,
+    0xCE, 0xCC, 0xEE, 0x9B, 0xF7, 0xBE, 0xF7, 0x7D, 0x6F, 0x71, 0x35, 0x4F, 0xFC, 0xBD, 0xA3, 0x45,
+    0x5D, 0xA2, 0x40, 0xD8, 0x42, 0xFB, 0xE9, 0xC0, 0xDB, 0x4A, 0x6E, 0xA3, 0x1A, 0x9A, 0x6D, 0xDF,
+    0xC6, 0xBE, 0x06, 0x10, 0xDE, 0x54, 0x7E, 0x7A, 0x77, 0xF1, 0x11, 0xE0, 0x10, 0xB7, 0x48, 0x5F,
+    0x20, 0xB5, 0x48, 0x6A, 0x18, 0x84, 0x2F, 0x60, 0xE6, 0xDB, 0x0F, 0x7D, 0xCB, 0xA7, 0x16, 0x8C,
+    0x59, 0xC0, 0x92, 0xF9, 0xE7, 0x75, 0xF6, 0xC3, 0x67, 0xEB, 0xBF, 0x2F, 0x00, 0x43, 0x9D, 0xBB,
+    0x7F, 0x35, 0x9C, 0x55, 0x8D, 0xCE, 0xB9, 0x1B, 0xE4, 0x3A, 0x37, 0x70, 0x32, 0x7B, 0xC3, 0x5F,
+    0x92, 0x4C, 0x36, 0x4A, 0x8C, 0x46, 0x3C, 0x61, 0xD7, 0x37, 0x40, 0x7F, 0xE4, 0x80, 0x98, 0x7B,
+    0x08, 0xF9, 0x08, 0x60, 0xD5, 0xFE, 0x10, 0x19, 0xBC, 0x2F, 0x35, 0xCC, 0xC7, 0x53, 0x55, 0xEB,
+    0x5C, 0x73, 0xB1, 0x51, 0x4D, 0x41, 0x77, 0x5D, 0x9F, 0x5E, 0x8E, 0x3D, 0x83, 0x9B, 0x0D, 0x72,
+    0xE5, 0x27, 0xE8, 0xAE, 0x21, 0x96, 0x24, 0x96, 0xEC, 0x0D, 0x43, 0x01, 0x9A, 0xF2, 0xBE, 0x99,
+    0xDF, 0x9A, 0x6F, 0x39, 0x59, 0x1B, 0xCB, 0x90, 0xC9, 0x50, 0xC8, 0x30, 0x75, 0x20, 0x4A, 0x32,
+    0x94, 0x72, 0xBA, 0x93, 0xC7, 0x1B, 0x5A, 0xC7, 0xE9, 0x4C, 0x5F, 0x98, 0xE3, 0xF8, 0x78, 0xA2,
+    0xDB, 0xA8, 0x9E, 0xC2, 0xE8, 0x32, 0x6C, 0x1C, 0xFA, 0x3A, 0x0F, 0xDB, 0x37, 0xFE, 0x89, 0x33,
+    0x44, 0x3A, 0x81, 0x1C, 0xFE, 0xC3, 0x89, 0x6B, 0x17, 0x1D, 0x2C, 0xE3, 0x76, 0x71, 0xE9, 0x12,
+    0x38, 0x03, 0x3A, 0xCD, 0xE6, 0xD6, 0x21, 0x53, 0x5D, 0xCA, 0x56, 0x40, 0x07, 0x24, 0x14, 0x45,
+    0x03, 0x16, 0xE2, 0xF3, 0xBB, 0xA7, 0x61, 0x39, 0xCC, 0x5C, 0x30, 0x73, 0x6A, 0xE6, 0xE2, 0x75,
+    0xA7, 0x8D, 0xCB, 0x8C, 0x5B, 0x33, 0xCE, 0x9A, 0x3F, 0x1B, 0x73, 0x58, 0x1B, 0x9F, 0x9B, 0x39,
+    0x0C, 0xFD, 0x0A, 0xF3, 0x4F, 0x61, 0x33, 0xA4, 0x3B, 0x08, 0xEE, 0xC8, 0x9B, 0x4B, 0x08, 0xAE,
+    0x94, 0x70, 0x16, 0x85, 0x41, 0x3F, 0xAA, 0x09, 0x60, 0x54, 0xF7, 0x89, 0x61, 0x6D, 0xE1, 0xD6,
+    0xD0, 0x33, 0x50, 0x4C, 0xFE, 0x8F, 0xA5, 0xF8, 0xAA, 0x6C, 0x17, 0x27, 0xFD, 0xED, 0x03, 0x29,
+    0x42, 0x9F, 0x63, 0x37, 0x3F, 0x3D, 0x3B, 0xFB, 0xEF, 0xE6, 0xFD, 0x94, 0x0D, 0x6B, 0x38, 0x6D,
+    0xEF, 0xD1, 0x73, 0xC2, 0xF6, 0xCA, 0x32, 0x47, 0xEA, 0x49, 0xCD, 0x90, 0x74, 0x07, 0x4A, 0x66,
+    0x10, 0xD7, 0x01, 0xA9, 0x98, 0x22, 0xFA, 0xC9, 0x62, 0x86, 0x34, 0xAA, 0xD5, 0x04, 0x95, 0xCE,
+    0x53, 0x26, 0xB6, 0x8F, 0x43, 0x3A, 0x58, 0x44, 0x8F, 0x72, 0x26, 0x78, 0x39, 0x0D, 0xDB, 0xB0,
+    0xB5, 0x99, 0x46, 0xF4, 0xA0, 0x9C, 0xD0, 0xDC, 0xE7, 0xC1, 0x1F, 0x0D, 0x12, 0xAB, 0x0E, 0x80,
+    0x41, 0x19, 0xD1, 0xD1, 0x75, 0x71, 0xFA, 0xE4, 0x5A, 0x12, 0x2F, 0xD7, 0x50, 0x21, 0x2B, 0x4E,
+    0x06, 0xFE, 0x98, 0x5B, 0x54, 0x86, 0x03, 0x99, 0xB2, 0x0E, 0xAB, 0xE1, 0x03, 0xAB, 0xCF, 0x1F,
+    0x84, 0x4D, 0x74, 0xED, 0xE1, 0x6A, 0xAD, 0x1E, 0x7C, 0xFD, 0xB0, 0x0C, 0x0F, 0xD4, 0x33, 0x60,
+    0x1E, 0xCC, 0x05, 0xE9, 0x69, 0x17, 0xBD, 0xF4, 0x73, 0x47, 0x17, 0x99, 0xFB, 0x19, 0xAE, 0xBE,
+    0xFE, 0xFE, 0xEF, 0x35, 0x1C, 0x0D, 0x85, 0x10, 0xDF, 0x60, 0xBE, 0x4D, 0xEE, 0x61, 0xCC, 0x4E,
+    0x12, 0x63, 0xE5, 0xB4, 0xF3, 0x3E, 0x98, 0x72, 0xDF, 0xB2, 0xE7, 0x5D, 0xEE, 0x39, 0x1A, 0x31,
+    0x35, 0xE4, 0x4A, 0x1B, 0x7C, 0xF2, 0x6D, 0x37, 0x15, 0x4B, 0x8A, 0x54, 0xD7, 0xFE, 0x88, 0x3C,
+    0x9B, 0x73, 0xBA, 0xCE, 0x29, 0xC3, 0x0F, 0x1B, 0x43, 0xAE, 0x78, 0x3F, 0x51, 0x7E, 0xDE, 0xBD,
+    0x8F, 0x1E, 0xF0, 0xE5, 0xFC, 0x42, 0xC9, 0xB5, 0x97, 0x2D, 0x81, 0x7A, 0xBF, 0x12, 0x07, 0xFB,
+    0xC2, 0x88, 0xB8, 0x64, 0x7E, 0xC2, 0x56, 0x4E, 0xB8, 0x7B, 0x69, 0x6F, 0x94, 0xA7, 0x64, 0xF5,
+    0x24, 0xDE, 0xDF, 0xB9, 0x75, 0x93, 0x8B, 0x7C, 0xB3, 0x92, 0x13, 0xFA, 0x42, 0xA3, 0xB8, 0x4C,
+    0xE4, 0x49, 0x49, 0x6C, 0x85, 0x8D, 0x9C, 0x8B, 0x91, 0xDF, 0xBD, 0x5E, 0x22, 0x15, 0xB9, 0x75,
+    0xB4, 0x5A, 0xFC, 0xCE, 0x61, 0x77, 0xEE, 0xD4, 0xAB, 0xCB, 0x2E, 0xAE, 0x21, 0xDA, 0x75, 0xBA,
+    0xD3, 0x89, 0x93, 0x2E, 0xF7, 0x27, 0x9D, 0x14, 0x8A, 0x1A, 0xB8, 0x70, 0xBE, 0xE3, 0xB0, 0x31,
+    0xEB, 0x5E, 0xEE, 0x38, 0x3E, 0x60, 0x8F, 0x85, 0xB0, 0x87, 0x4C, 0x45, 0xC2, 0x08, 0xD5, 0xCF,
+    0x3C, 0x2C, 0xA3, 0x9D, 0xB8, 0xAC, 0xC4, 0x10, 0x25, 0xC0, 0x38, 0xD5, 0xE3, 0xE7, 0x64, 0x20,
+    0x85, 0x11, 0x6F, 0xB6, 0x63, 0xD8, 0xBE, 0xAA, 0x99, 0x5D, 0xD2, 0xB0, 0x1F, 0xD8, 0x82, 0x4E,
+    0x7F, 0xC4, 0x88, 0xC6, 0x38, 0x23, 0x85, 0x80, 0x16, 0x7E, 0x63, 0xF0, 0xE4, 0x90, 0xB5, 0xE4,
+    0x08, 0x6B, 0xD2, 0x76, 0x2D, 0x98, 0xC6, 0x37, 0x12, 0x64, 0x99, 0x09, 0xAC, 0xAD, 0xF4, 0x6A,
+    0x6D, 0x0B, 0x1D, 0xFE, 0xD2, 0x66, 0x51, 0xBD, 0x86, 0xC0, 0xF2, 0x28, 0x0C, 0x72, 0x46, 0x18,
+    0x4D, 0xE5, 0x96, 0x9E, 0x54, 0xD0, 0x7D, 0xDE, 0x92, 0x3E, 0xC2, 0x06, 0x9E, 0xBA, 0x77, 0x65,
+    0x6F, 0xCC, 0x22, 0x43, 0x41, 0xC7, 0xFB, 0xBB, 0xBB, 0x3B, 0xA8, 0xC2, 0xE7, 0xCF, 0x6D, 0x5C,
+    0x66, 0x3D, 0x5D, 0x56, 0xF1, 0xBD, 0xB6, 0xA0, 0x22, 0x7B, 0xAA, 0xA9, 0x92, 0xA0, 0x4D, 0xE3,
+    0x6B, 0x6D, 0x0F, 0xB6, 0xCA, 0x82, 0x56, 0x5F, 0xBF, 0x5E, 0xF7, 0x50, 0x0C, 0x71, 0x8E, 0xD9,
+    0x8C, 0xA8, 0x17, 0x1C, 0xB3, 0x9E, 0x25, 0x24, 0x54, 0xF8, 0x84, 0x05, 0x2A, 0xEB, 0x09, 0x4E,
+    0x56, 0x73, 0xA0, 0x9E, 0x97, 0x33, 0xBD, 0xFA, 0xF8, 0x49, 0xE3, 0xB2, 0xE5, 0x44, 0x5F, 0xD8,
+    0x6C, 0x9C, 0xB3, 0xCB, 0xF1, 0x8D, 0x2F, 0xC2, 0x26, 0x93, 0xFD, 0x5C, 0xC0, 0x64, 0xE9, 0x5D,
+    0x61, 0x06, 0x08, 0xF3, 0x84, 0x3E, 0xAB, 0x86, 0x3A, 0xD3, 0x92, 0xC3, 0x8D, 0x56, 0xEA, 0x9F,
+    0x04, 0xBA, 0x5D, 0x47, 0xB5, 0x5D, 0xC1, 0x44, 0x93, 0xA8, 0x39, 0xB9, 0x4A, 0xCE, 0x56, 0x7D,
+    0x0A, 0xF6, 0x7E, 0xA3, 0x85, 0xD3, 0x56, 0x3D, 0xA5, 0x3C, 0xD2, 0x33, 0xA3, 0xD1, 0x90, 0x46,
+    0x6D, 0xBC, 0x77, 0x89, 0x02, 0x61, 0xC0, 0xE4, 0x37, 0x0C, 0x79, 0xB1, 0x4B, 0x9C, 0xFD, 0x41,
+    0x1D, 0x5F, 0xBB, 0xDF, 0x6A, 0xEA, 0x9B, 0x20, 0x3B, 0xA3, 0xEA, 0xA2, 0x50, 0x75, 0x56, 0xA9,
+    0xBA, 0xBF, 0x16, 0xD1, 0x8B, 0xCD, 0x56, 0xD8, 0x12, 0x97, 0x2B, 0x08, 0xBA, 0x02, 0xAA, 0xF3,
+    0x8A, 0x94, 0x9A, 0x30, 0x97, 0xC4, 0x80, 0xB6, 0xAA, 0x02, 0xE9, 0x68, 0x74, 0x5C, 0x77, 0x60,
+    0xB9, 0xF0, 0xF5, 0xD6, 0xF1, 0x6B, 0x96, 0xAB, 0x7E, 0x7C, 0xCF, 0xD2, 0x91, 0x94, 0x10, 0x45,
+    0xF5, 0x98, 0x59, 0x31, 0xA1, 0xD5, 0x71, 0x69, 0xE3, 0xDA, 0xB0, 0xA6, 0xA4, 0xA8, 0x2A, 0xC9,
+    0xDF, 0xCB, 0xD6, 0x85, 0x54, 0xF1, 0xF0, 0xDC, 0x68, 0x94, 0xBB, 0x01, 0xB1, 0x76, 0xC9, 0xE8,
+    0x4A, 0xCD, 0xB8, 0x59, 0xDD, 0xC2, 0x56, 0x6A, 0xF6, 0x1D, 0x91, 0x87, 0x54, 0x3D, 0xC1, 0xC4,
+    0x11, 0x28, 0x7A, 0xA8, 0x57, 0x09, 0x9A, 0x3E, 0xDF, 0x3A, 0xAA, 0xC0, 0x3A, 0x06, 0x5E, 0xBD,
+    0xE2, 0xC0, 0x70, 0x16, 0x60, 0x08, 0x3A, 0x4B, 0x88, 0x9A, 0xB2, 0x16, 0xB9, 0x90, 0x32, 0xEA,
+    0x21, 0x21, 0x60, 0x63, 0xC8, 0x67, 0x4C, 0xFE, 0x38, 0x7B, 0xA7, 0x51, 0x24, 0xF3, 0x07, 0x42,
+    0x68, 0xD9, 0x2B, 0x4E, 0xF4, 0x65, 0xBA, 0x47, 0x82, 0x49, 0xB0, 0xE5, 0x03, 0x0A, 0x8A, 0xEC,
+    0x50, 0x7C, 0x63, 0x85, 0xA4, 0xE5, 0xF1, 0x8B, 0xFE, 0x57, 0xA9, 0x1B, 0x6F, 0xE1, 0xB3, 0x78,
+    0x75, 0x12, 0x1E, 0x94, 0x8B, 0x9E, 0x5A, 0x6C, 0xDF, 0x5E, 0x74, 0xA2, 0x12, 0x08, 0xA3, 0x42,
+    0x5F, 0x86, 0xB4, 0x18, 0x4C, 0xBA, 0x6A, 0xC8, 0x36, 0x0E, 0xB6, 0x5C, 0xEA, 0xCB, 0x75, 0xE0,
+    0x36, 0x45, 0x37, 0x1A, 0x0E, 0xFC, 0xF4, 0xCC, 0xE8, 0xF2, 0x6D, 0x7E, 0xA7, 0x28, 0x7E, 0xF5,
+    0xAC, 0x34, 0x38, 0xA4, 0x1E, 0xCD, 0x84, 0xDF, 0xB6, 0xAF, 0xB8, 0xF0, 0x94, 0x0B, 0x2F, 0xB9,
+    0x90, 0x15, 0xFC, 0xCA, 0xC9, 0x27, 0x71, 0xD3, 0x99, 0xB8, 0x1E, 0x1C, 0x6C, 0x37, 0x01, 0xC9,
+    0xD2, 0xD9, 0xED, 0xAA, 0x81, 0xA4, 0x5F, 0xDC, 0xED, 0x0A, 0xCC, 0xFF, 0x77, 0xFD, 0x05, 0xAD,
+    0x55, 0x3D, 0x8C, 0x1B, 0x45, 0x14, 0xFE, 0x66, 0xF7, 0xC2, 0xE6, 0xB2, 0x88, 0x49, 0x61, 0x21,
+    0x50, 0x80, 0xB9, 0x82, 0xE2, 0x84, 0x38, 0xBB, 0xB9, 0x82, 0x62, 0xD7, 0xB7, 0x28, 0x45, 0x24,
+    0x1A, 0xA8, 0x69, 0xA0, 0x8E, 0x10, 0x49, 0x41, 0x11, 0xC1, 0xE6, 0xBC, 0x4A, 0x8A, 0x14, 0x34,
+    0x74, 0x14, 0x14, 0xA1, 0xA0, 0xBA, 0x06, 0x8A, 0x2B, 0x2C, 0x64, 0xCE, 0x73, 0x50, 0x5C, 0x91,
+    0x82, 0x85, 0x86, 0x8E, 0x98, 0x20, 0x88, 0x44, 0x8A, 0x8C, 0x92, 0x45, 0x71, 0x2E, 0xB6, 0x87,
+    0xEF, 0xCD, 0xFA, 0x12, 0x02, 0x52, 0x0A, 0xC4, 0xDA, 0x33, 0xEB, 0xF9, 0x7B, 0xF3, 0xBD, 0xEF,
+    0x7D, 0xEF, 0x19, 0x71, 0x0D, 0xFC, 0xA3, 0x75, 0xE2, 0xBA, 0x93, 0xC5, 0x75, 0xCE, 0xD6, 0x65,
+    0x33, 0xCB, 0xA6, 0xFF, 0xD6, 0x4C, 0xCE, 0xB5, 0x2E, 0xF7, 0xE8, 0xCB, 0xF5, 0x2C, 0x79, 0xE0,
+    0x9D, 0x1A, 0xFB, 0x02, 0xF1, 0xE4, 0x5F, 0xB6, 0x42, 0x93, 0x27, 0xF5, 0x35, 0x8C, 0xF7, 0x30,
+    0x55, 0xE2, 0x74, 0x85, 0x7E, 0x6A, 0x91, 0x7C, 0xC7, 0xB5, 0xA9, 0x03, 0x7A, 0x25, 0xD7, 0xAF,
+    0x7B, 0xEF, 0xEF, 0xB1, 0xCD, 0x39, 0x61, 0x64, 0xE2, 0x7B, 0x1A, 0xBC, 0xE1, 0xA0, 0xDC, 0x45,
+    0xEE, 0x4A, 0x27, 0x6A, 0x86, 0xF1, 0xAD, 0x19, 0x9E, 0xF2, 0xD3, 0xD6, 0xE0, 0xD9, 0x42, 0xF9,
+    0xB9, 0xBA, 0x7F, 0xAA, 0x9E, 0xA2, 0xCC, 0xA0, 0xDF, 0x41, 0x74, 0xCB, 0xFB, 0x43, 0x1A, 0x18,
+    0x22, 0xBD, 0x8A, 0xE8, 0x57, 0x0B, 0x37, 0xC2, 0x48, 0xFF, 0x31, 0xC3, 0x20, 0x9C, 0xD8, 0xE5,
+    0x3D, 0x5F, 0xB2, 0x71, 0x41, 0x63, 0x8A, 0xB4, 0x32, 0xC4, 0x16, 0xD7, 0xCA, 0x61, 0xC8, 0x8F,
+    0x41, 0xCE, 0xA1, 0x06, 0x86, 0x69, 0x05, 0x43, 0xD0, 0x71, 0x4D, 0x1C, 0xA3, 0x0B, 0x80, 0xCE,
+    0xE9, 0xC4, 0x75, 0x1A, 0x18, 0x58, 0x0E, 0xC4, 0x23, 0x2E, 0xBC, 0x05, 0xF5, 0x71, 0x85, 0x79,
+    0x29, 0x5B, 0xC9, 0x04, 0x32, 0xB8, 0xB4, 0xD2, 0x45, 0x83, 0x52, 0x23, 0xDE, 0x9F, 0x60, 0x23,
+    0x87, 0xBA, 0xCB, 0x8B, 0x78, 0x7E, 0x5C, 0x84, 0x13, 0x7C, 0x22, 0xD7, 0x00, 0x1B, 0x86, 0x16,
+    0xF6, 0x69, 0x66, 0xFD, 0x85, 0x96, 0x97, 0x02, 0xD1, 0xA1, 0x43, 0xB4, 0xC8, 0x00, 0x21, 0x66,
+    0x48, 0x40, 0x39, 0x3F, 0x86, 0x08, 0xD3, 0x4A, 0x39, 0x42, 0xC9, 0xE1, 0x38, 0x18, 0x92, 0x09,
+    0x42, 0xC9, 0x89, 0x31, 0x3D, 0xA8, 0x80, 0xBB, 0xB4, 0x91, 0xD3, 0x70, 0x32, 0xA3, 0x95, 0x39,
+    0xDB, 0x56, 0xB0, 0x17, 0xFF, 0xE2, 0xA0, 0xE9, 0x43, 0x96, 0x41, 0xD5, 0x9F, 0xCB, 0xCC, 0x7F,
+    0xC2, 0x2A, 0x4F, 0xE2, 0x43, 0xEC, 0x22, 0xEF, 0xAD, 0xBC, 0xF7, 0x30, 0x90, 0x97, 0x29, 0xD0,
+    0xC8, 0xEC, 0x04, 0xC9, 0x7E, 0x81, 0x8E, 0x40, 0xCA, 0x91, 0x1C, 0xD8, 0x10, 0xAC, 0x21, 0x03,
+    0xD7, 0xD5, 0xD0, 0x67, 0x2C, 0x37, 0xD0, 0x15, 0x19, 0x26, 0x96, 0x5F, 0x0E, 0xF3, 0xD8, 0x72,
+    0xD8, 0x8F, 0x26, 0x65, 0xA0, 0x57, 0xA7, 0x45, 0x1F, 0x28, 0xB1, 0xEB, 0x54, 0x03, 0x5D, 0x25,
+    0x3F, 0x23, 0xAD, 0x79, 0x79, 0xBF, 0xC6, 0x16, 0xC3, 0x1C, 0xD1, 0xAB, 0xC1, 0x82, 0x84, 0x57,
+    0x2D, 0x96, 0x25, 0x2A, 0xD3, 0xBE, 0x8E, 0x44, 0x35, 0x6A, 0x47, 0xBE, 0x1D, 0x6D, 0x55, 0x41,
+    0x16, 0xC7, 0xE8, 0xB2, 0xF1, 0x35, 0x41, 0x59, 0xAA, 0x63, 0x48, 0x3C, 0x55, 0x6A, 0x1D, 0x1A,
+    0x8A, 0xE4, 0x74, 0x9D, 0xEC, 0x3B, 0x41, 0xD4, 0x27, 0x43, 0x43, 0x5D, 0xB8, 0x2E, 0x83, 0xC2,
+    0x21, 0x25, 0x53, 0x65, 0x39, 0x99, 0xEF, 0xA3, 0x11, 0xC6, 0x9D, 0xBA, 0xC9, 0x33, 0xDA, 0xC6,
+    0x33, 0x88, 0x80, 0x52, 0x47, 0x2E, 0x2A, 0xE8, 0x22, 0x5C, 0x93, 0xB5, 0xC1, 0x9C, 0x84, 0xD7,
+    0x72, 0xAE, 0x05, 0xD2, 0xF2, 0x14, 0x07, 0xB9, 0x9D, 0x14, 0xB4, 0x1C, 0x9F, 0xE2, 0x41, 0xEA,
+    0xBE, 0x4A, 0xFE, 0x9C, 0xEE, 0x51, 0x76, 0x6A, 0xDA, 0x43, 0x2B, 0xFC, 0x9C, 0x76, 0xA2, 0x9B,
+    0xB6, 0x15, 0xBB, 0xBA, 0x77, 0xF4, 0x83, 0x91, 0x40, 0x4F, 0x24, 0x47, 0x36, 0x19, 0x21, 0xDE,
+    0x5A, 0x6D, 0xEB, 0x2B, 0x4E, 0x79, 0xEA, 0x3E, 0xF2, 0x8C, 0xB3, 0x92, 0x78, 0xD3, 0x47, 0x9C,
+    0x28, 0x42, 0xC0, 0xB6, 0x7C, 0x1D, 0x3F, 0x78, 0x50, 0xF7, 0x55, 0x42, 0x27, 0xD3, 0x2B, 0x16,
+    0xA6, 0x4B, 0x8C, 0x43, 0xE0, 0xCE, 0x24, 0x84, 0xC5, 0x10, 0xE2, 0xD4, 0xBC, 0x91, 0xDA, 0x9E,
+    0x9F, 0x11, 0x49, 0x15, 0xB2, 0x54, 0x09, 0xC4, 0xF7, 0x05, 0xBB, 0xF2, 0xF7, 0xC5, 0x1B, 0x7B,
+    0x4E, 0xC8, 0x4B, 0x03, 0xDB, 0x49, 0x70, 0x23, 0x0A, 0xBF, 0x9F, 0x79, 0xA8, 0x06, 0x8C, 0x27,
+    0xE9, 0x9C, 0x5C, 0x37, 0x3D, 0x5F, 0x69, 0x7B, 0x72, 0x25, 0xA9, 0x25, 0x18, 0xCA, 0xF5, 0x65,
+    0xAD, 0x09, 0xA4, 0x8C, 0x4A, 0xE9, 0xCB, 0xD0, 0x67, 0x8F, 0xF7, 0xB4, 0xD9, 0xF6, 0xA5, 0xC4,
+    0x05, 0xC3, 0xBE, 0xF4, 0x8D, 0x29, 0x12, 0x1B, 0x39, 0x5D, 0xA7, 0xFC, 0xC4, 0x4C, 0x5D, 0xA2,
+    0x1B, 0x4F, 0x7B, 0x73, 0x3C, 0xF6, 0x2C, 0x04, 0xE6, 0xE1, 0x82, 0x70, 0x5E, 0x7B, 0x56, 0x64,
+    0x90, 0x07, 0x8C, 0x01, 0xBB, 0x00, 0x55, 0xD5, 0xD1, 0xC6, 0x57, 0x8A, 0x13, 0x9F, 0x60, 0xD0,
+    0x68, 0x8F, 0xED, 0xE7, 0xD4, 0x99, 0x00, 0x4C, 0xB2, 0x25, 0xB0, 0x00, 0x75, 0x47, 0x02, 0x46,
+    0x5E, 0x36, 0xA0, 0x0D, 0xC3, 0x16, 0x1F, 0x58, 0x49, 0xFE, 0x86, 0x62, 0x66, 0x48, 0x06, 0x28,
+    0xE3, 0xC3, 0xC5, 0xE1, 0x02, 0xBD, 0x99, 0x79, 0xFC, 0x7A, 0xE3, 0xA9, 0x42, 0x6C, 0x6E, 0x9E,
+    0x97, 0x41, 0xD1, 0x46, 0x1B, 0x21, 0x47, 0xE3, 0x9F, 0xE8, 0x01, 0xF4, 0x9B, 0x42, 0x68, 0x96,
+    0x0B, 0x77, 0xB4, 0xD6, 0x43, 0xF2, 0xED, 0x84, 0x72, 0x30, 0xA9, 0x8D, 0x1B, 0x8C, 0x78, 0xD3,
+    0x84, 0xCA, 0xC7, 0xD8, 0xEA, 0x62, 0xC8, 0x2A, 0x92, 0x29, 0x67, 0x72, 0x49, 0xEA, 0xDD, 0x11,
+    0xD3, 0xFB, 0xB2, 0x75, 0x19, 0xCC, 0x4B, 0x92, 0xB2, 0xF9, 0x6E, 0xC2, 0x7A, 0x37, 0xB0, 0x9A,
+    0x4A, 0x5A, 0xC0, 0xD4, 0x60, 0x52, 0x6C, 0x3D, 0x74, 0x6C, 0xE7, 0x0B, 0x26, 0xCE, 0xD7, 0xAC,
+    0x60, 0x6B, 0x6B, 0x6B, 0xED, 0x54, 0x87, 0x69, 0xDD, 0xB9, 0xC0, 0xC2, 0x45, 0x56, 0x43, 0x57,
+    0x4A, 0x15, 0xCC, 0x30, 0xCC, 0xD9, 0x35, 0x5D, 0x5C, 0x64, 0x31, 0x81, 0x57, 0x4E, 0xBF, 0x7E,
+    0x3B, 0xAA, 0x93, 0xCB, 0xD7, 0x4E, 0xDB, 0xF8, 0xE0, 0xCA, 0xB5, 0x2A, 0xBA, 0x2D, 0xA5, 0x6C,
+    0xA1, 0x16, 0x92, 0x79, 0xB3, 0xD6, 0xD4, 0xB9, 0x45, 0xA1, 0x59, 0x98, 0xE7, 0x58, 0xD7, 0x36,
+    0x28, 0x59, 0x04, 0x22, 0xBC, 0x95, 0xC1, 0xD1, 0x20, 0x07, 0xD3, 0x0E, 0x25, 0xF3, 0x23, 0x99,
+    0xE2, 0x8E, 0x54, 0x9A, 0x6F, 0x28, 0xCA, 0xBA, 0x4D, 0x83, 0xBC, 0x5D, 0x8F, 0x1F, 0x0D, 0xCF,
+    0x4A, 0x1E, 0xCE, 0xDF, 0xA6, 0x88, 0x4B, 0xB1, 0x44, 0x86, 0x28, 0x4D, 0xA9, 0x63, 0xB2, 0x89,
+    0x7F, 0x00, 0xFA, 0xD0, 0xA6, 0x3E, 0x18, 0xE6, 0x8C, 0x94, 0x65, 0xC9, 0x2D, 0x9A, 0x5F, 0x91,
+    0xB2, 0x78, 0x3C, 0xB6, 0xF1, 0x8D, 0x1A, 0xBD, 0x09, 0x14, 0x23, 0xF2, 0x91, 0x43, 0xD6, 0xFD,
+    0x60, 0x03, 0xE6, 0x6A, 0x10, 0x7D, 0xD2, 0xB0, 0x26, 0x5B, 0x35, 0x39, 0x2F, 0xDB, 0x5F, 0x5E,
+    0xD2, 0xA4, 0x7E, 0xDC, 0xD9, 0xDB, 0xDE, 0xB9, 0x54, 0x48, 0x7A, 0x98, 0xD9, 0xE0, 0xB7, 0xDF,
+    0x8B, 0xD5, 0x4E, 0xB9, 0xBB, 0xB9, 0xDA, 0xB9, 0xF8, 0xE2, 0xAB, 0xEF, 0x12, 0xF8, 0x02, 0xDB,
+    0xFE, 0x33, 0x7C, 0xC3, 0x9D, 0xCF, 0x2F, 0xFF, 0x93, 0x96, 0x0C, 0xD4, 0x5F, 0x85, 0xD7, 0x4A,
+    0xC8, 0x8A, 0x95, 0x36, 0xBD, 0x34, 0xB3, 0x38, 0x5E, 0x40, 0xFD, 0x40, 0x77, 0x76, 0xCF, 0xA3,
+    0x73, 0xEC, 0x68, 0xFD, 0x09, 0x8F, 0x09, 0x55, 0xCA, 0x9F, 0xFE, 0x54, 0x24, 0xB9, 0xF1, 0xDE,
+    0xDA, 0x71, 0x49, 0x23, 0x54, 0x4F, 0x3E, 0x24, 0x5C, 0x2A, 0x5E, 0x76, 0x8B, 0x34, 0x7F, 0xE8,
+    0xB0, 0xBE, 0x0A, 0xAC, 0xC6, 0xC5, 0xA3, 0xF5, 0xA8, 0x69, 0xDF, 0x6D, 0x31, 0xC6, 0xD3, 0x09,
+    0xFE, 0xCF, 0xE7, 0x2F, 0x95, 0x55, 0xBF, 0xAF, 0x14, 0x45, 0x1C, 0xFF, 0xEC, 0x6E, 0xDE, 0xDB,
+    0x84, 0x89, 0x0E, 0x05, 0x14, 0x40, 0x7C, 0x6B, 0x61, 0x21, 0x89, 0xDC, 0x5A, 0x5A, 0xEC, 0xDE,
+    0x5B, 0xFD, 0x07, 0x38, 0x02, 0x2F, 0x56, 0x86, 0xC6, 0xCA, 0x06, 0x0A, 0x13, 0x29, 0xF6, 0x71,
+    0x2B, 0x14, 0x14, 0x24, 0x40, 0x43, 0x2D, 0x05, 0x8D, 0x50, 0x68, 0x71, 0x9A, 0x4D, 0x38, 0xB9,
+    0x49, 0x2C, 0x2C, 0x28, 0x58, 0x44, 0xA5, 0xB0, 0x70, 0x13, 0x0B, 0x8C, 0x24, 0x32, 0xE0, 0x3C,
+    0xB2, 0xC0, 0xDE, 0x8D, 0x9F, 0xD9, 0x7D, 0xEF, 0x11, 0x08, 0x81, 0x78, 0x99, 0x9D, 0xF9, 0xCE,
+    0x8F, 0xEF, 0xAF, 0xCF, 0xF7, 0xC7, 0x01, 0x58, 0x42, 0xF7, 0x7B, 0xA3, 0x5F, 0xDE, 0xEB, 0x97,
+    0xC4, 0x4D, 0xC7, 0x91, 0xBB, 0xE5, 0x04, 0x3E, 0x45, 0x98, 0x75, 0x47, 0x33, 0x20, 0x02, 0x7C,
+    0x03, 0x48, 0xEE, 0x0A, 0xBC, 0xEA, 0xB7, 0xC8, 0x38, 0x85, 0x55, 0x5C, 0xB9, 0x65, 0xE1, 0x5D,
+    0x70, 0x67, 0x7B, 0x5F, 0xC9, 0xE1, 0xF3, 0xFB, 0x96, 0x1A, 0x28, 0x97, 0x1A, 0xAE, 0x73, 0x97,
+    0xC3, 0xAB, 0x71, 0xA0, 0x37, 0x2A, 0xE9, 0x4D, 0x4C, 0xFA, 0xB7, 0x9F, 0xF7, 0xCB, 0xF1, 0x2D,
+    0xDE, 0x04, 0x1A, 0x7E, 0x4D, 0xE3, 0xA4, 0xA5, 0xC2, 0xBD, 0x97, 0xB6, 0x5F, 0x35, 0xA2, 0x40,
+    0xAC, 0x4A, 0x84, 0x2D, 0x89, 0xA7, 0x24, 0xE2, 0x44, 0x14, 0xE1, 0x6D, 0x12, 0x4D, 0x2E, 0x8A,
+    0x38, 0x54, 0x65, 0x58, 0x91, 0x68, 0x48, 0xC4, 0xC8, 0xC5, 0x99, 0x2A, 0x54, 0x93, 0x86, 0xC4,
+    0x31, 0x84, 0xEA, 0x5A, 0x45, 0xA2, 0x21, 0x41, 0xBF, 0xC7, 0x37, 0x2A, 0xCA, 0x70, 0xBE, 0x38,
+    0xB7, 0x69, 0x9F, 0x43, 0x82, 0x2A, 0x39, 0xED, 0xC7, 0x0A, 0xF5, 0x27, 0xA4, 0xAF, 0xF3, 0xE1,
+    0x31, 0x77, 0x04, 0x2F, 0xC3, 0x11, 0x89, 0x50, 0x27, 0x58, 0x55, 0xDA, 0xBF, 0x1F, 0xA8, 0x28,
+    0x91, 0xD0, 0x3A, 0x11, 0xA7, 0x95, 0x4E, 0x64, 0xF0, 0x63, 0x95, 0xC8, 0x15, 0xE8, 0x54, 0x07,
+    0xCA, 0x66, 0x32, 0x68, 0xB1, 0x7A, 0x53, 0xC1, 0x92, 0xEF, 0x03, 0xCA, 0xAC, 0x7A, 0x78, 0xE9,
+    0xA9, 0x77, 0xC1, 0x69, 0x1B, 0x00, 0xCB, 0x8B, 0xCB, 0x88, 0xAC, 0xC6, 0xBE, 0x5F, 0x33, 0xB7,
+    0x45, 0xC9, 0x67, 0x1B, 0x19, 0x84, 0x9D, 0x23, 0xBE, 0x6A, 0xB9, 0x3D, 0x49, 0xED, 0x53, 0x51,
+    0x78, 0x7A, 0x40, 0x73, 0xE9, 0xA4, 0x5F, 0xFB, 0x46, 0x58, 0x5B, 0xC4, 0xB6, 0x86, 0xCC, 0x3A,
+    0x83, 0xB9, 0x48, 0x8A, 0xF8, 0xE6, 0xEF, 0xAD, 0xDD, 0x0B, 0x8B, 0xB5, 0x17, 0x24, 0x39, 0x0C,
+    0xD6, 0x65, 0x16, 0xD4, 0x06, 0x07, 0x64, 0x16, 0x2A, 0x6B, 0x1B, 0x69, 0x1F, 0x63, 0xBC, 0xC8,
+    0x62, 0x3B, 0x17, 0x45, 0xF4, 0x73, 0x8D, 0xA6, 0x44, 0x44, 0x2D, 0x37, 0x8A, 0x0F, 0x1F, 0xD6,
+    0x65, 0x53, 0xCA, 0xD6, 0xDD, 0xD8, 0x05, 0x35, 0x56, 0x25, 0xDE, 0xA7, 0x75, 0x04, 0xDA, 0xE1,
+    0x52, 0x76, 0x96, 0x63, 0xF4, 0x59, 0xF6, 0xD0, 0x6A, 0x7B, 0xA8, 0x6D, 0x91, 0x36, 0x18, 0x18,
+    0x44, 0xDB, 0xA3, 0x41, 0xDC, 0xCA, 0xE1, 0x22, 0x6C, 0x9F, 0xDE, 0x33, 0x1B, 0x56, 0x1B, 0xE4,
+    0x06, 0xEF, 0x9A, 0xCE, 0xA0, 0x7E, 0x00, 0xEF, 0xB8, 0x0C, 0x20, 0x08, 0x2B, 0x63, 0xFB, 0xC4,
+    0xDA, 0x7B, 0x85, 0x13, 0x59, 0x3A, 0xF1, 0xE2, 0x75, 0x24, 0xD1, 0x43, 0x50, 0x51, 0x4A, 0xBA,
+    0x76, 0x74, 0x6C, 0xFF, 0xB8, 0x78, 0xB8, 0xA3, 0xE9, 0x69, 0xF0, 0x02, 0x81, 0xD0, 0xDA, 0x53,
+    0xD6, 0xD6, 0xBD, 0xBD, 0xCF, 0x19, 0x3F, 0xB6, 0x75, 0x64, 0x5B, 0xBC, 0xE4, 0x66, 0x73, 0xB3,
+    0xB4, 0x36, 0x5A, 0xB5, 0xD5, 0xE3, 0x35, 0x8A, 0x22, 0x84, 0x29, 0x96, 0x9F, 0x5C, 0x5E, 0xB5,
+    0x75, 0x47, 0x52, 0xF6, 0xD6, 0x29, 0xE5, 0x34, 0x0C, 0x06, 0xE3, 0xE2, 0xF8, 0xF0, 0xFC, 0x72,
+    0x7D, 0x91, 0xF1, 0x2E, 0x9B, 0x2E, 0x13, 0x5E, 0x5F, 0x97, 0x90, 0x67, 0x0B, 0xE4, 0x25, 0x82,
+    0x1B, 0x05, 0x52, 0x2E, 0xBF, 0x17, 0x4E, 0x40, 0xA0, 0x5C, 0x31, 0x40, 0x16, 0x08, 0xB4, 0xEF,
+    0x82, 0xBE, 0xE8, 0xF2, 0x7B, 0x6D, 0x2D, 0xB0, 0x73, 0x79, 0x71, 0xB4, 0xAD, 0xED, 0x9F, 0x8C,
+    0xE6, 0x34, 0xD1, 0xED, 0x4A, 0xDC, 0xCC, 0xE4, 0x3A, 0x52, 0x83, 0x6B, 0x55, 0x0F, 0x0B, 0x9F,
+    0xE8, 0x9D, 0xB2, 0xB0, 0xAD, 0x67, 0x8B, 0xAE, 0xB2, 0x56, 0x78, 0x3A, 0xE5, 0x9A, 0xA3, 0xF1,
+    0x74, 0xA8, 0x60, 0x42, 0x95, 0xC2, 0xD3, 0x51, 0x50, 0x73, 0xCE, 0x63, 0x26, 0xD8, 0x83, 0x07,
+    0x9A, 0x9A, 0xEF, 0xDE, 0xE4, 0xF3, 0xC0, 0x76, 0x19, 0x3F, 0x73, 0xB0, 0x6E, 0xFC, 0xEB, 0x12,
+    0xF4, 0xCC, 0x4F, 0x9C, 0xA7, 0x91, 0x50, 0xCC, 0xB7, 0x9C, 0x73, 0xEA, 0x69, 0x59, 0x04, 0x75,
+    0xA8, 0x64, 0x36, 0x64, 0x69, 0x44, 0x0F, 0x35, 0x25, 0xC7, 0xCA, 0x59, 0x29, 0x9F, 0xB5, 0x14,
+    0x56, 0x29, 0x7A, 0x6F, 0x80, 0x1D, 0xD8, 0x85, 0x11, 0x46, 0x03, 0x4C, 0x82, 0x4A, 0x66, 0x13,
+    0x72, 0x57, 0x13, 0x22, 0xAB, 0x27, 0x74, 0x34, 0xFF, 0x8E, 0x0F, 0xA3, 0x6B, 0x7C, 0x17, 0x3D,
+    0xE5, 0x94, 0x7C, 0xCF, 0xAD, 0x99, 0x10, 0x8E, 0x7A, 0x32, 0x24, 0x0A, 0x13, 0x99, 0xC5, 0x64,
+    0x9B, 0x4F, 0x31, 0xF1, 0x3A, 0x24, 0x06, 0x2F, 0x99, 0xF6, 0xF0, 0x5B, 0xB6, 0x8D, 0x6F, 0x6D,
+    0xF5, 0xB6, 0xD7, 0x76, 0x39, 0x4E, 0x88, 0x9C, 0x05, 0x53, 0x2C, 0xB5, 0xB0, 0x0D, 0xF6, 0xCE,
+    0x9C, 0x0F, 0x5D, 0x18, 0x3C, 0xDD, 0x01, 0xBC, 0xBA, 0x13, 0xF1, 0xC1, 0x27, 0x4C, 0x07, 0x76,
+    0xAF, 0x13, 0x70, 0x6D, 0x0F, 0x75, 0x57, 0x94, 0x73, 0xD0, 0x5A, 0x2C, 0x7D, 0x0D, 0xE2, 0xBB,
+    0x7F, 0x99, 0x60, 0x34, 0x2E, 0x80, 0x9E, 0x0E, 0x6C, 0x11, 0xB0, 0xE3, 0x78, 0xA6, 0x63, 0xE7,
+    0x68, 0x87, 0x57, 0x4D, 0x4C, 0x88, 0xC9, 0xFD, 0x16, 0xF0, 0x66, 0x37, 0xC8, 0x3C, 0xE2, 0x81,
+    0x38, 0xD5, 0xD5, 0xA8, 0x50, 0x03, 0x2A, 0x2D, 0x43, 0xE5, 0xD7, 0xEB, 0x60, 0xC3, 0xC1, 0x60,
+    0xC8, 0xCE, 0x5A, 0xC3, 0xBF, 0xAF, 0x20, 0xCE, 0x2B, 0x0C, 0x18, 0xE5, 0x52, 0x16, 0xEC, 0x66,
+    0x19, 0x0B, 0x2E, 0x1B, 0x20, 0xCA, 0x58, 0xD0, 0x8F, 0x6A, 0xB8, 0x56, 0xEA, 0x0A, 0x35, 0xED,
+    0x1B, 0x90, 0x73, 0x66, 0x47, 0x46, 0x04, 0x8D, 0x5F, 0x1B, 0x51, 0x98, 0x18, 0x26, 0xC7, 0x86,
+    0x66, 0x93, 0x73, 0xE3, 0x91, 0x86, 0x99, 0xC2, 0x1D, 0xCA, 0xC2, 0x04, 0x73, 0x83, 0x45, 0x07,
+    0xCB, 0xF6, 0xD8, 0x43, 0x7B, 0xCE, 0x76, 0x09, 0x37, 0x15, 0xE7, 0x62, 0x94, 0x77, 0x95, 0x38,
+    0x6F, 0x50, 0xCE, 0x69, 0x42, 0x81, 0x99, 0x86, 0x60, 0x2B, 0x2B, 0x5B, 0xEE, 0x6A, 0x94, 0xB6,
+    0x10, 0xE7, 0xD6, 0x51, 0x1E, 0xA2, 0x96, 0x90, 0x35, 0x1E, 0x13, 0xAF, 0xE9, 0x08, 0x87, 0x6F,
+    0x89, 0xF3, 0x9F, 0x94, 0xE9, 0x58, 0x6D, 0xB4, 0xC1, 0x1D, 0x25, 0x7F, 0xC0, 0xD0, 0x50, 0x6B,
+    0x70, 0x47, 0xCB, 0xA3, 0x3A, 0xFD, 0xA2, 0x36, 0xB7, 0xFF, 0xAC, 0x82, 0x8A, 0xA5, 0x3B, 0x71,
+    0x6D, 0xE9, 0xD8, 0x5F, 0x41, 0x35, 0x6B, 0x65, 0xB1, 0xEF, 0x97, 0x98, 0x70, 0x27, 0xFC, 0x1A,
+    0x88, 0xDF, 0xA8, 0x86, 0xE0, 0x89, 0x7B, 0x5C, 0xD9, 0x77, 0x5C, 0x3E, 0x8A, 0x62, 0xC8, 0x4F,
+    0x66, 0x0E, 0x26, 0xC1, 0x7C, 0xA2, 0x2A, 0xE3, 0xD4, 0xF5, 0xC1, 0x13, 0x5D, 0x38, 0xFB, 0x48,
+    0x7A, 0x19, 0xFD, 0x4E, 0xFD, 0x5A, 0x7E, 0xA4, 0x83, 0x5B, 0xDA, 0x39, 0x3E, 0xD4, 0x90, 0x53,
+    0x56, 0x8C, 0x72, 0x9E, 0xA7, 0x82, 0x99, 0xD8, 0x30, 0xB3, 0x28, 0xD8, 0xCC, 0x0C, 0xE4, 0x41,
+    0x46, 0x8A, 0xCD, 0x0B, 0x4E, 0x07, 0xB3, 0xBB, 0x64, 0xCE, 0x8A, 0x2F, 0x19, 0xF5, 0x72, 0x9D,
+    0x09, 0xF0, 0x55, 0xD6, 0x85, 0xA0, 0xF3, 0x1A, 0x25, 0x63, 0x2B, 0x4E, 0xBB, 0x52, 0x8F, 0xD8,
+    0x62, 0x0B, 0xDE, 0x97, 0xBE, 0xB3, 0x90, 0x1C, 0x74, 0xDE, 0x65, 0x4B, 0xBB, 0xFB, 0x08, 0x76,
+    0xCD, 0x5A, 0xE8, 0xDD, 0x53, 0x5A, 0x95, 0xD3, 0x9E, 0x9C, 0x31, 0x64, 0xD5, 0xE2, 0x24, 0x25,
+    0x8E, 0xC9, 0x9A, 0x53, 0x46, 0xCE, 0x40, 0x75, 0x77, 0x21, 0xDF, 0x78, 0xAE, 0x1E, 0x72, 0x66,
+    0x05, 0x3B, 0x34, 0xF8, 0x17, 0x04, 0xC9, 0xBA, 0x0C, 0x5C, 0x4B, 0x78, 0x76, 0xB0, 0xB1, 0xF6,
+    0xB1, 0x9A, 0x59, 0xAB, 0xE3, 0x2B, 0x57, 0xA6, 0x2F, 0x7F, 0xB1, 0x79, 0x60, 0x79, 0xB0, 0xAA,
+    0x36, 0xCB, 0x29, 0xD9, 0x2C, 0xB1, 0xAE, 0xAA, 0x2E, 0xE1, 0x7F, 0xFD, 0xFE, 0x03, 0x9D, 0x55,
+    0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0x37, 0x77, 0x2B, 0xB1, 0xC5, 0x50, 0xC4, 0x4D, 0x64,
+    0x69, 0x1B, 0x0A, 0x13, 0xCC, 0xED, 0x3F, 0xB0, 0xE7, 0x1B, 0x43, 0x49, 0x13, 0x84, 0xAF, 0x81,
+    0xFF, 0x20, 0x45, 0xDC, 0xBA, 0x58, 0x72, 0x8B, 0x28, 0x68, 0x5D, 0x40, 0x9F, 0x82, 0x0A, 0x0A,
+    0xDA, 0x2B, 0x2E, 0xB9, 0x11, 0x14, 0x14, 0x2E, 0xBC, 0x10, 0x09, 0x0A, 0x8A, 0x2C, 0x22, 0xA9,
+    0x10, 0x64, 0x88, 0x16, 0x74, 0x71, 0xEE, 0x6E, 0xF8, 0xDE, 0xEC, 0x61, 0x9F, 0x13, 0x9C, 0x44,
+    0x59, 0xCD, 0xBC, 0x99, 0x79, 0x3B, 0xF3, 0x7E, 0x7E, 0x6F, 0xE6, 0x1A, 0x3A, 0x4A, 0x07, 0xB6,
+    0x41, 0xBA, 0x36, 0x38, 0xE7, 0x94, 0x73, 0x4F, 0x31, 0x39, 0x3C, 0xD4, 0x81, 0x03, 0x02, 0x0B,
+    0xA4, 0x67, 0xC3, 0xE1, 0x01, 0xE0, 0x1E, 0xD5, 0x88, 0xDC, 0x51, 0x09, 0x85, 0x1E, 0x90, 0x63,
+    0x0C, 0xD8, 0x90, 0x2C, 0x93, 0x08, 0x2B, 0x1B, 0x0E, 0x0B, 0x4C, 0x29, 0x30, 0x3C, 0xF9, 0xEA,
+    0xEB, 0x96, 0xF5, 0x3F, 0xBB, 0xCE, 0xB3, 0x70, 0x0D, 0x9D, 0x61, 0x1F, 0xB1, 0x3B, 0xD6, 0xC1,
+    0xDF, 0x1F, 0x54, 0x28, 0x40, 0xFD, 0x20, 0xC3, 0x88, 0x65, 0x91, 0x73, 0xF3, 0x33, 0x06, 0x8D,
+    0x8B, 0xD6, 0x77, 0x60, 0xE4, 0x9C, 0x81, 0x68, 0x24, 0x1D, 0x8B, 0xB0, 0x17, 0x53, 0x77, 0xDF,
+    0x53, 0xA7, 0x49, 0xAB, 0xB4, 0x16, 0x7E, 0xD8, 0xF8, 0xBF, 0x13, 0x4F, 0x0B, 0x4F, 0xFB, 0xCF,
+    0x52, 0xC8, 0xD7, 0xD2, 0xC2, 0xD3, 0x99, 0x90, 0x88, 0xC1, 0x41, 0xE6, 0x2A, 0xD2, 0xD4, 0xA1,
+    0xFD, 0x86, 0xC3, 0x3D, 0xD1, 0x60, 0xA1, 0xBE, 0xF8, 0x48, 0x0E, 0x2A, 0xD0, 0xE2, 0x9C, 0xEA,
+    0x40, 0x96, 0x8E, 0xFE, 0x2C, 0xC9, 0x72, 0x75, 0x83, 0x7E, 0xF2, 0x1B, 0x59, 0xF1, 0xB1, 0x8E,
+    0x8C, 0xBA, 0x2D, 0x81, 0x91, 0x5D, 0x23, 0xB2, 0x24, 0xE2, 0xE2, 0x1E, 0x24, 0x56, 0x72, 0x18,
+    0x97, 0x12, 0xAE, 0x06, 0x0B, 0x2E, 0xA6, 0x15, 0x4E, 0xBF, 0x2E, 0xFD, 0x0E, 0x1D, 0xED, 0xB8,
+    0x23, 0xEA, 0x75, 0x70, 0x18, 0xDA, 0xD0, 0x99, 0x3E, 0x6E, 0x8E, 0x28, 0xB1, 0x6C, 0x18, 0xA8,
+    0xE4, 0x33, 0xA3, 0x50, 0x14, 0x81, 0x8D, 0xBF, 0xF7, 0x13, 0xD8, 0xE4, 0xBB, 0x4A, 0xE9, 0x59,
+    0x86, 0x89, 0x0A, 0x9A, 0xE8, 0x6E, 0x9D, 0xD4, 0xD9, 0x1C, 0xD9, 0x13, 0xA7, 0xB1, 0xEF, 0xC4,
+    0x8B, 0xEE, 0xA2, 0x15, 0x7D, 0x9D, 0x02, 0xE7, 0x08, 0x1E, 0xBF, 0x4E, 0x8B, 0xAF, 0xE8, 0x3C,
+    0x72, 0x9F, 0xD8, 0x2C, 0x7D, 0xAF, 0x6C, 0x7A, 0xBD, 0xA8, 0x3A, 0x18, 0xAB, 0xDD, 0x5F, 0x6D,
+    0x3F, 0xF9, 0xD4, 0x14, 0x79, 0x62, 0x9E, 0x54, 0xEA, 0xF7, 0x25, 0x12, 0x9F, 0x83, 0xEB, 0xED,
+    0xE1, 0xD1, 0x52, 0xA7, 0xCE, 0x05, 0x0B, 0xBC, 0xA1, 0xC8, 0x9C, 0x30, 0x4A, 0x35, 0x24, 0x0A,
+    0x12, 0x38, 0xF1, 0x4D, 0x5C, 0x4B, 0x57, 0x71, 0xA4, 0x73, 0xA1, 0xB0, 0xB8, 0x23, 0x91, 0xBE,
+    0x9C, 0xEA, 0x2E, 0x73, 0x2E, 0x7C, 0x70, 0x1D, 0x1A, 0x7F, 0x32, 0x24, 0xA7, 0xA3, 0xA9, 0x80,
+    0x82, 0xCD, 0xE2, 0x43, 0x55, 0x32, 0x52, 0x94, 0x44, 0x3C, 0xF5, 0x24, 0xAB, 0x9C, 0x32, 0xBA,
+    0x8C, 0x91, 0x3A, 0xB1, 0x89, 0x2B, 0xC3, 0x4A, 0x32, 0x96, 0x00, 0xDB, 0x48, 0x2C, 0x36, 0x04,
+    0x20, 0x0F, 0x9D, 0x5B, 0x7A, 0x9D, 0xB6, 0xB5, 0xE4, 0x25, 0x07, 0x76, 0xF7, 0xCC, 0x8F, 0x5B,
+    0xD8, 0x18, 0xEE, 0x4D, 0xDD, 0x62, 0xE3, 0xF6, 0x1E, 0xCD, 0xB8, 0xB0, 0x0D, 0x8C, 0xB4, 0x68,
+    0xAD, 0x85, 0x25, 0x4D, 0xFD, 0x8B, 0x20, 0x78, 0xA7, 0xC6, 0x24, 0x32, 0x51, 0x95, 0x94, 0x19,
+    0xE3, 0x6B, 0x91, 0xD1, 0x91, 0x3E, 0x8F, 0xDC, 0xAC, 0xBD, 0xBE, 0x80, 0x29, 0x8D, 0x5A, 0xC7,
+    0x45, 0x90, 0xE8, 0x5D, 0x5B, 0xB2, 0x60, 0x6E, 0x20, 0xFA, 0xD9, 0x48, 0xA5, 0x8E, 0x53, 0xE4,
+    0x91, 0x49, 0x31, 0x56, 0x3A, 0xA5, 0xC0, 0x1F, 0x6B, 0x8C, 0x29, 0x3E, 0x47, 0xF8, 0x07, 0xB3,
+    0xC0, 0x13, 0xA5, 0xC4, 0x45, 0x62, 0x49, 0xE0, 0x2A, 0xBD, 0x5A, 0xBC, 0xBC, 0x11, 0x71, 0x45,
+    0xA4, 0x3A, 0xE2, 0x7B, 0xF6, 0x2A, 0x46, 0x44, 0x8B, 0xFF, 0x8C, 0x20, 0x38, 0xAE, 0x2E, 0x6F,
+    0x9D, 0x33, 0x82, 0xF9, 0xAB, 0x33, 0xCE, 0x95, 0x4E, 0xCA, 0x98, 0x87, 0xC3, 0x9A, 0x7F, 0x59,
+    0x88, 0xF8, 0x98, 0x8A, 0x06, 0xDC, 0x22, 0xD0, 0x49, 0xD9, 0x77, 0xB8, 0x9E, 0x35, 0x4C, 0x71,
+    0xC1, 0xDD, 0x3D, 0xA6, 0x9C, 0x5A, 0x98, 0xEA, 0x3E, 0xC5, 0x4F, 0x10, 0x2C, 0x56, 0x45, 0xB9,
+    0xDE, 0xDF, 0xBC, 0x8C, 0x0E, 0x2B, 0xC1, 0x2A, 0x9D, 0xA3, 0x50, 0x3A, 0x7C, 0x44, 0x6B, 0x08,
+    0xC2, 0x81, 0xF6, 0xD5, 0x3A, 0x35, 0x48, 0x77, 0x28, 0xAA, 0xC1, 0x4C, 0xF4, 0x66, 0x77, 0x2B,
+    0x50, 0x08, 0x21, 0x83, 0xB7, 0x4F, 0x87, 0xE0, 0x90, 0x90, 0xA9, 0x0E, 0x06, 0xCE, 0x35, 0x19,
+    0x2D, 0x13, 0x64, 0x8D, 0x05, 0xA6, 0x3D, 0x41, 0x33, 0xC3, 0xF4, 0x8A, 0xCC, 0x8C, 0xF7, 0xAD,
+    0x61, 0xA5, 0x38, 0xA9, 0x6F, 0x9F, 0x59, 0x1F, 0x4E, 0x1F, 0x57, 0x1F, 0x60, 0x60, 0x8B, 0xD0,
+    0xEA, 0x70, 0xCB, 0xB7, 0xF5, 0xC6, 0xE3, 0x3D, 0xF1, 0x96, 0xC7, 0xC7, 0x78, 0xF1, 0x84, 0xF6,
+    0xD6, 0x89, 0x60, 0x1C, 0xA2, 0xB0, 0xBD, 0x38, 0x4E, 0x27, 0xC1, 0x21, 0xEB, 0xC3, 0x34, 0xCF,
+    0xE9, 0x33, 0xD6, 0xE4, 0x9D, 0xDD, 0xA9, 0xA1, 0x85, 0xA6, 0x7B, 0xF2, 0xAE, 0x69, 0x6D, 0x3A,
+    0xD7, 0xE7, 0x6D, 0xF7, 0x66, 0xAF, 0xF7, 0x2D, 0x46, 0x9B, 0xB6, 0x13, 0x01, 0xB0, 0x8A, 0x5B,
+    0x73, 0xFA, 0x24, 0xCB, 0x2A, 0xB0, 0xC9, 0x0F, 0x23, 0xDE, 0xE2, 0xF7, 0xD0, 0xFD, 0x7C, 0x1D,
+    0xC5, 0xD6, 0x97, 0xC6, 0xD3, 0xE0, 0x7E, 0x8D, 0x93, 0xE8, 0x58, 0xA3, 0x68, 0x10, 0x9F, 0x0E,
+    0xBA, 0x68, 0x36, 0xE3, 0xE3, 0x5D, 0x53, 0xCC, 0x36, 0xE3, 0xA3, 0x07, 0x3F, 0xCD, 0xC5, 0xBC,
+    0xB7, 0xEE, 0x17, 0xD8, 0x8C, 0x4D, 0x60, 0xFC, 0x00, 0x5D, 0xB4, 0xF7, 0x49, 0x41, 0x33, 0x72,
+    0x41, 0x9D, 0x6F, 0x9B, 0x2A, 0xDF, 0x66, 0xCB, 0x06, 0x37, 0xF8, 0xC0, 0xDD, 0x0B, 0x26, 0x0A,
+    0xDB, 0xBE, 0x5D, 0xA2, 0x56, 0xC5, 0x77, 0x8C, 0x99, 0x91, 0x27, 0x68, 0x7D, 0xB8, 0xF2, 0x25,
+    0xE3, 0x67, 0xA7, 0x0F, 0xF6, 0x8F, 0xDA, 0x2B, 0xFF, 0x97, 0xF2, 0x82, 0xA1, 0xF1, 0x05, 0x75,
+    0xD6, 0xAE, 0xEA, 0x7F, 0x9C, 0x75, 0xEF, 0xCF, 0xE7, 0xC8, 0x67, 0xF2, 0xF7, 0xC2, 0xB6, 0xBA,
+    0xB5, 0x33, 0x26, 0x29, 0x94, 0xCB, 0x36, 0xA9, 0x23, 0x79, 0x10, 0xF8, 0x90, 0x30, 0x49, 0xC5,
+    0x16, 0x83, 0xD1, 0x3F, 0xA0, 0x37, 0x3B, 0x05, 0xC1, 0xDA, 0x23, 0xF6, 0xDC, 0x52, 0xB0, 0xB2,
+    0x94, 0x0B, 0x74, 0xF5, 0xE6, 0x78, 0x11, 0x3B, 0xF0, 0xB7, 0x3D, 0xFC, 0x85, 0x79, 0x99, 0xA2,
+    0xBE, 0x61, 0x75, 0xEE, 0xF3, 0x5D, 0x7B, 0xEE, 0xF7, 0x2F, 0xAD, 0x55, 0x31, 0x6F, 0x1C, 0x45,
+    0x14, 0xFE, 0xF6, 0x26, 0xF1, 0x2A, 0x9E, 0x62, 0x28, 0x90, 0x40, 0x20, 0xDD, 0x35, 0x14, 0x6E,
+    0x7C, 0xFB, 0x07, 0x76, 0x7D, 0x2B, 0x5B, 0xA2, 0x8D, 0x8B, 0x1C, 0x14, 0x14, 0x34, 0x34, 0x6E,
+    0xE2, 0x86, 0xE2, 0x24, 0x4E, 0xF6, 0x2A, 0x2E, 0x28, 0x5C, 0xE0, 0x26, 0xA2, 0x43, 0x29, 0x28,
+    0x82, 0x23, 0x61, 0x0A, 0x4B, 0xAC, 0xC4, 0x39, 0x5E, 0x94, 0x82, 0x22, 0x05, 0x2B, 0x53, 0xD0,
+    0xC1, 0x42, 0x42, 0x81, 0x1B, 0x4F, 0x92, 0x35, 0x39, 0xCC, 0xDD, 0x0D, 0xDF, 0xDB, 0x5B, 0xC7,
+    0x4E, 0x30, 0x42, 0x91, 0xD8, 0xBB, 0xDD, 0x9D, 0x99, 0x9D, 0xF9, 0xE6, 0x7B, 0xEF, 0x7D, 0xEF,
+    0x0D, 0xB0, 0x02, 0x68, 0x97, 0xA3, 0xB3, 0x58, 0xBE, 0xD5, 0xC7, 0xE0, 0xC3, 0x14, 0x61, 0xAF,
+    0x44, 0xD4, 0x71, 0x6E, 0x3C, 0x3B, 0xD9, 0xBE, 0x0D, 0x0B, 0xA0, 0xE4, 0x3D, 0xE0, 0xBD, 0x80,
+    0x4B, 0x68, 0x1D, 0x8E, 0xD0, 0x70, 0x32, 0x72, 0x7A, 0x05, 0x13, 0x70, 0x84, 0x10, 0xBA, 0x50,
+    0x16, 0xAD, 0x18, 0x43, 0x4E, 0x44, 0x38, 0x17, 0x02, 0x51, 0xAF, 0xCF, 0x55, 0x7D, 0xAE, 0x6D,
+    0x13, 0xD0, 0x4D, 0xB4, 0x3C, 0x2A, 0x28, 0xF4, 0xE5, 0x11, 0xA1, 0x42, 0xE5, 0xC5, 0x65, 0xE4,
+    0x51, 0xE0, 0x55, 0x42, 0xED, 0x0C, 0x81, 0x55, 0x57, 0x10, 0x95, 0xF7, 0x8B, 0x0F, 0x6F, 0x8B,
+    0x8F, 0x9A, 0x73, 0xF0, 0xB2, 0x9C, 0x49, 0xE9, 0xB9, 0x7B, 0x0E, 0xEE, 0x0F, 0x97, 0x94, 0x2A,
+    0x37, 0x71, 0x84, 0x7F, 0xBC, 0x56, 0x1F, 0x70, 0x0F, 0x6F, 0xEB, 0x75, 0x4E, 0xF4, 0xBF, 0x15,
+    0x4C, 0xED, 0x84, 0xE5, 0xCC, 0xAD, 0x53, 0xCB, 0x2D, 0xE6, 0xA1, 0x6F, 0x58, 0xEE, 0x15, 0xAA,
+    0x5C, 0x7E, 0x7E, 0x66, 0xE2, 0x00, 0x3A, 0x8B, 0xF8, 0xC9, 0xC4, 0xA5, 0x49, 0xD0, 0x52, 0x39,
+    0x59, 0x04, 0xEF, 0x7F, 0x9A, 0x01, 0x1D, 0x27, 0x9E, 0x3A, 0x99, 0x8C, 0x00, 0xB3, 0x94, 0xD3,
+    0xC8, 0x21, 0xE7, 0xC0, 0xCF, 0xA2, 0x86, 0x85, 0x6C, 0x58, 0x34, 0x2C, 0x21, 0xF2, 0x16, 0x97,
+    0xEA, 0x6C, 0xC8, 0x21, 0xB3, 0x99, 0x11, 0xBB, 0x05, 0x5C, 0xF1, 0x12, 0x12, 0x36, 0xDC, 0xF2,
+    0x2E, 0x97, 0xE1, 0x7A, 0x3C, 0xDD, 0x7F, 0x19, 0xB1, 0xB7, 0x94, 0xEB, 0xA4, 0xA5, 0xB2, 0x36,
+    0xAC, 0xCE, 0x52, 0x13, 0x9B, 0xC5, 0xA2, 0x0F, 0xA3, 0x37, 0x32, 0xB4, 0xDC, 0x18, 0x58, 0xA7,
+    0xD5, 0xEA, 0xE0, 0x17, 0x8B, 0x05, 0xF2, 0xF4, 0x6C, 0x5B, 0x6C, 0x4B, 0xFD, 0x6C, 0xD8, 0x28,
+    0xF4, 0x77, 0x99, 0x4E, 0x4C, 0xDC, 0xA3, 0x01, 0x05, 0x06, 0x3A, 0xD1, 0x84, 0x18, 0x80, 0xDF,
+    0x1A, 0x04, 0xD0, 0x1F, 0xE7, 0x68, 0x33, 0x38, 0xDF, 0x1C, 0x4B, 0x64, 0x0B, 0xFD, 0xDB, 0xAA,
+    0x6D, 0xC3, 0xB7, 0x29, 0xFC, 0x83, 0x02, 0x7A, 0x93, 0x66, 0xB5, 0xC9, 0x27, 0x05, 0x1E, 0x17,
+    0xE4, 0x0F, 0xA1, 0xC8, 0xA8, 0xC3, 0xCF, 0x81, 0x35, 0x18, 0x67, 0xD1, 0x99, 0xD4, 0x04, 0x97,
+    0xCB, 0x46, 0x51, 0xEA, 0xA4, 0x0C, 0x50, 0xF6, 0x71, 0x6C, 0xF1, 0xD7, 0x43, 0x38, 0x97, 0xFC,
+    0xF9, 0x9E, 0x2D, 0xBD, 0xB2, 0xC4, 0x80, 0x9E, 0x9B, 0xFE, 0xAB, 0x78, 0x50, 0x13, 0x29, 0x3C,
+    0xAB, 0x5C, 0xDE, 0xA8, 0x3C, 0x4D, 0x1B, 0x46, 0x53, 0x69, 0x45, 0xFC, 0xA9, 0x4C, 0xE5, 0x9C,
+    0x55, 0x37, 0xFA, 0x6C, 0xF8, 0x09, 0x1B, 0xA9, 0x38, 0x2A, 0x66, 0x43, 0x9C, 0x68, 0xA0, 0x72,
+    0x4F, 0x1A, 0x6D, 0x48, 0x3C, 0xD8, 0x08, 0xD9, 0xD8, 0x49, 0xD0, 0x39, 0xB2, 0x50, 0xE3, 0x57,
+    0xC0, 0xC5, 0xB5, 0xF8, 0x4C, 0x5C, 0x45, 0x10, 0x78, 0x03, 0xE8, 0x76, 0xA1, 0xE8, 0x2E, 0xD3,
+    0xAD, 0x22, 0x09, 0x6B, 0x62, 0x46, 0x05, 0x4D, 0x3A, 0x3F, 0x55, 0x79, 0x83, 0x3E, 0x33, 0x44,
+    0xEA, 0x4B, 0x88, 0x54, 0xBE, 0x0F, 0xF3, 0x94, 0x06, 0xD2, 0x54, 0x33, 0x55, 0x91, 0xC8, 0x52,
+    0xC0, 0xE6, 0xD0, 0xAB, 0x1C, 0xA2, 0xEE, 0x27, 0x30, 0x67, 0xFE, 0xA9, 0xBA, 0x41, 0xB7, 0xDB,
+    0xDF, 0x77, 0xEE, 0xF1, 0xC9, 0xF6, 0x9D, 0x0B, 0xBE, 0x9E, 0xEB, 0xD6, 0xCE, 0x64, 0x8F, 0x3C,
+    0xB0, 0x0E, 0x73, 0x74, 0xCE, 0x99, 0x97, 0x29, 0x86, 0xF3, 0x7F, 0x57, 0x5D, 0x2F, 0x0C, 0x56,
+    0x82, 0xE1, 0xBF, 0x2D, 0xE9, 0x15, 0x0F, 0xC0, 0xEF, 0xFB, 0x84, 0x12, 0x72, 0x56, 0x36, 0xD2,
+    0xDC, 0xB0, 0x21, 0x3B, 0xA5, 0xE7, 0x07, 0x8E, 0xBB, 0xEF, 0x66, 0x24, 0x68, 0x83, 0xED, 0xED,
+    0xC1, 0xC5, 0x33, 0xEA, 0x01, 0x77, 0x9D, 0x42, 0xCE, 0x6A, 0xD7, 0xA5, 0x75, 0x0E, 0x0B, 0xE5,
+    0xD9, 0x84, 0x04, 0x25, 0x30, 0x26, 0xF6, 0x2C, 0x63, 0x93, 0x95, 0x22, 0x7E, 0x76, 0x89, 0xCA,
+    0xCC, 0x7C, 0xD6, 0x3D, 0xFB, 0xFA, 0x24, 0xC7, 0x3A, 0x91, 0x9A, 0x5C, 0xBC, 0x8B, 0x67, 0xA6,
+    0x7F, 0x40, 0x64, 0xF5, 0x7D, 0x2C, 0xAA, 0xB8, 0xE0, 0x35, 0x84, 0x7F, 0xFF, 0xE1, 0x9B, 0xA3,
+    0x80, 0x80, 0xAB, 0x9F, 0x87, 0xD3, 0x55, 0x67, 0x2F, 0xC2, 0xF9, 0xA3, 0x2A, 0xBC, 0xA2, 0xCA,
+    0xFA, 0x35, 0xC7, 0xA2, 0x72, 0x99, 0xC2, 0xB8, 0x97, 0xC1, 0x5A, 0x84, 0x21, 0x8C, 0x74, 0x28,
+    0x93, 0xBD, 0xD7, 0x46, 0xC6, 0xFD, 0x8C, 0x95, 0xA5, 0xAC, 0xB2, 0x86, 0xEB, 0x5D, 0x65, 0x9B,
+    0x99, 0xE2, 0x4D, 0x87, 0x66, 0x19, 0x04, 0x28, 0x1B, 0xE4, 0x68, 0x8C, 0x35, 0x35, 0xEE, 0x16,
+    0x8F, 0x80, 0x8F, 0xF2, 0xAF, 0x73, 0xCC, 0x97, 0xF3, 0x4C, 0xB5, 0x48, 0x5F, 0x85, 0xFF, 0xC9,
+    0xE2, 0xAF, 0x05, 0x21, 0xD3, 0x3E, 0x6C, 0xD9, 0x36, 0xF1, 0x6E, 0xC4, 0xA4, 0x0A, 0x99, 0x8A,
+    0x61, 0x53, 0xE5, 0xA9, 0xB9, 0x1A, 0x97, 0x6D, 0xEF, 0x49, 0x16, 0xE9, 0x64, 0x21, 0xE7, 0xA0,
+    0x66, 0x96, 0xA7, 0xDE, 0x10, 0xEE, 0x4B, 0xFA, 0x4E, 0x74, 0x34, 0xF5, 0xA5, 0x04, 0xA8, 0xAE,
+    0x88, 0x22, 0x2C, 0xCC, 0x24, 0xD7, 0x18, 0xF3, 0x4E, 0x8C, 0x89, 0xA1, 0x04, 0x36, 0x46, 0x08,
+    0x8A, 0xA7, 0x89, 0x49, 0x43, 0xEB, 0x7F, 0x66, 0xE6, 0xD5, 0x8F, 0x1B, 0xF7, 0xB2, 0x47, 0x85,
+    0xB5, 0xBB, 0xBD, 0xB0, 0x19, 0x36, 0x8D, 0xFA, 0xC9, 0xDF, 0xC8, 0xF6, 0xBD, 0xC2, 0x9A, 0x6C,
+    0x7D, 0xA0, 0xF2, 0x96, 0xA0, 0x7E, 0x55, 0x17, 0x39, 0xF1, 0xAF, 0xA6, 0x3E, 0x1B, 0xC9, 0x7F,
+    0x16, 0xBB, 0x5B, 0x57, 0x18, 0x0A, 0x46, 0xBC, 0x43, 0x27, 0xCE, 0x6C, 0x4D, 0x8B, 0x8C, 0xB8,
+    0x42, 0x8B, 0xC4, 0x49, 0xB2, 0xB9, 0x2B, 0x35, 0x1D, 0xE2, 0x44, 0xA4, 0xF3, 0x2C, 0xB2, 0x2D,
+    0xA6, 0xAB, 0x89, 0x59, 0x4D, 0x12, 0x75, 0x78, 0x27, 0xF3, 0x99, 0xAA, 0xE6, 0xE6, 0x3B, 0xB6,
+    0x35, 0xD5, 0x4D, 0x2A, 0x29, 0xCD, 0x20, 0x44, 0xAC, 0xBC, 0xC1, 0x0C, 0x96, 0x9B, 0x7E, 0xB6,
+    0xB0, 0x87, 0x20, 0x91, 0x2A, 0xFE, 0x05, 0xCB, 0x80, 0xDA, 0x5A, 0xAB, 0x82, 0xC4, 0x78, 0x53,
+    0x7B, 0xC1, 0xE1, 0x5E, 0x09, 0x97, 0xA8, 0x31, 0x82, 0x81, 0x37, 0x9E, 0xDC, 0x7D, 0xE4, 0x0E,
+    0xB2, 0xBA, 0xCE, 0xF6, 0xE8, 0x95, 0xDE, 0xFC, 0xD9, 0x89, 0xF3, 0x3F, 0x51, 0x12, 0xE1, 0xEA,
+    0xF8, 0x14, 0xF8, 0x25, 0x28, 0x05, 0x52, 0x92, 0x94, 0x1C, 0x65, 0x48, 0xA5, 0x1E, 0x1B, 0x49,
+    0x7F, 0xD6, 0x39, 0x71, 0xB8, 0x34, 0x59, 0xEF, 0xE4, 0x04, 0x32, 0x37, 0xAF, 0x71, 0x13, 0x2A,
+    0x95, 0x4E, 0x3E, 0xBC, 0x8D, 0xB5, 0x6D, 0x8E, 0x32, 0x1B, 0x62, 0x78, 0xC7, 0x2C, 0x34, 0x55,
+    0xD9, 0x12, 0x81, 0x96, 0x52, 0x3B, 0xD9, 0x24, 0x45, 0xE7, 0x1E, 0x14, 0x9C, 0x32, 0x21, 0x97,
+    0x15, 0xA6, 0xF7, 0x0F, 0x2E, 0x6F, 0xBE, 0xED, 0x6E, 0x70, 0x42, 0x75, 0x68, 0x0E, 0x24, 0x9C,
+    0x03, 0x44, 0x33, 0x4C, 0xFA, 0x71, 0xF0, 0x3B, 0x4F, 0xBA, 0xBE, 0x0C, 0x0F, 0xE5, 0x51, 0x82,
+    0xD5, 0x3E, 0x6D, 0x38, 0x5C, 0x5A, 0xDF, 0xD9, 0x3C, 0x19, 0xB6, 0xC6, 0xCF, 0x9F, 0xD1, 0xFF,
+    0x7A, 0xFD, 0x0D, 0xB5, 0x55, 0x3D, 0x8C, 0xDC, 0x44, 0x18, 0x7D, 0xF6, 0x90, 0xB3, 0xC0, 0xC5,
+    0x50, 0x70, 0x45, 0x12, 0x09, 0xD3, 0x82, 0x94, 0x75, 0x8D, 0x64, 0xEF, 0x5A, 0x39, 0x09, 0xCA,
+    0x44, 0x88, 0xAB, 0x43, 0x1D, 0x89, 0xA5, 0x4D, 0xB1, 0x97, 0xB5, 0x92, 0x92, 0x26, 0x54, 0x74,
+    0x50, 0x73, 0x69, 0x51, 0x64, 0xD0, 0x71, 0x3B, 0x24, 0x05, 0x45, 0x0A, 0x2C, 0x1A, 0x8A, 0x2D,
+    0x62, 0x38, 0x24, 0xA4, 0x3B, 0x09, 0xA6, 0x18, 0xED, 0xF9, 0x2E, 0xBB, 0xFB, 0xF1, 0xC6, 0x7B,
+    0x97, 0xE4, 0xA0, 0xC9, 0x21, 0xF0, 0xD9, 0xAB, 0xF3, 0xFC, 0x7C, 0xDF, 0xFB, 0xDE, 0xBC, 0xF7,
+    0xF9, 0xD5, 0xE0, 0x5E, 0xA6, 0x8B, 0x71, 0x8B, 0x77, 0x0A, 0x20, 0x10, 0x99, 0x8A, 0x0C, 0x81,
+    0x0A, 0x61, 0x83, 0xB8, 0x44, 0x0F, 0xF8, 0x6E, 0xF3, 0x03, 0x91, 0xC7, 0xFB, 0xDB, 0xBD, 0x33,
+    0xA3, 0xFC, 0xB7, 0x5B, 0x5B, 0x84, 0xF8, 0x28, 0x2A, 0x6D, 0xF8, 0xB4, 0xC6, 0x6D, 0x06, 0x00,
+    0x6E, 0x16, 0x91, 0x34, 0xFA, 0xB3, 0xB6, 0x8F, 0x3C, 0x43, 0x6F, 0x84, 0x74, 0x22, 0xB2, 0xBB,
+    0xBD, 0x5D, 0x01, 0x23, 0x20, 0x07, 0xD2, 0xE2, 0x15, 0x7D, 0xBC, 0x13, 0x48, 0x8B, 0xD5, 0xB5,
+    0x26, 0x47, 0x48, 0x44, 0xCA, 0x8B, 0x88, 0x2D, 0x5F, 0xFD, 0x30, 0x17, 0xFA, 0x95, 0x3E, 0x0D,
+    0xD2, 0xB1, 0x88, 0x30, 0x84, 0x70, 0x30, 0xE5, 0xD3, 0xCB, 0x38, 0xC7, 0xC9, 0x51, 0xCA, 0xB5,
+    0xDA, 0x44, 0x56, 0x2D, 0xC5, 0x60, 0xB2, 0x5C, 0xC5, 0xFA, 0x0A, 0x03, 0xA9, 0xDF, 0x8D, 0x1C,
+    0xB0, 0xD3, 0x85, 0x60, 0x84, 0xDE, 0x44, 0x96, 0xBB, 0xDB, 0xBB, 0x15, 0xF2, 0x11, 0xB2, 0x3E,
+    0xAA, 0xE4, 0xC0, 0x46, 0x52, 0x9E, 0x24, 0xC7, 0xD7, 0xD9, 0xEA, 0xF9, 0x1F, 0xC0, 0xF0, 0x8A,
+    0xEF, 0x1A, 0xDE, 0xF8, 0x97, 0xD8, 0x00, 0xF5, 0x7D, 0xC3, 0x5F, 0x1D, 0xBD, 0x30, 0xC4, 0xCB,
+    0xE2, 0x0A, 0xE2, 0x3B, 0x16, 0x0E, 0x99, 0xAA, 0xFD, 0x5F, 0x64, 0x74, 0x91, 0x22, 0x36, 0x39,
+    0xA7, 0x74, 0xE1, 0x74, 0x89, 0x44, 0xD5, 0x4C, 0x92, 0xDE, 0xF8, 0x9C, 0xC9, 0x07, 0x42, 0x3C,
+    0xE1, 0xF1, 0x72, 0xCE, 0x48, 0x1B, 0x75, 0xEB, 0x91, 0x16, 0x0E, 0x91, 0xC9, 0x43, 0x4B, 0x18,
+    0x4E, 0x35, 0xA1, 0x65, 0x88, 0x3A, 0xE1, 0xD6, 0xD8, 0xB4, 0x1C, 0xD2, 0x9F, 0x1A, 0xC6, 0x4E,
+    0x4E, 0xB2, 0x65, 0xDA, 0xA7, 0xCC, 0x5E, 0xC8, 0x7F, 0x1D, 0x45, 0xB0, 0x51, 0xC7, 0x65, 0xA2,
+    0x4C, 0x0F, 0x36, 0x36, 0x95, 0x2E, 0xF4, 0xD5, 0x66, 0x04, 0xED, 0x6B, 0x4D, 0x64, 0x01, 0x8C,
+    0xC5, 0x41, 0xFD, 0xF4, 0x8B, 0x45, 0x9F, 0x38, 0x03, 0xDB, 0x53, 0xB5, 0x2E, 0xAA, 0xC8, 0xB4,
+    0x61, 0x13, 0xFF, 0x60, 0xE2, 0x52, 0x77, 0x42, 0xB1, 0xAC, 0x39, 0x79, 0xC6, 0x7B, 0x4B, 0x39,
+    0xD5, 0x6F, 0x05, 0x1E, 0x64, 0x01, 0x55, 0xFB, 0x2A, 0xC9, 0xD3, 0x85, 0x39, 0x28, 0x94, 0x4B,
+    0x93, 0xBA, 0x23, 0x8D, 0xCA, 0x0B, 0x6C, 0x77, 0x22, 0x83, 0xD7, 0x91, 0x5E, 0x3B, 0x96, 0x3B,
+    0xB2, 0x2C, 0xFE, 0xC9, 0xF4, 0x85, 0x8E, 0xE9, 0xB7, 0xD7, 0x5C, 0x77, 0x80, 0x15, 0xF7, 0x28,
+    0x29, 0x95, 0xD4, 0x08, 0x5C, 0xB7, 0x99, 0xF7, 0xBC, 0x7F, 0xDF, 0xA5, 0x1D, 0xD3, 0xA9, 0xC8,
+    0x55, 0x21, 0x5C, 0x0C, 0x18, 0xC4, 0x40, 0x35, 0xDD, 0xA6, 0x3E, 0x61, 0x18, 0xBA, 0xE1, 0x37,
+    0xBC, 0x36, 0xE1, 0x48, 0x52, 0x76, 0xBB, 0x14, 0x13, 0x90, 0x88, 0xF8, 0x21, 0x82, 0x76, 0xB0,
+    0xBD, 0x24, 0xE2, 0x2E, 0xFB, 0xFA, 0xE6, 0x87, 0x63, 0x99, 0xAF, 0x6F, 0xB6, 0x9D, 0x3B, 0x8C,
+    0x67, 0x6E, 0xE4, 0xF1, 0xAB, 0x23, 0xF8, 0xAC, 0x6B, 0xEE, 0x54, 0xFA, 0xBD, 0xEE, 0xF6, 0x7A,
+    0xB9, 0x1E, 0xB4, 0x13, 0x69, 0x52, 0x1E, 0x8C, 0xCC, 0xB9, 0xC8, 0x6B, 0x0D, 0x6F, 0x72, 0xAA,
+    0x82, 0x9A, 0x35, 0x48, 0xA6, 0x25, 0x68, 0xC2, 0xF8, 0xE3, 0x0A, 0xA3, 0x07, 0x8D, 0x7A, 0x38,
+    0x2D, 0x7B, 0x7A, 0x18, 0xD8, 0x9C, 0x44, 0xCF, 0x9A, 0x4A, 0x4D, 0xEF, 0x1A, 0x3D, 0xCC, 0x91,
+    0x7F, 0xD3, 0x60, 0xF6, 0x27, 0xD4, 0xD4, 0x41, 0x7F, 0x62, 0x90, 0x93, 0x20, 0xA7, 0xA5, 0xE6,
+    0xDD, 0x9D, 0xD1, 0x1B, 0x0E, 0x0B, 0x17, 0x2C, 0x9C, 0x5A, 0xB8, 0x78, 0xCB, 0xE9, 0xDC, 0x65,
+    0xB9, 0xBB, 0x95, 0x3B, 0x9B, 0xCF, 0xEA, 0xFC, 0xD0, 0xE4, 0x52, 0xE4, 0x4B, 0xE4, 0xF3, 0x4E,
+    0xDA, 0xD4, 0x19, 0x85, 0xA3, 0x4E, 0xE8, 0x43, 0xD0, 0x30, 0x68, 0x89, 0xC1, 0x10, 0xC1, 0xA2,
+    0x82, 0x26, 0xA0, 0x07, 0xD3, 0x32, 0x7A, 0x3C, 0x44, 0x76, 0xA5, 0x0A, 0x9B, 0x59, 0x93, 0x70,
+    0xD6, 0xE9, 0x61, 0x5C, 0xE6, 0x55, 0x86, 0xD9, 0x5E, 0xAD, 0xA6, 0x5F, 0x40, 0x0F, 0x29, 0xA6,
+    0x49, 0x81, 0x19, 0xCB, 0x99, 0x1A, 0x74, 0x27, 0xEC, 0xCF, 0x64, 0xC3, 0x9C, 0x6A, 0xE6, 0x3C,
+    0x78, 0xFC, 0x56, 0x84, 0xB5, 0x7D, 0xAE, 0xB9, 0x98, 0x55, 0xD1, 0x98, 0x3C, 0x89, 0xC8, 0x52,
+    0xDF, 0x7D, 0xD2, 0x1C, 0x3D, 0x62, 0xA1, 0xAD, 0x5D, 0x39, 0x31, 0x7A, 0x42, 0xDC, 0x87, 0x4C,
+    0xB6, 0xC5, 0x81, 0x84, 0x03, 0xF1, 0x8F, 0x94, 0xD1, 0xAF, 0x96, 0x87, 0xBF, 0xC5, 0x55, 0x71,
+    0x43, 0x65, 0x4D, 0x0E, 0xE6, 0x5E, 0x68, 0xCF, 0x62, 0xBA, 0x0C, 0xB9, 0x3E, 0x7D, 0xB9, 0x74,
+    0x8F, 0xAA, 0x2D, 0xFA, 0xEF, 0xB9, 0x3E, 0x52, 0x0D, 0xF5, 0xB3, 0xC1, 0xB7, 0x0D, 0x7A, 0x15,
+    0xE2, 0x3F, 0x10, 0xFE, 0x6E, 0xD0, 0xD2, 0x6C, 0x29, 0x06, 0xEA, 0x78, 0x82, 0x64, 0xF9, 0xD2,
+    0xA8, 0xE2, 0x27, 0xEC, 0x15, 0x87, 0x7C, 0x16, 0x2F, 0x89, 0xEA, 0x66, 0x11, 0xC8, 0x22, 0x38,
+    0xBA, 0x4C, 0x9B, 0x8E, 0x32, 0xE8, 0x1B, 0x08, 0x0F, 0x44, 0x8E, 0x19, 0x80, 0x40, 0xBE, 0x44,
+    0xB8, 0x67, 0x60, 0x77, 0xB0, 0xA3, 0xF7, 0xE7, 0x18, 0x3F, 0xAF, 0xE3, 0xDC, 0x64, 0x9D, 0x1B,
+    0xD6, 0x8A, 0xAC, 0xEC, 0x6F, 0x64, 0xDD, 0xF6, 0x64, 0x25, 0x27, 0x64, 0x89, 0x2C, 0xD9, 0x18,
+    0x57, 0x64, 0x55, 0xD6, 0x93, 0x95, 0x9E, 0x25, 0x8B, 0x76, 0xD7, 0xD1, 0xA9, 0xC4, 0x42, 0x46,
+    0x9E, 0xD0, 0xF3, 0xB8, 0xDC, 0xF8, 0x2F, 0x02, 0x0D, 0xC9, 0x23, 0x34, 0x9D, 0x37, 0x54, 0x33,
+    0x96, 0x65, 0x24, 0xD2, 0x74, 0x2E, 0xF4, 0x9D, 0x20, 0xEB, 0x9C, 0x19, 0xB8, 0x02, 0xBB, 0xF1,
+    0x53, 0x29, 0xC7, 0x72, 0xEF, 0x34, 0xE4, 0xAD, 0x55, 0x83, 0xEC, 0x88, 0xD3, 0xD2, 0x5C, 0x64,
+    0x34, 0x6E, 0xF0, 0x16, 0x8C, 0x65, 0x9E, 0xD2, 0x56, 0xAA, 0x73, 0x23, 0xC9, 0x7B, 0xB4, 0xBF,
+    0x88, 0xA5, 0xCB, 0xEE, 0xFB, 0x93, 0x7F, 0xE0, 0xC7, 0x91, 0x31, 0xE3, 0x4E, 0xEA, 0x9D, 0x53,
+    0x04, 0x6C, 0x65, 0xAB, 0x6E, 0x1A, 0x7A, 0xD6, 0x1C, 0xAB, 0xDD, 0xF1, 0x76, 0xCD, 0x56, 0xA4,
+    0x69, 0xDA, 0xD8, 0x7F, 0x14, 0x3C, 0x22, 0x66, 0x40, 0x52, 0x40, 0xB3, 0x38, 0x4D, 0x8A, 0x02,
+    0xC6, 0x8A, 0xC4, 0x06, 0xF4, 0x32, 0x5F, 0x0A, 0xAC, 0xD3, 0x35, 0xD7, 0x3C, 0xE5, 0x21, 0xBB,
+    0xA2, 0xD5, 0x18, 0x85, 0x4D, 0xEE, 0xD9, 0xD3, 0xEF, 0x97, 0xC1, 0x5E, 0x8D, 0xCC, 0x22, 0xAE,
+    0xBA, 0x92, 0x07, 0xAB, 0x6E, 0x67, 0x7C, 0xE3, 0x60, 0x37, 0x4E, 0x1D, 0x62, 0x77, 0x52, 0x5B,
+    0x75, 0xF6, 0xC3, 0xF4, 0x5F, 0x42, 0x3D, 0x7B, 0xFD, 0x05, 0xD5, 0x55, 0x3D, 0x6C, 0x23, 0x45,
+    0x14, 0xFE, 0x66, 0xD7, 0x61, 0xA5, 0x5B, 0x2E, 0xE3, 0xE2, 0xE8, 0x82, 0xB7, 0x3D, 0x21, 0xC7,
+    0x4B, 0x49, 0xE1, 0x9F, 0x45, 0x29, 0xAE, 0xA0, 0xE0, 0x04, 0x67, 0x90, 0xA0, 0x38, 0x5A, 0xA8,
+    0x52, 0xA4, 0x30, 0xD2, 0xE6, 0xBC, 0xB9, 0x14, 0xD7, 0x20, 0x5D, 0x81, 0xA0, 0xA1, 0x89, 0x00,
+    0x09, 0xE4, 0x2B, 0x48, 0x11, 0x24, 0x4B, 0x38, 0xF2, 0x24, 0x11, 0xA2, 0x64, 0x93, 0x48, 0x14,
+    0x34, 0xB7, 0x1C, 0xA2, 0x42, 0xE2, 0x86, 0x63, 0x41, 0x4E, 0xE2, 0x78, 0xF8, 0x66, 0xED, 0xA0,
+    0x20, 0x12, 0x24, 0x4A, 0xC6, 0x6B, 0xBF, 0x99, 0x37, 0x6F, 0xDF, 0x7B, 0xF3, 0xBD, 0x6F, 0x9E,
+    0x01, 0x40, 0xC7, 0xA8, 0x57, 0x30, 0x1D, 0xD7, 0x20, 0xDE, 0x4C, 0x90, 0x6B, 0xC4, 0x0D, 0xD4,
+    0x3C, 0x25, 0xA1, 0x3D, 0x55, 0x73, 0x53, 0x57, 0x69, 0xE4, 0x1D, 0x54, 0x1A, 0x70, 0xBF, 0x05,
+    0xBE, 0x4A, 0x20, 0x15, 0x5C, 0x0D, 0xE4, 0x40, 0x1D, 0xA8, 0x01, 0x21, 0x1C, 0x13, 0x61, 0x18,
+    0xCD, 0xDC, 0xB8, 0x07, 0x19, 0xFC, 0x7B, 0x0A, 0x15, 0x09, 0x5C, 0x5F, 0x28, 0x54, 0x7D, 0x9A,
+    0x36, 0x80, 0x41, 0xC8, 0xB7, 0x64, 0x24, 0xB4, 0xAF, 0xE8, 0x36, 0xF5, 0x94, 0xA3, 0x25, 0x03,
+    0xD2, 0x6E, 0x40, 0x37, 0x0D, 0x7A, 0x0B, 0x63, 0x40, 0xD2, 0xB1, 0x4F, 0xFF, 0x6E, 0x4A, 0xA9,
+    0x80, 0x20, 0x82, 0x9C, 0x50, 0x3D, 0x02, 0xC4, 0x2C, 0x84, 0xBC, 0xA7, 0xBC, 0x3D, 0xE5, 0xEE,
+    0xA6, 0x8E, 0xA2, 0x11, 0xE6, 0x80, 0xD7, 0x32, 0xFB, 0x7E, 0x20, 0x23, 0x7F, 0x4D, 0xBB, 0x69,
+    0x83, 0x21, 0x92, 0x3E, 0x74, 0x1D, 0x8D, 0x00, 0xDE, 0xFD, 0x08, 0xBF, 0x29, 0xD4, 0xB2, 0x22,
+    0xEB, 0x31, 0x03, 0xD1, 0x01, 0x5D, 0x27, 0xF0, 0x14, 0x86, 0x29, 0xC2, 0x74, 0xEA, 0x34, 0xA0,
+    0x46, 0xF7, 0xCF, 0x0E, 0xA1, 0xB0, 0x58, 0x87, 0x7B, 0xA8, 0xAC, 0xDB, 0xF3, 0x82, 0x28, 0x1C,
+    0x68, 0xAC, 0xCA, 0x63, 0x93, 0x86, 0x66, 0x1B, 0x25, 0x9B, 0x65, 0x63, 0x9A, 0xEC, 0xDF, 0x05,
+    0xBC, 0xDD, 0x94, 0xCF, 0x19, 0xB4, 0xA5, 0x3E, 0x6A, 0x7F, 0x3D, 0x71, 0xF1, 0xB4, 0x3E, 0x9C,
+    0x48, 0x33, 0xC1, 0xAD, 0x5A, 0x81, 0xE2, 0xEC, 0xE9, 0x9A, 0x63, 0x63, 0x7E, 0x4E, 0xEC, 0xBC,
+    0x0F, 0x27, 0xB3, 0x69, 0x5E, 0x3A, 0x1D, 0x2A, 0xC7, 0x00, 0x31, 0x84, 0xB6, 0x47, 0x09, 0x08,
+    0x37, 0xD0, 0x6E, 0xB7, 0xCC, 0xC3, 0x0F, 0x5E, 0x4D, 0x59, 0x9E, 0x06, 0x64, 0xE4, 0x9E, 0x9B,
+    0x18, 0xB4, 0xCE, 0xAD, 0x36, 0x66, 0x50, 0x2E, 0xB1, 0x9A, 0xA9, 0xC6, 0xD9, 0x20, 0x19, 0x04,
+    0xC3, 0xE3, 0x4E, 0x46, 0x44, 0x88, 0x86, 0xF7, 0x0B, 0x15, 0x27, 0x67, 0x8A, 0xE1, 0x24, 0xF2,
+    0x1E, 0x9B, 0x53, 0x2A, 0x02, 0x45, 0xC5, 0x88, 0x16, 0x21, 0x2D, 0xBC, 0x9D, 0x93, 0xC4, 0xD1,
+    0x53, 0x85, 0x18, 0x4F, 0x2D, 0x4C, 0xCE, 0xCC, 0x0A, 0x24, 0x35, 0x24, 0xE1, 0x9C, 0x0E, 0x41,
+    0x96, 0xDC, 0x8E, 0xE0, 0x9D, 0xD2, 0x19, 0xEB, 0xDC, 0x4D, 0x21, 0x4C, 0x2F, 0xF2, 0x8C, 0xD1,
+    0xC1, 0xD1, 0xEB, 0xBA, 0x9B, 0xBA, 0xFB, 0x26, 0x92, 0x37, 0x4E, 0x59, 0xB7, 0xDC, 0xD1, 0x5D,
+    0x63, 0x5E, 0x34, 0x26, 0xF3, 0x14, 0xF7, 0xEF, 0x72, 0xD2, 0x2F, 0x20, 0xE2, 0xD9, 0x89, 0x00,
+    0xA6, 0x8B, 0xAE, 0xC9, 0x02, 0x33, 0xC6, 0x05, 0x3B, 0xFE, 0x08, 0x0E, 0x69, 0xE3, 0x25, 0x10,
+    0x85, 0xCE, 0x65, 0xC8, 0x6D, 0x72, 0xA5, 0x7D, 0xB3, 0x65, 0xD2, 0xA3, 0x36, 0x11, 0x90, 0x11,
+    0xB1, 0x78, 0xEA, 0xF8, 0xD3, 0x96, 0xC9, 0x8A, 0x29, 0xB1, 0xB1, 0xDA, 0x0C, 0x2D, 0x65, 0x09,
+    0x42, 0x3A, 0x6A, 0x3B, 0x1D, 0xD9, 0xA9, 0xC8, 0x42, 0x6E, 0x92, 0x5E, 0x89, 0xA7, 0x02, 0x46,
+    0xB1, 0xD6, 0x8C, 0xB3, 0x4A, 0xE0, 0x08, 0xAA, 0xBD, 0x12, 0x08, 0xF8, 0x6D, 0x72, 0x3D, 0xCA,
+    0x59, 0x90, 0x98, 0xD6, 0x35, 0x26, 0x24, 0xA3, 0x80, 0x24, 0x26, 0x69, 0xC6, 0x03, 0x08, 0x72,
+    0xCF, 0x7A, 0x3D, 0xFB, 0xBA, 0x5C, 0xBB, 0xD9, 0x35, 0xCC, 0x39, 0x9A, 0x17, 0x21, 0xAA, 0x23,
+    0x96, 0x91, 0xF3, 0x84, 0x68, 0x0D, 0xE8, 0x34, 0x2A, 0xD8, 0x3A, 0x64, 0x59, 0x9B, 0x74, 0x95,
+    0x63, 0x64, 0xE3, 0x86, 0xEF, 0xA7, 0xE0, 0x31, 0x1C, 0x46, 0x5C, 0x2C, 0x58, 0x66, 0x5D, 0xB4,
+    0x22, 0x9B, 0xDE, 0x80, 0xC7, 0xC9, 0xD1, 0x17, 0xBC, 0xB3, 0x36, 0x3B, 0x7B, 0x09, 0xBD, 0x87,
+    0x10, 0xB7, 0x8F, 0x6E, 0x06, 0xC6, 0xA8, 0x77, 0x4C, 0x0F, 0xEE, 0x63, 0xE6, 0xD7, 0x28, 0x72,
+    0x93, 0x51, 0x9F, 0x88, 0xE4, 0xF6, 0x02, 0xD2, 0xF4, 0x91, 0xA5, 0x0F, 0xD3, 0xF0, 0x95, 0xAF,
+    0x72, 0x57, 0x05, 0x6E, 0xEA, 0x3C, 0xC9, 0x78, 0x14, 0x41, 0xC8, 0x87, 0x04, 0x97, 0x49, 0xC4,
+    0x23, 0x34, 0x64, 0xD4, 0x14, 0x3A, 0x40, 0xAD, 0x60, 0x0F, 0xAE, 0xE2, 0x6A, 0x38, 0xDE, 0x38,
+    0x78, 0xEF, 0x0A, 0x49, 0xB7, 0xE1, 0x24, 0x17, 0x88, 0xA2, 0xDE, 0x0B, 0x42, 0xC9, 0xC9, 0xC2,
+    0xF5, 0x85, 0x8B, 0x4D, 0xA6, 0x02, 0xBD, 0x4F, 0xCC, 0xD7, 0xED, 0xD9, 0xAF, 0x31, 0x86, 0x65,
+    0x4F, 0x7B, 0xBD, 0xCF, 0x8C, 0xF9, 0xA9, 0x4D, 0xAD, 0x1D, 0x0F, 0x8C, 0x1D, 0xBF, 0xB7, 0xED,
+    0x88, 0xFE, 0xA9, 0xD1, 0x95, 0xFF, 0xFA, 0x01, 0x9E, 0x69, 0xDF, 0x6A, 0x99, 0x53, 0xFE, 0x32,
+    0x49, 0x4E, 0x9E, 0xEB, 0x7D, 0xEE, 0xBB, 0xBB, 0x59, 0x1E, 0x87, 0x82, 0x8D, 0x60, 0x2F, 0xD5,
+    0x9D, 0x45, 0xC1, 0xBB, 0xB1, 0xA3, 0xFB, 0xF5, 0x79, 0x81, 0x01, 0x31, 0xD9, 0xAA, 0xB8, 0xAA,
+    0xEC, 0xBB, 0x4B, 0x77, 0x0F, 0x32, 0x9D, 0xC7, 0x71, 0x2D, 0x94, 0x6B, 0x22, 0x0A, 0xE4, 0x4B,
+    0xEB, 0x87, 0xFB, 0x5A, 0x77, 0x3A, 0x8B, 0x55, 0x29, 0xF8, 0xC6, 0x0D, 0xA5, 0x07, 0x81, 0xBC,
+    0x9B, 0xE9, 0xFA, 0xBC, 0xBB, 0x96, 0x96, 0x4B, 0xE8, 0x37, 0x02, 0xB9, 0xBE, 0xA3, 0xB7, 0xEA,
+    0x15, 0x7F, 0x69, 0x27, 0x2D, 0x97, 0xA7, 0x24, 0xF3, 0x81, 0x2A, 0xB0, 0x4C, 0x84, 0xBF, 0x79,
+    0xF0, 0x05, 0xD8, 0x24, 0x97, 0x21, 0xD4, 0x4C, 0xBB, 0x69, 0xEB, 0xEB, 0x9F, 0x23, 0x24, 0x2F,
+    0xDF, 0x68, 0xA6, 0x5B, 0xC0, 0xDB, 0x5F, 0x7E, 0x6C, 0xCC, 0xBE, 0x37, 0x67, 0x09, 0xB0, 0x45,
+    0xFA, 0x58, 0x6D, 0x15, 0xE5, 0xE5, 0x57, 0x8C, 0xF9, 0xEE, 0xA3, 0x37, 0xAC, 0xAB, 0x2D, 0x6B,
+    0x6B, 0x5F, 0x42, 0x77, 0xDD, 0xBC, 0x7C, 0xDA, 0xCA, 0x8D, 0xDA, 0xC6, 0x5B, 0x58, 0xE5, 0x65,
+    0xEB, 0x8E, 0xBA, 0x59, 0x17, 0x2B, 0xB6, 0x30, 0x8D, 0x6E, 0xB3, 0x44, 0x31, 0x72, 0x0F, 0x75,
+    0x70, 0x3F, 0x59, 0x2D, 0xA1, 0x5C, 0x74, 0x83, 0x24, 0x76, 0x7E, 0xD4, 0x61, 0x34, 0x1E, 0x79,
+    0x69, 0xAB, 0x84, 0x88, 0x0D, 0xB7, 0xD9, 0xA2, 0xA1, 0x63, 0xBE, 0xBF, 0xB4, 0xCE, 0x56, 0xD8,
+    0x9B, 0x6D, 0xB2, 0x7F, 0xA9, 0x31, 0x05, 0xBD, 0x9B, 0xE9, 0xB8, 0x82, 0x8D, 0x8B, 0x1E, 0x1A,
+    0x4C, 0xD4, 0xD3, 0x50, 0xF2, 0x72, 0x03, 0xDF, 0xE0, 0x79, 0x97, 0xF5, 0xBA, 0xD4, 0x60, 0xD6,
+    0xD4, 0x32, 0x0B, 0x24, 0x9A, 0x7D, 0x74, 0x28, 0x56, 0xAA, 0xB0, 0xFD, 0x6D, 0xF3, 0x59, 0x61,
+    0xBB, 0xF1, 0xE6, 0x7C, 0xD1, 0x8C, 0xF4, 0xBC, 0x1F, 0x15, 0x2B, 0x89, 0x62, 0xAF, 0x1A, 0x26,
+    0x41, 0xDA, 0xA9, 0x76, 0x4E, 0xB2, 0x3B, 0xBA, 0x39, 0xF8, 0x35, 0xD3, 0xFA, 0x05, 0xF9, 0xC3,
+    0x23, 0xB5, 0xC2, 0xFF, 0x10, 0x77, 0x4F, 0xAD, 0x64, 0x55, 0x78, 0x4B, 0xAA, 0x43, 0xC1, 0x5E,
+    0x66, 0xC5, 0xA2, 0x53, 0xEC, 0xD5, 0x45, 0xBA, 0x49, 0xB1, 0x89, 0x3F, 0xF4, 0xBB, 0x39, 0x1B,
+    0x4D, 0x57, 0x85, 0x19, 0xFE, 0x27, 0xE3, 0x4F, 0x9D, 0x55, 0xBD, 0x6B, 0x1C, 0x47, 0x14, 0xFF,
+    0xED, 0x8E, 0xAC, 0xB5, 0x19, 0xA4, 0x11, 0x21, 0x01, 0x43, 0x4E, 0x52, 0x0A, 0x15, 0x4E, 0x72,
+    0x9B, 0x4B, 0xA1, 0x42, 0x84, 0xBD, 0xBB, 0xB5, 0x54, 0xB8, 0x50, 0x21, 0x35, 0x57, 0xDB, 0xA5,
+    0x8B, 0x80, 0x54, 0x5C, 0xB1, 0x81, 0x13, 0x5A, 0x72, 0x85, 0x49, 0x15, 0x43, 0xFE, 0x81, 0x40,
+    0x52, 0x18, 0x27, 0x90, 0x23, 0x5C, 0xC8, 0x15, 0x67, 0xDD, 0xF8, 0x84, 0x71, 0xA1, 0x22, 0x8B,
+    0x5C, 0xA4, 0x08, 0xC4, 0x4B, 0x94, 0x34, 0x11, 0xD8, 0x6B, 0x7B, 0x0D, 0x4E, 0x74, 0xB7, 0x2F,
+    0x6F, 0xF6, 0x4E, 0xB2, 0x6C, 0x4C, 0x70, 0x32, 0x30, 0xF3, 0xE6, 0xCD, 0xC7, 0x9B, 0xF7, 0xF1,
+    0x7B, 0x6F, 0x80, 0x71, 0x13, 0xCF, 0x20, 0x47, 0x93, 0x43, 0x2D, 0x42, 0x33, 0xB1, 0xE2, 0xB6,
+    0xD0, 0xF9, 0x52, 0x6B, 0xCE, 0x8A, 0xF3, 0x89, 0x27, 0xC2, 0x24, 0x9F, 0x28, 0xC4, 0xF5, 0xD1,
+    0x69, 0x1D, 0x78, 0x18, 0x1F, 0x72, 0x4B, 0xA1, 0x8C, 0x9D, 0x74, 0x4E, 0xAE, 0x95, 0x06, 0x2A,
+    0x13, 0xB4, 0x72, 0xB8, 0xA7, 0xE4, 0xA5, 0x66, 0x3F, 0x4A, 0xAA, 0xCD, 0x6B, 0xFE, 0x63, 0x1D,
+    0x24, 0x45, 0xD8, 0xFD, 0xC8, 0x4B, 0xE6, 0x3C, 0xE9, 0xB3, 0x74, 0xE5, 0x89, 0xCF, 0xAD, 0x08,
+    0x89, 0x2B, 0x7E, 0xB2, 0x0E, 0x74, 0x1B, 0x75, 0x27, 0x3F, 0xE4, 0xC2, 0x43, 0x1C, 0xD4, 0x5D,
+    0x4F, 0xC1, 0x45, 0xA5, 0xA1, 0x36, 0x9C, 0x5F, 0x42, 0x05, 0x31, 0xB4, 0x08, 0x3D, 0x8D, 0x93,
+    0x96, 0x38, 0xA1, 0x67, 0x45, 0xD3, 0xD8, 0xB4, 0x7D, 0x66, 0x3A, 0x4E, 0x53, 0x7B, 0xAE, 0x15,
+    0x25, 0xD3, 0x12, 0x9B, 0x4B, 0xF6, 0x45, 0xB6, 0x20, 0x69, 0x7B, 0x56, 0x9C, 0xB4, 0x05, 0xBF,
+    0xEF, 0xAC, 0xF4, 0xF5, 0xB4, 0x14, 0x61, 0x81, 0x77, 0x17, 0xCE, 0x9F, 0x45, 0x20, 0x22, 0x05,
+    0xB6, 0x6E, 0x16, 0xEB, 0x41, 0x20, 0xF6, 0x23, 0xC5, 0x5C, 0x5D, 0xEC, 0xEA, 0xD9, 0x29, 0xAC,
+    0xF3, 0x8A, 0x27, 0xF6, 0xCD, 0x9A, 0x59, 0xE4, 0x55, 0xB3, 0x6C, 0xD6, 0xD7, 0x73, 0xBB, 0xAD,
+    0x14, 0x1F, 0x69, 0x67, 0x0A, 0xF1, 0x97, 0xB3, 0x42, 0xE8, 0xA5, 0xBA, 0xA5, 0x11, 0x96, 0xE5,
+    0xA7, 0x49, 0x43, 0xF9, 0x9E, 0x95, 0x48, 0xFD, 0x01, 0xFC, 0xB3, 0xE8, 0x20, 0x45, 0x6A, 0x25,
+    0x76, 0x3C, 0x6F, 0x25, 0xCA, 0x4F, 0xE1, 0x8F, 0x54, 0xF6, 0xED, 0x08, 0x2B, 0x5A, 0x85, 0xCA,
+    0xD1, 0x2E, 0xEB, 0xAF, 0xA1, 0x7C, 0x1E, 0x52, 0x38, 0x5A, 0xF9, 0x3C, 0xA4, 0x98, 0x71, 0xEE,
+    0xFB, 0x6F, 0x24, 0x4E, 0xCA, 0x31, 0x50, 0x5A, 0x7D, 0x86, 0x23, 0x7D, 0x1E, 0xEA, 0x12, 0x1B,
+    0x9D, 0xBE, 0x78, 0xF8, 0x0A, 0x1F, 0x16, 0xB1, 0xD3, 0xF7, 0x55, 0x38, 0x09, 0x4C, 0x00, 0x15,
+    0x71, 0x2F, 0x2E, 0xE7, 0x43, 0x99, 0xED, 0xF5, 0xDC, 0xF1, 0xA0, 0xBD, 0x82, 0x7D, 0x5B, 0x17,
+    0x0B, 0x76, 0xEE, 0x37, 0x11, 0x97, 0xAB, 0xCE, 0x41, 0xBC, 0x35, 0x91, 0xEB, 0xB3, 0x31, 0x74,
+    0xB2, 0x5B, 0x13, 0xA9, 0x67, 0x47, 0x6D, 0xB9, 0x1C, 0xB9, 0x6C, 0x6C, 0xC3, 0xBE, 0xAB, 0x65,
+    0x17, 0xF3, 0x1A, 0x0D, 0x0E, 0x3E, 0x9C, 0xB1, 0xD6, 0x1C, 0x22, 0xA5, 0x51, 0x02, 0x66, 0xF0,
+    0xDE, 0xCD, 0x9B, 0x5F, 0x10, 0x65, 0x66, 0x95, 0x25, 0xEE, 0x87, 0x90, 0x8C, 0x90, 0x96, 0xF8,
+    0x63, 0x03, 0x56, 0x2F, 0x02, 0xDE, 0xFF, 0x1A, 0xF2, 0xCF, 0x01, 0xDA, 0xF0, 0x18, 0x4A, 0xC5,
+    0x0F, 0x81, 0xC5, 0xE3, 0x60, 0xC5, 0xA8, 0xA3, 0x88, 0x29, 0x86, 0x98, 0x08, 0xD9, 0x63, 0x86,
+    0xAD, 0x60, 0x5A, 0xCB, 0x45, 0xB1, 0x6A, 0xEB, 0x28, 0xBE, 0xB0, 0xE9, 0xE4, 0xF0, 0x1A, 0x1D,
+    0x7E, 0x81, 0xAC, 0x7B, 0x13, 0x86, 0xEC, 0x6C, 0xED, 0x18, 0xD2, 0x1B, 0x3D, 0x8E, 0x9D, 0x91,
+    0x66, 0x0F, 0x73, 0x15, 0xC5, 0xDD, 0xDC, 0x3C, 0xB5, 0x9B, 0x63, 0xD3, 0xB9, 0xC8, 0x9A, 0xE0,
+    0x5D, 0xEE, 0x57, 0x81, 0x32, 0x93, 0x60, 0x24, 0x8A, 0x49, 0x91, 0xC9, 0x12, 0xB6, 0x8A, 0x1B,
+    0xF8, 0x6B, 0xF1, 0x56, 0x8F, 0x08, 0x44, 0x43, 0xAB, 0xE7, 0xE3, 0xCC, 0xD0, 0xC7, 0x91, 0x0F,
+    0xEB, 0x01, 0xEC, 0x03, 0x0D, 0xB1, 0x17, 0x3A, 0xFD, 0x04, 0xAA, 0x19, 0x49, 0x46, 0xBB, 0x12,
+    0x2C, 0x8E, 0xF7, 0x80, 0x9B, 0x5F, 0xD1, 0x9D, 0x9A, 0x79, 0x2E, 0x04, 0xFB, 0xD3, 0x64, 0x04,
+    0xBF, 0xD7, 0x36, 0x12, 0x8D, 0xE0, 0x39, 0x03, 0x0E, 0x48, 0xDF, 0x6C, 0xB3, 0x53, 0xD8, 0x69,
+    0x66, 0xBB, 0x75, 0xFC, 0xFC, 0x2C, 0x5F, 0xAC, 0xA6, 0x74, 0x4F, 0x2B, 0xE6, 0x12, 0x31, 0x26,
+    0xB4, 0x36, 0x3C, 0xC5, 0x31, 0xE1, 0x23, 0xD1, 0xF6, 0x23, 0x8A, 0x94, 0x5F, 0x46, 0x2A, 0xC6,
+    0xE4, 0x67, 0xBA, 0x3C, 0x7C, 0xCE, 0x19, 0xB2, 0xFD, 0x94, 0x46, 0x99, 0x30, 0x49, 0x61, 0x29,
+    0x93, 0x34, 0xAC, 0x52, 0x72, 0x5D, 0xDE, 0xC1, 0x96, 0x79, 0x54, 0x86, 0x2C, 0x8D, 0xD5, 0x63,
+    0x75, 0x3A, 0x23, 0x46, 0x6A, 0xDE, 0x51, 0xF9, 0x10, 0xB2, 0x4B, 0x18, 0x46, 0x6E, 0x1E, 0x55,
+    0x70, 0x18, 0xC4, 0xA9, 0x94, 0x82, 0x9D, 0xDF, 0x1A, 0x40, 0xC6, 0xA8, 0x1A, 0xA4, 0x5B, 0xC7,
+    0x1B, 0x6F, 0x67, 0xE8, 0xF6, 0x28, 0xEA, 0x2E, 0xD8, 0x49, 0x97, 0xDF, 0x30, 0xBD, 0xC3, 0x3D,
+    0xE0, 0x1B, 0x01, 0x8B, 0x0F, 0xF8, 0x78, 0x80, 0x67, 0xA8, 0x5B, 0x09, 0x16, 0x59, 0x72, 0xDE,
+    0x4F, 0x09, 0xED, 0x88, 0x04, 0x03, 0xD3, 0xD9, 0x93, 0x33, 0x66, 0xAD, 0x32, 0x49, 0x51, 0x65,
+    0x9E, 0xD2, 0xCA, 0x39, 0x74, 0x2B, 0x1C, 0x26, 0x8E, 0x93, 0xEB, 0x32, 0xE5, 0xDE, 0x75, 0x61,
+    0x73, 0x0D, 0x90, 0xBA, 0xC8, 0x98, 0x2B, 0xB0, 0xF6, 0x05, 0x16, 0x5D, 0x40, 0xFD, 0x44, 0xC9,
+    0x0A, 0xC3, 0xB3, 0xCA, 0xA2, 0x2A, 0xE8, 0x32, 0xF4, 0x67, 0xF0, 0x56, 0xAD, 0xB6, 0x46, 0xF4,
+    0xA8, 0x56, 0xEB, 0xE4, 0x9E, 0x2E, 0x9F, 0xC4, 0x22, 0x34, 0x96, 0x72, 0xF8, 0xEC, 0x51, 0xA8,
+    0x9E, 0x81, 0x2F, 0x32, 0x82, 0x62, 0x77, 0x9B, 0x56, 0x25, 0x3D, 0xEE, 0xD3, 0xB0, 0xD5, 0xA3,
+    0x6F, 0x4B, 0x74, 0x28, 0xE9, 0xEF, 0x3E, 0x65, 0xCC, 0x7C, 0x5C, 0xA2, 0x3D, 0x49, 0xBF, 0xF5,
+    0x29, 0x6E, 0xFD, 0xE0, 0x17, 0x8B, 0x90, 0x92, 0x0B, 0x16, 0x23, 0xBC, 0x85, 0x97, 0x99, 0xBC,
+    0xD5, 0x6A, 0xCB, 0x44, 0x8F, 0x69, 0xD8, 0x20, 0x52, 0xDB, 0xB4, 0xFB, 0x90, 0x92, 0x23, 0x1A,
+    0x54, 0x98, 0xE9, 0xD1, 0xEE, 0x7D, 0x4A, 0x9E, 0xD0, 0xC0, 0xDB, 0xA6, 0xEF, 0x26, 0x29, 0x0F,
+    0x56, 0xAD, 0xE6, 0x57, 0x29, 0x53, 0x97, 0xE9, 0xA0, 0x49, 0x83, 0x98, 0x28, 0xA8, 0xD2, 0x03,
+    0x45, 0x47, 0x4D, 0xCA, 0x98, 0xE9, 0x54, 0xE9, 0x57, 0x45, 0x4F, 0x0E, 0x29, 0x25, 0x1A, 0x95,
+    0xDA, 0x46, 0x6E, 0x8C, 0x07, 0x7F, 0x69, 0x22, 0xFB, 0x24, 0x33, 0xB8, 0x1F, 0x32, 0xDE, 0x0D,
+    0xD6, 0x55, 0x33, 0x96, 0x06, 0x5E, 0xB8, 0x5A, 0x55, 0xFA, 0xFA, 0xB1, 0x57, 0x2C, 0xAE, 0x40,
+    0xCB, 0x31, 0xD7, 0xCC, 0x7F, 0x4B, 0xC3, 0xFF, 0xD3, 0x5E, 0x95, 0xE8, 0xAF, 0xA1, 0xDC, 0x6B,
+    0xDA, 0xC0, 0x61, 0xD2, 0xDE, 0xC0, 0xB9, 0x16, 0xB6, 0x38, 0x64, 0x5C, 0x1E, 0x3D, 0x38, 0x21,
+    0xCC, 0xDC, 0x1A, 0xCF, 0xDB, 0xE3, 0xB9, 0xD3, 0x0C, 0xBB, 0x6D, 0x69, 0x1C, 0xF9, 0xA6, 0xB9,
+    0x35, 0x4F, 0xBF, 0x73, 0x16, 0x3E, 0xDD, 0xC8, 0x7C, 0x57, 0xB2, 0x4E, 0x14, 0xBF, 0xC3, 0xC9,
+    0x70, 0x03, 0x38, 0xB3, 0x0E, 0x87, 0x52, 0x46, 0x4C, 0xC0, 0xE5, 0x6B, 0x89, 0x0D, 0x5F, 0x0C,
+    0x4D, 0xFA, 0x4E, 0x9A, 0x0F, 0x8A, 0x23, 0x28, 0xD1, 0xF8, 0x3E, 0xB2, 0xA8, 0x0D, 0x27, 0xC3,
+    0x36, 0xD1, 0xFE, 0x37, 0xD9, 0x0D, 0xF4, 0x12, 0xB8, 0x3F, 0x6A, 0xB9, 0x3A, 0x8F, 0x99, 0xD6,
+    0xFA, 0xF8, 0x13, 0xCC, 0xCB, 0x4A, 0x84, 0xF9, 0x10, 0x17, 0x4E, 0xB9, 0x62, 0x86, 0x91, 0x69,
+    0x92, 0xE9, 0xDC, 0x4B, 0x2E, 0xBA, 0xC2, 0xA5, 0x95, 0xCB, 0x33, 0x6B, 0x96, 0xB4, 0x03, 0xF3,
+    0xE9, 0x98, 0x5F, 0xE7, 0x76, 0x14, 0x3B, 0x2B, 0x4D, 0xF3, 0xEF, 0x38, 0xC2, 0x2F, 0x4C, 0x8D,
+    0x7E, 0x9E, 0xB3, 0xCF, 0x65, 0xC3, 0x48, 0xC7, 0x0B, 0xF2, 0x4F, 0xBF, 0x04, 0x2C, 0x33, 0x66,
+    0xE5, 0x1E, 0x5B, 0x5C, 0x32, 0xEF, 0x2D, 0xBC, 0xF2, 0xDC, 0x95, 0xBC, 0xAC, 0x9B, 0xE2, 0xE7,
+    0x1F, 0x7B, 0xE6, 0xBF, 0xB5, 0x7F, 0x00, 0xDD, 0x55, 0xCD, 0x6F, 0x1B, 0x45, 0x14, 0x7F, 0xB3,
+    0xE3, 0xD8, 0xAA, 0x47, 0xF5, 0xE4, 0x90, 0xA2, 0x48, 0x71, 0x62, 0x0E, 0x1C, 0xAA, 0xC8, 0xB1,
+    0x2F, 0x46, 0x32, 0x68, 0xEB, 0x9D, 0xB4, 0x12, 0x48, 0x54, 0xA8, 0x51, 0x94, 0x9C, 0x2A, 0xD4,
+    0x1C, 0x38, 0x55, 0x54, 0xE4, 0xE0, 0x03, 0x42, 0x8E, 0xB3, 0x90, 0x3F, 0xA0, 0x01, 0x0A, 0xBD,
+    0xF6, 0xC0, 0x81, 0x14, 0xA4, 0x6C, 0xA3, 0x20, 0x59, 0x38, 0x69, 0x26, 0xCA, 0x01, 0x09, 0x4B,
+    0x68, 0xC3, 0xC7, 0x05, 0x0E, 0xD9, 0xD0, 0xB4, 0x85, 0xA4, 0x52, 0x07, 0x62, 0x24, 0x37, 0xB1,
+    0x77, 0x78, 0x63, 0x27, 0x10, 0x85, 0x44, 0xDC, 0x99, 0x9D, 0x79, 0x33, 0xEF, 0xCD, 0x9B, 0x37,
+    0x6F, 0x7E, 0x6F, 0xF6, 0x0D, 0x00, 0x00, 0x51, 0x00, 0xB1, 0x9A, 0x04, 0x48, 0xBD, 0x86, 0xDC,
+    0x79, 0x38, 0xA9, 0x4C, 0x60, 0xA3, 0x01, 0x12, 0xEE, 0x22, 0xE9, 0x39, 0x51, 0xE7, 0x05, 0x6C,
+    0x1F, 0xA2, 0x2D, 0x66, 0x6C, 0x65, 0x23, 0xC8, 0x75, 0x43, 0x69, 0xA9, 0x74, 0x54, 0x25, 0x6F,
+    0xD8, 0x38, 0x0E, 0xA6, 0xB0, 0xD5, 0xB1, 0x89, 0xE3, 0x46, 0xCE, 0x03, 0x41, 0x1B, 0x1C, 0x4D,
+    0x18, 0x0B, 0xDD, 0xC7, 0xA7, 0x8F, 0xAE, 0x85, 0x43, 0x4F, 0x94, 0x71, 0x0E, 0xF7, 0x6C, 0x70,
+    0x4B, 0x51, 0x65, 0x73, 0xC9, 0x84, 0xEA, 0xEF, 0x88, 0x80, 0x1B, 0x05, 0x1B, 0x40, 0x63, 0xD9,
+    0x35, 0x44, 0xFE, 0x2D, 0x6A, 0x2F, 0xEC, 0xA5, 0x72, 0x02, 0x17, 0xD2, 0x80, 0x06, 0x36, 0x77,
+    0x09, 0xA8, 0xC8, 0xC1, 0xC2, 0x33, 0x00, 0x11, 0xC7, 0x19, 0x32, 0x6A, 0x05, 0xA7, 0x70, 0xD0,
+    0x45, 0x4E, 0x24, 0x2C, 0x8C, 0xC3, 0x9D, 0x38, 0xD7, 0x86, 0x9E, 0x50, 0xD1, 0x09, 0x2D, 0x6D,
+    0x2A, 0x9D, 0xD3, 0x15, 0x58, 0xE8, 0xAC, 0xD6, 0xF9, 0xC9, 0xB3, 0x6D, 0x05, 0x18, 0xE1, 0x56,
+    0xC3, 0xA9, 0x85, 0xA7, 0x2B, 0xA8, 0x17, 0xBF, 0x89, 0x0F, 0xBA, 0xA7, 0x5B, 0x60, 0xC1, 0x7F,
+    0x38, 0x29, 0x68, 0x48, 0x1F, 0xF9, 0x81, 0x5D, 0x64, 0x43, 0x56, 0x4D, 0xDC, 0xF3, 0xD3, 0xEF,
+    0x70, 0x1E, 0x7B, 0x4F, 0xCB, 0x3E, 0x97, 0x75, 0x57, 0xAB, 0xD5, 0xAF, 0x50, 0x25, 0x05, 0x88,
+    0xAD, 0x8A, 0xD9, 0xF4, 0x26, 0x5D, 0x5B, 0xFD, 0xB1, 0xAE, 0xB5, 0xCB, 0x0D, 0x58, 0x77, 0x30,
+    0xDC, 0xAD, 0xA1, 0xB1, 0x3C, 0xE4, 0xC1, 0x69, 0x9C, 0x2B, 0x23, 0xC0, 0xF8, 0x95, 0x97, 0xFB,
+    0x02, 0xE8, 0x21, 0x7A, 0xB8, 0x8E, 0x30, 0xE7, 0xC4, 0x80, 0x7E, 0x75, 0xFD, 0x77, 0x3F, 0x59,
+    0x8C, 0x5D, 0xA1, 0xAB, 0xFB, 0x41, 0xDF, 0x2C, 0x1A, 0xD3, 0xAB, 0xE3, 0x0A, 0x8A, 0x18, 0x89,
+    0x04, 0x30, 0xA0, 0xAE, 0x25, 0x51, 0x71, 0xD1, 0xDC, 0x3F, 0x41, 0x35, 0x5D, 0x0F, 0x02, 0xFB,
+    0xC2, 0x00, 0x0D, 0x41, 0x4B, 0x55, 0x2A, 0xB2, 0x01, 0xBA, 0xB6, 0x83, 0xAB, 0x88, 0x88, 0x85,
+    0x74, 0x75, 0x53, 0xA6, 0x3D, 0xD6, 0x8F, 0x12, 0x35, 0xF8, 0x16, 0x6E, 0xC5, 0x2E, 0xCE, 0xBB,
+    0x65, 0x01, 0x82, 0x48, 0x22, 0x07, 0x7F, 0x73, 0x5A, 0xA6, 0x07, 0x31, 0x38, 0xE7, 0xB4, 0x9C,
+    0xF0, 0xDC, 0x18, 0x80, 0x13, 0x02, 0x44, 0xE9, 0xFB, 0x32, 0xC8, 0x25, 0x63, 0x44, 0x4E, 0x9E,
+    0xA5, 0xAE, 0x97, 0x20, 0xEE, 0x44, 0x82, 0xC8, 0x3C, 0xB7, 0xE4, 0x64, 0x92, 0x59, 0x32, 0x98,
+    0xCC, 0xF7, 0x22, 0xC6, 0xF3, 0xCD, 0xC5, 0x84, 0x17, 0x3F, 0xFC, 0x10, 0x95, 0xD3, 0x31, 0xC1,
+    0x23, 0xF3, 0xDD, 0x1A, 0x28, 0x7E, 0x58, 0xA3, 0x44, 0x64, 0x1B, 0xF9, 0x21, 0x3C, 0x4C, 0x02,
+    0xD2, 0xB0, 0x68, 0xF9, 0x4C, 0x0C, 0xC1, 0x74, 0x38, 0x38, 0x47, 0x04, 0x0B, 0xE9, 0xC5, 0x00,
+    0xC1, 0xE9, 0xB7, 0xEE, 0xC3, 0x8A, 0xC4, 0x03, 0x23, 0x6A, 0xB5, 0x1D, 0x7F, 0xDE, 0xFD, 0xDF,
+    0x43, 0x1A, 0xDD, 0x3A, 0xF3, 0x06, 0x30, 0x72, 0x6D, 0x60, 0x3E, 0xC7, 0x72, 0xBC, 0x50, 0x8D,
+    0x0E, 0x5B, 0x5B, 0xF4, 0xF6, 0x8C, 0x3B, 0xF9, 0xF0, 0x46, 0xE1, 0x6E, 0x02, 0xD0, 0xBF, 0xC2,
+    0x17, 0xE4, 0x53, 0xB0, 0x1A, 0xF4, 0xF6, 0x9A, 0xCC, 0xFB, 0x2C, 0x67, 0x7D, 0x0B, 0x0B, 0x32,
+    0x5F, 0xA8, 0xA0, 0xF0, 0xF9, 0x28, 0x8B, 0x89, 0x07, 0x2E, 0x77, 0xA9, 0x4F, 0x9E, 0x90, 0xEF,
+    0x64, 0x90, 0xEF, 0x26, 0xD0, 0x17, 0xC4, 0xAF, 0x0A, 0xF0, 0x20, 0xE9, 0xE8, 0xD7, 0xC9, 0x9A,
+    0xEB, 0xBD, 0xAB, 0xC8, 0x2C, 0xB2, 0xE6, 0x5B, 0xD8, 0x5A, 0xBE, 0xE1, 0x1D, 0x09, 0xDF, 0x48,
+    0x57, 0x47, 0xEE, 0xF5, 0x7A, 0xDE, 0x82, 0xAC, 0xC2, 0x8A, 0x58, 0x90, 0x9E, 0xE7, 0xD9, 0x23,
+    0x91, 0xAA, 0x29, 0x5F, 0x8E, 0x06, 0xCB, 0xD9, 0x6B, 0x0F, 0x77, 0x20, 0xC8, 0xC8, 0x1C, 0xF3,
+    0xCE, 0x5A, 0x4F, 0xA8, 0xA8, 0x82, 0x6F, 0x98, 0x91, 0x08, 0x88, 0xD1, 0x7F, 0x59, 0x1B, 0x0D,
+    0xB2, 0x57, 0x2F, 0xC3, 0x1F, 0x32, 0xE9, 0xC5, 0xD2, 0x78, 0x19, 0x7E, 0xD9, 0x53, 0xF7, 0x66,
+    0xD3, 0x08, 0x33, 0x1E, 0x82, 0x6D, 0xBD, 0xF4, 0x66, 0x0E, 0x32, 0x10, 0x55, 0x08, 0x7D, 0xF2,
+    0xE5, 0xCA, 0x73, 0x22, 0x42, 0x64, 0xF9, 0x93, 0x1F, 0xD2, 0x96, 0xC4, 0x9A, 0x84, 0x67, 0xC4,
+    0x84, 0x1A, 0x52, 0x2D, 0x60, 0x3B, 0xD2, 0xA4, 0xDB, 0x0C, 0x26, 0x19, 0x1F, 0x93, 0x10, 0x19,
+    0xBF, 0x24, 0x9D, 0x16, 0xE6, 0x06, 0xEA, 0xDB, 0x90, 0xC5, 0xB8, 0xB7, 0xA6, 0xC6, 0x2C, 0xCC,
+    0x51, 0x64, 0x6A, 0xAC, 0x9D, 0x85, 0xEC, 0x4E, 0x32, 0x2A, 0x7C, 0x06, 0x54, 0xFB, 0xC0, 0x12,
+    0x40, 0x67, 0x84, 0xA5, 0x03, 0xA6, 0x43, 0xDE, 0x2C, 0xB0, 0x5A, 0x82, 0x7E, 0x3F, 0x33, 0xAC,
+    0x36, 0x65, 0xA5, 0xE8, 0x65, 0x92, 0x79, 0x76, 0x39, 0x61, 0x3D, 0x98, 0x11, 0xA5, 0x4D, 0xC9,
+    0x8B, 0x1E, 0x6D, 0xE6, 0x61, 0x3A, 0x01, 0x31, 0xFD, 0x14, 0x53, 0x9F, 0x2C, 0x22, 0x62, 0x79,
+    0xE8, 0xEA, 0xEA, 0x24, 0xCD, 0x94, 0x16, 0x8E, 0x56, 0x59, 0xD1, 0x93, 0x6A, 0xE7, 0x73, 0xDC,
+    0xC1, 0xF8, 0x54, 0x49, 0x4C, 0x67, 0xA8, 0xAE, 0xB9, 0x4D, 0x2B, 0xB0, 0xA1, 0x84, 0xD7, 0xCD,
+    0x78, 0xA5, 0x60, 0x09, 0xAF, 0xEB, 0x06, 0xE6, 0xCF, 0xA7, 0x2E, 0x43, 0x17, 0x30, 0x8F, 0x68,
+    0xCD, 0xB1, 0x0A, 0x38, 0x5E, 0xB7, 0xE7, 0xB8, 0x6E, 0xF1, 0x8F, 0xC7, 0x3A, 0xAC, 0xD6, 0xB0,
+    0xA2, 0xFF, 0x99, 0x35, 0x85, 0xE8, 0x00, 0x65, 0x2E, 0x17, 0xDD, 0x24, 0x68, 0x43, 0x60, 0x75,
+    0x3A, 0x47, 0x37, 0xAC, 0x95, 0xBB, 0x02, 0x39, 0x52, 0x1E, 0x37, 0x9C, 0xE9, 0xDA, 0xF0, 0x80,
+    0x59, 0x4A, 0xB5, 0x6E, 0x39, 0xBA, 0xBD, 0xB7, 0x79, 0x85, 0xC0, 0xBC, 0x42, 0xC4, 0x87, 0x91,
+    0xEB, 0x97, 0x7E, 0x12, 0xBB, 0xFA, 0xB1, 0x56, 0xFA, 0x15, 0xFD, 0x41, 0xB3, 0x09, 0xF7, 0xC1,
+    0x6E, 0x40, 0x09, 0x2E, 0xD4, 0x3B, 0x64, 0xC9, 0x90, 0x26, 0x12, 0xCB, 0x10, 0x6A, 0x08, 0x33,
+    0xB2, 0x84, 0x99, 0x4D, 0x1B, 0x62, 0x23, 0xC1, 0x9F, 0xE5, 0xE0, 0x01, 0x81, 0xF6, 0xE1, 0x24,
+    0x03, 0x47, 0xD8, 0x10, 0x82, 0xA2, 0x4D, 0x2A, 0xF9, 0x22, 0x07, 0x5B, 0xD9, 0xF1, 0xFD, 0xED,
+    0xBD, 0xAC, 0xD6, 0x4D, 0xCE, 0x91, 0x1D, 0xB2, 0xF1, 0xF8, 0xBA, 0x6F, 0x7B, 0xFF, 0x57, 0x6E,
+    0x6D, 0x80, 0x8D, 0x86, 0x15, 0x57, 0x54, 0xA6, 0x24, 0x07, 0x07, 0x3D, 0x5E, 0x02, 0xE7, 0x19,
+    0x06, 0x4D, 0x37, 0xD1, 0xFD, 0x98, 0x42, 0x6C, 0x53, 0x02, 0xA5, 0x75, 0x1C, 0xB0, 0x19, 0x34,
+    0x5C, 0x2F, 0xA2, 0x55, 0x76, 0xCB, 0x8E, 0x3D, 0xD6, 0x6B, 0xBA, 0x99, 0xBA, 0xE5, 0xB4, 0x60,
+    0x11, 0xF1, 0x67, 0x38, 0x75, 0x6C, 0xE0, 0xE2, 0xA0, 0xFC, 0x91, 0x04, 0x2B, 0x6C, 0x83, 0xA7,
+    0xB7, 0xCC, 0x33, 0x82, 0x8E, 0xAA, 0x94, 0x8B, 0x3F, 0x28, 0x3E, 0xA3, 0xB8, 0xE9, 0xF5, 0x2B,
+    0x60, 0x67, 0x43, 0x45, 0xBF, 0x5E, 0xBF, 0x09, 0x95, 0x0A, 0xFC, 0xF9, 0x36, 0x73, 0xB9, 0xF6,
+    0x0B, 0xB0, 0xD7, 0xB0, 0x5A, 0x18, 0xBE, 0x58, 0x43, 0x65, 0x80, 0x6D, 0x60, 0x70, 0xB3, 0x8A,
+    0x0B, 0xA2, 0xA1, 0x24, 0x32, 0x8A, 0xFE, 0xFC, 0xF9, 0x06, 0x64, 0xA6, 0x0F, 0x1E, 0xD0, 0xBF,
+    0x00, 0x85, 0x55, 0x31, 0x8C, 0xD4, 0x46, 0x14, 0x7D, 0xF6, 0xC0, 0x39, 0x92, 0xA3, 0x1B, 0x0A,
+    0x14, 0x45, 0x4A, 0x58, 0x53, 0x50, 0x25, 0xB0, 0x9B, 0x22, 0xC5, 0xA2, 0xAC, 0xCF, 0x06, 0x14,
+    0x51, 0x20, 0x45, 0x48, 0x01, 0x51, 0xA4, 0x20, 0x45, 0x2A, 0x28, 0x2E, 0x05, 0xC5, 0x16, 0x7B,
+    0xAC, 0xA1, 0x41, 0x4A, 0xC3, 0x49, 0x51, 0xEA, 0x50, 0xA4, 0x40, 0x5C, 0x71, 0x57, 0x5C, 0x24,
+    0x93, 0xDC, 0x9D, 0x8D, 0x90, 0x42, 0x11, 0x29, 0x38, 0x24, 0x6D, 0x84, 0x91, 0x82, 0x90, 0xEE,
+    0xA2, 0xDC, 0x28, 0x18, 0x58, 0xC8, 0xAE, 0x27, 0xEF, 0xFB, 0x8E, 0x53, 0xA2, 0x48, 0xC9, 0xC8,
+    0x33, 0x9E, 0x3F, 0x9E, 0x99, 0xFF, 0xFF, 0xFB, 0xEF, 0x7F, 0x5F, 0x70, 0x4B, 0xBF, 0x85, 0xB1,
+    0xBA, 0x9D, 0x47, 0x30, 0xA6, 0x95, 0x77, 0x7B, 0xFE, 0x85, 0x96, 0x7F, 0xF4, 0x07, 0xFF, 0x48,
+    0xF1, 0xF8, 0x72, 0xDE, 0xEF, 0x1A, 0x93, 0x59, 0x6B, 0xCF, 0x6F, 0x6E, 0xDA, 0xF9, 0x3F, 0x6E,
+    0xFD, 0x94, 0x1C, 0x34, 0x87, 0x0B, 0x6F, 0x30, 0xFD, 0x29, 0x7E, 0x77, 0x7F, 0x43, 0x14, 0x67,
+    0xD0, 0x79, 0x90, 0xBB, 0x46, 0x95, 0x58, 0x41, 0x85, 0xAC, 0x8E, 0xB5, 0xB5, 0xA5, 0x36, 0x4E,
+    0xA5, 0x0D, 0x06, 0xDA, 0xEC, 0xE9, 0x69, 0xD3, 0x97, 0x1E, 0xFE, 0x47, 0xDF, 0xCB, 0x8E, 0x36,
+    0xFB, 0xC0, 0x5C, 0x5C, 0xA8, 0xCC, 0xD0, 0xCE, 0x03, 0x3A, 0x06, 0x42, 0x28, 0x6B, 0xA1, 0xED,
+    0x58, 0x44, 0xE7, 0xAB, 0x10, 0xC3, 0x49, 0xE5, 0x3D, 0x1C, 0x16, 0x33, 0x88, 0x8E, 0x18, 0xCC,
+    0x79, 0x39, 0xAA, 0x36, 0x54, 0x91, 0x42, 0x1F, 0x2D, 0x11, 0x8A, 0xA8, 0xE1, 0x15, 0x11, 0xCD,
+    0x8A, 0x16, 0x26, 0xE8, 0x8C, 0x96, 0xB1, 0xDD, 0x22, 0x5E, 0x63, 0xE5, 0x1A, 0x69, 0xC3, 0x11,
+    0xE5, 0x52, 0x17, 0xAF, 0x38, 0x46, 0x54, 0x40, 0xE5, 0x70, 0x56, 0x4F, 0xC7, 0x43, 0x3B, 0x76,
+    0x6E, 0x9E, 0x86, 0x9F, 0xC0, 0xE3, 0xEE, 0xA1, 0xA5, 0xF9, 0xFC, 0x56, 0x00, 0x1D, 0x9E, 0xE1,
+    0x51, 0x55, 0x4F, 0xE0, 0xDB, 0x9C, 0x82, 0x97, 0xB8, 0x65, 0x0B, 0x01, 0xFA, 0x8E, 0x71, 0x4A,
+    0x1D, 0x7B, 0xC9, 0x08, 0x2D, 0x1E, 0xEB, 0x0F, 0xE0, 0x3C, 0xCA, 0x41, 0xB4, 0x6E, 0x65, 0xF6,
+    0x06, 0xE6, 0x28, 0x96, 0x29, 0x37, 0x57, 0x68, 0x51, 0x53, 0xDF, 0xE5, 0x66, 0x55, 0x7A, 0x89,
+    0x97, 0xB7, 0xE0, 0xE7, 0x43, 0x6B, 0x37, 0xAC, 0x38, 0x47, 0x37, 0x2B, 0xBA, 0xF7, 0x3E, 0xF0,
+    0xD4, 0x40, 0x8F, 0x80, 0x09, 0x2D, 0x8C, 0x11, 0x55, 0xC6, 0xBF, 0xBA, 0x0A, 0x58, 0xEA, 0x4F,
+    0x10, 0x54, 0xF0, 0xEE, 0xC7, 0xD8, 0x5F, 0xE1, 0xE5, 0x81, 0xA6, 0xBD, 0x21, 0x40, 0xD1, 0x19,
+    0x71, 0x6C, 0x2F, 0x86, 0xB2, 0x74, 0x52, 0x8B, 0x85, 0x46, 0xEC, 0x86, 0x71, 0x4B, 0xD0, 0x06,
+    0x71, 0xD3, 0x6D, 0x46, 0x55, 0x34, 0x63, 0x4E, 0xBB, 0xE1, 0xE5, 0x6E, 0x39, 0x34, 0x5E, 0xA2,
+    0x8A, 0xE7, 0x63, 0x3F, 0xF6, 0x6F, 0x97, 0xA1, 0x8E, 0xF5, 0xB1, 0x3C, 0xD4, 0xB8, 0xE8, 0xE5,
+    0xBD, 0x60, 0x6A, 0xEC, 0x27, 0x2B, 0x1D, 0xC2, 0xB4, 0x51, 0x75, 0x9E, 0x43, 0x67, 0x72, 0x9F,
+    0x6E, 0x94, 0xB6, 0x9A, 0xF1, 0x50, 0x33, 0x86, 0xCD, 0xD8, 0x6B, 0xC6, 0xC1, 0xB6, 0x51, 0x59,
+    0x82, 0x8B, 0x15, 0xC2, 0x16, 0xB4, 0xCA, 0x55, 0x6E, 0xC0, 0xB0, 0x1E, 0x3A, 0x04, 0xEF, 0x2A,
+    0xF0, 0x2C, 0x41, 0x94, 0xC3, 0xA3, 0x51, 0x06, 0xD7, 0xD6, 0x30, 0x88, 0xF2, 0x68, 0x65, 0xB9,
+    0xB5, 0x16, 0x68, 0xAD, 0xEE, 0x5C, 0x8E, 0x97, 0x9B, 0xAB, 0x19, 0x0C, 0x7E, 0x45, 0x1F, 0xFE,
+    0x04, 0xEE, 0x84, 0xA1, 0x98, 0x07, 0xAD, 0x40, 0xEA, 0x95, 0x53, 0x0F, 0x3F, 0xFA, 0x99, 0x88,
+    0x99, 0x36, 0xB5, 0xA6, 0x58, 0x7E, 0xFB, 0xC5, 0xC2, 0x68, 0x76, 0x3D, 0xBB, 0xD6, 0xC6, 0x08,
+    0x6B, 0x59, 0xEE, 0xDA, 0x4A, 0x42, 0x87, 0x36, 0x2D, 0x48, 0xC5, 0x5F, 0xEC, 0x88, 0xC0, 0x92,
+    0x40, 0xF5, 0xAB, 0x30, 0x40, 0x8D, 0x96, 0x3E, 0xD1, 0xF9, 0x12, 0x63, 0xBA, 0x84, 0x19, 0xF6,
+    0x1E, 0xFB, 0xA0, 0xE9, 0x5F, 0x9F, 0x1A, 0x20, 0x9B, 0x0C, 0xF0, 0xCD, 0x2A, 0xE5, 0x30, 0x64,
+    0xE7, 0x9E, 0x50, 0x27, 0x4B, 0xA1, 0x57, 0x2D, 0x85, 0x8E, 0xFD, 0x93, 0x84, 0xB2, 0xA3, 0xE6,
+    0x2E, 0xE9, 0x3E, 0xED, 0x14, 0xA8, 0x03, 0x2A, 0x9A, 0xA1, 0xC1, 0x3D, 0xC6, 0x24, 0xA5, 0xE2,
+    0xD1, 0x80, 0x6A, 0xEC, 0xF8, 0xCC, 0x93, 0xD9, 0x53, 0xAA, 0xD0, 0x38, 0xBF, 0xBE, 0x78, 0x5D,
+    0x64, 0x1D, 0xAB, 0x22, 0x80, 0x2A, 0xDB, 0x70, 0x0C, 0xE1, 0xAA, 0x08, 0x56, 0x3A, 0xDA, 0xC6,
+    0xAC, 0x63, 0x99, 0x33, 0x35, 0x3E, 0x76, 0xCD, 0x4E, 0x74, 0xF5, 0x09, 0x6B, 0x27, 0xE7, 0x16,
+    0xEA, 0x79, 0xA7, 0x86, 0x5B, 0x93, 0x76, 0x76, 0x42, 0x5A, 0xDD, 0x2B, 0x1B, 0xC4, 0xC5, 0xB7,
+    0x20, 0x76, 0x62, 0xBB, 0x59, 0xB9, 0x3C, 0xD7, 0x34, 0x2E, 0x0D, 0xEB, 0x38, 0xB0, 0xD6, 0x99,
+    0x74, 0x0F, 0xE8, 0x9C, 0xC9, 0xA8, 0x12, 0x55, 0x4E, 0x33, 0x64, 0x5D, 0x2A, 0x61, 0xF0, 0x15,
+    0x79, 0x37, 0x4D, 0xCE, 0x36, 0x22, 0x2A, 0x95, 0xB8, 0x66, 0x9A, 0xA1, 0xE8, 0xC2, 0x2F, 0x4B,
+    0xB9, 0x3F, 0x9E, 0x12, 0x16, 0x75, 0x9B, 0xAB, 0x9C, 0x78, 0x2F, 0xA6, 0xF9, 0xEE, 0x92, 0xE8,
+    0xF4, 0x83, 0x54, 0xAD, 0x66, 0xCF, 0x3C, 0x8C, 0x53, 0x9F, 0xBC, 0x6F, 0x13, 0xD6, 0x14, 0x6D,
+    0xDA, 0xF0, 0x2F, 0x91, 0x84, 0xD2, 0xEB, 0x7E, 0x12, 0x8C, 0xB0, 0xD3, 0x82, 0x3A, 0xA6, 0x7B,
+    0x15, 0x3A, 0xF1, 0xEB, 0x8D, 0x6B, 0x12, 0xDD, 0x86, 0xBD, 0x92, 0x53, 0x4A, 0x36, 0x46, 0x94,
+    0x9C, 0x8C, 0xCB, 0xAE, 0x90, 0x58, 0x7F, 0x76, 0xE2, 0xF8, 0xA5, 0x67, 0xAB, 0x6B, 0xFD, 0xF0,
+    0x17, 0xED, 0x05, 0x91, 0xBA, 0x74, 0xF7, 0xD8, 0xF3, 0x32, 0x4B, 0xDE, 0xB3, 0x75, 0xFC, 0xEA,
+    0xB4, 0x0F, 0xA5, 0x2E, 0xE5, 0xCC, 0x4C, 0xFB, 0xFD, 0x4E, 0x2E, 0x4B, 0xB6, 0x35, 0x52, 0xC0,
+    0x6B, 0x88, 0xDF, 0xFF, 0xBF, 0x22, 0x3B, 0x91, 0x84, 0x99, 0x13, 0x1B, 0xDE, 0x5A, 0xBC, 0x4E,
+    0x51, 0x3E, 0xCC, 0xE0, 0xB5, 0x31, 0xA2, 0x52, 0xF8, 0x42, 0x3B, 0x59, 0x49, 0x58, 0xCF, 0xE4,
+    0x4C, 0xDA, 0x20, 0xDE, 0x81, 0x5B, 0x6C, 0x95, 0x8A, 0xE2, 0x00, 0xC2, 0x2C, 0x56, 0x36, 0xF6,
+    0x08, 0xFC, 0xB7, 0x3F, 0x2E, 0x63, 0x86, 0xD1, 0x79, 0x0E, 0x6F, 0x82, 0x7D, 0x1F, 0x16, 0x6E,
+    0x11, 0x22, 0x54, 0x85, 0xCA, 0x43, 0xC2, 0x5F, 0x04, 0x71, 0xE8, 0x95, 0x8A, 0x94, 0x89, 0xFE,
+    0x0E, 0x88, 0xE4, 0xD1, 0x61, 0x41, 0x60, 0xA9, 0xF7, 0x72, 0x98, 0x9B, 0x3B, 0x7D, 0x92, 0x28,
+    0x59, 0x9B, 0xEC, 0x5E, 0xBB, 0xB1, 0x60, 0x24, 0x9D, 0xFA, 0x32, 0x1C, 0x44, 0xEF, 0xDD, 0x77,
+    0xDE, 0x44, 0x38, 0x19, 0x1F, 0x44, 0xE7, 0xEE, 0xFD, 0x14, 0x1D, 0x45, 0x9C, 0xD7, 0x78, 0xC2,
+    0xDD, 0x94, 0xBB, 0x8E, 0x0B, 0x98, 0x6E, 0xBD, 0x2A, 0x25, 0xED, 0x25, 0x1C, 0x92, 0x3B, 0x5B,
+    0x79, 0xFA, 0x8F, 0xC9, 0xEC, 0x3C, 0x1C, 0x46, 0x11, 0xD9, 0x97, 0x8B, 0x65, 0x90, 0x98, 0xCE,
+    0xB1, 0x52, 0x63, 0xA5, 0xC7, 0x32, 0x71, 0x27, 0xD7, 0x08, 0x07, 0xAC, 0x14, 0x1B, 0x89, 0x46,
+    0x5B, 0x12, 0x67, 0x43, 0xB2, 0x66, 0x67, 0xE2, 0x31, 0x6D, 0x32, 0x6B, 0x18, 0xD5, 0x3C, 0xC5,
+    0x9C, 0x4F, 0x4E, 0xA5, 0x98, 0xE1, 0x8B, 0x35, 0x77, 0xE0, 0x17, 0xB3, 0x57, 0x59, 0xEB, 0xB3,
+    0x7A, 0x5E, 0x60, 0x62, 0xB6, 0x49, 0xA1, 0x9E, 0x5D, 0x8F, 0xB7, 0x25, 0x79, 0x01, 0xBB, 0x08,
+    0xDA, 0x15, 0x46, 0xFE, 0x45, 0x01, 0x97, 0xE5, 0x4E, 0xD9, 0xA0, 0x52, 0x8F, 0xAF, 0x9C, 0x75,
+    0xCC, 0x83, 0x7B, 0x66, 0xD4, 0xBD, 0xD0, 0xEB, 0x4D, 0xEF, 0xD3, 0x67, 0xD5, 0x95, 0xA3, 0x8F,
+    0xF2, 0x07, 0xC5, 0x4D, 0xB3, 0x67, 0xCF, 0x2E, 0x41, 0x44, 0xA8, 0x22, 0x2C, 0x6F, 0x2A, 0x8B,
+    0x27, 0x6E, 0xCE, 0x6D, 0x85, 0xBA, 0x64, 0x21, 0x1F, 0x39, 0xBB, 0xE1, 0x7D, 0x20, 0xCF, 0xD0,
+    0x72, 0xAD, 0x4C, 0xA7, 0xAA, 0x14, 0x63, 0xDA, 0x93, 0x62, 0x25, 0x45, 0xB5, 0x7A, 0x86, 0xFF,
+    0xAB, 0x64, 0x6D, 0xD1, 0x34, 0x8B, 0xBD, 0x14, 0x61, 0xF3, 0x0C, 0x52, 0x67, 0x4C, 0x47, 0xF8,
+    0x69, 0xEB, 0x2C, 0x2F, 0xC1, 0x39, 0xD6, 0xFC, 0xE0, 0x8B, 0xCF, 0x4B, 0xA6, 0x04, 0xED, 0x1D,
+    0x89, 0xDA, 0x54, 0x66, 0x03, 0x28, 0x96, 0xE2, 0x75, 0xD3, 0xA9, 0xB7, 0x29, 0xF6, 0xF4, 0x86,
+    0x34, 0x29, 0xD7, 0xD2, 0xD4, 0xD6, 0x2F, 0xA5, 0x99, 0xDA, 0xAD, 0xBF, 0x4B, 0x33, 0xB5, 0x4D,
+    0x41, 0x24, 0xB3, 0xC9, 0x1D, 0x8E, 0xD1, 0x77, 0xC5, 0x50, 0x56, 0x6F, 0x59, 0x6E, 0xA8, 0x3D,
+    0xAB, 0x1A, 0xF3, 0x3B, 0xB6, 0x56, 0xB6, 0x8E, 0xAC, 0x69, 0x9E, 0xCB, 0x56, 0x3E, 0x9E, 0xB5,
+    0x42, 0x4B, 0x39, 0x1F, 0x3D, 0xE1, 0x94, 0x3F, 0xB7, 0xE6, 0x2A, 0x4F, 0x22, 0x37, 0x93, 0x35,
+    0x1A, 0xCC, 0x8E, 0x4A, 0xEC, 0x67, 0xFF, 0x0B,
+};
+
+static const uint32_t notosans_12_regularBlockOffsets[24] = {
+    0, 1269, 2349, 3671, 4458, 5338, 6284, 7069,
+    8045, 8788, 9911, 11162, 12200, 13332, 14607, 15748,
+    16942, 17914, 19027, 20058, 21144, 22327, 23473, 24744,
+};
+
+static const uint16_t notosans_12_regularDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_12_regularGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_12_regularPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 0,
 };
 
 static const EpdGlyph notosans_12_regularGlyphs[] = {
@@ -2942,839 +1751,839 @@ static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 16, 20, 18, 1, 19, 80, 1846 }, // G
     { 15, 18, 19, 2, 18, 68, 1926 }, // H
     { 7, 18, 8, 1, 18, 32, 1994 }, // I
-    { 7, 23, 7, -2, 18, 41, 2026 }, // J
-    { 14, 18, 15, 2, 18, 63, 2067 }, // K
-    { 11, 18, 13, 2, 18, 50, 2130 }, // L
-    { 19, 18, 23, 2, 18, 86, 2180 }, // M
-    { 15, 18, 19, 2, 18, 68, 2266 }, // N
-    { 17, 20, 20, 1, 19, 85, 2334 }, // O
-    { 12, 18, 15, 2, 18, 54, 2419 }, // P
-    { 17, 24, 20, 1, 19, 102, 2473 }, // Q
-    { 14, 18, 16, 2, 18, 63, 2575 }, // R
-    { 12, 20, 14, 1, 19, 60, 2638 }, // S
-    { 14, 18, 14, 0, 18, 63, 2698 }, // T
-    { 14, 19, 18, 2, 18, 67, 2761 }, // U
-    { 15, 18, 15, 0, 18, 68, 2828 }, // V
-    { 23, 18, 23, 0, 18, 104, 2896 }, // W
-    { 15, 18, 15, 0, 18, 68, 3000 }, // X
-    { 15, 18, 14, 0, 18, 68, 3068 }, // Y
-    { 14, 18, 14, 0, 18, 63, 3136 }, // Z
-    { 6, 22, 8, 2, 18, 33, 3199 }, // [
-    { 10, 18, 9, 0, 18, 45, 3232 }, // <backslash>
-    { 7, 22, 8, 0, 18, 39, 3277 }, // ]
-    { 14, 12, 14, 0, 18, 42, 3316 }, // ^
-    { 13, 2, 11, -1, -2, 7, 3358 }, // _
-    { 6, 5, 7, 1, 20, 8, 3365 }, // `
-    { 11, 15, 14, 1, 14, 42, 3373 }, // a
-    { 12, 20, 15, 2, 19, 60, 3415 }, // b
-    { 11, 15, 12, 1, 14, 42, 3475 }, // c
-    { 13, 20, 15, 1, 19, 65, 3517 }, // d
-    { 12, 15, 14, 1, 14, 45, 3582 }, // e
-    { 10, 20, 9, 0, 20, 50, 3627 }, // f
-    { 13, 20, 15, 1, 14, 65, 3677 }, // g
-    { 12, 19, 15, 2, 19, 57, 3742 }, // h
-    { 4, 19, 6, 1, 19, 19, 3799 }, // i
-    { 7, 25, 6, -2, 19, 44, 3818 }, // j
-    { 12, 19, 13, 2, 19, 57, 3862 }, // k
-    { 3, 19, 6, 2, 19, 15, 3919 }, // l
-    { 20, 14, 23, 2, 14, 70, 3934 }, // m
-    { 12, 14, 15, 2, 14, 42, 4004 }, // n
-    { 13, 15, 15, 1, 14, 49, 4046 }, // o
-    { 12, 20, 15, 2, 14, 60, 4095 }, // p
-    { 13, 20, 15, 1, 14, 65, 4155 }, // q
-    { 8, 14, 10, 2, 14, 28, 4220 }, // r
-    { 10, 15, 12, 1, 14, 38, 4248 }, // s
-    { 9, 18, 9, 0, 17, 41, 4286 }, // t
-    { 13, 15, 15, 1, 14, 49, 4327 }, // u
-    { 13, 14, 13, 0, 14, 46, 4376 }, // v
-    { 20, 14, 20, 0, 14, 70, 4422 }, // w
-    { 13, 14, 13, 0, 14, 46, 4492 }, // x
-    { 13, 20, 13, 0, 14, 65, 4538 }, // y
-    { 11, 14, 12, 0, 14, 39, 4603 }, // z
-    { 9, 22, 10, 0, 18, 50, 4642 }, // {
-    { 3, 26, 14, 5, 19, 20, 4692 }, // |
-    { 9, 22, 10, 0, 18, 50, 4712 }, // }
-    { 13, 4, 14, 1, 11, 13, 4762 }, // ~
-    { 0, 0, 7, 0, 0, 0, 4775 }, //  
-    { 4, 19, 7, 1, 14, 19, 4775 }, // ¡
-    { 11, 20, 14, 2, 19, 55, 4794 }, // ¢
-    { 14, 19, 14, 0, 19, 67, 4849 }, // £
-    { 12, 12, 14, 1, 15, 36, 4916 }, // ¤
-    { 14, 18, 14, 0, 18, 63, 4952 }, // ¥
-    { 3, 26, 14, 5, 19, 20, 5015 }, // ¦
-    { 11, 21, 13, 1, 20, 58, 5035 }, // §
-    { 8, 4, 15, 3, 19, 8, 5093 }, // ¨
-    { 19, 20, 21, 1, 19, 95, 5101 }, // ©
-    { 8, 10, 9, 0, 19, 20, 5196 }, // ª
-    { 11, 11, 13, 1, 12, 31, 5216 }, // «
-    { 12, 7, 14, 1, 10, 21, 5247 }, // ¬
-    { 7, 3, 8, 1, 8, 6, 5268 }, // ­
-    { 19, 20, 21, 1, 19, 95, 5274 }, // ®
-    { 14, 2, 13, -1, 21, 7, 5369 }, // ¯
-    { 9, 9, 11, 1, 19, 21, 5376 }, // °
-    { 13, 15, 14, 1, 15, 49, 5397 }, // ±
-    { 8, 12, 9, 0, 22, 24, 5446 }, // ²
-    { 9, 12, 9, 0, 22, 27, 5470 }, // ³
-    { 6, 5, 7, 1, 20, 8, 5497 }, // ´
-    { 12, 20, 16, 2, 14, 60, 5505 }, // µ
-    { 13, 23, 16, 1, 19, 75, 5565 }, // ¶
-    { 4, 5, 7, 1, 11, 5, 5640 }, // ·
-    { 6, 6, 6, 0, 0, 9, 5645 }, // ¸
-    { 6, 12, 9, 0, 22, 18, 5654 }, // ¹
-    { 9, 10, 9, 0, 19, 23, 5672 }, // º
-    { 12, 11, 13, 0, 12, 33, 5695 }, // »
-    { 19, 18, 19, 0, 18, 86, 5728 }, // ¼
-    { 19, 18, 19, 0, 18, 86, 5814 }, // ½
-    { 20, 19, 20, 0, 19, 95, 5900 }, // ¾
-    { 11, 19, 11, 0, 14, 53, 5995 }, // ¿
-    { 16, 24, 16, 0, 24, 96, 6048 }, // À
-    { 16, 24, 16, 0, 24, 96, 6144 }, // Á
-    { 16, 24, 16, 0, 24, 96, 6240 }, // Â
-    { 16, 23, 16, 0, 23, 92, 6336 }, // Ã
-    { 16, 23, 16, 0, 23, 92, 6428 }, // Ä
-    { 16, 23, 16, 0, 23, 92, 6520 }, // Å
-    { 22, 18, 22, -1, 18, 99, 6612 }, // Æ
-    { 15, 25, 16, 1, 19, 94, 6711 }, // Ç
-    { 11, 24, 14, 2, 24, 66, 6805 }, // È
-    { 11, 24, 14, 2, 24, 66, 6871 }, // É
-    { 11, 24, 14, 2, 24, 66, 6937 }, // Ê
-    { 11, 23, 14, 2, 23, 64, 7003 }, // Ë
-    { 7, 24, 8, 1, 24, 42, 7067 }, // Ì
-    { 7, 24, 8, 1, 24, 42, 7109 }, // Í
-    { 9, 24, 8, 0, 24, 54, 7151 }, // Î
-    { 8, 23, 8, 0, 23, 46, 7205 }, // Ï
-    { 17, 18, 18, 0, 18, 77, 7251 }, // Ð
-    { 15, 23, 19, 2, 23, 87, 7328 }, // Ñ
-    { 17, 25, 20, 1, 24, 107, 7415 }, // Ò
-    { 17, 25, 20, 1, 24, 107, 7522 }, // Ó
-    { 17, 25, 20, 1, 24, 107, 7629 }, // Ô
-    { 17, 24, 20, 1, 23, 102, 7736 }, // Õ
-    { 17, 24, 20, 1, 23, 102, 7838 }, // Ö
-    { 12, 12, 14, 1, 15, 36, 7940 }, // ×
-    { 17, 20, 20, 1, 19, 85, 7976 }, // Ø
-    { 14, 25, 18, 2, 24, 88, 8061 }, // Ù
-    { 14, 25, 18, 2, 24, 88, 8149 }, // Ú
-    { 14, 25, 18, 2, 24, 88, 8237 }, // Û
-    { 14, 24, 18, 2, 23, 84, 8325 }, // Ü
-    { 15, 24, 14, 0, 24, 90, 8409 }, // Ý
-    { 12, 18, 15, 2, 18, 54, 8499 }, // Þ
-    { 13, 21, 16, 2, 20, 69, 8553 }, // ß
-    { 11, 21, 14, 1, 20, 58, 8622 }, // à
-    { 11, 21, 14, 1, 20, 58, 8680 }, // á
-    { 11, 21, 14, 1, 20, 58, 8738 }, // â
-    { 11, 20, 14, 1, 19, 55, 8796 }, // ã
-    { 11, 20, 14, 1, 19, 55, 8851 }, // ä
-    { 11, 22, 14, 1, 21, 61, 8906 }, // å
-    { 20, 15, 22, 1, 14, 75, 8967 }, // æ
-    { 11, 20, 12, 1, 14, 55, 9042 }, // ç
-    { 12, 21, 14, 1, 20, 63, 9097 }, // è
-    { 12, 21, 14, 1, 20, 63, 9160 }, // é
-    { 12, 21, 14, 1, 20, 63, 9223 }, // ê
-    { 12, 20, 14, 1, 19, 60, 9286 }, // ë
-    { 6, 20, 6, -1, 20, 30, 9346 }, // ì
-    { 6, 20, 6, 1, 20, 30, 9376 }, // í
-    { 9, 20, 6, -1, 20, 45, 9406 }, // î
-    { 8, 19, 6, -1, 19, 38, 9451 }, // ï
-    { 13, 21, 15, 1, 20, 69, 9489 }, // ð
-    { 12, 19, 15, 2, 19, 57, 9558 }, // ñ
-    { 13, 21, 15, 1, 20, 69, 9615 }, // ò
-    { 13, 21, 15, 1, 20, 69, 9684 }, // ó
-    { 13, 21, 15, 1, 20, 69, 9753 }, // ô
-    { 13, 20, 15, 1, 19, 65, 9822 }, // õ
-    { 13, 20, 15, 1, 19, 65, 9887 }, // ö
-    { 13, 12, 14, 1, 15, 39, 9952 }, // ÷
-    { 13, 16, 15, 1, 15, 52, 9991 }, // ø
-    { 13, 21, 15, 1, 20, 69, 10043 }, // ù
-    { 13, 21, 15, 1, 20, 69, 10112 }, // ú
-    { 13, 21, 15, 1, 20, 69, 10181 }, // û
-    { 13, 20, 15, 1, 19, 65, 10250 }, // ü
-    { 13, 26, 13, 0, 20, 85, 10315 }, // ý
-    { 12, 25, 15, 2, 19, 75, 10400 }, // þ
-    { 13, 25, 13, 0, 19, 82, 10475 }, // ÿ
-    { 16, 21, 16, 0, 21, 84, 10557 }, // Ā
-    { 11, 18, 14, 1, 17, 50, 10641 }, // ā
-    { 16, 23, 16, 0, 23, 92, 10691 }, // Ă
-    { 11, 20, 14, 1, 19, 55, 10783 }, // ă
-    { 16, 24, 16, 0, 18, 96, 10838 }, // Ą
-    { 12, 20, 14, 1, 14, 60, 10934 }, // ą
-    { 15, 25, 16, 1, 24, 94, 10994 }, // Ć
-    { 11, 21, 12, 1, 20, 58, 11088 }, // ć
-    { 15, 25, 16, 1, 24, 94, 11146 }, // Ĉ
-    { 11, 21, 12, 1, 20, 58, 11240 }, // ĉ
-    { 15, 24, 16, 1, 23, 90, 11298 }, // Ċ
-    { 11, 20, 12, 1, 19, 55, 11388 }, // ċ
-    { 15, 25, 16, 1, 24, 94, 11443 }, // Č
-    { 11, 21, 12, 1, 20, 58, 11537 }, // č
-    { 15, 24, 18, 2, 24, 90, 11595 }, // Ď
-    { 17, 20, 15, 1, 19, 85, 11685 }, // ď
-    { 17, 18, 18, 0, 18, 77, 11770 }, // Đ
-    { 15, 20, 15, 1, 19, 75, 11847 }, // đ
-    { 11, 21, 14, 2, 21, 58, 11922 }, // Ē
-    { 12, 18, 14, 1, 17, 54, 11980 }, // ē
-    { 11, 23, 14, 2, 23, 64, 12034 }, // Ĕ
-    { 12, 20, 14, 1, 19, 60, 12098 }, // ĕ
-    { 11, 23, 14, 2, 23, 64, 12158 }, // Ė
-    { 12, 20, 14, 1, 19, 60, 12222 }, // ė
-    { 11, 24, 14, 2, 18, 66, 12282 }, // Ę
-    { 12, 20, 14, 1, 14, 60, 12348 }, // ę
-    { 11, 24, 14, 2, 24, 66, 12408 }, // Ě
-    { 12, 21, 14, 1, 20, 63, 12474 }, // ě
-    { 16, 25, 18, 1, 24, 100, 12537 }, // Ĝ
-    { 13, 26, 15, 1, 20, 85, 12637 }, // ĝ
-    { 16, 24, 18, 1, 23, 96, 12722 }, // Ğ
-    { 13, 25, 15, 1, 19, 82, 12818 }, // ğ
-    { 16, 24, 18, 1, 23, 96, 12900 }, // Ġ
-    { 13, 25, 15, 1, 19, 82, 12996 }, // ġ
-    { 16, 25, 18, 1, 19, 100, 13078 }, // Ģ
-    { 13, 26, 15, 1, 20, 85, 13178 }, // ģ
-    { 15, 24, 19, 2, 24, 90, 13263 }, // Ĥ
-    { 15, 26, 15, -1, 26, 98, 13353 }, // ĥ
-    { 19, 18, 19, 0, 18, 86, 13451 }, // Ħ
-    { 14, 19, 15, 0, 19, 67, 13537 }, // ħ
-    { 10, 23, 8, -1, 23, 58, 13604 }, // Ĩ
-    { 10, 19, 6, -2, 19, 48, 13662 }, // ĩ
-    { 8, 21, 8, 0, 21, 42, 13710 }, // Ī
-    { 8, 17, 6, -1, 17, 34, 13752 }, // ī
-    { 9, 23, 8, 0, 23, 52, 13786 }, // Ĭ
-    { 9, 19, 6, -1, 19, 43, 13838 }, // ĭ
-    { 7, 24, 8, 1, 18, 42, 13881 }, // Į
-    { 5, 25, 6, 0, 19, 32, 13923 }, // į
-    { 7, 23, 8, 1, 23, 41, 13955 }, // İ
-    { 3, 14, 6, 2, 14, 11, 13996 }, // ı
-    { 13, 23, 15, 1, 18, 75, 14007 }, // Ĳ
-    { 10, 25, 13, 1, 19, 63, 14082 }, // ĳ
-    { 10, 29, 7, -2, 24, 73, 14145 }, // Ĵ
-    { 10, 26, 6, -2, 20, 65, 14218 }, // ĵ
-    { 14, 24, 15, 2, 18, 84, 14283 }, // Ķ
-    { 12, 25, 13, 2, 19, 75, 14367 }, // ķ
-    { 12, 14, 13, 2, 14, 42, 14442 }, // ĸ
-    { 11, 24, 13, 2, 24, 66, 14484 }, // Ĺ
-    { 6, 26, 6, 1, 26, 39, 14550 }, // ĺ
-    { 11, 24, 13, 2, 18, 66, 14589 }, // Ļ
-    { 4, 25, 6, 1, 19, 25, 14655 }, // ļ
-    { 11, 18, 13, 2, 18, 50, 14680 }, // Ľ
-    { 7, 19, 6, 2, 19, 34, 14730 }, // ľ
-    { 11, 18, 13, 2, 18, 50, 14764 }, // Ŀ
-    { 6, 19, 7, 2, 19, 29, 14814 }, // ŀ
-    { 13, 18, 13, 0, 18, 59, 14843 }, // Ł
-    { 8, 19, 6, -1, 19, 38, 14902 }, // ł
-    { 15, 24, 19, 2, 24, 90, 14940 }, // Ń
-    { 12, 20, 15, 2, 20, 60, 15030 }, // ń
-    { 15, 24, 19, 2, 18, 90, 15090 }, // Ņ
-    { 12, 20, 15, 2, 14, 60, 15180 }, // ņ
-    { 15, 24, 19, 2, 24, 90, 15240 }, // Ň
-    { 12, 20, 15, 2, 20, 60, 15330 }, // ň
-    { 16, 18, 17, 0, 18, 72, 15390 }, // ŉ
-    { 15, 23, 19, 2, 18, 87, 15462 }, // Ŋ
-    { 12, 20, 15, 2, 14, 60, 15549 }, // ŋ
-    { 17, 22, 20, 1, 21, 94, 15609 }, // Ō
-    { 13, 18, 15, 1, 17, 59, 15703 }, // ō
-    { 17, 24, 20, 1, 23, 102, 15762 }, // Ŏ
-    { 13, 20, 15, 1, 19, 65, 15864 }, // ŏ
-    { 17, 25, 20, 1, 24, 107, 15929 }, // Ő
-    { 13, 21, 15, 1, 20, 69, 16036 }, // ő
-    { 21, 20, 23, 1, 19, 105, 16105 }, // Œ
-    { 22, 15, 24, 1, 14, 83, 16210 }, // œ
-    { 14, 24, 16, 2, 24, 84, 16293 }, // Ŕ
-    { 8, 20, 10, 2, 20, 40, 16377 }, // ŕ
-    { 14, 24, 16, 2, 18, 84, 16417 }, // Ŗ
-    { 9, 20, 10, 1, 14, 45, 16501 }, // ŗ
-    { 14, 24, 16, 2, 24, 84, 16546 }, // Ř
-    { 10, 20, 10, 1, 20, 50, 16630 }, // ř
-    { 12, 25, 14, 1, 24, 75, 16680 }, // Ś
-    { 10, 21, 12, 1, 20, 53, 16755 }, // ś
-    { 12, 25, 14, 1, 24, 75, 16808 }, // Ŝ
-    { 10, 21, 12, 1, 20, 53, 16883 }, // ŝ
-    { 12, 25, 14, 1, 19, 75, 16936 }, // Ş
-    { 10, 20, 12, 1, 14, 50, 17011 }, // ş
-    { 12, 25, 14, 1, 24, 75, 17061 }, // Š
-    { 10, 21, 12, 1, 20, 53, 17136 }, // š
-    { 14, 24, 14, 0, 18, 84, 17189 }, // Ţ
-    { 9, 23, 9, 0, 17, 52, 17273 }, // ţ
-    { 14, 24, 14, 0, 24, 84, 17325 }, // Ť
-    { 12, 20, 9, 0, 19, 60, 17409 }, // ť
-    { 14, 18, 14, 0, 18, 63, 17469 }, // Ŧ
-    { 9, 18, 9, 0, 17, 41, 17532 }, // ŧ
-    { 14, 24, 18, 2, 23, 84, 17573 }, // Ũ
-    { 13, 20, 15, 1, 19, 65, 17657 }, // ũ
-    { 14, 22, 18, 2, 21, 77, 17722 }, // Ū
-    { 13, 18, 15, 1, 17, 59, 17799 }, // ū
-    { 14, 24, 18, 2, 23, 84, 17858 }, // Ŭ
-    { 13, 20, 15, 1, 19, 65, 17942 }, // ŭ
-    { 14, 26, 18, 2, 25, 91, 18007 }, // Ů
-    { 13, 22, 15, 1, 21, 72, 18098 }, // ů
-    { 14, 25, 18, 2, 24, 88, 18170 }, // Ű
-    { 13, 21, 15, 1, 20, 69, 18258 }, // ű
-    { 14, 24, 18, 2, 18, 84, 18327 }, // Ų
-    { 13, 20, 15, 1, 14, 65, 18411 }, // ų
-    { 23, 24, 23, 0, 24, 138, 18476 }, // Ŵ
-    { 20, 20, 20, 0, 20, 100, 18614 }, // ŵ
-    { 15, 24, 14, 0, 24, 90, 18714 }, // Ŷ
-    { 13, 26, 13, 0, 20, 85, 18804 }, // ŷ
-    { 15, 23, 14, 0, 23, 87, 18889 }, // Ÿ
-    { 14, 24, 14, 0, 24, 84, 18976 }, // Ź
-    { 11, 20, 12, 0, 20, 55, 19060 }, // ź
-    { 14, 23, 14, 0, 23, 81, 19115 }, // Ż
-    { 11, 19, 12, 0, 19, 53, 19196 }, // ż
-    { 14, 24, 14, 0, 24, 84, 19249 }, // Ž
-    { 11, 20, 12, 0, 20, 55, 19333 }, // ž
-    { 8, 20, 8, 2, 20, 40, 19388 }, // ſ
-    { 6, 5, 0, -13, 20, 8, 19428 }, // ̀
-    { 6, 5, 0, -9, 20, 8, 19436 }, // ́
-    { 10, 5, 0, -5, 20, 13, 19444 }, // ̂
-    { 10, 4, 0, -13, 19, 10, 19457 }, // ̃
-    { 8, 2, 0, -4, 17, 4, 19467 }, // ̄
-    { 12, 3, 0, -6, 22, 9, 19471 }, // ̅
-    { 8, 4, 0, -4, 19, 8, 19480 }, // ̆
-    { 4, 4, 0, -2, 19, 4, 19488 }, // ̇
-    { 8, 4, 0, -4, 19, 8, 19492 }, // ̈
-    { 6, 7, 0, -10, 21, 11, 19500 }, // ̉
-    { 6, 6, 0, -3, 21, 9, 19511 }, // ̊
-    { 10, 5, 0, -4, 20, 13, 19520 }, // ̋
-    { 10, 5, 0, -5, 20, 13, 19533 }, // ̌
-    { 2, 5, 0, -1, 19, 3, 19546 }, // ̍
-    { 6, 5, 0, -3, 19, 8, 19549 }, // ̎
-    { 10, 5, 0, -13, 20, 13, 19557 }, // ̏
-    { 8, 7, 0, -4, 22, 14, 19570 }, // ̐
-    { 8, 4, 0, -4, 19, 8, 19584 }, // ̑
-    { 4, 7, 0, -2, 18, 7, 19592 }, // ̒
-    { 4, 7, 0, -2, 18, 7, 19599 }, // ̓
-    { 4, 7, 0, -2, 18, 7, 19606 }, // ̔
-    { 4, 7, 0, -2, 18, 7, 19613 }, // ̕
-    { 6, 5, 0, -3, 0, 8, 19620 }, // ̖
-    { 6, 5, 0, -3, 0, 8, 19628 }, // ̗
-    { 6, 6, 0, -3, 0, 9, 19636 }, // ̘
-    { 6, 6, 0, -3, 0, 9, 19645 }, // ̙
-    { 7, 6, 8, 0, 19, 11, 19654 }, // ̚
-    { 6, 6, 0, -3, 19, 9, 19665 }, // ̛
-    { 4, 6, 0, -2, 0, 6, 19674 }, // ̜
-    { 6, 5, 0, -3, -1, 8, 19680 }, // ̝
-    { 6, 5, 0, -3, -1, 8, 19688 }, // ̞
-    { 6, 6, 0, -3, 0, 9, 19696 }, // ̟
-    { 6, 3, 0, -3, -2, 5, 19705 }, // ̠
-    { 5, 8, 0, -5, 2, 10, 19710 }, // ̡
-    { 5, 8, 0, 0, 2, 10, 19720 }, // ̢
-    { 3, 4, 0, -9, -1, 3, 19730 }, // ̣
-    { 8, 4, 0, -4, -1, 8, 19733 }, // ̤
-    { 6, 6, 0, -3, 0, 9, 19741 }, // ̥
-    { 4, 5, 0, -2, -1, 5, 19750 }, // ̦
-    { 6, 6, 0, -3, 0, 9, 19755 }, // ̧
-    { 6, 7, 0, -3, 1, 11, 19764 }, // ̨
-    { 2, 5, 0, -1, -1, 3, 19775 }, // ̩
-    { 10, 5, 0, -5, -1, 13, 19778 }, // ̪
-    { 10, 4, 0, -5, -1, 10, 19791 }, // ̫
-    { 10, 5, 0, -5, 0, 13, 19801 }, // ̬
-    { 10, 5, 0, -5, 0, 13, 19814 }, // ̭
-    { 8, 4, 0, -4, -1, 8, 19827 }, // ̮
-    { 8, 4, 0, -4, -1, 8, 19835 }, // ̯
-    { 10, 4, 0, -5, -1, 10, 19843 }, // ̰
-    { 8, 2, 0, -4, -2, 4, 19853 }, // ̱
-    { 12, 2, 0, -6, -2, 6, 19857 }, // ̲
-    { 12, 6, 0, -6, 0, 18, 19863 }, // ̳
-    { 10, 4, 0, -5, 9, 10, 19881 }, // ̴
-    { 12, 3, 0, -6, 9, 9, 19891 }, // ̵
-    { 18, 2, 0, -9, 8, 9, 19900 }, // ̶
-    { 8, 6, 0, -4, 10, 12, 19909 }, // ̷
-    { 10, 21, 0, -5, 19, 53, 19921 }, // ̸
-    { 4, 6, 0, -2, 0, 6, 19974 }, // ̹
-    { 10, 5, 0, -5, -1, 13, 19980 }, // ̺
-    { 10, 6, 0, -5, 0, 15, 19993 }, // ̻
-    { 10, 4, 0, -5, -1, 10, 20008 }, // ̼
-    { 6, 6, 0, -3, 20, 9, 20018 }, // ̽
-    { 4, 8, 0, -2, 22, 8, 20027 }, // ̾
-    { 12, 6, 0, -6, 25, 18, 20035 }, // ̿
-    { 6, 5, 0, -4, 20, 8, 20053 }, // ̀
-    { 6, 5, 0, -1, 20, 8, 20061 }, // ́
-    { 10, 4, 0, -5, 19, 10, 20069 }, // ͂
-    { 4, 5, 0, -2, 20, 5, 20079 }, // ̓
-    { 9, 5, 0, -4, 20, 12, 20084 }, // ̈́
-    { 4, 4, 0, -1, -2, 4, 20096 }, // ͅ
-    { 12, 6, 0, -6, 20, 18, 20100 }, // ͆
-    { 12, 6, 0, -6, 0, 18, 20118 }, // ͇
-    { 6, 5, 0, -3, -1, 8, 20136 }, // ͈
-    { 6, 5, 0, -3, -1, 8, 20144 }, // ͉
-    { 10, 6, 0, -5, 20, 15, 20152 }, // ͊
-    { 10, 10, 0, -5, 24, 25, 20167 }, // ͋
-    { 10, 7, 0, -5, 22, 18, 20192 }, // ͌
-    { 10, 6, 0, -5, 0, 15, 20210 }, // ͍
-    { 6, 6, 0, -3, 0, 9, 20225 }, // ͎
-    { 18, 18, 0, -9, 18, 81, 20234 }, // ͏
-    { 5, 6, 0, -3, 20, 8, 20315 }, // ͐
-    { 4, 6, 0, -2, 21, 6, 20323 }, // ͑
-    { 8, 6, 0, -4, 21, 12, 20329 }, // ͒
-    { 6, 6, 0, -3, 0, 9, 20341 }, // ͓
-    { 5, 5, 0, -3, -1, 7, 20350 }, // ͔
-    { 5, 5, 0, -3, -1, 7, 20357 }, // ͕
-    { 10, 5, 0, -5, -1, 13, 20364 }, // ͖
-    { 4, 6, 0, -2, 21, 6, 20377 }, // ͗
-    { 3, 4, 0, 3, 19, 3, 20383 }, // ͘
-    { 6, 6, 0, -3, 0, 9, 20386 }, // ͙
-    { 10, 6, 0, -5, 0, 15, 20395 }, // ͚
-    { 6, 6, 0, -3, 20, 9, 20410 }, // ͛
-    { 20, 5, 0, -10, -1, 25, 20419 }, // ͜
-    { 20, 5, 0, -10, 19, 25, 20444 }, // ͝
-    { 16, 2, 0, -8, 17, 8, 20469 }, // ͞
-    { 16, 2, 0, -8, -2, 8, 20477 }, // ͟
-    { 20, 4, 0, -10, 19, 20, 20485 }, // ͠
-    { 20, 6, 0, -10, 22, 30, 20505 }, // ͡
-    { 21, 6, 0, -10, 0, 32, 20535 }, // ͢
-    { 6, 6, 0, -3, 21, 9, 20567 }, // ͣ
-    { 6, 6, 0, -3, 21, 9, 20576 }, // ͤ
-    { 2, 8, 0, -1, 23, 4, 20585 }, // ͥ
-    { 7, 6, 0, -3, 21, 11, 20589 }, // ͦ
-    { 6, 6, 0, -3, 21, 9, 20600 }, // ͧ
-    { 5, 6, 0, -2, 21, 8, 20609 }, // ͨ
-    { 6, 9, 0, -3, 24, 14, 20617 }, // ͩ
-    { 6, 9, 0, -3, 24, 14, 20631 }, // ͪ
-    { 10, 6, 0, -5, 21, 15, 20645 }, // ͫ
-    { 5, 6, 0, -2, 21, 8, 20660 }, // ͬ
-    { 5, 8, 0, -2, 23, 10, 20668 }, // ͭ
-    { 7, 6, 0, -3, 21, 11, 20678 }, // ͮ
-    { 7, 6, 0, -3, 21, 11, 20689 }, // ͯ
-    { 11, 24, 14, 2, 24, 66, 20700 }, // Ѐ
-    { 11, 23, 14, 2, 23, 64, 20766 }, // Ё
-    { 17, 19, 18, 0, 18, 81, 20830 }, // Ђ
-    { 11, 24, 13, 2, 24, 66, 20911 }, // Ѓ
-    { 14, 20, 16, 1, 19, 70, 20977 }, // Є
-    { 12, 20, 14, 1, 19, 60, 21047 }, // Ѕ
-    { 3, 18, 7, 2, 18, 14, 21107 }, // І
-    { 7, 23, 7, 0, 23, 41, 21121 }, // Ї
-    { 7, 23, 7, -2, 18, 41, 21162 }, // Ј
-    { 24, 19, 25, 0, 18, 114, 21203 }, // Љ
-    { 23, 18, 26, 2, 18, 104, 21317 }, // Њ
-    { 17, 18, 18, 0, 18, 77, 21421 }, // Ћ
-    { 14, 24, 16, 2, 24, 84, 21498 }, // Ќ
-    { 15, 24, 19, 2, 24, 90, 21582 }, // Ѝ
-    { 16, 24, 15, 0, 23, 96, 21672 }, // Ў
-    { 14, 22, 18, 2, 18, 77, 21768 }, // Џ
-    { 16, 18, 16, 0, 18, 72, 21845 }, // А
-    { 13, 18, 15, 2, 18, 59, 21917 }, // Б
-    { 13, 18, 16, 2, 18, 59, 21976 }, // В
-    { 11, 18, 13, 2, 18, 50, 22035 }, // Г
-    { 18, 22, 18, 0, 18, 99, 22085 }, // Д
-    { 11, 18, 14, 2, 18, 50, 22184 }, // Е
-    { 23, 18, 23, 0, 18, 104, 22234 }, // Ж
-    { 13, 20, 14, 0, 19, 65, 22338 }, // З
-    { 15, 18, 19, 2, 18, 68, 22403 }, // И
-    { 15, 23, 19, 2, 23, 87, 22471 }, // Й
-    { 14, 18, 16, 2, 18, 63, 22558 }, // К
-    { 16, 19, 17, 0, 18, 76, 22621 }, // Л
-    { 19, 18, 23, 2, 18, 86, 22697 }, // М
-    { 15, 18, 19, 2, 18, 68, 22783 }, // Н
-    { 17, 20, 19, 1, 19, 85, 22851 }, // О
-    { 14, 18, 18, 2, 18, 63, 22936 }, // П
-    { 12, 18, 15, 2, 18, 54, 22999 }, // Р
-    { 14, 20, 16, 1, 19, 70, 23053 }, // С
-    { 14, 18, 14, 0, 18, 63, 23123 }, // Т
-    { 16, 19, 15, 0, 18, 76, 23186 }, // У
-    { 19, 20, 20, 1, 19, 95, 23262 }, // Ф
-    { 15, 18, 15, 0, 18, 68, 23357 }, // Х
-    { 17, 22, 19, 2, 18, 94, 23425 }, // Ц
-    { 14, 18, 17, 1, 18, 63, 23519 }, // Ч
-    { 22, 18, 26, 2, 18, 99, 23582 }, // Ш
-    { 24, 22, 26, 2, 18, 132, 23681 }, // Щ
-    { 16, 18, 17, 0, 18, 72, 23813 }, // Ъ
-    { 17, 18, 21, 2, 18, 77, 23885 }, // Ы
-    { 12, 18, 15, 2, 18, 54, 23962 }, // Ь
-    { 14, 20, 16, 1, 19, 70, 24016 }, // Э
-    { 22, 20, 25, 2, 19, 110, 24086 }, // Ю
-    { 14, 18, 16, 0, 18, 63, 24196 }, // Я
-    { 11, 15, 14, 1, 14, 42, 24259 }, // а
-    { 13, 21, 15, 1, 20, 69, 24301 }, // б
-    { 11, 14, 14, 2, 14, 39, 24370 }, // в
-    { 9, 14, 11, 2, 14, 32, 24409 }, // г
-    { 15, 18, 15, 0, 14, 68, 24441 }, // д
-    { 12, 15, 14, 1, 14, 45, 24509 }, // е
-    { 19, 14, 19, 0, 14, 67, 24554 }, // ж
-    { 12, 15, 12, 0, 14, 45, 24621 }, // з
-    { 12, 14, 16, 2, 14, 42, 24666 }, // и
-    { 12, 19, 16, 2, 19, 57, 24708 }, // й
-    { 12, 14, 13, 2, 14, 42, 24765 }, // к
-    { 13, 15, 15, 0, 14, 49, 24807 }, // л
-    { 16, 14, 19, 2, 14, 56, 24856 }, // м
-    { 12, 14, 15, 2, 14, 42, 24912 }, // н
-    { 13, 15, 15, 1, 14, 49, 24954 }, // о
-    { 12, 14, 15, 2, 14, 42, 25003 }, // п
-    { 12, 20, 15, 2, 14, 60, 25045 }, // р
-    { 11, 15, 12, 1, 14, 42, 25105 }, // с
-    { 12, 14, 12, 0, 14, 42, 25147 }, // т
-    { 13, 20, 13, 0, 14, 65, 25189 }, // у
-    { 17, 25, 18, 1, 19, 107, 25254 }, // ф
-    { 13, 14, 13, 0, 14, 46, 25361 }, // х
-    { 14, 18, 15, 2, 14, 63, 25407 }, // ц
-    { 12, 14, 15, 1, 14, 42, 25470 }, // ч
-    { 19, 14, 22, 2, 14, 67, 25512 }, // ш
-    { 21, 18, 22, 2, 14, 95, 25579 }, // щ
-    { 15, 14, 16, 0, 14, 53, 25674 }, // ъ
-    { 15, 14, 19, 2, 14, 53, 25727 }, // ы
-    { 11, 14, 14, 2, 14, 39, 25780 }, // ь
-    { 11, 15, 12, 1, 14, 42, 25819 }, // э
-    { 17, 15, 20, 2, 14, 64, 25861 }, // ю
-    { 13, 14, 14, 0, 14, 46, 25925 }, // я
-    { 12, 21, 14, 1, 20, 63, 25971 }, // ѐ
-    { 12, 20, 14, 1, 19, 60, 26034 }, // ё
-    { 14, 25, 15, 0, 19, 88, 26094 }, // ђ
-    { 9, 20, 11, 2, 20, 45, 26182 }, // ѓ
-    { 11, 15, 12, 1, 14, 42, 26227 }, // є
-    { 10, 15, 12, 1, 14, 38, 26269 }, // ѕ
-    { 4, 19, 6, 1, 19, 19, 26307 }, // і
-    { 6, 19, 6, 0, 19, 29, 26326 }, // ї
-    { 7, 25, 6, -2, 19, 44, 26355 }, // ј
-    { 21, 15, 21, 0, 14, 79, 26399 }, // љ
-    { 20, 14, 22, 2, 14, 70, 26478 }, // њ
-    { 14, 19, 16, 0, 19, 67, 26548 }, // ћ
-    { 12, 20, 13, 2, 20, 60, 26615 }, // ќ
-    { 12, 20, 16, 2, 20, 60, 26675 }, // ѝ
-    { 13, 25, 13, 0, 19, 82, 26735 }, // ў
-    { 12, 18, 15, 2, 14, 54, 26817 }, // џ
-    { 23, 19, 23, 0, 18, 110, 26871 }, // Ѡ
-    { 20, 14, 20, 0, 14, 70, 26981 }, // ѡ
-    { 16, 18, 17, 0, 18, 72, 27051 }, // Ѣ
-    { 15, 17, 16, 0, 17, 64, 27123 }, // ѣ
-    { 21, 20, 23, 2, 19, 105, 27187 }, // Ѥ
-    { 16, 15, 19, 2, 14, 60, 27292 }, // ѥ
-    { 18, 18, 17, 0, 18, 81, 27352 }, // Ѧ
-    { 15, 14, 14, 0, 14, 53, 27433 }, // ѧ
-    { 22, 18, 23, 2, 18, 99, 27486 }, // Ѩ
-    { 18, 14, 20, 2, 14, 63, 27585 }, // ѩ
-    { 18, 18, 18, 0, 18, 81, 27648 }, // Ѫ
-    { 16, 14, 16, 0, 14, 56, 27729 }, // ѫ
-    { 23, 18, 25, 2, 18, 104, 27785 }, // Ѭ
-    { 20, 14, 21, 2, 14, 70, 27889 }, // ѭ
-    { 14, 28, 15, 0, 22, 98, 27959 }, // Ѯ
-    { 12, 22, 12, 0, 17, 66, 28057 }, // ѯ
-    { 17, 18, 20, 2, 18, 77, 28123 }, // Ѱ
-    { 16, 25, 19, 1, 19, 100, 28200 }, // ѱ
-    { 17, 20, 20, 1, 19, 85, 28300 }, // Ѳ
-    { 13, 15, 15, 1, 14, 49, 28385 }, // ѳ
-    { 17, 18, 16, 0, 18, 77, 28434 }, // Ѵ
-    { 14, 14, 13, 0, 14, 49, 28511 }, // ѵ
-    { 17, 24, 16, 0, 24, 102, 28560 }, // Ѷ
-    { 14, 20, 13, 0, 20, 70, 28662 }, // ѷ
-    { 30, 25, 31, 1, 19, 188, 28732 }, // Ѹ
-    { 27, 20, 27, 1, 14, 135, 28920 }, // ѹ
-    { 18, 22, 21, 1, 20, 99, 29055 }, // Ѻ
-    { 15, 17, 16, 1, 15, 64, 29154 }, // ѻ
-    { 24, 27, 26, 1, 26, 162, 29218 }, // Ѽ
-    { 21, 24, 23, 1, 23, 126, 29380 }, // ѽ
-    { 23, 24, 23, 0, 23, 138, 29506 }, // Ѿ
-    { 20, 18, 20, 0, 18, 90, 29644 }, // ѿ
-    { 15, 25, 16, 1, 19, 94, 29734 }, // Ҁ
-    { 11, 20, 12, 1, 14, 55, 29828 }, // ҁ
-    { 13, 17, 15, 1, 16, 56, 29883 }, // ҂
-    { 10, 4, 0, -12, 18, 10, 29939 }, // ҃
-    { 10, 4, 0, -12, 19, 10, 29949 }, // ҄
-    { 4, 5, 0, -9, 20, 5, 29959 }, // ҅
-    { 4, 5, 0, -9, 20, 5, 29964 }, // ҆
-    { 10, 4, 0, -5, 23, 10, 29969 }, // ҇
-    { 30, 27, 0, -15, 20, 203, 29979 }, // ҈
-    { 28, 28, 0, -14, 21, 196, 30182 }, // ҉
-    { 18, 29, 20, 2, 24, 131, 30378 }, // Ҋ
-    { 15, 24, 16, 2, 19, 90, 30509 }, // ҋ
-    { 15, 18, 15, 0, 18, 68, 30599 }, // Ҍ
-    { 14, 19, 15, 0, 19, 67, 30667 }, // ҍ
-    { 13, 18, 15, 2, 18, 59, 30734 }, // Ҏ
-    { 12, 20, 15, 2, 14, 60, 30793 }, // ҏ
-    { 11, 22, 13, 2, 22, 61, 30853 }, // Ґ
-    { 9, 18, 11, 2, 18, 41, 30914 }, // ґ
-    { 13, 18, 13, 0, 18, 59, 30955 }, // Ғ
-    { 11, 14, 11, 0, 14, 39, 31014 }, // ғ
-    { 14, 25, 16, 2, 18, 88, 31053 }, // Ҕ
-    { 11, 21, 13, 2, 14, 58, 31141 }, // ҕ
-    { 23, 23, 23, 0, 18, 133, 31199 }, // Җ
-    { 20, 19, 20, 0, 14, 95, 31332 }, // җ
-    { 13, 25, 14, 0, 19, 82, 31427 }, // Ҙ
-    { 12, 20, 12, 0, 14, 60, 31509 }, // ҙ
-    { 15, 23, 17, 2, 18, 87, 31569 }, // Қ
-    { 12, 19, 14, 2, 14, 57, 31656 }, // қ
-    { 14, 18, 16, 2, 18, 63, 31713 }, // Ҝ
-    { 11, 14, 13, 2, 14, 39, 31776 }, // ҝ
-    { 16, 18, 16, 0, 18, 72, 31815 }, // Ҟ
-    { 13, 19, 13, 0, 19, 62, 31887 }, // ҟ
-    { 18, 18, 17, 0, 18, 81, 31949 }, // Ҡ
-    { 16, 14, 16, 0, 14, 56, 32030 }, // ҡ
-    { 17, 23, 19, 2, 18, 98, 32086 }, // Ң
-    { 14, 19, 16, 2, 14, 67, 32184 }, // ң
-    { 19, 18, 20, 2, 18, 86, 32251 }, // Ҥ
-    { 17, 14, 18, 2, 14, 60, 32337 }, // ҥ
-    { 24, 25, 26, 2, 18, 150, 32397 }, // Ҧ
-    { 19, 21, 22, 2, 14, 100, 32547 }, // ҧ
-    { 18, 21, 19, 1, 19, 95, 32647 }, // Ҩ
-    { 15, 15, 16, 1, 14, 57, 32742 }, // ҩ
-    { 15, 25, 16, 1, 19, 94, 32799 }, // Ҫ
-    { 11, 20, 12, 1, 14, 55, 32893 }, // ҫ
-    { 14, 23, 14, 0, 18, 81, 32948 }, // Ҭ
-    { 12, 19, 12, 0, 14, 57, 33029 }, // ҭ
-    { 15, 18, 14, 0, 18, 68, 33086 }, // Ү
-    { 13, 20, 13, 0, 14, 65, 33154 }, // ү
-    { 15, 18, 14, 0, 18, 68, 33219 }, // Ұ
-    { 13, 20, 13, 0, 14, 65, 33287 }, // ұ
-    { 16, 23, 16, 0, 18, 92, 33352 }, // Ҳ
-    { 14, 19, 14, 0, 14, 67, 33444 }, // ҳ
-    { 21, 23, 22, 0, 18, 121, 33511 }, // Ҵ
-    { 18, 19, 18, 0, 14, 86, 33632 }, // ҵ
-    { 16, 23, 18, 2, 18, 92, 33718 }, // Ҷ
-    { 15, 19, 16, 1, 14, 72, 33810 }, // ҷ
-    { 14, 18, 17, 2, 18, 63, 33882 }, // Ҹ
-    { 12, 14, 15, 1, 14, 42, 33945 }, // ҹ
-    { 14, 18, 17, 2, 18, 63, 33987 }, // Һ
-    { 12, 19, 15, 2, 19, 57, 34050 }, // һ
-    { 20, 20, 21, 0, 19, 100, 34107 }, // Ҽ
-    { 16, 15, 17, 0, 14, 60, 34207 }, // ҽ
-    { 20, 24, 21, 0, 19, 120, 34267 }, // Ҿ
-    { 16, 19, 17, 0, 14, 76, 34387 }, // ҿ
-    { 7, 18, 8, 1, 18, 32, 34463 }, // Ӏ
-    { 23, 23, 23, 0, 23, 133, 34495 }, // Ӂ
-    { 19, 19, 19, 0, 19, 91, 34628 }, // ӂ
-    { 15, 25, 17, 2, 18, 94, 34719 }, // Ӄ
-    { 12, 21, 14, 2, 14, 63, 34813 }, // ӄ
-    { 18, 23, 18, 0, 18, 104, 34876 }, // Ӆ
-    { 15, 19, 15, 0, 14, 72, 34980 }, // ӆ
-    { 15, 25, 18, 2, 18, 94, 35052 }, // Ӈ
-    { 12, 21, 16, 2, 14, 63, 35146 }, // ӈ
-    { 17, 23, 19, 2, 18, 98, 35209 }, // Ӊ
-    { 15, 19, 17, 2, 14, 72, 35307 }, // ӊ
-    { 14, 23, 17, 2, 18, 81, 35379 }, // Ӌ
-    { 13, 19, 15, 1, 14, 62, 35460 }, // ӌ
-    { 21, 23, 23, 2, 18, 121, 35522 }, // Ӎ
-    { 17, 19, 19, 2, 14, 81, 35643 }, // ӎ
-    { 7, 18, 8, 1, 18, 32, 35724 }, // ӏ
-    { 16, 23, 16, 0, 23, 92, 35756 }, // Ӑ
-    { 11, 20, 14, 1, 19, 55, 35848 }, // ӑ
-    { 16, 23, 16, 0, 23, 92, 35903 }, // Ӓ
-    { 11, 20, 14, 1, 19, 55, 35995 }, // ӓ
-    { 22, 18, 22, -1, 18, 99, 36050 }, // Ӕ
-    { 20, 15, 22, 1, 14, 75, 36149 }, // ӕ
-    { 11, 23, 14, 2, 23, 64, 36224 }, // Ӗ
-    { 12, 20, 14, 1, 19, 60, 36288 }, // ӗ
-    { 16, 20, 18, 1, 19, 80, 36348 }, // Ә
-    { 12, 15, 14, 1, 14, 45, 36428 }, // ә
-    { 16, 24, 18, 1, 23, 96, 36473 }, // Ӛ
-    { 12, 20, 14, 1, 19, 60, 36569 }, // ӛ
-    { 23, 23, 23, 0, 23, 133, 36629 }, // Ӝ
-    { 19, 19, 19, 0, 19, 91, 36762 }, // ӝ
-    { 13, 24, 14, 0, 23, 78, 36853 }, // Ӟ
-    { 12, 20, 12, 0, 19, 60, 36931 }, // ӟ
-    { 14, 19, 15, 0, 18, 67, 36991 }, // Ӡ
-    { 12, 20, 12, 0, 14, 60, 37058 }, // ӡ
-    { 15, 21, 19, 2, 21, 79, 37118 }, // Ӣ
-    { 12, 17, 16, 2, 17, 51, 37197 }, // ӣ
-    { 15, 23, 19, 2, 23, 87, 37248 }, // Ӥ
-    { 12, 19, 16, 2, 19, 57, 37335 }, // ӥ
-    { 17, 24, 20, 1, 23, 102, 37392 }, // Ӧ
-    { 13, 20, 15, 1, 19, 65, 37494 }, // ӧ
-    { 17, 20, 20, 1, 19, 85, 37559 }, // Ө
-    { 13, 15, 15, 1, 14, 49, 37644 }, // ө
-    { 17, 24, 20, 1, 23, 102, 37693 }, // Ӫ
-    { 13, 20, 15, 1, 19, 65, 37795 }, // ӫ
-    { 14, 24, 16, 1, 23, 84, 37860 }, // Ӭ
-    { 11, 20, 12, 1, 19, 55, 37944 }, // ӭ
-    { 16, 22, 15, 0, 21, 88, 37999 }, // Ӯ
-    { 13, 23, 13, 0, 17, 75, 38087 }, // ӯ
-    { 16, 24, 15, 0, 23, 96, 38162 }, // Ӱ
-    { 13, 25, 13, 0, 19, 82, 38258 }, // ӱ
-    { 16, 25, 15, 0, 24, 100, 38340 }, // Ӳ
-    { 13, 26, 13, 0, 20, 85, 38440 }, // ӳ
-    { 14, 23, 17, 1, 23, 81, 38525 }, // Ӵ
-    { 12, 19, 15, 1, 19, 57, 38606 }, // ӵ
-    { 11, 23, 13, 2, 18, 64, 38663 }, // Ӷ
-    { 9, 19, 11, 2, 14, 43, 38727 }, // ӷ
-    { 17, 23, 21, 2, 23, 98, 38770 }, // Ӹ
-    { 15, 19, 19, 2, 19, 72, 38868 }, // ӹ
-    { 13, 23, 13, 0, 18, 75, 38940 }, // Ӻ
-    { 11, 19, 11, 0, 14, 53, 39015 }, // ӻ
-    { 16, 23, 16, 0, 18, 92, 39068 }, // Ӽ
-    { 14, 19, 14, 0, 14, 67, 39160 }, // ӽ
-    { 15, 18, 15, 0, 18, 68, 39227 }, // Ӿ
-    { 13, 14, 13, 0, 14, 46, 39295 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 39341 }, //  
-    { 0, 0, 25, 0, 0, 0, 39341 }, //  
-    { 0, 0, 13, 0, 0, 0, 39341 }, //  
-    { 0, 0, 25, 0, 0, 0, 39341 }, //  
-    { 0, 0, 8, 0, 0, 0, 39341 }, //  
-    { 0, 0, 6, 0, 0, 0, 39341 }, //  
-    { 0, 0, 4, 0, 0, 0, 39341 }, //  
-    { 0, 0, 14, 0, 0, 0, 39341 }, //  
-    { 0, 0, 7, 0, 0, 0, 39341 }, //  
-    { 0, 0, 4, 0, 0, 0, 39341 }, //  
-    { 0, 0, 3, 0, 0, 0, 39341 }, //  
-    { 0, 0, 0, 0, 0, 0, 39341 }, // ​
-    { 0, 0, 0, 0, 0, 0, 39341 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 39341 }, // ‍
-    { 7, 22, 0, -1, 18, 39, 39341 }, // ‎
-    { 7, 22, 0, -6, 18, 39, 39380 }, // ‏
-    { 7, 3, 8, 1, 8, 6, 39419 }, // ‐
-    { 7, 3, 8, 1, 8, 6, 39425 }, // ‑
-    { 13, 2, 14, 1, 10, 7, 39431 }, // ‒
-    { 11, 3, 13, 1, 8, 9, 39438 }, // –
-    { 23, 3, 25, 1, 8, 18, 39447 }, // —
-    { 23, 3, 25, 1, 8, 18, 39465 }, // ―
-    { 8, 26, 14, 3, 19, 52, 39483 }, // ‖
-    { 12, 6, 10, -1, 0, 18, 39535 }, // ‗
-    { 5, 7, 4, 0, 18, 9, 39553 }, // ‘
-    { 5, 7, 4, 0, 18, 9, 39562 }, // ’
-    { 5, 7, 6, 0, 3, 9, 39571 }, // ‚
-    { 5, 7, 4, 0, 18, 9, 39580 }, // ‛
-    { 9, 7, 9, 0, 18, 16, 39589 }, // “
-    { 9, 7, 9, 0, 18, 16, 39605 }, // ”
-    { 10, 7, 10, 0, 3, 18, 39621 }, // „
-    { 9, 7, 9, 0, 18, 16, 39639 }, // ‟
-    { 11, 19, 13, 1, 19, 53, 39655 }, // †
-    { 11, 19, 13, 1, 19, 53, 39708 }, // ‡
-    { 7, 7, 9, 1, 13, 13, 39761 }, // •
-    { 8, 8, 9, 1, 13, 16, 39774 }, // ‣
-    { 4, 5, 13, 4, 4, 5, 39790 }, // ․
-    { 11, 5, 13, 1, 4, 14, 39795 }, // ‥
-    { 17, 5, 20, 1, 4, 22, 39809 }, // …
-    { 4, 5, 7, 1, 9, 5, 39831 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 39836 }, //  
-    { 0, 0, 15, 0, 0, 0, 39836 }, //  
-    { 7, 20, 0, -1, 16, 35, 39836 }, // ‪
-    { 7, 20, 0, -6, 16, 35, 39871 }, // ‫
-    { 6, 22, 0, -3, 18, 33, 39906 }, // ‬
-    { 6, 22, 0, -3, 18, 33, 39939 }, // ‭
-    { 6, 22, 0, -3, 18, 33, 39972 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 40005 }, //  
-    { 28, 20, 29, 1, 19, 140, 40005 }, // ‰
-    { 37, 20, 39, 1, 19, 185, 40145 }, // ‱
-    { 7, 7, 6, 0, 18, 13, 40330 }, // ′
-    { 11, 7, 10, 0, 18, 20, 40343 }, // ″
-    { 16, 7, 15, 0, 18, 28, 40363 }, // ‴
-    { 6, 7, 6, -1, 18, 11, 40391 }, // ‵
-    { 10, 7, 11, -1, 18, 18, 40402 }, // ‶
-    { 14, 7, 15, -1, 18, 25, 40420 }, // ‷
-    { 10, 9, 10, 0, 3, 23, 40445 }, // ‸
-    { 6, 11, 8, 1, 12, 17, 40468 }, // ‹
-    { 7, 11, 8, 0, 12, 20, 40485 }, // ›
-    { 19, 20, 21, 1, 19, 95, 40505 }, // ※
-    { 10, 19, 12, 1, 18, 48, 40600 }, // ‼
-    { 11, 20, 11, 0, 19, 55, 40648 }, // ‽
-    { 14, 2, 13, -1, 21, 7, 40703 }, // ‾
-    { 15, 6, 15, 0, 0, 23, 40710 }, // ‿
-    { 15, 6, 15, 0, 20, 23, 40733 }, // ⁀
-    { 9, 17, 9, 0, 11, 39, 40756 }, // ⁁
-    { 28, 23, 28, 0, 19, 161, 40795 }, // ⁂
-    { 7, 3, 8, 1, 8, 6, 40956 }, // ⁃
-    { 13, 18, 3, -5, 18, 59, 40962 }, // ⁄
-    { 7, 22, 8, 1, 18, 39, 41021 }, // ⁅
-    { 7, 22, 8, 0, 18, 39, 41060 }, // ⁆
-    { 21, 20, 21, 0, 19, 105, 41099 }, // ⁇
-    { 16, 20, 17, 0, 19, 80, 41204 }, // ⁈
-    { 16, 20, 17, 1, 19, 80, 41284 }, // ⁉
-    { 13, 14, 14, 0, 14, 46, 41364 }, // ⁊
-    { 13, 23, 16, 2, 19, 75, 41410 }, // ⁋
-    { 13, 14, 16, 1, 14, 46, 41485 }, // ⁌
-    { 13, 14, 16, 2, 14, 46, 41531 }, // ⁍
-    { 12, 12, 14, 1, 6, 36, 41577 }, // ⁎
-    { 5, 18, 6, 1, 14, 23, 41613 }, // ⁏
-    { 15, 26, 15, 0, 20, 98, 41636 }, // ⁐
-    { 12, 25, 14, 1, 19, 75, 41734 }, // ⁑
-    { 10, 20, 9, 0, 19, 50, 41809 }, // ⁒
-    { 23, 5, 25, 1, 10, 29, 41859 }, // ⁓
-    { 15, 6, 15, 0, 0, 23, 41888 }, // ⁔
-    { 14, 14, 14, 0, 13, 49, 41911 }, // ⁕
-    { 11, 20, 13, 1, 19, 55, 41960 }, // ⁖
-    { 20, 7, 19, 0, 18, 35, 42015 }, // ⁗
-    { 19, 20, 21, 1, 19, 95, 42050 }, // ⁘
-    { 19, 20, 21, 1, 19, 95, 42145 }, // ⁙
-    { 4, 20, 6, 1, 19, 20, 42240 }, // ⁚
-    { 15, 20, 16, 1, 19, 75, 42260 }, // ⁛
-    { 19, 20, 20, 0, 19, 95, 42335 }, // ⁜
-    { 4, 19, 7, 1, 18, 19, 42430 }, // ⁝
-    { 4, 20, 7, 1, 19, 20, 42449 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 42469 }, //  
-    { 0, 0, 15, 0, 0, 0, 42469 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 42469 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 42469 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 42469 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 42469 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 42469 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 42469 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 42469 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 42469 }, // ⁩
-    { 6, 22, 0, -3, 18, 33, 42469 }, // ⁪
-    { 6, 22, 0, -3, 18, 33, 42502 }, // ⁫
-    { 6, 22, 0, -3, 18, 33, 42535 }, // ⁬
-    { 6, 22, 0, -3, 18, 33, 42568 }, // ⁭
-    { 6, 22, 0, -3, 18, 33, 42601 }, // ⁮
-    { 6, 22, 0, -3, 18, 33, 42634 }, // ⁯
-    { 9, 12, 9, 0, 22, 27, 42667 }, // ⁰
-    { 2, 12, 4, 1, 19, 6, 42694 }, // ⁱ
-    { 9, 12, 9, 0, 22, 27, 42700 }, // ⁴
-    { 8, 12, 9, 0, 22, 24, 42727 }, // ⁵
-    { 9, 12, 9, 0, 22, 27, 42751 }, // ⁶
-    { 9, 12, 9, 0, 22, 27, 42778 }, // ⁷
-    { 9, 12, 9, 0, 22, 27, 42805 }, // ⁸
-    { 9, 12, 9, 0, 22, 27, 42832 }, // ⁹
-    { 8, 8, 8, 0, 19, 16, 42859 }, // ⁺
-    { 8, 2, 8, 0, 16, 4, 42875 }, // ⁻
-    { 8, 5, 8, 0, 17, 10, 42879 }, // ⁼
-    { 5, 14, 6, 1, 23, 18, 42889 }, // ⁽
-    { 5, 14, 6, 0, 23, 18, 42907 }, // ⁾
-    { 8, 9, 10, 1, 16, 18, 42925 }, // ⁿ
-    { 9, 12, 9, 0, 8, 27, 42943 }, // ₀
-    { 6, 12, 9, 0, 8, 18, 42970 }, // ₁
-    { 8, 12, 9, 0, 8, 24, 42988 }, // ₂
-    { 9, 12, 9, 0, 8, 27, 43012 }, // ₃
-    { 9, 12, 9, 0, 8, 27, 43039 }, // ₄
-    { 8, 12, 9, 0, 8, 24, 43066 }, // ₅
-    { 9, 12, 9, 0, 8, 27, 43090 }, // ₆
-    { 9, 12, 9, 0, 8, 27, 43117 }, // ₇
-    { 9, 12, 9, 0, 8, 27, 43144 }, // ₈
-    { 9, 12, 9, 0, 8, 27, 43171 }, // ₉
-    { 8, 8, 8, 0, 6, 16, 43198 }, // ₊
-    { 8, 2, 8, 0, 3, 4, 43214 }, // ₋
-    { 8, 5, 8, 0, 4, 10, 43218 }, // ₌
-    { 5, 14, 6, 1, 9, 18, 43228 }, // ₍
-    { 5, 14, 6, 0, 9, 18, 43246 }, // ₎
-    { 8, 9, 9, 0, 6, 18, 43264 }, // ₐ
-    { 9, 9, 9, 0, 6, 21, 43282 }, // ₑ
-    { 9, 9, 10, 0, 6, 21, 43303 }, // ₒ
-    { 9, 9, 9, 0, 6, 21, 43324 }, // ₓ
-    { 9, 9, 9, 0, 6, 21, 43345 }, // ₔ
-    { 8, 12, 10, 1, 9, 24, 43366 }, // ₕ
-    { 8, 12, 9, 1, 9, 24, 43390 }, // ₖ
-    { 2, 12, 4, 1, 9, 6, 43414 }, // ₗ
-    { 13, 9, 15, 1, 6, 30, 43420 }, // ₘ
-    { 8, 9, 10, 1, 6, 18, 43450 }, // ₙ
-    { 9, 12, 10, 1, 6, 27, 43468 }, // ₚ
-    { 8, 9, 8, 0, 6, 18, 43495 }, // ₛ
-    { 6, 11, 6, 0, 8, 17, 43513 }, // ₜ
-    { 14, 19, 14, 0, 19, 67, 43530 }, // ₠
-    { 13, 21, 14, 1, 19, 69, 43597 }, // ₡
-    { 13, 20, 14, 1, 19, 65, 43666 }, // ₢
-    { 12, 18, 14, 1, 18, 54, 43731 }, // ₣
-    { 14, 19, 14, 0, 19, 67, 43785 }, // ₤
-    { 20, 20, 23, 2, 17, 100, 43852 }, // ₥
-    { 15, 18, 14, 0, 18, 68, 43952 }, // ₦
-    { 18, 19, 19, 1, 18, 86, 44020 }, // ₧
-    { 18, 19, 21, 2, 18, 86, 44106 }, // ₨
-    { 17, 18, 17, 0, 18, 77, 44192 }, // ₩
-    { 16, 18, 20, 2, 18, 72, 44269 }, // ₪
-    { 15, 23, 15, 1, 19, 87, 44341 }, // ₫
-    { 14, 20, 14, 0, 19, 70, 44428 }, // €
-    { 15, 18, 14, 0, 18, 68, 44498 }, // ₭
-    { 14, 18, 14, 0, 18, 63, 44566 }, // ₮
-    { 24, 25, 24, 0, 19, 150, 44629 }, // ₯
-    { 13, 25, 14, 0, 19, 82, 44779 }, // ₰
-    { 15, 18, 14, 0, 18, 68, 44861 }, // ₱
-    { 16, 21, 18, 1, 19, 84, 44929 }, // ₲
-    { 16, 18, 15, 0, 18, 72, 45013 }, // ₳
-    { 14, 20, 14, 0, 19, 70, 45085 }, // ₴
-    { 15, 21, 16, 1, 19, 79, 45155 }, // ₵
-    { 15, 18, 16, 0, 17, 68, 45234 }, // ₶
-    { 17, 21, 18, 0, 19, 90, 45302 }, // ₷
-    { 14, 18, 14, 0, 18, 63, 45392 }, // ₸
-    { 12, 18, 14, 1, 18, 54, 45455 }, // ₹
-    { 14, 19, 14, 0, 18, 67, 45509 }, // ₺
-    { 20, 20, 20, 0, 19, 100, 45576 }, // ₻
-    { 18, 18, 20, 1, 18, 81, 45676 }, // ₼
-    { 14, 18, 15, 0, 18, 63, 45757 }, // ₽
-    { 17, 20, 19, 1, 20, 85, 45820 }, // ₾
-    { 12, 24, 14, 2, 21, 72, 45905 }, // ₿
-    { 10, 18, 12, 1, 14, 45, 45977 }, // ⃀
-    { 12, 3, 14, 1, 10, 9, 46022 }, // −
-    { 23, 23, 25, 1, 19, 133, 46031 }, // �
+    { 7, 23, 7, -2, 18, 41, 2048 }, // J
+    { 14, 18, 15, 2, 18, 63, 2089 }, // K
+    { 11, 18, 13, 2, 18, 50, 2152 }, // L
+    { 19, 18, 23, 2, 18, 86, 2202 }, // M
+    { 15, 18, 19, 2, 18, 68, 2288 }, // N
+    { 17, 20, 20, 1, 19, 85, 2356 }, // O
+    { 12, 18, 15, 2, 18, 54, 2441 }, // P
+    { 17, 24, 20, 1, 19, 102, 2495 }, // Q
+    { 14, 18, 16, 2, 18, 63, 2597 }, // R
+    { 12, 20, 14, 1, 19, 60, 2660 }, // S
+    { 14, 18, 14, 0, 18, 63, 2720 }, // T
+    { 14, 19, 18, 2, 18, 67, 2783 }, // U
+    { 15, 18, 15, 0, 18, 68, 2850 }, // V
+    { 23, 18, 23, 0, 18, 104, 2918 }, // W
+    { 15, 18, 15, 0, 18, 68, 3022 }, // X
+    { 15, 18, 14, 0, 18, 68, 3090 }, // Y
+    { 14, 18, 14, 0, 18, 63, 3158 }, // Z
+    { 6, 22, 8, 2, 18, 33, 3221 }, // [
+    { 10, 18, 9, 0, 18, 45, 3254 }, // <backslash>
+    { 7, 22, 8, 0, 18, 39, 3299 }, // ]
+    { 14, 12, 14, 0, 18, 42, 3338 }, // ^
+    { 13, 2, 11, -1, -2, 7, 3380 }, // _
+    { 6, 5, 7, 1, 20, 8, 3387 }, // `
+    { 11, 15, 14, 1, 14, 42, 3395 }, // a
+    { 12, 20, 15, 2, 19, 60, 3437 }, // b
+    { 11, 15, 12, 1, 14, 42, 3497 }, // c
+    { 13, 20, 15, 1, 19, 65, 3539 }, // d
+    { 12, 15, 14, 1, 14, 45, 3604 }, // e
+    { 10, 20, 9, 0, 20, 50, 3649 }, // f
+    { 13, 20, 15, 1, 14, 65, 3699 }, // g
+    { 12, 19, 15, 2, 19, 57, 3764 }, // h
+    { 4, 19, 6, 1, 19, 19, 3821 }, // i
+    { 7, 25, 6, -2, 19, 44, 3840 }, // j
+    { 12, 19, 13, 2, 19, 57, 3884 }, // k
+    { 3, 19, 6, 2, 19, 15, 3941 }, // l
+    { 20, 14, 23, 2, 14, 70, 3956 }, // m
+    { 12, 14, 15, 2, 14, 42, 4026 }, // n
+    { 13, 15, 15, 1, 14, 49, 4096 }, // o
+    { 12, 20, 15, 2, 14, 60, 4145 }, // p
+    { 13, 20, 15, 1, 14, 65, 4205 }, // q
+    { 8, 14, 10, 2, 14, 28, 4270 }, // r
+    { 10, 15, 12, 1, 14, 38, 4298 }, // s
+    { 9, 18, 9, 0, 17, 41, 4336 }, // t
+    { 13, 15, 15, 1, 14, 49, 4377 }, // u
+    { 13, 14, 13, 0, 14, 46, 4426 }, // v
+    { 20, 14, 20, 0, 14, 70, 4472 }, // w
+    { 13, 14, 13, 0, 14, 46, 4542 }, // x
+    { 13, 20, 13, 0, 14, 65, 4588 }, // y
+    { 11, 14, 12, 0, 14, 39, 4653 }, // z
+    { 9, 22, 10, 0, 18, 50, 4692 }, // {
+    { 3, 26, 14, 5, 19, 20, 4742 }, // |
+    { 9, 22, 10, 0, 18, 50, 4762 }, // }
+    { 13, 4, 14, 1, 11, 13, 4812 }, // ~
+    { 0, 0, 7, 0, 0, 0, 4825 }, //  
+    { 4, 19, 7, 1, 14, 19, 4825 }, // ¡
+    { 11, 20, 14, 2, 19, 55, 4844 }, // ¢
+    { 14, 19, 14, 0, 19, 67, 4899 }, // £
+    { 12, 12, 14, 1, 15, 36, 4966 }, // ¤
+    { 14, 18, 14, 0, 18, 63, 5002 }, // ¥
+    { 3, 26, 14, 5, 19, 20, 5065 }, // ¦
+    { 11, 21, 13, 1, 20, 58, 5085 }, // §
+    { 8, 4, 15, 3, 19, 8, 5143 }, // ¨
+    { 19, 20, 21, 1, 19, 95, 5151 }, // ©
+    { 8, 10, 9, 0, 19, 20, 5246 }, // ª
+    { 11, 11, 13, 1, 12, 31, 5266 }, // «
+    { 12, 7, 14, 1, 10, 21, 5297 }, // ¬
+    { 7, 3, 8, 1, 8, 6, 5318 }, // ­
+    { 19, 20, 21, 1, 19, 95, 5324 }, // ®
+    { 14, 2, 13, -1, 21, 7, 5419 }, // ¯
+    { 9, 9, 11, 1, 19, 21, 5426 }, // °
+    { 13, 15, 14, 1, 15, 49, 5447 }, // ±
+    { 8, 12, 9, 0, 22, 24, 5496 }, // ²
+    { 9, 12, 9, 0, 22, 27, 5520 }, // ³
+    { 6, 5, 7, 1, 20, 8, 5547 }, // ´
+    { 12, 20, 16, 2, 14, 60, 5555 }, // µ
+    { 13, 23, 16, 1, 19, 75, 5615 }, // ¶
+    { 4, 5, 7, 1, 11, 5, 5690 }, // ·
+    { 6, 6, 6, 0, 0, 9, 5695 }, // ¸
+    { 6, 12, 9, 0, 22, 18, 5704 }, // ¹
+    { 9, 10, 9, 0, 19, 23, 5722 }, // º
+    { 12, 11, 13, 0, 12, 33, 5745 }, // »
+    { 19, 18, 19, 0, 18, 86, 5778 }, // ¼
+    { 19, 18, 19, 0, 18, 86, 5864 }, // ½
+    { 20, 19, 20, 0, 19, 95, 5950 }, // ¾
+    { 11, 19, 11, 0, 14, 53, 6045 }, // ¿
+    { 16, 24, 16, 0, 24, 96, 6144 }, // À
+    { 16, 24, 16, 0, 24, 96, 6240 }, // Á
+    { 16, 24, 16, 0, 24, 96, 6336 }, // Â
+    { 16, 23, 16, 0, 23, 92, 6432 }, // Ã
+    { 16, 23, 16, 0, 23, 92, 6524 }, // Ä
+    { 16, 23, 16, 0, 23, 92, 6616 }, // Å
+    { 22, 18, 22, -1, 18, 99, 6708 }, // Æ
+    { 15, 25, 16, 1, 19, 94, 6807 }, // Ç
+    { 11, 24, 14, 2, 24, 66, 6901 }, // È
+    { 11, 24, 14, 2, 24, 66, 6967 }, // É
+    { 11, 24, 14, 2, 24, 66, 7033 }, // Ê
+    { 11, 23, 14, 2, 23, 64, 7099 }, // Ë
+    { 7, 24, 8, 1, 24, 42, 7163 }, // Ì
+    { 7, 24, 8, 1, 24, 42, 7205 }, // Í
+    { 9, 24, 8, 0, 24, 54, 7247 }, // Î
+    { 8, 23, 8, 0, 23, 46, 7301 }, // Ï
+    { 17, 18, 18, 0, 18, 77, 7347 }, // Ð
+    { 15, 23, 19, 2, 23, 87, 7424 }, // Ñ
+    { 17, 25, 20, 1, 24, 107, 7511 }, // Ò
+    { 17, 25, 20, 1, 24, 107, 7618 }, // Ó
+    { 17, 25, 20, 1, 24, 107, 7725 }, // Ô
+    { 17, 24, 20, 1, 23, 102, 7832 }, // Õ
+    { 17, 24, 20, 1, 23, 102, 7934 }, // Ö
+    { 12, 12, 14, 1, 15, 36, 8036 }, // ×
+    { 17, 20, 20, 1, 19, 85, 8072 }, // Ø
+    { 14, 25, 18, 2, 24, 88, 8192 }, // Ù
+    { 14, 25, 18, 2, 24, 88, 8280 }, // Ú
+    { 14, 25, 18, 2, 24, 88, 8368 }, // Û
+    { 14, 24, 18, 2, 23, 84, 8456 }, // Ü
+    { 15, 24, 14, 0, 24, 90, 8540 }, // Ý
+    { 12, 18, 15, 2, 18, 54, 8630 }, // Þ
+    { 13, 21, 16, 2, 20, 69, 8684 }, // ß
+    { 11, 21, 14, 1, 20, 58, 8753 }, // à
+    { 11, 21, 14, 1, 20, 58, 8811 }, // á
+    { 11, 21, 14, 1, 20, 58, 8869 }, // â
+    { 11, 20, 14, 1, 19, 55, 8927 }, // ã
+    { 11, 20, 14, 1, 19, 55, 8982 }, // ä
+    { 11, 22, 14, 1, 21, 61, 9037 }, // å
+    { 20, 15, 22, 1, 14, 75, 9098 }, // æ
+    { 11, 20, 12, 1, 14, 55, 9173 }, // ç
+    { 12, 21, 14, 1, 20, 63, 9228 }, // è
+    { 12, 21, 14, 1, 20, 63, 9291 }, // é
+    { 12, 21, 14, 1, 20, 63, 9354 }, // ê
+    { 12, 20, 14, 1, 19, 60, 9417 }, // ë
+    { 6, 20, 6, -1, 20, 30, 9477 }, // ì
+    { 6, 20, 6, 1, 20, 30, 9507 }, // í
+    { 9, 20, 6, -1, 20, 45, 9537 }, // î
+    { 8, 19, 6, -1, 19, 38, 9582 }, // ï
+    { 13, 21, 15, 1, 20, 69, 9620 }, // ð
+    { 12, 19, 15, 2, 19, 57, 9689 }, // ñ
+    { 13, 21, 15, 1, 20, 69, 9746 }, // ò
+    { 13, 21, 15, 1, 20, 69, 9815 }, // ó
+    { 13, 21, 15, 1, 20, 69, 9884 }, // ô
+    { 13, 20, 15, 1, 19, 65, 9953 }, // õ
+    { 13, 20, 15, 1, 19, 65, 10018 }, // ö
+    { 13, 12, 14, 1, 15, 39, 10083 }, // ÷
+    { 13, 16, 15, 1, 15, 52, 10122 }, // ø
+    { 13, 21, 15, 1, 20, 69, 10240 }, // ù
+    { 13, 21, 15, 1, 20, 69, 10309 }, // ú
+    { 13, 21, 15, 1, 20, 69, 10378 }, // û
+    { 13, 20, 15, 1, 19, 65, 10447 }, // ü
+    { 13, 26, 13, 0, 20, 85, 10512 }, // ý
+    { 12, 25, 15, 2, 19, 75, 10597 }, // þ
+    { 13, 25, 13, 0, 19, 82, 10672 }, // ÿ
+    { 16, 21, 16, 0, 21, 84, 10754 }, // Ā
+    { 11, 18, 14, 1, 17, 50, 10838 }, // ā
+    { 16, 23, 16, 0, 23, 92, 10888 }, // Ă
+    { 11, 20, 14, 1, 19, 55, 10980 }, // ă
+    { 16, 24, 16, 0, 18, 96, 11035 }, // Ą
+    { 12, 20, 14, 1, 14, 60, 11131 }, // ą
+    { 15, 25, 16, 1, 24, 94, 11191 }, // Ć
+    { 11, 21, 12, 1, 20, 58, 11285 }, // ć
+    { 15, 25, 16, 1, 24, 94, 11343 }, // Ĉ
+    { 11, 21, 12, 1, 20, 58, 11437 }, // ĉ
+    { 15, 24, 16, 1, 23, 90, 11495 }, // Ċ
+    { 11, 20, 12, 1, 19, 55, 11585 }, // ċ
+    { 15, 25, 16, 1, 24, 94, 11640 }, // Č
+    { 11, 21, 12, 1, 20, 58, 11734 }, // č
+    { 15, 24, 18, 2, 24, 90, 11792 }, // Ď
+    { 17, 20, 15, 1, 19, 85, 11882 }, // ď
+    { 17, 18, 18, 0, 18, 77, 11967 }, // Đ
+    { 15, 20, 15, 1, 19, 75, 12044 }, // đ
+    { 11, 21, 14, 2, 21, 58, 12119 }, // Ē
+    { 12, 18, 14, 1, 17, 54, 12177 }, // ē
+    { 11, 23, 14, 2, 23, 64, 12288 }, // Ĕ
+    { 12, 20, 14, 1, 19, 60, 12352 }, // ĕ
+    { 11, 23, 14, 2, 23, 64, 12412 }, // Ė
+    { 12, 20, 14, 1, 19, 60, 12476 }, // ė
+    { 11, 24, 14, 2, 18, 66, 12536 }, // Ę
+    { 12, 20, 14, 1, 14, 60, 12602 }, // ę
+    { 11, 24, 14, 2, 24, 66, 12662 }, // Ě
+    { 12, 21, 14, 1, 20, 63, 12728 }, // ě
+    { 16, 25, 18, 1, 24, 100, 12791 }, // Ĝ
+    { 13, 26, 15, 1, 20, 85, 12891 }, // ĝ
+    { 16, 24, 18, 1, 23, 96, 12976 }, // Ğ
+    { 13, 25, 15, 1, 19, 82, 13072 }, // ğ
+    { 16, 24, 18, 1, 23, 96, 13154 }, // Ġ
+    { 13, 25, 15, 1, 19, 82, 13250 }, // ġ
+    { 16, 25, 18, 1, 19, 100, 13332 }, // Ģ
+    { 13, 26, 15, 1, 20, 85, 13432 }, // ģ
+    { 15, 24, 19, 2, 24, 90, 13517 }, // Ĥ
+    { 15, 26, 15, -1, 26, 98, 13607 }, // ĥ
+    { 19, 18, 19, 0, 18, 86, 13705 }, // Ħ
+    { 14, 19, 15, 0, 19, 67, 13791 }, // ħ
+    { 10, 23, 8, -1, 23, 58, 13858 }, // Ĩ
+    { 10, 19, 6, -2, 19, 48, 13916 }, // ĩ
+    { 8, 21, 8, 0, 21, 42, 13964 }, // Ī
+    { 8, 17, 6, -1, 17, 34, 14006 }, // ī
+    { 9, 23, 8, 0, 23, 52, 14040 }, // Ĭ
+    { 9, 19, 6, -1, 19, 43, 14092 }, // ĭ
+    { 7, 24, 8, 1, 18, 42, 14135 }, // Į
+    { 5, 25, 6, 0, 19, 32, 14177 }, // į
+    { 7, 23, 8, 1, 23, 41, 14209 }, // İ
+    { 3, 14, 6, 2, 14, 11, 14250 }, // ı
+    { 13, 23, 15, 1, 18, 75, 14261 }, // Ĳ
+    { 10, 25, 13, 1, 19, 63, 14336 }, // ĳ
+    { 10, 29, 7, -2, 24, 73, 14399 }, // Ĵ
+    { 10, 26, 6, -2, 20, 65, 14472 }, // ĵ
+    { 14, 24, 15, 2, 18, 84, 14537 }, // Ķ
+    { 12, 25, 13, 2, 19, 75, 14621 }, // ķ
+    { 12, 14, 13, 2, 14, 42, 14696 }, // ĸ
+    { 11, 24, 13, 2, 24, 66, 14738 }, // Ĺ
+    { 6, 26, 6, 1, 26, 39, 14804 }, // ĺ
+    { 11, 24, 13, 2, 18, 66, 14843 }, // Ļ
+    { 4, 25, 6, 1, 19, 25, 14909 }, // ļ
+    { 11, 18, 13, 2, 18, 50, 14934 }, // Ľ
+    { 7, 19, 6, 2, 19, 34, 14984 }, // ľ
+    { 11, 18, 13, 2, 18, 50, 15018 }, // Ŀ
+    { 6, 19, 7, 2, 19, 29, 15068 }, // ŀ
+    { 13, 18, 13, 0, 18, 59, 15097 }, // Ł
+    { 8, 19, 6, -1, 19, 38, 15156 }, // ł
+    { 15, 24, 19, 2, 24, 90, 15194 }, // Ń
+    { 12, 20, 15, 2, 20, 60, 15284 }, // ń
+    { 15, 24, 19, 2, 18, 90, 15344 }, // Ņ
+    { 12, 20, 15, 2, 14, 60, 15434 }, // ņ
+    { 15, 24, 19, 2, 24, 90, 15494 }, // Ň
+    { 12, 20, 15, 2, 20, 60, 15584 }, // ň
+    { 16, 18, 17, 0, 18, 72, 15644 }, // ŉ
+    { 15, 23, 19, 2, 18, 87, 15716 }, // Ŋ
+    { 12, 20, 15, 2, 14, 60, 15803 }, // ŋ
+    { 17, 22, 20, 1, 21, 94, 15863 }, // Ō
+    { 13, 18, 15, 1, 17, 59, 15957 }, // ō
+    { 17, 24, 20, 1, 23, 102, 16016 }, // Ŏ
+    { 13, 20, 15, 1, 19, 65, 16118 }, // ŏ
+    { 17, 25, 20, 1, 24, 107, 16183 }, // Ő
+    { 13, 21, 15, 1, 20, 69, 16290 }, // ő
+    { 21, 20, 23, 1, 19, 105, 16384 }, // Œ
+    { 22, 15, 24, 1, 14, 83, 16489 }, // œ
+    { 14, 24, 16, 2, 24, 84, 16572 }, // Ŕ
+    { 8, 20, 10, 2, 20, 40, 16656 }, // ŕ
+    { 14, 24, 16, 2, 18, 84, 16696 }, // Ŗ
+    { 9, 20, 10, 1, 14, 45, 16780 }, // ŗ
+    { 14, 24, 16, 2, 24, 84, 16825 }, // Ř
+    { 10, 20, 10, 1, 20, 50, 16909 }, // ř
+    { 12, 25, 14, 1, 24, 75, 16959 }, // Ś
+    { 10, 21, 12, 1, 20, 53, 17034 }, // ś
+    { 12, 25, 14, 1, 24, 75, 17087 }, // Ŝ
+    { 10, 21, 12, 1, 20, 53, 17162 }, // ŝ
+    { 12, 25, 14, 1, 19, 75, 17215 }, // Ş
+    { 10, 20, 12, 1, 14, 50, 17290 }, // ş
+    { 12, 25, 14, 1, 24, 75, 17340 }, // Š
+    { 10, 21, 12, 1, 20, 53, 17415 }, // š
+    { 14, 24, 14, 0, 18, 84, 17468 }, // Ţ
+    { 9, 23, 9, 0, 17, 52, 17552 }, // ţ
+    { 14, 24, 14, 0, 24, 84, 17604 }, // Ť
+    { 12, 20, 9, 0, 19, 60, 17688 }, // ť
+    { 14, 18, 14, 0, 18, 63, 17748 }, // Ŧ
+    { 9, 18, 9, 0, 17, 41, 17811 }, // ŧ
+    { 14, 24, 18, 2, 23, 84, 17852 }, // Ũ
+    { 13, 20, 15, 1, 19, 65, 17936 }, // ũ
+    { 14, 22, 18, 2, 21, 77, 18001 }, // Ū
+    { 13, 18, 15, 1, 17, 59, 18078 }, // ū
+    { 14, 24, 18, 2, 23, 84, 18137 }, // Ŭ
+    { 13, 20, 15, 1, 19, 65, 18221 }, // ŭ
+    { 14, 26, 18, 2, 25, 91, 18286 }, // Ů
+    { 13, 22, 15, 1, 21, 72, 18432 }, // ů
+    { 14, 25, 18, 2, 24, 88, 18504 }, // Ű
+    { 13, 21, 15, 1, 20, 69, 18592 }, // ű
+    { 14, 24, 18, 2, 18, 84, 18661 }, // Ų
+    { 13, 20, 15, 1, 14, 65, 18745 }, // ų
+    { 23, 24, 23, 0, 24, 138, 18810 }, // Ŵ
+    { 20, 20, 20, 0, 20, 100, 18948 }, // ŵ
+    { 15, 24, 14, 0, 24, 90, 19048 }, // Ŷ
+    { 13, 26, 13, 0, 20, 85, 19138 }, // ŷ
+    { 15, 23, 14, 0, 23, 87, 19223 }, // Ÿ
+    { 14, 24, 14, 0, 24, 84, 19310 }, // Ź
+    { 11, 20, 12, 0, 20, 55, 19394 }, // ź
+    { 14, 23, 14, 0, 23, 81, 19449 }, // Ż
+    { 11, 19, 12, 0, 19, 53, 19530 }, // ż
+    { 14, 24, 14, 0, 24, 84, 19583 }, // Ž
+    { 11, 20, 12, 0, 20, 55, 19667 }, // ž
+    { 8, 20, 8, 2, 20, 40, 19722 }, // ſ
+    { 6, 5, 0, -13, 20, 8, 19762 }, // ̀
+    { 6, 5, 0, -9, 20, 8, 19770 }, // ́
+    { 10, 5, 0, -5, 20, 13, 19778 }, // ̂
+    { 10, 4, 0, -13, 19, 10, 19791 }, // ̃
+    { 8, 2, 0, -4, 17, 4, 19801 }, // ̄
+    { 12, 3, 0, -6, 22, 9, 19805 }, // ̅
+    { 8, 4, 0, -4, 19, 8, 19814 }, // ̆
+    { 4, 4, 0, -2, 19, 4, 19822 }, // ̇
+    { 8, 4, 0, -4, 19, 8, 19826 }, // ̈
+    { 6, 7, 0, -10, 21, 11, 19834 }, // ̉
+    { 6, 6, 0, -3, 21, 9, 19845 }, // ̊
+    { 10, 5, 0, -4, 20, 13, 19854 }, // ̋
+    { 10, 5, 0, -5, 20, 13, 19867 }, // ̌
+    { 2, 5, 0, -1, 19, 3, 19880 }, // ̍
+    { 6, 5, 0, -3, 19, 8, 19883 }, // ̎
+    { 10, 5, 0, -13, 20, 13, 19891 }, // ̏
+    { 8, 7, 0, -4, 22, 14, 19904 }, // ̐
+    { 8, 4, 0, -4, 19, 8, 19918 }, // ̑
+    { 4, 7, 0, -2, 18, 7, 19926 }, // ̒
+    { 4, 7, 0, -2, 18, 7, 19933 }, // ̓
+    { 4, 7, 0, -2, 18, 7, 19940 }, // ̔
+    { 4, 7, 0, -2, 18, 7, 19947 }, // ̕
+    { 6, 5, 0, -3, 0, 8, 19954 }, // ̖
+    { 6, 5, 0, -3, 0, 8, 19962 }, // ̗
+    { 6, 6, 0, -3, 0, 9, 19970 }, // ̘
+    { 6, 6, 0, -3, 0, 9, 19979 }, // ̙
+    { 7, 6, 8, 0, 19, 11, 19988 }, // ̚
+    { 6, 6, 0, -3, 19, 9, 19999 }, // ̛
+    { 4, 6, 0, -2, 0, 6, 20008 }, // ̜
+    { 6, 5, 0, -3, -1, 8, 20014 }, // ̝
+    { 6, 5, 0, -3, -1, 8, 20022 }, // ̞
+    { 6, 6, 0, -3, 0, 9, 20030 }, // ̟
+    { 6, 3, 0, -3, -2, 5, 20039 }, // ̠
+    { 5, 8, 0, -5, 2, 10, 20044 }, // ̡
+    { 5, 8, 0, 0, 2, 10, 20054 }, // ̢
+    { 3, 4, 0, -9, -1, 3, 20064 }, // ̣
+    { 8, 4, 0, -4, -1, 8, 20067 }, // ̤
+    { 6, 6, 0, -3, 0, 9, 20075 }, // ̥
+    { 4, 5, 0, -2, -1, 5, 20084 }, // ̦
+    { 6, 6, 0, -3, 0, 9, 20089 }, // ̧
+    { 6, 7, 0, -3, 1, 11, 20098 }, // ̨
+    { 2, 5, 0, -1, -1, 3, 20109 }, // ̩
+    { 10, 5, 0, -5, -1, 13, 20112 }, // ̪
+    { 10, 4, 0, -5, -1, 10, 20125 }, // ̫
+    { 10, 5, 0, -5, 0, 13, 20135 }, // ̬
+    { 10, 5, 0, -5, 0, 13, 20148 }, // ̭
+    { 8, 4, 0, -4, -1, 8, 20161 }, // ̮
+    { 8, 4, 0, -4, -1, 8, 20169 }, // ̯
+    { 10, 4, 0, -5, -1, 10, 20177 }, // ̰
+    { 8, 2, 0, -4, -2, 4, 20187 }, // ̱
+    { 12, 2, 0, -6, -2, 6, 20191 }, // ̲
+    { 12, 6, 0, -6, 0, 18, 20197 }, // ̳
+    { 10, 4, 0, -5, 9, 10, 20215 }, // ̴
+    { 12, 3, 0, -6, 9, 9, 20225 }, // ̵
+    { 18, 2, 0, -9, 8, 9, 20234 }, // ̶
+    { 8, 6, 0, -4, 10, 12, 20243 }, // ̷
+    { 10, 21, 0, -5, 19, 53, 20255 }, // ̸
+    { 4, 6, 0, -2, 0, 6, 20308 }, // ̹
+    { 10, 5, 0, -5, -1, 13, 20314 }, // ̺
+    { 10, 6, 0, -5, 0, 15, 20327 }, // ̻
+    { 10, 4, 0, -5, -1, 10, 20342 }, // ̼
+    { 6, 6, 0, -3, 20, 9, 20352 }, // ̽
+    { 4, 8, 0, -2, 22, 8, 20361 }, // ̾
+    { 12, 6, 0, -6, 25, 18, 20369 }, // ̿
+    { 6, 5, 0, -4, 20, 8, 20387 }, // ̀
+    { 6, 5, 0, -1, 20, 8, 20395 }, // ́
+    { 10, 4, 0, -5, 19, 10, 20403 }, // ͂
+    { 4, 5, 0, -2, 20, 5, 20413 }, // ̓
+    { 9, 5, 0, -4, 20, 12, 20418 }, // ̈́
+    { 4, 4, 0, -1, -2, 4, 20430 }, // ͅ
+    { 12, 6, 0, -6, 20, 18, 20434 }, // ͆
+    { 12, 6, 0, -6, 0, 18, 20452 }, // ͇
+    { 6, 5, 0, -3, -1, 8, 20470 }, // ͈
+    { 6, 5, 0, -3, -1, 8, 20480 }, // ͉
+    { 10, 6, 0, -5, 20, 15, 20488 }, // ͊
+    { 10, 10, 0, -5, 24, 25, 20503 }, // ͋
+    { 10, 7, 0, -5, 22, 18, 20528 }, // ͌
+    { 10, 6, 0, -5, 0, 15, 20546 }, // ͍
+    { 6, 6, 0, -3, 0, 9, 20561 }, // ͎
+    { 18, 18, 0, -9, 18, 81, 20570 }, // ͏
+    { 5, 6, 0, -3, 20, 8, 20651 }, // ͐
+    { 4, 6, 0, -2, 21, 6, 20659 }, // ͑
+    { 8, 6, 0, -4, 21, 12, 20665 }, // ͒
+    { 6, 6, 0, -3, 0, 9, 20677 }, // ͓
+    { 5, 5, 0, -3, -1, 7, 20686 }, // ͔
+    { 5, 5, 0, -3, -1, 7, 20693 }, // ͕
+    { 10, 5, 0, -5, -1, 13, 20700 }, // ͖
+    { 4, 6, 0, -2, 21, 6, 20713 }, // ͗
+    { 3, 4, 0, 3, 19, 3, 20719 }, // ͘
+    { 6, 6, 0, -3, 0, 9, 20722 }, // ͙
+    { 10, 6, 0, -5, 0, 15, 20731 }, // ͚
+    { 6, 6, 0, -3, 20, 9, 20746 }, // ͛
+    { 20, 5, 0, -10, -1, 25, 20755 }, // ͜
+    { 20, 5, 0, -10, 19, 25, 20780 }, // ͝
+    { 16, 2, 0, -8, 17, 8, 20805 }, // ͞
+    { 16, 2, 0, -8, -2, 8, 20813 }, // ͟
+    { 20, 4, 0, -10, 19, 20, 20821 }, // ͠
+    { 20, 6, 0, -10, 22, 30, 20841 }, // ͡
+    { 21, 6, 0, -10, 0, 32, 20871 }, // ͢
+    { 6, 6, 0, -3, 21, 9, 20903 }, // ͣ
+    { 6, 6, 0, -3, 21, 9, 20912 }, // ͤ
+    { 2, 8, 0, -1, 23, 4, 20921 }, // ͥ
+    { 7, 6, 0, -3, 21, 11, 20925 }, // ͦ
+    { 6, 6, 0, -3, 21, 9, 20936 }, // ͧ
+    { 5, 6, 0, -2, 21, 8, 20945 }, // ͨ
+    { 6, 9, 0, -3, 24, 14, 20953 }, // ͩ
+    { 6, 9, 0, -3, 24, 14, 20967 }, // ͪ
+    { 10, 6, 0, -5, 21, 15, 20981 }, // ͫ
+    { 5, 6, 0, -2, 21, 8, 20996 }, // ͬ
+    { 5, 8, 0, -2, 23, 10, 21004 }, // ͭ
+    { 7, 6, 0, -3, 21, 11, 21014 }, // ͮ
+    { 7, 6, 0, -3, 21, 11, 21025 }, // ͯ
+    { 11, 24, 14, 2, 24, 66, 21036 }, // Ѐ
+    { 11, 23, 14, 2, 23, 64, 21102 }, // Ё
+    { 17, 19, 18, 0, 18, 81, 21166 }, // Ђ
+    { 11, 24, 13, 2, 24, 66, 21247 }, // Ѓ
+    { 14, 20, 16, 1, 19, 70, 21313 }, // Є
+    { 12, 20, 14, 1, 19, 60, 21383 }, // Ѕ
+    { 3, 18, 7, 2, 18, 14, 21443 }, // І
+    { 7, 23, 7, 0, 23, 41, 21457 }, // Ї
+    { 7, 23, 7, -2, 18, 41, 21498 }, // Ј
+    { 24, 19, 25, 0, 18, 114, 21539 }, // Љ
+    { 23, 18, 26, 2, 18, 104, 21653 }, // Њ
+    { 17, 18, 18, 0, 18, 77, 21757 }, // Ћ
+    { 14, 24, 16, 2, 24, 84, 21834 }, // Ќ
+    { 15, 24, 19, 2, 24, 90, 21918 }, // Ѝ
+    { 16, 24, 15, 0, 23, 96, 22008 }, // Ў
+    { 14, 22, 18, 2, 18, 77, 22104 }, // Џ
+    { 16, 18, 16, 0, 18, 72, 22181 }, // А
+    { 13, 18, 15, 2, 18, 59, 22253 }, // Б
+    { 13, 18, 16, 2, 18, 59, 22312 }, // В
+    { 11, 18, 13, 2, 18, 50, 22371 }, // Г
+    { 18, 22, 18, 0, 18, 99, 22421 }, // Д
+    { 11, 18, 14, 2, 18, 50, 22528 }, // Е
+    { 23, 18, 23, 0, 18, 104, 22578 }, // Ж
+    { 13, 20, 14, 0, 19, 65, 22682 }, // З
+    { 15, 18, 19, 2, 18, 68, 22747 }, // И
+    { 15, 23, 19, 2, 23, 87, 22815 }, // Й
+    { 14, 18, 16, 2, 18, 63, 22902 }, // К
+    { 16, 19, 17, 0, 18, 76, 22965 }, // Л
+    { 19, 18, 23, 2, 18, 86, 23041 }, // М
+    { 15, 18, 19, 2, 18, 68, 23127 }, // Н
+    { 17, 20, 19, 1, 19, 85, 23195 }, // О
+    { 14, 18, 18, 2, 18, 63, 23280 }, // П
+    { 12, 18, 15, 2, 18, 54, 23343 }, // Р
+    { 14, 20, 16, 1, 19, 70, 23397 }, // С
+    { 14, 18, 14, 0, 18, 63, 23467 }, // Т
+    { 16, 19, 15, 0, 18, 76, 23530 }, // У
+    { 19, 20, 20, 1, 19, 95, 23606 }, // Ф
+    { 15, 18, 15, 0, 18, 68, 23701 }, // Х
+    { 17, 22, 19, 2, 18, 94, 23769 }, // Ц
+    { 14, 18, 17, 1, 18, 63, 23863 }, // Ч
+    { 22, 18, 26, 2, 18, 99, 23926 }, // Ш
+    { 24, 22, 26, 2, 18, 132, 24025 }, // Щ
+    { 16, 18, 17, 0, 18, 72, 24157 }, // Ъ
+    { 17, 18, 21, 2, 18, 77, 24229 }, // Ы
+    { 12, 18, 15, 2, 18, 54, 24306 }, // Ь
+    { 14, 20, 16, 1, 19, 70, 24360 }, // Э
+    { 22, 20, 25, 2, 19, 110, 24430 }, // Ю
+    { 14, 18, 16, 0, 18, 63, 24576 }, // Я
+    { 11, 15, 14, 1, 14, 42, 24639 }, // а
+    { 13, 21, 15, 1, 20, 69, 24681 }, // б
+    { 11, 14, 14, 2, 14, 39, 24750 }, // в
+    { 9, 14, 11, 2, 14, 32, 24789 }, // г
+    { 15, 18, 15, 0, 14, 68, 24821 }, // д
+    { 12, 15, 14, 1, 14, 45, 24889 }, // е
+    { 19, 14, 19, 0, 14, 67, 24934 }, // ж
+    { 12, 15, 12, 0, 14, 45, 25001 }, // з
+    { 12, 14, 16, 2, 14, 42, 25046 }, // и
+    { 12, 19, 16, 2, 19, 57, 25088 }, // й
+    { 12, 14, 13, 2, 14, 42, 25145 }, // к
+    { 13, 15, 15, 0, 14, 49, 25187 }, // л
+    { 16, 14, 19, 2, 14, 56, 25236 }, // м
+    { 12, 14, 15, 2, 14, 42, 25292 }, // н
+    { 13, 15, 15, 1, 14, 49, 25334 }, // о
+    { 12, 14, 15, 2, 14, 42, 25383 }, // п
+    { 12, 20, 15, 2, 14, 60, 25425 }, // р
+    { 11, 15, 12, 1, 14, 42, 25485 }, // с
+    { 12, 14, 12, 0, 14, 42, 25527 }, // т
+    { 13, 20, 13, 0, 14, 65, 25569 }, // у
+    { 17, 25, 18, 1, 19, 107, 25634 }, // ф
+    { 13, 14, 13, 0, 14, 46, 25741 }, // х
+    { 14, 18, 15, 2, 14, 63, 25787 }, // ц
+    { 12, 14, 15, 1, 14, 42, 25850 }, // ч
+    { 19, 14, 22, 2, 14, 67, 25892 }, // ш
+    { 21, 18, 22, 2, 14, 95, 25959 }, // щ
+    { 15, 14, 16, 0, 14, 53, 26054 }, // ъ
+    { 15, 14, 19, 2, 14, 53, 26107 }, // ы
+    { 11, 14, 14, 2, 14, 39, 26160 }, // ь
+    { 11, 15, 12, 1, 14, 42, 26199 }, // э
+    { 17, 15, 20, 2, 14, 64, 26241 }, // ю
+    { 13, 14, 14, 0, 14, 46, 26305 }, // я
+    { 12, 21, 14, 1, 20, 63, 26351 }, // ѐ
+    { 12, 20, 14, 1, 19, 60, 26414 }, // ё
+    { 14, 25, 15, 0, 19, 88, 26474 }, // ђ
+    { 9, 20, 11, 2, 20, 45, 26562 }, // ѓ
+    { 11, 15, 12, 1, 14, 42, 26624 }, // є
+    { 10, 15, 12, 1, 14, 38, 26666 }, // ѕ
+    { 4, 19, 6, 1, 19, 19, 26704 }, // і
+    { 6, 19, 6, 0, 19, 29, 26723 }, // ї
+    { 7, 25, 6, -2, 19, 44, 26752 }, // ј
+    { 21, 15, 21, 0, 14, 79, 26796 }, // љ
+    { 20, 14, 22, 2, 14, 70, 26875 }, // њ
+    { 14, 19, 16, 0, 19, 67, 26945 }, // ћ
+    { 12, 20, 13, 2, 20, 60, 27012 }, // ќ
+    { 12, 20, 16, 2, 20, 60, 27072 }, // ѝ
+    { 13, 25, 13, 0, 19, 82, 27132 }, // ў
+    { 12, 18, 15, 2, 14, 54, 27214 }, // џ
+    { 23, 19, 23, 0, 18, 110, 27268 }, // Ѡ
+    { 20, 14, 20, 0, 14, 70, 27378 }, // ѡ
+    { 16, 18, 17, 0, 18, 72, 27448 }, // Ѣ
+    { 15, 17, 16, 0, 17, 64, 27520 }, // ѣ
+    { 21, 20, 23, 2, 19, 105, 27584 }, // Ѥ
+    { 16, 15, 19, 2, 14, 60, 27689 }, // ѥ
+    { 18, 18, 17, 0, 18, 81, 27749 }, // Ѧ
+    { 15, 14, 14, 0, 14, 53, 27830 }, // ѧ
+    { 22, 18, 23, 2, 18, 99, 27883 }, // Ѩ
+    { 18, 14, 20, 2, 14, 63, 27982 }, // ѩ
+    { 18, 18, 18, 0, 18, 81, 28045 }, // Ѫ
+    { 16, 14, 16, 0, 14, 56, 28126 }, // ѫ
+    { 23, 18, 25, 2, 18, 104, 28182 }, // Ѭ
+    { 20, 14, 21, 2, 14, 70, 28286 }, // ѭ
+    { 14, 28, 15, 0, 22, 98, 28356 }, // Ѯ
+    { 12, 22, 12, 0, 17, 66, 28454 }, // ѯ
+    { 17, 18, 20, 2, 18, 77, 28520 }, // Ѱ
+    { 16, 25, 19, 1, 19, 100, 28672 }, // ѱ
+    { 17, 20, 20, 1, 19, 85, 28772 }, // Ѳ
+    { 13, 15, 15, 1, 14, 49, 28857 }, // ѳ
+    { 17, 18, 16, 0, 18, 77, 28906 }, // Ѵ
+    { 14, 14, 13, 0, 14, 49, 28983 }, // ѵ
+    { 17, 24, 16, 0, 24, 102, 29032 }, // Ѷ
+    { 14, 20, 13, 0, 20, 70, 29134 }, // ѷ
+    { 30, 25, 31, 1, 19, 188, 29204 }, // Ѹ
+    { 27, 20, 27, 1, 14, 135, 29392 }, // ѹ
+    { 18, 22, 21, 1, 20, 99, 29527 }, // Ѻ
+    { 15, 17, 16, 1, 15, 64, 29626 }, // ѻ
+    { 24, 27, 26, 1, 26, 162, 29690 }, // Ѽ
+    { 21, 24, 23, 1, 23, 126, 29852 }, // ѽ
+    { 23, 24, 23, 0, 23, 138, 29978 }, // Ѿ
+    { 20, 18, 20, 0, 18, 90, 30116 }, // ѿ
+    { 15, 25, 16, 1, 19, 94, 30206 }, // Ҁ
+    { 11, 20, 12, 1, 14, 55, 30300 }, // ҁ
+    { 13, 17, 15, 1, 16, 56, 30355 }, // ҂
+    { 10, 4, 0, -12, 18, 10, 30411 }, // ҃
+    { 10, 4, 0, -12, 19, 10, 30421 }, // ҄
+    { 4, 5, 0, -9, 20, 5, 30431 }, // ҅
+    { 4, 5, 0, -9, 20, 5, 30436 }, // ҆
+    { 10, 4, 0, -5, 23, 10, 30441 }, // ҇
+    { 30, 27, 0, -15, 20, 203, 30451 }, // ҈
+    { 28, 28, 0, -14, 21, 196, 30720 }, // ҉
+    { 18, 29, 20, 2, 24, 131, 30916 }, // Ҋ
+    { 15, 24, 16, 2, 19, 90, 31047 }, // ҋ
+    { 15, 18, 15, 0, 18, 68, 31137 }, // Ҍ
+    { 14, 19, 15, 0, 19, 67, 31205 }, // ҍ
+    { 13, 18, 15, 2, 18, 59, 31272 }, // Ҏ
+    { 12, 20, 15, 2, 14, 60, 31331 }, // ҏ
+    { 11, 22, 13, 2, 22, 61, 31391 }, // Ґ
+    { 9, 18, 11, 2, 18, 41, 31452 }, // ґ
+    { 13, 18, 13, 0, 18, 59, 31493 }, // Ғ
+    { 11, 14, 11, 0, 14, 39, 31552 }, // ғ
+    { 14, 25, 16, 2, 18, 88, 31591 }, // Ҕ
+    { 11, 21, 13, 2, 14, 58, 31679 }, // ҕ
+    { 23, 23, 23, 0, 18, 133, 31737 }, // Җ
+    { 20, 19, 20, 0, 14, 95, 31870 }, // җ
+    { 13, 25, 14, 0, 19, 82, 31965 }, // Ҙ
+    { 12, 20, 12, 0, 14, 60, 32047 }, // ҙ
+    { 15, 23, 17, 2, 18, 87, 32107 }, // Қ
+    { 12, 19, 14, 2, 14, 57, 32194 }, // қ
+    { 14, 18, 16, 2, 18, 63, 32251 }, // Ҝ
+    { 11, 14, 13, 2, 14, 39, 32314 }, // ҝ
+    { 16, 18, 16, 0, 18, 72, 32353 }, // Ҟ
+    { 13, 19, 13, 0, 19, 62, 32425 }, // ҟ
+    { 18, 18, 17, 0, 18, 81, 32487 }, // Ҡ
+    { 16, 14, 16, 0, 14, 56, 32568 }, // ҡ
+    { 17, 23, 19, 2, 18, 98, 32624 }, // Ң
+    { 14, 19, 16, 2, 14, 67, 32768 }, // ң
+    { 19, 18, 20, 2, 18, 86, 32835 }, // Ҥ
+    { 17, 14, 18, 2, 14, 60, 32921 }, // ҥ
+    { 24, 25, 26, 2, 18, 150, 32981 }, // Ҧ
+    { 19, 21, 22, 2, 14, 100, 33131 }, // ҧ
+    { 18, 21, 19, 1, 19, 95, 33231 }, // Ҩ
+    { 15, 15, 16, 1, 14, 57, 33326 }, // ҩ
+    { 15, 25, 16, 1, 19, 94, 33383 }, // Ҫ
+    { 11, 20, 12, 1, 14, 55, 33477 }, // ҫ
+    { 14, 23, 14, 0, 18, 81, 33532 }, // Ҭ
+    { 12, 19, 12, 0, 14, 57, 33613 }, // ҭ
+    { 15, 18, 14, 0, 18, 68, 33670 }, // Ү
+    { 13, 20, 13, 0, 14, 65, 33738 }, // ү
+    { 15, 18, 14, 0, 18, 68, 33803 }, // Ұ
+    { 13, 20, 13, 0, 14, 65, 33871 }, // ұ
+    { 16, 23, 16, 0, 18, 92, 33936 }, // Ҳ
+    { 14, 19, 14, 0, 14, 67, 34028 }, // ҳ
+    { 21, 23, 22, 0, 18, 121, 34095 }, // Ҵ
+    { 18, 19, 18, 0, 14, 86, 34216 }, // ҵ
+    { 16, 23, 18, 2, 18, 92, 34302 }, // Ҷ
+    { 15, 19, 16, 1, 14, 72, 34394 }, // ҷ
+    { 14, 18, 17, 2, 18, 63, 34466 }, // Ҹ
+    { 12, 14, 15, 1, 14, 42, 34529 }, // ҹ
+    { 14, 18, 17, 2, 18, 63, 34571 }, // Һ
+    { 12, 19, 15, 2, 19, 57, 34634 }, // һ
+    { 20, 20, 21, 0, 19, 100, 34691 }, // Ҽ
+    { 16, 15, 17, 0, 14, 60, 34816 }, // ҽ
+    { 20, 24, 21, 0, 19, 120, 34876 }, // Ҿ
+    { 16, 19, 17, 0, 14, 76, 34996 }, // ҿ
+    { 7, 18, 8, 1, 18, 32, 35072 }, // Ӏ
+    { 23, 23, 23, 0, 23, 133, 35104 }, // Ӂ
+    { 19, 19, 19, 0, 19, 91, 35237 }, // ӂ
+    { 15, 25, 17, 2, 18, 94, 35328 }, // Ӄ
+    { 12, 21, 14, 2, 14, 63, 35422 }, // ӄ
+    { 18, 23, 18, 0, 18, 104, 35485 }, // Ӆ
+    { 15, 19, 15, 0, 14, 72, 35589 }, // ӆ
+    { 15, 25, 18, 2, 18, 94, 35661 }, // Ӈ
+    { 12, 21, 16, 2, 14, 63, 35755 }, // ӈ
+    { 17, 23, 19, 2, 18, 98, 35818 }, // Ӊ
+    { 15, 19, 17, 2, 14, 72, 35916 }, // ӊ
+    { 14, 23, 17, 2, 18, 81, 35988 }, // Ӌ
+    { 13, 19, 15, 1, 14, 62, 36069 }, // ӌ
+    { 21, 23, 23, 2, 18, 121, 36131 }, // Ӎ
+    { 17, 19, 19, 2, 14, 81, 36252 }, // ӎ
+    { 7, 18, 8, 1, 18, 32, 36333 }, // ӏ
+    { 16, 23, 16, 0, 23, 92, 36365 }, // Ӑ
+    { 11, 20, 14, 1, 19, 55, 36457 }, // ӑ
+    { 16, 23, 16, 0, 23, 92, 36512 }, // Ӓ
+    { 11, 20, 14, 1, 19, 55, 36604 }, // ӓ
+    { 22, 18, 22, -1, 18, 99, 36659 }, // Ӕ
+    { 20, 15, 22, 1, 14, 75, 36758 }, // ӕ
+    { 11, 23, 14, 2, 23, 64, 36864 }, // Ӗ
+    { 12, 20, 14, 1, 19, 60, 36928 }, // ӗ
+    { 16, 20, 18, 1, 19, 80, 36988 }, // Ә
+    { 12, 15, 14, 1, 14, 45, 37068 }, // ә
+    { 16, 24, 18, 1, 23, 96, 37113 }, // Ӛ
+    { 12, 20, 14, 1, 19, 60, 37209 }, // ӛ
+    { 23, 23, 23, 0, 23, 133, 37269 }, // Ӝ
+    { 19, 19, 19, 0, 19, 91, 37402 }, // ӝ
+    { 13, 24, 14, 0, 23, 78, 37493 }, // Ӟ
+    { 12, 20, 12, 0, 19, 60, 37571 }, // ӟ
+    { 14, 19, 15, 0, 18, 67, 37631 }, // Ӡ
+    { 12, 20, 12, 0, 14, 60, 37698 }, // ӡ
+    { 15, 21, 19, 2, 21, 79, 37758 }, // Ӣ
+    { 12, 17, 16, 2, 17, 51, 37837 }, // ӣ
+    { 15, 23, 19, 2, 23, 87, 37888 }, // Ӥ
+    { 12, 19, 16, 2, 19, 57, 37975 }, // ӥ
+    { 17, 24, 20, 1, 23, 102, 38032 }, // Ӧ
+    { 13, 20, 15, 1, 19, 65, 38134 }, // ӧ
+    { 17, 20, 20, 1, 19, 85, 38199 }, // Ө
+    { 13, 15, 15, 1, 14, 49, 38284 }, // ө
+    { 17, 24, 20, 1, 23, 102, 38333 }, // Ӫ
+    { 13, 20, 15, 1, 19, 65, 38435 }, // ӫ
+    { 14, 24, 16, 1, 23, 84, 38500 }, // Ӭ
+    { 11, 20, 12, 1, 19, 55, 38584 }, // ӭ
+    { 16, 22, 15, 0, 21, 88, 38639 }, // Ӯ
+    { 13, 23, 13, 0, 17, 75, 38727 }, // ӯ
+    { 16, 24, 15, 0, 23, 96, 38802 }, // Ӱ
+    { 13, 25, 13, 0, 19, 82, 38912 }, // ӱ
+    { 16, 25, 15, 0, 24, 100, 38994 }, // Ӳ
+    { 13, 26, 13, 0, 20, 85, 39094 }, // ӳ
+    { 14, 23, 17, 1, 23, 81, 39179 }, // Ӵ
+    { 12, 19, 15, 1, 19, 57, 39260 }, // ӵ
+    { 11, 23, 13, 2, 18, 64, 39317 }, // Ӷ
+    { 9, 19, 11, 2, 14, 43, 39381 }, // ӷ
+    { 17, 23, 21, 2, 23, 98, 39424 }, // Ӹ
+    { 15, 19, 19, 2, 19, 72, 39522 }, // ӹ
+    { 13, 23, 13, 0, 18, 75, 39594 }, // Ӻ
+    { 11, 19, 11, 0, 14, 53, 39669 }, // ӻ
+    { 16, 23, 16, 0, 18, 92, 39722 }, // Ӽ
+    { 14, 19, 14, 0, 14, 67, 39814 }, // ӽ
+    { 15, 18, 15, 0, 18, 68, 39881 }, // Ӿ
+    { 13, 14, 13, 0, 14, 46, 39949 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 39995 }, //  
+    { 0, 0, 25, 0, 0, 0, 39995 }, //  
+    { 0, 0, 13, 0, 0, 0, 39995 }, //  
+    { 0, 0, 25, 0, 0, 0, 39995 }, //  
+    { 0, 0, 8, 0, 0, 0, 39995 }, //  
+    { 0, 0, 6, 0, 0, 0, 39995 }, //  
+    { 0, 0, 4, 0, 0, 0, 39995 }, //  
+    { 0, 0, 14, 0, 0, 0, 39995 }, //  
+    { 0, 0, 7, 0, 0, 0, 39995 }, //  
+    { 0, 0, 4, 0, 0, 0, 39995 }, //  
+    { 0, 0, 3, 0, 0, 0, 39995 }, //  
+    { 0, 0, 0, 0, 0, 0, 39995 }, // ​
+    { 0, 0, 0, 0, 0, 0, 39995 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 39995 }, // ‍
+    { 7, 22, 0, -1, 18, 39, 39995 }, // ‎
+    { 7, 22, 0, -6, 18, 39, 40034 }, // ‏
+    { 7, 3, 8, 1, 8, 6, 40073 }, // ‐
+    { 7, 3, 8, 1, 8, 6, 40079 }, // ‑
+    { 13, 2, 14, 1, 10, 7, 40085 }, // ‒
+    { 11, 3, 13, 1, 8, 9, 40092 }, // –
+    { 23, 3, 25, 1, 8, 18, 40101 }, // —
+    { 23, 3, 25, 1, 8, 18, 40119 }, // ―
+    { 8, 26, 14, 3, 19, 52, 40137 }, // ‖
+    { 12, 6, 10, -1, 0, 18, 40189 }, // ‗
+    { 5, 7, 4, 0, 18, 9, 40207 }, // ‘
+    { 5, 7, 4, 0, 18, 9, 40216 }, // ’
+    { 5, 7, 6, 0, 3, 9, 40225 }, // ‚
+    { 5, 7, 4, 0, 18, 9, 40234 }, // ‛
+    { 9, 7, 9, 0, 18, 16, 40243 }, // “
+    { 9, 7, 9, 0, 18, 16, 40259 }, // ”
+    { 10, 7, 10, 0, 3, 18, 40275 }, // „
+    { 9, 7, 9, 0, 18, 16, 40293 }, // ‟
+    { 11, 19, 13, 1, 19, 53, 40309 }, // †
+    { 11, 19, 13, 1, 19, 53, 40362 }, // ‡
+    { 7, 7, 9, 1, 13, 13, 40415 }, // •
+    { 8, 8, 9, 1, 13, 16, 40428 }, // ‣
+    { 4, 5, 13, 4, 4, 5, 40444 }, // ․
+    { 11, 5, 13, 1, 4, 14, 40449 }, // ‥
+    { 17, 5, 20, 1, 4, 22, 40463 }, // …
+    { 4, 5, 7, 1, 9, 5, 40485 }, // ‧
+    { 0, 0, 15, 0, 0, 0, 40490 }, //  
+    { 0, 0, 15, 0, 0, 0, 40490 }, //  
+    { 7, 20, 0, -1, 16, 35, 40490 }, // ‪
+    { 7, 20, 0, -6, 16, 35, 40525 }, // ‫
+    { 6, 22, 0, -3, 18, 33, 40560 }, // ‬
+    { 6, 22, 0, -3, 18, 33, 40593 }, // ‭
+    { 6, 22, 0, -3, 18, 33, 40626 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 40659 }, //  
+    { 28, 20, 29, 1, 19, 140, 40659 }, // ‰
+    { 37, 20, 39, 1, 19, 185, 40960 }, // ‱
+    { 7, 7, 6, 0, 18, 13, 41145 }, // ′
+    { 11, 7, 10, 0, 18, 20, 41158 }, // ″
+    { 16, 7, 15, 0, 18, 28, 41178 }, // ‴
+    { 6, 7, 6, -1, 18, 11, 41206 }, // ‵
+    { 10, 7, 11, -1, 18, 18, 41217 }, // ‶
+    { 14, 7, 15, -1, 18, 25, 41235 }, // ‷
+    { 10, 9, 10, 0, 3, 23, 41260 }, // ‸
+    { 6, 11, 8, 1, 12, 17, 41283 }, // ‹
+    { 7, 11, 8, 0, 12, 20, 41300 }, // ›
+    { 19, 20, 21, 1, 19, 95, 41320 }, // ※
+    { 10, 19, 12, 1, 18, 48, 41415 }, // ‼
+    { 11, 20, 11, 0, 19, 55, 41463 }, // ‽
+    { 14, 2, 13, -1, 21, 7, 41518 }, // ‾
+    { 15, 6, 15, 0, 0, 23, 41525 }, // ‿
+    { 15, 6, 15, 0, 20, 23, 41548 }, // ⁀
+    { 9, 17, 9, 0, 11, 39, 41571 }, // ⁁
+    { 28, 23, 28, 0, 19, 161, 41610 }, // ⁂
+    { 7, 3, 8, 1, 8, 6, 41771 }, // ⁃
+    { 13, 18, 3, -5, 18, 59, 41777 }, // ⁄
+    { 7, 22, 8, 1, 18, 39, 41836 }, // ⁅
+    { 7, 22, 8, 0, 18, 39, 41875 }, // ⁆
+    { 21, 20, 21, 0, 19, 105, 41914 }, // ⁇
+    { 16, 20, 17, 0, 19, 80, 42019 }, // ⁈
+    { 16, 20, 17, 1, 19, 80, 42099 }, // ⁉
+    { 13, 14, 14, 0, 14, 46, 42179 }, // ⁊
+    { 13, 23, 16, 2, 19, 75, 42225 }, // ⁋
+    { 13, 14, 16, 1, 14, 46, 42300 }, // ⁌
+    { 13, 14, 16, 2, 14, 46, 42346 }, // ⁍
+    { 12, 12, 14, 1, 6, 36, 42392 }, // ⁎
+    { 5, 18, 6, 1, 14, 23, 42428 }, // ⁏
+    { 15, 26, 15, 0, 20, 98, 42451 }, // ⁐
+    { 12, 25, 14, 1, 19, 75, 42549 }, // ⁑
+    { 10, 20, 9, 0, 19, 50, 42624 }, // ⁒
+    { 23, 5, 25, 1, 10, 29, 42674 }, // ⁓
+    { 15, 6, 15, 0, 0, 23, 42703 }, // ⁔
+    { 14, 14, 14, 0, 13, 49, 42726 }, // ⁕
+    { 11, 20, 13, 1, 19, 55, 42775 }, // ⁖
+    { 20, 7, 19, 0, 18, 35, 42830 }, // ⁗
+    { 19, 20, 21, 1, 19, 95, 42865 }, // ⁘
+    { 19, 20, 21, 1, 19, 95, 43008 }, // ⁙
+    { 4, 20, 6, 1, 19, 20, 43103 }, // ⁚
+    { 15, 20, 16, 1, 19, 75, 43123 }, // ⁛
+    { 19, 20, 20, 0, 19, 95, 43198 }, // ⁜
+    { 4, 19, 7, 1, 18, 19, 43293 }, // ⁝
+    { 4, 20, 7, 1, 19, 20, 43312 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 43332 }, //  
+    { 0, 0, 15, 0, 0, 0, 43332 }, // ⁠
+    { 0, 0, 15, 0, 0, 0, 43332 }, // ⁡
+    { 0, 0, 15, 0, 0, 0, 43332 }, // ⁢
+    { 0, 0, 15, 0, 0, 0, 43332 }, // ⁣
+    { 0, 0, 15, 0, 0, 0, 43332 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 43332 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 43332 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 43332 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 43332 }, // ⁩
+    { 6, 22, 0, -3, 18, 33, 43332 }, // ⁪
+    { 6, 22, 0, -3, 18, 33, 43365 }, // ⁫
+    { 6, 22, 0, -3, 18, 33, 43398 }, // ⁬
+    { 6, 22, 0, -3, 18, 33, 43431 }, // ⁭
+    { 6, 22, 0, -3, 18, 33, 43464 }, // ⁮
+    { 6, 22, 0, -3, 18, 33, 43497 }, // ⁯
+    { 9, 12, 9, 0, 22, 27, 43530 }, // ⁰
+    { 2, 12, 4, 1, 19, 6, 43557 }, // ⁱ
+    { 9, 12, 9, 0, 22, 27, 43563 }, // ⁴
+    { 8, 12, 9, 0, 22, 24, 43590 }, // ⁵
+    { 9, 12, 9, 0, 22, 27, 43614 }, // ⁶
+    { 9, 12, 9, 0, 22, 27, 43641 }, // ⁷
+    { 9, 12, 9, 0, 22, 27, 43668 }, // ⁸
+    { 9, 12, 9, 0, 22, 27, 43695 }, // ⁹
+    { 8, 8, 8, 0, 19, 16, 43722 }, // ⁺
+    { 8, 2, 8, 0, 16, 4, 43738 }, // ⁻
+    { 8, 5, 8, 0, 17, 10, 43742 }, // ⁼
+    { 5, 14, 6, 1, 23, 18, 43752 }, // ⁽
+    { 5, 14, 6, 0, 23, 18, 43770 }, // ⁾
+    { 8, 9, 10, 1, 16, 18, 43788 }, // ⁿ
+    { 9, 12, 9, 0, 8, 27, 43806 }, // ₀
+    { 6, 12, 9, 0, 8, 18, 43833 }, // ₁
+    { 8, 12, 9, 0, 8, 24, 43851 }, // ₂
+    { 9, 12, 9, 0, 8, 27, 43875 }, // ₃
+    { 9, 12, 9, 0, 8, 27, 43902 }, // ₄
+    { 8, 12, 9, 0, 8, 24, 43929 }, // ₅
+    { 9, 12, 9, 0, 8, 27, 43953 }, // ₆
+    { 9, 12, 9, 0, 8, 27, 43980 }, // ₇
+    { 9, 12, 9, 0, 8, 27, 44007 }, // ₈
+    { 9, 12, 9, 0, 8, 27, 44034 }, // ₉
+    { 8, 8, 8, 0, 6, 16, 44061 }, // ₊
+    { 8, 2, 8, 0, 3, 4, 44077 }, // ₋
+    { 8, 5, 8, 0, 4, 10, 44081 }, // ₌
+    { 5, 14, 6, 1, 9, 18, 44091 }, // ₍
+    { 5, 14, 6, 0, 9, 18, 44109 }, // ₎
+    { 8, 9, 9, 0, 6, 18, 44127 }, // ₐ
+    { 9, 9, 9, 0, 6, 21, 44145 }, // ₑ
+    { 9, 9, 10, 0, 6, 21, 44166 }, // ₒ
+    { 9, 9, 9, 0, 6, 21, 44187 }, // ₓ
+    { 9, 9, 9, 0, 6, 21, 44208 }, // ₔ
+    { 8, 12, 10, 1, 9, 24, 44229 }, // ₕ
+    { 8, 12, 9, 1, 9, 24, 44253 }, // ₖ
+    { 2, 12, 4, 1, 9, 6, 44277 }, // ₗ
+    { 13, 9, 15, 1, 6, 30, 44283 }, // ₘ
+    { 8, 9, 10, 1, 6, 18, 44313 }, // ₙ
+    { 9, 12, 10, 1, 6, 27, 44331 }, // ₚ
+    { 8, 9, 8, 0, 6, 18, 44358 }, // ₛ
+    { 6, 11, 6, 0, 8, 17, 44376 }, // ₜ
+    { 14, 19, 14, 0, 19, 67, 44393 }, // ₠
+    { 13, 21, 14, 1, 19, 69, 44460 }, // ₡
+    { 13, 20, 14, 1, 19, 65, 44529 }, // ₢
+    { 12, 18, 14, 1, 18, 54, 44594 }, // ₣
+    { 14, 19, 14, 0, 19, 67, 44648 }, // ₤
+    { 20, 20, 23, 2, 17, 100, 44715 }, // ₥
+    { 15, 18, 14, 0, 18, 68, 44815 }, // ₦
+    { 18, 19, 19, 1, 18, 86, 44883 }, // ₧
+    { 18, 19, 21, 2, 18, 86, 44969 }, // ₨
+    { 17, 18, 17, 0, 18, 77, 45056 }, // ₩
+    { 16, 18, 20, 2, 18, 72, 45133 }, // ₪
+    { 15, 23, 15, 1, 19, 87, 45205 }, // ₫
+    { 14, 20, 14, 0, 19, 70, 45292 }, // €
+    { 15, 18, 14, 0, 18, 68, 45362 }, // ₭
+    { 14, 18, 14, 0, 18, 63, 45430 }, // ₮
+    { 24, 25, 24, 0, 19, 150, 45493 }, // ₯
+    { 13, 25, 14, 0, 19, 82, 45643 }, // ₰
+    { 15, 18, 14, 0, 18, 68, 45725 }, // ₱
+    { 16, 21, 18, 1, 19, 84, 45793 }, // ₲
+    { 16, 18, 15, 0, 18, 72, 45877 }, // ₳
+    { 14, 20, 14, 0, 19, 70, 45949 }, // ₴
+    { 15, 21, 16, 1, 19, 79, 46019 }, // ₵
+    { 15, 18, 16, 0, 17, 68, 46098 }, // ₶
+    { 17, 21, 18, 0, 19, 90, 46166 }, // ₷
+    { 14, 18, 14, 0, 18, 63, 46256 }, // ₸
+    { 12, 18, 14, 1, 18, 54, 46319 }, // ₹
+    { 14, 19, 14, 0, 18, 67, 46373 }, // ₺
+    { 20, 20, 20, 0, 19, 100, 46440 }, // ₻
+    { 18, 18, 20, 1, 18, 81, 46540 }, // ₼
+    { 14, 18, 15, 0, 18, 63, 46621 }, // ₽
+    { 17, 20, 19, 1, 20, 85, 46684 }, // ₾
+    { 12, 24, 14, 2, 21, 72, 46769 }, // ₿
+    { 10, 18, 12, 1, 14, 45, 46841 }, // ⃀
+    { 12, 3, 14, 1, 10, 9, 46886 }, // −
+    { 23, 23, 25, 1, 19, 133, 46895 }, // �
 };
 
 static const EpdUnicodeInterval notosans_12_regularIntervals[] = {
@@ -3804,4 +2613,9 @@ static const EpdFontData notosans_12_regular = {
     27,
     -8,
     true,
+    notosans_12_regularBlockOffsets,
+    notosans_12_regularDirectGlyphs,
+    notosans_12_regularGlyphPages,
+    256,
+    notosans_12_regularPageGlyphs,
 };
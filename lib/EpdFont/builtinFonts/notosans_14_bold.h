@@ -2,4304 +2,2264 @@
  * generated by fontconvert.py
  * name: notosans_14_bold
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py notosans_14_bold 14 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_14_bold 14 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_boldBitmaps[68654] = {
-    0x7F, 0xD7, 0xFE, 0x3F, 0xD3, 0xFD, 0x3F, 0xD3, 0xFD, 0x3F, 0xD3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F,
-    0xC3, 0xFC, 0x2F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFD, 0x7F, 0xE7, 0xFE, 0x3F, 0xC0,
-    0x50, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0x82, 0xFC, 0x3F, 0x82, 0xFC,
-    0x3F, 0x82, 0xFC, 0x2F, 0x42, 0xF8, 0x1A, 0x41, 0xA4, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x1F,
-    0xC1, 0xF8, 0x00, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0xFC,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0xC1,
-    0xF8, 0x00, 0x6A, 0xFF, 0xAF, 0xFA, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0x47, 0xF0, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x00, 0x2F,
-    0x82, 0xF4, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFA, 0xFD, 0x2F, 0xE2, 0xD0, 0x10, 0xBF, 0x8B, 0x40, 0x02, 0xFF,
-    0xAD, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x01, 0xBF,
-    0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x02, 0xD7, 0xFD, 0x00, 0x0B, 0x4F, 0xFA, 0x90, 0x2D, 0x3F,
-    0xDB, 0xFE, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0x40, 0x1A, 0xFF, 0x90, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xBF, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC3, 0xF4, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x3F,
-    0x00, 0x00, 0x3F, 0x42, 0xFC, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x2F, 0xC1, 0xFC, 0x00, 0x00, 0x3F,
-    0x42, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x3F, 0x87, 0xF0, 0x6E, 0x40, 0x2F, 0xC3, 0xF4, 0xFD,
-    0x3F, 0xFE, 0x01, 0xFF, 0xFF, 0x2F, 0xCB, 0xFF, 0xF4, 0x0B, 0xFF, 0xD3, 0xF4, 0xFE, 0x2F, 0xC0,
-    0x1F, 0xE0, 0xBF, 0x1F, 0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x0F, 0xD0, 0x00, 0x03, 0xF8,
-    0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0xFD,
-    0x00, 0x01, 0xFC, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x0F, 0xFB, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xF9, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x2F, 0xFF, 0xFC, 0x03, 0xFD, 0x0F, 0xFD, 0xFF, 0xC1, 0xFF, 0x0B, 0xFC, 0x0F, 0xFC, 0xFF, 0x83,
-    0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x2F, 0xF4, 0x00, 0xFF, 0xF0, 0x07,
-    0xFF, 0x96, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xEF, 0xFD, 0x00,
-    0x7F, 0xFF, 0x80, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF3, 0xFC, 0xFE, 0x3F,
-    0x8F, 0xE2, 0xF4, 0x69, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x0F, 0xE0, 0x0B,
-    0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x03, 0xF8, 0x00, 0xFF,
-    0x00, 0x2F, 0xD0, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x1A, 0x40, 0x2F,
-    0x80, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xBF, 0x40, 0x1F, 0xD0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x2F, 0xD0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0xFF,
-    0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x1F, 0x5B,
-    0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x05, 0x7F, 0xF9, 0x50, 0x00, 0xFF, 0xF0, 0x00,
-    0x0F, 0xEF, 0xE0, 0x00, 0xBF, 0x1F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xD0, 0x78, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x7F, 0x55, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x3F, 0xD0,
-    0xFF, 0x03, 0xF8, 0x1F, 0xD0, 0xBF, 0x03, 0xF8, 0x0F, 0xC0, 0x2A, 0xAA, 0x4F, 0xFF, 0xD3, 0xFF,
-    0xF4, 0xFF, 0xFD, 0x05, 0x03, 0xFD, 0x7F, 0xE7, 0xFE, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0xFF, 0x00,
-    0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F,
-    0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00,
-    0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F,
-    0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xF9, 0xFF,
-    0xD0, 0xFF, 0x40, 0xFF, 0x87, 0xFC, 0x01, 0xFF, 0x2F, 0xE0, 0x03, 0xFC, 0xFF, 0x80, 0x0F, 0xF7,
-    0xFD, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0xFF, 0xBF, 0xD0, 0x03, 0xFE, 0xFF, 0x40, 0x0F, 0xFB, 0xFD,
-    0x00, 0x3F, 0xEF, 0xF8, 0x00, 0xFF, 0x6F, 0xE0, 0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xF0, 0xFF, 0x40,
-    0xBF, 0xC2, 0xFF, 0x5B, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xFC, 0x02, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFC, 0x3F, 0xF7, 0xFC, 0x1F, 0xC7, 0xFC, 0x0A, 0x07, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFA, 0xFF, 0xF0, 0xBD, 0x00, 0xBF, 0xC0, 0x40, 0x01, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFF, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xE6, 0xFF, 0xE0, 0x20, 0x00, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x05, 0x5B, 0xFD, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF5, 0x00, 0x00, 0xBF, 0xDF, 0x94, 0x1B, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x41, 0xBF, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x02, 0xFE, 0xFE, 0x00, 0x01, 0xFC, 0xBF, 0x80,
-    0x00, 0xFE, 0x2F, 0xE0, 0x00, 0xBF, 0x0B, 0xF8, 0x00, 0x7F, 0x02, 0xFE, 0x00, 0x3F, 0x80, 0xBF,
-    0x80, 0x2F, 0xC0, 0x2F, 0xE0, 0x1F, 0xFA, 0xAF, 0xFE, 0x8B, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x6A, 0xAA, 0xBF, 0xFA, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x50, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFD, 0x02, 0x95, 0x7F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x03, 0xFC, 0x40, 0x00, 0x2F, 0xF2, 0xF9, 0x57, 0xFF, 0x8B, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0x95, 0x80, 0x7F, 0xD0,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x41, 0x94, 0x02, 0xFC, 0xBF, 0xFD,
-    0x0F, 0xFB, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xE0, 0x2F, 0xF7, 0xFE, 0x00, 0x3F, 0xEF,
-    0xF4, 0x00, 0xBF, 0xBF, 0xD0, 0x02, 0xFE, 0xBF, 0x80, 0x0B, 0xF9, 0xFF, 0x40, 0x3F, 0xD3, 0xFF,
-    0x57, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xF4, 0x3F, 0xE0, 0x7F, 0xF1, 0xFF, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0xFF,
-    0x0F, 0xF0, 0x0B, 0xF8, 0x2F, 0xF4, 0xBF, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xD2, 0xFF, 0x8B, 0xFC, 0x02, 0xFF, 0x3F, 0xD0,
-    0x02, 0xFE, 0xFF, 0x00, 0x07, 0xFB, 0xFD, 0x00, 0x2F, 0xEB, 0xFD, 0x02, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xE0, 0x1F, 0xFE, 0xBF,
-    0xF4, 0x2F, 0xF0, 0x0B, 0xFC, 0x3F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xFD, 0x3F, 0xC0, 0x03,
-    0xFE, 0x3F, 0xD0, 0x03, 0xFE, 0x3F, 0xF0, 0x0B, 0xFE, 0x1F, 0xFE, 0xBF, 0xFE, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xF6, 0xFD, 0x00, 0x6E, 0x82, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0x05, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xE7, 0xFE, 0x3F,
-    0xD0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFD, 0x7F, 0xE7,
-    0xFE, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x2F, 0xC1, 0xFF, 0x87, 0xFE, 0x0F, 0xF4, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0xFF, 0x43, 0xFC,
-    0x0F, 0xE0, 0x7F, 0x42, 0xFC, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xF9, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA3, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xFF, 0x5A, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x06, 0xFF, 0xD0, 0x01, 0xFF, 0xF9, 0x00, 0xBF, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0x03,
-    0xFF, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0xA6, 0xFF,
-    0xC1, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFE, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xAF,
-    0xFF, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0,
-    0x05, 0xA9, 0x02, 0xFC, 0x1F, 0xC0, 0x3F, 0xFF, 0xE0, 0xFC, 0x2F, 0x81, 0xFF, 0xFF, 0xE0, 0xBD,
-    0x3F, 0x03, 0xFD, 0x0B, 0xE0, 0x7E, 0x7F, 0x07, 0xF0, 0x0B, 0xE0, 0x7F, 0x7E, 0x0B, 0xE0, 0x0B,
-    0xE0, 0x7F, 0xBE, 0x0F, 0xD0, 0x0F, 0xE0, 0x7F, 0xBE, 0x0F, 0xD0, 0x0F, 0xD0, 0x7E, 0xBE, 0x0F,
-    0xE0, 0x0F, 0xD0, 0xFD, 0x7E, 0x0B, 0xF0, 0x2F, 0xE1, 0xFC, 0x7F, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x3F, 0x41, 0xFF, 0xF4, 0xFF, 0xE0, 0x2F, 0xC0, 0x2A, 0x80, 0x2A, 0x40, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xE5, 0x5B, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00,
-    0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x03,
-    0xFF, 0xAA, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE,
-    0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x7F,
-    0xFF, 0xE9, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xEA, 0xBF, 0xFC, 0xBF,
-    0xC0, 0x0B, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x0B, 0xFC, 0xBF,
-    0xD5, 0xBF, 0xF4, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x90, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xC0, 0x0B, 0xFD, 0xBF, 0xC0, 0x03, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFF, 0xBF,
-    0xC0, 0x07, 0xFE, 0xBF, 0xEA, 0xBF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xEA, 0xFF, 0x03, 0xFF, 0x80, 0x01, 0x41, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x40,
-    0xBF, 0xFE, 0x5B, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xFF,
-    0x40, 0x00, 0x01, 0x50, 0x00, 0x7F, 0xFF, 0xE9, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xC0, 0x0B, 0xFF, 0x4B, 0xFC, 0x00, 0x1F, 0xFC,
-    0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFF, 0xBF, 0xC0, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x1F, 0xFC, 0xBF, 0xC0, 0x0B,
-    0xFF, 0x4B, 0xFE, 0xAF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA,
-    0xAA, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x00, 0x1F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFA, 0xAA, 0x97, 0xFF,
-    0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFD, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFA, 0xBF, 0xC0, 0xFF, 0xF4, 0x00, 0x14, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x1A, 0xAA, 0xA7,
-    0xFD, 0x01, 0xFF, 0xFF, 0x7F, 0xD0, 0x1F, 0xFF, 0xF3, 0xFD, 0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x00,
-    0x2F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x0B,
-    0xFF, 0xE5, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF,
-    0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F,
-    0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02,
-    0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xEA, 0xAA, 0xBF, 0xE7, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xC0, 0x00, 0x2F,
-    0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0,
-    0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE,
-    0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x41, 0xFF, 0xE0,
-    0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC,
-    0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x00,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC,
-    0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x0A, 0xBF,
-    0xF4, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0xC7, 0xFC, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x07, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x7F, 0xC0,
-    0x3F, 0xF0, 0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x7F, 0xC2, 0xFF, 0x40, 0x07, 0xFC, 0x7F, 0xE0, 0x00,
-    0x7F, 0xCF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0x07, 0xFD, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0xBF, 0xD0, 0x07,
-    0xFC, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x03,
-    0xFF, 0x07, 0xFC, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFE, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xF9, 0xFF, 0xF0, 0x00, 0x02, 0xFF,
-    0xF7, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFF, 0x00, 0x02,
-    0xFF, 0xFD, 0xFE, 0xFD, 0x00, 0x0F, 0xEF, 0xF7, 0xF7, 0xF8, 0x00, 0x3F, 0x7F, 0xDF, 0xDB, 0xF0,
-    0x02, 0xFC, 0xFF, 0x7F, 0x5F, 0xC0, 0x0F, 0xE3, 0xFD, 0xFE, 0x3F, 0x80, 0x3F, 0x4F, 0xF7, 0xF8,
-    0xFF, 0x02, 0xFC, 0x3F, 0xDF, 0xE1, 0xFC, 0x0F, 0xE0, 0xFF, 0x7F, 0x83, 0xF4, 0x3F, 0x43, 0xFD,
-    0xFE, 0x0F, 0xF1, 0xFC, 0x0F, 0xF7, 0xF8, 0x2F, 0xCF, 0xE0, 0x3F, 0xDF, 0xE0, 0x7F, 0xBF, 0x40,
-    0xFF, 0x7F, 0x80, 0xFF, 0xFC, 0x03, 0xFD, 0xFE, 0x02, 0xFF, 0xE0, 0x0F, 0xF7, 0xF8, 0x07, 0xFF,
-    0x40, 0x3F, 0xDF, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0x7F, 0x80, 0x2F, 0xE0, 0x03, 0xFC, 0x7F, 0xF4,
-    0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00,
-    0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0, 0x03,
-    0xFC, 0x7F, 0x5F, 0xF4, 0x03, 0xFC, 0x7F, 0x4B, 0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03, 0xFC,
-    0x7F, 0x82, 0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF, 0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC, 0x7F,
-    0x80, 0x3F, 0xF3, 0xFC, 0x7F, 0x80, 0x1F, 0xF6, 0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F, 0x80,
-    0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00,
-    0x7F, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA, 0xFF,
-    0xF8, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F,
-    0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x07, 0xFE,
-    0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0xBF, 0xFE, 0x6F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x7F, 0xFF, 0xE4, 0x02, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0xBF, 0xEF, 0xF0, 0x02, 0xFF, 0xBF, 0xC0,
-    0x0F, 0xFA, 0xFF, 0x01, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFE,
-    0x02, 0xFF, 0xAA, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x02, 0xFF,
-    0x80, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x1F, 0xF4,
-    0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0,
-    0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0xBF, 0xFE,
-    0x6F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x7F, 0xFF, 0xA4,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFE, 0xAF, 0xFF, 0x40, 0xBF,
-    0xC0, 0x1F, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF,
-    0xC0, 0xBF, 0xC0, 0x0F, 0xF8, 0x0B, 0xFD, 0x5B, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFC, 0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0xBF, 0xC0,
-    0x0B, 0xFC, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xC0,
-    0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFD, 0x3F, 0xFA, 0xBF, 0xC7, 0xFD, 0x00,
-    0x14, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFA, 0x00, 0x02, 0xFF, 0xBF, 0x95, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xDB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFD, 0x00, 0x07, 0xFD, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC2, 0xFF, 0xE5, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xFA, 0xFF,
-    0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x3F, 0xD0,
-    0x03, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x3F, 0xD0, 0x00, 0x3F,
-    0xC0, 0xFF, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x01, 0xFE, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0xFF,
-    0x00, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x2F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x2F,
-    0xFC, 0x00, 0x2F, 0xE0, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x03, 0xFF, 0xD0,
-    0x03, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0xBF, 0x00, 0xBF,
-    0x80, 0x3F, 0xC0, 0x3F, 0xAF, 0xC0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xD7, 0xF4, 0x0F, 0xF0, 0x02,
-    0xFE, 0x07, 0xF4, 0xFE, 0x07, 0xFC, 0x00, 0x7F, 0xC2, 0xFC, 0x3F, 0xC2, 0xFE, 0x00, 0x0F, 0xF0,
-    0xFF, 0x0B, 0xF0, 0xFF, 0x40, 0x03, 0xFC, 0x3F, 0x81, 0xFD, 0x3F, 0xC0, 0x00, 0xBF, 0x5F, 0xD0,
-    0x3F, 0x8F, 0xF0, 0x00, 0x1F, 0xEB, 0xF0, 0x0F, 0xF7, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x02, 0xFE,
-    0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x2F, 0xF4, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x02, 0xFF, 0x00,
-    0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xCB,
-    0xFC, 0x00, 0x01, 0xFF, 0x43, 0xFE, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xFF,
-    0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0xBF, 0xD0, 0x00, 0x0F, 0xFC,
-    0xBF, 0xC0, 0x00, 0x2F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x0B, 0xFC, 0x03, 0xFD,
-    0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0xBF,
-    0xC0, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xAA,
-    0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F,
-    0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
-    0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0x7F, 0xFF, 0xFF, 0xFE, 0xAA, 0xA0, 0xBF, 0x40, 0x00, 0x7F,
-    0x80, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8,
-    0x00, 0x03, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x7F, 0xFE, 0x7F, 0xFE, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
-    0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
-    0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x15, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE,
-    0x2A, 0xA9, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x0F, 0xC3, 0xF4, 0x00,
-    0x0B, 0xE0, 0x7F, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x3F,
-    0x40, 0x7F, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0xFD, 0x0A, 0x80, 0x00, 0x1A, 0x80, 0x15, 0x55,
-    0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x55, 0x40, 0x1F, 0xF8, 0x00, 0xFF, 0x40,
-    0x0F, 0xF4, 0x00, 0xBF, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0x90, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x40, 0x1B, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFE, 0xBF, 0xDB, 0xFD, 0x00, 0xFF,
-    0x7F, 0xF0, 0x03, 0xFD, 0xFF, 0x80, 0x1F, 0xF6, 0xFF, 0x41, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFD, 0xFD, 0x0B, 0xFF, 0x83, 0xF4, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x8B, 0xFE, 0x00, 0xFF, 0xBF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xF5, 0x7F, 0xF4, 0xFF, 0xC0, 0x0F, 0xF8, 0xFF, 0xC0, 0x0B, 0xFC, 0xFF,
-    0x80, 0x0B, 0xFC, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF,
-    0xC0, 0x0B, 0xFC, 0xFF, 0xC0, 0x0F, 0xF8, 0xFF, 0xF5, 0x7F, 0xF4, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
-    0x7F, 0xFF, 0xC0, 0xFE, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0xD3, 0xFD, 0x0B, 0xFF, 0xF7, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xF9, 0x6F, 0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0,
-    0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0,
-    0x03, 0xFD, 0x3F, 0xE0, 0x07, 0xFD, 0x3F, 0xF9, 0x6F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xF6, 0xFD, 0x02, 0xFF, 0xD1, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0,
-    0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x03,
-    0xFF, 0x05, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFF, 0x01, 0x7F, 0xE5, 0x40, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00,
-    0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD1, 0xFD, 0x0B, 0xFF, 0xFA, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF9, 0x6F,
-    0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03,
-    0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x07,
-    0xFD, 0x3F, 0xF8, 0x1F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFB, 0xFD, 0x02, 0xFF, 0xD3,
-    0xFD, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x10, 0x00, 0x0F, 0xFC, 0x2F, 0xA5, 0xBF,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0xD0, 0xFF, 0x7F, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0x97, 0xFF, 0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFD, 0x3F, 0xE3, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-    0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F,
-    0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xF8, 0x03, 0xFE,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8,
-    0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0,
-    0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80,
-    0x3F, 0xD6, 0xBF, 0xF6, 0xFF, 0xFC, 0xBF, 0xFD, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xF4, 0xBF, 0x80, 0x2F,
-    0xF4, 0x2F, 0xE0, 0x1F, 0xF4, 0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFE, 0x1F, 0xF8, 0x00, 0xBF, 0x8F,
-    0xF8, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x0B, 0xF8, 0x0F, 0xF8, 0x02, 0xFE, 0x01, 0xFF, 0x40,
-    0xBF, 0x80, 0x2F, 0xF0, 0x2F, 0xE0, 0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xEF,
-    0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB,
-    0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x82, 0xFF, 0xD0, 0x7F, 0xFC, 0x0F, 0xF7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xF5, 0x7F, 0xFF, 0x57, 0xFF, 0x3F, 0xF4, 0x07, 0xFF, 0x00, 0x7F, 0xDF,
-    0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xF7, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0xFF, 0x80, 0x0F, 0xF4,
-    0x00, 0xFF, 0x7F, 0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF7, 0xFE,
-    0x00, 0x3F, 0xD0, 0x03, 0xFD, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x7F, 0xE0, 0x03, 0xFD, 0x00,
-    0x3F, 0xDF, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF7, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0xFF, 0x80,
-    0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xFD, 0x0F, 0xF3, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFD, 0xFF, 0xF9, 0x7F, 0xFB, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0,
-    0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03,
-    0xFE, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03,
-    0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x0B, 0xFE, 0x00, 0xFF, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xF5, 0x7F,
-    0xF4, 0xFF, 0xC0, 0x0F, 0xF8, 0xFF, 0xC0, 0x0B, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0x80, 0x07,
-    0xFC, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0xC0, 0x0B, 0xFC, 0xFF, 0xC0, 0x0F,
-    0xF8, 0xFF, 0xF5, 0x7F, 0xF4, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xBF, 0xFF, 0xC0, 0xFF, 0x4F, 0xFE,
-    0x00, 0xFF, 0x80, 0x50, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD1, 0xFD, 0x0B, 0xFF, 0xFA, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF9, 0x6F,
-    0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03,
-    0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x07,
-    0xFD, 0x3F, 0xF8, 0x1F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xFD, 0x02, 0xFF, 0xD3,
-    0xFD, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03,
-    0xF8, 0x2F, 0xEF, 0xF2, 0xFF, 0xBF, 0xEF, 0xFD, 0xFF, 0xFF, 0xF7, 0xFF, 0xD0, 0x0F, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFE, 0x42, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF8, 0xBF, 0x80, 0x1C, 0x2F, 0xE0, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xF0,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x6D, 0x00, 0x7F, 0xDB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x1B, 0xFD, 0x54, 0x07,
-    0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x45, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFE, 0x00, 0x01, 0x40, 0xFF, 0x40, 0x0B, 0xFB, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xBF, 0xE5, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x7F, 0xC2, 0xFF,
-    0xF0, 0xBF, 0x00, 0x10, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x7F, 0xC3, 0xFD,
-    0x00, 0x2F, 0xE0, 0xBF, 0x80, 0x0F, 0xF4, 0x1F, 0xF0, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00,
-    0xBF, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x03, 0xFD, 0x2F, 0xD0, 0x00, 0x7F, 0x8F, 0xF0,
-    0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x02, 0xFE, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x0F, 0xFC, 0x00, 0xBF,
-    0x5F, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0xD3, 0xFC, 0x02, 0xFF, 0xE0, 0x0F, 0xF0, 0xBF, 0x80, 0xFF,
-    0xFC, 0x07, 0xF8, 0x1F, 0xF0, 0x3F, 0x7F, 0x03, 0xFD, 0x03, 0xFC, 0x1F, 0xCF, 0xC0, 0xFF, 0x00,
-    0xFF, 0x4B, 0xE3, 0xF4, 0x7F, 0xC0, 0x2F, 0xE3, 0xF4, 0xBE, 0x2F, 0xE0, 0x07, 0xFC, 0xFC, 0x1F,
-    0xCF, 0xF4, 0x00, 0xFF, 0x3F, 0x03, 0xF3, 0xFC, 0x00, 0x3F, 0xDF, 0xC0, 0xFD, 0xFE, 0x00, 0x07,
-    0xFB, 0xE0, 0x2F, 0xBF, 0x40, 0x00, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0x0B, 0xFC, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0xF4, 0xBF, 0xC0, 0x02,
-    0xFF, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0xFF,
-    0x80, 0x0B, 0xFC, 0x1F, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xE2, 0xFF, 0x40,
-    0x0B, 0xFD, 0xFF, 0x80, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x2F, 0xF0, 0xBF,
-    0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0xFF, 0x00,
-    0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x0F, 0xF7, 0xF8,
-    0x00, 0x01, 0xFE, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0xAB, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03,
-    0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xC1, 0x55,
-    0x5F, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF9,
-    0x55, 0x43, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0xF4, 0x00,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x40, 0x3F, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x1F, 0xFF, 0x00, 0xBF, 0xE0, 0x02,
-    0xFF, 0xD0, 0x06, 0xFF, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0x3F,
-    0xF4, 0x00, 0x06, 0x80, 0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
-    0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
-    0xBE, 0x69, 0xBA, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x1B, 0xFD, 0x00, 0x0B, 0xF4, 0x00,
-    0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0,
-    0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xF0, 0x02, 0xFF, 0xC0, 0x3F, 0xFE, 0x01, 0xFF, 0x00, 0x07, 0xF4,
-    0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xD0, 0x0B, 0xFF,
-    0x40, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x02, 0x94, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x01, 0xFF, 0xFE,
-    0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0x7E, 0x6B, 0xFF, 0xFD, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x83, 0xFD, 0x7F, 0xE3, 0xFD, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xA8, 0x2F, 0xC2, 0xFC,
-    0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFD, 0x3F, 0xD3, 0xFD, 0x3F, 0xD7, 0xFE, 0x7F,
-    0xE1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xBF, 0xE4, 0x07,
-    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xD3, 0xFF, 0xEB, 0xF1, 0xFF, 0x80, 0x04, 0xBF, 0xC0, 0x00, 0x3F,
-    0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0B,
-    0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x19, 0x3F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xF0,
-    0x00, 0x7F, 0x50, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x9A,
-    0xE0, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x5B, 0xFD, 0x55, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0x40, 0xAF, 0xFE, 0xAA,
-    0x40, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x08, 0x00, 0x02, 0x43, 0xF6, 0xFD, 0xBD, 0x3F, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x7F, 0x41, 0xFC, 0x01, 0xF8, 0x1F, 0x80, 0x0F, 0xC1, 0xF8, 0x00,
-    0xFC, 0x0F, 0xD0, 0x3F, 0x80, 0xFF, 0xEF, 0xF4, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x1E,
-    0x05, 0x03, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0xBF, 0xC2, 0xFE,
-    0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0B, 0xF4, 0x0F, 0xF4, 0x00, 0xFF, 0x07, 0xFC, 0x00,
-    0x2F, 0xD2, 0xFD, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x57, 0xFE,
-    0x54, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0A, 0xBF, 0xFA, 0x80, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x69, 0x00, 0x15,
-    0x00, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x3F, 0xD5, 0xFC, 0x7F, 0x00, 0x04, 0x3F, 0x80, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x40, 0x0F, 0xFF, 0xF0, 0x2F, 0xDF, 0xFC, 0x3F, 0x01, 0xFD, 0x7F,
-    0x00, 0xBE, 0x3F, 0x40, 0xBE, 0x3F, 0xE0, 0xFE, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x50, 0x00, 0xFE, 0x7E, 0x57, 0xFD, 0x7F, 0xFF, 0xF8,
-    0x2F, 0xFF, 0xD0, 0x00, 0x54, 0x00, 0x2F, 0x01, 0xF5, 0xFE, 0x0F, 0xF7, 0xF8, 0x3F, 0xCB, 0x80,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0xFF,
-    0x80, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0xB8, 0x06, 0xFF,
-    0x82, 0xF0, 0x1F, 0x01, 0xFF, 0xFC, 0x0B, 0x83, 0xD0, 0x7E, 0x01, 0x40, 0x3C, 0x3C, 0x0F, 0xC0,
-    0x00, 0x02, 0xD7, 0x80, 0xF4, 0x00, 0x00, 0x1E, 0xB4, 0x1F, 0x00, 0x00, 0x01, 0xFB, 0x41, 0xF0,
-    0x00, 0x00, 0x0F, 0xB4, 0x1F, 0x00, 0x00, 0x01, 0xF7, 0x80, 0xF4, 0x00, 0x00, 0x1E, 0x3C, 0x0F,
-    0x80, 0x00, 0x02, 0xD3, 0xC0, 0x7D, 0x00, 0x00, 0x3C, 0x2F, 0x03, 0xFF, 0xFC, 0x0B, 0xC0, 0xF4,
-    0x0B, 0xFF, 0x81, 0xF0, 0x07, 0xE0, 0x01, 0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x1F, 0xFF, 0xD0, 0xE4, 0xBE, 0x00, 0x03, 0xF0, 0xBF, 0xFF, 0x3F,
-    0xEB, 0xF3, 0xF0, 0x3F, 0x3F, 0x0B, 0xF3, 0xFF, 0xFF, 0x1F, 0xF5, 0xF0, 0x14, 0x00, 0x00, 0x10,
-    0x00, 0x40, 0x00, 0xBE, 0x01, 0xF8, 0x01, 0xFF, 0x03, 0xFD, 0x03, 0xFD, 0x0F, 0xF8, 0x0F, 0xF8,
-    0x2F, 0xF0, 0x3F, 0xF0, 0xBF, 0xC0, 0xBF, 0xC1, 0xFF, 0x00, 0xBF, 0xC1, 0xFF, 0x00, 0x3F, 0xF0,
-    0xBF, 0xC0, 0x0F, 0xF8, 0x3F, 0xF0, 0x03, 0xFD, 0x0F, 0xF8, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0xBE,
-    0x01, 0xF8, 0x00, 0x10, 0x00, 0x40, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0x45, 0x55, 0x55, 0xFD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0x50, 0x2A, 0xAA, 0x4F, 0xFF, 0xD3, 0xFF, 0xF4, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0xFF,
-    0x80, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0xB8, 0x3F, 0xFD,
-    0x02, 0xF0, 0x1F, 0x03, 0xFF, 0xF8, 0x0B, 0x83, 0xD0, 0x3D, 0x0B, 0xD0, 0x3C, 0x3C, 0x03, 0xD0,
-    0x3D, 0x02, 0xD7, 0x80, 0x3D, 0x03, 0xD0, 0x1E, 0xB4, 0x03, 0xD0, 0xBC, 0x01, 0xFB, 0x40, 0x3F,
-    0xFF, 0x40, 0x0F, 0xB4, 0x03, 0xFF, 0xD0, 0x01, 0xF7, 0x80, 0x3D, 0x2F, 0x00, 0x1E, 0x3C, 0x03,
-    0xD0, 0xF8, 0x02, 0xD3, 0xC0, 0x3D, 0x07, 0xC0, 0x3C, 0x2F, 0x03, 0xD0, 0x3E, 0x0B, 0xC0, 0xF4,
-    0x3D, 0x01, 0xF5, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0xFC, 0x1F, 0xEB, 0xF8, 0xBD, 0x03, 0xF3, 0xF0, 0x0B,
-    0xCF, 0xC0, 0x2F, 0x2F, 0x81, 0xFC, 0x3F, 0xFF, 0xD0, 0x7F, 0xFE, 0x00, 0x1A, 0x80, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x0A, 0xAB, 0xFE, 0xAA, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xF5, 0x55, 0xBF, 0x55, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFE, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0xD0, 0xD0,
-    0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00,
-    0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF0, 0x06, 0xFE, 0x00, 0xFF, 0xFF, 0x02, 0xFA, 0xFE,
-    0x01, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x0A, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xAB, 0xF8, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC3, 0xE6, 0xFF, 0x0F, 0xFF, 0xF4, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0xBF, 0x80, 0x7F, 0x40, 0x15, 0x00, 0x00, 0xFF, 0x40, 0x07,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF5, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xEF, 0xF4, 0xBF, 0xFF, 0x45, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x2F, 0xFF, 0xFD, 0x7E, 0x3F, 0xFF, 0xF8, 0x3E, 0x3F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E,
-    0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E,
-    0x3F, 0xFF, 0xF8, 0x3E, 0x2F, 0xFF, 0xF8, 0x3E, 0x0F, 0xFF, 0xF8, 0x3E, 0x02, 0xFF, 0xF8, 0x3E,
-    0x00, 0x04, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E,
-    0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E,
-    0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0x64, 0x29,
-    0x05, 0x03, 0xFD, 0x7F, 0xE7, 0xFE, 0x3F, 0xC0, 0x50, 0x0B, 0xC0, 0x0F, 0xE0, 0x07, 0xFC, 0x00,
-    0xFC, 0x56, 0xFC, 0x7F, 0xF8, 0x7F, 0xD0, 0x00, 0x2A, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0xBF, 0xFC,
-    0x2F, 0x7F, 0x02, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0xFD, 0x0B, 0xE6, 0xFC,
-    0x3F, 0x02, 0xF4, 0xF8, 0x0B, 0xD3, 0xE0, 0x1F, 0x4F, 0xC0, 0xBD, 0x3F, 0x47, 0xF0, 0x3F, 0xFF,
-    0x80, 0x7F, 0xF4, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0xBF, 0xC1,
-    0xFF, 0x40, 0x2F, 0xF0, 0x7F, 0xC0, 0x0F, 0xF8, 0x2F, 0xF0, 0x03, 0xFD, 0x0F, 0xF8, 0x01, 0xFF,
-    0x43, 0xFE, 0x01, 0xFF, 0x43, 0xFE, 0x03, 0xFD, 0x0F, 0xF8, 0x0F, 0xF8, 0x2F, 0xF0, 0x2F, 0xF0,
-    0x7F, 0xC0, 0xBF, 0xC1, 0xFF, 0x40, 0x2F, 0x00, 0xBD, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0xFE, 0x00, 0x0B, 0xE0, 0x00, 0x2D, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE,
-    0x02, 0xFC, 0x02, 0xA0, 0x00, 0xBE, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0xBE, 0x0B, 0xF0, 0x2F, 0xF0,
-    0x00, 0xBE, 0x0F, 0xC0, 0x3F, 0xF0, 0x00, 0x69, 0x2F, 0x80, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x02,
-    0xF3, 0xF0, 0x00, 0x00, 0xFE, 0x03, 0xD3, 0xF0, 0x00, 0x01, 0xFC, 0x0F, 0x83, 0xF0, 0x00, 0x03,
-    0xF4, 0x2F, 0xAB, 0xFA, 0x00, 0x0B, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0x2F, 0xFF, 0xFF,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x2F, 0x80, 0x00, 0x2D, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xE0,
-    0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBE,
-    0x02, 0xFC, 0x1B, 0xA0, 0x00, 0x2F, 0x80, 0xFD, 0x7F, 0xFF, 0x40, 0x0B, 0xE0, 0xBF, 0x2F, 0xFF,
-    0xF0, 0x02, 0xF8, 0x3F, 0x02, 0x82, 0xFC, 0x00, 0x69, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0xFF, 0x40, 0x02,
-    0xFC, 0x00, 0x3E, 0x6F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x1F,
-    0x80, 0x1F, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0x00, 0x00,
-    0x05, 0x7F, 0x80, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x0A, 0x90, 0x40, 0x0F, 0xD3, 0xF4,
-    0x1F, 0xE0, 0xBE, 0xBF, 0xCB, 0xF0, 0x3F, 0xE0, 0xBF, 0xFF, 0x4F, 0xD0, 0xFF, 0xE0, 0x1B, 0xF8,
-    0x2F, 0x81, 0xFB, 0xE0, 0x00, 0x00, 0x7F, 0x03, 0xDF, 0xE0, 0x00, 0x00, 0xFE, 0x0F, 0x8F, 0xE0,
-    0x00, 0x01, 0xFC, 0x1F, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x3F, 0xAF, 0xF8, 0x00, 0x07, 0xF0, 0x3F,
-    0xFF, 0xFD, 0x00, 0x0F, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x10, 0x3F, 0xF5, 0x6F, 0xC3, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00,
-    0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F, 0xFE, 0xAB, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF,
-    0x47, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xE0, 0x00,
-    0x00, 0x7F, 0x41, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00,
-    0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F,
-    0xFE, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xC0, 0x00, 0x02, 0xFF, 0xFB, 0xF0, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0xBC, 0x1F, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0xE7,
-    0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x07,
-    0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0B,
-    0xFC, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xC0,
-    0x00, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x9F, 0xE0, 0x00,
-    0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00,
-    0x03, 0xFD, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00,
-    0x3F, 0xFA, 0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x3F,
-    0xE0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x00,
-    0x1E, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFE, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC3, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x07, 0xFC,
-    0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xEA, 0xBF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x00,
-    0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00,
-    0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x1F, 0xFA, 0xAA, 0x90, 0x00, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xEA, 0xBF, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xEA,
-    0xAA, 0x83, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x07,
-    0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xEA, 0xFF, 0x03, 0xFF, 0x80, 0x01, 0x41,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x40, 0xBF, 0xFE, 0x5B, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x06, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x16, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F,
-    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1,
-    0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x7F, 0xEA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x55,
-    0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
-    0xF5, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA,
-    0xA8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x5F, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x00, 0x15, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F,
-    0xFF, 0x40, 0x3F, 0xCB, 0xF0, 0x2F, 0xC0, 0xBF, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFE, 0x0B, 0xC0, 0xBD, 0x07, 0xF8, 0x3F, 0xC1, 0xFD, 0x0F, 0xF0, 0x2E, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0x9F, 0xFF, 0xFF, 0xD7, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00,
-    0x07, 0xFE, 0xAA, 0xA1, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA,
-    0xA9, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x15, 0x40, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x00, 0x05, 0x54, 0x00, 0xBF, 0xD0, 0x07, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x00, 0x55, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x3F,
-    0xCF, 0xF0, 0x3F, 0x80, 0xBF, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00,
-    0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF4,
-    0x2E, 0x02, 0xF1, 0xFD, 0x0F, 0xE7, 0xF4, 0x3F, 0x8B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x1F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFE, 0x80, 0x00,
-    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFC, 0x00, 0xBF, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x07, 0xFC,
-    0x00, 0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0x7F, 0xFF, 0xFC,
-    0x03, 0xFF, 0x7F, 0xFF, 0xFC, 0x03, 0xFE, 0x2B, 0xFE, 0xA4, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0x07,
-    0xFD, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xF4,
-    0x07, 0xFE, 0xAF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0x00, 0x00, 0x3F,
-    0xFE, 0xBE, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0x50, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03,
-    0xFC, 0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC,
-    0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0, 0x03, 0xFC, 0x7F, 0x5F, 0xF4, 0x03, 0xFC, 0x7F,
-    0x4B, 0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03, 0xFC, 0x7F, 0x82, 0xFF, 0x03, 0xFC, 0x7F, 0x80,
-    0xFF, 0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC, 0x7F, 0x80, 0x3F, 0xF3, 0xFC, 0x7F, 0x80, 0x1F,
-    0xF6, 0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F, 0x80, 0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFF,
-    0xFC, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x7F, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F,
-    0xF8, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF,
-    0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD,
-    0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF,
-    0xE6, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE,
-    0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00,
-    0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00,
-    0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00,
-    0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x05, 0x40, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F,
-    0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F,
-    0xF1, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0,
-    0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x02, 0xE0, 0x00, 0x01, 0xFF, 0xFA, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x3D, 0x0B, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFE, 0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F,
-    0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF,
-    0x40, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC2, 0xFF,
-    0x40, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x02,
-    0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xBF, 0xFE, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0,
-    0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC7, 0xFD, 0x00,
-    0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00,
-    0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x2F, 0xFF, 0x9B,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x05, 0x00, 0x02, 0x01, 0xF4, 0x00, 0xBC, 0x3F, 0xD0,
-    0x2F, 0xE0, 0xFF, 0x4B, 0xF8, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00,
-    0x0B, 0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0x8F, 0xF4, 0x2F, 0xE0, 0x3F, 0xD2, 0xF8, 0x00,
-    0xFD, 0x0A, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x02, 0xFF,
-    0xFE, 0x7E, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA,
-    0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0x02, 0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFC, 0x3F, 0xE0, 0x03, 0xF6, 0xFF, 0x1F, 0xF4, 0x02, 0xF8, 0x7F, 0xD7, 0xFD, 0x01, 0xFC,
-    0x1F, 0xF5, 0xFF, 0x40, 0xFD, 0x07, 0xFD, 0x7F, 0xD0, 0xBE, 0x01, 0xFF, 0x5F, 0xF4, 0x7F, 0x00,
-    0x7F, 0xD3, 0xFE, 0x3F, 0x40, 0x2F, 0xF0, 0xFF, 0xEF, 0x80, 0x0F, 0xFC, 0x2F, 0xFF, 0xC0, 0x07,
-    0xFE, 0x03, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0xBF, 0xFE, 0x6F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFA, 0xFF, 0xFE, 0x40, 0x00, 0x2C, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC,
-    0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00,
-    0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF,
-    0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03,
-    0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC,
-    0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F,
-    0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0B, 0xF6, 0xFD, 0x00, 0x02, 0xFC,
-    0x07, 0xF4, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F,
-    0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0xBC, 0x07, 0xD0, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x07, 0xC0, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xDB, 0xFC,
-    0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFD, 0x00,
-    0x07, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC2, 0xFF, 0xE5, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0x0F,
-    0xF4, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x2F, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFA, 0xA4,
-    0x00, 0x7F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0x0B, 0xFE,
-    0x7F, 0xC0, 0x0F, 0xFD, 0xFF, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x7F, 0xDF, 0xF0, 0x02, 0xFF, 0x7F,
-    0xC0, 0x2F, 0xF9, 0xFF, 0xAF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xE4, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xF4, 0x1F, 0xFD, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x03, 0xFD,
-    0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x2F, 0xF4, 0x0F, 0xF8, 0x0F, 0xFD, 0x00, 0xFF, 0x82,
-    0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0xFF, 0x83, 0xFF, 0x80, 0x0F, 0xF8, 0x1F, 0xFF, 0x40,
-    0xFF, 0x80, 0x7F, 0xFE, 0x0F, 0xF8, 0x00, 0xFF, 0xF8, 0xFF, 0x80, 0x01, 0xFF, 0xCF, 0xF8, 0x00,
-    0x07, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xDF, 0xF8, 0x60, 0x0B, 0xFD, 0xFF, 0x87, 0xFF, 0xFF, 0xCF,
-    0xF8, 0x7F, 0xFF, 0xF4, 0xFF, 0x83, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xBF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB, 0xFD, 0xBF, 0xD0, 0x0F, 0xF7, 0xFF, 0x00, 0x3F,
-    0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xDF, 0xD0,
-    0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xEB, 0xFD, 0xBF, 0xD0, 0x0F, 0xF7, 0xFF, 0x00, 0x3F, 0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4,
-    0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xDF, 0xD0, 0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xBF, 0x6F, 0xD0,
-    0x0B, 0xF0, 0x2F, 0xC0, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0xF4, 0x01, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB, 0xFD, 0xBF, 0xD0, 0x0F,
-    0xF7, 0xFF, 0x00, 0x3F, 0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xDF, 0xD0, 0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x0B, 0xC0, 0x3F, 0xFE, 0xBE, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0x81, 0xFF, 0x40, 0x14, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xBF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB, 0xFD, 0xBF, 0xD0, 0x0F, 0xF7, 0xFF, 0x00, 0x3F, 0xDF, 0xF8,
-    0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xDF, 0xD0, 0xBF, 0xF8,
-    0x3F, 0x40, 0x14, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0x40, 0x1F, 0xE0, 0xFF, 0x00, 0x7F, 0x83, 0xFC,
-    0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x03,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x0E, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x6F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFA, 0xFF, 0x6F, 0xF4, 0x03,
-    0xFD, 0xFF, 0xC0, 0x0F, 0xF7, 0xFE, 0x00, 0x7F, 0xDB, 0xFD, 0x07, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xF7, 0xF4, 0x2F, 0xFE, 0x0F, 0xD0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x3D, 0x0F, 0x40, 0x00, 0xF4, 0x3D, 0x00, 0x02,
-    0xFB, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0x90, 0x2F, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFE, 0xBF, 0xDB,
-    0xFD, 0x00, 0xFF, 0x7F, 0xF0, 0x03, 0xFD, 0xFF, 0x80, 0x1F, 0xF6, 0xFF, 0x41, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0xFD, 0x0B, 0xFF, 0x83, 0xF4, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x42, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0x80, 0x2F, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xF4, 0x06, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xAB, 0xFF, 0xFF, 0xFF, 0xEB, 0xFD, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x1F, 0xFF, 0xC0, 0x06, 0x87, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B,
-    0x03, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x05, 0x7F, 0xC0, 0x00, 0xBF, 0xF8, 0x00,
-    0x07, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F,
-    0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F,
-    0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x02,
-    0xFD, 0xBF, 0x40, 0x0B, 0xF0, 0x2F, 0xC0, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F,
-    0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x50, 0x00, 0x02, 0xF0, 0x1F, 0x40, 0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x02,
-    0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC, 0x7F,
-    0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x15,
-    0x50, 0x02, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
-    0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x01, 0x55, 0x00, 0xFF, 0x80, 0xFF, 0x80,
-    0xFF, 0x40, 0xBF, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F,
-    0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F,
-    0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0x8F, 0xF0, 0x3F, 0x80, 0xFF, 0x05, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x3E, 0x02, 0xE2, 0xFC, 0x1F, 0xDB, 0xF0, 0x7F,
-    0x4F, 0x40, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE,
-    0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03,
-    0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xC0, 0x00, 0x7F, 0xEF,
-    0xE0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0x7F,
-    0xD0, 0x00, 0x34, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xF7, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xF4, 0x1F, 0xFE, 0x7F, 0xD0, 0x03, 0xFF, 0x7F, 0xC0, 0x03,
-    0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xD0, 0x03,
-    0xFC, 0x3F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0x40, 0x7F, 0xFE, 0xBD,
-    0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0x02, 0xFF, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x82, 0xFF, 0xD0, 0xFF, 0x3F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x97, 0xFF, 0xBF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x01, 0xFE, 0x7F, 0x80, 0x07, 0xF4, 0x0F, 0xE0,
-    0x01, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0xF0, 0x02, 0xFF, 0xFB, 0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xC1, 0xFF, 0x80,
-    0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xF4, 0x0F, 0x80,
-    0x03, 0xFC, 0x2F, 0xC0, 0x03, 0xFC, 0x2F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE,
-    0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x55, 0x40, 0x00, 0x50,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xBF, 0xFE, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xF9, 0x7F, 0xF8, 0x3F, 0xE0, 0x3F, 0xFC, 0x7F, 0xC0, 0xBF, 0xFD, 0xBF, 0xC1, 0xFF,
-    0xFE, 0xBF, 0xC3, 0xF2, 0xFE, 0xBF, 0xCB, 0xD2, 0xFE, 0xBF, 0xDF, 0xC3, 0xFE, 0x7F, 0xFF, 0x03,
-    0xFD, 0x3F, 0xFD, 0x07, 0xFC, 0x2F, 0xFD, 0x2F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0xFF, 0x40, 0x0B, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xDF, 0xF0,
-    0xBF, 0xFC, 0x2F, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x02, 0xFE, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0xF9,
-    0x6F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xDF, 0xF0, 0xBF, 0xFC, 0x2F, 0xC0, 0x04, 0x00,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0x3F, 0xC0,
-    0x0F, 0xE0, 0x2F, 0xC0, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xDF, 0xF0, 0xBF, 0xFC, 0x2F, 0xC0, 0x04, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x2F,
-    0xD1, 0xFE, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0xB8, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFB, 0xFE,
-    0x5B, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xF7, 0xFC, 0x2F, 0xFF, 0x0B, 0xF0, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x3F,
-    0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xC1,
-    0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x07,
-    0xFB, 0xF4, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x02, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x8B,
-    0xFE, 0x00, 0xFF, 0xBF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xF5, 0x7F, 0xF4, 0xFF, 0xC0,
-    0x0F, 0xF8, 0xFF, 0xC0, 0x0B, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x80,
-    0x07, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0xC0, 0x0B, 0xFC, 0xFF, 0xC0, 0x0F, 0xF8, 0xFF, 0xF5,
-    0x7F, 0xF4, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xBF, 0xFF, 0xC0, 0xFF, 0x4F, 0xFE, 0x00, 0xFF, 0x80,
-    0x50, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x0B, 0x80, 0x00, 0xFF,
-    0x07, 0xF4, 0x00, 0x3F, 0xC1, 0xFD, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x02, 0xFF,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xFC, 0x0F,
-    0xF0, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x2F, 0xD2, 0xFD, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0xFF,
-    0x7F, 0x80, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x0A, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0x80, 0x00,
-    0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x00,
-    0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x00,
-    0xFF, 0xEA, 0xBF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF,
-    0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x02,
-    0xAA, 0xAA, 0x40, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0x90, 0x2F,
-    0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xFE, 0xBF, 0xDB, 0xFD, 0x00, 0xFF, 0x7F, 0xF0, 0x03, 0xFD, 0xFF, 0x80, 0x1F, 0xF6, 0xFF,
-    0x41, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0xFD, 0x0B, 0xFF, 0x83, 0xF4, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xFF, 0xBF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0,
-    0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0,
-    0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0,
-    0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0,
-    0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x3F, 0xE3,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x05, 0x40, 0x01, 0x50, 0x1F, 0x40, 0x1F, 0x40, 0x3F, 0xEB, 0xFC,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB,
-    0xFD, 0xBF, 0xD0, 0x0F, 0xF7, 0xFF, 0x00, 0x3F, 0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xDF, 0xD0, 0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x00, 0x03,
-    0xFD, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x03, 0xFF,
-    0xAA, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00,
-    0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFC, 0x03, 0x90, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFE, 0xBF, 0xDB, 0xFD, 0x00, 0xFF, 0x7F, 0xF0, 0x03, 0xFD, 0xFF,
-    0x80, 0x1F, 0xF6, 0xFF, 0x41, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0xFD, 0x0B, 0xFF,
-    0x83, 0xF4, 0x01, 0x40, 0x1F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xB9, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFE, 0xAF, 0xF0, 0x3F, 0xF8, 0x00, 0x14, 0x1F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x04, 0x0B, 0xFF, 0xE5, 0xBF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0F, 0xF8, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x6F, 0xD0, 0x00, 0xBF, 0x01,
-    0xFD, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFE, 0xAF, 0xF0, 0x3F, 0xF8, 0x00, 0x14, 0x1F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x04, 0x0B, 0xFF, 0xE5, 0xBF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0xFF, 0xFC, 0x00, 0x3F, 0xCF, 0xF0, 0x0F, 0xE0, 0x2F, 0xC0, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFE, 0xAF, 0xF0, 0x3F, 0xF8, 0x00, 0x14, 0x1F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x04, 0x0B, 0xFF, 0xE5, 0xBF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x54, 0x00, 0x15,
-    0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFE, 0xAF, 0xF0, 0x3F, 0xF8, 0x00, 0x14, 0x1F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x04, 0x0B, 0xFF, 0xE5, 0xBF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x40, 0x01, 0x50, 0xFE, 0x01, 0xFE, 0x03,
-    0xFC, 0xBF, 0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x01, 0x50, 0x00, 0x54,
-    0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x90, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFC, 0x00,
-    0xBF, 0xF4, 0xBF, 0xC0, 0x01, 0xFF, 0xCB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xEB,
-    0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x0B, 0xFC, 0xBF,
-    0xC0, 0x01, 0xFF, 0xCB, 0xFC, 0x00, 0xBF, 0xF4, 0xBF, 0xEA, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD2, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xD3, 0xF4,
-    0x00, 0x00, 0x03, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xD2, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xFD, 0x3F, 0xD0, 0x00, 0x0B, 0xFF, 0xF7, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xF9, 0x6F, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xC0, 0x03, 0xFD,
-    0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x3F,
-    0xD0, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x07,
-    0xFD, 0x00, 0x03, 0xFF, 0x96, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0x6F, 0xD0, 0x00, 0x02, 0xFF, 0xD1, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFE, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFC, 0x00, 0xBF, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x0B,
-    0xFD, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xFF, 0xFC, 0x03, 0xFF,
-    0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0x7F, 0xFF, 0xFC, 0x03, 0xFE, 0x2B, 0xFE, 0xA4, 0x03, 0xFE, 0x07,
-    0xFC, 0x00, 0x07, 0xFD, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFC,
-    0x00, 0xBF, 0xF4, 0x07, 0xFE, 0xAF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0xE3, 0xFD, 0x00,
-    0xBF, 0xFF, 0xBF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x96, 0xFF, 0xD0, 0x7F, 0xF0, 0x0B,
-    0xFD, 0x07, 0xFD, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0xBF,
-    0xD0, 0x03, 0xFD, 0x07, 0xFD, 0x00, 0x3F, 0xD0, 0x7F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x95, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x7F, 0xD0, 0x02, 0xFF, 0xC2, 0xFD, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x0A, 0xAA, 0xA9, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0x15, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0x5F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFA, 0xAA,
-    0x87, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0xAA, 0xA5, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0x80, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC,
-    0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00,
-    0x15, 0x00, 0x05, 0x47, 0xC0, 0x07, 0xD0, 0xFF, 0xAF, 0xF0, 0x1F, 0xFF, 0xF4, 0x01, 0xFF, 0xF4,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x01, 0xFF, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA,
-    0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x05, 0x40, 0x01, 0x50, 0x07,
-    0xD0, 0x07, 0xD0, 0x03, 0xFE, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x7F,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4,
-    0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x7F, 0xEA, 0xAA, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFA, 0xAA,
-    0x97, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x01,
-    0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F,
-    0xE0, 0x15, 0x00, 0x05, 0x42, 0xFC, 0x03, 0xF8, 0x0F, 0xF5, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xF0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
-    0x87, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x47, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x87,
-    0xFF, 0xFF, 0xF8, 0x05, 0x40, 0x01, 0x50, 0x0B, 0xF0, 0x0F, 0xF0, 0x02, 0xFD, 0x7F, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F,
-    0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x01, 0x50, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFA, 0xBF, 0xC0, 0xFF, 0xF4, 0x00, 0x14, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x1A, 0xAA, 0xA7,
-    0xFD, 0x01, 0xFF, 0xFF, 0x7F, 0xD0, 0x1F, 0xFF, 0xF3, 0xFD, 0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x00,
-    0x2F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x0B,
-    0xFF, 0xE5, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF,
-    0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x02, 0xFD, 0x7F, 0x40, 0x07, 0xF4, 0x1F, 0xD0, 0x05, 0x40, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD1, 0xFD, 0x0B, 0xFF, 0xFA, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF9,
-    0x6F, 0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0,
-    0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0,
-    0x07, 0xFD, 0x3F, 0xF8, 0x1F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFB, 0xFD, 0x02, 0xFF,
-    0xD3, 0xFD, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x10, 0x00, 0x0F, 0xFC, 0x2F, 0xA5,
-    0xBF, 0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x15,
-    0x00, 0x05, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFA, 0xBF, 0xC0,
-    0xFF, 0xF4, 0x00, 0x14, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x1A, 0xAA, 0xA7, 0xFD, 0x01, 0xFF, 0xFF, 0x7F,
-    0xD0, 0x1F, 0xFF, 0xF3, 0xFD, 0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x00, 0x2F, 0xF3, 0xFF, 0x00, 0x02,
-    0xFF, 0x2F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x0B, 0xFF, 0xE5, 0xBF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x01, 0x40, 0x01, 0x50, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xFF, 0xBF, 0xD0, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD1,
-    0xFD, 0x0B, 0xFF, 0xFA, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF9, 0x6F, 0xFD, 0x3F, 0xE0, 0x0B,
-    0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03,
-    0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x07, 0xFD, 0x3F, 0xF8, 0x1F,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFB, 0xFD, 0x02, 0xFF, 0xD3, 0xFD, 0x00, 0x04, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFC, 0x10, 0x00, 0x0F, 0xFC, 0x2F, 0xA5, 0xBF, 0xF8, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFA, 0xBF, 0xC0, 0xFF, 0xF4, 0x00, 0x14, 0x1F,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x1A, 0xAA, 0xA7, 0xFD, 0x01, 0xFF, 0xFF, 0x7F, 0xD0, 0x1F, 0xFF, 0xF3, 0xFD,
-    0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x00, 0x2F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00, 0x2F,
-    0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x0B, 0xFF, 0xE5, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD1, 0xFD, 0x0B, 0xFF, 0xFA, 0xFD,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF9, 0x6F, 0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD,
-    0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD,
-    0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x07, 0xFD, 0x3F, 0xF8, 0x1F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD,
-    0x0B, 0xFF, 0xFB, 0xFD, 0x02, 0xFF, 0xD3, 0xFD, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC,
-    0x10, 0x00, 0x0F, 0xFC, 0x2F, 0xA5, 0xBF, 0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFA, 0xBF, 0xC0, 0xFF, 0xF4, 0x00, 0x14, 0x1F,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x1A, 0xAA, 0xA7, 0xFD, 0x01, 0xFF, 0xFF, 0x7F, 0xD0, 0x1F, 0xFF, 0xF3, 0xFD,
-    0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x00, 0x2F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00, 0x2F,
-    0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x0B, 0xFF, 0xE5, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD1, 0xFD, 0x0B, 0xFF, 0xFA, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xF9, 0x6F, 0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF,
-    0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F,
-    0xE0, 0x07, 0xFD, 0x3F, 0xF8, 0x1F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFB, 0xFD, 0x02,
-    0xFF, 0xD3, 0xFD, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x10, 0x00, 0x0F, 0xFC, 0x2F,
-    0xA5, 0xBF, 0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xF9, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x07, 0xF5, 0xFE,
-    0x00, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F,
-    0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0,
-    0x00, 0x2F, 0xE7, 0xFE, 0xAA, 0xAB, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00,
-    0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7,
-    0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0xFF, 0x00, 0x00, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0xFD, 0x00,
-    0x0F, 0xF7, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xF9, 0x7F, 0xF8, 0x03, 0xFF,
-    0x40, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x0B,
-    0xFC, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x02, 0xFF, 0x00,
-    0xFF, 0x80, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x3F, 0xE0,
-    0x02, 0xFF, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
-    0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x01,
-    0xFF, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0xAA, 0xAB, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x03,
-    0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00,
-    0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xE0,
-    0x14, 0x00, 0x0B, 0xF8, 0xBF, 0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF4, 0x2F,
-    0xFD, 0x0B, 0xFF, 0x0B, 0xFD, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x07, 0xFC,
-    0x2F, 0xE0, 0x01, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x07,
-    0xFC, 0x2F, 0xE0, 0x01, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x1F, 0xF0, 0xBF, 0x80,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0x3F, 0xFE, 0xBE, 0xBF, 0xFF, 0xFC, 0xF8, 0x1F,
-    0xF4, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD,
-    0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00,
-    0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF,
-    0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x03, 0xD1, 0xFF, 0xFB, 0xF0,
-    0xFF, 0xFF, 0xF8, 0x7C, 0x0B, 0xFC, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0,
-    0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8,
-    0x00, 0x2A, 0xAA, 0xA4, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x85, 0x55, 0x54, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x07, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF4,
-    0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0x6A, 0xAA, 0xA1, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03,
-    0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0x54, 0x00, 0x14, 0xBC, 0x00, 0x7D, 0x3F, 0xEF, 0xFC, 0x2F, 0xFF, 0xF4, 0x07,
-    0xFF, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xF4, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00,
-    0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x54, 0x00, 0x14, 0xFC, 0x00, 0xBC, 0x7F, 0xEF, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03,
-    0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE,
-    0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00,
-    0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x41, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBE,
-    0x00, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x02, 0xA8, 0x00, 0x02, 0xFD, 0x3F, 0xE3, 0xFE, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3,
-    0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE0, 0xF8, 0x3F, 0x0B, 0xD0,
-    0xFD, 0x0B, 0xFF, 0x3F, 0xF0, 0xAA, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFD, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF,
-    0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0x3F, 0xFF, 0xF4, 0x0B, 0xF8, 0xFF, 0xFF, 0xD0, 0x2F,
-    0xE3, 0xFF, 0xFF, 0x40, 0xBF, 0x81, 0xFF, 0xE0, 0x02, 0xFE, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x0B,
-    0xFC, 0x00, 0x2F, 0xE0, 0x2F, 0xF0, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x02, 0xFE, 0x02, 0xFF, 0x00,
-    0x0B, 0xF8, 0x0B, 0xFC, 0x00, 0x2F, 0xE0, 0x2F, 0xF0, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x02, 0xFE,
-    0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x0B, 0xFC, 0x00, 0x2F, 0xE0, 0x2F, 0xF0, 0x00, 0xBF, 0x80, 0xBF,
-    0xC0, 0x02, 0xFE, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x0F, 0xFD, 0x00, 0x2F, 0xE3, 0xFF, 0xFF, 0x40,
-    0xBF, 0x8F, 0xFF, 0xFD, 0x02, 0xFE, 0x3F, 0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x06, 0xAF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x2F, 0xC3, 0xFE, 0x00, 0xFF, 0x8F, 0xF8, 0x03, 0xFE, 0x1F, 0xC0, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x80,
-    0x3F, 0xD3, 0xFE, 0x00, 0xFF, 0x4F, 0xF8, 0x03, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x80, 0x3F,
-    0xD3, 0xFE, 0x00, 0xFF, 0x4F, 0xF8, 0x03, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x80, 0x3F, 0xD3,
-    0xFE, 0x00, 0xFF, 0x4F, 0xF8, 0x03, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x80, 0x3F, 0xD3, 0xFE,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x6B,
-    0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xCB, 0xF4, 0x0B, 0xF0, 0x2F, 0xC0, 0x54,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x2A, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
-    0xFF, 0x00, 0x3F, 0x8F, 0xF0, 0x3F, 0x80, 0xFE, 0x05, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00,
-    0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x06, 0xBF, 0xF4, 0x02,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC7, 0xFC,
-    0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x07, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x3F, 0xF0,
-    0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x7F, 0xC2, 0xFF, 0x40, 0x07, 0xFC, 0x7F, 0xE0, 0x00, 0x7F, 0xCF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFB, 0xFF, 0x00, 0x07, 0xFD, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0xBF, 0xD0, 0x07, 0xFC, 0x03,
-    0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0x07,
-    0xFC, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xF4, 0xBF, 0x80, 0x2F, 0xF4, 0x2F, 0xE0,
-    0x1F, 0xF4, 0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFE, 0x1F, 0xF8, 0x00, 0xBF, 0x8F, 0xF8, 0x00, 0x2F,
-    0xEF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xF4, 0xFF, 0xC0, 0x0B, 0xF8, 0x0F, 0xF8, 0x02, 0xFE, 0x01, 0xFF, 0x40, 0xBF, 0x80, 0x2F,
-    0xF0, 0x2F, 0xE0, 0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFD, 0x2F, 0xE0, 0x03, 0xFD,
-    0x0B, 0xF8, 0x03, 0xFE, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0xBF, 0x82, 0xFF, 0x00, 0x2F, 0xE2, 0xFF,
-    0x00, 0x0B, 0xF9, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFE, 0x3F, 0xF0, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x7F, 0xD0, 0x2F,
-    0xE0, 0x0B, 0xFC, 0x0B, 0xF8, 0x00, 0xFF, 0xC2, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x55, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xEA, 0xAA, 0x9B, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0x00, 0x55,
-    0x40, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE,
-    0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
-    0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFE, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F,
-    0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3,
-    0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFE,
-    0x1F, 0xC2, 0xF8, 0x3F, 0x01, 0x50, 0x7F, 0xC0, 0x0F, 0xF2, 0xFF, 0x00, 0x3F, 0x8B, 0xFC, 0x01,
-    0xFC, 0x2F, 0xF0, 0x0B, 0xE0, 0xBF, 0xC0, 0x2F, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xAA, 0xAA, 0x4B, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF,
-    0xF4, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xEF, 0xF8, 0xBF, 0x3F, 0xE2, 0xF8,
-    0xFF, 0x8F, 0xC3, 0xFE, 0x29, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xBF, 0xC0, 0xBF, 0x0B, 0xFC, 0x0F, 0xF8, 0xBF, 0xC0, 0xFF, 0x8B, 0xFC, 0x07, 0xF0, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x0B, 0xFE, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F,
-    0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0xFE, 0x3F, 0xEB, 0xFC,
-    0xFF, 0xAF, 0xF3, 0xFE, 0x3F, 0x4F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x17, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA9, 0x07, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFD, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFE,
-    0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x2F,
-    0xFD, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xD0, 0xBF, 0xFC, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x0B,
-    0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFC,
-    0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x7F,
-    0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0, 0x03, 0xFC, 0x7F, 0x5F, 0xF4, 0x03, 0xFC, 0x7F, 0x4B,
-    0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03, 0xFC, 0x7F, 0x82, 0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF,
-    0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC, 0x7F, 0x80, 0x3F, 0xF3, 0xFC, 0x7F, 0x80, 0x1F, 0xF6,
-    0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F, 0x80, 0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFF, 0xFC,
-    0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x7F, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0xD0, 0xFF, 0x3F, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x97, 0xFF, 0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0xF4, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFC,
-    0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x7F,
-    0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0, 0x03, 0xFC, 0x7F, 0x5F, 0xF4, 0x03, 0xFC, 0x7F, 0x4B,
-    0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03, 0xFC, 0x7F, 0x82, 0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF,
-    0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC, 0x7F, 0x80, 0x3F, 0xF3, 0xFC, 0x7F, 0x80, 0x1F, 0xF6,
-    0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F, 0x80, 0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFF, 0xFC,
-    0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x7F, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xFD, 0x0F, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xF9, 0x7F, 0xFB, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x54, 0x00, 0x15,
-    0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD7, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF,
-    0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0,
-    0x03, 0xFC, 0x7F, 0x5F, 0xF4, 0x03, 0xFC, 0x7F, 0x4B, 0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03,
-    0xFC, 0x7F, 0x82, 0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF, 0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC,
-    0x7F, 0x80, 0x3F, 0xF3, 0xFC, 0x7F, 0x80, 0x1F, 0xF6, 0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F,
-    0x80, 0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80,
-    0x00, 0x7F, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x05, 0x40, 0x01, 0x50, 0x3F, 0x80, 0x7F, 0x80,
-    0x3F, 0xCB, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x82, 0xFF, 0xD0, 0xFF, 0x3F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x97,
-    0xFF, 0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
-    0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x47, 0xFF, 0xC0,
-    0x3F, 0x43, 0xF9, 0xFF, 0xFF, 0x41, 0x50, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xD5, 0xFF,
-    0xD0, 0x00, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x03,
-    0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xE0, 0x7F, 0xF4, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00,
-    0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0xBF, 0xF0, 0x03,
-    0xFC, 0x7F, 0x6F, 0xF8, 0x03, 0xFC, 0x7F, 0x4F, 0xFD, 0x03, 0xFC, 0x7F, 0x47, 0xFF, 0x03, 0xFC,
-    0x7F, 0x82, 0xFF, 0xC3, 0xFC, 0x7F, 0x80, 0xFF, 0xD3, 0xFC, 0x7F, 0x80, 0x7F, 0xF2, 0xFC, 0x7F,
-    0x80, 0x2F, 0xFE, 0xFC, 0x7F, 0x80, 0x0F, 0xFF, 0xFC, 0x7F, 0x80, 0x03, 0xFF, 0xFC, 0x7F, 0x80,
-    0x02, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x7F, 0x80, 0x00,
-    0x1F, 0xFC, 0x7F, 0x80, 0x00, 0x0F, 0xFC, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05, 0x6F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x2F, 0xFD, 0x0F, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0xFF, 0xF9,
-    0x6F, 0xFB, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFC, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xAF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0A, 0xAA, 0xA8, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x02, 0xFF, 0x80,
-    0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x1F, 0xF4, 0x00,
-    0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00,
-    0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0xBF, 0xFE, 0x6F,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x80, 0x02, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F,
-    0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF,
-    0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x15, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F, 0xF8,
-    0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40,
-    0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00,
-    0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xE6,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0x03, 0xE0, 0x03, 0xF0,
-    0x02, 0xFF, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE,
-    0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x54, 0x15, 0x00, 0x00, 0x03, 0xFE,
-    0x3F, 0xD0, 0x00, 0x01, 0xFE, 0x2F, 0xD0, 0x00, 0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0xBD, 0x0F,
-    0xC0, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0xAF,
-    0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01,
-    0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07,
-    0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x7F,
-    0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0xFF, 0x1F, 0xF0, 0x03, 0xFD, 0x3F, 0xC0, 0x07, 0xF0, 0xFE,
-    0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07,
-    0xFD, 0x7F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02,
-    0xFF, 0xBF, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xEA, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF,
-    0xAA, 0xA8, 0x7F, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
-    0xE0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x96, 0xBF, 0xFA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xF4, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xF9, 0x6F, 0xFF, 0xC0, 0x3F, 0xE0, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x3F, 0xC7,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x2F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xDB, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xE4, 0xBF, 0xFF, 0x80, 0x07, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFA, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xEA,
-    0xFF, 0xF4, 0x0B, 0xFC, 0x01, 0xFF, 0xC0, 0xBF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0xBF, 0xD5, 0xBF, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xC1, 0xFF, 0x40, 0x0B,
-    0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0xBF, 0xC0, 0x0F,
-    0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0xBF, 0xC0, 0x03, 0xFF, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x05, 0x54, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0xF8, 0xFF, 0x2F, 0xF8, 0xFF, 0xBF, 0xF4, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
-    0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80,
-    0x00, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xA4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xFE, 0xAF, 0xFF, 0x40, 0xBF, 0xC0, 0x1F, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0xBF,
-    0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x0F, 0xF8, 0x0B, 0xFD, 0x5B, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFC,
-    0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x2F, 0xF4,
-    0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0xBF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x82, 0xFE, 0x3F, 0xCB, 0xFE, 0x3F, 0xEF, 0xFD, 0x3F, 0xFF,
-    0xFD, 0x3F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00,
-    0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
-    0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0,
-    0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x40, 0x01, 0x50, 0x00, 0xFE,
-    0x00, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xEA, 0xFF, 0xF4, 0x0B, 0xFC, 0x01, 0xFF, 0xC0,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00,
-    0xFF, 0x80, 0xBF, 0xD5, 0xBF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xC1, 0xFF, 0x40, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x3F,
-    0xE0, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0xBF, 0xC0, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0xBF,
-    0xC0, 0x03, 0xFF, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x14, 0x00, 0x05, 0x0F, 0xE0, 0x1F, 0xD1, 0xFE,
-    0x2F, 0xD0, 0x1F, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x0B, 0xF8, 0x3F, 0xCB, 0xFE, 0x0F, 0xFB, 0xFF, 0x43, 0xFF, 0xFF, 0xD0, 0xFF, 0xF4, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F,
-    0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFD, 0x3F, 0xFA, 0xBF, 0xC7, 0xFD, 0x00, 0x14, 0x7F, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x1F, 0xFA, 0x00, 0x02, 0xFF, 0xBF, 0x95, 0xFF, 0xDB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE4, 0x2F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8B, 0xF8, 0x01, 0xC2, 0xFE, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF6, 0xD0, 0x07, 0xFD, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF,
-    0x47, 0xFF, 0xFE, 0x00, 0x01, 0x50, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x7F, 0x9F, 0xE0, 0x1F, 0xD0, 0x3F, 0x80, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFD, 0x3F, 0xFA, 0xBF, 0xC7, 0xFD, 0x00,
-    0x14, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFA, 0x00, 0x02, 0xFF, 0xBF, 0x95, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0x9F, 0xE0, 0x7F, 0x40, 0xFE, 0x05, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x2F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8B, 0xF8, 0x01,
-    0xC2, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF6, 0xD0, 0x07, 0xFD, 0xBF, 0xFF,
-    0xFF, 0x2F, 0xFF, 0xFF, 0x47, 0xFF, 0xFE, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFD, 0x3F, 0xFA, 0xBF, 0xC7, 0xFD, 0x00, 0x14,
-    0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFA, 0x00, 0x02, 0xFF, 0xBF, 0x95, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x5B, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x42, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF8, 0xBF, 0x80,
-    0x1C, 0x2F, 0xE0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x6D, 0x00, 0x7F, 0xDB, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x01,
-    0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x9B, 0xF4, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x05,
-    0x00, 0x01, 0x41, 0xFD, 0x02, 0xFC, 0x07, 0xF8, 0xFF, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xF8,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFA, 0xBF, 0xC7, 0xFD, 0x00, 0x14, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFA,
-    0x00, 0x02, 0xFF, 0xBF, 0x95, 0xFF, 0xDB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x05, 0x0F, 0xE0, 0x1F, 0xD1, 0xFE, 0x2F, 0xD0, 0x1F,
-    0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x2F,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8B, 0xF8, 0x01, 0xC2, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x0F, 0xF6, 0xD0, 0x07, 0xFD, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0x47, 0xFF, 0xFE, 0x00,
-    0x01, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x09, 0x7F,
-    0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00,
-    0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x1B,
-    0xFD, 0x54, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x45, 0x03, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x06, 0xFC, 0x00,
-    0x00, 0xBE, 0x00, 0x25, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x01, 0x50, 0x00, 0x54, 0x00,
-    0xFE, 0x01, 0xFD, 0x00, 0x0F, 0xF2, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x50, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x28, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xD5, 0x40,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x14, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xAF, 0xFE, 0xA0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x1B, 0xFD, 0x54, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFF, 0x45, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0x00, 0x02, 0xFF, 0xFB, 0xF0, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x0B, 0xC1, 0xFF, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7,
-    0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0x40, 0x7F, 0xFE, 0xBD, 0x03,
-    0xFF, 0xFF, 0xF0, 0x0F, 0x02, 0xFF, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x02, 0xFE, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0xF9, 0x6F, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xDF, 0xF0, 0xBF, 0xFC, 0x2F, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x6A,
-    0xAA, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF,
-    0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F,
-    0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xEF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0xFF, 0x96, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFD, 0xFF, 0x0B, 0xFF, 0xC2, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x54, 0x00,
-    0x0F, 0x40, 0x0F, 0x80, 0x00, 0xFF, 0xEF, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF,
-    0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03,
-    0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC,
-    0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0,
-    0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x05, 0x40,
-    0x01, 0x40, 0x2F, 0x00, 0x2F, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xDF,
-    0xF0, 0xBF, 0xFC, 0x2F, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x02,
-    0xFB, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7,
-    0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xEF, 0xC0, 0x00,
-    0x3C, 0x1F, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xEF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFE, 0xFF, 0x96, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFD, 0xFF, 0x0B, 0xFF,
-    0xC2, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x00, 0x15, 0x41, 0x54, 0x00, 0x07, 0xFC, 0xBF, 0x80, 0x00,
-    0xFF, 0x1F, 0xE0, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x00, 0x14, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC,
-    0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00,
-    0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x15, 0x40, 0x0F, 0xF8, 0xFF,
-    0x00, 0x7F, 0x8F, 0xF4, 0x03, 0xF4, 0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x50, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF,
-    0xEF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xDF, 0xF0, 0xBF, 0xFC, 0x2F, 0xC0,
-    0x04, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xDB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFD, 0x00, 0x07, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC2,
-    0xFF, 0xE5, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0xFF, 0x40, 0x0B, 0xFB, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xBF, 0xE5,
-    0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x7F, 0xC2, 0xFF, 0xF0, 0xBF, 0x00, 0x10, 0x07,
-    0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0xBF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0xBF,
-    0x83, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x0F, 0xF0, 0x2F,
-    0xE0, 0x07, 0xFF, 0xE0, 0x07, 0xFC, 0x07, 0xFC, 0x02, 0xFE, 0xFC, 0x02, 0xFE, 0x00, 0xFF, 0x00,
-    0xFE, 0xBF, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0x5F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF8, 0x1F, 0xD3,
-    0xF8, 0x1F, 0xF0, 0x01, 0xFF, 0x0B, 0xF0, 0xFF, 0x0B, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x2F, 0xC3,
-    0xFD, 0x00, 0x0F, 0xF0, 0xFE, 0x07, 0xF4, 0xFF, 0x00, 0x02, 0xFD, 0x7F, 0x40, 0xFE, 0x3F, 0xC0,
-    0x00, 0x7F, 0xAF, 0xC0, 0x3F, 0xDF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x0B, 0xFB, 0xF4, 0x00, 0x03,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x3F, 0xF0, 0x02, 0xFD, 0x7F, 0xC0, 0x0F, 0xFD, 0x00, 0xFF, 0x4F, 0xF0, 0x0B, 0xFF, 0x80,
-    0x3F, 0xC2, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xE0, 0x7F, 0xC0, 0xFD, 0xFC, 0x0F, 0xF4, 0x0F, 0xF0,
-    0x7F, 0x3F, 0x03, 0xFC, 0x03, 0xFD, 0x2F, 0x8F, 0xD1, 0xFF, 0x00, 0xBF, 0x8F, 0xD2, 0xF8, 0xBF,
-    0x80, 0x1F, 0xF3, 0xF0, 0x7F, 0x3F, 0xD0, 0x03, 0xFC, 0xFC, 0x0F, 0xCF, 0xF0, 0x00, 0xFF, 0x7F,
-    0x03, 0xF7, 0xF8, 0x00, 0x1F, 0xEF, 0x80, 0xBE, 0xFD, 0x00, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x00,
-    0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x01, 0x40, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0xFF, 0xC0,
-    0x02, 0xFF, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x03, 0xFD,
-    0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x2F, 0xFB, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x50, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x01, 0xFF, 0x0F, 0xF4,
-    0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x01,
-    0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0xFE, 0x3F, 0xC0,
-    0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x07, 0xFB, 0xF4, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x03, 0xFC, 0x2F,
-    0xC0, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x1F, 0xF8, 0x00, 0x0F, 0xF8, 0x3F, 0xF0,
-    0x00, 0xBF, 0xC0, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0xFF,
-    0x40, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x0B, 0xFE, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xFA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x55, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFC, 0x15, 0x55, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0B,
-    0xFC, 0x00, 0x01, 0xFF, 0x95, 0x54, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0xFF, 0xC0, 0x00,
-    0x2F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x95, 0x54, 0x3F, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD0, 0x01, 0x50, 0x00, 0x54, 0x00, 0xFE, 0x01,
-    0xFE, 0x00, 0x0F, 0xF2, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xFA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x05, 0x00, 0x01, 0x40, 0xFE, 0x01, 0xFD, 0x07, 0xF8, 0xBF, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0xBF,
-    0xF8, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFC, 0x15, 0x55, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0B,
-    0xFC, 0x00, 0x01, 0xFF, 0x95, 0x54, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x14, 0x00, 0xBF, 0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xFC, 0xBF, 0xD0, 0x4B, 0xF8, 0x00,
-    0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF,
-    0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80,
-    0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x15, 0x40, 0x0F, 0xFC, 0x00,
-    0xBF, 0x80, 0x0B, 0xF8, 0x00, 0x7F, 0x40, 0x01, 0x50, 0x00, 0x55, 0x00, 0xFF, 0xC0, 0xBF, 0xC0,
-    0x7F, 0x80, 0x7F, 0x40, 0x05, 0x00, 0x00, 0x00, 0x55, 0x00, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0xE0,
-    0x2F, 0xDB, 0xF4, 0xBF, 0x01, 0xFD, 0x54, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x1F, 0x3F,
-    0xFF, 0xBE, 0x7F, 0xFF, 0xFD, 0xB8, 0x1F, 0xF4, 0x50, 0x00, 0x40, 0x6A, 0xAA, 0x9F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x2A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC1,
-    0x55, 0x55, 0x54, 0x14, 0x00, 0x15, 0x3E, 0x00, 0x3E, 0x3F, 0xFB, 0xFD, 0x0F, 0xFF, 0xF8, 0x03,
-    0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xD7, 0xFD, 0x2F, 0x80, 0x00, 0x2F, 0x01,
-    0xF4, 0x3F, 0xC3, 0xFC, 0x3F, 0x83, 0xFC, 0x1F, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xFC,
-    0x12, 0xFC, 0x00, 0xFC, 0x0B, 0xF8, 0x0F, 0xD0, 0x06, 0x80, 0x05, 0x40, 0x3F, 0xF4, 0xBE, 0xFC,
-    0xF4, 0x3D, 0xF4, 0x3D, 0x7E, 0xFC, 0x2F, 0xF4, 0x01, 0x40, 0x01, 0x54, 0x15, 0x40, 0x7F, 0xCB,
-    0xF8, 0x0F, 0xF1, 0xFE, 0x02, 0xFC, 0x3F, 0x80, 0x7E, 0x0B, 0xD0, 0x01, 0x40, 0x50, 0x00, 0x54,
-    0x00, 0x15, 0x1F, 0xD0, 0x2F, 0xC2, 0xFD, 0x3F, 0xC0, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x00,
-    0x15, 0x50, 0x00, 0x14, 0x7D, 0x7D, 0x7D, 0x7D, 0x69, 0x54, 0x15, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x3F, 0xA8, 0x2A, 0x15, 0x05, 0x50, 0x0F, 0xF2, 0xFE, 0x01, 0xFD, 0x2F, 0xC0, 0x1F,
-    0xC2, 0xF8, 0x01, 0xF8, 0x2F, 0x40, 0x05, 0x01, 0x40, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0x00, 0x14,
-    0xFE, 0x14, 0x3D, 0x28, 0x7C, 0x2F, 0x41, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x14,
-    0x00, 0x00, 0x55, 0x00, 0x07, 0xFF, 0xE0, 0x2F, 0xFF, 0xF8, 0x3F, 0xAA, 0xFC, 0x7C, 0x00, 0x3D,
-    0x14, 0x00, 0x14, 0x07, 0xE0, 0xFE, 0x1F, 0xD2, 0xFC, 0x3F, 0xC7, 0xF8, 0xBF, 0x81, 0x50, 0x1F,
-    0xE2, 0xFE, 0x3F, 0xC3, 0xFC, 0x3F, 0x47, 0xF0, 0xBE, 0x01, 0x40, 0xBF, 0x4B, 0xF8, 0x3F, 0xC3,
-    0xFC, 0x1F, 0xC0, 0xFD, 0x0B, 0xE0, 0x14, 0x1F, 0xE2, 0xFE, 0x3F, 0xC3, 0xFC, 0x3F, 0x47, 0xF0,
-    0xBE, 0x01, 0x40, 0x15, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0x7F, 0x00, 0x01,
-    0x40, 0x00, 0x55, 0x40, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x1E, 0x16, 0xEB, 0xFE, 0x56, 0xE0, 0x1E, 0x00, 0x40, 0x00, 0x0B, 0x40, 0xB9, 0x4B,
-    0xFE, 0xB9, 0x5B, 0x40, 0x10, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x6A, 0xAE, 0x00, 0x1E, 0x00, 0x1E,
-    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x0B, 0xF8, 0x7F, 0xF0,
-    0xBF, 0xD0, 0xBE, 0x00, 0x00, 0x00, 0x05, 0x3F, 0xBD, 0xF4, 0xB8, 0x7F, 0x1E, 0x02, 0x80, 0x03,
-    0xC0, 0x03, 0xC0, 0x2B, 0xE8, 0x3F, 0xFC, 0x00, 0x00, 0x2A, 0xA8, 0x3F, 0xFC, 0x03, 0xC0, 0x03,
-    0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x3F, 0xFC, 0x2B, 0xE8, 0x03,
-    0xC0, 0x02, 0x80, 0x2A, 0xA8, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA8, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF,
-    0x02, 0xFC, 0x1F, 0xF7, 0xFF, 0x9F, 0xFC, 0x7F, 0x80, 0xA9, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80,
-    0xFE, 0x03, 0xFD, 0x0B, 0xFF, 0x4F, 0xFD, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x3F, 0xD3, 0xFD, 0x2F,
-    0xC0, 0x00, 0x2F, 0x01, 0xF4, 0x3F, 0xC3, 0xFC, 0x3F, 0x83, 0xFC, 0x1F, 0x01, 0xF4, 0x05, 0x40,
-    0x3F, 0xF4, 0xBE, 0xFC, 0xF4, 0x3D, 0xF4, 0x3D, 0x7E, 0xFC, 0x2F, 0xF4, 0x01, 0x40, 0x00, 0x02,
-    0xFD, 0x3F, 0xC3, 0xF4, 0x3F, 0x01, 0x40, 0x07, 0xC0, 0x0F, 0xE0, 0x06, 0xFC, 0x00, 0xFD, 0x16,
-    0xFC, 0x7F, 0xFC, 0x3F, 0xE0, 0x01, 0x00, 0xF8, 0x3E, 0x0B, 0xC0, 0xFD, 0x0F, 0xFF, 0x7F, 0xF0,
-    0xBA, 0x14, 0x7D, 0x7D, 0x7D, 0x7D, 0x69, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFC, 0x3C, 0x00, 0x3C,
-    0x38, 0x00, 0x2C, 0x38, 0x00, 0x2C, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x70, 0x3C, 0x0D, 0x39,
-    0xBE, 0x7C, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x05, 0x1F, 0xD0, 0x2F, 0xC1, 0xFE,
-    0x3F, 0xC0, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xD0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x55, 0x00, 0x03,
-    0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0x2F, 0xDB, 0xF4, 0x7F, 0x01, 0xFD, 0x54, 0x00, 0x15, 0x14, 0x00,
-    0x15, 0x7D, 0x00, 0x7D, 0x3F, 0xEB, 0xFC, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x00, 0x14, 0x00,
-    0x00, 0x55, 0x00, 0x07, 0xFF, 0xE0, 0x2F, 0xFF, 0xF8, 0x3F, 0xAA, 0xFC, 0x7C, 0x00, 0x3D, 0x14,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x1F, 0x3F, 0xFE, 0xBE, 0xBF, 0xFF, 0xFC, 0xF8, 0x1F,
-    0xF4, 0x50, 0x01, 0x40, 0x6A, 0xAA, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x5F, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xA0, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xDA,
-    0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0xA0,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xC3, 0xFF, 0xFB, 0xF1, 0xFF, 0xFF, 0xF4, 0xBC, 0x1F, 0xF8,
-    0x04, 0x00, 0x10, 0x00, 0x2A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC1, 0x55,
-    0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE6, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03,
-    0xF8, 0x00, 0x2F, 0xFC, 0x01, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0x40, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x50, 0xFC, 0x7E, 0x1F, 0x2E,
-    0xFD, 0xB4, 0x24, 0x00, 0x18, 0x38, 0x00, 0x2C, 0x38, 0x00, 0x2C, 0x3D, 0x55, 0x7C, 0x3F, 0xFF,
-    0xFC, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xB5, 0x55, 0x5E, 0xB0, 0x00, 0x0E,
-    0xB0, 0x00, 0x0E, 0xBF, 0xFF, 0xFE, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x39,
-    0x7E, 0x6C, 0x70, 0x3C, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x4B, 0x5E, 0x3F, 0xC2, 0xF4, 0x7F, 0xDB,
-    0x0E, 0x00, 0x00, 0x00, 0x2F, 0xB8, 0xF4, 0x7C, 0x2D, 0x0F, 0x6E, 0xF8, 0x00, 0x55, 0x55, 0x55,
-    0x3F, 0xFF, 0xFF, 0xDA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF,
-    0xDA, 0xAA, 0xAA, 0xA0, 0x15, 0x40, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x07, 0xF8, 0x00, 0x3F, 0x80,
-    0x01, 0x50, 0x00, 0x55, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x7F, 0x80, 0x7F, 0x40, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF9, 0x07, 0xC3, 0xFF, 0xFB, 0xF1, 0xFF, 0xFF, 0xF4, 0xBC, 0x1F, 0xF4,
-    0x14, 0x00, 0x10, 0x00, 0x6A, 0x0B, 0xFC, 0x6F, 0xC0, 0xFC, 0x1F, 0x40, 0x40, 0x00, 0x02, 0xA9,
-    0x00, 0x07, 0xD1, 0xFF, 0x5F, 0x43, 0xFC, 0xBF, 0x8F, 0xF0, 0xFF, 0x3F, 0xC3, 0xFC, 0x1F, 0x4F,
-    0xD0, 0x7D, 0x00, 0x01, 0x50, 0x00, 0x00, 0x15, 0x00, 0xFD, 0x03, 0xF4, 0x0F, 0xF8, 0x3F, 0xF0,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA, 0xAB, 0xD7, 0x80, 0x00, 0x2D,
-    0x78, 0x00, 0x02, 0xD6, 0x40, 0x00, 0x19, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xDA, 0xAA, 0xAA,
-    0xA0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xDA, 0xAA, 0xAA, 0xA0, 0x54, 0x15,
-    0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xA8, 0x2A, 0x15, 0x4B, 0xFE, 0x6A, 0xE0, 0x0E,
-    0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x4F, 0x04, 0x1F, 0xFD, 0x3C, 0x3F, 0xFF, 0xFC, 0x38,
-    0xBF, 0xF0, 0x10, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x3C, 0x2F, 0xFE, 0xBC, 0x3F, 0xFF, 0xF8, 0x78, 0x1B, 0xF0,
-    0x00, 0x28, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x3C, 0x2F, 0xFF, 0xF8, 0x3C, 0x2F, 0xF0, 0x10, 0x00, 0x00, 0x0B, 0xE4, 0x3C, 0x1F, 0xFF,
-    0xF8, 0x3D, 0x2F, 0xF0, 0x14, 0x01, 0x40, 0x00, 0x41, 0x00, 0x07, 0x82, 0xD0, 0x2F, 0xFF, 0xF8,
-    0x0F, 0xEB, 0xF0, 0x02, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0x82, 0xF8, 0x0F,
-    0x00, 0xF0, 0x0F, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xD7, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x60, 0x00, 0xCA, 0x30, 0x00, 0x90,
-    0x00, 0x84, 0x01, 0x20, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x05, 0x00,
-    0x60, 0x60, 0x00, 0x00, 0xA0, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x70, 0xD0, 0x00, 0x00, 0x30,
-    0xD7, 0x04, 0x00, 0x00, 0x01, 0x0D, 0x70, 0x60, 0x00, 0x00, 0x50, 0xD0, 0x06, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC4, 0x01, 0x30, 0x00, 0x20, 0x01, 0xCA, 0x34,
-    0x00, 0x87, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xA8, 0x02, 0xA8,
-    0x02, 0xAD, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xD0, 0x00, 0x06, 0x40, 0x3F, 0x40, 0xBD, 0x1F, 0xD7,
-    0xE0, 0x50, 0x00, 0x01, 0x0B, 0xC7, 0xF2, 0xF0, 0x7C, 0x0F, 0xC1, 0xF0, 0x00, 0x01, 0xBE, 0x40,
-    0x0B, 0xFF, 0xF0, 0x1F, 0xEB, 0xF8, 0x3E, 0x00, 0xBC, 0x3C, 0x7E, 0x3C, 0x00, 0xFF, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x08, 0x7F, 0xD2, 0xF8, 0x3F, 0xC7, 0x9D, 0x00, 0x40,
-    0x00, 0x90, 0xBD, 0x7E, 0x07, 0xE0, 0x1F, 0xC0, 0x19, 0x60, 0x07, 0xE0, 0x0B, 0xD0, 0xBD, 0x7F,
-    0x46, 0x00, 0x60, 0x00, 0x50, 0x7E, 0x02, 0xF0, 0x0B, 0xD3, 0xF4, 0x0B, 0xD7, 0x7C, 0x3F, 0x4B,
-    0x2C, 0x60, 0x0E, 0x0E, 0x10, 0x1F, 0x07, 0xF0, 0x7C, 0x1F, 0x1F, 0x87, 0x80, 0x00, 0x00, 0x02,
-    0xFC, 0x3F, 0xE3, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xC0, 0x17, 0xD4, 0x3F, 0xFC, 0x0B, 0xE0, 0x0F,
-    0xF0, 0x09, 0x60, 0x00, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x79, 0xBE, 0x6D, 0xB0, 0x3C, 0x0E, 0xB0,
-    0x3C, 0x0E, 0x3D, 0xBE, 0x7C, 0x1F, 0xD7, 0xF4, 0x38, 0x03, 0x40, 0x7F, 0xE6, 0xAD, 0x01, 0xC0,
-    0x18, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xFD, 0x00,
-    0x00, 0x6F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x06, 0xBF, 0xFE, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x6F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x06, 0xBF, 0xFE, 0x80, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0x40, 0x00,
-    0x3D, 0x1F, 0xFF, 0xFF, 0xFF, 0xAA, 0xFC, 0x3F, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7C, 0x00, 0x05,
-    0xBF, 0xFF, 0xD0, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xA5, 0x5A, 0xFF,
-    0xE0, 0x1F, 0xE4, 0x00, 0x00, 0x1B, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x55,
-    0x55, 0x55, 0x55, 0x57, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x90, 0x0F,
-    0xFC, 0x00, 0x2D, 0x1F, 0xFD, 0x3C, 0x2D, 0x3D, 0x7D, 0x1F, 0xDD, 0x00, 0x00, 0x06, 0x41, 0xFB,
-    0xCF, 0x07, 0xBF, 0xFE, 0xF0, 0x02, 0xE5, 0x82, 0xFF, 0x00, 0x00, 0xB1, 0x85, 0x2D, 0xB6, 0xDB,
-    0x6D, 0xB4, 0x01, 0x90, 0x1F, 0xFC, 0x3C, 0x2E, 0x3C, 0x1E, 0x3C, 0x1E, 0x2E, 0x7D, 0x0B, 0xF4,
-    0x00, 0x00, 0x14, 0x05, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x2E, 0x3E, 0x7E, 0x1F, 0xDE,
-    0x00, 0x00, 0x06, 0x90, 0xBF, 0xC7, 0xC0, 0x1E, 0x00, 0x78, 0x00, 0xF9, 0x81, 0xFF, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x2E, 0x06, 0x6E, 0x2F, 0xFE, 0x3C, 0x2E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3E, 0x7E,
-    0x0F, 0xDD, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x18, 0x3F, 0xFD, 0xF4, 0xBB, 0xC1, 0xEF, 0x07,
-    0xBC, 0x1E, 0xF0, 0x78, 0x11, 0xA0, 0x64, 0x3F, 0xFF, 0xFD, 0x3C, 0x3E, 0x1E, 0x3C, 0x2D, 0x0F,
-    0x3C, 0x2D, 0x0F, 0x3C, 0x2D, 0x0F, 0x3C, 0x2D, 0x0E, 0x51, 0x8B, 0xBC, 0xBC, 0x0B, 0x40, 0xB4,
-    0x0B, 0x40, 0xB4, 0x00, 0x0A, 0x01, 0xF5, 0x3F, 0xE1, 0xE0, 0x1E, 0x01, 0xE0, 0x0F, 0x50, 0xBE,
-    0x00, 0x00, 0x14, 0x05, 0x0F, 0x07, 0x82, 0xD2, 0xC0, 0x38, 0xF0, 0x0F, 0xB4, 0x01, 0xFC, 0x00,
-    0x3D, 0x00, 0x14, 0x15, 0x2D, 0x3C, 0x0F, 0xF4, 0x07, 0xE0, 0x0B, 0xF0, 0x1E, 0x7C, 0x3C, 0x2E,
-    0x05, 0x50, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xFA, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00,
-    0x02, 0xFF, 0xAA, 0xA8, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF2, 0xFF, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xEA,
-    0xAA, 0xAF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0x0B, 0x80, 0xBC, 0x07, 0xF8,
-    0x3F, 0x81, 0xFE, 0x1F, 0xF0, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xEB, 0xFC, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFE, 0xAA, 0xA2, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xCB, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xEB,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF6, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFA, 0xFF, 0xF4, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x0B, 0xFC,
-    0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x02, 0xFF, 0x04, 0x6F, 0xF8, 0x00, 0x2F, 0xF0, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x0F, 0xFF,
-    0xD0, 0x00, 0x2F, 0xF0, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xD7, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFD, 0x07,
-    0xFF, 0xEA, 0xBF, 0x03, 0xFF, 0x80, 0x01, 0x42, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF9, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x40, 0xBF, 0xFE, 0x5A, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA,
-    0xBF, 0xC7, 0xFC, 0x00, 0x14, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x03, 0xFE, 0xFF,
-    0x95, 0xFF, 0xDF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00,
-    0x00, 0x7F, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF,
-    0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xF1,
-    0xF8, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07,
-    0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC,
-    0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
-    0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF,
-    0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x03,
-    0xFE, 0x0A, 0xBF, 0xF4, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFA, 0xA4, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFD, 0x00, 0x3F, 0xE0, 0x1F, 0xFD, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x3F, 0xC0,
-    0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0x3F,
-    0xE0, 0x03, 0xFE, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0xAA, 0xFF, 0x80, 0x03, 0xFF, 0xAB,
-    0xFF, 0xCF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xEA, 0xAA, 0xBF,
-    0xFA, 0xFF, 0xFC, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x0B, 0xFD, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x03,
-    0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x7F,
-    0xC0, 0x00, 0x3F, 0xD0, 0x0B, 0xFD, 0x7F, 0xC0, 0x00, 0x3F, 0xEA, 0xBF, 0xFC, 0x7F, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x7F, 0xC0, 0x00, 0x3F, 0xFF,
-    0xF9, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF6, 0xBE,
-    0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x2F,
-    0xF0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x0F, 0xFC,
-    0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x01, 0xFF,
-    0x02, 0xFF, 0x00, 0x07, 0xFC, 0x1F, 0xF4, 0x00, 0x1F, 0xFA, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xF0, 0xBF, 0xD0, 0x00,
-    0x7F, 0xC0, 0xFF, 0xC0, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0x07, 0xFC, 0x02, 0xFF, 0x40, 0x1F, 0xF0,
-    0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xFE, 0x01, 0xFF, 0x00, 0x0B, 0xFD, 0x07, 0xFC, 0x00, 0x0F,
-    0xFC, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFD, 0x7F, 0xC0, 0x00, 0xFF,
-    0xF5, 0xFF, 0x00, 0x07, 0xFF, 0xD7, 0xFC, 0x00, 0x3F, 0xFF, 0x5F, 0xF0, 0x01, 0xFF, 0xFD, 0x7F,
-    0xC0, 0x0F, 0xFF, 0xF5, 0xFF, 0x00, 0x7F, 0xBF, 0xD7, 0xFC, 0x03, 0xFC, 0xFF, 0x5F, 0xF0, 0x1F,
-    0xD3, 0xFD, 0x7F, 0xC0, 0xFF, 0x0F, 0xF5, 0xFF, 0x07, 0xF4, 0x3F, 0xD7, 0xFC, 0x3F, 0xC0, 0xFF,
-    0x5F, 0xF1, 0xFD, 0x03, 0xFD, 0x7F, 0xCF, 0xF0, 0x0F, 0xF5, 0xFF, 0x7F, 0x40, 0x3F, 0xD7, 0xFF,
-    0xFC, 0x00, 0xFF, 0x5F, 0xFF, 0xD0, 0x03, 0xFD, 0x7F, 0xFF, 0x00, 0x0F, 0xF5, 0xFF, 0xF4, 0x00,
-    0x3F, 0xD7, 0xFF, 0xC0, 0x00, 0xFF, 0x5F, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x54, 0x00, 0x54, 0x00,
-    0x03, 0xFC, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02,
-    0xFE, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x03, 0xFD, 0x02,
-    0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x1F, 0xF0,
-    0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x2F, 0xD0,
-    0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0A, 0xAF, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0,
-    0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE,
-    0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00,
-    0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7,
-    0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00,
-    0x2F, 0xE7, 0xFE, 0xAA, 0xAB, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x1F,
-    0xF0, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF4,
-    0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x40,
-    0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xE9, 0x00, 0x7F, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x0F, 0xFD, 0x7F, 0xC0, 0x03,
-    0xFD, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x0B, 0xFD, 0x7F, 0xEA, 0xBF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xE9,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xEA, 0xBF, 0xFC, 0xBF, 0xC0, 0x0B,
-    0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x0B, 0xFC, 0xBF, 0xD5, 0xBF,
-    0xF4, 0xBF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xC0, 0x0B,
-    0xFD, 0xBF, 0xC0, 0x03, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFF, 0xBF, 0xC0, 0x07,
-    0xFF, 0xBF, 0xEA, 0xBF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xF8, 0x00, 0x03, 0xFD,
-    0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0x00,
-    0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x80,
-    0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x3F,
-    0xE0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x01, 0xBF, 0xFA, 0xAA,
-    0xAF, 0xFE, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF6, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xDB, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x6F,
-    0xE0, 0x00, 0x00, 0x03, 0xFD, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x54, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x7F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0xBF, 0xC0,
-    0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0x2F, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xFA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFA, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x03, 0xFD, 0x00,
-    0x2F, 0xE0, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x02, 0xFE,
-    0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x40, 0xBF, 0x80, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x2F, 0xE0, 0x3F,
-    0xE0, 0x00, 0x03, 0xFE, 0x0B, 0xF8, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC2, 0xFE, 0x0F, 0xF4, 0x00,
-    0x00, 0x0B, 0xFE, 0xFF, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF8,
-    0xBF, 0x8B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xE0, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x0B, 0xF8,
-    0x1F, 0xF8, 0x00, 0x03, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0xBF, 0x80, 0x3F,
-    0xF0, 0x02, 0xFF, 0x40, 0x2F, 0xE0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0xC0,
-    0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xAA,
-    0xFF, 0xF0, 0x50, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xE0, 0x05, 0x6B, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x7F, 0xEB, 0xE5, 0x5F, 0xFF, 0x2F, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF,
-    0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xF5, 0xFF, 0x00, 0x03, 0xFF, 0xD7,
-    0xFC, 0x00, 0x1F, 0xFF, 0x5F, 0xF0, 0x00, 0xFF, 0xFD, 0x7F, 0xC0, 0x07, 0xFF, 0xF5, 0xFF, 0x00,
-    0x3F, 0xFF, 0xD7, 0xFC, 0x01, 0xFE, 0xFF, 0x5F, 0xF0, 0x0F, 0xF3, 0xFD, 0x7F, 0xC0, 0x7F, 0x4F,
-    0xF5, 0xFF, 0x03, 0xFC, 0x3F, 0xD7, 0xFC, 0x1F, 0xD0, 0xFF, 0x5F, 0xF0, 0xFF, 0x03, 0xFD, 0x7F,
-    0xC7, 0xF4, 0x0F, 0xF5, 0xFF, 0x3F, 0xC0, 0x3F, 0xD7, 0xFD, 0xFD, 0x00, 0xFF, 0x5F, 0xFF, 0xF0,
-    0x03, 0xFD, 0x7F, 0xFF, 0x40, 0x0F, 0xF5, 0xFF, 0xFC, 0x00, 0x3F, 0xD7, 0xFF, 0xD0, 0x00, 0xFF,
-    0x5F, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x03,
-    0xF8, 0x0B, 0xF0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF,
-    0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFD,
-    0x7F, 0xC0, 0x00, 0xFF, 0xF5, 0xFF, 0x00, 0x07, 0xFF, 0xD7, 0xFC, 0x00, 0x3F, 0xFF, 0x5F, 0xF0,
-    0x01, 0xFF, 0xFD, 0x7F, 0xC0, 0x0F, 0xFF, 0xF5, 0xFF, 0x00, 0x7F, 0xBF, 0xD7, 0xFC, 0x03, 0xFC,
-    0xFF, 0x5F, 0xF0, 0x1F, 0xD3, 0xFD, 0x7F, 0xC0, 0xFF, 0x0F, 0xF5, 0xFF, 0x07, 0xF4, 0x3F, 0xD7,
-    0xFC, 0x3F, 0xC0, 0xFF, 0x5F, 0xF1, 0xFD, 0x03, 0xFD, 0x7F, 0xCF, 0xF0, 0x0F, 0xF5, 0xFF, 0x7F,
-    0x40, 0x3F, 0xD7, 0xFF, 0xFC, 0x00, 0xFF, 0x5F, 0xFF, 0xD0, 0x03, 0xFD, 0x7F, 0xFF, 0x00, 0x0F,
-    0xF5, 0xFF, 0xF4, 0x00, 0x3F, 0xD7, 0xFF, 0xC0, 0x00, 0xFF, 0x5F, 0xFD, 0x00, 0x03, 0xFD, 0x7F,
-    0xC0, 0x00, 0xBF, 0xC1, 0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF4, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x0B, 0xFC, 0x00,
-    0x1F, 0xF0, 0x7F, 0xD0, 0x00, 0x7F, 0xEB, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xC2, 0xFF, 0x40, 0x01, 0xFF, 0x03, 0xFF,
-    0x00, 0x07, 0xFC, 0x07, 0xFE, 0x00, 0x1F, 0xF0, 0x0B, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xFC, 0x01,
-    0xFF, 0x00, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0x2F, 0xF4, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x7F, 0xC0,
-    0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x80, 0x0B, 0xFC, 0x01, 0xFE, 0x00, 0x2F, 0xF0,
-    0x0B, 0xF8, 0x00, 0xBF, 0xC0, 0x2F, 0xE0, 0x02, 0xFF, 0x00, 0xBF, 0x40, 0x0B, 0xFC, 0x02, 0xFD,
-    0x00, 0x2F, 0xF0, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x0B,
-    0xFC, 0x03, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x02, 0xFF, 0x02,
-    0xFF, 0x00, 0x0B, 0xFE, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x3F, 0xF9, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xF7, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0x7F, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0xFE, 0xFD, 0x00, 0x0F, 0xEF, 0xF7, 0xF7,
-    0xF8, 0x00, 0x3F, 0x7F, 0xDF, 0xDB, 0xF0, 0x02, 0xFC, 0xFF, 0x7F, 0x5F, 0xC0, 0x0F, 0xE3, 0xFD,
-    0xFE, 0x3F, 0x80, 0x3F, 0x4F, 0xF7, 0xF8, 0xFF, 0x02, 0xFC, 0x3F, 0xDF, 0xE1, 0xFC, 0x0F, 0xE0,
-    0xFF, 0x7F, 0x83, 0xF4, 0x3F, 0x43, 0xFD, 0xFE, 0x0F, 0xF1, 0xFC, 0x0F, 0xF7, 0xF8, 0x2F, 0xCF,
-    0xE0, 0x3F, 0xDF, 0xE0, 0x7F, 0xBF, 0x40, 0xFF, 0x7F, 0x80, 0xFF, 0xFC, 0x03, 0xFD, 0xFE, 0x02,
-    0xFF, 0xE0, 0x0F, 0xF7, 0xF8, 0x07, 0xFF, 0x40, 0x3F, 0xDF, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0x7F,
-    0x80, 0x2F, 0xE0, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x1F, 0xE7, 0xFC, 0x00, 0x02, 0xFF, 0x7F, 0xC0,
-    0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x02, 0xFF, 0x7F, 0xC0, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x02, 0xFF,
-    0x7F, 0xC0, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x02, 0xFF, 0x7F, 0xEA, 0xAA, 0xBF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xC0, 0x00, 0x2F, 0xF7,
-    0xFC, 0x00, 0x02, 0xFF, 0x7F, 0xC0, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x02, 0xFF, 0x7F, 0xC0, 0x00,
-    0x2F, 0xF7, 0xFC, 0x00, 0x02, 0xFF, 0x7F, 0xC0, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x02, 0xFF, 0x7F,
-    0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xEA, 0xFF, 0xF4, 0x03, 0xFF,
-    0x40, 0x0B, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xE0,
-    0x00, 0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC3, 0xFD, 0x00,
-    0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x40,
-    0x07, 0xFF, 0x00, 0xBF, 0xF9, 0x6F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03,
-    0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFC,
-    0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F,
-    0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0,
-    0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x7F, 0xFF, 0xE4, 0x02,
-    0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x2F, 0xFA, 0xFF,
-    0x00, 0x3F, 0xFB, 0xFC, 0x00, 0xBF, 0xEF, 0xF0, 0x02, 0xFF, 0xBF, 0xC0, 0x0F, 0xFA, 0xFF, 0x00,
-    0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xAA, 0x40,
-    0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xEA, 0xFF,
-    0x03, 0xFF, 0x80, 0x01, 0x42, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x40, 0xBF, 0xFE, 0x5A, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0x50, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0xFF, 0x80, 0x00, 0x3F,
-    0xC2, 0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x1F,
-    0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x00, 0xFF, 0x43,
-    0xFD, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x00, 0x07, 0xFB, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x2A, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFD, 0x0F, 0xF0, 0x2F, 0xFC,
-    0x3F, 0xF0, 0x0F, 0xF0, 0x0B, 0xFC, 0x3F, 0xD0, 0x0F, 0xF0, 0x03, 0xFD, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x03, 0xFE, 0x7F, 0xC0, 0x0F, 0xF0, 0x02, 0xFE, 0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFE, 0x3F, 0xD0,
-    0x0F, 0xF0, 0x03, 0xFD, 0x3F, 0xF0, 0x0F, 0xF0, 0x0B, 0xFC, 0x1F, 0xFD, 0x0F, 0xF0, 0x2F, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x2F,
-    0xF0, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xFF,
-    0x01, 0xFF, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00,
-    0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x01, 0xFF, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x40, 0x0B,
-    0xFC, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x2F, 0xF4, 0xBF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x7F, 0xC0, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00,
-    0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00,
-    0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00,
-    0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x03,
-    0xFE, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x1F, 0xFA, 0xAA, 0xAF,
-    0xFE, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x40, 0xFF, 0x40, 0x00, 0xFF,
-    0x7F, 0xD0, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x0F, 0xF7, 0xFD, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00,
-    0xFF, 0x7F, 0xD0, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x0F, 0xF7, 0xFE, 0x00, 0x03, 0xFD, 0xFF, 0xC0,
-    0x00, 0xFF, 0x6F, 0xF8, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x1A, 0xE9, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0xBF, 0xC0, 0x03,
-    0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xEB, 0xFC,
-    0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF,
-    0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xFF,
-    0xAF, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFA, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0xBF, 0xC0,
-    0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFA, 0xFF, 0xAA, 0xAF, 0xFE, 0xAA, 0xBF, 0xEB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x40, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0xFF, 0x40, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF,
-    0x40, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40,
-    0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xBF,
-    0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xBF, 0xC0,
-    0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xBF, 0xC0, 0x03,
-    0xFE, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xBF, 0xC0, 0x03, 0xFE,
-    0x00, 0x0F, 0xF4, 0x0B, 0xFE, 0xAA, 0xBF, 0xFA, 0xAA, 0xFF, 0xE8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0x90,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xD0, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x02, 0xFF,
-    0x40, 0x03, 0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xFA,
-    0xA5, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0xFF, 0x40, 0x0F, 0xF1, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xC7,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0x1F, 0xF0, 0x0B, 0xFF, 0x03, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0x0F,
-    0xF1, 0xFF, 0x00, 0x0F, 0xF4, 0x3F, 0xC7, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x1F, 0xF0, 0x01, 0xFF,
-    0x43, 0xFC, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF1, 0xFF, 0xAB, 0xFF, 0xE0, 0x3F, 0xC7, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x7F, 0xFF, 0xF9, 0x00, 0x0F, 0xF0, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xEA, 0x50, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xC0, 0x2F, 0xFC, 0x7F,
-    0xC0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x07, 0xFD, 0x7F,
-    0xC0, 0x0F, 0xFC, 0x7F, 0xEA, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xEA, 0xFF, 0xF8, 0x05, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x55, 0x55, 0xBF, 0xD0, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x47,
-    0xE9, 0x6B, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x40,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x1F, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80,
-    0x7F, 0xC0, 0x1F, 0xFE, 0xAF, 0xFF, 0x41, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x07, 0xFC, 0x07,
-    0xFC, 0x00, 0x0B, 0xFD, 0x1F, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0xFF, 0x40, 0x00,
-    0x3F, 0xF1, 0xFF, 0xAB, 0xFD, 0x00, 0x00, 0xBF, 0xC7, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF1, 0xFF, 0x03, 0xFC,
-    0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x0F,
-    0xF8, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x07, 0xFC,
-    0x02, 0xFF, 0xE5, 0xBF, 0xF4, 0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xC0, 0x03, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xBF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x03, 0xFC, 0x0B, 0xFC, 0x00, 0x3F,
-    0xC0, 0xBF, 0xC0, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0xF9, 0x57, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x57, 0xFC,
-    0x00, 0x3F, 0xE0, 0x3F, 0xC0, 0x0F, 0xFC, 0x03, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0x3F, 0xE0,
-    0x03, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xC1, 0xFF, 0x40, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x0E,
-    0x40, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x2B, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFE, 0xBF, 0xDB, 0xFD, 0x00, 0xFF, 0x7F, 0xE0, 0x03, 0xFD, 0xFF, 0x80, 0x1F,
-    0xF7, 0xFF, 0x41, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xF9, 0xFD, 0x0B, 0xFF, 0x43, 0xF4,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x90, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC7, 0xFF, 0x80, 0x7F, 0xAF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xF9, 0x1F, 0xFD, 0xBF, 0xE0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF,
-    0xBF, 0xC0, 0x01, 0xFF, 0x7F, 0xC0, 0x02, 0xFF, 0x3F, 0xC0, 0x02, 0xFE, 0x3F, 0xE0, 0x03, 0xFD,
-    0x1F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xE0, 0x1F, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00, 0xFF, 0x8F, 0xFE, 0xBF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0x83, 0xFE, 0x05, 0xFF, 0x8F, 0xF8, 0x01, 0xFF, 0x3F, 0xE0, 0x07,
-    0xFC, 0xFF, 0x80, 0x3F, 0xF3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x40,
-    0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xD5, 0x54, 0xBF, 0x80, 0x00, 0xBF,
-    0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80,
-    0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xD5, 0xBF, 0xC0, 0x00, 0xFE, 0x01, 0xFF, 0x00, 0x07, 0xF8, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x1F,
-    0xF0, 0x00, 0x7F, 0x40, 0x7F, 0xC0, 0x02, 0xFD, 0x01, 0xFF, 0x00, 0x0B, 0xF4, 0x07, 0xFC, 0x00,
-    0x3F, 0xC0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x5F, 0xF9, 0x56, 0xFF, 0x53, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0x0F,
-    0xF7, 0xFC, 0x00, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x00, 0xFF, 0x7F, 0xC0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x1F, 0xF4, 0xFF, 0x40, 0x2F, 0xE7, 0xFC, 0x00, 0x7F, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xE4, 0x06, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0x90, 0x00, 0x05, 0x40, 0x00, 0x3F, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x01, 0xFF,
-    0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x0B, 0xFC, 0x07, 0xF8, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x7F, 0x80,
-    0xFF, 0x00, 0x01, 0xFF, 0x07, 0xF8, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x7F, 0x8B, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFE, 0xBF, 0xEF, 0xF8, 0x00, 0x00, 0xFF, 0x87, 0xF8, 0x7F, 0xD0, 0x00,
-    0x3F, 0xF0, 0x7F, 0x83, 0xFF, 0x00, 0x07, 0xFD, 0x07, 0xF8, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x7F,
-    0x80, 0x7F, 0xD0, 0x3F, 0xF0, 0x07, 0xF8, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x7F, 0x80, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x3F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x0E, 0x00,
-    0x7F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x1A, 0xBF, 0xF4, 0x01, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x55, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF3, 0x90, 0x07,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x50, 0x00, 0xBF,
-    0x80, 0x0F, 0xFD, 0xBF, 0x80, 0x1F, 0xFD, 0xBF, 0x80, 0x3F, 0xFD, 0xBF, 0x80, 0x7F, 0xFD, 0xBF,
-    0x80, 0xFF, 0xFD, 0xBF, 0x82, 0xFE, 0xFD, 0xBF, 0x83, 0xF7, 0xFD, 0xBF, 0x8B, 0xF3, 0xFD, 0xBF,
-    0x4F, 0xD3, 0xFD, 0xBF, 0x6F, 0xC3, 0xFD, 0xBF, 0xBF, 0x03, 0xFD, 0xBF, 0xFE, 0x03, 0xFD, 0xBF,
-    0xFC, 0x03, 0xFD, 0xBF, 0xF8, 0x03, 0xFD, 0xBF, 0xF0, 0x03, 0xFD, 0xBF, 0xE0, 0x03, 0xFD, 0x06,
-    0xA0, 0x0A, 0x80, 0x0B, 0xF0, 0x2F, 0xD0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xFD, 0xBF,
-    0x80, 0x1F, 0xFD, 0xBF, 0x80, 0x3F, 0xFD, 0xBF, 0x80, 0x7F, 0xFD, 0xBF, 0x80, 0xFF, 0xFD, 0xBF,
-    0x82, 0xFE, 0xFD, 0xBF, 0x83, 0xF7, 0xFD, 0xBF, 0x8B, 0xF3, 0xFD, 0xBF, 0x4F, 0xD3, 0xFD, 0xBF,
-    0x6F, 0xC3, 0xFD, 0xBF, 0xBF, 0x03, 0xFD, 0xBF, 0xFE, 0x03, 0xFD, 0xBF, 0xFC, 0x03, 0xFD, 0xBF,
-    0xF8, 0x03, 0xFD, 0xBF, 0xF0, 0x03, 0xFD, 0xBF, 0xE0, 0x03, 0xFD, 0xBF, 0x80, 0x07, 0xFC, 0xBF,
-    0x80, 0x0F, 0xF4, 0xBF, 0x80, 0x3F, 0xE0, 0xBF, 0x80, 0xBF, 0xC0, 0xBF, 0x81, 0xFF, 0x00, 0xBF,
-    0x83, 0xFD, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF,
-    0xEF, 0xFD, 0x00, 0xBF, 0x83, 0xFF, 0x00, 0xBF, 0x81, 0xFF, 0x80, 0xBF, 0x80, 0xBF, 0xD0, 0xBF,
-    0x80, 0x3F, 0xF0, 0xBF, 0x80, 0x0F, 0xFC, 0xBF, 0x80, 0x0B, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xF9, 0x5B, 0xFC, 0x02, 0xFD, 0x01, 0xFF,
-    0x00, 0xBF, 0x40, 0x7F, 0xC0, 0x2F, 0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x01,
-    0xFF, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x5F, 0xF8,
-    0x01, 0xFF, 0x3F, 0xFD, 0x00, 0x7F, 0xCF, 0xFF, 0x00, 0x1F, 0xF3, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0x2F, 0xFF, 0x00, 0x07, 0xFF, 0xCB, 0xFF,
-    0xD0, 0x02, 0xFF, 0xF2, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0xBF, 0xBF, 0x00, 0x7F, 0xFF, 0x2F, 0xDF,
-    0xD0, 0x3F, 0xBF, 0xCB, 0xF7, 0xF8, 0x0F, 0xCF, 0xF2, 0xFD, 0x7F, 0x0B, 0xF3, 0xFC, 0xBF, 0x4F,
-    0xD3, 0xF4, 0xFF, 0x2F, 0xD2, 0xFC, 0xFC, 0x3F, 0xCB, 0xF4, 0x7F, 0xBF, 0x0F, 0xF2, 0xFD, 0x0F,
-    0xFF, 0x43, 0xFC, 0xBF, 0x42, 0xFF, 0xC0, 0xFF, 0x2F, 0xD0, 0x7F, 0xE0, 0x3F, 0xCB, 0xF4, 0x0F,
-    0xF4, 0x0F, 0xF2, 0xFD, 0x02, 0xFC, 0x03, 0xFC, 0xBF, 0x80, 0x0B, 0xFA, 0xFE, 0x00, 0x2F, 0xFB,
-    0xF8, 0x00, 0xBF, 0xEF, 0xE0, 0x02, 0xFF, 0xBF, 0x80, 0x0B, 0xFE, 0xFE, 0x00, 0x2F, 0xFB, 0xFE,
-    0xAA, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xAA, 0xBF, 0xFB, 0xF8, 0x00,
-    0xBF, 0xEF, 0xE0, 0x02, 0xFF, 0xBF, 0x80, 0x0B, 0xFE, 0xFE, 0x00, 0x2F, 0xFB, 0xF8, 0x00, 0xBF,
-    0xEF, 0xE0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xFC, 0x3F, 0xD0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0x80, 0x02, 0xFF, 0xBF, 0x80, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xD0, 0x03, 0xFD, 0x3F, 0xF4, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFA,
-    0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xAF, 0xF5, 0x57, 0xFE, 0xBF, 0x80, 0x0B, 0xFA, 0xFE,
-    0x00, 0x2F, 0xEB, 0xF8, 0x00, 0xBF, 0xAF, 0xE0, 0x02, 0xFE, 0xBF, 0x80, 0x0B, 0xFA, 0xFE, 0x00,
-    0x2F, 0xEB, 0xF8, 0x00, 0xBF, 0xAF, 0xE0, 0x02, 0xFE, 0xBF, 0x80, 0x0B, 0xFA, 0xFE, 0x00, 0x2F,
-    0xEB, 0xF8, 0x00, 0xBF, 0xAF, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xFE, 0x00,
-    0xBF, 0x7F, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0xF5, 0x7F, 0xF4, 0xBF, 0xD0, 0x0F, 0xFC,
-    0xBF, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0x80, 0x03, 0xFC, 0xBF, 0x80, 0x03, 0xFC,
-    0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0xBF, 0xD0, 0x0F, 0xFC, 0xBF, 0xF9, 0x7F, 0xF4,
-    0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0xBF, 0xFF, 0xC0, 0xBF, 0x8B, 0xFF, 0x00, 0xBF, 0x80, 0x50, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0x68, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0xBF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xFF, 0x45, 0x5F, 0xF9, 0x54, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0xBF,
-    0xC0, 0xBF, 0xC0, 0x0F, 0xF4, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x01, 0xFF,
-    0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x07, 0xFC, 0xFF, 0x00,
-    0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xAB, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x2F, 0xF8, 0x7F, 0xC7, 0xFF, 0x43, 0xFE, 0x03, 0xFC, 0x0F, 0xFC, 0x7F, 0xC0, 0x3F,
-    0xC0, 0x7F, 0xCB, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0xBF, 0x80, 0x3F, 0xC0, 0x3F, 0xDB, 0xF8, 0x03,
-    0xFC, 0x03, 0xFD, 0xBF, 0xC0, 0x3F, 0xC0, 0x3F, 0xD7, 0xFC, 0x03, 0xFC, 0x07, 0xFC, 0x3F, 0xE0,
-    0x3F, 0xC0, 0xFF, 0x82, 0xFF, 0x87, 0xFC, 0x7F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x7F, 0xE0, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xC0, 0x1F, 0xF4, 0x7F,
-    0xC0, 0x02, 0xFF, 0x3F, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F,
-    0xF8, 0xFF, 0x80, 0x0B, 0xFC, 0x1F, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xE2,
-    0xFF, 0x40, 0x07, 0xFD, 0xFF, 0x80, 0x0F, 0xF4, 0x3F, 0xE0, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0xFF,
-    0x43, 0xFE, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x0F, 0xF4, 0x3F, 0xE0, 0x03, 0xFD, 0x0F, 0xF8, 0x00,
-    0xFF, 0x43, 0xFE, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x0F, 0xF4, 0x3F, 0xE0, 0x03, 0xFD, 0x0F, 0xF8,
-    0x00, 0xFF, 0x43, 0xFE, 0x00, 0x3F, 0xD0, 0xFF, 0x95, 0x5F, 0xF9, 0x7F, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x7F, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x7F, 0xC0,
-    0x03, 0xFD, 0x3F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x03, 0xFD, 0x3F, 0xFE, 0xAF, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xAF, 0x97, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0xBF, 0x80,
-    0x0F, 0xF0, 0x03, 0xFD, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD,
-    0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0xBF, 0x80, 0x1F, 0xF0,
-    0x03, 0xFD, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0xBF, 0x80,
-    0x1F, 0xF0, 0x03, 0xFD, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD,
-    0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0xBF, 0xD5, 0x6F, 0xF5, 0x57, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0x80,
-    0x1F, 0xF0, 0x03, 0xFD, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0xBF, 0x80, 0x1F, 0xF0, 0x03,
-    0xFD, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0x0B, 0xF8,
-    0x01, 0xFF, 0x00, 0x3F, 0xD0, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0x0B, 0xF8, 0x01, 0xFF, 0x00,
-    0x3F, 0xD0, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0xBF,
-    0x80, 0x1F, 0xF0, 0x03, 0xFD, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0xBF, 0xD5, 0x6F, 0xF5,
-    0x57, 0xFE, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xEA,
-    0xBF, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x03, 0xFD,
-    0x00, 0x7F, 0xD5, 0x7F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFE, 0x40, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xAF, 0xE0, 0x00, 0x00, 0x3F, 0xEB, 0xF8, 0x00,
-    0x00, 0x0F, 0xFA, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0xAF, 0xFF, 0xF9,
-    0x00, 0x3F, 0xEB, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xBF, 0xD5, 0xFF,
-    0xE0, 0xFF, 0xAF, 0xE0, 0x0F, 0xFC, 0x3F, 0xEB, 0xF8, 0x02, 0xFF, 0x0F, 0xFA, 0xFE, 0x00, 0xBF,
-    0xC3, 0xFE, 0xBF, 0xD5, 0xBF, 0xE0, 0xFF, 0xAF, 0xFF, 0xFF, 0xF0, 0x3F, 0xEB, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFA, 0xFF, 0xFF, 0x90, 0x03, 0xFE, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xFE, 0x90, 0x0B, 0xFF, 0xFF,
-    0xF4, 0x2F, 0xFF, 0xFF, 0xF4, 0xBF, 0xEA, 0xFF, 0xF2, 0xFE, 0x00, 0xBF, 0xCB, 0xF8, 0x01, 0xFF,
-    0x2F, 0xE0, 0x0B, 0xFC, 0xBF, 0xD5, 0xBF, 0xF2, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xE0, 0x39, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x6A, 0xAF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x01, 0x55, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF,
-    0x8E, 0x51, 0xBF, 0xF0, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x90, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0xBF, 0x80, 0x2F,
-    0xFF, 0xFC, 0x0B, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0, 0xBF, 0x80, 0xFF, 0xD6, 0xFF, 0x8B, 0xF8, 0x2F,
-    0xF0, 0x0B, 0xFC, 0xBF, 0x83, 0xFE, 0x00, 0x3F, 0xDB, 0xFE, 0xBF, 0xD0, 0x03, 0xFD, 0xBF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xEB, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0xEB, 0xFD, 0x00, 0x3F, 0xDB, 0xF8,
-    0x3F, 0xD0, 0x03, 0xFD, 0xBF, 0x82, 0xFF, 0x00, 0x7F, 0xCB, 0xF8, 0x0F, 0xF9, 0x2F, 0xF8, 0xBF,
-    0x80, 0xBF, 0xFF, 0xFF, 0x0B, 0xF8, 0x02, 0xFF, 0xFF, 0xD0, 0xBF, 0x80, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFD, 0x03, 0xFE, 0x1F, 0xF0, 0x03, 0xFE, 0x1F, 0xF0, 0x03, 0xFE, 0x0F, 0xF8, 0x03,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0xFF, 0xC3,
-    0xFE, 0x02, 0xFF, 0x03, 0xFE, 0x03, 0xFE, 0x03, 0xFE, 0x0F, 0xFC, 0x03, 0xFE, 0x2F, 0xF0, 0x03,
-    0xFE, 0x7F, 0xE0, 0x03, 0xFE, 0x01, 0x55, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0x01, 0xFF, 0x4F, 0xF4,
-    0x02, 0xFE, 0x7F, 0xC0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x6C,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x54, 0x00, 0x01,
-    0xA0, 0x1A, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xC0, 0x7F, 0xD3, 0xFD, 0x00, 0xBF, 0x9F, 0xF0, 0x01, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0x90, 0x1B, 0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFE, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0xBF, 0xF4, 0x02, 0xFE, 0xBF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFE, 0x5F, 0xFE, 0x0B, 0xFD, 0x00, 0xFF, 0xC2, 0xFF, 0x00,
-    0x2F, 0xF0, 0xBF, 0xC0, 0x07, 0xFC, 0x2F, 0xE0, 0x01, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xC2, 0xFE,
-    0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x07, 0xFC, 0x2F, 0xE0, 0x01, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xC2,
-    0xFE, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0A, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0x55, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xD5, 0x54, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00,
-    0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF,
-    0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xF9, 0x07, 0x03, 0xFE, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x0B, 0xFE, 0xAA, 0x80, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xBF, 0xD5,
-    0x54, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFF, 0x90, 0x68, 0x1F, 0xFF, 0xFF, 0x80,
-    0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x42, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF4, 0xBF, 0x80, 0x1C, 0x3F, 0xE0, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xFF, 0x7D, 0x00, 0x7F, 0xCF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xE0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xFF, 0xFF, 0x7F, 0x40, 0x00, 0x02, 0xFE, 0xBF,
-    0xAF, 0xEB, 0xFA, 0xFE, 0xBF, 0xAF, 0xEB, 0xFA, 0xFE, 0xBF, 0xAF, 0xEB, 0xFA, 0xFE, 0xBF, 0xAF,
-    0xEB, 0xF8, 0x00, 0x00, 0x0F, 0xCB, 0xC7, 0xF3, 0xF4, 0xFC, 0xFD, 0x3E, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0x02,
-    0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B,
-    0xFC, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xF8, 0x03, 0xFE, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03,
-    0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F,
-    0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F,
-    0xD6, 0xBF, 0xF6, 0xFF, 0xFC, 0xBF, 0xFD, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x5B,
-    0xFC, 0x00, 0x00, 0x01, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xBF, 0xFF, 0xE4, 0x00,
-    0x1F, 0xD0, 0x2F, 0xFF, 0xFF, 0xD0, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFD, 0x02, 0xFF,
-    0x57, 0xFF, 0x80, 0xBF, 0x40, 0xBF, 0xC0, 0x2F, 0xF0, 0x2F, 0xC0, 0x2F, 0xF0, 0x07, 0xFC, 0x0F,
-    0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x5B, 0xFC, 0x02, 0xFF, 0x56, 0xFF, 0xBF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xD3, 0xFF, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x00,
-    0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x0F,
-    0xF8, 0x00, 0x00, 0xBF, 0xD5, 0x5F, 0xF9, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0x80, 0x0F, 0xF8, 0x07,
-    0xFE, 0xBF, 0x80, 0x0F, 0xF8, 0x02, 0xFF, 0xBF, 0x80, 0x0F, 0xF8, 0x02, 0xFF, 0xBF, 0x80, 0x0F,
-    0xF9, 0x5B, 0xFE, 0xBF, 0x80, 0x0F, 0xFF, 0xFF, 0xFC, 0xBF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0xBF,
-    0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0xBF, 0xF4, 0x02, 0xFE, 0xBF, 0xFF, 0x80,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFE, 0x5F, 0xFE, 0x0B, 0xFD, 0x00, 0xFF, 0xC2, 0xFF, 0x00, 0x2F,
-    0xF0, 0xBF, 0xC0, 0x07, 0xFC, 0x2F, 0xE0, 0x01, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xC2, 0xFE, 0x00,
-    0x1F, 0xF0, 0xBF, 0x80, 0x07, 0xFC, 0x2F, 0xE0, 0x01, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xC2, 0xFE,
-    0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x0F, 0xF4, 0xBF, 0x80, 0x3F, 0xE0, 0xBF,
-    0x80, 0xBF, 0xC0, 0xBF, 0x81, 0xFF, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0xBF, 0x83, 0xFF, 0x00, 0xBF,
-    0x81, 0xFF, 0x80, 0xBF, 0x80, 0xBF, 0xD0, 0xBF, 0x80, 0x3F, 0xF0, 0xBF, 0x80, 0x0F, 0xFC, 0xBF,
-    0x80, 0x0B, 0xFD, 0x01, 0x55, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x0F, 0xFD, 0xBF, 0x80, 0x1F, 0xFD, 0xBF, 0x80, 0x3F, 0xFD, 0xBF, 0x80, 0x7F, 0xFD, 0xBF,
-    0x80, 0xFF, 0xFD, 0xBF, 0x82, 0xFE, 0xFD, 0xBF, 0x83, 0xF7, 0xFD, 0xBF, 0x8B, 0xF3, 0xFD, 0xBF,
-    0x4F, 0xD3, 0xFD, 0xBF, 0x6F, 0xC3, 0xFD, 0xBF, 0xBF, 0x03, 0xFD, 0xBF, 0xFE, 0x03, 0xFD, 0xBF,
-    0xFC, 0x03, 0xFD, 0xBF, 0xF8, 0x03, 0xFD, 0xBF, 0xF0, 0x03, 0xFD, 0xBF, 0xE0, 0x03, 0xFD, 0x00,
-    0x6A, 0x00, 0xA8, 0x00, 0x0B, 0xF0, 0x2F, 0xD0, 0x00, 0x7F, 0xD7, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFD, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xFF,
-    0x40, 0x7F, 0xC0, 0x1F, 0xF0, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0xFF,
-    0x07, 0xFC, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x7F, 0xCF, 0xF0, 0x00, 0x03, 0xFD, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0A, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFA, 0xFE, 0x00, 0x2F, 0xEB, 0xF8, 0x00,
-    0xBF, 0xAF, 0xE0, 0x02, 0xFE, 0xBF, 0x80, 0x0B, 0xFA, 0xFE, 0x00, 0x2F, 0xEB, 0xF8, 0x00, 0xBF,
-    0xAF, 0xE0, 0x02, 0xFE, 0xBF, 0x80, 0x0B, 0xFA, 0xFE, 0x00, 0x2F, 0xEB, 0xF8, 0x00, 0xBF, 0xAF,
-    0xE0, 0x02, 0xFE, 0xBF, 0xD5, 0x5F, 0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x7F, 0xD0, 0x02, 0xFF,
-    0x00, 0x07, 0xFC, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x07,
-    0xFC, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x3F,
-    0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x2F, 0xF0, 0x01, 0xFF, 0xC0, 0x0F, 0xF8, 0x1F, 0xF4, 0x03,
-    0xFF, 0xC0, 0x0F, 0xF4, 0x0F, 0xF8, 0x03, 0xFF, 0xC0, 0x0F, 0xF4, 0x0F, 0xFC, 0x07, 0xFF, 0xD0,
-    0x1F, 0xF0, 0x0B, 0xFC, 0x0F, 0xFF, 0xE0, 0x1F, 0xF0, 0x03, 0xFD, 0x0F, 0xFF, 0xF0, 0x2F, 0xE0,
-    0x03, 0xFE, 0x1F, 0xDF, 0xF4, 0x3F, 0xD0, 0x01, 0xFF, 0x2F, 0xCF, 0xF8, 0x7F, 0xC0, 0x00, 0xFF,
-    0x7F, 0x87, 0xFC, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x43, 0xFE, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0xBF, 0x9F, 0xF0,
-    0x01, 0xFF, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0xFF, 0x40, 0x1F, 0xF0, 0x03,
-    0xFD, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0x7F, 0xC1, 0xFF, 0x00,
-    0x3F, 0xE0, 0x2F, 0xE0, 0x3F, 0xC0, 0x2F, 0xFC, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xFF, 0x03, 0xFC,
-    0x01, 0xFE, 0x0B, 0xFF, 0xE1, 0xFF, 0x00, 0x3F, 0xC3, 0xFB, 0xFC, 0xBF, 0x40, 0x0B, 0xF6, 0xFC,
-    0xFF, 0x3F, 0xC0, 0x00, 0xFF, 0xFD, 0x1F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x02, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xFE, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x00, 0x7F, 0xF0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x1F,
-    0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0xAF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFA, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFC,
-    0x05, 0xFF, 0xC0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x7F,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0xF9, 0x07, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF5, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x0F, 0xFF, 0xEA, 0xFF, 0x1F, 0xF0,
-    0x0B, 0xFE, 0x00, 0x02, 0x47, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xFA, 0xBF, 0xFA, 0xAA, 0xA0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x47,
-    0xFC, 0x01, 0xFF, 0xF9, 0x5B, 0xF1, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xFF, 0x8F, 0xF8, 0x00, 0xFF, 0xFF, 0xF7, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0xBF, 0xE0, 0x19, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x0F, 0xF8,
-    0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0xAF, 0xFA, 0xAA, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80,
-    0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x2F, 0xF4, 0x01, 0xCF, 0xF8, 0x03, 0xFF, 0xFF, 0xF3, 0xFE, 0x00,
-    0x3F, 0xFF, 0xFC, 0xFF, 0x80, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00,
-    0x2F, 0xC0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0x95, 0xBF, 0x80, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFC, 0x7F, 0x8F, 0xF0, 0x00, 0x3F, 0xC7, 0xF8, 0x7F, 0x40, 0x0B, 0xF4, 0x7F, 0x83, 0xFC,
-    0x00, 0xFF, 0x07, 0xF8, 0x3F, 0xC0, 0x1F, 0xF0, 0x7F, 0x81, 0xFE, 0x02, 0xFD, 0x07, 0xF8, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x47, 0xFC, 0x07, 0xF8, 0x07, 0xF8, 0xFF, 0x40, 0x7F, 0x80,
-    0x3F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xF7, 0xF4, 0x00, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0x00, 0x0F,
-    0xE0, 0x3F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0x2F, 0xC7, 0xF4, 0x03, 0xFC, 0xBF, 0x0F, 0xF0, 0x2F, 0xD2, 0xFC, 0x3F, 0xC0,
-    0xFF, 0x0B, 0xF0, 0x7F, 0x87, 0xF8, 0x2F, 0xC0, 0xFF, 0x3F, 0xD0, 0xBF, 0x02, 0xFD, 0x7F, 0xC0,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xBF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x2F, 0xC0,
-    0x00, 0x7F, 0xC0, 0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x7F, 0xC0, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x7F, 0xEA, 0xAB, 0xF9, 0x5B, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xC7, 0xF8, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xC7, 0xF8, 0x7F, 0x40,
-    0x7F, 0xC0, 0xBF, 0x47, 0xF8, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x07, 0xF8, 0x3F, 0xC0, 0x7F, 0xC1,
-    0xFF, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0xC2, 0xFD, 0x07, 0xF8, 0x0F, 0xF0, 0x7F, 0xC3, 0xFC, 0x07,
-    0xF8, 0x0F, 0xF4, 0x7F, 0xC7, 0xFC, 0x07, 0xF8, 0x07, 0xF8, 0x7F, 0xCF, 0xF8, 0x07, 0xF8, 0x03,
-    0xFC, 0xBF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x2F, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0xFD, 0x00,
-    0x2F, 0xC0, 0x03, 0xFC, 0x3F, 0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x5B, 0xF4, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xD5, 0x7F, 0xEF, 0xFB, 0xF8, 0x0B,
-    0xF0, 0x0F, 0xF3, 0xFC, 0xFF, 0x02, 0xFC, 0x07, 0xF4, 0xFF, 0x1F, 0xD0, 0xBF, 0x03, 0xFC, 0x3F,
-    0xC3, 0xFC, 0x2F, 0xC1, 0xFE, 0x0F, 0xF0, 0xFF, 0x4B, 0xF0, 0xBF, 0x43, 0xFC, 0x1F, 0xE2, 0xFC,
-    0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x2F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xAF, 0xF7, 0xFF, 0x00,
-    0x0F, 0xF8, 0x7F, 0xC3, 0xFD, 0x00, 0x7F, 0xC1, 0xFF, 0x0B, 0xF8, 0x02, 0xFF, 0x07, 0xFC, 0x1F,
-    0xF0, 0x0F, 0xF4, 0x1F, 0xF0, 0x3F, 0xD0, 0x7F, 0xC0, 0x7F, 0xC0, 0xBF, 0x82, 0xFF, 0x01, 0xFF,
-    0x01, 0xFF, 0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xF8, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x2F, 0xD0,
-    0x00, 0xFE, 0x0B, 0xF4, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF2, 0xFC, 0xBF, 0x00,
-    0xFD, 0x2F, 0xC3, 0xF4, 0x2F, 0xC2, 0xFC, 0x3F, 0x83, 0xFC, 0x2F, 0xC2, 0xFC, 0x3F, 0x42, 0xFC,
-    0x1F, 0xDB, 0xF0, 0x2F, 0xC0, 0xFE, 0x7F, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF0, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x3F,
-    0xC0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00,
-    0x7F, 0xEA, 0xAA, 0xBF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xC0, 0x1F,
-    0xFA, 0xFF, 0x7F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF4, 0xBF, 0xC7, 0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x2F,
-    0xF0, 0xFF, 0x81, 0xFF, 0x02, 0xFE, 0x0B, 0xFC, 0x1F, 0xF0, 0x7F, 0xC0, 0xFF, 0x42, 0xFF, 0x03,
-    0xFC, 0x1F, 0xF0, 0x7F, 0xC0, 0xBF, 0xC0, 0xFF, 0x87, 0xFC, 0x2F, 0xE0, 0x2F, 0xF0, 0x2F, 0xF1,
-    0xFF, 0x0F, 0xF4, 0x0B, 0xFC, 0x03, 0xFC, 0x7F, 0xC7, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0xBF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0xBF, 0x00, 0xBF, 0x40, 0x7F, 0xC0, 0xBF, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0xBF, 0x00, 0x0F,
-    0xF3, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0x55, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0x01, 0xFD, 0x3F, 0x8F,
-    0xE0, 0xBF, 0x02, 0xFC, 0x3F, 0x8B, 0xF0, 0xBF, 0x03, 0xF8, 0x3F, 0x87, 0xF0, 0xBF, 0x07, 0xF4,
-    0x3F, 0x83, 0xF8, 0xBF, 0x0B, 0xF0, 0x3F, 0x83, 0xFC, 0xBF, 0x0F, 0xE0, 0x3F, 0x81, 0xFC, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x2F, 0x80, 0x2F, 0xD0, 0x00, 0xFE, 0x0B, 0xFD, 0x00, 0x03, 0xFA, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0x5B, 0xFF, 0x40, 0xA0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x06, 0xAB, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xF9, 0x00, 0x7F, 0xE5, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0xA0, 0x07, 0xF0, 0x0F, 0xF4, 0x01, 0xFC, 0x3F, 0xA4,
-    0x00, 0xBF, 0xFD, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x0A, 0x40, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x02, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFE, 0x40, 0x7F, 0xD5, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x40,
-    0x7F, 0x80, 0x3F, 0x80, 0x3F, 0xCB, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0xBF, 0x80, 0x3F, 0xC0, 0x3F,
-    0xCB, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0xBF, 0x80, 0x3F, 0xC0, 0x3F, 0xCB, 0xF8, 0x03, 0xFC, 0x03,
-    0xFC, 0xBF, 0x80, 0x3F, 0xC0, 0x3F, 0xCB, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x7F, 0x80, 0x3F, 0xC0,
-    0x3F, 0xC7, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x3F, 0xD0, 0x3F, 0xC0, 0xBF, 0x82, 0xFF, 0x43, 0xFC,
-    0x2F, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x6B, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xF4, 0xFF, 0x40,
-    0xFF, 0x02, 0xFE, 0x3F, 0xD0, 0x3F, 0xC0, 0x7F, 0xCF, 0xF4, 0x0F, 0xF0, 0x0F, 0xF3, 0xFD, 0x03,
-    0xFC, 0x03, 0xFD, 0xFF, 0x40, 0xFF, 0x00, 0xFF, 0x7F, 0xD0, 0x3F, 0xC0, 0x3F, 0xDF, 0xF4, 0x0F,
-    0xF0, 0x0F, 0xF7, 0xFD, 0x03, 0xFC, 0x03, 0xFD, 0xFF, 0x40, 0xFF, 0x00, 0xFF, 0x7F, 0xE0, 0x3F,
-    0xC0, 0x7F, 0xCB, 0xFC, 0x0F, 0xF0, 0x3F, 0xF0, 0xFF, 0xE7, 0xFD, 0xBF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0x95, 0xBF, 0xF8, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x1F, 0xF5, 0x55, 0x55, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xF0, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0xBF, 0xF9, 0x5B, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF9, 0x6F, 0xF8, 0x3F,
-    0xE0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xEA, 0xAB, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFE, 0xBF, 0xEA, 0xAB, 0xFE, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xD0, 0x07, 0xFC, 0x2F,
-    0xF9, 0x2F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xFF, 0xE3, 0xFC, 0x00,
-    0x00, 0xFF, 0xF8, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x03, 0xFC, 0x00,
-    0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x02, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x03, 0xFC, 0x0F,
-    0xF0, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x1F, 0xE2, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0xE3,
-    0xFD, 0x00, 0x1F, 0xFE, 0x2F, 0xE0, 0x03, 0xFF, 0x51, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x0B,
-    0xF8, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0x3F, 0xD2, 0xFD, 0x00, 0x01,
-    0xFE, 0x3F, 0xC0, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0xBF, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x05,
-    0x50, 0x55, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x00, 0x03,
-    0xF8, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x8F, 0xF0,
-    0x00, 0x03, 0xFF, 0xE3, 0xFE, 0x00, 0x01, 0xFF, 0xE8, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x0F, 0xF0,
-    0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x00, 0x0F, 0xF0,
-    0x03, 0xFD, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0x80, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0x8B, 0xF8, 0x00, 0x00, 0x0F, 0xF3,
-    0xFC, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x15, 0x41, 0x50, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x00,
-    0x3F, 0x47, 0xF0, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0xE3, 0xFD, 0x00, 0x1F, 0xFE, 0x2F,
-    0xE0, 0x03, 0xFF, 0x51, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0xFF,
-    0x40, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0x3F, 0xD2, 0xFD, 0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF7, 0xF8, 0x00, 0x00, 0xBF, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xAA, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x00,
-    0xBF, 0xC2, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0x83,
-    0xFD, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x1F, 0xF0, 0x7F, 0xD0, 0x00, 0x03, 0xFD, 0x07, 0xFC,
-    0x02, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x3F, 0xD0, 0x7F, 0xD0, 0x00, 0x03,
-    0xFD, 0x02, 0xFF, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0xBF, 0x80, 0x3F,
-    0xE0, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x4F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFD,
-    0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x40, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x96, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x03,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF4,
-    0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xF4, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0xBF, 0xC0, 0x2F,
-    0xE0, 0x7F, 0xC0, 0x03, 0xFE, 0x03, 0xFC, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xD0,
-    0x7F, 0xC0, 0xBF, 0xC0, 0x02, 0xFF, 0x01, 0xFE, 0x0B, 0xF8, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F,
-    0xF0, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0x5F, 0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xE0,
-    0x03, 0xFA, 0xFD, 0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x02, 0xFF, 0x81, 0xFF,
-    0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFE, 0x2F, 0xCB, 0xFF,
-    0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x0B,
-    0xFD, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x00,
-    0x3F, 0xE7, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00,
-    0x07, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x0F, 0xFE, 0x1F,
-    0x87, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xBF, 0xEF, 0xF4, 0x3F,
-    0xE0, 0xF0, 0xFF, 0xC7, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xDB, 0xFC, 0x00, 0x03,
-    0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xD3, 0xFE,
-    0x0A, 0x0B, 0xFC, 0x1F, 0xFB, 0xFE, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x41,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x53, 0xF0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x5F, 0x00, 0x1E, 0x5F, 0xFE, 0x01, 0xFF,
-    0x80, 0x10, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x43, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x83, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x0F,
-    0xF8, 0x1F, 0xF4, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0xFF, 0xD0, 0x0B, 0xFC, 0x00, 0xBF, 0xF0,
-    0x0B, 0xFF, 0xEB, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFD, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x5B, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xD2, 0x46, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x7F, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xE0, 0x2F, 0xF9, 0x60, 0x01, 0x97, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xBF, 0xC0, 0x01, 0x54, 0x00,
-    0x7F, 0xCB, 0xFC, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xBF, 0xC7, 0xFC,
-    0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x83, 0xFF, 0x96, 0xFF, 0xF5,
-    0x7F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x38, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x7F, 0xD0, 0x02,
-    0xFF, 0x00, 0x07, 0xFC, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x01, 0xFF, 0x00,
-    0x07, 0xFC, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC,
-    0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x2F, 0xF0, 0x01, 0xFF, 0xC0, 0x0F, 0xF8, 0x1F, 0xF4,
-    0x03, 0xFF, 0xC0, 0x0F, 0xF4, 0x0F, 0xF8, 0x03, 0xFF, 0xC0, 0x0F, 0xF4, 0x0F, 0xFC, 0x07, 0xFF,
-    0xD0, 0x1F, 0xF0, 0x0B, 0xFC, 0x0F, 0xFF, 0xE0, 0x1F, 0xF0, 0x03, 0xFD, 0x0F, 0xFF, 0xF0, 0x2F,
-    0xE0, 0x03, 0xFE, 0x1F, 0xDF, 0xF4, 0x3F, 0xD0, 0x01, 0xFF, 0x2F, 0xCF, 0xF8, 0x7F, 0xC0, 0x00,
-    0xFF, 0x7F, 0x87, 0xFC, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x43, 0xFE, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0x01, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0x07, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0xBF, 0xC0, 0x0B, 0xF9, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
-    0xFF, 0x4F, 0xF4, 0x01, 0xFF, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0xBF, 0x80,
-    0x0F, 0xF8, 0x07, 0xFC, 0x1F, 0xF0, 0x03, 0xFE, 0x02, 0xFE, 0x03, 0xFC, 0x02, 0xFF, 0xC0, 0xFF,
-    0x40, 0xFF, 0x40, 0xFF, 0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0xBF, 0xFE, 0x1F, 0xF0, 0x03, 0xFC, 0x3F,
-    0xBF, 0xCB, 0xF4, 0x00, 0xBF, 0x6F, 0xCF, 0xF3, 0xFC, 0x00, 0x0F, 0xFF, 0xD1, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xF0, 0x2F, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFA, 0xBF, 0xC0, 0xFF, 0xE0, 0x00, 0x24, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xE5, 0x6A, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x07, 0xFF, 0xFF,
-    0xC1, 0xFF, 0xFF, 0xFC, 0x3F, 0xF9, 0x5B, 0x43, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x03, 0xFF, 0x91, 0x60, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x38, 0x0B, 0xC0, 0x00, 0x7F, 0x5F, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x02, 0xF2, 0xFC, 0x10, 0x03,
-    0xD0, 0x38, 0x3D, 0x0B, 0x80, 0x00, 0x3F, 0xDF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xF1, 0xFC, 0x00, 0x03, 0xD0, 0x18, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x3F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0xBE, 0x55, 0x50, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x1B, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x7F, 0xE0, 0x3F, 0x10, 0x00, 0x05, 0x00, 0x1F,
-    0xCF, 0xF7, 0xF4, 0xBC, 0x0F, 0xD0, 0x64, 0x00, 0x2F, 0xCF, 0xF4, 0xBD, 0x1F, 0x3F, 0x49, 0x00,
-    0x06, 0xA0, 0x00, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0xBE, 0x5F, 0xFE, 0xBC, 0x00, 0xAE, 0x00,
-    0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x1C, 0x03, 0x40, 0x00, 0x00,
-    0x2C, 0x07, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x87, 0x56,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x75, 0x6D, 0x60, 0x09, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xC0, 0x34, 0x00, 0x00,
-    0x02, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0x0F, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xA8, 0x00, 0x2A, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x0F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x59, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xFF, 0x40, 0x07, 0xF8,
-    0x00, 0x0F, 0xFF, 0xD0, 0x01, 0xFE, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x03, 0xFE, 0xFD,
-    0x00, 0x1F, 0xE0, 0x02, 0xFE, 0x7F, 0x40, 0x07, 0xF8, 0x01, 0xFF, 0x1F, 0xD0, 0x01, 0xFE, 0x00,
-    0xFF, 0x87, 0xF4, 0x00, 0x7F, 0x80, 0xBF, 0xC2, 0xFD, 0x00, 0x1F, 0xE0, 0x3F, 0xD0, 0xBF, 0x40,
-    0x07, 0xF8, 0x3F, 0xE0, 0x2F, 0xD0, 0x01, 0xFE, 0x1F, 0xF0, 0x0B, 0xF4, 0x00, 0x7F, 0x8F, 0xF4,
-    0x02, 0xFD, 0x00, 0x1F, 0xDB, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xFB, 0xFD, 0x00, 0x2F, 0xD0, 0x01,
-    0xFF, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x1F, 0xFF, 0x40, 0x00,
-    0xBF, 0xFF, 0xC7, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE1, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0xBF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0x40, 0x07, 0xFF, 0x80, 0x2F, 0xD0, 0x03, 0xFF, 0xE0, 0x0B,
-    0xF4, 0x02, 0xFF, 0xF8, 0x02, 0xFD, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0x40, 0xFF, 0xBF, 0x80, 0x2F,
-    0xD0, 0xBF, 0x9F, 0xE0, 0x0B, 0xF4, 0x7F, 0xC7, 0xF8, 0x02, 0xFD, 0x3F, 0xD1, 0xFE, 0x00, 0xBF,
-    0x6F, 0xF0, 0x7F, 0x80, 0x2F, 0xEF, 0xF0, 0x1F, 0xE0, 0x0B, 0xFF, 0xF4, 0x07, 0xF8, 0x02, 0xFF,
-    0xFC, 0x01, 0xFF, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xEF, 0xFD, 0x00, 0x1F, 0xFF, 0xEB, 0xFF,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xA8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xFE, 0xA8,
-    0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0x40, 0x00, 0x7F, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x7F,
-    0xC0, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0xFF,
-    0xC0, 0x7F, 0xEA, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0xA4, 0x00, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFC, 0x0B, 0xF8, 0x06, 0xFF, 0x82, 0xFE, 0x00, 0x2F, 0xF0,
-    0xBF, 0x80, 0x0B, 0xFC, 0x2F, 0xE0, 0x07, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE4, 0x01, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x7F, 0xC0, 0x1F, 0xF9, 0xFF, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x7F, 0xDF,
-    0xF0, 0x72, 0xFF, 0x7F, 0xC7, 0xEF, 0xFD, 0xFF, 0x0F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0x81, 0xFF, 0xAA, 0x7F, 0x07, 0xFC, 0x00, 0x7C, 0x1F, 0xF0, 0x00,
-    0x40, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xFE, 0x00, 0xBF, 0x7F, 0xFF, 0xC0,
-    0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0xF5, 0x7F, 0xF4, 0xBF, 0xD0, 0x0F, 0xF8, 0xBF, 0xC0, 0x0B, 0xFC,
-    0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x81, 0xD7, 0xFC,
-    0xBF, 0xC7, 0xFF, 0xFC, 0xBF, 0xD2, 0xFF, 0xF8, 0xBF, 0xF5, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xBF, 0xFF, 0xD0, 0xBF, 0x8F, 0xFF, 0xF0, 0xBF, 0x80, 0x53, 0xF0, 0xBF, 0x80, 0x01, 0xC0,
-    0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF5, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xD5,
-    0x55, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00,
-    0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF,
-    0x80, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2B, 0xFE, 0xAA, 0x40, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xEA, 0xA9, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x5F, 0xF9,
-    0x54, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0x90, 0x00, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x56, 0xFF, 0xF8,
-    0x7F, 0xC0, 0x01, 0xFF, 0xC7, 0xFC, 0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00,
-    0x02, 0xFF, 0x7F, 0xC0, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xAF,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xFA, 0xAA, 0x80, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFE, 0x0B, 0xFE, 0xBF, 0xFD, 0x2F, 0xE0, 0x0F,
-    0xFC, 0xBF, 0x80, 0x0F, 0xF6, 0xFE, 0x00, 0x3F, 0xDB, 0xF8, 0x00, 0xBF, 0xAF, 0xE0, 0x02, 0xFE,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x3A, 0xBF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0xFE, 0x00, 0x0B, 0xF8, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x01,
-    0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x01, 0xFF,
-    0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0x0B,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0xEF, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xDF, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0xFF, 0x3F, 0xE0, 0x00, 0x00,
-    0x03, 0xFE, 0x1F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC1, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x0F,
-    0xF4, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0xC0,
-    0x1F, 0xF0, 0x0B, 0xFF, 0xFD, 0x1F, 0xF4, 0x01, 0xFF, 0x00, 0x3F, 0xFF, 0xD3, 0xFE, 0x00, 0x1F,
-    0xF0, 0x00, 0xFF, 0xFD, 0xBF, 0xC0, 0x01, 0xFF, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFF,
-    0x00, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0xFF,
-    0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0x3F, 0xD0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0xFF, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC0,
-    0xFF, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0xFF, 0x02, 0xFF, 0x55, 0x03, 0xFE, 0x00, 0xFF, 0x00,
-    0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0x2F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xAA, 0xFF, 0xF0, 0x50, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x05, 0x6B, 0xFF, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xEB, 0xE5, 0x5F,
-    0xFF, 0x2F, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xE0, 0x00, 0x01, 0xBC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x3F, 0xFF,
-    0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x0E, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0,
-    0x1A, 0xBF, 0xF4, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x55, 0xBF, 0xD0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x2F, 0xF3, 0x90, 0x07, 0xFF, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF8,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xA8, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80,
-    0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x7F,
-    0xC0, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x7F, 0xC3,
-    0xFE, 0x00, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x00, 0x7F, 0xDF, 0xF8, 0x00, 0x00, 0x7F, 0xC7, 0xFD, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0x00,
-    0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0x2F, 0xF4, 0x00,
-    0x7F, 0xC0, 0x0F, 0xFF, 0xFD, 0x7F, 0xC0, 0x03, 0xFF, 0xFD, 0x7F, 0xC0, 0x01, 0xFF, 0xFD, 0x7F,
-    0xC0, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x3F, 0xE0, 0x0B, 0xFD, 0x0F,
-    0xF8, 0x07, 0xFD, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x3F, 0xE2, 0xFF, 0x00,
-    0x0F, 0xF9, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xBF, 0xF0, 0x00, 0x3F, 0xE3, 0xFE,
-    0x00, 0x0F, 0xF8, 0x7F, 0xE0, 0x03, 0xFE, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xFF, 0xD5, 0x7F, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x0A, 0xA0, 0x7F, 0xC0, 0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x3F, 0xF0, 0xBF, 0xC7,
-    0x8B, 0xFD, 0x0B, 0xFC, 0x78, 0xFF, 0x80, 0xBF, 0xC7, 0xFF, 0xF0, 0x0B, 0xFC, 0x7F, 0xFC, 0x00,
-    0xBF, 0xC7, 0xFF, 0x40, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0xBF, 0xCF, 0xFC, 0x00, 0x0B, 0xFE, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0B, 0xFD, 0xFF, 0x80, 0x00, 0xBF, 0xCB, 0xFD, 0x00, 0x0B,
-    0xFC, 0x7F, 0xF0, 0x00, 0xBF, 0xC7, 0xFF, 0xC0, 0x0B, 0xFC, 0x7F, 0xFE, 0x00, 0xBF, 0xC7, 0xBF,
-    0xF4, 0x0B, 0xFC, 0x78, 0xFF, 0xC0, 0xBF, 0xC1, 0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x2F, 0xF4, 0xBF,
-    0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0xFF, 0x8A, 0x2F, 0xF4, 0xFF, 0x8F, 0x7F, 0xD0,
-    0xFF, 0x8F, 0xFF, 0x80, 0xFF, 0x8F, 0xFF, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0xFF, 0x9F, 0xF0, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xF0, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0xFF, 0x8F, 0xFD, 0x00,
-    0xFF, 0x8F, 0xFF, 0x40, 0xFF, 0x8F, 0xFF, 0xC0, 0xFF, 0x8F, 0x3F, 0xF0, 0xFF, 0x8A, 0x1F, 0xF8,
-    0xFF, 0x80, 0x07, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xD0, 0xBF, 0xFF,
-    0x40, 0xFF, 0xC0, 0xFF, 0xFF, 0x82, 0xFF, 0x00, 0xFF, 0xFF, 0x87, 0xFD, 0x00, 0xBF, 0xFA, 0x4F,
-    0xF8, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x7F, 0xD0, 0x00, 0x1F, 0xFA, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xF0, 0xBF, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x1F, 0xF8, 0x00, 0x1F,
-    0xF0, 0x0B, 0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x80, 0x1F, 0xF0,
-    0x00, 0xBF, 0xD0, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x2F, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0x40, 0x2F, 0xE0, 0x0F, 0xF8, 0x00, 0xBF, 0x80, 0xFF,
-    0xC0, 0x02, 0xFE, 0x0B, 0xFC, 0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0x02, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xF8, 0xFF, 0xC0, 0x00, 0x2F, 0xE1,
-    0xFF, 0x80, 0x00, 0xBF, 0x81, 0xFF, 0x40, 0x02, 0xFE, 0x02, 0xFF, 0x40, 0x0B, 0xF8, 0x03, 0xFF,
-    0x00, 0x2F, 0xE0, 0x03, 0xFF, 0x00, 0xBF, 0x80, 0x07, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0x8F, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0xFF, 0xC0, 0x03, 0xFD, 0x0F, 0xFF, 0xFC, 0x00, 0xFF,
-    0x80, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0xFF,
-    0x40, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC7,
-    0xFD, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x07, 0xFC,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFD, 0x3F, 0xFF, 0xF0, 0x03, 0xFE, 0x0F, 0xFF, 0xFC, 0x02, 0xFE, 0x01, 0x55,
-    0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x03,
-    0xFC, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x00, 0x0F,
-    0xF2, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0xFF,
-    0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xC0,
-    0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x07, 0xFC,
-    0x00, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x7F,
-    0xEA, 0xAA, 0xBF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00,
-    0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0,
-    0x07, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x00, 0x2F, 0xFF, 0xF7, 0xFC, 0x00, 0x02, 0xFF,
-    0xFF, 0x7F, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07,
-    0xFC, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x01, 0xFF, 0x00,
-    0xBF, 0x80, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0x55, 0x6F, 0xF0, 0x0B, 0xF8, 0x00, 0x7F,
-    0xC0, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x1F, 0xFF, 0xFB,
-    0xF8, 0x00, 0x7F, 0xFF, 0xEF, 0xE0, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x7F, 0xC0, 0x00, 0x2F, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xD7, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x5F, 0xF0, 0x00, 0x0B, 0xFF, 0xFD, 0x7F, 0xC0, 0x00,
-    0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0,
-    0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xEA, 0xAA, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00,
-    0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0xBF,
-    0x80, 0x07, 0xFF, 0xFF, 0x2F, 0xE0, 0x01, 0xFF, 0xFF, 0xCB, 0xF8, 0x00, 0x7F, 0xFF, 0xF2, 0xFE,
-    0x00, 0x1F, 0xF5, 0x54, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xF5,
-    0x56, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80,
-    0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00,
-    0x1F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFA, 0xAA, 0x40, 0x00, 0x7F, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFC, 0x00, 0x0F, 0xFD, 0x5A, 0xFF, 0xF0, 0x7F, 0xC0, 0x00, 0xFF,
-    0x80, 0x03, 0xFF, 0x87, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x7F, 0xC0, 0x00, 0xFF, 0x80,
-    0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x00,
-    0x3F, 0xD7, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xAF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xF5,
-    0x57, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x0B,
-    0xF8, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0xBF, 0x80, 0x0F, 0xFF, 0xFF,
-    0x42, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x0B, 0xF8, 0x00, 0xFF, 0xAF, 0xFF, 0x2F, 0xE0, 0x03, 0xFD,
-    0x0B, 0xFD, 0xBF, 0x80, 0x0F, 0xF4, 0x0F, 0xFA, 0xFE, 0x00, 0x3F, 0xD0, 0x1F, 0xFB, 0xF8, 0x00,
-    0xFF, 0x40, 0x7F, 0xEF, 0xE0, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3E, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x9A, 0x40,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xE0, 0x3F, 0xD0, 0x1F, 0xFF, 0xFD, 0x0F, 0xF4, 0x0B, 0xFC, 0xBF, 0xC7, 0xFC, 0x03, 0xFC, 0x0F,
-    0xF1, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x7F, 0xC0, 0x3F, 0xC0, 0xFF, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F,
-    0xC3, 0xFD, 0x03, 0xFC, 0x0F, 0xF0, 0xFF, 0xC0, 0xBF, 0x47, 0xF8, 0x2F, 0xF4, 0x0F, 0xF3, 0xFD,
-    0x03, 0xFF, 0x42, 0xFF, 0xFE, 0x00, 0xBF, 0xFE, 0xBF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x95,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0x40, 0x6F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF9, 0x50, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0x80,
-    0x7F, 0xC0, 0xFF, 0xFF, 0x0B, 0xFC, 0x1F, 0xFF, 0xF4, 0xBF, 0x82, 0xFC, 0x3F, 0x8B, 0xF8, 0x2F,
-    0xC2, 0xF8, 0xBF, 0xC2, 0xFC, 0x3F, 0x87, 0xFC, 0x2F, 0xC3, 0xF8, 0x3F, 0xD0, 0xFE, 0xBF, 0x02,
-    0xFF, 0x8F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x14, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xEA, 0xFF,
-    0x03, 0xFF, 0x80, 0x01, 0x41, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x40, 0xBF, 0xFE, 0x5B, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xFC,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x15, 0x5F,
-    0xF5, 0x54, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0A, 0xA0, 0xBF, 0xC0, 0x00, 0x2F, 0xF1, 0xFF,
-    0x80, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x02,
-    0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xD3, 0xFD, 0x00,
-    0x00, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0x9F, 0xF4, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x0F, 0xF4, 0x1F,
-    0xF4, 0x0B, 0xFC, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0xBF, 0xC1, 0xFF, 0x40, 0x0F, 0xF4, 0xBF, 0xC0,
-    0x02, 0xFE, 0x3F, 0xD0, 0x00, 0x7F, 0xCF, 0xF0, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0xBF, 0xC0, 0x00, 0x2F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x0B, 0xFC, 0x03, 0xFD,
-    0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0xBF,
-    0xC0, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1A, 0xAF,
-    0xFA, 0xA4, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0x3F,
-    0xF0, 0xBF, 0xC0, 0x0F, 0xF4, 0x1F, 0xF4, 0x0B, 0xFC, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0xBF, 0xC1,
-    0xFF, 0x40, 0x0F, 0xF4, 0xBF, 0xC0, 0x02, 0xFE, 0x3F, 0xD0, 0x00, 0x7F, 0xCF, 0xF0, 0x00, 0x0F,
-    0xFB, 0xF8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x15, 0x7F, 0xE5, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x01, 0xFF,
-    0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x03, 0xFD,
-    0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0xFC, 0x1F, 0xF4, 0x00, 0x3F, 0xFF, 0xC3, 0xFE,
-    0x00, 0x02, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x40, 0xBF, 0xD0, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF,
-    0x87, 0xFD, 0x00, 0x02, 0xFF, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xCF, 0xFC, 0x00, 0x07, 0xFD, 0x0F, 0xF9, 0x50, 0x3F, 0xF0,
-    0x2F, 0xFF, 0xC2, 0xFF, 0x00, 0x3F, 0xFF, 0x1F, 0xF8, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x40, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA,
-    0xBF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xCB, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x2F,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x05, 0x7F, 0xF5, 0x52, 0xFF, 0x00, 0x00, 0xBF, 0x80,
-    0x0B, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x2F,
-    0xE0, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xF0, 0x00,
-    0x0B, 0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x95, 0x5B, 0xFC,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x90, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0,
-    0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x03, 0xFE,
-    0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF9, 0x6B, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xD3,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x01,
-    0xFF, 0x00, 0x3F, 0xE0, 0x1B, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF3, 0xFD, 0x00, 0x02, 0xFF, 0x3F, 0xD0, 0x00, 0x2F, 0xF3, 0xFD, 0x00, 0x02, 0xFF, 0x3F,
-    0xD0, 0x00, 0x2F, 0xF3, 0xFD, 0x00, 0x02, 0xFF, 0x3F, 0xD0, 0xB4, 0x2F, 0xF3, 0xFD, 0x0B, 0x42,
-    0xFF, 0x3F, 0xD0, 0xB4, 0x2F, 0xF3, 0xFF, 0x0B, 0x42, 0xFF, 0x3F, 0xFE, 0xFF, 0xFF, 0xF2, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE6, 0xFF, 0x00, 0x00, 0xF4, 0x2F,
-    0xF0, 0x00, 0x0B, 0x42, 0xFF, 0x00, 0x00, 0xB4, 0x2F, 0xF0, 0x00, 0x0B, 0x42, 0xFF, 0x00, 0x00,
-    0x60, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x01, 0xFF,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x1F, 0xF1, 0xFF, 0x00, 0x07, 0xFC, 0x7F, 0xC2, 0x81,
-    0xFF, 0x1F, 0xF0, 0xF0, 0x7F, 0xC7, 0xFC, 0x3C, 0x1F, 0xF1, 0xFF, 0x9F, 0xBF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFE, 0x5F, 0xF0, 0x00, 0x0F, 0x07, 0xFC, 0x00,
-    0x03, 0xC1, 0xFF, 0x00, 0x00, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC,
-    0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0B,
-    0xFC, 0x6F, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xEB,
-    0xFF, 0xDB, 0xFE, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF,
-    0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03,
-    0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0xD0, 0xFF, 0x7F, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x97, 0xFF, 0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xFA, 0xAF, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF0, 0x2A, 0x0B, 0xFC,
-    0x00, 0x00, 0xFF, 0x4B, 0xF0, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x7F,
-    0xCF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xFF, 0xF9, 0x5B,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x05, 0x07, 0xFD, 0x03, 0xFE, 0x0F, 0xC3, 0xFE, 0x00, 0x3F, 0xC3, 0xF4, 0xFF, 0x40, 0x0F,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x07, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFA, 0xAF, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x2F, 0xF0, 0x2A, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x4B, 0xF0, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0xFF,
-    0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xF0,
-    0x00, 0x02, 0xFF, 0xF9, 0x5B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x05, 0x07, 0xFD,
-    0x03, 0xFE, 0x0F, 0xC3, 0xFE, 0x00, 0x3F, 0xC3, 0xF4, 0xFF, 0x40, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x07, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x1A, 0x80,
-    0x00, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x41, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x0F, 0xFD, 0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x07, 0xFD, 0x02, 0xFF, 0x00, 0x2F,
-    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x0B, 0xF8, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x02, 0xFE, 0x00,
-    0xFF, 0x40, 0x00, 0xBF, 0xC0, 0xBF, 0x80, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x2F, 0xE0, 0xBF, 0xC0,
-    0x00, 0x01, 0xFF, 0x0B, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xFB, 0xFF, 0xBF, 0xE0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE2, 0xFE, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xBF,
-    0x83, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x2F, 0xE0, 0x7F, 0xE0, 0x00, 0x0F, 0xF8, 0x0B, 0xF8, 0x0B,
-    0xFD, 0x00, 0x0F, 0xFC, 0x02, 0xFE, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0xBF, 0x80, 0x1F, 0xF8,
-    0x03, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xF1, 0xFF,
-    0x80, 0x02, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xA4, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xF8, 0x03, 0xFE,
-    0x00, 0xBF, 0xC0, 0x7F, 0x80, 0xBF, 0xC0, 0x03, 0xFD, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x7F, 0x83, 0xFE, 0x00, 0x00, 0xBF, 0xC7, 0xF8, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0xEB, 0xFE, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x7F, 0x87, 0xFD, 0x00, 0x03, 0xFF, 0x07, 0xF8, 0x3F,
-    0xF0, 0x00, 0x7F, 0xD0, 0x7F, 0x80, 0xFF, 0x80, 0x0F, 0xF8, 0x07, 0xF8, 0x07, 0xFD, 0x03, 0xFF,
-    0x00, 0x7F, 0x80, 0x3F, 0xF0, 0xBF, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0xBF,
-    0xC1, 0xFF, 0x00, 0x07, 0xFD, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0x7F,
-    0xC0, 0x2F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x1F, 0xF4, 0x00, 0x1F, 0xF0, 0xFF,
-    0x40, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF9, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0x95, 0x6F, 0xFF, 0x47, 0xFC,
-    0x00, 0x0B, 0xFF, 0x1F, 0xF0, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x00,
-    0x2F, 0xE7, 0xFC, 0x00, 0x00, 0xBF, 0x9F, 0xF0, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0B,
-    0xAB, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFD, 0xBF, 0x80, 0x2F, 0xF8, 0xBF, 0x80,
-    0x7F, 0xE0, 0xBF, 0x81, 0xFF, 0x80, 0xBF, 0x83, 0xFE, 0x00, 0xBF, 0x8F, 0xF8, 0x00, 0xBF, 0xBF,
-    0xE0, 0x00, 0xBF, 0xFF, 0xE9, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0xE5,
-    0xBF, 0xFC, 0xBF, 0x80, 0x0B, 0xFD, 0xBF, 0x80, 0x03, 0xFE, 0xBF, 0x80, 0x02, 0xFE, 0xBF, 0x80,
-    0x01, 0xFF, 0xBF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x2E, 0xBF, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F,
-    0xE0, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x07,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x5B, 0xFD, 0x00, 0x07,
-    0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFD, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFD,
-    0x57, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0F, 0xF0,
-    0x0F, 0xF8, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x40,
-    0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x9F, 0xF8, 0x00,
-    0xFF, 0x80, 0x3F, 0xFD, 0x00, 0x3F, 0xFF, 0xEF, 0xFF, 0x00, 0x0F, 0xFF, 0xF7, 0xFF, 0x00, 0x03,
-    0xFF, 0xFC, 0x04, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xAA, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7,
-    0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00,
-    0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xEA, 0xAA, 0xBF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02,
-    0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC,
-    0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x2E,
-    0xAB, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x07,
-    0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xD5, 0x5B, 0xFC, 0xBF, 0x80, 0x07,
-    0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x07,
-    0xFC, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0xBA, 0xBF, 0xF4, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80,
-    0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x2F,
-    0xE0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
-    0x0B, 0xF8, 0x00, 0x7F, 0xEA, 0xAA, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x01,
-    0xFF, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF8,
-    0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xD7, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x7F, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00,
-    0xBF, 0x80, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0xBF,
-    0x80, 0x07, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xD5, 0x5B, 0xFC, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x07,
-    0xFC, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x07, 0xFF, 0xFC, 0xBF, 0x80, 0x07, 0xFF,
-    0xFC, 0xBF, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x2A, 0x80, 0x3F, 0xC0, 0x00, 0x1F, 0xF3, 0xFD, 0x00, 0x02, 0xFF, 0x3F, 0xD0, 0x00,
-    0x2F, 0xF3, 0xFD, 0x00, 0x02, 0xFF, 0x3F, 0xD0, 0x00, 0x2F, 0xF3, 0xFD, 0x00, 0x02, 0xFF, 0x3F,
-    0xD0, 0x00, 0x2F, 0xF3, 0xFD, 0x00, 0x02, 0xFF, 0x3F, 0xD0, 0x00, 0x2F, 0xF3, 0xFF, 0x00, 0x02,
-    0xFF, 0x3F, 0xFE, 0x6B, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xE6, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0xAB, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x7F, 0xC0, 0x01, 0xFF, 0x7F, 0xC0, 0x01, 0xFF, 0x7F, 0xC0,
-    0x01, 0xFF, 0x7F, 0xC0, 0x01, 0xFF, 0x7F, 0xC0, 0x01, 0xFF, 0x3F, 0xC0, 0x01, 0xFF, 0x3F, 0xE0,
-    0x1B, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xE1, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x7F, 0xBF, 0x40,
-    0x03, 0xFB, 0xFC, 0x00, 0x7F, 0x7F, 0x80, 0x03, 0xF7, 0xFC, 0x00, 0x7F, 0x6F, 0xC0, 0x0B, 0xF3,
-    0xFC, 0x00, 0x7F, 0x5F, 0xC0, 0x0F, 0xE3, 0xFC, 0x00, 0x7F, 0x8F, 0xE0, 0x0F, 0xD3, 0xFC, 0x00,
-    0x7F, 0x8F, 0xF0, 0x2F, 0xC3, 0xFC, 0x00, 0x7F, 0x87, 0xF0, 0x3F, 0x83, 0xFC, 0x00, 0x7F, 0x83,
-    0xF4, 0x3F, 0x43, 0xFC, 0x00, 0x7F, 0x83, 0xFC, 0x7F, 0x03, 0xFC, 0x00, 0x7F, 0x82, 0xFC, 0xFE,
-    0x03, 0xFC, 0x00, 0x7F, 0x81, 0xFE, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x03, 0xFC,
-    0x00, 0x7F, 0x80, 0xBF, 0xF8, 0x03, 0xFF, 0xFD, 0x7F, 0x80, 0x7F, 0xF4, 0x03, 0xFF, 0xFD, 0x7F,
-    0x80, 0x3F, 0xF0, 0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x2F, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0x00, 0x03, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xF4,
-    0x02, 0xFF, 0xF8, 0x00, 0xFF, 0xFD, 0x00, 0xBF, 0xBF, 0x00, 0x3F, 0xBF, 0x40, 0x2F, 0xDF, 0xD0,
-    0x2F, 0xEF, 0xD0, 0x0B, 0xF7, 0xFC, 0x0F, 0xDB, 0xF4, 0x02, 0xFD, 0x7F, 0x07, 0xF2, 0xFD, 0x00,
-    0xBF, 0x4F, 0xE2, 0xF8, 0xBF, 0x40, 0x2F, 0xD2, 0xFC, 0xFD, 0x2F, 0xD0, 0x0B, 0xF4, 0x7F, 0xBF,
-    0x0B, 0xF4, 0x02, 0xFD, 0x0F, 0xFF, 0x82, 0xFD, 0x00, 0xBF, 0x42, 0xFF, 0xC0, 0xBF, 0x40, 0x2F,
-    0xD0, 0x3F, 0xF0, 0x2F, 0xFF, 0xDB, 0xF4, 0x0F, 0xF8, 0x0B, 0xFF, 0xF2, 0xFD, 0x01, 0xFC, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0x41, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF,
-    0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xF4, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x1F,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0,
-    0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0,
-    0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0,
-    0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0,
-    0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x3F, 0xE3,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xA4, 0x06, 0xA0, 0x0F, 0xE0, 0x3F, 0xC0, 0x3F, 0xD6, 0xFE,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB,
-    0xFD, 0xBF, 0xD0, 0x0F, 0xF7, 0xFF, 0x00, 0x3F, 0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xDF, 0xD0, 0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x00,
-    0x7D, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x9F, 0xE0, 0x00, 0x00, 0x3F,
-    0xD3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x03, 0xFD,
-    0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xFA,
-    0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00,
-    0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xF0, 0x1F,
-    0x40, 0x1F, 0xE0, 0xFF, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x0E,
-    0x40, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x6F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFA, 0xFF, 0x6F, 0xF4, 0x03, 0xFD, 0xFF, 0xC0, 0x0F, 0xF7, 0xFE, 0x00, 0x7F,
-    0xDB, 0xFD, 0x07, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xF7, 0xF4, 0x2F, 0xFE, 0x0F, 0xD0,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x81,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xFA, 0xAA,
-    0x90, 0x00, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xEA, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xEA, 0xAA, 0x83, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x42, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0x80, 0x2F, 0xFE, 0x02,
-    0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xF4, 0x06, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xAB, 0xFF, 0xFF, 0xFF,
-    0xEB, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xFF, 0xC0, 0x06, 0x87, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x04, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x15, 0x00, 0x15, 0x0F, 0xE0, 0x1F, 0xD3, 0xFD, 0x1F, 0xF0, 0x3F, 0xFF, 0xF4,
-    0x07, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00,
-    0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x7F, 0xEA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x02, 0xA0,
-    0x06, 0x90, 0x03, 0xF8, 0x0F, 0xE0, 0x03, 0xFD, 0x7F, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0,
-    0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0xAA, 0xFF, 0xF0, 0x0B, 0xD0, 0x00, 0x0B, 0xFE, 0x01, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x00,
-    0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x07, 0xFD, 0x07, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xF9, 0x6F,
-    0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x29, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0x80, 0x0B, 0xFC, 0x7F, 0xC0, 0x0F, 0xF8, 0x3F, 0xE0, 0x2F, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x2F, 0x41, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00,
-    0x7C, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xAA, 0xBF, 0xFC, 0x02, 0xF4, 0x00, 0x02, 0xFF, 0x80, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x0F, 0xF4, 0x00,
-    0x01, 0xFF, 0x41, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x3F, 0xFE, 0x5B, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x0B, 0xF4, 0x7F, 0x80, 0x02, 0xE0,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x29, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0x80, 0x0B, 0xFC, 0x7F, 0xC0, 0x0F, 0xF8, 0x3F, 0xE0, 0x2F, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x2F,
-    0xE0, 0x3F, 0xD0, 0x02, 0xFE, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x00,
-    0xFF, 0x80, 0x2F, 0xE0, 0x0B, 0xFC, 0x00, 0x1F, 0xF4, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x02, 0xFF,
-    0x02, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0x82, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x2F,
-    0xE0, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xEF, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0x8B, 0xF8, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC2, 0xFE, 0x0F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD0, 0xBF, 0x81, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x2F, 0xE0, 0x2F, 0xF4, 0x00, 0x3F, 0xF0,
-    0x0B, 0xF8, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x02, 0xFE, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xBF,
-    0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0B, 0xF8, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x01,
-    0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x0B, 0xFC, 0x07, 0xF8, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x7F,
-    0x80, 0xFF, 0x00, 0x01, 0xFF, 0x07, 0xF8, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x7F, 0x8B, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0xBF, 0xEF, 0xF8, 0x00, 0x00, 0xFF, 0x87, 0xF8, 0x7F, 0xD0,
-    0x00, 0x3F, 0xF0, 0x7F, 0x83, 0xFF, 0x00, 0x07, 0xFD, 0x07, 0xF8, 0x0F, 0xF8, 0x00, 0xFF, 0x80,
-    0x7F, 0x80, 0x7F, 0xD0, 0x3F, 0xF0, 0x07, 0xF8, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x7F, 0x80, 0x0F,
-    0xFC, 0x03, 0xE0, 0x2E, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0xBF, 0x07, 0xF4, 0x00, 0xF4, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xE0, 0x7F,
-    0xFF, 0xFF, 0xD0, 0xFE, 0xAB, 0xFF, 0xC1, 0x40, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x15, 0xAF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0xAF, 0x95, 0x7F, 0xFC, 0xBF, 0xFF, 0xFF, 0xE2, 0xFF,
-    0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x07, 0xE0, 0x3E, 0x00, 0xFF, 0x07,
-    0xF4, 0x0F, 0xF0, 0x7F, 0x40, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF9, 0x03, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xC0, 0xE0, 0x07, 0xFD, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x03, 0xFC, 0x01, 0xAB, 0xFF, 0x40, 0x1F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x40, 0x05,
-    0x5B, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x39, 0x00, 0x7F, 0xF3, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x1B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x10,
-    0x00, 0x03, 0xFF, 0x0F, 0x94, 0x1B, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x05, 0x55, 0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03,
-    0xFE, 0x20, 0x00, 0x0B, 0xFD, 0x3F, 0xAA, 0xBF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x2A, 0xAA, 0xA0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01,
-    0xFF, 0xD7, 0xFC, 0x00, 0x0F, 0xFF, 0x5F, 0xF0, 0x00, 0x7F, 0xFD, 0x7F, 0xC0, 0x03, 0xFF, 0xF5,
-    0xFF, 0x00, 0x1F, 0xFF, 0xD7, 0xFC, 0x00, 0xFF, 0xFF, 0x5F, 0xF0, 0x07, 0xFB, 0xFD, 0x7F, 0xC0,
-    0x3F, 0xCF, 0xF5, 0xFF, 0x01, 0xFD, 0x3F, 0xD7, 0xFC, 0x0F, 0xF0, 0xFF, 0x5F, 0xF0, 0x7F, 0x43,
-    0xFD, 0x7F, 0xC3, 0xFC, 0x0F, 0xF5, 0xFF, 0x1F, 0xD0, 0x3F, 0xD7, 0xFC, 0xFF, 0x00, 0xFF, 0x5F,
-    0xF7, 0xF4, 0x03, 0xFD, 0x7F, 0xFF, 0xC0, 0x0F, 0xF5, 0xFF, 0xFD, 0x00, 0x3F, 0xD7, 0xFF, 0xF0,
-    0x00, 0xFF, 0x5F, 0xFF, 0x40, 0x03, 0xFD, 0x7F, 0xFC, 0x00, 0x0F, 0xF5, 0xFF, 0xD0, 0x00, 0x3F,
-    0xD0, 0x02, 0xAA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0x55, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xFD, 0xBF, 0x80, 0x1F, 0xFD, 0xBF, 0x80, 0x3F,
-    0xFD, 0xBF, 0x80, 0x7F, 0xFD, 0xBF, 0x80, 0xFF, 0xFD, 0xBF, 0x82, 0xFE, 0xFD, 0xBF, 0x83, 0xF7,
-    0xFD, 0xBF, 0x8B, 0xF3, 0xFD, 0xBF, 0x4F, 0xD3, 0xFD, 0xBF, 0x6F, 0xC3, 0xFD, 0xBF, 0xBF, 0x03,
-    0xFD, 0xBF, 0xFE, 0x03, 0xFD, 0xBF, 0xFC, 0x03, 0xFD, 0xBF, 0xF8, 0x03, 0xFD, 0xBF, 0xF0, 0x03,
-    0xFD, 0xBF, 0xE0, 0x03, 0xFD, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x02, 0xFC, 0x1F, 0xE0, 0x00, 0x0B,
-    0xF0, 0x7F, 0x80, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0x5F, 0xF0, 0x00, 0x3F, 0xFD, 0x7F, 0xC0, 0x01, 0xFF, 0xF5,
-    0xFF, 0x00, 0x0F, 0xFF, 0xD7, 0xFC, 0x00, 0x7F, 0xFF, 0x5F, 0xF0, 0x03, 0xFF, 0xFD, 0x7F, 0xC0,
-    0x1F, 0xEF, 0xF5, 0xFF, 0x00, 0xFF, 0x3F, 0xD7, 0xFC, 0x07, 0xF4, 0xFF, 0x5F, 0xF0, 0x3F, 0xC3,
-    0xFD, 0x7F, 0xC1, 0xFD, 0x0F, 0xF5, 0xFF, 0x0F, 0xF0, 0x3F, 0xD7, 0xFC, 0x7F, 0x40, 0xFF, 0x5F,
-    0xF3, 0xFC, 0x03, 0xFD, 0x7F, 0xDF, 0xD0, 0x0F, 0xF5, 0xFF, 0xFF, 0x00, 0x3F, 0xD7, 0xFF, 0xF4,
-    0x00, 0xFF, 0x5F, 0xFF, 0xC0, 0x03, 0xFD, 0x7F, 0xFD, 0x00, 0x0F, 0xF5, 0xFF, 0xF0, 0x00, 0x3F,
-    0xD7, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xF8,
-    0x3F, 0xC0, 0x02, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x0F, 0xFD, 0xBF, 0x80, 0x1F, 0xFD, 0xBF, 0x80, 0x3F, 0xFD, 0xBF, 0x80, 0x7F, 0xFD, 0xBF, 0x80,
-    0xFF, 0xFD, 0xBF, 0x82, 0xFE, 0xFD, 0xBF, 0x83, 0xF7, 0xFD, 0xBF, 0x8B, 0xF3, 0xFD, 0xBF, 0x4F,
-    0xD3, 0xFD, 0xBF, 0x6F, 0xC3, 0xFD, 0xBF, 0xBF, 0x03, 0xFD, 0xBF, 0xFE, 0x03, 0xFD, 0xBF, 0xFC,
-    0x03, 0xFD, 0xBF, 0xF8, 0x03, 0xFD, 0xBF, 0xF0, 0x03, 0xFD, 0xBF, 0xE0, 0x03, 0xFD, 0x00, 0x0F,
-    0x80, 0xBC, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x2E,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA,
-    0xBF, 0xFE, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00,
-    0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00,
-    0x1F, 0xF4, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x01,
-    0xFF, 0x80, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x2F, 0xFF, 0x9B, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x01, 0xF4, 0x0F, 0x80, 0x03, 0xFC, 0x2F, 0xC0, 0x03, 0xFC, 0x2F, 0xC0, 0x01, 0xF4, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03,
-    0xFE, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03,
-    0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0x95, 0xBF, 0xF8, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x00,
-    0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x1F, 0xF5, 0x55, 0x55,
-    0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xF0, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x00, 0x07,
-    0xFC, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xF9, 0x5B, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF9, 0x6F, 0xF8, 0x3F, 0xE0, 0x07, 0xFC, 0x7F, 0xC0,
-    0x03, 0xFD, 0xBF, 0xEA, 0xAB, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xEA,
-    0xAB, 0xFE, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xD0, 0x07, 0xFC, 0x2F, 0xF9, 0x2F, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F,
-    0x80, 0xBC, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x2E,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xE5,
-    0x6F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00,
-    0x02, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFC, 0x00, 0x00,
-    0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x0B, 0xFC, 0x00, 0x00,
-    0xFF, 0x80, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x2F, 0xFE, 0x56, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x01, 0xF4, 0x0F, 0x80, 0x03, 0xFC, 0x2F, 0xC0, 0x03, 0xFC, 0x2F, 0xC0, 0x01, 0xF4, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF9, 0x6F, 0xF8, 0x3F, 0xE0, 0x07, 0xFC, 0x7F, 0xC0, 0x03,
-    0xFD, 0xBF, 0xEA, 0xAB, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xEA, 0xAB,
-    0xFE, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xD0, 0x07, 0xFC, 0x2F, 0xF9, 0x2F, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xD0, 0x7D,
-    0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x7F,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFA, 0xBF, 0xFE, 0x01, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x15, 0x55, 0x6F, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD1, 0xFA,
-    0x5A, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x2F, 0x01, 0xF4, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0x83, 0xFC, 0x02, 0xE0,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80,
-    0x7F, 0xFF, 0xFE, 0x03, 0x90, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x06, 0xAA,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xC0, 0x15, 0x5B, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x1F, 0xF8, 0xE5, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xF9,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x2F, 0xE3, 0xFE, 0x00, 0x00, 0xFF, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x0F, 0xF4, 0x00, 0x3F, 0xD0,
-    0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x01, 0xFF,
-    0x01, 0xFE, 0x00, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xF2, 0xFD,
-    0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xAA, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03,
-    0xFD, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x7F,
-    0xC0, 0x1F, 0xF0, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0xFF, 0x07, 0xFC,
-    0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x7F, 0xCF, 0xF0, 0x00, 0x03, 0xFD, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0A, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x0B, 0xF4,
-    0x7F, 0x80, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0xBF, 0x8F, 0xF8, 0x00, 0x03, 0xFC, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x3F,
-    0xD0, 0x00, 0xFF, 0x40, 0xBF, 0xC0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00,
-    0xFF, 0x00, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0xFF, 0x00,
-    0x00, 0x3F, 0xCB, 0xF4, 0x00, 0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x02, 0xAB, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0xF0,
-    0x7F, 0x40, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00,
-    0xBF, 0xC0, 0xBF, 0xC0, 0x0F, 0xF4, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x01,
-    0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x07, 0xFC, 0xFF,
-    0x00, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xAB, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x45,
-    0x50, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00,
-    0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x02, 0xFE, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x03, 0xFD,
-    0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x1F,
-    0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x2F,
-    0xD0, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0A, 0xAF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x55, 0x00, 0x07, 0xFC, 0xBF, 0x80, 0x03,
-    0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80, 0x01, 0xF8, 0x2F, 0x40, 0x00, 0x14, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0xBF,
-    0xC2, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0x03,
-    0xFC, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x3F,
-    0xDF, 0xE0, 0x00, 0x07, 0xFB, 0xF4, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x02, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x3F,
-    0xC2, 0xFD, 0x00, 0x07, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x0F, 0xF7, 0xFD, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0xFF, 0x7F, 0xD0, 0x00, 0x3F,
-    0xDF, 0xF4, 0x00, 0x0F, 0xF7, 0xFD, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0xFF, 0x7F, 0xE0, 0x00,
-    0x3F, 0xDF, 0xFC, 0x00, 0x0F, 0xF6, 0xFF, 0x80, 0x07, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF,
-    0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xAE, 0x93, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xF8, 0x3F,
-    0xC0, 0x03, 0xF8, 0x3F, 0xC0, 0x01, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03,
-    0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x03, 0xFD, 0x3F, 0xFE, 0xAF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xAF, 0x97, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xD5, 0x54, 0xBF,
-    0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80,
-    0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80,
-    0xBF, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0x80, 0x00, 0x6A, 0x40, 0x00, 0x03, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF1,
-    0xFF, 0xAA, 0x50, 0x00, 0x3F, 0xC7, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x1F, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xF4, 0x0F, 0xF1, 0xFF, 0x00, 0xBF, 0xF0, 0x3F, 0xC7, 0xFC, 0x00, 0xBF,
-    0xC0, 0xFF, 0x1F, 0xF0, 0x00, 0xFF, 0x43, 0xFC, 0x7F, 0xC0, 0x03, 0xFD, 0x0F, 0xF1, 0xFF, 0x00,
-    0x1F, 0xF4, 0x3F, 0xC7, 0xFC, 0x00, 0xFF, 0xC0, 0xFF, 0x1F, 0xFA, 0xBF, 0xFE, 0x03, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xF1, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xC7, 0xFF, 0xFF, 0x90, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x1F, 0xE0,
-    0x00, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFA, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0xFF,
-    0xAF, 0xE0, 0x00, 0x00, 0x3F, 0xEB, 0xF8, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0xFF, 0x90, 0x03, 0xFE,
-    0xBF, 0xFF, 0xFF, 0x00, 0xFF, 0xAF, 0xFF, 0xFF, 0xF0, 0x3F, 0xEB, 0xFD, 0x5F, 0xFE, 0x0F, 0xFA,
-    0xFE, 0x00, 0xFF, 0xC3, 0xFE, 0xBF, 0x80, 0x2F, 0xF0, 0xFF, 0xAF, 0xE0, 0x0B, 0xFC, 0x3F, 0xEB,
-    0xFD, 0x5B, 0xFE, 0x0F, 0xFA, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xBF, 0xFF, 0xFF, 0x40, 0xFF, 0xAF,
-    0xFF, 0xF9, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2B, 0xFE, 0xAA, 0x40, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0xA9, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x9F, 0xFD, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xEA, 0xA9, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x5F, 0xF9,
-    0x54, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x16, 0xFF, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x0B,
-    0xFD, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0x00, 0x02,
-    0xFF, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x0F, 0xF8, 0x00, 0x03, 0xFF,
-    0x01, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFE, 0xBF, 0xD0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x26, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x00, 0x7F, 0xD2, 0xFF, 0x00, 0x02, 0xFF, 0x7F, 0xE0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xF3, 0xFE, 0x00, 0x0B, 0xFC, 0x1F, 0xF4, 0x00, 0xFF, 0x80,
-    0xBF, 0xFF, 0x3F, 0xF0, 0x03, 0xFF, 0xFB, 0xFD, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x16, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF8,
-    0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x02,
-    0xFF, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x05, 0x6F, 0xFF, 0xF5, 0x50, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x01, 0xFF, 0x43, 0xFE, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40,
-    0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0xBF,
-    0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x0B, 0xFC, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0xFF,
-    0xC0, 0x1F, 0xF4, 0xBF, 0xC0, 0x02, 0xFF, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xAF, 0xFF,
-    0xFE, 0x90, 0xBF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFD, 0x06, 0xBF, 0xFF, 0xFA, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0x1F, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03,
-    0xFF, 0x00, 0x3F, 0xE2, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x6A, 0xB8,
-    0xBA, 0xB8, 0xA0, 0xE0, 0xA1, 0x80, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0B, 0x00,
-    0x2E, 0xA9, 0x2E, 0xAE, 0x0B, 0x0A, 0x02, 0x4A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x2A, 0xAA, 0x4F, 0xFF,
-    0xD3, 0xFF, 0xF4, 0xFF, 0xFD, 0x2A, 0xAA, 0x4F, 0xFF, 0xD3, 0xFF, 0xF4, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00,
-    0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD,
-    0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F,
-    0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00,
-    0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD,
-    0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x2A, 0x00, 0x68, 0x15, 0x55, 0x55, 0x43,
-    0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF,
-    0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x07, 0xE0, 0xBE, 0x0F, 0xD2, 0xFC, 0x3F, 0xC3, 0xFC, 0xBF, 0x81,
-    0x50, 0x0F, 0xE1, 0xFE, 0x2F, 0xD3, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x01, 0x40, 0x0B, 0xF4, 0x3F,
-    0xC0, 0xFF, 0x07, 0xF4, 0x2F, 0xC0, 0xFE, 0x03, 0xF0, 0x05, 0x40, 0x7F, 0x87, 0xFC, 0x3F, 0xC2,
-    0xFC, 0x1F, 0xD0, 0xFE, 0x07, 0xF0, 0x15, 0x07, 0xE0, 0x2F, 0x42, 0xF8, 0x0F, 0xD0, 0xFD, 0x07,
-    0xF0, 0xBF, 0x03, 0xFC, 0x3F, 0xC0, 0xFE, 0x0F, 0xF0, 0xBF, 0x8B, 0xF8, 0x3F, 0xD0, 0x54, 0x05,
-    0x50, 0x0F, 0xE0, 0xBF, 0x47, 0xF8, 0x3F, 0xD2, 0xFD, 0x0F, 0xF0, 0xFF, 0x03, 0xF8, 0x3F, 0x81,
-    0xFD, 0x0F, 0xD0, 0xBF, 0x07, 0xF0, 0x3F, 0x40, 0x50, 0x05, 0x40, 0x0B, 0xF4, 0x3F, 0xC0, 0xFF,
-    0x03, 0xFC, 0x0F, 0xF0, 0x7F, 0x81, 0xFE, 0x0B, 0xF0, 0x1F, 0xC0, 0xFF, 0x02, 0xFC, 0x0F, 0xD0,
-    0x3F, 0x41, 0xFC, 0x01, 0x50, 0x05, 0x00, 0x7F, 0x83, 0xFC, 0x1F, 0xF0, 0xBF, 0x43, 0xFC, 0x1F,
-    0xE0, 0xBF, 0x03, 0xFC, 0x1F, 0xD0, 0xBF, 0x03, 0xF8, 0x1F, 0xC0, 0x7F, 0x03, 0xF4, 0x05, 0x40,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0x80, 0x02, 0x57, 0xE5, 0x61, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0x5A, 0x9F,
-    0x9A, 0x80, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x07,
-    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x01, 0x03, 0xF0, 0x11, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0x9F, 0xEF, 0xEF, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xFF, 0xF1, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xAF, 0xFF, 0xEB, 0xFF, 0xF4, 0xFF, 0xFC, 0x2F, 0xFE, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x7E, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xF8, 0x7F, 0xFF, 0xC7,
-    0xFF, 0xD0, 0x7F, 0xE0, 0x07, 0xF0, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x43, 0xFD, 0x3F,
-    0xF3, 0xFF, 0x2F, 0xD0, 0x50, 0x05, 0x00, 0x05, 0x40, 0xFF, 0x40, 0x7F, 0xC7, 0xFE, 0x03, 0xFF,
-    0x1F, 0xF8, 0x0B, 0xFC, 0x3F, 0xC0, 0x1F, 0xE0, 0x14, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x40,
-    0x01, 0x40, 0xFF, 0x40, 0xBF, 0x80, 0x7F, 0xC7, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x1F, 0xF8, 0x0F,
-    0xFC, 0x0B, 0xFC, 0x3F, 0xC0, 0x2F, 0xD0, 0x1F, 0xE0, 0x14, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05,
-    0x03, 0xFD, 0x7F, 0xE7, 0xFE, 0x3F, 0xC0, 0x50, 0x6A, 0xA8, 0xBA, 0xA8, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0x2A, 0xA9, 0x2A, 0xAE, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x00, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7F, 0xFD,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x0D,
-    0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xF4, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F,
-    0xC0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x42, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFE, 0x1F, 0xC1, 0xB9, 0x00,
-    0x06, 0xE4, 0x02, 0xFC, 0x3F, 0x4F, 0xD3, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x7F, 0xFF, 0xCB, 0xF2,
-    0xFF, 0xFD, 0x0B, 0xFF, 0xF8, 0x0B, 0xFF, 0xD3, 0xF4, 0xFE, 0x2F, 0xC3, 0xF8, 0xBF, 0x00, 0x7F,
-    0x82, 0xFC, 0x7F, 0x03, 0xF1, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0xFD, 0x7F, 0x03,
-    0xF4, 0x00, 0x00, 0xFE, 0x07, 0xF0, 0x3F, 0x5F, 0xC0, 0xFD, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x0F,
-    0xD7, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x7F, 0x03, 0xF5, 0xFC, 0x0F, 0xD0, 0x00, 0x1F, 0xC0,
-    0x0F, 0xD1, 0xFC, 0x3F, 0x47, 0xF0, 0x00, 0x0F, 0xD0, 0x03, 0xFE, 0xFF, 0x0B, 0xFB, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xF4, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x42, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x7F, 0x06, 0xE4, 0x00, 0x1B, 0x90,
-    0x00, 0x6E, 0x40, 0x2F, 0xC3, 0xF4, 0xFE, 0x2F, 0xFF, 0x00, 0xBF, 0xFC, 0x02, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xF1, 0xFC, 0xBF, 0xFF, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x0B, 0xFF, 0xD3, 0xF4, 0xFF,
-    0x2F, 0xC3, 0xFC, 0xBF, 0x0F, 0xF1, 0xFD, 0x01, 0xFE, 0x0B, 0xF0, 0xFD, 0x0F, 0xD3, 0xF4, 0x3F,
-    0x4F, 0xD0, 0xFE, 0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x0F, 0xE7, 0xF0, 0x3F, 0x8F, 0xD0, 0xFE, 0x00,
-    0x00, 0x2F, 0x81, 0xFC, 0x0F, 0xE7, 0xF0, 0x3F, 0x8F, 0xD0, 0xBF, 0x00, 0x00, 0x7F, 0x01, 0xFC,
-    0x0F, 0xE7, 0xF0, 0x3F, 0x8F, 0xD0, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x0F, 0xD3, 0xF4, 0x3F,
-    0x8F, 0xD0, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x1F, 0xD3, 0xF8, 0x3F, 0x4F, 0xE0, 0xFD, 0x00,
-    0x03, 0xF8, 0x00, 0xBF, 0xBF, 0xC2, 0xFE, 0xFF, 0x07, 0xFB, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x3F,
-    0xFF, 0x40, 0xFF, 0xFD, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x0F, 0xC0, 0x0B, 0xE0, 0x03, 0xF0, 0x01, 0xA4,
-    0x00, 0x00, 0xFE, 0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0x80, 0x3F, 0x82, 0xFC, 0x02, 0xFC, 0x0F, 0xD0,
-    0x0F, 0xC0, 0xBE, 0x00, 0xBE, 0x03, 0xF0, 0x03, 0xF0, 0x2F, 0x40, 0x1A, 0x40, 0xA8, 0x00, 0x00,
-    0xFE, 0x0B, 0xF0, 0x3F, 0x80, 0xBF, 0x03, 0xF8, 0x2F, 0xC0, 0x3F, 0x82, 0xFC, 0x0F, 0xD0, 0x2F,
-    0xC0, 0xFD, 0x0B, 0xF0, 0x0F, 0xC0, 0xBE, 0x03, 0xF0, 0x0B, 0xE0, 0x3F, 0x02, 0xF4, 0x03, 0xF0,
-    0x2F, 0x40, 0xFC, 0x01, 0xA4, 0x0A, 0x80, 0x68, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0xFE, 0x00,
-    0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xA8, 0x3F, 0x82, 0xFC, 0x00, 0xBF,
-    0x03, 0xF8, 0x00, 0xFE, 0x0B, 0xF0, 0x01, 0xFC, 0x0F, 0xE0, 0x02, 0xF8, 0x0F, 0xC0, 0x03, 0xF0,
-    0x2F, 0x80, 0x07, 0xE0, 0x3F, 0x00, 0x0A, 0x80, 0x69, 0x3F, 0x82, 0xFC, 0x1F, 0xD0, 0x02, 0xFC,
-    0x0F, 0xE0, 0xFF, 0x00, 0x0F, 0xE0, 0xBF, 0x03, 0xF8, 0x00, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0x02,
-    0xF8, 0x0F, 0xC0, 0xFE, 0x00, 0x0F, 0xC0, 0xBE, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x1F, 0x80,
-    0x02, 0xA0, 0x1A, 0x40, 0xA8, 0x00, 0x14, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF,
-    0x00, 0x03, 0xDF, 0x80, 0x07, 0xC7, 0xC0, 0x0F, 0x83, 0xE0, 0x1F, 0x01, 0xF0, 0x3E, 0x00, 0xF8,
-    0x3C, 0x00, 0x7C, 0x00, 0x10, 0x00, 0x2F, 0x80, 0x1F, 0xF0, 0x0F, 0xF4, 0x0F, 0xF8, 0x0F, 0xFC,
-    0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xBE,
-    0x00, 0x04, 0x00, 0x05, 0x00, 0x0B, 0xC0, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF,
-    0x40, 0x1F, 0xF4, 0x07, 0xFD, 0x03, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x2F, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7F, 0x00, 0x04, 0x00, 0xF4,
-    0x02, 0xFE, 0x00, 0xB8, 0x0B, 0xF4, 0x0B, 0xF8, 0x0B, 0xF8, 0x0F, 0xF4, 0x1F, 0xC0, 0xBF, 0x80,
-    0x0F, 0xF4, 0x04, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x0B, 0xF8,
-    0x00, 0x00, 0x0F, 0xF4, 0xBF, 0x80, 0x00, 0x14, 0x0F, 0xFF, 0xFC, 0x05, 0x03, 0xF8, 0x0F, 0xFF,
-    0xC0, 0xFF, 0x2F, 0xF0, 0x0F, 0xFC, 0x03, 0xFD, 0x7F, 0xC0, 0xBF, 0xF4, 0x0F, 0xF0, 0xBD, 0x0B,
-    0xFF, 0xF4, 0x1F, 0x40, 0x00, 0xBF, 0x8F, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0xF4, 0x00, 0x00,
-    0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0xB8, 0x0F, 0xF4,
-    0x0B, 0xF8, 0x0B, 0xF4, 0x0F, 0xF4, 0x1F, 0x80, 0x3F, 0xE0, 0x0F, 0xC0, 0x18, 0x00, 0xBF, 0x40,
-    0x0C, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xE7, 0xFE, 0x03, 0xFF, 0x3F,
-    0xD0, 0x3F, 0xF3, 0xFD, 0x03, 0xFE, 0x3F, 0xD0, 0x3F, 0xE3, 0xFD, 0x03, 0xFE, 0x3F, 0xD0, 0x2F,
-    0xE3, 0xFC, 0x02, 0xFE, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x02, 0xFD, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC,
-    0x01, 0xFD, 0x2F, 0xC0, 0x1F, 0xD2, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x05, 0x43, 0xFD, 0x02, 0xFE, 0x7F, 0xE0, 0x3F, 0xF7, 0xFE, 0x03, 0xFF, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFD, 0xBF, 0xC1, 0x6F, 0xC3, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x2F, 0xC3,
-    0xFC, 0x01, 0xFC, 0xBF, 0x80, 0x1F, 0xEF, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x2C, 0x3C,
-    0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x01, 0xF0, 0x07, 0xE0, 0x01, 0xBC, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x01,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x0F, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00,
-    0x38, 0x30, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00,
-    0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF,
-    0x00, 0x03, 0xEB, 0x40, 0x03, 0xC3, 0xC0, 0x0B, 0x83, 0xD0, 0x0F, 0x01, 0xF0, 0x2E, 0x00, 0xF4,
-    0x3C, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4,
-    0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6F, 0xFD, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x2E, 0x03, 0xD0, 0x15, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x04,
-    0x07, 0xE0, 0x04, 0x00, 0x40, 0x7E, 0x00, 0x4B, 0xE5, 0xF9, 0xBF, 0x00, 0x7E, 0x5F, 0x9B, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x6F, 0xFD, 0x40, 0x00, 0x06, 0xFF, 0xD4, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x07, 0xF4, 0xFE, 0x00, 0x00, 0x7F, 0x4F,
-    0xE0, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x2E, 0x03, 0x80, 0x00, 0x01, 0xE0,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x2F, 0xFF, 0xCB, 0xFF,
-    0xF2, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x03,
-    0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF5, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0x7F,
-    0xFF, 0xFF, 0xFE, 0xAA, 0xA0, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x01, 0xFE, 0x00, 0xFE, 0x00,
-    0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x2A, 0xFE, 0x7F, 0xFE, 0x7F,
-    0xFE, 0x15, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00,
-    0xFE, 0x15, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x2A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x40, 0x7F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
-    0xFF, 0x8B, 0xFF, 0xFF, 0xF4, 0x3F, 0xA6, 0xFF, 0xC3, 0xF9, 0x6F, 0xFC, 0x14, 0x00, 0x3F, 0xD2,
-    0x40, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x1F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFD, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xF0, 0x1F, 0xF5, 0xFF, 0xFF, 0xFE, 0x07, 0xFD, 0x3F,
-    0xA6, 0xFF, 0xC1, 0xFF, 0x45, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x00,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xC0, 0x01,
-    0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x07, 0xFE,
-    0x00, 0x07, 0xFE, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x01, 0x40,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x06, 0xFF, 0xF8, 0x07, 0xFE, 0x0F,
-    0xFF, 0xFF, 0xC0, 0xFF, 0x43, 0xFF, 0xFF, 0xFC, 0x3F, 0xD0, 0xBF, 0x97, 0xFF, 0x4F, 0xF4, 0x08,
-    0x00, 0x2F, 0xE3, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00,
-    0x02, 0xFF, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x43, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0x00, 0x03,
-    0xFF, 0x40, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x15,
-    0x00, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xF9, 0x7F, 0xFF, 0xF4, 0xF8, 0x3F, 0xFF, 0xF8, 0xF8, 0x3F, 0xFF, 0xFC,
-    0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC,
-    0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xF4, 0xF8, 0x3F, 0xFF, 0xE0,
-    0xF8, 0x3F, 0xFF, 0x80, 0xF8, 0x3D, 0x10, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00,
-    0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00,
-    0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00,
-    0xA4, 0x29, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFC, 0x2E, 0x3F, 0xFF, 0xFC, 0x2E, 0x7F, 0xFF, 0xFC, 0x2E, 0x7F, 0xFF, 0xFC, 0x2E,
-    0x7F, 0xFF, 0xFC, 0x2E, 0x7F, 0xFF, 0xFC, 0x2E, 0x7F, 0xFF, 0xFC, 0x2E, 0x3F, 0xFF, 0xFC, 0x2E,
-    0x3F, 0xFF, 0xFC, 0x3E, 0x0F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x6A, 0xAA, 0xA9,
-    0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7C, 0x3F, 0xFF, 0xFC,
-    0x7C, 0x3F, 0xFF, 0xFD, 0x7C, 0x3F, 0xFF, 0xFD, 0x7C, 0x3F, 0xFF, 0xFE, 0x7C, 0x3F, 0xFF, 0xFE,
-    0x7C, 0x3F, 0xFF, 0xFE, 0x7C, 0x3F, 0xFF, 0xFD, 0x7C, 0x3F, 0xFF, 0xFC, 0x7C, 0x3F, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBE,
-    0x1F, 0x5B, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x05, 0x7F, 0xF9, 0x50, 0x00, 0xFF,
-    0xF0, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0xBF, 0x1F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xD0, 0x78,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xFE, 0x1F, 0xF8, 0x3F, 0xD0, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0xFC, 0x0F,
-    0xF4, 0x1F, 0xD0, 0x3F, 0x80, 0xBF, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x0F, 0x00, 0x00, 0x0F,
-    0x03, 0xC0, 0x00, 0x00, 0x38, 0x30, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x2C, 0x3C,
-    0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x01, 0xF0, 0x07, 0xE0, 0x01, 0xBC, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x1F, 0x5B, 0xE3, 0xFF, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xFF, 0x05, 0x7F, 0xF9, 0x50, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xEF, 0xE0, 0x00,
-    0xBF, 0x1F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xD0, 0x78, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x2F, 0x87, 0xD6, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xC1, 0x5F, 0xFE, 0x54,
-    0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x2F, 0xC7, 0xF4, 0x00, 0xFF, 0x0F, 0xF0, 0x01,
-    0xF4, 0x1E, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x1F, 0xCF, 0xFC, 0x0F,
-    0xE3, 0xFF, 0x03, 0xF4, 0xBF, 0x82, 0xFC, 0x06, 0x40, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4,
-    0x05, 0x01, 0xFC, 0x1F, 0xF0, 0xFE, 0x0B, 0xFC, 0x7F, 0x02, 0xFF, 0x2F, 0xC0, 0x3F, 0x80, 0x00,
-    0x01, 0x00, 0x01, 0xBF, 0xE9, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7E, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xD0, 0xB4, 0x00,
-    0x00, 0x05, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x02, 0xFE, 0xAB, 0xF4, 0x00, 0xB8, 0x00, 0x07, 0xD0, 0x1E, 0x00,
-    0x00, 0x0B, 0x43, 0x80, 0x00, 0x00, 0x3C, 0x20, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0x90, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x03, 0x83, 0xD1, 0xD0, 0x0B, 0xE3, 0xD7, 0xF0, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0x00, 0x2A, 0xBF, 0xFE, 0xA9, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xF7, 0xDB, 0xE0, 0x07, 0xC3, 0xD2, 0xE0,
-    0x01, 0x03, 0xD0, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0xFE, 0x0F, 0xF0, 0xBF, 0x0B, 0xF0, 0x0B, 0xF0, 0x7F, 0x47, 0xF8, 0x3F, 0x80, 0x3F, 0x83, 0xF8,
-    0x3F, 0xC2, 0xFC, 0x02, 0xFC, 0x1F, 0xC1, 0xFC, 0x0F, 0xD0, 0x0F, 0xC0, 0xFD, 0x0F, 0xE0, 0xBE,
-    0x00, 0xBE, 0x07, 0xE0, 0x7F, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x2F, 0x40, 0x1A, 0x40,
-    0xA4, 0x0A, 0x40, 0xA8, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0A, 0x43, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8,
-    0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD7, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x03,
-    0xFE, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x6E, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00,
-    0x00, 0x0F, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0xA4, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x02, 0xFC, 0x7F, 0xE7, 0xFE, 0x3F, 0xD0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3F, 0xD7, 0xFE, 0x7F, 0xE3, 0xFC,
-    0x05, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x01, 0xA4, 0x3F,
-    0xD0, 0x00, 0x3F, 0xD7, 0xFE, 0x00, 0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x7F, 0xD2, 0xFC, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x03, 0xF4, 0x03,
-    0xFE, 0x03, 0xF0, 0x3F, 0xF0, 0x0F, 0xFC, 0x0F, 0xC0, 0xFF, 0xC0, 0x3F, 0xE0, 0x3F, 0x02, 0xFF,
-    0x00, 0x2E, 0x00, 0xFC, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0x90, 0x0F, 0xC0, 0x1A, 0x00,
-    0x3F, 0xE0, 0x3F, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0xFC, 0x0F, 0xFC, 0x03, 0xFE, 0x03, 0xF0, 0x3F,
-    0xF0, 0x0B, 0xF0, 0x0F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xE7, 0xFE, 0x3F, 0xD0, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC3, 0xFE, 0x3F, 0xF3, 0xFE, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
-    0xFC, 0x7F, 0xE7, 0xFE, 0x3F, 0xD0, 0x64, 0x05, 0x03, 0xFD, 0x7F, 0xE7, 0xFE, 0x2F, 0xC0, 0x00,
-    0x0A, 0x43, 0xFD, 0x7F, 0xE3, 0xFE, 0x1F, 0x80, 0x00, 0x1A, 0x43, 0xFD, 0x7F, 0xE3, 0xFD, 0x1F,
-    0x80, 0x00, 0x1F, 0x83, 0xFD, 0x7F, 0xE3, 0xFD, 0x0A, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD,
-    0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00,
-    0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x07, 0xD0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x2F, 0xF8, 0x3F, 0xFC, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x38, 0x2C, 0x38, 0x2C, 0x0B, 0xE0, 0x03, 0xC0,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0xFE, 0x00, 0x3F, 0xFF, 0x02, 0xFF, 0xFE, 0x0F, 0xF2,
-    0xFC, 0x7F, 0x47, 0xF5, 0xFC, 0x0F, 0xD7, 0xF0, 0x3F, 0x5F, 0xC0, 0xFD, 0x7F, 0x43, 0xF4, 0xFE,
-    0x2F, 0xC2, 0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x28, 0xBD, 0x7C,
-    0x00, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x68, 0x00, 0x1A, 0x80, 0x00, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xDF, 0xC0, 0x3E, 0x3F, 0x01, 0xF0, 0xFC, 0x0F, 0x43,
-    0xF0, 0xBF, 0xFF, 0xFA, 0xFF, 0xFF, 0xF6, 0xAA, 0xFE, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x2A,
-    0xAA, 0x03, 0xFF, 0xF4, 0x7F, 0xFF, 0x47, 0xC0, 0x00, 0x7D, 0x00, 0x0B, 0xFF, 0xD0, 0x7F, 0xFF,
-    0x80, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0xF5, 0x7F, 0xCF, 0xFF, 0xF4, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xD0, 0x0F, 0xFF, 0x40, 0xFF, 0xE9, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00,
-    0xFD, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xD0, 0xFD, 0x7F, 0x03, 0xF4, 0xFC, 0x0F, 0xD3, 0xF9, 0xBF,
-    0x03, 0xFF, 0xF8, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA0, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x40, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
-    0xBE, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFE, 0x00,
-    0x7F, 0xFF, 0x43, 0xF9, 0xBF, 0x0F, 0xC0, 0xFC, 0x2F, 0x87, 0xE0, 0x3F, 0xFF, 0x00, 0xBF, 0xF8,
-    0x0B, 0xFB, 0xF8, 0x3F, 0x03, 0xF5, 0xF8, 0x0B, 0xD3, 0xF4, 0x7F, 0x0B, 0xFF, 0xF8, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0x03, 0xFE, 0xFE, 0x1F, 0xC0, 0xFC, 0x7F,
-    0x02, 0xF5, 0xFC, 0x0F, 0xD3, 0xFE, 0xFF, 0x47, 0xFE, 0xFD, 0x01, 0x43, 0xF0, 0x00, 0x2F, 0xC0,
-    0x57, 0xFD, 0x07, 0xFF, 0xD0, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0xF4, 0x00,
-    0x3D, 0x01, 0x5F, 0x94, 0xFF, 0xFF, 0x6A, 0xFA, 0x80, 0x3D, 0x00, 0x0F, 0x40, 0x02, 0xD0, 0x00,
-    0x55, 0x55, 0x3F, 0xFF, 0xDA, 0xAA, 0xA0, 0x00, 0x00, 0x3F, 0xFF, 0xDF, 0xFF, 0xF4, 0x00, 0x00,
-    0xAA, 0xAA, 0x7F, 0xFF, 0xD5, 0x55, 0x50, 0x01, 0x50, 0x7D, 0x0F, 0xC1, 0xF4, 0x2F, 0x03, 0xF0,
-    0x3E, 0x03, 0xE0, 0x3D, 0x03, 0xD0, 0x3E, 0x03, 0xE0, 0x2F, 0x01, 0xF0, 0x0F, 0x80, 0xBC, 0x02,
-    0xE0, 0x54, 0x07, 0xD0, 0x2F, 0x01, 0xF4, 0x0F, 0x80, 0xBC, 0x0B, 0xC0, 0x7C, 0x07, 0xC0, 0x7C,
-    0x07, 0xC0, 0xBC, 0x0F, 0xC0, 0xF4, 0x2F, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0x8F, 0xF8,
-    0xBF, 0xFF, 0xEB, 0xF0, 0x7F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD,
-    0x03, 0xFB, 0xD0, 0x3F, 0x68, 0x02, 0xA0, 0x02, 0xFE, 0x00, 0x3F, 0xFF, 0x02, 0xFF, 0xFE, 0x0F,
-    0xF2, 0xFC, 0x7F, 0x47, 0xF5, 0xFC, 0x0F, 0xD7, 0xF0, 0x3F, 0x5F, 0xC0, 0xFD, 0x7F, 0x43, 0xF4,
-    0xFE, 0x2F, 0xC2, 0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0xBF, 0xFC, 0x2F, 0x7F, 0x02, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x06, 0xFE, 0x02, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xD0, 0xD0, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xE0,
-    0x07, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF0, 0x06, 0xFE, 0x00,
-    0xFF, 0xFF, 0x02, 0xFA, 0xFE, 0x01, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x0A, 0xFF, 0x00, 0x3F, 0xF4,
-    0x00, 0xAB, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC3, 0xE6, 0xFF, 0x0F, 0xFF, 0xF4, 0x2F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03,
-    0xDF, 0xC0, 0x3E, 0x3F, 0x01, 0xF0, 0xFC, 0x0F, 0x43, 0xF0, 0xBF, 0xFF, 0xFA, 0xFF, 0xFF, 0xF6,
-    0xAA, 0xFE, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x2A, 0xAA, 0x03, 0xFF, 0xF4, 0x7F, 0xFF, 0x47,
-    0xC0, 0x00, 0x7D, 0x00, 0x0B, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0xFC, 0xF5, 0x7F, 0xCF, 0xFF, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x0F, 0xFF,
-    0x40, 0xFF, 0xE9, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xD0,
-    0xFD, 0x7F, 0x03, 0xF4, 0xFC, 0x0F, 0xD3, 0xF9, 0xBF, 0x03, 0xFF, 0xF8, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2A, 0xAA, 0xA0, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0,
-    0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xFF, 0x43, 0xF9, 0xBF, 0x0F, 0xC0,
-    0xFC, 0x2F, 0x87, 0xE0, 0x3F, 0xFF, 0x00, 0xBF, 0xF8, 0x0B, 0xFB, 0xF8, 0x3F, 0x03, 0xF5, 0xF8,
-    0x0B, 0xD3, 0xF4, 0x7F, 0x0B, 0xFF, 0xF8, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x7F, 0xFF, 0x03, 0xFE, 0xFE, 0x1F, 0xC0, 0xFC, 0x7F, 0x02, 0xF5, 0xFC, 0x0F, 0xD3, 0xFE, 0xFF,
-    0x47, 0xFE, 0xFD, 0x01, 0x43, 0xF0, 0x00, 0x2F, 0xC0, 0x57, 0xFD, 0x07, 0xFF, 0xD0, 0x1F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0xF4, 0x00, 0x3D, 0x01, 0x5F, 0x94, 0xFF, 0xFF, 0x6A,
-    0xFA, 0x80, 0x3D, 0x00, 0x0F, 0x40, 0x02, 0xD0, 0x00, 0x55, 0x55, 0x3F, 0xFF, 0xDA, 0xAA, 0xA0,
-    0x00, 0x00, 0x3F, 0xFF, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0xAA, 0xAA, 0x7F, 0xFF, 0xD5, 0x55, 0x50,
-    0x01, 0x50, 0x7D, 0x0F, 0xC1, 0xF4, 0x2F, 0x03, 0xF0, 0x3E, 0x03, 0xE0, 0x3D, 0x03, 0xD0, 0x3E,
-    0x03, 0xE0, 0x2F, 0x01, 0xF0, 0x0F, 0x80, 0xBC, 0x02, 0xE0, 0x54, 0x07, 0xD0, 0x2F, 0x01, 0xF4,
-    0x0F, 0x80, 0xBC, 0x0B, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0xBC, 0x0F, 0xC0, 0xF4, 0x2F,
-    0x03, 0xE0, 0xBC, 0x00, 0x06, 0xFF, 0x40, 0xFF, 0xFD, 0x05, 0x03, 0xF0, 0x00, 0x3F, 0x0B, 0xFF,
-    0xF3, 0xF9, 0x7F, 0x3F, 0x03, 0xF3, 0xF0, 0x7F, 0x3F, 0xFF, 0xF0, 0xBF, 0x4F, 0x01, 0xFE, 0x40,
-    0x3F, 0xFF, 0x42, 0xF8, 0x2F, 0x0F, 0xC0, 0x7D, 0x3F, 0xFF, 0xF4, 0xFE, 0xAA, 0x93, 0xF0, 0x00,
-    0x0B, 0xE0, 0x04, 0x0F, 0xFF, 0xF0, 0x07, 0xFE, 0x40, 0x01, 0xFE, 0x40, 0x3F, 0xFF, 0x82, 0xF8,
-    0x3F, 0x4F, 0xC0, 0x3F, 0x3F, 0x00, 0xFC, 0xFC, 0x03, 0xF3, 0xF0, 0x0F, 0xCB, 0xE0, 0xBD, 0x0F,
-    0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x7E, 0x02, 0xF4, 0xFD, 0x1F, 0xC0, 0xFC, 0xFC, 0x01, 0xFF, 0xD0,
-    0x02, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xF4, 0x07, 0xF3, 0xF0, 0x3F, 0x03, 0xF1, 0xF4, 0x07,
-    0xD0, 0x0B, 0xFE, 0x00, 0xBF, 0xFF, 0x01, 0x40, 0x7F, 0x00, 0x00, 0xBD, 0x2A, 0xAB, 0xF4, 0xFF,
-    0xFF, 0xD3, 0xE0, 0x2F, 0x0F, 0xC0, 0xFC, 0x0F, 0xFF, 0xD0, 0x0B, 0xF8, 0x00, 0x68, 0x00, 0x0B,
-    0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0xBF, 0x4B, 0xFF, 0xFD, 0xBF, 0x4B, 0xFB, 0xE0,
-    0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xF7, 0xC0, 0x2F,
-    0x68, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x02, 0xE2, 0xF4, 0x3F,
-    0x4B, 0xD3, 0xF4, 0x2F, 0x7F, 0x40, 0xBF, 0xF8, 0x02, 0xFF, 0xF4, 0x0B, 0xE3, 0xF0, 0x2F, 0x47,
-    0xF0, 0xBD, 0x0B, 0xE1, 0xF4, 0x0B, 0xD0, 0x68, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
-    0xBD, 0xBD, 0xBD, 0xBD, 0x7C, 0x78, 0xBF, 0x47, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x8B, 0xF4, 0xBF,
-    0x87, 0xF2, 0xF4, 0x1F, 0xC0, 0xFC, 0xBD, 0x03, 0xE0, 0x2F, 0x2F, 0x40, 0xF8, 0x0B, 0xCB, 0xD0,
-    0x3E, 0x02, 0xF2, 0xF4, 0x0F, 0x80, 0xBC, 0xBD, 0x03, 0xE0, 0x2F, 0x1F, 0x00, 0xF8, 0x0B, 0xC0,
-    0x78, 0xBF, 0x4B, 0xFF, 0xFD, 0xBF, 0x4B, 0xFB, 0xE0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD,
-    0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xF7, 0xC0, 0x2F, 0x78, 0xBE, 0x02, 0xFF, 0xFF, 0x0B, 0xF4,
-    0xBE, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0xD2, 0xF8, 0xBF,
-    0xFF, 0xC2, 0xF6, 0xF8, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x07, 0xFE, 0x0F, 0xFF, 0xD3, 0xE0, 0x10, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0xBF, 0xD0, 0x02, 0xF8,
-    0x90, 0x3E, 0x3F, 0xFF, 0x4B, 0xFE, 0x40, 0x07, 0x40, 0x0B, 0x80, 0x1F, 0xFD, 0xBF, 0xFE, 0x1F,
-    0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x0F, 0xFE, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x2F, 0xF9, 0x6C, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x06, 0xAA,
-    0xA8, 0x7F, 0x82, 0xFF, 0xFF, 0x1F, 0xE0, 0xBF, 0xFF, 0xC7, 0xFC, 0x2F, 0xFF, 0xF0, 0xFF, 0x0B,
-    0xF4, 0x00, 0x3F, 0xF6, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xE5, 0x50,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE1, 0xF0, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFD, 0xBF, 0x40, 0xBF, 0xEB, 0x4B,
-    0x90, 0x0F, 0xF8, 0xF0, 0xB4, 0x02, 0xFF, 0x0F, 0x0F, 0x00, 0x3F, 0xE1, 0xF0, 0xF0, 0x03, 0xFD,
-    0x2E, 0x1E, 0x00, 0x3F, 0xD2, 0xD2, 0xE0, 0x03, 0xFD, 0x3C, 0x2D, 0x00, 0x3F, 0xE3, 0xC3, 0xC0,
-    0x02, 0xFF, 0x7C, 0x3C, 0x00, 0x1F, 0xFF, 0x87, 0x80, 0x00, 0xFF, 0xF4, 0xB8, 0x00, 0x0B, 0xFF,
-    0x9F, 0x9B, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2D, 0x6E, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0x96, 0xF0, 0x2F, 0xF8, 0x00, 0x10, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0xFF, 0x81, 0xA0, 0xBC, 0xFF, 0x42, 0xF7, 0xFC, 0xFF, 0x42, 0xFF, 0xF8, 0xFF, 0x42,
-    0xFF, 0xE4, 0xFF, 0x82, 0xFF, 0x00, 0xBF, 0x82, 0xFD, 0x00, 0xBF, 0xC2, 0xFD, 0x00, 0x7F, 0xD2,
-    0xFD, 0x00, 0x3F, 0xF2, 0xFD, 0x00, 0x1F, 0xFF, 0xFE, 0xB4, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x55, 0x54, 0x07, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x1B, 0xFD, 0x54, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1B, 0xFD,
-    0x54, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0x9B, 0xE0, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x6B, 0xFE,
-    0xAA, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x5B, 0xFD,
-    0x55, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFE,
-    0x0B, 0xFF, 0x4F, 0xFF, 0xF0, 0x3F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF3, 0xFF, 0xD5, 0xFF, 0xFD, 0x5F, 0xFC, 0xFF, 0xD0, 0x1F, 0xFC, 0x01, 0xFF, 0x7F, 0xF0,
-    0x03, 0xFF, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF7, 0xFE, 0x00, 0x3F, 0xD0, 0x03,
-    0xFD, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x7F, 0xE0, 0x07, 0xFD, 0x00, 0x3F, 0xDF, 0xF8, 0x03,
-    0xFF, 0x40, 0x0F, 0xF7, 0xFE, 0x01, 0xFF, 0xD0, 0x03, 0xFD, 0xFF, 0x80, 0xFF, 0xF4, 0x00, 0xFF,
-    0x7F, 0xE0, 0x7F, 0xFD, 0x00, 0x3F, 0xDF, 0xF8, 0x2F, 0xFF, 0x40, 0x0F, 0xF7, 0xFE, 0x0F, 0xBF,
-    0xD0, 0x03, 0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0xF8,
-    0x03, 0xFF, 0x00, 0xBE, 0x00, 0xFF, 0xD0, 0x2F, 0x80, 0x3F, 0xF8, 0x0B, 0xE0, 0x0F, 0xFF, 0x02,
-    0xF8, 0x03, 0xFB, 0xC0, 0xBE, 0x00, 0xFD, 0xF8, 0x2F, 0x81, 0xBF, 0xBF, 0xAF, 0xF8, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x5B, 0xFA, 0xFE, 0xFF, 0x80, 0xFC, 0x3E, 0x1F, 0x81, 0x7F, 0x5F, 0xDB, 0xF4, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFC, 0x0F, 0xDF, 0x80, 0x3F, 0x02, 0xFB, 0xE0,
-    0x0F, 0xC0, 0x7F, 0xF8, 0x03, 0xF0, 0x0F, 0xFE, 0x00, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0x00, 0x7F,
-    0xE0, 0x0F, 0xC0, 0x0F, 0xF8, 0x00, 0xBF, 0xFE, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0xFF,
-    0xC0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x50, 0x0F, 0xF4, 0x03, 0xFD, 0x0B, 0xC0, 0x3F, 0xD0,
-    0x0F, 0xF4, 0x3F, 0x00, 0xFF, 0x40, 0x7F, 0xC1, 0xFC, 0x03, 0xFD, 0x07, 0xFF, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0xFF, 0xFF, 0xF4, 0x03, 0xFC,
-    0x03, 0xFF, 0xA4, 0x00, 0x0F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x42, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x41, 0xFF, 0xF8, 0xFF, 0x40, 0xFF, 0x47, 0xFF, 0xFD, 0xFF,
-    0x40, 0xFF, 0x0F, 0xFF, 0xFC, 0xFF, 0x41, 0xFF, 0x0F, 0xF0, 0x28, 0xFF, 0xAB, 0xFE, 0x1F, 0xE0,
-    0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xE0, 0xFF, 0x4F, 0xF0, 0x00, 0xBF, 0xFC, 0xFF, 0x4F, 0xF8, 0x00, 0x1F, 0xFE, 0xFF,
-    0x47, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x42, 0xFF, 0x19, 0x01,
-    0xFE, 0xFF, 0x40, 0xFF, 0x5F, 0xFF, 0xFD, 0xFF, 0x40, 0xBF, 0xDF, 0xFF, 0xFC, 0xFF, 0x40, 0x3F,
-    0xDB, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0x83, 0xF0,
-    0x07, 0xFC, 0x02, 0xF8, 0x3F, 0x40, 0xBF, 0xC0, 0x3F, 0x83, 0xF4, 0x0B, 0xFC, 0x03, 0xF4, 0x3F,
-    0x80, 0xFF, 0xD0, 0x3F, 0x02, 0xF8, 0x0F, 0xBE, 0x07, 0xF0, 0x1F, 0xC0, 0xF7, 0xE0, 0x7F, 0x01,
-    0xFC, 0x1F, 0x7F, 0x0B, 0xE0, 0x0F, 0xC1, 0xF2, 0xF0, 0xBE, 0x06, 0xFE, 0xBF, 0xBF, 0xAF, 0xE8,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xFF, 0xBF, 0xAF, 0xEF, 0xE8, 0x07, 0xE3, 0xE0, 0xF8, 0xFC,
-    0x00, 0x7F, 0x7D, 0x0F, 0xDF, 0xC0, 0x03, 0xF7, 0xD0, 0xFD, 0xF8, 0x00, 0x3F, 0xBC, 0x0B, 0xEF,
-    0x40, 0x03, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x3F,
-    0xF0, 0x00, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x7F, 0xFF, 0xFA,
-    0x00, 0x07, 0xF6, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xDB, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x6F, 0xE5,
-    0x56, 0xFF, 0x41, 0xFD, 0xBF, 0x40, 0x01, 0xFF, 0x07, 0xF6, 0xFD, 0x1A, 0x83, 0xFC, 0x1F, 0xDB,
-    0xF4, 0xBF, 0x4B, 0xF0, 0x7F, 0x6F, 0xD2, 0xFD, 0x2F, 0xD1, 0xFD, 0xBF, 0x4B, 0xF4, 0xBF, 0x47,
-    0xF6, 0xFD, 0x2F, 0xD2, 0xFD, 0x1F, 0xDB, 0xF4, 0xBF, 0x4B, 0xF4, 0x7F, 0x6F, 0xD2, 0xFD, 0x2F,
-    0xD1, 0xFD, 0xBF, 0x4B, 0xF4, 0xBF, 0x47, 0xF6, 0xFD, 0x2F, 0xD2, 0xFD, 0x1F, 0xDB, 0xF4, 0xBF,
-    0x4B, 0xF4, 0xBF, 0x6F, 0xD2, 0xFD, 0x1A, 0x83, 0xFC, 0xBF, 0x4B, 0xF4, 0x00, 0x1F, 0xF2, 0xFD,
-    0x2F, 0xD0, 0x02, 0xFF, 0x4B, 0xF4, 0xBF, 0xFF, 0xFF, 0xFC, 0x2F, 0xD2, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xBF, 0x4B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0xE3, 0xFD, 0x00, 0xFF,
-    0xFF, 0xBF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x96, 0xFF, 0xD0, 0x7F, 0xF0, 0x0B, 0xFD,
-    0x07, 0xFD, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0xBF, 0xD0,
-    0x03, 0xFD, 0x07, 0xFD, 0x00, 0x3F, 0xD0, 0x7F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x95, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x7F, 0xD0, 0x02, 0xFF, 0xC2, 0xFD, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x6A, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xEA, 0xF4, 0x00, 0xFF, 0x80, 0x04, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0xAF, 0xFA, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x6F, 0xF5, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x5B,
-    0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x3F, 0xC0, 0x3F,
-    0xD0, 0x3F, 0xE0, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0xFF, 0x4B, 0xF8, 0x00,
-    0x3F, 0xD3, 0xFC, 0x00, 0x0F, 0xF6, 0xFD, 0x00, 0x2B, 0xFF, 0xFF, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xFF, 0x00, 0x03, 0xFE, 0x3F, 0xD0, 0x00, 0xFF, 0x47,
-    0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFD, 0x03, 0xFE, 0x00, 0xFF,
-    0x40, 0x7F, 0xD0, 0x3F, 0xD0, 0x0F, 0xFC, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x03, 0xFE, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x89, 0x00, 0x0B, 0xFF, 0xEF, 0xC0, 0x07,
-    0xEF, 0xFF, 0xD0, 0x00, 0x93, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x38, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x95, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x7F, 0xC0, 0x6F, 0xE4, 0x01, 0xFE, 0x00, 0x2F, 0xF0, 0xBF, 0xFF, 0x40, 0xBF, 0x80, 0x0F, 0xF8,
-    0x7F, 0xEF, 0xF0, 0x3F, 0xD0, 0x0B, 0xFC, 0x3F, 0x80, 0xFD, 0x0F, 0xF0, 0x07, 0xFE, 0x1F, 0xC0,
-    0x3F, 0x87, 0xFC, 0x0B, 0xFF, 0x0B, 0xF0, 0x0F, 0xE2, 0xFF, 0xAF, 0xFF, 0x43, 0xFC, 0x03, 0xF4,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0x97, 0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xE4, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0xF5, 0xFF, 0x00, 0x0B,
-    0xFC, 0x3F, 0xC0, 0x02, 0xFE, 0x0B, 0xF0, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0x00,
-    0x03, 0xFD, 0x7F, 0x40, 0x00, 0xBF, 0xEF, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0C, 0x0B, 0xFC, 0x00, 0x07, 0x82, 0xFF, 0x80, 0x03, 0xF1, 0xFF,
-    0xF0, 0x02, 0xFE, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0xBF, 0xC0, 0xBE, 0xFF, 0x0F, 0xF4, 0x3F, 0x2F,
-    0x43, 0xFE, 0x2F, 0x43, 0x80, 0x7F, 0xC0, 0x00, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0xE8, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xD5, 0xFF, 0xD0, 0x1F, 0xF5, 0x5F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x5F, 0xF5, 0x57, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xEB,
-    0xFF, 0xEA, 0xFF, 0xE4, 0x3F, 0xC0, 0x7F, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xE5, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFB, 0xFC, 0x0F, 0xFF, 0x7E, 0x01, 0x41, 0xFF,
-    0xC3, 0xE0, 0x00, 0x2F, 0xF0, 0x3E, 0x00, 0x03, 0xFF, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x3E, 0x00,
-    0x07, 0xFD, 0x03, 0xFA, 0xAA, 0x7F, 0xD0, 0x3F, 0xFF, 0xF7, 0xFD, 0x03, 0xFF, 0xFF, 0x3F, 0xD0,
-    0x3F, 0xFF, 0xF3, 0xFE, 0x03, 0xE2, 0xFF, 0x3F, 0xF0, 0x3E, 0x2F, 0xF2, 0xFF, 0x43, 0xE2, 0xFF,
-    0x0F, 0xFD, 0x3E, 0x2F, 0xF0, 0xBF, 0xFF, 0xFB, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x7F, 0x80,
-    0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x40, 0x7F, 0x80, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0xFF, 0x95, 0x5B, 0xFD, 0x43, 0xFC, 0x00, 0x0F, 0xF0,
-    0x1F, 0xF0, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xF0,
-    0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x07, 0xFA, 0xBF, 0xFC, 0x00, 0x90, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x6A, 0xAA, 0xAF, 0xFE, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xD6, 0xAB, 0xFF, 0xFE, 0xA0, 0x03, 0xFF, 0xFD, 0x00, 0x57, 0xFF, 0xFD, 0x55, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x02, 0x00, 0xFF, 0xE5, 0x6F, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xE3, 0xE0, 0x90, 0x7F, 0xE0, 0xF8, 0x00, 0x2F, 0xF0, 0x3E, 0x00,
-    0x0F, 0xF8, 0x0F, 0x80, 0x03, 0xFD, 0x03, 0xE0, 0x01, 0xFF, 0x40, 0xF8, 0x00, 0x7F, 0xD0, 0x3E,
-    0x00, 0x1F, 0xF4, 0x0F, 0x80, 0x03, 0xFD, 0x03, 0xE0, 0x00, 0xFF, 0x80, 0xF8, 0x00, 0x3F, 0xF0,
-    0x3E, 0x00, 0x0B, 0xFD, 0x0F, 0x80, 0x00, 0xFF, 0xD3, 0xE0, 0x10, 0x2F, 0xFE, 0xFE, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0xFC,
-    0x01, 0xF8, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1B, 0xFD, 0x5F, 0xFD,
-    0x54, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00,
-    0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x07,
-    0xFC, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x07, 0xFE, 0x14, 0x07, 0xFC,
-    0x03, 0xFF, 0xFD, 0x07, 0xFC, 0x02, 0xFF, 0xFD, 0x07, 0xFC, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xEB, 0xFC, 0x00, 0x00, 0xFF, 0x80,
-    0x06, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x68, 0x2E, 0x0B, 0x83, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0x1C, 0xFC, 0x3E, 0x0F, 0x2F,
-    0xC3, 0xFE, 0x0F, 0x43, 0xDF, 0xE0, 0x7F, 0xD3, 0xD0, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBE, 0xFF, 0xFF, 0xE0, 0x00, 0x2E, 0x0F, 0x97, 0xC0, 0x00, 0x0B, 0x83, 0xD0, 0xF0, 0x00,
-    0x00, 0x40, 0x10, 0x14, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x1A, 0xAB, 0xFF, 0xAA,
-    0x80, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC1, 0x5B, 0xFF, 0x55, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x56, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x06, 0x00, 0x03, 0xFE, 0xBF, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0xFF, 0xFD, 0x01, 0x00, 0xFF, 0xFD, 0x6F, 0x00, 0x43,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xE7,
-    0xFC, 0x00, 0xFF, 0x03, 0xFC, 0x01, 0xFE, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x03,
-    0xFC, 0x0F, 0xF8, 0x03, 0xFE, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xB4,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xAF, 0xEA,
-    0xAA, 0xAB, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC1, 0xC0, 0x80, 0x3C, 0x00,
-    0x0F, 0xCB, 0xF7, 0xE0, 0x3C, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0xBC, 0x00, 0x0F, 0xF8, 0x7F, 0x7F,
-    0xF0, 0x00, 0x0F, 0xE0, 0x18, 0x0A, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x61, 0xFF, 0xEA, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xAF, 0xF6, 0xFF, 0xE0, 0x1F, 0xF4, 0x0F,
-    0xF0, 0x2F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x7F,
-    0xC0, 0x0F, 0xF0, 0x07, 0xFC, 0x7F, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0xBF, 0x80, 0x0F, 0xF0, 0x03,
-    0xFC, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00,
-    0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x07,
-    0xFF, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFD,
-    0x07, 0xFC, 0x01, 0xFF, 0xC1, 0xFF, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x07, 0xFC, 0x1F, 0xF0, 0x02,
-    0xFF, 0x07, 0xFC, 0x02, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xBF, 0xFF, 0xFA, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x50, 0x00, 0x00, 0x00,
-    0x7C, 0xB8, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFE, 0xFF, 0xFD, 0x00, 0xFF, 0xEF, 0x2F, 0xFF, 0xC0, 0x7F, 0xD7,
-    0xCB, 0x8F, 0xF4, 0x3F, 0xF1, 0xF2, 0xE2, 0xFF, 0x0F, 0xF4, 0x7C, 0xB8, 0x7F, 0xC7, 0xFD, 0x1F,
-    0x2E, 0x0F, 0xF5, 0xFF, 0x07, 0xCB, 0x83, 0xFD, 0x7F, 0xC1, 0xE1, 0xD0, 0xFF, 0x4F, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xEA,
-    0xAA, 0xA0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x01, 0xD1, 0xD0, 0x00, 0x1E, 0x1D, 0x00, 0x01, 0xE1, 0xD0, 0x07, 0xFF, 0xFE, 0x00,
-    0x7F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xC7, 0xFC, 0x0F, 0xFC, 0x7F, 0xC0,
-    0x7F, 0xC7, 0xFC, 0x07, 0xFC, 0x7F, 0xC0, 0xBF, 0xC7, 0xFE, 0xBF, 0xF8, 0x7F, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC7, 0xFC, 0x0B, 0xFD, 0x7F, 0xC0, 0x3F, 0xE7, 0xFC, 0x03,
-    0xFE, 0x7F, 0xC0, 0x3F, 0xE7, 0xFC, 0x07, 0xFE, 0x7F, 0xEB, 0xFF, 0xD7, 0xFF, 0xFF, 0xF8, 0x7F,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x40, 0x01, 0xE1, 0xD0, 0x00, 0x1E, 0x1D, 0x00, 0x01, 0xD1, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x3F,
-    0xFD, 0x5B, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF,
-    0x95, 0xB8, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0xAA, 0xA8, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x85, 0x55, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE9, 0x6F, 0xD0, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF,
-    0x86, 0xE0, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFE,
-    0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD7,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+static const uint8_t notosans_14_boldBitmaps[33611] = {
+    0x8D, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0xAB, 0xF3, 0x49, 0xDE, 0x62, 0x28, 0x42,
+    0x81, 0x53, 0x2C, 0x25, 0x42, 0x8A, 0xE6, 0x3F, 0x60, 0xD6, 0xA6, 0xA0, 0xB4, 0x9B, 0x28, 0x12,
+    0xFE, 0x0B, 0x70, 0x11, 0xB7, 0x74, 0xBB, 0x98, 0xC2, 0x85, 0x8B, 0xB8, 0x48, 0xF8, 0x07, 0x88,
+    0x10, 0x3A, 0x09, 0xA5, 0xA1, 0xC5, 0xB3, 0x17, 0x17, 0x2E, 0x28, 0x58, 0xE1, 0x22, 0x05, 0x45,
+    0x56, 0x41, 0x82, 0x82, 0xC2, 0x4B, 0x58, 0xF0, 0xDD, 0x79, 0x66, 0x1E, 0xDF, 0x9B, 0x3B, 0x1B,
+    0xA7, 0x01, 0x46, 0x33, 0xB7, 0x3B, 0x37, 0xEF, 0xE7, 0x37, 0xDF, 0x7B, 0x5B, 0xBD, 0x08, 0xE6,
+    0xDC, 0xC7, 0xE9, 0xCC, 0xA9, 0x4C, 0xFD, 0xDC, 0x11, 0xD1, 0x28, 0xF3, 0xD5, 0xAF, 0xC1, 0x34,
+    0x3B, 0xCB, 0x3F, 0x65, 0x1E, 0xAC, 0xA6, 0xDE, 0x9A, 0x6D, 0x6C, 0x3E, 0xA5, 0xAC, 0xFB, 0x80,
+    0xA8, 0x98, 0xCE, 0x88, 0x4E, 0xF2, 0x96, 0xD2, 0xC1, 0x94, 0xA4, 0x1A, 0xA8, 0x9A, 0xAC, 0x4F,
+    0x18, 0x63, 0x8C, 0xE5, 0x0A, 0xFC, 0xF4, 0xE4, 0x54, 0x43, 0x59, 0x6F, 0x96, 0xE2, 0x7B, 0xFC,
+    0x6C, 0xF1, 0xD9, 0x8D, 0x00, 0x55, 0x1F, 0xF5, 0x44, 0xAE, 0x68, 0x68, 0xDC, 0x9D, 0x10, 0xE9,
+    0x83, 0x81, 0xC8, 0x5F, 0x8B, 0xC7, 0x71, 0x0F, 0xEB, 0x5B, 0xA2, 0x7D, 0x3E, 0x56, 0xB0, 0x05,
+    0x9D, 0x33, 0x5E, 0x78, 0xFD, 0xAA, 0x7D, 0xCB, 0x1E, 0x95, 0x29, 0x7F, 0x43, 0x19, 0x0F, 0x34,
+    0x66, 0x8F, 0x27, 0x97, 0x89, 0xE5, 0x92, 0x2C, 0x53, 0xFA, 0xC2, 0x53, 0xBE, 0xBD, 0x38, 0xBE,
+    0x67, 0x7E, 0x0A, 0xCC, 0x9A, 0x79, 0xB0, 0x38, 0xDD, 0xE0, 0xE3, 0x68, 0x2A, 0x6D, 0x89, 0xD6,
+    0xE8, 0x7A, 0xE8, 0x81, 0xB2, 0x81, 0x14, 0xB7, 0x64, 0x09, 0x81, 0x93, 0x6A, 0xC9, 0x9C, 0x0E,
+    0xA9, 0xC3, 0xBF, 0xA6, 0x46, 0x10, 0x66, 0xCB, 0xA9, 0x0E, 0x1B, 0x3D, 0x95, 0xE4, 0xB6, 0x66,
+    0xA6, 0x96, 0x93, 0xC3, 0xFE, 0x61, 0xA9, 0x4F, 0x07, 0x6F, 0x02, 0x74, 0xF4, 0xF7, 0x3C, 0xE4,
+    0x7C, 0x3E, 0x04, 0xDD, 0x14, 0x9D, 0x2D, 0x04, 0x05, 0x35, 0x75, 0x30, 0x94, 0xCD, 0x8A, 0xC6,
+    0x13, 0x55, 0x89, 0x6C, 0x54, 0x27, 0x9B, 0xC4, 0x91, 0x47, 0xB6, 0xA6, 0x54, 0x57, 0x8E, 0xF2,
+    0x9E, 0x0C, 0x23, 0x61, 0x38, 0x6E, 0x63, 0x30, 0xE5, 0x2A, 0xA8, 0x02, 0x79, 0x90, 0xE6, 0x99,
+    0xBC, 0xE1, 0x55, 0xCD, 0xAB, 0x9E, 0x32, 0x97, 0xC1, 0x30, 0x27, 0x50, 0x30, 0x2D, 0xFE, 0x1C,
+    0x7B, 0x6E, 0xB0, 0x97, 0x9F, 0x82, 0x6B, 0x11, 0x6F, 0x72, 0xA7, 0xD9, 0x65, 0x5E, 0x79, 0x9E,
+    0x72, 0xEE, 0x94, 0xE3, 0xCF, 0x59, 0x04, 0xB8, 0x51, 0xDC, 0x21, 0x4F, 0xEE, 0xC7, 0xFC, 0x05,
+    0xA0, 0x12, 0xF4, 0x5B, 0xA0, 0x79, 0xE1, 0xA9, 0xE2, 0x1A, 0xAE, 0xEF, 0xC0, 0xA5, 0xF9, 0xE1,
+    0x0F, 0x17, 0xCC, 0xA3, 0x57, 0xC3, 0x27, 0x74, 0x02, 0x28, 0x4C, 0xAD, 0x1B, 0xD5, 0xE5, 0x3D,
+    0x7C, 0x06, 0xAA, 0x4A, 0xDD, 0xC4, 0x57, 0x26, 0xD3, 0xA8, 0x1E, 0xE0, 0x58, 0x2A, 0xDA, 0x6C,
+    0x86, 0xBD, 0x96, 0x87, 0x45, 0x72, 0x89, 0xA7, 0x8D, 0x52, 0xD7, 0xC0, 0x52, 0x76, 0x10, 0xA9,
+    0x4A, 0x25, 0x2A, 0xB6, 0x8C, 0x92, 0x01, 0x16, 0x55, 0x17, 0x5F, 0x60, 0xAD, 0x95, 0x23, 0x68,
+    0xC0, 0x5E, 0x6D, 0x9A, 0xA2, 0x5D, 0x3F, 0x5E, 0xE6, 0x0D, 0x70, 0x21, 0x00, 0x36, 0x11, 0x81,
+    0x54, 0x27, 0xC5, 0xEE, 0xCF, 0x08, 0xF5, 0x11, 0xD6, 0xA8, 0x9A, 0xEF, 0x20, 0x7E, 0x52, 0x17,
+    0x1D, 0x59, 0x18, 0x74, 0xA6, 0x19, 0xB7, 0x9F, 0x52, 0x22, 0x4A, 0x23, 0x60, 0x25, 0x6C, 0x01,
+    0x3A, 0x19, 0xC8, 0x04, 0xF6, 0x60, 0x9B, 0x43, 0xA9, 0x62, 0xF6, 0x78, 0x0C, 0xF7, 0xAB, 0xFB,
+    0xE5, 0x9B, 0xA7, 0x44, 0x80, 0x76, 0xB4, 0x03, 0x1C, 0x71, 0x45, 0xAD, 0xCD, 0x66, 0xAA, 0x79,
+    0x7F, 0xB2, 0xCD, 0xE7, 0x3C, 0xB0, 0xBF, 0xA1, 0x3E, 0xC0, 0xA5, 0x14, 0xC4, 0x72, 0x34, 0x9E,
+    0x51, 0x0E, 0x8E, 0xF4, 0x54, 0x74, 0x00, 0x40, 0xA6, 0x2D, 0x71, 0x98, 0x84, 0x7F, 0x3B, 0x5F,
+    0x8D, 0x14, 0xF8, 0x56, 0xDC, 0x83, 0x9E, 0x9D, 0x9E, 0x33, 0x2E, 0x8E, 0x0F, 0x5D, 0xC2, 0xBA,
+    0xCB, 0x1C, 0xD7, 0xEA, 0xD2, 0x93, 0xB9, 0xC0, 0xC5, 0xD8, 0x36, 0x0B, 0x0C, 0x4A, 0xC8, 0x16,
+    0xA8, 0xEE, 0x77, 0x88, 0xA1, 0x29, 0x7A, 0x2E, 0xED, 0x73, 0xDE, 0xF5, 0xD0, 0xC5, 0xCD, 0x31,
+    0x28, 0xDE, 0x11, 0x21, 0x2C, 0x71, 0x59, 0x00, 0x60, 0x97, 0xB2, 0x53, 0xEC, 0xCC, 0xA5, 0x2B,
+    0xCE, 0xDC, 0xFA, 0x18, 0x71, 0xFC, 0xBF, 0x89, 0xB1, 0xC6, 0x1D, 0x88, 0x3B, 0x80, 0x5D, 0x7D,
+    0xB5, 0xE0, 0xFE, 0x3B, 0xB2, 0x4D, 0x29, 0xCC, 0x92, 0x53, 0x0D, 0x98, 0x40, 0xA8, 0x1C, 0xAF,
+    0xB6, 0xA5, 0x5C, 0x08, 0xDC, 0x82, 0x6D, 0x6F, 0x3C, 0x78, 0x32, 0x41, 0x49, 0xA1, 0xB8, 0xF8,
+    0x0A, 0xAB, 0x13, 0x93, 0x77, 0xB9, 0x1B, 0x2F, 0x4D, 0x0E, 0xE6, 0x17, 0xEE, 0xDE, 0x25, 0x30,
+    0x53, 0x4C, 0xE6, 0x80, 0xDA, 0x34, 0xA3, 0x5D, 0x0F, 0x86, 0xD6, 0x64, 0x03, 0xAA, 0x16, 0x27,
+    0x69, 0x3C, 0x2D, 0x29, 0x83, 0x41, 0xF5, 0x27, 0x3C, 0xBD, 0x7C, 0x7C, 0x97, 0x0D, 0x74, 0x61,
+    0x6E, 0xD3, 0xC2, 0x62, 0x12, 0x11, 0xD4, 0x30, 0x5D, 0xC0, 0x80, 0x02, 0x2B, 0x72, 0xA8, 0x8F,
+    0x71, 0x92, 0xA1, 0x2E, 0xD2, 0x10, 0x50, 0x4A, 0xB6, 0xA6, 0x00, 0x09, 0x0B, 0x17, 0x55, 0x2A,
+    0x0C, 0xB3, 0x60, 0xAD, 0xEE, 0x8A, 0xC5, 0xB3, 0x70, 0x04, 0x3B, 0xAF, 0xA5, 0xC3, 0xEC, 0x4D,
+    0xEC, 0x62, 0x19, 0x04, 0x24, 0xE0, 0xA7, 0x8E, 0x46, 0x11, 0x65, 0x03, 0x7A, 0x20, 0x14, 0x07,
+    0xA6, 0xF4, 0x1A, 0xE5, 0x27, 0xC1, 0x48, 0xE5, 0xF6, 0x3B, 0x28, 0x4A, 0x29, 0x92, 0x00, 0xDC,
+    0x7D, 0xFA, 0xA4, 0x5A, 0x41, 0x62, 0xAE, 0x65, 0x4A, 0xD2, 0xAF, 0xE7, 0x0F, 0x18, 0x1E, 0x50,
+    0x6E, 0xDC, 0x68, 0x34, 0xA0, 0x78, 0x2B, 0x31, 0x5E, 0x46, 0x98, 0xA2, 0x3C, 0x28, 0x7E, 0x52,
+    0x03, 0xA9, 0x98, 0x1F, 0xB4, 0xAB, 0xCD, 0xC7, 0xA9, 0xB3, 0x5E, 0x5D, 0xB1, 0x47, 0x96, 0x0E,
+    0x64, 0xB8, 0x0C, 0xF1, 0xEE, 0xAD, 0x6D, 0xD3, 0x60, 0xEB, 0x7C, 0xCE, 0xA5, 0x39, 0xE7, 0x07,
+    0x0C, 0xA7, 0x33, 0xE0, 0x58, 0xA7, 0x62, 0x16, 0x85, 0x09, 0xE9, 0x70, 0x6B, 0xF9, 0x78, 0xFB,
+    0x31, 0x1F, 0x31, 0x2B, 0xF8, 0x48, 0x60, 0xB6, 0x89, 0xC1, 0x09, 0xDE, 0x59, 0x58, 0x5E, 0xA3,
+    0x92, 0xEE, 0xD1, 0xFF, 0x13, 0xFB, 0x4A, 0x24, 0xE5, 0x65, 0xA4, 0x60, 0x00, 0x5A, 0x25, 0xFA,
+    0x16, 0xAE, 0xAB, 0xAB, 0x7E, 0x67, 0xAA, 0xCE, 0x50, 0xDF, 0xAA, 0xCF, 0x67, 0x7A, 0xB0, 0xAD,
+    0x20, 0xA0, 0xA5, 0x27, 0x82, 0x95, 0x08, 0x86, 0x7F, 0xE4, 0x23, 0xB0, 0xCD, 0x20, 0x54, 0xA6,
+    0x31, 0x68, 0xAA, 0x7F, 0xF3, 0x29, 0x6F, 0x2F, 0x3B, 0x7C, 0x93, 0xDF, 0x46, 0x60, 0x7F, 0x0E,
+    0x17, 0x5C, 0xC3, 0x6E, 0x57, 0x04, 0x3B, 0xE8, 0x3E, 0x77, 0x26, 0xD6, 0x6B, 0xE6, 0xB1, 0x02,
+    0xDE, 0x83, 0xE9, 0xF3, 0x80, 0xB3, 0xA0, 0x22, 0xC6, 0x7F, 0x79, 0x7A, 0x78, 0xE0, 0x96, 0x69,
+    0x8D, 0x63, 0xCC, 0xC9, 0x88, 0xBB, 0x3C, 0xDA, 0x0D, 0x40, 0xF3, 0x86, 0xF3, 0x52, 0x95, 0xED,
+    0xD3, 0x9B, 0xC6, 0x7D, 0xAB, 0x4E, 0xF5, 0x94, 0x0F, 0x83, 0x1A, 0xD6, 0x6F, 0x8A, 0x4E, 0xC6,
+    0xDB, 0x25, 0x7F, 0x88, 0xD6, 0x5D, 0x49, 0xFF, 0xBE, 0xFE, 0x98, 0x24, 0xC0, 0xA1, 0x2A, 0xA9,
+    0xF0, 0x42, 0xA4, 0x04, 0x3C, 0xAA, 0x7C, 0xEC, 0xB5, 0xC8, 0x34, 0x15, 0xCE, 0xF1, 0x5C, 0xBE,
+    0x34, 0x65, 0xF4, 0x2A, 0x85, 0x2B, 0xC2, 0xF4, 0x8E, 0x68, 0xEE, 0x4D, 0x26, 0x5F, 0x82, 0x4E,
+    0x2F, 0xB1, 0x3E, 0x9E, 0x4C, 0xBE, 0x5E, 0xD9, 0x53, 0xB7, 0xBA, 0xCC, 0x75, 0xBD, 0x83, 0x60,
+    0x4A, 0x6E, 0x05, 0xA9, 0x54, 0x2B, 0xD6, 0x8A, 0x6D, 0xB2, 0xB3, 0xF8, 0xB1, 0x59, 0xE3, 0x56,
+    0xDC, 0x58, 0xF4, 0x41, 0x2E, 0x33, 0x6E, 0xA3, 0xF0, 0x7B, 0xB7, 0xE2, 0x86, 0xFF, 0x2A, 0x7E,
+    0x1D, 0x67, 0xE6, 0x2B, 0x9E, 0x96, 0x42, 0x20, 0x5C, 0x5F, 0xEC, 0xFD, 0x68, 0x2D, 0xBD, 0x54,
+    0x7E, 0xC6, 0x91, 0xC8, 0x42, 0x80, 0x70, 0xA3, 0x27, 0x05, 0xC3, 0xB1, 0x5A, 0xA4, 0xAE, 0xE4,
+    0xEC, 0x0E, 0xFD, 0xE7, 0xF8, 0x1B, 0xBD, 0x55, 0xBD, 0x8E, 0xD5, 0x46, 0x14, 0x9E, 0x6B, 0x8B,
+    0x58, 0xC2, 0xC5, 0x34, 0x9B, 0x26, 0x8D, 0x7B, 0x1A, 0x3F, 0xC2, 0x78, 0x95, 0x92, 0x02, 0xFA,
+    0x2D, 0xF6, 0x11, 0x78, 0x83, 0x1D, 0x13, 0x5E, 0x20, 0x4D, 0x94, 0x32, 0x4D, 0xA4, 0x88, 0xDB,
+    0xF0, 0x04, 0x61, 0x46, 0x49, 0xB1, 0x45, 0x0A, 0x1C, 0xAD, 0x22, 0x8A, 0x2D, 0x76, 0x56, 0x01,
+    0x21, 0x6E, 0x0A, 0x8C, 0xD6, 0x70, 0xBD, 0x77, 0x67, 0xFC, 0xE5, 0x3B, 0xF6, 0xA2, 0x40, 0x41,
+    0x44, 0x28, 0x62, 0x69, 0xCE, 0x9C, 0x33, 0x3F, 0x67, 0xCE, 0xEF, 0x67, 0xA5, 0xEE, 0x4D, 0xAD,
+    0x52, 0x05, 0x10, 0x95, 0x32, 0x78, 0x84, 0x46, 0xA1, 0x55, 0xB6, 0xCB, 0x29, 0x96, 0x7D, 0xD9,
+    0xDF, 0x78, 0x98, 0xC5, 0xCA, 0x1B, 0x84, 0x58, 0xDF, 0x07, 0xC2, 0xCF, 0x26, 0x4F, 0x65, 0x38,
+    0xB2, 0x45, 0x5F, 0x06, 0x7B, 0x54, 0x06, 0xD2, 0xC7, 0xBA, 0xD3, 0x0B, 0xED, 0x8E, 0x1E, 0xEB,
+    0xA0, 0xBB, 0x74, 0x54, 0xF6, 0xF5, 0x79, 0xB4, 0x39, 0x80, 0xC1, 0xEC, 0x63, 0x40, 0xA8, 0xFD,
+    0xAD, 0xF6, 0x56, 0xA3, 0x83, 0xE2, 0x57, 0x50, 0xF3, 0x9E, 0xCA, 0xF0, 0xFC, 0x60, 0x54, 0xCA,
+    0x02, 0xA4, 0x5F, 0x00, 0x1D, 0x77, 0x6E, 0xDC, 0x25, 0xC9, 0xE1, 0x49, 0x31, 0x90, 0xB8, 0x49,
+    0x89, 0x4D, 0x94, 0xF5, 0x15, 0xE5, 0xF2, 0x92, 0x72, 0x9E, 0x8C, 0x57, 0x2B, 0x68, 0xCA, 0xEE,
+    0x3E, 0xB8, 0xDD, 0x51, 0xAE, 0x7A, 0xCA, 0x65, 0xCC, 0xC0, 0xDB, 0x6B, 0xF8, 0x15, 0x44, 0xAB,
+    0x23, 0xE5, 0x6D, 0xC0, 0x57, 0x83, 0xD2, 0xA3, 0x8E, 0xDC, 0xCC, 0xA9, 0xC1, 0xFE, 0x4E, 0x1F,
+    0xF5, 0x48, 0xB5, 0x39, 0xF8, 0xFE, 0x4B, 0x39, 0x18, 0x38, 0x46, 0xB7, 0x71, 0xD1, 0xF9, 0x32,
+    0x39, 0x9F, 0x5F, 0x8F, 0x32, 0xBA, 0x3F, 0xDC, 0xC0, 0xBD, 0x96, 0xE3, 0xDB, 0xF9, 0xCC, 0xB2,
+    0x0F, 0xE7, 0x33, 0x2C, 0x73, 0x31, 0xF1, 0x5E, 0xE2, 0x5E, 0x5C, 0xF4, 0x88, 0xCD, 0xFC, 0x56,
+    0x6E, 0x6A, 0x18, 0xD4, 0x91, 0x23, 0x15, 0xD8, 0x20, 0x47, 0xBB, 0xDA, 0x67, 0x64, 0x95, 0xB8,
+    0x63, 0x18, 0x08, 0xF1, 0xA0, 0x48, 0x3C, 0x48, 0x27, 0x18, 0x6F, 0xA5, 0x68, 0xA5, 0x12, 0xFB,
+    0xE6, 0x13, 0xB5, 0x08, 0xB4, 0xB3, 0x71, 0xD3, 0x41, 0xAF, 0x25, 0x39, 0xD4, 0x2E, 0x71, 0x6A,
+    0xD4, 0xEA, 0xEE, 0x6C, 0x75, 0x49, 0xC5, 0xB2, 0x38, 0x92, 0xE1, 0xBB, 0xBE, 0xC4, 0xED, 0xA8,
+    0x2A, 0x3A, 0xA0, 0xDC, 0x69, 0x54, 0xB4, 0xCA, 0x2B, 0xF3, 0x97, 0xF8, 0x2C, 0xCC, 0x15, 0x99,
+    0x77, 0x2B, 0x45, 0x92, 0x33, 0xBF, 0x2D, 0x87, 0x79, 0x6B, 0x7A, 0xB4, 0xB8, 0x7F, 0xAD, 0xF0,
+    0x72, 0x4E, 0xCA, 0x0F, 0xC0, 0x0B, 0xE0, 0x92, 0x4B, 0x56, 0xC2, 0x2B, 0x49, 0x13, 0x43, 0xED,
+    0x66, 0x5D, 0x01, 0xC7, 0xC0, 0x6B, 0x9A, 0xF4, 0xE1, 0x0E, 0x85, 0xDD, 0xFA, 0xFB, 0xF9, 0xCE,
+    0x44, 0x05, 0x2D, 0xC7, 0xE1, 0x47, 0x94, 0x50, 0xF8, 0x47, 0x09, 0xF0, 0xE1, 0xCE, 0xFB, 0xC2,
+    0xF5, 0x57, 0xE3, 0x19, 0x07, 0x82, 0xC4, 0x21, 0xC7, 0xCE, 0x79, 0x56, 0xC7, 0x5E, 0xC5, 0x32,
+    0xCA, 0x24, 0x76, 0xA6, 0x97, 0xAA, 0x98, 0x83, 0xF8, 0xD5, 0xFA, 0xA7, 0xC4, 0xE4, 0xDB, 0xAE,
+    0xC2, 0x85, 0x30, 0x8C, 0x73, 0x7D, 0x01, 0x1E, 0x63, 0x38, 0xEB, 0x1E, 0x5D, 0x86, 0x12, 0xCF,
+    0x5D, 0x2F, 0x45, 0x21, 0xA1, 0xEB, 0x57, 0x8E, 0x9A, 0xD5, 0x97, 0xF3, 0x5B, 0xF5, 0x8B, 0xA8,
+    0xB2, 0xE9, 0xDF, 0x98, 0xCD, 0xDA, 0xD1, 0x9D, 0xD9, 0x3B, 0x2C, 0xCC, 0xA7, 0xDC, 0x22, 0x13,
+    0x0C, 0x7B, 0x00, 0x27, 0xC0, 0x3E, 0x02, 0x4D, 0x2E, 0x23, 0x8D, 0x51, 0x52, 0x41, 0x1F, 0x61,
+    0x75, 0x62, 0xEB, 0xDC, 0x41, 0xE2, 0x35, 0x89, 0x87, 0x65, 0x41, 0x4B, 0x50, 0xFE, 0x23, 0xCB,
+    0xF2, 0x9C, 0x6E, 0xBA, 0x81, 0xFD, 0x23, 0x51, 0x6B, 0xD5, 0xEC, 0xA5, 0x3B, 0xE6, 0x33, 0x83,
+    0xF5, 0x45, 0x2A, 0xE2, 0x8A, 0x49, 0xF2, 0xA6, 0x2F, 0x22, 0x5B, 0xC3, 0xFE, 0x82, 0xA6, 0x88,
+    0x36, 0x28, 0xFB, 0x64, 0x14, 0x30, 0x90, 0x22, 0x98, 0x99, 0x4E, 0xD9, 0x2B, 0x6A, 0x4C, 0xD5,
+    0xC8, 0xEB, 0xAE, 0x2B, 0xA2, 0x34, 0x8D, 0xAF, 0x46, 0xBE, 0x01, 0x6F, 0xD9, 0x01, 0xC5, 0xA2,
+    0x70, 0x96, 0xC4, 0x09, 0xBE, 0xFB, 0x19, 0xD3, 0xB4, 0x7E, 0xC8, 0x84, 0x9C, 0xB2, 0x54, 0x38,
+    0x75, 0x96, 0x98, 0x60, 0x2E, 0xD1, 0x33, 0x73, 0x5B, 0x5A, 0xA0, 0x71, 0x46, 0xFB, 0x0D, 0xAC,
+    0xA4, 0x32, 0x4D, 0x49, 0xE9, 0x57, 0xDB, 0xED, 0xA8, 0x8C, 0x3D, 0x3B, 0xED, 0xB3, 0x08, 0x7B,
+    0xE8, 0xF5, 0x9F, 0x69, 0x32, 0xAD, 0xB9, 0xB3, 0x1D, 0x91, 0x45, 0x73, 0x76, 0x1E, 0x75, 0x80,
+    0x7D, 0x30, 0x98, 0xAF, 0xD3, 0xA4, 0x5F, 0x47, 0xBD, 0x1D, 0xEB, 0x27, 0xC1, 0x9C, 0x05, 0xEB,
+    0x1A, 0xD8, 0x96, 0xE1, 0x48, 0x53, 0xC6, 0x72, 0xDA, 0xB2, 0x3B, 0x1B, 0x2E, 0xD3, 0x7F, 0x2E,
+    0xD7, 0x21, 0x8F, 0x76, 0x50, 0x59, 0xB4, 0x6C, 0x96, 0x68, 0x27, 0x21, 0x98, 0x49, 0x2B, 0x84,
+    0x88, 0x68, 0x6D, 0x4F, 0x72, 0x38, 0x90, 0xDC, 0x8E, 0x24, 0x0F, 0x26, 0x92, 0x6F, 0x40, 0xD2,
+    0xE2, 0x57, 0x12, 0x7B, 0x42, 0x62, 0x2E, 0x48, 0xAA, 0xB7, 0x24, 0x25, 0xAB, 0xBB, 0xCD, 0x85,
+    0x64, 0x42, 0xD4, 0x4C, 0xAC, 0x10, 0x13, 0x97, 0xC2, 0xCE, 0x04, 0x2D, 0x4A, 0x01, 0x2B, 0x69,
+    0x62, 0x36, 0xE3, 0x06, 0x23, 0xBB, 0xBE, 0x40, 0x26, 0x18, 0x1C, 0x08, 0x04, 0x3A, 0xB2, 0x86,
+    0x33, 0x08, 0x36, 0xD8, 0xA7, 0x2C, 0xF2, 0xEA, 0x0D, 0x11, 0xA0, 0x48, 0xC4, 0x8B, 0x15, 0x0E,
+    0x65, 0xF1, 0x84, 0x1A, 0x58, 0xDA, 0x72, 0x92, 0x45, 0x5E, 0x4C, 0xF3, 0x75, 0x22, 0xE7, 0x3D,
+    0xB4, 0x5A, 0x74, 0x4A, 0x9D, 0xB7, 0x04, 0x8E, 0xA9, 0x51, 0x82, 0x1C, 0x4C, 0xEB, 0xB3, 0x8C,
+    0x51, 0xE6, 0x7B, 0x53, 0x2D, 0x98, 0xE5, 0xEB, 0x1D, 0x66, 0x7C, 0x70, 0xAF, 0x7A, 0x81, 0x34,
+    0xBD, 0xC3, 0x4A, 0xF2, 0x00, 0xEE, 0xF6, 0x44, 0xB3, 0x0C, 0xEB, 0x46, 0x92, 0xC4, 0xDA, 0x94,
+    0x44, 0x49, 0xC7, 0xBD, 0x27, 0xAA, 0xFF, 0xDD, 0x0F, 0x29, 0xE4, 0x95, 0x1D, 0xD4, 0x02, 0x8F,
+    0xBC, 0x48, 0x43, 0xF8, 0xAA, 0x58, 0xE1, 0x7A, 0x8B, 0x1F, 0x17, 0x33, 0xA4, 0xB9, 0x4B, 0x02,
+    0x5B, 0xE3, 0x7C, 0x15, 0x69, 0xAF, 0xF3, 0x02, 0xE6, 0xD7, 0x8C, 0x1E, 0xCB, 0x74, 0x30, 0x03,
+    0x40, 0xC7, 0xC3, 0x41, 0x09, 0x66, 0x97, 0x91, 0xA6, 0x2D, 0xA7, 0x88, 0xC1, 0x8C, 0xCA, 0x50,
+    0x4A, 0x81, 0x0B, 0xBC, 0x93, 0x31, 0xBD, 0xF3, 0x33, 0x2C, 0xCB, 0x53, 0x81, 0x97, 0xCE, 0x19,
+    0x42, 0xB3, 0x73, 0xC7, 0x49, 0xED, 0xB1, 0xEA, 0xE5, 0x8F, 0x46, 0x14, 0xCA, 0xA9, 0x4B, 0x73,
+    0x18, 0x69, 0x1A, 0x71, 0x9C, 0x7E, 0xBA, 0x30, 0x87, 0xAC, 0xDA, 0x71, 0x72, 0xDF, 0x49, 0x60,
+    0xE5, 0x37, 0x91, 0x09, 0x8E, 0xEF, 0xCD, 0x40, 0x0B, 0x42, 0x21, 0x9E, 0x72, 0xBC, 0x81, 0xA0,
+    0xBC, 0x1E, 0xDF, 0xFD, 0x04, 0xDA, 0xEB, 0xDF, 0xC4, 0xE7, 0x2D, 0x7C, 0xF2, 0xF7, 0x37, 0x95,
+    0x55, 0xBD, 0x8E, 0x1C, 0x45, 0x10, 0xAE, 0x99, 0xB1, 0x19, 0x89, 0x09, 0x9A, 0x00, 0x27, 0x10,
+    0x4C, 0xEE, 0xA4, 0x1F, 0xA1, 0x17, 0x39, 0x20, 0xC4, 0xC9, 0x89, 0x80, 0x80, 0x47, 0xE0, 0x11,
+    0x7A, 0xE0, 0x02, 0x07, 0x04, 0x26, 0x23, 0x84, 0x84, 0x80, 0x4B, 0xE0, 0x01, 0x90, 0x7A, 0x74,
+    0x0E, 0x08, 0x48, 0x06, 0x4E, 0xE0, 0xC0, 0xC1, 0x8D, 0x74, 0xB2, 0x08, 0x1C, 0x5C, 0x5B, 0x1E,
+    0xDF, 0xF6, 0xF9, 0xBA, 0xBB, 0xF8, 0xAA, 0x67, 0x6D, 0x09, 0xD8, 0x33, 0x66, 0x77, 0x7A, 0xB7,
+    0x7F, 0xEA, 0xA7, 0xEB, 0xFB, 0xAA, 0x6A, 0xEC, 0x40, 0xFA, 0x51, 0xA4, 0x26, 0xBB, 0x91, 0xCC,
+    0x93, 0xFF, 0x3D, 0xB1, 0x98, 0xFC, 0x99, 0xA8, 0x4D, 0xC6, 0x13, 0x1F, 0xF3, 0x63, 0x17, 0x14,
+    0x33, 0x93, 0x61, 0x1E, 0xC9, 0xF2, 0x44, 0x74, 0x93, 0xC8, 0x6D, 0xA8, 0x7B, 0xC1, 0x44, 0xE6,
+    0x2C, 0x12, 0xB1, 0x0A, 0xD4, 0x45, 0xED, 0xC9, 0x4C, 0x66, 0x24, 0x26, 0xDE, 0x74, 0xB1, 0x86,
+    0xC2, 0xD4, 0x44, 0xAC, 0xD4, 0xD2, 0x46, 0xD2, 0xB3, 0x99, 0xC8, 0x8C, 0xD0, 0xE0, 0x0F, 0x23,
+    0x55, 0x59, 0x4F, 0xD4, 0x44, 0xAC, 0xD4, 0x16, 0xFA, 0xBD, 0x18, 0x35, 0x58, 0x11, 0x07, 0xA2,
+    0x4A, 0x56, 0x0D, 0x17, 0x1F, 0x22, 0xAF, 0x67, 0xB2, 0x78, 0x7E, 0x86, 0x11, 0xB1, 0x03, 0x83,
+    0x62, 0x13, 0xC6, 0x19, 0xF6, 0xBB, 0x50, 0x31, 0x9E, 0x8A, 0xC9, 0x39, 0x72, 0x83, 0x19, 0xCD,
+    0x0F, 0xA3, 0x99, 0xD4, 0xA2, 0x1E, 0x2E, 0xCA, 0xD7, 0xB9, 0x5D, 0x32, 0x9C, 0xDB, 0xE3, 0x68,
+    0x8E, 0x33, 0x29, 0xCF, 0x9D, 0xE7, 0x4D, 0x13, 0xCD, 0xE7, 0x09, 0xF7, 0x74, 0x9F, 0x4E, 0xE6,
+    0xBE, 0xA7, 0xFE, 0x89, 0x57, 0xDB, 0x00, 0x87, 0xA1, 0xCE, 0x09, 0xEE, 0x12, 0x62, 0x24, 0xD2,
+    0xE2, 0x66, 0xA4, 0x96, 0xC7, 0x86, 0x67, 0xEC, 0xCE, 0xE4, 0x16, 0xDC, 0x71, 0xA1, 0x1E, 0xF7,
+    0x35, 0x33, 0xF5, 0x41, 0x2F, 0x64, 0xBC, 0x82, 0xF1, 0xA9, 0x4D, 0xC4, 0x63, 0xCD, 0xB5, 0x5C,
+    0xF6, 0x30, 0x13, 0xD9, 0x53, 0x91, 0x61, 0xC8, 0x2B, 0xD1, 0x85, 0x0D, 0x89, 0x67, 0xA0, 0x62,
+    0x11, 0xC1, 0xCE, 0xBB, 0x53, 0xF7, 0x0B, 0x90, 0xE0, 0x3B, 0x19, 0x87, 0x95, 0x40, 0x06, 0x2B,
+    0x7D, 0x80, 0x71, 0xC0, 0xAE, 0x17, 0x37, 0x91, 0x8A, 0xA0, 0x44, 0x3F, 0x85, 0x26, 0x1F, 0x32,
+    0x00, 0x6E, 0x12, 0x20, 0x2D, 0xC8, 0x22, 0xBE, 0x85, 0xB4, 0x17, 0xC6, 0x4E, 0x70, 0x67, 0x77,
+    0xEE, 0xE1, 0x9A, 0x05, 0xBA, 0x20, 0xAE, 0xE0, 0xA5, 0xC5, 0x3D, 0x20, 0x86, 0x1F, 0xE0, 0x8E,
+    0xC3, 0x0D, 0xF6, 0xD3, 0xDE, 0x2D, 0xD0, 0xCA, 0xC2, 0xEF, 0x03, 0x0C, 0x8F, 0x01, 0x0B, 0x88,
+    0x0A, 0xEE, 0x70, 0x9C, 0x57, 0x22, 0xEA, 0x62, 0x1A, 0xF2, 0x12, 0x04, 0x9C, 0x22, 0xE6, 0x02,
+    0x02, 0x00, 0x40, 0x3C, 0x12, 0xA7, 0x28, 0xE5, 0xA3, 0xA3, 0x7B, 0xD0, 0x7F, 0x8A, 0x11, 0xAD,
+    0x24, 0x0C, 0x97, 0xCF, 0xC8, 0x4D, 0x54, 0xDE, 0x5C, 0xFF, 0xF7, 0x1C, 0xC2, 0xF9, 0xE8, 0x5B,
+    0xB0, 0x6D, 0x07, 0xA4, 0x08, 0x21, 0x35, 0x94, 0x97, 0xA7, 0x05, 0x2B, 0x91, 0xEA, 0x84, 0x74,
+    0x21, 0x5A, 0xF3, 0xC1, 0xBC, 0x46, 0x82, 0x4C, 0xB6, 0xF8, 0x62, 0xFA, 0x06, 0xDF, 0x5B, 0x45,
+    0xF6, 0xF6, 0xF7, 0xD4, 0x0A, 0x39, 0x81, 0x8A, 0x03, 0x72, 0x88, 0xC7, 0x00, 0x13, 0xFD, 0xCD,
+    0x48, 0xEA, 0xC1, 0x42, 0xDD, 0x6C, 0xA9, 0xF1, 0x6A, 0xAA, 0x62, 0x15, 0x09, 0xE8, 0x6F, 0x2C,
+    0xB5, 0x1E, 0x77, 0x48, 0x6F, 0x0F, 0xF4, 0xDE, 0x70, 0xEB, 0xE0, 0xE0, 0x0E, 0x62, 0xBD, 0x7D,
+    0x74, 0x34, 0x1C, 0x6C, 0xC0, 0x1C, 0x6F, 0x80, 0xAE, 0xA3, 0x0A, 0x40, 0x01, 0x3F, 0x00, 0x89,
+    0xC3, 0x1A, 0xA3, 0xF9, 0x4A, 0xFB, 0x15, 0x74, 0xDE, 0xBC, 0xCF, 0x09, 0x60, 0x2F, 0x9C, 0xDD,
+    0x23, 0x64, 0x8D, 0xF5, 0x4D, 0xE2, 0xA1, 0xBF, 0xE0, 0x0F, 0xF8, 0x21, 0xA0, 0xFA, 0x88, 0x53,
+    0xEA, 0xF8, 0x70, 0x59, 0x2D, 0xAC, 0x70, 0xEF, 0x1D, 0x5F, 0x66, 0x62, 0x07, 0x64, 0x85, 0xB1,
+    0xE7, 0x76, 0xE1, 0x51, 0x05, 0x1E, 0xBB, 0xC8, 0x83, 0x8C, 0x76, 0x37, 0x30, 0x97, 0x3D, 0x39,
+    0x13, 0x19, 0x91, 0xB5, 0x3C, 0x66, 0x25, 0x50, 0xDD, 0x2D, 0xF6, 0x5B, 0x5E, 0x1A, 0x21, 0x88,
+    0x83, 0x4E, 0x9F, 0x08, 0xD1, 0xE0, 0x55, 0x78, 0x07, 0xC5, 0xBB, 0xBF, 0x76, 0xCD, 0xF6, 0x86,
+    0x7F, 0xFF, 0x09, 0xD7, 0x1E, 0x2D, 0x47, 0x72, 0xD0, 0x7F, 0x77, 0xBD, 0x5F, 0xC9, 0x9F, 0x7F,
+    0x8F, 0x8A, 0x4F, 0x10, 0xC6, 0x36, 0xF5, 0xCC, 0xC9, 0x5C, 0x7E, 0x96, 0xCC, 0xDC, 0x25, 0x3B,
+    0x36, 0xC9, 0xFD, 0x63, 0xC8, 0x9E, 0x99, 0xDB, 0x22, 0x23, 0xB2, 0x1D, 0x5F, 0xA4, 0x9A, 0x7F,
+    0x4D, 0x74, 0x63, 0x67, 0xDE, 0x25, 0x92, 0xFB, 0xC1, 0xB3, 0xD7, 0x4B, 0x8F, 0x92, 0x6F, 0x23,
+    0x74, 0xA2, 0x03, 0xA6, 0xAF, 0x86, 0x64, 0xE3, 0xB8, 0x66, 0xA3, 0x0E, 0xF4, 0xA3, 0xC8, 0x42,
+    0xC7, 0x93, 0x93, 0x2E, 0x72, 0xB7, 0x84, 0xAA, 0x78, 0x52, 0xEC, 0x3B, 0x10, 0xC1, 0x37, 0x25,
+    0xED, 0xC1, 0x84, 0x66, 0x8F, 0x58, 0xE0, 0xB4, 0xB2, 0x8F, 0x85, 0x35, 0xB9, 0xF8, 0x7A, 0x72,
+    0xFD, 0x42, 0x3E, 0x15, 0xAE, 0xD7, 0xF1, 0x8B, 0x37, 0x0F, 0x2D, 0xF4, 0xBB, 0xD0, 0xAE, 0x10,
+    0x1A, 0x6A, 0xF5, 0x86, 0xD8, 0x6B, 0xE3, 0x3B, 0xA8, 0x31, 0xFD, 0x9D, 0x0B, 0x5A, 0x42, 0x43,
+    0x88, 0x6F, 0xF1, 0x65, 0xC1, 0x33, 0xAF, 0xB5, 0x24, 0xD1, 0x80, 0xE8, 0x57, 0xCB, 0xDF, 0x78,
+    0x02, 0x77, 0x67, 0xE0, 0xF0, 0x94, 0xBF, 0x66, 0x57, 0x58, 0xEB, 0x38, 0x23, 0x8C, 0x80, 0x40,
+    0x67, 0x24, 0xD9, 0x70, 0xDD, 0x72, 0x44, 0x79, 0x98, 0xB3, 0xDC, 0x4B, 0x9A, 0x67, 0x4C, 0xF6,
+    0x3C, 0x70, 0x86, 0x92, 0x52, 0x01, 0xEE, 0xEC, 0x4B, 0x5A, 0x79, 0x30, 0x73, 0xD9, 0x79, 0xFD,
+    0xE4, 0x0F, 0x77, 0x01, 0x0E, 0x52, 0x1F, 0x8A, 0x1E, 0x3A, 0x35, 0x75, 0x98, 0xD6, 0x92, 0x62,
+    0x6E, 0xF8, 0xDB, 0x06, 0x3A, 0xDA, 0xA0, 0x17, 0x3D, 0xF7, 0x4B, 0x17, 0x7A, 0xB4, 0x5A, 0xA8,
+    0xB8, 0xFB, 0x81, 0xF4, 0x79, 0x44, 0xA9, 0x30, 0x5A, 0x8C, 0xB4, 0x58, 0x34, 0x5F, 0x8D, 0x6C,
+    0xEE, 0x82, 0x82, 0x04, 0x3A, 0x0E, 0x54, 0xBC, 0x9E, 0x1B, 0x86, 0x0D, 0xBC, 0x02, 0xCC, 0xF9,
+    0x55, 0x66, 0xB7, 0xF7, 0x67, 0xF5, 0x4F, 0xE6, 0x0B, 0x9E, 0x6C, 0x54, 0x5B, 0x4E, 0x96, 0x4F,
+    0x4A, 0xF7, 0x89, 0xC8, 0x7D, 0xFE, 0x98, 0xCD, 0xD2, 0x72, 0xE9, 0xCB, 0xC8, 0xA6, 0x6D, 0x06,
+    0xBE, 0x52, 0x77, 0x60, 0x97, 0xED, 0x2C, 0x5D, 0xF5, 0xB4, 0x14, 0xAF, 0x1C, 0x4C, 0xFF, 0x79,
+    0x20, 0xB5, 0xD9, 0xA0, 0x60, 0xD4, 0x33, 0xCE, 0xE8, 0x9D, 0x89, 0x2F, 0xED, 0x15, 0x6F, 0x8C,
+    0x54, 0x06, 0xCF, 0x15, 0xA0, 0x6F, 0x01, 0x7D, 0x0F, 0xE8, 0xED, 0xFE, 0x65, 0x5C, 0x53, 0x5B,
+    0xBA, 0xBE, 0xE4, 0x25, 0xF8, 0x0F, 0x7D, 0x94, 0x5C, 0x41, 0xCE, 0xE0, 0x1D, 0x2C, 0xA3, 0xE6,
+    0x75, 0xC8, 0xAB, 0x18, 0xA4, 0xE1, 0x4C, 0x64, 0xA4, 0x6F, 0x88, 0x4E, 0xA9, 0xC0, 0x97, 0x2D,
+    0x62, 0xEF, 0xE7, 0x2F, 0x7D, 0x55, 0xBF, 0x93, 0xD7, 0x44, 0x14, 0x7F, 0x49, 0x8E, 0x6F, 0x1C,
+    0x52, 0x2C, 0x85, 0x14, 0x8A, 0x43, 0x7A, 0x9B, 0xFC, 0x03, 0x77, 0x6E, 0x90, 0xA1, 0xB2, 0xE0,
+    0x0A, 0xBE, 0x43, 0x61, 0x41, 0xCD, 0x38, 0xCE, 0xFD, 0x05, 0xB0, 0x41, 0x0A, 0x4B, 0x2D, 0xAC,
+    0xAC, 0x2D, 0x98, 0xA3, 0xB0, 0xA1, 0x70, 0x1C, 0xEF, 0x36, 0xDC, 0x95, 0x16, 0x44, 0x6F, 0x1C,
+    0x0A, 0x0B, 0xA2, 0x87, 0x16, 0x5C, 0xC1, 0xC2, 0xE5, 0xBC, 0xC0, 0xED, 0xEE, 0xF3, 0xF3, 0xF2,
+    0x85, 0x01, 0x04, 0xC9, 0xE4, 0x4D, 0x36, 0xBB, 0x6F, 0x7F, 0x7C, 0x3E, 0xEF, 0xF3, 0xDE, 0x12,
+    0x11, 0x71, 0x11, 0x89, 0x35, 0xB7, 0xCC, 0xEC, 0xF8, 0xC0, 0x0C, 0xDC, 0xAA, 0x91, 0xDB, 0xC2,
+    0x73, 0x23, 0x96, 0x3F, 0x33, 0xB4, 0xA5, 0x4F, 0xC6, 0xC4, 0x47, 0x7C, 0x2D, 0xE6, 0x9C, 0xC7,
+    0xDC, 0x66, 0x15, 0x46, 0x6F, 0x34, 0x79, 0x12, 0xFE, 0x25, 0x14, 0xFC, 0x34, 0x94, 0xCC, 0x41,
+    0x3F, 0x59, 0x0B, 0xBA, 0x2F, 0x82, 0x69, 0xB3, 0x60, 0xFF, 0x63, 0xD2, 0xA7, 0xFB, 0x3C, 0xE8,
+    0xB1, 0x9C, 0x7C, 0x0B, 0x3E, 0x0C, 0x29, 0xEF, 0x04, 0x5A, 0xCA, 0x02, 0xD1, 0xFF, 0xDA, 0x58,
+    0x3D, 0x7C, 0xCC, 0xF6, 0x61, 0x60, 0x3E, 0xE4, 0x4E, 0x79, 0xD2, 0x3D, 0x76, 0xCE, 0x22, 0xA9,
+    0xF1, 0xB5, 0xE6, 0x74, 0x1A, 0x1B, 0x3F, 0x66, 0x7E, 0xC4, 0x3C, 0xDA, 0xE6, 0x83, 0xAA, 0xA7,
+    0x82, 0x6B, 0xE2, 0x40, 0x25, 0x0F, 0x64, 0xB9, 0x49, 0xD9, 0x51, 0x8E, 0x55, 0xF9, 0x73, 0x32,
+    0xBF, 0x33, 0x3F, 0x66, 0x1E, 0x0C, 0xF7, 0x74, 0x12, 0x13, 0xDF, 0x25, 0xF2, 0x94, 0x78, 0x4A,
+    0x3D, 0xE6, 0x44, 0xCD, 0xD1, 0x70, 0x3C, 0x15, 0x2E, 0xE4, 0x9E, 0x5E, 0x7F, 0x33, 0xBC, 0x7C,
+    0x2E, 0xE3, 0x98, 0x70, 0x24, 0x13, 0x29, 0xA9, 0xB9, 0x2E, 0x8E, 0x02, 0x55, 0xD3, 0x2E, 0x5D,
+    0xCA, 0xF8, 0xE5, 0x37, 0xFC, 0x8E, 0x04, 0x5E, 0x73, 0xB6, 0x7F, 0x59, 0xC0, 0x91, 0xDD, 0xCD,
+    0x16, 0x3B, 0x4B, 0x27, 0x26, 0x32, 0xF9, 0x92, 0x23, 0xB3, 0x0D, 0xB7, 0xDE, 0x36, 0x6A, 0x28,
+    0x5D, 0xEE, 0xB3, 0x90, 0x46, 0xB2, 0x0D, 0x93, 0x72, 0x42, 0x5E, 0xD5, 0x91, 0xF9, 0xCA, 0x91,
+    0x3A, 0x1C, 0x29, 0x8D, 0x00, 0x61, 0x98, 0x48, 0x61, 0x62, 0xCA, 0x2D, 0x91, 0x76, 0xF0, 0x04,
+    0x3D, 0xF6, 0x92, 0xCB, 0xB8, 0xD6, 0x3B, 0x3E, 0xE5, 0x5E, 0x39, 0x4C, 0xF6, 0xF9, 0x58, 0x3A,
+    0x6D, 0xB2, 0x90, 0xF9, 0xF2, 0x4E, 0xCB, 0xC4, 0x9F, 0xEC, 0x0E, 0xA6, 0xAD, 0x76, 0x87, 0xCD,
+    0xAA, 0xCF, 0x3D, 0xFA, 0x06, 0xA8, 0x23, 0xDB, 0x07, 0xB1, 0xF7, 0xDA, 0x10, 0x29, 0x3F, 0xEA,
+    0x2B, 0x0B, 0xCA, 0x86, 0x1C, 0xAB, 0x6A, 0x4F, 0x20, 0xAC, 0x60, 0xD2, 0x23, 0xC2, 0x0C, 0x8D,
+    0x90, 0xE9, 0x53, 0x2E, 0x3C, 0xDA, 0xD0, 0x46, 0x5B, 0x0E, 0xB6, 0x4D, 0xD9, 0xF4, 0xA4, 0x85,
+    0x56, 0x18, 0xD9, 0x11, 0x27, 0x89, 0x04, 0xA8, 0x1D, 0x8E, 0xE6, 0x49, 0x4D, 0xCA, 0x2A, 0x87,
+    0x2C, 0xA6, 0x9C, 0x61, 0x99, 0x3F, 0xC1, 0x44, 0x78, 0x19, 0xAB, 0xB3, 0xAD, 0x1A, 0xD4, 0x73,
+    0xAC, 0xA6, 0x5D, 0x60, 0x4D, 0x05, 0xAB, 0x7E, 0x86, 0x35, 0x11, 0xAC, 0x1A, 0x58, 0x8B, 0x49,
+    0x75, 0x0B, 0xAC, 0xA4, 0x06, 0x92, 0x48, 0x10, 0xC2, 0x4F, 0x37, 0x59, 0x1C, 0x9A, 0x89, 0x8C,
+    0x2C, 0xD6, 0xB2, 0x3D, 0x6F, 0x31, 0x7B, 0x7C, 0x6E, 0xCF, 0x2F, 0x21, 0xA4, 0x18, 0x37, 0x9D,
+    0xC8, 0x04, 0x67, 0x20, 0xDB, 0x52, 0x39, 0x4C, 0xF3, 0xA4, 0xF5, 0x64, 0x7E, 0x56, 0x74, 0xCB,
+    0xBC, 0x83, 0x0F, 0xCD, 0x40, 0x46, 0x07, 0xC9, 0x68, 0x7C, 0x25, 0xCA, 0xCA, 0x91, 0x6E, 0x17,
+    0xCD, 0xAA, 0x2F, 0x99, 0x2C, 0xE0, 0x77, 0x33, 0x80, 0xB3, 0xED, 0x6B, 0x0E, 0x2A, 0x52, 0x15,
+    0x08, 0x33, 0x67, 0x0D, 0x6D, 0xBE, 0xE5, 0xB9, 0xFC, 0x23, 0x8E, 0xD1, 0x28, 0xA6, 0x53, 0x81,
+    0x8A, 0x81, 0x4A, 0x44, 0xB5, 0x4E, 0x02, 0xE5, 0x68, 0x82, 0x49, 0x2C, 0xED, 0x69, 0xCD, 0x21,
+    0xA6, 0x1A, 0xEA, 0x9A, 0x7A, 0x5F, 0x38, 0x54, 0xD3, 0xD9, 0x10, 0x94, 0x2E, 0xFD, 0x86, 0x68,
+    0xF6, 0x1D, 0x82, 0x12, 0x93, 0x7B, 0x90, 0xD2, 0xD5, 0xCF, 0x38, 0x34, 0x09, 0xCE, 0x85, 0xA7,
+    0xBC, 0x1E, 0xCC, 0x6E, 0x28, 0xC1, 0x55, 0x72, 0xA3, 0xDA, 0xF2, 0x7A, 0x7B, 0xF1, 0x06, 0xBD,
+    0x13, 0xF4, 0xDD, 0x68, 0xFE, 0xB8, 0x20, 0x4E, 0x59, 0x4F, 0x04, 0x6A, 0xED, 0xFD, 0x9C, 0xF9,
+    0x4B, 0x01, 0xBF, 0xF7, 0x88, 0x9B, 0x25, 0xA0, 0x42, 0x22, 0x09, 0x4F, 0x61, 0x92, 0x24, 0x7E,
+    0x10, 0xF3, 0x84, 0xDB, 0xF7, 0x40, 0x10, 0x78, 0xEA, 0x2A, 0x04, 0xD9, 0xAC, 0x92, 0x6A, 0xA6,
+    0x05, 0x56, 0x17, 0x05, 0xA0, 0xE4, 0xAF, 0x21, 0xF3, 0x21, 0x81, 0xB6, 0x33, 0xFE, 0xB6, 0x97,
+    0xB9, 0x12, 0x99, 0xE7, 0xF6, 0x69, 0x98, 0x43, 0xF6, 0x5C, 0x8B, 0x7D, 0x1F, 0xD7, 0xEB, 0x97,
+    0xC7, 0x0A, 0xE8, 0xA5, 0x14, 0xDD, 0x3C, 0x58, 0xBF, 0x81, 0x71, 0xFF, 0xDC, 0xDE, 0xA1, 0xF4,
+    0xEC, 0x3F, 0x61, 0x03, 0xBB, 0xF6, 0xC8, 0x64, 0xD5, 0x9B, 0x33, 0x3E, 0x19, 0xCB, 0x46, 0xDD,
+    0x1E, 0xC9, 0xAB, 0x4E, 0x37, 0xFC, 0x70, 0x40, 0x70, 0xB7, 0x99, 0xE3, 0xE9, 0x63, 0x99, 0xE4,
+    0xBD, 0x85, 0xA6, 0xCE, 0x23, 0x05, 0xB6, 0x22, 0x28, 0xD4, 0x6D, 0xE9, 0x8A, 0x01, 0x0A, 0x61,
+    0xEC, 0x51, 0xFD, 0x1A, 0x10, 0x1D, 0x89, 0x3B, 0x2A, 0x81, 0x82, 0x7C, 0x32, 0xD0, 0x84, 0xFA,
+    0xD3, 0x02, 0xB9, 0xA3, 0x8B, 0x11, 0x74, 0x40, 0xEF, 0xC7, 0xED, 0xD3, 0x66, 0xEA, 0xC0, 0x76,
+    0x53, 0x07, 0xB8, 0x26, 0x09, 0x0F, 0xBD, 0x1C, 0xCB, 0xCB, 0x13, 0xDE, 0x57, 0x3A, 0x4E, 0x42,
+    0xF8, 0x63, 0x09, 0x05, 0xFD, 0xE6, 0x0D, 0x2D, 0xE9, 0x89, 0x33, 0xC5, 0xB5, 0x62, 0x57, 0xDD,
+    0xF3, 0x3A, 0x09, 0x86, 0x36, 0x75, 0xBD, 0xA9, 0xFB, 0x88, 0x74, 0x48, 0x51, 0x0F, 0x2A, 0xC8,
+    0x11, 0xD2, 0x8B, 0xAB, 0x14, 0xAF, 0x5E, 0x0C, 0x86, 0x47, 0x49, 0x95, 0x0B, 0x54, 0x25, 0x07,
+    0x11, 0x62, 0xD7, 0x3F, 0x37, 0x57, 0x16, 0xA4, 0x42, 0xC3, 0xC0, 0x55, 0x45, 0x91, 0xB5, 0x08,
+    0x40, 0xF8, 0xDE, 0xA0, 0x1F, 0x66, 0xFC, 0x85, 0x2B, 0x13, 0xF6, 0xC5, 0xF5, 0xEE, 0x6A, 0x52,
+    0x2F, 0x2F, 0xAB, 0x96, 0xD2, 0xBB, 0x0D, 0x8E, 0x79, 0xFA, 0x56, 0x89, 0x80, 0x1F, 0x9D, 0x91,
+    0xD4, 0x98, 0x9A, 0x87, 0x53, 0xEF, 0x32, 0x42, 0x95, 0xEE, 0xB4, 0x58, 0x74, 0xB9, 0xCA, 0x30,
+    0xAD, 0x1D, 0x0A, 0xBE, 0xE6, 0xF2, 0x3E, 0xA1, 0x2B, 0x22, 0xAC, 0x0A, 0xE7, 0x7D, 0x60, 0x81,
+    0x74, 0x6D, 0xD2, 0xCE, 0xB1, 0xC5, 0xD6, 0x76, 0x28, 0xB9, 0xBB, 0xBF, 0x49, 0x99, 0xB3, 0xAC,
+    0xF7, 0xF6, 0x9D, 0xD6, 0xC5, 0x3E, 0x73, 0x79, 0xE0, 0x50, 0x23, 0x4F, 0x50, 0x4D, 0x9B, 0xC9,
+    0x98, 0x30, 0x0A, 0x4A, 0x50, 0xA3, 0x1A, 0x2B, 0xA7, 0x91, 0xC4, 0xF6, 0x36, 0x92, 0x03, 0x26,
+    0x6D, 0x35, 0x6A, 0x27, 0x63, 0xE2, 0x23, 0xBE, 0x32, 0xC7, 0x4A, 0xF9, 0x66, 0x16, 0xAD, 0x9E,
+    0x9B, 0xCF, 0xA1, 0x90, 0x14, 0xA7, 0x2B, 0xB0, 0x67, 0x55, 0x0B, 0x2E, 0x4A, 0x56, 0x3F, 0x5C,
+    0x3F, 0x0F, 0x19, 0x0E, 0x48, 0xC2, 0xB7, 0xE1, 0xD7, 0x21, 0x75, 0x65, 0xC6, 0x23, 0xF0, 0xAF,
+    0x14, 0xDD, 0xF2, 0x72, 0xD6, 0xAD, 0x00, 0xFF, 0x4A, 0xD6, 0x9D, 0xBE, 0x95, 0x75, 0x3F, 0x25,
+    0x47, 0xB5, 0x06, 0xF7, 0xB7, 0x10, 0x62, 0xE0, 0x5F, 0xA9, 0x80, 0x3F, 0xEB, 0x46, 0xE0, 0x5F,
+    0xC9, 0x5B, 0xE0, 0xEF, 0x3E, 0x02, 0xFE, 0x95, 0xE4, 0x00, 0xF8, 0xE9, 0x6D, 0xF8, 0x51, 0x4C,
+    0xE4, 0x06, 0x58, 0x98, 0x08, 0x7C, 0x4C, 0xD9, 0x97, 0x7B, 0xE3, 0x46, 0xB6, 0xEF, 0x8A, 0x3B,
+    0x6D, 0x55, 0x5D, 0xF3, 0x9A, 0x3B, 0xD4, 0xFD, 0xF7, 0x9B, 0xC5, 0x1C, 0x4D, 0x72, 0x79, 0x80,
+    0x2F, 0x90, 0x2F, 0xF5, 0x89, 0x8E, 0xDF, 0x8C, 0xEB, 0x06, 0x05, 0x05, 0x70, 0x0F, 0xE6, 0x76,
+    0x5E, 0xBF, 0x3A, 0x3A, 0x39, 0xCB, 0xCD, 0xFC, 0x82, 0x94, 0x7A, 0x86, 0x0A, 0x29, 0xAB, 0x76,
+    0xB8, 0xCE, 0x7A, 0x5C, 0x43, 0xBA, 0x51, 0x7D, 0x3E, 0x26, 0x90, 0x33, 0x83, 0x7B, 0x14, 0xD8,
+    0x19, 0x6E, 0x62, 0x4E, 0x9F, 0xC6, 0x04, 0x83, 0x79, 0x7F, 0x9C, 0xA5, 0xD2, 0xDC, 0x1C, 0x65,
+    0x55, 0xB5, 0xFD, 0x37, 0x2B, 0x46, 0x42, 0xD4, 0xB2, 0x28, 0x92, 0xAD, 0xE5, 0xC6, 0x36, 0xA6,
+    0xC6, 0xAD, 0xF6, 0x2F, 0xC5, 0x55, 0xB1, 0x8E, 0x1D, 0x35, 0x14, 0xBD, 0x6F, 0xBC, 0xCB, 0x48,
+    0x4C, 0xE1, 0x14, 0x40, 0xB3, 0x12, 0x53, 0x83, 0x84, 0xFC, 0x07, 0xCF, 0x13, 0x21, 0x94, 0x72,
+    0xB7, 0x00, 0x1A, 0x8A, 0x34, 0x14, 0x50, 0xE5, 0x0B, 0x88, 0x27, 0xE4, 0x03, 0x92, 0x3F, 0x48,
+    0x4A, 0xB4, 0x29, 0xD2, 0x52, 0xB0, 0x6F, 0x26, 0xDA, 0x82, 0x82, 0xE6, 0x49, 0xFB, 0x01, 0x8C,
+    0x14, 0x29, 0x2B, 0x6D, 0x93, 0x41, 0x4C, 0xA4, 0x61, 0xE3, 0xF1, 0xE5, 0x1C, 0xBF, 0x6C, 0x04,
+    0x28, 0x05, 0xDD, 0x5A, 0xB2, 0x35, 0x77, 0x6C, 0xDF, 0x73, 0x7C, 0xEE, 0xBD, 0xB6, 0x36, 0xA5,
+    0x26, 0x71, 0x3A, 0x4B, 0xA7, 0x43, 0xA1, 0xDA, 0x56, 0xEF, 0x36, 0x55, 0xC7, 0x52, 0xF5, 0x55,
+    0xD0, 0x5D, 0x0B, 0xFA, 0x72, 0xEA, 0xF4, 0x0B, 0x31, 0x49, 0xC4, 0xCE, 0x22, 0x7E, 0x10, 0xD1,
+    0xF6, 0xAD, 0x99, 0xDB, 0x4A, 0x35, 0x55, 0xE8, 0x4E, 0x97, 0xBB, 0x5E, 0xE7, 0x35, 0x7B, 0x78,
+    0x47, 0xE7, 0x7F, 0x40, 0xAC, 0x2D, 0x7A, 0x81, 0x2E, 0x7B, 0x3F, 0xAF, 0x45, 0xFE, 0x6F, 0xFF,
+    0xF6, 0x93, 0x7D, 0xB3, 0x84, 0xF3, 0xE4, 0xFB, 0xA3, 0xAA, 0xB7, 0x43, 0x19, 0x25, 0x7E, 0x1D,
+    0xC3, 0x1C, 0xB6, 0xF2, 0xA9, 0xF8, 0x3E, 0x8C, 0x5D, 0x74, 0xA1, 0xB0, 0xBD, 0x19, 0x25, 0x8A,
+    0x97, 0xB7, 0x1F, 0x68, 0x15, 0x4E, 0xB5, 0x54, 0x2F, 0xA2, 0x2F, 0xA6, 0xB9, 0x3A, 0x1B, 0xEA,
+    0xC3, 0xFE, 0xC4, 0xDF, 0x1A, 0xBD, 0xB6, 0x61, 0x92, 0x3D, 0xD9, 0x47, 0x77, 0x72, 0x22, 0xDD,
+    0x33, 0x6D, 0xDC, 0x18, 0x7A, 0x3B, 0xBB, 0xD1, 0x2C, 0x76, 0x5E, 0xE9, 0xE7, 0x89, 0x9D, 0xDF,
+    0xFC, 0xC7, 0xB9, 0xBC, 0x06, 0x6B, 0xB9, 0x47, 0xEE, 0x0A, 0x00, 0x8A, 0x24, 0x45, 0x14, 0x9B,
+    0x04, 0x70, 0x3E, 0x49, 0x35, 0xC8, 0x67, 0x1B, 0xA9, 0x7B, 0x91, 0x8D, 0xF8, 0x96, 0x63, 0x10,
+    0x8E, 0x0B, 0xC7, 0x22, 0x16, 0x8F, 0x65, 0x63, 0x26, 0x3B, 0xCA, 0xA6, 0x82, 0x3F, 0xD9, 0xD8,
+    0xDE, 0x8F, 0xF2, 0xBD, 0x6B, 0x5F, 0x8F, 0x22, 0xA1, 0xF8, 0x13, 0x63, 0x32, 0x67, 0xA3, 0xAC,
+    0xA2, 0xBD, 0x3F, 0x8A, 0x99, 0xDC, 0x93, 0x4B, 0xC1, 0x42, 0x55, 0xB1, 0x5B, 0x8E, 0xAE, 0xCF,
+    0x30, 0xC2, 0x31, 0xA3, 0x4B, 0xD7, 0x4A, 0x87, 0x80, 0x0C, 0xFC, 0x89, 0xE0, 0xB9, 0xF6, 0x0A,
+    0xDE, 0xB5, 0x16, 0x91, 0xAA, 0x86, 0x12, 0x3E, 0x8B, 0xD9, 0x4C, 0x3B, 0xFC, 0x83, 0xC7, 0x98,
+    0x58, 0x82, 0x36, 0xD5, 0xD0, 0x39, 0x1D, 0x8B, 0xD9, 0x17, 0x3F, 0x46, 0x12, 0x20, 0x4D, 0x6C,
+    0x03, 0x65, 0x6C, 0x03, 0x0C, 0xB6, 0xB9, 0x2D, 0x18, 0x70, 0xC4, 0xF9, 0xF0, 0x07, 0x47, 0x70,
+    0x3A, 0x01, 0xCD, 0xEA, 0x02, 0x34, 0xA3, 0xDA, 0xEC, 0xA2, 0x7F, 0xB0, 0x70, 0x0E, 0x3E, 0xB1,
+    0x6E, 0x7D, 0x87, 0xB2, 0x43, 0x7C, 0xE8, 0x20, 0x75, 0x0B, 0x8F, 0x55, 0xCA, 0x4E, 0x17, 0x02,
+    0xEC, 0x87, 0x96, 0x3A, 0xD8, 0x67, 0xF1, 0xFD, 0x87, 0x8D, 0x3D, 0x9B, 0xEA, 0x61, 0xD3, 0xFD,
+    0x36, 0xFA, 0xA1, 0xD3, 0xC3, 0xAD, 0x0E, 0x07, 0xB3, 0xBB, 0xF7, 0x1A, 0xDB, 0x82, 0xF9, 0x1D,
+    0x63, 0xB2, 0x0F, 0x06, 0xE8, 0x50, 0x83, 0x8E, 0x99, 0xFC, 0xD3, 0x19, 0x8C, 0x3C, 0x80, 0xED,
+    0x96, 0x23, 0xE8, 0xE0, 0xBF, 0x6F, 0x38, 0xB2, 0x21, 0x19, 0xDD, 0x24, 0x05, 0x18, 0xD5, 0x40,
+    0xFF, 0x4E, 0xAE, 0x5A, 0x35, 0xEE, 0xE6, 0x06, 0xA9, 0x22, 0x18, 0x37, 0xA2, 0x5B, 0x81, 0xE0,
+    0x06, 0xC2, 0x05, 0x9C, 0x31, 0xCA, 0x0D, 0xFF, 0xEA, 0xCE, 0xA9, 0xEA, 0x62, 0x55, 0x21, 0xF0,
+    0x36, 0x6F, 0xDA, 0x3F, 0xC2, 0x60, 0x94, 0x9F, 0x08, 0x11, 0xB2, 0x3B, 0xF1, 0x73, 0x87, 0xF4,
+    0xE5, 0x95, 0x67, 0xAB, 0x79, 0x11, 0x76, 0x20, 0x91, 0xF1, 0xA9, 0xB4, 0xFD, 0x4B, 0xD8, 0xEE,
+    0x1C, 0xB6, 0x9D, 0x60, 0x97, 0xD1, 0x43, 0xBC, 0x04, 0x18, 0xD1, 0x46, 0x09, 0x09, 0xDB, 0x8D,
+    0x15, 0xD3, 0xE5, 0x89, 0x0A, 0xAA, 0x2C, 0x57, 0x9E, 0x46, 0x61, 0xA1, 0x09, 0x12, 0xD9, 0x0F,
+    0x60, 0x67, 0x23, 0x0A, 0x6B, 0xA5, 0xB7, 0x20, 0x95, 0x7F, 0x8E, 0x6D, 0x16, 0xFB, 0x57, 0x5F,
+    0x89, 0xE4, 0xF3, 0x61, 0x82, 0xB2, 0xEB, 0x9B, 0x53, 0x8B, 0x7C, 0x28, 0xD7, 0x44, 0x89, 0x8C,
+    0xA4, 0xA3, 0x40, 0x1D, 0x89, 0x84, 0xDB, 0x0C, 0xDD, 0xCD, 0x44, 0x46, 0xFB, 0xCD, 0xF5, 0x50,
+    0x62, 0x2B, 0x16, 0xD3, 0x03, 0x0D, 0x05, 0x85, 0x5B, 0x09, 0x59, 0xFF, 0x4B, 0x0D, 0xA0, 0x3D,
+    0xB9, 0x71, 0x3D, 0x2A, 0xD5, 0x0D, 0x7D, 0x8E, 0x28, 0x51, 0x13, 0x59, 0x43, 0x3F, 0x98, 0xAD,
+    0xFC, 0xB3, 0xF9, 0x98, 0x29, 0x41, 0xAF, 0x0A, 0x35, 0x0C, 0x5E, 0xB4, 0xB5, 0x83, 0xDD, 0x3D,
+    0x82, 0xED, 0xCF, 0x60, 0xD7, 0x23, 0xE6, 0xAB, 0x19, 0x99, 0x6D, 0x16, 0x64, 0xEE, 0x4A, 0x41,
+    0x4A, 0xBA, 0x1E, 0xB9, 0xE9, 0x2F, 0x9F, 0x02, 0x42, 0xF3, 0xE5, 0x8D, 0x6B, 0xDB, 0x90, 0x12,
+    0xF3, 0x43, 0x5B, 0x45, 0x29, 0xA3, 0xB0, 0xA4, 0x5C, 0x6A, 0x68, 0xA0, 0x0F, 0xE0, 0x06, 0x04,
+    0xE5, 0x83, 0x1C, 0x33, 0x66, 0xF2, 0xFA, 0x04, 0xC3, 0xC7, 0x15, 0x6E, 0xA8, 0xF2, 0x94, 0x36,
+    0xA5, 0x12, 0xCF, 0xEA, 0x74, 0xB8, 0xDD, 0x41, 0x09, 0xAB, 0x4D, 0x82, 0x5D, 0xA4, 0x00, 0x5B,
+    0x0F, 0x79, 0x41, 0x9D, 0x2E, 0xAC, 0x25, 0x54, 0x8E, 0xE5, 0x15, 0x56, 0x46, 0xB3, 0x40, 0x44,
+    0x50, 0x11, 0xBD, 0x40, 0x22, 0xE0, 0xC5, 0xE0, 0x0B, 0xA2, 0xDA, 0x5B, 0xB2, 0x29, 0x17, 0x38,
+    0x60, 0x19, 0x69, 0x0F, 0x8F, 0xF5, 0x04, 0x95, 0x4C, 0x22, 0x09, 0xE5, 0xED, 0xC4, 0x15, 0x8C,
+    0x10, 0x56, 0x4B, 0x95, 0x55, 0x14, 0x9F, 0x15, 0x2D, 0x12, 0x4B, 0x18, 0x9A, 0x01, 0x06, 0x5C,
+    0xEF, 0xE5, 0x70, 0x2D, 0x0C, 0x05, 0x84, 0xA8, 0x2F, 0x8F, 0x1F, 0xE2, 0xF4, 0x40, 0x6A, 0xCB,
+    0xB8, 0xCA, 0x78, 0x03, 0xA2, 0x31, 0xEF, 0x08, 0x64, 0x47, 0xFD, 0xCE, 0x11, 0xC3, 0x4B, 0x77,
+    0xA0, 0x9A, 0xEF, 0x04, 0x78, 0x0B, 0x17, 0xC7, 0xF7, 0x53, 0xC6, 0xC4, 0x0F, 0xEC, 0x8A, 0xA4,
+    0x45, 0x1A, 0xF9, 0x09, 0xEB, 0x52, 0x43, 0x4F, 0xE8, 0x4B, 0xA9, 0x17, 0x6A, 0xB4, 0x5D, 0xDD,
+    0xA4, 0x12, 0xD9, 0xE1, 0x90, 0xFD, 0x40, 0x4D, 0xD6, 0x1F, 0x93, 0x1D, 0x51, 0xA4, 0xB0, 0x7C,
+    0x05, 0x77, 0xE7, 0xA1, 0x01, 0xE5, 0x9B, 0x2E, 0x7D, 0x33, 0x5A, 0x02, 0x77, 0xE0, 0xF0, 0x1E,
+    0xEF, 0xC8, 0x0A, 0x6B, 0x0D, 0x33, 0x8D, 0x07, 0xE2, 0xE5, 0xF8, 0x11, 0x63, 0x9A, 0x76, 0xDE,
+    0x70, 0xD7, 0x50, 0x22, 0x00, 0xE0, 0x1D, 0x91, 0x1A, 0x4B, 0x8F, 0xDE, 0xBC, 0xA7, 0x38, 0xE3,
+    0x23, 0xD5, 0x73, 0xBC, 0xC4, 0x39, 0x01, 0x79, 0x88, 0x92, 0xC1, 0x3F, 0xFE, 0x09, 0x33, 0xA0,
+    0xFD, 0xAB, 0xEA, 0x1F, 0xFF, 0x9E, 0x11, 0x9E, 0xF0, 0x76, 0xDE, 0xF3, 0x17, 0xA5, 0xF9, 0x4F,
+    0xFB, 0x1B, 0xC5, 0x55, 0xBB, 0x6E, 0xD5, 0x40, 0x14, 0x3C, 0xB6, 0x75, 0x65, 0x09, 0x17, 0xA6,
+    0x20, 0xF5, 0xFD, 0x00, 0x50, 0xFC, 0x05, 0x68, 0xB7, 0x4F, 0x01, 0x45, 0x52, 0x51, 0xE4, 0x13,
+    0xF8, 0x01, 0xC4, 0x5A, 0x50, 0x52, 0x40, 0x4F, 0x81, 0x90, 0x28, 0x20, 0x0D, 0x3F, 0x00, 0xD8,
+    0x40, 0x41, 0x41, 0x81, 0x45, 0x0A, 0x5A, 0x17, 0x88, 0x48, 0x50, 0xE0, 0x08, 0x83, 0x4C, 0x64,
+    0xEF, 0x30, 0x67, 0xAF, 0x93, 0x00, 0x12, 0x48, 0x08, 0x44, 0xB6, 0x18, 0x79, 0xEF, 0xD9, 0x33,
+    0x3B, 0x7B, 0x5E, 0x57, 0xA2, 0x2D, 0x89, 0x61, 0x23, 0x58, 0x81, 0x88, 0x17, 0x59, 0x13, 0xAE,
+    0x08, 0xF0, 0x0E, 0xB8, 0x03, 0xEC, 0x01, 0x9F, 0x69, 0x70, 0xB5, 0x2C, 0x3B, 0x49, 0x47, 0x5A,
+    0x76, 0xEE, 0xD3, 0xB2, 0x04, 0x5E, 0x00, 0xFB, 0x3F, 0x5A, 0xB8, 0x79, 0xBF, 0xB3, 0x1D, 0x7C,
+    0xBE, 0x92, 0x40, 0xD6, 0xAC, 0x98, 0x5E, 0x0C, 0xAC, 0x79, 0xD9, 0x15, 0x75, 0xB5, 0xB0, 0x91,
+    0xFD, 0x47, 0xD4, 0x59, 0xFD, 0x38, 0x1D, 0xCC, 0xD3, 0x29, 0xEF, 0xD6, 0xA3, 0x4E, 0xC2, 0x4A,
+    0x57, 0x96, 0x15, 0xF5, 0x9B, 0xD9, 0x67, 0x45, 0xE0, 0x77, 0xEE, 0x02, 0xE3, 0x4C, 0xFD, 0x83,
+    0x25, 0x5C, 0xFA, 0xE0, 0x48, 0xCE, 0x40, 0xC5, 0xA8, 0x05, 0xA5, 0x54, 0x56, 0x9C, 0x95, 0x33,
+    0xE4, 0xCD, 0x31, 0x19, 0xF4, 0x40, 0xE3, 0x06, 0xA9, 0xEA, 0x18, 0x92, 0x8D, 0x52, 0x74, 0xBF,
+    0xFC, 0x4C, 0x60, 0x81, 0x5D, 0xE0, 0x02, 0x26, 0x59, 0x6C, 0x4A, 0xD5, 0xF0, 0x0E, 0x53, 0x27,
+    0x83, 0x2C, 0xE4, 0xEF, 0xC8, 0xB6, 0xE6, 0x60, 0x8A, 0x79, 0xD5, 0x99, 0x72, 0x0E, 0x26, 0xF7,
+    0x3D, 0x39, 0x13, 0xC0, 0x2E, 0x3D, 0xF3, 0x28, 0x74, 0x52, 0x57, 0x12, 0xFC, 0x7E, 0x83, 0x46,
+    0x7D, 0x28, 0x84, 0x04, 0xEB, 0xF1, 0xFE, 0x94, 0xEF, 0xF5, 0xE6, 0x46, 0x79, 0x25, 0x44, 0x32,
+    0x09, 0x17, 0xD2, 0x40, 0xCA, 0xDF, 0x88, 0x3B, 0xFA, 0x0C, 0x24, 0x41, 0xA7, 0x4D, 0xE1, 0x4B,
+    0xCD, 0xC4, 0xA4, 0x80, 0x52, 0xA1, 0x65, 0x00, 0xAA, 0x9E, 0xB0, 0x1C, 0x09, 0xD9, 0x44, 0x48,
+    0x3D, 0x1D, 0x13, 0xA6, 0x6A, 0x4C, 0x70, 0x04, 0xFE, 0xAC, 0xBF, 0x97, 0x78, 0xB5, 0xEA, 0x91,
+    0x6C, 0x3C, 0xF4, 0xA0, 0xAF, 0x7F, 0x48, 0x96, 0x99, 0x2F, 0x30, 0xDF, 0x5A, 0xA5, 0x5C, 0xF2,
+    0xB6, 0x60, 0x08, 0xFC, 0x13, 0x3E, 0x0E, 0xA3, 0xC8, 0xB0, 0xEC, 0x45, 0x2E, 0x86, 0xB8, 0x70,
+    0xB9, 0x5E, 0xE2, 0xD1, 0xF1, 0xA2, 0xD1, 0x79, 0x05, 0x04, 0x28, 0x15, 0x1A, 0x82, 0xEB, 0x08,
+    0xDB, 0x3D, 0x61, 0x63, 0x24, 0x5C, 0xF7, 0x84, 0x6B, 0x20, 0x94, 0x78, 0x4E, 0x70, 0xBB, 0x04,
+    0xF3, 0x89, 0xB0, 0xFC, 0x42, 0xC8, 0x58, 0x3F, 0x65, 0xA2, 0x10, 0x2B, 0x48, 0x00, 0xA7, 0x60,
+    0x46, 0xCD, 0xB3, 0xD6, 0x75, 0x49, 0x54, 0x05, 0xA2, 0x9D, 0x24, 0x92, 0x85, 0xC2, 0xDC, 0x9C,
+    0xA5, 0x4A, 0x81, 0x56, 0x65, 0x6A, 0x6D, 0xB1, 0x18, 0xA5, 0xE2, 0xA3, 0x4A, 0x26, 0xD4, 0x75,
+    0xC5, 0xC0, 0x80, 0xE4, 0x94, 0x8F, 0xE7, 0x6C, 0xBF, 0x62, 0x9F, 0x9D, 0x98, 0x4E, 0xAE, 0x21,
+    0xE1, 0x36, 0xC9, 0xDC, 0x9B, 0x89, 0xAC, 0x9F, 0xC3, 0x8F, 0xA6, 0x65, 0xEE, 0xC2, 0xC9, 0x67,
+    0xDC, 0xBB, 0x36, 0xB8, 0x67, 0x78, 0x87, 0x41, 0xA0, 0x9C, 0x19, 0x2B, 0x58, 0xE4, 0x32, 0xDE,
+    0xCA, 0xDC, 0xC6, 0x22, 0x5B, 0x41, 0x4E, 0xAD, 0xA0, 0xF2, 0x2A, 0x05, 0x67, 0x8F, 0xED, 0x27,
+    0x25, 0x6C, 0xCB, 0xAE, 0x32, 0xA4, 0x15, 0xAC, 0xF0, 0x8A, 0xC1, 0x62, 0x55, 0x8B, 0x2C, 0xEC,
+    0xC2, 0x9E, 0x68, 0xC4, 0x34, 0x95, 0x3E, 0x6E, 0x49, 0x76, 0x40, 0x32, 0x3D, 0x24, 0xE7, 0x59,
+    0xAE, 0xEC, 0xDF, 0xD3, 0x27, 0x19, 0xB1, 0xBC, 0x7C, 0xC4, 0x92, 0xEA, 0x59, 0x70, 0xF1, 0x94,
+    0xF3, 0xFA, 0x75, 0x4A, 0xFC, 0x7E, 0x55, 0x54, 0x13, 0xEB, 0xD0, 0x25, 0xA0, 0x8B, 0x71, 0x50,
+    0x79, 0x36, 0x66, 0x84, 0xBA, 0x6A, 0x65, 0x39, 0x98, 0x8E, 0x5D, 0x9D, 0x93, 0xB1, 0x7A, 0x71,
+    0xAC, 0xE1, 0x27, 0x61, 0x3D, 0x19, 0xB2, 0x31, 0x9C, 0xCC, 0x26, 0x2D, 0xE7, 0xE0, 0x5E, 0xE0,
+    0x36, 0xDA, 0x44, 0x39, 0xF9, 0x6C, 0xBE, 0x3B, 0xAA, 0x42, 0xF7, 0x6D, 0x6A, 0x40, 0xE2, 0xA8,
+    0x97, 0x47, 0xA6, 0x29, 0x5A, 0x6C, 0x0C, 0x09, 0xAF, 0xCE, 0xC9, 0xC0, 0x87, 0x65, 0xB0, 0x31,
+    0xFB, 0xB4, 0xBA, 0xD9, 0x17, 0xAD, 0x79, 0x3D, 0xC8, 0x74, 0x4A, 0x92, 0xC3, 0x9C, 0xDE, 0xA2,
+    0x3E, 0x7F, 0x55, 0x9F, 0x07, 0xAB, 0x50, 0x67, 0x78, 0x0F, 0x3A, 0xDB, 0x1C, 0x31, 0xD8, 0x65,
+    0x2D, 0xEA, 0x14, 0xA3, 0x69, 0x93, 0x2F, 0x58, 0xF6, 0xF1, 0x40, 0x65, 0xD1, 0xA8, 0x72, 0x27,
+    0x95, 0xFB, 0x44, 0xE5, 0x3A, 0x71, 0xBB, 0xDE, 0xD8, 0xA2, 0xC3, 0xC7, 0x32, 0x1F, 0x0B, 0x9E,
+    0xF7, 0x09, 0x9A, 0x14, 0x4C, 0xC3, 0x65, 0x94, 0xB9, 0x72, 0xAA, 0xDC, 0x32, 0x3E, 0x80, 0xB7,
+    0x72, 0x2E, 0xBA, 0x78, 0x18, 0x21, 0x6D, 0x05, 0x4D, 0xA4, 0x8E, 0xAC, 0xF0, 0x07, 0x10, 0xFE,
+    0xEE, 0x64, 0x3E, 0x90, 0x0E, 0x0C, 0x2C, 0x47, 0xA4, 0xF9, 0xA0, 0xA3, 0xE9, 0x8F, 0x3F, 0xF6,
+    0xC2, 0x40, 0x6B, 0xA8, 0x0D, 0x42, 0x55, 0xFE, 0x12, 0xC3, 0xC7, 0x98, 0x25, 0x9A, 0xCB, 0x94,
+    0xC1, 0xE0, 0x5C, 0xD2, 0x5B, 0xD6, 0x88, 0xA9, 0xDE, 0xCA, 0x04, 0x88, 0x69, 0xE6, 0x21, 0x31,
+    0xCF, 0x88, 0xFF, 0x23, 0xE1, 0xA7, 0xF5, 0x0D, 0xAD, 0x55, 0x3D, 0x93, 0xDC, 0x44, 0x10, 0xED,
+    0x95, 0x58, 0x2B, 0x50, 0x15, 0x93, 0x78, 0x23, 0x02, 0xFD, 0x04, 0x25, 0x24, 0x0E, 0x8E, 0x19,
+    0x48, 0x08, 0x7D, 0x01, 0x44, 0x0E, 0xE0, 0x1F, 0xDC, 0x2F, 0xA0, 0x46, 0xE6, 0x02, 0x42, 0xF3,
+    0x23, 0xC8, 0x08, 0x20, 0x74, 0xE0, 0x42, 0x2A, 0x12, 0x42, 0x54, 0xE5, 0xA2, 0x08, 0x2E, 0x38,
+    0x41, 0x99, 0x22, 0xB8, 0xE0, 0x14, 0x4C, 0x79, 0x85, 0x6F, 0x46, 0x8F, 0xD7, 0xD2, 0xFA, 0x2E,
+    0xA1, 0x30, 0x1F, 0xAB, 0xAA, 0x59, 0xCD, 0xB6, 0x66, 0x5E, 0x7F, 0xBD, 0xEE, 0x96, 0xCD, 0x47,
+    0x22, 0x82, 0x41, 0xA4, 0x46, 0x23, 0xE5, 0xCB, 0x24, 0x59, 0x2C, 0x82, 0xEC, 0x64, 0xEB, 0x28,
+    0x97, 0x62, 0x92, 0x2C, 0xB5, 0x9D, 0xD8, 0xAB, 0x28, 0xF9, 0xFC, 0xAF, 0x37, 0xBF, 0xEB, 0xC6,
+    0xF7, 0xE2, 0x9F, 0x43, 0x4C, 0xAC, 0xE7, 0x47, 0x68, 0x00, 0x8C, 0x39, 0x10, 0xA5, 0x40, 0xA2,
+    0x82, 0x53, 0xAE, 0x67, 0x45, 0x2F, 0x66, 0x84, 0xC8, 0x6C, 0x46, 0x29, 0xBA, 0xCF, 0xE4, 0xF6,
+    0xF1, 0x8D, 0xD4, 0x17, 0xFF, 0x49, 0xF3, 0xB2, 0xF1, 0x6A, 0x42, 0x92, 0x22, 0xD9, 0x51, 0xF0,
+    0x3D, 0x7E, 0x6B, 0x27, 0x43, 0xF5, 0x62, 0x81, 0x4E, 0x3C, 0x7A, 0x91, 0xAD, 0x2A, 0xD9, 0x6A,
+    0x04, 0x68, 0xA4, 0xE4, 0x6A, 0x90, 0xED, 0xB8, 0x99, 0x54, 0xEC, 0x56, 0x1B, 0xEA, 0x51, 0xCA,
+    0xE8, 0x07, 0xB1, 0x03, 0xBA, 0x0C, 0x02, 0x67, 0x02, 0x5F, 0x6D, 0x97, 0x27, 0x9E, 0x2F, 0x23,
+    0x3F, 0x9B, 0x00, 0x27, 0xF5, 0x4D, 0xE4, 0x65, 0x02, 0x8B, 0x9F, 0x35, 0xA2, 0xA3, 0xC8, 0x86,
+    0x11, 0x5D, 0x41, 0x4D, 0x50, 0xE4, 0x5E, 0xE5, 0xEE, 0xAF, 0x44, 0x34, 0x74, 0x43, 0xFF, 0x0B,
+    0x42, 0x54, 0xAF, 0xBE, 0xA2, 0x6D, 0x78, 0x9F, 0x86, 0x7E, 0xC8, 0x55, 0x8D, 0x25, 0xDD, 0x30,
+    0x09, 0x52, 0xEF, 0xA3, 0xF8, 0xCB, 0x31, 0x83, 0xEF, 0xEA, 0x3F, 0xF0, 0x0D, 0x7E, 0x00, 0xE6,
+    0x0A, 0xE8, 0x3D, 0x5E, 0xDC, 0xDE, 0xA5, 0x52, 0x42, 0x51, 0x33, 0xB5, 0x54, 0x98, 0x84, 0xEE,
+    0x06, 0x06, 0x1B, 0x9D, 0x0F, 0x55, 0x32, 0x51, 0x7D, 0x68, 0xF2, 0x64, 0x26, 0x9A, 0x8F, 0xA6,
+    0x0E, 0x66, 0x32, 0x49, 0xF0, 0x39, 0x73, 0x33, 0x69, 0x84, 0xCE, 0xD1, 0x98, 0xA9, 0x82, 0x43,
+    0xE3, 0x67, 0x9E, 0xC1, 0x84, 0x66, 0x83, 0x1F, 0x27, 0xC6, 0x8F, 0x8E, 0xD8, 0xCB, 0xE9, 0xD3,
+    0x32, 0xE1, 0x0B, 0x50, 0xE2, 0x11, 0x78, 0x78, 0x4D, 0xDF, 0xE6, 0x63, 0x3A, 0x44, 0xFD, 0x39,
+    0xBD, 0xCE, 0x28, 0xCA, 0xE2, 0x21, 0xAB, 0x22, 0x2D, 0xF1, 0xA8, 0xBB, 0xE6, 0x7A, 0x90, 0x61,
+    0xF5, 0xDB, 0x84, 0x4D, 0x8B, 0x9E, 0x26, 0x3D, 0xC4, 0x55, 0x6A, 0x7B, 0xB3, 0x87, 0x22, 0x6F,
+    0x70, 0x46, 0x03, 0xE9, 0x76, 0x00, 0x2E, 0xFB, 0x76, 0xB2, 0xEE, 0xBE, 0x02, 0xEC, 0xDC, 0x02,
+    0xCD, 0x10, 0x6F, 0x88, 0x5E, 0x31, 0x58, 0xF7, 0xE5, 0x28, 0xC8, 0xDB, 0xD3, 0x85, 0xF3, 0x86,
+    0x1C, 0x68, 0xCF, 0xFA, 0x72, 0xAC, 0xBB, 0xDD, 0xCA, 0x85, 0xFF, 0x6F, 0xB3, 0xB2, 0xA7, 0xEC,
+    0xEC, 0xFC, 0x5D, 0x46, 0xA2, 0x9B, 0xC7, 0xA0, 0xF4, 0x28, 0xD1, 0xC8, 0xC6, 0xCA, 0x55, 0x03,
+    0xC4, 0x9F, 0x47, 0x79, 0x5A, 0x74, 0xAF, 0x2B, 0xA4, 0xC6, 0xC0, 0x04, 0x8F, 0x25, 0xD7, 0xDB,
+    0x8E, 0xC4, 0x57, 0x36, 0x11, 0xF9, 0x0C, 0x81, 0x2C, 0x7F, 0x8E, 0x57, 0x84, 0xCA, 0x13, 0x3A,
+    0xB3, 0x9F, 0xC5, 0x5F, 0xA4, 0x02, 0x9F, 0x00, 0xC9, 0x62, 0x1F, 0xEA, 0xD9, 0xF4, 0x2B, 0xFB,
+    0x49, 0x15, 0x86, 0xA1, 0xBC, 0xEE, 0xE4, 0xC4, 0x38, 0x09, 0x27, 0x92, 0xDD, 0x8C, 0x92, 0x29,
+    0x4F, 0x57, 0xBB, 0x4B, 0xF2, 0x88, 0xF5, 0x4A, 0x77, 0x62, 0xFE, 0x25, 0x53, 0xB1, 0x90, 0x16,
+    0xEE, 0x1D, 0x24, 0x65, 0x17, 0xE6, 0xF6, 0x82, 0x1C, 0xF2, 0x23, 0xB5, 0x34, 0xD5, 0x4B, 0xF2,
+    0xF6, 0xE7, 0xC5, 0x9D, 0x94, 0x4A, 0x9C, 0x87, 0x8D, 0xBB, 0x2D, 0xE5, 0x16, 0x1F, 0x30, 0xE2,
+    0xC0, 0x0D, 0xE0, 0x18, 0x03, 0x25, 0x66, 0x53, 0xCF, 0xD9, 0xCA, 0x1C, 0xBB, 0x18, 0x5E, 0x86,
+    0x7B, 0x2D, 0x3F, 0x28, 0x2E, 0x9F, 0x27, 0xF8, 0x9A, 0xBF, 0x57, 0x49, 0x3D, 0xE2, 0xB1, 0x45,
+    0x6B, 0x53, 0x47, 0xA5, 0x43, 0x85, 0xEE, 0x1E, 0x89, 0x78, 0x0D, 0x0C, 0xC0, 0x2F, 0xC0, 0x54,
+    0xA2, 0x57, 0x33, 0xDF, 0x3A, 0x54, 0x34, 0xAB, 0x61, 0xE1, 0x7D, 0xC7, 0x4F, 0x75, 0x7A, 0xA4,
+    0x1C, 0x62, 0x7D, 0x97, 0xBC, 0xCB, 0x08, 0x1D, 0x5E, 0x5A, 0x2F, 0x76, 0x20, 0xBF, 0x7E, 0x7A,
+    0xA6, 0x69, 0xF1, 0xEC, 0x48, 0x2D, 0x49, 0xC6, 0xCA, 0x37, 0xFD, 0xD2, 0x78, 0x36, 0x51, 0xB6,
+    0x2C, 0xA6, 0x56, 0xF9, 0xBF, 0xB0, 0x5C, 0xB4, 0xB8, 0x79, 0x45, 0xCA, 0x70, 0xA0, 0xF9, 0x6B,
+    0x36, 0x26, 0x51, 0x65, 0x84, 0x19, 0xEB, 0x50, 0x05, 0xDB, 0x17, 0xD1, 0x77, 0x79, 0xA4, 0x2F,
+    0x77, 0xAB, 0x5B, 0x2B, 0x53, 0xAF, 0xD7, 0x93, 0x7C, 0x6B, 0xD6, 0x2E, 0x38, 0x32, 0x2C, 0xFD,
+    0x1A, 0xE8, 0x9D, 0x5B, 0x14, 0x68, 0x40, 0xD8, 0x74, 0x17, 0xB2, 0x6F, 0xE5, 0x78, 0xF8, 0xCA,
+    0x78, 0x4B, 0x5C, 0x56, 0x2D, 0x1B, 0xBA, 0x53, 0xCA, 0x6F, 0xDD, 0x21, 0x3D, 0x47, 0xC0, 0x57,
+    0x76, 0x16, 0x93, 0xED, 0x74, 0x65, 0x43, 0x75, 0xD7, 0xC1, 0x8F, 0x80, 0xBD, 0x3B, 0x25, 0x1B,
+    0x99, 0x2E, 0x0E, 0x07, 0xF2, 0x44, 0x9B, 0xB5, 0x1D, 0x94, 0x33, 0x6F, 0xFE, 0x61, 0xD6, 0x38,
+    0x70, 0x1A, 0xB8, 0x96, 0x03, 0x6D, 0x21, 0x1A, 0x1A, 0x3B, 0x98, 0xE9, 0x6F, 0x36, 0x22, 0xCC,
+    0xB4, 0x1F, 0xD9, 0x82, 0xC5, 0x3E, 0x19, 0x6D, 0x83, 0xED, 0x3A, 0x08, 0xB4, 0xBD, 0x69, 0x17,
+    0x64, 0xD3, 0x98, 0xFE, 0xE9, 0x9F, 0xF7, 0xB2, 0x5F, 0x63, 0x75, 0x31, 0xFA, 0x87, 0xEE, 0xE9,
+    0x1A, 0x0C, 0x8A, 0xD9, 0x7F, 0x67, 0xFD, 0xF6, 0xC6, 0xED, 0xF2, 0x9C, 0x64, 0x1C, 0x54, 0xD7,
+    0x03, 0xAB, 0xBC, 0x63, 0xB3, 0xA2, 0x61, 0xC4, 0xF6, 0xA4, 0xF2, 0xBB, 0xDA, 0xE9, 0x4B, 0xB6,
+    0xF1, 0x7D, 0x2C, 0x58, 0x30, 0x1C, 0x03, 0xB3, 0x0D, 0x15, 0x27, 0x6D, 0xCE, 0xE9, 0x90, 0xA3,
+    0xE5, 0xA0, 0xE2, 0xE2, 0xE0, 0xC8, 0x67, 0xDB, 0xE7, 0xD1, 0x06, 0x13, 0x35, 0xAA, 0x3C, 0xDB,
+    0x2F, 0x2C, 0xBF, 0xAB, 0xCB, 0x3F, 0x01, 0xAD, 0x55, 0xBD, 0x8E, 0xDC, 0x36, 0x10, 0x1E, 0x4A,
+    0x39, 0x08, 0xB0, 0x0A, 0x36, 0x77, 0x8D, 0x53, 0xE8, 0x0D, 0xC2, 0xDA, 0x4D, 0xA8, 0x54, 0x2E,
+    0xEF, 0x8A, 0x6C, 0x95, 0x87, 0xF0, 0x1B, 0x84, 0x8A, 0x5D, 0xBA, 0x71, 0xE7, 0x17, 0x48, 0x75,
+    0x2E, 0xDC, 0xA4, 0x48, 0x13, 0x90, 0x97, 0x2B, 0xD3, 0xC8, 0x6E, 0x5C, 0xA4, 0x58, 0x01, 0x36,
+    0x10, 0x20, 0x2E, 0x2C, 0x04, 0x72, 0xAC, 0xC3, 0x91, 0x1C, 0x7F, 0xC3, 0xBD, 0x3B, 0x1B, 0x88,
+    0xAF, 0xCA, 0x2E, 0x40, 0xED, 0x52, 0x24, 0x87, 0x33, 0xDF, 0xCF, 0x2C, 0x11, 0x51, 0xB3, 0xE8,
+    0xDE, 0xE5, 0xDF, 0x6A, 0xE6, 0x59, 0x57, 0x4C, 0x87, 0xD4, 0xE3, 0x25, 0xD9, 0x87, 0x3C, 0xB2,
+    0xE5, 0xD7, 0xCC, 0xBC, 0xE5, 0xA7, 0xEC, 0x17, 0xAC, 0x87, 0x96, 0x33, 0x75, 0xBC, 0x92, 0xE3,
+    0x49, 0x31, 0x0F, 0xCD, 0x2D, 0xD3, 0x40, 0x1B, 0x44, 0xF0, 0x81, 0xC8, 0xCC, 0x88, 0xBF, 0x62,
+    0x92, 0x31, 0x8E, 0xA8, 0x7C, 0x7C, 0x26, 0xC4, 0x1A, 0x35, 0xEE, 0x33, 0x6B, 0x17, 0xED, 0xD4,
+    0x24, 0x17, 0xEA, 0xEC, 0xCB, 0xA8, 0x78, 0x37, 0xEA, 0x2C, 0xEF, 0x64, 0x4D, 0xF6, 0x60, 0xAF,
+    0xDC, 0x3F, 0xCA, 0x59, 0x52, 0x92, 0xDF, 0xD1, 0x09, 0x91, 0x1B, 0x89, 0xB8, 0xA7, 0x3A, 0x12,
+    0xE9, 0x89, 0xE8, 0xA0, 0xDF, 0x5F, 0xFC, 0x03, 0x84, 0x37, 0xB1, 0xC4, 0x52, 0xD9, 0x0D, 0x80,
+    0x68, 0x52, 0xBD, 0x3A, 0xD9, 0x5F, 0xFE, 0x12, 0xA7, 0x9F, 0x2B, 0xBE, 0x9C, 0xE5, 0x7D, 0x7B,
+    0xC6, 0x83, 0xA2, 0xAF, 0xF6, 0x96, 0xBF, 0x5A, 0xF4, 0x50, 0x47, 0x13, 0x64, 0xC8, 0x6F, 0xBA,
+    0xFE, 0xEC, 0x23, 0x77, 0x85, 0x38, 0x8E, 0xA8, 0x4A, 0x44, 0x2D, 0xE8, 0x6D, 0x4B, 0xF4, 0x16,
+    0x3A, 0x71, 0xCC, 0x09, 0x5F, 0xCB, 0x66, 0xB3, 0xE9, 0x09, 0x58, 0x35, 0x58, 0x35, 0xE0, 0xC8,
+    0x63, 0xFD, 0x97, 0x72, 0x7D, 0x8F, 0x20, 0x73, 0x11, 0x9A, 0x24, 0x70, 0xE1, 0x56, 0x3B, 0xD9,
+    0xE8, 0x82, 0x4F, 0xFE, 0x8C, 0xB3, 0x3F, 0xFF, 0x27, 0xFB, 0x3F, 0x5E, 0x66, 0xBF, 0x3D, 0xCF,
+    0x8E, 0xEB, 0x64, 0x53, 0x13, 0x4D, 0x32, 0x92, 0x80, 0xEC, 0x1F, 0x3B, 0xC8, 0xAB, 0xB9, 0x02,
+    0x4F, 0x41, 0x60, 0x0D, 0xF2, 0x69, 0x90, 0x84, 0xF0, 0x5F, 0x61, 0xEC, 0xE8, 0xB1, 0x63, 0x95,
+    0xB9, 0x6F, 0x39, 0x91, 0xE1, 0x85, 0x3C, 0x8F, 0x15, 0x7F, 0x61, 0x9A, 0xC9, 0x72, 0x54, 0xFC,
+    0xEE, 0xE2, 0x81, 0x64, 0x1D, 0x3D, 0x6F, 0x67, 0x0F, 0xAC, 0x0A, 0x03, 0x47, 0x90, 0x14, 0x23,
+    0xD0, 0x54, 0x4A, 0x94, 0x02, 0xBE, 0xA7, 0xBD, 0x44, 0x86, 0x66, 0x15, 0x70, 0xD4, 0x1C, 0x88,
+    0x6D, 0xD0, 0x93, 0x09, 0x47, 0x3B, 0x4F, 0xFC, 0xDF, 0xC8, 0xF5, 0x64, 0xC8, 0xBC, 0xC8, 0xE4,
+    0xEF, 0xAF, 0xF4, 0x6B, 0x7B, 0xCD, 0xB6, 0xC6, 0x59, 0xFF, 0xE5, 0x50, 0x9F, 0x4F, 0x07, 0x60,
+    0x4B, 0xEE, 0x32, 0xFF, 0x00, 0x9F, 0x33, 0x1B, 0xFE, 0x10, 0x0D, 0xB7, 0xB3, 0x2A, 0x21, 0xC4,
+    0x65, 0x1D, 0xEC, 0xAB, 0xD7, 0x12, 0xAE, 0xF0, 0x7D, 0xE5, 0x82, 0x1A, 0x4A, 0x82, 0x76, 0x14,
+    0xCB, 0x35, 0xBF, 0x33, 0x6A, 0xB0, 0xA1, 0x9B, 0xF5, 0xD2, 0xAE, 0x8A, 0xC1, 0x88, 0x3D, 0x63,
+    0x6A, 0x17, 0xDF, 0x53, 0xB6, 0x81, 0xEC, 0x76, 0xA2, 0xE6, 0x12, 0xE7, 0x19, 0x34, 0x19, 0xD0,
+    0x26, 0xF8, 0x12, 0x60, 0xC0, 0x29, 0x5C, 0x30, 0x97, 0x0B, 0xAA, 0xE7, 0x58, 0x44, 0x91, 0x64,
+    0x31, 0xF4, 0xC5, 0x55, 0x11, 0x3C, 0xDC, 0x32, 0x1E, 0x67, 0x62, 0xCF, 0x01, 0x29, 0xCF, 0xFC,
+    0xDE, 0x2D, 0x1C, 0xF4, 0x8A, 0xFE, 0x14, 0x79, 0x90, 0xD1, 0x5C, 0x0D, 0xFC, 0x96, 0x77, 0xB2,
+    0x26, 0x7B, 0x64, 0xAF, 0x9C, 0x39, 0xC6, 0xD9, 0xE1, 0xE4, 0xD6, 0xD8, 0x6A, 0x05, 0x86, 0xDC,
+    0x2C, 0x28, 0x22, 0x51, 0x3D, 0x7E, 0x73, 0xE3, 0x1E, 0x64, 0xA9, 0xDF, 0x33, 0x35, 0x11, 0x84,
+    0x71, 0x1B, 0xD1, 0x7C, 0x80, 0x5C, 0xB0, 0xA3, 0x99, 0x9A, 0xA8, 0x67, 0x1C, 0x89, 0x64, 0x5E,
+    0xE2, 0xC8, 0x8A, 0xF2, 0xD8, 0x0D, 0xD4, 0xBD, 0x1B, 0x51, 0x2A, 0xCA, 0xF3, 0x82, 0x5F, 0xBC,
+    0xAE, 0x1B, 0x12, 0x76, 0xA1, 0x08, 0xEC, 0x8E, 0x9F, 0xF1, 0x0E, 0x8B, 0x32, 0xEC, 0x1B, 0xB9,
+    0xE3, 0xEE, 0xE9, 0xCF, 0xD8, 0x0B, 0x4A, 0xC4, 0xA8, 0xD8, 0xB5, 0xD9, 0x9C, 0x5C, 0x5F, 0x2F,
+    0x91, 0xC8, 0x42, 0x93, 0x60, 0x6F, 0x90, 0x4D, 0xB3, 0xD0, 0x80, 0x79, 0x85, 0x16, 0x85, 0xE5,
+    0x63, 0xCC, 0xDD, 0xB9, 0x68, 0x76, 0x42, 0x7C, 0xBD, 0x20, 0xA5, 0x26, 0xD6, 0x89, 0xD0, 0xD4,
+    0xD1, 0x8B, 0xF9, 0x6F, 0x5C, 0x06, 0xE1, 0x64, 0x9C, 0x46, 0x64, 0x2D, 0x68, 0xC0, 0x3E, 0x75,
+    0x96, 0xA4, 0x00, 0x0A, 0xD2, 0x5D, 0xD0, 0x51, 0x61, 0xFC, 0x59, 0xE6, 0xD5, 0xE9, 0x69, 0xAF,
+    0x8B, 0xE6, 0x56, 0x12, 0x3F, 0x17, 0x8F, 0xAF, 0x04, 0xE1, 0x41, 0x33, 0xB1, 0x7E, 0x22, 0x9D,
+    0xDD, 0x96, 0x06, 0xFC, 0x35, 0x27, 0xE9, 0x11, 0x30, 0xF0, 0x9F, 0x09, 0x65, 0xCF, 0x75, 0xE2,
+    0xA1, 0xFB, 0x97, 0xBF, 0xE3, 0x57, 0xB8, 0xE2, 0x98, 0x53, 0x6A, 0xF9, 0xD1, 0x52, 0x7C, 0x7B,
+    0x28, 0x72, 0xD7, 0x83, 0x0E, 0x48, 0xC9, 0xE3, 0xAC, 0xE5, 0x49, 0xCA, 0xC4, 0x83, 0x0E, 0x3E,
+    0x81, 0x2C, 0x18, 0xD5, 0xF0, 0x09, 0x36, 0xC9, 0x3F, 0x87, 0x40, 0x41, 0x16, 0x48, 0x92, 0xF9,
+    0xAB, 0xC8, 0x10, 0x73, 0x61, 0x00, 0x55, 0x37, 0xA2, 0x18, 0x70, 0x50, 0x48, 0xC0, 0x7F, 0x0D,
+    0x28, 0xD1, 0xF9, 0x19, 0x08, 0xC2, 0xC5, 0x13, 0xD2, 0x84, 0xDC, 0xF0, 0x60, 0xF9, 0xA3, 0x40,
+    0xA3, 0x99, 0x41, 0x01, 0x18, 0x54, 0x7C, 0x1F, 0x10, 0xD9, 0xD7, 0x2C, 0x94, 0x1C, 0xA0, 0xA9,
+    0x77, 0x7D, 0xD7, 0xDB, 0xB7, 0x11, 0xD8, 0x8C, 0xE4, 0xD2, 0x4D, 0x2A, 0xBE, 0x38, 0x23, 0x00,
+    0xAC, 0x70, 0xAF, 0x12, 0x3A, 0x92, 0x5C, 0xAE, 0x60, 0x9A, 0x52, 0xD6, 0xDB, 0xE4, 0x47, 0xFD,
+    0x01, 0xBA, 0xDF, 0x42, 0xF0, 0x0F, 0x96, 0x2E, 0x39, 0xC1, 0x80, 0xB7, 0xA3, 0x5F, 0x6D, 0x7F,
+    0x58, 0x4A, 0x08, 0x92, 0xFD, 0xB2, 0xEB, 0xBA, 0x52, 0x2C, 0xE6, 0x5A, 0x5C, 0xD0, 0x5E, 0x88,
+    0x05, 0x12, 0x8C, 0x51, 0xDC, 0x43, 0xFE, 0x27, 0x69, 0x37, 0xF0, 0x0F, 0x89, 0x81, 0xA8, 0x05,
+    0xC2, 0x38, 0x7D, 0xCA, 0x30, 0x17, 0x03, 0x02, 0x2F, 0x25, 0x58, 0xE1, 0xAC, 0x5B, 0x20, 0x41,
+    0xE8, 0xA8, 0x66, 0xB8, 0x8F, 0xDC, 0x0B, 0x28, 0x49, 0x54, 0xBF, 0x93, 0x15, 0xFD, 0x28, 0x8F,
+    0x6F, 0xE5, 0x61, 0x0A, 0x8E, 0xE1, 0x26, 0x09, 0x27, 0xC2, 0xA9, 0xDE, 0xD0, 0x7F, 0x3F, 0x1F,
+    0x01, 0xBD, 0x55, 0x3D, 0x6F, 0x14, 0x31, 0x10, 0x1D, 0x9F, 0x89, 0x56, 0xE2, 0x8A, 0x6B, 0x92,
+    0x2A, 0xC5, 0xFE, 0x00, 0x8A, 0xFD, 0x09, 0xBB, 0x54, 0x94, 0x5C, 0x91, 0xAB, 0x28, 0xF2, 0x13,
+    0xF2, 0x13, 0x76, 0x25, 0x0A, 0xDA, 0x34, 0x40, 0x49, 0x03, 0x12, 0x5C, 0x13, 0x5A, 0x24, 0x24,
+    0x5B, 0x34, 0x14, 0x14, 0x2C, 0x20, 0x44, 0x91, 0xE6, 0x24, 0x40, 0x48, 0xA1, 0x59, 0xA4, 0x05,
+    0x2E, 0xB0, 0xDE, 0xC7, 0x1B, 0x6F, 0xEE, 0xA2, 0xA4, 0x4D, 0x88, 0x75, 0xF6, 0xCD, 0xDA, 0x33,
+    0xCF, 0x6F, 0x3E, 0x6C, 0x8B, 0x88, 0x8C, 0xB1, 0x14, 0xA0, 0x1B, 0xB1, 0xDB, 0xFD, 0xAC, 0x11,
+    0xC9, 0x6B, 0x11, 0x14, 0xDB, 0x08, 0x13, 0xA0, 0x45, 0xEF, 0x0E, 0x83, 0xA0, 0x6C, 0x6C, 0x40,
+    0x95, 0xFE, 0xC2, 0x4D, 0x7C, 0x02, 0x70, 0x1B, 0x21, 0x8C, 0x71, 0xB7, 0x35, 0x45, 0x5A, 0x88,
+    0x59, 0x8A, 0x4C, 0x3C, 0xED, 0x08, 0x86, 0x85, 0x18, 0x78, 0x31, 0x2F, 0x44, 0xCC, 0x4C, 0x64,
+    0x84, 0xA1, 0x9B, 0x9E, 0x6B, 0xDA, 0x37, 0x65, 0x68, 0xDB, 0xF8, 0x22, 0x25, 0x50, 0xB1, 0xD7,
+    0x65, 0x7F, 0xD0, 0xE4, 0x4B, 0xD9, 0x4C, 0x15, 0xA7, 0x13, 0xB1, 0xAA, 0x88, 0x42, 0xA4, 0x24,
+    0x91, 0x94, 0x84, 0x92, 0x40, 0x04, 0x9D, 0xC8, 0x17, 0x83, 0xC6, 0x28, 0x7E, 0xB4, 0x72, 0x6D,
+    0x8C, 0xAF, 0x8E, 0xE4, 0xE1, 0xC7, 0x40, 0x23, 0x7B, 0x68, 0x45, 0xB6, 0x14, 0x7E, 0xAB, 0x90,
+    0xC9, 0x32, 0x02, 0xB9, 0x42, 0x32, 0xF2, 0x99, 0xC6, 0x5D, 0x13, 0xB4, 0x96, 0xCA, 0xC0, 0x32,
+    0x0B, 0x77, 0x2C, 0xE2, 0x0E, 0x63, 0xE2, 0x39, 0xBF, 0xFA, 0x4B, 0xBA, 0xB8, 0x8B, 0xC5, 0xC7,
+    0x97, 0xF4, 0xDE, 0x97, 0xE8, 0xC4, 0xF5, 0x03, 0xED, 0xD9, 0xE0, 0x9E, 0x80, 0x6C, 0xDC, 0x5E,
+    0x2D, 0xCE, 0x04, 0x6E, 0xB6, 0x71, 0x15, 0xFE, 0x6C, 0x4D, 0x49, 0xBD, 0x10, 0x92, 0xC9, 0xDF,
+    0x36, 0x93, 0x45, 0xE6, 0xA7, 0xB2, 0x73, 0x61, 0x7F, 0xB4, 0xE5, 0x95, 0x88, 0xA6, 0x5C, 0xD5,
+    0x62, 0x7E, 0xE4, 0x6A, 0xF2, 0x43, 0x7D, 0xDA, 0xE4, 0x8D, 0x28, 0xE9, 0xB4, 0x5E, 0xED, 0x7A,
+    0x11, 0x7F, 0x76, 0x88, 0x9C, 0xF9, 0xCC, 0x8F, 0x42, 0xEE, 0x25, 0x63, 0x0D, 0x5A, 0xD4, 0x31,
+    0x72, 0xFF, 0xDF, 0x9F, 0x8D, 0xC2, 0x4C, 0x7B, 0xD3, 0xDB, 0xCE, 0x55, 0x13, 0x56, 0x48, 0xD9,
+    0xC5, 0xDA, 0xBF, 0x98, 0x3F, 0x46, 0x53, 0x9C, 0x79, 0x26, 0x08, 0xBB, 0x1A, 0x26, 0xEA, 0x4D,
+    0x30, 0x54, 0xF6, 0x80, 0xDC, 0xEF, 0x8B, 0xA3, 0x33, 0x24, 0x82, 0x8A, 0x42, 0x4F, 0x40, 0xD7,
+    0x3A, 0x6F, 0xF0, 0xA6, 0x93, 0x71, 0x20, 0x74, 0xF9, 0xBD, 0xA3, 0x6B, 0x14, 0xF2, 0xBF, 0x14,
+    0xA0, 0xC2, 0x6A, 0xA6, 0x3C, 0xA4, 0x4E, 0x77, 0xA2, 0x4C, 0xAB, 0x23, 0x9A, 0x9F, 0xE0, 0x28,
+    0xE0, 0xFE, 0xBA, 0x0C, 0xF2, 0xF7, 0x0C, 0x85, 0x0D, 0x99, 0x9E, 0xEE, 0x0F, 0xAD, 0x8A, 0x79,
+    0x9C, 0xAD, 0x54, 0x64, 0xB0, 0x02, 0xEF, 0x8A, 0x31, 0x7E, 0x07, 0x86, 0x8B, 0xA6, 0x92, 0x1F,
+    0xEF, 0x05, 0x0D, 0xA7, 0xAB, 0xA5, 0xF4, 0x54, 0x20, 0x27, 0x2A, 0xB8, 0x73, 0x62, 0x12, 0xC5,
+    0x7C, 0xC1, 0x30, 0x5B, 0x3C, 0xA0, 0x59, 0x8A, 0x78, 0xA6, 0xC0, 0x43, 0x35, 0xC2, 0x3B, 0x8A,
+    0x52, 0x0C, 0x2E, 0x56, 0x1C, 0xB8, 0x94, 0x28, 0x37, 0x1D, 0x16, 0x89, 0xD2, 0xE5, 0x90, 0x76,
+    0x89, 0x7A, 0xC9, 0x21, 0x51, 0xC7, 0x6D, 0xCF, 0xC0, 0x59, 0xAC, 0x87, 0xFE, 0x46, 0xFF, 0xD8,
+    0xF6, 0xBA, 0xAA, 0x2A, 0xE3, 0x6E, 0x65, 0x41, 0xDB, 0xFE, 0x80, 0x28, 0x27, 0x78, 0x11, 0x79,
+    0xED, 0xAC, 0x5E, 0x7B, 0xEA, 0x54, 0xC9, 0x79, 0x06, 0x61, 0x41, 0x42, 0xFD, 0x30, 0x53, 0xE4,
+    0xF5, 0x08, 0x9F, 0x03, 0x27, 0x5C, 0x9D, 0xD1, 0x2C, 0xB2, 0x2E, 0x1B, 0xEE, 0x1F, 0x68, 0xA5,
+    0x3E, 0x45, 0xEF, 0x5C, 0x6D, 0x87, 0x99, 0xB2, 0x49, 0xA8, 0x73, 0x1F, 0x51, 0x99, 0xE5, 0x52,
+    0xD2, 0xFC, 0x55, 0x88, 0x5E, 0x5D, 0x9F, 0x3F, 0x63, 0x45, 0x54, 0x84, 0xDF, 0x9A, 0x69, 0x69,
+    0xD2, 0xF5, 0x6F, 0xC0, 0x31, 0xF3, 0xC7, 0xCA, 0x64, 0xA2, 0x49, 0xD2, 0x68, 0x9D, 0x78, 0x49,
+    0xFF, 0xCC, 0xEF, 0x01, 0x3F, 0x78, 0x2B, 0x73, 0x25, 0x3D, 0xB3, 0xC2, 0x8F, 0x7E, 0xFE, 0x64,
+    0xB0, 0x79, 0x44, 0xA8, 0xD1, 0x7C, 0x5E, 0x28, 0xAA, 0x76, 0x33, 0x1B, 0x4A, 0x4F, 0x9C, 0x46,
+    0x17, 0x9E, 0x55, 0xD5, 0x64, 0x6D, 0xDA, 0xE6, 0x75, 0xD2, 0x31, 0x27, 0x1D, 0x53, 0x7C, 0xDA,
+    0x7D, 0xC4, 0x8B, 0x65, 0x9E, 0x2D, 0xE5, 0xB9, 0xEA, 0x5A, 0x2D, 0x6C, 0xA7, 0x47, 0x67, 0xAA,
+    0xB7, 0xDB, 0x2D, 0x9F, 0xD4, 0x38, 0x68, 0x52, 0xB4, 0x86, 0xC5, 0x6E, 0x34, 0x2F, 0x66, 0xBD,
+    0x31, 0x99, 0xFF, 0x3C, 0xA5, 0xA4, 0xFC, 0xE6, 0x4F, 0x95, 0x2C, 0xF0, 0x5A, 0x99, 0x9F, 0x59,
+    0xE1, 0xC7, 0xD1, 0x7C, 0x77, 0xED, 0xAD, 0x1E, 0x99, 0xA4, 0x4E, 0x6A, 0x2D, 0x47, 0x02, 0x16,
+    0x52, 0xEA, 0x99, 0x2B, 0x2E, 0x8D, 0xBA, 0xB6, 0xC9, 0x42, 0xAB, 0x4E, 0x9F, 0x1F, 0xBD, 0xE6,
+    0xE4, 0xB2, 0xA8, 0xAF, 0xB0, 0xE3, 0xC5, 0xA9, 0x5D, 0xE5, 0x55, 0xBB, 0x04, 0xEA, 0x6B, 0x82,
+    0xDC, 0x2C, 0x9C, 0xA7, 0xB1, 0x22, 0xC8, 0xAA, 0x38, 0xB3, 0x12, 0xEB, 0xE5, 0xE1, 0xBA, 0x92,
+    0x2A, 0xE1, 0xBB, 0xCC, 0x1F, 0x9F, 0x65, 0xDB, 0xC4, 0x67, 0x8B, 0x3B, 0xE9, 0xA3, 0x7C, 0xAE,
+    0xFD, 0x03, 0xBD, 0x55, 0xBD, 0x6E, 0xD4, 0x40, 0x10, 0x1E, 0x7B, 0x39, 0x5C, 0xB8, 0x70, 0x8A,
+    0xA4, 0xA1, 0x71, 0x4F, 0xE3, 0x47, 0xD8, 0x13, 0x4D, 0x4A, 0xAE, 0x48, 0x9E, 0x23, 0x2F, 0x80,
+    0x74, 0x6E, 0x10, 0xAF, 0x91, 0x02, 0x84, 0x74, 0x34, 0x3C, 0x00, 0x62, 0xAD, 0x3C, 0x81, 0xA3,
+    0xBC, 0x80, 0x25, 0x40, 0x91, 0xA8, 0x56, 0x8A, 0x51, 0x1C, 0xE2, 0xF5, 0xC7, 0x37, 0x7B, 0x47,
+    0xA2, 0x20, 0x88, 0x4E, 0x42, 0xC9, 0xCA, 0xEB, 0x5D, 0xCF, 0xCE, 0xDF, 0x37, 0x33, 0x3B, 0x16,
+    0xE1, 0x70, 0x41, 0x0C, 0xD0, 0x14, 0x80, 0xAF, 0xFA, 0xB2, 0xB7, 0x6D, 0x36, 0x2E, 0x1B, 0x33,
+    0x3A, 0xE0, 0x76, 0x36, 0x22, 0x4B, 0x4E, 0xDB, 0x89, 0x54, 0x83, 0x7C, 0x54, 0x5E, 0xCA, 0x78,
+    0x59, 0x82, 0x94, 0xA3, 0x9A, 0x27, 0x54, 0xF4, 0x89, 0x73, 0xE4, 0xC4, 0x31, 0xB9, 0xBD, 0x48,
+    0xD9, 0xED, 0xC9, 0xEC, 0xC5, 0x68, 0x86, 0xE2, 0xC7, 0x24, 0x16, 0x8D, 0x50, 0x20, 0x39, 0x50,
+    0x93, 0x19, 0x30, 0x2C, 0x81, 0x37, 0xEB, 0x65, 0x7F, 0x8C, 0xDA, 0xB3, 0xCD, 0x32, 0xAD, 0x8E,
+    0x49, 0x24, 0x8B, 0xD7, 0xE5, 0xEE, 0x99, 0x2E, 0xDF, 0x57, 0xFB, 0xB7, 0xE2, 0xB3, 0x79, 0xB2,
+    0xC8, 0x7D, 0xE1, 0xD3, 0xC0, 0x63, 0x80, 0x8E, 0x90, 0x65, 0xB6, 0x10, 0xF9, 0x5F, 0x64, 0x0E,
+    0xAD, 0x88, 0xEA, 0x39, 0x9C, 0x13, 0x49, 0x10, 0x6A, 0x22, 0x24, 0xD8, 0x46, 0x6C, 0xED, 0x24,
+    0x59, 0x24, 0x1B, 0x1B, 0x15, 0xBE, 0x72, 0xA2, 0xA3, 0xE0, 0x68, 0xF0, 0xD3, 0x35, 0xE8, 0x65,
+    0xB7, 0xA4, 0x13, 0x29, 0x9D, 0x11, 0x4B, 0x19, 0x43, 0x61, 0x59, 0xB6, 0xCF, 0x56, 0xEF, 0x43,
+    0x02, 0x2C, 0xDB, 0x12, 0x17, 0xBA, 0xA1, 0xC5, 0xEA, 0x02, 0x64, 0xAB, 0x7A, 0xA9, 0x3C, 0xDA,
+    0x14, 0x39, 0xBE, 0x39, 0x6F, 0x41, 0x14, 0xF4, 0xCC, 0x27, 0x8E, 0x9A, 0x65, 0x4F, 0xD6, 0x70,
+    0x14, 0x96, 0x9B, 0x84, 0x30, 0xE7, 0x59, 0x5F, 0xB6, 0x0A, 0x5B, 0xAD, 0x27, 0x38, 0x0D, 0x39,
+    0x7E, 0x86, 0x12, 0x08, 0xF6, 0xEA, 0x28, 0xD8, 0x2E, 0x67, 0x20, 0x4C, 0x70, 0x7F, 0x4C, 0xA5,
+    0xD9, 0x2E, 0x0B, 0x76, 0x28, 0x23, 0x6F, 0x8E, 0xEB, 0x90, 0xE2, 0x2C, 0xC8, 0x13, 0xF5, 0x2E,
+    0x1B, 0x77, 0xA4, 0x18, 0xAB, 0x77, 0x6E, 0xA8, 0x34, 0x54, 0x0C, 0xD9, 0x53, 0x5C, 0xA9, 0xED,
+    0x99, 0xA4, 0x3E, 0xE9, 0xA5, 0xB8, 0x26, 0x16, 0x0D, 0x48, 0xA2, 0x31, 0x90, 0x0D, 0xF2, 0x47,
+    0x80, 0x9E, 0x10, 0xA6, 0x69, 0x4D, 0x67, 0xE0, 0x5A, 0x66, 0xB7, 0x16, 0x1B, 0x94, 0x28, 0x0F,
+    0x0E, 0x3D, 0x0E, 0x33, 0x68, 0x0D, 0xB1, 0x38, 0x72, 0xAD, 0x6A, 0x3B, 0x97, 0xDB, 0xF1, 0x08,
+    0x59, 0xD7, 0x51, 0xE8, 0x2D, 0xEA, 0xD7, 0x33, 0xEF, 0x6E, 0xAC, 0x3F, 0x3C, 0xF4, 0x47, 0xC2,
+    0x27, 0xBC, 0x4E, 0x92, 0xF5, 0x1A, 0x66, 0x45, 0xCB, 0x0F, 0x89, 0xFD, 0x81, 0xAF, 0x84, 0xC1,
+    0x37, 0x3C, 0xC9, 0xFC, 0x3A, 0x0C, 0x9B, 0x3B, 0xFD, 0xA0, 0xD0, 0x63, 0x73, 0x72, 0x5E, 0xE1,
+    0xD7, 0x92, 0xB1, 0x69, 0x25, 0x81, 0xCE, 0xF1, 0x1A, 0xC4, 0xD4, 0xB3, 0xF9, 0xA4, 0x13, 0x7B,
+    0x45, 0x75, 0x7E, 0xCF, 0x66, 0x5A, 0x7D, 0x98, 0xD8, 0x9A, 0x70, 0xCE, 0xB9, 0xDE, 0x6C, 0x23,
+    0xA5, 0x9B, 0xD8, 0x68, 0xB2, 0x18, 0x5E, 0x68, 0xED, 0x69, 0x2F, 0xAB, 0xA1, 0xB7, 0xED, 0xE0,
+    0x77, 0xB0, 0xB4, 0x02, 0xE8, 0x99, 0x98, 0x49, 0xA3, 0x35, 0xDC, 0x21, 0x85, 0x2A, 0x48, 0x71,
+    0x09, 0x6D, 0xB4, 0x08, 0x82, 0xAB, 0xE5, 0x60, 0x30, 0xB7, 0xBE, 0x18, 0x59, 0xC1, 0xB6, 0x63,
+    0xDA, 0x50, 0xE7, 0x23, 0x05, 0x2B, 0x4F, 0xC1, 0xFB, 0x49, 0x11, 0xA8, 0x94, 0x5E, 0x4D, 0xD0,
+    0x3D, 0xDB, 0x69, 0xF6, 0x10, 0xF4, 0x85, 0xCB, 0xF8, 0x6E, 0x23, 0x39, 0x81, 0xDA, 0xCE, 0x14,
+    0xB2, 0x30, 0xC6, 0x20, 0x37, 0xDF, 0x24, 0x73, 0xD4, 0x54, 0x62, 0xEE, 0x28, 0xD9, 0x70, 0xDF,
+    0x47, 0xD6, 0x91, 0xEA, 0xE2, 0x6A, 0x89, 0x4D, 0x98, 0xD5, 0xA7, 0x78, 0x22, 0x41, 0xAA, 0x6E,
+    0x57, 0xF2, 0xC1, 0x0D, 0xE9, 0xC4, 0x7C, 0xB1, 0x96, 0xFA, 0x8A, 0x59, 0xCD, 0x83, 0xB8, 0x13,
+    0x50, 0xA1, 0x6B, 0xB2, 0xB1, 0xA2, 0xB6, 0x9C, 0x7A, 0x4F, 0xD4, 0x82, 0xAB, 0xFF, 0x42, 0xD0,
+    0xB8, 0x75, 0x95, 0x9D, 0x3E, 0x3B, 0x8C, 0x43, 0xD9, 0x2F, 0x62, 0x2F, 0x29, 0x10, 0xD6, 0x4F,
+    0xC2, 0xBF, 0x19, 0xEF, 0xFB, 0x36, 0x0F, 0xDA, 0x1B, 0x29, 0xAD, 0xCA, 0x60, 0x4E, 0x71, 0xED,
+    0x19, 0x82, 0x57, 0xF9, 0x38, 0x93, 0x9D, 0xD8, 0x3D, 0xA6, 0x98, 0x19, 0x66, 0x88, 0x50, 0xB7,
+    0xFC, 0x78, 0xBE, 0x7A, 0x0B, 0x7C, 0x01, 0x5E, 0x1F, 0x6A, 0xCE, 0x81, 0x33, 0xE0, 0x25, 0x42,
+    0xA6, 0x49, 0x61, 0x96, 0x68, 0x97, 0x19, 0xFA, 0xE7, 0xD6, 0xF6, 0x74, 0xC6, 0xA2, 0x87, 0xFE,
+    0xB9, 0xB6, 0x1B, 0xBF, 0x00, 0xB5, 0x55, 0xBB, 0x72, 0xD4, 0x30, 0x14, 0xBD, 0x6B, 0xCF, 0xC6,
+    0x85, 0x0A, 0x37, 0x99, 0xA1, 0xDC, 0x1A, 0x1A, 0x7D, 0x82, 0x4C, 0x4D, 0x91, 0x2D, 0x92, 0x9F,
+    0x80, 0x6F, 0x00, 0x19, 0xDA, 0x14, 0xFB, 0x01, 0x54, 0x74, 0xB0, 0x4D, 0x7E, 0x20, 0x83, 0x3C,
+    0x49, 0x91, 0x82, 0x02, 0xCF, 0xA4, 0xA4, 0xF1, 0x24, 0x1D, 0x14, 0xEB, 0x01, 0x17, 0x62, 0x22,
+    0xE9, 0x72, 0x24, 0x27, 0x21, 0x40, 0x1E, 0x6C, 0x06, 0x34, 0x96, 0xAD, 0xE7, 0xB9, 0x47, 0xF7,
+    0x9E, 0x2B, 0x3F, 0x5D, 0xBE, 0x61, 0x3E, 0x62, 0x9E, 0xEE, 0x6C, 0x13, 0x51, 0x69, 0x49, 0x75,
+    0xC4, 0x75, 0x1E, 0xEE, 0x6E, 0x6E, 0xD3, 0xE6, 0x3E, 0x3D, 0x57, 0x2B, 0x27, 0x79, 0x28, 0xB8,
+    0xA1, 0x4D, 0xEC, 0x27, 0xC5, 0xC3, 0xF8, 0x14, 0x5C, 0x67, 0x4C, 0x7F, 0xF3, 0xE4, 0x5C, 0x5D,
+    0xEE, 0x02, 0xA6, 0xA3, 0x7D, 0xBD, 0xB2, 0x8A, 0x7B, 0xC1, 0xF5, 0x88, 0x09, 0x5B, 0x6B, 0x3D,
+    0xC0, 0x61, 0x3E, 0x66, 0x7E, 0xCC, 0x1D, 0xE0, 0x85, 0x23, 0xD9, 0x93, 0x69, 0x6E, 0x6C, 0x96,
+    0x3E, 0x67, 0xDE, 0x62, 0x8F, 0x6D, 0xA4, 0x28, 0xEB, 0x69, 0x56, 0xD3, 0x7B, 0x9A, 0x70, 0x0B,
+    0x62, 0xD9, 0x5B, 0xCA, 0xBC, 0x3A, 0x0D, 0xB3, 0x26, 0xD2, 0x40, 0xE3, 0x9A, 0xA7, 0xB3, 0x4A,
+    0xB4, 0x5E, 0xB0, 0xEA, 0x97, 0x91, 0xAC, 0x1D, 0x81, 0xC9, 0x53, 0x2A, 0x65, 0x02, 0x66, 0x6E,
+    0xB5, 0xBD, 0x8D, 0xC4, 0x45, 0x13, 0x36, 0x13, 0x77, 0xF0, 0x61, 0xB3, 0x3A, 0x0B, 0xBF, 0xBD,
+    0x00, 0x25, 0x2C, 0xC0, 0xE4, 0x29, 0x73, 0x65, 0x5E, 0xE2, 0x80, 0x21, 0x6E, 0xB6, 0x71, 0x7B,
+    0x17, 0x01, 0x6A, 0xA0, 0xAD, 0x33, 0x54, 0x7A, 0x1A, 0xB1, 0x16, 0xEC, 0xB3, 0x11, 0x3E, 0x46,
+    0xB1, 0x23, 0x38, 0xA0, 0xA2, 0x8D, 0x3D, 0x47, 0x34, 0x63, 0xF4, 0x74, 0x88, 0x23, 0x2D, 0x5D,
+    0x14, 0x53, 0xC9, 0xC3, 0x40, 0xBC, 0xB0, 0x39, 0x7C, 0x23, 0xFA, 0xF3, 0xD1, 0xD2, 0xE6, 0x5E,
+    0x75, 0xE5, 0xC0, 0xB5, 0x3A, 0xC6, 0xEC, 0xD6, 0x3A, 0xDD, 0x8A, 0x72, 0xB8, 0xAC, 0x1C, 0x60,
+    0xBD, 0xA5, 0x67, 0x51, 0x19, 0x8E, 0x04, 0x64, 0x35, 0x03, 0xA1, 0xE9, 0x1C, 0x2A, 0xA9, 0x89,
+    0x41, 0xF6, 0xC3, 0x20, 0x7A, 0xD9, 0x6C, 0x8F, 0xCA, 0x98, 0x30, 0xE8, 0xF5, 0xFF, 0xE2, 0x03,
+    0xAF, 0x40, 0x39, 0x8F, 0x62, 0xD0, 0x1D, 0x04, 0x94, 0xCC, 0xA5, 0xB2, 0x83, 0xB3, 0xF7, 0xA4,
+    0x99, 0xD4, 0xA2, 0x57, 0x75, 0x98, 0xD2, 0xB4, 0x8A, 0x51, 0x06, 0x55, 0xAC, 0x80, 0x9F, 0x90,
+    0x10, 0xD8, 0xB8, 0x4E, 0xA7, 0xDD, 0x30, 0x43, 0x3C, 0x9C, 0xF1, 0xE9, 0x6C, 0xBA, 0x21, 0x73,
+    0x84, 0xC0, 0x0C, 0xBA, 0x29, 0x7C, 0xE1, 0x26, 0x5C, 0xEB, 0x46, 0xF5, 0x85, 0x2B, 0x1D, 0xE9,
+    0x03, 0xAE, 0x0A, 0xA7, 0x3B, 0xD2, 0x1F, 0x2D, 0x15, 0x0C, 0x9A, 0x9A, 0x53, 0xA3, 0x25, 0x7D,
+    0xC6, 0x54, 0x78, 0xEC, 0xD7, 0x8D, 0x69, 0x0B, 0x97, 0x33, 0x1A, 0x33, 0x5B, 0x38, 0xE2, 0x46,
+    0x43, 0x44, 0xC5, 0x08, 0x88, 0x1E, 0x5D, 0x09, 0x19, 0x51, 0x8A, 0x54, 0x88, 0x91, 0x8A, 0x13,
+    0xF3, 0x71, 0x42, 0x22, 0xBE, 0x31, 0xEC, 0x59, 0x9C, 0x30, 0xF5, 0x2F, 0x03, 0x72, 0x30, 0xB5,
+    0x1C, 0x64, 0x37, 0x83, 0x30, 0x66, 0x36, 0x0B, 0xB0, 0x68, 0x16, 0x90, 0xF8, 0x2A, 0x06, 0x27,
+    0x06, 0x09, 0xE2, 0x30, 0x31, 0x2E, 0x03, 0x37, 0x50, 0x13, 0x56, 0x40, 0x37, 0xD8, 0xD2, 0xCB,
+    0x2E, 0x67, 0x60, 0x80, 0xFC, 0x45, 0x11, 0x08, 0x6D, 0x06, 0x3D, 0xA5, 0xCC, 0x50, 0xA8, 0xD3,
+    0x64, 0xAE, 0xF0, 0x58, 0xEA, 0x05, 0x84, 0x94, 0x05, 0xB8, 0xC8, 0xBC, 0x62, 0x92, 0x27, 0x90,
+    0xE6, 0xF7, 0x84, 0x5E, 0x03, 0x7D, 0x20, 0x09, 0x53, 0x22, 0xA8, 0x7E, 0x5C, 0x51, 0xEB, 0x56,
+    0x76, 0xC2, 0x01, 0x9D, 0x0F, 0x42, 0xF4, 0x21, 0x62, 0xA4, 0xFA, 0xC8, 0x38, 0x9E, 0x40, 0x57,
+    0x34, 0xA9, 0x92, 0x41, 0x38, 0x21, 0x26, 0xA2, 0xB8, 0xD7, 0xE7, 0xF3, 0xF2, 0x35, 0xB3, 0x37,
+    0xCC, 0x9F, 0xF0, 0xA1, 0x9D, 0x0A, 0xD2, 0x8E, 0x22, 0x95, 0xCD, 0x64, 0x3E, 0x5E, 0x49, 0xAA,
+    0x5B, 0xFF, 0x15, 0x83, 0x2D, 0xEE, 0xCB, 0x2A, 0x2C, 0xDF, 0x9D, 0xD3, 0x31, 0x7C, 0x99, 0x89,
+    0x39, 0x26, 0x55, 0x43, 0x39, 0x7C, 0xFB, 0x82, 0xD2, 0xC1, 0x6F, 0xBA, 0xA6, 0x7E, 0xDE, 0x57,
+    0x58, 0x17, 0x66, 0x07, 0x56, 0x4D, 0xE6, 0xBA, 0x29, 0xBF, 0x42, 0xD9, 0xBB, 0x6E, 0xE2, 0x64,
+    0x2F, 0x3A, 0xD3, 0x48, 0x5C, 0x0A, 0xC9, 0x20, 0xF2, 0x21, 0x1A, 0xBD, 0xAB, 0xBB, 0x5C, 0x3E,
+    0x01, 0x1F, 0x84, 0x67, 0x18, 0x39, 0xE1, 0x36, 0x58, 0x59, 0xA3, 0x4E, 0x2C, 0x2F, 0x0E, 0xC3,
+    0xC3, 0x75, 0xFE, 0x26, 0xE5, 0x98, 0x0A, 0xB7, 0x78, 0xC0, 0x08, 0x57, 0x5A, 0xD3, 0xF0, 0xAE,
+    0x2B, 0xFA, 0xBB, 0xBD, 0x73, 0x8B, 0xA1, 0xA0, 0xBE, 0x38, 0xDE, 0xFB, 0x16, 0xD4, 0xD6, 0x8D,
+    0x4C, 0xA2, 0x74, 0xAE, 0xAF, 0x15, 0xF2, 0xAF, 0x47, 0x1D, 0xD2, 0xB7, 0xC4, 0xB5, 0xA5, 0x23,
+    0x83, 0x18, 0x06, 0xD4, 0x07, 0x57, 0xD7, 0x82, 0x12, 0x72, 0xD5, 0x5F, 0x54, 0x4A, 0x49, 0x85,
+    0xDC, 0x32, 0x35, 0x74, 0x7A, 0xB5, 0x89, 0x34, 0xF3, 0x80, 0xC8, 0xB9, 0x8D, 0xAF, 0x0E, 0xBF,
+    0x4E, 0x11, 0xFE, 0x5C, 0xFB, 0x7F, 0xCA, 0x0F, 0xC5, 0x55, 0xBB, 0x6E, 0xD4, 0x40, 0x14, 0xBD,
+    0xF6, 0x68, 0xB1, 0xC4, 0x16, 0x6E, 0xB2, 0xB5, 0x3F, 0xC1, 0x9F, 0x30, 0x46, 0x14, 0x29, 0x28,
+    0xD8, 0x22, 0x5B, 0xE7, 0x13, 0xF6, 0x13, 0xBC, 0x0A, 0x3F, 0x40, 0x05, 0xBF, 0x10, 0x6D, 0x93,
+    0x2F, 0x40, 0x36, 0xA4, 0x48, 0x41, 0x63, 0x29, 0x42, 0x29, 0x28, 0xB0, 0x44, 0x44, 0x41, 0x65,
+    0xC8, 0x12, 0x1C, 0xB0, 0xE7, 0x70, 0xEE, 0x38, 0x8F, 0x25, 0x4A, 0x10, 0x12, 0x51, 0xB0, 0x34,
+    0x47, 0x73, 0xE7, 0x71, 0x1F, 0x67, 0xEE, 0xBD, 0x16, 0x09, 0xB6, 0x44, 0x24, 0xEE, 0x08, 0x69,
+    0x43, 0xC8, 0x17, 0x22, 0x41, 0xCF, 0x89, 0x4C, 0x65, 0xF8, 0xF2, 0x95, 0x84, 0x5D, 0xDE, 0x89,
+    0xE9, 0x72, 0xA7, 0x00, 0x0F, 0x0B, 0x85, 0x8A, 0x90, 0x37, 0x84, 0xED, 0x15, 0xE1, 0x49, 0x47,
+    0x78, 0xE6, 0x08, 0x3B, 0x20, 0x2C, 0xB0, 0x4F, 0xC8, 0x0F, 0x09, 0xF6, 0x84, 0x90, 0x9C, 0x12,
+    0xC6, 0x20, 0x18, 0x85, 0x50, 0x41, 0x3C, 0xE4, 0x0A, 0x96, 0x2E, 0x4C, 0x32, 0x31, 0x10, 0xB1,
+    0xB5, 0x84, 0x74, 0x21, 0xAD, 0x44, 0xB6, 0xBC, 0x0B, 0x76, 0x07, 0x15, 0x2C, 0x3E, 0x02, 0xF8,
+    0x80, 0x97, 0x28, 0x56, 0x06, 0x28, 0xC7, 0x70, 0x92, 0xA0, 0x95, 0x1C, 0x75, 0x00, 0x2C, 0xA2,
+    0x5B, 0xC4, 0xF2, 0x1E, 0xFD, 0xBF, 0xFA, 0xA0, 0xE0, 0x38, 0x02, 0x5D, 0x0E, 0x5B, 0x9D, 0x0D,
+    0x84, 0x9A, 0x36, 0xED, 0xE3, 0x13, 0x38, 0x0B, 0xF4, 0x38, 0xCB, 0x7F, 0x22, 0xB3, 0xE8, 0xA4,
+    0xF8, 0x73, 0x10, 0xE7, 0xE2, 0xA5, 0x09, 0xC3, 0x59, 0x42, 0x7A, 0x0A, 0x4E, 0xF9, 0x6A, 0xA3,
+    0x4C, 0x99, 0x9A, 0xA8, 0x4C, 0xC3, 0xE9, 0x11, 0x77, 0x63, 0x70, 0xDD, 0xA0, 0xE4, 0xE1, 0xD9,
+    0x7D, 0x3F, 0xE4, 0x28, 0x0B, 0xA6, 0x76, 0xC1, 0xD3, 0x6F, 0x5B, 0xB1, 0xD0, 0x65, 0x3A, 0x91,
+    0xFD, 0xF3, 0x43, 0x8E, 0x57, 0x9E, 0x59, 0x55, 0x14, 0x6B, 0xAA, 0x06, 0xCA, 0xAF, 0x24, 0x1A,
+    0x62, 0xD8, 0xD9, 0x4D, 0x94, 0xF6, 0xF1, 0x19, 0xF0, 0x68, 0x4A, 0x66, 0x19, 0x24, 0xDE, 0xA1,
+    0x12, 0xDB, 0x44, 0xBD, 0x18, 0xA7, 0x19, 0x65, 0x2B, 0xA3, 0x51, 0xFB, 0x69, 0xF9, 0xD7, 0xD3,
+    0x35, 0xCE, 0xAE, 0xD1, 0x55, 0x28, 0x5D, 0xF3, 0x96, 0xF0, 0xB4, 0x27, 0x6C, 0xC2, 0xD3, 0xA5,
+    0x4C, 0x41, 0x99, 0xCA, 0xBF, 0x12, 0x52, 0x47, 0x88, 0x6F, 0x62, 0xCA, 0x2A, 0x24, 0x0A, 0xB1,
+    0x82, 0xBE, 0xE7, 0x15, 0x8C, 0xE6, 0xCC, 0x97, 0x44, 0x1F, 0x30, 0x61, 0x0C, 0x92, 0xB8, 0xCB,
+    0xB4, 0xFA, 0x3D, 0x79, 0xE6, 0x57, 0xC9, 0x13, 0x92, 0x29, 0xE5, 0x31, 0x25, 0x53, 0xB7, 0x88,
+    0xDD, 0x50, 0xE1, 0x45, 0xA9, 0x35, 0x16, 0xEE, 0xB5, 0x4C, 0x11, 0x12, 0x44, 0xDD, 0x45, 0x25,
+    0x0F, 0x97, 0xBB, 0x22, 0x11, 0xC8, 0x2D, 0x29, 0xA7, 0xC9, 0xC9, 0xEC, 0xA2, 0xFA, 0x43, 0x6A,
+    0x91, 0x31, 0xA8, 0x87, 0xA0, 0x6F, 0xF5, 0x19, 0xAD, 0x41, 0x16, 0x21, 0xD4, 0x87, 0xAD, 0x99,
+    0x60, 0x71, 0xA7, 0xF5, 0x8A, 0x84, 0xAF, 0x93, 0x1F, 0xB1, 0x6C, 0x93, 0x6F, 0x54, 0x13, 0xF5,
+    0x79, 0x45, 0x5D, 0xDB, 0xBA, 0x78, 0xE8, 0xD4, 0xB2, 0x3F, 0x99, 0xAE, 0x24, 0x72, 0xFE, 0xBA,
+    0x14, 0x6E, 0x0E, 0x72, 0x43, 0x9D, 0xF4, 0x90, 0xBA, 0x1E, 0xC0, 0x65, 0x43, 0x91, 0x04, 0xCB,
+    0x25, 0xA9, 0x42, 0xA9, 0x43, 0x66, 0x43, 0xE2, 0xF0, 0x38, 0xDD, 0x46, 0xC5, 0x0B, 0x4D, 0xDA,
+    0x26, 0x34, 0x49, 0x0B, 0x7C, 0xA5, 0xC2, 0x8F, 0x10, 0xC3, 0x30, 0x4E, 0xD7, 0x74, 0x4F, 0xCF,
+    0xF0, 0xAC, 0xE6, 0x57, 0xA5, 0x77, 0x25, 0xA0, 0x9A, 0x89, 0x8C, 0x18, 0x4B, 0x39, 0x56, 0xCF,
+    0x0A, 0x52, 0x91, 0x2A, 0xC5, 0x21, 0x7C, 0x2E, 0x65, 0x17, 0x14, 0xA7, 0xA8, 0x65, 0xF0, 0xA8,
+    0xD0, 0x3C, 0x2A, 0xDC, 0x1E, 0x16, 0x76, 0x25, 0x39, 0xCD, 0xD2, 0x77, 0x6D, 0x94, 0xD8, 0xD7,
+    0x80, 0xBE, 0x5C, 0x8B, 0x72, 0x2D, 0x74, 0xCF, 0x87, 0x3F, 0xF9, 0x86, 0x72, 0x5E, 0xFB, 0xEB,
+    0x63, 0x7C, 0x22, 0x89, 0x50, 0x9D, 0x9E, 0x4E, 0x99, 0xE3, 0x58, 0xD4, 0x27, 0x6F, 0x7C, 0x6A,
+    0x6A, 0xD3, 0x30, 0x84, 0x4A, 0x34, 0xE8, 0xD4, 0x5D, 0x79, 0x74, 0x17, 0x81, 0x07, 0x5B, 0x34,
+    0xC3, 0x7D, 0x3A, 0xEB, 0xB4, 0xAB, 0x3A, 0xED, 0x1D, 0xAF, 0x62, 0x56, 0xCE, 0xC6, 0x7F, 0x0D,
+    0x5C, 0x66, 0xA3, 0xA9, 0x20, 0x69, 0x4C, 0x6F, 0xCB, 0xA8, 0x71, 0x12, 0xBF, 0x6E, 0x65, 0x74,
+    0x97, 0x81, 0x9F, 0x7F, 0x0C, 0x88, 0x69, 0xAC, 0x88, 0xDA, 0x2A, 0x3A, 0xCD, 0x63, 0x0A, 0xD0,
+    0xA6, 0x20, 0xCC, 0x4A, 0x7A, 0xCE, 0xAA, 0x50, 0x41, 0xCB, 0x9F, 0x02, 0xDB, 0x06, 0x96, 0xBB,
+    0x8C, 0x92, 0xE7, 0x0F, 0x54, 0x60, 0xD9, 0x7A, 0x61, 0xBF, 0x5F, 0x3F, 0x36, 0xDC, 0x19, 0x14,
+    0x08, 0xB4, 0x6D, 0x30, 0xC8, 0x17, 0xC5, 0x8F, 0xE5, 0xF3, 0xC1, 0xCE, 0xB9, 0xD1, 0x60, 0x10,
+    0x64, 0x63, 0xED, 0x17, 0x11, 0x62, 0x15, 0x91, 0xF2, 0x9C, 0x95, 0x8C, 0xC6, 0xE8, 0x01, 0x06,
+    0x7A, 0x36, 0x67, 0x1B, 0xAB, 0xB1, 0x48, 0xD8, 0x7C, 0x0E, 0x38, 0x1A, 0x01, 0x8B, 0x96, 0x5B,
+    0xBD, 0xC6, 0x0B, 0x9C, 0xC2, 0xD7, 0xE1, 0x7B, 0xDF, 0xA6, 0x24, 0xE1, 0x56, 0xA9, 0xBE, 0x44,
+    0xDA, 0x15, 0x8B, 0xE3, 0x82, 0xED, 0x32, 0xF3, 0x9A, 0x7A, 0xDE, 0xF9, 0x4E, 0x36, 0xC8, 0x84,
+    0x36, 0x51, 0x4D, 0xFC, 0x91, 0xDC, 0xF0, 0xFD, 0x02, 0xBD, 0x55, 0x3D, 0x6F, 0xD5, 0x30, 0x14,
+    0x3D, 0x4E, 0xF4, 0x88, 0x50, 0x86, 0x30, 0xB4, 0x13, 0x48, 0x99, 0x90, 0xD8, 0xF2, 0x13, 0x1C,
+    0x40, 0x88, 0xB5, 0x43, 0x99, 0x3A, 0xF0, 0x0B, 0xF8, 0x0D, 0x89, 0x58, 0x99, 0x99, 0x18, 0x60,
+    0x60, 0xEF, 0x3F, 0xC0, 0x29, 0x0B, 0x03, 0x4B, 0x10, 0xAA, 0x18, 0x58, 0x82, 0x84, 0x84, 0x04,
+    0x03, 0x8F, 0x2A, 0xA0, 0xA8, 0x8D, 0x7D, 0x39, 0x37, 0x79, 0xAD, 0x54, 0xF5, 0x43, 0x50, 0x2A,
+    0xFC, 0x6C, 0x3D, 0xC7, 0xB9, 0xF6, 0xBD, 0xE7, 0xDC, 0xE3, 0x1B, 0x60, 0xBD, 0x04, 0xB2, 0x11,
+    0x88, 0x03, 0x00, 0x57, 0x03, 0x79, 0x0B, 0x98, 0x0D, 0x4C, 0x2D, 0x91, 0xFD, 0x12, 0x4E, 0xA4,
+    0x4E, 0x45, 0x04, 0xEE, 0xAB, 0xF4, 0xE9, 0x68, 0xA4, 0x71, 0x4D, 0x3A, 0xA6, 0x23, 0xDC, 0xE1,
+    0x44, 0x6A, 0xB7, 0xEB, 0x96, 0xB4, 0xF1, 0x34, 0x0E, 0xE0, 0xA4, 0x83, 0xDB, 0x91, 0x72, 0x65,
+    0x65, 0xBB, 0x74, 0x8C, 0xA4, 0x74, 0x4D, 0xA6, 0xCF, 0x55, 0xE7, 0x9A, 0x58, 0x38, 0xA1, 0xD7,
+    0xC5, 0x26, 0xF2, 0x01, 0xB6, 0x85, 0x94, 0xF1, 0xB8, 0xF2, 0x1A, 0xD2, 0x41, 0x8A, 0x41, 0x5C,
+    0x2F, 0xD2, 0x4B, 0x0F, 0x69, 0x78, 0xFC, 0x79, 0xBD, 0x92, 0x97, 0xEA, 0x71, 0xD0, 0x38, 0x97,
+    0x69, 0xD8, 0x56, 0x47, 0xF9, 0xB1, 0xF0, 0x74, 0x92, 0x0D, 0xA9, 0xDF, 0x12, 0xB5, 0x69, 0xE7,
+    0xF0, 0x34, 0xCE, 0x31, 0xEF, 0x57, 0x56, 0x44, 0xEF, 0x9A, 0xA2, 0x57, 0x2C, 0x7C, 0x4E, 0x02,
+    0x27, 0x76, 0xE9, 0x1A, 0xF5, 0x7E, 0xD4, 0x9C, 0x32, 0xB5, 0xE4, 0xC4, 0x73, 0xE4, 0xFA, 0x62,
+    0x66, 0xC9, 0x3E, 0x0E, 0xF6, 0x6D, 0xB0, 0xDF, 0xBD, 0x15, 0x6F, 0x3D, 0xF7, 0xC1, 0x76, 0xE7,
+    0xF5, 0xB9, 0xE5, 0x9D, 0x9E, 0x51, 0xD4, 0xB0, 0xC0, 0x3A, 0xB0, 0x28, 0x89, 0x3E, 0xF0, 0x17,
+    0x8F, 0x55, 0x8D, 0x4C, 0xE8, 0xC7, 0x32, 0x2B, 0xE6, 0xC1, 0x7F, 0x49, 0xC4, 0x1A, 0x16, 0x59,
+    0x97, 0xBF, 0x0B, 0x45, 0x9B, 0x4B, 0x1B, 0x71, 0xD3, 0xFA, 0x61, 0x2A, 0x88, 0x2C, 0x3B, 0x90,
+    0xBB, 0xA4, 0x8D, 0xB9, 0x20, 0xB4, 0x6C, 0x98, 0x94, 0x42, 0xDE, 0x89, 0xE4, 0xB4, 0x07, 0x80,
+    0x21, 0xCF, 0x86, 0x11, 0x1F, 0xAB, 0x92, 0xD0, 0x26, 0x08, 0xA9, 0x74, 0x8C, 0xE7, 0x13, 0x63,
+    0xB3, 0xFB, 0xEE, 0x8D, 0xC7, 0x5A, 0xD5, 0x20, 0x19, 0x27, 0xDB, 0x98, 0x1E, 0x33, 0x0E, 0x2B,
+    0x2D, 0xD3, 0xC9, 0x94, 0x92, 0x61, 0xD7, 0x21, 0x12, 0xD2, 0xB4, 0xCF, 0x3F, 0xF7, 0x54, 0x3E,
+    0x8A, 0x8C, 0xC4, 0x1F, 0x89, 0x94, 0x58, 0xC3, 0x44, 0x8C, 0xD1, 0xFC, 0x97, 0x53, 0x9F, 0x28,
+    0x64, 0xBB, 0x2E, 0x9F, 0x0B, 0x91, 0x5C, 0xE4, 0xC9, 0x60, 0x5E, 0xD3, 0xBB, 0xEB, 0x79, 0x6E,
+    0x6B, 0xB8, 0x29, 0xA5, 0x40, 0x0A, 0xDA, 0x55, 0x2D, 0xB2, 0x5F, 0x6D, 0xE2, 0x79, 0x16, 0x2D,
+    0xEF, 0x93, 0x24, 0x55, 0x1D, 0x2F, 0x41, 0x2A, 0x3C, 0x90, 0xA4, 0x3C, 0xEF, 0xF2, 0xD6, 0xD6,
+    0x1B, 0xD8, 0xBC, 0xFC, 0x98, 0x49, 0x8C, 0x5B, 0xD2, 0x58, 0x9D, 0x54, 0x65, 0x58, 0xCC, 0xCC,
+    0x5C, 0x34, 0xE6, 0x4B, 0x0D, 0x8F, 0x22, 0x8C, 0x07, 0xBE, 0x52, 0xD9, 0xC1, 0x6C, 0x2D, 0x91,
+    0xD3, 0x89, 0x4C, 0x89, 0x33, 0x2E, 0xDC, 0x11, 0xF9, 0xC1, 0x1B, 0xE6, 0xEA, 0x1B, 0x45, 0x47,
+    0xA7, 0x24, 0xDC, 0x23, 0xA7, 0x1E, 0x9C, 0xD4, 0x11, 0x95, 0x9A, 0xF0, 0x6C, 0x79, 0x84, 0x8A,
+    0x07, 0xEE, 0xF1, 0xD2, 0x56, 0x74, 0x5B, 0x90, 0xD0, 0x8E, 0x5B, 0x79, 0x63, 0x5A, 0x3C, 0xEB,
+    0x55, 0xCB, 0x14, 0xC4, 0x02, 0xE6, 0xB6, 0x8F, 0xC6, 0x64, 0x90, 0x92, 0x3A, 0x83, 0x1B, 0x0E,
+    0xF5, 0x7D, 0xA9, 0x3C, 0x9F, 0x21, 0xE6, 0x0B, 0xF2, 0x5C, 0xC9, 0xB4, 0x49, 0x3E, 0x70, 0xFC,
+    0xE4, 0x98, 0x80, 0xCC, 0x4A, 0x67, 0x34, 0xD3, 0x7D, 0xBE, 0xE0, 0x02, 0x7A, 0x8E, 0x57, 0xE4,
+    0x38, 0x9D, 0x26, 0xC0, 0x55, 0xDE, 0xFC, 0x58, 0x2B, 0x8E, 0x96, 0x61, 0x02, 0x61, 0x45, 0x1C,
+    0x11, 0x8D, 0x64, 0x27, 0x58, 0x09, 0x95, 0x84, 0xEB, 0x7E, 0x93, 0xAC, 0x9C, 0xEC, 0xAC, 0x9D,
+    0xB1, 0xDC, 0x8B, 0x25, 0x18, 0xC6, 0x5C, 0x05, 0x24, 0xAD, 0xB2, 0x7F, 0x65, 0xD4, 0x53, 0x6F,
+    0x06, 0x25, 0xDF, 0x76, 0x46, 0x25, 0x1D, 0x8C, 0x47, 0xB6, 0xA7, 0x57, 0x96, 0x23, 0x97, 0xA3,
+    0xFA, 0x62, 0x14, 0x98, 0x22, 0x7D, 0xB8, 0x42, 0xBA, 0xFC, 0x17, 0x60, 0xC7, 0x16, 0x56, 0xD5,
+    0x8E, 0x1F, 0x95, 0x74, 0x89, 0x8D, 0xB8, 0x27, 0x2A, 0xDE, 0x32, 0xDC, 0x42, 0x41, 0xA0, 0x05,
+    0x99, 0x27, 0x34, 0x86, 0x22, 0xB5, 0x71, 0xBB, 0xE5, 0x24, 0x40, 0x4D, 0xBC, 0x61, 0x6C, 0xA0,
+    0x08, 0x8E, 0x2F, 0x58, 0x2E, 0x64, 0x7E, 0x8D, 0x60, 0xB5, 0xB2, 0xD0, 0x43, 0xC2, 0xEC, 0x52,
+    0x55, 0x27, 0x92, 0xE4, 0x4F, 0x0D, 0xCC, 0x68, 0xF6, 0x68, 0xAA, 0xEE, 0x9A, 0x68, 0x3B, 0xBC,
+    0xF8, 0x93, 0x24, 0x9D, 0x9B, 0x07, 0x2B, 0xE3, 0xDC, 0x4F, 0xCF, 0x83, 0x59, 0x55, 0xBE, 0x3E,
+    0xA3, 0x50, 0x0F, 0xF4, 0xEA, 0x7B, 0xA4, 0x3B, 0x3C, 0xFE, 0x1A, 0xE6, 0x37, 0x09, 0x8B, 0xA4,
+    0xE7, 0x67, 0xC6, 0x7E, 0xE3, 0xCE, 0xF0, 0xD7, 0x93, 0x2F, 0x3A, 0xA1, 0x6A, 0xAB, 0xF7, 0xC2,
+    0x22, 0x5E, 0x84, 0x2D, 0xA9, 0x35, 0x77, 0xB1, 0xE2, 0x4C, 0xC4, 0x1F, 0x7D, 0xA1, 0xCE, 0x6E,
+    0xBF, 0x01, 0xBD, 0x55, 0x31, 0x92, 0xDD, 0x44, 0x10, 0x7D, 0x92, 0xFC, 0x4B, 0x81, 0x82, 0x21,
+    0xF0, 0xC6, 0x73, 0x04, 0x5D, 0x00, 0x90, 0x5C, 0x1C, 0x80, 0x0D, 0xF6, 0x47, 0x04, 0xCE, 0x09,
+    0xE0, 0x02, 0x50, 0xA3, 0x2A, 0x0E, 0xB0, 0x44, 0x1C, 0xE2, 0x27, 0x3E, 0x81, 0x19, 0xF1, 0x37,
+    0x20, 0x20, 0x40, 0xE0, 0x90, 0xC0, 0x4A, 0x5C, 0x0E, 0x08, 0xFE, 0x60, 0x54, 0x65, 0x99, 0x3F,
+    0x9A, 0xE6, 0xB5, 0xB4, 0x26, 0xA0, 0x6C, 0xAA, 0xC0, 0xD4, 0xAA, 0x34, 0xAB, 0x99, 0x9E, 0x9D,
+    0x37, 0xDD, 0xFD, 0xBA, 0xDF, 0x07, 0x80, 0x72, 0x32, 0xAD, 0x4B, 0x8F, 0x0B, 0x91, 0x60, 0x72,
+    0xC1, 0x7D, 0xB4, 0x34, 0xA2, 0x19, 0xF2, 0x24, 0x6D, 0x25, 0x0B, 0x6A, 0x99, 0xE0, 0x65, 0xC8,
+    0xE5, 0x0D, 0xCB, 0x84, 0x46, 0x62, 0x26, 0xA7, 0x57, 0x9F, 0x8B, 0x13, 0x89, 0x5E, 0x9E, 0x06,
+    0x1F, 0xEB, 0xFE, 0x1E, 0x01, 0x3E, 0x3D, 0x7C, 0x0D, 0x23, 0x02, 0x10, 0x17, 0xBB, 0xFD, 0x5E,
+    0x41, 0x51, 0xCE, 0xC8, 0x17, 0xDF, 0xA3, 0xF9, 0x35, 0xA2, 0x48, 0xFF, 0x7A, 0xF2, 0x5C, 0x27,
+    0x6E, 0x80, 0x7B, 0x22, 0x30, 0xB1, 0x4E, 0x9F, 0x48, 0x27, 0x84, 0xA7, 0xEB, 0x11, 0x25, 0x7D,
+    0x03, 0x2E, 0x81, 0xFC, 0x70, 0x80, 0xE5, 0xC2, 0xD1, 0xD1, 0xFD, 0x5E, 0x83, 0x29, 0xE8, 0xF5,
+    0xE9, 0xED, 0x41, 0xBC, 0x5E, 0x8E, 0xC4, 0xE9, 0x6D, 0x92, 0x6F, 0xE4, 0x25, 0x51, 0x7F, 0x90,
+    0x45, 0x2A, 0x39, 0xC6, 0x35, 0x1D, 0x97, 0xB8, 0x82, 0x69, 0x4D, 0x07, 0x21, 0x4E, 0xC9, 0xB0,
+    0x19, 0x1A, 0xED, 0x3B, 0xDC, 0x59, 0x54, 0xBB, 0x36, 0x6B, 0x6B, 0xD4, 0x70, 0xA7, 0x48, 0x57,
+    0x7B, 0xF8, 0xF9, 0xF5, 0xF5, 0xEF, 0xCC, 0x54, 0x46, 0x78, 0xC8, 0x00, 0xD4, 0x9E, 0xB9, 0x1A,
+    0x02, 0xF0, 0x81, 0x61, 0x1A, 0xCF, 0x9C, 0x54, 0x91, 0x5B, 0xF7, 0xEE, 0x2E, 0x4A, 0x86, 0x49,
+    0x57, 0x7A, 0x98, 0x53, 0x8F, 0xF7, 0x2D, 0x10, 0xBE, 0x40, 0x71, 0x1E, 0x51, 0xB0, 0x8C, 0xB6,
+    0xB2, 0x7C, 0x77, 0x2A, 0x2F, 0x1E, 0x5C, 0xA1, 0x8C, 0x9E, 0x54, 0xDA, 0x11, 0xF5, 0xCD, 0x8C,
+    0x72, 0x7C, 0x0C, 0xDC, 0xBF, 0x43, 0x2A, 0xB1, 0xBF, 0x68, 0xCD, 0x2C, 0x70, 0xD7, 0x53, 0x31,
+    0x39, 0x34, 0x1F, 0x05, 0x5C, 0xFE, 0x3F, 0x54, 0xBA, 0x0E, 0xF5, 0x2F, 0xFF, 0xC9, 0xF1, 0x75,
+    0xE2, 0x34, 0x82, 0x05, 0xE5, 0xD2, 0x04, 0xC8, 0x51, 0x9E, 0xF9, 0x99, 0x0D, 0x2C, 0xBC, 0x8D,
+    0x8C, 0x38, 0x76, 0x31, 0x76, 0x5A, 0x0E, 0xB6, 0x63, 0x71, 0x04, 0xF5, 0x96, 0x23, 0x4F, 0x5C,
+    0x59, 0x35, 0xBB, 0x8E, 0xBE, 0x9D, 0xFF, 0xD9, 0x73, 0x5D, 0xCE, 0x2A, 0x08, 0xA5, 0xF8, 0x67,
+    0x7E, 0x21, 0xF8, 0x0B, 0x11, 0x77, 0x94, 0xE0, 0xF1, 0x5E, 0xC9, 0x02, 0xFC, 0x90, 0x04, 0x13,
+    0xD9, 0xF4, 0x04, 0x27, 0xA6, 0xE3, 0xFC, 0x33, 0xE5, 0x6C, 0x13, 0x0F, 0xA8, 0x0B, 0x7C, 0x7C,
+    0xDA, 0x3E, 0x0F, 0x07, 0xFD, 0xB8, 0x07, 0x9A, 0x56, 0x5C, 0xAC, 0xA5, 0xB3, 0x3D, 0xF9, 0x82,
+    0x82, 0xF1, 0x90, 0xE4, 0x4C, 0xF8, 0xDA, 0x00, 0xCF, 0xF7, 0xAB, 0xA8, 0xA0, 0xCD, 0x20, 0x2D,
+    0x7B, 0xD7, 0x84, 0x7A, 0x2C, 0x65, 0x2C, 0x63, 0x19, 0xF3, 0xC4, 0x17, 0x82, 0xE4, 0x21, 0x6D,
+    0x33, 0x34, 0x0F, 0x87, 0xA6, 0xAF, 0x66, 0xFB, 0x64, 0xB6, 0x21, 0x93, 0x2A, 0x48, 0x35, 0xA3,
+    0xB9, 0x89, 0xF5, 0xCD, 0x02, 0x13, 0x52, 0x39, 0x09, 0xE1, 0x5D, 0x9B, 0x1A, 0xA6, 0xE4, 0x51,
+    0xDF, 0x3C, 0x1D, 0xA9, 0x04, 0x63, 0x75, 0x9E, 0x58, 0xA3, 0x53, 0x46, 0x96, 0xE1, 0x79, 0x07,
+    0xCB, 0xD5, 0xB2, 0x00, 0xA4, 0xA3, 0xB5, 0xCB, 0xB5, 0xB5, 0x38, 0x34, 0x1A, 0xEC, 0xAE, 0xD6,
+    0x2A, 0x96, 0x55, 0x96, 0xD6, 0x78, 0x8A, 0xA8, 0xC5, 0x5D, 0xCC, 0x95, 0x2E, 0xAE, 0x28, 0xBF,
+    0xB7, 0x31, 0x90, 0xE5, 0xC0, 0x9B, 0x7A, 0xB3, 0x40, 0x3E, 0x0E, 0x95, 0x74, 0xCD, 0x31, 0xF1,
+    0x84, 0x1D, 0x5D, 0xBF, 0x44, 0x33, 0x99, 0xE0, 0x9A, 0x22, 0x16, 0x4B, 0x7D, 0xFD, 0x93, 0xC0,
+    0x5F, 0xFF, 0x3C, 0xFB, 0xCE, 0xFE, 0x4E, 0xDB, 0x50, 0xC4, 0x68, 0x7E, 0x24, 0x7F, 0xAE, 0x78,
+    0x39, 0xC3, 0x9E, 0xBA, 0x6F, 0x99, 0x0C, 0x19, 0xAC, 0x0A, 0x31, 0xEB, 0xB0, 0x47, 0x1D, 0x21,
+    0x23, 0xCA, 0x84, 0x9A, 0x17, 0x66, 0xEA, 0x0E, 0x2D, 0xC8, 0xC9, 0x0B, 0xEC, 0xF3, 0x19, 0xD9,
+    0x52, 0xF0, 0x4F, 0xBB, 0x6A, 0x02, 0xF4, 0x7F, 0xAA, 0xE8, 0x46, 0x34, 0xA3, 0xF4, 0xFC, 0x6D,
+    0x60, 0xDE, 0x26, 0x7E, 0x7C, 0x5F, 0x2C, 0x6C, 0xC4, 0x2A, 0x72, 0xDB, 0x4C, 0x8C, 0xA5, 0x3E,
+    0x13, 0xA2, 0x21, 0x38, 0x5C, 0xBA, 0xE5, 0x89, 0x99, 0x5F, 0xBB, 0x95, 0x6C, 0x4E, 0x6B, 0x65,
+    0xAB, 0xBD, 0x7D, 0xA3, 0x69, 0xC7, 0xBB, 0x4A, 0xD1, 0x11, 0x98, 0x07, 0xE1, 0x30, 0xE3, 0xAA,
+    0xB8, 0x9A, 0x97, 0xC4, 0x13, 0xAE, 0xCF, 0x84, 0x47, 0xFC, 0x91, 0xB5, 0x48, 0x72, 0x6C, 0x30,
+    0x53, 0x35, 0x67, 0x42, 0x8E, 0x9B, 0xEF, 0x04, 0xD5, 0xE4, 0x5B, 0x28, 0x1F, 0x4A, 0x46, 0x49,
+    0x26, 0xA0, 0x34, 0xD4, 0x09, 0x9B, 0x6C, 0xA8, 0x57, 0x7A, 0x95, 0xD5, 0xC2, 0x62, 0x77, 0x3F,
+    0xE2, 0xA6, 0x0A, 0x78, 0xA3, 0x22, 0xFE, 0x4A, 0xEF, 0xF8, 0xB2, 0xA0, 0xC2, 0xB0, 0x81, 0xC8,
+    0x2F, 0x05, 0xD0, 0xB6, 0x33, 0xFE, 0x7A, 0xA8, 0x7F, 0xB9, 0xD8, 0x99, 0x07, 0xD9, 0x12, 0xBE,
+    0x67, 0x76, 0x17, 0x7E, 0x18, 0xB6, 0xB4, 0xD2, 0xE6, 0xC2, 0xED, 0x62, 0x21, 0x78, 0x95, 0x44,
+    0x7F, 0x11, 0x82, 0xD2, 0xDE, 0x6D, 0xB5, 0x0B, 0x66, 0xED, 0xAD, 0x11, 0xFF, 0xCD, 0x84, 0x0B,
+    0x66, 0xA0, 0x9E, 0x36, 0x1F, 0x57, 0x3F, 0x79, 0x36, 0xBB, 0x2D, 0x67, 0x36, 0x49, 0x64, 0x07,
+    0x8A, 0xB6, 0xE2, 0x0D, 0x07, 0xB7, 0xE8, 0xCB, 0xCA, 0x1E, 0xC3, 0xA1, 0xCA, 0x6C, 0x2A, 0x5D,
+    0x2E, 0x6B, 0xB2, 0xE8, 0xAE, 0xE6, 0x5E, 0x55, 0xB4, 0xDB, 0x62, 0xA7, 0x1A, 0x91, 0x3E, 0x8E,
+    0x3F, 0x0E, 0x07, 0xCB, 0xF3, 0xDF, 0x73, 0xFC, 0xA6, 0xA0, 0x0A, 0xFE, 0x27, 0xB5, 0x55, 0x41,
+    0x68, 0x1B, 0x47, 0x14, 0xFD, 0xB3, 0x6B, 0x79, 0x43, 0xB7, 0xF6, 0x9A, 0x22, 0x85, 0x86, 0x82,
+    0x27, 0x87, 0x1E, 0x8C, 0x92, 0x74, 0x7D, 0xE8, 0x21, 0x01, 0xC9, 0x33, 0xA1, 0xD0, 0x1E, 0x74,
+    0xB0, 0x0E, 0x52, 0x2F, 0x81, 0x44, 0xD7, 0x9A, 0xD2, 0xFA, 0x98, 0x83, 0xAC, 0xDD, 0x3A, 0x85,
+    0x1C, 0x9B, 0x4B, 0xE9, 0xA9, 0x24, 0x47, 0x59, 0xA5, 0xA5, 0x87, 0x16, 0x9C, 0x62, 0x6B, 0xD7,
+    0x76, 0xC1, 0x90, 0x5E, 0xB6, 0x31, 0x44, 0xD0, 0x5C, 0x96, 0x52, 0x4A, 0xC0, 0x97, 0x4D, 0xD8,
+    0xD2, 0x69, 0x32, 0xBB, 0xD3, 0x3F, 0x2B, 0xC7, 0xD8, 0x4E, 0x0B, 0x25, 0xD0, 0xD1, 0xCE, 0xEE,
+    0x9F, 0x3F, 0x33, 0x7F, 0xFE, 0x7F, 0xFF, 0xFD, 0x11, 0x40, 0x9B, 0x03, 0x15, 0x60, 0x66, 0x00,
+    0x8A, 0x03, 0x0B, 0x81, 0x34, 0x01, 0x9B, 0xA1, 0x94, 0x74, 0x95, 0xDA, 0xC6, 0x4F, 0xA5, 0xAD,
+    0x42, 0x70, 0x13, 0xB0, 0xF4, 0x12, 0x1F, 0x58, 0x02, 0xB6, 0x04, 0xA2, 0x17, 0xC7, 0x63, 0xE9,
+    0xF3, 0x16, 0x53, 0x6A, 0x4F, 0xA9, 0x0C, 0x3F, 0x91, 0xDE, 0x0C, 0x24, 0xC7, 0x57, 0x10, 0x82,
+    0xDE, 0x06, 0x66, 0x0A, 0x87, 0x4D, 0xA1, 0x3D, 0x5C, 0xA5, 0x1C, 0xEC, 0x3B, 0xD8, 0x63, 0xD0,
+    0xF6, 0x8A, 0x65, 0x8E, 0xC0, 0x2E, 0x41, 0x9B, 0x2C, 0x8E, 0x32, 0x73, 0xED, 0x05, 0x14, 0x27,
+    0xE9, 0x73, 0x01, 0xBD, 0x00, 0x0F, 0xED, 0x33, 0xBD, 0xE9, 0xE9, 0x60, 0x40, 0x71, 0xFF, 0x2E,
+    0xF6, 0xC7, 0xDA, 0x68, 0xE1, 0xB3, 0x2C, 0x26, 0xF5, 0x46, 0x37, 0x3C, 0x38, 0xF0, 0xA5, 0xE3,
+    0x40, 0x18, 0x5A, 0x90, 0x63, 0x20, 0xCE, 0x13, 0xB4, 0xA7, 0xB0, 0x53, 0xED, 0x4C, 0xFB, 0x7F,
+    0x8E, 0xA3, 0x04, 0x84, 0xE7, 0x24, 0xB3, 0x44, 0xC0, 0x29, 0x82, 0x19, 0x88, 0x83, 0x23, 0x5F,
+    0x3E, 0x1F, 0x65, 0x08, 0x72, 0xA6, 0x46, 0x4A, 0x06, 0x51, 0x43, 0x40, 0xE0, 0xDB, 0xFF, 0xF1,
+    0x05, 0x15, 0x8E, 0x61, 0x14, 0x03, 0x8F, 0x23, 0x1A, 0x6D, 0x74, 0x3C, 0x08, 0x3D, 0xDF, 0xE3,
+    0x25, 0xF4, 0xA7, 0x0D, 0xA6, 0xF2, 0x6D, 0x15, 0xBB, 0x0F, 0xD3, 0x80, 0x64, 0x2D, 0xA8, 0xA0,
+    0xCE, 0x8E, 0x29, 0x53, 0x43, 0x4F, 0x65, 0xEB, 0x34, 0x6D, 0x02, 0x5F, 0x1A, 0xDC, 0xC6, 0x88,
+    0xD4, 0x1F, 0xED, 0x76, 0x75, 0x30, 0xB8, 0x31, 0x06, 0x6C, 0xAB, 0xDD, 0x6E, 0x95, 0xA1, 0xB2,
+    0x00, 0x0B, 0xEC, 0x59, 0xE6, 0x28, 0x61, 0x16, 0x0E, 0x82, 0x29, 0xBD, 0x51, 0xE6, 0xFA, 0xE0,
+    0x92, 0x94, 0xED, 0x48, 0x76, 0x43, 0x52, 0x92, 0x6A, 0x44, 0x99, 0x7C, 0x4D, 0x82, 0xB4, 0x85,
+    0x13, 0x4D, 0xFA, 0x25, 0xCE, 0xD2, 0xA1, 0x4C, 0xEB, 0x69, 0xBD, 0x27, 0xDD, 0x94, 0x70, 0xD2,
+    0xAA, 0x70, 0xEF, 0x27, 0xE1, 0x3C, 0xCE, 0x0D, 0xC9, 0xFC, 0x9E, 0x1D, 0x11, 0xAE, 0x53, 0x56,
+    0xA1, 0x91, 0xBB, 0x9D, 0xB1, 0xD0, 0x55, 0xA1, 0x36, 0x5E, 0x69, 0x42, 0x79, 0x05, 0xDB, 0x07,
+    0xAD, 0x8A, 0x64, 0xE3, 0x5F, 0xBF, 0x5A, 0x29, 0x35, 0x31, 0xAB, 0x24, 0x73, 0x43, 0xBA, 0x2D,
+    0x88, 0x70, 0x79, 0x89, 0x70, 0xE8, 0x22, 0x9A, 0x50, 0xCE, 0xCB, 0xF5, 0xB9, 0xAE, 0x7B, 0x59,
+    0x38, 0x2A, 0xB1, 0x10, 0xE6, 0xB2, 0x8E, 0xD4, 0xC2, 0x30, 0x95, 0x60, 0x03, 0xD9, 0x85, 0x7A,
+    0x19, 0xCA, 0x56, 0x9C, 0xD3, 0xFB, 0x92, 0xED, 0x8A, 0xE0, 0x93, 0x26, 0xFD, 0x35, 0xD7, 0x0E,
+    0xBF, 0x97, 0x0C, 0x09, 0x0F, 0x1A, 0x02, 0x65, 0x1A, 0x66, 0x76, 0x5C, 0x3E, 0xAA, 0x2F, 0x70,
+    0x44, 0xB0, 0x52, 0xF0, 0x30, 0xB9, 0x58, 0x6F, 0x54, 0x60, 0xB5, 0x29, 0xEE, 0x86, 0x45, 0xA9,
+    0xCD, 0x9E, 0xDE, 0xCF, 0xDF, 0x8F, 0x67, 0x81, 0x83, 0xCD, 0xEF, 0x36, 0xF2, 0xBB, 0x57, 0xF8,
+    0x8C, 0x2E, 0x9E, 0x7C, 0xE9, 0x1B, 0x98, 0x3D, 0xFC, 0x61, 0x7D, 0x5A, 0x88, 0x83, 0x97, 0x04,
+    0xD1, 0x10, 0x67, 0x4B, 0x6C, 0x33, 0x5D, 0xF7, 0x66, 0x0D, 0xDF, 0x0C, 0xCD, 0xF0, 0xDC, 0x23,
+    0x86, 0x54, 0xAB, 0xF6, 0x99, 0xD4, 0x23, 0xB3, 0x60, 0xBE, 0xFE, 0x32, 0x79, 0xEE, 0x91, 0x19,
+    0x1A, 0x7E, 0xB5, 0xAF, 0x90, 0x96, 0xA4, 0x6F, 0x27, 0x6E, 0x18, 0x18, 0x92, 0xFE, 0xA9, 0x6E,
+    0x4B, 0xCF, 0x5F, 0x33, 0x85, 0x13, 0x33, 0x3F, 0x37, 0x33, 0x5B, 0x2D, 0x66, 0x34, 0xC5, 0xEA,
+    0x61, 0x7B, 0x88, 0xC8, 0xB1, 0x1C, 0x9C, 0xC4, 0x1C, 0x8C, 0x8C, 0xED, 0xA4, 0x8C, 0x70, 0x2B,
+    0x74, 0xE2, 0x49, 0x09, 0xD9, 0x69, 0xE9, 0x49, 0x16, 0x13, 0x10, 0x0B, 0x76, 0x88, 0xF9, 0xF4,
+    0x92, 0x1F, 0xC6, 0x68, 0x57, 0x07, 0x7D, 0xA6, 0x64, 0x0D, 0x6A, 0x17, 0xE1, 0x3C, 0x3E, 0x65,
+    0x0D, 0x24, 0x2C, 0xD7, 0xA6, 0x2E, 0x0D, 0xBB, 0x74, 0x5F, 0xDF, 0x07, 0x2D, 0x28, 0x61, 0xA2,
+    0xB6, 0x72, 0x9D, 0xA8, 0xE8, 0x20, 0x51, 0x47, 0x49, 0xE5, 0x15, 0xA4, 0x42, 0xAA, 0xAC, 0xC0,
+    0x0A, 0xDB, 0x97, 0x54, 0xA5, 0xD6, 0x98, 0x2A, 0x2F, 0xA4, 0xE3, 0x80, 0x78, 0xF9, 0x30, 0x50,
+    0x52, 0x20, 0xF1, 0xC8, 0x11, 0xE2, 0x61, 0xBB, 0x86, 0xD2, 0x60, 0x30, 0xB8, 0x83, 0x22, 0xF2,
+    0xEF, 0x17, 0x94, 0x34, 0x7B, 0x8B, 0xC1, 0x83, 0xF1, 0xC0, 0xC8, 0xCC, 0x1D, 0xF5, 0x0C, 0xAB,
+    0x2F, 0xDD, 0xA0, 0x62, 0x02, 0x66, 0xE0, 0x38, 0x5D, 0x0B, 0x2B, 0x57, 0xB4, 0xC1, 0x3C, 0xD0,
+    0xEF, 0xDF, 0xD1, 0xDA, 0x60, 0xAD, 0xB8, 0x05, 0x96, 0xC1, 0x14, 0xE0, 0x4A, 0xA2, 0x22, 0x27,
+    0x07, 0x96, 0x02, 0xE5, 0x30, 0xF1, 0xFC, 0xA6, 0xC3, 0x94, 0xE0, 0xD0, 0x44, 0xE4, 0x17, 0xD0,
+    0xC1, 0xE8, 0xB9, 0xC2, 0x18, 0x2B, 0xAC, 0x03, 0x85, 0x7F, 0x42, 0xE1, 0x8C, 0x15, 0xEC, 0xA4,
+    0xA2, 0x8A, 0x16, 0x9B, 0xB2, 0x47, 0xDF, 0xCA, 0xBE, 0x7B, 0x13, 0x5E, 0x1F, 0x83, 0x5A, 0x6F,
+    0x77, 0x99, 0xBE, 0x0D, 0x5A, 0x9A, 0x2E, 0x2A, 0xFF, 0xBE, 0x7D, 0xF5, 0x5B, 0x98, 0xC6, 0x07,
+    0xE5, 0xA5, 0xC2, 0x41, 0x44, 0xFA, 0x52, 0xEF, 0x43, 0x44, 0x1D, 0xE5, 0x99, 0xC6, 0x55, 0xB6,
+    0x9D, 0x7A, 0x0F, 0xA7, 0x51, 0x76, 0xD7, 0xD3, 0xEE, 0x05, 0xE7, 0x23, 0x01, 0xFF, 0x80, 0x89,
+    0x1E, 0x8C, 0x0B, 0x3F, 0xB4, 0x04, 0x30, 0xFF, 0x85, 0xC2, 0x47, 0xBC, 0xFE, 0xB2, 0x0E, 0xF1,
+    0x4A, 0xCB, 0x88, 0xD7, 0x92, 0x2D, 0x3F, 0x0E, 0x25, 0xE5, 0x18, 0xDD, 0x1A, 0x58, 0x3F, 0xAB,
+    0x6B, 0xEF, 0xC8, 0xE0, 0xB3, 0x44, 0xE9, 0x62, 0x58, 0x8C, 0x56, 0x8A, 0x3F, 0x94, 0x0A, 0x64,
+    0x66, 0xEA, 0x08, 0x96, 0x78, 0x9A, 0x9E, 0x16, 0xDE, 0x4D, 0xBD, 0xC1, 0x57, 0x23, 0x1F, 0x2E,
+    0x5C, 0x07, 0xE3, 0x01, 0x87, 0x33, 0xFF, 0xE2, 0xC9, 0xB1, 0xA2, 0x6D, 0xE4, 0x4B, 0xF1, 0x34,
+    0xC4, 0x3A, 0x02, 0xB2, 0x38, 0x41, 0xB3, 0x1A, 0x46, 0x7F, 0x31, 0x48, 0x66, 0x62, 0xAE, 0xBD,
+    0x42, 0x1E, 0x60, 0x65, 0x04, 0x00, 0x2B, 0x88, 0x76, 0xCD, 0xCD, 0x37, 0x98, 0x12, 0xD7, 0xDF,
+    0x48, 0x60, 0xAE, 0xD0, 0xE3, 0x33, 0xA7, 0x57, 0xD9, 0x69, 0x0D, 0xB9, 0x53, 0x73, 0x13, 0xAC,
+    0x31, 0xFB, 0xB7, 0x1A, 0x55, 0xA2, 0xEE, 0x26, 0x65, 0x24, 0xF6, 0x65, 0xB0, 0x56, 0x23, 0x9C,
+    0x72, 0xF6, 0x13, 0x63, 0xD5, 0x2F, 0xE2, 0xBC, 0xE3, 0xAE, 0x0A, 0x07, 0x12, 0x07, 0xBC, 0x90,
+    0x85, 0x6C, 0x24, 0x4D, 0x69, 0x66, 0xCB, 0x7A, 0x62, 0x84, 0xB9, 0x80, 0xA9, 0x0E, 0xDC, 0x9B,
+    0x87, 0x5B, 0xF0, 0x29, 0x39, 0x0B, 0xF0, 0x2A, 0x98, 0x00, 0x93, 0x58, 0x97, 0xD0, 0xE9, 0xE0,
+    0xC6, 0x2F, 0xF4, 0xAA, 0xA9, 0x65, 0xCC, 0xE0, 0xFC, 0x08, 0x09, 0x41, 0xA6, 0x96, 0x51, 0xDB,
+    0x8C, 0x70, 0xC1, 0x2B, 0x00, 0xA7, 0xC0, 0xC0, 0xD9, 0x1F, 0xC9, 0x3C, 0x9C, 0x25, 0xF7, 0xDE,
+    0x86, 0x9B, 0x85, 0xB1, 0xB1, 0xDD, 0xBE, 0xD1, 0x37, 0xBE, 0xF6, 0x42, 0x2F, 0x62, 0x11, 0x4C,
+    0x72, 0xC6, 0x37, 0xE9, 0x28, 0x6E, 0x02, 0xB1, 0x77, 0x9F, 0x24, 0x5D, 0x67, 0x2B, 0x01, 0x32,
+    0xE4, 0xB6, 0x4A, 0xE8, 0xBE, 0x58, 0x80, 0x8D, 0x5A, 0xAF, 0x86, 0xF7, 0x95, 0x0E, 0x0C, 0x4F,
+    0x30, 0x4F, 0x79, 0xF7, 0x05, 0xDB, 0xFD, 0x12, 0x2F, 0x91, 0x5B, 0x9B, 0x3D, 0x2B, 0xA6, 0xE1,
+    0x99, 0x8E, 0x15, 0xDB, 0xD1, 0xA6, 0xF7, 0x2E, 0x74, 0xA0, 0xD9, 0x33, 0x12, 0x7B, 0x2F, 0xB5,
+    0x47, 0x5D, 0xD6, 0x38, 0xDF, 0x99, 0x9E, 0x9E, 0xA1, 0x56, 0xD2, 0xA5, 0xF4, 0xA6, 0x0E, 0xF3,
+    0x6F, 0x9D, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0x7E, 0x7B, 0x13, 0x7B, 0x85, 0x57, 0xCA, 0x80,
+    0x64, 0x8B, 0x48, 0x88, 0xDB, 0x5F, 0x60, 0x5F, 0x9B, 0xE2, 0xEC, 0xD9, 0xC0, 0x1F, 0x30, 0x92,
+    0x2D, 0xA4, 0x34, 0xA6, 0xA0, 0x0D, 0x6E, 0x83, 0xE4, 0x78, 0x2F, 0x91, 0xA8, 0x68, 0xDC, 0xD0,
+    0x23, 0x04, 0x12, 0x3A, 0x84, 0x02, 0x92, 0x45, 0x83, 0xF1, 0x2C, 0xA2, 0x70, 0x41, 0xE1, 0x55,
+    0x40, 0xBA, 0x02, 0x01, 0x8B, 0x02, 0x14, 0x4E, 0xE1, 0x0D, 0x5A, 0x47, 0xE7, 0xCB, 0xEC, 0x3E,
+    0xBE, 0x37, 0x7B, 0x36, 0x31, 0x4A, 0x81, 0xD9, 0xBB, 0x9B, 0x99, 0x7D, 0xEF, 0xCD, 0x9B, 0xF7,
+    0xBE, 0xF7, 0xBD, 0x39, 0xEA, 0x38, 0xF3, 0xB0, 0xEE, 0x65, 0xA4, 0xB2, 0x97, 0x7F, 0x34, 0x2E,
+    0x2A, 0x74, 0xF9, 0xC2, 0x5B, 0x44, 0x14, 0x3F, 0xAA, 0xDE, 0xDD, 0xBF, 0xF5, 0x45, 0xFF, 0x2A,
+    0xBE, 0xCB, 0xFB, 0x5B, 0xF1, 0xA8, 0xBA, 0xAE, 0x92, 0xF4, 0xCF, 0xCF, 0x83, 0xEC, 0xDA, 0x36,
+    0xD4, 0xF4, 0x8D, 0xC9, 0x88, 0x94, 0xD3, 0x35, 0xD1, 0x66, 0xA9, 0x18, 0x4F, 0x46, 0x29, 0x33,
+    0x5E, 0x67, 0x6D, 0x33, 0xA0, 0xFF, 0x62, 0x33, 0xC4, 0x73, 0x5F, 0xA4, 0x62, 0xFB, 0xAF, 0xB7,
+    0xF6, 0x09, 0x79, 0x92, 0xD0, 0x72, 0x0C, 0xE1, 0xD0, 0x99, 0x63, 0x4C, 0xE3, 0x2D, 0x9A, 0xB1,
+    0x9C, 0xBF, 0x08, 0xDD, 0x15, 0xFC, 0x16, 0xD6, 0x30, 0xBC, 0xC2, 0x5C, 0x51, 0x20, 0x3B, 0x93,
+    0x90, 0x3F, 0xB9, 0xC9, 0x45, 0xFC, 0x3B, 0x84, 0x95, 0x49, 0x88, 0x02, 0x37, 0x2F, 0x6E, 0xE6,
+    0xFF, 0xF1, 0xA8, 0x92, 0x75, 0x3C, 0x6F, 0x16, 0x62, 0xCE, 0x63, 0x2B, 0x63, 0xE9, 0xE5, 0x03,
+    0x19, 0x03, 0x9A, 0xD9, 0xD1, 0x8E, 0x16, 0xE3, 0xBA, 0xBF, 0xB8, 0x7C, 0x27, 0xFE, 0x19, 0x81,
+    0xDE, 0x78, 0x7A, 0x18, 0xDA, 0xA6, 0xEC, 0xFC, 0x71, 0x0F, 0x81, 0x7D, 0xF9, 0xDE, 0xE2, 0x57,
+    0x3F, 0xDD, 0xDA, 0x0D, 0x76, 0x62, 0xD7, 0x5F, 0xEA, 0x77, 0xFB, 0xDD, 0xA5, 0x3B, 0x51, 0x05,
+    0xFF, 0x33, 0xB2, 0xC6, 0x67, 0x69, 0x65, 0x3B, 0xFE, 0x05, 0x9B, 0x76, 0xEC, 0x41, 0xD6, 0xA5,
+    0xDB, 0x74, 0x7A, 0x57, 0xB2, 0x79, 0x95, 0x96, 0x66, 0xDF, 0xE9, 0x35, 0xED, 0x8E, 0x95, 0x6D,
+    0x0D, 0xB7, 0xA5, 0xCA, 0xF4, 0x35, 0x53, 0x57, 0x5F, 0x7F, 0x7B, 0x1C, 0xEE, 0x75, 0xCB, 0xDB,
+    0x2F, 0x7D, 0xF8, 0xB6, 0xE1, 0xBA, 0xBF, 0xD2, 0xED, 0x2F, 0xEA, 0xB3, 0xEF, 0xD5, 0x37, 0xDE,
+    0xDF, 0xDB, 0x8B, 0x92, 0x5D, 0x7C, 0x69, 0x2E, 0x38, 0x31, 0xBF, 0x15, 0xDD, 0xA0, 0xD0, 0xAB,
+    0xFB, 0x72, 0x9E, 0x0E, 0xEF, 0x3D, 0xC8, 0xAE, 0x97, 0x7A, 0x37, 0x70, 0xB4, 0x4C, 0xF3, 0x0B,
+    0x8B, 0x7D, 0x5D, 0x85, 0x45, 0x54, 0x76, 0xB7, 0xFA, 0x4B, 0x33, 0xAB, 0xA4, 0x70, 0x6C, 0xAF,
+    0xA4, 0x0E, 0x90, 0x8E, 0x51, 0x82, 0x55, 0x49, 0x8D, 0xB9, 0x41, 0xBA, 0x40, 0xF8, 0x11, 0xF3,
+    0x04, 0x7A, 0x9B, 0x89, 0x49, 0xE4, 0xA8, 0xC3, 0xC3, 0x4F, 0xA1, 0xE9, 0x31, 0x7F, 0xCF, 0xFC,
+    0xD7, 0x45, 0x0D, 0x5E, 0x8E, 0x86, 0x67, 0x7B, 0xB8, 0x89, 0x06, 0x7B, 0xE1, 0xD8, 0xDC, 0x6D,
+    0xE2, 0xD2, 0xBC, 0x5E, 0x9D, 0x95, 0xC8, 0x6B, 0xA6, 0xAE, 0xA7, 0x7B, 0x5A, 0x07, 0xCD, 0xF0,
+    0x23, 0x66, 0x37, 0x75, 0x7D, 0x41, 0xE3, 0x0F, 0x1D, 0x9E, 0x87, 0x33, 0x4E, 0xA5, 0xEC, 0xA1,
+    0xAF, 0xC5, 0x33, 0x4B, 0x31, 0x25, 0xBF, 0xED, 0xE2, 0xF2, 0x09, 0x0F, 0xB0, 0x64, 0x8C, 0x70,
+    0xDC, 0x60, 0x39, 0x01, 0x01, 0x7A, 0x65, 0xC0, 0x03, 0x18, 0xC0, 0x37, 0x6C, 0xD3, 0xEC, 0x7C,
+    0xC9, 0x58, 0x5E, 0xD9, 0x1C, 0x63, 0x09, 0xC7, 0x1D, 0xD6, 0x9C, 0xCB, 0x52, 0xA2, 0x0F, 0x04,
+    0x97, 0xF5, 0x84, 0xE2, 0x8A, 0x14, 0x90, 0xE2, 0x84, 0xD0, 0x06, 0x5E, 0x28, 0x01, 0xD4, 0x88,
+    0x64, 0x34, 0x9D, 0x1C, 0xC1, 0x23, 0x85, 0xFF, 0x67, 0xF2, 0x4F, 0x60, 0x1B, 0x70, 0x93, 0x5D,
+    0x04, 0x7F, 0x21, 0x1F, 0x59, 0xC5, 0x83, 0xE0, 0x35, 0x9C, 0x87, 0xE0, 0x88, 0x4C, 0x8E, 0x2A,
+    0x9D, 0xAE, 0xAF, 0x49, 0xD2, 0x42, 0xE3, 0x0C, 0x27, 0x96, 0x88, 0xC9, 0x07, 0x45, 0xC8, 0x92,
+    0x7A, 0x95, 0x44, 0x94, 0x50, 0x62, 0x9B, 0x9B, 0xA5, 0x86, 0x1F, 0x02, 0x74, 0x34, 0xCB, 0x4D,
+    0x32, 0x0D, 0x17, 0x3D, 0x90, 0xC3, 0xF7, 0x03, 0xA8, 0xCC, 0xC4, 0x1E, 0x38, 0x9A, 0x07, 0xD0,
+    0x91, 0x04, 0x51, 0x82, 0x0B, 0x05, 0x69, 0xFC, 0x0C, 0x12, 0xB7, 0x70, 0x62, 0x21, 0xB6, 0x45,
+    0x4B, 0x91, 0x53, 0x52, 0x0D, 0x7F, 0xC0, 0xBF, 0x62, 0x1F, 0x0E, 0x06, 0xA6, 0x89, 0xF4, 0x4A,
+    0x7A, 0xFC, 0xB4, 0x61, 0xFB, 0xBC, 0x41, 0xDA, 0xF9, 0xF1, 0x38, 0xDD, 0x3C, 0x78, 0xE2, 0x56,
+    0xB4, 0xEF, 0x18, 0xA4, 0x89, 0x2C, 0x2F, 0x39, 0x50, 0x2C, 0x15, 0x0A, 0x58, 0x00, 0xBA, 0xE4,
+    0xD2, 0x66, 0xAA, 0x99, 0xB3, 0x95, 0xE1, 0x8C, 0x9D, 0x62, 0x1F, 0x82, 0x61, 0x5F, 0x4D, 0x2D,
+    0x5C, 0x40, 0x7C, 0x9E, 0x18, 0xFE, 0x3E, 0x28, 0x24, 0xBC, 0x81, 0x1E, 0xCB, 0x6D, 0x56, 0x28,
+    0x51, 0x86, 0x63, 0x8F, 0x67, 0xD0, 0x90, 0x99, 0x7C, 0x0C, 0x18, 0x12, 0x2D, 0x3C, 0xEB, 0xE5,
+    0xB2, 0x29, 0x41, 0x27, 0x0B, 0xED, 0xD0, 0x34, 0xA6, 0x88, 0x6B, 0x62, 0xD2, 0x62, 0x6D, 0x70,
+    0x20, 0x08, 0xA3, 0x41, 0xA4, 0x41, 0xE4, 0x94, 0x83, 0x52, 0x35, 0x1D, 0x51, 0x82, 0xC2, 0x3C,
+    0x50, 0xFC, 0x19, 0x1F, 0xA2, 0x8A, 0xD8, 0xF9, 0xD0, 0x83, 0xCC, 0x85, 0xC7, 0x9B, 0x93, 0x20,
+    0xA1, 0x29, 0x40, 0x24, 0xD7, 0xA0, 0x4C, 0xF9, 0xA5, 0x26, 0xB9, 0x9B, 0x4E, 0xDB, 0x89, 0xF3,
+    0x76, 0xAA, 0xD2, 0xA3, 0xA1, 0x9D, 0xB0, 0xF3, 0x26, 0x51, 0xED, 0x27, 0xD5, 0x3C, 0x67, 0x6A,
+    0x75, 0x47, 0xD6, 0x5B, 0xCA, 0x3E, 0x3F, 0xE5, 0x7E, 0x6A, 0x7D, 0x92, 0xDC, 0xAA, 0x99, 0x6F,
+    0x34, 0xC1, 0xCA, 0x4D, 0x5B, 0x4C, 0x48, 0x33, 0xED, 0x33, 0xA9, 0x36, 0x9A, 0x6D, 0x7F, 0x40,
+    0x51, 0xDB, 0x66, 0x82, 0xA8, 0x15, 0xD3, 0x5E, 0xD9, 0x11, 0x30, 0x00, 0x45, 0xDB, 0x65, 0x56,
+    0xBA, 0xAD, 0x27, 0xC5, 0x89, 0x5A, 0xE5, 0x45, 0x21, 0xEE, 0xE9, 0x55, 0x71, 0x0A, 0x40, 0x62,
+    0x39, 0x43, 0xBC, 0x6B, 0x29, 0xCE, 0xC2, 0xB4, 0x3D, 0x20, 0xED, 0x95, 0x88, 0x8D, 0x6F, 0x00,
+    0x57, 0x17, 0xCA, 0xDE, 0xB8, 0x0C, 0x6B, 0x20, 0x61, 0x8A, 0x00, 0xB4, 0x44, 0xED, 0xD1, 0x0F,
+    0xF1, 0x04, 0xB5, 0x4B, 0x71, 0x7C, 0x20, 0x45, 0x0B, 0x25, 0x9A, 0xB8, 0xB4, 0x39, 0xAC, 0x18,
+    0xFC, 0x40, 0xF7, 0x87, 0x0E, 0x67, 0xC4, 0xF8, 0xA3, 0x11, 0x9E, 0x35, 0xA0, 0x4C, 0x54, 0xC3,
+    0x97, 0x76, 0x70, 0x1F, 0x8F, 0x7D, 0x0C, 0x04, 0x73, 0x0F, 0xF0, 0x74, 0x90, 0xFF, 0x88, 0xB3,
+    0x28, 0xC4, 0x4A, 0x50, 0xE3, 0x13, 0xB9, 0x7F, 0xD0, 0xF2, 0x86, 0x37, 0x00, 0x0D, 0x44, 0x5A,
+    0x44, 0xA9, 0x1D, 0xA1, 0xFA, 0x10, 0xC5, 0x3F, 0x40, 0xC4, 0xFA, 0x84, 0xC3, 0xCA, 0x8C, 0x9C,
+    0xC9, 0x78, 0xE3, 0x71, 0xAD, 0xEA, 0xF4, 0xB0, 0x84, 0x28, 0x4D, 0xCC, 0x08, 0x01, 0xF2, 0x06,
+    0xE7, 0x10, 0x21, 0x99, 0x13, 0x50, 0x13, 0x22, 0x78, 0xDD, 0xA8, 0xA5, 0x9F, 0xD7, 0xF0, 0x51,
+    0x4E, 0x8D, 0xC1, 0x44, 0xD4, 0x58, 0x0B, 0x63, 0x23, 0xE1, 0x69, 0xB0, 0x76, 0x1E, 0x44, 0xA7,
+    0x31, 0x20, 0x50, 0x09, 0xD8, 0x6C, 0xC6, 0x89, 0xAA, 0x91, 0x3E, 0xC0, 0x00, 0x26, 0x60, 0xB2,
+    0x92, 0x1E, 0x88, 0x41, 0xB3, 0x1C, 0x60, 0xA6, 0xDF, 0xA1, 0x56, 0xDC, 0xCB, 0x41, 0x67, 0x16,
+    0xDE, 0x8F, 0xC5, 0x17, 0xB2, 0xD2, 0xC2, 0x74, 0x53, 0x49, 0x0F, 0x64, 0x34, 0x77, 0xDF, 0x49,
+    0x87, 0xE0, 0x08, 0x39, 0x4B, 0xB1, 0xE4, 0xBF, 0xFA, 0xCC, 0x3F, 0x2C, 0xFD, 0x0D, 0xAD, 0x95,
+    0xBF, 0x72, 0xE4, 0x44, 0x10, 0xC6, 0x47, 0x52, 0x81, 0x02, 0x05, 0x93, 0x40, 0xAC, 0x47, 0xD0,
+    0x23, 0x8C, 0x0A, 0x1E, 0xE0, 0x2E, 0xB8, 0x88, 0xC4, 0x0F, 0x40, 0xE0, 0x47, 0x98, 0xA5, 0x08,
+    0xEF, 0x4D, 0xF6, 0x82, 0x7B, 0x84, 0x11, 0x47, 0x70, 0x01, 0xC1, 0x2D, 0x45, 0x51, 0x1B, 0x38,
+    0xB0, 0x28, 0xA0, 0xAE, 0xF0, 0x05, 0x96, 0x41, 0x66, 0x65, 0xDF, 0x68, 0x9A, 0x5F, 0xCF, 0x1A,
+    0xCE, 0x0E, 0xA0, 0x8A, 0x2A, 0x6B, 0x6B, 0xA4, 0x99, 0x6F, 0xFE, 0x74, 0xCF, 0xD7, 0x5F, 0xF7,
+    0xFA, 0xC1, 0x74, 0x6F, 0xA3, 0x29, 0x93, 0x7F, 0x84, 0x4E, 0xDA, 0xBE, 0x48, 0x5E, 0x44, 0xDE,
+    0xD2, 0x72, 0x67, 0x34, 0x6E, 0x67, 0x4C, 0xB5, 0x1A, 0xF3, 0xA1, 0xF3, 0x69, 0x4F, 0x47, 0x06,
+    0x7A, 0x32, 0xF3, 0x0A, 0x49, 0x27, 0x75, 0x6C, 0xDF, 0x33, 0x6E, 0x6E, 0x92, 0xAE, 0x73, 0x83,
+    0x29, 0xC4, 0x32, 0x0E, 0x5F, 0x89, 0xEE, 0x65, 0xDC, 0x4E, 0x8C, 0x9B, 0x58, 0x0A, 0xBB, 0xB7,
+    0x32, 0x14, 0x1C, 0xBF, 0x98, 0xC0, 0x9B, 0xDD, 0x22, 0x43, 0x3B, 0x1B, 0xBB, 0xD8, 0xC8, 0x64,
+    0xC5, 0x09, 0xFE, 0x7B, 0xE9, 0x19, 0x73, 0x6C, 0x25, 0x06, 0x4F, 0xA6, 0x07, 0x0D, 0x63, 0x0F,
+    0x9A, 0xFC, 0xA6, 0x6B, 0x76, 0xB4, 0x99, 0x16, 0xFD, 0x60, 0x57, 0x3F, 0x54, 0xDA, 0xD2, 0xF1,
+    0xDB, 0xAC, 0xFE, 0x22, 0xC4, 0xBB, 0x79, 0xD6, 0xDD, 0xE4, 0x3D, 0x18, 0x1F, 0x69, 0x4B, 0x60,
+    0x2E, 0xB0, 0x26, 0xB0, 0xF6, 0xD8, 0x9A, 0x18, 0x7E, 0x0C, 0x33, 0x73, 0xBB, 0xBB, 0xB6, 0xDC,
+    0xCD, 0x4B, 0x18, 0x4A, 0x39, 0x7E, 0x6B, 0x61, 0xDF, 0xCA, 0x5C, 0x3C, 0x9E, 0x93, 0xD4, 0x87,
+    0xBD, 0xC8, 0xFA, 0xF7, 0x67, 0x30, 0x75, 0xCC, 0x0E, 0xFE, 0xEF, 0x8F, 0x31, 0x2D, 0x07, 0x18,
+    0x75, 0x70, 0x31, 0x65, 0x8E, 0x43, 0xC3, 0x7B, 0x63, 0xBA, 0x9D, 0x92, 0x13, 0x7A, 0xBB, 0x68,
+    0x2C, 0xDC, 0x68, 0xEC, 0x64, 0x80, 0xDD, 0xA0, 0xB0, 0x18, 0x85, 0xE3, 0x07, 0x58, 0xEF, 0x6F,
+    0x8A, 0xA4, 0x30, 0xD4, 0x03, 0x13, 0x05, 0xD9, 0x80, 0x55, 0xA9, 0x08, 0xB7, 0xDB, 0x97, 0xE9,
+    0xB9, 0xE8, 0x73, 0xAA, 0x2F, 0xBD, 0x88, 0xC8, 0x9F, 0x39, 0x98, 0x67, 0x8B, 0x06, 0xF7, 0x74,
+    0xD4, 0x40, 0x86, 0x0D, 0x81, 0x9D, 0x9F, 0xE5, 0xB8, 0x73, 0xB1, 0x97, 0x22, 0xEF, 0x44, 0x6E,
+    0x91, 0x47, 0x40, 0x30, 0x13, 0xF1, 0xC4, 0x3F, 0x3C, 0xBA, 0xD8, 0x76, 0x22, 0xDF, 0x89, 0xFC,
+    0xAE, 0x74, 0x3C, 0x98, 0x61, 0x70, 0xBB, 0x7D, 0x71, 0xB7, 0x87, 0x3B, 0x74, 0xA3, 0x09, 0x9B,
+    0x32, 0xE1, 0x7E, 0x37, 0x16, 0xD2, 0xC3, 0xEB, 0x82, 0x53, 0x76, 0x29, 0x13, 0x6B, 0x15, 0xD8,
+    0xA0, 0xB4, 0x6E, 0xEA, 0x46, 0xFC, 0xAD, 0x52, 0xB3, 0x70, 0x94, 0xF1, 0xAF, 0x92, 0x6A, 0xA9,
+    0x49, 0x72, 0x99, 0x5D, 0xC3, 0x48, 0x16, 0x1D, 0xDA, 0x31, 0xA6, 0xCB, 0xFC, 0x98, 0x76, 0x09,
+    0xCF, 0xA1, 0xCC, 0xC6, 0x6E, 0x44, 0x35, 0xCD, 0xDA, 0x2C, 0x2D, 0x6C, 0xA4, 0x32, 0x95, 0xD2,
+    0xA3, 0x21, 0x8E, 0x9D, 0xE8, 0x75, 0x63, 0x9D, 0x8C, 0x64, 0x9B, 0x83, 0x0C, 0xD8, 0xB4, 0xD1,
+    0x67, 0x87, 0xA0, 0x2B, 0x9F, 0x35, 0x42, 0xF4, 0x02, 0xFB, 0xB3, 0xDB, 0xCA, 0xF4, 0x54, 0xDD,
+    0x87, 0x57, 0x65, 0x15, 0xFE, 0x3E, 0xFA, 0x52, 0xB5, 0x3A, 0x62, 0x7F, 0x53, 0x21, 0x0B, 0x14,
+    0xAE, 0xB3, 0x1B, 0xA3, 0xE4, 0xC3, 0xB1, 0xF1, 0xEF, 0x7E, 0x3D, 0x91, 0x4E, 0xC5, 0xC2, 0x8A,
+    0xC0, 0xC2, 0xE2, 0x69, 0x0E, 0xA7, 0xBF, 0x56, 0xCD, 0xEF, 0x23, 0x51, 0x3D, 0x21, 0x30, 0x28,
+    0xA3, 0x96, 0x6B, 0x3D, 0x6A, 0x1F, 0x8B, 0x04, 0x64, 0xFF, 0x00, 0xF2, 0x4F, 0xAE, 0xA5, 0x8A,
+    0x6E, 0x1F, 0xDB, 0x1D, 0x90, 0xA0, 0xDA, 0xD7, 0xB3, 0xBD, 0x16, 0x37, 0xB8, 0xFD, 0xBA, 0x1A,
+    0x39, 0x91, 0x09, 0x48, 0x7A, 0x20, 0x22, 0xBC, 0xC7, 0x3A, 0x10, 0xF1, 0xF1, 0xB3, 0xC6, 0xF6,
+    0x19, 0xBF, 0x6A, 0x69, 0x26, 0xFA, 0xD8, 0x6B, 0x55, 0x3B, 0x2D, 0x4B, 0xB2, 0x03, 0xFA, 0xB4,
+    0x93, 0x69, 0x55, 0x90, 0x6A, 0xB6, 0x56, 0x4F, 0x1C, 0x36, 0x0A, 0xF5, 0xC4, 0x2A, 0xE4, 0xC3,
+    0x3E, 0x56, 0x11, 0xA8, 0xFD, 0x01, 0x48, 0xB0, 0x51, 0xCF, 0x78, 0xE2, 0x06, 0x39, 0xB9, 0x5A,
+    0xB1, 0xF1, 0x66, 0x02, 0xF2, 0x3D, 0x66, 0xA3, 0x9A, 0xDD, 0xA9, 0x27, 0x06, 0x68, 0x56, 0x4F,
+    0x38, 0xF5, 0x64, 0x55, 0x4F, 0x06, 0x13, 0xBE, 0x51, 0x97, 0x10, 0xB1, 0x9B, 0x5A, 0xD8, 0xE6,
+    0xEE, 0xED, 0x5C, 0x08, 0x14, 0xD5, 0x11, 0x39, 0xB4, 0x93, 0xDF, 0xC1, 0x11, 0x92, 0x24, 0x87,
+    0x71, 0x43, 0xD4, 0x53, 0x95, 0xE9, 0x2B, 0xE9, 0x0B, 0x21, 0x46, 0x75, 0x24, 0x38, 0xED, 0xD4,
+    0xAC, 0x6C, 0xB4, 0x91, 0x8D, 0xED, 0xC2, 0x59, 0xDD, 0x8C, 0xF7, 0x4E, 0x93, 0x9E, 0x48, 0x11,
+    0xF3, 0xA8, 0x95, 0x63, 0xAA, 0x73, 0xCD, 0x50, 0x05, 0xF8, 0x4D, 0x03, 0x8D, 0x48, 0x86, 0xA0,
+    0x86, 0xA1, 0x1B, 0xB1, 0x1B, 0x7A, 0xEA, 0x0C, 0x02, 0xD3, 0x8A, 0x13, 0x06, 0xB7, 0x03, 0x12,
+    0x04, 0x49, 0x14, 0x81, 0x26, 0x20, 0x4F, 0x16, 0x03, 0x36, 0x29, 0x2C, 0xAA, 0x1F, 0x3C, 0x27,
+    0x7D, 0xCB, 0x9C, 0x67, 0xF1, 0x13, 0x25, 0xCC, 0x13, 0x4E, 0x77, 0x83, 0x9B, 0xA5, 0x1C, 0x20,
+    0xD2, 0xCA, 0xB9, 0xA6, 0x99, 0x70, 0xED, 0x52, 0xD6, 0xB4, 0x1A, 0x7B, 0x79, 0x38, 0x2C, 0xC6,
+    0xF9, 0xF3, 0xB3, 0xA9, 0x8C, 0xE2, 0x4F, 0x06, 0xFB, 0xF3, 0x9A, 0xDC, 0xC6, 0x3D, 0x39, 0x2C,
+    0x52, 0x46, 0x77, 0xFE, 0x53, 0xB4, 0xA3, 0xF8, 0xAF, 0x67, 0xF7, 0xF9, 0x9A, 0xEC, 0x55, 0xB4,
+    0x87, 0xA5, 0x7B, 0x33, 0xBA, 0xF3, 0xD1, 0x87, 0x5E, 0xFC, 0x46, 0x62, 0xB5, 0xA2, 0xCB, 0x11,
+    0xB8, 0x96, 0x1E, 0x98, 0xBA, 0x07, 0xDC, 0x8D, 0x55, 0xD4, 0xF0, 0x69, 0x41, 0x16, 0x2D, 0xC8,
+    0x87, 0x7F, 0xE9, 0x5C, 0x6C, 0xC3, 0x41, 0xD3, 0x55, 0x4B, 0xF4, 0xB1, 0xF3, 0x1F, 0x8B, 0xEF,
+    0x77, 0xA6, 0xA3, 0x1C, 0x4A, 0x15, 0x08, 0x42, 0x9F, 0x73, 0x59, 0xE9, 0x1B, 0xB9, 0x90, 0xB9,
+    0xD2, 0x2F, 0x19, 0x62, 0xC2, 0x0E, 0x3E, 0xEC, 0xA2, 0xE9, 0x27, 0xAD, 0x56, 0xF0, 0xD7, 0x88,
+    0xBF, 0xBB, 0x22, 0x0B, 0x6A, 0xF5, 0xAE, 0x3C, 0x82, 0xDF, 0x72, 0x82, 0x9B, 0xF2, 0xCA, 0x8E,
+    0x63, 0x56, 0xB6, 0xD7, 0x10, 0x7F, 0x73, 0x8A, 0x44, 0x73, 0xA9, 0x22, 0x07, 0x7A, 0xF3, 0xB1,
+    0x68, 0x41, 0x29, 0x7A, 0xAD, 0xD1, 0xF7, 0xFE, 0x56, 0x8E, 0x9D, 0xC1, 0x38, 0x6E, 0x5A, 0x3D,
+    0x46, 0x67, 0xF4, 0xF2, 0x0B, 0xE1, 0x5B, 0xB9, 0x4E, 0xEA, 0x72, 0x09, 0xEA, 0x6E, 0x49, 0xB0,
+    0xF7, 0xD1, 0x84, 0xCB, 0x49, 0x0B, 0xB6, 0x65, 0x28, 0x67, 0x98, 0x65, 0x76, 0xC2, 0xB5, 0x52,
+    0xB6, 0x68, 0xC4, 0x64, 0x46, 0xC2, 0x90, 0x2B, 0xD5, 0xBD, 0xE1, 0xF1, 0x29, 0x42, 0xE2, 0x4E,
+    0xB2, 0x70, 0xE8, 0x5A, 0x43, 0x51, 0x25, 0x9B, 0xE2, 0x33, 0xAD, 0x13, 0x9A, 0xF6, 0x4E, 0x4B,
+    0xCE, 0x6C, 0x72, 0xC5, 0x2E, 0xB4, 0x0C, 0x69, 0xD9, 0x56, 0x40, 0x8B, 0x41, 0x5E, 0xD1, 0xE9,
+    0x2C, 0x1C, 0xF4, 0x21, 0x7D, 0x31, 0x59, 0x2D, 0x59, 0xD8, 0x55, 0x46, 0xFA, 0x7F, 0xD2, 0xF2,
+    0x11, 0x9E, 0xBF, 0x00, 0xBD, 0x55, 0xBD, 0x8E, 0xDD, 0x44, 0x14, 0x3E, 0xF6, 0x68, 0x71, 0x61,
+    0x09, 0x57, 0x34, 0x50, 0xB8, 0x87, 0xC2, 0x8F, 0x30, 0x46, 0x5B, 0x50, 0xB2, 0x12, 0x84, 0x94,
+    0x3C, 0x00, 0x05, 0x8F, 0x30, 0x17, 0x51, 0xA4, 0x48, 0xB1, 0x79, 0x09, 0x24, 0xB4, 0x29, 0xEE,
+    0x23, 0x8C, 0xA1, 0xD9, 0x22, 0x8D, 0x29, 0x22, 0x0A, 0x8A, 0xBD, 0x0D, 0x12, 0xD9, 0x14, 0x4C,
+    0x14, 0xA3, 0xF5, 0xBD, 0x19, 0xFB, 0xE4, 0xFB, 0x66, 0xEE, 0x82, 0x12, 0x82, 0x90, 0x40, 0x60,
+    0xDD, 0x99, 0xEB, 0x39, 0x3E, 0xF3, 0xCD, 0xF9, 0xFD, 0xC6, 0xA9, 0x6A, 0x8B, 0xF1, 0x23, 0xC6,
+    0x6F, 0x18, 0x51, 0x9A, 0x59, 0xC4, 0xAC, 0x22, 0xA2, 0x1B, 0x11, 0xBB, 0x93, 0x7F, 0x2A, 0x70,
+    0x83, 0xD4, 0x33, 0x04, 0xF6, 0x7B, 0x95, 0x52, 0xCD, 0x22, 0xCD, 0x54, 0x47, 0x48, 0xDB, 0x50,
+    0xAE, 0x50, 0x6A, 0x02, 0xDE, 0xDD, 0x46, 0xF4, 0x74, 0x91, 0x42, 0xB1, 0x32, 0xD1, 0xF7, 0x52,
+    0xBD, 0x88, 0xD8, 0xAD, 0x80, 0xE8, 0x14, 0x78, 0x76, 0x26, 0xE8, 0x28, 0x52, 0x61, 0xF5, 0xBE,
+    0x0F, 0x58, 0x00, 0xD1, 0xE8, 0x4C, 0xA5, 0x5E, 0xA4, 0xC0, 0xF8, 0xFD, 0x01, 0xC6, 0xED, 0x5C,
+    0x6C, 0x0F, 0x67, 0xB0, 0x40, 0x75, 0x85, 0x32, 0x9E, 0xA1, 0xE1, 0x1C, 0xDA, 0xA5, 0x09, 0x5D,
+    0xB4, 0xA1, 0x09, 0x75, 0xB4, 0x63, 0x13, 0xCC, 0xE2, 0x06, 0xCC, 0x2B, 0xE7, 0x72, 0xCD, 0xEF,
+    0x59, 0x9E, 0x75, 0xB2, 0x7E, 0xDE, 0x5B, 0x26, 0x9C, 0x8C, 0x49, 0xFC, 0xFE, 0xD5, 0x13, 0xE5,
+    0x04, 0x07, 0xDA, 0x11, 0x9E, 0x77, 0x41, 0xBA, 0x80, 0x00, 0xD8, 0xB1, 0x5A, 0xC4, 0x0F, 0x46,
+    0x0B, 0xD8, 0xAE, 0x5F, 0x63, 0x97, 0x7B, 0x04, 0xE7, 0xAC, 0x4E, 0x47, 0x0F, 0x6B, 0xC0, 0xC1,
+    0xB1, 0x0D, 0x97, 0x03, 0x1D, 0x06, 0x8E, 0xFD, 0x15, 0x5F, 0xF5, 0x7E, 0x44, 0x48, 0x8C, 0x22,
+    0xA6, 0x85, 0xF6, 0x08, 0x9A, 0x1F, 0xDA, 0x49, 0x6C, 0x40, 0x64, 0xBB, 0xC9, 0x0F, 0xD2, 0x44,
+    0xC4, 0xB6, 0x1B, 0xDB, 0x80, 0xD3, 0xAA, 0x98, 0xB4, 0x18, 0x7A, 0x08, 0xED, 0xEE, 0xDF, 0x0A,
+    0x0F, 0x17, 0xDB, 0xF5, 0x9E, 0x1E, 0x8B, 0x41, 0x17, 0xC7, 0x99, 0xAE, 0xC2, 0x35, 0xD8, 0x09,
+    0xE3, 0x04, 0x99, 0x64, 0x52, 0x28, 0x7C, 0xA7, 0xC7, 0x9F, 0xBA, 0x51, 0xEC, 0xD5, 0x24, 0xCD,
+    0xCD, 0x82, 0x6F, 0xAF, 0x08, 0x56, 0x0A, 0x06, 0xD1, 0x2F, 0x67, 0x71, 0x2C, 0xB0, 0xC9, 0x03,
+    0xB2, 0x26, 0xE2, 0xBB, 0x4F, 0x08, 0x48, 0xBC, 0x04, 0x47, 0xB4, 0xD7, 0x04, 0x6E, 0x40, 0x99,
+    0xD4, 0x07, 0x15, 0xF8, 0x6F, 0x9F, 0x46, 0xC4, 0x54, 0x74, 0x1B, 0x18, 0xD0, 0xD5, 0x0F, 0xA5,
+    0x4A, 0xF3, 0x1F, 0x7C, 0x82, 0xEF, 0x17, 0xFE, 0xA9, 0xA6, 0x67, 0x9B, 0xE6, 0xD5, 0xA7, 0xBF,
+    0x39, 0x59, 0x93, 0x0A, 0x18, 0x49, 0xD0, 0x9E, 0x9B, 0xFE, 0xD7, 0x25, 0xEC, 0x3A, 0x5C, 0xE8,
+    0x2F, 0xD9, 0x1A, 0x7D, 0x94, 0xFF, 0xE2, 0x71, 0x39, 0xA4, 0xF2, 0x47, 0x2A, 0xD3, 0xE3, 0xDE,
+    0xB8, 0x2C, 0xBF, 0x75, 0xAC, 0xAF, 0x16, 0x0D, 0x8E, 0x9A, 0x43, 0xC2, 0x8B, 0xBC, 0x2F, 0x15,
+    0xAF, 0x49, 0xBA, 0x6C, 0x38, 0xB1, 0xD7, 0x0F, 0x58, 0x8F, 0xA8, 0x4F, 0x36, 0x0E, 0xFB, 0x0D,
+    0xDB, 0xEC, 0xD8, 0x82, 0x17, 0x42, 0xA1, 0x1B, 0x93, 0xED, 0x62, 0x83, 0xDB, 0x64, 0x1A, 0xFA,
+    0xA2, 0x37, 0xEB, 0x43, 0x66, 0x59, 0xD1, 0xA8, 0x96, 0x53, 0xA3, 0x6B, 0x9F, 0xCE, 0x6D, 0x9E,
+    0xA5, 0x26, 0xBE, 0x24, 0xBC, 0xA2, 0xDE, 0x70, 0xD0, 0x9F, 0xC5, 0x87, 0x6F, 0x28, 0x46, 0x4D,
+    0x40, 0x8C, 0xEE, 0xB6, 0x97, 0xAC, 0x0F, 0x68, 0xD7, 0x4A, 0xED, 0x3A, 0x52, 0xBB, 0x99, 0xA8,
+    0x6D, 0x47, 0x88, 0x0B, 0x3D, 0x85, 0xB8, 0xA1, 0xF8, 0xA1, 0xEE, 0x92, 0xB6, 0x90, 0xC1, 0x02,
+    0x41, 0xF6, 0x30, 0x88, 0x27, 0xFC, 0xE5, 0xB8, 0x3E, 0x63, 0x07, 0xF7, 0x18, 0x3B, 0x97, 0xD2,
+    0xDA, 0x01, 0xAC, 0x02, 0x0D, 0x98, 0xE3, 0xE0, 0x3B, 0xFA, 0xEB, 0x5A, 0x69, 0x52, 0xC0, 0x18,
+    0x89, 0xCA, 0xA7, 0xF0, 0xA8, 0x47, 0xEC, 0x29, 0x92, 0x95, 0xD7, 0x3A, 0x9F, 0x20, 0x44, 0x92,
+    0xF9, 0x0E, 0xE9, 0x42, 0x40, 0xE5, 0xCE, 0x1D, 0x3F, 0x22, 0x02, 0x13, 0xE2, 0xB7, 0x98, 0xDC,
+    0x38, 0xE8, 0x05, 0xA1, 0xE7, 0xD4, 0x20, 0x45, 0x1A, 0xFD, 0xE8, 0xC9, 0x17, 0xFA, 0x15, 0xB3,
+    0x06, 0xF0, 0x4D, 0xCD, 0x50, 0x15, 0x67, 0xB7, 0x14, 0xC6, 0x4E, 0xC4, 0x31, 0xC8, 0x5D, 0x87,
+    0xDD, 0x6D, 0x22, 0x1D, 0x34, 0x66, 0xBB, 0x6E, 0xF5, 0x43, 0xB8, 0x39, 0x54, 0x5A, 0x45, 0x7C,
+    0xAC, 0x97, 0x36, 0x74, 0x3B, 0x24, 0xC1, 0x0D, 0x38, 0xC3, 0x22, 0x12, 0xE8, 0x19, 0x7F, 0xC9,
+    0x54, 0x15, 0x8C, 0xC5, 0x00, 0x04, 0xC7, 0xEC, 0xB5, 0xCF, 0x94, 0xB9, 0xF5, 0x97, 0x11, 0x9D,
+    0x55, 0x22, 0x7A, 0x36, 0xEF, 0x42, 0x2C, 0xDC, 0x0F, 0xB7, 0x80, 0xA5, 0xFE, 0xEC, 0xA7, 0x36,
+    0x98, 0x7C, 0x96, 0x49, 0x2E, 0x02, 0x67, 0x4D, 0x16, 0x9D, 0x70, 0x7A, 0xCB, 0x53, 0x53, 0x23,
+    0x5D, 0x1F, 0xE0, 0x60, 0xAC, 0xC0, 0xE0, 0x03, 0x6A, 0x33, 0xB2, 0x4E, 0xD3, 0x0B, 0xB8, 0xCE,
+    0x0E, 0x76, 0x7F, 0x37, 0xEB, 0x98, 0x74, 0x91, 0xE0, 0xA5, 0xD4, 0xBB, 0xAC, 0x18, 0x8B, 0x98,
+    0x1A, 0x7C, 0xEA, 0xA1, 0xB3, 0x33, 0xB1, 0x81, 0xEC, 0x3B, 0xD4, 0x0D, 0xA8, 0x18, 0xBB, 0x78,
+    0xC2, 0x7B, 0x3A, 0xC3, 0xD7, 0xC8, 0xC3, 0xDF, 0xEE, 0x1D, 0x89, 0x70, 0x20, 0x09, 0x7C, 0xA0,
+    0x0B, 0x50, 0x26, 0xB4, 0xE1, 0x4F, 0x0B, 0x78, 0x65, 0x07, 0x3A, 0xD9, 0xB4, 0x37, 0x88, 0x05,
+    0xD9, 0xE4, 0x63, 0xDD, 0x83, 0x4C, 0x4E, 0x27, 0xC9, 0x97, 0xC0, 0x99, 0x94, 0x7E, 0x22, 0xBD,
+    0xC2, 0x82, 0xB9, 0xD2, 0xF5, 0x41, 0x03, 0x0F, 0xBA, 0x90, 0x89, 0x05, 0x75, 0xB2, 0x71, 0x5B,
+    0x0D, 0x9E, 0x5D, 0xB3, 0x6F, 0x17, 0xBF, 0xCB, 0x5D, 0x9F, 0x47, 0xA1, 0xE8, 0x6F, 0xB5, 0xE8,
+    0x71, 0x58, 0xB7, 0xB4, 0x73, 0x4B, 0xCE, 0x9F, 0x0C, 0x6B, 0xD9, 0xAF, 0xE9, 0x96, 0x01, 0x24,
+    0x96, 0x2B, 0x13, 0x0B, 0x92, 0xC4, 0xB5, 0xD6, 0x3D, 0x5F, 0x45, 0xCF, 0x57, 0x1F, 0x2D, 0xAB,
+    0x55, 0xC1, 0xEF, 0x27, 0x7A, 0x8E, 0xC0, 0xD9, 0x5D, 0x15, 0x51, 0x1E, 0xCF, 0x21, 0x3A, 0xC7,
+    0x59, 0x16, 0xF9, 0xF5, 0xBA, 0x1C, 0x7F, 0x8F, 0x3F, 0xF5, 0x1B, 0xF9, 0xDB, 0x1F, 0x3B, 0x49,
+    0x6E, 0x23, 0x88, 0x00, 0x3D, 0x06, 0xE5, 0x93, 0xA3, 0x2B, 0xB2, 0x75, 0x4B, 0xDE, 0x76, 0x64,
+    0xC7, 0x05, 0xA2, 0x7A, 0xAA, 0x98, 0x00, 0x76, 0x05, 0xEA, 0xFB, 0xF3, 0xFD, 0x67, 0xFA, 0x09,
+    0x09, 0xE1, 0x8A, 0x13, 0xA9, 0x7B, 0x41, 0x0D, 0x34, 0x37, 0xBC, 0x75, 0xAE, 0x78, 0x77, 0x22,
+    0xED, 0x99, 0xBD, 0xFF, 0x78, 0x5E, 0x02, 0xA5, 0x55, 0x3F, 0x6B, 0x1C, 0x47, 0x14, 0x7F, 0x77,
+    0x8B, 0xB5, 0xE0, 0x85, 0x6C, 0x93, 0x2A, 0xCD, 0x7E, 0x84, 0xAD, 0x5D, 0xCD, 0x25, 0x22, 0x95,
+    0x8A, 0x24, 0x10, 0xE3, 0xC2, 0x85, 0xDA, 0x90, 0x46, 0x1F, 0x61, 0x36, 0x56, 0xE1, 0x42, 0x10,
+    0xAE, 0x09, 0x69, 0x53, 0x3B, 0xC5, 0x7D, 0x84, 0x37, 0xE0, 0x22, 0xC5, 0x15, 0xDE, 0xC4, 0x88,
+    0x14, 0x2E, 0xBC, 0x98, 0x40, 0xC0, 0x2A, 0xB4, 0x9C, 0x56, 0xF1, 0x9E, 0x35, 0x33, 0x2F, 0xBF,
+    0x37, 0x7B, 0x88, 0x28, 0x88, 0x38, 0xA0, 0x3D, 0xDE, 0xDC, 0xBC, 0xB7, 0xEF, 0xFF, 0xBF, 0x25,
+    0x22, 0x9A, 0xCB, 0x40, 0x46, 0x7C, 0x26, 0x32, 0x9A, 0xBE, 0x1A, 0x64, 0x51, 0xFF, 0xE9, 0xC9,
+    0x9E, 0xCB, 0xF5, 0x73, 0xE5, 0x89, 0xEA, 0x9E, 0xC8, 0x76, 0x44, 0xF2, 0xC7, 0x9E, 0x03, 0x69,
+    0x26, 0xE2, 0x89, 0x65, 0x49, 0xF7, 0x16, 0x64, 0xDA, 0x7C, 0x24, 0x50, 0xC8, 0x36, 0xA6, 0x2B,
+    0x7C, 0x3E, 0x16, 0x1E, 0x34, 0xDB, 0x08, 0xCD, 0x24, 0x1F, 0x4D, 0x47, 0x85, 0xB7, 0x27, 0x50,
+    0x61, 0x20, 0x47, 0xA0, 0x89, 0x40, 0x4F, 0x9D, 0x90, 0x3C, 0xF2, 0xF9, 0x08, 0xA5, 0x4F, 0x47,
+    0xDB, 0x92, 0xE9, 0xED, 0xB1, 0x50, 0x1E, 0xF2, 0xB1, 0x84, 0xBE, 0xC6, 0x36, 0xB6, 0x35, 0x7D,
+    0x3E, 0x66, 0x52, 0x04, 0xA8, 0x2E, 0xA1, 0x81, 0xD4, 0x24, 0xD4, 0x7C, 0x0A, 0xEB, 0x1F, 0x11,
+    0x44, 0xB2, 0x00, 0xB5, 0xEE, 0x13, 0x1E, 0x66, 0x70, 0xA7, 0x42, 0x1C, 0x0F, 0xB9, 0x45, 0x3C,
+    0x50, 0x7F, 0xB1, 0xCC, 0x05, 0x9C, 0x2F, 0x11, 0x54, 0x25, 0xE0, 0xFA, 0x92, 0xB8, 0x29, 0x03,
+    0x37, 0x15, 0xC0, 0x00, 0x2C, 0x40, 0x02, 0x3F, 0x89, 0x81, 0x8F, 0xDF, 0x05, 0x3E, 0xB9, 0x08,
+    0xFC, 0xC5, 0xCB, 0xC0, 0x47, 0xCF, 0x03, 0x73, 0x16, 0x38, 0x02, 0x3C, 0x60, 0x04, 0xF4, 0x80,
+    0x2E, 0x0B, 0x7B, 0x3F, 0xDD, 0x6F, 0x8A, 0xBE, 0x6E, 0xF3, 0x60, 0x1D, 0x72, 0xB5, 0x20, 0x86,
+    0xDA, 0xD9, 0x82, 0x92, 0x5B, 0x77, 0xD4, 0xCD, 0x4D, 0xEE, 0xA1, 0x63, 0x80, 0x7C, 0xC7, 0x0D,
+    0x3B, 0xFE, 0x4E, 0x88, 0x8F, 0x03, 0xC2, 0x1D, 0x01, 0xFD, 0xF4, 0x7F, 0x0E, 0x1C, 0x09, 0xC2,
+    0xBB, 0x06, 0x3C, 0x2D, 0x78, 0x7B, 0xC8, 0x40, 0xAE, 0x08, 0x9A, 0x54, 0xB2, 0x22, 0xAE, 0x12,
+    0xE9, 0x8B, 0xED, 0x63, 0x3F, 0x07, 0x89, 0x78, 0x61, 0x5D, 0xDD, 0x56, 0x7D, 0xD1, 0xE7, 0x3E,
+    0xF3, 0x20, 0x80, 0xC7, 0x19, 0x57, 0xF5, 0x15, 0x08, 0x87, 0xE3, 0x4C, 0x0C, 0x12, 0xFB, 0x42,
+    0xA8, 0xBA, 0x88, 0x94, 0xFB, 0x29, 0x90, 0x91, 0x4A, 0xA9, 0x51, 0x05, 0x59, 0x4B, 0x3B, 0x97,
+    0x0D, 0xEC, 0x8A, 0x67, 0x86, 0xEE, 0xFA, 0x75, 0x6B, 0x78, 0xFD, 0x6E, 0x2C, 0x5F, 0x6C, 0x82,
+    0x2D, 0x2E, 0x3C, 0x42, 0x1A, 0xA4, 0xFE, 0xCD, 0x7B, 0xB3, 0x1E, 0x2C, 0x97, 0x9B, 0x50, 0xCA,
+    0xBE, 0xE7, 0xCF, 0xC4, 0x49, 0xDD, 0xDA, 0x0E, 0xC4, 0x72, 0x00, 0x71, 0x0E, 0xC3, 0x70, 0xF0,
+    0x7D, 0xA4, 0xFA, 0x4A, 0x43, 0xE8, 0xE6, 0x02, 0x34, 0x2A, 0x1A, 0x9F, 0x89, 0xF6, 0x18, 0x8B,
+    0x44, 0x79, 0xC6, 0xFF, 0x7E, 0xBB, 0x43, 0x27, 0xA7, 0x22, 0x21, 0xE1, 0x6D, 0x89, 0xD8, 0xEA,
+    0xA1, 0xF2, 0x66, 0x2A, 0x41, 0x64, 0xA7, 0xEC, 0x3B, 0xC0, 0x5D, 0x69, 0xA6, 0xCD, 0x82, 0x01,
+    0x0F, 0x78, 0x87, 0x1C, 0x32, 0x2A, 0xAB, 0x45, 0x82, 0x95, 0xF7, 0x30, 0x76, 0x06, 0x58, 0x5D,
+    0x3E, 0x8A, 0x3B, 0x97, 0xCE, 0x60, 0x65, 0xD5, 0xCD, 0x3F, 0x80, 0x26, 0x17, 0x8A, 0x48, 0x6C,
+    0xA5, 0x85, 0x9E, 0x9E, 0x2F, 0xED, 0xC0, 0x2D, 0x12, 0xEF, 0x0A, 0x80, 0x16, 0x2E, 0x9B, 0x40,
+    0xEF, 0x4A, 0xD3, 0x77, 0x5B, 0xF0, 0x28, 0x2F, 0x8B, 0xE3, 0x13, 0x94, 0xA2, 0xD1, 0x06, 0xA4,
+    0x5B, 0x41, 0x9F, 0x5C, 0xD0, 0xE7, 0xC8, 0x9D, 0x8C, 0x75, 0x78, 0x9C, 0xC1, 0xA4, 0x75, 0x18,
+    0x1B, 0x4C, 0x46, 0x43, 0x18, 0x06, 0xE2, 0x09, 0xC3, 0x00, 0x66, 0x72, 0xFA, 0x0D, 0x8A, 0xDC,
+    0xD8, 0xD4, 0x19, 0x0B, 0xFA, 0x58, 0x43, 0xFB, 0x0B, 0x61, 0xBD, 0x02, 0x7C, 0x7E, 0xB8, 0xFD,
+    0x9A, 0x4C, 0x97, 0xC4, 0x54, 0x89, 0x8A, 0xFE, 0x27, 0x6A, 0x7A, 0x32, 0xBF, 0xA2, 0xDA, 0x1E,
+    0x77, 0x74, 0x9D, 0x2B, 0x87, 0x5C, 0xFB, 0xC4, 0xB4, 0x75, 0x37, 0x93, 0xCC, 0x53, 0xD9, 0xC3,
+    0x0F, 0x3E, 0x18, 0xC0, 0x81, 0x52, 0x98, 0xD7, 0x1D, 0xC6, 0x17, 0x5D, 0x5F, 0x8A, 0x4B, 0xAD,
+    0x02, 0x6F, 0xE0, 0x3B, 0x94, 0xA4, 0x41, 0x54, 0x9F, 0x93, 0x8D, 0x9F, 0x45, 0x59, 0xD4, 0x10,
+    0x90, 0x72, 0x4B, 0xD7, 0xCF, 0xD4, 0x64, 0xCA, 0x76, 0xFB, 0x75, 0x8E, 0xAA, 0xE9, 0x81, 0x53,
+    0xF7, 0x4E, 0x57, 0x8F, 0xF6, 0x17, 0xD9, 0x8F, 0x99, 0x2F, 0xBD, 0x36, 0xAE, 0x5D, 0xA3, 0x9B,
+    0x74, 0x58, 0x8C, 0x33, 0xAF, 0xC6, 0x74, 0x05, 0xD5, 0xFC, 0x0E, 0x6A, 0xEE, 0x4D, 0x67, 0x9C,
+    0x3C, 0x91, 0xA7, 0xDE, 0xF6, 0x28, 0xBE, 0xC4, 0xB4, 0x61, 0x16, 0x7A, 0x36, 0x1F, 0x36, 0x9C,
+    0xAE, 0x16, 0xFD, 0x86, 0x2C, 0x4B, 0x83, 0x9F, 0xAB, 0x06, 0x8B, 0x96, 0x42, 0xB6, 0x0C, 0xC6,
+    0x2F, 0x07, 0xA4, 0x60, 0x8C, 0xAE, 0x16, 0x74, 0x55, 0x89, 0x75, 0x53, 0x8E, 0xD2, 0x14, 0xBE,
+    0x1A, 0xB2, 0x38, 0x17, 0xE4, 0xC1, 0xBC, 0x91, 0x45, 0x1E, 0x04, 0x43, 0x6C, 0x30, 0xD0, 0xBA,
+    0xC1, 0xF6, 0x23, 0x12, 0xF9, 0x3F, 0x08, 0x3F, 0x1C, 0x6E, 0x31, 0xBA, 0x69, 0x18, 0xAE, 0x92,
+    0xE7, 0x53, 0x5B, 0xD4, 0x48, 0x60, 0x01, 0x9B, 0x53, 0x03, 0x62, 0xCD, 0x65, 0x48, 0x42, 0x16,
+    0xFE, 0x09, 0x46, 0x01, 0xBA, 0x4C, 0x5C, 0x05, 0x34, 0x45, 0x28, 0x00, 0xB4, 0xFA, 0x31, 0x4C,
+    0xF5, 0xB8, 0x09, 0x58, 0x15, 0xBA, 0x6C, 0x9A, 0xEA, 0xAE, 0xE7, 0xE9, 0xD1, 0xE5, 0xA3, 0xC0,
+    0x5A, 0x9F, 0x9B, 0x67, 0x7A, 0x5B, 0x8C, 0xA9, 0x7D, 0xEE, 0x8E, 0xA8, 0x95, 0x78, 0x90, 0x3E,
+    0x3F, 0x31, 0x19, 0x48, 0xB3, 0x3B, 0x65, 0x67, 0xCA, 0xCD, 0x75, 0x66, 0x6E, 0x20, 0xFA, 0x89,
+    0x70, 0xDA, 0x43, 0x48, 0x1E, 0x8A, 0x44, 0xF7, 0x8E, 0xFA, 0x5D, 0x8D, 0xB1, 0x23, 0x97, 0xA8,
+    0x24, 0xCA, 0x58, 0xE9, 0x61, 0xDF, 0x72, 0xAF, 0xDF, 0xAC, 0x16, 0xA5, 0x97, 0x85, 0x9A, 0x26,
+    0x7B, 0x6A, 0x7B, 0xDD, 0xA4, 0xCD, 0x8E, 0x2B, 0x2E, 0xD2, 0x88, 0xAE, 0xA0, 0xDF, 0x9C, 0x69,
+    0x2B, 0x63, 0x2B, 0x60, 0x72, 0x94, 0x28, 0x2B, 0xD9, 0x82, 0x88, 0x09, 0x2F, 0x75, 0xAF, 0x80,
+    0x78, 0x2A, 0x9D, 0xAC, 0xBA, 0xD2, 0x83, 0x73, 0x2E, 0xCA, 0xC9, 0xCF, 0x41, 0x64, 0x10, 0xC1,
+    0xA4, 0x9C, 0x83, 0x72, 0x2E, 0x93, 0xB8, 0xFA, 0xAA, 0xA5, 0x55, 0xCF, 0x15, 0x95, 0xB8, 0x44,
+    0xE9, 0x06, 0xF4, 0xEA, 0xC0, 0x6F, 0x65, 0x03, 0xD9, 0x35, 0xD2, 0x50, 0xE3, 0x63, 0x0A, 0x0D,
+    0x1B, 0xE8, 0x3F, 0x48, 0x6F, 0x53, 0x84, 0x7B, 0x69, 0xF0, 0x47, 0xB8, 0xD8, 0x3D, 0xC8, 0x85,
+    0x76, 0xEB, 0xE1, 0xDB, 0x95, 0x87, 0x06, 0xC7, 0xE2, 0x67, 0x0F, 0xA7, 0x65, 0x31, 0x93, 0xEF,
+    0xBF, 0xE2, 0x1E, 0x85, 0x29, 0xD3, 0xB6, 0xC0, 0x97, 0x9A, 0x6E, 0x79, 0xFE, 0x06, 0xBD, 0x55,
+    0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0xB6, 0x15, 0x59, 0xC2, 0x85, 0x1B, 0xD2, 0x00, 0x92, 0x3F,
+    0x61, 0xFE, 0x20, 0xB6, 0xE0, 0x03, 0x92, 0x22, 0x40, 0xB1, 0xC5, 0xB6, 0x08, 0x21, 0xE5, 0x0B,
+    0xD0, 0x38, 0xD9, 0x82, 0x22, 0xCD, 0xFE, 0x01, 0x94, 0x88, 0x66, 0xFF, 0x80, 0x31, 0xD9, 0x82,
+    0x22, 0xC5, 0x5A, 0x5A, 0x6D, 0x28, 0x28, 0x62, 0x24, 0x24, 0x8A, 0x2D, 0x62, 0xB4, 0x56, 0xE2,
+    0xB7, 0xCC, 0xCC, 0xE1, 0xDC, 0x79, 0xEF, 0x65, 0x41, 0x82, 0xED, 0x60, 0xDE, 0xBB, 0x63, 0xFB,
+    0x7A, 0xE6, 0xCE, 0xBD, 0xE7, 0x9E, 0x7B, 0x2D, 0xC2, 0x51, 0xAD, 0x62, 0xA3, 0xB8, 0xDE, 0xC0,
+    0x57, 0x6B, 0x05, 0xCC, 0xAE, 0xC7, 0x0B, 0x3C, 0x5D, 0xCD, 0x5C, 0x79, 0x77, 0x14, 0xA5, 0xFD,
+    0x39, 0xBA, 0xB1, 0x08, 0x0E, 0x5E, 0xDA, 0x4B, 0x60, 0x28, 0xA2, 0xBB, 0x0C, 0xD4, 0xAE, 0xAD,
+    0x6A, 0x9F, 0x40, 0xEC, 0xF3, 0xB5, 0xDE, 0x98, 0xD5, 0xF5, 0x0E, 0xA8, 0xD6, 0x1C, 0x18, 0x5D,
+    0x5F, 0x62, 0xA2, 0xE9, 0xAC, 0x13, 0x79, 0x84, 0x50, 0x00, 0x91, 0x86, 0x63, 0x1D, 0x8A, 0xD8,
+    0xCC, 0x5B, 0xA9, 0x57, 0x0A, 0x75, 0xFA, 0x4E, 0x1C, 0x05, 0xA7, 0x31, 0x47, 0x11, 0xF5, 0x57,
+    0xFB, 0x22, 0x1A, 0xAE, 0xB1, 0x53, 0x11, 0xB3, 0x8F, 0xE9, 0xA1, 0xDF, 0x4A, 0xB9, 0x52, 0x96,
+    0xAD, 0x59, 0x0E, 0x83, 0x8E, 0xBB, 0x87, 0x16, 0x38, 0x42, 0x86, 0xFB, 0x4B, 0x1E, 0xED, 0x50,
+    0x46, 0xDC, 0x0C, 0x37, 0x48, 0x0E, 0x6E, 0x89, 0x22, 0x75, 0xEC, 0xBE, 0xE0, 0x71, 0x73, 0xC3,
+    0x0D, 0x15, 0x36, 0x22, 0x0F, 0x25, 0xFB, 0xE6, 0x3D, 0xA9, 0x27, 0xC6, 0x77, 0xEA, 0x25, 0xD4,
+    0xA3, 0xEC, 0x46, 0x85, 0x51, 0xB8, 0x90, 0x8B, 0x27, 0x0C, 0xF6, 0x3C, 0x88, 0xFB, 0x7A, 0xCE,
+    0xE0, 0x6E, 0xAC, 0xBE, 0x9A, 0x45, 0x68, 0x39, 0x43, 0x2F, 0x05, 0x8E, 0xDF, 0xA7, 0x0B, 0xBE,
+    0xE4, 0x86, 0x1C, 0xB1, 0x93, 0xBB, 0x5B, 0x1B, 0x39, 0x4F, 0x24, 0xA2, 0xA2, 0xEF, 0x68, 0x0C,
+    0x42, 0x1F, 0x7B, 0x55, 0x88, 0x99, 0x14, 0x70, 0x47, 0x5F, 0x1D, 0x14, 0xAF, 0xD9, 0xC4, 0xC3,
+    0x58, 0x05, 0xC1, 0x33, 0x88, 0x99, 0xDD, 0x50, 0x7A, 0x33, 0x65, 0xD0, 0x94, 0x3C, 0x8B, 0xD2,
+    0x30, 0x15, 0xFF, 0xA0, 0x20, 0x00, 0x90, 0xE4, 0x83, 0xB4, 0x93, 0xBC, 0xE3, 0x16, 0x9E, 0x43,
+    0x25, 0x02, 0xCD, 0x13, 0x21, 0x22, 0x46, 0x83, 0xCD, 0x2C, 0xED, 0x20, 0xDF, 0x6B, 0xA0, 0xBA,
+    0x16, 0x61, 0xF7, 0xBF, 0x78, 0xE8, 0x92, 0x27, 0xB7, 0xFF, 0x75, 0x94, 0x58, 0x15, 0x5E, 0x60,
+    0x35, 0x9B, 0xB2, 0x60, 0x44, 0x76, 0x90, 0x2A, 0x7E, 0xD7, 0x33, 0x26, 0x82, 0x33, 0xD0, 0x92,
+    0xE6, 0xC4, 0x8E, 0x8A, 0xC2, 0x67, 0xC4, 0xB5, 0xB7, 0x58, 0x79, 0x50, 0x27, 0xEF, 0xEA, 0xEE,
+    0x0C, 0xF1, 0x43, 0xE0, 0x77, 0x60, 0x71, 0xFD, 0x07, 0x74, 0xB3, 0x8A, 0xC9, 0xC3, 0x06, 0x8B,
+    0xAE, 0xC9, 0x31, 0xA7, 0x8C, 0xE2, 0x4B, 0xB1, 0x67, 0xC0, 0x15, 0x81, 0xB0, 0x64, 0x8C, 0xC2,
+    0xD7, 0xBC, 0x04, 0x6C, 0x47, 0x08, 0xDD, 0xC9, 0xE5, 0xF5, 0xDF, 0x27, 0x06, 0x57, 0x3F, 0xFF,
+    0xF1, 0x6A, 0xF1, 0xE1, 0x9E, 0xD9, 0x32, 0x60, 0xAA, 0x3C, 0x33, 0xEC, 0x06, 0xE5, 0xEA, 0xBF,
+    0xDC, 0xE8, 0xB2, 0x51, 0xD9, 0x26, 0x36, 0xED, 0x29, 0x08, 0x76, 0xDF, 0x4E, 0x49, 0x73, 0xFB,
+    0xCD, 0x0B, 0xF7, 0x1A, 0xDE, 0x85, 0x86, 0xC7, 0x2A, 0x49, 0x45, 0xB3, 0x48, 0x73, 0x4A, 0x23,
+    0xA2, 0x13, 0x0E, 0x34, 0x11, 0x51, 0x09, 0x26, 0x96, 0xA9, 0xFC, 0x55, 0x9A, 0xD1, 0x90, 0xFB,
+    0xE5, 0x42, 0xAA, 0xFB, 0x3C, 0xE4, 0xF8, 0x94, 0x19, 0xEE, 0xD4, 0x13, 0x43, 0x29, 0x7D, 0x9D,
+    0x3C, 0x3A, 0xA0, 0x7C, 0x02, 0xA7, 0x9C, 0xC7, 0x19, 0x73, 0x0E, 0x9C, 0x83, 0x9C, 0x8B, 0xDD,
+    0x8E, 0x7E, 0xAE, 0xAF, 0xD7, 0x5B, 0xE6, 0x8B, 0xC3, 0xCD, 0x03, 0x49, 0x64, 0x1C, 0xD3, 0xBC,
+    0xA6, 0x39, 0xE8, 0xDB, 0x32, 0xEA, 0x9C, 0xE3, 0xED, 0xBC, 0x39, 0x50, 0x0D, 0x9D, 0x49, 0xF3,
+    0x92, 0xE6, 0xFE, 0xFF, 0xA0, 0xE7, 0x5D, 0x06, 0x83, 0x6D, 0xED, 0x15, 0x9A, 0x33, 0x1A, 0xBD,
+    0xD3, 0xED, 0xA2, 0x2B, 0xD5, 0x1B, 0xFA, 0xD2, 0x4E, 0xEC, 0x17, 0x83, 0x7B, 0xCC, 0x14, 0x1D,
+    0xB1, 0xC6, 0x12, 0x75, 0xE6, 0xED, 0xF5, 0x15, 0x9F, 0x8F, 0xA8, 0x7F, 0x4C, 0x17, 0x7A, 0xC7,
+    0x66, 0xD2, 0xD2, 0x6E, 0xCD, 0x7D, 0x55, 0xD0, 0x6E, 0x90, 0x93, 0x62, 0x29, 0xAF, 0xCD, 0xB4,
+    0x6D, 0x07, 0xF2, 0x60, 0x8F, 0x1C, 0x71, 0x68, 0x28, 0x2D, 0xC5, 0x52, 0x88, 0xCB, 0x93, 0x18,
+    0xDC, 0xD1, 0x9B, 0xE0, 0x9E, 0x5E, 0x05, 0x77, 0xFF, 0x3C, 0xB8, 0x47, 0xA7, 0xC1, 0x39, 0xB6,
+    0xAD, 0x48, 0xF1, 0x94, 0x95, 0x32, 0x53, 0x26, 0xD2, 0xE2, 0x73, 0xF9, 0x56, 0xAA, 0xD9, 0x8C,
+    0x62, 0x7F, 0xF2, 0x8A, 0x4D, 0x97, 0x7A, 0xC1, 0xBE, 0xDB, 0x14, 0x20, 0x75, 0x58, 0x55, 0x76,
+    0x40, 0x5F, 0x79, 0x92, 0x17, 0x9D, 0x1D, 0xD8, 0xC9, 0x42, 0xAE, 0x81, 0xB3, 0xD6, 0xC0, 0xD0,
+    0xAB, 0xC5, 0x75, 0x64, 0xF4, 0xCC, 0xA5, 0xC4, 0xB8, 0xD1, 0xED, 0x5A, 0x9A, 0x95, 0xE2, 0xDE,
+    0xCE, 0xC9, 0x08, 0x6F, 0xA8, 0x55, 0x98, 0xC8, 0x31, 0x56, 0x2F, 0xB5, 0x4A, 0xAE, 0x5A, 0x97,
+    0xE0, 0x58, 0xC3, 0xA8, 0xAE, 0xA3, 0x18, 0x92, 0xDD, 0x9D, 0x4C, 0xCC, 0xC3, 0xED, 0x8F, 0x17,
+    0x87, 0xD7, 0x4C, 0x20, 0xDB, 0x32, 0x4E, 0x94, 0xA3, 0x9A, 0x3F, 0xE6, 0x51, 0x13, 0xCC, 0x9C,
+    0xE8, 0xB0, 0x03, 0xD3, 0x50, 0x7A, 0x3B, 0xFE, 0xF5, 0xD2, 0x32, 0x67, 0xBB, 0x4B, 0x57, 0x79,
+    0x3A, 0xB6, 0xBF, 0x30, 0x32, 0xC3, 0x6E, 0x37, 0xD4, 0x6B, 0xB3, 0x14, 0xBC, 0x2C, 0xAC, 0x85,
+    0x74, 0x61, 0x8B, 0x1B, 0x1B, 0x12, 0xB8, 0xC6, 0xA4, 0x31, 0xD7, 0x64, 0x06, 0x9B, 0x73, 0xF3,
+    0x72, 0x69, 0xC7, 0x0C, 0xE6, 0x6C, 0x65, 0x6F, 0x80, 0xFD, 0xCA, 0x6B, 0xF7, 0xC0, 0x47, 0x11,
+    0x5A, 0x2B, 0x99, 0x86, 0x65, 0x90, 0x00, 0xA8, 0x59, 0x7D, 0xDA, 0xBC, 0x83, 0xA2, 0x60, 0x07,
+    0xA2, 0x97, 0xBA, 0xAA, 0xB4, 0xBF, 0x79, 0x3E, 0xD6, 0x0B, 0x3A, 0xB5, 0xAA, 0x1F, 0x14, 0x51,
+    0x32, 0xB1, 0x97, 0xFC, 0xC0, 0x97, 0x93, 0x99, 0xDA, 0xC1, 0x78, 0x1E, 0xBF, 0xD4, 0x28, 0x7C,
+    0xC6, 0x8F, 0xC8, 0x2F, 0x54, 0x9F, 0xFE, 0xE1, 0x5D, 0x57, 0xBD, 0xF6, 0x50, 0xD0, 0x83, 0x82,
+    0x6C, 0xA0, 0x0D, 0xA5, 0x40, 0xD7, 0x2E, 0x4A, 0x0D, 0x9A, 0x4F, 0x1D, 0x32, 0x81, 0xCC, 0x94,
+    0x29, 0xBF, 0x17, 0x25, 0xFA, 0xC8, 0xAC, 0x32, 0xAD, 0xAA, 0xD2, 0x6E, 0xA6, 0x4D, 0xEA, 0x98,
+    0x7D, 0x8E, 0xA4, 0x6B, 0xB4, 0x14, 0x2C, 0xEF, 0xB8, 0xD1, 0xB2, 0x58, 0x45, 0x73, 0x9B, 0x52,
+    0x5C, 0x7A, 0xF5, 0x73, 0x2E, 0xE3, 0x09, 0xFA, 0xFD, 0xAA, 0x21, 0x03, 0xEB, 0x7D, 0xDB, 0x25,
+    0xF7, 0x67, 0x24, 0x83, 0xD0, 0xEF, 0xA3, 0x56, 0x94, 0x96, 0xDD, 0xFE, 0x8C, 0xB7, 0xAB, 0x70,
+    0xDD, 0xE9, 0x6E, 0xA2, 0xCE, 0xA9, 0xF4, 0x77, 0xC0, 0x33, 0xF4, 0xBC, 0xA1, 0xF0, 0xDB, 0x63,
+    0xA9, 0xD7, 0x33, 0x58, 0x4D, 0x37, 0x0D, 0xE1, 0xBF, 0x1C, 0x7F, 0x02, 0x7D, 0x55, 0xB1, 0x8E,
+    0xDC, 0x36, 0x10, 0x1D, 0x49, 0x80, 0x05, 0x44, 0x05, 0xD3, 0x06, 0x29, 0xF4, 0x09, 0xFC, 0x04,
+    0x0A, 0x76, 0x71, 0x45, 0x1A, 0xA7, 0x70, 0x75, 0x45, 0x3E, 0x20, 0x85, 0x3F, 0x81, 0xBA, 0x5C,
+    0xE1, 0x22, 0x85, 0xD3, 0xB8, 0xBF, 0x22, 0xD5, 0xB9, 0xF0, 0x27, 0x50, 0xF6, 0x15, 0x57, 0xB8,
+    0xF0, 0xC2, 0x81, 0x91, 0x22, 0x45, 0x04, 0x1B, 0x41, 0x80, 0x4B, 0x61, 0xDA, 0x96, 0x71, 0xDA,
+    0x0D, 0xA5, 0xC9, 0x7B, 0xD4, 0x05, 0x30, 0x62, 0x20, 0x7B, 0xB7, 0xA4, 0x96, 0x22, 0x67, 0xE6,
+    0xBD, 0x79, 0x33, 0x14, 0xE1, 0xA7, 0x8D, 0x52, 0xEA, 0xBE, 0x4E, 0xD2, 0xA8, 0x7E, 0x54, 0x31,
+    0xAA, 0xC9, 0x0F, 0x46, 0xAF, 0xB4, 0x8D, 0xCD, 0x2A, 0xE5, 0x51, 0xAA, 0x56, 0x91, 0x42, 0x0B,
+    0xC5, 0x5E, 0x3F, 0x84, 0x01, 0x27, 0x0E, 0xE1, 0x70, 0x7E, 0x56, 0x2B, 0x3E, 0x4B, 0xC1, 0x51,
+    0x3B, 0xCF, 0x71, 0xD7, 0x46, 0x37, 0x8A, 0xD4, 0xC9, 0x24, 0x9E, 0x28, 0xB7, 0x13, 0x3E, 0xD2,
+    0x87, 0x81, 0x91, 0xA3, 0x54, 0xE8, 0xFE, 0xF8, 0x9D, 0x8A, 0xCD, 0x3E, 0x78, 0x14, 0xCE, 0x1B,
+    0x5D, 0x3B, 0x6C, 0x2C, 0xBA, 0x1C, 0x8D, 0xB8, 0x9D, 0x78, 0x7D, 0x38, 0x8B, 0xEA, 0xF5, 0x8A,
+    0x21, 0x69, 0x1F, 0xC6, 0xAF, 0xDC, 0x08, 0xC3, 0x66, 0x36, 0x51, 0x2A, 0x3A, 0x1A, 0x38, 0x44,
+    0x87, 0x21, 0x99, 0xF5, 0xC9, 0xE1, 0xBC, 0x5A, 0x2B, 0x78, 0xD4, 0x5E, 0x7B, 0x71, 0xA3, 0x9D,
+    0x8A, 0x17, 0x33, 0xB6, 0x7D, 0x58, 0xC5, 0xF1, 0x78, 0xA9, 0x2B, 0xED, 0xDE, 0xC5, 0x57, 0x77,
+    0x18, 0x2C, 0xC3, 0xAA, 0x74, 0x62, 0x70, 0xA1, 0x17, 0x69, 0xDE, 0xE3, 0xAC, 0xAC, 0x2D, 0xDE,
+    0xD9, 0x01, 0xEF, 0xAA, 0xD4, 0x20, 0x62, 0xFF, 0x08, 0xEF, 0xC0, 0x08, 0xED, 0x02, 0x99, 0xB4,
+    0x0A, 0x33, 0x55, 0xF2, 0x0F, 0xA3, 0xB8, 0xCB, 0xD9, 0x77, 0xCD, 0xE4, 0x4F, 0x93, 0x68, 0x3D,
+    0xBB, 0xA1, 0x8D, 0xFE, 0x64, 0x2D, 0x97, 0x1A, 0xE1, 0xB9, 0xC1, 0xF7, 0x7A, 0x94, 0xEA, 0xB9,
+    0x9E, 0xC1, 0x49, 0xEF, 0x06, 0xA9, 0xE9, 0xCD, 0x65, 0x06, 0x61, 0xAA, 0xB9, 0x86, 0x5B, 0x07,
+    0x1B, 0x65, 0x6A, 0x07, 0x31, 0xA3, 0xEB, 0x01, 0x56, 0x09, 0x6A, 0xA5, 0x87, 0x24, 0xC1, 0x5E,
+    0x4E, 0x55, 0x0A, 0x26, 0xDA, 0x97, 0xC9, 0x0D, 0xDA, 0x44, 0xFF, 0x60, 0x46, 0x54, 0x6E, 0x17,
+    0xCA, 0xC5, 0xE3, 0xC4, 0x42, 0x46, 0x33, 0x04, 0x4C, 0x4E, 0x3B, 0x4E, 0x44, 0x81, 0x29, 0xD8,
+    0x81, 0x13, 0x81, 0x80, 0xDB, 0x05, 0x5C, 0xF9, 0x21, 0x63, 0xF1, 0x57, 0x8F, 0xF7, 0xC7, 0xB3,
+    0xE4, 0x14, 0xA5, 0x6D, 0x5A, 0xB6, 0x69, 0xC5, 0x16, 0xA0, 0xD1, 0x6D, 0xF2, 0x1D, 0xD2, 0x7B,
+    0x04, 0x40, 0x7E, 0xC8, 0xB8, 0xFC, 0x53, 0x4C, 0xED, 0xE8, 0x9F, 0x65, 0x68, 0xFE, 0x02, 0xB0,
+    0xCC, 0xE4, 0x2F, 0x33, 0x3A, 0xFF, 0x02, 0x03, 0x02, 0x05, 0x3B, 0x23, 0x68, 0x13, 0x07, 0xF9,
+    0x44, 0xC4, 0xD5, 0x97, 0x49, 0xCC, 0x5F, 0x51, 0x02, 0x7E, 0x2E, 0x78, 0x51, 0x01, 0x05, 0x58,
+    0x5C, 0x8F, 0xA7, 0x72, 0x73, 0x18, 0x72, 0xFE, 0xEC, 0x2B, 0xFF, 0xF6, 0xEF, 0xB9, 0x89, 0xE6,
+    0x43, 0xD2, 0x32, 0xD5, 0x93, 0xB6, 0xBB, 0x80, 0xAD, 0x17, 0xC9, 0x3E, 0x5D, 0x4D, 0xD4, 0x6F,
+    0x62, 0xB8, 0x93, 0xDA, 0xD7, 0x64, 0xA0, 0x4A, 0x59, 0x67, 0x43, 0xCB, 0x51, 0x98, 0xF2, 0x0D,
+    0x09, 0xF0, 0xF6, 0x39, 0xE9, 0x1D, 0x04, 0x23, 0x7A, 0x67, 0x61, 0x7A, 0xED, 0x48, 0x9E, 0x35,
+    0x27, 0x19, 0xDC, 0x50, 0x2B, 0x5D, 0x3E, 0xD3, 0x15, 0xFA, 0xE4, 0x1A, 0xDA, 0x9E, 0xFD, 0x05,
+    0xA0, 0x3F, 0xD5, 0x66, 0x2E, 0xB5, 0x4E, 0x50, 0xE5, 0x04, 0xC9, 0xEE, 0xA0, 0xD1, 0x21, 0xFC,
+    0xA0, 0xD4, 0xB8, 0x99, 0xEA, 0x54, 0x81, 0x69, 0x68, 0x7F, 0xA6, 0xCB, 0x13, 0x3A, 0x34, 0xD9,
+    0xF5, 0x60, 0x77, 0xB2, 0x36, 0x93, 0xD4, 0xFB, 0x95, 0xF6, 0x07, 0xAA, 0x03, 0x95, 0xB3, 0x51,
+    0x3A, 0x9A, 0xF7, 0x20, 0x63, 0xB1, 0x17, 0x93, 0x7D, 0x96, 0xDC, 0x69, 0xE2, 0x78, 0x3B, 0xB5,
+    0xBF, 0x45, 0x3B, 0xAC, 0x30, 0x4E, 0x2B, 0x6D, 0xB4, 0xC4, 0x50, 0x6F, 0x80, 0x4E, 0x34, 0x53,
+    0x01, 0xCF, 0x06, 0x80, 0xE0, 0x8F, 0x48, 0x06, 0x54, 0x21, 0x44, 0xB4, 0x43, 0xAD, 0x15, 0x0A,
+    0xC5, 0xFB, 0xAB, 0xF3, 0x00, 0x7E, 0x33, 0x76, 0x95, 0x7C, 0x4E, 0xA7, 0xAD, 0xE2, 0x98, 0xB3,
+    0xF6, 0xA0, 0x7E, 0x24, 0x88, 0x80, 0xA4, 0xE0, 0xCF, 0x46, 0x98, 0x2D, 0xD7, 0x06, 0xC0, 0x90,
+    0xC2, 0xDB, 0xE0, 0x8E, 0x0F, 0x61, 0xD0, 0x07, 0xC9, 0x8E, 0x36, 0xDA, 0x77, 0x80, 0xD7, 0x24,
+    0x88, 0xF8, 0x32, 0xA1, 0x36, 0x51, 0x58, 0x24, 0x68, 0xCA, 0x63, 0x0C, 0x34, 0x3B, 0x06, 0x09,
+    0x14, 0x41, 0x2E, 0x84, 0x20, 0xC8, 0x4E, 0x0E, 0x72, 0xCA, 0xE3, 0xB2, 0xE5, 0xAE, 0x0B, 0xF7,
+    0x18, 0x77, 0x28, 0x16, 0xF7, 0x70, 0x0C, 0x65, 0x72, 0x3F, 0xC6, 0x50, 0xCD, 0xEE, 0x41, 0x0C,
+    0xF5, 0xE4, 0x4E, 0xE7, 0xD0, 0x44, 0xC0, 0x0F, 0x90, 0xF6, 0x09, 0xCB, 0xEA, 0x4B, 0xB1, 0x7D,
+    0xE6, 0x6D, 0x91, 0xEA, 0x80, 0x05, 0x83, 0xE4, 0x34, 0xBA, 0x27, 0x77, 0xAC, 0x51, 0x1D, 0xDB,
+    0xFD, 0xB1, 0x76, 0x67, 0xC8, 0x0C, 0xF3, 0x87, 0x6A, 0x34, 0x28, 0x10, 0x04, 0x77, 0xEB, 0x31,
+    0x08, 0x66, 0xDD, 0x19, 0x3D, 0x08, 0x1C, 0x33, 0xBD, 0x9E, 0x25, 0xCB, 0xFE, 0xC3, 0xBC, 0x53,
+    0xEA, 0xC2, 0x3E, 0xF3, 0xB5, 0xF6, 0xE0, 0x35, 0xB2, 0x7A, 0x60, 0x70, 0x2F, 0xFE, 0x8F, 0x0E,
+    0x1D, 0x88, 0x1B, 0x76, 0x92, 0x15, 0x40, 0xFA, 0x26, 0xE6, 0x68, 0x6B, 0x30, 0x45, 0x57, 0x9C,
+    0xD5, 0xE0, 0xAC, 0x48, 0xEE, 0x67, 0x09, 0x8B, 0xDC, 0x82, 0x28, 0x2D, 0x13, 0x88, 0x5D, 0x5F,
+    0x74, 0x8C, 0xA3, 0xC6, 0xB7, 0xE1, 0x09, 0x24, 0x80, 0x15, 0x86, 0x59, 0xEE, 0x73, 0x3D, 0x6D,
+    0xAE, 0x5B, 0xB0, 0xA7, 0x13, 0xAC, 0x8E, 0x0E, 0xAD, 0xCB, 0xBF, 0xEA, 0x40, 0x15, 0x02, 0x43,
+    0xF0, 0x70, 0x32, 0x40, 0x6E, 0x54, 0x3C, 0xA2, 0x13, 0x76, 0x80, 0xDE, 0x3D, 0x47, 0x9D, 0xA0,
+    0x52, 0xD0, 0x0C, 0xFE, 0xF7, 0x91, 0xDD, 0xC2, 0x5D, 0x26, 0x3E, 0xBA, 0x9D, 0xA3, 0x1E, 0xEF,
+    0x24, 0x3B, 0x99, 0x2D, 0xD5, 0x59, 0xF0, 0xA4, 0x4B, 0xE4, 0xFB, 0xF5, 0x27, 0x76, 0x14, 0xDA,
+    0xCF, 0x3C, 0x7C, 0xF6, 0x78, 0xD3, 0x46, 0xF9, 0x88, 0x1E, 0xF0, 0xEF, 0x2B, 0xFD, 0x74, 0x91,
+    0x4E, 0xCC, 0xA4, 0x1D, 0xC4, 0x42, 0x5F, 0xFE, 0xC5, 0x64, 0x50, 0x8A, 0x0B, 0x96, 0x17, 0x2C,
+    0x8A, 0x7A, 0x2C, 0xBA, 0xDF, 0xB9, 0x78, 0xFD, 0xC9, 0xE2, 0x88, 0x9D, 0xCF, 0x13, 0xF4, 0x19,
+    0xF5, 0xCF, 0x25, 0x4C, 0x54, 0xF3, 0x5C, 0xE6, 0x82, 0x6C, 0x72, 0x64, 0xD5, 0xF2, 0x99, 0xA3,
+    0xCF, 0xBD, 0xE7, 0x4F, 0x6E, 0xC9, 0xCD, 0xCD, 0x49, 0xD2, 0xF5, 0x28, 0x40, 0x0D, 0xC8, 0x16,
+    0xAF, 0x0C, 0x37, 0x42, 0x07, 0x4D, 0xCA, 0x65, 0xDD, 0x7E, 0xBC, 0x77, 0xCF, 0xFF, 0x4A, 0x0E,
+    0x3E, 0xE6, 0xB6, 0x95, 0xBB, 0xD6, 0x77, 0xB0, 0xEB, 0x7E, 0xA1, 0x98, 0x22, 0x76, 0x52, 0xF6,
+    0x82, 0x0B, 0x80, 0xB5, 0x28, 0x01, 0x6A, 0xEA, 0xCD, 0xD6, 0x1E, 0x14, 0x2F, 0x6F, 0xE5, 0xBB,
+    0xA5, 0xB8, 0x7B, 0xE3, 0x37, 0xAC, 0x54, 0x04, 0x2E, 0x37, 0x8D, 0x76, 0x7F, 0x7F, 0x76, 0x63,
+    0x8D, 0x6B, 0xA8, 0x5A, 0xC2, 0xD5, 0xE3, 0x15, 0xDB, 0xB7, 0x2F, 0x9E, 0xB9, 0xE6, 0x76, 0x30,
+    0xBC, 0xB7, 0x89, 0x7B, 0x2B, 0x0A, 0x31, 0xAC, 0xF9, 0x8E, 0x0A, 0xB0, 0xA7, 0xF7, 0x11, 0x81,
+    0xBE, 0x61, 0xF7, 0x99, 0xE1, 0xC4, 0x1F, 0x10, 0x81, 0x8D, 0x40, 0x0A, 0xF1, 0x6A, 0x07, 0x99,
+    0xD8, 0x58, 0xF2, 0xB2, 0xC0, 0x0F, 0xFC, 0xB3, 0x5F, 0x8F, 0xE8, 0x4C, 0xA0, 0x9C, 0xC7, 0x8E,
+    0xA8, 0xA0, 0xD7, 0x2B, 0x99, 0x21, 0x2B, 0x4A, 0x1D, 0xB7, 0x6F, 0xB3, 0x56, 0xC9, 0x17, 0x6F,
+    0x09, 0x69, 0x97, 0x7C, 0x45, 0xDD, 0x44, 0x0D, 0x4D, 0xE6, 0xE6, 0xAF, 0x6F, 0x16, 0x69, 0x57,
+    0x3B, 0x56, 0xFA, 0x2D, 0xDB, 0x11, 0x6A, 0x79, 0x86, 0xEA, 0xB4, 0x63, 0x99, 0x8B, 0x7B, 0xB9,
+    0x48, 0xB1, 0x82, 0x62, 0x73, 0x0D, 0xA9, 0x06, 0x84, 0x59, 0xD3, 0xDE, 0x76, 0xF3, 0x0C, 0xB2,
+    0x15, 0xD8, 0x7F, 0x3E, 0xFF, 0x00, 0x6D, 0x55, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0x7B, 0xC9,
+    0x59, 0x3A, 0x17, 0x7B, 0x05, 0x48, 0x48, 0x48, 0xB8, 0x49, 0x89, 0xE4, 0xF6, 0x1A, 0xB4, 0x2F,
+    0x3A, 0x09, 0x4A, 0x1E, 0x82, 0x57, 0xA5, 0xB8, 0xAB, 0xD3, 0xD0, 0x50, 0x22, 0xD9, 0xE8, 0x8A,
+    0x14, 0x14, 0x40, 0x03, 0xFF, 0x03, 0x34, 0xFC, 0x05, 0xAC, 0xC9, 0x15, 0x57, 0x5C, 0x11, 0x93,
+    0x2B, 0x28, 0x28, 0x62, 0x29, 0x20, 0x90, 0x52, 0x64, 0x13, 0x8C, 0xF0, 0x1D, 0xEB, 0x1D, 0xBE,
+    0xD9, 0xF5, 0xCB, 0x3D, 0x10, 0x7E, 0x4F, 0xDE, 0x9D, 0xFD, 0x31, 0xF3, 0xCD, 0x37, 0x3F, 0x7C,
+    0x6B, 0xBD, 0x21, 0xCA, 0x67, 0xD3, 0x11, 0x99, 0xB3, 0x89, 0x48, 0x4D, 0x86, 0x30, 0x55, 0x8E,
+    0x28, 0x5B, 0xBD, 0x4A, 0xF1, 0xC9, 0x67, 0xAC, 0xCF, 0xB6, 0x23, 0xC5, 0x9F, 0x3B, 0xBC, 0x9E,
+    0x04, 0xCA, 0xF8, 0x77, 0xC8, 0xB6, 0xD3, 0x8E, 0x4C, 0xAF, 0x66, 0xAA, 0x1C, 0x84, 0x72, 0x22,
+    0xED, 0x20, 0xA8, 0x39, 0x63, 0x22, 0xDB, 0xDA, 0x16, 0x32, 0x34, 0xAB, 0x19, 0xDB, 0xD4, 0x7C,
+    0x06, 0xF5, 0xFA, 0x0F, 0x2F, 0xBA, 0xB0, 0x4D, 0x8D, 0x5D, 0x41, 0x66, 0x18, 0x56, 0xEC, 0x44,
+    0x1E, 0xF1, 0xD2, 0xD8, 0x7E, 0xED, 0xCE, 0x1A, 0x47, 0x70, 0x4F, 0x3F, 0x0F, 0x80, 0xF2, 0x2E,
+    0x36, 0x7D, 0xD5, 0xBD, 0x84, 0xA3, 0x27, 0x00, 0x6A, 0x3A, 0xE2, 0x27, 0x30, 0x1B, 0xEA, 0x41,
+    0xF1, 0xFB, 0x4C, 0xA6, 0xD3, 0x23, 0xCC, 0xDB, 0x96, 0x57, 0xCA, 0xC3, 0x9A, 0x79, 0x34, 0x53,
+    0x16, 0x44, 0xC7, 0x5F, 0xB0, 0x6A, 0x61, 0xAA, 0x10, 0x23, 0x06, 0x0A, 0x33, 0x31, 0x09, 0x25,
+    0x3B, 0x4F, 0x66, 0xC3, 0x2A, 0xCD, 0x2C, 0x73, 0x9A, 0x18, 0x66, 0x1F, 0x27, 0x25, 0x7F, 0xC3,
+    0x43, 0x9C, 0x71, 0xA7, 0x38, 0x1E, 0xAB, 0x47, 0xDC, 0x37, 0x03, 0x35, 0x97, 0xE2, 0xE6, 0x03,
+    0xA6, 0xD2, 0x43, 0x2A, 0xBC, 0x1E, 0x89, 0x4F, 0xC1, 0x55, 0xD3, 0x71, 0x57, 0xB9, 0xA6, 0x87,
+    0x17, 0x85, 0xCF, 0xB9, 0xC0, 0x92, 0xE9, 0xE5, 0x17, 0x97, 0xB0, 0xE0, 0x95, 0x9C, 0xEA, 0xB5,
+    0xB3, 0x6D, 0xBC, 0x48, 0xFC, 0xDE, 0xA8, 0x44, 0x57, 0x57, 0x80, 0x9A, 0xDA, 0x09, 0x3C, 0xF3,
+    0x6C, 0x48, 0x16, 0x73, 0x00, 0x29, 0xF9, 0x2B, 0xC0, 0x17, 0xB2, 0x12, 0x2E, 0x06, 0x57, 0x2C,
+    0x50, 0x0B, 0x16, 0x87, 0x04, 0x96, 0x11, 0x90, 0xC2, 0x90, 0xE8, 0x4E, 0x0F, 0x48, 0xA2, 0x2D,
+    0x65, 0xE9, 0xF9, 0x96, 0xB7, 0x2B, 0xDC, 0x2F, 0x33, 0x51, 0xF5, 0xEF, 0x43, 0x8B, 0xDB, 0x03,
+    0x14, 0x01, 0x29, 0x73, 0x6F, 0x24, 0xB8, 0x30, 0x87, 0xA8, 0xEA, 0xB1, 0x9E, 0x2A, 0x38, 0x9A,
+    0xB1, 0x0A, 0xF0, 0xC0, 0x76, 0xF5, 0xD0, 0x74, 0x2A, 0x28, 0x78, 0x54, 0x7A, 0x60, 0x80, 0x8F,
+    0x9D, 0xED, 0x72, 0xCE, 0x42, 0x39, 0x61, 0xA1, 0x76, 0xDA, 0x31, 0x2E, 0xE3, 0xB0, 0x3D, 0x76,
+    0x85, 0x9C, 0x50, 0xD7, 0x33, 0xDE, 0xE0, 0xC4, 0x30, 0xCE, 0x7D, 0xCA, 0x5D, 0xC6, 0x48, 0x1B,
+    0x06, 0x0C, 0x0D, 0x37, 0x0C, 0x03, 0xBD, 0x45, 0xA4, 0x2C, 0x22, 0x85, 0x5B, 0xC9, 0xA5, 0xAD,
+    0x23, 0xA5, 0x5F, 0xE2, 0x95, 0xE2, 0x40, 0xFB, 0x72, 0x32, 0xCA, 0xCB, 0x46, 0xB5, 0x6C, 0x64,
+    0xDC, 0xCA, 0xB0, 0x27, 0x2F, 0x25, 0x7B, 0x7B, 0xA2, 0xB7, 0x60, 0x0E, 0x94, 0xC3, 0x91, 0x89,
+    0x1A, 0xBC, 0x07, 0x1D, 0xEA, 0x0B, 0x96, 0xA3, 0xD5, 0x04, 0x17, 0x89, 0xCF, 0x60, 0xAF, 0x9C,
+    0x11, 0x24, 0x6A, 0x7E, 0x92, 0x94, 0x0F, 0x32, 0x35, 0xBF, 0xDD, 0x4C, 0x2F, 0x71, 0xA0, 0x98,
+    0xE3, 0xD9, 0x07, 0x72, 0xCD, 0xEB, 0x50, 0xDD, 0xE7, 0x55, 0x54, 0x26, 0x7A, 0x7D, 0x32, 0x01,
+    0xF2, 0xC2, 0xD6, 0x30, 0xED, 0x47, 0x44, 0x6B, 0x49, 0x29, 0x60, 0xAA, 0x71, 0xAD, 0x66, 0x6E,
+    0xE1, 0x70, 0xC8, 0xD9, 0x3E, 0x1B, 0xCD, 0xE0, 0xF8, 0x1C, 0xF7, 0xA4, 0xBC, 0xCC, 0xCF, 0x1E,
+    0x96, 0x64, 0xF2, 0x54, 0x26, 0xF0, 0x1A, 0x16, 0xF7, 0x4B, 0x5F, 0xFD, 0x1D, 0xB8, 0x45, 0x66,
+    0xBA, 0x5C, 0xA0, 0xEF, 0xF1, 0xD5, 0xA2, 0x7B, 0x7F, 0x37, 0x60, 0xCD, 0xB8, 0x04, 0xF6, 0x7A,
+    0x15, 0x09, 0x48, 0x94, 0x54, 0x77, 0x6C, 0xE4, 0xEE, 0x03, 0x77, 0xB0, 0x9B, 0x12, 0xD9, 0xC2,
+    0x97, 0x8E, 0x34, 0x51, 0x91, 0x12, 0x9C, 0x4E, 0x12, 0x77, 0x03, 0xD9, 0x5F, 0x24, 0xBF, 0xBA,
+    0x06, 0x49, 0x67, 0x78, 0x42, 0x0E, 0x74, 0x3A, 0x1C, 0xD3, 0x9B, 0xC7, 0x01, 0x6C, 0x41, 0x91,
+    0x71, 0x75, 0x24, 0x9E, 0x8F, 0xE6, 0x94, 0x39, 0x26, 0x66, 0x93, 0x3D, 0x8B, 0x6A, 0x0B, 0x9F,
+    0xAC, 0x34, 0xE7, 0x37, 0xA2, 0xFC, 0xB1, 0x5B, 0xC8, 0x1F, 0x87, 0x21, 0xDA, 0x53, 0x16, 0x51,
+    0x4F, 0xD5, 0x08, 0x31, 0x67, 0xE2, 0x1E, 0xE1, 0xB5, 0xAE, 0xE4, 0xA7, 0x7C, 0x6D, 0x25, 0x3D,
+    0xE4, 0x69, 0x01, 0xE3, 0x1A, 0xEC, 0x02, 0xD5, 0x5C, 0xC4, 0x3A, 0x3C, 0x40, 0x23, 0x10, 0xB5,
+    0xF7, 0x56, 0x29, 0xE0, 0x5F, 0x08, 0xD3, 0x1C, 0x3B, 0x88, 0xB9, 0x2B, 0xE9, 0xAD, 0x1E, 0xBD,
+    0xF3, 0x5D, 0x04, 0x97, 0x3C, 0x4C, 0x19, 0x52, 0xEF, 0xFA, 0x39, 0xEE, 0xA6, 0x79, 0xDB, 0x20,
+    0xCD, 0xD9, 0x97, 0x60, 0x16, 0x75, 0x64, 0x78, 0xA8, 0xAF, 0x4E, 0xB2, 0xAF, 0x39, 0xE6, 0x9E,
+    0x9E, 0xA2, 0x27, 0x7C, 0xE1, 0x63, 0xF2, 0xD9, 0x2E, 0xFB, 0x90, 0x1A, 0x08, 0xA8, 0x53, 0x08,
+    0x02, 0xF7, 0x5C, 0x04, 0x8D, 0xF2, 0x87, 0xC0, 0xA7, 0xA8, 0xD2, 0x3F, 0x1B, 0x57, 0x09, 0x70,
+    0x54, 0x07, 0xBF, 0xE0, 0x98, 0xDD, 0x11, 0x77, 0xA2, 0x9F, 0x36, 0x9B, 0x4D, 0xC4, 0x96, 0xDA,
+    0x4C, 0x4C, 0x16, 0xA2, 0x8F, 0x0F, 0xDF, 0xA2, 0xE8, 0xD9, 0x2B, 0x37, 0xD1, 0x14, 0x46, 0xC0,
+    0x5C, 0xBF, 0x3B, 0x98, 0x21, 0xDB, 0x0E, 0x2B, 0xB4, 0x1C, 0x47, 0xDB, 0xA1, 0x2D, 0x7D, 0xED,
+    0xD0, 0xD7, 0x84, 0x4C, 0x85, 0x61, 0xD4, 0x53, 0x1A, 0x7C, 0xC1, 0x7D, 0xE5, 0x4A, 0xAF, 0x79,
+    0xA8, 0xD0, 0x99, 0x35, 0x3B, 0xF4, 0xCB, 0x50, 0x3D, 0x1E, 0x4D, 0x9F, 0x71, 0xFD, 0x50, 0xDC,
+    0xE3, 0xE6, 0xBE, 0x47, 0xA3, 0xB6, 0x7C, 0x14, 0x58, 0xDA, 0x5E, 0x26, 0x98, 0x6A, 0x84, 0x03,
+    0x3E, 0x6B, 0x78, 0x31, 0x49, 0xCA, 0x93, 0xE4, 0x7C, 0xB6, 0xD9, 0xAC, 0x63, 0x66, 0xCD, 0xA9,
+    0x3F, 0x0A, 0x27, 0x85, 0x6A, 0x77, 0x93, 0x50, 0x22, 0x0A, 0x62, 0xAE, 0x18, 0x1F, 0x04, 0x49,
+    0xE0, 0xD4, 0xDA, 0x80, 0xDA, 0x5C, 0x42, 0x47, 0x6C, 0x78, 0x7A, 0x2A, 0xBC, 0x6C, 0xE6, 0x68,
+    0x1A, 0x39, 0x77, 0xBC, 0xC2, 0x0F, 0x1F, 0x89, 0x6A, 0xB0, 0x01, 0xCB, 0xDE, 0xD8, 0x8B, 0x91,
+    0xEC, 0x47, 0x0F, 0xF1, 0x9D, 0xD0, 0xFC, 0x23, 0x4C, 0xE5, 0xC0, 0x2C, 0xC0, 0x46, 0x69, 0xBE,
+    0x42, 0xF9, 0xB6, 0xA9, 0xD5, 0x08, 0x7D, 0x2D, 0x55, 0x0C, 0x40, 0x0A, 0x29, 0xD3, 0x81, 0xE6,
+    0xDB, 0x15, 0xE0, 0xE6, 0x82, 0x4C, 0xDA, 0x61, 0xEC, 0x84, 0x52, 0xB8, 0xC5, 0x76, 0x12, 0x57,
+    0xE2, 0x16, 0xA7, 0x3E, 0x8E, 0x18, 0xC8, 0x3E, 0xFF, 0x7A, 0x2F, 0xEA, 0x42, 0xD0, 0x82, 0x7C,
+    0x04, 0x70, 0xA2, 0x08, 0xDB, 0xA3, 0xFF, 0x3F, 0x91, 0xDC, 0x19, 0x51, 0xEE, 0x3F, 0xA0, 0xD2,
+    0xCC, 0xD5, 0xDD, 0xA3, 0x10, 0x8B, 0x4B, 0x3A, 0x94, 0x7D, 0x39, 0xC0, 0x7D, 0xB9, 0xA0, 0xF8,
+    0xCB, 0x13, 0xA0, 0x24, 0x29, 0x27, 0x0B, 0xC3, 0x28, 0x1E, 0xF9, 0x40, 0x56, 0xFF, 0x1D, 0x52,
+    0x69, 0x0A, 0xCC, 0x9E, 0x0E, 0x4B, 0x54, 0xCC, 0x71, 0x0C, 0x01, 0x3E, 0x64, 0x82, 0x73, 0xA0,
+    0xFC, 0x85, 0x3F, 0x50, 0xFD, 0xE1, 0xDB, 0x65, 0x4B, 0xE6, 0xF1, 0x82, 0x50, 0x1A, 0x1D, 0x7A,
+    0x67, 0xFE, 0x1C, 0x1D, 0xA3, 0x7F, 0x9D, 0xB0, 0x45, 0xC5, 0x6E, 0x40, 0x3E, 0x41, 0x47, 0xB5,
+    0xEC, 0xBF, 0xDF, 0xAC, 0x6F, 0x2F, 0xB4, 0x4D, 0x6F, 0x70, 0x40, 0xC7, 0x6A, 0x06, 0x73, 0x40,
+    0xB7, 0xE8, 0x1F, 0xDD, 0x54, 0xBF, 0x8B, 0xD4, 0x40, 0x14, 0x7E, 0xC9, 0xC2, 0x46, 0x09, 0x18,
+    0x0B, 0x0B, 0x0B, 0x31, 0x16, 0x56, 0x7A, 0x98, 0xC6, 0x42, 0x04, 0x49, 0x5A, 0x3B, 0x41, 0x3D,
+    0xB0, 0xD2, 0xC2, 0x46, 0x50, 0x4E, 0x04, 0x3B, 0x21, 0x39, 0x1B, 0x4B, 0xEF, 0x3F, 0xD0, 0xC2,
+    0x42, 0xAF, 0xF0, 0x5A, 0x0B, 0x75, 0x06, 0x9B, 0x2D, 0x2F, 0x0A, 0x62, 0x71, 0x85, 0x11, 0x04,
+    0x41, 0x8B, 0x0B, 0x92, 0xF3, 0x72, 0x9A, 0xCC, 0xF3, 0x7B, 0x93, 0xD9, 0x73, 0x3D, 0x14, 0xB5,
+    0x75, 0xD8, 0x99, 0xF7, 0xF6, 0x7D, 0x6F, 0xDF, 0x7C, 0xEF, 0xC7, 0x2C, 0xC5, 0xAB, 0x9B, 0xCD,
+    0xD3, 0xA8, 0xBC, 0x4C, 0xC9, 0x6A, 0xF3, 0x2C, 0x4E, 0x4F, 0xD3, 0xF8, 0x3E, 0xA5, 0x5C, 0xE4,
+    0x6C, 0x9E, 0x5F, 0x34, 0x4F, 0xE9, 0x31, 0x11, 0xF9, 0xEF, 0x69, 0x58, 0x5C, 0x0D, 0x72, 0x2E,
+    0x18, 0xA4, 0x97, 0x1D, 0xA2, 0x99, 0xE5, 0xB7, 0x38, 0x02, 0x1C, 0x5C, 0x03, 0x83, 0xF3, 0x81,
+    0x51, 0x36, 0x38, 0x67, 0x7B, 0x61, 0xA0, 0xBD, 0xF4, 0xE7, 0x75, 0xC5, 0x9E, 0xE3, 0xA5, 0x54,
+    0x62, 0xD1, 0x88, 0xEF, 0xCC, 0x97, 0xA2, 0xDC, 0xBC, 0x76, 0x69, 0xB7, 0x05, 0x68, 0x89, 0xFE,
+    0x7E, 0xE5, 0x5A, 0x8E, 0x82, 0x22, 0x86, 0x8C, 0x99, 0x3C, 0x7D, 0x1C, 0x2C, 0x8B, 0xEB, 0x0E,
+    0xF6, 0xEC, 0x99, 0xB9, 0x6F, 0xAA, 0x1C, 0xE4, 0xC1, 0x15, 0x97, 0x4D, 0x71, 0x7C, 0x67, 0xBC,
+    0x13, 0x4E, 0x06, 0x85, 0x53, 0x1A, 0x27, 0x23, 0x7B, 0xEE, 0x26, 0xAF, 0xB6, 0x4A, 0x4D, 0x29,
+    0xD1, 0x7E, 0xA2, 0x50, 0xFC, 0x62, 0xC4, 0x3D, 0x25, 0x12, 0x98, 0x5F, 0xBB, 0x2A, 0xED, 0xC1,
+    0xDE, 0x35, 0x7B, 0xFB, 0xEF, 0xD6, 0xE1, 0x81, 0x4B, 0x36, 0x62, 0x7B, 0x67, 0xBA, 0x14, 0x76,
+    0x43, 0x61, 0xF4, 0x58, 0x5B, 0xE8, 0xEA, 0xDF, 0x16, 0x43, 0xAA, 0xEF, 0x63, 0x87, 0xD3, 0x4E,
+    0xC9, 0x66, 0xDC, 0x1F, 0x20, 0x50, 0x9E, 0xD1, 0x13, 0x3A, 0x26, 0x17, 0x51, 0x54, 0xD0, 0x34,
+    0x8B, 0xB1, 0x95, 0xF1, 0xB4, 0x5C, 0xAE, 0x40, 0x34, 0xF7, 0x53, 0x5C, 0xFF, 0x21, 0x1D, 0x01,
+    0x37, 0xA6, 0x18, 0xD3, 0x11, 0x57, 0x51, 0x23, 0xEC, 0x58, 0x82, 0x27, 0xF6, 0xA4, 0x0B, 0x67,
+    0xA6, 0xAE, 0x5E, 0x8F, 0x0C, 0x1A, 0xE9, 0x48, 0xD2, 0x8B, 0x7B, 0xCC, 0x19, 0xC6, 0x25, 0xE2,
+    0xD2, 0x33, 0x14, 0xB2, 0x00, 0x23, 0x23, 0x80, 0x6F, 0x72, 0x00, 0x1E, 0xC7, 0x02, 0xF0, 0x1D,
+    0x01, 0xD4, 0x0B, 0x01, 0xD2, 0x52, 0x01, 0x48, 0xAB, 0x04, 0x40, 0x5C, 0x87, 0x00, 0xEE, 0x36,
+    0x3E, 0x80, 0xB5, 0x8E, 0x00, 0x7C, 0xEB, 0x09, 0x00, 0x23, 0x16, 0x00, 0x26, 0x9F, 0x19, 0x17,
+    0x90, 0xE2, 0x09, 0x6B, 0x70, 0x79, 0x87, 0x53, 0x2E, 0x91, 0xEA, 0xD9, 0x1A, 0x7A, 0x3C, 0xF4,
+    0x7D, 0x28, 0xAC, 0x4D, 0x2E, 0xB1, 0x99, 0x47, 0xAD, 0xE3, 0x8B, 0xFB, 0x7B, 0x71, 0x86, 0x23,
+    0x2F, 0x2A, 0x0D, 0xBE, 0x88, 0x81, 0x80, 0xF2, 0x8B, 0x73, 0xD3, 0xF4, 0x7B, 0x0A, 0x8D, 0xDC,
+    0xCE, 0x45, 0x52, 0x8E, 0xB8, 0x0A, 0x1B, 0x9F, 0x5B, 0xBF, 0x17, 0x1A, 0x2A, 0x63, 0x05, 0xA3,
+    0xBA, 0x07, 0x63, 0x3E, 0x81, 0x31, 0x7D, 0x09, 0xE3, 0x42, 0x9D, 0x17, 0xC9, 0x7A, 0x1D, 0x57,
+    0x20, 0x13, 0xB4, 0x3E, 0x77, 0xE0, 0xA1, 0x3A, 0x10, 0x5E, 0x47, 0x22, 0xFC, 0x89, 0x29, 0xB0,
+    0x24, 0x3D, 0xCB, 0xD1, 0x52, 0x4C, 0xA7, 0x63, 0x44, 0x51, 0x3D, 0x14, 0x3C, 0xE8, 0xDC, 0x74,
+    0x27, 0x06, 0x5F, 0x98, 0x4B, 0xFC, 0xBC, 0x1F, 0x94, 0x6D, 0x28, 0xE0, 0xAF, 0x19, 0xCC, 0x5C,
+    0xC0, 0xCC, 0xA2, 0xB4, 0x01, 0xAE, 0xD2, 0xB9, 0x0E, 0x3A, 0xF8, 0xA4, 0xA5, 0x53, 0x60, 0xF9,
+    0x08, 0xC8, 0xF9, 0x68, 0x28, 0xC3, 0x0B, 0xF3, 0x8D, 0xAB, 0x4D, 0x82, 0xB6, 0x0A, 0x9A, 0x02,
+    0x8D, 0x18, 0x4F, 0x5B, 0x0C, 0x61, 0xBB, 0xC3, 0xC3, 0x1A, 0xD8, 0x3C, 0x40, 0x75, 0xB8, 0x4C,
+    0x98, 0xBB, 0xB0, 0x1D, 0xF3, 0x6D, 0x83, 0x8A, 0xAA, 0x22, 0xEC, 0x92, 0x2A, 0x30, 0x21, 0x82,
+    0xA0, 0x25, 0x9C, 0x29, 0x94, 0x26, 0xE7, 0xF7, 0x1E, 0xB3, 0xC1, 0x6D, 0x06, 0x45, 0xED, 0x73,
+    0x1D, 0x6F, 0x31, 0x25, 0x9B, 0x28, 0xC3, 0xDB, 0xFA, 0x06, 0xE7, 0x93, 0xF5, 0x9E, 0x23, 0xFE,
+    0xC0, 0xD2, 0x41, 0x6E, 0xC0, 0x6B, 0x91, 0x97, 0x73, 0x90, 0xBD, 0x85, 0x47, 0x94, 0x21, 0x39,
+    0x69, 0x9D, 0x24, 0x2A, 0x6F, 0x2A, 0xD7, 0xEE, 0xFD, 0x4A, 0x1B, 0x72, 0xD6, 0x20, 0x50, 0xAB,
+    0x8D, 0xBC, 0x51, 0x65, 0xD4, 0x2A, 0x1D, 0x76, 0xAA, 0x08, 0x7E, 0xEC, 0xC5, 0x37, 0x9D, 0x9A,
+    0x70, 0xA7, 0x5E, 0x71, 0xAB, 0x36, 0xB8, 0xB1, 0xBE, 0x8A, 0x4B, 0x75, 0x17, 0xB2, 0x38, 0x8B,
+    0xED, 0x69, 0xC9, 0x68, 0xE7, 0x1E, 0x56, 0x82, 0x16, 0xA8, 0x4C, 0x3A, 0x4E, 0xE1, 0x06, 0xB8,
+    0xAD, 0x61, 0x2F, 0x80, 0x3D, 0xA2, 0x7C, 0x06, 0x21, 0x79, 0x99, 0x32, 0x40, 0x18, 0x14, 0xFF,
+    0x5F, 0xBF, 0x62, 0x9D, 0xB7, 0xDD, 0x76, 0x1F, 0x84, 0x74, 0x9F, 0xD7, 0xE7, 0x41, 0xE0, 0x8F,
+    0x9F, 0xC0, 0x15, 0x73, 0x7B, 0x77, 0x43, 0x81, 0x66, 0xB7, 0xB4, 0x77, 0xBA, 0x8F, 0x9A, 0xE5,
+    0xEC, 0x57, 0x3E, 0xB3, 0x1B, 0xCD, 0xAE, 0x10, 0xCA, 0x8A, 0x8F, 0x8F, 0xE4, 0x5D, 0xE3, 0x35,
+    0x5D, 0xDC, 0x3A, 0x07, 0x83, 0x46, 0x83, 0x45, 0x38, 0xE3, 0xCF, 0x02, 0xF1, 0x2B, 0xE1, 0x30,
+    0xA3, 0x68, 0x9A, 0x99, 0xCB, 0x6D, 0xC5, 0x2C, 0x2F, 0x89, 0x4F, 0x29, 0xC3, 0x27, 0xAC, 0x38,
+    0x30, 0xF3, 0xDC, 0xE6, 0xDA, 0xE3, 0x49, 0x07, 0x14, 0x3E, 0xE9, 0x87, 0x0E, 0xE5, 0x81, 0x12,
+    0x63, 0x34, 0x3C, 0x51, 0xA4, 0x66, 0x23, 0xE3, 0x1E, 0x6C, 0xD4, 0x51, 0xBC, 0xC2, 0x85, 0x27,
+    0x53, 0x19, 0xB3, 0x78, 0x08, 0xB2, 0x4F, 0x9E, 0xA8, 0x8C, 0x5A, 0x87, 0x91, 0xAB, 0x93, 0xAF,
+    0xCB, 0x05, 0x0A, 0x24, 0xC3, 0x2A, 0x33, 0x2A, 0xFF, 0x49, 0x18, 0x40, 0xA0, 0x26, 0x34, 0xAA,
+    0x4F, 0xAA, 0x08, 0x83, 0x11, 0x7D, 0x31, 0x94, 0xAE, 0x01, 0x58, 0xA9, 0xC4, 0x4F, 0xF2, 0x40,
+    0x78, 0xF4, 0xE5, 0xA4, 0x6A, 0x31, 0xFB, 0x7A, 0x84, 0xD8, 0x21, 0x17, 0xF4, 0x1F, 0xAE, 0xEF,
+    0x8D, 0x95, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0xC7, 0xC7, 0xCF, 0x42, 0x96, 0xB0, 0x84, 0x7B, 0x1A,
+    0xF7, 0x34, 0xFE, 0x06, 0xF8, 0xE5, 0x13, 0x90, 0x82, 0xA3, 0xA0, 0xC9, 0x07, 0xA0, 0xA0, 0xA5,
+    0x5B, 0x03, 0x45, 0xA4, 0xA4, 0x78, 0xF9, 0x06, 0x50, 0xA2, 0x6B, 0xF8, 0x02, 0x48, 0xEB, 0x28,
+    0xC5, 0x15, 0x57, 0xF0, 0xA4, 0x08, 0xA5, 0x3C, 0x03, 0x42, 0x48, 0x50, 0xDC, 0x12, 0xDE, 0x29,
+    0xE6, 0x62, 0x7B, 0xF8, 0xCD, 0x98, 0x4B, 0x0E, 0x89, 0x3B, 0xA2, 0xD3, 0xAD, 0x77, 0x67, 0x67,
+    0xFF, 0xF3, 0xDF, 0x99, 0xFF, 0xEC, 0x0B, 0xBD, 0x2C, 0x52, 0x8E, 0x1B, 0x95, 0x3A, 0x65, 0x2A,
+    0xD5, 0xC8, 0xD0, 0xEE, 0x25, 0xF4, 0x75, 0x2A, 0x27, 0xD9, 0x68, 0xC6, 0x9F, 0x60, 0xAE, 0x13,
+    0x56, 0x69, 0x1F, 0x6B, 0x39, 0x8A, 0x64, 0x5A, 0xFF, 0x81, 0x55, 0xAA, 0xBF, 0xD4, 0xAC, 0xD2,
+    0x9E, 0xBF, 0xC4, 0x2A, 0xB9, 0xAA, 0x6E, 0xF9, 0xC6, 0xB3, 0x17, 0x93, 0xED, 0x5E, 0x68, 0x3B,
+    0x60, 0x5D, 0xEA, 0x64, 0xE6, 0xC8, 0x59, 0xCC, 0xD5, 0x01, 0xA8, 0x01, 0x2B, 0xB8, 0x98, 0xA3,
+    0x05, 0xD2, 0xB9, 0x3E, 0x58, 0x5C, 0x7D, 0xBA, 0x40, 0x43, 0x74, 0x8E, 0x3D, 0xCB, 0x52, 0x0D,
+    0x1B, 0x80, 0xD9, 0x3F, 0xD2, 0xBE, 0xC9, 0xD2, 0xB8, 0x8A, 0x4A, 0x93, 0x8A, 0x99, 0x4F, 0xE8,
+    0xB9, 0x98, 0xC7, 0xD1, 0x4E, 0xF3, 0xC5, 0xBC, 0x9C, 0x04, 0x8C, 0x88, 0x23, 0xE5, 0xEC, 0xFC,
+    0x8D, 0x77, 0x27, 0x52, 0x2C, 0x1A, 0x7B, 0x3B, 0xAF, 0x2D, 0x7B, 0x6D, 0x52, 0x90, 0xE0, 0xA7,
+    0x20, 0x65, 0xBA, 0xD5, 0x8D, 0x1E, 0x81, 0x00, 0x98, 0x56, 0x93, 0x18, 0xD9, 0x06, 0xA6, 0x52,
+    0xEB, 0x1A, 0xF5, 0x0D, 0x3E, 0xC7, 0x36, 0x34, 0x3A, 0x94, 0xAA, 0x63, 0xAD, 0x7A, 0x68, 0x8F,
+    0x35, 0xDD, 0x15, 0x0B, 0x89, 0x43, 0x0E, 0xAB, 0x76, 0x78, 0xEB, 0x13, 0x03, 0x1E, 0x88, 0xD1,
+    0x41, 0x6A, 0x4F, 0x5C, 0xDB, 0xED, 0xC4, 0xA8, 0x1B, 0x9B, 0xF0, 0xFB, 0x2F, 0xF7, 0xB4, 0xE1,
+    0x7C, 0xC4, 0x23, 0xE2, 0x98, 0x7D, 0x07, 0x26, 0x47, 0x33, 0x36, 0x8B, 0xC4, 0x4D, 0x3A, 0x81,
+    0x9D, 0xBC, 0xD7, 0x79, 0xC4, 0xA8, 0x8F, 0x5A, 0xD5, 0x3B, 0xAA, 0xD3, 0x3B, 0x12, 0xF6, 0x9E,
+    0xAA, 0xB6, 0x7F, 0x37, 0x92, 0xEB, 0x09, 0xE2, 0x07, 0x39, 0x8A, 0x7B, 0x4A, 0x0C, 0xA9, 0x3F,
+    0x1F, 0x15, 0x8A, 0xE7, 0x53, 0x67, 0xC6, 0x75, 0x81, 0xC8, 0xC9, 0x41, 0xB3, 0x95, 0xCD, 0x08,
+    0xE8, 0x96, 0x6C, 0xC8, 0xE6, 0x1B, 0xD2, 0x29, 0xB1, 0x0B, 0x56, 0x9B, 0xD0, 0x03, 0x16, 0x7A,
+    0x38, 0x85, 0x9E, 0x3C, 0x84, 0x9E, 0xAD, 0xD0, 0xE3, 0x18, 0x9E, 0x40, 0x35, 0x9C, 0x02, 0x10,
+    0xCE, 0x40, 0x08, 0x6A, 0xC3, 0x99, 0x51, 0x3F, 0x21, 0x7A, 0x78, 0x42, 0x34, 0xFC, 0xCC, 0x39,
+    0x0C, 0x76, 0xF6, 0x60, 0x28, 0x3A, 0x83, 0x67, 0x43, 0x66, 0x03, 0xF5, 0xBF, 0xAA, 0xEB, 0x8D,
+    0x03, 0x59, 0xD9, 0x96, 0x53, 0x3B, 0x94, 0x73, 0x35, 0x16, 0x73, 0xBE, 0x58, 0x65, 0xBE, 0x24,
+    0x77, 0x3F, 0xA9, 0x89, 0xD2, 0x2A, 0x4A, 0xC9, 0x63, 0x92, 0xF6, 0xE7, 0x85, 0xC4, 0x85, 0x21,
+    0x5F, 0xCA, 0xD9, 0x34, 0xF0, 0x43, 0x18, 0x2A, 0x2E, 0x99, 0xA9, 0x2E, 0x6B, 0xE9, 0x5A, 0xAB,
+    0x78, 0x5A, 0xF3, 0x2F, 0x57, 0x86, 0xB7, 0xBF, 0x36, 0x16, 0x0F, 0x27, 0xAE, 0x1D, 0x4F, 0x1E,
+    0xCE, 0xE5, 0xF4, 0x19, 0xD9, 0x3E, 0x51, 0x3A, 0x22, 0x4C, 0xC2, 0x84, 0xD0, 0xB0, 0x8F, 0xDF,
+    0x4F, 0x52, 0x2E, 0x6A, 0x69, 0x4E, 0x26, 0xA5, 0x4E, 0xE2, 0xE9, 0x2C, 0x6C, 0x25, 0xF3, 0xE9,
+    0x99, 0x2C, 0x4C, 0xE2, 0xC1, 0x8E, 0xF7, 0xF1, 0x71, 0xB1, 0xA0, 0xBC, 0xE6, 0x40, 0xBD, 0xB5,
+    0x37, 0x04, 0x7D, 0xD0, 0x1C, 0x74, 0x17, 0xF6, 0xBA, 0x83, 0xD7, 0x0E, 0x5D, 0xED, 0x90, 0xD5,
+    0x57, 0x68, 0x8A, 0xBA, 0x1B, 0x75, 0xDD, 0x21, 0xE4, 0x1D, 0xAC, 0x77, 0x88, 0x6F, 0xC7, 0x99,
+    0x1D, 0x92, 0x7C, 0x50, 0x8F, 0xDA, 0x15, 0x74, 0x14, 0x0A, 0x67, 0x68, 0xF7, 0x91, 0xCD, 0x5E,
+    0xF5, 0x0B, 0xD3, 0xE5, 0xFD, 0x59, 0xE2, 0xE5, 0x07, 0x23, 0xEA, 0xA6, 0x24, 0x75, 0xA2, 0xE2,
+    0xF5, 0x25, 0xAC, 0xD0, 0x9A, 0xBC, 0x1A, 0x58, 0x26, 0xAA, 0x4E, 0x0F, 0x9A, 0x4B, 0x6D, 0xCE,
+    0x64, 0xA6, 0x4E, 0xF9, 0xFA, 0x00, 0x74, 0x80, 0xC6, 0xBD, 0x21, 0x1B, 0x7C, 0x3D, 0x7A, 0xAA,
+    0x9B, 0xC1, 0xB4, 0x84, 0xA4, 0x5A, 0xB2, 0x46, 0x9C, 0xC9, 0xF2, 0x9B, 0x56, 0xD3, 0x66, 0xE1,
+    0x4E, 0x25, 0x09, 0xDD, 0x36, 0x03, 0x6A, 0x88, 0x9D, 0xF6, 0x1B, 0xBB, 0x68, 0x39, 0x92, 0xC2,
+    0xE6, 0xD7, 0xD9, 0xB2, 0x33, 0xE0, 0x45, 0xC9, 0xCB, 0x91, 0xA1, 0xF9, 0xD1, 0xF2, 0xF4, 0xB9,
+    0x6E, 0x37, 0xCB, 0x86, 0x2C, 0x8C, 0xC4, 0x6D, 0x06, 0x86, 0xC8, 0xAD, 0x80, 0x46, 0x60, 0x3B,
+    0x13, 0x67, 0x62, 0x9A, 0xCF, 0x15, 0x53, 0xDC, 0x5D, 0x62, 0xC5, 0x54, 0x4C, 0xB2, 0x6A, 0xAC,
+    0x98, 0xEC, 0x5D, 0x71, 0x91, 0x15, 0xB3, 0xD5, 0xCC, 0x55, 0x56, 0x58, 0x05, 0x56, 0x99, 0xE1,
+    0x90, 0xFE, 0xD1, 0x19, 0xC7, 0x4C, 0x90, 0x26, 0x34, 0xCE, 0xBB, 0xF0, 0x88, 0xC6, 0xB4, 0x36,
+    0xE9, 0x8A, 0xEE, 0x3D, 0x50, 0xAB, 0x29, 0x5F, 0x88, 0xB6, 0x59, 0xB2, 0x23, 0x7F, 0xF0, 0x78,
+    0xE8, 0x4C, 0x17, 0x04, 0xCB, 0x27, 0x7B, 0xBC, 0xD4, 0xAF, 0x7F, 0x0E, 0x6A, 0xF5, 0xDC, 0xBB,
+    0xD5, 0x18, 0xAC, 0x2F, 0x4A, 0xCF, 0x13, 0x52, 0x25, 0x10, 0x91, 0x90, 0x15, 0xD7, 0x14, 0xC0,
+    0x3D, 0x07, 0x2C, 0x24, 0xE7, 0xFF, 0xA7, 0xBF, 0x1D, 0xC7, 0xA1, 0x50, 0x13, 0x64, 0x60, 0xBC,
+    0x9A, 0xDE, 0x7E, 0x4C, 0xD5, 0xA6, 0xFA, 0xE2, 0xF5, 0x14, 0x66, 0x92, 0xF9, 0x43, 0x53, 0xDF,
+    0x3C, 0xB5, 0x92, 0x15, 0x5C, 0xD2, 0x8A, 0xEE, 0x9D, 0x3B, 0x64, 0x7A, 0xCD, 0x44, 0xE4, 0x9E,
+    0xC7, 0x05, 0x13, 0x35, 0xE6, 0xB9, 0xFB, 0xF4, 0x3F, 0xBC, 0x94, 0x97, 0x3E, 0xE8, 0x39, 0x26,
+    0x83, 0xF5, 0xAE, 0xB1, 0xF6, 0xF1, 0xB6, 0x91, 0x57, 0x26, 0x6F, 0xA0, 0x46, 0x2F, 0xBC, 0x39,
+    0x9E, 0x39, 0xCB, 0x7B, 0xF4, 0x88, 0x77, 0xB7, 0xC3, 0x39, 0x9E, 0x78, 0x58, 0xB1, 0x20, 0x96,
+    0x04, 0x20, 0xD1, 0xE7, 0x7A, 0x7F, 0x94, 0xAA, 0xA3, 0xDC, 0xE4, 0x7D, 0x8B, 0xD9, 0x6C, 0xAA,
+    0xB6, 0xAD, 0xA7, 0xC6, 0xF4, 0x39, 0xBB, 0x17, 0x1F, 0xBA, 0xA3, 0x9F, 0xF1, 0x4B, 0x42, 0x87,
+    0x84, 0xD9, 0x2D, 0xA5, 0xB9, 0xF8, 0x48, 0xD7, 0xC3, 0x2B, 0xCE, 0x35, 0xCF, 0xD7, 0xC6, 0xB0,
+    0xFE, 0xB0, 0x15, 0x4E, 0x4A, 0x7C, 0xD9, 0x5D, 0x5B, 0xF6, 0xE2, 0xCB, 0xC9, 0x9F, 0xE8, 0x5B,
+    0x96, 0x97, 0xC7, 0x5B, 0x5F, 0xD2, 0xE1, 0xB6, 0x34, 0x94, 0x75, 0x39, 0xDB, 0x72, 0xFE, 0x58,
+    0x93, 0x3B, 0xE7, 0x7A, 0xDF, 0xCF, 0x56, 0xD3, 0x7A, 0x36, 0x9C, 0xF8, 0x32, 0x9F, 0xD7, 0x65,
+    0xFB, 0xEC, 0xDF, 0xCB, 0xF5, 0x77, 0xCF, 0x9A, 0xC3, 0x9F, 0xC5, 0x7E, 0x6D, 0x59, 0xEF, 0xDC,
+    0xF7, 0xBF, 0xF5, 0xDA, 0xFB, 0x4F, 0x89, 0xD5, 0x88, 0x27, 0xDF, 0x97, 0x6B, 0x5B, 0xCB, 0x5D,
+    0xFE, 0xFF, 0x06, 0xAD, 0x55, 0xBF, 0x8F, 0xD5, 0x46, 0x10, 0x1E, 0x7B, 0x05, 0x4F, 0xE2, 0x15,
+    0xDB, 0x40, 0x03, 0x85, 0x7B, 0x1A, 0xFF, 0x07, 0x59, 0x87, 0x86, 0x16, 0x21, 0x24, 0x8A, 0x2B,
+    0xF8, 0x03, 0x28, 0xF2, 0x27, 0xD8, 0x4A, 0x0A, 0x0A, 0x8A, 0xA4, 0xA1, 0x49, 0x03, 0x45, 0x0A,
+    0x44, 0xC3, 0x3F, 0x40, 0xB4, 0xE6, 0xAE, 0xA0, 0xA0, 0xE0, 0x49, 0x08, 0xD1, 0x3A, 0x05, 0xCD,
+    0x35, 0x2C, 0xC2, 0x27, 0xF9, 0xC8, 0xAE, 0x27, 0xDF, 0xB7, 0xBE, 0x77, 0xB9, 0x48, 0x77, 0xFC,
+    0x10, 0xB1, 0xB4, 0xF3, 0xD6, 0xB3, 0xE3, 0x99, 0x6F, 0x66, 0xBF, 0x99, 0xE7, 0x55, 0x47, 0x29,
+    0x55, 0x75, 0x23, 0x6B, 0xC8, 0x46, 0xEA, 0x83, 0xDB, 0x49, 0xC4, 0x77, 0x16, 0xEA, 0x59, 0x1C,
+    0xD4, 0x93, 0x50, 0x3D, 0x18, 0x9D, 0xA9, 0x56, 0xBD, 0x06, 0xB5, 0x2A, 0xD5, 0x4F, 0x15, 0xEA,
+    0xB4, 0x4E, 0xB4, 0xB6, 0x9F, 0x68, 0x5D, 0xFD, 0x4D, 0xEB, 0xF6, 0x3D, 0xD4, 0x85, 0x0A, 0x9E,
+    0x55, 0xA4, 0xAC, 0x07, 0x88, 0x02, 0x6E, 0xE4, 0x07, 0x4F, 0x05, 0xC3, 0x89, 0xD1, 0x44, 0x03,
+    0xED, 0xE4, 0xC4, 0x73, 0x5E, 0x83, 0x00, 0x09, 0x8C, 0x2C, 0xE2, 0x61, 0xF7, 0x7B, 0x03, 0x43,
+    0x1C, 0x94, 0x2A, 0x55, 0x12, 0xED, 0x6B, 0x1D, 0x10, 0x46, 0x93, 0x1D, 0xD7, 0xD1, 0xBF, 0x88,
+    0x26, 0xDA, 0x0F, 0x2A, 0x6A, 0x62, 0xDB, 0xBB, 0x5E, 0x01, 0x23, 0xB8, 0xBD, 0x04, 0x65, 0xD0,
+    0xDE, 0x5F, 0x9F, 0xEA, 0xD1, 0x7E, 0x4C, 0x46, 0xAF, 0x11, 0xFA, 0xEC, 0x35, 0xA7, 0xF8, 0x40,
+    0x3C, 0x64, 0xCF, 0x9C, 0x83, 0x14, 0xCD, 0x4F, 0xF1, 0xDF, 0xE0, 0x6B, 0x60, 0x59, 0xA1, 0x1E,
+    0xC0, 0x07, 0xCC, 0x87, 0x37, 0xC4, 0xA4, 0x52, 0xBB, 0xB6, 0x47, 0xB6, 0xB1, 0xD2, 0xD1, 0xFF,
+    0x1C, 0xDD, 0xFD, 0xA9, 0xDE, 0x9D, 0xFC, 0x6E, 0x74, 0xF7, 0x62, 0xBD, 0x37, 0xB9, 0xCD, 0xEC,
+    0x4B, 0xFD, 0x55, 0x07, 0x94, 0x25, 0x4A, 0x4B, 0x01, 0xE7, 0xBD, 0x5C, 0x5C, 0x9F, 0xF0, 0x5A,
+    0xF8, 0xB9, 0x59, 0xA9, 0x4E, 0x58, 0x69, 0xA5, 0xFB, 0x6A, 0xB4, 0x2B, 0x7E, 0x64, 0xD6, 0x30,
+    0x14, 0x87, 0xCA, 0xA0, 0xD4, 0xB2, 0x4A, 0x2C, 0x10, 0xAC, 0x5B, 0x54, 0xA6, 0x82, 0xC2, 0xCC,
+    0xB2, 0x58, 0xD4, 0x7C, 0x41, 0xE9, 0x1A, 0x3F, 0xEF, 0x04, 0x7B, 0x14, 0x02, 0x75, 0x82, 0x6A,
+    0x0D, 0x5B, 0x61, 0xA4, 0x0A, 0xDE, 0x56, 0xF0, 0xE4, 0x26, 0x78, 0x83, 0xA2, 0x7C, 0xBC, 0x84,
+    0x46, 0x32, 0x06, 0x78, 0x10, 0xBC, 0x4E, 0x3B, 0x2C, 0x23, 0xBC, 0x13, 0x9A, 0xEF, 0xB7, 0x3F,
+    0xBC, 0x1F, 0x60, 0x30, 0xFA, 0xE6, 0x19, 0x7C, 0xF7, 0x2D, 0xDD, 0x23, 0xF2, 0x9F, 0x88, 0x19,
+    0xB2, 0xDF, 0x22, 0xE2, 0xB0, 0x13, 0x17, 0xE8, 0x14, 0x19, 0xEA, 0x1D, 0xAC, 0xB7, 0x58, 0x07,
+    0x58, 0x49, 0xEC, 0xB4, 0x85, 0xDA, 0x1D, 0x25, 0xF3, 0x75, 0x0A, 0x5E, 0x2E, 0x2B, 0xE5, 0x70,
+    0x09, 0x96, 0xD7, 0xBD, 0x24, 0x8F, 0x7C, 0xAB, 0xB0, 0xB0, 0xE6, 0x58, 0x21, 0x0C, 0x9B, 0xB6,
+    0xEB, 0xD2, 0x9D, 0x83, 0x5B, 0x62, 0x61, 0xF3, 0xD9, 0x35, 0x92, 0x3F, 0xE1, 0x78, 0x9D, 0x6A,
+    0x74, 0xE1, 0x11, 0xF2, 0xAF, 0x3F, 0x00, 0x96, 0xFE, 0x02, 0x6A, 0x44, 0x93, 0x40, 0xE0, 0x75,
+    0x04, 0xD1, 0x40, 0xA3, 0x51, 0xEA, 0x80, 0x63, 0xF7, 0x9A, 0xCD, 0xF0, 0x3E, 0x2C, 0x94, 0x28,
+    0x34, 0x43, 0x07, 0xA6, 0x15, 0x13, 0x62, 0x14, 0x76, 0x88, 0xB0, 0x41, 0xC0, 0x95, 0x53, 0x55,
+    0xB0, 0xD6, 0x87, 0xA3, 0xF8, 0x3D, 0xB4, 0x07, 0x3C, 0xDA, 0xB1, 0x02, 0x71, 0xCD, 0x8C, 0x8A,
+    0xF8, 0xE7, 0xDA, 0xD8, 0xD1, 0xF7, 0xE5, 0x8C, 0x0F, 0xDA, 0x57, 0x40, 0x8A, 0xE6, 0x29, 0xD9,
+    0x14, 0x4E, 0x09, 0x1F, 0xB5, 0xCF, 0x0C, 0x09, 0x5F, 0x28, 0xEA, 0xF7, 0x65, 0x71, 0xF9, 0xE9,
+    0xA7, 0x3F, 0xC8, 0xA8, 0xC0, 0x86, 0xE8, 0xD9, 0x20, 0x0B, 0xFF, 0xFE, 0xFF, 0x2C, 0xC0, 0xAF,
+    0x09, 0x6C, 0x9C, 0x01, 0x42, 0xBB, 0x4B, 0xED, 0xBB, 0xE6, 0x3F, 0x59, 0xE0, 0x6B, 0x3B, 0x01,
+    0x35, 0x81, 0x4F, 0x7C, 0x6B, 0x37, 0x96, 0xD4, 0x23, 0x0D, 0xEC, 0xC8, 0x9C, 0xFD, 0xCB, 0x48,
+    0xDC, 0x84, 0x64, 0x95, 0x03, 0x25, 0x8F, 0x92, 0x65, 0x7E, 0x90, 0x41, 0x52, 0xF3, 0xA6, 0xCD,
+    0x4C, 0x03, 0xBD, 0x1F, 0xC9, 0x24, 0x44, 0xE5, 0x20, 0x6A, 0x50, 0x23, 0xCC, 0x14, 0xA4, 0xE5,
+    0x14, 0x19, 0x94, 0x1A, 0x51, 0x14, 0x4B, 0x58, 0x62, 0x72, 0xA3, 0xBA, 0xB3, 0xB7, 0x84, 0x5E,
+    0x6A, 0xE3, 0x37, 0x40, 0x85, 0x4E, 0x42, 0x1D, 0xEE, 0x25, 0x78, 0x68, 0xD9, 0x33, 0x4A, 0x3C,
+    0x23, 0xE7, 0x46, 0xBF, 0xA4, 0x5B, 0x90, 0xD6, 0x96, 0xC9, 0xFB, 0x57, 0x11, 0x3D, 0x6D, 0x0F,
+    0x6F, 0xB8, 0x50, 0xEB, 0xAE, 0xE2, 0xB4, 0x9A, 0xA4, 0xA5, 0x5B, 0x52, 0x6F, 0x71, 0xAD, 0xDB,
+    0x48, 0x59, 0x75, 0xB5, 0x63, 0x77, 0xD9, 0x50, 0x40, 0x46, 0xB7, 0x59, 0x71, 0x3E, 0x69, 0x53,
+    0xE1, 0x67, 0x2F, 0x65, 0x13, 0x72, 0x0B, 0xDF, 0xF1, 0x5E, 0x34, 0xDF, 0x0C, 0xBE, 0x35, 0xDF,
+    0x7D, 0xB4, 0xFF, 0xC4, 0x63, 0x18, 0x2B, 0x9F, 0xCE, 0x50, 0xCE, 0xBC, 0x28, 0x25, 0x47, 0xB6,
+    0x83, 0x9B, 0x7F, 0x07, 0x94, 0xE5, 0xBC, 0x4C, 0xC9, 0x53, 0x8E, 0x72, 0x8F, 0xBE, 0x9C, 0x88,
+    0xBD, 0x0E, 0x80, 0x8E, 0x02, 0x9F, 0x6B, 0x0F, 0x6E, 0x2A, 0xCF, 0x31, 0x69, 0xF0, 0x65, 0x1D,
+    0xF8, 0x21, 0xB9, 0x3A, 0x94, 0x9F, 0x51, 0x3F, 0xD8, 0x89, 0xF9, 0xEF, 0x48, 0x87, 0x75, 0x86,
+    0x54, 0x67, 0x44, 0xBC, 0xE7, 0x1C, 0xB5, 0xCA, 0x41, 0x5B, 0xC6, 0x2C, 0x4E, 0xA8, 0x2F, 0xFC,
+    0xD6, 0xD2, 0x03, 0xC6, 0x06, 0xE8, 0x84, 0xAD, 0xFB, 0x8A, 0x6D, 0x22, 0xFD, 0xDD, 0xE1, 0x5D,
+    0x1D, 0xCC, 0x71, 0xD6, 0x03, 0x38, 0xF4, 0x3A, 0xFB, 0x25, 0xE1, 0x16, 0x6E, 0x1E, 0x6D, 0x33,
+    0x0A, 0x97, 0x19, 0xC6, 0x7B, 0x5F, 0xB6, 0xCB, 0x90, 0xCA, 0x23, 0xEB, 0x8C, 0x2D, 0x8B, 0x8F,
+    0xD7, 0xF6, 0x2C, 0x91, 0x4F, 0xDD, 0x70, 0x85, 0x0C, 0x81, 0x5F, 0x82, 0x40, 0xFE, 0x7F, 0xE9,
+    0xD6, 0xCB, 0x91, 0xD0, 0x93, 0x62, 0x61, 0xCE, 0xA9, 0xE2, 0x89, 0x7C, 0xE3, 0xF3, 0x0F, 0xC5,
+    0x55, 0xAF, 0x93, 0x1D, 0x45, 0x10, 0xEE, 0x7D, 0xCB, 0xB1, 0x62, 0xC5, 0x1A, 0x62, 0x30, 0xEB,
+    0x11, 0x99, 0x7F, 0x80, 0xAA, 0x7D, 0x89, 0x41, 0x20, 0xC0, 0x21, 0x22, 0xE0, 0x3F, 0xB8, 0x3F,
+    0x61, 0x26, 0x15, 0x11, 0x89, 0x4A, 0x21, 0x0F, 0x11, 0x75, 0x11, 0x31, 0xF1, 0xBD, 0x21, 0x22,
+    0x32, 0xAF, 0x40, 0x20, 0x10, 0x6C, 0x41, 0x91, 0x54, 0x72, 0x22, 0x93, 0x64, 0x29, 0x26, 0x61,
+    0x67, 0x9A, 0xAF, 0x7B, 0x8F, 0xBB, 0x57, 0x14, 0x07, 0x98, 0x14, 0x73, 0xF5, 0x7A, 0x7B, 0x7B,
+    0x67, 0xFA, 0xC7, 0xF7, 0xF5, 0xF4, 0x0D, 0x23, 0xF5, 0xAF, 0x32, 0x6D, 0x64, 0xD8, 0x91, 0xFB,
+    0xAB, 0x72, 0x0F, 0x4A, 0x7B, 0x75, 0x55, 0x44, 0x95, 0x22, 0xF2, 0x52, 0xB0, 0x5A, 0xFC, 0x62,
+    0x2F, 0x8F, 0x85, 0x68, 0x76, 0x91, 0xF0, 0x89, 0xE8, 0xDE, 0x9F, 0xCA, 0x17, 0x50, 0x70, 0x9C,
+    0x88, 0x5C, 0xF4, 0x63, 0x25, 0x7D, 0x24, 0xFF, 0x70, 0xA1, 0xFE, 0x85, 0x50, 0xB3, 0xF8, 0x6F,
+    0xAE, 0xC3, 0x10, 0x61, 0xF8, 0x10, 0x86, 0x23, 0x5E, 0x06, 0xB8, 0x6A, 0xF0, 0x1B, 0x5D, 0xF9,
+    0x3C, 0x52, 0xD7, 0x2C, 0x54, 0xDF, 0xC7, 0x59, 0x9C, 0x24, 0xC2, 0x49, 0x3D, 0x02, 0xAD, 0x5D,
+    0xE0, 0x8E, 0x2F, 0x50, 0x0E, 0x25, 0xF0, 0x69, 0x52, 0x0B, 0xCB, 0x89, 0xFC, 0x50, 0xA8, 0x2D,
+    0xF8, 0x34, 0x9C, 0xC0, 0xD9, 0xBF, 0x29, 0x13, 0xDC, 0xD4, 0x85, 0xA8, 0x4B, 0x64, 0x2F, 0x12,
+    0xCE, 0x5F, 0xBF, 0x95, 0x9D, 0x78, 0xF9, 0x19, 0x7E, 0x7F, 0x94, 0xAF, 0x84, 0xE7, 0x1A, 0x69,
+    0xB6, 0x52, 0xC8, 0x49, 0x22, 0x96, 0x69, 0x23, 0x12, 0x2E, 0x7A, 0x45, 0x62, 0xA7, 0xCB, 0xC9,
+    0x64, 0x52, 0x1F, 0x9A, 0x62, 0x00, 0x36, 0x6F, 0xEE, 0x66, 0xB8, 0x9F, 0x01, 0xD0, 0x07, 0x5A,
+    0x87, 0x7C, 0x1C, 0x61, 0x6E, 0x17, 0xE9, 0x66, 0x22, 0xFF, 0x48, 0xE4, 0xF8, 0xF8, 0xEE, 0x22,
+    0xB6, 0xBE, 0x37, 0x99, 0x5B, 0x7B, 0xEC, 0x2A, 0x31, 0x97, 0xBA, 0x8D, 0x2C, 0x55, 0xAC, 0x16,
+    0xAE, 0x2A, 0xF3, 0x56, 0x45, 0xAA, 0xE4, 0xF5, 0x35, 0x59, 0xE3, 0x00, 0xBB, 0x5E, 0x90, 0x8E,
+    0xC6, 0xCE, 0xBA, 0xB1, 0xFA, 0xF4, 0x2C, 0xA7, 0x46, 0x93, 0xE9, 0x44, 0xB6, 0x2A, 0xE2, 0x41,
+    0x93, 0xEB, 0xD2, 0x3D, 0x28, 0x34, 0x3C, 0x98, 0x65, 0xDB, 0x45, 0x8B, 0xE8, 0x54, 0x5E, 0xDD,
+    0x8B, 0x8A, 0xBE, 0xC0, 0x19, 0x45, 0xBD, 0x92, 0xD0, 0x6C, 0x09, 0xC4, 0xED, 0x08, 0x88, 0xCC,
+    0x1A, 0x07, 0x68, 0xD1, 0x01, 0xD1, 0xFF, 0x53, 0xF4, 0xE6, 0xEF, 0x8B, 0x56, 0x69, 0x2D, 0xA4,
+    0x19, 0xD3, 0x3F, 0xBF, 0xEC, 0xAD, 0xB7, 0x82, 0x0D, 0x6F, 0x35, 0x25, 0xDD, 0xD5, 0x6A, 0x19,
+    0x1B, 0x23, 0xC4, 0x8C, 0xEF, 0x07, 0xEC, 0x9E, 0x45, 0xBE, 0x13, 0xB9, 0xA2, 0x3D, 0xA4, 0x8D,
+    0x8D, 0x0B, 0xC4, 0xE3, 0x85, 0x6A, 0x97, 0xE1, 0xF9, 0x13, 0xC9, 0x83, 0xBA, 0xBF, 0x84, 0x3F,
+    0x8D, 0x1D, 0x3B, 0x05, 0xBC, 0x2A, 0x2B, 0x4A, 0x83, 0x05, 0x05, 0x30, 0xF6, 0xA0, 0x83, 0x73,
+    0xE6, 0x89, 0xC3, 0x06, 0xD7, 0x23, 0x61, 0x1F, 0x87, 0x26, 0xC3, 0x9D, 0x9B, 0xD0, 0xEF, 0xC3,
+    0xD4, 0x26, 0xE8, 0x30, 0x14, 0x42, 0xE5, 0x3C, 0x72, 0x00, 0xD0, 0x5D, 0x72, 0x13, 0x3A, 0xB9,
+    0x92, 0x36, 0x69, 0x85, 0xEE, 0x77, 0x61, 0x44, 0xA9, 0x57, 0x9C, 0x49, 0xAF, 0x9B, 0x3A, 0x34,
+    0x7A, 0xC9, 0xFF, 0x54, 0x1C, 0x62, 0x0F, 0x91, 0x6F, 0x00, 0x12, 0x37, 0xBB, 0xC9, 0x4F, 0x70,
+    0xD0, 0x26, 0x50, 0xD5, 0x2D, 0xEA, 0x76, 0x84, 0xC6, 0xA1, 0x4F, 0xB5, 0xC5, 0x14, 0x3C, 0xDA,
+    0x44, 0xC3, 0x0B, 0xB1, 0x84, 0x0A, 0x6D, 0x6E, 0xBF, 0xFB, 0xB5, 0xA6, 0x3E, 0x2A, 0xA2, 0x9B,
+    0x72, 0xA8, 0x21, 0x3A, 0x8B, 0x00, 0x2E, 0x2D, 0xF5, 0x4B, 0x67, 0x45, 0xD4, 0x99, 0x7C, 0xE8,
+    0x62, 0x1F, 0x9B, 0x84, 0xE4, 0x79, 0xF4, 0x81, 0xC7, 0x3A, 0x37, 0xA9, 0x8B, 0xA0, 0xD5, 0xDF,
+    0x00, 0xF3, 0xFC, 0x30, 0x21, 0xF3, 0x7A, 0xBF, 0x25, 0x36, 0xEB, 0x8B, 0x3F, 0x29, 0x56, 0x9A,
+    0xBF, 0x99, 0xF1, 0xBD, 0x49, 0x03, 0xC6, 0xD3, 0xCE, 0xA3, 0xDC, 0x2E, 0x35, 0x09, 0x6C, 0x0B,
+    0x5C, 0xA3, 0x8A, 0x5D, 0x93, 0x90, 0x32, 0x66, 0x0F, 0xDF, 0x57, 0x5C, 0x30, 0x97, 0x86, 0xA9,
+    0x8F, 0xFA, 0x75, 0x74, 0xB1, 0x92, 0x4A, 0x87, 0x59, 0x3F, 0x23, 0x1C, 0xE0, 0xF2, 0x8F, 0x12,
+    0x40, 0x42, 0x3C, 0x0C, 0xB2, 0xD7, 0x1A, 0x4D, 0xB6, 0x5E, 0x94, 0xCF, 0x5B, 0x87, 0xF2, 0xD1,
+    0x82, 0xC6, 0x44, 0xAF, 0xB5, 0x3A, 0xC7, 0xBA, 0x5F, 0x15, 0x9B, 0x27, 0x28, 0x8A, 0x8F, 0xD0,
+    0xB7, 0x05, 0xA6, 0x36, 0x9D, 0xF6, 0x4F, 0x05, 0x47, 0xD4, 0x63, 0xF7, 0x1D, 0xF4, 0x8E, 0x75,
+    0x2F, 0x66, 0x0A, 0xAC, 0x79, 0xBD, 0x5A, 0x1C, 0xDA, 0xCC, 0xC1, 0x25, 0x0E, 0x7E, 0xE2, 0xEB,
+    0x98, 0x78, 0xA8, 0x92, 0xBF, 0xC4, 0xA4, 0x01, 0x25, 0x2C, 0x4F, 0x95, 0x86, 0x11, 0xBF, 0xC8,
+    0xBF, 0xF0, 0xB2, 0xEE, 0xC5, 0x7C, 0x03, 0xB4, 0x1C, 0x90, 0x59, 0xD0, 0x36, 0xAD, 0xCA, 0x3A,
+    0xE9, 0x9A, 0x4C, 0x97, 0x19, 0xED, 0x04, 0x30, 0x1C, 0x42, 0xF5, 0x65, 0xC5, 0xB4, 0x33, 0x3A,
+    0x57, 0xD9, 0xEF, 0x49, 0x37, 0x35, 0x2A, 0x77, 0x2A, 0x87, 0x55, 0x8E, 0xE7, 0xD2, 0x9B, 0xE4,
+    0x55, 0x06, 0x95, 0xB2, 0xDD, 0x93, 0x00, 0x89, 0x0C, 0x2A, 0x8D, 0x0C, 0x79, 0x2D, 0x03, 0xA3,
+    0x02, 0xB7, 0x2A, 0x67, 0xC8, 0x8C, 0x0C, 0x1A, 0x59, 0xDE, 0x51, 0x52, 0x8D, 0x6B, 0xC3, 0x03,
+    0xFD, 0x7C, 0x7E, 0x45, 0x6D, 0x44, 0x83, 0xA3, 0x53, 0xEE, 0xBD, 0xB6, 0x9B, 0x4D, 0x16, 0x5C,
+    0xF8, 0x84, 0x56, 0xF8, 0xAC, 0x68, 0x20, 0x18, 0x87, 0x11, 0x5B, 0x71, 0x13, 0x60, 0x5C, 0x10,
+    0x0E, 0xF5, 0xC2, 0xC8, 0x5B, 0x18, 0x87, 0x1D, 0x8C, 0x60, 0xAF, 0xD0, 0x11, 0x58, 0x0D, 0x43,
+    0xC6, 0x0D, 0x79, 0x8E, 0x9B, 0x24, 0xBF, 0x09, 0x7A, 0xC0, 0xA2, 0xB3, 0x85, 0xD2, 0xE1, 0xD2,
+    0xDB, 0x35, 0x8D, 0x67, 0x19, 0x1D, 0xA3, 0x48, 0x23, 0xCD, 0xF8, 0xBA, 0x50, 0x79, 0x76, 0xCC,
+    0x4F, 0x40, 0x7A, 0x51, 0xE6, 0x57, 0xE5, 0xBF, 0x9C, 0x5A, 0xFF, 0x03, 0x29, 0x2D, 0x56, 0x21,
+    0x66, 0xC8, 0xE5, 0x3B, 0xB8, 0x11, 0x62, 0xE4, 0x28, 0x76, 0xFA, 0xE5, 0x3D, 0x7A, 0x6B, 0xEB,
+    0x0F, 0x8D, 0x55, 0x3D, 0x73, 0xDD, 0x44, 0x14, 0xDD, 0x27, 0x61, 0xAB, 0xD0, 0x0C, 0xDB, 0x40,
+    0x95, 0x42, 0x3D, 0x8D, 0x6A, 0xAA, 0x15, 0xA1, 0xA0, 0x0C, 0x3D, 0x85, 0x7F, 0x00, 0x85, 0x7F,
+    0x01, 0x23, 0x25, 0x2E, 0x52, 0x3A, 0xFF, 0x20, 0x29, 0x28, 0xC0, 0x29, 0xA0, 0x64, 0x68, 0x56,
+    0x33, 0x14, 0x29, 0x68, 0x34, 0x78, 0x80, 0xC2, 0x45, 0x14, 0x32, 0x43, 0x66, 0x92, 0xC2, 0xC2,
+    0x11, 0x63, 0xC5, 0xD1, 0xEA, 0x70, 0xCE, 0xBE, 0xE7, 0xD8, 0x99, 0xD8, 0xC0, 0xBE, 0xD9, 0xBD,
+    0xFB, 0x76, 0xA5, 0xFB, 0x71, 0xEE, 0xB9, 0x57, 0xBE, 0xC9, 0x66, 0x7F, 0xD5, 0x04, 0x2E, 0xE6,
+    0xAF, 0x5F, 0x5C, 0xFD, 0x0C, 0xA7, 0x31, 0x9A, 0x39, 0x67, 0x31, 0x99, 0x1F, 0xFD, 0x68, 0x3C,
+    0x7A, 0xCE, 0xC6, 0xD4, 0xC1, 0x68, 0xD4, 0xAD, 0x29, 0xFB, 0x15, 0x8C, 0x89, 0x0F, 0x27, 0x8B,
+    0x29, 0x06, 0x93, 0x4F, 0xD7, 0x1E, 0x3F, 0x3F, 0xF0, 0x3C, 0xE6, 0x68, 0x32, 0x2E, 0x3C, 0xE6,
+    0x3A, 0xFD, 0xB7, 0x12, 0xFC, 0xCE, 0x63, 0x40, 0xC7, 0x98, 0x75, 0x4C, 0x27, 0x38, 0x7C, 0xC5,
+    0x25, 0x9D, 0xB5, 0xE5, 0x15, 0x07, 0xFD, 0xA2, 0xC3, 0xD1, 0x33, 0x17, 0x0F, 0x36, 0x2A, 0xAF,
+    0x5F, 0x18, 0xFE, 0xE5, 0x85, 0x48, 0x5C, 0xF1, 0x1C, 0xE6, 0x37, 0xCB, 0x24, 0x8B, 0xA3, 0xAC,
+    0x48, 0xBF, 0x8D, 0x8B, 0x7C, 0x29, 0xB5, 0x7C, 0xD4, 0xB8, 0xD6, 0x14, 0x2F, 0x03, 0x7D, 0x75,
+    0x9D, 0x29, 0xFF, 0x6D, 0x03, 0x6D, 0x96, 0x2F, 0x71, 0x22, 0x30, 0x2C, 0xE7, 0x50, 0xE0, 0x4F,
+    0x48, 0x11, 0x55, 0x26, 0xE7, 0x9B, 0x87, 0xDC, 0x58, 0x70, 0x83, 0x37, 0x9B, 0x73, 0xAB, 0xEF,
+    0x6E, 0x18, 0x73, 0xBB, 0x42, 0x7D, 0xC5, 0xD4, 0xB9, 0xEB, 0x6F, 0xC0, 0x6D, 0x6C, 0x25, 0x78,
+    0xC2, 0xB7, 0x84, 0xAC, 0x2C, 0xE1, 0xF2, 0x34, 0xEF, 0xCE, 0x03, 0x53, 0x33, 0x6A, 0xC7, 0x7C,
+    0x10, 0x69, 0x3F, 0xC7, 0xCC, 0x13, 0xAB, 0x7A, 0x59, 0x0B, 0x45, 0x42, 0xE1, 0xAB, 0xF4, 0x35,
+    0x45, 0xDD, 0xA4, 0xA7, 0x14, 0xBB, 0x6D, 0xFE, 0x92, 0x62, 0xA7, 0xB5, 0x4F, 0x29, 0xF6, 0x7B,
+    0x7B, 0x28, 0x31, 0x94, 0x3F, 0x51, 0xDC, 0x1D, 0xDC, 0x1E, 0xC5, 0xDE, 0xE8, 0x3E, 0x95, 0x98,
+    0x6B, 0x66, 0xB0, 0xBE, 0x33, 0x2F, 0x12, 0xB7, 0x97, 0x20, 0xD1, 0x60, 0x8E, 0xC2, 0x4F, 0x29,
+    0x42, 0xDD, 0xD4, 0x63, 0x14, 0x6E, 0x48, 0x99, 0xFD, 0xA6, 0xEC, 0x29, 0x62, 0xBC, 0xD9, 0x14,
+    0x85, 0x1D, 0xD7, 0x62, 0x0D, 0x42, 0xB9, 0xC1, 0xA2, 0x5F, 0xA7, 0xBF, 0x35, 0x1B, 0x1E, 0x4C,
+    0xE4, 0x4E, 0x55, 0xC2, 0xA4, 0xE8, 0x72, 0x74, 0x2B, 0x8C, 0x09, 0x93, 0x89, 0x60, 0xBC, 0x37,
+    0xCE, 0x57, 0xE5, 0xE3, 0xAE, 0x3C, 0xEE, 0xF2, 0xD3, 0xD9, 0x1E, 0x8D, 0x49, 0xA8, 0xB3, 0x13,
+    0x5E, 0xDC, 0xFA, 0x63, 0xE2, 0xC5, 0x2F, 0x73, 0x28, 0xBB, 0x7C, 0xAC, 0x7D, 0xCE, 0x0B, 0x8B,
+    0x3B, 0xBC, 0xB8, 0x89, 0x96, 0x17, 0x9D, 0x1B, 0x4A, 0x1C, 0x8D, 0x76, 0xCA, 0x71, 0x12, 0x56,
+    0x73, 0xB2, 0x71, 0x0A, 0x6B, 0xF3, 0x4D, 0xF4, 0xA5, 0xBB, 0x70, 0x6C, 0xCD, 0xD3, 0xD5, 0xB7,
+    0xC6, 0x61, 0x04, 0x0E, 0x81, 0x4F, 0xD0, 0x13, 0x7E, 0x96, 0x16, 0x3D, 0xF6, 0xED, 0xB5, 0x5B,
+    0x1B, 0x52, 0xE0, 0x16, 0x02, 0x5F, 0x33, 0x1F, 0xF2, 0x67, 0x8A, 0xBE, 0x6C, 0x4D, 0x1A, 0xC4,
+    0xF8, 0x5A, 0x94, 0xC8, 0xA0, 0xF8, 0xB7, 0xAA, 0x4D, 0xA0, 0xE4, 0x89, 0xAC, 0xA1, 0x53, 0x76,
+    0x05, 0x90, 0xF2, 0x6A, 0xDC, 0x31, 0xFF, 0x97, 0xCF, 0x26, 0xA1, 0x05, 0x15, 0x35, 0x59, 0x98,
+    0x2C, 0xAA, 0x6D, 0x54, 0x50, 0x19, 0x8B, 0x95, 0x03, 0xCD, 0xDA, 0x85, 0xA4, 0x53, 0x71, 0xD2,
+    0x39, 0x95, 0x84, 0xF8, 0x69, 0xEA, 0x8E, 0x78, 0xB2, 0xA2, 0xEC, 0x6C, 0x27, 0xF2, 0xE6, 0x33,
+    0x32, 0xC0, 0x3D, 0x15, 0x25, 0xE7, 0xE4, 0xEB, 0xED, 0x07, 0xB6, 0x77, 0xAD, 0xFB, 0x6D, 0x89,
+    0xDE, 0x88, 0x15, 0x5B, 0x1B, 0xC4, 0xD1, 0x90, 0x6C, 0x6D, 0xC9, 0xF9, 0xB1, 0x78, 0x96, 0x06,
+    0x19, 0x5F, 0x79, 0x74, 0x50, 0x40, 0x2F, 0x82, 0xEF, 0xEC, 0x29, 0x8C, 0x7B, 0x3C, 0xAD, 0xB0,
+    0x3B, 0x16, 0xA1, 0x86, 0x80, 0x79, 0xDC, 0xF9, 0xC9, 0x55, 0x1F, 0xA8, 0xA4, 0x2B, 0x79, 0x3B,
+    0x78, 0x41, 0xC7, 0x88, 0xCD, 0x57, 0x69, 0x67, 0x2E, 0x0F, 0x37, 0xC7, 0x60, 0x19, 0x77, 0xAE,
+    0x76, 0xB0, 0x26, 0x05, 0xD4, 0x13, 0xFC, 0x7D, 0xFE, 0x77, 0x87, 0x6A, 0x5A, 0x03, 0xEF, 0xF3,
+    0x89, 0x58, 0xA5, 0x22, 0x16, 0x29, 0xCF, 0xFF, 0xBE, 0x25, 0xB6, 0xEE, 0xEC, 0xBB, 0x39, 0xB6,
+    0x9F, 0x26, 0x57, 0xF5, 0xA5, 0x0A, 0x76, 0xC5, 0x4B, 0x34, 0x68, 0xD9, 0x3C, 0x48, 0x9F, 0x2C,
+    0x14, 0x04, 0x16, 0xFB, 0xB3, 0x9A, 0x49, 0x32, 0x14, 0x55, 0xD1, 0x43, 0x7C, 0x35, 0x3F, 0x64,
+    0xE7, 0xA4, 0x52, 0x23, 0xE2, 0x9B, 0x03, 0x55, 0x0C, 0xEF, 0x57, 0xE2, 0x1A, 0x35, 0x30, 0xCE,
+    0x5D, 0x8C, 0x4E, 0x39, 0x3E, 0x63, 0x60, 0x69, 0x40, 0x6B, 0x4F, 0x89, 0xCE, 0x51, 0xC8, 0xB0,
+    0x03, 0x25, 0xF2, 0x74, 0x2C, 0x17, 0xDB, 0x6D, 0x6D, 0x34, 0xF0, 0x5D, 0x13, 0x7B, 0x62, 0x6B,
+    0xF2, 0x88, 0xB6, 0x71, 0x11, 0xF9, 0x64, 0x29, 0xD6, 0x3D, 0xA6, 0x96, 0x39, 0x7F, 0x3B, 0xA6,
+    0x35, 0x28, 0x65, 0x0C, 0xAB, 0x38, 0x3B, 0xB8, 0x47, 0x63, 0xB5, 0x3A, 0x29, 0xFD, 0x66, 0x2B,
+    0x2D, 0xFB, 0x4C, 0xBD, 0x14, 0xCF, 0xFD, 0x60, 0xA2, 0xA2, 0x76, 0xAD, 0x48, 0x34, 0x90, 0x3A,
+    0x95, 0x49, 0xE4, 0x4C, 0xAB, 0x36, 0xBC, 0xB7, 0x44, 0x9B, 0x3C, 0xE0, 0x5B, 0x33, 0xFB, 0x66,
+    0x21, 0x37, 0xCE, 0x13, 0x77, 0x93, 0x80, 0x02, 0xAF, 0xA1, 0x82, 0xE1, 0x18, 0xD3, 0xA6, 0x5C,
+    0x62, 0x0A, 0x17, 0xF6, 0x18, 0x05, 0x99, 0x8F, 0xDB, 0x6C, 0x98, 0x08, 0xEA, 0x26, 0xC0, 0x3E,
+    0x1E, 0x72, 0x7D, 0x11, 0x14, 0x3D, 0x1F, 0x23, 0x95, 0x08, 0x63, 0x39, 0xAB, 0x16, 0x0B, 0xB4,
+    0xDB, 0x77, 0x81, 0x63, 0xF2, 0x09, 0xEC, 0x3A, 0x60, 0xB1, 0xB0, 0xFC, 0x26, 0xF3, 0x5E, 0xA4,
+    0x09, 0xF9, 0x6C, 0xFB, 0xE2, 0x90, 0x5C, 0x26, 0xBB, 0xC5, 0xE3, 0xC8, 0x62, 0x85, 0xC3, 0xC0,
+    0xEE, 0x03, 0xCF, 0x80, 0xBF, 0x23, 0x3B, 0xE5, 0x79, 0xA6, 0xFC, 0x1D, 0x7C, 0xC3, 0x1B, 0xFA,
+    0xFA, 0x08, 0xF8, 0xEB, 0xED, 0x1B, 0xA3, 0xB0, 0x76, 0xE2, 0x3B, 0xAF, 0xA8, 0x20, 0x79, 0xB0,
+    0x7D, 0x2F, 0x9D, 0x6C, 0x9F, 0x86, 0x9A, 0xC5, 0x4E, 0x30, 0xC4, 0xCC, 0xD5, 0xA6, 0x48, 0x7C,
+    0x20, 0x5D, 0x98, 0x16, 0xC6, 0x5C, 0x8E, 0xC5, 0xE8, 0xBA, 0x8C, 0x5F, 0x95, 0xF4, 0xED, 0x8F,
+    0x62, 0x1B, 0xB5, 0xC7, 0x3E, 0x52, 0x4E, 0xE6, 0x7B, 0xBB, 0x26, 0x09, 0x8B, 0x52, 0x95, 0xF5,
+    0xF9, 0x06, 0xAA, 0x1B, 0xAA, 0x30, 0x3E, 0xAE, 0x6F, 0x22, 0xA1, 0x2E, 0x97, 0x03, 0x92, 0xA1,
+    0x33, 0xF9, 0xB2, 0x3A, 0xEF, 0x3D, 0x56, 0x25, 0x18, 0x1B, 0xBA, 0xF1, 0x3F, 0x0B, 0xAC, 0xD8,
+    0xF1, 0x65, 0x02, 0x88, 0xE0, 0x3E, 0x8A, 0x38, 0xA9, 0x98, 0x26, 0x02, 0x97, 0x05, 0x7E, 0xBE,
+    0x32, 0xD2, 0xF4, 0xD5, 0x2E, 0x2A, 0xA1, 0x5B, 0x99, 0xB8, 0x64, 0xCC, 0xF0, 0x85, 0xFF, 0xFF,
+    0x7F, 0xFC, 0x03, 0xAD, 0x55, 0xBF, 0x6F, 0xE5, 0x44, 0x10, 0x1E, 0xDB, 0x4A, 0x5C, 0xB8, 0x30,
+    0x0D, 0x55, 0x0A, 0xD3, 0x42, 0x71, 0xAE, 0x29, 0xB8, 0xF5, 0x89, 0x3F, 0x80, 0x2B, 0x78, 0x34,
+    0x29, 0xDE, 0x9F, 0x90, 0x7F, 0x00, 0x69, 0xF7, 0x2E, 0x05, 0x45, 0x1A, 0x0A, 0xAE, 0xA2, 0xA1,
+    0x4E, 0x8A, 0x6B, 0x29, 0x90, 0xD6, 0x21, 0x45, 0x0A, 0x0A, 0x2C, 0x5D, 0xF1, 0x4A, 0x56, 0x27,
+    0xD1, 0xD0, 0x64, 0x21, 0x7E, 0x3A, 0x3F, 0xF0, 0xEE, 0xF0, 0xCD, 0x3A, 0xBF, 0x38, 0x81, 0x84,
+    0x04, 0x56, 0xC6, 0xCF, 0x19, 0x8F, 0x67, 0xE7, 0xFB, 0xE6, 0xDB, 0x59, 0x22, 0xA2, 0x8A, 0x27,
+    0x52, 0xCC, 0x1D, 0x6C, 0x78, 0x9F, 0xB4, 0x27, 0xAA, 0x27, 0x78, 0x67, 0x31, 0xCB, 0x7C, 0x6F,
+    0xA6, 0x9A, 0x75, 0x5F, 0x4F, 0xCA, 0xB5, 0xBE, 0x41, 0x6C, 0xC5, 0x6C, 0x32, 0x0E, 0x44, 0x19,
+    0x92, 0xB4, 0x4F, 0x46, 0x7C, 0xE7, 0x99, 0xA8, 0x98, 0x55, 0x4F, 0xF4, 0x79, 0x31, 0xD0, 0x83,
+    0x6B, 0x9F, 0x23, 0x62, 0x18, 0x2B, 0xE1, 0xC6, 0x7D, 0xC5, 0xA7, 0x76, 0xCE, 0x47, 0xCA, 0xD9,
+    0x74, 0xF0, 0x63, 0x49, 0x2A, 0xA2, 0xC4, 0xD9, 0x5E, 0x72, 0xFD, 0x86, 0x98, 0xB4, 0x26, 0xB3,
+    0x84, 0xF3, 0x0F, 0x72, 0xFB, 0x95, 0xA5, 0x20, 0xE4, 0x2E, 0x62, 0x3D, 0x52, 0xC6, 0x4F, 0xB8,
+    0xCB, 0xB8, 0x57, 0xF1, 0x90, 0x87, 0x02, 0xAF, 0x07, 0xC1, 0x30, 0xC0, 0xCF, 0x06, 0x29, 0x9E,
+    0x22, 0xA1, 0x6B, 0xA9, 0x1A, 0xB5, 0x11, 0xCB, 0xDD, 0xA3, 0xBB, 0x52, 0xFE, 0x17, 0xB8, 0x54,
+    0x9B, 0xEF, 0x52, 0xB2, 0x51, 0xC9, 0x72, 0x79, 0xA8, 0x9D, 0xFC, 0xFB, 0x28, 0x77, 0xF4, 0xD6,
+    0x95, 0x47, 0xAA, 0x80, 0xDA, 0xA9, 0x01, 0x4F, 0xCD, 0x88, 0x75, 0xAC, 0xC1, 0x82, 0x6C, 0x5A,
+    0x87, 0x67, 0x38, 0xA6, 0x22, 0x80, 0x87, 0x3C, 0x0A, 0x01, 0xCA, 0xD9, 0xE7, 0x80, 0x59, 0xCE,
+    0xAD, 0x63, 0x10, 0x63, 0xAF, 0xA2, 0xA0, 0xA9, 0x85, 0x32, 0x00, 0xC2, 0x0F, 0xAA, 0xCD, 0xF1,
+    0x83, 0xD0, 0x8C, 0x4F, 0x26, 0x0B, 0x8E, 0xF9, 0xFB, 0x58, 0xA3, 0x76, 0x3B, 0xD8, 0x67, 0x88,
+    0x45, 0xB1, 0xAE, 0x1D, 0x49, 0x79, 0xA4, 0x65, 0x6A, 0x47, 0xAC, 0xA9, 0x5D, 0x9D, 0xD6, 0x9C,
+    0xF1, 0xD3, 0x3A, 0xE2, 0xCB, 0xA5, 0x20, 0x60, 0x9E, 0x2A, 0x61, 0xBB, 0x19, 0x84, 0xF9, 0x6C,
+    0x41, 0x50, 0x2D, 0xB0, 0x1E, 0x5C, 0x6A, 0x28, 0x51, 0x6D, 0xC6, 0xA4, 0x8D, 0x42, 0xC5, 0xE5,
+    0x84, 0xAA, 0xD5, 0xA0, 0x0D, 0xA3, 0x82, 0x12, 0xE4, 0x80, 0x35, 0x7D, 0x82, 0x02, 0x40, 0x27,
+    0x4B, 0x55, 0xCC, 0x2E, 0x75, 0x5A, 0x60, 0x44, 0x7B, 0x85, 0x65, 0xF8, 0x8B, 0x49, 0xA3, 0x3B,
+    0x5E, 0x1F, 0x33, 0x95, 0xA1, 0x9C, 0x12, 0x7A, 0x6D, 0xF4, 0xA0, 0x7C, 0x89, 0x2A, 0xAB, 0x80,
+    0xD4, 0xF5, 0x5C, 0xA0, 0x45, 0xED, 0x79, 0x20, 0x5B, 0x8E, 0x34, 0x56, 0xE6, 0x76, 0x79, 0x0B,
+    0xA2, 0x90, 0x52, 0xA3, 0x01, 0xF1, 0x8C, 0xCF, 0xBB, 0x3C, 0x29, 0x4C, 0xA4, 0x86, 0xC4, 0xE6,
+    0xDD, 0x97, 0x33, 0xA1, 0x2D, 0x05, 0x08, 0x01, 0x49, 0x1D, 0x95, 0xBC, 0x08, 0x49, 0x3A, 0x8A,
+    0xD2, 0x32, 0x7E, 0xF9, 0x42, 0x4B, 0x33, 0x5F, 0x83, 0xB2, 0x5C, 0x94, 0xB1, 0x87, 0x18, 0xF7,
+    0x98, 0xB8, 0x1C, 0x6B, 0xAF, 0xBB, 0x8F, 0xEE, 0xDA, 0x55, 0xF1, 0x0E, 0xF4, 0x8E, 0xE8, 0x73,
+    0xEF, 0xCA, 0x20, 0xA8, 0xB1, 0x4A, 0x76, 0xC6, 0x5D, 0xC3, 0x3D, 0x30, 0x75, 0x7B, 0x87, 0x21,
+    0xE9, 0x34, 0xE7, 0x0F, 0x49, 0x5F, 0x33, 0x07, 0xC0, 0x7D, 0x26, 0x7A, 0xDB, 0x03, 0x81, 0x10,
+    0x4B, 0x09, 0xC0, 0x82, 0xBD, 0xD7, 0x09, 0xBF, 0xBD, 0xB5, 0xE1, 0xC6, 0x9C, 0x10, 0x34, 0xA4,
+    0x22, 0x8B, 0xD4, 0xC5, 0x83, 0x78, 0xA3, 0xF6, 0xC6, 0x4B, 0xBF, 0xDF, 0x41, 0x77, 0xEB, 0xAF,
+    0x0E, 0xF8, 0x58, 0x72, 0x88, 0x1D, 0x70, 0xEC, 0x28, 0x7B, 0x9A, 0xA8, 0x9C, 0x6F, 0x6D, 0x6F,
+    0x75, 0x04, 0x60, 0x5A, 0x54, 0x0E, 0x1C, 0x52, 0xD1, 0xB8, 0xE4, 0x17, 0x41, 0x48, 0x35, 0x80,
+    0x00, 0x27, 0xE8, 0x91, 0x97, 0x42, 0x84, 0xD0, 0x95, 0x28, 0x8B, 0xEF, 0x51, 0x15, 0x14, 0x76,
+    0x1D, 0x0A, 0xF7, 0xB0, 0x7E, 0x9F, 0x77, 0x44, 0x1F, 0x9C, 0x7E, 0x23, 0x2D, 0x1B, 0x40, 0x1C,
+    0x32, 0xEE, 0xAD, 0x3E, 0x4D, 0x64, 0x64, 0xD2, 0xDB, 0xCD, 0x8C, 0x6A, 0xD7, 0x9E, 0x74, 0xD0,
+    0x7D, 0xC1, 0x5B, 0x06, 0xCC, 0x8D, 0x90, 0xBD, 0xF6, 0xE5, 0x1F, 0x70, 0xA9, 0x1F, 0xB7, 0x9C,
+    0x05, 0xB5, 0x99, 0xB1, 0xE7, 0xD7, 0x5E, 0x7F, 0x1C, 0xF4, 0xC5, 0x5C, 0x6F, 0xB9, 0x19, 0xE0,
+    0x62, 0xE2, 0xF5, 0x9B, 0xB1, 0x08, 0x9A, 0x7B, 0xB8, 0x02, 0xA9, 0x0D, 0x10, 0xF3, 0x1A, 0xD0,
+    0x83, 0x46, 0xD6, 0xAD, 0xEC, 0xD5, 0x21, 0x3F, 0x3D, 0x15, 0x2A, 0x8C, 0x58, 0xB6, 0x5A, 0x2D,
+    0xCD, 0x36, 0x75, 0xB0, 0xA6, 0x81, 0x29, 0x98, 0x86, 0x71, 0xB0, 0xCF, 0x63, 0xB0, 0xC7, 0x6F,
+    0x82, 0x3D, 0xB9, 0x0E, 0xF6, 0x93, 0x57, 0xC1, 0x1E, 0x5D, 0x04, 0x6B, 0x8B, 0x60, 0x23, 0x6C,
+    0x86, 0x61, 0xFF, 0x58, 0x0F, 0x73, 0xD8, 0x47, 0x8F, 0x73, 0xB4, 0x68, 0x6E, 0x20, 0x4A, 0xAF,
+    0x0D, 0xC4, 0xFC, 0xED, 0xBD, 0x8E, 0xCB, 0x19, 0x20, 0x81, 0x47, 0xA1, 0xF8, 0x4C, 0xF0, 0xD4,
+    0x82, 0x47, 0xC3, 0x55, 0x30, 0x5C, 0xCD, 0x15, 0x5C, 0x8C, 0xE2, 0xCB, 0x11, 0x2E, 0x75, 0x11,
+    0xF4, 0x79, 0x40, 0xA5, 0xB5, 0x87, 0x4B, 0x77, 0xBC, 0xBE, 0xC6, 0x52, 0xFA, 0xA7, 0x01, 0x2E,
+    0x16, 0x3C, 0xA3, 0xE0, 0xE9, 0xE1, 0x0A, 0x82, 0xC7, 0x8B, 0xAB, 0x23, 0xEE, 0x72, 0xDF, 0x74,
+    0xD8, 0x14, 0xBD, 0x58, 0xEE, 0x9A, 0xEE, 0x4E, 0xC5, 0xFF, 0x15, 0x58, 0x1A, 0x37, 0x32, 0xC9,
+    0x6E, 0x46, 0xCD, 0xDB, 0x83, 0x06, 0xDB, 0x44, 0x06, 0x43, 0x4C, 0xD3, 0xC1, 0xE7, 0xFC, 0xBB,
+    0x8D, 0xC4, 0x03, 0xE6, 0x23, 0x94, 0xD7, 0x4C, 0xCA, 0x8B, 0xBC, 0x20, 0x1D, 0x7B, 0x09, 0x5D,
+    0x34, 0xDB, 0xA4, 0x9E, 0x24, 0xA3, 0x35, 0xF4, 0xA2, 0x37, 0xE2, 0x1C, 0x91, 0x01, 0xE3, 0x55,
+    0x22, 0xB1, 0x23, 0x33, 0x36, 0xE9, 0xF3, 0x96, 0xBF, 0x66, 0xB7, 0x0C, 0x1E, 0xD9, 0x86, 0x94,
+    0x59, 0xFE, 0x12, 0xCB, 0x41, 0x27, 0xD9, 0x58, 0x9B, 0x62, 0x6E, 0x7B, 0x31, 0x79, 0xBE, 0x2F,
+    0x25, 0xCA, 0xA4, 0x1A, 0x20, 0x75, 0xDF, 0x4E, 0xCD, 0xAC, 0xB0, 0x9F, 0xA0, 0xA0, 0x68, 0x93,
+    0xE5, 0xBC, 0x58, 0x11, 0xC5, 0x27, 0xEF, 0x24, 0x06, 0xB1, 0xA3, 0x7C, 0x23, 0xDF, 0x52, 0x76,
+    0xCB, 0x5A, 0x2E, 0xAA, 0xAE, 0xE4, 0xCC, 0xA8, 0x96, 0x33, 0xE3, 0x85, 0x95, 0xA1, 0x56, 0xB0,
+    0x08, 0x5A, 0xB9, 0xA5, 0x5E, 0x11, 0x7F, 0xB3, 0x5D, 0xAD, 0xF4, 0x46, 0xCE, 0x88, 0xAD, 0xDC,
+    0xA0, 0x3B, 0x16, 0x9D, 0x22, 0xE8, 0x55, 0x9A, 0x14, 0x88, 0xC4, 0x44, 0x05, 0xB2, 0x88, 0xCF,
+    0xF1, 0xB1, 0xDD, 0x1D, 0xB2, 0x59, 0x86, 0xAA, 0x95, 0xA1, 0xB0, 0x2F, 0x7B, 0x2D, 0x6D, 0xB6,
+    0x07, 0x00, 0xFA, 0x04, 0x60, 0x77, 0x84, 0x11, 0x57, 0xE2, 0x1C, 0x40, 0x1F, 0x7E, 0x39, 0x8B,
+    0x08, 0x5F, 0x0C, 0xCF, 0xE2, 0xC3, 0x70, 0x9C, 0xDB, 0x5D, 0x2B, 0x00, 0xFC, 0x5F, 0x00, 0x3C,
+    0xEC, 0x57, 0xF3, 0x2F, 0xFA, 0xF5, 0xF3, 0x11, 0xFA, 0xD5, 0xE3, 0x0F, 0x23, 0x41, 0x8E, 0x1C,
+    0xF8, 0x71, 0xC8, 0x91, 0xBA, 0x0C, 0xAB, 0xD5, 0xFA, 0x21, 0x2A, 0xB9, 0x6D, 0x04, 0xD5, 0xB8,
+    0x1C, 0xB5, 0x32, 0xE4, 0xE4, 0xEC, 0x42, 0xBF, 0x80, 0xA6, 0x6F, 0xE3, 0x67, 0xFF, 0xD0, 0xAF,
+    0xBF, 0xBF, 0xFE, 0x04, 0xCD, 0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xDB, 0x3A, 0x2C, 0xC5,
+    0x85, 0x9B, 0x3B, 0x1A, 0x0A, 0xF7, 0x44, 0x8A, 0xFF, 0x01, 0x6B, 0x09, 0x51, 0xA5, 0xB9, 0xE2,
+    0xAE, 0x21, 0x45, 0xFA, 0x34, 0xF7, 0x0B, 0x22, 0x5B, 0xE2, 0x07, 0x70, 0x12, 0x05, 0x25, 0xB4,
+    0x77, 0x91, 0xB8, 0x96, 0x02, 0x69, 0xF7, 0x92, 0x82, 0x82, 0x02, 0x47, 0x88, 0x3A, 0x96, 0x10,
+    0x42, 0x4A, 0x8A, 0x2C, 0xC8, 0x22, 0x7E, 0xC7, 0xDA, 0xC3, 0xF7, 0xAD, 0xDF, 0xE5, 0xEE, 0x11,
+    0x21, 0x51, 0xF2, 0xE4, 0xD5, 0xBE, 0x37, 0x9E, 0x9D, 0xF9, 0xF6, 0x9B, 0x6F, 0xE6, 0x25, 0x63,
+    0xD9, 0x65, 0xA1, 0x76, 0x5C, 0xC9, 0x58, 0x36, 0x72, 0xFD, 0xB1, 0x8B, 0x64, 0xAA, 0xAE, 0x54,
+    0xF5, 0xF5, 0xE6, 0x64, 0x32, 0x43, 0x1E, 0x5A, 0x97, 0xCD, 0xF6, 0xE5, 0x93, 0xC5, 0xAA, 0xAE,
+    0x0B, 0xDF, 0x69, 0x33, 0x7D, 0x1E, 0xEA, 0x4D, 0x1D, 0xE8, 0x8B, 0x33, 0x3D, 0xCF, 0x4A, 0xD2,
+    0x48, 0xD1, 0x3F, 0x96, 0x2C, 0x18, 0x27, 0x5A, 0x7A, 0xA9, 0x64, 0x7C, 0x1B, 0x5B, 0x4E, 0xB4,
+    0x4B, 0x11, 0x40, 0x5A, 0xD5, 0xA1, 0xBC, 0xB2, 0x0B, 0x9C, 0xD5, 0x89, 0x94, 0x93, 0x48, 0xAA,
+    0x78, 0xDF, 0xBA, 0x83, 0xE3, 0x93, 0x11, 0xF1, 0x66, 0xC4, 0xD3, 0x46, 0x19, 0x54, 0x2A, 0x04,
+    0xC8, 0xC3, 0xD6, 0x43, 0x3B, 0xAC, 0xE7, 0x57, 0x9F, 0xEA, 0x80, 0x18, 0xBE, 0x42, 0x1C, 0x04,
+    0x3C, 0x15, 0x39, 0x12, 0xA9, 0x93, 0x31, 0x9B, 0x8C, 0x33, 0x9F, 0x85, 0x74, 0xA8, 0x9A, 0x9B,
+    0x8C, 0x85, 0x6A, 0xD7, 0xEA, 0x92, 0x9D, 0xB6, 0x3E, 0x9E, 0x2F, 0xC2, 0x7B, 0xE7, 0xEA, 0xAC,
+    0x06, 0xBC, 0x70, 0x07, 0x0F, 0x10, 0xD9, 0x3A, 0xA9, 0xA6, 0x5F, 0x3F, 0x50, 0x24, 0xEE, 0x55,
+    0xA7, 0x5C, 0x37, 0x22, 0x87, 0x38, 0xFC, 0xE1, 0xF9, 0xD7, 0x92, 0x10, 0x43, 0x0E, 0x30, 0xB2,
+    0x77, 0x7C, 0x14, 0x43, 0x26, 0xC0, 0x51, 0xFF, 0x82, 0xAB, 0x6A, 0x11, 0x10, 0xAC, 0x1C, 0xC5,
+    0xF4, 0xB5, 0x87, 0xB5, 0x75, 0xC5, 0x84, 0x04, 0xC6, 0x25, 0x9A, 0x80, 0xC5, 0x19, 0x6F, 0x72,
+    0xD2, 0x50, 0xFE, 0x31, 0xE3, 0x16, 0xAF, 0x91, 0xDD, 0x10, 0xBE, 0x0D, 0xBC, 0xC7, 0x20, 0xE0,
+    0x19, 0x28, 0x2B, 0xFC, 0x02, 0x1C, 0xFC, 0x40, 0xC4, 0x92, 0x66, 0x03, 0x6F, 0xD9, 0x8B, 0xA9,
+    0x1E, 0x01, 0x00, 0x50, 0xE2, 0x8C, 0x7A, 0x49, 0x8E, 0x8F, 0xA3, 0x31, 0x53, 0xC4, 0xAE, 0x3C,
+    0xD2, 0xE1, 0x6E, 0x01, 0x18, 0xB4, 0x69, 0x5D, 0xE5, 0xB3, 0x39, 0x5D, 0xA4, 0xF2, 0xA4, 0x1D,
+    0x6C, 0x15, 0xA3, 0x6D, 0xA4, 0xFD, 0xD1, 0xC3, 0x15, 0x71, 0x2B, 0xF2, 0xA8, 0xC8, 0x54, 0x10,
+    0x80, 0xF1, 0x31, 0x08, 0xBE, 0xF4, 0x2B, 0xB3, 0x64, 0xE5, 0x8E, 0x25, 0x3B, 0x11, 0x03, 0x29,
+    0x06, 0xA5, 0xF2, 0x51, 0xEA, 0x25, 0x9D, 0xAB, 0x01, 0xC1, 0x5A, 0xD0, 0xD6, 0x7D, 0x7B, 0x53,
+    0x48, 0x9E, 0xB2, 0x9F, 0x4F, 0x28, 0x73, 0xED, 0xA5, 0xF6, 0x08, 0xA4, 0x8D, 0x75, 0x79, 0x00,
+    0x0B, 0xF5, 0x90, 0x2D, 0xA2, 0xF0, 0xC8, 0x27, 0x29, 0x47, 0xBC, 0xA9, 0x3C, 0x72, 0x99, 0x1F,
+    0x50, 0xC5, 0x16, 0x44, 0xC7, 0x1C, 0xA9, 0x46, 0x08, 0x48, 0x54, 0xF2, 0xB2, 0x28, 0x4C, 0xFA,
+    0x44, 0x99, 0x7A, 0xDA, 0x72, 0xA4, 0x14, 0xCD, 0x3E, 0x33, 0x3D, 0xCE, 0x06, 0x29, 0x7D, 0x0B,
+    0xA1, 0xE4, 0xA3, 0x64, 0xFD, 0xBD, 0x1B, 0x0C, 0xB8, 0x86, 0x79, 0xCE, 0x44, 0x90, 0x8F, 0x75,
+    0xD6, 0x95, 0x63, 0xCC, 0x8F, 0x62, 0x0C, 0x89, 0x66, 0x81, 0xA7, 0x9C, 0xD8, 0xFB, 0x2C, 0x02,
+    0x01, 0xBC, 0x18, 0x50, 0xB9, 0x99, 0x49, 0x00, 0xC2, 0x4E, 0xD7, 0x14, 0x10, 0x48, 0xC4, 0xB0,
+    0xD5, 0xE1, 0x8A, 0x03, 0x65, 0x20, 0x96, 0x72, 0x13, 0x33, 0x1D, 0x7C, 0x72, 0x08, 0x27, 0x78,
+    0xD4, 0x3F, 0x05, 0x49, 0xE6, 0x1A, 0x25, 0xBD, 0xC4, 0xDB, 0xFD, 0x64, 0x55, 0x19, 0x6A, 0x91,
+    0x2E, 0x86, 0x30, 0x71, 0x3F, 0xEB, 0xB4, 0x41, 0x29, 0x14, 0x56, 0x90, 0x64, 0xBB, 0x72, 0x02,
+    0x94, 0xCA, 0x83, 0x45, 0xD3, 0xA3, 0xDE, 0xED, 0x33, 0x30, 0xA7, 0x75, 0x2F, 0xC9, 0xA2, 0x84,
+    0x30, 0xB1, 0x26, 0x4C, 0xBD, 0x10, 0xCC, 0x48, 0x75, 0x39, 0xB9, 0x73, 0x11, 0xC8, 0xC3, 0xB0,
+    0x92, 0x95, 0xB1, 0x78, 0x51, 0x8F, 0xB2, 0x77, 0x78, 0x8C, 0xDB, 0x58, 0x74, 0xAE, 0xE9, 0x52,
+    0xAC, 0x64, 0xAA, 0x1B, 0xD9, 0x5F, 0xB5, 0x92, 0x2D, 0x11, 0x63, 0xA2, 0x90, 0x9D, 0x7D, 0x4A,
+    0x1E, 0x0C, 0x54, 0x51, 0x8E, 0xC5, 0x14, 0xD9, 0x30, 0x97, 0xBA, 0x8A, 0x62, 0x81, 0x42, 0x48,
+    0x46, 0xFE, 0xD7, 0xB8, 0x6A, 0xA2, 0x5E, 0xB6, 0x5C, 0x10, 0x07, 0x25, 0x81, 0xFB, 0x90, 0x8A,
+    0x94, 0x28, 0x08, 0xC0, 0x2C, 0x5B, 0x26, 0x30, 0x28, 0x3A, 0xA8, 0x1E, 0x82, 0x7F, 0x3A, 0x4B,
+    0x7E, 0xAB, 0x16, 0x48, 0x59, 0xBE, 0x99, 0x91, 0x1F, 0x37, 0xD4, 0xB6, 0x47, 0xFC, 0x1D, 0x03,
+    0xEE, 0xFE, 0x02, 0xF5, 0xF8, 0x53, 0xBB, 0x7C, 0x46, 0xDB, 0xEA, 0x7D, 0x36, 0x36, 0x26, 0xC9,
+    0x98, 0x7C, 0xF3, 0x05, 0xB9, 0x67, 0x1F, 0x30, 0x31, 0xC2, 0xAC, 0xC5, 0xB8, 0x31, 0xA4, 0xBE,
+    0x6A, 0xD8, 0xD5, 0x5C, 0x89, 0x7F, 0xDB, 0xD6, 0x02, 0x4B, 0x9C, 0x4B, 0xB7, 0x97, 0xE1, 0x1A,
+    0xB0, 0x96, 0x8B, 0x19, 0x93, 0x61, 0x46, 0xE7, 0xCC, 0x72, 0xF1, 0xE5, 0xBC, 0x06, 0xDD, 0x5D,
+    0x80, 0xF1, 0x1B, 0x50, 0x60, 0x7B, 0x83, 0x81, 0x84, 0xD2, 0x52, 0xD1, 0xFF, 0x71, 0x03, 0x69,
+    0xAD, 0xF6, 0x39, 0x82, 0x63, 0x8B, 0xF1, 0xCC, 0x3F, 0x37, 0x0E, 0x52, 0x0D, 0x56, 0x67, 0x3E,
+    0x3F, 0x1F, 0xD9, 0x4E, 0xFE, 0xF5, 0xD1, 0x6E, 0x7D, 0xA4, 0xDD, 0x7D, 0x1E, 0x35, 0x92, 0x0D,
+    0xA4, 0xB8, 0xBE, 0x24, 0x25, 0x36, 0x67, 0x4B, 0x8C, 0x45, 0x27, 0xB2, 0xDB, 0x86, 0xA2, 0xAC,
+    0x17, 0xD9, 0x00, 0x5F, 0xBF, 0x47, 0x4D, 0x7F, 0xFF, 0xAE, 0xF9, 0xFC, 0x10, 0x66, 0x30, 0x0E,
+    0x33, 0x26, 0x1C, 0xCC, 0xF8, 0x4E, 0x6F, 0xEB, 0xE9, 0x0D, 0xD1, 0xC2, 0x5B, 0x3F, 0x8E, 0x94,
+    0xD2, 0x5C, 0x8D, 0x34, 0x2B, 0xCC, 0x98, 0xD2, 0xD1, 0xDB, 0xC3, 0x8C, 0x49, 0xC4, 0x20, 0xA7,
+    0xC2, 0x1E, 0xE9, 0xBE, 0x83, 0x74, 0x3D, 0x80, 0xA6, 0x01, 0xE2, 0x96, 0x7B, 0xE9, 0x70, 0x0B,
+    0x58, 0x41, 0x5D, 0x5F, 0x51, 0x58, 0x8B, 0x65, 0x3B, 0x5F, 0x70, 0xAE, 0xBD, 0x62, 0x47, 0x5D,
+    0xE1, 0x7C, 0xC6, 0xBF, 0x11, 0x18, 0x11, 0xD5, 0xBC, 0x9A, 0x1F, 0x2E, 0x25, 0x3C, 0xF5, 0x19,
+    0x3C, 0x6B, 0x0F, 0xCF, 0x22, 0xC0, 0xF8, 0x60, 0xA1, 0xA7, 0x46, 0xCF, 0x06, 0x9E, 0x1B, 0xC1,
+    0x3F, 0x11, 0x2A, 0xB5, 0xB3, 0xC2, 0xCA, 0xC0, 0xED, 0x05, 0xA4, 0xEE, 0x7A, 0xDD, 0x5D, 0xCE,
+    0x9B, 0x77, 0x7C, 0x96, 0x33, 0x61, 0xE5, 0xAE, 0xD7, 0x8E, 0x2C, 0xBE, 0x9A, 0xD7, 0x8E, 0xE0,
+    0xF4, 0x89, 0x4D, 0xC7, 0x51, 0xA0, 0x03, 0x52, 0xC5, 0xED, 0xE5, 0x19, 0x05, 0x0A, 0x6D, 0x3E,
+    0xDC, 0x1C, 0xC1, 0xE0, 0x54, 0xF9, 0xD7, 0xE7, 0xB6, 0xC6, 0xB8, 0x29, 0x0E, 0x78, 0x6E, 0xA0,
+    0x06, 0x35, 0x8B, 0xDB, 0xFB, 0x8A, 0x79, 0x37, 0x48, 0x8D, 0xC0, 0x67, 0xF2, 0x7F, 0xF9, 0xFC,
+    0x0D, 0xAD, 0x55, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0x7B, 0xF3, 0x62, 0xE9, 0x2C, 0xB4, 0x20,
+    0x25, 0x14, 0x50, 0xB8, 0xA3, 0xB8, 0x22, 0xFE, 0x0F, 0x58, 0x93, 0x2B, 0x22, 0xA5, 0xB9, 0x2B,
+    0x12, 0x21, 0xD1, 0x20, 0xBA, 0x90, 0x02, 0x28, 0xA8, 0x59, 0x5F, 0xAE, 0xA0, 0xA0, 0x20, 0x0D,
+    0x0D, 0x4D, 0x82, 0x94, 0xE2, 0xEE, 0x8A, 0xA4, 0x0D, 0x91, 0xC8, 0x2E, 0xB9, 0x22, 0x45, 0x1A,
+    0x93, 0x2B, 0x28, 0xE3, 0xA0, 0xA0, 0x14, 0x14, 0xD9, 0x23, 0x0E, 0x32, 0xDC, 0xDA, 0xC3, 0x37,
+    0x7E, 0xEF, 0xEE, 0x52, 0x71, 0x57, 0xB0, 0xFB, 0x9E, 0x3D, 0xF6, 0xCC, 0x7C, 0xF3, 0x63, 0x67,
+    0xC6, 0xA6, 0xA5, 0xA2, 0xCF, 0x07, 0xD2, 0x91, 0xD8, 0x67, 0x03, 0x15, 0x9D, 0x62, 0x4A, 0x39,
+    0x65, 0x22, 0xD3, 0x72, 0x4D, 0xD9, 0xC0, 0x9E, 0x88, 0xB9, 0x21, 0xD2, 0xDC, 0x12, 0x25, 0x1C,
+    0x08, 0xAC, 0x5E, 0x2E, 0x90, 0xA1, 0x42, 0x5E, 0x6A, 0x1E, 0x88, 0xF2, 0xE8, 0x3C, 0xC4, 0x75,
+    0x4F, 0x8A, 0x13, 0xAE, 0x80, 0x60, 0xF8, 0x29, 0xD7, 0x8A, 0x7B, 0x20, 0xB8, 0xD1, 0x35, 0x10,
+    0xAB, 0xA1, 0x51, 0x42, 0x81, 0x72, 0x01, 0x50, 0x23, 0x2E, 0xEF, 0x71, 0x25, 0x00, 0x30, 0xA2,
+    0x04, 0x8A, 0xC4, 0x92, 0x2C, 0xDB, 0x4E, 0x5E, 0xD8, 0x56, 0x47, 0xF8, 0x66, 0x1F, 0x8B, 0x57,
+    0xB6, 0x85, 0x64, 0x04, 0x0F, 0x96, 0x53, 0x91, 0x36, 0x40, 0xC8, 0xB9, 0x13, 0x07, 0x3D, 0x99,
+    0x97, 0x23, 0x9C, 0x28, 0x3A, 0xE2, 0xDA, 0xB1, 0x09, 0x8A, 0xF7, 0x07, 0x2A, 0xC5, 0x47, 0x2D,
+    0x2E, 0x1F, 0x10, 0x6F, 0x8F, 0xA2, 0x0B, 0x23, 0x25, 0x80, 0x92, 0x2D, 0x44, 0x89, 0x04, 0x94,
+    0x1D, 0x99, 0x20, 0x66, 0x1A, 0xA4, 0x80, 0xFD, 0x3C, 0x7E, 0xDE, 0x80, 0xA8, 0x7D, 0x12, 0x25,
+    0xD2, 0x8E, 0x66, 0x9F, 0xF3, 0xAB, 0xB5, 0x82, 0x99, 0xC3, 0xD1, 0x05, 0xF0, 0x61, 0xCE, 0x25,
+    0xF7, 0x28, 0x22, 0x37, 0x2B, 0xE3, 0x3C, 0xF8, 0x5C, 0xB2, 0x59, 0xF4, 0x00, 0x35, 0x10, 0xEA,
+    0x24, 0xF6, 0x28, 0x01, 0xE5, 0x31, 0xE1, 0x9A, 0x3D, 0x78, 0x9D, 0xF3, 0x53, 0x3C, 0x86, 0x43,
+    0x72, 0x87, 0xC7, 0xEB, 0x8E, 0xB9, 0x2B, 0x99, 0x87, 0xD3, 0x8E, 0xFF, 0x99, 0x82, 0xD4, 0x91,
+    0x6B, 0x89, 0x46, 0x8D, 0x29, 0xE3, 0x48, 0xCC, 0x6F, 0x40, 0x45, 0x96, 0x93, 0x9A, 0xDA, 0xAB,
+    0x77, 0xEF, 0xDD, 0xBD, 0xD9, 0xFE, 0x50, 0xDF, 0xA4, 0xE3, 0x37, 0x82, 0xAD, 0x72, 0x3A, 0xB7,
+    0x75, 0xEE, 0x76, 0xBE, 0x94, 0x5E, 0xA4, 0xA5, 0xE3, 0xF7, 0xF2, 0xF6, 0x2A, 0xEF, 0x72, 0xC7,
+    0xC3, 0x21, 0x81, 0x50, 0xF7, 0xF1, 0x7F, 0x81, 0xFF, 0x77, 0x97, 0xA7, 0x65, 0x98, 0x9F, 0x30,
+    0xFF, 0x05, 0x7F, 0xE7, 0xCF, 0x97, 0x78, 0x5A, 0x71, 0x71, 0x73, 0xF3, 0xDB, 0x7F, 0xF1, 0xE4,
+    0x84, 0xE9, 0xA7, 0xFF, 0xFD, 0xB7, 0x4C, 0x57, 0xCE, 0x5E, 0xBE, 0xBC, 0x02, 0x03, 0xCB, 0xDB,
+    0xDB, 0x52, 0x6D, 0xAF, 0x3D, 0x65, 0xED, 0x7D, 0xFD, 0x38, 0x9A, 0x9D, 0xE8, 0xD6, 0xD7, 0xF4,
+    0xD3, 0xB1, 0xDC, 0x8D, 0x66, 0xA3, 0xB3, 0x49, 0x95, 0x77, 0xC6, 0x73, 0xD6, 0x95, 0x7E, 0x54,
+    0x61, 0x56, 0xD9, 0xAF, 0xA3, 0x79, 0x10, 0x8B, 0x66, 0xCC, 0xC2, 0xD9, 0xAC, 0x2D, 0xCF, 0xF7,
+    0xBA, 0x19, 0xB2, 0xE0, 0x54, 0x34, 0x7E, 0xD4, 0xC1, 0x7D, 0xD3, 0x9B, 0xE6, 0xD2, 0x6C, 0x4D,
+    0xB7, 0xEE, 0x42, 0x6F, 0x1E, 0x0F, 0x3A, 0xB0, 0xEA, 0xCD, 0xFA, 0xA0, 0x1B, 0x97, 0x05, 0x53,
+    0xAD, 0xCD, 0xE6, 0x68, 0x2A, 0xEA, 0x60, 0xD7, 0xC7, 0x3C, 0x14, 0x9E, 0xD3, 0xA8, 0x1B, 0xF3,
+    0x41, 0x4C, 0xD6, 0x66, 0x64, 0x37, 0x62, 0x11, 0xDC, 0x4A, 0x2C, 0x5A, 0xE0, 0x15, 0x8D, 0x53,
+    0x7D, 0xE1, 0xAD, 0xEA, 0x66, 0xD5, 0x19, 0xA9, 0xF8, 0x12, 0xED, 0x13, 0x28, 0x91, 0x7A, 0x43,
+    0xA9, 0xD6, 0xE9, 0x87, 0xBF, 0x7F, 0x82, 0x04, 0x5B, 0xE6, 0x8F, 0x6E, 0x7C, 0x5F, 0x2B, 0x54,
+    0x3B, 0x7A, 0xE6, 0x7D, 0x70, 0x3C, 0x29, 0x54, 0x9D, 0xB4, 0x01, 0xDA, 0xEF, 0x50, 0xC7, 0x4D,
+    0x00, 0x79, 0x37, 0x35, 0x4F, 0xD1, 0x90, 0xEA, 0x26, 0x19, 0x40, 0xE5, 0x3E, 0x63, 0xFE, 0x9B,
+    0x79, 0x04, 0x54, 0xBD, 0xD0, 0x46, 0x25, 0x99, 0x0A, 0x50, 0x89, 0x0A, 0x6F, 0xCD, 0x39, 0x37,
+    0x5E, 0xBC, 0x68, 0x17, 0xB8, 0x62, 0xBE, 0xA1, 0x4C, 0xA0, 0xD2, 0x51, 0xF1, 0x1E, 0x0F, 0x8E,
+    0xEF, 0xF0, 0x1F, 0x28, 0x85, 0x58, 0x8E, 0x09, 0x54, 0x29, 0x23, 0xFA, 0x0A, 0xBD, 0x4E, 0x36,
+    0x66, 0xDC, 0x5B, 0x7E, 0xC8, 0x8D, 0x6D, 0xE1, 0xC7, 0x97, 0x62, 0x7B, 0xB6, 0x32, 0x98, 0x97,
+    0x5C, 0x36, 0x88, 0x77, 0x56, 0x71, 0x65, 0x1F, 0x02, 0x02, 0x23, 0x06, 0xF9, 0x2B, 0xDA, 0x33,
+    0x34, 0x93, 0x5D, 0x25, 0x60, 0xB8, 0x7A, 0x62, 0x09, 0x53, 0x47, 0x61, 0x97, 0x8D, 0x08, 0x9C,
+    0x12, 0x01, 0x35, 0xD8, 0xE7, 0xA3, 0xF1, 0x6B, 0x57, 0x37, 0xEF, 0x6D, 0x9E, 0xA4, 0xCA, 0x65,
+    0x2F, 0x6F, 0x2D, 0xDF, 0x3E, 0x49, 0x7D, 0x4F, 0x9B, 0xEC, 0x70, 0xB4, 0xD3, 0xFA, 0xF8, 0x2D,
+    0x1A, 0x5F, 0xD0, 0x7C, 0x9F, 0x5C, 0x83, 0xDE, 0x98, 0xEF, 0x93, 0x6A, 0x1C, 0x2C, 0x19, 0x18,
+    0xD3, 0x1C, 0xC4, 0x60, 0xCD, 0xC3, 0x34, 0x0E, 0xD9, 0xAB, 0xE9, 0x6C, 0xCD, 0x4E, 0x97, 0x4A,
+    0xF7, 0x40, 0x60, 0xA4, 0x89, 0x50, 0x52, 0xBA, 0x93, 0xDA, 0x90, 0x07, 0x3B, 0x11, 0xE6, 0x7C,
+    0x6F, 0xEA, 0x85, 0x50, 0xF1, 0xF3, 0x8F, 0x74, 0xFA, 0x59, 0x1A, 0xCD, 0xEA, 0x2E, 0xB7, 0x18,
+    0xC1, 0x96, 0x1F, 0xFD, 0xC9, 0x43, 0xCE, 0x7D, 0xCE, 0xBB, 0xDD, 0x58, 0xEE, 0xF4, 0x8E, 0xEC,
+    0xB5, 0x68, 0xD5, 0x5E, 0x14, 0x93, 0xB1, 0xF0, 0x83, 0x15, 0x4B, 0xA8, 0x7F, 0xF3, 0xB1, 0xC7,
+    0x61, 0xDB, 0x24, 0xEA, 0x5F, 0x51, 0xDB, 0x64, 0x6A, 0xAB, 0x5E, 0x89, 0x50, 0xE1, 0xF5, 0x2F,
+    0xD1, 0x5C, 0x08, 0x40, 0x57, 0x23, 0xE7, 0xFB, 0x51, 0x7C, 0xC4, 0xD7, 0x00, 0x5D, 0x0D, 0xCD,
+    0x8C, 0x2B, 0x3D, 0x4C, 0x5E, 0x9C, 0x22, 0x7A, 0x93, 0x5E, 0x5F, 0x29, 0x66, 0x3D, 0x80, 0xA6,
+    0xA5, 0x31, 0x83, 0xDD, 0xE2, 0x7D, 0x81, 0x31, 0x3A, 0x2C, 0xE8, 0xC3, 0xF8, 0x84, 0x5E, 0xE9,
+    0xE7, 0x41, 0x4F, 0x21, 0xC5, 0xBC, 0x3D, 0xA2, 0x51, 0xF8, 0x87, 0xB4, 0x39, 0xC8, 0x9C, 0xD9,
+    0xE8, 0xED, 0xE9, 0x67, 0xF4, 0xEE, 0x75, 0xFA, 0xAC, 0x2A, 0x77, 0x10, 0x1C, 0x93, 0x8B, 0xA9,
+    0x0C, 0xEB, 0x3D, 0xCC, 0x9D, 0x75, 0x1E, 0x33, 0x8E, 0x12, 0x35, 0x97, 0x18, 0x02, 0x7A, 0x6F,
+    0x48, 0xD0, 0xA1, 0x83, 0xDE, 0xED, 0xCC, 0x2A, 0x72, 0x49, 0x08, 0x4A, 0x3F, 0x0F, 0xE6, 0x5B,
+    0xA1, 0xCB, 0xF5, 0x05, 0xED, 0xE6, 0x09, 0x38, 0xA0, 0x91, 0x72, 0x91, 0x17, 0x19, 0x34, 0xDD,
+    0x50, 0xEC, 0xF6, 0x66, 0xB5, 0x1D, 0x48, 0xF5, 0xE4, 0xDC, 0x83, 0x91, 0x33, 0xE4, 0x22, 0x93,
+    0x5C, 0x54, 0x3C, 0xE0, 0xC3, 0x27, 0x87, 0x88, 0x5C, 0x98, 0x4E, 0x0E, 0x54, 0x56, 0x45, 0xC9,
+    0x74, 0x1F, 0x11, 0xBA, 0xA9, 0x4B, 0xAF, 0x7D, 0x8E, 0xA6, 0x4B, 0x6E, 0xE1, 0x4D, 0x1E, 0xF2,
+    0x60, 0x6A, 0x73, 0x2D, 0xCA, 0xBC, 0xD0, 0xFE, 0x3E, 0xDD, 0x57, 0x41, 0x85, 0xB2, 0x7A, 0xA7,
+    0xDA, 0x9C, 0xB8, 0xA6, 0xC6, 0xB8, 0x28, 0x3D, 0x04, 0x74, 0x53, 0x7A, 0x9C, 0x34, 0x64, 0x54,
+    0xC8, 0x5B, 0x93, 0x76, 0x22, 0x16, 0x93, 0x5B, 0x4B, 0xF5, 0x15, 0x80, 0xE2, 0x28, 0x46, 0x9C,
+    0x50, 0x8A, 0x8F, 0x0F, 0x65, 0x2D, 0x6D, 0x42, 0x81, 0xA0, 0x29, 0x10, 0x88, 0xA3, 0x4D, 0x7B,
+    0xED, 0x21, 0x8F, 0x61, 0x68, 0x68, 0xA9, 0xFE, 0x94, 0xFE, 0x05, 0xAD, 0x54, 0x3D, 0x6F, 0xDD,
+    0x54, 0x18, 0x7E, 0xEC, 0x73, 0x6F, 0x8C, 0x64, 0xA4, 0xD3, 0x21, 0x91, 0xF8, 0x90, 0xF0, 0xDC,
+    0x0A, 0xC5, 0x8C, 0x1D, 0xDA, 0x1E, 0x4B, 0x11, 0x13, 0x43, 0x33, 0x94, 0x89, 0xA1, 0x3B, 0x4B,
+    0x56, 0x86, 0x2A, 0xB6, 0xE8, 0xC0, 0xC0, 0xD0, 0x91, 0x81, 0xA5, 0x43, 0x85, 0x68, 0x7F, 0x41,
+    0x06, 0x1A, 0x9F, 0x90, 0xA1, 0x03, 0x8B, 0x55, 0x10, 0x8C, 0xB5, 0x14, 0x10, 0x12, 0x0C, 0xB5,
+    0x8A, 0xA3, 0x3A, 0xEA, 0xB1, 0x5F, 0x9E, 0x63, 0x3B, 0xE9, 0x6D, 0x55, 0x41, 0x85, 0x38, 0xF7,
+    0xBE, 0xE7, 0xDC, 0xFB, 0x7E, 0x7F, 0x9B, 0xCF, 0x5D, 0x52, 0x85, 0x4E, 0xD7, 0x02, 0x5D, 0x97,
+    0xAA, 0x43, 0xAE, 0xBA, 0xC4, 0x86, 0x9D, 0xB6, 0x03, 0xB4, 0xDD, 0x57, 0x0D, 0x76, 0x55, 0x93,
+    0x14, 0xE1, 0xED, 0x77, 0xB2, 0x6F, 0xB1, 0x0E, 0xDC, 0x00, 0x7A, 0x04, 0x02, 0xF5, 0xA8, 0x88,
+    0x1E, 0x58, 0x7D, 0xB3, 0x4E, 0x82, 0xE6, 0x0A, 0xBA, 0x4B, 0x24, 0x9C, 0x43, 0x5A, 0x24, 0x8D,
+    0x6E, 0x75, 0xA7, 0x5D, 0xEC, 0x42, 0x81, 0x69, 0xD4, 0x00, 0x53, 0x45, 0x0E, 0xFB, 0x58, 0x60,
+    0x89, 0xD8, 0xC6, 0x0E, 0xA5, 0xD5, 0x1D, 0x24, 0x4B, 0xDA, 0xA8, 0x57, 0xBD, 0x1A, 0x42, 0x21,
+    0x63, 0x8A, 0x20, 0xC3, 0x74, 0x16, 0xC8, 0x09, 0x6D, 0x38, 0x60, 0x2F, 0x6E, 0xE3, 0x2E, 0xEE,
+    0x74, 0x9B, 0xD8, 0xB2, 0xD0, 0xED, 0x22, 0xEE, 0xA0, 0x5B, 0x94, 0x05, 0x6F, 0xFE, 0xE4, 0xCD,
+    0x9F, 0xEB, 0x5A, 0xDC, 0x52, 0x75, 0x5A, 0xAC, 0xA4, 0x8D, 0x76, 0xAA, 0xCF, 0x6D, 0xD9, 0xEA,
+    0xE6, 0x7E, 0x2C, 0x6D, 0x92, 0xA1, 0xBC, 0xD5, 0x02, 0x5E, 0x03, 0xE0, 0x35, 0xE0, 0x54, 0xC3,
+    0x9E, 0xD7, 0x10, 0xB7, 0xD4, 0x5C, 0x98, 0x5A, 0xDB, 0xB7, 0x50, 0x66, 0x6F, 0xD2, 0xF4, 0x1D,
+    0x42, 0x5E, 0x99, 0xDF, 0x07, 0x25, 0xA6, 0x32, 0x7F, 0xD1, 0x39, 0x3E, 0x47, 0xE3, 0x93, 0x1E,
+    0xB9, 0x70, 0x30, 0x36, 0xFD, 0xD1, 0x85, 0xFD, 0xF8, 0x04, 0x7D, 0x6A, 0x93, 0x87, 0x2E, 0x70,
+    0xB3, 0xDB, 0x4B, 0x2C, 0xB7, 0xFA, 0x70, 0xC8, 0x6B, 0xF3, 0xD4, 0x8B, 0xDB, 0xB4, 0xDA, 0x66,
+    0x3E, 0x78, 0x76, 0x24, 0xCB, 0x65, 0x88, 0x44, 0x3A, 0xD3, 0x97, 0x07, 0x3B, 0x87, 0x2E, 0x74,
+    0xA9, 0x4D, 0x0F, 0x29, 0x59, 0x16, 0xC9, 0xE3, 0x26, 0x10, 0x87, 0x64, 0x00, 0x13, 0x02, 0xDD,
+    0x00, 0x03, 0x4E, 0x8F, 0x4F, 0x88, 0x00, 0x49, 0xCB, 0x64, 0x4F, 0xB4, 0xF5, 0x89, 0x60, 0x44,
+    0x86, 0x53, 0xF0, 0xFF, 0x15, 0x19, 0xDF, 0xBF, 0x04, 0x44, 0x45, 0x83, 0xA0, 0x89, 0xEA, 0xE0,
+    0x3B, 0x68, 0x4F, 0x79, 0x77, 0x98, 0x53, 0x1A, 0x88, 0xD7, 0x21, 0x2C, 0x24, 0x0B, 0xA0, 0x99,
+    0x38, 0x65, 0x81, 0x8B, 0x1F, 0x90, 0x60, 0x27, 0x86, 0xB7, 0x01, 0xCA, 0xEF, 0x01, 0xE4, 0x6B,
+    0xA0, 0x2A, 0x44, 0x16, 0x3A, 0x43, 0x02, 0x5C, 0x5E, 0xA9, 0xF7, 0x9F, 0x99, 0x3A, 0xB4, 0xF1,
+    0xCD, 0x4A, 0x07, 0xCD, 0x26, 0x5A, 0x5F, 0xEF, 0xE7, 0x27, 0x3C, 0x4D, 0x43, 0x3E, 0xBF, 0xC9,
+    0xAC, 0x3A, 0xAA, 0xA7, 0xE7, 0xD7, 0x6E, 0xA4, 0x84, 0x22, 0x32, 0x52, 0x4A, 0xEF, 0x8F, 0x4F,
+    0xDB, 0x4E, 0x7F, 0x6D, 0xE4, 0x88, 0x65, 0x16, 0x78, 0x36, 0xE2, 0xA1, 0xBA, 0x29, 0x15, 0xCA,
+    0xA5, 0x95, 0x8F, 0x61, 0x7B, 0x53, 0x55, 0x1B, 0x93, 0xA1, 0x2C, 0xA5, 0x8A, 0xD2, 0xF3, 0x92,
+    0x35, 0x29, 0x48, 0x74, 0x58, 0x44, 0xF5, 0x02, 0xD9, 0x2E, 0x3E, 0xFA, 0xED, 0xA4, 0xC4, 0xEE,
+    0xF5, 0xAF, 0x9F, 0x78, 0x43, 0xA9, 0x88, 0xE3, 0xDB, 0x68, 0x5E, 0xD8, 0xE9, 0x33, 0xAC, 0xC9,
+    0x4F, 0xCC, 0x0D, 0x25, 0x99, 0x91, 0xD8, 0x1B, 0x2A, 0x4B, 0x44, 0x2D, 0x0D, 0xE5, 0x57, 0xEB,
+    0xD1, 0x90, 0xF9, 0xBE, 0xC7, 0xA6, 0x2A, 0x10, 0xD4, 0x17, 0xCF, 0x62, 0xFB, 0xF4, 0x5E, 0x2A,
+    0x3F, 0xC8, 0x13, 0xF1, 0x21, 0x3A, 0xEF, 0xD8, 0x64, 0x58, 0xD7, 0x53, 0x94, 0x26, 0x9B, 0x9C,
+    0xE9, 0xE9, 0x1C, 0x49, 0x6A, 0x95, 0x54, 0x4C, 0x09, 0xE9, 0x27, 0xBF, 0x95, 0x6F, 0x46, 0x4F,
+    0x5E, 0x21, 0xC9, 0x78, 0xAC, 0x28, 0xA7, 0x1B, 0x33, 0x3F, 0x7F, 0x78, 0xD4, 0x71, 0xBE, 0x8A,
+    0x3C, 0xCE, 0x59, 0xEC, 0x7B, 0xB7, 0xCD, 0x90, 0xF3, 0x13, 0x0C, 0x78, 0xE1, 0x73, 0x61, 0xC4,
+    0x6E, 0xBC, 0x84, 0xDD, 0x18, 0xB1, 0x17, 0xEE, 0xCE, 0x51, 0xAC, 0x31, 0xE4, 0x7C, 0x60, 0x2B,
+    0x4A, 0x2C, 0x52, 0xF3, 0xF9, 0x52, 0xA4, 0x35, 0xDF, 0xC8, 0xE1, 0xC9, 0x8E, 0x5B, 0x87, 0x79,
+    0x98, 0x71, 0x48, 0x39, 0xAA, 0xCC, 0x37, 0x1F, 0x0B, 0xFF, 0x8F, 0x95, 0xE2, 0xA4, 0x2A, 0xE6,
+    0x2B, 0x6F, 0x90, 0x38, 0x16, 0xCF, 0x72, 0xA2, 0x11, 0x0D, 0x98, 0x86, 0x70, 0xEC, 0x4F, 0x1F,
+    0x2B, 0x11, 0xBA, 0xC2, 0x4B, 0x67, 0xFD, 0x79, 0x0B, 0xB3, 0x2F, 0xA5, 0x40, 0x3A, 0x75, 0x72,
+    0xDA, 0x4C, 0x72, 0xCD, 0x19, 0xCB, 0xD8, 0xA3, 0x65, 0x8F, 0xFC, 0x17, 0xD6, 0x2A, 0x39, 0x66,
+    0xA4, 0x51, 0x4F, 0xCF, 0x0E, 0xE4, 0x43, 0x1A, 0xF1, 0x2E, 0xF5, 0x9E, 0x59, 0xD4, 0xE8, 0x92,
+    0xF8, 0xCB, 0xD8, 0x40, 0x2C, 0x91, 0x62, 0x89, 0xA4, 0x2F, 0xE2, 0x5D, 0x36, 0x96, 0xBE, 0xE8,
+    0x66, 0xC5, 0x85, 0xA5, 0xFF, 0x12, 0xA3, 0x1B, 0xFA, 0x1C, 0x0D, 0xB4, 0xCE, 0xEF, 0xC8, 0x49,
+    0xB3, 0xB3, 0xE5, 0xA4, 0x5D, 0x93, 0x2E, 0x1A, 0xB4, 0x2F, 0xC2, 0x16, 0xFB, 0xC5, 0x54, 0xE5,
+    0x57, 0x72, 0xB5, 0x7D, 0x03, 0xE9, 0x51, 0xEF, 0x77, 0x07, 0x3D, 0x56, 0x9C, 0x78, 0x06, 0x4F,
+    0x45, 0xA1, 0x6C, 0x39, 0x26, 0x24, 0x13, 0x7F, 0x79, 0x27, 0x7C, 0x3D, 0x73, 0x5F, 0xDC, 0xD4,
+    0xAE, 0xD8, 0xA5, 0xEA, 0x0D, 0x4A, 0xC1, 0xD4, 0x8C, 0x5B, 0x3B, 0xE4, 0x35, 0x93, 0x48, 0xF1,
+    0x32, 0xC3, 0x36, 0x82, 0xB1, 0xF9, 0x9F, 0xB2, 0xC4, 0x8F, 0x08, 0x19, 0x22, 0x36, 0x0D, 0xA5,
+    0x83, 0x61, 0xCA, 0x09, 0x79, 0x7C, 0xA0, 0xEC, 0xC5, 0x33, 0x4C, 0x31, 0x15, 0xA5, 0xF2, 0x53,
+    0x38, 0x1E, 0x2F, 0x47, 0xA8, 0x4F, 0x72, 0x69, 0x3B, 0x23, 0x1D, 0xC1, 0xFD, 0x03, 0x78, 0x9E,
+    0x9A, 0x50, 0x74, 0x97, 0xCF, 0xA1, 0xE3, 0x48, 0xBF, 0x0E, 0xDC, 0x39, 0x3F, 0x4E, 0xA9, 0x5F,
+    0x5C, 0x43, 0x32, 0x6E, 0x1B, 0xB7, 0xE9, 0x21, 0x7F, 0x05, 0xCC, 0xB4, 0x2B, 0x5A, 0x26, 0x7E,
+    0x8E, 0xCC, 0x5D, 0xEE, 0x3C, 0xE4, 0x53, 0xA7, 0xB5, 0x37, 0x48, 0x24, 0xF4, 0x33, 0x0C, 0x2B,
+    0xD0, 0xCF, 0x34, 0xE7, 0xF9, 0x08, 0x15, 0x45, 0xE7, 0x35, 0x57, 0x8C, 0x8D, 0x15, 0xFA, 0xA1,
+    0xA9, 0xB0, 0x9F, 0x7C, 0x72, 0xC4, 0x90, 0x6F, 0x11, 0x96, 0xF9, 0xC9, 0x36, 0xB8, 0x3D, 0xF4,
+    0xE3, 0x1A, 0x65, 0x52, 0x29, 0x67, 0x6C, 0x54, 0x7D, 0xE6, 0xF3, 0xEA, 0x3D, 0x8E, 0x86, 0xA4,
+    0x33, 0xD5, 0xF9, 0x17, 0x5A, 0xF1, 0x63, 0x4E, 0x50, 0x9B, 0x54, 0xA6, 0x28, 0xE1, 0xC2, 0xE6,
+    0xF5, 0x76, 0xE2, 0xFF, 0x77, 0xFE, 0x75, 0x3F, 0xFF, 0xB7, 0x48, 0xA7, 0xD1, 0xF3, 0xB2, 0xF7,
+    0x47, 0xD9, 0xF4, 0x8B, 0x9F, 0x3B, 0xCA, 0x78, 0xD9, 0x83, 0xEB, 0xC3, 0x35, 0x18, 0x76, 0xEA,
+    0xB3, 0x0E, 0xE9, 0x83, 0x16, 0x6C, 0xDD, 0xA0, 0x7D, 0x8F, 0x8B, 0xF3, 0x55, 0xEE, 0xFD, 0x0D,
+    0xDD, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0x7E, 0x33, 0xA3, 0xF3, 0x4A, 0x5E, 0xA1, 0xE9, 0xAF,
+    0x60, 0x29, 0x83, 0x15, 0xB1, 0x6D, 0x0A, 0x9C, 0x59, 0xE9, 0x0A, 0xB7, 0x57, 0xC4, 0xA2, 0x4C,
+    0x43, 0x61, 0xA5, 0x00, 0xFE, 0x80, 0x24, 0xB3, 0xC2, 0x05, 0x25, 0x2E, 0xE8, 0x71, 0x71, 0x05,
+    0x5C, 0x5A, 0x0A, 0x22, 0xD9, 0xDE, 0x49, 0xFC, 0x07, 0x64, 0x88, 0x15, 0x59, 0x82, 0xC2, 0x2B,
+    0x59, 0x02, 0x45, 0x34, 0x23, 0xB2, 0x86, 0xB5, 0x33, 0x3B, 0x8F, 0x37, 0x7B, 0x17, 0x3B, 0x26,
+    0x36, 0x3A, 0x5A, 0xDE, 0xDC, 0xED, 0x3D, 0xCD, 0xBC, 0xF7, 0xED, 0xF7, 0x7E, 0xCC, 0x3B, 0x00,
+    0xC8, 0x6C, 0xF6, 0xCC, 0xCB, 0x63, 0x14, 0x4D, 0xF5, 0xA5, 0x5F, 0x2A, 0x3A, 0x00, 0x0D, 0xA0,
+    0x4A, 0xC8, 0x0C, 0xA4, 0x0E, 0x44, 0x03, 0xDC, 0x03, 0x84, 0x37, 0xBB, 0xD2, 0xCE, 0x76, 0x07,
+    0xCC, 0x67, 0x2E, 0xA4, 0x5E, 0x73, 0xCC, 0x0D, 0xED, 0x33, 0x60, 0xD5, 0x4B, 0x00, 0xB8, 0x91,
+    0x22, 0x86, 0x31, 0x78, 0x85, 0x51, 0x9A, 0x87, 0x30, 0xA4, 0x1F, 0xFB, 0x03, 0xC0, 0xA0, 0x22,
+    0x8C, 0xB9, 0xB0, 0x3B, 0x00, 0x09, 0xB6, 0xC0, 0xC3, 0xA3, 0x06, 0x7E, 0x84, 0xC4, 0xBE, 0x0F,
+    0x90, 0x8E, 0x4A, 0x80, 0x8F, 0x3F, 0xA0, 0xC3, 0x02, 0xF8, 0x16, 0x80, 0xB0, 0x20, 0x36, 0x7F,
+    0xB2, 0xE9, 0xF1, 0xA1, 0xE3, 0x88, 0x06, 0x2A, 0x84, 0x95, 0x2A, 0x7C, 0x4F, 0xB8, 0x5D, 0xFC,
+    0x82, 0x0E, 0xC0, 0x10, 0xCB, 0xE4, 0xAF, 0x5F, 0xEA, 0x64, 0xFF, 0x79, 0xCD, 0x84, 0x2D, 0xA2,
+    0x4F, 0xEF, 0x0F, 0xDA, 0x00, 0x47, 0xC2, 0x24, 0xE6, 0xB2, 0x86, 0xCB, 0xF2, 0x21, 0x61, 0x53,
+    0x90, 0x59, 0x4B, 0xF1, 0xD0, 0xD9, 0x43, 0xB8, 0x42, 0x1E, 0xCF, 0x7C, 0x95, 0x03, 0xA8, 0x0C,
+    0xC0, 0x06, 0x25, 0x40, 0xBA, 0x2A, 0x75, 0xA9, 0xD3, 0x6B, 0xAD, 0x2A, 0xD5, 0x66, 0xAB, 0x9E,
+    0x7A, 0xEE, 0xB3, 0x27, 0x5E, 0x5A, 0x69, 0x3A, 0x59, 0xEF, 0xC1, 0x5E, 0x52, 0x6B, 0xE1, 0x84,
+    0x53, 0xC2, 0xE5, 0xC5, 0xB0, 0x98, 0x2C, 0x17, 0xDF, 0xCD, 0xC9, 0xF4, 0x74, 0xA0, 0x27, 0x34,
+    0x83, 0xBD, 0x82, 0xD4, 0x25, 0x7A, 0xB0, 0x3C, 0x22, 0x82, 0x80, 0xDF, 0x12, 0x45, 0x81, 0x91,
+    0xA4, 0x6C, 0x23, 0xCD, 0xAC, 0xBC, 0xD6, 0xEB, 0xF1, 0x05, 0x76, 0x24, 0x3D, 0xA3, 0xDD, 0x13,
+    0x87, 0x41, 0x4F, 0x03, 0x89, 0x88, 0x3A, 0x8C, 0x25, 0xC0, 0xA3, 0x08, 0x1B, 0x72, 0x32, 0x48,
+    0xDD, 0xB5, 0x80, 0x43, 0x38, 0xA7, 0x2C, 0x7B, 0xD8, 0xBC, 0xB7, 0xCD, 0x8B, 0xEB, 0x1C, 0x18,
+    0xA1, 0xC2, 0x67, 0xB2, 0x89, 0xD8, 0x3A, 0x52, 0xF6, 0xFD, 0x2B, 0xEB, 0xC9, 0x2C, 0x26, 0xEE,
+    0xF5, 0x6F, 0x41, 0xD9, 0xC9, 0x3B, 0x7E, 0x63, 0x62, 0xA5, 0x8F, 0xFD, 0x60, 0x8E, 0xA0, 0xA8,
+    0x84, 0x49, 0x98, 0x2B, 0xFD, 0xCE, 0x3B, 0x32, 0x01, 0x36, 0xA1, 0xD3, 0x18, 0x4D, 0x12, 0x28,
+    0x3B, 0xFA, 0xB9, 0x07, 0x7E, 0xA5, 0xE5, 0xF8, 0x6D, 0xC0, 0x48, 0x4A, 0xF8, 0x79, 0x42, 0x40,
+    0xF6, 0xF9, 0x51, 0x71, 0x1F, 0xBC, 0x68, 0x44, 0xA0, 0xCA, 0x39, 0xE9, 0xA5, 0x41, 0xA3, 0x6A,
+    0x45, 0x81, 0x7F, 0x04, 0x9E, 0x47, 0x0F, 0x77, 0xC9, 0x5A, 0xE2, 0x3F, 0x84, 0x00, 0x75, 0x9F,
+    0x93, 0x3E, 0x49, 0xD1, 0x9A, 0x6F, 0x49, 0x33, 0x84, 0x19, 0x08, 0x1A, 0x2F, 0xFD, 0x0C, 0x3B,
+    0x75, 0xD2, 0x44, 0x4B, 0x05, 0xE7, 0xD6, 0xDC, 0xAB, 0xB7, 0x72, 0x92, 0xEF, 0x07, 0xF5, 0x2A,
+    0x2C, 0xF7, 0x60, 0x6C, 0x9E, 0xAE, 0x4F, 0x07, 0xA2, 0x23, 0x85, 0x6A, 0x45, 0x2D, 0xA1, 0x8F,
+    0x03, 0x75, 0xC0, 0x30, 0x2A, 0x1D, 0x29, 0xD9, 0x66, 0x54, 0xA2, 0xBD, 0xEE, 0x78, 0x39, 0x5B,
+    0x17, 0xDA, 0xBF, 0xAD, 0xE8, 0xF1, 0xC5, 0x7B, 0xB3, 0xB5, 0xA8, 0x87, 0xF2, 0x79, 0x2B, 0x5D,
+    0x62, 0x85, 0x59, 0xC4, 0x3E, 0x7A, 0xB0, 0x42, 0x98, 0xC4, 0x4A, 0x97, 0xB7, 0xCA, 0x2F, 0xE6,
+    0xC1, 0xCB, 0xB4, 0xBE, 0x75, 0xF3, 0xD6, 0xCD, 0xB4, 0x5E, 0xEC, 0x2D, 0x14, 0x47, 0xF9, 0xDF,
+    0x22, 0xE7, 0x01, 0x14, 0x72, 0x0C, 0xF2, 0x0F, 0xAF, 0xD7, 0x4E, 0xBC, 0x3C, 0x74, 0xEA, 0xAE,
+    0xE9, 0xF4, 0xA8, 0x09, 0xF9, 0x53, 0x44, 0x81, 0x4E, 0xF4, 0x1D, 0x7F, 0x63, 0xF7, 0x3E, 0xEC,
+    0xBE, 0x91, 0x0D, 0x18, 0x96, 0x80, 0xF1, 0x16, 0x68, 0x27, 0x8E, 0xCC, 0x6D, 0xC5, 0x9C, 0x97,
+    0x23, 0x57, 0xE1, 0x19, 0xE2, 0x9F, 0xD3, 0x50, 0x50, 0xCD, 0xA5, 0x59, 0x99, 0x0A, 0x6C, 0x34,
+    0xAE, 0x19, 0x78, 0x00, 0x29, 0x5A, 0x8D, 0x25, 0x4D, 0x4D, 0xEA, 0x1A, 0x7F, 0xA2, 0x9F, 0xD1,
+    0x41, 0xDF, 0x9D, 0x9F, 0x5B, 0x89, 0x05, 0xBE, 0xA4, 0x4B, 0x47, 0x3D, 0xD0, 0x61, 0x82, 0x98,
+    0xD9, 0x4E, 0x8B, 0xC6, 0xCB, 0x83, 0xD3, 0x4A, 0x60, 0xCB, 0xE3, 0x85, 0x81, 0x95, 0xE9, 0x36,
+    0xE2, 0x01, 0x92, 0xEE, 0x21, 0xAD, 0xC9, 0x94, 0x5A, 0x9B, 0x80, 0xF6, 0xE2, 0x24, 0xA6, 0x3E,
+    0xE8, 0xE2, 0xA5, 0xA5, 0x30, 0x34, 0x8E, 0x4E, 0x2B, 0x69, 0x7C, 0xFE, 0x55, 0xAD, 0x10, 0xAA,
+    0x36, 0x7D, 0xDD, 0x2A, 0x71, 0xD2, 0xA6, 0x07, 0x8D, 0x4E, 0xB1, 0x4D, 0x31, 0x8E, 0x0A, 0x4E,
+    0x53, 0x12, 0x45, 0x08, 0x99, 0xA1, 0x31, 0x4D, 0xD1, 0x1E, 0x04, 0x5C, 0x0B, 0x1D, 0x1B, 0x39,
+    0x02, 0xFA, 0xA4, 0x4B, 0xD0, 0x66, 0xA7, 0x7D, 0x1B, 0x6E, 0x41, 0x03, 0xAB, 0xEC, 0xEE, 0x37,
+    0x88, 0xF7, 0xCE, 0xCA, 0x55, 0x90, 0x05, 0xB7, 0xB0, 0xBE, 0xAE, 0xF0, 0xE7, 0xE9, 0x36, 0x15,
+    0x1E, 0x8F, 0x90, 0x2E, 0xF5, 0x74, 0xAA, 0xF1, 0xC5, 0xFA, 0x98, 0x8D, 0x1F, 0xC8, 0x27, 0x4D,
+    0x2E, 0xDC, 0x6D, 0x51, 0xAF, 0x0A, 0x4B, 0xCF, 0x9C, 0x39, 0x59, 0xEE, 0xF0, 0xFA, 0x4E, 0x62,
+    0x73, 0xD6, 0x90, 0x9A, 0x9A, 0xFB, 0x49, 0xFC, 0xEC, 0x48, 0x43, 0x86, 0xF5, 0x4E, 0x1C, 0x4C,
+    0x5F, 0xB7, 0x15, 0xFE, 0xEE, 0xF4, 0xAE, 0x78, 0x6D, 0xD5, 0xC5, 0x63, 0x83, 0x6F, 0x2F, 0x58,
+    0x10, 0x58, 0x01, 0x65, 0xB4, 0xAB, 0x7C, 0xAE, 0xB9, 0x34, 0x94, 0x71, 0x4F, 0x89, 0x39, 0x57,
+    0x96, 0x02, 0x47, 0xFA, 0xC3, 0xB1, 0x36, 0xD0, 0x60, 0x65, 0xB4, 0x53, 0xCA, 0x3A, 0x69, 0x59,
+    0x84, 0x7E, 0x85, 0xA8, 0xD0, 0x2D, 0x05, 0x40, 0xE4, 0x67, 0x81, 0xD1, 0x61, 0x52, 0x2F, 0x23,
+    0xA8, 0x06, 0x1E, 0xB5, 0xF1, 0xB6, 0xCA, 0xFD, 0x5F, 0x51, 0x62, 0x93, 0xF7, 0xA9, 0xFF, 0xBF,
+    0x17, 0xFA, 0x0A, 0xF9, 0x1B, 0x9D, 0x54, 0xBF, 0x6F, 0x15, 0x47, 0x10, 0x9E, 0x77, 0x47, 0xB8,
+    0xE2, 0x8A, 0xA5, 0x48, 0x8A, 0x04, 0x29, 0xD7, 0xA2, 0x44, 0x70, 0xFF, 0x00, 0x78, 0x0F, 0xA7,
+    0x70, 0xF1, 0x0A, 0xBB, 0xB0, 0xD3, 0x50, 0xB8, 0x45, 0x24, 0x8A, 0x5B, 0x0A, 0x60, 0x0F, 0x53,
+    0x50, 0xA4, 0x88, 0xA5, 0x24, 0x34, 0x14, 0xA1, 0x48, 0x41, 0x1E, 0x85, 0x1B, 0x8A, 0x14, 0x7E,
+    0xDE, 0x03, 0xA4, 0xA4, 0xA0, 0xB9, 0xD8, 0xA2, 0x09, 0x85, 0x8F, 0x18, 0x24, 0x44, 0x0A, 0x36,
+    0xF6, 0xC6, 0x5E, 0xEC, 0xDB, 0x9B, 0x7C, 0x7B, 0xC6, 0x09, 0x14, 0x34, 0xD9, 0xF7, 0x66, 0xB5,
+    0x37, 0xB3, 0xF3, 0x63, 0x67, 0xBE, 0x99, 0x68, 0x89, 0x2C, 0x9D, 0x19, 0xCC, 0x7F, 0xC7, 0x7C,
+    0x61, 0xAF, 0x3C, 0x43, 0xA2, 0x88, 0x6A, 0x9A, 0x9B, 0x93, 0xFC, 0xFB, 0xE8, 0x16, 0x91, 0xE4,
+    0x0D, 0xB6, 0x44, 0xA3, 0x91, 0xE2, 0x47, 0x73, 0x33, 0x83, 0x99, 0xCB, 0xE2, 0x9E, 0xCD, 0x63,
+    0x33, 0x11, 0x37, 0x67, 0xE2, 0x1A, 0x7B, 0x3E, 0x30, 0xA2, 0x5C, 0x89, 0x9A, 0xD9, 0xA4, 0xCE,
+    0x07, 0x16, 0xC7, 0xB4, 0xBA, 0x94, 0x84, 0xFF, 0x8A, 0xA8, 0x70, 0xB1, 0x59, 0xA1, 0xA3, 0x5C,
+    0xB0, 0x7F, 0x2F, 0x36, 0x24, 0x53, 0xDE, 0x7E, 0xA5, 0x64, 0xBC, 0x6D, 0x94, 0x64, 0xA3, 0xA7,
+    0x07, 0x5D, 0x21, 0x79, 0xD2, 0xE5, 0xA2, 0xBA, 0x2C, 0xD9, 0x76, 0xA3, 0x6F, 0x0D, 0xA5, 0xCD,
+    0x11, 0xC1, 0x26, 0xE9, 0x8A, 0x5E, 0xB6, 0xE8, 0xE4, 0x74, 0x25, 0x25, 0xB5, 0x2D, 0x74, 0xC4,
+    0xC3, 0x66, 0x2C, 0xB8, 0x49, 0x3C, 0x5D, 0x89, 0xAC, 0xCF, 0xAA, 0xB6, 0x1D, 0x70, 0x1D, 0x75,
+    0x24, 0x1C, 0x69, 0x9B, 0x6C, 0x1B, 0x19, 0xFF, 0x65, 0x93, 0x3A, 0xED, 0x48, 0xF3, 0xA0, 0x50,
+    0x44, 0xE3, 0x4F, 0xEE, 0x58, 0xE6, 0xF5, 0x06, 0xE6, 0x5B, 0xC1, 0x75, 0xEA, 0xE8, 0x3C, 0xA5,
+    0x35, 0x8D, 0xFB, 0x4D, 0x0F, 0xD9, 0xEB, 0xE1, 0x7E, 0x23, 0xC7, 0xF1, 0x7E, 0x7D, 0xB8, 0xED,
+    0x56, 0xF9, 0x79, 0x8A, 0x6C, 0xB8, 0x90, 0x17, 0x34, 0x8E, 0xFE, 0xB0, 0x72, 0xB8, 0x6E, 0x73,
+    0x55, 0x68, 0x17, 0xB1, 0x4D, 0x37, 0x4D, 0x3E, 0x65, 0xC6, 0xE9, 0x13, 0x9B, 0xD6, 0xE7, 0xC7,
+    0x6F, 0xAC, 0x4B, 0x17, 0xF5, 0x94, 0xCB, 0x99, 0xF9, 0x6B, 0xAB, 0xAF, 0x6F, 0x59, 0x44, 0x36,
+    0x46, 0x5A, 0xF2, 0xC2, 0xA5, 0x0F, 0xEB, 0x89, 0x68, 0x2B, 0xE4, 0x24, 0x30, 0x32, 0x72, 0x69,
+    0x75, 0xF1, 0x5D, 0x8E, 0x2F, 0xAE, 0x46, 0xCC, 0xA9, 0x5D, 0xCD, 0x0B, 0x68, 0x43, 0xE7, 0x61,
+    0x2D, 0xF3, 0x35, 0xA7, 0xF9, 0xFE, 0x8E, 0x7B, 0x1D, 0x4E, 0x88, 0x8C, 0x92, 0x4E, 0xE0, 0x49,
+    0xC7, 0x3A, 0xCA, 0x5A, 0xD2, 0x75, 0xE4, 0x96, 0x26, 0x24, 0x0F, 0xBB, 0x22, 0x29, 0xD2, 0x32,
+    0xF3, 0xBA, 0xCB, 0x4A, 0x71, 0xF8, 0xAB, 0x44, 0x17, 0x79, 0x0A, 0x2B, 0xEF, 0x0A, 0x54, 0xB1,
+    0x01, 0x59, 0xCA, 0x5F, 0x7D, 0x49, 0x02, 0x76, 0xE2, 0x96, 0x68, 0xC0, 0x47, 0x47, 0xB7, 0xD5,
+    0x22, 0x73, 0xD6, 0x68, 0xFE, 0xB5, 0xCD, 0xD9, 0x20, 0x00, 0x92, 0x3B, 0x9E, 0x12, 0x3C, 0xA6,
+    0x54, 0xCC, 0x0D, 0x62, 0x72, 0x84, 0x1C, 0x13, 0xE9, 0x02, 0x86, 0x9E, 0xCD, 0x50, 0xCA, 0x2D,
+    0x81, 0x0B, 0x06, 0x57, 0xBD, 0x75, 0x1A, 0x3C, 0x31, 0x44, 0x27, 0x4F, 0x41, 0xDC, 0xFB, 0xE0,
+    0x4A, 0x40, 0x29, 0xC6, 0x2B, 0x0B, 0xFD, 0xE7, 0x70, 0x49, 0x38, 0x73, 0x37, 0x62, 0x21, 0x48,
+    0x3E, 0x31, 0x26, 0xF6, 0xA7, 0x3E, 0x26, 0xB9, 0xB6, 0xD6, 0xC4, 0xFE, 0xF4, 0x49, 0x92, 0x9B,
+    0x0F, 0xAA, 0x88, 0x2F, 0x9D, 0xA6, 0x8C, 0xAF, 0x97, 0xC4, 0xF6, 0x67, 0x18, 0xFF, 0xE1, 0x66,
+    0x30, 0x61, 0x60, 0x9D, 0x83, 0x9B, 0x86, 0x4E, 0x7E, 0x55, 0x50, 0xFC, 0xA0, 0x26, 0x3A, 0x71,
+    0xE2, 0xC0, 0x1D, 0x1D, 0x07, 0x97, 0xB9, 0x8D, 0xE1, 0x45, 0xF0, 0x0D, 0x93, 0x3B, 0x3A, 0x26,
+    0x1B, 0x22, 0x85, 0x70, 0x34, 0x88, 0xAF, 0xDE, 0x5A, 0xE1, 0xC9, 0xDD, 0x96, 0x27, 0xD9, 0x81,
+    0x9E, 0xF2, 0x22, 0x93, 0x5E, 0xF4, 0xA4, 0xEF, 0x7B, 0x52, 0x6B, 0x9E, 0xE4, 0x96, 0x87, 0xC3,
+    0xEE, 0x2E, 0xA2, 0xB4, 0xB0, 0x61, 0x49, 0xC1, 0x1E, 0xCD, 0x84, 0x37, 0xB7, 0x6F, 0x11, 0x32,
+    0xF4, 0x16, 0xF9, 0xB9, 0x59, 0xF0, 0xDD, 0xBF, 0xF4, 0x9A, 0x7F, 0xDC, 0xCF, 0x22, 0x5A, 0xDF,
+    0x53, 0x38, 0xBF, 0xA9, 0xD3, 0xAF, 0x8C, 0x97, 0x20, 0xB4, 0x03, 0x3C, 0x2B, 0xE6, 0x9B, 0x78,
+    0xFA, 0x7F, 0xF2, 0x2F, 0xBA, 0x11, 0x9E, 0xC2, 0x3D, 0x85, 0xEF, 0x73, 0x7E, 0xEE, 0xAD, 0x6F,
+    0x60, 0x96, 0x32, 0x64, 0x57, 0xBF, 0x18, 0xDD, 0x06, 0xAF, 0x3D, 0xA4, 0x60, 0x76, 0xA6, 0x37,
+    0x7E, 0xE0, 0xE4, 0xCA, 0x41, 0x9D, 0x0B, 0xEA, 0x52, 0x9E, 0x66, 0x23, 0x37, 0x70, 0x09, 0x87,
+    0xB0, 0xB6, 0xF9, 0x11, 0xFB, 0xF9, 0x96, 0xEB, 0x0C, 0xED, 0xA2, 0x10, 0x01, 0xC9, 0x0D, 0x47,
+    0x5C, 0x8A, 0xDD, 0x8E, 0x64, 0x1D, 0x7B, 0x9C, 0x2C, 0xB1, 0x0A, 0x6D, 0x05, 0x41, 0xCC, 0x05,
+    0x04, 0xE8, 0xAB, 0x20, 0xE0, 0x5E, 0xA0, 0x7A, 0x41, 0xDE, 0x0B, 0x84, 0x86, 0x20, 0xB4, 0x07,
+    0x16, 0xFA, 0x19, 0x2B, 0x60, 0xF2, 0x70, 0x09, 0x37, 0x80, 0x01, 0x5A, 0x25, 0xAE, 0xF3, 0x52,
+    0xBA, 0xB4, 0x11, 0x1C, 0xB9, 0x78, 0xBF, 0x5A, 0x25, 0xEF, 0xF2, 0xAB, 0x5A, 0x2F, 0x03, 0xCE,
+    0xCC, 0xE7, 0xF6, 0x3A, 0x2E, 0xDB, 0x89, 0xEC, 0xAA, 0x9A, 0x7F, 0x6C, 0x03, 0x63, 0x01, 0x54,
+    0xB7, 0x62, 0xA3, 0x94, 0xD1, 0x7E, 0x23, 0x2A, 0xE5, 0x62, 0x23, 0x3A, 0x6A, 0x23, 0x2E, 0x25,
+    0x29, 0x30, 0x42, 0x7F, 0x77, 0x25, 0x1C, 0x06, 0x5C, 0x90, 0xE8, 0x77, 0x19, 0xA0, 0x41, 0x98,
+    0x2B, 0x15, 0x21, 0x20, 0x2E, 0x66, 0x84, 0x8D, 0x7D, 0x5A, 0xC9, 0x5A, 0x58, 0x89, 0x4F, 0x75,
+    0xAF, 0x8D, 0x7D, 0xC2, 0xA1, 0x27, 0x79, 0xB7, 0x4F, 0xC3, 0x37, 0xDC, 0x85, 0x7A, 0x03, 0x35,
+    0x3F, 0x92, 0x30, 0xA1, 0x03, 0x24, 0x6E, 0xC3, 0x04, 0x6E, 0xA3, 0x19, 0x42, 0x51, 0x84, 0x0D,
+    0x6C, 0xE8, 0x80, 0x0D, 0xEC, 0x03, 0xEF, 0xCA, 0x85, 0x67, 0x1D, 0x81, 0x7B, 0x7C, 0x50, 0xC0,
+    0x4A, 0xD8, 0x7D, 0xBF, 0x73, 0xD8, 0x27, 0xFB, 0xBD, 0xE0, 0xB3, 0x80, 0x5A, 0xC1, 0x53, 0xEC,
+    0xB1, 0x0B, 0x94, 0xE8, 0x2C, 0x0B, 0x73, 0x82, 0xEF, 0x74, 0x59, 0x40, 0xAA, 0xC3, 0x03, 0x10,
+    0xAE, 0x80, 0x8C, 0x9B, 0x98, 0x1B, 0x9E, 0x06, 0xBC, 0x5B, 0x9E, 0x76, 0x94, 0x75, 0x3C, 0xD5,
+    0x77, 0xD3, 0x67, 0x3E, 0x98, 0x9C, 0xE4, 0x0F, 0x07, 0x1D, 0x6E, 0xCD, 0x07, 0x3B, 0x7A, 0x03,
+    0x76, 0x0A, 0xF9, 0x38, 0xBC, 0x93, 0xE8, 0x7D, 0x52, 0x24, 0xCB, 0xEC, 0x9A, 0x49, 0xDA, 0xC8,
+    0xC9, 0x42, 0x57, 0xF2, 0x9A, 0x4D, 0xDB, 0xD8, 0xCA, 0x92, 0x6B, 0x19, 0x39, 0xB1, 0x9A, 0x98,
+    0xAC, 0xDA, 0x6D, 0xD4, 0xA0, 0xCD, 0x14, 0xF2, 0x7E, 0x6F, 0xCB, 0xAC, 0x1E, 0xED, 0x90, 0xF1,
+    0xE7, 0x21, 0xC1, 0xFC, 0x0B, 0xEB, 0xE5, 0x97, 0xCF, 0x93, 0xCD, 0xC6, 0xB5, 0xA4, 0x2E, 0x8B,
+    0x8D, 0x2A, 0xDE, 0xAD, 0xBD, 0x23, 0xB9, 0x92, 0xBE, 0x2C, 0x62, 0xAE, 0x94, 0xA1, 0x1C, 0x90,
+    0xC7, 0x3C, 0x28, 0xA5, 0xA1, 0xCC, 0xC6, 0x5D, 0x78, 0x54, 0xDE, 0x20, 0x0B, 0x7B, 0x94, 0xEC,
+    0x84, 0x59, 0x90, 0x3D, 0xC6, 0x5E, 0xA9, 0x85, 0x67, 0x9F, 0xF3, 0x59, 0x34, 0xF6, 0x80, 0x93,
+    0x1D, 0xFF, 0xD1, 0xB5, 0x36, 0x43, 0x05, 0x87, 0x46, 0x2D, 0xAC, 0xF9, 0xFC, 0x37, 0x4C, 0x35,
+    0xAB, 0xA7, 0x76, 0x7C, 0xBE, 0xE6, 0x7B, 0xB6, 0x7D, 0x07, 0x5B, 0x83, 0x0D, 0x55, 0x9C, 0x28,
+    0xDB, 0xF2, 0x79, 0x1D, 0xF1, 0x30, 0xC0, 0xA0, 0xCD, 0xD7, 0x82, 0x0B, 0x8C, 0x47, 0x7E, 0x7A,
+    0x08, 0xA8, 0x50, 0xA0, 0x50, 0x19, 0x85, 0x9C, 0xA7, 0xA1, 0xE2, 0x9A, 0xBB, 0x03, 0x4E, 0x21,
+    0xA1, 0xB7, 0x89, 0xCA, 0xB3, 0xAE, 0x51, 0x31, 0x1F, 0xF3, 0x0D, 0xAE, 0x95, 0x49, 0x7D, 0x80,
+    0x71, 0xAD, 0x2B, 0x80, 0xA1, 0x0D, 0x07, 0xC0, 0xB5, 0xE7, 0x28, 0x93, 0xE0, 0xCE, 0xF7, 0xDC,
+    0x5F, 0x86, 0x96, 0x82, 0xFA, 0xFD, 0x60, 0xE7, 0xB5, 0xA7, 0x0F, 0xE6, 0xE6, 0x82, 0x07, 0x4B,
+    0x17, 0x46, 0x23, 0xF0, 0xB4, 0x0B, 0x55, 0xA9, 0x03, 0xE2, 0x22, 0x7E, 0x81, 0x36, 0x28, 0x8F,
+    0xF4, 0xB3, 0x25, 0x04, 0xB4, 0xBC, 0xF7, 0xD3, 0xE1, 0x94, 0x33, 0xFD, 0xD0, 0x59, 0xF8, 0x7B,
+    0x36, 0x30, 0x02, 0x32, 0xAB, 0xFE, 0x06, 0xEA, 0x8D, 0x5C, 0xC2, 0x8C, 0xEC, 0xCE, 0x95, 0x31,
+    0xF7, 0x53, 0xD1, 0x81, 0xE3, 0xFB, 0xAE, 0x0D, 0xED, 0x86, 0x7A, 0xEB, 0x0A, 0xD5, 0x05, 0x04,
+    0x65, 0x23, 0x6C, 0x86, 0xC1, 0x18, 0xD8, 0x43, 0xD4, 0x64, 0xBD, 0x25, 0x81, 0x09, 0xFC, 0x29,
+    0xF3, 0x28, 0x34, 0xF0, 0x3A, 0xC8, 0x8A, 0x8E, 0x29, 0xEE, 0x60, 0x3A, 0xC0, 0x45, 0xD6, 0xA1,
+    0x65, 0x83, 0x0A, 0xEA, 0x04, 0xA8, 0xD7, 0x00, 0x7D, 0x2B, 0x6C, 0xEF, 0xF0, 0xFF, 0xAD, 0x7F,
+    0x00, 0x95, 0x55, 0xBF, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBB, 0x53, 0x7C, 0x12, 0x87, 0xB4, 0x29,
+    0x5C, 0x20, 0x02, 0x5C, 0x4B, 0xE5, 0x6B, 0x29, 0xD0, 0xBB, 0x43, 0xEF, 0x0F, 0x00, 0x24, 0x42,
+    0x8A, 0x14, 0x16, 0x1D, 0xA2, 0x71, 0x43, 0x19, 0xB1, 0x27, 0x5C, 0x20, 0x2A, 0x2C, 0xA1, 0x28,
+    0x6D, 0x6A, 0xBB, 0x70, 0x43, 0x91, 0x22, 0xF1, 0x9D, 0xE5, 0xC2, 0x85, 0x9B, 0x8B, 0x22, 0x48,
+    0x41, 0xC1, 0xC5, 0xD8, 0x0A, 0xB2, 0x8B, 0xB7, 0x0E, 0xCF, 0xE4, 0xB0, 0x77, 0x77, 0xF8, 0x66,
+    0xDF, 0x33, 0xB6, 0x40, 0x80, 0xB8, 0xA7, 0x99, 0x7D, 0xB7, 0x3F, 0x66, 0x76, 0xBE, 0xF9, 0x66,
+    0x4E, 0x33, 0x73, 0x0E, 0xD9, 0x85, 0x9C, 0x40, 0x2C, 0xA9, 0x81, 0x28, 0xF1, 0x6F, 0x13, 0x31,
+    0x13, 0x95, 0x10, 0xE5, 0x65, 0x02, 0xC2, 0x5F, 0x53, 0xC6, 0x93, 0x36, 0x9D, 0x70, 0x47, 0xDF,
+    0x72, 0x8B, 0x1D, 0x35, 0x51, 0xD3, 0x53, 0xC4, 0x03, 0x04, 0x3B, 0xDE, 0x91, 0x89, 0xB2, 0xA7,
+    0x60, 0x63, 0xFE, 0xC4, 0xCC, 0x15, 0x86, 0x94, 0x65, 0x83, 0x18, 0x65, 0x83, 0x21, 0xBF, 0xDB,
+    0xF8, 0xD9, 0x3A, 0x6C, 0x61, 0xBF, 0x09, 0x27, 0x12, 0x1B, 0xC1, 0x1F, 0x6C, 0x51, 0x09, 0xEB,
+    0xD4, 0xD4, 0x6A, 0x8A, 0xA1, 0xEC, 0x12, 0x17, 0xF6, 0x90, 0x2C, 0xA6, 0x96, 0x74, 0xBB, 0x72,
+    0x10, 0x79, 0x2A, 0x4C, 0xC3, 0x15, 0xF6, 0x0C, 0x7A, 0x62, 0xCA, 0x2E, 0xB3, 0x65, 0xED, 0x94,
+    0x49, 0x7D, 0xDE, 0x96, 0x5F, 0xD9, 0x8C, 0x33, 0xA3, 0xF6, 0x79, 0x93, 0xC7, 0x36, 0x99, 0xC2,
+    0x67, 0xC5, 0xF7, 0x6C, 0x89, 0x1B, 0x68, 0x76, 0x8A, 0x0F, 0xA8, 0x98, 0x58, 0xF1, 0x9D, 0x99,
+    0x0F, 0x64, 0x48, 0xE6, 0xB7, 0x9D, 0xDF, 0x48, 0x57, 0x61, 0x28, 0xDA, 0x30, 0x28, 0x43, 0x57,
+    0xF7, 0xC8, 0x02, 0xFE, 0x6A, 0x84, 0x5F, 0x22, 0xEC, 0xFC, 0x94, 0x09, 0x9E, 0xDB, 0xD8, 0x67,
+    0x86, 0x9A, 0x1D, 0x4B, 0xB9, 0x61, 0x4A, 0x1C, 0x4C, 0x34, 0x93, 0x96, 0x14, 0xF7, 0x88, 0x1F,
+    0x06, 0xCA, 0x29, 0xBD, 0x9A, 0x59, 0x4A, 0xBF, 0xE4, 0x3A, 0x39, 0x61, 0x13, 0x7B, 0x5C, 0x85,
+    0x7D, 0xD3, 0x6E, 0xB1, 0x9A, 0x96, 0xC5, 0xD8, 0x17, 0xE3, 0x5A, 0xB7, 0x54, 0x89, 0xAF, 0x44,
+    0x6E, 0x86, 0x40, 0xAF, 0xC1, 0x43, 0xCA, 0x02, 0xAE, 0x09, 0x98, 0x2A, 0xFE, 0x05, 0x19, 0xC0,
+    0x04, 0xA2, 0xA1, 0xF2, 0x7B, 0xEE, 0xF2, 0xD3, 0x65, 0x57, 0xE2, 0xE5, 0x18, 0x32, 0x2D, 0x5B,
+    0x65, 0x96, 0x4F, 0x6F, 0xCD, 0x27, 0x8E, 0xF8, 0xA0, 0x6C, 0x75, 0xA7, 0x80, 0x75, 0x22, 0x78,
+    0xCB, 0xB1, 0xF2, 0x70, 0x16, 0xCB, 0x85, 0xFD, 0x00, 0xF1, 0x3C, 0xB8, 0x10, 0xA0, 0x91, 0x5C,
+    0xF9, 0x2A, 0x96, 0x44, 0xC1, 0x4A, 0x5B, 0xF2, 0xB9, 0x55, 0xFC, 0x45, 0xF4, 0x1E, 0xEF, 0xF4,
+    0xC0, 0x7A, 0x04, 0xEF, 0x09, 0xCC, 0x74, 0x23, 0x4A, 0x5D, 0x72, 0xB6, 0xAE, 0xBB, 0x92, 0x5F,
+    0x3A, 0x98, 0x2F, 0xF1, 0xE7, 0x57, 0x9F, 0xEC, 0x73, 0x69, 0x46, 0xC5, 0x0B, 0x1E, 0xEF, 0xB3,
+    0x72, 0x23, 0xC9, 0xCD, 0x39, 0x27, 0x92, 0xED, 0x4C, 0x2E, 0x7C, 0x03, 0x96, 0x83, 0x0B, 0x1A,
+    0x49, 0x82, 0x2B, 0x61, 0x93, 0xD0, 0x40, 0x12, 0xDB, 0x08, 0xE1, 0x24, 0xCA, 0x5C, 0xB8, 0xC0,
+    0xBA, 0xC6, 0x1D, 0xB1, 0x98, 0xEF, 0x3B, 0x6A, 0x70, 0xF6, 0x0C, 0xC2, 0x7D, 0xD1, 0x17, 0x1D,
+    0x71, 0xA5, 0xEB, 0x3F, 0xA7, 0x0E, 0xF9, 0xEE, 0x6D, 0x37, 0x06, 0x5F, 0x4D, 0x6E, 0x70, 0x2D,
+    0x50, 0x4F, 0xF0, 0x27, 0xC6, 0x5B, 0xE2, 0xF0, 0x96, 0x85, 0x14, 0xD3, 0x0A, 0xFE, 0x32, 0x3B,
+    0x2A, 0x98, 0xBB, 0xF4, 0xAC, 0xB1, 0xB4, 0x16, 0x5F, 0x44, 0x9F, 0x9B, 0xCF, 0xD6, 0x37, 0x3D,
+    0x16, 0xF8, 0x87, 0x0D, 0xF6, 0xF7, 0x13, 0xEC, 0xBA, 0xC5, 0xEE, 0xA6, 0x4C, 0xFC, 0x28, 0xA0,
+    0xEA, 0xB0, 0x27, 0x50, 0x2E, 0x26, 0x3E, 0x5C, 0x69, 0x8B, 0x19, 0xA0, 0xC8, 0x32, 0x52, 0x4F,
+    0xD7, 0x2E, 0xA0, 0x53, 0xB5, 0x10, 0xA2, 0x8A, 0xE0, 0x06, 0xC2, 0x22, 0x35, 0xFF, 0xDC, 0xAF,
+    0xE9, 0x7E, 0x08, 0xC0, 0xA9, 0x41, 0xD5, 0x89, 0x4B, 0xFA, 0x88, 0xAB, 0x81, 0x34, 0x00, 0xCC,
+    0xA7, 0xB3, 0x09, 0x14, 0xD0, 0x40, 0x80, 0x8D, 0x32, 0x07, 0x1B, 0xFC, 0xA4, 0xBF, 0x5E, 0x78,
+    0x6F, 0x05, 0x35, 0xB9, 0x6E, 0x0B, 0x43, 0x6B, 0x44, 0x76, 0x0E, 0x9A, 0xB8, 0x5B, 0x24, 0x10,
+    0xD6, 0x46, 0x28, 0x37, 0x1B, 0x0F, 0x14, 0x5B, 0xB0, 0x52, 0xE0, 0xB5, 0x92, 0x76, 0xAB, 0x45,
+    0xDD, 0x70, 0xCB, 0xEE, 0xA3, 0xD4, 0x66, 0x03, 0xFD, 0xA7, 0x02, 0x1F, 0x6D, 0xEA, 0x17, 0x53,
+    0x38, 0x74, 0xA9, 0x8D, 0x45, 0x51, 0x23, 0xDE, 0xA2, 0xCB, 0xDA, 0xFD, 0x3D, 0x54, 0xAE, 0x11,
+    0xE6, 0x0D, 0x50, 0xC7, 0x02, 0x70, 0xBD, 0x30, 0x83, 0x8F, 0x42, 0x75, 0x26, 0xA1, 0xBC, 0x9B,
+    0x50, 0xA1, 0x2C, 0x13, 0x8D, 0x34, 0x81, 0x94, 0xC5, 0x50, 0x2E, 0x7F, 0x49, 0x9B, 0x4F, 0x97,
+    0xB2, 0x55, 0xB9, 0xA3, 0x6D, 0xDE, 0xB0, 0x23, 0x55, 0xEC, 0x78, 0x35, 0xFE, 0xA9, 0xD7, 0x4F,
+    0xBA, 0x80, 0x26, 0x0E, 0x6D, 0x09, 0x41, 0x97, 0xD4, 0xBD, 0x96, 0xB2, 0xD5, 0x0E, 0x80, 0x57,
+    0xD7, 0x17, 0x05, 0xD1, 0xBF, 0x76, 0xA6, 0xF9, 0x93, 0x5E, 0x4C, 0xC8, 0x8E, 0xD7, 0x37, 0x78,
+    0xBD, 0xA6, 0xAB, 0x7D, 0x47, 0x5A, 0xD5, 0xBF, 0x4F, 0xE0, 0x26, 0x06, 0x47, 0xB7, 0x6F, 0xF3,
+    0x4D, 0x92, 0xD6, 0x02, 0x38, 0xF0, 0xBA, 0x23, 0xB0, 0x0B, 0x37, 0xF2, 0x29, 0x7D, 0xCC, 0x6D,
+    0x22, 0xAD, 0x10, 0xB1, 0x15, 0xB3, 0xF2, 0xA3, 0x46, 0xFA, 0x5D, 0x8B, 0x72, 0xAC, 0x02, 0x75,
+    0x53, 0x18, 0xCD, 0x70, 0x56, 0xD9, 0x50, 0x51, 0x33, 0x59, 0x80, 0xAF, 0x06, 0xCB, 0x1E, 0x7C,
+    0x07, 0x5B, 0x5D, 0x04, 0x59, 0xA1, 0x31, 0xEC, 0xA6, 0x88, 0x52, 0x3A, 0x1E, 0x8C, 0xF2, 0x73,
+    0x08, 0x3A, 0x9D, 0x4F, 0x6C, 0xEC, 0x12, 0x2B, 0x3F, 0x35, 0xE0, 0x9C, 0x60, 0xD1, 0x41, 0xAA,
+    0x44, 0x60, 0x5C, 0xBC, 0x88, 0x36, 0x0B, 0x8D, 0x67, 0xA4, 0x45, 0x7F, 0xAE, 0x04, 0xEB, 0xEF,
+    0x84, 0x6F, 0xF4, 0x48, 0x49, 0x0A, 0x04, 0x02, 0xAE, 0xCA, 0x50, 0x22, 0x4A, 0xF4, 0x34, 0xDA,
+    0x3C, 0x5A, 0xDF, 0xC0, 0xD5, 0xB1, 0xFA, 0x90, 0xD4, 0x76, 0x5B, 0xBF, 0x4B, 0x6A, 0xEF, 0x65,
+    0x0F, 0x0D, 0x7A, 0x62, 0x66, 0xD0, 0xDA, 0x90, 0xEA, 0x5F, 0x7B, 0xA5, 0x06, 0xF3, 0xC4, 0xE8,
+    0x79, 0x00, 0xF6, 0x13, 0x3E, 0x7A, 0x18, 0x92, 0x27, 0x6F, 0x45, 0xD0, 0x0B, 0x7C, 0xD9, 0xF3,
+    0x54, 0x7F, 0xD9, 0x0B, 0xFF, 0xAE, 0xA5, 0x48, 0x10, 0x32, 0x92, 0x28, 0x40, 0x7A, 0x61, 0x0B,
+    0xE8, 0xAB, 0x78, 0xF3, 0x37, 0xEE, 0xC1, 0x75, 0x53, 0xA0, 0x3F, 0xA3, 0xC5, 0x87, 0x2E, 0x95,
+    0x0D, 0x1A, 0x3A, 0xB5, 0xBA, 0x56, 0x26, 0xB1, 0xCD, 0x5C, 0x0B, 0x7A, 0xFF, 0xA4, 0x53, 0xF4,
+    0x8E, 0x88, 0x43, 0xF3, 0x66, 0x03, 0x46, 0x80, 0xA7, 0x11, 0x6F, 0xA3, 0x44, 0x8C, 0x6E, 0x53,
+    0x9B, 0x9B, 0x98, 0x85, 0xBD, 0x9B, 0x70, 0xB9, 0x07, 0xD9, 0x87, 0x74, 0x0D, 0x9F, 0x55, 0xE1,
+    0x53, 0x82, 0x12, 0x8E, 0x85, 0x61, 0x0D, 0x8E, 0x17, 0xF2, 0x25, 0xBA, 0x52, 0xD3, 0xF2, 0x7C,
+    0x28, 0x1F, 0x80, 0x3B, 0x0F, 0x24, 0xE6, 0xAD, 0x10, 0xFE, 0x10, 0x42, 0x40, 0xF2, 0x3C, 0xBA,
+    0x01, 0x4F, 0x0A, 0x6E, 0xF5, 0xD3, 0xBD, 0x6F, 0xA6, 0xE5, 0xC9, 0x0B, 0xF4, 0xB5, 0xE9, 0x9D,
+    0x07, 0x7A, 0xD7, 0xE5, 0x4B, 0xEA, 0x94, 0xD3, 0xBD, 0x55, 0xA7, 0xB7, 0x9F, 0x75, 0xFC, 0x7E,
+    0x28, 0x02, 0xA1, 0x3F, 0xC9, 0x75, 0x67, 0x58, 0x84, 0x16, 0x43, 0xC5, 0x34, 0xB0, 0xF5, 0x68,
+    0xFD, 0xBE, 0xA4, 0xC6, 0x05, 0x54, 0x2A, 0x51, 0x5D, 0xF4, 0xB8, 0xA3, 0xB7, 0xDE, 0xA4, 0xE8,
+    0x59, 0x97, 0xCE, 0x3E, 0x4A, 0xA9, 0xB4, 0x1B, 0x70, 0xDD, 0x2A, 0xAB, 0x5B, 0xBD, 0x6B, 0x81,
+    0x4F, 0xDB, 0xEC, 0xFA, 0x66, 0xD0, 0xEC, 0xB1, 0xD6, 0x87, 0xB5, 0xCC, 0xE9, 0xB6, 0x7C, 0x6E,
+    0x13, 0x1F, 0x86, 0xD4, 0xEB, 0x63, 0x7E, 0x8A, 0xBA, 0x9C, 0x6D, 0xA9, 0x60, 0x2C, 0xD8, 0x7C,
+    0xDC, 0xD1, 0xFF, 0x78, 0xFE, 0x00, 0x3D, 0x8F, 0xB1, 0x0D, 0xC2, 0x30, 0x10, 0x45, 0xBF, 0x08,
+    0xC2, 0x45, 0x0A, 0x37, 0xF4, 0x8C, 0x90, 0x11, 0xC2, 0x10, 0x50, 0x31, 0x04, 0x23, 0x24, 0x0D,
+    0x30, 0x01, 0x3B, 0x20, 0x26, 0xA0, 0x4B, 0x7A, 0x1A, 0x77, 0x69, 0xD3, 0x22, 0x1A, 0x0A, 0x0B,
+    0xA5, 0x08, 0x7C, 0xBE, 0x2F, 0x12, 0x96, 0xCE, 0xEF, 0x9E, 0xFC, 0x4F, 0xF2, 0x01, 0x40, 0xCE,
+    0x98, 0x91, 0x2D, 0x19, 0xCB, 0xCF, 0x2E, 0xFB, 0x02, 0x4D, 0x8B, 0x7C, 0x04, 0x58, 0xC3, 0x0F,
+    0x7F, 0xAB, 0x7A, 0x64, 0x3C, 0xDF, 0x56, 0x64, 0x5D, 0x71, 0x40, 0xA3, 0xDC, 0x52, 0xC3, 0x58,
+    0x5C, 0xAF, 0x97, 0x86, 0xBC, 0x93, 0x63, 0x52, 0xB5, 0x6F, 0x92, 0x4F, 0xD5, 0x61, 0xBB, 0xDD,
+    0xE0, 0x7F, 0x82, 0xDD, 0x7E, 0x02, 0x0D, 0x7E, 0x02, 0x0D, 0xFE, 0xB1, 0x4F, 0x88, 0x16, 0xF1,
+    0xAD, 0x81, 0xC7, 0xBE, 0x08, 0x8A, 0xB1, 0xAD, 0x82, 0x62, 0x9C, 0x31, 0x48, 0xA2, 0xE6, 0x24,
+    0xEB, 0x86, 0x9D, 0x24, 0x27, 0x4F, 0xFA, 0x13, 0x39, 0x38, 0x7E, 0x9D, 0x3A, 0xC7, 0xA1, 0xD0,
+    0x07, 0xD5, 0x4A, 0x0C, 0x5A, 0xC2, 0x7D, 0x9C, 0x04, 0xEE, 0x95, 0x36, 0x82, 0x0B, 0x65, 0x9D,
+    0xD0, 0x25, 0x81, 0xBD, 0x08, 0x26, 0x70, 0x26, 0x98, 0xAB, 0x7E,
+};
+
+static const uint32_t notosans_14_boldBlockOffsets[36] = {
+    0, 1174, 2175, 3188, 4388, 5362, 6136, 7031,
+    7969, 8738, 9429, 10184, 10953, 11714, 12573, 13761,
+    14862, 15892, 16855, 17870, 18892, 20070, 21187, 22064,
+    23075, 23951, 24849, 25875, 26948, 27969, 29051, 30080,
+    30997, 32273, 33430, 33611,
+};
+
+static const uint16_t notosans_14_boldDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_14_boldGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_14_boldPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 0,
 };
 
 static const EpdGlyph notosans_14_boldGlyphs[] = {
@@ -4337,849 +2297,849 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 15, 10, 17, 1, 15, 38, 1833 }, // =
     { 15, 17, 17, 1, 19, 64, 1871 }, // >
     { 14, 23, 14, 0, 22, 81, 1935 }, // ?
-    { 24, 24, 26, 1, 21, 144, 2016 }, // @
-    { 21, 21, 20, 0, 21, 111, 2160 }, // A
-    { 16, 21, 19, 2, 21, 84, 2271 }, // B
-    { 17, 23, 19, 1, 22, 98, 2355 }, // C
-    { 18, 21, 21, 2, 21, 95, 2453 }, // D
-    { 13, 21, 16, 2, 21, 69, 2548 }, // E
-    { 13, 21, 16, 2, 21, 69, 2617 }, // F
-    { 18, 23, 21, 1, 22, 104, 2686 }, // G
-    { 18, 21, 22, 2, 21, 95, 2790 }, // H
-    { 11, 21, 11, 0, 21, 58, 2885 }, // I
-    { 11, 28, 10, -3, 21, 77, 2943 }, // J
-    { 18, 21, 19, 2, 21, 95, 3020 }, // K
-    { 14, 21, 16, 2, 21, 74, 3115 }, // L
-    { 23, 21, 28, 2, 21, 121, 3189 }, // M
-    { 20, 21, 24, 2, 21, 105, 3310 }, // N
-    { 21, 23, 23, 1, 22, 121, 3415 }, // O
-    { 15, 21, 18, 2, 21, 79, 3536 }, // P
-    { 21, 27, 23, 1, 22, 142, 3615 }, // Q
-    { 18, 21, 19, 2, 21, 95, 3757 }, // R
-    { 14, 23, 16, 1, 22, 81, 3852 }, // S
-    { 17, 21, 17, 0, 21, 90, 3933 }, // T
-    { 18, 22, 22, 2, 21, 99, 4023 }, // U
-    { 19, 21, 19, 0, 21, 100, 4122 }, // V
-    { 29, 21, 28, 0, 21, 153, 4222 }, // W
-    { 20, 21, 20, 0, 21, 105, 4375 }, // X
-    { 19, 21, 18, 0, 21, 100, 4480 }, // Y
-    { 17, 21, 17, 0, 21, 90, 4580 }, // Z
-    { 7, 26, 10, 2, 21, 46, 4670 }, // [
-    { 12, 22, 12, 0, 21, 66, 4716 }, // <backslash>
-    { 8, 26, 10, 0, 21, 52, 4782 }, // ]
-    { 17, 14, 17, 0, 21, 60, 4834 }, // ^
-    { 14, 3, 12, -1, -2, 11, 4894 }, // _
-    { 9, 6, 11, 1, 23, 14, 4905 }, // `
-    { 15, 18, 17, 1, 17, 68, 4919 }, // a
-    { 16, 24, 18, 2, 23, 96, 4987 }, // b
-    { 14, 18, 15, 1, 17, 63, 5083 }, // c
-    { 16, 24, 18, 1, 23, 96, 5146 }, // d
-    { 16, 18, 17, 1, 17, 72, 5242 }, // e
-    { 13, 23, 11, 0, 23, 75, 5314 }, // f
-    { 16, 24, 18, 1, 17, 96, 5389 }, // g
-    { 15, 23, 19, 2, 23, 87, 5485 }, // h
-    { 6, 23, 9, 1, 23, 35, 5572 }, // i
-    { 9, 30, 9, -2, 23, 68, 5607 }, // j
-    { 17, 23, 18, 2, 23, 98, 5675 }, // k
-    { 5, 23, 9, 2, 23, 29, 5773 }, // l
-    { 25, 17, 28, 2, 17, 107, 5802 }, // m
-    { 15, 17, 19, 2, 17, 64, 5909 }, // n
-    { 16, 18, 18, 1, 17, 72, 5973 }, // o
-    { 16, 24, 18, 2, 17, 96, 6045 }, // p
-    { 16, 24, 18, 1, 17, 96, 6141 }, // q
-    { 11, 17, 13, 2, 17, 47, 6237 }, // r
-    { 13, 18, 15, 1, 17, 59, 6284 }, // s
-    { 12, 21, 13, 0, 20, 63, 6343 }, // t
-    { 15, 17, 19, 2, 16, 64, 6406 }, // u
-    { 17, 16, 17, 0, 16, 68, 6470 }, // v
-    { 25, 16, 25, 0, 16, 100, 6538 }, // w
-    { 17, 16, 17, 0, 16, 68, 6638 }, // x
-    { 17, 23, 17, 0, 16, 98, 6706 }, // y
-    { 14, 16, 14, 0, 16, 56, 6804 }, // z
-    { 11, 26, 12, 0, 21, 72, 6860 }, // {
-    { 4, 30, 16, 6, 23, 30, 6932 }, // |
-    { 11, 26, 12, 1, 21, 72, 6962 }, // }
-    { 15, 6, 17, 1, 13, 23, 7034 }, // ~
-    { 0, 0, 8, 0, 0, 0, 7057 }, //  
-    { 6, 22, 8, 1, 16, 33, 7057 }, // ¡
-    { 13, 23, 17, 2, 22, 75, 7090 }, // ¢
-    { 16, 22, 17, 1, 22, 88, 7165 }, // £
-    { 14, 14, 17, 1, 17, 49, 7253 }, // ¤
-    { 17, 21, 17, 0, 21, 90, 7302 }, // ¥
-    { 4, 30, 16, 6, 23, 30, 7392 }, // ¦
-    { 12, 24, 14, 1, 23, 72, 7422 }, // §
-    { 11, 4, 17, 3, 22, 11, 7494 }, // ¨
-    { 22, 23, 24, 1, 22, 127, 7505 }, // ©
-    { 10, 12, 11, 0, 22, 30, 7632 }, // ª
-    { 16, 14, 18, 1, 15, 56, 7662 }, // «
-    { 15, 9, 17, 1, 12, 34, 7718 }, // ¬
-    { 9, 4, 9, 0, 10, 9, 7752 }, // ­
-    { 22, 23, 24, 1, 22, 127, 7761 }, // ®
-    { 16, 4, 15, -1, 26, 16, 7888 }, // ¯
-    { 11, 11, 12, 1, 22, 31, 7904 }, // °
-    { 15, 19, 17, 1, 19, 72, 7935 }, // ±
-    { 10, 13, 11, 0, 25, 33, 8007 }, // ²
-    { 11, 14, 11, 0, 25, 39, 8040 }, // ³
-    { 9, 6, 11, 1, 23, 14, 8079 }, // ´
-    { 15, 23, 19, 2, 16, 87, 8093 }, // µ
-    { 16, 27, 19, 1, 23, 108, 8180 }, // ¶
-    { 6, 6, 8, 1, 13, 9, 8288 }, // ·
-    { 8, 7, 8, 0, 0, 14, 8297 }, // ¸
-    { 9, 13, 11, 0, 25, 30, 8311 }, // ¹
-    { 11, 12, 11, 0, 22, 33, 8341 }, // º
-    { 16, 14, 18, 1, 15, 56, 8374 }, // »
-    { 24, 21, 24, 0, 21, 126, 8430 }, // ¼
-    { 25, 21, 26, 0, 21, 132, 8556 }, // ½
-    { 24, 22, 25, 1, 22, 132, 8688 }, // ¾
-    { 14, 23, 14, 0, 17, 81, 8820 }, // ¿
-    { 21, 28, 20, 0, 28, 147, 8901 }, // À
-    { 21, 28, 20, 0, 28, 147, 9048 }, // Á
-    { 21, 28, 20, 0, 28, 147, 9195 }, // Â
-    { 21, 28, 20, 0, 28, 147, 9342 }, // Ã
-    { 21, 27, 20, 0, 27, 142, 9489 }, // Ä
-    { 21, 26, 20, 0, 26, 137, 9631 }, // Å
-    { 27, 21, 28, 0, 21, 142, 9768 }, // Æ
-    { 17, 29, 19, 1, 22, 124, 9910 }, // Ç
-    { 13, 28, 16, 2, 28, 91, 10034 }, // È
-    { 13, 28, 16, 2, 28, 91, 10125 }, // É
-    { 13, 28, 16, 2, 28, 91, 10216 }, // Ê
-    { 13, 27, 16, 2, 27, 88, 10307 }, // Ë
-    { 11, 28, 11, 0, 28, 77, 10395 }, // Ì
-    { 11, 28, 11, 0, 28, 77, 10472 }, // Í
-    { 13, 28, 11, -1, 28, 91, 10549 }, // Î
-    { 11, 27, 11, 0, 27, 75, 10640 }, // Ï
-    { 20, 21, 21, 0, 21, 105, 10715 }, // Ð
-    { 20, 28, 24, 2, 28, 140, 10820 }, // Ñ
-    { 21, 29, 23, 1, 28, 153, 10960 }, // Ò
-    { 21, 29, 23, 1, 28, 153, 11113 }, // Ó
-    { 21, 29, 23, 1, 28, 153, 11266 }, // Ô
-    { 21, 29, 23, 1, 28, 153, 11419 }, // Õ
-    { 21, 28, 23, 1, 27, 147, 11572 }, // Ö
-    { 14, 14, 17, 1, 17, 49, 11719 }, // ×
-    { 21, 24, 23, 1, 22, 126, 11768 }, // Ø
-    { 18, 29, 22, 2, 28, 131, 11894 }, // Ù
-    { 18, 29, 22, 2, 28, 131, 12025 }, // Ú
-    { 18, 29, 22, 2, 28, 131, 12156 }, // Û
-    { 18, 28, 22, 2, 27, 126, 12287 }, // Ü
-    { 19, 28, 18, 0, 28, 133, 12413 }, // Ý
-    { 15, 21, 18, 2, 21, 79, 12546 }, // Þ
-    { 18, 24, 21, 2, 23, 108, 12625 }, // ß
-    { 15, 24, 17, 1, 23, 90, 12733 }, // à
-    { 15, 24, 17, 1, 23, 90, 12823 }, // á
-    { 15, 24, 17, 1, 23, 90, 12913 }, // â
-    { 15, 24, 17, 1, 23, 90, 13003 }, // ã
-    { 15, 23, 17, 1, 22, 87, 13093 }, // ä
-    { 15, 26, 17, 1, 25, 98, 13180 }, // å
-    { 25, 18, 27, 1, 17, 113, 13278 }, // æ
-    { 14, 24, 15, 1, 17, 84, 13391 }, // ç
-    { 16, 24, 17, 1, 23, 96, 13475 }, // è
-    { 16, 24, 17, 1, 23, 96, 13571 }, // é
-    { 16, 24, 17, 1, 23, 96, 13667 }, // ê
-    { 16, 23, 17, 1, 22, 92, 13763 }, // ë
-    { 10, 23, 9, -1, 23, 58, 13855 }, // ì
-    { 9, 23, 9, 2, 23, 52, 13913 }, // í
-    { 13, 23, 9, -2, 23, 75, 13965 }, // î
-    { 11, 22, 9, -1, 22, 61, 14040 }, // ï
-    { 16, 24, 18, 1, 23, 96, 14101 }, // ð
-    { 15, 23, 19, 2, 23, 87, 14197 }, // ñ
-    { 16, 24, 18, 1, 23, 96, 14284 }, // ò
-    { 16, 24, 18, 1, 23, 96, 14380 }, // ó
-    { 16, 24, 18, 1, 23, 96, 14476 }, // ô
-    { 16, 24, 18, 1, 23, 96, 14572 }, // õ
-    { 16, 23, 18, 1, 22, 92, 14668 }, // ö
-    { 15, 15, 17, 1, 18, 57, 14760 }, // ÷
-    { 16, 19, 18, 1, 17, 76, 14817 }, // ø
-    { 15, 24, 19, 2, 23, 90, 14893 }, // ù
-    { 15, 24, 19, 2, 23, 90, 14983 }, // ú
-    { 15, 24, 19, 2, 23, 90, 15073 }, // û
-    { 15, 23, 19, 2, 22, 87, 15163 }, // ü
-    { 17, 30, 17, 0, 23, 128, 15250 }, // ý
-    { 16, 30, 18, 2, 23, 120, 15378 }, // þ
-    { 17, 29, 17, 0, 22, 124, 15498 }, // ÿ
-    { 21, 26, 20, 0, 26, 137, 15622 }, // Ā
-    { 15, 22, 17, 1, 21, 83, 15759 }, // ā
-    { 21, 28, 20, 0, 28, 147, 15842 }, // Ă
-    { 15, 24, 17, 1, 23, 90, 15989 }, // ă
-    { 21, 28, 20, 0, 21, 147, 16079 }, // Ą
-    { 15, 24, 17, 1, 17, 90, 16226 }, // ą
-    { 17, 29, 19, 1, 28, 124, 16316 }, // Ć
-    { 14, 24, 15, 1, 23, 84, 16440 }, // ć
-    { 17, 29, 19, 1, 28, 124, 16524 }, // Ĉ
-    { 14, 24, 15, 1, 23, 84, 16648 }, // ĉ
-    { 17, 29, 19, 1, 28, 124, 16732 }, // Ċ
-    { 14, 24, 15, 1, 23, 84, 16856 }, // ċ
-    { 17, 29, 19, 1, 28, 124, 16940 }, // Č
-    { 14, 24, 15, 1, 23, 84, 17064 }, // č
-    { 18, 28, 21, 2, 28, 126, 17148 }, // Ď
-    { 22, 24, 18, 1, 23, 132, 17274 }, // ď
-    { 20, 21, 21, 0, 21, 105, 17406 }, // Đ
-    { 18, 24, 19, 1, 23, 108, 17511 }, // đ
-    { 13, 26, 16, 2, 26, 85, 17619 }, // Ē
-    { 16, 22, 17, 1, 21, 88, 17704 }, // ē
-    { 13, 28, 16, 2, 28, 91, 17792 }, // Ĕ
-    { 16, 24, 17, 1, 23, 96, 17883 }, // ĕ
-    { 13, 28, 16, 2, 28, 91, 17979 }, // Ė
-    { 16, 24, 17, 1, 23, 96, 18070 }, // ė
-    { 13, 28, 16, 2, 21, 91, 18166 }, // Ę
-    { 16, 24, 17, 1, 17, 96, 18257 }, // ę
-    { 14, 28, 16, 2, 28, 98, 18353 }, // Ě
-    { 16, 24, 17, 1, 23, 96, 18451 }, // ě
-    { 18, 29, 21, 1, 28, 131, 18547 }, // Ĝ
-    { 16, 30, 18, 1, 23, 120, 18678 }, // ĝ
-    { 18, 29, 21, 1, 28, 131, 18798 }, // Ğ
-    { 16, 30, 18, 1, 23, 120, 18929 }, // ğ
-    { 18, 29, 21, 1, 28, 131, 19049 }, // Ġ
-    { 16, 30, 18, 1, 23, 120, 19180 }, // ġ
-    { 18, 29, 21, 1, 22, 131, 19300 }, // Ģ
-    { 16, 30, 18, 1, 23, 120, 19431 }, // ģ
-    { 18, 28, 22, 2, 28, 126, 19551 }, // Ĥ
-    { 19, 29, 19, -2, 29, 138, 19677 }, // ĥ
-    { 23, 21, 22, 0, 21, 121, 19815 }, // Ħ
-    { 17, 23, 19, 0, 23, 98, 19936 }, // ħ
-    { 12, 28, 11, -1, 28, 84, 20034 }, // Ĩ
-    { 13, 23, 9, -2, 23, 75, 20118 }, // ĩ
-    { 11, 26, 11, 0, 26, 72, 20193 }, // Ī
-    { 11, 21, 9, -1, 21, 58, 20265 }, // ī
-    { 12, 28, 11, 0, 28, 84, 20323 }, // Ĭ
-    { 12, 23, 9, -1, 23, 69, 20407 }, // ĭ
-    { 11, 28, 11, 0, 21, 77, 20476 }, // Į
-    { 6, 30, 9, 1, 23, 45, 20553 }, // į
-    { 11, 28, 11, 0, 28, 77, 20598 }, // İ
-    { 5, 16, 9, 2, 16, 20, 20675 }, // ı
-    { 19, 28, 21, 0, 21, 133, 20695 }, // Ĳ
-    { 15, 30, 18, 1, 23, 113, 20828 }, // ĳ
-    { 14, 35, 10, -3, 28, 123, 20941 }, // Ĵ
-    { 13, 30, 9, -2, 23, 98, 21064 }, // ĵ
-    { 18, 28, 19, 2, 21, 126, 21162 }, // Ķ
-    { 17, 30, 18, 2, 23, 128, 21288 }, // ķ
-    { 17, 16, 18, 2, 16, 68, 21416 }, // ĸ
-    { 14, 28, 16, 2, 28, 98, 21484 }, // Ĺ
-    { 10, 29, 9, 1, 29, 73, 21582 }, // ĺ
-    { 14, 28, 16, 2, 21, 98, 21655 }, // Ļ
-    { 6, 30, 9, 1, 23, 45, 21753 }, // ļ
-    { 15, 21, 16, 2, 21, 79, 21798 }, // Ľ
-    { 11, 23, 9, 2, 23, 64, 21877 }, // ľ
-    { 14, 21, 16, 2, 21, 74, 21941 }, // Ŀ
-    { 11, 23, 11, 2, 23, 64, 22015 }, // ŀ
-    { 16, 21, 16, 0, 21, 84, 22079 }, // Ł
-    { 11, 23, 9, -1, 23, 64, 22163 }, // ł
-    { 20, 28, 24, 2, 28, 140, 22227 }, // Ń
-    { 15, 23, 19, 2, 23, 87, 22367 }, // ń
-    { 20, 28, 24, 2, 21, 140, 22454 }, // Ņ
-    { 15, 24, 19, 2, 17, 90, 22594 }, // ņ
-    { 20, 28, 24, 2, 28, 140, 22684 }, // Ň
-    { 15, 23, 19, 2, 23, 87, 22824 }, // ň
-    { 22, 21, 23, -1, 21, 116, 22911 }, // ŉ
-    { 20, 28, 24, 2, 21, 140, 23027 }, // Ŋ
-    { 15, 24, 19, 2, 17, 90, 23167 }, // ŋ
-    { 21, 27, 23, 1, 26, 142, 23257 }, // Ō
-    { 16, 22, 18, 1, 21, 88, 23399 }, // ō
-    { 21, 29, 23, 1, 28, 153, 23487 }, // Ŏ
-    { 16, 24, 18, 1, 23, 96, 23640 }, // ŏ
-    { 21, 29, 23, 1, 28, 153, 23736 }, // Ő
-    { 16, 24, 18, 1, 23, 96, 23889 }, // ő
-    { 26, 23, 28, 1, 22, 150, 23985 }, // Œ
-    { 27, 18, 29, 1, 17, 122, 24135 }, // œ
-    { 18, 28, 19, 2, 28, 126, 24257 }, // Ŕ
-    { 12, 23, 13, 2, 23, 69, 24383 }, // ŕ
-    { 18, 28, 19, 2, 21, 126, 24452 }, // Ŗ
-    { 12, 24, 13, 1, 17, 72, 24578 }, // ŗ
-    { 18, 28, 19, 2, 28, 126, 24650 }, // Ř
-    { 13, 23, 13, 1, 23, 75, 24776 }, // ř
-    { 14, 29, 16, 1, 28, 102, 24851 }, // Ś
-    { 13, 24, 15, 1, 23, 78, 24953 }, // ś
-    { 14, 29, 16, 1, 28, 102, 25031 }, // Ŝ
-    { 13, 24, 15, 1, 23, 78, 25133 }, // ŝ
-    { 14, 29, 16, 1, 22, 102, 25211 }, // Ş
-    { 13, 24, 15, 1, 17, 78, 25313 }, // ş
-    { 14, 29, 16, 1, 28, 102, 25391 }, // Š
-    { 13, 24, 15, 1, 23, 78, 25493 }, // š
-    { 17, 28, 17, 0, 21, 119, 25571 }, // Ţ
-    { 12, 27, 13, 0, 20, 81, 25690 }, // ţ
-    { 17, 28, 17, 0, 28, 119, 25771 }, // Ť
-    { 17, 24, 13, 0, 23, 102, 25890 }, // ť
-    { 17, 21, 17, 0, 21, 90, 25992 }, // Ŧ
-    { 12, 21, 13, 0, 20, 63, 26082 }, // ŧ
-    { 18, 29, 22, 2, 28, 131, 26145 }, // Ũ
-    { 15, 24, 19, 2, 23, 90, 26276 }, // ũ
-    { 18, 27, 22, 2, 26, 122, 26366 }, // Ū
-    { 15, 22, 19, 2, 21, 83, 26488 }, // ū
-    { 18, 29, 22, 2, 28, 131, 26571 }, // Ŭ
-    { 15, 24, 19, 2, 23, 90, 26702 }, // ŭ
-    { 18, 31, 22, 2, 30, 140, 26792 }, // Ů
-    { 15, 26, 19, 2, 25, 98, 26932 }, // ů
-    { 18, 29, 22, 2, 28, 131, 27030 }, // Ű
-    { 15, 24, 19, 2, 23, 90, 27161 }, // ű
-    { 18, 28, 22, 2, 21, 126, 27251 }, // Ų
-    { 15, 23, 19, 2, 16, 87, 27377 }, // ų
-    { 29, 28, 28, 0, 28, 203, 27464 }, // Ŵ
-    { 25, 23, 25, 0, 23, 144, 27667 }, // ŵ
-    { 19, 28, 18, 0, 28, 133, 27811 }, // Ŷ
-    { 17, 30, 17, 0, 23, 128, 27944 }, // ŷ
-    { 19, 27, 18, 0, 27, 129, 28072 }, // Ÿ
-    { 17, 28, 17, 0, 28, 119, 28201 }, // Ź
-    { 14, 23, 14, 0, 23, 81, 28320 }, // ź
-    { 17, 28, 17, 0, 28, 119, 28401 }, // Ż
-    { 14, 23, 14, 0, 23, 81, 28520 }, // ż
-    { 17, 28, 17, 0, 28, 119, 28601 }, // Ž
-    { 14, 23, 14, 0, 23, 81, 28720 }, // ž
-    { 10, 23, 11, 2, 23, 58, 28801 }, // ſ
-    { 9, 6, 0, -16, 23, 14, 28859 }, // ̀
-    { 9, 6, 0, -11, 23, 14, 28873 }, // ́
-    { 12, 6, 0, -6, 23, 18, 28887 }, // ̂
-    { 12, 6, 0, -16, 23, 18, 28905 }, // ̃
-    { 10, 4, 0, -5, 21, 10, 28923 }, // ̄
-    { 14, 4, 0, -7, 25, 14, 28933 }, // ̅
-    { 12, 6, 0, -6, 23, 18, 28947 }, // ̆
-    { 6, 6, 0, -3, 23, 9, 28965 }, // ̇
-    { 12, 4, 0, -6, 22, 12, 28974 }, // ̈
-    { 8, 8, 0, -13, 25, 16, 28986 }, // ̉
-    { 8, 8, 0, -4, 25, 16, 29002 }, // ̊
-    { 14, 6, 0, -5, 23, 21, 29018 }, // ̋
-    { 13, 6, 0, -6, 23, 20, 29039 }, // ̌
-    { 4, 6, 0, -2, 23, 6, 29059 }, // ̍
-    { 8, 6, 0, -4, 23, 12, 29065 }, // ̎
-    { 13, 6, 0, -17, 23, 20, 29077 }, // ̏
-    { 12, 8, 0, -6, 25, 24, 29097 }, // ̐
-    { 12, 6, 0, -6, 23, 18, 29121 }, // ̑
-    { 6, 8, 0, -3, 21, 12, 29139 }, // ̒
-    { 6, 8, 0, -3, 21, 12, 29151 }, // ̓
-    { 6, 8, 0, -3, 21, 12, 29163 }, // ̔
-    { 6, 8, 0, -3, 21, 12, 29175 }, // ̕
-    { 9, 6, 0, -5, -1, 14, 29187 }, // ̖
-    { 10, 6, 0, -5, -1, 15, 29201 }, // ̗
-    { 6, 7, 0, -3, 0, 11, 29216 }, // ̘
-    { 6, 7, 0, -3, 0, 11, 29227 }, // ̙
-    { 8, 8, 9, 0, 23, 16, 29238 }, // ̚
-    { 8, 8, 0, -3, 23, 16, 29254 }, // ̛
-    { 4, 7, 0, -2, 0, 7, 29270 }, // ̜
-    { 8, 6, 0, -4, -1, 12, 29277 }, // ̝
-    { 8, 6, 0, -4, -1, 12, 29289 }, // ̞
-    { 8, 7, 0, -4, 0, 14, 29301 }, // ̟
-    { 7, 3, 0, -4, -3, 6, 29315 }, // ̠
-    { 7, 9, 0, -7, 2, 16, 29321 }, // ̡
-    { 7, 9, 0, 0, 2, 16, 29337 }, // ̢
-    { 6, 6, 0, -13, -1, 9, 29353 }, // ̣
-    { 12, 4, 0, -6, -2, 12, 29362 }, // ̤
-    { 8, 8, 0, -4, 1, 16, 29374 }, // ̥
-    { 6, 6, 0, -3, -1, 9, 29390 }, // ̦
-    { 8, 7, 0, -4, 0, 14, 29399 }, // ̧
-    { 6, 8, 0, -3, 1, 12, 29413 }, // ̨
-    { 4, 6, 0, -2, -1, 6, 29425 }, // ̩
-    { 12, 6, 0, -6, -1, 18, 29431 }, // ̪
-    { 12, 5, 0, -6, -1, 15, 29449 }, // ̫
-    { 13, 6, 0, -6, 0, 20, 29464 }, // ̬
-    { 12, 6, 0, -6, -1, 18, 29484 }, // ̭
-    { 12, 6, 0, -6, -1, 18, 29502 }, // ̮
-    { 12, 6, 0, -6, -1, 18, 29520 }, // ̯
-    { 12, 6, 0, -6, -1, 18, 29538 }, // ̰
-    { 10, 4, 0, -5, -2, 10, 29556 }, // ̱
-    { 14, 3, 0, -7, -2, 11, 29566 }, // ̲
-    { 13, 7, 0, -7, 0, 23, 29577 }, // ̳
-    { 13, 6, 0, -6, 11, 20, 29600 }, // ̴
-    { 14, 4, 0, -7, 10, 14, 29620 }, // ̵
-    { 22, 4, 0, -11, 10, 22, 29634 }, // ̶
-    { 12, 9, 0, -6, 13, 27, 29656 }, // ̷
-    { 14, 25, 0, -7, 23, 88, 29683 }, // ̸
-    { 4, 7, 0, -2, 0, 7, 29771 }, // ̹
-    { 12, 6, 0, -6, -1, 18, 29778 }, // ̺
-    { 12, 7, 0, -6, 0, 21, 29796 }, // ̻
-    { 12, 5, 0, -6, -1, 15, 29817 }, // ̼
-    { 6, 7, 0, -3, 23, 11, 29832 }, // ̽
-    { 4, 10, 0, -2, 26, 10, 29843 }, // ̾
-    { 13, 7, 0, -7, 29, 23, 29853 }, // ̿
-    { 9, 6, 0, -7, 23, 14, 29876 }, // ̀
-    { 9, 6, 0, -2, 23, 14, 29890 }, // ́
-    { 13, 6, 0, -6, 23, 20, 29904 }, // ͂
-    { 6, 6, 0, -3, 23, 9, 29924 }, // ̓
-    { 17, 6, 0, -7, 23, 26, 29933 }, // ̈́
-    { 7, 6, 0, -2, -1, 11, 29959 }, // ͅ
-    { 14, 6, 0, -7, 23, 21, 29970 }, // ͆
-    { 13, 7, 0, -7, 0, 23, 29991 }, // ͇
-    { 8, 6, 0, -4, -1, 12, 30014 }, // ͈
-    { 6, 6, 0, -3, -1, 9, 30026 }, // ͉
-    { 12, 7, 0, -6, 23, 21, 30035 }, // ͊
-    { 12, 12, 0, -6, 28, 36, 30056 }, // ͋
-    { 12, 9, 0, -6, 26, 27, 30092 }, // ͌
-    { 12, 6, 0, -6, -1, 18, 30119 }, // ͍
-    { 6, 7, 0, -3, 0, 11, 30137 }, // ͎
-    { 22, 21, 0, -11, 21, 116, 30148 }, // ͏
-    { 6, 7, 0, -3, 24, 11, 30264 }, // ͐
-    { 5, 8, 0, -2, 24, 10, 30275 }, // ͑
-    { 12, 8, 0, -6, 25, 24, 30285 }, // ͒
-    { 6, 7, 0, -3, 0, 11, 30309 }, // ͓
-    { 6, 6, 0, -3, -1, 9, 30320 }, // ͔
-    { 6, 6, 0, -3, -1, 9, 30329 }, // ͕
-    { 12, 6, 0, -6, -1, 18, 30338 }, // ͖
-    { 5, 8, 0, -2, 24, 10, 30356 }, // ͗
-    { 6, 6, 0, 2, 23, 9, 30366 }, // ͘
-    { 8, 6, 0, -4, -1, 12, 30375 }, // ͙
-    { 12, 7, 0, -6, 0, 21, 30387 }, // ͚
-    { 6, 6, 0, -3, 23, 9, 30408 }, // ͛
-    { 24, 6, 0, -12, -1, 36, 30417 }, // ͜
-    { 24, 6, 0, -12, 23, 36, 30453 }, // ͝
-    { 18, 3, 0, -9, 20, 14, 30489 }, // ͞
-    { 18, 3, 0, -9, -2, 14, 30503 }, // ͟
-    { 24, 6, 0, -12, 23, 36, 30517 }, // ͠
-    { 24, 7, 0, -12, 26, 42, 30553 }, // ͡
-    { 24, 7, 0, -11, 0, 42, 30595 }, // ͢
-    { 8, 8, 0, -4, 25, 16, 30637 }, // ͣ
-    { 7, 8, 0, -3, 25, 14, 30653 }, // ͤ
-    { 3, 9, 0, -1, 27, 7, 30667 }, // ͥ
-    { 8, 8, 0, -4, 25, 16, 30674 }, // ͦ
-    { 8, 8, 0, -4, 25, 16, 30690 }, // ͧ
-    { 7, 8, 0, -3, 25, 14, 30706 }, // ͨ
-    { 8, 10, 0, -4, 27, 20, 30720 }, // ͩ
-    { 7, 9, 0, -3, 27, 16, 30740 }, // ͪ
-    { 12, 7, 0, -6, 25, 21, 30756 }, // ͫ
-    { 6, 7, 0, -2, 25, 11, 30777 }, // ͬ
-    { 6, 9, 0, -3, 26, 14, 30788 }, // ͭ
-    { 9, 7, 0, -4, 25, 16, 30802 }, // ͮ
-    { 8, 7, 0, -4, 25, 14, 30818 }, // ͯ
-    { 13, 28, 16, 2, 28, 91, 30832 }, // Ѐ
-    { 13, 27, 16, 2, 27, 88, 30923 }, // Ё
-    { 22, 22, 22, 0, 21, 121, 31011 }, // Ђ
-    { 14, 28, 16, 2, 28, 98, 31132 }, // Ѓ
-    { 17, 23, 19, 1, 22, 98, 31230 }, // Є
-    { 14, 23, 16, 1, 22, 81, 31328 }, // Ѕ
-    { 5, 21, 9, 2, 21, 27, 31409 }, // І
-    { 10, 28, 10, 0, 28, 70, 31436 }, // Ї
-    { 11, 28, 10, -3, 21, 77, 31506 }, // Ј
-    { 29, 22, 30, 0, 21, 160, 31583 }, // Љ
-    { 28, 21, 31, 2, 21, 147, 31743 }, // Њ
-    { 21, 21, 23, 0, 21, 111, 31890 }, // Ћ
-    { 19, 28, 20, 2, 28, 133, 32001 }, // Ќ
-    { 19, 28, 23, 2, 28, 133, 32134 }, // Ѝ
-    { 19, 29, 19, 0, 28, 138, 32267 }, // Ў
-    { 18, 26, 22, 2, 21, 117, 32405 }, // Џ
-    { 21, 21, 20, 0, 21, 111, 32522 }, // А
-    { 16, 21, 19, 2, 21, 84, 32633 }, // Б
-    { 16, 21, 19, 2, 21, 84, 32717 }, // В
-    { 14, 21, 16, 2, 21, 74, 32801 }, // Г
-    { 23, 26, 23, 0, 21, 150, 32875 }, // Д
-    { 13, 21, 16, 2, 21, 69, 33025 }, // Е
-    { 29, 21, 29, 0, 21, 153, 33094 }, // Ж
-    { 15, 23, 17, 1, 22, 87, 33247 }, // З
-    { 19, 21, 23, 2, 21, 100, 33334 }, // И
-    { 19, 28, 23, 2, 28, 133, 33434 }, // Й
-    { 19, 21, 20, 2, 21, 100, 33567 }, // К
-    { 19, 22, 21, 0, 21, 105, 33667 }, // Л
-    { 23, 21, 28, 2, 21, 121, 33772 }, // М
-    { 18, 21, 22, 2, 21, 95, 33893 }, // Н
-    { 21, 23, 23, 1, 22, 121, 33988 }, // О
-    { 18, 21, 22, 2, 21, 95, 34109 }, // П
-    { 15, 21, 18, 2, 21, 79, 34204 }, // Р
-    { 17, 23, 19, 1, 22, 98, 34283 }, // С
-    { 17, 21, 17, 0, 21, 90, 34381 }, // Т
-    { 19, 22, 19, 0, 21, 105, 34471 }, // У
-    { 24, 23, 26, 1, 22, 138, 34576 }, // Ф
-    { 20, 21, 19, 0, 21, 105, 34714 }, // Х
-    { 21, 26, 23, 2, 21, 137, 34819 }, // Ц
-    { 17, 21, 21, 2, 21, 90, 34956 }, // Ч
-    { 27, 21, 31, 2, 21, 142, 35046 }, // Ш
-    { 30, 26, 31, 2, 21, 195, 35188 }, // Щ
-    { 21, 21, 22, 0, 21, 111, 35383 }, // Ъ
-    { 23, 21, 27, 2, 21, 121, 35494 }, // Ы
-    { 16, 21, 19, 2, 21, 84, 35615 }, // Ь
-    { 17, 23, 19, 1, 22, 98, 35699 }, // Э
-    { 27, 23, 30, 2, 22, 156, 35797 }, // Ю
-    { 18, 21, 20, 0, 21, 95, 35953 }, // Я
-    { 15, 18, 17, 1, 17, 68, 36048 }, // а
-    { 16, 24, 18, 1, 23, 96, 36116 }, // б
-    { 15, 16, 17, 2, 16, 60, 36212 }, // в
-    { 12, 16, 14, 2, 16, 48, 36272 }, // г
-    { 19, 21, 19, 0, 16, 100, 36320 }, // д
-    { 15, 18, 17, 1, 17, 68, 36420 }, // е
-    { 26, 16, 25, 0, 16, 104, 36488 }, // ж
-    { 14, 18, 15, 0, 17, 63, 36592 }, // з
-    { 16, 16, 20, 2, 16, 64, 36655 }, // и
-    { 16, 23, 20, 2, 23, 92, 36719 }, // й
-    { 16, 16, 18, 2, 16, 64, 36811 }, // к
-    { 17, 17, 18, 0, 16, 73, 36875 }, // л
-    { 21, 16, 24, 2, 16, 84, 36948 }, // м
-    { 15, 16, 19, 2, 16, 60, 37032 }, // н
-    { 16, 18, 18, 1, 17, 72, 37092 }, // о
-    { 15, 16, 19, 2, 16, 60, 37164 }, // п
-    { 16, 24, 19, 2, 17, 96, 37224 }, // р
-    { 14, 18, 15, 1, 17, 63, 37320 }, // с
-    { 15, 16, 15, 0, 16, 60, 37383 }, // т
-    { 18, 23, 17, -1, 16, 104, 37443 }, // у
-    { 22, 30, 24, 1, 23, 165, 37547 }, // ф
-    { 17, 16, 17, 0, 16, 68, 37712 }, // х
-    { 17, 21, 19, 2, 16, 90, 37780 }, // ц
-    { 16, 16, 19, 1, 16, 64, 37870 }, // ч
-    { 24, 16, 28, 2, 16, 96, 37934 }, // ш
-    { 26, 21, 28, 2, 16, 137, 38030 }, // щ
-    { 19, 16, 20, 0, 16, 76, 38167 }, // ъ
-    { 21, 16, 25, 2, 16, 84, 38243 }, // ы
-    { 15, 16, 17, 2, 16, 60, 38327 }, // ь
-    { 14, 18, 15, 1, 17, 63, 38387 }, // э
-    { 22, 18, 25, 2, 17, 99, 38450 }, // ю
-    { 16, 16, 18, 0, 16, 64, 38549 }, // я
-    { 15, 24, 17, 1, 23, 90, 38613 }, // ѐ
-    { 15, 23, 17, 1, 22, 87, 38703 }, // ё
-    { 17, 30, 19, 0, 23, 128, 38790 }, // ђ
-    { 12, 23, 14, 2, 23, 69, 38918 }, // ѓ
-    { 14, 18, 15, 1, 17, 63, 38987 }, // є
-    { 13, 18, 15, 1, 17, 59, 39050 }, // ѕ
-    { 5, 23, 9, 2, 23, 29, 39109 }, // і
-    { 9, 23, 9, 0, 23, 52, 39138 }, // ї
-    { 9, 30, 9, -2, 23, 68, 39190 }, // ј
-    { 25, 17, 26, 0, 16, 107, 39258 }, // љ
-    { 24, 16, 27, 2, 16, 96, 39365 }, // њ
-    { 17, 23, 19, 0, 23, 98, 39461 }, // ћ
-    { 16, 23, 18, 2, 23, 92, 39559 }, // ќ
-    { 16, 23, 20, 2, 23, 92, 39651 }, // ѝ
-    { 18, 30, 17, -1, 23, 135, 39743 }, // ў
-    { 15, 21, 19, 2, 16, 79, 39878 }, // џ
-    { 28, 21, 28, 0, 21, 147, 39957 }, // Ѡ
-    { 25, 16, 26, 0, 16, 100, 40104 }, // ѡ
-    { 19, 21, 20, 0, 21, 100, 40204 }, // Ѣ
-    { 19, 20, 19, 0, 20, 95, 40304 }, // ѣ
-    { 25, 23, 28, 2, 22, 144, 40399 }, // Ѥ
-    { 21, 18, 23, 2, 17, 95, 40543 }, // ѥ
-    { 22, 21, 21, 0, 21, 116, 40638 }, // Ѧ
-    { 19, 16, 19, 0, 16, 76, 40754 }, // ѧ
-    { 28, 21, 29, 2, 21, 147, 40830 }, // Ѩ
-    { 25, 16, 26, 2, 16, 100, 40977 }, // ѩ
-    { 23, 21, 23, 0, 21, 121, 41077 }, // Ѫ
-    { 18, 16, 18, 0, 16, 72, 41198 }, // ѫ
-    { 29, 21, 31, 2, 21, 153, 41270 }, // Ѭ
-    { 24, 16, 26, 2, 16, 96, 41423 }, // ѭ
-    { 18, 33, 18, 0, 26, 149, 41519 }, // Ѯ
-    { 16, 27, 16, 0, 20, 108, 41668 }, // ѯ
-    { 22, 21, 26, 2, 21, 116, 41776 }, // Ѱ
-    { 21, 30, 25, 2, 23, 158, 41892 }, // ѱ
-    { 21, 23, 23, 1, 22, 121, 42050 }, // Ѳ
-    { 16, 18, 18, 1, 17, 72, 42171 }, // ѳ
-    { 21, 21, 21, 0, 21, 111, 42243 }, // Ѵ
-    { 18, 17, 18, 0, 17, 77, 42354 }, // ѵ
-    { 21, 28, 21, 0, 28, 147, 42431 }, // Ѷ
-    { 18, 23, 18, 0, 23, 104, 42578 }, // ѷ
-    { 38, 29, 38, 1, 22, 276, 42682 }, // Ѹ
-    { 34, 24, 34, 1, 17, 204, 42958 }, // ѹ
-    { 22, 25, 24, 1, 23, 138, 43162 }, // Ѻ
-    { 18, 20, 20, 1, 18, 90, 43300 }, // ѻ
-    { 30, 33, 32, 1, 32, 248, 43390 }, // Ѽ
-    { 26, 28, 28, 1, 27, 182, 43638 }, // ѽ
-    { 28, 27, 28, 0, 27, 189, 43820 }, // Ѿ
-    { 25, 22, 26, 0, 22, 138, 44009 }, // ѿ
-    { 18, 29, 20, 1, 22, 131, 44147 }, // Ҁ
-    { 14, 24, 15, 1, 17, 84, 44278 }, // ҁ
-    { 16, 20, 18, 1, 19, 80, 44362 }, // ҂
-    { 12, 6, 0, -14, 22, 18, 44442 }, // ҃
-    { 12, 6, 0, -14, 23, 18, 44460 }, // ҄
-    { 5, 7, 0, -10, 24, 9, 44478 }, // ҅
-    { 5, 7, 0, -10, 24, 9, 44487 }, // ҆
-    { 12, 5, 0, -6, 27, 15, 44496 }, // ҇
-    { 34, 31, 0, -17, 23, 264, 44511 }, // ҈
-    { 34, 33, 0, -17, 24, 281, 44775 }, // ҉
-    { 25, 35, 27, 2, 28, 219, 45056 }, // Ҋ
-    { 21, 29, 23, 2, 23, 153, 45275 }, // ҋ
-    { 18, 21, 19, 0, 21, 95, 45428 }, // Ҍ
-    { 17, 23, 18, 0, 23, 98, 45523 }, // ҍ
-    { 15, 21, 18, 2, 21, 79, 45621 }, // Ҏ
-    { 16, 24, 18, 2, 17, 96, 45700 }, // ҏ
-    { 15, 26, 17, 2, 26, 98, 45796 }, // Ґ
-    { 12, 21, 15, 2, 21, 63, 45894 }, // ґ
-    { 16, 21, 16, 0, 21, 84, 45957 }, // Ғ
-    { 14, 16, 14, 0, 16, 56, 46041 }, // ғ
-    { 18, 29, 21, 2, 21, 131, 46097 }, // Ҕ
-    { 15, 24, 18, 2, 16, 90, 46228 }, // ҕ
-    { 30, 28, 30, 0, 21, 210, 46318 }, // Җ
-    { 28, 22, 27, -1, 16, 154, 46528 }, // җ
-    { 15, 29, 17, 1, 22, 109, 46682 }, // Ҙ
-    { 14, 24, 15, 0, 17, 84, 46791 }, // ҙ
-    { 20, 28, 22, 2, 21, 140, 46875 }, // Қ
-    { 17, 22, 19, 2, 16, 94, 47015 }, // қ
-    { 18, 21, 20, 2, 21, 95, 47109 }, // Ҝ
-    { 16, 16, 18, 2, 16, 64, 47204 }, // ҝ
-    { 20, 21, 20, 1, 21, 105, 47268 }, // Ҟ
-    { 19, 23, 18, 0, 23, 110, 47373 }, // ҟ
-    { 22, 21, 21, 0, 21, 116, 47483 }, // Ҡ
-    { 21, 16, 20, 0, 16, 84, 47599 }, // ҡ
-    { 22, 28, 25, 2, 21, 154, 47683 }, // Ң
-    { 19, 22, 22, 2, 16, 105, 47837 }, // ң
-    { 23, 21, 24, 2, 21, 121, 47942 }, // Ҥ
-    { 21, 16, 22, 2, 16, 84, 48063 }, // ҥ
-    { 30, 29, 33, 2, 21, 218, 48147 }, // Ҧ
-    { 23, 24, 26, 2, 16, 138, 48365 }, // ҧ
-    { 21, 24, 23, 1, 22, 126, 48503 }, // Ҩ
-    { 18, 19, 19, 1, 17, 86, 48629 }, // ҩ
-    { 17, 29, 19, 1, 22, 124, 48715 }, // Ҫ
-    { 14, 24, 15, 1, 17, 84, 48839 }, // ҫ
-    { 17, 28, 17, 0, 21, 119, 48923 }, // Ҭ
-    { 16, 22, 16, 0, 16, 88, 49042 }, // ҭ
-    { 19, 21, 18, 0, 21, 100, 49130 }, // Ү
-    { 17, 23, 17, 0, 16, 98, 49230 }, // ү
-    { 19, 21, 18, 0, 21, 100, 49328 }, // Ұ
-    { 17, 23, 17, 0, 16, 98, 49428 }, // ұ
-    { 22, 28, 22, 0, 21, 154, 49526 }, // Ҳ
-    { 19, 22, 19, 0, 16, 105, 49680 }, // ҳ
-    { 27, 28, 27, 0, 21, 189, 49785 }, // Ҵ
-    { 23, 22, 23, 0, 16, 127, 49974 }, // ҵ
-    { 22, 28, 23, 1, 21, 154, 50101 }, // Ҷ
-    { 20, 22, 21, 1, 16, 110, 50255 }, // ҷ
-    { 18, 21, 21, 1, 21, 95, 50365 }, // Ҹ
-    { 17, 16, 19, 1, 16, 68, 50460 }, // ҹ
-    { 18, 21, 21, 2, 21, 95, 50528 }, // Һ
-    { 15, 23, 19, 2, 23, 87, 50623 }, // һ
-    { 26, 23, 28, 0, 22, 150, 50710 }, // Ҽ
-    { 21, 18, 21, -1, 17, 95, 50860 }, // ҽ
-    { 26, 29, 28, 0, 22, 189, 50955 }, // Ҿ
-    { 21, 23, 21, -1, 17, 121, 51144 }, // ҿ
-    { 11, 21, 11, 0, 21, 58, 51265 }, // Ӏ
-    { 29, 28, 29, 0, 28, 203, 51323 }, // Ӂ
-    { 26, 23, 25, 0, 23, 150, 51526 }, // ӂ
-    { 19, 29, 22, 2, 21, 138, 51676 }, // Ӄ
-    { 16, 24, 19, 2, 16, 96, 51814 }, // ӄ
-    { 24, 28, 24, 0, 21, 168, 51910 }, // Ӆ
-    { 21, 22, 21, 0, 16, 116, 52078 }, // ӆ
-    { 18, 29, 22, 2, 21, 131, 52194 }, // Ӈ
-    { 16, 24, 19, 2, 16, 96, 52325 }, // ӈ
-    { 23, 28, 25, 2, 21, 161, 52421 }, // Ӊ
-    { 20, 22, 22, 2, 16, 110, 52582 }, // ӊ
-    { 18, 28, 21, 1, 21, 126, 52692 }, // Ӌ
-    { 16, 22, 19, 1, 16, 88, 52818 }, // ӌ
-    { 28, 28, 30, 2, 21, 196, 52906 }, // Ӎ
-    { 25, 22, 27, 2, 16, 138, 53102 }, // ӎ
-    { 11, 21, 11, 0, 21, 58, 53240 }, // ӏ
-    { 21, 28, 20, 0, 28, 147, 53298 }, // Ӑ
-    { 15, 24, 17, 1, 23, 90, 53445 }, // ӑ
-    { 21, 27, 20, 0, 27, 142, 53535 }, // Ӓ
-    { 15, 23, 17, 1, 22, 87, 53677 }, // ӓ
-    { 27, 21, 28, 0, 21, 142, 53764 }, // Ӕ
-    { 25, 18, 27, 1, 17, 113, 53906 }, // ӕ
-    { 13, 28, 16, 2, 28, 91, 54019 }, // Ӗ
-    { 16, 24, 17, 1, 23, 96, 54110 }, // ӗ
-    { 21, 23, 24, 2, 22, 121, 54206 }, // Ә
-    { 16, 18, 17, 1, 17, 72, 54327 }, // ә
-    { 21, 28, 24, 2, 27, 147, 54399 }, // Ӛ
-    { 16, 23, 17, 1, 22, 92, 54546 }, // ӛ
-    { 29, 27, 29, 0, 27, 196, 54638 }, // Ӝ
-    { 26, 22, 25, 0, 22, 143, 54834 }, // ӝ
-    { 15, 28, 17, 1, 27, 105, 54977 }, // Ӟ
-    { 14, 23, 15, 0, 22, 81, 55082 }, // ӟ
-    { 17, 22, 17, 0, 21, 94, 55163 }, // Ӡ
-    { 16, 23, 17, 0, 16, 92, 55257 }, // ӡ
-    { 19, 26, 23, 2, 26, 124, 55349 }, // Ӣ
-    { 16, 21, 20, 2, 21, 84, 55473 }, // ӣ
-    { 19, 27, 23, 2, 27, 129, 55557 }, // Ӥ
-    { 16, 22, 20, 2, 22, 88, 55686 }, // ӥ
-    { 21, 28, 23, 1, 27, 147, 55774 }, // Ӧ
-    { 16, 23, 18, 1, 22, 92, 55921 }, // ӧ
-    { 21, 23, 23, 1, 22, 121, 56013 }, // Ө
-    { 16, 18, 18, 1, 17, 72, 56134 }, // ө
-    { 21, 28, 23, 1, 27, 147, 56206 }, // Ӫ
-    { 16, 23, 18, 1, 22, 92, 56353 }, // ӫ
-    { 17, 28, 19, 1, 27, 119, 56445 }, // Ӭ
-    { 14, 23, 15, 1, 22, 81, 56564 }, // ӭ
-    { 19, 27, 19, 0, 26, 129, 56645 }, // Ӯ
-    { 18, 28, 17, -1, 21, 126, 56774 }, // ӯ
-    { 19, 28, 19, 0, 27, 133, 56900 }, // Ӱ
-    { 18, 29, 17, -1, 22, 131, 57033 }, // ӱ
-    { 19, 29, 19, 0, 28, 138, 57164 }, // Ӳ
-    { 17, 30, 17, 0, 23, 128, 57302 }, // ӳ
-    { 17, 27, 21, 2, 27, 115, 57430 }, // Ӵ
-    { 16, 22, 19, 1, 22, 88, 57545 }, // ӵ
-    { 14, 28, 16, 2, 21, 98, 57633 }, // Ӷ
-    { 12, 22, 14, 2, 16, 66, 57731 }, // ӷ
-    { 23, 27, 27, 2, 27, 156, 57797 }, // Ӹ
-    { 21, 22, 25, 2, 22, 116, 57953 }, // ӹ
-    { 16, 29, 16, 0, 21, 116, 58069 }, // Ӻ
-    { 14, 23, 14, 0, 16, 81, 58185 }, // ӻ
-    { 21, 29, 21, 0, 21, 153, 58266 }, // Ӽ
-    { 18, 23, 19, 0, 16, 104, 58419 }, // ӽ
-    { 20, 21, 20, 0, 21, 105, 58523 }, // Ӿ
-    { 17, 16, 17, 0, 16, 68, 58628 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 58696 }, //  
-    { 0, 0, 29, 0, 0, 0, 58696 }, //  
-    { 0, 0, 15, 0, 0, 0, 58696 }, //  
-    { 0, 0, 29, 0, 0, 0, 58696 }, //  
-    { 0, 0, 10, 0, 0, 0, 58696 }, //  
-    { 0, 0, 7, 0, 0, 0, 58696 }, //  
-    { 0, 0, 5, 0, 0, 0, 58696 }, //  
-    { 0, 0, 17, 0, 0, 0, 58696 }, //  
-    { 0, 0, 8, 0, 0, 0, 58696 }, //  
-    { 0, 0, 5, 0, 0, 0, 58696 }, //  
-    { 0, 0, 3, 0, 0, 0, 58696 }, //  
-    { 0, 0, 0, 0, 0, 0, 58696 }, // ​
-    { 0, 0, 0, 0, 0, 0, 58696 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 58696 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 58696 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 58746 }, // ‏
-    { 9, 4, 9, 0, 10, 9, 58796 }, // ‐
-    { 9, 4, 9, 0, 10, 9, 58805 }, // ‑
-    { 15, 4, 17, 1, 12, 15, 58814 }, // ‒
-    { 13, 4, 15, 1, 10, 13, 58829 }, // –
-    { 28, 4, 29, 1, 10, 28, 58842 }, // —
-    { 28, 4, 29, 1, 10, 28, 58870 }, // ―
-    { 12, 30, 16, 2, 23, 90, 58898 }, // ‖
-    { 14, 7, 12, -1, 0, 25, 58988 }, // ‗
-    { 6, 8, 6, 0, 21, 12, 59013 }, // ‘
-    { 6, 8, 6, 0, 21, 12, 59025 }, // ’
-    { 7, 8, 8, 0, 4, 14, 59037 }, // ‚
-    { 6, 8, 6, 0, 21, 12, 59051 }, // ‛
-    { 13, 8, 13, 0, 21, 26, 59063 }, // “
-    { 13, 8, 13, 0, 21, 26, 59089 }, // ”
-    { 14, 8, 15, 0, 4, 28, 59115 }, // „
-    { 13, 8, 13, 0, 21, 26, 59143 }, // ‟
-    { 13, 23, 15, 1, 23, 75, 59169 }, // †
-    { 13, 23, 15, 1, 23, 75, 59244 }, // ‡
-    { 9, 10, 11, 1, 16, 23, 59319 }, // •
-    { 10, 12, 11, 1, 17, 30, 59342 }, // ‣
-    { 6, 6, 15, 4, 5, 9, 59372 }, // ․
-    { 15, 6, 17, 1, 5, 23, 59381 }, // ‥
-    { 23, 6, 25, 1, 5, 35, 59404 }, // …
-    { 6, 6, 8, 1, 11, 9, 59439 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 59448 }, //  
-    { 0, 0, 18, 0, 0, 0, 59448 }, //  
-    { 8, 22, 0, -1, 18, 44, 59448 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 59492 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 59536 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 59586 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 59636 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 59686 }, //  
-    { 37, 23, 37, 0, 22, 213, 59686 }, // ‰
-    { 48, 23, 49, 0, 22, 276, 59899 }, // ‱
-    { 9, 8, 9, 1, 21, 18, 60175 }, // ′
-    { 15, 8, 15, 1, 21, 30, 60193 }, // ″
-    { 21, 8, 22, 1, 21, 42, 60223 }, // ‴
-    { 9, 8, 12, 1, 21, 18, 60265 }, // ‵
-    { 15, 8, 19, 1, 21, 30, 60283 }, // ‶
-    { 22, 8, 25, 1, 21, 44, 60313 }, // ‷
-    { 12, 10, 12, 0, 3, 30, 60357 }, // ‸
-    { 9, 14, 11, 1, 15, 32, 60387 }, // ‹
-    { 9, 14, 11, 1, 15, 32, 60419 }, // ›
-    { 23, 23, 25, 1, 22, 133, 60451 }, // ※
-    { 14, 22, 17, 1, 21, 77, 60584 }, // ‼
-    { 14, 23, 14, 0, 22, 81, 60661 }, // ‽
-    { 16, 4, 15, -1, 26, 16, 60742 }, // ‾
-    { 18, 7, 18, 0, 0, 32, 60758 }, // ‿
-    { 18, 8, 18, 0, 24, 36, 60790 }, // ⁀
-    { 12, 19, 12, 0, 12, 57, 60826 }, // ⁁
-    { 33, 28, 33, 0, 23, 231, 60883 }, // ⁂
-    { 9, 4, 9, 1, 10, 9, 61114 }, // ⁃
-    { 16, 21, 4, -6, 21, 84, 61123 }, // ⁄
-    { 7, 26, 10, 2, 21, 46, 61207 }, // ⁅
-    { 8, 26, 10, 0, 21, 52, 61253 }, // ⁆
-    { 28, 23, 28, 0, 22, 161, 61305 }, // ⁇
-    { 21, 23, 22, 0, 22, 121, 61466 }, // ⁈
-    { 21, 23, 22, 1, 22, 121, 61587 }, // ⁉
-    { 15, 16, 17, 1, 16, 60, 61708 }, // ⁊
-    { 16, 27, 19, 2, 23, 108, 61768 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 61876 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 61936 }, // ⁍
-    { 15, 15, 16, 0, 8, 57, 61996 }, // ⁎
-    { 7, 21, 8, 1, 17, 37, 62053 }, // ⁏
-    { 18, 31, 18, 0, 24, 140, 62090 }, // ⁐
-    { 15, 30, 16, 0, 23, 113, 62230 }, // ⁑
-    { 13, 23, 12, 0, 22, 75, 62343 }, // ⁒
-    { 28, 6, 29, 1, 11, 42, 62418 }, // ⁓
-    { 18, 7, 18, 0, 0, 32, 62460 }, // ⁔
-    { 16, 15, 16, 0, 15, 60, 62492 }, // ⁕
-    { 15, 23, 17, 1, 22, 87, 62552 }, // ⁖
-    { 27, 8, 27, 1, 21, 54, 62639 }, // ⁗
-    { 23, 23, 25, 1, 22, 133, 62693 }, // ⁘
-    { 23, 23, 25, 1, 22, 133, 62826 }, // ⁙
-    { 6, 23, 8, 1, 22, 35, 62959 }, // ⁚
-    { 18, 24, 20, 1, 23, 108, 62994 }, // ⁛
-    { 23, 23, 25, 1, 22, 133, 63102 }, // ⁜
-    { 6, 24, 8, 1, 23, 36, 63235 }, // ⁝
-    { 6, 23, 8, 1, 22, 35, 63271 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 63306 }, //  
-    { 0, 0, 18, 0, 0, 0, 63306 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 63306 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 63306 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 63306 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 63306 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 63306 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 63306 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 63306 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 63306 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 63306 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 63356 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 63406 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 63456 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 63506 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 63556 }, // ⁯
-    { 11, 14, 11, 0, 25, 39, 63606 }, // ⁰
-    { 4, 14, 6, 1, 22, 14, 63645 }, // ⁱ
-    { 11, 13, 11, 0, 25, 36, 63659 }, // ⁴
-    { 10, 14, 11, 1, 25, 35, 63695 }, // ⁵
-    { 11, 14, 11, 0, 25, 39, 63730 }, // ⁶
-    { 11, 13, 11, 0, 25, 36, 63769 }, // ⁷
-    { 11, 14, 11, 0, 25, 39, 63805 }, // ⁸
-    { 11, 14, 11, 0, 25, 39, 63844 }, // ⁹
-    { 9, 9, 10, 1, 22, 21, 63883 }, // ⁺
-    { 9, 3, 10, 1, 19, 7, 63904 }, // ⁻
-    { 9, 7, 10, 1, 21, 16, 63911 }, // ⁼
-    { 6, 17, 7, 1, 27, 26, 63927 }, // ⁽
-    { 6, 17, 7, 0, 27, 26, 63953 }, // ⁾
-    { 10, 11, 12, 1, 19, 28, 63979 }, // ⁿ
-    { 11, 14, 11, 0, 9, 39, 64007 }, // ₀
-    { 9, 13, 11, 0, 9, 30, 64046 }, // ₁
-    { 10, 13, 11, 0, 9, 33, 64076 }, // ₂
-    { 11, 14, 11, 0, 9, 39, 64109 }, // ₃
-    { 11, 13, 11, 0, 9, 36, 64148 }, // ₄
-    { 10, 14, 11, 1, 9, 35, 64184 }, // ₅
-    { 11, 14, 11, 0, 9, 39, 64219 }, // ₆
-    { 11, 13, 11, 0, 9, 36, 64258 }, // ₇
-    { 11, 14, 11, 0, 9, 39, 64294 }, // ₈
-    { 11, 14, 11, 0, 9, 39, 64333 }, // ₉
-    { 9, 9, 10, 1, 7, 21, 64372 }, // ₊
-    { 9, 3, 10, 1, 4, 7, 64393 }, // ₋
-    { 9, 7, 10, 1, 6, 16, 64400 }, // ₌
-    { 6, 17, 7, 1, 11, 26, 64416 }, // ₍
-    { 6, 17, 7, 0, 11, 26, 64442 }, // ₎
-    { 10, 10, 11, 0, 7, 25, 64468 }, // ₐ
-    { 11, 10, 11, 0, 7, 28, 64493 }, // ₑ
-    { 11, 10, 12, 0, 7, 28, 64521 }, // ₒ
-    { 11, 10, 11, 0, 7, 28, 64549 }, // ₓ
-    { 11, 10, 11, 0, 7, 28, 64577 }, // ₔ
-    { 10, 14, 12, 1, 11, 35, 64605 }, // ₕ
-    { 11, 14, 12, 1, 11, 39, 64640 }, // ₖ
-    { 4, 14, 6, 1, 11, 14, 64679 }, // ₗ
-    { 17, 10, 19, 1, 7, 43, 64693 }, // ₘ
-    { 10, 10, 12, 1, 7, 25, 64736 }, // ₙ
-    { 11, 14, 12, 1, 7, 39, 64761 }, // ₚ
-    { 9, 10, 10, 0, 7, 23, 64800 }, // ₛ
-    { 8, 12, 8, 0, 9, 24, 64823 }, // ₜ
-    { 17, 22, 17, 0, 22, 94, 64847 }, // ₠
-    { 18, 25, 18, 0, 23, 113, 64941 }, // ₡
-    { 16, 23, 17, 1, 22, 92, 65054 }, // ₢
-    { 16, 21, 17, 0, 21, 84, 65146 }, // ₣
-    { 16, 22, 17, 1, 22, 88, 65230 }, // ₤
-    { 25, 24, 28, 2, 20, 150, 65318 }, // ₥
-    { 17, 21, 17, 0, 21, 90, 65468 }, // ₦
-    { 23, 22, 26, 2, 21, 127, 65558 }, // ₧
-    { 24, 22, 27, 2, 21, 132, 65685 }, // ₨
-    { 22, 21, 22, 0, 21, 116, 65817 }, // ₩
-    { 23, 21, 27, 2, 21, 121, 65933 }, // ₪
-    { 18, 28, 19, 1, 23, 126, 66054 }, // ₫
-    { 17, 22, 17, 0, 21, 94, 66180 }, // €
-    { 17, 21, 17, 0, 21, 90, 66274 }, // ₭
-    { 17, 21, 17, 0, 21, 90, 66364 }, // ₮
-    { 29, 29, 29, 0, 22, 211, 66454 }, // ₯
-    { 17, 29, 18, 0, 22, 124, 66665 }, // ₰
-    { 17, 21, 17, 0, 21, 90, 66789 }, // ₱
-    { 18, 26, 21, 1, 23, 117, 66879 }, // ₲
-    { 19, 21, 19, 0, 21, 100, 66996 }, // ₳
-    { 17, 23, 17, 0, 22, 98, 67096 }, // ₴
-    { 17, 26, 19, 1, 23, 111, 67194 }, // ₵
-    { 20, 21, 20, 0, 20, 105, 67305 }, // ₶
-    { 21, 25, 21, 0, 22, 132, 67410 }, // ₷
-    { 17, 21, 17, 0, 21, 90, 67542 }, // ₸
-    { 15, 21, 17, 1, 21, 79, 67632 }, // ₹
-    { 16, 22, 17, 0, 21, 88, 67711 }, // ₺
-    { 24, 23, 24, 0, 22, 138, 67799 }, // ₻
-    { 24, 21, 26, 1, 21, 126, 67937 }, // ₼
-    { 17, 21, 18, 0, 21, 90, 68063 }, // ₽
-    { 21, 23, 23, 1, 23, 121, 68153 }, // ₾
-    { 14, 27, 17, 2, 24, 95, 68274 }, // ₿
-    { 14, 23, 15, 1, 17, 81, 68369 }, // ⃀
-    { 15, 4, 17, 1, 12, 15, 68450 }, // −
-    { 27, 28, 29, 1, 23, 189, 68465 }, // �
+    { 24, 24, 26, 1, 21, 144, 2048 }, // @
+    { 21, 21, 20, 0, 21, 111, 2192 }, // A
+    { 16, 21, 19, 2, 21, 84, 2303 }, // B
+    { 17, 23, 19, 1, 22, 98, 2387 }, // C
+    { 18, 21, 21, 2, 21, 95, 2485 }, // D
+    { 13, 21, 16, 2, 21, 69, 2580 }, // E
+    { 13, 21, 16, 2, 21, 69, 2649 }, // F
+    { 18, 23, 21, 1, 22, 104, 2718 }, // G
+    { 18, 21, 22, 2, 21, 95, 2822 }, // H
+    { 11, 21, 11, 0, 21, 58, 2917 }, // I
+    { 11, 28, 10, -3, 21, 77, 2975 }, // J
+    { 18, 21, 19, 2, 21, 95, 3052 }, // K
+    { 14, 21, 16, 2, 21, 74, 3147 }, // L
+    { 23, 21, 28, 2, 21, 121, 3221 }, // M
+    { 20, 21, 24, 2, 21, 105, 3342 }, // N
+    { 21, 23, 23, 1, 22, 121, 3447 }, // O
+    { 15, 21, 18, 2, 21, 79, 3568 }, // P
+    { 21, 27, 23, 1, 22, 142, 3647 }, // Q
+    { 18, 21, 19, 2, 21, 95, 3789 }, // R
+    { 14, 23, 16, 1, 22, 81, 3884 }, // S
+    { 17, 21, 17, 0, 21, 90, 3965 }, // T
+    { 18, 22, 22, 2, 21, 99, 4096 }, // U
+    { 19, 21, 19, 0, 21, 100, 4195 }, // V
+    { 29, 21, 28, 0, 21, 153, 4295 }, // W
+    { 20, 21, 20, 0, 21, 105, 4448 }, // X
+    { 19, 21, 18, 0, 21, 100, 4553 }, // Y
+    { 17, 21, 17, 0, 21, 90, 4653 }, // Z
+    { 7, 26, 10, 2, 21, 46, 4743 }, // [
+    { 12, 22, 12, 0, 21, 66, 4789 }, // <backslash>
+    { 8, 26, 10, 0, 21, 52, 4855 }, // ]
+    { 17, 14, 17, 0, 21, 60, 4907 }, // ^
+    { 14, 3, 12, -1, -2, 11, 4967 }, // _
+    { 9, 6, 11, 1, 23, 14, 4978 }, // `
+    { 15, 18, 17, 1, 17, 68, 4992 }, // a
+    { 16, 24, 18, 2, 23, 96, 5060 }, // b
+    { 14, 18, 15, 1, 17, 63, 5156 }, // c
+    { 16, 24, 18, 1, 23, 96, 5219 }, // d
+    { 16, 18, 17, 1, 17, 72, 5315 }, // e
+    { 13, 23, 11, 0, 23, 75, 5387 }, // f
+    { 16, 24, 18, 1, 17, 96, 5462 }, // g
+    { 15, 23, 19, 2, 23, 87, 5558 }, // h
+    { 6, 23, 9, 1, 23, 35, 5645 }, // i
+    { 9, 30, 9, -2, 23, 68, 5680 }, // j
+    { 17, 23, 18, 2, 23, 98, 5748 }, // k
+    { 5, 23, 9, 2, 23, 29, 5846 }, // l
+    { 25, 17, 28, 2, 17, 107, 5875 }, // m
+    { 15, 17, 19, 2, 17, 64, 5982 }, // n
+    { 16, 18, 18, 1, 17, 72, 6046 }, // o
+    { 16, 24, 18, 2, 17, 96, 6144 }, // p
+    { 16, 24, 18, 1, 17, 96, 6240 }, // q
+    { 11, 17, 13, 2, 17, 47, 6336 }, // r
+    { 13, 18, 15, 1, 17, 59, 6383 }, // s
+    { 12, 21, 13, 0, 20, 63, 6442 }, // t
+    { 15, 17, 19, 2, 16, 64, 6505 }, // u
+    { 17, 16, 17, 0, 16, 68, 6569 }, // v
+    { 25, 16, 25, 0, 16, 100, 6637 }, // w
+    { 17, 16, 17, 0, 16, 68, 6737 }, // x
+    { 17, 23, 17, 0, 16, 98, 6805 }, // y
+    { 14, 16, 14, 0, 16, 56, 6903 }, // z
+    { 11, 26, 12, 0, 21, 72, 6959 }, // {
+    { 4, 30, 16, 6, 23, 30, 7031 }, // |
+    { 11, 26, 12, 1, 21, 72, 7061 }, // }
+    { 15, 6, 17, 1, 13, 23, 7133 }, // ~
+    { 0, 0, 8, 0, 0, 0, 7156 }, //  
+    { 6, 22, 8, 1, 16, 33, 7156 }, // ¡
+    { 13, 23, 17, 2, 22, 75, 7189 }, // ¢
+    { 16, 22, 17, 1, 22, 88, 7264 }, // £
+    { 14, 14, 17, 1, 17, 49, 7352 }, // ¤
+    { 17, 21, 17, 0, 21, 90, 7401 }, // ¥
+    { 4, 30, 16, 6, 23, 30, 7491 }, // ¦
+    { 12, 24, 14, 1, 23, 72, 7521 }, // §
+    { 11, 4, 17, 3, 22, 11, 7593 }, // ¨
+    { 22, 23, 24, 1, 22, 127, 7604 }, // ©
+    { 10, 12, 11, 0, 22, 30, 7731 }, // ª
+    { 16, 14, 18, 1, 15, 56, 7761 }, // «
+    { 15, 9, 17, 1, 12, 34, 7817 }, // ¬
+    { 9, 4, 9, 0, 10, 9, 7851 }, // ­
+    { 22, 23, 24, 1, 22, 127, 7860 }, // ®
+    { 16, 4, 15, -1, 26, 16, 7987 }, // ¯
+    { 11, 11, 12, 1, 22, 31, 8003 }, // °
+    { 15, 19, 17, 1, 19, 72, 8034 }, // ±
+    { 10, 13, 11, 0, 25, 33, 8106 }, // ²
+    { 11, 14, 11, 0, 25, 39, 8139 }, // ³
+    { 9, 6, 11, 1, 23, 14, 8178 }, // ´
+    { 15, 23, 19, 2, 16, 87, 8192 }, // µ
+    { 16, 27, 19, 1, 23, 108, 8279 }, // ¶
+    { 6, 6, 8, 1, 13, 9, 8387 }, // ·
+    { 8, 7, 8, 0, 0, 14, 8396 }, // ¸
+    { 9, 13, 11, 0, 25, 30, 8410 }, // ¹
+    { 11, 12, 11, 0, 22, 33, 8440 }, // º
+    { 16, 14, 18, 1, 15, 56, 8473 }, // »
+    { 24, 21, 24, 0, 21, 126, 8529 }, // ¼
+    { 25, 21, 26, 0, 21, 132, 8655 }, // ½
+    { 24, 22, 25, 1, 22, 132, 8787 }, // ¾
+    { 14, 23, 14, 0, 17, 81, 8919 }, // ¿
+    { 21, 28, 20, 0, 28, 147, 9000 }, // À
+    { 21, 28, 20, 0, 28, 147, 9147 }, // Á
+    { 21, 28, 20, 0, 28, 147, 9294 }, // Â
+    { 21, 28, 20, 0, 28, 147, 9441 }, // Ã
+    { 21, 27, 20, 0, 27, 142, 9588 }, // Ä
+    { 21, 26, 20, 0, 26, 137, 9730 }, // Å
+    { 27, 21, 28, 0, 21, 142, 9867 }, // Æ
+    { 17, 29, 19, 1, 22, 124, 10009 }, // Ç
+    { 13, 28, 16, 2, 28, 91, 10133 }, // È
+    { 13, 28, 16, 2, 28, 91, 10240 }, // É
+    { 13, 28, 16, 2, 28, 91, 10331 }, // Ê
+    { 13, 27, 16, 2, 27, 88, 10422 }, // Ë
+    { 11, 28, 11, 0, 28, 77, 10510 }, // Ì
+    { 11, 28, 11, 0, 28, 77, 10587 }, // Í
+    { 13, 28, 11, -1, 28, 91, 10664 }, // Î
+    { 11, 27, 11, 0, 27, 75, 10755 }, // Ï
+    { 20, 21, 21, 0, 21, 105, 10830 }, // Ð
+    { 20, 28, 24, 2, 28, 140, 10935 }, // Ñ
+    { 21, 29, 23, 1, 28, 153, 11075 }, // Ò
+    { 21, 29, 23, 1, 28, 153, 11228 }, // Ó
+    { 21, 29, 23, 1, 28, 153, 11381 }, // Ô
+    { 21, 29, 23, 1, 28, 153, 11534 }, // Õ
+    { 21, 28, 23, 1, 27, 147, 11687 }, // Ö
+    { 14, 14, 17, 1, 17, 49, 11834 }, // ×
+    { 21, 24, 23, 1, 22, 126, 11883 }, // Ø
+    { 18, 29, 22, 2, 28, 131, 12009 }, // Ù
+    { 18, 29, 22, 2, 28, 131, 12140 }, // Ú
+    { 18, 29, 22, 2, 28, 131, 12288 }, // Û
+    { 18, 28, 22, 2, 27, 126, 12419 }, // Ü
+    { 19, 28, 18, 0, 28, 133, 12545 }, // Ý
+    { 15, 21, 18, 2, 21, 79, 12678 }, // Þ
+    { 18, 24, 21, 2, 23, 108, 12757 }, // ß
+    { 15, 24, 17, 1, 23, 90, 12865 }, // à
+    { 15, 24, 17, 1, 23, 90, 12955 }, // á
+    { 15, 24, 17, 1, 23, 90, 13045 }, // â
+    { 15, 24, 17, 1, 23, 90, 13135 }, // ã
+    { 15, 23, 17, 1, 22, 87, 13225 }, // ä
+    { 15, 26, 17, 1, 25, 98, 13312 }, // å
+    { 25, 18, 27, 1, 17, 113, 13410 }, // æ
+    { 14, 24, 15, 1, 17, 84, 13523 }, // ç
+    { 16, 24, 17, 1, 23, 96, 13607 }, // è
+    { 16, 24, 17, 1, 23, 96, 13703 }, // é
+    { 16, 24, 17, 1, 23, 96, 13799 }, // ê
+    { 16, 23, 17, 1, 22, 92, 13895 }, // ë
+    { 10, 23, 9, -1, 23, 58, 13987 }, // ì
+    { 9, 23, 9, 2, 23, 52, 14045 }, // í
+    { 13, 23, 9, -2, 23, 75, 14097 }, // î
+    { 11, 22, 9, -1, 22, 61, 14172 }, // ï
+    { 16, 24, 18, 1, 23, 96, 14233 }, // ð
+    { 15, 23, 19, 2, 23, 87, 14336 }, // ñ
+    { 16, 24, 18, 1, 23, 96, 14423 }, // ò
+    { 16, 24, 18, 1, 23, 96, 14519 }, // ó
+    { 16, 24, 18, 1, 23, 96, 14615 }, // ô
+    { 16, 24, 18, 1, 23, 96, 14711 }, // õ
+    { 16, 23, 18, 1, 22, 92, 14807 }, // ö
+    { 15, 15, 17, 1, 18, 57, 14899 }, // ÷
+    { 16, 19, 18, 1, 17, 76, 14956 }, // ø
+    { 15, 24, 19, 2, 23, 90, 15032 }, // ù
+    { 15, 24, 19, 2, 23, 90, 15122 }, // ú
+    { 15, 24, 19, 2, 23, 90, 15212 }, // û
+    { 15, 23, 19, 2, 22, 87, 15302 }, // ü
+    { 17, 30, 17, 0, 23, 128, 15389 }, // ý
+    { 16, 30, 18, 2, 23, 120, 15517 }, // þ
+    { 17, 29, 17, 0, 22, 124, 15637 }, // ÿ
+    { 21, 26, 20, 0, 26, 137, 15761 }, // Ā
+    { 15, 22, 17, 1, 21, 83, 15898 }, // ā
+    { 21, 28, 20, 0, 28, 147, 15981 }, // Ă
+    { 15, 24, 17, 1, 23, 90, 16128 }, // ă
+    { 21, 28, 20, 0, 21, 147, 16218 }, // Ą
+    { 15, 24, 17, 1, 17, 90, 16384 }, // ą
+    { 17, 29, 19, 1, 28, 124, 16474 }, // Ć
+    { 14, 24, 15, 1, 23, 84, 16598 }, // ć
+    { 17, 29, 19, 1, 28, 124, 16682 }, // Ĉ
+    { 14, 24, 15, 1, 23, 84, 16806 }, // ĉ
+    { 17, 29, 19, 1, 28, 124, 16890 }, // Ċ
+    { 14, 24, 15, 1, 23, 84, 17014 }, // ċ
+    { 17, 29, 19, 1, 28, 124, 17098 }, // Č
+    { 14, 24, 15, 1, 23, 84, 17222 }, // č
+    { 18, 28, 21, 2, 28, 126, 17306 }, // Ď
+    { 22, 24, 18, 1, 23, 132, 17432 }, // ď
+    { 20, 21, 21, 0, 21, 105, 17564 }, // Đ
+    { 18, 24, 19, 1, 23, 108, 17669 }, // đ
+    { 13, 26, 16, 2, 26, 85, 17777 }, // Ē
+    { 16, 22, 17, 1, 21, 88, 17862 }, // ē
+    { 13, 28, 16, 2, 28, 91, 17950 }, // Ĕ
+    { 16, 24, 17, 1, 23, 96, 18041 }, // ĕ
+    { 13, 28, 16, 2, 28, 91, 18137 }, // Ė
+    { 16, 24, 17, 1, 23, 96, 18228 }, // ė
+    { 13, 28, 16, 2, 21, 91, 18324 }, // Ę
+    { 16, 24, 17, 1, 17, 96, 18432 }, // ę
+    { 14, 28, 16, 2, 28, 98, 18528 }, // Ě
+    { 16, 24, 17, 1, 23, 96, 18626 }, // ě
+    { 18, 29, 21, 1, 28, 131, 18722 }, // Ĝ
+    { 16, 30, 18, 1, 23, 120, 18853 }, // ĝ
+    { 18, 29, 21, 1, 28, 131, 18973 }, // Ğ
+    { 16, 30, 18, 1, 23, 120, 19104 }, // ğ
+    { 18, 29, 21, 1, 28, 131, 19224 }, // Ġ
+    { 16, 30, 18, 1, 23, 120, 19355 }, // ġ
+    { 18, 29, 21, 1, 22, 131, 19475 }, // Ģ
+    { 16, 30, 18, 1, 23, 120, 19606 }, // ģ
+    { 18, 28, 22, 2, 28, 126, 19726 }, // Ĥ
+    { 19, 29, 19, -2, 29, 138, 19852 }, // ĥ
+    { 23, 21, 22, 0, 21, 121, 19990 }, // Ħ
+    { 17, 23, 19, 0, 23, 98, 20111 }, // ħ
+    { 12, 28, 11, -1, 28, 84, 20209 }, // Ĩ
+    { 13, 23, 9, -2, 23, 75, 20293 }, // ĩ
+    { 11, 26, 11, 0, 26, 72, 20368 }, // Ī
+    { 11, 21, 9, -1, 21, 58, 20480 }, // ī
+    { 12, 28, 11, 0, 28, 84, 20538 }, // Ĭ
+    { 12, 23, 9, -1, 23, 69, 20622 }, // ĭ
+    { 11, 28, 11, 0, 21, 77, 20691 }, // Į
+    { 6, 30, 9, 1, 23, 45, 20768 }, // į
+    { 11, 28, 11, 0, 28, 77, 20813 }, // İ
+    { 5, 16, 9, 2, 16, 20, 20890 }, // ı
+    { 19, 28, 21, 0, 21, 133, 20910 }, // Ĳ
+    { 15, 30, 18, 1, 23, 113, 21043 }, // ĳ
+    { 14, 35, 10, -3, 28, 123, 21156 }, // Ĵ
+    { 13, 30, 9, -2, 23, 98, 21279 }, // ĵ
+    { 18, 28, 19, 2, 21, 126, 21377 }, // Ķ
+    { 17, 30, 18, 2, 23, 128, 21503 }, // ķ
+    { 17, 16, 18, 2, 16, 68, 21631 }, // ĸ
+    { 14, 28, 16, 2, 28, 98, 21699 }, // Ĺ
+    { 10, 29, 9, 1, 29, 73, 21797 }, // ĺ
+    { 14, 28, 16, 2, 21, 98, 21870 }, // Ļ
+    { 6, 30, 9, 1, 23, 45, 21968 }, // ļ
+    { 15, 21, 16, 2, 21, 79, 22013 }, // Ľ
+    { 11, 23, 9, 2, 23, 64, 22092 }, // ľ
+    { 14, 21, 16, 2, 21, 74, 22156 }, // Ŀ
+    { 11, 23, 11, 2, 23, 64, 22230 }, // ŀ
+    { 16, 21, 16, 0, 21, 84, 22294 }, // Ł
+    { 11, 23, 9, -1, 23, 64, 22378 }, // ł
+    { 20, 28, 24, 2, 28, 140, 22528 }, // Ń
+    { 15, 23, 19, 2, 23, 87, 22668 }, // ń
+    { 20, 28, 24, 2, 21, 140, 22755 }, // Ņ
+    { 15, 24, 19, 2, 17, 90, 22895 }, // ņ
+    { 20, 28, 24, 2, 28, 140, 22985 }, // Ň
+    { 15, 23, 19, 2, 23, 87, 23125 }, // ň
+    { 22, 21, 23, -1, 21, 116, 23212 }, // ŉ
+    { 20, 28, 24, 2, 21, 140, 23328 }, // Ŋ
+    { 15, 24, 19, 2, 17, 90, 23468 }, // ŋ
+    { 21, 27, 23, 1, 26, 142, 23558 }, // Ō
+    { 16, 22, 18, 1, 21, 88, 23700 }, // ō
+    { 21, 29, 23, 1, 28, 153, 23788 }, // Ŏ
+    { 16, 24, 18, 1, 23, 96, 23941 }, // ŏ
+    { 21, 29, 23, 1, 28, 153, 24037 }, // Ő
+    { 16, 24, 18, 1, 23, 96, 24190 }, // ő
+    { 26, 23, 28, 1, 22, 150, 24286 }, // Œ
+    { 27, 18, 29, 1, 17, 122, 24436 }, // œ
+    { 18, 28, 19, 2, 28, 126, 24576 }, // Ŕ
+    { 12, 23, 13, 2, 23, 69, 24702 }, // ŕ
+    { 18, 28, 19, 2, 21, 126, 24771 }, // Ŗ
+    { 12, 24, 13, 1, 17, 72, 24897 }, // ŗ
+    { 18, 28, 19, 2, 28, 126, 24969 }, // Ř
+    { 13, 23, 13, 1, 23, 75, 25095 }, // ř
+    { 14, 29, 16, 1, 28, 102, 25170 }, // Ś
+    { 13, 24, 15, 1, 23, 78, 25272 }, // ś
+    { 14, 29, 16, 1, 28, 102, 25350 }, // Ŝ
+    { 13, 24, 15, 1, 23, 78, 25452 }, // ŝ
+    { 14, 29, 16, 1, 22, 102, 25530 }, // Ş
+    { 13, 24, 15, 1, 17, 78, 25632 }, // ş
+    { 14, 29, 16, 1, 28, 102, 25710 }, // Š
+    { 13, 24, 15, 1, 23, 78, 25812 }, // š
+    { 17, 28, 17, 0, 21, 119, 25890 }, // Ţ
+    { 12, 27, 13, 0, 20, 81, 26009 }, // ţ
+    { 17, 28, 17, 0, 28, 119, 26090 }, // Ť
+    { 17, 24, 13, 0, 23, 102, 26209 }, // ť
+    { 17, 21, 17, 0, 21, 90, 26311 }, // Ŧ
+    { 12, 21, 13, 0, 20, 63, 26401 }, // ŧ
+    { 18, 29, 22, 2, 28, 131, 26464 }, // Ũ
+    { 15, 24, 19, 2, 23, 90, 26624 }, // ũ
+    { 18, 27, 22, 2, 26, 122, 26714 }, // Ū
+    { 15, 22, 19, 2, 21, 83, 26836 }, // ū
+    { 18, 29, 22, 2, 28, 131, 26919 }, // Ŭ
+    { 15, 24, 19, 2, 23, 90, 27050 }, // ŭ
+    { 18, 31, 22, 2, 30, 140, 27140 }, // Ů
+    { 15, 26, 19, 2, 25, 98, 27280 }, // ů
+    { 18, 29, 22, 2, 28, 131, 27378 }, // Ű
+    { 15, 24, 19, 2, 23, 90, 27509 }, // ű
+    { 18, 28, 22, 2, 21, 126, 27599 }, // Ų
+    { 15, 23, 19, 2, 16, 87, 27725 }, // ų
+    { 29, 28, 28, 0, 28, 203, 27812 }, // Ŵ
+    { 25, 23, 25, 0, 23, 144, 28015 }, // ŵ
+    { 19, 28, 18, 0, 28, 133, 28159 }, // Ŷ
+    { 17, 30, 17, 0, 23, 128, 28292 }, // ŷ
+    { 19, 27, 18, 0, 27, 129, 28420 }, // Ÿ
+    { 17, 28, 17, 0, 28, 119, 28549 }, // Ź
+    { 14, 23, 14, 0, 23, 81, 28672 }, // ź
+    { 17, 28, 17, 0, 28, 119, 28753 }, // Ż
+    { 14, 23, 14, 0, 23, 81, 28872 }, // ż
+    { 17, 28, 17, 0, 28, 119, 28953 }, // Ž
+    { 14, 23, 14, 0, 23, 81, 29072 }, // ž
+    { 10, 23, 11, 2, 23, 58, 29153 }, // ſ
+    { 9, 6, 0, -16, 23, 14, 29211 }, // ̀
+    { 9, 6, 0, -11, 23, 14, 29225 }, // ́
+    { 12, 6, 0, -6, 23, 18, 29239 }, // ̂
+    { 12, 6, 0, -16, 23, 18, 29257 }, // ̃
+    { 10, 4, 0, -5, 21, 10, 29275 }, // ̄
+    { 14, 4, 0, -7, 25, 14, 29285 }, // ̅
+    { 12, 6, 0, -6, 23, 18, 29299 }, // ̆
+    { 6, 6, 0, -3, 23, 9, 29317 }, // ̇
+    { 12, 4, 0, -6, 22, 12, 29326 }, // ̈
+    { 8, 8, 0, -13, 25, 16, 29338 }, // ̉
+    { 8, 8, 0, -4, 25, 16, 29354 }, // ̊
+    { 14, 6, 0, -5, 23, 21, 29370 }, // ̋
+    { 13, 6, 0, -6, 23, 20, 29391 }, // ̌
+    { 4, 6, 0, -2, 23, 6, 29411 }, // ̍
+    { 8, 6, 0, -4, 23, 12, 29417 }, // ̎
+    { 13, 6, 0, -17, 23, 20, 29429 }, // ̏
+    { 12, 8, 0, -6, 25, 24, 29449 }, // ̐
+    { 12, 6, 0, -6, 23, 18, 29473 }, // ̑
+    { 6, 8, 0, -3, 21, 12, 29491 }, // ̒
+    { 6, 8, 0, -3, 21, 12, 29503 }, // ̓
+    { 6, 8, 0, -3, 21, 12, 29515 }, // ̔
+    { 6, 8, 0, -3, 21, 12, 29527 }, // ̕
+    { 9, 6, 0, -5, -1, 14, 29539 }, // ̖
+    { 10, 6, 0, -5, -1, 15, 29553 }, // ̗
+    { 6, 7, 0, -3, 0, 11, 29568 }, // ̘
+    { 6, 7, 0, -3, 0, 11, 29579 }, // ̙
+    { 8, 8, 9, 0, 23, 16, 29590 }, // ̚
+    { 8, 8, 0, -3, 23, 16, 29606 }, // ̛
+    { 4, 7, 0, -2, 0, 7, 29622 }, // ̜
+    { 8, 6, 0, -4, -1, 12, 29629 }, // ̝
+    { 8, 6, 0, -4, -1, 12, 29641 }, // ̞
+    { 8, 7, 0, -4, 0, 14, 29653 }, // ̟
+    { 7, 3, 0, -4, -3, 6, 29667 }, // ̠
+    { 7, 9, 0, -7, 2, 16, 29673 }, // ̡
+    { 7, 9, 0, 0, 2, 16, 29689 }, // ̢
+    { 6, 6, 0, -13, -1, 9, 29705 }, // ̣
+    { 12, 4, 0, -6, -2, 12, 29714 }, // ̤
+    { 8, 8, 0, -4, 1, 16, 29726 }, // ̥
+    { 6, 6, 0, -3, -1, 9, 29742 }, // ̦
+    { 8, 7, 0, -4, 0, 14, 29751 }, // ̧
+    { 6, 8, 0, -3, 1, 12, 29765 }, // ̨
+    { 4, 6, 0, -2, -1, 6, 29777 }, // ̩
+    { 12, 6, 0, -6, -1, 18, 29783 }, // ̪
+    { 12, 5, 0, -6, -1, 15, 29801 }, // ̫
+    { 13, 6, 0, -6, 0, 20, 29816 }, // ̬
+    { 12, 6, 0, -6, -1, 18, 29836 }, // ̭
+    { 12, 6, 0, -6, -1, 18, 29854 }, // ̮
+    { 12, 6, 0, -6, -1, 18, 29872 }, // ̯
+    { 12, 6, 0, -6, -1, 18, 29890 }, // ̰
+    { 10, 4, 0, -5, -2, 10, 29908 }, // ̱
+    { 14, 3, 0, -7, -2, 11, 29918 }, // ̲
+    { 13, 7, 0, -7, 0, 23, 29929 }, // ̳
+    { 13, 6, 0, -6, 11, 20, 29952 }, // ̴
+    { 14, 4, 0, -7, 10, 14, 29972 }, // ̵
+    { 22, 4, 0, -11, 10, 22, 29986 }, // ̶
+    { 12, 9, 0, -6, 13, 27, 30008 }, // ̷
+    { 14, 25, 0, -7, 23, 88, 30035 }, // ̸
+    { 4, 7, 0, -2, 0, 7, 30123 }, // ̹
+    { 12, 6, 0, -6, -1, 18, 30130 }, // ̺
+    { 12, 7, 0, -6, 0, 21, 30148 }, // ̻
+    { 12, 5, 0, -6, -1, 15, 30169 }, // ̼
+    { 6, 7, 0, -3, 23, 11, 30184 }, // ̽
+    { 4, 10, 0, -2, 26, 10, 30195 }, // ̾
+    { 13, 7, 0, -7, 29, 23, 30205 }, // ̿
+    { 9, 6, 0, -7, 23, 14, 30228 }, // ̀
+    { 9, 6, 0, -2, 23, 14, 30242 }, // ́
+    { 13, 6, 0, -6, 23, 20, 30256 }, // ͂
+    { 6, 6, 0, -3, 23, 9, 30276 }, // ̓
+    { 17, 6, 0, -7, 23, 26, 30285 }, // ̈́
+    { 7, 6, 0, -2, -1, 11, 30311 }, // ͅ
+    { 14, 6, 0, -7, 23, 21, 30322 }, // ͆
+    { 13, 7, 0, -7, 0, 23, 30343 }, // ͇
+    { 8, 6, 0, -4, -1, 12, 30366 }, // ͈
+    { 6, 6, 0, -3, -1, 9, 30378 }, // ͉
+    { 12, 7, 0, -6, 23, 21, 30387 }, // ͊
+    { 12, 12, 0, -6, 28, 36, 30408 }, // ͋
+    { 12, 9, 0, -6, 26, 27, 30444 }, // ͌
+    { 12, 6, 0, -6, -1, 18, 30471 }, // ͍
+    { 6, 7, 0, -3, 0, 11, 30489 }, // ͎
+    { 22, 21, 0, -11, 21, 116, 30500 }, // ͏
+    { 6, 7, 0, -3, 24, 11, 30616 }, // ͐
+    { 5, 8, 0, -2, 24, 10, 30627 }, // ͑
+    { 12, 8, 0, -6, 25, 24, 30637 }, // ͒
+    { 6, 7, 0, -3, 0, 11, 30661 }, // ͓
+    { 6, 6, 0, -3, -1, 9, 30672 }, // ͔
+    { 6, 6, 0, -3, -1, 9, 30681 }, // ͕
+    { 12, 6, 0, -6, -1, 18, 30690 }, // ͖
+    { 5, 8, 0, -2, 24, 10, 30708 }, // ͗
+    { 6, 6, 0, 2, 23, 9, 30720 }, // ͘
+    { 8, 6, 0, -4, -1, 12, 30729 }, // ͙
+    { 12, 7, 0, -6, 0, 21, 30741 }, // ͚
+    { 6, 6, 0, -3, 23, 9, 30762 }, // ͛
+    { 24, 6, 0, -12, -1, 36, 30771 }, // ͜
+    { 24, 6, 0, -12, 23, 36, 30807 }, // ͝
+    { 18, 3, 0, -9, 20, 14, 30843 }, // ͞
+    { 18, 3, 0, -9, -2, 14, 30857 }, // ͟
+    { 24, 6, 0, -12, 23, 36, 30871 }, // ͠
+    { 24, 7, 0, -12, 26, 42, 30907 }, // ͡
+    { 24, 7, 0, -11, 0, 42, 30949 }, // ͢
+    { 8, 8, 0, -4, 25, 16, 30991 }, // ͣ
+    { 7, 8, 0, -3, 25, 14, 31007 }, // ͤ
+    { 3, 9, 0, -1, 27, 7, 31021 }, // ͥ
+    { 8, 8, 0, -4, 25, 16, 31028 }, // ͦ
+    { 8, 8, 0, -4, 25, 16, 31044 }, // ͧ
+    { 7, 8, 0, -3, 25, 14, 31060 }, // ͨ
+    { 8, 10, 0, -4, 27, 20, 31074 }, // ͩ
+    { 7, 9, 0, -3, 27, 16, 31094 }, // ͪ
+    { 12, 7, 0, -6, 25, 21, 31110 }, // ͫ
+    { 6, 7, 0, -2, 25, 11, 31131 }, // ͬ
+    { 6, 9, 0, -3, 26, 14, 31142 }, // ͭ
+    { 9, 7, 0, -4, 25, 16, 31156 }, // ͮ
+    { 8, 7, 0, -4, 25, 14, 31172 }, // ͯ
+    { 13, 28, 16, 2, 28, 91, 31186 }, // Ѐ
+    { 13, 27, 16, 2, 27, 88, 31277 }, // Ё
+    { 22, 22, 22, 0, 21, 121, 31365 }, // Ђ
+    { 14, 28, 16, 2, 28, 98, 31486 }, // Ѓ
+    { 17, 23, 19, 1, 22, 98, 31584 }, // Є
+    { 14, 23, 16, 1, 22, 81, 31682 }, // Ѕ
+    { 5, 21, 9, 2, 21, 27, 31763 }, // І
+    { 10, 28, 10, 0, 28, 70, 31790 }, // Ї
+    { 11, 28, 10, -3, 21, 77, 31860 }, // Ј
+    { 29, 22, 30, 0, 21, 160, 31937 }, // Љ
+    { 28, 21, 31, 2, 21, 147, 32097 }, // Њ
+    { 21, 21, 23, 0, 21, 111, 32244 }, // Ћ
+    { 19, 28, 20, 2, 28, 133, 32355 }, // Ќ
+    { 19, 28, 23, 2, 28, 133, 32488 }, // Ѝ
+    { 19, 29, 19, 0, 28, 138, 32621 }, // Ў
+    { 18, 26, 22, 2, 21, 117, 32768 }, // Џ
+    { 21, 21, 20, 0, 21, 111, 32885 }, // А
+    { 16, 21, 19, 2, 21, 84, 32996 }, // Б
+    { 16, 21, 19, 2, 21, 84, 33080 }, // В
+    { 14, 21, 16, 2, 21, 74, 33164 }, // Г
+    { 23, 26, 23, 0, 21, 150, 33238 }, // Д
+    { 13, 21, 16, 2, 21, 69, 33388 }, // Е
+    { 29, 21, 29, 0, 21, 153, 33457 }, // Ж
+    { 15, 23, 17, 1, 22, 87, 33610 }, // З
+    { 19, 21, 23, 2, 21, 100, 33697 }, // И
+    { 19, 28, 23, 2, 28, 133, 33797 }, // Й
+    { 19, 21, 20, 2, 21, 100, 33930 }, // К
+    { 19, 22, 21, 0, 21, 105, 34030 }, // Л
+    { 23, 21, 28, 2, 21, 121, 34135 }, // М
+    { 18, 21, 22, 2, 21, 95, 34256 }, // Н
+    { 21, 23, 23, 1, 22, 121, 34351 }, // О
+    { 18, 21, 22, 2, 21, 95, 34472 }, // П
+    { 15, 21, 18, 2, 21, 79, 34567 }, // Р
+    { 17, 23, 19, 1, 22, 98, 34646 }, // С
+    { 17, 21, 17, 0, 21, 90, 34816 }, // Т
+    { 19, 22, 19, 0, 21, 105, 34906 }, // У
+    { 24, 23, 26, 1, 22, 138, 35011 }, // Ф
+    { 20, 21, 19, 0, 21, 105, 35149 }, // Х
+    { 21, 26, 23, 2, 21, 137, 35254 }, // Ц
+    { 17, 21, 21, 2, 21, 90, 35391 }, // Ч
+    { 27, 21, 31, 2, 21, 142, 35481 }, // Ш
+    { 30, 26, 31, 2, 21, 195, 35623 }, // Щ
+    { 21, 21, 22, 0, 21, 111, 35818 }, // Ъ
+    { 23, 21, 27, 2, 21, 121, 35929 }, // Ы
+    { 16, 21, 19, 2, 21, 84, 36050 }, // Ь
+    { 17, 23, 19, 1, 22, 98, 36134 }, // Э
+    { 27, 23, 30, 2, 22, 156, 36232 }, // Ю
+    { 18, 21, 20, 0, 21, 95, 36388 }, // Я
+    { 15, 18, 17, 1, 17, 68, 36483 }, // а
+    { 16, 24, 18, 1, 23, 96, 36551 }, // б
+    { 15, 16, 17, 2, 16, 60, 36647 }, // в
+    { 12, 16, 14, 2, 16, 48, 36707 }, // г
+    { 19, 21, 19, 0, 16, 100, 36755 }, // д
+    { 15, 18, 17, 1, 17, 68, 36864 }, // е
+    { 26, 16, 25, 0, 16, 104, 36932 }, // ж
+    { 14, 18, 15, 0, 17, 63, 37036 }, // з
+    { 16, 16, 20, 2, 16, 64, 37099 }, // и
+    { 16, 23, 20, 2, 23, 92, 37163 }, // й
+    { 16, 16, 18, 2, 16, 64, 37255 }, // к
+    { 17, 17, 18, 0, 16, 73, 37319 }, // л
+    { 21, 16, 24, 2, 16, 84, 37392 }, // м
+    { 15, 16, 19, 2, 16, 60, 37476 }, // н
+    { 16, 18, 18, 1, 17, 72, 37536 }, // о
+    { 15, 16, 19, 2, 16, 60, 37608 }, // п
+    { 16, 24, 19, 2, 17, 96, 37668 }, // р
+    { 14, 18, 15, 1, 17, 63, 37764 }, // с
+    { 15, 16, 15, 0, 16, 60, 37827 }, // т
+    { 18, 23, 17, -1, 16, 104, 37887 }, // у
+    { 22, 30, 24, 1, 23, 165, 37991 }, // ф
+    { 17, 16, 17, 0, 16, 68, 38156 }, // х
+    { 17, 21, 19, 2, 16, 90, 38224 }, // ц
+    { 16, 16, 19, 1, 16, 64, 38314 }, // ч
+    { 24, 16, 28, 2, 16, 96, 38378 }, // ш
+    { 26, 21, 28, 2, 16, 137, 38474 }, // щ
+    { 19, 16, 20, 0, 16, 76, 38611 }, // ъ
+    { 21, 16, 25, 2, 16, 84, 38687 }, // ы
+    { 15, 16, 17, 2, 16, 60, 38771 }, // ь
+    { 14, 18, 15, 1, 17, 63, 38831 }, // э
+    { 22, 18, 25, 2, 17, 99, 38912 }, // ю
+    { 16, 16, 18, 0, 16, 64, 39011 }, // я
+    { 15, 24, 17, 1, 23, 90, 39075 }, // ѐ
+    { 15, 23, 17, 1, 22, 87, 39165 }, // ё
+    { 17, 30, 19, 0, 23, 128, 39252 }, // ђ
+    { 12, 23, 14, 2, 23, 69, 39380 }, // ѓ
+    { 14, 18, 15, 1, 17, 63, 39449 }, // є
+    { 13, 18, 15, 1, 17, 59, 39512 }, // ѕ
+    { 5, 23, 9, 2, 23, 29, 39571 }, // і
+    { 9, 23, 9, 0, 23, 52, 39600 }, // ї
+    { 9, 30, 9, -2, 23, 68, 39652 }, // ј
+    { 25, 17, 26, 0, 16, 107, 39720 }, // љ
+    { 24, 16, 27, 2, 16, 96, 39827 }, // њ
+    { 17, 23, 19, 0, 23, 98, 39923 }, // ћ
+    { 16, 23, 18, 2, 23, 92, 40021 }, // ќ
+    { 16, 23, 20, 2, 23, 92, 40113 }, // ѝ
+    { 18, 30, 17, -1, 23, 135, 40205 }, // ў
+    { 15, 21, 19, 2, 16, 79, 40340 }, // џ
+    { 28, 21, 28, 0, 21, 147, 40419 }, // Ѡ
+    { 25, 16, 26, 0, 16, 100, 40566 }, // ѡ
+    { 19, 21, 20, 0, 21, 100, 40666 }, // Ѣ
+    { 19, 20, 19, 0, 20, 95, 40766 }, // ѣ
+    { 25, 23, 28, 2, 22, 144, 40960 }, // Ѥ
+    { 21, 18, 23, 2, 17, 95, 41104 }, // ѥ
+    { 22, 21, 21, 0, 21, 116, 41199 }, // Ѧ
+    { 19, 16, 19, 0, 16, 76, 41315 }, // ѧ
+    { 28, 21, 29, 2, 21, 147, 41391 }, // Ѩ
+    { 25, 16, 26, 2, 16, 100, 41538 }, // ѩ
+    { 23, 21, 23, 0, 21, 121, 41638 }, // Ѫ
+    { 18, 16, 18, 0, 16, 72, 41759 }, // ѫ
+    { 29, 21, 31, 2, 21, 153, 41831 }, // Ѭ
+    { 24, 16, 26, 2, 16, 96, 41984 }, // ѭ
+    { 18, 33, 18, 0, 26, 149, 42080 }, // Ѯ
+    { 16, 27, 16, 0, 20, 108, 42229 }, // ѯ
+    { 22, 21, 26, 2, 21, 116, 42337 }, // Ѱ
+    { 21, 30, 25, 2, 23, 158, 42453 }, // ѱ
+    { 21, 23, 23, 1, 22, 121, 42611 }, // Ѳ
+    { 16, 18, 18, 1, 17, 72, 42732 }, // ѳ
+    { 21, 21, 21, 0, 21, 111, 42804 }, // Ѵ
+    { 18, 17, 18, 0, 17, 77, 42915 }, // ѵ
+    { 21, 28, 21, 0, 28, 147, 43008 }, // Ѷ
+    { 18, 23, 18, 0, 23, 104, 43155 }, // ѷ
+    { 38, 29, 38, 1, 22, 276, 43259 }, // Ѹ
+    { 34, 24, 34, 1, 17, 204, 43535 }, // ѹ
+    { 22, 25, 24, 1, 23, 138, 43739 }, // Ѻ
+    { 18, 20, 20, 1, 18, 90, 43877 }, // ѻ
+    { 30, 33, 32, 1, 32, 248, 43967 }, // Ѽ
+    { 26, 28, 28, 1, 27, 182, 44215 }, // ѽ
+    { 28, 27, 28, 0, 27, 189, 44397 }, // Ѿ
+    { 25, 22, 26, 0, 22, 138, 44586 }, // ѿ
+    { 18, 29, 20, 1, 22, 131, 44724 }, // Ҁ
+    { 14, 24, 15, 1, 17, 84, 44855 }, // ҁ
+    { 16, 20, 18, 1, 19, 80, 44939 }, // ҂
+    { 12, 6, 0, -14, 22, 18, 45019 }, // ҃
+    { 12, 6, 0, -14, 23, 18, 45037 }, // ҄
+    { 5, 7, 0, -10, 24, 9, 45056 }, // ҅
+    { 5, 7, 0, -10, 24, 9, 45065 }, // ҆
+    { 12, 5, 0, -6, 27, 15, 45074 }, // ҇
+    { 34, 31, 0, -17, 23, 264, 45089 }, // ҈
+    { 34, 33, 0, -17, 24, 281, 45353 }, // ҉
+    { 25, 35, 27, 2, 28, 219, 45634 }, // Ҋ
+    { 21, 29, 23, 2, 23, 153, 45853 }, // ҋ
+    { 18, 21, 19, 0, 21, 95, 46006 }, // Ҍ
+    { 17, 23, 18, 0, 23, 98, 46101 }, // ҍ
+    { 15, 21, 18, 2, 21, 79, 46199 }, // Ҏ
+    { 16, 24, 18, 2, 17, 96, 46278 }, // ҏ
+    { 15, 26, 17, 2, 26, 98, 46374 }, // Ґ
+    { 12, 21, 15, 2, 21, 63, 46472 }, // ґ
+    { 16, 21, 16, 0, 21, 84, 46535 }, // Ғ
+    { 14, 16, 14, 0, 16, 56, 46619 }, // ғ
+    { 18, 29, 21, 2, 21, 131, 46675 }, // Ҕ
+    { 15, 24, 18, 2, 16, 90, 46806 }, // ҕ
+    { 30, 28, 30, 0, 21, 210, 47104 }, // Җ
+    { 28, 22, 27, -1, 16, 154, 47314 }, // җ
+    { 15, 29, 17, 1, 22, 109, 47468 }, // Ҙ
+    { 14, 24, 15, 0, 17, 84, 47577 }, // ҙ
+    { 20, 28, 22, 2, 21, 140, 47661 }, // Қ
+    { 17, 22, 19, 2, 16, 94, 47801 }, // қ
+    { 18, 21, 20, 2, 21, 95, 47895 }, // Ҝ
+    { 16, 16, 18, 2, 16, 64, 47990 }, // ҝ
+    { 20, 21, 20, 1, 21, 105, 48054 }, // Ҟ
+    { 19, 23, 18, 0, 23, 110, 48159 }, // ҟ
+    { 22, 21, 21, 0, 21, 116, 48269 }, // Ҡ
+    { 21, 16, 20, 0, 16, 84, 48385 }, // ҡ
+    { 22, 28, 25, 2, 21, 154, 48469 }, // Ң
+    { 19, 22, 22, 2, 16, 105, 48623 }, // ң
+    { 23, 21, 24, 2, 21, 121, 48728 }, // Ҥ
+    { 21, 16, 22, 2, 16, 84, 48849 }, // ҥ
+    { 30, 29, 33, 2, 21, 218, 48933 }, // Ҧ
+    { 23, 24, 26, 2, 16, 138, 49152 }, // ҧ
+    { 21, 24, 23, 1, 22, 126, 49290 }, // Ҩ
+    { 18, 19, 19, 1, 17, 86, 49416 }, // ҩ
+    { 17, 29, 19, 1, 22, 124, 49502 }, // Ҫ
+    { 14, 24, 15, 1, 17, 84, 49626 }, // ҫ
+    { 17, 28, 17, 0, 21, 119, 49710 }, // Ҭ
+    { 16, 22, 16, 0, 16, 88, 49829 }, // ҭ
+    { 19, 21, 18, 0, 21, 100, 49917 }, // Ү
+    { 17, 23, 17, 0, 16, 98, 50017 }, // ү
+    { 19, 21, 18, 0, 21, 100, 50115 }, // Ұ
+    { 17, 23, 17, 0, 16, 98, 50215 }, // ұ
+    { 22, 28, 22, 0, 21, 154, 50313 }, // Ҳ
+    { 19, 22, 19, 0, 16, 105, 50467 }, // ҳ
+    { 27, 28, 27, 0, 21, 189, 50572 }, // Ҵ
+    { 23, 22, 23, 0, 16, 127, 50761 }, // ҵ
+    { 22, 28, 23, 1, 21, 154, 50888 }, // Ҷ
+    { 20, 22, 21, 1, 16, 110, 51042 }, // ҷ
+    { 18, 21, 21, 1, 21, 95, 51200 }, // Ҹ
+    { 17, 16, 19, 1, 16, 68, 51295 }, // ҹ
+    { 18, 21, 21, 2, 21, 95, 51363 }, // Һ
+    { 15, 23, 19, 2, 23, 87, 51458 }, // һ
+    { 26, 23, 28, 0, 22, 150, 51545 }, // Ҽ
+    { 21, 18, 21, -1, 17, 95, 51695 }, // ҽ
+    { 26, 29, 28, 0, 22, 189, 51790 }, // Ҿ
+    { 21, 23, 21, -1, 17, 121, 51979 }, // ҿ
+    { 11, 21, 11, 0, 21, 58, 52100 }, // Ӏ
+    { 29, 28, 29, 0, 28, 203, 52158 }, // Ӂ
+    { 26, 23, 25, 0, 23, 150, 52361 }, // ӂ
+    { 19, 29, 22, 2, 21, 138, 52511 }, // Ӄ
+    { 16, 24, 19, 2, 16, 96, 52649 }, // ӄ
+    { 24, 28, 24, 0, 21, 168, 52745 }, // Ӆ
+    { 21, 22, 21, 0, 16, 116, 52913 }, // ӆ
+    { 18, 29, 22, 2, 21, 131, 53029 }, // Ӈ
+    { 16, 24, 19, 2, 16, 96, 53248 }, // ӈ
+    { 23, 28, 25, 2, 21, 161, 53344 }, // Ӊ
+    { 20, 22, 22, 2, 16, 110, 53505 }, // ӊ
+    { 18, 28, 21, 1, 21, 126, 53615 }, // Ӌ
+    { 16, 22, 19, 1, 16, 88, 53741 }, // ӌ
+    { 28, 28, 30, 2, 21, 196, 53829 }, // Ӎ
+    { 25, 22, 27, 2, 16, 138, 54025 }, // ӎ
+    { 11, 21, 11, 0, 21, 58, 54163 }, // ӏ
+    { 21, 28, 20, 0, 28, 147, 54221 }, // Ӑ
+    { 15, 24, 17, 1, 23, 90, 54368 }, // ӑ
+    { 21, 27, 20, 0, 27, 142, 54458 }, // Ӓ
+    { 15, 23, 17, 1, 22, 87, 54600 }, // ӓ
+    { 27, 21, 28, 0, 21, 142, 54687 }, // Ӕ
+    { 25, 18, 27, 1, 17, 113, 54829 }, // ӕ
+    { 13, 28, 16, 2, 28, 91, 54942 }, // Ӗ
+    { 16, 24, 17, 1, 23, 96, 55033 }, // ӗ
+    { 21, 23, 24, 2, 22, 121, 55129 }, // Ә
+    { 16, 18, 17, 1, 17, 72, 55296 }, // ә
+    { 21, 28, 24, 2, 27, 147, 55368 }, // Ӛ
+    { 16, 23, 17, 1, 22, 92, 55515 }, // ӛ
+    { 29, 27, 29, 0, 27, 196, 55607 }, // Ӝ
+    { 26, 22, 25, 0, 22, 143, 55803 }, // ӝ
+    { 15, 28, 17, 1, 27, 105, 55946 }, // Ӟ
+    { 14, 23, 15, 0, 22, 81, 56051 }, // ӟ
+    { 17, 22, 17, 0, 21, 94, 56132 }, // Ӡ
+    { 16, 23, 17, 0, 16, 92, 56226 }, // ӡ
+    { 19, 26, 23, 2, 26, 124, 56318 }, // Ӣ
+    { 16, 21, 20, 2, 21, 84, 56442 }, // ӣ
+    { 19, 27, 23, 2, 27, 129, 56526 }, // Ӥ
+    { 16, 22, 20, 2, 22, 88, 56655 }, // ӥ
+    { 21, 28, 23, 1, 27, 147, 56743 }, // Ӧ
+    { 16, 23, 18, 1, 22, 92, 56890 }, // ӧ
+    { 21, 23, 23, 1, 22, 121, 56982 }, // Ө
+    { 16, 18, 18, 1, 17, 72, 57103 }, // ө
+    { 21, 28, 23, 1, 27, 147, 57175 }, // Ӫ
+    { 16, 23, 18, 1, 22, 92, 57344 }, // ӫ
+    { 17, 28, 19, 1, 27, 119, 57436 }, // Ӭ
+    { 14, 23, 15, 1, 22, 81, 57555 }, // ӭ
+    { 19, 27, 19, 0, 26, 129, 57636 }, // Ӯ
+    { 18, 28, 17, -1, 21, 126, 57765 }, // ӯ
+    { 19, 28, 19, 0, 27, 133, 57891 }, // Ӱ
+    { 18, 29, 17, -1, 22, 131, 58024 }, // ӱ
+    { 19, 29, 19, 0, 28, 138, 58155 }, // Ӳ
+    { 17, 30, 17, 0, 23, 128, 58293 }, // ӳ
+    { 17, 27, 21, 2, 27, 115, 58421 }, // Ӵ
+    { 16, 22, 19, 1, 22, 88, 58536 }, // ӵ
+    { 14, 28, 16, 2, 21, 98, 58624 }, // Ӷ
+    { 12, 22, 14, 2, 16, 66, 58722 }, // ӷ
+    { 23, 27, 27, 2, 27, 156, 58788 }, // Ӹ
+    { 21, 22, 25, 2, 22, 116, 58944 }, // ӹ
+    { 16, 29, 16, 0, 21, 116, 59060 }, // Ӻ
+    { 14, 23, 14, 0, 16, 81, 59176 }, // ӻ
+    { 21, 29, 21, 0, 21, 153, 59392 }, // Ӽ
+    { 18, 23, 19, 0, 16, 104, 59545 }, // ӽ
+    { 20, 21, 20, 0, 21, 105, 59649 }, // Ӿ
+    { 17, 16, 17, 0, 16, 68, 59754 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 59822 }, //  
+    { 0, 0, 29, 0, 0, 0, 59822 }, //  
+    { 0, 0, 15, 0, 0, 0, 59822 }, //  
+    { 0, 0, 29, 0, 0, 0, 59822 }, //  
+    { 0, 0, 10, 0, 0, 0, 59822 }, //  
+    { 0, 0, 7, 0, 0, 0, 59822 }, //  
+    { 0, 0, 5, 0, 0, 0, 59822 }, //  
+    { 0, 0, 17, 0, 0, 0, 59822 }, //  
+    { 0, 0, 8, 0, 0, 0, 59822 }, //  
+    { 0, 0, 5, 0, 0, 0, 59822 }, //  
+    { 0, 0, 3, 0, 0, 0, 59822 }, //  
+    { 0, 0, 0, 0, 0, 0, 59822 }, // ​
+    { 0, 0, 0, 0, 0, 0, 59822 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 59822 }, // ‍
+    { 8, 25, 0, -1, 21, 50, 59822 }, // ‎
+    { 8, 25, 0, -7, 21, 50, 59872 }, // ‏
+    { 9, 4, 9, 0, 10, 9, 59922 }, // ‐
+    { 9, 4, 9, 0, 10, 9, 59931 }, // ‑
+    { 15, 4, 17, 1, 12, 15, 59940 }, // ‒
+    { 13, 4, 15, 1, 10, 13, 59955 }, // –
+    { 28, 4, 29, 1, 10, 28, 59968 }, // —
+    { 28, 4, 29, 1, 10, 28, 59996 }, // ―
+    { 12, 30, 16, 2, 23, 90, 60024 }, // ‖
+    { 14, 7, 12, -1, 0, 25, 60114 }, // ‗
+    { 6, 8, 6, 0, 21, 12, 60139 }, // ‘
+    { 6, 8, 6, 0, 21, 12, 60151 }, // ’
+    { 7, 8, 8, 0, 4, 14, 60163 }, // ‚
+    { 6, 8, 6, 0, 21, 12, 60177 }, // ‛
+    { 13, 8, 13, 0, 21, 26, 60189 }, // “
+    { 13, 8, 13, 0, 21, 26, 60215 }, // ”
+    { 14, 8, 15, 0, 4, 28, 60241 }, // „
+    { 13, 8, 13, 0, 21, 26, 60269 }, // ‟
+    { 13, 23, 15, 1, 23, 75, 60295 }, // †
+    { 13, 23, 15, 1, 23, 75, 60370 }, // ‡
+    { 9, 10, 11, 1, 16, 23, 60445 }, // •
+    { 10, 12, 11, 1, 17, 30, 60468 }, // ‣
+    { 6, 6, 15, 4, 5, 9, 60498 }, // ․
+    { 15, 6, 17, 1, 5, 23, 60507 }, // ‥
+    { 23, 6, 25, 1, 5, 35, 60530 }, // …
+    { 6, 6, 8, 1, 11, 9, 60565 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 60574 }, //  
+    { 0, 0, 18, 0, 0, 0, 60574 }, //  
+    { 8, 22, 0, -1, 18, 44, 60574 }, // ‪
+    { 8, 22, 0, -7, 18, 44, 60618 }, // ‫
+    { 8, 25, 0, -4, 21, 50, 60662 }, // ‬
+    { 8, 25, 0, -4, 21, 50, 60712 }, // ‭
+    { 8, 25, 0, -4, 21, 50, 60762 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 60812 }, //  
+    { 37, 23, 37, 0, 22, 213, 60812 }, // ‰
+    { 48, 23, 49, 0, 22, 276, 61025 }, // ‱
+    { 9, 8, 9, 1, 21, 18, 61301 }, // ′
+    { 15, 8, 15, 1, 21, 30, 61319 }, // ″
+    { 21, 8, 22, 1, 21, 42, 61349 }, // ‴
+    { 9, 8, 12, 1, 21, 18, 61391 }, // ‵
+    { 15, 8, 19, 1, 21, 30, 61409 }, // ‶
+    { 22, 8, 25, 1, 21, 44, 61440 }, // ‷
+    { 12, 10, 12, 0, 3, 30, 61484 }, // ‸
+    { 9, 14, 11, 1, 15, 32, 61514 }, // ‹
+    { 9, 14, 11, 1, 15, 32, 61546 }, // ›
+    { 23, 23, 25, 1, 22, 133, 61578 }, // ※
+    { 14, 22, 17, 1, 21, 77, 61711 }, // ‼
+    { 14, 23, 14, 0, 22, 81, 61788 }, // ‽
+    { 16, 4, 15, -1, 26, 16, 61869 }, // ‾
+    { 18, 7, 18, 0, 0, 32, 61885 }, // ‿
+    { 18, 8, 18, 0, 24, 36, 61917 }, // ⁀
+    { 12, 19, 12, 0, 12, 57, 61953 }, // ⁁
+    { 33, 28, 33, 0, 23, 231, 62010 }, // ⁂
+    { 9, 4, 9, 1, 10, 9, 62241 }, // ⁃
+    { 16, 21, 4, -6, 21, 84, 62250 }, // ⁄
+    { 7, 26, 10, 2, 21, 46, 62334 }, // ⁅
+    { 8, 26, 10, 0, 21, 52, 62380 }, // ⁆
+    { 28, 23, 28, 0, 22, 161, 62432 }, // ⁇
+    { 21, 23, 22, 0, 22, 121, 62593 }, // ⁈
+    { 21, 23, 22, 1, 22, 121, 62714 }, // ⁉
+    { 15, 16, 17, 1, 16, 60, 62835 }, // ⁊
+    { 16, 27, 19, 2, 23, 108, 62895 }, // ⁋
+    { 16, 15, 19, 1, 16, 60, 63003 }, // ⁌
+    { 16, 15, 19, 2, 16, 60, 63063 }, // ⁍
+    { 15, 15, 16, 0, 8, 57, 63123 }, // ⁎
+    { 7, 21, 8, 1, 17, 37, 63180 }, // ⁏
+    { 18, 31, 18, 0, 24, 140, 63217 }, // ⁐
+    { 15, 30, 16, 0, 23, 113, 63357 }, // ⁑
+    { 13, 23, 12, 0, 22, 75, 63488 }, // ⁒
+    { 28, 6, 29, 1, 11, 42, 63563 }, // ⁓
+    { 18, 7, 18, 0, 0, 32, 63605 }, // ⁔
+    { 16, 15, 16, 0, 15, 60, 63637 }, // ⁕
+    { 15, 23, 17, 1, 22, 87, 63697 }, // ⁖
+    { 27, 8, 27, 1, 21, 54, 63784 }, // ⁗
+    { 23, 23, 25, 1, 22, 133, 63838 }, // ⁘
+    { 23, 23, 25, 1, 22, 133, 63971 }, // ⁙
+    { 6, 23, 8, 1, 22, 35, 64104 }, // ⁚
+    { 18, 24, 20, 1, 23, 108, 64139 }, // ⁛
+    { 23, 23, 25, 1, 22, 133, 64247 }, // ⁜
+    { 6, 24, 8, 1, 23, 36, 64380 }, // ⁝
+    { 6, 23, 8, 1, 22, 35, 64416 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 64451 }, //  
+    { 0, 0, 18, 0, 0, 0, 64451 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 64451 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 64451 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 64451 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 64451 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 64451 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 64451 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 64451 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 64451 }, // ⁩
+    { 8, 25, 0, -4, 21, 50, 64451 }, // ⁪
+    { 8, 25, 0, -4, 21, 50, 64501 }, // ⁫
+    { 8, 25, 0, -4, 21, 50, 64551 }, // ⁬
+    { 8, 25, 0, -4, 21, 50, 64601 }, // ⁭
+    { 8, 25, 0, -4, 21, 50, 64651 }, // ⁮
+    { 8, 25, 0, -4, 21, 50, 64701 }, // ⁯
+    { 11, 14, 11, 0, 25, 39, 64751 }, // ⁰
+    { 4, 14, 6, 1, 22, 14, 64790 }, // ⁱ
+    { 11, 13, 11, 0, 25, 36, 64804 }, // ⁴
+    { 10, 14, 11, 1, 25, 35, 64840 }, // ⁵
+    { 11, 14, 11, 0, 25, 39, 64875 }, // ⁶
+    { 11, 13, 11, 0, 25, 36, 64914 }, // ⁷
+    { 11, 14, 11, 0, 25, 39, 64950 }, // ⁸
+    { 11, 14, 11, 0, 25, 39, 64989 }, // ⁹
+    { 9, 9, 10, 1, 22, 21, 65028 }, // ⁺
+    { 9, 3, 10, 1, 19, 7, 65049 }, // ⁻
+    { 9, 7, 10, 1, 21, 16, 65056 }, // ⁼
+    { 6, 17, 7, 1, 27, 26, 65072 }, // ⁽
+    { 6, 17, 7, 0, 27, 26, 65098 }, // ⁾
+    { 10, 11, 12, 1, 19, 28, 65124 }, // ⁿ
+    { 11, 14, 11, 0, 9, 39, 65152 }, // ₀
+    { 9, 13, 11, 0, 9, 30, 65191 }, // ₁
+    { 10, 13, 11, 0, 9, 33, 65221 }, // ₂
+    { 11, 14, 11, 0, 9, 39, 65254 }, // ₃
+    { 11, 13, 11, 0, 9, 36, 65293 }, // ₄
+    { 10, 14, 11, 1, 9, 35, 65329 }, // ₅
+    { 11, 14, 11, 0, 9, 39, 65364 }, // ₆
+    { 11, 13, 11, 0, 9, 36, 65403 }, // ₇
+    { 11, 14, 11, 0, 9, 39, 65439 }, // ₈
+    { 11, 14, 11, 0, 9, 39, 65478 }, // ₉
+    { 9, 9, 10, 1, 7, 21, 65536 }, // ₊
+    { 9, 3, 10, 1, 4, 7, 65557 }, // ₋
+    { 9, 7, 10, 1, 6, 16, 65564 }, // ₌
+    { 6, 17, 7, 1, 11, 26, 65580 }, // ₍
+    { 6, 17, 7, 0, 11, 26, 65606 }, // ₎
+    { 10, 10, 11, 0, 7, 25, 65632 }, // ₐ
+    { 11, 10, 11, 0, 7, 28, 65657 }, // ₑ
+    { 11, 10, 12, 0, 7, 28, 65685 }, // ₒ
+    { 11, 10, 11, 0, 7, 28, 65713 }, // ₓ
+    { 11, 10, 11, 0, 7, 28, 65741 }, // ₔ
+    { 10, 14, 12, 1, 11, 35, 65769 }, // ₕ
+    { 11, 14, 12, 1, 11, 39, 65804 }, // ₖ
+    { 4, 14, 6, 1, 11, 14, 65843 }, // ₗ
+    { 17, 10, 19, 1, 7, 43, 65857 }, // ₘ
+    { 10, 10, 12, 1, 7, 25, 65900 }, // ₙ
+    { 11, 14, 12, 1, 7, 39, 65925 }, // ₚ
+    { 9, 10, 10, 0, 7, 23, 65964 }, // ₛ
+    { 8, 12, 8, 0, 9, 24, 65987 }, // ₜ
+    { 17, 22, 17, 0, 22, 94, 66011 }, // ₠
+    { 18, 25, 18, 0, 23, 113, 66105 }, // ₡
+    { 16, 23, 17, 1, 22, 92, 66218 }, // ₢
+    { 16, 21, 17, 0, 21, 84, 66310 }, // ₣
+    { 16, 22, 17, 1, 22, 88, 66394 }, // ₤
+    { 25, 24, 28, 2, 20, 150, 66482 }, // ₥
+    { 17, 21, 17, 0, 21, 90, 66632 }, // ₦
+    { 23, 22, 26, 2, 21, 127, 66722 }, // ₧
+    { 24, 22, 27, 2, 21, 132, 66849 }, // ₨
+    { 22, 21, 22, 0, 21, 116, 66981 }, // ₩
+    { 23, 21, 27, 2, 21, 121, 67097 }, // ₪
+    { 18, 28, 19, 1, 23, 126, 67218 }, // ₫
+    { 17, 22, 17, 0, 21, 94, 67344 }, // €
+    { 17, 21, 17, 0, 21, 90, 67438 }, // ₭
+    { 17, 21, 17, 0, 21, 90, 67584 }, // ₮
+    { 29, 29, 29, 0, 22, 211, 67674 }, // ₯
+    { 17, 29, 18, 0, 22, 124, 67885 }, // ₰
+    { 17, 21, 17, 0, 21, 90, 68009 }, // ₱
+    { 18, 26, 21, 1, 23, 117, 68099 }, // ₲
+    { 19, 21, 19, 0, 21, 100, 68216 }, // ₳
+    { 17, 23, 17, 0, 22, 98, 68316 }, // ₴
+    { 17, 26, 19, 1, 23, 111, 68414 }, // ₵
+    { 20, 21, 20, 0, 20, 105, 68525 }, // ₶
+    { 21, 25, 21, 0, 22, 132, 68630 }, // ₷
+    { 17, 21, 17, 0, 21, 90, 68762 }, // ₸
+    { 15, 21, 17, 1, 21, 79, 68852 }, // ₹
+    { 16, 22, 17, 0, 21, 88, 68931 }, // ₺
+    { 24, 23, 24, 0, 22, 138, 69019 }, // ₻
+    { 24, 21, 26, 1, 21, 126, 69157 }, // ₼
+    { 17, 21, 18, 0, 21, 90, 69283 }, // ₽
+    { 21, 23, 23, 1, 23, 121, 69373 }, // ₾
+    { 14, 27, 17, 2, 24, 95, 69494 }, // ₿
+    { 14, 23, 15, 1, 17, 81, 69632 }, // ⃀
+    { 15, 4, 17, 1, 12, 15, 69713 }, // −
+    { 27, 28, 29, 1, 23, 189, 69728 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_boldIntervals[] = {
@@ -5209,4 +3169,9 @@ static const EpdFontData notosans_14_bold = {
     32,
     -9,
     true,
+    notosans_14_boldBlockOffsets,
+    notosans_14_boldDirectGlyphs,
+    notosans_14_boldGlyphPages,
+    256,
+    notosans_14_boldPageGlyphs,
 };
@@ -2,4572 +2,2546 @@
  * generated by fontconvert.py
  * name: notosans_14_bolditalic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py notosans_14_bolditalic 14 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_14_bolditalic 14 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_bolditalicBitmaps[72942] = {
-    0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x02,
-    0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x0F, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xD0, 0x0B,
-    0xFD, 0x00, 0x7F, 0x80, 0x00, 0x40, 0x00, 0x0F, 0xE1, 0xFD, 0x1F, 0xD2, 0xFC, 0x1F, 0xC2, 0xFC,
-    0x2F, 0xC3, 0xF8, 0x2F, 0x83, 0xF4, 0x3F, 0x43, 0xF0, 0x3F, 0x03, 0xF0, 0x2A, 0x02, 0x90, 0x00,
-    0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x00, 0xBD,
-    0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0xC1, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x02,
-    0xF4, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00,
-    0x0B, 0xD0, 0xFD, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x0B, 0xE0,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x06, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xBE, 0xFC, 0x03,
-    0xFD, 0x3C, 0x04, 0x03, 0xFC, 0x78, 0x00, 0x03, 0xFE, 0xB4, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x03, 0xCF, 0xF8, 0x00, 0x03, 0xCB, 0xF8, 0x74, 0x07, 0x8F, 0xF8, 0x7F, 0xEF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x40, 0x06, 0xBF, 0xE4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x7E, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0x40, 0x1F, 0xD3,
-    0xF8, 0x02, 0xF8, 0x00, 0xBF, 0x0F, 0xE0, 0x1F, 0xC0, 0x03, 0xF8, 0x3F, 0x80, 0xFC, 0x00, 0x0F,
-    0xD0, 0xFE, 0x0F, 0xD0, 0x00, 0x7F, 0x07, 0xF4, 0xBE, 0x00, 0x01, 0xFC, 0x2F, 0xC7, 0xF1, 0xBE,
-    0x07, 0xF5, 0xFE, 0x3F, 0x2F, 0xFF, 0x0F, 0xFF, 0xF3, 0xF5, 0xFF, 0xFE, 0x2F, 0xFF, 0x6F, 0x8F,
-    0xF3, 0xFC, 0x1F, 0xE1, 0xFC, 0x7F, 0x4B, 0xF0, 0x00, 0x0F, 0xD2, 0xFC, 0x2F, 0xC0, 0x00, 0xFE,
-    0x0F, 0xE0, 0xFF, 0x00, 0x0B, 0xF0, 0x3F, 0x43, 0xF8, 0x00, 0x7F, 0x00, 0xFD, 0x1F, 0xD0, 0x03,
-    0xF4, 0x03, 0xF4, 0xBF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0xF4, 0x02, 0xFC, 0x00, 0x2F, 0xFF, 0x80,
-    0x1F, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x2F, 0xE1, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xF0,
-    0x00, 0x00, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xDB, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0x02, 0xFE,
-    0x03, 0xFF, 0x7F, 0xE0, 0xFF, 0x02, 0xFF, 0x07, 0xFD, 0xFF, 0x80, 0xFF, 0x80, 0xBF, 0xFF, 0xC0,
-    0x3F, 0xD0, 0x0F, 0xFF, 0xC0, 0x0F, 0xF8, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0x96, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x47, 0xFE, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xFD, 0x1F, 0xC2, 0xFC, 0x2F, 0x83, 0xF4, 0x3F, 0x02,
-    0xA0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x01, 0xFE, 0x00, 0x0F,
-    0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x1F,
-    0xE0, 0x00, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xF8, 0x00,
-    0x0F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00,
-    0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x02, 0xFD,
-    0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x2E, 0x07, 0xE0, 0x00, 0xFF, 0xAF, 0x40,
-    0x07, 0xFF, 0xFE, 0xBF, 0x41, 0xBF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xF4, 0x07, 0xFF, 0x81, 0x40,
-    0xBF, 0xBF, 0x00, 0x07, 0xFC, 0xBE, 0x00, 0x0B, 0xC1, 0xFC, 0x00, 0x05, 0x03, 0xF4, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x55, 0x7F, 0x55, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0x54, 0x03, 0xFD,
-    0x07, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xC0, 0x3F, 0x80, 0x3F, 0x00, 0x2A, 0xAA, 0x4F, 0xFF,
-    0xE3, 0xFF, 0xF5, 0xFF, 0xFC, 0x05, 0x03, 0xFC, 0xBF, 0xDB, 0xFC, 0x7F, 0x80, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xDB, 0xFD,
-    0x03, 0xFF, 0x03, 0xFE, 0x07, 0xFD, 0x02, 0xFF, 0x0F, 0xFC, 0x02, 0xFF, 0x0F, 0xF4, 0x02, 0xFF,
-    0x1F, 0xF0, 0x02, 0xFE, 0x2F, 0xF0, 0x02, 0xFE, 0x3F, 0xE0, 0x03, 0xFE, 0x3F, 0xE0, 0x03, 0xFD,
-    0x3F, 0xD0, 0x07, 0xFC, 0x3F, 0xD0, 0x0B, 0xFC, 0x3F, 0xD0, 0x0F, 0xF8, 0x3F, 0xD0, 0x1F, 0xF0,
-    0x3F, 0xE0, 0x3F, 0xF0, 0x2F, 0xF5, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xC0, 0x07,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x0F, 0xFE, 0xFF, 0x02, 0xFD, 0x7F, 0xC0, 0x38,
-    0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xEB, 0xFF, 0x40, 0x0F, 0x40, 0x3F, 0xE0, 0x01, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xEA, 0xAA, 0x40, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x90, 0x01, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFE, 0x5F, 0xFE, 0x00,
-    0x60, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x01, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x40,
-    0x00, 0x2F, 0xF0, 0xF9, 0x45, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x6F,
-    0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0x80, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x1F, 0xE1,
-    0xFF, 0x00, 0x1F, 0xE0, 0xBF, 0x80, 0x0F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xFE,
-    0xAF, 0xFE, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xBF, 0xE9, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x06, 0x56, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xD0, 0x40, 0x00, 0x3F, 0xF0, 0x2F, 0x95, 0xBF, 0xF8, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0xFF, 0xF9, 0x58, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-    0xE0, 0x64, 0x00, 0x3F, 0xDB, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xF0, 0x2F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0x80, 0x1F, 0xF0, 0xBF, 0x40, 0x1F, 0xF0, 0xBF,
-    0x80, 0x2F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0x7F, 0xE5, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x43, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x2F,
-    0xE0, 0x0F, 0xF0, 0x0B, 0xF8, 0x07, 0xF8, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x2F, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x0F, 0xFC,
-    0x02, 0xFE, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xF0, 0x02,
-    0xFE, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xFD, 0x7F, 0xF0, 0xBF, 0xC0, 0x3F, 0xD3, 0xFE, 0x00,
-    0xFF, 0x4F, 0xF0, 0x03, 0xFE, 0x3F, 0xC0, 0x0F, 0xF8, 0xFF, 0x00, 0x7F, 0xD3, 0xFE, 0x03, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0x7F, 0x80, 0x1A, 0x92, 0xFD, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x09, 0x46, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFD, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x3F, 0xC0, 0xBF, 0xD0, 0xBF, 0xC0, 0x7F, 0x80,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xD0, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x2F,
-    0xC0, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xFE,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x01, 0xBF, 0xFD, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0x80,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA5, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF,
-    0xFF, 0xFF, 0x8A, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x9F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x02, 0xFF, 0xE0, 0x01, 0xBF, 0xFD, 0x00, 0xBF, 0xFE, 0x40, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xD0,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x2F, 0x96, 0xFF, 0x06, 0x00, 0x3F,
-    0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE,
-    0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xC0,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xE4, 0x00, 0x2F, 0xF0,
-    0x01, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xF0, 0x0B, 0xFF,
-    0xE0, 0xFD, 0x1F, 0xC0, 0x7F, 0xFF, 0xF0, 0xBE, 0x3F, 0x81, 0xFF, 0x5F, 0xE0, 0xBE, 0x3F, 0x03,
-    0xF8, 0x0F, 0xD0, 0x7E, 0x7F, 0x07, 0xF0, 0x0F, 0xC0, 0xBE, 0xBE, 0x0F, 0xE0, 0x1F, 0xC0, 0xFD,
-    0xBE, 0x0F, 0xD0, 0x2F, 0x80, 0xFC, 0xBE, 0x0F, 0xC0, 0x3F, 0x42, 0xFC, 0xBE, 0x0F, 0xD0, 0xBF,
-    0x07, 0xF4, 0xBE, 0x0F, 0xFB, 0xFF, 0xAF, 0xE0, 0x7F, 0x07, 0xFF, 0xDF, 0xFF, 0x80, 0x3F, 0x41,
-    0xFE, 0x07, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x40, 0x17, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xEF, 0xC0,
-    0x00, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x00, 0xBF, 0x4B, 0xF0, 0x00, 0x03,
-    0xFC, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x7F, 0x40, 0x01, 0xFF, 0x01, 0xFE, 0x00, 0x0F, 0xF4, 0x07,
-    0xF8, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xC1, 0xFF, 0x00,
-    0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xE4,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0x80, 0x3F, 0xF0, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x07, 0xFC,
-    0x02, 0xFF, 0xAB, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0xFF, 0x40,
-    0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0xAB, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFE, 0xBF, 0xC0, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x40,
-    0x01, 0xFF, 0xE5, 0xAF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x7F,
-    0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x02, 0xFF, 0x02,
-    0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xF8, 0x00, 0x2F, 0xF0, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0xFF, 0x00,
-    0x03, 0xFE, 0x07, 0xFC, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x07, 0xFE,
-    0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x07, 0xFF, 0x80, 0x7F, 0xEB, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0xAF, 0xE0, 0x0B, 0xFF, 0x40, 0x02, 0x40, 0x7F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0xAA, 0xAA, 0x0F, 0xF8, 0x07, 0xFF, 0xF8, 0x3F, 0xD0, 0x2F, 0xFF, 0xD1, 0xFF,
-    0x40, 0xBF, 0xFF, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x3F, 0xE0, 0x00,
-    0xFF, 0x40, 0xFF, 0xD0, 0x03, 0xFC, 0x01, 0xFF, 0xE5, 0xBF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x0F,
-    0xF4, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0xAA, 0xAF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFC,
-    0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00,
-    0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x1A, 0xBF,
-    0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x40, 0x07, 0xFC, 0x01, 0xFF,
-    0x80, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xBF, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0xE0, 0x00,
-    0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x00, 0x00,
-    0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x02,
-    0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x2F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF,
-    0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x03, 0xFB,
-    0xF8, 0x00, 0xFE, 0xFD, 0x00, 0x7F, 0xBF, 0x40, 0x1F, 0xDF, 0xD0, 0x0F, 0xEB, 0xF4, 0x02, 0xFD,
-    0xFD, 0x01, 0xFC, 0xFF, 0x00, 0x3F, 0xCF, 0xD0, 0x3F, 0x8F, 0xF0, 0x03, 0xFC, 0xFE, 0x07, 0xF1,
-    0xFE, 0x00, 0x3F, 0x8B, 0xE0, 0xFE, 0x2F, 0xD0, 0x07, 0xF4, 0xBE, 0x1F, 0xC3, 0xFC, 0x00, 0xBF,
-    0x0B, 0xE3, 0xF8, 0x3F, 0xC0, 0x0F, 0xF0, 0xBF, 0x7F, 0x03, 0xFC, 0x00, 0xFF, 0x07, 0xFF, 0xE0,
-    0x7F, 0x80, 0x1F, 0xE0, 0x7F, 0xFC, 0x0B, 0xF4, 0x01, 0xFD, 0x07, 0xFF, 0x80, 0xFF, 0x00, 0x2F,
-    0xC0, 0x7F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFE, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x07,
-    0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x2F, 0xD0,
-    0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xEF, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x6F, 0xE0, 0x1F,
-    0xE0, 0x02, 0xFD, 0x3F, 0xC0, 0xBF, 0x80, 0x0F, 0xF0, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0xC2, 0xFE,
-    0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xF1, 0xFE, 0x00, 0x2F, 0xD0,
-    0x2F, 0xE7, 0xF4, 0x00, 0xFF, 0x00, 0x7F, 0xEF, 0xC0, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x1F,
-    0xE0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xFF, 0xE0, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0x40,
-    0x0F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F,
-    0xFC, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0,
-    0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00,
-    0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F,
-    0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x1F,
-    0xF0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xEA, 0x50, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B,
-    0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD,
-    0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F,
-    0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x6F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFE, 0xBF, 0xFC, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xF4, 0x03, 0xFD,
-    0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF5,
-    0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xC3, 0xFD, 0x00, 0x0F, 0xF8, 0x2F, 0xF0, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF8, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xE0, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x3F,
-    0xD0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xEA, 0xFC, 0x03, 0xFF, 0x00, 0x10, 0x03, 0xFE, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x50, 0x00, 0x7F, 0xD0, 0x7E, 0x56, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF,
-    0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00,
-    0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x3F,
-    0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x83,
-    0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x0B,
-    0xF8, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x2F, 0xE0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x1F,
-    0xD0, 0xBF, 0x80, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x1F, 0xE2, 0xFE, 0x00, 0x00, 0xFE, 0x3F, 0xC0,
-    0x00, 0x0F, 0xEB, 0xF8, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xC7, 0xF8,
-    0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x1F, 0xE0, 0x03, 0xFF, 0x80, 0x0F, 0xF4, 0x3F, 0x80, 0x0F, 0xFE,
-    0x00, 0x7F, 0xC0, 0xFF, 0x00, 0xBF, 0xF8, 0x03, 0xFD, 0x03, 0xFC, 0x03, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x2F, 0xEF, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFE, 0xBF, 0x03, 0xFC, 0x00, 0xFF, 0x07,
-    0xF2, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x3F, 0xCB, 0xF0, 0xFF, 0x40, 0x0F, 0xF1, 0xFD, 0x2F, 0xC7,
-    0xFC, 0x00, 0x3F, 0xCF, 0xF0, 0xBF, 0x2F, 0xD0, 0x00, 0xFF, 0x3F, 0x42, 0xFC, 0xFF, 0x00, 0x03,
-    0xFA, 0xFC, 0x07, 0xF7, 0xF4, 0x00, 0x0F, 0xEF, 0xE0, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0xBF,
-    0xC0, 0x00, 0x00, 0x2F, 0xE7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0x80,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x0F,
-    0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x83, 0xFD, 0x00, 0x2F,
-    0xF0, 0x2F, 0xE0, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFF,
-    0x43, 0xFD, 0x00, 0x0B, 0xF4, 0xBF, 0xC0, 0x00, 0x7F, 0x9F, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xAA, 0xA0, 0x07, 0xFF, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x07,
-    0xFF, 0xD0, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFD, 0x50, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x1A, 0xAA, 0x00, 0x00,
-    0xFF, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0x3F, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0,
-    0x2F, 0xC0, 0x1F, 0xC0, 0x0F, 0xD0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xF0,
-    0x07, 0xF4, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0x01, 0x6F, 0xD0, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x2A, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0xBF, 0x0B,
-    0xE0, 0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x02, 0xF4, 0x0F, 0xD0, 0x01,
-    0xF8, 0x3F, 0x80, 0x00, 0xFC, 0x2A, 0x00, 0x00, 0xA8, 0x15, 0x55, 0x55, 0x1F, 0xFF, 0xFF, 0xD6,
-    0xAA, 0xAA, 0xA0, 0x55, 0x41, 0xFF, 0x03, 0xFD, 0x03, 0xF8, 0x03, 0xF0, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE,
-    0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0,
-    0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0,
-    0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD,
-    0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x01, 0xFE, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xF9, 0x7F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x01, 0xFE, 0x00,
-    0x7F, 0xC0, 0xBF, 0x40, 0x1F, 0xF0, 0x3F, 0xC0, 0x0B, 0xFC, 0x0F, 0xF0, 0x03, 0xFE, 0x07, 0xFC,
-    0x01, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xF5, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xDF, 0xFF, 0xE0, 0x07, 0xF0, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFE, 0x5B, 0x42, 0xFF, 0x40,
-    0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0x56, 0xC0, 0x3F, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xE0, 0x01,
-    0xFF, 0xFE, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFE, 0x6F, 0xFC, 0x01, 0xFF, 0x40, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0xBF, 0x40, 0x7F, 0xC0, 0x0F, 0xF4, 0x0B, 0xFC,
-    0x00, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x7F, 0xD0,
-    0x0B, 0xFE, 0x1F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFE, 0xFC, 0x00, 0x0B, 0xFE,
-    0x3F, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x0F, 0xF4, 0x7F, 0xC0, 0x2F, 0xD3, 0xFE, 0x00,
-    0xFF, 0x4F, 0xF4, 0x6F, 0xFC, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0xA4, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x2C, 0x03, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x2F, 0xF0, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x5F, 0xF5, 0x40, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xAF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x0B, 0xE0, 0x07, 0xFF, 0xF3, 0xF8, 0x07, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x9B, 0xFF, 0x01,
-    0xFF, 0x40, 0xFF, 0xC0, 0xFF, 0xC0, 0x2F, 0xE0, 0x3F, 0xD0, 0x0B, 0xF8, 0x1F, 0xF0, 0x03, 0xFD,
-    0x0B, 0xFC, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x3F, 0xE0, 0x2F, 0xF0, 0x2F,
-    0xF4, 0x0B, 0xFE, 0x6F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xBF, 0xC0, 0x02, 0xFF,
-    0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7E,
-    0x5B, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC,
-    0xBF, 0xD0, 0x01, 0xFE, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFD, 0x7F, 0xF0, 0x0F,
-    0xFC, 0x07, 0xFC, 0x07, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xE0,
-    0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x7F,
-    0xC0, 0xBF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFC, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0,
-    0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x2F,
-    0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0xAB, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xBF, 0xF8,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFE, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0x2F, 0xE0,
-    0x7F, 0xE0, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0x9F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x02, 0xFE, 0x07, 0xFD, 0x00, 0x3F,
-    0xD0, 0x3F, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0x40, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0F,
-    0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x7F, 0xC0,
-    0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x3F,
-    0xD0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B,
-    0xFD, 0x02, 0xFF, 0x40, 0x1F, 0xCB, 0xFF, 0xC3, 0xFF, 0xF0, 0x0B, 0xFB, 0xFF, 0xFA, 0xFF, 0xFE,
-    0x03, 0xFF, 0xD7, 0xFF, 0xF5, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xF0, 0x1F, 0xF0, 0x3F, 0xE0, 0x1F,
-    0xF4, 0x07, 0xFC, 0x1F, 0xF0, 0x0B, 0xFC, 0x02, 0xFE, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xFF, 0x43,
-    0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x7F, 0xC0, 0x1F, 0xF0,
-    0x07, 0xFC, 0x2F, 0xF0, 0x0B, 0xF8, 0x02, 0xFE, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x43, 0xFD,
-    0x00, 0xFF, 0x40, 0x3F, 0xC0, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x7F, 0xC0, 0x1F, 0xF0, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFD, 0x00, 0x1F, 0xCB, 0xFF, 0xD0, 0x0B,
-    0xFB, 0xFF, 0xFC, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0,
-    0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F,
-    0xD0, 0x7F, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00,
-    0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x6F, 0xF4, 0xBF, 0xD0,
-    0x3F, 0xE3, 0xFE, 0x00, 0xBF, 0xDF, 0xF0, 0x02, 0xFF, 0x7F, 0xC0, 0x0B, 0xFA, 0xFE, 0x00, 0x3F,
-    0xEB, 0xF8, 0x00, 0xFF, 0x6F, 0xE0, 0x07, 0xFC, 0xBF, 0xC0, 0x3F, 0xE1, 0xFF, 0x87, 0xFF, 0x03,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0xC0, 0x00, 0x7F, 0x3F, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0xE5, 0xFF, 0xC0, 0x0F, 0xF8, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F,
-    0xE0, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0xFF,
-    0x80, 0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xF5, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xBF, 0xFE, 0x00, 0x1F, 0xF2, 0xFF, 0x40, 0x02, 0xFE, 0x01, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFD, 0xFE, 0x03, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F,
-    0xF4, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF4, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF,
-    0xC0, 0x0F, 0xF0, 0xBF, 0x80, 0x1F, 0xF0, 0xBF, 0x80, 0x2F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF,
-    0xE1, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFC, 0xBF, 0x80, 0x00,
-    0x40, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD2, 0xFD, 0x01, 0xFD, 0xBF, 0xC0, 0x2F, 0xEF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x03, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xF8, 0x0F, 0xF8, 0x07, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0x0A, 0x40, 0x7F, 0xE0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x40, 0x7F,
-    0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xFE, 0x00, 0x0B, 0xFF, 0xFD, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x1B, 0xFD, 0x54, 0x0F, 0xF8,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xD1, 0x40, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x0F,
-    0xFF, 0x40, 0x00, 0x50, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0xFF, 0x80,
-    0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x02, 0xFE,
-    0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x3F, 0xE0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x07, 0xFC, 0x07,
-    0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xD2, 0xFF, 0xD0, 0x0F, 0xFF, 0xFB, 0xF4,
-    0x03, 0xFF, 0xF5, 0xFC, 0x00, 0x3F, 0xF4, 0x7F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x03, 0xFD, 0x7F, 0xC0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0F, 0xF4, 0x3F, 0xC0, 0x2F, 0xF0, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x2F, 0xD3,
-    0xFC, 0x00, 0x1F, 0xDB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0x80,
-    0x2F, 0xF4, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0xF4, 0x0B, 0xFC, 0x3F, 0xC0, 0x7F, 0xF4, 0x0F, 0xF4,
-    0x3F, 0xC0, 0xFF, 0xF4, 0x1F, 0xF0, 0x3F, 0xC1, 0xFF, 0xF4, 0x3F, 0xD0, 0x3F, 0xC2, 0xFB, 0xF4,
-    0x7F, 0xC0, 0x3F, 0xC3, 0xF3, 0xF4, 0xBF, 0x40, 0x3F, 0xCB, 0xF3, 0xF4, 0xFF, 0x00, 0x3F, 0xCF,
-    0xD3, 0xF6, 0xFD, 0x00, 0x3F, 0xDF, 0xC3, 0xF7, 0xFC, 0x00, 0x2F, 0xEF, 0x43, 0xF7, 0xF8, 0x00,
-    0x2F, 0xFF, 0x03, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xFC, 0x03, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x7F,
-    0xC0, 0x00, 0x0F, 0xF7, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x02, 0xFF, 0x0F, 0xF4, 0x00, 0x1F, 0xF4, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00,
-    0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2,
-    0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x40, 0x15, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF9, 0x55, 0x00, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2B, 0xC0, 0x00, 0x1F, 0xFC,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xE4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x01,
-    0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x01, 0xA0, 0x00, 0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
-    0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
-    0xBE, 0x69, 0x00, 0x2E, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00,
-    0x07, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0xC0,
-    0x03, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00,
-    0x7F, 0xD0, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x04, 0xFF, 0xFE, 0x40, 0xE7, 0xFF,
-    0xFF, 0xFF, 0x9F, 0x5B, 0xFF, 0xFE, 0x50, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x02, 0xFF, 0x00,
-    0x3F, 0xF0, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00,
-    0x01, 0xBF, 0xE4, 0x00, 0xBF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x0B, 0xFF, 0xAB, 0x41, 0xFF, 0x80,
-    0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x01, 0xC0, 0x3F, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xD4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x96, 0xE0, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x05, 0xFF, 0x95, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xEA, 0xAA, 0x90,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x09,
-    0x00, 0x02, 0x40, 0xBD, 0xBF, 0x6F, 0x83, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xE0,
-    0x7F, 0x80, 0x3F, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xD0, 0x2F,
-    0x80, 0x2F, 0xFB, 0xFD, 0x02, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF8, 0x0E, 0x05, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x0F, 0xF4, 0x0B, 0xF4, 0x02,
-    0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x02,
-    0xFD, 0x3F, 0xC0, 0x00, 0x1F, 0xDB, 0xF4, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x01, 0x5B,
-    0xFD, 0x50, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xAF, 0xFE, 0xA0, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
-    0x69, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x40, 0x3F, 0xE6, 0xFC,
-    0x01, 0xFE, 0x00, 0x10, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x0F, 0xF7, 0xFF, 0x00, 0x7F, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xF0,
-    0x1F, 0xC0, 0x2F, 0xE0, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x24, 0x00, 0x7F, 0x80, 0xBE, 0xAB, 0xFD, 0x02,
-    0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1F, 0x42, 0xE0, 0xFF, 0x2F,
-    0xD3, 0xF8, 0xBF, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xFE, 0xFF, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x03, 0xE0, 0x00, 0x00,
-    0xBD, 0x00, 0xB8, 0x06, 0xFF, 0x82, 0xF0, 0x1F, 0x01, 0xFF, 0xFC, 0x0B, 0x83, 0xD0, 0x7E, 0x01,
-    0x40, 0x3C, 0x3C, 0x0F, 0xC0, 0x00, 0x02, 0xD7, 0x80, 0xF4, 0x00, 0x00, 0x1E, 0xB4, 0x1F, 0x00,
-    0x00, 0x01, 0xFB, 0x41, 0xF0, 0x00, 0x00, 0x0F, 0xB4, 0x1F, 0x00, 0x00, 0x01, 0xF7, 0x80, 0xF4,
-    0x00, 0x00, 0x1E, 0x3C, 0x0F, 0x80, 0x00, 0x02, 0xD3, 0xC0, 0x7D, 0x00, 0x00, 0x3C, 0x2F, 0x03,
-    0xFF, 0xFC, 0x0B, 0xC0, 0xF4, 0x0B, 0xFF, 0x81, 0xF0, 0x07, 0xE0, 0x01, 0x00, 0x7D, 0x00, 0x1F,
-    0xD0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xD0, 0xFF, 0xFF, 0x0F, 0xE2, 0xFC,
-    0x7F, 0x03, 0xF2, 0xF4, 0x0F, 0x8F, 0xD0, 0x7D, 0x3F, 0x02, 0xF0, 0xFD, 0x1F, 0xC2, 0xFF, 0xFE,
-    0x03, 0xFD, 0xF4, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0xFF,
-    0x47, 0xFD, 0x03, 0xFE, 0x0F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x3F, 0xF0, 0xFF, 0xC0, 0xBF, 0xC2,
-    0xFF, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x2F, 0xF0,
-    0xBF, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0B, 0xE0, 0x2F, 0x80, 0x01, 0x00, 0x04, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x85, 0x55, 0x55, 0xBE, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x54,
-    0x2A, 0xAA, 0x4F, 0xFF, 0xE3, 0xFF, 0xF5, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x03,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0xB8, 0x3F, 0xFD, 0x02, 0xF0, 0x1F, 0x03, 0xFF, 0xF8, 0x0B, 0x83,
-    0xD0, 0x3D, 0x0B, 0xD0, 0x3C, 0x3C, 0x03, 0xD0, 0x3D, 0x02, 0xD7, 0x80, 0x3D, 0x03, 0xD0, 0x1E,
-    0xB4, 0x03, 0xD0, 0xBC, 0x01, 0xFB, 0x40, 0x3F, 0xFF, 0x40, 0x0F, 0xB4, 0x03, 0xFF, 0xD0, 0x01,
-    0xF7, 0x80, 0x3D, 0x2F, 0x00, 0x1E, 0x3C, 0x03, 0xD0, 0xF8, 0x02, 0xD3, 0xC0, 0x3D, 0x07, 0xC0,
-    0x3C, 0x2F, 0x03, 0xD0, 0x3E, 0x0B, 0xC0, 0xF4, 0x3D, 0x01, 0xF5, 0xF0, 0x07, 0xE0, 0x00, 0x00,
-    0x7D, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0xFC, 0x1F,
-    0xEB, 0xF8, 0xBD, 0x03, 0xF3, 0xF0, 0x0B, 0xCF, 0xC0, 0x2F, 0x2F, 0x81, 0xFC, 0x3F, 0xFF, 0xD0,
-    0x7F, 0xFE, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xAA, 0xFF, 0xAA,
-    0x5F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x55, 0x7F, 0x95, 0x50, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F,
-    0xD0, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x01, 0x81, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x3F, 0xFF, 0xC0, 0xBE, 0xFF, 0x40, 0x40, 0xFD,
-    0x00, 0x03, 0xF0, 0x06, 0xBF, 0x40, 0x3F, 0xF0, 0x00, 0xAF, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x4F, 0x97, 0xFC, 0x3F, 0xFF, 0xE0, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0xFF,
-    0x80, 0xFF, 0x80, 0xBF, 0x80, 0x7F, 0x40, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x00, 0xFF, 0x40,
-    0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x2F, 0xE0,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x02, 0xFF,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xDF,
-    0xC0, 0x07, 0xFF, 0xFC, 0x3F, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0xBC, 0x7F, 0xFF, 0xF4, 0x3C, 0xBF, 0xFF, 0xF4, 0x3C,
-    0xFF, 0xFF, 0xF4, 0x3C, 0xFF, 0xFF, 0xF4, 0x3C, 0xFF, 0xFF, 0xF4, 0x3C, 0xFF, 0xFF, 0xF4, 0x3C,
-    0xBF, 0xFF, 0xF4, 0x3C, 0x7F, 0xFF, 0xF4, 0x3C, 0x3F, 0xFF, 0xF4, 0x3C, 0x1F, 0xFF, 0xF4, 0x3C,
-    0x07, 0xFF, 0xF4, 0x3C, 0x00, 0x14, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C,
-    0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C,
-    0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C,
-    0x00, 0x00, 0xA4, 0x28, 0x01, 0x40, 0x7F, 0xC3, 0xFF, 0x0F, 0xFC, 0x3F, 0xD0, 0x14, 0x00, 0x0B,
-    0xC0, 0x7F, 0x80, 0x7F, 0x80, 0xBE, 0x9B, 0xFB, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0x0A, 0x80, 0x07,
-    0xFC, 0x03, 0xFF, 0xC2, 0xFF, 0xF8, 0x3F, 0xFF, 0x41, 0xD3, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0,
-    0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x02, 0xFE, 0x00,
-    0xFF, 0xFC, 0x2F, 0xDF, 0xD3, 0xF0, 0x7E, 0x7E, 0x07, 0xEB, 0xD0, 0xBD, 0xBD, 0x0F, 0xD7, 0xE1,
-    0xFC, 0x3F, 0xFF, 0x41, 0xFF, 0xD0, 0x01, 0x40, 0x00, 0x00, 0x50, 0x01, 0x40, 0x07, 0xF0, 0x1F,
-    0xC0, 0x0B, 0xF8, 0x2F, 0xD0, 0x07, 0xFC, 0x1F, 0xF0, 0x03, 0xFD, 0x0F, 0xF4, 0x02, 0xFF, 0x0B,
-    0xFC, 0x00, 0xFF, 0x43, 0xFC, 0x02, 0xFF, 0x0B, 0xFC, 0x07, 0xFD, 0x2F, 0xF0, 0x1F, 0xF4, 0x7F,
-    0xD0, 0x3F, 0xE0, 0xFF, 0x40, 0xBF, 0x83, 0xFE, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x04, 0x00, 0x10,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0xBE, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0x40, 0x03,
-    0xF4, 0x07, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xC0, 0x03, 0x8F, 0xE0, 0x07,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x0B,
-    0xF0, 0x1A, 0x80, 0x2F, 0xC1, 0xFC, 0x07, 0xFC, 0x03, 0xF8, 0x3F, 0x41, 0xFF, 0xC0, 0x3F, 0x4F,
-    0xE0, 0x3F, 0xF8, 0x07, 0xF2, 0xFC, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0x03, 0xF7, 0xF0, 0x00, 0x0F,
-    0xD0, 0xBD, 0x7F, 0x00, 0x03, 0xF8, 0x2F, 0x4B, 0xF0, 0x00, 0xBF, 0x03, 0xFA, 0xFF, 0x80, 0x1F,
-    0xC0, 0x7F, 0xFF, 0xFC, 0x03, 0xF4, 0x06, 0xAB, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x2F,
-    0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1A, 0x40, 0x00, 0xBE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xF0,
-    0x00, 0xBF, 0xF4, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xF4, 0x00, 0xBF, 0xFF, 0x00, 0x2F,
-    0x80, 0x00, 0xE3, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00,
-    0xFE, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0xBF, 0x80, 0x0B, 0xF0, 0x7F, 0x2F, 0xFF, 0xC0, 0x3F,
-    0x83, 0xF4, 0xBF, 0xFF, 0x80, 0xFD, 0x3F, 0x80, 0xD0, 0xFF, 0x07, 0xF2, 0xFC, 0x00, 0x03, 0xF8,
-    0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F,
-    0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0x40, 0x07,
-    0xFF, 0xFE, 0x03, 0xF8, 0x00, 0x2F, 0xFF, 0xF8, 0x2F, 0xC0, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xBF,
-    0x80, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0x07, 0xEB, 0xF8, 0x00, 0x7F, 0x00,
-    0x01, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x01, 0xAF, 0xE0, 0x0B,
-    0xF0, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xBF, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0x0B,
-    0xE0, 0xFE, 0x02, 0xA8, 0x00, 0x0B, 0xE2, 0xFC, 0x0B, 0xFC, 0xB9, 0x6F, 0xD7, 0xF0, 0x1F, 0xF8,
-    0xBF, 0xFF, 0x8F, 0xD0, 0x7F, 0xF4, 0x7F, 0xFD, 0x2F, 0x80, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0x03,
-    0xF7, 0xF0, 0x00, 0x00, 0xFC, 0x0F, 0xCB, 0xF0, 0x00, 0x03, 0xF4, 0x2F, 0x4F, 0xE0, 0x00, 0x0B,
-    0xE0, 0x7F, 0xAF, 0xF8, 0x00, 0x1F, 0xC0, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0x40, 0xAA, 0xBF, 0xE8,
-    0x00, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x00,
-    0x01, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x3F, 0xE0, 0x01, 0x0B, 0xFD, 0x5B, 0xC1, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFE,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFB, 0xF0,
-    0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xD2, 0xFC, 0x00, 0x00,
-    0xFF, 0x07, 0xF4, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x03, 0xFD, 0x01,
-    0xFE, 0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0xC0,
-    0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF,
-    0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F,
-    0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0,
-    0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0x7F, 0x80,
-    0xFE, 0x00, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02,
-    0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0,
-    0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0,
-    0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F,
-    0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x03, 0xD0, 0x00,
-    0x01, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3C, 0x0B, 0xF8, 0x00, 0x00,
-    0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x00, 0x2F,
-    0xD2, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x07, 0xFC,
-    0x07, 0xF8, 0x00, 0x03, 0xFD, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0xAA, 0xBF, 0x80, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x03, 0xFE, 0x00, 0x00,
-    0xFF, 0x41, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0x0F, 0xF2,
-    0xFD, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00,
-    0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC,
-    0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F,
-    0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0xF4,
-    0x3C, 0x00, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xBF,
-    0x00, 0x00, 0x0B, 0xF6, 0xFC, 0x00, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00,
-    0x0F, 0xF0, 0x7F, 0x40, 0x00, 0xBF, 0x41, 0xFD, 0x00, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0xD0,
-    0x1F, 0xE0, 0x01, 0xFF, 0xAA, 0xBF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0xFF, 0x07, 0xFC,
-    0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0xAA, 0xA8,
-    0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0xAB, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0xFF, 0xAA, 0xA8, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFE, 0xBF, 0xC0, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x40,
-    0x01, 0xFF, 0xE5, 0xAF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x05, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x01, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xF4, 0x2E, 0x00, 0x00,
-    0xFF, 0x1F, 0xD0, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xFA, 0xAA, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xC7, 0xF0, 0x00,
-    0xFE, 0x02, 0xFC, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x0F, 0x82, 0xF0, 0x00, 0xBF, 0x1F, 0xE0, 0x03, 0xFC, 0x7F, 0x40, 0x07, 0xD0, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x03, 0xFD, 0x00,
-    0x7F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x0B, 0xFC,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xF3, 0xFF, 0xFF, 0x80, 0xFF, 0x9F, 0xFF, 0xFD, 0x03, 0xFE, 0x2F, 0xFE,
-    0xA0, 0x1F, 0xF4, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x07, 0xFE, 0x03, 0xFD, 0x00, 0x3F,
-    0xF0, 0x1F, 0xF0, 0x07, 0xFF, 0x80, 0x7F, 0xEB, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x3D, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF0,
-    0x00, 0x3F, 0xC0, 0x0B, 0xFF, 0xD0, 0x01, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0xFF,
-    0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFB, 0xFD, 0x00, 0xFF, 0x00, 0x1F, 0xDB, 0xF8, 0x07, 0xF8, 0x00,
-    0xBF, 0x4F, 0xF0, 0x2F, 0xE0, 0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x40, 0x0F, 0xF0, 0xBF, 0x83, 0xFC,
-    0x00, 0x7F, 0x80, 0xFF, 0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x7F, 0x80, 0x0B, 0xF4, 0x0B, 0xF9,
-    0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xFB, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0xBF, 0xFF, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFC,
-    0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF,
-    0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xFD,
-    0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F,
-    0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0,
-    0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01,
-    0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA,
-    0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07,
-    0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD,
-    0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F,
-    0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4,
-    0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x1F, 0xD0,
-    0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x01, 0x50, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00,
-    0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03,
-    0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC,
-    0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F,
-    0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x7C, 0x00, 0x00, 0xFF, 0xFE, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-    0xF0, 0x00, 0x02, 0xE0, 0x7F, 0xD0, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC,
-    0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00,
-    0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F,
-    0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x07, 0xD0, 0x00, 0x00, 0xBF, 0x4F, 0xE0, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x3D,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xF4,
-    0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x1F,
-    0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F, 0xD0,
-    0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00,
-    0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF,
-    0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x00, 0x05, 0x03, 0xE0, 0x01,
-    0xF4, 0xBF, 0x80, 0x7F, 0xC2, 0xFE, 0x1F, 0xF0, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0x3F, 0xE0, 0x7F, 0xC0, 0xBF,
-    0x87, 0xF0, 0x02, 0xF8, 0x1C, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x01, 0xBF, 0xFD, 0xBD, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xF9, 0xBF, 0xF8, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x07, 0xFD, 0x00, 0xBF, 0xFC, 0x0F, 0xF8,
-    0x01, 0xFF, 0xFD, 0x1F, 0xF0, 0x03, 0xF7, 0xFD, 0x2F, 0xF0, 0x0F, 0xE3, 0xFD, 0x3F, 0xE0, 0x2F,
-    0xC3, 0xFD, 0x3F, 0xD0, 0x7F, 0x03, 0xFC, 0x3F, 0xC1, 0xFC, 0x07, 0xFC, 0x3F, 0xC3, 0xF4, 0x0B,
-    0xFC, 0x3F, 0xCF, 0xE0, 0x0F, 0xF4, 0x3F, 0xEF, 0xC0, 0x1F, 0xF0, 0x3F, 0xFF, 0x00, 0x3F, 0xE0,
-    0x3F, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0x7F, 0xFF, 0x80, 0x00, 0x1C, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC,
-    0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03,
-    0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00,
-    0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF,
-    0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07,
-    0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8,
-    0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F,
-    0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00,
-    0xFF, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x0B, 0xF4, 0x0F, 0xD0, 0x00, 0x05,
-    0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00,
-    0x07, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F,
-    0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0,
-    0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x00, 0xFE, 0x2F, 0xC0,
-    0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF,
-    0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00,
-    0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x3F,
-    0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x1F,
-    0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0xBF, 0x4B, 0xFC,
-    0x00, 0x07, 0xF9, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xA5,
-    0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFC,
-    0x0B, 0xFD, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF8, 0x0F,
-    0xF0, 0x07, 0xFD, 0x07, 0xFC, 0x07, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
-    0x3F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xE9, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF4,
-    0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFC, 0x2F, 0xFD, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0xF0,
-    0x00, 0x03, 0xFE, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00,
-    0xFF, 0x80, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x80, 0x1F, 0xF4, 0x00, 0x3F, 0xD3,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x4F, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0x2F, 0xFF, 0x80, 0x00, 0x2F,
-    0xF0, 0x01, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x06,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F,
-    0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B,
-    0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F,
-    0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B,
-    0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x54, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F,
-    0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B,
-    0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xC0,
-    0x03, 0xFF, 0xFB, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xB8, 0x1F, 0xF4, 0x00, 0x14, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0xF8, 0x01, 0xFF, 0xFC, 0xFE, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFF, 0xE6, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x3F, 0xF0, 0x0B, 0xF8, 0x0F, 0xF4,
-    0x02, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x42, 0xFF, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x1F, 0xF0, 0x2F,
-    0xF0, 0x0F, 0xF8, 0x0B, 0xFC, 0x07, 0xFD, 0x02, 0xFF, 0x9B, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xEF, 0xF0, 0x00, 0xBF, 0xD3, 0xF8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x82,
-    0xF0, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x2F, 0xC7, 0xF4, 0x00, 0x1F, 0x42, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B,
-    0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F,
-    0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF,
-    0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x07, 0xEF,
-    0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F,
-    0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBD, 0xFF, 0xE0, 0x01, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFD, 0x6F, 0xFF, 0x42, 0xFE, 0x1F,
-    0xF4, 0x0F, 0xFD, 0x01, 0xFE, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFD, 0x3F, 0xD0, 0x0F, 0xF8, 0x6F,
-    0xFC, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0xBF, 0x80, 0x1F,
-    0xFA, 0x94, 0x00, 0xBF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0xBF,
-    0xE2, 0xFF, 0xF8, 0x01, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFD, 0x3F, 0x3F, 0xFF, 0x40, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFE, 0x5B, 0x42, 0xFF,
-    0x40, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0x56, 0xC0, 0x3F, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x1B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x9B, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xD0, 0xFF, 0x47, 0xFC, 0x02, 0xFD, 0x3F, 0xE0,
-    0x0F, 0xF4, 0xFF, 0x46, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0xBF, 0xEA, 0x40,
-    0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xC0, 0x3F, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xD0, 0xFF, 0x47, 0xFC, 0x02, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x46, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0xBF, 0xEA, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x1F, 0xF8, 0x02, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0xFE, 0x02, 0xF8, 0x00, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x0F,
-    0xF4, 0x1F, 0xF0, 0x0B, 0xF4, 0x3F, 0xE0, 0x0F, 0xF4, 0x3F, 0xD1, 0xBF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFE, 0x00, 0xBF, 0xEA, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x7F, 0xE0, 0x0B, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF9,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0xFF, 0x1F, 0xD0, 0x03, 0xFC, 0xBF,
-    0x40, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xF4, 0x3F, 0xD1, 0xFF, 0x00, 0xBF, 0x4F, 0xF8,
-    0x03, 0xFD, 0x3F, 0xD1, 0xBF, 0xF1, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0x90,
-    0x00, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0x54, 0x00, 0xFF,
-    0x40, 0x1F, 0xE0, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x01, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x01, 0xFF,
-    0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x0F, 0xF4, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0,
-    0x0F, 0xF4, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x0F, 0xF0, 0x07, 0xFC, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE,
-    0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x15, 0x40, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xF4, 0x0F, 0xF2,
-    0xFC, 0x3F, 0x80, 0xBE, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00,
-    0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B,
-    0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xD0, 0xB8, 0x0F, 0xF1, 0xFD,
-    0x0F, 0xF2, 0xFC, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
-    0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00,
-    0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x2C, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x0D, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0xBF, 0xE3, 0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xF4, 0x3F, 0xFC,
-    0x7F, 0xD0, 0x0F, 0xF8, 0xBF, 0xC0, 0x0F, 0xF8, 0xFF, 0x80, 0x0F, 0xF4, 0xFF, 0x40, 0x1F, 0xF0,
-    0xFF, 0x40, 0x2F, 0xF0, 0xFF, 0x40, 0x3F, 0xE0, 0xBF, 0xC0, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x3D, 0x00, 0x07, 0xFF, 0xEF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
-    0x07, 0xFE, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC2, 0xFF, 0x40,
-    0x01, 0xFC, 0xBF, 0xFD, 0x00, 0x2F, 0xEF, 0xFF, 0xF0, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0x3F, 0xF0,
-    0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xF8, 0x02, 0xFE, 0x00,
-    0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF0, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x07,
-    0xFC, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x7F,
-    0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xD6, 0xFF, 0x4B, 0xFD, 0x03,
-    0xFE, 0x3F, 0xE0, 0x0B, 0xFD, 0xFF, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0xBF, 0xAF, 0xE0, 0x03, 0xFE,
-    0xBF, 0x80, 0x0F, 0xF6, 0xFE, 0x00, 0x7F, 0xCB, 0xFC, 0x03, 0xFE, 0x1F, 0xF8, 0x7F, 0xF0, 0x3F,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xD6, 0xFF, 0x4B, 0xFD, 0x03, 0xFE, 0x3F, 0xE0, 0x0B, 0xFD, 0xFF,
-    0x00, 0x2F, 0xF7, 0xFC, 0x00, 0xBF, 0xAF, 0xE0, 0x03, 0xFE, 0xBF, 0x80, 0x0F, 0xF6, 0xFE, 0x00,
-    0x7F, 0xCB, 0xFC, 0x03, 0xFE, 0x1F, 0xF8, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0xFE, 0x03, 0xF8, 0x01, 0x40, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xD6,
-    0xFF, 0x4B, 0xFD, 0x03, 0xFE, 0x3F, 0xE0, 0x0B, 0xFD, 0xFF, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0xBF,
-    0xAF, 0xE0, 0x03, 0xFE, 0xBF, 0x80, 0x0F, 0xF6, 0xFE, 0x00, 0x7F, 0xCB, 0xFC, 0x03, 0xFE, 0x1F,
-    0xF8, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2E, 0x00, 0x3F, 0xFE, 0xBD, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0xF4, 0x2F, 0xF0, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x6F, 0xF4, 0x2F, 0xF4,
-    0x0F, 0xF8, 0x3F, 0xE0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0B, 0xF8, 0xBF, 0x80,
-    0x0F, 0xF8, 0xBF, 0x80, 0x0F, 0xF4, 0xBF, 0x80, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0x7F, 0xE1,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x1F, 0x42, 0xE0, 0x00, 0xFF, 0x1F, 0xD0, 0x03, 0xF8, 0xBF, 0x00, 0x07, 0xC0,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xF0, 0x3F, 0xF5, 0xBF, 0xD2, 0xFF, 0x40, 0xFF, 0x8F, 0xF8, 0x02, 0xFF, 0x7F,
-    0xC0, 0x0B, 0xFD, 0xFF, 0x00, 0x2F, 0xEB, 0xF8, 0x00, 0xFF, 0xAF, 0xE0, 0x03, 0xFD, 0xBF, 0x80,
-    0x1F, 0xF2, 0xFF, 0x00, 0xFF, 0x87, 0xFE, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x55, 0x55, 0x55, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0xFF, 0xEF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x4B, 0xFD, 0x02, 0xFF, 0x03, 0xFF, 0x80, 0xFF, 0x43, 0xFF, 0xF0,
-    0x7F, 0xC2, 0xFF, 0xFC, 0x1F, 0xE2, 0xFA, 0xFE, 0x0B, 0xF9, 0xFC, 0xBF, 0x82, 0xFE, 0xFC, 0x3F,
-    0xD0, 0xBF, 0xFC, 0x1F, 0xF0, 0x2F, 0xFD, 0x0F, 0xF8, 0x07, 0xFF, 0x0B, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xBF, 0xF9, 0x00, 0x0B, 0x40, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0xFF, 0x40,
-    0x3F, 0xD0, 0x3F, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFF, 0x03, 0xFD,
-    0x00, 0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xFC, 0x07,
-    0xFC, 0x07, 0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0x40, 0x3F, 0xFF, 0xEF, 0xD0, 0x0F, 0xFF, 0xD7, 0xF0,
-    0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0x03,
-    0xFE, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC,
-    0x0B, 0xF8, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x1F, 0xF0, 0x0F, 0xFC, 0x07, 0xFC, 0x07, 0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0x40, 0x3F, 0xFF,
-    0xEF, 0xD0, 0x0F, 0xFF, 0xD7, 0xF0, 0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0x5F, 0xD0,
-    0x00, 0xBF, 0x01, 0xFC, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x03,
-    0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0xFF,
-    0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xFC, 0x07, 0xFC, 0x07, 0xFE, 0x01,
-    0xFF, 0x4B, 0xFF, 0x40, 0x3F, 0xFF, 0xEF, 0xD0, 0x0F, 0xFF, 0xD7, 0xF0, 0x00, 0xFF, 0xD1, 0xFC,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x81, 0xF4, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x02, 0xFC,
-    0x3F, 0x80, 0x00, 0x3D, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x0F, 0xF0, 0x2F, 0xE0, 0x07, 0xFC, 0x0F, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40,
-    0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x2F, 0xE0, 0x0B, 0xFC, 0x0F, 0xF4, 0x03, 0xFE,
-    0x03, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0xF0, 0x1F,
-    0xF8, 0x07, 0xFD, 0x2F, 0xFD, 0x00, 0xFF, 0xFF, 0xBF, 0x40, 0x3F, 0xFF, 0x5F, 0xC0, 0x03, 0xFF,
-    0x47, 0xF0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00,
-    0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2,
-    0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0xBF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xF5, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0x7F,
-    0xC0, 0x3F, 0xC0, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x1F, 0xF4, 0x0B, 0xFD,
-    0x03, 0xFF, 0x00, 0xBF, 0xF5, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xBF, 0xFF, 0x00,
-    0x1F, 0xF2, 0xFF, 0x80, 0x02, 0xFE, 0x01, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x01,
-    0xFE, 0x3F, 0xC0, 0x00, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0,
-    0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2, 0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00,
-    0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xA8, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F,
-    0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0,
-    0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00,
-    0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01,
-    0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF,
-    0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x15, 0x00, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x1F, 0xEA, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0,
-    0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00,
-    0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F,
-    0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F,
-    0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x15, 0x00, 0x14, 0x00,
-    0x3F, 0x00, 0xBC, 0x00, 0x3F, 0xEB, 0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F,
-    0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF,
-    0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xEF, 0xC0, 0x00, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x00, 0xBF, 0x4B,
-    0xF0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x7F, 0x40, 0x01, 0xFF, 0x01, 0xFE, 0x00,
-    0x0F, 0xF4, 0x07, 0xF8, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F,
-    0xC1, 0xFF, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC,
-    0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B,
-    0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F,
-    0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0xBD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xEB, 0xFC, 0x00, 0xFF, 0xF0,
-    0x00, 0xA0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x04, 0x00, 0x1F, 0xFE, 0x5A, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xE5, 0xB4, 0x0B, 0xFD, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x5B, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x8F, 0xE0,
-    0x00, 0x0B, 0xF4, 0x0F, 0xD0, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xEB,
-    0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xA0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x04, 0x00, 0x1F,
-    0xFE, 0x5A, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xE4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x3F, 0xC7, 0xF0, 0x03, 0xF8, 0x0B, 0xF0, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xE5, 0xB4,
-    0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFD,
-    0x5B, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xEB, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xA0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x04, 0x00, 0x1F, 0xFE, 0x5A, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFE,
-    0x5B, 0x42, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0x56,
-    0xC0, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xEB, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xA0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x04,
-    0x00, 0x1F, 0xFE, 0x5A, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x54, 0x00, 0xFD, 0x03,
-    0xF8, 0x00, 0x7F, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFE, 0x5B, 0x40, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xF5, 0x6C, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00,
-    0xFE, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x01,
-    0xFF, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x03, 0xFD,
-    0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00,
-    0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x07, 0xFF,
-    0x80, 0x1F, 0xFA, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF1, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFE, 0x6F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0xBF,
-    0xC0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x00,
-    0x00, 0xBF, 0xC0, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x03, 0xFD, 0x00,
-    0x7F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x0B, 0xFC,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xF3, 0xFF, 0xFF, 0x80, 0xFF, 0x9F, 0xFF, 0xFD, 0x03, 0xFE, 0x2F, 0xFE,
-    0xA0, 0x1F, 0xF4, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x07, 0xFE, 0x03, 0xFD, 0x00, 0x3F,
-    0xF0, 0x1F, 0xF0, 0x07, 0xFF, 0x80, 0x7F, 0xEB, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x50, 0x7F, 0x80, 0x00,
-    0xBF, 0xF2, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x47,
-    0xFF, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0xBF, 0x00,
-    0x2F, 0xF0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x0B, 0xFC,
-    0x03, 0xFD, 0x00, 0x2F, 0xF8, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0xBF,
-    0x00, 0x00, 0xBF, 0xE2, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x00,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xEA, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0xBF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1A, 0xAA, 0xA0, 0x00, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x0F, 0xF4, 0x7F, 0xC0, 0x2F, 0xD3,
-    0xFE, 0x00, 0xFF, 0x4F, 0xF4, 0x6F, 0xFC, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE,
-    0xA4, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x2C, 0x03, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x01, 0x40, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x54, 0x01,
-    0xF4, 0x03, 0xE0, 0x03, 0xFA, 0xBF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xD0, 0xFF, 0x47, 0xFC, 0x02, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x46, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0xBF, 0xEA, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x1F, 0xF8, 0x02, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xD0, 0xFF, 0x47, 0xFC, 0x02, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x46, 0xFF,
-    0xC7, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0xBF, 0xEA, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFE,
-    0xAA, 0xA0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x07, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFD, 0x0F, 0xF4, 0x7F, 0xC0, 0x2F, 0xD3, 0xFE, 0x00, 0xFF, 0x4F, 0xF4, 0x6F, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0xA4, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x01, 0xFF, 0x80, 0x2C, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFE, 0x80, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x01,
-    0x50, 0x00, 0x0F, 0xC0, 0x7F, 0x40, 0x00, 0x2F, 0xCB, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xA9, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFA,
-    0xAA, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x14, 0x00, 0x15, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x02, 0xFC, 0xBF, 0x40, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0x40,
-    0x7F, 0xC0, 0x2F, 0xD0, 0x3F, 0xE0, 0x0F, 0xF4, 0x0F, 0xF4, 0x6F, 0xFC, 0x07, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xEA, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x2C, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0x90, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xD7, 0xF4, 0x00, 0x03, 0xFC, 0x07, 0xF0, 0x00,
-    0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xEA, 0xFE, 0x00, 0xBF, 0xF4, 0x00, 0x24,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0A, 0xAA, 0xA0, 0xFF, 0x80, 0x7F, 0xFF, 0x83, 0xFD, 0x02, 0xFF,
-    0xFD, 0x1F, 0xF4, 0x0B, 0xFF, 0xF0, 0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x02, 0xFE, 0x03,
-    0xFE, 0x00, 0x0F, 0xF4, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F,
-    0xC7, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0xBE, 0x00, 0x7F, 0xFF, 0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xF9, 0xBF, 0xF0,
-    0x1F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFC, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x3F,
-    0xD0, 0xBF, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xFC, 0x03, 0xFE, 0x02, 0xFF, 0x02,
-    0xFF, 0x40, 0xBF, 0xE6, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFB, 0xFC, 0x00, 0x2F,
-    0xF2, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x07,
-    0xE5, 0xBF, 0xF4, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xFA, 0xFF, 0x00,
-    0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xEA, 0xFE, 0x00, 0xBF, 0xF4, 0x00, 0x24, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0A,
-    0xAA, 0xA0, 0xFF, 0x80, 0x7F, 0xFF, 0x83, 0xFD, 0x02, 0xFF, 0xFD, 0x1F, 0xF4, 0x0B, 0xFF, 0xF0,
-    0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x0F, 0xFD,
-    0x00, 0x3F, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
-    0x03, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0xAF, 0xE0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xBE, 0x00, 0x7F, 0xFF,
-    0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xF9, 0xBF, 0xF0, 0x1F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x02, 0xFE, 0x03, 0xFD, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x0F, 0xF0, 0x2F,
-    0xF0, 0x07, 0xFC, 0x0B, 0xFC, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0xBF, 0xE6, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFB, 0xFC, 0x00, 0x2F, 0xF2, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xE5, 0xBF, 0xF4, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xEA, 0xFE, 0x00,
-    0xBF, 0xF4, 0x00, 0x24, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0A, 0xAA, 0xA0, 0xFF, 0x80, 0x7F, 0xFF,
-    0x83, 0xFD, 0x02, 0xFF, 0xFD, 0x1F, 0xF4, 0x0B, 0xFF, 0xF0, 0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0xFF,
-    0x40, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xFE, 0x5B,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xBE, 0x00, 0x7F, 0xFF, 0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xF9, 0xBF, 0xF0, 0x1F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFC, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xBF,
-    0x81, 0xFF, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xFC, 0x03,
-    0xFE, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0xBF, 0xE6, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFB, 0xFC, 0x00, 0x2F, 0xF2, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x07, 0xE5, 0xBF, 0xF4, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-    0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0xAF, 0xE0, 0x0B, 0xFF, 0x40,
-    0x02, 0x40, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xAA, 0xAA, 0x0F, 0xF8, 0x07, 0xFF, 0xF8, 0x3F, 0xD0,
-    0x2F, 0xFF, 0xD1, 0xFF, 0x40, 0xBF, 0xFF, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x2F,
-    0xE0, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xFF, 0xD0, 0x03, 0xFC, 0x01, 0xFF, 0xE5, 0xBF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0xBE, 0x00, 0x7F, 0xFF, 0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xF9, 0xBF, 0xF0, 0x1F, 0xF4,
-    0x0F, 0xFC, 0x0F, 0xFC, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x3F, 0xD0, 0xBF,
-    0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xFC, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xFF, 0x40,
-    0xBF, 0xE6, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFB, 0xFC, 0x00, 0x2F, 0xF2, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xE5, 0xBF,
-    0xF4, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x01, 0xFE, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x03, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x1F,
-    0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0xFF,
-    0x40, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xFE,
-    0xAA, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x03,
-    0xFD, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0B,
-    0xF5, 0xFD, 0x00, 0x0F, 0xF0, 0x1F, 0xC0, 0x01, 0x50, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xCB, 0xFD, 0x00, 0x1F, 0xEF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x7F,
-    0xE0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40,
-    0xFF, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE,
-    0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xAA, 0xAF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0xFF,
-    0x80, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0x01, 0x40, 0x01, 0xFF, 0x2F, 0xF4, 0x02, 0xFE, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xD3, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x07, 0xFD, 0x01, 0xFF, 0x0B,
-    0xFC, 0x02, 0xFE, 0x0F, 0xF8, 0x03, 0xFD, 0x0F, 0xF0, 0x03, 0xFD, 0x1F, 0xF0, 0x03, 0xFC, 0x2F,
-    0xF0, 0x07, 0xFC, 0x2F, 0xE0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x7F,
-    0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2E, 0x00, 0x3F, 0xFE, 0xBD, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0xF4, 0x2F, 0xF0, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xF0, 0xFF, 0xFA, 0xF4, 0xBF, 0xFF, 0xFC,
-    0x3E, 0x0B, 0xFC, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xA0, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x06, 0xAA, 0xA8, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x14, 0x00, 0x14, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x3F, 0xEB, 0xF4, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x05,
-    0x00, 0x05, 0x03, 0xE0, 0x0F, 0xC0, 0xFF, 0xAF, 0xE0, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F,
-    0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFF, 0x90, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x3F,
-    0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x03,
-    0xFC, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0xE4, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x0F, 0xF8, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x2F,
-    0xE0, 0x0F, 0xF4, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xE0, 0x0F, 0xF4, 0x03, 0xFC,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x1F, 0xF0, 0x02, 0xFF, 0xFF, 0x80, 0xBF, 0xC0, 0x0F,
-    0xFF, 0xFC, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x03, 0xFE,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0x01,
-    0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0x00,
-    0x2F, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x07, 0xFD,
-    0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x0B,
-    0xFC, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x07, 0xFC, 0x01,
-    0xFF, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0xFF, 0x00,
-    0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x0B, 0xF8,
-    0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x02, 0xAF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x05, 0x40, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x06, 0xAF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x3F, 0x80, 0xBE, 0x00, 0x14,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x40, 0x07, 0xFC, 0x01,
-    0xFF, 0x80, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xBF, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0xE0,
-    0x00, 0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00,
-    0x02, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFE, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0x2F, 0xE0,
-    0x7F, 0xE0, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0x9F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x02, 0xFE, 0x07, 0xFD, 0x00, 0x3F,
-    0xD0, 0x3F, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0x40, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F,
-    0xE0, 0x1F, 0xF0, 0x1F, 0xF8, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x03, 0xFC,
-    0x3F, 0xE0, 0x00, 0x3F, 0xCF, 0xF8, 0x00, 0x07, 0xFB, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF9, 0xFF, 0x40, 0x02, 0xFF, 0x0F,
-    0xFC, 0x00, 0x2F, 0xE0, 0x7F, 0xD0, 0x03, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF4, 0x07,
-    0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFA,
-    0xAA, 0x80, 0xBF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF,
-    0xAA, 0xA8, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00,
-    0xBF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x7F, 0x40, 0x0F, 0xF0, 0x3F, 0xC0, 0x07, 0xFC, 0x0F, 0xD0, 0x02, 0xFF, 0x0B, 0xE0,
-    0x00, 0xFF, 0x83, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD2,
-    0xFD, 0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x7F, 0xCB, 0xF0, 0x00, 0xBF, 0xCF, 0xC0, 0x00, 0xFF, 0x8A,
-    0x40, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x07, 0xF4, 0x0F, 0xF8, 0x3F, 0xE0, 0x3F, 0xD0, 0xFF, 0x80, 0xFF,
-    0x02, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x02, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD1, 0xFD, 0x07, 0xFC,
-    0x3F, 0xE0, 0x7F, 0xC3, 0xFE, 0x0B, 0xF8, 0x2F, 0xC0, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x40, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0xBF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00,
-    0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-    0x1F, 0xFE, 0x00, 0xBF, 0xFC, 0x07, 0xFF, 0xE1, 0xFF, 0xF8, 0x0B, 0xFF, 0xC0, 0x0F, 0xFE, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x40,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x02, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x0B, 0xFF,
-    0xD0, 0x01, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x03,
-    0xFB, 0xFD, 0x00, 0xFF, 0x00, 0x1F, 0xDB, 0xF8, 0x07, 0xF8, 0x00, 0xBF, 0x4F, 0xF0, 0x2F, 0xE0,
-    0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x40, 0x0F, 0xF0, 0xBF, 0x83, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0x0F,
-    0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x7F, 0x80, 0x0B, 0xF4, 0x0B, 0xF9, 0xFD, 0x00, 0x3F, 0xC0, 0x1F,
-    0xFB, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xD0,
-    0x01, 0xFF, 0xF8, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0xD0, 0x01, 0xFC, 0xBF, 0xFD, 0x00, 0xBF, 0xBF, 0xFF, 0xC0,
-    0x3F, 0xFD, 0x7F, 0xF0, 0x0F, 0xFC, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x7F,
-    0xC0, 0xBF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x00,
-    0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0,
-    0x03, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xE0,
-    0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0xFF,
-    0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xEF, 0xF4, 0x03, 0xFC, 0x00,
-    0x7F, 0x6F, 0xE0, 0x1F, 0xE0, 0x02, 0xFD, 0x3F, 0xC0, 0xBF, 0x80, 0x0F, 0xF0, 0xFF, 0x02, 0xFD,
-    0x00, 0x3F, 0xC2, 0xFE, 0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xF1,
-    0xFE, 0x00, 0x2F, 0xD0, 0x2F, 0xE7, 0xF4, 0x00, 0xFF, 0x00, 0x7F, 0xEF, 0xC0, 0x03, 0xFC, 0x00,
-    0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xFF, 0xE0, 0x02, 0xFC,
-    0x00, 0x0F, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFD,
-    0x00, 0x1F, 0xCB, 0xFF, 0xD0, 0x0B, 0xFB, 0xFF, 0xFC, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0xFF, 0xC0,
-    0x7F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD,
-    0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B,
-    0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x05, 0x40, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x0F, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x0B, 0xFF, 0xD0, 0x01, 0xFE, 0x00, 0x3F, 0xFF,
-    0x80, 0x0B, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFB, 0xFD, 0x00, 0xFF, 0x00, 0x1F,
-    0xDB, 0xF8, 0x07, 0xF8, 0x00, 0xBF, 0x4F, 0xF0, 0x2F, 0xE0, 0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x40,
-    0x0F, 0xF0, 0xBF, 0x83, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x7F,
-    0x80, 0x0B, 0xF4, 0x0B, 0xF9, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xFB, 0xF0, 0x00, 0xFF, 0x00, 0x3F,
-    0xFF, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0xBF, 0x00,
-    0x03, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x05, 0x40, 0x01, 0x40, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC2, 0xFF, 0x40, 0x01, 0xFC, 0xBF, 0xFD, 0x00, 0x2F, 0xEF, 0xFF, 0xF0, 0x03, 0xFF, 0xD7, 0xFF,
-    0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xF8,
-    0x02, 0xFE, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF0, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xC0,
-    0x2F, 0xF0, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x0F, 0xF4, 0x03, 0xFC, 0x00,
-    0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xC3, 0xF0, 0xBF, 0xD0, 0x3F, 0x47, 0xF3, 0xFF, 0xF4, 0x15, 0x0B, 0xFB, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0x5F, 0xFC, 0x00, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0x1F,
-    0xF0, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x2F,
-    0xE0, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xC0, 0x01,
-    0xFE, 0x00, 0x2F, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFC,
-    0x00, 0xFF, 0x00, 0x0F, 0xEB, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x5F, 0xE0, 0x1F, 0xE0, 0x02, 0xFC,
-    0x3F, 0xC0, 0xBF, 0x40, 0x0F, 0xF0, 0xBF, 0x43, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x00,
-    0xFE, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF9, 0xFE, 0x00, 0x2F, 0xD0, 0x0F, 0xFB, 0xF4,
-    0x00, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0xFF,
-    0xF8, 0x00, 0x7F, 0x40, 0x02, 0xFF, 0xE0, 0x02, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xF0, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFD, 0x00, 0x1F, 0xCF, 0xFF, 0xD0, 0x0B, 0xFB,
-    0xFF, 0xFC, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xD0,
-    0x7F, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF,
-    0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1A, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x80, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC,
-    0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00,
-    0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F,
-    0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xA0, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x6F, 0xF4,
-    0xBF, 0xD0, 0x3F, 0xE3, 0xFE, 0x00, 0xBF, 0xDF, 0xF0, 0x02, 0xFF, 0x7F, 0xC0, 0x0B, 0xFA, 0xFE,
-    0x00, 0x3F, 0xEB, 0xF8, 0x00, 0xFF, 0x6F, 0xE0, 0x07, 0xFC, 0xBF, 0xC0, 0x3F, 0xE1, 0xFF, 0x87,
-    0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0xFF, 0xAF, 0xE0,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00,
-    0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03,
-    0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC,
-    0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F,
-    0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x3F, 0xEB, 0xF4, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x6F, 0xF4, 0x2F, 0xF4,
-    0x0F, 0xF8, 0x3F, 0xE0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0B, 0xF8, 0xBF, 0x80,
-    0x0F, 0xF8, 0xBF, 0x80, 0x0F, 0xF4, 0xBF, 0x80, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0x7F, 0xE1,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x15, 0x40, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x0F,
-    0xF4, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x01,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x00, 0x3F,
-    0xF8, 0x01, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x1F,
-    0xF4, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x03,
-    0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0xC0,
-    0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x3F, 0xC3, 0xFC,
-    0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xD6, 0xFF, 0x40, 0x0B, 0xFD, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x01,
-    0xFF, 0x00, 0x2F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0xBF, 0x80,
-    0x0F, 0xF4, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x7F, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x01,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xAA, 0xA8, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4,
-    0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE5,
-    0xBF, 0xFA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x02, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x9F,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFD, 0x7F, 0xFF, 0x81, 0xFF, 0x2F, 0xF0,
-    0x0F, 0xFE, 0x00, 0xFF, 0x3F, 0xE0, 0x0F, 0xFC, 0x02, 0xFF, 0x7F, 0xC0, 0x0F, 0xFC, 0x5F, 0xFD,
-    0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0xBF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0xBF, 0x80, 0x0F, 0xFA,
-    0xA4, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xE1,
-    0xFF, 0xFD, 0x01, 0xA0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xEB, 0xFF, 0xC0, 0x0F, 0xF8,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF0, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x5B, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0x0F,
-    0xF4, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x0B, 0xFC, 0x02, 0xFE, 0x00, 0x3F,
-    0xD0, 0x3F, 0xD0, 0x03, 0xFF, 0x03, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0xF4, 0x01, 0xFD, 0xBF, 0xC0, 0x0B, 0xFB, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFE, 0xBF, 0xFC, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x3F,
-    0xD0, 0x1F, 0xF0, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF5, 0xBF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xC3, 0xFD, 0x00,
-    0x0F, 0xF8, 0x2F, 0xF0, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x1F, 0xF0, 0x0F, 0xF8, 0x01, 0xFF, 0x00,
-    0xBF, 0xC0, 0x2F, 0xE0, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xD0, 0x07, 0xF6, 0xFF, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x54, 0x00, 0x0B,
-    0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xFC, 0x00, 0x3F, 0xE0,
-    0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x07, 0xFC,
-    0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x03, 0xFF, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00,
-    0xBF, 0x80, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0x54,
-    0x00, 0x14, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xD0, 0x01, 0xFD,
-    0xBF, 0xC0, 0x02, 0xFE, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFE, 0xAF, 0xC0, 0x0F, 0xFC, 0x00, 0x40, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x01, 0x40, 0x01, 0xFF, 0x40,
-    0x7E, 0x56, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x70, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x29, 0x01, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xC7,
-    0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFE, 0xAF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03,
-    0xFD, 0x01, 0x40, 0x01, 0xFF, 0x40, 0x7E, 0x56, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xCB, 0xF0, 0x03, 0xF8, 0x0B, 0xF0, 0x05,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFE, 0x00, 0xFF, 0x80, 0x70, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x2F, 0xF0, 0x29, 0x01, 0xFF, 0x80, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xEA, 0xFC, 0x03, 0xFF, 0x00, 0x10, 0x03, 0xFE,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x50, 0x00, 0x7F, 0xD0, 0x7E, 0x56,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x05, 0x7F,
-    0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE4, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF8, 0x0F, 0xF8, 0x07, 0x00, 0xFF, 0x40, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x0A, 0x40, 0x7F, 0xE0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x7F, 0x00, 0x01, 0x5F, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x05,
-    0x00, 0x05, 0x40, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x07, 0xF1, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xEA, 0xFC, 0x00,
-    0x3F, 0xF0, 0x01, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x05, 0x00, 0x07, 0xFD, 0x00, 0x7E, 0x56, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x54, 0x00, 0xFD, 0x07, 0xF8, 0x00, 0xBF, 0x1F, 0xE0, 0x00, 0x3F, 0xFF,
-    0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x40, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x80, 0x0F, 0xF8, 0x07, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xA4, 0x07, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x57, 0xFC, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0x90, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x1B, 0xFD, 0x54, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0,
-    0x00, 0x7F, 0xD1, 0x40, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x40, 0x07, 0xE0, 0x00,
-    0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x57, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x54, 0x00, 0x54, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x01, 0x43,
-    0xF4, 0x00, 0x3F, 0x2F, 0x40, 0x02, 0xFC, 0x64, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xD5, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x50, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x6B, 0xFF, 0xA8, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0xFF,
-    0x47, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0x1B, 0xFD, 0x54, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF4, 0x50, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xF4, 0x00,
-    0x01, 0xFF, 0xFB, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xC1, 0xFF, 0x80, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00,
-    0x07, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F,
-    0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0,
-    0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xC0, 0x02,
-    0xFF, 0xFB, 0xE0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xBC, 0x1F, 0xF4, 0x00, 0x14, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0xBF,
-    0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02,
-    0xFF, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0,
-    0x0F, 0xFC, 0x07, 0xFC, 0x07, 0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0x40, 0x3F, 0xFF, 0xEF, 0xD0, 0x0F,
-    0xFF, 0xD7, 0xF0, 0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
-    0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02,
-    0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD,
-    0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40,
-    0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x00,
-    0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0xBF, 0x80, 0x1F,
-    0xF0, 0x3F, 0xE0, 0x0B, 0xF8, 0x0F, 0xF4, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF8, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC,
-    0x01, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x7F, 0xE0, 0x1F, 0xF4, 0xBF, 0xF4, 0x03,
-    0xFF, 0xFE, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0x00, 0x0F, 0xFD, 0x1F, 0xC0, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x01, 0x50, 0x00, 0x02, 0xF0, 0x07, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF,
-    0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00,
-    0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x3F,
-    0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x14, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x02, 0xFE, 0xBF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x03, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x3F,
-    0xD0, 0x3F, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFF, 0x03, 0xFD, 0x00,
-    0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xFC, 0x07, 0xFC,
-    0x07, 0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0x40, 0x3F, 0xFF, 0xEF, 0xD0, 0x0F, 0xFF, 0xD7, 0xF0, 0x00,
-    0xFF, 0xD1, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0x00, 0x7C, 0x2E,
-    0x00, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02,
-    0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD,
-    0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40,
-    0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7E, 0xBC, 0x00,
-    0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0xBF, 0x80,
-    0x1F, 0xF0, 0x3F, 0xE0, 0x0B, 0xF8, 0x0F, 0xF4, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFF,
-    0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF8, 0x0F, 0xF0, 0x03, 0xFD, 0x03,
-    0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x7F, 0xE0, 0x1F, 0xF4, 0xBF, 0xF4,
-    0x03, 0xFF, 0xFE, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0x00, 0x0F, 0xFD, 0x1F, 0xC0, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x15, 0x40, 0x00, 0x03, 0xFE, 0x3F, 0xD0, 0x00, 0x01, 0xFE,
-    0x2F, 0xD0, 0x00, 0x00, 0xFD, 0x1F, 0xD0, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x14, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x07,
-    0xFC, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x3F,
-    0xE0, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xFF,
-    0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80,
-    0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00,
-    0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x41, 0x50,
-    0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x2F, 0xD3, 0xFD, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x1F,
-    0x81, 0xF8, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F,
-    0xC0, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x03, 0xFD, 0x00,
-    0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0xFF, 0xC0,
-    0x07, 0xFC, 0x07, 0xFE, 0x00, 0x1F, 0xF4, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xEF, 0xD0, 0x00, 0xFF,
-    0xFD, 0x7F, 0x00, 0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B,
-    0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07,
-    0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0xFF, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F,
-    0xF0, 0x03, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x3F, 0xE0,
-    0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x07, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x01, 0xFF,
-    0x80, 0x7F, 0xD2, 0xFF, 0xD0, 0x0F, 0xFF, 0xFB, 0xF4, 0x03, 0xFF, 0xF5, 0xFC, 0x00, 0x3F, 0xF4,
-    0x7F, 0x00, 0x00, 0x40, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x00, 0x0F,
-    0xF1, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xC7, 0xF8, 0x00, 0xFF, 0xE0, 0x03, 0xFD, 0x0F, 0xE0,
-    0x03, 0xFF, 0x80, 0x1F, 0xF0, 0x3F, 0xC0, 0x2F, 0xFE, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0xFF, 0xF8,
-    0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xFB, 0xF0, 0x2F, 0xE0, 0x0F, 0xF0, 0x3F, 0xAF, 0xC0, 0xFF, 0x00,
-    0x3F, 0xC1, 0xFC, 0xBF, 0x07, 0xF8, 0x00, 0xFF, 0x0F, 0xF2, 0xFC, 0x3F, 0xD0, 0x03, 0xFC, 0x7F,
-    0x4B, 0xF1, 0xFF, 0x00, 0x0F, 0xF3, 0xFC, 0x2F, 0xCB, 0xF4, 0x00, 0x3F, 0xCF, 0xD0, 0xBF, 0x3F,
-    0xC0, 0x00, 0xFE, 0xBF, 0x01, 0xFD, 0xFD, 0x00, 0x03, 0xFB, 0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x01,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00,
-    0x01, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0xF4, 0x03,
-    0xFC, 0x3F, 0xC0, 0x3F, 0xF4, 0x0B, 0xFC, 0x3F, 0xC0, 0x7F, 0xF4, 0x0F, 0xF4, 0x3F, 0xC0, 0xFF,
-    0xF4, 0x1F, 0xF0, 0x3F, 0xC1, 0xFF, 0xF4, 0x3F, 0xD0, 0x3F, 0xC2, 0xFB, 0xF4, 0x7F, 0xC0, 0x3F,
-    0xC3, 0xF3, 0xF4, 0xBF, 0x40, 0x3F, 0xCB, 0xF3, 0xF4, 0xFF, 0x00, 0x3F, 0xCF, 0xD3, 0xF6, 0xFD,
-    0x00, 0x3F, 0xDF, 0xC3, 0xF7, 0xFC, 0x00, 0x2F, 0xEF, 0x43, 0xF7, 0xF8, 0x00, 0x2F, 0xFF, 0x03,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFC, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0xFE, 0x00, 0x01, 0xFD, 0x03,
-    0xF4, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x3F,
-    0xD0, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x01, 0xFF,
-    0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0xBF, 0x4B, 0xFC, 0x00, 0x07, 0xF9, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x07, 0xF4,
-    0x0F, 0xD0, 0x00, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03,
-    0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00,
-    0x1F, 0xD2, 0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F,
-    0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x02, 0xE0, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x83, 0xFD,
-    0x00, 0x2F, 0xF0, 0x2F, 0xE0, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0,
-    0x00, 0xFF, 0x43, 0xFD, 0x00, 0x0B, 0xF4, 0xBF, 0xC0, 0x00, 0x7F, 0x9F, 0xF0, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAA, 0xA8, 0x01,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x55, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF9, 0x55, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAA, 0xA8,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFF, 0xD0, 0x05, 0x57, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFE, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xF0, 0x2F, 0xC0,
-    0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAA, 0xA8, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00,
-    0x0B, 0xE0, 0x2F, 0xC0, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x05, 0x57, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xE5, 0x54, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xE0, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x6B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x15, 0x40, 0x3F, 0xE0, 0x0F, 0xF0, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x54,
-    0x00, 0x55, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xBF, 0x40, 0x7F, 0x40, 0x05, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x1F, 0xE3, 0xFC, 0x7F, 0x40, 0xFD, 0x54, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xC2, 0xFF, 0xFB, 0xE1, 0xFF, 0xFF, 0xF0, 0xBC, 0x1F, 0xF4,
-    0x14, 0x00, 0x50, 0x00, 0x1A, 0xAA, 0x93, 0xFF, 0xFF, 0x7F, 0xFF, 0xE1, 0x55, 0x54, 0x1A, 0xAA,
-    0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x81, 0x55, 0x55, 0x50, 0x14, 0x00, 0x55, 0xF4,
-    0x03, 0xE3, 0xFA, 0xBF, 0x4F, 0xFF, 0xF8, 0x0B, 0xFF, 0x80, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xEB,
-    0xFF, 0xFF, 0x7F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0xFE, 0x2F, 0xC3, 0xF8, 0xBF, 0x0B, 0x81, 0xF4,
-    0x00, 0x02, 0xFF, 0x8B, 0xFF, 0x51, 0xFE, 0x03, 0xF4, 0xBF, 0x83, 0xF4, 0x0A, 0x40, 0x01, 0x40,
-    0x2F, 0xF4, 0x7E, 0xFC, 0xB8, 0x3D, 0xB8, 0x3D, 0x7E, 0xFC, 0x2F, 0xF4, 0x01, 0x40, 0x01, 0x54,
-    0x15, 0x40, 0x7F, 0xC7, 0xFC, 0x0F, 0xF0, 0xFF, 0x03, 0xF8, 0x3F, 0x80, 0xBD, 0x0B, 0xD0, 0x05,
-    0x00, 0x50, 0x00, 0x54, 0x00, 0x15, 0x7F, 0x01, 0xFD, 0x3F, 0xCB, 0xF4, 0x0F, 0xFF, 0xD0, 0x0B,
-    0xFF, 0x40, 0x01, 0x54, 0x00, 0x05, 0x43, 0xF1, 0xF8, 0xBD, 0x3F, 0x0F, 0xC3, 0xE1, 0xF8, 0x68,
-    0x00, 0x15, 0x05, 0x43, 0xF0, 0xFC, 0x7E, 0x1F, 0x87, 0xD1, 0xF4, 0xBD, 0x2F, 0x0A, 0x82, 0xA0,
-    0x15, 0x41, 0x50, 0x3F, 0xC7, 0xF8, 0x0F, 0xD2, 0xFC, 0x07, 0xF0, 0xFD, 0x01, 0xF4, 0x3F, 0x00,
-    0x50, 0x05, 0x00, 0x7C, 0x00, 0x03, 0xF8, 0x01, 0x4F, 0xD1, 0x4F, 0x19, 0x2E, 0x3E, 0x02, 0xF0,
-    0xBF, 0xFF, 0x80, 0xBF, 0xF8, 0x00, 0x14, 0x00, 0x00, 0x54, 0x00, 0x2F, 0xFF, 0x03, 0xFF, 0xFF,
-    0x1F, 0xEA, 0xFC, 0xBC, 0x01, 0xF5, 0x40, 0x01, 0x40, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF8, 0x0B,
-    0xF0, 0x1F, 0xF0, 0x3F, 0xD0, 0x7F, 0xC0, 0x15, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F,
-    0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0x3F, 0x00, 0x15, 0x00, 0xFF, 0x3F, 0xCF, 0xF2, 0xFC, 0x7F, 0x1F,
-    0xC3, 0xF0, 0x54, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0x3F,
-    0x00, 0x15, 0x00, 0x15, 0x41, 0xFF, 0x02, 0xFD, 0x03, 0xF8, 0x03, 0xF0, 0x01, 0x40, 0x00, 0x55,
-    0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x5B, 0x4F, 0xFC, 0x15, 0xF0, 0x03, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x74, 0x02, 0xD5, 0x0F, 0xFC,
-    0x3D, 0x51, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x2A, 0xAB, 0xC0, 0x00, 0x78,
-    0x00, 0x07, 0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x09, 0x00, 0x00, 0x55, 0x00,
-    0x7F, 0xC0, 0x2F, 0xF0, 0x0F, 0xF4, 0x2F, 0xF8, 0x1F, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0x8B, 0xD3, 0xD1, 0xF0, 0x7D, 0x0F, 0x80, 0x90, 0x02, 0x80, 0x0F, 0x00, 0x78, 0x1B, 0xF9, 0xFF,
-    0xF4, 0x00, 0x00, 0x2A, 0xA8, 0x3F, 0xFC, 0x07, 0x80, 0x07, 0x40, 0x0B, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x3C, 0x1F, 0xFE, 0x6F, 0xE4, 0x2C, 0x00, 0xA0, 0x00, 0x6A, 0xAB, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x1F, 0xD0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0xBF, 0x43,
-    0xFF, 0xC0, 0xFF, 0xD0, 0x3F, 0xD0, 0x00, 0x0A, 0x80, 0x1F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F,
-    0x80, 0x3F, 0xD8, 0x3F, 0xFC, 0x1F, 0xFC, 0x02, 0xA4, 0x00, 0x01, 0xFC, 0x3F, 0xE3, 0xFD, 0x3F,
-    0xC0, 0x00, 0x1F, 0x43, 0xE0, 0xFE, 0x2F, 0xC3, 0xF8, 0xBF, 0x0B, 0x81, 0xF4, 0x05, 0x40, 0x3F,
-    0xF0, 0xBE, 0xFC, 0xF4, 0x3C, 0xF4, 0x3C, 0xBE, 0xFC, 0x3F, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0xFE, 0x0B, 0xF0, 0x3F, 0x00, 0x54, 0x00, 0x03, 0xE0, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0xFC,
-    0x57, 0xFC, 0x7F, 0xF8, 0x7F, 0xD0, 0x03, 0xF0, 0x3F, 0x03, 0xF4, 0x0F, 0xC0, 0x3F, 0xA0, 0xFF,
-    0xD0, 0xFF, 0x00, 0x00, 0x05, 0x40, 0xFC, 0x1F, 0x81, 0xF4, 0x2F, 0x03, 0xF0, 0x3F, 0x07, 0xE0,
-    0x68, 0x00, 0x0A, 0xAA, 0xAA, 0x07, 0xFF, 0xFF, 0xC2, 0xD0, 0x00, 0xF0, 0xF0, 0x00, 0x78, 0x3C,
-    0x00, 0x2D, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x38, 0x1D, 0xB9, 0xFD, 0x7C, 0x3F,
-    0xDF, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x15, 0x0F, 0xC0, 0x7F, 0x82, 0xFC, 0xBF, 0x40, 0x3F,
-    0xFF, 0x40, 0x07, 0xFF, 0x80, 0x00, 0x55, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x3F, 0xFC, 0x00,
-    0x3F, 0xFF, 0x80, 0x3F, 0xCB, 0xF0, 0x3F, 0x80, 0xBF, 0x05, 0x00, 0x05, 0x40, 0x14, 0x00, 0x14,
-    0x3E, 0x00, 0xFC, 0x3F, 0xEB, 0xF8, 0x1F, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x00,
-    0x55, 0x00, 0x1F, 0xFF, 0x41, 0xFF, 0xFF, 0x0F, 0xEA, 0xFE, 0x7D, 0x00, 0xF8, 0x50, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0x03, 0xD1, 0xFF, 0xFB, 0xF0, 0xFF, 0xFF, 0xF8, 0x7C, 0x0B, 0xF8,
-    0x05, 0x00, 0x10, 0x00, 0x1A, 0xAA, 0xA0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x05, 0x55, 0x50, 0x15,
-    0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFD, 0x6A, 0xAA, 0xAA, 0x80, 0x05, 0x55, 0x55, 0x41, 0xFF, 0xFF,
-    0xFD, 0x1A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xF8, 0x2A,
-    0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF0, 0xFF, 0xFA, 0xF8, 0x7F, 0xFF, 0xFC,
-    0x3E, 0x0B, 0xFD, 0x05, 0x00, 0x14, 0x00, 0x2A, 0xAA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
-    0xF5, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x07, 0xF8, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xD0, 0x1F, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF8, 0x07, 0xC0, 0x3C, 0x0B, 0xC3, 0xF4, 0x39,
-    0x00, 0x28, 0x00, 0x18, 0x3C, 0x00, 0x2C, 0x78, 0x00, 0x3C, 0xB9, 0x55, 0x7C, 0xFF, 0xFF, 0xF8,
-    0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x39, 0x55, 0x7C, 0x74, 0x00, 0x38, 0xB0,
-    0x00, 0x74, 0xBF, 0xFF, 0xF0, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x3D, 0x7E,
-    0x6D, 0xB0, 0x38, 0x1D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x2D, 0x7C, 0x1F, 0xF0, 0x0F, 0xC0, 0x3F,
-    0xF0, 0x74, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xBD, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00,
-    0x3C, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x41, 0xFF, 0xFF, 0xFD, 0x1A, 0xAA,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xF8, 0x2A, 0xAA, 0xAA, 0x40,
-    0x15, 0x40, 0xFF, 0x80, 0xFF, 0x01, 0xFD, 0x01, 0xFC, 0x01, 0x50, 0x01, 0x55, 0x07, 0xFD, 0x0F,
-    0xF4, 0x2F, 0xD0, 0xBF, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x03, 0xD1, 0xFF, 0xFB,
-    0xF0, 0xFF, 0xFF, 0xF8, 0x7C, 0x1F, 0xF8, 0x05, 0x00, 0x10, 0x00, 0x6A, 0x0B, 0xFC, 0x5F, 0xC0,
-    0xFC, 0x0F, 0x40, 0x50, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xE0, 0xFF, 0x8F, 0x83, 0xFC, 0xBF, 0x8F,
-    0xF0, 0xFE, 0x3F, 0xC3, 0xFC, 0x2E, 0x1F, 0xC0, 0xB8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x3F, 0x47, 0xF9, 0x7F, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF7, 0xEA, 0xAA,
-    0xB9, 0xD0, 0x00, 0x2D, 0xB0, 0x00, 0x0F, 0x28, 0x00, 0x02, 0x80, 0x05, 0x55, 0x55, 0x41, 0xFF,
-    0xFF, 0xFD, 0x1A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xF8,
-    0x2A, 0xAA, 0xAA, 0x40, 0x15, 0x05, 0x43, 0xF0, 0xFC, 0x3E, 0x0F, 0x87, 0xE1, 0xF4, 0xBD, 0x2F,
-    0x46, 0x81, 0xA0, 0x15, 0x4B, 0xFE, 0x6B, 0xD0, 0x2C, 0x03, 0xC0, 0x3C, 0x00, 0x04, 0x00, 0x04,
-    0x74, 0x52, 0xFF, 0xC7, 0x9F, 0xBF, 0xFC, 0xB0, 0xFF, 0xD1, 0x4B, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x06, 0x90, 0x1C, 0x1F,
-    0xFD, 0x7C, 0x3D, 0xBF, 0xF4, 0x74, 0x0B, 0xD0, 0x00, 0xB4, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2C, 0x0F, 0xFF, 0xF8, 0x2D, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x74, 0x3F, 0xFF, 0xF0, 0xB4, 0x7F, 0xC0, 0x50, 0x05, 0x00, 0x00,
-    0x81, 0x40, 0x1E, 0x0B, 0x43, 0xFF, 0xFF, 0x87, 0xEA, 0xF8, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x1F, 0xC2, 0xF9, 0x0F, 0x01, 0xE0, 0x2D, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F,
-    0xD7, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x70, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x50, 0x00,
-    0x0D, 0x60, 0x00, 0xCA, 0x30, 0x00, 0x90, 0x00, 0x84, 0x01, 0x20, 0x00, 0x00, 0x0C, 0x00, 0x03,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x05, 0x00, 0x60, 0x60, 0x00, 0x00, 0xA0, 0x97, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x70, 0xD0, 0x00, 0x00, 0x30, 0xD7, 0x04, 0x00, 0x00, 0x01, 0x0D, 0x70, 0x60, 0x00,
-    0x00, 0x50, 0xD0, 0x06, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC4,
-    0x01, 0x30, 0x00, 0x20, 0x01, 0xCA, 0x34, 0x00, 0x87, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0xD7, 0xA8, 0x02, 0xA8, 0x02, 0xAD, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xD0, 0x00,
-    0x38, 0x0B, 0xE0, 0x3F, 0x1F, 0xFF, 0x48, 0x00, 0x06, 0xC1, 0xFC, 0x3E, 0x03, 0xC0, 0x3E, 0x02,
-    0xF0, 0x06, 0x00, 0x01, 0xBE, 0x40, 0x3F, 0xFF, 0x82, 0xFA, 0xBF, 0x0F, 0x40, 0x3D, 0x78, 0xFC,
-    0xB8, 0x07, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x92, 0x03, 0xFE, 0x07, 0xF0,
-    0x3F, 0xD0, 0xF7, 0x80, 0x00, 0x00, 0x00, 0x50, 0xBD, 0x3F, 0x43, 0xE0, 0x1B, 0xD0, 0x0A, 0x90,
-    0x0B, 0xE0, 0x1F, 0xC0, 0xBC, 0x7E, 0x4A, 0x00, 0x90, 0x01, 0x40, 0xBD, 0x03, 0xE0, 0x1F, 0xC7,
-    0xF0, 0x0F, 0xCB, 0x74, 0xBE, 0x0E, 0x38, 0xD0, 0x2C, 0x1C, 0x0A, 0x00, 0xF8, 0x0B, 0xC0, 0x3C,
-    0x0B, 0xC3, 0xF4, 0x39, 0x00, 0x00, 0x0F, 0xEB, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x03, 0x80, 0x8E,
-    0x53, 0xFF, 0x82, 0xF4, 0x1E, 0xF0, 0x22, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xDB, 0xF4, 0x79, 0xBD,
-    0x7C, 0xB0, 0x38, 0x0D, 0xB0, 0x38, 0x0D, 0x79, 0xFE, 0x7C, 0x1F, 0xD7, 0xF0, 0x34, 0x07, 0x00,
-    0xBF, 0xDA, 0xBC, 0x02, 0xC0, 0x24, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF1, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0x42, 0xFE, 0x40, 0x00, 0x6F, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x82, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2B, 0xFF, 0xE4, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xAA,
-    0x4F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x54, 0x2A, 0xAA, 0xAA,
-    0xA9, 0x7F, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFA, 0x40, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xFF, 0xAB, 0xF8, 0x3F,
-    0xEB, 0xFF, 0xFF, 0xFF, 0xF0, 0x7D, 0x00, 0x06, 0xBF, 0xFF, 0x80, 0x10, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFA, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF9, 0x00, 0x00, 0xBF, 0xC0, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0x8A, 0x90, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x15, 0x55, 0x55, 0x55, 0x57, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x02, 0x44, 0x1F, 0xFD, 0x3C, 0x3C, 0x78, 0x3C, 0x78, 0x78, 0x7D, 0xF4,
-    0x3F, 0xB0, 0x00, 0x00, 0x01, 0xA0, 0x0F, 0xBC, 0x2D, 0x3C, 0x3F, 0xF8, 0x3D, 0x40, 0x3D, 0x60,
-    0x1F, 0xF0, 0x00, 0x00, 0x0F, 0x02, 0x80, 0x40, 0xB4, 0x3C, 0x0F, 0x07, 0x82, 0xD0, 0xB0, 0x00,
-    0x01, 0x90, 0x1F, 0xF8, 0x3C, 0x3C, 0x78, 0x3C, 0x74, 0x3C, 0x7D, 0xF4, 0x2F, 0xD0, 0x00, 0x00,
-    0x04, 0x04, 0x2C, 0x2D, 0x3C, 0x3C, 0x3C, 0x3C, 0x78, 0x78, 0x7D, 0xF4, 0x3E, 0x70, 0x00, 0x00,
-    0x02, 0x90, 0xBF, 0xC7, 0xC0, 0x2D, 0x00, 0xF0, 0x02, 0xE6, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x03, 0xC0, 0x25, 0xE0, 0x7F, 0xF4, 0x3C, 0x3C, 0x1E, 0x0F, 0x07, 0x47, 0x81, 0xF7, 0xD0,
-    0x2F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x60, 0x2F, 0xFC, 0x3D, 0x3C, 0x3C,
-    0x3C, 0x78, 0x78, 0xB4, 0x74, 0xB0, 0xB0, 0x04, 0x60, 0x60, 0x2F, 0xFE, 0xFC, 0x3D, 0x3D, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x78, 0x78, 0x78, 0xB4, 0xB4, 0xB4, 0xB0, 0xB0, 0xB0, 0x04, 0x60, 0x7F, 0xC2,
-    0xF0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x40, 0x00, 0x03, 0x00, 0xF5, 0x3F, 0xD1, 0xD0, 0x2D,
-    0x03, 0xC0, 0x3D, 0x02, 0xF4, 0x00, 0x00, 0x50, 0x17, 0xC2, 0xDB, 0x0E, 0x1D, 0xF0, 0x7B, 0x80,
-    0xFC, 0x03, 0xD0, 0x00, 0x05, 0x01, 0x41, 0xF3, 0xC0, 0x3F, 0xC0, 0x07, 0xD0, 0x03, 0xF4, 0x03,
-    0xDF, 0x03, 0xD2, 0xD0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xFA, 0xAA, 0x80, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x1F, 0x40, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xE0, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x2F, 0xFA, 0xAA, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x07,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0xD0, 0x2F, 0xE0, 0x03,
-    0xFD, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0xBF,
-    0xC5, 0x6F, 0xFC, 0x0F, 0xF8, 0xBF, 0xFF, 0x40, 0xFF, 0x4B, 0xFF, 0xD0, 0x0F, 0xF0, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAF, 0xC0, 0x3F, 0xF8, 0x00, 0x14, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x55, 0x54, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFD, 0x55,
-    0x54, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x01, 0x00, 0x1F, 0xFF, 0x56, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xEA, 0xFC, 0x03,
-    0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x50,
-    0x00, 0x7F, 0xD0, 0x7E, 0x56, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x0B,
-    0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0,
-    0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x1F,
-    0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x4F, 0xC0, 0x0F, 0xE7, 0xF4, 0x03, 0xF9, 0xFC, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF8, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF8, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF8, 0x00,
-    0x03, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x2A, 0xBF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFD, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF5, 0x7F, 0xF8, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x2F, 0xE0, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF,
-    0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0xBF, 0xD0, 0x03, 0xFC, 0x02, 0xFF, 0x43,
-    0xFF, 0xFC, 0x00, 0x7F, 0xEA, 0xFF, 0xF0, 0x3F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xAA, 0xAF, 0xFE, 0xBF, 0xF8, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x3F, 0xF0, 0x3F, 0xE0, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x0B,
-    0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xE0, 0xBF, 0xC0, 0x03, 0xFF, 0xAF, 0xFF, 0x03, 0xFE,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x7F, 0xC0, 0x03, 0xFF,
-    0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0xD0, 0x2F, 0xE0,
-    0x03, 0xFD, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x7F, 0xC0,
-    0xBF, 0xC0, 0x0B, 0xF8, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x07,
-    0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x02, 0xFF,
-    0x00, 0x00, 0xFF, 0x41, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0xFF, 0x80,
-    0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x3F, 0xF0, 0x00,
-    0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFE, 0x00,
-    0x7F, 0xC0, 0x07, 0xFF, 0x80, 0x1F, 0xE0, 0x03, 0xFF, 0xD0, 0x0B, 0xF4, 0x02, 0xFF, 0xF0, 0x03,
-    0xFC, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0x80, 0xBF, 0xBF, 0x80, 0x2F,
-    0xD0, 0x7F, 0xAF, 0xD0, 0x0F, 0xF4, 0x3F, 0xCF, 0xF0, 0x03, 0xFC, 0x2F, 0xD3, 0xFC, 0x00, 0xFF,
-    0x0F, 0xE1, 0xFE, 0x00, 0x7F, 0x8F, 0xF0, 0xBF, 0x40, 0x2F, 0xDB, 0xF4, 0x3F, 0xC0, 0x0F, 0xF7,
-    0xF8, 0x0F, 0xF0, 0x03, 0xFF, 0xFC, 0x03, 0xFC, 0x01, 0xFF, 0xFD, 0x01, 0xFE, 0x00, 0x7F, 0xFF,
-    0x00, 0xBF, 0x40, 0x2F, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFF, 0xC0,
-    0x07, 0xF8, 0x01, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x2F, 0xE0, 0x01,
-    0xFF, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0x3F,
-    0xD0, 0x00, 0x07, 0xF8, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xCB, 0xF8,
-    0x00, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x6A, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x3F,
-    0xE0, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x01, 0xFF,
-    0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x02, 0xFE, 0x00, 0x0F, 0xF4,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80,
-    0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFE, 0xAA, 0xBF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xEF, 0xC0, 0x00, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x00, 0xBF, 0x47, 0xF4,
-    0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x7F, 0x40, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x0B,
-    0xF4, 0x03, 0xF8, 0x00, 0x3F, 0xEA, 0xAF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xD1,
-    0xFF, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x02, 0xFD, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFA, 0xFF,
-    0xF8, 0x0B, 0xFC, 0x07, 0xFF, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x2F, 0xF0, 0x3F, 0xC0,
-    0x0F, 0xF8, 0x1F, 0xF0, 0x0B, 0xFD, 0x0B, 0xFE, 0xAF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x3F, 0xF0,
-    0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x02, 0xFF,
-    0xAB, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x40, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x03,
-    0xFD, 0x00, 0x7F, 0xD0, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xEA, 0xFF, 0xF8, 0x02, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF8,
-    0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x40,
-    0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x03,
-    0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0,
-    0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x0A, 0xFF, 0xFA, 0xAB,
-    0xFF, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x15, 0x40, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0xA0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x1F,
-    0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x03, 0xFD,
-    0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC3,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x6F, 0xE3, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0xBF, 0x4B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFC, 0x1F, 0xF4, 0x00,
-    0x00, 0x1F, 0xFC, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x7F, 0xC0, 0xBF, 0xC0, 0x00,
-    0x0F, 0xFE, 0x02, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xF0, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x07,
-    0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFA, 0x5B, 0xFF, 0x40, 0x10, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
-    0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x94, 0x1B, 0xFF, 0x42,
-    0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x80, 0x1F, 0xF0, 0x01, 0xFF, 0xE0, 0x07, 0xF8, 0x00, 0xFF,
-    0xF4, 0x02, 0xFD, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xFF,
-    0x80, 0x1F, 0xE0, 0x2F, 0xEF, 0xE0, 0x0B, 0xF4, 0x1F, 0xEB, 0xF4, 0x03, 0xFD, 0x0F, 0xF3, 0xFC,
-    0x00, 0xFF, 0x0B, 0xF4, 0xFF, 0x00, 0x3F, 0xC3, 0xF8, 0x7F, 0x80, 0x1F, 0xE3, 0xFC, 0x2F, 0xD0,
-    0x0B, 0xF6, 0xFD, 0x0F, 0xF0, 0x03, 0xFD, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-    0x7F, 0xFF, 0x40, 0x7F, 0x80, 0x1F, 0xFF, 0xC0, 0x2F, 0xD0, 0x0B, 0xFF, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFF, 0xE0, 0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x7F, 0xF4, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0x80,
-    0x1F, 0xE0, 0x03, 0xFF, 0xD0, 0x0B, 0xF4, 0x02, 0xFF, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0xFC, 0x00,
-    0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0x80, 0xBF, 0xBF, 0x80, 0x2F, 0xD0, 0x7F, 0xAF, 0xD0, 0x0F,
-    0xF4, 0x3F, 0xCF, 0xF0, 0x03, 0xFC, 0x2F, 0xD3, 0xFC, 0x00, 0xFF, 0x0F, 0xE1, 0xFE, 0x00, 0x7F,
-    0x8F, 0xF0, 0xBF, 0x40, 0x2F, 0xDB, 0xF4, 0x3F, 0xC0, 0x0F, 0xF7, 0xF8, 0x0F, 0xF0, 0x03, 0xFF,
-    0xFC, 0x03, 0xFC, 0x01, 0xFF, 0xFD, 0x01, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0xBF, 0x40, 0x2F, 0xFF,
-    0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFF, 0xC0, 0x07, 0xF8, 0x01, 0xFF, 0xD0,
-    0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x00, 0x3F, 0xD0,
-    0x7F, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xBF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x41, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0x0B, 0xFC, 0x01, 0xFF,
-    0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x3F,
-    0xD0, 0x0F, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x0B,
-    0xF8, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x02,
-    0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
-    0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x0E,
-    0xFF, 0xF0, 0x01, 0xFF, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xF0, 0x0F, 0xFF, 0x40, 0x02, 0xFE, 0x00,
-    0xFF, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01,
-    0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x03,
-    0xFB, 0xF8, 0x01, 0xFE, 0xFC, 0x00, 0x7F, 0xBF, 0x40, 0x1F, 0xDF, 0xD0, 0x0F, 0xEB, 0xF0, 0x02,
-    0xFC, 0xFD, 0x01, 0xFC, 0xFF, 0x00, 0x3F, 0xCF, 0xD0, 0x3F, 0x8F, 0xF0, 0x03, 0xFC, 0xFD, 0x07,
-    0xF1, 0xFE, 0x00, 0x7F, 0x8F, 0xD0, 0xFE, 0x2F, 0xD0, 0x0B, 0xF4, 0xBE, 0x2F, 0xC3, 0xFC, 0x00,
-    0xBF, 0x0B, 0xE3, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0xBE, 0xBF, 0x07, 0xF8, 0x00, 0xFE, 0x0B, 0xFF,
-    0xD0, 0xBF, 0x40, 0x1F, 0xE0, 0xBF, 0xFC, 0x0B, 0xF4, 0x02, 0xFD, 0x07, 0xFF, 0x40, 0xFF, 0x00,
-    0x3F, 0xC0, 0x7F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFD, 0x01, 0xFE, 0x00, 0x3F, 0x80, 0x7F,
-    0xC0, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x07,
-    0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F,
-    0xD0, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x02, 0xFF,
-    0xAA, 0xAF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x40,
-    0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00,
-    0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFA, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x1F,
-    0xF8, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x1F, 0xF4, 0x00, 0x03, 0xFD,
-    0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F,
-    0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xD0,
-    0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x40, 0x03, 0xFC,
-    0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xE0,
-    0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00,
-    0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x0B,
-    0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x7F,
-    0xC0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x0F, 0xF4, 0x03, 0xFD,
-    0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x3F, 0xD0,
-    0x6F, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xEA, 0x50, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAF, 0xC0, 0x3F, 0xF8, 0x00, 0x14, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x01, 0x00, 0x1F, 0xFF, 0x56, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xD0, 0x00, 0xFF, 0xC0,
-    0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00,
-    0x0B, 0xF4, 0x0F, 0xF4, 0x00, 0x01, 0xFE, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x00,
-    0x0F, 0xF2, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x1A, 0xBF, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFE, 0x40, 0x00, 0x00, 0x1B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x2F, 0xFD, 0x0F, 0xF0, 0x7F, 0xF4, 0x1F, 0xF8, 0x03, 0xFC, 0x03, 0xFE, 0x0B, 0xFC, 0x00, 0xFF,
-    0x00, 0xBF, 0xC3, 0xFD, 0x00, 0x7F, 0x80, 0x1F, 0xF0, 0xFF, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x02, 0xFE, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0x43, 0xFF, 0x01, 0xFE, 0x00,
-    0xFF, 0xC0, 0xBF, 0xF4, 0xBF, 0x42, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x0F, 0xF8,
-    0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00,
-    0x01, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xD0,
-    0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x02, 0xFE, 0x00,
-    0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0xBF, 0x80, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x0B, 0xFC, 0x00, 0x3F,
-    0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x02, 0xFF,
-    0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFE, 0xAA, 0xBF, 0xFA, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xD0, 0xFF, 0x80, 0x03, 0xFD, 0x0F,
-    0xF4, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0xBF, 0x82, 0xFE, 0x00, 0x0F,
-    0xF8, 0x3F, 0xD0, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0x03, 0xFF,
-    0x00, 0x3F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0A, 0xEA, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00,
-    0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xFF,
-    0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00,
-    0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x3F,
-    0xE0, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x7F, 0xC0,
-    0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x07,
-    0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xF4,
-    0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xAA, 0xBF, 0xFA, 0xAB, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x02, 0xFF, 0x00,
-    0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x07, 0xFC,
-    0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x1F,
-    0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x02, 0xFE, 0x00,
-    0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x07, 0xFC,
-    0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0F,
-    0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x02, 0xFE, 0x00,
-    0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x0B, 0xFE,
-    0xAA, 0xFF, 0xEA, 0xAF, 0xFA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xFD, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xFF, 0x40, 0x1F, 0xF5, 0x6F, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xE0, 0x07, 0xFC, 0x03,
-    0xFD, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0xFC, 0x07, 0xFC, 0x02, 0xFF, 0x40, 0xBF, 0xEA, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xF5, 0x00,
-    0x00, 0x0F, 0xF4, 0x02, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x1F, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0x00, 0x7F, 0xD5, 0xFF, 0xE0, 0x3F, 0xE0, 0x0B, 0xFC, 0x03,
-    0xFF, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x7F, 0xC0, 0x0F, 0xF4, 0x02, 0xFF, 0x0B, 0xFC,
-    0x00, 0xFF, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xFC, 0x0F, 0xF8, 0x02, 0xFF, 0xAB,
-    0xFF, 0x80, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x02, 0xFF,
-    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x1F, 0xF5, 0x7F, 0xFC, 0x0B, 0xFC, 0x03, 0xFF, 0x02,
-    0xFE, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x2F, 0xF0, 0x3F, 0xC0, 0x0F, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD,
-    0x0B, 0xFE, 0xAF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0xAF, 0xFF, 0x00, 0x04, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x55, 0x57, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0x55, 0x5F,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x7E, 0x56, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0x80, 0x3F, 0xFE, 0xBF, 0xFC, 0x00, 0x3F,
-    0xE0, 0x2F, 0xF8, 0x01, 0xFF, 0x80, 0x0F, 0xF4, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x0B,
-    0xFC, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xEA, 0xFF, 0x40,
-    0x00, 0x7F, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80,
-    0xBF, 0x80, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x3F, 0xD0, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x0F, 0xF0,
-    0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x1F, 0xFC, 0x02, 0xFF, 0x00, 0x3F,
-    0xF9, 0x6F, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFE, 0xAF, 0xFC, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x0B, 0xF8,
-    0x00, 0x03, 0xFF, 0x57, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xF8, 0x00, 0x01, 0xFF, 0x83, 0xFD, 0x00,
-    0x00, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF0, 0x00,
-    0x7F, 0xE0, 0x0F, 0xF8, 0x00, 0x7F, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xD0, 0x0B, 0xFF, 0xF7, 0xF4, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0x5F, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0x40, 0x3F, 0xD0, 0xBF, 0xC0,
-    0x0F, 0xF0, 0x3F, 0xE0, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x7F, 0x80, 0xFF,
-    0x40, 0x3F, 0xD0, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xFD, 0x2F, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xBF, 0x80, 0x03, 0xFF, 0x4F, 0xD0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xF9, 0x01, 0xFF, 0xE4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xBE,
-    0x00, 0x2F, 0xE7, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFD, 0x7F, 0xF0, 0x7F, 0xF0, 0x0F,
-    0xF4, 0xBF, 0xD0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF4, 0xBF, 0x80, 0x0F,
-    0xF0, 0xBF, 0x80, 0x2F, 0xF0, 0x7F, 0xC0, 0x3F, 0xD0, 0x3F, 0xE0, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x07, 0xFE, 0x03,
-    0xFD, 0x0F, 0xF8, 0x03, 0xFD, 0x1F, 0xF0, 0x07, 0xFC, 0x2F, 0xFA, 0xBF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0x90, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xD0, 0x7F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF4, 0x3F, 0xD0, 0x0F,
-    0xF4, 0x2F, 0xF0, 0x1F, 0xF4, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xE0, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFF, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x1C, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x24, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0xFF, 0x00,
-    0x7F, 0xFF, 0x3F, 0xD0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xF9, 0x7F, 0xFC, 0x1F, 0xF8, 0x03, 0xFF,
-    0x0B, 0xFC, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x0F, 0xF8, 0x3F, 0xD0, 0x07,
-    0xFC, 0x0F, 0xF4, 0x02, 0xFF, 0x03, 0xFD, 0x01, 0xFF, 0x40, 0xBF, 0xD1, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFE, 0x07, 0xFC, 0x0B, 0xFC, 0x07, 0xFC, 0x0F, 0xF4, 0x0B, 0xF8, 0x2F, 0xF5, 0xBF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xFA, 0x90, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x7F, 0x80, 0x1F, 0xFD, 0x02, 0xFF, 0xE0, 0x0B, 0xF4, 0x0B, 0xFF, 0xC0, 0x2F, 0xFF,
-    0x40, 0xFF, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xF8, 0x0F, 0xF0, 0x7F, 0xE4, 0x00, 0x00, 0xBF, 0xC1,
-    0xFE, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD7, 0xFE,
-    0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x3F, 0xC0,
-    0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xFC, 0x0F, 0xF0, 0x3F, 0xF4, 0x00,
-    0x2F, 0xFF, 0x81, 0xFF, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x2F, 0xE0, 0x0F, 0xFF, 0x80, 0x7F,
-    0xF4, 0x02, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFD, 0x02, 0x40, 0x3F, 0xE0,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x0A, 0xBF, 0xF8, 0x00, 0xFF, 0xF9, 0x00, 0x1F, 0xFF,
-    0xD0, 0x00, 0x56, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC6, 0x40, 0x2F, 0xF8, 0xBF,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xE0, 0x00, 0x05, 0x40, 0x00, 0x07, 0xF8, 0x01,
-    0xFF, 0x0B, 0xF8, 0x02, 0xFE, 0x0F, 0xF4, 0x03, 0xFD, 0x0F, 0xF0, 0x03, 0xFD, 0x1F, 0xF0, 0x03,
-    0xFC, 0x2F, 0xF0, 0x07, 0xFC, 0x3F, 0xE0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x7F, 0xC0, 0x2F, 0xF0, 0xBF, 0xC0, 0x3F, 0xF0, 0xBF, 0xC0, 0xBF, 0xE0, 0xBF, 0xD2, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xEF, 0xC0, 0x3F, 0xFF, 0x6F, 0xC0, 0x0F, 0xFD, 0x2F, 0x80, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x54, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x01,
-    0xFF, 0x0B, 0xF8, 0x02, 0xFE, 0x0F, 0xF4, 0x03, 0xFD, 0x0F, 0xF0, 0x03, 0xFD, 0x1F, 0xF0, 0x03,
-    0xFC, 0x2F, 0xF0, 0x07, 0xFC, 0x3F, 0xE0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x7F, 0xC0, 0x2F, 0xF0, 0xBF, 0xC0, 0x3F, 0xF0, 0xBF, 0xC0, 0xBF, 0xE0, 0xBF, 0xD2, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xEF, 0xC0, 0x3F, 0xFF, 0x6F, 0xC0, 0x0F, 0xFD, 0x2F, 0x80, 0x00, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0xBF, 0xD0, 0x2F, 0xE0, 0x1F, 0xF4, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x3F,
-    0xD0, 0xFF, 0xC0, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x1F, 0xF1,
-    0xFF, 0x00, 0x02, 0xFE, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x03, 0xFC, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xF9, 0x5F, 0xF8, 0x00, 0x3F, 0xD0, 0x3F,
-    0xD0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00,
-    0xFF, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x40,
-    0x7F, 0xC0, 0x5F, 0xFC, 0x02, 0xFE, 0x03, 0xFF, 0xE0, 0x0F, 0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0xD0,
-    0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xF0,
-    0x0B, 0xFF, 0x80, 0x0B, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x02, 0xFF,
-    0xF4, 0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x1F, 0xEF, 0xC0, 0xBF, 0xFF, 0x00, 0xBF, 0x7F, 0x03,
-    0xF7, 0xFC, 0x03, 0xFC, 0xFC, 0x2F, 0xDF, 0xE0, 0x0F, 0xF3, 0xF1, 0xFD, 0xBF, 0x40, 0x7F, 0x8F,
-    0xCF, 0xE3, 0xFC, 0x01, 0xFD, 0x3F, 0xBF, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0xF8, 0x3F, 0x80, 0x3F,
-    0xC3, 0xFF, 0xC1, 0xFE, 0x00, 0xFF, 0x0F, 0xFE, 0x0B, 0xF4, 0x07, 0xF8, 0x3F, 0xF0, 0x3F, 0xC0,
-    0x2F, 0xD0, 0xFF, 0x80, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0xBF, 0x80, 0x3F, 0xE0, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x0F, 0xF4, 0x07, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0x80,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x57, 0xFF,
-    0x02, 0xFF, 0x00, 0xBF, 0x80, 0xFF, 0x80, 0x3F, 0xD0, 0x3F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07,
-    0xFC, 0x07, 0xFC, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0x4B, 0xFC, 0x0F, 0xFC,
-    0x03, 0xFD, 0x0F, 0xF4, 0x03, 0xFE, 0x2F, 0xF0, 0x03, 0xFE, 0x3F, 0xE0, 0x03, 0xFE, 0x3F, 0xE0,
-    0x03, 0xFD, 0x3F, 0xD0, 0x07, 0xFC, 0x3F, 0xD0, 0x0B, 0xFC, 0x3F, 0xE0, 0x0F, 0xF4, 0x2F, 0xF4,
-    0x7F, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF4, 0x02, 0xFC, 0xFF, 0xFD, 0x03, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xD7, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x07, 0xFD, 0x01, 0xFF, 0x0B, 0xFC,
-    0x02, 0xFE, 0x0F, 0xF8, 0x03, 0xFE, 0x0F, 0xF4, 0x03, 0xFD, 0x1F, 0xF0, 0x03, 0xFC, 0x1F, 0xF0,
-    0x07, 0xFC, 0x2F, 0xE0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F, 0xC0, 0x0F, 0xF4, 0x7F, 0xC0,
-    0x0F, 0xF0, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0xD0, 0x00,
-    0x7F, 0x3F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xF5, 0xFF, 0xD0, 0x0F, 0xFC, 0x07,
-    0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x3F,
-    0xD0, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0F, 0xF8, 0x0B, 0xFD, 0x02, 0xFF,
-    0x00, 0xBF, 0xF4, 0xBF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xBF, 0xFF, 0x00, 0x1F, 0xF2,
-    0xFF, 0x80, 0x02, 0xFE, 0x01, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD,
-    0x07, 0xFF, 0x56, 0xC0, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02,
-    0xFF, 0x41, 0xA0, 0x1F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xFD, 0x02, 0xFF, 0x00, 0x2F, 0xCF,
-    0xFF, 0xC3, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFD, 0x03, 0xFF, 0xD7, 0xFF, 0xF5, 0xFF,
-    0x80, 0xFF, 0xC0, 0xBF, 0xF0, 0x2F, 0xE0, 0x7F, 0xD0, 0x2F, 0xF4, 0x0B, 0xF8, 0x2F, 0xF0, 0x0B,
-    0xFC, 0x03, 0xFD, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0xC1,
-    0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x7F, 0xC0, 0x2F, 0xE0, 0x0B, 0xF8, 0x2F, 0xE0, 0x0B, 0xF8,
-    0x03, 0xFD, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC1, 0xFF,
-    0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x0F,
-    0xF8, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x00,
-    0xBF, 0x40, 0xFF, 0x80, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x07, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF1,
-    0xFF, 0x00, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2A, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F,
-    0xF9, 0xFF, 0x7F, 0xF0, 0x2F, 0xF0, 0x7F, 0x87, 0xFD, 0x0F, 0xF4, 0x2F, 0xD0, 0xFF, 0x8B, 0xFC,
-    0x0F, 0xF0, 0x2F, 0xE3, 0xFE, 0x03, 0xFC, 0x0B, 0xF8, 0xFF, 0x41, 0xFF, 0x03, 0xFE, 0x3F, 0xD0,
-    0xBF, 0x80, 0xFF, 0x4F, 0xF4, 0x2F, 0xD0, 0xBF, 0xC2, 0xFF, 0x0F, 0xF0, 0x7F, 0xD0, 0x7F, 0xE7,
-    0xFD, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xF4, 0x02, 0xFF, 0x01,
-    0xFF, 0x80, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x0B, 0xF8, 0xBF, 0xC0, 0x00, 0x1F, 0xF7, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xEB, 0xF8,
-    0x00, 0x03, 0xFF, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x3F, 0xD0, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0x1F,
-    0xF8, 0x01, 0xFF, 0x40, 0x07, 0xF8, 0x01, 0xFF, 0x0B, 0xF8, 0x02, 0xFE, 0x0F, 0xF4, 0x03, 0xFD,
-    0x0F, 0xF0, 0x03, 0xFD, 0x1F, 0xF0, 0x03, 0xFC, 0x2F, 0xF0, 0x07, 0xFC, 0x3F, 0xE0, 0x0B, 0xF8,
-    0x3F, 0xD0, 0x0F, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x7F, 0xC0, 0x2F, 0xF0, 0xBF, 0xC0, 0x3F, 0xF0,
-    0xBF, 0xC0, 0xBF, 0xE0, 0xBF, 0xD2, 0xFF, 0xF5, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0x4F, 0xFD,
-    0x0F, 0xFD, 0x0B, 0xFC, 0x00, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x0B, 0xF0, 0x3F, 0xD0, 0x0F, 0xF4, 0xFF, 0x00, 0x3F, 0xC7, 0xFC, 0x01, 0xFF, 0x2F,
-    0xE0, 0x0B, 0xFC, 0xFF, 0x80, 0x3F, 0xE3, 0xFD, 0x00, 0xFF, 0x4F, 0xF4, 0x0F, 0xFC, 0x3F, 0xF5,
-    0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x8F, 0xF4, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x07, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x82, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0xFF, 0x40, 0x3F,
-    0xD0, 0x0F, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x0B,
-    0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x83, 0xFE, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0xFF, 0x40, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x1F, 0xF0, 0x0B, 0xFC, 0x03, 0xFF, 0x0B, 0xFC,
-    0x03, 0xFE, 0x00, 0xFF, 0x82, 0xFE, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0xBF, 0xD6, 0xFF, 0xF5, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xF7, 0xFF, 0xFE, 0xFC, 0x03, 0xFF, 0xF4, 0xFF, 0xFC, 0xBE, 0x00, 0x3F, 0xF4,
-    0x0F, 0xFC, 0x3F, 0x40, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x02, 0xFE, 0x00,
-    0xBF, 0x82, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF,
-    0x83, 0xFE, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0xFF, 0x40, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x07, 0xFC, 0x1F, 0xF0, 0x0B, 0xFC, 0x03, 0xFF, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x82,
-    0xFE, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0xBF, 0xD6, 0xFF, 0xF5, 0xFF, 0xFD, 0x1F, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xF4, 0xFF, 0xFC, 0x7F, 0xF0, 0x3F, 0xF4, 0x0F, 0xFC, 0x0B, 0xFC, 0x00,
-    0x40, 0x00, 0x10, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x57, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD5,
-    0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xAF, 0xFF, 0x00, 0xFF,
-    0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x07, 0xFC, 0x03, 0xFE, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xF5,
-    0x50, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xF8, 0x02, 0xFE, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xF4, 0x0F,
-    0xFE, 0xBF, 0xF4, 0x3F, 0xC0, 0x7F, 0xC0, 0x3F, 0xD1, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0x4B, 0xFC,
-    0x0B, 0xF8, 0x03, 0xFD, 0x2F, 0xE0, 0x1F, 0xF0, 0x2F, 0xF0, 0xFF, 0x40, 0x3F, 0xFB, 0xFF, 0x43,
-    0xFC, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF0, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0xBF, 0xF8, 0x1F, 0xF0, 0x0B, 0xFC, 0x2F, 0xF0, 0x07, 0xFC, 0x2F,
-    0xE0, 0x0B, 0xFC, 0x1F, 0xF0, 0x0F, 0xF4, 0x0F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFC, 0x02, 0x42, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x02, 0xAB,
-    0xFF, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x15, 0x5F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x03,
-    0xFF, 0x19, 0x07, 0xFF, 0x47, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x40, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xF0,
-    0x1F, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x03, 0xFD, 0x0F, 0xFD, 0x2F, 0xF0, 0x0F,
-    0xF0, 0x7F, 0xC0, 0x3F, 0xD0, 0x7F, 0xC2, 0xFE, 0x00, 0xBF, 0x82, 0xFF, 0xFF, 0xF4, 0x02, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xD1, 0xFF, 0xAB, 0xFC, 0x00,
-    0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x0B, 0xFC, 0x2F, 0xE0, 0x7F, 0xC0, 0x3F, 0xD0, 0xFF, 0x40, 0xFF,
-    0x83, 0xFF, 0x03, 0xFC, 0x02, 0xFF, 0xFF, 0xF4, 0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0x40, 0xBF, 0xC0,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0xBF,
-    0xC0, 0x0F, 0xF4, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0x0F, 0xFC, 0x3F, 0xD0,
-    0x02, 0xFF, 0x03, 0xFC, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x0F, 0xF8, 0x0B, 0xF8, 0x03, 0xFF, 0x00,
-    0xFF, 0x40, 0x00, 0x05, 0x50, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x07, 0xFC, 0x0B, 0xFC,
-    0x07, 0xFC, 0x0F, 0xF4, 0x0B, 0xF8, 0x2F, 0xF5, 0xBF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFA, 0x90, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF4,
-    0x07, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x0B, 0x81, 0xE0, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x0F,
-    0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x07, 0xFC, 0x0B, 0xFC, 0x07, 0xFC, 0x0F, 0xF4,
-    0x0B, 0xF8, 0x2F, 0xF5, 0xBF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xFA,
-    0x90, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0x80, 0x0F, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x01, 0x40, 0x02, 0xFF,
-    0x3F, 0xF4, 0x02, 0xFE, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xC3, 0xFF, 0x07, 0xFF,
-    0x01, 0xFF, 0x0B, 0xFD, 0x02, 0xFF, 0x0F, 0xFC, 0x02, 0xFE, 0x0F, 0xF4, 0x03, 0xFD, 0x0F, 0xF0,
-    0x03, 0xFC, 0x1F, 0xF0, 0x07, 0xFC, 0x2F, 0xE0, 0x0B, 0xFC, 0x3F, 0xD0, 0x0B, 0xF8, 0x3F, 0xD0,
-    0x0F, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xE0,
-    0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x3F, 0xF0, 0x07, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFD, 0x07, 0xFF, 0x56, 0xC0, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFF,
-    0x55, 0x40, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xE5, 0x50, 0x03, 0xFD, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x03, 0xFF, 0x41, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xF4, 0x0B, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x03, 0xFE, 0x0E, 0x40, 0x7F, 0xD0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x80,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00,
-    0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x01, 0xFF,
-    0x00, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC7, 0xD0, 0x3F, 0x7F, 0x80, 0xFD, 0xFD, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x07,
-    0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x03,
-    0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0xAB, 0xFF, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0xFF, 0xF8, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFE, 0x57, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x54, 0x00, 0x00, 0x7F,
-    0xC0, 0xBF, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0xEB,
-    0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xF0, 0x0B, 0xFC, 0x01, 0xFE, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x3F,
-    0xD0, 0x1F, 0xE0, 0x0B, 0xF8, 0x5B, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0x4F, 0xFF, 0x80, 0x0F, 0xFE,
-    0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0xFF,
-    0x40, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFC,
-    0x02, 0xFE, 0x00, 0x00, 0x07, 0xFD, 0x57, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xF0, 0x0F, 0xF8,
-    0x0B, 0xFC, 0x2F, 0xF0, 0x0F, 0xF4, 0x03, 0xFC, 0x3F, 0xE0, 0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xD0,
-    0x0F, 0xF8, 0x0F, 0xFC, 0x3F, 0xC0, 0x0B, 0xFF, 0xFF, 0xF4, 0x7F, 0xC0, 0x03, 0xFF, 0xFF, 0xD0,
-    0xBF, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x40, 0x01, 0xFE, 0x3F, 0xF4,
-    0x02, 0xFE, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xC3, 0xFF, 0x07, 0xFF, 0x01, 0xFF,
-    0x0B, 0xFC, 0x02, 0xFF, 0x0F, 0xFC, 0x02, 0xFE, 0x0F, 0xF4, 0x03, 0xFD, 0x0F, 0xF0, 0x03, 0xFC,
-    0x1F, 0xF0, 0x07, 0xFC, 0x2F, 0xE0, 0x0B, 0xFC, 0x3F, 0xD0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0F, 0xF4,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFD, 0x02, 0xFE, 0x01, 0xFF,
-    0x40, 0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x07, 0xFC,
-    0xBF, 0xC0, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFB, 0xFF, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0xFF, 0x80, 0x03, 0xFD, 0x0B,
-    0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x01, 0xFF,
-    0x0B, 0xF8, 0x02, 0xFE, 0x0F, 0xF4, 0x03, 0xFD, 0x0F, 0xF0, 0x03, 0xFD, 0x1F, 0xF0, 0x03, 0xFC,
-    0x2F, 0xF0, 0x07, 0xFC, 0x3F, 0xE0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x7F, 0xC0, 0x2F, 0xF0, 0xBF, 0xC0, 0x3F, 0xF0, 0xBF, 0xC0, 0xBF, 0xE0, 0xBF, 0xD2, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xEF, 0xC0, 0x3F, 0xFF, 0x6F, 0xC0, 0x0F, 0xFD, 0x2F, 0x80, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x05, 0x50, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x01, 0xFE,
-    0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x0F, 0xF2, 0xFD, 0x00, 0x00, 0x3F, 0xCF, 0xF0,
-    0x00, 0x00, 0xFF, 0xBF, 0x40, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0A, 0xBF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x01, 0xFF, 0x0B, 0xF8, 0x02, 0xFE, 0x0F, 0xF4, 0x03, 0xFD, 0x0F, 0xF0, 0x03, 0xFD, 0x1F,
-    0xF0, 0x03, 0xFC, 0x2F, 0xF0, 0x07, 0xFC, 0x3F, 0xE0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x7F, 0xC0, 0x2F, 0xF0, 0xBF, 0xC0, 0x3F, 0xF0, 0xBF, 0xC0, 0xBF, 0xE0, 0xBF,
-    0xD2, 0xFF, 0xD0, 0x7F, 0xFF, 0xEF, 0xC0, 0x3F, 0xFF, 0x6F, 0xC0, 0x0F, 0xFD, 0x2F, 0x80, 0x00,
-    0x41, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFD, 0x00, 0x1F, 0xF0, 0xFF, 0x80,
-    0x0F, 0xF4, 0x00, 0xBF, 0xC3, 0xFD, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x1F, 0xF4, 0x01, 0xFF, 0x00,
-    0x0F, 0xF0, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x2F, 0xF0, 0x02, 0xFE, 0x07,
-    0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x1F, 0xF0, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x3F,
-    0xF8, 0x03, 0xFE, 0x01, 0xFF, 0x01, 0xFF, 0xE0, 0x0F, 0xF0, 0x07, 0xFC, 0x0F, 0xFF, 0x80, 0xBF,
-    0xC0, 0x1F, 0xF0, 0x7F, 0xFE, 0x03, 0xFD, 0x00, 0x7F, 0xC3, 0xFF, 0xFC, 0x2F, 0xF0, 0x00, 0xFF,
-    0x5F, 0xEF, 0xF0, 0xFF, 0x40, 0x03, 0xFD, 0xFF, 0x3F, 0xCB, 0xFC, 0x00, 0x0F, 0xFF, 0xF4, 0xFF,
-    0x7F, 0xD0, 0x00, 0x2F, 0xFF, 0xC3, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFD, 0x0B, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xF0, 0x2F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF4, 0x02, 0xFD, 0x3F, 0xD0, 0x0F, 0xF0, 0x03,
-    0xFD, 0x3F, 0xD0, 0x0F, 0xF0, 0x07, 0xFC, 0x3F, 0xC0, 0x1F, 0xF0, 0x0B, 0xF8, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xF0, 0x1F, 0xF0, 0x3F, 0xC0, 0x7F, 0xF0, 0x3F, 0xD0, 0x3F,
-    0xC0, 0xFF, 0xF0, 0x7F, 0xC0, 0x3F, 0xC2, 0xFF, 0xF0, 0xFF, 0x40, 0x2F, 0xD3, 0xFF, 0xF1, 0xFF,
-    0x00, 0x2F, 0xEB, 0xFB, 0xF3, 0xFC, 0x00, 0x1F, 0xFF, 0xCB, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0x87,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xD0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x80, 0x00, 0x07,
-    0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFA, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFD, 0x07, 0xFC, 0x07, 0xFE, 0x0B, 0xF8, 0x02, 0xFF, 0x0F, 0xF8, 0x02,
-    0xFF, 0x0F, 0xF4, 0x03, 0xFE, 0x0F, 0xF0, 0x0B, 0xFD, 0x1F, 0xFA, 0xBF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0xFF, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0xAE, 0x40, 0x0B, 0xF8, 0x02, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x03, 0xFE, 0x5B, 0xFC, 0x1F, 0xF0, 0x03, 0xFC, 0x03,
-    0xFC, 0x2F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x2F, 0xE0, 0x03, 0xFD, 0x0B, 0xFC, 0x3F, 0xD0, 0x03,
-    0xFF, 0xBF, 0xF4, 0x3F, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x2F, 0xFF, 0x90, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xC0, 0x3F, 0xFE, 0xAB, 0xF0, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x00, 0x50, 0x00,
-    0xFF, 0x41, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0xFE, 0xAA, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFD,
-    0x00, 0x04, 0x00, 0x1F, 0xF0, 0x07, 0xFF, 0x96, 0xBC, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xD0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F,
-    0xFF, 0x40, 0x1F, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0x80, 0x7F, 0xFF, 0xF4, 0x03, 0xFE, 0x03,
-    0xFF, 0x96, 0xC0, 0x0F, 0xF4, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0x97, 0xFE, 0x55, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00,
-    0x00, 0xBF, 0x80, 0xBF, 0xE0, 0x7C, 0x03, 0xFD, 0x01, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x02, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xC0, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xDF, 0xE0, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x00, 0xFF, 0x4F,
-    0xF0, 0x00, 0x01, 0xFF, 0x0B, 0xF0, 0x00, 0x03, 0xFE, 0x5F, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xDF, 0xF3, 0xF8, 0x00,
-    0xBF, 0xCF, 0xF3, 0xFC, 0x00, 0xFF, 0x1F, 0xE3, 0xFC, 0x02, 0xFE, 0x2F, 0xD3, 0xFC, 0x07, 0xFC,
-    0x3F, 0xC2, 0xFC, 0x0F, 0xF8, 0x3F, 0xC2, 0xFD, 0x1F, 0xF0, 0x3F, 0xC2, 0xFD, 0x3F, 0xE0, 0x7F,
-    0x81, 0xFE, 0x7F, 0xC0, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x03, 0xFC, 0xFD, 0x00, 0x00, 0xBF,
-    0x4F, 0xE0, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x02, 0xFE, 0xBF, 0x7F, 0x80, 0x3F, 0xCF, 0xF3, 0xF8, 0x0B, 0xF8, 0xFE,
-    0x3F, 0xC1, 0xFF, 0x1F, 0xD3, 0xFC, 0x3F, 0xD2, 0xFD, 0x2F, 0xC7, 0xFC, 0x2F, 0xC2, 0xFD, 0x00,
-    0x3F, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00,
-    0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0xFC, 0x00,
-    0x0F, 0xF4, 0x00, 0xFF, 0x5F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xF1, 0xFD, 0x00, 0x1F, 0xF0, 0x03,
-    0xFD, 0x1F, 0xD0, 0x02, 0xFF, 0xAA, 0xBF, 0xD5, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC, 0x0B,
-    0xF9, 0xFD, 0xBF, 0x00, 0xBF, 0x80, 0xFF, 0x2F, 0xCB, 0xF0, 0x0F, 0xF4, 0x2F, 0xE3, 0xFC, 0xBF,
-    0x40, 0xFF, 0x07, 0xFC, 0x3F, 0xC7, 0xF8, 0x1F, 0xF0, 0xFF, 0x87, 0xF8, 0x7F, 0x81, 0xFE, 0x1F,
-    0xF0, 0xBF, 0x43, 0xFC, 0x2F, 0xE3, 0xFE, 0x0F, 0xF0, 0x3F, 0xC3, 0xFD, 0x7F, 0xC0, 0xFF, 0x03,
-    0xFC, 0x3F, 0xCF, 0xF8, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x07, 0xF4,
-    0x00, 0x3F, 0xFD, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xFB, 0xF0, 0x03,
-    0xFC, 0x00, 0xBF, 0x6F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC, 0x7F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD5, 0xFF, 0xBF,
-    0xFF, 0xC1, 0xFE, 0x03, 0xFD, 0xFD, 0xFF, 0x0B, 0xF4, 0x2F, 0xE7, 0xF6, 0xFC, 0x2F, 0xC1, 0xFF,
-    0x2F, 0xCB, 0xF4, 0xFF, 0x0F, 0xF4, 0xFF, 0x1F, 0xD3, 0xF8, 0x7F, 0xC3, 0xF8, 0x7F, 0x9F, 0xD3,
-    0xFD, 0x1F, 0xE0, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0x83, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xCB, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xD7, 0xFC,
-    0xFF, 0x40, 0x00, 0xBF, 0x8B, 0xFC, 0x7F, 0x80, 0x00, 0xFF, 0x0B, 0xF8, 0x7F, 0x80, 0x02, 0xFE,
-    0x0F, 0xF4, 0x7F, 0xC0, 0x03, 0xFC, 0x0F, 0xF0, 0x7F, 0xC0, 0x0B, 0xFC, 0x1F, 0xF0, 0x3F, 0xC0,
-    0x0F, 0xF4, 0x2F, 0xF0, 0x3F, 0xC0, 0x2F, 0xF0, 0x3F, 0xE0, 0x3F, 0xC0, 0x3F, 0xE0, 0x3F, 0xD0,
-    0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x07, 0xF0, 0xBF, 0x40, 0x00, 0x03, 0xF6, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFC, 0xBF, 0x3F, 0x40, 0x03, 0xF8, 0xFF, 0x3F, 0x80, 0x0B, 0xF0,
-    0xFE, 0x3F, 0x80, 0x0F, 0xE1, 0xFD, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC, 0x2F, 0xC0, 0x3F, 0x83, 0xFC,
-    0x2F, 0xC0, 0x00, 0x3F, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xF4, 0x01, 0xFE, 0x02, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x8F, 0xF0, 0x00, 0x02, 0xFF,
-    0xAA, 0xAB, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0x0B, 0xF8,
-    0xFF, 0x5F, 0xF0, 0x00, 0xBF, 0x80, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF4, 0x3F, 0xE1, 0xFF,
-    0x0F, 0xF0, 0x00, 0xFF, 0x43, 0xFC, 0x2F, 0xF0, 0xFF, 0x00, 0x1F, 0xF0, 0xBF, 0x82, 0xFE, 0x0F,
-    0xF4, 0x01, 0xFF, 0x0F, 0xF0, 0x3F, 0xD0, 0xFF, 0x40, 0x2F, 0xE2, 0xFF, 0x03, 0xFC, 0x0F, 0xF4,
-    0x03, 0xFD, 0x3F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x3F, 0xCB, 0xFC, 0x0B, 0xFC, 0x0B, 0xF8, 0x00,
-    0x00, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0x42, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xD0, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xF0, 0x0B, 0xF0, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0xFD, 0x1F, 0xD0, 0x00,
-    0xFE, 0x00, 0x2F, 0x9F, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFD, 0x5F, 0xFB, 0xFF, 0xF4, 0x01, 0xFE,
-    0x07, 0xF5, 0xFC, 0xFE, 0x00, 0xBF, 0x43, 0xFC, 0xBF, 0x2F, 0xC0, 0x2F, 0xC1, 0xFD, 0x3F, 0xCB,
-    0xF0, 0x0F, 0xF0, 0xFF, 0x0F, 0xE1, 0xFC, 0x03, 0xF8, 0x7F, 0x47, 0xF4, 0x7F, 0x01, 0xFD, 0x3F,
-    0xC2, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7C, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF9, 0x7F,
-    0xFC, 0x00, 0x0A, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xAA, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xF9, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x80, 0x00, 0x7E,
-    0x07, 0xFC, 0x00, 0x02, 0xF5, 0xFE, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x1B, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x02, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0A, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFF, 0xE4, 0x00, 0x3F, 0xE9, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x07, 0xF8, 0x7F, 0xC0, 0x3F, 0xC0, 0x2F, 0xE1, 0xFE,
-    0x00, 0xFF, 0x00, 0xFF, 0x4B, 0xF4, 0x07, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x2F, 0xE0, 0x1F, 0xF0,
-    0xFF, 0x00, 0xFF, 0x40, 0x7F, 0x87, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x2F, 0xE0, 0x0F, 0xF0, 0x0F,
-    0xF0, 0xBF, 0x40, 0x7F, 0x80, 0x3F, 0xC2, 0xFD, 0x02, 0xFD, 0x02, 0xFE, 0x0B, 0xF8, 0x0F, 0xF4,
-    0x1F, 0xF4, 0x2F, 0xF8, 0x3F, 0xC2, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1A, 0xFF, 0xA5, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x3F, 0xD0, 0xFF, 0x81,
-    0xFF, 0x03, 0xFD, 0x0F, 0xF4, 0x2F, 0xE0, 0x3F, 0xD0, 0xFF, 0x03, 0xFD, 0x03, 0xFC, 0x1F, 0xF0,
-    0x3F, 0xC0, 0x7F, 0xC2, 0xFE, 0x03, 0xFC, 0x07, 0xFC, 0x3F, 0xD0, 0x7F, 0xC0, 0xBF, 0xC3, 0xFD,
-    0x0B, 0xF8, 0x0F, 0xF8, 0x3F, 0xC0, 0xFF, 0x40, 0xFF, 0x47, 0xFC, 0x0F, 0xF0, 0x2F, 0xF0, 0x7F,
-    0xC0, 0xFF, 0x07, 0xFD, 0x03, 0xFE, 0x1F, 0xE6, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xF5, 0xBF, 0xF4, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x07,
-    0xFD, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x2F, 0xF5,
-    0x55, 0x57, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x1F,
-    0xF0, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFD, 0x5B, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x1F, 0xF4, 0xBF, 0xC0, 0x2F, 0xE3, 0xFE, 0x00, 0xBF, 0xDF, 0xFA,
-    0xAA, 0xFF, 0x7F, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFE, 0xAA, 0xFF, 0x6F, 0xE0, 0x07,
-    0xFC, 0xBF, 0x80, 0x3F, 0xE1, 0xFF, 0x87, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80,
-    0x02, 0xFF, 0xE4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF9, 0xFF, 0x00, 0x00,
-    0xFF, 0xF3, 0xFC, 0x00, 0x0B, 0xFF, 0xCF, 0xF0, 0x00, 0x7F, 0xFB, 0x3F, 0xC0, 0x03, 0xFF, 0x00,
-    0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xF4, 0x07, 0xFC, 0x00, 0x2F, 0xD0,
-    0x3F, 0xE0, 0x00, 0xBF, 0x41, 0xFF, 0x00, 0x01, 0xFD, 0x0B, 0xF8, 0x00, 0x07, 0xF8, 0x3F, 0xC0,
-    0x00, 0x1F, 0xE2, 0xFE, 0x00, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x00, 0xFE, 0xBF, 0x80, 0x00, 0x03,
-    0xFB, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x01, 0xFF, 0x7F, 0xC0, 0x07, 0xFF, 0x7F, 0xC0, 0x0F, 0xFF, 0x3F, 0xC0, 0x2F, 0xFA,
-    0x3F, 0xC0, 0x3F, 0xD0, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0x2F, 0xC2, 0xFE, 0x00,
-    0x2F, 0xD3, 0xFC, 0x00, 0x1F, 0xDB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x05, 0x51, 0x54, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x00, 0x7F,
-    0x0F, 0xD0, 0x00, 0x00, 0xBD, 0x0F, 0x80, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xFC, 0xFF, 0x00, 0x02, 0xFF, 0xF3,
-    0xFC, 0x00, 0x1F, 0xFE, 0xCF, 0xF0, 0x00, 0xFF, 0xC0, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xFF, 0x00,
-    0x3F, 0xE0, 0x02, 0xFD, 0x01, 0xFF, 0x00, 0x0B, 0xF4, 0x0F, 0xF8, 0x00, 0x2F, 0xD0, 0x7F, 0xC0,
-    0x00, 0x7F, 0x42, 0xFE, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0xBF, 0x80, 0x00, 0x0F,
-    0xE3, 0xFC, 0x00, 0x00, 0x3F, 0xAF, 0xE0, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x45, 0x50, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x1F, 0xD3, 0xFC,
-    0x00, 0x07, 0xE0, 0xFC, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x01, 0xFF, 0x7F, 0xC0, 0x07, 0xFF, 0x7F, 0xC0, 0x0F, 0xFF, 0x3F, 0xC0, 0x2F,
-    0xFA, 0x3F, 0xC0, 0x3F, 0xD0, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0x2F, 0xC2, 0xFE,
-    0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x1F, 0xDB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xC0, 0xFF, 0x00,
-    0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x3F, 0xC0, 0x07, 0xFC, 0x1F, 0xF4, 0x00, 0x03, 0xFD,
-    0x0F, 0xF0, 0x03, 0xFE, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x01, 0xFF, 0x03, 0xFE, 0x00,
-    0x00, 0x3F, 0xD0, 0xBF, 0x40, 0xFF, 0x80, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x7F, 0xC0,
-    0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x07, 0xF8, 0x3F, 0xE0, 0x1F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0xFF,
-    0x1F, 0xF0, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xCF, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF,
-    0xC0, 0x0F, 0xF3, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x02, 0xFE, 0xFD, 0x00, 0x0F, 0xFD,
-    0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xD0, 0x1F,
-    0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F,
-    0xFD, 0x6F, 0xF4, 0x0F, 0xF0, 0x0B, 0xFC, 0x0B, 0xFD, 0x03, 0xFE, 0x03, 0xFC, 0x03, 0xFD, 0x03,
-    0xFE, 0x00, 0xBF, 0xC0, 0xBF, 0x42, 0xFF, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x2F, 0xD0, 0xFF, 0x40,
-    0x7F, 0xC0, 0x0B, 0xF8, 0x07, 0xF8, 0xBF, 0xC0, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0xFE, 0x3F, 0xC0,
-    0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x3F, 0x9F, 0xE0, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xEF, 0xF0,
-    0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x00, 0xBF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xF8, 0xB8, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x00, 0x02, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80,
-    0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xC3, 0xFC, 0x00,
-    0x00, 0x3F, 0xE0, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00,
-    0x07, 0xFE, 0x02, 0xFF, 0x86, 0x4B, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFF, 0x82, 0xFF, 0x5E, 0x2F, 0xF0, 0xFF, 0x80, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0xFF, 0x2F, 0xF0,
-    0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x1F, 0xF2, 0xFE, 0x00, 0x0B, 0xFC, 0xBF, 0x80, 0x03, 0xFE, 0x1F,
-    0xF0, 0x42, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x51, 0xF0, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xE0, 0x00, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xF4, 0x02, 0xFF, 0xEB, 0xE0, 0x0F, 0xBF, 0xFC, 0x03,
-    0xFF, 0x00, 0x40, 0x00, 0x0B, 0xFD, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xFD, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xD0,
-    0x02, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x1F, 0xF4, 0x3F, 0xE0, 0x03, 0xFC,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x07, 0xFC, 0x00, 0xFF, 0xD0, 0x0F, 0xFF, 0xBF, 0xFF, 0xAF, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x7F, 0xFF, 0xF8, 0x00, 0x00,
-    0xBF, 0xF8, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0xF0, 0x00, 0x00,
-    0x0B, 0x4A, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0x43,
-    0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x0B, 0xFF, 0xF4, 0x3F, 0xF5, 0xA0, 0x19, 0xBF, 0xE2, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0xCF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0xFF,
-    0x00, 0x15, 0x40, 0x1F, 0xFB, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0xAF, 0xE0, 0x0F, 0xF4, 0x03, 0xFE,
-    0xBF, 0x80, 0x3F, 0xC0, 0x0F, 0xF6, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xC7, 0xFE, 0x1F, 0xFF, 0x5F,
-    0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0x1F, 0xFE, 0x02,
-    0xFF, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0x43, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x3F,
-    0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xE1, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x7F,
-    0xC0, 0x07, 0xFC, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0xFF,
-    0x41, 0xFF, 0x00, 0x7F, 0xE0, 0x07, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x80, 0x3F, 0xE0, 0x1F, 0xF0,
-    0x1F, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0xFF, 0xF8, 0x0B, 0xFC, 0x01, 0xFF, 0x07, 0xFF, 0xE0,
-    0x3F, 0xD0, 0x07, 0xFC, 0x3F, 0xFF, 0xC2, 0xFF, 0x00, 0x0F, 0xF5, 0xFE, 0xFF, 0x0F, 0xF4, 0x00,
-    0x3F, 0xDF, 0xF3, 0xFC, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0x4F, 0xF7, 0xFD, 0x00, 0x02, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xD0, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAA, 0xAA, 0xA4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFB, 0xFB,
-    0xF0, 0x00, 0x00, 0x01, 0xC1, 0xD0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF4, 0x02, 0xFD, 0x3F, 0xD0, 0x0F, 0xF0, 0x03, 0xFD,
-    0x3F, 0xD0, 0x0F, 0xF0, 0x07, 0xFC, 0x3F, 0xC0, 0x1F, 0xF0, 0x0B, 0xF8, 0x3F, 0xC0, 0x1F, 0xF0,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xF0, 0x1F, 0xF0, 0x3F, 0xC0, 0x7F, 0xF0, 0x3F, 0xD0, 0x3F, 0xC0,
-    0xFF, 0xF0, 0x7F, 0xC0, 0x3F, 0xC2, 0xFF, 0xF0, 0xFF, 0x40, 0x2F, 0xD3, 0xFF, 0xF1, 0xFF, 0x00,
-    0x2F, 0xEB, 0xFB, 0xF3, 0xFC, 0x00, 0x1F, 0xFF, 0xCB, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0x87, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xD0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFC,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0xBF, 0xC0, 0x0F, 0xFF, 0x00, 0x0A,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0xAC, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFE, 0x5B, 0x41,
-    0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0x56, 0x00, 0x3F,
-    0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x38,
-    0x0B, 0xC0, 0x00, 0x7F, 0x5F, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x02, 0xF2, 0xFC, 0x10, 0x03, 0xD0, 0x38, 0x3D, 0x0B, 0x80, 0x00, 0x3F, 0xDF,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xF1,
-    0xFC, 0x00, 0x03, 0xD0, 0x18, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFE, 0x7F, 0x55,
-    0x54, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x1B, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE,
-    0x7F, 0xE0, 0x7E, 0x14, 0x00, 0x14, 0x00, 0x0B, 0xE7, 0xFE, 0xF4, 0x7C, 0x0B, 0xD0, 0x24, 0x00,
-    0x00, 0xFD, 0x1F, 0xF0, 0x7F, 0x03, 0xD3, 0xF4, 0x24, 0x00, 0x01, 0xA4, 0x00, 0x03, 0xFF, 0xE4,
-    0x03, 0xFF, 0xFF, 0xF1, 0xFD, 0x6F, 0xFC, 0x7D, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x1C, 0x03, 0x40, 0x00, 0x00, 0x2C, 0x07, 0x00, 0x00,
-    0x40, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x90, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x87, 0x56, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x75, 0x6D, 0x60, 0x09, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xC0, 0x34, 0x00, 0x00, 0x02, 0x80, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xAF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x3F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x00, 0x02, 0x40, 0x00, 0x0F, 0x80, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00,
-    0x2A, 0x80, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xF0,
-    0x01, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xFF,
-    0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFC, 0x02, 0xFE, 0xFF, 0x00, 0x1F, 0xE0, 0x1F,
-    0xF7, 0xF8, 0x00, 0xBF, 0x40, 0xFF, 0x2F, 0xD0, 0x03, 0xFC, 0x0F, 0xF4, 0xBF, 0x00, 0x0F, 0xF0,
-    0xBF, 0x83, 0xFC, 0x00, 0x3F, 0x87, 0xFC, 0x0F, 0xF0, 0x01, 0xFD, 0x3F, 0xC0, 0x7F, 0x80, 0x0B,
-    0xF7, 0xFD, 0x02, 0xFD, 0x00, 0x3F, 0xEF, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xC0,
-    0x07, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0xBF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x00,
-    0xFF, 0x41, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0xFF,
-    0x80, 0x2F, 0xE0, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC,
-    0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x3F, 0xD0, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xC0,
-    0x1F, 0xF0, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x07, 0xFD, 0x2F, 0xFE, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFD, 0x2F, 0xFF, 0x00, 0x04, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x06, 0xBF, 0xEA, 0x40, 0x0B, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xA9, 0x00, 0x03, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x0B, 0xFD, 0x0B, 0xFC, 0x03,
-    0xFE, 0x0F, 0xF8, 0x03, 0xFE, 0x0F, 0xF4, 0x03, 0xFD, 0x1F, 0xF0, 0x0B, 0xFC, 0x2F, 0xFA, 0xBF,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0xAE, 0x90, 0x2F, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFD, 0x3F, 0xE4, 0x7F, 0xF7, 0xFC, 0x01, 0xFF, 0x7F, 0xC0, 0x1F, 0xF7,
-    0xFC, 0x03, 0xFE, 0x3F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x3F, 0xFF, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x1F,
-    0xF0, 0x1F, 0xF0, 0x62, 0xFF, 0x02, 0xFF, 0x2F, 0xBF, 0xE0, 0x3F, 0xE0, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xEA, 0x6F, 0x80,
-    0x0F, 0xF4, 0x00, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0xC0, 0x00, 0x7F, 0x3F, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xE5, 0xFF, 0xC0, 0x0F, 0xF8, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x1F, 0xE0, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x0B, 0xFC, 0x03, 0xFC, 0x04,
-    0xFF, 0x80, 0x7F, 0xC7, 0xDF, 0xF0, 0x0B, 0xFC, 0xBF, 0xFF, 0x00, 0xBF, 0xF7, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xBF, 0xFF, 0x00, 0x1F, 0xF2, 0xFF, 0xF0, 0x02, 0xFE, 0x01, 0x2F,
-    0x80, 0x3F, 0xD0, 0x00, 0xE0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xAA, 0x90, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFE, 0xA8, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xEA, 0xA4, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x06, 0xFF, 0x54, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFE, 0x01, 0xFF, 0xD0, 0xFF, 0x40, 0x1F, 0xF8, 0x3F,
-    0xC0, 0x03, 0xFF, 0x1F, 0xF0, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x1F, 0xF2, 0xFE, 0x00, 0x0B, 0xFC,
-    0xFF, 0x40, 0x02, 0xFF, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x01, 0xE5, 0xBF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xEA, 0xA4, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF,
-    0x01, 0xFF, 0x5F, 0xFE, 0x0B, 0xFC, 0x0F, 0xFC, 0x2F, 0xE0, 0x2F, 0xF0, 0xFF, 0x40, 0x7F, 0xC3,
-    0xFC, 0x01, 0xFF, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x02, 0xEA, 0xFF, 0xD0, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x7F,
-    0x80, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x43,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xAF, 0xEB, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x7F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xF0, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x80,
-    0xFF, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x1F, 0xFA, 0x80, 0x0F, 0xFC, 0x02, 0xFE,
-    0x00, 0xFF, 0xFC, 0x02, 0xFF, 0x40, 0x3F, 0xD0, 0x0B, 0xFF, 0x80, 0x7F, 0xD0, 0x03, 0xFC, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x7F, 0x80, 0x0B, 0xFC, 0x03, 0xFF, 0xD0, 0x0B, 0xF4, 0x07, 0xFF, 0xC0, 0x3F, 0xFF,
-    0x00, 0xFF, 0x01, 0xFF, 0xFC, 0x01, 0x5F, 0xF8, 0x0F, 0xF0, 0x3F, 0xF5, 0x00, 0x00, 0xBF, 0x81,
-    0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD7, 0xFE,
-    0x6F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0xEB, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x0B, 0xF4, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x0F, 0xF0, 0x2F, 0xF4, 0x50,
-    0x3F, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x1F, 0xE0, 0x0B, 0xFF, 0xD0, 0x3F,
-    0xF4, 0x02, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFA, 0x5B, 0xFF, 0x40, 0x10, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0xAB, 0xFF, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE,
-    0x0B, 0x94, 0x1B, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE,
-    0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x2A, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xFD, 0x02, 0x40, 0x3F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x0A, 0xBF, 0xF8,
-    0x00, 0xFF, 0xF9, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x56, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0xBF, 0xC6, 0x40, 0x2F, 0xF8, 0xBF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xE0, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x6B, 0xF8,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x03,
-    0xFE, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x01, 0xFF,
-    0x40, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0xC0,
-    0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00,
-    0x02, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0xC0, 0x00,
-    0x1F, 0xF0, 0x2F, 0xF0, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0xA9, 0x02, 0xFE, 0x00, 0xFF, 0xFF, 0x80,
-    0xFF, 0x40, 0x1F, 0xFF, 0xD0, 0x3F, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0xD0, 0x1F, 0xF0, 0x1F, 0xF8, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0xFF,
-    0xC0, 0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x3F, 0xCB, 0xFC, 0x00, 0x07, 0xFE, 0xFF, 0x40, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x3F, 0xE0, 0x00, 0x1F, 0xF1, 0xFF, 0x00,
-    0x02, 0xFF, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0xBF, 0xEA, 0x43, 0xFD, 0x03, 0xFF, 0xF4, 0x3F, 0xC0,
-    0x2F, 0xFF, 0x07, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x2A, 0x80, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x40, 0x0F, 0xF4, 0x01, 0xFF, 0x80, 0x07, 0xFC, 0x3C,
-    0xFF, 0x80, 0x02, 0xFF, 0x1E, 0xFF, 0x80, 0x00, 0xFF, 0x8B, 0xFF, 0xC0, 0x00, 0x3F, 0xD3, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x3F, 0xD0,
-    0x00, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x8B, 0xFD, 0x00,
-    0x00, 0x3F, 0xD3, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0xFF, 0xF4, 0x00, 0x07, 0xFC, 0x7A, 0xFF, 0x00,
-    0x02, 0xFE, 0x19, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xE1, 0x1F, 0xF4, 0x03, 0xFD, 0xBB, 0xFD, 0x00, 0x3F,
-    0xDF, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0xE0, 0x00, 0x7F, 0xCF, 0xFC, 0x00, 0x0B, 0xFB, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x3F, 0xD0, 0x00, 0x2F, 0xF7,
-    0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xF4, 0x00, 0x3F, 0xDB, 0xFF, 0xC0, 0x03, 0xFC, 0xF3, 0xFD, 0x00,
-    0x7F, 0xCA, 0x2F, 0xF0, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x0F,
-    0xF4, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0xC2, 0xFF, 0x40, 0x2F, 0xFF, 0xE1, 0xFF, 0x80, 0x0F, 0xFF,
-    0xF8, 0xFF, 0x80, 0x02, 0xFF, 0xFD, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x07, 0xFC,
-    0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0x2F,
-    0xF0, 0x00, 0x00, 0xFF, 0x83, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x1F,
-    0xF4, 0x00, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x0F,
-    0xF8, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFD, 0x01, 0xFF, 0x01, 0xFF,
-    0x80, 0x2F, 0xE0, 0x3F, 0xE0, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x03, 0xFC,
-    0xBF, 0xC0, 0x00, 0x7F, 0xEF, 0xF4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xF3, 0xFE, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x02, 0xFE, 0x0B,
-    0xFC, 0x00, 0x3F, 0xD0, 0x3F, 0xE0, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00,
-    0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0x4F, 0xFF, 0xFC, 0x00, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0xFF, 0xC1,
-    0xFF, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0xBF, 0xD0, 0x00, 0x1F, 0xF0, 0x7F, 0xD0, 0x00,
-    0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x6F, 0xF0, 0x00, 0x00,
-    0x7F, 0xEF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x03,
-    0xFE, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x3F, 0xD0, 0x00, 0x0B, 0xF8, 0x0F, 0xFC, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0x40, 0x00, 0xFF,
-    0x40, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0xE0, 0x0F, 0xFC, 0xBF, 0xFF, 0xD0, 0x2F, 0xF0, 0xFF, 0xFF, 0xC0, 0xBF, 0xD0, 0x55, 0xBF,
-    0xC1, 0xFF, 0x40, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x00, 0xBF, 0x8F, 0xF8, 0x00, 0x00, 0xFF, 0x7F,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0x7F, 0xC0,
-    0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00,
-    0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x0B, 0xF8, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0xAA, 0xAF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFC,
-    0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xFA, 0x92, 0xFE, 0x00,
-    0x0B, 0xFF, 0xF8, 0xFF, 0x40, 0x03, 0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x2F, 0xF0, 0x07, 0xFC,
-    0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xE5, 0x5F,
-    0xF4, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x2F, 0xE0, 0x0B, 0xFE, 0xA0,
-    0xFF, 0x40, 0x3F, 0xFF, 0xC3, 0xFC, 0x00, 0xFF, 0xFE, 0x1F, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xBF,
-    0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x07, 0xFC, 0x00, 0x1F, 0xFF, 0xF4, 0x02, 0xFF,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0xAA,
-    0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x1F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x2F, 0xE0, 0x07, 0xFF, 0xFF,
-    0x00, 0xFF, 0x80, 0x2F, 0xF5, 0x50, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF0, 0x03, 0xFD,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x3F, 0xE5, 0x5F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFC,
-    0x01, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x03,
-    0xFC, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xFA, 0xA4,
-    0x00, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x2F, 0xFC, 0x0F, 0xF4, 0x00,
-    0x3F, 0xC0, 0x0B, 0xFD, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x1F, 0xF0, 0x00, 0xBF, 0x80,
-    0x03, 0xFE, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFE,
-    0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0x56, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x95, 0x7F, 0xD0, 0x00, 0x03, 0xFD, 0x00,
-    0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x02, 0xFE,
-    0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0xC1,
-    0xFF, 0x00, 0x7F, 0xD7, 0xFF, 0x8B, 0xFC, 0x02, 0xFE, 0x03, 0xFF, 0x2F, 0xE0, 0x0F, 0xF8, 0x0B,
-    0xFC, 0xFF, 0x40, 0x3F, 0xD0, 0x1F, 0xF3, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0xDF, 0xF0, 0x07, 0xFC,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFA, 0xBF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF9, 0xA0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE,
-    0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x0B, 0xFF, 0xF0, 0x1F, 0xF4, 0x1F, 0xFF, 0xF8, 0x2F, 0xF0, 0x3F,
-    0xE3, 0xFC, 0x3F, 0xE0, 0x7F, 0xC3, 0xFC, 0x3F, 0xD0, 0xBF, 0x43, 0xFC, 0x3F, 0xD0, 0xFF, 0x03,
-    0xFC, 0x3F, 0xC0, 0xFF, 0x07, 0xFC, 0x3F, 0xC0, 0xFF, 0x0B, 0xF4, 0x3F, 0xD0, 0xFF, 0x0F, 0xF0,
-    0x3F, 0xE0, 0xFF, 0x3F, 0xE0, 0x3F, 0xF0, 0xBF, 0xFF, 0xC0, 0x1F, 0xFD, 0x7F, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x60, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x50, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x04, 0x00, 0x2F, 0xF4, 0x2F, 0xE0,
-    0x3F, 0xE0, 0xFF, 0xFC, 0x7F, 0xC3, 0xFF, 0xFD, 0xBF, 0xC3, 0xF8, 0xFE, 0xBF, 0x87, 0xF0, 0xFE,
-    0xBF, 0x8B, 0xF0, 0xFD, 0xBF, 0x8B, 0xF1, 0xFC, 0xBF, 0xC7, 0xF3, 0xF8, 0x7F, 0xD3, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x14, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0xBF, 0xC0, 0x0F, 0xFF, 0x00, 0x0A,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x40, 0x01, 0xFF, 0xE5, 0xAF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x03, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF8, 0x0F, 0xFE, 0x5B, 0x42, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x07, 0xFF, 0x56, 0xC0, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xAB, 0xF4, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07,
-    0xFE, 0xA4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC2, 0xFF, 0x40, 0xBF, 0xD0, 0x01, 0xFC, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x2F,
-    0xEF, 0xFF, 0xEF, 0xFF, 0xF8, 0x03, 0xFF, 0xD7, 0xFF, 0xF5, 0xFF, 0xC0, 0x3F, 0xF0, 0x1F, 0xFC,
-    0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x40, 0x7F, 0xC0, 0x7F, 0xC0, 0x2F, 0xF0, 0x0B, 0xF8, 0x0B,
-    0xF8, 0x02, 0xFE, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03, 0xFC,
-    0x00, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x2F, 0xF0, 0x0B, 0xF8, 0x02, 0xFE, 0x02,
-    0xFE, 0x00, 0xFF, 0x40, 0x2F, 0xF5, 0x3F, 0xD0, 0x0F, 0xF4, 0x02, 0xFF, 0xE3, 0xFC, 0x00, 0xFF,
-    0x00, 0x1F, 0xFD, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x83, 0xFD, 0x00, 0x2F, 0xF0, 0x2F, 0xE0, 0x03, 0xFE, 0x01, 0xFF,
-    0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x0B, 0xF4, 0xBF, 0xC0,
-    0x00, 0x7F, 0x9F, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x03, 0xFD, 0x7F, 0xC0, 0x0B, 0xFC, 0x3F, 0xC0, 0x0F, 0xF4, 0x3F, 0xC0, 0x2F, 0xF0,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x80, 0x2F, 0xC0, 0xFF, 0x00, 0x2F, 0xC2, 0xFE, 0x00,
-    0x1F, 0xD3, 0xFC, 0x00, 0x1F, 0xDB, 0xF4, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
-    0xE0, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x03,
-    0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x2F, 0xD2, 0xFF, 0x00, 0x00, 0x7F, 0x9F,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xAA, 0xFF, 0xAA, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xC0,
-    0x2F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0xBF, 0x80, 0x02, 0xFC, 0x0F, 0xF0, 0x00,
-    0x2F, 0xC2, 0xFE, 0x00, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x1F, 0xDB, 0xF4, 0x00, 0x00, 0xFD, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x01, 0x5F, 0xF5, 0x50, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xE0, 0x01, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x7F, 0xD0, 0x00, 0x07,
-    0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF3, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x1F, 0xF0, 0x00,
-    0x01, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x0F, 0xFE, 0xA0, 0x0F, 0xFC, 0x00, 0x7F, 0xFF,
-    0x42, 0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x2F, 0xF0, 0xBF,
-    0xD0, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x0F, 0xFB, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x01, 0xFF,
-    0x4F, 0xFE, 0xA0, 0x03, 0xFE, 0x07, 0xFF, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0xF0, 0x2F, 0xF4, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xAA, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xD3, 0xFF, 0xFF, 0xFF, 0xC3, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F,
-    0xC7, 0xFF, 0xFF, 0xFF, 0x4B, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x0F,
-    0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x02,
-    0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00,
-    0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00,
-    0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xEA,
-    0xAB, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x1F, 0xF7, 0xFF,
-    0xFF, 0xF2, 0xFE, 0xBF, 0xFF, 0xFF, 0x3F, 0xD1, 0x5F, 0xF5, 0x43, 0xFC, 0x01, 0xFF, 0x00, 0x7F,
-    0xC0, 0x2F, 0xE0, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x0F, 0xF4, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x0B, 0xF8, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0xBF, 0xE0,
-    0x0B, 0xFD, 0x6F, 0xFF, 0x50, 0x7F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xF4, 0xFF, 0xD0, 0x0F, 0xFD,
-    0x0B, 0xFC, 0x00, 0x04, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0B, 0xF8, 0x00,
-    0x2F, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0xFF, 0x40, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x1F, 0xF0,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x01, 0xFF, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x07, 0xFF, 0x9B, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x5F, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xEA, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x07, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0F, 0xF4, 0x7F, 0xC0,
-    0x0F, 0xF0, 0x7F, 0xC0, 0x2F, 0xF0, 0xBF, 0x80, 0x3F, 0xE0, 0xBF, 0x80, 0xBF, 0xD0, 0xBF, 0xD6,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xBF, 0xC0, 0x0B, 0xF8, 0xBF, 0x80, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xA8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1A, 0x90, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0xFF,
-    0x80, 0x03, 0xFE, 0x0F, 0xF4, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x07, 0xFC, 0x2F, 0xF0, 0x00, 0x7F,
-    0xC2, 0xFE, 0x00, 0x0B, 0xF8, 0x3F, 0xE1, 0xF0, 0xFF, 0x83, 0xFD, 0x2E, 0x0F, 0xF4, 0x7F, 0xC3,
-    0xD1, 0xFF, 0x07, 0xFD, 0x3C, 0x2F, 0xF0, 0x7F, 0xFB, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFE, 0xBF, 0xC0, 0x00, 0x1F, 0x0B, 0xFC, 0x00, 0x01, 0xF0,
-    0xFF, 0x80, 0x00, 0x1E, 0x0F, 0xF4, 0x00, 0x02, 0xD0, 0xFF, 0x00, 0x00, 0x18, 0x1F, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x3F, 0xD0, 0x07,
-    0xFC, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0x7F, 0xC6, 0x1F, 0xF0, 0xBF, 0x8F, 0x2F,
-    0xF0, 0xBF, 0xCF, 0x7F, 0xF0, 0xBF, 0xEF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xBF,
-    0xC0, 0x0B, 0xFD, 0x7F, 0xC0, 0x00, 0x7C, 0xBF, 0x80, 0x00, 0x78, 0xFF, 0x40, 0x00, 0xB4, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF2, 0xFF, 0xE0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFA, 0xFF, 0xF0, 0x3F, 0xE0, 0x03, 0xFF, 0x07,
-    0xFC, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0xFF, 0x40, 0x03,
-    0xFD, 0x1F, 0xF0, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x07, 0xFC, 0x2F, 0xE0, 0x00, 0xBF, 0xC3, 0xFE,
-    0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0xD0, 0x01, 0xFE, 0xFF, 0xFD, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFD, 0x7F, 0xF0, 0x0F, 0xFC, 0x07, 0xFC, 0x07, 0xFE, 0x00, 0xFF, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03, 0xFD,
-    0x07, 0xFC, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F,
-    0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFE, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xE0, 0xA8, 0x2F, 0xF8,
-    0x00, 0xBF, 0x8B, 0xF0, 0xFF, 0xC0, 0x03, 0xFE, 0x3F, 0xC7, 0xFC, 0x00, 0x2F, 0xF4, 0xFF, 0x7F,
-    0xF5, 0x6B, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF9, 0x5B, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xFC, 0x15, 0x0F, 0xFD, 0x0F, 0xF5, 0xF8, 0x7F, 0xC0, 0x2F, 0xEB, 0xE3, 0xFE, 0x00, 0xFF,
-    0x6F, 0xDF, 0xF4, 0x6F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFE, 0xA5, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x1C, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE,
-    0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xE0, 0xA8, 0x2F, 0xF8, 0x00, 0xBF, 0x8B, 0xF0, 0xFF,
-    0xC0, 0x03, 0xFE, 0x3F, 0xC7, 0xFC, 0x00, 0x2F, 0xF4, 0xFF, 0x7F, 0xF5, 0x6B, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9,
-    0x5B, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x15,
-    0x0F, 0xFD, 0x0F, 0xF5, 0xF8, 0x7F, 0xC0, 0x2F, 0xEB, 0xE3, 0xFE, 0x00, 0xFF, 0x6F, 0xDF, 0xF4,
-    0x6F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFE, 0xA5, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1C, 0x00, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F,
-    0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0,
-    0x07, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x42, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x0F, 0xF0, 0xFF, 0x80,
-    0x00, 0x00, 0x07, 0xFC, 0x7F, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xDB, 0xF8, 0xFF, 0x80, 0x00, 0x00,
-    0x0B, 0xFE, 0x2F, 0xD2, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x1F, 0xF0, 0x2F, 0xF0, 0x00, 0x03, 0xFF,
-    0x80, 0xBF, 0x80, 0x7F, 0xD0, 0x00, 0x2F, 0xFC, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xC0,
-    0x0F, 0xF0, 0x02, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x47, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0x80, 0x1F, 0xFD, 0x02, 0xFF, 0xE0, 0x0B, 0xF4, 0x0B, 0xFF,
-    0xC0, 0x2F, 0xFF, 0x40, 0xFF, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xF8, 0x0F, 0xF0, 0x7F, 0xE4, 0x00,
-    0x00, 0xBF, 0xC1, 0xFE, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xE1, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xD7, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x0B,
-    0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xFC, 0x0F, 0xF0,
-    0x3F, 0xF4, 0x00, 0x2F, 0xFF, 0x81, 0xFF, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x2F, 0xE0, 0x0F,
-    0xFF, 0x80, 0x7F, 0xF4, 0x02, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF,
-    0x00, 0x02, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0xFF, 0x80,
-    0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x7F, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0x55, 0xFF, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFD, 0x00,
-    0x3F, 0xD0, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x02,
-    0xFE, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0xA5, 0x6F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xD0, 0x1F,
-    0xF0, 0x1F, 0xF8, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0xFF, 0xC0, 0x03, 0xFD, 0x3F, 0xF0,
-    0x00, 0x3F, 0xCB, 0xFC, 0x00, 0x07, 0xFE, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFA, 0xBF, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0xC0,
-    0x2F, 0xE0, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x03, 0xFD, 0x07, 0xFC, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x1E, 0xAF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
-    0x40, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xF0, 0x00, 0x00,
-    0xFF, 0x40, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF4, 0x00,
-    0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFC,
-    0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x03,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF0, 0x01, 0x6F, 0xFC, 0x00, 0xBF, 0xFF, 0x8F, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFE, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x80, 0x10,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFD, 0x6F, 0xE0,
-    0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00,
-    0xBF, 0xC0, 0x7F, 0xC0, 0x00, 0xFF, 0x40, 0xBF, 0x80, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x02, 0xFF,
-    0x00, 0xFF, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x5F, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFC, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x14, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x40,
-    0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00,
-    0xFF, 0x80, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x07,
-    0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0xAA, 0xAF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF,
-    0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x1F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x40,
-    0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xE9, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x7F,
-    0xC0, 0x3F, 0xE0, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xF4, 0x07, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x95, 0x7F, 0xD0,
-    0x1F, 0xF0, 0x03, 0xFD, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x0B, 0xFC, 0x03, 0xFD, 0x00,
-    0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x2E, 0xBF, 0xFC, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0xAA, 0xAF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F,
-    0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07,
-    0xFF, 0xFC, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0x83, 0xFD, 0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xFC,
-    0x00, 0xFF, 0x00, 0x2F, 0xF0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xE5, 0x5F, 0xF4, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x01,
-    0xFF, 0x00, 0x2F, 0xE0, 0x0B, 0xFE, 0xA0, 0xFF, 0x40, 0x3F, 0xFF, 0xC3, 0xFC, 0x00, 0xFF, 0xFE,
-    0x1F, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2A,
-    0x90, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0xFF, 0x40, 0x03, 0xFE, 0x0F, 0xF4, 0x00, 0x3F, 0xD1,
-    0xFF, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x00,
-    0xFF, 0x43, 0xFC, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x01, 0xFF, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x7F,
-    0xF9, 0xBF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFD, 0x7F,
-    0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0xAA, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x07, 0xF8, 0xFF, 0x40, 0x2F, 0xE3, 0xFD, 0x00, 0xFF, 0x5F, 0xF0, 0x03, 0xFC, 0x7F,
-    0xC0, 0x2F, 0xF2, 0xFE, 0x00, 0xFF, 0x8B, 0xF8, 0x0B, 0xFE, 0x2F, 0xF5, 0xBF, 0xF4, 0x7F, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFE, 0xFF, 0x00, 0xBF, 0x8B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x6A, 0xFF,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1A,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0x80, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xFD, 0x00, 0x2F, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0xFE, 0xFE, 0x00, 0x0F, 0xEF, 0xD0, 0x07,
-    0xFB, 0xF4, 0x00, 0x7F, 0x7F, 0x40, 0x3F, 0xAF, 0xD0, 0x02, 0xFC, 0xFD, 0x01, 0xFC, 0xFF, 0x00,
-    0x0F, 0xF3, 0xF4, 0x0F, 0xE3, 0xFC, 0x00, 0x3F, 0xCF, 0xE0, 0x7F, 0x1F, 0xE0, 0x00, 0xFE, 0x2F,
-    0x83, 0xF8, 0xBF, 0x40, 0x07, 0xF4, 0xBE, 0x1F, 0xC3, 0xFC, 0x00, 0x2F, 0xC2, 0xF8, 0xFE, 0x0F,
-    0xF0, 0x00, 0xFF, 0x0B, 0xF7, 0xF0, 0x3F, 0xC0, 0x03, 0xFC, 0x1F, 0xFF, 0x81, 0xFE, 0x00, 0x1F,
-    0xE0, 0x7F, 0xFC, 0x0B, 0xF4, 0x00, 0x7F, 0x41, 0xFF, 0xE0, 0x3F, 0xFF, 0xD2, 0xFC, 0x07, 0xFF,
-    0x00, 0xFF, 0xFF, 0x0F, 0xF0, 0x1F, 0xF8, 0x07, 0xFF, 0xF8, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF4, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x02, 0xFF, 0xF0, 0x03,
-    0xFF, 0xF0, 0x02, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x03, 0xFB,
-    0xF0, 0x1F, 0xEF, 0xD0, 0x07, 0xF7, 0xF4, 0x3F, 0xBF, 0xC0, 0x0B, 0xF7, 0xF4, 0x7F, 0x3F, 0xC0,
-    0x0F, 0xF3, 0xF4, 0xFD, 0x7F, 0x80, 0x0F, 0xF3, 0xF6, 0xFC, 0xBF, 0x40, 0x0F, 0xE3, 0xFB, 0xF4,
-    0xBF, 0x00, 0x1F, 0xD2, 0xFF, 0xF0, 0xFF, 0x00, 0x2F, 0xD2, 0xFF, 0xD0, 0xFF, 0x00, 0x3F, 0xC2,
-    0xFF, 0xC1, 0xFF, 0xFC, 0x3F, 0xC2, 0xFF, 0x42, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAA, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xBF,
-    0x6F, 0xC0, 0x00, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x00, 0x2F, 0xD2, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0x7F, 0x40, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x03, 0xFD, 0x01,
-    0xFE, 0x00, 0x01, 0xFF, 0xAA, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF0, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x15, 0x00, 0x55, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F,
-    0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0x0F, 0xF2, 0xFD, 0x00, 0x00, 0x0F, 0xE2, 0xFC,
-    0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF,
-    0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F,
-    0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0,
-    0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x2F, 0xC3, 0xF8,
-    0x00, 0x2F, 0xC7, 0xF4, 0x00, 0x1F, 0x42, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC,
-    0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4,
-    0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0,
-    0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x81, 0xFF, 0xAA, 0xA8, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xFF, 0xFF, 0x80, 0x00,
-    0x03, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-    0xFE, 0xAB, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xAA, 0xA8, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBD, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFD, 0x6F, 0xFF, 0x42, 0xFE,
-    0x1F, 0xF4, 0x0F, 0xFD, 0x01, 0xFE, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFD, 0x3F, 0xD0, 0x0F, 0xF8,
-    0x6F, 0xFC, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0xBF, 0x80,
-    0x1F, 0xFA, 0x94, 0x00, 0xBF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x7F, 0xF0, 0x00, 0x00,
-    0xBF, 0xE2, 0xFF, 0xF8, 0x01, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFD, 0x3F, 0x3F, 0xFF, 0x40, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x07, 0xF4, 0x2F, 0xC0, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xFA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x40, 0x15,
-    0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x02, 0xFC, 0x1F, 0xD0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0x40, 0x7F, 0xC0, 0x2F, 0xD0, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x0F, 0xF4, 0x6F, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0xBF, 0xEA, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x2C,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xAB, 0xFF, 0xD0, 0x00, 0x40, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xAA, 0xFF, 0x82, 0xFF, 0x80, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x2F, 0xF0, 0x3F, 0xD0,
-    0x01, 0xFF, 0x80, 0xFF, 0x80, 0x1F, 0xFC, 0x03, 0xFF, 0x9B, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFC, 0x03,
-    0x90, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0x6A, 0xFF, 0x01, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xE2, 0xFF, 0xD5, 0xFF, 0x4F, 0xF4, 0x07, 0xFC, 0x3F, 0xC0, 0x3F,
-    0xE0, 0xFF, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0x80, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x00, 0x0F,
-    0xE2, 0xFC, 0x00, 0x00, 0x2E, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x01,
-    0xFE, 0xAF, 0xFF, 0x40, 0x01, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x01, 0xBF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFE, 0xAB, 0xFE, 0x0B, 0xFE,
-    0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x07, 0xFE, 0x03, 0xFE, 0x00, 0x7F,
-    0xF0, 0x0F, 0xFE, 0x6F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x81, 0xF4, 0x00, 0x7F, 0x4F,
-    0xF0, 0x02, 0xFC, 0x3F, 0x80, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF0, 0x0E, 0x40, 0x7F, 0xE0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x05, 0xAB, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0x8B, 0xFF, 0x57, 0xFD, 0x3F, 0xD0, 0x1F, 0xF0, 0xFF, 0x00, 0xFF, 0x83, 0xFC, 0x0B, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC7, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x0B,
-    0xF8, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x0B, 0xF8, 0x0B, 0xFC, 0x00, 0x00, 0x2F,
-    0xE0, 0x3F, 0xD0, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x43, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF6, 0xFE,
-    0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x8B, 0xF4, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xC1,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x07, 0xFC, 0x0B,
-    0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xE0, 0x1F, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0x40, 0x3F,
-    0xE0, 0x00, 0x7F, 0xF0, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xF0, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x07, 0xF8, 0x01, 0xFF, 0xD0, 0x2F, 0xFE, 0x00, 0xBF, 0x40, 0xBF, 0xFC, 0x02, 0xFF,
-    0xF4, 0x0F, 0xF0, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0xFF, 0x07, 0xFE, 0x40, 0x00, 0x0B, 0xFC,
-    0x1F, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC2, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x7F,
-    0xE7, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x43, 0xFC,
-    0x00, 0x00, 0x03, 0xFE, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0x03, 0xFF, 0x40,
-    0x02, 0xFF, 0xF8, 0x1F, 0xF0, 0x1F, 0xFF, 0x80, 0x3F, 0xFE, 0x02, 0xFE, 0x00, 0xFF, 0xF8, 0x07,
-    0xFF, 0x40, 0x2F, 0xD0, 0x02, 0xFF, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x02, 0xF0, 0x7D, 0x00, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x0B, 0x81, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3E, 0x96, 0xFF, 0xD0, 0x04, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x01, 0x6A, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0x82, 0xE5, 0x06, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xE0, 0x00, 0xFF, 0x2F, 0xC0, 0x03, 0xF8,
-    0xBF, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xD0, 0x09, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0xAB, 0xFF, 0x80, 0x03, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x15,
-    0xBF, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0x06, 0x40, 0x2F, 0xF8, 0x2F, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x02,
-    0xAF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x10, 0x00, 0x0F, 0xFC, 0x03, 0xE4, 0x1B, 0xFF, 0x80, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x01, 0x55,
-    0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x10, 0x00, 0x3F, 0xF0, 0x07, 0xFA, 0xBF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA,
-    0xA0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xE0, 0x07, 0xFC, 0x00, 0x7F,
-    0xF8, 0x01, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xFF,
-    0xC0, 0x0F, 0xF0, 0x0F, 0xFF, 0xE0, 0x07, 0xF8, 0x0B, 0xFB, 0xF8, 0x02, 0xFD, 0x07, 0xFA, 0xFD,
-    0x00, 0xFF, 0x43, 0xFC, 0xFF, 0x00, 0x3F, 0xC2, 0xFD, 0x3F, 0xC0, 0x0F, 0xF0, 0xFE, 0x1F, 0xE0,
-    0x07, 0xF8, 0xFF, 0x0B, 0xF4, 0x02, 0xFD, 0xBF, 0x43, 0xFC, 0x00, 0xFF, 0x7F, 0x80, 0xFF, 0x00,
-    0x3F, 0xFF, 0xC0, 0x3F, 0xC0, 0x1F, 0xFF, 0xD0, 0x1F, 0xE0, 0x07, 0xFF, 0xF0, 0x0B, 0xF4, 0x02,
-    0xFF, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0x80, 0x1F,
-    0xFD, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0A, 0xAA, 0xA4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFF, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0xBF,
-    0x80, 0x1F, 0xF0, 0x3F, 0xE0, 0x0B, 0xF8, 0x0F, 0xF4, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xFF, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF8, 0x0F, 0xF0, 0x03, 0xFD,
-    0x03, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x7F, 0xE0, 0x1F, 0xF4, 0xBF,
-    0xF4, 0x03, 0xFF, 0xFE, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0x00, 0x0F, 0xFD, 0x1F, 0xC0, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xE0, 0x00, 0x00, 0x0F, 0xF2, 0xFD, 0x00, 0x00, 0x03,
-    0xF8, 0xBF, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xF8, 0x01, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0x80,
-    0x0F, 0xFF, 0x40, 0x2F, 0xD0, 0x0B, 0xFF, 0xC0, 0x0F, 0xF0, 0x07, 0xFF, 0xF0, 0x03, 0xFC, 0x03,
-    0xFF, 0xF8, 0x01, 0xFE, 0x02, 0xFE, 0xFE, 0x00, 0xBF, 0x41, 0xFE, 0xBF, 0x40, 0x3F, 0xD0, 0xFF,
-    0x3F, 0xC0, 0x0F, 0xF0, 0xBF, 0x4F, 0xF0, 0x03, 0xFC, 0x3F, 0x87, 0xF8, 0x01, 0xFE, 0x3F, 0xC2,
-    0xFD, 0x00, 0xBF, 0x6F, 0xD0, 0xFF, 0x00, 0x3F, 0xDF, 0xE0, 0x3F, 0xC0, 0x0F, 0xFF, 0xF0, 0x0F,
-    0xF0, 0x07, 0xFF, 0xF4, 0x07, 0xF8, 0x01, 0xFF, 0xFC, 0x02, 0xFD, 0x00, 0xBF, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0x00, 0x1F, 0xE0, 0x07, 0xFF, 0x40, 0x0B, 0xF8,
-    0x00, 0x00, 0x0B, 0x81, 0xF4, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x3D,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x2F,
-    0xE0, 0x07, 0xFC, 0x0F, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xC0,
-    0x7F, 0xC0, 0x1F, 0xF0, 0x2F, 0xE0, 0x0B, 0xFC, 0x0F, 0xF4, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF8, 0x07, 0xFD, 0x2F,
-    0xFD, 0x00, 0xFF, 0xFF, 0xBF, 0x40, 0x3F, 0xFF, 0x5F, 0xC0, 0x03, 0xFF, 0x47, 0xF0, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0xFF,
-    0x1F, 0xD0, 0x00, 0x00, 0x7D, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F,
-    0xFC, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0,
-    0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00,
-    0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F,
-    0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x1F, 0x42, 0xE0, 0x00, 0xFF, 0x1F, 0xD0, 0x03, 0xF8, 0xBF, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xF5, 0xBF, 0xD2, 0xFF, 0x40, 0xFF, 0x8F, 0xF8, 0x02, 0xFF, 0x7F, 0xC0, 0x0B, 0xFD,
-    0xFF, 0x00, 0x2F, 0xEB, 0xF8, 0x00, 0xFF, 0xAF, 0xE0, 0x03, 0xFD, 0xBF, 0x80, 0x1F, 0xF2, 0xFF,
-    0x00, 0xFF, 0x87, 0xFE, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF,
-    0x90, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xF5, 0xBF, 0xF4, 0x03,
-    0xFF, 0x40, 0x0F, 0xFC, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x1F, 0xF0,
-    0x00, 0x03, 0xFD, 0x2F, 0xF5, 0x55, 0x57, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x0F,
-    0xF8, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x1F, 0xFD, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x1F, 0xF4, 0xBF, 0xC0, 0x2F, 0xE3,
-    0xFE, 0x00, 0xBF, 0xDF, 0xFA, 0xAA, 0xFF, 0x7F, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFE,
-    0xAA, 0xFF, 0x6F, 0xE0, 0x07, 0xFC, 0xBF, 0x80, 0x3F, 0xE1, 0xFF, 0x87, 0xFF, 0x03, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x0F, 0x80, 0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0xB8, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xF5, 0xBF, 0xF4, 0x03,
-    0xFF, 0x40, 0x0F, 0xFC, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x1F, 0xF0,
-    0x00, 0x03, 0xFD, 0x2F, 0xF5, 0x55, 0x57, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x0F,
-    0xF8, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x1F, 0xFD, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x07, 0xD0, 0x01, 0xFE, 0x3F,
-    0xC0, 0x07, 0xF4, 0xFF, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0x3F, 0xF4, 0x7F, 0xD2, 0xFF,
-    0x00, 0xBF, 0x8F, 0xF8, 0x02, 0xFF, 0x7F, 0xEA, 0xAB, 0xFD, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF,
-    0xFF, 0xAF, 0xFA, 0xAB, 0xFD, 0xBF, 0x80, 0x1F, 0xF2, 0xFE, 0x00, 0xFF, 0x87, 0xFE, 0x1F, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0xBC,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00,
-    0x2F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xEA, 0xFF, 0xF0, 0x00, 0x40, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x05, 0x55, 0x7F, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x15, 0x55, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x07, 0xE5, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x7D,
-    0x0B, 0x80, 0x0F, 0xF1, 0xFD, 0x00, 0xFF, 0x2F, 0xC0, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x24, 0x2F,
-    0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0xAA, 0xFF, 0xC0, 0x2F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0x80, 0x15, 0x5F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x64, 0x1F, 0xFD,
-    0x07, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
-    0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x3F,
-    0xC0, 0x00, 0x7F, 0xD0, 0x0F, 0xF4, 0x00, 0x3F, 0xF0, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x02, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x7F,
-    0x82, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0xBF,
-    0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x06, 0xAF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0xAA, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00,
-    0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2, 0xFE, 0x00, 0x00, 0x1F,
-    0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-    0xBF, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0,
-    0x00, 0x1F, 0xF4, 0x03, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x1F, 0xF0,
-    0x03, 0xFE, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0x40, 0x00, 0x1F, 0xE0,
-    0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xEF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x01, 0xAB, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F,
-    0x80, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0xB8, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00,
-    0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2,
-    0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x55, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xF8,
-    0x3F, 0x80, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0x40, 0x03,
-    0xFF, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x2F, 0xD0, 0x3F, 0xD0, 0x00, 0x07, 0xF8, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x6A, 0xFF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x15, 0x40, 0x00, 0x03, 0xFE, 0x3F,
-    0xD0, 0x00, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x01, 0xFD, 0x1F, 0xD0, 0x00, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xF4,
-    0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00,
-    0x01, 0xFD, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x8F, 0xF0, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00,
-    0x03, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xAF,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x0F, 0xF1,
-    0xFD, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x2F, 0xD0, 0xFF, 0x80, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x07,
-    0xFC, 0x1F, 0xF0, 0x00, 0xBF, 0x82, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0xFF, 0x43, 0xFD,
-    0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0A, 0xEA, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7D,
-    0x0F, 0x80, 0x03, 0xF8, 0xBF, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x2E, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x4F, 0xF0, 0x03, 0xFC, 0x7F, 0xC0, 0x1F, 0xF2,
-    0xFE, 0x00, 0xBF, 0xCF, 0xF8, 0x03, 0xFE, 0x3F, 0xD0, 0x0F, 0xF4, 0xFF, 0x40, 0xFF, 0xC3, 0xFF,
-    0x5F, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xF8, 0xFF, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0xA4, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xEA, 0xA4, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xFA, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x1F, 0xF5, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0x00, 0x7F, 0xD5, 0xFF, 0xE0, 0x3F, 0xE0,
-    0x0B, 0xFC, 0x03, 0xFF, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x7F, 0xC0, 0x0F, 0xF4, 0x02,
-    0xFF, 0x0B, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x02, 0xFF, 0xAB, 0xFF, 0x80, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xF0, 0x03, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x81, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xD0,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x02, 0xFF, 0x55, 0x00, 0x07, 0xFC,
-    0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0x40, 0xFF, 0xEB, 0xFF, 0x43,
-    0xFC, 0x07, 0xFC, 0x03, 0xFD, 0x1F, 0xF0, 0x2F, 0xF0, 0x0F, 0xF4, 0xBF, 0xC0, 0xBF, 0x80, 0x3F,
-    0xD2, 0xFE, 0x01, 0xFF, 0x02, 0xFF, 0x0F, 0xF4, 0x03, 0xFF, 0xBF, 0xF4, 0x3F, 0xC0, 0x0B, 0xFF,
-    0xFF, 0x81, 0xFF, 0x00, 0x07, 0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFE, 0xA8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF5, 0x50, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x26, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xEA, 0xA4, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x06, 0xFF, 0x54, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0xA8, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x19, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80,
-    0x7F, 0xD0, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0x00, 0x00, 0x02, 0xFE,
-    0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF3, 0xFE, 0x00, 0x00, 0x0B,
-    0xFC, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0xFF, 0x95, 0x00, 0x3F, 0xE0, 0x0F, 0xFF, 0xF8, 0x0F,
-    0xFC, 0x00, 0x7F, 0xFF, 0x42, 0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x01, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x1F,
-    0xF4, 0x00, 0xFF, 0x40, 0xFF, 0x80, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00,
-    0x0F, 0xFB, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x2F, 0xFB, 0xFC, 0x00, 0x02, 0xFF, 0x4F, 0xFA, 0xA0, 0x1F, 0xF4, 0x3F, 0xFF, 0xC0, 0xFF,
-    0x80, 0x7F, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x09, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x00,
-    0x02, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xC0,
-    0x00, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0xFF, 0xFF,
-    0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x5B, 0xFF, 0xFD, 0x50, 0x00, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xF8,
-    0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0xFF, 0x40, 0xFF,
-    0x80, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x0A, 0xFF, 0xFF, 0xA4, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x06, 0xBF, 0xFF, 0xA8, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFB, 0xFC, 0x00,
-    0x01, 0xFF, 0x4F, 0xF0, 0x00, 0x1F, 0xF4, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x6A, 0xB8, 0xBA, 0xB8, 0xA0, 0xE0, 0xA1,
-    0x80, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0B, 0x00, 0x2E, 0xA9, 0x2E, 0xAE, 0x0B,
-    0x0A, 0x02, 0x4A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x2A, 0xAA, 0x4F, 0xFF, 0xE3, 0xFF, 0xF5, 0xFF, 0xFC,
-    0x2A, 0xAA, 0x4F, 0xFF, 0xE3, 0xFF, 0xF5, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0x55, 0x54, 0x1A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD,
-    0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F,
-    0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00,
-    0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD,
-    0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F,
-    0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x2A, 0x00, 0x68, 0x05, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFE, 0x0A,
-    0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA,
-    0x40, 0x00, 0xBD, 0x01, 0xFC, 0x03, 0xF8, 0x0B, 0xF4, 0x0F, 0xF0, 0x2F, 0xE0, 0x3F, 0xC0, 0x15,
-    0x40, 0x02, 0xFD, 0x03, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x1F, 0xD0, 0x2F, 0xC0, 0x3F, 0x40, 0x15,
-    0x00, 0x01, 0x54, 0x03, 0xFD, 0x07, 0xFC, 0x0F, 0xF4, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0x80, 0x3E,
-    0x00, 0xBF, 0x2F, 0xCB, 0xF1, 0xFC, 0x7F, 0x0F, 0xC3, 0xF0, 0x14, 0x00, 0xBD, 0x07, 0xE0, 0x1F,
-    0xC0, 0xFD, 0x03, 0xF8, 0x2F, 0xC0, 0xBF, 0x03, 0xF8, 0x0F, 0xF0, 0xFF, 0x02, 0xFD, 0x1F, 0xF0,
-    0x3F, 0xC3, 0xFD, 0x01, 0x54, 0x15, 0x40, 0x02, 0xFD, 0x1F, 0xE0, 0x3F, 0xC3, 0xFD, 0x0B, 0xF4,
-    0x3F, 0xC0, 0xFF, 0x0B, 0xF4, 0x1F, 0xD0, 0xFF, 0x02, 0xFC, 0x1F, 0xC0, 0x3F, 0x03, 0xF8, 0x01,
-    0x50, 0x15, 0x00, 0x01, 0x54, 0x05, 0x50, 0x3F, 0xC2, 0xFE, 0x07, 0xF8, 0x3F, 0xC0, 0xFF, 0x07,
-    0xF8, 0x0F, 0xE0, 0xFF, 0x02, 0xFC, 0x0F, 0xE0, 0x3F, 0x82, 0xFC, 0x03, 0xE0, 0x2F, 0x40, 0xFF,
-    0x0B, 0xF3, 0xFC, 0x2F, 0xDB, 0xF0, 0x7F, 0x5F, 0xC1, 0xFD, 0x7F, 0x03, 0xF4, 0xFC, 0x0F, 0xD3,
-    0xF4, 0x2F, 0x81, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x01, 0x95, 0xF9, 0x68, 0xBF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0x4E, 0xAF, 0xDA, 0xC0, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x05, 0x0F, 0xC1, 0x40, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xBF, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x1F, 0xFF, 0x43, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xFF, 0xFC,
-    0x0F, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0xFE, 0x00, 0x0F,
-    0xFC, 0x01, 0xFF, 0xF0, 0x2F, 0xFF, 0xC3, 0xFF, 0xF4, 0x3F, 0xF4, 0x07, 0xF4, 0x00, 0xB4, 0x00,
-    0x04, 0x00, 0x00, 0x06, 0x43, 0xFD, 0x7F, 0xEB, 0xFD, 0x7F, 0xC0, 0x50, 0x05, 0x00, 0x05, 0x43,
-    0xFC, 0x02, 0xFE, 0xBF, 0xD0, 0x3F, 0xFB, 0xFC, 0x07, 0xFE, 0x7F, 0x80, 0x3F, 0xC0, 0x40, 0x00,
-    0x50, 0x05, 0x00, 0x05, 0x00, 0x05, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0xBF, 0xD0, 0xBF, 0xD0,
-    0xBF, 0xDB, 0xFC, 0x0B, 0xFC, 0x0F, 0xFC, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x40, 0x00, 0x40,
-    0x00, 0x40, 0x05, 0x03, 0xFC, 0xBF, 0xDF, 0xFC, 0x7F, 0x80, 0x40, 0x6A, 0xA8, 0xBA, 0xA8, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x2A, 0xA9, 0x2A, 0xAE, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F,
-    0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
-    0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0D, 0x00, 0x0D, 0x00,
-    0x0D, 0x00, 0x0D, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xD3, 0xF8, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF4,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x1F, 0xC6, 0xF8, 0x00, 0x1B, 0x90, 0x7F, 0x5F,
-    0xE3, 0xF2, 0xFF, 0xF0, 0x0F, 0xFF, 0x83, 0xFF, 0xFC, 0xFD, 0x7F, 0xFF, 0x83, 0xFF, 0xFC, 0x2F,
-    0xFF, 0x6F, 0x8F, 0xF3, 0xFC, 0x7F, 0x9F, 0xD0, 0x7F, 0x87, 0xF1, 0xFD, 0x2F, 0xCF, 0xF0, 0xFD,
-    0x00, 0x00, 0xFD, 0x2F, 0xC2, 0xFC, 0xFD, 0x0F, 0xD0, 0x00, 0x3F, 0x83, 0xF8, 0x3F, 0xDF, 0xC0,
-    0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x43, 0xF9, 0xFC, 0x1F, 0xC0, 0x01, 0xFC, 0x03, 0xF4, 0x7F, 0x6F,
-    0xC2, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x4B, 0xF2, 0xFC, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xF0, 0x02, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0xFF, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0xBF,
-    0xE0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD3, 0xF8, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF4, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x7F, 0x1B, 0xE0, 0x00, 0x6E, 0x40, 0x02, 0xF8, 0x07, 0xF5, 0xFE,
-    0x3F, 0x2F, 0xFF, 0x00, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0xFF, 0xFF, 0x3F, 0x5F, 0xFF, 0xE0, 0xFF,
-    0xFF, 0x07, 0xFF, 0xF8, 0x2F, 0xFF, 0x6F, 0x8F, 0xF3, 0xFC, 0x7F, 0x9F, 0xD3, 0xFD, 0xBF, 0x01,
-    0xFE, 0x1F, 0xC7, 0xF4, 0xBF, 0x3F, 0xC3, 0xF5, 0xFD, 0x1F, 0xC0, 0x00, 0x0F, 0xD2, 0xFC, 0x2F,
-    0xCF, 0xD0, 0xFD, 0xBF, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0xFE, 0x0F, 0xF7, 0xF0, 0x3F, 0x7F, 0xC2,
-    0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0x43, 0xF9, 0xFC, 0x1F, 0xCF, 0xE0, 0xFE, 0x00, 0x07, 0xF0, 0x0F,
-    0xD1, 0xFD, 0xBF, 0x0B, 0xF3, 0xF8, 0x3F, 0x40, 0x03, 0xF4, 0x03, 0xF4, 0xBF, 0x2F, 0xC3, 0xF8,
-    0xFE, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0xFF, 0x47, 0xFF, 0xFC, 0x3F, 0xFF, 0xE0, 0x02, 0xFC,
-    0x00, 0x2F, 0xFF, 0x80, 0xFF, 0xFD, 0x07, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x0F,
-    0xFD, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x1F,
-    0x80, 0x02, 0xA0, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0xFD, 0x07, 0xF0,
-    0x03, 0xFC, 0x0F, 0xD0, 0x07, 0xF0, 0x2F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x1F, 0x80, 0xFD, 0x00,
-    0x2A, 0x00, 0xA8, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x0B, 0xF0, 0x02, 0xFC, 0x0F, 0xF0, 0x3F, 0x80,
-    0x0F, 0xD0, 0x7F, 0x03, 0xFC, 0x00, 0xFF, 0x03, 0xF4, 0x1F, 0xC0, 0x07, 0xF0, 0x2F, 0xC0, 0xFE,
-    0x00, 0x3F, 0x40, 0xFC, 0x07, 0xF0, 0x01, 0xF8, 0x0F, 0xD0, 0x3F, 0x00, 0x0A, 0x80, 0x2A, 0x01,
-    0xA4, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0xF8,
-    0x00, 0xA8, 0x7F, 0x42, 0xFC, 0x03, 0xF8, 0x1F, 0xD0, 0x1F, 0xC0, 0xFF, 0x00, 0xFE, 0x03, 0xF0,
-    0x07, 0xF0, 0x2F, 0x80, 0x3F, 0x40, 0xFC, 0x00, 0xF8, 0x0B, 0xD0, 0x0A, 0x80, 0x2A, 0x7F, 0x42,
-    0xFC, 0x0F, 0xE0, 0x0F, 0xE0, 0x7F, 0x42, 0xFC, 0x01, 0xFC, 0x0F, 0xF0, 0x3F, 0x80, 0x3F, 0x80,
-    0xFC, 0x07, 0xF0, 0x07, 0xF0, 0x2F, 0x80, 0xFD, 0x00, 0xFD, 0x03, 0xF0, 0x1F, 0xC0, 0x0F, 0x80,
-    0xBD, 0x03, 0xF0, 0x02, 0xA0, 0x0A, 0x80, 0x29, 0x00, 0x01, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF4,
-    0x00, 0x0F, 0xE0, 0x00, 0xB7, 0xC0, 0x07, 0xCB, 0x00, 0x3D, 0x2D, 0x02, 0xE0, 0x78, 0x0F, 0x00,
-    0xE0, 0xF4, 0x03, 0xC0, 0x00, 0x10, 0x00, 0x1F, 0x40, 0x0F, 0xF4, 0x0F, 0xF8, 0x0F, 0xFC, 0x0F,
-    0xFC, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x0B,
-    0xE0, 0x00, 0x40, 0x00, 0x00, 0x50, 0x01, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0x00,
-    0xBF, 0xC0, 0x0F, 0xF4, 0x0B, 0xFC, 0x07, 0xFD, 0x07, 0xFD, 0x03, 0xFE, 0x02, 0xFE, 0x00, 0x2F,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x0B, 0xF0, 0x00, 0x80,
-    0x07, 0xD0, 0x0F, 0xF8, 0x02, 0xF0, 0x0F, 0xF4, 0x0F, 0xF4, 0x0B, 0xF8, 0x03, 0xFD, 0x03, 0xE0,
-    0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0xE0, 0x00, 0x05, 0x00, 0xFF, 0xFF, 0x80, 0x54,
-    0x2F, 0xC0, 0x3F, 0xFE, 0x01, 0xFD, 0x3F, 0xD0, 0x0F, 0xFC, 0x03, 0xFE, 0x3F, 0xD0, 0x2F, 0xFD,
-    0x02, 0xFE, 0x0B, 0x40, 0xBF, 0xFF, 0x40, 0xB8, 0x00, 0x02, 0xFE, 0x3F, 0xD0, 0x00, 0x00, 0x0B,
-    0xF8, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x40,
-    0x02, 0xFE, 0x01, 0x40, 0x3F, 0xD0, 0x0B, 0xF8, 0x0B, 0xF4, 0x0F, 0xF4, 0x0B, 0xE0, 0x0F, 0xF8,
-    0x03, 0xF4, 0x02, 0x80, 0x0F, 0xF4, 0x00, 0xD0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0xBF, 0xC0, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x0F, 0xF4, 0x0F, 0xF4,
-    0x01, 0xFF, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x02, 0xFE, 0x02, 0xFE, 0x00, 0x3F, 0xD0,
-    0x3F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF8, 0x07, 0xF8, 0x00,
-    0xBF, 0x40, 0xBF, 0x40, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xBF,
-    0xD0, 0xBF, 0xD0, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x00, 0x40, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x2F, 0xFD,
-    0xFF, 0x05, 0xFF, 0x2F, 0xD0, 0x3F, 0x8B, 0xF4, 0x0F, 0xD3, 0xFC, 0x03, 0xF7, 0xFE, 0x01, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x1C, 0x34, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x1B, 0xC0, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x07, 0xD0, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0x78, 0x38, 0x00, 0x00, 0x2C, 0x30,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x2F, 0x2D, 0x00, 0x00,
-    0xF0, 0x78, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x7C, 0x03, 0xC0, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xEB, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC1, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x05, 0x03, 0xF8,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x90, 0x03, 0xF4, 0x00, 0x10, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xFD, 0xF8, 0x00, 0x00,
-    0xFF, 0x9F, 0x40, 0x03, 0xFF, 0xFF, 0xAF, 0xC0, 0x3F, 0xFF, 0xEA, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFC, 0x15,
-    0x00, 0x07, 0xFF, 0xC1, 0x40, 0x3F, 0xEF, 0x80, 0x00, 0x07, 0xFB, 0xF4, 0x00, 0x3F, 0xD3, 0xF0,
-    0x00, 0x07, 0xFC, 0x7F, 0x00, 0x07, 0xE0, 0xFE, 0x00, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0x20, 0x2F,
-    0xC0, 0x00, 0x06, 0x03, 0xF8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x90, 0x00, 0x15, 0x55,
-    0x4F, 0xFF, 0xD3, 0xFF, 0xF4, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x07, 0xFF, 0xD0, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFA, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xF8,
-    0x00, 0x3F, 0x94, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x50, 0x00, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFD, 0x00, 0x1A, 0xAA, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x03,
-    0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0A, 0xBF, 0xC0, 0x03,
-    0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x00, 0x17, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x01,
-    0x6F, 0xD0, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x2A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x1B, 0xFF, 0x80, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF8, 0x2F, 0x96, 0xFF, 0x0F, 0xE5, 0xFF, 0xC1, 0x80, 0x0F,
-    0xF4, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0xFF,
-    0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x3F, 0xE3, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xF8, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x2F, 0x96, 0xFF, 0x02, 0xFF, 0x06, 0x00, 0x3F,
-    0xD0, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x0B, 0xFE,
-    0x07, 0xFC, 0x00, 0x0F, 0xFE, 0x02, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0x40, 0x0F, 0xFD, 0x00,
-    0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01,
-    0x40, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFC, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xE0,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x41, 0xFD, 0x6F, 0xF8, 0x07, 0xFC, 0x02, 0x00, 0x2F, 0xE0, 0x2F,
-    0xF0, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xF0,
-    0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xF0, 0x01, 0xFE, 0x00, 0x0B, 0xFD,
-    0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x01, 0x50, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0xBF,
-    0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xBF, 0xFF, 0xFC, 0x3D, 0x1F, 0xFF,
-    0xFD, 0x3D, 0x1F, 0xFF, 0xFE, 0x3D, 0x1F, 0xFF, 0xFF, 0x3D, 0x1F, 0xFF, 0xFF, 0x3D, 0x1F, 0xFF,
-    0xFF, 0x3D, 0x1F, 0xFF, 0xFF, 0x3D, 0x1F, 0xFF, 0xFF, 0x3D, 0x1F, 0xFF, 0xFE, 0x3D, 0x1F, 0xFF,
-    0xFC, 0x3D, 0x1F, 0xFF, 0xF8, 0x3D, 0x1F, 0xFF, 0xD0, 0x3D, 0x1F, 0x14, 0x00, 0x3D, 0x1F, 0x00,
-    0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00,
-    0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00,
-    0x00, 0x3D, 0x1F, 0x00, 0x00, 0x28, 0x1A, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x3E, 0x3F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8,
-    0x3E, 0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8,
-    0x3E, 0x3F, 0xFF, 0xF8, 0x3E, 0x3F, 0xFF, 0xF8, 0x3E, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFE, 0x00, 0x6F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xF8, 0x3F, 0xFF, 0xF8, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF,
-    0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF,
-    0xFC, 0xF8, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x01, 0xFC, 0x00,
-    0x3E, 0x0B, 0xD0, 0x00, 0xFF, 0xAF, 0x00, 0x07, 0xFF, 0xFE, 0xBF, 0x41, 0xBF, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0x81, 0x40, 0xBF, 0x7F, 0x00, 0x0B, 0xF8, 0xFD, 0x00, 0x0F, 0xC2,
-    0xFC, 0x00, 0x09, 0x03, 0xF4, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0B, 0xFC,
-    0x0F, 0xFC, 0x0F, 0xF8, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0xBF, 0x00,
-    0x7F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x38, 0x00,
-    0x00, 0x2C, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x1C, 0x00, 0x34, 0x00, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x40, 0x1B, 0xC0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xB8, 0x1F, 0x80, 0x00, 0x0F, 0xFA, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xAF, 0xD0, 0x01,
-    0xBF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x14, 0x00, 0x2F, 0xEF, 0xC0,
-    0x00, 0x07, 0xFC, 0xBE, 0x00, 0x00, 0x2F, 0x07, 0xF0, 0x00, 0x00, 0x50, 0x3F, 0x40, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x7E, 0x00, 0x00, 0x3F, 0xEB, 0xC0, 0x00, 0x07, 0xFF, 0xFE,
-    0xBF, 0x40, 0x06, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x50, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x2F, 0xF2, 0xF8, 0x00, 0x00, 0xBC, 0x1F, 0xC0, 0x00, 0x02, 0x40, 0xFD,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x1F, 0xCF, 0xFC, 0x0F, 0xE3,
-    0xFF, 0x03, 0xF4, 0xBF, 0x82, 0xFC, 0x06, 0x40, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x05,
-    0x01, 0xFC, 0x1F, 0xF0, 0xFE, 0x0B, 0xFC, 0x7F, 0x02, 0xFF, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x7C, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x90, 0x01, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0x40, 0x1A,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x7C, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xFE, 0x6F, 0xD0, 0x0B, 0x80,
-    0x00, 0xF0, 0x2D, 0x00, 0x00, 0x38, 0x34, 0x00, 0x00, 0x2C, 0x20, 0x00, 0x00, 0x04, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0x03, 0xE0, 0x40, 0x07, 0xC3, 0xE2, 0xF0, 0x0F, 0xF7, 0xEB, 0xF4, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x6A, 0xFF, 0xFF, 0xAA, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x0B, 0xFB, 0xEF, 0xF0, 0x0B, 0xD3,
-    0xE3, 0xF0, 0x02, 0x43, 0xE0, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x3F, 0x83, 0xF8, 0x7F, 0x47, 0xF4, 0x02, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0x80, 0x0F, 0xD1, 0xFD,
-    0x1F, 0xC2, 0xFC, 0x00, 0xFF, 0x0F, 0xE0, 0xFD, 0x0F, 0xD0, 0x07, 0xF0, 0x7F, 0x0B, 0xF0, 0xFE,
-    0x00, 0x3F, 0x43, 0xF0, 0x3F, 0x07, 0xF0, 0x01, 0xF8, 0x2F, 0x83, 0xF4, 0x3F, 0x00, 0x0A, 0x80,
-    0xA8, 0x0A, 0x81, 0xA4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x1A, 0x03, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xF0,
-    0xBE, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x0B,
-    0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00,
-    0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xA0, 0x00, 0x00, 0x00, 0x68, 0x00, 0x05,
-    0x03, 0xFC, 0x7F, 0xD7, 0xFD, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x7F, 0xD3, 0xFC,
-    0x06, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x05, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xF4, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x2F, 0xF0,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0xA4, 0x0B, 0xE0, 0x0A, 0x40, 0x03, 0xFD, 0x0B, 0xE0, 0x3F, 0xD0, 0x07, 0xFE, 0x0B, 0xE0,
-    0x7F, 0xE0, 0x03, 0xFD, 0x0B, 0xE0, 0x3F, 0xD0, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x1F, 0x40, 0x03, 0xFD, 0x0B, 0xE0, 0x7F, 0xD0,
-    0x07, 0xFE, 0x0B, 0xE0, 0x7F, 0xD0, 0x03, 0xFD, 0x0B, 0xE0, 0x7F, 0xD0, 0x01, 0xF8, 0x0B, 0xE0,
-    0x1F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x3F, 0xE7, 0xFE, 0x3F, 0xD0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFE,
-    0x3F, 0xF3, 0xFE, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFC, 0x7F, 0xE7, 0xFE, 0x3F,
-    0xD0, 0x64, 0x15, 0x2F, 0xEF, 0xFF, 0xFF, 0x7F, 0x40, 0x01, 0x92, 0xFE, 0xFF, 0xFF, 0xF3, 0xF0,
-    0x00, 0x2A, 0x3F, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x02, 0xE3, 0xFF, 0xFF, 0xFF, 0xF2, 0xA0, 0x00,
-    0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x7F, 0xFD, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x07, 0xD0, 0x03, 0xC0, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x2F,
-    0xF8, 0x3F, 0xFC, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x38, 0x2C, 0x38,
-    0x2C, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x7F, 0x80, 0x0F, 0xFF,
-    0xC0, 0xBF, 0xFF, 0x43, 0xF8, 0xFE, 0x2F, 0xC2, 0xFC, 0xFE, 0x0F, 0xE3, 0xF4, 0x3F, 0x8F, 0xD0,
-    0xFD, 0x7F, 0x07, 0xF0, 0xFD, 0x3F, 0xC3, 0xFF, 0xFD, 0x0B, 0xFF, 0xE0, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x90, 0x3F, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0xFC, 0x1F, 0x82, 0xF4, 0x3F, 0x03,
-    0xF0, 0x3E, 0x07, 0xD0, 0xBC, 0x0A, 0x80, 0x00, 0x01, 0xA8, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF4, 0x02, 0xF7, 0xF4, 0x0B, 0xD7, 0xF0, 0x1F, 0x8B, 0xF0, 0x3F,
-    0xAF, 0xF8, 0x7F, 0xFF, 0xFC, 0x6A, 0xBF, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x02, 0xAA,
-    0xA0, 0x1F, 0xFF, 0xC0, 0xBF, 0xFF, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7F, 0xFC, 0x01, 0xFF,
-    0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x4E, 0x57, 0xFC, 0x3F, 0xFF, 0xC0, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x07, 0xFF, 0xE0, 0x7F, 0xEF, 0x43, 0xF4, 0x00,
-    0x2F, 0x80, 0x00, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0x1F, 0xD1, 0xFC, 0x7F, 0x03, 0xF0, 0xFC, 0x1F,
-    0xC3, 0xF9, 0xFE, 0x07, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xA9, 0x0F,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xFF, 0xC0, 0xFE, 0x7F, 0x43, 0xF0, 0xBE, 0x0F, 0xE3,
-    0xF0, 0x1F, 0xFF, 0x40, 0x7F, 0xF4, 0x0B, 0xFF, 0xF4, 0x7F, 0x0F, 0xF2, 0xF8, 0x2F, 0xCB, 0xF0,
-    0xFE, 0x1F, 0xFF, 0xF0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x1F, 0xFF, 0x80,
-    0xFF, 0xBF, 0x4B, 0xE0, 0xBE, 0x3F, 0x42, 0xF8, 0xFD, 0x0F, 0xE2, 0xFE, 0xFF, 0x43, 0xFF, 0xFD,
-    0x01, 0x97, 0xF0, 0x00, 0x3F, 0x46, 0x5B, 0xFC, 0x1F, 0xFF, 0x80, 0x7F, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x78, 0x00, 0x1E, 0x01, 0xAB, 0xE9, 0xBF, 0xFF, 0xD5, 0xB9, 0x50, 0x1E,
-    0x00, 0x07, 0x80, 0x01, 0x90, 0x00, 0x55, 0x55, 0x3F, 0xFF, 0xEA, 0xAA, 0xA4, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x6A, 0xAA, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0xF4, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x3C,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x2E, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0xF4, 0x02, 0xF0, 0x03, 0xD0, 0x0B, 0x80, 0x1F, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCB, 0xF0, 0x07, 0xEF, 0xFC, 0x07, 0xF0, 0xFC, 0x0B,
-    0xD0, 0xFC, 0x0F, 0xC0, 0xF8, 0x0F, 0x81, 0xF8, 0x1F, 0x41, 0xF4, 0x2F, 0x02, 0xF0, 0x3F, 0x03,
-    0xF0, 0x29, 0x02, 0x90, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0x0B, 0xF5, 0xFD, 0x3F,
-    0x83, 0xF4, 0xFD, 0x0F, 0xD7, 0xF0, 0x3F, 0x6F, 0xC1, 0xFC, 0xBF, 0x0F, 0xF2, 0xFC, 0x7F, 0x87,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x07, 0xFD,
-    0x02, 0xFF, 0xC1, 0xFF, 0xFC, 0x2F, 0xFF, 0x80, 0xE3, 0xF4, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00,
-    0xBF, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x6F, 0xD0, 0x03,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x01, 0x81, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xF0, 0x00, 0xAF, 0x90, 0x1F, 0xFF, 0xD0, 0x3F, 0xBF, 0xC0, 0x40, 0x7F, 0x00, 0x02,
-    0xF8, 0x02, 0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x6B, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC7, 0x96,
-    0xFF, 0x1F, 0xFF, 0xF0, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x07, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF4, 0x03, 0xF7, 0xF0, 0x0B, 0xC7, 0xF0, 0x2F,
-    0x4B, 0xE0, 0x7F, 0xAF, 0xF8, 0x7F, 0xFF, 0xFC, 0x6A, 0xBF, 0xE8, 0x00, 0x2F, 0xC0, 0x00, 0x2F,
-    0x80, 0x02, 0xAA, 0xA0, 0x1F, 0xFF, 0xC0, 0xBF, 0xFF, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBF,
-    0xFC, 0x02, 0xFF, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x0E, 0x57, 0xFC, 0x3F,
-    0xFF, 0xC0, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF4, 0x0B, 0xFF, 0xD0, 0xBF, 0xEF,
-    0x07, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0xD1, 0xFC, 0x7E, 0x03,
-    0xF1, 0xF8, 0x1F, 0xC3, 0xF5, 0xFD, 0x0B, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0xA8, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x6F, 0xD0, 0x02, 0xFF, 0xF8, 0x03, 0xF9, 0xFC, 0x07,
-    0xF0, 0xFC, 0x03, 0xF1, 0xFC, 0x02, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x3F, 0x83,
-    0xF8, 0x3F, 0x43, 0xF8, 0x3F, 0x87, 0xF4, 0x2F, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xBE, 0x40, 0x2F, 0xFF, 0x41, 0xFE, 0xBF, 0x0F, 0xD0, 0xFC, 0x3F, 0x03, 0xF4, 0xFC, 0x0F,
-    0xD3, 0xFE, 0xFF, 0x07, 0xFF, 0xFC, 0x01, 0x4B, 0xE0, 0x00, 0x7F, 0x06, 0x6F, 0xF4, 0x2F, 0xFF,
-    0x40, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xB4, 0x00, 0x2D, 0x02, 0xAF, 0xA9,
-    0xFF, 0xFF, 0x95, 0xF9, 0x40, 0x2D, 0x00, 0x0B, 0x40, 0x01, 0x80, 0x00, 0x55, 0x55, 0x3F, 0xFF,
-    0xEA, 0xAA, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xF6, 0xAA, 0xA8, 0x00, 0x00, 0x7F, 0xFF, 0xAF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x78, 0x01, 0xF0, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0x2F, 0x00, 0x3D,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3D,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x40, 0x2E, 0x00, 0xBC, 0x02, 0xF0,
-    0x0B, 0xC0, 0x2E, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3D, 0x02, 0xE0, 0x2F,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0xB4, 0x3F, 0xFF, 0xC2, 0xF8, 0xBF, 0x0F, 0xC0, 0xF8, 0x7E, 0x03,
-    0xD2, 0xF4, 0x1F, 0x0B, 0xC0, 0xFC, 0x2F, 0x8B, 0xF0, 0x7F, 0xFF, 0x80, 0x7E, 0x3D, 0x00, 0x01,
-    0xBF, 0x40, 0xBF, 0xFD, 0x2F, 0x83, 0xE3, 0xE0, 0x7D, 0x7F, 0xFF, 0xCB, 0xFF, 0x90, 0xBC, 0x00,
-    0x0B, 0xE0, 0x10, 0x3F, 0xFF, 0x00, 0xBF, 0x90, 0x01, 0xFE, 0x00, 0xFF, 0xFC, 0x2F, 0x8B, 0xE3,
-    0xF0, 0x3E, 0x7D, 0x03, 0xEB, 0xC0, 0x7E, 0xBC, 0x0B, 0xD7, 0xE1, 0xFC, 0x3F, 0xFF, 0x00, 0xBF,
-    0x80, 0x02, 0xF0, 0x2F, 0x00, 0xBD, 0x2F, 0x40, 0x0F, 0xDF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x7F,
-    0x80, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0x9F, 0x40, 0x1F, 0xC3, 0xF0, 0x0F, 0xC0,
-    0xBC, 0x00, 0x02, 0xFF, 0x40, 0x1F, 0xFF, 0x80, 0x50, 0x3F, 0x00, 0x00, 0xBC, 0x02, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xC3, 0xF0, 0x3E, 0x0F, 0x83, 0xF0, 0x2F, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0xA4,
-    0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE7, 0xE0, 0x03, 0xFF, 0xFC,
-    0x07, 0xF4, 0xFC, 0x0B, 0xD0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0x80, 0xF8, 0x1F, 0x41, 0xF4, 0x2F,
-    0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x03, 0xE0, 0x00, 0xA4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0xF8, 0x7F, 0x00, 0x7D, 0x7F, 0x00, 0x2F,
-    0x7E, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFE, 0xF8, 0x00, 0xBC, 0x3F, 0x00, 0x3F,
-    0x07, 0xE0, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0xA4, 0x07, 0xE0, 0x1F, 0x40, 0xBC, 0x03, 0xF0, 0x0F,
-    0x80, 0x7D, 0x02, 0xF0, 0x0F, 0xC0, 0x3E, 0x01, 0xF4, 0x0B, 0xD0, 0x3F, 0x00, 0xF8, 0x00, 0x02,
-    0xC7, 0xE0, 0xBE, 0x00, 0xFB, 0xFE, 0xBF, 0xD0, 0x7F, 0x4F, 0xF5, 0xF8, 0x2F, 0x43, 0xF4, 0x3E,
-    0x0F, 0xC0, 0xFC, 0x1F, 0x83, 0xE0, 0x7E, 0x07, 0xD1, 0xF4, 0x2F, 0x42, 0xF0, 0xBC, 0x0B, 0xC0,
-    0xFC, 0x3F, 0x03, 0xF0, 0x3E, 0x0F, 0x80, 0xF4, 0x1F, 0x40, 0x03, 0xC7, 0xE0, 0x1F, 0xBF, 0xE0,
-    0xBF, 0x5F, 0xC2, 0xF4, 0x3F, 0x0F, 0xC0, 0xF8, 0x3E, 0x07, 0xD1, 0xF4, 0x2F, 0x4B, 0xC0, 0xBC,
-    0x3F, 0x03, 0xF0, 0xF8, 0x0F, 0x40, 0x00, 0xF2, 0xF8, 0x01, 0xFF, 0xFD, 0x02, 0xFC, 0x7F, 0x02,
-    0xF0, 0x3F, 0x03, 0xE0, 0x3F, 0x03, 0xD0, 0x3E, 0x07, 0xD0, 0xBD, 0x0B, 0xF1, 0xFC, 0x0F, 0xFF,
-    0xF0, 0x0F, 0x9F, 0x80, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x02, 0xFE, 0x03, 0xFF, 0xD2, 0xF4, 0x10, 0xBE, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0x80, 0x07, 0xF1,
-    0x41, 0xFC, 0xBF, 0xFD, 0x1F, 0xF8, 0x00, 0x01, 0xD0, 0x03, 0xC0, 0x1F, 0xFD, 0x7F, 0xFD, 0x1F,
-    0x80, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFE, 0x5B, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xAA,
-    0xA8, 0x3F, 0xC1, 0xFF, 0xFF, 0x1F, 0xF0, 0xBF, 0xFF, 0x87, 0xFC, 0x3F, 0xFF, 0xD1, 0xFF, 0x0F,
-    0xF0, 0x00, 0x3F, 0xE7, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x55, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x1B, 0xFF, 0xF4,
-    0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFB, 0xFC, 0x00, 0xBF,
-    0xFF, 0x47, 0xE0, 0x07, 0xFF, 0x3C, 0x3D, 0x00, 0x3F, 0xF1, 0xE1, 0xF0, 0x01, 0xFF, 0x4F, 0x4B,
-    0x40, 0x0B, 0xFC, 0x7C, 0x3C, 0x00, 0x3F, 0xE2, 0xE1, 0xE0, 0x00, 0xFF, 0x4F, 0x0F, 0x40, 0x03,
-    0xFD, 0x78, 0x7C, 0x00, 0x0F, 0xF7, 0xD2, 0xE0, 0x00, 0x3F, 0xFF, 0x0F, 0x00, 0x00, 0xBF, 0xF8,
-    0x78, 0x00, 0x01, 0xFF, 0xE3, 0xEB, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x2E, 0x6F, 0x40, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x02,
-    0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAF, 0xC0, 0x2F, 0xFC, 0x00, 0x14, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xA1,
-    0xF0, 0x2F, 0xF0, 0x3F, 0x7F, 0x03, 0xFE, 0x07, 0xFF, 0xF0, 0x3F, 0xE0, 0xBF, 0xE9, 0x03, 0xFD,
-    0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0xFE, 0x00, 0x03, 0xFE, 0x1F, 0xD0, 0x00, 0x3F, 0xF2, 0xFD, 0x00,
-    0x02, 0xFF, 0x6F, 0xC1, 0x00, 0x0F, 0xFF, 0xFE, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x95, 0x54, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1B, 0xFD, 0x50, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0xFF, 0x55, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0x96, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x01, 0xAF, 0xFE, 0xA9, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0x6F, 0xF5, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0xEA, 0xAA, 0x90, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x2F,
-    0xF4, 0xFF, 0xFD, 0x00, 0x7F, 0x2F, 0xFF, 0xBF, 0xFF, 0xC0, 0x2F, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0x5F, 0xFF, 0xD7, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xC0, 0xFF, 0x80, 0x7F,
-    0xD0, 0x1F, 0xF0, 0x7F, 0xC0, 0x2F, 0xF0, 0x0B, 0xF8, 0x2F, 0xE0, 0x0B, 0xF8, 0x03, 0xFD, 0x0F,
-    0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x43, 0xFC, 0x02, 0xFF, 0x00, 0x3F, 0xC1, 0xFF, 0x01, 0xFF, 0xC0,
-    0x1F, 0xF0, 0xBF, 0xC0, 0xFF, 0xE0, 0x0B, 0xF8, 0x2F, 0xE0, 0xBF, 0xF4, 0x03, 0xFD, 0x0F, 0xF4,
-    0x7F, 0xFD, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xFF, 0x00, 0x7F, 0xC1, 0xFF, 0x2F, 0xBF, 0xC0, 0x1F,
-    0xF0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xD0, 0x07,
-    0xFE, 0x00, 0xFC, 0x00, 0xBF, 0xE0, 0x0F, 0xC0, 0x0F, 0xFF, 0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x2F,
-    0x80, 0x0F, 0xEF, 0x03, 0xF4, 0x01, 0xFA, 0xF0, 0x3F, 0x00, 0xBF, 0xFF, 0xAB, 0xF9, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xD1, 0xBF, 0xAF, 0xAF, 0xE8, 0x03, 0xF1, 0xF4, 0xFD, 0x01, 0xBF, 0x6F, 0x9F, 0xD0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0xFA, 0xF4, 0x01, 0xFC, 0x0F,
-    0xBF, 0x00, 0x2F, 0x80, 0xFF, 0xF0, 0x02, 0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0x40, 0xBF, 0xE0, 0x03,
-    0xF0, 0x0B, 0xFD, 0x00, 0x7F, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x54, 0x00, 0x0F,
-    0xF0, 0x0F, 0xF4, 0x3E, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x2F, 0x40, 0x02, 0xFE, 0x02, 0xFF, 0x0F,
-    0xD0, 0x00, 0xBF, 0x42, 0xFF, 0x9F, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xEF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x80, 0x7F, 0x40, 0x02, 0xFF, 0xA5, 0x00, 0x2F, 0xC0,
-    0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xFF, 0x40, 0x2F, 0xE0, 0x2F, 0xE2,
-    0xFF, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0x9F, 0xFF, 0xF8, 0x03, 0xFD, 0x0B, 0xFD, 0xBF, 0x41, 0xC0,
-    0x0F, 0xFA, 0xFF, 0xF3, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F,
-    0xFC, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x2F, 0xF8, 0x07, 0xFC, 0x2F, 0xE0, 0x00, 0x2F, 0xF0, 0x2F,
-    0xE0, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0xFF, 0x41, 0xFF, 0x28, 0x02, 0xFE, 0x03, 0xFC, 0x03, 0xFC,
-    0xBF, 0xFF, 0xF0, 0x1F, 0xF0, 0x0F, 0xF6, 0xFF, 0xFF, 0x40, 0xBF, 0x80, 0x3F, 0xE7, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xF4, 0x02, 0xF8, 0x01, 0xF8, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0xBF, 0x80, 0x3F, 0x00, 0xFC, 0x03, 0xFE, 0x02, 0xF8, 0x03,
-    0xF0, 0x1F, 0xF8, 0x0F, 0xD0, 0x0F, 0xC0, 0xFF, 0xE0, 0x7F, 0x00, 0x3F, 0x03, 0xEF, 0x82, 0xF8,
-    0x00, 0xFC, 0x2F, 0x7D, 0x0F, 0xC0, 0x03, 0xF0, 0xFC, 0xF4, 0x7F, 0x00, 0x6F, 0xEB, 0xFB, 0xEB,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFE, 0xFE, 0xFF, 0xFF, 0xA0, 0x07, 0xE7, 0xD2,
-    0xF3, 0xF4, 0x00, 0x1F, 0x6F, 0x0B, 0xCF, 0xC0, 0x00, 0xBD, 0xF8, 0x2F, 0x7E, 0x00, 0x02, 0xFB,
-    0xD0, 0xBE, 0xF0, 0x00, 0x0B, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x0B, 0xFD, 0x00, 0x00,
-    0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x02, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xC0, 0x07, 0xF9, 0x56, 0xFF, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0B, 0xF4,
-    0x7F, 0x40, 0x0B, 0xF0, 0xA8, 0x3F, 0x47, 0xF0, 0x00, 0xFE, 0x2F, 0xC3, 0xF4, 0xBF, 0x00, 0x0F,
-    0xD2, 0xFC, 0x7F, 0x4F, 0xE0, 0x01, 0xFD, 0x3F, 0x8B, 0xF0, 0xFE, 0x00, 0x2F, 0xC3, 0xF8, 0xBF,
-    0x1F, 0xD0, 0x03, 0xFC, 0x7F, 0x4F, 0xE2, 0xFC, 0x00, 0x3F, 0x8B, 0xF0, 0xFE, 0x2F, 0xC0, 0x03,
-    0xF4, 0xFF, 0x1F, 0xD3, 0xF8, 0x00, 0x7F, 0x0F, 0xE2, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x3F,
-    0xC7, 0xF0, 0x00, 0xFF, 0x1F, 0xC2, 0xA4, 0xFF, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x2F, 0xD0, 0x01,
-    0xFD, 0x3F, 0xC0, 0x1B, 0xFC, 0x00, 0x2F, 0xC3, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0x8B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0x50,
-    0x7F, 0x80, 0x00, 0x2F, 0xFC, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0x47, 0xFF, 0x00, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x02, 0xFD, 0x00,
-    0x1F, 0xF0, 0x02, 0xFC, 0x00, 0x2F, 0xF0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F,
-    0xE0, 0x0B, 0xF8, 0x00, 0x2F, 0xF0, 0x0F, 0xF4, 0x00, 0x2F, 0xF8, 0x7F, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xEB, 0xF0, 0x00, 0x02, 0xFF, 0x8B, 0xE0, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x00, 0x6A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x5F, 0x80, 0x02, 0xFF, 0x40,
-    0x10, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0A, 0xFF, 0xEA, 0x80, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x17, 0xFE, 0x54, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x96, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0xBF, 0xC0,
-    0xFF, 0xC0, 0x00, 0xFF, 0x82, 0xFF, 0x40, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0xFF, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0x2F, 0xF0, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2B, 0xFF, 0xFF, 0xEA, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x1F, 0xF0,
-    0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x1F, 0xF4, 0x00, 0x2F, 0xE0, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x0F,
-    0xFC, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD1,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x70,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFD, 0x20, 0x00, 0x2F, 0xFF, 0xBE, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0x2F,
-    0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x03, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x95,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x6F, 0xE4, 0x01,
-    0xFE, 0x00, 0x2F, 0xF0, 0xBF, 0xFF, 0x40, 0xBF, 0x80, 0x0F, 0xF8, 0xBF, 0xEF, 0xF0, 0x3F, 0xD0,
-    0x0B, 0xFC, 0x3F, 0xC0, 0xFD, 0x0F, 0xF0, 0x07, 0xFE, 0x1F, 0xC0, 0x3F, 0x87, 0xFC, 0x0B, 0xFF,
-    0x0B, 0xF0, 0x0F, 0xE2, 0xFF, 0xAF, 0xFF, 0x43, 0xFC, 0x07, 0xF4, 0xFF, 0xFF, 0xFF, 0x40, 0xFF,
-    0x97, 0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFD, 0x0F, 0xFF, 0xE4, 0x00, 0x2F, 0xEF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF2, 0xFC, 0x00, 0x00, 0x7F,
-    0xC1, 0xFC, 0x00, 0x00, 0x7F, 0xC1, 0xFC, 0x00, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x00, 0xBF, 0xC3,
-    0xF8, 0x00, 0x00, 0x7F, 0xCB, 0xF0, 0x00, 0x00, 0x7F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x08, 0x0F, 0xF8, 0x00, 0x00,
-    0x3C, 0x1F, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0xFC, 0x00, 0x01, 0xFE, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xF7, 0xFE, 0x00, 0x0F, 0xEF, 0xE2, 0xFE, 0x00, 0x2F, 0x4F, 0x82, 0xFF, 0x00, 0x7E, 0x0B, 0x01,
-    0xFF, 0x00, 0x00, 0x04, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x5B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xC0, 0x1F, 0xE0, 0x17, 0xFD, 0x57, 0xFE, 0x43, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x2F, 0xFE, 0xAF, 0xFE, 0x40, 0xFF, 0x47, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x02, 0xFE, 0x50, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xBF,
-    0xC0, 0x3F, 0xFD, 0xF8, 0x05, 0x01, 0xFF, 0xC3, 0xE0, 0x00, 0x0F, 0xFC, 0x0F, 0x40, 0x00, 0x7F,
-    0xE0, 0x7C, 0x00, 0x02, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xF8, 0x0F, 0xEA, 0xA8, 0x3F, 0xD0, 0x3F,
-    0xFF, 0xF1, 0xFF, 0x41, 0xFF, 0xFF, 0x87, 0xFC, 0x0B, 0xFF, 0xFD, 0x1F, 0xF0, 0x2F, 0x0F, 0xF0,
-    0x7F, 0xD0, 0xF8, 0x7F, 0xC0, 0xFF, 0x83, 0xD2, 0xFE, 0x03, 0xFF, 0x5F, 0x0F, 0xF8, 0x07, 0xFF,
-    0xFD, 0xBF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00,
-    0x00, 0x1F, 0xE7, 0xF4, 0x00, 0x00, 0x0F, 0xF5, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x6F, 0xF5, 0x57, 0xFD, 0x40, 0x0F,
-    0xF4, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x0B, 0xF4, 0x01, 0xFF,
-    0x00, 0x02, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xAB, 0xFF, 0x00, 0x01, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x1A, 0xAA, 0xAB, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFC, 0x1A, 0xBF, 0xFF, 0xFA,
-    0x40, 0x0F, 0xFF, 0xFC, 0x00, 0x17, 0xFF, 0xFE, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x05, 0x00,
-    0x2F, 0xF9, 0x5B, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xBF, 0x00, 0x3F, 0xF8, 0xBC, 0x14, 0x01, 0xFF, 0x83, 0xE0, 0x00, 0x0F, 0xFC, 0x0F,
-    0x40, 0x00, 0x7F, 0xD0, 0x7C, 0x00, 0x02, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xF8, 0x0F, 0xC0, 0x00,
-    0x3F, 0xD0, 0x3E, 0x00, 0x00, 0xFF, 0x40, 0xF4, 0x00, 0x03, 0xFC, 0x07, 0xC0, 0x00, 0x0F, 0xF0,
-    0x2F, 0x00, 0x00, 0x3F, 0xD0, 0xF8, 0x00, 0x00, 0xFF, 0x83, 0xE0, 0x00, 0x03, 0xFF, 0x4F, 0x41,
-    0x00, 0x07, 0xFF, 0xFE, 0xBC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x40, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x02, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0xFE, 0x01, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1B, 0xFD, 0x5F, 0xF9, 0x50, 0x02, 0xFE, 0x03,
-    0xFD, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x2F,
-    0xE0, 0x00, 0x0B, 0xF8, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x41, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xF4, 0x40, 0x0B, 0xF8, 0x07, 0xFF,
-    0xF4, 0x03, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0xBF, 0x40, 0x00, 0x03,
-    0xFE, 0x00, 0x10, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x01, 0xA4, 0x68, 0x29, 0x3F, 0xC0, 0x7F, 0xDF, 0xEF, 0xF3, 0xFC, 0x0B,
-    0x3F, 0x7F, 0xAF, 0x3F, 0xC0, 0xBB, 0xE2, 0xF1, 0xFB, 0xF4, 0x03, 0xFE, 0x7E, 0x1F, 0xFF, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x4B, 0xD7, 0xD0, 0x00,
-    0x00, 0xF4, 0xB8, 0x7C, 0x00, 0x00, 0x05, 0x01, 0x01, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x1A, 0xAF, 0xFA, 0xA8, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0x55, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFD,
-    0x05, 0x57, 0xFE, 0x50, 0x00, 0x1F, 0xF4, 0x01, 0xAB, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFE, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
-    0x10, 0x00, 0x7F, 0xDB, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x06, 0xFF, 0xFE, 0x40, 0x1F, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0x06, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0x90,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0xA7, 0xFC, 0x00, 0xFE, 0x07, 0xF8, 0x02, 0xFE, 0x0B, 0xF4, 0x03,
-    0xFC, 0x0F, 0xF4, 0x0B, 0xFC, 0x0F, 0xF0, 0x2F, 0xF4, 0x1F, 0xF6, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x00,
-    0x3E, 0x0F, 0x40, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xD0, 0x00,
-    0x0F, 0x80, 0x1F, 0x09, 0x10, 0x2E, 0x00, 0x7C, 0xFD, 0xE0, 0xB4, 0x02, 0xFF, 0xFF, 0xD7, 0xC0,
-    0x0F, 0xFA, 0xFB, 0xFE, 0x00, 0x3F, 0x43, 0x07, 0x90, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0xEB, 0xFE, 0xAD, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x82, 0xFD, 0x0F, 0xFC, 0x03, 0xFE, 0x03,
-    0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xF8, 0x07, 0xFC, 0x03, 0xFC, 0x0F,
-    0xF4, 0x0B, 0xF8, 0x07, 0xFC, 0x0F, 0xF0, 0x0B, 0xF4, 0x0B, 0xF8, 0x0F, 0xF0, 0x05, 0x50, 0x0B,
-    0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00,
-    0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x2F,
-    0xF4, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x07, 0xFC, 0x00,
-    0x7F, 0xC0, 0x3F, 0xF0, 0x06, 0xFF, 0x5B, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x1B, 0xFD, 0x50, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x06, 0xFF, 0xEA, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF,
-    0xD5, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x74, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x06, 0xFF,
-    0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0x83, 0xD9, 0x00, 0xBF, 0xE7, 0x87, 0x80, 0x00, 0xFF, 0xCB, 0x47, 0x40, 0x02,
-    0xFF, 0x0F, 0x0B, 0x40, 0x03, 0xFF, 0x0F, 0x0F, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x1A, 0xAF, 0xFF, 0xFA, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xB0, 0xB0, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0F,
-    0x0E, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
-    0x1F, 0xE0, 0x3F, 0xE0, 0x0B, 0xFE, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x7F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF8, 0x03, 0xFC, 0x03,
-    0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0xBF, 0xD0, 0x1F, 0xFA, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00,
-    0xF0, 0xF0, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x2A, 0xAA, 0x4F, 0xFF, 0xE3, 0xFF, 0xF5, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE9, 0x6F, 0xD0, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF,
-    0x86, 0xE0, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFE,
-    0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD7,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+static const uint8_t notosans_14_bolditalicBitmaps[38123] = {
+    0x85, 0x55, 0x31, 0x6C, 0x1D, 0x45, 0x10, 0x9D, 0xBB, 0xB5, 0x7D, 0x0A, 0x57, 0x6C, 0x03, 0x4D,
+    0x90, 0xB8, 0x16, 0x59, 0x82, 0x6B, 0x29, 0x90, 0xF6, 0x90, 0x05, 0x2E, 0x28, 0x4C, 0x41, 0x10,
+    0x1D, 0x14, 0x54, 0x34, 0x6E, 0x28, 0xA8, 0xBC, 0x17, 0xA5, 0xA3, 0x49, 0x84, 0x04, 0x2D, 0x29,
+    0xA0, 0xE0, 0x37, 0x69, 0x28, 0x89, 0xF7, 0x12, 0x0A, 0x0A, 0x8A, 0x1C, 0x71, 0xE9, 0x66, 0x2D,
+    0x8C, 0x10, 0x50, 0x64, 0x51, 0xCE, 0xD2, 0x45, 0xDA, 0xBB, 0xE1, 0xCD, 0xDE, 0xB7, 0xB1, 0x11,
+    0x12, 0x6B, 0xCF, 0xFF, 0x7F, 0xF7, 0x76, 0x67, 0x67, 0xDE, 0x7B, 0x33, 0x47, 0xAE, 0xD3, 0x91,
+    0xB8, 0xD5, 0x43, 0xC6, 0x54, 0x87, 0x7C, 0x26, 0xD3, 0xAB, 0x48, 0xA6, 0x2B, 0x46, 0x72, 0x8D,
+    0x0E, 0xC4, 0x94, 0xC6, 0x26, 0x61, 0xD5, 0xF5, 0xE5, 0x44, 0xB6, 0xA5, 0x86, 0xF4, 0xC9, 0x54,
+    0x3D, 0x8E, 0xD5, 0xC3, 0x58, 0xFF, 0x30, 0xD6, 0xB7, 0x06, 0xB3, 0x13, 0x8C, 0x0A, 0xDB, 0xF9,
+    0x1D, 0xA2, 0xEF, 0x75, 0x47, 0x2A, 0x18, 0xA2, 0xEA, 0xE6, 0x48, 0x74, 0x5F, 0xF7, 0xEB, 0xD9,
+    0x03, 0xF8, 0x63, 0xE6, 0x87, 0x30, 0x2E, 0x61, 0x23, 0x1D, 0x14, 0x9E, 0xF2, 0xC1, 0xC0, 0x59,
+    0x87, 0x0B, 0xB1, 0xF4, 0xB3, 0x3C, 0xDB, 0x85, 0x45, 0xB2, 0x45, 0xA0, 0x6C, 0xAC, 0x5B, 0x2A,
+    0xFB, 0x89, 0x08, 0xBE, 0x89, 0x62, 0x85, 0x99, 0xBF, 0x4F, 0xEB, 0xA1, 0x17, 0xDB, 0xE2, 0x53,
+    0x39, 0x4B, 0xCC, 0x53, 0xCE, 0x87, 0x51, 0x4D, 0xAF, 0x6F, 0xA8, 0xF8, 0x29, 0xA9, 0xF9, 0x3B,
+    0xCA, 0x19, 0xA7, 0x78, 0xC6, 0x71, 0xEE, 0xA9, 0xC0, 0x24, 0xC7, 0xA5, 0xEA, 0x11, 0xEC, 0xA7,
+    0xF1, 0x93, 0xE2, 0xF6, 0x68, 0x9F, 0x70, 0xB0, 0xCC, 0x1E, 0xC7, 0x9B, 0x2D, 0x77, 0x4A, 0xF4,
+    0x12, 0x5C, 0xBE, 0x02, 0x7B, 0xF9, 0xFC, 0x8E, 0x1C, 0xC9, 0x1F, 0xE0, 0x38, 0x52, 0x50, 0x3C,
+    0x91, 0x69, 0xAA, 0xA3, 0x31, 0x47, 0x1E, 0xDA, 0x57, 0x9D, 0x1A, 0x4D, 0x1B, 0x49, 0xF7, 0x33,
+    0x32, 0xB4, 0xC5, 0x70, 0x48, 0x59, 0xAC, 0x7F, 0xFC, 0xEB, 0xB0, 0x38, 0x9B, 0x4D, 0xCD, 0x9A,
+    0x9F, 0x9E, 0xF1, 0x5C, 0xF3, 0xFE, 0xED, 0xA7, 0xB1, 0x3A, 0x89, 0xF6, 0xED, 0x40, 0xFA, 0x71,
+    0xAC, 0x3B, 0x9A, 0xB5, 0x67, 0x2A, 0x83, 0xD9, 0x19, 0xC9, 0xD2, 0x54, 0xF5, 0x6A, 0x50, 0x83,
+    0x23, 0xD3, 0x6A, 0x1E, 0xF2, 0x48, 0x35, 0xB7, 0x55, 0x47, 0xF5, 0x48, 0x57, 0x46, 0x0D, 0x04,
+    0xC8, 0x22, 0x07, 0x7C, 0x44, 0x4C, 0x4F, 0x10, 0x95, 0x0E, 0x06, 0x30, 0x47, 0x2D, 0x19, 0x96,
+    0x58, 0x34, 0xC7, 0xF8, 0x28, 0x11, 0x23, 0x65, 0x48, 0x12, 0x81, 0x0F, 0x2A, 0x2A, 0xE6, 0x7C,
+    0x56, 0x6C, 0x3D, 0xE7, 0x5C, 0x4C, 0xDC, 0x72, 0xEB, 0xB8, 0x33, 0xBD, 0xE6, 0x4E, 0x8F, 0x19,
+    0xF7, 0x8A, 0xBF, 0xE4, 0x01, 0x2E, 0x01, 0x9E, 0xC6, 0x47, 0x00, 0x3D, 0xBB, 0x00, 0xEB, 0x1D,
+    0xC1, 0x15, 0xEC, 0x82, 0x5A, 0xF0, 0x9A, 0xDF, 0x25, 0x35, 0x42, 0x0D, 0x20, 0xBF, 0xEE, 0xB3,
+    0x19, 0xF7, 0x92, 0x6D, 0x30, 0xA9, 0x3C, 0x39, 0x5A, 0x7F, 0x37, 0x88, 0x1C, 0xEB, 0x08, 0x88,
+    0x65, 0x69, 0xF9, 0xE9, 0x28, 0x9B, 0xE4, 0x28, 0x66, 0x48, 0x69, 0x7B, 0xC9, 0x04, 0xA4, 0x62,
+    0x09, 0xDB, 0xB3, 0x28, 0x8F, 0x69, 0x4E, 0xFF, 0x7C, 0xE9, 0x3F, 0xAD, 0xE0, 0x11, 0xF6, 0xC0,
+    0x15, 0x34, 0x58, 0x06, 0x71, 0x51, 0xF7, 0xC0, 0x08, 0xCF, 0xF3, 0x49, 0xD6, 0xB4, 0xA7, 0xEB,
+    0xED, 0x5A, 0x05, 0x40, 0x05, 0x0A, 0x82, 0xBF, 0x57, 0xA1, 0x26, 0xBE, 0xD7, 0x14, 0x3C, 0xBB,
+    0x37, 0x1C, 0x80, 0xB0, 0x3C, 0x14, 0x7C, 0xB3, 0x71, 0x8E, 0x8A, 0x78, 0x48, 0xE5, 0x83, 0x48,
+    0x9B, 0x6A, 0x20, 0xBA, 0x26, 0x5A, 0x6E, 0x70, 0x08, 0xDF, 0x80, 0x4C, 0x84, 0x05, 0xC1, 0x62,
+    0x5A, 0x00, 0x83, 0xAF, 0x98, 0x67, 0x00, 0x32, 0xDE, 0xB0, 0x37, 0x9A, 0xAB, 0x4F, 0xA1, 0x6B,
+    0x40, 0xFB, 0xAE, 0x9A, 0x8A, 0x58, 0x0E, 0x3A, 0x54, 0x9D, 0x69, 0x0D, 0x6D, 0xAF, 0xF6, 0xF8,
+    0x17, 0x3E, 0xE3, 0xB8, 0xA9, 0xA2, 0x3B, 0x8E, 0xB6, 0x85, 0xDF, 0x54, 0x2F, 0x28, 0x11, 0xC1,
+    0x40, 0xD0, 0x91, 0xE8, 0xA9, 0xC4, 0xC5, 0x48, 0x47, 0xC2, 0x5F, 0x36, 0xFC, 0xDF, 0xA6, 0xEC,
+    0xDF, 0x9B, 0xFE, 0x19, 0x39, 0xB7, 0x54, 0x25, 0xE2, 0x50, 0xB6, 0xC7, 0x93, 0x62, 0x35, 0x17,
+    0x90, 0xBE, 0x8E, 0xB0, 0x21, 0xE7, 0x0A, 0x25, 0x2C, 0x65, 0x6C, 0xBC, 0x12, 0x9B, 0x4C, 0x5F,
+    0x44, 0xD3, 0x97, 0x30, 0x3D, 0x9A, 0xBE, 0x0A, 0xC6, 0x9B, 0x50, 0x9F, 0x71, 0x57, 0x41, 0xF4,
+    0x25, 0x8A, 0x03, 0x4A, 0x21, 0xDA, 0x10, 0xC7, 0x0E, 0xBF, 0xBB, 0x82, 0x7D, 0xC9, 0x63, 0xC5,
+    0x93, 0x9E, 0x39, 0x9F, 0x6C, 0xF7, 0x5A, 0xED, 0x49, 0x0F, 0x12, 0x97, 0x84, 0x64, 0x21, 0xCE,
+    0xCB, 0x73, 0xD7, 0x91, 0xB9, 0x3C, 0x5F, 0x86, 0x03, 0xC5, 0x2C, 0xFA, 0x92, 0x08, 0xFF, 0xE4,
+    0x46, 0x37, 0xC6, 0x67, 0xA4, 0x21, 0x4B, 0x75, 0x91, 0x5A, 0x9B, 0x0E, 0xA3, 0xA1, 0xE0, 0xF7,
+    0xB9, 0x75, 0x78, 0x26, 0xD6, 0xC2, 0x1A, 0xB8, 0xF8, 0x63, 0xD5, 0x80, 0x13, 0x0F, 0x42, 0x86,
+    0x5A, 0x7C, 0xA5, 0xF1, 0x22, 0xDF, 0xC9, 0xC0, 0x50, 0x2E, 0x0B, 0xF3, 0x07, 0x33, 0x7D, 0xA8,
+    0x20, 0x19, 0x74, 0xAD, 0xE4, 0x1B, 0x95, 0x90, 0xB9, 0x01, 0x05, 0xDB, 0x92, 0x99, 0xA4, 0x5C,
+    0x70, 0x45, 0x2D, 0x1C, 0x0E, 0xE7, 0xD6, 0x60, 0xFE, 0xEC, 0x4D, 0xF6, 0x70, 0xDC, 0x89, 0xF2,
+    0xF7, 0x25, 0xFD, 0xE7, 0x93, 0x67, 0x89, 0x49, 0xE2, 0x70, 0x38, 0x60, 0xA3, 0x9C, 0xA6, 0xC5,
+    0xD3, 0x13, 0x88, 0xEF, 0x11, 0x34, 0x78, 0x04, 0xB9, 0xA3, 0xF6, 0x2A, 0xEF, 0x5A, 0x94, 0x5F,
+    0xAF, 0x83, 0x0E, 0xE5, 0x7C, 0x6F, 0xBE, 0x25, 0xC5, 0x23, 0x4D, 0x6B, 0x7B, 0xE5, 0x7E, 0x5F,
+    0xA8, 0x2C, 0xE2, 0x12, 0x13, 0x21, 0x0F, 0x14, 0x75, 0x2A, 0x30, 0x40, 0xCB, 0x1E, 0x61, 0x0F,
+    0x89, 0xD7, 0x0B, 0xE2, 0x85, 0x74, 0xD0, 0x90, 0x49, 0x01, 0x22, 0x53, 0xDA, 0x7A, 0x4F, 0x62,
+    0xA8, 0x86, 0x25, 0xA1, 0xE4, 0xC0, 0xF6, 0x0D, 0x81, 0xB4, 0x2F, 0xDC, 0x88, 0xBE, 0x09, 0x9A,
+    0x51, 0xE0, 0x35, 0xBA, 0x1E, 0x5A, 0xF2, 0x7A, 0x64, 0x6E, 0xC2, 0x0D, 0x71, 0x91, 0xC4, 0xB3,
+    0xF7, 0x15, 0x27, 0x24, 0x52, 0x24, 0x95, 0xFF, 0x08, 0xBD, 0x81, 0x1B, 0xF4, 0xB8, 0x5E, 0x7A,
+    0x9D, 0x0B, 0x75, 0x70, 0x5D, 0x15, 0x5C, 0x0B, 0x6B, 0xE4, 0xBB, 0xF6, 0xAE, 0xB3, 0xBD, 0xFD,
+    0x15, 0xAD, 0x21, 0x05, 0x8A, 0xDA, 0x63, 0x9F, 0x24, 0x21, 0x5D, 0x5A, 0xAD, 0x81, 0x0A, 0x46,
+    0x22, 0x27, 0xBC, 0x2A, 0x52, 0x72, 0x09, 0x74, 0x5E, 0xC7, 0x27, 0x28, 0x5B, 0xA9, 0x43, 0xBF,
+    0xA0, 0x5D, 0xAD, 0x37, 0xE2, 0x5D, 0x71, 0xB1, 0x31, 0x4B, 0xE8, 0xAE, 0x19, 0x5F, 0x47, 0x0D,
+    0x87, 0x48, 0xA6, 0x4B, 0x09, 0xF1, 0x0E, 0x43, 0xEB, 0xA6, 0xAB, 0x3D, 0x40, 0x1D, 0x51, 0xE3,
+    0xBC, 0x2B, 0xED, 0x70, 0x4A, 0x3D, 0x3B, 0xC7, 0xB7, 0x4A, 0x8A, 0x82, 0xCA, 0x67, 0xDC, 0x89,
+    0x37, 0x95, 0x97, 0x37, 0x94, 0x0E, 0xD2, 0xE0, 0xE0, 0x1F, 0x6F, 0x96, 0x56, 0x30, 0x06, 0x04,
+    0xCD, 0xD2, 0xC2, 0xD6, 0x42, 0xAC, 0x38, 0x8A, 0x5C, 0xF4, 0x64, 0x91, 0xB6, 0x39, 0xC2, 0xE1,
+    0xBD, 0x80, 0xC2, 0x40, 0x07, 0xC4, 0x7D, 0x47, 0x38, 0xBC, 0x07, 0x48, 0x51, 0x0B, 0xA1, 0x66,
+    0xDB, 0x5E, 0xFF, 0x7C, 0x5A, 0x50, 0x43, 0xB0, 0x65, 0xBC, 0xF6, 0x16, 0xF7, 0x06, 0xD4, 0x24,
+    0xDA, 0xC6, 0x73, 0x95, 0x64, 0x38, 0x83, 0xBF, 0x89, 0xBE, 0xBE, 0x5C, 0x94, 0x9B, 0x20, 0xD4,
+    0xF5, 0x00, 0xB2, 0xDD, 0x58, 0x36, 0x81, 0x30, 0xD0, 0x60, 0xFA, 0xAB, 0xDB, 0x96, 0xF1, 0x82,
+    0x34, 0x50, 0x0B, 0x0D, 0xA1, 0xD5, 0xD5, 0x1D, 0x9A, 0xD2, 0xC1, 0xC5, 0xA3, 0xBB, 0x40, 0x10,
+    0x77, 0xCF, 0x89, 0x03, 0x84, 0x5F, 0xCF, 0x60, 0xA1, 0x25, 0xEB, 0x81, 0xD6, 0x69, 0xE2, 0x59,
+    0xDE, 0x11, 0x58, 0x1B, 0xB0, 0x00, 0xB8, 0xF7, 0x81, 0xEA, 0x73, 0x72, 0xF0, 0xE3, 0xD5, 0xEA,
+    0x1B, 0xD0, 0xF4, 0x1B, 0xEC, 0xB3, 0xD5, 0xEA, 0xDB, 0xB5, 0xBB, 0xCB, 0x3D, 0x8D, 0xFE, 0x7B,
+    0xFC, 0x0D, 0xC5, 0x55, 0x31, 0xAE, 0xE4, 0x44, 0x10, 0x2D, 0xDB, 0x62, 0x2D, 0xE1, 0xA0, 0x23,
+    0x04, 0x22, 0xF1, 0x11, 0x7C, 0x84, 0x36, 0x10, 0x12, 0xB0, 0x39, 0x01, 0x47, 0xE0, 0x06, 0xB4,
+    0x89, 0x09, 0xD8, 0x88, 0x98, 0x60, 0x03, 0x34, 0x04, 0x73, 0x83, 0xE9, 0x86, 0x3D, 0x00, 0xE6,
+    0x04, 0xDB, 0x12, 0x8B, 0x90, 0x76, 0x83, 0xDF, 0x8B, 0x1C, 0x78, 0xD9, 0xB6, 0x8B, 0xF7, 0xDA,
+    0x33, 0xFB, 0x57, 0x02, 0x91, 0x32, 0xFA, 0xDF, 0x1A, 0x77, 0x57, 0x77, 0xBD, 0x7A, 0xAF, 0xEA,
+    0x8D, 0x88, 0x54, 0xB3, 0x48, 0xBB, 0x88, 0xF4, 0x9B, 0xC8, 0xA0, 0xA3, 0x74, 0x3A, 0x4B, 0xA5,
+    0x58, 0x70, 0x19, 0x8B, 0xAB, 0xD4, 0x1A, 0x2B, 0xBF, 0x89, 0xDF, 0xC7, 0x41, 0xA7, 0x0A, 0x9B,
+    0x0C, 0xFE, 0x40, 0xEE, 0x3F, 0x7E, 0x6D, 0x54, 0x67, 0xD5, 0x3C, 0x7C, 0xA7, 0x0F, 0xC4, 0xCE,
+    0x62, 0x16, 0x69, 0xB3, 0x74, 0xBB, 0x98, 0xE3, 0x6F, 0x93, 0x2E, 0x4B, 0x83, 0xDB, 0xF6, 0xDB,
+    0x91, 0x6A, 0xE4, 0x7B, 0x8D, 0x6C, 0x3E, 0x48, 0x1F, 0x45, 0x46, 0xAE, 0x3E, 0xD0, 0x47, 0xD8,
+    0x52, 0x45, 0x98, 0x51, 0xD5, 0x20, 0xEE, 0x99, 0x0C, 0xA9, 0x52, 0xE0, 0x5B, 0x9B, 0x15, 0x5B,
+    0xD9, 0xA4, 0x4E, 0xE3, 0xD6, 0x07, 0xA7, 0xE9, 0x62, 0xBF, 0xD6, 0x2F, 0xE2, 0xC5, 0x36, 0xAB,
+    0x99, 0xBF, 0x72, 0x6D, 0x32, 0xE1, 0x72, 0x31, 0xB1, 0x0F, 0xDB, 0xC5, 0xCC, 0xC3, 0x94, 0x2F,
+    0x26, 0xD8, 0x8F, 0xF1, 0x9C, 0x7D, 0xBB, 0x5C, 0xCC, 0x6B, 0x3D, 0x47, 0xD7, 0xEA, 0x53, 0x9D,
+    0xEC, 0x47, 0x7B, 0xBB, 0xC9, 0x10, 0x98, 0xCF, 0x24, 0x3E, 0xDB, 0x7D, 0x7C, 0x3F, 0x30, 0x2D,
+    0x12, 0x82, 0x00, 0x9D, 0x90, 0xE8, 0xF4, 0x88, 0x3B, 0x0D, 0xF0, 0xC9, 0x40, 0xD0, 0x8A, 0xEC,
+    0x9D, 0x22, 0xDC, 0xDE, 0x05, 0xA9, 0x37, 0x8F, 0xB3, 0x7F, 0xA2, 0x1E, 0xFF, 0x69, 0x42, 0x1D,
+    0xFD, 0x2C, 0xC3, 0xEC, 0xC6, 0x4A, 0x2B, 0xD4, 0xBA, 0xB4, 0xAB, 0xB8, 0xE7, 0xE7, 0xD8, 0xF0,
+    0xBE, 0x1E, 0x0F, 0xC1, 0x7F, 0x06, 0x1D, 0x26, 0xD9, 0x28, 0xF6, 0x27, 0x14, 0xA3, 0x9F, 0xAD,
+    0xD2, 0x6C, 0x2E, 0x48, 0xB7, 0x8A, 0xD5, 0x67, 0x48, 0x03, 0xB6, 0x1D, 0xC2, 0x3B, 0x96, 0x0E,
+    0x88, 0xC9, 0x2C, 0x35, 0xCE, 0x89, 0x8D, 0x7D, 0x6A, 0x73, 0xAD, 0x3F, 0xEA, 0x68, 0xC1, 0x30,
+    0xE2, 0x92, 0xF0, 0x0B, 0xD7, 0xC4, 0x4F, 0x66, 0x01, 0xD1, 0x3A, 0xEA, 0xD8, 0x2F, 0x7D, 0x6A,
+    0xB4, 0x42, 0x5C, 0x04, 0xFE, 0xDC, 0xF0, 0x1A, 0xAB, 0x6F, 0xC8, 0xAE, 0xF5, 0x15, 0xA0, 0x02,
+    0x09, 0x48, 0x5D, 0x45, 0x77, 0x1F, 0x8C, 0xCA, 0xBB, 0xE2, 0x22, 0x2B, 0xC4, 0x7E, 0xBF, 0x50,
+    0x44, 0x14, 0xDF, 0xF0, 0x88, 0xE1, 0x1B, 0x44, 0x04, 0x23, 0xA8, 0x1E, 0x5C, 0xDD, 0x96, 0x22,
+    0x79, 0x98, 0x05, 0x75, 0xFE, 0x7E, 0x26, 0xE6, 0x2C, 0x05, 0x50, 0xA5, 0x3B, 0xE2, 0xDE, 0x63,
+    0x22, 0x4B, 0xFD, 0x98, 0xA3, 0xE5, 0xEE, 0x50, 0xB2, 0x4D, 0x2E, 0x35, 0x1B, 0x72, 0x81, 0x6B,
+    0x7C, 0x0F, 0xB5, 0x02, 0x7A, 0x97, 0xCD, 0x0A, 0x61, 0x91, 0x44, 0x27, 0x45, 0x56, 0xB0, 0xD3,
+    0x2F, 0x43, 0x02, 0x06, 0x9D, 0xDA, 0x1D, 0xE1, 0x36, 0xA1, 0x70, 0x84, 0xBF, 0xD0, 0xB5, 0x06,
+    0x7D, 0x93, 0x21, 0x43, 0x96, 0x22, 0xB0, 0x7E, 0xBE, 0x46, 0xA4, 0x00, 0x49, 0x48, 0x43, 0xBD,
+    0x08, 0x97, 0x62, 0xE2, 0x22, 0x54, 0x7B, 0x7A, 0x0C, 0x10, 0x1B, 0x23, 0x59, 0x71, 0x28, 0x8B,
+    0x45, 0xC4, 0x6B, 0x64, 0xCF, 0xC8, 0xFD, 0xF4, 0xFD, 0x71, 0xBC, 0x70, 0x55, 0xB6, 0x8E, 0x9B,
+    0xE7, 0xFF, 0xB8, 0x99, 0x97, 0xBC, 0x7D, 0x33, 0x70, 0xFC, 0xF3, 0xE6, 0x37, 0xE9, 0xC6, 0x63,
+    0xF1, 0xD6, 0xF2, 0xE4, 0xC9, 0x1F, 0x39, 0x70, 0xF7, 0x7E, 0x8E, 0x9D, 0x8E, 0xF5, 0xE8, 0xD2,
+    0x4D, 0x85, 0xF5, 0x5E, 0x85, 0xD3, 0xC9, 0xAC, 0xAD, 0xAE, 0x76, 0x1E, 0xF4, 0x57, 0x1D, 0xBD,
+    0x42, 0x85, 0x36, 0x43, 0x85, 0x21, 0x42, 0x05, 0x28, 0x3E, 0x37, 0x19, 0x2A, 0xF8, 0x44, 0x72,
+    0x40, 0x29, 0x4A, 0x40, 0xFB, 0x82, 0xFB, 0x77, 0xE4, 0xD0, 0xCE, 0x8F, 0x08, 0xB6, 0x33, 0x79,
+    0x4D, 0x85, 0x6F, 0x20, 0x04, 0x26, 0x12, 0x5E, 0x76, 0xC2, 0x75, 0xE7, 0x74, 0x26, 0x01, 0x07,
+    0x03, 0xD8, 0xD1, 0x83, 0xAD, 0xE3, 0x0C, 0xB5, 0x6B, 0xAE, 0x67, 0x50, 0x97, 0xBB, 0xEE, 0xEC,
+    0x65, 0x67, 0xA4, 0x48, 0x73, 0x29, 0xD1, 0x29, 0x0A, 0x41, 0xDB, 0x6A, 0xA0, 0x37, 0xB0, 0x55,
+    0xB4, 0x10, 0x41, 0xB6, 0x80, 0x16, 0x81, 0xC8, 0x57, 0x58, 0xF1, 0x93, 0x40, 0x77, 0x1E, 0xEA,
+    0xD9, 0x36, 0x38, 0xCA, 0x76, 0x2E, 0xA7, 0xBD, 0x92, 0x28, 0x8C, 0x4E, 0x69, 0x33, 0x2D, 0xEE,
+    0x50, 0xD8, 0x04, 0x21, 0xEC, 0x4A, 0x5E, 0xEB, 0x42, 0x39, 0xD4, 0xDD, 0x07, 0xF1, 0x52, 0xB4,
+    0x0D, 0xE9, 0x67, 0x1A, 0xEA, 0x84, 0x20, 0x26, 0x66, 0x1E, 0xE0, 0x03, 0xB1, 0x1F, 0xFA, 0x15,
+    0xB7, 0x83, 0x24, 0x18, 0x12, 0x65, 0x3A, 0x18, 0x42, 0x8C, 0x41, 0x95, 0x63, 0x0B, 0x1E, 0xA7,
+    0x1A, 0xA3, 0x33, 0xB1, 0x15, 0x03, 0x76, 0xF0, 0x30, 0x49, 0x09, 0xD8, 0xCF, 0xD0, 0x91, 0x43,
+    0xA2, 0x3E, 0xB2, 0x3B, 0x16, 0xBA, 0x12, 0xB0, 0xB4, 0x34, 0x8A, 0x5A, 0x4B, 0xA5, 0x9F, 0xB0,
+    0xC8, 0x99, 0x1E, 0x96, 0x90, 0xB2, 0xC5, 0xE8, 0x51, 0x7B, 0x57, 0x78, 0xC6, 0x70, 0x87, 0xD2,
+    0x32, 0x04, 0x92, 0x0B, 0x34, 0x08, 0x41, 0xB0, 0x6F, 0x91, 0xB4, 0xFF, 0x1B, 0x49, 0xCB, 0x3D,
+    0x49, 0xA7, 0x1F, 0x30, 0x46, 0x4F, 0x30, 0x49, 0x50, 0x68, 0x14, 0x9B, 0xB1, 0x04, 0x6B, 0x01,
+    0xD0, 0x9D, 0xF6, 0xDC, 0xEA, 0xDC, 0xE1, 0x85, 0xFD, 0x04, 0x71, 0x14, 0x73, 0x1D, 0x9A, 0xD7,
+    0xAB, 0xEC, 0x18, 0x38, 0x3F, 0xF6, 0x4F, 0x67, 0xF3, 0x62, 0xA9, 0xB7, 0xAD, 0xCA, 0xB0, 0x92,
+    0x5F, 0x66, 0xFB, 0x6D, 0x6A, 0xF2, 0xDE, 0xBE, 0x84, 0xA6, 0xDF, 0xC4, 0x7D, 0x98, 0xE1, 0x8B,
+    0xFD, 0x93, 0x2C, 0xBE, 0xFB, 0x6D, 0xB5, 0xC1, 0x24, 0xEF, 0x00, 0x52, 0x5B, 0x8D, 0x6E, 0xEA,
+    0xA3, 0xCB, 0xDD, 0x52, 0x6D, 0x2D, 0xC7, 0x73, 0x08, 0x2E, 0x19, 0x9C, 0x6C, 0x77, 0xD8, 0x9B,
+    0x0D, 0x36, 0xD0, 0xAE, 0xED, 0x22, 0x1D, 0x06, 0x3A, 0xB2, 0x95, 0x08, 0x80, 0x3F, 0x1C, 0x2D,
+    0xBD, 0x05, 0x4E, 0xD8, 0x10, 0x8E, 0x98, 0xBB, 0x05, 0xF7, 0xB9, 0x2F, 0x63, 0x1F, 0xEB, 0xCD,
+    0x06, 0xB8, 0x55, 0xD2, 0x1A, 0x4D, 0xF3, 0xF3, 0x6E, 0x52, 0xB5, 0x37, 0x19, 0x07, 0x57, 0xF3,
+    0x92, 0xF1, 0xC3, 0x1F, 0x70, 0x31, 0x71, 0x77, 0x81, 0xF9, 0x15, 0xBF, 0x06, 0xD4, 0xCA, 0x8F,
+    0x40, 0x52, 0xC3, 0x35, 0x41, 0x64, 0x92, 0x21, 0x93, 0x1E, 0x97, 0x6E, 0xA3, 0xE4, 0xB7, 0xF2,
+    0x0B, 0x11, 0xD8, 0xB7, 0x80, 0xF1, 0x97, 0x5F, 0x1A, 0x9D, 0x7A, 0x40, 0xA4, 0xB5, 0x80, 0x96,
+    0x0D, 0x96, 0xD6, 0x6C, 0x68, 0x8D, 0x66, 0x2B, 0xEC, 0x42, 0x81, 0x36, 0xE3, 0xD1, 0x65, 0x48,
+    0x63, 0xCA, 0x03, 0xC3, 0x45, 0x0B, 0x8A, 0xB0, 0x26, 0xBB, 0x54, 0xB0, 0xEA, 0xFD, 0xF3, 0x32,
+    0x01, 0xFB, 0x61, 0xC7, 0x68, 0x6B, 0x36, 0xCB, 0xC3, 0xE2, 0x38, 0x8F, 0x0F, 0xA7, 0xBB, 0x5A,
+    0xF4, 0x46, 0x8B, 0x8E, 0x57, 0x8B, 0xEE, 0x13, 0xA7, 0xA5, 0xA6, 0x57, 0xC3, 0xAD, 0x69, 0xBD,
+    0xD8, 0xBC, 0xDA, 0x93, 0xF8, 0xE7, 0x0F, 0x0F, 0xEF, 0xE4, 0x9C, 0xB0, 0x9B, 0xD9, 0xBF, 0x18,
+    0x62, 0x29, 0x82, 0xB3, 0xA4, 0xFF, 0xFD, 0xF3, 0x37, 0x85, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14,
+    0xBD, 0xF6, 0x00, 0x2E, 0x5C, 0x0C, 0x05, 0x34, 0x34, 0xEE, 0x23, 0x24, 0xFF, 0x01, 0xE3, 0x84,
+    0x0F, 0x48, 0x9A, 0x4D, 0x93, 0x82, 0x4F, 0xD8, 0x3F, 0x88, 0x2D, 0xE5, 0x07, 0xE8, 0x29, 0x48,
+    0x41, 0x01, 0xDB, 0xF0, 0x07, 0xCC, 0x08, 0x8A, 0x14, 0x14, 0xB1, 0x84, 0x44, 0x8B, 0x85, 0x10,
+    0x91, 0xA0, 0xD8, 0x09, 0x78, 0x15, 0xEF, 0x6A, 0x3C, 0x97, 0x73, 0xC6, 0x6F, 0xB5, 0x41, 0x42,
+    0xE2, 0x3D, 0x8D, 0xB5, 0xE3, 0x37, 0x73, 0xEF, 0xB9, 0xE7, 0x9E, 0x7B, 0x56, 0x84, 0x9F, 0xCA,
+    0xEF, 0x22, 0x56, 0x35, 0x88, 0x53, 0x8D, 0xA2, 0x37, 0x7E, 0x35, 0x3A, 0x75, 0xA9, 0xC9, 0xD2,
+    0x26, 0x9B, 0xC4, 0xEC, 0xDD, 0x8A, 0x47, 0x1F, 0xF1, 0x70, 0xCB, 0xF1, 0x68, 0x92, 0x9B, 0xF1,
+    0xEB, 0x38, 0x8B, 0x2D, 0x8F, 0x0D, 0xDB, 0x3E, 0xE2, 0x87, 0x71, 0x71, 0x6B, 0xA5, 0xA1, 0xCB,
+    0xE7, 0x3A, 0x20, 0xE6, 0x2E, 0x46, 0x75, 0x15, 0x19, 0x11, 0x5D, 0xAA, 0x71, 0x41, 0xBA, 0x1E,
+    0x5B, 0xDC, 0xC2, 0x03, 0x09, 0x04, 0xBF, 0x0B, 0xF2, 0x7E, 0xCE, 0x73, 0x33, 0x8E, 0xE9, 0xD0,
+    0x66, 0x9F, 0x44, 0x27, 0x1F, 0xEC, 0x6A, 0x76, 0x51, 0x71, 0x73, 0x17, 0x9B, 0x54, 0xAB, 0x68,
+    0x70, 0x57, 0x84, 0x86, 0xA0, 0x00, 0x3A, 0x34, 0x44, 0xEC, 0x7F, 0xD8, 0x91, 0x1C, 0xD0, 0xF4,
+    0xBE, 0x4A, 0x17, 0xED, 0x56, 0xA9, 0xF8, 0xD0, 0x2F, 0x66, 0xC7, 0x5D, 0x17, 0xDD, 0x5C, 0xEB,
+    0x50, 0x8A, 0x7C, 0x4F, 0x7F, 0xC3, 0xAD, 0x2C, 0xAA, 0xA9, 0xD2, 0x3F, 0x12, 0xB2, 0xBE, 0x6F,
+    0x90, 0xBE, 0x2C, 0x20, 0xA8, 0x91, 0x5C, 0x74, 0x03, 0x94, 0x4C, 0x2E, 0x26, 0xBC, 0x00, 0x60,
+    0x8F, 0x97, 0xAE, 0xAC, 0x47, 0x32, 0xCE, 0x4F, 0x1F, 0x6B, 0x20, 0xC0, 0x11, 0x00, 0x3A, 0x45,
+    0x29, 0x1F, 0x10, 0xB9, 0xEE, 0x5C, 0x78, 0x9F, 0xB8, 0x04, 0x14, 0x1C, 0x57, 0x70, 0x7D, 0x64,
+    0x08, 0x2C, 0x84, 0x13, 0xC0, 0x00, 0xB4, 0xB2, 0x50, 0xCA, 0x91, 0x17, 0xB4, 0x37, 0xE0, 0xA1,
+    0xE5, 0x42, 0x6A, 0xCB, 0x45, 0x72, 0x74, 0x30, 0x3B, 0x0E, 0x96, 0xA2, 0xF1, 0x40, 0x1B, 0x36,
+    0xC3, 0x32, 0xF9, 0x58, 0x71, 0xA3, 0x8B, 0xB8, 0xD2, 0xA3, 0x58, 0x64, 0xC3, 0x05, 0x37, 0xDB,
+    0x88, 0x7C, 0x5D, 0x44, 0x42, 0x30, 0xE1, 0x03, 0x30, 0xE8, 0x04, 0x10, 0x3A, 0xB0, 0x7E, 0xD0,
+    0x00, 0xA2, 0xFB, 0x7C, 0x9E, 0xD8, 0xE4, 0x55, 0xC0, 0x1B, 0x30, 0x7A, 0x72, 0x5F, 0x81, 0x9B,
+    0x71, 0x92, 0xFE, 0x55, 0x62, 0x43, 0x83, 0xE8, 0x33, 0x06, 0x77, 0xC1, 0x64, 0x93, 0x10, 0xCC,
+    0x85, 0x76, 0xAB, 0xD9, 0x82, 0x7E, 0xEE, 0x97, 0x7A, 0xC7, 0xBB, 0x6E, 0xF6, 0x53, 0xB5, 0x23,
+    0x5D, 0xF7, 0x2B, 0xEE, 0x67, 0x5C, 0xB1, 0x7F, 0x02, 0x75, 0x56, 0x92, 0x46, 0x06, 0x13, 0xFF,
+    0x40, 0x54, 0x1F, 0x51, 0x13, 0xEA, 0x43, 0xF8, 0x0A, 0xF8, 0xAF, 0x33, 0xAB, 0x73, 0x2F, 0x36,
+    0xE8, 0xA3, 0xD6, 0x6E, 0x81, 0xBE, 0xEC, 0xEA, 0x26, 0x9B, 0x91, 0x05, 0x0D, 0x43, 0x65, 0x06,
+    0x2D, 0x59, 0x6C, 0xB4, 0xB1, 0xBF, 0x0C, 0x7E, 0x72, 0x21, 0x7B, 0xA4, 0xD3, 0xE6, 0xAF, 0x84,
+    0xC3, 0xC9, 0xFD, 0x18, 0xA1, 0xA6, 0xD7, 0x7B, 0xFF, 0x02, 0x04, 0xBF, 0x8C, 0xBE, 0x47, 0x6D,
+    0xEE, 0x41, 0x52, 0x31, 0x37, 0xA9, 0x79, 0xB3, 0x8A, 0xBD, 0x5C, 0xBA, 0x22, 0x5F, 0x19, 0x33,
+    0xDB, 0x58, 0x41, 0xC6, 0x46, 0x43, 0x03, 0xE2, 0x2D, 0x64, 0x01, 0x1C, 0x6E, 0x95, 0x31, 0x52,
+    0x7C, 0x91, 0x1D, 0x1A, 0x03, 0x7B, 0xAE, 0x03, 0xA4, 0x58, 0x6B, 0x85, 0x53, 0x0D, 0x75, 0x0E,
+    0x72, 0xD9, 0xAD, 0xFE, 0x55, 0xC1, 0xCD, 0x72, 0x44, 0xC9, 0x52, 0xAD, 0xBC, 0x59, 0xCA, 0x3A,
+    0x68, 0x6B, 0x58, 0xA6, 0xB8, 0xCB, 0x95, 0xDA, 0x41, 0x44, 0x44, 0x45, 0xAB, 0x11, 0x87, 0xF9,
+    0x52, 0x09, 0x1D, 0xD0, 0xA6, 0x96, 0x3D, 0x43, 0xC1, 0x68, 0x80, 0x14, 0x72, 0x77, 0x1C, 0x84,
+    0x34, 0x73, 0x45, 0x2D, 0xDB, 0x88, 0x86, 0xE9, 0xA7, 0xBB, 0xB4, 0xCC, 0x3A, 0x7E, 0x49, 0xC4,
+    0x04, 0x5A, 0xB4, 0x87, 0x98, 0x44, 0x5D, 0x94, 0x03, 0xB6, 0x8B, 0x6C, 0x88, 0x5D, 0x6A, 0xE6,
+    0xA7, 0xBE, 0x0C, 0x21, 0x50, 0x60, 0x54, 0x0E, 0xE1, 0x6A, 0xAC, 0x15, 0x13, 0xD1, 0x2A, 0x30,
+    0xF7, 0x9C, 0x63, 0xC4, 0x03, 0xE2, 0x7E, 0xE3, 0xED, 0x70, 0x9A, 0x38, 0x16, 0x75, 0xB4, 0x65,
+    0x39, 0x74, 0x4F, 0x6C, 0x52, 0xFF, 0xC7, 0xC1, 0x9B, 0x8B, 0xE7, 0x10, 0x8A, 0x4E, 0x3D, 0xC7,
+    0x4D, 0x4B, 0x3C, 0xCB, 0x99, 0x9B, 0x09, 0x8E, 0x23, 0x8B, 0x52, 0x67, 0x69, 0xA2, 0xD4, 0x38,
+    0x7E, 0xEC, 0x3B, 0x38, 0xC2, 0xB1, 0xCF, 0x6F, 0xED, 0xCD, 0x69, 0x3F, 0x48, 0x17, 0xCA, 0x7E,
+    0x7F, 0xC4, 0x41, 0x1B, 0x77, 0xF9, 0xE8, 0x82, 0x37, 0xBD, 0x8C, 0x32, 0x0E, 0x6E, 0x70, 0x68,
+    0x7A, 0x8F, 0x6F, 0x17, 0xEC, 0x6C, 0x17, 0x7C, 0x63, 0x1B, 0x9B, 0xD8, 0xAC, 0x66, 0xC3, 0x37,
+    0x31, 0x2A, 0xCA, 0x02, 0x06, 0xB4, 0x0E, 0xF6, 0xB3, 0x4A, 0x85, 0x32, 0x7C, 0x99, 0x33, 0x7B,
+    0xEC, 0xD3, 0xBF, 0xF7, 0x77, 0xB8, 0x88, 0xF3, 0xAD, 0x7D, 0x75, 0x5E, 0x6A, 0x80, 0xC9, 0xDC,
+    0xFB, 0x86, 0xD4, 0x7D, 0x22, 0xE5, 0x22, 0x29, 0x26, 0x63, 0x2D, 0x9B, 0xF8, 0x12, 0x62, 0x7A,
+    0x38, 0x8B, 0x6F, 0x17, 0x49, 0x26, 0x02, 0x00, 0xA0, 0xD4, 0xAB, 0x9D, 0xAB, 0x0D, 0xF1, 0xD2,
+    0x3D, 0x91, 0xAF, 0x3F, 0x3C, 0x3B, 0xEB, 0x54, 0x7F, 0xBE, 0xB8, 0x78, 0x7E, 0x76, 0x5F, 0x21,
+    0x5F, 0x1C, 0xA9, 0x0E, 0xA7, 0x71, 0xF1, 0xBB, 0x4A, 0x53, 0x06, 0x7B, 0xBB, 0xC5, 0xD0, 0x75,
+    0x9B, 0x4D, 0x2E, 0xB6, 0x30, 0xC8, 0x76, 0x1B, 0x03, 0x25, 0x66, 0xA3, 0xC7, 0xB0, 0x72, 0x4C,
+    0x7D, 0x18, 0x67, 0xFF, 0x7B, 0x71, 0x95, 0xD0, 0xAB, 0x0F, 0xED, 0x8E, 0xF0, 0x47, 0x94, 0xC3,
+    0x0A, 0x48, 0x5E, 0xE9, 0xBD, 0x87, 0x10, 0x68, 0x2D, 0xC7, 0x4B, 0x1F, 0xAA, 0x0C, 0x0D, 0x7A,
+    0xF4, 0xC7, 0x5D, 0x8F, 0x30, 0x82, 0x26, 0x35, 0xB0, 0xB5, 0x8A, 0xE3, 0xE4, 0x07, 0x4E, 0x30,
+    0x8C, 0x3B, 0x9A, 0xCC, 0x97, 0xC5, 0x38, 0xFD, 0x95, 0xCE, 0xB0, 0xA9, 0xC5, 0xFE, 0xA2, 0x4B,
+    0x13, 0xA9, 0x82, 0xEA, 0x48, 0x52, 0x73, 0x58, 0x60, 0xAC, 0xBA, 0xD9, 0xFC, 0xE4, 0x01, 0xCA,
+    0xA7, 0xB7, 0xEF, 0x45, 0x59, 0xB4, 0x25, 0xA4, 0xA5, 0xBE, 0x20, 0xD0, 0x46, 0x1F, 0xE3, 0x54,
+    0xE2, 0x61, 0x03, 0x13, 0xA9, 0x6E, 0x51, 0x16, 0x07, 0xBB, 0x13, 0x22, 0x95, 0x74, 0x12, 0xAC,
+    0xC1, 0x9C, 0x57, 0x9A, 0x33, 0xB5, 0x39, 0x93, 0x89, 0x4A, 0x07, 0x64, 0x8A, 0xC5, 0xCC, 0xFC,
+    0x40, 0x2E, 0x90, 0x02, 0x02, 0x98, 0xE0, 0x67, 0x1B, 0x84, 0x4D, 0x36, 0xDA, 0xDC, 0x25, 0x9A,
+    0x6A, 0xA8, 0x35, 0x63, 0x82, 0x32, 0xF8, 0x78, 0xE7, 0x36, 0x13, 0x24, 0x63, 0x0F, 0x07, 0xB7,
+    0xBB, 0x5D, 0xE1, 0x75, 0x3F, 0x61, 0xF3, 0x70, 0x3D, 0xA7, 0xF1, 0x7E, 0xAF, 0xBA, 0xB5, 0xF9,
+    0x2B, 0xE9, 0x97, 0x82, 0x16, 0xB3, 0xF8, 0x31, 0xFE, 0x51, 0x44, 0x53, 0x22, 0x5D, 0x17, 0xAB,
+    0xC6, 0xE7, 0x5D, 0xAC, 0xB6, 0x18, 0x7B, 0xE6, 0x14, 0xAF, 0x9C, 0xA9, 0xE1, 0x00, 0x7D, 0x94,
+    0x81, 0xDF, 0xE0, 0x91, 0xFC, 0x03, 0xC5, 0x7C, 0x76, 0x35, 0x1C, 0x95, 0xD1, 0xB0, 0x8B, 0x3B,
+    0x97, 0xC9, 0xA3, 0x8A, 0x8E, 0xE3, 0x4C, 0x56, 0x46, 0x94, 0x4E, 0x0E, 0xE3, 0x3C, 0x11, 0x51,
+    0x66, 0xB4, 0x18, 0xB9, 0x3B, 0x5D, 0xAE, 0xBF, 0xA5, 0xB5, 0x33, 0xB1, 0xBB, 0x9D, 0xEA, 0x13,
+    0x79, 0xDA, 0x2E, 0x8D, 0xFE, 0xBD, 0x51, 0x2C, 0x46, 0xBF, 0xD0, 0x42, 0x11, 0xB4, 0xB0, 0x50,
+    0x2D, 0x5D, 0x34, 0x3B, 0x19, 0x42, 0x04, 0xB4, 0x15, 0x72, 0x81, 0x7B, 0xAC, 0x6D, 0x21, 0x12,
+    0x18, 0x1D, 0xF4, 0x52, 0x6B, 0xBF, 0xDC, 0x09, 0x05, 0xF3, 0xFC, 0xF4, 0x89, 0x0E, 0x90, 0xE5,
+    0x84, 0x78, 0x93, 0x9C, 0x67, 0xF9, 0x9F, 0xCF, 0x3F, 0x85, 0x55, 0x3F, 0x8F, 0xDD, 0x44, 0x10,
+    0x1F, 0xDB, 0xE4, 0x2C, 0xC5, 0xC5, 0xD2, 0xD0, 0x90, 0x62, 0xFB, 0x20, 0xC5, 0x1F, 0x61, 0x8D,
+    0xF2, 0x05, 0xAE, 0x08, 0x15, 0x05, 0x35, 0xD5, 0x7D, 0x84, 0x75, 0x47, 0x4B, 0x03, 0x6D, 0x52,
+    0xA4, 0x22, 0xDF, 0x21, 0xBB, 0xE4, 0xCA, 0x14, 0x98, 0x0B, 0x12, 0x05, 0xC5, 0x39, 0xCA, 0xA1,
+    0x48, 0xA1, 0xB8, 0x15, 0xD9, 0xCB, 0x99, 0xDC, 0xAE, 0x27, 0xBF, 0x59, 0xBF, 0x97, 0xA0, 0x53,
+    0x04, 0xBE, 0xF7, 0xAC, 0x77, 0x33, 0xB3, 0xF3, 0xE7, 0x37, 0xBF, 0x99, 0x25, 0xC2, 0xA3, 0x22,
+    0x51, 0x93, 0x88, 0x2A, 0xC6, 0x3F, 0x6E, 0x24, 0x32, 0xF3, 0x5E, 0xE8, 0xA6, 0x6A, 0xE5, 0x4C,
+    0x8E, 0xD9, 0x9B, 0x6C, 0x83, 0x4A, 0x6D, 0x6A, 0x57, 0x62, 0x58, 0x5A, 0xEF, 0xC6, 0x7E, 0x36,
+    0x93, 0x8A, 0x2A, 0x34, 0xB9, 0x4D, 0xC4, 0xF5, 0x35, 0x21, 0x6C, 0x8B, 0x47, 0xAA, 0x13, 0xD9,
+    0x09, 0x16, 0x66, 0xA4, 0x12, 0x2E, 0x40, 0xDC, 0x87, 0x66, 0x25, 0x23, 0x52, 0xEB, 0xBB, 0x85,
+    0x78, 0x50, 0xB1, 0x48, 0x6B, 0x91, 0x36, 0x22, 0x2D, 0xB6, 0x72, 0x16, 0x02, 0x6A, 0x33, 0xED,
+    0x8F, 0x17, 0x0F, 0x25, 0xD7, 0x3E, 0x10, 0x9C, 0x88, 0x5A, 0xB2, 0xC7, 0x09, 0x38, 0x22, 0x1E,
+    0x25, 0x75, 0x51, 0xEB, 0x40, 0xF5, 0x4E, 0x9D, 0x37, 0x75, 0x2A, 0x6A, 0x1D, 0xE9, 0x11, 0x53,
+    0xC7, 0x33, 0xB9, 0x85, 0xBA, 0xBC, 0xF3, 0x29, 0x36, 0x64, 0x10, 0x15, 0x29, 0x6D, 0x28, 0x28,
+    0x78, 0x43, 0x62, 0x12, 0xAE, 0x5D, 0x2B, 0xD4, 0x8C, 0xD2, 0xEC, 0xDC, 0x64, 0xC8, 0xCD, 0xF1,
+    0x0A, 0x3B, 0xF8, 0xB2, 0xF0, 0xD2, 0xB1, 0xF8, 0xE5, 0x89, 0x14, 0x33, 0x02, 0xDF, 0x8F, 0x48,
+    0x8C, 0x7D, 0xBD, 0x22, 0x67, 0x33, 0x19, 0xE0, 0x50, 0xF1, 0x60, 0x7D, 0xF1, 0x26, 0x51, 0x8C,
+    0x47, 0x04, 0x27, 0xFF, 0xA3, 0xE8, 0x02, 0xC5, 0xFC, 0x71, 0x28, 0x9A, 0x6B, 0x50, 0x20, 0xBD,
+    0x2E, 0xD7, 0x3C, 0xE8, 0xA7, 0x7C, 0xCC, 0xA1, 0xBB, 0xE2, 0xB7, 0xBC, 0x36, 0xFC, 0x3B, 0x5F,
+    0xB0, 0x67, 0x6F, 0x83, 0x0E, 0x66, 0xD6, 0xB1, 0x4D, 0x3A, 0x74, 0xA9, 0x5E, 0xBB, 0x05, 0xB5,
+    0xF3, 0xDD, 0x0C, 0x77, 0x66, 0x62, 0x04, 0x55, 0xC1, 0x7A, 0x1D, 0xDA, 0xD4, 0x07, 0x51, 0x75,
+    0x0B, 0x32, 0xD9, 0xA9, 0xBD, 0xA8, 0xF5, 0x4E, 0xFD, 0x3E, 0x10, 0x21, 0xCC, 0x84, 0x20, 0x49,
+    0x42, 0x10, 0x02, 0x78, 0x33, 0xAB, 0x20, 0x26, 0x72, 0x5E, 0x4E, 0x0F, 0x38, 0x37, 0xA1, 0xB0,
+    0xD0, 0x5F, 0x13, 0x7A, 0x71, 0xB5, 0x39, 0x02, 0xC2, 0x9A, 0x01, 0x00, 0x27, 0x95, 0x8F, 0xA2,
+    0x9B, 0xCC, 0x8B, 0x95, 0xDC, 0x69, 0xA8, 0x19, 0xA5, 0xBE, 0x45, 0x7D, 0x7F, 0xA1, 0xDE, 0xA3,
+    0xB9, 0x4D, 0xCE, 0x9B, 0xE7, 0xFC, 0x1D, 0x37, 0xCC, 0x0B, 0xBE, 0x63, 0xCD, 0x67, 0x44, 0x9F,
+    0xEE, 0x3B, 0x13, 0x9C, 0x27, 0x6B, 0xA4, 0x65, 0x0C, 0xF3, 0x3F, 0x19, 0xD8, 0x15, 0x6A, 0x21,
+    0x0C, 0x8E, 0xD6, 0x19, 0x3F, 0x8C, 0xEF, 0x12, 0xA0, 0xE2, 0x51, 0x42, 0xE3, 0x27, 0x93, 0xBB,
+    0xE0, 0x49, 0x95, 0x03, 0x6E, 0x25, 0xFD, 0x37, 0x0F, 0xF5, 0x5A, 0x15, 0x32, 0x7C, 0xAC, 0xD3,
+    0xF1, 0x3D, 0xC2, 0xE1, 0x71, 0xC5, 0x19, 0xB0, 0x72, 0x56, 0xEB, 0x51, 0xD2, 0x51, 0x25, 0x03,
+    0xC0, 0xCC, 0xD4, 0x45, 0x54, 0x1A, 0xD1, 0xB6, 0xE0, 0x46, 0x1D, 0x84, 0xE5, 0xCE, 0xDB, 0xC9,
+    0x3D, 0xC7, 0x5C, 0x60, 0x36, 0x7A, 0x76, 0x48, 0x00, 0xAE, 0x06, 0xE1, 0x0B, 0x6F, 0xA3, 0x24,
+    0xE4, 0x93, 0x58, 0xE5, 0xBB, 0x01, 0xAB, 0x4E, 0x72, 0x95, 0x9D, 0xEF, 0xCF, 0x93, 0x54, 0x69,
+    0x16, 0x6A, 0xF9, 0x03, 0x33, 0x87, 0x3D, 0x71, 0xFB, 0x0F, 0xC4, 0xDD, 0x78, 0x5D, 0x9E, 0x8E,
+    0xCF, 0x70, 0xC8, 0x3B, 0x5E, 0x50, 0x7E, 0xB1, 0xCE, 0x05, 0xDF, 0x86, 0x23, 0x74, 0x9E, 0xB4,
+    0x1C, 0xC1, 0x49, 0xBE, 0x39, 0xD8, 0xD9, 0x71, 0x02, 0x5A, 0x83, 0x05, 0x2B, 0x6F, 0xE0, 0x2C,
+    0xBE, 0x06, 0xC6, 0x44, 0x2B, 0x4C, 0xB3, 0xE5, 0x84, 0xCF, 0xAD, 0x7C, 0x0F, 0x1C, 0x44, 0x48,
+    0x4C, 0x13, 0xDA, 0xD5, 0xCF, 0x12, 0x50, 0x3E, 0x00, 0xFB, 0xD7, 0xC1, 0x20, 0x3D, 0x1E, 0x15,
+    0xC2, 0x1C, 0x52, 0x19, 0xEE, 0x15, 0x89, 0xF0, 0xB5, 0xE1, 0x86, 0xD0, 0x79, 0x30, 0x68, 0x06,
+    0xBD, 0x20, 0xC4, 0x6E, 0x40, 0x5D, 0x65, 0x52, 0xEC, 0x89, 0xA0, 0x7F, 0x15, 0x1B, 0xBE, 0xC0,
+    0xDC, 0x47, 0x4B, 0x04, 0x5C, 0xC8, 0x8E, 0x4D, 0x46, 0xE3, 0x93, 0x40, 0x69, 0x7C, 0x1F, 0x8C,
+    0x97, 0x3F, 0x37, 0x0A, 0x05, 0xFB, 0x27, 0x2B, 0xF5, 0xCF, 0x12, 0xE9, 0x3F, 0x40, 0x99, 0xD3,
+    0x80, 0x61, 0x92, 0x81, 0xF2, 0x24, 0x29, 0x28, 0x80, 0xD2, 0x95, 0x0D, 0xD0, 0xC7, 0x26, 0xE1,
+    0x4C, 0xEC, 0xF0, 0xB6, 0x51, 0xBC, 0x70, 0x04, 0xF1, 0x7F, 0xE6, 0x88, 0x51, 0x7B, 0x72, 0x85,
+    0x26, 0x99, 0xE3, 0xD7, 0xD1, 0x0D, 0xE6, 0xE9, 0xEB, 0x08, 0x26, 0xFE, 0xF2, 0xEC, 0x0D, 0x06,
+    0xEE, 0xF4, 0xF8, 0x32, 0x51, 0x7F, 0x7E, 0xF7, 0x72, 0xA1, 0x1E, 0x14, 0x43, 0xAD, 0x68, 0xF0,
+    0x4C, 0x3D, 0x92, 0xF5, 0xE5, 0x3D, 0x12, 0xFC, 0x96, 0xE5, 0xE7, 0xB5, 0x0C, 0x20, 0xFB, 0x66,
+    0x55, 0x09, 0x75, 0x03, 0x7B, 0x75, 0x89, 0xC0, 0x3D, 0xCC, 0xC9, 0xAC, 0xB2, 0x0F, 0x40, 0xEC,
+    0x96, 0x65, 0x47, 0xC2, 0xBE, 0x61, 0xD1, 0xC1, 0x79, 0xCD, 0xC0, 0x51, 0x47, 0xEC, 0x4D, 0x61,
+    0xA0, 0x12, 0x22, 0x96, 0x62, 0x65, 0xA2, 0x93, 0x0C, 0x5F, 0x24, 0xA9, 0x17, 0xAF, 0x02, 0x30,
+    0xF8, 0xDC, 0x4F, 0xB2, 0xA1, 0x4E, 0xE0, 0x52, 0xBF, 0x40, 0x93, 0xD5, 0x4B, 0xAC, 0x07, 0x75,
+    0x0E, 0xE7, 0x4A, 0x42, 0x49, 0x3F, 0xF1, 0x1A, 0xA9, 0x10, 0xA4, 0x6C, 0xBF, 0x8D, 0xAD, 0x85,
+    0xA9, 0xE8, 0x32, 0xDD, 0x16, 0x0B, 0x23, 0x6C, 0x33, 0x85, 0xCE, 0xB3, 0x50, 0x84, 0x65, 0x5A,
+    0x79, 0xD6, 0xE8, 0xFC, 0x67, 0xDF, 0x24, 0x29, 0xA7, 0xC0, 0x66, 0xA7, 0x6D, 0x4F, 0x62, 0x5D,
+    0x6E, 0xEC, 0xC2, 0x42, 0x22, 0xFD, 0xCF, 0x57, 0xB0, 0xCF, 0xB0, 0x0F, 0xB0, 0x87, 0xB3, 0x2F,
+    0x40, 0xA1, 0x44, 0x02, 0x86, 0x3D, 0xA3, 0x2E, 0x14, 0x1A, 0xAB, 0x99, 0x2A, 0x29, 0xD1, 0x17,
+    0x26, 0xBA, 0xB1, 0x12, 0xF0, 0x22, 0x8C, 0x06, 0xBA, 0x05, 0x41, 0x3F, 0x15, 0xB5, 0xF6, 0xDB,
+    0x9A, 0x86, 0xD5, 0x22, 0x4D, 0x2E, 0x61, 0x4C, 0x2C, 0x61, 0xAA, 0x07, 0x44, 0x8F, 0xFF, 0xE3,
+    0xF9, 0x96, 0xEE, 0x0C, 0xB2, 0x69, 0xC5, 0xA5, 0x9B, 0xA9, 0x5D, 0x8A, 0x47, 0x57, 0x62, 0x22,
+    0xBA, 0x38, 0x94, 0x9C, 0x17, 0x40, 0x8C, 0x8F, 0x47, 0xDF, 0x64, 0x42, 0x5C, 0x89, 0x06, 0x7D,
+    0x1B, 0x4B, 0x68, 0xA6, 0x03, 0x46, 0x72, 0x5E, 0x4A, 0xFD, 0x1C, 0x98, 0x1C, 0x3C, 0xA4, 0x4F,
+    0x78, 0x1D, 0x5E, 0x32, 0xF3, 0xFD, 0xAF, 0x79, 0x3D, 0xAC, 0xDC, 0xB4, 0xCD, 0x90, 0x97, 0xA5,
+    0x8A, 0xFB, 0x8A, 0xF4, 0x76, 0x99, 0x1C, 0x3C, 0x80, 0x2F, 0xF8, 0xC1, 0x8A, 0x90, 0x55, 0xBB,
+    0xED, 0xE6, 0xB1, 0xEC, 0x66, 0x8D, 0x2D, 0x05, 0xDB, 0xEA, 0xDE, 0xEE, 0xCE, 0x19, 0xA9, 0x42,
+    0x49, 0xEE, 0x0C, 0x97, 0xE1, 0x64, 0x64, 0xBC, 0x1E, 0x7D, 0x29, 0xC4, 0x09, 0xFF, 0xBE, 0x5D,
+    0xB0, 0x01, 0xE4, 0x0E, 0x02, 0xEE, 0xB8, 0x31, 0xB0, 0x19, 0x52, 0x0D, 0x68, 0x5B, 0x2C, 0x21,
+    0xF5, 0x1B, 0x11, 0x14, 0x1A, 0xB9, 0x1D, 0xEE, 0x77, 0x0D, 0x68, 0x38, 0xA0, 0xBF, 0x28, 0x1C,
+    0x86, 0x28, 0xEE, 0xC7, 0x79, 0xBB, 0x72, 0x64, 0xE0, 0x6B, 0x69, 0xBB, 0xB8, 0x2A, 0x1B, 0xCB,
+    0x88, 0x11, 0x9A, 0x25, 0xD6, 0x81, 0x6E, 0xF0, 0x0F, 0xBB, 0x25, 0xA6, 0xC2, 0x6E, 0x81, 0x89,
+    0x65, 0xC5, 0xAF, 0x7E, 0xFA, 0x1E, 0x43, 0x2F, 0x83, 0x0B, 0x53, 0x16, 0xD3, 0xFF, 0x7D, 0xDE,
+    0x01, 0xBD, 0x55, 0x3F, 0x6F, 0x1F, 0x45, 0x10, 0x9D, 0xBD, 0x25, 0x3E, 0xC1, 0x4A, 0x5C, 0x8A,
+    0x50, 0x90, 0x22, 0xD7, 0x50, 0x20, 0x9A, 0xFD, 0x02, 0x3F, 0xB3, 0x67, 0x52, 0x50, 0x50, 0xD8,
+    0x85, 0x5D, 0xA5, 0x48, 0x4D, 0xE5, 0x4F, 0x60, 0xEF, 0x1A, 0x8B, 0xDA, 0x15, 0xA2, 0xA0, 0xA1,
+    0xA0, 0x40, 0x4E, 0xE1, 0x26, 0x05, 0x48, 0xB1, 0x6F, 0x13, 0x4A, 0x8A, 0xAC, 0x70, 0x91, 0x82,
+    0x22, 0x47, 0x22, 0x01, 0x4A, 0x0A, 0x56, 0xE1, 0x22, 0xAF, 0xE3, 0xBB, 0x1B, 0xDE, 0x9E, 0x31,
+    0x7F, 0xA5, 0x88, 0x8A, 0xF5, 0x6F, 0xF7, 0x7C, 0x77, 0xBB, 0x33, 0x6F, 0xDE, 0xBC, 0x99, 0x7B,
+    0x95, 0x8A, 0xE6, 0xB0, 0xDD, 0xDC, 0x65, 0x9E, 0x24, 0x73, 0x57, 0x75, 0xD6, 0x19, 0x32, 0x22,
+    0xD1, 0x20, 0xA3, 0x8C, 0x55, 0xD0, 0x4E, 0x9F, 0x8D, 0x05, 0xF3, 0x58, 0x31, 0xA7, 0xD7, 0x2F,
+    0x49, 0x4F, 0x18, 0x55, 0x24, 0xEB, 0xB9, 0xA9, 0x7A, 0xD5, 0x17, 0x4C, 0x38, 0xE1, 0xE5, 0x50,
+    0xF5, 0x64, 0xEE, 0x32, 0x15, 0xA3, 0xF1, 0x54, 0x7F, 0xDF, 0x13, 0xF1, 0x84, 0x8D, 0x8C, 0xFD,
+    0x6D, 0x22, 0xC1, 0x3C, 0x90, 0x66, 0x76, 0xE2, 0xC6, 0xB8, 0x46, 0x38, 0x41, 0xC5, 0xC1, 0xF4,
+    0x39, 0x59, 0x66, 0x52, 0xF0, 0x8A, 0xF7, 0xB0, 0xAA, 0x3B, 0xC2, 0xF1, 0x6C, 0xFF, 0xE8, 0xCF,
+    0xF1, 0x21, 0xFD, 0xFB, 0xC1, 0x15, 0xEC, 0x65, 0x57, 0x32, 0x37, 0xE6, 0xC7, 0x41, 0x4C, 0x74,
+    0xB9, 0x4C, 0x70, 0x85, 0x59, 0xC3, 0x65, 0xCB, 0x54, 0x9D, 0x00, 0x94, 0x1C, 0x64, 0x2A, 0x63,
+    0x15, 0x6B, 0xAF, 0xBB, 0x89, 0x0C, 0x47, 0x4C, 0xEC, 0x18, 0x88, 0x54, 0xDE, 0x1D, 0xDF, 0x02,
+    0x8A, 0xA3, 0x5B, 0x39, 0xB4, 0xB0, 0xC4, 0xA7, 0xB3, 0xD1, 0xFA, 0xBD, 0x8E, 0xF5, 0x71, 0x6A,
+    0x95, 0xEF, 0xE9, 0x7C, 0xC0, 0x0D, 0x96, 0x09, 0x6B, 0x15, 0xC8, 0x36, 0x12, 0x08, 0x0F, 0xE9,
+    0xAB, 0x25, 0xFE, 0x28, 0xD6, 0x82, 0x07, 0xB5, 0x1B, 0xB6, 0x45, 0xB3, 0x58, 0x54, 0x9E, 0x8A,
+    0x07, 0x0E, 0x67, 0xAE, 0xDD, 0xAE, 0x89, 0xC4, 0xD9, 0x4A, 0x84, 0x83, 0xF9, 0xDF, 0x93, 0xF9,
+    0xE9, 0xA2, 0x42, 0xBC, 0xC7, 0x7E, 0x8B, 0x68, 0xA1, 0x25, 0x8E, 0xF9, 0x5E, 0xF1, 0x4E, 0x2C,
+    0x3B, 0x41, 0x5B, 0x54, 0x07, 0xD2, 0x8E, 0xCC, 0x93, 0x36, 0x10, 0x6D, 0x32, 0x16, 0xBA, 0x74,
+    0xEE, 0x5A, 0x3D, 0x0E, 0xCC, 0xD5, 0xA3, 0xC1, 0xCA, 0x67, 0x7D, 0xB5, 0x17, 0xB6, 0x4C, 0x11,
+    0xC7, 0xFA, 0x1E, 0xB2, 0x34, 0xF6, 0xD4, 0x10, 0x5D, 0xC6, 0xB2, 0x25, 0x7A, 0xE2, 0xF7, 0x47,
+    0x39, 0x55, 0xA9, 0x1A, 0x4C, 0x34, 0x91, 0x7D, 0x7B, 0x8F, 0x89, 0x77, 0x27, 0xB2, 0x48, 0x85,
+    0x09, 0xDC, 0xE8, 0xD8, 0xFA, 0x2A, 0x1A, 0xAF, 0x3A, 0xED, 0x04, 0xBD, 0x92, 0x19, 0x3F, 0x65,
+    0xE6, 0x9F, 0x30, 0x3F, 0xDE, 0xD8, 0x38, 0x02, 0x44, 0x90, 0x51, 0x22, 0xAC, 0x1A, 0x81, 0x6E,
+    0xC3, 0xED, 0xFA, 0x3B, 0xFB, 0xAB, 0xFC, 0x98, 0x9F, 0x23, 0x5F, 0x2F, 0xA3, 0xC0, 0x8C, 0x45,
+    0xAC, 0x25, 0x27, 0x50, 0xB0, 0xAC, 0xC2, 0x62, 0x21, 0xC3, 0x32, 0x28, 0x58, 0x96, 0xE1, 0xDA,
+    0x6D, 0x19, 0xEE, 0x88, 0xB3, 0xC6, 0x40, 0x1E, 0xB7, 0x25, 0x07, 0x50, 0xB0, 0xAC, 0x41, 0x81,
+    0x0C, 0x09, 0x14, 0x2C, 0x97, 0x1E, 0x14, 0x84, 0x77, 0x41, 0xC1, 0xB2, 0x78, 0x1E, 0xB3, 0xE3,
+    0x97, 0x50, 0x80, 0x5C, 0xF2, 0x3D, 0x20, 0xCD, 0xD2, 0xC3, 0x5D, 0x9D, 0x0A, 0x1E, 0xEA, 0xA7,
+    0xE9, 0x50, 0xFE, 0x1A, 0xD5, 0x7D, 0xAF, 0xF5, 0xCE, 0x60, 0x38, 0xD8, 0x89, 0xAE, 0x02, 0xE1,
+    0x25, 0x70, 0x62, 0xB0, 0x09, 0xB0, 0x65, 0xA6, 0xDF, 0xE7, 0xDB, 0xA5, 0x7D, 0xDE, 0xBF, 0x09,
+    0x65, 0x23, 0xEA, 0xB4, 0x61, 0x3F, 0x59, 0xFB, 0xFB, 0xDB, 0x79, 0x33, 0xC6, 0x5F, 0x38, 0x71,
+    0xB4, 0x19, 0x10, 0x15, 0x92, 0x24, 0x76, 0xC6, 0xFC, 0x5E, 0x0E, 0x59, 0xEC, 0xC6, 0x43, 0x65,
+    0xAA, 0x07, 0x17, 0x3D, 0x84, 0x84, 0x9F, 0x68, 0x9D, 0x61, 0x7F, 0xC4, 0x4D, 0x33, 0xC2, 0xE0,
+    0x52, 0xDB, 0x98, 0x48, 0x07, 0x31, 0x33, 0x64, 0x56, 0x3F, 0x05, 0xAA, 0xCE, 0x9E, 0xCE, 0xA6,
+    0x37, 0x88, 0x1D, 0xBB, 0xD6, 0xD9, 0x26, 0x87, 0x64, 0x90, 0x0A, 0x28, 0xDD, 0x7A, 0x95, 0x44,
+    0x4E, 0x0F, 0x84, 0x08, 0x09, 0x87, 0x72, 0x20, 0xA6, 0x3A, 0xE2, 0xD2, 0x3A, 0xDD, 0xC9, 0x11,
+    0x67, 0xAA, 0x88, 0x8B, 0xF5, 0x3A, 0xA2, 0xBC, 0xD8, 0xAB, 0xA9, 0xCE, 0x0A, 0x66, 0x64, 0x9B,
+    0x1F, 0xFA, 0x92, 0x07, 0x33, 0xD7, 0x0A, 0x0E, 0x23, 0x9C, 0xF1, 0xBC, 0x1E, 0x11, 0x06, 0x82,
+    0x2A, 0xA6, 0x7C, 0x77, 0xA1, 0x5E, 0x82, 0xB8, 0x07, 0x90, 0x07, 0x40, 0xD3, 0x1D, 0xCB, 0xFD,
+    0xA2, 0xC5, 0xE4, 0x7F, 0xCC, 0xFC, 0x2C, 0xBF, 0x33, 0x98, 0x35, 0x66, 0x89, 0x49, 0x57, 0x30,
+    0xE9, 0xBF, 0xCE, 0x2F, 0xDE, 0x16, 0x8D, 0xFD, 0x86, 0x21, 0xC1, 0x70, 0x85, 0x94, 0xB7, 0x0E,
+    0x85, 0xF5, 0xD9, 0x19, 0xDF, 0x47, 0xCE, 0x5E, 0x73, 0xE5, 0x20, 0x91, 0xC3, 0x64, 0x78, 0xE5,
+    0x38, 0x52, 0x4B, 0x2A, 0xD2, 0x04, 0x9A, 0x04, 0xBA, 0x81, 0x2F, 0x52, 0xC6, 0xCB, 0x83, 0x7E,
+    0x78, 0x1C, 0xB7, 0xB7, 0xCB, 0xA7, 0xE1, 0xF0, 0xB0, 0x7A, 0xF0, 0x03, 0xC0, 0xAE, 0x40, 0x36,
+    0x08, 0x6D, 0x4D, 0x34, 0x25, 0xCA, 0x57, 0x25, 0x0D, 0x8A, 0x6A, 0x30, 0x52, 0xA1, 0xDB, 0x28,
+    0x90, 0x75, 0x7D, 0xC8, 0xD7, 0x72, 0xD4, 0xB1, 0xEE, 0x6D, 0x30, 0x1D, 0x37, 0x2D, 0x24, 0xAF,
+    0x29, 0x41, 0xE0, 0x97, 0x89, 0xAE, 0x36, 0x74, 0x94, 0x49, 0xC0, 0x51, 0x6E, 0x64, 0x5F, 0x72,
+    0xF6, 0x89, 0xB6, 0xA0, 0xBD, 0xDC, 0xEB, 0x4A, 0x50, 0x35, 0xE2, 0x0F, 0x6F, 0x0D, 0xAA, 0x72,
+    0x50, 0xF1, 0xAA, 0xD3, 0x77, 0x07, 0xC0, 0x4C, 0x66, 0x85, 0xBD, 0x59, 0xED, 0x4C, 0x2A, 0x9F,
+    0x81, 0xB5, 0x06, 0x2D, 0xE4, 0x24, 0xA7, 0xF4, 0xD0, 0x92, 0x4C, 0xFA, 0x03, 0xA0, 0x97, 0x2F,
+    0xD8, 0xD5, 0xDE, 0xF2, 0x20, 0xFB, 0xA5, 0x5B, 0xEC, 0xA6, 0x6C, 0x44, 0xA3, 0xF6, 0xD3, 0xEF,
+    0x3E, 0x91, 0x0B, 0x98, 0x6F, 0xD1, 0x08, 0xA9, 0x66, 0x2F, 0xFB, 0xD9, 0xA9, 0xA3, 0xC7, 0x09,
+    0xE1, 0xC2, 0x10, 0xD4, 0x41, 0x16, 0x50, 0x66, 0xAF, 0xAD, 0x53, 0xD1, 0x6A, 0x38, 0xDC, 0xED,
+    0x5B, 0x76, 0xA3, 0x71, 0x81, 0xE1, 0x16, 0x9E, 0x60, 0x33, 0xFF, 0x46, 0x12, 0x23, 0x55, 0x1D,
+    0xE9, 0x00, 0xD6, 0xA0, 0x42, 0x18, 0x46, 0xD7, 0x34, 0x4D, 0x89, 0x0E, 0x90, 0x20, 0xC4, 0x04,
+    0xC7, 0x68, 0x5D, 0x10, 0x22, 0xA9, 0xA0, 0x10, 0xA2, 0xF6, 0xE5, 0xD3, 0x04, 0xFB, 0x02, 0x70,
+    0x10, 0x9E, 0xEC, 0xB1, 0x4D, 0x1C, 0x74, 0x20, 0x1C, 0x1A, 0x82, 0xC1, 0xA2, 0xF5, 0x06, 0xA4,
+    0xAA, 0x6E, 0x2A, 0xBE, 0x24, 0xF5, 0x68, 0x50, 0xC3, 0xD7, 0x9B, 0x0F, 0x62, 0x9D, 0x5A, 0xDE,
+    0x0B, 0xB6, 0xB7, 0xA3, 0x76, 0xD0, 0xD7, 0x79, 0xCC, 0x34, 0x54, 0xDF, 0x46, 0x58, 0xD0, 0xAB,
+    0x1D, 0xF6, 0xDB, 0x83, 0x8C, 0xA9, 0x45, 0x43, 0x30, 0xCD, 0x7E, 0xFB, 0x73, 0x0E, 0x00, 0xB9,
+    0x43, 0x44, 0x08, 0x8D, 0x66, 0x55, 0x93, 0xEE, 0x09, 0x79, 0xC9, 0x4D, 0xFC, 0xCD, 0x0B, 0xE9,
+    0x65, 0xEF, 0x80, 0xC1, 0x78, 0xEA, 0x0A, 0x90, 0xC1, 0x4E, 0x72, 0x93, 0x77, 0x00, 0xB0, 0xE9,
+    0x84, 0x1A, 0x6F, 0xDC, 0x45, 0x51, 0x6A, 0x9E, 0x8A, 0xB9, 0xB6, 0x31, 0xC4, 0xFA, 0x85, 0x76,
+    0xEB, 0x2C, 0x6E, 0x9D, 0xBF, 0x34, 0xB3, 0x8B, 0x37, 0x2E, 0x6C, 0xE6, 0xDE, 0xA0, 0x72, 0x3B,
+    0x32, 0x99, 0xC4, 0xDC, 0xA1, 0xAA, 0x33, 0xA0, 0x6D, 0x37, 0x3D, 0x18, 0x6A, 0xB1, 0xFB, 0x3B,
+    0x3C, 0xE2, 0x12, 0x60, 0x7A, 0xF4, 0x14, 0x0B, 0x25, 0xCA, 0x11, 0x85, 0x5B, 0xBF, 0xB8, 0x85,
+    0x42, 0x63, 0x8E, 0xF8, 0x62, 0x80, 0x70, 0x2C, 0xC0, 0x81, 0x0F, 0x56, 0x42, 0xDD, 0xA0, 0x68,
+    0xCC, 0x31, 0xAC, 0xF1, 0xCD, 0x78, 0x5E, 0x3C, 0x62, 0x03, 0x4B, 0x39, 0x5E, 0x40, 0x31, 0x19,
+    0x45, 0x9B, 0x9D, 0xAF, 0xFF, 0x11, 0x59, 0x2E, 0xBB, 0x19, 0x46, 0x35, 0xB7, 0xC6, 0xFC, 0x89,
+    0x33, 0xBF, 0xF8, 0x73, 0x1C, 0xC4, 0x59, 0x10, 0xA3, 0xCE, 0x88, 0x80, 0x61, 0x06, 0x52, 0x47,
+    0x04, 0x64, 0x02, 0x16, 0xFB, 0xE4, 0xA0, 0x9B, 0x91, 0x88, 0xBC, 0xC8, 0x19, 0x53, 0x6E, 0x30,
+    0x33, 0x94, 0x1A, 0x62, 0xEB, 0x4D, 0x87, 0x05, 0xA0, 0x54, 0xA2, 0xFF, 0x67, 0xFC, 0x06, 0xBD,
+    0x55, 0x31, 0x8E, 0xD5, 0x48, 0x10, 0x2D, 0x7F, 0xEB, 0xAB, 0x25, 0x1C, 0x34, 0x01, 0x13, 0xFB,
+    0x06, 0xEB, 0x0B, 0x00, 0x6D, 0x4E, 0xB0, 0x13, 0xC0, 0x39, 0xB8, 0x01, 0x36, 0x10, 0x92, 0x70,
+    0x03, 0x08, 0xD1, 0xDF, 0x80, 0x74, 0xB3, 0x76, 0x46, 0xB0, 0x89, 0x45, 0x4A, 0x62, 0x21, 0x91,
+    0x40, 0x80, 0x05, 0x5E, 0x64, 0x18, 0xDB, 0xC5, 0x7B, 0xD5, 0x1E, 0x76, 0x36, 0xD9, 0x6C, 0xD6,
+    0xA3, 0xDF, 0xFA, 0xD3, 0xAE, 0x7A, 0xF5, 0xEA, 0xD5, 0xEB, 0xFE, 0x22, 0x72, 0x56, 0x8B, 0x88,
+    0x8E, 0x22, 0xB9, 0x4E, 0x22, 0xFE, 0xFD, 0x22, 0xD2, 0xB4, 0x9B, 0xC8, 0x2D, 0x39, 0x93, 0xF4,
+    0xE4, 0x8A, 0x90, 0x42, 0x5B, 0xBC, 0xE5, 0x52, 0x69, 0x27, 0x12, 0x3E, 0x63, 0x89, 0x0F, 0xB1,
+    0x68, 0xD5, 0xC9, 0x61, 0xC5, 0x92, 0x2F, 0x65, 0x2F, 0xC5, 0x84, 0xA5, 0x1C, 0xCB, 0x41, 0x42,
+    0x8F, 0xA5, 0xF9, 0xF8, 0x7A, 0x10, 0x55, 0x1D, 0x33, 0x2E, 0x39, 0x17, 0xB7, 0x88, 0x1F, 0xFD,
+    0x8C, 0xA5, 0x1C, 0xC5, 0x4F, 0x61, 0xC0, 0xD2, 0x74, 0x52, 0xCC, 0x7B, 0xB5, 0x6C, 0xCB, 0x7B,
+    0xC9, 0xF4, 0x02, 0x8C, 0x54, 0xB1, 0x79, 0x9B, 0x6F, 0x8E, 0x72, 0x73, 0x7F, 0x2D, 0x7E, 0x95,
+    0x9D, 0x4D, 0xAE, 0x83, 0xC8, 0x41, 0x17, 0xF2, 0x8F, 0xB2, 0xD3, 0x09, 0x7F, 0x21, 0xB1, 0x7A,
+    0x8B, 0x4D, 0x3F, 0x36, 0x75, 0xE2, 0xE3, 0x16, 0x37, 0x4B, 0xBE, 0x66, 0x1B, 0x70, 0x4F, 0xB1,
+    0x35, 0x42, 0xD2, 0x28, 0x32, 0x03, 0xBE, 0x82, 0xAE, 0x84, 0xCE, 0x18, 0x81, 0x5B, 0xBE, 0xE6,
+    0x68, 0x5E, 0xEF, 0x29, 0x50, 0x00, 0xEF, 0xFA, 0x3F, 0x81, 0xF4, 0x65, 0xDD, 0x95, 0x29, 0xBA,
+    0x49, 0xAE, 0x3C, 0xFF, 0x9F, 0x32, 0x67, 0x97, 0xD5, 0x2A, 0x76, 0x3A, 0xDD, 0xC6, 0x7F, 0x3D,
+    0x1A, 0x2D, 0x58, 0xCC, 0x53, 0x81, 0xEC, 0x5F, 0xFA, 0xC4, 0x79, 0x97, 0xC7, 0x28, 0x51, 0x9D,
+    0xE2, 0xDB, 0x92, 0xC4, 0x31, 0x46, 0xA6, 0x4D, 0xBC, 0xB7, 0x26, 0x69, 0x48, 0xC8, 0x94, 0xF1,
+    0x94, 0x83, 0xC2, 0x18, 0x1F, 0xD3, 0x05, 0x7D, 0xA9, 0xC9, 0x42, 0x3A, 0x7F, 0xEF, 0xAA, 0x00,
+    0x56, 0x09, 0xEC, 0x54, 0x93, 0xFC, 0x78, 0xDA, 0xB4, 0x0B, 0x7D, 0xDC, 0x02, 0xD6, 0xDC, 0x7D,
+    0x66, 0x33, 0xAD, 0x46, 0xF2, 0x16, 0xB7, 0x7A, 0xD3, 0x4E, 0x1F, 0xEB, 0xE9, 0x15, 0x77, 0x2B,
+    0xE6, 0xE4, 0xEB, 0xC1, 0x72, 0xB4, 0xC3, 0x28, 0x44, 0xCA, 0xED, 0x8F, 0xC5, 0x3A, 0x35, 0x78,
+    0x89, 0x09, 0xBE, 0x4C, 0xF0, 0x18, 0x8C, 0x41, 0xC4, 0x4E, 0x08, 0x81, 0xEF, 0x78, 0xD1, 0xE5,
+    0x0A, 0x0F, 0x20, 0x0C, 0x35, 0x43, 0xCA, 0xE2, 0x73, 0xD0, 0xEF, 0x96, 0x8E, 0xC1, 0xC0, 0x44,
+    0xBA, 0xC5, 0xCE, 0xAB, 0xDC, 0x90, 0x66, 0x20, 0x38, 0x21, 0x77, 0x20, 0x82, 0x4A, 0x82, 0x0D,
+    0x3D, 0x54, 0x24, 0x55, 0xB7, 0xFE, 0xDA, 0x62, 0xAF, 0xDA, 0x4B, 0x9D, 0xE9, 0x87, 0xD7, 0x64,
+    0xB5, 0x70, 0x19, 0x11, 0xB6, 0x21, 0xEE, 0x11, 0x99, 0x92, 0x9F, 0xB3, 0x05, 0xE3, 0x38, 0xB2,
+    0xF1, 0x8A, 0x88, 0x4D, 0x4F, 0x16, 0x0F, 0x76, 0x58, 0x47, 0x21, 0x38, 0x38, 0xCF, 0xED, 0xF3,
+    0x44, 0x51, 0x75, 0x23, 0xE3, 0x16, 0x4D, 0xF4, 0x05, 0x3D, 0xC0, 0x3C, 0xD6, 0x0F, 0x00, 0x29,
+    0x39, 0xDC, 0xED, 0xF4, 0x3C, 0xA7, 0x3A, 0xBB, 0x53, 0xD3, 0xE6, 0xBC, 0x73, 0x66, 0x24, 0xCB,
+    0x95, 0x3F, 0x4E, 0x6D, 0x91, 0x2C, 0x34, 0x1B, 0x26, 0xEB, 0xD6, 0x89, 0x41, 0xD8, 0x3F, 0x98,
+    0xB8, 0x1C, 0xEB, 0xEB, 0x2E, 0x7B, 0x3C, 0xE7, 0x39, 0xE0, 0xA7, 0xC7, 0x91, 0x81, 0x99, 0x87,
+    0xD0, 0x66, 0x75, 0x76, 0x7E, 0xBD, 0x65, 0xB3, 0xE9, 0x37, 0xBC, 0xC6, 0xD9, 0xA2, 0xB9, 0x5D,
+    0x37, 0x5F, 0x39, 0x9C, 0x7B, 0x08, 0x0C, 0x5D, 0xC3, 0x6C, 0x3C, 0xE2, 0xF0, 0x1B, 0xC1, 0x24,
+    0x81, 0x55, 0x3F, 0x4E, 0x35, 0xFC, 0xD1, 0xDB, 0x4C, 0x77, 0x0F, 0x99, 0xBF, 0x2F, 0x23, 0x33,
+    0x8B, 0xFC, 0x78, 0x12, 0x4B, 0x57, 0x1D, 0x0C, 0xD3, 0x1A, 0xA5, 0x77, 0x31, 0x76, 0xD4, 0x95,
+    0x06, 0x81, 0xD6, 0xA4, 0x43, 0xB1, 0xA8, 0x83, 0x07, 0x52, 0xB9, 0x1A, 0x67, 0x3F, 0x1A, 0x46,
+    0x35, 0x5A, 0x17, 0x18, 0x05, 0x73, 0xF6, 0x33, 0x0D, 0x04, 0x98, 0x8C, 0xAF, 0xD1, 0xA9, 0x53,
+    0xF0, 0xB5, 0xEC, 0x42, 0x49, 0xF1, 0x78, 0x1F, 0xDB, 0x73, 0x72, 0x60, 0xAC, 0x25, 0x5B, 0x2F,
+    0x6B, 0x20, 0x1D, 0xE7, 0x1A, 0x71, 0x42, 0xB3, 0xB3, 0x0C, 0x9D, 0x8A, 0x3A, 0xA6, 0x17, 0x0A,
+    0x59, 0x8A, 0x0D, 0xBE, 0x4B, 0x5D, 0xE2, 0xC2, 0x63, 0x2D, 0xD2, 0x61, 0x31, 0x7E, 0x50, 0x0D,
+    0x12, 0x27, 0x98, 0xA8, 0x7D, 0x72, 0x4C, 0x0E, 0x3C, 0x8F, 0x8D, 0xF0, 0x66, 0x94, 0xED, 0xB0,
+    0xC8, 0x7D, 0xFC, 0x5D, 0x57, 0x3D, 0xFF, 0x64, 0x94, 0x58, 0x0E, 0xF9, 0xD2, 0xD4, 0x76, 0xC3,
+    0xA6, 0x87, 0xFA, 0x55, 0x36, 0xB4, 0x4E, 0x9A, 0xC9, 0x10, 0x4C, 0xE3, 0xD1, 0x8E, 0x2A, 0x15,
+    0x64, 0x6D, 0xD4, 0x21, 0x66, 0xB1, 0xAB, 0x83, 0x20, 0x97, 0x82, 0x32, 0xE5, 0x15, 0x30, 0xE0,
+    0x36, 0x68, 0x93, 0x88, 0x41, 0x9F, 0xA7, 0x1F, 0x11, 0xC7, 0xE1, 0x56, 0xE6, 0x87, 0xB6, 0x19,
+    0x31, 0xD9, 0x66, 0x40, 0x07, 0xF8, 0xDE, 0x1D, 0xF4, 0xA0, 0x52, 0x2C, 0x30, 0x40, 0xF5, 0x15,
+    0x79, 0xFA, 0x42, 0x71, 0xFF, 0x57, 0xDB, 0xCB, 0x72, 0x42, 0x6B, 0x11, 0xB7, 0x9F, 0xDB, 0x10,
+    0x1E, 0x70, 0x17, 0x3A, 0x84, 0x7F, 0xD2, 0xF9, 0xC0, 0xBB, 0xC8, 0xD3, 0xA7, 0x41, 0xFF, 0xF1,
+    0x9A, 0x94, 0xC3, 0x5D, 0x1A, 0xEB, 0x62, 0xE2, 0xEF, 0x01, 0x6F, 0xA1, 0x3B, 0x05, 0x2F, 0x85,
+    0xF3, 0xAB, 0xD7, 0x32, 0x34, 0x0D, 0xBC, 0xDD, 0x33, 0xE5, 0xC5, 0x5A, 0x68, 0x9F, 0xF1, 0x48,
+    0xB4, 0x05, 0x2D, 0x8F, 0x8D, 0xFC, 0x62, 0x85, 0x33, 0xCB, 0x77, 0x33, 0x6E, 0x8B, 0xF8, 0xFB,
+    0x58, 0x41, 0x9D, 0xD0, 0xC5, 0xDA, 0x8F, 0xF1, 0x29, 0x9C, 0xD9, 0x2A, 0x12, 0x37, 0x08, 0x86,
+    0xF8, 0xE2, 0x3B, 0x28, 0x75, 0x25, 0x7E, 0x22, 0x91, 0xA7, 0x1D, 0xE3, 0x55, 0xAA, 0x3E, 0x03,
+    0xA1, 0x88, 0x31, 0xF6, 0x10, 0xAD, 0x50, 0xCE, 0xA8, 0x5C, 0xE4, 0xBF, 0x9F, 0x9F, 0xC5, 0x55,
+    0x31, 0x8E, 0xD4, 0x30, 0x14, 0xFD, 0x8E, 0x19, 0x2C, 0x91, 0xC2, 0xD5, 0x76, 0x2B, 0xA5, 0xA1,
+    0xC6, 0x27, 0x40, 0x4E, 0x4F, 0xB1, 0x53, 0x2C, 0x15, 0x87, 0xE0, 0x02, 0x2B, 0x25, 0x1D, 0xED,
+    0x5E, 0x82, 0x3B, 0xD0, 0xB0, 0x36, 0xEC, 0x01, 0x88, 0xC4, 0x05, 0x82, 0x90, 0x90, 0xA8, 0x70,
+    0x61, 0x89, 0x2C, 0x72, 0xF2, 0x79, 0x3F, 0x61, 0x76, 0xF6, 0x00, 0x68, 0x27, 0xD2, 0x7C, 0xCD,
+    0x38, 0xF6, 0xFF, 0xCF, 0xEF, 0xBD, 0xFF, 0x87, 0xE8, 0xAC, 0x25, 0x22, 0x3F, 0x22, 0xD8, 0x84,
+    0x60, 0x32, 0x42, 0x35, 0x21, 0xD0, 0x25, 0x6D, 0x8F, 0x0A, 0x33, 0x5E, 0x32, 0x47, 0xF2, 0xCC,
+    0x89, 0xF8, 0x4F, 0xC8, 0x9A, 0xFB, 0xA6, 0x98, 0x85, 0xEA, 0x62, 0x0B, 0x99, 0xB9, 0xC9, 0xA4,
+    0x67, 0x97, 0x10, 0x90, 0x08, 0x61, 0x20, 0x53, 0x10, 0xEA, 0xD2, 0x0D, 0x64, 0xD7, 0x30, 0xE1,
+    0xA7, 0x4B, 0x78, 0xDB, 0x8D, 0x3E, 0x2B, 0x8E, 0xCD, 0xF2, 0x86, 0x5B, 0xE4, 0x5C, 0x48, 0x33,
+    0xA3, 0x64, 0xC7, 0x3D, 0x2A, 0xED, 0xD7, 0x7A, 0xBB, 0xFD, 0x01, 0x91, 0x2C, 0x56, 0xCB, 0x01,
+    0x95, 0x6A, 0x4F, 0x03, 0x48, 0xBD, 0x16, 0x72, 0x58, 0x40, 0xC9, 0x22, 0x37, 0x03, 0xE9, 0xA9,
+    0x4E, 0xA4, 0xF6, 0x6A, 0x7F, 0x1A, 0x86, 0xE4, 0x71, 0xD7, 0x57, 0xC0, 0xB2, 0x4C, 0xA4, 0xA4,
+    0x64, 0x35, 0x22, 0x87, 0x6A, 0x77, 0xA7, 0x61, 0xE8, 0x85, 0x19, 0x88, 0xC2, 0x05, 0x24, 0x0B,
+    0x16, 0xE1, 0x65, 0xDD, 0xD3, 0xF1, 0x79, 0x54, 0x2C, 0x4F, 0x68, 0xA7, 0x47, 0x95, 0x43, 0xDF,
+    0x7D, 0x5E, 0x9A, 0x64, 0xB9, 0xA0, 0x28, 0x68, 0x8A, 0xD4, 0x2C, 0x64, 0x78, 0x52, 0xEC, 0xC7,
+    0x2E, 0x86, 0x77, 0xA9, 0x9A, 0xCE, 0xE9, 0xD9, 0x01, 0xE1, 0x73, 0xC1, 0xF8, 0x91, 0x6A, 0x5E,
+    0xB7, 0x23, 0x1F, 0xDF, 0x85, 0x49, 0x73, 0xEB, 0x8A, 0x99, 0x29, 0x14, 0x8B, 0x63, 0x73, 0x93,
+    0xF4, 0x6F, 0x60, 0xB4, 0xDF, 0x81, 0xD1, 0xDD, 0x02, 0x63, 0xA7, 0x8B, 0xFF, 0x54, 0x00, 0xF4,
+    0x36, 0xD7, 0xC5, 0x7F, 0x19, 0x6D, 0xF6, 0xBF, 0x62, 0x93, 0x50, 0xCE, 0x8F, 0xBE, 0xD0, 0x43,
+    0x8C, 0x4E, 0x72, 0x76, 0x82, 0xF1, 0xFC, 0xDE, 0xC3, 0x44, 0xE2, 0x2A, 0x0A, 0x51, 0x6C, 0x25,
+    0x41, 0x88, 0x23, 0x23, 0x2D, 0x78, 0x2F, 0x32, 0xB7, 0x7A, 0x56, 0x0C, 0x32, 0xAA, 0x35, 0x80,
+    0xAF, 0x49, 0xCF, 0x20, 0x43, 0x42, 0x36, 0x85, 0x9A, 0x54, 0x17, 0xD0, 0x62, 0x27, 0x94, 0xB4,
+    0x99, 0xFC, 0x80, 0x0E, 0xF6, 0xC0, 0x40, 0x5D, 0x04, 0x9B, 0x21, 0x82, 0x2F, 0xEE, 0xC1, 0x1C,
+    0xB7, 0x7E, 0x40, 0x0A, 0x9F, 0x40, 0xB9, 0x5B, 0xDE, 0x16, 0x51, 0x23, 0x83, 0x0E, 0x16, 0xC1,
+    0x96, 0x63, 0x67, 0xAD, 0xA3, 0x00, 0x5C, 0xC1, 0x52, 0xF8, 0xA2, 0xCB, 0x01, 0xD5, 0xAE, 0x3D,
+    0x0D, 0xA0, 0x9D, 0x4C, 0x20, 0x07, 0xF7, 0x40, 0x5F, 0x0C, 0x82, 0xD9, 0xF7, 0x54, 0x67, 0x3B,
+    0x00, 0xCF, 0x81, 0xC6, 0x47, 0x06, 0x74, 0x65, 0x61, 0xB3, 0xC5, 0x45, 0x52, 0x8B, 0x68, 0xF6,
+    0xA1, 0x69, 0x1F, 0xF8, 0xFC, 0xB1, 0xC9, 0x81, 0x4B, 0x2A, 0xD1, 0xA9, 0x8B, 0xDB, 0xE8, 0xD6,
+    0x32, 0xB4, 0xCF, 0x36, 0x2C, 0xD0, 0x4E, 0x7A, 0xA6, 0x62, 0xC0, 0xF0, 0x23, 0x1A, 0x01, 0x86,
+    0x04, 0x36, 0x78, 0x74, 0xA0, 0xF0, 0x0A, 0x3D, 0x77, 0xC7, 0x32, 0xCD, 0x30, 0xC8, 0x18, 0xA7,
+    0x1C, 0x8B, 0xE4, 0x68, 0x61, 0x2B, 0x29, 0x24, 0x27, 0x50, 0x6D, 0xC9, 0x1D, 0x8A, 0xEA, 0xF9,
+    0x9F, 0x47, 0x8D, 0x38, 0x22, 0x48, 0xA7, 0x79, 0xD9, 0x9C, 0xB7, 0x95, 0x8A, 0xDF, 0xE3, 0x10,
+    0x20, 0xA2, 0x75, 0xC4, 0xEF, 0xC9, 0x94, 0x7A, 0xC6, 0x61, 0xEE, 0x71, 0x9D, 0x11, 0xD7, 0x9C,
+    0x6C, 0x32, 0xB3, 0x29, 0x86, 0x2B, 0x66, 0x2C, 0xE2, 0x23, 0x3B, 0x1B, 0xFE, 0xB9, 0x1D, 0x5F,
+    0x56, 0xEE, 0xB6, 0x9C, 0x74, 0xB8, 0x9E, 0xE1, 0x15, 0x0A, 0xA3, 0xF4, 0xDA, 0x96, 0xD4, 0x25,
+    0x97, 0x05, 0x12, 0x58, 0x42, 0x61, 0xEC, 0xF7, 0x11, 0x74, 0x2A, 0xDC, 0x6A, 0xC4, 0xA0, 0x10,
+    0x93, 0xF8, 0x6F, 0x62, 0x5D, 0xBE, 0x28, 0x72, 0x7D, 0x9F, 0xE4, 0x12, 0x2B, 0x65, 0x3D, 0x86,
+    0x8E, 0x5E, 0x14, 0xA2, 0x1C, 0x1C, 0x84, 0x2F, 0xEE, 0x91, 0x49, 0x8B, 0x42, 0x3D, 0x66, 0x8F,
+    0xFF, 0x2A, 0xC3, 0x89, 0x2F, 0x50, 0xCC, 0x14, 0x87, 0x2E, 0x75, 0x49, 0x30, 0xAC, 0x23, 0xC5,
+    0xC8, 0xDD, 0x9F, 0x06, 0x69, 0x4B, 0xB7, 0x2E, 0x04, 0xC1, 0x55, 0x71, 0x7B, 0xFF, 0x4F, 0x25,
+    0x9C, 0x49, 0xAB, 0x28, 0x21, 0xE7, 0xE6, 0x28, 0x81, 0x4F, 0x37, 0x8A, 0xCB, 0x02, 0xDD, 0x66,
+    0x0B, 0x15, 0x9B, 0xC9, 0x02, 0x54, 0x0D, 0x51, 0xEA, 0xA9, 0x8B, 0x36, 0x87, 0x68, 0x53, 0x80,
+    0xFA, 0xA2, 0x7B, 0x88, 0xDD, 0x10, 0x7E, 0x70, 0xEC, 0x80, 0xC3, 0x71, 0x88, 0xB5, 0x38, 0x7D,
+    0xAD, 0xA0, 0x2E, 0xB7, 0x02, 0x7E, 0xBD, 0x08, 0xA9, 0xF9, 0x38, 0x1D, 0xFE, 0x4B, 0x7E, 0xFA,
+    0x0B, 0xAD, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x64, 0xE5, 0x62, 0x84, 0xA6, 0xD9,
+    0x54, 0x14, 0xF3, 0x03, 0x08, 0x7F, 0x01, 0x1A, 0xEB, 0x21, 0x41, 0x41, 0xC1, 0x16, 0x79, 0x34,
+    0x7C, 0xC4, 0x7E, 0x82, 0xAD, 0xA4, 0xA0, 0x24, 0x05, 0x5D, 0x0A, 0x3E, 0x01, 0xCA, 0x6D, 0xB2,
+    0x63, 0x2D, 0x45, 0x8A, 0x34, 0x0E, 0x48, 0xD0, 0x9A, 0x80, 0x28, 0xA0, 0xD8, 0x49, 0x64, 0xC2,
+    0xEC, 0x32, 0x33, 0x97, 0x73, 0xED, 0xB7, 0x4A, 0x1A, 0x8A, 0xC0, 0xCE, 0xF3, 0x3C, 0x59, 0x9E,
+    0xF1, 0xB9, 0x77, 0xCE, 0x3D, 0xE7, 0x9A, 0x68, 0xDF, 0x91, 0xE2, 0x91, 0x0C, 0xCF, 0xE4, 0x9E,
+    0x2C, 0x54, 0xEA, 0x44, 0xF7, 0xF0, 0x93, 0xE1, 0xC2, 0x79, 0xC5, 0xA9, 0x34, 0xCC, 0xD9, 0x94,
+    0xD3, 0x64, 0xA3, 0x49, 0x2E, 0xE8, 0xE8, 0x26, 0x1D, 0xFB, 0xD1, 0x2C, 0x7E, 0x34, 0xC1, 0x8F,
+    0x16, 0xD3, 0xCD, 0x7E, 0xEC, 0x27, 0xFF, 0x1B, 0x8F, 0x3D, 0xF3, 0xD8, 0xB2, 0x1F, 0x75, 0x76,
+    0x03, 0x75, 0xB4, 0x8D, 0x3A, 0x37, 0xA3, 0xE2, 0xBF, 0xE7, 0x8A, 0x39, 0xD0, 0x99, 0x5D, 0xE8,
+    0x98, 0x4E, 0xB6, 0x15, 0xBE, 0x88, 0x12, 0x01, 0x0B, 0xDC, 0xB1, 0xBC, 0x3E, 0xBB, 0x20, 0x21,
+    0xCC, 0x52, 0x97, 0x26, 0x11, 0xEF, 0x98, 0xDC, 0x28, 0x31, 0xDA, 0x60, 0xA2, 0x4E, 0x4D, 0xAE,
+    0xF9, 0x11, 0x93, 0x04, 0xD1, 0x7C, 0x19, 0xC8, 0xFF, 0x10, 0xA9, 0x12, 0x1C, 0x73, 0x3F, 0x50,
+    0xFB, 0x5D, 0xA4, 0x16, 0x27, 0xB0, 0xBB, 0x99, 0x6E, 0xC6, 0xAD, 0x9C, 0xE0, 0x18, 0x27, 0xE0,
+    0x8E, 0x9A, 0xCB, 0x91, 0xF4, 0x83, 0x69, 0x9D, 0x72, 0x2F, 0xCF, 0x64, 0xED, 0x36, 0x99, 0x12,
+    0xA4, 0xC7, 0x0C, 0xA2, 0x32, 0x73, 0x02, 0x9A, 0xE0, 0xE5, 0x53, 0xDE, 0x15, 0xBB, 0x98, 0x5C,
+    0x15, 0x37, 0x9B, 0xA8, 0xB2, 0x9B, 0x4C, 0x3C, 0x4D, 0xC0, 0x65, 0x16, 0x64, 0xE6, 0xC1, 0x0F,
+    0xF6, 0xFA, 0x2B, 0xF2, 0x83, 0x0B, 0x44, 0xC0, 0x97, 0xFF, 0xE7, 0x1C, 0xAB, 0xC9, 0x09, 0xC2,
+    0x84, 0x28, 0xF8, 0x47, 0x1C, 0x87, 0x8C, 0x3B, 0xAA, 0xB6, 0x60, 0x35, 0x36, 0x20, 0x05, 0xC7,
+    0xD1, 0x94, 0xCF, 0x77, 0x58, 0x71, 0x33, 0x35, 0x99, 0xA8, 0xC7, 0x29, 0x13, 0x00, 0x06, 0xD2,
+    0x51, 0xD0, 0xA8, 0xE1, 0xCF, 0xB0, 0x2B, 0xC9, 0x66, 0xC5, 0x0B, 0x99, 0x01, 0xF5, 0x24, 0x7A,
+    0x17, 0x41, 0x5C, 0x47, 0x8F, 0x02, 0xD9, 0x82, 0x3A, 0x02, 0xF3, 0x08, 0x35, 0x75, 0xD3, 0x0A,
+    0x40, 0x3D, 0x02, 0x9C, 0x63, 0x6E, 0x3A, 0x6A, 0x78, 0x22, 0xE6, 0x19, 0x99, 0x8E, 0x3C, 0xF1,
+    0xC7, 0xA9, 0xCE, 0x38, 0xC8, 0xC2, 0x1F, 0xF1, 0x13, 0x9C, 0xB2, 0x95, 0xFC, 0x7F, 0xEF, 0x6A,
+    0xA0, 0x48, 0x5C, 0x1B, 0x6B, 0x44, 0x43, 0xD9, 0x39, 0x51, 0xCB, 0x0F, 0xB7, 0x6C, 0x8F, 0x80,
+    0xD3, 0x4F, 0xA4, 0xF2, 0x1A, 0x01, 0x0A, 0xA5, 0xA3, 0xEE, 0x76, 0x90, 0xF7, 0x74, 0x50, 0xFF,
+    0x44, 0xEE, 0x69, 0x80, 0xFA, 0x23, 0xA4, 0xB9, 0x65, 0x6D, 0x71, 0x28, 0x60, 0x2B, 0x88, 0xD6,
+    0x64, 0xB3, 0xD8, 0xA0, 0x17, 0x01, 0x77, 0xCF, 0x7C, 0x90, 0xDA, 0x79, 0x2E, 0x04, 0x74, 0x21,
+    0x4A, 0x58, 0xA2, 0x7E, 0xD6, 0x24, 0xF0, 0xC8, 0x05, 0xDC, 0x5E, 0x21, 0x45, 0xC1, 0xD8, 0x05,
+    0x62, 0x3B, 0xA9, 0xE4, 0xBB, 0x66, 0x8C, 0x37, 0x35, 0xAE, 0x40, 0x23, 0x78, 0x17, 0x64, 0x07,
+    0x3C, 0x26, 0xFF, 0xA9, 0x94, 0xF5, 0x99, 0x7F, 0x81, 0x72, 0x69, 0xC4, 0x6C, 0xAF, 0x1F, 0x0A,
+    0x6E, 0xCD, 0x38, 0x61, 0xA1, 0x6F, 0xE5, 0x78, 0x02, 0xAB, 0xF9, 0x57, 0x12, 0xE7, 0x54, 0xF7,
+    0x40, 0xB8, 0x9D, 0xC1, 0x83, 0xEB, 0xE4, 0x14, 0x0A, 0xC5, 0x21, 0xD1, 0x96, 0x59, 0x9A, 0xF5,
+    0x76, 0x80, 0x44, 0x70, 0x5B, 0x1F, 0x6E, 0x03, 0xAC, 0x44, 0xD5, 0x5E, 0xCA, 0x6B, 0x16, 0x6A,
+    0x27, 0xF2, 0x37, 0x95, 0x61, 0xE4, 0x22, 0x61, 0x54, 0x11, 0x72, 0xB1, 0x0D, 0x17, 0xCA, 0x8E,
+    0x5D, 0xB8, 0x2C, 0x3C, 0x85, 0x6B, 0x16, 0xCE, 0xDD, 0xB8, 0xD6, 0xF5, 0x2E, 0x28, 0x09, 0x50,
+    0x81, 0x79, 0x99, 0xDC, 0x70, 0x7E, 0x4C, 0x77, 0xFF, 0x03, 0x48, 0x33, 0x9D, 0x99, 0x17, 0x19,
+    0x08, 0xAF, 0x19, 0x79, 0xDB, 0x34, 0x64, 0xA8, 0xE9, 0x3D, 0x6A, 0xAE, 0x33, 0x48, 0x59, 0xF0,
+    0xEA, 0xA1, 0x84, 0xE8, 0x09, 0xEF, 0xE8, 0x05, 0xAC, 0x45, 0xF2, 0xBF, 0x44, 0x18, 0x28, 0x81,
+    0xB7, 0x04, 0x92, 0x53, 0x0F, 0xD3, 0xC0, 0x2C, 0x91, 0x07, 0xE8, 0xA3, 0xB3, 0x81, 0xBB, 0x16,
+    0x53, 0xEC, 0xB8, 0x5A, 0xB1, 0x6B, 0x19, 0x81, 0xD1, 0x03, 0x6F, 0x1C, 0x8D, 0xDA, 0x4D, 0x1F,
+    0xE0, 0x09, 0x8C, 0xCE, 0x1C, 0xC9, 0xA2, 0x0E, 0x74, 0x52, 0x6D, 0x2B, 0xE6, 0x82, 0xBB, 0x2A,
+    0xF9, 0x4C, 0xED, 0xA5, 0xB0, 0xF1, 0x13, 0x34, 0x15, 0x6C, 0x40, 0xF2, 0x68, 0x4D, 0x70, 0xB9,
+    0x8E, 0x90, 0x1C, 0xB0, 0x41, 0xBC, 0xCA, 0x95, 0x74, 0xB0, 0x16, 0x15, 0xC0, 0xB3, 0xAD, 0x2E,
+    0x2A, 0x1D, 0xF6, 0xBD, 0x61, 0x19, 0xD1, 0x10, 0x80, 0xA1, 0xEF, 0x43, 0x67, 0xD4, 0x3C, 0x88,
+    0xE1, 0xAC, 0x08, 0xFB, 0x47, 0xFE, 0x24, 0x2B, 0x78, 0x5F, 0x67, 0xA6, 0xF6, 0xAF, 0x44, 0xFE,
+    0x9B, 0x59, 0x15, 0x3F, 0x98, 0x57, 0x85, 0xFA, 0xA7, 0x49, 0x15, 0x1B, 0xFB, 0x00, 0xE5, 0x0D,
+    0x90, 0x14, 0xB5, 0xA5, 0xDB, 0x3A, 0xE2, 0xBF, 0x5A, 0xE6, 0x7F, 0x23, 0xC3, 0x32, 0x06, 0xC2,
+    0x04, 0x5F, 0xA8, 0x21, 0x15, 0x15, 0xAB, 0xAE, 0x3A, 0xB9, 0x15, 0x64, 0xA1, 0x76, 0x7E, 0x9F,
+    0x5C, 0x79, 0x4C, 0x1E, 0x26, 0x5D, 0x50, 0xF6, 0x93, 0x43, 0xB7, 0x6A, 0x0B, 0x09, 0x76, 0xB3,
+    0x9A, 0xF1, 0x74, 0x69, 0x17, 0x13, 0x01, 0x8E, 0x26, 0xB8, 0xCE, 0x08, 0x64, 0x99, 0x0B, 0x1A,
+    0xE1, 0xDA, 0x64, 0xFB, 0x9F, 0xA5, 0xB3, 0xA1, 0xD6, 0x30, 0x69, 0x2D, 0xAE, 0xB9, 0xB3, 0x9A,
+    0x71, 0x5E, 0xCD, 0x18, 0x3D, 0xBD, 0x61, 0xC6, 0x1A, 0x45, 0xEF, 0x39, 0x08, 0xB2, 0xFB, 0xD3,
+    0x7F, 0x8F, 0xEF, 0xD0, 0x97, 0xB1, 0x66, 0x80, 0x4A, 0xE6, 0x7F, 0x44, 0x62, 0x64, 0x9E, 0x81,
+    0xFB, 0x92, 0x89, 0xBF, 0x28, 0x56, 0x04, 0x35, 0x0B, 0xAC, 0x46, 0x0B, 0x59, 0xFB, 0xB6, 0xA4,
+    0x8E, 0x4E, 0x58, 0x41, 0x20, 0x0D, 0xA4, 0xA7, 0x87, 0xAD, 0x31, 0x31, 0x7F, 0xCD, 0x5C, 0x20,
+    0xAD, 0xB8, 0xDF, 0xE3, 0x1B, 0x0B, 0x59, 0x29, 0xAC, 0x5A, 0x28, 0xAC, 0xC7, 0x5B, 0x67, 0x6B,
+    0xEC, 0x3B, 0x88, 0x7E, 0x39, 0x60, 0xEF, 0x2C, 0xE1, 0x15, 0x38, 0xAB, 0x59, 0xF1, 0xC0, 0x1F,
+    0x72, 0xE8, 0x2F, 0x38, 0xD9, 0xE7, 0xD7, 0x45, 0x5F, 0x25, 0x7F, 0xBF, 0x24, 0x37, 0xF9, 0x84,
+    0xAF, 0x60, 0x36, 0x10, 0x35, 0x9A, 0x19, 0x90, 0x91, 0x74, 0x21, 0xE7, 0xAF, 0x48, 0x77, 0xAF,
+    0xBF, 0x1E, 0x6F, 0x3D, 0xFE, 0x01, 0xC5, 0x55, 0x3D, 0x6E, 0xD5, 0x40, 0x10, 0x1E, 0xDB, 0x79,
+    0x58, 0x62, 0x8B, 0x6D, 0x78, 0xB5, 0x7B, 0x1A, 0x9F, 0x00, 0xF6, 0x75, 0x14, 0x29, 0x48, 0x91,
+    0x34, 0x50, 0xE4, 0x08, 0xB9, 0x00, 0xC2, 0xE6, 0x04, 0x70, 0x84, 0x94, 0x28, 0x0D, 0x0D, 0x05,
+    0x05, 0xB0, 0x4B, 0x45, 0x6B, 0x68, 0x68, 0x2D, 0xF1, 0x27, 0x25, 0x45, 0x56, 0x91, 0x23, 0x2D,
+    0x68, 0xED, 0xE1, 0x9B, 0x7D, 0x7E, 0x79, 0x07, 0x48, 0x14, 0x2C, 0xED, 0xC8, 0x5E, 0xEF, 0xCE,
+    0x37, 0xDF, 0xEC, 0x37, 0xB3, 0xB4, 0xD8, 0x23, 0x2A, 0x26, 0x22, 0x32, 0x8E, 0xA8, 0x1C, 0xF0,
+    0xD2, 0x60, 0x2C, 0x56, 0x24, 0x4F, 0xE5, 0x8B, 0xA8, 0x42, 0xC6, 0x58, 0x60, 0x5B, 0x5E, 0x99,
+    0xCE, 0x38, 0xED, 0x2B, 0x5F, 0x62, 0x32, 0xE7, 0x62, 0x24, 0x6E, 0x99, 0x64, 0xB2, 0xC2, 0xA4,
+    0x8E, 0x65, 0x2C, 0xA7, 0x8C, 0x77, 0xB1, 0x8E, 0xCF, 0x3B, 0xCD, 0xDF, 0x3C, 0xF1, 0x97, 0x48,
+    0x59, 0xF2, 0x94, 0xED, 0xAF, 0x61, 0x72, 0x8C, 0x4C, 0xE0, 0x46, 0x8C, 0x7B, 0x74, 0xC3, 0x28,
+    0x07, 0x08, 0xDB, 0x7A, 0x0C, 0xC6, 0x38, 0xEC, 0xC8, 0x66, 0x91, 0x96, 0xB4, 0xB8, 0x59, 0x14,
+    0xF5, 0x62, 0x20, 0xE5, 0x27, 0xCA, 0xA3, 0x69, 0xE9, 0x81, 0x6A, 0x69, 0xF3, 0x34, 0x70, 0x58,
+    0xF7, 0x65, 0xD4, 0x21, 0x9F, 0xC4, 0xE1, 0x0A, 0x0E, 0x5D, 0x03, 0x87, 0x75, 0xAF, 0xA2, 0x1E,
+    0x8A, 0xA9, 0x88, 0x69, 0xB2, 0xC1, 0xA4, 0x01, 0x4A, 0x15, 0xCA, 0xB1, 0xC6, 0x3A, 0xB6, 0x40,
+    0x39, 0x74, 0x05, 0x3F, 0xF2, 0xB4, 0xB3, 0x76, 0xB5, 0x94, 0xFC, 0x5B, 0x9C, 0x48, 0x06, 0x26,
+    0x84, 0x7D, 0x44, 0xBA, 0xDF, 0x9E, 0x0B, 0xB0, 0x5A, 0x20, 0x34, 0x4E, 0x45, 0x40, 0xE8, 0x01,
+    0xA6, 0xF6, 0x30, 0xA6, 0x83, 0xC1, 0xB6, 0xBA, 0xC3, 0xB6, 0xEA, 0x2B, 0xF2, 0x5C, 0x7D, 0xC7,
+    0x5E, 0xFD, 0x3B, 0xC0, 0x9C, 0x23, 0x31, 0x9A, 0xE1, 0x45, 0xB1, 0x13, 0x83, 0xC0, 0x4B, 0xF1,
+    0x5E, 0xCA, 0x51, 0x94, 0x09, 0x42, 0x8E, 0xDF, 0x60, 0xD9, 0x7D, 0x59, 0x61, 0x18, 0x60, 0x46,
+    0x7E, 0x9A, 0xFE, 0x8A, 0xA3, 0xCC, 0x69, 0x3F, 0xC7, 0x05, 0xCC, 0x59, 0x3B, 0x9D, 0x04, 0x09,
+    0xE0, 0x86, 0x19, 0x9E, 0x39, 0x10, 0x5F, 0xB2, 0xD3, 0x51, 0xC5, 0x4C, 0xE8, 0x4A, 0x96, 0x73,
+    0x09, 0xD7, 0x20, 0x60, 0x49, 0x42, 0x8B, 0xB9, 0x41, 0x8D, 0x05, 0x93, 0xBD, 0x64, 0xA4, 0x57,
+    0x36, 0xE0, 0xCC, 0xAA, 0x0B, 0x6E, 0xF3, 0x29, 0x5B, 0x03, 0x16, 0xE3, 0x46, 0x94, 0x12, 0x9A,
+    0x45, 0xB4, 0x3A, 0xA4, 0x10, 0x9E, 0x69, 0xBC, 0x4F, 0xB5, 0x83, 0x8E, 0xE4, 0xF7, 0xBB, 0x6A,
+    0x45, 0xDB, 0xE7, 0x7F, 0xE4, 0xE5, 0xCE, 0xC9, 0x6B, 0xF1, 0x10, 0x67, 0xB3, 0x38, 0xD8, 0x9B,
+    0x83, 0x29, 0x64, 0x65, 0x72, 0xA8, 0xC5, 0xD4, 0x69, 0xF7, 0x39, 0x8C, 0x3D, 0x82, 0x61, 0x50,
+    0xC8, 0x47, 0x98, 0x22, 0x56, 0x1D, 0xA9, 0x01, 0x06, 0x9A, 0xE8, 0x91, 0x4C, 0x98, 0xE6, 0xF4,
+    0x4D, 0x0F, 0x65, 0xB0, 0xCF, 0xC4, 0x14, 0x62, 0x10, 0x8A, 0xF6, 0xC8, 0x81, 0xA8, 0x16, 0x21,
+    0x01, 0x5C, 0x0F, 0x8D, 0x23, 0x15, 0xE8, 0xEE, 0xC9, 0x31, 0x9C, 0x83, 0x2D, 0x7B, 0x5A, 0xCE,
+    0xE8, 0xC6, 0x7F, 0xCC, 0x38, 0x4E, 0x25, 0xF3, 0xA8, 0xA7, 0xA3, 0x58, 0x05, 0x1D, 0x8D, 0x57,
+    0xC1, 0x74, 0x2A, 0x40, 0xA7, 0x83, 0x85, 0x56, 0x2D, 0x0E, 0xC6, 0x3A, 0xD3, 0x5B, 0xD7, 0x74,
+    0xF6, 0x17, 0x3B, 0x1C, 0x9E, 0xAB, 0xD9, 0x3A, 0x35, 0x42, 0xD8, 0x29, 0xA9, 0x0B, 0x54, 0x0F,
+    0x55, 0xAB, 0x87, 0x30, 0xA7, 0x89, 0x5E, 0x10, 0x52, 0xDD, 0xB6, 0x74, 0x6F, 0x8F, 0xE3, 0x12,
+    0x90, 0x86, 0xDE, 0x93, 0x39, 0x0B, 0x54, 0x81, 0x67, 0x29, 0x40, 0x73, 0x14, 0x37, 0xC2, 0x35,
+    0x11, 0xA9, 0x45, 0xCD, 0xC2, 0x52, 0x01, 0x22, 0xF1, 0xC8, 0x47, 0x0B, 0x6A, 0x17, 0x60, 0x6F,
+    0x77, 0xFD, 0x9A, 0x46, 0xDD, 0x35, 0xAB, 0x8C, 0xD1, 0xC5, 0xF4, 0x50, 0x86, 0xC4, 0x42, 0x62,
+    0x77, 0x15, 0x8C, 0xD0, 0x89, 0x89, 0x04, 0x42, 0x37, 0x9F, 0x20, 0x23, 0x7E, 0x1C, 0x20, 0xE5,
+    0x35, 0x07, 0xA2, 0xE7, 0xD2, 0x3F, 0xFA, 0xF9, 0x25, 0x17, 0x59, 0xE9, 0xBF, 0xD2, 0x9B, 0x44,
+    0x65, 0xF5, 0xB6, 0xCA, 0xAE, 0xCF, 0xE8, 0x03, 0x08, 0xC1, 0xBD, 0xC2, 0x59, 0x69, 0x24, 0x4A,
+    0xFF, 0xC1, 0x80, 0x64, 0xF3, 0x71, 0x83, 0x20, 0x1D, 0x26, 0xE7, 0xD4, 0x17, 0x85, 0xF2, 0xA6,
+    0xC1, 0x2C, 0x37, 0xFF, 0x6B, 0x7E, 0x25, 0x95, 0xEC, 0x85, 0x51, 0xAB, 0xF9, 0x0C, 0x55, 0xEB,
+    0xE9, 0xB8, 0x9C, 0xE6, 0x4A, 0xC8, 0xD2, 0xB1, 0xC7, 0x4D, 0x11, 0xC8, 0x57, 0x2A, 0xD8, 0x2A,
+    0xDD, 0x20, 0xDD, 0x66, 0x4A, 0x96, 0x03, 0x77, 0x87, 0xAA, 0xE9, 0x09, 0x0A, 0x11, 0x21, 0x8A,
+    0xC1, 0x32, 0xFE, 0x01, 0x1F, 0x49, 0xA9, 0x4B, 0x58, 0x28, 0x47, 0x8A, 0xDB, 0xAE, 0xD2, 0x0D,
+    0x34, 0xC7, 0xA0, 0xB8, 0x87, 0x30, 0x9C, 0xE6, 0x89, 0xF8, 0xE7, 0x5B, 0x35, 0x26, 0x28, 0xC1,
+    0x95, 0x9A, 0x94, 0xD6, 0x83, 0x9E, 0x20, 0xD7, 0x89, 0x44, 0x51, 0x8D, 0x4F, 0xE1, 0x38, 0xA2,
+    0xFF, 0xF8, 0x54, 0x9F, 0xA9, 0xE5, 0x2F, 0xF6, 0x25, 0x96, 0x41, 0xCA, 0x19, 0xAB, 0x9B, 0x97,
+    0x3D, 0x04, 0xA8, 0xBB, 0xAB, 0x0B, 0xE1, 0xF6, 0x38, 0xCA, 0xE5, 0x67, 0x22, 0x14, 0x16, 0xC8,
+    0x7C, 0xF6, 0x45, 0x50, 0x7E, 0xB1, 0x5A, 0x77, 0xF2, 0x6B, 0x73, 0xBC, 0xEE, 0xF3, 0x0F, 0xBD,
+    0x55, 0x31, 0x8E, 0xDC, 0x46, 0x10, 0xEC, 0x25, 0x2D, 0x10, 0x30, 0x83, 0x49, 0xA4, 0xC4, 0x09,
+    0x3F, 0x20, 0x80, 0x3F, 0x30, 0x09, 0x07, 0x52, 0x78, 0x1B, 0x9C, 0x1C, 0x58, 0x5F, 0x10, 0xA0,
+    0x27, 0x70, 0x7E, 0xA0, 0xFB, 0x81, 0x2F, 0x50, 0x60, 0xF3, 0x13, 0x24, 0xEC, 0x40, 0x81, 0x13,
+    0x02, 0xFA, 0xC0, 0xCA, 0x76, 0x24, 0x05, 0xA6, 0x6D, 0x0A, 0xA0, 0x16, 0xE4, 0xB4, 0xAB, 0x7A,
+    0xC8, 0xBB, 0x4D, 0x9C, 0xD8, 0x80, 0x78, 0xD8, 0x39, 0x72, 0xD8, 0xD3, 0xDD, 0x55, 0x5D, 0xDD,
+    0x14, 0xB1, 0xAB, 0x18, 0xB0, 0x68, 0x2F, 0x92, 0x06, 0xDC, 0xE4, 0xA3, 0x5C, 0x5C, 0xA5, 0xDE,
+    0x48, 0xAE, 0x3A, 0x8A, 0xAA, 0x7A, 0xA7, 0x1F, 0x16, 0xC1, 0xFD, 0x6D, 0x46, 0xC3, 0x0A, 0x86,
+    0x07, 0xAD, 0x71, 0x62, 0xE1, 0xD3, 0x89, 0x4E, 0xF0, 0x94, 0xAE, 0x74, 0x39, 0x61, 0x69, 0x86,
+    0x7D, 0x8B, 0xE6, 0x6E, 0x95, 0x2F, 0xA4, 0x08, 0xDF, 0x8D, 0x52, 0x29, 0x82, 0x61, 0x81, 0x99,
+    0xFE, 0x0E, 0x1F, 0xC7, 0x3D, 0x56, 0x2F, 0x19, 0x0E, 0x37, 0xBD, 0xA4, 0xF3, 0x1E, 0x3F, 0xD1,
+    0xF9, 0x00, 0xF3, 0x4A, 0x67, 0x17, 0x9E, 0x7F, 0x03, 0x67, 0x88, 0xB3, 0x19, 0x31, 0x6C, 0xE7,
+    0x25, 0x87, 0x6D, 0x87, 0x93, 0xFA, 0x2D, 0xAC, 0x16, 0x1A, 0xA7, 0x3A, 0xC9, 0xA1, 0x36, 0xC7,
+    0x47, 0xC0, 0x81, 0x5B, 0xF7, 0xDB, 0xC2, 0x60, 0x80, 0x58, 0x31, 0xD7, 0x47, 0xF5, 0x67, 0x46,
+    0x77, 0x94, 0x6B, 0x59, 0x01, 0xAA, 0x29, 0x4E, 0x78, 0xE5, 0x61, 0x28, 0xF2, 0xE0, 0x7A, 0xCF,
+    0xC1, 0xC7, 0xA4, 0x91, 0x41, 0x78, 0x5E, 0x97, 0x53, 0x8C, 0x46, 0xF7, 0x00, 0x49, 0x68, 0x44,
+    0x19, 0x7F, 0xB8, 0x6F, 0x3E, 0xBE, 0x80, 0x8B, 0x05, 0xCE, 0x17, 0x21, 0x50, 0x79, 0x48, 0x27,
+    0xD7, 0xF8, 0x93, 0x90, 0x20, 0xD5, 0xEA, 0x6A, 0xA4, 0x4F, 0x58, 0x3A, 0xA4, 0x70, 0x17, 0x05,
+    0x67, 0x6E, 0xB8, 0x20, 0x70, 0xC3, 0x04, 0x3B, 0xD5, 0x93, 0xA8, 0x6F, 0x00, 0xBD, 0x2E, 0x66,
+    0x51, 0x71, 0xE0, 0x19, 0x58, 0x13, 0x2E, 0x40, 0x84, 0x65, 0xC5, 0x5E, 0xBA, 0x60, 0xC9, 0x10,
+    0x6D, 0x02, 0x0D, 0xE5, 0xE8, 0x00, 0xE1, 0xE4, 0x26, 0x88, 0xA5, 0x18, 0x33, 0xF5, 0xC5, 0x19,
+    0xFE, 0x4A, 0xD5, 0x99, 0x78, 0x07, 0x2C, 0xF3, 0x85, 0x72, 0x9A, 0x9F, 0x49, 0x5C, 0xF3, 0x86,
+    0x5C, 0x75, 0xAF, 0x8C, 0xBF, 0xAB, 0x9E, 0xEB, 0x97, 0x42, 0x66, 0x99, 0xD2, 0x9F, 0x81, 0x77,
+    0x01, 0x6B, 0xA6, 0x0A, 0x62, 0x5D, 0x78, 0xC9, 0x3A, 0x4D, 0x8E, 0x38, 0x46, 0x16, 0xB6, 0x1A,
+    0xF2, 0x89, 0x3C, 0x20, 0x26, 0xD0, 0xBB, 0x91, 0x3C, 0x14, 0xB6, 0x96, 0x27, 0xEE, 0x90, 0xA5,
+    0xEE, 0x9D, 0x15, 0x96, 0xA8, 0x90, 0xCC, 0x1F, 0x58, 0xF3, 0x50, 0x81, 0x2D, 0xA9, 0xEF, 0x81,
+    0x33, 0x47, 0xC4, 0x58, 0x62, 0xB6, 0xC4, 0x0D, 0x78, 0x80, 0x32, 0xF2, 0xBE, 0x4F, 0xD4, 0x60,
+    0x43, 0x08, 0xE5, 0xDF, 0x28, 0x83, 0x7E, 0xAF, 0x6B, 0x1A, 0xCA, 0x70, 0x5B, 0x4C, 0xE5, 0x88,
+    0x20, 0xEA, 0xB3, 0x00, 0xF3, 0x6A, 0x34, 0xD0, 0xCD, 0x07, 0x9D, 0x93, 0xA8, 0x17, 0xD0, 0x7F,
+    0x89, 0xD9, 0x40, 0x51, 0x2E, 0x46, 0xF3, 0x16, 0x12, 0x09, 0x22, 0xE1, 0xC3, 0xB1, 0xF1, 0xD2,
+    0xFD, 0x15, 0xA8, 0xB6, 0x89, 0xE4, 0xA3, 0xDE, 0x4F, 0x35, 0x32, 0xAA, 0x75, 0x39, 0x80, 0xE2,
+    0x0E, 0x4F, 0xA0, 0xBB, 0xF3, 0x6E, 0x4C, 0x02, 0xFE, 0x59, 0x05, 0xCA, 0xB9, 0xD9, 0x14, 0xD5,
+    0x85, 0x0E, 0x50, 0x7F, 0x9D, 0xB7, 0x82, 0x1F, 0xDA, 0x96, 0x21, 0xA8, 0xB4, 0x51, 0x1E, 0x3C,
+    0x8B, 0x2D, 0x84, 0x8C, 0x4E, 0xD0, 0x11, 0x3B, 0x66, 0x65, 0x10, 0x13, 0x12, 0xA9, 0x83, 0xDF,
+    0x98, 0x5D, 0xF7, 0xFE, 0x47, 0xBA, 0xAB, 0x5D, 0x54, 0xDC, 0x18, 0x37, 0xBD, 0xDC, 0x59, 0x66,
+    0x66, 0xD9, 0xFE, 0x10, 0x8F, 0x47, 0x94, 0x78, 0xF5, 0x55, 0x7B, 0x2B, 0xF1, 0xC8, 0x5D, 0xB0,
+    0x06, 0xFA, 0x00, 0x4E, 0x90, 0xEA, 0x56, 0x37, 0x35, 0x7D, 0xF9, 0x16, 0x0F, 0x57, 0xD3, 0xCB,
+    0x05, 0xFA, 0xFA, 0x09, 0x49, 0xE4, 0xE1, 0xB5, 0xC4, 0x22, 0xC1, 0xA1, 0x7F, 0xCC, 0x68, 0xF8,
+    0x81, 0xEB, 0x4F, 0x11, 0xC2, 0xA1, 0x46, 0x8F, 0x7E, 0x2D, 0x50, 0x71, 0xE8, 0x6A, 0xD4, 0x85,
+    0x55, 0x9D, 0xAD, 0x57, 0xEC, 0x4A, 0x37, 0x59, 0xF9, 0x6C, 0x63, 0x0C, 0x42, 0xDC, 0x1A, 0xCE,
+    0x8D, 0x1B, 0x9A, 0xF2, 0xDC, 0xD6, 0x69, 0xAC, 0x82, 0xF2, 0xC0, 0x68, 0x1D, 0x93, 0x9B, 0x9D,
+    0x8F, 0x78, 0xCC, 0xAE, 0x38, 0xB7, 0x3E, 0x61, 0xF5, 0xE9, 0xCF, 0x1C, 0x23, 0x83, 0xEB, 0xC3,
+    0x94, 0x9E, 0xD2, 0x73, 0x07, 0x2E, 0x66, 0x94, 0xC5, 0xDB, 0xC8, 0x10, 0x4A, 0x71, 0x00, 0xA8,
+    0x13, 0x19, 0xD2, 0x41, 0x9F, 0x2E, 0xC9, 0x5A, 0x41, 0xF2, 0xFA, 0x44, 0xDF, 0xC0, 0x03, 0xE4,
+    0xE3, 0xBB, 0xF7, 0x35, 0x0A, 0x64, 0x85, 0x2E, 0xE6, 0xA4, 0xAF, 0x8C, 0xA8, 0xC5, 0x66, 0xC9,
+    0x61, 0x1F, 0x2C, 0x1C, 0x60, 0x89, 0x71, 0xDB, 0x6F, 0xF3, 0x75, 0xBB, 0x14, 0x94, 0x31, 0x8B,
+    0x02, 0xCA, 0xE0, 0xE4, 0xB1, 0xE1, 0x41, 0x50, 0x55, 0x6F, 0x42, 0x81, 0x76, 0xDB, 0x1B, 0xC3,
+    0xB4, 0xE5, 0x1B, 0x37, 0xE7, 0x6D, 0xCC, 0xD0, 0x92, 0x18, 0x89, 0x28, 0x8F, 0x8C, 0xCE, 0xE6,
+    0x33, 0x46, 0x45, 0x4A, 0xE5, 0x18, 0x83, 0xAE, 0x77, 0x21, 0xFF, 0x2F, 0xA0, 0x5D, 0x05, 0x2C,
+    0x84, 0xB1, 0x48, 0x6E, 0xAB, 0x21, 0xD6, 0x81, 0x7A, 0x49, 0xB4, 0x7D, 0x2D, 0x94, 0x1C, 0x4F,
+    0x32, 0x8C, 0x6D, 0x86, 0xAD, 0x0A, 0x55, 0xEC, 0x00, 0xC9, 0x42, 0x7B, 0x1B, 0x8F, 0x6F, 0x14,
+    0xE0, 0x95, 0xDC, 0xFF, 0x0A, 0xE4, 0x9C, 0x9D, 0xB7, 0x0F, 0x51, 0x71, 0xF9, 0x0D, 0xFA, 0xCF,
+    0x42, 0x5B, 0xA3, 0x57, 0x24, 0xE3, 0xFA, 0x18, 0x24, 0x78, 0xC8, 0xA4, 0x16, 0xCE, 0x49, 0xC8,
+    0xEF, 0x88, 0xFD, 0x06, 0xD2, 0xFB, 0x85, 0x23, 0xD7, 0x98, 0xE5, 0xAC, 0x7A, 0xB6, 0xD5, 0xD0,
+    0x84, 0xCF, 0x3C, 0xAD, 0x9B, 0xEC, 0x2B, 0x71, 0xFF, 0x15, 0xE0, 0x68, 0xB3, 0x24, 0xD9, 0x50,
+    0x56, 0x2E, 0xB7, 0x8F, 0xFD, 0x38, 0x05, 0xE6, 0xCB, 0x8F, 0x46, 0xB6, 0x6C, 0x22, 0x34, 0x1D,
+    0x5B, 0xCD, 0x62, 0x5B, 0x3D, 0x94, 0x47, 0xCC, 0xC1, 0x27, 0x0B, 0x5A, 0x80, 0x29, 0x64, 0xA4,
+    0x65, 0xCF, 0x00, 0xC0, 0xC5, 0xC6, 0x34, 0x49, 0x1B, 0xB4, 0x06, 0xF4, 0x81, 0xA5, 0x73, 0xC0,
+    0xCE, 0x61, 0x96, 0xD0, 0x11, 0x8A, 0x67, 0xE8, 0x73, 0x6B, 0x5C, 0xFF, 0x78, 0xEF, 0x85, 0xDE,
+    0xEA, 0x17, 0x87, 0xC5, 0xBF, 0x5D, 0xFF, 0x00, 0xBD, 0x54, 0x31, 0x72, 0xD5, 0x30, 0x10, 0x5D,
+    0x59, 0xF3, 0xE3, 0x19, 0x54, 0xA8, 0x09, 0x0D, 0x8D, 0x1B, 0x6A, 0x7C, 0x83, 0xC8, 0x47, 0xF8,
+    0x45, 0x52, 0x71, 0x18, 0x9B, 0xE1, 0x02, 0x1C, 0x21, 0x25, 0xE3, 0x26, 0x27, 0x00, 0xBB, 0xA3,
+    0xA0, 0x31, 0x43, 0x91, 0xD6, 0x05, 0xA1, 0x80, 0x02, 0x0D, 0x63, 0x66, 0x9C, 0x20, 0x7B, 0x79,
+    0x2B, 0xF9, 0x27, 0x29, 0x69, 0xF2, 0xE5, 0x6F, 0xCD, 0xB7, 0x56, 0xDA, 0x7D, 0xFB, 0xF6, 0xAD,
+    0x88, 0xD4, 0x05, 0x11, 0x95, 0x81, 0x28, 0xE3, 0x19, 0x7F, 0xAE, 0x27, 0xD2, 0x21, 0xF7, 0xB4,
+    0xAB, 0x76, 0x15, 0xC5, 0x51, 0xF0, 0x37, 0x32, 0x0C, 0x23, 0x33, 0xF7, 0x96, 0x7F, 0xAC, 0xD4,
+    0x4D, 0xF4, 0x32, 0x67, 0x98, 0x9C, 0x27, 0x52, 0xDC, 0x10, 0x99, 0x20, 0x5F, 0xE3, 0xB3, 0xF6,
+    0x92, 0x9B, 0x9A, 0xDF, 0x2E, 0x19, 0x2F, 0xC5, 0x64, 0xD8, 0xD7, 0x03, 0xD5, 0x3D, 0x57, 0xD9,
+    0xAA, 0x57, 0xB2, 0x93, 0x5D, 0xC8, 0xF5, 0xC5, 0xFA, 0x9A, 0xA9, 0x64, 0x0E, 0x32, 0x8D, 0xF0,
+    0x7E, 0x8B, 0xA3, 0x7B, 0x09, 0xF4, 0x1C, 0x01, 0x1D, 0x1C, 0x39, 0x78, 0x74, 0x9F, 0x3C, 0xB9,
+    0xA6, 0x7B, 0x80, 0x51, 0xFB, 0x8F, 0x54, 0xB3, 0x83, 0x77, 0x1E, 0xDC, 0x6D, 0xE7, 0x8B, 0xC9,
+    0x06, 0x1B, 0xE0, 0x78, 0xA1, 0xEE, 0x0D, 0x93, 0x1B, 0xBA, 0xDE, 0xFA, 0xD2, 0xE7, 0xC1, 0x04,
+    0xBD, 0x66, 0x9C, 0x71, 0xD5, 0x7D, 0xE7, 0xBE, 0x60, 0xF6, 0x9A, 0xFF, 0x22, 0xD6, 0xEF, 0x15,
+    0x4E, 0x58, 0x22, 0xF4, 0x82, 0x3B, 0xBF, 0xE9, 0x26, 0x25, 0x49, 0xD5, 0x78, 0x4F, 0x80, 0x03,
+    0xE3, 0x1C, 0x30, 0xB4, 0x37, 0x3D, 0x99, 0x3B, 0x96, 0xB4, 0xBD, 0x4C, 0x58, 0x57, 0x1B, 0x11,
+    0x47, 0x63, 0x62, 0x87, 0x47, 0x8F, 0xB6, 0x27, 0xBE, 0x1A, 0x23, 0x8E, 0x4C, 0x00, 0x1E, 0xEA,
+    0x71, 0x04, 0x26, 0xE2, 0x30, 0x5E, 0x32, 0x19, 0x24, 0x2F, 0x6C, 0xD6, 0x33, 0x3D, 0x1A, 0x47,
+    0xD3, 0x84, 0x0C, 0x0B, 0x8F, 0xF9, 0x22, 0x5E, 0xC5, 0x61, 0xF5, 0x80, 0xE2, 0x48, 0x4C, 0x28,
+    0x5E, 0x2B, 0xEA, 0x98, 0x1B, 0x2B, 0x08, 0x79, 0xBD, 0x1A, 0x0D, 0xE0, 0x57, 0x35, 0x60, 0x69,
+    0x81, 0x54, 0x08, 0x35, 0x1D, 0x5C, 0x20, 0xA1, 0xB6, 0xB5, 0x73, 0xCE, 0xB3, 0x1B, 0x4A, 0xFE,
+    0x82, 0x70, 0x0C, 0xDC, 0x79, 0xB0, 0x13, 0x95, 0xA3, 0x1B, 0x11, 0x8A, 0x07, 0x1D, 0x14, 0xDF,
+    0x74, 0x3E, 0x13, 0xE2, 0x30, 0xAD, 0xF0, 0xCE, 0xEF, 0xA4, 0xE4, 0x07, 0xD6, 0x27, 0x4A, 0x78,
+    0x94, 0xD0, 0x67, 0x07, 0xE9, 0x8B, 0x84, 0x02, 0x7C, 0x64, 0xF3, 0xB6, 0x2E, 0xC0, 0xBB, 0x2A,
+    0xB5, 0x0C, 0x45, 0xD2, 0x9F, 0x9C, 0x89, 0x78, 0x4F, 0x28, 0xF9, 0xAF, 0xC0, 0x02, 0xA9, 0xD5,
+    0x35, 0xA4, 0x16, 0x3D, 0x49, 0xDF, 0x9C, 0x6E, 0xE0, 0x41, 0xCB, 0x22, 0x92, 0xE1, 0xAA, 0xF0,
+    0x28, 0x32, 0x14, 0x50, 0x7A, 0x90, 0x62, 0xA0, 0x93, 0x4A, 0x27, 0x0B, 0x25, 0xCB, 0xDA, 0x76,
+    0x08, 0xBD, 0x29, 0x08, 0x16, 0xCC, 0x74, 0x7F, 0x66, 0x14, 0x65, 0x6C, 0x67, 0xEA, 0x5E, 0x1D,
+    0x2C, 0xB3, 0x58, 0x16, 0x68, 0x26, 0x59, 0x68, 0x77, 0x0E, 0x82, 0x50, 0x00, 0x03, 0x50, 0xE6,
+    0x0F, 0x0C, 0xBE, 0xE8, 0xD5, 0x5E, 0xED, 0x0F, 0x58, 0x52, 0x36, 0x38, 0x2B, 0x00, 0xA4, 0x38,
+    0xDB, 0xE2, 0xE7, 0x85, 0x8A, 0x5F, 0x3C, 0x40, 0xBF, 0x41, 0xF3, 0x35, 0x13, 0xF7, 0x75, 0x5F,
+    0x8F, 0x38, 0x2D, 0xFC, 0xCC, 0x91, 0x34, 0x54, 0x0A, 0x68, 0xEB, 0x03, 0x69, 0x8F, 0x16, 0xB1,
+    0x57, 0x3C, 0xC6, 0x24, 0x13, 0x8E, 0x3C, 0x20, 0x86, 0xE4, 0x02, 0x7D, 0xCB, 0xEC, 0x6B, 0x8E,
+    0x5D, 0xE1, 0x65, 0x53, 0x84, 0x9F, 0x71, 0x7B, 0x15, 0x00, 0x55, 0xB4, 0x2D, 0x99, 0x56, 0x92,
+    0x74, 0x48, 0x07, 0xC1, 0x90, 0x68, 0x87, 0x1B, 0xE0, 0x4B, 0xC9, 0xC5, 0x64, 0xB1, 0x96, 0xE1,
+    0x60, 0xE4, 0x0E, 0x6B, 0x10, 0x4F, 0x8A, 0x98, 0xAA, 0x3D, 0xC4, 0xD4, 0x4C, 0xEC, 0xBD, 0xF4,
+    0x46, 0x1B, 0xAB, 0x4A, 0x71, 0x39, 0x65, 0x2B, 0x2F, 0xC0, 0xB3, 0x6A, 0xFE, 0xCA, 0x9A, 0x15,
+    0x34, 0xA8, 0xD8, 0x40, 0x0C, 0x76, 0xD6, 0x8B, 0xF5, 0x7A, 0x01, 0xDA, 0x20, 0x69, 0x95, 0xA3,
+    0x81, 0x50, 0xED, 0xE4, 0x80, 0x35, 0x65, 0x25, 0x8A, 0x1B, 0x5F, 0x91, 0x5B, 0x3F, 0x40, 0xEF,
+    0x81, 0x26, 0x60, 0xDB, 0xAB, 0xAD, 0xD7, 0x80, 0xBD, 0xC3, 0x2B, 0xB1, 0x0A, 0x90, 0x0F, 0x50,
+    0xB1, 0x31, 0xE5, 0x58, 0x29, 0x84, 0x8C, 0xF7, 0xB8, 0x04, 0x3E, 0x75, 0xB8, 0x01, 0xE4, 0x16,
+    0x00, 0x2E, 0xE9, 0x5B, 0x79, 0xE5, 0x7A, 0x70, 0x9B, 0x9B, 0x8E, 0x87, 0xE8, 0x76, 0xCD, 0x3C,
+    0xDF, 0x4D, 0x08, 0x76, 0x66, 0xC2, 0x2E, 0xE9, 0x48, 0x87, 0xB8, 0x1B, 0xA4, 0xC0, 0x27, 0xC2,
+    0xE4, 0xDB, 0x77, 0x23, 0xFE, 0xD3, 0x77, 0xF6, 0xF0, 0xED, 0xE5, 0x9B, 0xE8, 0x45, 0x7B, 0x09,
+    0x9F, 0x3D, 0xD2, 0xA6, 0xDD, 0xC5, 0x79, 0xEA, 0x5A, 0x6E, 0x0C, 0xFA, 0xCB, 0xE1, 0xFE, 0x14,
+    0xC0, 0x02, 0x4E, 0x40, 0x84, 0x84, 0x17, 0xD8, 0x44, 0x43, 0x92, 0x02, 0xE0, 0x82, 0x68, 0x51,
+    0x9C, 0x6C, 0x52, 0xDB, 0x26, 0xB4, 0xB7, 0x85, 0x3C, 0x01, 0x36, 0x93, 0x8A, 0x9D, 0xB4, 0xEF,
+    0x2D, 0x07, 0xFC, 0x76, 0x17, 0x51, 0x60, 0x4C, 0xB1, 0xB0, 0x94, 0xCA, 0x96, 0xC7, 0x6A, 0xA6,
+    0x5A, 0xA5, 0x12, 0x22, 0x46, 0x19, 0x8B, 0x06, 0x42, 0x84, 0x8F, 0x53, 0x3C, 0x67, 0x14, 0xC8,
+    0xFD, 0xC4, 0x65, 0x00, 0x48, 0x46, 0xC8, 0xD9, 0x3F, 0x29, 0xB7, 0xFF, 0x33, 0xFE, 0x01, 0x8D,
+    0x54, 0x3B, 0x8E, 0xD4, 0x40, 0x10, 0x2D, 0xDB, 0x5A, 0x1C, 0x38, 0xE8, 0x84, 0x8D, 0x7D, 0x04,
+    0x1F, 0xA1, 0x2D, 0x71, 0x81, 0x4D, 0xB8, 0x04, 0x97, 0xB0, 0x25, 0x32, 0x22, 0x6E, 0x00, 0x21,
+    0x5A, 0x82, 0x3D, 0x01, 0xD8, 0xD2, 0x86, 0x04, 0x6B, 0xC1, 0x05, 0x3A, 0x20, 0x22, 0xB2, 0x90,
+    0x03, 0x03, 0xB6, 0x8B, 0xF7, 0xAA, 0xC7, 0xE3, 0x41, 0x8B, 0x10, 0xD6, 0xEC, 0xEC, 0xB4, 0xBB,
+    0x3E, 0xAF, 0x5E, 0xBD, 0xAA, 0x2B, 0xB9, 0xCA, 0x82, 0xEB, 0xF5, 0x2E, 0x54, 0x3A, 0xA6, 0x1A,
+    0xE4, 0x4A, 0xF8, 0x64, 0x8B, 0x24, 0x2A, 0xD2, 0xF5, 0xE2, 0x83, 0xB8, 0x49, 0xF2, 0xD3, 0xB9,
+    0x15, 0x3F, 0x9C, 0xCE, 0xE9, 0x71, 0x1E, 0x79, 0x16, 0x69, 0x34, 0x14, 0xBA, 0x89, 0x6A, 0x9F,
+    0xA8, 0x59, 0x09, 0x4C, 0xCA, 0xD1, 0x2C, 0x11, 0x26, 0x5B, 0xF1, 0xAF, 0x37, 0x53, 0xF8, 0xB9,
+    0x19, 0xD7, 0x35, 0xAF, 0x19, 0xB8, 0x19, 0xC5, 0x47, 0xEF, 0x0E, 0xAE, 0xC5, 0x20, 0xD9, 0x28,
+    0xF2, 0x41, 0xC4, 0xF5, 0xB0, 0x7A, 0x2D, 0x8E, 0xAE, 0x83, 0xEC, 0x4F, 0xBA, 0x48, 0xBE, 0x32,
+    0x50, 0x36, 0x9F, 0xDE, 0x00, 0x02, 0x22, 0x55, 0x23, 0xF3, 0xC0, 0xB0, 0xE9, 0xF9, 0x41, 0x16,
+    0x64, 0xD0, 0x1A, 0x09, 0x00, 0x21, 0xDD, 0x88, 0x00, 0x85, 0x11, 0xFB, 0x24, 0x6E, 0x90, 0xAA,
+    0x16, 0x8F, 0xB8, 0x5F, 0xA5, 0x9A, 0xA5, 0x98, 0xCE, 0xD1, 0x0B, 0x42, 0x32, 0x64, 0xB2, 0xED,
+    0xEF, 0x72, 0x43, 0x16, 0x9C, 0x2E, 0x52, 0xAE, 0x06, 0xDC, 0x45, 0xE0, 0x48, 0x99, 0x6D, 0x06,
+    0x0E, 0x91, 0x99, 0xB4, 0x60, 0x5D, 0x2D, 0xAB, 0x4F, 0x62, 0xF5, 0xB9, 0x4A, 0x16, 0xBD, 0x0B,
+    0xA5, 0x2B, 0x8C, 0xAA, 0xD1, 0xCD, 0xD9, 0x9A, 0xD8, 0xCF, 0xE0, 0x26, 0xFB, 0xD9, 0xC5, 0x9F,
+    0x8B, 0xB1, 0xA1, 0xA1, 0x44, 0x33, 0xB4, 0xED, 0x7A, 0x64, 0x44, 0xFC, 0x5C, 0x6B, 0x04, 0xC4,
+    0x07, 0xFC, 0x79, 0xB0, 0xCB, 0xD8, 0x48, 0x54, 0x2C, 0x56, 0x6F, 0x88, 0x65, 0x92, 0x8F, 0x85,
+    0x80, 0x90, 0x14, 0xA5, 0x77, 0x2D, 0xCB, 0xDD, 0x08, 0x14, 0x8E, 0xC6, 0x48, 0x6A, 0x8E, 0x60,
+    0xBE, 0x84, 0xE3, 0x00, 0x54, 0x38, 0x55, 0x3A, 0xC3, 0x11, 0xAC, 0x57, 0x81, 0x85, 0x22, 0x92,
+    0x30, 0xAE, 0xC8, 0x0B, 0x05, 0x01, 0x89, 0xAA, 0x55, 0x4F, 0x76, 0xCA, 0x33, 0x1B, 0xF1, 0xE9,
+    0x00, 0x25, 0x5F, 0x11, 0xB3, 0x1C, 0x09, 0xA4, 0x75, 0x47, 0x83, 0x70, 0x53, 0x8E, 0x2C, 0xAA,
+    0x2D, 0x08, 0xDF, 0xA3, 0x32, 0x44, 0x6E, 0xFA, 0x9C, 0xE5, 0xC1, 0x7C, 0xC6, 0x0D, 0x00, 0xAC,
+    0x60, 0xC3, 0x4D, 0x48, 0x4F, 0x4A, 0x10, 0x48, 0xDB, 0x02, 0xBC, 0x00, 0x1A, 0x30, 0x93, 0x9C,
+    0x7C, 0xA1, 0x74, 0x4C, 0x2A, 0xD6, 0x7E, 0x9E, 0xD2, 0x3B, 0x9C, 0x9C, 0x42, 0x17, 0x7E, 0x15,
+    0x13, 0x07, 0x9E, 0xE4, 0x39, 0xBE, 0xAA, 0x95, 0x16, 0x80, 0x5E, 0x7D, 0x99, 0x21, 0x11, 0x28,
+    0xE8, 0xAA, 0x4E, 0xEA, 0x88, 0x27, 0xD9, 0x2E, 0xE3, 0x88, 0x15, 0xC5, 0x22, 0xC1, 0x96, 0xB5,
+    0xCB, 0xC4, 0x69, 0x2D, 0x27, 0x53, 0xD4, 0xCA, 0x85, 0x39, 0x5B, 0x12, 0x39, 0xF1, 0xE1, 0x44,
+    0x11, 0x9B, 0x1D, 0xCD, 0x31, 0x22, 0xA6, 0x00, 0xD3, 0xBB, 0x00, 0xD7, 0x93, 0x3B, 0x9C, 0x2A,
+    0x92, 0xD7, 0x11, 0xAE, 0x86, 0x83, 0x95, 0x6B, 0x78, 0xE2, 0x22, 0x03, 0x9D, 0xEE, 0x3B, 0x29,
+    0xFB, 0x28, 0x4F, 0xE5, 0x3A, 0xDE, 0x69, 0xCC, 0xC3, 0x12, 0x19, 0x8E, 0x78, 0x98, 0x84, 0x28,
+    0x29, 0x29, 0x82, 0x61, 0x06, 0xE6, 0xE4, 0x1F, 0xBB, 0x45, 0x6C, 0xFC, 0x23, 0x62, 0xC2, 0x40,
+    0x1D, 0x14, 0xEE, 0x7B, 0x0E, 0x26, 0x42, 0x74, 0x70, 0xE9, 0x06, 0xAB, 0x01, 0x51, 0x1D, 0x08,
+    0xAE, 0xC9, 0x7F, 0x9B, 0x2A, 0xBE, 0x60, 0x0C, 0xAC, 0x7E, 0xC0, 0x97, 0x1B, 0x95, 0x53, 0x09,
+    0xD3, 0x74, 0x6B, 0x10, 0x56, 0x3B, 0xC6, 0x66, 0xCB, 0x1D, 0x74, 0x8B, 0xE6, 0xE3, 0x3A, 0x55,
+    0x1B, 0xE7, 0x67, 0x9C, 0xE4, 0x01, 0xB9, 0x4A, 0x28, 0x18, 0x3E, 0x99, 0x8D, 0x55, 0x33, 0x80,
+    0x13, 0x9C, 0x7D, 0x6F, 0xED, 0x3A, 0x1E, 0x02, 0x93, 0x8A, 0x5F, 0xA6, 0x8D, 0x82, 0x54, 0x24,
+    0x37, 0xFB, 0xAD, 0x51, 0x0E, 0x41, 0xC7, 0x4E, 0x40, 0xB1, 0x91, 0x71, 0xD2, 0xEB, 0xC6, 0x1C,
+    0xDA, 0x04, 0xCC, 0x2A, 0x34, 0x21, 0x5B, 0x19, 0xFB, 0x1E, 0x53, 0xB0, 0x00, 0x37, 0x66, 0x43,
+    0x0A, 0x76, 0x59, 0xB9, 0x63, 0x94, 0x8A, 0x7E, 0x33, 0xA1, 0x8F, 0xDA, 0xA7, 0x5B, 0x4E, 0xED,
+    0xF8, 0x91, 0x43, 0x04, 0xB1, 0xB9, 0xF9, 0x40, 0x62, 0xFD, 0x6A, 0x18, 0x19, 0x18, 0x12, 0x1E,
+    0xAE, 0x23, 0xE9, 0x0D, 0x26, 0xAD, 0x9C, 0xD3, 0x8D, 0x2A, 0x1D, 0xB4, 0xCD, 0x16, 0x0E, 0xD4,
+    0x03, 0x6A, 0xFB, 0x45, 0x06, 0xC9, 0x8E, 0x0D, 0x2D, 0xBA, 0x56, 0xFE, 0xD0, 0x1A, 0x34, 0x60,
+    0xC2, 0x42, 0x03, 0xE9, 0xA2, 0x74, 0x88, 0x9C, 0xE2, 0xA5, 0x7C, 0xAE, 0x6F, 0xE2, 0xD4, 0x93,
+    0xF2, 0x5A, 0xF2, 0x49, 0xF6, 0xB6, 0x92, 0x36, 0xD4, 0xC8, 0xD6, 0x52, 0x41, 0x14, 0x10, 0x0A,
+    0x24, 0x1C, 0x76, 0x11, 0x45, 0xB3, 0xD9, 0x97, 0x46, 0x73, 0xEC, 0x29, 0x8C, 0x48, 0x4B, 0xF9,
+    0xF3, 0xB6, 0xED, 0x54, 0x33, 0xD5, 0xD9, 0xB1, 0x60, 0x4A, 0x08, 0x49, 0xA8, 0xCF, 0xA6, 0x35,
+    0x56, 0x6F, 0xCE, 0x5C, 0xEE, 0xBB, 0xB5, 0xDF, 0x77, 0xEB, 0xBE, 0xA2, 0xC2, 0xBE, 0xA2, 0xF2,
+    0x8B, 0x15, 0x55, 0xEF, 0x2B, 0xEA, 0xD1, 0x06, 0xFB, 0x63, 0x9B, 0x2D, 0xFB, 0x36, 0xDB, 0x77,
+    0xF9, 0xF6, 0xB7, 0x5D, 0x3E, 0x1D, 0xBB, 0xFC, 0xF6, 0x5D, 0xA5, 0x7A, 0x0F, 0xBC, 0x5E, 0xB5,
+    0xDE, 0x37, 0xEA, 0xC9, 0xBD, 0x97, 0xEC, 0x60, 0xE6, 0xBC, 0x8C, 0x91, 0x03, 0x80, 0xB9, 0xDF,
+    0xE2, 0x12, 0x0F, 0xFF, 0x58, 0xE2, 0xD9, 0xC5, 0x12, 0x3F, 0xC7, 0xA6, 0x1F, 0xB4, 0x5C, 0x5B,
+    0x64, 0x3F, 0x34, 0xB5, 0x1B, 0xB1, 0x99, 0x16, 0x07, 0xD9, 0x43, 0x72, 0xFA, 0xD2, 0xA2, 0xD1,
+    0xCA, 0xBC, 0x6C, 0xB6, 0xD9, 0xB3, 0xC7, 0x2F, 0xEB, 0xF8, 0x92, 0x9D, 0xC9, 0xB7, 0xDB, 0xB7,
+    0xD8, 0xC0, 0xE8, 0x2E, 0x66, 0xE0, 0x28, 0xC5, 0x7F, 0x86, 0xC4, 0xEE, 0x67, 0x69, 0x3E, 0x61,
+    0xC7, 0x3E, 0xF4, 0xA2, 0xAF, 0x6A, 0x73, 0xDB, 0xA7, 0x77, 0x3B, 0xA6, 0x37, 0xBF, 0x9C, 0xDE,
+    0xE9, 0x98, 0x5E, 0xAE, 0x1C, 0xBF, 0x4F, 0x6F, 0x7F, 0x30, 0xCE, 0x18, 0xB4, 0xE7, 0x3D, 0xE0,
+    0x31, 0x04, 0xD1, 0xE1, 0x1A, 0xC2, 0x9E, 0xDC, 0xEC, 0x03, 0x05, 0xAA, 0xE9, 0x62, 0x46, 0x27,
+    0x1D, 0xAD, 0x31, 0x66, 0xF3, 0xED, 0x96, 0x60, 0x21, 0x91, 0x70, 0x41, 0xFB, 0xFF, 0x3C, 0xBF,
+    0x01, 0xC5, 0x55, 0xB1, 0x8E, 0xED, 0x34, 0x10, 0x9D, 0xC4, 0xAC, 0x5C, 0xA4, 0x30, 0xC5, 0xDB,
+    0xE6, 0x51, 0xA4, 0xA7, 0xF1, 0x1F, 0xE0, 0x48, 0x14, 0x94, 0x50, 0xEC, 0x56, 0x14, 0xEF, 0x13,
+    0xF6, 0x0F, 0x70, 0x24, 0x0A, 0x7E, 0x83, 0x7A, 0x1B, 0x3E, 0xC1, 0xD6, 0x7B, 0x25, 0x05, 0x41,
+    0x14, 0x14, 0x14, 0x64, 0x05, 0x12, 0xC5, 0x16, 0x6B, 0x44, 0x8A, 0xBC, 0x5D, 0x27, 0xC3, 0x99,
+    0xC9, 0xBD, 0xD2, 0xDB, 0xD7, 0x21, 0x24, 0xF0, 0x2A, 0xBE, 0x77, 0xED, 0xC9, 0xCC, 0x9C, 0x33,
+    0x67, 0xE6, 0x12, 0x11, 0x99, 0x8D, 0x28, 0x64, 0xB2, 0x95, 0x28, 0x65, 0x72, 0x2B, 0x11, 0x0F,
+    0xE4, 0x0A, 0x35, 0x4C, 0xE4, 0x67, 0x32, 0x3B, 0xAE, 0x7F, 0xDC, 0x6C, 0x0D, 0x73, 0x7C, 0xB3,
+    0x77, 0xAB, 0xCF, 0x72, 0xBD, 0x1C, 0xD7, 0xE5, 0xB8, 0x9E, 0xC8, 0xE0, 0xED, 0x98, 0xE1, 0xAD,
+    0x5B, 0xD4, 0x9B, 0xDC, 0x76, 0x55, 0x1D, 0x88, 0x3B, 0x53, 0x07, 0xEA, 0x79, 0xA4, 0xC4, 0x64,
+    0x78, 0x25, 0xCF, 0xD4, 0xF1, 0x24, 0x1F, 0x14, 0x10, 0x2F, 0x4E, 0x6A, 0x24, 0x19, 0xF4, 0x8F,
+    0xB7, 0x63, 0x62, 0x36, 0xCC, 0xAB, 0x63, 0x98, 0x60, 0xA5, 0x11, 0x19, 0x22, 0x60, 0xC8, 0x70,
+    0xDA, 0xAD, 0x12, 0x8D, 0x25, 0x6C, 0xBF, 0x53, 0xAA, 0x96, 0xEF, 0x78, 0xED, 0x38, 0xBB, 0x9D,
+    0xFC, 0xE9, 0x0A, 0x6E, 0x10, 0x95, 0x07, 0xC1, 0x85, 0xD5, 0x5C, 0xCB, 0xDE, 0x2F, 0xB2, 0x23,
+    0x08, 0x09, 0x34, 0xF1, 0xAA, 0x77, 0x5F, 0xD0, 0x69, 0xB9, 0x8D, 0xDA, 0x2A, 0xC9, 0xB8, 0xD2,
+    0x70, 0x41, 0x2C, 0xE4, 0xD7, 0xEC, 0x14, 0x78, 0x04, 0x20, 0x66, 0x1C, 0x98, 0xA7, 0x0D, 0xCE,
+    0xFB, 0x5F, 0x56, 0xBB, 0x52, 0xFA, 0xBC, 0xF8, 0xD9, 0xD4, 0x90, 0xD3, 0xE0, 0x4A, 0xFA, 0xBA,
+    0x52, 0x1C, 0x19, 0x2F, 0xEE, 0xA6, 0x46, 0xD8, 0x77, 0x6F, 0x37, 0xD8, 0xF7, 0x4F, 0x05, 0xF6,
+    0x81, 0xB3, 0xD8, 0x33, 0xF9, 0xA9, 0x01, 0xF0, 0x04, 0xF8, 0x13, 0xB8, 0xEA, 0x58, 0xD2, 0xE8,
+    0xAB, 0x84, 0x96, 0xFC, 0x40, 0xBC, 0xD2, 0x17, 0xE4, 0x19, 0x89, 0x2E, 0x06, 0xCD, 0xCA, 0x94,
+    0x34, 0x35, 0x35, 0x6D, 0x94, 0x12, 0xE7, 0xB0, 0xC5, 0xE2, 0xAA, 0xAD, 0x80, 0xCE, 0x60, 0x22,
+    0xE6, 0x34, 0xFA, 0x39, 0x4C, 0x6E, 0x71, 0xC5, 0xA0, 0x3C, 0xC4, 0xED, 0x7B, 0x87, 0xB0, 0x95,
+    0x32, 0x84, 0x85, 0x3A, 0xA4, 0x32, 0xC3, 0xB9, 0xE5, 0x8C, 0x9C, 0x3C, 0x0F, 0xC8, 0x89, 0xC1,
+    0xD8, 0x64, 0x18, 0xEF, 0x91, 0x7B, 0x58, 0x90, 0x53, 0xBC, 0x99, 0xFB, 0xB9, 0xDD, 0x00, 0x6A,
+    0x74, 0x85, 0x5B, 0x60, 0x78, 0xBD, 0x1F, 0xA0, 0xF0, 0xE2, 0xEA, 0xFE, 0x14, 0x7B, 0xFF, 0x07,
+    0xD8, 0xA0, 0xF8, 0x90, 0x61, 0x0F, 0x56, 0x60, 0x0F, 0x07, 0x69, 0xB0, 0x3C, 0x83, 0x3D, 0xC7,
+    0x60, 0x83, 0x7C, 0x15, 0x14, 0xB1, 0xD0, 0xB3, 0xC5, 0xB2, 0x59, 0x2D, 0x82, 0xE0, 0xA3, 0x46,
+    0xA1, 0x37, 0xC3, 0xF9, 0x3E, 0x74, 0x1B, 0xF5, 0xDF, 0xF3, 0xD4, 0x3D, 0x71, 0x35, 0xFC, 0x33,
+    0x13, 0xE7, 0x98, 0xC3, 0xEC, 0x4A, 0x5F, 0x6C, 0xED, 0xD6, 0x76, 0x47, 0x35, 0x79, 0x00, 0x9F,
+    0x53, 0xCC, 0xAE, 0xF8, 0xF7, 0x0E, 0x61, 0xDB, 0x97, 0xE7, 0xC1, 0xE2, 0x70, 0x44, 0xEA, 0xF3,
+    0x99, 0xCD, 0x0B, 0xFD, 0x8C, 0x8D, 0xC8, 0x22, 0x79, 0x91, 0x16, 0xCB, 0xD7, 0x56, 0x55, 0x76,
+    0xA8, 0xE4, 0x7F, 0x55, 0xC2, 0xC5, 0x00, 0x3A, 0x12, 0x62, 0x9B, 0x15, 0x00, 0x7A, 0x94, 0x8A,
+    0x10, 0x9F, 0x9A, 0xAB, 0x53, 0x5E, 0xAF, 0x79, 0x50, 0x2D, 0xF8, 0x07, 0x2E, 0x4A, 0x51, 0x00,
+    0x39, 0x22, 0x06, 0x12, 0xF4, 0x42, 0x07, 0xC8, 0x40, 0xE9, 0xA1, 0x86, 0x46, 0xD2, 0x14, 0x92,
+    0x70, 0x96, 0x46, 0x91, 0x83, 0xD4, 0x4B, 0xED, 0x08, 0x47, 0xA4, 0xED, 0x4A, 0x48, 0x87, 0x44,
+    0x1A, 0xF0, 0x8D, 0x2E, 0x25, 0xFF, 0x06, 0x6A, 0x0B, 0x9F, 0xFD, 0xC5, 0xCB, 0xA5, 0x54, 0x01,
+    0xE5, 0x7C, 0x85, 0x0D, 0x22, 0xA2, 0x7E, 0x95, 0xAD, 0x68, 0x63, 0x69, 0x03, 0x6A, 0x37, 0x22,
+    0x6D, 0x75, 0x98, 0x46, 0x6C, 0x3C, 0x6A, 0xCF, 0x69, 0x03, 0x6A, 0xA3, 0x42, 0xCD, 0xA1, 0xA8,
+    0xF0, 0xA6, 0x43, 0x78, 0xE0, 0x10, 0xFD, 0x0E, 0x09, 0xBC, 0x2B, 0xBC, 0x7B, 0x15, 0xDE, 0x2B,
+    0x11, 0xDE, 0x99, 0xC3, 0x4F, 0x45, 0x3F, 0xE0, 0x90, 0x0E, 0xE1, 0x2D, 0xF6, 0xAD, 0xD8, 0xBB,
+    0xA7, 0x45, 0x95, 0x2B, 0xC2, 0x8B, 0x22, 0x3C, 0x02, 0x87, 0x71, 0x68, 0x55, 0x78, 0x46, 0x85,
+    0xE7, 0x54, 0x78, 0x87, 0x0E, 0xE2, 0x78, 0x1A, 0x6C, 0x74, 0x99, 0x84, 0x43, 0x96, 0xCE, 0xB7,
+    0x2C, 0xFA, 0xEB, 0xF7, 0x67, 0xC2, 0x54, 0xE1, 0xFD, 0xF0, 0x2F, 0x85, 0x27, 0x93, 0x4B, 0x79,
+    0x45, 0x98, 0x97, 0x28, 0x9C, 0x0C, 0x37, 0xA4, 0x06, 0x9D, 0x89, 0xB6, 0x3E, 0xBE, 0x45, 0x36,
+    0x49, 0x64, 0xC6, 0x52, 0xD4, 0xEB, 0xEB, 0x93, 0xEA, 0x1B, 0x14, 0x13, 0x2C, 0xE3, 0x2C, 0x30,
+    0x2A, 0xCD, 0x8F, 0x69, 0x31, 0x3C, 0xF6, 0xD5, 0xEE, 0x18, 0x9D, 0x40, 0x63, 0x37, 0x4C, 0x2D,
+    0xB3, 0xC9, 0x90, 0xDD, 0xC2, 0x2C, 0xDB, 0x84, 0x48, 0xD8, 0xBA, 0x8A, 0x89, 0xE9, 0x74, 0x5B,
+    0xF1, 0xAF, 0x2F, 0xB8, 0x8D, 0x73, 0x58, 0x1A, 0xCE, 0xFD, 0xFE, 0x25, 0xC8, 0x60, 0x70, 0x8C,
+    0x11, 0x0A, 0xB8, 0x91, 0x85, 0x09, 0x19, 0x73, 0x2F, 0x6F, 0xBF, 0x95, 0xF8, 0x38, 0xA6, 0x8B,
+    0xEB, 0x63, 0xEE, 0xA5, 0x15, 0x32, 0xC3, 0x8C, 0xE0, 0xEA, 0xB6, 0x9B, 0x05, 0xC5, 0xFF, 0x0D,
+    0x72, 0xF9, 0xB5, 0xB4, 0x1C, 0x73, 0xF7, 0x08, 0xC9, 0xDF, 0x63, 0x4A, 0xDC, 0xCC, 0xB6, 0xA6,
+    0x1C, 0xEE, 0xF8, 0x1B, 0x1D, 0xCA, 0x78, 0xC6, 0x96, 0x7F, 0x27, 0xFA, 0x50, 0x1C, 0x5C, 0x89,
+    0xE7, 0xDA, 0x82, 0x01, 0xFE, 0x6E, 0x96, 0x60, 0xF9, 0xCC, 0xEF, 0x79, 0xB0, 0xFE, 0xB7, 0x18,
+    0x5F, 0xE0, 0xEF, 0x13, 0x82, 0x0E, 0xEE, 0x17, 0x68, 0x05, 0xF2, 0x93, 0x9B, 0x53, 0x2A, 0x7E,
+    0x17, 0x19, 0x40, 0x89, 0x5C, 0x04, 0xAD, 0x5F, 0xE0, 0x77, 0x46, 0x94, 0xAC, 0xCF, 0x8A, 0xA1,
+    0x27, 0xCF, 0x22, 0x6A, 0x06, 0xDE, 0x39, 0xDE, 0x61, 0xE2, 0x02, 0xAC, 0x43, 0x18, 0x05, 0xFC,
+    0x81, 0x7A, 0xB9, 0xBA, 0x94, 0xB9, 0xF2, 0x13, 0xEA, 0xED, 0x16, 0x74, 0x69, 0x5B, 0x3D, 0x20,
+    0x7F, 0x65, 0x67, 0x99, 0x65, 0x2F, 0xCE, 0x9A, 0xFA, 0x48, 0x6A, 0xAD, 0xA0, 0x91, 0x20, 0xAC,
+    0x04, 0x35, 0x26, 0x0A, 0x52, 0x57, 0xD8, 0x90, 0x18, 0x7E, 0xF2, 0x14, 0x77, 0x2B, 0xF3, 0x79,
+    0x52, 0xE0, 0xA2, 0x56, 0x28, 0x4F, 0x90, 0x5B, 0x7C, 0x85, 0x0C, 0x05, 0x3A, 0x4E, 0x61, 0xA3,
+    0xD8, 0xA1, 0x72, 0x8C, 0x09, 0x05, 0x8F, 0x42, 0x42, 0x5D, 0x07, 0x7A, 0xCB, 0xEB, 0xBB, 0x84,
+    0xFF, 0xB3, 0xF5, 0x37, 0xB5, 0x55, 0x3D, 0x8E, 0xE5, 0x44, 0x10, 0x2E, 0x3F, 0xF3, 0xB0, 0x84,
+    0x83, 0x26, 0x98, 0x89, 0x08, 0x1C, 0x6F, 0xE4, 0x23, 0xB4, 0x21, 0x25, 0x79, 0xC1, 0x2E, 0x04,
+    0x04, 0x7B, 0x04, 0x38, 0x01, 0x36, 0x5C, 0x80, 0xB9, 0x01, 0x04, 0x1B, 0xA0, 0x4D, 0x38, 0x01,
+    0x6A, 0x4B, 0x1B, 0x10, 0x90, 0x38, 0x22, 0x36, 0x62, 0x48, 0x20, 0xA0, 0x91, 0xBC, 0xC8, 0xCC,
+    0x76, 0xBB, 0xF8, 0xBE, 0xB2, 0x77, 0x66, 0x53, 0x84, 0xB0, 0x64, 0xBF, 0x67, 0xBB, 0xBB, 0xEA,
+    0xFB, 0xA9, 0x2A, 0x8B, 0x3C, 0x39, 0x5F, 0xA4, 0x4A, 0xFD, 0x28, 0xFE, 0x45, 0x92, 0x72, 0xF5,
+    0x83, 0xB4, 0x1F, 0x2C, 0x22, 0x97, 0xB3, 0xEC, 0x47, 0xAD, 0x83, 0x14, 0xAA, 0xA3, 0x34, 0xBC,
+    0xE8, 0x4F, 0xDA, 0xD5, 0xB9, 0xDC, 0xC4, 0xCF, 0x75, 0x2A, 0x54, 0xDA, 0x58, 0x25, 0x09, 0x43,
+    0x3B, 0xE3, 0x51, 0x18, 0xDC, 0x72, 0xDA, 0xA4, 0x1F, 0xEB, 0x84, 0xBB, 0x66, 0xED, 0xA3, 0x78,
+    0xC5, 0x6E, 0xAF, 0xAB, 0x48, 0xBB, 0x75, 0x22, 0x85, 0x3C, 0x1C, 0x6F, 0xAB, 0x32, 0x60, 0xE0,
+    0x8F, 0x38, 0x5E, 0x93, 0xE8, 0x1D, 0x6E, 0x27, 0xC7, 0x18, 0x22, 0xFD, 0x8C, 0xF8, 0x52, 0xAA,
+    0xD4, 0xD8, 0xDE, 0x2C, 0xE2, 0x27, 0x91, 0x00, 0x04, 0xCF, 0xBF, 0x45, 0xF4, 0x4A, 0x35, 0xBA,
+    0x45, 0x5A, 0xC4, 0xC7, 0x73, 0xD5, 0x2C, 0x2A, 0x65, 0xC6, 0xF2, 0x24, 0x2E, 0x8A, 0xE0, 0x15,
+    0x43, 0xF8, 0x19, 0x78, 0x44, 0x74, 0x74, 0x08, 0x51, 0xE8, 0xAF, 0xE1, 0xEE, 0x79, 0x57, 0x32,
+    0x55, 0x16, 0xFB, 0x89, 0x64, 0x46, 0x14, 0xF2, 0xD6, 0x1B, 0xC8, 0xA4, 0xCD, 0x27, 0x45, 0x72,
+    0xFD, 0x5A, 0x53, 0xC5, 0xF7, 0x9B, 0xCB, 0xBD, 0x7E, 0xA1, 0x6D, 0x04, 0x32, 0xF5, 0xB3, 0x4B,
+    0x27, 0xED, 0x47, 0x97, 0x9E, 0xE6, 0x30, 0x02, 0xF8, 0x0A, 0xDE, 0x40, 0x8D, 0xEB, 0xDD, 0x33,
+    0x4A, 0x11, 0x09, 0xD3, 0x43, 0xC2, 0xFE, 0x67, 0xCD, 0xC5, 0x37, 0x9E, 0x11, 0xE6, 0x46, 0x37,
+    0x5C, 0x4B, 0x9D, 0x7A, 0x08, 0x72, 0x25, 0x45, 0xC7, 0x3C, 0xD7, 0xB8, 0xD6, 0x89, 0xC8, 0x70,
+    0xE3, 0x81, 0xC2, 0xCD, 0xF8, 0xF3, 0x78, 0x07, 0x51, 0xEA, 0xDF, 0x78, 0x08, 0xA4, 0x80, 0xB0,
+    0x48, 0xF8, 0x9D, 0x24, 0xB0, 0x58, 0x3B, 0x3F, 0xB9, 0x58, 0x66, 0xEC, 0xE9, 0x47, 0x20, 0x4A,
+    0xA5, 0x7E, 0x82, 0x67, 0x00, 0x50, 0x72, 0x5D, 0x0F, 0x15, 0xEB, 0x44, 0x49, 0xBE, 0x84, 0xAA,
+    0x4B, 0x13, 0xB1, 0x4E, 0x87, 0x26, 0xD6, 0x09, 0x4A, 0xF8, 0xC9, 0x63, 0x15, 0x64, 0x6A, 0x81,
+    0x0E, 0xB6, 0x53, 0x4E, 0xD8, 0xC7, 0xD4, 0x25, 0x04, 0x3A, 0x1B, 0x28, 0xF1, 0x1F, 0x2E, 0x05,
+    0x98, 0xD5, 0xAF, 0xD4, 0x9C, 0xD3, 0x19, 0x08, 0x60, 0x80, 0xD1, 0x32, 0x8D, 0x1D, 0xB9, 0x8D,
+    0x72, 0xC2, 0x53, 0x5A, 0x43, 0x5F, 0xF0, 0x97, 0x81, 0x08, 0xF8, 0x86, 0xD2, 0x4E, 0x00, 0x82,
+    0x42, 0xD9, 0x02, 0x00, 0x0F, 0x50, 0x69, 0x29, 0x69, 0x90, 0x9F, 0x1A, 0x94, 0x0B, 0xF6, 0xE9,
+    0xE8, 0x5F, 0x86, 0xA5, 0xA4, 0x0F, 0x40, 0xDE, 0x55, 0x56, 0x08, 0x2F, 0xB2, 0xB8, 0x15, 0xEA,
+    0xE9, 0xFB, 0x8A, 0x6C, 0x6E, 0x05, 0xF2, 0x30, 0xA2, 0xB0, 0x32, 0xF6, 0xFA, 0xE8, 0xA7, 0x93,
+    0x76, 0xF7, 0x0E, 0x99, 0xAD, 0x54, 0xAC, 0x02, 0x2C, 0x01, 0xA6, 0xD7, 0xE0, 0x71, 0xD3, 0x4E,
+    0xD5, 0x5F, 0x28, 0xCC, 0x3F, 0x90, 0x9A, 0x8A, 0x0F, 0xD2, 0xA4, 0x7B, 0xBC, 0x84, 0x0E, 0xBC,
+    0x14, 0x9C, 0xC2, 0xB7, 0xD0, 0x1B, 0x51, 0x51, 0x34, 0xC6, 0xEF, 0x38, 0xAA, 0xD5, 0x62, 0x17,
+    0x08, 0x5B, 0x83, 0xDB, 0x35, 0x9F, 0x15, 0x17, 0xF8, 0x52, 0xC7, 0x76, 0x14, 0xF7, 0x0B, 0x57,
+    0xB3, 0x66, 0x7C, 0x3A, 0x3C, 0xE4, 0xE1, 0xF4, 0x76, 0xB7, 0xAB, 0x20, 0x2B, 0x63, 0xEE, 0x67,
+    0xB2, 0x81, 0x5F, 0x25, 0x6D, 0x6B, 0xAC, 0x53, 0x46, 0x1F, 0xCD, 0x30, 0x47, 0xB3, 0xC8, 0xBD,
+    0x60, 0x15, 0x9A, 0x63, 0x7E, 0x66, 0x75, 0x83, 0x7C, 0x65, 0xED, 0x03, 0xCB, 0xAC, 0xA3, 0x8C,
+    0x3D, 0x70, 0x87, 0x09, 0x08, 0xAE, 0x24, 0x9C, 0x10, 0xF8, 0xAB, 0x68, 0x08, 0x1C, 0x68, 0x14,
+    0x8F, 0xEF, 0x69, 0xD3, 0xB5, 0xD3, 0xA6, 0x23, 0x74, 0x1D, 0xC8, 0xBB, 0x3A, 0x5C, 0x21, 0x53,
+    0x12, 0xE7, 0x49, 0x9A, 0xAC, 0x50, 0x32, 0xA7, 0x71, 0xD4, 0x90, 0x9D, 0x82, 0xE3, 0x09, 0x3B,
+    0x65, 0xD8, 0xCF, 0x00, 0x56, 0x7D, 0x77, 0x70, 0xC7, 0xF1, 0x1E, 0x6C, 0xF5, 0xBA, 0x11, 0xB1,
+    0x34, 0xDB, 0x77, 0x28, 0x7E, 0xE9, 0xCA, 0xED, 0xD8, 0xE0, 0x23, 0xA7, 0x04, 0x56, 0xB3, 0xCF,
+    0x9D, 0x85, 0x58, 0xF9, 0x04, 0xAF, 0x01, 0xDA, 0xD2, 0xA2, 0x5E, 0xC1, 0xB4, 0xFB, 0xFC, 0x23,
+    0x1D, 0x31, 0x46, 0xA6, 0x6A, 0xAF, 0x10, 0xAC, 0xBC, 0xB2, 0xF0, 0xD7, 0x17, 0xC8, 0xD6, 0xD9,
+    0x4A, 0x64, 0xA6, 0xA7, 0x47, 0xE2, 0x56, 0x6F, 0xC0, 0x66, 0x6C, 0x91, 0x5A, 0x87, 0xCF, 0xAC,
+    0xF8, 0x32, 0x67, 0x09, 0xA5, 0xEE, 0xF0, 0x16, 0x84, 0xF0, 0xDF, 0xD1, 0xCA, 0xF8, 0xA8, 0x40,
+    0xA9, 0x29, 0xCA, 0x8B, 0xF1, 0xF3, 0x11, 0x1A, 0x91, 0xCD, 0x27, 0xCF, 0x39, 0xF4, 0x03, 0x06,
+    0xD2, 0x10, 0x50, 0x2A, 0x47, 0xB1, 0xFC, 0xBF, 0xAC, 0xE8, 0x0C, 0x52, 0x97, 0xD8, 0xE6, 0x7F,
+    0x8C, 0xE5, 0x5A, 0xC7, 0xF3, 0x51, 0xA5, 0xFF, 0x99, 0x95, 0x8D, 0xCF, 0x5B, 0xC3, 0x8E, 0xB1,
+    0x59, 0xE8, 0x6F, 0x98, 0x02, 0xF2, 0x2E, 0xA1, 0xDB, 0x89, 0x00, 0x27, 0x9D, 0x76, 0xC0, 0x7E,
+    0xDB, 0xD1, 0x9F, 0x58, 0xB1, 0x04, 0x6E, 0xAE, 0x4F, 0x17, 0xE9, 0x27, 0xE2, 0x66, 0x9B, 0xF6,
+    0x88, 0xDB, 0xA0, 0xCD, 0xE5, 0x7B, 0xC4, 0x25, 0xFD, 0x1E, 0x14, 0x50, 0xE9, 0x67, 0xFC, 0x3A,
+    0x00, 0x62, 0x93, 0xEF, 0x5F, 0x82, 0x5B, 0xC2, 0x0E, 0xBA, 0xBA, 0xB5, 0x62, 0xDF, 0x10, 0x75,
+    0x58, 0x91, 0x6F, 0xC1, 0xBB, 0xD1, 0x40, 0x43, 0xB5, 0x93, 0xBE, 0xD3, 0xF5, 0x33, 0x30, 0xD7,
+    0x16, 0x7B, 0x92, 0xE6, 0xA1, 0xC3, 0x7A, 0x29, 0x9E, 0x46, 0xCC, 0x57, 0xB3, 0x5B, 0x4C, 0x8F,
+    0x8C, 0xD1, 0x53, 0xFD, 0xB9, 0xED, 0x16, 0x15, 0x84, 0x71, 0x3E, 0x4A, 0x5A, 0x3E, 0xC5, 0x37,
+    0x83, 0x1C, 0xD1, 0x2C, 0x23, 0x49, 0x22, 0x7A, 0x61, 0x0C, 0xD1, 0x2B, 0x3B, 0x4D, 0x86, 0xDA,
+    0x79, 0x96, 0xDC, 0x69, 0x36, 0xB5, 0xE9, 0xB0, 0x88, 0xC2, 0x82, 0xEA, 0x59, 0xAA, 0x2C, 0xE4,
+    0x5A, 0xED, 0x03, 0x92, 0xC9, 0x19, 0xC3, 0x94, 0x64, 0x5B, 0x67, 0x34, 0x7C, 0x68, 0x66, 0x03,
+    0x40, 0x0E, 0xAF, 0xF3, 0x87, 0x8D, 0x1F, 0x8B, 0x11, 0x34, 0x06, 0x12, 0xB6, 0x16, 0xCA, 0xFB,
+    0x07, 0x91, 0x94, 0x25, 0xA4, 0xDD, 0xA8, 0x5D, 0x6F, 0x79, 0x56, 0xE1, 0x13, 0x88, 0xF1, 0x1B,
+    0x2C, 0xCB, 0xC4, 0xD8, 0xAC, 0xAC, 0xCC, 0x13, 0x32, 0x27, 0x9E, 0x06, 0xFC, 0xCD, 0xBE, 0x43,
+    0xCB, 0xEF, 0x4D, 0xD7, 0xD9, 0x50, 0x2A, 0xF6, 0x50, 0xBB, 0x8D, 0xF9, 0xA1, 0x7D, 0x69, 0x01,
+    0xBF, 0x61, 0xC4, 0x50, 0x1D, 0x1F, 0x0A, 0x8E, 0x29, 0x0C, 0x03, 0xF9, 0x18, 0x67, 0x20, 0x9C,
+    0x1B, 0xF9, 0xF7, 0xC7, 0x3F, 0xC5, 0x55, 0x3D, 0x6E, 0xD4, 0x40, 0x14, 0xFE, 0xC6, 0x26, 0xB2,
+    0xC4, 0x16, 0x43, 0x91, 0x54, 0x14, 0xBE, 0x41, 0x7C, 0x84, 0x71, 0x44, 0x41, 0x41, 0xC1, 0x16,
+    0x1B, 0x71, 0x01, 0x3A, 0x0A, 0x2E, 0x80, 0x32, 0x46, 0x5C, 0x84, 0x82, 0x02, 0xE5, 0x0C, 0x89,
+    0xEC, 0xDC, 0xC0, 0x01, 0x21, 0x5A, 0xDF, 0x80, 0x29, 0x8C, 0x64, 0x11, 0x8F, 0x1F, 0xDF, 0x9B,
+    0xDD, 0x88, 0xF0, 0x53, 0x50, 0x44, 0x89, 0xE3, 0x99, 0xDD, 0x9D, 0x9F, 0xF7, 0xFD, 0xBC, 0x37,
+    0x13, 0xEC, 0x01, 0x0E, 0x68, 0x81, 0x05, 0x2B, 0x89, 0x5E, 0x66, 0xBE, 0x8F, 0xE3, 0xC6, 0x4E,
+    0xB0, 0x23, 0x6C, 0x40, 0x19, 0x50, 0x0D, 0x70, 0x7D, 0x7A, 0x3B, 0xF8, 0xCB, 0xDA, 0x49, 0xC3,
+    0xD7, 0x4A, 0x5D, 0x0C, 0xBA, 0xA0, 0x98, 0x61, 0x66, 0xBC, 0x98, 0xD1, 0x4E, 0xF0, 0x3D, 0xB0,
+    0xE1, 0xDF, 0x92, 0xCD, 0x70, 0xCF, 0xB9, 0x53, 0x3A, 0x58, 0x01, 0xCC, 0x06, 0xFA, 0x38, 0x91,
+    0xA8, 0xCD, 0x8B, 0xC2, 0x08, 0xD7, 0x0C, 0xD0, 0xB8, 0x1A, 0x18, 0x9E, 0xAD, 0x65, 0x93, 0x86,
+    0xAD, 0x86, 0xD1, 0x6D, 0x6C, 0x19, 0x5B, 0xBE, 0xB0, 0x45, 0x28, 0x14, 0x56, 0xDA, 0x26, 0xC0,
+    0x6A, 0x1B, 0xB1, 0x7B, 0xCA, 0x41, 0x35, 0x98, 0x27, 0x23, 0x5C, 0x55, 0x67, 0xF3, 0x4B, 0xD8,
+    0x81, 0x3B, 0xA5, 0xA6, 0x18, 0x23, 0x12, 0x4C, 0xFB, 0xA5, 0xD6, 0x20, 0xBA, 0x81, 0x58, 0x1A,
+    0x57, 0x63, 0x28, 0x34, 0xA1, 0x72, 0x86, 0x2C, 0xC7, 0x35, 0xE9, 0x35, 0x10, 0xAE, 0x12, 0xAE,
+    0xDA, 0xFF, 0x3F, 0xB6, 0x9C, 0x07, 0xE7, 0xD0, 0x72, 0xDF, 0x2B, 0xF9, 0xF8, 0x17, 0xDB, 0xE2,
+    0x4F, 0xB6, 0x86, 0x70, 0x01, 0xB4, 0x87, 0x7E, 0x93, 0xE0, 0x53, 0x91, 0x0B, 0xF2, 0xA3, 0xE1,
+    0x99, 0x02, 0xD7, 0xB9, 0xC8, 0x91, 0x48, 0xE7, 0x25, 0x68, 0x04, 0x72, 0x23, 0x16, 0xA9, 0xE5,
+    0x32, 0x29, 0x33, 0x7A, 0xAE, 0xC4, 0x76, 0x8F, 0xAF, 0x47, 0x2A, 0xB9, 0x0A, 0xE0, 0xA6, 0x1E,
+    0xC5, 0x05, 0xD9, 0x1B, 0x3C, 0xD8, 0x4D, 0x32, 0x54, 0xA4, 0xCC, 0x62, 0xCE, 0x52, 0xC7, 0xE4,
+    0x4E, 0x8C, 0x68, 0x53, 0x37, 0x92, 0x55, 0x19, 0x68, 0x64, 0x15, 0xC8, 0xCB, 0x0D, 0x24, 0xE6,
+    0x7A, 0x66, 0xD2, 0x75, 0x4C, 0xB6, 0xEF, 0xAA, 0x40, 0x65, 0xD4, 0xCA, 0x34, 0xF7, 0x8C, 0xE3,
+    0x7A, 0x86, 0x70, 0xA1, 0x58, 0x50, 0x2D, 0xAF, 0x67, 0x72, 0xA0, 0x3D, 0x85, 0x88, 0x1A, 0xBE,
+    0x6C, 0x05, 0x6D, 0x9F, 0x2C, 0x16, 0x5D, 0x26, 0x57, 0xDC, 0xC7, 0x05, 0x67, 0xE5, 0x48, 0xA6,
+    0x8F, 0xB6, 0xB9, 0x09, 0xF9, 0xBC, 0x9A, 0x8C, 0xD0, 0x97, 0xB6, 0xD1, 0x78, 0xAE, 0xB3, 0xA1,
+    0x0C, 0x05, 0x07, 0x33, 0x21, 0x1F, 0x69, 0x18, 0xBF, 0x57, 0xF0, 0x32, 0xD8, 0xB9, 0x98, 0x8B,
+    0xC5, 0xC8, 0x33, 0xAE, 0x93, 0x6F, 0xBD, 0x95, 0xAF, 0x01, 0x72, 0xC9, 0x0A, 0x4B, 0x91, 0x4E,
+    0x4F, 0x09, 0x26, 0xAA, 0x93, 0xA9, 0x05, 0x8E, 0x8F, 0xEF, 0x45, 0xEC, 0xC3, 0xD3, 0x0F, 0x1C,
+    0x8B, 0x9A, 0x3E, 0xE5, 0x90, 0xF4, 0x13, 0xDD, 0x75, 0x6D, 0x53, 0x06, 0x37, 0xAC, 0x26, 0x3B,
+    0xE6, 0x91, 0x35, 0x25, 0x1C, 0xF4, 0x1C, 0xAC, 0x02, 0x01, 0x27, 0x1B, 0x74, 0xD0, 0xE8, 0x20,
+    0xF3, 0xDB, 0xF9, 0xA1, 0x1C, 0xDB, 0x31, 0x97, 0x85, 0xFA, 0xA3, 0x87, 0x8D, 0x65, 0xB7, 0xB3,
+    0x6B, 0x6D, 0xD6, 0xC8, 0x42, 0xD1, 0xC3, 0x2C, 0xE9, 0x38, 0xA8, 0x52, 0x17, 0x6F, 0x3A, 0x7D,
+    0xB7, 0x72, 0x0F, 0x98, 0x48, 0xDB, 0xF1, 0x54, 0x2D, 0xA9, 0xDE, 0x59, 0x69, 0x3C, 0xD4, 0xD8,
+    0xC3, 0x2D, 0xE7, 0x36, 0x61, 0x95, 0x93, 0xDE, 0x12, 0xE7, 0xEC, 0xDE, 0x1C, 0x5E, 0x77, 0xE9,
+    0x67, 0x9A, 0xB8, 0x27, 0x03, 0xD2, 0x91, 0x6B, 0x79, 0xEE, 0x4F, 0xCE, 0x80, 0x43, 0x5B, 0x63,
+    0xF5, 0x8E, 0xC9, 0xE1, 0xB9, 0x43, 0xA5, 0x27, 0x7A, 0x8D, 0x5B, 0x2E, 0x00, 0xB3, 0x39, 0xE0,
+    0x25, 0xB1, 0x38, 0xAD, 0x80, 0x8A, 0xB0, 0xB1, 0x64, 0x37, 0x5B, 0x9A, 0xBE, 0x7F, 0xED, 0x40,
+    0x12, 0x9A, 0x1C, 0xA0, 0x1A, 0x7E, 0xF2, 0x86, 0x6E, 0x1B, 0x55, 0x3A, 0xFC, 0x36, 0xA3, 0xDA,
+    0x54, 0x6A, 0xF2, 0x80, 0x84, 0x6C, 0xF8, 0xF7, 0x4C, 0xA4, 0x59, 0x24, 0x45, 0x93, 0x93, 0x0B,
+    0xBC, 0x4F, 0x58, 0x6F, 0x5E, 0xAF, 0xC2, 0x4C, 0x6E, 0x18, 0x7F, 0x70, 0xB4, 0x26, 0x32, 0x79,
+    0x55, 0x9F, 0x23, 0xEF, 0xFC, 0x8A, 0x57, 0xD3, 0xDB, 0xE9, 0x17, 0xAB, 0x64, 0x81, 0x16, 0x03,
+    0xD4, 0x83, 0x64, 0xAE, 0x9A, 0x00, 0x2D, 0x07, 0xA8, 0x0B, 0xA9, 0x1E, 0xD4, 0x86, 0x94, 0x8C,
+    0xE4, 0x83, 0x56, 0x04, 0xD4, 0x08, 0x68, 0x49, 0x24, 0x27, 0x52, 0x4D, 0x6C, 0xAD, 0xB8, 0xB3,
+    0x3C, 0xAF, 0xF8, 0x05, 0x95, 0xCA, 0x38, 0x51, 0xDC, 0xF3, 0x04, 0xFE, 0x5E, 0xD3, 0x9E, 0x26,
+    0x86, 0x5D, 0xDD, 0x11, 0x52, 0xC8, 0xC2, 0x77, 0xD2, 0x54, 0x03, 0xD1, 0x46, 0x8A, 0x61, 0x51,
+    0x1B, 0x1D, 0x6C, 0x3B, 0xA2, 0x0C, 0x2C, 0x7F, 0x0E, 0x52, 0xD5, 0x9C, 0x8B, 0xA6, 0xBA, 0xF1,
+    0x9F, 0x84, 0x95, 0x7E, 0xC5, 0x44, 0x7F, 0xE7, 0x3F, 0x90, 0x91, 0xF2, 0xEA, 0xF3, 0x1D, 0x82,
+    0x42, 0x39, 0x62, 0xDA, 0x1F, 0xEA, 0x73, 0x73, 0x03, 0xE7, 0x0E, 0x9F, 0x9F, 0xBD, 0x55, 0x31,
+    0x6F, 0xDD, 0x54, 0x14, 0x3E, 0xF6, 0xE5, 0xC9, 0xA2, 0x1E, 0xEE, 0x92, 0x37, 0x50, 0x06, 0xEF,
+    0x11, 0xC2, 0x7F, 0x80, 0x70, 0x5D, 0x65, 0xEC, 0x90, 0x54, 0x7A, 0x4F, 0x0C, 0xFC, 0x01, 0x04,
+    0x03, 0x0B, 0x43, 0x07, 0x1A, 0xBB, 0x64, 0x60, 0xE8, 0x82, 0xC4, 0x0F, 0xA0, 0x63, 0x95, 0x0E,
+    0x30, 0x76, 0x68, 0x64, 0xB7, 0x19, 0x32, 0x64, 0x88, 0xD3, 0x8A, 0x19, 0x47, 0x05, 0x21, 0xC1,
+    0xD0, 0x9B, 0xE6, 0x42, 0x1D, 0x72, 0xED, 0xC3, 0x77, 0xEE, 0x7B, 0x69, 0x2A, 0xBA, 0x30, 0xD5,
+    0x4F, 0xB9, 0x2F, 0x7E, 0x3E, 0xF7, 0x9C, 0xEF, 0xFB, 0xCE, 0xB9, 0x9F, 0x89, 0x68, 0x5E, 0x10,
+    0xAE, 0x84, 0xC3, 0x57, 0xC9, 0xE1, 0xA6, 0x1F, 0xE5, 0xAB, 0x2E, 0x06, 0xAC, 0xD1, 0x26, 0x6D,
+    0xD2, 0xF2, 0xCA, 0x3A, 0x2A, 0xAB, 0x78, 0x2C, 0x2B, 0x35, 0x92, 0x3E, 0x19, 0x29, 0xEB, 0xA9,
+    0xDE, 0xEF, 0x89, 0x3B, 0x35, 0xE8, 0x4E, 0x71, 0x95, 0x59, 0xD3, 0xE4, 0x23, 0x71, 0xC1, 0xC4,
+    0xBD, 0xF2, 0xCA, 0xA7, 0xE7, 0x36, 0xEF, 0xB4, 0x35, 0x3F, 0x36, 0x4C, 0xE6, 0x91, 0xAF, 0x13,
+    0x04, 0xEB, 0x17, 0xDE, 0xB4, 0xCA, 0x97, 0xD7, 0x4F, 0x98, 0xF4, 0xA9, 0xCF, 0x0F, 0x1C, 0x99,
+    0xC3, 0xB6, 0x36, 0x0D, 0x8D, 0x75, 0x34, 0x0C, 0xA4, 0xCE, 0xFB, 0x84, 0x2D, 0x69, 0x6E, 0x32,
+    0xAE, 0xC8, 0x8C, 0x54, 0x7A, 0x22, 0xB6, 0x11, 0x77, 0xA4, 0xB8, 0x11, 0xA0, 0x7A, 0xA0, 0xCC,
+    0x0B, 0x9E, 0x68, 0x26, 0xAB, 0x0E, 0xA0, 0x4D, 0x60, 0x30, 0xE6, 0x8D, 0xE0, 0xD7, 0x1D, 0x1E,
+    0x16, 0xD1, 0x05, 0x70, 0x53, 0xE5, 0x4E, 0x79, 0xD3, 0x18, 0x97, 0x62, 0x2D, 0x9D, 0x76, 0xA6,
+    0x61, 0x07, 0xB4, 0x8F, 0xD8, 0x99, 0xD6, 0x3C, 0x3E, 0x77, 0x65, 0x63, 0xF6, 0x4E, 0x5D, 0x5D,
+    0x98, 0x83, 0x53, 0x07, 0xA8, 0x87, 0x4F, 0xFF, 0x1E, 0xC8, 0xFC, 0xB2, 0xF7, 0xD2, 0x53, 0xFE,
+    0x7C, 0xFD, 0x65, 0x4F, 0x39, 0x2B, 0x60, 0xCA, 0x47, 0x05, 0x14, 0xB9, 0x07, 0x8E, 0xB0, 0x56,
+    0x84, 0xBC, 0x52, 0x3D, 0x9A, 0x8B, 0x78, 0x3D, 0x14, 0xC2, 0x13, 0x91, 0x2F, 0x1A, 0x94, 0xA3,
+    0x29, 0x4D, 0x42, 0x79, 0xE5, 0x49, 0xF7, 0xA6, 0x8D, 0x39, 0x1E, 0xC9, 0x74, 0x99, 0xD5, 0x9E,
+    0x38, 0x02, 0x79, 0xD4, 0xA6, 0xFA, 0xBA, 0xA7, 0xE4, 0x8C, 0x05, 0x7F, 0x0B, 0x7E, 0x48, 0x91,
+    0xE3, 0x26, 0xC2, 0x0D, 0xF6, 0x60, 0xAF, 0x64, 0xCF, 0x2C, 0x51, 0x2C, 0xFF, 0xE4, 0xA0, 0xA5,
+    0xA4, 0x29, 0x46, 0x58, 0x8A, 0x04, 0x75, 0x25, 0x05, 0x26, 0xA2, 0x43, 0x36, 0x2E, 0x1B, 0x18,
+    0x8D, 0x78, 0x9C, 0x38, 0xDD, 0xD2, 0xA4, 0x88, 0x8A, 0x85, 0x02, 0x68, 0xD9, 0x40, 0x65, 0x93,
+    0x7A, 0x6C, 0xD5, 0x10, 0xBC, 0xC9, 0x2D, 0x16, 0xD4, 0x37, 0x4D, 0x0D, 0x2E, 0x2D, 0xB6, 0x65,
+    0x4F, 0x90, 0x20, 0x7B, 0x86, 0xAC, 0xFA, 0x77, 0x54, 0xD6, 0xCF, 0xAD, 0x48, 0x8B, 0x8A, 0x29,
+    0x38, 0x61, 0xA9, 0x64, 0x4A, 0x64, 0x3A, 0x04, 0x40, 0x28, 0x8E, 0x44, 0x80, 0x82, 0xB0, 0x55,
+    0x89, 0x08, 0x0D, 0x30, 0x01, 0x5D, 0x27, 0x25, 0x73, 0x85, 0x86, 0xF5, 0x35, 0x6A, 0x6F, 0x58,
+    0x8A, 0xBB, 0x5B, 0xF4, 0xEA, 0x02, 0x3C, 0xDE, 0x1E, 0x28, 0xC7, 0x6C, 0xA8, 0x11, 0x42, 0x70,
+    0xA3, 0x2D, 0x38, 0xF2, 0xFA, 0x40, 0xA9, 0x03, 0x9C, 0xF2, 0x07, 0x0B, 0x29, 0x06, 0x49, 0x59,
+    0x81, 0x38, 0x0A, 0x64, 0x92, 0x56, 0x10, 0x68, 0x2B, 0xE2, 0x48, 0x76, 0xD1, 0x44, 0x18, 0x83,
+    0x83, 0x08, 0x8C, 0x32, 0x82, 0xB2, 0x5F, 0x54, 0x98, 0x02, 0x8A, 0xBA, 0x90, 0x2E, 0x68, 0x28,
+    0x13, 0x81, 0x86, 0x2C, 0xE7, 0x98, 0xD9, 0x53, 0xCD, 0x6C, 0x63, 0x66, 0xAE, 0x52, 0xB9, 0x43,
+    0x14, 0x12, 0xA5, 0x41, 0x43, 0xBB, 0xDC, 0x6C, 0x9C, 0xE8, 0x8E, 0x54, 0x59, 0xE8, 0x04, 0xF2,
+    0xEB, 0xA0, 0xF9, 0x9B, 0x81, 0xE3, 0xCE, 0xBD, 0x08, 0xA9, 0x3A, 0xA4, 0xE2, 0xC2, 0x2C, 0xF2,
+    0xC9, 0x70, 0x4A, 0xBC, 0x20, 0x2D, 0x01, 0x5D, 0x76, 0x2C, 0x07, 0x52, 0x02, 0x98, 0x7B, 0x6C,
+    0x71, 0x34, 0x97, 0x2C, 0x20, 0x2D, 0x85, 0x44, 0x5A, 0xE9, 0xBA, 0x68, 0xCA, 0x4D, 0xE8, 0xB9,
+    0xFC, 0x94, 0x9D, 0xCD, 0x21, 0x45, 0x48, 0x8C, 0x06, 0xF3, 0xAB, 0xD3, 0xD8, 0x2E, 0x45, 0x51,
+    0x92, 0x3A, 0xB5, 0x97, 0x02, 0xBF, 0x1D, 0x82, 0xC2, 0xF1, 0x02, 0x30, 0xD4, 0xAD, 0x2F, 0xFB,
+    0x0B, 0x8C, 0xA0, 0x97, 0x30, 0xB7, 0x93, 0x4F, 0x38, 0x28, 0x20, 0x55, 0x32, 0x17, 0xE0, 0x4A,
+    0x09, 0x94, 0xC2, 0x28, 0x52, 0xD9, 0x52, 0x32, 0xCE, 0x25, 0x5F, 0x81, 0x94, 0x88, 0xB7, 0x4B,
+    0xBF, 0x49, 0x2D, 0xCE, 0xB1, 0x96, 0x59, 0xCC, 0xC2, 0x68, 0xF9, 0x65, 0x4F, 0xDF, 0x16, 0xB7,
+    0x29, 0x3E, 0x69, 0x07, 0x0C, 0x72, 0x94, 0x04, 0x82, 0x9C, 0xF8, 0x0B, 0x04, 0x4A, 0x70, 0x82,
+    0x1F, 0x7A, 0x31, 0x50, 0x20, 0x18, 0xF3, 0xA2, 0x56, 0x24, 0xF5, 0xA4, 0x23, 0x12, 0x2D, 0x7F,
+    0xE8, 0xAB, 0x90, 0xA4, 0xF2, 0xB7, 0x59, 0xE8, 0xA0, 0x66, 0x71, 0x30, 0x0E, 0xAD, 0x5A, 0x91,
+    0x29, 0x16, 0xFD, 0x80, 0x3D, 0x96, 0xA2, 0xA6, 0x2B, 0x2E, 0x0F, 0x75, 0x38, 0x5B, 0xFF, 0xE3,
+    0xF0, 0x2F, 0xE2, 0x8A, 0xD7, 0x4F, 0xC6, 0x9B, 0x71, 0xCD, 0xA2, 0x4B, 0x5F, 0xB0, 0x9C, 0x63,
+    0x69, 0x15, 0x7E, 0x4D, 0xC6, 0xA0, 0xA9, 0x81, 0x3D, 0x27, 0x2E, 0xF2, 0x34, 0xA3, 0x39, 0xA0,
+    0x73, 0x55, 0x17, 0x65, 0x31, 0x09, 0x8F, 0xE0, 0xB8, 0x30, 0x62, 0x38, 0x42, 0x59, 0x0C, 0xB3,
+    0x70, 0x76, 0xE2, 0x21, 0x79, 0xCC, 0xE7, 0xC7, 0x20, 0xF0, 0x30, 0x73, 0x2B, 0xE8, 0xD3, 0xD5,
+    0x9D, 0xEF, 0x99, 0x4B, 0x3E, 0x9E, 0xCF, 0xAE, 0xEE, 0xEC, 0x6C, 0x43, 0x3A, 0x90, 0xBC, 0x3D,
+    0x9F, 0x6F, 0xAE, 0xD0, 0xDC, 0xA9, 0x67, 0xFF, 0xD4, 0x1B, 0xDC, 0xC3, 0x38, 0xC4, 0x84, 0xF4,
+    0x9F, 0x08, 0xC4, 0x0C, 0xAC, 0x77, 0x63, 0xBE, 0xD7, 0xD7, 0xE9, 0x6D, 0x07, 0x56, 0x77, 0xF8,
+    0xC6, 0xA8, 0x5C, 0xBD, 0xED, 0xAE, 0xC0, 0xA8, 0x72, 0xB7, 0xE5, 0x1F, 0xAC, 0x3D, 0x58, 0xDB,
+    0xF2, 0xB9, 0x83, 0x77, 0xCF, 0xA6, 0x45, 0xB9, 0xEF, 0xB5, 0x65, 0xD5, 0x9B, 0x6A, 0x37, 0x6D,
+    0x27, 0x28, 0x07, 0x14, 0x65, 0x34, 0x98, 0x03, 0x07, 0xCD, 0x52, 0x46, 0x0C, 0x4D, 0xD6, 0x4F,
+    0xFA, 0x5D, 0xA3, 0xF7, 0x8E, 0xFB, 0xCF, 0x68, 0x3A, 0x59, 0xB7, 0x7E, 0x2B, 0xFB, 0xF6, 0xC8,
+    0xED, 0xE6, 0x57, 0xBE, 0xB9, 0x3B, 0xBD, 0xB6, 0x69, 0xF6, 0x7B, 0xFD, 0xC4, 0x27, 0x76, 0x88,
+    0x9C, 0xA1, 0xCD, 0x09, 0x7D, 0x0D, 0x43, 0x8A, 0x36, 0x8E, 0x36, 0xDE, 0xFB, 0xF0, 0xE3, 0xD8,
+    0xD6, 0xE0, 0xDA, 0x4B, 0x17, 0x66, 0xC1, 0xDD, 0x39, 0xFB, 0xC3, 0x3F, 0x8C, 0xFE, 0x12, 0xC7,
+    0x1C, 0x62, 0xAF, 0xFA, 0x14, 0x96, 0x64, 0xDA, 0xB2, 0x99, 0x42, 0x4C, 0xBC, 0xC8, 0x1C, 0x2C,
+    0xAA, 0x85, 0x63, 0x42, 0x07, 0x36, 0x87, 0x2F, 0x7C, 0x99, 0xED, 0xD9, 0xD9, 0x7F, 0x9F, 0x4C,
+    0xAF, 0x71, 0x3C, 0xA8, 0x5E, 0x59, 0x24, 0x99, 0x43, 0x76, 0xBC, 0x55, 0x1A, 0x53, 0x4D, 0x64,
+    0x6C, 0xA2, 0xEE, 0xD3, 0x0D, 0x3F, 0xB5, 0xAA, 0x79, 0x07, 0x37, 0x5F, 0xC5, 0x3F, 0x6B, 0xBF,
+    0x76, 0xA3, 0x8B, 0x16, 0xE3, 0xE4, 0x57, 0xEF, 0x37, 0x74, 0x93, 0x92, 0x82, 0x7E, 0x22, 0x4D,
+    0x64, 0xE9, 0x5D, 0xBC, 0x96, 0xE1, 0x67, 0xB9, 0xD5, 0x2E, 0xEF, 0xB3, 0x3E, 0x15, 0xEF, 0x4A,
+    0xEE, 0x3C, 0x3D, 0xB2, 0xB7, 0x74, 0xF5, 0x5D, 0x5C, 0x69, 0xBA, 0xF9, 0xFE, 0x19, 0xAC, 0x83,
+    0x56, 0xEF, 0x19, 0x9F, 0x54, 0x49, 0x91, 0x86, 0xB9, 0xD4, 0xF4, 0x51, 0x36, 0x7E, 0xF9, 0xEB,
+    0x07, 0x74, 0x97, 0x3E, 0xBF, 0xCF, 0x0B, 0xBF, 0xCB, 0xDA, 0xD4, 0xC6, 0x1E, 0xDE, 0x53, 0xAF,
+    0x73, 0xC3, 0xAD, 0x98, 0xE5, 0xEB, 0xD7, 0xBF, 0xB5, 0x55, 0x4D, 0x6C, 0xDC, 0x44, 0x14, 0x7E,
+    0xF6, 0x64, 0x63, 0x14, 0x93, 0xBA, 0x87, 0x46, 0xA0, 0xD2, 0xC6, 0x15, 0x02, 0xA9, 0x2A, 0x59,
+    0xB6, 0x87, 0x1E, 0x52, 0xC9, 0xBB, 0xE3, 0x12, 0x44, 0x11, 0x39, 0x74, 0x05, 0xB1, 0x7A, 0xEC,
+    0x1E, 0x51, 0x11, 0x6A, 0x0E, 0x7B, 0xD8, 0x8A, 0x4D, 0xED, 0x04, 0xA4, 0x4A, 0x1C, 0xE8, 0x8A,
+    0x0B, 0x47, 0x72, 0xE0, 0x50, 0x16, 0x21, 0xED, 0x61, 0x0F, 0xAD, 0x94, 0xC4, 0x26, 0x01, 0x55,
+    0x6A, 0x2F, 0x6E, 0x2F, 0x41, 0xF4, 0x50, 0x23, 0x10, 0x48, 0xC9, 0x65, 0x10, 0xAE, 0xE2, 0x86,
+    0xF1, 0x3E, 0xDE, 0x78, 0xD3, 0x3F, 0x41, 0x25, 0x2E, 0x58, 0x3B, 0xD6, 0xEC, 0xCC, 0x7B, 0x6F,
+    0xDE, 0xFB, 0xBE, 0xEF, 0x8D, 0xC7, 0x02, 0x3B, 0xAA, 0x44, 0x3C, 0xE2, 0x01, 0xFF, 0x91, 0x4B,
+    0x5B, 0xEA, 0x5F, 0x81, 0x26, 0xF9, 0x2F, 0x39, 0x8F, 0xC0, 0x9E, 0x49, 0x06, 0x95, 0x8D, 0x2C,
+    0x34, 0x17, 0xD3, 0x92, 0xCB, 0xC5, 0x9A, 0x4C, 0x9D, 0xD4, 0x59, 0x93, 0x5C, 0x68, 0x00, 0xC0,
+    0xE3, 0x81, 0x29, 0x38, 0xCC, 0x01, 0x4B, 0xAC, 0xD4, 0x90, 0x20, 0xCF, 0x4A, 0x3F, 0xF3, 0x63,
+    0x26, 0x38, 0x4B, 0xAD, 0x88, 0x2F, 0x63, 0x8C, 0x00, 0x25, 0x57, 0xDA, 0x8B, 0x69, 0x85, 0x16,
+    0x8D, 0xE4, 0x7D, 0x18, 0xEB, 0x76, 0x0D, 0xC4, 0xF5, 0x18, 0x84, 0x80, 0x96, 0x03, 0xE5, 0x12,
+    0xA8, 0x40, 0xD0, 0x9B, 0x3E, 0x7C, 0x3D, 0x6F, 0xF3, 0x7B, 0x82, 0xE6, 0x07, 0x60, 0xC2, 0x8A,
+    0xFC, 0x25, 0x19, 0xBA, 0x1C, 0x5D, 0x03, 0x03, 0xF0, 0x5C, 0x80, 0x09, 0x17, 0xB8, 0x04, 0x8E,
+    0x01, 0xBF, 0x25, 0x78, 0x10, 0x96, 0x28, 0xEC, 0x01, 0x38, 0x50, 0x03, 0xC9, 0xB7, 0x33, 0x1B,
+    0x85, 0x49, 0x66, 0x73, 0x00, 0x1E, 0xD8, 0x78, 0x0A, 0xD1, 0xDA, 0x1A, 0x2C, 0x40, 0x56, 0xD7,
+    0xC8, 0x0F, 0xB4, 0x9C, 0xDD, 0xC6, 0xBF, 0x04, 0x62, 0xD6, 0x36, 0xB3, 0x12, 0xEC, 0x87, 0x83,
+    0xDD, 0x65, 0xC4, 0x0D, 0xC4, 0x92, 0x57, 0x9F, 0xF0, 0xBC, 0x59, 0xC4, 0xFC, 0x7C, 0xB7, 0x1B,
+    0x94, 0x3C, 0x8F, 0x1C, 0xF3, 0x83, 0x34, 0x25, 0x27, 0xDA, 0x98, 0x21, 0x8F, 0x63, 0xDD, 0xAE,
+    0x4A, 0x0E, 0xD6, 0x74, 0x81, 0xBB, 0x99, 0x8F, 0xB2, 0x66, 0xE6, 0x25, 0xCA, 0x8F, 0xD6, 0xCF,
+    0x21, 0xFE, 0x8E, 0x78, 0xDF, 0xF3, 0xE6, 0x38, 0x62, 0x31, 0x47, 0x1C, 0x84, 0xEA, 0x1D, 0xC3,
+    0xA3, 0xA7, 0x07, 0x46, 0x06, 0x3C, 0xD3, 0x31, 0xB6, 0x73, 0xE0, 0x09, 0x58, 0x2E, 0x8C, 0x3C,
+    0xDE, 0x95, 0x34, 0x2A, 0x94, 0x22, 0x4B, 0x68, 0xB2, 0x42, 0xC3, 0xA6, 0xA3, 0x99, 0x42, 0x60,
+    0x81, 0x86, 0x15, 0x01, 0xE8, 0x29, 0x4D, 0x6A, 0x34, 0x4C, 0xFA, 0xA3, 0x65, 0x0A, 0x71, 0x1A,
+    0x46, 0xFC, 0xDF, 0x9D, 0x8F, 0xA9, 0x83, 0xC6, 0x20, 0x33, 0x22, 0xC7, 0xDC, 0x48, 0x4F, 0xC2,
+    0x51, 0x78, 0xD1, 0x81, 0xA9, 0x16, 0x38, 0xD7, 0xBD, 0x36, 0x15, 0xE8, 0x79, 0x75, 0x15, 0x14,
+    0xE5, 0x49, 0xAF, 0xDD, 0x84, 0xE9, 0x1E, 0x34, 0x43, 0x14, 0xDD, 0xEE, 0xB2, 0x0A, 0xB1, 0x93,
+    0x55, 0x2F, 0x7D, 0x48, 0xBC, 0xD0, 0x7C, 0x04, 0xCA, 0x6D, 0x5B, 0x10, 0xA3, 0xA2, 0xA9, 0x4E,
+    0x00, 0x33, 0x5E, 0x65, 0xB1, 0x19, 0x58, 0xE0, 0xE8, 0x42, 0xA5, 0xF7, 0x2C, 0xF0, 0xDC, 0x09,
+    0x17, 0x03, 0xD4, 0x72, 0x4D, 0x6A, 0x75, 0xCD, 0x33, 0x72, 0x2B, 0xAD, 0xC4, 0xA1, 0xE2, 0xE9,
+    0x29, 0x5A, 0xEC, 0x82, 0x96, 0xF3, 0xA6, 0x3C, 0x17, 0x49, 0xCB, 0xAD, 0x83, 0xD6, 0xA5, 0xAA,
+    0xF0, 0xCA, 0xC7, 0x32, 0xBC, 0x22, 0x06, 0x7C, 0x43, 0xBE, 0x6E, 0x47, 0xD7, 0xA0, 0xE0, 0x92,
+    0xA5, 0xFC, 0xF4, 0x03, 0xFF, 0x8E, 0xAA, 0xDD, 0x42, 0xDC, 0xD9, 0xEA, 0x5E, 0x8F, 0xA1, 0xDC,
+    0x03, 0xEB, 0x28, 0xE8, 0xC1, 0xB3, 0x73, 0x28, 0xCD, 0x08, 0x59, 0xB3, 0x2E, 0xFF, 0x9C, 0xAE,
+    0x56, 0xDE, 0x5A, 0x5C, 0x9E, 0x98, 0x1D, 0x7C, 0x10, 0x4F, 0xB1, 0xC8, 0xA1, 0xAA, 0x46, 0x9A,
+    0xEF, 0xE2, 0x8D, 0x2F, 0x43, 0xD9, 0xC3, 0xDB, 0xB3, 0x43, 0x62, 0x4A, 0x84, 0x86, 0x5B, 0xFC,
+    0x60, 0xB4, 0x73, 0xC8, 0xCE, 0xDB, 0xD5, 0x30, 0x6D, 0x9A, 0x31, 0xF4, 0x41, 0x97, 0xA0, 0x13,
+    0x03, 0x0A, 0x1A, 0x62, 0x75, 0xCA, 0xC2, 0xAC, 0x6C, 0x27, 0x05, 0x16, 0x4D, 0x8E, 0xA2, 0xEF,
+    0x47, 0x75, 0xF2, 0x5D, 0x74, 0x27, 0x4D, 0x3A, 0xF7, 0xF2, 0x56, 0x66, 0xB0, 0x21, 0xC9, 0xF3,
+    0xF6, 0xFA, 0x03, 0x4B, 0x4B, 0xCA, 0xE0, 0xAB, 0xFE, 0xDA, 0x94, 0x4C, 0xB2, 0x7C, 0x5E, 0x6D,
+    0x6C, 0x02, 0xD4, 0x61, 0xBC, 0x01, 0x37, 0x8F, 0x43, 0x07, 0x3E, 0xD1, 0x8E, 0x00, 0x3C, 0x0F,
+    0xE4, 0x33, 0xAA, 0x72, 0x68, 0x34, 0xE8, 0xA0, 0x2F, 0x94, 0xD5, 0xF8, 0x3C, 0x91, 0x7D, 0x7C,
+    0x93, 0x92, 0xD3, 0xC6, 0xE7, 0x69, 0xB5, 0x1E, 0x8F, 0x2A, 0x3E, 0xE1, 0x39, 0xD0, 0x69, 0xF7,
+    0x7B, 0xED, 0x38, 0x1C, 0xD1, 0x6E, 0x9E, 0x80, 0xCB, 0x45, 0xB0, 0x61, 0xDC, 0xAB, 0xFA, 0x55,
+    0xFD, 0x5B, 0x3F, 0xF2, 0x63, 0x1E, 0xC3, 0xB4, 0x99, 0x70, 0x1B, 0xDF, 0x86, 0xD1, 0xEF, 0x64,
+    0x8D, 0x45, 0x35, 0x5D, 0x8C, 0x82, 0xB6, 0x46, 0x6D, 0xB5, 0xB4, 0x1B, 0x5A, 0x6E, 0xB5, 0x25,
+    0xAF, 0x19, 0xA9, 0xD2, 0x8A, 0xAA, 0xFD, 0x73, 0x36, 0x30, 0x04, 0x8F, 0x77, 0x14, 0x7A, 0xF5,
+    0x55, 0x3E, 0x93, 0xBC, 0x14, 0x8F, 0x75, 0xCC, 0xC4, 0x8E, 0x56, 0x2E, 0xBD, 0x03, 0x1D, 0xCD,
+    0x5D, 0x65, 0x89, 0x7D, 0x43, 0x58, 0xB7, 0x9A, 0x6B, 0xFB, 0xA6, 0xE3, 0xA9, 0x43, 0xA4, 0x29,
+    0x73, 0x4F, 0x53, 0x60, 0x6D, 0x23, 0xFA, 0xC4, 0x4E, 0xF0, 0xD9, 0x7B, 0xB8, 0x94, 0x4E, 0x8A,
+    0x97, 0x15, 0x57, 0x95, 0xBB, 0xE9, 0xC5, 0xD5, 0x76, 0x6F, 0x7A, 0x9C, 0x7E, 0x17, 0x07, 0x6D,
+    0x7B, 0x53, 0x9C, 0x30, 0x20, 0xFC, 0x69, 0x45, 0x8F, 0x5E, 0x51, 0x72, 0xD5, 0xFF, 0xC8, 0xE9,
+    0xED, 0xBF, 0x31, 0x70, 0xE1, 0x42, 0xAA, 0xAB, 0xBE, 0x71, 0x35, 0x7A, 0x11, 0xA2, 0x17, 0xF0,
+    0xD7, 0xA1, 0x88, 0x75, 0x51, 0x98, 0x2C, 0xA1, 0x0B, 0x76, 0xF6, 0x94, 0xC9, 0x6B, 0xCA, 0x84,
+    0x98, 0xEE, 0x9E, 0xC1, 0xA2, 0x95, 0x51, 0x78, 0xD4, 0x88, 0x44, 0xF6, 0xD7, 0xFE, 0xB0, 0x0B,
+    0x73, 0xE2, 0x7F, 0x6E, 0x48, 0x80, 0x8E, 0xBB, 0x2E, 0xB4, 0x49, 0x2E, 0xF8, 0x4D, 0xC6, 0xB7,
+    0x95, 0xED, 0x02, 0x8C, 0x86, 0x18, 0xEC, 0xA7, 0xBD, 0xFD, 0x0F, 0x5B, 0xD1, 0xC4, 0x5D, 0x62,
+    0x95, 0x36, 0x03, 0x28, 0x5A, 0xD8, 0x7A, 0x00, 0x10, 0x46, 0x03, 0x55, 0xC6, 0xA7, 0x9D, 0x87,
+    0x6D, 0xB4, 0xF7, 0x30, 0x97, 0x82, 0x7B, 0x67, 0x93, 0xA2, 0xEF, 0xA5, 0xAF, 0xDE, 0x45, 0x53,
+    0xB0, 0xA0, 0xD0, 0x35, 0xE8, 0x6F, 0xDA, 0xB9, 0xE3, 0xB4, 0x9C, 0x56, 0x6B, 0x21, 0xE5, 0x3D,
+    0x5A, 0x59, 0xB6, 0x56, 0xCA, 0x0E, 0xCF, 0xAA, 0x6E, 0xB5, 0x61, 0x93, 0xA5, 0xA5, 0x07, 0x6E,
+    0xDF, 0xB1, 0x8C, 0xA5, 0xB8, 0x07, 0x5A, 0xC7, 0xCE, 0x94, 0x6D, 0xD3, 0x59, 0xA0, 0xD6, 0xA0,
+    0x46, 0x1B, 0x99, 0x2A, 0x3B, 0xF4, 0x28, 0xDF, 0x1A, 0xD1, 0xA9, 0x77, 0xC2, 0x1B, 0x51, 0x19,
+    0x84, 0xFE, 0x9B, 0x5E, 0x88, 0x1E, 0x58, 0xF4, 0x6A, 0xE2, 0xA7, 0x8E, 0x33, 0x69, 0x19, 0xA7,
+    0x17, 0x77, 0xE2, 0x4A, 0xAF, 0x58, 0xB5, 0x60, 0xB2, 0x51, 0x91, 0xD5, 0xC2, 0xB1, 0xDF, 0xEC,
+    0xF5, 0x46, 0x1A, 0x8D, 0xCA, 0x40, 0x56, 0xAB, 0xC3, 0x50, 0xAD, 0x7E, 0xBF, 0xDF, 0x53, 0x8B,
+    0xFE, 0xBA, 0xA0, 0x96, 0xD5, 0x12, 0xD3, 0x25, 0xA5, 0xDD, 0xE7, 0xB7, 0xE3, 0x32, 0x8B, 0xAA,
+    0xEA, 0x9A, 0xA8, 0xBF, 0xB0, 0x7E, 0x77, 0xDF, 0x61, 0xF1, 0x51, 0x20, 0x59, 0x0C, 0x25, 0xED,
+    0xD4, 0x9F, 0xA4, 0x55, 0x23, 0x66, 0x29, 0xBB, 0xC7, 0xEE, 0xC4, 0xEA, 0x56, 0xA5, 0xAE, 0x88,
+    0x94, 0xEC, 0x69, 0x12, 0x16, 0x9A, 0x57, 0x22, 0x19, 0xC2, 0x41, 0x60, 0x03, 0x81, 0xE0, 0xDA,
+    0x88, 0x91, 0x49, 0x50, 0x30, 0x85, 0x1A, 0x51, 0x46, 0x82, 0x27, 0xF4, 0xA8, 0x5E, 0x73, 0xD0,
+    0xED, 0x30, 0x85, 0x11, 0xA1, 0xA5, 0x2C, 0x8B, 0x45, 0x8B, 0x42, 0x31, 0x45, 0x2F, 0xC2, 0x9E,
+    0xE5, 0x6E, 0x37, 0xB0, 0x94, 0x3B, 0x75, 0xAD, 0xA6, 0x62, 0x0E, 0x9F, 0x15, 0xDB, 0x05, 0xFF,
+    0x4C, 0x02, 0xF6, 0x46, 0x46, 0x97, 0xC2, 0xCA, 0x63, 0x16, 0xFE, 0xAF, 0x63, 0x15, 0xAB, 0x4C,
+    0x51, 0xAA, 0x88, 0x35, 0x0A, 0xB9, 0xD1, 0xC5, 0x3D, 0x74, 0x2A, 0x30, 0x50, 0x3C, 0x84, 0x5B,
+    0x1D, 0x75, 0x01, 0x25, 0x4A, 0x2C, 0x2A, 0x03, 0xA9, 0x21, 0x84, 0x71, 0x25, 0x61, 0x39, 0xD9,
+    0xF1, 0x98, 0x47, 0x2C, 0x27, 0xBB, 0x30, 0x0A, 0x7F, 0xB8, 0x20, 0xAD, 0x2C, 0x44, 0x17, 0x67,
+    0x49, 0x53, 0x22, 0x4C, 0x1F, 0xC2, 0xA6, 0xBE, 0x68, 0x76, 0xFA, 0x44, 0x2E, 0x15, 0x75, 0xC1,
+    0xEF, 0x21, 0xAA, 0x72, 0x51, 0x79, 0xD0, 0xB7, 0x0F, 0x53, 0x20, 0x35, 0x17, 0x69, 0x17, 0xC5,
+    0x59, 0x54, 0x83, 0x56, 0xD8, 0x3F, 0xCA, 0x89, 0xA8, 0x60, 0x72, 0xAF, 0x1A, 0xF3, 0x1F, 0x76,
+    0x4A, 0x70, 0xFA, 0xE0, 0x49, 0xBB, 0x7F, 0x7B, 0xFE, 0x06, 0xAD, 0x95, 0xB1, 0x8E, 0xE4, 0x44,
+    0x10, 0x86, 0x7B, 0xC6, 0x3A, 0x2C, 0x9D, 0x03, 0x27, 0x77, 0x11, 0x81, 0x73, 0x12, 0x3F, 0x01,
+    0x6A, 0x03, 0x01, 0xE1, 0x5D, 0xB0, 0xDC, 0x43, 0xF0, 0x10, 0xD8, 0x6F, 0x00, 0x8F, 0x70, 0xF1,
+    0x5D, 0x30, 0x2F, 0x00, 0x72, 0xE7, 0x04, 0x18, 0x11, 0x92, 0x18, 0x09, 0x09, 0xB4, 0x09, 0x16,
+    0x32, 0xC2, 0xB7, 0x78, 0x5C, 0x7C, 0x7F, 0x79, 0x66, 0x77, 0x2F, 0x20, 0xC3, 0xD2, 0x78, 0xDD,
+    0xDD, 0xD5, 0x55, 0x7F, 0x55, 0xFD, 0xF5, 0x6F, 0x08, 0x7A, 0x3E, 0xB4, 0x5F, 0x43, 0x69, 0x36,
+    0x65, 0x66, 0xE7, 0x60, 0x77, 0xA7, 0x14, 0x97, 0xF0, 0x2C, 0xDF, 0x38, 0xB1, 0x14, 0x42, 0x35,
+    0x87, 0x70, 0xB4, 0x2F, 0x6E, 0x42, 0x34, 0x1B, 0x30, 0x59, 0xF5, 0x91, 0xF2, 0x33, 0x3B, 0x2D,
+    0xC7, 0xD9, 0x19, 0xBB, 0x38, 0xF2, 0x61, 0xCD, 0x21, 0x54, 0xF6, 0x6A, 0x0A, 0x66, 0xC6, 0xCA,
+    0xA6, 0x90, 0xDB, 0x3B, 0x0E, 0x5F, 0x86, 0xFD, 0xC9, 0x09, 0x13, 0x6D, 0xE3, 0x78, 0x3D, 0xD8,
+    0xED, 0x9A, 0x19, 0x77, 0xB6, 0xCB, 0xCF, 0x14, 0x63, 0x20, 0xE0, 0x82, 0x33, 0x36, 0x4A, 0xEB,
+    0xD8, 0xC0, 0x7D, 0xCF, 0x66, 0xF4, 0xDF, 0xCB, 0xD0, 0x0E, 0x5F, 0xBD, 0xB2, 0xD4, 0x9A, 0x35,
+    0x2D, 0x40, 0x2B, 0x23, 0xE8, 0x33, 0x05, 0x1F, 0xF2, 0x15, 0x28, 0xC5, 0x12, 0xAC, 0x2B, 0xE7,
+    0x83, 0x85, 0x7A, 0xC2, 0x67, 0x1C, 0x32, 0xDF, 0x5D, 0xAF, 0xBB, 0xD5, 0x74, 0x34, 0x80, 0x82,
+    0x57, 0xB0, 0x79, 0xAA, 0x17, 0xA9, 0xFC, 0x6D, 0xCE, 0xDE, 0xAD, 0xE1, 0xDB, 0x8F, 0x2F, 0x10,
+    0x83, 0x35, 0x21, 0x26, 0x4C, 0x03, 0xDE, 0x04, 0x8C, 0x75, 0x7B, 0xBF, 0x26, 0x53, 0x70, 0xB2,
+    0xAE, 0xA7, 0x50, 0xBE, 0xB7, 0x1E, 0x2F, 0x6B, 0xC2, 0xF0, 0x14, 0xCB, 0x5E, 0x11, 0x2E, 0x83,
+    0x4C, 0xD6, 0xA1, 0xEF, 0xDC, 0xBC, 0x9C, 0xDD, 0x1E, 0x20, 0xBA, 0xE0, 0x89, 0xF1, 0x79, 0x35,
+    0xB2, 0xDD, 0xA8, 0x92, 0x3D, 0x46, 0xDB, 0xBD, 0x3D, 0xE5, 0xF9, 0xA8, 0x9F, 0x43, 0x6F, 0xE9,
+    0x48, 0xF9, 0x0B, 0xEC, 0xF6, 0xA7, 0x32, 0xC3, 0x00, 0x77, 0x94, 0x44, 0x85, 0x50, 0xCD, 0x55,
+    0x67, 0x73, 0x18, 0x7D, 0x07, 0x2E, 0xF9, 0xF0, 0x16, 0x11, 0x28, 0x2A, 0xEF, 0x6A, 0xCA, 0xCF,
+    0x18, 0xE3, 0xBD, 0x57, 0x01, 0xE3, 0x40, 0xE7, 0x87, 0x40, 0xAD, 0xFC, 0x56, 0x9B, 0xCA, 0xBF,
+    0xDA, 0x85, 0x0C, 0xC8, 0x84, 0xF2, 0x5B, 0x53, 0x8F, 0x54, 0xB0, 0x52, 0x41, 0xFB, 0xE4, 0x55,
+    0x05, 0x77, 0x4F, 0x69, 0x8F, 0xF6, 0x19, 0x50, 0xDA, 0x5B, 0x9B, 0xA2, 0x35, 0x05, 0x2D, 0xCD,
+    0xF0, 0x22, 0x17, 0x71, 0xA6, 0x79, 0x5B, 0x73, 0x2D, 0x28, 0x37, 0x0E, 0x24, 0x82, 0x3B, 0x25,
+    0x4C, 0xA6, 0xCA, 0x19, 0x5C, 0x42, 0x68, 0x9D, 0x32, 0x07, 0x9D, 0x92, 0x27, 0x6B, 0xE5, 0x45,
+    0x94, 0xF3, 0x9E, 0x91, 0xC9, 0x91, 0x89, 0x92, 0x51, 0x7F, 0xE0, 0xCC, 0x9B, 0xD3, 0xD6, 0x2F,
+    0x85, 0x5C, 0xC4, 0x29, 0x8E, 0xB8, 0x6C, 0x13, 0xB1, 0x39, 0x00, 0xBD, 0x70, 0xCA, 0x45, 0xD3,
+    0x8E, 0xB8, 0xB0, 0x93, 0x01, 0x56, 0xE5, 0x29, 0x55, 0x36, 0x76, 0xD9, 0xB3, 0x6F, 0xDC, 0x13,
+    0x1F, 0x36, 0x41, 0x22, 0x53, 0x9D, 0xC6, 0x9D, 0xBA, 0xCE, 0xE1, 0xB4, 0x77, 0x22, 0xF4, 0xB7,
+    0xAF, 0x15, 0x79, 0x54, 0x3A, 0x5D, 0xE5, 0x91, 0x49, 0xB9, 0x86, 0x39, 0xD8, 0xC5, 0x14, 0x53,
+    0xBE, 0x3A, 0xE1, 0x7A, 0x28, 0x47, 0x52, 0xD6, 0x58, 0x53, 0x4E, 0xE5, 0xB4, 0xF7, 0xFE, 0xC9,
+    0x8D, 0x08, 0x20, 0x37, 0xEE, 0x2B, 0xF3, 0xD7, 0xA2, 0x93, 0x9B, 0x07, 0x8E, 0x29, 0x07, 0x26,
+    0x68, 0xAF, 0x6B, 0xB1, 0xD0, 0xDE, 0x6C, 0x13, 0x27, 0xEC, 0x13, 0xE7, 0x1B, 0x75, 0xA8, 0x26,
+    0x5E, 0xC5, 0x66, 0xEA, 0xBD, 0xC6, 0x40, 0x70, 0x42, 0x6B, 0x4E, 0x14, 0x6C, 0x8A, 0x25, 0x4E,
+    0xA0, 0x56, 0x08, 0xDB, 0x39, 0xCA, 0xBA, 0x9E, 0x58, 0x0B, 0x50, 0x27, 0x9C, 0xD4, 0x22, 0xE4,
+    0xCA, 0xEB, 0x89, 0xE6, 0x6F, 0xA7, 0x40, 0x14, 0x71, 0x72, 0x71, 0x24, 0x7C, 0xE7, 0x60, 0xEF,
+    0x21, 0x11, 0x0B, 0x27, 0x39, 0xF9, 0x8E, 0x34, 0xB2, 0x98, 0x8F, 0xA8, 0x01, 0x79, 0xAF, 0x72,
+    0xCF, 0x49, 0xD7, 0x43, 0xA6, 0xA1, 0x3D, 0x0D, 0xE5, 0x1C, 0x7F, 0xE0, 0xA4, 0xFE, 0x89, 0x93,
+    0xF2, 0x17, 0x4E, 0xBE, 0x9E, 0xFA, 0xA6, 0xFE, 0x79, 0x8E, 0xA9, 0xFC, 0x7B, 0x29, 0x51, 0x90,
+    0x55, 0xD7, 0xCE, 0xB4, 0xBC, 0xA5, 0x68, 0x4D, 0x2D, 0xD2, 0x31, 0xCB, 0x3A, 0x49, 0x39, 0xA4,
+    0x1A, 0xC4, 0x6A, 0x7F, 0x0E, 0xAB, 0xCA, 0xD2, 0x7E, 0xBA, 0x6A, 0xD8, 0xB5, 0xD9, 0x0B, 0xE2,
+    0xE1, 0x2A, 0x16, 0x3E, 0x72, 0x54, 0x8F, 0x14, 0xAC, 0xA1, 0x40, 0xB5, 0xFA, 0x9D, 0x6B, 0x98,
+    0x81, 0xC4, 0x74, 0xD4, 0x03, 0x44, 0xCA, 0x17, 0x1F, 0x1B, 0x4D, 0x49, 0xFC, 0x1E, 0x6F, 0xC5,
+    0x3F, 0xAB, 0xA8, 0xB6, 0xF9, 0x2C, 0x88, 0xFA, 0x1A, 0x0B, 0x97, 0x11, 0x5D, 0xE1, 0x45, 0x11,
+    0xBF, 0xD4, 0x8C, 0xD4, 0x7A, 0x15, 0xE6, 0xCA, 0x36, 0x3E, 0x14, 0x02, 0xAE, 0x4A, 0x27, 0x30,
+    0x16, 0x51, 0x47, 0xB0, 0xE2, 0x9A, 0x72, 0xAE, 0x8F, 0x4E, 0x8A, 0x47, 0x27, 0x8D, 0xCC, 0xD2,
+    0xE5, 0xA4, 0x73, 0x66, 0x66, 0x8F, 0x4F, 0x8E, 0xB6, 0xD3, 0xBA, 0xD8, 0xDE, 0xF4, 0x83, 0xF3,
+    0x4E, 0x9C, 0x82, 0x3B, 0x3E, 0x6B, 0xCE, 0x8D, 0x9D, 0x35, 0xAE, 0x48, 0x3E, 0xAD, 0x1F, 0xBC,
+    0x76, 0x24, 0x99, 0x90, 0x57, 0x2E, 0xC1, 0xAB, 0x90, 0x02, 0x37, 0xFE, 0x81, 0x26, 0x9C, 0x7B,
+    0xB2, 0xFA, 0x93, 0xAD, 0xFE, 0xF3, 0x19, 0x07, 0xD5, 0x40, 0x21, 0xDA, 0x26, 0x18, 0x05, 0x2F,
+    0x66, 0x0A, 0x1A, 0x6F, 0x4F, 0x92, 0x71, 0x4B, 0x95, 0x42, 0x28, 0x98, 0x38, 0xC1, 0xB4, 0x84,
+    0xF8, 0xA3, 0x08, 0xF6, 0x62, 0xC1, 0x07, 0xD1, 0x90, 0x28, 0x66, 0xA1, 0x13, 0xCD, 0x19, 0x03,
+    0xDA, 0xAD, 0x56, 0x37, 0xBB, 0x22, 0x49, 0x7F, 0xC4, 0xAC, 0xA3, 0xC6, 0xF8, 0xAA, 0xF7, 0xD5,
+    0x9D, 0x31, 0x7A, 0xB9, 0x49, 0x37, 0x98, 0xBA, 0x7A, 0xA2, 0xAF, 0x4B, 0x35, 0x15, 0xE7, 0x62,
+    0x3B, 0xF9, 0x48, 0xED, 0xC3, 0xEF, 0x82, 0x1F, 0x11, 0xFA, 0xA0, 0xC1, 0xCD, 0x75, 0xBB, 0x36,
+    0x13, 0x27, 0xE3, 0x04, 0x07, 0xFB, 0x54, 0x8A, 0xF2, 0x6D, 0x92, 0x18, 0xBF, 0xF5, 0xF8, 0xB3,
+    0xDC, 0xCB, 0x5C, 0x35, 0x3B, 0xAA, 0xD1, 0x99, 0x5A, 0xEE, 0xAA, 0xD5, 0x0E, 0x4C, 0x88, 0x49,
+    0x65, 0x16, 0x29, 0x02, 0x4C, 0x72, 0x34, 0x52, 0x97, 0x0B, 0xFA, 0xE1, 0x01, 0x7D, 0xB7, 0xA3,
+    0x2F, 0xAF, 0xE8, 0xB7, 0x5D, 0xCE, 0xFF, 0x63, 0x33, 0x3D, 0xCA, 0xF3, 0xF1, 0xE6, 0xAE, 0x9F,
+    0x9B, 0x6A, 0x6E, 0xFE, 0x7F, 0xC8, 0xCE, 0xFE, 0xC6, 0xAE, 0x1A, 0x65, 0x1D, 0x07, 0x97, 0xF7,
+    0x24, 0x39, 0x43, 0x2D, 0x67, 0xE9, 0xAC, 0x3C, 0xA9, 0x26, 0x1A, 0x24, 0xBA, 0x48, 0x4F, 0x09,
+    0xEA, 0x62, 0x11, 0x5C, 0x29, 0x34, 0x95, 0x7D, 0xBA, 0x48, 0x1C, 0xBD, 0xB0, 0xE6, 0xA9, 0xDD,
+    0xBD, 0xB5, 0xDF, 0x5D, 0xDF, 0x56, 0xB5, 0xCA, 0x96, 0xDA, 0x25, 0x4F, 0x1C, 0xA0, 0x5D, 0xDE,
+    0x05, 0xC1, 0xA9, 0x47, 0x51, 0x23, 0x8E, 0xCF, 0x81, 0xF7, 0xFC, 0x41, 0x54, 0xFF, 0xAF, 0xE7,
+    0x5F, 0xAD, 0x55, 0x31, 0x92, 0xDD, 0x44, 0x10, 0x6D, 0x69, 0xCA, 0x28, 0x50, 0x15, 0x43, 0x00,
+    0x09, 0x1B, 0xE8, 0x08, 0x3A, 0xC2, 0x08, 0x13, 0x92, 0x6C, 0x40, 0x91, 0x70, 0x04, 0x02, 0x1F,
+    0x41, 0xBA, 0x81, 0x09, 0x38, 0x80, 0x03, 0xA2, 0x25, 0xD8, 0x1B, 0x78, 0xA6, 0x6A, 0x0F, 0x60,
+    0x55, 0x11, 0x12, 0x20, 0x6A, 0xA9, 0xA2, 0x0A, 0x07, 0x1E, 0xC3, 0x14, 0xC8, 0x6B, 0xCD, 0xB4,
+    0xDF, 0x9B, 0xFF, 0x17, 0x2F, 0xC4, 0xA8, 0xF6, 0x7F, 0xFB, 0xAB, 0xA7, 0xBB, 0x5F, 0xBF, 0xEE,
+    0x7E, 0x23, 0x4E, 0x75, 0x1A, 0x54, 0xD7, 0x4E, 0x35, 0xB6, 0xAA, 0x87, 0xE8, 0x22, 0xE2, 0x56,
+    0x91, 0x21, 0x8A, 0xF4, 0x87, 0x48, 0xAB, 0x57, 0xDF, 0x0B, 0x0D, 0x38, 0x29, 0x38, 0x19, 0xF8,
+    0xD2, 0x14, 0x11, 0xD1, 0x09, 0x27, 0xC3, 0xF9, 0x64, 0xB9, 0x7A, 0x66, 0xAA, 0xBB, 0x16, 0x99,
+    0x95, 0xA6, 0x61, 0x13, 0x38, 0x24, 0x1C, 0x31, 0x35, 0xAA, 0x5F, 0x86, 0x68, 0xE1, 0xAB, 0xF8,
+    0x9F, 0x0F, 0xD2, 0x16, 0x93, 0xFB, 0x8C, 0x50, 0x87, 0x8D, 0xF3, 0x86, 0x08, 0xC9, 0xDD, 0x30,
+    0xEA, 0xF0, 0xBA, 0x38, 0x04, 0x14, 0xF7, 0x0A, 0xF9, 0xF0, 0x78, 0xD5, 0x84, 0x7F, 0x80, 0x4F,
+    0x03, 0x5F, 0x6B, 0x7D, 0x6D, 0xF4, 0xC9, 0x2D, 0x4F, 0x8F, 0xBB, 0xFF, 0x02, 0x31, 0x1B, 0xBD,
+    0x39, 0x90, 0x4A, 0x06, 0x04, 0x73, 0x08, 0xA6, 0xEB, 0x1C, 0x90, 0xC3, 0x96, 0xB6, 0x34, 0xC0,
+    0xE2, 0xA3, 0x4D, 0x80, 0xDC, 0x29, 0xC0, 0x00, 0xBE, 0x4B, 0x27, 0x64, 0xF5, 0xB9, 0x40, 0x78,
+    0xC7, 0xB2, 0x88, 0xFE, 0xEE, 0x6B, 0x9D, 0x3E, 0x92, 0x19, 0xE5, 0xDB, 0x44, 0x68, 0x2C, 0x5F,
+    0x1E, 0xFD, 0xA0, 0x70, 0x2D, 0x48, 0xF2, 0x86, 0x70, 0x10, 0xFE, 0x22, 0x13, 0x58, 0x78, 0x4F,
+    0x52, 0x57, 0xFA, 0xEF, 0x2E, 0xF4, 0x31, 0xB0, 0x2D, 0xC0, 0xBB, 0xF4, 0x5A, 0x26, 0x69, 0x26,
+    0xC2, 0x0D, 0xAD, 0xA2, 0xEE, 0x46, 0xB7, 0x6E, 0x17, 0x4D, 0x6D, 0x16, 0x0F, 0x32, 0xC0, 0x10,
+    0x2C, 0x0E, 0x96, 0x6D, 0x7C, 0xB5, 0xF5, 0x69, 0x78, 0x99, 0x4C, 0xB6, 0x7F, 0xC2, 0xD2, 0x27,
+    0x58, 0x6E, 0xF6, 0x79, 0x19, 0x6E, 0x8F, 0x71, 0xED, 0xFF, 0xCA, 0x36, 0x9A, 0x5C, 0x48, 0xA0,
+    0x56, 0xB7, 0x09, 0x16, 0x0D, 0xB0, 0x68, 0x80, 0x45, 0x37, 0x5A, 0x62, 0x03, 0xCA, 0x13, 0x58,
+    0x95, 0xF3, 0x33, 0x86, 0x79, 0x92, 0x3E, 0xB2, 0x37, 0xE8, 0x2C, 0x50, 0x56, 0xE6, 0x3E, 0xB9,
+    0x37, 0x2B, 0xBA, 0x25, 0x73, 0xE8, 0x98, 0xDE, 0xE8, 0xDA, 0xA7, 0x56, 0xA3, 0x39, 0x1A, 0x36,
+    0x4F, 0xD8, 0xBD, 0xC5, 0xFB, 0x65, 0x5C, 0xE7, 0xEB, 0xD5, 0x26, 0xF7, 0x02, 0x96, 0xF1, 0x47,
+    0x58, 0xEC, 0x2F, 0xB0, 0x3C, 0x8D, 0x7E, 0x1A, 0x7F, 0x4A, 0x2E, 0xD8, 0xBF, 0x77, 0xA6, 0x3F,
+    0xE8, 0x96, 0x99, 0x1E, 0x4D, 0x9D, 0x46, 0x16, 0x65, 0x75, 0xA1, 0x25, 0x74, 0x7B, 0xA3, 0x6B,
+    0x5B, 0x38, 0x4B, 0xA0, 0xD0, 0x82, 0x81, 0xA9, 0xE3, 0x18, 0xE0, 0x15, 0xD0, 0x28, 0x27, 0xC0,
+    0xAD, 0x20, 0x7A, 0x60, 0xBF, 0xBA, 0x03, 0x5F, 0xAD, 0xFA, 0x48, 0xC0, 0x91, 0x4D, 0xDE, 0x89,
+    0x5A, 0x49, 0x2E, 0x66, 0xB1, 0x2D, 0x75, 0x6E, 0x3E, 0x53, 0xF2, 0xE9, 0xE8, 0x83, 0xDF, 0x3D,
+    0x52, 0x73, 0x0E, 0xE1, 0xA9, 0x13, 0x7E, 0xBB, 0xC0, 0x4E, 0x0B, 0x87, 0x6F, 0x13, 0xAB, 0x9A,
+    0x19, 0x0B, 0xA9, 0x06, 0xF6, 0x15, 0x59, 0x6B, 0x42, 0xBB, 0xB3, 0xA9, 0x38, 0x37, 0x83, 0x3E,
+    0xE9, 0x81, 0x91, 0x74, 0x8C, 0x11, 0x21, 0x11, 0x0A, 0xA7, 0x10, 0xDD, 0xAD, 0x00, 0x8A, 0x53,
+    0x73, 0xC0, 0x5F, 0xBF, 0x0B, 0x7C, 0x00, 0x1B, 0x35, 0xA4, 0x0F, 0x41, 0x35, 0x28, 0xCA, 0x70,
+    0xB0, 0x3A, 0xB1, 0x92, 0xB5, 0xAE, 0x4A, 0x7D, 0xDC, 0x8E, 0x01, 0x01, 0x9F, 0x48, 0x93, 0x65,
+    0x3E, 0x30, 0x31, 0x18, 0x29, 0x54, 0x7A, 0xF0, 0x0F, 0x1D, 0xB0, 0x1A, 0xCC, 0xDB, 0xBD, 0x29,
+    0x08, 0xEC, 0xA7, 0xE1, 0xE7, 0xD5, 0xBE, 0x8C, 0xED, 0x91, 0x9B, 0x03, 0xA4, 0xBD, 0x58, 0xDD,
+    0x53, 0xF0, 0x9C, 0xBB, 0xD7, 0xE4, 0x78, 0x2D, 0x68, 0x6F, 0x7A, 0x3E, 0xDE, 0x1C, 0xE2, 0xFB,
+    0x5B, 0x92, 0x1D, 0x9F, 0x7B, 0x4C, 0x4F, 0xE9, 0x75, 0x85, 0xE7, 0xE6, 0x0F, 0x74, 0x2C, 0x77,
+    0x3A, 0x91, 0xEE, 0x39, 0x82, 0xED, 0xA3, 0x63, 0x0F, 0xDC, 0x32, 0x63, 0x30, 0xEA, 0xF2, 0x62,
+    0xA5, 0x23, 0x8C, 0xA8, 0x63, 0x88, 0x80, 0xD9, 0x93, 0x78, 0x53, 0xFE, 0xB1, 0xCC, 0x5C, 0x82,
+    0x11, 0xEB, 0x7E, 0x75, 0xBD, 0x93, 0xA4, 0x5C, 0xB7, 0x8A, 0x32, 0xA0, 0x27, 0x0B, 0xCE, 0xB2,
+    0xEA, 0xC9, 0x64, 0x2E, 0xB8, 0xCA, 0x7B, 0x9F, 0x07, 0x96, 0x39, 0x34, 0x7A, 0x3F, 0x52, 0x8D,
+    0xC7, 0x6A, 0x80, 0xF4, 0xE5, 0x44, 0xBF, 0xDE, 0x61, 0xA2, 0x10, 0x70, 0xEF, 0x32, 0x92, 0xC3,
+    0xA1, 0xE3, 0x76, 0x9A, 0x0C, 0xA2, 0x4D, 0x46, 0xC3, 0x0C, 0xBB, 0xDA, 0xF1, 0xAB, 0x3F, 0x40,
+    0xB3, 0xDD, 0xF9, 0x95, 0xF0, 0x73, 0xE4, 0x34, 0xCC, 0xDB, 0x98, 0x1A, 0x0D, 0x43, 0xC1, 0x32,
+    0xF6, 0xD4, 0x93, 0xB6, 0x4A, 0xC0, 0x4C, 0x65, 0x92, 0xCB, 0x7B, 0x0D, 0xA8, 0x68, 0xA9, 0x0A,
+    0x1B, 0xCC, 0xB0, 0x03, 0x13, 0x86, 0x60, 0x6D, 0x2A, 0x5A, 0x5F, 0xD7, 0x7C, 0x43, 0xED, 0xF6,
+    0xDE, 0x12, 0xFE, 0x65, 0x31, 0x67, 0x4B, 0x77, 0xD4, 0x15, 0xAD, 0x96, 0x85, 0x96, 0xF5, 0x81,
+    0x65, 0xA6, 0x85, 0xE9, 0xBE, 0x85, 0xDE, 0xA0, 0xD7, 0xD4, 0xB5, 0xFE, 0xA4, 0x91, 0x1E, 0xCB,
+    0x61, 0x32, 0x42, 0xBA, 0x15, 0xA3, 0x93, 0xEB, 0x7C, 0xB9, 0xF5, 0xC9, 0x6E, 0x08, 0x0D, 0xE7,
+    0xB0, 0xA0, 0xE0, 0xC1, 0xFF, 0x7E, 0x59, 0x85, 0x44, 0x18, 0x86, 0x5A, 0xC1, 0x85, 0xE0, 0xC4,
+    0x82, 0x06, 0x39, 0x89, 0xA7, 0xDC, 0xAB, 0xD0, 0xAF, 0xE4, 0x0F, 0xAC, 0xA1, 0x1B, 0x7A, 0x77,
+    0x1D, 0x30, 0x4E, 0x1F, 0x77, 0x55, 0x65, 0x29, 0x33, 0xA9, 0x0A, 0xD1, 0x7F, 0x5C, 0x81, 0x50,
+    0x38, 0xA5, 0xE7, 0x37, 0x34, 0xE9, 0xD4, 0x80, 0x98, 0xAF, 0x22, 0xBB, 0x4A, 0xCC, 0x11, 0x63,
+    0xF8, 0xE6, 0xC4, 0x1A, 0x48, 0xCB, 0xFC, 0x00, 0xDC, 0x01, 0x8D, 0xDA, 0xAB, 0x03, 0xA7, 0x97,
+    0xA1, 0x18, 0x85, 0x7A, 0x46, 0x8A, 0xB1, 0x1D, 0x6C, 0x2C, 0x3F, 0x84, 0x4B, 0xA9, 0x67, 0x02,
+    0x66, 0xA3, 0xD4, 0x61, 0x23, 0x6A, 0x4D, 0xFC, 0x74, 0x75, 0xB3, 0x14, 0x67, 0x27, 0xCE, 0x16,
+    0xB7, 0xA5, 0x4E, 0x05, 0x42, 0xBB, 0x80, 0x66, 0xF7, 0x09, 0xA7, 0x9A, 0x42, 0x37, 0x77, 0x83,
+    0x18, 0xF6, 0x8F, 0xC2, 0xA0, 0x2A, 0xE7, 0x6E, 0x5A, 0x16, 0x67, 0x28, 0x51, 0xC2, 0xDD, 0xE7,
+    0x22, 0x52, 0xD2, 0x45, 0x3E, 0xF5, 0xCC, 0xA4, 0x55, 0x7F, 0xAB, 0xD6, 0xEE, 0x1C, 0xB2, 0x49,
+    0x1E, 0x3E, 0x63, 0xDD, 0xBC, 0xBE, 0xCA, 0xF8, 0x37, 0xD0, 0x5B, 0x70, 0xC8, 0x7B, 0x67, 0xD4,
+    0xF3, 0x65, 0x85, 0x69, 0x1C, 0x21, 0x9F, 0x73, 0x1A, 0x76, 0x73, 0x18, 0x82, 0x80, 0x48, 0x01,
+    0x05, 0x14, 0x34, 0x62, 0xE7, 0xB1, 0xE5, 0x5C, 0x2D, 0x68, 0x4B, 0xA2, 0x24, 0x7C, 0xAE, 0x0D,
+    0x95, 0xC9, 0x27, 0xFF, 0x58, 0x57, 0x4B, 0xEF, 0x8D, 0x24, 0x02, 0x1B, 0x67, 0x0C, 0x58, 0x3F,
+    0xD0, 0x2F, 0xEB, 0x75, 0x54, 0x41, 0x9C, 0x3A, 0xF7, 0xE8, 0xB2, 0xE2, 0xD8, 0x58, 0xEF, 0x1C,
+    0x0C, 0xB5, 0x64, 0x1A, 0x31, 0xE7, 0xF5, 0xCE, 0xE9, 0x38, 0xF7, 0x60, 0x89, 0xB4, 0x8E, 0xBF,
+    0xD5, 0x56, 0xD5, 0x42, 0x95, 0x4D, 0x6D, 0xA9, 0x72, 0x28, 0x9F, 0xC1, 0x7C, 0xA9, 0xD7, 0xDB,
+    0x51, 0xEF, 0x3C, 0xDE, 0x3A, 0xCA, 0xCE, 0x8C, 0x11, 0x3D, 0x41, 0x1C, 0x1C, 0xB1, 0x7B, 0x0D,
+    0xCD, 0xC1, 0xC5, 0x85, 0x89, 0xA8, 0xB8, 0x2E, 0xEB, 0x15, 0xF9, 0x3F, 0x3C, 0xEF, 0x00, 0x5D,
+    0x55, 0x31, 0x8E, 0xDC, 0x46, 0x10, 0x6C, 0x92, 0xD6, 0x11, 0xD0, 0x04, 0x4C, 0x9C, 0xD9, 0x00,
+    0x13, 0xE7, 0xF3, 0x84, 0x21, 0xE0, 0x07, 0xC8, 0x81, 0x25, 0x85, 0x7A, 0xC2, 0xFD, 0xC0, 0xA4,
+    0xAC, 0x0F, 0xDC, 0x23, 0x1C, 0x49, 0xC1, 0xFD, 0xC0, 0x43, 0x43, 0x80, 0x62, 0x5A, 0x80, 0xE0,
+    0x94, 0x06, 0x04, 0x18, 0xB8, 0x44, 0x13, 0xF0, 0xE0, 0xB9, 0x03, 0xC9, 0x76, 0x55, 0x73, 0x17,
+    0x77, 0xD6, 0x02, 0xEC, 0x9D, 0xE5, 0xCC, 0x74, 0x57, 0x57, 0x57, 0xF7, 0x4A, 0x98, 0x0A, 0x95,
+    0x36, 0x49, 0x1C, 0xEB, 0x55, 0xC2, 0x5C, 0xEE, 0xD2, 0x2C, 0xA2, 0x43, 0x85, 0x1F, 0xE7, 0x9D,
+    0xC1, 0x71, 0xA7, 0x3A, 0x76, 0x3A, 0x1E, 0x1B, 0xCB, 0x47, 0x3B, 0xD3, 0xA3, 0x9D, 0xFE, 0xB4,
+    0xA3, 0x83, 0xDB, 0xDF, 0xC6, 0xFB, 0x4A, 0xF1, 0x19, 0x69, 0x52, 0x0F, 0x93, 0x45, 0xA4, 0xDA,
+    0x60, 0x44, 0x69, 0xFA, 0x11, 0xC6, 0x27, 0x98, 0x8B, 0xDF, 0xA4, 0xCE, 0xE2, 0x27, 0xC4, 0xDD,
+    0xE0, 0x2A, 0x8C, 0x2A, 0xF5, 0xCA, 0x00, 0xBF, 0xC2, 0x75, 0x0E, 0x93, 0xE8, 0x8F, 0x1B, 0xDC,
+    0x86, 0xA9, 0xD4, 0x4A, 0x81, 0x25, 0xA8, 0x6E, 0x05, 0x5D, 0x3B, 0xD5, 0x55, 0x9E, 0xDE, 0x28,
+    0x3C, 0x35, 0xF4, 0xAE, 0x1D, 0x16, 0xF0, 0x58, 0xE8, 0xC9, 0x35, 0xB0, 0x09, 0x20, 0xF2, 0xA9,
+    0x08, 0xCF, 0x8C, 0x3B, 0x19, 0x1D, 0xCC, 0x58, 0xC2, 0x34, 0x96, 0x86, 0xC1, 0x87, 0x01, 0x13,
+    0x66, 0x8C, 0x13, 0xA4, 0xBF, 0x1D, 0x06, 0x2E, 0x68, 0x8C, 0x05, 0x98, 0x38, 0x98, 0xC1, 0xC5,
+    0xF8, 0x95, 0x8B, 0x0E, 0xB7, 0xCD, 0x0F, 0x01, 0x17, 0x0A, 0x36, 0xDE, 0x6D, 0xE2, 0xD5, 0x18,
+    0x31, 0x5E, 0x80, 0x3C, 0x1C, 0x3F, 0x89, 0xEE, 0x70, 0x63, 0xA7, 0xB9, 0x56, 0xAE, 0xF7, 0x47,
+    0x6B, 0x3D, 0x9F, 0x69, 0xFF, 0xFF, 0xFE, 0xBC, 0x3E, 0xC2, 0x19, 0x26, 0x3D, 0x9F, 0x61, 0x76,
+    0xDD, 0x57, 0x67, 0xB0, 0x3E, 0x52, 0x3F, 0x9F, 0xD9, 0xDF, 0xEA, 0xCD, 0xF5, 0xFD, 0x1B, 0x43,
+    0xA2, 0xF3, 0xF1, 0x95, 0x0F, 0x60, 0x56, 0xAA, 0x83, 0xCB, 0x73, 0xB9, 0xC0, 0xEA, 0x6C, 0x5F,
+    0xC8, 0xD3, 0x36, 0x7F, 0x46, 0x12, 0x8B, 0x20, 0x21, 0x1C, 0xD0, 0x24, 0x35, 0x17, 0x48, 0xF8,
+    0x54, 0xE8, 0x80, 0x3B, 0xF5, 0xF6, 0x93, 0x48, 0xC4, 0xA1, 0x06, 0xFE, 0x05, 0x6E, 0xBB, 0xF6,
+    0xF6, 0x72, 0x85, 0xD7, 0x38, 0xFA, 0xB9, 0x5E, 0x8D, 0xCE, 0x30, 0x36, 0x6B, 0xBD, 0x96, 0xDA,
+    0xC5, 0x1B, 0x4D, 0x8E, 0x91, 0x71, 0x0E, 0x17, 0xF6, 0xEE, 0xA8, 0x5E, 0x3B, 0xA3, 0x70, 0x2C,
+    0x66, 0x6F, 0x64, 0xB9, 0x6C, 0xFE, 0x75, 0x20, 0x2A, 0x22, 0x71, 0xAB, 0xA1, 0x44, 0x56, 0xB7,
+    0x84, 0x56, 0xAA, 0x0E, 0x78, 0x11, 0x18, 0x2B, 0x01, 0x1B, 0x3C, 0x4B, 0xFF, 0x49, 0xE7, 0x30,
+    0xBB, 0xB5, 0x52, 0xDC, 0x8C, 0x83, 0x4F, 0xBC, 0x59, 0x2A, 0xB9, 0x00, 0x5E, 0xF2, 0xDA, 0xAC,
+    0x4D, 0x2E, 0xF5, 0x9D, 0x0E, 0xDA, 0xE1, 0x66, 0xB2, 0x9B, 0x99, 0xA4, 0x42, 0xB8, 0xCC, 0x88,
+    0x40, 0x28, 0x2E, 0x50, 0x29, 0xE5, 0x6E, 0xE1, 0x4E, 0xE8, 0xF8, 0x72, 0xEB, 0x04, 0x61, 0x21,
+    0x55, 0xDD, 0x19, 0x78, 0x6A, 0x6F, 0xFB, 0x95, 0xD1, 0x4A, 0x82, 0xD6, 0xCE, 0x27, 0xE6, 0xD8,
+    0x26, 0xB7, 0xB9, 0xFD, 0x5A, 0x29, 0x00, 0x4B, 0x31, 0xE8, 0xDD, 0xC1, 0xAE, 0x5C, 0x20, 0x4A,
+    0xC9, 0x1E, 0x31, 0x9A, 0x70, 0x46, 0xBE, 0x91, 0x96, 0x9A, 0x8E, 0xE3, 0x11, 0x92, 0x64, 0x3E,
+    0x7F, 0x69, 0xA2, 0xA1, 0x80, 0xA0, 0x61, 0x2C, 0x8A, 0xE7, 0xAF, 0x32, 0x4B, 0x44, 0x9E, 0x88,
+    0x02, 0xB0, 0x4A, 0x1D, 0x7F, 0x79, 0xA1, 0x4B, 0x4D, 0x16, 0x71, 0xA4, 0x23, 0x19, 0x22, 0xDF,
+    0xCA, 0xC3, 0x07, 0x8C, 0x7D, 0xA7, 0x57, 0x02, 0x4A, 0x3D, 0xC0, 0x1E, 0x44, 0xCD, 0xE0, 0x24,
+    0xEC, 0x91, 0x9D, 0xEE, 0x73, 0xC1, 0x7E, 0x40, 0x43, 0x85, 0x54, 0x23, 0x07, 0x44, 0x2F, 0xB4,
+    0xB2, 0x83, 0x28, 0x4F, 0xC7, 0x72, 0x51, 0xB4, 0x20, 0x0C, 0x2C, 0x81, 0xFA, 0x5A, 0x0D, 0x7A,
+    0xC9, 0x33, 0xE0, 0x24, 0x0E, 0x88, 0xD7, 0x4F, 0x61, 0x02, 0x67, 0x3E, 0x35, 0x09, 0x0E, 0xDA,
+    0x4C, 0x17, 0x43, 0xCB, 0x3A, 0x84, 0xBB, 0x4B, 0x56, 0xAE, 0x36, 0x9E, 0x26, 0x20, 0xDC, 0x48,
+    0x6A, 0x69, 0xC3, 0x01, 0x99, 0x74, 0x07, 0x17, 0x08, 0xE3, 0x19, 0x84, 0x85, 0x10, 0xBF, 0x5F,
+    0xAF, 0xD2, 0xAC, 0x70, 0x6F, 0x2A, 0x66, 0x31, 0x47, 0xD0, 0x02, 0xDA, 0xC1, 0x67, 0x86, 0xF8,
+    0x5E, 0xEE, 0x62, 0xA9, 0x8A, 0xE3, 0x9D, 0x8A, 0x77, 0x4A, 0x7D, 0x96, 0x81, 0xF8, 0x0D, 0x54,
+    0x88, 0x09, 0x44, 0xC3, 0x3B, 0x13, 0x66, 0x42, 0x3F, 0x23, 0xB3, 0x3E, 0xB1, 0xA1, 0x17, 0x39,
+    0x69, 0x1B, 0xC4, 0x35, 0x93, 0xD3, 0x7F, 0x17, 0x0E, 0x94, 0x5A, 0x5F, 0x71, 0xCC, 0x98, 0x0E,
+    0xA6, 0x38, 0x36, 0x09, 0x8D, 0xBF, 0xB2, 0xAF, 0x29, 0x55, 0x7B, 0x19, 0x66, 0x24, 0xBF, 0x79,
+    0xA4, 0x63, 0xC5, 0x8E, 0x43, 0xA5, 0xCF, 0x26, 0xD4, 0xEB, 0xFC, 0xB9, 0xD8, 0x10, 0x1F, 0x13,
+    0x0B, 0xBB, 0x51, 0xEF, 0x0A, 0xFD, 0x6C, 0x73, 0x08, 0x44, 0x20, 0xD5, 0xDF, 0xC5, 0xFF, 0xA3,
+    0x64, 0x30, 0x85, 0xAD, 0x4F, 0x7D, 0x6A, 0x96, 0x38, 0xE1, 0x19, 0x4F, 0x0F, 0x7A, 0xFA, 0x10,
+    0x27, 0xA3, 0xD8, 0xB9, 0xAE, 0x51, 0xBA, 0x83, 0x00, 0xCF, 0x01, 0x9C, 0x92, 0xB7, 0xA5, 0x20,
+    0xD6, 0x1D, 0x13, 0x33, 0x57, 0x5B, 0x8B, 0x4A, 0xF9, 0xFB, 0xC8, 0xC6, 0xBD, 0x62, 0x75, 0xC2,
+    0xD4, 0x53, 0x70, 0x4B, 0x80, 0x6F, 0x9F, 0xDA, 0x85, 0xA5, 0xAA, 0x49, 0x4E, 0xDC, 0xCF, 0x24,
+    0x83, 0x1D, 0x0E, 0x24, 0xD0, 0x00, 0x2D, 0xCD, 0x1C, 0x96, 0x60, 0xA8, 0x56, 0x84, 0x42, 0xAA,
+    0x28, 0x16, 0xBF, 0xB2, 0xB8, 0xED, 0x68, 0x67, 0x1D, 0xBF, 0x47, 0xB6, 0x6C, 0x89, 0x91, 0xA9,
+    0x1D, 0x7A, 0x42, 0x63, 0x7B, 0x00, 0x73, 0x6C, 0x7A, 0x4A, 0xE8, 0x87, 0x76, 0x3D, 0xB5, 0x05,
+    0x5B, 0x82, 0xFA, 0x9A, 0x51, 0x2B, 0x45, 0x2A, 0xAA, 0x4B, 0xB8, 0xEB, 0xD7, 0x36, 0x57, 0xEC,
+    0xB8, 0xF8, 0x7E, 0x87, 0x34, 0x90, 0x59, 0xE6, 0x60, 0x62, 0x1B, 0x56, 0x98, 0xE7, 0x5D, 0xFC,
+    0x53, 0xC7, 0xC6, 0x02, 0x50, 0x5E, 0x8F, 0x55, 0xEB, 0x28, 0x29, 0x4D, 0xC8, 0x38, 0x57, 0x3B,
+    0x35, 0xC9, 0x5B, 0x2E, 0xFB, 0xDB, 0xB8, 0xB0, 0xD7, 0xC8, 0x52, 0xB8, 0xBF, 0x3A, 0x06, 0x3D,
+    0xC0, 0xFA, 0xA5, 0x1E, 0xE0, 0x68, 0x70, 0x36, 0x07, 0x80, 0xF6, 0xC9, 0x83, 0xF8, 0xFD, 0x82,
+    0x22, 0xB6, 0x1B, 0x08, 0x75, 0xA8, 0xF6, 0xE8, 0xB5, 0x53, 0x8A, 0xAF, 0xCD, 0x4D, 0xEA, 0x3F,
+    0xA3, 0xDB, 0xFE, 0xD8, 0xF9, 0x4F, 0x02, 0x36, 0xFF, 0xB6, 0x49, 0xF6, 0xD7, 0xDE, 0xC3, 0x61,
+    0x7D, 0x9A, 0x86, 0xFD, 0x31, 0xAE, 0x9B, 0x5D, 0xBF, 0x58, 0xA6, 0x6E, 0xE1, 0x84, 0x43, 0xA1,
+    0x38, 0xED, 0xDA, 0x15, 0x52, 0x59, 0xC0, 0xC8, 0x6B, 0x2D, 0x80, 0x53, 0x67, 0x3F, 0x37, 0x3A,
+    0xF4, 0x4B, 0x09, 0x9A, 0xB3, 0x18, 0xE7, 0x47, 0x05, 0x2F, 0x75, 0x22, 0xB2, 0xA0, 0x5B, 0xD9,
+    0x01, 0x2E, 0x67, 0x49, 0x98, 0x9E, 0xC6, 0x2C, 0x18, 0x06, 0x2D, 0x6A, 0xFB, 0x82, 0x4A, 0x06,
+    0x88, 0xF8, 0xA1, 0xF3, 0x39, 0xAA, 0xE2, 0xF0, 0xD4, 0x83, 0xDE, 0x27, 0x1D, 0xFE, 0x26, 0x0B,
+    0x75, 0xB9, 0xDC, 0x9B, 0x05, 0x75, 0x4F, 0xAC, 0x7B, 0xB5, 0x7A, 0xD4, 0x1E, 0x93, 0x2D, 0xB3,
+    0xD6, 0xA8, 0x39, 0xB4, 0xE3, 0x53, 0x1C, 0x03, 0x9E, 0x38, 0xC7, 0x8F, 0xBC, 0xFA, 0x05, 0x3A,
+    0xBA, 0x1C, 0xA1, 0xD8, 0xE1, 0x80, 0xF1, 0xF0, 0xF9, 0x0F, 0xAD, 0x55, 0xAD, 0x8E, 0xDE, 0x46,
+    0x14, 0xBD, 0xB6, 0x55, 0x19, 0x18, 0x4C, 0x48, 0x40, 0x91, 0x79, 0xC9, 0x3C, 0xC2, 0x38, 0x09,
+    0x28, 0x08, 0xD8, 0x05, 0x51, 0x03, 0xF7, 0x11, 0xFA, 0x08, 0xE3, 0x26, 0xA0, 0xA0, 0x20, 0xAF,
+    0x50, 0x1E, 0xD0, 0x37, 0xE8, 0x78, 0x13, 0x50, 0x10, 0x10, 0xB7, 0x55, 0x1B, 0x58, 0x4B, 0x0B,
+    0x0A, 0x0A, 0x32, 0x49, 0xBD, 0x5A, 0xAF, 0x32, 0xE3, 0x93, 0x73, 0xC7, 0x1B, 0x75, 0x51, 0x41,
+    0x55, 0x47, 0xD6, 0x7E, 0x99, 0x9F, 0xFB, 0x73, 0xCE, 0xB9, 0xC7, 0x72, 0x57, 0x1E, 0x89, 0xAF,
+    0xB2, 0xB8, 0x07, 0x49, 0x1C, 0xA2, 0x74, 0x98, 0x84, 0x4B, 0xFA, 0xB4, 0x5B, 0x85, 0x6E, 0xAB,
+    0x77, 0xB3, 0x36, 0xD9, 0xC4, 0x26, 0xF7, 0xB1, 0x49, 0x36, 0xB6, 0xC9, 0x2D, 0xDD, 0xE6, 0x66,
+    0xB3, 0xBA, 0xC9, 0x44, 0x3F, 0xD9, 0x18, 0x26, 0xC7, 0x37, 0x2C, 0xE1, 0x17, 0xCC, 0x1E, 0x6F,
+    0x27, 0x87, 0xAF, 0x27, 0x93, 0xED, 0x28, 0x83, 0x48, 0x05, 0x09, 0xB3, 0x5D, 0xFA, 0xB5, 0xD9,
+    0x9B, 0x5D, 0xDC, 0x8C, 0xA9, 0x49, 0x2E, 0x8A, 0x7F, 0x95, 0x98, 0x09, 0x83, 0x00, 0x8B, 0x18,
+    0x64, 0x9E, 0x0B, 0x51, 0xFA, 0x77, 0x10, 0xA6, 0xDB, 0x78, 0x2E, 0xF0, 0x1C, 0x2F, 0x68, 0xF8,
+    0x2E, 0x55, 0x3C, 0xC8, 0xD3, 0x91, 0x05, 0x62, 0xAA, 0x00, 0x48, 0x77, 0x7D, 0xA6, 0xA7, 0xDC,
+    0x2C, 0xE0, 0xBF, 0x36, 0xB5, 0x49, 0xEC, 0xDC, 0x47, 0xFE, 0x0E, 0x23, 0x2F, 0x66, 0xE9, 0x17,
+    0xC3, 0xFF, 0x0D, 0x7E, 0x3A, 0x4B, 0xF5, 0xDE, 0x60, 0x31, 0x9B, 0x81, 0x5E, 0x58, 0x78, 0xA4,
+    0x3C, 0x15, 0x13, 0x23, 0x76, 0x18, 0xD9, 0xB0, 0xE3, 0xD6, 0x2E, 0x48, 0x35, 0xD6, 0x06, 0xD1,
+    0x60, 0xEA, 0xDF, 0x4E, 0x81, 0xA1, 0x7C, 0x73, 0x95, 0x9A, 0x94, 0xEC, 0x1F, 0x8B, 0xF9, 0xFB,
+    0x5D, 0x0E, 0x83, 0x7F, 0xF6, 0xFA, 0x22, 0x55, 0xD9, 0x05, 0x13, 0xBB, 0x88, 0xCD, 0x8D, 0xEE,
+    0x25, 0xCE, 0x79, 0xD1, 0xEC, 0xDD, 0xDA, 0x6E, 0x2E, 0xBA, 0xC9, 0xCE, 0x18, 0x51, 0x9A, 0x1E,
+    0xC3, 0xE8, 0x16, 0xB7, 0x98, 0xD5, 0xAC, 0x5A, 0x5E, 0x85, 0x63, 0x11, 0x98, 0xD9, 0xC4, 0x6A,
+    0x80, 0xD4, 0xE6, 0xC7, 0xA8, 0x75, 0x11, 0xA3, 0x76, 0x62, 0xA2, 0x89, 0x7A, 0xB2, 0xD6, 0x45,
+    0x8C, 0xA5, 0x48, 0x96, 0x27, 0x01, 0xB1, 0x06, 0xB6, 0x16, 0x0F, 0x93, 0x61, 0x67, 0x24, 0x63,
+    0xB7, 0xB1, 0xD9, 0xDD, 0x52, 0xDE, 0xEC, 0x66, 0x12, 0x32, 0x77, 0x49, 0x53, 0xD9, 0xD5, 0xB3,
+    0x7A, 0x4C, 0x2D, 0x91, 0xAD, 0xB0, 0x89, 0x7C, 0x76, 0xD3, 0x6B, 0xB2, 0x6B, 0x9D, 0x90, 0x1B,
+    0x80, 0x58, 0xBC, 0x41, 0xC3, 0x62, 0xDA, 0x4C, 0x72, 0x93, 0xA2, 0xDD, 0x14, 0x82, 0x95, 0xDC,
+    0x9E, 0x05, 0xD8, 0x7F, 0xC8, 0x5D, 0x3D, 0x09, 0x0E, 0x23, 0x61, 0xD5, 0xA7, 0x89, 0x61, 0x16,
+    0xEF, 0x30, 0x90, 0x89, 0x24, 0xB8, 0xC4, 0x6C, 0x92, 0x06, 0x21, 0xAA, 0xBC, 0x9B, 0xEB, 0xBD,
+    0xF0, 0xD1, 0x12, 0x30, 0x09, 0x13, 0x6F, 0x6E, 0x5D, 0xD6, 0xEE, 0xD6, 0xB0, 0x98, 0x72, 0x81,
+    0x80, 0xF6, 0xEF, 0x31, 0xD6, 0x7B, 0x35, 0xF0, 0x24, 0xE3, 0x65, 0x06, 0x75, 0x14, 0x1B, 0xB9,
+    0x13, 0xA2, 0x20, 0x62, 0x56, 0xB9, 0xA9, 0x37, 0x64, 0xB6, 0xBD, 0x58, 0xE4, 0x16, 0x5F, 0x4D,
+    0x14, 0x64, 0xBF, 0x0A, 0x63, 0x09, 0xD9, 0xD3, 0x5B, 0xBC, 0x54, 0xFE, 0x2C, 0x5C, 0xBC, 0xF7,
+    0x7D, 0x8F, 0x5D, 0x0F, 0x97, 0x7E, 0x4F, 0x6F, 0x02, 0x88, 0x2F, 0xC9, 0xED, 0x6B, 0xBC, 0x54,
+    0x3E, 0xF1, 0x41, 0x7B, 0x7F, 0xC3, 0x9A, 0x47, 0x4C, 0x21, 0xDA, 0xC5, 0xCF, 0x76, 0xED, 0x36,
+    0x95, 0x16, 0x01, 0xDD, 0x18, 0x0C, 0x0F, 0xF8, 0x8A, 0x3B, 0x07, 0x15, 0xD7, 0xAB, 0xA8, 0x89,
+    0x82, 0xBE, 0x05, 0x6F, 0xDD, 0x4E, 0xB7, 0xB6, 0xC3, 0xA8, 0x5B, 0xCA, 0x32, 0xEF, 0x26, 0x2E,
+    0x29, 0x27, 0x05, 0x06, 0x09, 0x83, 0x76, 0xC8, 0x8E, 0x28, 0x87, 0xA5, 0xE8, 0x59, 0xDC, 0x2B,
+    0xB6, 0x05, 0xAD, 0x79, 0xCF, 0xCA, 0x28, 0xD1, 0xB4, 0xD4, 0xB3, 0x78, 0x6D, 0x1B, 0x0A, 0xC4,
+    0xCE, 0x1F, 0x05, 0x64, 0x65, 0xBD, 0xE3, 0xF2, 0x17, 0xD4, 0x26, 0x27, 0x83, 0x5B, 0xFA, 0xA3,
+    0xBB, 0x96, 0x5B, 0x8F, 0x27, 0x62, 0x62, 0xB9, 0x7C, 0xC0, 0xD5, 0x68, 0x94, 0x43, 0xD3, 0x5E,
+    0x6F, 0x13, 0x0C, 0x86, 0xC7, 0xAA, 0xA3, 0x82, 0xC1, 0x5D, 0xC3, 0x47, 0x1B, 0xFD, 0xB7, 0x6C,
+    0x83, 0xD2, 0xFC, 0x2E, 0x99, 0x68, 0x2F, 0xF6, 0x26, 0x75, 0x1B, 0xEE, 0x81, 0xFA, 0x99, 0x29,
+    0xBE, 0x13, 0xEE, 0x84, 0x17, 0xE0, 0x28, 0xCF, 0xFE, 0xCF, 0x1C, 0x14, 0x2E, 0xD6, 0x08, 0x1D,
+    0x4C, 0xEA, 0x68, 0xBC, 0x9D, 0xA7, 0xD2, 0x4A, 0x0B, 0x55, 0x85, 0x41, 0x31, 0x5A, 0x74, 0x7B,
+    0x54, 0x30, 0x52, 0x62, 0x94, 0xD5, 0xA8, 0x80, 0x4A, 0xB7, 0x05, 0x92, 0x76, 0xC5, 0x1D, 0xA7,
+    0x1D, 0x06, 0xA5, 0xBA, 0xB4, 0x52, 0x1A, 0x2F, 0x8D, 0xE9, 0xDE, 0x5F, 0x1B, 0x7F, 0xB0, 0x73,
+    0x1B, 0xDD, 0xCC, 0x19, 0x0F, 0x53, 0x4F, 0xC7, 0x19, 0xFE, 0x83, 0xED, 0x5C, 0x7A, 0x2A, 0xDB,
+    0xE1, 0x24, 0x9B, 0x4C, 0xFC, 0x06, 0x2D, 0xB6, 0xA5, 0x1C, 0x3A, 0x56, 0xDE, 0x45, 0xBD, 0x43,
+    0xF2, 0x7E, 0xE2, 0x0C, 0x92, 0xB7, 0xC4, 0x69, 0xBB, 0x20, 0xA3, 0x27, 0xAB, 0x49, 0xEE, 0x12,
+    0x91, 0x13, 0x79, 0xCE, 0xCB, 0x15, 0x9E, 0xAD, 0x45, 0x59, 0x64, 0x95, 0xE5, 0x1F, 0x0D, 0x6A,
+    0x2D, 0xD4, 0x75, 0x78, 0xC2, 0x19, 0xE7, 0x8C, 0x12, 0xCF, 0x9B, 0xF4, 0x6D, 0x19, 0x95, 0xA3,
+    0x4C, 0x09, 0x4F, 0xB9, 0x3D, 0x94, 0x6D, 0x6E, 0xB9, 0xA9, 0x2F, 0xDB, 0x94, 0x16, 0xE7, 0x8B,
+    0xDC, 0xE2, 0xC9, 0x5E, 0x53, 0x77, 0x73, 0xF8, 0x9D, 0xFA, 0x8B, 0x3D, 0xAE, 0xB0, 0x73, 0x6B,
+    0x45, 0xFA, 0x51, 0x9C, 0xD6, 0x30, 0xD0, 0x26, 0xEF, 0x14, 0xB7, 0xFD, 0x7F, 0x53, 0x65, 0x4D,
+    0x05, 0xFC, 0xAA, 0xA9, 0x7C, 0xD4, 0x54, 0x0A, 0x8D, 0xDC, 0x39, 0x48, 0xA4, 0x52, 0xE5, 0x13,
+    0x8D, 0xE4, 0xD1, 0xE9, 0x90, 0x15, 0xF7, 0xA7, 0xAE, 0x1F, 0xE7, 0x1B, 0x49, 0xF9, 0xDF, 0x06,
+    0x15, 0xD3, 0x40, 0x49, 0xD0, 0x18, 0x7F, 0x50, 0xAB, 0x2D, 0xA3, 0x1D, 0xFB, 0xE2, 0x54, 0x9A,
+    0x91, 0x2A, 0xED, 0x8B, 0xDB, 0x30, 0x6A, 0x75, 0x5A, 0xFC, 0x9E, 0x8A, 0x50, 0x00, 0xED, 0x72,
+    0x40, 0xA8, 0x6C, 0x67, 0x15, 0x09, 0xB5, 0x77, 0x79, 0x4A, 0xFD, 0xD2, 0xCC, 0xD4, 0x92, 0x91,
+    0xE8, 0x8D, 0x7B, 0x60, 0x93, 0x7E, 0x72, 0x3F, 0x17, 0xD3, 0x7B, 0x98, 0x74, 0xE2, 0xF8, 0xB5,
+    0xA0, 0x66, 0xD9, 0xE2, 0x07, 0x1D, 0xBB, 0x80, 0x8D, 0x0A, 0xF1, 0x54, 0xC7, 0x78, 0xD8, 0x99,
+    0x66, 0x20, 0x14, 0xC5, 0x02, 0xF4, 0xD5, 0xD0, 0x5D, 0x7E, 0x24, 0x6A, 0x7C, 0x7C, 0x23, 0x63,
+    0x6E, 0x8A, 0x89, 0x3D, 0xCC, 0x8C, 0xF8, 0x18, 0xB5, 0x5B, 0x5A, 0xBD, 0x7E, 0x3B, 0xF6, 0x4F,
+    0xA6, 0x58, 0x85, 0x8D, 0xB1, 0xA7, 0x9E, 0xAE, 0x7F, 0x9F, 0xAA, 0xE4, 0xB4, 0xD2, 0x0D, 0x9F,
+    0xB3, 0x0C, 0xB0, 0xC0, 0xE5, 0xEE, 0xD9, 0xAA, 0x81, 0x1B, 0x7C, 0xDE, 0xE2, 0x4B, 0xE0, 0x1B,
+    0x0E, 0x02, 0x9D, 0xAF, 0xF0, 0x74, 0x7C, 0x1A, 0x59, 0xD8, 0x46, 0xDD, 0xF6, 0xEA, 0x6C, 0x23,
+    0x3B, 0xA2, 0x54, 0xB3, 0x8D, 0x2A, 0x4C, 0x37, 0xFB, 0x17, 0x4A, 0x24, 0x31, 0xA3, 0x86, 0xB5,
+    0xA8, 0x8D, 0xB3, 0x28, 0x6C, 0xF1, 0x39, 0xCF, 0x1E, 0x7C, 0xD1, 0x81, 0x26, 0x65, 0x11, 0x4F,
+    0xD1, 0xD0, 0xF0, 0xB1, 0x52, 0xE3, 0xD0, 0x01, 0xA8, 0x75, 0x4A, 0xA4, 0xE4, 0xA9, 0x8A, 0xA9,
+    0xF1, 0xD3, 0xA8, 0x1F, 0xBD, 0x4E, 0x11, 0xD4, 0x03, 0x86, 0xBE, 0xA5, 0x19, 0x87, 0xF2, 0x3D,
+    0x24, 0x39, 0xC4, 0x43, 0x3F, 0x8C, 0x17, 0xBB, 0x50, 0x4B, 0x73, 0x0D, 0x35, 0xA4, 0xB9, 0xD8,
+    0xEF, 0xD6, 0x10, 0xD2, 0x41, 0xFE, 0xFD, 0xF9, 0x08, 0xC5, 0x55, 0xB1, 0xAE, 0xDD, 0x44, 0x10,
+    0x1D, 0xDB, 0x8A, 0x2C, 0x61, 0x89, 0x6D, 0xA0, 0x76, 0x4F, 0xE3, 0x4F, 0x58, 0xE7, 0x0B, 0xB8,
+    0x45, 0x42, 0x8A, 0x14, 0x7C, 0x02, 0x9F, 0xB0, 0x8E, 0x28, 0xD2, 0xF2, 0x1F, 0x48, 0xFC, 0x82,
+    0x17, 0x5E, 0x41, 0x91, 0x02, 0x8B, 0x14, 0xB4, 0x2B, 0x24, 0xAA, 0x14, 0x59, 0xC0, 0x48, 0xCE,
+    0xCB, 0xEE, 0x1E, 0xCE, 0xAC, 0xDF, 0x7D, 0x7A, 0x05, 0x42, 0x48, 0x20, 0x61, 0x69, 0x56, 0xB2,
+    0x77, 0x77, 0xE6, 0xCC, 0x99, 0x33, 0x63, 0x79, 0x74, 0x11, 0xE9, 0x93, 0x48, 0x9B, 0x45, 0xA4,
+    0xD0, 0x2C, 0xED, 0x91, 0xD4, 0x67, 0xC0, 0x22, 0x0E, 0xB1, 0x01, 0x8E, 0xAE, 0xF4, 0x69, 0x48,
+    0x7D, 0x32, 0xFB, 0x70, 0x4C, 0x7F, 0xAC, 0xBB, 0x05, 0x36, 0xDA, 0x6C, 0x6F, 0xBF, 0x12, 0xBB,
+    0xF1, 0x56, 0x10, 0x99, 0xF6, 0x7E, 0x31, 0xC0, 0x32, 0xD0, 0x1A, 0xE4, 0xD3, 0xCD, 0xF0, 0x22,
+    0xC8, 0xF8, 0xFA, 0x90, 0x89, 0x66, 0x6E, 0xA2, 0x5C, 0x9F, 0xFF, 0xC2, 0xB7, 0x3E, 0xF5, 0x80,
+    0xA7, 0x3B, 0x78, 0x73, 0xDA, 0x22, 0x98, 0xA5, 0x41, 0x33, 0xB7, 0xB0, 0x7B, 0x5B, 0x90, 0x3B,
+    0xA0, 0x74, 0xB8, 0x41, 0x8F, 0x06, 0x43, 0x6E, 0x61, 0x52, 0x5B, 0xCC, 0xDE, 0x65, 0x13, 0xBB,
+    0x34, 0xC6, 0x3E, 0x4D, 0x61, 0x48, 0x76, 0x1B, 0x0E, 0xBB, 0x99, 0xDD, 0x7A, 0x13, 0x9D, 0x1F,
+    0x89, 0x73, 0x0A, 0x67, 0x64, 0xB7, 0xC9, 0x27, 0xF0, 0x62, 0xE9, 0xD4, 0x16, 0x05, 0xC2, 0xA0,
+    0xCD, 0x13, 0x11, 0x93, 0xCE, 0x33, 0x6E, 0x11, 0x51, 0xEE, 0x2E, 0x27, 0x1E, 0x07, 0xC6, 0xC5,
+    0x26, 0x40, 0x94, 0x30, 0xD1, 0x8F, 0xFA, 0x72, 0x91, 0x00, 0xF5, 0xDB, 0xD2, 0x13, 0xBB, 0x21,
+    0x44, 0x75, 0xA3, 0xDE, 0x6D, 0xEC, 0x65, 0x02, 0xF8, 0x0D, 0xD2, 0x3E, 0xCC, 0x6B, 0xCD, 0xB2,
+    0x22, 0x4C, 0xC8, 0x3D, 0x3E, 0xF3, 0x8C, 0x3F, 0xEE, 0xDC, 0x7F, 0x3A, 0x5B, 0x24, 0xA6, 0xB3,
+    0xD8, 0x5F, 0x2E, 0x5D, 0xAE, 0x1E, 0x3A, 0x3C, 0x0E, 0x23, 0x0A, 0x7D, 0x87, 0x16, 0xC7, 0x15,
+    0xC6, 0x80, 0xC0, 0x63, 0x1E, 0xD8, 0x49, 0x6A, 0x83, 0x13, 0x2D, 0xB7, 0x3B, 0xA2, 0x32, 0xEA,
+    0xED, 0xEE, 0x72, 0xF9, 0x70, 0x76, 0x1B, 0x90, 0x18, 0x7E, 0x5E, 0x09, 0xEB, 0x8C, 0xDE, 0x25,
+    0x71, 0x7E, 0x48, 0x62, 0xE7, 0xFA, 0x3A, 0xC6, 0x16, 0x3C, 0xCD, 0x80, 0xD6, 0x53, 0x2A, 0xEB,
+    0x62, 0x0E, 0x52, 0x3C, 0xB2, 0x76, 0x24, 0x40, 0xBF, 0x6E, 0xFA, 0xD5, 0xEB, 0xD1, 0xFE, 0xFB,
+    0xCD, 0xBA, 0x25, 0xE7, 0xEE, 0xE7, 0xBB, 0x4A, 0x3B, 0xDF, 0x16, 0xE1, 0x79, 0xBB, 0xF1, 0x34,
+    0x8F, 0x91, 0x31, 0xCC, 0xBC, 0x43, 0x56, 0x56, 0xDF, 0x71, 0x6B, 0xA7, 0x53, 0x6E, 0x31, 0x9A,
+    0x5C, 0x63, 0xF3, 0x52, 0x7D, 0xBF, 0x0B, 0x5F, 0x11, 0x30, 0xF9, 0x13, 0x71, 0xAE, 0xE5, 0x56,
+    0xC5, 0x32, 0x22, 0x1D, 0x6B, 0xB1, 0xB9, 0xAD, 0x39, 0x4E, 0x77, 0xDB, 0xDB, 0x75, 0x7B, 0xB8,
+    0xDF, 0xFE, 0x5A, 0x19, 0xDE, 0x94, 0x81, 0xE1, 0x5D, 0xA5, 0x07, 0x8A, 0x8F, 0xBA, 0xE0, 0x6A,
+    0xB4, 0x5C, 0xD2, 0x94, 0x67, 0xA9, 0xCA, 0x89, 0xC1, 0x09, 0xA2, 0xCF, 0x4F, 0x14, 0xC7, 0x8A,
+    0x44, 0x2F, 0x46, 0x8F, 0x43, 0xF0, 0x06, 0x8B, 0x89, 0x63, 0x1C, 0x52, 0x53, 0x18, 0xCF, 0x79,
+    0xBB, 0x8D, 0x61, 0x38, 0x9E, 0x27, 0xBE, 0xE0, 0x53, 0xEE, 0x15, 0x44, 0x1E, 0xE4, 0x1D, 0xE2,
+    0x52, 0x91, 0x7E, 0x74, 0xCA, 0x42, 0xB7, 0x67, 0x4D, 0x80, 0x6B, 0xA7, 0x37, 0x09, 0x53, 0xD3,
+    0xE9, 0xA9, 0x43, 0xAE, 0xF9, 0x59, 0xA9, 0x88, 0x58, 0x56, 0xA3, 0xEB, 0x5E, 0x57, 0x2A, 0xD3,
+    0x1C, 0x43, 0x9A, 0x22, 0x95, 0x9A, 0x6C, 0x30, 0x7B, 0x4F, 0x8D, 0x9A, 0xC3, 0x24, 0xEB, 0x79,
+    0x76, 0x77, 0x9E, 0xF5, 0xDD, 0x98, 0xE3, 0x5A, 0x94, 0xA5, 0x66, 0xFE, 0x9B, 0x6E, 0x90, 0xDA,
+    0x0D, 0x4D, 0xF9, 0x8B, 0x6E, 0x48, 0xFF, 0xB4, 0x1B, 0xE4, 0x29, 0x4D, 0xE5, 0xAC, 0xD4, 0x9E,
+    0x73, 0x82, 0xBA, 0x6F, 0x2E, 0xD7, 0xFA, 0xB0, 0xAF, 0x98, 0xD9, 0x6C, 0x83, 0xEA, 0x84, 0x62,
+    0xB3, 0x37, 0x5A, 0x6E, 0xC5, 0x87, 0x9D, 0x0C, 0x17, 0x25, 0x7B, 0x93, 0xF1, 0x3D, 0x88, 0x85,
+    0xFE, 0xA6, 0x80, 0xA5, 0xCB, 0x2A, 0x31, 0x6F, 0x03, 0x79, 0x00, 0xCB, 0x45, 0x85, 0x8B, 0x4E,
+    0x23, 0xAD, 0x9A, 0xAA, 0xA0, 0x76, 0x95, 0xA3, 0x7D, 0x5C, 0x63, 0xF4, 0x07, 0xF1, 0x1E, 0xF7,
+    0x58, 0xF3, 0x48, 0xBC, 0x13, 0xF1, 0xDA, 0xF0, 0x10, 0xEB, 0x14, 0x57, 0x6F, 0x69, 0x6B, 0x58,
+    0x7F, 0xC4, 0xE6, 0xF0, 0xD6, 0x5B, 0x7C, 0xE1, 0x4D, 0x9E, 0x16, 0xA9, 0x3C, 0x5D, 0x18, 0x61,
+    0xF4, 0x54, 0x96, 0xFD, 0x32, 0x9D, 0x98, 0x64, 0x4D, 0xF7, 0x31, 0xB4, 0xE4, 0x14, 0x25, 0x98,
+    0x10, 0x95, 0xC4, 0x7A, 0xEC, 0x2A, 0xD9, 0x8D, 0xBA, 0x5B, 0x5F, 0x10, 0x79, 0x61, 0x5D, 0xFB,
+    0x44, 0x81, 0x98, 0xDF, 0x54, 0x67, 0x3F, 0x90, 0x0E, 0xAC, 0x5A, 0xD9, 0x24, 0xB5, 0xBF, 0x65,
+    0x84, 0x12, 0xA3, 0x13, 0x82, 0xBC, 0x9F, 0x54, 0x69, 0x93, 0x6B, 0xB1, 0x3F, 0x58, 0x99, 0x96,
+    0x65, 0xEB, 0xA9, 0x08, 0xA5, 0xAD, 0x55, 0xFB, 0xD7, 0x29, 0x3D, 0xD6, 0xA2, 0x68, 0x34, 0xD5,
+    0xEF, 0x39, 0xC3, 0xDB, 0x3A, 0x96, 0x5A, 0xED, 0x30, 0xC5, 0x2F, 0xEB, 0x8D, 0xB6, 0x6D, 0x57,
+    0xC6, 0x9D, 0xC2, 0x53, 0x77, 0x44, 0xE5, 0xBE, 0x65, 0xE7, 0xC6, 0x96, 0x63, 0x57, 0xA8, 0x91,
+    0x9D, 0x55, 0x2F, 0x4C, 0x9C, 0x7A, 0x3E, 0x54, 0x9E, 0x0D, 0x82, 0x21, 0x08, 0x4E, 0x29, 0xD6,
+    0x24, 0xBA, 0x42, 0x26, 0xDC, 0x0D, 0x08, 0x4C, 0xF0, 0xF9, 0xDB, 0xA8, 0xDD, 0x0B, 0xFB, 0x2A,
+    0xB1, 0xA8, 0x3B, 0x38, 0x1B, 0x27, 0x4A, 0x89, 0xA1, 0x5D, 0x1E, 0xB4, 0xA5, 0x10, 0x27, 0x15,
+    0x39, 0x16, 0xC7, 0x24, 0x07, 0x75, 0xAF, 0x68, 0xCC, 0xDE, 0x66, 0xE6, 0xC3, 0x0C, 0x75, 0x65,
+    0x7E, 0xF4, 0xCB, 0x0C, 0xB9, 0x9A, 0x68, 0x99, 0xDF, 0xC8, 0xD5, 0x45, 0xBB, 0x59, 0x0F, 0x02,
+    0xB4, 0xDF, 0xB1, 0x8D, 0xE6, 0xE9, 0x35, 0x7E, 0x25, 0xCA, 0x37, 0xEF, 0x7F, 0x4F, 0xA4, 0xF5,
+    0x15, 0x49, 0x33, 0x78, 0x59, 0xA7, 0x57, 0x47, 0xA6, 0x07, 0xCA, 0x78, 0x21, 0xC1, 0xDA, 0x4C,
+    0x2C, 0xD0, 0x29, 0x7C, 0x16, 0x86, 0xA3, 0x34, 0xDA, 0xD3, 0x42, 0x53, 0x7F, 0x03, 0xCA, 0xFE,
+    0x2D, 0xAD, 0x0E, 0x44, 0x9D, 0x9D, 0xB9, 0x4F, 0x7D, 0x21, 0xEB, 0x30, 0x6A, 0x7B, 0x57, 0x0C,
+    0xC5, 0x3B, 0xDE, 0xAE, 0x89, 0x77, 0xF5, 0xD7, 0x43, 0x76, 0xDF, 0x5D, 0xE7, 0x4E, 0xD2, 0x31,
+    0xDD, 0xA4, 0x55, 0x79, 0x2D, 0xD0, 0xC6, 0xC5, 0x4F, 0x75, 0xAD, 0x4D, 0xAC, 0x42, 0xA9, 0x18,
+    0xBE, 0x99, 0xD5, 0x1F, 0xB4, 0x55, 0x75, 0x96, 0xC6, 0xAE, 0x3C, 0x4F, 0x5A, 0x4B, 0xAD, 0x66,
+    0x5D, 0x83, 0x6A, 0xDD, 0x6E, 0x1D, 0xF8, 0x73, 0xE3, 0xB4, 0x43, 0x20, 0x54, 0xFE, 0x28, 0x1E,
+    0x34, 0xEE, 0xFF, 0xF5, 0xFC, 0x09, 0xA5, 0x55, 0xBD, 0x6E, 0xDE, 0x36, 0x14, 0xBD, 0x92, 0x8A,
+    0x0A, 0x88, 0x06, 0x66, 0xE8, 0xD4, 0x0E, 0x7A, 0x04, 0x3E, 0x02, 0xE5, 0x76, 0xC8, 0xD0, 0x21,
+    0x19, 0x1A, 0x74, 0xE8, 0xE0, 0x47, 0xF0, 0x0B, 0x04, 0xA5, 0xD2, 0x0C, 0x1E, 0x3A, 0xB4, 0x53,
+    0x3A, 0x66, 0x69, 0x97, 0x2F, 0x43, 0x5F, 0xA0, 0x00, 0x69, 0x7B, 0xC8, 0xE0, 0xC1, 0x42, 0x8D,
+    0x20, 0xA3, 0xE5, 0x38, 0x68, 0x51, 0x74, 0xA8, 0x0A, 0xCB, 0x81, 0x1C, 0x93, 0xBC, 0x3D, 0x97,
+    0xFA, 0xEC, 0x17, 0xA8, 0x80, 0xEF, 0x52, 0xFA, 0x44, 0xDD, 0xBF, 0x73, 0xEE, 0x21, 0xD1, 0x7A,
+    0x99, 0x81, 0x34, 0xFF, 0x48, 0xC6, 0x97, 0xCC, 0x81, 0xAC, 0x57, 0xCC, 0x33, 0x39, 0x6F, 0xD2,
+    0xCB, 0x89, 0xB8, 0x77, 0x23, 0x3D, 0x22, 0xDE, 0xE1, 0x1E, 0x3B, 0xB9, 0x62, 0xD8, 0x82, 0xAB,
+    0x88, 0xA5, 0xE4, 0x5F, 0xD3, 0xE6, 0x67, 0xAA, 0x98, 0x65, 0x7F, 0x5E, 0xA6, 0xDB, 0xA5, 0x0E,
+    0x6A, 0xC2, 0x96, 0x66, 0xC9, 0x8B, 0x9A, 0xD5, 0xBC, 0x2E, 0x0B, 0x96, 0x76, 0x6A, 0x22, 0x7D,
+    0x84, 0xA5, 0xE6, 0xE7, 0xBF, 0x91, 0x1E, 0x2B, 0x89, 0x8A, 0x1C, 0xF2, 0xE2, 0xA9, 0xE5, 0x77,
+    0x39, 0xAB, 0xAF, 0xB6, 0xD9, 0x51, 0x15, 0x90, 0x5E, 0x27, 0xDB, 0x99, 0x5C, 0x6F, 0x79, 0xAE,
+    0x52, 0xC5, 0xCF, 0xBD, 0x9A, 0x35, 0x7C, 0x1B, 0xCF, 0x1D, 0x12, 0xC2, 0x45, 0x0D, 0x67, 0x0F,
+    0xB0, 0x23, 0xF1, 0x4F, 0xE9, 0xB1, 0x24, 0x81, 0xB0, 0x7A, 0x32, 0x23, 0xE1, 0x43, 0x37, 0x3E,
+    0xA9, 0x22, 0x76, 0x4E, 0x6A, 0x42, 0x9D, 0xDE, 0xFA, 0x82, 0xAF, 0xC5, 0xFD, 0x27, 0x94, 0x4B,
+    0xF2, 0x08, 0xC4, 0x03, 0x52, 0x16, 0xA3, 0xE0, 0x82, 0xF4, 0x19, 0x8C, 0x39, 0x41, 0x10, 0x7E,
+    0x38, 0x61, 0x47, 0x83, 0xEA, 0xD2, 0x2E, 0x6A, 0x93, 0x72, 0x73, 0x8F, 0x34, 0xF3, 0x42, 0xE6,
+    0xEC, 0x72, 0x21, 0x77, 0x72, 0x19, 0x88, 0xDB, 0x8B, 0x50, 0x26, 0x7D, 0x1A, 0xEA, 0x60, 0x0E,
+    0x83, 0x5A, 0xCC, 0x61, 0x6C, 0x27, 0x18, 0x33, 0xDA, 0xA7, 0xC9, 0x7A, 0xB7, 0x93, 0xE0, 0x34,
+    0x10, 0x1C, 0x20, 0x18, 0x52, 0xA5, 0xF6, 0x9F, 0x01, 0xD5, 0xA1, 0x97, 0xEE, 0xE1, 0x48, 0x6A,
+    0x62, 0xE9, 0xDE, 0x44, 0x16, 0xB5, 0x88, 0xFB, 0x32, 0x39, 0xDB, 0x9B, 0x93, 0xCB, 0xA5, 0x59,
+    0x92, 0x39, 0xE0, 0xF6, 0x34, 0x98, 0xDF, 0xA3, 0x7E, 0x15, 0xF4, 0x61, 0x94, 0x76, 0x99, 0x45,
+    0x3A, 0xD3, 0x00, 0x17, 0xEB, 0xC5, 0x5B, 0xB3, 0x20, 0x1F, 0xDC, 0x75, 0x55, 0x0A, 0x68, 0x35,
+    0xF1, 0x2E, 0x1E, 0xA8, 0xFD, 0x37, 0xA2, 0xD3, 0x55, 0x6C, 0x87, 0x92, 0x37, 0xEE, 0x75, 0xCA,
+    0xFD, 0xE1, 0x31, 0xC3, 0xC4, 0xEB, 0xC3, 0x54, 0x87, 0xE6, 0x3A, 0x3A, 0xB4, 0x88, 0xF5, 0xF1,
+    0x84, 0xB6, 0x5E, 0x04, 0xD7, 0x31, 0x6A, 0x78, 0xB5, 0xB4, 0x13, 0xEF, 0x2F, 0x48, 0xBE, 0x9D,
+    0xDC, 0x17, 0x41, 0x5F, 0x24, 0x35, 0x99, 0xA3, 0x68, 0x3D, 0x57, 0xC1, 0x9C, 0x00, 0x5A, 0xA0,
+    0x95, 0x90, 0x73, 0x57, 0xCF, 0x64, 0x22, 0xE9, 0xA1, 0x40, 0x3B, 0x90, 0xFB, 0xCD, 0x84, 0xC4,
+    0xDC, 0x9E, 0x57, 0x63, 0x15, 0xAC, 0x94, 0xC3, 0xB1, 0xCC, 0x24, 0x51, 0x39, 0xB6, 0x79, 0xCD,
+    0x8E, 0x0F, 0x52, 0x15, 0x23, 0x37, 0xB3, 0xFE, 0xF3, 0x7D, 0xD0, 0x07, 0x08, 0x3C, 0xB3, 0x9A,
+    0x51, 0xE3, 0x62, 0x8F, 0x16, 0xFB, 0xE2, 0x34, 0xB6, 0x63, 0xEE, 0x06, 0x27, 0x69, 0x37, 0xA7,
+    0x7C, 0x1F, 0xA9, 0xCC, 0x54, 0x2B, 0x98, 0x2C, 0x40, 0xE2, 0x0E, 0xD0, 0x93, 0x7D, 0x96, 0x84,
+    0xC2, 0xC7, 0x99, 0x59, 0x02, 0x5B, 0x21, 0x5B, 0x84, 0x0C, 0xE8, 0xAB, 0x96, 0x22, 0xC9, 0xBC,
+    0x09, 0xD8, 0xE9, 0xBE, 0x0F, 0xB6, 0x27, 0x6E, 0x16, 0xDB, 0x97, 0x49, 0xCD, 0xD6, 0x57, 0xE0,
+    0xA8, 0xF5, 0x4D, 0x00, 0x46, 0x99, 0x4C, 0xC6, 0x0B, 0x55, 0x8C, 0xC7, 0x6F, 0x40, 0x65, 0x66,
+    0xCB, 0x26, 0x61, 0x1F, 0x50, 0x51, 0x78, 0x43, 0xF5, 0xE4, 0x3A, 0xAA, 0xDE, 0x47, 0x21, 0xFF,
+    0x2C, 0xF1, 0x00, 0xA2, 0xC0, 0x45, 0x12, 0xA7, 0x0C, 0xCE, 0x74, 0xD5, 0xC2, 0xA6, 0x6F, 0xA6,
+    0x64, 0x7A, 0x75, 0x1E, 0xB5, 0xD7, 0x87, 0x41, 0x7B, 0xF3, 0x0C, 0x06, 0x90, 0x39, 0xEC, 0x92,
+    0xA8, 0xBC, 0x8E, 0x99, 0x34, 0xA3, 0x6F, 0x42, 0xBD, 0x12, 0xB6, 0x47, 0x12, 0x82, 0x5B, 0x91,
+    0x4A, 0xF1, 0x47, 0x92, 0x1B, 0x90, 0x23, 0xFB, 0xC3, 0x84, 0x60, 0x9B, 0x97, 0x12, 0x6A, 0xC5,
+    0x6E, 0x9D, 0x31, 0xF6, 0xEB, 0x63, 0x04, 0xCD, 0x9B, 0x85, 0xC1, 0x4B, 0xE0, 0x27, 0x1C, 0x52,
+    0xB3, 0x39, 0xC7, 0x0D, 0x31, 0x10, 0xC3, 0x23, 0xA0, 0xFB, 0x0E, 0xE5, 0x16, 0xF8, 0xCB, 0x0C,
+    0xDC, 0xE9, 0xB7, 0x00, 0x4F, 0xCD, 0x55, 0x34, 0x03, 0x18, 0xD9, 0x9B, 0xE3, 0xD0, 0xE0, 0x73,
+    0xA2, 0x24, 0xD3, 0xD3, 0xD9, 0xCF, 0xC5, 0xB1, 0x1E, 0x50, 0xD3, 0xA0, 0xA6, 0x66, 0xD2, 0x03,
+    0x90, 0x04, 0x77, 0x00, 0xB3, 0x7E, 0x31, 0x66, 0x28, 0xC7, 0xDC, 0xD4, 0x48, 0x19, 0x4B, 0x5F,
+    0xC5, 0xDD, 0x1B, 0x46, 0xCE, 0xF5, 0x55, 0x48, 0x04, 0x8E, 0x38, 0x94, 0x7C, 0x10, 0x0D, 0x68,
+    0x34, 0xB1, 0x3A, 0x0F, 0xD5, 0x62, 0x1F, 0xCC, 0xB6, 0x88, 0x18, 0x07, 0x38, 0xC1, 0x75, 0x9F,
+    0xE8, 0x49, 0x29, 0x95, 0x28, 0xA1, 0xBF, 0x68, 0x8A, 0x12, 0xF8, 0x2C, 0xF0, 0x69, 0xB6, 0xBE,
+    0x31, 0x5B, 0xD7, 0x36, 0xD0, 0x3D, 0x6A, 0xB0, 0x05, 0xC5, 0x89, 0x8C, 0x88, 0x69, 0x01, 0xFC,
+    0x06, 0xC3, 0x59, 0x81, 0x0D, 0x30, 0x8B, 0xCC, 0x91, 0x10, 0x20, 0x8F, 0xAE, 0x0C, 0x04, 0xCC,
+    0x78, 0x6B, 0x64, 0x88, 0xF7, 0xF0, 0x02, 0x2D, 0xEF, 0x1A, 0x69, 0x77, 0x8B, 0x5E, 0x93, 0xB9,
+    0xEE, 0x6E, 0x77, 0x66, 0x23, 0x4D, 0xC4, 0x8B, 0x41, 0x3C, 0x0D, 0x5B, 0xB5, 0x29, 0xE8, 0xE3,
+    0x9E, 0xBE, 0x45, 0xD8, 0xF2, 0x2A, 0xF5, 0xA8, 0xB2, 0xA3, 0xCF, 0x10, 0xAB, 0x16, 0x0A, 0x60,
+    0x7F, 0x57, 0x0E, 0xAD, 0x30, 0x4D, 0x02, 0xB7, 0xA2, 0x76, 0xA0, 0x82, 0x8D, 0x42, 0x37, 0xD0,
+    0xA1, 0x70, 0x22, 0x22, 0x71, 0x9B, 0x43, 0x1B, 0xE9, 0x1E, 0x02, 0x20, 0xBA, 0xE8, 0xCD, 0x3B,
+    0x32, 0x7F, 0x21, 0x63, 0xF9, 0x16, 0x2C, 0x14, 0x08, 0xB3, 0x7C, 0x74, 0x28, 0x7D, 0x5E, 0x03,
+    0xA3, 0xDF, 0x73, 0xBD, 0x58, 0x0F, 0x1A, 0x9E, 0x27, 0x10, 0x80, 0xBF, 0x9C, 0xEB, 0x80, 0x41,
+    0xF3, 0x7A, 0xC4, 0x18, 0x22, 0xA2, 0xDD, 0xC7, 0x63, 0x19, 0xF5, 0xA8, 0xD0, 0x5D, 0xD7, 0x41,
+    0x1B, 0x0E, 0x63, 0x19, 0xCB, 0x04, 0x91, 0x9D, 0xDB, 0x59, 0x43, 0x6E, 0xD8, 0x9B, 0xCC, 0xAD,
+    0x4C, 0x34, 0xB1, 0x08, 0xF7, 0x29, 0xFF, 0xB2, 0x6A, 0x68, 0x56, 0x5E, 0xB1, 0x4E, 0x94, 0x3C,
+    0xA7, 0x49, 0x59, 0x9D, 0x6F, 0x2F, 0x3D, 0xDE, 0xFD, 0x6F, 0xFC, 0x6D, 0xEB, 0x73, 0xB6, 0xD4,
+    0x20, 0xC7, 0x3C, 0xF6, 0x22, 0xE8, 0xA0, 0xD1, 0x53, 0x9C, 0x00, 0x18, 0x19, 0x0C, 0x0A, 0x6E,
+    0xAA, 0x3C, 0x41, 0xF6, 0x30, 0x55, 0x22, 0x7C, 0x42, 0xAB, 0xA3, 0x88, 0x7D, 0x8B, 0x48, 0x33,
+    0x3F, 0xC0, 0x90, 0x69, 0x50, 0x99, 0xEB, 0x58, 0xA5, 0xF6, 0x0F, 0xD0, 0x7C, 0xA5, 0xBB, 0xD4,
+    0x5F, 0xE6, 0x49, 0x15, 0xF9, 0x92, 0x93, 0x22, 0xA7, 0xD6, 0xDD, 0x25, 0xC5, 0x77, 0x09, 0x97,
+    0xE9, 0x2E, 0xC5, 0xC2, 0x45, 0x11, 0xE7, 0x95, 0xFB, 0xA0, 0xF8, 0x95, 0x9B, 0x21, 0x3F, 0x2A,
+    0xD4, 0x32, 0x05, 0x38, 0x5C, 0xA0, 0x73, 0x00, 0x25, 0xEA, 0xAB, 0xC7, 0x5F, 0x47, 0x09, 0x94,
+    0x4D, 0xC8, 0x06, 0x51, 0x1A, 0x31, 0x92, 0x17, 0xFC, 0x8A, 0x80, 0x8E, 0x06, 0x2E, 0x7C, 0x1B,
+    0xBF, 0x81, 0x8B, 0xAD, 0xC6, 0x48, 0x9D, 0xF9, 0xA4, 0x7B, 0xB4, 0x8D, 0xE8, 0x16, 0x99, 0x72,
+    0x68, 0x4A, 0x50, 0xB1, 0x9D, 0x9D, 0x87, 0x08, 0x92, 0x3B, 0xFB, 0xB0, 0x61, 0xCC, 0xC2, 0x07,
+    0xF8, 0xFD, 0x3B, 0x6D, 0x78, 0x6F, 0xAC, 0x03, 0x46, 0xE9, 0x9C, 0xF7, 0x71, 0x3E, 0xF2, 0x82,
+    0x5F, 0x5F, 0xCA, 0x21, 0x76, 0x3F, 0x77, 0xAF, 0xBE, 0x96, 0x79, 0xBE, 0x14, 0xA9, 0xC6, 0x59,
+    0x62, 0x6F, 0x8C, 0xC7, 0x21, 0x2A, 0x73, 0x09, 0x4C, 0x30, 0xFF, 0x00, 0x19, 0xCA, 0x09, 0xC2,
+    0xB8, 0x1D, 0xA6, 0x02, 0x8D, 0x03, 0x49, 0x24, 0xC3, 0xB7, 0xA8, 0xDA, 0x60, 0xF6, 0x29, 0x01,
+    0xAF, 0xEA, 0x26, 0x48, 0xDD, 0x83, 0x70, 0x56, 0x7A, 0x33, 0x8B, 0x00, 0xA1, 0x6D, 0x4D, 0xA4,
+    0xFF, 0x71, 0xFD, 0x07, 0xA5, 0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xDB, 0x39, 0xAD, 0x14,
+    0x17, 0x9B, 0xE2, 0x22, 0x05, 0x5D, 0xE1, 0x26, 0x05, 0x0D, 0x72, 0x7B, 0x0D, 0xEC, 0xCB, 0x45,
+    0x34, 0xA4, 0x20, 0x91, 0x72, 0x34, 0x48, 0xE4, 0x1F, 0x70, 0x6D, 0x0A, 0x88, 0x2D, 0x90, 0xA0,
+    0xE5, 0x1F, 0x90, 0x22, 0x55, 0x84, 0x74, 0x2D, 0x0D, 0x5A, 0x73, 0x14, 0x29, 0x52, 0xC4, 0xD2,
+    0x95, 0x14, 0x59, 0x20, 0x88, 0x22, 0x05, 0x7B, 0x39, 0x07, 0x7C, 0xB9, 0xF5, 0x0E, 0xDF, 0xAC,
+    0xDF, 0x7B, 0x97, 0x57, 0x63, 0xC9, 0x5E, 0x3F, 0x7B, 0x3D, 0xF3, 0x7D, 0xDF, 0x7C, 0x33, 0x8F,
+    0x88, 0xA8, 0x69, 0x33, 0x6E, 0x3A, 0x85, 0x53, 0xB3, 0xE9, 0xEA, 0x37, 0xA6, 0x33, 0xBD, 0xE9,
+    0x6C, 0x6B, 0x3A, 0xA6, 0xFA, 0x28, 0x52, 0x7D, 0x1C, 0xA8, 0xFA, 0x75, 0xA4, 0xEA, 0xB9, 0x27,
+    0xCD, 0x3D, 0xCE, 0x0E, 0xE7, 0x02, 0x27, 0x51, 0x39, 0x11, 0x6D, 0xDD, 0xB9, 0x4B, 0x64, 0x9E,
+    0x8C, 0xB8, 0xDC, 0xF2, 0x08, 0xA7, 0x7B, 0xA2, 0x9F, 0x74, 0x4B, 0x74, 0x7B, 0x8B, 0xD2, 0x51,
+    0x39, 0xCA, 0x62, 0xD3, 0x91, 0x09, 0x4C, 0x39, 0x9F, 0x22, 0x5A, 0x7C, 0xE6, 0x89, 0x3B, 0xD3,
+    0xA9, 0x40, 0x4C, 0xC6, 0xE5, 0x53, 0xC6, 0x54, 0x0E, 0x7A, 0xA4, 0xBA, 0xC7, 0xBE, 0x66, 0x2F,
+    0xE2, 0x03, 0xED, 0x49, 0x8D, 0xB6, 0x25, 0xFD, 0x47, 0x40, 0xE4, 0x43, 0x47, 0x14, 0x91, 0xB0,
+    0xE0, 0x81, 0x12, 0x02, 0x32, 0x48, 0x4D, 0x16, 0x09, 0x73, 0x60, 0xA1, 0xAB, 0x1F, 0xDE, 0x26,
+    0xF3, 0x14, 0x20, 0x01, 0x56, 0xB9, 0x40, 0xB9, 0xFF, 0x60, 0x0D, 0xE0, 0xFF, 0x12, 0x7C, 0xEB,
+    0x38, 0x90, 0x5C, 0x72, 0x30, 0x87, 0xD5, 0x8D, 0x80, 0x91, 0x9B, 0x37, 0x76, 0x98, 0x6F, 0x9C,
+    0xE2, 0x39, 0xAF, 0x23, 0x8B, 0x14, 0x7A, 0x34, 0x9E, 0xAA, 0x41, 0xD8, 0x56, 0x03, 0x15, 0x93,
+    0xF6, 0x45, 0x2C, 0xF1, 0x35, 0xEF, 0x81, 0x76, 0x11, 0xC1, 0xA4, 0xB7, 0x0B, 0x6E, 0x11, 0xB9,
+    0xF2, 0x95, 0x6B, 0x00, 0x8E, 0xCA, 0xA0, 0x46, 0xE3, 0x64, 0x37, 0x13, 0x57, 0x5E, 0x01, 0x04,
+    0xB7, 0xE6, 0xD9, 0x40, 0xD8, 0x64, 0x3B, 0x0D, 0x09, 0x8D, 0x43, 0xF8, 0x3C, 0x4E, 0xA4, 0x27,
+    0x6A, 0x3C, 0x59, 0xA6, 0x8C, 0xFF, 0x04, 0x80, 0x0A, 0x3B, 0x0C, 0xF3, 0x48, 0x0A, 0xB0, 0x0A,
+    0x16, 0xB5, 0xC0, 0x08, 0x8F, 0xA1, 0x1F, 0xBE, 0x41, 0xB5, 0x70, 0x42, 0xDA, 0xF9, 0x80, 0xE2,
+    0xF3, 0x51, 0x2E, 0xD9, 0x64, 0x87, 0x71, 0xF9, 0xC4, 0xAE, 0x6E, 0xEA, 0xD5, 0x4D, 0x79, 0xB6,
+    0x21, 0x45, 0xC9, 0xAD, 0x1A, 0x81, 0xBD, 0xE2, 0x80, 0xEA, 0xD5, 0xBE, 0x62, 0xA9, 0xA8, 0x1E,
+    0xF4, 0x74, 0x30, 0x68, 0x5F, 0x86, 0x72, 0x2A, 0x62, 0x11, 0x0A, 0x5C, 0x01, 0xD9, 0xEE, 0x71,
+    0xDA, 0x54, 0xF7, 0xBC, 0x68, 0xBA, 0x72, 0x44, 0x65, 0xBB, 0xDA, 0xE1, 0x55, 0x34, 0xF8, 0x05,
+    0x5A, 0xE6, 0x7B, 0xB0, 0x21, 0x54, 0xE8, 0x6F, 0x90, 0xE9, 0x8C, 0x2B, 0x40, 0xA1, 0x1A, 0x85,
+    0x59, 0x10, 0x1A, 0x63, 0x82, 0x61, 0x12, 0x2F, 0xA9, 0xF8, 0x0B, 0x11, 0x04, 0x70, 0x45, 0xE5,
+    0x59, 0x7E, 0x20, 0x59, 0xAE, 0x33, 0xB9, 0xCB, 0xCB, 0x6A, 0x48, 0xA0, 0xB9, 0x2C, 0xC3, 0xF2,
+    0xBD, 0x9B, 0x99, 0xE2, 0x73, 0xCA, 0x85, 0xF6, 0x4E, 0xD2, 0x86, 0x21, 0x5C, 0x23, 0x7A, 0xE1,
+    0x0E, 0x9E, 0x1C, 0x7F, 0xB4, 0x7D, 0x3D, 0x92, 0x0E, 0x1A, 0x5E, 0x62, 0xF8, 0x94, 0x9A, 0x23,
+    0x64, 0xAE, 0x3C, 0xD2, 0xAA, 0x80, 0x5C, 0x19, 0x8B, 0x8A, 0xF6, 0x17, 0x31, 0xA7, 0x13, 0xB3,
+    0x0C, 0xA9, 0x6E, 0xD8, 0xAE, 0x62, 0xCE, 0xDF, 0xDC, 0xE2, 0x14, 0x68, 0xA1, 0x78, 0x19, 0x78,
+    0x81, 0x30, 0xD3, 0x4A, 0xFB, 0xEC, 0xE1, 0x5A, 0x46, 0xD8, 0x34, 0x4B, 0xB4, 0x18, 0x0E, 0xE5,
+    0x00, 0xAE, 0xFC, 0x15, 0x7F, 0x56, 0x23, 0x8F, 0x0A, 0xA0, 0xC6, 0xB5, 0x9F, 0x7D, 0xFD, 0x2A,
+    0x22, 0xBA, 0x6D, 0x8B, 0x58, 0xF9, 0x3D, 0x96, 0x5D, 0xAD, 0xC5, 0x27, 0xA5, 0xB8, 0xAF, 0x91,
+    0xE0, 0xC2, 0xE4, 0xDA, 0x46, 0x7D, 0x66, 0xDE, 0x46, 0xB4, 0x22, 0xBA, 0xAF, 0x52, 0x85, 0xEF,
+    0xF8, 0xED, 0x44, 0x7E, 0xA9, 0xC9, 0xEE, 0xBC, 0xCC, 0x8A, 0xE5, 0x8B, 0x8B, 0x8F, 0x73, 0xEE,
+    0x15, 0xA2, 0xD6, 0x3C, 0xD4, 0x50, 0xC7, 0x32, 0xAA, 0x3B, 0xE4, 0xFC, 0xD2, 0x69, 0x0B, 0x84,
+    0xB4, 0x40, 0x5B, 0x24, 0xC7, 0x14, 0x31, 0x39, 0x48, 0x40, 0xA5, 0xA5, 0x9E, 0x97, 0x24, 0x31,
+    0x16, 0xA9, 0x48, 0x31, 0x61, 0x61, 0x52, 0x58, 0xA4, 0xC9, 0x21, 0x1D, 0xEA, 0x8C, 0x96, 0xE8,
+    0x8B, 0x49, 0x9A, 0xC2, 0x15, 0xF0, 0xB2, 0xAF, 0x07, 0x99, 0x04, 0xBD, 0x66, 0xCB, 0x87, 0xDC,
+    0x82, 0x94, 0xD4, 0x00, 0x24, 0x1B, 0x29, 0x9E, 0x1D, 0x4B, 0xFE, 0x2E, 0xD5, 0xFA, 0x4A, 0xC2,
+    0xFE, 0x28, 0xB9, 0x52, 0x1A, 0x31, 0x1B, 0x60, 0x10, 0x2A, 0x3F, 0xDA, 0x91, 0x5A, 0x3E, 0x48,
+    0xC0, 0xEF, 0xA7, 0x2D, 0xC9, 0x0A, 0xEF, 0x6D, 0xD8, 0x55, 0x28, 0x35, 0x03, 0xB4, 0xBA, 0xC9,
+    0xA3, 0xE2, 0x50, 0xF2, 0x60, 0x5E, 0x3F, 0x7C, 0xC7, 0xFE, 0x2E, 0xAD, 0x6A, 0xD1, 0x59, 0x24,
+    0x33, 0x82, 0x80, 0x93, 0xE9, 0xEA, 0xA2, 0x3A, 0x1F, 0x81, 0xD2, 0x1E, 0x3A, 0x3D, 0x14, 0x51,
+    0x06, 0x85, 0xFE, 0x47, 0xFC, 0xCB, 0x4F, 0x62, 0xC5, 0xF7, 0x26, 0x2D, 0xF0, 0xA0, 0xC8, 0x29,
+    0x40, 0x56, 0x28, 0xB6, 0x5B, 0x63, 0xDB, 0xDA, 0xDF, 0x17, 0x11, 0x51, 0x99, 0x94, 0x30, 0x59,
+    0x4E, 0xDD, 0xFC, 0x5A, 0x1C, 0x7A, 0xE9, 0xD2, 0x05, 0x12, 0x8C, 0x1C, 0x88, 0xA1, 0xC5, 0xF7,
+    0x22, 0x88, 0x48, 0xF0, 0x1B, 0x2F, 0xA0, 0xA1, 0x18, 0xAD, 0x91, 0x39, 0xE1, 0x73, 0x74, 0x0B,
+    0x66, 0x01, 0xEC, 0xC4, 0x37, 0x18, 0xAD, 0xAE, 0x82, 0x82, 0xF2, 0x2D, 0x86, 0x82, 0xAF, 0x22,
+    0xF4, 0x6C, 0x3A, 0x1E, 0x4B, 0x34, 0x9E, 0x62, 0x67, 0x7A, 0x18, 0x92, 0xE1, 0x4E, 0xFD, 0x3A,
+    0xB2, 0x86, 0x81, 0x9F, 0x9F, 0x06, 0x0B, 0xE7, 0xF0, 0xC7, 0xFF, 0x4E, 0x00, 0x81, 0x77, 0x0E,
+    0xF6, 0xEA, 0x31, 0x22, 0x30, 0xD1, 0x72, 0xC1, 0x64, 0xA0, 0x00, 0x24, 0xB3, 0x12, 0x5E, 0xE4,
+    0x7A, 0xFC, 0xF8, 0x11, 0xCD, 0x5D, 0x46, 0xF9, 0xF9, 0x39, 0x24, 0xCD, 0x7E, 0xEE, 0xDD, 0x86,
+    0x78, 0x35, 0x94, 0xC8, 0x51, 0x42, 0xCC, 0xAE, 0x74, 0x45, 0xC6, 0xAE, 0xF2, 0xE5, 0x28, 0x57,
+    0xED, 0x31, 0x54, 0x7D, 0x85, 0x6B, 0xE3, 0x65, 0xB0, 0xB2, 0xC7, 0x0C, 0x3B, 0x62, 0xCF, 0x8B,
+    0xFA, 0x98, 0x4F, 0xC0, 0xE3, 0xE5, 0xB9, 0xCC, 0x7C, 0x7E, 0x8A, 0xF8, 0x9A, 0xBF, 0x65, 0x19,
+    0xB2, 0x05, 0x86, 0x12, 0x06, 0x44, 0x6A, 0xA6, 0x8C, 0x2F, 0x4A, 0x74, 0x36, 0x8B, 0xA7, 0x05,
+    0x0B, 0x47, 0x00, 0x64, 0xBA, 0x2C, 0x73, 0x54, 0x06, 0x21, 0xBA, 0x4F, 0xF4, 0x04, 0x35, 0x92,
+    0xA9, 0x89, 0x8E, 0x5B, 0x76, 0x7D, 0x26, 0x5E, 0x50, 0xD3, 0xFA, 0x91, 0x40, 0xE7, 0xF4, 0xFC,
+    0xEC, 0x07, 0xA1, 0xE5, 0xE5, 0xD2, 0xE2, 0xA7, 0x6C, 0x49, 0x4E, 0x95, 0x18, 0xF9, 0x45, 0x8C,
+    0x4E, 0xF6, 0xBE, 0x35, 0x05, 0x73, 0x1E, 0x33, 0x99, 0x66, 0x3C, 0xEA, 0xF8, 0xE9, 0x0D, 0x99,
+    0xA8, 0x0E, 0x3E, 0x4E, 0xA3, 0x46, 0xB6, 0xE0, 0x4F, 0x49, 0x9A, 0x0B, 0x41, 0x14, 0x7F, 0x82,
+    0x06, 0xF3, 0x19, 0x47, 0xB1, 0x17, 0x15, 0x61, 0xBD, 0x07, 0xF9, 0x24, 0x36, 0x2F, 0x13, 0xAE,
+    0x5C, 0x59, 0xF4, 0xB4, 0x5B, 0xA2, 0x63, 0xEF, 0x21, 0x35, 0xF2, 0x67, 0x31, 0xFD, 0x5F, 0x50,
+    0xFE, 0x2A, 0x5C, 0x29, 0xFA, 0xDD, 0xF7, 0xCB, 0x16, 0xD5, 0x03, 0x97, 0xF4, 0xB8, 0x4D, 0x33,
+    0x2B, 0x3F, 0xC1, 0x00, 0xEC, 0xAF, 0x11, 0x5E, 0x91, 0xDA, 0x28, 0x09, 0x06, 0xAE, 0xE1, 0xD8,
+    0xEC, 0xDF, 0x7D, 0x77, 0xF9, 0x37, 0x3B, 0xEC, 0x70, 0x68, 0xF0, 0xC4, 0x3D, 0xD8, 0xA6, 0x6D,
+    0x2A, 0xFF, 0x8A, 0xC3, 0x17, 0x65, 0x7F, 0x9D, 0x68, 0xAA, 0x7C, 0x53, 0x1C, 0x0F, 0xD7, 0xA5,
+    0x75, 0x0A, 0x7E, 0x01, 0x31, 0x4E, 0xA6, 0x83, 0xF0, 0x25, 0x7D, 0x4E, 0xF4, 0x1F, 0x8D, 0x55,
+    0x3D, 0xAF, 0xDD, 0x44, 0x10, 0x1D, 0xDB, 0xC9, 0x33, 0x91, 0x25, 0x36, 0x25, 0x05, 0x8A, 0x29,
+    0xA8, 0x50, 0x84, 0x9B, 0x14, 0x34, 0x68, 0x8D, 0x28, 0x68, 0x29, 0xA2, 0xB4, 0x20, 0x3A, 0x24,
+    0x10, 0x34, 0xD4, 0xB6, 0x94, 0x22, 0xED, 0xFD, 0x11, 0x29, 0x48, 0x0A, 0xD2, 0xD2, 0xAD, 0x11,
+    0x45, 0x0A, 0x0A, 0x2C, 0xF1, 0x03, 0x70, 0x91, 0x34, 0x8F, 0x82, 0x05, 0x5D, 0xE9, 0x99, 0xC7,
+    0xDA, 0xC3, 0x39, 0xBB, 0xF6, 0xE3, 0x2A, 0x0A, 0x22, 0x2B, 0xCD, 0xAE, 0xEF, 0x7E, 0xCC, 0x9C,
+    0x39, 0xF3, 0x71, 0x45, 0x24, 0x7F, 0x26, 0x69, 0xE8, 0x94, 0xD6, 0xDB, 0x65, 0x5A, 0xB3, 0xF6,
+    0x2D, 0x39, 0x19, 0xF9, 0x8C, 0xA9, 0xC4, 0xA4, 0x1E, 0x67, 0xB8, 0xFC, 0x66, 0xD1, 0xA6, 0xCB,
+    0xED, 0x4D, 0x6C, 0xC8, 0x4D, 0xF9, 0xFF, 0xF1, 0x79, 0x9C, 0xCF, 0x0E, 0x96, 0xBA, 0xA4, 0xD0,
+    0x07, 0xF7, 0x46, 0x7E, 0x7C, 0xF3, 0xE5, 0xA7, 0x37, 0xE2, 0x81, 0x1C, 0xE4, 0xD5, 0x47, 0x37,
+    0x70, 0xEA, 0xC5, 0x28, 0xD6, 0x5A, 0x25, 0x1B, 0xEE, 0x00, 0x65, 0xFF, 0xF5, 0x76, 0x9C, 0xC5,
+    0xB9, 0xDD, 0x7E, 0xB9, 0x31, 0xAD, 0xB7, 0x9E, 0x6C, 0xDE, 0xF4, 0x77, 0x5E, 0xD4, 0xF7, 0xDE,
+    0xB6, 0x96, 0xFD, 0xF6, 0x71, 0xDC, 0x56, 0x13, 0xE7, 0x1B, 0x92, 0xF9, 0xF8, 0xE1, 0xC5, 0x8A,
+    0xBC, 0x21, 0x52, 0xF1, 0x5E, 0x0D, 0xBD, 0xEF, 0x73, 0xC5, 0x59, 0xEE, 0x37, 0x96, 0x5E, 0x87,
+    0xBC, 0x76, 0x6A, 0xFD, 0xBF, 0xC6, 0xDB, 0x09, 0x4B, 0x5B, 0x68, 0xB4, 0x69, 0x0F, 0x55, 0x48,
+    0xC4, 0x0C, 0x67, 0x43, 0x3C, 0xFA, 0xE2, 0x55, 0xC9, 0x20, 0xFB, 0x39, 0xA4, 0xDA, 0x23, 0x45,
+    0x51, 0xD8, 0x2F, 0xA1, 0xA8, 0x6B, 0xE5, 0x7B, 0x79, 0x97, 0x86, 0xC4, 0xF4, 0xB2, 0x7B, 0x71,
+    0x16, 0xD7, 0x7A, 0xA7, 0x6B, 0x23, 0x48, 0x6E, 0xBF, 0xA0, 0xF9, 0x91, 0xBC, 0xD3, 0x4B, 0x31,
+    0x0B, 0x58, 0x36, 0x47, 0x03, 0x4E, 0x1A, 0x25, 0xDA, 0x46, 0x49, 0xCF, 0xF5, 0xBB, 0xFB, 0x35,
+    0xE3, 0xA5, 0x0E, 0x62, 0x07, 0xA4, 0x47, 0xB6, 0x22, 0x26, 0x7D, 0x75, 0x14, 0xB7, 0x60, 0xA3,
+    0xC4, 0x45, 0x15, 0xAB, 0x43, 0x11, 0xF2, 0x55, 0xA5, 0x9E, 0xEA, 0x8B, 0x59, 0x5C, 0xAB, 0xCD,
+    0x58, 0x04, 0x73, 0x74, 0x78, 0xE8, 0xEE, 0xE3, 0xE1, 0x83, 0x60, 0x7C, 0xB6, 0xD8, 0xA1, 0xEB,
+    0xAB, 0x8B, 0x25, 0xC7, 0xC3, 0xDF, 0x3D, 0x54, 0xAA, 0x6E, 0x1A, 0x56, 0x44, 0xB8, 0x2F, 0x75,
+    0x76, 0x01, 0x96, 0x7F, 0x51, 0x98, 0x51, 0xB3, 0x80, 0xA8, 0x18, 0x23, 0x4B, 0xB2, 0xF2, 0x55,
+    0xB6, 0x38, 0xC0, 0x71, 0xD2, 0x99, 0xB8, 0xB4, 0xD3, 0x8E, 0x70, 0x91, 0xA6, 0xAF, 0x27, 0x64,
+    0xB0, 0x7E, 0xA0, 0x52, 0xA9, 0x8E, 0x50, 0x89, 0xC3, 0xEB, 0xED, 0x9E, 0x4E, 0xC6, 0x57, 0x73,
+    0xA6, 0x78, 0xDC, 0x4C, 0xE6, 0x58, 0x2C, 0x44, 0x3D, 0xD4, 0xBE, 0x04, 0x6C, 0x71, 0x83, 0x1D,
+    0xCD, 0x5C, 0x04, 0x50, 0x9A, 0xF6, 0x0A, 0xC5, 0x83, 0x6E, 0x2A, 0x97, 0x66, 0x85, 0x6F, 0xAA,
+    0xF7, 0xF5, 0x52, 0x8F, 0x66, 0x69, 0x54, 0xAE, 0xC5, 0x9C, 0x28, 0x42, 0x4A, 0x4E, 0xF2, 0x92,
+    0xA0, 0x81, 0x45, 0xB1, 0x63, 0x94, 0x33, 0x77, 0xDE, 0x02, 0x40, 0x6F, 0x54, 0xB9, 0x0A, 0xB9,
+    0x85, 0x61, 0xC9, 0xF5, 0x11, 0x5C, 0xD2, 0x11, 0x72, 0x84, 0x84, 0x32, 0x54, 0x4B, 0x15, 0x8A,
+    0x15, 0x96, 0x57, 0x22, 0xAA, 0x7D, 0x15, 0x9A, 0x4B, 0x37, 0x23, 0x02, 0x1E, 0x46, 0x7B, 0xAB,
+    0x73, 0xE2, 0xFE, 0x18, 0x55, 0xC0, 0x77, 0xEC, 0x16, 0xF1, 0x70, 0x25, 0x29, 0x25, 0x40, 0xB8,
+    0xFE, 0xE4, 0x38, 0xD3, 0xEF, 0x0E, 0x0D, 0xC1, 0xEA, 0x62, 0x9F, 0x75, 0x17, 0x21, 0xD3, 0x6E,
+    0xA8, 0x2F, 0x60, 0x01, 0xEF, 0x7E, 0xC0, 0x3B, 0x10, 0x2C, 0xD9, 0xC7, 0xC0, 0xA8, 0x0F, 0x09,
+    0xC4, 0x4B, 0xA7, 0x3A, 0x00, 0x21, 0xB8, 0xE8, 0x2D, 0x48, 0xC9, 0xC1, 0x0E, 0xF4, 0xD4, 0xFE,
+    0x33, 0xCD, 0xB5, 0x71, 0x93, 0x9D, 0x14, 0x4C, 0x44, 0x24, 0x3A, 0x95, 0x40, 0x2D, 0xEE, 0xFC,
+    0xAB, 0x1E, 0xF6, 0x8E, 0x31, 0xF7, 0x6A, 0x9F, 0xFC, 0x92, 0x06, 0x3C, 0x83, 0xD0, 0x2D, 0x52,
+    0x71, 0x14, 0xDE, 0x0D, 0xD2, 0xD9, 0x18, 0x09, 0x84, 0xE4, 0xB9, 0x0E, 0x66, 0x2E, 0x01, 0x08,
+    0xB4, 0x22, 0x48, 0x01, 0x19, 0xD0, 0x0D, 0x76, 0x80, 0xF7, 0xE1, 0x9A, 0xF6, 0xDD, 0xD3, 0x5F,
+    0xE1, 0xBA, 0x53, 0x71, 0x17, 0x3A, 0x9A, 0xF8, 0x00, 0x3F, 0xEA, 0x3F, 0xD5, 0xE7, 0x6B, 0xD6,
+    0xF4, 0xA0, 0x74, 0xBA, 0x52, 0x4F, 0xA7, 0xE9, 0x75, 0x74, 0xFB, 0xAA, 0x79, 0xF1, 0xB4, 0xD9,
+    0xE3, 0x62, 0x87, 0x82, 0x3A, 0x00, 0xBA, 0x2D, 0xE9, 0xA5, 0x43, 0x0C, 0xCC, 0x5E, 0x30, 0xE6,
+    0x0A, 0x34, 0x3E, 0x0A, 0x46, 0xCE, 0x5E, 0xC5, 0x13, 0xEA, 0xAB, 0x79, 0xCB, 0x2F, 0xAA, 0x8F,
+    0xF7, 0xEA, 0x3D, 0xC2, 0xF1, 0xDE, 0x72, 0x65, 0x93, 0x4F, 0x28, 0xEC, 0x99, 0x28, 0x06, 0x18,
+    0xCA, 0x20, 0x39, 0xA4, 0xD0, 0xC7, 0x07, 0x5E, 0x24, 0x54, 0x0A, 0x75, 0x52, 0x1D, 0x85, 0xDA,
+    0x68, 0x99, 0x94, 0xC5, 0x74, 0x19, 0xB6, 0x4E, 0x67, 0x53, 0xC2, 0x8C, 0x65, 0x52, 0x12, 0x22,
+    0x08, 0xDE, 0x20, 0x60, 0x6A, 0xC9, 0x59, 0xA1, 0x88, 0x17, 0x7C, 0x9B, 0x32, 0xC6, 0xA2, 0x59,
+    0xBF, 0x4D, 0xC0, 0xF6, 0x9B, 0xD4, 0xCD, 0xAA, 0x48, 0x9B, 0x6D, 0xDA, 0xA4, 0x66, 0x90, 0x0D,
+    0x85, 0x8E, 0x4A, 0xCF, 0x1F, 0x32, 0x57, 0x28, 0x67, 0x7A, 0x17, 0xB5, 0x86, 0x4A, 0xC4, 0x36,
+    0x25, 0x22, 0x3D, 0x45, 0xEB, 0xB7, 0x72, 0x3B, 0x41, 0x76, 0x7C, 0x39, 0xB2, 0x68, 0xEF, 0x71,
+    0x2B, 0xCC, 0x4B, 0x13, 0xF3, 0x4C, 0x15, 0x91, 0xD3, 0x51, 0xDB, 0x7A, 0x66, 0x34, 0xA0, 0xC7,
+    0x3D, 0x0D, 0x88, 0xE8, 0x0A, 0x13, 0xDA, 0xE6, 0xCA, 0x46, 0xB2, 0x17, 0x0C, 0xD9, 0x98, 0xB3,
+    0xE7, 0x2E, 0x21, 0x6C, 0x08, 0x85, 0x75, 0x9F, 0xB1, 0x70, 0x61, 0x12, 0xCA, 0x06, 0x24, 0x35,
+    0xA1, 0x93, 0x54, 0x1A, 0x05, 0x61, 0x00, 0xD2, 0xB2, 0xBE, 0x00, 0x2E, 0xD3, 0x4F, 0xD6, 0x2A,
+    0x98, 0xD0, 0x4C, 0x8D, 0xD7, 0xB6, 0xFB, 0x11, 0x59, 0xC6, 0x4A, 0x4A, 0xBD, 0x01, 0x34, 0x98,
+    0x90, 0x9F, 0x33, 0xAD, 0x58, 0xC9, 0x93, 0xB8, 0xBF, 0x52, 0xF8, 0x9A, 0x91, 0x39, 0x38, 0x66,
+    0xEC, 0x02, 0x48, 0x0E, 0xD4, 0x1F, 0x8B, 0x1E, 0x99, 0xD5, 0xF5, 0xC8, 0xDC, 0x22, 0x54, 0x33,
+    0x9D, 0xB7, 0xA3, 0x7E, 0xB8, 0x30, 0x11, 0x8C, 0x8F, 0x49, 0xF1, 0x87, 0x32, 0x70, 0xE2, 0x9E,
+    0xFC, 0x16, 0x62, 0x23, 0x67, 0x75, 0x0B, 0xCB, 0x88, 0xBB, 0xF5, 0xDF, 0x2B, 0x7F, 0x16, 0x6B,
+    0xF7, 0x33, 0x79, 0xD3, 0x9F, 0xE6, 0xD8, 0x49, 0xBD, 0x7E, 0xC4, 0x44, 0x58, 0x8C, 0xA7, 0xBB,
+    0xDA, 0x2B, 0x23, 0x69, 0x51, 0x65, 0xF5, 0x65, 0x6F, 0xD8, 0x7D, 0x34, 0xE4, 0x70, 0x64, 0xAC,
+    0x50, 0x08, 0x68, 0x9A, 0x92, 0xFE, 0x3D, 0x53, 0x04, 0x53, 0xE7, 0x8D, 0x0D, 0x5C, 0x37, 0xDC,
+    0xA9, 0xE1, 0xED, 0x89, 0xF8, 0x6F, 0xC5, 0xBD, 0x6C, 0xFC, 0x03, 0x75, 0x55, 0x3D, 0xAF, 0xDD,
+    0x44, 0x10, 0x1D, 0xDB, 0x42, 0x96, 0x62, 0x09, 0x53, 0xD0, 0xA0, 0x48, 0xB8, 0x4F, 0xB3, 0x7F,
+    0x00, 0x69, 0x2D, 0x52, 0x50, 0x26, 0x0D, 0x69, 0x28, 0xF2, 0x03, 0x28, 0xD2, 0xD3, 0xAC, 0x23,
+    0xCA, 0x57, 0x80, 0x10, 0xF4, 0x29, 0x28, 0xF8, 0x28, 0xF8, 0x01, 0x14, 0xF6, 0x0B, 0x12, 0x91,
+    0xA0, 0xE0, 0x4A, 0xAF, 0x48, 0x41, 0x11, 0xA7, 0xA0, 0x21, 0x45, 0x1C, 0x3D, 0x47, 0x98, 0x9B,
+    0xB5, 0x0F, 0x67, 0x66, 0xFD, 0xDE, 0x8B, 0x90, 0x72, 0x0B, 0xAF, 0x7C, 0x67, 0x67, 0xE6, 0x9C,
+    0x33, 0x1F, 0x16, 0x49, 0x3F, 0x3F, 0x4B, 0xE8, 0xAA, 0x58, 0xE0, 0x50, 0xCD, 0x25, 0x06, 0x0F,
+    0x41, 0x86, 0x98, 0xDD, 0x5D, 0xEA, 0xC9, 0xBF, 0x14, 0xE9, 0xEF, 0xA3, 0x8A, 0x22, 0x65, 0x74,
+    0x23, 0x5A, 0x91, 0xF0, 0x78, 0xBB, 0x37, 0x89, 0x54, 0x00, 0x36, 0x3A, 0xF7, 0x3C, 0x0F, 0x22,
+    0xF5, 0x11, 0xCF, 0x56, 0x91, 0x0C, 0xD5, 0xEC, 0xF9, 0xEA, 0x47, 0xDC, 0xA4, 0xB5, 0x89, 0xF5,
+    0xE4, 0xE6, 0xDB, 0x1E, 0xF7, 0x19, 0x73, 0x2B, 0x30, 0x36, 0x63, 0x85, 0x83, 0x9F, 0xF3, 0x95,
+    0x26, 0x69, 0x2D, 0xF9, 0x60, 0x18, 0x8A, 0x25, 0x61, 0x09, 0xF6, 0xA7, 0x54, 0x73, 0x7A, 0x45,
+    0x3A, 0xAE, 0x3D, 0x48, 0xE7, 0x75, 0xCC, 0xE2, 0x81, 0x81, 0xC9, 0xA3, 0x1C, 0x3F, 0x41, 0xFB,
+    0x8E, 0x04, 0x4D, 0xCE, 0xDB, 0x05, 0x21, 0xE6, 0x90, 0xB7, 0x7E, 0x84, 0x94, 0x04, 0x96, 0xE1,
+    0x5F, 0xC5, 0x36, 0xD2, 0x67, 0x55, 0x94, 0xCC, 0xD2, 0x28, 0x6A, 0x25, 0xB2, 0x55, 0x5F, 0x5F,
+    0xC7, 0x87, 0xC4, 0xDD, 0x11, 0x7C, 0x57, 0x61, 0x6B, 0x25, 0xD3, 0xF4, 0x5E, 0x13, 0x33, 0x5C,
+    0xCE, 0x97, 0x1B, 0xF4, 0xAA, 0x99, 0xBD, 0xD8, 0xE4, 0xEA, 0x77, 0x8F, 0x0A, 0xD1, 0xC3, 0x63,
+    0xCD, 0x5B, 0x3F, 0x4A, 0x4E, 0x9B, 0x3F, 0x5C, 0xEB, 0x17, 0x61, 0xB2, 0x86, 0x2A, 0xDC, 0xA1,
+    0x3E, 0x15, 0x9D, 0xFB, 0x5F, 0x5B, 0xB7, 0x30, 0x36, 0x2F, 0x1F, 0x02, 0x31, 0x94, 0xCC, 0xEC,
+    0x52, 0x92, 0x66, 0x90, 0x4F, 0x17, 0x8A, 0xD7, 0x4A, 0xFF, 0xE5, 0xAE, 0xFE, 0x81, 0x39, 0xEA,
+    0xA9, 0x20, 0xEE, 0x48, 0x02, 0x39, 0xB5, 0x6F, 0x85, 0x82, 0x75, 0xB4, 0xF0, 0x51, 0x4F, 0x18,
+    0x68, 0x21, 0x81, 0x7C, 0x53, 0xAE, 0x50, 0x4E, 0x1E, 0x8C, 0x58, 0xBF, 0xB2, 0xAA, 0xF0, 0x4E,
+    0xBE, 0x39, 0xBE, 0xE3, 0xA3, 0x55, 0xA3, 0xF1, 0x7A, 0x33, 0xF1, 0xBD, 0x8C, 0xC5, 0xF6, 0x3D,
+    0x21, 0x12, 0x30, 0x5A, 0xA2, 0xF3, 0x43, 0xA1, 0x5E, 0xFC, 0x9F, 0x8F, 0xDC, 0x68, 0x69, 0x39,
+    0x53, 0x01, 0x54, 0x1B, 0x13, 0x67, 0x57, 0x3D, 0x1C, 0x9A, 0xA9, 0x59, 0xF2, 0x8D, 0xD0, 0x34,
+    0x62, 0xB1, 0xFA, 0x49, 0xFC, 0xEF, 0x91, 0xDA, 0x29, 0x72, 0x52, 0xAD, 0x59, 0x00, 0x01, 0x45,
+    0x68, 0x5E, 0x28, 0xE6, 0x7A, 0x11, 0x37, 0xF6, 0x7F, 0xDF, 0x5C, 0x0B, 0xCC, 0x7E, 0x70, 0x60,
+    0x12, 0x4B, 0xA6, 0xF5, 0x6B, 0x08, 0x38, 0xD3, 0x22, 0xB8, 0x21, 0x95, 0x49, 0x6E, 0x28, 0x37,
+    0xD2, 0xAC, 0xE7, 0x0C, 0x5D, 0x19, 0x3F, 0x40, 0x97, 0xE3, 0x7D, 0xF2, 0xC0, 0x09, 0xC1, 0xFB,
+    0x33, 0x3E, 0x76, 0xD6, 0x24, 0x9C, 0x43, 0xFB, 0x09, 0xFD, 0xE1, 0x4D, 0xAC, 0x4F, 0x94, 0xF5,
+    0x99, 0xB1, 0x66, 0x77, 0x94, 0xF1, 0x33, 0xE2, 0xD9, 0xDE, 0xA3, 0x13, 0xE3, 0xC7, 0x94, 0x87,
+    0xDD, 0xC0, 0x0E, 0x70, 0x4F, 0x9B, 0xB9, 0x58, 0x7F, 0x5E, 0xC5, 0x3F, 0xD1, 0xAC, 0xD4, 0x31,
+    0xFC, 0x11, 0xA5, 0x7A, 0x05, 0x15, 0x75, 0x30, 0x46, 0x99, 0x26, 0x73, 0xFF, 0x80, 0x65, 0x0F,
+    0xEC, 0xB4, 0x3F, 0xC9, 0x3C, 0x9E, 0xAF, 0x12, 0x7E, 0x73, 0x13, 0xEB, 0xCA, 0x40, 0xA9, 0x58,
+    0x33, 0x8B, 0x15, 0xF0, 0x10, 0xAD, 0xC3, 0x53, 0x74, 0x35, 0x16, 0x25, 0xB0, 0x1A, 0xEC, 0xDE,
+    0x8A, 0xA5, 0xB0, 0xAD, 0x58, 0xFD, 0x1B, 0x8B, 0xF5, 0xF9, 0x55, 0xB1, 0x9A, 0x99, 0xD2, 0x33,
+    0x2E, 0x8B, 0x42, 0x77, 0xC2, 0x5E, 0x34, 0xCF, 0xDE, 0xFA, 0x52, 0xAC, 0x7B, 0x91, 0x7A, 0x02,
+    0xAC, 0x15, 0x29, 0x4C, 0x7B, 0xD6, 0xAE, 0x9E, 0xCA, 0x35, 0x63, 0xBF, 0x74, 0x6E, 0xF4, 0x63,
+    0xB1, 0x2A, 0xDD, 0x33, 0x62, 0xD7, 0x66, 0x09, 0xCF, 0x19, 0x14, 0xEB, 0x4E, 0xED, 0x5C, 0x07,
+    0x82, 0x35, 0x76, 0x13, 0x91, 0x6E, 0x95, 0xCA, 0x42, 0x07, 0x6D, 0xB7, 0x30, 0x68, 0x36, 0x4C,
+    0x19, 0x6E, 0x31, 0x2A, 0x1E, 0x71, 0x74, 0x70, 0x0A, 0xB4, 0x5A, 0x88, 0x81, 0x3C, 0x9A, 0x89,
+    0x3C, 0xAA, 0xC8, 0x42, 0x17, 0x9B, 0x57, 0xDC, 0x3A, 0xFB, 0xE1, 0x39, 0x1F, 0x0D, 0xD8, 0xCE,
+    0xA6, 0x1E, 0xC5, 0x22, 0x3C, 0xDC, 0xE2, 0x7B, 0x78, 0xC8, 0x77, 0x37, 0x51, 0xC5, 0x6A, 0x21,
+    0x9C, 0x62, 0xB5, 0x66, 0x6E, 0xE9, 0x19, 0x06, 0xA6, 0x75, 0xCC, 0xD3, 0x51, 0xBA, 0xB1, 0x8E,
+    0x6C, 0x22, 0xA2, 0x01, 0x73, 0x7C, 0xDC, 0x9F, 0x6A, 0x53, 0x3D, 0x62, 0x4B, 0xF6, 0x5F, 0x30,
+    0x06, 0xC2, 0x94, 0x60, 0x67, 0x30, 0xB9, 0x18, 0x9C, 0xB9, 0x09, 0x60, 0x25, 0x83, 0x22, 0x12,
+    0x6F, 0x19, 0x19, 0xAB, 0x5A, 0xAC, 0x14, 0xE4, 0x40, 0x36, 0xD2, 0xB7, 0x35, 0x3B, 0xF4, 0xC0,
+    0xBE, 0x6B, 0xA6, 0x5C, 0x47, 0x49, 0x94, 0xA9, 0xA4, 0x36, 0xA0, 0x65, 0xD8, 0x2D, 0x3F, 0xFC,
+    0x44, 0x8B, 0x6E, 0x2E, 0xAE, 0x11, 0x5A, 0xF8, 0xD8, 0x2D, 0x9B, 0x58, 0x85, 0x8B, 0xDD, 0xA7,
+    0xB9, 0xF0, 0x39, 0x7E, 0x45, 0x0B, 0x2B, 0xDC, 0x16, 0xD8, 0xBC, 0x6A, 0xFF, 0xBF, 0x99, 0x59,
+    0x2E, 0x4A, 0x94, 0x76, 0x55, 0x18, 0x2E, 0x46, 0xC8, 0xC0, 0x80, 0x94, 0x0D, 0x8B, 0x63, 0x7D,
+    0x78, 0x70, 0xCE, 0xD9, 0x4E, 0x00, 0x91, 0x30, 0x73, 0x6D, 0x40, 0xFE, 0xBA, 0xCB, 0x31, 0x60,
+    0xC8, 0x2A, 0xF2, 0x70, 0x63, 0xB5, 0x3D, 0xA0, 0x60, 0xF8, 0x85, 0x5E, 0x5B, 0xC3, 0xB5, 0x30,
+    0xDB, 0x8E, 0xD8, 0xE3, 0xDB, 0xF8, 0xE8, 0x40, 0x91, 0x30, 0xA7, 0xF8, 0xBB, 0xC4, 0x5D, 0xE3,
+    0x92, 0xD0, 0xA8, 0x78, 0xA1, 0x8A, 0x94, 0x58, 0x13, 0xFF, 0x44, 0x46, 0x4C, 0x01, 0x31, 0xA2,
+    0x92, 0x34, 0x48, 0x22, 0x24, 0x15, 0xC4, 0x64, 0xB8, 0x30, 0x9B, 0x10, 0x49, 0x89, 0xDD, 0xBB,
+    0x79, 0xDD, 0xFB, 0xD2, 0xBC, 0x9A, 0x0C, 0x26, 0x07, 0xB4, 0x83, 0x94, 0x26, 0x06, 0x37, 0x96,
+    0x80, 0xF2, 0x7D, 0x79, 0x9B, 0x37, 0x7A, 0xDD, 0x5F, 0x7A, 0x53, 0x29, 0x8B, 0x71, 0x96, 0x3A,
+    0x25, 0x26, 0x6B, 0x1D, 0x4B, 0xED, 0x14, 0xE5, 0x4D, 0xE2, 0xA5, 0x75, 0xB5, 0x1B, 0x95, 0xA4,
+    0x65, 0x35, 0xB2, 0x8A, 0xF0, 0xEA, 0x08, 0x97, 0x1F, 0x1D, 0x95, 0x1C, 0x9D, 0x5D, 0x41, 0x6B,
+    0x3B, 0x0D, 0xB6, 0xC0, 0x18, 0x4B, 0x01, 0x52, 0x04, 0xFB, 0x2A, 0xB0, 0x45, 0x8E, 0xDF, 0x6A,
+    0x81, 0x1A, 0xD8, 0x6D, 0x07, 0x93, 0x89, 0xE1, 0xE6, 0x4A, 0xC7, 0xCC, 0x45, 0x5E, 0xA3, 0xF6,
+    0x2B, 0x8F, 0x30, 0x58, 0x8B, 0xF5, 0x5D, 0x41, 0xE1, 0x4D, 0x01, 0x82, 0xD1, 0x43, 0x97, 0x08,
+    0x63, 0xF8, 0xC1, 0x8E, 0xF4, 0x81, 0x4A, 0xBB, 0xB2, 0x4E, 0x9F, 0x2D, 0x9D, 0x0C, 0x79, 0xFB,
+    0x8E, 0xAE, 0xE6, 0x34, 0xA2, 0x7A, 0xD8, 0x8A, 0xAD, 0x90, 0xBE, 0x64, 0xEF, 0x8A, 0x49, 0x4E,
+    0x19, 0x8D, 0x08, 0x61, 0xA8, 0x8A, 0xDF, 0x70, 0xB8, 0xB4, 0x2F, 0x6C, 0x94, 0xA3, 0x76, 0x4F,
+    0x92, 0x98, 0xC3, 0xA1, 0x4B, 0x46, 0x97, 0x36, 0xC3, 0x9D, 0x72, 0x4C, 0x1F, 0xE3, 0x24, 0x72,
+    0x1D, 0xC3, 0x8D, 0xF5, 0x52, 0x45, 0x36, 0xC8, 0xA1, 0x39, 0xD7, 0xF6, 0x0A, 0x4F, 0x26, 0xFB,
+    0x6C, 0x5C, 0x62, 0xD1, 0xB5, 0x23, 0xB6, 0x3C, 0x8E, 0xBD, 0x0A, 0xA0, 0x33, 0x44, 0x30, 0x6A,
+    0x73, 0x5B, 0x2B, 0xAF, 0xFF, 0xFE, 0x03, 0xAD, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0xEF,
+    0x39, 0x92, 0xA5, 0xB8, 0x98, 0x86, 0x02, 0x51, 0xE0, 0x3F, 0x60, 0x7E, 0x00, 0x69, 0x2C, 0xB6,
+    0xA4, 0x60, 0x2B, 0x1A, 0x8A, 0xE5, 0x0F, 0x68, 0x29, 0x90, 0xC6, 0x12, 0x05, 0x45, 0x0A, 0xE8,
+    0x29, 0xD8, 0x82, 0x02, 0x6D, 0x0A, 0x1A, 0x5A, 0x34, 0x56, 0x56, 0x22, 0x25, 0xDE, 0xAC, 0x04,
+    0x05, 0x45, 0x1C, 0x45, 0x34, 0x69, 0x76, 0x20, 0x5E, 0xE1, 0x28, 0xE3, 0xB9, 0x9C, 0x33, 0xDE,
+    0xDD, 0x17, 0x51, 0xE3, 0xA7, 0x19, 0x79, 0xDE, 0xCC, 0xDC, 0x7B, 0xCE, 0xBD, 0xE7, 0x5E, 0x8B,
+    0xF0, 0xD9, 0x85, 0x24, 0x62, 0x14, 0x93, 0xD3, 0x45, 0x44, 0x5F, 0x9D, 0x4A, 0xA5, 0xBD, 0x48,
+    0x9D, 0x77, 0x3A, 0x98, 0xD4, 0x68, 0x6C, 0xE7, 0x56, 0x17, 0x1B, 0xDD, 0xF3, 0xE4, 0x26, 0x7F,
+    0x9E, 0xDC, 0x18, 0x8E, 0x30, 0x69, 0x95, 0xDC, 0xA0, 0x35, 0xA7, 0x66, 0xC6, 0xD2, 0x44, 0x37,
+    0xA9, 0x9B, 0x5C, 0x0C, 0x3A, 0xB4, 0xAB, 0x57, 0x69, 0x54, 0xF3, 0xA7, 0x95, 0xAA, 0x46, 0xF1,
+    0x9C, 0xE4, 0xD8, 0x47, 0xB9, 0x7B, 0x6C, 0x96, 0x9D, 0x66, 0xA9, 0xE1, 0xD8, 0xE4, 0x7B, 0x62,
+    0x67, 0x3B, 0xE1, 0x7E, 0xF2, 0xE7, 0xBA, 0x86, 0xF3, 0x25, 0x87, 0xAF, 0x62, 0x0E, 0x0F, 0xE2,
+    0x1A, 0x1E, 0xFC, 0x95, 0xC2, 0xE3, 0x97, 0x8B, 0xBF, 0xD4, 0xE8, 0x14, 0x96, 0x55, 0x13, 0x6C,
+    0x26, 0x79, 0xAB, 0x4E, 0x07, 0x63, 0x7B, 0x7D, 0x25, 0x12, 0x54, 0xC1, 0x03, 0x1C, 0x34, 0x87,
+    0xC1, 0xA8, 0xDC, 0x17, 0x3F, 0x09, 0xB8, 0x60, 0xBF, 0x9D, 0x31, 0x85, 0x01, 0xAB, 0x8C, 0x17,
+    0xC3, 0x95, 0x1B, 0x41, 0x5D, 0x3B, 0xF0, 0x5C, 0xEF, 0xFE, 0xC2, 0x71, 0xD1, 0x51, 0xBA, 0x9D,
+    0xFE, 0xF9, 0xA3, 0x14, 0x2F, 0x15, 0x81, 0x03, 0x27, 0xCE, 0xD9, 0x8E, 0x47, 0xE8, 0xED, 0x67,
+    0x8C, 0x0A, 0x17, 0xAA, 0x30, 0x32, 0x72, 0xB7, 0x37, 0x0F, 0x60, 0x96, 0x1D, 0x90, 0x22, 0x9A,
+    0x26, 0x7F, 0xF2, 0x01, 0x5C, 0x60, 0x97, 0x4E, 0xFC, 0x20, 0x0D, 0x30, 0x87, 0x5E, 0x9A, 0xA5,
+    0xA0, 0xA9, 0xF5, 0x63, 0x9C, 0x4A, 0x3C, 0x5C, 0xE9, 0x2C, 0xF5, 0x54, 0xEC, 0xEF, 0x61, 0xD9,
+    0xF6, 0xF2, 0x70, 0x2E, 0xA6, 0x99, 0x09, 0x46, 0x4B, 0x75, 0x05, 0x7D, 0x84, 0x15, 0x21, 0x22,
+    0x47, 0x3B, 0x6D, 0x14, 0xDC, 0x50, 0x0C, 0x17, 0x72, 0x3C, 0x4B, 0x46, 0x4A, 0x66, 0x30, 0x94,
+    0x37, 0xBE, 0x15, 0x7C, 0x33, 0x58, 0x75, 0xFE, 0x1E, 0x39, 0x59, 0x60, 0x76, 0x2E, 0x43, 0x0C,
+    0xD2, 0xD1, 0x62, 0xFC, 0xD7, 0xD6, 0xE1, 0x31, 0x8F, 0xB4, 0x0B, 0xE3, 0x2E, 0x69, 0x72, 0x2A,
+    0xF6, 0x4A, 0xAF, 0x74, 0xA9, 0xF4, 0x77, 0xBD, 0x06, 0xBB, 0xD8, 0xA6, 0x3A, 0x55, 0xD0, 0x48,
+    0xE7, 0x07, 0x3F, 0xD8, 0xD8, 0x2C, 0xCD, 0x02, 0x8F, 0xDA, 0x69, 0xE7, 0x46, 0x33, 0x9B, 0x58,
+    0x25, 0x51, 0xC0, 0xF0, 0x43, 0x1B, 0xB9, 0xBB, 0xCF, 0x65, 0xD7, 0x5E, 0x73, 0x77, 0xAF, 0xCF,
+    0xB1, 0x2B, 0x90, 0x09, 0x76, 0x0B, 0x76, 0xC0, 0xDC, 0xF2, 0xE9, 0x0A, 0xE1, 0x7A, 0x29, 0x8B,
+    0xD0, 0x15, 0x14, 0x9B, 0x6C, 0xCE, 0x08, 0x50, 0xBF, 0x5C, 0xC5, 0x46, 0x3B, 0xD1, 0xB3, 0x40,
+    0x9F, 0x11, 0xF7, 0xF5, 0x68, 0x95, 0x66, 0x86, 0x15, 0xFF, 0x5D, 0x44, 0xC6, 0x56, 0x2A, 0xB9,
+    0x47, 0x1A, 0x48, 0x8F, 0xC9, 0x65, 0x5C, 0x68, 0x83, 0x41, 0xC1, 0xE5, 0x2D, 0x32, 0x85, 0x71,
+    0xF1, 0x49, 0xCA, 0xCC, 0x88, 0xF8, 0xBE, 0x02, 0xA0, 0x06, 0x8A, 0x36, 0xB3, 0x03, 0x25, 0x37,
+    0xF0, 0x17, 0x7A, 0x3B, 0x80, 0xFC, 0xA3, 0x2C, 0xED, 0x65, 0x92, 0xF6, 0x0F, 0x04, 0xEF, 0x69,
+    0x44, 0x00, 0x47, 0x8C, 0x01, 0xA3, 0x43, 0x50, 0xA5, 0x64, 0x96, 0xC3, 0x2C, 0x9B, 0x98, 0xEE,
+    0x62, 0x1B, 0x37, 0x75, 0x60, 0x8D, 0xDA, 0x18, 0xF7, 0x8A, 0xFC, 0x9B, 0xA5, 0x60, 0xAF, 0x10,
+    0x40, 0x9C, 0x05, 0x0E, 0xFB, 0x04, 0x16, 0x08, 0x5E, 0x14, 0xE6, 0x2A, 0x96, 0x61, 0x03, 0xDB,
+    0x1B, 0x7A, 0xDE, 0x3E, 0xD3, 0x33, 0xA8, 0x05, 0x7A, 0xB4, 0xD4, 0x23, 0x4A, 0x6A, 0x28, 0x59,
+    0xDD, 0x22, 0x43, 0xFC, 0x85, 0x11, 0x82, 0xE6, 0x46, 0x12, 0x60, 0xE8, 0x3B, 0x32, 0xA8, 0xF8,
+    0x4A, 0x0A, 0xFB, 0x84, 0xA3, 0xE4, 0xB0, 0x5B, 0x11, 0x44, 0x92, 0x90, 0x55, 0xA5, 0xB0, 0x10,
+    0x2D, 0xF5, 0x8F, 0x48, 0x87, 0xB8, 0x71, 0x80, 0xC0, 0xFA, 0x9A, 0x22, 0x43, 0x45, 0x75, 0xBB,
+    0x93, 0xEB, 0xE3, 0x43, 0xE4, 0x4A, 0xFD, 0x50, 0x30, 0x6E, 0xC2, 0x7F, 0x86, 0xF8, 0x41, 0x09,
+    0x9C, 0xFC, 0x08, 0x8D, 0x91, 0xBC, 0x7B, 0x52, 0xA4, 0x47, 0x50, 0x2D, 0x45, 0x86, 0x6A, 0x94,
+    0x1B, 0x3A, 0x12, 0xE6, 0x22, 0x65, 0x36, 0x17, 0x3A, 0x15, 0x65, 0x01, 0xB9, 0x97, 0x99, 0x6E,
+    0x5B, 0xD6, 0x59, 0x57, 0xAA, 0xC5, 0xE4, 0x53, 0x58, 0xF6, 0x8A, 0xDA, 0xA9, 0x34, 0xA2, 0x88,
+    0x9D, 0xDE, 0x78, 0xDD, 0xC4, 0xBC, 0x29, 0x55, 0xB6, 0x06, 0x50, 0xC4, 0xD3, 0x2C, 0x37, 0x82,
+    0xF5, 0x23, 0x6E, 0xB2, 0x09, 0x01, 0x2D, 0x8C, 0x9B, 0x19, 0x06, 0xCD, 0xEB, 0x7C, 0xE3, 0xB0,
+    0xA2, 0x24, 0xF6, 0x84, 0x52, 0x71, 0x2A, 0xEC, 0x2D, 0xFF, 0xF3, 0x4F, 0xE9, 0xFD, 0xA3, 0x7C,
+    0x5A, 0xE5, 0x5A, 0xA3, 0x41, 0x87, 0x89, 0x76, 0xAE, 0x94, 0x0E, 0xED, 0x78, 0xEB, 0xAF, 0x4C,
+    0xBE, 0xBF, 0x95, 0xE5, 0x19, 0x93, 0x91, 0xDC, 0x25, 0xB2, 0x71, 0x5E, 0x6A, 0xD2, 0x3F, 0xC6,
+    0xEB, 0x87, 0x89, 0x38, 0x15, 0x4A, 0xA2, 0x0C, 0x28, 0x58, 0xE2, 0x2C, 0x22, 0x47, 0x8E, 0x0C,
+    0x33, 0x84, 0xDC, 0x70, 0x17, 0x5D, 0x71, 0xD8, 0x95, 0x5D, 0x5C, 0x08, 0x3D, 0x22, 0xCB, 0x0B,
+    0xE3, 0xDD, 0x05, 0xFF, 0xE2, 0xA1, 0x2E, 0xE8, 0xA1, 0x48, 0x06, 0xA7, 0xD9, 0x70, 0x26, 0x47,
+    0xCA, 0x6A, 0x4B, 0x78, 0xD1, 0xF0, 0x4D, 0x48, 0xFC, 0x21, 0x24, 0xD4, 0xBF, 0xB6, 0xFF, 0xA8,
+    0xFE, 0x9D, 0x91, 0x41, 0x77, 0x71, 0x72, 0x7D, 0x94, 0x4A, 0x25, 0xDA, 0x09, 0xDA, 0x58, 0xE1,
+    0x8C, 0x35, 0x48, 0x91, 0xC8, 0x56, 0xB9, 0xF0, 0x1D, 0xFA, 0x30, 0x35, 0xEB, 0x67, 0x7A, 0x0C,
+    0x26, 0x2B, 0xBA, 0x91, 0x8E, 0x66, 0x85, 0x16, 0xEE, 0x15, 0xD6, 0x55, 0xA9, 0x0E, 0x90, 0x6E,
+    0xE8, 0x9A, 0x20, 0xEE, 0x9F, 0x36, 0xEC, 0x41, 0x84, 0xDB, 0x93, 0x4E, 0x81, 0x4C, 0xD0, 0xD4,
+    0x5A, 0x2E, 0xE4, 0xA9, 0xF8, 0x81, 0x14, 0x91, 0xD6, 0x26, 0xD5, 0xFA, 0xAD, 0x4E, 0xA4, 0xD0,
+    0xB1, 0x83, 0x43, 0x1A, 0x27, 0x34, 0x85, 0x5E, 0xF8, 0x66, 0x4B, 0x7E, 0xD1, 0x23, 0x0B, 0x2C,
+    0x26, 0x56, 0x80, 0x2B, 0xE1, 0xA7, 0x2E, 0x4B, 0x95, 0xB6, 0x77, 0xE7, 0xD7, 0x43, 0x4B, 0xB0,
+    0x53, 0xBD, 0xB8, 0xB1, 0x59, 0xC8, 0xC7, 0xA3, 0x19, 0x90, 0x0E, 0xD8, 0x4D, 0x60, 0x33, 0x86,
+    0xDF, 0x74, 0xF4, 0xA5, 0x0F, 0x87, 0xA1, 0x59, 0xC2, 0x6D, 0x6F, 0xFC, 0x01, 0x2E, 0x12, 0x44,
+    0xB0, 0x8D, 0x42, 0xAD, 0x9E, 0x37, 0x66, 0x34, 0x6A, 0xE0, 0xF4, 0x9D, 0x6F, 0x0A, 0x39, 0x24,
+    0x31, 0x33, 0x25, 0x17, 0xCC, 0x08, 0xC4, 0xEF, 0x51, 0x3E, 0x70, 0xF5, 0x2C, 0xA2, 0x07, 0xBD,
+    0x07, 0x7F, 0xE7, 0x17, 0x5A, 0xAF, 0xEF, 0xDB, 0xE8, 0x5F, 0x6B, 0xE6, 0x67, 0x6E, 0x64, 0x93,
+    0x16, 0x8F, 0x8F, 0x8F, 0xB4, 0x08, 0xDD, 0x2E, 0x42, 0xE8, 0xEF, 0xC2, 0xC0, 0x7E, 0x04, 0xA5,
+    0xB7, 0xDB, 0x22, 0xBD, 0xAD, 0x9E, 0xD1, 0xBE, 0xF0, 0x01, 0xC5, 0xA7, 0x13, 0xD0, 0x01, 0x7B,
+    0xF6, 0xBF, 0xB4, 0x31, 0x7C, 0x0D, 0xE8, 0xBF, 0xFA, 0x18, 0xAE, 0x74, 0x02, 0xEC, 0xB1, 0xC0,
+    0x46, 0x3B, 0x92, 0x2F, 0x00, 0xFD, 0x73, 0x40, 0xFF, 0xE9, 0x8D, 0xD6, 0xFE, 0xFF, 0x3C, 0xFF,
+    0x02, 0xC5, 0x55, 0xB1, 0xB2, 0xDD, 0x34, 0x10, 0x5D, 0x5B, 0x64, 0x5C, 0xB8, 0x10, 0x45, 0xE8,
+    0x18, 0xDC, 0x53, 0xA0, 0x4F, 0x90, 0x87, 0x86, 0x1F, 0x20, 0x15, 0x05, 0x1F, 0x40, 0xF1, 0x3E,
+    0x41, 0xA6, 0x4E, 0x11, 0x1A, 0x3E, 0x21, 0x33, 0x40, 0x93, 0x4F, 0xB0, 0x32, 0x29, 0x28, 0x68,
+    0xEE, 0xD0, 0x50, 0x50, 0x20, 0x06, 0x1A, 0x86, 0x02, 0x0D, 0xE3, 0xCC, 0x38, 0x41, 0xD6, 0x72,
+    0x8E, 0x7C, 0xDF, 0x4B, 0x42, 0x0D, 0x83, 0x0B, 0xBD, 0xFB, 0x2C, 0x69, 0xF7, 0x9C, 0xB3, 0x67,
+    0xD7, 0xE2, 0x2F, 0x22, 0xE6, 0x10, 0x91, 0x10, 0x45, 0xC6, 0x82, 0x1F, 0xBA, 0x88, 0xD8, 0x8D,
+    0x3F, 0x66, 0x91, 0xE9, 0x4F, 0x4D, 0xBD, 0xAA, 0x46, 0xAF, 0x5A, 0x8D, 0xBE, 0xD4, 0xEC, 0x93,
+    0xD1, 0xA1, 0x88, 0xCB, 0x6B, 0xEC, 0xD5, 0xEE, 0xE2, 0x93, 0xCE, 0xE6, 0x98, 0xB2, 0x84, 0xA7,
+    0x2A, 0x43, 0x71, 0x49, 0xD6, 0x67, 0x55, 0xEC, 0x8E, 0xC0, 0x0C, 0x20, 0x67, 0x30, 0x83, 0xC8,
+    0x9D, 0xE2, 0x9F, 0x15, 0xD1, 0x7D, 0xBA, 0x7D, 0xB9, 0x5E, 0xBA, 0xAA, 0x87, 0xAC, 0x4C, 0x70,
+    0x84, 0x6C, 0xCB, 0x50, 0x86, 0x2A, 0x8A, 0x93, 0x21, 0xAE, 0x8B, 0x4B, 0xFE, 0x62, 0x37, 0x9B,
+    0xCD, 0x81, 0x84, 0xDA, 0xFF, 0xE3, 0x25, 0xCE, 0xB6, 0x88, 0xE7, 0xD3, 0xAD, 0x3B, 0x56, 0x8F,
+    0x60, 0x32, 0xA8, 0x22, 0x9B, 0xAF, 0xEB, 0x26, 0x46, 0x17, 0x9F, 0xBE, 0x72, 0xBB, 0xAC, 0x0F,
+    0xB3, 0x46, 0x53, 0xFD, 0xB7, 0x40, 0xBE, 0x69, 0x78, 0xFE, 0x99, 0x3E, 0x03, 0x2B, 0x2D, 0x03,
+    0xD7, 0x85, 0x0C, 0xBF, 0x38, 0x25, 0x38, 0x51, 0x82, 0x48, 0x43, 0xCE, 0x98, 0xE2, 0x33, 0xD7,
+    0xF0, 0xE2, 0x13, 0x48, 0x85, 0x83, 0x33, 0x57, 0x2A, 0xB6, 0x2A, 0x5E, 0xC8, 0xBD, 0xF9, 0x0E,
+    0x43, 0xC0, 0x5B, 0xAB, 0x95, 0xFB, 0xE5, 0x1D, 0x7B, 0xD8, 0xE7, 0x7B, 0x88, 0xEE, 0xF7, 0x5F,
+    0x40, 0xE8, 0xE6, 0xA7, 0xED, 0xA6, 0x04, 0xEA, 0x08, 0xAA, 0xBB, 0x4C, 0xF5, 0xB1, 0x08, 0x94,
+    0x42, 0x8C, 0xC8, 0x8C, 0xCB, 0xBB, 0x40, 0xAA, 0x99, 0x4B, 0x94, 0x5E, 0x5F, 0x60, 0xE3, 0xBE,
+    0xFC, 0xFF, 0xD4, 0x58, 0xAB, 0xD3, 0x1C, 0x62, 0xCF, 0x83, 0xAF, 0xA2, 0x8C, 0xBB, 0xBC, 0xF9,
+    0xFC, 0x8B, 0xE4, 0x69, 0x16, 0xB1, 0x3C, 0x11, 0x80, 0xA0, 0x3F, 0x6E, 0xF3, 0xBF, 0x4F, 0x3C,
+    0x41, 0xD3, 0x88, 0x34, 0x38, 0xDC, 0x01, 0x24, 0x6D, 0x04, 0x3C, 0xB0, 0x1F, 0xEC, 0x41, 0x63,
+    0x11, 0xAE, 0x8F, 0x8D, 0x24, 0xE0, 0x93, 0x25, 0x58, 0x61, 0x9B, 0xA8, 0x43, 0x86, 0x8A, 0xED,
+    0xF6, 0xC9, 0xEF, 0xEE, 0xF1, 0xF3, 0x69, 0xA4, 0x3A, 0xD2, 0xF7, 0x08, 0xC5, 0x1E, 0xE0, 0xDF,
+    0x2B, 0xC9, 0x8F, 0x5F, 0x3B, 0x3B, 0xC0, 0xF2, 0x71, 0x38, 0x88, 0x48, 0x99, 0xD0, 0xA5, 0xA1,
+    0x18, 0xE6, 0x8E, 0x2E, 0xB9, 0xCC, 0xAC, 0xFA, 0x61, 0x13, 0xD2, 0x94, 0x69, 0x27, 0x7A, 0x9B,
+    0x19, 0x6D, 0x28, 0xE1, 0x51, 0xA3, 0xF5, 0x17, 0x69, 0x42, 0x80, 0x53, 0xE8, 0x4E, 0x49, 0x9D,
+    0xCA, 0x9D, 0xAF, 0xF5, 0xC7, 0x9D, 0xA7, 0xC7, 0xEA, 0xBE, 0x27, 0xA4, 0x90, 0x75, 0x68, 0x65,
+    0x37, 0x85, 0x54, 0xFC, 0x36, 0x65, 0x47, 0xA5, 0x96, 0x75, 0x09, 0x17, 0x71, 0x05, 0x6C, 0x75,
+    0xE9, 0x34, 0xDA, 0x0C, 0xFA, 0xF6, 0x38, 0x91, 0xE1, 0x79, 0x70, 0x42, 0x1E, 0x93, 0x63, 0x50,
+    0x59, 0x3F, 0x6A, 0x44, 0xA0, 0x70, 0xA3, 0x30, 0x9D, 0xF4, 0xE4, 0xDE, 0x6B, 0xB4, 0xDC, 0x06,
+    0xB1, 0xA7, 0xA3, 0x87, 0x3E, 0xDB, 0xA8, 0xD1, 0xE9, 0xAC, 0xA4, 0x3F, 0xED, 0x36, 0x87, 0x5F,
+    0x11, 0xE1, 0x69, 0x25, 0x00, 0xF4, 0xF7, 0xCF, 0x8C, 0xE1, 0x7F, 0xA8, 0x21, 0x35, 0x3B, 0x36,
+    0x16, 0xE1, 0x44, 0x6F, 0xAB, 0xFE, 0xD1, 0x26, 0xC8, 0xB8, 0xA1, 0x04, 0x9C, 0x0C, 0xAC, 0xC6,
+    0x54, 0x6C, 0xF6, 0x1B, 0x08, 0x7F, 0x8E, 0xBE, 0xDE, 0x8D, 0x26, 0x97, 0xAC, 0x2E, 0x61, 0x43,
+    0x5D, 0xE1, 0xDE, 0xD6, 0x3D, 0x6F, 0xE1, 0xF0, 0xC5, 0x60, 0x6A, 0x64, 0xC3, 0x19, 0x02, 0x2E,
+    0x3D, 0xCE, 0xCE, 0x82, 0x2B, 0x0B, 0x76, 0xB0, 0x40, 0x44, 0x16, 0x15, 0x8E, 0xE9, 0x6B, 0x68,
+    0x66, 0x4D, 0x6C, 0x89, 0xDA, 0x94, 0xDB, 0x1A, 0x90, 0xB9, 0xD7, 0x07, 0xD0, 0x52, 0xE7, 0x11,
+    0x3A, 0x60, 0xF8, 0x2C, 0xA8, 0xBA, 0x47, 0x71, 0x60, 0x82, 0xBE, 0x0A, 0xA2, 0x33, 0xE0, 0x02,
+    0x60, 0x1C, 0x79, 0xB4, 0xC4, 0xB5, 0x09, 0x20, 0x9B, 0x3C, 0xBE, 0xA9, 0xAD, 0x24, 0x90, 0x8C,
+    0x4B, 0x7F, 0xD6, 0xA6, 0x61, 0xC3, 0xD4, 0xB9, 0x4C, 0x79, 0x42, 0x0C, 0x84, 0x00, 0x96, 0x68,
+    0x0E, 0x74, 0x8D, 0xFF, 0xAE, 0xC8, 0x50, 0x95, 0x9D, 0x92, 0x08, 0x21, 0xB2, 0x7D, 0x64, 0x7A,
+    0xB9, 0x12, 0xFC, 0x0A, 0x2B, 0x98, 0xC3, 0x10, 0x86, 0x8F, 0x6D, 0x78, 0x31, 0x65, 0xEB, 0x3B,
+    0x5A, 0x1E, 0xAC, 0xDF, 0x7B, 0xA2, 0x2C, 0xFD, 0x05, 0xA5, 0xA0, 0x81, 0xEF, 0x7A, 0xC9, 0xF3,
+    0x5D, 0x0B, 0x75, 0x6D, 0x75, 0xD7, 0x88, 0xA2, 0x18, 0x0B, 0xEE, 0x53, 0x4D, 0x97, 0x89, 0x5C,
+    0x67, 0xB4, 0xA2, 0x29, 0xE0, 0x05, 0x22, 0xEC, 0x81, 0x95, 0xC4, 0xCC, 0xD1, 0xB5, 0x5E, 0xE0,
+    0x18, 0x57, 0x0C, 0x4A, 0x36, 0x03, 0x48, 0x3B, 0xCC, 0x4A, 0xF6, 0xD9, 0x94, 0xBB, 0x9B, 0x02,
+    0xC0, 0x8F, 0xF4, 0x62, 0xB4, 0x7A, 0xC8, 0xAD, 0x19, 0xE9, 0xBC, 0x2E, 0x6F, 0x5F, 0x7B, 0x4E,
+    0xA6, 0x24, 0xD7, 0xC1, 0x7F, 0x7E, 0x0B, 0x84, 0x5A, 0x8B, 0xD1, 0x37, 0x5B, 0xDD, 0x01, 0x53,
+    0x77, 0x6D, 0xD9, 0x0C, 0xFD, 0x6E, 0x12, 0x92, 0x82, 0xA2, 0x4F, 0x5C, 0x22, 0x90, 0xAC, 0x11,
+    0xF8, 0x74, 0x5E, 0xE1, 0x4D, 0x61, 0x61, 0xA0, 0x62, 0x03, 0xF7, 0x29, 0x47, 0xB6, 0xEE, 0xBD,
+    0x16, 0x45, 0xA9, 0x77, 0x88, 0xA9, 0xF9, 0xFE, 0xB5, 0xD7, 0x1D, 0x53, 0xD1, 0x37, 0xB2, 0xCE,
+    0x4D, 0x77, 0x54, 0xE0, 0x6B, 0x1A, 0x03, 0xFF, 0x83, 0xA2, 0xBF, 0x40, 0xC0, 0x89, 0x3E, 0x07,
+    0x32, 0xCC, 0xB5, 0xDA, 0x8A, 0xDC, 0x76, 0xE2, 0x75, 0xE7, 0x9B, 0x27, 0x85, 0xDA, 0x55, 0xCA,
+    0x88, 0x1D, 0x9A, 0xF2, 0xEE, 0xCE, 0x8E, 0x3B, 0xE6, 0x7A, 0x87, 0x1F, 0xAB, 0xD8, 0xBE, 0x61,
+    0x88, 0xC2, 0x9D, 0xD9, 0x9C, 0x96, 0x99, 0xAF, 0x15, 0x6A, 0x5F, 0x28, 0xB6, 0x84, 0xFC, 0xB6,
+    0x72, 0xDE, 0xB2, 0x12, 0x96, 0x9E, 0x30, 0xAD, 0x54, 0xB7, 0xC6, 0xF0, 0x30, 0x86, 0x29, 0xED,
+    0xBB, 0xE4, 0xD3, 0xB8, 0xB7, 0x66, 0xF4, 0xD1, 0x6E, 0x74, 0x23, 0xBF, 0x69, 0xD9, 0x12, 0x8C,
+    0x7E, 0x49, 0x03, 0x99, 0xA3, 0x9D, 0x73, 0x69, 0x2C, 0xAF, 0xCE, 0x95, 0xC6, 0x92, 0x05, 0x05,
+    0xB4, 0x26, 0xF6, 0x07, 0xC8, 0xD7, 0x73, 0x10, 0x3B, 0x54, 0xA6, 0xD3, 0x24, 0xFF, 0xF1, 0xF3,
+    0x37, 0xAD, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x28, 0x72, 0xE1, 0x62, 0x1A, 0xD2,
+    0xD0, 0x4C, 0x8F, 0x90, 0xE6, 0x27, 0x8C, 0xB3, 0xFC, 0x00, 0x52, 0x40, 0x9D, 0x3E, 0xCD, 0xFB,
+    0x09, 0xE3, 0x24, 0x65, 0x9A, 0x2D, 0xE8, 0x68, 0x28, 0xD1, 0x4B, 0xB1, 0x2D, 0x0D, 0xF1, 0xB0,
+    0x29, 0x28, 0x28, 0x30, 0x2B, 0xD1, 0x5B, 0xBB, 0x82, 0x22, 0x4D, 0x46, 0xC9, 0x84, 0x35, 0xBB,
+    0x63, 0x5F, 0xCE, 0x1D, 0xBF, 0xB7, 0x89, 0x44, 0x85, 0x84, 0xA5, 0x37, 0xFE, 0x9C, 0x7B, 0xCF,
+    0xB9, 0xE7, 0xDC, 0xFB, 0xC8, 0x8D, 0x34, 0x74, 0x2A, 0x93, 0x4E, 0xE4, 0x43, 0xC5, 0xD4, 0x66,
+    0x32, 0x91, 0xB8, 0xAF, 0x57, 0x79, 0x84, 0xB7, 0x4C, 0xAA, 0x3C, 0xF2, 0xA1, 0xE6, 0xFD, 0x59,
+    0x26, 0xC7, 0xCC, 0xBD, 0xC2, 0x92, 0xCA, 0x25, 0x35, 0xE5, 0xED, 0x70, 0xDC, 0x30, 0x11, 0x77,
+    0x6A, 0x91, 0x47, 0x4E, 0xC2, 0x35, 0x9C, 0xED, 0x44, 0x03, 0x3F, 0x5B, 0x48, 0x73, 0x72, 0x81,
+    0xB0, 0x03, 0x87, 0x1D, 0xB1, 0x60, 0x27, 0x0E, 0xEE, 0xB0, 0xE0, 0x73, 0x22, 0xB5, 0xCA, 0xFD,
+    0x10, 0x68, 0x3B, 0x18, 0xD9, 0xF1, 0x09, 0x93, 0x8D, 0x72, 0xEA, 0xED, 0x84, 0xB8, 0xDC, 0xEB,
+    0x88, 0x93, 0x67, 0x8E, 0x35, 0xB2, 0x07, 0xCD, 0xBC, 0x92, 0xFB, 0xE3, 0x51, 0x42, 0x2E, 0x17,
+    0xDA, 0x8C, 0x93, 0x9D, 0xDA, 0xF5, 0x3B, 0xEE, 0x1C, 0xBF, 0xC2, 0xAE, 0xD5, 0x44, 0xC5, 0x12,
+    0xDC, 0xF5, 0x44, 0xF5, 0x82, 0x0B, 0x1D, 0x0F, 0x49, 0x4B, 0xFA, 0xCF, 0x4E, 0xA9, 0x9D, 0xB1,
+    0x05, 0xA0, 0x57, 0x81, 0xFF, 0x9B, 0x10, 0x12, 0xB6, 0xE7, 0x2B, 0x5E, 0x08, 0xFD, 0x2F, 0x50,
+    0x9B, 0x28, 0xA5, 0x69, 0x16, 0x20, 0xF1, 0x7F, 0x0F, 0xAB, 0x90, 0x1F, 0x0D, 0x73, 0x26, 0xBF,
+    0x78, 0xA0, 0x6D, 0x25, 0x10, 0x23, 0x3E, 0x02, 0xD0, 0x1E, 0xFC, 0x0C, 0x32, 0xD6, 0xC0, 0x85,
+    0x02, 0x8D, 0x52, 0x3D, 0xA2, 0x7F, 0x7D, 0x46, 0x7C, 0x60, 0x69, 0xA7, 0x66, 0xE6, 0xCE, 0x5E,
+    0x81, 0xDA, 0xA3, 0xA8, 0xB2, 0x0F, 0xF6, 0xED, 0x4A, 0xFC, 0x7C, 0x6E, 0x57, 0xFB, 0x7E, 0x48,
+    0xE0, 0x19, 0x78, 0x65, 0x1A, 0x9E, 0xCF, 0x24, 0x62, 0x3C, 0x86, 0x1A, 0xC8, 0xAB, 0x91, 0xC0,
+    0x43, 0x23, 0xF0, 0x69, 0x41, 0x07, 0x65, 0x25, 0x64, 0x6B, 0xF0, 0xCD, 0xA7, 0xBD, 0x70, 0xCD,
+    0x54, 0x31, 0x84, 0x88, 0xF8, 0xB0, 0x6F, 0x38, 0x00, 0x27, 0x59, 0xD9, 0x09, 0x61, 0xA1, 0x16,
+    0x07, 0xB9, 0x5A, 0xA1, 0xD7, 0x9B, 0xB1, 0xB9, 0x85, 0xEE, 0xBE, 0x73, 0x67, 0x63, 0x9D, 0x97,
+    0x2A, 0x33, 0xE9, 0x77, 0x49, 0x5F, 0x41, 0xE5, 0x5F, 0x27, 0x6F, 0x26, 0x5A, 0xED, 0xB3, 0x79,
+    0xE8, 0x9A, 0xF4, 0xD2, 0xA0, 0x98, 0xF6, 0x7C, 0x5E, 0x51, 0x3D, 0x6E, 0xAF, 0xA3, 0x0B, 0x2A,
+    0x1B, 0x7E, 0xB2, 0x92, 0x99, 0x7C, 0x6E, 0x11, 0xE2, 0x01, 0x4F, 0x8E, 0x2F, 0x72, 0xC3, 0x10,
+    0x58, 0x47, 0x33, 0x37, 0x3C, 0xBB, 0xE0, 0x02, 0x72, 0x09, 0xC9, 0xAA, 0x28, 0xBB, 0x95, 0x1E,
+    0x0A, 0x0B, 0x46, 0x52, 0x4B, 0xB9, 0x71, 0xE5, 0x59, 0x55, 0x5C, 0xB0, 0xC9, 0x8E, 0x0C, 0x50,
+    0x33, 0x56, 0xA2, 0xB0, 0x88, 0x87, 0xB5, 0xE1, 0x09, 0x17, 0x9A, 0x47, 0x75, 0x1B, 0x0D, 0x40,
+    0x5F, 0x27, 0x37, 0x84, 0xF6, 0x3A, 0x79, 0x17, 0x80, 0x77, 0xF1, 0xBD, 0x7E, 0xF7, 0x57, 0x1E,
+    0x3A, 0x7D, 0x75, 0x9B, 0x06, 0x32, 0x17, 0x1C, 0xE1, 0x82, 0x0B, 0x1E, 0x61, 0x89, 0x73, 0xFE,
+    0x89, 0x33, 0xD6, 0x13, 0xCE, 0xFE, 0x09, 0x2B, 0x4E, 0x1F, 0x70, 0x98, 0xB1, 0xE4, 0x2F, 0x00,
+    0x7D, 0x4F, 0x47, 0x4D, 0xAA, 0x3D, 0x6E, 0x79, 0x6A, 0xA1, 0x1F, 0x8A, 0x5F, 0x41, 0x41, 0xD1,
+    0x8B, 0x8B, 0x47, 0x6B, 0x9C, 0xE0, 0x70, 0x81, 0x8E, 0x7D, 0x62, 0x20, 0x70, 0xD1, 0x73, 0xF1,
+    0x13, 0x5E, 0xC3, 0x7C, 0xE4, 0x61, 0xFC, 0x6D, 0xF7, 0xC0, 0xE3, 0x91, 0x53, 0x1B, 0x91, 0xAC,
+    0xCE, 0x92, 0xD7, 0x09, 0x84, 0xA6, 0x58, 0xF2, 0xDE, 0x1D, 0x67, 0x2D, 0xB5, 0x68, 0xC5, 0x1B,
+    0x0A, 0xBA, 0x21, 0x4D, 0xB1, 0xCA, 0x20, 0xB5, 0xDA, 0x01, 0x9F, 0xFB, 0x05, 0x9F, 0xDB, 0x8B,
+    0x2C, 0xC8, 0x7D, 0x47, 0x6D, 0x42, 0xB4, 0x26, 0x43, 0x6E, 0xB5, 0xA0, 0xB2, 0x15, 0xEF, 0x81,
+    0x02, 0x9E, 0x14, 0x4F, 0xF0, 0xD6, 0xA0, 0x5B, 0xFF, 0x01, 0x99, 0x96, 0xDE, 0x51, 0x8B, 0xB4,
+    0x16, 0x3F, 0x60, 0xB1, 0x1B, 0xDD, 0xA7, 0xAF, 0xC9, 0x75, 0xE8, 0x9A, 0x73, 0xF1, 0xC2, 0x0C,
+    0x30, 0xC0, 0xF9, 0x09, 0x1D, 0xD4, 0x78, 0x59, 0x71, 0x5E, 0x1B, 0xE6, 0x45, 0xAF, 0xBB, 0x6C,
+    0x66, 0x9D, 0x5D, 0x94, 0x3E, 0x68, 0x67, 0x1F, 0x74, 0x1A, 0x82, 0x8E, 0x43, 0x30, 0xF8, 0xB9,
+    0x69, 0x08, 0x7E, 0x1C, 0xFE, 0xE4, 0x20, 0x16, 0xB5, 0x0C, 0x39, 0x16, 0xB4, 0x58, 0x61, 0xD4,
+    0x8C, 0x3F, 0x00, 0xE9, 0x5B, 0x70, 0xD2, 0x97, 0xC0, 0xDC, 0x86, 0x44, 0x1F, 0x1D, 0x4A, 0xA4,
+    0x2E, 0x5C, 0xB5, 0x2C, 0x56, 0x1C, 0xE2, 0xDE, 0x84, 0x03, 0x55, 0xB6, 0x01, 0x6D, 0x8A, 0x05,
+    0xFE, 0x1A, 0x37, 0xA6, 0x26, 0xC2, 0x88, 0x6E, 0xC4, 0xE2, 0x5F, 0x9F, 0x4D, 0x85, 0x68, 0x25,
+    0x8B, 0xB4, 0xA1, 0xB0, 0xD3, 0xB1, 0xF0, 0x04, 0x63, 0x9D, 0x20, 0x8E, 0x4E, 0x68, 0x36, 0xF4,
+    0xB4, 0x7E, 0x1A, 0xC9, 0xBE, 0x42, 0x6F, 0xFF, 0x9C, 0xC8, 0x9C, 0x4C, 0x77, 0xF9, 0xFF, 0x17,
+    0x8A, 0x80, 0xCD, 0x02, 0x1C, 0x51, 0x36, 0xAD, 0x64, 0x28, 0x6E, 0x4F, 0x45, 0xDE, 0xEC, 0x8B,
+    0xAB, 0x58, 0xBA, 0x16, 0x4F, 0x63, 0x71, 0x77, 0xB3, 0x94, 0xC6, 0x27, 0x7E, 0xC2, 0xFB, 0xEF,
+    0xE5, 0xA9, 0x95, 0x3D, 0x6A, 0xA9, 0xCB, 0x1E, 0x0E, 0x4E, 0x46, 0xA3, 0x59, 0x5F, 0xE4, 0x52,
+    0xA4, 0x12, 0x1E, 0x1E, 0x2A, 0xE1, 0xCD, 0x16, 0x5E, 0xAD, 0xDB, 0xEC, 0xC0, 0x88, 0x94, 0x10,
+    0xB8, 0xC6, 0x0B, 0x34, 0x33, 0x0C, 0x23, 0xC3, 0x28, 0x88, 0xF4, 0xE1, 0x03, 0xCF, 0x1F, 0x79,
+    0xAA, 0x78, 0xC1, 0x2B, 0x41, 0x09, 0xB6, 0xCB, 0x8E, 0x4F, 0x56, 0x93, 0x34, 0x4C, 0xE3, 0x26,
+    0x3D, 0xAB, 0xC5, 0x8D, 0x7A, 0xDE, 0x01, 0x2B, 0x86, 0xA8, 0xF0, 0x46, 0x8E, 0xA1, 0x37, 0x37,
+    0xDF, 0xC0, 0xD4, 0xD2, 0x95, 0x60, 0x2F, 0xEB, 0x25, 0xCF, 0xD5, 0x28, 0x9E, 0xE2, 0x11, 0x35,
+    0xC0, 0x8A, 0x2A, 0x38, 0x10, 0xEA, 0xA8, 0x3A, 0xFA, 0xD7, 0x63, 0xFA, 0x34, 0xC9, 0x86, 0xCD,
+    0xDC, 0x2C, 0x66, 0xFE, 0xEA, 0x28, 0x36, 0x0C, 0x86, 0xCD, 0x98, 0x42, 0x78, 0x85, 0xDD, 0xA5,
+    0x5B, 0xCA, 0xF8, 0x95, 0x66, 0x90, 0x86, 0x21, 0x7B, 0xB3, 0xEF, 0xD4, 0xE1, 0xEF, 0x44, 0x36,
+    0xC4, 0x6D, 0x5A, 0xCE, 0x1F, 0x4D, 0xCB, 0xF2, 0x9D, 0xB9, 0xD9, 0xF7, 0xF5, 0xC1, 0xE0, 0x7D,
+    0x09, 0x4C, 0xF7, 0xBB, 0xFB, 0xA4, 0x27, 0x1B, 0x6A, 0x31, 0x8B, 0xC3, 0xCE, 0x46, 0xDA, 0xE7,
+    0xDE, 0x11, 0xD6, 0x22, 0xC2, 0x88, 0x63, 0xF0, 0x47, 0x30, 0x72, 0x87, 0xD9, 0x3A, 0x82, 0x78,
+    0xD2, 0x69, 0x27, 0x25, 0xC9, 0xB5, 0xC4, 0x18, 0x5E, 0x77, 0xD2, 0x14, 0x65, 0x3A, 0x57, 0xDC,
+    0x7F, 0x7E, 0x44, 0x11, 0x20, 0xE6, 0xE9, 0x5D, 0x5F, 0x10, 0xED, 0x70, 0xD7, 0x48, 0x34, 0x23,
+    0x8B, 0x7F, 0x81, 0xA6, 0xE9, 0x2A, 0xA9, 0xB6, 0xCC, 0x84, 0x6D, 0xC8, 0x17, 0x6D, 0x30, 0xA4,
+    0x77, 0x8C, 0x81, 0x7E, 0x28, 0x7B, 0x74, 0xBC, 0xE7, 0xA7, 0xC0, 0xBB, 0x80, 0xB8, 0x8D, 0x6E,
+    0x44, 0x0E, 0xEE, 0x4D, 0x56, 0xFC, 0x2D, 0x8F, 0xE2, 0x41, 0xB4, 0x02, 0x42, 0x35, 0x65, 0x30,
+    0x3D, 0x3C, 0xE4, 0xAA, 0x4B, 0xD1, 0x16, 0x01, 0xAE, 0x4E, 0xCD, 0x2C, 0x5E, 0x91, 0xBF, 0x90,
+    0xEA, 0x31, 0xC3, 0xF8, 0x19, 0xA1, 0x2F, 0xF9, 0x77, 0xFE, 0x32, 0x35, 0x19, 0x23, 0x76, 0xE2,
+    0x9A, 0xA5, 0x7A, 0x88, 0xD5, 0x15, 0xF6, 0x0F, 0xE9, 0xBF, 0x1C, 0xFF, 0x00, 0xB5, 0x55, 0x3F,
+    0x6F, 0x1F, 0x45, 0x10, 0x9D, 0xBB, 0x4B, 0x7C, 0x82, 0x93, 0x58, 0x37, 0x34, 0xA4, 0xD8, 0x6F,
+    0x90, 0xFB, 0x04, 0x64, 0x17, 0x52, 0x50, 0x9A, 0xC6, 0xA2, 0xA0, 0xA0, 0xA7, 0xF1, 0x27, 0xB0,
+    0xEE, 0x02, 0x85, 0x8B, 0x14, 0x50, 0x51, 0x53, 0x50, 0xD9, 0x85, 0x5B, 0x0A, 0x4B, 0xBB, 0xA4,
+    0xA1, 0x3D, 0xF1, 0x05, 0xB2, 0x21, 0x41, 0x14, 0x29, 0x58, 0x45, 0x67, 0xB4, 0x98, 0xDB, 0x1D,
+    0xDE, 0xEC, 0xCF, 0x36, 0x91, 0xA2, 0xD0, 0x71, 0x92, 0xD7, 0xF2, 0xFE, 0x99, 0x79, 0xEF, 0xCD,
+    0x9B, 0x31, 0xD1, 0xB1, 0x9A, 0xA9, 0x4B, 0x8E, 0x48, 0xFD, 0xBA, 0x11, 0xDD, 0xEF, 0x17, 0xBA,
+    0xFD, 0x1A, 0x57, 0x2C, 0x69, 0xE6, 0x99, 0x26, 0x2C, 0x4D, 0x39, 0x67, 0xDB, 0x50, 0xCF, 0x38,
+    0x19, 0x70, 0x95, 0x54, 0xC4, 0x62, 0xE4, 0x3E, 0xF6, 0x1D, 0x67, 0x72, 0xCC, 0x11, 0xD7, 0xD9,
+    0x73, 0x39, 0x2B, 0x43, 0x21, 0xB5, 0x9A, 0x40, 0xCE, 0xB3, 0xED, 0x4B, 0x57, 0x68, 0x8A, 0xAA,
+    0x1C, 0xB1, 0xC5, 0x85, 0x95, 0x46, 0x66, 0x89, 0x8C, 0xB7, 0x8D, 0x95, 0x70, 0x8F, 0x56, 0x9A,
+    0x0E, 0x62, 0xBB, 0x99, 0xB9, 0x0B, 0x17, 0x37, 0xE9, 0x07, 0x0E, 0x84, 0xCB, 0x1D, 0xA2, 0xBE,
+    0x67, 0xA7, 0x40, 0x08, 0x45, 0x0D, 0xD3, 0xDD, 0xB3, 0xAD, 0xC7, 0x16, 0x92, 0x3D, 0xE6, 0xCF,
+    0xB2, 0x59, 0x74, 0x64, 0xE2, 0xAF, 0xB7, 0x61, 0x53, 0xCC, 0x8B, 0x06, 0x0C, 0x0D, 0xC0, 0x35,
+    0x2C, 0xD1, 0x4D, 0xB4, 0xF1, 0xE7, 0x54, 0x7F, 0xB3, 0xAE, 0xF4, 0x9A, 0xF5, 0x3E, 0xBD, 0xF1,
+    0x35, 0x00, 0x1C, 0x1B, 0xB6, 0xDD, 0x46, 0xC6, 0xAB, 0x44, 0x43, 0x42, 0x32, 0xF6, 0xD8, 0x1C,
+    0x92, 0xF0, 0x1D, 0x83, 0x59, 0x1C, 0x9E, 0x1B, 0xCF, 0x7D, 0xC1, 0x7D, 0xF7, 0x70, 0x03, 0x3D,
+    0x20, 0xD2, 0xCF, 0x45, 0x92, 0xAE, 0x00, 0x54, 0x45, 0x2D, 0xDC, 0x48, 0x24, 0x13, 0x91, 0x80,
+    0xBE, 0x6E, 0x9B, 0x3F, 0x8B, 0xDC, 0x6E, 0xF9, 0xF1, 0x0A, 0x1A, 0xA4, 0x37, 0xF3, 0x13, 0xAE,
+    0x35, 0xD0, 0x0A, 0xD2, 0x90, 0xCA, 0xFD, 0x26, 0x39, 0x38, 0x8C, 0x41, 0xAF, 0x88, 0x01, 0x49,
+    0x71, 0x7D, 0x8A, 0x00, 0xE3, 0x7C, 0xC7, 0xB6, 0x22, 0xAB, 0x4C, 0xBA, 0x50, 0x89, 0x49, 0xC5,
+    0x24, 0xCB, 0x81, 0x04, 0xA7, 0x36, 0x1C, 0xBF, 0xC1, 0xA7, 0x85, 0xEE, 0xA0, 0xB0, 0x8C, 0x85,
+    0x9C, 0x75, 0x5B, 0xCB, 0xAB, 0x8A, 0x23, 0xCA, 0xC8, 0x33, 0xF0, 0x5B, 0x94, 0x50, 0x07, 0x08,
+    0x45, 0xD3, 0x93, 0xA2, 0x11, 0xA3, 0xCB, 0xD3, 0xEF, 0x65, 0x07, 0x5B, 0xCA, 0x02, 0x85, 0x2B,
+    0x7C, 0xFE, 0xA3, 0x40, 0x02, 0x68, 0x00, 0xB6, 0xC2, 0x51, 0x45, 0x14, 0xBC, 0xA2, 0x66, 0xDB,
+    0x72, 0xD2, 0xA8, 0xF7, 0x6C, 0x4A, 0x5B, 0x88, 0x53, 0xCF, 0x76, 0x5C, 0x5A, 0x9E, 0xEF, 0xD4,
+    0xEC, 0x00, 0xDB, 0xC6, 0x63, 0x6A, 0xB2, 0xF1, 0x15, 0xE4, 0xF0, 0x28, 0xDE, 0x22, 0xDB, 0x43,
+    0x91, 0x50, 0xAC, 0xD8, 0x22, 0x09, 0x3D, 0xF8, 0x8E, 0x97, 0x3B, 0x04, 0xD2, 0x80, 0x20, 0x09,
+    0x45, 0x59, 0xDF, 0x7C, 0xC9, 0xBE, 0xA9, 0xC6, 0x03, 0xD2, 0x91, 0x93, 0xBC, 0x41, 0xC4, 0x11,
+    0x31, 0xFA, 0x4D, 0xA8, 0x89, 0xEE, 0x5F, 0xFD, 0xB6, 0xC7, 0x0B, 0x6C, 0x10, 0xE0, 0xA6, 0x80,
+    0x58, 0xDF, 0x12, 0x7D, 0x8A, 0xD7, 0xFA, 0x63, 0xD8, 0x66, 0xF4, 0xA2, 0xD0, 0xE0, 0xD7, 0x9B,
+    0x9C, 0x47, 0x0C, 0x6C, 0x1C, 0x50, 0x8E, 0xE5, 0x1D, 0x42, 0xE0, 0x56, 0x54, 0x5F, 0xE9, 0x8C,
+    0xE7, 0x8E, 0x5F, 0x54, 0x2B, 0xBE, 0x2F, 0xC5, 0x75, 0x38, 0xE1, 0x3D, 0x3B, 0x26, 0xC4, 0xF4,
+    0xF0, 0x74, 0x05, 0x71, 0x57, 0x94, 0xC7, 0xC6, 0x82, 0xD7, 0x99, 0x0C, 0x4E, 0x7A, 0x31, 0x31,
+    0x0D, 0x79, 0x07, 0x45, 0x8C, 0x49, 0x06, 0xD8, 0xE0, 0x1A, 0xE0, 0x5A, 0xE5, 0x72, 0xA4, 0xF6,
+    0x5C, 0xE4, 0x55, 0xDB, 0x75, 0x93, 0x54, 0x76, 0x66, 0xD9, 0xC7, 0x4E, 0xF7, 0xE2, 0x1E, 0x54,
+    0x83, 0x00, 0x9D, 0x88, 0xAC, 0xF9, 0x2F, 0xBC, 0x12, 0xE4, 0x12, 0xB9, 0x6E, 0xD5, 0x76, 0x3B,
+    0x9C, 0xE2, 0xEE, 0x79, 0x27, 0x29, 0x24, 0x96, 0x18, 0x48, 0x52, 0xB4, 0x42, 0x75, 0x44, 0x5D,
+    0x70, 0x59, 0x90, 0x89, 0xB7, 0xA5, 0x4A, 0x22, 0x0D, 0x4D, 0xFE, 0xBA, 0x3D, 0x79, 0xDE, 0x07,
+    0xA8, 0xFE, 0xCA, 0x15, 0x89, 0x27, 0x90, 0x03, 0xDD, 0xE3, 0x70, 0x23, 0xC8, 0x07, 0xA7, 0xDF,
+    0x23, 0x1A, 0xD7, 0xF8, 0x12, 0xE5, 0xF0, 0xF0, 0xFA, 0x00, 0x6D, 0xED, 0x02, 0x42, 0x4D, 0x09,
+    0x1D, 0x61, 0xD0, 0xD5, 0x76, 0x64, 0x98, 0x5E, 0xB3, 0x57, 0x51, 0x71, 0xE8, 0xD3, 0xF0, 0x77,
+    0x6A, 0x73, 0x7F, 0x95, 0x89, 0x1F, 0x6E, 0x38, 0x79, 0x82, 0x12, 0xAB, 0x58, 0x34, 0x4E, 0x78,
+    0x58, 0xDB, 0x2C, 0x4E, 0xE1, 0x69, 0xC6, 0x09, 0x7B, 0x79, 0xB6, 0xE0, 0x84, 0x23, 0x4E, 0x58,
+    0xDC, 0x8C, 0x5A, 0xE2, 0x04, 0xD1, 0x67, 0x9D, 0xD1, 0x52, 0x44, 0xEF, 0x9E, 0xFE, 0x00, 0xB7,
+    0x65, 0x90, 0x62, 0x01, 0x51, 0x4D, 0xDE, 0x48, 0x42, 0x37, 0xEB, 0x68, 0xC2, 0x90, 0xD4, 0xDA,
+    0x65, 0x79, 0x88, 0xCD, 0x09, 0x9B, 0x23, 0x1C, 0xA8, 0x92, 0x8A, 0xB2, 0xD9, 0x70, 0x6D, 0xD1,
+    0xC9, 0x4F, 0xE8, 0x1A, 0x87, 0x49, 0x51, 0x00, 0x2A, 0x4F, 0x68, 0x27, 0xED, 0x69, 0xBF, 0xB2,
+    0x11, 0x37, 0x90, 0x7A, 0x95, 0x6F, 0x5A, 0xE6, 0x42, 0xD9, 0xD7, 0x7A, 0x04, 0x71, 0x47, 0x69,
+    0x73, 0x0D, 0x8D, 0x66, 0x25, 0x06, 0x1E, 0x84, 0x66, 0x2F, 0x50, 0x3B, 0x86, 0x00, 0x6D, 0x41,
+    0xF7, 0x7C, 0x54, 0x9C, 0x35, 0x0B, 0x0B, 0x4D, 0x77, 0x80, 0x13, 0x73, 0x82, 0x13, 0xF0, 0x26,
+    0x77, 0xB4, 0x00, 0xE9, 0xD3, 0x80, 0x13, 0x8E, 0xF2, 0x6C, 0x95, 0x8E, 0xDB, 0x5A, 0x9C, 0x6C,
+    0x42, 0xB3, 0xC8, 0x24, 0x41, 0x74, 0x08, 0x60, 0x87, 0xB4, 0x9B, 0x73, 0x43, 0x2C, 0x24, 0x83,
+    0x8E, 0x3E, 0x1C, 0xE6, 0x5B, 0x1C, 0x13, 0x42, 0x8F, 0x10, 0x5D, 0xA5, 0xB6, 0xC0, 0x28, 0x6C,
+    0x45, 0x80, 0xC9, 0x6B, 0x6C, 0x62, 0xAE, 0xAD, 0x5D, 0x11, 0x01, 0xAC, 0x08, 0x30, 0x79, 0x13,
+    0xD1, 0x75, 0xA9, 0xCF, 0x23, 0xEE, 0x31, 0x80, 0xF1, 0x17, 0x30, 0xCD, 0x27, 0x91, 0x76, 0x7D,
+    0xF7, 0x60, 0x40, 0xFD, 0x9D, 0x0A, 0xD7, 0xB3, 0xEE, 0xF8, 0xB5, 0x24, 0x32, 0xD0, 0xB3, 0xD4,
+    0x1C, 0x5E, 0x11, 0xF7, 0x11, 0x5F, 0x89, 0x66, 0xB3, 0xDE, 0x30, 0xCF, 0x90, 0x66, 0xA3, 0x3E,
+    0xA3, 0x0F, 0xBB, 0x8C, 0x36, 0xEB, 0x32, 0xCC, 0x86, 0x65, 0x81, 0xA9, 0xB0, 0x0C, 0xDB, 0xB4,
+    0xC0, 0x8B, 0xB2, 0x24, 0xFC, 0x89, 0x1A, 0x60, 0x38, 0x05, 0xB3, 0x62, 0x12, 0xE8, 0xF2, 0x39,
+    0xC6, 0x13, 0x73, 0x11, 0x1F, 0xAD, 0x32, 0x40, 0x24, 0xE3, 0x6D, 0x23, 0xEA, 0x45, 0x74, 0xEF,
+    0x7D, 0xFA, 0x77, 0x2C, 0xE1, 0x29, 0x47, 0x19, 0xE1, 0xE6, 0xD2, 0xFD, 0x02, 0x56, 0xDF, 0xA4,
+    0x96, 0x27, 0x3F, 0x64, 0xA6, 0xF1, 0x25, 0xDC, 0x71, 0x1E, 0xBA, 0x8C, 0xDA, 0xBF, 0x42, 0x65,
+    0x4F, 0x8A, 0x96, 0xA9, 0x1E, 0x14, 0xA2, 0x0F, 0x62, 0x7A, 0xFB, 0x36, 0x26, 0x97, 0xC2, 0xC4,
+    0xAA, 0xAD, 0xCF, 0x24, 0x2A, 0x02, 0xBA, 0x16, 0x12, 0xE3, 0xE5, 0x21, 0xFE, 0x45, 0x60, 0xCC,
+    0xD4, 0x65, 0xAB, 0x0B, 0x1A, 0x64, 0x90, 0x05, 0x4C, 0x3C, 0x69, 0x99, 0x67, 0x26, 0xA0, 0x79,
+    0xC1, 0x24, 0xBF, 0x8D, 0x89, 0x7C, 0x2E, 0xA1, 0x53, 0xE1, 0x38, 0xDE, 0xE0, 0x2E, 0xCC, 0xF0,
+    0xF1, 0x39, 0x9C, 0xF1, 0xF4, 0xEA, 0x94, 0xD1, 0x5C, 0x57, 0x88, 0xFB, 0xB2, 0x9C, 0xF2, 0x11,
+    0x4A, 0xE8, 0x66, 0xF3, 0x8C, 0x4F, 0x30, 0x1F, 0x39, 0xE1, 0x67, 0x6E, 0x31, 0x5D, 0x76, 0x56,
+    0xBC, 0xC0, 0x3F, 0x5A, 0xD8, 0xC6, 0xEF, 0x66, 0x22, 0xFD, 0xA8, 0xED, 0x7F, 0x54, 0xE6, 0xFF,
+    0xE7, 0xB3, 0xFB, 0xFE, 0x01, 0xC5, 0x55, 0x31, 0x8F, 0xD6, 0x46, 0x10, 0x1D, 0xDB, 0x3A, 0x2C,
+    0xE1, 0x62, 0x1B, 0xAE, 0xDE, 0x26, 0x4A, 0x41, 0xC1, 0xFE, 0x84, 0xB5, 0xC4, 0x0F, 0xE0, 0x0A,
+    0xBE, 0x9A, 0x86, 0x8A, 0x86, 0x3F, 0x10, 0x64, 0x1F, 0x4D, 0x4A, 0xF2, 0x13, 0x52, 0x50, 0x44,
+    0x77, 0xC5, 0xB5, 0x14, 0x27, 0xD9, 0x52, 0x8A, 0x14, 0x29, 0xB0, 0x0E, 0xA5, 0xB7, 0x12, 0x45,
+    0x91, 0x8E, 0x82, 0x05, 0x19, 0xC9, 0x22, 0xB6, 0x27, 0xEF, 0xAD, 0x37, 0x81, 0x20, 0x8A, 0x74,
+    0x59, 0xE9, 0x56, 0xF7, 0xD9, 0xBB, 0x6F, 0xDE, 0xBC, 0x37, 0x33, 0x16, 0x57, 0x0E, 0xD9, 0xE6,
+    0xFB, 0x72, 0x52, 0xA9, 0x4E, 0x83, 0xA4, 0x95, 0xEB, 0x28, 0x8D, 0x86, 0x52, 0x35, 0xF8, 0xA9,
+    0xB9, 0x52, 0xE9, 0x9E, 0xCD, 0xB9, 0x36, 0xD7, 0xE7, 0xAB, 0xAA, 0xBE, 0xC6, 0xDF, 0xC5, 0x87,
+    0xF3, 0xB5, 0x6B, 0xED, 0xBB, 0x4D, 0xF4, 0xDB, 0xCD, 0x2E, 0x46, 0x75, 0x34, 0xBA, 0x49, 0xA5,
+    0xDF, 0x89, 0xD4, 0x00, 0x28, 0x87, 0x17, 0x22, 0xEA, 0x06, 0x31, 0xBF, 0x2E, 0x22, 0x97, 0xA6,
+    0x96, 0x7F, 0xD6, 0x63, 0x6D, 0xC5, 0x29, 0x36, 0xC5, 0x05, 0x73, 0xAD, 0x41, 0xEA, 0x0C, 0xBF,
+    0xA4, 0xC2, 0x41, 0x69, 0x7A, 0x91, 0x62, 0x91, 0xA3, 0x43, 0xD3, 0x17, 0xAA, 0x8B, 0x78, 0xD5,
+    0xBE, 0xE4, 0x3F, 0xC7, 0x07, 0x9E, 0xB1, 0x13, 0x5E, 0x2B, 0xCF, 0x8D, 0x22, 0x6E, 0x29, 0x7F,
+    0x7F, 0xAC, 0x75, 0xA3, 0x3A, 0xE0, 0xC8, 0x04, 0xD0, 0x59, 0x24, 0x63, 0xA4, 0x27, 0x55, 0x6B,
+    0xDE, 0xAE, 0x88, 0xDF, 0x97, 0xFD, 0x9C, 0xC2, 0xDE, 0x40, 0x4A, 0x5D, 0x04, 0x93, 0xAF, 0x1C,
+    0x60, 0x00, 0x87, 0x88, 0x67, 0xDA, 0x3B, 0x5D, 0x10, 0xAA, 0x3D, 0x7E, 0x30, 0x49, 0x06, 0x68,
+    0x1F, 0x1E, 0xDA, 0x15, 0xA7, 0xDA, 0x46, 0xC7, 0x02, 0xA8, 0x31, 0x9D, 0xEC, 0xEC, 0x0C, 0x3B,
+    0xAE, 0xE3, 0x3D, 0x08, 0x83, 0xDF, 0xFD, 0x1D, 0x95, 0x37, 0xBA, 0xD6, 0xF7, 0xD2, 0x0C, 0x66,
+    0xC2, 0xDD, 0x7C, 0x13, 0x1B, 0x90, 0x85, 0x99, 0xC5, 0x04, 0xE0, 0xE7, 0x6B, 0xB1, 0x82, 0xED,
+    0x53, 0x1C, 0x33, 0x41, 0x6B, 0xE4, 0xD6, 0x21, 0x8D, 0xAE, 0x03, 0x90, 0x05, 0x21, 0x24, 0x43,
+    0xCD, 0x19, 0x06, 0xE9, 0x48, 0x12, 0xA1, 0xDA, 0x40, 0xF7, 0x42, 0x69, 0x83, 0xC6, 0xB0, 0xA0,
+    0xE0, 0x36, 0x86, 0x3B, 0xD9, 0xA3, 0x3E, 0x3A, 0x03, 0x08, 0x94, 0x41, 0x78, 0xAA, 0x72, 0x38,
+    0xA4, 0x1C, 0x9B, 0x16, 0xD1, 0x9A, 0x1E, 0x20, 0xBE, 0x27, 0x9D, 0xDE, 0x05, 0x6C, 0x7E, 0xC0,
+    0x86, 0x88, 0x6E, 0x00, 0x9A, 0xBD, 0x02, 0x90, 0xFD, 0x0D, 0x61, 0xCC, 0x1F, 0x90, 0xC6, 0xBC,
+    0x41, 0x7C, 0x43, 0x26, 0x15, 0x93, 0xAB, 0x08, 0x57, 0x32, 0x68, 0xB9, 0x72, 0x23, 0x1B, 0x43,
+    0x72, 0x1E, 0xC7, 0x6E, 0xEF, 0xE9, 0x83, 0x8C, 0xE7, 0x4B, 0x3F, 0xC6, 0x98, 0xB3, 0x23, 0x45,
+    0x8B, 0x1F, 0xFE, 0xA7, 0x29, 0x19, 0xFF, 0x71, 0xC1, 0x4F, 0x37, 0x9A, 0x00, 0xE3, 0xC0, 0xCC,
+    0x2C, 0xD0, 0x0A, 0x98, 0x36, 0x14, 0x1B, 0x94, 0xC8, 0xA9, 0x5D, 0x0D, 0x3C, 0x3B, 0x82, 0x5D,
+    0xB1, 0x80, 0x27, 0x2C, 0xA3, 0xB1, 0x24, 0x55, 0xD2, 0x4D, 0x51, 0x32, 0x88, 0xE1, 0x2A, 0x8D,
+    0x75, 0x19, 0xB7, 0x56, 0xB2, 0x73, 0x92, 0x89, 0x86, 0x38, 0x1D, 0x12, 0x71, 0xB9, 0xB5, 0x07,
+    0xFD, 0xC6, 0xE0, 0xC7, 0xE6, 0x20, 0x0F, 0x2A, 0x5B, 0xE4, 0x85, 0xAD, 0x3F, 0x65, 0xF4, 0x3F,
+    0x68, 0x74, 0x74, 0x72, 0xE0, 0xC1, 0x26, 0x66, 0x89, 0x6D, 0xF6, 0xAD, 0xE4, 0xB3, 0xC3, 0xA9,
+    0x93, 0xA3, 0x44, 0x0B, 0x55, 0x53, 0xCD, 0xA8, 0x7C, 0x60, 0x6A, 0x8D, 0x12, 0x77, 0x23, 0x4A,
+    0x0B, 0xD8, 0xEC, 0x13, 0x89, 0xC4, 0x40, 0xB1, 0x9C, 0x41, 0x56, 0x94, 0xD1, 0xFC, 0xCF, 0x60,
+    0x56, 0xFD, 0xB9, 0xB0, 0x04, 0x59, 0x1A, 0x9E, 0x84, 0x0C, 0x03, 0xE7, 0xA4, 0xC0, 0x2B, 0xD8,
+    0x10, 0xFE, 0x11, 0x2B, 0xCC, 0x71, 0xAB, 0x58, 0x66, 0xEC, 0x6C, 0x10, 0x4A, 0x51, 0xB3, 0xFB,
+    0xC7, 0xA8, 0xC9, 0x0D, 0xD0, 0xF9, 0x8A, 0x66, 0xCD, 0x56, 0x0B, 0x2D, 0x17, 0x83, 0xBB, 0xB7,
+    0xB2, 0x24, 0x5A, 0xB6, 0x31, 0xBB, 0x28, 0x98, 0x09, 0x90, 0x6E, 0xF7, 0x4D, 0xC1, 0x72, 0x57,
+    0xAC, 0x9A, 0x90, 0x51, 0xB6, 0xD2, 0xB7, 0xE6, 0x59, 0x48, 0x92, 0x15, 0x24, 0x26, 0x91, 0x98,
+    0x53, 0x49, 0x9A, 0x65, 0x91, 0x58, 0x33, 0xEC, 0xD9, 0x26, 0xD1, 0x50, 0x13, 0x92, 0x5F, 0xC4,
+    0xD3, 0xEB, 0xDF, 0x56, 0x9B, 0xBD, 0x67, 0xCB, 0xE1, 0x12, 0x4F, 0xC1, 0x88, 0xBD, 0xBC, 0x9B,
+    0x9A, 0x56, 0x39, 0xD3, 0x28, 0x18, 0x19, 0x0D, 0xA4, 0x4E, 0x00, 0xEC, 0x9E, 0x82, 0xE9, 0x8C,
+    0x54, 0xF4, 0xEE, 0x8A, 0x00, 0x7E, 0xC8, 0x15, 0x3A, 0xFA, 0x11, 0x23, 0x64, 0x45, 0x9F, 0x68,
+    0x5F, 0x71, 0x8E, 0xDC, 0xBC, 0x26, 0x8B, 0x18, 0x81, 0x62, 0xA1, 0x34, 0x63, 0x0F, 0x0B, 0x85,
+    0x2D, 0xA2, 0x90, 0xE0, 0xF7, 0xC4, 0xB4, 0xC5, 0xDC, 0xC5, 0xD9, 0x75, 0xA7, 0x1C, 0x52, 0x50,
+    0xE4, 0xAE, 0xF7, 0x42, 0x01, 0x17, 0x39, 0xF6, 0xBA, 0x97, 0x33, 0x75, 0x33, 0x93, 0xD6, 0xFA,
+    0xA3, 0x3E, 0x50, 0x82, 0x5B, 0x4C, 0x41, 0x3B, 0xC7, 0x2E, 0xDF, 0x53, 0x44, 0xAF, 0xB3, 0xFD,
+    0xA3, 0x5F, 0xE8, 0x54, 0x93, 0x26, 0x55, 0x4E, 0x22, 0x54, 0x84, 0xB1, 0xC8, 0x80, 0x35, 0x94,
+    0x6F, 0x89, 0xD2, 0x97, 0x1F, 0xF6, 0x3B, 0x62, 0xB9, 0x3D, 0x87, 0x85, 0x1B, 0xBB, 0x1F, 0xFA,
+    0x6B, 0x7A, 0xCA, 0xA9, 0x51, 0x7C, 0x7E, 0x34, 0x2E, 0x44, 0x43, 0x44, 0xCC, 0x38, 0x18, 0x76,
+    0xFD, 0x3C, 0x92, 0x09, 0xB1, 0x2B, 0x89, 0x1C, 0x79, 0xF5, 0x31, 0x7F, 0x22, 0xB8, 0x0F, 0x35,
+    0x2D, 0xE3, 0xD0, 0xB3, 0x44, 0xC6, 0xE3, 0x02, 0x3A, 0xB1, 0xB5, 0xBB, 0x3D, 0xA7, 0x9B, 0xDF,
+    0x47, 0xD0, 0xCB, 0xD8, 0x50, 0xF6, 0x15, 0x5D, 0xCB, 0x56, 0x4F, 0x5F, 0xCC, 0xC7, 0x6F, 0x47,
+    0x5A, 0x4C, 0xC3, 0x8E, 0xC5, 0xCE, 0x8C, 0x63, 0xDD, 0x0F, 0xD5, 0xBC, 0xAB, 0xD8, 0x92, 0x01,
+    0x83, 0x57, 0x4B, 0xD4, 0x5E, 0x5B, 0xFB, 0x9E, 0x6C, 0xA0, 0x4B, 0x8B, 0x07, 0x90, 0xAA, 0xC6,
+    0x88, 0x80, 0x48, 0xA8, 0xB4, 0xE6, 0x17, 0x1D, 0xFD, 0x58, 0x61, 0x44, 0xE3, 0x66, 0xD7, 0xBA,
+    0xC0, 0x9B, 0xB9, 0x82, 0x2F, 0xBD, 0xC5, 0x27, 0x28, 0x98, 0xC5, 0xE0, 0xDB, 0x74, 0xAE, 0xAD,
+    0xD6, 0xB8, 0x19, 0xE2, 0x4D, 0x3C, 0x00, 0xCC, 0xBC, 0xF7, 0x5F, 0x75, 0xCA, 0x42, 0x6B, 0xEE,
+    0x81, 0x61, 0xBE, 0x90, 0x6D, 0xF1, 0xEF, 0x19, 0x15, 0xD5, 0x6A, 0x7A, 0x98, 0x95, 0x6F, 0xBB,
+    0x5D, 0xD4, 0xC8, 0x0F, 0x24, 0xAD, 0xB9, 0x1E, 0xE0, 0x04, 0x9C, 0x6B, 0x1D, 0x2B, 0xA9, 0x87,
+    0xDD, 0xAF, 0xF5, 0xEE, 0x52, 0x2E, 0xC5, 0x6A, 0x83, 0x0B, 0x66, 0xEA, 0x70, 0xD1, 0x5F, 0x6D,
+    0x19, 0x4E, 0x9A, 0xA9, 0xD0, 0x0E, 0xED, 0x80, 0x5A, 0x38, 0x45, 0x51, 0xEA, 0xC4, 0x84, 0xF7,
+    0x91, 0xFD, 0x89, 0xFD, 0xE1, 0xCB, 0xF6, 0xF3, 0x0B, 0x01, 0x7C, 0x90, 0x47, 0xE7, 0xF3, 0x6B,
+    0xB6, 0xFD, 0x90, 0xEC, 0x4F, 0x27, 0xED, 0xFB, 0x13, 0xF4, 0xD1, 0xB2, 0x7F, 0x14, 0x38, 0xF7,
+    0xBD, 0x7E, 0x76, 0xFF, 0x6B, 0xD8, 0x6F, 0xE0, 0x5C, 0xC1, 0x17, 0xDA, 0xCA, 0x7F, 0x58, 0x7F,
+    0x01, 0xAD, 0x55, 0xBD, 0x6F, 0x1D, 0x45, 0x10, 0x9F, 0xBB, 0xE5, 0xE5, 0x84, 0x9F, 0xD0, 0x52,
+    0xC4, 0x05, 0xA4, 0xB8, 0xDE, 0x45, 0xF6, 0x3F, 0x60, 0x4F, 0xB8, 0x40, 0x02, 0x09, 0xBB, 0xB0,
+    0x2B, 0x0A, 0xB7, 0x51, 0x0A, 0xCC, 0x7F, 0xB0, 0x07, 0x2E, 0x28, 0x49, 0x93, 0x1A, 0x23, 0xA5,
+    0x70, 0x5E, 0x11, 0x1A, 0x8A, 0x28, 0x8A, 0xB9, 0x8B, 0x2D, 0x91, 0x82, 0xC2, 0x47, 0xDC, 0x91,
+    0xC2, 0x2B, 0xA5, 0x40, 0x82, 0xE6, 0x12, 0x9F, 0xE1, 0x82, 0x77, 0x6F, 0xF8, 0xCD, 0xFB, 0x70,
+    0x04, 0x12, 0xC4, 0x05, 0x3B, 0x6F, 0xEE, 0xED, 0xEE, 0xEC, 0xCE, 0xD7, 0xFE, 0x76, 0x96, 0x2C,
+    0x47, 0x72, 0x1C, 0xA8, 0x02, 0xF3, 0xAF, 0x77, 0x88, 0x89, 0x84, 0xAF, 0xF0, 0x06, 0x19, 0x88,
+    0x2C, 0xA6, 0x85, 0xB3, 0x40, 0x34, 0x16, 0x1E, 0xF6, 0x48, 0x73, 0x0F, 0xEE, 0x28, 0xE7, 0x96,
+    0x28, 0x07, 0x1B, 0x4F, 0x64, 0x3D, 0xBD, 0xC3, 0x35, 0xE6, 0x84, 0x31, 0xDD, 0xD3, 0xAC, 0x41,
+    0x66, 0x7D, 0xC2, 0xA4, 0x03, 0xE9, 0x2E, 0x85, 0xA4, 0x2A, 0x5D, 0x03, 0x75, 0x1A, 0x0B, 0xEC,
+    0x13, 0x8C, 0xD3, 0xC1, 0xD5, 0x58, 0x0F, 0x7D, 0x30, 0x3C, 0xE0, 0x33, 0x86, 0x0A, 0x2C, 0x93,
+    0xB1, 0xE1, 0x92, 0x28, 0x83, 0x79, 0x88, 0xAA, 0x06, 0x1B, 0x4E, 0x07, 0x71, 0x03, 0x36, 0x13,
+    0x2E, 0xF8, 0x36, 0x34, 0xC3, 0x17, 0x68, 0x76, 0xFC, 0x3E, 0x17, 0x8A, 0x5B, 0x07, 0x63, 0x3C,
+    0xB7, 0x4A, 0xA4, 0xA2, 0x74, 0x2D, 0xB4, 0x25, 0xDB, 0x61, 0xAA, 0xAD, 0x80, 0x39, 0x16, 0x91,
+    0xE9, 0xE6, 0xEE, 0x51, 0x55, 0xE7, 0x1D, 0x41, 0x59, 0xA9, 0x06, 0x2D, 0x61, 0x56, 0x35, 0xE9,
+    0xF3, 0x28, 0x8B, 0xC5, 0x9E, 0xF8, 0x23, 0x1B, 0x94, 0x6C, 0x15, 0xD5, 0x8A, 0x45, 0x76, 0x1E,
+    0xA0, 0x67, 0xED, 0xCF, 0xDD, 0xBC, 0xB3, 0x5C, 0x73, 0xE9, 0x18, 0x5B, 0x59, 0x22, 0xB6, 0x8D,
+    0x6C, 0xC0, 0x5A, 0xC9, 0xD7, 0x9B, 0x95, 0xE4, 0x45, 0x46, 0x22, 0x4B, 0xA5, 0x73, 0x91, 0x11,
+    0x72, 0xB5, 0x62, 0x59, 0x0A, 0x4F, 0xD2, 0x81, 0x10, 0xE7, 0x2C, 0x25, 0xBA, 0x83, 0x03, 0x64,
+    0x7E, 0x11, 0x7F, 0x9D, 0xB8, 0xB0, 0xC9, 0x38, 0x89, 0x94, 0x19, 0xB9, 0xD6, 0xF8, 0xD6, 0x50,
+    0x28, 0x59, 0xFA, 0x84, 0xE3, 0x3A, 0x94, 0x9F, 0x74, 0xE2, 0x92, 0x91, 0x33, 0x68, 0x91, 0x46,
+    0xC9, 0x4A, 0x49, 0xBA, 0x97, 0x3C, 0x73, 0x0D, 0x1F, 0xC6, 0x11, 0x23, 0x92, 0xB4, 0xB4, 0xFF,
+    0x12, 0x6A, 0x98, 0x85, 0xBA, 0xC4, 0x7C, 0x07, 0x06, 0xB9, 0x11, 0x53, 0x74, 0xA5, 0xE2, 0xBD,
+    0x57, 0xA1, 0x26, 0xBC, 0xD6, 0x12, 0x42, 0xF5, 0x70, 0xD3, 0xD5, 0x12, 0x2A, 0x4E, 0x25, 0x29,
+    0xC9, 0xDF, 0xBC, 0xFF, 0xE0, 0xFE, 0xAE, 0xFF, 0xA6, 0xDC, 0xA5, 0xD7, 0x13, 0x12, 0x50, 0x8C,
+    0xE9, 0xFA, 0xDD, 0xEB, 0xF7, 0xC6, 0x4B, 0xE9, 0x87, 0xB4, 0xF4, 0x7A, 0x5A, 0x99, 0xAC, 0xF1,
+    0x33, 0x3E, 0xE3, 0x70, 0xD1, 0x81, 0x7F, 0xBF, 0xC3, 0xBD, 0x23, 0xF0, 0xF2, 0xE6, 0xE6, 0xC6,
+    0xBB, 0x93, 0xC9, 0x0E, 0x73, 0x40, 0x42, 0x1E, 0x33, 0xF7, 0x18, 0xA1, 0xED, 0x61, 0xC4, 0xB3,
+    0x49, 0xF9, 0x73, 0xD3, 0xBF, 0xFF, 0x94, 0x49, 0xA2, 0x69, 0xFF, 0x7F, 0xFF, 0xAD, 0xD0, 0x8D,
+    0xD1, 0xE6, 0xE6, 0x3A, 0x0E, 0x6B, 0x69, 0x32, 0xB9, 0x05, 0x23, 0xF0, 0x78, 0x95, 0x25, 0x98,
+    0x49, 0x41, 0xFB, 0x49, 0x50, 0xFD, 0xB8, 0xD3, 0xAD, 0xF1, 0xB6, 0x5E, 0x2E, 0xD2, 0xA8, 0xC2,
+    0xB8, 0xD7, 0x6D, 0xDE, 0x98, 0xDA, 0x16, 0xCB, 0x94, 0x6C, 0xA8, 0x08, 0x38, 0x74, 0xDA, 0x63,
+    0x5C, 0xBE, 0x47, 0x95, 0xF9, 0xF1, 0x79, 0x70, 0xFA, 0xB0, 0xBD, 0x4A, 0xFB, 0x99, 0xCF, 0xEB,
+    0xA8, 0x7A, 0x53, 0x57, 0x0A, 0x3B, 0x38, 0x8D, 0x79, 0x6B, 0x0F, 0x63, 0xB2, 0x21, 0x5A, 0x72,
+    0x8F, 0xEE, 0xB8, 0xB3, 0x35, 0x8F, 0xBB, 0xBC, 0xE1, 0x34, 0xE4, 0xB5, 0x55, 0x7D, 0xB2, 0x2E,
+    0x1A, 0x47, 0xEB, 0xF6, 0x60, 0xC8, 0x7A, 0xC8, 0xB2, 0x5E, 0x7B, 0xC8, 0xB4, 0xB7, 0x5F, 0x04,
+    0xE5, 0x4D, 0xC1, 0xE3, 0xD3, 0x60, 0x9E, 0xB6, 0x6E, 0xEB, 0x51, 0x74, 0xAA, 0x0B, 0xFA, 0xB8,
+    0x33, 0x9F, 0x17, 0x57, 0x05, 0xA9, 0x0A, 0xE0, 0x00, 0xD6, 0x6C, 0x41, 0xBA, 0x26, 0xE5, 0x93,
+    0xDB, 0x2F, 0x6F, 0x54, 0x3C, 0x20, 0x7D, 0x1F, 0x7F, 0xFB, 0x73, 0xAD, 0x3C, 0x25, 0x40, 0xDF,
+    0x43, 0xC8, 0x49, 0xE4, 0x59, 0x4B, 0x0A, 0xC9, 0x04, 0x66, 0x5C, 0x41, 0x06, 0xD0, 0x6A, 0x65,
+    0x7F, 0x32, 0x5C, 0x5C, 0x34, 0xC0, 0xBF, 0xA2, 0xA9, 0x42, 0x0A, 0x53, 0x06, 0xD4, 0x82, 0xB0,
+    0x92, 0x53, 0x50, 0x00, 0xA8, 0xF0, 0x18, 0xAC, 0x85, 0x1B, 0x1A, 0xE9, 0x47, 0x45, 0x0E, 0xC8,
+    0x1B, 0xB0, 0xE5, 0xAA, 0x24, 0x43, 0x53, 0x63, 0x38, 0x2F, 0x5A, 0xD4, 0x29, 0x19, 0x35, 0x39,
+    0xAF, 0xCA, 0xA9, 0x1E, 0xCA, 0xE7, 0x80, 0x83, 0x66, 0x32, 0x40, 0x28, 0x40, 0xA7, 0x4B, 0x98,
+    0xD3, 0x21, 0xE1, 0xD6, 0x40, 0xDA, 0xD9, 0x2E, 0xEB, 0xE8, 0x3B, 0x7A, 0x03, 0xE5, 0x6D, 0x35,
+    0xBA, 0xDF, 0xA2, 0xAB, 0xD7, 0x47, 0x34, 0x5A, 0x0D, 0xE9, 0x50, 0x35, 0xF6, 0x3C, 0x64, 0x83,
+    0x2B, 0x6D, 0x5D, 0x90, 0x4C, 0xD2, 0x48, 0x05, 0xA1, 0xAA, 0x01, 0x3D, 0x0D, 0xE3, 0xA0, 0x83,
+    0x2B, 0x85, 0x0A, 0x02, 0x41, 0x58, 0x9D, 0x60, 0xA2, 0xB8, 0xB9, 0xF7, 0x60, 0xEF, 0x32, 0xE8,
+    0x17, 0x5A, 0xB9, 0xBB, 0x72, 0xEF, 0x32, 0xB8, 0x9F, 0x12, 0xB9, 0xF8, 0x8A, 0xD2, 0xF2, 0xF5,
+    0x24, 0x3B, 0x3E, 0xA3, 0x19, 0x5D, 0x7E, 0x07, 0xBD, 0x35, 0xA3, 0xCB, 0xEE, 0x98, 0x37, 0xBC,
+    0x04, 0x89, 0x5C, 0x1C, 0x94, 0xDC, 0xE9, 0x81, 0x10, 0x73, 0xA1, 0xA5, 0xF4, 0xE5, 0xC7, 0x7D,
+    0x2A, 0x82, 0x34, 0xD8, 0xD2, 0x4D, 0xAB, 0xEF, 0x4E, 0xAF, 0xA5, 0x9C, 0xAB, 0xCE, 0xEE, 0x4C,
+    0x6B, 0xAE, 0xCB, 0xBA, 0xEF, 0xE5, 0x3F, 0x6B, 0xAB, 0xFC, 0x87, 0x9E, 0xAE, 0xDD, 0x72, 0x5B,
+    0xCF, 0x5E, 0x70, 0xAB, 0x79, 0x87, 0x43, 0x74, 0xF2, 0x35, 0xBC, 0xFD, 0xD5, 0x69, 0x70, 0x5F,
+    0x37, 0xEE, 0xCB, 0xE7, 0xD1, 0x1C, 0xB5, 0x40, 0x54, 0x34, 0x07, 0x21, 0xC2, 0x00, 0xB4, 0xD9,
+    0x93, 0x3A, 0x02, 0x24, 0x76, 0xF5, 0x25, 0xD0, 0x8D, 0x6B, 0xD4, 0xB9, 0xED, 0x03, 0x3C, 0x51,
+    0x85, 0xFD, 0xE8, 0x05, 0x6C, 0x6A, 0x8F, 0xAA, 0x85, 0x77, 0x29, 0x0D, 0xF2, 0x76, 0xC8, 0xD3,
+    0x06, 0xD0, 0x79, 0xB5, 0x28, 0xBD, 0x09, 0xFD, 0xAD, 0xA1, 0x6E, 0x66, 0x7E, 0xD6, 0x45, 0x6D,
+    0x17, 0xF4, 0xCD, 0xBA, 0x8D, 0x9A, 0x3F, 0x0F, 0x8B, 0x70, 0x24, 0xE4, 0x76, 0x48, 0xC2, 0xAC,
+    0xAB, 0x7A, 0x5B, 0xCE, 0xBB, 0x14, 0xB5, 0x8F, 0xF3, 0xEE, 0x22, 0x32, 0xD9, 0x77, 0x10, 0xDC,
+    0x35, 0x4F, 0x9F, 0x16, 0x69, 0x9F, 0x9D, 0x0D, 0xD6, 0x30, 0x5E, 0x80, 0x0C, 0x2F, 0x05, 0xDB,
+    0x2D, 0xF6, 0xCC, 0x19, 0xF7, 0x8B, 0x20, 0x8F, 0x63, 0x95, 0x0C, 0xF9, 0xE3, 0xAE, 0xB2, 0x87,
+    0x67, 0x31, 0xC7, 0xAD, 0x79, 0x12, 0xCC, 0x51, 0x13, 0x2B, 0x5C, 0x03, 0xED, 0x07, 0xFD, 0x47,
+    0x6B, 0x1D, 0xC2, 0x9B, 0xC7, 0x7B, 0xE4, 0x07, 0xE4, 0x4D, 0xFF, 0x04, 0xF1, 0x69, 0x6F, 0x0B,
+    0xD5, 0xA9, 0xAE, 0x32, 0x87, 0xFD, 0x60, 0x6A, 0xDC, 0x3C, 0xE6, 0x0F, 0x04, 0xFF, 0x7E, 0x11,
+    0x7A, 0xC6, 0x6D, 0x22, 0x77, 0xAC, 0xD4, 0x91, 0xAA, 0x79, 0x94, 0xF4, 0x36, 0xFD, 0xA3, 0xFD,
+    0x05, 0x8D, 0x55, 0x3D, 0x8F, 0xDE, 0x44, 0x10, 0x7E, 0xEC, 0xCD, 0xC5, 0x4A, 0x5C, 0x6C, 0x8A,
+    0x44, 0xA0, 0x04, 0x61, 0x4A, 0x88, 0x88, 0x4C, 0x41, 0x91, 0x82, 0xBB, 0x75, 0xE0, 0x07, 0x70,
+    0x05, 0xF9, 0x1D, 0xA1, 0xBC, 0x02, 0x61, 0xA7, 0xA6, 0x49, 0x81, 0x68, 0x49, 0x91, 0x22, 0xD0,
+    0xA4, 0x84, 0x82, 0xC4, 0x4E, 0x5A, 0x1A, 0x4B, 0xF9, 0x01, 0x58, 0x02, 0x1A, 0x28, 0x58, 0x84,
+    0x25, 0x16, 0xD8, 0xF5, 0xF0, 0x8C, 0x7D, 0xEF, 0x5D, 0x4E, 0x8A, 0x10, 0x7E, 0x6F, 0xCE, 0xDA,
+    0x9D, 0x99, 0x67, 0xBE, 0xC7, 0x70, 0x5D, 0xE9, 0x91, 0xE0, 0x86, 0x42, 0x5F, 0x55, 0x97, 0xDF,
+    0x07, 0xDC, 0xDD, 0x84, 0xDE, 0x44, 0xA4, 0xC2, 0x9B, 0x68, 0xC7, 0xC2, 0xD7, 0x83, 0x1D, 0x1D,
+    0x99, 0x09, 0xD7, 0xF1, 0x70, 0xE5, 0x97, 0x3E, 0x8F, 0xD6, 0xBB, 0xCE, 0x8E, 0x2D, 0x05, 0xC5,
+    0xCC, 0xD5, 0xA0, 0x62, 0x0B, 0x5C, 0x13, 0x0B, 0x9F, 0x05, 0x95, 0xBF, 0xD8, 0x5D, 0xCF, 0x1E,
+    0xA0, 0x6D, 0x5C, 0x57, 0x0D, 0x76, 0x22, 0xD6, 0x8C, 0x80, 0x87, 0xED, 0xFB, 0xD1, 0x84, 0x6A,
+    0xAC, 0x06, 0xC1, 0x62, 0x3C, 0x95, 0x3A, 0xAA, 0x20, 0x94, 0x23, 0xC5, 0xC9, 0xB3, 0x93, 0x9D,
+    0xF8, 0xCA, 0x56, 0x74, 0xD7, 0x11, 0x4C, 0x45, 0x12, 0x92, 0xF1, 0x44, 0xE9, 0x1E, 0x1B, 0x9F,
+    0xDF, 0xBF, 0xD8, 0xBD, 0x85, 0x0C, 0x78, 0x0F, 0xD9, 0x0C, 0x3B, 0xE1, 0x9B, 0xA1, 0xF8, 0x1E,
+    0xFB, 0x37, 0xF2, 0xE9, 0xC8, 0x62, 0x9A, 0xCD, 0x80, 0x4B, 0xA8, 0x1A, 0x3B, 0xDB, 0x60, 0xA3,
+    0x8D, 0x65, 0x34, 0x0B, 0xDA, 0xC1, 0xCE, 0xB9, 0x30, 0xC8, 0x72, 0x42, 0x03, 0x1C, 0x66, 0x11,
+    0x7D, 0x57, 0x79, 0xC3, 0x30, 0xC9, 0x29, 0x63, 0x91, 0x8A, 0x64, 0x96, 0x7C, 0x41, 0xAD, 0xB8,
+    0x40, 0xD6, 0x28, 0x31, 0x31, 0x5D, 0x31, 0xDA, 0x90, 0x7B, 0x82, 0xCD, 0x65, 0x30, 0xC9, 0x4C,
+    0xF5, 0x04, 0x69, 0xA8, 0x0C, 0x37, 0x52, 0x1C, 0x7A, 0x0D, 0x98, 0xC4, 0xEB, 0x3D, 0x88, 0x74,
+    0x1F, 0xD5, 0x83, 0x5B, 0xB2, 0xE4, 0x46, 0x4B, 0xB3, 0x6E, 0xAC, 0x53, 0xBE, 0x94, 0x4D, 0x2F,
+    0xCD, 0xB7, 0xC8, 0x79, 0x04, 0xCA, 0x60, 0x67, 0xA0, 0x9E, 0x68, 0x59, 0x41, 0xA4, 0xC9, 0x97,
+    0xAC, 0x71, 0x63, 0x19, 0x4A, 0xB5, 0x30, 0xD9, 0x60, 0xE6, 0xBC, 0xA3, 0x08, 0x45, 0x73, 0x12,
+    0xDD, 0xA3, 0x83, 0x8C, 0x02, 0xD2, 0x49, 0xA7, 0x5E, 0x64, 0x92, 0x09, 0x6A, 0x5F, 0xFB, 0x5C,
+    0xDD, 0x75, 0xA3, 0x1B, 0x4D, 0x64, 0x01, 0xDC, 0xC0, 0x02, 0x86, 0x22, 0xA0, 0x6F, 0xFA, 0xC6,
+    0x7A, 0x7A, 0x2E, 0xFC, 0x9D, 0x3C, 0x7B, 0xFC, 0xAD, 0x72, 0xFD, 0xD8, 0x8F, 0x65, 0x2A, 0x13,
+    0xDA, 0xAE, 0xED, 0x98, 0x8A, 0x66, 0x65, 0xF7, 0xC1, 0x88, 0x8C, 0x22, 0xB1, 0x4E, 0xB2, 0x27,
+    0xF5, 0xE8, 0x3E, 0x9B, 0xED, 0xF3, 0x68, 0xFE, 0x5C, 0x32, 0x59, 0xD0, 0x33, 0x2B, 0x09, 0x74,
+    0x81, 0xEA, 0x58, 0x76, 0x88, 0xCC, 0x10, 0xCF, 0xB9, 0xE6, 0x62, 0x44, 0x35, 0xE1, 0x18, 0x09,
+    0xBD, 0xC8, 0x33, 0x11, 0xB1, 0x22, 0x41, 0x8F, 0x1F, 0x03, 0xAF, 0xBD, 0x0B, 0xDC, 0x64, 0xA9,
+    0xBC, 0x6D, 0xAE, 0x0D, 0x05, 0x01, 0xD1, 0xFF, 0xB4, 0xC9, 0xD6, 0x0B, 0x32, 0x91, 0xA1, 0x18,
+    0x33, 0xFF, 0x3A, 0x70, 0x74, 0x13, 0x78, 0xFB, 0x1D, 0xE0, 0xD5, 0x63, 0x0B, 0x0F, 0x80, 0x62,
+    0x00, 0xF6, 0x99, 0x09, 0xCF, 0x44, 0xF3, 0x26, 0x9C, 0xDE, 0xD0, 0x60, 0xB5, 0xDD, 0xB0, 0xA2,
+    0x2C, 0x2F, 0xCC, 0x0F, 0xC4, 0xBB, 0x01, 0xF8, 0x23, 0xD8, 0xBB, 0x1E, 0x9F, 0x98, 0xC1, 0x8C,
+    0x16, 0x67, 0x1E, 0x3B, 0x6E, 0x6F, 0xB6, 0xE1, 0xF6, 0xC4, 0xF5, 0x7F, 0x3E, 0x7D, 0xBA, 0x1D,
+    0xE5, 0xD1, 0x16, 0x43, 0x2B, 0xBF, 0xAE, 0xBE, 0x67, 0xBD, 0xA4, 0xF5, 0xA2, 0x10, 0x69, 0xB6,
+    0xF7, 0xD3, 0xED, 0xFD, 0x8F, 0xDF, 0xEE, 0xE3, 0x93, 0x4D, 0xF3, 0xBB, 0x6A, 0xD0, 0xD7, 0x93,
+    0x3D, 0x13, 0xD8, 0x8E, 0x70, 0x1D, 0xEE, 0xD1, 0xC8, 0xA5, 0xD5, 0x60, 0x44, 0xF5, 0x81, 0xA7,
+    0x11, 0x87, 0x32, 0x11, 0x56, 0xBE, 0x6C, 0x98, 0xEB, 0x47, 0x83, 0x93, 0x5F, 0x42, 0x29, 0xE2,
+    0x69, 0x84, 0x65, 0x14, 0x66, 0x97, 0x46, 0x5C, 0xBC, 0xB2, 0x1A, 0x71, 0xBF, 0x75, 0x34, 0x32,
+    0xC3, 0x3D, 0xF7, 0x34, 0xD2, 0xA2, 0x98, 0x98, 0xB5, 0xC7, 0x84, 0x7B, 0xA3, 0x1E, 0x70, 0xDE,
+    0x10, 0xE6, 0xBC, 0x3A, 0x72, 0x0F, 0x57, 0x6E, 0x7F, 0x28, 0xCF, 0x65, 0x96, 0x78, 0x5C, 0x94,
+    0xB8, 0x0B, 0x4F, 0xDD, 0x40, 0xAD, 0x5E, 0xB5, 0xCA, 0xD0, 0x38, 0x54, 0x0D, 0xA5, 0x7A, 0xBE,
+    0x7A, 0xEB, 0x14, 0x41, 0xCB, 0x99, 0xAB, 0x52, 0xE1, 0x77, 0x09, 0xA2, 0xF3, 0xAC, 0xD0, 0x19,
+    0x30, 0x4D, 0xF1, 0xB1, 0xD2, 0x96, 0x48, 0x69, 0x0A, 0x19, 0x73, 0xD1, 0x26, 0x53, 0x79, 0xEA,
+    0x51, 0x5F, 0x71, 0xB6, 0x73, 0x35, 0xA2, 0xFC, 0xBB, 0x5B, 0xF9, 0x01, 0xEE, 0xF3, 0xF5, 0xEC,
+    0x77, 0xED, 0x43, 0xBB, 0x84, 0xD2, 0x73, 0x3A, 0x54, 0x7E, 0x9B, 0x70, 0xF5, 0x6B, 0x75, 0x56,
+    0x88, 0x3B, 0x18, 0x99, 0x50, 0xCC, 0xC8, 0xD2, 0xEA, 0x83, 0x1B, 0x34, 0x10, 0x3D, 0x47, 0x3D,
+    0x5F, 0xEC, 0x95, 0x9F, 0xC9, 0x8C, 0x57, 0x4E, 0x6C, 0xA9, 0xED, 0xF9, 0xD4, 0x76, 0x76, 0x67,
+    0xF5, 0xAB, 0x8F, 0xB8, 0xFE, 0xD5, 0x49, 0xE1, 0xD9, 0x67, 0xD7, 0xA4, 0x73, 0x92, 0x2A, 0x11,
+    0xA6, 0xF9, 0x77, 0xF6, 0x66, 0xFD, 0x85, 0xD8, 0x9F, 0xE5, 0x29, 0x47, 0xEA, 0x50, 0xFD, 0x62,
+    0x7D, 0x69, 0xAB, 0xF2, 0x28, 0x23, 0xCA, 0x45, 0xDB, 0xDA, 0x08, 0xA7, 0x73, 0xD2, 0xBF, 0x96,
+    0x75, 0x98, 0xB5, 0xFF, 0xC9, 0xD3, 0x91, 0x97, 0x17, 0xFC, 0x3A, 0xFB, 0x1C, 0x02, 0x97, 0xB1,
+    0x03, 0x4A, 0xAC, 0xA8, 0xCE, 0x2F, 0x1C, 0x6B, 0x18, 0x90, 0x33, 0xA2, 0x73, 0x3A, 0x88, 0xBB,
+    0xA7, 0x67, 0x6A, 0x7E, 0xE4, 0xD4, 0x55, 0x81, 0x73, 0x57, 0x44, 0x3A, 0x94, 0xCB, 0x79, 0x0E,
+    0x34, 0xED, 0xDA, 0x99, 0xAB, 0xA2, 0xE0, 0x02, 0xA4, 0x2F, 0x45, 0x84, 0xD5, 0x49, 0xB7, 0x1C,
+    0xC4, 0xC6, 0xEA, 0x9E, 0xA6, 0x1B, 0x96, 0x6B, 0x59, 0xEB, 0xB9, 0xAC, 0x89, 0xC2, 0x0B, 0x33,
+    0x99, 0x35, 0xE4, 0x14, 0x71, 0x0D, 0x40, 0x8D, 0xCB, 0xC0, 0xD9, 0x24, 0x5A, 0xB3, 0xAE, 0xB4,
+    0xAD, 0xDF, 0x45, 0x73, 0x6E, 0x63, 0xAD, 0x8D, 0x37, 0xD1, 0x38, 0xE4, 0x56, 0xBA, 0x13, 0xA8,
+    0xC4, 0xBD, 0x54, 0x7B, 0xDD, 0x4B, 0xDC, 0x4C, 0xDC, 0x75, 0x84, 0x6E, 0xBD, 0x3A, 0xA1, 0x8B,
+    0x13, 0xBD, 0xCF, 0x16, 0x8D, 0xAA, 0x9C, 0xF5, 0xE4, 0x06, 0x0D, 0x88, 0x25, 0xF3, 0x67, 0x32,
+    0x70, 0x19, 0xD9, 0xA1, 0x16, 0x9A, 0x16, 0x6B, 0xAE, 0xAA, 0x8E, 0xCB, 0xA1, 0x48, 0xA0, 0xA2,
+    0xCA, 0x35, 0x6B, 0xF4, 0x8E, 0x16, 0xB9, 0x20, 0xFE, 0x20, 0x0D, 0x6B, 0x56, 0xB4, 0x55, 0x59,
+    0x6B, 0xE6, 0x48, 0x81, 0xD7, 0x1B, 0xBF, 0x56, 0x64, 0x77, 0xB3, 0x9C, 0xDC, 0x60, 0xD3, 0x67,
+    0x29, 0x65, 0x76, 0xBD, 0xC4, 0xFD, 0x4A, 0x12, 0x69, 0x21, 0xC9, 0x4B, 0x48, 0xEF, 0x55, 0x26,
+    0x90, 0xC6, 0xFD, 0xEA, 0x32, 0xF6, 0xB9, 0x33, 0xFE, 0x0F, 0xBD, 0x79, 0x75, 0xDD, 0x64, 0x0B,
+    0x07, 0x7F, 0x21, 0xD4, 0xE2, 0x24, 0x1C, 0x28, 0xB5, 0x2F, 0xA1, 0x1D, 0x4F, 0xE5, 0x54, 0x1E,
+    0x77, 0x24, 0x09, 0x17, 0x87, 0xC6, 0x47, 0xF2, 0x81, 0x4C, 0x52, 0xFC, 0x0F, 0x0A, 0x2A, 0x47,
+    0x1A, 0x7B, 0xF9, 0xEB, 0x74, 0x55, 0xB5, 0x38, 0xC7, 0xB6, 0x3F, 0x28, 0x47, 0x2E, 0x26, 0x6E,
+    0x85, 0xA5, 0xBF, 0xA5, 0xFB, 0xA8, 0x15, 0x5F, 0xCA, 0xDD, 0xA6, 0x6F, 0xF9, 0x29, 0x61, 0x15,
+    0x9F, 0x45, 0x5C, 0xD0, 0x19, 0xBD, 0xB0, 0x2E, 0xB6, 0x50, 0xF2, 0x53, 0xC1, 0xEF, 0xD5, 0xBD,
+    0xB3, 0x7D, 0x79, 0x7B, 0xFD, 0x18, 0xB0, 0x1F, 0xF8, 0x6B, 0x71, 0x70, 0x86, 0xF7, 0x2F, 0xB5,
+    0x55, 0x31, 0x6C, 0x1D, 0x45, 0x10, 0x9D, 0xBD, 0xC3, 0xFF, 0x84, 0x57, 0x68, 0x53, 0x04, 0x09,
+    0x12, 0xE4, 0xA5, 0x05, 0x19, 0x5F, 0x0A, 0x0A, 0x17, 0x21, 0x7B, 0xF0, 0x25, 0x28, 0x90, 0x90,
+    0x9B, 0x88, 0x82, 0x82, 0x26, 0x05, 0xA4, 0x49, 0x4A, 0x0A, 0x2B, 0x7B, 0x89, 0x0B, 0x0A, 0x0A,
+    0xBE, 0x68, 0x68, 0x53, 0xB8, 0x08, 0xA6, 0x48, 0x1B, 0x24, 0xCB, 0x77, 0xE4, 0x17, 0x29, 0x52,
+    0x70, 0x51, 0x84, 0xDC, 0x9E, 0x62, 0x24, 0x04, 0x29, 0xBC, 0x72, 0x16, 0xE5, 0x80, 0xBD, 0x1B,
+    0x66, 0xEE, 0xFC, 0xE3, 0x44, 0x8E, 0x91, 0x29, 0xB8, 0xD5, 0xEE, 0xDF, 0xBF, 0x3B, 0x6F, 0xE6,
+    0xCD, 0xEC, 0xEC, 0x2C, 0x40, 0xFF, 0xA5, 0x1D, 0x80, 0x40, 0x2C, 0x21, 0xA9, 0x84, 0x83, 0x05,
+    0x80, 0x2F, 0x60, 0x19, 0x60, 0x11, 0xCE, 0x00, 0xBC, 0x02, 0xFF, 0xDB, 0x77, 0x19, 0xE0, 0x35,
+    0x78, 0x1B, 0xC8, 0xD4, 0x59, 0x20, 0xB3, 0x2A, 0x3B, 0x4D, 0x04, 0x90, 0xA8, 0x40, 0xF1, 0xCB,
+    0x13, 0xA1, 0x96, 0xBA, 0xAA, 0x88, 0x5E, 0x00, 0xB8, 0xA5, 0x73, 0x50, 0x7F, 0x79, 0xA6, 0x7A,
+    0xB3, 0x12, 0x05, 0xB6, 0x3C, 0xAB, 0xC0, 0x36, 0x27, 0x21, 0xDD, 0x25, 0x6C, 0xD8, 0x22, 0x57,
+    0x12, 0x07, 0xB0, 0x62, 0x32, 0x80, 0x28, 0x1B, 0x34, 0xC4, 0x9E, 0x06, 0x4B, 0x9D, 0x76, 0xE2,
+    0xFA, 0x0A, 0x80, 0x79, 0xD8, 0xDB, 0x29, 0xB2, 0x11, 0xA2, 0xA7, 0x19, 0x66, 0x02, 0xEB, 0x15,
+    0x28, 0x0A, 0x42, 0xEF, 0x35, 0x00, 0x9B, 0xBA, 0x24, 0x30, 0x1B, 0x7E, 0xB1, 0x57, 0xA0, 0x2B,
+    0xFD, 0x53, 0x50, 0x3B, 0x18, 0xFB, 0xE2, 0x5A, 0x18, 0xF1, 0x06, 0x69, 0x33, 0x39, 0x90, 0x98,
+    0x74, 0xAC, 0x3E, 0x22, 0x6E, 0xDD, 0x6C, 0x95, 0xC8, 0xF6, 0xAB, 0x73, 0x22, 0x68, 0xD7, 0xC9,
+    0x60, 0x23, 0x4C, 0x4B, 0x5A, 0x17, 0x33, 0x8F, 0x04, 0x76, 0x13, 0x80, 0x55, 0x85, 0x88, 0x13,
+    0x11, 0x52, 0xE4, 0xCF, 0x9B, 0xEC, 0x14, 0xFD, 0xD4, 0xAB, 0x00, 0x44, 0xAA, 0x27, 0x2E, 0x56,
+    0x86, 0x6E, 0x31, 0x8B, 0xBA, 0x4B, 0x95, 0xCC, 0xC1, 0xBD, 0x45, 0xB1, 0xA2, 0x78, 0x2D, 0xBE,
+    0x0E, 0xF0, 0x02, 0xB9, 0x02, 0x22, 0xAE, 0xB3, 0x64, 0xFA, 0xC0, 0xA9, 0xC7, 0x0F, 0x7D, 0xCC,
+    0x91, 0x20, 0xE8, 0x45, 0xC4, 0x0D, 0x4B, 0xAA, 0xB8, 0x43, 0x81, 0x10, 0xD1, 0xB1, 0xCA, 0xBF,
+    0x77, 0x9D, 0xBC, 0xBF, 0xE3, 0xA2, 0x71, 0x5D, 0x32, 0x0E, 0x04, 0x5B, 0x98, 0xA3, 0x10, 0x91,
+    0x2F, 0x86, 0xC8, 0x12, 0xF9, 0x94, 0x62, 0x7C, 0xE2, 0xE0, 0x6C, 0xC4, 0x3A, 0xED, 0x50, 0x98,
+    0xD8, 0xD9, 0x0A, 0xA2, 0xE6, 0xF0, 0xE9, 0x91, 0xF7, 0x8C, 0x63, 0x38, 0x09, 0x8D, 0x32, 0x30,
+    0x6B, 0x8D, 0xFD, 0xC0, 0x47, 0xC1, 0x4C, 0x83, 0xC9, 0xD5, 0xBD, 0x56, 0xDF, 0x0E, 0x80, 0xAA,
+    0x6E, 0x55, 0x95, 0x38, 0x2B, 0x5D, 0x07, 0x66, 0xEC, 0x4C, 0xE2, 0x44, 0x93, 0xAE, 0x79, 0x03,
+    0xF3, 0xF9, 0x8D, 0xF9, 0xAB, 0xEB, 0x03, 0x0D, 0x3E, 0x71, 0x66, 0xC4, 0xFA, 0xE8, 0xB4, 0x7B,
+    0x63, 0xCC, 0x87, 0xDD, 0x7C, 0xCE, 0xF7, 0x39, 0xF5, 0x53, 0x71, 0xE0, 0x48, 0x6A, 0x3A, 0x5B,
+    0xD9, 0x12, 0x43, 0x48, 0xDD, 0x16, 0xA3, 0xB2, 0xA3, 0x92, 0x8D, 0xF3, 0x67, 0xA6, 0xDB, 0xD4,
+    0x3C, 0x0E, 0x61, 0xBE, 0xB0, 0x4F, 0x41, 0x64, 0xC8, 0x3B, 0x77, 0xC8, 0x97, 0x08, 0x3F, 0x65,
+    0xB5, 0x81, 0xFC, 0x07, 0xE5, 0x8E, 0x4C, 0xDF, 0x25, 0x38, 0xA0, 0x1C, 0x0E, 0xD4, 0x2E, 0x1D,
+    0x09, 0xE8, 0xA3, 0xD8, 0xF6, 0x94, 0xC3, 0x40, 0x99, 0x4D, 0xDA, 0xF2, 0x3A, 0x8D, 0x9F, 0xC1,
+    0x5C, 0x1C, 0xEC, 0x76, 0x6B, 0xCA, 0x95, 0xC3, 0x40, 0x62, 0x65, 0xEF, 0x87, 0x11, 0xCD, 0xD6,
+    0x67, 0x3E, 0x18, 0xE6, 0x85, 0xF9, 0xCC, 0xAF, 0x43, 0xDF, 0x49, 0x60, 0x85, 0x24, 0x42, 0xE6,
+    0x7A, 0x6B, 0xBD, 0xB1, 0x5E, 0xFB, 0x89, 0xE7, 0x02, 0xF8, 0x00, 0x62, 0x9C, 0xF9, 0x62, 0x38,
+    0xFA, 0xAF, 0xF2, 0xFA, 0x68, 0xC2, 0xA3, 0x64, 0xD7, 0xD6, 0x65, 0x3D, 0x9F, 0xC5, 0xAD, 0xAC,
+    0x4D, 0x95, 0x74, 0xB2, 0xB6, 0xF5, 0x30, 0x8F, 0x1A, 0x59, 0xA7, 0xF9, 0xBE, 0xCC, 0x53, 0xA3,
+    0xE1, 0xC4, 0x6E, 0x9F, 0x1E, 0x81, 0x6F, 0xC6, 0x33, 0x32, 0x82, 0xB0, 0xBA, 0xD7, 0x69, 0x07,
+    0x9D, 0xD5, 0x30, 0x1F, 0xD6, 0x67, 0x92, 0x09, 0x8F, 0x94, 0x58, 0xBF, 0x76, 0xA6, 0x5A, 0xDF,
+    0xAF, 0x58, 0xD3, 0xCE, 0x3C, 0xEA, 0xE6, 0x87, 0x9B, 0x12, 0x05, 0xCB, 0x5B, 0x17, 0x5E, 0x4E,
+    0x77, 0x29, 0xF1, 0x33, 0xF1, 0x4D, 0x87, 0xF8, 0xC8, 0xC1, 0x9B, 0x6C, 0x75, 0x09, 0xA2, 0x1D,
+    0xFA, 0xD9, 0xA3, 0x20, 0xDB, 0x36, 0xCA, 0x87, 0x76, 0x30, 0xFB, 0xB7, 0xC6, 0x88, 0xCB, 0x2F,
+    0x0D, 0xED, 0xB8, 0x08, 0x13, 0xD2, 0x46, 0xB9, 0xA4, 0x8A, 0xCB, 0xE3, 0xC8, 0x33, 0x42, 0x64,
+    0x71, 0x99, 0x54, 0xCA, 0xA5, 0x8D, 0x09, 0xC7, 0x43, 0x44, 0xB9, 0xAC, 0x97, 0x17, 0x97, 0x17,
+    0x65, 0x7D, 0x3C, 0x2B, 0xE4, 0x47, 0xFE, 0x1F, 0x3D, 0xB7, 0xB9, 0xC2, 0xB2, 0xC0, 0x71, 0xD3,
+    0xA5, 0xB7, 0x43, 0xA7, 0x76, 0xBC, 0xF9, 0xBA, 0x6A, 0x6D, 0xE2, 0x5A, 0x33, 0xC5, 0x56, 0x62,
+    0x2D, 0xDB, 0x3E, 0xF0, 0x13, 0x13, 0x57, 0xA0, 0xCA, 0xA0, 0xAF, 0x79, 0x13, 0xBB, 0x73, 0x49,
+    0xB5, 0x39, 0x4F, 0x85, 0xEE, 0x06, 0x55, 0x62, 0x4E, 0x23, 0xD3, 0x00, 0xFA, 0xE8, 0xB1, 0x97,
+    0xDB, 0x4E, 0x7F, 0xE5, 0xCC, 0xCD, 0xC6, 0x62, 0xB8, 0x58, 0x34, 0x5C, 0x39, 0xD2, 0x3C, 0xDA,
+    0xB8, 0xAE, 0xD9, 0x04, 0x95, 0x23, 0x95, 0x81, 0x0D, 0x02, 0x03, 0x24, 0x9E, 0xAB, 0xA7, 0xF9,
+    0xE8, 0xE3, 0x60, 0x68, 0x6B, 0xA8, 0x39, 0xA7, 0x7D, 0x82, 0xB5, 0xDD, 0x1D, 0x7B, 0xC2, 0x40,
+    0x87, 0x54, 0xE6, 0xF4, 0xBD, 0x60, 0x63, 0x17, 0xF4, 0xF4, 0xCF, 0x2E, 0x41, 0x97, 0xF4, 0x17,
+    0x70, 0xB4, 0xF1, 0x9D, 0xC2, 0x56, 0x91, 0x8E, 0xB8, 0xE1, 0x24, 0x63, 0x35, 0x39, 0x14, 0xFC,
+    0x7C, 0x3C, 0x59, 0xE0, 0x1C, 0x2D, 0x72, 0x32, 0xDA, 0xD9, 0xB1, 0xDB, 0x52, 0x3B, 0x4E, 0x63,
+    0x66, 0xBD, 0x44, 0x6F, 0xD5, 0x5E, 0x93, 0xDE, 0x75, 0x9D, 0x46, 0xA7, 0x7B, 0x6D, 0xB0, 0x95,
+    0x69, 0xCC, 0xB1, 0xF8, 0xB0, 0xDE, 0x32, 0xEF, 0x35, 0xAD, 0x7A, 0xD0, 0xE1, 0x18, 0x5B, 0xF1,
+    0xAD, 0x03, 0xF3, 0xFE, 0x27, 0x81, 0xB6, 0x6C, 0xFF, 0x3E, 0x89, 0x8A, 0xDE, 0xC9, 0x05, 0xF1,
+    0xFD, 0x6F, 0x05, 0xFE, 0xFC, 0xC3, 0xCA, 0x02, 0x24, 0xB9, 0x98, 0xC0, 0xF9, 0xF3, 0x06, 0x7F,
+    0xDF, 0xA0, 0x2C, 0x4D, 0xC8, 0xD9, 0x0D, 0x8E, 0x3D, 0xDE, 0xC1, 0xFE, 0x8E, 0xAE, 0x82, 0x8F,
+    0x6B, 0x59, 0xAA, 0x4C, 0xC3, 0x39, 0x78, 0x87, 0xDE, 0xBC, 0xD5, 0xBE, 0x9D, 0xA5, 0xF9, 0x12,
+    0x68, 0x96, 0x70, 0xE0, 0xE1, 0xD6, 0xFE, 0x32, 0xB7, 0x4D, 0x68, 0xC0, 0x47, 0x2E, 0xA6, 0xE2,
+    0xAF, 0xE9, 0xEF, 0xF0, 0x9A, 0xDD, 0x75, 0xC9, 0x6E, 0x48, 0x5C, 0x90, 0x55, 0x50, 0x65, 0xA3,
+    0xAE, 0x36, 0xFA, 0x5D, 0x9F, 0x46, 0x8E, 0xE2, 0xFF, 0x46, 0x34, 0xA1, 0x6B, 0xAC, 0x88, 0x39,
+    0xCA, 0x3F, 0x5A, 0xB3, 0xE6, 0x5B, 0xB5, 0xED, 0xCC, 0xA5, 0x1F, 0x43, 0xA1, 0xF6, 0x82, 0xFD,
+    0x12, 0x03, 0x9D, 0xA9, 0x7A, 0xB6, 0x92, 0xFF, 0x03, 0x4D, 0x55, 0xBD, 0x8F, 0xD5, 0x46, 0x10,
+    0x1F, 0xEF, 0x2A, 0x58, 0x8A, 0xA5, 0x2C, 0x05, 0x5D, 0x8A, 0x6D, 0x23, 0x45, 0xB0, 0xFF, 0x00,
+    0xBC, 0xF5, 0x41, 0x41, 0x41, 0x01, 0x45, 0x50, 0x8A, 0x14, 0xF4, 0x49, 0x71, 0x2D, 0x05, 0x77,
+    0x76, 0x42, 0x41, 0x41, 0x73, 0x0D, 0xB4, 0x10, 0x89, 0x48, 0x70, 0x29, 0xAE, 0x49, 0xF9, 0xC0,
+    0x86, 0x2B, 0x28, 0x28, 0xE2, 0xBB, 0x14, 0x94, 0x59, 0x20, 0x12, 0x04, 0x8A, 0xDB, 0x23, 0x0B,
+    0x2C, 0xB0, 0xF6, 0xE4, 0xB7, 0x86, 0x7C, 0xF8, 0xDD, 0xD3, 0xBD, 0xE7, 0x1D, 0xCF, 0xCC, 0xEF,
+    0x63, 0xE6, 0xD1, 0x81, 0x8D, 0x72, 0x14, 0x7C, 0x97, 0x93, 0xE1, 0xF6, 0x49, 0x20, 0x5B, 0x97,
+    0x9E, 0x3A, 0x52, 0x8E, 0x46, 0xD2, 0x7D, 0x91, 0x88, 0x56, 0x07, 0xC9, 0x51, 0x72, 0x2A, 0xBE,
+    0x1F, 0x09, 0xDF, 0x65, 0x22, 0xE5, 0xC9, 0xF6, 0xC5, 0x44, 0x15, 0xC2, 0x39, 0x58, 0xF6, 0x0D,
+    0x7B, 0xDA, 0xDA, 0xD0, 0x3C, 0xD8, 0xAE, 0xAF, 0x1B, 0x12, 0x51, 0x74, 0xBD, 0x0E, 0xF4, 0x5D,
+    0x24, 0x24, 0xD3, 0xF7, 0xAF, 0xB2, 0x66, 0x6F, 0x26, 0xCA, 0x97, 0xB8, 0x49, 0x65, 0x22, 0x9D,
+    0xC8, 0x46, 0xE2, 0x20, 0xDF, 0xF8, 0xEA, 0xBE, 0x37, 0xA7, 0x5C, 0xB3, 0x15, 0x1B, 0x4E, 0xDF,
+    0x76, 0xCF, 0xC8, 0xF4, 0x64, 0x5A, 0xB1, 0x79, 0x5D, 0x73, 0xDF, 0xB1, 0x74, 0xA4, 0x6B, 0xEA,
+    0x92, 0xE0, 0x44, 0x65, 0x20, 0x35, 0x90, 0xFD, 0xEC, 0xEB, 0x64, 0x71, 0x14, 0xE7, 0x6C, 0x5F,
+    0x86, 0x8A, 0x87, 0x6E, 0xAF, 0xCC, 0x7D, 0xD3, 0xC4, 0x25, 0x4F, 0x7A, 0x27, 0xAD, 0xCB, 0xFD,
+    0xA8, 0xB7, 0x5F, 0x8D, 0x15, 0xBB, 0x72, 0xCC, 0x51, 0x9F, 0x6E, 0xDE, 0xD4, 0x19, 0x1F, 0x9A,
+    0xF7, 0x19, 0x99, 0xEE, 0xE7, 0x70, 0x12, 0xB8, 0x11, 0x32, 0x1A, 0x33, 0xDF, 0x00, 0x52, 0x01,
+    0xA4, 0x6F, 0x53, 0xE9, 0x93, 0xDC, 0x47, 0x4D, 0x5F, 0x70, 0xAF, 0xD8, 0xDB, 0x8B, 0xD1, 0x9E,
+    0x88, 0xF6, 0x52, 0x30, 0xEC, 0x2B, 0x6E, 0x91, 0xB0, 0xB8, 0x53, 0x1B, 0x5E, 0x99, 0x3A, 0x35,
+    0x24, 0x2B, 0x43, 0x52, 0xBF, 0xE5, 0xD2, 0xA9, 0x38, 0xE5, 0xA8, 0x39, 0xB0, 0x8A, 0xB0, 0xBA,
+    0x73, 0x33, 0xD6, 0x9E, 0x7E, 0xA1, 0xC3, 0x62, 0xEB, 0x16, 0xF3, 0x95, 0xB7, 0xF5, 0x61, 0xAA,
+    0xEA, 0xA2, 0xA5, 0xB3, 0x67, 0x2D, 0x3F, 0xDF, 0xBC, 0x41, 0x64, 0xF8, 0xF5, 0xE6, 0x4D, 0xA2,
+    0x86, 0xB7, 0xC0, 0x1E, 0xD1, 0xF9, 0xC2, 0xCB, 0xA1, 0x6A, 0x15, 0x19, 0x3A, 0x46, 0x17, 0xF0,
+    0x5A, 0xCE, 0xAF, 0x0B, 0x74, 0x14, 0xDF, 0x8F, 0xE4, 0xA2, 0x4E, 0xF6, 0xAA, 0x3E, 0x42, 0x4B,
+    0xE1, 0xAB, 0xFE, 0x08, 0x45, 0x39, 0x68, 0x8A, 0x65, 0x7F, 0x4C, 0x38, 0x93, 0x6B, 0xC5, 0x5F,
+    0x2C, 0xDF, 0x8B, 0x9D, 0xEA, 0xE3, 0xBA, 0xDC, 0x0D, 0xBA, 0xEA, 0x93, 0xB9, 0x0C, 0x61, 0xDA,
+    0xF5, 0x63, 0x54, 0x74, 0x75, 0x37, 0x9A, 0x8B, 0x4F, 0xDC, 0x5A, 0xC3, 0x0F, 0x78, 0x63, 0x49,
+    0x95, 0x3B, 0x68, 0x99, 0xBA, 0x0D, 0x68, 0x08, 0x5E, 0x2E, 0x3F, 0xF1, 0x8B, 0x35, 0xF9, 0xA2,
+    0x5F, 0x5F, 0x56, 0x0F, 0x1F, 0xA5, 0x7C, 0xD0, 0x0A, 0x6F, 0xE8, 0xB6, 0xA9, 0xD5, 0xEF, 0xAD,
+    0x00, 0xE0, 0xA6, 0x25, 0x33, 0x90, 0x81, 0x6C, 0xD7, 0x6A, 0xBD, 0xED, 0x55, 0xBF, 0x24, 0xC1,
+    0xB5, 0xE6, 0xF6, 0x8C, 0x25, 0xB4, 0x93, 0xF5, 0xDF, 0xF6, 0x0B, 0x75, 0xD1, 0x03, 0xB9, 0x01,
+    0xF2, 0x1B, 0x54, 0x44, 0x12, 0x81, 0x84, 0x27, 0xF9, 0xD4, 0xC1, 0x3A, 0x65, 0x48, 0xD5, 0x90,
+    0x54, 0x9F, 0x54, 0x1B, 0xF5, 0x4A, 0x30, 0xC2, 0x5B, 0xE9, 0x17, 0x10, 0x17, 0x34, 0xAC, 0x81,
+    0x89, 0x9A, 0x54, 0x0F, 0x6D, 0xD6, 0x29, 0x36, 0xB4, 0xD6, 0x90, 0x59, 0x27, 0xC5, 0x24, 0x19,
+    0x1E, 0x8B, 0xB4, 0xB4, 0x64, 0x4B, 0xA7, 0x5A, 0x38, 0xF1, 0x46, 0xE9, 0x74, 0xBD, 0x94, 0x5E,
+    0xB5, 0x6B, 0x02, 0x5D, 0x2C, 0x8A, 0x50, 0x0D, 0x96, 0x50, 0xEA, 0xBE, 0xBB, 0x43, 0xEF, 0xA7,
+    0x6E, 0x68, 0x4E, 0xBF, 0x8A, 0xE6, 0x44, 0x58, 0xA0, 0x92, 0xBE, 0xE8, 0xD6, 0xCB, 0x9D, 0x60,
+    0x8E, 0xFB, 0x25, 0xA8, 0xC8, 0xE5, 0x54, 0x1B, 0x74, 0x2D, 0xEF, 0x3B, 0xDD, 0xB9, 0xEE, 0xDC,
+    0xBD, 0x60, 0xC1, 0xD4, 0x22, 0x47, 0x9C, 0xEA, 0x97, 0x38, 0x8E, 0xAA, 0xA6, 0x97, 0xB1, 0xE0,
+    0x51, 0xA4, 0x26, 0xB7, 0xE7, 0xAC, 0x1C, 0x16, 0xE5, 0x70, 0xBB, 0xDA, 0x4F, 0xB0, 0x80, 0xBA,
+    0xD6, 0xC2, 0x87, 0xE0, 0xD9, 0xCE, 0x7F, 0x62, 0x92, 0xBC, 0x1B, 0x0E, 0xDE, 0x21, 0x15, 0x41,
+    0x56, 0xB9, 0xBF, 0x92, 0xBA, 0x51, 0x47, 0x2A, 0x06, 0xD9, 0xEB, 0xB1, 0x19, 0x75, 0x6B, 0x6A,
+    0x74, 0x4D, 0x0B, 0x5A, 0xA7, 0xC6, 0x83, 0xBA, 0x7C, 0x95, 0x3C, 0x00, 0x15, 0x86, 0x87, 0x47,
+    0xAA, 0xA6, 0x6F, 0x28, 0x5B, 0x53, 0xE4, 0x99, 0x60, 0xB1, 0x79, 0xD3, 0xDE, 0x65, 0xD6, 0xBE,
+    0xE3, 0x4B, 0xA0, 0x7F, 0x87, 0xF3, 0x7C, 0x3D, 0x8D, 0x88, 0x64, 0xE8, 0xC3, 0x5C, 0x57, 0xCC,
+    0x7D, 0xB6, 0x29, 0x49, 0xB8, 0xBE, 0x98, 0xCE, 0x12, 0x75, 0x50, 0xC5, 0xCE, 0x09, 0x3D, 0x7D,
+    0xBC, 0xCA, 0xED, 0x9E, 0xE8, 0x30, 0x8C, 0xF2, 0x39, 0x07, 0x14, 0xC3, 0x01, 0x1E, 0x6D, 0x15,
+    0xBF, 0x4F, 0x88, 0x3E, 0xE9, 0x4A, 0x3E, 0x7A, 0x8C, 0xEC, 0xFE, 0x23, 0x78, 0xFA, 0xF4, 0xA9,
+    0xBA, 0x4A, 0x17, 0x8E, 0x92, 0x7D, 0xFC, 0xC8, 0x11, 0x9F, 0x56, 0xB5, 0x1C, 0xCF, 0x5F, 0x20,
+    0xF5, 0x66, 0xD7, 0x21, 0xA7, 0x42, 0xF2, 0x78, 0x9E, 0x0A, 0x7E, 0xF2, 0x02, 0x0A, 0xE4, 0x91,
+    0xC9, 0xA9, 0x90, 0xAF, 0xA5, 0x23, 0xAB, 0x98, 0x11, 0x1F, 0xD0, 0xF6, 0x0F, 0xED, 0x3F, 0x55,
+    0x2B, 0xFE, 0x03, 0x6F, 0x86, 0xC8, 0x80, 0xC5, 0xEF, 0xB6, 0x7A, 0xB8, 0xE4, 0x90, 0x64, 0x9C,
+    0x74, 0x68, 0x47, 0xE5, 0x7E, 0x59, 0xFC, 0xE8, 0x8D, 0xB7, 0x8D, 0x9C, 0x4A, 0xCC, 0x92, 0xEB,
+    0xFE, 0x94, 0x63, 0x06, 0x38, 0x4C, 0x24, 0x27, 0x8D, 0x81, 0x7E, 0x39, 0xC2, 0x4D, 0xAB, 0x77,
+    0x81, 0x65, 0xC2, 0xE6, 0x61, 0xC6, 0xB7, 0xB9, 0xE2, 0x5B, 0x3C, 0x7B, 0x06, 0x89, 0x34, 0xD0,
+    0x8B, 0xDC, 0x89, 0xC5, 0x07, 0xD4, 0x09, 0xD4, 0x20, 0x35, 0x96, 0x08, 0x6A, 0xA0, 0x0F, 0x15,
+    0x32, 0x87, 0x57, 0xBE, 0xFA, 0x27, 0x2E, 0xE6, 0x38, 0x40, 0xC2, 0x5D, 0x8B, 0xB8, 0xCF, 0xC7,
+    0x33, 0xB9, 0xC1, 0x9A, 0x72, 0xD2, 0x4F, 0x18, 0xDC, 0x65, 0x22, 0x8B, 0xDC, 0xA1, 0x71, 0xF4,
+    0xEF, 0x65, 0xA6, 0x3A, 0x83, 0xAC, 0xF1, 0x70, 0x42, 0x03, 0x57, 0xDD, 0xDC, 0xFB, 0x5C, 0x49,
+    0x20, 0xB6, 0xD8, 0x9A, 0x6E, 0xE5, 0x34, 0x61, 0x6E, 0x62, 0x2E, 0x5E, 0xAC, 0xBE, 0x3A, 0x83,
+    0x19, 0x66, 0x97, 0x7B, 0xAE, 0x49, 0xFB, 0x8F, 0xFD, 0x54, 0x33, 0xE6, 0xE7, 0x9B, 0x1B, 0x55,
+    0xE6, 0xDF, 0xCE, 0xBC, 0xF0, 0x47, 0x99, 0x66, 0x3C, 0x79, 0x09, 0xE5, 0xCF, 0x61, 0xBE, 0x85,
+    0x4C, 0xC9, 0x04, 0x04, 0x35, 0x86, 0x3B, 0xEE, 0xCD, 0x1E, 0x82, 0xA3, 0xE2, 0x73, 0xFC, 0x90,
+    0x25, 0x63, 0xFF, 0x34, 0x3D, 0xB7, 0xCD, 0xA0, 0x7D, 0xD3, 0x1B, 0x5F, 0x45, 0xE3, 0xAA, 0x08,
+    0xFA, 0x02, 0xE0, 0xF1, 0x09, 0x6C, 0x28, 0x82, 0x71, 0x10, 0x04, 0xEB, 0xF4, 0xEC, 0xF2, 0x71,
+    0x17, 0xF2, 0x71, 0x83, 0x63, 0x99, 0x27, 0xB9, 0xB9, 0xCB, 0x06, 0xAB, 0x18, 0x4B, 0x78, 0x56,
+    0x0C, 0x53, 0x96, 0x35, 0x1B, 0xFE, 0xC3, 0x0D, 0x1D, 0xAA, 0xA1, 0x9C, 0xD0, 0x46, 0xE7, 0x14,
+    0x96, 0x1D, 0x16, 0x3C, 0x56, 0x75, 0xAB, 0xF6, 0x64, 0x28, 0xDE, 0x79, 0x0B, 0x6C, 0x3F, 0xBF,
+    0x05, 0xB1, 0xBC, 0xD3, 0x6D, 0x6D, 0x3D, 0x93, 0xFB, 0x61, 0x2C, 0xBA, 0xD5, 0x6B, 0x43, 0x83,
+    0x3B, 0x27, 0x33, 0x2A, 0xD5, 0xBF, 0x0B, 0x45, 0x52, 0x1D, 0x56, 0x36, 0x7B, 0x81, 0xBE, 0xB1,
+    0x47, 0x3B, 0x27, 0x7D, 0x05, 0x3C, 0xB3, 0x03, 0x32, 0xAF, 0x34, 0x7B, 0x9E, 0xB2, 0x93, 0x86,
+    0xCC, 0x0D, 0xCF, 0xD2, 0xAD, 0x80, 0x34, 0x28, 0x64, 0x87, 0xAF, 0xA0, 0x88, 0x0A, 0x0B, 0x90,
+    0x2A, 0x47, 0x53, 0x8B, 0x49, 0x30, 0xD6, 0x7C, 0x77, 0x9C, 0xAF, 0xB1, 0x03, 0x7B, 0x7B, 0x1C,
+    0x30, 0x07, 0x0F, 0xB0, 0x43, 0xC0, 0x66, 0x53, 0x0B, 0xFE, 0x29, 0x6F, 0x6B, 0x3C, 0x3B, 0xFF,
+    0x08, 0x7D, 0xFC, 0x35, 0xC2, 0x2E, 0x2F, 0x41, 0x7B, 0xD3, 0x8A, 0x31, 0xFB, 0xA5, 0xE7, 0x5C,
+    0xCC, 0x67, 0xF9, 0x9B, 0x0F, 0xBF, 0x13, 0x28, 0xD5, 0xCC, 0x9D, 0x88, 0x2C, 0x5F, 0xB6, 0xED,
+    0xFC, 0x2F, 0x3B, 0x25, 0xBB, 0x47, 0xE6, 0x39, 0x2C, 0x93, 0x8A, 0x3A, 0x2F, 0x30, 0xF3, 0x18,
+    0x26, 0xE4, 0x16, 0x0D, 0x80, 0xEB, 0x6A, 0xEC, 0x56, 0x7A, 0xF5, 0x8E, 0xFF, 0x4A, 0x79, 0x55,
+    0x33, 0x5C, 0x81, 0x14, 0xCE, 0xCC, 0xD3, 0x49, 0x76, 0x24, 0xBB, 0x0D, 0x63, 0xA6, 0x82, 0x61,
+    0x43, 0x13, 0xCB, 0x04, 0x4F, 0x19, 0x6F, 0x5C, 0x93, 0x97, 0x26, 0xAF, 0xF0, 0x17, 0xD8, 0x14,
+    0x49, 0xA6, 0x8E, 0xBD, 0xF6, 0xEA, 0x35, 0xAA, 0x75, 0xAD, 0x7D, 0xCA, 0x1F, 0x94, 0x3F, 0x84,
+    0x6E, 0x82, 0x88, 0x45, 0x54, 0x83, 0x72, 0x6A, 0xB0, 0xF9, 0x8C, 0x92, 0x9C, 0x44, 0x94, 0x5E,
+    0xE7, 0x9B, 0x90, 0xB4, 0x21, 0x2B, 0xF7, 0x7E, 0x88, 0xB0, 0xC8, 0x9A, 0xEA, 0xA5, 0x4F, 0xA1,
+    0xA1, 0xD5, 0x17, 0xEF, 0x5F, 0x60, 0xFD, 0xE0, 0x4A, 0xD5, 0x34, 0x31, 0x5F, 0x2F, 0x9F, 0xEE,
+    0xFE, 0x15, 0x48, 0xAF, 0x56, 0xBF, 0xF6, 0x74, 0x3B, 0x62, 0x77, 0x8A, 0xF7, 0xC3, 0x1D, 0x0F,
+    0x88, 0x02, 0x18, 0x4D, 0x84, 0x14, 0x50, 0xC2, 0x60, 0x15, 0x4F, 0x59, 0x91, 0xD9, 0x3B, 0xFF,
+    0xBB, 0xFE, 0x06, 0x9D, 0x55, 0x3D, 0x6F, 0x1D, 0x45, 0x14, 0xBD, 0xBB, 0x83, 0xB3, 0x88, 0x2D,
+    0xC6, 0x45, 0x90, 0x25, 0xBB, 0x58, 0x5A, 0x44, 0xB1, 0x7F, 0x00, 0x31, 0x1B, 0xB9, 0x48, 0x41,
+    0x61, 0x17, 0x18, 0x17, 0x29, 0xDC, 0x22, 0x9A, 0xF0, 0x03, 0xA2, 0xEC, 0x2A, 0x2E, 0x28, 0xD2,
+    0xD0, 0x00, 0x7F, 0x20, 0x12, 0x96, 0x5D, 0xB8, 0x45, 0x22, 0x61, 0x27, 0xB8, 0xA0, 0xA0, 0x59,
+    0x42, 0x41, 0x41, 0xC1, 0xCA, 0x8A, 0x84, 0x64, 0x0A, 0x4F, 0x60, 0x03, 0x6B, 0x33, 0x3B, 0x97,
+    0x73, 0x67, 0xDF, 0x73, 0x5C, 0x50, 0xB1, 0xD2, 0x9B, 0x7D, 0x6F, 0xE6, 0xCE, 0xFD, 0x38, 0xE7,
+    0xDC, 0xFB, 0xA8, 0xE4, 0x91, 0x0A, 0xAB, 0x98, 0xC7, 0xD4, 0x93, 0x61, 0xEE, 0x8C, 0xCD, 0x2E,
+    0x3E, 0x64, 0x35, 0x52, 0x4B, 0xF9, 0x50, 0x57, 0xB9, 0x3B, 0x30, 0xB7, 0x1D, 0x85, 0xF2, 0x64,
+    0x68, 0x49, 0x3F, 0xF3, 0xF5, 0x56, 0x9F, 0x4C, 0xE6, 0xA1, 0x0B, 0x54, 0x9E, 0x8C, 0x6D, 0xD1,
+    0x29, 0xEC, 0x9C, 0xE2, 0x26, 0x76, 0x4A, 0xAB, 0x06, 0x2E, 0x7E, 0x1A, 0xA9, 0xD6, 0xA7, 0xDE,
+    0xE0, 0xE6, 0x64, 0xBE, 0x77, 0xC4, 0xC5, 0x77, 0x8F, 0x98, 0xB0, 0x43, 0x65, 0x87, 0x9B, 0x76,
+    0x03, 0x5F, 0x4E, 0x98, 0xB9, 0x4A, 0x7D, 0x8D, 0x70, 0xB8, 0xC9, 0xFC, 0x19, 0x5D, 0x3D, 0x85,
+    0xC3, 0x52, 0x62, 0x31, 0x1C, 0x16, 0x4B, 0xCD, 0x13, 0xF6, 0x6A, 0x4B, 0xC9, 0x76, 0xDD, 0x50,
+    0xE9, 0xDB, 0x86, 0x5A, 0xB9, 0x0F, 0x27, 0xA4, 0xF8, 0x36, 0x53, 0xEE, 0x55, 0x20, 0x3D, 0xA4,
+    0x13, 0x6E, 0xA3, 0x8A, 0xD2, 0x29, 0x2C, 0x7D, 0x5C, 0xF2, 0x11, 0x3F, 0xF5, 0x40, 0xE5, 0x58,
+    0x3B, 0xD2, 0xCC, 0x8E, 0x72, 0xFE, 0xDD, 0x51, 0xCA, 0x0F, 0x7B, 0xA2, 0x9B, 0xCB, 0xA0, 0x6F,
+    0xEE, 0xEC, 0x90, 0xF8, 0x24, 0xFA, 0xF8, 0xF0, 0x70, 0xB9, 0x99, 0xF0, 0x40, 0xC4, 0xDC, 0x23,
+    0x09, 0x4F, 0x3A, 0xEC, 0x35, 0x29, 0x57, 0xAB, 0x64, 0x3A, 0x42, 0x3C, 0xA2, 0x37, 0xF8, 0xAC,
+    0xC1, 0xA9, 0xA7, 0x82, 0xD9, 0x92, 0x81, 0xB7, 0xB5, 0xF0, 0x01, 0xD2, 0x41, 0x45, 0x35, 0x76,
+    0x25, 0x5D, 0x42, 0x06, 0x14, 0x8F, 0x14, 0x7F, 0xE1, 0xC4, 0x50, 0x82, 0x38, 0x38, 0x96, 0x7A,
+    0xB6, 0xE5, 0xAC, 0xCB, 0x27, 0x32, 0xB6, 0x00, 0x64, 0xD6, 0x38, 0x6A, 0x2D, 0x5C, 0xF1, 0x03,
+    0xAE, 0x88, 0x37, 0x51, 0x37, 0x6B, 0x0F, 0x5B, 0x60, 0x91, 0x06, 0x78, 0x7B, 0x87, 0xF9, 0x4C,
+    0x08, 0x62, 0xF8, 0x07, 0x2A, 0xB9, 0x84, 0xCD, 0x3D, 0x0E, 0xF4, 0x80, 0x9C, 0xB0, 0xF4, 0xA8,
+    0x1E, 0xC6, 0x85, 0x2B, 0x50, 0x6E, 0xAF, 0x47, 0x78, 0x87, 0x03, 0x63, 0x91, 0x2D, 0x8C, 0x79,
+    0x13, 0x9F, 0x1F, 0xF1, 0x71, 0xB8, 0x3E, 0x12, 0x70, 0x21, 0x35, 0x7D, 0x82, 0x20, 0x02, 0x30,
+    0xF2, 0x29, 0xB1, 0x81, 0x3B, 0x54, 0x4C, 0x6F, 0x51, 0xC9, 0xDF, 0xE2, 0x13, 0x28, 0x2D, 0xA7,
+    0x79, 0x13, 0x59, 0x22, 0x7D, 0x18, 0x21, 0xA6, 0x2A, 0x51, 0x10, 0x10, 0x9D, 0xAB, 0x5B, 0x3C,
+    0x29, 0x87, 0x0A, 0xAF, 0x8C, 0x63, 0x69, 0xC0, 0x05, 0xB0, 0xE1, 0xCA, 0xE7, 0x6D, 0x58, 0x40,
+    0x09, 0xD4, 0x48, 0x3B, 0xF1, 0x85, 0x7B, 0x29, 0xC7, 0x3D, 0xE4, 0x86, 0x77, 0xDB, 0x88, 0x33,
+    0x24, 0xAB, 0xA6, 0x68, 0x43, 0x72, 0x98, 0x79, 0x20, 0x72, 0xF7, 0x79, 0x02, 0x95, 0xB9, 0x96,
+    0x2B, 0xD8, 0x8C, 0xED, 0xB9, 0x03, 0x5C, 0xDE, 0xD8, 0x49, 0xBB, 0x2C, 0x14, 0xD6, 0x7C, 0xEA,
+    0x73, 0xCE, 0x9D, 0x3E, 0xE5, 0x63, 0xDE, 0xF4, 0xD9, 0x20, 0x92, 0xE2, 0x2F, 0xBD, 0x28, 0x06,
+    0x82, 0xD1, 0xFC, 0x9C, 0xCA, 0xF3, 0x98, 0x4C, 0xEE, 0x04, 0x6A, 0x52, 0xE3, 0x9C, 0xEA, 0x9C,
+    0x11, 0xD5, 0x55, 0x7C, 0x95, 0x36, 0xBE, 0xB4, 0xA3, 0xEB, 0x36, 0x57, 0x39, 0xE7, 0xA2, 0x81,
+    0x42, 0xF8, 0x34, 0x7F, 0x08, 0xA9, 0x4F, 0x97, 0x4B, 0x7B, 0x12, 0x17, 0xD8, 0xD7, 0x3F, 0xE0,
+    0x6E, 0x7D, 0xDE, 0x89, 0x58, 0x1B, 0x59, 0xA4, 0x70, 0x1C, 0xBE, 0x2E, 0xC5, 0xBE, 0x2B, 0xDF,
+    0x9E, 0x18, 0xF0, 0x18, 0x80, 0x8C, 0xE2, 0xBF, 0xA1, 0xD3, 0xF3, 0x53, 0x54, 0xB5, 0xF5, 0x80,
+    0xE9, 0x7E, 0x0E, 0x0C, 0xE8, 0x35, 0x59, 0x28, 0x42, 0xA2, 0x24, 0xB7, 0x3B, 0x92, 0xB4, 0x44,
+    0x24, 0x96, 0xA4, 0xC4, 0x67, 0x0D, 0x70, 0x41, 0x61, 0x15, 0xF5, 0xA6, 0x2F, 0xB9, 0x4F, 0x18,
+    0xF6, 0x28, 0x78, 0x82, 0xA6, 0xA4, 0x63, 0x8B, 0x7E, 0x6D, 0xDA, 0x0D, 0xC2, 0xF0, 0x58, 0x86,
+    0xE3, 0x50, 0xA1, 0x29, 0x2A, 0x88, 0x1D, 0x76, 0xC8, 0xBF, 0x00, 0xDD, 0x69, 0xD8, 0xA6, 0x28,
+    0xDD, 0x48, 0x9A, 0x68, 0x53, 0x04, 0x40, 0x3C, 0x83, 0x10, 0xB5, 0xA8, 0xAD, 0xF0, 0x77, 0x81,
+    0x4C, 0x80, 0x20, 0x74, 0x36, 0x40, 0xCB, 0xAD, 0x35, 0xD3, 0xB8, 0x92, 0xF0, 0x49, 0x4F, 0xDA,
+    0xEB, 0x8A, 0xEA, 0xFE, 0x1E, 0xCE, 0x53, 0x74, 0xD2, 0xA8, 0xCF, 0x0E, 0x4C, 0x67, 0xF8, 0x05,
+    0xDF, 0x62, 0x16, 0x26, 0x26, 0x88, 0x4F, 0xBB, 0xBA, 0x1B, 0x6B, 0xCB, 0xFB, 0xCF, 0x82, 0xE2,
+    0x3D, 0x3D, 0x66, 0x3C, 0xB5, 0x9D, 0x16, 0xC9, 0x6A, 0xC9, 0x1C, 0xEA, 0x68, 0x28, 0x11, 0xB2,
+    0x73, 0x7B, 0x05, 0x73, 0x26, 0x35, 0x2B, 0xE8, 0x0A, 0x80, 0xBB, 0x65, 0xE5, 0xB5, 0xA0, 0x61,
+    0x04, 0xD3, 0xE2, 0x37, 0xD8, 0xEB, 0x97, 0x82, 0x1D, 0x9E, 0x44, 0x16, 0x9B, 0x32, 0xE4, 0x81,
+    0xDC, 0x39, 0xEA, 0xDA, 0xC7, 0x13, 0xBA, 0xFB, 0x72, 0x77, 0xAA, 0xA0, 0x24, 0x16, 0xED, 0x44,
+    0x31, 0xE5, 0x03, 0x90, 0x4D, 0x83, 0x20, 0xD8, 0x36, 0xAD, 0xA5, 0xA2, 0x5F, 0x84, 0x6C, 0x27,
+    0xE9, 0xC3, 0x51, 0xF2, 0x41, 0x73, 0x1F, 0x31, 0x25, 0x55, 0xE4, 0x3F, 0x32, 0xE7, 0xD6, 0x0F,
+    0x8F, 0x78, 0x5F, 0xFC, 0xAE, 0xB7, 0x7C, 0x09, 0x14, 0x3D, 0xAD, 0x71, 0xD8, 0x91, 0x48, 0x50,
+    0x22, 0x87, 0x34, 0xD0, 0x02, 0xC9, 0x40, 0x2B, 0x54, 0x5E, 0xDC, 0xE9, 0x49, 0x00, 0x8B, 0xBE,
+    0x0A, 0x51, 0x4B, 0x52, 0x5D, 0xD5, 0x26, 0x65, 0xE6, 0x10, 0x62, 0x2A, 0xD5, 0xCB, 0x6C, 0x15,
+    0x48, 0xC9, 0x8C, 0x8F, 0x6F, 0x26, 0xBC, 0xBF, 0x84, 0xB4, 0x7B, 0x05, 0x29, 0xE6, 0x48, 0xF7,
+    0x9E, 0x54, 0x36, 0x80, 0xA7, 0x0C, 0x9D, 0xED, 0x4A, 0x89, 0x05, 0xA6, 0xC4, 0x5C, 0xF1, 0xD6,
+    0x2D, 0xC4, 0x09, 0x8F, 0xE7, 0x39, 0xA6, 0x65, 0x00, 0x08, 0x61, 0xD7, 0x20, 0x5D, 0x89, 0xC2,
+    0xAD, 0x56, 0x2A, 0x52, 0x2E, 0xC3, 0xDC, 0xF0, 0x22, 0xE8, 0x90, 0x4C, 0x92, 0x01, 0x73, 0x26,
+    0xCB, 0x53, 0x59, 0xDC, 0xC6, 0xB4, 0x77, 0xB1, 0x9D, 0x06, 0x69, 0x39, 0xC1, 0x11, 0x9D, 0x08,
+    0x4D, 0x80, 0xC1, 0x1E, 0xBA, 0x00, 0x88, 0x6A, 0x12, 0x9D, 0x80, 0xDA, 0x57, 0x27, 0x43, 0x95,
+    0x83, 0xCF, 0x01, 0x37, 0x20, 0x64, 0x8E, 0xD3, 0xE0, 0xDA, 0x00, 0x95, 0x3A, 0xFB, 0xD8, 0xFF,
+    0x96, 0xA2, 0x4A, 0xC9, 0x84, 0xB6, 0x12, 0x8C, 0x56, 0x67, 0xB9, 0x09, 0x2B, 0x42, 0x6C, 0x1F,
+    0xD9, 0x6E, 0x88, 0x16, 0x1E, 0x84, 0x8B, 0x05, 0xF3, 0xF3, 0xB6, 0xF6, 0xC9, 0xA3, 0x8F, 0xDE,
+    0x46, 0xD4, 0x5F, 0xCF, 0xFF, 0xF4, 0xB9, 0xA9, 0x8F, 0x8D, 0xFD, 0xE6, 0xF4, 0xC5, 0x3F, 0x83,
+    0x0A, 0xF7, 0x0B, 0x09, 0x2B, 0x1A, 0x6A, 0x65, 0xCA, 0xEA, 0xF7, 0x7F, 0x06, 0x0B, 0xC3, 0xD7,
+    0xF7, 0x50, 0x76, 0x22, 0xA0, 0x0B, 0x45, 0x6A, 0x51, 0xE1, 0x3C, 0xE4, 0x16, 0xCF, 0xD5, 0x26,
+    0xEE, 0x8D, 0xEB, 0xC7, 0x97, 0x07, 0x24, 0x75, 0xC7, 0xB6, 0x83, 0x2C, 0xE2, 0x80, 0x5E, 0xCE,
+    0xB3, 0xFF, 0xDC, 0x14, 0xCF, 0x83, 0xD0, 0xC7, 0xBC, 0x43, 0x1B, 0xF3, 0x48, 0x6C, 0xE3, 0x40,
+    0x9D, 0x56, 0x76, 0xD1, 0x58, 0xC5, 0x90, 0x1C, 0x71, 0x93, 0x23, 0xA0, 0x41, 0xA3, 0x8A, 0xC6,
+    0x99, 0x62, 0x08, 0xA9, 0x59, 0x9C, 0xC4, 0xBF, 0xB3, 0x6E, 0x76, 0x2C, 0x2D, 0x57, 0xCA, 0xB0,
+    0x90, 0x20, 0x76, 0x95, 0xEA, 0x5F, 0x7A, 0x38, 0xEB, 0x6F, 0x60, 0x80, 0x16, 0x38, 0x2B, 0xF9,
+    0x46, 0x03, 0x95, 0xE3, 0xBF, 0x86, 0x2B, 0x83, 0xFF, 0xC5, 0x1A, 0x2E, 0xBE, 0xF2, 0x14, 0xB2,
+    0x31, 0x0D, 0xF9, 0xA0, 0xBC, 0x1E, 0x72, 0x0F, 0x59, 0x0C, 0xC5, 0x5F, 0xDC, 0x97, 0xB0, 0x33,
+    0x60, 0xC3, 0x00, 0xFA, 0x64, 0x9B, 0xFE, 0xD7, 0xF3, 0x2F, 0x4D, 0x52, 0xB1, 0x8A, 0xD5, 0x40,
+    0x14, 0x3D, 0x2F, 0xA3, 0x6F, 0x90, 0x80, 0xD7, 0x5A, 0x8B, 0xF4, 0x16, 0xFB, 0xDA, 0x2D, 0x56,
+    0x13, 0xB0, 0xB0, 0x74, 0x7B, 0x3F, 0x62, 0x1B, 0x4B, 0x21, 0x41, 0xC1, 0x6D, 0xFD, 0x0E, 0x41,
+    0xDC, 0xC2, 0x3E, 0x81, 0x2D, 0x6D, 0xD2, 0xC8, 0xC3, 0x2E, 0xA0, 0x20, 0x6A, 0x33, 0xC5, 0x08,
+    0xF1, 0x99, 0xE4, 0x7A, 0xEE, 0x64, 0x57, 0x9D, 0x90, 0x73, 0xE6, 0x26, 0x33, 0xE7, 0xDC, 0x7B,
+    0x67, 0x00, 0x0E, 0x09, 0x04, 0x25, 0xE4, 0x97, 0x3D, 0xF0, 0x50, 0x2A, 0x60, 0x7A, 0x00, 0x38,
+    0x55, 0x8D, 0x39, 0x61, 0x94, 0xEB, 0xD9, 0xE0, 0x7A, 0x48, 0x53, 0xDC, 0xBA, 0x73, 0x84, 0xE7,
+    0xF3, 0xF0, 0x3E, 0x53, 0xDD, 0x77, 0x72, 0xF8, 0xBD, 0xA0, 0x7C, 0xE4, 0x5F, 0xBB, 0x89, 0x32,
+    0x75, 0x24, 0xFC, 0x58, 0xDE, 0x52, 0xD5, 0x14, 0x77, 0xDA, 0x01, 0xC5, 0x82, 0xBF, 0xA3, 0xE8,
+    0x0D, 0x77, 0x09, 0xCB, 0xEE, 0x1F, 0xD6, 0x8D, 0x61, 0x4B, 0x6B, 0x9C, 0xE9, 0x2F, 0xA6, 0x42,
+    0xB7, 0x0E, 0x25, 0x31, 0x40, 0x2D, 0x87, 0x8D, 0xBE, 0x98, 0x65, 0x72, 0x8B, 0x9B, 0x3C, 0x1F,
+    0xC7, 0x27, 0x1F, 0x8D, 0x25, 0x1A, 0x4B, 0xC8, 0xC9, 0x12, 0x6E, 0x9E, 0xE6, 0x63, 0x41, 0x5F,
+    0x89, 0xBB, 0xC1, 0x0A, 0x2B, 0x69, 0x54, 0x04, 0xB3, 0x60, 0x9C, 0x9B, 0x70, 0xA9, 0xCC, 0x46,
+    0x09, 0x2C, 0x6F, 0xE2, 0xBF, 0x5D, 0x44, 0xDB, 0x94, 0xBD, 0x9B, 0xA1, 0x95, 0x04, 0x3F, 0xA1,
+    0xEE, 0xCA, 0xB0, 0xD5, 0xA7, 0x5A, 0xB5, 0x74, 0xB5, 0x1E, 0x34, 0x2C, 0xFF, 0x0B, 0xEE, 0xCD,
+    0xA7, 0x49, 0x04, 0x5B, 0xFD, 0x6E, 0x2A, 0x93, 0xA9, 0x04, 0x6C, 0xDA, 0x8F, 0x40, 0x66, 0x05,
+    0x4A, 0x5C, 0x2B, 0xBC, 0x78, 0x46, 0x08, 0xE1, 0x0A, 0xB6, 0xCA, 0xCF, 0x54, 0x32, 0xBB, 0x05,
+    0x85, 0x41, 0xA9, 0x2F, 0x3F, 0xA1, 0xFD, 0x7A, 0xDE, 0x40, 0x3F, 0x3C, 0xAE, 0x32, 0x95, 0xBC,
+    0x72, 0x2A, 0x02, 0x67, 0x2A, 0xCC, 0xE3, 0x7F, 0xC8, 0xD4, 0x24, 0x13, 0xB4, 0xD6, 0x27, 0x66,
+    0x8B, 0xBB, 0xEF, 0xF4, 0xD0, 0x58, 0x67, 0x12, 0x54, 0x35, 0xC1, 0x6C, 0x2F, 0x80, 0x93, 0x13,
+    0xA6, 0x71, 0xDB, 0x12, 0x6B, 0xE8, 0x32, 0x9A, 0x5D, 0xC3, 0x46, 0x06, 0x37, 0xE7, 0x13, 0x74,
+    0xA3, 0xEC, 0x75, 0xDD, 0x15, 0x43, 0x39, 0xE4, 0x4B, 0x1B, 0x98, 0xD0, 0x00, 0x7B, 0xA9, 0x82,
+    0x62, 0xA8, 0xFB, 0x3C, 0xCA, 0xC8, 0xBE, 0x2E, 0xB4, 0xD3, 0xA6, 0xEE, 0xDA, 0xBE, 0x38, 0x68,
+    0xE0, 0xF6, 0xC8, 0x95, 0x91, 0x2B, 0x7B, 0xB8, 0xCB, 0x6E, 0xAD, 0xEA, 0xF8, 0x18, 0xB8, 0xFF,
+    0xE6, 0x89, 0x7E, 0xD6, 0x9F, 0xD6, 0x88, 0xEB, 0x91, 0x4E, 0x15, 0xB2, 0x92, 0x26, 0x92, 0x95,
+    0x34, 0x91, 0x7C, 0x3B, 0x33, 0x8A, 0x69, 0x89, 0x74, 0x89, 0xF4, 0xD5, 0xC0, 0xDB, 0xC0, 0x16,
+    0x77, 0x75, 0x6F, 0x27, 0x9D, 0x69, 0xCF, 0x20, 0x72, 0x9F, 0x15, 0xD7, 0xEA, 0x7E, 0xBD, 0x7A,
+    0xE7, 0x2C, 0x85, 0xE7, 0xE1, 0x75, 0xF1, 0x9C, 0x79, 0x1D, 0x77, 0xAC, 0xCF, 0xDB, 0xCD, 0x68,
+    0x12, 0x8D, 0x80, 0x9F, 0x3D, 0x03, 0xF8, 0x20, 0x0C, 0xE0, 0xFB, 0xD2, 0xAE, 0x94, 0xDF, 0x5B,
+    0x80, 0xF4, 0x87, 0x94, 0x02, 0xF8, 0x14, 0xE0, 0x06, 0xDF, 0x3F,
+};
+
+static const uint32_t notosans_14_bolditalicBlockOffsets[38] = {
+    0, 1170, 2233, 3369, 4481, 5679, 6558, 7265,
+    8230, 9007, 9944, 10735, 11681, 12644, 13653, 14397,
+    15512, 16810, 17841, 18943, 20026, 21145, 22134, 23332,
+    24478, 25483, 26583, 27681, 28641, 29757, 30869, 31905,
+    32961, 34079, 35113, 36483, 37658, 38123,
+};
+
+static const uint16_t notosans_14_bolditalicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_14_bolditalicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_14_bolditalicPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 876, 0, 0,
 };
 
 static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
@@ -4603,850 +2577,850 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 10, 21, 8, -2, 17, 53, 1874 }, // ;
     { 15, 17, 17, 1, 19, 64, 1927 }, // <
     { 15, 10, 17, 1, 15, 38, 1991 }, // =
-    { 15, 17, 17, 1, 19, 64, 2029 }, // >
-    { 13, 23, 13, 2, 22, 75, 2093 }, // ?
-    { 24, 24, 25, 1, 21, 144, 2168 }, // @
-    { 19, 21, 18, -2, 21, 100, 2312 }, // A
-    { 18, 21, 18, 0, 21, 95, 2412 }, // B
-    { 19, 23, 18, 1, 22, 110, 2507 }, // C
-    { 19, 21, 20, 0, 21, 100, 2617 }, // D
-    { 17, 21, 16, 0, 21, 90, 2717 }, // E
-    { 17, 21, 16, 0, 21, 90, 2807 }, // F
-    { 19, 23, 20, 1, 22, 110, 2897 }, // G
-    { 21, 21, 20, 0, 21, 111, 3007 }, // H
-    { 14, 21, 11, -1, 21, 74, 3118 }, // I
-    { 15, 28, 10, -5, 21, 105, 3192 }, // J
-    { 21, 21, 18, 0, 21, 111, 3297 }, // K
-    { 14, 21, 15, 0, 21, 74, 3408 }, // L
-    { 26, 21, 26, 0, 21, 137, 3482 }, // M
-    { 23, 21, 22, 0, 21, 121, 3619 }, // N
-    { 20, 23, 21, 1, 22, 115, 3740 }, // O
-    { 18, 21, 18, 0, 21, 95, 3855 }, // P
-    { 20, 27, 21, 1, 22, 135, 3950 }, // Q
-    { 18, 21, 18, 0, 21, 95, 4085 }, // R
-    { 16, 23, 15, 0, 22, 92, 4180 }, // S
-    { 16, 21, 16, 2, 21, 84, 4272 }, // T
-    { 20, 22, 20, 1, 21, 110, 4356 }, // U
-    { 18, 21, 17, 2, 21, 95, 4466 }, // V
-    { 27, 21, 26, 2, 21, 142, 4561 }, // W
-    { 23, 21, 18, -2, 21, 121, 4703 }, // X
-    { 18, 21, 16, 2, 21, 95, 4824 }, // Y
-    { 19, 21, 16, -1, 21, 100, 4919 }, // Z
-    { 13, 26, 10, -1, 21, 85, 5019 }, // [
-    { 8, 22, 12, 3, 21, 44, 5104 }, // <backslash>
-    { 13, 26, 10, -2, 21, 85, 5148 }, // ]
-    { 16, 14, 16, 0, 21, 56, 5233 }, // ^
-    { 13, 3, 12, -3, -2, 10, 5289 }, // _
-    { 7, 6, 9, 4, 23, 11, 5299 }, // `
-    { 16, 18, 17, 1, 17, 72, 5310 }, // a
-    { 17, 24, 17, 0, 23, 102, 5382 }, // b
-    { 14, 18, 14, 1, 17, 63, 5484 }, // c
-    { 18, 24, 17, 1, 23, 108, 5547 }, // d
-    { 15, 18, 16, 1, 17, 68, 5655 }, // e
-    { 19, 30, 11, -4, 23, 143, 5723 }, // f
-    { 17, 24, 17, 0, 17, 102, 5866 }, // g
-    { 17, 23, 18, 0, 23, 98, 5968 }, // h
-    { 10, 23, 9, 0, 23, 58, 6066 }, // i
-    { 14, 30, 9, -4, 23, 105, 6124 }, // j
-    { 18, 23, 17, 0, 23, 104, 6229 }, // k
-    { 10, 23, 9, 0, 23, 58, 6333 }, // l
-    { 25, 17, 26, 0, 17, 107, 6391 }, // m
-    { 17, 17, 18, 0, 17, 73, 6498 }, // n
-    { 15, 18, 17, 1, 17, 68, 6571 }, // o
-    { 18, 24, 17, -1, 17, 108, 6639 }, // p
-    { 16, 24, 17, 1, 17, 96, 6747 }, // q
-    { 14, 17, 12, 0, 17, 60, 6843 }, // r
-    { 14, 18, 14, 0, 17, 63, 6903 }, // s
-    { 12, 21, 12, 1, 20, 63, 6966 }, // t
-    { 17, 17, 18, 1, 16, 73, 7029 }, // u
-    { 16, 16, 15, 1, 16, 64, 7102 }, // v
-    { 24, 16, 23, 1, 16, 96, 7166 }, // w
-    { 19, 16, 16, -2, 16, 76, 7262 }, // x
-    { 20, 23, 15, -3, 16, 115, 7338 }, // y
-    { 15, 16, 14, -1, 16, 60, 7453 }, // z
-    { 14, 26, 10, -1, 21, 91, 7513 }, // {
-    { 4, 30, 16, 6, 23, 30, 7604 }, // |
-    { 13, 26, 10, -2, 21, 85, 7634 }, // }
-    { 15, 6, 17, 1, 13, 23, 7719 }, // ~
-    { 0, 0, 8, 0, 0, 0, 7742 }, //  
-    { 10, 22, 8, -2, 16, 55, 7742 }, // ¡
-    { 14, 23, 16, 2, 22, 81, 7797 }, // ¢
-    { 19, 22, 16, -1, 22, 105, 7878 }, // £
-    { 15, 14, 16, 1, 17, 53, 7983 }, // ¤
-    { 18, 21, 16, 1, 21, 95, 8036 }, // ¥
-    { 4, 30, 16, 6, 23, 30, 8131 }, // ¦
-    { 15, 24, 14, 0, 23, 90, 8161 }, // §
-    { 11, 4, 16, 5, 22, 11, 8251 }, // ¨
-    { 22, 23, 24, 1, 22, 127, 8262 }, // ©
-    { 11, 12, 11, 2, 22, 33, 8389 }, // ª
-    { 16, 14, 17, 1, 15, 56, 8422 }, // «
-    { 15, 9, 17, 1, 12, 34, 8478 }, // ¬
-    { 9, 4, 9, 0, 10, 9, 8512 }, // ­
-    { 22, 23, 24, 1, 22, 127, 8521 }, // ®
-    { 15, 4, 12, 2, 26, 15, 8648 }, // ¯
-    { 11, 11, 12, 1, 22, 31, 8663 }, // °
-    { 15, 19, 17, 1, 19, 72, 8694 }, // ±
-    { 12, 13, 11, 1, 25, 39, 8766 }, // ²
-    { 11, 14, 11, 2, 25, 39, 8805 }, // ³
-    { 9, 6, 9, 3, 23, 14, 8844 }, // ´
-    { 19, 23, 18, -1, 16, 110, 8858 }, // µ
-    { 16, 27, 19, 2, 23, 108, 8968 }, // ¶
-    { 7, 6, 8, 1, 13, 11, 9076 }, // ·
-    { 7, 7, 6, -3, 0, 13, 9087 }, // ¸
-    { 10, 13, 11, 2, 25, 33, 9100 }, // ¹
-    { 10, 11, 11, 2, 21, 28, 9133 }, // º
-    { 16, 14, 16, 0, 15, 56, 9161 }, // »
-    { 22, 21, 24, 2, 21, 116, 9217 }, // ¼
-    { 23, 21, 26, 2, 21, 121, 9333 }, // ½
-    { 24, 21, 25, 1, 21, 126, 9454 }, // ¾
-    { 13, 23, 14, -1, 17, 75, 9580 }, // ¿
-    { 19, 28, 18, -2, 28, 133, 9655 }, // À
-    { 20, 28, 18, -2, 28, 140, 9788 }, // Á
-    { 20, 28, 18, -2, 28, 140, 9928 }, // Â
-    { 21, 28, 18, -2, 28, 147, 10068 }, // Ã
-    { 20, 27, 18, -2, 27, 135, 10215 }, // Ä
-    { 19, 30, 18, -2, 30, 143, 10350 }, // Å
-    { 30, 21, 26, -2, 21, 158, 10493 }, // Æ
-    { 19, 29, 18, 1, 22, 138, 10651 }, // Ç
-    { 17, 28, 16, 0, 28, 119, 10789 }, // È
-    { 17, 28, 16, 0, 28, 119, 10908 }, // É
-    { 17, 28, 16, 0, 28, 119, 11027 }, // Ê
-    { 17, 27, 16, 0, 27, 115, 11146 }, // Ë
-    { 14, 28, 11, -1, 28, 98, 11261 }, // Ì
-    { 16, 28, 11, -1, 28, 112, 11359 }, // Í
-    { 16, 28, 11, -1, 28, 112, 11471 }, // Î
-    { 15, 27, 11, -1, 27, 102, 11583 }, // Ï
-    { 19, 21, 20, 0, 21, 100, 11685 }, // Ð
-    { 23, 28, 22, 0, 28, 161, 11785 }, // Ñ
-    { 20, 29, 21, 1, 28, 145, 11946 }, // Ò
-    { 20, 29, 21, 1, 28, 145, 12091 }, // Ó
-    { 20, 29, 21, 1, 28, 145, 12236 }, // Ô
-    { 20, 29, 21, 1, 28, 145, 12381 }, // Õ
-    { 20, 28, 21, 1, 27, 140, 12526 }, // Ö
-    { 14, 14, 17, 2, 17, 49, 12666 }, // ×
-    { 20, 24, 21, 1, 22, 120, 12715 }, // Ø
-    { 20, 29, 20, 1, 28, 145, 12835 }, // Ù
-    { 20, 29, 20, 1, 28, 145, 12980 }, // Ú
-    { 20, 29, 20, 1, 28, 145, 13125 }, // Û
-    { 20, 28, 20, 1, 27, 140, 13270 }, // Ü
-    { 18, 28, 16, 2, 28, 126, 13410 }, // Ý
-    { 17, 21, 18, 0, 21, 90, 13536 }, // Þ
-    { 23, 30, 19, -4, 23, 173, 13626 }, // ß
-    { 16, 24, 17, 1, 23, 96, 13799 }, // à
-    { 16, 24, 17, 1, 23, 96, 13895 }, // á
-    { 16, 24, 17, 1, 23, 96, 13991 }, // â
-    { 17, 24, 17, 1, 23, 102, 14087 }, // ã
-    { 16, 23, 17, 1, 22, 92, 14189 }, // ä
-    { 16, 26, 17, 1, 25, 104, 14281 }, // å
-    { 24, 18, 25, 1, 17, 108, 14385 }, // æ
-    { 14, 24, 14, 1, 17, 84, 14493 }, // ç
-    { 15, 24, 16, 1, 23, 90, 14577 }, // è
-    { 15, 24, 16, 1, 23, 90, 14667 }, // é
-    { 16, 24, 16, 1, 23, 96, 14757 }, // ê
-    { 15, 23, 16, 1, 22, 87, 14853 }, // ë
-    { 9, 23, 9, 0, 23, 52, 14940 }, // ì
-    { 12, 23, 9, 0, 23, 69, 14992 }, // í
-    { 12, 23, 9, 0, 23, 69, 15061 }, // î
-    { 12, 22, 9, 0, 22, 66, 15130 }, // ï
-    { 16, 24, 17, 1, 23, 96, 15196 }, // ð
-    { 18, 23, 18, 0, 23, 104, 15292 }, // ñ
-    { 15, 24, 17, 1, 23, 90, 15396 }, // ò
-    { 15, 24, 17, 1, 23, 90, 15486 }, // ó
-    { 15, 24, 17, 1, 23, 90, 15576 }, // ô
-    { 16, 24, 17, 1, 23, 96, 15666 }, // õ
-    { 15, 23, 17, 1, 22, 87, 15762 }, // ö
-    { 15, 15, 17, 1, 18, 57, 15849 }, // ÷
-    { 17, 19, 17, 0, 17, 81, 15906 }, // ø
-    { 17, 24, 18, 1, 23, 102, 15987 }, // ù
-    { 17, 24, 18, 1, 23, 102, 16089 }, // ú
-    { 17, 24, 18, 1, 23, 102, 16191 }, // û
-    { 17, 23, 18, 1, 22, 98, 16293 }, // ü
-    { 20, 30, 15, -3, 23, 150, 16391 }, // ý
-    { 18, 30, 17, -1, 23, 135, 16541 }, // þ
-    { 20, 29, 15, -3, 22, 145, 16676 }, // ÿ
-    { 20, 26, 18, -2, 26, 130, 16821 }, // Ā
-    { 16, 22, 17, 1, 21, 88, 16951 }, // ā
-    { 20, 28, 18, -2, 28, 140, 17039 }, // Ă
-    { 16, 24, 17, 1, 23, 96, 17179 }, // ă
-    { 19, 29, 18, -2, 21, 138, 17275 }, // Ą
-    { 16, 25, 17, 1, 17, 100, 17413 }, // ą
-    { 19, 29, 18, 1, 28, 138, 17513 }, // Ć
-    { 15, 24, 14, 1, 23, 90, 17651 }, // ć
-    { 19, 29, 18, 1, 28, 138, 17741 }, // Ĉ
-    { 15, 24, 14, 1, 23, 90, 17879 }, // ĉ
-    { 19, 29, 18, 1, 28, 138, 17969 }, // Ċ
-    { 14, 24, 14, 1, 23, 84, 18107 }, // ċ
-    { 19, 29, 18, 1, 28, 138, 18191 }, // Č
-    { 16, 24, 14, 1, 23, 96, 18329 }, // č
-    { 20, 28, 20, 0, 28, 140, 18425 }, // Ď
-    { 24, 24, 20, 1, 23, 144, 18565 }, // ď
-    { 19, 21, 20, 0, 21, 100, 18709 }, // Đ
-    { 19, 24, 17, 1, 23, 114, 18809 }, // đ
-    { 17, 26, 16, 0, 26, 111, 18923 }, // Ē
-    { 15, 22, 16, 1, 21, 83, 19034 }, // ē
-    { 18, 28, 16, 0, 28, 126, 19117 }, // Ĕ
-    { 15, 24, 16, 1, 23, 90, 19243 }, // ĕ
-    { 17, 28, 16, 0, 28, 119, 19333 }, // Ė
-    { 15, 24, 16, 1, 23, 90, 19452 }, // ė
-    { 17, 29, 16, 0, 21, 124, 19542 }, // Ę
-    { 15, 24, 16, 1, 17, 90, 19666 }, // ę
-    { 19, 28, 16, 0, 28, 133, 19756 }, // Ě
-    { 17, 24, 16, 1, 23, 102, 19889 }, // ě
-    { 19, 29, 20, 1, 28, 138, 19991 }, // Ĝ
-    { 17, 30, 17, 0, 23, 128, 20129 }, // ĝ
-    { 19, 29, 20, 1, 28, 138, 20257 }, // Ğ
-    { 17, 30, 17, 0, 23, 128, 20395 }, // ğ
-    { 19, 29, 20, 1, 28, 138, 20523 }, // Ġ
-    { 17, 30, 17, 0, 23, 128, 20661 }, // ġ
-    { 19, 29, 20, 1, 22, 138, 20789 }, // Ģ
-    { 17, 30, 17, 0, 23, 128, 20927 }, // ģ
-    { 21, 28, 20, 0, 28, 147, 21055 }, // Ĥ
-    { 17, 29, 18, 0, 29, 124, 21202 }, // ĥ
-    { 23, 21, 20, 0, 21, 121, 21326 }, // Ħ
-    { 16, 23, 18, 0, 23, 92, 21447 }, // ħ
-    { 16, 28, 11, -1, 28, 112, 21539 }, // Ĩ
-    { 13, 23, 9, 0, 23, 75, 21651 }, // ĩ
-    { 15, 26, 11, -1, 26, 98, 21726 }, // Ī
-    { 12, 21, 9, 0, 21, 63, 21824 }, // ī
-    { 16, 28, 11, -1, 28, 112, 21887 }, // Ĭ
-    { 13, 23, 9, 0, 23, 75, 21999 }, // ĭ
-    { 14, 29, 11, -1, 21, 102, 22074 }, // Į
-    { 12, 31, 9, -2, 23, 93, 22176 }, // į
-    { 14, 28, 11, -1, 28, 98, 22269 }, // İ
-    { 9, 16, 9, 0, 16, 36, 22367 }, // ı
-    { 23, 28, 21, -1, 21, 161, 22403 }, // Ĳ
-    { 19, 30, 17, 0, 23, 143, 22564 }, // ĳ
-    { 19, 35, 10, -5, 28, 167, 22707 }, // Ĵ
-    { 16, 30, 9, -4, 23, 120, 22874 }, // ĵ
-    { 21, 28, 18, 0, 21, 147, 22994 }, // Ķ
-    { 18, 30, 17, 0, 23, 135, 23141 }, // ķ
-    { 18, 16, 17, 0, 16, 72, 23276 }, // ĸ
-    { 15, 28, 15, 0, 28, 105, 23348 }, // Ĺ
-    { 14, 29, 9, 0, 29, 102, 23453 }, // ĺ
-    { 14, 28, 15, 0, 21, 98, 23555 }, // Ļ
-    { 12, 30, 9, -2, 23, 90, 23653 }, // ļ
-    { 17, 21, 15, 0, 21, 90, 23743 }, // Ľ
-    { 16, 23, 11, 0, 23, 92, 23833 }, // ľ
-    { 15, 21, 15, 0, 21, 79, 23925 }, // Ŀ
-    { 14, 23, 13, 0, 23, 81, 24004 }, // ŀ
-    { 15, 21, 15, -1, 21, 79, 24085 }, // Ł
-    { 11, 23, 10, 0, 23, 64, 24164 }, // ł
-    { 23, 28, 22, 0, 28, 161, 24228 }, // Ń
-    { 17, 23, 18, 0, 23, 98, 24389 }, // ń
-    { 23, 28, 22, 0, 21, 161, 24487 }, // Ņ
-    { 17, 24, 18, 0, 17, 102, 24648 }, // ņ
-    { 23, 28, 22, 0, 28, 161, 24750 }, // Ň
-    { 18, 23, 18, 0, 23, 104, 24911 }, // ň
-    { 20, 21, 21, 0, 21, 105, 25015 }, // ŉ
-    { 23, 28, 22, 0, 21, 161, 25120 }, // Ŋ
-    { 17, 24, 18, 0, 17, 102, 25281 }, // ŋ
-    { 20, 27, 21, 1, 26, 135, 25383 }, // Ō
-    { 15, 22, 17, 1, 21, 83, 25518 }, // ō
-    { 20, 29, 21, 1, 28, 145, 25601 }, // Ŏ
-    { 16, 24, 17, 1, 23, 96, 25746 }, // ŏ
-    { 22, 29, 21, 1, 28, 160, 25842 }, // Ő
-    { 19, 24, 17, 1, 23, 114, 26002 }, // ő
-    { 27, 23, 26, 1, 22, 156, 26116 }, // Œ
-    { 24, 18, 26, 1, 17, 108, 26272 }, // œ
-    { 18, 28, 18, 0, 28, 126, 26380 }, // Ŕ
-    { 15, 23, 12, 0, 23, 87, 26506 }, // ŕ
-    { 18, 28, 18, 0, 21, 126, 26593 }, // Ŗ
-    { 15, 24, 12, -1, 17, 90, 26719 }, // ŗ
-    { 19, 28, 18, 0, 28, 133, 26809 }, // Ř
-    { 16, 23, 12, 0, 23, 92, 26942 }, // ř
-    { 17, 29, 15, 0, 28, 124, 27034 }, // Ś
-    { 15, 24, 14, 0, 23, 90, 27158 }, // ś
-    { 17, 29, 15, 0, 28, 124, 27248 }, // Ŝ
-    { 15, 24, 14, 0, 23, 90, 27372 }, // ŝ
-    { 16, 29, 15, 0, 22, 116, 27462 }, // Ş
-    { 14, 24, 14, 0, 17, 84, 27578 }, // ş
-    { 18, 29, 15, 0, 28, 131, 27662 }, // Š
-    { 16, 24, 14, 0, 23, 96, 27793 }, // š
-    { 16, 28, 16, 2, 21, 112, 27889 }, // Ţ
-    { 12, 27, 12, 1, 20, 81, 28001 }, // ţ
-    { 16, 28, 16, 2, 28, 112, 28082 }, // Ť
-    { 15, 24, 12, 1, 23, 90, 28194 }, // ť
-    { 16, 21, 16, 2, 21, 84, 28284 }, // Ŧ
-    { 13, 21, 12, 0, 20, 69, 28368 }, // ŧ
-    { 20, 29, 20, 1, 28, 145, 28437 }, // Ũ
-    { 17, 24, 18, 1, 23, 102, 28582 }, // ũ
-    { 20, 27, 20, 1, 26, 135, 28684 }, // Ū
-    { 17, 22, 18, 1, 21, 94, 28819 }, // ū
-    { 20, 29, 20, 1, 28, 145, 28913 }, // Ŭ
-    { 17, 24, 18, 1, 23, 102, 29058 }, // ŭ
-    { 20, 31, 20, 1, 30, 155, 29160 }, // Ů
-    { 17, 26, 18, 1, 25, 111, 29315 }, // ů
-    { 21, 29, 20, 1, 28, 153, 29426 }, // Ű
-    { 19, 24, 18, 1, 23, 114, 29579 }, // ű
-    { 20, 29, 20, 1, 21, 145, 29693 }, // Ų
-    { 17, 24, 18, 1, 16, 102, 29838 }, // ų
-    { 27, 28, 26, 2, 28, 189, 29940 }, // Ŵ
-    { 24, 23, 23, 1, 23, 138, 30129 }, // ŵ
-    { 18, 28, 16, 2, 28, 126, 30267 }, // Ŷ
-    { 20, 30, 15, -3, 23, 150, 30393 }, // ŷ
-    { 18, 27, 16, 2, 27, 122, 30543 }, // Ÿ
-    { 19, 28, 16, -1, 28, 133, 30665 }, // Ź
-    { 16, 23, 14, -1, 23, 92, 30798 }, // ź
-    { 19, 28, 16, -1, 28, 133, 30890 }, // Ż
-    { 15, 23, 14, -1, 23, 87, 31023 }, // ż
-    { 19, 28, 16, -1, 28, 133, 31110 }, // Ž
-    { 17, 23, 14, -1, 23, 98, 31243 }, // ž
-    { 18, 30, 10, -4, 23, 135, 31341 }, // ſ
-    { 8, 6, 0, -13, 23, 12, 31476 }, // ̀
-    { 9, 6, 0, -7, 23, 14, 31488 }, // ́
-    { 12, 6, 0, -4, 23, 18, 31502 }, // ̂
-    { 13, 6, 0, -13, 23, 20, 31520 }, // ̃
-    { 10, 4, 0, -3, 21, 10, 31540 }, // ̄
-    { 14, 4, 0, -4, 25, 14, 31550 }, // ̅
-    { 11, 6, 0, -3, 23, 17, 31564 }, // ̆
-    { 5, 6, 0, 0, 23, 8, 31581 }, // ̇
-    { 11, 4, 0, -3, 22, 11, 31589 }, // ̈
-    { 7, 8, 0, -9, 25, 14, 31600 }, // ̉
-    { 8, 8, 0, -1, 25, 16, 31614 }, // ̊
-    { 14, 6, 0, -3, 23, 21, 31630 }, // ̋
-    { 12, 6, 0, -3, 23, 18, 31651 }, // ̌
-    { 5, 9, 0, 0, 23, 12, 31669 }, // ̍
-    { 10, 6, 0, -2, 23, 15, 31681 }, // ̎
-    { 12, 6, 0, -14, 23, 18, 31696 }, // ̏
-    { 11, 8, 0, -3, 25, 22, 31714 }, // ̐
-    { 11, 6, 0, -3, 23, 17, 31736 }, // ̑
-    { 8, 8, 0, -2, 21, 16, 31753 }, // ̒
-    { 8, 8, 0, -2, 21, 16, 31769 }, // ̓
-    { 5, 8, 0, 0, 21, 10, 31785 }, // ̔
-    { 8, 8, 0, -2, 21, 16, 31795 }, // ̕
-    { 7, 6, 0, -6, -1, 11, 31811 }, // ̖
-    { 9, 6, 0, -7, -1, 14, 31822 }, // ̗
-    { 7, 7, 0, -6, 0, 13, 31836 }, // ̘
-    { 7, 7, 0, -6, 0, 13, 31849 }, // ̙
-    { 10, 9, 9, 2, 23, 23, 31862 }, // ̚
-    { 9, 8, 0, -2, 23, 18, 31885 }, // ̛
-    { 5, 7, 0, -2, 0, 9, 31903 }, // ̜
-    { 7, 6, 0, -6, -1, 11, 31912 }, // ̝
-    { 8, 6, 0, -6, -1, 12, 31923 }, // ̞
-    { 7, 7, 0, -6, 0, 13, 31935 }, // ̟
-    { 7, 3, 0, -6, -3, 6, 31948 }, // ̠
-    { 9, 9, 0, -7, 2, 21, 31954 }, // ̡
-    { 8, 9, 0, -4, 2, 18, 31975 }, // ̢
-    { 6, 6, 0, -14, -1, 9, 31993 }, // ̣
-    { 11, 4, 0, -8, -2, 11, 32002 }, // ̤
-    { 8, 8, 0, -6, 0, 16, 32013 }, // ̥
-    { 7, 6, 0, 1, -1, 11, 32029 }, // ̦
-    { 8, 7, 0, -6, 0, 14, 32040 }, // ̧
-    { 7, 8, 0, -6, 0, 14, 32054 }, // ̨
-    { 6, 9, 0, -5, 0, 14, 32068 }, // ̩
-    { 13, 6, 0, -9, -1, 20, 32082 }, // ̪
-    { 12, 5, 0, -8, -1, 15, 32102 }, // ̫
-    { 13, 6, 0, -8, -1, 20, 32117 }, // ̬
-    { 13, 6, 0, -9, -1, 20, 32137 }, // ̭
-    { 12, 6, 0, -8, -1, 18, 32157 }, // ̮
-    { 11, 6, 0, -8, -1, 17, 32175 }, // ̯
-    { 13, 6, 0, -9, -1, 20, 32192 }, // ̰
-    { 11, 4, 0, -8, -2, 11, 32212 }, // ̱
-    { 14, 3, 0, -9, -2, 11, 32223 }, // ̲
-    { 14, 7, 0, -10, 0, 25, 32234 }, // ̳
-    { 13, 6, 0, -7, 11, 20, 32259 }, // ̴
-    { 13, 4, 0, -7, 10, 13, 32279 }, // ̵
-    { 22, 4, 0, -11, 10, 22, 32292 }, // ̶
-    { 12, 9, 0, -6, 13, 27, 32314 }, // ̷
-    { 18, 25, 0, -9, 23, 113, 32341 }, // ̸
-    { 6, 7, 0, -3, 0, 11, 32454 }, // ̹
-    { 12, 6, 0, -8, -1, 18, 32465 }, // ̺
-    { 12, 7, 0, -8, 0, 21, 32483 }, // ̻
-    { 12, 5, 0, -8, -1, 15, 32504 }, // ̼
-    { 8, 7, 0, -1, 23, 14, 32519 }, // ̽
-    { 7, 10, 0, -1, 26, 18, 32533 }, // ̾
-    { 14, 7, 0, -4, 29, 25, 32551 }, // ̿
-    { 7, 6, 0, -3, 23, 11, 32576 }, // ̀
-    { 8, 6, 0, 0, 23, 12, 32587 }, // ́
-    { 13, 6, 0, 4, 23, 20, 32599 }, // ͂
-    { 6, 6, 0, 0, 23, 9, 32619 }, // ̓
-    { 17, 6, 0, -5, 23, 26, 32628 }, // ̈́
-    { 6, 6, 0, -4, -1, 9, 32654 }, // ͅ
-    { 13, 6, 0, -4, 23, 20, 32663 }, // ͆
-    { 14, 7, 0, -10, 0, 25, 32683 }, // ͇
-    { 10, 6, 0, -7, 0, 15, 32708 }, // ͈
-    { 6, 6, 0, -5, -1, 9, 32723 }, // ͉
-    { 11, 7, 0, -3, 23, 20, 32732 }, // ͊
-    { 12, 12, 0, -3, 28, 36, 32752 }, // ͋
-    { 12, 9, 0, -3, 26, 27, 32788 }, // ͌
-    { 11, 6, 0, -8, -1, 17, 32815 }, // ͍
-    { 6, 7, 0, -5, 0, 11, 32832 }, // ͎
-    { 22, 21, 0, -11, 21, 116, 32843 }, // ͏
-    { 5, 7, 0, 0, 24, 9, 32959 }, // ͐
-    { 6, 7, 0, 3, 25, 11, 32968 }, // ͑
-    { 11, 8, 0, -3, 25, 22, 32979 }, // ͒
-    { 7, 7, 0, -5, 0, 13, 33001 }, // ͓
-    { 6, 6, 0, -5, -1, 9, 33014 }, // ͔
-    { 6, 6, 0, -4, -1, 9, 33023 }, // ͕
-    { 12, 6, 0, -7, -1, 18, 33032 }, // ͖
-    { 6, 7, 0, 2, 24, 11, 33050 }, // ͗
-    { 5, 6, 0, 0, 23, 8, 33061 }, // ͘
-    { 7, 6, 0, -6, -1, 11, 33069 }, // ͙
-    { 12, 7, 0, -8, 0, 21, 33080 }, // ͚
-    { 6, 6, 0, 0, 23, 9, 33101 }, // ͛
-    { 23, 6, 0, -13, -1, 35, 33110 }, // ͜
-    { 23, 6, 0, -9, 23, 35, 33145 }, // ͝
-    { 17, 4, 0, -6, 21, 17, 33180 }, // ͞
-    { 16, 4, 0, -10, -1, 16, 33197 }, // ͟
-    { 24, 6, 0, -9, 23, 36, 33213 }, // ͠
-    { 23, 7, 0, -8, 26, 41, 33249 }, // ͡
-    { 24, 7, 0, -15, 0, 42, 33290 }, // ͢
-    { 8, 8, 0, -1, 25, 16, 33332 }, // ͣ
-    { 8, 8, 0, -1, 25, 16, 33348 }, // ͤ
-    { 5, 9, 0, 1, 27, 12, 33364 }, // ͥ
-    { 8, 8, 0, -1, 25, 16, 33376 }, // ͦ
-    { 8, 8, 0, -1, 25, 16, 33392 }, // ͧ
-    { 7, 8, 0, 0, 25, 14, 33408 }, // ͨ
-    { 9, 10, 0, -1, 27, 23, 33422 }, // ͩ
-    { 8, 9, 0, -1, 27, 18, 33445 }, // ͪ
-    { 12, 7, 0, -3, 25, 21, 33463 }, // ͫ
-    { 7, 7, 0, 0, 25, 13, 33484 }, // ͬ
-    { 6, 9, 0, 0, 26, 14, 33497 }, // ͭ
-    { 7, 7, 0, 0, 25, 13, 33511 }, // ͮ
-    { 9, 7, 0, -2, 25, 16, 33524 }, // ͯ
-    { 17, 28, 15, 0, 28, 119, 33540 }, // Ѐ
-    { 17, 28, 15, 0, 28, 119, 33659 }, // Ё
-    { 18, 22, 21, 2, 21, 99, 33778 }, // Ђ
-    { 18, 28, 15, 0, 28, 126, 33877 }, // Ѓ
-    { 18, 23, 18, 1, 22, 104, 34003 }, // Є
-    { 16, 23, 15, 0, 22, 92, 34107 }, // Ѕ
-    { 10, 21, 9, 0, 21, 53, 34199 }, // І
-    { 13, 28, 9, 0, 28, 91, 34252 }, // Ї
-    { 15, 28, 9, -5, 21, 105, 34343 }, // Ј
-    { 30, 22, 28, -2, 21, 165, 34448 }, // Љ
-    { 27, 21, 27, 0, 21, 142, 34613 }, // Њ
-    { 18, 21, 21, 2, 21, 95, 34755 }, // Ћ
-    { 21, 28, 18, 0, 28, 147, 34850 }, // Ќ
-    { 21, 28, 20, 0, 28, 147, 34997 }, // Ѝ
-    { 21, 29, 17, 0, 28, 153, 35144 }, // Ў
-    { 21, 26, 20, 0, 21, 137, 35297 }, // Џ
-    { 19, 21, 18, -2, 21, 100, 35434 }, // А
-    { 17, 21, 17, 0, 21, 90, 35534 }, // Б
-    { 19, 21, 18, 0, 21, 100, 35624 }, // В
-    { 17, 21, 15, 0, 21, 90, 35724 }, // Г
-    { 24, 26, 21, -3, 21, 156, 35814 }, // Д
-    { 17, 21, 15, 0, 21, 90, 35970 }, // Е
-    { 31, 21, 26, -2, 21, 163, 36060 }, // Ж
-    { 17, 23, 17, 0, 22, 98, 36223 }, // З
-    { 21, 21, 20, 0, 21, 111, 36321 }, // И
-    { 21, 28, 20, 0, 28, 147, 36432 }, // Й
-    { 21, 21, 18, 0, 21, 111, 36579 }, // К
-    { 22, 22, 20, -1, 21, 121, 36690 }, // Л
-    { 26, 21, 25, 0, 21, 137, 36811 }, // М
-    { 21, 21, 20, 0, 21, 111, 36948 }, // Н
-    { 20, 23, 21, 1, 22, 115, 37059 }, // О
-    { 21, 21, 20, 0, 21, 111, 37174 }, // П
-    { 18, 21, 17, 0, 21, 95, 37285 }, // Р
-    { 18, 23, 17, 1, 22, 104, 37380 }, // С
-    { 16, 21, 15, 2, 21, 84, 37484 }, // Т
-    { 21, 22, 17, 0, 21, 116, 37568 }, // У
-    { 25, 23, 26, 1, 22, 144, 37684 }, // Ф
-    { 23, 21, 18, -2, 21, 121, 37828 }, // Х
-    { 21, 26, 20, 0, 21, 137, 37949 }, // Ц
-    { 18, 21, 19, 2, 21, 95, 38086 }, // Ч
-    { 30, 21, 29, 0, 21, 158, 38181 }, // Ш
-    { 29, 26, 29, 0, 21, 189, 38339 }, // Щ
-    { 18, 21, 20, 2, 21, 95, 38528 }, // Ъ
-    { 26, 21, 26, 0, 21, 137, 38623 }, // Ы
-    { 17, 21, 17, 0, 21, 90, 38760 }, // Ь
-    { 18, 23, 18, 0, 22, 104, 38850 }, // Э
-    { 29, 23, 29, 0, 22, 167, 38954 }, // Ю
-    { 21, 21, 18, -2, 21, 111, 39121 }, // Я
-    { 17, 18, 17, 0, 17, 77, 39232 }, // а
-    { 16, 24, 16, 1, 23, 96, 39309 }, // б
-    { 16, 18, 16, 0, 17, 72, 39405 }, // в
-    { 15, 18, 14, -1, 17, 68, 39477 }, // г
-    { 17, 24, 17, 0, 23, 102, 39545 }, // д
-    { 16, 18, 15, 0, 17, 72, 39647 }, // е
-    { 30, 18, 28, -1, 17, 135, 39719 }, // ж
-    { 14, 18, 15, 0, 17, 63, 39854 }, // з
-    { 16, 17, 17, 1, 16, 68, 39917 }, // и
-    { 16, 24, 17, 1, 23, 96, 39985 }, // й
-    { 18, 16, 16, 0, 16, 72, 40081 }, // к
-    { 19, 17, 18, -1, 16, 81, 40153 }, // л
-    { 23, 16, 23, 0, 16, 92, 40234 }, // м
-    { 17, 16, 17, 0, 16, 68, 40326 }, // н
-    { 16, 18, 17, 0, 17, 72, 40394 }, // о
-    { 16, 17, 17, 0, 17, 68, 40466 }, // п
-    { 18, 24, 18, -1, 17, 108, 40534 }, // р
-    { 14, 18, 14, 0, 17, 63, 40642 }, // с
-    { 25, 17, 26, 0, 17, 107, 40705 }, // т
-    { 19, 23, 16, -2, 16, 110, 40812 }, // у
-    { 21, 30, 22, 0, 23, 158, 40922 }, // ф
-    { 19, 16, 15, -2, 16, 76, 41080 }, // х
-    { 16, 20, 18, 1, 16, 80, 41156 }, // ц
-    { 15, 16, 17, 2, 16, 60, 41236 }, // ч
-    { 25, 17, 26, 1, 16, 107, 41296 }, // ш
-    { 25, 20, 27, 1, 16, 125, 41403 }, // щ
-    { 17, 17, 18, 1, 16, 73, 41528 }, // ъ
-    { 23, 17, 23, 0, 16, 98, 41601 }, // ы
-    { 16, 17, 16, 0, 16, 68, 41699 }, // ь
-    { 13, 18, 14, 0, 17, 59, 41767 }, // э
-    { 23, 18, 24, 0, 17, 104, 41826 }, // ю
-    { 18, 16, 16, -2, 16, 72, 41930 }, // я
-    { 16, 24, 15, 0, 23, 96, 42002 }, // ѐ
-    { 16, 23, 15, 0, 22, 92, 42098 }, // ё
-    { 16, 30, 17, 0, 23, 120, 42190 }, // ђ
-    { 16, 24, 14, -1, 23, 96, 42310 }, // ѓ
-    { 14, 18, 14, 0, 17, 63, 42406 }, // є
-    { 14, 18, 13, 0, 17, 63, 42469 }, // ѕ
-    { 10, 23, 8, 0, 23, 58, 42532 }, // і
-    { 11, 23, 8, 0, 23, 64, 42590 }, // ї
-    { 14, 30, 8, -4, 23, 105, 42654 }, // ј
-    { 26, 17, 25, -1, 16, 111, 42759 }, // љ
-    { 24, 17, 24, 0, 16, 102, 42870 }, // њ
-    { 16, 23, 17, 0, 23, 92, 42972 }, // ћ
-    { 18, 23, 16, 0, 23, 104, 43064 }, // ќ
-    { 16, 24, 17, 1, 23, 96, 43168 }, // ѝ
-    { 19, 30, 16, -2, 23, 143, 43264 }, // ў
-    { 16, 22, 17, 1, 16, 88, 43407 }, // џ
-    { 27, 21, 26, 2, 21, 142, 43495 }, // Ѡ
-    { 24, 16, 24, 1, 16, 96, 43637 }, // ѡ
-    { 16, 21, 18, 1, 21, 84, 43733 }, // Ѣ
-    { 24, 18, 25, 0, 17, 108, 43817 }, // ѣ
-    { 28, 23, 26, 0, 22, 161, 43925 }, // Ѥ
-    { 23, 18, 22, 0, 17, 104, 44086 }, // ѥ
-    { 20, 21, 20, -2, 21, 105, 44190 }, // Ѧ
-    { 18, 16, 17, -2, 16, 72, 44295 }, // ѧ
-    { 26, 21, 27, 0, 21, 137, 44367 }, // Ѩ
-    { 23, 16, 24, 0, 16, 92, 44504 }, // ѩ
-    { 24, 21, 21, -2, 21, 126, 44596 }, // Ѫ
-    { 20, 16, 17, -2, 16, 80, 44722 }, // ѫ
-    { 30, 21, 29, 0, 21, 158, 44802 }, // Ѭ
-    { 25, 16, 24, 0, 16, 100, 44960 }, // ѭ
-    { 20, 33, 17, -2, 26, 165, 45060 }, // Ѯ
-    { 18, 27, 15, -2, 20, 122, 45225 }, // ѯ
-    { 23, 21, 24, 3, 21, 121, 45347 }, // Ѱ
-    { 22, 30, 24, 1, 23, 165, 45468 }, // ѱ
-    { 20, 23, 21, 1, 22, 115, 45633 }, // Ѳ
-    { 15, 18, 17, 1, 17, 68, 45748 }, // ѳ
-    { 19, 21, 19, 2, 21, 100, 45816 }, // Ѵ
-    { 16, 17, 16, 1, 17, 68, 45916 }, // ѵ
-    { 19, 28, 19, 2, 28, 133, 45984 }, // Ѷ
-    { 16, 23, 16, 1, 23, 92, 46117 }, // ѷ
-    { 37, 29, 36, 1, 22, 269, 46209 }, // Ѹ
-    { 33, 24, 32, 1, 17, 198, 46478 }, // ѹ
-    { 21, 25, 22, 1, 23, 132, 46676 }, // Ѻ
-    { 17, 20, 18, 1, 18, 85, 46808 }, // ѻ
-    { 28, 32, 30, 1, 31, 224, 46893 }, // Ѽ
-    { 23, 27, 25, 1, 26, 156, 47117 }, // ѽ
-    { 27, 27, 26, 2, 27, 183, 47273 }, // Ѿ
-    { 24, 22, 24, 1, 22, 132, 47456 }, // ѿ
-    { 19, 29, 18, 1, 22, 138, 47588 }, // Ҁ
-    { 14, 24, 14, 1, 17, 84, 47726 }, // ҁ
-    { 16, 20, 18, 1, 19, 80, 47810 }, // ҂
-    { 12, 6, 0, -12, 22, 18, 47890 }, // ҃
-    { 12, 6, 0, -12, 23, 18, 47908 }, // ҄
-    { 5, 7, 0, -8, 24, 9, 47926 }, // ҅
-    { 6, 7, 0, -9, 24, 11, 47935 }, // ҆
-    { 13, 5, 0, -3, 27, 17, 47946 }, // ҇
-    { 34, 31, 0, -17, 23, 264, 47963 }, // ҈
-    { 34, 33, 0, -17, 24, 281, 48227 }, // ҉
-    { 23, 35, 24, 0, 28, 202, 48508 }, // Ҋ
-    { 18, 29, 18, 1, 23, 131, 48710 }, // ҋ
-    { 16, 21, 17, 0, 21, 84, 48841 }, // Ҍ
-    { 14, 24, 17, 1, 23, 84, 48925 }, // ҍ
-    { 18, 21, 18, 0, 21, 95, 49009 }, // Ҏ
-    { 18, 24, 17, -1, 17, 108, 49104 }, // ҏ
-    { 18, 26, 15, 0, 26, 117, 49212 }, // Ґ
-    { 16, 21, 13, 0, 21, 84, 49329 }, // ґ
-    { 17, 21, 15, 0, 21, 90, 49413 }, // Ғ
-    { 16, 16, 14, -1, 16, 64, 49503 }, // ғ
-    { 17, 29, 19, 0, 21, 124, 49567 }, // Ҕ
-    { 15, 24, 17, 0, 16, 90, 49691 }, // ҕ
-    { 30, 28, 27, -2, 21, 210, 49781 }, // Җ
-    { 30, 23, 28, -1, 17, 173, 49991 }, // җ
-    { 17, 30, 17, 0, 22, 128, 50164 }, // Ҙ
-    { 14, 25, 15, 0, 17, 88, 50292 }, // ҙ
-    { 21, 28, 20, 0, 21, 147, 50380 }, // Қ
-    { 18, 22, 18, 0, 16, 99, 50527 }, // қ
-    { 21, 21, 18, 0, 21, 111, 50626 }, // Ҝ
-    { 18, 16, 17, 1, 16, 72, 50737 }, // ҝ
-    { 21, 21, 18, 0, 21, 111, 50809 }, // Ҟ
-    { 18, 23, 17, 0, 23, 104, 50920 }, // ҟ
-    { 21, 21, 20, 2, 21, 111, 51024 }, // Ҡ
-    { 20, 16, 19, 1, 16, 80, 51135 }, // ҡ
-    { 21, 28, 22, 0, 21, 147, 51215 }, // Ң
-    { 19, 22, 20, 0, 16, 105, 51362 }, // ң
-    { 25, 21, 22, 0, 21, 132, 51467 }, // Ҥ
-    { 23, 16, 21, 0, 16, 92, 51599 }, // ҥ
-    { 28, 29, 30, 0, 21, 203, 51691 }, // Ҧ
-    { 23, 24, 25, 0, 16, 138, 51894 }, // ҧ
-    { 20, 24, 21, 1, 22, 120, 52032 }, // Ҩ
-    { 16, 19, 18, 1, 17, 76, 52152 }, // ҩ
-    { 19, 30, 18, 1, 22, 143, 52228 }, // Ҫ
-    { 14, 25, 14, 1, 17, 88, 52371 }, // ҫ
-    { 16, 28, 15, 2, 21, 112, 52459 }, // Ҭ
-    { 26, 23, 27, 0, 17, 150, 52571 }, // ҭ
-    { 18, 21, 16, 2, 21, 95, 52721 }, // Ү
-    { 16, 23, 15, 1, 16, 92, 52816 }, // ү
-    { 19, 21, 16, 1, 21, 100, 52908 }, // Ұ
-    { 18, 23, 15, -1, 16, 104, 53008 }, // ұ
-    { 22, 28, 20, -2, 21, 154, 53112 }, // Ҳ
-    { 20, 22, 17, -2, 16, 110, 53266 }, // ҳ
-    { 22, 28, 24, 2, 21, 154, 53376 }, // Ҵ
-    { 18, 22, 20, 1, 16, 99, 53530 }, // ҵ
-    { 19, 28, 22, 2, 21, 133, 53629 }, // Ҷ
-    { 16, 22, 19, 2, 16, 88, 53762 }, // ҷ
-    { 18, 21, 20, 2, 21, 95, 53850 }, // Ҹ
-    { 16, 16, 18, 2, 16, 64, 53945 }, // ҹ
-    { 18, 21, 20, 0, 21, 95, 54009 }, // Һ
-    { 17, 23, 18, 0, 23, 98, 54104 }, // һ
-    { 23, 23, 23, 0, 22, 133, 54202 }, // Ҽ
-    { 19, 18, 19, 0, 17, 86, 54335 }, // ҽ
-    { 23, 29, 23, 0, 22, 167, 54421 }, // Ҿ
-    { 19, 23, 19, 0, 17, 110, 54588 }, // ҿ
-    { 14, 21, 11, -1, 21, 74, 54698 }, // Ӏ
-    { 31, 28, 26, -2, 28, 217, 54772 }, // Ӂ
-    { 30, 24, 28, -1, 23, 180, 54989 }, // ӂ
-    { 21, 29, 20, 0, 21, 153, 55169 }, // Ӄ
-    { 18, 24, 18, 0, 16, 108, 55322 }, // ӄ
-    { 23, 28, 22, -1, 21, 161, 55430 }, // Ӆ
-    { 20, 23, 19, -1, 17, 115, 55591 }, // ӆ
-    { 21, 29, 20, 0, 21, 153, 55706 }, // Ӈ
-    { 18, 24, 18, 0, 16, 108, 55859 }, // ӈ
-    { 22, 28, 22, 0, 21, 154, 55967 }, // Ӊ
-    { 19, 22, 20, 0, 16, 105, 56121 }, // ӊ
-    { 18, 28, 20, 2, 21, 126, 56226 }, // Ӌ
-    { 15, 22, 17, 2, 16, 83, 56352 }, // ӌ
-    { 27, 28, 28, 0, 21, 189, 56435 }, // Ӎ
-    { 24, 22, 24, 0, 16, 132, 56624 }, // ӎ
-    { 14, 21, 11, -1, 21, 74, 56756 }, // ӏ
-    { 21, 28, 18, -2, 28, 147, 56830 }, // Ӑ
-    { 16, 24, 17, 1, 23, 96, 56977 }, // ӑ
-    { 20, 27, 18, -2, 27, 135, 57073 }, // Ӓ
-    { 16, 23, 17, 1, 22, 92, 57208 }, // ӓ
-    { 30, 21, 26, -2, 21, 158, 57300 }, // Ӕ
-    { 24, 18, 25, 1, 17, 108, 57458 }, // ӕ
-    { 18, 28, 16, 0, 28, 126, 57566 }, // Ӗ
-    { 17, 24, 16, 1, 23, 102, 57692 }, // ӗ
-    { 19, 23, 19, 0, 22, 110, 57794 }, // Ә
-    { 15, 18, 16, 0, 17, 68, 57904 }, // ә
-    { 19, 28, 19, 0, 27, 133, 57972 }, // Ӛ
-    { 15, 23, 16, 0, 22, 87, 58105 }, // ӛ
-    { 31, 27, 26, -2, 27, 210, 58192 }, // Ӝ
-    { 30, 23, 28, -1, 22, 173, 58402 }, // ӝ
-    { 17, 28, 17, 0, 27, 119, 58575 }, // Ӟ
-    { 15, 23, 15, 0, 22, 87, 58694 }, // ӟ
-    { 18, 22, 16, -1, 21, 99, 58781 }, // Ӡ
-    { 18, 24, 16, -2, 16, 108, 58880 }, // ӡ
-    { 21, 26, 20, 0, 26, 137, 58988 }, // Ӣ
-    { 17, 22, 18, 1, 21, 94, 59125 }, // ӣ
-    { 21, 27, 20, 0, 27, 142, 59219 }, // Ӥ
-    { 17, 23, 18, 1, 22, 98, 59361 }, // ӥ
-    { 20, 28, 21, 1, 27, 140, 59459 }, // Ӧ
-    { 15, 23, 17, 1, 22, 87, 59599 }, // ӧ
-    { 20, 23, 21, 1, 22, 115, 59686 }, // Ө
-    { 15, 18, 17, 1, 17, 68, 59801 }, // ө
-    { 20, 28, 21, 1, 27, 140, 59869 }, // Ӫ
-    { 15, 23, 17, 1, 22, 87, 60009 }, // ӫ
-    { 18, 28, 18, 0, 27, 126, 60096 }, // Ӭ
-    { 14, 23, 14, 0, 22, 81, 60222 }, // ӭ
-    { 21, 27, 17, 0, 26, 142, 60303 }, // Ӯ
-    { 20, 28, 15, -3, 21, 140, 60445 }, // ӯ
-    { 21, 28, 17, 0, 27, 147, 60585 }, // Ӱ
-    { 20, 29, 15, -3, 22, 145, 60732 }, // ӱ
-    { 21, 29, 17, 0, 28, 153, 60877 }, // Ӳ
-    { 21, 30, 15, -3, 23, 158, 61030 }, // ӳ
-    { 18, 27, 19, 2, 27, 122, 61188 }, // Ӵ
-    { 15, 22, 17, 2, 22, 83, 61310 }, // ӵ
-    { 17, 28, 15, 0, 21, 119, 61393 }, // Ӷ
-    { 15, 22, 14, 0, 16, 83, 61512 }, // ӷ
-    { 26, 27, 26, 0, 27, 176, 61595 }, // Ӹ
-    { 23, 23, 23, 0, 22, 133, 61771 }, // ӹ
-    { 17, 29, 15, 0, 21, 124, 61904 }, // Ӻ
-    { 16, 24, 14, -1, 16, 96, 62028 }, // ӻ
-    { 22, 29, 20, -2, 21, 160, 62124 }, // Ӽ
-    { 19, 24, 17, -2, 16, 114, 62284 }, // ӽ
-    { 23, 21, 18, -2, 21, 121, 62398 }, // Ӿ
-    { 19, 16, 15, -2, 16, 76, 62519 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 62595 }, //  
-    { 0, 0, 29, 0, 0, 0, 62595 }, //  
-    { 0, 0, 15, 0, 0, 0, 62595 }, //  
-    { 0, 0, 29, 0, 0, 0, 62595 }, //  
-    { 0, 0, 10, 0, 0, 0, 62595 }, //  
-    { 0, 0, 7, 0, 0, 0, 62595 }, //  
-    { 0, 0, 5, 0, 0, 0, 62595 }, //  
-    { 0, 0, 16, 0, 0, 0, 62595 }, //  
-    { 0, 0, 8, 0, 0, 0, 62595 }, //  
-    { 0, 0, 5, 0, 0, 0, 62595 }, //  
-    { 0, 0, 3, 0, 0, 0, 62595 }, //  
-    { 0, 0, 0, 0, 0, 0, 62595 }, // ​
-    { 0, 0, 0, 0, 0, 0, 62595 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 62595 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 62595 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 62645 }, // ‏
-    { 9, 4, 9, 0, 10, 9, 62695 }, // ‐
-    { 9, 4, 9, 0, 10, 9, 62704 }, // ‑
-    { 15, 4, 16, 1, 12, 15, 62713 }, // ‒
-    { 14, 4, 14, 0, 10, 14, 62728 }, // –
-    { 28, 4, 28, 0, 10, 28, 62742 }, // —
-    { 28, 4, 28, 0, 10, 28, 62770 }, // ―
-    { 12, 30, 16, 2, 23, 90, 62798 }, // ‖
-    { 14, 7, 12, -4, 0, 25, 62888 }, // ‗
-    { 8, 8, 6, 1, 21, 16, 62913 }, // ‘
-    { 8, 8, 6, 1, 21, 16, 62929 }, // ’
-    { 8, 8, 8, -2, 4, 16, 62945 }, // ‚
-    { 5, 8, 6, 3, 21, 10, 62961 }, // ‛
-    { 14, 8, 13, 1, 21, 28, 62971 }, // “
-    { 14, 8, 13, 1, 21, 28, 62999 }, // ”
-    { 14, 8, 15, -2, 4, 28, 63027 }, // „
-    { 11, 8, 13, 3, 21, 22, 63055 }, // ‟
-    { 13, 23, 15, 2, 23, 75, 63077 }, // †
-    { 16, 23, 15, 0, 23, 92, 63152 }, // ‡
-    { 10, 10, 11, 1, 16, 25, 63244 }, // •
-    { 10, 12, 10, 1, 17, 30, 63269 }, // ‣
-    { 6, 6, 15, 3, 5, 9, 63299 }, // ․
-    { 14, 6, 17, 0, 5, 21, 63308 }, // ‥
-    { 22, 6, 24, 0, 5, 33, 63329 }, // …
-    { 6, 6, 9, 2, 11, 9, 63362 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 63371 }, //  
-    { 0, 0, 18, 0, 0, 0, 63371 }, //  
-    { 8, 22, 0, -1, 18, 44, 63371 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 63415 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 63459 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 63509 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 63559 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 63609 }, //  
-    { 34, 23, 36, 1, 22, 196, 63609 }, // ‰
-    { 45, 23, 46, 1, 22, 259, 63805 }, // ‱
-    { 10, 8, 8, 1, 21, 20, 64064 }, // ′
-    { 16, 8, 15, 1, 21, 32, 64084 }, // ″
-    { 23, 8, 22, 1, 21, 46, 64116 }, // ‴
-    { 8, 8, 8, 2, 21, 16, 64162 }, // ‵
-    { 14, 8, 15, 2, 21, 28, 64178 }, // ‶
-    { 21, 8, 22, 2, 21, 42, 64206 }, // ‷
-    { 11, 10, 10, -3, 3, 28, 64248 }, // ‸
-    { 9, 14, 10, 1, 15, 32, 64276 }, // ‹
-    { 9, 14, 9, 0, 15, 32, 64308 }, // ›
-    { 24, 23, 25, 0, 22, 138, 64340 }, // ※
-    { 18, 22, 16, 0, 21, 99, 64478 }, // ‼
-    { 13, 23, 13, 2, 22, 75, 64577 }, // ‽
-    { 15, 4, 12, 2, 26, 15, 64652 }, // ‾
-    { 16, 7, 16, -2, 0, 28, 64667 }, // ‿
-    { 16, 8, 16, 2, 24, 32, 64695 }, // ⁀
-    { 15, 19, 11, -3, 12, 72, 64727 }, // ⁁
-    { 33, 27, 34, -1, 23, 223, 64799 }, // ⁂
-    { 9, 5, 9, 0, 10, 12, 65022 }, // ⁃
-    { 20, 21, 4, -8, 21, 105, 65034 }, // ⁄
-    { 13, 26, 10, -1, 21, 85, 65139 }, // ⁅
-    { 13, 26, 10, -2, 21, 85, 65224 }, // ⁆
-    { 26, 23, 26, 2, 22, 150, 65309 }, // ⁇
-    { 21, 23, 22, 2, 22, 121, 65459 }, // ⁈
-    { 23, 23, 22, 0, 22, 133, 65580 }, // ⁉
-    { 15, 16, 16, 1, 16, 60, 65713 }, // ⁊
-    { 16, 27, 18, 2, 23, 108, 65773 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 65881 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 65941 }, // ⁍
-    { 15, 15, 16, -1, 8, 57, 66001 }, // ⁎
-    { 8, 21, 8, 1, 17, 42, 66058 }, // ⁏
-    { 20, 31, 16, -2, 24, 155, 66100 }, // ⁐
-    { 18, 30, 16, -1, 23, 135, 66255 }, // ⁑
-    { 13, 23, 12, 0, 22, 75, 66390 }, // ⁒
-    { 28, 7, 29, 1, 12, 49, 66465 }, // ⁓
-    { 16, 7, 16, -3, 0, 28, 66514 }, // ⁔
-    { 16, 16, 17, 0, 15, 64, 66542 }, // ⁕
-    { 14, 23, 16, 1, 22, 81, 66606 }, // ⁖
-    { 27, 8, 26, 1, 21, 54, 66687 }, // ⁗
-    { 23, 23, 25, 1, 22, 133, 66741 }, // ⁘
-    { 23, 23, 25, 1, 22, 133, 66874 }, // ⁙
-    { 6, 23, 8, 1, 22, 35, 67007 }, // ⁚
-    { 19, 24, 21, 1, 23, 114, 67042 }, // ⁛
-    { 24, 23, 24, 0, 22, 138, 67156 }, // ⁜
-    { 6, 24, 8, 1, 23, 36, 67294 }, // ⁝
-    { 5, 23, 8, 2, 22, 29, 67330 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 67359 }, //  
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁤
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁦
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁧
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁨
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 67359 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 67409 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 67459 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 67509 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 67559 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 67609 }, // ⁯
-    { 11, 14, 11, 2, 25, 39, 67659 }, // ⁰
-    { 6, 14, 7, 2, 22, 21, 67698 }, // ⁱ
-    { 12, 13, 11, 1, 25, 39, 67719 }, // ⁴
-    { 11, 14, 11, 2, 25, 39, 67758 }, // ⁵
-    { 11, 14, 11, 2, 25, 39, 67797 }, // ⁶
-    { 12, 13, 11, 2, 25, 39, 67836 }, // ⁷
-    { 11, 14, 11, 2, 25, 39, 67875 }, // ⁸
-    { 11, 14, 11, 2, 25, 39, 67914 }, // ⁹
-    { 9, 9, 11, 3, 22, 21, 67953 }, // ⁺
-    { 9, 3, 11, 3, 19, 7, 67974 }, // ⁻
-    { 10, 7, 12, 3, 21, 18, 67981 }, // ⁼
-    { 8, 17, 7, 3, 26, 34, 67999 }, // ⁽
-    { 8, 17, 7, 0, 26, 34, 68033 }, // ⁾
-    { 12, 11, 11, 1, 19, 33, 68067 }, // ⁿ
-    { 11, 14, 11, -1, 9, 39, 68100 }, // ₀
-    { 10, 13, 11, -1, 9, 33, 68139 }, // ₁
-    { 12, 13, 11, -2, 9, 39, 68172 }, // ₂
-    { 11, 14, 11, -2, 9, 39, 68211 }, // ₃
-    { 12, 13, 11, -2, 9, 39, 68250 }, // ₄
-    { 11, 14, 11, -1, 9, 39, 68289 }, // ₅
-    { 11, 14, 11, -1, 9, 39, 68328 }, // ₆
-    { 12, 13, 11, -1, 9, 39, 68367 }, // ₇
-    { 12, 14, 11, -2, 9, 42, 68406 }, // ₈
-    { 11, 14, 11, -1, 9, 39, 68448 }, // ₉
-    { 9, 9, 11, 0, 7, 21, 68487 }, // ₊
-    { 9, 3, 11, 0, 4, 7, 68508 }, // ₋
-    { 9, 7, 12, 0, 6, 16, 68515 }, // ₌
-    { 8, 17, 7, 0, 11, 34, 68531 }, // ₍
-    { 7, 17, 7, -3, 11, 30, 68565 }, // ₎
-    { 11, 10, 11, -1, 7, 28, 68595 }, // ₐ
-    { 10, 10, 10, -1, 7, 25, 68623 }, // ₑ
-    { 10, 10, 11, -1, 7, 25, 68648 }, // ₒ
-    { 13, 10, 10, -3, 7, 33, 68673 }, // ₓ
-    { 11, 10, 10, -2, 7, 28, 68706 }, // ₔ
-    { 12, 14, 13, -1, 11, 42, 68734 }, // ₕ
-    { 13, 14, 11, -1, 11, 46, 68776 }, // ₖ
-    { 7, 14, 7, -1, 11, 25, 68822 }, // ₗ
-    { 17, 10, 19, -1, 7, 43, 68847 }, // ₘ
-    { 11, 10, 11, -2, 7, 28, 68890 }, // ₙ
-    { 12, 14, 11, -3, 7, 42, 68918 }, // ₚ
-    { 9, 10, 10, -1, 7, 23, 68960 }, // ₛ
-    { 8, 12, 8, -1, 9, 24, 68983 }, // ₜ
-    { 17, 22, 17, 1, 22, 94, 69007 }, // ₠
-    { 19, 25, 16, 0, 23, 119, 69101 }, // ₡
-    { 18, 23, 17, 0, 22, 104, 69220 }, // ₢
-    { 18, 21, 16, 0, 21, 95, 69324 }, // ₣
-    { 19, 22, 16, -1, 22, 105, 69419 }, // ₤
-    { 25, 24, 26, 0, 20, 150, 69524 }, // ₥
-    { 18, 21, 17, 0, 21, 95, 69674 }, // ₦
-    { 25, 22, 25, 0, 21, 138, 69769 }, // ₧
-    { 27, 22, 26, 0, 21, 149, 69907 }, // ₨
-    { 23, 21, 21, 0, 21, 121, 70056 }, // ₩
-    { 26, 21, 25, 0, 21, 137, 70177 }, // ₪
-    { 20, 28, 17, 0, 23, 140, 70314 }, // ₫
-    { 18, 23, 16, 0, 22, 104, 70454 }, // €
-    { 20, 21, 17, 0, 21, 105, 70558 }, // ₭
-    { 17, 21, 15, 1, 21, 90, 70663 }, // ₮
-    { 29, 29, 29, 0, 22, 211, 70753 }, // ₯
-    { 20, 29, 17, -2, 22, 145, 70964 }, // ₰
-    { 18, 21, 17, 0, 21, 95, 71109 }, // ₱
-    { 19, 26, 20, 1, 23, 124, 71204 }, // ₲
-    { 21, 21, 18, -2, 21, 111, 71328 }, // ₳
-    { 18, 23, 17, 0, 22, 104, 71439 }, // ₴
-    { 19, 26, 18, 1, 23, 124, 71543 }, // ₵
-    { 21, 21, 20, 0, 20, 111, 71667 }, // ₶
-    { 22, 25, 20, -1, 22, 138, 71778 }, // ₷
-    { 17, 21, 15, 1, 21, 90, 71916 }, // ₸
-    { 15, 21, 16, 2, 21, 79, 72006 }, // ₹
-    { 16, 22, 16, 0, 21, 88, 72085 }, // ₺
-    { 19, 23, 19, 1, 22, 110, 72173 }, // ₻
-    { 24, 21, 24, -1, 21, 126, 72283 }, // ₼
-    { 19, 21, 17, -1, 21, 100, 72409 }, // ₽
-    { 20, 24, 18, -1, 24, 120, 72509 }, // ₾
-    { 17, 27, 16, 0, 24, 115, 72629 }, // ₿
-    { 9, 4, 9, 0, 10, 9, 72744 }, // −
-    { 27, 28, 29, 1, 23, 189, 72753 }, // �
+    { 15, 17, 17, 1, 19, 64, 2048 }, // >
+    { 13, 23, 13, 2, 22, 75, 2112 }, // ?
+    { 24, 24, 25, 1, 21, 144, 2187 }, // @
+    { 19, 21, 18, -2, 21, 100, 2331 }, // A
+    { 18, 21, 18, 0, 21, 95, 2431 }, // B
+    { 19, 23, 18, 1, 22, 110, 2526 }, // C
+    { 19, 21, 20, 0, 21, 100, 2636 }, // D
+    { 17, 21, 16, 0, 21, 90, 2736 }, // E
+    { 17, 21, 16, 0, 21, 90, 2826 }, // F
+    { 19, 23, 20, 1, 22, 110, 2916 }, // G
+    { 21, 21, 20, 0, 21, 111, 3026 }, // H
+    { 14, 21, 11, -1, 21, 74, 3137 }, // I
+    { 15, 28, 10, -5, 21, 105, 3211 }, // J
+    { 21, 21, 18, 0, 21, 111, 3316 }, // K
+    { 14, 21, 15, 0, 21, 74, 3427 }, // L
+    { 26, 21, 26, 0, 21, 137, 3501 }, // M
+    { 23, 21, 22, 0, 21, 121, 3638 }, // N
+    { 20, 23, 21, 1, 22, 115, 3759 }, // O
+    { 18, 21, 18, 0, 21, 95, 3874 }, // P
+    { 20, 27, 21, 1, 22, 135, 4096 }, // Q
+    { 18, 21, 18, 0, 21, 95, 4231 }, // R
+    { 16, 23, 15, 0, 22, 92, 4326 }, // S
+    { 16, 21, 16, 2, 21, 84, 4418 }, // T
+    { 20, 22, 20, 1, 21, 110, 4502 }, // U
+    { 18, 21, 17, 2, 21, 95, 4612 }, // V
+    { 27, 21, 26, 2, 21, 142, 4707 }, // W
+    { 23, 21, 18, -2, 21, 121, 4849 }, // X
+    { 18, 21, 16, 2, 21, 95, 4970 }, // Y
+    { 19, 21, 16, -1, 21, 100, 5065 }, // Z
+    { 13, 26, 10, -1, 21, 85, 5165 }, // [
+    { 8, 22, 12, 3, 21, 44, 5250 }, // <backslash>
+    { 13, 26, 10, -2, 21, 85, 5294 }, // ]
+    { 16, 14, 16, 0, 21, 56, 5379 }, // ^
+    { 13, 3, 12, -3, -2, 10, 5435 }, // _
+    { 7, 6, 9, 4, 23, 11, 5445 }, // `
+    { 16, 18, 17, 1, 17, 72, 5456 }, // a
+    { 17, 24, 17, 0, 23, 102, 5528 }, // b
+    { 14, 18, 14, 1, 17, 63, 5630 }, // c
+    { 18, 24, 17, 1, 23, 108, 5693 }, // d
+    { 15, 18, 16, 1, 17, 68, 5801 }, // e
+    { 19, 30, 11, -4, 23, 143, 5869 }, // f
+    { 17, 24, 17, 0, 17, 102, 6012 }, // g
+    { 17, 23, 18, 0, 23, 98, 6144 }, // h
+    { 10, 23, 9, 0, 23, 58, 6242 }, // i
+    { 14, 30, 9, -4, 23, 105, 6300 }, // j
+    { 18, 23, 17, 0, 23, 104, 6405 }, // k
+    { 10, 23, 9, 0, 23, 58, 6509 }, // l
+    { 25, 17, 26, 0, 17, 107, 6567 }, // m
+    { 17, 17, 18, 0, 17, 73, 6674 }, // n
+    { 15, 18, 17, 1, 17, 68, 6747 }, // o
+    { 18, 24, 17, -1, 17, 108, 6815 }, // p
+    { 16, 24, 17, 1, 17, 96, 6923 }, // q
+    { 14, 17, 12, 0, 17, 60, 7019 }, // r
+    { 14, 18, 14, 0, 17, 63, 7079 }, // s
+    { 12, 21, 12, 1, 20, 63, 7142 }, // t
+    { 17, 17, 18, 1, 16, 73, 7205 }, // u
+    { 16, 16, 15, 1, 16, 64, 7278 }, // v
+    { 24, 16, 23, 1, 16, 96, 7342 }, // w
+    { 19, 16, 16, -2, 16, 76, 7438 }, // x
+    { 20, 23, 15, -3, 16, 115, 7514 }, // y
+    { 15, 16, 14, -1, 16, 60, 7629 }, // z
+    { 14, 26, 10, -1, 21, 91, 7689 }, // {
+    { 4, 30, 16, 6, 23, 30, 7780 }, // |
+    { 13, 26, 10, -2, 21, 85, 7810 }, // }
+    { 15, 6, 17, 1, 13, 23, 7895 }, // ~
+    { 0, 0, 8, 0, 0, 0, 7918 }, //  
+    { 10, 22, 8, -2, 16, 55, 7918 }, // ¡
+    { 14, 23, 16, 2, 22, 81, 7973 }, // ¢
+    { 19, 22, 16, -1, 22, 105, 8054 }, // £
+    { 15, 14, 16, 1, 17, 53, 8192 }, // ¤
+    { 18, 21, 16, 1, 21, 95, 8245 }, // ¥
+    { 4, 30, 16, 6, 23, 30, 8340 }, // ¦
+    { 15, 24, 14, 0, 23, 90, 8370 }, // §
+    { 11, 4, 16, 5, 22, 11, 8460 }, // ¨
+    { 22, 23, 24, 1, 22, 127, 8471 }, // ©
+    { 11, 12, 11, 2, 22, 33, 8598 }, // ª
+    { 16, 14, 17, 1, 15, 56, 8631 }, // «
+    { 15, 9, 17, 1, 12, 34, 8687 }, // ¬
+    { 9, 4, 9, 0, 10, 9, 8721 }, // ­
+    { 22, 23, 24, 1, 22, 127, 8730 }, // ®
+    { 15, 4, 12, 2, 26, 15, 8857 }, // ¯
+    { 11, 11, 12, 1, 22, 31, 8872 }, // °
+    { 15, 19, 17, 1, 19, 72, 8903 }, // ±
+    { 12, 13, 11, 1, 25, 39, 8975 }, // ²
+    { 11, 14, 11, 2, 25, 39, 9014 }, // ³
+    { 9, 6, 9, 3, 23, 14, 9053 }, // ´
+    { 19, 23, 18, -1, 16, 110, 9067 }, // µ
+    { 16, 27, 19, 2, 23, 108, 9177 }, // ¶
+    { 7, 6, 8, 1, 13, 11, 9285 }, // ·
+    { 7, 7, 6, -3, 0, 13, 9296 }, // ¸
+    { 10, 13, 11, 2, 25, 33, 9309 }, // ¹
+    { 10, 11, 11, 2, 21, 28, 9342 }, // º
+    { 16, 14, 16, 0, 15, 56, 9370 }, // »
+    { 22, 21, 24, 2, 21, 116, 9426 }, // ¼
+    { 23, 21, 26, 2, 21, 121, 9542 }, // ½
+    { 24, 21, 25, 1, 21, 126, 9663 }, // ¾
+    { 13, 23, 14, -1, 17, 75, 9789 }, // ¿
+    { 19, 28, 18, -2, 28, 133, 9864 }, // À
+    { 20, 28, 18, -2, 28, 140, 9997 }, // Á
+    { 20, 28, 18, -2, 28, 140, 10240 }, // Â
+    { 21, 28, 18, -2, 28, 147, 10380 }, // Ã
+    { 20, 27, 18, -2, 27, 135, 10527 }, // Ä
+    { 19, 30, 18, -2, 30, 143, 10662 }, // Å
+    { 30, 21, 26, -2, 21, 158, 10805 }, // Æ
+    { 19, 29, 18, 1, 22, 138, 10963 }, // Ç
+    { 17, 28, 16, 0, 28, 119, 11101 }, // È
+    { 17, 28, 16, 0, 28, 119, 11220 }, // É
+    { 17, 28, 16, 0, 28, 119, 11339 }, // Ê
+    { 17, 27, 16, 0, 27, 115, 11458 }, // Ë
+    { 14, 28, 11, -1, 28, 98, 11573 }, // Ì
+    { 16, 28, 11, -1, 28, 112, 11671 }, // Í
+    { 16, 28, 11, -1, 28, 112, 11783 }, // Î
+    { 15, 27, 11, -1, 27, 102, 11895 }, // Ï
+    { 19, 21, 20, 0, 21, 100, 11997 }, // Ð
+    { 23, 28, 22, 0, 28, 161, 12097 }, // Ñ
+    { 20, 29, 21, 1, 28, 145, 12288 }, // Ò
+    { 20, 29, 21, 1, 28, 145, 12433 }, // Ó
+    { 20, 29, 21, 1, 28, 145, 12578 }, // Ô
+    { 20, 29, 21, 1, 28, 145, 12723 }, // Õ
+    { 20, 28, 21, 1, 27, 140, 12868 }, // Ö
+    { 14, 14, 17, 2, 17, 49, 13008 }, // ×
+    { 20, 24, 21, 1, 22, 120, 13057 }, // Ø
+    { 20, 29, 20, 1, 28, 145, 13177 }, // Ù
+    { 20, 29, 20, 1, 28, 145, 13322 }, // Ú
+    { 20, 29, 20, 1, 28, 145, 13467 }, // Û
+    { 20, 28, 20, 1, 27, 140, 13612 }, // Ü
+    { 18, 28, 16, 2, 28, 126, 13752 }, // Ý
+    { 17, 21, 18, 0, 21, 90, 13878 }, // Þ
+    { 23, 30, 19, -4, 23, 173, 13968 }, // ß
+    { 16, 24, 17, 1, 23, 96, 14141 }, // à
+    { 16, 24, 17, 1, 23, 96, 14237 }, // á
+    { 16, 24, 17, 1, 23, 96, 14336 }, // â
+    { 17, 24, 17, 1, 23, 102, 14432 }, // ã
+    { 16, 23, 17, 1, 22, 92, 14534 }, // ä
+    { 16, 26, 17, 1, 25, 104, 14626 }, // å
+    { 24, 18, 25, 1, 17, 108, 14730 }, // æ
+    { 14, 24, 14, 1, 17, 84, 14838 }, // ç
+    { 15, 24, 16, 1, 23, 90, 14922 }, // è
+    { 15, 24, 16, 1, 23, 90, 15012 }, // é
+    { 16, 24, 16, 1, 23, 96, 15102 }, // ê
+    { 15, 23, 16, 1, 22, 87, 15198 }, // ë
+    { 9, 23, 9, 0, 23, 52, 15285 }, // ì
+    { 12, 23, 9, 0, 23, 69, 15337 }, // í
+    { 12, 23, 9, 0, 23, 69, 15406 }, // î
+    { 12, 22, 9, 0, 22, 66, 15475 }, // ï
+    { 16, 24, 17, 1, 23, 96, 15541 }, // ð
+    { 18, 23, 18, 0, 23, 104, 15637 }, // ñ
+    { 15, 24, 17, 1, 23, 90, 15741 }, // ò
+    { 15, 24, 17, 1, 23, 90, 15831 }, // ó
+    { 15, 24, 17, 1, 23, 90, 15921 }, // ô
+    { 16, 24, 17, 1, 23, 96, 16011 }, // õ
+    { 15, 23, 17, 1, 22, 87, 16107 }, // ö
+    { 15, 15, 17, 1, 18, 57, 16194 }, // ÷
+    { 17, 19, 17, 0, 17, 81, 16251 }, // ø
+    { 17, 24, 18, 1, 23, 102, 16384 }, // ù
+    { 17, 24, 18, 1, 23, 102, 16486 }, // ú
+    { 17, 24, 18, 1, 23, 102, 16588 }, // û
+    { 17, 23, 18, 1, 22, 98, 16690 }, // ü
+    { 20, 30, 15, -3, 23, 150, 16788 }, // ý
+    { 18, 30, 17, -1, 23, 135, 16938 }, // þ
+    { 20, 29, 15, -3, 22, 145, 17073 }, // ÿ
+    { 20, 26, 18, -2, 26, 130, 17218 }, // Ā
+    { 16, 22, 17, 1, 21, 88, 17348 }, // ā
+    { 20, 28, 18, -2, 28, 140, 17436 }, // Ă
+    { 16, 24, 17, 1, 23, 96, 17576 }, // ă
+    { 19, 29, 18, -2, 21, 138, 17672 }, // Ą
+    { 16, 25, 17, 1, 17, 100, 17810 }, // ą
+    { 19, 29, 18, 1, 28, 138, 17910 }, // Ć
+    { 15, 24, 14, 1, 23, 90, 18048 }, // ć
+    { 19, 29, 18, 1, 28, 138, 18138 }, // Ĉ
+    { 15, 24, 14, 1, 23, 90, 18276 }, // ĉ
+    { 19, 29, 18, 1, 28, 138, 18432 }, // Ċ
+    { 14, 24, 14, 1, 23, 84, 18570 }, // ċ
+    { 19, 29, 18, 1, 28, 138, 18654 }, // Č
+    { 16, 24, 14, 1, 23, 96, 18792 }, // č
+    { 20, 28, 20, 0, 28, 140, 18888 }, // Ď
+    { 24, 24, 20, 1, 23, 144, 19028 }, // ď
+    { 19, 21, 20, 0, 21, 100, 19172 }, // Đ
+    { 19, 24, 17, 1, 23, 114, 19272 }, // đ
+    { 17, 26, 16, 0, 26, 111, 19386 }, // Ē
+    { 15, 22, 16, 1, 21, 83, 19497 }, // ē
+    { 18, 28, 16, 0, 28, 126, 19580 }, // Ĕ
+    { 15, 24, 16, 1, 23, 90, 19706 }, // ĕ
+    { 17, 28, 16, 0, 28, 119, 19796 }, // Ė
+    { 15, 24, 16, 1, 23, 90, 19915 }, // ė
+    { 17, 29, 16, 0, 21, 124, 20005 }, // Ę
+    { 15, 24, 16, 1, 17, 90, 20129 }, // ę
+    { 19, 28, 16, 0, 28, 133, 20219 }, // Ě
+    { 17, 24, 16, 1, 23, 102, 20352 }, // ě
+    { 19, 29, 20, 1, 28, 138, 20480 }, // Ĝ
+    { 17, 30, 17, 0, 23, 128, 20618 }, // ĝ
+    { 19, 29, 20, 1, 28, 138, 20746 }, // Ğ
+    { 17, 30, 17, 0, 23, 128, 20884 }, // ğ
+    { 19, 29, 20, 1, 28, 138, 21012 }, // Ġ
+    { 17, 30, 17, 0, 23, 128, 21150 }, // ġ
+    { 19, 29, 20, 1, 22, 138, 21278 }, // Ģ
+    { 17, 30, 17, 0, 23, 128, 21416 }, // ģ
+    { 21, 28, 20, 0, 28, 147, 21544 }, // Ĥ
+    { 17, 29, 18, 0, 29, 124, 21691 }, // ĥ
+    { 23, 21, 20, 0, 21, 121, 21815 }, // Ħ
+    { 16, 23, 18, 0, 23, 92, 21936 }, // ħ
+    { 16, 28, 11, -1, 28, 112, 22028 }, // Ĩ
+    { 13, 23, 9, 0, 23, 75, 22140 }, // ĩ
+    { 15, 26, 11, -1, 26, 98, 22215 }, // Ī
+    { 12, 21, 9, 0, 21, 63, 22313 }, // ī
+    { 16, 28, 11, -1, 28, 112, 22376 }, // Ĭ
+    { 13, 23, 9, 0, 23, 75, 22528 }, // ĭ
+    { 14, 29, 11, -1, 21, 102, 22603 }, // Į
+    { 12, 31, 9, -2, 23, 93, 22705 }, // į
+    { 14, 28, 11, -1, 28, 98, 22798 }, // İ
+    { 9, 16, 9, 0, 16, 36, 22896 }, // ı
+    { 23, 28, 21, -1, 21, 161, 22932 }, // Ĳ
+    { 19, 30, 17, 0, 23, 143, 23093 }, // ĳ
+    { 19, 35, 10, -5, 28, 167, 23236 }, // Ĵ
+    { 16, 30, 9, -4, 23, 120, 23403 }, // ĵ
+    { 21, 28, 18, 0, 21, 147, 23523 }, // Ķ
+    { 18, 30, 17, 0, 23, 135, 23670 }, // ķ
+    { 18, 16, 17, 0, 16, 72, 23805 }, // ĸ
+    { 15, 28, 15, 0, 28, 105, 23877 }, // Ĺ
+    { 14, 29, 9, 0, 29, 102, 23982 }, // ĺ
+    { 14, 28, 15, 0, 21, 98, 24084 }, // Ļ
+    { 12, 30, 9, -2, 23, 90, 24182 }, // ļ
+    { 17, 21, 15, 0, 21, 90, 24272 }, // Ľ
+    { 16, 23, 11, 0, 23, 92, 24362 }, // ľ
+    { 15, 21, 15, 0, 21, 79, 24454 }, // Ŀ
+    { 14, 23, 13, 0, 23, 81, 24576 }, // ŀ
+    { 15, 21, 15, -1, 21, 79, 24657 }, // Ł
+    { 11, 23, 10, 0, 23, 64, 24736 }, // ł
+    { 23, 28, 22, 0, 28, 161, 24800 }, // Ń
+    { 17, 23, 18, 0, 23, 98, 24961 }, // ń
+    { 23, 28, 22, 0, 21, 161, 25059 }, // Ņ
+    { 17, 24, 18, 0, 17, 102, 25220 }, // ņ
+    { 23, 28, 22, 0, 28, 161, 25322 }, // Ň
+    { 18, 23, 18, 0, 23, 104, 25483 }, // ň
+    { 20, 21, 21, 0, 21, 105, 25587 }, // ŉ
+    { 23, 28, 22, 0, 21, 161, 25692 }, // Ŋ
+    { 17, 24, 18, 0, 17, 102, 25853 }, // ŋ
+    { 20, 27, 21, 1, 26, 135, 25955 }, // Ō
+    { 15, 22, 17, 1, 21, 83, 26090 }, // ō
+    { 20, 29, 21, 1, 28, 145, 26173 }, // Ŏ
+    { 16, 24, 17, 1, 23, 96, 26318 }, // ŏ
+    { 22, 29, 21, 1, 28, 160, 26414 }, // Ő
+    { 19, 24, 17, 1, 23, 114, 26624 }, // ő
+    { 27, 23, 26, 1, 22, 156, 26738 }, // Œ
+    { 24, 18, 26, 1, 17, 108, 26894 }, // œ
+    { 18, 28, 18, 0, 28, 126, 27002 }, // Ŕ
+    { 15, 23, 12, 0, 23, 87, 27128 }, // ŕ
+    { 18, 28, 18, 0, 21, 126, 27215 }, // Ŗ
+    { 15, 24, 12, -1, 17, 90, 27341 }, // ŗ
+    { 19, 28, 18, 0, 28, 133, 27431 }, // Ř
+    { 16, 23, 12, 0, 23, 92, 27564 }, // ř
+    { 17, 29, 15, 0, 28, 124, 27656 }, // Ś
+    { 15, 24, 14, 0, 23, 90, 27780 }, // ś
+    { 17, 29, 15, 0, 28, 124, 27870 }, // Ŝ
+    { 15, 24, 14, 0, 23, 90, 27994 }, // ŝ
+    { 16, 29, 15, 0, 22, 116, 28084 }, // Ş
+    { 14, 24, 14, 0, 17, 84, 28200 }, // ş
+    { 18, 29, 15, 0, 28, 131, 28284 }, // Š
+    { 16, 24, 14, 0, 23, 96, 28415 }, // š
+    { 16, 28, 16, 2, 21, 112, 28511 }, // Ţ
+    { 12, 27, 12, 1, 20, 81, 28672 }, // ţ
+    { 16, 28, 16, 2, 28, 112, 28753 }, // Ť
+    { 15, 24, 12, 1, 23, 90, 28865 }, // ť
+    { 16, 21, 16, 2, 21, 84, 28955 }, // Ŧ
+    { 13, 21, 12, 0, 20, 69, 29039 }, // ŧ
+    { 20, 29, 20, 1, 28, 145, 29108 }, // Ũ
+    { 17, 24, 18, 1, 23, 102, 29253 }, // ũ
+    { 20, 27, 20, 1, 26, 135, 29355 }, // Ū
+    { 17, 22, 18, 1, 21, 94, 29490 }, // ū
+    { 20, 29, 20, 1, 28, 145, 29584 }, // Ŭ
+    { 17, 24, 18, 1, 23, 102, 29729 }, // ŭ
+    { 20, 31, 20, 1, 30, 155, 29831 }, // Ů
+    { 17, 26, 18, 1, 25, 111, 29986 }, // ů
+    { 21, 29, 20, 1, 28, 153, 30097 }, // Ű
+    { 19, 24, 18, 1, 23, 114, 30250 }, // ű
+    { 20, 29, 20, 1, 21, 145, 30364 }, // Ų
+    { 17, 24, 18, 1, 16, 102, 30509 }, // ų
+    { 27, 28, 26, 2, 28, 189, 30720 }, // Ŵ
+    { 24, 23, 23, 1, 23, 138, 30909 }, // ŵ
+    { 18, 28, 16, 2, 28, 126, 31047 }, // Ŷ
+    { 20, 30, 15, -3, 23, 150, 31173 }, // ŷ
+    { 18, 27, 16, 2, 27, 122, 31323 }, // Ÿ
+    { 19, 28, 16, -1, 28, 133, 31445 }, // Ź
+    { 16, 23, 14, -1, 23, 92, 31578 }, // ź
+    { 19, 28, 16, -1, 28, 133, 31670 }, // Ż
+    { 15, 23, 14, -1, 23, 87, 31803 }, // ż
+    { 19, 28, 16, -1, 28, 133, 31890 }, // Ž
+    { 17, 23, 14, -1, 23, 98, 32023 }, // ž
+    { 18, 30, 10, -4, 23, 135, 32121 }, // ſ
+    { 8, 6, 0, -13, 23, 12, 32256 }, // ̀
+    { 9, 6, 0, -7, 23, 14, 32268 }, // ́
+    { 12, 6, 0, -4, 23, 18, 32282 }, // ̂
+    { 13, 6, 0, -13, 23, 20, 32300 }, // ̃
+    { 10, 4, 0, -3, 21, 10, 32320 }, // ̄
+    { 14, 4, 0, -4, 25, 14, 32330 }, // ̅
+    { 11, 6, 0, -3, 23, 17, 32344 }, // ̆
+    { 5, 6, 0, 0, 23, 8, 32361 }, // ̇
+    { 11, 4, 0, -3, 22, 11, 32369 }, // ̈
+    { 7, 8, 0, -9, 25, 14, 32380 }, // ̉
+    { 8, 8, 0, -1, 25, 16, 32394 }, // ̊
+    { 14, 6, 0, -3, 23, 21, 32410 }, // ̋
+    { 12, 6, 0, -3, 23, 18, 32431 }, // ̌
+    { 5, 9, 0, 0, 23, 12, 32449 }, // ̍
+    { 10, 6, 0, -2, 23, 15, 32461 }, // ̎
+    { 12, 6, 0, -14, 23, 18, 32476 }, // ̏
+    { 11, 8, 0, -3, 25, 22, 32494 }, // ̐
+    { 11, 6, 0, -3, 23, 17, 32516 }, // ̑
+    { 8, 8, 0, -2, 21, 16, 32533 }, // ̒
+    { 8, 8, 0, -2, 21, 16, 32549 }, // ̓
+    { 5, 8, 0, 0, 21, 10, 32565 }, // ̔
+    { 8, 8, 0, -2, 21, 16, 32575 }, // ̕
+    { 7, 6, 0, -6, -1, 11, 32591 }, // ̖
+    { 9, 6, 0, -7, -1, 14, 32602 }, // ̗
+    { 7, 7, 0, -6, 0, 13, 32616 }, // ̘
+    { 7, 7, 0, -6, 0, 13, 32629 }, // ̙
+    { 10, 9, 9, 2, 23, 23, 32642 }, // ̚
+    { 9, 8, 0, -2, 23, 18, 32665 }, // ̛
+    { 5, 7, 0, -2, 0, 9, 32683 }, // ̜
+    { 7, 6, 0, -6, -1, 11, 32692 }, // ̝
+    { 8, 6, 0, -6, -1, 12, 32703 }, // ̞
+    { 7, 7, 0, -6, 0, 13, 32715 }, // ̟
+    { 7, 3, 0, -6, -3, 6, 32728 }, // ̠
+    { 9, 9, 0, -7, 2, 21, 32734 }, // ̡
+    { 8, 9, 0, -4, 2, 18, 32768 }, // ̢
+    { 6, 6, 0, -14, -1, 9, 32786 }, // ̣
+    { 11, 4, 0, -8, -2, 11, 32795 }, // ̤
+    { 8, 8, 0, -6, 0, 16, 32806 }, // ̥
+    { 7, 6, 0, 1, -1, 11, 32822 }, // ̦
+    { 8, 7, 0, -6, 0, 14, 32833 }, // ̧
+    { 7, 8, 0, -6, 0, 14, 32847 }, // ̨
+    { 6, 9, 0, -5, 0, 14, 32861 }, // ̩
+    { 13, 6, 0, -9, -1, 20, 32875 }, // ̪
+    { 12, 5, 0, -8, -1, 15, 32895 }, // ̫
+    { 13, 6, 0, -8, -1, 20, 32910 }, // ̬
+    { 13, 6, 0, -9, -1, 20, 32930 }, // ̭
+    { 12, 6, 0, -8, -1, 18, 32950 }, // ̮
+    { 11, 6, 0, -8, -1, 17, 32968 }, // ̯
+    { 13, 6, 0, -9, -1, 20, 32985 }, // ̰
+    { 11, 4, 0, -8, -2, 11, 33005 }, // ̱
+    { 14, 3, 0, -9, -2, 11, 33016 }, // ̲
+    { 14, 7, 0, -10, 0, 25, 33027 }, // ̳
+    { 13, 6, 0, -7, 11, 20, 33052 }, // ̴
+    { 13, 4, 0, -7, 10, 13, 33072 }, // ̵
+    { 22, 4, 0, -11, 10, 22, 33085 }, // ̶
+    { 12, 9, 0, -6, 13, 27, 33107 }, // ̷
+    { 18, 25, 0, -9, 23, 113, 33134 }, // ̸
+    { 6, 7, 0, -3, 0, 11, 33247 }, // ̹
+    { 12, 6, 0, -8, -1, 18, 33258 }, // ̺
+    { 12, 7, 0, -8, 0, 21, 33276 }, // ̻
+    { 12, 5, 0, -8, -1, 15, 33297 }, // ̼
+    { 8, 7, 0, -1, 23, 14, 33312 }, // ̽
+    { 7, 10, 0, -1, 26, 18, 33326 }, // ̾
+    { 14, 7, 0, -4, 29, 25, 33344 }, // ̿
+    { 7, 6, 0, -3, 23, 11, 33369 }, // ̀
+    { 8, 6, 0, 0, 23, 12, 33380 }, // ́
+    { 13, 6, 0, 4, 23, 20, 33392 }, // ͂
+    { 6, 6, 0, 0, 23, 9, 33412 }, // ̓
+    { 17, 6, 0, -5, 23, 26, 33421 }, // ̈́
+    { 6, 6, 0, -4, -1, 9, 33447 }, // ͅ
+    { 13, 6, 0, -4, 23, 20, 33456 }, // ͆
+    { 14, 7, 0, -10, 0, 25, 33476 }, // ͇
+    { 10, 6, 0, -7, 0, 15, 33501 }, // ͈
+    { 6, 6, 0, -5, -1, 9, 33516 }, // ͉
+    { 11, 7, 0, -3, 23, 20, 33525 }, // ͊
+    { 12, 12, 0, -3, 28, 36, 33545 }, // ͋
+    { 12, 9, 0, -3, 26, 27, 33581 }, // ͌
+    { 11, 6, 0, -8, -1, 17, 33608 }, // ͍
+    { 6, 7, 0, -5, 0, 11, 33625 }, // ͎
+    { 22, 21, 0, -11, 21, 116, 33636 }, // ͏
+    { 5, 7, 0, 0, 24, 9, 33752 }, // ͐
+    { 6, 7, 0, 3, 25, 11, 33761 }, // ͑
+    { 11, 8, 0, -3, 25, 22, 33772 }, // ͒
+    { 7, 7, 0, -5, 0, 13, 33794 }, // ͓
+    { 6, 6, 0, -5, -1, 9, 33807 }, // ͔
+    { 6, 6, 0, -4, -1, 9, 33816 }, // ͕
+    { 12, 6, 0, -7, -1, 18, 33825 }, // ͖
+    { 6, 7, 0, 2, 24, 11, 33843 }, // ͗
+    { 5, 6, 0, 0, 23, 8, 33854 }, // ͘
+    { 7, 6, 0, -6, -1, 11, 33862 }, // ͙
+    { 12, 7, 0, -8, 0, 21, 33873 }, // ͚
+    { 6, 6, 0, 0, 23, 9, 33894 }, // ͛
+    { 23, 6, 0, -13, -1, 35, 33903 }, // ͜
+    { 23, 6, 0, -9, 23, 35, 33938 }, // ͝
+    { 17, 4, 0, -6, 21, 17, 33973 }, // ͞
+    { 16, 4, 0, -10, -1, 16, 33990 }, // ͟
+    { 24, 6, 0, -9, 23, 36, 34006 }, // ͠
+    { 23, 7, 0, -8, 26, 41, 34042 }, // ͡
+    { 24, 7, 0, -15, 0, 42, 34083 }, // ͢
+    { 8, 8, 0, -1, 25, 16, 34125 }, // ͣ
+    { 8, 8, 0, -1, 25, 16, 34141 }, // ͤ
+    { 5, 9, 0, 1, 27, 12, 34157 }, // ͥ
+    { 8, 8, 0, -1, 25, 16, 34169 }, // ͦ
+    { 8, 8, 0, -1, 25, 16, 34185 }, // ͧ
+    { 7, 8, 0, 0, 25, 14, 34201 }, // ͨ
+    { 9, 10, 0, -1, 27, 23, 34215 }, // ͩ
+    { 8, 9, 0, -1, 27, 18, 34238 }, // ͪ
+    { 12, 7, 0, -3, 25, 21, 34256 }, // ͫ
+    { 7, 7, 0, 0, 25, 13, 34277 }, // ͬ
+    { 6, 9, 0, 0, 26, 14, 34290 }, // ͭ
+    { 7, 7, 0, 0, 25, 13, 34304 }, // ͮ
+    { 9, 7, 0, -2, 25, 16, 34317 }, // ͯ
+    { 17, 28, 15, 0, 28, 119, 34333 }, // Ѐ
+    { 17, 28, 15, 0, 28, 119, 34452 }, // Ё
+    { 18, 22, 21, 2, 21, 99, 34571 }, // Ђ
+    { 18, 28, 15, 0, 28, 126, 34670 }, // Ѓ
+    { 18, 23, 18, 1, 22, 104, 34816 }, // Є
+    { 16, 23, 15, 0, 22, 92, 34920 }, // Ѕ
+    { 10, 21, 9, 0, 21, 53, 35012 }, // І
+    { 13, 28, 9, 0, 28, 91, 35065 }, // Ї
+    { 15, 28, 9, -5, 21, 105, 35156 }, // Ј
+    { 30, 22, 28, -2, 21, 165, 35261 }, // Љ
+    { 27, 21, 27, 0, 21, 142, 35426 }, // Њ
+    { 18, 21, 21, 2, 21, 95, 35568 }, // Ћ
+    { 21, 28, 18, 0, 28, 147, 35663 }, // Ќ
+    { 21, 28, 20, 0, 28, 147, 35810 }, // Ѝ
+    { 21, 29, 17, 0, 28, 153, 35957 }, // Ў
+    { 21, 26, 20, 0, 21, 137, 36110 }, // Џ
+    { 19, 21, 18, -2, 21, 100, 36247 }, // А
+    { 17, 21, 17, 0, 21, 90, 36347 }, // Б
+    { 19, 21, 18, 0, 21, 100, 36437 }, // В
+    { 17, 21, 15, 0, 21, 90, 36537 }, // Г
+    { 24, 26, 21, -3, 21, 156, 36627 }, // Д
+    { 17, 21, 15, 0, 21, 90, 36864 }, // Е
+    { 31, 21, 26, -2, 21, 163, 36954 }, // Ж
+    { 17, 23, 17, 0, 22, 98, 37117 }, // З
+    { 21, 21, 20, 0, 21, 111, 37215 }, // И
+    { 21, 28, 20, 0, 28, 147, 37326 }, // Й
+    { 21, 21, 18, 0, 21, 111, 37473 }, // К
+    { 22, 22, 20, -1, 21, 121, 37584 }, // Л
+    { 26, 21, 25, 0, 21, 137, 37705 }, // М
+    { 21, 21, 20, 0, 21, 111, 37842 }, // Н
+    { 20, 23, 21, 1, 22, 115, 37953 }, // О
+    { 21, 21, 20, 0, 21, 111, 38068 }, // П
+    { 18, 21, 17, 0, 21, 95, 38179 }, // Р
+    { 18, 23, 17, 1, 22, 104, 38274 }, // С
+    { 16, 21, 15, 2, 21, 84, 38378 }, // Т
+    { 21, 22, 17, 0, 21, 116, 38462 }, // У
+    { 25, 23, 26, 1, 22, 144, 38578 }, // Ф
+    { 23, 21, 18, -2, 21, 121, 38722 }, // Х
+    { 21, 26, 20, 0, 21, 137, 38912 }, // Ц
+    { 18, 21, 19, 2, 21, 95, 39049 }, // Ч
+    { 30, 21, 29, 0, 21, 158, 39144 }, // Ш
+    { 29, 26, 29, 0, 21, 189, 39302 }, // Щ
+    { 18, 21, 20, 2, 21, 95, 39491 }, // Ъ
+    { 26, 21, 26, 0, 21, 137, 39586 }, // Ы
+    { 17, 21, 17, 0, 21, 90, 39723 }, // Ь
+    { 18, 23, 18, 0, 22, 104, 39813 }, // Э
+    { 29, 23, 29, 0, 22, 167, 39917 }, // Ю
+    { 21, 21, 18, -2, 21, 111, 40084 }, // Я
+    { 17, 18, 17, 0, 17, 77, 40195 }, // а
+    { 16, 24, 16, 1, 23, 96, 40272 }, // б
+    { 16, 18, 16, 0, 17, 72, 40368 }, // в
+    { 15, 18, 14, -1, 17, 68, 40440 }, // г
+    { 17, 24, 17, 0, 23, 102, 40508 }, // д
+    { 16, 18, 15, 0, 17, 72, 40610 }, // е
+    { 30, 18, 28, -1, 17, 135, 40682 }, // ж
+    { 14, 18, 15, 0, 17, 63, 40817 }, // з
+    { 16, 17, 17, 1, 16, 68, 40880 }, // и
+    { 16, 24, 17, 1, 23, 96, 40960 }, // й
+    { 18, 16, 16, 0, 16, 72, 41056 }, // к
+    { 19, 17, 18, -1, 16, 81, 41128 }, // л
+    { 23, 16, 23, 0, 16, 92, 41209 }, // м
+    { 17, 16, 17, 0, 16, 68, 41301 }, // н
+    { 16, 18, 17, 0, 17, 72, 41369 }, // о
+    { 16, 17, 17, 0, 17, 68, 41441 }, // п
+    { 18, 24, 18, -1, 17, 108, 41509 }, // р
+    { 14, 18, 14, 0, 17, 63, 41617 }, // с
+    { 25, 17, 26, 0, 17, 107, 41680 }, // т
+    { 19, 23, 16, -2, 16, 110, 41787 }, // у
+    { 21, 30, 22, 0, 23, 158, 41897 }, // ф
+    { 19, 16, 15, -2, 16, 76, 42055 }, // х
+    { 16, 20, 18, 1, 16, 80, 42131 }, // ц
+    { 15, 16, 17, 2, 16, 60, 42211 }, // ч
+    { 25, 17, 26, 1, 16, 107, 42271 }, // ш
+    { 25, 20, 27, 1, 16, 125, 42378 }, // щ
+    { 17, 17, 18, 1, 16, 73, 42503 }, // ъ
+    { 23, 17, 23, 0, 16, 98, 42576 }, // ы
+    { 16, 17, 16, 0, 16, 68, 42674 }, // ь
+    { 13, 18, 14, 0, 17, 59, 42742 }, // э
+    { 23, 18, 24, 0, 17, 104, 42801 }, // ю
+    { 18, 16, 16, -2, 16, 72, 42905 }, // я
+    { 16, 24, 15, 0, 23, 96, 43008 }, // ѐ
+    { 16, 23, 15, 0, 22, 92, 43104 }, // ё
+    { 16, 30, 17, 0, 23, 120, 43196 }, // ђ
+    { 16, 24, 14, -1, 23, 96, 43316 }, // ѓ
+    { 14, 18, 14, 0, 17, 63, 43412 }, // є
+    { 14, 18, 13, 0, 17, 63, 43475 }, // ѕ
+    { 10, 23, 8, 0, 23, 58, 43538 }, // і
+    { 11, 23, 8, 0, 23, 64, 43596 }, // ї
+    { 14, 30, 8, -4, 23, 105, 43660 }, // ј
+    { 26, 17, 25, -1, 16, 111, 43765 }, // љ
+    { 24, 17, 24, 0, 16, 102, 43876 }, // њ
+    { 16, 23, 17, 0, 23, 92, 43978 }, // ћ
+    { 18, 23, 16, 0, 23, 104, 44070 }, // ќ
+    { 16, 24, 17, 1, 23, 96, 44174 }, // ѝ
+    { 19, 30, 16, -2, 23, 143, 44270 }, // ў
+    { 16, 22, 17, 1, 16, 88, 44413 }, // џ
+    { 27, 21, 26, 2, 21, 142, 44501 }, // Ѡ
+    { 24, 16, 24, 1, 16, 96, 44643 }, // ѡ
+    { 16, 21, 18, 1, 21, 84, 44739 }, // Ѣ
+    { 24, 18, 25, 0, 17, 108, 44823 }, // ѣ
+    { 28, 23, 26, 0, 22, 161, 45056 }, // Ѥ
+    { 23, 18, 22, 0, 17, 104, 45217 }, // ѥ
+    { 20, 21, 20, -2, 21, 105, 45321 }, // Ѧ
+    { 18, 16, 17, -2, 16, 72, 45426 }, // ѧ
+    { 26, 21, 27, 0, 21, 137, 45498 }, // Ѩ
+    { 23, 16, 24, 0, 16, 92, 45635 }, // ѩ
+    { 24, 21, 21, -2, 21, 126, 45727 }, // Ѫ
+    { 20, 16, 17, -2, 16, 80, 45853 }, // ѫ
+    { 30, 21, 29, 0, 21, 158, 45933 }, // Ѭ
+    { 25, 16, 24, 0, 16, 100, 46091 }, // ѭ
+    { 20, 33, 17, -2, 26, 165, 46191 }, // Ѯ
+    { 18, 27, 15, -2, 20, 122, 46356 }, // ѯ
+    { 23, 21, 24, 3, 21, 121, 46478 }, // Ѱ
+    { 22, 30, 24, 1, 23, 165, 46599 }, // ѱ
+    { 20, 23, 21, 1, 22, 115, 46764 }, // Ѳ
+    { 15, 18, 17, 1, 17, 68, 46879 }, // ѳ
+    { 19, 21, 19, 2, 21, 100, 46947 }, // Ѵ
+    { 16, 17, 16, 1, 17, 68, 47104 }, // ѵ
+    { 19, 28, 19, 2, 28, 133, 47172 }, // Ѷ
+    { 16, 23, 16, 1, 23, 92, 47305 }, // ѷ
+    { 37, 29, 36, 1, 22, 269, 47397 }, // Ѹ
+    { 33, 24, 32, 1, 17, 198, 47666 }, // ѹ
+    { 21, 25, 22, 1, 23, 132, 47864 }, // Ѻ
+    { 17, 20, 18, 1, 18, 85, 47996 }, // ѻ
+    { 28, 32, 30, 1, 31, 224, 48081 }, // Ѽ
+    { 23, 27, 25, 1, 26, 156, 48305 }, // ѽ
+    { 27, 27, 26, 2, 27, 183, 48461 }, // Ѿ
+    { 24, 22, 24, 1, 22, 132, 48644 }, // ѿ
+    { 19, 29, 18, 1, 22, 138, 48776 }, // Ҁ
+    { 14, 24, 14, 1, 17, 84, 48914 }, // ҁ
+    { 16, 20, 18, 1, 19, 80, 48998 }, // ҂
+    { 12, 6, 0, -12, 22, 18, 49078 }, // ҃
+    { 12, 6, 0, -12, 23, 18, 49096 }, // ҄
+    { 5, 7, 0, -8, 24, 9, 49114 }, // ҅
+    { 6, 7, 0, -9, 24, 11, 49123 }, // ҆
+    { 13, 5, 0, -3, 27, 17, 49134 }, // ҇
+    { 34, 31, 0, -17, 23, 264, 49152 }, // ҈
+    { 34, 33, 0, -17, 24, 281, 49416 }, // ҉
+    { 23, 35, 24, 0, 28, 202, 49697 }, // Ҋ
+    { 18, 29, 18, 1, 23, 131, 49899 }, // ҋ
+    { 16, 21, 17, 0, 21, 84, 50030 }, // Ҍ
+    { 14, 24, 17, 1, 23, 84, 50114 }, // ҍ
+    { 18, 21, 18, 0, 21, 95, 50198 }, // Ҏ
+    { 18, 24, 17, -1, 17, 108, 50293 }, // ҏ
+    { 18, 26, 15, 0, 26, 117, 50401 }, // Ґ
+    { 16, 21, 13, 0, 21, 84, 50518 }, // ґ
+    { 17, 21, 15, 0, 21, 90, 50602 }, // Ғ
+    { 16, 16, 14, -1, 16, 64, 50692 }, // ғ
+    { 17, 29, 19, 0, 21, 124, 50756 }, // Ҕ
+    { 15, 24, 17, 0, 16, 90, 50880 }, // ҕ
+    { 30, 28, 27, -2, 21, 210, 50970 }, // Җ
+    { 30, 23, 28, -1, 17, 173, 51200 }, // җ
+    { 17, 30, 17, 0, 22, 128, 51373 }, // Ҙ
+    { 14, 25, 15, 0, 17, 88, 51501 }, // ҙ
+    { 21, 28, 20, 0, 21, 147, 51589 }, // Қ
+    { 18, 22, 18, 0, 16, 99, 51736 }, // қ
+    { 21, 21, 18, 0, 21, 111, 51835 }, // Ҝ
+    { 18, 16, 17, 1, 16, 72, 51946 }, // ҝ
+    { 21, 21, 18, 0, 21, 111, 52018 }, // Ҟ
+    { 18, 23, 17, 0, 23, 104, 52129 }, // ҟ
+    { 21, 21, 20, 2, 21, 111, 52233 }, // Ҡ
+    { 20, 16, 19, 1, 16, 80, 52344 }, // ҡ
+    { 21, 28, 22, 0, 21, 147, 52424 }, // Ң
+    { 19, 22, 20, 0, 16, 105, 52571 }, // ң
+    { 25, 21, 22, 0, 21, 132, 52676 }, // Ҥ
+    { 23, 16, 21, 0, 16, 92, 52808 }, // ҥ
+    { 28, 29, 30, 0, 21, 203, 52900 }, // Ҧ
+    { 23, 24, 25, 0, 16, 138, 53103 }, // ҧ
+    { 20, 24, 21, 1, 22, 120, 53248 }, // Ҩ
+    { 16, 19, 18, 1, 17, 76, 53368 }, // ҩ
+    { 19, 30, 18, 1, 22, 143, 53444 }, // Ҫ
+    { 14, 25, 14, 1, 17, 88, 53587 }, // ҫ
+    { 16, 28, 15, 2, 21, 112, 53675 }, // Ҭ
+    { 26, 23, 27, 0, 17, 150, 53787 }, // ҭ
+    { 18, 21, 16, 2, 21, 95, 53937 }, // Ү
+    { 16, 23, 15, 1, 16, 92, 54032 }, // ү
+    { 19, 21, 16, 1, 21, 100, 54124 }, // Ұ
+    { 18, 23, 15, -1, 16, 104, 54224 }, // ұ
+    { 22, 28, 20, -2, 21, 154, 54328 }, // Ҳ
+    { 20, 22, 17, -2, 16, 110, 54482 }, // ҳ
+    { 22, 28, 24, 2, 21, 154, 54592 }, // Ҵ
+    { 18, 22, 20, 1, 16, 99, 54746 }, // ҵ
+    { 19, 28, 22, 2, 21, 133, 54845 }, // Ҷ
+    { 16, 22, 19, 2, 16, 88, 54978 }, // ҷ
+    { 18, 21, 20, 2, 21, 95, 55066 }, // Ҹ
+    { 16, 16, 18, 2, 16, 64, 55161 }, // ҹ
+    { 18, 21, 20, 0, 21, 95, 55296 }, // Һ
+    { 17, 23, 18, 0, 23, 98, 55391 }, // һ
+    { 23, 23, 23, 0, 22, 133, 55489 }, // Ҽ
+    { 19, 18, 19, 0, 17, 86, 55622 }, // ҽ
+    { 23, 29, 23, 0, 22, 167, 55708 }, // Ҿ
+    { 19, 23, 19, 0, 17, 110, 55875 }, // ҿ
+    { 14, 21, 11, -1, 21, 74, 55985 }, // Ӏ
+    { 31, 28, 26, -2, 28, 217, 56059 }, // Ӂ
+    { 30, 24, 28, -1, 23, 180, 56276 }, // ӂ
+    { 21, 29, 20, 0, 21, 153, 56456 }, // Ӄ
+    { 18, 24, 18, 0, 16, 108, 56609 }, // ӄ
+    { 23, 28, 22, -1, 21, 161, 56717 }, // Ӆ
+    { 20, 23, 19, -1, 17, 115, 56878 }, // ӆ
+    { 21, 29, 20, 0, 21, 153, 56993 }, // Ӈ
+    { 18, 24, 18, 0, 16, 108, 57146 }, // ӈ
+    { 22, 28, 22, 0, 21, 154, 57344 }, // Ӊ
+    { 19, 22, 20, 0, 16, 105, 57498 }, // ӊ
+    { 18, 28, 20, 2, 21, 126, 57603 }, // Ӌ
+    { 15, 22, 17, 2, 16, 83, 57729 }, // ӌ
+    { 27, 28, 28, 0, 21, 189, 57812 }, // Ӎ
+    { 24, 22, 24, 0, 16, 132, 58001 }, // ӎ
+    { 14, 21, 11, -1, 21, 74, 58133 }, // ӏ
+    { 21, 28, 18, -2, 28, 147, 58207 }, // Ӑ
+    { 16, 24, 17, 1, 23, 96, 58354 }, // ӑ
+    { 20, 27, 18, -2, 27, 135, 58450 }, // Ӓ
+    { 16, 23, 17, 1, 22, 92, 58585 }, // ӓ
+    { 30, 21, 26, -2, 21, 158, 58677 }, // Ӕ
+    { 24, 18, 25, 1, 17, 108, 58835 }, // ӕ
+    { 18, 28, 16, 0, 28, 126, 58943 }, // Ӗ
+    { 17, 24, 16, 1, 23, 102, 59069 }, // ӗ
+    { 19, 23, 19, 0, 22, 110, 59171 }, // Ә
+    { 15, 18, 16, 0, 17, 68, 59281 }, // ә
+    { 19, 28, 19, 0, 27, 133, 59392 }, // Ӛ
+    { 15, 23, 16, 0, 22, 87, 59525 }, // ӛ
+    { 31, 27, 26, -2, 27, 210, 59612 }, // Ӝ
+    { 30, 23, 28, -1, 22, 173, 59822 }, // ӝ
+    { 17, 28, 17, 0, 27, 119, 59995 }, // Ӟ
+    { 15, 23, 15, 0, 22, 87, 60114 }, // ӟ
+    { 18, 22, 16, -1, 21, 99, 60201 }, // Ӡ
+    { 18, 24, 16, -2, 16, 108, 60300 }, // ӡ
+    { 21, 26, 20, 0, 26, 137, 60408 }, // Ӣ
+    { 17, 22, 18, 1, 21, 94, 60545 }, // ӣ
+    { 21, 27, 20, 0, 27, 142, 60639 }, // Ӥ
+    { 17, 23, 18, 1, 22, 98, 60781 }, // ӥ
+    { 20, 28, 21, 1, 27, 140, 60879 }, // Ӧ
+    { 15, 23, 17, 1, 22, 87, 61019 }, // ӧ
+    { 20, 23, 21, 1, 22, 115, 61106 }, // Ө
+    { 15, 18, 17, 1, 17, 68, 61221 }, // ө
+    { 20, 28, 21, 1, 27, 140, 61289 }, // Ӫ
+    { 15, 23, 17, 1, 22, 87, 61440 }, // ӫ
+    { 18, 28, 18, 0, 27, 126, 61527 }, // Ӭ
+    { 14, 23, 14, 0, 22, 81, 61653 }, // ӭ
+    { 21, 27, 17, 0, 26, 142, 61734 }, // Ӯ
+    { 20, 28, 15, -3, 21, 140, 61876 }, // ӯ
+    { 21, 28, 17, 0, 27, 147, 62016 }, // Ӱ
+    { 20, 29, 15, -3, 22, 145, 62163 }, // ӱ
+    { 21, 29, 17, 0, 28, 153, 62308 }, // Ӳ
+    { 21, 30, 15, -3, 23, 158, 62461 }, // ӳ
+    { 18, 27, 19, 2, 27, 122, 62619 }, // Ӵ
+    { 15, 22, 17, 2, 22, 83, 62741 }, // ӵ
+    { 17, 28, 15, 0, 21, 119, 62824 }, // Ӷ
+    { 15, 22, 14, 0, 16, 83, 62943 }, // ӷ
+    { 26, 27, 26, 0, 27, 176, 63026 }, // Ӹ
+    { 23, 23, 23, 0, 22, 133, 63202 }, // ӹ
+    { 17, 29, 15, 0, 21, 124, 63335 }, // Ӻ
+    { 16, 24, 14, -1, 16, 96, 63488 }, // ӻ
+    { 22, 29, 20, -2, 21, 160, 63584 }, // Ӽ
+    { 19, 24, 17, -2, 16, 114, 63744 }, // ӽ
+    { 23, 21, 18, -2, 21, 121, 63858 }, // Ӿ
+    { 19, 16, 15, -2, 16, 76, 63979 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 64055 }, //  
+    { 0, 0, 29, 0, 0, 0, 64055 }, //  
+    { 0, 0, 15, 0, 0, 0, 64055 }, //  
+    { 0, 0, 29, 0, 0, 0, 64055 }, //  
+    { 0, 0, 10, 0, 0, 0, 64055 }, //  
+    { 0, 0, 7, 0, 0, 0, 64055 }, //  
+    { 0, 0, 5, 0, 0, 0, 64055 }, //  
+    { 0, 0, 16, 0, 0, 0, 64055 }, //  
+    { 0, 0, 8, 0, 0, 0, 64055 }, //  
+    { 0, 0, 5, 0, 0, 0, 64055 }, //  
+    { 0, 0, 3, 0, 0, 0, 64055 }, //  
+    { 0, 0, 0, 0, 0, 0, 64055 }, // ​
+    { 0, 0, 0, 0, 0, 0, 64055 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 64055 }, // ‍
+    { 8, 25, 0, -1, 21, 50, 64055 }, // ‎
+    { 8, 25, 0, -7, 21, 50, 64105 }, // ‏
+    { 9, 4, 9, 0, 10, 9, 64155 }, // ‐
+    { 9, 4, 9, 0, 10, 9, 64164 }, // ‑
+    { 15, 4, 16, 1, 12, 15, 64173 }, // ‒
+    { 14, 4, 14, 0, 10, 14, 64188 }, // –
+    { 28, 4, 28, 0, 10, 28, 64202 }, // —
+    { 28, 4, 28, 0, 10, 28, 64230 }, // ―
+    { 12, 30, 16, 2, 23, 90, 64258 }, // ‖
+    { 14, 7, 12, -4, 0, 25, 64348 }, // ‗
+    { 8, 8, 6, 1, 21, 16, 64373 }, // ‘
+    { 8, 8, 6, 1, 21, 16, 64389 }, // ’
+    { 8, 8, 8, -2, 4, 16, 64405 }, // ‚
+    { 5, 8, 6, 3, 21, 10, 64421 }, // ‛
+    { 14, 8, 13, 1, 21, 28, 64431 }, // “
+    { 14, 8, 13, 1, 21, 28, 64459 }, // ”
+    { 14, 8, 15, -2, 4, 28, 64487 }, // „
+    { 11, 8, 13, 3, 21, 22, 64515 }, // ‟
+    { 13, 23, 15, 2, 23, 75, 64537 }, // †
+    { 16, 23, 15, 0, 23, 92, 64612 }, // ‡
+    { 10, 10, 11, 1, 16, 25, 64704 }, // •
+    { 10, 12, 10, 1, 17, 30, 64729 }, // ‣
+    { 6, 6, 15, 3, 5, 9, 64759 }, // ․
+    { 14, 6, 17, 0, 5, 21, 64768 }, // ‥
+    { 22, 6, 24, 0, 5, 33, 64789 }, // …
+    { 6, 6, 9, 2, 11, 9, 64822 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 64831 }, //  
+    { 0, 0, 18, 0, 0, 0, 64831 }, //  
+    { 8, 22, 0, -1, 18, 44, 64831 }, // ‪
+    { 8, 22, 0, -7, 18, 44, 64875 }, // ‫
+    { 8, 25, 0, -4, 21, 50, 64919 }, // ‬
+    { 8, 25, 0, -4, 21, 50, 64969 }, // ‭
+    { 8, 25, 0, -4, 21, 50, 65019 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 65069 }, //  
+    { 34, 23, 36, 1, 22, 196, 65069 }, // ‰
+    { 45, 23, 46, 1, 22, 259, 65265 }, // ‱
+    { 10, 8, 8, 1, 21, 20, 65536 }, // ′
+    { 16, 8, 15, 1, 21, 32, 65556 }, // ″
+    { 23, 8, 22, 1, 21, 46, 65588 }, // ‴
+    { 8, 8, 8, 2, 21, 16, 65634 }, // ‵
+    { 14, 8, 15, 2, 21, 28, 65650 }, // ‶
+    { 21, 8, 22, 2, 21, 42, 65678 }, // ‷
+    { 11, 10, 10, -3, 3, 28, 65720 }, // ‸
+    { 9, 14, 10, 1, 15, 32, 65748 }, // ‹
+    { 9, 14, 9, 0, 15, 32, 65780 }, // ›
+    { 24, 23, 25, 0, 22, 138, 65812 }, // ※
+    { 18, 22, 16, 0, 21, 99, 65950 }, // ‼
+    { 13, 23, 13, 2, 22, 75, 66049 }, // ‽
+    { 15, 4, 12, 2, 26, 15, 66124 }, // ‾
+    { 16, 7, 16, -2, 0, 28, 66139 }, // ‿
+    { 16, 8, 16, 2, 24, 32, 66167 }, // ⁀
+    { 15, 19, 11, -3, 12, 72, 66199 }, // ⁁
+    { 33, 27, 34, -1, 23, 223, 66271 }, // ⁂
+    { 9, 5, 9, 0, 10, 12, 66494 }, // ⁃
+    { 20, 21, 4, -8, 21, 105, 66506 }, // ⁄
+    { 13, 26, 10, -1, 21, 85, 66611 }, // ⁅
+    { 13, 26, 10, -2, 21, 85, 66696 }, // ⁆
+    { 26, 23, 26, 2, 22, 150, 66781 }, // ⁇
+    { 21, 23, 22, 2, 22, 121, 66931 }, // ⁈
+    { 23, 23, 22, 0, 22, 133, 67052 }, // ⁉
+    { 15, 16, 16, 1, 16, 60, 67185 }, // ⁊
+    { 16, 27, 18, 2, 23, 108, 67245 }, // ⁋
+    { 16, 15, 19, 1, 16, 60, 67353 }, // ⁌
+    { 16, 15, 19, 2, 16, 60, 67413 }, // ⁍
+    { 15, 15, 16, -1, 8, 57, 67473 }, // ⁎
+    { 8, 21, 8, 1, 17, 42, 67530 }, // ⁏
+    { 20, 31, 16, -2, 24, 155, 67584 }, // ⁐
+    { 18, 30, 16, -1, 23, 135, 67739 }, // ⁑
+    { 13, 23, 12, 0, 22, 75, 67874 }, // ⁒
+    { 28, 7, 29, 1, 12, 49, 67949 }, // ⁓
+    { 16, 7, 16, -3, 0, 28, 67998 }, // ⁔
+    { 16, 16, 17, 0, 15, 64, 68026 }, // ⁕
+    { 14, 23, 16, 1, 22, 81, 68090 }, // ⁖
+    { 27, 8, 26, 1, 21, 54, 68171 }, // ⁗
+    { 23, 23, 25, 1, 22, 133, 68225 }, // ⁘
+    { 23, 23, 25, 1, 22, 133, 68358 }, // ⁙
+    { 6, 23, 8, 1, 22, 35, 68491 }, // ⁚
+    { 19, 24, 21, 1, 23, 114, 68526 }, // ⁛
+    { 24, 23, 24, 0, 22, 138, 68640 }, // ⁜
+    { 6, 24, 8, 1, 23, 36, 68778 }, // ⁝
+    { 5, 23, 8, 2, 22, 29, 68814 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 68843 }, //  
+    { 0, 0, 18, 0, 0, 0, 68843 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 68843 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 68843 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 68843 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 68843 }, // ⁤
+    { 0, 0, 18, 0, 0, 0, 68843 }, // ⁦
+    { 0, 0, 18, 0, 0, 0, 68843 }, // ⁧
+    { 0, 0, 18, 0, 0, 0, 68843 }, // ⁨
+    { 0, 0, 18, 0, 0, 0, 68843 }, // ⁩
+    { 8, 25, 0, -4, 21, 50, 68843 }, // ⁪
+    { 8, 25, 0, -4, 21, 50, 68893 }, // ⁫
+    { 8, 25, 0, -4, 21, 50, 68943 }, // ⁬
+    { 8, 25, 0, -4, 21, 50, 68993 }, // ⁭
+    { 8, 25, 0, -4, 21, 50, 69043 }, // ⁮
+    { 8, 25, 0, -4, 21, 50, 69093 }, // ⁯
+    { 11, 14, 11, 2, 25, 39, 69143 }, // ⁰
+    { 6, 14, 7, 2, 22, 21, 69182 }, // ⁱ
+    { 12, 13, 11, 1, 25, 39, 69203 }, // ⁴
+    { 11, 14, 11, 2, 25, 39, 69242 }, // ⁵
+    { 11, 14, 11, 2, 25, 39, 69281 }, // ⁶
+    { 12, 13, 11, 2, 25, 39, 69320 }, // ⁷
+    { 11, 14, 11, 2, 25, 39, 69359 }, // ⁸
+    { 11, 14, 11, 2, 25, 39, 69398 }, // ⁹
+    { 9, 9, 11, 3, 22, 21, 69437 }, // ⁺
+    { 9, 3, 11, 3, 19, 7, 69458 }, // ⁻
+    { 10, 7, 12, 3, 21, 18, 69465 }, // ⁼
+    { 8, 17, 7, 3, 26, 34, 69483 }, // ⁽
+    { 8, 17, 7, 0, 26, 34, 69517 }, // ⁾
+    { 12, 11, 11, 1, 19, 33, 69551 }, // ⁿ
+    { 11, 14, 11, -1, 9, 39, 69584 }, // ₀
+    { 10, 13, 11, -1, 9, 33, 69632 }, // ₁
+    { 12, 13, 11, -2, 9, 39, 69665 }, // ₂
+    { 11, 14, 11, -2, 9, 39, 69704 }, // ₃
+    { 12, 13, 11, -2, 9, 39, 69743 }, // ₄
+    { 11, 14, 11, -1, 9, 39, 69782 }, // ₅
+    { 11, 14, 11, -1, 9, 39, 69821 }, // ₆
+    { 12, 13, 11, -1, 9, 39, 69860 }, // ₇
+    { 12, 14, 11, -2, 9, 42, 69899 }, // ₈
+    { 11, 14, 11, -1, 9, 39, 69941 }, // ₉
+    { 9, 9, 11, 0, 7, 21, 69980 }, // ₊
+    { 9, 3, 11, 0, 4, 7, 70001 }, // ₋
+    { 9, 7, 12, 0, 6, 16, 70008 }, // ₌
+    { 8, 17, 7, 0, 11, 34, 70024 }, // ₍
+    { 7, 17, 7, -3, 11, 30, 70058 }, // ₎
+    { 11, 10, 11, -1, 7, 28, 70088 }, // ₐ
+    { 10, 10, 10, -1, 7, 25, 70116 }, // ₑ
+    { 10, 10, 11, -1, 7, 25, 70141 }, // ₒ
+    { 13, 10, 10, -3, 7, 33, 70166 }, // ₓ
+    { 11, 10, 10, -2, 7, 28, 70199 }, // ₔ
+    { 12, 14, 13, -1, 11, 42, 70227 }, // ₕ
+    { 13, 14, 11, -1, 11, 46, 70269 }, // ₖ
+    { 7, 14, 7, -1, 11, 25, 70315 }, // ₗ
+    { 17, 10, 19, -1, 7, 43, 70340 }, // ₘ
+    { 11, 10, 11, -2, 7, 28, 70383 }, // ₙ
+    { 12, 14, 11, -3, 7, 42, 70411 }, // ₚ
+    { 9, 10, 10, -1, 7, 23, 70453 }, // ₛ
+    { 8, 12, 8, -1, 9, 24, 70476 }, // ₜ
+    { 17, 22, 17, 1, 22, 94, 70500 }, // ₠
+    { 19, 25, 16, 0, 23, 119, 70594 }, // ₡
+    { 18, 23, 17, 0, 22, 104, 70713 }, // ₢
+    { 18, 21, 16, 0, 21, 95, 70817 }, // ₣
+    { 19, 22, 16, -1, 22, 105, 70912 }, // ₤
+    { 25, 24, 26, 0, 20, 150, 71017 }, // ₥
+    { 18, 21, 17, 0, 21, 95, 71167 }, // ₦
+    { 25, 22, 25, 0, 21, 138, 71262 }, // ₧
+    { 27, 22, 26, 0, 21, 149, 71400 }, // ₨
+    { 23, 21, 21, 0, 21, 121, 71549 }, // ₩
+    { 26, 21, 25, 0, 21, 137, 71680 }, // ₪
+    { 20, 28, 17, 0, 23, 140, 71817 }, // ₫
+    { 18, 23, 16, 0, 22, 104, 71957 }, // €
+    { 20, 21, 17, 0, 21, 105, 72061 }, // ₭
+    { 17, 21, 15, 1, 21, 90, 72166 }, // ₮
+    { 29, 29, 29, 0, 22, 211, 72256 }, // ₯
+    { 20, 29, 17, -2, 22, 145, 72467 }, // ₰
+    { 18, 21, 17, 0, 21, 95, 72612 }, // ₱
+    { 19, 26, 20, 1, 23, 124, 72707 }, // ₲
+    { 21, 21, 18, -2, 21, 111, 72831 }, // ₳
+    { 18, 23, 17, 0, 22, 104, 72942 }, // ₴
+    { 19, 26, 18, 1, 23, 124, 73046 }, // ₵
+    { 21, 21, 20, 0, 20, 111, 73170 }, // ₶
+    { 22, 25, 20, -1, 22, 138, 73281 }, // ₷
+    { 17, 21, 15, 1, 21, 90, 73419 }, // ₸
+    { 15, 21, 16, 2, 21, 79, 73509 }, // ₹
+    { 16, 22, 16, 0, 21, 88, 73588 }, // ₺
+    { 19, 23, 19, 1, 22, 110, 73728 }, // ₻
+    { 24, 21, 24, -1, 21, 126, 73838 }, // ₼
+    { 19, 21, 17, -1, 21, 100, 73964 }, // ₽
+    { 20, 24, 18, -1, 24, 120, 74064 }, // ₾
+    { 17, 27, 16, 0, 24, 115, 74184 }, // ₿
+    { 9, 4, 9, 0, 10, 9, 74299 }, // −
+    { 27, 28, 29, 1, 23, 189, 74308 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_bolditalicIntervals[] = {
@@ -5476,4 +3450,9 @@ static const EpdFontData notosans_14_bolditalic = {
     32,
     -9,
     true,
+    notosans_14_bolditalicBlockOffsets,
+    notosans_14_bolditalicDirectGlyphs,
+    notosans_14_bolditalicGlyphPages,
+    256,
+    notosans_14_bolditalicPageGlyphs,
 };
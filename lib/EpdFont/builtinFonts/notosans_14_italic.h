@@ -2,4171 +2,2394 @@
  * generated by fontconvert.py
  * name: notosans_14_italic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py notosans_14_italic 14 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_14_italic 14 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_italicBitmaps[66514] = {
-    0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0x40,
-    0x07, 0xC0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x05,
-    0x00, 0x00, 0x2E, 0x0B, 0x83, 0xE0, 0xF8, 0x3D, 0x0F, 0x47, 0xC0, 0xF0, 0x78, 0x1F, 0x0B, 0x42,
-    0xD0, 0xB0, 0x2C, 0x0A, 0x02, 0x80, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x00, 0xB4, 0x07, 0x80,
-    0x00, 0x00, 0xF0, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,
-    0x02, 0xD0, 0x1E, 0x00, 0x02, 0xAB, 0xEA, 0xBF, 0xA8, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0x5B,
-    0x95, 0xB9, 0x50, 0x00, 0x0F, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00,
-    0xF0, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0xB4, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00,
-    0x01, 0xE0, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xBE, 0xFC, 0x00, 0xF8, 0x78, 0x00, 0x01, 0xF0, 0xB4, 0x00, 0x02,
-    0xF0, 0xB0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xFD, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xCB, 0xD0, 0x00, 0x03, 0x83, 0xD0, 0x00,
-    0x07, 0x83, 0xD0, 0x00, 0x0B, 0x43, 0xD0, 0x20, 0x0F, 0x0F, 0xC0, 0x3F, 0xAF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x01, 0x7E, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1E, 0x00, 0xBF, 0xFC,
-    0x00, 0x0F, 0x00, 0x3D, 0x0F, 0x00, 0x0F, 0x40, 0x2E, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0xF4,
-    0x07, 0xC0, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x01, 0xE0, 0x0F, 0x03, 0xD0, 0x00, 0xB8, 0x07, 0xC2,
-    0xE0, 0x00, 0x2D, 0x02, 0xD1, 0xF1, 0xB9, 0x0B, 0x80, 0xF0, 0xF1, 0xFF, 0xD1, 0xF0, 0xF8, 0xF5,
-    0xF4, 0xBC, 0x3F, 0xFC, 0xB8, 0xF4, 0x0F, 0x03, 0xF8, 0x7C, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x2E,
-    0x00, 0xF0, 0x00, 0x3D, 0x0B, 0x40, 0x7C, 0x00, 0x2E, 0x03, 0xD0, 0x2E, 0x00, 0x1F, 0x00, 0xF0,
-    0x0F, 0x40, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x40, 0x0F, 0x43, 0xD0, 0x0B, 0x80, 0x01, 0xFB,
-    0xF0, 0x07, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00,
-    0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x7E, 0x00, 0x00, 0x1F, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0xF8, 0x00, 0xF8, 0x3F, 0x41, 0xF4, 0x07, 0xC1, 0xF4,
-    0x02, 0xF0, 0x3E, 0x0F, 0x80, 0x03, 0xF2, 0xF0, 0x3E, 0x00, 0x07, 0xFF, 0x40, 0xF8, 0x00, 0x0B,
-    0xF4, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x1F, 0x80,
-    0x0B, 0xFF, 0xD0, 0x2F, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x3E, 0x3D, 0x7C, 0x78, 0xB4,
-    0xB0, 0xA0, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x3F,
-    0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8,
-    0x00, 0x0B, 0x80, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x02, 0xD0, 0x00, 0x1F, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00,
-    0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00,
-    0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00,
-    0x3E, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x74, 0x0B, 0x00, 0x0F, 0xF4, 0xF0, 0x00,
-    0x1F, 0xFE, 0x56, 0x90, 0x07, 0xFF, 0xFD, 0x00, 0xBF, 0x16, 0x80, 0x3E, 0x74, 0x00, 0x0F, 0xC3,
-    0xC0, 0x03, 0xF0, 0x3D, 0x00, 0x0D, 0x02, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x55, 0x5F, 0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x50, 0x0B, 0xD0, 0x3F, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x02,
-    0xE0, 0x0E, 0x00, 0x3F, 0xFF, 0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x05, 0x0F, 0xC7, 0xF1, 0xFC, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0x81, 0xFC, 0x02,
-    0xF4, 0x02, 0xF0, 0x0F, 0x80, 0x07, 0xD0, 0xBC, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x3E, 0x1F, 0x40,
-    0x00, 0xF8, 0xBC, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x0F, 0x4F, 0x80, 0x00, 0x7D, 0x3D, 0x00, 0x02,
-    0xF1, 0xF4, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x3E, 0x1F, 0x40, 0x01, 0xF4, 0x7D, 0x00, 0x0F, 0xC0,
-    0xF4, 0x00, 0x7E, 0x03, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x3F, 0x40, 0x0F, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x1F, 0xE0, 0x3F, 0xF4, 0xBF, 0xBC,
-    0xBF, 0x6F, 0x0E, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80,
-    0x03, 0xE0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00,
-    0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x20, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x55, 0x55, 0x40, 0xBF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xFD, 0x02, 0xFC, 0x00,
-    0x10, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x15, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x7F, 0x80, 0x7F,
-    0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xB8, 0x00, 0x00, 0x7D, 0xF4, 0x00,
-    0x00, 0xF8, 0xF0, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x2F, 0x03, 0xE0, 0x00,
-    0xBC, 0x03, 0xD0, 0x01, 0xF4, 0x07, 0xC0, 0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x3E,
-    0x00, 0x0F, 0x80, 0x7F, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x7F, 0x54, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xEA, 0xAA, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xEA, 0x90,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x29, 0x5B, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xBD, 0x0E, 0x00, 0x1F, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xF8,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3D, 0x2F, 0xF4, 0x01, 0xF7, 0xFF, 0xF4, 0x0B, 0xFD, 0x07, 0xF0, 0x3F,
-    0x80, 0x07, 0xD0, 0xFC, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0xF4, 0x3D, 0x00,
-    0x03, 0xD0, 0xF8, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0xF8, 0x07, 0xE0, 0x1F, 0xC0, 0x0F, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF,
-    0xC1, 0x55, 0x55, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0xFD, 0x01, 0xF4, 0x00, 0xF8, 0x0B, 0xC0, 0x03, 0xF0, 0x2F,
-    0x00, 0x0F, 0x80, 0xBC, 0x00, 0x3D, 0x00, 0xF8, 0x03, 0xF0, 0x02, 0xF8, 0xBF, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFE, 0x00, 0x07, 0xF8, 0xBE, 0x00, 0x7E, 0x00, 0xBE, 0x03, 0xE0, 0x00, 0xFC,
-    0x1F, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0xFC, 0x0F,
-    0xD0, 0x0F, 0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xBE, 0x02, 0xF4, 0x07, 0xD0,
-    0x03, 0xF0, 0x3F, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x7C, 0x1F, 0x00, 0x01,
-    0xF0, 0x7C, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x7F, 0x03, 0xF0, 0x07, 0xFC, 0x07, 0xFF, 0xFB, 0xE0,
-    0x07, 0xFF, 0x4F, 0x40, 0x00, 0x40, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x10, 0x01, 0xFD, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0xFD, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0xF0,
-    0x1F, 0xC0, 0x7F, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xF8, 0x00, 0xFD, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x01, 0xF0,
-    0x00, 0xF4, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFE, 0xAA, 0xAA, 0xAA, 0x90, 0x40, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xBF,
-    0xD0, 0x01, 0xBF, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x3F, 0xFF, 0xF4, 0x2E, 0x42, 0xFC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x2F,
-    0x80, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBE, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0x90, 0x17, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x00,
-    0x01, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0xBF, 0xF8, 0x0B, 0x83, 0xD0, 0x1F,
-    0xFB, 0xF0, 0x1F, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3C, 0xF4, 0x0F, 0x80, 0x2E, 0x00, 0xF3, 0xC0,
-    0x7C, 0x00, 0xF4, 0x07, 0xDF, 0x02, 0xD0, 0x03, 0xC0, 0x1E, 0x7C, 0x0F, 0x40, 0x1F, 0x00, 0xB5,
-    0xE0, 0x3C, 0x00, 0xF8, 0x03, 0xC7, 0xC0, 0xF4, 0x07, 0xE0, 0x2E, 0x1F, 0x03, 0xE0, 0x7B, 0xC2,
-    0xF0, 0x3C, 0x07, 0xFF, 0x8F, 0xFF, 0x40, 0xF4, 0x07, 0xF4, 0x0B, 0xE0, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x55, 0xBE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x6A, 0x94, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3E, 0xF0,
-    0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x07, 0xD0,
-    0xF4, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x7C,
-    0x00, 0xBC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0xF0, 0x0B,
-    0xC0, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0xF8,
-    0xFC, 0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0xFE, 0x80, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0x0F, 0xD5, 0x6F, 0xE0, 0x03, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0xBC,
-    0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x01, 0xF8, 0x03, 0xD0, 0x02, 0xFC, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x6F, 0x80, 0x0F, 0x80, 0x02, 0xF4,
-    0x03, 0xD0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x01,
-    0xF8, 0x0F, 0x80, 0x00, 0xFC, 0x07, 0xD0, 0x06, 0xFD, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFE, 0x41, 0x78, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x19, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFD,
-    0x5B, 0xFE, 0x00, 0x0F, 0x80, 0x07, 0xF4, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xBC,
-    0x02, 0xF0, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x7C, 0x00,
-    0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0x80, 0x00, 0x0F, 0xC0,
-    0xF4, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x2F, 0x42, 0xF0, 0x00, 0x07, 0xF0, 0x3E, 0x00, 0x01,
-    0xFC, 0x03, 0xE0, 0x00, 0xBF, 0x40, 0x7E, 0x55, 0xBF, 0xD0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40,
-    0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFD, 0x45, 0xBC, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x01,
-    0xFF, 0xF0, 0xFC, 0x00, 0x2F, 0xFF, 0x0F, 0xC0, 0x01, 0x57, 0xF0, 0xFC, 0x00, 0x00, 0x3E, 0x0F,
-    0xC0, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x00,
-    0xF8, 0x01, 0xFE, 0x00, 0x1F, 0x40, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0F, 0x80,
-    0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0B,
-    0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x03, 0xF5, 0x55, 0x57, 0xE0, 0x0F, 0x80, 0x00,
-    0x0F, 0x40, 0x3D, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x3F, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0x00,
-    0x00, 0x2F, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0xFD, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x19, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x07,
-    0xD0, 0x0B, 0xC0, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x01, 0xF4,
-    0x07, 0xE0, 0x00, 0x2F, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00,
-    0x03, 0xD7, 0xE0, 0x00, 0x00, 0x7D, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x7F,
-    0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F,
-    0xC0, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x7E, 0x55, 0x54, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0xBF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0xFB, 0x80, 0x00,
-    0x0F, 0xBC, 0x01, 0xF7, 0xC0, 0x00, 0x2E, 0xF8, 0x02, 0xF7, 0xC0, 0x00, 0x7C, 0xF8, 0x03, 0xE3,
-    0xC0, 0x00, 0xF8, 0xF4, 0x03, 0xD3, 0xC0, 0x01, 0xF1, 0xF0, 0x03, 0xD3, 0xC0, 0x03, 0xD2, 0xF0,
-    0x07, 0xC3, 0xD0, 0x07, 0xC3, 0xE0, 0x0B, 0xC2, 0xD0, 0x0F, 0x43, 0xD0, 0x0F, 0x82, 0xE0, 0x2F,
-    0x07, 0xD0, 0x0F, 0x41, 0xE0, 0x3D, 0x0B, 0xC0, 0x0F, 0x01, 0xF0, 0xB8, 0x0B, 0xC0, 0x1F, 0x00,
-    0xF0, 0xF0, 0x0F, 0x80, 0x2F, 0x00, 0xF2, 0xE0, 0x0F, 0x40, 0x3E, 0x00, 0xF7, 0xC0, 0x1F, 0x00,
-    0x3D, 0x00, 0xFF, 0x80, 0x2F, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0xBD, 0x00,
-    0x3E, 0x00, 0xB8, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0xBF, 0x00,
-    0x00, 0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x01, 0xFB, 0xC0, 0x00,
-    0xBC, 0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03, 0xD1, 0xF0, 0x01, 0xF0,
-    0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x0F,
-    0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00, 0x0F, 0x4B, 0xC0, 0x1F, 0x00,
-    0x0F, 0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xDF, 0x40, 0x3D, 0x00, 0x02,
-    0xFF, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0xB8, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x3F, 0xD0, 0x6F, 0xE0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x1F, 0x80, 0xFC, 0x00,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x02, 0xF1, 0xF8, 0x00, 0x00, 0x0B,
-    0xCB, 0xD0, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0,
-    0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00,
-    0x2F, 0x81, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x07, 0xF8, 0x02, 0xFE, 0x00,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x01,
-    0xF4, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x7D, 0x03,
-    0xD0, 0x00, 0xFC, 0x07, 0xC0, 0x02, 0xF8, 0x0B, 0xD5, 0x6F, 0xE0, 0x0F, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xA4, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xD0, 0x6F, 0xE0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x1F, 0x80,
-    0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x02, 0xF1, 0xF8, 0x00,
-    0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03,
-    0xF3, 0xF0, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBC,
-    0x00, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x02,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B, 0xFC,
-    0x00, 0xF8, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E,
-    0x03, 0xE0, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0xFC, 0x07, 0xC0, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0x95, 0xF8, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x1F, 0x00, 0x7D, 0x00,
-    0x2F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x0F, 0xC0,
-    0x7C, 0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0x41, 0xB8, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x80, 0x74, 0x01, 0xBF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x5F, 0xD5, 0x54,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00,
-    0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0x07, 0xC0,
-    0x3F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x1F, 0x00,
-    0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F,
-    0x80, 0x7D, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x2F,
-    0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x02,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x1F, 0x4F, 0x40, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x07, 0xE0, 0xF8, 0x00,
-    0x03, 0xF0, 0x3E, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x1F, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0xF4, 0x07, 0xD0, 0x00,
-    0x3D, 0x03, 0xF0, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0xF8, 0x7C, 0x00,
-    0x00, 0x2E, 0x3E, 0x00, 0x00, 0x0B, 0xDF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xE0, 0x00,
-    0x1F, 0x7E, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xD2, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x3E, 0xF0, 0x00, 0xF8, 0x2F, 0x00, 0x2F, 0x7C, 0x00, 0xBC,
-    0x0B, 0xC0, 0x0F, 0x5F, 0x00, 0x3E, 0x02, 0xF0, 0x07, 0xC3, 0xC0, 0x1F, 0x00, 0xBC, 0x03, 0xD0,
-    0xF0, 0x0F, 0x80, 0x1F, 0x01, 0xF0, 0x3C, 0x07, 0xD0, 0x07, 0xC0, 0xF8, 0x0F, 0x02, 0xF0, 0x01,
-    0xF0, 0x7C, 0x03, 0xC0, 0xF4, 0x00, 0x7C, 0x3E, 0x00, 0xF0, 0xBC, 0x00, 0x1F, 0x0F, 0x00, 0x3D,
-    0x3D, 0x00, 0x07, 0xCB, 0x80, 0x0F, 0x5F, 0x00, 0x00, 0xF3, 0xC0, 0x03, 0xDF, 0x80, 0x00, 0x3D,
-    0xF0, 0x00, 0xF7, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x07,
-    0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x01, 0xF0,
-    0xF8, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x00, 0x2F, 0x03, 0xD0, 0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x1F, 0x40,
-    0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8,
-    0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00,
-    0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x2A, 0xAA, 0xAF, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x55,
-    0x50, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F,
-    0xFE, 0x00, 0x1F, 0x54, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x01,
-    0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x3F, 0x54, 0x00, 0x3F, 0xF8, 0x00, 0x2A, 0xA4, 0x00, 0xB4, 0x0B, 0x80, 0x7C, 0x07, 0xC0, 0x3C,
-    0x03, 0xD0, 0x3D, 0x03, 0xE0, 0x2E, 0x01, 0xF0, 0x1F, 0x00, 0xF0, 0x0F, 0x40, 0xF4, 0x0B, 0x80,
-    0xBC, 0x07, 0xC0, 0x7C, 0x03, 0xC0, 0x3D, 0x03, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFE, 0x00,
-    0x05, 0x7D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xF4, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x15, 0xBC,
-    0x00, 0x3F, 0xF8, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x1E, 0xB8, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x07, 0xC2, 0xE0, 0x00, 0x2D, 0x03,
-    0xC0, 0x00, 0xF0, 0x0B, 0x80, 0x0B, 0x40, 0x0F, 0x00, 0x3C, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x3C,
-    0x0F, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x1F,
-    0xFF, 0xFF, 0xC6, 0xAA, 0xAA, 0xA0, 0x54, 0x07, 0xD0, 0x3E, 0x00, 0xF0, 0x07, 0xC0, 0x04, 0x00,
-    0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F,
-    0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D,
-    0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C,
-    0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xF8, 0x2F, 0x80, 0x00, 0xF5, 0xFF, 0xF4, 0x01, 0xF7, 0xD6, 0xFC, 0x02, 0xFE, 0x00, 0xBD, 0x03,
-    0xFC, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x7D, 0x0B,
-    0xC0, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0xF8, 0x0F, 0x80, 0x02, 0xF0, 0x1F,
-    0xC0, 0x07, 0xE0, 0x2F, 0xE0, 0x1F, 0xC0, 0x3D, 0xBF, 0xFF, 0x00, 0x3C, 0x2F, 0xF8, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xD5, 0xA0, 0x2F, 0x80, 0x00,
-    0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x08,
-    0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x6F, 0x82, 0xF0, 0x00, 0xBF, 0xFC,
-    0xBC, 0x00, 0xFE, 0x57, 0xFE, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x2F, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0xBC,
-    0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x02, 0xF8, 0x01, 0xF0, 0x01, 0xFD, 0x00,
-    0x3F, 0x02, 0xEF, 0x40, 0x0B, 0xFF, 0xE3, 0xC0, 0x00, 0xBF, 0xD1, 0xF0, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0x92, 0xF8, 0x2F, 0x40, 0x3E, 0x0F, 0x80,
-    0x0F, 0x8B, 0xC0, 0x07, 0xD3, 0xE0, 0x1B, 0xE1, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x2F, 0x40,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xFA, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x01, 0x7E, 0x54, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x0A, 0x00, 0x0F, 0xFF,
-    0xC7, 0xC0, 0x0F, 0xF5, 0x7F, 0xE0, 0x0B, 0xE0, 0x07, 0xF4, 0x03, 0xF0, 0x00, 0xFC, 0x02, 0xF0,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x01, 0xF4, 0x0B,
-    0xC0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x2F, 0x80, 0x1F, 0x00, 0x2F, 0xD0,
-    0x03, 0xF0, 0x2E, 0xF4, 0x00, 0xBF, 0xFE, 0x7C, 0x00, 0x0B, 0xFD, 0x2F, 0x00, 0x00, 0x10, 0x0F,
-    0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x79, 0x02,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xD0, 0x00, 0xF5, 0xFF, 0xF8, 0x01,
-    0xF7, 0xD5, 0xFC, 0x02, 0xFE, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x7C, 0x03,
-    0xE0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F,
-    0x80, 0x02, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E,
-    0x00, 0x07, 0xC0, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0xF4, 0x01, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03,
-    0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x2F, 0x00, 0x3E,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0xF4, 0x03, 0xF0, 0x01, 0xF0,
-    0x0F, 0xC0, 0x02, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x03, 0xDB,
-    0xC0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xE3, 0xE0, 0x00, 0x0F, 0x82,
-    0xF0, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x3D, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x7D, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F,
-    0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF4,
-    0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0x00, 0xA0, 0x2F, 0x80, 0x0B, 0xE0,
-    0x00, 0xF1, 0xFF, 0xF0, 0x7F, 0xFC, 0x01, 0xF7, 0xD6, 0xF5, 0xF5, 0xBE, 0x02, 0xFE, 0x00, 0xFF,
-    0x80, 0x3F, 0x02, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x03, 0xE0,
-    0x00, 0xF8, 0x00, 0x3E, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x3D, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x7C,
-    0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x0F, 0x40, 0x03, 0xD0,
-    0x00, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x3E, 0x00,
-    0x0F, 0xC0, 0x02, 0xF0, 0x3D, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x2F, 0xE0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xF7, 0xE5, 0xFC, 0x02, 0xFF, 0x00, 0xBD, 0x03, 0xFC,
-    0x00, 0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0xFC, 0x0B, 0xC0,
-    0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xF0, 0x2F, 0x00,
-    0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x1B,
-    0xE4, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x96, 0xFC, 0x02, 0xF4, 0x01, 0xF8, 0x1F, 0x80, 0x03,
-    0xF0, 0xBC, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xBC, 0x7C, 0x00, 0x03, 0xF2,
-    0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x1F, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x1F, 0x40, 0xFD,
-    0x02, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x0B, 0xE0, 0x00, 0x0F, 0x1F, 0xFF, 0x40, 0x07, 0xDF, 0x5B, 0xF0, 0x02, 0xFE, 0x00, 0xBD, 0x00,
-    0xBF, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x7D,
-    0x02, 0xF0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x02,
-    0xF0, 0x07, 0xF0, 0x01, 0xF8, 0x02, 0xFE, 0x01, 0xFC, 0x00, 0xFA, 0xFF, 0xFC, 0x00, 0x3D, 0x2F,
-    0xF8, 0x00, 0x1F, 0x40, 0x50, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4,
-    0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0,
-    0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80,
-    0x7C, 0x00, 0xBF, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x9F, 0x00, 0x0B, 0xFD, 0x2F, 0x00,
-    0x00, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xA0, 0x2F, 0x40,
-    0x3C, 0x7F, 0xC0, 0x1F, 0x7E, 0x60, 0x0B, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x6F, 0xE4, 0x00, 0xBF, 0xFF, 0xC0, 0xBE, 0x46, 0xD0, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x24, 0x00, 0xFC, 0x0F, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFD, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0xF0, 0x00,
-    0x2F, 0x00, 0x1B, 0xFA, 0x9B, 0xFF, 0xFD, 0x1B, 0xD5, 0x40, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8,
-    0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0x7D, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x40, 0x00, 0x02, 0x90, 0x00,
-    0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01,
-    0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07,
-    0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x68, 0x00, 0x02, 0xA1, 0xF0, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xFC, 0x0F, 0x40, 0x07, 0xD0,
-    0x3D, 0x00, 0x3F, 0x00, 0xF4, 0x01, 0xF4, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0x80, 0xBC, 0x00, 0x2F,
-    0x03, 0xE0, 0x00, 0xBC, 0x2F, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x0F, 0x3D,
-    0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x28, 0x00, 0x1A,
-    0x00, 0x06, 0x87, 0xC0, 0x03, 0xF4, 0x00, 0xF8, 0x7C, 0x00, 0xBF, 0x40, 0x1F, 0x03, 0xD0, 0x0F,
-    0xB4, 0x03, 0xF0, 0x3D, 0x02, 0xEB, 0x40, 0x7D, 0x03, 0xD0, 0x3C, 0xB4, 0x0F, 0xC0, 0x3D, 0x07,
-    0xCB, 0x80, 0xF4, 0x03, 0xD0, 0xF4, 0xB8, 0x2F, 0x00, 0x3D, 0x1F, 0x0B, 0x83, 0xD0, 0x03, 0xD3,
-    0xD0, 0x78, 0xBC, 0x00, 0x3D, 0x7C, 0x07, 0x8F, 0x80, 0x03, 0xDB, 0x40, 0x79, 0xF0, 0x00, 0x3D,
-    0xF0, 0x07, 0xAE, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x02,
-    0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0A, 0x40, 0x0F, 0x40, 0x0F, 0xC0, 0x02, 0xF0,
-    0x0F, 0xC0, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x0F, 0x87, 0xD0, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x01, 0xF7, 0xD0, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x00, 0xF8, 0x0F, 0x40, 0x00, 0xFC, 0x02, 0xF0,
-    0x00, 0xFC, 0x00, 0x7D, 0x00, 0xBD, 0x00, 0x0F, 0x80, 0x00, 0x68, 0x00, 0x02, 0xA0, 0x01, 0xF0,
-    0x00, 0x1F, 0x40, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x3F,
-    0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00,
-    0x1F, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00, 0x03, 0xDB,
-    0xC0, 0x00, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x90, 0x0F, 0xFF, 0xFE, 0x00, 0x55,
-    0x5F, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x6D, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xE4, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00,
-    0x1B, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x00, 0x0F, 0x80, 0x00, 0x0B, 0xE4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x64, 0x00, 0x01, 0xE7, 0x9E,
-    0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79,
-    0xE7, 0x9E, 0x79, 0xE0, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0xBE, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0xAF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x02, 0xFF, 0xFF, 0xE6, 0xFE, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x69, 0x00, 0x00, 0x2E, 0x00, 0x1F,
-    0xC0, 0x07, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0xC0, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00,
-    0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2F, 0xA4, 0x00, 0xBF, 0xFF, 0x00, 0xFF,
-    0x56, 0x80, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x7F, 0x00, 0x10, 0x0B, 0xFE, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xD4, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0F, 0xD0, 0x2C, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xBD,
-    0x55, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x10, 0x00, 0x01, 0x1E,
-    0x0A, 0x92, 0xD3, 0xFF, 0xFF, 0xF0, 0x3F, 0x57, 0xF4, 0x1F, 0x00, 0x2D, 0x0B, 0x40, 0x03, 0xC3,
-    0xC0, 0x00, 0xF0, 0xB4, 0x00, 0x3C, 0x1E, 0x00, 0x1E, 0x03, 0xE0, 0x1F, 0x02, 0xFF, 0xFF, 0xE1,
-    0xF6, 0xFE, 0x7E, 0x20, 0x00, 0x02, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x0B, 0xC0,
-    0x3D, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x03, 0xE0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x3C, 0x01, 0xF4,
-    0x00, 0x0F, 0x40, 0xF8, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x0F, 0x3E,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xAA, 0xFE, 0xA8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x05,
-    0x5F, 0x55, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x03, 0xFE, 0xBF, 0x00, 0x2F, 0x00, 0x04, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x7C,
-    0x00, 0xFC, 0x02, 0xF0, 0x01, 0xF0, 0x0B, 0xC0, 0x0B, 0x80, 0x1F, 0x80, 0x3D, 0x00, 0x2F, 0xD7,
-    0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x20, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x03, 0xDB, 0xC1, 0xF4, 0x90, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE5, 0xAF, 0x80, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x02, 0xFE, 0x40, 0xF0, 0x1D, 0x01, 0xFF,
-    0xFC, 0x07, 0x83, 0xC0, 0x3E, 0x01, 0x40, 0x2C, 0x38, 0x0B, 0xC0, 0x00, 0x01, 0xD7, 0x40, 0xF4,
-    0x00, 0x00, 0x0E, 0xB0, 0x0F, 0x00, 0x00, 0x00, 0xFB, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xB0, 0x0F,
-    0x00, 0x00, 0x00, 0xF7, 0x40, 0xF4, 0x00, 0x00, 0x0E, 0x38, 0x0B, 0x80, 0x00, 0x01, 0xD3, 0xC0,
-    0x7D, 0x00, 0x00, 0x2C, 0x2D, 0x02, 0xFF, 0xFC, 0x03, 0xC0, 0xF0, 0x07, 0xFF, 0x40, 0xF0, 0x07,
-    0xC0, 0x00, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x95, 0x6F, 0xD0, 0x00,
-    0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x8C,
-    0x0F, 0xAF, 0xC2, 0xD0, 0x78, 0x38, 0x07, 0x87, 0x40, 0x74, 0xB0, 0x0B, 0x0B, 0x00, 0xF0, 0xB4,
-    0x3E, 0x03, 0xEE, 0xD0, 0x1F, 0x48, 0x00, 0x00, 0x10, 0x01, 0x00, 0x1F, 0x02, 0xD0, 0x1F, 0x02,
-    0xF0, 0x2F, 0x42, 0xF0, 0x2F, 0x41, 0xF4, 0x2F, 0x41, 0xF8, 0x0B, 0xC0, 0xFC, 0x00, 0xF4, 0x2F,
-    0x00, 0x2F, 0x03, 0xD0, 0x03, 0xD0, 0xBC, 0x00, 0x7C, 0x0F, 0x40, 0x0F, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x40, 0x3F, 0xFF, 0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE5, 0xAF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x03,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x2F, 0xF9, 0x00, 0xF0, 0x1D, 0x03, 0xFF, 0xF8, 0x07, 0x83,
-    0xC0, 0x3D, 0x0B, 0xC0, 0x2C, 0x38, 0x03, 0xD0, 0x3D, 0x01, 0xD7, 0x40, 0x3D, 0x03, 0xD0, 0x0E,
-    0xB0, 0x03, 0xD0, 0x7C, 0x00, 0xFB, 0x00, 0x3F, 0xFF, 0x40, 0x0F, 0xB0, 0x03, 0xFF, 0xD0, 0x00,
-    0xF7, 0x40, 0x3D, 0x1F, 0x00, 0x0E, 0x38, 0x03, 0xD0, 0xF8, 0x01, 0xD3, 0xC0, 0x3D, 0x07, 0xC0,
-    0x2C, 0x2D, 0x03, 0xD0, 0x3E, 0x03, 0xC0, 0xF0, 0x3D, 0x00, 0xF4, 0xF0, 0x07, 0xC0, 0x00, 0x00,
-    0x3D, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x95, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xAF, 0xC3, 0xC0, 0x2E, 0x78, 0x00, 0xF7, 0x80,
-    0x0F, 0x78, 0x00, 0xE3, 0xD0, 0x3D, 0x0F, 0xFF, 0x80, 0x2F, 0x90, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x55, 0x6F, 0x55, 0x5F, 0xFF, 0xFF, 0xFF, 0xAA, 0xAF, 0xAA, 0xA0, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBE, 0x40, 0x7F, 0xFC, 0x02,
-    0x02, 0xE0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x01, 0xF0,
-    0x00, 0xBC, 0x00, 0x2E, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0x00, 0x01, 0xBE, 0x00, 0xBF, 0xFC,
-    0x01, 0x02, 0xD0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x16, 0xF4, 0x03, 0xFC, 0x00, 0x01, 0xF0, 0x00,
-    0x07, 0x80, 0x00, 0x78, 0x40, 0x0F, 0x4B, 0xEB, 0xF0, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x0F, 0xC0, 0xBC, 0x07, 0xC0, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x29, 0x00, 0x02, 0x80, 0x03, 0xD0,
-    0x00, 0xBC, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x0F, 0x40,
-    0x0F, 0x80, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00,
-    0x3D, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x2F, 0xC0, 0x07,
-    0xD0, 0x07, 0xF8, 0x00, 0xBF, 0x02, 0xEF, 0x40, 0x0F, 0xFF, 0xF8, 0xF0, 0x00, 0xF7, 0xFE, 0x0F,
-    0x00, 0x1F, 0x04, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8,
-    0x2C, 0x2F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8,
-    0x2C, 0x3F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8,
-    0x2C, 0x1F, 0xFF, 0xF8, 0x2C, 0x0F, 0xFF, 0xF8, 0x2C, 0x02, 0xFF, 0xF8, 0x2C, 0x00, 0x05, 0x78,
-    0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38,
-    0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38,
-    0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x24, 0x18, 0x18, 0x1F, 0xCB,
-    0xF2, 0xF8, 0x14, 0x00, 0x03, 0xC0, 0x1D, 0x00, 0xBE, 0x00, 0x3C, 0x00, 0xF1, 0xAF, 0x87, 0xF4,
-    0x00, 0x00, 0xA0, 0x1F, 0xC2, 0xFF, 0x1E, 0x78, 0x02, 0xD0, 0x0F, 0x00, 0x3C, 0x01, 0xF0, 0x0B,
-    0x80, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xFA, 0xF4, 0xB4,
-    0x0E, 0x38, 0x03, 0xDD, 0x00, 0xF7, 0x40, 0x39, 0xD0, 0x1D, 0x78, 0x0F, 0x0F, 0xEF, 0x00, 0x7E,
-    0x00, 0x02, 0x00, 0x50, 0x02, 0xE0, 0x3C, 0x00, 0x7C, 0x0B, 0x80, 0x0F, 0x81, 0xF0, 0x01, 0xF0,
-    0x3E, 0x00, 0x3E, 0x07, 0xC0, 0x0F, 0xC0, 0xF8, 0x0F, 0xC0, 0xFD, 0x0B, 0xC0, 0xBC, 0x07, 0xC0,
-    0xBC, 0x03, 0xD0, 0xBC, 0x01, 0xD0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01,
-    0xF0, 0x07, 0xF0, 0x00, 0x0F, 0x40, 0xBF, 0xC0, 0x00, 0xF8, 0x07, 0x9E, 0x00, 0x0B, 0xC0, 0x00,
-    0xB4, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x01,
-    0xF0, 0x00, 0x01, 0xE0, 0x0F, 0x00, 0xA0, 0x0B, 0x40, 0xF4, 0x0F, 0xC0, 0x3C, 0x0B, 0x80, 0xBF,
-    0x00, 0xF0, 0x7C, 0x07, 0xB8, 0x03, 0x83, 0xC0, 0x7A, 0xD0, 0x00, 0x3D, 0x03, 0xCF, 0x00, 0x02,
-    0xE0, 0x3C, 0x3C, 0x00, 0x1F, 0x03, 0xC0, 0xE0, 0x00, 0xF0, 0x2F, 0xAF, 0xE0, 0x0F, 0x40, 0xFF,
-    0xFF, 0xC0, 0xB8, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xB8, 0x00,
-    0x79, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x01, 0xE0, 0x0F, 0x06, 0xF8, 0x00,
-    0xB4, 0x0F, 0x4F, 0xFF, 0xC0, 0x3C, 0x0B, 0x81, 0x40, 0xF0, 0x0F, 0x07, 0xC0, 0x00, 0x3C, 0x03,
-    0x83, 0xC0, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x01,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0xB8,
-    0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0xFF, 0xF0, 0x3C, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01,
-    0xBF, 0x40, 0x00, 0x07, 0x80, 0x7F, 0xFD, 0x00, 0x00, 0xF0, 0x02, 0x01, 0xE0, 0x00, 0x3D, 0x00,
-    0x00, 0x0E, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xD0, 0x01, 0xF0, 0x00, 0x15, 0xF8, 0x00, 0x3C, 0x00,
-    0x02, 0xFD, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF4, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x02,
-    0x80, 0x00, 0x3C, 0x0F, 0x00, 0xFC, 0x00, 0x0B, 0x83, 0xD0, 0x3F, 0x87, 0xEB, 0xF0, 0xB8, 0x0B,
-    0xB4, 0x2F, 0xF8, 0x1F, 0x02, 0xDF, 0x00, 0x00, 0x03, 0xD0, 0x78, 0xF0, 0x00, 0x00, 0xF8, 0x0E,
-    0x0E, 0x00, 0x00, 0x2E, 0x03, 0xC1, 0xE0, 0x00, 0x07, 0xC0, 0xFE, 0xBF, 0x80, 0x00, 0xF4, 0x0F,
-    0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0x80, 0x01, 0xF0, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7E, 0x00, 0x20, 0x3F, 0xEB, 0xF8, 0x1F,
-    0xFF, 0xF4, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x3F, 0x0F,
-    0x00, 0x00, 0x1F, 0x43, 0xD0, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x03, 0xE0,
-    0x0F, 0x80, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xAA, 0xAB, 0xC0, 0x2F, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x0F, 0x87,
-    0xE0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xFD, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFB, 0xC0,
-    0x00, 0x00, 0x0B, 0xDF, 0x00, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00,
-    0x1F, 0x43, 0xD0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x3E, 0x00,
-    0xF8, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFA, 0xAA, 0xBC, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x0F, 0xC0,
-    0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xF8, 0xB8, 0x00, 0x00, 0x3D, 0x02, 0xD0, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x0F, 0xBC, 0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x0F, 0xC3, 0xC0,
-    0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0xF8,
-    0x03, 0xE0, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xEA, 0xAA, 0xF0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0xF4, 0x0F, 0xC0, 0x00,
-    0x0F, 0x81, 0xF8, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0x1F, 0xF4, 0x3C, 0x00, 0x00, 0x3E, 0xFF, 0xF4, 0x00, 0x00,
-    0x74, 0x1F, 0xE0, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xBC,
-    0x00, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00,
-    0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00,
-    0x0F, 0x80, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00,
-    0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0xF4, 0x3E, 0x00,
-    0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00, 0x50, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0xFB, 0xC0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x3C,
-    0x00, 0x00, 0x1F, 0x43, 0xD0, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x3E, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0xFC, 0x00,
-    0x00, 0xF8, 0x1F, 0x80, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x2C,
-    0x0E, 0x00, 0x00, 0x07, 0x87, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x3E, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xC3, 0xC0,
-    0x00, 0x07, 0xD0, 0xF4, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xF8, 0x03,
-    0xE0, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA,
-    0xAA, 0xF0, 0x0B, 0xC0, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x03, 0xE1, 0xF8,
-    0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFD, 0x55,
-    0x54, 0x00, 0x00, 0x01, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xF0, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xD0, 0x0F, 0xD5, 0x55, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBE,
-    0xAA, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x55, 0x54,
-    0x00, 0x2F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x41, 0x78,
-    0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x19, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x06, 0xBE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E,
-    0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E,
-    0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x0F, 0x40, 0xF0, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E,
-    0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x03, 0xC0, 0xF4, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x02, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00,
-    0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F,
-    0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x01,
-    0xF4, 0xF0, 0x00, 0x7C, 0x07, 0xC0, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x2F, 0x07,
-    0xC0, 0x00, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03,
-    0xF5, 0x6F, 0xF8, 0x00, 0x0F, 0x80, 0x07, 0xF4, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x00, 0xF8,
-    0x5B, 0xE5, 0x50, 0x03, 0xE3, 0xFF, 0xFF, 0x80, 0x1F, 0x4F, 0xFF, 0xFD, 0x00, 0xBD, 0x03, 0xE0,
-    0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x07,
-    0xF0, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x0B, 0xF4, 0x01, 0xF9, 0x56, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00,
-    0x3F, 0xE0, 0xB0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0xBF, 0x00, 0x00,
-    0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x01, 0xFB, 0xC0, 0x00, 0xBC,
-    0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x03,
-    0xD0, 0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x0F, 0x80,
-    0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00, 0x0F, 0x4B, 0xC0, 0x1F, 0x00, 0x0F,
-    0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xDF, 0x40, 0x3D, 0x00, 0x02, 0xFF,
-    0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0xB8, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x06, 0xFE, 0x00,
-    0x3F, 0x80, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xBD, 0x00,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x02,
-    0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x02, 0xF8, 0x1F, 0x80, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x06, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x02, 0xF8,
-    0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00,
-    0x2F, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF,
-    0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00,
-    0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x02, 0xF8, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x01, 0xFD,
-    0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x1E, 0x00, 0x00, 0x05, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x03,
-    0xFD, 0x06, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x1F, 0x80, 0x00, 0x00, 0xBC,
-    0xBD, 0x00, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x02,
-    0xF8, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x40, 0x00, 0x03, 0xFE, 0x0B, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xE0, 0x7F,
-    0xC0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x41, 0xBF, 0x80, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0xBE, 0x00,
-    0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0B,
-    0xC7, 0xE0, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x03, 0xF3, 0xF0,
-    0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00,
-    0x0F, 0xC2, 0xF0, 0x00, 0x00, 0xBE, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0x40,
-    0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x0F, 0xC2,
-    0xF0, 0x00, 0x00, 0x08, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x41, 0xBF, 0x80, 0x0F, 0xE0,
-    0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x03,
-    0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xC7, 0xE0, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0xBC,
-    0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0xBE, 0x07, 0xE0, 0x00, 0x03, 0xF0,
-    0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x14, 0x00, 0x01, 0x07, 0xC0, 0x00, 0x7C, 0x3F,
-    0x00, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x03, 0xF1, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x7E, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x07, 0xE0,
-    0x00, 0xFC, 0x28, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0xBF, 0xF8, 0x3E, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFE, 0x00,
-    0x0B, 0xF0, 0x02, 0xF8, 0x00, 0x1F, 0xF8, 0x03, 0xF0, 0x00, 0x3E, 0xFC, 0x0B, 0xD0, 0x00, 0xFC,
-    0xBC, 0x0F, 0xC0, 0x02, 0xF0, 0xBC, 0x1F, 0x40, 0x07, 0xD0, 0xBC, 0x2F, 0x00, 0x1F, 0x80, 0xBC,
-    0x2F, 0x00, 0x3E, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x00, 0xFC, 0x3F, 0x02, 0xF0, 0x00, 0xF8, 0x3F,
-    0x07, 0xD0, 0x02, 0xF4, 0x3F, 0x1F, 0x80, 0x03, 0xF0, 0x2F, 0x7E, 0x00, 0x07, 0xE0, 0x1F, 0xFC,
-    0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3E, 0x2F, 0xFF, 0x80, 0x00, 0x2C, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x0F,
-    0x80, 0x7C, 0x00, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x3E,
-    0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x0F, 0x40,
-    0x7C, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00,
-    0x00, 0x7D, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0xBC, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x3D, 0x02,
-    0xF0, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00,
-    0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xBC,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x7C, 0x02, 0xF0,
-    0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x03,
-    0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x3C, 0x00, 0x00, 0x04, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x03, 0xF0,
-    0x0F, 0x40, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x01, 0xF0, 0x0F, 0xC0,
-    0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07,
-    0xD0, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x1F,
-    0x40, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00,
-    0x0F, 0x80, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x00,
-    0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x00, 0x24,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F,
-    0x00, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0xBC,
-    0x00, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x2F, 0x00,
-    0xF8, 0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0xFC,
-    0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xD0,
-    0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8, 0x00,
-    0x03, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x80, 0x2F, 0x00, 0x7F, 0x00, 0xF8,
-    0x00, 0x7E, 0x03, 0xD0, 0x00, 0xFC, 0x1F, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x0F, 0x83, 0xF0, 0x00,
-    0x7D, 0x0F, 0x80, 0x03, 0xF0, 0x3D, 0x00, 0x7F, 0x41, 0xFE, 0xFF, 0xF8, 0x0B, 0xFF, 0xFE, 0x00,
-    0x3F, 0x55, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0xF4,
-    0x0B, 0xE0, 0x00, 0x00, 0x7C, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xC2,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0x7C, 0x01,
-    0xFD, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00,
-    0x2F, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x14, 0x02,
-    0xF8, 0x00, 0x0F, 0x8B, 0xFF, 0xFC, 0x00, 0x03, 0xD0, 0xFF, 0xF8, 0x00, 0x01, 0xF4, 0x01, 0x40,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07,
-    0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07,
-    0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0x8B,
-    0x80, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07,
-    0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x1F, 0xF4, 0x38, 0x00, 0x3E, 0xFF, 0xF4, 0x00, 0x74, 0x1F,
-    0xE0, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC,
-    0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B,
-    0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF,
-    0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x40, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x05, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F,
-    0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03,
-    0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F,
-    0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xEF,
-    0x00, 0x00, 0x0B, 0x03, 0x80, 0x00, 0x0B, 0x03, 0x80, 0x00, 0x07, 0x87, 0x40, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC,
-    0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B,
-    0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF,
-    0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xD0,
-    0x60, 0xBF, 0x40, 0x03, 0xFF, 0xE3, 0xDF, 0xFF, 0x80, 0x3F, 0x96, 0xEF, 0xF8, 0x7F, 0x02, 0xF8,
-    0x03, 0xFF, 0x00, 0x7D, 0x0F, 0xC0, 0x0B, 0xF0, 0x01, 0xF0, 0xBC, 0x00, 0x1F, 0x80, 0x0F, 0xC3,
-    0xF0, 0x00, 0xBC, 0x01, 0xFD, 0x0F, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x7D, 0x00, 0x0F, 0xFF, 0xF4,
-    0x02, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x7C, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0xBF, 0xC0, 0x19, 0x03, 0xFF, 0xF2,
-    0xEF, 0xFF, 0xF4, 0x03, 0xFE, 0x0F, 0x1F, 0xFF, 0x80, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xD5, 0xA0, 0x2F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x08, 0x01, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0xB4, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x3C, 0x00, 0x02, 0xBE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE0, 0x00, 0xBF, 0xFF, 0x00, 0xFE, 0x4B, 0xE0, 0xBD, 0x00, 0xF8, 0x3E, 0x00,
-    0x3E, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x6F, 0x87, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x00, 0xBD, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x18, 0x07, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0x92, 0xF8, 0x0B, 0xD0, 0x0F, 0x80, 0xF8,
-    0x00, 0xF8, 0x2F, 0x00, 0x1F, 0x43, 0xE0, 0x1B, 0xE0, 0x7F, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x00,
-    0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x18, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xBC, 0x7C, 0x00, 0xB8, 0x0B, 0x80, 0x10, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0xBF, 0xFF, 0x00, 0xFE, 0x4B, 0xE0, 0xBD, 0x00, 0xF8,
-    0x3E, 0x00, 0x3E, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x6F, 0x87, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x18,
-    0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x01, 0x00, 0x0F, 0x82,
-    0xF0, 0x03, 0xE0, 0xFC, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x02, 0xFF, 0xFC, 0x03, 0xF9, 0x2F, 0x82, 0xF4, 0x03, 0xE0, 0xF8, 0x00, 0xF8, 0xBC, 0x00,
-    0x7D, 0x3E, 0x01, 0xBE, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x60, 0x1F, 0xFF, 0xFC, 0x01, 0xFF,
-    0xF8, 0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0xA4, 0x00, 0xF4, 0x01, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03,
-    0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x2F, 0x00, 0x3E,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x7C,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xF8, 0x01, 0xF4, 0xF0, 0x1F, 0x01,
-    0xF0, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0x07, 0xC0, 0xFC, 0x2F, 0x00, 0x80, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x38, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x1B, 0xA1, 0xF0, 0x01, 0xFF, 0xFD, 0xF0, 0x07, 0xF5, 0x6F, 0xF0,
-    0x1F, 0x80, 0x0B, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x03, 0xF0,
-    0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x1F, 0x40,
-    0x3F, 0x00, 0xBE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0xFF, 0x43, 0xC0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x38, 0x1F,
-    0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0xFE, 0x00, 0x03, 0xC7,
-    0xFF, 0xE0, 0x01, 0xF7, 0xE5, 0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0x40, 0x3F, 0xC0, 0x07, 0xD0, 0x0F,
-    0xC0, 0x02, 0xF0, 0x07, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x0F, 0x80,
-    0x3F, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x02, 0xF0, 0x07, 0xD0, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x3E,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x0F, 0xE5, 0xBF, 0x00, 0xBD, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x02, 0xF0, 0xF8,
-    0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00,
-    0x1F, 0x47, 0xC0, 0x00, 0xFC, 0x1F, 0x80, 0x07, 0xD0, 0x3F, 0x40, 0xBE, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0xE5, 0xBF, 0x00, 0xBD, 0x00,
-    0x7E, 0x07, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x2F,
-    0x1F, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xFC, 0x1F,
-    0x80, 0x07, 0xD0, 0x3F, 0x40, 0xBE, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xC3,
-    0xC0, 0x00, 0x7C, 0x07, 0xC0, 0x01, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x0F, 0xE5, 0xBF, 0x00, 0xBD, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0xFC, 0x2F,
-    0x00, 0x02, 0xF0, 0xF8, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0xFC, 0xBC, 0x00,
-    0x03, 0xE2, 0xF0, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xFC, 0x1F, 0x80, 0x07, 0xD0, 0x3F, 0x40, 0xBE,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10,
-    0x00, 0xFF, 0x82, 0xC0, 0x0B, 0xFF, 0xFE, 0x00, 0x3C, 0x0F, 0xF0, 0x00, 0x40, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xF9, 0x6F, 0xC0, 0x2F, 0x40,
-    0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0xBC, 0x3E, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x0B,
-    0xC7, 0xC0, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD1, 0xF0, 0x00, 0x3F, 0x07,
-    0xE0, 0x01, 0xF4, 0x0F, 0xD0, 0x2F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x02,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x2F, 0xFF,
-    0xC0, 0x03, 0xF9, 0x6F, 0xC0, 0x2F, 0x40, 0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0xBC,
-    0x3E, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0xF8, 0xBC,
-    0x00, 0x07, 0xD1, 0xF0, 0x00, 0x3F, 0x07, 0xE0, 0x01, 0xF4, 0x0F, 0xD0, 0x2F, 0x80, 0x0F, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x54, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x06, 0xFA, 0x2D, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFE, 0x57, 0xF4, 0x02, 0xF4, 0x03, 0xF8, 0x03,
-    0xD0, 0x0F, 0xFC, 0x0B, 0xC0, 0x3E, 0xBC, 0x0F, 0x40, 0xBC, 0x7C, 0x1F, 0x01, 0xF0, 0xBC, 0x1F,
-    0x03, 0xD0, 0xBC, 0x2F, 0x0F, 0x40, 0xF8, 0x2F, 0x3E, 0x00, 0xF0, 0x1F, 0xBC, 0x02, 0xF0, 0x0F,
-    0xF0, 0x07, 0xD0, 0x0F, 0xE0, 0x1F, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x3E, 0xBF, 0xF4, 0x00, 0x1C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B,
-    0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F,
-    0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D,
-    0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F,
-    0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B,
-    0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F,
-    0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D,
-    0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F,
-    0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x10, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B,
-    0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F,
-    0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D,
-    0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F,
-    0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x0F, 0x82, 0xF0, 0x00,
-    0x0F, 0x43, 0xE0, 0x00, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F,
-    0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F,
-    0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C,
-    0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x01, 0xF4,
-    0x00, 0x3F, 0x00, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7C,
-    0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00,
-    0x0F, 0x0B, 0xC0, 0x00, 0x00, 0x3C, 0x3E, 0x00, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0x00, 0x03, 0xDF,
-    0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x2F, 0x80, 0x00, 0x3D, 0x7F, 0xFD, 0x00, 0x1F, 0x7D, 0x6F, 0xC0, 0x0B, 0xF8, 0x02,
-    0xF4, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x03, 0xD0, 0x1F, 0x00,
-    0x01, 0xF4, 0x0B, 0xC0, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x3E,
-    0x00, 0x0B, 0xC0, 0x1F, 0xC0, 0x07, 0xE0, 0x0B, 0xF8, 0x07, 0xF0, 0x03, 0xEB, 0xFF, 0xF0, 0x00,
-    0xF4, 0xBF, 0xE0, 0x00, 0x7D, 0x01, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x1F, 0x43, 0xE0,
-    0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x2A, 0x00, 0x1F, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00,
-    0x7D, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00,
-    0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x03, 0xC2, 0xF0, 0x00, 0x00, 0x0F,
-    0x0F, 0x80, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFB, 0xC0,
-    0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x1F,
-    0x43, 0xD0, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x3E, 0x00,
-    0x01, 0xF0, 0x02, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA,
-    0xAF, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xF8, 0x1F,
-    0x80, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07,
-    0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xF0,
-    0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00,
-    0x07, 0xD0, 0xF4, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x0F, 0x80,
-    0x3E, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x03, 0xF0,
-    0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x08, 0x00, 0x60, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF,
-    0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00,
-    0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02,
-    0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3E, 0xF0, 0x00,
-    0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x07, 0xD0, 0xF4,
-    0x00, 0x03, 0xF0, 0x3D, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x7C, 0x00,
-    0xBC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0xF0, 0x0B, 0xC0,
-    0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0xF8, 0xFC,
-    0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x40, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F,
-    0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03,
-    0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F,
-    0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xE4, 0x17, 0x80, 0x2F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x01, 0x90, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xD5, 0xA0,
-    0x0B, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x3F, 0x40, 0x20, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03,
-    0xE2, 0xE0, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xE4, 0x17, 0x80, 0x2F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x01, 0x90, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xF8, 0xB8, 0x00, 0xF4, 0x0F, 0x40, 0x10, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0xFF, 0x00, 0xFF, 0x56, 0x80, 0xBE, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x20, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0x90,
-    0x5E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x06, 0x40, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x02, 0xFF, 0xFC, 0x03, 0xFD, 0x5A, 0x02,
-    0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0xFD, 0x00, 0x80, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x40,
-    0x01, 0x00, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE4, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xE4, 0x17, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x01, 0x90, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x03, 0xC0, 0x7C,
-    0x00, 0x1F, 0x2F, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xD5, 0xA0, 0x0B, 0xE0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F,
-    0x40, 0x20, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x40, 0x00, 0x07, 0x80, 0xB8, 0x00, 0x00, 0x3D, 0x3E, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE4,
-    0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xD5, 0xBF, 0xE0, 0x00, 0xF8, 0x00, 0x7F, 0x40, 0x1F,
-    0x40, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x3D, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x7D, 0x0F, 0xC0,
-    0x00, 0x0B, 0xD0, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x02, 0xF4,
-    0x2F, 0x00, 0x00, 0x7F, 0x03, 0xE0, 0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x0B, 0xF4, 0x07, 0xE5, 0x5B,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF1,
-    0xF0, 0x00, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x01, 0xBE, 0x0B, 0xC0, 0x00, 0x00, 0xBF, 0xFC, 0xBC, 0x00, 0x00, 0x3F, 0x95, 0xFF,
-    0x80, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00,
-    0x7D, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00,
-    0x2F, 0x80, 0x00, 0x07, 0xC0, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x02, 0xEF, 0x40, 0x00, 0x02, 0xFF,
-    0xF8, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03, 0xF5, 0x6F, 0xF8, 0x00, 0x0F, 0x80,
-    0x07, 0xF4, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x1F,
-    0x40, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x5B, 0xE5, 0x50, 0x03, 0xE3, 0xFF,
-    0xFF, 0x80, 0x1F, 0x4F, 0xFF, 0xFD, 0x00, 0xBD, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00,
-    0x0F, 0x80, 0x7C, 0x00, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x7F, 0x00,
-    0x3E, 0x00, 0x0B, 0xF4, 0x01, 0xF9, 0x56, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x0A, 0xAB, 0xFA, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0x57, 0xE4, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x01, 0xBE, 0x0B, 0xC0, 0x00, 0xFF, 0xFC, 0xBC, 0x00, 0x3F, 0x91, 0xFF, 0x80,
-    0x0B, 0xE0, 0x07, 0xF4, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x3E, 0x00, 0x3D, 0x00, 0x03, 0xE0, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x2F, 0x80, 0x07, 0xC0, 0x0B, 0xF4, 0x00, 0x3F, 0x02, 0xEF,
-    0x40, 0x02, 0xFF, 0xF8, 0xF0, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0x92, 0xF8, 0x2F, 0x40, 0x3E, 0x0F, 0x80, 0x0F,
-    0x8B, 0xC0, 0x07, 0xD3, 0xE0, 0x1B, 0xE1, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x2F, 0x40, 0x00,
-    0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x14, 0x00, 0x07, 0x40, 0x78,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x24, 0x01, 0x80, 0x03, 0xC0, 0x3C, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0,
-    0x03, 0xF9, 0x2F, 0x80, 0xBD, 0x00, 0xF8, 0x0F, 0x80, 0x0F, 0x82, 0xF0, 0x01, 0xF4, 0x3E, 0x01,
-    0xBE, 0x07, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF4, 0x01, 0x80, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x02, 0xFF, 0xFC, 0x03, 0xF9, 0x2F, 0x82, 0xF4,
-    0x03, 0xE0, 0xF8, 0x00, 0xF8, 0xBC, 0x00, 0x7D, 0x3E, 0x01, 0xBE, 0x1F, 0xFF, 0xFE, 0x07, 0xFF,
-    0xF8, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFD,
-    0x00, 0x60, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x3E, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1B, 0xF8, 0x00,
-    0x2F, 0xFF, 0xC0, 0x3F, 0x92, 0xF8, 0x2F, 0x40, 0x3E, 0x0F, 0x80, 0x0F, 0x8B, 0xC0, 0x07, 0xD3,
-    0xE0, 0x1B, 0xE1, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0,
-    0x00, 0x17, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x40,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0xC0, 0x7C, 0x00,
-    0x02, 0xE2, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00,
-    0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F,
-    0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x50, 0x03, 0xD0, 0x3D, 0x00, 0x0F,
-    0x1F, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0x92, 0xF8, 0x0B, 0xD0, 0x0F, 0x80, 0xF8, 0x00,
-    0xF8, 0x2F, 0x00, 0x1F, 0x43, 0xE0, 0x1B, 0xE0, 0x7F, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x00, 0xBD,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x18,
-    0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x01, 0xF0,
-    0x1F, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFD, 0x45, 0xBC, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xFF, 0xF0, 0xFC, 0x00, 0x2F, 0xFF,
-    0x0F, 0xC0, 0x01, 0x57, 0xF0, 0xFC, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0xBC, 0x00,
-    0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x00, 0xF8, 0x01, 0xFE, 0x00, 0x1F, 0x40,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0x8B, 0x80, 0x00,
-    0x0F, 0x40, 0xF0, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28,
-    0x00, 0x3F, 0xFF, 0x1F, 0x00, 0x3F, 0xD5, 0xFF, 0x80, 0x2F, 0x80, 0x1F, 0xD0, 0x0F, 0xC0, 0x03,
-    0xF0, 0x0B, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x7D, 0x00,
-    0x07, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0xBE, 0x00, 0x7C,
-    0x00, 0xBF, 0x40, 0x0F, 0xC0, 0xBB, 0xD0, 0x02, 0xFF, 0xF9, 0xF0, 0x00, 0x2F, 0xF4, 0xBC, 0x00,
-    0x00, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0,
-    0x01, 0xE4, 0x0B, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x02, 0x40, 0x00, 0x0B, 0x00, 0xB4, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xD4, 0x5B, 0xC0, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xFF, 0x0F, 0xC0, 0x02, 0xFF, 0xF0, 0xFC,
-    0x00, 0x15, 0x7F, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x07,
-    0xC0, 0x7E, 0x00, 0x00, 0xBC, 0x03, 0xF4, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x01, 0xF4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18,
-    0x00, 0x01, 0xD0, 0x1E, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0xA0, 0x00, 0xFF, 0xFC, 0x7C, 0x00, 0xFF,
-    0x57, 0xFE, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x0B, 0xC0,
-    0x2F, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x02, 0xF8, 0x01, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0x02, 0xEF,
-    0x40, 0x0B, 0xFF, 0xE7, 0xC0, 0x00, 0xBF, 0xD2, 0xF0, 0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x07, 0x90, 0x2F, 0xC0, 0x01, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xD4, 0x5B,
-    0xC0, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x1F, 0xFF, 0x0F, 0xC0, 0x02, 0xFF, 0xF0, 0xFC, 0x00, 0x15, 0x7F, 0x0F, 0xC0, 0x00,
-    0x03, 0xE0, 0xFC, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x00, 0xBC, 0x03,
-    0xF4, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x01, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0x80, 0xA0, 0x00, 0xFF, 0xFC, 0x7C, 0x00, 0xFF, 0x57, 0xFE, 0x00, 0xBE, 0x00, 0x7F,
-    0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xE0, 0x00,
-    0x3E, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0B, 0xC0,
-    0x02, 0xF8, 0x01, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0x02, 0xEF, 0x40, 0x0B, 0xFF, 0xE7, 0xC0, 0x00,
-    0xBF, 0xD2, 0xF0, 0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x07, 0x90, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFD, 0x45, 0xBC, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xFF, 0xF0, 0xFC, 0x00, 0x2F, 0xFF, 0x0F, 0xC0, 0x01, 0x57,
-    0xF0, 0xFC, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00, 0x7C, 0x07, 0xE0,
-    0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x00, 0xF8, 0x01, 0xFE, 0x00, 0x1F, 0x40, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0x3F, 0xFF, 0x1F, 0x00, 0x3F, 0xD5, 0xFF, 0x80,
-    0x2F, 0x80, 0x1F, 0xD0, 0x0F, 0xC0, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0xF8, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00,
-    0xFC, 0x02, 0xF0, 0x00, 0xBE, 0x00, 0x7C, 0x00, 0xBF, 0x40, 0x0F, 0xC0, 0xBB, 0xD0, 0x02, 0xFF,
-    0xF9, 0xF0, 0x00, 0x2F, 0xF4, 0xBC, 0x00, 0x00, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xE4, 0x0B, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x06, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x00, 0xF8,
-    0x03, 0xE0, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x7D, 0x00, 0x00, 0xBC, 0x02, 0xF0,
-    0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x01,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFD, 0x55, 0x55, 0xF8, 0x03,
-    0xE0, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x02, 0xF0, 0x00,
-    0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x01, 0xF0,
-    0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xF8, 0x2F, 0xD0, 0x00, 0xF5, 0xFF, 0xF8, 0x01, 0xF7, 0xD5, 0xFC, 0x02, 0xFE,
-    0x00, 0x7C, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x07, 0xD0,
-    0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x0F, 0x40,
-    0x02, 0xF0, 0x1F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x07, 0xC0, 0x3D, 0x00,
-    0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00,
-    0x0F, 0x40, 0x57, 0xE5, 0x55, 0x5B, 0xE5, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x07,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x55, 0x55, 0x7E,
-    0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40,
-    0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xBF, 0xAA,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xBD, 0x55, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x1A,
-    0x80, 0x00, 0xF4, 0xFF, 0xF4, 0x01, 0xF7, 0xE6, 0xFC, 0x02, 0xFF, 0x00, 0xBC, 0x02, 0xFC, 0x00,
-    0x7C, 0x03, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xF8, 0x0B, 0xC0, 0x00,
-    0xF8, 0x0F, 0x80, 0x01, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x00, 0x03,
-    0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x05, 0x00,
-    0x10, 0x00, 0xBF, 0x81, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x3C, 0x0B, 0xF0, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0x40, 0x04, 0x0B, 0xF8, 0x2C, 0x1F, 0xFF, 0xFC, 0x3C, 0x0F, 0xF0, 0x10,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0,
-    0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x15, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xC0, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x14, 0x00, 0x90, 0x02, 0xC0, 0x2D, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x05, 0x00, 0x24, 0x3C, 0x02, 0xC0, 0xBF, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x0B, 0xD4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0xF4, 0x00, 0x7D, 0x00,
-    0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03,
-    0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0xB4, 0x00, 0xF0,
-    0x00, 0xB4, 0x00, 0x3C, 0x00, 0x0F, 0x90, 0x01, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xFF,
-    0x80, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xA4, 0x03, 0xD0, 0x1F, 0x40, 0xBC, 0x02, 0xF0, 0x0F, 0x80,
-    0x3D, 0x01, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0xBC, 0x03, 0xE0, 0x0F,
-    0x40, 0x00, 0x3F, 0xFF, 0x00, 0xF4, 0x01, 0xFF, 0xF8, 0x03, 0xD0, 0x00, 0x7D, 0x00, 0x1F, 0x00,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0xF4,
-    0x00, 0x7D, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x3E,
-    0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00,
-    0x7C, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x0B, 0xFF, 0x80, 0x3E, 0x00,
-    0x7F, 0xFF, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x28,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x01, 0xA0, 0x00, 0xF4,
-    0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0,
-    0x07, 0xC0, 0x03, 0xD0, 0x0B, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0,
-    0x1F, 0x40, 0x0F, 0x80, 0x1F, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x2F, 0x00,
-    0x3D, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x47, 0xE0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x01, 0xF4, 0xF0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x0B, 0xC0, 0x01,
-    0xF8, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x01, 0xF4, 0x07, 0xE0, 0x00, 0x2F,
-    0x01, 0xF8, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0x03, 0xD7, 0xE0, 0x00,
-    0x00, 0x7D, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x0F, 0xC1,
-    0xF4, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00,
-    0x3E, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x0F, 0xC0, 0x02, 0xF0,
-    0x3F, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x07, 0xEF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xE3, 0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x1F, 0x40,
-    0xF8, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3D, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xA4,
-    0x00, 0xA8, 0x00, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x0F, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x03, 0xF0,
-    0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x0F, 0xE3, 0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x1F, 0x00,
-    0xBC, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01,
-    0xF4, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x7F, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFC, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00,
-    0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x7E, 0x55, 0x54, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0x80, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x1F,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0x1F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x02, 0xF0, 0x0F, 0x80, 0x0F, 0x80, 0x7C, 0x00, 0x3D,
-    0x03, 0xC0, 0x01, 0xF4, 0x1D, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xE5, 0x55, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xE0, 0x03, 0xE1, 0xF0, 0x00, 0xF8, 0xF4, 0x00,
-    0x7D, 0x78, 0x00, 0x1F, 0x14, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x04, 0x0B, 0xC0, 0x3E, 0x0F, 0xC0,
-    0x3E, 0x0F, 0x80, 0x28, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x05, 0x00, 0xFC, 0xBC, 0x03, 0xE3, 0xF0,
-    0x0F, 0x46, 0x40, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00,
-    0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0xB0, 0x00, 0x7E, 0xFC, 0x00, 0x2F, 0xF8, 0x00,
-    0x1F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF9, 0x55, 0x50, 0xBF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x0B,
-    0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7D, 0x40, 0x2F, 0xF0, 0x0F, 0xFC, 0x07, 0xF4, 0x0F, 0xF4,
-    0x0B, 0xFC, 0x00, 0x6F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00,
-    0x0F, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0xBF, 0x00,
-    0x00, 0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x01, 0xFB, 0xC0, 0x00,
-    0xBC, 0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03, 0xD1, 0xF0, 0x01, 0xF0,
-    0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x0F,
-    0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00, 0x0F, 0x4B, 0xC0, 0x1F, 0x00,
-    0x0F, 0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xDF, 0x40, 0x3D, 0x00, 0x02,
-    0xFF, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0xB8, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2F,
-    0xE0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xF7, 0xE5, 0xFC, 0x02, 0xFF, 0x00, 0xBD, 0x03, 0xFC, 0x00,
-    0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0xFC, 0x0B, 0xC0, 0x00,
-    0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xF0, 0x2F, 0x00, 0x03,
-    0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00,
-    0x00, 0x2E, 0x00, 0xBF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00,
-    0x7C, 0x01, 0xFB, 0xC0, 0x00, 0xBC, 0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4,
-    0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B,
-    0xC0, 0x7C, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00,
-    0x0F, 0x4B, 0xC0, 0x1F, 0x00, 0x0F, 0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03,
-    0xDF, 0x40, 0x3D, 0x00, 0x02, 0xFF, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE,
-    0x00, 0xB8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2F,
-    0xE0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xF7, 0xE5, 0xFC, 0x02, 0xFF, 0x00, 0xBD, 0x03, 0xFC, 0x00,
-    0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0xFC, 0x0B, 0xC0, 0x00,
-    0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xF0, 0x2F, 0x00, 0x03,
-    0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00,
-    0x3D, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x2E, 0x00, 0xBF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C,
-    0x01, 0xFB, 0xC0, 0x00, 0xBC, 0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03,
-    0xD1, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0,
-    0x7C, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00, 0x0F,
-    0x4B, 0xC0, 0x1F, 0x00, 0x0F, 0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xDF,
-    0x40, 0x3D, 0x00, 0x02, 0xFF, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00,
-    0xB8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0xF1,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA0, 0x2F, 0xE0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xF7, 0xE5, 0xFC, 0x02, 0xFF, 0x00,
-    0xBD, 0x03, 0xFC, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0xFC, 0x07, 0xD0, 0x00,
-    0xFC, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x1F, 0x40, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B,
-    0xC0, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x4A, 0x42, 0xFE, 0x07, 0x83, 0xD3, 0xFF, 0xF0, 0x40,
-    0xFB, 0xE5, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0x80, 0x2F, 0xC0, 0x03, 0xE0, 0x0F, 0xE0, 0x01, 0xF4,
-    0x03, 0xF0, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x03,
-    0xE0, 0x0F, 0xC0, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x7D, 0x00,
-    0x0F, 0xC0, 0x2F, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2E,
-    0x00, 0xBF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x01,
-    0xFB, 0xC0, 0x00, 0xBC, 0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03, 0xD1,
-    0xF0, 0x01, 0xF0, 0x03, 0xC0, 0xF4, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x7C,
-    0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x1F, 0x07, 0xC0, 0x0F, 0x00, 0x0F, 0x4B,
-    0xC0, 0x1F, 0x00, 0x0B, 0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xEF, 0x40,
-    0x3D, 0x00, 0x02, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0xB8,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x64,
-    0x00, 0x00, 0x00, 0xA0, 0x2F, 0xD0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xF7, 0xD5, 0xFC, 0x02, 0xFE,
-    0x00, 0x7C, 0x02, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x07, 0xD0,
-    0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x0F, 0x40,
-    0x02, 0xF0, 0x1F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x07, 0xC0, 0x3D, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x04, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x1B, 0xF8, 0x00,
-    0xFE, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00,
-    0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x0B,
-    0xCB, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xE3, 0xF0,
-    0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x0B, 0xE0, 0x7E, 0x00, 0x00,
-    0x3F, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x01, 0xFE, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x3F, 0x96, 0xFC, 0x02, 0xF4, 0x01, 0xF8, 0x1F, 0x80, 0x03, 0xF0, 0xBC, 0x00, 0x0B, 0xC3,
-    0xE0, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xBC, 0x7C, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0,
-    0x00, 0x7D, 0x1F, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x1F, 0x40, 0xFD, 0x02, 0xF8, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x03,
-    0xC0, 0x3C, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0x41, 0xBF, 0x80, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xC7, 0xE0, 0x00, 0x00, 0x2F,
-    0x2F, 0x40, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0,
-    0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00,
-    0xBE, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x1F, 0xE0, 0x0B, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x90, 0x00, 0xF0, 0x0B, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xF9, 0x6F, 0xC0,
-    0x2F, 0x40, 0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0xBC, 0x3E, 0x00, 0x02, 0xF1, 0xF4,
-    0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD1, 0xF0, 0x00,
-    0x3F, 0x07, 0xE0, 0x01, 0xF4, 0x0F, 0xD0, 0x2F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00,
-    0x00, 0x0F, 0x83, 0xE0, 0x00, 0x00, 0x2E, 0x0B, 0x80, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0x00,
-    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0x41, 0xBF, 0x80, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x07,
-    0xE0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x7E, 0x00, 0x00, 0x02, 0xF0, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x01,
-    0xFD, 0x00, 0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00,
-    0x2F, 0x0F, 0x80, 0x00, 0x1F, 0x0B, 0x80, 0x00, 0x1E, 0x07, 0x80, 0x00, 0x01, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xFE, 0x5B, 0xF0,
-    0x00, 0xBD, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00,
-    0xBC, 0x07, 0xD0, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x03, 0xE0, 0x2F, 0x00,
-    0x01, 0xF4, 0x07, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFD, 0x01, 0xFD, 0x55, 0x54, 0x03, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xFF, 0xFE,
-    0x02, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x03, 0xF5, 0x55, 0x40, 0x3F, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x7E, 0x55, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x6F, 0xD0, 0x00, 0xBF, 0xFF, 0x43, 0xFF, 0xF8, 0x03, 0xF9, 0x6F, 0xCF, 0xE5, 0xFC, 0x0B, 0xD0,
-    0x03, 0xFF, 0x00, 0x3D, 0x0F, 0x80, 0x02, 0xFC, 0x00, 0x3D, 0x2F, 0x00, 0x02, 0xF8, 0x00, 0xBC,
-    0x3E, 0x00, 0x02, 0xF0, 0x07, 0xF4, 0x7D, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x7C, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7C, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0xBE, 0xFC, 0x01, 0x90,
-    0x0F, 0xFF, 0xF8, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B, 0xFC, 0x00, 0xF8, 0x00, 0xBD, 0x01, 0xF4,
-    0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x7D, 0x03, 0xD0,
-    0x00, 0xFC, 0x07, 0xC0, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0x95,
-    0xF8, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x0B, 0xD0, 0xBC, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0xF4, 0x00, 0xF1,
-    0xFF, 0x00, 0x1F, 0x7E, 0x60, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B, 0xFC, 0x00,
-    0xF8, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x03,
-    0xE0, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0xFC, 0x07, 0xC0, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFD, 0x00, 0x0F, 0x95, 0xF8, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x2F,
-    0x00, 0x3F, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x0F, 0xC0, 0x7C,
-    0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xD0, 0x03, 0xC7, 0xFC, 0x00, 0x7D, 0xF9, 0x80, 0x0B, 0xF8,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0xF1, 0xF4,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B, 0xFC, 0x00, 0xF8, 0x00, 0xBD,
-    0x01, 0xF4, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x7D,
-    0x03, 0xD0, 0x00, 0xFC, 0x07, 0xC0, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x00,
-    0x0F, 0x95, 0xF8, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x3F, 0x00,
-    0x3E, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x0B, 0xD0,
-    0xBC, 0x00, 0x03, 0xE0, 0x00, 0x14, 0x00, 0x50, 0x00, 0xB4, 0x0B, 0x80, 0x00, 0xF4, 0xF8, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x0B, 0xD0, 0x00, 0xF1, 0xFF, 0x00, 0x07, 0xDF, 0x98, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0xFF, 0x41, 0xB8, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x74,
-    0x01, 0xBF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFF, 0xFF, 0x02, 0xF9, 0x1B, 0x40,
-    0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0,
-    0x90, 0x03, 0xF0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xE2, 0xE0, 0x00, 0x0F, 0x40,
-    0xF4, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0xFF, 0x41, 0xB8, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x80, 0x74, 0x01, 0xBF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xF4, 0xF4, 0x01, 0xF0,
-    0x0F, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFF, 0xFF, 0x02, 0xF9,
-    0x1B, 0x40, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xD0, 0x90, 0x03, 0xF0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0x41, 0xB8, 0x01,
-    0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x74, 0x01, 0xBF, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x06, 0xBD, 0x00, 0x00, 0x0B,
-    0xE4, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0xBF, 0xFF, 0xC0, 0xBE, 0x46, 0xD0, 0x3F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x24, 0x00, 0xFC,
-    0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x06, 0xBD, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0xFF, 0x41, 0xB8, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x80, 0x74, 0x01, 0xBF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x07, 0x80, 0xBC, 0x00, 0x2E, 0x3E, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x02, 0xFF,
-    0xFF, 0x00, 0xBE, 0x46, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x90, 0x03, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x5F,
-    0xD5, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x6B, 0xD0,
-    0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x03, 0xC0, 0x00, 0x2F,
-    0x00, 0x06, 0xFE, 0xA4, 0xBF, 0xFF, 0xD0, 0x6F, 0x55, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x02, 0xD0, 0x00,
-    0x0F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0xAF, 0xC0, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x1F, 0x40, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x5F, 0xD5, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x75, 0xE0,
-    0x00, 0xF1, 0x40, 0x02, 0xF0, 0x00, 0x1B, 0xFA, 0x90, 0xBF, 0xFF, 0xD0, 0x1B, 0xD5, 0x40, 0x0B,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x15, 0x5F, 0xD5, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2A, 0xBF, 0xA9,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x15, 0xFD, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x06, 0xFE, 0xA4, 0xBF, 0xFF, 0xD0, 0x6F, 0x55,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x0B, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0xFF,
-    0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x01, 0x40, 0x00, 0x0B, 0xFC, 0x1D,
-    0x00, 0x00, 0x3E, 0xFF, 0xF0, 0x00, 0x02, 0xC0, 0xBF, 0x40, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00,
-    0x03, 0xE0, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x02, 0xF0,
-    0x0F, 0x80, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x01, 0xF4, 0x0B, 0xC0,
-    0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x03,
-    0xD0, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B,
-    0xC0, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x04,
-    0x00, 0x0F, 0xF4, 0x3C, 0x00, 0x3E, 0xFF, 0xF4, 0x00, 0x38, 0x1F, 0xE0, 0x00, 0x10, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8,
-    0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0,
-    0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00,
-    0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xF0,
-    0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x0B, 0xC0,
-    0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0x03,
-    0xE0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x0F,
-    0x80, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00,
-    0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x0F, 0xC0,
-    0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x05, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8,
-    0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0,
-    0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00,
-    0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x80, 0x09, 0x00, 0x00, 0x0B, 0x40,
-    0xB4, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xD0,
-    0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x01, 0xF4, 0x0B,
-    0xC0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00,
-    0x03, 0xD0, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x03, 0xE0,
-    0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x60, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00,
-    0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03,
-    0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F,
-    0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F,
-    0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x01,
-    0xFB, 0xC0, 0x00, 0x00, 0x0F, 0x07, 0x40, 0x00, 0x00, 0x38, 0x0D, 0x00, 0x00, 0x00, 0xB4, 0xB0,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00,
-    0x00, 0xF4, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8,
-    0x03, 0xD0, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xBC, 0x03, 0xE0,
-    0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x01,
-    0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x01,
-    0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x03, 0xEF, 0x40,
-    0x00, 0x07, 0x43, 0xC0, 0x00, 0x07, 0x02, 0xC0, 0x00, 0x03, 0x87, 0x80, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC,
-    0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0,
-    0x1F, 0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0,
-    0x3D, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40,
-    0x3F, 0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x50, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x00, 0x0F, 0x07, 0xC0, 0x00,
-    0x00, 0xF0, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xBC, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x3D,
-    0x02, 0xF0, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xF4,
-    0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00,
-    0xBC, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x7C, 0x02,
-    0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00,
-    0x03, 0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x40, 0x00, 0x1F, 0x47, 0xD0, 0x00,
-    0x0F, 0x83, 0xD0, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0x01, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x01, 0xA0, 0x07, 0xD0, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x3E,
-    0x00, 0xBC, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x02, 0xF0, 0x07, 0xD0, 0x00,
-    0xF8, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x0B, 0xC0, 0x0F, 0x40,
-    0x03, 0xF0, 0x07, 0xD0, 0x02, 0xF8, 0x01, 0xF0, 0x01, 0xFD, 0x00, 0x7E, 0x02, 0xEF, 0x40, 0x0F,
-    0xFF, 0xE3, 0xC0, 0x00, 0xFF, 0xD1, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x02,
-    0xF0, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x0B,
-    0xC0, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xD0, 0x00,
-    0x03, 0xE0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0,
-    0x0F, 0x80, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x0B, 0xC0,
-    0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x0F,
-    0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00,
-    0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03,
-    0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F,
-    0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F,
-    0x00, 0x00, 0x40, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x07, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0x4B, 0xC0, 0x02, 0xFF, 0x00,
-    0x0B, 0xC2, 0xF0, 0x00, 0xFB, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0xBD, 0xF0, 0x02, 0xF0, 0x2F, 0x00,
-    0x3D, 0x7C, 0x00, 0xF8, 0x0B, 0xC0, 0x1F, 0x0F, 0x00, 0x7C, 0x02, 0xF0, 0x0F, 0x43, 0xC0, 0x3E,
-    0x00, 0x7C, 0x07, 0xC0, 0xF0, 0x1F, 0x40, 0x1F, 0x03, 0xE0, 0x3C, 0x0B, 0xC0, 0x07, 0xC1, 0xF0,
-    0x0F, 0x03, 0xD0, 0x01, 0xF0, 0xF8, 0x03, 0xC2, 0xF0, 0x00, 0x7C, 0x3C, 0x00, 0xF4, 0xF4, 0x00,
-    0x1F, 0x2E, 0x00, 0x3D, 0x7C, 0x00, 0x03, 0xCF, 0x00, 0x0F, 0x7E, 0x00, 0x00, 0xF7, 0xC0, 0x03,
-    0xDF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x03,
-    0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x8B,
-    0x80, 0x00, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x01, 0xA0, 0x00, 0x68, 0x7C, 0x00, 0x3F, 0x40, 0x0F, 0x87, 0xC0, 0x0B,
-    0xF4, 0x01, 0xF0, 0x3D, 0x00, 0xFB, 0x40, 0x3F, 0x03, 0xD0, 0x2E, 0xB4, 0x07, 0xD0, 0x3D, 0x03,
-    0xCB, 0x40, 0xFC, 0x03, 0xD0, 0x7C, 0xB8, 0x0F, 0x40, 0x3D, 0x0F, 0x4B, 0x82, 0xF0, 0x03, 0xD1,
-    0xF0, 0xB8, 0x3D, 0x00, 0x3D, 0x3D, 0x07, 0x8B, 0xC0, 0x03, 0xD7, 0xC0, 0x78, 0xF8, 0x00, 0x3D,
-    0xB4, 0x07, 0x9F, 0x00, 0x03, 0xDF, 0x00, 0x7A, 0xE0, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0xB8, 0x0B, 0x80, 0x00,
-    0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8, 0x2F,
-    0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x0B,
-    0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x2E, 0x00, 0x00, 0x03,
-    0xD0, 0x3D, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0xA8, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xD0, 0x01, 0xF4, 0x00,
-    0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0,
-    0x2F, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x00, 0x3C, 0x3E, 0x00,
-    0x00, 0x00, 0xF6, 0xF0, 0x00, 0x00, 0x03, 0xDF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00,
-    0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0,
-    0xF8, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x02,
-    0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0x55, 0x7F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2A, 0xAA, 0xAF, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x90, 0x0F, 0xFF,
-    0xFE, 0x00, 0x55, 0x5F, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x07, 0x80, 0xB8, 0x00, 0x00, 0x3D, 0x3E, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xAA, 0xAA, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x02, 0xF9, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x04, 0x00, 0x14, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x3C, 0x7D, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA4, 0x00, 0xFF,
-    0xFF, 0xE0, 0x01, 0x55, 0x7F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x03, 0xF0, 0x1F, 0x00, 0xB8, 0x03, 0xD0, 0x04,
-    0x00, 0x50, 0x0F, 0xC0, 0xBD, 0x07, 0xD0, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xD0,
-    0x03, 0xFF, 0x00, 0xF8, 0xB8, 0x3D, 0x03, 0xD1, 0x00, 0x04, 0x01, 0x40, 0x04, 0x0B, 0xF8, 0x1C,
-    0x1F, 0xFF, 0xFC, 0x3C, 0x0F, 0xF0, 0x10, 0x00, 0x40, 0x7F, 0xFF, 0x3F, 0xFF, 0xC5, 0x55, 0x50,
-    0x2A, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0x90, 0x20, 0x01, 0x9E, 0x01, 0xE3, 0xFF,
-    0xF0, 0x7F, 0xF0, 0x01, 0x40, 0x00, 0x14, 0xBC, 0xFC, 0x64, 0x00, 0x01, 0x0F, 0x03, 0xD7, 0xC0,
-    0xF4, 0x90, 0x14, 0x3F, 0x82, 0xBE, 0x01, 0xE0, 0x2E, 0x3F, 0x83, 0xC0, 0x34, 0x00, 0x0B, 0x90,
-    0xFB, 0xD3, 0x43, 0xDC, 0x0B, 0x38, 0x78, 0x7F, 0xC0, 0x10, 0x00, 0x00, 0x50, 0x14, 0x03, 0xE0,
-    0xF8, 0x0F, 0x83, 0xE0, 0x2E, 0x0B, 0x80, 0x78, 0x1E, 0x00, 0x10, 0x10, 0x00, 0x10, 0x00, 0x43,
-    0xC0, 0x7C, 0x1F, 0x2F, 0x00, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x03, 0xD0, 0xF4,
-    0x3C, 0x1F, 0x0B, 0x83, 0xD0, 0xF0, 0x28, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xD2, 0xE0, 0xF0, 0xF8,
-    0x7C, 0x3D, 0x2F, 0x0A, 0x06, 0x40, 0x14, 0x05, 0x00, 0xF8, 0x3E, 0x01, 0xF0, 0x7C, 0x02, 0xE0,
-    0xB8, 0x03, 0xC0, 0xF0, 0x01, 0x00, 0x40, 0x00, 0x60, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x02, 0x09,
-    0x18, 0x38, 0x03, 0xC3, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0x04, 0x00, 0x01, 0xA4, 0x07, 0xFF, 0x87,
-    0xEA, 0xF2, 0xC0, 0x1D, 0x40, 0x01, 0x00, 0x00, 0xE0, 0x3D, 0x07, 0xC0, 0xF8, 0x2F, 0x03, 0xE0,
-    0xBD, 0x05, 0x40, 0x03, 0xE0, 0x7D, 0x0F, 0xC0, 0xF4, 0x2F, 0x03, 0xD0, 0x78, 0x01, 0x00, 0x7C,
-    0x7D, 0x3D, 0x3D, 0x3D, 0x2D, 0x1D, 0x04, 0x03, 0xE0, 0x7D, 0x0F, 0xC0, 0xF4, 0x2F, 0x03, 0xD0,
-    0x78, 0x01, 0x00, 0x14, 0x03, 0xF0, 0x1F, 0x00, 0xB8, 0x03, 0xC0, 0x04, 0x00, 0x54, 0x0B, 0xD0,
-    0x7E, 0x03, 0xE0, 0x3D, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x16, 0xEB, 0xFD, 0x57, 0xC0, 0x3C,
-    0x01, 0x40, 0x00, 0x00, 0x78, 0x02, 0xE5, 0x0F, 0xFD, 0x3D, 0x50, 0xF0, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x2A, 0xAB, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xF8, 0x02, 0xF0, 0x0B, 0xD0,
-    0x3F, 0x40, 0x24, 0x00, 0x07, 0x4B, 0x83, 0x80, 0xD0, 0x3C, 0x07, 0x40, 0x00, 0x01, 0x80, 0x0F,
-    0x00, 0x3C, 0x1B, 0xF9, 0xBF, 0xF4, 0x00, 0x00, 0x2A, 0xA8, 0x3F, 0xFC, 0x07, 0xC0, 0x07, 0x80,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x3C, 0x1F, 0xFF, 0x6F, 0xE4, 0x2D, 0x00, 0x60,
-    0x00, 0x6A, 0xAA, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0x40, 0x7C, 0x01, 0xF0,
-    0x0B, 0x85, 0xBD, 0x2F, 0xF0, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x3D, 0x07, 0xC0, 0xBC, 0x0B, 0x80,
-    0xBD, 0x47, 0xFC, 0x2F, 0xC0, 0x00, 0x3E, 0x3F, 0x3D, 0x00, 0x04, 0x01, 0x0F, 0x42, 0xE3, 0xD0,
-    0xF8, 0x50, 0x18, 0x0B, 0x90, 0xFB, 0xD7, 0x03, 0x9C, 0x0F, 0x78, 0x78, 0xBF, 0xC0, 0x10, 0x00,
-    0x00, 0x03, 0xD1, 0xF0, 0xF0, 0x74, 0x14, 0x00, 0x03, 0x40, 0xF0, 0x0F, 0xC0, 0x2E, 0x02, 0xEA,
-    0xBC, 0xFE, 0x00, 0x03, 0xC0, 0xF0, 0x3C, 0x03, 0xC0, 0x3D, 0x42, 0xFC, 0x01, 0x00, 0x00, 0x02,
-    0xE0, 0xF4, 0x3D, 0x1F, 0x07, 0xC2, 0xE0, 0xF4, 0x28, 0x00, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFC,
-    0x78, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF0, 0x00, 0x78, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x70,
-    0x3C, 0x0E, 0x79, 0xBD, 0x7C, 0x2F, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x53, 0xD0, 0x3D,
-    0x0F, 0x1F, 0x40, 0xBF, 0xD0, 0x03, 0xF4, 0x00, 0x15, 0x00, 0x00, 0x50, 0x00, 0x2F, 0xC0, 0x07,
-    0xFD, 0x01, 0xF1, 0xF0, 0xBC, 0x07, 0x85, 0x00, 0x14, 0x90, 0x02, 0x3C, 0x03, 0xCB, 0xFF, 0xE0,
-    0xFF, 0xE0, 0x01, 0x40, 0x00, 0x01, 0xA4, 0x03, 0xFF, 0xC3, 0xFA, 0xF8, 0xE0, 0x0F, 0x10, 0x00,
-    0x40, 0x01, 0x40, 0x14, 0x7F, 0xD0, 0xE3, 0xEF, 0xFF, 0x1D, 0x0B, 0xF4, 0x10, 0x01, 0x00, 0x3F,
-    0xFF, 0x9F, 0xFF, 0xD1, 0x55, 0x50, 0x15, 0x55, 0x55, 0x5F, 0xFF, 0xFF, 0xE6, 0xAA, 0xAA, 0xA0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x07, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x00, 0x01, 0x40, 0x04, 0x0F, 0xF4, 0x2C, 0x2F,
-    0xFF, 0xF8, 0x38, 0x1F, 0xF0, 0x10, 0x00, 0x00, 0x2A, 0xAA, 0xA9, 0xBF, 0xFF, 0xFE, 0x6A, 0xAA,
-    0xA8, 0x15, 0x55, 0x55, 0x55, 0x55, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x80, 0x2F, 0xD0, 0x2F, 0xD0, 0x03, 0xE0, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0xF0, 0x2C, 0x0B, 0x0B, 0x8B, 0x80, 0x00,
-    0x28, 0x00, 0x18, 0x3C, 0x00, 0x2C, 0x78, 0x00, 0x3C, 0xB9, 0x55, 0x7C, 0xFF, 0xFF, 0xF8, 0x55,
-    0x55, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x39, 0x55, 0x7C, 0x74, 0x00, 0x38, 0xB0, 0x00,
-    0x74, 0xBF, 0xFF, 0xF0, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x3D, 0x7E, 0x6D,
-    0xB0, 0x38, 0x1D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x2D, 0x7C, 0x1F, 0xF0, 0x0F, 0xC0, 0x3F, 0xF0,
-    0x74, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x7D, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0x3C,
-    0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x1A, 0xAA, 0xAA,
-    0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x07, 0xFF, 0xFF, 0xF4, 0x15, 0x55, 0x55, 0x00, 0x14,
-    0x03, 0xF0, 0x1F, 0x00, 0xB8, 0x02, 0xD0, 0x04, 0x01, 0x50, 0x1F, 0x80, 0xFC, 0x0B, 0x80, 0xB8,
-    0x01, 0x40, 0x00, 0x01, 0x40, 0x04, 0x0B, 0xF8, 0x1C, 0x1F, 0xFF, 0xFC, 0x3C, 0x0F, 0xF0, 0x10,
-    0x00, 0x40, 0x2A, 0x03, 0xFC, 0x07, 0xC0, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x10, 0xFC,
-    0x03, 0xD7, 0xDB, 0xDF, 0x7E, 0x3E, 0x24, 0xF0, 0x60, 0x01, 0x00, 0x00, 0x19, 0x0F, 0x43, 0xD0,
-    0xFE, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x3E, 0xAA, 0xAB, 0x87, 0x80, 0x00,
-    0x74, 0xB4, 0x00, 0x0B, 0x4A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x1A,
-    0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xF4, 0x15, 0x55, 0x55,
-    0x00, 0x00, 0x00, 0x07, 0xC3, 0xD1, 0xF0, 0xF4, 0xB8, 0x7C, 0x3D, 0x1F, 0x0A, 0x06, 0x40, 0x15,
-    0x51, 0xFF, 0xC6, 0xAF, 0x00, 0x78, 0x02, 0xD0, 0x0F, 0x00, 0x00, 0x04, 0x00, 0x05, 0x34, 0x51,
-    0xFF, 0xC3, 0x8F, 0xBF, 0xFC, 0x70, 0xFF, 0xD0, 0x47, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x1D, 0x00, 0x06, 0x90, 0x1C, 0x1F, 0xFD, 0x7C, 0x3D, 0xBF, 0xF4,
-    0x74, 0x0B, 0xD0, 0x00, 0x60, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xE4, 0x0D, 0x0F, 0xFF, 0xBC, 0x1C, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x34, 0x2F, 0xFD,
-    0xF0, 0x74, 0x2F, 0xD0, 0x10, 0x01, 0x00, 0x00, 0x81, 0x40, 0x1E, 0x0B, 0x43, 0xFF, 0xFF, 0x87,
-    0xEA, 0xF8, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1F, 0xC2, 0xF9, 0x0F, 0x01,
-    0xE0, 0x2D, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xD7, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x60, 0x00, 0xCA, 0x30, 0x00, 0x90, 0x00,
-    0x84, 0x01, 0x20, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x05, 0x00, 0x60,
-    0x60, 0x00, 0x00, 0xA0, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x70, 0xD0, 0x00, 0x00, 0x30, 0xD7,
-    0x04, 0x00, 0x00, 0x01, 0x0D, 0x70, 0x60, 0x00, 0x00, 0x50, 0xD0, 0x06, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC4, 0x01, 0x30, 0x00, 0x20, 0x01, 0xCA, 0x34, 0x00,
-    0x87, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xA8, 0x02, 0xA8, 0x02,
-    0xAD, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xD0, 0x00, 0x38, 0x0B, 0xE0, 0x3F, 0x1F, 0xFF, 0x48, 0x00,
-    0x07, 0x4B, 0x83, 0x81, 0xD0, 0x3C, 0x07, 0x40, 0x00, 0x01, 0xA4, 0x03, 0xFF, 0xC3, 0xEA, 0xF9,
-    0xD0, 0x0E, 0x11, 0xE1, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x92, 0x03, 0xFE,
-    0x07, 0xF0, 0x3F, 0xD0, 0xF7, 0x80, 0x00, 0x00, 0x00, 0x50, 0xBD, 0x3F, 0x43, 0xE0, 0x1B, 0xD0,
-    0x0A, 0x90, 0x0B, 0xE0, 0x1F, 0xC0, 0xBC, 0x7E, 0x4A, 0x00, 0x90, 0x01, 0x40, 0xBD, 0x03, 0xE0,
-    0x1F, 0xC7, 0xF0, 0x0F, 0xCB, 0x74, 0xBE, 0x0E, 0x38, 0xD0, 0x2C, 0x1C, 0x00, 0x2C, 0x1E, 0x0B,
-    0x0F, 0x2D, 0xF4, 0x00, 0x14, 0xBC, 0xFC, 0x64, 0x03, 0x80, 0x8E, 0x53, 0xFF, 0x82, 0xF4, 0x1E,
-    0xF0, 0x22, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xDB, 0xF4, 0x79, 0xBD, 0x7C, 0xB0, 0x38, 0x0D, 0xB0,
-    0x38, 0x0D, 0x79, 0xFE, 0x7C, 0x1F, 0xD7, 0xF0, 0x34, 0x07, 0x00, 0xBF, 0xDA, 0xBC, 0x02, 0xC0,
-    0x24, 0x2C, 0x00, 0x00, 0x00, 0x02, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xD0, 0x00, 0x00,
-    0xBE, 0x00, 0x3F, 0xE5, 0x56, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0xA9,
-    0x40, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x0B, 0x5F, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0xF4, 0x00, 0x00,
-    0x1F, 0xC0, 0x2F, 0xE9, 0x56, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xAA, 0x94,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x54, 0x00, 0x55, 0x00, 0x00, 0x00, 0x40,
-    0xFF, 0xFF, 0x90, 0x00, 0x3C, 0x3E, 0x9A, 0xFF, 0xFE, 0xBF, 0x4B, 0x40, 0x00, 0x6F, 0xFF, 0xD0,
-    0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x02, 0xBF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xE4, 0x00, 0x6F, 0xD0, 0x3F, 0x40, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x00, 0x0B,
-    0x99, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0E, 0x6C, 0x28, 0x1C, 0x30, 0x28, 0x30,
-    0x34, 0x30, 0xB0, 0x2F, 0x70, 0x00, 0x00, 0x01, 0x41, 0xDE, 0x30, 0xAB, 0xB8, 0xE0, 0x0A, 0x00,
-    0x3F, 0x80, 0x00, 0x05, 0x05, 0x04, 0x0C, 0x1C, 0x28, 0x34, 0x30, 0x60, 0x01, 0x40, 0x39, 0xD2,
-    0x81, 0xCC, 0x07, 0x30, 0x28, 0xC0, 0xC1, 0xFD, 0x00, 0x04, 0x04, 0x1C, 0x0C, 0x28, 0x1C, 0x34,
-    0x28, 0x30, 0x34, 0x30, 0xB0, 0x2F, 0x70, 0x00, 0x00, 0x01, 0x51, 0xE5, 0x34, 0x07, 0x00, 0x60,
-    0x07, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0x00, 0x0A, 0x01, 0x4D, 0x0E, 0x6C, 0x28, 0x1C, 0x30,
-    0x28, 0x70, 0x34, 0x30, 0xB0, 0x2F, 0x70, 0x00, 0x00, 0x0A, 0x00, 0x34, 0x00, 0xC5, 0x07, 0x9B,
-    0x2C, 0x1C, 0x90, 0x63, 0x02, 0x4C, 0x0C, 0x60, 0x30, 0x04, 0x50, 0x50, 0x39, 0xE9, 0xA1, 0xC1,
-    0xC1, 0xCA, 0x0A, 0x0A, 0x30, 0x34, 0x34, 0xC0, 0xC0, 0xC6, 0x06, 0x03, 0x00, 0x04, 0x50, 0xE9,
-    0x1C, 0x02, 0x80, 0x34, 0x03, 0x00, 0x70, 0x00, 0x08, 0x0B, 0x47, 0x90, 0xC0, 0x30, 0x1C, 0x0A,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x11, 0x80, 0xC7, 0x0D, 0x0C, 0x70, 0x33, 0x00, 0xE8, 0x02, 0xC0,
-    0x00, 0x04, 0x04, 0x0D, 0x28, 0x07, 0xA0, 0x03, 0x80, 0x0B, 0xC0, 0x1C, 0xD0, 0x70, 0x70, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x3E, 0x55, 0x54, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xE5, 0x55, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x1F, 0x55, 0x55, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0xF0, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x3E, 0x55, 0x54, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x03, 0xE5, 0x55, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
-    0x55, 0x55, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x15, 0x7F, 0x55, 0x50, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFD, 0xAA, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xAB, 0xF8, 0x01, 0xF0, 0x00, 0xFD, 0x02, 0xF0, 0x00, 0x3E, 0x03,
-    0xE0, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x7D, 0x0B,
-    0xC0, 0x00, 0xFC, 0x0F, 0x80, 0x03, 0xF8, 0x0F, 0x42, 0xFF, 0xE0, 0x1F, 0x42, 0xFF, 0x80, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3E, 0x55, 0x54, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFE, 0x41, 0xB4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x55, 0x55, 0x40, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x19, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFE, 0x41, 0xB4, 0x01, 0xF8, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x74, 0x01, 0xBF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF4,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x00,
-    0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF2, 0xE0, 0x0B, 0xCF, 0x80,
-    0x1E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00,
-    0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x19, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0x55, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7F, 0xA9, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0xAF, 0xF8, 0x00, 0x03,
-    0xD0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x01,
-    0xF4, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x02, 0xF8, 0x11,
-    0xFC, 0x00, 0x07, 0xD0, 0x5F, 0xF0, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xD0, 0x00,
-    0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x01,
-    0xF9, 0x55, 0x5B, 0xE5, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x02, 0xFC, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0x0B, 0xC0,
-    0x7C, 0x00, 0x01, 0xF0, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0xFC, 0x00, 0x03,
-    0xE0, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x07, 0xD0, 0x02, 0xF4,
-    0x1F, 0x00, 0x00, 0xBD, 0x06, 0xFE, 0x02, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x3E, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0x57, 0xF5, 0x55,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xAA, 0x40, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFA, 0xBF, 0xC0, 0x07, 0xC0, 0x02, 0xF8, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0xC0,
-    0x3E, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xD0,
-    0x03, 0xF0, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0x40,
-    0x00, 0x0F, 0x42, 0xF4, 0x00, 0x00, 0x7D, 0x1F, 0x80, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3E, 0x5F, 0x80, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x3D,
-    0x00, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00,
-    0x1F, 0x40, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0x80,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x80, 0x07, 0xD0, 0x00, 0x7F, 0xD0, 0x02, 0xF0, 0x00,
-    0x3E, 0xF4, 0x00, 0xBC, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0x00, 0x2F, 0x2F, 0x00, 0x0F, 0x40, 0x1F,
-    0x0F, 0x80, 0x07, 0xD0, 0x0F, 0x43, 0xD0, 0x02, 0xF0, 0x0F, 0x81, 0xF0, 0x00, 0xFC, 0x0B, 0xC0,
-    0xBC, 0x00, 0x3E, 0x07, 0xC0, 0x3F, 0x00, 0x0F, 0x43, 0xD0, 0x0F, 0x80, 0x07, 0xC3, 0xE0, 0x07,
-    0xD0, 0x02, 0xF2, 0xF0, 0x01, 0xF0, 0x00, 0xF9, 0xF0, 0x00, 0xBC, 0x00, 0x3E, 0xF4, 0x00, 0x3E,
-    0x00, 0x1F, 0xF8, 0x00, 0x0F, 0x40, 0x0B, 0xFC, 0x00, 0x07, 0xD0, 0x02, 0xFC, 0x00, 0x02, 0xF0,
-    0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00,
-    0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x0B,
-    0xD0, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00,
-    0x7C, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x0B, 0xC1,
-    0xF0, 0x00, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0xFB, 0xD0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3D,
-    0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0xF4,
-    0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00,
-    0x07, 0xC0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00,
-    0x1F, 0x40, 0x00, 0x3F, 0x00, 0x1F, 0x55, 0x55, 0x7E, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00,
-    0x2F, 0x7C, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x07, 0xD0, 0xF4, 0x00,
-    0x03, 0xF0, 0x3D, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0xBC,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0xF0, 0x0B, 0xC0, 0x00,
-    0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0xF8, 0xFC, 0x00,
-    0x00, 0x3F, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xE5, 0x55, 0x50, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xFA, 0x94, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x3F, 0xAF, 0xFE, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x01, 0xF0,
-    0x00, 0x3E, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x02, 0xF0, 0x07,
-    0xD0, 0x02, 0xF8, 0x01, 0xF5, 0x57, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xE5, 0x6F, 0xF0, 0x01, 0xF4,
-    0x00, 0xBE, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x01, 0xF4, 0x03,
-    0xD0, 0x00, 0xFC, 0x01, 0xF0, 0x01, 0xFD, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x0F, 0x80, 0x6F, 0xC0, 0x03, 0xD0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x07,
-    0xD0, 0x3E, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0xBE, 0x01, 0xF4, 0x05,
-    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x3E, 0x55, 0x54, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3E, 0x55, 0x6F,
-    0x40, 0x00, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x3E,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00,
-    0x2F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00,
-    0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x3D,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x5F, 0xE5, 0x55, 0x5B, 0xD4, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x41, 0xA0,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3E, 0x55,
-    0x54, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xE5, 0x55, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x55, 0x55,
-    0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0x7E,
-    0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0x0B,
-    0xC0, 0xBD, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x81, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0x47, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x3D, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7C, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x0B,
-    0xC0, 0x00, 0x00, 0x3F, 0x40, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0xF8, 0x03, 0xF0, 0x00,
-    0x02, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x1F, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x39, 0x06, 0xFC, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x15, 0x6F, 0x80,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x74, 0x00, 0x7F, 0xC0, 0x7F, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0x80,
-    0x00, 0x3F, 0xC0, 0x03, 0xE0, 0x00, 0x2F, 0xE0, 0x01, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0xBC, 0x00,
-    0x0F, 0xBD, 0x00, 0x2F, 0x00, 0x0F, 0x9F, 0x00, 0x0F, 0x80, 0x0B, 0xCB, 0xC0, 0x03, 0xD0, 0x07,
-    0xC3, 0xE0, 0x01, 0xF4, 0x03, 0xD0, 0xF4, 0x00, 0xBC, 0x03, 0xE0, 0x7C, 0x00, 0x3F, 0x02, 0xF0,
-    0x2F, 0x00, 0x0F, 0x81, 0xF0, 0x0F, 0xC0, 0x03, 0xD0, 0xF4, 0x03, 0xE0, 0x01, 0xF0, 0xF8, 0x01,
-    0xF4, 0x00, 0xBC, 0xBC, 0x00, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0xBD, 0x00, 0x0F,
-    0x80, 0x07, 0xFE, 0x00, 0x03, 0xD0, 0x02, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0xBC,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x80,
-    0xBC, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x03,
-    0xFC, 0x00, 0x3E, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0x40, 0x01, 0xFF, 0x40, 0x0B, 0xC0, 0x00, 0xFB,
-    0xD0, 0x02, 0xF0, 0x00, 0xF9, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0xBC, 0x00, 0x3D, 0x00, 0x7C, 0x3E,
-    0x00, 0x1F, 0x40, 0x3D, 0x0F, 0x40, 0x0B, 0xC0, 0x3E, 0x07, 0xC0, 0x03, 0xF0, 0x2F, 0x02, 0xF0,
-    0x00, 0xF8, 0x1F, 0x00, 0xFC, 0x00, 0x3D, 0x0F, 0x40, 0x3E, 0x00, 0x1F, 0x0F, 0x80, 0x1F, 0x40,
-    0x0B, 0xCB, 0xC0, 0x07, 0xC0, 0x03, 0xE7, 0xC0, 0x02, 0xF0, 0x00, 0xFB, 0xD0, 0x00, 0xF8, 0x00,
-    0x7F, 0xE0, 0x00, 0x3D, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0x40, 0x0B, 0xF0, 0x00, 0x0B, 0xC0, 0x03,
-    0xF4, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03,
-    0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x0F,
-    0xC0, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x3D, 0x0B, 0xD0, 0x00, 0x01, 0xF4, 0x7E, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xF9, 0x7E, 0x00, 0x00, 0x03, 0xD0,
-    0xBC, 0x00, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x07, 0xD0,
-    0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x0B,
-    0xC0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0x55, 0x5B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0xBC, 0x00,
-    0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x40,
-    0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x0F,
-    0x40, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x11, 0xFC, 0x00, 0x03,
-    0xF0, 0x03, 0xFF, 0x40, 0x00, 0x3E, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x03,
-    0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xBC, 0x00, 0xBE, 0xE0, 0x00, 0x0F,
-    0x7E, 0x00, 0x2E, 0xB8, 0x00, 0x07, 0xCF, 0x40, 0x0F, 0x5F, 0x00, 0x03, 0xD7, 0xC0, 0x03, 0xD7,
-    0xC0, 0x02, 0xF2, 0xF0, 0x01, 0xF0, 0xF0, 0x00, 0xF4, 0xFC, 0x00, 0xBC, 0x3C, 0x00, 0xB8, 0x3E,
-    0x00, 0x3E, 0x0F, 0x40, 0x3C, 0x0F, 0x40, 0x0F, 0x43, 0xD0, 0x2E, 0x07, 0xC0, 0x03, 0xC0, 0xB8,
-    0x1F, 0x02, 0xF0, 0x01, 0xF0, 0x2E, 0x0F, 0x80, 0xF8, 0x00, 0xBC, 0x07, 0xC7, 0xC0, 0x3E, 0x00,
-    0x3E, 0x01, 0xF3, 0xD0, 0x1F, 0x40, 0x0F, 0x40, 0x3D, 0xF0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xF4,
-    0x02, 0xF0, 0x01, 0xF0, 0x03, 0xFC, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x3E, 0x00, 0x3E,
-    0x00, 0x2E, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x00, 0x3E,
-    0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x01, 0xF0,
-    0x00, 0x02, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xE5, 0x55,
-    0x57, 0xD0, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x0F,
-    0xC0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0x1F, 0x00,
-    0x1F, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE4,
-    0x1B, 0xF0, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x1F,
-    0x42, 0xF0, 0x00, 0x00, 0x7D, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x7D, 0x00, 0x00, 0x03, 0xE2, 0xF0,
-    0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x00,
-    0x0F, 0xC3, 0xE0, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0xBD, 0x00, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x3E, 0x55, 0x55, 0xFC, 0x00, 0x7D, 0x00, 0x00,
-    0xFC, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x01, 0xF0,
-    0x00, 0xF4, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x03,
-    0xF0, 0x00, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x07, 0xC0,
-    0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00,
-    0x2F, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x3D,
-    0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03,
-    0xE5, 0xBF, 0xD0, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x0F, 0x80, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0xBC, 0x00, 0x3F,
-    0x00, 0x3F, 0x55, 0xBF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xF9, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFE,
-    0x41, 0xB4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x19, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x15, 0x5B, 0xE5, 0x54, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF4, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0xBD, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00,
-    0xF8, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0x40,
-    0x7D, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0x00,
-    0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0x0F, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x6F, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xBF, 0xBF, 0xD0, 0x02, 0xFD, 0x03, 0xD0, 0x7F, 0x00, 0xBE, 0x00, 0x7C, 0x00,
-    0xF8, 0x0F, 0xC0, 0x0B, 0xC0, 0x0B, 0xC1, 0xF4, 0x00, 0xFC, 0x00, 0x7C, 0x2F, 0x00, 0x0F, 0x80,
-    0x07, 0xC3, 0xE0, 0x01, 0xF4, 0x00, 0xBC, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0xC3, 0xE0, 0x02, 0xF0,
-    0x00, 0xF8, 0x3F, 0x00, 0x3E, 0x00, 0x2F, 0x02, 0xF4, 0x03, 0xD0, 0x0B, 0xE0, 0x0F, 0xD0, 0x7D,
-    0x06, 0xFC, 0x00, 0x3F, 0xFF, 0xEB, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x6F,
-    0xD4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x0F,
-    0x80, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x02, 0xF0,
-    0x3E, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x00, 0x2F, 0x03, 0xD0, 0x00, 0x00,
-    0x7D, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0,
-    0x00, 0xBC, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x00,
-    0xF8, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x01, 0xF0,
-    0x00, 0xF4, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x03,
-    0xF0, 0x00, 0x07, 0xD0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xC0,
-    0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x2F, 0x55, 0x55, 0x7E, 0x50, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x07,
-    0xC0, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0xF8,
-    0x0F, 0x40, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x03,
-    0xE0, 0x2F, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x7D, 0x00, 0xFD, 0x01, 0x7F, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xE0, 0x00, 0x2E,
-    0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x7D,
-    0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x01,
-    0xF4, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x00,
-    0x7D, 0x00, 0x07, 0xD0, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x0B, 0xC0, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0x1F, 0x55, 0x56, 0xF5, 0x55, 0x6F, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0x00, 0x02,
-    0xE0, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0x3D, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0xF4, 0x00,
-    0x0F, 0x40, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0xF8,
-    0x00, 0x0F, 0x40, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x1F, 0x55, 0x56, 0xF5, 0x55, 0x6F,
-    0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x90, 0x2F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x15, 0x7F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xFE, 0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFA, 0xAF, 0xF0, 0x01, 0xF0,
-    0x02, 0xF8, 0x02, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0xBC, 0x03, 0xD0,
-    0x00, 0xFC, 0x07, 0xC0, 0x01, 0xF8, 0x0B, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x6F, 0xD0, 0x0F, 0xFF,
-    0xFF, 0x40, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xBC,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xFE, 0xA4, 0x00, 0x03, 0xD0, 0x02, 0xFF, 0xFF, 0x40,
-    0x07, 0xD0, 0x03, 0xFA, 0xBF, 0xD0, 0x0B, 0xC0, 0x03, 0xE0, 0x07, 0xF0, 0x0B, 0xC0, 0x03, 0xD0,
-    0x02, 0xF0, 0x0F, 0x80, 0x07, 0xC0, 0x01, 0xF4, 0x0F, 0x40, 0x0B, 0xC0, 0x01, 0xF4, 0x1F, 0x00,
-    0x0F, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x1F, 0x40, 0x0F, 0xD0,
-    0x3E, 0x00, 0x1F, 0x41, 0xBF, 0x80, 0x3D, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x7C, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x01, 0xFE, 0xA4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xAB, 0xFD, 0x00, 0xF8, 0x01,
-    0xFC, 0x03, 0xD0, 0x01, 0xF4, 0x1F, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0xBC,
-    0x0F, 0x80, 0x03, 0xF0, 0x7D, 0x00, 0x2F, 0x41, 0xF4, 0x17, 0xFC, 0x0B, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x03, 0x90, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x55, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x01, 0x90, 0x06, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0F, 0x80, 0x0B, 0xF4, 0x1B, 0xF0,
-    0x00, 0x7D, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x02, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x3F, 0x00, 0x00, 0x1F, 0x40, 0x3E, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x0B, 0xC0, 0x00,
-    0x00, 0xF8, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x80,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7D, 0x03, 0xE5, 0x6F, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0x40, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x01,
-    0xF4, 0x0F, 0x80, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0xBD, 0x01, 0xF4,
-    0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x07, 0xC0, 0x00, 0xFD, 0x01, 0xFF, 0x00, 0x2F, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xE5, 0x6F, 0x40,
-    0x02, 0xF4, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x02, 0xF0,
-    0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x00, 0x3F, 0x80, 0x2F,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xF9, 0x6F, 0x40, 0x00,
-    0x1F, 0x80, 0x7C, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0xBD, 0x00,
-    0x3D, 0x00, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x2F, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x1B, 0xE0, 0x24, 0x03, 0xFF, 0xF2, 0xE0, 0x3F, 0x96, 0xEF,
-    0x42, 0xF4, 0x02, 0xFC, 0x1F, 0x80, 0x03, 0xF0, 0xBC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3E, 0x1F,
-    0x40, 0x01, 0xF4, 0xBC, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x3F, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0x00,
-    0x0F, 0xD0, 0xBC, 0x00, 0xBF, 0x41, 0xF8, 0x0B, 0xBC, 0x03, 0xFF, 0xF5, 0xF0, 0x03, 0xFF, 0x47,
-    0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x1F, 0xF9, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x86, 0xFD, 0x00, 0x0F, 0x6F, 0xFF, 0x80, 0x1F, 0xB9, 0x1F,
-    0xD0, 0x2F, 0xC0, 0x03, 0xF0, 0x3F, 0x40, 0x02, 0xF0, 0x3F, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x02,
-    0xF0, 0x7C, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x0F,
-    0xC0, 0x3D, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0xBE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x0F, 0xFF, 0xF0, 0x03, 0xF9, 0x6F, 0xC0,
-    0xFC, 0x00, 0xBC, 0x1F, 0x40, 0x07, 0xC3, 0xF0, 0x00, 0xFC, 0x3D, 0x00, 0x2F, 0x47, 0xFF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xF4, 0x0F, 0xC0, 0x5B, 0xE0, 0xFC, 0x00, 0x2F, 0x0B, 0xC0, 0x01, 0xF0, 0x7D,
-    0x00, 0x2F, 0x03, 0xF0, 0x07, 0xE0, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x6F, 0xE4, 0x00, 0xFF, 0xFF, 0x80, 0x2E, 0x57, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xD0, 0x01, 0xBF, 0xD0, 0x03, 0xFE, 0x40, 0x03, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x0A, 0x02, 0xFF,
-    0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0xE0, 0xF8, 0x07, 0xFF, 0xF3, 0xE0, 0x7F,
-    0x41, 0xFF, 0x83, 0xF0, 0x01, 0xFD, 0x2F, 0x00, 0x03, 0xF4, 0xF8, 0x00, 0x0B, 0xC7, 0xD0, 0x00,
-    0x3F, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x3F, 0x0B, 0xC0, 0x01, 0xF8,
-    0x1F, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0xFD, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0x96, 0xF4, 0x2F, 0x40, 0x3E,
-    0x1F, 0x80, 0x0F, 0x4F, 0xC0, 0x0B, 0xC3, 0xE0, 0x1F, 0xE1, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0x80,
-    0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x0A,
-    0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x0A, 0x40,
-    0x06, 0xF8, 0x07, 0xFE, 0x00, 0x3D, 0x00, 0xBF, 0xE0, 0x05, 0xFD, 0x00, 0xF0, 0x0F, 0xE5, 0x00,
-    0x00, 0xF8, 0x07, 0xC0, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0,
-    0xF8, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x7C, 0x00, 0x00, 0x00,
-    0x7C, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x3D, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x41, 0xF0,
-    0x0F, 0x40, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xFF, 0xC0, 0x2E, 0x00, 0x7F, 0xF0,
-    0x0F, 0xF8, 0x00, 0xF4, 0x00, 0x7F, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0xBF,
-    0x90, 0x02, 0xFF, 0xFF, 0x00, 0x79, 0x5B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x24, 0x00, 0xBD, 0x0F, 0xFF, 0xFE, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0x80, 0x00, 0x68, 0x1F, 0x00, 0x03, 0xE0, 0xBC, 0x00,
-    0x0F, 0x43, 0xE0, 0x00, 0x7D, 0x0F, 0x80, 0x01, 0xF0, 0x7D, 0x00, 0x0B, 0xC1, 0xF0, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0xF4, 0x3E, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0xFC, 0x1F,
-    0x00, 0x0B, 0xE0, 0x7C, 0x00, 0x7F, 0x41, 0xF8, 0x0B, 0xBC, 0x03, 0xFF, 0xF5, 0xF0, 0x07, 0xFF,
-    0x47, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x29, 0x00, 0xA0, 0x00, 0xB8, 0x07, 0xC0, 0x01, 0xF9,
-    0xBD, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x06,
-    0x81, 0xF0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0xF4, 0x3E, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x1F, 0x07,
-    0xD0, 0x00, 0xBC, 0x1F, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x7C, 0x0F, 0x40,
-    0x02, 0xF0, 0x7C, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0xBE, 0x07, 0xC0, 0x07, 0xF4, 0x1F, 0x80, 0xBB,
-    0xC0, 0x3F, 0xFF, 0x5F, 0x00, 0x7F, 0xF4, 0x78, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00,
-    0x69, 0x00, 0xF4, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xF0, 0x02, 0xF0, 0x0F, 0xC0, 0x03, 0xE0, 0x3F,
-    0x00, 0x03, 0xD0, 0xBC, 0x00, 0x07, 0xD2, 0xF4, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x0F, 0x83, 0xE0, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xAA,
-    0xAA, 0x90, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAB, 0xD0, 0x00, 0x3E, 0x00, 0x7C, 0x00,
-    0x07, 0xD0, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0xF4, 0x01,
-    0xF4, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x07,
-    0xD0, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x3F, 0xF0, 0x00, 0xFC,
-    0x03, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x2A, 0x80,
-    0x0F, 0xE0, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x2E, 0xF0, 0x00, 0x2E, 0xF4,
-    0x03, 0xDF, 0x00, 0x07, 0xDF, 0x00, 0x3C, 0xB4, 0x00, 0xF9, 0xF0, 0x07, 0xCB, 0x80, 0x1F, 0x2F,
-    0x00, 0xBC, 0x78, 0x03, 0xD3, 0xE0, 0x0B, 0x83, 0xC0, 0xB8, 0x3D, 0x00, 0xF4, 0x3C, 0x1F, 0x07,
-    0xC0, 0x0F, 0x03, 0xD3, 0xE0, 0xBC, 0x01, 0xF0, 0x2D, 0x7C, 0x0F, 0x80, 0x2F, 0x01, 0xEF, 0x40,
-    0xF4, 0x03, 0xE0, 0x1F, 0xE0, 0x0F, 0x40, 0x3D, 0x00, 0xFC, 0x01, 0xF0, 0x03, 0xC0, 0x0F, 0x80,
-    0x2F, 0x00, 0x00, 0xA4, 0x00, 0x1A, 0x00, 0xF4, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x3E, 0x02, 0xF0,
-    0x00, 0x7D, 0x03, 0xE0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xF8, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x0F, 0x40, 0x03, 0xF0, 0x1F, 0x00,
-    0x03, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00,
-    0x0F, 0xC0, 0x00, 0x1B, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0x95, 0xFC, 0x03, 0xF0, 0x00,
-    0xF8, 0x1F, 0x40, 0x03, 0xF0, 0xFC, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xBC,
-    0xBC, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7C, 0x2F, 0x00, 0x03, 0xF0, 0x7D,
-    0x00, 0x1F, 0x40, 0xFD, 0x02, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0xA0, 0x6F, 0x80, 0x03, 0xCB, 0xFF, 0xC0, 0x1F, 0xBD, 0x6F, 0x80, 0xBF, 0x80,
-    0x3F, 0x03, 0xF8, 0x00, 0xBC, 0x0F, 0xC0, 0x03, 0xF0, 0x7E, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x3D,
-    0x0B, 0xC0, 0x01, 0xF0, 0x3E, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0xF8, 0x2F,
-    0x00, 0x07, 0xD0, 0xFC, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0xBC, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x28,
-    0x0B, 0xE0, 0x00, 0x0F, 0x1F, 0xFF, 0x40, 0x07, 0xDF, 0x5B, 0xF0, 0x02, 0xFE, 0x00, 0xBD, 0x00,
-    0xFE, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x1F, 0x80, 0x00, 0xF4, 0x0B, 0xD0, 0x00, 0x7D,
-    0x02, 0xF0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x03, 0xE0, 0x1F, 0xC0, 0x02,
-    0xF0, 0x0B, 0xF0, 0x01, 0xF8, 0x03, 0xFE, 0x01, 0xFC, 0x00, 0xF6, 0xFF, 0xFC, 0x00, 0x3D, 0x2F,
-    0xF8, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF9, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0x95, 0xA0, 0x3F, 0x40, 0x00, 0x1F, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x08, 0x01, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0x80, 0x1B, 0xE0, 0x00, 0xF1,
-    0xFF, 0xF0, 0xBF, 0xFC, 0x01, 0xF7, 0x96, 0xF6, 0xE5, 0xBD, 0x02, 0xFD, 0x00, 0xFF, 0x40, 0x3E,
-    0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0xF8,
-    0x00, 0x3D, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x0F, 0x80,
-    0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF8, 0x1F, 0x00, 0x07, 0xD0, 0x00, 0xF4,
-    0x2F, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x3F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x3E, 0x00, 0x0F, 0x80,
-    0x03, 0xE0, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x28, 0x00, 0x01, 0xA0, 0x00, 0xF4, 0x00,
-    0x0F, 0x80, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x00, 0xBC, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x00, 0x0F,
-    0x43, 0xF0, 0x00, 0x00, 0x3D, 0x1F, 0x40, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0x02, 0xE3, 0xC0,
-    0x00, 0x00, 0x0B, 0xAE, 0x00, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x11, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F,
-    0xEB, 0xEF, 0xE0, 0x0F, 0xD0, 0x7C, 0x2F, 0x41, 0xF4, 0x0B, 0xC0, 0xFC, 0x3F, 0x00, 0xF8, 0x07,
-    0xC7, 0xD0, 0x0F, 0x40, 0x7D, 0xBC, 0x01, 0xF0, 0x07, 0xDB, 0xC0, 0x2F, 0x00, 0x7C, 0xFC, 0x03,
-    0xE0, 0x0B, 0xCB, 0xC0, 0x3E, 0x00, 0xF8, 0xBC, 0x03, 0xD0, 0x2F, 0x03, 0xE0, 0x7C, 0x07, 0xE0,
-    0x2F, 0xCB, 0xC6, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x00,
-    0x2A, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x1F, 0x80, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x1F,
-    0x0F, 0xC0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x02, 0xF0, 0xF4, 0x00,
-    0x02, 0xF4, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x1F,
-    0x40, 0x02, 0x80, 0x00, 0x68, 0x1F, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x7D,
-    0x0F, 0x80, 0x01, 0xF0, 0x7D, 0x00, 0x0B, 0xC1, 0xF0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0xF4, 0x3E,
-    0x00, 0x07, 0xC0, 0xF4, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0xFC, 0x1F, 0x00, 0x0B, 0xE0, 0x7C, 0x00,
-    0x7F, 0x41, 0xF8, 0x0B, 0xBE, 0x03, 0xFF, 0xF8, 0xFF, 0x47, 0xFF, 0x42, 0xFD, 0x00, 0x40, 0x01,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x02, 0x93, 0xF0, 0x00, 0x7D, 0x3E, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0xFC, 0x7C, 0x00,
-    0x0F, 0x8B, 0xC0, 0x02, 0xF4, 0xBC, 0x00, 0x7F, 0x0B, 0xC0, 0x1F, 0xF0, 0x7F, 0xAF, 0xEF, 0x03,
-    0xFF, 0xE3, 0xE0, 0x06, 0x90, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x02, 0x80, 0x00, 0xA4, 0x00, 0x29, 0x07, 0xC0,
-    0x01, 0xF4, 0x00, 0x3D, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC,
-    0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF8, 0x1F, 0x00, 0x07, 0xC0,
-    0x01, 0xF4, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x3E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x3E, 0x00,
-    0x0F, 0x80, 0x03, 0xE0, 0x7D, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x7C, 0x00, 0x3F, 0x40, 0x0F, 0xC0,
-    0x7C, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x7E, 0x03, 0xDF, 0x80, 0xFB, 0xC0, 0x3F, 0xFF, 0x4B, 0xFF,
-    0xCB, 0x80, 0x1F, 0xFC, 0x03, 0xFE, 0x0F, 0x40, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0xA4, 0x00, 0x29, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x3D, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x7C,
-    0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x0F, 0x40, 0x03, 0xD0,
-    0x00, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x3E, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x7D, 0x00, 0x2F, 0x40, 0x0B, 0xD0,
-    0x7C, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x7C, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x7E, 0x03, 0xDF, 0x80,
-    0xFB, 0xC0, 0x3F, 0xFF, 0x4B, 0xFF, 0xC7, 0xFC, 0x1F, 0xFC, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0x40,
-    0x00, 0x10, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x6A, 0xBD, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xF9, 0x47, 0xF4,
-    0x02, 0xF0, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0xF8,
-    0x01, 0xF8, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x02, 0x90, 0x00, 0x00, 0x29, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0xFF,
-    0xE0, 0x00, 0xF4, 0x2F, 0xFF, 0xFC, 0x01, 0xF0, 0x2F, 0x51, 0xBF, 0x02, 0xF0, 0x3E, 0x00, 0x2F,
-    0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x43, 0xE0, 0x3E, 0x00, 0x1F, 0x03, 0xD0, 0x3E, 0x00, 0x3F, 0x07,
-    0xC0, 0x2F, 0x40, 0xBE, 0x0B, 0xC0, 0x0F, 0xFF, 0xFC, 0x0F, 0x80, 0x03, 0xFF, 0xE0, 0x0F, 0x40,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xFB, 0xFE, 0x00, 0xBF, 0xFF, 0xF4, 0x3F,
-    0x51, 0xBF, 0x0F, 0x80, 0x07, 0xD3, 0xD0, 0x00, 0xF4, 0xF4, 0x00, 0x7D, 0x3E, 0x00, 0x2F, 0x0F,
-    0xC0, 0x1F, 0x81, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x01, 0xBF, 0x90,
-    0x02, 0xFF, 0xFE, 0x00, 0x79, 0x5F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x04, 0x00, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x1B, 0xE4, 0x00, 0x0F, 0x40, 0x0F, 0xFF, 0xE0,
-    0x01, 0xF0, 0x03, 0xF5, 0x7F, 0x40, 0x2F, 0x00, 0xFC, 0x00, 0xFC, 0x02, 0xF0, 0x1F, 0x40, 0x07,
-    0xC0, 0x3E, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xE0, 0x7D, 0x00, 0x03, 0xD0, 0x7F, 0xFF, 0xC0, 0x00,
-    0x7D, 0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xC0, 0xFC, 0x0B, 0xC0, 0x00, 0xBC, 0x0F, 0x80, 0xBC, 0x00,
-    0x0F, 0x80, 0xF4, 0x0B, 0xC0, 0x01, 0xF0, 0x1F, 0x00, 0x7C, 0x00, 0x3F, 0x02, 0xF0, 0x03, 0xF0,
-    0x0F, 0xC0, 0x3E, 0x00, 0x1F, 0xFF, 0xF4, 0x03, 0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xA8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFE, 0xAA, 0xF8, 0x02,
-    0xF4, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0xF4, 0x03, 0xE0, 0x01, 0xF0, 0x03, 0xF0, 0x02, 0xF0, 0x01,
-    0xFD, 0x03, 0xE0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x7E, 0x07, 0xC0, 0x00,
-    0xFC, 0x0B, 0xC0, 0x03, 0xF0, 0x0F, 0x80, 0x0F, 0xC0, 0x0F, 0x40, 0x2F, 0x40, 0x1F, 0x00, 0xBE,
-    0x00, 0x2F, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0xFF, 0xFF,
-    0x00, 0xFE, 0x5B, 0xD0, 0xBD, 0x00, 0xF8, 0x7E, 0x00, 0x3D, 0x3F, 0x00, 0x2F, 0x0F, 0x80, 0x7F,
-    0x87, 0xFF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x28, 0x07, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x7C, 0x00, 0x3E, 0x0F, 0xC0, 0x02, 0xC0, 0x74, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x03, 0xF9, 0x6F,
-    0x40, 0xBD, 0x00, 0xF8, 0x1F, 0x80, 0x0F, 0x43, 0xF0, 0x02, 0xF0, 0x3E, 0x01, 0xFE, 0x07, 0xFF,
-    0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x03, 0xF4, 0x02, 0x80, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xBF,
-    0xAA, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xBD, 0x55, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8,
-    0x05, 0x00, 0x00, 0xF4, 0xBF, 0xE0, 0x01, 0xF7, 0xFF, 0xF8, 0x02, 0xFF, 0x80, 0xFC, 0x03, 0xFD,
-    0x00, 0xBC, 0x03, 0xF4, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xF8, 0x0B, 0xC0,
-    0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x00,
-    0x03, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x04,
-    0xBE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x03, 0xFF, 0xFE, 0x00, 0x2E, 0x57, 0xF4, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x6F, 0xF4, 0x00, 0x3F,
-    0xE4, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x3F, 0x00, 0x28, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1B,
-    0xF9, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0x95, 0xA0, 0x3F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x2F, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x08, 0x01, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0x56, 0xE0,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4,
-    0x24, 0x00, 0xFC, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0xF4, 0x01, 0xF4,
-    0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80,
-    0x0F, 0x40, 0x1F, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x41, 0x40, 0x2F, 0x3C, 0x03,
-    0xE7, 0xC0, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x0F, 0x40, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00,
-    0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x57,
-    0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF8,
-    0x01, 0xFA, 0xF9, 0x00, 0x00, 0x3D, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x1F, 0x00, 0x3F, 0x51, 0xBF,
-    0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x01, 0xF4, 0x01, 0xF4, 0x00,
-    0xF4, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x2F, 0x83,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x28, 0x00, 0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x00,
-    0x0F, 0x40, 0x07, 0xD0, 0x00, 0x00, 0x7E, 0x55, 0x6F, 0x95, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xEA, 0xAB, 0xFA, 0xBF, 0xD0, 0x3E, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0xF4, 0x00, 0x3D,
-    0x00, 0x2F, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0xBC, 0x2F, 0x00, 0x03, 0xD0, 0x03, 0xE0, 0xFC, 0x00,
-    0x0F, 0xC0, 0x2F, 0x43, 0xE0, 0x00, 0x1F, 0xFF, 0xF8, 0x0F, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x02, 0xBF, 0xAA, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xBD, 0x55, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xF8, 0x1A, 0x80, 0x00, 0xF4, 0xFF, 0xF4, 0x01, 0xF7, 0xEB, 0xFC, 0x02, 0xFF, 0x00,
-    0xBC, 0x02, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x07, 0xD0, 0x00,
-    0xF8, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0x80, 0x01, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02,
-    0xF0, 0x1F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00,
-    0x69, 0x00, 0xF4, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xF0, 0x02, 0xF0, 0x0F, 0xC0, 0x03, 0xE0, 0x3F,
-    0x00, 0x03, 0xD0, 0xBC, 0x00, 0x07, 0xD2, 0xF4, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x0F, 0x83, 0xE0, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x1A, 0x07, 0xC0, 0x00, 0xF8, 0x2F,
-    0x00, 0x03, 0xD0, 0xF8, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x7C, 0x1F, 0x40, 0x02, 0xF0, 0x7C, 0x00,
-    0x0F, 0x82, 0xF0, 0x00, 0x3D, 0x0F, 0x80, 0x01, 0xF0, 0x3D, 0x00, 0x0B, 0xC1, 0xF0, 0x00, 0x3F,
-    0x07, 0xC0, 0x02, 0xF8, 0x1F, 0x00, 0x1F, 0xD0, 0x7E, 0x02, 0xEF, 0x00, 0xFF, 0xFD, 0x7C, 0x01,
-    0xFF, 0xD1, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x06, 0x80, 0x00, 0x03, 0xC0, 0x3E,
-    0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x1A, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x3E, 0x00,
-    0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0F, 0x40,
-    0x00, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0x03,
-    0xD1, 0xF4, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x2E, 0x3C, 0x00, 0x00, 0x00, 0xBA, 0xE0,
-    0x00, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x68, 0x1F, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x7D,
-    0x0F, 0x80, 0x01, 0xF0, 0x7D, 0x00, 0x0B, 0xC1, 0xF0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0xF4, 0x3E,
-    0x00, 0x07, 0xC0, 0xF4, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0xFC, 0x1F, 0x00, 0x0B, 0xE0, 0x7C, 0x00,
-    0x7F, 0x41, 0xF8, 0x0B, 0xBC, 0x03, 0xFF, 0xF5, 0xF0, 0x07, 0xFF, 0x47, 0x80, 0x00, 0x40, 0x00,
-    0x00, 0x01, 0xB0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xE3, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x3F,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x1F,
-    0x80, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x07, 0xF8, 0x00, 0x1F,
-    0x00, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFC, 0x03, 0xF0, 0x02, 0xFF, 0xC0, 0x07, 0xD0, 0x0F, 0xC0,
-    0x0F, 0x3F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0xF8, 0xBC, 0x00, 0xF4, 0x00, 0xBC, 0x07, 0xC2, 0xF0,
-    0x0B, 0xC0, 0x01, 0xF4, 0x3D, 0x07, 0xD0, 0x7D, 0x00, 0x07, 0xD2, 0xF0, 0x0F, 0x83, 0xF0, 0x00,
-    0x0F, 0x8F, 0x40, 0x3F, 0x1F, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0xBC, 0xF4, 0x00, 0x00, 0xBF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x06, 0x80, 0x00, 0xA4, 0xBC,
-    0x00, 0x3F, 0x00, 0x03, 0xD3, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
-    0x3E, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0xF8, 0x00, 0x3E, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0xF8, 0x0F, 0x80, 0x0F, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0xBF, 0x80, 0x3E, 0x00, 0xBC, 0x07, 0xEE,
-    0x01, 0xF0, 0x02, 0xF0, 0x3C, 0xBC, 0x0F, 0x40, 0x07, 0xC3, 0xD1, 0xF0, 0xBC, 0x00, 0x0F, 0x5E,
-    0x03, 0xC7, 0xC0, 0x00, 0x3E, 0xF0, 0x0F, 0xBD, 0x00, 0x00, 0xBF, 0x40, 0x2F, 0xE0, 0x00, 0x00,
-    0xF8, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x05, 0x6F, 0x55, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x00, 0xFD, 0x57, 0xFC, 0x0F,
-    0x80, 0x0B, 0xD1, 0xF4, 0x00, 0x7D, 0x1F, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x7D, 0x3E, 0x00, 0x0F,
-    0xC3, 0xD0, 0x02, 0xF8, 0x7D, 0x56, 0xFF, 0x0B, 0xFF, 0xFF, 0x80, 0xBF, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0x1F, 0xFF, 0x80, 0x00,
-    0x00, 0x7D, 0xF9, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0xFF, 0xFF, 0x80, 0x2F, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x1F, 0x40, 0x2F, 0x43, 0xE0,
-    0x00, 0xBC, 0x00, 0x3E, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0xF8, 0xBC, 0x00, 0x0B, 0xC0, 0x07, 0xD3,
-    0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x0F, 0xC0, 0x00, 0x3F, 0xFF, 0xF4, 0x3E, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0xBC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x80, 0x01, 0xFF, 0x51,
-    0x7C, 0x00, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xD5, 0x7F, 0x55, 0x55, 0x00, 0x00, 0xF8, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x7F, 0x80, 0x19, 0x00, 0x7C, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xC0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xA4, 0x00,
-    0x1B, 0xF9, 0x00, 0x3D, 0x00, 0x2F, 0xFF, 0xC0, 0x1F, 0x00, 0x3F, 0xD5, 0xA0, 0x0B, 0xC0, 0x2F,
-    0x40, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x03, 0xE0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xF0, 0x2F, 0x00,
-    0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x7D, 0x00,
-    0x00, 0x0B, 0xC0, 0x0F, 0xD0, 0x08, 0x03, 0xE0, 0x01, 0xFF, 0xFF, 0x00, 0xF4, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00,
-    0x00, 0xBC, 0xB8, 0x00, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x01, 0xF4,
-    0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03, 0xE7, 0xE7, 0xE0,
-    0x00, 0x2F, 0x0F, 0x4B, 0xC0, 0x01, 0xF4, 0x3C, 0x1F, 0x00, 0x0F, 0xC1, 0xF0, 0x7C, 0x00, 0x7C,
-    0x0B, 0xC0, 0xF4, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x2F, 0x00, 0xF4, 0x0F, 0xC0, 0xF4, 0x03, 0xC0,
-    0x2F, 0x0F, 0xC0, 0x1F, 0x00, 0x7C, 0x7D, 0x00, 0xB8, 0x01, 0xF4, 0x00, 0x00, 0x1A, 0x80, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xF7, 0xE0, 0x00, 0x02, 0xF2, 0xE0, 0x00,
-    0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0xBC, 0xB8, 0xF8, 0x00, 0xF4, 0xF8, 0xBC, 0x02, 0xF0, 0xF4, 0xBC, 0x07, 0xD0, 0xF0, 0x7C, 0x0F,
-    0x81, 0xF0, 0x3D, 0x1F, 0x02, 0xE0, 0x3D, 0x3E, 0x03, 0xD0, 0x3E, 0x00, 0x7C, 0x00, 0x00, 0xB8,
-    0x00, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3D, 0x00, 0x01,
-    0xFF, 0x40, 0x01, 0xF4, 0x00, 0x0F, 0xAE, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0xB8, 0x00, 0x2F, 0x00,
-    0x03, 0xD1, 0xF0, 0x00, 0xF8, 0x00, 0x3F, 0x07, 0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x0F, 0x40, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xF5, 0x57, 0xE7, 0xE7, 0xF0,
-    0x0F, 0x80, 0x2F, 0x0F, 0x4B, 0xC0, 0x3D, 0x00, 0xF4, 0x3C, 0x1F, 0x01, 0xF0, 0x0F, 0xC1, 0xF0,
-    0x7D, 0x0B, 0xC0, 0x7C, 0x0B, 0xC0, 0xF4, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0xF8, 0x2F, 0x00,
-    0xF4, 0x0F, 0xC7, 0xD0, 0xF8, 0x03, 0xC0, 0x2F, 0x1F, 0x0F, 0xC0, 0x1F, 0x00, 0x7C, 0xBC, 0x7D,
-    0x00, 0xB8, 0x01, 0xF4, 0x00, 0xA4, 0x00, 0x1A, 0x80, 0x00, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xF4,
-    0x00, 0xBF, 0xC0, 0x02, 0xF0, 0x01, 0xF3, 0xD0, 0x02, 0xF0, 0x03, 0xE3, 0xD0, 0x03, 0xE0, 0x07,
-    0xC2, 0xE0, 0x03, 0xE0, 0x0F, 0x82, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xC0, 0xFC, 0xF8, 0xF4, 0x0F, 0x81, 0xF0, 0xF4, 0xF8, 0x0F, 0x43, 0xE0, 0xF0, 0xF8,
-    0x1F, 0x0B, 0xC1, 0xF0, 0xBC, 0x2F, 0x0F, 0x42, 0xE0, 0x7C, 0x3E, 0x2F, 0x03, 0xD0, 0x7C, 0x3D,
-    0x7D, 0x03, 0xD0, 0x3D, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D,
-    0x00, 0x00, 0x02, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xC7,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0xF4, 0xBE, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0xFC, 0x00, 0x02,
-    0xF0, 0x2F, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0xFC, 0x07, 0xC0, 0x00, 0xBC, 0x03, 0xE0, 0x1F, 0x00,
-    0x03, 0xE0, 0x0F, 0x40, 0x7D, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0xF8, 0x02, 0xF0, 0x03,
-    0xD0, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0x40, 0x3F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x0A, 0xAA,
-    0xAA, 0xA8, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xFA, 0xAA, 0xBF, 0x00, 0x02, 0xF0, 0x03, 0xF0,
-    0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x00, 0x0F, 0xBF, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xBF, 0xBF, 0x00, 0x03, 0xE0, 0xF8, 0x3E, 0x00, 0x2F, 0x03, 0xD0,
-    0xBC, 0x00, 0xF4, 0x1F, 0x02, 0xF0, 0x0B, 0xC0, 0x7C, 0x07, 0xC0, 0x3D, 0x02, 0xE0, 0x1F, 0x03,
-    0xF0, 0x0F, 0x40, 0x3D, 0x1F, 0x40, 0x3C, 0x00, 0xF4, 0x00, 0x7C, 0x02, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x02, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x80, 0x3F, 0x55, 0x55, 0xBE, 0x00, 0x3D, 0x00,
-    0x7D, 0x00, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x03,
-    0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xF5, 0x57, 0xF4, 0xFC, 0x7F, 0x00, 0x0F, 0x80, 0x2F, 0x03, 0xE0, 0x7D,
-    0x00, 0x3D, 0x01, 0xF4, 0x0F, 0x40, 0xF4, 0x01, 0xF0, 0x0F, 0xC0, 0x7C, 0x03, 0xD0, 0x0B, 0xC0,
-    0x7D, 0x02, 0xF0, 0x0F, 0x80, 0x3E, 0x03, 0xF0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x0F, 0x40, 0x3E,
-    0x00, 0xF8, 0x07, 0xD0, 0xBC, 0x01, 0xF4, 0x03, 0xE0, 0x1F, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0xC0,
-    0xBC, 0x2F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0xA4, 0x0A, 0xAA, 0xAA, 0xA8, 0x00, 0xF4, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x01, 0xF4, 0x0F, 0xAA, 0xAB, 0xF0, 0x02, 0xF0, 0x0B, 0xC0, 0x0B, 0xC0, 0x02,
-    0xF0, 0x03, 0xD0, 0x2F, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0xBB, 0xF0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xBF, 0xBF, 0x00, 0x0F, 0xC0, 0xFC,
-    0x3E, 0x0F, 0x80, 0x0F, 0x82, 0xF0, 0x3D, 0x0B, 0xC0, 0x0F, 0x43, 0xE0, 0x3C, 0x07, 0xC0, 0x1F,
-    0x0B, 0xC0, 0x7C, 0x07, 0xC0, 0x2F, 0x0F, 0x40, 0xB8, 0x03, 0xD0, 0x3E, 0x2F, 0x00, 0xF8, 0x03,
-    0xD0, 0x3D, 0x3D, 0x00, 0xF4, 0x03, 0xE0, 0x00, 0x00, 0x64, 0x07, 0xC0, 0x00, 0x03, 0xD1, 0xFC,
-    0x00, 0x00, 0x1F, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1F, 0x90, 0x2F, 0xC0, 0x00, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x55, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x06,
-    0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x01, 0xFE, 0x94, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xFE, 0x80, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xAA,
-    0xAA, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x07, 0x81, 0xFC, 0x00,
-    0x02, 0xE3, 0xE4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x3E, 0x57, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x1B, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x6B, 0xFE, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x3F, 0x94, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0xF8, 0x00, 0xFC, 0x00, 0xFC, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x81,
-    0xF4, 0x01, 0xF4, 0x01, 0xF4, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x03, 0xF0, 0x02, 0xF0, 0x02, 0xF0,
-    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x7D, 0x00, 0x7D, 0x00, 0x7C,
-    0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x7D, 0x00, 0xFC, 0x01, 0xF4, 0x03, 0xF0, 0x0F, 0x80, 0x3F,
-    0x00, 0x3F, 0x80, 0xF4, 0x1F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x01, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xA4, 0x07, 0xC0, 0x28, 0x07, 0xD0, 0x1F, 0x01, 0xF0, 0x1F, 0x00,
-    0xBC, 0x07, 0xD0, 0xBC, 0x03, 0xE0, 0x1F, 0x43, 0xE0, 0x0F, 0x40, 0x7D, 0x0F, 0x40, 0x7C, 0x01,
-    0xF0, 0x7C, 0x02, 0xF0, 0x0B, 0xC2, 0xF0, 0x0F, 0x80, 0x2F, 0x0F, 0xC0, 0x3E, 0x00, 0xF8, 0x3E,
-    0x00, 0xF4, 0x07, 0xD0, 0xF8, 0x07, 0xC0, 0x2F, 0x03, 0xE0, 0x2F, 0x01, 0xF4, 0x0F, 0xC0, 0xF8,
-    0x0F, 0xC0, 0x2F, 0xC3, 0xD2, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE4, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xD0, 0x6F, 0xE0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x1F, 0x80, 0xFC,
-    0x00, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x02, 0xF1, 0xF8, 0x00, 0x00,
-    0x0B, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xAA, 0xAA, 0xAB, 0xF3,
-    0xF0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00,
-    0x00, 0x2F, 0x81, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x07, 0xF8, 0x02, 0xFE,
-    0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x3F, 0x96, 0xFC, 0x02, 0xF4, 0x00, 0xF8, 0x1F,
-    0x80, 0x02, 0xF0, 0xBC, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x2F, 0x1F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xF2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x1F, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x1F,
-    0x40, 0xFD, 0x02, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0F, 0xE3, 0xD0, 0x00, 0x03, 0xFF, 0x3D, 0x00, 0x00, 0xFD, 0x03, 0xE0, 0x00,
-    0x1F, 0x40, 0x3E, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x02,
-    0xF0, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x07, 0xD0, 0x00, 0x0F, 0x40, 0xFC,
-    0x00, 0x00, 0xF4, 0x1F, 0x40, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0x0F,
-    0x8B, 0xC0, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x00, 0x0B, 0xEF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x01, 0xA1, 0xF0, 0x00, 0x3F, 0xC7, 0xC0, 0x01, 0xF4, 0x1F, 0x40, 0x0F, 0x80, 0x3D, 0x00,
-    0xBC, 0x00, 0xF4, 0x03, 0xE0, 0x03, 0xE0, 0x1F, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x2F, 0x07, 0xC0,
-    0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x07, 0xCB, 0x80, 0x00, 0x0F, 0x7D, 0x00, 0x00,
-    0x3E, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0x03, 0xD1, 0xF4, 0x00, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0x00, 0xB4, 0x2D,
-    0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xFE, 0x3D,
-    0x00, 0x00, 0x3F, 0xF3, 0xD0, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x3F,
-    0x00, 0x2F, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x01, 0xF0,
-    0x03, 0xF0, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x0F, 0x41, 0xF4, 0x00,
-    0x00, 0xF4, 0x3F, 0x00, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x0B, 0x8F,
-    0x40, 0x00, 0x00, 0xBE, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x54, 0x15, 0x00, 0x01, 0xF4, 0xBD, 0x00,
-    0x03, 0xE0, 0xF8, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x01, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x68, 0x7C, 0x00, 0x0F, 0xF1, 0xF0, 0x00, 0x7D, 0x07, 0xD0,
-    0x03, 0xE0, 0x0F, 0x40, 0x2F, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0xF8, 0x07, 0xC0, 0x03, 0xE0, 0x3E,
-    0x00, 0x0B, 0xC1, 0xF0, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x7C, 0x7C, 0x00, 0x01, 0xF2, 0xE0, 0x00,
-    0x03, 0xDF, 0x40, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x6F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x06, 0x80, 0x00, 0x2A, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x1F, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x0F, 0xC1, 0xF8,
-    0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x03, 0xF0,
-    0x2F, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x00,
-    0xF8, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0xBC, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x01,
-    0xF0, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xC2, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x80, 0x0F, 0x4F, 0x80, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x7C, 0x00, 0x03, 0xF4, 0x00,
-    0x1F, 0xD0, 0x00, 0xF7, 0xD0, 0x00, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x02, 0xEF, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xE4, 0x00, 0x29, 0x00, 0x01, 0xA0, 0x02, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x96,
-    0xFC, 0x03, 0xE0, 0x00, 0x7D, 0x02, 0xF4, 0x01, 0xF8, 0x0B, 0xC0, 0x03, 0xE0, 0x1F, 0x80, 0x03,
-    0xF0, 0x2F, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x2F,
-    0x01, 0xF0, 0x0B, 0xC0, 0x1F, 0x40, 0x00, 0xBC, 0x03, 0xD0, 0x3E, 0x00, 0x7C, 0x00, 0x03, 0xF0,
-    0x0F, 0x42, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x3E, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x7D, 0x00,
-    0xB8, 0xBC, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x02, 0xE3, 0xD0, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x07,
-    0xEF, 0x00, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xBF, 0xFF, 0xC0, 0x0F, 0xE0, 0x68, 0x2F, 0x80, 0xBE, 0x00,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0xFB, 0xF0,
-    0x00, 0x00, 0x07, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00,
-    0x07, 0xE2, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x50, 0x2F, 0xC0,
-    0x1F, 0xEF, 0xE7, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x01, 0xBF, 0x90, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFB, 0xFF, 0xE0, 0x2F, 0x45, 0x0B, 0xC1, 0xF8,
-    0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x1F, 0x6F, 0x00, 0x00, 0x7C, 0xBC, 0x00, 0x03, 0xF1, 0xF0, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0xFC,
-    0x0F, 0xD7, 0xDF, 0xD0, 0x0F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0x4F, 0x41, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x6F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xE0, 0x00, 0xFE, 0x47, 0x40, 0xF4, 0x7F, 0x40, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x15, 0x00,
-    0x01, 0xF4, 0xFC, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0xFC,
-    0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0F, 0x80,
-    0x02, 0xF4, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0xBF, 0xE0, 0x2F, 0xC0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0xBF, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xD1, 0xBF, 0xC0, 0x00, 0x00, 0xE1, 0x81, 0xB0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0xBF, 0x80, 0x03, 0xFF, 0xE0,
-    0x7F, 0xFC, 0x03, 0xF9, 0x60, 0x09, 0x7F, 0x42, 0xF4, 0x00, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0x40, 0x00, 0x00,
-    0x03, 0xF7, 0xC0, 0x02, 0xE0, 0x00, 0xFA, 0xF0, 0x00, 0xF8, 0x00, 0x3E, 0xBC, 0x00, 0x3D, 0x00,
-    0x2F, 0x1F, 0x00, 0x1F, 0x00, 0x0F, 0xC7, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0xFD, 0x07, 0xF4, 0x0F,
-    0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xE2, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBA, 0xBE, 0xAD, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0x8F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0xFC, 0x00,
-    0x03, 0xE0, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x0F, 0x80, 0x00, 0x7E, 0x00,
-    0x02, 0xF0, 0x3E, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7C, 0x03,
-    0xF0, 0x00, 0xFF, 0x80, 0x03, 0xF0, 0x0F, 0xC0, 0x0B, 0xFF, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x3C,
-    0xFC, 0x00, 0xBC, 0x00, 0xBC, 0x03, 0xE2, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x1F, 0x0B, 0xC0, 0x2F,
-    0x00, 0x07, 0xD0, 0xF4, 0x1F, 0x41, 0xF4, 0x00, 0x1F, 0x4B, 0xC0, 0x3E, 0x0F, 0xC0, 0x00, 0x3E,
-    0x3D, 0x00, 0xFC, 0x7C, 0x00, 0x00, 0xFE, 0xF0, 0x02, 0xF3, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x0B,
-    0xEB, 0xEB, 0xE0, 0x00, 0x00, 0x1C, 0x0D, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x1A, 0x00, 0x02, 0x92, 0xF0, 0x00, 0xFC, 0x00, 0x0F,
-    0x4F, 0x80, 0x03, 0xE0, 0x00, 0x7C, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0xF8, 0x00, 0x3E, 0x00,
-    0x0F, 0x43, 0xE0, 0x00, 0xF8, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xE0, 0x03, 0xE0, 0x3E, 0x00, 0x3F,
-    0x80, 0x1F, 0x00, 0xF8, 0x02, 0xFE, 0x00, 0xF8, 0x02, 0xF0, 0x1F, 0xB8, 0x07, 0xC0, 0x0B, 0xC0,
-    0xF2, 0xF0, 0x3D, 0x00, 0x1F, 0x0F, 0x47, 0xC2, 0xF0, 0x00, 0x3D, 0x78, 0x0F, 0x1F, 0x00, 0x00,
-    0xFB, 0xC0, 0x3E, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFE,
-    0x41, 0x78, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9,
-    0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xD5, 0xA0, 0x2F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x10, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x38, 0x0B, 0xC0, 0x00, 0x7F, 0x8F, 0x40, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xF2, 0xFC, 0x10, 0x03, 0xD0, 0x2C,
-    0x3D, 0x0B, 0xC0, 0x00, 0x2F, 0xDF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x01, 0xF0, 0xFD, 0x00, 0x03, 0xD0, 0x18, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x1A, 0xAA, 0xBD, 0x7F, 0xFF,
-    0xFC, 0x7C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x6F, 0xF4, 0x2F, 0xFE, 0xBC,
-    0x7F, 0x80, 0x2C, 0x00, 0x00, 0x00, 0x28, 0xBC, 0xF4, 0x74, 0x1D, 0x00, 0x28, 0x7F, 0x1F, 0x1D,
-    0x74, 0x00, 0x0A, 0x90, 0x00, 0x3F, 0xFE, 0x40, 0xB8, 0x6F, 0xFC, 0xB0, 0x01, 0xA8, 0x00, 0x00,
-    0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x1C, 0x03, 0x40, 0x00, 0x00, 0x2C,
-    0x07, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x90, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x87, 0x56, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x75, 0x6D, 0x60, 0x09, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xC0, 0x34, 0x00, 0x00, 0x02,
-    0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x40, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x00, 0x02, 0x40, 0x00, 0x0F,
-    0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x01,
-    0xF9, 0x6F, 0xC0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0x01, 0xFD, 0x00, 0xF8, 0x00, 0x07,
-    0xFC, 0x00, 0xF4, 0x00, 0x0F, 0xFC, 0x01, 0xF0, 0x00, 0x3F, 0xB8, 0x02, 0xF0, 0x00, 0xBC, 0xF4,
-    0x03, 0xE0, 0x01, 0xF4, 0xF4, 0x03, 0xD0, 0x03, 0xD1, 0xF0, 0x03, 0xD0, 0x0F, 0x82, 0xF0, 0x07,
-    0xC0, 0x2F, 0x03, 0xE0, 0x0B, 0xC0, 0x7C, 0x03, 0xD0, 0x0F, 0x80, 0xF4, 0x07, 0xC0, 0x0F, 0x43,
-    0xE0, 0x07, 0xC0, 0x0F, 0x0B, 0xC0, 0x0B, 0xC0, 0x1F, 0x2F, 0x00, 0x0F, 0x80, 0x2E, 0x7D, 0x00,
-    0x0F, 0x40, 0x3E, 0xF8, 0x00, 0x1F, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0x00, 0x7F, 0xC0, 0x00, 0x2F,
-    0x50, 0xBF, 0x40, 0x00, 0x3F, 0xF0, 0xBE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x3C, 0x00, 0xFC, 0x00, 0x3F, 0xAB, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00,
-    0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03,
-    0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F,
-    0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F,
-    0xF4, 0x0F, 0xFD, 0x1F, 0xF0, 0x00, 0x40, 0x02, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x05, 0xFD, 0x50, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xF4, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0x00, 0xFD, 0x57, 0xFC, 0x0F, 0x80, 0x0B, 0xD0, 0xF4, 0x00, 0x7D, 0x1F, 0x00,
-    0x03, 0xD2, 0xF0, 0x00, 0x7D, 0x3E, 0x00, 0x0B, 0xC3, 0xE0, 0x02, 0xF8, 0x7E, 0x56, 0xFF, 0x07,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xD0, 0x00, 0x1B, 0xFE, 0xA0, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0x54, 0x00, 0x0F, 0x80,
-    0x00, 0x07, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x3E, 0x00, 0x3F, 0x0F, 0x40,
-    0x03, 0xD3, 0xD0, 0x00, 0xF4, 0xF4, 0x00, 0x7C, 0x3F, 0x00, 0x7F, 0x07, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B,
-    0xFC, 0x00, 0xF8, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00,
-    0x3E, 0x03, 0xE0, 0x10, 0x7D, 0x03, 0xD0, 0xB4, 0xFC, 0x07, 0xD0, 0x7E, 0xF8, 0x0B, 0xD5, 0x7F,
-    0xE0, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xAF, 0x40, 0x0F, 0x40, 0x0B, 0xC0, 0x1F, 0x00, 0x02,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xE0, 0x00, 0x0F, 0x1F,
-    0xFF, 0x40, 0x07, 0xDF, 0x5B, 0xF0, 0x02, 0xFE, 0x00, 0xBD, 0x00, 0xBF, 0x00, 0x1F, 0x40, 0x3F,
-    0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x2F, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x0F, 0x82, 0xC2, 0xF0, 0x07, 0xF0, 0xB9, 0xF8,
-    0x02, 0xFE, 0x0F, 0xFC, 0x00, 0xFA, 0xFF, 0xFC, 0x00, 0x3D, 0x2F, 0xFD, 0x00, 0x1F, 0x40, 0x57,
-    0xC0, 0x07, 0xC0, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0x04, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFE, 0xAA, 0xA4, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0x80, 0x0A, 0xAA, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0x55, 0x50, 0x02,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFE, 0xAA, 0xA4, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x1B, 0xE5, 0x50, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0xAA, 0xAA, 0x40, 0x3F, 0xFF, 0xC0, 0x1F, 0xAA, 0xA0, 0x0B, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xF0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55,
-    0x54, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xD5, 0x40, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0x80, 0x2F, 0xC0, 0x0F, 0x40, 0x07, 0xE0, 0x1F, 0x00, 0x03,
-    0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x01,
-    0xF4, 0x7C, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x14, 0x02, 0xFE, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x40, 0x3F, 0xFF, 0xD0,
-    0x1F, 0xAA, 0xA0, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x03, 0xF0, 0x7F, 0x80, 0xF8, 0x03, 0xF0, 0x3D, 0x00, 0x7D,
-    0x1F, 0x00, 0x0F, 0x4B, 0xC0, 0x03, 0xD3, 0xE0, 0x00, 0xF4, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x09, 0x0B, 0xF4, 0x03, 0xFF, 0xF4,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x0F,
-    0x80, 0x03, 0xD0, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x07, 0xC0, 0x0B, 0xD0, 0x00, 0x03, 0xE0, 0x0B,
-    0xC0, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x41, 0xF8,
-    0x00, 0x00, 0x00, 0xBC, 0x1F, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0x2F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBC, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0xF8, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xF8, 0x3F, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0xF4, 0x1F, 0x40, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8,
-    0x02, 0xF0, 0x07, 0xD0, 0x00, 0x07, 0xF0, 0x03, 0xE0, 0x03, 0xF5, 0x00, 0x0F, 0xC0, 0x03, 0xD0,
-    0x01, 0xFF, 0x80, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x02, 0xFD, 0x00, 0x0A, 0x00, 0x0B, 0xF4, 0x0F, 0xFE, 0x00, 0x7C, 0x02,
-    0xFF, 0xC0, 0x15, 0xFD, 0x02, 0xF0, 0x2F, 0xD1, 0x00, 0x00, 0xFC, 0x0F, 0x81, 0xF8, 0x00, 0x00,
-    0x02, 0xF0, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0xF0, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0x07,
-    0xC2, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0x83, 0xD1, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0x7C, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x42, 0xE0, 0x3F, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0x40,
-    0xBD, 0x00, 0x03, 0xFF, 0xC0, 0x3D, 0x00, 0xFF, 0xF0, 0x1F, 0xF8, 0x01, 0xF0, 0x00, 0xFF, 0xC0,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x39, 0x06, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x15, 0x6F, 0x80, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x74, 0x00, 0x7F, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x01, 0x7E, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xBF, 0x90,
-    0x02, 0xFF, 0xFF, 0x00, 0x79, 0x5B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x24, 0x00, 0xBD, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x05, 0xF4,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x02, 0xF0, 0x00,
-    0x7E, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x01, 0xF4, 0x07, 0xF0, 0x00,
-    0x0B, 0xC0, 0x7F, 0x00, 0x00, 0x2F, 0x07, 0xF0, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x03, 0xD3,
-    0xF0, 0x00, 0x00, 0x1F, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xF7, 0xD0, 0x00,
-    0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x3D, 0x1F, 0x80, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00,
-    0xF9, 0x40, 0x1F, 0x00, 0x02, 0xFF, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xA4, 0x00, 0xA8, 0x00, 0xF4, 0x02,
-    0xF0, 0x01, 0xF0, 0x0B, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x03, 0xE2, 0xF0,
-    0x00, 0x03, 0xDB, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xCF, 0x80,
-    0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x1F, 0x01, 0xF8, 0x00, 0x2F, 0x00, 0xBD,
-    0x00, 0x3E, 0x00, 0x3F, 0xF0, 0x3D, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x00,
-    0x3E, 0x00, 0x7E, 0x00, 0x01, 0xF4, 0xBB, 0xE0, 0x00, 0x0B, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0x0F,
-    0xE0, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x1F, 0x7F, 0x40, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x3D,
-    0x2F, 0x80, 0x00, 0x01, 0xF0, 0xBF, 0x00, 0x00, 0x0B, 0xC3, 0xFF, 0x00, 0x00, 0x3F, 0x0F, 0x7D,
-    0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x02, 0xF4, 0x00,
-    0xBC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xA4, 0x00, 0x69, 0x00, 0xF4, 0x51, 0xF8, 0x01, 0xF1, 0xD7,
-    0xE0, 0x02, 0xF2, 0xEF, 0x40, 0x03, 0xF3, 0xFD, 0x00, 0x03, 0xE3, 0xF4, 0x00, 0x03, 0xDB, 0xD0,
-    0x00, 0x07, 0xEF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x0F, 0x8F, 0xC0,
-    0x00, 0x0F, 0x5F, 0xF0, 0x00, 0x1F, 0x2E, 0xF8, 0x00, 0x2F, 0x3C, 0xBC, 0x00, 0x3E, 0x28, 0x3F,
-    0x00, 0x3D, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x7E, 0x00, 0x5F,
-    0xD4, 0x07, 0xE0, 0x03, 0xFF, 0xF0, 0x7E, 0x00, 0x1F, 0xFF, 0xC7, 0xE0, 0x00, 0x0B, 0xC0, 0x7E,
-    0x00, 0x00, 0x2F, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x7E, 0x00, 0x00, 0x03, 0xD7, 0xE0, 0x00, 0x00,
-    0x1F, 0x7E, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFB, 0xD0, 0x00, 0x00, 0x0F, 0x8F,
-    0xC0, 0x00, 0x00, 0x3D, 0x1F, 0x80, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00,
-    0x00, 0x3E, 0x00, 0xBD, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x01, 0xF8, 0x00, 0x1F,
-    0x00, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xBF, 0xA8, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xBD, 0x54,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0xF4, 0x02, 0xF4, 0x01, 0xF0, 0x0B,
-    0xD0, 0x02, 0xF0, 0x2F, 0x40, 0x03, 0xF0, 0xBD, 0x00, 0x03, 0xE2, 0xF4, 0x00, 0x03, 0xDB, 0xD0,
-    0x00, 0x07, 0xEF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xCF, 0x80, 0x00, 0x0F, 0x8B, 0xD0,
-    0x00, 0x0F, 0x43, 0xF0, 0x00, 0x1F, 0x01, 0xF8, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x3F,
-    0x00, 0x3D, 0x00, 0x1F, 0x80, 0x3F, 0xFF, 0x00, 0x01, 0xF8, 0x3F, 0xFF, 0x00, 0x07, 0xF0, 0x15,
-    0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0x7C,
-    0x03, 0xF0, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFC,
-    0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xF7, 0xD0, 0x00,
-    0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0xBD, 0x00, 0x00,
-    0x07, 0xC0, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x0F,
-    0x40, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x6A, 0xAA,
-    0x00, 0x1A, 0x6F, 0xFF, 0xC0, 0x1F, 0x86, 0xAB, 0xE0, 0x1F, 0x80, 0x00, 0xF4, 0x1F, 0x80, 0x00,
-    0x7C, 0x1F, 0x80, 0x00, 0x2F, 0x1F, 0x80, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0xFB, 0xD0, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x0F, 0x82, 0xF4,
-    0x00, 0x03, 0xD0, 0x3F, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0xBD, 0x00, 0x2F, 0x00,
-    0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x0F,
-    0x40, 0x3E, 0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x2F,
-    0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x03, 0xF5, 0x55, 0x57, 0xE0, 0x0F, 0x80, 0x00, 0x0F, 0x40,
-    0x3D, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x3F, 0x00,
-    0x00, 0x3E, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x07, 0xD0, 0x00, 0x07, 0xD4, 0x1F, 0x00, 0x00, 0x2F,
-    0xF4, 0xBC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0xA4, 0x00, 0x0A, 0x40, 0x3D, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x01, 0xF0,
-    0x0B, 0xC0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x07,
-    0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x00,
-    0x0F, 0x80, 0x3D, 0x00, 0x07, 0xD0, 0x1F, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0xBC, 0x03, 0xE0,
-    0x00, 0x3F, 0xF0, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBC, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0xF8, 0x00,
-    0x00, 0xF9, 0x54, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x0F, 0xD5, 0x55, 0x5F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x0F,
-    0x40, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x0A, 0xAA, 0x90, 0x0F, 0x40, 0x00, 0xFF, 0xFD, 0x01, 0xF0, 0x00, 0x1F, 0xAA, 0x80,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0x40,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFD, 0x55, 0x57, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0xF9, 0x50, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x7F, 0x40, 0xF4, 0x00, 0x03, 0xF0,
-    0x00, 0xFC, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xD2, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x3E, 0x3F,
-    0x00, 0x00, 0x7C, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xE7, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0xFA, 0xAA, 0xBE, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x00,
-    0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0xFF, 0x80,
-    0x0B, 0xC0, 0x00, 0xFF, 0xFF, 0x40, 0xFC, 0x00, 0x1F, 0x41, 0xFC, 0x0F, 0x80, 0x02, 0xF0, 0x07,
-    0xE0, 0xF4, 0x00, 0x3E, 0x00, 0x3F, 0x1F, 0x00, 0x03, 0xE0, 0x02, 0xF2, 0xF0, 0x00, 0x7D, 0x00,
-    0x2F, 0x3E, 0x00, 0x07, 0xC0, 0x02, 0xF3, 0xD0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x01, 0x41, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0F, 0xF9, 0x05, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x1B, 0xE0, 0x0F, 0xC0, 0x07, 0xFF, 0xC2, 0xF0, 0x01, 0xFD, 0xBE, 0x3F, 0x00, 0x3F, 0x03,
-    0xF7, 0xD0, 0x07, 0xD0, 0x3F, 0xBC, 0x00, 0xFC, 0x03, 0xFB, 0xC0, 0x0F, 0x80, 0x3F, 0xFC, 0x01,
-    0xF4, 0x03, 0xFF, 0xC0, 0x1F, 0x40, 0x3E, 0xFC, 0x01, 0xF4, 0x0B, 0xDF, 0xC0, 0x1F, 0x40, 0xFC,
-    0xBC, 0x01, 0xF4, 0x1F, 0x87, 0xE0, 0x0F, 0x83, 0xF0, 0x3F, 0x40, 0xFC, 0xFC, 0x01, 0xFE, 0x0B,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xE1, 0x40, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0x42, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xF9, 0x10, 0x00,
-    0x0F, 0xC0, 0x01, 0x40, 0x1F, 0x40, 0x3F, 0xF0, 0x3F, 0x00, 0xFF, 0xF8, 0x3D, 0x03, 0xF0, 0xBC,
-    0x7C, 0x03, 0xE0, 0x7C, 0xBC, 0x07, 0xC0, 0x7C, 0xBC, 0x0B, 0xC0, 0xBC, 0xBC, 0x0B, 0xC0, 0xF8,
-    0x7C, 0x0B, 0xC2, 0xF0, 0x3E, 0x07, 0xD7, 0xD0, 0x3F, 0x43, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x50,
-    0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x14, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x41, 0x78, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x19, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xD5, 0xA0, 0x2F, 0x80,
-    0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0,
-    0x08, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0xF0, 0x00, 0x05, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x5F, 0xD5, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0x80, 0x0B,
-    0xE0, 0x00, 0x3C, 0x7F, 0xFC, 0x1F, 0xFF, 0x00, 0x1F, 0x7D, 0x6F, 0x5F, 0x5B, 0xE0, 0x0B, 0xF8,
-    0x03, 0xFE, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x1F, 0x40, 0x07, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-    0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0x7D, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xF4, 0xF4, 0x00, 0x3E, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x03,
-    0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xC0, 0xBC,
-    0x00, 0x07, 0xC0, 0xF8, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x68, 0x00, 0x02, 0xA1, 0xF0, 0x00, 0x1F,
-    0x47, 0xC0, 0x00, 0xFC, 0x0F, 0x40, 0x07, 0xC0, 0x3D, 0x00, 0x3E, 0x00, 0xF8, 0x02, 0xF0, 0x03,
-    0xE0, 0x0F, 0x80, 0x0B, 0xC0, 0xBC, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0xF1,
-    0xF0, 0x00, 0x03, 0xCF, 0x80, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x0B,
-    0xD0, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x07, 0xC0,
-    0xF8, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x2A, 0x01, 0xF0,
-    0x00, 0x1F, 0x40, 0x7C, 0x00, 0x0F, 0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x00,
-    0xF8, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x02, 0xF0, 0x7D, 0x00,
-    0x00, 0x7C, 0x3F, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x03, 0xCF, 0x80, 0x00, 0x00, 0xFB, 0xC0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x7D, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x0B, 0xC0,
-    0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x00,
-    0x00, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x0B, 0xC7,
-    0xC0, 0x00, 0x00, 0x2F, 0x03, 0xD0, 0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x01, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xBD, 0x40, 0x1F, 0x40, 0x00, 0x7F, 0xD0,
-    0x3E, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0xA8, 0x00, 0x1A, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x0F, 0xC0,
-    0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x02, 0xF7, 0xD0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xF7,
-    0xC0, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x01, 0xF4, 0x1F, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0xFC,
-    0x00, 0xBF, 0xC0, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x0B, 0x8F, 0xFF, 0xFF, 0xFF, 0x03, 0xE2, 0xAA, 0xFE, 0xAA, 0x41,
-    0xF4, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x0F,
-    0x80, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0xBC,
-    0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x03, 0xD0,
-    0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00,
-    0x07, 0xC0, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00,
-    0x3F, 0x55, 0x55, 0xFD, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2A,
-    0xAA, 0xAA, 0x06, 0x8B, 0xFF, 0xFF, 0xF0, 0xBC, 0x6A, 0xBE, 0xA9, 0x0F, 0x80, 0x0B, 0xC0, 0x00,
-    0xF8, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x1F,
-    0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xFC,
-    0x00, 0x3D, 0x00, 0x2F, 0xC0, 0x03, 0xD0, 0x07, 0xF8, 0x00, 0x3E, 0x02, 0xEF, 0x80, 0x03, 0xFF,
-    0xF8, 0xFF, 0x80, 0x0F, 0xFD, 0x07, 0xF4, 0x00, 0x04, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x0B, 0x80, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x3D, 0x1F, 0x00,
-    0x00, 0x7C, 0x2F, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0xF8, 0x7D, 0x00,
-    0x01, 0xF4, 0x7C, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x02, 0xF0, 0xBD, 0x00, 0x07, 0xE0, 0x3F, 0xAA,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xBA, 0x4B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x50, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x1A, 0x00,
-    0x02, 0x93, 0xE0, 0x00, 0x7C, 0x3E, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0xFC, 0xBC, 0x00, 0x0F, 0x8B,
-    0xC0, 0x02, 0xF4, 0xBC, 0x00, 0x7F, 0x0B, 0xC0, 0x1F, 0xF0, 0x7F, 0xAF, 0xFE, 0x03, 0xFF, 0xE3,
-    0xE0, 0x06, 0x90, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0x40, 0x0B, 0x80, 0x00, 0x2E, 0x0F,
-    0x80, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0xBC, 0x3F,
-    0x00, 0x00, 0xFC, 0x3E, 0x01, 0x40, 0xF8, 0x3D, 0x07, 0x81, 0xF4, 0x7C, 0x0B, 0x41, 0xF0, 0xBC,
-    0x0F, 0x02, 0xF0, 0x7D, 0x0F, 0x07, 0xE0, 0x3F, 0xAF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xD0, 0x02,
-    0xBE, 0x4B, 0xC0, 0x00, 0x3C, 0x0F, 0xC0, 0x00, 0x3C, 0x0F, 0x80, 0x00, 0x78, 0x0F, 0x40, 0x00,
-    0xB4, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x1A,
-    0x00, 0x02, 0x93, 0xE0, 0x00, 0x7C, 0x3E, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0xFC, 0x7C, 0x18, 0x0F,
-    0x8B, 0xC2, 0xC2, 0xF4, 0xFC, 0x3C, 0x7F, 0x0B, 0xC3, 0x9F, 0xF0, 0x7F, 0xBF, 0xBE, 0x02, 0xFF,
-    0xE3, 0xE0, 0x06, 0xF0, 0x7D, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0xE0, 0xFC, 0x00, 0x1D, 0x0F, 0x80,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x5A, 0x40, 0x03, 0xEB, 0xFF, 0xF4, 0x07, 0xFF, 0xFB, 0xFC, 0x0B,
-    0xE4, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x3D, 0x1F,
-    0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0xF8, 0x7D,
-    0x00, 0x01, 0xF4, 0x7C, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xD0, 0x00, 0xF5, 0xFF, 0xF8, 0x01,
-    0xF7, 0xD5, 0xFC, 0x02, 0xFE, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x7C, 0x03,
-    0xE0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F,
-    0x80, 0x02, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E,
-    0x00, 0x07, 0xC0, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xF9, 0x07, 0xF8, 0x00, 0x02, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC2, 0x91, 0xF4,
-    0x00, 0x00, 0xFC, 0x3C, 0x3F, 0x00, 0x00, 0x3F, 0x83, 0xC3, 0xE0, 0x00, 0x6F, 0xF0, 0x3F, 0xFF,
-    0xAF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFE, 0xA9, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x6F, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F,
-    0xE5, 0xBD, 0x00, 0x2F, 0x40, 0x3E, 0x78, 0x3E, 0x00, 0x3E, 0xF4, 0xBC, 0x00, 0x7D, 0xF8, 0xF8,
-    0x06, 0xF8, 0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xA0, 0x00, 0x7F,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xF9, 0x07, 0xF8,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0x0B,
-    0xC2, 0x91, 0xF4, 0x00, 0x00, 0xFC, 0x3C, 0x3F, 0x00, 0x00, 0x3F, 0x83, 0xC3, 0xE0, 0x00, 0x6F,
-    0xF0, 0x3F, 0xFF, 0xAF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFE, 0xA9, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x6F, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xE5, 0xBD,
-    0x00, 0x2F, 0x40, 0x3E, 0x78, 0x3E, 0x00, 0x3E, 0xF4, 0xBC, 0x00, 0x7D, 0xF8, 0xF8, 0x06, 0xF8,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xA0, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x02, 0xE0,
-    0x00, 0x7E, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xF0,
-    0x00, 0x02, 0xF0, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x2F, 0x40, 0x00, 0x00,
-    0xBC, 0x0B, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x81, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x0F,
-    0x47, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0x7E, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x3D, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7C, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0,
-    0xBC, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0xF8, 0x03,
-    0xF0, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00,
-    0x1F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x06, 0x80, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD6,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0xA4, 0x00, 0x6F, 0x80, 0x7F, 0xE0,
-    0x03, 0xD0, 0x0B, 0xFE, 0x00, 0x5F, 0xD0, 0x0F, 0x00, 0xFE, 0x50, 0x00, 0x0F, 0x80, 0x7C, 0x07,
-    0xD0, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x81, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x1F, 0x00,
-    0x00, 0x00, 0x3F, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x00, 0xF4, 0x00, 0x00, 0x1F,
-    0x80, 0xBC, 0x03, 0xF0, 0x00, 0x3F, 0xFC, 0x02, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x0F, 0x40,
-    0x07, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x02,
-    0xF0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x01, 0xF4, 0x07,
-    0xE0, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x2F, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x7E, 0x00, 0x00,
-    0x03, 0xD3, 0xE0, 0x00, 0x00, 0x1F, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x03, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0F, 0xD0, 0x1F, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0xD0, 0x01, 0xF0, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x07,
-    0xD0, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x20, 0x06, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0xA8, 0x00, 0xF4, 0x02, 0xF4, 0x01, 0xF0, 0x0B, 0xD0,
-    0x02, 0xF0, 0x2F, 0x40, 0x03, 0xF0, 0xBD, 0x00, 0x03, 0xE2, 0xF4, 0x00, 0x03, 0xDB, 0xD0, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x0F, 0x80, 0x1F, 0x80,
-    0x0F, 0x40, 0x0B, 0xC0, 0x1F, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xC0,
-    0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x7F, 0x00, 0x05, 0x02, 0xFC, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFA, 0xAB, 0xE0, 0x00, 0x00, 0xF4, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x03, 0xE0, 0x00, 0x02,
-    0xF0, 0x01, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x01, 0xF0,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00,
-    0x03, 0xD0, 0x00, 0x2F, 0x80, 0x01, 0xF5, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0xFF, 0x80, 0x00,
-    0x3F, 0xF0, 0x05, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x06, 0xBA, 0x40, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x0B, 0xE5, 0xF8, 0x00,
-    0x07, 0xD0, 0x3D, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xBC, 0x03, 0xE0,
-    0x00, 0x3E, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x03, 0xE0, 0x0B,
-    0xC0, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x7D, 0x07, 0xFD, 0x00,
-    0x2F, 0xF5, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x3E,
-    0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00,
-    0x3E, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x03, 0xF5, 0x55, 0x57, 0xE0, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x3D, 0x00,
-    0x00, 0x7C, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x3E,
-    0x00, 0xF8, 0x00, 0x01, 0xF4, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0xBC,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x24, 0x06, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x0A, 0x40, 0x3D,
-    0x00, 0x03, 0xD0, 0x1F, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x3F, 0x00,
-    0xF8, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x07, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x03, 0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x07, 0xD0, 0x1F, 0x00, 0x02,
-    0xF0, 0x0B, 0xC0, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0x40, 0xBE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x3E,
-    0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00,
-    0x3E, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x03, 0xF5, 0x55, 0x57, 0xE0, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x3D, 0x00,
-    0x00, 0x7C, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x3E,
-    0x00, 0xF8, 0x00, 0x01, 0xF4, 0x07, 0xD0, 0x00, 0x07, 0xD4, 0x1F, 0x00, 0x00, 0x2F, 0xF4, 0xBC,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0xA4, 0x00, 0x0A, 0x40, 0x3D, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x01, 0xF0, 0x0B, 0xC0,
-    0x00, 0xBC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x07, 0xD0, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0F, 0x80,
-    0x3D, 0x00, 0x07, 0xD0, 0x1F, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x3F,
-    0xF0, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0B,
-    0x80, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x7C, 0x2F,
-    0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x01, 0xF4, 0x7C,
-    0x00, 0x01, 0xF0, 0xBC, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x07, 0xE0, 0x3F, 0xAA, 0xFF, 0xD0, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x02, 0xBA, 0x4B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x6F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0A, 0x40, 0x01, 0xA0, 0x7D,
-    0x00, 0x0B, 0xC1, 0xF0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0xF4, 0x3E, 0x00, 0x0B, 0xC0, 0xF8, 0x00,
-    0x3F, 0x03, 0xD0, 0x02, 0xFC, 0x0F, 0x80, 0x2F, 0xE0, 0x3F, 0xEB, 0xEF, 0x40, 0x3F, 0xFD, 0x7C,
-    0x00, 0x1A, 0x42, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC,
-    0x00, 0xFB, 0x80, 0x00, 0x0F, 0xBC, 0x01, 0xF7, 0xC0, 0x00, 0x2E, 0xF8, 0x02, 0xF7, 0xC0, 0x00,
-    0x7C, 0xF8, 0x03, 0xE3, 0xC0, 0x00, 0xF8, 0xF4, 0x03, 0xD3, 0xC0, 0x01, 0xF1, 0xF0, 0x03, 0xD3,
-    0xC0, 0x03, 0xD2, 0xF0, 0x07, 0xC3, 0xD0, 0x07, 0xC3, 0xE0, 0x0B, 0xC2, 0xD0, 0x0F, 0x43, 0xD0,
-    0x0F, 0x82, 0xE0, 0x2F, 0x07, 0xD0, 0x0F, 0x41, 0xE0, 0x3D, 0x0B, 0xC0, 0x0F, 0x01, 0xF0, 0xB8,
-    0x0B, 0xC0, 0x1F, 0x00, 0xF0, 0xF0, 0x0F, 0x80, 0x2F, 0x00, 0xF2, 0xE0, 0x0F, 0x40, 0x3E, 0x00,
-    0xF7, 0xC0, 0x1F, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x2F, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x3F, 0x50,
-    0xBC, 0x00, 0xBD, 0x00, 0x3F, 0xF0, 0xB8, 0x00, 0xBC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0xA9, 0x00, 0x00, 0xA9, 0x00, 0xFE, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x02,
-    0xEF, 0x00, 0x0B, 0xBC, 0x02, 0xDF, 0x00, 0x1F, 0xB8, 0x03, 0xCF, 0x00, 0x3D, 0xB8, 0x03, 0xCF,
-    0x40, 0x7C, 0xF4, 0x07, 0xCB, 0x40, 0xF4, 0xF0, 0x0B, 0x87, 0x81, 0xE1, 0xF0, 0x0F, 0x47, 0x83,
-    0xC2, 0xE0, 0x0F, 0x03, 0xCB, 0x83, 0xD0, 0x0F, 0x03, 0xCF, 0x03, 0xD0, 0x1F, 0x03, 0xED, 0x07,
-    0xC0, 0x2E, 0x03, 0xFC, 0x07, 0xC0, 0x3D, 0x02, 0xF4, 0x0B, 0xFC, 0x3C, 0x02, 0xF0, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
-    0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x0B, 0xC0, 0x00, 0x01, 0xFE,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x3E, 0xF0, 0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xFC, 0x3C,
-    0x00, 0x00, 0x07, 0xD0, 0xF4, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00,
-    0x0F, 0x80, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0xF4,
-    0x03, 0xF0, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x1A, 0x00, 0xA4, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0F, 0x97, 0xE0,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28,
-    0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0,
-    0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0,
-    0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40,
-    0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00,
-    0x50, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x2F,
-    0x7C, 0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x1F, 0x43, 0xD0, 0x00,
-    0x03, 0xF0, 0x3D, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x01, 0xF0, 0x02,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x2F,
-    0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xF8, 0x1F, 0x80, 0x00, 0x0F,
-    0x83, 0xF0, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0x00, 0x40, 0x00, 0x0F,
-    0x43, 0xE0, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x05, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0,
-    0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00,
-    0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00,
-    0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD,
-    0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFD, 0x55, 0x54, 0x00, 0x00, 0x01, 0xF4, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xD0, 0x0F, 0xD5, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x7E, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xD0, 0x60, 0xBF, 0x40, 0x03,
-    0xFF, 0xE3, 0xDF, 0xFF, 0x80, 0x3F, 0x96, 0xEF, 0xF8, 0x7F, 0x02, 0xF8, 0x03, 0xFF, 0x00, 0x7D,
-    0x0F, 0xC0, 0x0B, 0xF0, 0x01, 0xF0, 0xBC, 0x00, 0x1F, 0x80, 0x0F, 0xC3, 0xF0, 0x00, 0xBC, 0x01,
-    0xFD, 0x0F, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x7D, 0x00, 0x0F, 0xFF, 0xF4, 0x02, 0xF0, 0x00, 0x7E,
-    0x00, 0x00, 0x0B, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7C, 0x00,
-    0xFF, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0xBF, 0xC0, 0x19, 0x03, 0xFF, 0xF2, 0xEF, 0xFF, 0xF4, 0x03,
-    0xFE, 0x0F, 0x1F, 0xFF, 0x80, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0x80, 0x2D, 0x00,
-    0x07, 0xC0, 0x7C, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00,
-    0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F,
-    0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x29, 0x00, 0xA0, 0x00, 0xF4, 0x0B, 0xC0, 0x02,
-    0xF5, 0xBC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xF9, 0x2F, 0x80, 0x2F, 0x40, 0x3E, 0x00, 0xF8, 0x00, 0xF8,
-    0x0B, 0xC0, 0x07, 0xD0, 0x3E, 0x01, 0xBE, 0x01, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xD0,
-    0x06, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0x90, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x05, 0x5B, 0xC0,
-    0x06, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x90, 0x00, 0xF8, 0x3F, 0x40, 0x00,
-    0x2F, 0x4B, 0xD0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0xBC,
-    0x00, 0x07, 0xF0, 0x07, 0xF4, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x40,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0xD0, 0x07, 0x91, 0xBF,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x01,
-    0xAF, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0x95, 0xF8, 0x2F, 0x40, 0x1F, 0x03, 0xD0, 0x03, 0xF0,
-    0x7D, 0x00, 0xBC, 0x03, 0xE0, 0x2F, 0x80, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x3D, 0x00,
-    0x00, 0x09, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x01, 0xF9, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x55, 0xBC, 0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xF9, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0x02, 0xF4, 0xBD, 0x00, 0x00, 0x3F,
-    0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x7F, 0x40,
-    0x7F, 0xC0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0x80, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0xD0, 0x07, 0x91, 0xBF, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xAF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0x95, 0xF8, 0x2F, 0x40, 0x1F, 0x03, 0xD0, 0x03, 0xF0, 0x7D,
-    0x00, 0xBC, 0x03, 0xE0, 0x2F, 0x80, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x02, 0xE0,
-    0x00, 0x7E, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xF0,
-    0x00, 0x02, 0xF0, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x2F, 0x40, 0x00, 0x00,
-    0xBC, 0x0B, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x81, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x0F,
-    0x47, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0x7E, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x3D, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7C, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0,
-    0xBC, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0xF8, 0x03,
-    0xF0, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00,
-    0x1F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x82,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0xA4, 0x00, 0x6F, 0x80, 0x7F, 0xE0,
-    0x03, 0xD0, 0x0B, 0xFE, 0x00, 0x5F, 0xD0, 0x0F, 0x00, 0xFE, 0x50, 0x00, 0x0F, 0x80, 0x7C, 0x07,
-    0xD0, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x81, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x1F, 0x00,
-    0x00, 0x00, 0x3F, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x00, 0xF4, 0x00, 0x00, 0x1F,
-    0x80, 0xBC, 0x03, 0xF0, 0x00, 0x3F, 0xFC, 0x02, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x0F, 0x40,
-    0x07, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0xF0, 0x3D, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x90, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x39, 0x06, 0xFC, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x15,
-    0x6F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x74, 0x00, 0x7F, 0xC0, 0x7F, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0x03,
-    0xD0, 0x07, 0xC0, 0xF4, 0x00, 0x90, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9,
-    0x00, 0x2F, 0xFF, 0xF0, 0x07, 0x95, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC2, 0x40, 0x0B, 0xD0, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
-    0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x6A, 0xAA,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x15, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0xE4, 0x00, 0x7F,
-    0x40, 0xFF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x6A, 0xAA,
-    0xA8, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x6A, 0xAB, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x16, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0xE4, 0x06, 0xFC,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xC0, 0x03, 0xE0, 0x00, 0x2F, 0xE0, 0x01, 0xF4,
-    0x00, 0x1F, 0xF4, 0x00, 0xBC, 0x00, 0x0F, 0xBD, 0x00, 0x2F, 0x00, 0x0F, 0x9F, 0x00, 0x0F, 0x80,
-    0x0B, 0xCB, 0xC0, 0x03, 0xD0, 0x07, 0xC3, 0xE0, 0x01, 0xF4, 0x03, 0xD0, 0xF4, 0x00, 0xBC, 0x03,
-    0xE0, 0x7C, 0x00, 0x3F, 0x02, 0xF0, 0x2F, 0x00, 0x0F, 0x81, 0xF0, 0x0F, 0xC0, 0x03, 0xD0, 0xF4,
-    0x03, 0xE0, 0x01, 0xF0, 0xF8, 0x01, 0xF4, 0x00, 0xBC, 0xBC, 0x00, 0x7C, 0x00, 0x3E, 0x7C, 0x00,
-    0x2F, 0x00, 0x0F, 0xBD, 0x00, 0x0F, 0x80, 0x07, 0xFE, 0x00, 0x03, 0xD0, 0x02, 0xFF, 0x00, 0x01,
-    0xF4, 0x00, 0xBF, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00,
-    0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01,
-    0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07,
-    0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x03, 0xD0, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x3E,
-    0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x3E, 0x00, 0x02, 0xFE,
-    0x00, 0x1F, 0x40, 0x01, 0xFF, 0x40, 0x0B, 0xC0, 0x00, 0xFB, 0xD0, 0x02, 0xF0, 0x00, 0xF9, 0xF0,
-    0x00, 0xF8, 0x00, 0xBC, 0xBC, 0x00, 0x3D, 0x00, 0x7C, 0x3E, 0x00, 0x1F, 0x40, 0x3D, 0x0F, 0x40,
-    0x0B, 0xC0, 0x3E, 0x07, 0xC0, 0x03, 0xF0, 0x2F, 0x02, 0xF0, 0x00, 0xF8, 0x1F, 0x00, 0xFC, 0x00,
-    0x3D, 0x0F, 0x40, 0x3E, 0x00, 0x1F, 0x0F, 0x80, 0x1F, 0x40, 0x0B, 0xCB, 0xC0, 0x07, 0xC0, 0x03,
-    0xE7, 0xC0, 0x02, 0xF0, 0x00, 0xFB, 0xD0, 0x00, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3D, 0x00, 0x2F,
-    0xF0, 0x00, 0x1F, 0x40, 0x0B, 0xF0, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0x00, 0x40, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x06, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07,
-    0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F,
-    0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D,
-    0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F,
-    0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x7C, 0x00, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0x41, 0xBF, 0x80, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xC7, 0xE0, 0x00,
-    0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xC2, 0xF0,
-    0x00, 0x00, 0xBE, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x1F, 0xE0, 0x0B,
-    0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x02, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xF9,
-    0x6F, 0xC0, 0x2F, 0x40, 0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0xBC, 0x3E, 0x00, 0x02,
-    0xF1, 0xF4, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD1,
-    0xF0, 0x00, 0x3F, 0x07, 0xE0, 0x01, 0xF4, 0x0F, 0xD0, 0x2F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x6F, 0xE0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x2F,
-    0x80, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x02, 0xF1, 0xF8, 0x00, 0x00, 0x0B, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xFE, 0xAA, 0xAA, 0xAB, 0xF3, 0xF0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x2F, 0x81, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F,
-    0xD0, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x3F, 0x96, 0xFC,
-    0x02, 0xF4, 0x00, 0xF8, 0x1F, 0x80, 0x02, 0xF0, 0xBC, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x2F, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x1F, 0x00,
-    0x02, 0xF0, 0x7D, 0x00, 0x1F, 0x40, 0xFD, 0x02, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x00,
-    0x2F, 0x07, 0xC0, 0x00, 0x00, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x41, 0xBF, 0x80,
-    0x0F, 0xE0, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40,
-    0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xC7, 0xE0, 0x00, 0x00, 0x2F, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFA, 0xAA, 0xAA, 0xAF, 0xCF, 0xC0, 0x00, 0x00, 0x7E, 0x3F,
-    0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0xBE, 0x07, 0xE0, 0x00,
-    0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xB8,
-    0x1F, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x06, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBE, 0x80, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xF9, 0x6F, 0xC0, 0x2F, 0x40, 0x0F, 0x81,
-    0xF8, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0xBC, 0x3E, 0x00, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD1, 0xF0, 0x00, 0x2F, 0x07, 0xD0, 0x01,
-    0xF4, 0x0F, 0xD0, 0x2F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0xBC, 0x1F, 0x00, 0x00, 0x08,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0xE4, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x05, 0x55, 0x5F, 0xC0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x64, 0x01, 0xBF, 0x80, 0x2F, 0xFF, 0xFF, 0x40, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x0F,
-    0x83, 0xF0, 0x01, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x2F,
-    0xFF, 0xE0, 0x07, 0x95, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x40, 0x0F, 0xD0, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x1F, 0x00, 0x00, 0xBD, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x02, 0xF0,
-    0x00, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x00, 0x3E, 0x03, 0xF0,
-    0x00, 0x00, 0xBC, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00,
-    0x0F, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x02, 0xA0, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x00, 0xFC,
-    0x00, 0x0F, 0x40, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x02,
-    0xF0, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x2F,
-    0x00, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0x0F, 0x7D, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00,
-    0x14, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x1F, 0x40, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x0B, 0xD0, 0x03, 0xD0, 0x00, 0x3F, 0x00,
-    0x0F, 0x80, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x00, 0xF4,
-    0x07, 0xD0, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x0B, 0xC1, 0xF0, 0x00, 0x00, 0x1F, 0x0F, 0x80,
-    0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00,
-    0x1F, 0x43, 0xE0, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x2A, 0x00, 0x1F, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F, 0xC0,
-    0x00, 0xF4, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x00, 0x2F,
-    0x00, 0xF8, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x03, 0xC2, 0xF0,
-    0x00, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x50, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x0F,
-    0x43, 0xD0, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x00, 0x2F, 0x40, 0x0F,
-    0x40, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x03,
-    0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x2F, 0x07, 0xC0, 0x00,
-    0x00, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x50, 0x00, 0x00,
-    0x1F, 0x4B, 0xD0, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x00, 0xB4, 0x3C,
-    0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0xA8, 0x00,
-    0x7C, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0x0F, 0x80,
-    0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x2F, 0x00,
-    0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x00, 0x3C, 0x3E, 0x00, 0x00, 0x00,
-    0xF6, 0xF0, 0x00, 0x00, 0x03, 0xDF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0xF8, 0x2F,
-    0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x06, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x3F, 0x03, 0xE0,
-    0x00, 0x0F, 0x80, 0xF4, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0xBC, 0x0B,
-    0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x07, 0xD0, 0x0F, 0xD0, 0x17, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0B,
-    0x81, 0xF0, 0x00, 0xF8, 0x2F, 0x00, 0x06, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x02, 0x93, 0xF0, 0x00, 0x7D, 0x3E, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0xFC, 0x7C, 0x00,
-    0x0F, 0x8B, 0xC0, 0x02, 0xF4, 0xBC, 0x00, 0x7F, 0x0B, 0xC0, 0x1F, 0xF0, 0x7F, 0xAF, 0xEF, 0x03,
-    0xFF, 0xE3, 0xE0, 0x06, 0x90, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0xFD, 0x55, 0x54, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x7E, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x40, 0x3F, 0xFF, 0xC0, 0x1F, 0xAA, 0xA0, 0x0B, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xBC,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0,
-    0x01, 0xFE, 0xA4, 0x00, 0x03, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x03, 0xFA, 0xBF, 0xD0,
-    0x0B, 0xC0, 0x03, 0xE0, 0x07, 0xF0, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x0F, 0x80, 0x07, 0xC0,
-    0x01, 0xF4, 0x0F, 0x40, 0x0B, 0xC0, 0x01, 0xF4, 0x1F, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x2F, 0x00,
-    0x0F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x1F, 0x40, 0x0F, 0xD0, 0x3E, 0x00, 0x1F, 0x41, 0xBF, 0x80,
-    0x3D, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x7C, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x10, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x60,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x29, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x0F, 0x80, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0xFF, 0xE0, 0x00, 0xF4, 0x2F,
-    0xFF, 0xFC, 0x01, 0xF0, 0x2F, 0x51, 0xBF, 0x02, 0xF0, 0x3E, 0x00, 0x2F, 0x03, 0xE0, 0x3E, 0x00,
-    0x1F, 0x43, 0xE0, 0x3E, 0x00, 0x1F, 0x03, 0xD0, 0x3E, 0x00, 0x3F, 0x07, 0xC0, 0x2F, 0x40, 0xBE,
-    0x0B, 0xC0, 0x0F, 0xFF, 0xFC, 0x0F, 0x80, 0x03, 0xFF, 0xE0, 0x0F, 0x40, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFA, 0xAA, 0x90, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xBE, 0x55, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x5B, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x90, 0x03, 0xFF, 0xFC, 0x00, 0x7E, 0xAA, 0x80, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xBE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xF0,
-    0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00,
-    0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x00, 0x2F, 0x03, 0xD0, 0x00, 0x00, 0x7D, 0x02, 0xF0,
-    0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xBD, 0x40,
-    0x1F, 0x40, 0x00, 0x7F, 0xC0, 0x3E, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x68, 0x00, 0x0A, 0x40, 0x0F, 0x40, 0x0F,
-    0xC0, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x0F, 0x87, 0xD0, 0x00, 0x01, 0xF7,
-    0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x00, 0xF8, 0x0F, 0x40, 0x00,
-    0xFC, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0xC0, 0xBD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x9F, 0xC0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x00, 0xF8,
-    0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00,
-    0x02, 0xF0, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xEB, 0x80, 0x00, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x00, 0x2F, 0x03, 0xD0,
-    0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x68, 0x00, 0x0A, 0x40, 0x0F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7C, 0x0B, 0xD0,
-    0x00, 0x0F, 0x87, 0xD0, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00, 0x01, 0xF4,
-    0xBC, 0x00, 0x00, 0xF8, 0x0F, 0x40, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0xBD,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x6A, 0xB8, 0xBA, 0xB8, 0xA0, 0xE0, 0xA1,
-    0x80, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0B, 0x00, 0x2E, 0xA9, 0x2E, 0xAE, 0x0B,
-    0x0A, 0x02, 0x4A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x3F, 0xFF, 0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x3F, 0xFF,
-    0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x1A, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x81, 0x55, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x2D, 0x00, 0xFB, 0x40, 0x3E, 0xD0, 0x0F,
-    0xB4, 0x03, 0xED, 0x00, 0xFB, 0x40, 0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xED, 0x00, 0xFB, 0x40, 0x3E,
-    0xD0, 0x0F, 0xB4, 0x03, 0xED, 0x00, 0xFB, 0x40, 0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xED, 0x00, 0xFB,
-    0x40, 0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xED, 0x00, 0xFB, 0x40, 0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xED,
-    0x00, 0xFB, 0x40, 0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xED, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xE2, 0xAA, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x2F, 0xFF, 0xFF,
-    0xC5, 0x55, 0x55, 0x50, 0x00, 0xB4, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0xBD, 0x03, 0xF0,
-    0x05, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x3E, 0x02, 0xF0, 0x0F, 0x40, 0x7C, 0x03, 0xC0, 0x05, 0x00,
-    0x00, 0x50, 0x0F, 0xC0, 0x7E, 0x02, 0xF0, 0x0F, 0x40, 0x7C, 0x03, 0xD0, 0x0E, 0x00, 0xBC, 0xBC,
-    0xBC, 0x7C, 0x3C, 0x3C, 0x3C, 0x04, 0x00, 0xB4, 0x0E, 0x01, 0xF0, 0x3D, 0x03, 0xE0, 0x7C, 0x07,
-    0xC0, 0xF4, 0x0F, 0x82, 0xF0, 0x2F, 0x43, 0xE0, 0x3F, 0x0B, 0xD0, 0x14, 0x05, 0x40, 0x01, 0xF4,
-    0x3E, 0x03, 0xF0, 0xBD, 0x03, 0xE0, 0xFC, 0x0B, 0xC1, 0xF4, 0x0F, 0x42, 0xF0, 0x1F, 0x03, 0xC0,
-    0x3C, 0x0B, 0x80, 0x14, 0x05, 0x00, 0x00, 0x50, 0x15, 0x03, 0xF0, 0xBD, 0x07, 0xE0, 0xFC, 0x0B,
-    0xC1, 0xF4, 0x0F, 0x42, 0xF0, 0x1F, 0x03, 0xD0, 0x3D, 0x0B, 0x80, 0x38, 0x0B, 0x00, 0xB8, 0x2E,
-    0x3F, 0x0B, 0xCB, 0xC2, 0xF1, 0xF0, 0x7C, 0x3C, 0x0F, 0x0F, 0x03, 0xC3, 0xC0, 0xF0, 0x10, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xE0,
-    0x06, 0x57, 0x96, 0xAF, 0xFF, 0xFE, 0xBA, 0xFA, 0xB4, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x74,
-    0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D,
-    0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0x02,
-    0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x05, 0x43, 0x81, 0x40, 0x2F, 0xFF, 0xFF, 0x00,
-    0xFE, 0xFB, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F,
-    0xFD, 0x3F, 0xFC, 0x2F, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x0F, 0x80, 0x00, 0xFF,
-    0x40, 0x0F, 0xFE, 0x01, 0xFF, 0xFC, 0x2F, 0xFE, 0x03, 0xFD, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0xBE, 0xFE, 0xFD, 0x10, 0x05, 0x00, 0x14, 0x3F, 0x00, 0xBE, 0x7F, 0x00, 0xFE, 0x7F, 0x00,
-    0xFC, 0x14, 0x00, 0x10, 0x05, 0x00, 0x14, 0x00, 0x24, 0x3F, 0x00, 0xBE, 0x00, 0xFC, 0x7F, 0x00,
-    0xFE, 0x01, 0xFC, 0x7F, 0x00, 0xFD, 0x01, 0xFC, 0x14, 0x00, 0x10, 0x00, 0x50, 0x05, 0x0B, 0xE3,
-    0xF8, 0xFC, 0x04, 0x00, 0x6A, 0xA8, 0xBA, 0xA8, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0x2A, 0xA9, 0x2A, 0xAE, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x7F, 0xFD,
-    0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00,
-    0x7F, 0xFD, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x7F, 0xFD, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x2E, 0x03, 0xD0, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x3D, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C,
-    0x03, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3C, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x07,
-    0xC2, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0xB4, 0x7C, 0x6E, 0x40, 0x06, 0xE0, 0xB8, 0x0F, 0x0F,
-    0x1F, 0xFD, 0x03, 0xFF, 0xC7, 0xC3, 0xE3, 0xD7, 0xD2, 0xF0, 0xBC, 0x7D, 0x3F, 0xFC, 0xB8, 0xF4,
-    0x0F, 0x1F, 0x02, 0xE0, 0xFE, 0x1F, 0x0F, 0x00, 0xF2, 0xE0, 0x2E, 0x00, 0x03, 0xC2, 0xE0, 0x0F,
-    0x3C, 0x02, 0xD0, 0x00, 0xF4, 0x2D, 0x01, 0xF3, 0xC0, 0x3D, 0x00, 0x2E, 0x03, 0xD0, 0x2E, 0x7C,
-    0x03, 0xC0, 0x07, 0xC0, 0x3C, 0x03, 0xD7, 0x80, 0x7C, 0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x78, 0x0B,
-    0x40, 0x3D, 0x00, 0x3D, 0x0F, 0x47, 0xC1, 0xF0, 0x0B, 0x80, 0x01, 0xFB, 0xF0, 0x3F, 0xBD, 0x01,
-    0xF0, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x43, 0xC0,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xD0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xC0, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x07, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x0B, 0x47, 0xC6, 0xE4, 0x00, 0x6E,
-    0x00, 0x0B, 0x90, 0xB8, 0x0F, 0x0F, 0x1F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x7C, 0x3E, 0x3D,
-    0x7D, 0x2F, 0x0B, 0xC7, 0xD0, 0xF4, 0xBC, 0x3F, 0xFC, 0xB8, 0xF4, 0x0F, 0x1F, 0x02, 0xE3, 0xE0,
-    0x3C, 0x0F, 0xE1, 0xF0, 0xF0, 0x0F, 0x2E, 0x02, 0xE3, 0xC0, 0x3C, 0x00, 0x03, 0xC2, 0xE0, 0x0F,
-    0x3C, 0x02, 0xD7, 0x80, 0x3C, 0x00, 0x0F, 0x42, 0xD0, 0x1F, 0x3C, 0x03, 0xDB, 0x80, 0x7C, 0x00,
-    0x2E, 0x03, 0xD0, 0x2E, 0x7C, 0x03, 0xCF, 0x40, 0x78, 0x00, 0x7C, 0x03, 0xC0, 0x3D, 0x78, 0x07,
-    0xCF, 0x40, 0xB4, 0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x78, 0x0B, 0x4F, 0x40, 0xF0, 0x03, 0xD0, 0x03,
-    0xD0, 0xF4, 0x7C, 0x1F, 0x0B, 0x42, 0xE0, 0x0B, 0x80, 0x01, 0xFB, 0xF0, 0x3F, 0xBD, 0x07, 0xEF,
-    0xC0, 0x1F, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xD0, 0x07, 0x80, 0x0F,
-    0x00, 0x1D, 0x00, 0x28, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x0F, 0x80, 0x1F, 0x0B, 0xC0, 0x0F,
-    0x43, 0xD0, 0x07, 0x82, 0xE0, 0x03, 0xC0, 0xF0, 0x01, 0xD0, 0x74, 0x00, 0xA0, 0x28, 0x00, 0x00,
-    0x7C, 0x1F, 0x0B, 0xC0, 0x0F, 0x83, 0xE0, 0xF4, 0x01, 0xF0, 0xBC, 0x2F, 0x00, 0x3D, 0x0F, 0x43,
-    0xC0, 0x07, 0x82, 0xE0, 0xB8, 0x00, 0xF0, 0x3C, 0x0F, 0x00, 0x1D, 0x07, 0x42, 0xD0, 0x02, 0x80,
-    0xA0, 0x28, 0x00, 0x3D, 0x0F, 0x81, 0xF0, 0x3C, 0x0F, 0x02, 0xD0, 0x38, 0x0A, 0x3D, 0x1F, 0x03,
-    0xE1, 0xF0, 0x1F, 0x0F, 0x40, 0xF0, 0xB8, 0x0F, 0x07, 0x80, 0xB4, 0x3C, 0x03, 0x82, 0xC0, 0x28,
-    0x18, 0x3D, 0x1F, 0x0F, 0x43, 0xE1, 0xF0, 0xF8, 0x1F, 0x0F, 0x47, 0xC0, 0xF0, 0xB8, 0x3C, 0x0F,
-    0x07, 0x83, 0xC0, 0xB4, 0x3C, 0x2D, 0x03, 0x82, 0xC1, 0xE0, 0x28, 0x18, 0x09, 0x00, 0x01, 0x00,
-    0x00, 0x2D, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xB0, 0x00, 0xB0, 0xD0, 0x07, 0x43, 0x80, 0x3C, 0x0B,
-    0x03, 0xC0, 0x1C, 0x2D, 0x00, 0x34, 0xE0, 0x00, 0xF0, 0x00, 0x10, 0x00, 0x7C, 0x01, 0xF0, 0x07,
-    0xD0, 0x1F, 0x40, 0x7E, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x03,
-    0xC0, 0x00, 0x00, 0x02, 0x00, 0x0B, 0x80, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00,
-    0xBC, 0x01, 0xF8, 0x07, 0xD0, 0x1F, 0x40, 0x3D, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0xF4, 0x00, 0x04, 0x3D, 0x00, 0x1F, 0x80, 0x03, 0xD1, 0xF4, 0x01,
-    0xF4, 0x00, 0xF8, 0x07, 0xD0, 0x01, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x7D,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x00,
-    0x1F, 0x4F, 0x80, 0x00, 0x3D, 0x00, 0x7F, 0xE0, 0x03, 0xEB, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x7D,
-    0x00, 0x3F, 0xD0, 0x03, 0xF1, 0x40, 0x0F, 0x9F, 0x40, 0x04, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00,
-    0x00, 0xF8, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40,
-    0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF4, 0x3E, 0x00, 0x1F, 0x80, 0x07,
-    0xC1, 0x80, 0x01, 0xF8, 0x00, 0x18, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xF8,
-    0x01, 0xF8, 0x0B, 0xD0, 0x0B, 0xD0, 0x2F, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0xFC, 0x03, 0xE0, 0x03,
-    0xE0, 0x0F, 0x80, 0x0F, 0x40, 0x7D, 0x00, 0x7C, 0x02, 0xF0, 0x02, 0xF0, 0x0F, 0xC0, 0x0F, 0x80,
-    0x3E, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0xF0, 0x07, 0xC0, 0x07, 0xC0, 0x1F, 0x00, 0x1E, 0x00, 0xB8,
-    0x00, 0xB4, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x80, 0x03,
-    0xF0, 0x1F, 0xC0, 0x1F, 0xC0, 0xBF, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xC0, 0x3F, 0xFF, 0xF4, 0x2E, 0xF9, 0xFC, 0x01, 0xF4, 0xBC, 0x02, 0xF0,
-    0x7C, 0x02, 0xF0, 0x7C, 0x03, 0xE0, 0xFC, 0x03, 0xD1, 0xF4, 0x03, 0xCB, 0xE0, 0x07, 0xEF, 0x80,
-    0x0B, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x34, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0xF0, 0x0F, 0x00,
-    0x07, 0xC0, 0x07, 0xEA, 0xBE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x01, 0xF9, 0x5B, 0xC0, 0x07, 0x80, 0x00, 0xF0, 0x1D, 0x00, 0x00, 0x34, 0x34, 0x00,
-    0x00, 0x2C, 0x60, 0x00, 0x00, 0x18, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x1D, 0xB0, 0x00, 0x03, 0x8B, 0x00, 0x00, 0xB0, 0x70, 0x00, 0x0E, 0x07,
-    0x40, 0x03, 0xC0, 0x38, 0x00, 0x74, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD2, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x56, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB9, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x3C, 0x02, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x10, 0x0B, 0x40, 0x00, 0x04, 0x00, 0xF0, 0x01, 0xF4, 0x2C, 0x00,
-    0x00, 0x3E, 0x07, 0x40, 0x0B, 0xFD, 0xF0, 0x00, 0x01, 0xFF, 0xAC, 0x00, 0x01, 0xBF, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0xFC, 0x03, 0xED, 0x00, 0x00,
-    0x00, 0xBB, 0x80, 0x00, 0x7D, 0x3C, 0x00, 0x00, 0x0F, 0x8F, 0x00, 0x07, 0xE0, 0xF0, 0x00, 0x00,
-    0xFC, 0x2E, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x20, 0x07, 0xC0, 0x00, 0x05,
-    0x00, 0xF8, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x3F, 0xFE, 0x3F, 0xFD, 0x15,
-    0x54, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0x54, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4,
-    0x00, 0x01, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00,
-    0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x1F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x54, 0x00, 0x3F, 0xF8, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x05, 0x7D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00,
-    0x03, 0xE0, 0x01, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
-    0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x3C, 0x00, 0x15, 0xBC, 0x00, 0x3F, 0xF8, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFC, 0x2E, 0x42,
-    0xFC, 0x0F, 0x41, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFE,
-    0x00, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x0B, 0xD3,
-    0xFF, 0xFF, 0x40, 0x3F, 0x0B, 0x90, 0xBF, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x1F, 0x40, 0x00, 0x07, 0xC0, 0x7D, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x01, 0xF4, 0x0F,
-    0xC0, 0x00, 0x2F, 0x80, 0x3E, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x00, 0x3F, 0x80, 0x07, 0xC0, 0x03,
-    0xF4, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x05, 0x00,
-    0x1F, 0xC0, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x01, 0x40,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0xFE, 0x00, 0x07,
-    0xE0, 0x7F, 0xFF, 0xF0, 0x02, 0xF4, 0x0F, 0x40, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x01, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0x40,
-    0x00, 0x7F, 0x00, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x78, 0x00,
-    0x1F, 0x00, 0x00, 0x2D, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x0F,
-    0xD0, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x01, 0x40, 0x00, 0x10, 0x00, 0x00, 0x2A, 0xAA, 0xAA,
-    0xA8, 0xFF, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0x5F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x3C, 0x1F, 0xFF, 0xF4, 0xF0, 0x7F, 0xFF, 0xF3, 0xC1, 0xFF, 0xFF, 0xCF,
-    0x07, 0xFF, 0xFF, 0x7C, 0x1F, 0xFF, 0xFD, 0xF0, 0x7F, 0xFF, 0xF7, 0xC1, 0xFF, 0xFF, 0xDF, 0x07,
-    0xFF, 0xFF, 0x7C, 0x1F, 0xFF, 0xFC, 0xF0, 0x7F, 0xFF, 0xE3, 0xC1, 0xFF, 0xFF, 0x0F, 0x07, 0xFF,
-    0xE0, 0x3C, 0x1D, 0x10, 0x00, 0xF0, 0x74, 0x00, 0x03, 0xC1, 0xD0, 0x00, 0x0F, 0x07, 0x40, 0x00,
-    0x3C, 0x1D, 0x00, 0x00, 0xF0, 0x74, 0x00, 0x03, 0xC1, 0xD0, 0x00, 0x0F, 0x07, 0x40, 0x00, 0x3C,
-    0x1D, 0x00, 0x00, 0xF0, 0x74, 0x00, 0x03, 0xC1, 0xD0, 0x00, 0x0A, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x6A, 0xAA, 0xA8, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xF9, 0x7C, 0x2F, 0xFF, 0xF4, 0x2C, 0x3F,
-    0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F,
-    0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x1F,
-    0xFF, 0xF4, 0x2C, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x6A, 0xAA, 0xA4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x79, 0x7F, 0xFF, 0xE0, 0x74, 0x3F, 0xFF, 0xF4, 0x74, 0x3F, 0xFF, 0xF8, 0x74,
-    0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74,
-    0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xF4, 0x74, 0x3F, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x2D, 0x03, 0xC0, 0x00, 0xFF, 0x4E, 0x00, 0x00, 0xBF, 0xF9,
-    0x5A, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xC5, 0xA0, 0x03, 0xDB, 0x40, 0x00, 0x3E, 0x1E, 0x00,
-    0x03, 0xF0, 0x3C, 0x00, 0x07, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0xFD, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x02,
-    0xE0, 0x0B, 0x80, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x01, 0xF9, 0x5B, 0xC0, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x00, 0x34,
-    0x00, 0x00, 0x2C, 0x00, 0x60, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x34, 0x00, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xEA, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x01, 0xD0, 0x2C, 0x00, 0x00, 0xFF, 0x4F, 0x00, 0x00, 0x07, 0xFF, 0x95, 0xA4, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x02, 0xFC, 0x5A, 0x00, 0x03, 0xE7, 0x40, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x03,
-    0xF0, 0x3D, 0x00, 0x00, 0x34, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x01, 0xD0, 0x2C, 0x00, 0x00, 0xFF, 0x4F, 0x00, 0x00, 0x07, 0xFF, 0x95, 0xA4, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x02, 0xFC, 0x5A, 0x00, 0x03, 0xE7, 0x40, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x03, 0xF0,
-    0x3D, 0x00, 0x00, 0x34, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x02, 0xDB, 0xE0, 0x0F, 0x2F, 0x40, 0xB8, 0x14, 0x03, 0xD0, 0x00, 0x1F,
-    0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2E,
-    0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3C,
-    0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x7D, 0x3C, 0x02, 0xFA, 0xE0, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xA4, 0x00, 0x00, 0x00, 0xD0, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x2C, 0x1F, 0x40, 0x6F,
-    0xFF, 0xA4, 0x1F, 0x83, 0xC0, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0x24, 0x00, 0x00, 0x00, 0x6A, 0xA0,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x01, 0xF9, 0x07, 0xE0, 0x0B, 0x80, 0x00,
-    0xB0, 0x1D, 0x00, 0x00, 0x38, 0x34, 0x00, 0x00, 0x1C, 0x20, 0x00, 0x00, 0x08, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x03, 0x42, 0xC0, 0xE0, 0x03, 0xD2, 0xC3, 0xE0, 0x00, 0xF6, 0xCF,
-    0x80, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x2A, 0xAF, 0xFE,
-    0xA9, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFA, 0xDF, 0x40, 0x03, 0xE2, 0xC7, 0xD0, 0x07, 0x82, 0xC1,
-    0xF0, 0x01, 0x02, 0xC0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x7C, 0x1F, 0x0B, 0xC2, 0xF0, 0x03, 0xE0,
-    0xF8, 0x3D, 0x0F, 0x40, 0x1F, 0x0B, 0xC2, 0xE0, 0xB8, 0x00, 0xF4, 0x3D, 0x0F, 0x03, 0xC0, 0x07,
-    0x82, 0xE0, 0xB4, 0x2D, 0x00, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x01, 0xD0, 0x74, 0x2C, 0x0B, 0x00,
-    0x0A, 0x02, 0x80, 0x90, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x0B, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0x40, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D,
-    0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0xBC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x14, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x3E, 0x7F, 0x7E, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3E, 0x7F, 0x3E, 0x04, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x01, 0x47, 0xF0, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0xFE, 0x3E, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x02,
-    0xE0, 0x0F, 0x40, 0x0B, 0xE0, 0x2E, 0x02, 0xFC, 0x00, 0xBE, 0x02, 0xE0, 0x1F, 0x80, 0x02, 0x80,
-    0x2E, 0x00, 0xA0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x6A, 0xAA, 0xBF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA,
-    0xAA, 0xBF, 0xAA, 0xAA, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x2E, 0x00, 0x50, 0x00, 0x7E, 0x02, 0xE0, 0x2F, 0x40,
-    0x0B, 0xE0, 0x2E, 0x03, 0xF8, 0x00, 0x3D, 0x02, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0xBD, 0xFE, 0xBE,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFE, 0xFE, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 0xBE, 0xFE,
-    0xBD, 0x14, 0x00, 0x0F, 0xC7, 0xF1, 0xFC, 0x2D, 0x00, 0x00, 0x40, 0xFC, 0x7F, 0x0F, 0xC1, 0x90,
-    0x00, 0x04, 0x0F, 0xC7, 0xF4, 0xFC, 0x18, 0x00, 0x01, 0x90, 0xFC, 0x7F, 0x4F, 0xC0, 0x40, 0x00,
-    0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x7F, 0xFD, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x07, 0xD0, 0x03, 0xC0, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x2F,
-    0xF8, 0x3F, 0xFC, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x38, 0x2C, 0x38,
-    0x2C, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0xBF, 0x40, 0x3F, 0xFC,
-    0x0B, 0xC2, 0xE0, 0xF0, 0x0F, 0x1E, 0x00, 0xF2, 0xD0, 0x0F, 0x3C, 0x01, 0xE3, 0xC0, 0x2D, 0x3C,
-    0x03, 0xC3, 0xC0, 0x3C, 0x3D, 0x0F, 0x41, 0xFB, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x24, 0x00, 0x07, 0x03, 0xC0, 0xE0, 0x34, 0x1C, 0x0B, 0x03, 0xC0, 0xE0, 0x74, 0x18, 0x00,
-    0x00, 0x02, 0x90, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x07, 0xBC, 0x00, 0xF7, 0x80, 0x3C, 0xB4, 0x0F,
-    0x0F, 0x02, 0xD0, 0xF0, 0x7E, 0xBF, 0x9B, 0xFF, 0xFD, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x38,
-    0x00, 0x00, 0xAA, 0xA0, 0x2F, 0xFE, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0xFF, 0xD0,
-    0x0B, 0xBF, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x0B, 0x43, 0xEB, 0xF0, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x3F, 0xFC, 0x0F, 0x80, 0x02, 0xD0, 0x00, 0x3C, 0x00,
-    0x07, 0xAF, 0xC0, 0xBE, 0x6F, 0x0F, 0x80, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xB4, 0x1E, 0x07,
-    0xEF, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x92, 0xFF, 0xFD, 0x00, 0x07, 0xC0, 0x00,
-    0xF0, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x00, 0xB8, 0x00,
-    0x1F, 0x00, 0x03, 0xD0, 0x00, 0x78, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x3F, 0xFD, 0x0B, 0x81, 0xE0,
-    0xF0, 0x1E, 0x0B, 0x82, 0xD0, 0x3E, 0xF4, 0x03, 0xFD, 0x01, 0xF5, 0xF0, 0x3C, 0x07, 0x87, 0x80,
-    0x3C, 0x78, 0x0B, 0x83, 0xFA, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0xFC,
-    0x0F, 0x82, 0xD0, 0xF0, 0x1E, 0x1E, 0x01, 0xE1, 0xE0, 0x2E, 0x0F, 0x5B, 0xD0, 0xBF, 0xFD, 0x00,
-    0x53, 0xC0, 0x00, 0xB4, 0x00, 0x2F, 0x03, 0xAF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x02, 0xC0, 0x02, 0xC0, 0x57, 0xD5, 0xFF, 0xFF, 0x03, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x01, 0x40,
-    0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00, 0xBF, 0xFE,
-    0xBF, 0xFE, 0x00, 0x00, 0x02, 0xD0, 0x2E, 0x01, 0xF0, 0x0F, 0x00, 0x78, 0x03, 0xD0, 0x0F, 0x00,
-    0x78, 0x01, 0xE0, 0x0B, 0x40, 0x2D, 0x00, 0x74, 0x01, 0xE0, 0x03, 0xC0, 0x0B, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x0F, 0x00, 0x3C, 0x00, 0xB4, 0x02, 0xD0, 0x0B, 0x40, 0x2D, 0x00, 0xB0,
-    0x03, 0xC0, 0x1F, 0x00, 0xB4, 0x03, 0xC0, 0x2D, 0x01, 0xE0, 0x0F, 0x00, 0x50, 0x00, 0x09, 0x2F,
-    0x80, 0xEE, 0x7D, 0x1F, 0x41, 0xE2, 0xE0, 0x1D, 0x3C, 0x02, 0xC3, 0x80, 0x3C, 0x78, 0x03, 0x87,
-    0x40, 0x74, 0xB0, 0x0B, 0x0A, 0x00, 0x60, 0x00, 0xBE, 0x00, 0x7F, 0xFC, 0x0F, 0x43, 0xC1, 0xE0,
-    0x2D, 0x3D, 0x02, 0xD3, 0xC0, 0x2D, 0x7C, 0x03, 0xD7, 0x80, 0x3C, 0x78, 0x03, 0xC7, 0x80, 0xB8,
-    0x3C, 0x1F, 0x03, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xE0, 0xFF, 0x4F,
-    0x6D, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0xB4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xE0, 0x0B,
-    0x40, 0x00, 0x7F, 0x80, 0x0F, 0xFF, 0x80, 0x24, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
-    0x0B, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F,
-    0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x0F, 0xFF, 0x80, 0x10, 0x0F, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xF0, 0x01, 0x6F, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
-    0x41, 0x00, 0x7C, 0x0F, 0xAB, 0xD0, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00,
-    0xFC, 0x00, 0x2F, 0xC0, 0x07, 0xB8, 0x01, 0xEB, 0x40, 0x38, 0xF0, 0x0F, 0x0F, 0x03, 0xC1, 0xE0,
-    0xBE, 0xBF, 0x8F, 0xFF, 0xFC, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x02, 0xAA, 0x80,
-    0x3F, 0xFC, 0x07, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xFF, 0x80, 0x1E, 0xBF, 0x00, 0x00,
-    0xF0, 0x00, 0x0B, 0x40, 0x00, 0xB0, 0x40, 0x1F, 0x0F, 0xAF, 0xD0, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xD0, 0x1F, 0xFD, 0x07, 0xD0, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xDF, 0xE0, 0x3F,
-    0x9F, 0x83, 0xC0, 0x3C, 0x7C, 0x03, 0xC3, 0x80, 0x78, 0x3C, 0x0F, 0x42, 0xFB, 0xE0, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0xA0, 0x3F, 0xFF, 0xC0, 0x00, 0x2D, 0x00, 0x01, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8,
-    0x00, 0x07, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0xFC, 0x0F, 0x42, 0xD0, 0xF0,
-    0x2D, 0x0F, 0x03, 0xC0, 0x7E, 0xF0, 0x07, 0xFC, 0x02, 0xF6, 0xF0, 0x78, 0x0B, 0x4B, 0x40, 0xB8,
-    0xB4, 0x0F, 0x47, 0xEB, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xB9, 0x00, 0x7F, 0xF8, 0x0F,
-    0x03, 0xC2, 0xD0, 0x2D, 0x3C, 0x02, 0xD3, 0xC0, 0x3C, 0x2F, 0x5F, 0xC0, 0xFF, 0xBC, 0x01, 0x47,
-    0x80, 0x00, 0xF0, 0x00, 0x3D, 0x0A, 0xBF, 0x80, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00,
-    0x34, 0x00, 0x0D, 0x00, 0x57, 0x95, 0x3F, 0xFF, 0x80, 0x38, 0x00, 0x0D, 0x00, 0x03, 0x40, 0x00,
-    0x40, 0x00, 0x15, 0x55, 0x4F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE1, 0x55, 0x54,
-    0x00, 0x00, 0x3F, 0xFF, 0x8F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x02, 0xD0, 0x0F, 0x00,
-    0xB4, 0x03, 0xC0, 0x1E, 0x00, 0xB4, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x02, 0xC0, 0x07,
-    0x40, 0x0F, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xB4, 0x00, 0xF0, 0x01, 0xE0, 0x03,
-    0xC0, 0x0B, 0x40, 0x1E, 0x00, 0x14, 0x00, 0x01, 0xA8, 0x60, 0xBE, 0xEE, 0x1E, 0x03, 0xD3, 0xC0,
-    0x2C, 0x74, 0x02, 0xCB, 0x00, 0x38, 0xB0, 0x07, 0x8B, 0x00, 0xF4, 0x3D, 0x7B, 0x01, 0xF8, 0x60,
-    0x01, 0xB9, 0x02, 0xEB, 0xC1, 0xD0, 0x74, 0xF0, 0x2C, 0x7A, 0xBD, 0x2F, 0xA4, 0x0B, 0x00, 0x01,
-    0xD0, 0x00, 0x3D, 0x5C, 0x02, 0xFE, 0x00, 0x01, 0xA8, 0x00, 0xBE, 0xF4, 0x1D, 0x03, 0xC3, 0x80,
-    0x1C, 0x74, 0x01, 0xCB, 0x00, 0x2C, 0xB0, 0x03, 0xC7, 0x40, 0xB4, 0x3D, 0x6E, 0x00, 0xBF, 0x40,
-    0x02, 0x40, 0x28, 0x02, 0xC0, 0xB0, 0x00, 0xE2, 0xD0, 0x00, 0xBB, 0x40, 0x00, 0x3D, 0x00, 0x00,
-    0x7C, 0x00, 0x01, 0xEE, 0x00, 0x03, 0x8B, 0x00, 0x0F, 0x03, 0x80, 0x2C, 0x01, 0xC0, 0x02, 0xB8,
-    0x03, 0xAB, 0xC0, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x5B, 0xC2, 0xFF, 0xE2, 0xD0, 0x74, 0xE0, 0x3C,
-    0x3D, 0x7C, 0x03, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x38, 0x00, 0x03, 0x40, 0x00, 0x70, 0x00, 0x0B,
-    0x1A, 0x40, 0xEB, 0xBD, 0x0F, 0x40, 0xE1, 0xE0, 0x0D, 0x2C, 0x01, 0xD3, 0xC0, 0x2C, 0x38, 0x03,
-    0xC7, 0x40, 0x38, 0xB0, 0x07, 0x4A, 0x00, 0x70, 0x01, 0x40, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00,
-    0x70, 0x00, 0x0B, 0x01, 0x80, 0xE0, 0xB4, 0x0E, 0x2D, 0x01, 0xDB, 0x40, 0x2E, 0xD0, 0x03, 0xEF,
-    0x00, 0x38, 0x74, 0x07, 0x43, 0xC0, 0xB0, 0x2D, 0x0A, 0x00, 0xE0, 0x01, 0x40, 0xE0, 0x34, 0x1C,
-    0x0B, 0x03, 0xC0, 0xE0, 0x74, 0x2C, 0x0F, 0x03, 0x81, 0xD0, 0x70, 0x2C, 0x00, 0x05, 0x1A, 0x02,
-    0xA0, 0x0E, 0xBB, 0xCE, 0xBC, 0x0F, 0x41, 0xF4, 0x2C, 0x1E, 0x01, 0xE0, 0x2C, 0x2C, 0x02, 0xC0,
-    0x3C, 0x3C, 0x03, 0xC0, 0x38, 0x38, 0x03, 0x80, 0x34, 0x74, 0x07, 0x40, 0x70, 0x70, 0x0B, 0x00,
-    0xB0, 0xB0, 0x0A, 0x00, 0xA0, 0x02, 0x4B, 0x90, 0x0E, 0xFB, 0xC0, 0x7D, 0x07, 0x42, 0xE0, 0x1D,
-    0x0F, 0x00, 0xB0, 0x38, 0x03, 0xC1, 0xD0, 0x0E, 0x0B, 0x40, 0x74, 0x3C, 0x02, 0xC0, 0xE0, 0x0B,
-    0x00, 0x02, 0x46, 0x80, 0x0D, 0xEB, 0xC0, 0x7D, 0x07, 0x42, 0xE0, 0x0E, 0x0F, 0x00, 0x74, 0x38,
-    0x01, 0xD0, 0xE0, 0x0F, 0x07, 0x80, 0x78, 0x2F, 0x9B, 0xC0, 0xE3, 0xF8, 0x03, 0x80, 0x00, 0x1D,
-    0x00, 0x00, 0xB0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0xA9, 0x0F, 0xAE, 0x2C, 0x00, 0x1D, 0x00,
-    0x0F, 0x80, 0x01, 0xF4, 0x00, 0x3C, 0x00, 0x3C, 0xA5, 0xB8, 0x7F, 0xD0, 0x02, 0x00, 0x1C, 0x02,
-    0xFA, 0x1B, 0xE8, 0x1D, 0x00, 0xB0, 0x03, 0xC0, 0x0E, 0x00, 0x34, 0x01, 0xD0, 0x07, 0x94, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xF4, 0x01, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0xAA, 0xA8, 0xFC,
-    0x03, 0xFF, 0xF7, 0xE0, 0x1F, 0x55, 0x4F, 0x80, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0xBD, 0x0F,
-    0x40, 0x00, 0xFE, 0xBE, 0xA9, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xD5, 0x40, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x01, 0xD1,
-    0xD0, 0x00, 0x01, 0xFE, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x7F, 0xC0, 0x0F, 0xEF,
-    0x0F, 0x00, 0x0F, 0xC7, 0x47, 0x40, 0x0B, 0xD3, 0xC3, 0xC0, 0x03, 0xE0, 0xE0, 0xE0, 0x02, 0xF0,
-    0xB0, 0xB4, 0x00, 0xFC, 0x3C, 0x3C, 0x00, 0x3E, 0x1D, 0x1D, 0x00, 0x0F, 0x4F, 0x0F, 0x00, 0x07,
-    0xD7, 0x83, 0x80, 0x01, 0xF6, 0xC2, 0xD0, 0x00, 0x3E, 0xF0, 0xF0, 0x00, 0x0F, 0xF4, 0x74, 0x00,
-    0x02, 0xFC, 0x3C, 0x00, 0x00, 0x3F, 0x9E, 0x19, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x03, 0xEF, 0xFF,
-    0x80, 0x01, 0xD1, 0xE0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x6D, 0x00,
-    0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x00, 0x92, 0xF4, 0x3F, 0x02, 0xDF, 0xF4, 0x3E, 0x02, 0xFE, 0x50, 0x3E,
-    0x03, 0xF4, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x3E,
-    0x0F, 0x80, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x1F, 0x8F, 0x00, 0x00, 0x0F, 0xFF, 0x06, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFD, 0x55, 0x54, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xAF, 0xEA, 0x80, 0x00, 0x7F,
-    0xFF, 0xE0, 0x00, 0x05, 0xF9, 0x50, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x0F, 0xD0, 0x2C, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1A, 0xFE,
-    0xAA, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x16, 0xF5, 0x54, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x17, 0xF5, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x6B, 0xEA, 0xA4, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xBD, 0x55, 0x55, 0x40, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0xA0, 0x2F, 0x81, 0xFB, 0xE0, 0x00, 0xF1, 0xFF, 0xF3, 0xFF, 0xFC, 0x01, 0xF7, 0xD6, 0xFF,
-    0xF5, 0xBE, 0x02, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0x02, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x3D,
-    0x0B, 0xC0, 0x07, 0xF0, 0x00, 0x7C, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x2F, 0xE0,
-    0x00, 0xF8, 0x0F, 0x40, 0x7F, 0xD0, 0x00, 0xF8, 0x1F, 0x00, 0xF7, 0xC0, 0x01, 0xF4, 0x2F, 0x02,
-    0xDB, 0xC0, 0x02, 0xF0, 0x3E, 0x07, 0xCF, 0xC0, 0x02, 0xF0, 0x3D, 0x0F, 0x0F, 0x80, 0x03, 0xE0,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0x00, 0x0F, 0xE0, 0x03,
-    0xC0, 0x03, 0xF8, 0x01, 0xF0, 0x01, 0xFF, 0x00, 0xB8, 0x00, 0xBB, 0xC0, 0x3D, 0x00, 0x3D, 0xF0,
-    0x0F, 0x00, 0x0F, 0x3C, 0x07, 0xC0, 0x2B, 0xEF, 0xAB, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0x81, 0xB9,
-    0xB9, 0x7D, 0x40, 0x3D, 0x1E, 0x0F, 0x00, 0x5F, 0x9B, 0xDB, 0xD4, 0x7F, 0xFF, 0xFF, 0xFF, 0x1B,
-    0xFA, 0xBE, 0xFA, 0x40, 0xB8, 0x0F, 0x3D, 0x00, 0x3D, 0x02, 0xDF, 0x00, 0x0F, 0x00, 0xBF, 0xC0,
-    0x07, 0xC0, 0x1F, 0xE0, 0x02, 0xF0, 0x07, 0xF4, 0x00, 0xB8, 0x00, 0xFD, 0x00, 0x3D, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xE6, 0xFE,
-    0x00, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x1F, 0x43, 0x80, 0x07, 0xC0, 0x07, 0xC2, 0xD0, 0x02, 0xF0, 0x03, 0xF1,
-    0xF4, 0x00, 0xFC, 0x03, 0xFB, 0xFF, 0xF0, 0x3E, 0x5B, 0xFA, 0xFF, 0xF8, 0x0F, 0xFF, 0xF4, 0x0F,
-    0x80, 0x07, 0xFF, 0x90, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0x03, 0xD0,
-    0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x3D, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x7E, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x2F, 0xE4, 0x00, 0xF4, 0x01, 0xF0, 0xFF, 0xFC,
-    0x01, 0xF0, 0x02, 0xF3, 0xF4, 0x68, 0x02, 0xF0, 0x07, 0xE3, 0xD0, 0x00, 0x03, 0xE0, 0x1F, 0xC3,
-    0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x03, 0xF4, 0x00, 0x07, 0xD6,
-    0xF0, 0x00, 0xFE, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x3F, 0x80, 0x0F, 0x80, 0xF8, 0x00, 0x0F, 0xD0,
-    0x0F, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x1F, 0x00, 0x7C, 0x00,
-    0x03, 0xE0, 0x2F, 0x00, 0x3D, 0x60, 0x0B, 0xD0, 0x3E, 0x00, 0x3E, 0x7F, 0xFF, 0xC0, 0x3D, 0x00,
-    0x3F, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0xD0, 0x07, 0xC0, 0x0F, 0x40,
-    0xF4, 0x03, 0xF0, 0x03, 0xC0, 0x3D, 0x01, 0xFC, 0x02, 0xE0, 0x0F, 0x00, 0xBF, 0x00, 0xF4, 0x03,
-    0xC0, 0x3F, 0xC0, 0x7C, 0x00, 0xF0, 0x1D, 0xF0, 0x2E, 0x00, 0x3C, 0x0F, 0x3C, 0x0F, 0x40, 0x0F,
-    0x03, 0x8F, 0x07, 0xC0, 0x07, 0xC2, 0xD3, 0xC2, 0xE0, 0x0A, 0xFA, 0xFA, 0xFA, 0xF9, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x6F, 0x7E, 0x6F, 0x7E, 0x40, 0x0B, 0x8F, 0x07, 0x8F, 0x00, 0x02, 0xE7,
-    0x81, 0xE7, 0x80, 0x00, 0xB6, 0xC0, 0x76, 0xD0, 0x00, 0x2D, 0xF0, 0x1D, 0xF0, 0x00, 0x0B, 0xB4,
-    0x07, 0xB8, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40,
-    0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x2E, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x7F, 0x40, 0x3C, 0x00, 0x7C, 0x00, 0x0F, 0x80,
-    0x7C, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0xF4, 0x19, 0x07, 0xC0, 0xF8, 0x00, 0xF4, 0x3E,
-    0x07, 0xC0, 0xF4, 0x01, 0xF0, 0x3D, 0x0B, 0x80, 0xF0, 0x02, 0xF0, 0x3C, 0x0F, 0x41, 0xF0, 0x02,
-    0xE0, 0x7C, 0x0F, 0x42, 0xE0, 0x03, 0xD0, 0xB8, 0x1F, 0x03, 0xE0, 0x03, 0xC0, 0xF8, 0x2F, 0x03,
-    0xD0, 0x07, 0xC0, 0xF4, 0x2E, 0x07, 0xC0, 0x0B, 0xC1, 0xF0, 0x3D, 0x0B, 0xC0, 0x0F, 0x81, 0xF0,
-    0x3C, 0x0B, 0x80, 0x0F, 0x42, 0xE0, 0x28, 0x0F, 0x40, 0x0F, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x1F,
-    0x03, 0xC0, 0x00, 0x3E, 0x00, 0x2E, 0x07, 0xC0, 0x02, 0xFC, 0x00, 0x3E, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3D, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0A, 0xAB, 0xFA, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x55, 0x7E, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xBE, 0x0B, 0xC0, 0x00, 0x3F, 0xFF,
-    0x2F, 0x00, 0x03, 0xF9, 0x1F, 0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xF8, 0x00, 0x3F, 0x00,
-    0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x07, 0xD0,
-    0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBE,
-    0x00, 0x07, 0xC0, 0x0B, 0xF4, 0x00, 0x0F, 0xC0, 0xBB, 0xD0, 0x00, 0x2F, 0xFF, 0x8F, 0x00, 0x00,
-    0x2F, 0xF4, 0x7C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x1A, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F, 0xD4, 0x7C, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x05, 0xBD, 0x55, 0x40, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0A, 0xFE, 0xAA, 0x40, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x1F, 0x80, 0x03, 0xE0,
-    0x01, 0xF8, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x1F, 0x80,
-    0x00, 0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0x00, 0xF5, 0xF8, 0x00, 0x00, 0x6F,
-    0xFF, 0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x05, 0xFF, 0x7F, 0x54, 0x00, 0x03, 0xF0, 0x7D,
-    0x00, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00,
-    0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xC0,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x55, 0x7F, 0x55, 0x50, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4,
-    0x70, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x60, 0x00, 0x3F, 0xFC, 0xBC, 0x00, 0x1E, 0x3F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x1E, 0x3F, 0x00, 0x00, 0x01, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x40, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x6A, 0x40, 0x03, 0xE0, 0x00,
-    0x3F, 0x02, 0xFF, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x0B, 0xE6, 0xFC, 0x07, 0xC0, 0x00, 0xBC, 0x0F,
-    0x40, 0x7C, 0x07, 0xC0, 0x01, 0xF8, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x07, 0xF0, 0x3E, 0x00, 0x7C,
-    0x0F, 0x80, 0x2F, 0xC0, 0x3D, 0x00, 0xBC, 0x0F, 0x96, 0xFF, 0x00, 0x7E, 0x02, 0xF4, 0x1F, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0xF4, 0x7C,
-    0x00, 0x00, 0x0B, 0x80, 0xF0, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x00,
-    0x03, 0xC0, 0xF4, 0x00, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xF6,
-    0xE0, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x0A, 0x03, 0xF0, 0x00, 0x00, 0x7C, 0x3F, 0xD0, 0x00, 0x03, 0xF2,
-    0xEB, 0x80, 0x00, 0x2F, 0xFF, 0x1F, 0x00, 0x01, 0xF3, 0xF0, 0x7C, 0x00, 0x0F, 0x0B, 0x40, 0xF0,
-    0x00, 0xF4, 0x18, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x0F, 0x95, 0xBF, 0x00, 0x07, 0xD0, 0x07, 0xC0, 0x2B, 0xFA, 0xAA, 0xFE, 0x4F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x3E, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x07, 0xC0, 0x6B, 0xEA, 0xAB, 0xF9, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFC, 0x00, 0xFC, 0x00, 0x3E, 0x01, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xDF, 0x5B, 0xC0, 0x2F, 0xD1, 0xE0, 0x00, 0x07, 0xF0, 0x1D, 0x00,
-    0x00, 0xFC, 0x02, 0xC0, 0x00, 0x1F, 0x80, 0x3C, 0x00, 0x03, 0xF0, 0x03, 0xC0, 0x00, 0x3E, 0x00,
-    0x78, 0x00, 0x07, 0xD0, 0x0B, 0x40, 0x00, 0xBC, 0x00, 0xFF, 0xFF, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0,
-    0xFC, 0x00, 0xF5, 0x7F, 0x0F, 0xC0, 0x1E, 0x03, 0xE0, 0xFC, 0x02, 0xD0, 0x7D, 0x0B, 0xC0, 0x3C,
-    0x07, 0xC0, 0x7E, 0x03, 0xC0, 0xBC, 0x03, 0xF4, 0x78, 0x0F, 0x80, 0x1F, 0xEB, 0x41, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0x2F, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xF8, 0x00, 0x1F,
-    0x40, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x0F, 0x80,
-    0x1F, 0x80, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0xF5, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x0A, 0xAA, 0xAA, 0xBF, 0x80, 0xFF, 0xFF, 0xFF, 0xFC, 0x05, 0x55, 0xFF, 0xE5,
-    0x00, 0x01, 0xBF, 0xF4, 0x00, 0x15, 0xFF, 0xF9, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xEA,
-    0xAA, 0xA9, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x6C, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0x9F, 0x5E, 0x00, 0xBF, 0x03, 0x80,
-    0x00, 0x7F, 0x01, 0xD0, 0x00, 0x3F, 0x00, 0xB0, 0x00, 0x1F, 0x40, 0x3C, 0x00, 0x0F, 0xC0, 0x0F,
-    0x00, 0x03, 0xE0, 0x07, 0x80, 0x01, 0xF4, 0x02, 0xD0, 0x00, 0xBC, 0x00, 0xB0, 0x00, 0x3F, 0x00,
-    0x3C, 0x00, 0x0F, 0xC0, 0x0E, 0x00, 0x03, 0xF0, 0x07, 0x80, 0x00, 0xFC, 0x02, 0xD0, 0x00, 0x2F,
-    0x00, 0xF0, 0x00, 0x07, 0xE0, 0x3C, 0x00, 0x00, 0xFD, 0x0E, 0x00, 0x00, 0x1F, 0xEB, 0x46, 0x40,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x0B, 0x00, 0x00,
-    0x3C, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x06, 0xFE, 0xAB, 0xFA, 0x92, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x06, 0xF5, 0x5B, 0xD5, 0x40, 0x2F, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3E,
-    0x00, 0xF8, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x2F, 0x00,
-    0x00, 0xFC, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x1F, 0x00,
-    0x7C, 0x00, 0x02, 0xF0, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x3F, 0xFC, 0x03, 0xE0, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0x91, 0x7C, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x68, 0x28, 0x1A, 0x07, 0xD0, 0x3B, 0xBB, 0xDE, 0xE1, 0xF4, 0x1C, 0xF4,
-    0x78, 0x38, 0x7D, 0x03, 0x78, 0x1C, 0x0E, 0x3F, 0x00, 0xBD, 0x0B, 0x03, 0xBF, 0x40, 0x0F, 0xFB,
-    0xD6, 0xFF, 0x40, 0x02, 0xEF, 0xFF, 0xFD, 0x00, 0x00, 0xE0, 0x75, 0x78, 0x00, 0x00, 0x34, 0x1C,
-    0x0E, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x05, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x7F, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xE9, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x3E, 0x06, 0xF0, 0x00, 0x3F, 0xFF, 0x90,
-    0x00, 0xBF, 0xE4, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2E, 0xFC, 0x07, 0xC0, 0x00, 0xF9, 0xFF, 0x80,
-    0x01, 0xFF, 0xE4, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x04, 0x43, 0xF0, 0x00, 0x3E,
-    0x03, 0xE0, 0x00, 0x7D, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x03, 0xF0,
-    0x0F, 0x80, 0x1F, 0xD0, 0x0F, 0x85, 0xFF, 0x40, 0x1F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFB, 0xC0,
-    0x00, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x00, 0x74, 0x1E, 0x00, 0x00, 0x01, 0xE0, 0xB4, 0x00, 0x00,
-    0x03, 0xE7, 0xE5, 0x55, 0x50, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x06, 0xFE, 0xAA, 0xAF, 0xF0, 0x01,
-    0xE0, 0x00, 0x02, 0xD0, 0x0B, 0x40, 0x00, 0x03, 0x40, 0x3C, 0x00, 0x00, 0x0E, 0x00, 0xF1, 0xE1,
-    0xD0, 0x34, 0x03, 0xEF, 0xEF, 0xC2, 0xC0, 0x1F, 0xD7, 0xE7, 0xEF, 0x00, 0x7D, 0x0A, 0x07, 0xF0,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x10, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0xFD, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x2F, 0x02, 0xF4, 0x01, 0xF8, 0x03, 0xE0, 0x0F, 0xC0, 0x3F,
-    0x00, 0x3E, 0x00, 0xBC, 0x07, 0xD0, 0x07, 0xD0, 0x0B, 0xC0, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x41,
-    0xF4, 0x00, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x00, 0xFD, 0x56, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0xFD, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0xBC,
-    0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x07,
-    0xE0, 0x01, 0xF0, 0x00, 0xBF, 0x00, 0xAF, 0xEA, 0xBF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x1A,
-    0xFE, 0xA5, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00,
-    0x00, 0x01, 0xD0, 0xE0, 0x00, 0x00, 0x01, 0xD1, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xDB, 0xFC, 0x00, 0x0B, 0xFB, 0x43, 0x80, 0x00, 0x2F, 0x8B,
-    0x07, 0x40, 0x00, 0x3F, 0x0F, 0x0B, 0x00, 0x00, 0xBC, 0x0F, 0x0F, 0x00, 0x00, 0xF8, 0x0E, 0x0E,
-    0x00, 0x01, 0xF4, 0x1D, 0x1D, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x05, 0x5F, 0xF9, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x01, 0xD1, 0xC0, 0x00, 0x02, 0xC3, 0xC0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xFD, 0x5B, 0xF4, 0x00, 0xF8, 0x01, 0xFC, 0x01, 0xF4,
-    0x00, 0xFC, 0x02, 0xF0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0xFC, 0x03, 0xE0, 0x01, 0xF4, 0x03, 0xD0,
-    0x0B, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x6F, 0x80, 0x0F, 0x80,
-    0x0B, 0xD0, 0x0F, 0x40, 0x03, 0xE0, 0x1F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3E, 0x00,
-    0x07, 0xD0, 0x3E, 0x00, 0x0F, 0xC0, 0x7D, 0x01, 0xBF, 0x40, 0x7F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x07, 0x4B, 0x00, 0x00, 0x0B, 0x0F, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x3F, 0xFF,
-    0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xE9, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xFF, 0x86, 0xE0, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xD7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00,
+static const uint8_t notosans_14_italicBitmaps[35693] = {
+    0xAD, 0x55, 0x31, 0x6F, 0xDC, 0x36, 0x18, 0x7D, 0x12, 0x91, 0x0A, 0x28, 0x51, 0xD3, 0x83, 0x13,
+    0x74, 0x69, 0x94, 0xB1, 0x05, 0xD2, 0xBB, 0xB5, 0x83, 0xEF, 0xA4, 0x26, 0x43, 0x47, 0x7B, 0xE8,
+    0x75, 0xC9, 0xD0, 0x9F, 0x90, 0x25, 0xC3, 0x0D, 0xB2, 0xA5, 0xC2, 0x7F, 0xE0, 0x96, 0xEE, 0x19,
+    0x0B, 0x77, 0xA8, 0x07, 0x0F, 0x0E, 0x70, 0x39, 0xC9, 0xE9, 0x90, 0xA1, 0x0B, 0xD3, 0x5F, 0xA0,
+    0xA2, 0x9B, 0x27, 0xBA, 0x50, 0x51, 0x01, 0xD1, 0x1D, 0xFB, 0x48, 0xC9, 0x76, 0x0C, 0x77, 0x2C,
+    0x71, 0xA4, 0x24, 0x7E, 0xE4, 0xE3, 0xF7, 0xBD, 0xEF, 0x7D, 0x3C, 0x24, 0x88, 0x0B, 0xA9, 0x43,
+    0x83, 0x0E, 0x53, 0xA8, 0x34, 0xAA, 0xF8, 0xDA, 0x62, 0x02, 0x85, 0xA8, 0x0A, 0x6A, 0x9C, 0xC2,
+    0xB5, 0x20, 0x15, 0x26, 0xE8, 0x90, 0xE3, 0x1E, 0x30, 0x92, 0x47, 0x75, 0x3B, 0x51, 0xDF, 0x54,
+    0x66, 0x1E, 0xCB, 0x27, 0xFA, 0xE4, 0xF1, 0xC7, 0x61, 0x01, 0xCC, 0x45, 0x05, 0x9C, 0x46, 0x7C,
+    0x33, 0x32, 0xE5, 0xA0, 0xB8, 0xA9, 0xE6, 0x10, 0xEA, 0x87, 0x08, 0x7F, 0xBE, 0x28, 0x7F, 0x8A,
+    0xAC, 0xB5, 0x5D, 0xF0, 0xEC, 0xC7, 0x57, 0xFB, 0x84, 0x26, 0xAA, 0x82, 0x01, 0x1E, 0xBA, 0x61,
+    0x12, 0xD6, 0x48, 0x68, 0xD5, 0x7E, 0xB8, 0x03, 0x12, 0x03, 0x42, 0x8F, 0x38, 0x54, 0xBB, 0x18,
+    0xDA, 0x16, 0xFB, 0x67, 0xB4, 0xAD, 0x52, 0xC4, 0x96, 0x6E, 0xAD, 0x3A, 0xB4, 0x73, 0x04, 0xE6,
+    0x14, 0xA1, 0x39, 0xE1, 0x93, 0xA0, 0x6B, 0xF6, 0xBC, 0x06, 0xE2, 0x35, 0x77, 0xDA, 0x02, 0xE2,
+    0x37, 0x0D, 0x71, 0xA4, 0x11, 0xB1, 0xCB, 0xA7, 0xFA, 0x91, 0x52, 0x55, 0xF2, 0x8B, 0xC5, 0xD8,
+    0xB6, 0x08, 0x0E, 0x79, 0xD6, 0x63, 0x42, 0x3A, 0xFC, 0xCF, 0xAF, 0xCE, 0xC8, 0x2B, 0x7A, 0x57,
+    0x76, 0xF4, 0x73, 0xA2, 0xC8, 0xCB, 0x48, 0x68, 0x59, 0x28, 0x34, 0x51, 0x15, 0x55, 0xBB, 0x82,
+    0xCC, 0x28, 0xA1, 0x71, 0x16, 0xBD, 0xA9, 0xF1, 0x65, 0xF8, 0xEE, 0xF2, 0x95, 0x2C, 0xCC, 0xA5,
+    0x7D, 0x67, 0xDA, 0xBF, 0x9B, 0x65, 0xD2, 0x9D, 0x35, 0x4A, 0xB4, 0x19, 0x57, 0x61, 0x77, 0xC4,
+    0x00, 0x27, 0x32, 0xCD, 0x30, 0x72, 0x31, 0xC4, 0x0C, 0x29, 0x55, 0xA0, 0x85, 0x8F, 0xA7, 0x04,
+    0x0C, 0xDE, 0x9B, 0xA8, 0xC2, 0xB8, 0x76, 0x07, 0xA6, 0xC3, 0xC1, 0x91, 0xE5, 0x5B, 0xC9, 0x21,
+    0xAA, 0x13, 0x60, 0x8C, 0x0C, 0xCC, 0x87, 0x81, 0xA8, 0x65, 0x05, 0x55, 0x1C, 0x32, 0x24, 0xC9,
+    0xF5, 0x09, 0xE3, 0x02, 0xE3, 0x42, 0xDC, 0x31, 0xC0, 0xB6, 0x45, 0x9B, 0x7C, 0xDD, 0x44, 0xE7,
+    0x4D, 0x68, 0xA6, 0xAA, 0x10, 0x7F, 0x99, 0xA9, 0xC3, 0x69, 0x21, 0x1B, 0x61, 0x30, 0xAE, 0x64,
+    0x1D, 0xD9, 0x4A, 0x59, 0xCB, 0x54, 0x5B, 0x3D, 0x4E, 0xFD, 0x59, 0xA3, 0xE9, 0x24, 0x9B, 0x9F,
+    0x9E, 0xBC, 0x24, 0xBB, 0x3C, 0x60, 0xCC, 0x74, 0xA3, 0x41, 0x82, 0x48, 0x53, 0x09, 0x2A, 0xA5,
+    0x0A, 0xA6, 0xCE, 0x92, 0x81, 0xC7, 0x2E, 0x79, 0x30, 0xD7, 0xF8, 0x41, 0x16, 0xFC, 0xE4, 0xDA,
+    0x5D, 0xA6, 0x96, 0x01, 0xE1, 0x25, 0xC0, 0x5C, 0xC5, 0x9E, 0xBD, 0x33, 0xF2, 0xEF, 0x6C, 0xFD,
+    0x57, 0xC3, 0x94, 0xB9, 0xD7, 0x8C, 0x19, 0x71, 0x28, 0x53, 0x37, 0xE5, 0x9F, 0xFC, 0x26, 0x56,
+    0xE6, 0xF0, 0xA7, 0x6E, 0x4B, 0x0F, 0xE3, 0x1B, 0xA3, 0x95, 0x4E, 0x49, 0x78, 0x21, 0xA1, 0x1A,
+    0x9A, 0x36, 0xDF, 0x2D, 0x22, 0xBB, 0x46, 0xF9, 0xA0, 0x98, 0xBE, 0x80, 0xFA, 0xB5, 0x12, 0x66,
+    0x82, 0x4F, 0x42, 0xAF, 0x1D, 0xDF, 0xA8, 0x48, 0x27, 0x22, 0xF5, 0xE1, 0x63, 0xF6, 0xFD, 0x6C,
+    0x8F, 0x5A, 0x2A, 0xAD, 0xAD, 0xEF, 0xD8, 0xBC, 0x78, 0xF6, 0xA5, 0x4E, 0x02, 0xA3, 0x8A, 0x2C,
+    0xAC, 0xB7, 0xA8, 0x3D, 0x65, 0xCF, 0x67, 0xFB, 0xF7, 0xD4, 0xDB, 0xCB, 0x6E, 0xC7, 0x41, 0xB6,
+    0xBD, 0x0F, 0xF4, 0xD7, 0x9D, 0xA3, 0x48, 0xD6, 0x12, 0x8E, 0x17, 0xB2, 0xE3, 0x5C, 0x77, 0xBE,
+    0xBB, 0x19, 0x51, 0xBB, 0xF4, 0xB8, 0xA0, 0xFC, 0xF2, 0x03, 0xCE, 0xD0, 0x18, 0xA7, 0x1F, 0x02,
+    0xF4, 0x8D, 0x39, 0x12, 0xD4, 0x69, 0xF2, 0x43, 0x17, 0x32, 0x41, 0xAA, 0x88, 0x34, 0x19, 0x3D,
+    0xAA, 0x31, 0xE5, 0xE2, 0x76, 0x09, 0xF1, 0x27, 0xF9, 0xD8, 0x2B, 0x70, 0x30, 0x41, 0x78, 0xD9,
+    0x40, 0xBD, 0xD5, 0xCE, 0x12, 0x34, 0x07, 0x50, 0x55, 0x83, 0x43, 0x61, 0x84, 0x91, 0x75, 0x92,
+    0x2A, 0x4B, 0x9B, 0x75, 0xC5, 0x48, 0x48, 0x59, 0xC4, 0x75, 0xD2, 0x94, 0xCB, 0xF2, 0xF9, 0x96,
+    0xAA, 0xE8, 0x49, 0x43, 0xE6, 0xC6, 0xF4, 0x4C, 0xD4, 0xC1, 0xF5, 0xAB, 0xA6, 0xB3, 0x4B, 0x3A,
+    0xED, 0xFC, 0xED, 0x95, 0x55, 0x20, 0x27, 0xC8, 0x3A, 0xEC, 0xF0, 0x08, 0xAF, 0xE1, 0x7D, 0xF6,
+    0x9D, 0xAC, 0x33, 0xEB, 0xE0, 0x56, 0xAA, 0x8E, 0xFE, 0xD2, 0xF9, 0x9C, 0x9F, 0x2E, 0x0E, 0x17,
+    0x24, 0xF7, 0x73, 0xB5, 0xA0, 0x55, 0xD1, 0x92, 0xCC, 0x66, 0x29, 0xA9, 0xD5, 0x64, 0xB8, 0xF2,
+    0xB8, 0x92, 0xB8, 0xE5, 0x80, 0xBB, 0xED, 0x98, 0xB9, 0xC6, 0x5C, 0xF6, 0x98, 0x04, 0x19, 0x53,
+    0xD0, 0x09, 0xF1, 0xEE, 0x97, 0x69, 0x8F, 0xE2, 0xCE, 0x11, 0x43, 0x77, 0xDC, 0xAA, 0x6A, 0x8E,
+    0xBC, 0xC8, 0xED, 0x86, 0x25, 0xCD, 0x2D, 0x3E, 0x11, 0x6E, 0x3F, 0x31, 0x21, 0xD9, 0xE3, 0x33,
+    0xC2, 0xD2, 0xD0, 0xB2, 0x14, 0xFE, 0x20, 0x5F, 0x6F, 0xA8, 0x6B, 0xEE, 0x5D, 0x32, 0x4A, 0x57,
+    0x94, 0x5A, 0x56, 0xAA, 0x50, 0x05, 0xAF, 0x30, 0x62, 0xD8, 0x0D, 0xFD, 0x5B, 0xDF, 0x9F, 0xE5,
+    0xDF, 0xF6, 0x49, 0x98, 0x0C, 0xEE, 0xB0, 0x27, 0xB6, 0x09, 0xE8, 0xBB, 0xBC, 0x38, 0xF6, 0xB3,
+    0xE6, 0x26, 0x53, 0x2E, 0xF6, 0x8B, 0x05, 0x1D, 0x6D, 0xF0, 0xC5, 0x33, 0xF7, 0x61, 0x7A, 0x47,
+    0xC7, 0x83, 0x1F, 0x43, 0xE2, 0x5F, 0x6F, 0x81, 0xCC, 0xD3, 0xCD, 0xDC, 0x2E, 0xFA, 0x54, 0xF8,
+    0x0B, 0xD2, 0x1A, 0x4E, 0x14, 0x92, 0x11, 0xAE, 0xFA, 0xD8, 0x92, 0x3E, 0x74, 0x87, 0x30, 0x19,
+    0x37, 0xC1, 0x3F, 0xB6, 0x91, 0xEB, 0xC8, 0x24, 0xCC, 0x7D, 0xD7, 0xE7, 0x9E, 0xBA, 0x6A, 0x26,
+    0x2C, 0x01, 0xD6, 0x1E, 0x75, 0xD3, 0x46, 0x75, 0xCC, 0x0A, 0xED, 0x3C, 0x99, 0xAE, 0x3E, 0x63,
+    0x6B, 0x1B, 0x46, 0x71, 0x3E, 0x9B, 0xE5, 0x03, 0xD2, 0x2D, 0xD5, 0x5D, 0x61, 0x67, 0xB7, 0x74,
+    0xA8, 0x06, 0x1D, 0x0E, 0x33, 0xED, 0xF5, 0x4C, 0xDF, 0xC6, 0x1B, 0xEA, 0xD0, 0x22, 0x49, 0xD7,
+    0xDC, 0xDE, 0x4A, 0xD6, 0x92, 0xD3, 0xC9, 0x92, 0x4C, 0xB4, 0xC2, 0x84, 0x6D, 0x89, 0x90, 0xF7,
+    0x2F, 0x17, 0x45, 0xED, 0x0A, 0x87, 0x58, 0x11, 0xA6, 0x8B, 0xA9, 0x78, 0xD6, 0xFB, 0xEF, 0x64,
+    0x5B, 0xF2, 0x66, 0x50, 0x5A, 0xE9, 0xD8, 0xE7, 0x48, 0xDF, 0x04, 0x9F, 0xB3, 0xAC, 0x79, 0x8F,
+    0xAE, 0xC2, 0x26, 0xD2, 0xC2, 0xF0, 0x0A, 0xA1, 0x6A, 0x63, 0x5E, 0x03, 0x99, 0xDB, 0x9C, 0x41,
+    0x9D, 0x37, 0xC8, 0x85, 0x89, 0xBA, 0xC8, 0xBE, 0xE7, 0x3D, 0xB4, 0xC7, 0xEB, 0x67, 0x88, 0x23,
+    0xEE, 0x65, 0xA7, 0xAA, 0xED, 0x80, 0x15, 0x6E, 0x75, 0x48, 0x94, 0x21, 0xF3, 0x91, 0x4E, 0x8A,
+    0x75, 0x58, 0xE3, 0x56, 0xDB, 0x11, 0x26, 0xAE, 0x72, 0xEC, 0xF7, 0x0B, 0x44, 0x8B, 0x35, 0x46,
+    0xB8, 0xDB, 0x76, 0xE0, 0xFF, 0xD4, 0x2A, 0x5F, 0x00, 0x0D, 0xBE, 0xF2, 0x93, 0xDB, 0x9E, 0x12,
+    0x5E, 0xB5, 0x37, 0x3F, 0x0D, 0x45, 0xE1, 0x95, 0xE4, 0xB5, 0x5C, 0xB0, 0xEB, 0xFE, 0x1F, 0xE3,
+    0xF9, 0x40, 0x1E, 0x37, 0xB0, 0xDC, 0xBC, 0x94, 0xF4, 0x0D, 0xF6, 0x6C, 0xE6, 0xAE, 0x96, 0xCD,
+    0xF1, 0xF1, 0xF1, 0x22, 0xED, 0x73, 0x52, 0xFE, 0x57, 0xF7, 0x27, 0x11, 0xAD, 0xD4, 0x01, 0x71,
+    0x99, 0x52, 0x55, 0x5C, 0xDF, 0xF0, 0x1F, 0xD9, 0x05, 0x55, 0x38, 0x7A, 0xD2, 0xF9, 0x7C, 0x66,
+    0xFE, 0xD7, 0xB9, 0x84, 0xBA, 0x32, 0x29, 0xB0, 0x71, 0x85, 0x46, 0xF6, 0xA8, 0x0F, 0x75, 0x75,
+    0xEA, 0xA7, 0xBE, 0x1E, 0x4B, 0x5F, 0x86, 0x3B, 0xF8, 0x3F, 0xDB, 0xBF, 0xA5, 0x55, 0xBF, 0x8F,
+    0xDC, 0x44, 0x14, 0x7E, 0x33, 0x23, 0x65, 0x0A, 0x17, 0xD3, 0x04, 0xA1, 0x28, 0x12, 0xFE, 0x0F,
+    0xCE, 0xFF, 0xC0, 0xAD, 0xED, 0x23, 0xA2, 0xA2, 0xA1, 0xC8, 0x2A, 0x05, 0x45, 0x7A, 0x9A, 0x34,
+    0x14, 0x48, 0x78, 0x6F, 0x07, 0x28, 0x29, 0x72, 0x05, 0xFC, 0x07, 0x54, 0xF4, 0x48, 0x57, 0xF8,
+    0xB2, 0x43, 0xAE, 0x48, 0x41, 0xC1, 0x40, 0x74, 0x4A, 0x19, 0xA3, 0x50, 0x51, 0x4D, 0x38, 0xA3,
+    0x18, 0x9D, 0x77, 0x87, 0xEF, 0x8D, 0xBD, 0xE2, 0x82, 0x04, 0x8A, 0x84, 0x57, 0xCF, 0x6B, 0xCF,
+    0xBC, 0x79, 0xEF, 0x7B, 0xDF, 0xFB, 0x61, 0xA2, 0x1B, 0x8F, 0x4E, 0x88, 0x64, 0x8C, 0x3D, 0xD1,
+    0xE6, 0xE4, 0xED, 0x81, 0x8C, 0x27, 0xD1, 0xD3, 0x48, 0x24, 0x42, 0x66, 0x89, 0x94, 0x6F, 0x68,
+    0x33, 0x64, 0x5F, 0xF8, 0xFC, 0x2A, 0xE4, 0x39, 0x0D, 0xDA, 0x1D, 0xF6, 0xC6, 0x1E, 0xD0, 0xA5,
+    0x6B, 0xA8, 0xD7, 0xCF, 0xA5, 0x57, 0xEE, 0x9D, 0xC6, 0xD4, 0x39, 0x7D, 0xD7, 0x1D, 0xD2, 0xA0,
+    0x9E, 0xB8, 0x5E, 0x77, 0x07, 0xB9, 0xEA, 0x3E, 0x7D, 0x1C, 0x0E, 0x75, 0x7C, 0x18, 0xEB, 0x5E,
+    0xF7, 0x59, 0x27, 0x03, 0xE1, 0x52, 0x1D, 0xDF, 0x75, 0x7A, 0xD6, 0xDB, 0xE5, 0xA3, 0xBD, 0x5F,
+    0xFA, 0xE8, 0x2B, 0x5E, 0x12, 0xFC, 0xB8, 0x83, 0x6C, 0xE0, 0xB7, 0x84, 0x56, 0xD1, 0x10, 0x99,
+    0xFB, 0x90, 0x73, 0x47, 0xDA, 0xF7, 0xA4, 0xC2, 0x02, 0x4A, 0xC6, 0xC2, 0x4F, 0x47, 0x0D, 0xB5,
+    0x54, 0xC5, 0x48, 0x45, 0x8C, 0xCE, 0xFC, 0xF6, 0x6D, 0xC8, 0x1C, 0xAD, 0xB0, 0x6C, 0xEE, 0x04,
+    0x52, 0xBF, 0x0C, 0x44, 0x03, 0x42, 0xA8, 0x56, 0x44, 0x58, 0x5F, 0xEF, 0x2C, 0xD4, 0x76, 0x64,
+    0x2E, 0x1E, 0x74, 0x50, 0x19, 0xE1, 0xA8, 0xC0, 0xE9, 0xCC, 0x15, 0x24, 0x83, 0xB1, 0x62, 0x50,
+    0x5E, 0x8E, 0x82, 0xA1, 0x6C, 0x20, 0x15, 0x3D, 0xB0, 0xC6, 0xCA, 0x5E, 0x79, 0x2A, 0x45, 0x20,
+    0xE3, 0x5A, 0x38, 0x2E, 0x49, 0x0C, 0x70, 0x3C, 0x6A, 0x7F, 0x63, 0x0B, 0xCD, 0x2D, 0x34, 0x7F,
+    0xA5, 0xF9, 0x5A, 0xEF, 0x6A, 0x2C, 0x05, 0xB9, 0x3B, 0xFA, 0x44, 0x32, 0x6F, 0x10, 0xE6, 0x8F,
+    0x8E, 0x21, 0x15, 0x04, 0xE7, 0x00, 0x1F, 0xC1, 0x86, 0x79, 0x23, 0x2D, 0x3A, 0xF0, 0xC1, 0x0B,
+    0x2D, 0x24, 0x67, 0xA2, 0x39, 0xFA, 0xB5, 0xBD, 0x45, 0x59, 0x8C, 0x96, 0xD6, 0x11, 0x07, 0x6E,
+    0x4E, 0xC6, 0xA7, 0x95, 0xED, 0x87, 0x08, 0xC0, 0xEA, 0x1E, 0xE0, 0x0D, 0x80, 0x53, 0x0B, 0x73,
+    0xDA, 0x97, 0x60, 0x0A, 0x40, 0x55, 0x07, 0xAA, 0xCA, 0x8C, 0x69, 0x82, 0x83, 0x33, 0x78, 0x34,
+    0x0E, 0xF6, 0x86, 0x1C, 0x24, 0xBE, 0x0B, 0x3D, 0xC6, 0x3F, 0x22, 0xF4, 0x4D, 0x7D, 0xBC, 0xDC,
+    0x78, 0x1D, 0x23, 0x1E, 0xE3, 0x09, 0x9B, 0x8F, 0x23, 0x9E, 0x46, 0xDA, 0x2E, 0xEF, 0x52, 0x3F,
+    0xA5, 0x80, 0x61, 0xB2, 0x70, 0xB6, 0x60, 0x9A, 0xA0, 0x6D, 0x81, 0xA0, 0x36, 0x17, 0xCB, 0x14,
+    0x8A, 0xA9, 0x01, 0x18, 0x47, 0x81, 0x81, 0xCA, 0x59, 0x8E, 0x71, 0x7C, 0x6F, 0xEA, 0x8D, 0x6C,
+    0x42, 0x92, 0x4D, 0x96, 0x7F, 0xB1, 0x89, 0xDC, 0x21, 0xC9, 0x13, 0x41, 0xD3, 0x75, 0x1B, 0x9C,
+    0xE7, 0x48, 0x77, 0xB6, 0x7D, 0xAF, 0x95, 0x5B, 0x46, 0x3F, 0x13, 0x29, 0x86, 0x99, 0xD5, 0x54,
+    0x61, 0x7C, 0x30, 0x73, 0x22, 0x86, 0x11, 0x59, 0x37, 0x4E, 0xDC, 0xC3, 0x03, 0x95, 0x86, 0xC9,
+    0x81, 0xAD, 0x46, 0x77, 0xD8, 0xAD, 0x6A, 0x1A, 0xC4, 0x8E, 0xF2, 0x1A, 0xD1, 0x05, 0x40, 0xF9,
+    0x13, 0x46, 0xEA, 0xC9, 0xE1, 0x29, 0x80, 0xAA, 0x8E, 0x29, 0xAC, 0x01, 0x63, 0x05, 0xF8, 0x92,
+    0x8B, 0x8B, 0xAB, 0x05, 0xB8, 0xE0, 0x89, 0x2B, 0x43, 0x3B, 0x00, 0x89, 0x08, 0x33, 0x8E, 0xEA,
+    0x8F, 0xE5, 0xBD, 0x49, 0x7D, 0x81, 0xF3, 0xA8, 0x98, 0xA4, 0x6E, 0x6C, 0x35, 0xA9, 0x8B, 0x5E,
+    0x27, 0x75, 0x4A, 0x35, 0xC7, 0xE7, 0xAB, 0x88, 0x28, 0x2C, 0xC3, 0x2C, 0x52, 0x79, 0x32, 0xE8,
+    0x3E, 0xB9, 0x2E, 0x52, 0x38, 0xAF, 0xBF, 0x5B, 0x26, 0x8C, 0x39, 0x6C, 0xD3, 0xFB, 0x66, 0x00,
+    0xBF, 0xA9, 0x81, 0x5C, 0x5A, 0x62, 0xF6, 0x60, 0x33, 0xAF, 0x13, 0xBF, 0xC5, 0x44, 0xC1, 0x62,
+    0x62, 0xB8, 0x9D, 0xD8, 0x19, 0x12, 0xBF, 0x62, 0xDE, 0x0E, 0x89, 0x5D, 0xDE, 0x6E, 0x92, 0xF7,
+    0xF9, 0x34, 0xBA, 0x72, 0xBD, 0x05, 0x11, 0x35, 0xDD, 0x9A, 0x78, 0xD0, 0x1E, 0x1C, 0x0E, 0xD8,
+    0x3D, 0xC6, 0xE9, 0xDC, 0x22, 0x8C, 0x8E, 0x0A, 0x2C, 0xC8, 0x80, 0xBA, 0x2E, 0x51, 0xB1, 0xEA,
+    0x19, 0x3C, 0xAD, 0x46, 0x4E, 0x24, 0x8C, 0x45, 0xE4, 0xC2, 0x7C, 0x0F, 0x98, 0xDC, 0x9F, 0x39,
+    0x5C, 0xCB, 0x00, 0x24, 0x25, 0xB2, 0xA2, 0x3A, 0xA0, 0x5F, 0x01, 0x09, 0x10, 0xB7, 0xF8, 0x31,
+    0xC0, 0x86, 0x66, 0x2E, 0x7A, 0x4A, 0xFC, 0x52, 0xE2, 0x9C, 0x12, 0xB1, 0x0C, 0xCA, 0x30, 0x81,
+    0x8C, 0x3A, 0xD1, 0xC6, 0x80, 0xCB, 0x54, 0x64, 0x28, 0x2D, 0xAE, 0x2C, 0xF8, 0x12, 0x68, 0xC1,
+    0x9A, 0xD4, 0x96, 0xC0, 0x64, 0x36, 0xD2, 0x15, 0xB4, 0x5B, 0xF1, 0xCA, 0xD1, 0xC1, 0x20, 0x71,
+    0x6F, 0x06, 0xF5, 0xC2, 0xD1, 0xD0, 0xAB, 0xA7, 0x4E, 0xBC, 0x0C, 0xB8, 0xAB, 0x9F, 0x83, 0x3E,
+    0xF7, 0xFA, 0xBC, 0xCB, 0x1E, 0x7B, 0x73, 0xC7, 0x9B, 0xCF, 0xBB, 0x42, 0x7B, 0x73, 0xD4, 0x2D,
+    0x32, 0x67, 0x44, 0x38, 0xCD, 0x90, 0x9F, 0x80, 0x51, 0x50, 0xD0, 0xEF, 0x1D, 0xA7, 0xFD, 0x15,
+    0xDE, 0x17, 0x30, 0x5D, 0x00, 0x69, 0x44, 0x0C, 0x2D, 0x9D, 0x01, 0xC1, 0x29, 0xFE, 0x17, 0xA9,
+    0xBE, 0x0E, 0x68, 0xC3, 0x2C, 0xC7, 0x74, 0xB3, 0xC8, 0xFA, 0x15, 0x62, 0x93, 0x97, 0x1E, 0x93,
+    0xE9, 0x45, 0x87, 0x02, 0xF9, 0x29, 0x88, 0xA0, 0x7C, 0x2F, 0x82, 0x76, 0x2D, 0x97, 0x43, 0xC3,
+    0x05, 0x85, 0x46, 0x35, 0x75, 0xA1, 0x9D, 0x21, 0xF3, 0x3E, 0xEC, 0x9B, 0x2F, 0x61, 0x5E, 0xFF,
+    0x68, 0x4B, 0x52, 0xCF, 0x51, 0x3A, 0x32, 0xC2, 0x97, 0x88, 0xCC, 0xCB, 0x0E, 0x9E, 0xE0, 0x70,
+    0xBA, 0x32, 0xF4, 0xA9, 0xE4, 0x86, 0xAD, 0x3C, 0xA6, 0xD7, 0xC0, 0xCD, 0x0F, 0x82, 0x2D, 0x4F,
+    0xB7, 0x0C, 0xBC, 0x8F, 0x28, 0x33, 0xF9, 0x12, 0x4C, 0x66, 0x3F, 0xE0, 0xAD, 0xE0, 0x06, 0x1A,
+    0xB1, 0xA7, 0x2E, 0x91, 0xE7, 0xFC, 0x21, 0xD2, 0x7B, 0x56, 0x71, 0xD2, 0xB9, 0x78, 0x3E, 0x83,
+    0xD6, 0x88, 0x31, 0x93, 0x7B, 0x3D, 0xC8, 0x1D, 0xF7, 0x9F, 0x87, 0x65, 0x6E, 0x9D, 0x9B, 0xF3,
+    0x18, 0x43, 0x3D, 0x07, 0x0C, 0x1A, 0xCE, 0x3A, 0x0F, 0xC9, 0x15, 0xB2, 0x52, 0x42, 0x16, 0x48,
+    0xCD, 0x0A, 0xB9, 0x19, 0xB5, 0x93, 0x43, 0x86, 0x21, 0x9A, 0xDA, 0x36, 0x7E, 0xF3, 0x86, 0x6D,
+    0xFB, 0x3F, 0x22, 0x30, 0xAF, 0x45, 0x90, 0xEF, 0x23, 0x30, 0x1C, 0xC1, 0xF6, 0x7A, 0x04, 0xB7,
+    0xFD, 0x3C, 0x0A, 0xA6, 0x1B, 0x1C, 0xC0, 0x7A, 0x7D, 0x3D, 0xA8, 0x11, 0x41, 0x9D, 0x21, 0xA8,
+    0x72, 0x0E, 0xAA, 0xFC, 0x3B, 0x28, 0x7C, 0xA1, 0x60, 0xC9, 0x60, 0xAA, 0x9B, 0xAF, 0x01, 0xAF,
+    0x6E, 0x11, 0xD4, 0x0A, 0x41, 0x55, 0x08, 0xA8, 0x80, 0x18, 0xCB, 0xE5, 0xDB, 0x50, 0xE6, 0xDB,
+    0xF9, 0x1B, 0x86, 0xA1, 0x88, 0x70, 0x50, 0x89, 0xF1, 0xE8, 0x94, 0x87, 0x0F, 0x77, 0xD5, 0x5E,
+    0x64, 0x9F, 0xAA, 0x13, 0xBE, 0x81, 0x24, 0xC7, 0xA6, 0xE4, 0x6F, 0xDA, 0xBA, 0x9E, 0xA0, 0xB1,
+    0x64, 0xF3, 0x7F, 0x61, 0x3F, 0x16, 0x9B, 0x34, 0x2E, 0x0B, 0x98, 0xA3, 0x0F, 0x78, 0x34, 0xC4,
+    0x91, 0xE5, 0xAD, 0xFB, 0x17, 0x77, 0x27, 0x75, 0x9B, 0xBA, 0x33, 0x31, 0xFC, 0x4F, 0x96, 0xDB,
+    0xF9, 0x73, 0xC2, 0xF1, 0xB3, 0xCF, 0xFD, 0x8C, 0xBD, 0x3E, 0x67, 0x1D, 0xFD, 0xF7, 0xF5, 0x17,
+    0x95, 0x55, 0x3D, 0x8F, 0xE4, 0x44, 0x10, 0x7D, 0x76, 0x1F, 0x67, 0x84, 0x83, 0x26, 0xB8, 0x8B,
+    0x56, 0xA2, 0xD3, 0xD5, 0x49, 0xAC, 0xFF, 0xC0, 0xFA, 0x83, 0x5F, 0x00, 0xC1, 0xAE, 0x08, 0xEF,
+    0x27, 0x10, 0x23, 0xCD, 0xEC, 0x58, 0xA4, 0x04, 0x48, 0x48, 0xE4, 0x1B, 0x6C, 0x80, 0x36, 0x21,
+    0x21, 0xD8, 0xC0, 0x77, 0xD3, 0xE2, 0x24, 0x2E, 0x20, 0xC0, 0x70, 0x3A, 0x12, 0x82, 0x33, 0x9C,
+    0x88, 0x08, 0xAE, 0x11, 0x5E, 0x6D, 0x03, 0xDE, 0x69, 0x5E, 0xF5, 0xCC, 0x2C, 0x03, 0x3A, 0x09,
+    0xB0, 0xDC, 0x96, 0xDD, 0x1F, 0x55, 0xAF, 0x5E, 0xBD, 0x2A, 0xA7, 0x03, 0x52, 0xA7, 0x5B, 0x68,
+    0x5B, 0x02, 0x55, 0xE2, 0x80, 0x31, 0xB7, 0xC8, 0x6C, 0x0D, 0x14, 0xF0, 0x80, 0x57, 0x3D, 0xD4,
+    0x60, 0x00, 0xD3, 0x74, 0x40, 0xA7, 0xB6, 0xDB, 0xDB, 0x39, 0x50, 0x72, 0x7B, 0xE2, 0xB8, 0x3D,
+    0xB7, 0x05, 0x0F, 0xA3, 0x43, 0x32, 0x26, 0x23, 0x4D, 0x29, 0x9F, 0x4E, 0xC8, 0x42, 0xE8, 0xF9,
+    0xA0, 0x0D, 0xDC, 0xE1, 0x38, 0xA4, 0x89, 0xB7, 0x1B, 0xE8, 0x47, 0x9C, 0x1C, 0x3C, 0x94, 0xAB,
+    0xB8, 0x9B, 0x67, 0xA7, 0xD4, 0x61, 0xCE, 0xA3, 0x35, 0x0C, 0x7D, 0x64, 0x56, 0x5B, 0x8C, 0x59,
+    0x8F, 0x52, 0x39, 0xE8, 0xB7, 0x1C, 0x7D, 0x0B, 0x88, 0x19, 0x70, 0x50, 0x01, 0xF9, 0x33, 0x20,
+    0x09, 0x2D, 0xB0, 0xB0, 0x80, 0x1E, 0x40, 0x2B, 0xB4, 0x7C, 0xC1, 0x4D, 0x30, 0x27, 0x48, 0x3D,
+    0xF4, 0xD7, 0x16, 0x2B, 0x64, 0xDF, 0x3A, 0x2C, 0x6D, 0xEA, 0x3A, 0x54, 0x0E, 0xBE, 0x40, 0x31,
+    0x43, 0x97, 0x5B, 0x7D, 0x1F, 0x55, 0xEA, 0xB2, 0x47, 0xD6, 0x30, 0x8C, 0x9E, 0x41, 0x98, 0xC4,
+    0x1D, 0x66, 0x7D, 0x66, 0xBD, 0x4E, 0x5D, 0xE2, 0x66, 0xCA, 0x8E, 0x98, 0x55, 0xE0, 0x29, 0xA3,
+    0x51, 0x96, 0xC8, 0xBE, 0x6A, 0x79, 0x04, 0xBF, 0x5A, 0xF5, 0xAC, 0x45, 0xE9, 0x70, 0x65, 0xA1,
+    0x47, 0xD4, 0x03, 0xD4, 0x84, 0x9C, 0x7E, 0xAF, 0xC5, 0x21, 0x61, 0xE3, 0x01, 0x31, 0x10, 0x3C,
+    0xA3, 0xD0, 0x0D, 0x29, 0xD3, 0x2D, 0x51, 0x65, 0x96, 0xA1, 0xA9, 0xDE, 0x34, 0xA4, 0x8B, 0xC0,
+    0x13, 0x27, 0x34, 0xFC, 0x21, 0x68, 0x97, 0x84, 0x8E, 0xBA, 0xE1, 0x63, 0x21, 0xE7, 0x02, 0xDF,
+    0xD4, 0xCF, 0x9C, 0xCB, 0x1F, 0xF3, 0x51, 0x90, 0x6D, 0xCC, 0xC9, 0x08, 0x3C, 0xB9, 0xA5, 0x1D,
+    0x4F, 0x6E, 0x49, 0x0E, 0xED, 0xCC, 0x49, 0x30, 0x6F, 0x66, 0xA9, 0x23, 0x73, 0x8C, 0x4A, 0x39,
+    0x83, 0xBC, 0xD7, 0x8D, 0x6E, 0x75, 0x5B, 0x73, 0x5B, 0x47, 0xA7, 0xE4, 0xF5, 0x89, 0x8B, 0xF6,
+    0x52, 0x1A, 0x4E, 0x02, 0x1D, 0x4C, 0x1C, 0xE2, 0x7C, 0x14, 0x14, 0x80, 0xD8, 0x56, 0xC3, 0x7A,
+    0x90, 0x66, 0x31, 0x4F, 0xB7, 0x21, 0x0C, 0x2A, 0x84, 0x6B, 0xDC, 0x3B, 0xFF, 0x8C, 0xDF, 0x29,
+    0xF7, 0xE2, 0x44, 0x82, 0xB2, 0x1B, 0x8A, 0xC5, 0x48, 0x41, 0xA4, 0xD9, 0xB0, 0xF9, 0x60, 0xD8,
+    0xD0, 0xFD, 0xCE, 0x56, 0xBD, 0xDD, 0x2A, 0x6C, 0x14, 0x9F, 0x1C, 0xBF, 0x43, 0x7B, 0x01, 0x75,
+    0x08, 0x9C, 0xD3, 0x2B, 0xB9, 0xCD, 0x11, 0xA2, 0x4A, 0x24, 0x04, 0x8A, 0x81, 0x29, 0xED, 0x22,
+    0xB2, 0x11, 0x51, 0x46, 0x48, 0x07, 0x01, 0x45, 0x02, 0x32, 0x11, 0x14, 0x44, 0x64, 0x8D, 0xDC,
+    0x46, 0x94, 0x88, 0xFA, 0x08, 0xB5, 0xC7, 0xBD, 0x33, 0x7C, 0x9E, 0xB7, 0xB3, 0xCC, 0x1E, 0xAA,
+    0xBE, 0x54, 0xC3, 0x41, 0x42, 0x0E, 0x9C, 0x6E, 0xC6, 0xBC, 0xED, 0x32, 0xCB, 0x0C, 0x72, 0x0E,
+    0x79, 0xF4, 0xF6, 0xCA, 0xFC, 0xFF, 0x78, 0xC1, 0xC6, 0xCB, 0x16, 0xDD, 0xDD, 0x6E, 0xE3, 0x4D,
+    0x96, 0x24, 0x3E, 0xE6, 0x1C, 0x6F, 0x5C, 0xD0, 0x0C, 0x53, 0xFB, 0xC5, 0x80, 0x37, 0x95, 0x85,
+    0xCB, 0xDB, 0xBC, 0xD1, 0xDC, 0x7C, 0x40, 0x9B, 0x87, 0xDC, 0x77, 0xC1, 0x75, 0x61, 0x00, 0x77,
+    0x8F, 0x8F, 0x4D, 0x08, 0x5F, 0x9E, 0x9F, 0x9F, 0x1E, 0x65, 0x3D, 0x15, 0x95, 0xD9, 0x5B, 0xD8,
+    0x1B, 0xF6, 0xB1, 0x9C, 0x66, 0xEA, 0xFA, 0xBE, 0xCF, 0x87, 0x6C, 0x64, 0x8D, 0x38, 0x49, 0x61,
+    0x4D, 0x34, 0x15, 0xC7, 0x9C, 0xC9, 0xE8, 0x62, 0x12, 0x35, 0x47, 0xD1, 0xCE, 0xB0, 0x68, 0xEA,
+    0xF4, 0x45, 0x53, 0x84, 0x8F, 0x90, 0x5F, 0x13, 0x9C, 0x08, 0x46, 0x2E, 0x82, 0x14, 0x94, 0x71,
+    0x30, 0x44, 0x09, 0x50, 0x22, 0xA4, 0xCC, 0x5B, 0x5C, 0x86, 0x31, 0xB9, 0xFA, 0x6E, 0x4A, 0x57,
+    0x78, 0x40, 0xBC, 0x73, 0xA6, 0x43, 0xF8, 0x28, 0x99, 0xE6, 0xB9, 0xA8, 0x88, 0x29, 0x9A, 0x18,
+    0xAF, 0xD7, 0x6D, 0xEA, 0x8C, 0xCD, 0x86, 0x62, 0x30, 0xB6, 0x5C, 0x06, 0x1C, 0x16, 0xE4, 0x27,
+    0xA1, 0x83, 0xFC, 0x37, 0x2A, 0xC1, 0xD6, 0x4F, 0x4F, 0x0B, 0x29, 0x70, 0xA1, 0x87, 0xC7, 0x59,
+    0xD0, 0xE2, 0xA4, 0x88, 0x52, 0x11, 0xF5, 0xCC, 0x25, 0xF3, 0xAF, 0x26, 0xCC, 0xAE, 0x66, 0x29,
+    0xDE, 0xC1, 0xF6, 0x12, 0x35, 0x89, 0xC2, 0x22, 0x1C, 0x81, 0xA7, 0x45, 0x30, 0x16, 0xEF, 0x7D,
+    0xC0, 0x6A, 0x9C, 0x3A, 0xAC, 0xDE, 0x5D, 0xE1, 0xA1, 0x84, 0xC5, 0x10, 0x25, 0x74, 0xC2, 0xF1,
+    0xB4, 0x5F, 0xD1, 0x81, 0xF4, 0x96, 0x3C, 0x4E, 0xE6, 0x36, 0xA5, 0xF2, 0x93, 0x6B, 0x48, 0xF0,
+    0x79, 0x78, 0x6E, 0xB1, 0xFC, 0x86, 0x79, 0x13, 0xFB, 0x7B, 0x3E, 0xA2, 0xFB, 0xD8, 0x17, 0x4D,
+    0x45, 0xCD, 0x7F, 0x68, 0xB3, 0x27, 0xC3, 0xDE, 0x0F, 0x54, 0xEE, 0x22, 0xB4, 0xD4, 0xE6, 0x2E,
+    0xBA, 0xDB, 0x44, 0x67, 0xCD, 0x0D, 0x3A, 0x79, 0x2E, 0xB9, 0x16, 0xC6, 0x35, 0x67, 0xC2, 0x21,
+    0xE3, 0x8B, 0x88, 0xB3, 0xDF, 0x5B, 0x18, 0x8A, 0x34, 0x39, 0x39, 0xBA, 0x41, 0x1C, 0x0D, 0xFD,
+    0x33, 0x8C, 0xF5, 0xE4, 0xF4, 0xB2, 0x49, 0xBF, 0x99, 0x34, 0xCD, 0xBA, 0x9E, 0x72, 0x56, 0xC9,
+    0xC2, 0xAD, 0x3B, 0x14, 0x70, 0xDB, 0xBF, 0x46, 0xA6, 0x1E, 0x5B, 0x7D, 0xB9, 0x18, 0x24, 0xF5,
+    0x4C, 0x8B, 0xF4, 0xBC, 0x9A, 0xB6, 0xB4, 0x95, 0xDC, 0x9B, 0x26, 0x36, 0xC2, 0x2E, 0x4E, 0x4A,
+    0xF2, 0x0D, 0x8A, 0x5E, 0xB9, 0x83, 0x11, 0xCB, 0xD5, 0x8C, 0xD9, 0x27, 0xDC, 0xD7, 0x05, 0xAE,
+    0xF4, 0x86, 0x8D, 0xBF, 0xF7, 0xD9, 0x5F, 0x4D, 0x98, 0x90, 0x2C, 0xC7, 0x7F, 0xD5, 0x45, 0x4F,
+    0x5D, 0xF8, 0xE4, 0xEA, 0xA9, 0xE8, 0x62, 0x46, 0x5D, 0xCC, 0x08, 0x60, 0x46, 0xE2, 0x3B, 0x86,
+    0xEF, 0xE9, 0xD7, 0x6B, 0x9B, 0x8C, 0xA2, 0x09, 0xDD, 0x50, 0x17, 0xC4, 0xC3, 0x3C, 0x50, 0xB5,
+    0x19, 0x7F, 0x08, 0x5C, 0xBD, 0x45, 0x4C, 0x35, 0xF6, 0xA3, 0x8F, 0x33, 0xB0, 0xBD, 0xA7, 0x2E,
+    0x75, 0x6A, 0x50, 0xBD, 0x74, 0x38, 0x6D, 0x99, 0x88, 0x86, 0x70, 0xD7, 0x8D, 0x89, 0x9B, 0xA5,
+    0x31, 0x10, 0xC2, 0xFE, 0x56, 0x14, 0x67, 0x9B, 0xCA, 0x4B, 0xE3, 0xFD, 0xB7, 0xCA, 0xDB, 0x16,
+    0xDF, 0x6E, 0xE5, 0xCD, 0xFF, 0xAA, 0x58, 0xA2, 0x5C, 0x0E, 0x58, 0x36, 0x2F, 0x0F, 0xAF, 0xDB,
+    0x86, 0x87, 0x4F, 0x41, 0x46, 0x13, 0xAA, 0x29, 0x95, 0x62, 0x62, 0xF7, 0x56, 0x3F, 0xD2, 0xD1,
+    0xF7, 0xFC, 0x87, 0xBD, 0xA0, 0x1F, 0xFE, 0x82, 0xF4, 0xF3, 0x01, 0x9A, 0x1A, 0x34, 0x8D, 0xA7,
+    0xAF, 0x2E, 0x82, 0xAD, 0xF8, 0x2C, 0x61, 0x48, 0x2A, 0xA1, 0x10, 0x95, 0xA7, 0x51, 0xB3, 0x7E,
+    0xE5, 0x4F, 0x80, 0x8B, 0x7A, 0xE7, 0xB5, 0x55, 0x43, 0x72, 0xF3, 0xCA, 0x1C, 0xB0, 0x3C, 0x98,
+    0xE1, 0x5F, 0x82, 0x5B, 0x4C, 0x2C, 0xB7, 0xCB, 0xCB, 0x87, 0x24, 0x36, 0xB4, 0x35, 0xFF, 0x06,
+    0x81, 0x0D, 0x9C, 0xD9, 0x45, 0x1D, 0x4D, 0x56, 0x59, 0xCF, 0x73, 0x25, 0x25, 0x4D, 0xC2, 0x05,
+    0x1F, 0x4B, 0xB0, 0x95, 0x15, 0xDD, 0xD0, 0x8C, 0x37, 0x24, 0x22, 0x19, 0x0B, 0xC8, 0x7A, 0x05,
+    0x59, 0x2F, 0xA3, 0xAF, 0x18, 0xEF, 0x69, 0x21, 0x1E, 0x98, 0xB6, 0x9F, 0xA6, 0x34, 0xDC, 0x94,
+    0x73, 0xC7, 0xFE, 0x3B, 0x31, 0x6D, 0xD3, 0x6E, 0xDA, 0x4C, 0x13, 0x5B, 0xC9, 0x50, 0xB3, 0x3B,
+    0x73, 0x30, 0x75, 0xB1, 0xA7, 0xFF, 0xC7, 0xEB, 0x4F, 0x85, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14,
+    0xFE, 0x76, 0x26, 0xC9, 0x4A, 0x59, 0x29, 0x93, 0x82, 0x0A, 0x2B, 0xDE, 0x14, 0x29, 0x52, 0xD8,
+    0xD9, 0xD6, 0x85, 0xF7, 0x76, 0x42, 0x01, 0x74, 0xA4, 0x39, 0x28, 0x28, 0x4C, 0x41, 0x11, 0x90,
+    0x90, 0x9B, 0x14, 0x8E, 0x74, 0xF6, 0x2D, 0x4A, 0x91, 0x02, 0xA4, 0x58, 0x48, 0xD0, 0x20, 0x41,
+    0x90, 0x28, 0x90, 0x0B, 0xEC, 0x22, 0x05, 0xC5, 0x39, 0x37, 0x21, 0x65, 0x9A, 0x95, 0x02, 0x4A,
+    0x91, 0x82, 0x45, 0x04, 0x28, 0x90, 0x60, 0x04, 0x2B, 0xBC, 0x84, 0xBD, 0x1B, 0xBE, 0x99, 0xB5,
+    0x03, 0x28, 0x12, 0xAC, 0x6E, 0x7D, 0xDE, 0x9D, 0x37, 0xEF, 0xBD, 0xEF, 0xE7, 0xCD, 0x61, 0xE1,
+    0x11, 0x84, 0xEB, 0x50, 0x7C, 0xD0, 0x89, 0x26, 0x6A, 0xD3, 0x52, 0xDA, 0x09, 0x92, 0xBB, 0x35,
+    0xB2, 0x54, 0x63, 0x32, 0x82, 0xFC, 0xD5, 0x42, 0xBD, 0x63, 0xB0, 0x99, 0x42, 0xDA, 0x2D, 0xA4,
+    0x7A, 0x26, 0x5A, 0x38, 0x57, 0x62, 0xDA, 0x20, 0x5C, 0xE7, 0x93, 0x1A, 0x2A, 0x75, 0x3A, 0xFE,
+    0xE6, 0x55, 0x2B, 0xE6, 0xD8, 0xC7, 0x94, 0x41, 0x05, 0x64, 0xA5, 0x4A, 0x34, 0x71, 0x85, 0x4D,
+    0x61, 0x91, 0xA1, 0x83, 0x32, 0x03, 0xC8, 0x5A, 0x95, 0xC2, 0xC6, 0x36, 0x6A, 0xC5, 0x3C, 0xEA,
+    0xF0, 0x98, 0x75, 0xF3, 0xAC, 0x65, 0xFC, 0x25, 0xC4, 0x06, 0x60, 0x24, 0xD0, 0xF2, 0xCE, 0x79,
+    0xA7, 0xBC, 0x13, 0xE3, 0x2B, 0x2C, 0xD4, 0xE7, 0x31, 0xED, 0x46, 0x72, 0xB6, 0xD6, 0x26, 0x75,
+    0xDC, 0x28, 0x23, 0x6D, 0xC6, 0x66, 0x58, 0xA3, 0xF6, 0x29, 0x37, 0x11, 0x57, 0x6C, 0xD9, 0x4C,
+    0x58, 0x62, 0x82, 0xAC, 0x1C, 0x61, 0xAA, 0x0B, 0xF1, 0x8B, 0xCE, 0xDC, 0xC7, 0x48, 0x66, 0x19,
+    0xA0, 0x07, 0x87, 0x29, 0x47, 0xBC, 0x27, 0xBC, 0xBB, 0xC3, 0x32, 0x44, 0x70, 0x33, 0xD3, 0xAB,
+    0x63, 0x93, 0x6E, 0xBD, 0x96, 0xB4, 0x10, 0x5D, 0x58, 0x62, 0x34, 0xA1, 0xB3, 0xB4, 0xB4, 0x21,
+    0x2C, 0x0F, 0xBD, 0xF8, 0xE7, 0xBA, 0xDF, 0xB6, 0xFE, 0x08, 0x53, 0x67, 0x6E, 0x3F, 0x5F, 0x15,
+    0x00, 0x41, 0xFA, 0xB0, 0x31, 0x37, 0x70, 0x69, 0x6C, 0x42, 0x12, 0x6E, 0xF7, 0xB1, 0xCD, 0x39,
+    0x74, 0xCA, 0xCD, 0x23, 0x37, 0x43, 0xA4, 0x03, 0x57, 0xB1, 0x86, 0x27, 0x63, 0xE1, 0xF1, 0x87,
+    0x6E, 0xB6, 0xF0, 0xB5, 0xF6, 0x1D, 0x33, 0xA3, 0xD2, 0x91, 0x7F, 0xCB, 0x3C, 0x84, 0x43, 0xC2,
+    0x88, 0x07, 0x45, 0x17, 0x39, 0x03, 0x0D, 0xB1, 0x8D, 0xCB, 0x7C, 0x9C, 0x90, 0x9E, 0x96, 0x2D,
+    0x34, 0xAA, 0x8C, 0xAC, 0xD2, 0xC2, 0xA6, 0x5A, 0xD6, 0xDC, 0x52, 0x17, 0x0C, 0x1E, 0xB0, 0xB9,
+    0x9C, 0xA9, 0x36, 0x03, 0xF8, 0xB1, 0xDE, 0x22, 0xF8, 0xC2, 0xDD, 0x80, 0x9A, 0xB1, 0x6F, 0x16,
+    0xBE, 0x0C, 0xF1, 0x89, 0x45, 0xFA, 0x82, 0x61, 0x3B, 0x3A, 0xAE, 0x72, 0x14, 0x68, 0xA2, 0xC6,
+    0x6B, 0xA1, 0x4A, 0x12, 0xC6, 0x56, 0x27, 0x19, 0x22, 0xDB, 0x22, 0xBE, 0x67, 0xA0, 0x08, 0x77,
+    0x40, 0x44, 0x8E, 0x18, 0x08, 0xE5, 0x3C, 0x9E, 0xC5, 0x89, 0xEB, 0x46, 0x36, 0x68, 0x3D, 0xAF,
+    0x29, 0x65, 0xBD, 0x25, 0x6D, 0x2E, 0x7E, 0xD2, 0x9B, 0xB2, 0x5A, 0xBD, 0xA5, 0x4C, 0x1E, 0xDF,
+    0x2B, 0x1B, 0x59, 0x35, 0x5F, 0x64, 0xC8, 0xD3, 0xE4, 0x5A, 0x25, 0xEF, 0x57, 0x1B, 0x13, 0xE4,
+    0xA3, 0xF8, 0x46, 0x29, 0x1F, 0xEA, 0xAB, 0x16, 0xB9, 0x8D, 0x3F, 0x87, 0x9C, 0x7B, 0x6E, 0x0A,
+    0x23, 0xC9, 0x72, 0xCB, 0xFA, 0xBE, 0xA9, 0x93, 0x5A, 0x69, 0x65, 0x84, 0x25, 0x07, 0x23, 0x42,
+    0x53, 0xD7, 0x2B, 0x44, 0x07, 0xA4, 0xAD, 0xE0, 0x9D, 0xB0, 0x03, 0xC6, 0xD2, 0x99, 0xE0, 0x4B,
+    0x2E, 0x34, 0xD4, 0xAD, 0x55, 0x1A, 0x1D, 0x3D, 0xD2, 0x91, 0xA2, 0x7D, 0xCF, 0x3C, 0x81, 0xDD,
+    0x24, 0x75, 0x29, 0x41, 0x79, 0x83, 0xF9, 0xAF, 0x81, 0x4F, 0xDE, 0xF2, 0x25, 0xF3, 0x96, 0xC1,
+    0x14, 0x48, 0xBD, 0x16, 0xAB, 0xF4, 0x01, 0x08, 0x11, 0xF2, 0x21, 0x3D, 0xA5, 0x36, 0xF9, 0x94,
+    0x79, 0xB7, 0x51, 0x38, 0x44, 0xDE, 0x0F, 0xDC, 0x1B, 0xA4, 0xEF, 0x4D, 0x98, 0x96, 0xFD, 0x6B,
+    0x41, 0x11, 0x82, 0xB2, 0xBC, 0xDE, 0xDC, 0xD9, 0xA6, 0x9A, 0x18, 0xAE, 0xB1, 0x9D, 0x36, 0xC4,
+    0xAA, 0xDE, 0x23, 0xFB, 0x4F, 0x14, 0xE7, 0x8E, 0x22, 0x58, 0x25, 0xA2, 0xB5, 0x0A, 0xD7, 0xC5,
+    0xCE, 0xEF, 0x7F, 0x0B, 0x72, 0x86, 0xE4, 0x91, 0xEF, 0x58, 0x05, 0x2F, 0x5D, 0x08, 0xBB, 0xF3,
+    0x60, 0xC8, 0x16, 0x0B, 0x16, 0xE3, 0xD2, 0x7F, 0xD8, 0x82, 0xA8, 0x7D, 0x1E, 0x9A, 0x40, 0x1A,
+    0x3F, 0x11, 0x9E, 0x96, 0xD2, 0x7F, 0xB8, 0xDB, 0xD3, 0xF1, 0x3A, 0xA2, 0x1F, 0x3F, 0xBA, 0xFA,
+    0xF4, 0x87, 0xA5, 0x4F, 0x69, 0xC4, 0xDE, 0x81, 0xF0, 0xBB, 0xE9, 0x32, 0x9F, 0x3B, 0xEB, 0xFD,
+    0xD9, 0x3F, 0xAF, 0x86, 0x7E, 0x39, 0x9D, 0x98, 0x96, 0xB8, 0xAD, 0xFD, 0x3A, 0xFB, 0x20, 0xA5,
+    0x2C, 0x45, 0xBE, 0xFC, 0x60, 0xF4, 0xCE, 0xDF, 0xF5, 0x42, 0x51, 0x9D, 0x00, 0x5A, 0xB8, 0x52,
+    0x38, 0xF7, 0xC3, 0x3C, 0x9A, 0xCE, 0x80, 0x37, 0xFC, 0x96, 0xD4, 0xC4, 0x16, 0xFD, 0xEC, 0x9F,
+    0x80, 0x30, 0x4C, 0xBD, 0x8A, 0x45, 0x24, 0x5A, 0x56, 0xCC, 0x32, 0x21, 0x7E, 0x55, 0xC6, 0x95,
+    0x68, 0xC8, 0x45, 0x81, 0xE3, 0x7D, 0x12, 0x5C, 0x01, 0x96, 0xD9, 0xCE, 0xA7, 0x9C, 0x1B, 0xB8,
+    0x97, 0x4B, 0xA6, 0xDA, 0x0A, 0x4C, 0xF5, 0x73, 0xE6, 0x19, 0xEF, 0x99, 0x53, 0xFD, 0xC3, 0x18,
+    0xA7, 0x93, 0x79, 0x87, 0xE9, 0x1C, 0xF2, 0x2B, 0xA0, 0x0E, 0xFB, 0x8F, 0xE1, 0xE8, 0xF2, 0x07,
+    0xCF, 0xD8, 0xF1, 0xD0, 0xA9, 0x96, 0x7A, 0xB1, 0x06, 0x47, 0xF2, 0x8D, 0x8E, 0x8E, 0x0C, 0x2F,
+    0x18, 0x91, 0x53, 0x82, 0x19, 0x82, 0x06, 0xF2, 0x28, 0x4E, 0x1E, 0xC5, 0xF9, 0x65, 0xBF, 0x3B,
+    0xDA, 0x1F, 0x0E, 0x39, 0x2D, 0xAE, 0x95, 0xCE, 0x39, 0x7D, 0x1A, 0xD1, 0xE2, 0xC9, 0xF7, 0xEE,
+    0x3B, 0x67, 0x8B, 0x57, 0x9A, 0x14, 0xCB, 0x84, 0x75, 0x97, 0x10, 0x6F, 0x61, 0x75, 0x11, 0x8B,
+    0xB2, 0x4E, 0xC9, 0xC5, 0xB7, 0xBF, 0xCF, 0xB7, 0xCE, 0x42, 0x78, 0x79, 0xD4, 0xDB, 0x36, 0x8C,
+    0x5E, 0xCC, 0xB3, 0x4E, 0xD6, 0xC2, 0x32, 0xDF, 0x2A, 0x95, 0x57, 0x9A, 0x2E, 0xAF, 0xC9, 0xE7,
+    0x88, 0x85, 0x14, 0xAB, 0x4A, 0xE7, 0x5B, 0x99, 0x23, 0x65, 0x85, 0x27, 0x07, 0xDD, 0xCE, 0xFC,
+    0xB3, 0xF0, 0xF2, 0xF8, 0xDA, 0x10, 0xFF, 0x3E, 0xFD, 0x9E, 0x68, 0x1C, 0xE0, 0x2E, 0xFE, 0xAD,
+    0x31, 0x9E, 0x21, 0x89, 0xAE, 0x94, 0xF3, 0x29, 0xA5, 0x3D, 0xE6, 0x63, 0x3D, 0xAE, 0x98, 0x7C,
+    0x24, 0xA4, 0x94, 0x74, 0x25, 0x66, 0x46, 0x70, 0x9C, 0x91, 0xC8, 0x26, 0x26, 0x29, 0xD3, 0x32,
+    0x47, 0xF6, 0xA0, 0x42, 0xCA, 0xD5, 0xA4, 0xE9, 0xA3, 0xA9, 0x36, 0x2D, 0x78, 0x96, 0xE6, 0x26,
+    0x2F, 0xC2, 0xB5, 0x87, 0xA4, 0xA6, 0xF2, 0xE1, 0x9D, 0x66, 0xFB, 0xDC, 0xE1, 0x13, 0x8B, 0xF0,
+    0xCF, 0xF7, 0xBB, 0xC1, 0x7B, 0x99, 0xF6, 0xA4, 0xE5, 0xE0, 0xE9, 0xAE, 0xED, 0x99, 0x88, 0xAE,
+    0xBE, 0x66, 0x06, 0x91, 0x5E, 0x5A, 0xF1, 0x3E, 0x7F, 0xA0, 0x99, 0xF7, 0xD4, 0x1E, 0x7D, 0x8D,
+    0x3F, 0xBD, 0xCB, 0x54, 0xF8, 0xF7, 0x20, 0xBC, 0x5D, 0x49, 0x4A, 0x44, 0xF7, 0x79, 0x2C, 0x61,
+    0x69, 0x99, 0x3F, 0x31, 0xD2, 0xD8, 0xD8, 0x69, 0xEB, 0xA1, 0xE6, 0x5E, 0x79, 0xCE, 0x58, 0xF1,
+    0xFE, 0x3A, 0x53, 0xAF, 0x3B, 0x2F, 0xCA, 0xF1, 0xC3, 0xD2, 0xEF, 0xAA, 0xDD, 0x2F, 0xAB, 0x8D,
+    0x95, 0xF8, 0xBA, 0xBE, 0xB2, 0x97, 0x24, 0xE4, 0x7E, 0x20, 0x7F, 0xAE, 0xD2, 0x17, 0x81, 0xD3,
+    0x11, 0x52, 0x51, 0xA5, 0xC2, 0x66, 0xCF, 0xD9, 0xEC, 0x62, 0x93, 0x5D, 0xE4, 0x81, 0xD8, 0xA1,
+    0xC9, 0x78, 0x82, 0x55, 0x92, 0xBF, 0x00, 0x23, 0x1E, 0x27, 0x91, 0x67, 0x09, 0xC3, 0xE1, 0xF0,
+    0x25, 0xAA, 0x39, 0xA5, 0x8C, 0x61, 0xDE, 0xA2, 0x7F, 0x7D, 0x81, 0x72, 0x2B, 0x77, 0x67, 0x78,
+    0xE9, 0x3F, 0xC1, 0x66, 0x7F, 0xC0, 0x9E, 0x91, 0xAE, 0x25, 0xD8, 0x3C, 0x31, 0x4B, 0x2B, 0xB2,
+    0xCA, 0x09, 0x36, 0x97, 0xD5, 0xA9, 0x3D, 0x59, 0x8D, 0x08, 0xB6, 0x70, 0x5A, 0xED, 0x49, 0xB6,
+    0x7E, 0xA0, 0xF3, 0x94, 0x60, 0x65, 0xD5, 0x12, 0x6C, 0x1E, 0x9B, 0xA5, 0x65, 0x59, 0x0D, 0x08,
+    0x36, 0x47, 0xF3, 0x7F, 0x60, 0x13, 0xE7, 0x7E, 0x73, 0xCE, 0x0F, 0xD3, 0xB8, 0x4E, 0x77, 0xEF,
+    0x9A, 0x0B, 0x1B, 0x38, 0x28, 0xD5, 0x06, 0xBE, 0xAB, 0x72, 0xE5, 0xCA, 0x6C, 0x3B, 0xC4, 0x79,
+    0x56, 0xFF, 0xF9, 0x35, 0x5C, 0x1F, 0xAE, 0x11, 0xDD, 0xCE, 0xEE, 0xCE, 0xCD, 0xA7, 0xD6, 0x70,
+    0x32, 0xE4, 0x75, 0xFD, 0xC5, 0x31, 0x1F, 0x77, 0x82, 0x67, 0xCA, 0x22, 0x44, 0x45, 0x63, 0x28,
+    0x3A, 0x35, 0x0C, 0xE9, 0x05, 0x56, 0x6E, 0x38, 0x8B, 0xBC, 0xFE, 0x02, 0xB5, 0x55, 0x31, 0x8F,
+    0xDC, 0x44, 0x18, 0x7D, 0xF6, 0x24, 0x71, 0x61, 0xE9, 0x26, 0x45, 0x40, 0x47, 0x91, 0x33, 0x05,
+    0x0D, 0xD2, 0x11, 0xB7, 0x87, 0xE4, 0x5D, 0x9B, 0x5C, 0x49, 0xC1, 0x15, 0xA4, 0xE6, 0x27, 0x40,
+    0x91, 0x62, 0x41, 0x9B, 0x5D, 0x9F, 0xAE, 0xB8, 0x7F, 0x81, 0xAE, 0x65, 0x29, 0xAE, 0xD9, 0xE2,
+    0x8A, 0xE5, 0x76, 0x48, 0x0A, 0x0A, 0x0A, 0xDC, 0x20, 0x2A, 0x14, 0x47, 0x74, 0x5C, 0x91, 0x01,
+    0x59, 0x3A, 0x2B, 0x78, 0xD7, 0xBC, 0x6F, 0xC6, 0x07, 0xA9, 0x22, 0x1A, 0xAC, 0x1B, 0xDB, 0xE7,
+    0x99, 0xF9, 0xDE, 0xFB, 0xDE, 0xF7, 0xBE, 0xD9, 0xE0, 0x12, 0xEB, 0x2E, 0x08, 0x2B, 0xEC, 0x41,
+    0x99, 0xB7, 0x1B, 0xD5, 0x21, 0xB0, 0x88, 0x4A, 0x4C, 0x0A, 0xFD, 0xF1, 0x95, 0xFD, 0xBC, 0x05,
+    0xAF, 0x23, 0x6D, 0x56, 0x91, 0x99, 0xA2, 0x00, 0xDE, 0x47, 0x58, 0xAA, 0x0A, 0x2B, 0x3C, 0x81,
+    0x36, 0xB1, 0x41, 0xCB, 0x57, 0x5D, 0xE8, 0x92, 0x9B, 0x1A, 0xA4, 0x48, 0xA0, 0xEA, 0xD0, 0x62,
+    0x84, 0x1C, 0x51, 0xA5, 0x6A, 0x74, 0x7C, 0x4D, 0x4D, 0x54, 0x45, 0x2D, 0xD6, 0xE1, 0xCB, 0x42,
+    0xF7, 0xAD, 0xC5, 0xF5, 0x56, 0x23, 0xB9, 0x05, 0xC1, 0x01, 0xB7, 0x80, 0x5B, 0x78, 0x1B, 0x71,
+    0x44, 0x86, 0xB7, 0x15, 0x86, 0x2B, 0xE8, 0xFB, 0x2E, 0xE6, 0x48, 0xFA, 0x76, 0x3F, 0xE5, 0xC8,
+    0xDF, 0x30, 0x64, 0x0D, 0x83, 0xEF, 0x87, 0x1C, 0xB8, 0x3D, 0xD9, 0x07, 0x0E, 0xFE, 0xE3, 0x78,
+    0x6F, 0x77, 0x37, 0xF9, 0xF1, 0xCF, 0xF6, 0x1E, 0xB3, 0xBF, 0x8F, 0x4B, 0x64, 0xF8, 0xE3, 0xFC,
+    0xB4, 0x01, 0xCE, 0x92, 0xA7, 0xFD, 0xDE, 0x24, 0xAC, 0x34, 0xB2, 0xC0, 0xC6, 0xE5, 0x07, 0xB0,
+    0xCA, 0xEC, 0x09, 0xAB, 0x75, 0xF1, 0xAA, 0x59, 0xEE, 0x1C, 0xA8, 0x5F, 0x71, 0x5D, 0x7C, 0x58,
+    0xDD, 0x9F, 0x68, 0xFD, 0x12, 0x33, 0x84, 0x38, 0x0A, 0xEB, 0x0C, 0xD3, 0xB8, 0xD4, 0xC7, 0x36,
+    0xB0, 0x63, 0x8C, 0x23, 0xA3, 0x4D, 0xAB, 0xCD, 0x26, 0x16, 0xE9, 0x56, 0xAA, 0x5A, 0x05, 0x55,
+    0xE6, 0xF3, 0xDA, 0x65, 0xE6, 0x91, 0xA5, 0x6A, 0x6B, 0xCA, 0x17, 0x7D, 0x0D, 0xAA, 0xB8, 0xC4,
+    0x14, 0xAA, 0xA2, 0xAE, 0x1A, 0x0F, 0x20, 0x88, 0x08, 0x6A, 0x8D, 0xB3, 0xB8, 0x68, 0xB4, 0xC9,
+    0xE2, 0x72, 0x0D, 0x3B, 0x8D, 0x2E, 0xD4, 0x89, 0xF9, 0xAA, 0xC2, 0x48, 0xFD, 0x04, 0x42, 0x65,
+    0x48, 0x94, 0xA9, 0x61, 0xD3, 0xF3, 0x5A, 0x17, 0x7D, 0x6F, 0x2E, 0x00, 0x4B, 0xF9, 0x94, 0x21,
+    0xC8, 0x8E, 0x60, 0xC0, 0x62, 0x0E, 0xD6, 0x84, 0x20, 0x17, 0xF8, 0xB2, 0x26, 0x00, 0x51, 0x32,
+    0xD1, 0x99, 0x4A, 0x3B, 0x18, 0x65, 0x12, 0x08, 0xCE, 0x9D, 0x16, 0x4B, 0xFD, 0x49, 0x4F, 0xA0,
+    0xE3, 0xC2, 0x6A, 0x06, 0xC9, 0x88, 0xC4, 0x25, 0xA4, 0x13, 0x97, 0x61, 0x4D, 0x7E, 0xE4, 0x43,
+    0x92, 0xBC, 0x95, 0x0C, 0xA8, 0x4B, 0x06, 0xD4, 0x05, 0x03, 0xEA, 0xDE, 0x66, 0x50, 0x3D, 0x1D,
+    0xB3, 0x2E, 0x68, 0x99, 0xF9, 0x86, 0xA0, 0x61, 0x50, 0x0B, 0xC0, 0x8E, 0xAC, 0x0D, 0x2B, 0x6E,
+    0x7C, 0xAB, 0x25, 0x6A, 0xB8, 0x91, 0x1D, 0x41, 0xC3, 0x68, 0x84, 0x9D, 0x86, 0x25, 0x32, 0x4D,
+    0x6F, 0xC4, 0x27, 0x55, 0x7E, 0x7A, 0x65, 0x2F, 0xE2, 0x65, 0xDA, 0x26, 0xE1, 0x73, 0xCE, 0x55,
+    0x13, 0x9A, 0xA2, 0xDD, 0x61, 0x06, 0x0F, 0xD4, 0xF7, 0x35, 0x0D, 0xB1, 0x5D, 0x13, 0x53, 0x13,
+    0x63, 0x4C, 0x5D, 0x84, 0x45, 0x24, 0x56, 0xC3, 0x63, 0xEA, 0xC8, 0x8C, 0x36, 0x08, 0x3A, 0xAE,
+    0xBF, 0x71, 0xCC, 0x19, 0xD3, 0x11, 0xDA, 0xDA, 0x30, 0x77, 0xCE, 0xC4, 0x35, 0x92, 0x52, 0x76,
+    0x4E, 0x9D, 0xAD, 0xF8, 0x37, 0xC3, 0xBB, 0xF9, 0x55, 0x9B, 0xF4, 0x4D, 0xF0, 0x8D, 0x38, 0x8C,
+    0x86, 0x0E, 0x58, 0x6C, 0xBA, 0x55, 0xB0, 0x7D, 0x4C, 0x04, 0x43, 0xB4, 0x88, 0x1F, 0x14, 0x63,
+    0x87, 0x5B, 0xFE, 0xF3, 0x17, 0xAD, 0xF9, 0x1D, 0x81, 0x47, 0x5C, 0x91, 0x6B, 0x20, 0x39, 0x14,
+    0x98, 0x86, 0x8B, 0xC6, 0xF4, 0xAF, 0xF8, 0x9F, 0xB6, 0xA7, 0x59, 0xB1, 0xEE, 0x7B, 0xE4, 0x8B,
+    0x6F, 0x4D, 0xCA, 0xC8, 0x94, 0x6A, 0x44, 0x2E, 0xFA, 0x94, 0xAC, 0x7E, 0xE3, 0xE6, 0x4D, 0xE3,
+    0x0D, 0x1F, 0x1C, 0xF1, 0x46, 0x66, 0x9E, 0xBA, 0x96, 0x97, 0xE5, 0x6B, 0xC0, 0x60, 0x73, 0x79,
+    0x68, 0xA4, 0xF5, 0x80, 0x1D, 0x3F, 0x87, 0x07, 0x57, 0xD6, 0x7A, 0x74, 0x74, 0x94, 0x54, 0xE0,
+    0x99, 0x60, 0x0B, 0x87, 0xAF, 0x69, 0x04, 0x47, 0x40, 0xBD, 0x5A, 0xAC, 0x20, 0x0C, 0x38, 0xA3,
+    0x2A, 0xA1, 0x50, 0xCE, 0xB8, 0x4E, 0x71, 0x6B, 0x97, 0x14, 0x08, 0xA5, 0xF3, 0xEE, 0x09, 0xB4,
+    0xD4, 0xA3, 0x17, 0x1E, 0xF4, 0xCF, 0x88, 0x87, 0x40, 0x80, 0x5B, 0x03, 0x05, 0x2E, 0xF3, 0x14,
+    0x58, 0x00, 0x68, 0x4A, 0x17, 0x5E, 0x1B, 0xCF, 0x40, 0x3F, 0x33, 0x8C, 0xCC, 0x22, 0xE7, 0x94,
+    0xCC, 0x11, 0x68, 0xD9, 0xC1, 0x09, 0xF1, 0x54, 0xDF, 0x5B, 0x87, 0xAF, 0x7F, 0x5F, 0x08, 0x9F,
+    0xA4, 0xE0, 0x64, 0x23, 0xF0, 0xC7, 0x8C, 0xD4, 0x52, 0x65, 0xFD, 0x43, 0xE5, 0xEA, 0x10, 0x14,
+    0x84, 0x4F, 0x1A, 0xFA, 0x71, 0xDC, 0x53, 0x94, 0xC7, 0x09, 0x89, 0xDC, 0xFD, 0x27, 0x7F, 0x57,
+    0x13, 0x07, 0x1E, 0x3B, 0x81, 0xE4, 0x48, 0x48, 0xA7, 0x83, 0x00, 0xE8, 0x32, 0x78, 0x7C, 0x65,
+    0x47, 0xF0, 0x04, 0x74, 0xC9, 0x9B, 0x30, 0x40, 0x4E, 0x74, 0x47, 0x01, 0xDB, 0xC5, 0x39, 0x1C,
+    0x07, 0x92, 0xE3, 0x09, 0x25, 0x1A, 0x50, 0x72, 0x5D, 0x0A, 0x0B, 0x43, 0x81, 0xE9, 0x25, 0xA6,
+    0xCB, 0x2C, 0x1B, 0x09, 0x70, 0x48, 0x02, 0x47, 0xBB, 0xF8, 0xF7, 0xF2, 0xBE, 0x28, 0x07, 0x0A,
+    0x52, 0x02, 0x61, 0xA0, 0x7E, 0x31, 0x9E, 0x80, 0x54, 0xC0, 0xE1, 0x3F, 0x91, 0xF0, 0x84, 0x77,
+    0x05, 0x10, 0xF4, 0x58, 0x44, 0x10, 0x70, 0xD1, 0xDF, 0x61, 0x8B, 0x45, 0x05, 0xFA, 0x44, 0xE4,
+    0x1F, 0x90, 0xD9, 0x43, 0x3E, 0xEA, 0x17, 0x07, 0xC0, 0x3E, 0xFD, 0x1E, 0x9D, 0x16, 0x5E, 0xEB,
+    0xE0, 0x75, 0x02, 0xDB, 0xA1, 0x00, 0x63, 0xEB, 0xF1, 0xF5, 0x67, 0x5E, 0xFF, 0xA8, 0x6A, 0x1C,
+    0xBC, 0xF3, 0x98, 0xC8, 0x3F, 0xA5, 0xAA, 0x82, 0x9E, 0xD2, 0x02, 0xA2, 0x3E, 0x31, 0x1C, 0xB3,
+    0x43, 0x0B, 0xF5, 0x42, 0xC4, 0x27, 0x89, 0xFC, 0x06, 0x3B, 0x15, 0xA3, 0x3A, 0xAD, 0xE4, 0xB1,
+    0xD9, 0x3C, 0xFA, 0x54, 0xE0, 0x5C, 0x1B, 0xA9, 0x17, 0x02, 0x0B, 0xFD, 0xD4, 0x3A, 0x13, 0x3C,
+    0x74, 0x8F, 0xDC, 0x9D, 0xD0, 0x58, 0xB9, 0x16, 0x09, 0xDA, 0xA8, 0xEF, 0x4B, 0xA2, 0xC7, 0xF2,
+    0x88, 0x2B, 0xFD, 0xF3, 0x23, 0x2E, 0x94, 0x77, 0x17, 0x91, 0x59, 0xE0, 0x72, 0xB1, 0x86, 0x33,
+    0xB7, 0x3B, 0xDD, 0xAD, 0x6B, 0x2F, 0x76, 0xD3, 0x58, 0x02, 0x1B, 0xCC, 0x08, 0xC7, 0x89, 0x39,
+    0xC1, 0x67, 0x52, 0xAB, 0x6E, 0x48, 0x78, 0xBE, 0x2D, 0x78, 0xE4, 0xDB, 0x70, 0xFB, 0xD1, 0x24,
+    0xE4, 0x37, 0xE9, 0x6C, 0xC8, 0x98, 0x0D, 0x0D, 0x2A, 0x7D, 0x22, 0x3D, 0xE9, 0xDC, 0xDB, 0xDD,
+    0x7C, 0x34, 0x0E, 0xC1, 0xFF, 0x6C, 0x48, 0x4B, 0x29, 0xE1, 0x3F, 0x2F, 0xDF, 0x81, 0xA3, 0x37,
+    0xEF, 0x2B, 0x39, 0x04, 0xFD, 0x81, 0x91, 0x0A, 0x45, 0x59, 0xCB, 0xFA, 0xDD, 0xB9, 0x24, 0xC2,
+    0x06, 0x43, 0x33, 0xBA, 0x90, 0xAD, 0x9F, 0x81, 0x1C, 0xF3, 0xB7, 0x07, 0x4A, 0xAE, 0xA1, 0x3B,
+    0x88, 0x42, 0x8D, 0x2F, 0x89, 0x2C, 0x95, 0x21, 0x92, 0x88, 0x1E, 0x22, 0x06, 0xA1, 0x0A, 0x91,
+    0x41, 0x18, 0xB2, 0x29, 0xE9, 0x44, 0xDF, 0xE7, 0xE3, 0x61, 0x48, 0xC6, 0x37, 0xA1, 0x78, 0x51,
+    0xED, 0xB0, 0xF1, 0xB9, 0xC8, 0x6A, 0xF9, 0xE5, 0xBB, 0xFB, 0x7F, 0xE2, 0xBD, 0xF1, 0xFA, 0x1B,
+    0xBD, 0x55, 0x3D, 0x8F, 0xD4, 0x30, 0x10, 0x7D, 0x8E, 0x39, 0x7C, 0x52, 0x0A, 0x53, 0x1C, 0x2D,
+    0x69, 0x28, 0x28, 0x10, 0xF9, 0x03, 0x5C, 0x12, 0x6A, 0x0A, 0x28, 0x38, 0x1A, 0x7E, 0x04, 0x7F,
+    0x60, 0xD9, 0x75, 0x4F, 0xC3, 0x4F, 0xA1, 0xA0, 0xA0, 0x08, 0x6C, 0x04, 0x05, 0x25, 0x41, 0x88,
+    0x9A, 0x48, 0x40, 0x6F, 0xB8, 0x20, 0xE5, 0x74, 0xD9, 0x35, 0x6F, 0x9C, 0xCB, 0xC2, 0x51, 0xC3,
+    0x59, 0x72, 0x14, 0xC7, 0xF3, 0xF1, 0x66, 0xE6, 0xCD, 0x04, 0xD8, 0x03, 0x50, 0x56, 0x40, 0x68,
+    0xA0, 0xBF, 0x74, 0xB0, 0x95, 0xC7, 0x25, 0x5C, 0x81, 0xAC, 0x55, 0x18, 0xB1, 0xE6, 0xDE, 0x1C,
+    0x3D, 0x40, 0x0F, 0x28, 0xEE, 0xC4, 0x4F, 0x5B, 0x77, 0xDC, 0x2D, 0x60, 0x42, 0x70, 0x69, 0x08,
+    0x95, 0xFD, 0x74, 0x04, 0xEB, 0x40, 0x75, 0x20, 0xA3, 0x6A, 0xCE, 0x5D, 0x9C, 0xED, 0x25, 0xD5,
+    0x67, 0x53, 0x5C, 0x57, 0xA0, 0x9B, 0x1E, 0x86, 0x3B, 0xA9, 0xEE, 0x63, 0x5E, 0xFF, 0xC3, 0x17,
+    0x43, 0xD3, 0xD4, 0x7F, 0x02, 0xA4, 0x0D, 0xF0, 0x02, 0x0C, 0x4C, 0x16, 0xAF, 0x56, 0xDB, 0xE8,
+    0xA1, 0x8E, 0xCA, 0xB4, 0x45, 0xF3, 0xCA, 0xC7, 0x73, 0xF9, 0xD7, 0xB9, 0x88, 0x7E, 0x4C, 0x1B,
+    0x91, 0xD4, 0x48, 0x42, 0xA7, 0x62, 0x18, 0x8A, 0xCE, 0xC7, 0xA8, 0x6E, 0x68, 0xDB, 0xCF, 0xB6,
+    0x75, 0xF0, 0x62, 0x7C, 0xF6, 0x59, 0x47, 0x6B, 0x12, 0x50, 0x36, 0xC5, 0x52, 0x4E, 0xE1, 0x1C,
+    0x4E, 0x6A, 0x7F, 0x5C, 0x57, 0xF1, 0x9A, 0xE6, 0xF2, 0x2D, 0x03, 0xE5, 0x2B, 0x1E, 0xF0, 0x6B,
+    0x03, 0x23, 0x48, 0x3D, 0x16, 0xA6, 0xD9, 0x9B, 0x5C, 0xFC, 0x43, 0x0F, 0x8C, 0xC2, 0xDF, 0x46,
+    0x4E, 0x39, 0x77, 0x7D, 0xAE, 0x43, 0x19, 0x78, 0xD9, 0x49, 0xC0, 0xA2, 0x2B, 0x1E, 0x86, 0x98,
+    0x01, 0x35, 0xE9, 0x4A, 0x3E, 0x8B, 0xA9, 0x1C, 0x8B, 0x73, 0xD7, 0x7D, 0xBC, 0xA6, 0x07, 0x66,
+    0x88, 0x15, 0xA0, 0xA5, 0x2C, 0x3C, 0x03, 0xEB, 0x30, 0x40, 0xFF, 0x7C, 0x3C, 0x10, 0x85, 0xE9,
+    0x89, 0x59, 0x7B, 0x8A, 0xA4, 0x0D, 0x15, 0xB3, 0xAA, 0x10, 0x53, 0xD4, 0x1B, 0x1E, 0x7D, 0xBB,
+    0xAF, 0xBF, 0xB0, 0xB8, 0xD9, 0xBD, 0xB0, 0xC1, 0x2B, 0xA2, 0xD7, 0x9E, 0x26, 0xAD, 0xA3, 0x87,
+    0x57, 0x14, 0x37, 0x9E, 0x21, 0xAC, 0x28, 0x9B, 0xF6, 0xEA, 0xE4, 0x61, 0xA8, 0xC8, 0x83, 0x0E,
+    0x79, 0xF8, 0x2A, 0x70, 0xF7, 0x84, 0xAA, 0x65, 0xF7, 0x5C, 0x3C, 0x31, 0xEA, 0x6E, 0x45, 0x44,
+    0xD5, 0x1C, 0x0B, 0x53, 0x74, 0x0B, 0x6B, 0xC9, 0x45, 0x88, 0x0F, 0x87, 0x85, 0x3A, 0x6D, 0x50,
+    0x27, 0xC7, 0x2D, 0x06, 0x21, 0x7B, 0xAF, 0x3F, 0x78, 0xE5, 0x75, 0xDB, 0x2B, 0x6F, 0x9A, 0x3A,
+    0xF1, 0x69, 0xB3, 0xD0, 0x9D, 0x75, 0x85, 0x6E, 0x6D, 0xC5, 0xB4, 0x58, 0xD8, 0xBB, 0x4D, 0x06,
+    0xFB, 0xD4, 0xE5, 0x30, 0xEF, 0x5D, 0x01, 0xFD, 0xB9, 0x3A, 0x64, 0x80, 0x0C, 0x5D, 0x05, 0x49,
+    0xCF, 0x16, 0x2F, 0x09, 0x91, 0x9E, 0x0E, 0xC4, 0xDD, 0x10, 0x13, 0xCA, 0x47, 0xD2, 0x49, 0x9D,
+    0x1A, 0x39, 0xCE, 0x50, 0xD6, 0x27, 0xCC, 0x4F, 0xD8, 0x42, 0x6F, 0x2E, 0x6F, 0x51, 0x3A, 0x8C,
+    0xC9, 0x00, 0x35, 0x58, 0xF6, 0x9C, 0xA7, 0xBE, 0x7D, 0x2B, 0xD9, 0xCD, 0x58, 0xA8, 0x9A, 0xA7,
+    0xE4, 0x07, 0x4F, 0xF6, 0x3D, 0xF5, 0x4B, 0x16, 0x53, 0x0D, 0xA4, 0x59, 0xFA, 0x51, 0x2A, 0xCB,
+    0xAC, 0x25, 0x03, 0xA5, 0x6C, 0x53, 0x56, 0x6A, 0x83, 0x95, 0xCB, 0x3B, 0x86, 0xBD, 0x11, 0xCB,
+    0x6E, 0x62, 0x64, 0xCC, 0x08, 0x22, 0x33, 0x29, 0x85, 0x58, 0xC3, 0xC8, 0x83, 0x09, 0xE1, 0x85,
+    0x22, 0x89, 0xCF, 0x9C, 0xBA, 0x49, 0xA8, 0xC4, 0xA6, 0xE4, 0xE5, 0x9A, 0xE0, 0x3B, 0xB8, 0x68,
+    0x24, 0x07, 0xA4, 0x84, 0xDE, 0xA6, 0xF2, 0x6D, 0x98, 0x38, 0xB2, 0xAB, 0x0B, 0x9B, 0xA1, 0x02,
+    0x87, 0x8A, 0x43, 0xB8, 0xB3, 0x76, 0xB6, 0x63, 0xFB, 0xBC, 0xE6, 0x14, 0x11, 0x9A, 0x8F, 0x39,
+    0xB5, 0xBC, 0x38, 0x7A, 0xC7, 0x7A, 0xE6, 0x3C, 0xA1, 0x66, 0x3A, 0xF5, 0xF1, 0x8C, 0x64, 0x49,
+    0x24, 0x49, 0x4F, 0x01, 0xFB, 0x86, 0x9F, 0x5E, 0x9B, 0xC8, 0xDB, 0x16, 0xAB, 0x2A, 0xEB, 0xD2,
+    0x81, 0xBE, 0x82, 0x58, 0x16, 0x2A, 0xEC, 0xA6, 0x5C, 0xE2, 0x17, 0x67, 0xD2, 0xFB, 0xC9, 0x8E,
+    0xA5, 0x17, 0x07, 0xE2, 0x00, 0x8A, 0x5C, 0x58, 0x94, 0xC8, 0xDC, 0x68, 0x3A, 0xFD, 0x9D, 0x5D,
+    0xC9, 0x41, 0xC2, 0xCC, 0x9B, 0x11, 0xEA, 0xD4, 0x63, 0x69, 0x9B, 0xCC, 0x95, 0x34, 0x31, 0xDE,
+    0x80, 0x9E, 0xF1, 0xED, 0xB3, 0x50, 0x43, 0x21, 0xF0, 0x46, 0x94, 0x6D, 0xEE, 0x49, 0xFA, 0xD4,
+    0xB3, 0x52, 0xD9, 0x40, 0x7C, 0xC5, 0x98, 0xB6, 0x18, 0x6B, 0xDB, 0x24, 0xBE, 0xCE, 0x2A, 0xD3,
+    0xD6, 0x39, 0x6D, 0xF3, 0x51, 0x60, 0x2C, 0x49, 0xC2, 0xB1, 0x64, 0xFB, 0x0E, 0xA5, 0x69, 0x93,
+    0xBE, 0xCC, 0x9C, 0xF6, 0xF9, 0x12, 0xA6, 0xCB, 0x46, 0x16, 0xCB, 0x7A, 0xFE, 0x74, 0xD2, 0x21,
+    0xD9, 0x72, 0x4C, 0x84, 0x1E, 0x85, 0x54, 0xEB, 0xE6, 0xEF, 0x44, 0xC9, 0xF0, 0x8B, 0xE3, 0x2A,
+    0x4E, 0x9A, 0x89, 0xC1, 0xA9, 0x9B, 0xD9, 0xCD, 0xC5, 0xBE, 0xAB, 0xCF, 0x0D, 0x8A, 0x43, 0x4A,
+    0x2B, 0x4F, 0xF2, 0xA4, 0xCD, 0x6E, 0xAE, 0x50, 0xCD, 0xB4, 0x32, 0xF0, 0xA4, 0x35, 0xA3, 0x78,
+    0xC7, 0x29, 0x68, 0x2B, 0x8A, 0x2F, 0x64, 0x52, 0xB1, 0xDF, 0xA9, 0x9C, 0xCB, 0xA0, 0x90, 0xC9,
+    0xC4, 0xC8, 0xD6, 0x6C, 0x6C, 0xC2, 0x51, 0x64, 0xE5, 0xCE, 0xD7, 0x55, 0x81, 0xD2, 0x23, 0x4E,
+    0xD0, 0x38, 0x49, 0xE3, 0x8F, 0xE7, 0xEC, 0x17, 0x79, 0xA1, 0x48, 0xFE, 0xC3, 0xFA, 0x05, 0xAD,
+    0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xE3, 0xB9, 0x93, 0xA3, 0xB8, 0x98, 0x2D, 0xAE, 0x00,
+    0x9D, 0xC4, 0x34, 0x29, 0x92, 0x06, 0xB7, 0x57, 0x64, 0x6D, 0x23, 0x4A, 0x0A, 0xAE, 0xA1, 0xE6,
+    0xFE, 0x83, 0x6B, 0x28, 0xBD, 0xD9, 0x21, 0x14, 0x29, 0x52, 0x20, 0x51, 0x50, 0x83, 0xC4, 0x9F,
+    0x40, 0x91, 0xC2, 0x77, 0x3B, 0x22, 0xFF, 0x80, 0x25, 0x44, 0x1D, 0x4B, 0x29, 0x29, 0xD6, 0x42,
+    0x06, 0x39, 0x92, 0x77, 0x27, 0xEF, 0x1B, 0xEF, 0xA6, 0x06, 0xB4, 0x73, 0x1A, 0xCB, 0xB7, 0xF3,
+    0xCD, 0xFB, 0xDE, 0xF7, 0xE3, 0x7D, 0x06, 0xCE, 0x2B, 0x00, 0x6B, 0x3E, 0x74, 0xE0, 0xCB, 0x72,
+    0x09, 0xA4, 0xED, 0x53, 0xE0, 0x0C, 0x0B, 0xC4, 0xF5, 0x0A, 0x68, 0x74, 0x07, 0xDD, 0x9B, 0x0A,
+    0xC6, 0xD5, 0x34, 0x49, 0x7A, 0xA8, 0xDE, 0x78, 0x64, 0xBE, 0x00, 0x0A, 0x0C, 0xC0, 0x98, 0x7A,
+    0xDE, 0xCA, 0x81, 0x1C, 0xE3, 0xC1, 0xBC, 0xB3, 0x34, 0xAF, 0x68, 0x5E, 0xD3, 0x3C, 0xE9, 0x33,
+    0xCF, 0xCB, 0x34, 0x58, 0xF1, 0x4F, 0xF7, 0xD8, 0x63, 0x03, 0x15, 0xC2, 0xC0, 0xC7, 0x9E, 0x3E,
+    0xCE, 0x67, 0x57, 0x67, 0x24, 0xE1, 0x09, 0x67, 0x75, 0x0B, 0x3C, 0x3A, 0xFC, 0x18, 0xD7, 0xA7,
+    0x07, 0xE8, 0x89, 0x27, 0x84, 0x06, 0xA1, 0x1B, 0x42, 0x6B, 0x81, 0x36, 0x8E, 0xD0, 0xA4, 0x5D,
+    0x28, 0xF2, 0x1A, 0xB2, 0x03, 0xAF, 0x68, 0x3E, 0xA6, 0x34, 0x6F, 0x69, 0x6E, 0x41, 0xF3, 0x86,
+    0x4C, 0x74, 0x47, 0x03, 0x5B, 0x91, 0xDC, 0x84, 0xD2, 0xE5, 0x1E, 0xEB, 0xB0, 0x63, 0xF8, 0xC1,
+    0x01, 0x4A, 0x12, 0x11, 0xD3, 0xC1, 0xD8, 0x50, 0xF2, 0x9D, 0x77, 0x92, 0xEE, 0x78, 0x00, 0xBA,
+    0x68, 0x0A, 0xA8, 0x31, 0x67, 0x00, 0x16, 0x59, 0x6B, 0x2A, 0xE3, 0x8C, 0x2B, 0xE9, 0xAE, 0x41,
+    0xEA, 0x47, 0xE8, 0xDF, 0x09, 0xFF, 0xA7, 0x47, 0x12, 0x2A, 0x86, 0xC5, 0x0B, 0x13, 0x37, 0x49,
+    0x48, 0x82, 0x48, 0x8D, 0x4C, 0x19, 0x5E, 0x37, 0x6F, 0xF2, 0xE2, 0x3D, 0x9E, 0xD5, 0xF3, 0xEF,
+    0x8C, 0x81, 0x99, 0x94, 0x94, 0x54, 0x59, 0x08, 0x4C, 0xD4, 0x9A, 0x37, 0x9F, 0x31, 0xD8, 0xC9,
+    0xD2, 0x5B, 0x03, 0xF3, 0x5D, 0x8F, 0x95, 0x71, 0xBA, 0x5F, 0x62, 0xFD, 0xD9, 0x3E, 0x8C, 0x19,
+    0xD3, 0x56, 0x7E, 0x15, 0xE1, 0x05, 0xCA, 0xCE, 0x64, 0x71, 0x4C, 0xE5, 0x86, 0x31, 0x21, 0x04,
+    0x9E, 0xDC, 0x09, 0x8B, 0x02, 0x31, 0x05, 0x31, 0x35, 0xA9, 0xD4, 0x26, 0xA5, 0xCB, 0x21, 0x23,
+    0x8F, 0xDA, 0xF0, 0x91, 0x0B, 0x84, 0xF9, 0x2D, 0xD2, 0x13, 0x94, 0xC1, 0xF0, 0xFF, 0x5A, 0xED,
+    0x24, 0x89, 0x7C, 0x65, 0x36, 0x26, 0x21, 0x9D, 0x4B, 0x24, 0xC4, 0xA8, 0xA5, 0x80, 0xF9, 0x45,
+    0x32, 0xC2, 0xBC, 0x0C, 0x3C, 0x69, 0xC3, 0xC8, 0xBC, 0x4B, 0x92, 0x22, 0x05, 0x49, 0x5C, 0x8C,
+    0x07, 0x56, 0x02, 0xDC, 0x10, 0x0B, 0x79, 0x8B, 0x63, 0x6E, 0xC5, 0x97, 0x64, 0x00, 0xFD, 0x1C,
+    0xBD, 0x14, 0x5D, 0xD6, 0x65, 0xF7, 0x18, 0x9B, 0xA9, 0xD6, 0xBB, 0xAF, 0xC7, 0xAC, 0x4B, 0x07,
+    0xE3, 0x75, 0x2F, 0x89, 0x2E, 0x69, 0x5C, 0x70, 0xAF, 0x78, 0xB1, 0x89, 0xA9, 0x36, 0xDC, 0x39,
+    0xFB, 0x70, 0x5D, 0x95, 0xC9, 0xB6, 0xCA, 0xC3, 0xF7, 0xC8, 0x76, 0x0C, 0x2F, 0xD6, 0x48, 0x5D,
+    0xD3, 0x41, 0xF7, 0x21, 0x9D, 0xF8, 0x15, 0x87, 0x83, 0x13, 0xE1, 0x5F, 0x70, 0xEF, 0x67, 0xA5,
+    0x98, 0x97, 0x0E, 0x4B, 0x16, 0x68, 0x71, 0x70, 0x70, 0x0A, 0x7C, 0x55, 0x5D, 0xC0, 0x0E, 0x57,
+    0x28, 0x28, 0x8C, 0x6F, 0x6C, 0x87, 0x85, 0x3A, 0x1D, 0x77, 0xC5, 0xA7, 0xF9, 0xBC, 0x83, 0xE5,
+    0x3E, 0x57, 0xEE, 0x83, 0xB2, 0x4E, 0x92, 0x17, 0xCE, 0x08, 0xBD, 0x65, 0x47, 0x6B, 0x17, 0x77,
+    0xFA, 0xA2, 0x42, 0x22, 0xBA, 0x5E, 0x9C, 0xCE, 0xC7, 0x65, 0x7B, 0xB3, 0xA9, 0x74, 0x78, 0xFB,
+    0x26, 0xB8, 0xF2, 0xC7, 0xED, 0xB8, 0x4E, 0x46, 0x56, 0x61, 0x65, 0x7C, 0xD6, 0x2B, 0xEA, 0xC3,
+    0x3A, 0xF3, 0xBA, 0x47, 0xA3, 0x76, 0xA6, 0x4A, 0xD8, 0xF7, 0x2B, 0x98, 0x30, 0x50, 0x57, 0xCF,
+    0x44, 0x65, 0x6C, 0x54, 0xF6, 0xAE, 0x95, 0x6E, 0x47, 0xF0, 0x14, 0xB0, 0xDD, 0xF8, 0x8F, 0x75,
+    0xF8, 0x6B, 0x1B, 0x06, 0xBD, 0x37, 0x96, 0xD2, 0xAF, 0xA2, 0xC4, 0xB3, 0x77, 0xC8, 0x83, 0x2F,
+    0xFF, 0xF8, 0x29, 0x97, 0x81, 0x22, 0x9D, 0xCE, 0x3E, 0x55, 0x43, 0xEC, 0xD2, 0x3C, 0xCA, 0x55,
+    0x94, 0xBA, 0x62, 0xE9, 0xDB, 0x07, 0x14, 0x2A, 0x5D, 0x38, 0x69, 0xB0, 0x2B, 0x36, 0xBA, 0x8B,
+    0xED, 0xFC, 0x14, 0xC9, 0x3D, 0xD4, 0x61, 0x9E, 0x49, 0x8F, 0x37, 0x32, 0xA7, 0xE2, 0xD1, 0xDC,
+    0xE4, 0xB7, 0x1D, 0x36, 0x01, 0xFB, 0x2F, 0xBA, 0x3B, 0x8C, 0x05, 0x0A, 0x92, 0xFA, 0xD2, 0xDD,
+    0xBE, 0x08, 0xE1, 0x5B, 0xAA, 0xF9, 0xEE, 0xE8, 0x44, 0x3C, 0x96, 0xD5, 0x47, 0x29, 0x3D, 0xAC,
+    0x89, 0x75, 0x3D, 0xEB, 0x46, 0x4D, 0x51, 0x59, 0x42, 0xA2, 0x9B, 0xFB, 0x90, 0x25, 0xDD, 0x38,
+    0xC1, 0x2B, 0x7F, 0x18, 0x39, 0x8C, 0xDC, 0x08, 0x4E, 0x26, 0x56, 0xF7, 0xB2, 0x5B, 0x87, 0x31,
+    0xA5, 0x26, 0xEF, 0xE6, 0x11, 0xD3, 0xCC, 0x9A, 0x23, 0x24, 0x49, 0xFB, 0x34, 0x74, 0xF3, 0x3C,
+    0x23, 0xEE, 0x26, 0xAA, 0xB3, 0xA9, 0xF1, 0x2A, 0x73, 0x8B, 0xE8, 0xE8, 0xFF, 0x32, 0x3C, 0x53,
+    0x30, 0xCF, 0x7B, 0xDD, 0x4D, 0xB8, 0x79, 0x70, 0xE8, 0x2B, 0x92, 0x4B, 0xC2, 0xA4, 0xDF, 0xE5,
+    0xCF, 0x07, 0xDD, 0x91, 0x5B, 0x83, 0x55, 0xA1, 0xEE, 0x6D, 0xD8, 0x93, 0x5A, 0x32, 0x44, 0x5A,
+    0xF9, 0xCC, 0x6C, 0x87, 0x1B, 0x1B, 0x26, 0x25, 0x53, 0x44, 0x0A, 0xA1, 0x59, 0x50, 0x36, 0xD4,
+    0x32, 0xE6, 0xEC, 0x17, 0x0C, 0x8A, 0x85, 0x4C, 0x88, 0xAD, 0xDB, 0xD4, 0x67, 0xDE, 0x78, 0x0E,
+    0xDD, 0xCA, 0xF2, 0x6E, 0x21, 0x03, 0x99, 0xCE, 0x39, 0x9E, 0x64, 0xFE, 0x4A, 0x95, 0x62, 0x2F,
+    0x3E, 0x91, 0x31, 0x45, 0xDC, 0x5C, 0x7C, 0xB0, 0x0A, 0xAC, 0x40, 0x2D, 0x95, 0xA3, 0x5D, 0x11,
+    0x8F, 0xBC, 0x1C, 0x71, 0x5C, 0xB7, 0x51, 0xD0, 0x4C, 0xAC, 0x1D, 0xD5, 0xD0, 0x5B, 0xD5, 0x5F,
+    0x47, 0x80, 0xFF, 0x72, 0x5F, 0xC9, 0xF0, 0xF4, 0x53, 0x0E, 0xF7, 0x68, 0x8E, 0xFA, 0x61, 0x45,
+    0x56, 0x2A, 0x8E, 0xC9, 0xA3, 0x91, 0x8D, 0x38, 0xBD, 0xB4, 0xD4, 0x52, 0xBE, 0x03, 0xD9, 0x01,
+    0x67, 0x5E, 0xDA, 0x5F, 0x41, 0xFF, 0xC3, 0x0E, 0xE5, 0xB0, 0x96, 0x8F, 0x86, 0xDD, 0x3A, 0x7C,
+    0x42, 0x17, 0xB1, 0x7F, 0x68, 0x7D, 0xF9, 0x73, 0xAF, 0xC2, 0xAE, 0x4F, 0xFF, 0xBE, 0xED, 0xAD,
+    0xCB, 0x44, 0x32, 0xFC, 0x04, 0xC8, 0x17, 0x21, 0x6E, 0x8E, 0x6B, 0x91, 0x8E, 0xC8, 0xC6, 0x56,
+    0x25, 0xEE, 0xD9, 0xC0, 0x23, 0x52, 0x99, 0xFB, 0x17, 0xF8, 0x77, 0xEB, 0x3D, 0xAD, 0x55, 0x3D,
+    0xAF, 0xDC, 0x44, 0x14, 0x3D, 0xE3, 0x49, 0xD6, 0x11, 0x2E, 0x26, 0x45, 0x68, 0x00, 0x65, 0x5A,
+    0x84, 0x04, 0xD3, 0x52, 0xBC, 0xB7, 0xB6, 0xF4, 0x0A, 0xDA, 0x2D, 0x88, 0x28, 0x93, 0x32, 0x5D,
+    0x5A, 0x8A, 0xDD, 0x3C, 0x13, 0x7E, 0x00, 0xF9, 0x19, 0x28, 0x0D, 0x2D, 0x85, 0x93, 0x1D, 0x41,
+    0x91, 0xD6, 0x54, 0x94, 0x99, 0x20, 0xA5, 0x81, 0x82, 0x41, 0xB2, 0x78, 0x0E, 0xF1, 0xEE, 0x70,
+    0xAE, 0xED, 0x5D, 0x52, 0x50, 0xC1, 0x5A, 0xB2, 0xBD, 0x1A, 0xCF, 0xDC, 0xF3, 0x71, 0xCF, 0xCC,
+    0x02, 0x2B, 0x05, 0xA4, 0x0B, 0x8F, 0x6D, 0x0A, 0xF8, 0xD4, 0x06, 0x5C, 0xC3, 0x74, 0xBD, 0x93,
+    0xED, 0xA1, 0x9F, 0xA7, 0xA0, 0xAE, 0x5E, 0x0D, 0xD8, 0x7A, 0x57, 0x95, 0x3E, 0x6F, 0x8D, 0xCF,
+    0x62, 0x1E, 0x30, 0xA8, 0x0E, 0x25, 0x1A, 0x98, 0xBA, 0x04, 0x07, 0x6B, 0x0E, 0xB6, 0x18, 0xB2,
+    0x88, 0x25, 0x06, 0xD8, 0xE3, 0x20, 0x70, 0x9D, 0x85, 0x4A, 0xDE, 0x6B, 0xDE, 0xDF, 0xF3, 0xE6,
+    0x10, 0xAA, 0xB1, 0xFC, 0xE2, 0x35, 0x08, 0x09, 0xF3, 0x6A, 0x8B, 0xA7, 0x78, 0x28, 0x35, 0x1D,
+    0xB2, 0xD8, 0xA3, 0x78, 0xDE, 0xC2, 0x59, 0x60, 0x68, 0xA0, 0x7F, 0x89, 0xB0, 0x9F, 0x79, 0x0C,
+    0xB6, 0xCE, 0xDB, 0xB2, 0x7A, 0x86, 0x92, 0x14, 0xDD, 0x6E, 0xE6, 0xA7, 0xAA, 0xB1, 0xB4, 0xA0,
+    0x70, 0xBA, 0xE2, 0x4B, 0xE1, 0x34, 0x95, 0x57, 0x40, 0xC1, 0x72, 0x97, 0x01, 0xF9, 0x8F, 0x1E,
+    0xEB, 0xDC, 0xAB, 0x4A, 0x9D, 0xA4, 0xF2, 0x75, 0xDC, 0x44, 0x7A, 0xE4, 0x8B, 0xB4, 0xC7, 0x99,
+    0x89, 0x98, 0xAB, 0xAA, 0x67, 0x15, 0x5C, 0xF2, 0xFA, 0xF5, 0x03, 0x9A, 0x6C, 0xBF, 0xEA, 0x51,
+    0x16, 0x1E, 0xCD, 0x12, 0xD9, 0x1F, 0x1D, 0x2B, 0x7B, 0x94, 0x0E, 0xE8, 0x1B, 0xE4, 0x3F, 0x45,
+    0x94, 0x79, 0x50, 0x9D, 0x69, 0x5D, 0x6D, 0x12, 0x51, 0xD3, 0xE4, 0xE4, 0xD8, 0xB1, 0xC6, 0x42,
+    0x87, 0x06, 0x19, 0x1E, 0xE3, 0xE0, 0xCF, 0xFF, 0x2D, 0x4B, 0x41, 0x59, 0x07, 0xB8, 0x6A, 0x74,
+    0x84, 0xEC, 0xEF, 0xDC, 0xF9, 0x3C, 0xA5, 0xF4, 0x26, 0x91, 0x3E, 0xFE, 0x7D, 0xCA, 0x35, 0x2C,
+    0xFE, 0xFA, 0x98, 0xA8, 0x03, 0xF6, 0x5F, 0x74, 0x59, 0xA7, 0x7B, 0xDD, 0x9A, 0xA1, 0xF0, 0xCB,
+    0xC6, 0x54, 0xCD, 0xDA, 0xAA, 0xD8, 0x58, 0xDD, 0x36, 0xCE, 0x54, 0xBD, 0x5B, 0x22, 0xDA, 0x26,
+    0x8B, 0x86, 0xC1, 0x31, 0xC1, 0x12, 0x78, 0x8F, 0xE5, 0xB6, 0xC3, 0x07, 0x78, 0xAB, 0xBB, 0x34,
+    0x78, 0x6C, 0x2F, 0x08, 0x81, 0xB3, 0x59, 0x28, 0x87, 0x1E, 0xE3, 0x3E, 0xE3, 0xD6, 0xE4, 0x1E,
+    0x3D, 0x25, 0x75, 0xA6, 0x56, 0xD1, 0x54, 0x59, 0xB4, 0x95, 0x0E, 0x8E, 0x2E, 0x48, 0xFA, 0x96,
+    0x28, 0xFC, 0x39, 0x8C, 0xDF, 0xC0, 0xD5, 0x6B, 0x5C, 0x56, 0x0F, 0xB3, 0xDF, 0xAB, 0x32, 0x7D,
+    0x03, 0xB3, 0xB3, 0x73, 0x00, 0xD5, 0x6A, 0x02, 0x30, 0x1E, 0x4C, 0xED, 0x94, 0xCE, 0xD5, 0x09,
+    0xEB, 0xDF, 0xE2, 0x4D, 0x9F, 0x32, 0xBA, 0x29, 0x6E, 0x7F, 0x92, 0x05, 0x36, 0x7F, 0x75, 0xB2,
+    0xFA, 0x8A, 0x4F, 0xF3, 0x28, 0xC2, 0x5C, 0x04, 0x2C, 0x54, 0x7D, 0xB0, 0xED, 0x34, 0xDC, 0xF1,
+    0xAE, 0x20, 0xF4, 0x7C, 0x18, 0xA9, 0x3C, 0xFE, 0x90, 0x0F, 0x37, 0x67, 0x94, 0xF7, 0x80, 0x6F,
+    0xB9, 0xA5, 0xF3, 0x76, 0x3C, 0x06, 0xB4, 0xBC, 0x4C, 0x4D, 0x23, 0x97, 0xB2, 0xCF, 0x1B, 0x1D,
+    0xD8, 0x35, 0x86, 0x2B, 0xF7, 0x5C, 0x68, 0xC8, 0x02, 0x67, 0x62, 0xF0, 0x9F, 0xEC, 0xA4, 0x7E,
+    0xC1, 0x32, 0xC5, 0x20, 0xC9, 0x69, 0xF9, 0xB8, 0x14, 0x98, 0xEE, 0x00, 0xD3, 0x60, 0xEA, 0xC8,
+    0x38, 0xBC, 0xE5, 0xEC, 0xEC, 0x98, 0xB3, 0x29, 0x06, 0xC2, 0x43, 0x2A, 0x59, 0xC9, 0x86, 0x3F,
+    0x0C, 0xBA, 0x1A, 0xE7, 0x97, 0x3B, 0xD8, 0xCD, 0x03, 0x5F, 0xF4, 0x59, 0x97, 0x0D, 0xD8, 0xF0,
+    0x10, 0x32, 0xD5, 0x92, 0xC4, 0x2C, 0xCB, 0x4B, 0xEA, 0x35, 0x33, 0xCE, 0xE5, 0xA6, 0x16, 0xED,
+    0xD6, 0xE7, 0xA1, 0xE8, 0xF3, 0xA8, 0x7F, 0x4B, 0x11, 0xDD, 0x36, 0x60, 0xC3, 0xB0, 0x51, 0x3A,
+    0x84, 0xAA, 0x0E, 0x73, 0xDE, 0xE4, 0xC4, 0x72, 0x38, 0x6E, 0x30, 0xDD, 0x12, 0xDD, 0xD2, 0x6C,
+    0xDC, 0x5A, 0xE0, 0x9F, 0x6B, 0x51, 0xE3, 0x23, 0x08, 0x0A, 0x41, 0x69, 0x80, 0xBC, 0x74, 0x20,
+    0x9A, 0xA9, 0xAD, 0x2C, 0xE7, 0x9A, 0x86, 0x55, 0x55, 0x24, 0x6D, 0xFD, 0x03, 0xE9, 0x1A, 0x51,
+    0x7A, 0x2E, 0x4A, 0xAF, 0x5A, 0x09, 0x87, 0x48, 0x16, 0x34, 0x4B, 0x68, 0xAE, 0x9D, 0xF1, 0xDD,
+    0xC1, 0x7E, 0x19, 0x76, 0x62, 0xD7, 0x76, 0xEA, 0xB0, 0x49, 0x2D, 0x54, 0xDA, 0xC9, 0x5E, 0x9C,
+    0x37, 0xE9, 0x68, 0x5F, 0xC9, 0xAF, 0x85, 0xCC, 0x7F, 0x23, 0xF3, 0xC9, 0x5C, 0xFF, 0xCC, 0x1F,
+    0xC3, 0x99, 0x30, 0x6E, 0xA1, 0xE3, 0x39, 0x6B, 0xB3, 0xB0, 0xC8, 0x57, 0x91, 0xAE, 0x95, 0x29,
+    0x71, 0x9B, 0x53, 0xFD, 0xFE, 0xC9, 0x77, 0x04, 0x53, 0x9D, 0x7C, 0xAC, 0x88, 0xD3, 0xDB, 0x1A,
+    0xE6, 0x6B, 0xF2, 0x1C, 0x36, 0xA3, 0x1D, 0x82, 0xE7, 0x78, 0x1F, 0xE0, 0xDE, 0x0F, 0x1F, 0x62,
+    0x3B, 0xAC, 0xF5, 0xEE, 0x6E, 0x5F, 0x84, 0xBC, 0x33, 0x5E, 0xB3, 0xD1, 0x3A, 0x32, 0x03, 0x81,
+    0x76, 0x87, 0x0D, 0x23, 0xD1, 0x70, 0x1D, 0xFF, 0x18, 0x78, 0x4F, 0xE9, 0x2A, 0x99, 0x2E, 0xC7,
+    0x74, 0x15, 0xC7, 0x74, 0xDD, 0xC0, 0x3D, 0xE0, 0xCB, 0x9C, 0x9C, 0x79, 0x4E, 0x50, 0x4E, 0xFB,
+    0x56, 0xB2, 0xC6, 0xDE, 0xCA, 0xBE, 0x99, 0xF4, 0x2C, 0x25, 0x05, 0x57, 0xD4, 0x62, 0xEE, 0x62,
+    0x12, 0x94, 0xB7, 0x14, 0x5C, 0x6A, 0xDA, 0xC0, 0x6C, 0x8F, 0x8A, 0xD8, 0x29, 0x1E, 0xBB, 0xA2,
+    0xC6, 0xA5, 0xE4, 0x47, 0x49, 0x64, 0xBE, 0x91, 0xA4, 0x74, 0xEC, 0x84, 0x0E, 0xA2, 0xA9, 0x26,
+    0x52, 0xC9, 0x8D, 0x21, 0x21, 0x13, 0xFC, 0xDB, 0x8A, 0x8A, 0x39, 0x3B, 0x4F, 0x87, 0xA3, 0xEB,
+    0x44, 0xE2, 0xC6, 0x7E, 0xEC, 0xE7, 0x8E, 0x09, 0x7D, 0x69, 0x87, 0xB0, 0x37, 0xFC, 0x2B, 0x11,
+    0xF2, 0xD2, 0x8D, 0x91, 0x7B, 0x4F, 0xD3, 0x85, 0xBA, 0x34, 0x43, 0x98, 0x9B, 0x5F, 0x9F, 0x44,
+    0x21, 0x2E, 0xBD, 0xB8, 0x20, 0xEF, 0x97, 0x34, 0xA0, 0x17, 0xDA, 0x53, 0x2B, 0x20, 0x86, 0x15,
+    0xF5, 0x9C, 0x7C, 0x49, 0xC9, 0x53, 0x02, 0x9A, 0x70, 0x3C, 0xB6, 0xFE, 0xDB, 0xF5, 0x37, 0xBD,
+    0x54, 0x31, 0x6F, 0xD4, 0x58, 0x10, 0xFE, 0x9E, 0x1F, 0xC9, 0x93, 0x70, 0x61, 0x0A, 0x4E, 0x08,
+    0xA5, 0xF0, 0x15, 0x14, 0x54, 0xF8, 0x0F, 0x24, 0xF6, 0xFB, 0x07, 0x97, 0x82, 0x80, 0x04, 0x12,
+    0xDC, 0x3F, 0xA0, 0xA5, 0xC8, 0xB2, 0x86, 0xF6, 0x8A, 0xCB, 0x9D, 0x44, 0x4F, 0x7F, 0x7F, 0x80,
+    0x62, 0x13, 0xBB, 0xBF, 0x66, 0x05, 0xA4, 0x37, 0x10, 0x6A, 0x8C, 0x64, 0x24, 0x07, 0x79, 0xF7,
+    0xF1, 0xCD, 0x78, 0xB3, 0x51, 0x24, 0x3A, 0x14, 0xAC, 0x9D, 0xCD, 0xC6, 0x6F, 0xE6, 0x9B, 0xEF,
+    0x9B, 0x99, 0x37, 0xD8, 0x6A, 0x6E, 0xA3, 0x1A, 0xF6, 0xED, 0xE2, 0x71, 0x1F, 0x37, 0xAE, 0x4B,
+    0x6A, 0xDB, 0x66, 0xB0, 0x6D, 0x01, 0xDB, 0xE4, 0xB4, 0x09, 0xDC, 0x7C, 0x86, 0xB8, 0x9E, 0x21,
+    0xA1, 0x65, 0xE5, 0x3E, 0xA6, 0xBE, 0x88, 0x3E, 0xFB, 0x2C, 0xFC, 0x8D, 0x78, 0x91, 0x02, 0x7E,
+    0x1B, 0x30, 0x0D, 0x60, 0x6B, 0xC0, 0x89, 0xBD, 0xE3, 0xEF, 0x01, 0xC0, 0x35, 0x1A, 0x7E, 0xA3,
+    0xA5, 0x25, 0x90, 0xAC, 0x2C, 0xF6, 0xF4, 0xC6, 0xF8, 0xB8, 0x70, 0x82, 0x34, 0x04, 0x64, 0x27,
+    0x37, 0xCA, 0x8C, 0x91, 0x29, 0x2D, 0x11, 0x04, 0x41, 0x6B, 0xE9, 0xD0, 0xD3, 0x26, 0xB4, 0x0C,
+    0xE3, 0x81, 0xBE, 0x14, 0xE8, 0x82, 0x16, 0xF3, 0x85, 0x11, 0x8F, 0x82, 0x90, 0xAE, 0x37, 0x07,
+    0xA8, 0x42, 0x4F, 0xCC, 0x05, 0x5F, 0x7B, 0x81, 0xDF, 0xF0, 0x7A, 0x9E, 0x6B, 0x62, 0x3B, 0x5F,
+    0x11, 0x02, 0x2A, 0xF1, 0x44, 0x71, 0xFC, 0x2A, 0x6E, 0x34, 0x05, 0xD1, 0x6D, 0xA3, 0x89, 0x84,
+    0xFE, 0x6C, 0x44, 0xE6, 0x1F, 0x37, 0x17, 0xEC, 0xDF, 0x0D, 0x19, 0xDA, 0xD0, 0x8C, 0xA0, 0xF2,
+    0x65, 0x19, 0x63, 0x03, 0xED, 0x43, 0x43, 0xD8, 0x1D, 0x56, 0xC0, 0xFC, 0x12, 0x3D, 0xBB, 0xC0,
+    0x12, 0x08, 0x35, 0xFA, 0xD7, 0xE8, 0x12, 0x7F, 0x0D, 0xFA, 0x36, 0x3B, 0x11, 0x35, 0xE1, 0x5E,
+    0x79, 0xA4, 0x52, 0x33, 0x55, 0x4B, 0xEA, 0xA6, 0x55, 0x11, 0x99, 0x02, 0x9B, 0x4E, 0xA5, 0xB8,
+    0x30, 0xA0, 0x58, 0x2A, 0x92, 0x62, 0x46, 0x67, 0xF9, 0x6F, 0xE2, 0xFC, 0x49, 0xC3, 0x01, 0xA6,
+    0x74, 0xAC, 0x0E, 0x1E, 0xA1, 0xE2, 0xFF, 0xD3, 0x15, 0x3F, 0xED, 0x62, 0x3D, 0xD6, 0x4A, 0xF0,
+    0x04, 0x5D, 0x0F, 0x2E, 0x28, 0x11, 0x69, 0xA2, 0x17, 0x0B, 0x09, 0x69, 0x36, 0x7D, 0x14, 0x58,
+    0xBB, 0x34, 0x30, 0x60, 0x63, 0x25, 0x62, 0xA6, 0x61, 0x9B, 0xFE, 0x2C, 0x61, 0x75, 0x10, 0x85,
+    0xC1, 0x2E, 0x1E, 0x44, 0xBD, 0x56, 0x68, 0xA6, 0x3A, 0x52, 0x2F, 0xDD, 0x88, 0xD6, 0x22, 0xA4,
+    0x19, 0x0B, 0x94, 0x69, 0x68, 0xC1, 0xAA, 0x68, 0x41, 0xA4, 0xEC, 0xDB, 0x74, 0x72, 0xFF, 0xD7,
+    0x5A, 0x16, 0xAD, 0xB7, 0xF1, 0xBF, 0xA2, 0x17, 0xAC, 0xBD, 0xAD, 0xF7, 0x91, 0x66, 0x9A, 0xD8,
+    0x31, 0xF4, 0xFA, 0xCF, 0xCF, 0xD6, 0x2E, 0x1B, 0xEA, 0xCA, 0xD7, 0xC0, 0x0E, 0xF5, 0x9B, 0x20,
+    0xE5, 0x96, 0x42, 0x5E, 0x3F, 0x17, 0xA4, 0x2C, 0x92, 0xE3, 0xAA, 0x21, 0xF4, 0xD4, 0xB3, 0x44,
+    0x03, 0x0B, 0x14, 0xD7, 0x4C, 0x32, 0x61, 0x16, 0xDB, 0x70, 0x16, 0x73, 0xE6, 0xB1, 0x0D, 0x33,
+    0x4C, 0x28, 0x2A, 0x9E, 0x93, 0xC2, 0x90, 0x78, 0x24, 0xCF, 0x5B, 0x44, 0x1D, 0xFD, 0xA6, 0xF4,
+    0x4B, 0xEB, 0x1C, 0x71, 0xE7, 0x3E, 0x3D, 0x5C, 0xB0, 0xCF, 0x4B, 0xC4, 0xE1, 0xF4, 0xBC, 0xF9,
+    0xA6, 0xDB, 0x97, 0xBE, 0x25, 0x32, 0x1C, 0x5F, 0xA4, 0x22, 0x39, 0x6F, 0x37, 0xEC, 0x1B, 0x39,
+    0xE3, 0x89, 0x39, 0x12, 0xFE, 0xD5, 0x20, 0x2D, 0x7C, 0x49, 0x86, 0xB2, 0x30, 0xA4, 0x6A, 0x85,
+    0x28, 0x65, 0x05, 0xF9, 0xC9, 0xA5, 0x7D, 0xCC, 0x42, 0x85, 0x13, 0x91, 0xCA, 0x00, 0x7E, 0x06,
+    0xF9, 0x99, 0x71, 0x30, 0x6B, 0x09, 0x90, 0xFD, 0x81, 0x28, 0xF4, 0x4C, 0xA0, 0x2B, 0x04, 0x57,
+    0xD6, 0x93, 0xA7, 0x12, 0xED, 0xD7, 0x27, 0xD4, 0x59, 0xD2, 0x75, 0x42, 0x48, 0xD5, 0x48, 0x8C,
+    0xD4, 0x2B, 0x36, 0xE3, 0xFB, 0x87, 0x9F, 0x76, 0xED, 0xC7, 0x10, 0xCA, 0xF4, 0x0F, 0xB6, 0xE4,
+    0x50, 0xB4, 0xB7, 0xA2, 0x92, 0xCB, 0x09, 0x87, 0x74, 0x77, 0x2D, 0xEF, 0xC0, 0x14, 0x22, 0xD3,
+    0x9C, 0xDE, 0x0B, 0xDE, 0xC9, 0x0C, 0x66, 0x52, 0xC0, 0xB5, 0x4C, 0x49, 0x07, 0x5C, 0xFD, 0xEF,
+    0x1B, 0x3B, 0xC8, 0x99, 0xDA, 0xB8, 0x7F, 0xA2, 0x0A, 0x55, 0x60, 0xA0, 0xBE, 0xE2, 0x9F, 0x50,
+    0xAA, 0xBA, 0x9E, 0xE2, 0x44, 0x9B, 0x4A, 0xDB, 0xA1, 0x32, 0x15, 0x36, 0x1B, 0x29, 0x0D, 0xAA,
+    0xCA, 0xD5, 0x71, 0xA7, 0x9A, 0x54, 0x92, 0x2A, 0xBA, 0x32, 0xB6, 0xAC, 0x63, 0x75, 0x09, 0xBE,
+    0xB7, 0xAB, 0x59, 0xF5, 0x56, 0xD1, 0x16, 0x7B, 0x77, 0x45, 0x85, 0x90, 0x90, 0x01, 0x17, 0x93,
+    0x21, 0x91, 0x15, 0x45, 0xA6, 0x65, 0x1C, 0x82, 0x4F, 0x8E, 0xF7, 0xC6, 0x95, 0xE9, 0x95, 0xA7,
+    0x4E, 0x69, 0xBE, 0xB2, 0x67, 0x0C, 0x3F, 0x83, 0x42, 0xC1, 0x22, 0x84, 0xC6, 0x8C, 0x19, 0xB6,
+    0x7A, 0xAA, 0xAC, 0x8B, 0x7F, 0xFB, 0xCC, 0xE7, 0x49, 0x99, 0xFC, 0x55, 0xBB, 0xB7, 0xCD, 0xD6,
+    0x7B, 0x8A, 0x9F, 0x86, 0x32, 0xF3, 0xD2, 0x07, 0xC9, 0xC5, 0xB6, 0x24, 0xF3, 0x4D, 0x8E, 0x5E,
+    0x9D, 0xB2, 0x85, 0x32, 0x5E, 0x9B, 0xFC, 0x76, 0xFE, 0x29, 0x47, 0xB1, 0xE5, 0xE0, 0xD5, 0xEB,
+    0x99, 0xBB, 0x0C, 0xC2, 0xB7, 0x4C, 0x69, 0xEB, 0x6D, 0xF2, 0xF6, 0x08, 0x8C, 0x1F, 0xAF, 0x2B,
+    0x89, 0xB3, 0x50, 0xF6, 0x34, 0x2B, 0x0F, 0xD1, 0x93, 0xF9, 0x8B, 0xD6, 0x74, 0xB9, 0x39, 0x12,
+    0x70, 0x52, 0x8F, 0xE7, 0xEB, 0xAB, 0x43, 0xEE, 0xB6, 0x33, 0x94, 0x3C, 0x60, 0xBA, 0x5C, 0xF1,
+    0xDC, 0x58, 0xA5, 0x2B, 0x2E, 0x2E, 0xB2, 0xCB, 0x20, 0x2F, 0xEB, 0x8B, 0x14, 0x58, 0xCB, 0xA8,
+    0x3C, 0x1B, 0xA5, 0xAA, 0x94, 0xF5, 0x75, 0x9A, 0xBD, 0xE8, 0x6C, 0xD3, 0xA3, 0x9F, 0x61, 0x42,
+    0xE6, 0x69, 0x58, 0xBA, 0xD0, 0x47, 0xDD, 0xC5, 0xF5, 0xF5, 0x27, 0x79, 0x9B, 0xD5, 0xFA, 0xBA,
+    0x0C, 0x7A, 0xD1, 0x7C, 0x74, 0xBA, 0xC3, 0x03, 0xB9, 0xB7, 0xB9, 0x04, 0xCC, 0xCF, 0x97, 0xE2,
+    0x8F, 0x9E, 0xEF, 0xBD, 0x55, 0xBB, 0x6E, 0x1C, 0x37, 0x14, 0x3D, 0x9C, 0xB1, 0x34, 0xC5, 0x14,
+    0x54, 0x11, 0x21, 0x46, 0x04, 0x98, 0xAD, 0x8B, 0xC0, 0xF3, 0x03, 0xD2, 0x0E, 0x81, 0x20, 0x75,
+    0x5C, 0x64, 0xA1, 0xC2, 0x4D, 0x8A, 0xF4, 0xF9, 0x81, 0x5D, 0x2D, 0x53, 0xBB, 0x88, 0x91, 0x2F,
+    0x48, 0x91, 0x2A, 0x75, 0x8A, 0x00, 0x59, 0x67, 0xF8, 0x09, 0x83, 0xD8, 0xEA, 0x27, 0x81, 0x1F,
+    0x65, 0xA6, 0x58, 0xC3, 0x34, 0x30, 0x12, 0x73, 0x2E, 0x39, 0x8A, 0x64, 0xC3, 0x4D, 0x1A, 0x0D,
+    0xC0, 0x7D, 0x0C, 0xEF, 0xEB, 0x9C, 0x73, 0x79, 0x89, 0xA3, 0x80, 0x26, 0xFA, 0xF6, 0xC7, 0xD0,
+    0xD8, 0x85, 0x76, 0xFA, 0xB1, 0xAF, 0x9E, 0x0D, 0x47, 0x7F, 0xC5, 0x38, 0x6C, 0xA2, 0x6B, 0x2C,
+    0x6A, 0x8F, 0x62, 0x04, 0xD6, 0x80, 0xEE, 0xF7, 0x55, 0x8C, 0xDE, 0xC4, 0x1E, 0x9F, 0x3A, 0x54,
+    0x1E, 0xA5, 0x87, 0xE2, 0xD6, 0x89, 0x85, 0xE6, 0xD7, 0x01, 0xA0, 0x70, 0x87, 0x2F, 0x57, 0x28,
+    0xFE, 0xE6, 0xFF, 0xE8, 0x81, 0x0D, 0x80, 0x4F, 0x90, 0x9E, 0x4D, 0x9C, 0xD0, 0x71, 0x5D, 0x2C,
+    0xBF, 0xC6, 0x8E, 0xA6, 0x5C, 0x12, 0x57, 0x56, 0x39, 0x70, 0xF5, 0x40, 0x15, 0xA3, 0xAB, 0x63,
+    0xB4, 0xFA, 0x7C, 0x09, 0xED, 0x98, 0xD0, 0x02, 0x86, 0xAE, 0x0D, 0xD7, 0x62, 0x5E, 0x67, 0x74,
+    0xBF, 0x0A, 0xC5, 0x94, 0x0F, 0xCB, 0xFE, 0x04, 0xDA, 0x58, 0x74, 0x3D, 0x4A, 0x86, 0x3C, 0x4C,
+    0xB9, 0x54, 0xE7, 0x68, 0x00, 0x62, 0xAA, 0x7B, 0xED, 0x02, 0x42, 0x03, 0xF3, 0xC5, 0x70, 0x44,
+    0x44, 0xA1, 0x8A, 0x01, 0x4F, 0x21, 0xA8, 0xB0, 0x65, 0x46, 0x66, 0x6D, 0xED, 0x5D, 0x81, 0x55,
+    0xC5, 0x01, 0xCA, 0x8A, 0xF3, 0x43, 0xE4, 0xC2, 0x4D, 0xA0, 0xC1, 0xB3, 0x9E, 0x18, 0x8D, 0xA0,
+    0x38, 0xC8, 0x38, 0x8E, 0xE2, 0x0B, 0x18, 0xDA, 0xD7, 0x17, 0x5F, 0x6E, 0x8B, 0x8B, 0xD9, 0x54,
+    0x33, 0x9C, 0xA2, 0x39, 0x5A, 0x64, 0x38, 0xC2, 0x17, 0x93, 0xA8, 0x38, 0x4E, 0x64, 0x57, 0x7B,
+    0x75, 0xCA, 0x1F, 0x58, 0xD0, 0xAE, 0xEA, 0x99, 0x77, 0x55, 0x0D, 0xDC, 0x6D, 0x2D, 0x82, 0xBA,
+    0x84, 0xB1, 0x04, 0x3E, 0xA2, 0x8E, 0xEF, 0x90, 0x2B, 0xC0, 0x9E, 0x84, 0x64, 0x69, 0x9A, 0x3E,
+    0xFA, 0xB1, 0x23, 0x11, 0x63, 0xE2, 0x36, 0x17, 0x30, 0xDC, 0x47, 0x1B, 0x0D, 0xDA, 0x73, 0xEA,
+    0xE3, 0x4C, 0xAF, 0x7D, 0x39, 0x12, 0xCE, 0x54, 0x8E, 0xCC, 0x1E, 0x48, 0xDC, 0x9A, 0x39, 0x1A,
+    0x12, 0x2B, 0x2F, 0x49, 0xEF, 0x1F, 0x58, 0xA1, 0xB3, 0xDA, 0xFF, 0xDE, 0x17, 0xF1, 0xDD, 0x88,
+    0x66, 0xC7, 0xFC, 0x56, 0xA8, 0x14, 0x7A, 0x85, 0x87, 0x72, 0x50, 0x2F, 0xEA, 0x91, 0xAC, 0x8E,
+    0xD8, 0xA7, 0xB6, 0x7C, 0xBE, 0x29, 0xA8, 0x3B, 0x7E, 0x15, 0xD1, 0xA8, 0x50, 0x74, 0x57, 0x75,
+    0x09, 0xB3, 0x97, 0x96, 0x6C, 0x91, 0xFF, 0xE7, 0x8F, 0x7C, 0x23, 0x9A, 0x51, 0x3F, 0x4C, 0xC2,
+    0x16, 0xAD, 0xCA, 0x71, 0x56, 0x49, 0x78, 0x25, 0xBF, 0x86, 0xC8, 0x0B, 0xA1, 0xE0, 0x70, 0x43,
+    0xE4, 0xE5, 0x40, 0xBB, 0x35, 0x33, 0x56, 0xFE, 0x8C, 0xBB, 0x94, 0x4B, 0x3B, 0x33, 0xB0, 0x11,
+    0x36, 0x91, 0x69, 0xBA, 0xF8, 0x24, 0xF7, 0xCA, 0x3E, 0xEE, 0x42, 0xF5, 0xF7, 0xC8, 0x65, 0x94,
+    0x96, 0xB8, 0xEE, 0x20, 0x7C, 0xE7, 0x7E, 0x42, 0x9C, 0x56, 0x88, 0xA7, 0x97, 0x44, 0xB5, 0xB1,
+    0x2D, 0x79, 0x6F, 0x98, 0x54, 0x0B, 0xFA, 0x01, 0x0B, 0x86, 0x32, 0x76, 0x4B, 0x4C, 0xF2, 0xB2,
+    0xF6, 0x45, 0x50, 0x23, 0x15, 0x6A, 0x8B, 0x7F, 0x6C, 0x1D, 0x5F, 0x7B, 0x74, 0x7F, 0x0A, 0x8B,
+    0xA2, 0xD2, 0xC9, 0xDC, 0x54, 0xDA, 0x55, 0x4F, 0x1A, 0x2F, 0xEA, 0x53, 0xD6, 0x8C, 0xD0, 0xDE,
+    0x14, 0xF1, 0x3E, 0xAE, 0x9F, 0x5B, 0x40, 0x9E, 0x74, 0x4F, 0x8A, 0x48, 0xB4, 0x6F, 0x6F, 0x24,
+    0xBF, 0x0D, 0xE4, 0xB7, 0xD4, 0xDB, 0x33, 0x44, 0x08, 0xC4, 0x07, 0x12, 0x91, 0xEC, 0x5D, 0x9D,
+    0x2D, 0x3B, 0xBF, 0x67, 0xE7, 0xB1, 0x69, 0x33, 0xA1, 0x7B, 0xB8, 0xB5, 0xB6, 0x4F, 0x27, 0xDF,
+    0x48, 0x71, 0x32, 0xBB, 0xF4, 0x57, 0x96, 0x47, 0x5F, 0xE3, 0xFA, 0xE4, 0x19, 0xA9, 0x98, 0x61,
+    0x02, 0x59, 0x28, 0x39, 0x58, 0x88, 0x8E, 0x54, 0x6C, 0x99, 0x2C, 0x65, 0xD5, 0x6E, 0x21, 0x04,
+    0xEF, 0xE8, 0x45, 0xD0, 0xD1, 0x37, 0xFC, 0xE0, 0xB8, 0x5B, 0xCE, 0xE6, 0x96, 0xFE, 0xAB, 0x6C,
+    0x5E, 0x0E, 0x7A, 0x36, 0x5F, 0xAB, 0x64, 0xEE, 0x93, 0x74, 0x82, 0x57, 0x48, 0x92, 0xA3, 0xDF,
+    0x92, 0x87, 0x10, 0xE8, 0x77, 0x7C, 0x9D, 0x1F, 0x1F, 0xCC, 0xC2, 0xF5, 0x4C, 0x13, 0x4B, 0xE2,
+    0x88, 0xEB, 0xF1, 0x26, 0x06, 0xF5, 0xF6, 0x7C, 0x2A, 0x2E, 0xB1, 0x2A, 0x27, 0xAE, 0x91, 0x6B,
+    0xC0, 0x96, 0x2D, 0x19, 0x58, 0x5E, 0xA0, 0x52, 0x3B, 0xED, 0x8A, 0x51, 0xDB, 0x82, 0x13, 0xAD,
+    0x1C, 0xD8, 0x2B, 0xFD, 0x82, 0x2D, 0x79, 0x22, 0x74, 0x30, 0xCE, 0x6F, 0x48, 0x25, 0x68, 0x99,
+    0x37, 0xA7, 0x2F, 0x97, 0x8F, 0x5E, 0xB6, 0x04, 0x10, 0x7F, 0x90, 0x8F, 0xBE, 0xFD, 0x6F, 0x87,
+    0x83, 0xBA, 0x92, 0xC6, 0x21, 0x6D, 0x9D, 0x1C, 0x87, 0x76, 0xB9, 0x3C, 0x43, 0xE2, 0x22, 0xEF,
+    0x08, 0x19, 0x89, 0x24, 0x29, 0x71, 0x91, 0x77, 0x58, 0x41, 0x7D, 0x73, 0xE7, 0x3D, 0x28, 0x45,
+    0xF7, 0x8B, 0x4C, 0x7E, 0xA8, 0xA7, 0xCB, 0x19, 0xCA, 0x67, 0x0E, 0xBB, 0xB8, 0x53, 0x6F, 0x5F,
+    0x4D, 0x45, 0x24, 0x5F, 0x1F, 0x83, 0xE2, 0x04, 0x8A, 0xFA, 0x38, 0x94, 0x3D, 0xB6, 0x53, 0xF7,
+    0x7D, 0x2F, 0x31, 0x8F, 0x29, 0xB0, 0x55, 0x29, 0x5B, 0xC9, 0x82, 0x0D, 0x47, 0x99, 0x1C, 0xD0,
+    0x26, 0x93, 0x26, 0xCD, 0x2C, 0xDD, 0xB0, 0xCA, 0xD7, 0x90, 0x34, 0xBA, 0xD0, 0xCA, 0x6B, 0x84,
+    0x82, 0x24, 0xA3, 0x90, 0x2F, 0x26, 0xDE, 0x2F, 0x62, 0x2F, 0x46, 0x5D, 0x60, 0xB1, 0xA3, 0xE8,
+    0x74, 0xA7, 0x0E, 0x9F, 0x9B, 0x38, 0x1D, 0xEB, 0xF1, 0x20, 0x35, 0x2E, 0x7E, 0x16, 0x57, 0xEA,
+    0x99, 0xFA, 0x01, 0x49, 0x74, 0x24, 0x65, 0x91, 0xD4, 0x46, 0xEA, 0x80, 0xCC, 0x71, 0x3E, 0x87,
+    0xD1, 0x97, 0x24, 0xF0, 0x70, 0x99, 0xBC, 0x39, 0xED, 0xE4, 0x0A, 0x92, 0xF2, 0xB6, 0xB9, 0x41,
+    0x43, 0xAA, 0x4E, 0x6E, 0xD8, 0x26, 0x8F, 0x84, 0x45, 0xAE, 0x66, 0xF5, 0xDE, 0xF6, 0x2E, 0x6D,
+    0x4B, 0x4E, 0x7A, 0xCB, 0xBC, 0xFE, 0x9F, 0xCF, 0xBF, 0xAD, 0x55, 0xB1, 0x8E, 0xDC, 0x36, 0x10,
+    0x7D, 0x94, 0xCE, 0x11, 0x60, 0x15, 0x4C, 0xB1, 0x29, 0x03, 0x36, 0x2E, 0xEC, 0xC2, 0xD1, 0x0F,
+    0xDC, 0x6A, 0x55, 0x39, 0xED, 0x15, 0xBE, 0x8F, 0x70, 0xE5, 0xD6, 0xC5, 0xEE, 0x9D, 0xE0, 0x2F,
+    0xB8, 0x4F, 0x70, 0x71, 0x45, 0xCA, 0x14, 0x29, 0x5C, 0xAC, 0xB1, 0x34, 0xFC, 0x03, 0x5B, 0x04,
+    0x48, 0xE1, 0x46, 0x89, 0x91, 0xDA, 0x2C, 0x54, 0xC8, 0x80, 0x7C, 0xF4, 0x9B, 0xA1, 0xD6, 0xA7,
+    0xBD, 0xC2, 0x08, 0x8C, 0x08, 0xD2, 0xDE, 0x71, 0x48, 0xBE, 0x79, 0xF3, 0x66, 0x38, 0x2C, 0x63,
+    0xB7, 0x8A, 0xFE, 0xFC, 0x29, 0xF8, 0x5C, 0x23, 0xDF, 0xC3, 0x35, 0xD8, 0x22, 0x0B, 0xB0, 0x2D,
+    0x96, 0x30, 0x01, 0xA5, 0xC7, 0x0A, 0x18, 0x74, 0x0A, 0x9C, 0xCA, 0x3B, 0xD8, 0x06, 0x58, 0xE0,
+    0x2A, 0xF3, 0x8F, 0xE1, 0x62, 0x8B, 0x5D, 0x07, 0x9C, 0xC9, 0x7E, 0xAC, 0x22, 0x8A, 0xD8, 0xA1,
+    0xD8, 0xCB, 0x42, 0xD9, 0xC9, 0x7D, 0xB2, 0x9A, 0x30, 0xA8, 0x80, 0x9C, 0x7F, 0x6A, 0x08, 0x12,
+    0xD6, 0x47, 0xD3, 0xBD, 0x4E, 0xD3, 0x69, 0xC6, 0xDD, 0x97, 0x11, 0xB8, 0x87, 0x07, 0xA7, 0x99,
+    0xDF, 0xDD, 0x08, 0xF6, 0x42, 0x90, 0xEF, 0x37, 0xC2, 0xA6, 0x97, 0x4D, 0xD5, 0x11, 0x9B, 0x23,
+    0xA2, 0x04, 0xEF, 0x13, 0x0D, 0xE1, 0xB5, 0x51, 0x54, 0x9A, 0x49, 0x59, 0xEC, 0x6B, 0x1D, 0xDB,
+    0xBB, 0xE3, 0x56, 0xC0, 0x84, 0xC2, 0x56, 0xC7, 0xBB, 0x41, 0x19, 0xBC, 0x00, 0x5E, 0x03, 0xA7,
+    0xC0, 0x2F, 0x84, 0xF8, 0x13, 0xB8, 0x11, 0x52, 0x80, 0x11, 0x8F, 0x23, 0x1E, 0x6A, 0xB8, 0xD9,
+    0x15, 0x61, 0x36, 0xDC, 0x54, 0x7A, 0x42, 0xF6, 0x04, 0xAC, 0x08, 0x7F, 0xFB, 0x6F, 0x4B, 0xE0,
+    0x3F, 0x10, 0xF8, 0x9D, 0xC2, 0x5E, 0x99, 0x51, 0x11, 0xF0, 0xA3, 0x8A, 0x40, 0xB7, 0x59, 0x8B,
+    0xF4, 0xE4, 0x31, 0x98, 0x38, 0x88, 0x6C, 0x94, 0x40, 0x68, 0xD4, 0x2A, 0x4B, 0xE1, 0x75, 0x3C,
+    0xDE, 0x19, 0x53, 0xB3, 0x25, 0x24, 0x4D, 0xA5, 0x8E, 0xCB, 0xD8, 0x16, 0x91, 0xE6, 0xEB, 0x7C,
+    0xEF, 0x9A, 0x6D, 0x16, 0x6C, 0xBB, 0x34, 0xA1, 0xF4, 0x2B, 0x0C, 0x34, 0x60, 0x9B, 0x77, 0xDC,
+    0x49, 0x41, 0x7A, 0x7A, 0x20, 0x9D, 0x0D, 0x65, 0xE3, 0xA6, 0xAD, 0x50, 0x0E, 0xC4, 0x25, 0x0D,
+    0x09, 0xA1, 0xF0, 0x14, 0x50, 0xE2, 0xA0, 0xB7, 0x5A, 0xF4, 0x19, 0xE8, 0x90, 0x7C, 0x24, 0x8C,
+    0x4C, 0x02, 0x66, 0x2C, 0x1D, 0xDD, 0xDA, 0xC6, 0x48, 0x6C, 0xA5, 0xCF, 0x82, 0xC6, 0x4A, 0xE7,
+    0x35, 0xE5, 0x12, 0xF5, 0x34, 0x9F, 0x52, 0x2A, 0xC8, 0x38, 0xB2, 0x91, 0xA3, 0x15, 0xA9, 0xE2,
+    0x99, 0x44, 0x78, 0xC2, 0x2C, 0xAE, 0xE8, 0x67, 0x85, 0x37, 0xD4, 0xEE, 0x01, 0x0E, 0xCF, 0xB5,
+    0x79, 0x85, 0x3E, 0x0B, 0xA6, 0xCF, 0x43, 0x16, 0xF2, 0x8E, 0xDF, 0x3E, 0xEF, 0x0A, 0x9F, 0xEF,
+    0x4B, 0x5F, 0x78, 0xDB, 0x96, 0xDE, 0x36, 0xD6, 0xBB, 0xC6, 0xB6, 0x8E, 0xAE, 0x2B, 0x72, 0xAF,
+    0xE9, 0x76, 0xC9, 0xDF, 0x35, 0x7F, 0x29, 0x94, 0x7E, 0xE2, 0xA5, 0xD7, 0xF2, 0xC1, 0xAF, 0xCC,
+    0xAC, 0x78, 0xBE, 0x51, 0x74, 0x29, 0xCA, 0xCF, 0x48, 0x96, 0x81, 0xAB, 0x7A, 0x2B, 0xEA, 0x37,
+    0xC9, 0xB5, 0x9B, 0x28, 0x4B, 0x31, 0x28, 0x04, 0xCB, 0x45, 0xF2, 0x7F, 0x6B, 0xEC, 0x67, 0x46,
+    0x3B, 0x37, 0xAE, 0xEF, 0x18, 0xCD, 0x91, 0x91, 0x59, 0x95, 0x03, 0x50, 0x04, 0x98, 0xC8, 0x89,
+    0x1D, 0xBF, 0x1F, 0xD2, 0xF1, 0xF8, 0x89, 0x4B, 0x99, 0x4D, 0x37, 0x70, 0x47, 0x80, 0xA3, 0xE4,
+    0x67, 0x13, 0x9B, 0x47, 0x09, 0x99, 0x19, 0x56, 0x8C, 0x6D, 0xC2, 0x95, 0x73, 0xB6, 0x4E, 0x81,
+    0x89, 0xAB, 0xFA, 0x78, 0xD1, 0x90, 0x4E, 0x92, 0x9B, 0x2D, 0x6A, 0xB5, 0x5A, 0x78, 0x66, 0x32,
+    0x09, 0x9B, 0xE6, 0x82, 0x42, 0x9A, 0x81, 0x4B, 0x2F, 0x08, 0xE6, 0x5A, 0xD3, 0x17, 0x1D, 0x2A,
+    0x1A, 0xB2, 0x70, 0x41, 0x3C, 0xC7, 0xD2, 0xFF, 0x8B, 0x7E, 0x36, 0xDC, 0x54, 0x46, 0x62, 0xC5,
+    0x4B, 0x82, 0xBC, 0xED, 0x45, 0xA9, 0x96, 0x02, 0x49, 0x1F, 0x20, 0x8F, 0x9A, 0x69, 0xCB, 0x3B,
+    0x23, 0x75, 0x62, 0x99, 0x16, 0x9A, 0xB7, 0x49, 0x8B, 0x43, 0xF9, 0xEE, 0xA7, 0x44, 0x58, 0x49,
+    0xBE, 0x0C, 0x16, 0x87, 0x29, 0xE1, 0x59, 0x4F, 0xDF, 0x66, 0x5A, 0x95, 0x52, 0xF6, 0x1B, 0x98,
+    0x73, 0x13, 0x2C, 0x2B, 0x89, 0xE8, 0x81, 0x88, 0xFF, 0x04, 0xE4, 0xEF, 0x3D, 0x8A, 0x8F, 0x5E,
+    0xC9, 0xD8, 0x0F, 0x6C, 0x34, 0x2F, 0x29, 0x53, 0x33, 0x28, 0x95, 0x8A, 0x20, 0x29, 0xFB, 0xAE,
+    0xFD, 0xEA, 0xBA, 0x9E, 0x84, 0x27, 0x65, 0x23, 0x89, 0x68, 0xB4, 0x8B, 0xCD, 0xB0, 0xAB, 0xEF,
+    0xC0, 0x5E, 0x88, 0x8A, 0xB9, 0x36, 0x14, 0x27, 0xA5, 0x9B, 0xA4, 0x14, 0xDE, 0x52, 0x43, 0x92,
+    0x6D, 0xE9, 0x54, 0x41, 0x34, 0x60, 0xE8, 0x14, 0x84, 0x0B, 0x99, 0x1F, 0x4A, 0xC6, 0x84, 0x39,
+    0x0D, 0xBA, 0xD6, 0xF7, 0xE2, 0xFC, 0xE9, 0x65, 0x1C, 0x77, 0x71, 0xD4, 0xD4, 0xBF, 0x91, 0x9D,
+    0xDC, 0xC0, 0x45, 0x27, 0x33, 0x7D, 0xD2, 0xD2, 0xCD, 0xB1, 0x8B, 0x84, 0x7F, 0xC7, 0x45, 0x2B,
+    0xAF, 0x9B, 0xB9, 0x58, 0xFE, 0x0F, 0xC4, 0xF4, 0x19, 0xC4, 0xA3, 0x6C, 0x69, 0x53, 0x8B, 0xC2,
+    0xD4, 0x4C, 0xB5, 0x27, 0xCD, 0xBA, 0xFE, 0x5A, 0x2F, 0x86, 0xA9, 0xCF, 0x16, 0x87, 0x56, 0xDC,
+    0x09, 0xA9, 0xF5, 0xD7, 0x3B, 0x23, 0x3D, 0x5C, 0xFD, 0x1A, 0xB9, 0xC7, 0xE3, 0x74, 0x0C, 0xD7,
+    0x26, 0x48, 0x6B, 0xB2, 0x2D, 0x0F, 0x6E, 0xEE, 0x4D, 0xFF, 0xB3, 0x1E, 0xB3, 0x79, 0x19, 0x4F,
+    0x65, 0x3F, 0x95, 0x31, 0x61, 0xE4, 0xD2, 0x28, 0xA7, 0xB2, 0xE7, 0xA2, 0xE2, 0xDF, 0xF3, 0xC6,
+    0xC5, 0x88, 0x03, 0xEB, 0xF2, 0x5D, 0x97, 0xFF, 0x1D, 0x30, 0xB0, 0x2C, 0x5F, 0xC0, 0x2D, 0xFE,
+    0x53, 0x9F, 0xEF, 0xF4, 0xA8, 0xCE, 0xFB, 0xFE, 0xB7, 0x05, 0x3C, 0x29, 0x7D, 0x6D, 0xF9, 0xB6,
+    0x0F, 0xBF, 0x25, 0x60, 0x52, 0x47, 0xEE, 0x9B, 0xD9, 0x2D, 0x24, 0xEA, 0xDC, 0xC3, 0xB8, 0xCD,
+    0x3F, 0x04, 0xFB, 0xA4, 0x39, 0xA8, 0x53, 0x8B, 0x8F, 0xE2, 0xF6, 0x0E, 0xD3, 0xB8, 0x6F, 0x99,
+    0x6F, 0x8E, 0x98, 0xFF, 0x8E, 0x8B, 0x11, 0x15, 0x2B, 0x94, 0x67, 0x96, 0x1A, 0x93, 0xDF, 0x51,
+    0x24, 0x9F, 0xCE, 0xCF, 0x48, 0xA0, 0xA2, 0x24, 0x9A, 0x2F, 0x6D, 0xDA, 0xD2, 0xDE, 0xA7, 0xCB,
+    0x68, 0xD3, 0x54, 0xC1, 0x8E, 0x45, 0x6F, 0xFB, 0x72, 0xC4, 0x73, 0xBD, 0x97, 0xCC, 0xEC, 0x5E,
+    0x3A, 0x3C, 0x5F, 0x00, 0xBD, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xC6, 0x43, 0xE4, 0xC2,
+    0xC5, 0x50, 0x84, 0x2A, 0x52, 0xDC, 0x50, 0x67, 0xFE, 0x01, 0x76, 0x6D, 0xA0, 0x83, 0x82, 0x2B,
+    0xEE, 0xAA, 0xB4, 0xF4, 0xD7, 0xA6, 0xD8, 0xDD, 0x1B, 0x94, 0x92, 0xE6, 0x1A, 0xA8, 0xF9, 0x33,
+    0x28, 0xBC, 0xBB, 0xA3, 0x50, 0xA4, 0xA0, 0x38, 0x47, 0x88, 0x3A, 0x96, 0x92, 0xAB, 0x99, 0x24,
+    0x46, 0x71, 0x94, 0xD9, 0x1D, 0xBE, 0x67, 0xEF, 0x92, 0x43, 0x50, 0x20, 0x81, 0xE2, 0xD5, 0x8C,
+    0xD6, 0x63, 0x7B, 0xDE, 0xFB, 0x7E, 0xBC, 0x37, 0x00, 0x54, 0x0D, 0xC0, 0x78, 0x4E, 0x15, 0x07,
+    0x1A, 0x0E, 0xD5, 0xE1, 0xB0, 0x2E, 0xD7, 0x12, 0xB8, 0x87, 0x2D, 0x30, 0x43, 0x1A, 0x27, 0x87,
+    0x85, 0x7A, 0xEB, 0xD1, 0x64, 0xAF, 0x5A, 0x0C, 0xFA, 0x59, 0x87, 0x5E, 0x3F, 0x09, 0x2A, 0xE8,
+    0xB6, 0x57, 0x21, 0xF7, 0x4D, 0x16, 0x0A, 0xBF, 0xD0, 0x9D, 0x71, 0x73, 0xDD, 0x9A, 0xDA, 0xE6,
+    0xDE, 0xC0, 0x7C, 0xE9, 0x4B, 0x98, 0x6F, 0x9D, 0x45, 0x7E, 0xE5, 0xE6, 0xD0, 0x4F, 0xEB, 0x19,
+    0xB2, 0x84, 0x05, 0x54, 0x92, 0x78, 0x7B, 0xFC, 0x08, 0xAC, 0x25, 0xD4, 0x29, 0x47, 0x04, 0x74,
+    0x00, 0x0A, 0x2F, 0x61, 0x81, 0xDB, 0x53, 0x12, 0x3F, 0xD8, 0x0E, 0x2F, 0xD2, 0xA0, 0x5E, 0x5F,
+    0x47, 0x7E, 0xB9, 0xD6, 0x11, 0x4B, 0xBE, 0xD5, 0xE4, 0x1D, 0x62, 0xDE, 0x22, 0xF2, 0xED, 0xC1,
+    0x78, 0xD5, 0x1B, 0x97, 0x85, 0xB2, 0xD6, 0xC1, 0x42, 0x77, 0x15, 0x72, 0x19, 0xED, 0x5C, 0xF6,
+    0x7A, 0x8F, 0x20, 0x8E, 0x97, 0x20, 0x80, 0x11, 0x16, 0x05, 0x07, 0x3E, 0x91, 0xE9, 0xC3, 0xE3,
+    0xC3, 0xFF, 0x8A, 0xE7, 0x78, 0x95, 0x10, 0x38, 0xC0, 0x03, 0x0E, 0xB2, 0x86, 0x7A, 0x8A, 0x72,
+    0xC2, 0x55, 0xDD, 0x32, 0x7C, 0xC9, 0x85, 0x62, 0xC7, 0x35, 0xDD, 0xCB, 0x93, 0x93, 0xF7, 0xAD,
+    0xA9, 0xC2, 0x2D, 0xE8, 0x96, 0x19, 0xBE, 0x60, 0xFC, 0x2D, 0x33, 0xAA, 0x98, 0xD0, 0x47, 0xFF,
+    0x0B, 0x07, 0xE2, 0x12, 0x35, 0x4C, 0x8E, 0x19, 0x39, 0xB0, 0xC2, 0xF7, 0x17, 0x9F, 0xED, 0xF3,
+    0x87, 0xBF, 0xA4, 0x50, 0xBF, 0xBD, 0xDE, 0xE1, 0xC2, 0x1B, 0x67, 0x3D, 0x13, 0xEF, 0x54, 0xCF,
+    0xD7, 0x97, 0x18, 0xF8, 0xD2, 0x92, 0x6E, 0x97, 0xBD, 0x64, 0x6F, 0xDD, 0xA1, 0x51, 0x3D, 0x9D,
+    0x7F, 0x73, 0xF1, 0xDF, 0xD3, 0xE3, 0xFB, 0xEC, 0xEF, 0xF4, 0x94, 0x7F, 0xD2, 0x53, 0xBC, 0xA3,
+    0xE7, 0xB7, 0x23, 0x3D, 0x78, 0x47, 0xCF, 0x52, 0x48, 0x58, 0xE0, 0x80, 0x20, 0x63, 0x5C, 0x9D,
+    0x82, 0x4C, 0x8E, 0xC0, 0xBE, 0x1E, 0x09, 0x6A, 0x27, 0x82, 0x7E, 0x8D, 0xD9, 0x1E, 0x8B, 0x2C,
+    0x62, 0x41, 0x14, 0x0B, 0x49, 0x9A, 0x04, 0x0D, 0x37, 0x09, 0x32, 0x35, 0x49, 0x62, 0xFE, 0xC4,
+    0x40, 0x72, 0x72, 0x3F, 0x1B, 0x4D, 0x22, 0x65, 0x6D, 0xDC, 0xE4, 0x42, 0xB2, 0xF3, 0xC1, 0x8A,
+    0x7F, 0x19, 0xCB, 0x48, 0x7D, 0x6F, 0xF7, 0x12, 0x8A, 0xFC, 0xDD, 0x3A, 0x3B, 0x54, 0x7A, 0x96,
+    0x9E, 0x73, 0x99, 0x4B, 0xA6, 0xBF, 0x33, 0x30, 0x45, 0x1D, 0x8A, 0x6E, 0xE4, 0x1B, 0xE6, 0x11,
+    0x93, 0xAB, 0x64, 0xB7, 0x86, 0x5B, 0x64, 0x2F, 0x79, 0x57, 0xFC, 0xCC, 0xBB, 0x4A, 0x5A, 0x46,
+    0xE4, 0x8E, 0xF9, 0x33, 0x26, 0x6E, 0xBF, 0xE2, 0x52, 0x64, 0x9C, 0xA2, 0x5B, 0x49, 0x37, 0xD9,
+    0x21, 0xEF, 0xD5, 0x1E, 0x5B, 0x97, 0xA5, 0xD4, 0x4F, 0x01, 0xE9, 0x06, 0x11, 0x8A, 0x08, 0x53,
+    0x82, 0x3A, 0x9B, 0xEC, 0x78, 0xE7, 0x39, 0x43, 0x47, 0x54, 0xDF, 0xC7, 0xAC, 0x57, 0x43, 0xE9,
+    0x74, 0x68, 0x50, 0xFC, 0xD4, 0xC1, 0xD2, 0xBC, 0xCD, 0x02, 0xFA, 0x65, 0xA0, 0xD1, 0x58, 0xC2,
+    0xC4, 0x17, 0x56, 0x28, 0xEB, 0x5D, 0x36, 0xF0, 0x73, 0x87, 0x6D, 0x7F, 0x70, 0xF3, 0x65, 0x46,
+    0x28, 0x9E, 0x05, 0x56, 0x24, 0x22, 0x33, 0xFB, 0x9B, 0xDD, 0xCB, 0xEE, 0x6B, 0x2E, 0x4B, 0xC0,
+    0x4F, 0xB7, 0x8E, 0xC0, 0x2B, 0x6C, 0x80, 0x95, 0x78, 0x27, 0xDA, 0x9A, 0x1B, 0x32, 0xF9, 0xE2,
+    0x31, 0xBF, 0xB2, 0xBC, 0x43, 0x43, 0x69, 0xF4, 0x2B, 0x3E, 0x33, 0x57, 0x84, 0xB2, 0xAA, 0x44,
+    0x15, 0xE1, 0xEB, 0x11, 0x97, 0x36, 0xF4, 0xA5, 0x0E, 0xA6, 0xC5, 0x45, 0x5D, 0x76, 0x05, 0x8D,
+    0x94, 0x52, 0x3D, 0x05, 0x1C, 0xAB, 0xEA, 0x63, 0x5C, 0x22, 0x14, 0x04, 0x32, 0x70, 0xB8, 0x63,
+    0xA5, 0xA9, 0x4D, 0xCD, 0x17, 0xBD, 0x7E, 0x73, 0xEE, 0x6D, 0x5D, 0x7E, 0x33, 0xA0, 0xA2, 0x2C,
+    0xCD, 0x1C, 0x19, 0xCB, 0xA1, 0x78, 0xEC, 0x51, 0x91, 0xAD, 0xA1, 0x41, 0xFE, 0x24, 0xA0, 0xCA,
+    0x69, 0x52, 0xD3, 0x5A, 0x67, 0xB8, 0x45, 0x91, 0x8E, 0xF9, 0xE3, 0x84, 0x1D, 0x50, 0x77, 0xD4,
+    0xC9, 0x3C, 0x64, 0xAC, 0x7B, 0x05, 0xF7, 0x7E, 0x70, 0x57, 0x8A, 0xFC, 0xD8, 0x4B, 0x46, 0xD9,
+    0x6C, 0x22, 0x6A, 0x81, 0xA8, 0x29, 0x9F, 0x1F, 0x75, 0xA3, 0x5C, 0x2C, 0x1A, 0xC1, 0x28, 0x38,
+    0x82, 0x08, 0x17, 0xD6, 0x32, 0x09, 0xC8, 0x10, 0x0F, 0x53, 0xDE, 0x09, 0x03, 0xAD, 0xA0, 0xF4,
+    0x7C, 0x60, 0xDD, 0x28, 0x5D, 0x55, 0xAB, 0x1D, 0x46, 0x98, 0xE4, 0xAE, 0x3D, 0x68, 0x37, 0x71,
+    0x7A, 0x9B, 0x12, 0xCE, 0x69, 0x2A, 0xCB, 0x51, 0x32, 0x9B, 0xBB, 0xB9, 0x63, 0x95, 0x1F, 0xD2,
+    0x3D, 0xBF, 0x14, 0x07, 0xD1, 0xDF, 0xF7, 0x03, 0xAB, 0x7F, 0xC5, 0x9F, 0x94, 0x15, 0xED, 0xE9,
+    0x46, 0xCB, 0x5A, 0x15, 0xC6, 0x30, 0xE2, 0x53, 0xD5, 0xE7, 0x1E, 0x91, 0x05, 0xBC, 0x64, 0xB4,
+    0x0D, 0xAD, 0xC8, 0x10, 0x76, 0x87, 0xBF, 0x5C, 0xDB, 0x94, 0x92, 0xA7, 0x7B, 0x52, 0x0A, 0x7A,
+    0xA7, 0x76, 0x67, 0xA7, 0x44, 0x37, 0x27, 0x84, 0x01, 0xD2, 0xD7, 0xE2, 0xE8, 0xF1, 0x35, 0xB7,
+    0x1F, 0xCF, 0x2E, 0x52, 0x54, 0x3A, 0x69, 0x04, 0x45, 0x8B, 0x32, 0xED, 0xB9, 0x2A, 0xBA, 0x47,
+    0xE8, 0xDF, 0xCF, 0xEA, 0xE9, 0x31, 0x19, 0x99, 0x8D, 0xA7, 0x4B, 0x39, 0x1E, 0x74, 0xF2, 0xB5,
+    0xB8, 0x6D, 0x6C, 0x8E, 0xD2, 0x48, 0x2E, 0xDC, 0xEA, 0xEC, 0x54, 0xBE, 0xA2, 0x39, 0x45, 0xDF,
+    0xE4, 0x8F, 0xE7, 0x0F, 0x89, 0x38, 0x6F, 0x99, 0xCE, 0xE7, 0x69, 0xA0, 0x96, 0x57, 0xD7, 0xB1,
+    0x68, 0x75, 0xC2, 0x8C, 0x95, 0x17, 0x31, 0xB3, 0x92, 0x90, 0x88, 0x1A, 0xF2, 0x7E, 0x49, 0x39,
+    0x52, 0xBB, 0x18, 0xE1, 0x34, 0xE3, 0x41, 0x46, 0x75, 0x3B, 0x29, 0xF3, 0x22, 0x48, 0xC5, 0x97,
+    0x92, 0x6B, 0xBD, 0x89, 0xEA, 0x92, 0x32, 0x6F, 0x53, 0x9B, 0xA5, 0xB6, 0x14, 0xBB, 0x1C, 0x0C,
+    0x73, 0x3A, 0xB5, 0xB4, 0x7F, 0x38, 0x00, 0x2F, 0xE8, 0xE3, 0x2D, 0xDB, 0xC3, 0xEE, 0x7E, 0x64,
+    0xAE, 0x6B, 0x76, 0xA9, 0x39, 0x11, 0x8E, 0x83, 0xFD, 0x60, 0xC9, 0x66, 0x1F, 0x73, 0x9F, 0xF7,
+    0x22, 0x97, 0x49, 0x3B, 0x98, 0xEF, 0xE8, 0x83, 0xBA, 0x21, 0xD2, 0x25, 0x2B, 0xBF, 0x22, 0x6B,
+    0x96, 0xC3, 0x38, 0xE9, 0x73, 0xCC, 0xA5, 0x15, 0x0D, 0xB8, 0xEB, 0x1F, 0xB5, 0x55, 0xB1, 0x6E,
+    0x13, 0x41, 0x10, 0x7D, 0x7B, 0x97, 0xE4, 0x24, 0xAE, 0xB8, 0x14, 0x49, 0x15, 0xA1, 0x6B, 0x28,
+    0x10, 0x45, 0xDC, 0x52, 0xC4, 0xBE, 0xA5, 0xA1, 0x4E, 0x11, 0x2A, 0x0A, 0x28, 0x91, 0x28, 0xD2,
+    0x04, 0x29, 0x85, 0x1D, 0xDF, 0x1F, 0xE0, 0x06, 0x89, 0x0F, 0xA0, 0xA1, 0x82, 0x22, 0x05, 0x85,
+    0x13, 0x5F, 0x47, 0x7B, 0x4D, 0x6A, 0x4E, 0x28, 0x3D, 0x17, 0xB4, 0xC5, 0x05, 0xAD, 0xBD, 0xBC,
+    0xD9, 0x75, 0x52, 0x81, 0x14, 0x81, 0xBC, 0xF2, 0xD8, 0x67, 0xEF, 0xEC, 0x7B, 0xF3, 0x66, 0x67,
+    0xC6, 0x80, 0xD2, 0x80, 0x05, 0x7A, 0x40, 0x52, 0x41, 0xB5, 0xC0, 0x1A, 0x64, 0xDD, 0x8B, 0x0C,
+    0xAE, 0x1C, 0xF2, 0x93, 0x97, 0xD1, 0x82, 0xBB, 0x15, 0x62, 0x6E, 0x0D, 0xE8, 0x54, 0x03, 0x53,
+    0x20, 0xAB, 0x80, 0x8E, 0x1F, 0xDA, 0x1F, 0xE1, 0xE1, 0xB8, 0xF1, 0xDB, 0xC0, 0x78, 0xA1, 0x31,
+    0x73, 0x2D, 0xE6, 0xCF, 0x2D, 0x3D, 0xCE, 0x94, 0xC1, 0x20, 0x6A, 0x83, 0xD1, 0x67, 0x14, 0xD7,
+    0xB0, 0x49, 0x95, 0x98, 0xD4, 0xB9, 0x3A, 0x73, 0x73, 0x64, 0xEF, 0x3A, 0xA2, 0x4C, 0x91, 0x63,
+    0x44, 0x98, 0x82, 0x18, 0x3D, 0x5A, 0x56, 0x8E, 0x48, 0x31, 0x44, 0x5A, 0x4F, 0x3D, 0xF2, 0x72,
+    0xF5, 0x69, 0x43, 0x1A, 0x29, 0x23, 0xC6, 0x21, 0xA1, 0xE3, 0x61, 0x5A, 0xC7, 0x5F, 0x2D, 0x46,
+    0xD7, 0x65, 0xCA, 0x80, 0x66, 0xB7, 0xA1, 0xE5, 0x1A, 0xE4, 0x24, 0xA2, 0x07, 0xE8, 0x7B, 0x79,
+    0x3E, 0xF2, 0xD2, 0x6F, 0x2F, 0x57, 0x16, 0xBC, 0xF6, 0x80, 0x94, 0x60, 0xFB, 0xF2, 0x93, 0xC2,
+    0x3A, 0xE2, 0x9A, 0x07, 0xAE, 0x0C, 0xF1, 0x48, 0x53, 0x70, 0x67, 0x3B, 0xB8, 0xAF, 0x42, 0xDC,
+    0x16, 0x69, 0x4F, 0xD3, 0x12, 0xA6, 0x83, 0x72, 0x25, 0xE2, 0x6E, 0x29, 0xCC, 0x4B, 0x93, 0x3B,
+    0x48, 0xBE, 0xBD, 0x47, 0xAF, 0xF1, 0xDA, 0xE4, 0x12, 0x44, 0xC0, 0x08, 0x3E, 0x6C, 0x91, 0x2A,
+    0x49, 0x37, 0x41, 0x1D, 0xAF, 0x41, 0xA4, 0xDD, 0x24, 0xEC, 0x80, 0x4E, 0xB2, 0xD3, 0x84, 0x33,
+    0x92, 0xBC, 0xCD, 0xB0, 0x93, 0xB8, 0x06, 0x85, 0xB3, 0x70, 0x4F, 0xBE, 0xA8, 0x2E, 0xA0, 0xDE,
+    0x98, 0x9C, 0x50, 0x73, 0x91, 0x4A, 0xC0, 0x9C, 0x9B, 0x72, 0xFD, 0x18, 0xEB, 0x40, 0x26, 0x96,
+    0x2E, 0x3F, 0x7B, 0xE5, 0x91, 0x9A, 0x61, 0x4C, 0x98, 0x1E, 0xE1, 0x42, 0xEE, 0xD6, 0x35, 0xB2,
+    0x5A, 0x6A, 0x84, 0x2F, 0x26, 0x03, 0x5E, 0x87, 0x9A, 0x4D, 0x22, 0xE7, 0xA2, 0xEB, 0x1D, 0x6D,
+    0x7D, 0xB8, 0x3C, 0x2C, 0x0C, 0x94, 0xA4, 0x1C, 0xE1, 0x5A, 0x2F, 0x87, 0x11, 0xC6, 0xF5, 0x24,
+    0x6E, 0x0B, 0xD7, 0x25, 0xCE, 0xF0, 0x0A, 0x04, 0x0D, 0x21, 0xF9, 0x8E, 0xD5, 0xF7, 0xBD, 0x61,
+    0x26, 0x0D, 0x8B, 0x73, 0x73, 0xA5, 0x0A, 0xD4, 0x3E, 0x94, 0xF5, 0x8C, 0xC6, 0xA8, 0x36, 0x23,
+    0x9B, 0xFE, 0x1F, 0x05, 0x2B, 0x8A, 0xF4, 0x98, 0x6E, 0xA7, 0xB4, 0x33, 0x5A, 0x1E, 0x6C, 0x83,
+    0xCF, 0xE9, 0x25, 0x9F, 0x0F, 0x2F, 0x59, 0xA1, 0xD5, 0xF9, 0xD3, 0xBA, 0x08, 0x21, 0xB5, 0x1E,
+    0x51, 0x7A, 0x83, 0x2C, 0x91, 0xF5, 0x8D, 0x21, 0x15, 0x62, 0x1E, 0xC0, 0x66, 0x6E, 0xA1, 0x58,
+    0xA6, 0x8A, 0x5F, 0x3F, 0x93, 0x24, 0x34, 0xF3, 0xB1, 0x60, 0x45, 0xD7, 0xBE, 0x13, 0xD6, 0x10,
+    0xB3, 0x50, 0xA3, 0x9F, 0xAD, 0x4F, 0x09, 0xC6, 0xFC, 0x71, 0x6B, 0xB5, 0x25, 0xC4, 0x84, 0x27,
+    0xE5, 0x14, 0xBB, 0xCC, 0x32, 0x9B, 0x41, 0x52, 0x1B, 0x08, 0x37, 0x16, 0x9A, 0x57, 0x00, 0xEA,
+    0xBA, 0x19, 0x3D, 0x95, 0xC7, 0x14, 0xEC, 0xC4, 0x86, 0x4B, 0xA0, 0xB2, 0x30, 0x94, 0x78, 0x0B,
+    0x94, 0x46, 0x60, 0x2D, 0xA7, 0x0B, 0xE7, 0xAC, 0xD8, 0xF6, 0x8B, 0x8B, 0x83, 0x10, 0x42, 0x19,
+    0x7C, 0xA5, 0x5F, 0xC4, 0x06, 0x4B, 0xE3, 0x25, 0xCA, 0x84, 0x90, 0x71, 0xE8, 0x47, 0x84, 0xE8,
+    0x68, 0x43, 0xA7, 0x79, 0x6D, 0x0C, 0x51, 0x8A, 0x5A, 0x5A, 0x2D, 0x26, 0x44, 0x4A, 0x97, 0xB4,
+    0x0E, 0x3E, 0x92, 0xC2, 0xD7, 0x7C, 0x3E, 0x0F, 0x9D, 0x8B, 0x23, 0x26, 0x8E, 0xD8, 0x1B, 0x8B,
+    0x0F, 0x33, 0x57, 0x1F, 0x3E, 0x23, 0x2C, 0x11, 0xC8, 0xDB, 0x17, 0x6F, 0xCA, 0x2F, 0x84, 0x81,
+    0x60, 0x0C, 0x83, 0xAC, 0xAE, 0x55, 0xAE, 0xE2, 0x44, 0xCB, 0x7C, 0x8A, 0xFB, 0xC2, 0xFC, 0xA9,
+    0x92, 0x41, 0xC0, 0x74, 0xEC, 0x63, 0x4F, 0xFC, 0xE8, 0x98, 0x32, 0xA7, 0xB1, 0xF1, 0x35, 0x2A,
+    0x6B, 0x15, 0xB2, 0xFC, 0x1A, 0xF8, 0x79, 0x78, 0x8A, 0x37, 0x0D, 0xAE, 0x34, 0xBD, 0x76, 0x7E,
+    0x4D, 0x28, 0x62, 0xE7, 0x42, 0x33, 0x6E, 0xF2, 0x90, 0x86, 0x53, 0x33, 0xF7, 0x1C, 0x85, 0xF7,
+    0xEE, 0x7B, 0x0E, 0xBE, 0x0A, 0x8B, 0xDC, 0x4A, 0xD7, 0xDF, 0x25, 0xB6, 0x47, 0xB3, 0x8F, 0xBC,
+    0xA1, 0x39, 0xB6, 0xE7, 0x07, 0x77, 0x8E, 0xED, 0x2F, 0x69, 0x8D, 0x9D, 0xCD, 0x5D, 0xF3, 0xE7,
+    0xB4, 0xFA, 0x81, 0xB1, 0xC9, 0x89, 0x9A, 0xDA, 0xFB, 0xE4, 0xE5, 0xF0, 0x8E, 0xAA, 0x99, 0xBE,
+    0x1D, 0x24, 0xD8, 0x95, 0x80, 0x48, 0x6D, 0x79, 0x2C, 0x6E, 0x72, 0xF8, 0x81, 0x8D, 0x21, 0x71,
+    0xA3, 0x56, 0xA4, 0x96, 0x54, 0x37, 0x60, 0x4C, 0xCA, 0x10, 0x3F, 0xAD, 0x06, 0x4B, 0xF7, 0xCE,
+    0x4F, 0xB8, 0x5C, 0x7A, 0x8F, 0xEE, 0x53, 0x06, 0x1C, 0x4B, 0x00, 0xB9, 0x26, 0xB5, 0x45, 0x51,
+    0xF2, 0x1F, 0x53, 0xC4, 0xF1, 0xAD, 0x5C, 0xCE, 0x73, 0xA5, 0xD7, 0x90, 0x99, 0x3D, 0x86, 0x60,
+    0xF0, 0x38, 0x6F, 0x18, 0x93, 0xE7, 0x8F, 0x26, 0x78, 0x45, 0xAC, 0x29, 0x25, 0x76, 0x04, 0x30,
+    0x59, 0xC9, 0xB9, 0xC3, 0xB4, 0xE7, 0x3A, 0x6E, 0x7A, 0x04, 0x2D, 0x38, 0x4B, 0x07, 0x24, 0xEE,
+    0x33, 0x8F, 0xFC, 0x17, 0x29, 0x87, 0xAC, 0xFA, 0x93, 0xE8, 0x87, 0x2E, 0xDC, 0x5B, 0x64, 0xF3,
+    0x7C, 0x39, 0x63, 0xFF, 0x75, 0xFD, 0x06, 0xBD, 0x54, 0x3D, 0x6F, 0xDD, 0x36, 0x14, 0x3D, 0x24,
+    0x6B, 0x28, 0xAD, 0x90, 0xB0, 0x43, 0x02, 0x14, 0xCE, 0xA0, 0x7F, 0x60, 0xAD, 0x1D, 0x2C, 0x89,
+    0x68, 0x86, 0x0E, 0x59, 0xBC, 0x78, 0xEF, 0x98, 0x9F, 0x50, 0x14, 0xB2, 0x2D, 0xB4, 0x43, 0x06,
+    0x0F, 0xED, 0x3F, 0x68, 0x86, 0x0C, 0x81, 0xA7, 0x0E, 0x1E, 0x5E, 0x81, 0x67, 0x98, 0xE9, 0xDA,
+    0xA1, 0x0A, 0x12, 0xA0, 0x63, 0x04, 0x34, 0x5B, 0x06, 0x73, 0x10, 0x1A, 0x15, 0x7E, 0x0E, 0x7B,
+    0xAE, 0x3E, 0x8C, 0x4E, 0x5D, 0xEA, 0x86, 0x0F, 0xE2, 0x7B, 0xE2, 0xBB, 0xBC, 0xF7, 0x9C, 0x7B,
+    0x0E, 0x09, 0x15, 0x37, 0x80, 0x8D, 0x01, 0xB8, 0xB7, 0xEF, 0x20, 0x43, 0x77, 0xD0, 0xC1, 0x36,
+    0xB0, 0xBE, 0x00, 0x4A, 0xC5, 0x7F, 0xFA, 0xD4, 0x23, 0xF1, 0x15, 0x90, 0x63, 0x00, 0x06, 0xD3,
+    0xC2, 0x74, 0x19, 0x90, 0xB9, 0x35, 0xB0, 0x36, 0x4B, 0x78, 0x73, 0x00, 0x14, 0x0C, 0x57, 0x81,
+    0xE1, 0xA9, 0xCF, 0xB9, 0x19, 0x6B, 0xA8, 0x5E, 0xF5, 0x4C, 0x65, 0x06, 0xBD, 0x41, 0x12, 0x63,
+    0xCB, 0x89, 0x39, 0x70, 0x57, 0x2A, 0xD9, 0xD8, 0x21, 0xE3, 0xB3, 0x35, 0x55, 0xD6, 0x3F, 0xE0,
+    0x51, 0xD2, 0x62, 0x9D, 0x78, 0x0C, 0x4C, 0xD1, 0xDB, 0x46, 0x05, 0xEB, 0x74, 0xC8, 0x9C, 0xE9,
+    0x72, 0x96, 0xAC, 0x90, 0xB4, 0x25, 0x33, 0x17, 0xCC, 0x77, 0x80, 0xBC, 0xA9, 0x71, 0xE4, 0x0E,
+    0xF5, 0x85, 0xAB, 0xE2, 0xF7, 0xB0, 0x57, 0x04, 0x24, 0x59, 0x54, 0xF3, 0x31, 0x90, 0xBA, 0x53,
+    0xC2, 0x8B, 0x9E, 0x88, 0xC9, 0x0E, 0x5B, 0x98, 0xC6, 0xCE, 0xCC, 0x60, 0xB3, 0x30, 0xB0, 0xC2,
+    0xA0, 0x36, 0x61, 0x61, 0x30, 0x13, 0x56, 0xFD, 0xC8, 0xA0, 0x5C, 0x08, 0x13, 0x94, 0x69, 0x85,
+    0x30, 0x84, 0xB0, 0x0E, 0xDC, 0xCC, 0x80, 0xCC, 0x65, 0x0E, 0x1B, 0x54, 0x4D, 0xEE, 0x71, 0x14,
+    0xAF, 0xC0, 0xA9, 0x61, 0x7D, 0x01, 0x71, 0x0B, 0x5F, 0xE1, 0x0E, 0x02, 0x09, 0x72, 0x67, 0xE4,
+    0xCA, 0xA7, 0xB8, 0x31, 0x82, 0xB8, 0x2F, 0x55, 0x2E, 0xC9, 0xCD, 0x26, 0x7C, 0xFF, 0xFC, 0x36,
+    0x97, 0x4E, 0x7F, 0xE2, 0x24, 0x75, 0xE6, 0x42, 0x1F, 0x50, 0x43, 0xFC, 0x0C, 0x98, 0x0B, 0x87,
+    0xE4, 0x01, 0xF3, 0x6B, 0x0F, 0xF3, 0xB8, 0x81, 0x8E, 0xB8, 0x59, 0xCA, 0xCA, 0xED, 0x11, 0xB8,
+    0xF5, 0xC4, 0x55, 0x0B, 0x6F, 0x92, 0x0F, 0xBB, 0x5C, 0x9E, 0xFE, 0x05, 0x56, 0x13, 0x07, 0xC3,
+    0xD4, 0xE4, 0xC0, 0x90, 0x42, 0x0B, 0x07, 0x3B, 0xAB, 0x58, 0xA2, 0x17, 0x15, 0x09, 0xB0, 0xCD,
+    0xE7, 0x06, 0x8C, 0xE1, 0x1D, 0x05, 0xB4, 0x8E, 0xE1, 0xB5, 0x16, 0x0B, 0x10, 0x9F, 0x6D, 0x18,
+    0x70, 0xC0, 0x0F, 0x3D, 0xF1, 0x1E, 0xE7, 0x50, 0x31, 0xF6, 0x9C, 0xDE, 0x5F, 0x9B, 0xE8, 0xDE,
+    0x96, 0x43, 0xF6, 0x65, 0x0B, 0xFB, 0x5D, 0x8B, 0x54, 0x9E, 0x2F, 0xDA, 0x6B, 0x18, 0x9F, 0x38,
+    0xF5, 0x44, 0xB8, 0xB2, 0x7F, 0xD2, 0x35, 0xEB, 0x4A, 0x76, 0x5C, 0xC8, 0x72, 0x71, 0xD0, 0xB2,
+    0xB8, 0x61, 0xBF, 0x85, 0xAD, 0x75, 0x86, 0x8B, 0x7A, 0x50, 0x41, 0x5D, 0x41, 0xE8, 0xDA, 0xF8,
+    0x87, 0x47, 0x7C, 0x41, 0xD0, 0x1F, 0x4A, 0x3C, 0xC6, 0xC2, 0xB0, 0x8F, 0x28, 0x04, 0x7A, 0x90,
+    0xB7, 0x37, 0x9C, 0xD2, 0x80, 0xC9, 0xC3, 0xFF, 0x5D, 0x38, 0x11, 0xA8, 0x9B, 0x8A, 0x88, 0x60,
+    0xC9, 0x2B, 0xFE, 0xDE, 0x2C, 0xC6, 0xD8, 0x1B, 0x3B, 0x76, 0x3E, 0xCD, 0xAD, 0xCC, 0xEB, 0x7A,
+    0x54, 0x32, 0x69, 0x46, 0x67, 0xED, 0xE1, 0xDA, 0xC8, 0xA4, 0x76, 0x30, 0x20, 0xED, 0x50, 0x55,
+    0x30, 0x03, 0xB2, 0x87, 0x9E, 0xFE, 0x4A, 0x7F, 0x09, 0xB8, 0xF4, 0xA6, 0x5B, 0xE3, 0x2C, 0xE8,
+    0x90, 0xA3, 0xA8, 0x05, 0x66, 0x66, 0x45, 0x4A, 0xFB, 0x80, 0xA2, 0xD7, 0x89, 0x27, 0xD6, 0xCC,
+    0x74, 0xBB, 0xA9, 0x4F, 0x9E, 0x07, 0x6B, 0x5A, 0x15, 0x06, 0xC3, 0x5D, 0xF5, 0x2E, 0xFA, 0x1E,
+    0xD9, 0x8E, 0x6C, 0x31, 0xBF, 0xC1, 0x1E, 0x02, 0xEF, 0xBC, 0x79, 0x0D, 0x54, 0x2D, 0x78, 0x80,
+    0x6D, 0x00, 0xCF, 0xB3, 0xE9, 0xA5, 0x20, 0xF5, 0xD2, 0x3D, 0xE6, 0x86, 0x00, 0xE2, 0x02, 0x54,
+    0xD2, 0x20, 0x7B, 0x4C, 0x94, 0xA6, 0x2D, 0x46, 0x36, 0xB3, 0x07, 0x75, 0xA3, 0x9E, 0xE0, 0x51,
+    0x8D, 0xCA, 0xD9, 0xC7, 0x3E, 0xED, 0x55, 0x28, 0x70, 0xE9, 0x2A, 0xD3, 0xEE, 0x9C, 0x26, 0x6D,
+    0x61, 0x7E, 0x75, 0xBC, 0x74, 0xEA, 0x95, 0x75, 0x85, 0x7D, 0xF8, 0x6D, 0x30, 0x2F, 0xC2, 0xAA,
+    0x40, 0x51, 0x24, 0xC7, 0xDE, 0xFC, 0xEE, 0xBF, 0x1E, 0x50, 0x9C, 0x26, 0x3F, 0x82, 0x20, 0xBE,
+    0x21, 0xCB, 0x2E, 0xD9, 0x48, 0xA3, 0xAA, 0x86, 0x5D, 0x35, 0x61, 0x6E, 0x16, 0xC5, 0x43, 0xCA,
+    0x3B, 0x26, 0x67, 0x67, 0x57, 0x69, 0x83, 0xBD, 0x09, 0x12, 0x11, 0xAC, 0x4B, 0xA8, 0x81, 0x8A,
+    0x84, 0x0C, 0x69, 0x6B, 0x9D, 0x6D, 0x6C, 0x53, 0x51, 0x97, 0x35, 0x9B, 0x3E, 0xC0, 0xBC, 0xE4,
+    0x65, 0xF5, 0xD6, 0xF3, 0x44, 0x3A, 0xDA, 0x18, 0xC2, 0x08, 0x62, 0x21, 0x39, 0x10, 0x62, 0x2C,
+    0xBA, 0x92, 0x5A, 0x4E, 0x0F, 0xD5, 0xE6, 0xBE, 0x6B, 0xBA, 0x95, 0x50, 0x94, 0x2D, 0xE5, 0xCE,
+    0xCC, 0xF5, 0xA3, 0xE5, 0x76, 0xD9, 0x06, 0x9E, 0xA1, 0xE6, 0x06, 0x3A, 0x8B, 0x9A, 0xC8, 0x17,
+    0xCB, 0x7A, 0xDA, 0xAD, 0x5E, 0xFC, 0x98, 0x63, 0xAC, 0x0F, 0x2B, 0x19, 0x77, 0x79, 0x06, 0xF1,
+    0xA7, 0x94, 0x7A, 0xCD, 0xCC, 0xA9, 0x60, 0xC8, 0x44, 0xF3, 0x23, 0xA9, 0x25, 0x0D, 0xB6, 0x22,
+    0x3A, 0xBD, 0x8C, 0xA4, 0x9B, 0x97, 0xCF, 0x05, 0xDC, 0xD8, 0x70, 0x96, 0x25, 0x06, 0xA6, 0x29,
+    0x59, 0xE1, 0x33, 0x8D, 0x65, 0xFC, 0x3F, 0xD4, 0xC7, 0x63, 0x3E, 0x76, 0xFD, 0x4C, 0x50, 0x2E,
+    0x87, 0x64, 0xB9, 0x56, 0x23, 0xAF, 0x82, 0x8A, 0x87, 0x48, 0x9F, 0x9C, 0x48, 0xBA, 0xDC, 0x4D,
+    0x90, 0x95, 0xBC, 0x54, 0x42, 0x84, 0xC1, 0xA3, 0x65, 0x0E, 0xE7, 0x97, 0x31, 0xD5, 0xD5, 0x3F,
+    0x42, 0xB1, 0x84, 0xA6, 0xAC, 0xA9, 0xFF, 0xDA, 0xDF, 0x97, 0x7C, 0xC1, 0xC4, 0x28, 0x10, 0x15,
+    0x95, 0xCE, 0xFC, 0x18, 0x23, 0x70, 0x56, 0x8B, 0xF3, 0xB0, 0x7D, 0xF2, 0x14, 0x31, 0x76, 0x6A,
+    0xFF, 0x88, 0x64, 0x86, 0xA9, 0x61, 0x9B, 0xA9, 0xC2, 0xD9, 0x04, 0xBF, 0x9C, 0x6A, 0x55, 0x13,
+    0x31, 0x5E, 0x6C, 0x8C, 0x0F, 0x3C, 0xEF, 0x1E, 0xFF, 0x3A, 0xFE, 0x06, 0x8D, 0x55, 0x4F, 0x68,
+    0x14, 0x57, 0x18, 0xFF, 0xDE, 0xBC, 0x8D, 0x53, 0x9D, 0x26, 0x6F, 0x0B, 0x6B, 0xB1, 0x31, 0xC9,
+    0x48, 0xF1, 0x20, 0x21, 0xC9, 0x78, 0xC8, 0x61, 0x0B, 0x33, 0x99, 0xC1, 0x1C, 0x2C, 0xF6, 0xB2,
+    0xA2, 0x63, 0x8F, 0xE6, 0xD0, 0x93, 0x50, 0x9A, 0xC3, 0x1E, 0x56, 0xD8, 0x64, 0x47, 0x53, 0xF1,
+    0x50, 0x68, 0x97, 0xD2, 0xD2, 0x4B, 0x69, 0x3D, 0x78, 0x88, 0x23, 0x45, 0x0F, 0x1E, 0x52, 0xD8,
+    0x75, 0x87, 0xA4, 0x7F, 0x40, 0x2F, 0x2F, 0xF6, 0x10, 0xA8, 0x05, 0xA7, 0xA8, 0x85, 0xDA, 0x43,
+    0x5F, 0xCB, 0x80, 0x93, 0x3A, 0x9B, 0xD7, 0xEF, 0xCD, 0x44, 0x8D, 0x20, 0xA5, 0xC3, 0xCE, 0xEE,
+    0xBE, 0xF7, 0xBE, 0xF7, 0xFD, 0xF9, 0x7D, 0xBF, 0xDF, 0x7B, 0x00, 0xE0, 0x01, 0x80, 0x8B, 0x2F,
+    0x8D, 0xF1, 0xEB, 0x10, 0x3C, 0x7F, 0x2C, 0x29, 0x63, 0x2A, 0x65, 0x1F, 0xC6, 0xC3, 0x6B, 0x11,
+    0x80, 0x96, 0xE0, 0xDC, 0x22, 0xBE, 0x26, 0x0E, 0xA8, 0xC0, 0x3F, 0x99, 0x32, 0xC2, 0xED, 0x7A,
+    0xBC, 0x3D, 0x50, 0x6E, 0x18, 0xDF, 0x61, 0xCA, 0x9E, 0x9A, 0x76, 0x95, 0xE9, 0xE7, 0x7E, 0x0D,
+    0xFD, 0x49, 0x70, 0xA5, 0x54, 0x73, 0x15, 0xDC, 0xC9, 0xF3, 0x25, 0x2D, 0x78, 0x1A, 0xF3, 0x4C,
+    0xD8, 0x66, 0x72, 0x0B, 0xFC, 0xD3, 0x1C, 0x48, 0x0A, 0x30, 0x93, 0xBB, 0x50, 0x1E, 0xD0, 0xCA,
+    0xF4, 0xF2, 0x1C, 0xB3, 0x3C, 0x8E, 0x11, 0x01, 0xC1, 0x28, 0xAE, 0xCC, 0x74, 0x29, 0x31, 0x4A,
+    0x0D, 0xEB, 0xD0, 0x83, 0x15, 0x00, 0x07, 0xF7, 0x10, 0x89, 0x0E, 0x8D, 0xB8, 0x88, 0xA1, 0x1E,
+    0x4D, 0xA2, 0x53, 0x0C, 0xCB, 0xB5, 0x30, 0xDC, 0x99, 0x35, 0x79, 0x96, 0x75, 0xF4, 0xB2, 0xAC,
+    0xFB, 0x2F, 0x2B, 0xD0, 0x50, 0x05, 0x6E, 0xFA, 0x7E, 0x5E, 0x46, 0x5E, 0x0F, 0x94, 0x30, 0x8E,
+    0x43, 0x39, 0xD8, 0x0B, 0x00, 0x3D, 0x9E, 0xEF, 0x23, 0xB5, 0x3C, 0xF0, 0x70, 0x78, 0x19, 0x10,
+    0x46, 0xE2, 0xB7, 0xBC, 0xBC, 0x20, 0x16, 0xE4, 0x8E, 0x54, 0x84, 0x6E, 0x51, 0xFE, 0x4C, 0x11,
+    0x0B, 0x3D, 0x6B, 0x22, 0xAF, 0x11, 0xED, 0x45, 0x51, 0x53, 0x9E, 0x3E, 0x91, 0x08, 0x85, 0xC2,
+    0x4B, 0xC5, 0x77, 0x54, 0x42, 0x90, 0x57, 0x5F, 0xF4, 0x4B, 0xA5, 0xDC, 0xDC, 0x9E, 0x64, 0xFF,
+    0x35, 0x49, 0x5E, 0x98, 0xC4, 0x2C, 0x30, 0xDD, 0x62, 0xB2, 0xF3, 0x14, 0x82, 0xA0, 0x68, 0xAD,
+    0x2A, 0xC0, 0xE2, 0x2A, 0x38, 0x15, 0x26, 0xAC, 0x50, 0x5E, 0x82, 0x1A, 0x8B, 0xBA, 0x3A, 0xB7,
+    0x15, 0x55, 0x2A, 0xD8, 0x60, 0x2A, 0x21, 0x5D, 0x71, 0xE8, 0x3A, 0x94, 0x88, 0x57, 0x32, 0xD2,
+    0x11, 0x53, 0x66, 0x36, 0x13, 0x65, 0xF0, 0x5A, 0xD2, 0x95, 0xDF, 0xFB, 0xB5, 0xF1, 0x30, 0x34,
+    0xA5, 0x5C, 0x0D, 0xC3, 0xF6, 0x01, 0xF2, 0x15, 0xB9, 0x2F, 0x45, 0x4B, 0x10, 0x0F, 0x2A, 0x9D,
+    0xEC, 0x3D, 0x20, 0x8C, 0x6E, 0x44, 0x49, 0xBB, 0xE2, 0x9E, 0xBF, 0x49, 0xE2, 0x29, 0x77, 0x29,
+    0x9A, 0x06, 0xA3, 0xFD, 0xE4, 0xA7, 0xD9, 0x5F, 0x8C, 0x6A, 0xA3, 0x15, 0x95, 0xB1, 0x8F, 0x15,
+    0x1A, 0xA7, 0x6C, 0x29, 0x9E, 0x32, 0x82, 0xC6, 0x18, 0x94, 0xCB, 0x50, 0x86, 0xD9, 0xA8, 0x69,
+    0x5A, 0x20, 0x23, 0x5D, 0x28, 0x3C, 0x28, 0x4F, 0x6C, 0xD3, 0x58, 0xE2, 0x42, 0x51, 0x55, 0x5F,
+    0xBB, 0x13, 0x8B, 0xB4, 0xE9, 0x58, 0x7B, 0x76, 0x79, 0x95, 0x01, 0x48, 0x67, 0x88, 0x68, 0x6A,
+    0xF1, 0x0A, 0x8D, 0x04, 0xC1, 0x64, 0xE7, 0x10, 0x4E, 0x92, 0x68, 0xBB, 0xF7, 0x55, 0xE9, 0x9A,
+    0x4C, 0x58, 0x1F, 0xFB, 0x44, 0x2E, 0xEB, 0xF2, 0xE2, 0xA3, 0xBF, 0xA3, 0x51, 0x8F, 0x00, 0xC4,
+    0x8E, 0x1E, 0xA5, 0x16, 0x8D, 0xBB, 0x03, 0x1E, 0x8D, 0x17, 0x58, 0x94, 0x58, 0x94, 0x37, 0x08,
+    0x34, 0x17, 0x1C, 0xC7, 0x99, 0x1C, 0x2D, 0xED, 0x9C, 0xDB, 0xC6, 0x22, 0x2A, 0xC1, 0x49, 0x83,
+    0x2F, 0xD2, 0xD8, 0xC9, 0x65, 0xC3, 0x5E, 0xFF, 0xA3, 0xFF, 0x6E, 0x64, 0x63, 0x71, 0xD0, 0xD0,
+    0x1E, 0xB2, 0xBE, 0x53, 0xC3, 0xB8, 0x4A, 0x4A, 0x32, 0x1B, 0xBF, 0x1A, 0x41, 0x15, 0x19, 0x09,
+    0x37, 0x80, 0x01, 0x08, 0xD8, 0x0D, 0x39, 0x85, 0x52, 0x4D, 0x18, 0xDC, 0xF5, 0x0E, 0x82, 0xFE,
+    0xCE, 0x52, 0xC0, 0x6D, 0x1D, 0x59, 0x11, 0x30, 0xB0, 0xF7, 0x6F, 0xF6, 0xB0, 0x15, 0xE3, 0xCB,
+    0x6E, 0xA6, 0x47, 0x7A, 0x60, 0x28, 0xDF, 0x60, 0x80, 0x6D, 0xCA, 0x0F, 0x1E, 0x4C, 0x62, 0x19,
+    0x67, 0x42, 0x19, 0xE7, 0x7E, 0x63, 0xE6, 0x35, 0x89, 0x30, 0x2E, 0x74, 0x2D, 0xB1, 0xA8, 0x86,
+    0x58, 0x40, 0xC7, 0x08, 0xBA, 0x47, 0x33, 0x2B, 0x82, 0x19, 0xD7, 0xC1, 0x86, 0xB0, 0x23, 0xF7,
+    0x79, 0x5A, 0xDB, 0x87, 0xA0, 0x6E, 0xD0, 0x2F, 0x59, 0xA3, 0xD1, 0x53, 0xA0, 0xD2, 0x75, 0x21,
+    0xEA, 0x15, 0xA0, 0x9E, 0x60, 0xD1, 0x94, 0xF6, 0xA8, 0xB3, 0x05, 0x88, 0x90, 0x4D, 0x23, 0xE7,
+    0x48, 0x86, 0xF9, 0x6A, 0x71, 0xE2, 0x98, 0xFA, 0x6A, 0x9C, 0x1C, 0x42, 0xA5, 0x2F, 0xA3, 0xA2,
+    0x1A, 0x60, 0xDF, 0x00, 0x5B, 0x40, 0xA3, 0x86, 0xE8, 0x03, 0xCC, 0xDB, 0x43, 0x67, 0xBB, 0x4D,
+    0xEB, 0x9E, 0x52, 0x44, 0x19, 0x4E, 0x70, 0x87, 0x99, 0x5E, 0x8F, 0xD3, 0x04, 0xF6, 0x2A, 0xD9,
+    0x59, 0x91, 0xDE, 0x27, 0x7F, 0x89, 0x8E, 0x7E, 0x01, 0x2A, 0x6D, 0xCD, 0xA6, 0xB7, 0x65, 0x8C,
+    0x7C, 0xC7, 0xBA, 0x2E, 0x53, 0xB9, 0xF6, 0x4F, 0x1A, 0x33, 0xE4, 0x05, 0xF1, 0x2A, 0x2D, 0x7E,
+    0xFF, 0x4F, 0x39, 0x6A, 0x24, 0x65, 0x82, 0xBA, 0xF9, 0x5A, 0xAE, 0xFB, 0xB5, 0xBD, 0xBE, 0x7F,
+    0x5A, 0xCA, 0xDF, 0xC2, 0xF0, 0x52, 0x21, 0xD0, 0x0C, 0x69, 0xA3, 0x0A, 0xC7, 0x79, 0xA4, 0xBF,
+    0xF0, 0x51, 0x61, 0x48, 0x2F, 0x96, 0x4C, 0x58, 0x32, 0xAD, 0x9A, 0x48, 0x2F, 0xCC, 0xEE, 0x4A,
+    0x4F, 0x6E, 0x9D, 0x09, 0x97, 0xD1, 0xC4, 0xF7, 0x7B, 0x28, 0xBD, 0xAD, 0x10, 0x9F, 0x2B, 0x90,
+    0xB3, 0xB8, 0x15, 0x58, 0xDC, 0xE2, 0xC8, 0xF5, 0xD2, 0xB3, 0x13, 0x6C, 0x0A, 0x5F, 0x1B, 0x5F,
+    0x14, 0x1E, 0x11, 0x05, 0xE5, 0x75, 0x64, 0x38, 0xDB, 0xB1, 0x94, 0x3C, 0x5F, 0x32, 0xFE, 0xFF,
+    0xD2, 0x7B, 0x79, 0x83, 0x88, 0x98, 0x30, 0x8C, 0x8F, 0x02, 0x3C, 0x34, 0xF7, 0xD9, 0x30, 0x81,
+    0xA8, 0x7D, 0xEB, 0x37, 0xA5, 0x4C, 0x7D, 0x5F, 0x69, 0x1F, 0x71, 0x7C, 0xCB, 0x6F, 0xD6, 0xA1,
+    0x7A, 0x1D, 0xEA, 0x3D, 0x29, 0x8A, 0x32, 0xD9, 0xE3, 0xD4, 0x59, 0x7C, 0xFF, 0x7A, 0x75, 0x14,
+    0xD4, 0xA1, 0x31, 0xD9, 0x34, 0xB1, 0x21, 0xAE, 0xA8, 0x8B, 0xDC, 0x1D, 0x5F, 0xA0, 0xDC, 0x50,
+    0x6C, 0xD0, 0xC4, 0xCC, 0xB3, 0x63, 0x2B, 0x1B, 0x0E, 0xC3, 0xE0, 0x19, 0x2A, 0x09, 0xFE, 0x6C,
+    0x73, 0x51, 0xE3, 0x25, 0x52, 0x33, 0x83, 0xCC, 0x08, 0x56, 0x14, 0xDA, 0x2F, 0x0A, 0x71, 0x9C,
+    0x22, 0x91, 0x6C, 0x95, 0xF1, 0xB0, 0x57, 0xCE, 0xE8, 0xC6, 0xDD, 0x7B, 0x8B, 0x33, 0x07, 0xC5,
+    0x1C, 0x36, 0xFB, 0x0D, 0x36, 0xCB, 0xB7, 0xAC, 0x20, 0x27, 0xA9, 0xCC, 0x66, 0xC2, 0xAB, 0x17,
+    0x03, 0xA8, 0xDF, 0x00, 0xE3, 0x18, 0x80, 0x4A, 0x90, 0xBC, 0x10, 0x91, 0x6E, 0x47, 0x54, 0x42,
+    0x5B, 0x17, 0xC9, 0x4A, 0xD3, 0x31, 0x51, 0x68, 0x7B, 0x8F, 0xCB, 0x1F, 0xAE, 0x21, 0xE1, 0x39,
+    0x53, 0x45, 0x0C, 0x4C, 0x1F, 0x97, 0x6B, 0x9F, 0xF4, 0xB2, 0x79, 0xC9, 0x8F, 0x16, 0xC8, 0x0F,
+    0xE5, 0x87, 0xCC, 0x28, 0xEC, 0x6A, 0x8F, 0x98, 0xFD, 0xA6, 0xD3, 0x4B, 0xEA, 0x78, 0x64, 0xCE,
+    0xE5, 0x78, 0xE6, 0x85, 0x6A, 0x0F, 0x06, 0x99, 0xEC, 0x8C, 0x18, 0x6A, 0x60, 0xB4, 0xA7, 0xAD,
+    0xBE, 0xA8, 0x5B, 0x1C, 0x79, 0x01, 0xE7, 0xBC, 0x31, 0x63, 0x56, 0xA2, 0x3E, 0x53, 0x9D, 0x16,
+    0x00, 0xCC, 0x9B, 0xAB, 0x9B, 0x8C, 0xC4, 0x93, 0xD0, 0x8A, 0xDC, 0xC8, 0xDD, 0xC8, 0x68, 0x46,
+    0xFB, 0xF3, 0x6A, 0x61, 0x43, 0x51, 0x6F, 0x70, 0x0E, 0x6E, 0x1D, 0x86, 0x36, 0x7C, 0x48, 0x0E,
+    0x00, 0xBC, 0x0A, 0xB8, 0x67, 0x17, 0xC0, 0x00, 0xCC, 0x61, 0xAC, 0x4B, 0x5F, 0x28, 0xAB, 0xC1,
+    0x79, 0xEC, 0xDD, 0xE1, 0x0D, 0x4C, 0x8B, 0x0C, 0xCE, 0xE3, 0x6C, 0x8D, 0xA3, 0xC1, 0x1E, 0x80,
+    0x57, 0x40, 0xC3, 0xD5, 0xEF, 0xC8, 0x61, 0x38, 0x40, 0x6E, 0x4D, 0xC3, 0xC5, 0xDC, 0x59, 0xE1,
+    0x77, 0x59, 0x5B, 0xD6, 0xBE, 0x69, 0x45, 0x2D, 0xEE, 0x72, 0xA8, 0x1A, 0xB1, 0x6B, 0xCA, 0xB7,
+    0x95, 0x56, 0xCF, 0x15, 0x5A, 0x55, 0x9C, 0x7E, 0xB4, 0xC9, 0x87, 0x5E, 0xFB, 0x15, 0xB5, 0xEC,
+    0x82, 0x12, 0xFB, 0xA7, 0x74, 0x4B, 0x17, 0x2E, 0x7F, 0xAC, 0x20, 0xAB, 0x75, 0xDD, 0xD9, 0x78,
+    0x3F, 0xDF, 0xD3, 0x36, 0x62, 0x33, 0xEA, 0x2C, 0x1E, 0x83, 0x36, 0xF1, 0xBA, 0x34, 0x36, 0x7F,
+    0x14, 0xEC, 0x76, 0xFD, 0xE6, 0x50, 0x95, 0x4F, 0x8C, 0xC0, 0xC4, 0x98, 0xC1, 0x26, 0x93, 0xFC,
+    0x34, 0xA4, 0xC1, 0xC7, 0x27, 0xE4, 0xF9, 0x64, 0x4C, 0xBC, 0xA9, 0x78, 0x6F, 0xDD, 0x4D, 0x50,
+    0x66, 0xD7, 0xAB, 0x83, 0xF8, 0x39, 0xBB, 0xD5, 0x34, 0x37, 0xC4, 0xB4, 0x0E, 0xBD, 0x9F, 0x3B,
+    0x5A, 0x74, 0x70, 0x42, 0xA1, 0x76, 0x47, 0xE1, 0x95, 0xAA, 0xEB, 0xF5, 0x26, 0xB8, 0x0F, 0x4F,
+    0x49, 0x0F, 0x5A, 0x52, 0xDD, 0x73, 0xC3, 0x57, 0x3C, 0x3C, 0x64, 0x10, 0xCA, 0xD3, 0xEA, 0x6B,
+    0x35, 0x51, 0xA7, 0xB8, 0xF5, 0xFB, 0x29, 0x19, 0x10, 0x75, 0xE9, 0x01, 0x09, 0x3F, 0x03, 0x65,
+    0xF9, 0x04, 0xE5, 0xF2, 0xD0, 0x2F, 0xAE, 0xAD, 0x0C, 0xC7, 0x19, 0x36, 0xF6, 0x24, 0xFC, 0x0B,
+    0xB5, 0x55, 0x3D, 0x8F, 0xDC, 0x54, 0x14, 0xBD, 0xB6, 0x67, 0xE3, 0x68, 0xBC, 0x8B, 0x49, 0x91,
+    0x22, 0xD2, 0x08, 0xB7, 0x53, 0x20, 0x3C, 0x12, 0xD3, 0x44, 0xDA, 0xB1, 0x9D, 0x4D, 0x41, 0x01,
+    0x48, 0x83, 0x14, 0x8B, 0x82, 0x22, 0x2B, 0xD1, 0x22, 0x65, 0x0B, 0x0A, 0x8A, 0x19, 0xC6, 0xF9,
+    0x07, 0xDB, 0x06, 0x1A, 0x28, 0x49, 0x0A, 0x28, 0x28, 0x52, 0x4C, 0x18, 0x8F, 0x10, 0x20, 0x21,
+    0x24, 0x2C, 0x4A, 0x0A, 0xE4, 0x22, 0x2B, 0x91, 0x8A, 0x51, 0x64, 0x24, 0x2F, 0x78, 0xF6, 0x71,
+    0xCE, 0xB5, 0x87, 0x95, 0x10, 0xA2, 0xE3, 0xAD, 0xEE, 0x9B, 0xE7, 0xF7, 0x71, 0xDF, 0x39, 0xE7,
+    0xDE, 0xFB, 0x56, 0x52, 0x11, 0x49, 0x8C, 0x39, 0x95, 0xC3, 0xE8, 0x23, 0x73, 0xB1, 0x7A, 0x3D,
+    0x91, 0x7B, 0xA6, 0x48, 0x44, 0x2C, 0x98, 0xBD, 0x3A, 0x17, 0x09, 0x8C, 0xA9, 0x25, 0x7E, 0x2A,
+    0xF7, 0x8A, 0x18, 0x53, 0xCB, 0x08, 0xFB, 0xBD, 0x07, 0xE8, 0xE4, 0x94, 0xDD, 0x55, 0x76, 0xB2,
+    0x59, 0x19, 0xB4, 0x9F, 0x1F, 0xA2, 0xD5, 0xFC, 0x3E, 0xD0, 0x59, 0xF8, 0x78, 0xE1, 0xBD, 0xE1,
+    0x60, 0x34, 0x1C, 0x8D, 0x47, 0x5F, 0x84, 0x27, 0xF8, 0xBE, 0xF5, 0xCB, 0xE8, 0xD1, 0xE3, 0xB2,
+    0x2F, 0x71, 0x26, 0x7B, 0x7B, 0xBD, 0xFD, 0xC1, 0x70, 0x3C, 0x3A, 0xB6, 0x92, 0x9B, 0x3F, 0xDD,
+    0xFF, 0xC1, 0x1D, 0x0D, 0xF3, 0xF5, 0x56, 0x7A, 0xBD, 0xC1, 0xFE, 0x70, 0x30, 0xBE, 0x3C, 0xF1,
+    0xD6, 0xD9, 0xD8, 0x95, 0x63, 0x57, 0xC2, 0x5C, 0xC4, 0x95, 0xBE, 0xF5, 0x66, 0xEB, 0xF1, 0xA4,
+    0x5B, 0xEF, 0xCB, 0x58, 0xBE, 0x71, 0x3F, 0x7E, 0x79, 0x70, 0xFA, 0xAE, 0xFD, 0xC6, 0xFE, 0xF1,
+    0xA8, 0x37, 0x9D, 0xDE, 0x7C, 0xF6, 0xE9, 0x7A, 0xFD, 0x7D, 0xBF, 0x3F, 0x1A, 0x8F, 0xF3, 0xFC,
+    0xDB, 0x2B, 0x8E, 0xF4, 0xA6, 0xCF, 0x06, 0x76, 0x36, 0x76, 0xE4, 0x44, 0xAE, 0x7A, 0xAF, 0x9D,
+    0xE6, 0xA3, 0x41, 0xDF, 0xDA, 0x00, 0xDD, 0xB5, 0xEC, 0xBB, 0x83, 0xFD, 0x93, 0x57, 0xE5, 0x57,
+    0x3B, 0xC7, 0xBD, 0x07, 0x43, 0xF7, 0x13, 0x27, 0xF3, 0xF2, 0x41, 0x71, 0x02, 0xBF, 0x77, 0xB0,
+    0x3E, 0x87, 0x85, 0x30, 0x1F, 0xB4, 0x9D, 0x9C, 0x32, 0x29, 0xA9, 0xD0, 0x5C, 0x48, 0x0C, 0x8B,
+    0xD2, 0x3B, 0xBA, 0x65, 0xD9, 0x19, 0x89, 0x57, 0x40, 0x0C, 0xD7, 0xB6, 0x31, 0x85, 0x63, 0x4C,
+    0xEE, 0x9C, 0xA5, 0x89, 0x53, 0x00, 0x38, 0x4E, 0x7B, 0x30, 0x9F, 0x96, 0x41, 0x52, 0x78, 0x0A,
+    0xD2, 0x14, 0xAE, 0x8C, 0xBA, 0x6A, 0x5B, 0x75, 0x08, 0x83, 0xA7, 0xCD, 0x07, 0xB2, 0x6B, 0xFF,
+    0xC3, 0x5D, 0xF8, 0xAD, 0x62, 0xD8, 0xF5, 0x45, 0x3A, 0x55, 0x7A, 0x0C, 0xE8, 0x04, 0x36, 0xEB,
+    0x7C, 0x6F, 0x1F, 0x8A, 0x18, 0x53, 0x8A, 0x79, 0x54, 0xC3, 0xFF, 0xD6, 0xDE, 0x48, 0xE4, 0x94,
+    0x12, 0xD3, 0xDC, 0x42, 0x22, 0xF8, 0x9F, 0xC3, 0x7F, 0xE3, 0x67, 0x4E, 0xED, 0x1F, 0x99, 0x32,
+    0x38, 0x32, 0xB8, 0xE5, 0x45, 0xA2, 0xBD, 0x0E, 0x7B, 0x02, 0x54, 0x40, 0x46, 0x24, 0x3E, 0x3E,
+    0x7B, 0x3B, 0x1E, 0x5B, 0x5C, 0xBE, 0xFD, 0x4F, 0x1E, 0x30, 0x87, 0x56, 0xB6, 0xA7, 0xFF, 0x95,
+    0x47, 0x17, 0x91, 0xE8, 0x6F, 0x81, 0x3C, 0xF3, 0x14, 0x06, 0xF6, 0x17, 0xB7, 0xBE, 0x14, 0x0A,
+    0x19, 0x66, 0xAD, 0x1B, 0x75, 0xCF, 0xB3, 0x44, 0x43, 0xD2, 0x39, 0x44, 0x6A, 0x24, 0x4E, 0xA1,
+    0x52, 0xD9, 0xB9, 0xD0, 0x7D, 0x31, 0xCC, 0xAE, 0xBA, 0xCD, 0xB2, 0xCA, 0x6E, 0xA8, 0xA2, 0xE2,
+    0x1A, 0x62, 0x9B, 0x76, 0xD7, 0xB8, 0xB8, 0x26, 0xC6, 0x71, 0xDC, 0x62, 0xD5, 0x1D, 0xCE, 0xCE,
+    0xF4, 0xEC, 0x16, 0xB6, 0xC0, 0xF9, 0x00, 0x1F, 0x36, 0x61, 0x2C, 0x88, 0xB6, 0x43, 0xBF, 0x63,
+    0x11, 0x66, 0xEF, 0x5B, 0x2B, 0x59, 0xC0, 0x4D, 0x08, 0x79, 0xD5, 0x77, 0x08, 0x6A, 0x4E, 0x09,
+    0x88, 0xCB, 0x76, 0x58, 0xE8, 0x30, 0x6E, 0x87, 0x9B, 0x6E, 0xE8, 0x16, 0x36, 0x87, 0x2D, 0x69,
+    0xEB, 0x79, 0xE9, 0xFD, 0x98, 0xBD, 0x74, 0xD8, 0xE2, 0xC2, 0x02, 0xB4, 0x89, 0x48, 0x12, 0xB7,
+    0x84, 0x14, 0x14, 0xDA, 0x41, 0xAA, 0x25, 0xB1, 0x61, 0x69, 0x42, 0x6D, 0xB1, 0x14, 0x73, 0x09,
+    0xE1, 0x0B, 0x29, 0x8C, 0x0A, 0xA0, 0x02, 0x2F, 0x5B, 0x6D, 0x6B, 0x95, 0x97, 0x11, 0x08, 0xDB,
+    0x00, 0x20, 0x1F, 0xB0, 0x59, 0x97, 0x73, 0x5D, 0x46, 0x0D, 0x58, 0xDD, 0xF2, 0x46, 0xC5, 0xE3,
+    0xF2, 0xAC, 0xE5, 0xD6, 0x9E, 0x76, 0x37, 0xB2, 0xD8, 0x22, 0x16, 0x89, 0xDC, 0xD0, 0x3A, 0xF1,
+    0x21, 0xB9, 0xE8, 0xEB, 0xC1, 0x9F, 0x30, 0xBD, 0x9B, 0xA9, 0xEA, 0x2C, 0x26, 0xB8, 0x67, 0x24,
+    0x71, 0x9E, 0xC1, 0x54, 0x96, 0x9A, 0x0B, 0xCA, 0xB0, 0x92, 0xC5, 0x67, 0x4A, 0x6C, 0x01, 0x91,
+    0x80, 0xE5, 0xAB, 0xCF, 0x95, 0x53, 0x83, 0x3F, 0x20, 0xAE, 0x91, 0x3E, 0x5E, 0x0E, 0xBA, 0xF0,
+    0x94, 0x61, 0xD3, 0x04, 0x0E, 0xF1, 0x33, 0x87, 0x27, 0xEC, 0x6D, 0x30, 0xED, 0x14, 0x76, 0x7D,
+    0x0D, 0x7B, 0x8B, 0xBB, 0x9B, 0xB8, 0xD2, 0xDC, 0x88, 0x0B, 0x80, 0x39, 0xBF, 0xAC, 0x29, 0x91,
+    0xC7, 0xCA, 0x92, 0xCC, 0x23, 0xCD, 0x3F, 0x90, 0x09, 0x14, 0x08, 0x25, 0x68, 0xD5, 0xA2, 0x92,
+    0xA5, 0xF2, 0x86, 0x16, 0xD6, 0x79, 0xFA, 0xCE, 0x59, 0xC2, 0x2C, 0x32, 0x26, 0x73, 0xD8, 0x1B,
+    0x9E, 0xAC, 0xED, 0x46, 0xD5, 0xF6, 0xF2, 0x19, 0xD5, 0x99, 0x6B, 0x08, 0xDC, 0xA2, 0xE1, 0xC9,
+    0xA5, 0x8A, 0xEF, 0xAF, 0x2B, 0x4C, 0xD8, 0x15, 0xBC, 0x3F, 0xB9, 0x72, 0xC1, 0x68, 0xC1, 0x41,
+    0xC4, 0xFA, 0xCA, 0xB4, 0x10, 0xF1, 0xB9, 0xB5, 0xDE, 0xFE, 0x3D, 0x6D, 0xD3, 0x35, 0xEA, 0x1E,
+    0x1B, 0x46, 0x86, 0x48, 0x50, 0x8A, 0x89, 0x96, 0x8D, 0xFF, 0xC7, 0x2A, 0x77, 0x73, 0xBB, 0xC6,
+    0x64, 0x0C, 0x60, 0x7E, 0x0E, 0x9A, 0x25, 0x34, 0xAF, 0xB0, 0x73, 0x86, 0xC9, 0x50, 0x27, 0x27,
+    0xDD, 0x64, 0xFB, 0xF2, 0x76, 0xA9, 0xAD, 0x39, 0xFE, 0x0A, 0x67, 0x18, 0x74, 0x6B, 0x57, 0x36,
+    0x28, 0x62, 0x5C, 0xE7, 0x96, 0xAA, 0xBA, 0x5B, 0x38, 0xF4, 0x81, 0xED, 0x4B, 0x0C, 0x9C, 0x32,
+    0x4C, 0xC4, 0x3F, 0x82, 0x9B, 0x79, 0x90, 0xA1, 0x18, 0x18, 0x7D, 0xC6, 0x30, 0x62, 0x04, 0xAB,
+    0x90, 0xF0, 0x26, 0x54, 0xB1, 0x81, 0x00, 0x08, 0x84, 0x53, 0x82, 0x2D, 0x35, 0x00, 0x05, 0x0D,
+    0x09, 0x53, 0x56, 0x8B, 0x5C, 0x31, 0x68, 0x89, 0xB7, 0xE1, 0xB6, 0x0B, 0xF6, 0x9A, 0xB9, 0x3B,
+    0x1C, 0xA4, 0xCD, 0xA0, 0x89, 0xE1, 0xA1, 0x15, 0x52, 0x5D, 0x16, 0xCC, 0xF6, 0x88, 0x65, 0x10,
+    0xCD, 0xB0, 0x12, 0xA2, 0x2E, 0x92, 0x80, 0x45, 0xE0, 0xDF, 0xC6, 0x8A, 0x7F, 0x7F, 0x23, 0x8D,
+    0x97, 0x2F, 0xF9, 0x0E, 0xE1, 0xA2, 0xDB, 0x05, 0x56, 0xBE, 0x2E, 0x21, 0xF1, 0xF3, 0x0D, 0x22,
+    0x70, 0xAE, 0x75, 0xC2, 0xE4, 0x08, 0x20, 0x48, 0xE2, 0x31, 0x0D, 0xEC, 0x86, 0x5A, 0x6E, 0x79,
+    0x0F, 0x72, 0xC3, 0x67, 0xC2, 0xE3, 0xD2, 0xE0, 0x37, 0x56, 0x6B, 0x2D, 0x97, 0x2D, 0x62, 0x16,
+    0x13, 0x0E, 0x0B, 0xA6, 0x40, 0x5C, 0xE3, 0x96, 0x0E, 0xEB, 0x12, 0x99, 0x8A, 0xD3, 0x15, 0xD0,
+    0x39, 0x25, 0x54, 0xF2, 0xD6, 0x10, 0x35, 0x60, 0xFA, 0x4C, 0x18, 0xB6, 0x3F, 0xC1, 0xCB, 0x32,
+    0x3B, 0xAD, 0x03, 0xE6, 0x79, 0xC3, 0x48, 0x72, 0x1A, 0x6F, 0x81, 0xC3, 0x62, 0xF7, 0xF9, 0x42,
+    0xEC, 0xED, 0xF2, 0x6F, 0xC2, 0xDB, 0xC8, 0x0E, 0x70, 0xE7, 0x94, 0x68, 0xD9, 0x76, 0x90, 0xB3,
+    0x26, 0xDA, 0x0A, 0x9D, 0xC5, 0x48, 0x60, 0xEC, 0x30, 0x38, 0x6E, 0x0E, 0x91, 0xBD, 0x1C, 0xA8,
+    0x7C, 0x24, 0x02, 0x10, 0x41, 0x6E, 0x3F, 0x41, 0x6D, 0x06, 0x44, 0x17, 0xB2, 0xFE, 0x62, 0xBE,
+    0xF2, 0x1F, 0x32, 0xAB, 0xF8, 0xD4, 0xE2, 0x91, 0xD1, 0x34, 0x6A, 0x3B, 0x56, 0xA9, 0xA6, 0x3B,
+    0xFE, 0x5F, 0xFE, 0xA3, 0xFD, 0x05, 0x7D, 0x95, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0x86, 0x8F, 0x6D,
+    0x81, 0x0B, 0x17, 0x23, 0xA4, 0xA4, 0x40, 0x14, 0x6E, 0x69, 0x58, 0xD7, 0x48, 0xB9, 0xB6, 0x43,
+    0x0A, 0x4A, 0x52, 0xE4, 0x2A, 0xC5, 0x16, 0xF9, 0x09, 0xDB, 0x50, 0xDE, 0xBB, 0xEB, 0xFC, 0x03,
+    0x0A, 0x7A, 0xA8, 0x69, 0x68, 0x28, 0x52, 0x78, 0xB3, 0x96, 0x52, 0x50, 0x50, 0xE0, 0x02, 0x29,
+    0xAD, 0x41, 0x59, 0x21, 0x51, 0x8D, 0xC0, 0x48, 0x5E, 0xE2, 0xBD, 0xE6, 0x79, 0xC7, 0x0B, 0x5A,
+    0x14, 0x91, 0xB9, 0x9E, 0xD1, 0xEE, 0x9C, 0xEF, 0xF3, 0x9E, 0x73, 0xC6, 0x2C, 0x1A, 0xCD, 0xEC,
+    0xC0, 0xBE, 0x68, 0xCC, 0x4A, 0x6F, 0x56, 0xEC, 0xCC, 0xDC, 0x13, 0xF6, 0x8B, 0xCE, 0xD2, 0x7E,
+    0xB4, 0xC4, 0x6F, 0x60, 0x72, 0x8D, 0x4D, 0xC9, 0x60, 0x3B, 0x6B, 0xAD, 0x5A, 0x16, 0x2B, 0x96,
+    0xA5, 0x73, 0xBF, 0x7D, 0xE3, 0xB3, 0xCE, 0xF6, 0x5C, 0xBB, 0x07, 0xDE, 0x92, 0x9F, 0x27, 0xB3,
+    0x69, 0x36, 0xAB, 0xF6, 0x66, 0xDC, 0xC3, 0x52, 0x3B, 0xD8, 0x92, 0xCB, 0xED, 0xC3, 0x60, 0xA4,
+    0x65, 0x17, 0x6C, 0x54, 0x59, 0xD2, 0x9B, 0x45, 0x7F, 0x7D, 0x89, 0xD5, 0xA5, 0xB7, 0xEA, 0xDB,
+    0x03, 0x97, 0x79, 0x97, 0xF4, 0xD1, 0x18, 0x79, 0x2B, 0xE1, 0x74, 0x4D, 0x89, 0x71, 0xD7, 0xC4,
+    0x3E, 0xED, 0xE3, 0x29, 0xFA, 0xF3, 0xF1, 0x0C, 0xE7, 0x8C, 0xE9, 0x57, 0x52, 0x72, 0xF8, 0xC2,
+    0xD0, 0x6C, 0xC9, 0xE5, 0x89, 0x47, 0xF3, 0xF3, 0xC0, 0x5F, 0x58, 0x32, 0xB8, 0x26, 0x1A, 0xD1,
+    0x3C, 0x47, 0x3E, 0xBA, 0x86, 0x7F, 0x82, 0x7F, 0x84, 0x74, 0x82, 0x66, 0x9B, 0xD0, 0x5C, 0xC0,
+    0x99, 0xF6, 0xA5, 0xC5, 0x1E, 0x1F, 0xE6, 0xB4, 0xB7, 0xE7, 0xD1, 0xF8, 0xCE, 0x02, 0xE7, 0x02,
+    0xE7, 0x95, 0x34, 0x2F, 0xD7, 0xFC, 0x75, 0x6D, 0xE5, 0xF6, 0x91, 0xED, 0x6F, 0x5C, 0xD6, 0x26,
+    0x32, 0x23, 0x04, 0x54, 0x20, 0x8B, 0xF7, 0xDA, 0xC3, 0x1A, 0x45, 0xDA, 0x85, 0x68, 0xCD, 0x75,
+    0x6B, 0x64, 0x79, 0xCD, 0xBE, 0x89, 0xB4, 0x34, 0xAD, 0x78, 0xC1, 0x13, 0x39, 0x8C, 0x44, 0xB9,
+    0x3D, 0xA9, 0xA5, 0x66, 0x27, 0x21, 0xA9, 0x2A, 0x25, 0x18, 0x82, 0x96, 0x96, 0x51, 0x17, 0xD2,
+    0x38, 0x4A, 0x9E, 0x3F, 0x26, 0x29, 0x92, 0xA9, 0x49, 0x8A, 0xB9, 0x68, 0xC5, 0x81, 0x20, 0x1F,
+    0xD6, 0xF8, 0x36, 0x66, 0xB3, 0x14, 0x3C, 0xB9, 0xDC, 0x1E, 0xFF, 0x94, 0x2C, 0xAC, 0x29, 0xD7,
+    0xD9, 0xCB, 0xEF, 0x5C, 0xA2, 0xD6, 0xBA, 0x5A, 0xFE, 0x6E, 0x94, 0xFB, 0xFB, 0x5F, 0x73, 0x7E,
+    0xA8, 0x48, 0x0F, 0x44, 0x7A, 0x78, 0x6B, 0xA4, 0x28, 0x49, 0x56, 0x00, 0xEB, 0xFF, 0x8D, 0x74,
+    0xBB, 0x15, 0xD0, 0x41, 0x95, 0x65, 0x4D, 0x3C, 0xD8, 0x29, 0x7C, 0x58, 0x9D, 0x49, 0x0E, 0x3F,
+    0x39, 0x0A, 0x8E, 0x8A, 0x28, 0xED, 0x0A, 0x04, 0xDA, 0xAC, 0x3B, 0xC7, 0xC4, 0xCE, 0x3D, 0x95,
+    0xA5, 0xD2, 0x7D, 0x2A, 0x07, 0xF3, 0xFC, 0xB3, 0xCE, 0x42, 0x8A, 0xEC, 0x06, 0x04, 0xD6, 0xE9,
+    0xE9, 0x29, 0x67, 0x34, 0x6D, 0x94, 0xC9, 0xC4, 0xEF, 0x64, 0xD2, 0x75, 0xAD, 0x3C, 0xA8, 0xEA,
+    0x09, 0xF0, 0xEC, 0x9C, 0x92, 0xC4, 0xC0, 0x64, 0xAA, 0x9A, 0x74, 0xE0, 0x20, 0x4B, 0xCA, 0x2A,
+    0x35, 0xAA, 0xA4, 0xED, 0x43, 0xFA, 0xD1, 0xD7, 0x00, 0xF1, 0x68, 0x1F, 0xBF, 0x4B, 0x71, 0x52,
+    0x2D, 0x2B, 0x2E, 0xDA, 0x62, 0xE0, 0x2E, 0xF5, 0xF8, 0xDF, 0x58, 0x85, 0xD9, 0xBB, 0x27, 0xCD,
+    0x0A, 0xAD, 0xB0, 0xB9, 0x0D, 0x77, 0x36, 0x7C, 0x6E, 0x67, 0xDD, 0x59, 0x28, 0x7D, 0xF2, 0x73,
+    0x67, 0x45, 0xB8, 0x52, 0x22, 0x2A, 0xC5, 0x5B, 0x0C, 0x54, 0x62, 0x3E, 0xAA, 0x14, 0xCF, 0xA1,
+    0xB8, 0xAF, 0xA0, 0x64, 0x3F, 0x50, 0x78, 0xE9, 0x8B, 0x41, 0x45, 0x09, 0x25, 0x19, 0x76, 0x56,
+    0xC5, 0x1E, 0xE2, 0x53, 0xEF, 0xA0, 0x8C, 0x09, 0x2E, 0x4F, 0x88, 0xB5, 0x2D, 0xF5, 0x50, 0xEE,
+    0x24, 0x76, 0x8E, 0x58, 0x7A, 0x20, 0x77, 0xF1, 0xA2, 0xCE, 0xBC, 0x10, 0x28, 0x55, 0x8D, 0x1D,
+    0xD6, 0x47, 0x26, 0x3F, 0x1A, 0x50, 0x8A, 0x0E, 0x8A, 0x24, 0x9F, 0xEC, 0xD6, 0xC2, 0xD1, 0x44,
+    0x09, 0x48, 0x66, 0x15, 0xC8, 0x01, 0x74, 0xA2, 0xA5, 0x26, 0x59, 0xAF, 0x7B, 0x28, 0x57, 0xA2,
+    0x60, 0x66, 0x63, 0xBB, 0x12, 0xCA, 0xC6, 0x41, 0x29, 0xC1, 0xC9, 0x17, 0x10, 0xA7, 0x9C, 0x24,
+    0x70, 0x05, 0x85, 0x2E, 0xAC, 0xF1, 0x1A, 0xCA, 0xAF, 0xCA, 0xE3, 0x6B, 0xDA, 0xC6, 0xCE, 0x06,
+    0xC4, 0x0A, 0x8F, 0x58, 0xE6, 0xC1, 0x3F, 0x19, 0x43, 0x3E, 0x0A, 0xB9, 0x47, 0xBA, 0x1B, 0x62,
+    0x57, 0x6D, 0x3A, 0x95, 0xE6, 0xAC, 0xCE, 0xEA, 0x08, 0x01, 0x88, 0x37, 0x59, 0x0F, 0x0B, 0x10,
+    0x66, 0xAA, 0xFB, 0x4A, 0xC8, 0x5E, 0x9D, 0xAA, 0x65, 0x5A, 0xF5, 0x07, 0x29, 0x6C, 0x51, 0x93,
+    0x0C, 0xE0, 0xE8, 0x1A, 0x92, 0xB8, 0x47, 0x63, 0xAC, 0x36, 0xC0, 0x65, 0x45, 0x10, 0x26, 0x46,
+    0xE8, 0x99, 0x68, 0x51, 0x3D, 0x14, 0xDB, 0xE3, 0x4E, 0xC0, 0x20, 0xBD, 0x51, 0x05, 0xAE, 0xBD,
+    0x41, 0xB6, 0x6B, 0xE4, 0x05, 0x54, 0xE8, 0x98, 0xD0, 0x2B, 0x7C, 0xA5, 0xB8, 0x50, 0xBD, 0x36,
+    0x4C, 0x2B, 0xA5, 0x1A, 0x60, 0xE2, 0x42, 0xA0, 0x10, 0xB2, 0xC2, 0xCC, 0xDE, 0xA3, 0x4C, 0x7D,
+    0xB2, 0xD4, 0x08, 0x54, 0x7D, 0x68, 0xE7, 0xB5, 0x62, 0xA8, 0xB1, 0x8B, 0xDA, 0xA1, 0xF5, 0xAC,
+    0x4B, 0x30, 0x5E, 0x79, 0x72, 0x69, 0x79, 0x6B, 0xCF, 0x19, 0x75, 0xA7, 0x76, 0xF4, 0xCC, 0xD2,
+    0x1F, 0x6B, 0x66, 0x64, 0xF2, 0xB2, 0xE3, 0x8B, 0x7F, 0xF7, 0x91, 0xF7, 0x36, 0xCE, 0xD6, 0xDE,
+    0xB3, 0x67, 0x25, 0x45, 0x5D, 0xDF, 0x73, 0xB5, 0x7B, 0xD0, 0x1F, 0x91, 0xC7, 0xEE, 0x59, 0x1E,
+    0x43, 0x3E, 0x72, 0x0D, 0x00, 0xA4, 0xDF, 0x77, 0x90, 0xA3, 0x3F, 0x7A, 0xF2, 0x55, 0x6F, 0x7C,
+    0x4A, 0xA2, 0xDD, 0x28, 0x32, 0xA0, 0x41, 0x36, 0x06, 0x0F, 0xBF, 0xA3, 0xD0, 0x59, 0x44, 0x73,
+    0xA4, 0x38, 0x74, 0x43, 0x76, 0x28, 0xD5, 0xDD, 0x1A, 0x4B, 0xAB, 0x26, 0x0D, 0xA1, 0x8C, 0x16,
+    0xE6, 0x65, 0xEC, 0xE9, 0xD4, 0xC5, 0xAB, 0xF7, 0x07, 0x7A, 0xF5, 0x31, 0x7D, 0x67, 0x52, 0x4D,
+    0xD4, 0x8A, 0xBB, 0x0B, 0x73, 0x82, 0x23, 0xAF, 0xD1, 0x9B, 0x6B, 0x38, 0x15, 0xD2, 0x5E, 0xAE,
+    0xDA, 0xD7, 0x95, 0x32, 0x86, 0x0D, 0x25, 0xE6, 0x5E, 0x7D, 0xE0, 0xF1, 0x23, 0x1B, 0x80, 0xCF,
+    0x75, 0x00, 0x96, 0x7F, 0x42, 0x1A, 0xF6, 0x6A, 0xBE, 0x09, 0x1F, 0x92, 0x5F, 0xF8, 0x2F, 0x74,
+    0xEB, 0xBE, 0x54, 0xCD, 0x69, 0xB0, 0xBD, 0xD0, 0x5C, 0x83, 0x21, 0xF6, 0x95, 0x3A, 0xF4, 0xDC,
+    0x42, 0x25, 0x64, 0x43, 0x7C, 0x1D, 0x1D, 0x34, 0x44, 0x04, 0xA1, 0x86, 0xEB, 0x9D, 0xB5, 0x19,
+    0xC3, 0x88, 0x0D, 0x33, 0x76, 0x3B, 0x2B, 0xAC, 0x79, 0x8D, 0xA8, 0x55, 0x44, 0x93, 0x90, 0x19,
+    0x4D, 0x29, 0x01, 0x18, 0x95, 0xF4, 0xA0, 0x2A, 0xE9, 0x01, 0x2B, 0xD5, 0x10, 0xCF, 0x14, 0x16,
+    0x8D, 0xA5, 0x83, 0x22, 0x20, 0x8D, 0x0D, 0xA1, 0xE4, 0x82, 0x34, 0x57, 0x30, 0x85, 0x70, 0x2F,
+    0x95, 0x2A, 0x1E, 0x09, 0x2A, 0x03, 0x33, 0xC9, 0xE5, 0x85, 0x9E, 0x15, 0x59, 0x51, 0xD8, 0x59,
+    0xA7, 0x47, 0x65, 0x7D, 0x24, 0x98, 0x55, 0x9A, 0x14, 0xD5, 0xF6, 0x42, 0x0F, 0x55, 0x9D, 0xE0,
+    0xA5, 0x2A, 0x29, 0xCC, 0xC1, 0xF2, 0xE6, 0xA1, 0xD2, 0x9C, 0xF9, 0xCF, 0xE5, 0xCD, 0xCA, 0x78,
+    0x89, 0x32, 0x0D, 0xC7, 0xC3, 0xFD, 0xEF, 0xC2, 0xF3, 0x59, 0x34, 0xEB, 0xA0, 0x08, 0x8C, 0x1A,
+    0x78, 0xA1, 0x82, 0xD7, 0xD9, 0x65, 0x16, 0x3A, 0x38, 0x0C, 0xE3, 0xF2, 0xF6, 0x4D, 0x3C, 0xDE,
+    0x30, 0xF3, 0xFA, 0xBE, 0x1F, 0x06, 0x2E, 0x48, 0xA8, 0xAD, 0x1F, 0xAE, 0x99, 0x22, 0x51, 0xF3,
+    0xDD, 0xE3, 0xCB, 0x47, 0x6F, 0x7D, 0x61, 0xFE, 0x99, 0x64, 0xED, 0x3A, 0xCD, 0xFE, 0x1D, 0xE1,
+    0xE3, 0x9B, 0x8F, 0xD5, 0x1B, 0xEB, 0x6F, 0xB5, 0x95, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0xC7, 0x9F,
+    0x3D, 0x24, 0x96, 0xCE, 0xC5, 0x34, 0x44, 0x14, 0x57, 0xB8, 0xA1, 0x8E, 0x3F, 0xC1, 0xED, 0xF8,
+    0xA0, 0x48, 0xC9, 0x15, 0x1C, 0x14, 0x7C, 0x88, 0xFD, 0x02, 0xBB, 0xAC, 0x25, 0x24, 0xEA, 0xAB,
+    0xF2, 0x09, 0x68, 0x10, 0x05, 0x35, 0x92, 0x2F, 0x1E, 0xB8, 0x22, 0xAD, 0x85, 0xE8, 0x68, 0x8C,
+    0x94, 0x54, 0x29, 0x62, 0x81, 0x23, 0xF9, 0x12, 0x7B, 0x87, 0xDF, 0x9B, 0xDD, 0x43, 0x27, 0x21,
+    0xD2, 0x61, 0x65, 0x67, 0x36, 0xB3, 0x9E, 0xFF, 0xFB, 0xBF, 0xFF, 0xFB, 0xBF, 0x77, 0xA6, 0x97,
+    0x64, 0xCC, 0xBD, 0x58, 0x5F, 0x88, 0x5C, 0xCB, 0x99, 0x98, 0x41, 0x26, 0x29, 0x25, 0xD5, 0x2D,
+    0xF3, 0x96, 0x5F, 0xAA, 0xAD, 0xC8, 0x8A, 0x63, 0x69, 0x78, 0x25, 0x19, 0x26, 0x11, 0xF3, 0xBB,
+    0x17, 0xB1, 0xD7, 0x22, 0x52, 0x70, 0x2C, 0x8E, 0x4F, 0xC2, 0x31, 0x20, 0x2C, 0x8B, 0x1E, 0xF7,
+    0x9C, 0xEE, 0xF9, 0x12, 0x3A, 0x96, 0x0B, 0xB9, 0xF7, 0xD8, 0x5A, 0xDF, 0x1E, 0x75, 0x59, 0x5F,
+    0x89, 0xE4, 0x21, 0x0C, 0x2C, 0x6D, 0xDB, 0xA5, 0x8B, 0xE9, 0x76, 0xF2, 0x4C, 0x36, 0x32, 0x59,
+    0x9F, 0xFB, 0xFC, 0xE7, 0x51, 0x66, 0xD9, 0x94, 0x5C, 0xC8, 0x6E, 0x7A, 0x2E, 0x34, 0x2B, 0x29,
+    0xC4, 0xDE, 0xF4, 0xCA, 0xCC, 0xC9, 0x4A, 0xCA, 0x74, 0x34, 0x5D, 0xDE, 0xDB, 0x6E, 0xFB, 0x70,
+    0x16, 0x17, 0x5E, 0x11, 0xAE, 0x0D, 0xFB, 0x4A, 0x64, 0xFD, 0x9B, 0xC6, 0xD1, 0x08, 0x5C, 0x90,
+    0xBB, 0xF8, 0x7C, 0xDD, 0x92, 0x0B, 0x59, 0xD9, 0x9A, 0x64, 0x32, 0x42, 0x88, 0xE9, 0x8A, 0x8A,
+    0x4C, 0x57, 0xC7, 0xB4, 0xE4, 0x9D, 0x66, 0xD3, 0x6A, 0x12, 0x0E, 0x1C, 0xD9, 0xE9, 0xBD, 0xC0,
+    0x37, 0xF3, 0x8A, 0xB3, 0xFC, 0x39, 0x4B, 0x69, 0x48, 0x68, 0x0B, 0x05, 0x99, 0x92, 0xE1, 0xA0,
+    0x15, 0x38, 0x8D, 0x80, 0xB3, 0x85, 0x93, 0xFE, 0x2B, 0x05, 0x15, 0xD9, 0x37, 0xBA, 0x34, 0x1C,
+    0xF3, 0x4E, 0x73, 0x58, 0xC8, 0x62, 0x22, 0x14, 0xDC, 0xD2, 0x41, 0xAF, 0x6B, 0x2E, 0xA6, 0x53,
+    0x36, 0x9D, 0xE9, 0x01, 0x02, 0xDC, 0xFA, 0x0C, 0xC9, 0x6B, 0xAD, 0x48, 0x85, 0x9C, 0x85, 0xEA,
+    0x55, 0x2A, 0xBC, 0x93, 0xF2, 0xF2, 0xF2, 0xEB, 0x8B, 0x32, 0x20, 0x98, 0xD3, 0x05, 0x6E, 0x5C,
+    0xBA, 0x5B, 0x54, 0xE7, 0x4C, 0x99, 0x3F, 0xAC, 0xD9, 0x0A, 0x80, 0x73, 0xDF, 0x40, 0x10, 0x0E,
+    0x13, 0x59, 0x9F, 0xDD, 0x3F, 0xEC, 0xA1, 0x38, 0xE5, 0x1D, 0xD4, 0x96, 0x64, 0x27, 0x20, 0xFA,
+    0x24, 0xBC, 0xEB, 0x8F, 0x9A, 0xC1, 0x57, 0x53, 0x88, 0xB5, 0x34, 0x77, 0x87, 0x9B, 0xE3, 0x21,
+    0xBE, 0xE8, 0xE5, 0x31, 0x89, 0xF1, 0xCB, 0x4A, 0xB7, 0x8E, 0x5C, 0xB7, 0x1A, 0x78, 0x43, 0x7A,
+    0x51, 0x89, 0x46, 0x6F, 0xCE, 0x51, 0x66, 0x96, 0x91, 0x34, 0x92, 0x91, 0x5C, 0x0B, 0xF2, 0x26,
+    0xBE, 0x1A, 0x8B, 0x7C, 0x1D, 0x00, 0x11, 0x82, 0xEC, 0x95, 0x47, 0xD6, 0x45, 0x88, 0xDC, 0x47,
+    0x88, 0xDC, 0xC7, 0xBB, 0xB6, 0x66, 0x53, 0x80, 0x02, 0x08, 0x00, 0x8A, 0xCB, 0x2F, 0xDE, 0x5C,
+    0xAE, 0x95, 0x2F, 0x8F, 0xA8, 0x06, 0x61, 0xFF, 0xDF, 0x94, 0xBA, 0xF7, 0x51, 0x92, 0xF7, 0x51,
+    0xEA, 0x23, 0xC4, 0xBF, 0x28, 0xF9, 0x3B, 0x4A, 0xD3, 0x3F, 0x94, 0xAA, 0x03, 0xA5, 0xCF, 0x0F,
+    0x94, 0xA6, 0x48, 0x29, 0x44, 0xE3, 0x69, 0x95, 0xEF, 0x6D, 0xE9, 0x61, 0x8B, 0x7A, 0xF2, 0xBF,
+    0xAB, 0x12, 0x57, 0x39, 0x3E, 0x8F, 0x76, 0x47, 0x61, 0x29, 0x13, 0x31, 0x0F, 0xEA, 0x63, 0x16,
+    0xD9, 0x7F, 0x8F, 0xF3, 0x82, 0x97, 0xB7, 0x3F, 0x62, 0x94, 0x74, 0xE2, 0xFE, 0x0C, 0xC7, 0x06,
+    0x80, 0x06, 0x76, 0x73, 0xE6, 0x93, 0x09, 0xBB, 0x0C, 0xD6, 0xAF, 0x3B, 0x1B, 0x42, 0x55, 0x84,
+    0x17, 0x07, 0x9C, 0x68, 0x3A, 0x10, 0x74, 0x9D, 0x23, 0x5A, 0x34, 0x9F, 0xB6, 0x4F, 0x24, 0x33,
+    0x45, 0x2E, 0xA3, 0x52, 0x49, 0xF6, 0xDF, 0x21, 0x56, 0xCA, 0x6D, 0xDC, 0xF7, 0xB6, 0xED, 0xC0,
+    0xEB, 0xB3, 0x41, 0x4D, 0x98, 0x0E, 0xF4, 0x9C, 0x4F, 0x46, 0x5B, 0xE5, 0xAC, 0x58, 0xD0, 0xA7,
+    0x43, 0x19, 0xDB, 0xC6, 0x91, 0xB3, 0xED, 0x68, 0xC4, 0xF3, 0xB6, 0x3E, 0xA3, 0x12, 0x7B, 0x02,
+    0xBA, 0xD0, 0x2B, 0x78, 0x19, 0x63, 0xC5, 0x14, 0x71, 0xAB, 0x9E, 0x68, 0xD2, 0xDA, 0xED, 0xE4,
+    0xA5, 0xB1, 0xF2, 0xB0, 0x88, 0xFB, 0x61, 0xA1, 0x71, 0x66, 0xD3, 0x29, 0x6C, 0xD6, 0xD1, 0x37,
+    0x9F, 0x92, 0x95, 0x22, 0x6F, 0xA5, 0x3C, 0x1F, 0x3F, 0x9A, 0x19, 0x07, 0xB5, 0x02, 0xC6, 0xA7,
+    0x64, 0x7A, 0x20, 0xAD, 0x98, 0xAB, 0x38, 0x66, 0xAE, 0x8F, 0xAE, 0x8C, 0x62, 0x6A, 0x6A, 0x1A,
+    0x07, 0xEE, 0xDA, 0x0B, 0x21, 0xCC, 0xF2, 0xE8, 0x72, 0x77, 0x9C, 0x2F, 0x14, 0x5F, 0x7B, 0xF3,
+    0x30, 0x94, 0x66, 0x9D, 0x49, 0xC9, 0xD5, 0xC3, 0x3D, 0xE3, 0x61, 0x91, 0x22, 0x70, 0xF6, 0xE0,
+    0xDE, 0x3C, 0x6A, 0x24, 0x25, 0x1E, 0xB4, 0x5B, 0x2A, 0x47, 0xE3, 0x8D, 0xA7, 0x03, 0xE0, 0xCF,
+    0x24, 0xC3, 0x1B, 0x59, 0x1F, 0xEB, 0xEF, 0x34, 0xD4, 0x4A, 0xC1, 0x56, 0xA2, 0xB3, 0x52, 0xA6,
+    0x4C, 0xCF, 0xE8, 0x23, 0x05, 0xB3, 0x75, 0xD0, 0x29, 0xB7, 0x35, 0x2F, 0xD7, 0xCA, 0xCD, 0x56,
+    0x8D, 0xD2, 0xDC, 0x28, 0xCB, 0x55, 0x8A, 0x9E, 0x88, 0x6F, 0x6B, 0xA8, 0x5A, 0xAF, 0xF6, 0x94,
+    0x6B, 0x6A, 0xB1, 0x48, 0xDE, 0xE3, 0xAE, 0x25, 0x09, 0xC8, 0x96, 0x04, 0xE2, 0x83, 0xD3, 0x2E,
+    0x91, 0xCF, 0x07, 0x71, 0x3D, 0x01, 0x39, 0xD5, 0x1F, 0xDC, 0xCB, 0x75, 0x95, 0x8E, 0xC8, 0x6C,
+    0xEB, 0x54, 0x89, 0x69, 0x2D, 0x80, 0x21, 0x43, 0xFC, 0xA7, 0xAD, 0xEE, 0x6A, 0x94, 0x77, 0xA4,
+    0x1F, 0x0B, 0x91, 0xDE, 0xAE, 0x2B, 0xCE, 0xE9, 0xD7, 0x99, 0xF7, 0xAC, 0x36, 0x92, 0x0E, 0xF5,
+    0x4C, 0x07, 0xA8, 0xD3, 0x09, 0xA3, 0x46, 0x2F, 0x75, 0x0A, 0xCA, 0x69, 0xFF, 0xB1, 0x09, 0x7F,
+    0xF6, 0xEE, 0xE9, 0xEB, 0x4F, 0xC6, 0x74, 0x2E, 0xA8, 0x41, 0xA3, 0xE3, 0x55, 0x56, 0xEA, 0x6D,
+    0x1C, 0xFF, 0x0B, 0xAF, 0x5A, 0x7C, 0xE6, 0xC4, 0x52, 0xA8, 0xF6, 0x7C, 0xCA, 0x1B, 0x13, 0xDE,
+    0x0C, 0x26, 0x3C, 0xA9, 0xA5, 0xBA, 0x53, 0xEF, 0x74, 0x86, 0x26, 0xAA, 0xDE, 0x56, 0xB2, 0xAB,
+    0xA2, 0xDE, 0xAA, 0xBB, 0x0E, 0x22, 0xFB, 0xED, 0x22, 0x76, 0x1D, 0xEA, 0xE2, 0xA7, 0xA2, 0x2B,
+    0x89, 0xEB, 0xAA, 0x14, 0xFB, 0xA4, 0x14, 0x3A, 0x1D, 0x36, 0xBC, 0xC5, 0xA7, 0xDF, 0x90, 0x07,
+    0x99, 0xF9, 0x33, 0xF4, 0x75, 0x68, 0x6E, 0x49, 0xC3, 0xA8, 0x98, 0x1F, 0x2A, 0x34, 0x7D, 0x16,
+    0x06, 0x73, 0xBB, 0xF6, 0x33, 0x7F, 0x79, 0xAA, 0xEC, 0x86, 0x1E, 0xC0, 0x73, 0x4F, 0x70, 0x08,
+    0xA5, 0xB2, 0xFE, 0xAB, 0x7E, 0x96, 0x12, 0x83, 0xAA, 0x75, 0x0C, 0xA5, 0x2A, 0xB8, 0xBC, 0xDB,
+    0x1F, 0xEE, 0xAE, 0x5F, 0xE0, 0x88, 0xFA, 0xF1, 0x97, 0x63, 0xEC, 0x2C, 0xAB, 0xE2, 0x4B, 0xD9,
+    0x25, 0x6D, 0x67, 0xF6, 0x95, 0x99, 0x22, 0xC7, 0x31, 0x7A, 0xC8, 0xFA, 0x13, 0x64, 0xAE, 0xCB,
+    0x50, 0xC7, 0x7B, 0x0F, 0x2E, 0x88, 0x8F, 0x0D, 0x5E, 0x6B, 0x9F, 0x8C, 0xF7, 0x92, 0xA9, 0x14,
+    0xA8, 0xEC, 0xA7, 0x2C, 0xFC, 0xD5, 0xEF, 0xCE, 0xC3, 0x37, 0x43, 0xB2, 0x94, 0x62, 0x46, 0xA6,
+    0xFF, 0xF3, 0x4E, 0x9C, 0xCE, 0xD3, 0x46, 0xB2, 0x5F, 0x51, 0x0C, 0x42, 0x93, 0x76, 0x8C, 0xA3,
+    0xC8, 0x3B, 0x52, 0xD9, 0x4D, 0x87, 0x92, 0x9E, 0xA2, 0x7F, 0xF0, 0xEE, 0xE9, 0x58, 0x56, 0xAB,
+    0xA2, 0xB6, 0x9F, 0xF9, 0xFC, 0xA6, 0x2F, 0xFE, 0xA0, 0xC2, 0x6D, 0xD0, 0x02, 0x62, 0x13, 0x35,
+    0x8C, 0x32, 0xEA, 0x4E, 0x70, 0x44, 0x5D, 0x1C, 0x19, 0xFD, 0xDF, 0xCF, 0xDF, 0xB5, 0x55, 0x31,
+    0x8F, 0xDD, 0x44, 0x10, 0xFE, 0xEC, 0x3D, 0x62, 0x84, 0x8B, 0x0D, 0x12, 0x15, 0x27, 0xB1, 0x0D,
+    0x45, 0x72, 0x12, 0xF1, 0x1F, 0xC8, 0xB3, 0x9D, 0xA4, 0x48, 0x41, 0x93, 0xD4, 0x29, 0xD2, 0x02,
+    0xCD, 0xB5, 0x89, 0xE4, 0x97, 0xE7, 0x90, 0x92, 0xE6, 0x24, 0x14, 0xEA, 0x2B, 0xD2, 0x10, 0x24,
+    0x68, 0x28, 0x22, 0xE1, 0xBB, 0xB7, 0x08, 0x89, 0x2B, 0xAE, 0xB1, 0x48, 0x49, 0x71, 0x96, 0x42,
+    0xAA, 0x14, 0xB7, 0xA0, 0x4D, 0xF0, 0x11, 0x9F, 0x97, 0x6F, 0xFC, 0xEE, 0xB8, 0x34, 0x29, 0xF1,
+    0xC9, 0xCF, 0xBA, 0xD9, 0xDD, 0x99, 0xF9, 0xBE, 0xF9, 0x66, 0x36, 0x3A, 0xC2, 0x7B, 0xE5, 0xB9,
+    0x3E, 0x19, 0x31, 0xC3, 0xB2, 0x7B, 0xE7, 0x18, 0x4E, 0x3F, 0x07, 0xFA, 0xC4, 0xCE, 0x81, 0xD8,
+    0x65, 0xAA, 0x03, 0x52, 0xDB, 0x1B, 0x00, 0x99, 0x6A, 0x1B, 0x7E, 0x96, 0x21, 0xD0, 0xA6, 0x42,
+    0x08, 0x25, 0xA0, 0x1F, 0xB8, 0x8A, 0xB6, 0x4A, 0xDF, 0x77, 0xB4, 0xB9, 0x59, 0x62, 0x01, 0x73,
+    0xC5, 0xE9, 0x12, 0x51, 0x9F, 0xDA, 0x82, 0xDB, 0xEC, 0x25, 0x2C, 0x9C, 0xEE, 0xE1, 0xB1, 0xB0,
+    0x6B, 0xDC, 0x8A, 0x35, 0x44, 0xCB, 0xAD, 0x38, 0x04, 0xDC, 0xBD, 0x45, 0x3F, 0x03, 0xFD, 0xD2,
+    0x4D, 0x0D, 0x63, 0x55, 0xA8, 0x23, 0x71, 0xBD, 0x2B, 0x11, 0x11, 0xD1, 0x61, 0xF3, 0x31, 0x76,
+    0x74, 0x18, 0xA3, 0x70, 0x0C, 0xDC, 0x60, 0x3A, 0x35, 0x3E, 0x33, 0x50, 0x5D, 0x03, 0x7D, 0xAD,
+    0xC3, 0x5C, 0xD7, 0x91, 0x9B, 0x23, 0xFD, 0xD9, 0x21, 0xE7, 0x7E, 0x9F, 0x23, 0xB1, 0x1E, 0x19,
+    0x33, 0x18, 0x0C, 0xD2, 0xAE, 0xC2, 0xE2, 0x4A, 0x9F, 0x36, 0x2A, 0xBC, 0x74, 0x49, 0xB8, 0x5E,
+    0x83, 0xC9, 0xE2, 0x22, 0xB6, 0xF1, 0x24, 0xB1, 0xD1, 0xD1, 0x0E, 0xE2, 0xD0, 0x4E, 0x3E, 0xF9,
+    0x5C, 0xC0, 0xB9, 0xFB, 0x67, 0x3E, 0xDA, 0x1E, 0x26, 0x69, 0xD1, 0x9C, 0x05, 0xAA, 0x74, 0x19,
+    0x13, 0xA5, 0x66, 0xA0, 0xDD, 0xC4, 0x26, 0xDE, 0xD4, 0x3F, 0xD9, 0x22, 0xDC, 0xC6, 0xC2, 0xDF,
+    0xC1, 0x84, 0xE8, 0x11, 0x3E, 0x27, 0xBC, 0x3E, 0x72, 0xCA, 0xC5, 0x4E, 0x5B, 0xD5, 0x11, 0x37,
+    0xA9, 0x4A, 0x7E, 0xF3, 0x48, 0x19, 0x26, 0x0D, 0x96, 0x3C, 0x75, 0xD0, 0x57, 0x1D, 0x0C, 0x7A,
+    0xE2, 0x6D, 0x50, 0x20, 0xE7, 0x5F, 0x46, 0xCE, 0x4D, 0x0D, 0x3C, 0x7E, 0xBC, 0x05, 0x13, 0x46,
+    0xC4, 0xFF, 0x7C, 0xD7, 0xD2, 0x5C, 0x31, 0x0B, 0x66, 0xD3, 0x70, 0xAF, 0xAE, 0x49, 0x8D, 0x8F,
+    0x3C, 0x0F, 0x1A, 0x96, 0x23, 0x76, 0xD3, 0xB9, 0xA4, 0x55, 0xCC, 0x90, 0xFB, 0xB2, 0x92, 0x24,
+    0x3B, 0x0C, 0x4A, 0x76, 0x4E, 0x60, 0xF0, 0x2D, 0xB0, 0x51, 0xEB, 0x0E, 0xC9, 0x10, 0x05, 0x20,
+    0xD4, 0x97, 0x1C, 0x2E, 0x79, 0x75, 0x80, 0xE4, 0x00, 0x97, 0x7F, 0xC4, 0x91, 0x4B, 0xF6, 0x6B,
+    0xC3, 0x0C, 0xEE, 0xA8, 0xA7, 0x5D, 0xFA, 0xC0, 0x3E, 0x99, 0xC1, 0x5F, 0x36, 0x89, 0xD5, 0xFC,
+    0xB7, 0x89, 0xDC, 0x27, 0x95, 0xAE, 0xB3, 0xE8, 0xB0, 0xF4, 0xAA, 0x33, 0x9D, 0x2E, 0x67, 0x18,
+    0x08, 0xCA, 0xD2, 0x26, 0x20, 0x3F, 0x24, 0xC8, 0x9C, 0x65, 0xC9, 0x99, 0xC5, 0x9C, 0xBA, 0xA8,
+    0xF8, 0x36, 0xA4, 0xAA, 0x4F, 0x43, 0xF0, 0xF2, 0xEA, 0x9A, 0xF0, 0x4B, 0xE5, 0x84, 0xBA, 0x8C,
+    0x14, 0x14, 0xAC, 0x48, 0xCE, 0x5A, 0xCE, 0xA0, 0x2D, 0xD6, 0x7B, 0x8A, 0x61, 0x40, 0xF1, 0x70,
+    0x50, 0x0E, 0xBD, 0xE1, 0xB6, 0x01, 0xE9, 0x2F, 0x1D, 0x32, 0x53, 0xA2, 0x69, 0xA0, 0xFE, 0x72,
+    0xD0, 0x5F, 0x59, 0x54, 0x3C, 0xC8, 0xAA, 0x9A, 0xF2, 0x38, 0xEE, 0x11, 0x42, 0x8D, 0xE0, 0x81,
+    0x0F, 0x88, 0x6B, 0x7B, 0xB3, 0x56, 0xFB, 0xC1, 0x9A, 0x9D, 0xCD, 0x7A, 0x59, 0x17, 0x04, 0xDC,
+    0x90, 0x69, 0x77, 0x0F, 0xFA, 0x4B, 0x87, 0x59, 0x6A, 0x23, 0x27, 0x91, 0x3C, 0x0A, 0xD6, 0xBF,
+    0xCF, 0xC8, 0xD0, 0x00, 0x23, 0xF9, 0x31, 0x9F, 0x0E, 0x17, 0x52, 0xB2, 0x6F, 0x42, 0x99, 0x1C,
+    0xDC, 0x72, 0xF1, 0x88, 0x1D, 0x8C, 0x0C, 0x20, 0x45, 0x22, 0xF9, 0x3E, 0x6D, 0x31, 0x27, 0xA2,
+    0x8C, 0x52, 0xD4, 0xA2, 0xD8, 0xCE, 0xD8, 0xD8, 0xA5, 0x2E, 0xEA, 0xD5, 0x18, 0x0D, 0x78, 0xC5,
+    0x9C, 0x67, 0x19, 0x35, 0x41, 0x01, 0xB1, 0x26, 0x90, 0x7E, 0x20, 0x0F, 0x00, 0xDB, 0x03, 0xD2,
+    0x15, 0x62, 0x04, 0xD6, 0x8F, 0x50, 0x04, 0x5B, 0x3C, 0xDC, 0x2E, 0x4A, 0xBA, 0x16, 0xBC, 0xDC,
+    0xC8, 0xB2, 0xB1, 0x4A, 0x93, 0xBE, 0x2D, 0x8B, 0x37, 0x9D, 0xD1, 0xED, 0xBB, 0x11, 0xB5, 0x6F,
+    0x88, 0x6C, 0x42, 0x95, 0xD5, 0xEB, 0x1D, 0xFE, 0x0C, 0x6E, 0x39, 0x44, 0x7F, 0x7F, 0xF3, 0xEA,
+    0xF9, 0x4E, 0x7C, 0x8C, 0x50, 0xE6, 0x84, 0x37, 0x22, 0x27, 0x51, 0x03, 0x72, 0x61, 0x78, 0x85,
+    0x10, 0x55, 0xCA, 0xD4, 0x88, 0xA9, 0xA6, 0xF3, 0x81, 0xC8, 0xB8, 0x62, 0x08, 0x15, 0x3E, 0x83,
+    0xAC, 0x17, 0x90, 0xF5, 0x1C, 0xB2, 0x4E, 0xCE, 0x27, 0xE4, 0x88, 0xB6, 0x99, 0xEE, 0x74, 0xA2,
+    0x59, 0x7D, 0x32, 0x49, 0xA8, 0xA1, 0x31, 0x72, 0xCC, 0x3D, 0x61, 0x75, 0xA8, 0x72, 0x26, 0x37,
+    0x63, 0xDE, 0xF0, 0xEC, 0xC7, 0xF8, 0x19, 0x21, 0xA5, 0xDF, 0x33, 0xBB, 0x8F, 0x68, 0x46, 0x21,
+    0xC2, 0xA2, 0x79, 0x05, 0x9D, 0x67, 0x27, 0x5C, 0x02, 0x09, 0xEF, 0xD3, 0x1C, 0x49, 0x23, 0x25,
+    0x3D, 0xCE, 0x1E, 0x19, 0x12, 0x93, 0x1A, 0xC5, 0x28, 0x4E, 0xA5, 0x95, 0xA7, 0x83, 0x9B, 0xB4,
+    0x2C, 0x42, 0x8F, 0xE2, 0xC5, 0x61, 0xA7, 0xDB, 0x2A, 0xBB, 0xE2, 0x53, 0x3B, 0x14, 0x1C, 0x36,
+    0x7B, 0xAD, 0x2E, 0xE7, 0xD4, 0x5F, 0xF2, 0xBB, 0xCD, 0x50, 0x0D, 0xAA, 0x4B, 0xF7, 0xA9, 0x9C,
+    0xBE, 0x51, 0x2D, 0x07, 0x50, 0x95, 0x74, 0xD9, 0xFE, 0xAF, 0x03, 0x07, 0xCF, 0xC8, 0x68, 0xE3,
+    0x49, 0x7C, 0xF1, 0x27, 0x9C, 0xB2, 0x1D, 0x98, 0x5A, 0x2B, 0x43, 0xE8, 0xB4, 0x1A, 0x8F, 0xB0,
+    0xC1, 0x65, 0x4A, 0x4C, 0xEA, 0x4B, 0x99, 0xC0, 0x48, 0x3D, 0x5E, 0x70, 0x69, 0xD1, 0x4A, 0x05,
+    0x64, 0x52, 0xF1, 0xA5, 0x27, 0xF5, 0x5A, 0x0A, 0xE3, 0x11, 0x93, 0xC1, 0xC8, 0xAB, 0x36, 0xA2,
+    0xAC, 0x88, 0xD5, 0x94, 0x6F, 0x8E, 0x1A, 0xF7, 0xD6, 0x51, 0xD3, 0xBE, 0x39, 0x6A, 0x76, 0x55,
+    0xE8, 0xC3, 0xF5, 0x70, 0xF5, 0x18, 0xA5, 0x00, 0x96, 0x4C, 0xF2, 0x13, 0xAD, 0xB0, 0x75, 0xE2,
+    0xAF, 0xE9, 0x86, 0x12, 0xDD, 0xE3, 0x99, 0x4A, 0x94, 0x1E, 0xFB, 0x06, 0x8B, 0xD4, 0x1A, 0xB7,
+    0xF8, 0xE1, 0x50, 0x85, 0x67, 0xDD, 0xB9, 0x2D, 0x16, 0x42, 0xC6, 0x67, 0xB3, 0x62, 0xAF, 0xC7,
+    0x2A, 0x8D, 0x47, 0xB8, 0xC8, 0x89, 0xE5, 0x4F, 0x15, 0xA0, 0xCF, 0x14, 0xD0, 0xFF, 0xA7, 0x00,
+    0xAE, 0x67, 0xA7, 0xB5, 0x67, 0x53, 0xAC, 0x14, 0x30, 0x97, 0xE9, 0xD0, 0x56, 0x28, 0x4A, 0x6D,
+    0x2B, 0x2C, 0xCB, 0xC2, 0xDE, 0x53, 0x07, 0xF5, 0x6B, 0x8E, 0xAE, 0x4F, 0x03, 0x67, 0xC0, 0xA0,
+    0x46, 0x4E, 0xE9, 0x12, 0xE7, 0xA7, 0xB9, 0xFA, 0xBF, 0x44, 0xD9, 0x1B, 0x24, 0x8A, 0x1A, 0xA6,
+    0x28, 0xC3, 0xA4, 0x8D, 0x95, 0x4E, 0x26, 0x4E, 0x26, 0x55, 0xF0, 0xD9, 0x78, 0xCC, 0xBA, 0xB0,
+    0x16, 0x5F, 0xEC, 0x9C, 0xD4, 0xB0, 0x39, 0x79, 0xC7, 0xB1, 0xE4, 0x04, 0xE8, 0xA2, 0xA3, 0xEB,
+    0x9E, 0xD9, 0x0C, 0x92, 0xD1, 0xC9, 0xB7, 0x67, 0x73, 0x3A, 0xAE, 0xB5, 0xC8, 0xE4, 0x12, 0xBA,
+    0x81, 0x78, 0x8B, 0xC3, 0x5D, 0x44, 0x30, 0x5D, 0x40, 0x95, 0x70, 0xDF, 0x08, 0x89, 0x6C, 0x12,
+    0xC6, 0x34, 0xBC, 0x55, 0x7C, 0x16, 0x38, 0xCB, 0xB2, 0x9B, 0x4B, 0x49, 0x9F, 0xA2, 0xCA, 0x61,
+    0xAE, 0xC9, 0x8F, 0x6A, 0x73, 0x99, 0x19, 0x59, 0xB9, 0x9B, 0x5A, 0x1D, 0x06, 0x42, 0x0A, 0x1C,
+    0x7C, 0x53, 0x6F, 0x92, 0x96, 0xE9, 0x12, 0x62, 0x0B, 0x4C, 0x25, 0xA1, 0xFF, 0xE8, 0xF5, 0x48,
+    0x19, 0xFA, 0xE2, 0xE6, 0x52, 0xD7, 0xC9, 0x53, 0x36, 0x9E, 0x97, 0xA2, 0x66, 0xDA, 0x9A, 0xFB,
+    0x81, 0xB3, 0x69, 0xD5, 0xD4, 0xD3, 0xF5, 0x36, 0xE2, 0xEE, 0xED, 0x76, 0xEA, 0x1B, 0xB3, 0x92,
+    0xA7, 0xD7, 0xE1, 0x58, 0xC9, 0x9D, 0xC9, 0xE4, 0x44, 0x7E, 0x64, 0x62, 0x58, 0x03, 0x4D, 0x6C,
+    0x78, 0x5E, 0x6F, 0xE5, 0xA4, 0xDB, 0xF5, 0x3F, 0xD8, 0xB6, 0x9A, 0x98, 0x9D, 0x7A, 0xB9, 0x28,
+    0x65, 0x24, 0x11, 0xAE, 0x29, 0x39, 0x46, 0x79, 0x64, 0x26, 0x6C, 0xAB, 0x76, 0xC1, 0xEB, 0x64,
+    0x9E, 0x72, 0x2C, 0xB1, 0x77, 0xE4, 0x96, 0xD0, 0xB5, 0x34, 0xB6, 0x97, 0xC2, 0x19, 0xF2, 0x57,
+    0xC4, 0xBC, 0x86, 0x34, 0xBB, 0xC7, 0x04, 0x0A, 0x1A, 0x8B, 0x89, 0xF1, 0xF3, 0x78, 0xEB, 0xF3,
+    0x2F, 0x9D, 0x55, 0x3D, 0x8F, 0xDC, 0x54, 0x14, 0x3D, 0xCF, 0x2F, 0xBB, 0x46, 0x72, 0xF1, 0x28,
+    0x28, 0x60, 0x53, 0xB8, 0x49, 0x91, 0x6A, 0xFD, 0x07, 0x76, 0x6C, 0x87, 0x14, 0x94, 0x49, 0x24,
+    0x36, 0x5B, 0x20, 0x51, 0x43, 0x35, 0x0D, 0xE5, 0x7C, 0x58, 0xD9, 0x82, 0x12, 0x9A, 0xF4, 0x5B,
+    0x6C, 0x81, 0x86, 0x86, 0x82, 0x0A, 0x79, 0x33, 0x86, 0x14, 0xB4, 0xDE, 0x44, 0x88, 0xD6, 0x12,
+    0x2B, 0x21, 0x81, 0x44, 0x5E, 0x61, 0x94, 0xB7, 0x91, 0x67, 0x1E, 0xE7, 0x3E, 0xEF, 0x2E, 0x48,
+    0x48, 0x14, 0xCC, 0x8C, 0x77, 0x67, 0x6C, 0xDF, 0x7B, 0xCF, 0x3D, 0xE7, 0xDC, 0x6B, 0xA8, 0xD5,
+    0x57, 0x28, 0xFC, 0x80, 0xED, 0xCA, 0x45, 0x3D, 0x9C, 0xEE, 0xD0, 0xEB, 0x4E, 0x59, 0x6D, 0x23,
+    0xAB, 0x36, 0xFC, 0xB5, 0xF6, 0x2D, 0x32, 0xDF, 0x60, 0x11, 0x37, 0x18, 0x92, 0x46, 0x5B, 0x53,
+    0x99, 0xC6, 0x94, 0x59, 0x99, 0xE2, 0x19, 0x32, 0x60, 0x07, 0xD0, 0x16, 0x98, 0x00, 0xBC, 0x01,
+    0xDF, 0x02, 0xB7, 0x20, 0xAF, 0x69, 0x0B, 0xEF, 0xB1, 0xFD, 0xA8, 0x3D, 0x83, 0x5B, 0x60, 0x52,
+    0x20, 0x33, 0xD5, 0xF2, 0x73, 0xEF, 0x9F, 0xF8, 0x2D, 0x6A, 0x48, 0x60, 0xD2, 0x40, 0xF5, 0x40,
+    0x51, 0xDE, 0x8D, 0x79, 0x6E, 0xB9, 0x05, 0x1E, 0x86, 0xC8, 0xA8, 0x9B, 0x21, 0x37, 0x4D, 0xD4,
+    0x7C, 0x86, 0xAB, 0xD7, 0xED, 0x1E, 0xC6, 0x5B, 0x7D, 0x39, 0x2D, 0x99, 0x2C, 0xAD, 0xCC, 0x7D,
+    0x62, 0xCB, 0xD5, 0x36, 0xF6, 0xBE, 0x5A, 0xFB, 0x8A, 0x79, 0x24, 0xA3, 0xFC, 0x9B, 0x13, 0x4B,
+    0x1F, 0x55, 0xA9, 0x77, 0x21, 0xDF, 0x3B, 0x57, 0xF1, 0x2C, 0x86, 0x9C, 0x89, 0xD7, 0x2B, 0x30,
+    0x06, 0xEA, 0xEC, 0x30, 0x44, 0xC0, 0x11, 0x7B, 0xBF, 0xEE, 0xD4, 0x6B, 0xEF, 0x22, 0x5F, 0x0D,
+    0x7A, 0x83, 0x5A, 0xF7, 0x3C, 0x2C, 0xEA, 0xB8, 0x85, 0x63, 0x46, 0x67, 0x1A, 0xD5, 0x9B, 0x2A,
+    0xB2, 0xA6, 0x8C, 0x6C, 0x0A, 0xDD, 0x65, 0xD0, 0x6D, 0xCE, 0x4E, 0xF3, 0x50, 0xCF, 0xC8, 0x51,
+    0x01, 0x69, 0x19, 0x8A, 0xDC, 0x7A, 0xC6, 0xAF, 0x03, 0x8F, 0x8E, 0xC9, 0x77, 0x4A, 0x28, 0x17,
+    0xEA, 0x9A, 0x12, 0x51, 0x0B, 0xBC, 0x1D, 0xB0, 0xEC, 0x6E, 0x4B, 0xCD, 0x76, 0xF7, 0x8F, 0xFA,
+    0x31, 0x54, 0x18, 0x60, 0x70, 0x8B, 0x69, 0x8F, 0xE2, 0x02, 0xA6, 0xBB, 0x61, 0xB3, 0x95, 0x2B,
+    0x77, 0x23, 0x36, 0x99, 0xF8, 0x0E, 0x8A, 0x25, 0x6E, 0x5F, 0x52, 0xA9, 0xA6, 0x78, 0x7A, 0x52,
+    0x94, 0x52, 0x92, 0xD5, 0xA9, 0x8F, 0xF2, 0xBE, 0x59, 0xFB, 0x6E, 0x24, 0x34, 0xB2, 0x81, 0x04,
+    0xD3, 0xBE, 0xC5, 0xD3, 0x48, 0x7D, 0x15, 0x38, 0x98, 0x5E, 0x50, 0xC5, 0x66, 0xFD, 0xB8, 0x2B,
+    0x42, 0x4D, 0x29, 0xB0, 0x2C, 0x91, 0x10, 0xDD, 0x92, 0x21, 0x43, 0xC0, 0xCF, 0x4C, 0xE8, 0xEF,
+    0x60, 0x30, 0x7E, 0xAB, 0xFC, 0x26, 0x94, 0xA3, 0x92, 0x85, 0x40, 0x08, 0xB8, 0x4F, 0xD1, 0xAB,
+    0x3E, 0x22, 0xF1, 0xBA, 0xD3, 0x6D, 0xDC, 0x24, 0x0D, 0x4D, 0x50, 0x19, 0x9A, 0x20, 0x63, 0x8B,
+    0x84, 0x7B, 0xAF, 0xCC, 0x0E, 0xF4, 0xAF, 0xCD, 0xBB, 0x77, 0x70, 0x75, 0xBB, 0x29, 0x95, 0xE5,
+    0x45, 0xE6, 0x9D, 0x48, 0x2F, 0xB5, 0xC0, 0x73, 0x37, 0x67, 0x2D, 0xA3, 0x74, 0x1B, 0x6A, 0x08,
+    0x45, 0x0B, 0x5C, 0x95, 0x09, 0xA1, 0x24, 0x85, 0x77, 0xB1, 0x17, 0x06, 0xF3, 0x26, 0xFA, 0x2A,
+    0x09, 0x1F, 0x62, 0x27, 0x97, 0x69, 0xE0, 0x3A, 0x0F, 0x1F, 0x16, 0x9E, 0x05, 0x2D, 0x9D, 0x04,
+    0x1D, 0x59, 0xD0, 0xAC, 0x6B, 0x81, 0xBE, 0x5A, 0x7D, 0xC9, 0xBF, 0x4B, 0xDF, 0x8B, 0xFC, 0x2B,
+    0xB6, 0xC8, 0x60, 0xB1, 0x41, 0xDC, 0x0A, 0xE9, 0xEC, 0x42, 0x6A, 0x3B, 0xF5, 0xE6, 0x52, 0x72,
+    0xAC, 0xBD, 0x65, 0xD6, 0xE2, 0xD1, 0x9A, 0x45, 0x0C, 0xFD, 0xC4, 0x16, 0x3B, 0xC5, 0x76, 0x99,
+    0x72, 0xC6, 0xE4, 0x39, 0x49, 0x38, 0x43, 0xD2, 0x66, 0xC7, 0x1E, 0x34, 0x75, 0x43, 0x67, 0x19,
+    0x32, 0x8B, 0xD1, 0x60, 0xA7, 0x82, 0x5C, 0xB7, 0x04, 0xCC, 0x1C, 0xA3, 0x17, 0x09, 0x8C, 0xC8,
+    0x9D, 0x28, 0x2F, 0x2A, 0x2E, 0x0E, 0xA7, 0x4F, 0x4B, 0xEA, 0xE8, 0x7D, 0x9B, 0xFC, 0xF6, 0xF5,
+    0x9B, 0x35, 0x0D, 0x64, 0x4A, 0xD3, 0xF4, 0xAC, 0x9C, 0xB1, 0x37, 0x3A, 0x4E, 0x5C, 0xA5, 0xBB,
+    0x81, 0x8A, 0x66, 0xF7, 0x3B, 0xCA, 0xE6, 0xA4, 0x4D, 0x2F, 0x7D, 0x04, 0x1D, 0xFE, 0xCB, 0xC2,
+    0x7B, 0x15, 0x7A, 0xDF, 0xAB, 0xD7, 0xBF, 0x0F, 0x91, 0x47, 0x4D, 0x31, 0x67, 0xE4, 0x76, 0xC6,
+    0xF2, 0x7F, 0x5B, 0xB8, 0x12, 0x0B, 0xAB, 0x7F, 0x59, 0x78, 0x12, 0xD0, 0xE2, 0x43, 0x04, 0x9F,
+    0x8A, 0xFE, 0x42, 0xCD, 0x3E, 0x6E, 0xE6, 0xE6, 0x14, 0x9F, 0x12, 0x9C, 0x1B, 0x77, 0x81, 0x21,
+    0x2B, 0x05, 0x23, 0x6B, 0xC4, 0x2F, 0x7A, 0x24, 0xE4, 0x39, 0xE1, 0x52, 0x30, 0xC7, 0x1D, 0xCC,
+    0xFB, 0xC2, 0x9E, 0x23, 0xC4, 0x9A, 0x44, 0xE5, 0x7C, 0x67, 0xEC, 0x2C, 0xAD, 0x02, 0xF6, 0x30,
+    0x1D, 0x18, 0xD3, 0x1E, 0xE0, 0x7A, 0x08, 0x4E, 0xB0, 0xC7, 0xC6, 0x9D, 0x20, 0x71, 0x48, 0xD9,
+    0xF2, 0x2C, 0x25, 0xB8, 0x19, 0xCC, 0x13, 0x8B, 0x89, 0x60, 0x25, 0xB6, 0xEF, 0x2D, 0x8A, 0xB8,
+    0x89, 0x5C, 0x8A, 0xB4, 0x5D, 0x44, 0xAF, 0xE0, 0x37, 0x33, 0xE5, 0xCF, 0xBB, 0x31, 0xC3, 0xC9,
+    0x2E, 0x6D, 0xDC, 0xC8, 0x6C, 0xFD, 0x6C, 0x45, 0x8D, 0x7F, 0x30, 0x15, 0x55, 0xD8, 0x13, 0x9B,
+    0x38, 0xE4, 0xA3, 0xE5, 0x72, 0x88, 0x6D, 0x45, 0x5A, 0xF1, 0x0E, 0x49, 0x9B, 0x89, 0xF8, 0x3D,
+    0x67, 0x41, 0x9F, 0xCB, 0x10, 0x3E, 0x20, 0x0B, 0xFB, 0x82, 0xED, 0x3B, 0x52, 0xA0, 0x5E, 0xF1,
+    0x8B, 0x76, 0x18, 0x67, 0x5B, 0x28, 0x0F, 0x33, 0x15, 0x26, 0x1C, 0xB4, 0x91, 0x4A, 0x79, 0x3A,
+    0xDD, 0x88, 0xB7, 0xAA, 0xB1, 0xD8, 0x27, 0xC2, 0x69, 0x0D, 0xC3, 0x2E, 0xE6, 0x02, 0x7D, 0x1E,
+    0xA0, 0xE7, 0x2C, 0xDD, 0x0B, 0xCB, 0x7D, 0xD0, 0x78, 0xA0, 0x35, 0xB8, 0xD6, 0x96, 0xF7, 0x5C,
+    0x52, 0x6B, 0xFF, 0xA7, 0x8D, 0xFD, 0x07, 0x15, 0x98, 0x52, 0x7D, 0x33, 0x16, 0x92, 0x3A, 0xFD,
+    0xB8, 0x41, 0xD3, 0xD1, 0xCF, 0xB5, 0xCC, 0x88, 0xFE, 0xC5, 0xCA, 0xE5, 0x94, 0x10, 0x79, 0x47,
+    0x5D, 0x88, 0xCF, 0x75, 0x27, 0x47, 0x60, 0x8D, 0x1C, 0xD7, 0x24, 0x78, 0xCB, 0xDF, 0x2C, 0x45,
+    0x26, 0x89, 0xB0, 0xE8, 0x30, 0x50, 0x2F, 0xDF, 0xD0, 0xE9, 0x8D, 0xE1, 0xDA, 0xE5, 0x9B, 0xC9,
+    0x68, 0xB2, 0xF8, 0x07, 0x9B, 0x70, 0x9B, 0x4D, 0xE2, 0x76, 0x4E, 0x0D, 0xAD, 0x39, 0x66, 0xEE,
+    0x2F, 0xCA, 0x82, 0xF5, 0x8A, 0x1A, 0x35, 0xAB, 0xAF, 0x1B, 0x45, 0x49, 0x15, 0xD3, 0x0D, 0x61,
+    0xA7, 0x9B, 0xF6, 0x7A, 0x24, 0xC9, 0x28, 0x09, 0x3F, 0x15, 0x7D, 0xF5, 0x4B, 0x71, 0x76, 0x6A,
+    0x2A, 0x71, 0x38, 0x8D, 0x5C, 0x89, 0x84, 0x94, 0x3C, 0x18, 0x9E, 0x5E, 0x33, 0x9D, 0x2C, 0xC7,
+    0x75, 0x95, 0xB3, 0xE0, 0x1F, 0x8A, 0xC4, 0x1F, 0xD4, 0x9C, 0x82, 0xE7, 0xE7, 0x96, 0x14, 0x7D,
+    0xAC, 0x7F, 0x64, 0x23, 0xD6, 0x9C, 0xB1, 0x56, 0x99, 0x75, 0x08, 0xE2, 0x84, 0x09, 0x16, 0x27,
+    0x3A, 0x3A, 0xCA, 0x5B, 0xEF, 0xB7, 0x3B, 0xD3, 0xC3, 0x52, 0x76, 0x94, 0x8C, 0x51, 0x2B, 0x43,
+    0xCC, 0x05, 0xE8, 0xB1, 0x39, 0x1A, 0x38, 0x9B, 0x54, 0x6C, 0x4E, 0xC2, 0x5F, 0x58, 0xCC, 0x59,
+    0xFC, 0x79, 0x1B, 0xB9, 0xF9, 0x63, 0x9F, 0xC8, 0x83, 0x60, 0x7B, 0xA5, 0x3F, 0x35, 0x91, 0x0D,
+    0x60, 0x64, 0xF9, 0x61, 0x7E, 0xB9, 0xE4, 0x09, 0x2F, 0x8C, 0x1A, 0x2B, 0x23, 0x5A, 0x84, 0xC7,
+    0x8E, 0x93, 0x9D, 0x1B, 0xCB, 0x13, 0x8A, 0x4B, 0x41, 0x73, 0xA4, 0x07, 0x0A, 0x2C, 0xA3, 0xC7,
+    0xD9, 0x15, 0x27, 0x0A, 0x63, 0x49, 0x13, 0xBF, 0xA4, 0xB1, 0xAB, 0x82, 0x02, 0x14, 0x9E, 0x5A,
+    0x22, 0xDB, 0x4A, 0x7A, 0x75, 0x43, 0x0A, 0xD5, 0xDA, 0xF5, 0x17, 0x8C, 0xE1, 0x44, 0x72, 0xAD,
+    0x28, 0xFF, 0x68, 0x46, 0x9E, 0xB9, 0x59, 0x99, 0x4C, 0x44, 0xE5, 0x96, 0xB1, 0x61, 0x74, 0x17,
+    0xE2, 0xA9, 0x2E, 0x18, 0x6A, 0x22, 0x6B, 0x41, 0x02, 0x58, 0x94, 0x7B, 0xC7, 0xF3, 0xC1, 0x6B,
+    0x7E, 0x5A, 0x1E, 0x72, 0x9A, 0x5D, 0xB8, 0xD9, 0x94, 0x85, 0xD4, 0xB8, 0x8E, 0xCC, 0x42, 0xA4,
+    0xCC, 0x27, 0xD9, 0x10, 0x3D, 0x08, 0x7A, 0x59, 0xBD, 0x47, 0xCA, 0xB8, 0x4F, 0x3A, 0xB6, 0x12,
+    0xFB, 0x4D, 0xC0, 0xF2, 0x10, 0xFF, 0xF3, 0xF5, 0x17, 0xBD, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14,
+    0x3D, 0xE3, 0x11, 0x18, 0xE1, 0x62, 0x1A, 0x68, 0xB2, 0x85, 0x5B, 0x1A, 0x34, 0x7F, 0x60, 0xFD,
+    0x01, 0x5B, 0xD2, 0x50, 0x10, 0xE5, 0x0F, 0x50, 0x20, 0x21, 0xC1, 0x1F, 0xB0, 0x59, 0x2F, 0x94,
+    0x14, 0x49, 0x11, 0x51, 0x83, 0xB4, 0x05, 0x7A, 0x91, 0xA8, 0x28, 0x56, 0xE2, 0xED, 0xBE, 0xD9,
+    0xA4, 0xD8, 0x22, 0x8D, 0x13, 0x44, 0xCD, 0x48, 0x89, 0xB4, 0x88, 0x86, 0x49, 0x32, 0x88, 0x01,
+    0x79, 0x9F, 0x39, 0xD7, 0x6F, 0x83, 0xE0, 0x0F, 0xE0, 0x27, 0x5B, 0x7E, 0xF6, 0xCC, 0xBD, 0xE7,
+    0x9E, 0x73, 0xEE, 0x35, 0x8E, 0xB1, 0xF7, 0x27, 0x2A, 0xD8, 0xD9, 0x95, 0x68, 0x7E, 0xFA, 0xBA,
+    0x70, 0xB6, 0x45, 0x16, 0xCC, 0x00, 0xA4, 0xC2, 0x01, 0xB5, 0xF6, 0x40, 0x39, 0xCF, 0xB3, 0x2B,
+    0x78, 0xF1, 0x3A, 0x58, 0x5C, 0xBF, 0xA9, 0xB2, 0xC0, 0x37, 0xE8, 0x81, 0xC2, 0x99, 0xF1, 0x35,
+    0xED, 0xD5, 0x3C, 0x23, 0x72, 0x2D, 0xB7, 0xE2, 0x0D, 0xC8, 0x71, 0xC2, 0x33, 0xE7, 0x2A, 0x34,
+    0x5C, 0xAF, 0xE6, 0x16, 0x30, 0x9F, 0xF0, 0xDF, 0x9A, 0xCF, 0xF5, 0x63, 0x3E, 0x6F, 0x72, 0x07,
+    0x15, 0x0D, 0x1F, 0xCF, 0x57, 0xC0, 0x66, 0x4E, 0xD0, 0x97, 0x97, 0x1E, 0xD6, 0xBC, 0xE7, 0x54,
+    0xDC, 0x2F, 0x61, 0xCE, 0x43, 0x87, 0xAE, 0x70, 0x51, 0x7B, 0xE2, 0xB0, 0x88, 0x86, 0xB7, 0xCE,
+    0x1A, 0x42, 0xED, 0x7A, 0x9C, 0xA8, 0x08, 0xDC, 0x18, 0x76, 0xD1, 0x0F, 0x47, 0xE0, 0x0F, 0x8F,
+    0xEC, 0xB9, 0x87, 0x7E, 0x14, 0x60, 0x8E, 0x02, 0x91, 0x44, 0x34, 0x3C, 0xD7, 0x27, 0x09, 0x31,
+    0xAD, 0xB3, 0x10, 0xD7, 0xF9, 0x18, 0x3A, 0xBE, 0xAA, 0xCA, 0xCC, 0x57, 0xB5, 0x1E, 0x6B, 0x74,
+    0x02, 0x92, 0x85, 0x10, 0x25, 0x4B, 0x66, 0xA0, 0x4A, 0x70, 0x32, 0xB0, 0xF9, 0x8E, 0x65, 0x09,
+    0x52, 0xBB, 0xC4, 0x4B, 0x82, 0x55, 0x8F, 0x04, 0xDB, 0x0A, 0x19, 0x57, 0x04, 0x3B, 0xCF, 0x49,
+    0xFF, 0x7E, 0xEB, 0xF2, 0x92, 0x5C, 0x09, 0xE0, 0x0A, 0x44, 0xAC, 0x02, 0x21, 0xF7, 0x85, 0x13,
+    0xCC, 0xF5, 0x02, 0x3A, 0x09, 0xEA, 0x8B, 0x31, 0x11, 0x76, 0xB9, 0xE0, 0x5E, 0xEF, 0x80, 0x1F,
+    0x0B, 0x72, 0xE2, 0x63, 0xA1, 0xD8, 0xB8, 0x2C, 0xA8, 0x17, 0x63, 0x16, 0xF4, 0x93, 0x51, 0xFB,
+    0xFC, 0xBE, 0xD7, 0xDE, 0x7C, 0x1E, 0x72, 0x66, 0x08, 0x42, 0x7A, 0x30, 0x6E, 0x4A, 0x91, 0xB0,
+    0x63, 0x32, 0x07, 0x3E, 0xA4, 0xB2, 0x38, 0x0F, 0x6B, 0x6B, 0xDE, 0xF5, 0x5D, 0x6D, 0xF5, 0xD8,
+    0x55, 0xBD, 0x1E, 0x2B, 0x68, 0x59, 0x48, 0x1E, 0x29, 0x14, 0x9A, 0x9B, 0x37, 0x49, 0xE7, 0x1A,
+    0x05, 0x39, 0x49, 0x22, 0x50, 0x16, 0x72, 0xAA, 0xA8, 0xFD, 0x67, 0x24, 0xBF, 0xB8, 0xE0, 0x2D,
+    0xCC, 0x19, 0x2F, 0xD9, 0xBC, 0xE5, 0xF5, 0x90, 0xB2, 0x21, 0xF7, 0x91, 0x4F, 0xEA, 0x7C, 0x9C,
+    0xB8, 0xD8, 0x66, 0xC2, 0xC6, 0x44, 0x71, 0xD6, 0xDA, 0x97, 0xDC, 0x67, 0xDA, 0x9E, 0x3C, 0x74,
+    0xC4, 0x9B, 0x08, 0x72, 0xCC, 0x9D, 0x71, 0xA6, 0x6D, 0x50, 0xF3, 0x87, 0xD7, 0x57, 0xAB, 0x6F,
+    0x85, 0x0D, 0x8F, 0xBF, 0x56, 0x1B, 0x6E, 0xD6, 0x01, 0x7A, 0x6C, 0x18, 0xF1, 0x01, 0xF3, 0x98,
+    0x8D, 0x64, 0x61, 0xFC, 0x66, 0xB3, 0x61, 0x9C, 0x54, 0x83, 0x88, 0xD7, 0x88, 0x65, 0x16, 0x48,
+    0x52, 0xEE, 0xAA, 0xCC, 0x97, 0x3A, 0x98, 0xB6, 0x2A, 0xDB, 0x7D, 0x46, 0xEF, 0xB8, 0x76, 0x8E,
+    0x74, 0x9F, 0x94, 0x61, 0x06, 0xD6, 0x71, 0x46, 0x41, 0x7A, 0xA2, 0x23, 0x4B, 0x13, 0x1A, 0x4A,
+    0xA2, 0x22, 0x13, 0x50, 0x93, 0xD0, 0x48, 0x6D, 0xF9, 0x8F, 0x92, 0x8D, 0x65, 0xEF, 0x3C, 0xBA,
+    0x6D, 0x17, 0x5D, 0xE6, 0x96, 0xC2, 0xC4, 0xE9, 0x90, 0x45, 0x58, 0xED, 0x7B, 0x54, 0x22, 0x5B,
+    0xA4, 0x36, 0xAE, 0xD3, 0x63, 0xE1, 0x7A, 0xB1, 0x77, 0xAD, 0xE5, 0x82, 0x64, 0x5A, 0x5E, 0xF2,
+    0x71, 0xCD, 0xB8, 0x84, 0xE2, 0x69, 0x65, 0xB7, 0xB6, 0x4C, 0xC0, 0xF0, 0xC7, 0x4B, 0x69, 0x91,
+    0x81, 0x27, 0x06, 0x58, 0xDD, 0x0B, 0x02, 0xBA, 0x70, 0xC2, 0x00, 0x01, 0x78, 0x15, 0x26, 0x5E,
+    0xF1, 0x03, 0xCD, 0xB3, 0x38, 0x82, 0x52, 0xB1, 0x48, 0x6A, 0x55, 0x9B, 0x81, 0xF2, 0x55, 0x0C,
+    0x75, 0xE0, 0xF7, 0x73, 0x57, 0x2E, 0x95, 0x5A, 0xD3, 0x9E, 0xD0, 0x70, 0x16, 0x89, 0x6A, 0xD1,
+    0x2B, 0xD2, 0x56, 0x1F, 0x92, 0x61, 0xFD, 0x68, 0x22, 0xF6, 0x35, 0x75, 0xD8, 0xB4, 0x50, 0x9B,
+    0x04, 0x90, 0x01, 0x94, 0x77, 0xAC, 0x43, 0x0B, 0x79, 0x9C, 0x53, 0x44, 0xB1, 0xA9, 0xD8, 0x11,
+    0xE2, 0x78, 0x9C, 0xC9, 0x9A, 0x96, 0x45, 0xD3, 0xFA, 0x37, 0x37, 0xD2, 0x6D, 0xA7, 0x3C, 0xF5,
+    0xD2, 0x67, 0xFF, 0xBE, 0x31, 0xDC, 0x59, 0x4C, 0x78, 0x95, 0x2A, 0x17, 0xA4, 0x46, 0x6D, 0xEF,
+    0x5E, 0x2F, 0x10, 0x03, 0x34, 0xBF, 0x6E, 0x07, 0x36, 0xEC, 0x04, 0xB5, 0x5A, 0xB9, 0xA5, 0x59,
+    0xA1, 0xD8, 0xB5, 0xF9, 0x11, 0x0D, 0xF0, 0xE4, 0x29, 0x33, 0xB4, 0xDC, 0xD8, 0xB2, 0x7F, 0x3C,
+    0xEA, 0x5B, 0x12, 0x31, 0xEE, 0x4E, 0xC5, 0xFB, 0x3D, 0x32, 0xBE, 0xC5, 0xC2, 0xFA, 0x82, 0x8A,
+    0x0A, 0x2C, 0x27, 0xCB, 0x01, 0x71, 0x7F, 0x2C, 0xF9, 0x3C, 0x9A, 0xBB, 0x3B, 0xDC, 0xBD, 0x64,
+    0x23, 0x06, 0x23, 0x3E, 0x60, 0x12, 0xE1, 0xB0, 0x70, 0x89, 0x7A, 0x4E, 0x24, 0x6A, 0x30, 0x47,
+    0x51, 0xF1, 0x27, 0x9C, 0x5B, 0x4D, 0x8A, 0xB3, 0x20, 0xB6, 0x62, 0x73, 0xCA, 0xAF, 0xE7, 0xEE,
+    0x2E, 0x1F, 0x45, 0x95, 0x1E, 0x93, 0x68, 0x4F, 0x57, 0xA0, 0x19, 0x62, 0xE9, 0xB0, 0x18, 0x3E,
+    0x13, 0xB6, 0xA0, 0x0E, 0xDF, 0x7F, 0x59, 0xD7, 0x92, 0x6E, 0x41, 0x85, 0x85, 0x3E, 0x69, 0xEB,
+    0x7F, 0x0E, 0xC3, 0x09, 0x44, 0x43, 0xED, 0xAA, 0xD8, 0x2D, 0xAA, 0xB1, 0xAB, 0xEB, 0x38, 0x77,
+    0x6F, 0xE5, 0x23, 0x1B, 0xB8, 0x04, 0xA7, 0x84, 0xF8, 0xFE, 0x40, 0x6C, 0x6F, 0xDA, 0x4E, 0x85,
+    0x8E, 0xC2, 0xDF, 0x5F, 0xDA, 0xDC, 0xD1, 0x2C, 0x35, 0x62, 0x3E, 0x26, 0x2A, 0xCA, 0x89, 0x44,
+    0x5F, 0xB8, 0x64, 0x9C, 0x7D, 0xF0, 0x98, 0xEE, 0x9C, 0x29, 0x88, 0x9D, 0x9F, 0x5E, 0x2B, 0xB0,
+    0xE4, 0xFD, 0x6F, 0x2E, 0x19, 0x9D, 0x34, 0xED, 0xCB, 0xA3, 0x98, 0xEF, 0x08, 0x7E, 0x32, 0x35,
+    0x7E, 0xEA, 0x75, 0xA2, 0x75, 0xEC, 0x80, 0x72, 0xA0, 0x1F, 0x1A, 0xE9, 0xDC, 0x89, 0x5A, 0x65,
+    0xCF, 0xB8, 0xBC, 0x78, 0x28, 0x9E, 0xB6, 0x3C, 0xA7, 0xED, 0x6A, 0x75, 0xEF, 0x85, 0x8C, 0xDD,
+    0xDB, 0x8C, 0x77, 0xDA, 0x48, 0x2A, 0x16, 0x69, 0x8F, 0xB8, 0x6A, 0xD2, 0xB4, 0xCD, 0x98, 0xA7,
+    0x4C, 0xD8, 0x9F, 0x47, 0x46, 0x4E, 0x2F, 0xE7, 0xF0, 0xDE, 0x2F, 0xFC, 0x77, 0x85, 0xE6, 0xAB,
+    0x29, 0x63, 0x07, 0x97, 0x43, 0xC6, 0x4D, 0x05, 0xDB, 0xD3, 0x8A, 0xB5, 0xD9, 0xFE, 0xCF, 0xD9,
+    0xEE, 0x5F, 0x3A, 0xF4, 0x25, 0xDB, 0xB7, 0x47, 0xD9, 0x5E, 0x65, 0x09, 0x52, 0xCC, 0x26, 0x2E,
+    0x38, 0xF7, 0x59, 0xCC, 0x93, 0x91, 0x13, 0x86, 0xD5, 0x5C, 0x91, 0xE4, 0x92, 0x2D, 0x23, 0x4A,
+    0x41, 0x86, 0x82, 0x91, 0xD9, 0xC5, 0xCC, 0x74, 0x96, 0x0A, 0xF4, 0xAA, 0x69, 0x89, 0x3F, 0x96,
+    0xB4, 0xE7, 0x01, 0x71, 0x26, 0x6E, 0x91, 0xD0, 0x38, 0x61, 0xA8, 0xE2, 0x37, 0xEC, 0xE6, 0x74,
+    0x3E, 0x89, 0x25, 0xDA, 0x6B, 0xA2, 0x3E, 0x82, 0xFA, 0x26, 0xA0, 0xB9, 0x60, 0x6B, 0x97, 0xAD,
+    0x19, 0x2A, 0xCA, 0xC6, 0xEE, 0x90, 0xC1, 0x63, 0x86, 0x04, 0x2B, 0x53, 0xA8, 0x86, 0x7A, 0xC6,
+    0x36, 0x7B, 0x38, 0xC0, 0x50, 0xDE, 0x3A, 0x2C, 0xF6, 0xD4, 0x8C, 0xF2, 0x8A, 0x6A, 0x77, 0x44,
+    0xE9, 0x47, 0x4C, 0x60, 0x85, 0xE5, 0xEF, 0xDF, 0x16, 0x93, 0xB5, 0x0B, 0x72, 0xCD, 0xFF, 0x5B,
+    0x42, 0x68, 0x5E, 0x10, 0x18, 0xA7, 0xBD, 0x34, 0x39, 0x81, 0x5A, 0x36, 0x15, 0xE1, 0x4F, 0xBC,
+    0x29, 0x5B, 0x25, 0x13, 0x6B, 0xF9, 0x8C, 0x51, 0x4B, 0x98, 0x77, 0x18, 0x27, 0x32, 0xA0, 0xF9,
+    0x42, 0x86, 0x27, 0xC9, 0x2D, 0x6E, 0x33, 0xD6, 0x19, 0x53, 0xE6, 0x57, 0x02, 0x5F, 0xEC, 0x1E,
+    0xAF, 0x1B, 0xEC, 0x83, 0x37, 0x19, 0xF1, 0x54, 0xE6, 0x1A, 0x33, 0x11, 0xDF, 0xB9, 0x87, 0x52,
+    0x4B, 0xE6, 0x1B, 0x2C, 0xAB, 0x83, 0x21, 0xE8, 0x3E, 0x1F, 0x65, 0x7E, 0x5A, 0x5A, 0x21, 0x71,
+    0xD0, 0x38, 0x7E, 0x14, 0xC0, 0xF9, 0xCD, 0x6F, 0xDC, 0x80, 0xAE, 0x83, 0x92, 0xEF, 0xD5, 0xCF,
+    0x64, 0x8B, 0x99, 0x1A, 0x66, 0x9C, 0xF1, 0x3F, 0x1F, 0x7F, 0x03, 0xD5, 0x55, 0x31, 0x8C, 0xDC,
+    0x44, 0x14, 0xFD, 0xE3, 0x11, 0x67, 0x05, 0x0B, 0xCD, 0x15, 0x20, 0x45, 0x21, 0x61, 0x28, 0x03,
+    0x3A, 0xC9, 0x4D, 0x0A, 0x8A, 0xAC, 0xED, 0x0B, 0x42, 0x29, 0x28, 0x92, 0x8A, 0x3A, 0x65, 0x28,
+    0xD0, 0x51, 0x04, 0x29, 0xC5, 0x6E, 0x3C, 0x88, 0x82, 0x82, 0x22, 0xA7, 0x14, 0xD4, 0x29, 0x28,
+    0xA2, 0x93, 0x50, 0x52, 0x50, 0x9C, 0x90, 0x73, 0x3B, 0x40, 0x41, 0x6B, 0x0A, 0x44, 0x79, 0x93,
+    0x70, 0x52, 0x8A, 0x2B, 0x62, 0x82, 0xA5, 0xF8, 0x88, 0x77, 0x87, 0xF7, 0xC7, 0xDE, 0x70, 0x57,
+    0x41, 0xCB, 0x48, 0xBB, 0xEB, 0xF1, 0xFC, 0xF9, 0xF3, 0xFE, 0x7B, 0x6F, 0xFE, 0x12, 0xAD, 0x46,
+    0xE2, 0xB7, 0xC3, 0x6F, 0xE4, 0xBD, 0x0B, 0x0F, 0x79, 0xBD, 0x15, 0x1E, 0x64, 0x47, 0xCA, 0xF2,
+    0x43, 0x6A, 0x48, 0x1B, 0x7E, 0xE8, 0xB1, 0xB8, 0x66, 0xE8, 0xDD, 0xA4, 0xC6, 0xB3, 0x26, 0xD1,
+    0xE6, 0xD8, 0xD6, 0x4C, 0x48, 0xFD, 0xD0, 0x21, 0x8F, 0x6D, 0x69, 0xC6, 0x2B, 0xA9, 0x74, 0xB2,
+    0x49, 0x39, 0x5C, 0x19, 0x5D, 0x60, 0x0F, 0xCF, 0x3A, 0xD9, 0x10, 0xB2, 0x54, 0xB1, 0xE5, 0x9C,
+    0x0F, 0x45, 0x93, 0x51, 0xCE, 0x2B, 0xF2, 0xC7, 0x86, 0x2A, 0x3E, 0x42, 0x5D, 0x31, 0xA2, 0xE3,
+    0x23, 0x26, 0x53, 0x92, 0x2D, 0xE9, 0x9A, 0x9E, 0xD7, 0x14, 0x77, 0xD1, 0x92, 0xA2, 0xA7, 0x0C,
+    0xD2, 0x63, 0xD6, 0x32, 0x4A, 0x04, 0x69, 0x86, 0xF5, 0x3A, 0x3E, 0xB3, 0xB1, 0x06, 0x4E, 0x1E,
+    0x46, 0xBA, 0xAA, 0xAA, 0x1B, 0x7F, 0x43, 0x28, 0x2F, 0xF4, 0xE3, 0x8B, 0x79, 0xA8, 0xE4, 0xCD,
+    0x03, 0x7A, 0x87, 0xC4, 0xDD, 0xC8, 0xF7, 0xC4, 0x55, 0xE6, 0x5F, 0xF7, 0xD2, 0xD1, 0x2C, 0x6A,
+    0x45, 0x97, 0x58, 0xE9, 0xB4, 0x61, 0xC8, 0x1A, 0xC0, 0x12, 0x3B, 0x05, 0x74, 0x47, 0xA9, 0x68,
+    0x12, 0xAB, 0x0B, 0xAA, 0x64, 0x9D, 0x11, 0x00, 0x36, 0xEA, 0x52, 0x13, 0x35, 0xA4, 0x4C, 0xA6,
+    0x8A, 0xC4, 0x02, 0xC7, 0x6E, 0x85, 0x78, 0xD9, 0x44, 0xBF, 0xD7, 0x74, 0x8B, 0x74, 0x11, 0x03,
+    0xF3, 0x22, 0x42, 0x6A, 0x40, 0xF6, 0xDE, 0x50, 0x0E, 0x18, 0xF3, 0x36, 0x30, 0x18, 0xF0, 0xBA,
+    0x93, 0x70, 0x47, 0xB4, 0x03, 0xDD, 0x24, 0x16, 0xC3, 0x0F, 0x4A, 0x0E, 0xC1, 0x47, 0xC3, 0xEA,
+    0x5A, 0x81, 0xAF, 0x92, 0x77, 0xF9, 0x82, 0x09, 0xB1, 0xE4, 0xE7, 0xDE, 0x2A, 0x77, 0x3D, 0x35,
+    0x7B, 0x10, 0x86, 0x39, 0x98, 0xA5, 0x88, 0xE9, 0x98, 0xF2, 0x27, 0xD8, 0xAB, 0xEE, 0x23, 0x38,
+    0x03, 0xBB, 0xF4, 0x02, 0x6B, 0xF1, 0x3E, 0xB2, 0xA7, 0x39, 0xEB, 0x82, 0x80, 0xF8, 0x31, 0x5E,
+    0xE5, 0xB1, 0xA3, 0xA8, 0x53, 0xF5, 0xD5, 0xD4, 0xEA, 0xA7, 0x4F, 0x7A, 0xD2, 0x9C, 0x34, 0xF1,
+    0x07, 0x14, 0xA8, 0xA6, 0xA4, 0x58, 0x59, 0xC4, 0x92, 0x98, 0x6F, 0xE3, 0x5C, 0x27, 0x5F, 0x78,
+    0x97, 0x7E, 0x90, 0x40, 0x6F, 0xFD, 0xA1, 0xA5, 0x2C, 0x23, 0x3A, 0x6A, 0x49, 0x1E, 0x5A, 0xD2,
+    0x5B, 0x44, 0xD3, 0x8A, 0xE4, 0x1F, 0x0D, 0xE9, 0x2F, 0x1C, 0xA4, 0xFF, 0x6D, 0xBF, 0x56, 0x7E,
+    0x81, 0x6C, 0x26, 0xA8, 0xB3, 0x46, 0xFF, 0x8C, 0xF8, 0x68, 0xF0, 0xDB, 0x92, 0xF3, 0x5F, 0x5C,
+    0x63, 0x4E, 0xC4, 0x95, 0xCD, 0x62, 0x74, 0x18, 0x57, 0x3C, 0xF0, 0xF0, 0x5D, 0xF8, 0x3E, 0x7D,
+    0x6C, 0xE3, 0xB2, 0xD8, 0xC2, 0x71, 0xBE, 0x57, 0xB0, 0xEA, 0xF2, 0x72, 0xD1, 0x96, 0x45, 0x8E,
+    0x6D, 0xA2, 0x8B, 0x5D, 0x60, 0x2F, 0xEC, 0xAE, 0x34, 0x67, 0x4A, 0x7E, 0x0A, 0x96, 0xA8, 0xB2,
+    0xC0, 0xEB, 0xCF, 0x81, 0xC9, 0xBE, 0x0A, 0x93, 0xAF, 0x2C, 0xBD, 0x01, 0xEF, 0xF6, 0x24, 0x6B,
+    0x4A, 0x15, 0x8B, 0x27, 0x9B, 0x9E, 0x6B, 0x9C, 0x61, 0xD2, 0x23, 0x4D, 0x05, 0x5D, 0xA3, 0x36,
+    0x76, 0xF0, 0x63, 0x49, 0xB9, 0x99, 0xBB, 0xD4, 0x0A, 0x8F, 0xD1, 0x50, 0xEC, 0xEB, 0x39, 0xB4,
+    0x12, 0x05, 0x5D, 0x0D, 0x25, 0x7C, 0xC3, 0xA0, 0xF8, 0xDA, 0xC8, 0x5F, 0xE6, 0xC0, 0xFC, 0xE8,
+    0xF3, 0x07, 0xAB, 0x1A, 0x54, 0xA8, 0x83, 0xBD, 0x16, 0x9B, 0x63, 0xA5, 0x93, 0xD8, 0x2B, 0xE6,
+    0x46, 0x7A, 0x57, 0xF6, 0xF2, 0xE8, 0xDA, 0xA9, 0xF2, 0x12, 0x78, 0x96, 0x8F, 0xBA, 0x15, 0xB8,
+    0x94, 0xE1, 0x26, 0xFB, 0x28, 0x40, 0x3E, 0xB7, 0x91, 0xA3, 0xBF, 0x1A, 0x58, 0x03, 0x0A, 0x4E,
+    0x28, 0xD5, 0xF0, 0x17, 0xEA, 0x48, 0x6C, 0x52, 0x2F, 0xE2, 0x56, 0x39, 0x68, 0xE5, 0x9D, 0xF0,
+    0x8F, 0x61, 0x12, 0x41, 0xAF, 0x04, 0x33, 0xB1, 0x7A, 0x44, 0xDF, 0xEF, 0x7D, 0xCB, 0x33, 0x63,
+    0xDE, 0xA6, 0x93, 0x63, 0x8A, 0xBB, 0x4A, 0x12, 0xBA, 0xA3, 0x4C, 0x75, 0xDB, 0xF2, 0xFD, 0x9B,
+    0xE5, 0xEC, 0xBD, 0x08, 0xE5, 0xC3, 0x91, 0x0A, 0xBA, 0x29, 0x03, 0x16, 0x0C, 0x2C, 0x1C, 0xE1,
+    0x82, 0x72, 0x03, 0x30, 0x50, 0xDA, 0xD1, 0x14, 0x12, 0x7A, 0x5C, 0x0A, 0x65, 0x13, 0x0F, 0x77,
+    0xE7, 0x74, 0xB1, 0xC7, 0xE5, 0xA8, 0x90, 0x4C, 0xD6, 0x51, 0xA3, 0x13, 0x9B, 0x52, 0x5C, 0xB7,
+    0x7A, 0xB3, 0x65, 0x5B, 0x64, 0xC8, 0x9F, 0x4D, 0xA8, 0x9F, 0x12, 0x2D, 0x9B, 0xE8, 0xCF, 0x1A,
+    0x4A, 0x83, 0x24, 0x10, 0x81, 0x74, 0x4D, 0x30, 0x79, 0x5E, 0x1C, 0x23, 0x64, 0x67, 0xE7, 0x1E,
+    0x6A, 0x3E, 0x3C, 0x04, 0x8B, 0x67, 0x5F, 0x93, 0x27, 0x10, 0x5F, 0xA7, 0x33, 0x14, 0xDD, 0x69,
+    0x58, 0x94, 0x2B, 0x06, 0x08, 0xA7, 0x19, 0x00, 0x49, 0x07, 0x4A, 0x48, 0xBD, 0xEF, 0x80, 0xBC,
+    0xE2, 0xA9, 0x74, 0xE8, 0x25, 0x46, 0x13, 0xF7, 0x8A, 0x0E, 0x68, 0x76, 0x63, 0x9B, 0xD8, 0x67,
+    0x68, 0x4B, 0x5A, 0x5D, 0x46, 0x77, 0x99, 0xDC, 0x54, 0x1A, 0x37, 0xC0, 0x66, 0x2D, 0x45, 0x0B,
+    0xBE, 0xFE, 0xD2, 0xBD, 0xEC, 0x0E, 0x54, 0x2E, 0x0B, 0x48, 0xDB, 0x44, 0xCB, 0xCD, 0x9B, 0x11,
+    0x74, 0x13, 0xFD, 0xA8, 0xDF, 0x2D, 0xEE, 0x83, 0x2C, 0x23, 0xC4, 0x8B, 0x6B, 0xEE, 0x72, 0xE3,
+    0x42, 0x3E, 0x5E, 0xD3, 0xD0, 0x71, 0x58, 0x32, 0xEE, 0x8C, 0x92, 0x6F, 0x4B, 0x69, 0xB8, 0x4D,
+    0xE1, 0x75, 0xD9, 0x8D, 0x09, 0xD8, 0x88, 0xC9, 0x2A, 0x96, 0x5F, 0x4E, 0xF8, 0x65, 0x68, 0x3F,
+    0x47, 0x50, 0xCB, 0xE6, 0xBF, 0xDE, 0x45, 0x6B, 0xC5, 0x11, 0x08, 0x02, 0x28, 0xD1, 0xB2, 0x46,
+    0xDC, 0x13, 0x30, 0xE7, 0x03, 0xD1, 0xDD, 0x54, 0xBD, 0x2E, 0x3C, 0x5F, 0xCC, 0x70, 0x10, 0x0C,
+    0x2B, 0x9A, 0x70, 0x2C, 0x7C, 0xA2, 0x8A, 0x80, 0x6C, 0x20, 0x91, 0x2D, 0x58, 0xD3, 0x7B, 0xD8,
+    0x58, 0xDE, 0xE6, 0xE6, 0xC0, 0xDD, 0x03, 0xEF, 0x61, 0x4D, 0xF1, 0xAC, 0x5F, 0x97, 0xF5, 0xC6,
+    0x04, 0x4B, 0x29, 0x8C, 0x15, 0x2F, 0xC7, 0x1E, 0xE8, 0x5B, 0xE4, 0x5A, 0x60, 0xD7, 0xE9, 0x80,
+    0x31, 0x7E, 0x29, 0xC9, 0xC6, 0x99, 0x9D, 0x87, 0xA5, 0x67, 0xF5, 0xD6, 0x79, 0x5A, 0xD0, 0x56,
+    0x9B, 0x2E, 0xAB, 0xD2, 0x6C, 0x60, 0x72, 0xBE, 0x6A, 0x6F, 0x9C, 0xA3, 0xF3, 0xA5, 0x3E, 0x77,
+    0x83, 0x5E, 0xDD, 0xA6, 0x7C, 0x59, 0xEC, 0x6E, 0xF5, 0x0F, 0xC4, 0x3D, 0xBE, 0x0B, 0x07, 0xE3,
+    0xFE, 0xF1, 0x5F, 0x84, 0x36, 0xE2, 0x11, 0x5B, 0x71, 0xC2, 0x88, 0x11, 0x13, 0x01, 0x2B, 0x10,
+    0x53, 0x25, 0x10, 0x7C, 0x56, 0x16, 0x43, 0x70, 0x81, 0xF3, 0xC4, 0x70, 0xE8, 0xBF, 0x8C, 0x8F,
+    0x87, 0x7E, 0xB8, 0x9D, 0x07, 0x1D, 0xA5, 0xFF, 0xF2, 0xA3, 0x40, 0xC4, 0x67, 0x9F, 0x5C, 0x3B,
+    0x15, 0x16, 0x68, 0x9B, 0xFE, 0xFB, 0x28, 0xED, 0x20, 0x9E, 0x62, 0xC2, 0x40, 0xB4, 0xB0, 0x17,
+    0x80, 0xD2, 0x7C, 0xBA, 0xA2, 0x96, 0x06, 0x16, 0xC6, 0x7F, 0x8F, 0x91, 0xF1, 0xB7, 0xEE, 0x8F,
+    0xD5, 0x98, 0x0B, 0xF4, 0xBF, 0x1C, 0x7F, 0x03, 0xBD, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD,
+    0xF6, 0x64, 0xD7, 0x24, 0x96, 0x98, 0x14, 0x1B, 0x09, 0x29, 0x12, 0x6E, 0x52, 0x50, 0x40, 0xA6,
+    0x05, 0x09, 0xDB, 0x03, 0x94, 0x34, 0xAF, 0xD8, 0x90, 0x62, 0x7F, 0x80, 0x02, 0x29, 0x0D, 0x0D,
+    0xD2, 0xF3, 0x7B, 0x26, 0x7C, 0x00, 0xFB, 0x09, 0x29, 0xA8, 0x1E, 0x45, 0x9A, 0x14, 0x41, 0xF2,
+    0xEE, 0x1B, 0x85, 0x1F, 0xF0, 0x12, 0xA5, 0xC6, 0x0D, 0x35, 0x53, 0x0C, 0x92, 0x41, 0xF6, 0x1B,
+    0xCE, 0x1D, 0x7B, 0x95, 0x97, 0xB0, 0x41, 0x54, 0x8C, 0x34, 0x1E, 0x8F, 0x67, 0xE6, 0xDC, 0x73,
+    0xEF, 0x3D, 0x73, 0x4D, 0x44, 0xF4, 0x21, 0x4D, 0x2D, 0xA9, 0xE7, 0x17, 0x37, 0x8F, 0x32, 0x3C,
+    0xAF, 0x53, 0x64, 0xC3, 0x8B, 0xA5, 0x92, 0xE8, 0x1D, 0xA2, 0x94, 0xF7, 0x65, 0x2D, 0x51, 0xCE,
+    0x23, 0xD6, 0x62, 0xEE, 0x3D, 0x26, 0x6F, 0xA3, 0xBF, 0xC5, 0x5B, 0x35, 0xFD, 0x7B, 0xBB, 0x13,
+    0x9E, 0xB1, 0x16, 0x3E, 0xD8, 0x2C, 0x4F, 0xD3, 0x81, 0x47, 0xE1, 0xCD, 0xA1, 0x09, 0x4B, 0x5F,
+    0xD1, 0x7F, 0x6C, 0x37, 0x19, 0x07, 0x3D, 0xA5, 0x99, 0x03, 0x77, 0x0F, 0xFB, 0x09, 0x80, 0xD6,
+    0x9A, 0x9E, 0xD2, 0x5D, 0x36, 0x44, 0xB2, 0xA6, 0x4B, 0x2F, 0x0E, 0xC3, 0x98, 0xCD, 0x00, 0x51,
+    0x3B, 0xBF, 0xBC, 0x7F, 0x05, 0x7A, 0xDC, 0xC1, 0xB7, 0xD8, 0x8A, 0x8E, 0xA2, 0x3F, 0x1F, 0x30,
+    0xE0, 0x0E, 0x1F, 0x0F, 0x16, 0xF3, 0xEA, 0x92, 0xE8, 0x8C, 0x1A, 0x8A, 0x46, 0x18, 0x4D, 0x06,
+    0x84, 0x4D, 0x0E, 0x08, 0x55, 0xF9, 0x14, 0x67, 0x1A, 0x27, 0xBA, 0xC8, 0x39, 0xD1, 0x8A, 0x0B,
+    0x2B, 0x5A, 0xF9, 0xD0, 0x26, 0x46, 0x89, 0x2E, 0x35, 0x4B, 0x4C, 0x6A, 0x97, 0x18, 0xF9, 0x59,
+    0x87, 0x47, 0x6A, 0x52, 0x93, 0x29, 0x70, 0xBB, 0x5B, 0x91, 0xD4, 0x45, 0x0F, 0x52, 0xA5, 0x25,
+    0x45, 0x6B, 0x43, 0x6A, 0xB1, 0xD5, 0x98, 0x9C, 0x23, 0x38, 0x4C, 0x50, 0x70, 0x58, 0x24, 0x07,
+    0x4B, 0xB1, 0xE5, 0x82, 0x1F, 0x0D, 0x3F, 0x8E, 0x2F, 0xA9, 0x2C, 0xE9, 0x63, 0x1A, 0xA8, 0xFC,
+    0xD1, 0x92, 0xE4, 0xA0, 0x4E, 0xDF, 0xE3, 0x53, 0xFA, 0x32, 0x69, 0xA9, 0x41, 0x30, 0xFA, 0xD4,
+    0x90, 0x93, 0x75, 0x64, 0xA5, 0x8E, 0x6D, 0xA6, 0x45, 0xA7, 0x48, 0x74, 0x25, 0x25, 0x6D, 0x41,
+    0xA9, 0xC9, 0x49, 0x9A, 0x8A, 0x54, 0xBD, 0x44, 0xC8, 0x56, 0xF1, 0xEF, 0xBA, 0xF4, 0xDF, 0x3B,
+    0x39, 0x22, 0xB7, 0x3A, 0x6E, 0x27, 0xE3, 0x9C, 0x74, 0x39, 0x5B, 0x3E, 0x0A, 0xAE, 0x03, 0xEF,
+    0x60, 0x5C, 0x44, 0xDE, 0xD7, 0xCA, 0x3B, 0xA6, 0x25, 0x6C, 0x58, 0x16, 0x38, 0xB1, 0xF6, 0x75,
+    0xEA, 0x3D, 0x8D, 0xF7, 0x07, 0x59, 0xA7, 0xAD, 0xA3, 0x2A, 0x23, 0xF1, 0x8B, 0xA5, 0x0A, 0xB6,
+    0x7E, 0xEE, 0xE2, 0x7E, 0xF5, 0x85, 0x4F, 0x70, 0x6E, 0xBB, 0x9B, 0x74, 0x52, 0x06, 0xD7, 0x70,
+    0xEE, 0xF6, 0xEE, 0x91, 0xF4, 0x3D, 0xAD, 0x8F, 0x79, 0x0E, 0xDE, 0x2C, 0xBC, 0x26, 0x80, 0x4A,
+    0xCD, 0x09, 0x8D, 0x71, 0xC8, 0xFB, 0xBE, 0xA0, 0x52, 0x6A, 0xF1, 0xBC, 0x25, 0xE7, 0x68, 0x59,
+    0xD2, 0x1A, 0x58, 0x21, 0x33, 0x0B, 0x4E, 0x90, 0xA6, 0xAD, 0xB7, 0x34, 0x9E, 0x0C, 0x48, 0xCA,
+    0x10, 0xC1, 0x34, 0xB2, 0x51, 0x70, 0x17, 0xDD, 0xCD, 0x4A, 0xB4, 0x4F, 0x86, 0xA4, 0x5D, 0xF5,
+    0xE9, 0x8B, 0x75, 0x27, 0xBD, 0xD7, 0xD2, 0x3F, 0xD6, 0x52, 0x23, 0x09, 0xD0, 0x90, 0x9A, 0x98,
+    0x04, 0x0F, 0xAB, 0x29, 0xBB, 0x53, 0x88, 0xDF, 0x4B, 0x3B, 0x92, 0x99, 0xD7, 0xC9, 0xAF, 0x27,
+    0x36, 0xDE, 0x21, 0xE5, 0x5B, 0xCA, 0x74, 0x49, 0x9C, 0x49, 0x72, 0x60, 0xC9, 0x16, 0x14, 0x62,
+    0x2F, 0x4D, 0x81, 0x90, 0xCA, 0x87, 0xCF, 0x6C, 0x62, 0x7F, 0xEA, 0xE3, 0x9D, 0x1C, 0xE8, 0x2F,
+    0x3F, 0x50, 0xAE, 0x46, 0xEC, 0xBF, 0x6F, 0xC0, 0xDF, 0x61, 0xE7, 0xB5, 0xA0, 0xD0, 0x7C, 0x56,
+    0x60, 0x6A, 0x5E, 0x8A, 0x4D, 0xCD, 0xC6, 0xF3, 0x60, 0x7C, 0x8D, 0xA3, 0x5B, 0xF4, 0xDD, 0xE6,
+    0x07, 0xBE, 0x90, 0xF0, 0x64, 0xBA, 0x67, 0xE8, 0x90, 0x63, 0x88, 0x32, 0x4B, 0x9C, 0x01, 0xA4,
+    0x99, 0xB4, 0x81, 0x20, 0x05, 0xD0, 0x37, 0x7A, 0x12, 0x5A, 0x35, 0x1D, 0x6A, 0xF8, 0xCC, 0x8D,
+    0x8D, 0x23, 0x04, 0x2F, 0xBB, 0xB7, 0x60, 0x5C, 0x35, 0x41, 0xE7, 0x13, 0x72, 0x33, 0x01, 0xF7,
+    0x01, 0x37, 0x7A, 0x65, 0x99, 0xDE, 0xC4, 0x4E, 0xEC, 0xB1, 0xBB, 0xFD, 0xDB, 0x02, 0x5B, 0x3A,
+    0xF4, 0xF6, 0x1F, 0xEC, 0x8A, 0xAB, 0xD8, 0x6D, 0x36, 0xD0, 0x9D, 0xC9, 0x36, 0x8F, 0x40, 0x8F,
+    0xC1, 0x7A, 0xB6, 0x05, 0x7D, 0x01, 0xC1, 0x88, 0xCB, 0x39, 0x43, 0x60, 0x9D, 0x8D, 0xB8, 0x3D,
+    0x1E, 0xE3, 0xBD, 0x63, 0x5E, 0xBF, 0x32, 0x4A, 0x2F, 0x34, 0xA5, 0xD8, 0x12, 0xF2, 0x5D, 0x2B,
+    0x23, 0x75, 0xD2, 0x41, 0x8E, 0x56, 0x61, 0x57, 0x89, 0x13, 0x05, 0x7A, 0x85, 0xBE, 0xC4, 0xBC,
+    0x99, 0x3C, 0x40, 0x4F, 0xDB, 0xC9, 0xFD, 0x52, 0x1F, 0x21, 0xE7, 0x25, 0x2B, 0x9C, 0xAF, 0xD5,
+    0xE2, 0x92, 0x67, 0xFB, 0x1A, 0x4F, 0xCA, 0x58, 0xF2, 0x83, 0xB0, 0xEB, 0xBA, 0x17, 0x36, 0x67,
+    0xC5, 0xCB, 0xCF, 0x8D, 0x78, 0xDE, 0xB1, 0x48, 0xAB, 0xE0, 0x35, 0xE0, 0x92, 0x0E, 0xE0, 0xD7,
+    0x53, 0x27, 0x80, 0xB7, 0xED, 0xE6, 0xAC, 0x83, 0x64, 0x83, 0x08, 0xA1, 0x56, 0x38, 0xB8, 0x96,
+    0x18, 0x98, 0xE6, 0x52, 0xA1, 0x34, 0xD0, 0x65, 0x7D, 0xCE, 0x35, 0x4D, 0x7E, 0xC2, 0xA2, 0x69,
+    0xB2, 0x84, 0xCF, 0x14, 0x8A, 0x89, 0x91, 0x52, 0x65, 0x28, 0xD2, 0xE7, 0xA1, 0x74, 0x4A, 0x1F,
+    0xCA, 0x5B, 0x59, 0x85, 0xE2, 0x3D, 0x34, 0xFC, 0x51, 0xB8, 0x9E, 0x03, 0x9C, 0xB6, 0x3D, 0xEF,
+    0x54, 0xB5, 0xCB, 0x90, 0x82, 0x15, 0x2A, 0x80, 0xA1, 0xA8, 0x8F, 0x2D, 0xA4, 0x9B, 0xA0, 0xB4,
+    0x89, 0x3F, 0xC0, 0x4C, 0xB4, 0x91, 0xAF, 0x4B, 0xCE, 0xBB, 0xD7, 0xFB, 0xE5, 0x51, 0x4D, 0x43,
+    0x31, 0x0D, 0xF9, 0x2B, 0xC3, 0x11, 0xC5, 0x23, 0xDD, 0xA0, 0xD4, 0xC9, 0x1D, 0x2D, 0x63, 0x6F,
+    0x6E, 0x8D, 0xB1, 0x55, 0x17, 0x30, 0x2E, 0xBF, 0xED, 0x39, 0x05, 0xB9, 0x0C, 0xFA, 0xB4, 0xCC,
+    0x21, 0x4B, 0x9E, 0x31, 0xBF, 0xAD, 0xE7, 0x20, 0xE2, 0x1A, 0x73, 0x1D, 0x95, 0xDF, 0x5D, 0x30,
+    0xD9, 0x4A, 0x72, 0x96, 0x84, 0x5D, 0xB2, 0x40, 0xD4, 0xA7, 0xA8, 0x49, 0x14, 0x0F, 0x52, 0x9F,
+    0xF1, 0xDF, 0x20, 0x27, 0x6F, 0xB3, 0x1E, 0xE2, 0xF3, 0xE6, 0xDA, 0x1E, 0x8F, 0xE9, 0x07, 0x95,
+    0x98, 0x7D, 0xA6, 0x93, 0xC0, 0xA3, 0xB9, 0x36, 0x73, 0xB2, 0xB6, 0x08, 0xF2, 0x47, 0x87, 0x1C,
+    0x88, 0xF3, 0xD7, 0x24, 0x87, 0x6F, 0x09, 0x0A, 0x35, 0xF6, 0x94, 0x23, 0xD1, 0xAD, 0x07, 0xF5,
+    0xA4, 0x16, 0x4E, 0x66, 0x64, 0x5F, 0x2A, 0x39, 0xED, 0xBE, 0x46, 0x29, 0x5E, 0x43, 0x81, 0x5C,
+    0xE1, 0xE8, 0x03, 0x9C, 0x7C, 0x77, 0xFE, 0x2D, 0xC2, 0x68, 0xB4, 0x02, 0x0A, 0x6B, 0x0E, 0xB4,
+    0xA3, 0xED, 0x29, 0x9C, 0xA2, 0x6F, 0x4E, 0xBA, 0x00, 0xAE, 0xC2, 0x7D, 0xCC, 0x0C, 0x7E, 0x6F,
+    0x11, 0x6E, 0x00, 0xDB, 0x87, 0x56, 0x42, 0x35, 0xBB, 0x43, 0x67, 0xD2, 0xEF, 0x22, 0x0F, 0xBB,
+    0x4F, 0x02, 0x5C, 0x12, 0x16, 0x0E, 0x5C, 0xC0, 0x5A, 0xD0, 0xFF, 0xDC, 0xFE, 0x06, 0xA5, 0x55,
+    0x31, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0xF6, 0xE8, 0x64, 0x94, 0x2D, 0x86, 0x22, 0x57, 0x40, 0xA4,
+    0xB8, 0xA5, 0xC2, 0x7F, 0x20, 0xBB, 0xE3, 0x23, 0x7F, 0xE0, 0x90, 0xEE, 0x94, 0xF2, 0x6A, 0x68,
+    0x68, 0x53, 0xF8, 0x6E, 0x2D, 0x90, 0xA0, 0xA0, 0x08, 0x3F, 0x81, 0x82, 0x22, 0x5A, 0x5A, 0x0A,
+    0x24, 0x7C, 0xB7, 0x56, 0x52, 0xA4, 0xC4, 0x22, 0x39, 0x5D, 0x41, 0x11, 0xC3, 0x15, 0x94, 0x19,
+    0x12, 0x47, 0xEC, 0x72, 0xDE, 0x1B, 0xBE, 0xEF, 0xD9, 0x97, 0x13, 0x11, 0x1D, 0x96, 0xC7, 0x1A,
+    0x8F, 0xDF, 0xBC, 0xF7, 0x7D, 0xDF, 0x7B, 0xF3, 0x2C, 0x85, 0x24, 0x6D, 0xEC, 0xE5, 0x48, 0x6C,
+    0x9D, 0xB4, 0x32, 0xC3, 0x24, 0xEA, 0x12, 0x2F, 0x93, 0x7A, 0x2E, 0x92, 0x61, 0x22, 0x2B, 0x27,
+    0x62, 0x9E, 0x62, 0x92, 0x62, 0x45, 0x96, 0x98, 0x98, 0xBF, 0x1A, 0x11, 0xFB, 0xA0, 0x16, 0x99,
+    0xA6, 0xA5, 0x44, 0x3E, 0x13, 0x98, 0xC3, 0xCA, 0xC9, 0x21, 0xCC, 0xA5, 0x97, 0xA4, 0x91, 0x75,
+    0x9E, 0x4A, 0x1C, 0xA4, 0x12, 0xD3, 0x63, 0x97, 0x69, 0xF1, 0xB0, 0x39, 0x1E, 0x77, 0x30, 0x22,
+    0xF8, 0xC0, 0x0E, 0x3C, 0xB6, 0x31, 0xBE, 0x93, 0x87, 0xD2, 0xC5, 0x3E, 0xF2, 0x93, 0x3A, 0x86,
+    0x2B, 0xE3, 0xB1, 0xE7, 0x77, 0x2F, 0xE6, 0xD7, 0x5A, 0x92, 0x00, 0x3B, 0x0C, 0xFB, 0x73, 0x29,
+    0xF6, 0xEB, 0x5A, 0xEC, 0x5D, 0x2F, 0x69, 0xB4, 0x92, 0x4C, 0x8E, 0x81, 0xD4, 0xF9, 0xA9, 0xA4,
+    0x70, 0x6C, 0x9A, 0x61, 0x24, 0xF5, 0xE0, 0xD5, 0x96, 0x22, 0x5B, 0x22, 0xD7, 0xC4, 0xCA, 0x37,
+    0xC4, 0x7E, 0x6A, 0x65, 0xF2, 0xF8, 0x12, 0xC4, 0x2C, 0xF6, 0xAD, 0xE6, 0x6F, 0x88, 0x01, 0xD9,
+    0x12, 0x38, 0xCD, 0x85, 0xBF, 0x22, 0x96, 0x91, 0xD8, 0x12, 0x0E, 0x1F, 0x23, 0xBE, 0xB3, 0xD7,
+    0xC4, 0x56, 0x02, 0x62, 0x1D, 0x89, 0x79, 0x62, 0xFF, 0x44, 0xBA, 0x8F, 0x57, 0xD1, 0x9F, 0x67,
+    0x6D, 0xFC, 0xF2, 0x45, 0x6E, 0x5E, 0x6D, 0xC4, 0x9C, 0x77, 0xC0, 0xDE, 0x48, 0xF2, 0x22, 0x1F,
+    0xB0, 0x3F, 0x28, 0xD5, 0xA5, 0x3D, 0x00, 0xF6, 0x0F, 0x81, 0xFD, 0x4E, 0x25, 0xB3, 0x0F, 0x9C,
+    0x00, 0x7B, 0x79, 0x8D, 0xF1, 0xE0, 0x59, 0xD2, 0x9A, 0xE0, 0x8F, 0x24, 0x0D, 0x4F, 0x80, 0xB1,
+    0x3E, 0xA2, 0xF8, 0xC4, 0x88, 0x89, 0x39, 0xC3, 0x24, 0x3D, 0xBA, 0x12, 0xFF, 0xE2, 0xBF, 0xC5,
+    0x9F, 0x41, 0x93, 0x11, 0x63, 0xF4, 0x2F, 0x8C, 0xBC, 0x60, 0x04, 0x03, 0x89, 0x97, 0x0F, 0xA1,
+    0x69, 0x2F, 0xD1, 0xF1, 0x9E, 0xE0, 0x2B, 0xED, 0xA9, 0x7D, 0x07, 0xED, 0x1B, 0x68, 0x9F, 0x1B,
+    0x7F, 0x0C, 0xED, 0xDF, 0xC2, 0xAF, 0xDA, 0x37, 0x6F, 0x6B, 0xAF, 0xF8, 0x5D, 0x90, 0x68, 0x85,
+    0x47, 0xE2, 0xB7, 0xE7, 0x92, 0xD6, 0xBA, 0x8E, 0x0F, 0x50, 0xB2, 0x60, 0xE4, 0xCA, 0x02, 0x65,
+    0xEF, 0x18, 0x87, 0x45, 0x40, 0x71, 0xA3, 0x80, 0xA5, 0x98, 0xF5, 0x63, 0xCE, 0x49, 0xA6, 0x5D,
+    0x21, 0x6F, 0xCD, 0x31, 0x93, 0xE7, 0x48, 0x04, 0x94, 0x6C, 0x89, 0x24, 0x5A, 0x60, 0x91, 0x34,
+    0x8F, 0x3A, 0x42, 0xEF, 0xE5, 0xD3, 0x85, 0xBC, 0xFF, 0x59, 0xA8, 0xD3, 0x2F, 0xBF, 0x6F, 0x61,
+    0xD1, 0x51, 0x39, 0x8C, 0x8C, 0xD6, 0xCF, 0x4B, 0x31, 0x01, 0x19, 0xA7, 0x2C, 0x45, 0xCF, 0xD4,
+    0x62, 0xF1, 0x73, 0x70, 0x68, 0x1C, 0x12, 0x8E, 0xC2, 0x2B, 0x00, 0x38, 0x43, 0x75, 0x63, 0x22,
+    0x3F, 0x42, 0x6C, 0xD3, 0xD2, 0x22, 0x87, 0x1C, 0x87, 0x70, 0x1F, 0xA3, 0xEC, 0x10, 0x37, 0xA3,
+    0x3E, 0xC0, 0xD2, 0xA1, 0x90, 0x92, 0x3A, 0x0D, 0x21, 0xC8, 0x32, 0x84, 0xDE, 0xBC, 0xDE, 0xBF,
+    0x37, 0x98, 0x4F, 0xE1, 0x1D, 0x75, 0xAB, 0xE6, 0xB6, 0x74, 0x83, 0x39, 0x4E, 0x0A, 0xCC, 0x9F,
+    0xA5, 0x88, 0xDA, 0x41, 0x4E, 0x72, 0x53, 0xA9, 0xE9, 0x49, 0x4B, 0x72, 0xA8, 0xF9, 0x82, 0x35,
+    0xBF, 0xCB, 0x6A, 0xB9, 0x01, 0x3F, 0xA6, 0x49, 0x85, 0xC5, 0x2E, 0x15, 0xC0, 0x38, 0x98, 0xDA,
+    0x72, 0x06, 0x0D, 0x10, 0xD3, 0x4F, 0x18, 0xD2, 0xAB, 0x6B, 0x5B, 0x4E, 0xB9, 0x38, 0x04, 0xAC,
+    0x40, 0xC3, 0xF9, 0x4E, 0x2C, 0xFD, 0x02, 0x09, 0xD2, 0x3B, 0x94, 0xBA, 0x9E, 0x2B, 0x2E, 0xDE,
+    0xD4, 0x28, 0xCB, 0x0D, 0xB3, 0x1A, 0x36, 0x5C, 0x5A, 0xEF, 0x49, 0xC7, 0x93, 0xA6, 0x1C, 0x79,
+    0x9B, 0xE1, 0xD9, 0xEA, 0xDD, 0x88, 0x12, 0x45, 0x35, 0x04, 0xA0, 0x46, 0x5C, 0x48, 0x68, 0x4F,
+    0xF7, 0x0F, 0x28, 0x3F, 0x74, 0x27, 0xEE, 0x54, 0xC3, 0x64, 0x7A, 0xCF, 0xF4, 0x9E, 0xEA, 0xF3,
+    0x50, 0xEF, 0x4A, 0x03, 0x56, 0x7A, 0xAF, 0xF4, 0x14, 0xDF, 0x58, 0x7C, 0x83, 0x5D, 0x61, 0x83,
+    0x98, 0xE9, 0xA2, 0xCC, 0xC6, 0xA8, 0xAA, 0xD4, 0x10, 0x14, 0xBB, 0xE6, 0x63, 0xB4, 0x9E, 0x49,
+    0xB5, 0x1A, 0x8C, 0xA2, 0x33, 0x62, 0x3A, 0x6E, 0xC8, 0xAE, 0x36, 0x34, 0xCA, 0x14, 0x3B, 0x3A,
+    0x51, 0x80, 0x50, 0x72, 0xB3, 0x7F, 0xCF, 0xEB, 0xF9, 0x86, 0x11, 0x78, 0x91, 0x7D, 0xA6, 0xB0,
+    0xB0, 0x0F, 0x99, 0x20, 0xBA, 0x4A, 0x85, 0x67, 0xE1, 0x21, 0xDC, 0x7A, 0x97, 0x2A, 0x59, 0x78,
+    0x40, 0xCD, 0x87, 0xD0, 0xEA, 0xCE, 0x79, 0xDE, 0x51, 0x8B, 0x3E, 0xA5, 0xFD, 0xE4, 0x17, 0xDD,
+    0x39, 0x73, 0xA4, 0x63, 0xCE, 0x79, 0xF4, 0x64, 0x76, 0x48, 0x74, 0xE6, 0x0F, 0x26, 0x5A, 0x66,
+    0x15, 0x23, 0xD1, 0xB9, 0x70, 0x95, 0x17, 0x9D, 0x23, 0x4A, 0xA7, 0x2F, 0x27, 0xC2, 0x66, 0x33,
+    0xAF, 0x15, 0x2A, 0x4F, 0x5B, 0x12, 0xF4, 0x43, 0xC4, 0xC4, 0x2F, 0x16, 0x0B, 0x98, 0x23, 0xB1,
+    0x12, 0xFD, 0xBD, 0x38, 0x21, 0x58, 0x60, 0x03, 0xD6, 0x42, 0x43, 0xD7, 0x7C, 0xE3, 0x59, 0x81,
+    0x09, 0x6B, 0x1E, 0x14, 0x7B, 0x49, 0x77, 0x7A, 0x5B, 0xC6, 0x3E, 0x69, 0x3B, 0x9E, 0xA6, 0x14,
+    0x1C, 0xE3, 0x97, 0x1E, 0x5C, 0x32, 0xD4, 0x48, 0x1D, 0xBF, 0x6A, 0x40, 0xD0, 0xC9, 0x55, 0x47,
+    0x25, 0xC7, 0x11, 0x4F, 0x0C, 0x1D, 0xA3, 0x9D, 0xC0, 0x02, 0x64, 0x19, 0x46, 0x61, 0x40, 0x3C,
+    0x5E, 0x19, 0x7B, 0x1E, 0x60, 0xD8, 0xF5, 0x96, 0x98, 0x95, 0xC2, 0xBE, 0xD5, 0xA2, 0xE1, 0x87,
+    0x47, 0x3E, 0xDA, 0x9C, 0x38, 0x71, 0x68, 0xE9, 0x49, 0xE3, 0x2A, 0xE9, 0xCD, 0x45, 0x8D, 0xF2,
+    0xEE, 0x71, 0x72, 0x70, 0xDC, 0xF2, 0x19, 0x26, 0x93, 0xE7, 0x98, 0xF4, 0x55, 0xD4, 0xA5, 0x5F,
+    0xB5, 0xF6, 0x0B, 0xEF, 0xF2, 0xBE, 0x8F, 0x2E, 0x27, 0x21, 0x47, 0xE9, 0xFC, 0x96, 0x23, 0x31,
+    0x38, 0x06, 0x1F, 0x31, 0x39, 0xB8, 0x6E, 0xC1, 0x35, 0xDE, 0xCD, 0xFA, 0x5D, 0x80, 0x8A, 0xF2,
+    0x34, 0x77, 0xDE, 0x61, 0x61, 0x8A, 0x9E, 0x5E, 0x98, 0xB6, 0xA8, 0x92, 0xBA, 0xA8, 0x26, 0x75,
+    0x85, 0xB1, 0x2A, 0x26, 0x8F, 0xFC, 0x2C, 0x39, 0x6B, 0xDC, 0xDD, 0x50, 0x42, 0xA1, 0xDD, 0x98,
+    0x2A, 0xDD, 0x9C, 0xB4, 0x03, 0xDE, 0xF9, 0x65, 0x8E, 0x7C, 0xF9, 0xF8, 0x72, 0xE7, 0x7E, 0x0C,
+    0x85, 0xA2, 0x7E, 0x14, 0x9F, 0x4D, 0x90, 0xF4, 0xD9, 0xE2, 0x99, 0x93, 0xD8, 0x8F, 0x1F, 0xDC,
+    0xA8, 0x83, 0x36, 0x3C, 0x76, 0x36, 0xB4, 0x86, 0x21, 0x45, 0xF3, 0xF2, 0x3D, 0x96, 0x4F, 0x89,
+    0xF4, 0x60, 0xC3, 0x0F, 0x58, 0xB9, 0x4D, 0xF9, 0xEA, 0xE1, 0x37, 0xB4, 0xC5, 0xFE, 0x43, 0x41,
+    0x76, 0x19, 0x76, 0xB2, 0xA6, 0x7A, 0xEE, 0xF4, 0xDB, 0x4C, 0x4B, 0x93, 0x19, 0x6A, 0x99, 0x7E,
+    0x26, 0x4C, 0xFB, 0xAC, 0x06, 0x84, 0xE8, 0xB6, 0x79, 0x07, 0xF8, 0x98, 0x37, 0xB9, 0x8F, 0xB7,
+    0xC1, 0x9F, 0xA7, 0x37, 0xFE, 0xEE, 0xE0, 0xCB, 0xA1, 0xC6, 0x39, 0xB6, 0x0F, 0x4E, 0xF7, 0x14,
+    0x18, 0x11, 0xA3, 0xCA, 0xB5, 0x3D, 0x8C, 0xDD, 0x58, 0xC7, 0xE1, 0x88, 0xB7, 0x1F, 0x0F, 0x72,
+    0x37, 0xE0, 0x62, 0x1C, 0x72, 0x31, 0xAF, 0x31, 0x90, 0xBC, 0xE4, 0x72, 0x3C, 0xF9, 0x85, 0x5C,
+    0x75, 0x6E, 0xB5, 0x1D, 0x70, 0xFF, 0x8F, 0xEB, 0x1F, 0xC5, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x18,
+    0x7D, 0x6B, 0xC3, 0xB9, 0x70, 0x31, 0x55, 0x24, 0x14, 0x09, 0x4D, 0x9F, 0x02, 0xFF, 0x81, 0x5D,
+    0x7B, 0x52, 0x51, 0xD0, 0x5C, 0x93, 0x06, 0x0A, 0x5A, 0x44, 0x73, 0x6D, 0x0A, 0x1B, 0x1B, 0x51,
+    0x5E, 0x01, 0x88, 0x1F, 0x40, 0xE8, 0xC8, 0x36, 0xD7, 0x50, 0x21, 0xDF, 0xAD, 0x75, 0x29, 0x28,
+    0xB1, 0x84, 0xE8, 0xAD, 0x04, 0xAA, 0x14, 0x18, 0xC9, 0xE8, 0x06, 0x9D, 0x77, 0x87, 0xF7, 0xCD,
+    0x38, 0x4B, 0x42, 0x91, 0x2A, 0x12, 0x96, 0x66, 0x64, 0xEF, 0x37, 0xF3, 0xE6, 0x7D, 0xEF, 0x7B,
+    0xF3, 0x2D, 0x1E, 0x65, 0x4D, 0x3A, 0x60, 0x5D, 0xCF, 0xDA, 0x41, 0x57, 0x67, 0x1F, 0x7F, 0x34,
+    0xA4, 0x36, 0x3E, 0x60, 0x8E, 0x2C, 0x1C, 0x32, 0xCC, 0x28, 0xA0, 0xBA, 0x1C, 0xAA, 0x89, 0x07,
+    0x6D, 0x92, 0x1E, 0x53, 0xDA, 0x45, 0x23, 0xCA, 0x78, 0x44, 0xCB, 0xB0, 0x85, 0x84, 0x36, 0x50,
+    0x26, 0xEE, 0x35, 0x92, 0x6E, 0x15, 0xC2, 0x55, 0x3C, 0x70, 0xA7, 0x9E, 0x26, 0x86, 0xA3, 0x19,
+    0xF2, 0x64, 0x7E, 0x56, 0x8D, 0xCC, 0x8C, 0xF2, 0x59, 0x4D, 0xFE, 0xA7, 0xD2, 0xCF, 0x77, 0xB0,
+    0x01, 0xDA, 0x1C, 0x2B, 0x9B, 0x21, 0x1E, 0x35, 0xD2, 0x5E, 0x19, 0xD5, 0xA8, 0xA6, 0x40, 0xDA,
+    0xB5, 0x04, 0xB6, 0x88, 0x7F, 0x19, 0x11, 0x3F, 0xEF, 0x10, 0x39, 0x83, 0x95, 0xE3, 0x16, 0xC1,
+    0xB5, 0x1C, 0x84, 0x59, 0x8D, 0x00, 0x8F, 0xF5, 0xC0, 0x32, 0xC8, 0x93, 0xFB, 0x80, 0x4F, 0x10,
+    0x7D, 0x37, 0x42, 0xBF, 0xDF, 0x61, 0x56, 0x26, 0xE9, 0x36, 0xA4, 0x63, 0xA3, 0x31, 0x1E, 0x54,
+    0x23, 0xA8, 0x19, 0x97, 0x95, 0x05, 0xF0, 0x27, 0x81, 0x7F, 0x6E, 0xA0, 0x5A, 0xA0, 0xE0, 0xE6,
+    0x1D, 0xB1, 0xA6, 0xB0, 0xBF, 0x08, 0x47, 0xC4, 0x84, 0xD3, 0x7C, 0x6D, 0x17, 0xEA, 0xCA, 0x20,
+    0xE3, 0x8B, 0x6E, 0x5A, 0x6A, 0x23, 0x5C, 0xE3, 0x9E, 0x9F, 0x96, 0x9A, 0x64, 0x64, 0x21, 0x64,
+    0x31, 0x91, 0x5D, 0xCE, 0xF5, 0xE9, 0x1E, 0x81, 0x6D, 0x11, 0xB2, 0x8F, 0x9D, 0xEB, 0x57, 0xCE,
+    0x8D, 0x1E, 0x8C, 0x74, 0x82, 0x24, 0xC2, 0x57, 0xF8, 0xE3, 0xA4, 0xC1, 0x3D, 0x26, 0xA3, 0x4D,
+    0x49, 0x64, 0xA1, 0x1C, 0x90, 0x19, 0x23, 0x73, 0x2F, 0x45, 0x34, 0x56, 0xF0, 0xAC, 0x35, 0x19,
+    0x09, 0x6D, 0xDC, 0x76, 0x81, 0x77, 0x3A, 0x06, 0xE2, 0x85, 0xB3, 0xD0, 0x6E, 0x1F, 0x90, 0x85,
+    0xBA, 0xA8, 0x73, 0x3C, 0x4E, 0x12, 0xA9, 0x24, 0x03, 0x2B, 0x35, 0x15, 0xB6, 0x4C, 0x94, 0xC5,
+    0x33, 0x44, 0xCE, 0x65, 0xAD, 0x48, 0x7A, 0x2B, 0x3B, 0x76, 0x9D, 0xD0, 0x36, 0x9C, 0x6A, 0xD9,
+    0x47, 0xD9, 0xBD, 0xFE, 0x48, 0x7F, 0xE2, 0x94, 0x09, 0x70, 0x25, 0x9C, 0x2D, 0xE1, 0x89, 0x23,
+    0xEC, 0x70, 0x69, 0x88, 0x53, 0xF7, 0xC4, 0x29, 0x64, 0xB3, 0x48, 0x18, 0x4A, 0xAE, 0x4C, 0x38,
+    0x79, 0x99, 0xEE, 0x00, 0xDF, 0xE3, 0x2E, 0xDF, 0x35, 0x6D, 0xA5, 0x3A, 0xB4, 0x1C, 0xEA, 0x03,
+    0xD6, 0xF6, 0x86, 0xA8, 0x05, 0x87, 0x92, 0x42, 0x32, 0x97, 0x98, 0xD2, 0x45, 0x37, 0x0C, 0x90,
+    0xD6, 0x6A, 0xD2, 0xB4, 0x87, 0x77, 0xD6, 0xAE, 0x9B, 0xFD, 0x12, 0xA9, 0x3D, 0xD6, 0x0B, 0xAA,
+    0x9C, 0xE6, 0xCB, 0x73, 0x4A, 0x09, 0xDC, 0x9C, 0x7E, 0xE9, 0x9C, 0x8B, 0x9F, 0x6E, 0x0F, 0xDB,
+    0xFB, 0x93, 0xA8, 0xDF, 0x0A, 0x93, 0x4C, 0xA4, 0x56, 0x0D, 0x79, 0x93, 0x7F, 0x2B, 0x16, 0xCC,
+    0x7D, 0xC4, 0x70, 0xC5, 0x4B, 0x91, 0x59, 0x34, 0x7B, 0x29, 0xD2, 0x85, 0x48, 0xB2, 0x44, 0x8A,
+    0x07, 0x0F, 0xF6, 0x46, 0x13, 0x7E, 0x4C, 0x38, 0x79, 0x7F, 0x7B, 0x69, 0x7D, 0x96, 0x22, 0x4C,
+    0x90, 0xDC, 0x6B, 0xCE, 0x5C, 0xEF, 0x6D, 0xB7, 0x27, 0xE7, 0x5C, 0xDC, 0x7E, 0x7A, 0xF5, 0x58,
+    0x9C, 0x47, 0xAD, 0x48, 0x9F, 0xF6, 0xE6, 0xAA, 0x89, 0x94, 0x34, 0x69, 0x13, 0x5D, 0xDC, 0xC9,
+    0x82, 0x4B, 0x7E, 0x1B, 0x64, 0xAC, 0x7C, 0xC2, 0xDB, 0x15, 0xFD, 0xD1, 0xC4, 0xCE, 0xBA, 0x46,
+    0xED, 0x93, 0x09, 0x6F, 0xD1, 0x18, 0x8B, 0x51, 0xB2, 0x17, 0xD7, 0x68, 0x23, 0xA7, 0x99, 0xB4,
+    0xC1, 0x7B, 0x4C, 0x2F, 0x27, 0x83, 0x0D, 0xB5, 0x28, 0x19, 0x6E, 0x99, 0xF3, 0x4C, 0x5A, 0xB6,
+    0x62, 0x9A, 0x25, 0x19, 0x89, 0x77, 0x2E, 0x91, 0x0C, 0xC5, 0xD6, 0xF5, 0x19, 0x6D, 0x18, 0xFD,
+    0x48, 0xC5, 0x69, 0xB3, 0x50, 0x22, 0xE1, 0x2E, 0x2A, 0x66, 0xA7, 0xAC, 0xC0, 0x18, 0xC6, 0x8B,
+    0xEB, 0x24, 0x29, 0x25, 0x5D, 0x50, 0xF8, 0x6D, 0x73, 0x17, 0xD1, 0x37, 0x03, 0xCA, 0x9C, 0x46,
+    0xA0, 0x1E, 0x94, 0xE8, 0xBC, 0x8B, 0xA6, 0x16, 0x75, 0xDA, 0xE9, 0xB1, 0xBE, 0x38, 0xC4, 0xEE,
+    0xD9, 0x70, 0xF2, 0x55, 0x15, 0x56, 0xCF, 0x01, 0xDC, 0x35, 0x6C, 0x06, 0x1E, 0x5F, 0xC8, 0x17,
+    0x01, 0xB5, 0x7A, 0x2D, 0xF1, 0x95, 0xB1, 0x9B, 0xE4, 0xF3, 0xA9, 0x4C, 0xEF, 0x8F, 0xAD, 0xA2,
+    0xE9, 0x15, 0x89, 0x5F, 0x2C, 0xC4, 0xAF, 0x48, 0x7C, 0xAD, 0x64, 0x34, 0x78, 0xC8, 0x9D, 0x3F,
+    0xE8, 0x45, 0x91, 0xC2, 0x57, 0xE2, 0x55, 0x82, 0xE5, 0x3B, 0xEA, 0xFC, 0xFA, 0x7A, 0x9A, 0xD7,
+    0x75, 0xFA, 0xE4, 0xDB, 0xB1, 0xDE, 0x5D, 0x45, 0x42, 0x90, 0xB7, 0x48, 0x91, 0xE0, 0x30, 0xE3,
+    0x5D, 0x21, 0x28, 0xE4, 0x8C, 0x6F, 0x45, 0xED, 0xBF, 0x9D, 0x45, 0x1A, 0x54, 0x74, 0xEC, 0x2C,
+    0x1F, 0x9A, 0xF8, 0xB9, 0x9B, 0x12, 0x77, 0x3B, 0xA7, 0xBF, 0xE1, 0x33, 0x9E, 0x9E, 0xBF, 0x5E,
+    0xF0, 0xC8, 0x0B, 0x7E, 0xEC, 0x7D, 0xF9, 0x32, 0xAA, 0xA5, 0xE5, 0xC9, 0x39, 0x36, 0xEB, 0xF1,
+    0x97, 0xB3, 0xAB, 0x9B, 0x5F, 0xE7, 0xE8, 0xC0, 0x9E, 0x3A, 0xFB, 0xBE, 0x5A, 0x52, 0x9C, 0x96,
+    0x56, 0xB3, 0xE2, 0x14, 0xC5, 0x96, 0x2A, 0xDE, 0x53, 0x26, 0x1A, 0xC5, 0x27, 0xEC, 0x8E, 0xBD,
+    0xD8, 0x64, 0x13, 0x2E, 0x97, 0x7F, 0x34, 0xE5, 0xE5, 0xC4, 0xAB, 0x92, 0xFE, 0x4D, 0xCF, 0xB0,
+    0xE1, 0x92, 0x5D, 0xED, 0xDD, 0xDB, 0x21, 0xBD, 0xFE, 0x9A, 0x69, 0xCC, 0x6B, 0x92, 0x2B, 0xBE,
+    0x78, 0x32, 0xE0, 0x6C, 0x2C, 0xDC, 0x85, 0xB3, 0x11, 0x8D, 0xCB, 0x2B, 0x75, 0x78, 0x6C, 0x82,
+    0x05, 0x42, 0xD2, 0xCB, 0xAB, 0xF7, 0xAD, 0xF4, 0xA4, 0xA0, 0x28, 0x97, 0xE1, 0x8C, 0xE0, 0xBE,
+    0x6D, 0x69, 0x67, 0xBD, 0xE3, 0xE4, 0xF7, 0xB3, 0x81, 0xDD, 0x98, 0xA7, 0xFD, 0x7E, 0x89, 0xCC,
+    0xE4, 0x0F, 0x73, 0xE4, 0xF4, 0x41, 0x65, 0xED, 0x89, 0xDD, 0x39, 0x37, 0x14, 0xEE, 0x70, 0x94,
+    0x4F, 0x86, 0xEF, 0xF7, 0x7B, 0x3C, 0x42, 0xED, 0x86, 0xC0, 0xF9, 0x14, 0xFF, 0x63, 0x0A, 0xBE,
+    0x2F, 0x85, 0x7B, 0xEA, 0xFF, 0x9B, 0xE2, 0xF1, 0x78, 0x8F, 0xDF, 0x48, 0x76, 0x82, 0xE7, 0x2F,
+    0xCE, 0x2B, 0x97, 0x47, 0xDA, 0xB3, 0x0F, 0x57, 0xFE, 0x58, 0xE9, 0xBD, 0x83, 0xB7, 0x5F, 0xE9,
+    0xBF, 0xD5, 0x7F, 0xBF, 0x1B, 0xC1, 0x10, 0xEC, 0xD6, 0x7F, 0xEF, 0x2C, 0xF1, 0xF1, 0x06, 0x9F,
+    0x7F, 0x00, 0xB5, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0x9E, 0xD1, 0xAE, 0xA5, 0xB8, 0x98,
+    0x26, 0x69, 0x42, 0x61, 0x8A, 0x14, 0x34, 0x79, 0xFE, 0x81, 0xF5, 0xB3, 0x81, 0x22, 0x05, 0x05,
+    0x5B, 0x80, 0x28, 0xF7, 0x13, 0xF2, 0x03, 0x7E, 0xBB, 0x5E, 0x52, 0x50, 0x92, 0x8E, 0x36, 0x45,
+    0x0A, 0x08, 0x05, 0xED, 0x2A, 0xF2, 0xF2, 0x4C, 0x52, 0xA6, 0xC8, 0x88, 0x44, 0x34, 0x14, 0x18,
+    0x10, 0x15, 0x42, 0x3B, 0xA0, 0x59, 0xAD, 0x05, 0x7E, 0x6F, 0x38, 0x67, 0x9C, 0x0D, 0x28, 0xD0,
+    0x21, 0x9E, 0x9F, 0x67, 0x3C, 0xF6, 0xCC, 0x3D, 0xE7, 0x9E, 0x7B, 0xE7, 0x8E, 0x88, 0xDC, 0x14,
+    0x2F, 0xF8, 0x15, 0xCA, 0xB1, 0x33, 0x67, 0x96, 0x5D, 0xBA, 0xAD, 0xE5, 0x95, 0x5F, 0xD6, 0xAA,
+    0x41, 0x0E, 0x25, 0xED, 0xF5, 0x20, 0x93, 0x68, 0x8B, 0xCB, 0x89, 0x72, 0xA9, 0x35, 0xBD, 0x88,
+    0x4F, 0xFB, 0x02, 0x2B, 0xBA, 0xAC, 0x3F, 0xC5, 0xD4, 0xC6, 0x1C, 0x8F, 0xE8, 0x96, 0xE6, 0xD6,
+    0x80, 0x2E, 0xCF, 0xDF, 0xED, 0x69, 0x39, 0x84, 0x88, 0x13, 0x36, 0xEC, 0x0E, 0x0F, 0x0F, 0xD1,
+    0x26, 0x63, 0x59, 0xA0, 0xD3, 0xAE, 0x31, 0x2D, 0x66, 0xF4, 0x58, 0x2F, 0x52, 0xD5, 0x63, 0x0A,
+    0x12, 0xA7, 0x32, 0x12, 0x60, 0x14, 0x9F, 0x38, 0x49, 0x07, 0x34, 0xA3, 0xE4, 0x3D, 0x58, 0x76,
+    0x52, 0x09, 0x38, 0xAC, 0x68, 0xE6, 0xDE, 0x6E, 0xCB, 0xF5, 0x76, 0x11, 0x19, 0x7E, 0x33, 0xBB,
+    0x10, 0x71, 0x24, 0xF9, 0xCB, 0x83, 0xFC, 0xAE, 0xDC, 0x97, 0xDB, 0xED, 0xD1, 0xA0, 0x6D, 0xB6,
+    0x95, 0x03, 0x6B, 0x64, 0xBB, 0x2F, 0xA6, 0x6D, 0x08, 0x03, 0xBF, 0x97, 0x98, 0xD2, 0x99, 0x63,
+    0x2C, 0x56, 0xAE, 0x24, 0x83, 0x2C, 0x84, 0x2D, 0xDE, 0x55, 0x21, 0x50, 0x9A, 0xB1, 0x4A, 0xF1,
+    0x2E, 0xED, 0xC7, 0x9C, 0xEF, 0xB4, 0x6D, 0x60, 0xDB, 0xE7, 0x54, 0x2D, 0x6F, 0x3B, 0x50, 0xAC,
+    0x26, 0x35, 0xA4, 0x41, 0x42, 0x6B, 0xEA, 0x74, 0x92, 0x88, 0x8A, 0xA6, 0x01, 0x67, 0x90, 0x3D,
+    0x04, 0x4E, 0x3A, 0xC8, 0x12, 0x0F, 0x89, 0xC7, 0x43, 0xD6, 0xC3, 0xEF, 0x02, 0x0F, 0x32, 0xE2,
+    0x41, 0x3F, 0xC3, 0x43, 0x7E, 0x84, 0x15, 0xEB, 0x70, 0x57, 0x74, 0x08, 0x83, 0x18, 0x9B, 0x0F,
+    0x52, 0xA2, 0x83, 0xC3, 0xA6, 0x05, 0x9B, 0x0A, 0x17, 0x7C, 0x1E, 0xA3, 0xD6, 0x58, 0x0F, 0x16,
+    0x15, 0xC6, 0x88, 0x01, 0x48, 0x51, 0xDF, 0x8A, 0xCE, 0x72, 0x94, 0xF7, 0xF2, 0xFA, 0x2E, 0xD4,
+    0x0D, 0xC1, 0xC2, 0x16, 0x23, 0x70, 0x95, 0x64, 0xEE, 0xCB, 0xA7, 0xE2, 0x15, 0x54, 0xCC, 0xAC,
+    0x72, 0x45, 0xAD, 0xDD, 0xA9, 0xE8, 0x1F, 0xBC, 0xE8, 0x6F, 0xAD, 0xA4, 0x98, 0x99, 0x85, 0x09,
+    0x68, 0x6B, 0x80, 0xE5, 0xF0, 0x80, 0xF6, 0x11, 0x4B, 0xDC, 0x4B, 0xDC, 0xA5, 0x50, 0x0E, 0x06,
+    0x98, 0xF1, 0x61, 0x84, 0x8F, 0x64, 0x47, 0x4D, 0x58, 0xE3, 0xB1, 0xB6, 0xBD, 0x94, 0x97, 0x91,
+    0x85, 0x66, 0xBD, 0xE8, 0xDF, 0x3F, 0x07, 0x23, 0x9F, 0x78, 0xFA, 0x0F, 0x9D, 0x0A, 0x5C, 0x58,
+    0x8A, 0xC5, 0xA9, 0x45, 0xC8, 0x94, 0xE3, 0x97, 0x91, 0xEC, 0x4B, 0xD2, 0xCE, 0x69, 0xD6, 0xF4,
+    0x1A, 0x74, 0x19, 0xDF, 0xC4, 0xCD, 0x7E, 0xE1, 0xCB, 0x92, 0x5F, 0x10, 0x66, 0x2B, 0x45, 0x9B,
+    0x9C, 0x6B, 0x98, 0x5E, 0x5B, 0xE0, 0x55, 0x6E, 0x07, 0x78, 0x31, 0x5F, 0x1B, 0x36, 0xCB, 0x98,
+    0x51, 0x91, 0x03, 0xC9, 0xEC, 0x50, 0xFC, 0xDD, 0x87, 0x35, 0xC8, 0x38, 0xC9, 0x7E, 0x1A, 0x81,
+    0x5A, 0x22, 0xB9, 0xA0, 0x98, 0x87, 0x1F, 0x9D, 0x66, 0x1C, 0x3C, 0x50, 0x57, 0x70, 0xAB, 0x00,
+    0x66, 0x86, 0x74, 0xC2, 0x4B, 0xA4, 0x18, 0x50, 0x57, 0xE9, 0x46, 0x8A, 0xF3, 0x8D, 0x18, 0x4A,
+    0x79, 0x93, 0x79, 0x14, 0x93, 0x9E, 0x91, 0x17, 0xE6, 0x9B, 0xC8, 0x7E, 0x44, 0x3D, 0x41, 0x54,
+    0xF5, 0x40, 0xE2, 0x35, 0xE0, 0x57, 0xF0, 0x48, 0x39, 0x58, 0xA7, 0x45, 0x98, 0x87, 0xEA, 0x1E,
+    0xAC, 0xD3, 0x1E, 0xA2, 0x04, 0x44, 0x35, 0x4C, 0xFA, 0xFC, 0xFD, 0x0F, 0xE6, 0xE9, 0x25, 0xD6,
+    0x27, 0x6E, 0x9E, 0x6E, 0xDA, 0x6A, 0x9E, 0x8E, 0xAC, 0x88, 0xD3, 0xE9, 0x47, 0x47, 0x71, 0x00,
+    0x68, 0x5F, 0x78, 0x95, 0x70, 0x04, 0xF5, 0x6F, 0xFC, 0x6B, 0x54, 0xAF, 0xC0, 0xA0, 0xB6, 0x39,
+    0x64, 0xA3, 0x73, 0x60, 0x55, 0x61, 0xB5, 0x69, 0x11, 0x37, 0x0B, 0x70, 0x97, 0x11, 0xDB, 0x45,
+    0x0C, 0xD3, 0x96, 0x7C, 0x39, 0x23, 0x5F, 0xCA, 0x60, 0xEA, 0xD9, 0xB5, 0xB8, 0xEF, 0x69, 0xB6,
+    0x13, 0x55, 0x7F, 0xC9, 0x4C, 0x84, 0x9A, 0x9B, 0x17, 0xA1, 0xFD, 0xBF, 0xFC, 0x7D, 0x4E, 0x7F,
+    0x3D, 0xFC, 0x0D, 0x2C, 0x0D, 0x25, 0x7D, 0x25, 0x0D, 0x72, 0xA2, 0x0A, 0x73, 0x62, 0x5F, 0xFB,
+    0xAF, 0x6E, 0x56, 0x0E, 0x6E, 0xD2, 0xB5, 0x3D, 0xDC, 0x8B, 0xCB, 0x90, 0x32, 0x9C, 0x36, 0x86,
+    0x13, 0xD1, 0x5D, 0x80, 0xE9, 0x12, 0xB0, 0x25, 0x08, 0x35, 0xF0, 0xA8, 0x03, 0xCD, 0x09, 0x7E,
+    0x8E, 0x25, 0x98, 0x36, 0x00, 0x85, 0x2A, 0x6E, 0x05, 0x3E, 0xD5, 0x83, 0x60, 0x0B, 0xC4, 0x40,
+    0x3D, 0x7C, 0xE7, 0x6F, 0x5B, 0x82, 0x84, 0xB1, 0x32, 0xB9, 0x0D, 0x9B, 0x81, 0x65, 0x73, 0xB6,
+    0x7F, 0xF9, 0x89, 0x78, 0xF9, 0xEC, 0xC9, 0x95, 0x3A, 0xB9, 0x87, 0xBC, 0xFB, 0x0A, 0x54, 0x31,
+    0xC3, 0x2F, 0x31, 0x6F, 0x64, 0x35, 0x51, 0x93, 0x69, 0x8B, 0xA1, 0xFA, 0xF9, 0xAC, 0xAE, 0x36,
+    0x8D, 0x5C, 0x7F, 0xCB, 0xCD, 0xAB, 0x4B, 0x16, 0x19, 0x04, 0xA3, 0x8F, 0x76, 0x69, 0x6B, 0x35,
+    0x87, 0x8A, 0xE6, 0x97, 0x73, 0x32, 0x62, 0x33, 0x4A, 0xB2, 0x91, 0x75, 0x2D, 0x7A, 0x83, 0xF2,
+    0x23, 0xD9, 0x24, 0x7F, 0x40, 0xF7, 0x2E, 0xB9, 0xE8, 0x65, 0x31, 0x2A, 0xB4, 0xCD, 0xA8, 0x7F,
+    0xEC, 0x65, 0xF4, 0xFA, 0x59, 0x9F, 0xFC, 0xEA, 0xD0, 0xEA, 0xAF, 0x5D, 0xFA, 0xD8, 0xA6, 0x8F,
+    0x87, 0xEC, 0x91, 0x35, 0x6F, 0x5B, 0xF3, 0xE1, 0x50, 0xA0, 0x80, 0xBF, 0x39, 0xA0, 0xEC, 0x99,
+    0xC4, 0x9D, 0x70, 0xF7, 0x3B, 0x07, 0x42, 0xF2, 0xDB, 0xC0, 0x70, 0x5F, 0x60, 0x5C, 0xC2, 0x74,
+    0x81, 0x44, 0x08, 0x52, 0xED, 0x77, 0xA8, 0xCA, 0x95, 0x3B, 0x61, 0x09, 0x66, 0x80, 0x44, 0xF7,
+    0xB1, 0xE0, 0xC6, 0x42, 0x90, 0xCB, 0xCB, 0x1D, 0x29, 0xA7, 0xB1, 0x7D, 0x4F, 0xE4, 0x33, 0xFE,
+    0xB7, 0xA2, 0x36, 0x49, 0x10, 0x3D, 0xA9, 0x33, 0xC9, 0x3A, 0xF5, 0x9D, 0xE4, 0x27, 0xFA, 0xA9,
+    0x94, 0x68, 0xEA, 0xC6, 0xA7, 0x4F, 0x6A, 0xEF, 0xB2, 0x8F, 0x8E, 0xBF, 0x77, 0xE6, 0xD6, 0x9D,
+    0x47, 0x83, 0xD1, 0x4F, 0xEE, 0x58, 0xA3, 0x9F, 0x22, 0xE2, 0xFA, 0x97, 0xB4, 0x5F, 0xE8, 0x09,
+    0x55, 0x48, 0xF9, 0x6C, 0xDA, 0x53, 0xCE, 0xC4, 0x8D, 0xCF, 0x3C, 0x51, 0xC3, 0x25, 0x78, 0xC4,
+    0x8E, 0xD0, 0xD7, 0x58, 0xB0, 0x51, 0x8B, 0x5A, 0x2A, 0x55, 0x44, 0xA1, 0xB8, 0x6B, 0x63, 0x29,
+    0x8A, 0x65, 0xE8, 0xD5, 0x71, 0xCB, 0x34, 0xA0, 0xC8, 0x5D, 0x1C, 0xAF, 0x47, 0x39, 0x8A, 0x27,
+    0x47, 0x3C, 0x10, 0x21, 0x85, 0x24, 0x5B, 0x6C, 0x83, 0xE4, 0x65, 0x99, 0x9B, 0x6B, 0x1D, 0x33,
+    0x94, 0x87, 0x43, 0x16, 0x4F, 0x38, 0x9E, 0x19, 0x17, 0x0C, 0xF8, 0x01, 0x46, 0xD3, 0x1E, 0xF7,
+    0xAE, 0x8F, 0x87, 0x04, 0x0C, 0x73, 0x0F, 0x20, 0x4D, 0x01, 0xD7, 0xB1, 0xB4, 0x3B, 0x1C, 0x7D,
+    0xC8, 0xF6, 0xED, 0x83, 0x2F, 0x48, 0x6D, 0x45, 0xA5, 0xBC, 0xE6, 0xD6, 0xCA, 0x39, 0x0F, 0x45,
+    0xA7, 0xE2, 0xBE, 0x07, 0x97, 0xEB, 0x48, 0x7A, 0x1E, 0x2F, 0xE6, 0x93, 0x61, 0x2E, 0xB2, 0x57,
+    0x67, 0xE8, 0xD7, 0x86, 0x37, 0x64, 0x3D, 0x35, 0x7A, 0x73, 0x30, 0x66, 0x43, 0xEA, 0x51, 0x37,
+    0x1D, 0x8A, 0x98, 0xE3, 0x61, 0xB8, 0xC4, 0x8D, 0x24, 0xB5, 0x1D, 0x4C, 0x77, 0x3C, 0x47, 0x51,
+    0x36, 0x1B, 0x39, 0xAA, 0x2B, 0x75, 0x56, 0x17, 0xE1, 0x63, 0xC9, 0x36, 0xB9, 0xC8, 0x3F, 0x4E,
+    0x74, 0xFC, 0xFE, 0x04, 0xB5, 0x55, 0x31, 0x6F, 0xE4, 0x44, 0x14, 0xFE, 0x6C, 0x93, 0x0C, 0xC8,
+    0xC5, 0x50, 0x1C, 0xE8, 0x50, 0x8A, 0x69, 0x28, 0xA0, 0x40, 0xAE, 0x91, 0x2E, 0x6B, 0x8B, 0x2B,
+    0x28, 0x28, 0x2E, 0x05, 0xA9, 0x28, 0x8E, 0x12, 0xA5, 0x49, 0x43, 0xE9, 0xDD, 0xF5, 0xC1, 0x0F,
+    0x20, 0x14, 0x47, 0xCB, 0x15, 0x14, 0x28, 0x57, 0xDC, 0x1F, 0x70, 0xE2, 0xB9, 0xBB, 0x92, 0x66,
+    0x1A, 0x44, 0x89, 0x11, 0xE9, 0x63, 0x21, 0x23, 0x39, 0x3A, 0xAF, 0x87, 0xEF, 0x8D, 0x37, 0x09,
+    0xBA, 0x16, 0x31, 0xD2, 0xEC, 0xAC, 0x35, 0x33, 0xEF, 0x7D, 0xEF, 0x7B, 0xDF, 0x7B, 0x03, 0x44,
+    0x28, 0x80, 0x7E, 0x01, 0xE8, 0xFB, 0x2D, 0x70, 0x70, 0x17, 0xB7, 0x23, 0xEA, 0xF9, 0x93, 0x57,
+    0x40, 0x3A, 0xF0, 0xCF, 0x2B, 0x0B, 0x64, 0x25, 0x90, 0xFC, 0xC6, 0x3F, 0xE3, 0x3D, 0xC0, 0xDC,
+    0x77, 0x48, 0xBA, 0x7D, 0x60, 0x99, 0xB4, 0xD0, 0xD5, 0x02, 0x51, 0x17, 0x77, 0xC8, 0xBD, 0x47,
+    0xEA, 0x7D, 0x87, 0xE9, 0xF4, 0x19, 0x32, 0xDA, 0x90, 0xCD, 0x62, 0x04, 0x06, 0x53, 0x41, 0x7F,
+    0xDB, 0xF1, 0xEE, 0x92, 0x16, 0x6D, 0x70, 0x2C, 0x3E, 0x0D, 0xE7, 0x4E, 0x54, 0xDD, 0x78, 0xDD,
+    0x6B, 0x3F, 0x40, 0x33, 0x96, 0xC9, 0xE6, 0xE1, 0x90, 0xB6, 0xAA, 0xD7, 0x36, 0xE9, 0x32, 0xFA,
+    0xC9, 0x91, 0xB4, 0x0B, 0xCE, 0x25, 0x94, 0xAB, 0x79, 0xBF, 0x86, 0xE6, 0xCC, 0xAA, 0x12, 0xEB,
+    0x22, 0x8F, 0x2F, 0x8B, 0xCC, 0x7F, 0x87, 0x74, 0x63, 0x20, 0xE1, 0x70, 0x64, 0xDE, 0x8F, 0x82,
+    0x7E, 0x5E, 0x36, 0x9B, 0xC3, 0xCF, 0x25, 0x1E, 0x89, 0x03, 0xC9, 0x1F, 0x12, 0x17, 0xF4, 0x8B,
+    0x4E, 0x16, 0xF3, 0x49, 0x58, 0x72, 0xC2, 0xE4, 0xA8, 0x13, 0x27, 0x81, 0x0F, 0xCA, 0xFB, 0x8A,
+    0x4E, 0x53, 0x59, 0x52, 0xA7, 0x7F, 0x3D, 0xE4, 0x41, 0xF9, 0x1F, 0x2C, 0x8A, 0x87, 0xF3, 0xD3,
+    0x46, 0xCE, 0x0F, 0x0C, 0x91, 0x16, 0x19, 0x36, 0x17, 0xE5, 0xB0, 0x10, 0xC3, 0x16, 0x2B, 0xBA,
+    0xE3, 0xC6, 0x9A, 0xCE, 0x57, 0x40, 0x23, 0x18, 0xF6, 0xDC, 0x97, 0x4D, 0x91, 0xF8, 0x3F, 0x7F,
+    0xF7, 0x55, 0xFE, 0xC3, 0xE5, 0xB0, 0x8E, 0x87, 0xC4, 0x63, 0xA9, 0x6D, 0xDA, 0x45, 0x5D, 0x0D,
+    0x53, 0xE9, 0x97, 0x1D, 0xEA, 0x68, 0xA3, 0x8B, 0xD8, 0x7B, 0xB7, 0x84, 0xF6, 0x3D, 0xC9, 0x5C,
+    0x09, 0x53, 0x31, 0x51, 0x67, 0x30, 0xC4, 0x57, 0xC2, 0x93, 0xB7, 0xC1, 0x34, 0xF6, 0xBD, 0xC4,
+    0xFF, 0x75, 0xE9, 0xFB, 0x64, 0xD2, 0x86, 0xA8, 0x0A, 0x44, 0xC4, 0xA4, 0xAA, 0x8F, 0xA0, 0x6C,
+    0x89, 0xE4, 0x15, 0xE3, 0xF3, 0xEE, 0x86, 0x50, 0x41, 0x21, 0x10, 0x84, 0x83, 0x7E, 0xCE, 0x2A,
+    0x4D, 0x87, 0x29, 0x41, 0x4B, 0xC4, 0x12, 0x2E, 0x63, 0x2D, 0x24, 0x50, 0xCD, 0x28, 0x35, 0xCD,
+    0x19, 0x61, 0x91, 0x73, 0xB1, 0x9D, 0x12, 0xD3, 0xB5, 0x29, 0x7C, 0x88, 0x27, 0xE8, 0x09, 0xED,
+    0xEF, 0x1A, 0xB1, 0xB8, 0x3A, 0x98, 0x05, 0xD3, 0x54, 0x24, 0xDE, 0x26, 0x57, 0x59, 0x95, 0x15,
+    0x0B, 0x92, 0x33, 0xA4, 0x56, 0xB9, 0x45, 0x74, 0x1E, 0x79, 0xDF, 0x2A, 0x4F, 0xB2, 0x68, 0xB7,
+    0x9E, 0x5D, 0x93, 0x2C, 0x68, 0xB7, 0x4B, 0x5A, 0x47, 0x48, 0x0C, 0x51, 0xB1, 0x85, 0xBB, 0xEB,
+    0x37, 0xE0, 0xF9, 0x01, 0xE6, 0x44, 0x62, 0x46, 0x2E, 0x1B, 0xE3, 0xCC, 0x6B, 0xB8, 0x1D, 0xAE,
+    0x82, 0x22, 0xDA, 0xF9, 0xC2, 0xEE, 0x32, 0xBF, 0x04, 0xEF, 0x9F, 0xFB, 0x13, 0x0C, 0x3C, 0x99,
+    0x7D, 0x26, 0x9A, 0xE4, 0xE9, 0x33, 0x9E, 0x36, 0x55, 0x0D, 0xD5, 0xA9, 0x5E, 0x8D, 0x44, 0x35,
+    0x91, 0x88, 0x89, 0xA6, 0xEE, 0x88, 0x8F, 0xA6, 0x65, 0x28, 0x4E, 0x7D, 0xDF, 0x48, 0xAE, 0x67,
+    0xCB, 0xB5, 0x50, 0x1D, 0x3D, 0x1B, 0x49, 0xBF, 0xF5, 0x8F, 0x87, 0xAC, 0x30, 0x89, 0x4B, 0xBA,
+    0x25, 0x15, 0xD1, 0x66, 0x55, 0xEE, 0x5B, 0x34, 0xFD, 0x75, 0x98, 0x6F, 0x90, 0x1C, 0xB2, 0x16,
+    0x89, 0xF6, 0xDF, 0xBA, 0xC1, 0xCD, 0x71, 0x4C, 0x2A, 0x44, 0x26, 0xD1, 0x55, 0x34, 0x89, 0x2C,
+    0xFA, 0x6B, 0xD4, 0x02, 0x3F, 0xB5, 0x33, 0xEA, 0x00, 0xFF, 0xB0, 0xE6, 0x61, 0x6F, 0xD7, 0x84,
+    0x6F, 0xAE, 0x58, 0x16, 0x3D, 0xE2, 0xFE, 0x8C, 0xB1, 0xF2, 0x74, 0xEA, 0x46, 0x82, 0xE2, 0xE9,
+    0x35, 0x95, 0xBD, 0xB6, 0xC4, 0xD3, 0x32, 0x3F, 0x17, 0xB8, 0x61, 0x28, 0xEA, 0xEE, 0x21, 0x53,
+    0x16, 0xD5, 0xFB, 0xD7, 0x7E, 0xFF, 0x5B, 0x38, 0xDB, 0x61, 0x12, 0x1B, 0x0A, 0x47, 0x85, 0xE5,
+    0xCD, 0xB8, 0xC0, 0x6B, 0x23, 0xAD, 0xE2, 0x96, 0x8A, 0x54, 0x96, 0xAA, 0x19, 0x29, 0x1B, 0x31,
+    0xC8, 0x54, 0x2A, 0x27, 0xFE, 0x7A, 0x65, 0x43, 0x72, 0x53, 0xCB, 0x30, 0x50, 0xEA, 0x47, 0x52,
+    0x6A, 0x0B, 0xFD, 0xA9, 0x64, 0xD0, 0x98, 0x07, 0x62, 0x53, 0xB3, 0x33, 0x84, 0xCA, 0xDC, 0xC8,
+    0xB2, 0x5A, 0xAD, 0x42, 0xA5, 0xED, 0xCF, 0x05, 0x54, 0x06, 0xD9, 0xD9, 0x5A, 0x58, 0xCA, 0x8B,
+    0x41, 0x38, 0x3A, 0xC3, 0x20, 0x0E, 0x06, 0xF4, 0x51, 0x07, 0xD5, 0xF2, 0x87, 0x9A, 0xB0, 0xD4,
+    0x4E, 0x0D, 0x69, 0x06, 0x81, 0x4B, 0xBC, 0x1D, 0xA0, 0xC5, 0x6D, 0x19, 0x4A, 0xFA, 0x9B, 0x50,
+    0xCB, 0x77, 0xE3, 0xD7, 0xA1, 0x9B, 0x13, 0xFC, 0x84, 0xE3, 0x6A, 0xDD, 0x26, 0x2E, 0x9D, 0xF0,
+    0xD0, 0x69, 0x4C, 0x07, 0x14, 0x7A, 0x29, 0x6E, 0xB2, 0xB8, 0x13, 0x79, 0xD7, 0xFA, 0x51, 0x28,
+    0x8A, 0x7D, 0x41, 0xC0, 0x5A, 0x98, 0xE6, 0x5A, 0x97, 0x14, 0x0E, 0xB9, 0x70, 0xA2, 0xEC, 0x60,
+    0x42, 0xA3, 0x70, 0xA5, 0x14, 0x91, 0x91, 0x5A, 0xA2, 0xC2, 0xA4, 0xF6, 0xC7, 0x98, 0xEA, 0x86,
+    0xAF, 0x74, 0x41, 0xA9, 0x05, 0xDE, 0x8A, 0xAD, 0x4E, 0x28, 0x91, 0x20, 0x93, 0x93, 0x3B, 0x37,
+    0x58, 0x32, 0x8A, 0xBD, 0xA1, 0xDD, 0x8F, 0x77, 0x45, 0x15, 0xE7, 0xFF, 0xAA, 0xB0, 0xE5, 0xAC,
+    0x14, 0x25, 0x4D, 0xB4, 0x42, 0x4E, 0x9A, 0xDE, 0x39, 0xAE, 0xE6, 0x22, 0x95, 0x8A, 0x89, 0xAE,
+    0x8B, 0x96, 0x33, 0x6D, 0xBF, 0xC6, 0x5A, 0xE4, 0x43, 0x73, 0xFD, 0x56, 0xD4, 0x11, 0x74, 0xE2,
+    0x94, 0xED, 0x6F, 0x9D, 0xED, 0x5D, 0x71, 0xBB, 0x53, 0x8F, 0xCF, 0x83, 0x26, 0xE4, 0xEE, 0x80,
+    0x68, 0x44, 0x4E, 0x1E, 0x27, 0xB1, 0x11, 0x64, 0xC2, 0xA0, 0xD2, 0x17, 0x45, 0xEA, 0xA8, 0x33,
+    0x43, 0xFD, 0xEE, 0x84, 0x8E, 0x31, 0x41, 0x18, 0x38, 0x3A, 0x1D, 0x67, 0x77, 0x92, 0xE1, 0x7C,
+    0x46, 0x27, 0x9F, 0xEC, 0xE4, 0xC8, 0x9F, 0x48, 0x41, 0x11, 0xE2, 0x5A, 0xF8, 0x72, 0xDB, 0x5E,
+    0xB2, 0x9D, 0xF2, 0xAD, 0xED, 0x05, 0x05, 0xEC, 0x99, 0xED, 0x63, 0xDF, 0xCE, 0x5A, 0x3B, 0x3A,
+    0xFD, 0x39, 0xB4, 0x8F, 0xA3, 0xA7, 0xC4, 0xAC, 0xDA, 0xD9, 0xD0, 0x22, 0xB4, 0xD1, 0x70, 0x4D,
+    0x34, 0x20, 0xE5, 0xBE, 0xE6, 0xF7, 0xBB, 0x92, 0x00, 0x91, 0xD4, 0x2C, 0x8C, 0xB9, 0x7E, 0x64,
+    0x95, 0x6F, 0x23, 0x87, 0x70, 0x41, 0x06, 0xE5, 0xA5, 0xC9, 0xA4, 0xAE, 0x29, 0xAF, 0xD0, 0xC8,
+    0x24, 0x61, 0xD2, 0xEC, 0x67, 0xAE, 0x05, 0x36, 0x2F, 0xE4, 0xA2, 0xD9, 0xAC, 0x65, 0xEB, 0x33,
+    0x3D, 0x63, 0xD6, 0x67, 0xDC, 0xD1, 0x3F, 0x72, 0x27, 0xFD, 0xC5, 0x92, 0xB3, 0x97, 0xDC, 0x49,
+    0x5C, 0x2F, 0xC5, 0x51, 0x22, 0x8F, 0xF9, 0xDE, 0x50, 0x0C, 0x7C, 0x78, 0x1C, 0x1F, 0xAF, 0xA8,
+    0x1B, 0x78, 0xAD, 0xAE, 0xD9, 0x7C, 0x17, 0xA5, 0x5C, 0x3B, 0xE3, 0x35, 0x35, 0x51, 0xFF, 0xB1,
+    0x97, 0x5E, 0xDA, 0x08, 0x89, 0x04, 0x9D, 0x07, 0x08, 0x7C, 0xCE, 0x38, 0x77, 0x0E, 0x43, 0xFE,
+    0xE3, 0x13, 0x7C, 0x45, 0x85, 0xD5, 0x54, 0x8F, 0xD4, 0x73, 0xAF, 0xAB, 0xA8, 0x63, 0x7F, 0xEF,
+    0x4C, 0xC1, 0x22, 0x64, 0xC0, 0x39, 0x5B, 0xC1, 0x82, 0x71, 0xED, 0x33, 0xAE, 0xE5, 0xF6, 0x29,
+    0x5B, 0xF1, 0x29, 0xCB, 0xF9, 0x94, 0xE9, 0xDB, 0xA7, 0xEC, 0xFF, 0x1C, 0xFF, 0x00, 0x9D, 0x55,
+    0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0x3C, 0x93, 0x3B, 0x83, 0x5C, 0x4C, 0x0A, 0x24, 0x50, 0x52,
+    0x4C, 0x6A, 0x24, 0xE4, 0x3F, 0x70, 0x6B, 0x0F, 0x4A, 0x41, 0x41, 0x93, 0x26, 0x75, 0x1A, 0x8A,
+    0x74, 0xF9, 0x03, 0xBB, 0xB7, 0x0E, 0x94, 0x14, 0x39, 0x09, 0x41, 0x4D, 0x89, 0x8E, 0x22, 0x0D,
+    0x45, 0x0A, 0xDF, 0xAD, 0x81, 0xE2, 0x8A, 0x14, 0x4C, 0x6A, 0x0A, 0x2C, 0x81, 0x04, 0xDD, 0x4D,
+    0x88, 0x05, 0x3E, 0xCE, 0xBB, 0xE6, 0x7B, 0xB6, 0xF7, 0x6E, 0x23, 0x44, 0x13, 0x4B, 0x5E, 0xAF,
+    0xDF, 0xCC, 0xBC, 0xEF, 0x7B, 0xEF, 0x7B, 0xEF, 0x19, 0x88, 0xE0, 0x00, 0xED, 0x9F, 0x01, 0x68,
+    0x32, 0xFE, 0xBC, 0xB3, 0x8F, 0x9D, 0x4B, 0x05, 0xE8, 0x80, 0x16, 0xBA, 0x43, 0x06, 0xB5, 0x81,
+    0x75, 0x51, 0xEF, 0x92, 0x0A, 0x97, 0x9E, 0x2B, 0x17, 0xB2, 0x52, 0x96, 0x98, 0x61, 0x9E, 0x71,
+    0x65, 0x66, 0xB8, 0x92, 0xC5, 0x95, 0x0E, 0x29, 0x17, 0x5B, 0x8B, 0x0E, 0x34, 0x71, 0xC5, 0x14,
+    0xD6, 0x25, 0xCF, 0x2B, 0xAE, 0xFC, 0x5E, 0x71, 0xE5, 0xD2, 0xF3, 0xD8, 0xB2, 0xE6, 0xB1, 0x34,
+    0xF0, 0x58, 0x12, 0x90, 0x54, 0xBA, 0x11, 0x9C, 0x81, 0x8C, 0xF9, 0x34, 0xC0, 0xDC, 0xAD, 0xB1,
+    0x1F, 0x15, 0x57, 0x2C, 0x8E, 0xF0, 0x30, 0xF6, 0x28, 0xE3, 0x0A, 0x2D, 0xC1, 0x1B, 0x53, 0x44,
+    0xC1, 0x38, 0x15, 0xAC, 0xD3, 0x75, 0x0A, 0x5D, 0xE7, 0x88, 0x7D, 0x46, 0x2F, 0x33, 0x98, 0x6A,
+    0x81, 0xB4, 0x98, 0x63, 0xE9, 0x0E, 0xD5, 0xB9, 0xCB, 0xFB, 0x27, 0x30, 0x6B, 0x0B, 0x09, 0x11,
+    0xB8, 0x29, 0x9E, 0xEA, 0x39, 0x06, 0x04, 0xBC, 0xA7, 0x76, 0xE3, 0x4C, 0x37, 0x0E, 0x49, 0xDF,
+    0x17, 0xE8, 0x3F, 0x5C, 0x15, 0xA6, 0x46, 0x8E, 0x53, 0xE0, 0x50, 0x28, 0x75, 0xA9, 0x23, 0xB5,
+    0x0E, 0x48, 0xCE, 0x6A, 0xEE, 0xE3, 0x9B, 0x84, 0x0C, 0xFD, 0x8A, 0x6B, 0xE6, 0xA7, 0x8A, 0xBB,
+    0x72, 0xBA, 0x6D, 0xB8, 0xC1, 0xFC, 0x40, 0xD3, 0x69, 0x5C, 0x73, 0xBB, 0xF1, 0x64, 0x60, 0xEB,
+    0xA4, 0x45, 0xDA, 0xF7, 0xE2, 0x99, 0x47, 0x71, 0x8F, 0xF7, 0x0D, 0xDE, 0xA5, 0x25, 0xE5, 0x12,
+    0x0A, 0x47, 0x5B, 0xF4, 0xE8, 0xD4, 0x71, 0x63, 0xA5, 0x2F, 0x1E, 0x55, 0xA9, 0xB3, 0x8F, 0x5B,
+    0xE4, 0x8C, 0xB2, 0x64, 0xC2, 0x5F, 0x36, 0x84, 0xAD, 0x90, 0xA7, 0x40, 0x5B, 0x22, 0x7E, 0x11,
+    0x90, 0xC7, 0x75, 0xD4, 0x18, 0x9F, 0x16, 0xA6, 0x6F, 0xE9, 0xD7, 0xED, 0xC4, 0x90, 0xF4, 0x47,
+    0x50, 0x3D, 0xA1, 0x72, 0xFF, 0xA8, 0xD6, 0x2D, 0x73, 0x91, 0x16, 0xB0, 0x05, 0x99, 0xE5, 0x89,
+    0x67, 0x20, 0xC2, 0xF3, 0x65, 0xCB, 0x7D, 0xCF, 0x7B, 0x5E, 0x24, 0xD6, 0x77, 0x9B, 0xE3, 0xE3,
+    0x6F, 0x25, 0x10, 0xFB, 0x84, 0x81, 0x9C, 0x70, 0x83, 0x0E, 0x8C, 0x2D, 0x25, 0x03, 0x74, 0x94,
+    0xC4, 0xFA, 0xB8, 0xA5, 0xE8, 0x4C, 0x8C, 0xA7, 0xE7, 0x56, 0xAA, 0x43, 0x80, 0x6E, 0xFF, 0xC1,
+    0xB7, 0x35, 0xF2, 0xAF, 0x3A, 0xD5, 0x50, 0xE7, 0x42, 0xF1, 0x50, 0xF2, 0x63, 0x8D, 0xD4, 0xD2,
+    0xE5, 0xB2, 0xEF, 0xFF, 0xA4, 0x80, 0x9F, 0x57, 0x58, 0x58, 0x96, 0xCF, 0x82, 0x0A, 0xAF, 0x55,
+    0x0B, 0xC9, 0xED, 0xAA, 0xD9, 0x61, 0x1B, 0x57, 0xC4, 0x4D, 0xA9, 0x28, 0xEE, 0xBC, 0xFD, 0x66,
+    0x4A, 0x48, 0x00, 0x2B, 0xFE, 0xBC, 0xFA, 0xE7, 0xF8, 0xF8, 0xE9, 0x1B, 0x29, 0xF1, 0x6C, 0x54,
+    0x62, 0x1F, 0xC5, 0xB5, 0x12, 0x05, 0x37, 0xFA, 0x51, 0x09, 0xC3, 0x3C, 0xA4, 0x5B, 0x25, 0x08,
+    0x74, 0x26, 0x69, 0xBB, 0x52, 0x22, 0x8D, 0xFD, 0xFF, 0x28, 0x11, 0x85, 0x83, 0x41, 0x65, 0xBC,
+    0xA5, 0xDC, 0x8E, 0x3A, 0x8D, 0xC4, 0x55, 0xE1, 0xB7, 0xB8, 0x93, 0x30, 0xA5, 0xEB, 0x82, 0x54,
+    0x03, 0x6F, 0xCB, 0x17, 0xD6, 0x37, 0xA2, 0x86, 0x79, 0xEA, 0x90, 0xF7, 0x3D, 0xF6, 0xEE, 0x3F,
+    0x60, 0x44, 0xBA, 0x1E, 0x8C, 0x8C, 0x9D, 0xF7, 0x21, 0xEF, 0x5C, 0x6E, 0xF7, 0x49, 0xB4, 0x2A,
+    0x24, 0x9C, 0xB8, 0xDF, 0x70, 0xDD, 0x8D, 0xB5, 0x9D, 0x25, 0x95, 0xF9, 0x2C, 0x44, 0xC5, 0x9D,
+    0x09, 0xF0, 0xF6, 0x05, 0x23, 0xA9, 0xE3, 0x2F, 0xD7, 0xCC, 0x47, 0x45, 0x4E, 0x60, 0xC3, 0xC1,
+    0x38, 0x6A, 0x99, 0x93, 0x8A, 0xE0, 0xD2, 0x99, 0x29, 0xB8, 0xE8, 0x0C, 0x4D, 0xDE, 0x50, 0x64,
+    0x49, 0x0A, 0x28, 0x2D, 0x62, 0xD9, 0xB2, 0x77, 0x7F, 0xA4, 0x4F, 0x16, 0x51, 0xC3, 0x3C, 0x98,
+    0x8A, 0x31, 0x9D, 0xD0, 0xCD, 0x30, 0x12, 0x52, 0x19, 0x0E, 0x2D, 0x75, 0xA4, 0x77, 0xE3, 0x16,
+    0x24, 0x20, 0xF1, 0x48, 0xD8, 0x51, 0x60, 0xA9, 0xE8, 0x9F, 0xC9, 0xDF, 0x9C, 0x48, 0x74, 0x61,
+    0x22, 0x1E, 0x49, 0x05, 0x71, 0x37, 0xB0, 0x16, 0x33, 0x63, 0xCB, 0x37, 0x82, 0xE7, 0x27, 0x49,
+    0x26, 0xEC, 0x64, 0x17, 0x1B, 0x0F, 0xA1, 0xBE, 0x8E, 0x64, 0x4E, 0x30, 0x41, 0x1D, 0x81, 0xF8,
+    0xC8, 0xC4, 0x5B, 0x4B, 0xA3, 0x0A, 0xE4, 0x9F, 0x54, 0x0C, 0xC5, 0x4A, 0xA6, 0x0E, 0x28, 0x0E,
+    0xAE, 0xB1, 0x17, 0x92, 0x66, 0xC1, 0x5E, 0xD2, 0x55, 0x24, 0x19, 0x94, 0x1C, 0x23, 0x1B, 0xC7,
+    0x1A, 0xCF, 0x14, 0xA3, 0x59, 0x51, 0x14, 0x24, 0xED, 0x08, 0x77, 0xF3, 0x86, 0x4C, 0x43, 0xBE,
+    0xC8, 0x08, 0x7A, 0x7D, 0x18, 0x66, 0x22, 0x14, 0xB1, 0x3A, 0x22, 0x27, 0x5E, 0x7B, 0xB2, 0x30,
+    0xAC, 0x7D, 0x26, 0x82, 0x2C, 0xE6, 0x22, 0x51, 0x43, 0x00, 0x99, 0x46, 0x48, 0xBE, 0x97, 0xA6,
+    0xA2, 0x19, 0x33, 0xD1, 0xF7, 0x52, 0xB4, 0xED, 0x31, 0x29, 0x2E, 0xB8, 0x83, 0xA0, 0x46, 0xCC,
+    0xCC, 0x80, 0x96, 0xA2, 0x34, 0x92, 0x93, 0xBD, 0x09, 0x6A, 0x4B, 0xC2, 0xFE, 0x87, 0xC4, 0x7E,
+    0x81, 0xF7, 0x61, 0xA5, 0x28, 0x16, 0x92, 0x4A, 0x79, 0xE8, 0x9A, 0x6E, 0x39, 0x63, 0x19, 0x2D,
+    0xF5, 0x40, 0x99, 0x88, 0xDA, 0x24, 0xAB, 0xA5, 0x0B, 0xCC, 0x15, 0x89, 0xBF, 0xBD, 0x84, 0x2A,
+    0x59, 0x90, 0x82, 0xB2, 0x22, 0xC3, 0x62, 0x14, 0x57, 0x0E, 0x4E, 0xEA, 0x88, 0x39, 0x15, 0x6E,
+    0xAB, 0xB1, 0x25, 0xA2, 0x7B, 0x14, 0xC6, 0x7E, 0xC4, 0xA3, 0x8D, 0x54, 0xCF, 0x5D, 0xFE, 0xF9,
+    0xEE, 0x83, 0x71, 0x4E, 0x0F, 0x17, 0xCF, 0x2C, 0x86, 0x6F, 0x04, 0x1B, 0x99, 0x0D, 0xE3, 0x20,
+    0xDF, 0x09, 0x69, 0x19, 0x3E, 0xA2, 0x40, 0x5E, 0xDA, 0xB3, 0xB8, 0x8D, 0x0C, 0xA1, 0xA1, 0xD7,
+    0xE7, 0x92, 0xFD, 0xBF, 0xC8, 0x4B, 0x9F, 0x4B, 0xCD, 0x77, 0xDB, 0x82, 0x38, 0xDC, 0x26, 0x27,
+    0x17, 0xB3, 0xA4, 0x9F, 0x13, 0x00, 0x79, 0xB3, 0x1D, 0x39, 0x5B, 0x26, 0x1F, 0xBF, 0xC6, 0xE4,
+    0x60, 0x87, 0xC9, 0x2D, 0xE0, 0x1B, 0xAA, 0x20, 0x4D, 0x49, 0x61, 0xB4, 0x3C, 0x4C, 0x41, 0xDF,
+    0x19, 0x8D, 0x28, 0x19, 0xA5, 0x0A, 0xA9, 0x4C, 0x1D, 0xF1, 0x4D, 0x82, 0x38, 0xB8, 0x62, 0xF2,
+    0x0B, 0x3D, 0x24, 0xC2, 0xC4, 0x4A, 0x79, 0x2C, 0x31, 0xB5, 0x9C, 0x24, 0x6E, 0xE8, 0xCE, 0xB8,
+    0x9E, 0xCC, 0x2B, 0xEE, 0x56, 0x9B, 0x11, 0xCE, 0xB1, 0xE3, 0x5A, 0x3A, 0x9C, 0x71, 0xDB, 0xCE,
+    0xFC, 0x20, 0x58, 0x24, 0x38, 0x22, 0x42, 0x4E, 0x50, 0x53, 0xF0, 0xC3, 0xE6, 0x77, 0x8C, 0x99,
+    0x12, 0xAD, 0x4E, 0xC8, 0xD3, 0xF8, 0x77, 0x83, 0x92, 0x76, 0xB7, 0xFD, 0xA9, 0xC0, 0x4D, 0x33,
+    0x60, 0x28, 0xCD, 0x6E, 0xAA, 0xD3, 0xC1, 0x58, 0x8D, 0x46, 0x02, 0x26, 0x8F, 0x83, 0x80, 0x5E,
+    0xE3, 0xDD, 0x82, 0xFA, 0x22, 0x60, 0xC1, 0x94, 0x9F, 0xB1, 0x3B, 0xE6, 0x32, 0x76, 0x55, 0x53,
+    0x62, 0x99, 0x54, 0x36, 0x2C, 0x9F, 0x9E, 0xEB, 0xFE, 0xD7, 0x7A, 0xFF, 0x68, 0x36, 0xFA, 0x28,
+    0xC7, 0x90, 0xDA, 0x71, 0xDC, 0x4C, 0xD7, 0xBF, 0xB5, 0x54, 0xBF, 0x8F, 0x1B, 0x45, 0x14, 0x7E,
+    0xB3, 0x73, 0xCE, 0xA2, 0x5B, 0x71, 0x93, 0xC2, 0x69, 0x68, 0xDC, 0xA4, 0xE1, 0x24, 0x6E, 0x5B,
+    0x90, 0x6C, 0xEF, 0xC2, 0x75, 0x54, 0x17, 0x09, 0x8B, 0x82, 0x86, 0x12, 0xA5, 0xA2, 0xA0, 0xB4,
+    0xCF, 0x1B, 0x1A, 0x5A, 0x57, 0xB4, 0x18, 0x29, 0x45, 0xB2, 0x45, 0xD2, 0x5C, 0x71, 0x3A, 0xF9,
+    0xC7, 0x24, 0x11, 0xA2, 0xA0, 0xD9, 0x3F, 0x61, 0x05, 0x25, 0x42, 0x1A, 0xA4, 0x95, 0x62, 0xDD,
+    0xAD, 0xFD, 0xF8, 0xDE, 0xAC, 0x8F, 0x23, 0x48, 0xD1, 0x59, 0x48, 0xEC, 0xE8, 0x8D, 0x3D, 0x6F,
+    0xDE, 0x7C, 0xEF, 0xD7, 0x37, 0x43, 0x63, 0xAE, 0x69, 0x09, 0x59, 0x0F, 0x3E, 0xA3, 0x15, 0x91,
+    0xAA, 0x88, 0x02, 0xD7, 0x88, 0x2E, 0x21, 0x05, 0x51, 0x08, 0x89, 0x2C, 0x91, 0x11, 0xC9, 0x20,
+    0x29, 0x51, 0x87, 0x88, 0x62, 0x48, 0x02, 0xE9, 0x43, 0x4E, 0xA1, 0x1B, 0xC3, 0x7E, 0x29, 0xF6,
+    0x76, 0x6B, 0x7F, 0x6D, 0x0B, 0x69, 0xC1, 0x86, 0xF2, 0x3C, 0x4D, 0xD8, 0x76, 0xF2, 0x29, 0x76,
+    0xC5, 0x01, 0xFC, 0xF5, 0x3C, 0x14, 0xD6, 0xFA, 0xDF, 0x6B, 0x26, 0xE2, 0x4C, 0xFC, 0x2B, 0xEC,
+    0xCC, 0xBC, 0x27, 0x00, 0xAA, 0x54, 0x80, 0xC8, 0xCF, 0x81, 0x1B, 0x62, 0xD6, 0x6E, 0x26, 0x8B,
+    0xEC, 0x3E, 0xBD, 0xF1, 0x49, 0x70, 0x43, 0x1F, 0xDA, 0xCC, 0xCF, 0x35, 0x8D, 0x48, 0x3C, 0xCC,
+    0x7C, 0x8E, 0x32, 0x3B, 0xF1, 0x87, 0x30, 0x2A, 0xC9, 0x54, 0x6D, 0x1E, 0xC3, 0x57, 0xC0, 0x9C,
+    0x86, 0x85, 0xBE, 0x5C, 0x16, 0x91, 0xD5, 0x65, 0xE8, 0x30, 0x17, 0x81, 0x33, 0x59, 0x68, 0x55,
+    0x65, 0xD2, 0x08, 0x73, 0x07, 0x55, 0x08, 0x5C, 0x8C, 0x50, 0xB4, 0x4B, 0x90, 0x99, 0x29, 0xFA,
+    0xD4, 0xF9, 0x78, 0x99, 0xF5, 0x28, 0xE6, 0x0D, 0x1C, 0x26, 0x5C, 0x0A, 0x38, 0xDD, 0xDD, 0x13,
+    0x6F, 0x12, 0xC4, 0x4A, 0x4A, 0xF4, 0xE5, 0x3B, 0xFF, 0x08, 0x2D, 0x98, 0x10, 0xBD, 0x2F, 0x85,
+    0xED, 0x49, 0xA5, 0x86, 0x52, 0xAA, 0x99, 0xD4, 0xAA, 0x96, 0x62, 0xAD, 0x3A, 0x40, 0xA8, 0x62,
+    0xAE, 0x95, 0x8B, 0x1F, 0x2C, 0x03, 0xD7, 0xA7, 0x58, 0x97, 0xF0, 0x71, 0x2C, 0x93, 0x86, 0xB7,
+    0x24, 0xB4, 0x71, 0xBA, 0x88, 0xAC, 0xE1, 0x1A, 0x41, 0x70, 0x89, 0x43, 0x6D, 0x41, 0xED, 0x30,
+    0x53, 0xC4, 0x6C, 0xF5, 0x65, 0x3E, 0x91, 0x9C, 0x7C, 0xBE, 0x12, 0x80, 0xB4, 0x4D, 0x5A, 0x29,
+    0x4A, 0xB5, 0x18, 0x10, 0x92, 0xCC, 0xD0, 0xF2, 0xE2, 0x6F, 0x25, 0x0D, 0xAF, 0x2D, 0xB3, 0xC6,
+    0x52, 0x48, 0x40, 0x63, 0x04, 0x18, 0xBB, 0xED, 0xEE, 0x11, 0x35, 0xAD, 0xFC, 0x02, 0x58, 0x31,
+    0x2C, 0xEE, 0x4C, 0xC4, 0xE5, 0x61, 0x3E, 0xD1, 0xA0, 0xCE, 0x69, 0x9E, 0xF9, 0x1C, 0x1A, 0x80,
+    0x8A, 0x14, 0x22, 0x89, 0xD9, 0x49, 0xC7, 0x04, 0xAD, 0xD7, 0x30, 0x42, 0xB6, 0x6B, 0xDF, 0x53,
+    0xF1, 0x09, 0x30, 0x34, 0x20, 0x58, 0xA0, 0xAF, 0xE0, 0xC2, 0x94, 0x7C, 0xDB, 0x47, 0xA2, 0x5E,
+    0xF9, 0xDA, 0xE2, 0x88, 0x90, 0xA0, 0x00, 0x77, 0xA4, 0x06, 0x30, 0x46, 0xB3, 0xE8, 0x4A, 0xE2,
+    0x59, 0x5A, 0xE1, 0x9D, 0x30, 0x60, 0x2C, 0x41, 0x30, 0xFE, 0xE9, 0xDF, 0x85, 0x72, 0x3F, 0x4B,
+    0x70, 0x52, 0xD7, 0x91, 0x27, 0x17, 0xF0, 0xB5, 0xF4, 0x18, 0x38, 0xF3, 0x14, 0x38, 0x63, 0xDB,
+    0xF7, 0xDE, 0x60, 0x99, 0x6D, 0xD3, 0x21, 0x23, 0xED, 0x10, 0x18, 0xBD, 0xC6, 0xA4, 0x10, 0xC7,
+    0x57, 0xB4, 0x9F, 0x9A, 0x54, 0x9A, 0x8C, 0xBA, 0x49, 0x6F, 0xCC, 0x77, 0xA0, 0xE0, 0x6B, 0xE4,
+    0x91, 0x40, 0x22, 0xB9, 0x16, 0x42, 0x1B, 0xB0, 0x53, 0xBD, 0xC6, 0x46, 0x85, 0xB4, 0x56, 0x80,
+    0xAA, 0xE1, 0xB2, 0x86, 0x8B, 0x39, 0x19, 0x89, 0xF1, 0x9C, 0x7C, 0xDE, 0x1E, 0xFF, 0x07, 0xB8,
+    0x4C, 0x8A, 0xA6, 0x66, 0xBB, 0x27, 0x89, 0x03, 0xE3, 0xA6, 0x51, 0x48, 0x50, 0x35, 0x49, 0xCA,
+    0x7D, 0x7A, 0x7B, 0x92, 0x33, 0xB9, 0x68, 0x23, 0x21, 0x7B, 0xFF, 0x26, 0x0D, 0xDD, 0xA4, 0x51,
+    0xBC, 0x91, 0x46, 0xC8, 0xEC, 0xC0, 0x82, 0xD5, 0xDB, 0xD2, 0x18, 0xD1, 0xDC, 0xB7, 0x52, 0x65,
+    0x54, 0x3E, 0x3C, 0xBF, 0x38, 0x9F, 0x96, 0x3F, 0x66, 0x53, 0xBA, 0x7D, 0xA0, 0x2E, 0x69, 0x44,
+    0x47, 0x4F, 0x8F, 0x9E, 0x45, 0xFB, 0xC1, 0xA7, 0xB4, 0x7F, 0xFB, 0x48, 0xD8, 0xF0, 0x8B, 0xC1,
+    0xC9, 0xF6, 0xE7, 0xBD, 0x3C, 0x9F, 0x32, 0xF3, 0xCB, 0x3C, 0xCF, 0xA5, 0xB3, 0x9A, 0xB9, 0x4E,
+    0x98, 0x1F, 0x0D, 0x06, 0x27, 0xDB, 0x9B, 0x83, 0x15, 0x37, 0x4A, 0x7C, 0xAB, 0x7B, 0x03, 0xF9,
+    0x6E, 0xD9, 0xFB, 0x80, 0xAE, 0xD2, 0x7E, 0x61, 0xCE, 0xF4, 0x1F, 0xFF, 0xF1, 0x8F, 0xF3, 0xE8,
+    0x86, 0xF9, 0xD7, 0x3C, 0x7F, 0x8C, 0x7F, 0x40, 0x8E, 0x99, 0x7F, 0x12, 0xF0, 0xB3, 0xD0, 0xF6,
+    0x15, 0x9E, 0x87, 0xB9, 0x76, 0x2D, 0xD4, 0xD0, 0xD8, 0x3E, 0x58, 0x93, 0x0E, 0xB5, 0xC5, 0x6B,
+    0x77, 0x62, 0xEC, 0x69, 0xB3, 0x2A, 0x0E, 0x68, 0x36, 0x9B, 0x0D, 0xBB, 0xDD, 0xEE, 0x1E, 0x9D,
+    0x1D, 0x28, 0xD7, 0xD3, 0xE5, 0x30, 0xB4, 0x95, 0xF9, 0xD6, 0xC5, 0xC7, 0x65, 0x12, 0x15, 0xED,
+    0x56, 0xAA, 0xAA, 0xBE, 0x76, 0x73, 0x5D, 0xD6, 0xD1, 0x8B, 0xCA, 0x7C, 0xE2, 0x3A, 0xDA, 0x76,
+    0xA3, 0xAC, 0x2D, 0x28, 0xF7, 0xA0, 0x0F, 0x6F, 0xF4, 0x45, 0x2F, 0xCA, 0x3E, 0x8C, 0xE8, 0xFC,
+    0x28, 0x89, 0x7E, 0x79, 0xF9, 0xA7, 0x1B, 0x76, 0x8D, 0xD1, 0xAF, 0xAC, 0xF3, 0xAF, 0x0D, 0x1A,
+    0x87, 0xEB, 0x86, 0x26, 0x76, 0x89, 0xCA, 0x3B, 0x9F, 0x7F, 0xFF, 0x9C, 0x37, 0x17, 0x97, 0x67,
+    0xDA, 0xD2, 0x01, 0xD1, 0x37, 0x14, 0x14, 0x42, 0xC6, 0xAE, 0xDC, 0x3A, 0xD0, 0xBF, 0x27, 0x77,
+    0x1C, 0x9C, 0x49, 0xE4, 0x54, 0x58, 0x5E, 0x3F, 0x4C, 0xAE, 0x79, 0xB8, 0xE5, 0xBD, 0x14, 0xA2,
+    0x5B, 0x5C, 0x63, 0x26, 0x14, 0x55, 0x05, 0xB6, 0xE1, 0xF2, 0xB0, 0x31, 0x12, 0x72, 0xF4, 0xBC,
+    0x51, 0xEB, 0xF8, 0x51, 0x2A, 0x46, 0x9B, 0xAB, 0x95, 0xD8, 0x5F, 0x1B, 0xE9, 0xAD, 0x11, 0xE6,
+    0x2A, 0xA9, 0x31, 0xD6, 0x49, 0x1D, 0xD7, 0x91, 0x38, 0x9A, 0xC8, 0x06, 0xA7, 0x66, 0xA3, 0xB8,
+    0x8E, 0x37, 0xB8, 0x77, 0x1F, 0x89, 0x59, 0x7B, 0xB1, 0x59, 0xDF, 0x6D, 0x51, 0x3B, 0xA1, 0xC5,
+    0x98, 0x36, 0x63, 0xAA, 0xDB, 0x24, 0x4B, 0xBA, 0x0F, 0x05, 0xD5, 0x50, 0x29, 0x4C, 0x6B, 0x25,
+    0x6A, 0x3A, 0x69, 0x45, 0xBF, 0xAD, 0xEA, 0x3D, 0x7A, 0xF8, 0xE4, 0xE2, 0xC9, 0x2E, 0xB4, 0x94,
+    0x71, 0xF8, 0xF4, 0xF0, 0xD9, 0x2E, 0x84, 0xF4, 0x83, 0xC6, 0xEB, 0x9B, 0x11, 0x64, 0xB7, 0x0F,
+    0x39, 0xF1, 0x35, 0x35, 0x63, 0xF7, 0x13, 0xF4, 0x6E, 0x33, 0x76, 0x3D, 0xF1, 0x7F, 0x7C, 0x7F,
+    0x01, 0x6D, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xBB, 0x13, 0x67, 0x95, 0x0C, 0x62, 0x5C,
+    0x24, 0x52, 0xA4, 0x60, 0x86, 0x32, 0x8A, 0xE2, 0x3B, 0x8A, 0x14, 0x2E, 0xF6, 0x6E, 0x07, 0xBB,
+    0x48, 0x99, 0x14, 0x09, 0x0D, 0x05, 0xB4, 0x34, 0x11, 0x85, 0x0B, 0x17, 0x77, 0xDC, 0x12, 0x4A,
+    0x0A, 0xFC, 0x1F, 0x40, 0x41, 0x81, 0x22, 0x0A, 0x17, 0x2E, 0x0E, 0x71, 0x89, 0xC7, 0x89, 0x44,
+    0x0A, 0x8A, 0x2C, 0xA1, 0x48, 0x41, 0xC1, 0x46, 0xA6, 0x02, 0xA1, 0x4C, 0xC8, 0x22, 0x2E, 0x62,
+    0x7D, 0xC3, 0x9B, 0xDD, 0x75, 0x12, 0x44, 0x46, 0xA7, 0xDB, 0xF9, 0xE6, 0xC7, 0xFB, 0xDE, 0x9B,
+    0x7D, 0xDF, 0x2C, 0xD0, 0x36, 0xED, 0x90, 0xE4, 0x80, 0xF4, 0x16, 0x8E, 0x61, 0x95, 0x62, 0xC0,
+    0x47, 0x4F, 0x14, 0x92, 0xA3, 0xC2, 0x0E, 0xA2, 0x30, 0x3A, 0x12, 0x36, 0xE5, 0x23, 0xC9, 0x53,
+    0x65, 0xF8, 0x9C, 0x26, 0x77, 0x4A, 0x3E, 0xA4, 0xD9, 0x1D, 0x5D, 0x37, 0xC7, 0xCB, 0xA9, 0x52,
+    0xFA, 0x50, 0xF8, 0x7B, 0x77, 0x0F, 0x1E, 0x3E, 0x70, 0xB3, 0x71, 0x56, 0x4F, 0x2B, 0xA5, 0xE3,
+    0x72, 0xA1, 0x15, 0xFE, 0x2C, 0x7B, 0x10, 0x77, 0x4A, 0x95, 0xC6, 0x05, 0xAA, 0xD5, 0xE8, 0xA9,
+    0x1D, 0x04, 0xE8, 0x1E, 0xF1, 0x12, 0x9B, 0x8A, 0x87, 0xF9, 0x08, 0x8E, 0xD0, 0x5B, 0xD2, 0x0C,
+    0x30, 0x50, 0x97, 0xF6, 0x9D, 0xCC, 0xA3, 0x7F, 0x5C, 0x76, 0x8B, 0x49, 0xE5, 0x3C, 0xF2, 0x21,
+    0xD7, 0x31, 0x44, 0x06, 0x2F, 0x5A, 0xE4, 0x81, 0xAD, 0xA6, 0x77, 0xC4, 0x18, 0x50, 0x1B, 0x56,
+    0x14, 0x4D, 0xAF, 0xA3, 0xCD, 0x96, 0x8A, 0x42, 0xB7, 0x3B, 0x3A, 0xEE, 0x6C, 0x5B, 0xC2, 0x56,
+    0x6D, 0xAF, 0x13, 0xC0, 0xB6, 0x2B, 0x2F, 0x7D, 0xFF, 0x2B, 0xAE, 0x43, 0x6E, 0x77, 0x2A, 0xEC,
+    0xA4, 0x1A, 0x0D, 0x07, 0xE3, 0xBE, 0xBC, 0x57, 0x54, 0xB3, 0x4E, 0xCA, 0x41, 0x99, 0xAA, 0x47,
+    0xCE, 0xA9, 0x5E, 0x7C, 0x40, 0xAC, 0x56, 0xCF, 0xC3, 0x3C, 0x85, 0x5A, 0x2F, 0x74, 0x2A, 0x7E,
+    0xA6, 0x8A, 0x56, 0xD4, 0x7D, 0xB3, 0x15, 0xD2, 0x0D, 0xB6, 0x92, 0xFB, 0x66, 0xB7, 0x53, 0x76,
+    0xD9, 0x38, 0x51, 0x88, 0xA2, 0x1A, 0x69, 0xB9, 0x5E, 0x76, 0xF2, 0x92, 0xC7, 0x96, 0xE4, 0xF6,
+    0x72, 0x5D, 0xC5, 0x1E, 0xAD, 0x46, 0x60, 0x99, 0x54, 0x31, 0x8F, 0xB8, 0x3A, 0xC9, 0x15, 0x56,
+    0x70, 0x8E, 0xB1, 0xC6, 0x50, 0xE5, 0x5A, 0x5A, 0xB5, 0x51, 0x24, 0x37, 0x4A, 0x61, 0x5D, 0x54,
+    0x6C, 0xE2, 0xCB, 0x66, 0x86, 0x83, 0x9F, 0x96, 0x55, 0xE4, 0x66, 0x7D, 0x9E, 0xDC, 0x86, 0xE5,
+    0xF4, 0x14, 0x2E, 0xE5, 0xC6, 0x64, 0xBD, 0x88, 0x73, 0xAE, 0x19, 0xA8, 0x4F, 0x18, 0xC7, 0xC5,
+    0xDA, 0xC9, 0x81, 0x16, 0x8F, 0x9C, 0x56, 0xC6, 0x4D, 0x55, 0x92, 0xEF, 0xA6, 0xE2, 0x86, 0x3D,
+    0x77, 0x66, 0xA0, 0xD5, 0xC6, 0x23, 0x37, 0xD7, 0xEA, 0x92, 0x75, 0xD3, 0x54, 0x25, 0x9F, 0xDA,
+    0xDD, 0x74, 0x55, 0xDC, 0xD8, 0x2F, 0xCF, 0x9D, 0x39, 0x11, 0xD8, 0xAC, 0x22, 0xAA, 0xA1, 0x76,
+    0xB0, 0x53, 0x24, 0x1B, 0x79, 0x2A, 0x85, 0x7D, 0x63, 0x15, 0x17, 0x4B, 0x1E, 0xF8, 0x32, 0x46,
+    0x91, 0x4B, 0x0A, 0x6D, 0x3E, 0xC6, 0x8C, 0x56, 0xE9, 0x43, 0x19, 0x99, 0x0B, 0x0B, 0xC4, 0x08,
+    0x4F, 0x51, 0xF2, 0xDD, 0xCD, 0x31, 0x8B, 0xE6, 0x61, 0xCD, 0x00, 0x9B, 0xCF, 0xDF, 0x9C, 0x41,
+    0x85, 0x63, 0x03, 0xE8, 0x5C, 0xFC, 0x58, 0x45, 0x15, 0x38, 0x1F, 0x61, 0x08, 0x6D, 0xA0, 0x72,
+    0x8C, 0x21, 0x4A, 0x84, 0x41, 0x7A, 0xAC, 0x18, 0x06, 0x57, 0x5E, 0xCE, 0x09, 0x3E, 0x29, 0xC5,
+    0xEF, 0x25, 0x79, 0x64, 0x63, 0x64, 0x85, 0x78, 0x62, 0xD4, 0x17, 0xE6, 0x18, 0x57, 0x8E, 0xB9,
+    0x60, 0xCE, 0xD5, 0xDC, 0x9E, 0x14, 0x61, 0xBB, 0x36, 0xDC, 0x4E, 0x90, 0x39, 0x88, 0x4C, 0xCC,
+    0x3C, 0xD9, 0xCF, 0xA3, 0x39, 0xCE, 0x00, 0x4B, 0x21, 0x73, 0x16, 0xCD, 0xA3, 0xB9, 0x2C, 0x64,
+    0xD1, 0x27, 0xDD, 0x1A, 0xB5, 0x28, 0x45, 0xA9, 0x72, 0x65, 0xC6, 0x18, 0xC5, 0x2E, 0x76, 0xCA,
+    0xAA, 0x7C, 0xC8, 0x6C, 0x15, 0x5C, 0x42, 0x5B, 0x6A, 0xBC, 0x89, 0x29, 0x76, 0x3B, 0x47, 0xB1,
+    0x9D, 0x8A, 0x72, 0xE1, 0xB4, 0xD5, 0x76, 0x0F, 0x13, 0xA2, 0x5E, 0x69, 0xFD, 0x78, 0xDC, 0xDB,
+    0xCC, 0x57, 0xBD, 0x67, 0x75, 0x54, 0xCD, 0x62, 0x47, 0xA0, 0x91, 0x28, 0x6B, 0x4A, 0x13, 0x3F,
+    0x94, 0xC9, 0xE3, 0x5C, 0x1E, 0x42, 0x56, 0x50, 0x96, 0xA7, 0x03, 0x75, 0x04, 0x44, 0x3E, 0x13,
+    0xBE, 0x76, 0xE0, 0x16, 0x41, 0x3B, 0x0F, 0xFB, 0xA7, 0xDE, 0x37, 0xA6, 0x7C, 0x1B, 0x78, 0xED,
+    0x22, 0xB0, 0x76, 0x01, 0x70, 0x0A, 0x24, 0xF2, 0xDB, 0x6D, 0xAE, 0xED, 0x5C, 0xDA, 0x5F, 0x20,
+    0x7A, 0xF6, 0x9E, 0x65, 0xA1, 0xBA, 0x15, 0xE0, 0x22, 0xD7, 0x5D, 0xF8, 0xA0, 0xC1, 0x8B, 0xE8,
+    0xF6, 0x35, 0xE2, 0xB0, 0x47, 0xBE, 0x69, 0xD3, 0x03, 0x37, 0x11, 0x25, 0x31, 0x4D, 0x6F, 0x95,
+    0x55, 0xCC, 0xA9, 0x05, 0xB0, 0xB2, 0x03, 0xF1, 0x19, 0xB0, 0xF3, 0x11, 0x5E, 0x4F, 0x8C, 0xB0,
+    0x6B, 0xD8, 0x14, 0x39, 0x5E, 0x2E, 0xAD, 0xB6, 0x9A, 0x98, 0xBB, 0x7D, 0xF6, 0xDA, 0x88, 0x4E,
+    0x6E, 0x28, 0x3C, 0x68, 0x87, 0xCF, 0xFA, 0x77, 0xB7, 0xDB, 0x42, 0x6C, 0xCA, 0x13, 0xF2, 0xAF,
+    0x0F, 0x9B, 0xF1, 0x6F, 0x5B, 0xAA, 0xF2, 0x6E, 0xBB, 0x6C, 0xA6, 0xDA, 0xAA, 0xE5, 0x99, 0xB3,
+    0x9D, 0x20, 0xB7, 0xD8, 0x04, 0x83, 0x23, 0x9C, 0x48, 0x93, 0x29, 0xC5, 0xB2, 0x34, 0xB4, 0xBE,
+    0x8B, 0x2A, 0xB2, 0x1D, 0x26, 0x46, 0x1E, 0x3A, 0xA2, 0x7E, 0x83, 0x68, 0xCF, 0xCF, 0xA1, 0xBD,
+    0x47, 0xB6, 0x57, 0xF0, 0x84, 0x6A, 0xF1, 0x07, 0x57, 0x7F, 0x47, 0x93, 0x50, 0x9E, 0xFA, 0x1C,
+    0x49, 0xC9, 0xDD, 0x75, 0x0F, 0xFD, 0xB8, 0x24, 0xD5, 0x11, 0xDE, 0x22, 0xDF, 0xA5, 0xE0, 0x1C,
+    0x26, 0x01, 0x93, 0x64, 0x8B, 0xEC, 0xF0, 0xF4, 0xD5, 0xD0, 0x0F, 0x6F, 0x70, 0x16, 0xCC, 0x84,
+    0xF6, 0x0C, 0xC2, 0x22, 0xF4, 0x8F, 0x14, 0x56, 0x9D, 0xC4, 0x26, 0x08, 0x84, 0xC2, 0xBD, 0x17,
+    0x6E, 0x8F, 0x8E, 0x5D, 0xC3, 0x14, 0x71, 0x90, 0xD5, 0xD0, 0x3E, 0x02, 0x99, 0xB6, 0x77, 0xCE,
+    0x22, 0xFC, 0xF4, 0xD5, 0x80, 0x37, 0x6C, 0xF6, 0xA6, 0xCD, 0xBA, 0x59, 0x93, 0xA5, 0x0A, 0x66,
+    0x8E, 0xBC, 0x8D, 0x3D, 0x0B, 0x22, 0x6C, 0x63, 0x12, 0x69, 0x83, 0x55, 0x83, 0x1F, 0x4C, 0x60,
+    0xC4, 0x7D, 0xD9, 0x55, 0x64, 0x73, 0x9C, 0xFF, 0x8A, 0x69, 0x1B, 0xB4, 0xA5, 0xF1, 0xFF, 0x50,
+    0x5C, 0xF8, 0x91, 0x03, 0xCB, 0xCA, 0x17, 0x04, 0x7C, 0x09, 0x05, 0x1D, 0xCA, 0x51, 0xF6, 0xD3,
+    0xB3, 0x23, 0x34, 0xB4, 0xFE, 0xDC, 0x8E, 0x7D, 0x49, 0x8B, 0x6A, 0x5F, 0xF7, 0xD6, 0x6B, 0xF5,
+    0xCE, 0x61, 0x03, 0x3B, 0x6C, 0xF0, 0xB3, 0xE6, 0x9F, 0xFD, 0x3A, 0x6C, 0x0E, 0xA5, 0x54, 0x43,
+    0x32, 0x4B, 0x85, 0x3E, 0xAB, 0xA9, 0x08, 0x6E, 0x99, 0x84, 0x88, 0x76, 0x27, 0x73, 0x4A, 0x60,
+    0x42, 0x76, 0x54, 0x7B, 0x40, 0x2F, 0xB5, 0xB6, 0xC4, 0xE8, 0xEA, 0xCC, 0x04, 0x63, 0xF3, 0xFF,
+    0x56, 0x83, 0x7E, 0x2A, 0x5C, 0x6A, 0x6D, 0x3B, 0xBB, 0x30, 0xF2, 0x27, 0x9A, 0x25, 0x93, 0xDB,
+    0x7B, 0x21, 0xDF, 0x2C, 0x94, 0xBA, 0xD3, 0x01, 0x90, 0x7A, 0xB3, 0x98, 0x12, 0x2B, 0x16, 0x4A,
+    0x9F, 0x35, 0x18, 0xB3, 0x80, 0x91, 0xE5, 0x89, 0x0D, 0x44, 0x82, 0xBC, 0x29, 0x63, 0xDE, 0x9E,
+    0xF6, 0x45, 0x0D, 0x35, 0x96, 0x5F, 0x82, 0xB6, 0xB8, 0xCD, 0x84, 0xA2, 0x8E, 0x2B, 0xC8, 0x22,
+    0x32, 0xCF, 0xB3, 0xB1, 0xE6, 0x58, 0x2C, 0x49, 0x39, 0xF1, 0x2E, 0xAE, 0x94, 0x59, 0x04, 0xCD,
+    0xCA, 0x92, 0x91, 0x70, 0x3C, 0x37, 0xD6, 0x3E, 0x5F, 0x61, 0xF3, 0x4D, 0xCB, 0xC2, 0x4C, 0x66,
+    0x86, 0xE1, 0x8F, 0xEA, 0x28, 0xD7, 0xF2, 0x40, 0x38, 0x33, 0x0C, 0x1F, 0x18, 0x1D, 0x0A, 0xE7,
+    0xBF, 0x5A, 0xAF, 0x04, 0x51, 0x75, 0x90, 0x38, 0x81, 0x2A, 0xC8, 0x40, 0xB8, 0xF0, 0x69, 0xE2,
+    0xB5, 0x7D, 0xFE, 0xE6, 0xCD, 0xAF, 0xBD, 0xF7, 0x4F, 0xAE, 0x5D, 0x7B, 0x3F, 0x6F, 0x0E, 0x39,
+    0x24, 0xC9, 0x5A, 0x23, 0xA9, 0x76, 0x84, 0xF7, 0x54, 0x00, 0x8E, 0xBB, 0x91, 0xFA, 0xF9, 0x48,
+    0x70, 0x15, 0x6F, 0x00, 0xE5, 0xFD, 0x3C, 0xD5, 0xBE, 0x72, 0x13, 0xFF, 0x74, 0xDF, 0xFB, 0xFB,
+    0x89, 0xF7, 0x23, 0xED, 0x0F, 0x19, 0xFE, 0xCD, 0xF0, 0x97, 0x36, 0xAC, 0x19, 0x1E, 0x30, 0x54,
+    0x89, 0x2F, 0xD3, 0x95, 0x65, 0xB8, 0x4D, 0x88, 0x7D, 0x5E, 0x80, 0xAC, 0xF4, 0x94, 0xD7, 0xC2,
+    0xAB, 0xC3, 0x93, 0xB1, 0xC1, 0xAB, 0xDA, 0xBF, 0xB5, 0x55, 0x3F, 0x6C, 0x5B, 0x45, 0x18, 0xFF,
+    0xDD, 0x5D, 0xE8, 0x83, 0x3C, 0xD0, 0x31, 0x64, 0x28, 0x52, 0xEB, 0xC7, 0x90, 0x09, 0xF9, 0x0F,
+    0x43, 0x87, 0x0C, 0xCF, 0x7E, 0x57, 0x18, 0xD8, 0x68, 0x25, 0x88, 0x90, 0xDA, 0x85, 0x39, 0x4B,
+    0x18, 0x32, 0x04, 0x29, 0x89, 0x8F, 0x74, 0xE8, 0x48, 0x84, 0xC4, 0xC4, 0x92, 0x21, 0x03, 0x78,
+    0x49, 0x06, 0x0F, 0x19, 0x12, 0xFB, 0x4A, 0x84, 0x32, 0xF2, 0x40, 0x42, 0x0C, 0x1D, 0x38, 0xDA,
+    0x01, 0x09, 0x24, 0x38, 0x90, 0x0B, 0x4E, 0x78, 0xF6, 0xF1, 0x9D, 0x9D, 0xA6, 0x01, 0xA5, 0x69,
+    0x50, 0xD5, 0x3B, 0x7D, 0x77, 0x9F, 0xEF, 0x7D, 0xFF, 0xFF, 0x19, 0x73, 0xAD, 0xCF, 0x85, 0xF7,
+    0x85, 0xF4, 0x07, 0x4B, 0x35, 0xDF, 0x2B, 0x67, 0x04, 0xCD, 0x53, 0x20, 0x3B, 0x82, 0x84, 0x20,
+    0x26, 0x7A, 0x74, 0x7D, 0x31, 0xD7, 0xDA, 0x40, 0xD3, 0x7B, 0xFD, 0x61, 0xD3, 0xDB, 0x05, 0xFA,
+    0x48, 0xD0, 0x27, 0x28, 0x1E, 0x03, 0xE1, 0xBB, 0x23, 0x7A, 0xD3, 0xF4, 0x07, 0x18, 0xAD, 0xD8,
+    0x00, 0x55, 0xBA, 0x7B, 0xA8, 0x08, 0x03, 0xFF, 0x36, 0xD0, 0x3D, 0xB8, 0x81, 0x88, 0xA4, 0x67,
+    0x5F, 0xAD, 0x8B, 0xBB, 0x0A, 0x8D, 0x12, 0x84, 0x4B, 0x11, 0xA1, 0x0F, 0x70, 0x3B, 0x66, 0x42,
+    0x94, 0x67, 0x7A, 0x70, 0xFC, 0xEB, 0x68, 0xBD, 0x2B, 0xAC, 0xD4, 0x0D, 0xF4, 0xB9, 0x8D, 0xF5,
+    0xE5, 0x87, 0x8F, 0xB5, 0x21, 0xC0, 0x0E, 0x6E, 0x1A, 0x44, 0x1A, 0x0E, 0xF4, 0x7C, 0x85, 0x36,
+    0xCA, 0x78, 0x1F, 0xB8, 0x88, 0x67, 0xB6, 0x5E, 0x07, 0x5E, 0x0C, 0x7A, 0x66, 0x48, 0x13, 0xA9,
+    0x95, 0x88, 0xC8, 0x80, 0x9F, 0x3B, 0xF4, 0xA5, 0x7B, 0x6C, 0x34, 0x3D, 0x81, 0x3B, 0x42, 0xDA,
+    0x60, 0x39, 0x91, 0xF9, 0x6B, 0xF4, 0xE6, 0x3F, 0xDD, 0xA0, 0x63, 0x00, 0x5E, 0xDC, 0x80, 0xF8,
+    0x49, 0x91, 0xEB, 0x8E, 0xA0, 0x4E, 0x66, 0x87, 0x40, 0xB1, 0x13, 0x1E, 0x3F, 0x15, 0x3B, 0xEB,
+    0xF1, 0xBB, 0x56, 0xD6, 0xD4, 0xF6, 0x94, 0xC8, 0x91, 0x00, 0xDB, 0xA0, 0xE0, 0x27, 0x21, 0x0B,
+    0x24, 0xB6, 0x1A, 0x4C, 0xA6, 0xBB, 0x1E, 0xEE, 0x58, 0x23, 0x05, 0x23, 0x17, 0xD4, 0x72, 0xCA,
+    0x0F, 0x6D, 0x94, 0x07, 0xF6, 0xEE, 0x06, 0x1D, 0x79, 0xD3, 0x0F, 0x15, 0xCA, 0x89, 0x9A, 0xF7,
+    0x1B, 0xC9, 0x2D, 0x83, 0x0B, 0xDE, 0xDB, 0x69, 0x7A, 0x9F, 0x5B, 0x27, 0xF9, 0xD7, 0x29, 0xF2,
+    0x5E, 0xB1, 0x83, 0x88, 0x72, 0x81, 0x2D, 0x0A, 0xFB, 0x0C, 0x45, 0xE3, 0xD2, 0xAB, 0xC0, 0xF3,
+    0x60, 0x9A, 0x0C, 0x37, 0x10, 0x6F, 0x18, 0x2B, 0xBE, 0xDD, 0xB3, 0xF8, 0xF3, 0x6B, 0x8D, 0x8C,
+    0xB2, 0x94, 0x0C, 0x90, 0x79, 0x3F, 0x7C, 0x6D, 0x73, 0xF8, 0x05, 0xB2, 0x01, 0x70, 0xF8, 0x83,
+    0x12, 0xF7, 0xF6, 0xF3, 0x68, 0xF5, 0x8E, 0x63, 0xDC, 0x8C, 0x78, 0x8E, 0x57, 0x9C, 0x43, 0x50,
+    0x3D, 0xEC, 0x9E, 0x12, 0x7A, 0x61, 0xC1, 0x0A, 0x60, 0x85, 0x8C, 0x38, 0x35, 0x35, 0x4B, 0x40,
+    0xA6, 0x83, 0x00, 0x5C, 0xC7, 0x52, 0x12, 0x7F, 0xE9, 0x84, 0xED, 0xD7, 0xA5, 0x22, 0xCC, 0x6E,
+    0xA3, 0x57, 0x97, 0xC2, 0x44, 0xAB, 0xB6, 0x5D, 0x41, 0x4A, 0x98, 0x63, 0xF9, 0x42, 0x39, 0xC6,
+    0x24, 0xD7, 0x6B, 0xD3, 0x0F, 0xF9, 0x79, 0x2F, 0x9C, 0x99, 0xC2, 0x51, 0xF8, 0x9F, 0xB4, 0xEA,
+    0xC1, 0xDC, 0xFD, 0x40, 0x39, 0x58, 0x09, 0xE8, 0x37, 0x81, 0xF3, 0xE5, 0x33, 0x59, 0x98, 0x7B,
+    0xA4, 0x62, 0xA4, 0xED, 0xB9, 0x13, 0xCE, 0x01, 0xCB, 0xCD, 0x20, 0xE7, 0xFE, 0x08, 0x3D, 0x5B,
+    0xB7, 0x1A, 0x75, 0x40, 0x38, 0x43, 0xB4, 0x28, 0xC4, 0xEA, 0xC9, 0xF6, 0x8A, 0x90, 0xE1, 0x9D,
+    0xA0, 0x42, 0x7E, 0x1F, 0xEC, 0x28, 0xA6, 0x82, 0x45, 0xD4, 0x87, 0xCD, 0x95, 0xA9, 0x7F, 0x11,
+    0x4E, 0x34, 0x9A, 0x8D, 0x09, 0xF0, 0x40, 0x5E, 0x04, 0x73, 0x09, 0x2E, 0x3C, 0x46, 0x3E, 0xD9,
+    0xCF, 0xDE, 0x72, 0xE0, 0x0F, 0x88, 0x70, 0xD8, 0x40, 0xA8, 0xB4, 0x53, 0xD7, 0x44, 0xD0, 0x4A,
+    0x69, 0x16, 0xEE, 0x48, 0xE8, 0xC4, 0xB1, 0xF7, 0xE3, 0x66, 0x0F, 0x93, 0xA2, 0xCE, 0xAD, 0x54,
+    0xB1, 0xAD, 0xF2, 0x02, 0x1D, 0x6E, 0x13, 0xCD, 0x75, 0x15, 0xEB, 0x27, 0x09, 0x46, 0xE8, 0x5C,
+    0xAB, 0xDB, 0x6A, 0x7D, 0xEC, 0x69, 0x15, 0xAD, 0x80, 0xEA, 0xFF, 0x12, 0x30, 0x55, 0xA5, 0x0A,
+    0x58, 0xE1, 0xB6, 0x16, 0x84, 0x51, 0x7C, 0x48, 0x6E, 0x72, 0x92, 0x00, 0x78, 0x25, 0x64, 0x6A,
+    0x77, 0xD8, 0x19, 0xE5, 0x7E, 0x69, 0x38, 0x5C, 0x0A, 0xF7, 0x54, 0x67, 0xB8, 0x3B, 0x05, 0xB9,
+    0xFF, 0x7B, 0x51, 0xA1, 0x00, 0x17, 0x4D, 0x79, 0x67, 0x0D, 0x13, 0x72, 0xBF, 0x57, 0x5C, 0x04,
+    0x5B, 0x2B, 0x9A, 0xD7, 0x0C, 0xC5, 0xA0, 0x39, 0xE0, 0x7A, 0xBC, 0x1F, 0x61, 0x67, 0xED, 0xC0,
+    0xF1, 0xC1, 0x4B, 0xE3, 0x7D, 0x5E, 0x8E, 0xAC, 0xA8, 0xF5, 0xA5, 0x8B, 0x72, 0x61, 0xCE, 0x43,
+    0x1F, 0x38, 0x98, 0xA2, 0xDA, 0xCE, 0xA5, 0xAB, 0xF5, 0xB3, 0xE2, 0x7C, 0x1C, 0x5C, 0xC7, 0x76,
+    0xA6, 0x3C, 0x53, 0x8E, 0xED, 0xF9, 0xB4, 0x90, 0x1F, 0xFA, 0x7F, 0x7A, 0xDE, 0x55, 0x59, 0x41,
+    0xAD, 0xE7, 0x64, 0x09, 0x7F, 0xE4, 0x32, 0x65, 0xF7, 0x4D, 0x25, 0x15, 0x7B, 0x26, 0xAD, 0xCB,
+    0xAB, 0x7F, 0xDB, 0x78, 0x54, 0xB5, 0x70, 0xD3, 0x88, 0x84, 0xB1, 0x57, 0x2E, 0xC5, 0x74, 0x2E,
+    0xD0, 0xD8, 0xE6, 0x6B, 0xD8, 0x41, 0x62, 0xA2, 0x1D, 0xFC, 0xA5, 0xD3, 0xB6, 0x94, 0x3C, 0x77,
+    0x2B, 0xDD, 0xCF, 0x68, 0xEE, 0x55, 0xC2, 0x1C, 0x9B, 0x01, 0x5A, 0xEB, 0xB5, 0xE1, 0x08, 0x8B,
+    0x14, 0x7C, 0x1E, 0x77, 0x15, 0xB5, 0x3D, 0xFD, 0x4E, 0x11, 0xBF, 0xF9, 0x8B, 0xAB, 0x8D, 0x7A,
+    0x6A, 0x5E, 0x67, 0x85, 0xD4, 0x54, 0xBE, 0xF4, 0xDF, 0xB2, 0x69, 0x3A, 0xF3, 0x52, 0x3B, 0x27,
+    0x25, 0x5C, 0xBB, 0x14, 0xFD, 0x66, 0x92, 0x90, 0xFF, 0xC9, 0xD6, 0x27, 0x24, 0x92, 0x06, 0xA1,
+    0xA3, 0xA2, 0x20, 0xEE, 0x1E, 0xD5, 0x2D, 0x5D, 0xDB, 0xE1, 0xCA, 0xB1, 0x18, 0xE6, 0xA0, 0xCA,
+    0x06, 0xF1, 0x47, 0xD6, 0x95, 0xE2, 0xD5, 0xBC, 0xD1, 0x13, 0x03, 0xF6, 0xC0, 0xA5, 0xD1, 0x6D,
+    0x9D, 0x2E, 0xC6, 0xB7, 0x0E, 0xDD, 0xD8, 0xF8, 0x0E, 0x25, 0x4A, 0xAE, 0xE6, 0xAE, 0x54, 0x62,
+    0x3F, 0xDA, 0xAA, 0xBC, 0x99, 0x77, 0x07, 0x78, 0xC7, 0xD0, 0xD0, 0xAE, 0x89, 0x4D, 0x93, 0x85,
+    0xE6, 0x61, 0x9A, 0x1B, 0x6E, 0xDE, 0xFB, 0xCE, 0x7B, 0x0A, 0x32, 0x6D, 0xA6, 0x66, 0x67, 0xBD,
+    0x0F, 0xBC, 0xDE, 0xCF, 0xCE, 0x92, 0x92, 0x61, 0x97, 0xA6, 0x23, 0xCF, 0xAB, 0xCC, 0x49, 0x2C,
+    0x8A, 0x9C, 0x0E, 0x66, 0x63, 0x55, 0xC1, 0x02, 0xA3, 0xB4, 0xC4, 0xA3, 0x1E, 0x89, 0x94, 0x24,
+    0x3F, 0xDA, 0x3C, 0x0F, 0xEF, 0x5B, 0xC2, 0x24, 0x68, 0x0B, 0x53, 0x61, 0x56, 0x52, 0x89, 0xBF,
+    0x50, 0xD3, 0xBF, 0x2E, 0x27, 0x57, 0xEF, 0xD9, 0xCB, 0x29, 0xDF, 0x23, 0xDB, 0xC4, 0x6D, 0xB5,
+    0xB0, 0x15, 0x4F, 0x86, 0x7F, 0xC0, 0xF1, 0xFA, 0x07, 0x95, 0x55, 0x4D, 0x8C, 0x14, 0x45, 0x14,
+    0xFE, 0xAA, 0x2A, 0x58, 0x09, 0x1D, 0xB6, 0x3C, 0xF8, 0x13, 0x81, 0xDD, 0xBE, 0x70, 0x20, 0x71,
+    0x76, 0xE7, 0xC2, 0x61, 0x0E, 0xDD, 0xD3, 0x05, 0x24, 0x92, 0xC8, 0x01, 0x0E, 0x6E, 0x3C, 0x68,
+    0x22, 0x47, 0x13, 0xA3, 0xEC, 0x61, 0x62, 0x36, 0x3A, 0x30, 0xB5, 0xE1, 0xE8, 0x61, 0x89, 0xD1,
+    0x93, 0x89, 0x72, 0xD0, 0x44, 0x20, 0x91, 0x39, 0x6C, 0xCC, 0x10, 0x96, 0x9D, 0xDA, 0xE5, 0xC0,
+    0xC1, 0x44, 0xCB, 0xE0, 0xCF, 0x81, 0x03, 0xED, 0x4F, 0xD4, 0xB8, 0x09, 0x94, 0xB1, 0x95, 0x61,
+    0x19, 0xA6, 0x7C, 0xD5, 0x4B, 0xC4, 0xAB, 0xBD, 0xD9, 0xCA, 0x74, 0xBD, 0x57, 0xEF, 0x7D, 0xEF,
+    0x7B, 0xDF, 0xAB, 0xC6, 0x1A, 0x7A, 0x63, 0x75, 0x78, 0xBD, 0x9C, 0xCD, 0xF9, 0x0D, 0x3B, 0xDB,
+    0x15, 0xDF, 0x9B, 0x6C, 0x51, 0x5C, 0x37, 0x83, 0x2C, 0x15, 0xC1, 0xA9, 0x0A, 0xF4, 0xEC, 0x4F,
+    0xCA, 0x70, 0xEC, 0x75, 0x78, 0x61, 0x67, 0xB0, 0x22, 0xAC, 0x42, 0x97, 0x95, 0x89, 0x46, 0xCF,
+    0xA8, 0x60, 0xF6, 0x29, 0x20, 0x03, 0x3C, 0x68, 0x63, 0x80, 0xC4, 0xD0, 0xA2, 0x34, 0x2A, 0xA8,
+    0xE0, 0x7B, 0xC1, 0x60, 0x18, 0x7D, 0x1E, 0x7F, 0xE8, 0xC3, 0x4E, 0x22, 0x2D, 0xC1, 0x3D, 0x84,
+    0x85, 0x3A, 0x88, 0xAE, 0xBA, 0xE8, 0x9A, 0x0F, 0x62, 0x02, 0x70, 0x83, 0x31, 0x9A, 0x56, 0x0E,
+    0xD8, 0xA6, 0x6E, 0x79, 0xA5, 0xC4, 0x7A, 0xB9, 0x36, 0x5C, 0x0E, 0x63, 0x3A, 0x46, 0xBE, 0x8B,
+    0xE0, 0x17, 0x4C, 0x31, 0x96, 0x9A, 0xD2, 0x28, 0xB0, 0x60, 0x66, 0x86, 0x0F, 0x33, 0xF6, 0x75,
+    0xAA, 0x2E, 0xB9, 0x5E, 0x19, 0x63, 0xEC, 0x71, 0xE9, 0x03, 0xE9, 0x68, 0x7F, 0x06, 0xE2, 0x56,
+    0x59, 0x7C, 0x74, 0xC6, 0x66, 0x5D, 0x71, 0xCD, 0x2C, 0x66, 0xEA, 0xD0, 0xFD, 0x32, 0x19, 0x91,
+    0xC7, 0x63, 0x17, 0xCE, 0x15, 0xC1, 0x62, 0x16, 0x2C, 0xC6, 0x21, 0xA4, 0x14, 0x3B, 0xFF, 0xF7,
+    0x45, 0x46, 0x0B, 0x50, 0xF3, 0x71, 0xC8, 0xF9, 0x59, 0x25, 0xEC, 0x69, 0x2F, 0xC7, 0xFC, 0x6F,
+    0xBF, 0x98, 0x1C, 0xD5, 0x83, 0x15, 0x75, 0x64, 0xD3, 0xA7, 0x31, 0x0C, 0xBB, 0x8C, 0xDE, 0x48,
+    0x89, 0x0D, 0x37, 0x9B, 0x11, 0x65, 0x59, 0xF3, 0x15, 0x1B, 0x56, 0xD9, 0x11, 0x43, 0x99, 0xF3,
+    0x9D, 0x43, 0x33, 0x34, 0x11, 0xCC, 0x59, 0x1C, 0xC0, 0x2E, 0xBC, 0xF8, 0x7E, 0x11, 0x4C, 0x8B,
+    0x7E, 0x08, 0x0D, 0x8D, 0x27, 0xE7, 0x8F, 0x85, 0x1A, 0xA9, 0x0A, 0x3F, 0xCC, 0xBF, 0x00, 0x14,
+    0x61, 0x39, 0x38, 0x10, 0x88, 0x8C, 0x3B, 0x15, 0x89, 0x7D, 0xC8, 0x6E, 0x06, 0xCF, 0xAD, 0xD4,
+    0x0A, 0x4F, 0x44, 0xE7, 0x3E, 0x3A, 0xB4, 0xF3, 0xE8, 0x6F, 0x11, 0x2B, 0xC4, 0x64, 0x29, 0x6C,
+    0xA2, 0x67, 0xC8, 0x83, 0x7D, 0x7A, 0x62, 0xED, 0xF6, 0x8C, 0xB8, 0x61, 0x1B, 0x1D, 0xFE, 0x05,
+    0x5A, 0x7D, 0xF9, 0x0E, 0xAA, 0xFC, 0x6D, 0x36, 0x3A, 0xC1, 0x2E, 0xF3, 0xCD, 0x75, 0xD7, 0xF1,
+    0x8D, 0xB7, 0xAE, 0x36, 0x3F, 0x4E, 0xC0, 0x1C, 0xF2, 0x97, 0xF9, 0x84, 0xFC, 0xB1, 0x56, 0x4D,
+    0x13, 0x2F, 0x7B, 0x3B, 0xEC, 0x0B, 0x34, 0xFA, 0xE2, 0xBA, 0x5E, 0xC9, 0xDF, 0xC0, 0x50, 0x73,
+    0xBD, 0x9F, 0xDB, 0x3E, 0x7E, 0x74, 0xB8, 0xA2, 0x89, 0x15, 0x74, 0xC1, 0x6E, 0x43, 0xBC, 0x03,
+    0x25, 0x4C, 0x83, 0x59, 0x3E, 0x10, 0x17, 0x2D, 0x5A, 0xC4, 0xD4, 0x4B, 0x1B, 0xE1, 0x47, 0xD7,
+    0x29, 0xB3, 0xBC, 0x2B, 0x46, 0x60, 0x9A, 0xF6, 0xA8, 0xB8, 0x05, 0x24, 0xBB, 0xF5, 0xE6, 0x55,
+    0xA5, 0x7F, 0x28, 0x77, 0x35, 0x18, 0x81, 0x69, 0x51, 0x5C, 0x02, 0xF3, 0x3C, 0x16, 0x6A, 0x17,
+    0x59, 0xBB, 0x30, 0x53, 0xAE, 0x4C, 0xCD, 0xB2, 0x9B, 0x7A, 0xCE, 0x89, 0x3B, 0x68, 0x75, 0xE4,
+    0x61, 0xDB, 0x9F, 0xDD, 0x89, 0x92, 0xE9, 0xF2, 0xC0, 0xDE, 0x44, 0xD8, 0xB2, 0xD3, 0x50, 0x62,
+    0xC9, 0x2D, 0x34, 0xB0, 0x63, 0x37, 0x3F, 0x37, 0x75, 0xE5, 0xCB, 0x55, 0x75, 0xB0, 0x6A, 0xCC,
+    0xB0, 0xB2, 0xD1, 0xE0, 0x36, 0xCB, 0x84, 0x6D, 0xB5, 0x84, 0x39, 0xD0, 0x91, 0x7A, 0x61, 0x21,
+    0x41, 0xBF, 0xBF, 0x13, 0xE7, 0xF8, 0xD1, 0xB3, 0x53, 0xF7, 0xED, 0x29, 0x79, 0xA8, 0x9C, 0x56,
+    0xE8, 0xB7, 0xC4, 0xBA, 0x9B, 0x4A, 0x74, 0x27, 0xE3, 0xB6, 0x4C, 0xC0, 0x9F, 0x33, 0xBB, 0x36,
+    0x6B, 0xDB, 0x94, 0x42, 0xA7, 0xC5, 0x5C, 0xA9, 0xA4, 0x59, 0x6C, 0x7E, 0x60, 0x7F, 0x1A, 0x09,
+    0x83, 0xE9, 0xC8, 0x2C, 0xF5, 0x1F, 0xFC, 0xBC, 0xFA, 0xAC, 0x41, 0xAF, 0xCA, 0xB0, 0x2A, 0x12,
+    0xFC, 0xC9, 0xA0, 0xE7, 0x38, 0xF6, 0xF2, 0xAD, 0x3D, 0xBF, 0x4D, 0xA3, 0x2F, 0xEC, 0x14, 0x0E,
+    0x30, 0x27, 0xDF, 0x4B, 0x5C, 0x6C, 0x06, 0xA3, 0x06, 0x92, 0x84, 0x44, 0xC5, 0x90, 0x6A, 0x90,
+    0x66, 0x41, 0x8A, 0x43, 0x13, 0x17, 0x3E, 0x1D, 0x8B, 0x70, 0xB7, 0x4C, 0xE7, 0x8F, 0x99, 0x55,
+    0x14, 0xA2, 0x04, 0x51, 0x81, 0xC9, 0xDA, 0x79, 0x84, 0x30, 0x42, 0xFA, 0xAD, 0x46, 0x9B, 0x0E,
+    0xD3, 0x2C, 0x91, 0xC6, 0xC8, 0x1B, 0x18, 0x4E, 0x20, 0xC2, 0x08, 0xDB, 0x8F, 0xB8, 0x66, 0xC1,
+    0xBE, 0x76, 0x60, 0x13, 0x0F, 0x19, 0x02, 0xD4, 0xA4, 0x67, 0xD5, 0x1D, 0x05, 0x75, 0xFD, 0x88,
+    0x4E, 0x6E, 0x5C, 0xB3, 0xA2, 0x2C, 0x4B, 0xEE, 0xFB, 0x2B, 0x18, 0x67, 0x19, 0xDA, 0xD3, 0x04,
+    0xF5, 0x98, 0x82, 0xFC, 0xFE, 0x8C, 0x61, 0x7F, 0x6F, 0x38, 0xB4, 0x3D, 0xE9, 0xB7, 0xEA, 0x80,
+    0x8F, 0x69, 0xC4, 0x8A, 0x0F, 0x9F, 0x41, 0x12, 0x82, 0x11, 0x77, 0x82, 0x61, 0x5F, 0x93, 0xD8,
+    0xC8, 0x88, 0x7D, 0xFB, 0x1E, 0x26, 0x02, 0x1B, 0x8E, 0x48, 0x7C, 0x01, 0x3D, 0xF7, 0x3A, 0x68,
+    0xF0, 0x44, 0x44, 0x44, 0x4E, 0x8A, 0x50, 0x11, 0x5E, 0x42, 0xF6, 0x6E, 0x55, 0xF0, 0x5B, 0x55,
+    0x9B, 0x4F, 0x8E, 0xB7, 0xC9, 0x98, 0x53, 0x21, 0x39, 0x41, 0xCE, 0x13, 0x8B, 0xB6, 0x32, 0x28,
+    0xC8, 0x29, 0x5D, 0x8E, 0xFA, 0x7D, 0x8C, 0xE0, 0x87, 0xBA, 0x8C, 0x28, 0x81, 0x88, 0xDA, 0xF2,
+    0x40, 0xDC, 0x3C, 0x20, 0x5D, 0x93, 0x76, 0x90, 0x62, 0xBB, 0x56, 0x9A, 0x75, 0x20, 0xD6, 0x59,
+    0x6F, 0x92, 0x27, 0x81, 0xD3, 0x74, 0xD4, 0x3E, 0xDA, 0xA4, 0xFF, 0x4B, 0xBF, 0x1B, 0xF4, 0xE8,
+    0xF4, 0x8E, 0x7B, 0xC7, 0x1F, 0x6D, 0x52, 0xCE, 0x7F, 0x9F, 0x21, 0x01, 0x8D, 0x0E, 0xCA, 0x35,
+    0xB6, 0x43, 0x46, 0x3A, 0x23, 0xF3, 0xA4, 0xD2, 0x6D, 0xCF, 0xDD, 0x93, 0x0B, 0x11, 0x52, 0x89,
+    0xA7, 0xFE, 0x7A, 0x61, 0x9B, 0xE2, 0xA7, 0xE9, 0x47, 0x12, 0x33, 0xBD, 0xF6, 0xFB, 0xC7, 0xDB,
+    0x7E, 0x54, 0x41, 0x7D, 0x9A, 0x5D, 0x9D, 0x9F, 0xD7, 0x05, 0x75, 0x86, 0x0E, 0x04, 0x1D, 0xE3,
+    0xEF, 0xA8, 0xB3, 0xCC, 0xD4, 0x6B, 0x56, 0xAF, 0x2B, 0xC0, 0xB9, 0xE6, 0xD2, 0xFD, 0x12, 0x7F,
+    0x84, 0x3F, 0xC3, 0x98, 0xDD, 0xFD, 0x2E, 0xFC, 0xB5, 0x46, 0xD3, 0x13, 0x4C, 0xC1, 0x47, 0x08,
+    0x68, 0x0A, 0x4F, 0xCD, 0x8F, 0x8D, 0x1E, 0xA1, 0x2D, 0x5D, 0xE4, 0x2A, 0xB1, 0xD2, 0xD3, 0x95,
+    0x66, 0x95, 0xC7, 0xAA, 0x32, 0x4D, 0xB2, 0x28, 0xDD, 0x73, 0x18, 0xA5, 0xB8, 0x6B, 0x59, 0xD5,
+    0xE4, 0x37, 0x2D, 0xF7, 0x6D, 0xF9, 0x15, 0xAD, 0xB9, 0x52, 0x86, 0x4E, 0xCE, 0xFD, 0x27, 0x9D,
+    0x7F, 0x54, 0x2B, 0x9A, 0x34, 0xF9, 0x8A, 0xE6, 0x5B, 0x8C, 0x98, 0x67, 0x81, 0x2E, 0xA6, 0x2B,
+    0x36, 0x47, 0xEE, 0x69, 0x33, 0x93, 0xF6, 0xD9, 0x3B, 0x17, 0xB7, 0x52, 0x82, 0xBD, 0x74, 0xF9,
+    0xF2, 0x29, 0x9D, 0xCF, 0x28, 0xBC, 0xF2, 0xC1, 0xCD, 0x6F, 0x7A, 0xB4, 0xB1, 0x67, 0x6B, 0x6D,
+    0x4B, 0x0F, 0x14, 0x79, 0xF2, 0x5B, 0x34, 0xA5, 0x43, 0x2B, 0x6D, 0x4A, 0xAA, 0x91, 0x15, 0x05,
+    0x78, 0x40, 0xA4, 0x16, 0x31, 0xF2, 0xBD, 0xFA, 0xF2, 0xA1, 0x8E, 0xCB, 0x5F, 0x62, 0xE7, 0x7C,
+    0x6C, 0xFC, 0x2A, 0xC9, 0x9E, 0xF8, 0xCC, 0xA3, 0x04, 0xD2, 0xC3, 0x46, 0x5A, 0xB9, 0xE1, 0xB8,
+    0x17, 0x7F, 0x54, 0x18, 0x8B, 0xFB, 0xC1, 0xB7, 0x5F, 0xDA, 0x0A, 0x23, 0x15, 0x2A, 0x65, 0x64,
+    0x38, 0x2B, 0xC8, 0x12, 0xEF, 0xCB, 0x51, 0x24, 0x94, 0x4E, 0xCC, 0xC5, 0x9E, 0x92, 0xC5, 0xA2,
+    0xB6, 0x90, 0xC2, 0xC9, 0x52, 0x78, 0xB2, 0xC8, 0x71, 0x2C, 0xE5, 0x71, 0x7A, 0x8B, 0x39, 0xE3,
+    0xCC, 0xD0, 0x7A, 0xFA, 0x64, 0xBC, 0xFE, 0x56, 0x45, 0xAC, 0x76, 0xCC, 0x6A, 0x69, 0x10, 0x33,
+    0x3F, 0xA3, 0x62, 0x9E, 0x38, 0xF6, 0xFC, 0xCF, 0xEA, 0x55, 0x42, 0xFC, 0x93, 0x83, 0x28, 0xD3,
+    0x6B, 0x2E, 0xF6, 0x93, 0x68, 0xA2, 0x39, 0x21, 0x7A, 0xE5, 0x77, 0x1E, 0x13, 0xEA, 0x74, 0x85,
+    0xC2, 0x28, 0x43, 0x2A, 0x76, 0x4A, 0x8F, 0x21, 0x7C, 0x8A, 0x55, 0xEA, 0x69, 0x4A, 0x70, 0x44,
+    0xD9, 0x44, 0x7E, 0x22, 0x71, 0x6D, 0xB4, 0x7B, 0x81, 0x18, 0x2B, 0x9A, 0x93, 0x9A, 0x4E, 0x0D,
+    0xEE, 0xA4, 0x55, 0xBA, 0x12, 0xF4, 0xFD, 0xCA, 0xD9, 0x98, 0x97, 0xC4, 0x0E, 0x2A, 0x61, 0x0B,
+    0xDB, 0x85, 0x9F, 0xF6, 0x73, 0xC8, 0x54, 0xA6, 0xB4, 0x12, 0xCB, 0xB1, 0xF4, 0x1B, 0x1B, 0xE5,
+    0xCE, 0xAD, 0xAD, 0xAD, 0x7B, 0x51, 0x1A, 0xC1, 0x9C, 0x3C, 0x7D, 0xF2, 0xB4, 0x4E, 0x96, 0xE5,
+    0x32, 0xF8, 0xAF, 0x4B, 0xBF, 0x1A, 0x7C, 0x6E, 0xDF, 0x74, 0x98, 0xA5, 0x43, 0x48, 0x56, 0xE4,
+    0x80, 0x46, 0x8E, 0x53, 0x99, 0x13, 0x0A, 0x87, 0x42, 0x37, 0x0D, 0xCD, 0x51, 0x2D, 0xDA, 0x66,
+    0x88, 0xCD, 0x2D, 0x42, 0xA4, 0x3D, 0x47, 0x4F, 0x67, 0x84, 0x4E, 0x99, 0x6E, 0xFD, 0x89, 0x59,
+    0x45, 0xF5, 0x8C, 0xB4, 0x23, 0x54, 0x6D, 0x69, 0xA9, 0xEC, 0x3C, 0x31, 0x9E, 0xFB, 0x4C, 0x1D,
+    0xF4, 0xBC, 0xEC, 0xAA, 0x43, 0xA5, 0x70, 0x83, 0x54, 0x50, 0xEF, 0x47, 0x4D, 0x41, 0xA0, 0xAB,
+    0x39, 0x69, 0x93, 0x75, 0x72, 0xB2, 0x6A, 0xC9, 0x67, 0x89, 0x21, 0x87, 0xFD, 0x11, 0xA9, 0xA3,
+    0x01, 0x49, 0xE9, 0xEE, 0x6A, 0x83, 0x1C, 0x08, 0x42, 0x9B, 0x74, 0x4E, 0x1F, 0x1F, 0x15, 0x26,
+    0x1A, 0xFF, 0xF7, 0xF9, 0x07, 0x95, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0xF6, 0x64, 0xCF,
+    0xD2, 0x59, 0xDA, 0xB9, 0x26, 0x12, 0x4A, 0x8E, 0x75, 0x8B, 0x84, 0x88, 0x9B, 0x14, 0x48, 0xEC,
+    0xDA, 0x8E, 0x90, 0x68, 0xB9, 0x22, 0x5B, 0x45, 0x42, 0x94, 0x08, 0x90, 0x8E, 0x02, 0xA4, 0x2D,
+    0xBC, 0xB7, 0xA6, 0xA0, 0xCE, 0x81, 0x04, 0x2D, 0xB4, 0xEC, 0x15, 0x49, 0x41, 0x97, 0xBD, 0xF3,
+    0xC0, 0x5F, 0x60, 0x24, 0x7E, 0x74, 0xE0, 0x48, 0x09, 0x11, 0x77, 0xC5, 0x0E, 0xE0, 0x43, 0xBE,
+    0x8B, 0x77, 0x87, 0xEF, 0x8D, 0x7D, 0x9B, 0x1A, 0x9F, 0xCE, 0x33, 0x7E, 0x33, 0xEF, 0xD7, 0xF7,
+    0xBE, 0xF7, 0x96, 0xA8, 0x7D, 0x82, 0x04, 0xAF, 0x94, 0x68, 0xFB, 0xE8, 0x92, 0x28, 0x36, 0x0D,
+    0xD1, 0xF8, 0x00, 0x22, 0x47, 0x93, 0x73, 0xE2, 0x2B, 0x48, 0x42, 0x12, 0x17, 0x41, 0x4D, 0x61,
+    0x16, 0x14, 0x54, 0x53, 0x4C, 0x10, 0x36, 0x58, 0x44, 0x49, 0x15, 0xC9, 0xCC, 0x2B, 0x68, 0x4A,
+    0x21, 0xB9, 0x9A, 0x16, 0x24, 0x15, 0x96, 0x13, 0xF2, 0x94, 0x8F, 0x13, 0xF5, 0xA8, 0xA0, 0xD0,
+    0xDC, 0x27, 0x0A, 0x2B, 0x58, 0xBF, 0xD6, 0x79, 0xA3, 0xF1, 0xF8, 0x2E, 0xF9, 0xC6, 0x68, 0xBA,
+    0x31, 0x9F, 0x27, 0x57, 0xC2, 0xBC, 0x22, 0x9A, 0x19, 0xDC, 0xFF, 0x29, 0x25, 0xAF, 0x84, 0x00,
+    0x51, 0xC0, 0x28, 0xB1, 0x13, 0xEA, 0x1D, 0x8F, 0x13, 0x32, 0x08, 0x6C, 0x7B, 0x0D, 0x8D, 0x00,
+    0x52, 0x78, 0x21, 0x61, 0x8C, 0x6A, 0xC3, 0x0D, 0x3B, 0x49, 0x9B, 0x49, 0x8D, 0x7F, 0xBF, 0xEC,
+    0x71, 0x2A, 0xD0, 0xCD, 0x57, 0xF8, 0xDC, 0xE1, 0x33, 0x72, 0x2A, 0x44, 0x18, 0x64, 0xA2, 0x74,
+    0x6A, 0x92, 0x49, 0x90, 0xD1, 0x14, 0x1B, 0x57, 0x63, 0xE3, 0x7F, 0x0F, 0xA5, 0x08, 0x1B, 0x3A,
+    0xC7, 0x66, 0xDF, 0x9C, 0x7E, 0x03, 0xE3, 0x46, 0xF5, 0xCC, 0xEC, 0x2E, 0x09, 0x3D, 0x25, 0x5C,
+    0x87, 0x3C, 0x85, 0x0F, 0x57, 0x23, 0x20, 0x99, 0x49, 0x45, 0x11, 0xBC, 0xC1, 0x62, 0x8C, 0x64,
+    0x61, 0x36, 0x64, 0xBF, 0x12, 0x4A, 0x56, 0x71, 0x3C, 0x1B, 0xEF, 0x21, 0xFF, 0x36, 0x7A, 0xA7,
+    0xFA, 0x88, 0xE8, 0x98, 0xC3, 0x84, 0x0D, 0xA9, 0x39, 0x38, 0x86, 0xE4, 0x5D, 0x8A, 0x9B, 0x05,
+    0x0D, 0x62, 0x16, 0x56, 0xAD, 0x30, 0xC0, 0x61, 0x8C, 0x8B, 0x83, 0x18, 0x5A, 0x12, 0xD1, 0x88,
+    0xC2, 0x96, 0x61, 0xF3, 0xDC, 0x34, 0x9C, 0x1C, 0x12, 0x33, 0x38, 0xA4, 0xD7, 0x92, 0xFD, 0xF6,
+    0xCC, 0xB5, 0xD2, 0x11, 0x1D, 0x93, 0x2D, 0x64, 0xC4, 0x8B, 0x0D, 0x89, 0x83, 0x0A, 0xBA, 0x85,
+    0xA1, 0xA9, 0xEC, 0x02, 0x8B, 0x1D, 0x86, 0x21, 0xBD, 0x9F, 0x20, 0xC4, 0xD8, 0x35, 0x1A, 0xAE,
+    0x22, 0xFF, 0x8F, 0x86, 0x93, 0x91, 0x49, 0xEA, 0x29, 0xA7, 0x0E, 0x29, 0xF5, 0x95, 0xA7, 0x23,
+    0x4A, 0x65, 0x16, 0xAA, 0x11, 0xE4, 0x5F, 0x19, 0x3A, 0x70, 0xAB, 0x00, 0x41, 0xCC, 0x4C, 0x19,
+    0xAE, 0x13, 0xCA, 0x6D, 0x1C, 0x54, 0xEF, 0xD8, 0x30, 0x2A, 0xFB, 0xEE, 0xE2, 0x75, 0xBB, 0xA5,
+    0xB4, 0x8B, 0xE8, 0x96, 0x62, 0x93, 0x8A, 0xBB, 0xE6, 0x02, 0xAF, 0x19, 0x1E, 0x90, 0xC3, 0xCF,
+    0x70, 0x7D, 0x04, 0xE7, 0xA4, 0x07, 0xB8, 0xA6, 0x60, 0x4A, 0xF2, 0xD7, 0x70, 0x84, 0x5B, 0xFF,
+    0x42, 0x59, 0x2C, 0xB9, 0xAA, 0xEC, 0x81, 0xAB, 0x64, 0xD9, 0x2A, 0xA0, 0x92, 0xC6, 0x05, 0x89,
+    0xBF, 0xCF, 0x32, 0xF0, 0x0C, 0xF5, 0xFD, 0x47, 0xA7, 0x24, 0xFD, 0x44, 0x53, 0xF5, 0x92, 0x80,
+    0x32, 0x49, 0x76, 0x34, 0xBC, 0x8A, 0xC9, 0x67, 0xD1, 0x01, 0x73, 0x4D, 0x77, 0xEE, 0xF3, 0x0B,
+    0xC6, 0x52, 0x93, 0xFC, 0x32, 0x27, 0xAF, 0xF0, 0xD4, 0xAB, 0x97, 0xF3, 0xF5, 0xDB, 0xA8, 0x5F,
+    0x11, 0xA1, 0xE0, 0x32, 0xF1, 0xD4, 0x07, 0xA7, 0x47, 0x17, 0x00, 0xDB, 0x24, 0x0D, 0xF8, 0x18,
+    0x39, 0x2B, 0x54, 0x78, 0x45, 0x9E, 0xA9, 0xDB, 0xEC, 0x18, 0x75, 0xC6, 0x5A, 0x02, 0x53, 0x0E,
+    0x76, 0x23, 0xBC, 0x7A, 0x26, 0xF0, 0x9C, 0xAF, 0xC9, 0x61, 0xEA, 0xE6, 0xBF, 0xDF, 0x53, 0xE1,
+    0x8F, 0x25, 0x79, 0xFA, 0x65, 0x90, 0xDB, 0x55, 0xC8, 0x63, 0x08, 0x6E, 0x09, 0x26, 0xD2, 0x04,
+    0xDE, 0xFD, 0x04, 0x25, 0x33, 0x46, 0x2A, 0x69, 0x74, 0x43, 0xE7, 0x33, 0xA9, 0x06, 0xA2, 0x6C,
+    0xDC, 0x62, 0xEA, 0xAB, 0xA1, 0xA7, 0x0E, 0x84, 0x5A, 0x88, 0x6A, 0x22, 0xB3, 0xE0, 0xEC, 0x4E,
+    0x05, 0xF4, 0x0D, 0x82, 0x37, 0x87, 0x2D, 0xE4, 0x03, 0x76, 0x65, 0x1B, 0xC9, 0xE1, 0x4F, 0x61,
+    0xF9, 0xCF, 0x2F, 0xB9, 0x60, 0x88, 0x53, 0xA6, 0x06, 0xBF, 0x9A, 0x21, 0xDF, 0x18, 0x91, 0x8B,
+    0x84, 0x56, 0x4C, 0xD3, 0x06, 0x14, 0x8D, 0xB8, 0x31, 0x42, 0xE4, 0x64, 0x4C, 0xC5, 0xF4, 0xAD,
+    0x2C, 0x55, 0x90, 0x89, 0x64, 0x62, 0x00, 0x05, 0x05, 0xB6, 0x03, 0x72, 0x99, 0xC5, 0x8C, 0xE0,
+    0xB4, 0x83, 0x11, 0xCF, 0x3E, 0x10, 0x0C, 0xB8, 0xFB, 0xCE, 0x99, 0xB6, 0xE8, 0x83, 0xCE, 0x3F,
+    0x33, 0x4C, 0xE8, 0xED, 0xF9, 0x3C, 0xCF, 0xD8, 0x47, 0x6F, 0x6C, 0x9E, 0x02, 0x85, 0x8A, 0xAE,
+    0x9B, 0x8B, 0x31, 0x7B, 0xD5, 0xE1, 0xE9, 0xFC, 0x5B, 0x0B, 0x93, 0xE5, 0xE2, 0xA6, 0xA4, 0x6B,
+    0xFA, 0x90, 0xC3, 0x50, 0x98, 0x0D, 0x90, 0x39, 0x9B, 0xC9, 0xE0, 0x94, 0xCC, 0xFB, 0x43, 0x24,
+    0x0D, 0x10, 0xBF, 0x7E, 0x87, 0x72, 0x91, 0xD1, 0xCC, 0x29, 0xE0, 0xF0, 0x21, 0x2C, 0x0C, 0x91,
+    0x83, 0x04, 0xBD, 0xBC, 0xCC, 0xA9, 0xDC, 0x02, 0x10, 0x3E, 0xC4, 0x01, 0x0B, 0xFB, 0x08, 0xC2,
+    0xCB, 0x80, 0x34, 0x66, 0x0A, 0x69, 0xCC, 0x14, 0x64, 0xBF, 0xEA, 0xC3, 0xD7, 0xD9, 0x5B, 0x09,
+    0x10, 0x28, 0x61, 0xF3, 0x49, 0x4B, 0x0E, 0xC6, 0xCF, 0xD9, 0x78, 0x2B, 0x7C, 0x96, 0x6A, 0xA4,
+    0x19, 0xD2, 0xD6, 0xFA, 0xE8, 0xF2, 0x0B, 0x46, 0x6B, 0xEB, 0xFC, 0xDE, 0xCF, 0x49, 0x08, 0xEB,
+    0x42, 0xDB, 0xCE, 0xAF, 0xC1, 0x64, 0x44, 0x9F, 0x3A, 0xED, 0x3D, 0x6A, 0xEC, 0x50, 0x00, 0x57,
+    0x2B, 0x0C, 0xC3, 0x00, 0xEC, 0x74, 0x35, 0x36, 0x11, 0x9A, 0x19, 0xC3, 0xC6, 0xF6, 0xC8, 0x26,
+    0x1D, 0xE2, 0xBE, 0x41, 0x32, 0x3C, 0xEF, 0x3E, 0x4F, 0x5B, 0xDC, 0x5A, 0x00, 0xBC, 0xE2, 0x0A,
+    0x42, 0x9A, 0xF1, 0x4B, 0xDA, 0x0E, 0x32, 0xAC, 0xE9, 0x37, 0x56, 0xCA, 0xC8, 0xBB, 0x76, 0x1B,
+    0x27, 0xEF, 0xBD, 0x72, 0xC3, 0x2B, 0xDE, 0x78, 0xF4, 0xDB, 0xE3, 0x6A, 0xB7, 0x9A, 0xBC, 0x3E,
+    0x15, 0x93, 0xDD, 0x7E, 0x4C, 0xC7, 0xBE, 0xC8, 0x13, 0xF9, 0xFC, 0x17, 0x93, 0xB8, 0x4B, 0x30,
+    0x95, 0xCA, 0x4F, 0x40, 0xC1, 0xDB, 0xBB, 0x7D, 0x9E, 0xBE, 0x9C, 0x22, 0xC6, 0xEE, 0x0A, 0x55,
+    0x5E, 0xF5, 0x78, 0x06, 0xE3, 0xC1, 0xBA, 0x07, 0x7E, 0xD7, 0x31, 0x17, 0x9E, 0x07, 0x0E, 0x53,
+    0x39, 0xE8, 0x26, 0x6F, 0xDC, 0xD1, 0x7B, 0xD4, 0xF6, 0x1B, 0x2D, 0xBA, 0xA9, 0x5C, 0xB7, 0x51,
+    0x32, 0xDB, 0xBB, 0x31, 0x5C, 0x07, 0x0C, 0xE8, 0x49, 0x77, 0xA7, 0xE6, 0xF9, 0xF4, 0xA9, 0x31,
+    0xE0, 0xC7, 0x94, 0xA9, 0xC0, 0xE9, 0x08, 0xEE, 0xB2, 0x3F, 0x5B, 0x7B, 0x69, 0x6B, 0xC3, 0xEA,
+    0x96, 0x2D, 0x9F, 0xD8, 0x35, 0xBB, 0x9B, 0x76, 0xAC, 0x08, 0x6D, 0x08, 0x3B, 0x14, 0x6D, 0x69,
+    0x18, 0x3B, 0xA4, 0xFC, 0x09, 0x05, 0x48, 0xE7, 0x16, 0x8F, 0xA7, 0x0B, 0x93, 0x39, 0x28, 0x1D,
+    0x0F, 0x53, 0x34, 0xF2, 0xB5, 0x37, 0x35, 0x45, 0x30, 0x33, 0x05, 0x7A, 0x0B, 0x9C, 0xD6, 0xBE,
+    0x42, 0x8D, 0xF0, 0x43, 0x25, 0x3F, 0x33, 0x49, 0x00, 0x0C, 0x42, 0x6E, 0x93, 0x0D, 0xF6, 0x80,
+    0xD8, 0x7D, 0xCE, 0x0E, 0x7D, 0x78, 0xFC, 0x78, 0xC0, 0xEC, 0xFA, 0x0E, 0x61, 0x3C, 0x7B, 0x3A,
+    0xDE, 0xF3, 0x99, 0x9B, 0x5B, 0xEB, 0xF9, 0x03, 0x0D, 0xC6, 0xB9, 0xDC, 0x8F, 0x02, 0xEC, 0xA2,
+    0x3E, 0xFD, 0xF5, 0xB8, 0xB8, 0x2D, 0x96, 0xCB, 0x1F, 0x54, 0xF0, 0xEB, 0xB3, 0x25, 0x4D, 0xB7,
+    0x3D, 0x6D, 0x7F, 0xA0, 0x72, 0x1E, 0xEF, 0xF7, 0xDB, 0x62, 0xEC, 0xF0, 0x1C, 0xC1, 0x77, 0xBC,
+    0x7E, 0xC1, 0xA5, 0x5B, 0x2F, 0xE6, 0x1E, 0x23, 0x68, 0x27, 0x44, 0x0B, 0x90, 0xFD, 0x65, 0xA0,
+    0xEB, 0x2B, 0xCB, 0x03, 0xB0, 0x83, 0x27, 0x0C, 0xC9, 0x32, 0x74, 0x2B, 0xA7, 0x16, 0xA5, 0x54,
+    0x31, 0x60, 0x5A, 0x60, 0x1E, 0x15, 0xBE, 0x5A, 0x40, 0x61, 0x01, 0x86, 0xE3, 0xAF, 0x06, 0x68,
+    0xB5, 0xAD, 0xCF, 0x1D, 0xEE, 0x0F, 0x6D, 0x31, 0x62, 0x74, 0x85, 0x8E, 0xBA, 0x4A, 0xFD, 0xCF,
+    0xE7, 0x3F, 0x55, 0x51, 0x31, 0x4E, 0xC4, 0x30, 0x10, 0x1C, 0xC7, 0x20, 0x17, 0x91, 0xCE, 0x3D,
+    0xD2, 0xE9, 0x9E, 0x90, 0x17, 0x70, 0x89, 0x44, 0x49, 0x43, 0x73, 0x34, 0x14, 0x3C, 0xE1, 0x5E,
+    0x70, 0x8A, 0x2B, 0x28, 0x78, 0x07, 0x35, 0x1F, 0x38, 0x94, 0x20, 0x3E, 0x60, 0xAA, 0x2B, 0x68,
+    0xDC, 0x42, 0x95, 0x22, 0x45, 0x4E, 0x24, 0x59, 0xC6, 0x3E, 0x09, 0x09, 0x4B, 0x33, 0xB3, 0x13,
+    0xAF, 0xBD, 0xDE, 0x0D, 0x8C, 0x1C, 0x81, 0x42, 0x04, 0x98, 0x6E, 0x05, 0x3A, 0x60, 0xC2, 0xAA,
+    0x52, 0x3D, 0xF6, 0x30, 0x5E, 0x77, 0x8C, 0xAD, 0x63, 0x7C, 0x09, 0x13, 0x54, 0x87, 0x06, 0x2F,
+    0xDF, 0x4D, 0x67, 0x44, 0x26, 0x5C, 0xCC, 0xCF, 0x80, 0xF6, 0x00, 0x56, 0x84, 0x95, 0x19, 0xA8,
+    0x65, 0x60, 0xE4, 0x68, 0x77, 0x44, 0xD6, 0x91, 0xF2, 0x16, 0x69, 0x85, 0x00, 0x28, 0x1F, 0xE9,
+    0x83, 0x47, 0xB4, 0x84, 0x98, 0x3D, 0x22, 0x93, 0xCF, 0x11, 0xF9, 0xCF, 0x95, 0x43, 0xF1, 0x64,
+    0x2A, 0x94, 0x36, 0x07, 0xF6, 0xD6, 0x02, 0xC3, 0x62, 0x01, 0xD5, 0x2F, 0x97, 0xA7, 0x5B, 0xF4,
+    0x7F, 0x4A, 0xDF, 0x54, 0x24, 0x0C, 0x91, 0x5E, 0x23, 0x15, 0x15, 0x70, 0x7E, 0x7F, 0xDC, 0xA0,
+    0x14, 0x36, 0x43, 0x9A, 0x63, 0xB1, 0x16, 0xD9, 0x7B, 0x0B, 0x4D, 0xD4, 0xE2, 0xD0, 0xB0, 0xEE,
+    0x74, 0xD7, 0x63, 0x50, 0x23, 0x3B, 0x1C, 0x79, 0xCF, 0x9E, 0x18, 0x75, 0x50, 0xBD, 0xF6, 0x79,
+    0x60, 0x5F, 0x55, 0xCE, 0xD6, 0x6C, 0xBB, 0x75, 0xD6, 0xE5, 0xDE, 0x56, 0x3A, 0xAC, 0x38, 0x92,
+    0x82, 0x58, 0x73, 0x1C, 0x6B, 0xEE, 0xEC, 0x54, 0x53, 0xD5, 0xCC, 0x69, 0xC4, 0xC3, 0x5C, 0xB3,
+    0x41, 0x3E, 0x96, 0x6F, 0x65, 0x41, 0x2B, 0x6F, 0x9B, 0x1B, 0xFC, 0x2D, 0x9F, 0xD8, 0x9E, 0x44,
+    0x92, 0xD8, 0x93, 0x48, 0x12, 0xFB, 0xB5, 0x8D, 0xD2, 0xA7, 0x14, 0xDB, 0x26, 0x91, 0x87, 0x50,
+    0x78, 0xA6, 0x49, 0x5B, 0x7B, 0xA6, 0x49, 0x26, 0x9E, 0xA6, 0xE7, 0x39, 0x9A, 0xAA, 0x91, 0x03,
+    0x4D, 0x2E, 0xF2, 0x28, 0xE2, 0x44, 0x06, 0x23, 0x33, 0x5F, 0xEC, 0x8C, 0x0C, 0x05, 0x07, 0xCF,
+    0x90, 0x26, 0x09, 0x87, 0x62, 0x26, 0x43, 0x03, 0xD3, 0xD9, 0x38, 0x21, 0xE3, 0xCB, 0xF8, 0x57,
+    0xCC, 0x21, 0x8D, 0x2B, 0xED, 0x50, 0x92, 0x81, 0x49, 0x06, 0x67, 0xC4, 0x2F,
+};
+
+static const uint32_t notosans_14_italicBlockOffsets[35] = {
+    0, 1132, 2224, 3353, 4604, 5696, 6495, 7453,
+    8351, 9219, 10121, 11044, 12028, 12855, 13756, 15104,
+    16214, 17335, 18429, 19649, 20841, 22043, 23128, 24158,
+    25273, 26258, 27380, 28494, 29576, 30529, 31752, 32745,
+    34165, 35362, 35693,
+};
+
+static const uint16_t notosans_14_italicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_14_italicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_14_italicPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 876, 0, 0,
 };
 
 static const EpdGlyph notosans_14_italicGlyphs[] = {
@@ -4204,848 +2427,848 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 14, 9, 17, 2, 15, 32, 1819 }, // =
     { 14, 15, 17, 2, 18, 53, 1851 }, // >
     { 12, 23, 13, 2, 22, 69, 1904 }, // ?
-    { 23, 24, 25, 1, 21, 138, 1973 }, // @
-    { 17, 21, 16, -2, 21, 90, 2111 }, // A
-    { 17, 21, 18, 1, 21, 90, 2201 }, // B
-    { 17, 23, 17, 2, 22, 98, 2291 }, // C
-    { 18, 21, 19, 1, 21, 95, 2389 }, // D
-    { 16, 21, 15, 1, 21, 84, 2484 }, // E
-    { 16, 21, 14, 1, 21, 84, 2568 }, // F
-    { 18, 23, 20, 2, 22, 104, 2652 }, // G
-    { 19, 21, 20, 1, 21, 100, 2756 }, // H
-    { 13, 21, 9, -1, 21, 69, 2856 }, // I
-    { 14, 27, 8, -5, 21, 95, 2925 }, // J
-    { 18, 21, 16, 1, 21, 95, 3020 }, // K
-    { 12, 21, 14, 1, 21, 63, 3115 }, // L
-    { 24, 21, 25, 1, 21, 126, 3178 }, // M
-    { 20, 21, 21, 1, 21, 105, 3304 }, // N
-    { 19, 23, 21, 2, 22, 110, 3409 }, // O
-    { 16, 21, 17, 1, 21, 84, 3519 }, // P
-    { 19, 27, 21, 2, 22, 129, 3603 }, // Q
-    { 16, 21, 17, 1, 21, 84, 3732 }, // R
-    { 16, 23, 15, 0, 22, 92, 3816 }, // S
-    { 16, 21, 15, 2, 21, 84, 3908 }, // T
-    { 19, 22, 20, 2, 21, 105, 3992 }, // U
-    { 17, 21, 16, 2, 21, 90, 4097 }, // V
-    { 25, 21, 25, 3, 21, 132, 4187 }, // W
-    { 20, 21, 15, -2, 21, 105, 4319 }, // X
-    { 16, 21, 15, 2, 21, 84, 4424 }, // Y
-    { 18, 21, 15, -1, 21, 95, 4508 }, // Z
-    { 12, 26, 8, -1, 21, 78, 4603 }, // [
-    { 6, 21, 10, 3, 21, 32, 4681 }, // <backslash>
-    { 12, 26, 8, -3, 21, 78, 4713 }, // ]
-    { 15, 14, 17, 1, 21, 53, 4791 }, // ^
-    { 13, 3, 12, -3, -2, 10, 4844 }, // _
-    { 6, 6, 8, 4, 23, 9, 4854 }, // `
-    { 16, 17, 17, 1, 16, 68, 4863 }, // a
-    { 16, 24, 17, 0, 23, 96, 4931 }, // b
-    { 13, 17, 13, 1, 16, 56, 5027 }, // c
-    { 17, 24, 17, 1, 23, 102, 5083 }, // d
-    { 13, 17, 15, 1, 16, 56, 5185 }, // e
-    { 17, 30, 9, -4, 23, 128, 5241 }, // f
-    { 17, 23, 17, 0, 16, 98, 5369 }, // g
-    { 16, 23, 17, 0, 23, 92, 5467 }, // h
-    { 8, 22, 8, 0, 22, 44, 5559 }, // i
-    { 12, 29, 8, -4, 22, 87, 5603 }, // j
-    { 16, 23, 14, 0, 23, 92, 5690 }, // k
-    { 9, 23, 8, 0, 23, 52, 5782 }, // l
-    { 24, 16, 26, 0, 16, 96, 5834 }, // m
-    { 16, 17, 17, 0, 17, 68, 5930 }, // n
-    { 15, 17, 16, 1, 16, 64, 5998 }, // o
-    { 17, 23, 17, -1, 16, 98, 6062 }, // p
-    { 16, 23, 17, 1, 16, 92, 6160 }, // q
-    { 13, 16, 12, 0, 16, 52, 6252 }, // r
-    { 13, 17, 13, 0, 16, 56, 6304 }, // s
-    { 10, 21, 10, 1, 20, 53, 6360 }, // t
-    { 16, 17, 17, 1, 16, 68, 6413 }, // u
-    { 15, 16, 14, 1, 16, 60, 6481 }, // v
-    { 22, 16, 21, 1, 16, 88, 6541 }, // w
-    { 17, 16, 14, -2, 16, 68, 6629 }, // x
-    { 19, 23, 14, -3, 16, 110, 6697 }, // y
-    { 14, 16, 13, -1, 16, 56, 6807 }, // z
-    { 12, 26, 10, 0, 21, 78, 6863 }, // {
-    { 3, 31, 16, 7, 23, 24, 6941 }, // |
-    { 13, 26, 10, -2, 21, 85, 6965 }, // }
-    { 14, 5, 17, 2, 13, 18, 7050 }, // ~
-    { 0, 0, 8, 0, 0, 0, 7068 }, //  
-    { 9, 22, 8, -1, 16, 50, 7068 }, // ¡
-    { 13, 23, 16, 3, 22, 75, 7118 }, // ¢
-    { 18, 22, 16, -1, 22, 99, 7193 }, // £
-    { 13, 13, 16, 2, 17, 43, 7292 }, // ¤
-    { 17, 21, 16, 1, 21, 90, 7335 }, // ¥
-    { 3, 31, 16, 7, 23, 24, 7425 }, // ¦
-    { 15, 24, 14, 0, 23, 90, 7449 }, // §
-    { 9, 4, 16, 6, 22, 9, 7539 }, // ¨
-    { 22, 23, 24, 1, 22, 127, 7548 }, // ©
-    { 10, 11, 10, 2, 22, 28, 7675 }, // ª
-    { 13, 13, 14, 1, 14, 43, 7703 }, // «
-    { 14, 9, 17, 2, 12, 32, 7746 }, // ¬
-    { 9, 3, 9, 0, 9, 7, 7778 }, // ­
-    { 22, 23, 24, 1, 22, 127, 7785 }, // ®
-    { 13, 3, 11, 2, 25, 10, 7912 }, // ¯
-    { 10, 10, 12, 1, 22, 25, 7922 }, // °
-    { 14, 18, 17, 2, 18, 63, 7947 }, // ±
-    { 10, 13, 10, 2, 25, 33, 8010 }, // ²
-    { 10, 14, 10, 2, 25, 35, 8043 }, // ³
-    { 7, 6, 8, 3, 23, 11, 8078 }, // ´
-    { 18, 23, 17, -1, 16, 104, 8089 }, // µ
-    { 16, 27, 19, 2, 23, 108, 8193 }, // ¶
-    { 5, 5, 7, 2, 13, 7, 8301 }, // ·
-    { 7, 7, 6, -3, 0, 13, 8308 }, // ¸
-    { 7, 13, 10, 4, 25, 23, 8321 }, // ¹
-    { 9, 11, 10, 2, 22, 25, 8344 }, // º
-    { 13, 13, 14, 0, 14, 43, 8369 }, // »
-    { 19, 21, 21, 2, 21, 100, 8412 }, // ¼
-    { 21, 21, 23, 2, 21, 111, 8512 }, // ½
-    { 22, 21, 23, 1, 21, 116, 8623 }, // ¾
-    { 12, 22, 13, -1, 16, 66, 8739 }, // ¿
-    { 17, 28, 16, -2, 28, 119, 8805 }, // À
-    { 19, 28, 16, -2, 28, 133, 8924 }, // Á
-    { 18, 28, 16, -2, 28, 126, 9057 }, // Â
-    { 20, 27, 16, -2, 27, 135, 9183 }, // Ã
-    { 18, 27, 16, -2, 27, 122, 9318 }, // Ä
-    { 17, 29, 16, -2, 29, 124, 9440 }, // Å
-    { 28, 21, 24, -2, 21, 147, 9564 }, // Æ
-    { 17, 29, 17, 2, 22, 124, 9711 }, // Ç
-    { 16, 28, 15, 1, 28, 112, 9835 }, // È
-    { 16, 28, 15, 1, 28, 112, 9947 }, // É
-    { 16, 28, 15, 1, 28, 112, 10059 }, // Ê
-    { 16, 27, 15, 1, 27, 108, 10171 }, // Ë
-    { 13, 28, 9, -1, 28, 91, 10279 }, // Ì
-    { 14, 28, 9, -1, 28, 98, 10370 }, // Í
-    { 14, 28, 9, -1, 28, 98, 10468 }, // Î
-    { 14, 27, 9, -1, 27, 95, 10566 }, // Ï
-    { 19, 21, 19, 0, 21, 100, 10661 }, // Ð
-    { 20, 27, 21, 1, 27, 135, 10761 }, // Ñ
-    { 19, 29, 21, 2, 28, 138, 10896 }, // Ò
-    { 19, 29, 21, 2, 28, 138, 11034 }, // Ó
-    { 19, 29, 21, 2, 28, 138, 11172 }, // Ô
-    { 19, 28, 21, 2, 27, 133, 11310 }, // Õ
-    { 19, 28, 21, 2, 27, 133, 11443 }, // Ö
-    { 14, 14, 17, 2, 17, 49, 11576 }, // ×
-    { 20, 24, 21, 1, 22, 120, 11625 }, // Ø
-    { 19, 29, 20, 2, 28, 138, 11745 }, // Ù
-    { 19, 29, 20, 2, 28, 138, 11883 }, // Ú
-    { 19, 29, 20, 2, 28, 138, 12021 }, // Û
-    { 19, 28, 20, 2, 27, 133, 12159 }, // Ü
-    { 16, 28, 15, 2, 28, 112, 12292 }, // Ý
-    { 15, 21, 17, 1, 21, 79, 12404 }, // Þ
-    { 21, 30, 17, -4, 23, 158, 12483 }, // ß
-    { 16, 24, 17, 1, 23, 96, 12641 }, // à
-    { 16, 24, 17, 1, 23, 96, 12737 }, // á
-    { 16, 24, 17, 1, 23, 96, 12833 }, // â
-    { 16, 23, 17, 1, 22, 92, 12929 }, // ã
-    { 16, 23, 17, 1, 22, 92, 13021 }, // ä
-    { 16, 25, 17, 1, 24, 100, 13113 }, // å
-    { 23, 17, 24, 1, 16, 98, 13213 }, // æ
-    { 13, 23, 13, 1, 16, 75, 13311 }, // ç
-    { 13, 24, 15, 1, 23, 78, 13386 }, // è
-    { 14, 24, 15, 1, 23, 84, 13464 }, // é
-    { 13, 24, 15, 1, 23, 78, 13548 }, // ê
-    { 13, 23, 15, 1, 22, 75, 13626 }, // ë
-    { 8, 23, 8, 0, 23, 46, 13701 }, // ì
-    { 11, 23, 8, 0, 23, 64, 13747 }, // í
-    { 11, 23, 8, 0, 23, 64, 13811 }, // î
-    { 11, 22, 8, 0, 22, 61, 13875 }, // ï
-    { 16, 24, 17, 1, 23, 96, 13936 }, // ð
-    { 17, 22, 17, 0, 22, 94, 14032 }, // ñ
-    { 15, 24, 16, 1, 23, 90, 14126 }, // ò
-    { 15, 24, 16, 1, 23, 90, 14216 }, // ó
-    { 15, 24, 16, 1, 23, 90, 14306 }, // ô
-    { 15, 23, 16, 1, 22, 87, 14396 }, // õ
-    { 15, 23, 16, 1, 22, 87, 14483 }, // ö
-    { 14, 14, 17, 2, 17, 49, 14570 }, // ÷
-    { 16, 19, 16, 0, 17, 76, 14619 }, // ø
-    { 16, 24, 17, 1, 23, 96, 14695 }, // ù
-    { 16, 24, 17, 1, 23, 96, 14791 }, // ú
-    { 16, 24, 17, 1, 23, 96, 14887 }, // û
-    { 16, 23, 17, 1, 22, 92, 14983 }, // ü
-    { 19, 30, 14, -3, 23, 143, 15075 }, // ý
-    { 17, 30, 17, -1, 23, 128, 15218 }, // þ
-    { 19, 29, 14, -3, 22, 138, 15346 }, // ÿ
-    { 18, 25, 16, -2, 25, 113, 15484 }, // Ā
-    { 16, 21, 17, 1, 20, 84, 15597 }, // ā
-    { 19, 27, 16, -2, 27, 129, 15681 }, // Ă
-    { 16, 23, 17, 1, 22, 92, 15810 }, // ă
-    { 17, 28, 16, -2, 21, 119, 15902 }, // Ą
-    { 16, 23, 17, 1, 16, 92, 16021 }, // ą
-    { 17, 29, 17, 2, 28, 124, 16113 }, // Ć
-    { 14, 24, 13, 1, 23, 84, 16237 }, // ć
-    { 17, 29, 17, 2, 28, 124, 16321 }, // Ĉ
-    { 13, 24, 13, 1, 23, 78, 16445 }, // ĉ
-    { 17, 28, 17, 2, 27, 119, 16523 }, // Ċ
-    { 13, 23, 13, 1, 22, 75, 16642 }, // ċ
-    { 17, 29, 17, 2, 28, 124, 16717 }, // Č
-    { 14, 24, 13, 1, 23, 84, 16841 }, // č
-    { 18, 28, 19, 1, 28, 126, 16925 }, // Ď
-    { 22, 24, 18, 1, 23, 132, 17051 }, // ď
-    { 19, 21, 19, 0, 21, 100, 17183 }, // Đ
-    { 18, 24, 17, 1, 23, 108, 17283 }, // đ
-    { 16, 25, 15, 1, 25, 100, 17391 }, // Ē
-    { 13, 21, 15, 1, 20, 69, 17491 }, // ē
-    { 16, 27, 15, 1, 27, 108, 17560 }, // Ĕ
-    { 14, 23, 15, 1, 22, 81, 17668 }, // ĕ
-    { 16, 27, 15, 1, 27, 108, 17749 }, // Ė
-    { 13, 23, 15, 1, 22, 75, 17857 }, // ė
-    { 16, 28, 15, 1, 21, 112, 17932 }, // Ę
-    { 13, 23, 15, 1, 16, 75, 18044 }, // ę
-    { 16, 28, 15, 1, 28, 112, 18119 }, // Ě
-    { 14, 24, 15, 1, 23, 84, 18231 }, // ě
-    { 18, 29, 20, 2, 28, 131, 18315 }, // Ĝ
-    { 17, 30, 17, 0, 23, 128, 18446 }, // ĝ
-    { 18, 28, 20, 2, 27, 126, 18574 }, // Ğ
-    { 17, 29, 17, 0, 22, 124, 18700 }, // ğ
-    { 18, 28, 20, 2, 27, 126, 18824 }, // Ġ
-    { 17, 29, 17, 0, 22, 124, 18950 }, // ġ
-    { 18, 29, 20, 2, 22, 131, 19074 }, // Ģ
-    { 17, 30, 17, 0, 23, 128, 19205 }, // ģ
-    { 19, 28, 20, 1, 28, 133, 19333 }, // Ĥ
-    { 16, 30, 17, 0, 30, 120, 19466 }, // ĥ
-    { 21, 21, 20, 1, 21, 111, 19586 }, // Ħ
-    { 16, 23, 17, 0, 23, 92, 19697 }, // ħ
-    { 15, 27, 9, -1, 27, 102, 19789 }, // Ĩ
-    { 12, 22, 8, 0, 22, 66, 19891 }, // ĩ
-    { 14, 25, 9, -1, 25, 88, 19957 }, // Ī
-    { 11, 20, 8, 0, 20, 55, 20045 }, // ī
-    { 14, 27, 9, -1, 27, 95, 20100 }, // Ĭ
-    { 11, 22, 8, 0, 22, 61, 20195 }, // ĭ
-    { 13, 28, 9, -1, 21, 91, 20256 }, // Į
-    { 9, 29, 8, -1, 22, 66, 20347 }, // į
-    { 13, 27, 9, -1, 27, 88, 20413 }, // İ
-    { 7, 16, 8, 0, 16, 28, 20501 }, // ı
-    { 19, 27, 17, -1, 21, 129, 20529 }, // Ĳ
-    { 16, 29, 15, 0, 22, 116, 20658 }, // ĳ
-    { 17, 34, 8, -5, 28, 145, 20774 }, // Ĵ
-    { 15, 30, 8, -4, 23, 113, 20919 }, // ĵ
-    { 18, 28, 16, 1, 21, 126, 21032 }, // Ķ
-    { 16, 30, 14, 0, 23, 120, 21158 }, // ķ
-    { 16, 16, 14, 0, 16, 64, 21278 }, // ĸ
-    { 12, 28, 14, 1, 28, 84, 21342 }, // Ĺ
-    { 12, 30, 8, 0, 30, 90, 21426 }, // ĺ
-    { 12, 28, 14, 1, 21, 84, 21516 }, // Ļ
-    { 11, 30, 8, -2, 23, 83, 21600 }, // ļ
-    { 15, 21, 14, 1, 21, 79, 21683 }, // Ľ
-    { 13, 23, 8, 0, 23, 75, 21762 }, // ľ
-    { 12, 21, 14, 1, 21, 63, 21837 }, // Ŀ
-    { 11, 23, 9, 0, 23, 64, 21900 }, // ŀ
-    { 13, 21, 14, 0, 21, 69, 21964 }, // Ł
-    { 9, 23, 8, 0, 23, 52, 22033 }, // ł
-    { 20, 28, 21, 1, 28, 140, 22085 }, // Ń
-    { 16, 23, 17, 0, 23, 92, 22225 }, // ń
-    { 20, 28, 21, 1, 21, 140, 22317 }, // Ņ
-    { 16, 24, 17, 0, 17, 96, 22457 }, // ņ
-    { 20, 28, 21, 1, 28, 140, 22553 }, // Ň
-    { 16, 23, 17, 0, 23, 92, 22693 }, // ň
-    { 17, 21, 19, 1, 21, 90, 22785 }, // ŉ
-    { 20, 27, 21, 1, 21, 135, 22875 }, // Ŋ
-    { 16, 23, 17, 0, 16, 92, 23010 }, // ŋ
-    { 19, 26, 21, 2, 25, 124, 23102 }, // Ō
-    { 15, 21, 16, 1, 20, 79, 23226 }, // ō
-    { 19, 28, 21, 2, 27, 133, 23305 }, // Ŏ
-    { 15, 23, 16, 1, 22, 87, 23438 }, // ŏ
-    { 20, 29, 21, 2, 28, 145, 23525 }, // Ő
-    { 17, 24, 16, 1, 23, 102, 23670 }, // ő
-    { 25, 23, 25, 2, 22, 144, 23772 }, // Œ
-    { 24, 17, 25, 1, 16, 102, 23916 }, // œ
-    { 16, 28, 17, 1, 28, 112, 24018 }, // Ŕ
-    { 14, 23, 12, 0, 23, 81, 24130 }, // ŕ
-    { 16, 28, 17, 1, 21, 112, 24211 }, // Ŗ
-    { 14, 23, 12, -1, 16, 81, 24323 }, // ŗ
-    { 16, 28, 17, 1, 28, 112, 24404 }, // Ř
-    { 15, 23, 12, 0, 23, 87, 24516 }, // ř
-    { 16, 29, 15, 0, 28, 116, 24603 }, // Ś
-    { 13, 24, 13, 0, 23, 78, 24719 }, // ś
-    { 16, 29, 15, 0, 28, 116, 24797 }, // Ŝ
-    { 13, 24, 13, 0, 23, 78, 24913 }, // ŝ
-    { 16, 29, 15, 0, 22, 116, 24991 }, // Ş
-    { 13, 23, 13, 0, 16, 75, 25107 }, // ş
-    { 16, 29, 15, 0, 28, 116, 25182 }, // Š
-    { 14, 24, 13, 0, 23, 84, 25298 }, // š
-    { 16, 28, 15, 2, 21, 112, 25382 }, // Ţ
-    { 11, 27, 10, 0, 20, 75, 25494 }, // ţ
-    { 16, 28, 15, 2, 28, 112, 25569 }, // Ť
-    { 12, 24, 10, 1, 23, 72, 25681 }, // ť
-    { 16, 21, 15, 2, 21, 84, 25753 }, // Ŧ
-    { 11, 21, 10, 0, 20, 58, 25837 }, // ŧ
-    { 19, 28, 20, 2, 27, 133, 25895 }, // Ũ
-    { 16, 23, 17, 1, 22, 92, 26028 }, // ũ
-    { 19, 26, 20, 2, 25, 124, 26120 }, // Ū
-    { 16, 21, 17, 1, 20, 84, 26244 }, // ū
-    { 19, 28, 20, 2, 27, 133, 26328 }, // Ŭ
-    { 16, 23, 17, 1, 22, 92, 26461 }, // ŭ
-    { 19, 30, 20, 2, 29, 143, 26553 }, // Ů
-    { 16, 25, 17, 1, 24, 100, 26696 }, // ů
-    { 19, 29, 20, 2, 28, 138, 26796 }, // Ű
-    { 17, 24, 17, 1, 23, 102, 26934 }, // ű
-    { 19, 28, 20, 2, 21, 133, 27036 }, // Ų
-    { 16, 23, 17, 1, 16, 92, 27169 }, // ų
-    { 25, 28, 25, 3, 28, 175, 27261 }, // Ŵ
-    { 22, 23, 21, 1, 23, 127, 27436 }, // ŵ
-    { 16, 28, 15, 2, 28, 112, 27563 }, // Ŷ
-    { 19, 30, 14, -3, 23, 143, 27675 }, // ŷ
-    { 16, 27, 15, 2, 27, 108, 27818 }, // Ÿ
-    { 18, 28, 15, -1, 28, 126, 27926 }, // Ź
-    { 15, 23, 13, -1, 23, 87, 28052 }, // ź
-    { 18, 27, 15, -1, 27, 122, 28139 }, // Ż
-    { 14, 22, 13, -1, 22, 77, 28261 }, // ż
-    { 18, 28, 15, -1, 28, 126, 28338 }, // Ž
-    { 15, 23, 13, -1, 23, 87, 28464 }, // ž
-    { 17, 30, 8, -4, 23, 128, 28551 }, // ſ
-    { 6, 6, 0, -12, 23, 9, 28679 }, // ̀
-    { 7, 6, 0, -7, 23, 11, 28688 }, // ́
-    { 10, 6, 0, -3, 23, 15, 28699 }, // ̂
-    { 12, 5, 0, -13, 22, 15, 28714 }, // ̃
-    { 9, 3, 0, -2, 20, 7, 28729 }, // ̄
-    { 13, 3, 0, -3, 25, 10, 28736 }, // ̅
-    { 9, 5, 0, -2, 22, 12, 28746 }, // ̆
-    { 4, 4, 0, 1, 22, 4, 28758 }, // ̇
-    { 9, 4, 0, -2, 22, 9, 28762 }, // ̈
-    { 6, 7, 0, -9, 24, 11, 28771 }, // ̉
-    { 7, 7, 0, -1, 24, 13, 28782 }, // ̊
-    { 12, 6, 0, -2, 23, 18, 28795 }, // ̋
-    { 10, 6, 0, -2, 23, 15, 28813 }, // ̌
-    { 5, 9, 0, 0, 23, 12, 28828 }, // ̍
-    { 9, 6, 0, -2, 23, 14, 28840 }, // ̎
-    { 11, 6, 0, -15, 23, 17, 28854 }, // ̏
-    { 10, 8, 0, -2, 25, 20, 28871 }, // ̐
-    { 9, 5, 0, -2, 22, 12, 28891 }, // ̑
-    { 6, 8, 0, -1, 21, 12, 28903 }, // ̒
-    { 6, 8, 0, -1, 21, 12, 28915 }, // ̓
-    { 4, 8, 0, 0, 21, 8, 28927 }, // ̔
-    { 6, 8, 0, -1, 21, 12, 28935 }, // ̕
-    { 6, 6, 0, -6, -1, 9, 28947 }, // ̖
-    { 7, 6, 0, -5, -1, 11, 28956 }, // ̗
-    { 6, 7, 0, -5, 0, 11, 28967 }, // ̘
-    { 7, 7, 0, -6, 0, 13, 28978 }, // ̙
-    { 10, 9, 10, 2, 23, 23, 28991 }, // ̚
-    { 8, 7, 0, -2, 23, 14, 29014 }, // ̛
-    { 5, 7, 0, -2, 0, 9, 29028 }, // ̜
-    { 7, 6, 0, -6, -1, 11, 29037 }, // ̝
-    { 8, 6, 0, -6, -1, 12, 29048 }, // ̞
-    { 7, 7, 0, -6, 0, 13, 29060 }, // ̟
-    { 7, 3, 0, -6, -3, 6, 29073 }, // ̠
-    { 7, 9, 0, -6, 2, 16, 29079 }, // ̡
-    { 6, 9, 0, -3, 2, 14, 29095 }, // ̢
-    { 4, 5, 0, -13, -1, 5, 29109 }, // ̣
-    { 9, 4, 0, -7, -2, 9, 29114 }, // ̤
-    { 7, 7, 0, -6, 0, 13, 29123 }, // ̥
-    { 5, 6, 0, 2, -1, 8, 29136 }, // ̦
-    { 6, 7, 0, -5, 0, 11, 29144 }, // ̧
-    { 6, 7, 0, -5, 0, 11, 29155 }, // ̨
-    { 5, 9, 0, -5, 0, 12, 29166 }, // ̩
-    { 12, 6, 0, -8, -1, 18, 29178 }, // ̪
-    { 12, 5, 0, -8, -1, 15, 29196 }, // ̫
-    { 10, 6, 0, -7, 0, 15, 29211 }, // ̬
-    { 10, 6, 0, -7, -1, 15, 29226 }, // ̭
-    { 9, 5, 0, -6, -1, 12, 29241 }, // ̮
-    { 9, 5, 0, -7, -1, 12, 29253 }, // ̯
-    { 11, 5, 0, -8, -1, 14, 29265 }, // ̰
-    { 9, 3, 0, -7, -2, 7, 29279 }, // ̱
-    { 13, 3, 0, -9, -2, 10, 29286 }, // ̲
-    { 14, 7, 0, -9, 0, 25, 29296 }, // ̳
-    { 12, 5, 0, -6, 10, 15, 29321 }, // ̴
-    { 12, 3, 0, -6, 10, 9, 29336 }, // ̵
-    { 20, 3, 0, -10, 10, 15, 29345 }, // ̶
-    { 10, 7, 0, -5, 12, 18, 29360 }, // ̷
-    { 16, 25, 0, -8, 23, 100, 29378 }, // ̸
-    { 5, 8, 0, -2, 1, 10, 29478 }, // ̹
-    { 12, 6, 0, -8, -1, 18, 29488 }, // ̺
-    { 12, 7, 0, -8, 0, 21, 29506 }, // ̻
-    { 12, 5, 0, -8, -1, 15, 29527 }, // ̼
-    { 8, 7, 0, -1, 23, 14, 29542 }, // ̽
-    { 7, 10, 0, -1, 26, 18, 29556 }, // ̾
-    { 14, 7, 0, -3, 29, 25, 29574 }, // ̿
-    { 6, 6, 0, -2, 23, 9, 29599 }, // ̀
-    { 7, 6, 0, 1, 23, 11, 29608 }, // ́
-    { 12, 5, 0, 4, 22, 15, 29619 }, // ͂
-    { 6, 6, 0, 0, 23, 9, 29634 }, // ̓
-    { 11, 6, 0, -3, 23, 17, 29643 }, // ̈́
-    { 5, 5, 0, -4, -2, 7, 29660 }, // ͅ
-    { 14, 6, 0, -4, 23, 21, 29667 }, // ͆
-    { 14, 7, 0, -9, 0, 25, 29688 }, // ͇
-    { 9, 6, 0, -7, 0, 14, 29713 }, // ͈
-    { 7, 6, 0, -5, -1, 11, 29727 }, // ͉
-    { 11, 7, 0, -3, 23, 20, 29738 }, // ͊
-    { 12, 11, 0, -3, 27, 33, 29758 }, // ͋
-    { 12, 8, 0, -3, 25, 24, 29791 }, // ͌
-    { 11, 6, 0, -8, -1, 17, 29815 }, // ͍
-    { 6, 7, 0, -5, 0, 11, 29832 }, // ͎
-    { 22, 21, 0, -11, 21, 116, 29843 }, // ͏
-    { 5, 7, 0, 0, 24, 9, 29959 }, // ͐
-    { 5, 7, 0, 3, 24, 9, 29968 }, // ͑
-    { 9, 8, 0, -2, 25, 18, 29977 }, // ͒
-    { 7, 7, 0, -5, 0, 13, 29995 }, // ͓
-    { 6, 6, 0, -5, -1, 9, 30008 }, // ͔
-    { 6, 6, 0, -4, -1, 9, 30017 }, // ͕
-    { 12, 6, 0, -7, -1, 18, 30026 }, // ͖
-    { 4, 8, 0, 3, 25, 8, 30044 }, // ͗
-    { 4, 4, 0, 1, 22, 4, 30052 }, // ͘
-    { 7, 6, 0, -6, -1, 11, 30056 }, // ͙
-    { 12, 7, 0, -8, 0, 21, 30067 }, // ͚
-    { 6, 6, 0, 0, 23, 9, 30088 }, // ͛
-    { 22, 6, 0, -13, -1, 33, 30097 }, // ͜
-    { 21, 6, 0, -8, 23, 32, 30130 }, // ͝
-    { 15, 3, 0, -5, 20, 12, 30162 }, // ͞
-    { 16, 3, 0, -10, -2, 12, 30174 }, // ͟
-    { 22, 5, 0, -8, 22, 28, 30186 }, // ͠
-    { 21, 6, 0, -8, 25, 32, 30214 }, // ͡
-    { 22, 6, 0, -14, -1, 33, 30246 }, // ͢
-    { 8, 8, 0, -1, 25, 16, 30279 }, // ͣ
-    { 6, 8, 0, 0, 25, 12, 30295 }, // ͤ
-    { 4, 9, 0, 1, 27, 9, 30307 }, // ͥ
-    { 7, 7, 0, -1, 25, 13, 30316 }, // ͦ
-    { 8, 8, 0, -1, 25, 16, 30329 }, // ͧ
-    { 6, 8, 0, 0, 25, 12, 30345 }, // ͨ
-    { 8, 10, 0, -1, 27, 20, 30357 }, // ͩ
-    { 7, 9, 0, -1, 27, 16, 30377 }, // ͪ
-    { 11, 7, 0, -3, 25, 20, 30393 }, // ͫ
-    { 6, 7, 0, 0, 25, 11, 30413 }, // ͬ
-    { 5, 9, 0, 1, 26, 12, 30424 }, // ͭ
-    { 7, 7, 0, 0, 25, 13, 30436 }, // ͮ
-    { 8, 7, 0, -1, 25, 14, 30449 }, // ͯ
-    { 16, 28, 15, 0, 28, 112, 30463 }, // Ѐ
-    { 16, 27, 15, 0, 27, 108, 30575 }, // Ё
-    { 16, 22, 19, 2, 21, 88, 30683 }, // Ђ
-    { 16, 28, 14, 0, 28, 112, 30771 }, // Ѓ
-    { 18, 23, 17, 1, 22, 104, 30883 }, // Є
-    { 16, 23, 15, 0, 22, 92, 30987 }, // Ѕ
-    { 9, 21, 8, 0, 21, 48, 31079 }, // І
-    { 11, 27, 8, 0, 27, 75, 31127 }, // Ї
-    { 14, 27, 8, -5, 21, 95, 31202 }, // Ј
-    { 28, 22, 27, -2, 21, 154, 31297 }, // Љ
-    { 26, 21, 27, 0, 21, 137, 31451 }, // Њ
-    { 17, 21, 20, 2, 21, 90, 31588 }, // Ћ
-    { 19, 28, 16, 0, 28, 133, 31678 }, // Ќ
-    { 21, 28, 20, 0, 28, 147, 31811 }, // Ѝ
-    { 19, 28, 16, 0, 27, 133, 31958 }, // Ў
-    { 20, 26, 19, 0, 21, 130, 32091 }, // Џ
-    { 17, 21, 17, -2, 21, 90, 32221 }, // А
-    { 17, 21, 16, 0, 21, 90, 32311 }, // Б
-    { 17, 21, 17, 0, 21, 90, 32401 }, // В
-    { 16, 21, 14, 0, 21, 84, 32491 }, // Г
-    { 23, 26, 20, -3, 21, 150, 32575 }, // Д
-    { 16, 21, 15, 0, 21, 84, 32725 }, // Е
-    { 28, 21, 23, -2, 21, 147, 32809 }, // Ж
-    { 16, 23, 15, -1, 22, 92, 32956 }, // З
-    { 21, 21, 20, 0, 21, 111, 33048 }, // И
-    { 21, 27, 20, 0, 27, 142, 33159 }, // Й
-    { 19, 21, 16, 0, 21, 100, 33301 }, // К
-    { 22, 22, 20, -2, 21, 121, 33401 }, // Л
-    { 25, 21, 24, 0, 21, 132, 33522 }, // М
-    { 20, 21, 20, 0, 21, 105, 33654 }, // Н
-    { 19, 23, 20, 1, 22, 110, 33759 }, // О
-    { 20, 21, 19, 0, 21, 105, 33869 }, // П
-    { 17, 21, 16, 0, 21, 90, 33974 }, // Р
-    { 18, 23, 17, 1, 22, 104, 34064 }, // С
-    { 16, 21, 15, 2, 21, 84, 34168 }, // Т
-    { 19, 22, 16, 0, 21, 105, 34252 }, // У
-    { 22, 23, 23, 1, 22, 127, 34357 }, // Ф
-    { 20, 21, 16, -2, 21, 105, 34484 }, // Х
-    { 20, 26, 20, 0, 21, 130, 34589 }, // Ц
-    { 17, 21, 18, 2, 21, 90, 34719 }, // Ч
-    { 28, 21, 28, 0, 21, 147, 34809 }, // Ш
-    { 28, 26, 28, 0, 21, 182, 34956 }, // Щ
-    { 16, 21, 19, 2, 21, 84, 35138 }, // Ъ
-    { 24, 21, 23, 0, 21, 126, 35222 }, // Ы
-    { 15, 21, 16, 0, 21, 79, 35348 }, // Ь
-    { 17, 23, 17, 0, 22, 98, 35427 }, // Э
-    { 27, 23, 27, 0, 22, 156, 35525 }, // Ю
-    { 19, 21, 17, -2, 21, 100, 35681 }, // Я
-    { 15, 17, 17, 1, 16, 64, 35781 }, // а
-    { 16, 24, 16, 1, 23, 96, 35845 }, // б
-    { 14, 17, 15, 1, 16, 60, 35941 }, // в
-    { 13, 17, 13, 0, 16, 56, 36001 }, // г
-    { 15, 24, 16, 1, 23, 90, 36057 }, // д
-    { 13, 17, 14, 1, 16, 56, 36147 }, // е
-    { 27, 17, 26, -1, 16, 115, 36203 }, // ж
-    { 13, 17, 13, 0, 16, 56, 36318 }, // з
-    { 15, 17, 17, 1, 16, 64, 36374 }, // и
-    { 15, 23, 17, 1, 22, 87, 36438 }, // й
-    { 16, 16, 15, 0, 16, 64, 36525 }, // к
-    { 18, 17, 17, -2, 16, 77, 36589 }, // л
-    { 22, 16, 22, 0, 16, 88, 36666 }, // м
-    { 16, 16, 17, 0, 16, 64, 36754 }, // н
-    { 15, 17, 16, 1, 16, 64, 36818 }, // о
-    { 15, 16, 16, 0, 16, 60, 36882 }, // п
-    { 17, 23, 17, -1, 16, 98, 36942 }, // р
-    { 13, 17, 13, 1, 16, 56, 37040 }, // с
-    { 24, 16, 25, 0, 16, 96, 37096 }, // т
-    { 19, 23, 14, -3, 16, 110, 37192 }, // у
-    { 18, 30, 20, 1, 23, 135, 37302 }, // ф
-    { 17, 16, 13, -2, 16, 68, 37437 }, // х
-    { 15, 21, 17, 1, 16, 79, 37505 }, // ц
-    { 14, 16, 16, 2, 16, 56, 37584 }, // ч
-    { 24, 17, 25, 1, 16, 102, 37640 }, // ш
-    { 24, 21, 26, 1, 16, 126, 37742 }, // щ
-    { 16, 17, 17, 1, 16, 68, 37868 }, // ъ
-    { 20, 17, 21, 1, 16, 85, 37936 }, // ы
-    { 13, 17, 15, 1, 16, 56, 38021 }, // ь
-    { 13, 17, 14, 0, 16, 56, 38077 }, // э
-    { 22, 17, 23, 0, 16, 94, 38133 }, // ю
-    { 16, 16, 15, -1, 16, 64, 38227 }, // я
-    { 13, 24, 14, 1, 23, 78, 38291 }, // ѐ
-    { 14, 23, 14, 1, 22, 81, 38369 }, // ё
-    { 16, 30, 17, 0, 23, 120, 38450 }, // ђ
-    { 14, 24, 13, 0, 23, 84, 38570 }, // ѓ
-    { 13, 17, 14, 1, 16, 56, 38654 }, // є
-    { 13, 17, 13, 0, 16, 56, 38710 }, // ѕ
-    { 8, 22, 8, 0, 22, 44, 38766 }, // і
-    { 10, 22, 7, 0, 22, 55, 38810 }, // ї
-    { 12, 29, 7, -4, 22, 87, 38865 }, // ј
-    { 25, 17, 24, -2, 16, 107, 38952 }, // љ
-    { 23, 17, 24, 0, 16, 98, 39059 }, // њ
-    { 16, 23, 17, 0, 23, 92, 39157 }, // ћ
-    { 16, 23, 15, 0, 23, 92, 39249 }, // ќ
-    { 15, 24, 17, 1, 23, 90, 39341 }, // ѝ
-    { 19, 29, 14, -3, 22, 138, 39431 }, // ў
-    { 15, 22, 17, 1, 16, 83, 39569 }, // џ
-    { 27, 22, 27, 2, 21, 149, 39652 }, // Ѡ
-    { 23, 16, 23, 1, 16, 92, 39801 }, // ѡ
-    { 14, 21, 17, 2, 21, 74, 39893 }, // Ѣ
-    { 23, 18, 24, 0, 17, 104, 39967 }, // ѣ
-    { 26, 23, 25, 1, 22, 150, 40071 }, // Ѥ
-    { 21, 17, 20, 0, 16, 90, 40221 }, // ѥ
-    { 19, 21, 18, -2, 21, 100, 40311 }, // Ѧ
-    { 16, 16, 16, -2, 16, 64, 40411 }, // ѧ
-    { 23, 21, 25, 1, 21, 121, 40475 }, // Ѩ
-    { 20, 16, 21, 0, 16, 80, 40596 }, // ѩ
-    { 23, 21, 19, -2, 21, 121, 40676 }, // Ѫ
-    { 19, 16, 18, -2, 16, 76, 40797 }, // ѫ
-    { 27, 21, 27, 1, 21, 142, 40873 }, // Ѭ
-    { 24, 16, 23, 0, 16, 96, 41015 }, // ѭ
-    { 18, 32, 16, -2, 25, 144, 41111 }, // Ѯ
-    { 16, 26, 13, -2, 20, 104, 41255 }, // ѯ
-    { 22, 21, 22, 3, 21, 116, 41359 }, // Ѱ
-    { 19, 30, 21, 1, 23, 143, 41475 }, // ѱ
-    { 19, 23, 21, 2, 22, 110, 41618 }, // Ѳ
-    { 15, 17, 16, 1, 16, 64, 41728 }, // ѳ
-    { 18, 21, 17, 2, 21, 95, 41792 }, // Ѵ
-    { 15, 16, 13, 1, 16, 60, 41887 }, // ѵ
-    { 18, 28, 17, 2, 28, 126, 41947 }, // Ѷ
-    { 15, 23, 13, 1, 23, 87, 42073 }, // ѷ
-    { 35, 29, 35, 2, 22, 254, 42160 }, // Ѹ
-    { 31, 23, 30, 1, 16, 179, 42414 }, // ѹ
-    { 19, 25, 22, 2, 23, 119, 42593 }, // Ѻ
-    { 15, 20, 17, 1, 18, 75, 42712 }, // ѻ
-    { 26, 32, 28, 2, 31, 208, 42787 }, // Ѽ
-    { 21, 27, 23, 1, 26, 142, 42995 }, // ѽ
-    { 27, 27, 27, 2, 26, 183, 43137 }, // Ѿ
-    { 23, 21, 23, 1, 21, 121, 43320 }, // ѿ
-    { 17, 29, 17, 2, 22, 124, 43441 }, // Ҁ
-    { 13, 23, 13, 1, 16, 75, 43565 }, // ҁ
-    { 16, 20, 18, 1, 19, 80, 43640 }, // ҂
-    { 12, 5, 0, -12, 21, 15, 43720 }, // ҃
-    { 12, 5, 0, -12, 22, 15, 43735 }, // ҄
-    { 4, 6, 0, -8, 23, 6, 43750 }, // ҅
-    { 4, 6, 0, -8, 23, 6, 43756 }, // ҆
-    { 12, 4, 0, -2, 26, 12, 43762 }, // ҇
-    { 34, 31, 0, -17, 23, 264, 43774 }, // ҈
-    { 34, 33, 0, -17, 24, 281, 44038 }, // ҉
-    { 20, 34, 21, 1, 28, 170, 44319 }, // Ҋ
-    { 16, 29, 17, 1, 23, 116, 44489 }, // ҋ
-    { 14, 21, 16, 1, 21, 74, 44605 }, // Ҍ
-    { 13, 24, 15, 1, 23, 78, 44679 }, // ҍ
-    { 16, 21, 17, 1, 21, 84, 44757 }, // Ҏ
-    { 17, 23, 17, -1, 16, 98, 44841 }, // ҏ
-    { 16, 26, 14, 1, 26, 104, 44939 }, // Ґ
-    { 14, 21, 11, 0, 21, 74, 45043 }, // ґ
-    { 16, 21, 14, 1, 21, 84, 45117 }, // Ғ
-    { 13, 16, 11, 0, 16, 52, 45201 }, // ғ
-    { 16, 29, 18, 1, 21, 116, 45253 }, // Ҕ
-    { 13, 24, 15, 0, 16, 78, 45369 }, // ҕ
-    { 28, 27, 24, -2, 21, 189, 45447 }, // Җ
-    { 27, 22, 25, -1, 16, 149, 45636 }, // җ
-    { 16, 29, 15, -1, 22, 116, 45785 }, // Ҙ
-    { 13, 23, 13, 0, 16, 75, 45901 }, // ҙ
-    { 19, 27, 18, 1, 21, 129, 45976 }, // Қ
-    { 16, 22, 15, 0, 16, 88, 46105 }, // қ
-    { 19, 21, 17, 1, 21, 100, 46193 }, // Ҝ
-    { 16, 16, 14, 0, 16, 64, 46293 }, // ҝ
-    { 19, 21, 16, 1, 21, 100, 46357 }, // Ҟ
-    { 16, 23, 14, 0, 23, 92, 46457 }, // ҟ
-    { 20, 21, 19, 2, 21, 105, 46549 }, // Ҡ
-    { 17, 16, 17, 1, 16, 68, 46654 }, // ҡ
-    { 19, 27, 20, 1, 21, 129, 46722 }, // Ң
-    { 17, 22, 18, 0, 16, 94, 46851 }, // ң
-    { 24, 21, 22, 1, 21, 126, 46945 }, // Ҥ
-    { 22, 16, 20, 0, 16, 88, 47071 }, // ҥ
-    { 26, 29, 29, 1, 21, 189, 47159 }, // Ҧ
-    { 22, 24, 24, 0, 16, 132, 47348 }, // ҧ
-    { 18, 24, 21, 2, 22, 108, 47480 }, // Ҩ
-    { 16, 17, 18, 1, 16, 68, 47588 }, // ҩ
-    { 17, 29, 17, 2, 22, 124, 47656 }, // Ҫ
-    { 13, 23, 13, 1, 16, 75, 47780 }, // ҫ
-    { 16, 27, 15, 2, 21, 108, 47855 }, // Ҭ
-    { 25, 22, 26, 0, 16, 138, 47963 }, // ҭ
-    { 16, 21, 15, 2, 21, 84, 48101 }, // Ү
-    { 15, 23, 14, 1, 16, 87, 48185 }, // ү
-    { 17, 21, 15, 1, 21, 90, 48272 }, // Ұ
-    { 17, 23, 14, -1, 16, 98, 48362 }, // ұ
-    { 20, 27, 17, -2, 21, 135, 48460 }, // Ҳ
-    { 17, 22, 15, -1, 16, 94, 48595 }, // ҳ
-    { 21, 27, 23, 2, 21, 142, 48689 }, // Ҵ
-    { 18, 22, 19, 1, 16, 99, 48831 }, // ҵ
-    { 16, 27, 19, 3, 21, 108, 48930 }, // Ҷ
-    { 14, 22, 16, 2, 16, 77, 49038 }, // ҷ
-    { 16, 21, 19, 3, 21, 84, 49115 }, // Ҹ
-    { 14, 16, 16, 2, 16, 56, 49199 }, // ҹ
-    { 16, 21, 19, 1, 21, 84, 49255 }, // Һ
-    { 16, 23, 17, 0, 23, 92, 49339 }, // һ
-    { 22, 23, 22, 1, 22, 127, 49431 }, // Ҽ
-    { 16, 17, 17, 1, 16, 68, 49558 }, // ҽ
-    { 22, 28, 22, 1, 22, 154, 49626 }, // Ҿ
-    { 16, 22, 17, 1, 16, 88, 49780 }, // ҿ
-    { 13, 21, 9, -1, 21, 69, 49868 }, // Ӏ
-    { 28, 27, 23, -2, 27, 189, 49937 }, // Ӂ
-    { 27, 23, 26, -1, 22, 156, 50126 }, // ӂ
-    { 19, 29, 19, 1, 21, 138, 50282 }, // Ӄ
-    { 16, 24, 15, 0, 16, 96, 50420 }, // ӄ
-    { 21, 27, 19, -1, 21, 142, 50516 }, // Ӆ
-    { 17, 22, 16, -2, 16, 94, 50658 }, // ӆ
-    { 19, 29, 20, 1, 21, 138, 50752 }, // Ӈ
-    { 17, 24, 18, 0, 16, 102, 50890 }, // ӈ
-    { 19, 27, 20, 1, 21, 129, 50992 }, // Ӊ
-    { 17, 22, 18, 0, 16, 94, 51121 }, // ӊ
-    { 16, 27, 19, 3, 21, 108, 51215 }, // Ӌ
-    { 15, 22, 17, 2, 16, 83, 51323 }, // ӌ
-    { 24, 27, 25, 1, 21, 162, 51406 }, // Ӎ
-    { 20, 22, 20, 0, 16, 110, 51568 }, // ӎ
-    { 13, 21, 9, -1, 21, 69, 51678 }, // ӏ
-    { 19, 27, 16, -2, 27, 129, 51747 }, // Ӑ
-    { 16, 23, 17, 1, 22, 92, 51876 }, // ӑ
-    { 18, 27, 16, -2, 27, 122, 51968 }, // Ӓ
-    { 16, 23, 17, 1, 22, 92, 52090 }, // ӓ
-    { 28, 21, 24, -2, 21, 147, 52182 }, // Ӕ
-    { 23, 17, 24, 1, 16, 98, 52329 }, // ӕ
-    { 16, 27, 15, 1, 27, 108, 52427 }, // Ӗ
-    { 15, 23, 15, 1, 22, 87, 52535 }, // ӗ
-    { 18, 23, 19, 1, 22, 104, 52622 }, // Ә
-    { 14, 17, 14, 0, 16, 60, 52726 }, // ә
-    { 18, 28, 19, 1, 27, 126, 52786 }, // Ӛ
-    { 14, 23, 14, 0, 22, 81, 52912 }, // ӛ
-    { 28, 27, 23, -2, 27, 189, 52993 }, // Ӝ
-    { 27, 23, 26, -1, 22, 156, 53182 }, // ӝ
-    { 16, 28, 15, -1, 27, 112, 53338 }, // Ӟ
-    { 13, 23, 13, 0, 22, 75, 53450 }, // ӟ
-    { 16, 22, 15, 0, 21, 88, 53525 }, // Ӡ
-    { 16, 23, 14, -2, 16, 92, 53613 }, // ӡ
-    { 21, 25, 20, 0, 25, 132, 53705 }, // Ӣ
-    { 16, 21, 17, 1, 20, 84, 53837 }, // ӣ
-    { 21, 27, 20, 0, 27, 142, 53921 }, // Ӥ
-    { 16, 23, 17, 1, 22, 92, 54063 }, // ӥ
-    { 19, 28, 21, 2, 27, 133, 54155 }, // Ӧ
-    { 15, 23, 16, 1, 22, 87, 54288 }, // ӧ
-    { 19, 23, 21, 2, 22, 110, 54375 }, // Ө
-    { 15, 17, 16, 1, 16, 64, 54485 }, // ө
-    { 19, 28, 21, 2, 27, 133, 54549 }, // Ӫ
-    { 15, 23, 16, 1, 22, 87, 54682 }, // ӫ
-    { 17, 28, 17, 0, 27, 119, 54769 }, // Ӭ
-    { 13, 23, 14, 0, 22, 75, 54888 }, // ӭ
-    { 19, 26, 16, 0, 25, 124, 54963 }, // Ӯ
-    { 19, 27, 14, -3, 20, 129, 55087 }, // ӯ
-    { 19, 28, 16, 0, 27, 133, 55216 }, // Ӱ
-    { 19, 29, 14, -3, 22, 138, 55349 }, // ӱ
-    { 19, 29, 16, 0, 28, 138, 55487 }, // Ӳ
-    { 19, 30, 14, -3, 23, 143, 55625 }, // ӳ
-    { 17, 27, 18, 2, 27, 115, 55768 }, // Ӵ
-    { 14, 22, 16, 2, 22, 77, 55883 }, // ӵ
-    { 16, 27, 14, 1, 21, 108, 55960 }, // Ӷ
-    { 13, 22, 11, 0, 16, 72, 56068 }, // ӷ
-    { 24, 27, 23, 0, 27, 162, 56140 }, // Ӹ
-    { 20, 23, 21, 1, 22, 115, 56302 }, // ӹ
-    { 17, 27, 14, 0, 21, 115, 56417 }, // Ӻ
-    { 14, 22, 11, -1, 16, 77, 56532 }, // ӻ
-    { 20, 27, 15, -2, 21, 135, 56609 }, // Ӽ
-    { 17, 22, 14, -2, 16, 94, 56744 }, // ӽ
-    { 20, 21, 15, -2, 21, 105, 56838 }, // Ӿ
-    { 17, 16, 14, -2, 16, 68, 56943 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 57011 }, //  
-    { 0, 0, 29, 0, 0, 0, 57011 }, //  
-    { 0, 0, 15, 0, 0, 0, 57011 }, //  
-    { 0, 0, 29, 0, 0, 0, 57011 }, //  
-    { 0, 0, 10, 0, 0, 0, 57011 }, //  
-    { 0, 0, 7, 0, 0, 0, 57011 }, //  
-    { 0, 0, 5, 0, 0, 0, 57011 }, //  
-    { 0, 0, 16, 0, 0, 0, 57011 }, //  
-    { 0, 0, 7, 0, 0, 0, 57011 }, //  
-    { 0, 0, 5, 0, 0, 0, 57011 }, //  
-    { 0, 0, 3, 0, 0, 0, 57011 }, //  
-    { 0, 0, 0, 0, 0, 0, 57011 }, // ​
-    { 0, 0, 0, 0, 0, 0, 57011 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 57011 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 57011 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 57061 }, // ‏
-    { 9, 3, 9, 0, 9, 7, 57111 }, // ‐
-    { 9, 3, 9, 0, 9, 7, 57118 }, // ‑
-    { 15, 3, 16, 1, 12, 12, 57125 }, // ‒
-    { 14, 4, 14, 0, 10, 14, 57137 }, // –
-    { 28, 4, 28, 0, 10, 28, 57151 }, // —
-    { 28, 4, 28, 0, 10, 28, 57179 }, // ―
-    { 9, 31, 16, 4, 23, 70, 57207 }, // ‖
-    { 13, 7, 12, -3, 0, 23, 57277 }, // ‗
-    { 7, 8, 5, 1, 21, 14, 57300 }, // ‘
-    { 7, 8, 5, 1, 21, 14, 57314 }, // ’
-    { 7, 8, 7, -2, 4, 14, 57328 }, // ‚
-    { 4, 8, 5, 3, 21, 8, 57342 }, // ‛
-    { 12, 8, 10, 1, 21, 24, 57350 }, // “
-    { 12, 8, 10, 1, 21, 24, 57374 }, // ”
-    { 12, 8, 12, -2, 4, 24, 57398 }, // „
-    { 9, 8, 10, 3, 21, 18, 57422 }, // ‟
-    { 11, 23, 14, 3, 23, 64, 57440 }, // †
-    { 15, 23, 14, 0, 23, 87, 57504 }, // ‡
-    { 8, 8, 11, 2, 15, 16, 57591 }, // •
-    { 10, 10, 11, 1, 16, 25, 57607 }, // ‣
-    { 4, 5, 15, 4, 4, 5, 57632 }, // ․
-    { 12, 5, 15, 0, 4, 15, 57637 }, // ‥
-    { 20, 5, 22, 0, 4, 25, 57652 }, // …
-    { 5, 5, 7, 1, 10, 7, 57677 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 57684 }, //  
-    { 0, 0, 18, 0, 0, 0, 57684 }, //  
-    { 8, 22, 0, -1, 18, 44, 57684 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 57728 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 57772 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 57822 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 57872 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 57922 }, //  
-    { 30, 23, 33, 2, 22, 173, 57922 }, // ‰
-    { 40, 23, 42, 2, 22, 230, 58095 }, // ‱
-    { 8, 8, 6, 1, 21, 16, 58325 }, // ′
-    { 13, 8, 11, 1, 21, 26, 58341 }, // ″
-    { 18, 8, 16, 1, 21, 36, 58367 }, // ‴
-    { 5, 8, 8, 3, 21, 10, 58403 }, // ‵
-    { 10, 8, 12, 3, 21, 20, 58413 }, // ‶
-    { 14, 8, 17, 3, 21, 28, 58433 }, // ‷
-    { 11, 10, 12, -3, 3, 28, 58461 }, // ‸
-    { 8, 13, 8, 1, 14, 26, 58489 }, // ‹
-    { 8, 13, 8, 0, 14, 26, 58515 }, // ›
-    { 22, 23, 24, 1, 22, 127, 58541 }, // ※
-    { 15, 22, 14, 0, 21, 83, 58668 }, // ‼
-    { 12, 23, 13, 2, 22, 69, 58751 }, // ‽
-    { 13, 3, 11, 2, 25, 10, 58820 }, // ‾
-    { 16, 7, 16, -2, 0, 28, 58830 }, // ‿
-    { 16, 7, 16, 2, 24, 28, 58858 }, // ⁀
-    { 14, 19, 10, -3, 12, 67, 58886 }, // ⁁
-    { 31, 27, 33, 0, 23, 210, 58953 }, // ⁂
-    { 8, 3, 8, 0, 9, 6, 59163 }, // ⁃
-    { 18, 21, 4, -7, 21, 95, 59169 }, // ⁄
-    { 12, 26, 8, -1, 21, 78, 59264 }, // ⁅
-    { 12, 26, 8, -3, 21, 78, 59342 }, // ⁆
-    { 24, 23, 25, 2, 22, 138, 59420 }, // ⁇
-    { 19, 23, 20, 2, 22, 110, 59558 }, // ⁈
-    { 21, 23, 20, 0, 22, 121, 59668 }, // ⁉
-    { 15, 16, 15, 1, 16, 60, 59789 }, // ⁊
-    { 15, 27, 17, 3, 23, 102, 59849 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 59951 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 60011 }, // ⁍
-    { 15, 15, 16, -1, 8, 57, 60071 }, // ⁎
-    { 7, 21, 7, 0, 17, 37, 60128 }, // ⁏
-    { 20, 31, 16, -2, 24, 155, 60165 }, // ⁐
-    { 17, 30, 16, 0, 23, 128, 60320 }, // ⁑
-    { 11, 23, 11, 0, 22, 64, 60448 }, // ⁒
-    { 26, 5, 29, 2, 11, 33, 60512 }, // ⁓
-    { 16, 7, 16, -3, 0, 28, 60545 }, // ⁔
-    { 16, 16, 17, 0, 15, 64, 60573 }, // ⁕
-    { 13, 23, 15, 1, 22, 75, 60637 }, // ⁖
-    { 23, 8, 21, 1, 21, 46, 60712 }, // ⁗
-    { 22, 23, 24, 1, 22, 127, 60758 }, // ⁘
-    { 22, 23, 24, 1, 22, 127, 60885 }, // ⁙
-    { 4, 23, 6, 1, 22, 23, 61012 }, // ⁚
-    { 17, 23, 19, 1, 22, 98, 61035 }, // ⁛
-    { 22, 23, 23, 1, 22, 127, 61133 }, // ⁜
-    { 4, 22, 8, 2, 21, 22, 61260 }, // ⁝
-    { 5, 23, 8, 2, 22, 29, 61282 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 61311 }, //  
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁤
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁦
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁧
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁨
-    { 0, 0, 18, 0, 0, 0, 61311 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 61311 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 61361 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 61411 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 61461 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 61511 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 61561 }, // ⁯
-    { 10, 14, 10, 2, 25, 35, 61611 }, // ⁰
-    { 5, 14, 7, 2, 22, 18, 61646 }, // ⁱ
-    { 10, 13, 10, 2, 25, 33, 61664 }, // ⁴
-    { 10, 14, 10, 2, 25, 35, 61697 }, // ⁵
-    { 10, 14, 10, 3, 25, 35, 61732 }, // ⁶
-    { 10, 13, 10, 3, 25, 33, 61767 }, // ⁷
-    { 10, 14, 10, 2, 25, 35, 61800 }, // ⁸
-    { 10, 14, 10, 2, 25, 35, 61835 }, // ⁹
-    { 8, 9, 10, 3, 22, 18, 61870 }, // ⁺
-    { 8, 3, 10, 3, 19, 6, 61888 }, // ⁻
-    { 8, 6, 10, 3, 21, 12, 61894 }, // ⁼
-    { 7, 17, 5, 3, 27, 30, 61906 }, // ⁽
-    { 7, 17, 5, 0, 27, 30, 61936 }, // ⁾
-    { 10, 10, 11, 2, 18, 25, 61966 }, // ⁿ
-    { 10, 14, 10, -1, 9, 35, 61991 }, // ₀
-    { 7, 13, 10, 0, 9, 23, 62026 }, // ₁
-    { 11, 13, 10, -2, 9, 36, 62049 }, // ₂
-    { 11, 14, 10, -2, 9, 39, 62085 }, // ₃
-    { 10, 13, 10, -1, 9, 33, 62124 }, // ₄
-    { 10, 14, 10, -1, 9, 35, 62157 }, // ₅
-    { 10, 14, 10, -1, 9, 35, 62192 }, // ₆
-    { 11, 13, 10, -1, 9, 36, 62227 }, // ₇
-    { 10, 14, 10, -1, 9, 35, 62263 }, // ₈
-    { 10, 14, 10, -1, 9, 35, 62298 }, // ₉
-    { 9, 9, 10, -1, 6, 21, 62333 }, // ₊
-    { 9, 3, 10, -1, 4, 7, 62354 }, // ₋
-    { 9, 6, 10, -1, 5, 14, 62361 }, // ₌
-    { 7, 17, 5, 0, 11, 30, 62375 }, // ₍
-    { 8, 17, 5, -4, 11, 34, 62405 }, // ₎
-    { 10, 10, 11, -1, 7, 25, 62439 }, // ₐ
-    { 9, 10, 9, -1, 7, 23, 62464 }, // ₑ
-    { 10, 10, 11, -1, 7, 25, 62487 }, // ₒ
-    { 12, 10, 9, -3, 7, 30, 62512 }, // ₓ
-    { 9, 10, 9, -2, 7, 23, 62542 }, // ₔ
-    { 10, 14, 13, 0, 11, 35, 62565 }, // ₕ
-    { 10, 14, 10, 0, 11, 35, 62600 }, // ₖ
-    { 5, 14, 7, 0, 11, 18, 62635 }, // ₗ
-    { 16, 10, 18, 0, 7, 40, 62653 }, // ₘ
-    { 11, 10, 11, -2, 7, 28, 62693 }, // ₙ
-    { 11, 14, 11, -2, 7, 39, 62721 }, // ₚ
-    { 8, 10, 9, -1, 7, 20, 62760 }, // ₛ
-    { 7, 12, 6, -1, 9, 21, 62780 }, // ₜ
-    { 15, 22, 16, 2, 22, 83, 62801 }, // ₠
-    { 17, 25, 16, 1, 23, 107, 62884 }, // ₡
-    { 16, 23, 16, 1, 22, 92, 62991 }, // ₢
-    { 17, 21, 16, 0, 21, 90, 63083 }, // ₣
-    { 18, 22, 16, -1, 22, 99, 63173 }, // ₤
-    { 24, 24, 26, 0, 20, 144, 63272 }, // ₥
-    { 17, 21, 16, 0, 21, 90, 63416 }, // ₦
-    { 21, 22, 22, 0, 21, 116, 63506 }, // ₧
-    { 24, 22, 23, 0, 21, 132, 63622 }, // ₨
-    { 21, 21, 18, 0, 21, 111, 63754 }, // ₩
-    { 24, 21, 23, 0, 21, 126, 63865 }, // ₪
-    { 19, 28, 17, 0, 23, 133, 63991 }, // ₫
-    { 18, 23, 16, 0, 22, 104, 64124 }, // €
-    { 19, 21, 16, 0, 21, 100, 64228 }, // ₭
-    { 17, 21, 15, 1, 21, 90, 64328 }, // ₮
-    { 28, 29, 28, 0, 22, 203, 64418 }, // ₯
-    { 19, 29, 16, -2, 22, 138, 64621 }, // ₰
-    { 17, 21, 16, 1, 21, 90, 64759 }, // ₱
-    { 18, 26, 20, 2, 23, 117, 64849 }, // ₲
-    { 20, 21, 16, -2, 21, 105, 64966 }, // ₳
-    { 18, 23, 15, -1, 22, 104, 65071 }, // ₴
-    { 17, 26, 17, 2, 23, 111, 65175 }, // ₵
-    { 18, 21, 17, 0, 20, 95, 65286 }, // ₶
-    { 21, 25, 19, -1, 22, 132, 65381 }, // ₷
-    { 16, 21, 14, 1, 21, 84, 65513 }, // ₸
-    { 15, 21, 16, 2, 21, 79, 65597 }, // ₹
-    { 16, 22, 16, 0, 21, 88, 65676 }, // ₺
-    { 19, 23, 20, 1, 22, 110, 65764 }, // ₻
-    { 22, 21, 22, -1, 21, 116, 65874 }, // ₼
-    { 19, 21, 17, -1, 21, 100, 65990 }, // ₽
-    { 20, 24, 17, -1, 24, 120, 66090 }, // ₾
-    { 16, 27, 16, 1, 24, 108, 66210 }, // ₿
-    { 9, 3, 9, 0, 9, 7, 66318 }, // −
-    { 27, 28, 29, 1, 23, 189, 66325 }, // �
+    { 23, 24, 25, 1, 21, 138, 2048 }, // @
+    { 17, 21, 16, -2, 21, 90, 2186 }, // A
+    { 17, 21, 18, 1, 21, 90, 2276 }, // B
+    { 17, 23, 17, 2, 22, 98, 2366 }, // C
+    { 18, 21, 19, 1, 21, 95, 2464 }, // D
+    { 16, 21, 15, 1, 21, 84, 2559 }, // E
+    { 16, 21, 14, 1, 21, 84, 2643 }, // F
+    { 18, 23, 20, 2, 22, 104, 2727 }, // G
+    { 19, 21, 20, 1, 21, 100, 2831 }, // H
+    { 13, 21, 9, -1, 21, 69, 2931 }, // I
+    { 14, 27, 8, -5, 21, 95, 3000 }, // J
+    { 18, 21, 16, 1, 21, 95, 3095 }, // K
+    { 12, 21, 14, 1, 21, 63, 3190 }, // L
+    { 24, 21, 25, 1, 21, 126, 3253 }, // M
+    { 20, 21, 21, 1, 21, 105, 3379 }, // N
+    { 19, 23, 21, 2, 22, 110, 3484 }, // O
+    { 16, 21, 17, 1, 21, 84, 3594 }, // P
+    { 19, 27, 21, 2, 22, 129, 3678 }, // Q
+    { 16, 21, 17, 1, 21, 84, 3807 }, // R
+    { 16, 23, 15, 0, 22, 92, 3891 }, // S
+    { 16, 21, 15, 2, 21, 84, 3983 }, // T
+    { 19, 22, 20, 2, 21, 105, 4096 }, // U
+    { 17, 21, 16, 2, 21, 90, 4201 }, // V
+    { 25, 21, 25, 3, 21, 132, 4291 }, // W
+    { 20, 21, 15, -2, 21, 105, 4423 }, // X
+    { 16, 21, 15, 2, 21, 84, 4528 }, // Y
+    { 18, 21, 15, -1, 21, 95, 4612 }, // Z
+    { 12, 26, 8, -1, 21, 78, 4707 }, // [
+    { 6, 21, 10, 3, 21, 32, 4785 }, // <backslash>
+    { 12, 26, 8, -3, 21, 78, 4817 }, // ]
+    { 15, 14, 17, 1, 21, 53, 4895 }, // ^
+    { 13, 3, 12, -3, -2, 10, 4948 }, // _
+    { 6, 6, 8, 4, 23, 9, 4958 }, // `
+    { 16, 17, 17, 1, 16, 68, 4967 }, // a
+    { 16, 24, 17, 0, 23, 96, 5035 }, // b
+    { 13, 17, 13, 1, 16, 56, 5131 }, // c
+    { 17, 24, 17, 1, 23, 102, 5187 }, // d
+    { 13, 17, 15, 1, 16, 56, 5289 }, // e
+    { 17, 30, 9, -4, 23, 128, 5345 }, // f
+    { 17, 23, 17, 0, 16, 98, 5473 }, // g
+    { 16, 23, 17, 0, 23, 92, 5571 }, // h
+    { 8, 22, 8, 0, 22, 44, 5663 }, // i
+    { 12, 29, 8, -4, 22, 87, 5707 }, // j
+    { 16, 23, 14, 0, 23, 92, 5794 }, // k
+    { 9, 23, 8, 0, 23, 52, 5886 }, // l
+    { 24, 16, 26, 0, 16, 96, 5938 }, // m
+    { 16, 17, 17, 0, 17, 68, 6034 }, // n
+    { 15, 17, 16, 1, 16, 64, 6144 }, // o
+    { 17, 23, 17, -1, 16, 98, 6208 }, // p
+    { 16, 23, 17, 1, 16, 92, 6306 }, // q
+    { 13, 16, 12, 0, 16, 52, 6398 }, // r
+    { 13, 17, 13, 0, 16, 56, 6450 }, // s
+    { 10, 21, 10, 1, 20, 53, 6506 }, // t
+    { 16, 17, 17, 1, 16, 68, 6559 }, // u
+    { 15, 16, 14, 1, 16, 60, 6627 }, // v
+    { 22, 16, 21, 1, 16, 88, 6687 }, // w
+    { 17, 16, 14, -2, 16, 68, 6775 }, // x
+    { 19, 23, 14, -3, 16, 110, 6843 }, // y
+    { 14, 16, 13, -1, 16, 56, 6953 }, // z
+    { 12, 26, 10, 0, 21, 78, 7009 }, // {
+    { 3, 31, 16, 7, 23, 24, 7087 }, // |
+    { 13, 26, 10, -2, 21, 85, 7111 }, // }
+    { 14, 5, 17, 2, 13, 18, 7196 }, // ~
+    { 0, 0, 8, 0, 0, 0, 7214 }, //  
+    { 9, 22, 8, -1, 16, 50, 7214 }, // ¡
+    { 13, 23, 16, 3, 22, 75, 7264 }, // ¢
+    { 18, 22, 16, -1, 22, 99, 7339 }, // £
+    { 13, 13, 16, 2, 17, 43, 7438 }, // ¤
+    { 17, 21, 16, 1, 21, 90, 7481 }, // ¥
+    { 3, 31, 16, 7, 23, 24, 7571 }, // ¦
+    { 15, 24, 14, 0, 23, 90, 7595 }, // §
+    { 9, 4, 16, 6, 22, 9, 7685 }, // ¨
+    { 22, 23, 24, 1, 22, 127, 7694 }, // ©
+    { 10, 11, 10, 2, 22, 28, 7821 }, // ª
+    { 13, 13, 14, 1, 14, 43, 7849 }, // «
+    { 14, 9, 17, 2, 12, 32, 7892 }, // ¬
+    { 9, 3, 9, 0, 9, 7, 7924 }, // ­
+    { 22, 23, 24, 1, 22, 127, 7931 }, // ®
+    { 13, 3, 11, 2, 25, 10, 8058 }, // ¯
+    { 10, 10, 12, 1, 22, 25, 8068 }, // °
+    { 14, 18, 17, 2, 18, 63, 8093 }, // ±
+    { 10, 13, 10, 2, 25, 33, 8156 }, // ²
+    { 10, 14, 10, 2, 25, 35, 8192 }, // ³
+    { 7, 6, 8, 3, 23, 11, 8227 }, // ´
+    { 18, 23, 17, -1, 16, 104, 8238 }, // µ
+    { 16, 27, 19, 2, 23, 108, 8342 }, // ¶
+    { 5, 5, 7, 2, 13, 7, 8450 }, // ·
+    { 7, 7, 6, -3, 0, 13, 8457 }, // ¸
+    { 7, 13, 10, 4, 25, 23, 8470 }, // ¹
+    { 9, 11, 10, 2, 22, 25, 8493 }, // º
+    { 13, 13, 14, 0, 14, 43, 8518 }, // »
+    { 19, 21, 21, 2, 21, 100, 8561 }, // ¼
+    { 21, 21, 23, 2, 21, 111, 8661 }, // ½
+    { 22, 21, 23, 1, 21, 116, 8772 }, // ¾
+    { 12, 22, 13, -1, 16, 66, 8888 }, // ¿
+    { 17, 28, 16, -2, 28, 119, 8954 }, // À
+    { 19, 28, 16, -2, 28, 133, 9073 }, // Á
+    { 18, 28, 16, -2, 28, 126, 9206 }, // Â
+    { 20, 27, 16, -2, 27, 135, 9332 }, // Ã
+    { 18, 27, 16, -2, 27, 122, 9467 }, // Ä
+    { 17, 29, 16, -2, 29, 124, 9589 }, // Å
+    { 28, 21, 24, -2, 21, 147, 9713 }, // Æ
+    { 17, 29, 17, 2, 22, 124, 9860 }, // Ç
+    { 16, 28, 15, 1, 28, 112, 9984 }, // È
+    { 16, 28, 15, 1, 28, 112, 10096 }, // É
+    { 16, 28, 15, 1, 28, 112, 10240 }, // Ê
+    { 16, 27, 15, 1, 27, 108, 10352 }, // Ë
+    { 13, 28, 9, -1, 28, 91, 10460 }, // Ì
+    { 14, 28, 9, -1, 28, 98, 10551 }, // Í
+    { 14, 28, 9, -1, 28, 98, 10649 }, // Î
+    { 14, 27, 9, -1, 27, 95, 10747 }, // Ï
+    { 19, 21, 19, 0, 21, 100, 10842 }, // Ð
+    { 20, 27, 21, 1, 27, 135, 10942 }, // Ñ
+    { 19, 29, 21, 2, 28, 138, 11077 }, // Ò
+    { 19, 29, 21, 2, 28, 138, 11215 }, // Ó
+    { 19, 29, 21, 2, 28, 138, 11353 }, // Ô
+    { 19, 28, 21, 2, 27, 133, 11491 }, // Õ
+    { 19, 28, 21, 2, 27, 133, 11624 }, // Ö
+    { 14, 14, 17, 2, 17, 49, 11757 }, // ×
+    { 20, 24, 21, 1, 22, 120, 11806 }, // Ø
+    { 19, 29, 20, 2, 28, 138, 11926 }, // Ù
+    { 19, 29, 20, 2, 28, 138, 12064 }, // Ú
+    { 19, 29, 20, 2, 28, 138, 12288 }, // Û
+    { 19, 28, 20, 2, 27, 133, 12426 }, // Ü
+    { 16, 28, 15, 2, 28, 112, 12559 }, // Ý
+    { 15, 21, 17, 1, 21, 79, 12671 }, // Þ
+    { 21, 30, 17, -4, 23, 158, 12750 }, // ß
+    { 16, 24, 17, 1, 23, 96, 12908 }, // à
+    { 16, 24, 17, 1, 23, 96, 13004 }, // á
+    { 16, 24, 17, 1, 23, 96, 13100 }, // â
+    { 16, 23, 17, 1, 22, 92, 13196 }, // ã
+    { 16, 23, 17, 1, 22, 92, 13288 }, // ä
+    { 16, 25, 17, 1, 24, 100, 13380 }, // å
+    { 23, 17, 24, 1, 16, 98, 13480 }, // æ
+    { 13, 23, 13, 1, 16, 75, 13578 }, // ç
+    { 13, 24, 15, 1, 23, 78, 13653 }, // è
+    { 14, 24, 15, 1, 23, 84, 13731 }, // é
+    { 13, 24, 15, 1, 23, 78, 13815 }, // ê
+    { 13, 23, 15, 1, 22, 75, 13893 }, // ë
+    { 8, 23, 8, 0, 23, 46, 13968 }, // ì
+    { 11, 23, 8, 0, 23, 64, 14014 }, // í
+    { 11, 23, 8, 0, 23, 64, 14078 }, // î
+    { 11, 22, 8, 0, 22, 61, 14142 }, // ï
+    { 16, 24, 17, 1, 23, 96, 14203 }, // ð
+    { 17, 22, 17, 0, 22, 94, 14336 }, // ñ
+    { 15, 24, 16, 1, 23, 90, 14430 }, // ò
+    { 15, 24, 16, 1, 23, 90, 14520 }, // ó
+    { 15, 24, 16, 1, 23, 90, 14610 }, // ô
+    { 15, 23, 16, 1, 22, 87, 14700 }, // õ
+    { 15, 23, 16, 1, 22, 87, 14787 }, // ö
+    { 14, 14, 17, 2, 17, 49, 14874 }, // ÷
+    { 16, 19, 16, 0, 17, 76, 14923 }, // ø
+    { 16, 24, 17, 1, 23, 96, 14999 }, // ù
+    { 16, 24, 17, 1, 23, 96, 15095 }, // ú
+    { 16, 24, 17, 1, 23, 96, 15191 }, // û
+    { 16, 23, 17, 1, 22, 92, 15287 }, // ü
+    { 19, 30, 14, -3, 23, 143, 15379 }, // ý
+    { 17, 30, 17, -1, 23, 128, 15522 }, // þ
+    { 19, 29, 14, -3, 22, 138, 15650 }, // ÿ
+    { 18, 25, 16, -2, 25, 113, 15788 }, // Ā
+    { 16, 21, 17, 1, 20, 84, 15901 }, // ā
+    { 19, 27, 16, -2, 27, 129, 15985 }, // Ă
+    { 16, 23, 17, 1, 22, 92, 16114 }, // ă
+    { 17, 28, 16, -2, 21, 119, 16206 }, // Ą
+    { 16, 23, 17, 1, 16, 92, 16384 }, // ą
+    { 17, 29, 17, 2, 28, 124, 16476 }, // Ć
+    { 14, 24, 13, 1, 23, 84, 16600 }, // ć
+    { 17, 29, 17, 2, 28, 124, 16684 }, // Ĉ
+    { 13, 24, 13, 1, 23, 78, 16808 }, // ĉ
+    { 17, 28, 17, 2, 27, 119, 16886 }, // Ċ
+    { 13, 23, 13, 1, 22, 75, 17005 }, // ċ
+    { 17, 29, 17, 2, 28, 124, 17080 }, // Č
+    { 14, 24, 13, 1, 23, 84, 17204 }, // č
+    { 18, 28, 19, 1, 28, 126, 17288 }, // Ď
+    { 22, 24, 18, 1, 23, 132, 17414 }, // ď
+    { 19, 21, 19, 0, 21, 100, 17546 }, // Đ
+    { 18, 24, 17, 1, 23, 108, 17646 }, // đ
+    { 16, 25, 15, 1, 25, 100, 17754 }, // Ē
+    { 13, 21, 15, 1, 20, 69, 17854 }, // ē
+    { 16, 27, 15, 1, 27, 108, 17923 }, // Ĕ
+    { 14, 23, 15, 1, 22, 81, 18031 }, // ĕ
+    { 16, 27, 15, 1, 27, 108, 18112 }, // Ė
+    { 13, 23, 15, 1, 22, 75, 18220 }, // ė
+    { 16, 28, 15, 1, 21, 112, 18295 }, // Ę
+    { 13, 23, 15, 1, 16, 75, 18432 }, // ę
+    { 16, 28, 15, 1, 28, 112, 18507 }, // Ě
+    { 14, 24, 15, 1, 23, 84, 18619 }, // ě
+    { 18, 29, 20, 2, 28, 131, 18703 }, // Ĝ
+    { 17, 30, 17, 0, 23, 128, 18834 }, // ĝ
+    { 18, 28, 20, 2, 27, 126, 18962 }, // Ğ
+    { 17, 29, 17, 0, 22, 124, 19088 }, // ğ
+    { 18, 28, 20, 2, 27, 126, 19212 }, // Ġ
+    { 17, 29, 17, 0, 22, 124, 19338 }, // ġ
+    { 18, 29, 20, 2, 22, 131, 19462 }, // Ģ
+    { 17, 30, 17, 0, 23, 128, 19593 }, // ģ
+    { 19, 28, 20, 1, 28, 133, 19721 }, // Ĥ
+    { 16, 30, 17, 0, 30, 120, 19854 }, // ĥ
+    { 21, 21, 20, 1, 21, 111, 19974 }, // Ħ
+    { 16, 23, 17, 0, 23, 92, 20085 }, // ħ
+    { 15, 27, 9, -1, 27, 102, 20177 }, // Ĩ
+    { 12, 22, 8, 0, 22, 66, 20279 }, // ĩ
+    { 14, 25, 9, -1, 25, 88, 20345 }, // Ī
+    { 11, 20, 8, 0, 20, 55, 20480 }, // ī
+    { 14, 27, 9, -1, 27, 95, 20535 }, // Ĭ
+    { 11, 22, 8, 0, 22, 61, 20630 }, // ĭ
+    { 13, 28, 9, -1, 21, 91, 20691 }, // Į
+    { 9, 29, 8, -1, 22, 66, 20782 }, // į
+    { 13, 27, 9, -1, 27, 88, 20848 }, // İ
+    { 7, 16, 8, 0, 16, 28, 20936 }, // ı
+    { 19, 27, 17, -1, 21, 129, 20964 }, // Ĳ
+    { 16, 29, 15, 0, 22, 116, 21093 }, // ĳ
+    { 17, 34, 8, -5, 28, 145, 21209 }, // Ĵ
+    { 15, 30, 8, -4, 23, 113, 21354 }, // ĵ
+    { 18, 28, 16, 1, 21, 126, 21467 }, // Ķ
+    { 16, 30, 14, 0, 23, 120, 21593 }, // ķ
+    { 16, 16, 14, 0, 16, 64, 21713 }, // ĸ
+    { 12, 28, 14, 1, 28, 84, 21777 }, // Ĺ
+    { 12, 30, 8, 0, 30, 90, 21861 }, // ĺ
+    { 12, 28, 14, 1, 21, 84, 21951 }, // Ļ
+    { 11, 30, 8, -2, 23, 83, 22035 }, // ļ
+    { 15, 21, 14, 1, 21, 79, 22118 }, // Ľ
+    { 13, 23, 8, 0, 23, 75, 22197 }, // ľ
+    { 12, 21, 14, 1, 21, 63, 22272 }, // Ŀ
+    { 11, 23, 9, 0, 23, 64, 22335 }, // ŀ
+    { 13, 21, 14, 0, 21, 69, 22399 }, // Ł
+    { 9, 23, 8, 0, 23, 52, 22468 }, // ł
+    { 20, 28, 21, 1, 28, 140, 22528 }, // Ń
+    { 16, 23, 17, 0, 23, 92, 22668 }, // ń
+    { 20, 28, 21, 1, 21, 140, 22760 }, // Ņ
+    { 16, 24, 17, 0, 17, 96, 22900 }, // ņ
+    { 20, 28, 21, 1, 28, 140, 22996 }, // Ň
+    { 16, 23, 17, 0, 23, 92, 23136 }, // ň
+    { 17, 21, 19, 1, 21, 90, 23228 }, // ŉ
+    { 20, 27, 21, 1, 21, 135, 23318 }, // Ŋ
+    { 16, 23, 17, 0, 16, 92, 23453 }, // ŋ
+    { 19, 26, 21, 2, 25, 124, 23545 }, // Ō
+    { 15, 21, 16, 1, 20, 79, 23669 }, // ō
+    { 19, 28, 21, 2, 27, 133, 23748 }, // Ŏ
+    { 15, 23, 16, 1, 22, 87, 23881 }, // ŏ
+    { 20, 29, 21, 2, 28, 145, 23968 }, // Ő
+    { 17, 24, 16, 1, 23, 102, 24113 }, // ő
+    { 25, 23, 25, 2, 22, 144, 24215 }, // Œ
+    { 24, 17, 25, 1, 16, 102, 24359 }, // œ
+    { 16, 28, 17, 1, 28, 112, 24461 }, // Ŕ
+    { 14, 23, 12, 0, 23, 81, 24576 }, // ŕ
+    { 16, 28, 17, 1, 21, 112, 24657 }, // Ŗ
+    { 14, 23, 12, -1, 16, 81, 24769 }, // ŗ
+    { 16, 28, 17, 1, 28, 112, 24850 }, // Ř
+    { 15, 23, 12, 0, 23, 87, 24962 }, // ř
+    { 16, 29, 15, 0, 28, 116, 25049 }, // Ś
+    { 13, 24, 13, 0, 23, 78, 25165 }, // ś
+    { 16, 29, 15, 0, 28, 116, 25243 }, // Ŝ
+    { 13, 24, 13, 0, 23, 78, 25359 }, // ŝ
+    { 16, 29, 15, 0, 22, 116, 25437 }, // Ş
+    { 13, 23, 13, 0, 16, 75, 25553 }, // ş
+    { 16, 29, 15, 0, 28, 116, 25628 }, // Š
+    { 14, 24, 13, 0, 23, 84, 25744 }, // š
+    { 16, 28, 15, 2, 21, 112, 25828 }, // Ţ
+    { 11, 27, 10, 0, 20, 75, 25940 }, // ţ
+    { 16, 28, 15, 2, 28, 112, 26015 }, // Ť
+    { 12, 24, 10, 1, 23, 72, 26127 }, // ť
+    { 16, 21, 15, 2, 21, 84, 26199 }, // Ŧ
+    { 11, 21, 10, 0, 20, 58, 26283 }, // ŧ
+    { 19, 28, 20, 2, 27, 133, 26341 }, // Ũ
+    { 16, 23, 17, 1, 22, 92, 26474 }, // ũ
+    { 19, 26, 20, 2, 25, 124, 26624 }, // Ū
+    { 16, 21, 17, 1, 20, 84, 26748 }, // ū
+    { 19, 28, 20, 2, 27, 133, 26832 }, // Ŭ
+    { 16, 23, 17, 1, 22, 92, 26965 }, // ŭ
+    { 19, 30, 20, 2, 29, 143, 27057 }, // Ů
+    { 16, 25, 17, 1, 24, 100, 27200 }, // ů
+    { 19, 29, 20, 2, 28, 138, 27300 }, // Ű
+    { 17, 24, 17, 1, 23, 102, 27438 }, // ű
+    { 19, 28, 20, 2, 21, 133, 27540 }, // Ų
+    { 16, 23, 17, 1, 16, 92, 27673 }, // ų
+    { 25, 28, 25, 3, 28, 175, 27765 }, // Ŵ
+    { 22, 23, 21, 1, 23, 127, 27940 }, // ŵ
+    { 16, 28, 15, 2, 28, 112, 28067 }, // Ŷ
+    { 19, 30, 14, -3, 23, 143, 28179 }, // ŷ
+    { 16, 27, 15, 2, 27, 108, 28322 }, // Ÿ
+    { 18, 28, 15, -1, 28, 126, 28430 }, // Ź
+    { 15, 23, 13, -1, 23, 87, 28556 }, // ź
+    { 18, 27, 15, -1, 27, 122, 28672 }, // Ż
+    { 14, 22, 13, -1, 22, 77, 28794 }, // ż
+    { 18, 28, 15, -1, 28, 126, 28871 }, // Ž
+    { 15, 23, 13, -1, 23, 87, 28997 }, // ž
+    { 17, 30, 8, -4, 23, 128, 29084 }, // ſ
+    { 6, 6, 0, -12, 23, 9, 29212 }, // ̀
+    { 7, 6, 0, -7, 23, 11, 29221 }, // ́
+    { 10, 6, 0, -3, 23, 15, 29232 }, // ̂
+    { 12, 5, 0, -13, 22, 15, 29247 }, // ̃
+    { 9, 3, 0, -2, 20, 7, 29262 }, // ̄
+    { 13, 3, 0, -3, 25, 10, 29269 }, // ̅
+    { 9, 5, 0, -2, 22, 12, 29279 }, // ̆
+    { 4, 4, 0, 1, 22, 4, 29291 }, // ̇
+    { 9, 4, 0, -2, 22, 9, 29295 }, // ̈
+    { 6, 7, 0, -9, 24, 11, 29304 }, // ̉
+    { 7, 7, 0, -1, 24, 13, 29315 }, // ̊
+    { 12, 6, 0, -2, 23, 18, 29328 }, // ̋
+    { 10, 6, 0, -2, 23, 15, 29346 }, // ̌
+    { 5, 9, 0, 0, 23, 12, 29361 }, // ̍
+    { 9, 6, 0, -2, 23, 14, 29373 }, // ̎
+    { 11, 6, 0, -15, 23, 17, 29387 }, // ̏
+    { 10, 8, 0, -2, 25, 20, 29404 }, // ̐
+    { 9, 5, 0, -2, 22, 12, 29424 }, // ̑
+    { 6, 8, 0, -1, 21, 12, 29436 }, // ̒
+    { 6, 8, 0, -1, 21, 12, 29448 }, // ̓
+    { 4, 8, 0, 0, 21, 8, 29460 }, // ̔
+    { 6, 8, 0, -1, 21, 12, 29468 }, // ̕
+    { 6, 6, 0, -6, -1, 9, 29480 }, // ̖
+    { 7, 6, 0, -5, -1, 11, 29489 }, // ̗
+    { 6, 7, 0, -5, 0, 11, 29500 }, // ̘
+    { 7, 7, 0, -6, 0, 13, 29511 }, // ̙
+    { 10, 9, 10, 2, 23, 23, 29524 }, // ̚
+    { 8, 7, 0, -2, 23, 14, 29547 }, // ̛
+    { 5, 7, 0, -2, 0, 9, 29561 }, // ̜
+    { 7, 6, 0, -6, -1, 11, 29570 }, // ̝
+    { 8, 6, 0, -6, -1, 12, 29581 }, // ̞
+    { 7, 7, 0, -6, 0, 13, 29593 }, // ̟
+    { 7, 3, 0, -6, -3, 6, 29606 }, // ̠
+    { 7, 9, 0, -6, 2, 16, 29612 }, // ̡
+    { 6, 9, 0, -3, 2, 14, 29628 }, // ̢
+    { 4, 5, 0, -13, -1, 5, 29642 }, // ̣
+    { 9, 4, 0, -7, -2, 9, 29647 }, // ̤
+    { 7, 7, 0, -6, 0, 13, 29656 }, // ̥
+    { 5, 6, 0, 2, -1, 8, 29669 }, // ̦
+    { 6, 7, 0, -5, 0, 11, 29677 }, // ̧
+    { 6, 7, 0, -5, 0, 11, 29688 }, // ̨
+    { 5, 9, 0, -5, 0, 12, 29699 }, // ̩
+    { 12, 6, 0, -8, -1, 18, 29711 }, // ̪
+    { 12, 5, 0, -8, -1, 15, 29729 }, // ̫
+    { 10, 6, 0, -7, 0, 15, 29744 }, // ̬
+    { 10, 6, 0, -7, -1, 15, 29759 }, // ̭
+    { 9, 5, 0, -6, -1, 12, 29774 }, // ̮
+    { 9, 5, 0, -7, -1, 12, 29786 }, // ̯
+    { 11, 5, 0, -8, -1, 14, 29798 }, // ̰
+    { 9, 3, 0, -7, -2, 7, 29812 }, // ̱
+    { 13, 3, 0, -9, -2, 10, 29819 }, // ̲
+    { 14, 7, 0, -9, 0, 25, 29829 }, // ̳
+    { 12, 5, 0, -6, 10, 15, 29854 }, // ̴
+    { 12, 3, 0, -6, 10, 9, 29869 }, // ̵
+    { 20, 3, 0, -10, 10, 15, 29878 }, // ̶
+    { 10, 7, 0, -5, 12, 18, 29893 }, // ̷
+    { 16, 25, 0, -8, 23, 100, 29911 }, // ̸
+    { 5, 8, 0, -2, 1, 10, 30011 }, // ̹
+    { 12, 6, 0, -8, -1, 18, 30021 }, // ̺
+    { 12, 7, 0, -8, 0, 21, 30039 }, // ̻
+    { 12, 5, 0, -8, -1, 15, 30060 }, // ̼
+    { 8, 7, 0, -1, 23, 14, 30075 }, // ̽
+    { 7, 10, 0, -1, 26, 18, 30089 }, // ̾
+    { 14, 7, 0, -3, 29, 25, 30107 }, // ̿
+    { 6, 6, 0, -2, 23, 9, 30132 }, // ̀
+    { 7, 6, 0, 1, 23, 11, 30141 }, // ́
+    { 12, 5, 0, 4, 22, 15, 30152 }, // ͂
+    { 6, 6, 0, 0, 23, 9, 30167 }, // ̓
+    { 11, 6, 0, -3, 23, 17, 30176 }, // ̈́
+    { 5, 5, 0, -4, -2, 7, 30193 }, // ͅ
+    { 14, 6, 0, -4, 23, 21, 30200 }, // ͆
+    { 14, 7, 0, -9, 0, 25, 30221 }, // ͇
+    { 9, 6, 0, -7, 0, 14, 30246 }, // ͈
+    { 7, 6, 0, -5, -1, 11, 30260 }, // ͉
+    { 11, 7, 0, -3, 23, 20, 30271 }, // ͊
+    { 12, 11, 0, -3, 27, 33, 30291 }, // ͋
+    { 12, 8, 0, -3, 25, 24, 30324 }, // ͌
+    { 11, 6, 0, -8, -1, 17, 30348 }, // ͍
+    { 6, 7, 0, -5, 0, 11, 30365 }, // ͎
+    { 22, 21, 0, -11, 21, 116, 30376 }, // ͏
+    { 5, 7, 0, 0, 24, 9, 30492 }, // ͐
+    { 5, 7, 0, 3, 24, 9, 30501 }, // ͑
+    { 9, 8, 0, -2, 25, 18, 30510 }, // ͒
+    { 7, 7, 0, -5, 0, 13, 30528 }, // ͓
+    { 6, 6, 0, -5, -1, 9, 30541 }, // ͔
+    { 6, 6, 0, -4, -1, 9, 30550 }, // ͕
+    { 12, 6, 0, -7, -1, 18, 30559 }, // ͖
+    { 4, 8, 0, 3, 25, 8, 30577 }, // ͗
+    { 4, 4, 0, 1, 22, 4, 30585 }, // ͘
+    { 7, 6, 0, -6, -1, 11, 30589 }, // ͙
+    { 12, 7, 0, -8, 0, 21, 30600 }, // ͚
+    { 6, 6, 0, 0, 23, 9, 30621 }, // ͛
+    { 22, 6, 0, -13, -1, 33, 30630 }, // ͜
+    { 21, 6, 0, -8, 23, 32, 30663 }, // ͝
+    { 15, 3, 0, -5, 20, 12, 30695 }, // ͞
+    { 16, 3, 0, -10, -2, 12, 30707 }, // ͟
+    { 22, 5, 0, -8, 22, 28, 30720 }, // ͠
+    { 21, 6, 0, -8, 25, 32, 30748 }, // ͡
+    { 22, 6, 0, -14, -1, 33, 30780 }, // ͢
+    { 8, 8, 0, -1, 25, 16, 30813 }, // ͣ
+    { 6, 8, 0, 0, 25, 12, 30829 }, // ͤ
+    { 4, 9, 0, 1, 27, 9, 30841 }, // ͥ
+    { 7, 7, 0, -1, 25, 13, 30850 }, // ͦ
+    { 8, 8, 0, -1, 25, 16, 30863 }, // ͧ
+    { 6, 8, 0, 0, 25, 12, 30879 }, // ͨ
+    { 8, 10, 0, -1, 27, 20, 30891 }, // ͩ
+    { 7, 9, 0, -1, 27, 16, 30911 }, // ͪ
+    { 11, 7, 0, -3, 25, 20, 30927 }, // ͫ
+    { 6, 7, 0, 0, 25, 11, 30947 }, // ͬ
+    { 5, 9, 0, 1, 26, 12, 30958 }, // ͭ
+    { 7, 7, 0, 0, 25, 13, 30970 }, // ͮ
+    { 8, 7, 0, -1, 25, 14, 30983 }, // ͯ
+    { 16, 28, 15, 0, 28, 112, 30997 }, // Ѐ
+    { 16, 27, 15, 0, 27, 108, 31109 }, // Ё
+    { 16, 22, 19, 2, 21, 88, 31217 }, // Ђ
+    { 16, 28, 14, 0, 28, 112, 31305 }, // Ѓ
+    { 18, 23, 17, 1, 22, 104, 31417 }, // Є
+    { 16, 23, 15, 0, 22, 92, 31521 }, // Ѕ
+    { 9, 21, 8, 0, 21, 48, 31613 }, // І
+    { 11, 27, 8, 0, 27, 75, 31661 }, // Ї
+    { 14, 27, 8, -5, 21, 95, 31736 }, // Ј
+    { 28, 22, 27, -2, 21, 154, 31831 }, // Љ
+    { 26, 21, 27, 0, 21, 137, 31985 }, // Њ
+    { 17, 21, 20, 2, 21, 90, 32122 }, // Ћ
+    { 19, 28, 16, 0, 28, 133, 32212 }, // Ќ
+    { 21, 28, 20, 0, 28, 147, 32345 }, // Ѝ
+    { 19, 28, 16, 0, 27, 133, 32492 }, // Ў
+    { 20, 26, 19, 0, 21, 130, 32625 }, // Џ
+    { 17, 21, 17, -2, 21, 90, 32768 }, // А
+    { 17, 21, 16, 0, 21, 90, 32858 }, // Б
+    { 17, 21, 17, 0, 21, 90, 32948 }, // В
+    { 16, 21, 14, 0, 21, 84, 33038 }, // Г
+    { 23, 26, 20, -3, 21, 150, 33122 }, // Д
+    { 16, 21, 15, 0, 21, 84, 33272 }, // Е
+    { 28, 21, 23, -2, 21, 147, 33356 }, // Ж
+    { 16, 23, 15, -1, 22, 92, 33503 }, // З
+    { 21, 21, 20, 0, 21, 111, 33595 }, // И
+    { 21, 27, 20, 0, 27, 142, 33706 }, // Й
+    { 19, 21, 16, 0, 21, 100, 33848 }, // К
+    { 22, 22, 20, -2, 21, 121, 33948 }, // Л
+    { 25, 21, 24, 0, 21, 132, 34069 }, // М
+    { 20, 21, 20, 0, 21, 105, 34201 }, // Н
+    { 19, 23, 20, 1, 22, 110, 34306 }, // О
+    { 20, 21, 19, 0, 21, 105, 34416 }, // П
+    { 17, 21, 16, 0, 21, 90, 34521 }, // Р
+    { 18, 23, 17, 1, 22, 104, 34611 }, // С
+    { 16, 21, 15, 2, 21, 84, 34715 }, // Т
+    { 19, 22, 16, 0, 21, 105, 34816 }, // У
+    { 22, 23, 23, 1, 22, 127, 34921 }, // Ф
+    { 20, 21, 16, -2, 21, 105, 35048 }, // Х
+    { 20, 26, 20, 0, 21, 130, 35153 }, // Ц
+    { 17, 21, 18, 2, 21, 90, 35283 }, // Ч
+    { 28, 21, 28, 0, 21, 147, 35373 }, // Ш
+    { 28, 26, 28, 0, 21, 182, 35520 }, // Щ
+    { 16, 21, 19, 2, 21, 84, 35702 }, // Ъ
+    { 24, 21, 23, 0, 21, 126, 35786 }, // Ы
+    { 15, 21, 16, 0, 21, 79, 35912 }, // Ь
+    { 17, 23, 17, 0, 22, 98, 35991 }, // Э
+    { 27, 23, 27, 0, 22, 156, 36089 }, // Ю
+    { 19, 21, 17, -2, 21, 100, 36245 }, // Я
+    { 15, 17, 17, 1, 16, 64, 36345 }, // а
+    { 16, 24, 16, 1, 23, 96, 36409 }, // б
+    { 14, 17, 15, 1, 16, 60, 36505 }, // в
+    { 13, 17, 13, 0, 16, 56, 36565 }, // г
+    { 15, 24, 16, 1, 23, 90, 36621 }, // д
+    { 13, 17, 14, 1, 16, 56, 36711 }, // е
+    { 27, 17, 26, -1, 16, 115, 36864 }, // ж
+    { 13, 17, 13, 0, 16, 56, 36979 }, // з
+    { 15, 17, 17, 1, 16, 64, 37035 }, // и
+    { 15, 23, 17, 1, 22, 87, 37099 }, // й
+    { 16, 16, 15, 0, 16, 64, 37186 }, // к
+    { 18, 17, 17, -2, 16, 77, 37250 }, // л
+    { 22, 16, 22, 0, 16, 88, 37327 }, // м
+    { 16, 16, 17, 0, 16, 64, 37415 }, // н
+    { 15, 17, 16, 1, 16, 64, 37479 }, // о
+    { 15, 16, 16, 0, 16, 60, 37543 }, // п
+    { 17, 23, 17, -1, 16, 98, 37603 }, // р
+    { 13, 17, 13, 1, 16, 56, 37701 }, // с
+    { 24, 16, 25, 0, 16, 96, 37757 }, // т
+    { 19, 23, 14, -3, 16, 110, 37853 }, // у
+    { 18, 30, 20, 1, 23, 135, 37963 }, // ф
+    { 17, 16, 13, -2, 16, 68, 38098 }, // х
+    { 15, 21, 17, 1, 16, 79, 38166 }, // ц
+    { 14, 16, 16, 2, 16, 56, 38245 }, // ч
+    { 24, 17, 25, 1, 16, 102, 38301 }, // ш
+    { 24, 21, 26, 1, 16, 126, 38403 }, // щ
+    { 16, 17, 17, 1, 16, 68, 38529 }, // ъ
+    { 20, 17, 21, 1, 16, 85, 38597 }, // ы
+    { 13, 17, 15, 1, 16, 56, 38682 }, // ь
+    { 13, 17, 14, 0, 16, 56, 38738 }, // э
+    { 22, 17, 23, 0, 16, 94, 38794 }, // ю
+    { 16, 16, 15, -1, 16, 64, 38912 }, // я
+    { 13, 24, 14, 1, 23, 78, 38976 }, // ѐ
+    { 14, 23, 14, 1, 22, 81, 39054 }, // ё
+    { 16, 30, 17, 0, 23, 120, 39135 }, // ђ
+    { 14, 24, 13, 0, 23, 84, 39255 }, // ѓ
+    { 13, 17, 14, 1, 16, 56, 39339 }, // є
+    { 13, 17, 13, 0, 16, 56, 39395 }, // ѕ
+    { 8, 22, 8, 0, 22, 44, 39451 }, // і
+    { 10, 22, 7, 0, 22, 55, 39495 }, // ї
+    { 12, 29, 7, -4, 22, 87, 39550 }, // ј
+    { 25, 17, 24, -2, 16, 107, 39637 }, // љ
+    { 23, 17, 24, 0, 16, 98, 39744 }, // њ
+    { 16, 23, 17, 0, 23, 92, 39842 }, // ћ
+    { 16, 23, 15, 0, 23, 92, 39934 }, // ќ
+    { 15, 24, 17, 1, 23, 90, 40026 }, // ѝ
+    { 19, 29, 14, -3, 22, 138, 40116 }, // ў
+    { 15, 22, 17, 1, 16, 83, 40254 }, // џ
+    { 27, 22, 27, 2, 21, 149, 40337 }, // Ѡ
+    { 23, 16, 23, 1, 16, 92, 40486 }, // ѡ
+    { 14, 21, 17, 2, 21, 74, 40578 }, // Ѣ
+    { 23, 18, 24, 0, 17, 104, 40652 }, // ѣ
+    { 26, 23, 25, 1, 22, 150, 40756 }, // Ѥ
+    { 21, 17, 20, 0, 16, 90, 40960 }, // ѥ
+    { 19, 21, 18, -2, 21, 100, 41050 }, // Ѧ
+    { 16, 16, 16, -2, 16, 64, 41150 }, // ѧ
+    { 23, 21, 25, 1, 21, 121, 41214 }, // Ѩ
+    { 20, 16, 21, 0, 16, 80, 41335 }, // ѩ
+    { 23, 21, 19, -2, 21, 121, 41415 }, // Ѫ
+    { 19, 16, 18, -2, 16, 76, 41536 }, // ѫ
+    { 27, 21, 27, 1, 21, 142, 41612 }, // Ѭ
+    { 24, 16, 23, 0, 16, 96, 41754 }, // ѭ
+    { 18, 32, 16, -2, 25, 144, 41850 }, // Ѯ
+    { 16, 26, 13, -2, 20, 104, 41994 }, // ѯ
+    { 22, 21, 22, 3, 21, 116, 42098 }, // Ѱ
+    { 19, 30, 21, 1, 23, 143, 42214 }, // ѱ
+    { 19, 23, 21, 2, 22, 110, 42357 }, // Ѳ
+    { 15, 17, 16, 1, 16, 64, 42467 }, // ѳ
+    { 18, 21, 17, 2, 21, 95, 42531 }, // Ѵ
+    { 15, 16, 13, 1, 16, 60, 42626 }, // ѵ
+    { 18, 28, 17, 2, 28, 126, 42686 }, // Ѷ
+    { 15, 23, 13, 1, 23, 87, 42812 }, // ѷ
+    { 35, 29, 35, 2, 22, 254, 43008 }, // Ѹ
+    { 31, 23, 30, 1, 16, 179, 43262 }, // ѹ
+    { 19, 25, 22, 2, 23, 119, 43441 }, // Ѻ
+    { 15, 20, 17, 1, 18, 75, 43560 }, // ѻ
+    { 26, 32, 28, 2, 31, 208, 43635 }, // Ѽ
+    { 21, 27, 23, 1, 26, 142, 43843 }, // ѽ
+    { 27, 27, 27, 2, 26, 183, 43985 }, // Ѿ
+    { 23, 21, 23, 1, 21, 121, 44168 }, // ѿ
+    { 17, 29, 17, 2, 22, 124, 44289 }, // Ҁ
+    { 13, 23, 13, 1, 16, 75, 44413 }, // ҁ
+    { 16, 20, 18, 1, 19, 80, 44488 }, // ҂
+    { 12, 5, 0, -12, 21, 15, 44568 }, // ҃
+    { 12, 5, 0, -12, 22, 15, 44583 }, // ҄
+    { 4, 6, 0, -8, 23, 6, 44598 }, // ҅
+    { 4, 6, 0, -8, 23, 6, 44604 }, // ҆
+    { 12, 4, 0, -2, 26, 12, 44610 }, // ҇
+    { 34, 31, 0, -17, 23, 264, 44622 }, // ҈
+    { 34, 33, 0, -17, 24, 281, 45056 }, // ҉
+    { 20, 34, 21, 1, 28, 170, 45337 }, // Ҋ
+    { 16, 29, 17, 1, 23, 116, 45507 }, // ҋ
+    { 14, 21, 16, 1, 21, 74, 45623 }, // Ҍ
+    { 13, 24, 15, 1, 23, 78, 45697 }, // ҍ
+    { 16, 21, 17, 1, 21, 84, 45775 }, // Ҏ
+    { 17, 23, 17, -1, 16, 98, 45859 }, // ҏ
+    { 16, 26, 14, 1, 26, 104, 45957 }, // Ґ
+    { 14, 21, 11, 0, 21, 74, 46061 }, // ґ
+    { 16, 21, 14, 1, 21, 84, 46135 }, // Ғ
+    { 13, 16, 11, 0, 16, 52, 46219 }, // ғ
+    { 16, 29, 18, 1, 21, 116, 46271 }, // Ҕ
+    { 13, 24, 15, 0, 16, 78, 46387 }, // ҕ
+    { 28, 27, 24, -2, 21, 189, 46465 }, // Җ
+    { 27, 22, 25, -1, 16, 149, 46654 }, // җ
+    { 16, 29, 15, -1, 22, 116, 46803 }, // Ҙ
+    { 13, 23, 13, 0, 16, 75, 46919 }, // ҙ
+    { 19, 27, 18, 1, 21, 129, 47104 }, // Қ
+    { 16, 22, 15, 0, 16, 88, 47233 }, // қ
+    { 19, 21, 17, 1, 21, 100, 47321 }, // Ҝ
+    { 16, 16, 14, 0, 16, 64, 47421 }, // ҝ
+    { 19, 21, 16, 1, 21, 100, 47485 }, // Ҟ
+    { 16, 23, 14, 0, 23, 92, 47585 }, // ҟ
+    { 20, 21, 19, 2, 21, 105, 47677 }, // Ҡ
+    { 17, 16, 17, 1, 16, 68, 47782 }, // ҡ
+    { 19, 27, 20, 1, 21, 129, 47850 }, // Ң
+    { 17, 22, 18, 0, 16, 94, 47979 }, // ң
+    { 24, 21, 22, 1, 21, 126, 48073 }, // Ҥ
+    { 22, 16, 20, 0, 16, 88, 48199 }, // ҥ
+    { 26, 29, 29, 1, 21, 189, 48287 }, // Ҧ
+    { 22, 24, 24, 0, 16, 132, 48476 }, // ҧ
+    { 18, 24, 21, 2, 22, 108, 48608 }, // Ҩ
+    { 16, 17, 18, 1, 16, 68, 48716 }, // ҩ
+    { 17, 29, 17, 2, 22, 124, 48784 }, // Ҫ
+    { 13, 23, 13, 1, 16, 75, 48908 }, // ҫ
+    { 16, 27, 15, 2, 21, 108, 48983 }, // Ҭ
+    { 25, 22, 26, 0, 16, 138, 49152 }, // ҭ
+    { 16, 21, 15, 2, 21, 84, 49290 }, // Ү
+    { 15, 23, 14, 1, 16, 87, 49374 }, // ү
+    { 17, 21, 15, 1, 21, 90, 49461 }, // Ұ
+    { 17, 23, 14, -1, 16, 98, 49551 }, // ұ
+    { 20, 27, 17, -2, 21, 135, 49649 }, // Ҳ
+    { 17, 22, 15, -1, 16, 94, 49784 }, // ҳ
+    { 21, 27, 23, 2, 21, 142, 49878 }, // Ҵ
+    { 18, 22, 19, 1, 16, 99, 50020 }, // ҵ
+    { 16, 27, 19, 3, 21, 108, 50119 }, // Ҷ
+    { 14, 22, 16, 2, 16, 77, 50227 }, // ҷ
+    { 16, 21, 19, 3, 21, 84, 50304 }, // Ҹ
+    { 14, 16, 16, 2, 16, 56, 50388 }, // ҹ
+    { 16, 21, 19, 1, 21, 84, 50444 }, // Һ
+    { 16, 23, 17, 0, 23, 92, 50528 }, // һ
+    { 22, 23, 22, 1, 22, 127, 50620 }, // Ҽ
+    { 16, 17, 17, 1, 16, 68, 50747 }, // ҽ
+    { 22, 28, 22, 1, 22, 154, 50815 }, // Ҿ
+    { 16, 22, 17, 1, 16, 88, 50969 }, // ҿ
+    { 13, 21, 9, -1, 21, 69, 51057 }, // Ӏ
+    { 28, 27, 23, -2, 27, 189, 51200 }, // Ӂ
+    { 27, 23, 26, -1, 22, 156, 51389 }, // ӂ
+    { 19, 29, 19, 1, 21, 138, 51545 }, // Ӄ
+    { 16, 24, 15, 0, 16, 96, 51683 }, // ӄ
+    { 21, 27, 19, -1, 21, 142, 51779 }, // Ӆ
+    { 17, 22, 16, -2, 16, 94, 51921 }, // ӆ
+    { 19, 29, 20, 1, 21, 138, 52015 }, // Ӈ
+    { 17, 24, 18, 0, 16, 102, 52153 }, // ӈ
+    { 19, 27, 20, 1, 21, 129, 52255 }, // Ӊ
+    { 17, 22, 18, 0, 16, 94, 52384 }, // ӊ
+    { 16, 27, 19, 3, 21, 108, 52478 }, // Ӌ
+    { 15, 22, 17, 2, 16, 83, 52586 }, // ӌ
+    { 24, 27, 25, 1, 21, 162, 52669 }, // Ӎ
+    { 20, 22, 20, 0, 16, 110, 52831 }, // ӎ
+    { 13, 21, 9, -1, 21, 69, 52941 }, // ӏ
+    { 19, 27, 16, -2, 27, 129, 53010 }, // Ӑ
+    { 16, 23, 17, 1, 22, 92, 53139 }, // ӑ
+    { 18, 27, 16, -2, 27, 122, 53248 }, // Ӓ
+    { 16, 23, 17, 1, 22, 92, 53370 }, // ӓ
+    { 28, 21, 24, -2, 21, 147, 53462 }, // Ӕ
+    { 23, 17, 24, 1, 16, 98, 53609 }, // ӕ
+    { 16, 27, 15, 1, 27, 108, 53707 }, // Ӗ
+    { 15, 23, 15, 1, 22, 87, 53815 }, // ӗ
+    { 18, 23, 19, 1, 22, 104, 53902 }, // Ә
+    { 14, 17, 14, 0, 16, 60, 54006 }, // ә
+    { 18, 28, 19, 1, 27, 126, 54066 }, // Ӛ
+    { 14, 23, 14, 0, 22, 81, 54192 }, // ӛ
+    { 28, 27, 23, -2, 27, 189, 54273 }, // Ӝ
+    { 27, 23, 26, -1, 22, 156, 54462 }, // ӝ
+    { 16, 28, 15, -1, 27, 112, 54618 }, // Ӟ
+    { 13, 23, 13, 0, 22, 75, 54730 }, // ӟ
+    { 16, 22, 15, 0, 21, 88, 54805 }, // Ӡ
+    { 16, 23, 14, -2, 16, 92, 54893 }, // ӡ
+    { 21, 25, 20, 0, 25, 132, 54985 }, // Ӣ
+    { 16, 21, 17, 1, 20, 84, 55117 }, // ӣ
+    { 21, 27, 20, 0, 27, 142, 55296 }, // Ӥ
+    { 16, 23, 17, 1, 22, 92, 55438 }, // ӥ
+    { 19, 28, 21, 2, 27, 133, 55530 }, // Ӧ
+    { 15, 23, 16, 1, 22, 87, 55663 }, // ӧ
+    { 19, 23, 21, 2, 22, 110, 55750 }, // Ө
+    { 15, 17, 16, 1, 16, 64, 55860 }, // ө
+    { 19, 28, 21, 2, 27, 133, 55924 }, // Ӫ
+    { 15, 23, 16, 1, 22, 87, 56057 }, // ӫ
+    { 17, 28, 17, 0, 27, 119, 56144 }, // Ӭ
+    { 13, 23, 14, 0, 22, 75, 56263 }, // ӭ
+    { 19, 26, 16, 0, 25, 124, 56338 }, // Ӯ
+    { 19, 27, 14, -3, 20, 129, 56462 }, // ӯ
+    { 19, 28, 16, 0, 27, 133, 56591 }, // Ӱ
+    { 19, 29, 14, -3, 22, 138, 56724 }, // ӱ
+    { 19, 29, 16, 0, 28, 138, 56862 }, // Ӳ
+    { 19, 30, 14, -3, 23, 143, 57000 }, // ӳ
+    { 17, 27, 18, 2, 27, 115, 57143 }, // Ӵ
+    { 14, 22, 16, 2, 22, 77, 57258 }, // ӵ
+    { 16, 27, 14, 1, 21, 108, 57344 }, // Ӷ
+    { 13, 22, 11, 0, 16, 72, 57452 }, // ӷ
+    { 24, 27, 23, 0, 27, 162, 57524 }, // Ӹ
+    { 20, 23, 21, 1, 22, 115, 57686 }, // ӹ
+    { 17, 27, 14, 0, 21, 115, 57801 }, // Ӻ
+    { 14, 22, 11, -1, 16, 77, 57916 }, // ӻ
+    { 20, 27, 15, -2, 21, 135, 57993 }, // Ӽ
+    { 17, 22, 14, -2, 16, 94, 58128 }, // ӽ
+    { 20, 21, 15, -2, 21, 105, 58222 }, // Ӿ
+    { 17, 16, 14, -2, 16, 68, 58327 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 58395 }, //  
+    { 0, 0, 29, 0, 0, 0, 58395 }, //  
+    { 0, 0, 15, 0, 0, 0, 58395 }, //  
+    { 0, 0, 29, 0, 0, 0, 58395 }, //  
+    { 0, 0, 10, 0, 0, 0, 58395 }, //  
+    { 0, 0, 7, 0, 0, 0, 58395 }, //  
+    { 0, 0, 5, 0, 0, 0, 58395 }, //  
+    { 0, 0, 16, 0, 0, 0, 58395 }, //  
+    { 0, 0, 7, 0, 0, 0, 58395 }, //  
+    { 0, 0, 5, 0, 0, 0, 58395 }, //  
+    { 0, 0, 3, 0, 0, 0, 58395 }, //  
+    { 0, 0, 0, 0, 0, 0, 58395 }, // ​
+    { 0, 0, 0, 0, 0, 0, 58395 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 58395 }, // ‍
+    { 8, 25, 0, -1, 21, 50, 58395 }, // ‎
+    { 8, 25, 0, -7, 21, 50, 58445 }, // ‏
+    { 9, 3, 9, 0, 9, 7, 58495 }, // ‐
+    { 9, 3, 9, 0, 9, 7, 58502 }, // ‑
+    { 15, 3, 16, 1, 12, 12, 58509 }, // ‒
+    { 14, 4, 14, 0, 10, 14, 58521 }, // –
+    { 28, 4, 28, 0, 10, 28, 58535 }, // —
+    { 28, 4, 28, 0, 10, 28, 58563 }, // ―
+    { 9, 31, 16, 4, 23, 70, 58591 }, // ‖
+    { 13, 7, 12, -3, 0, 23, 58661 }, // ‗
+    { 7, 8, 5, 1, 21, 14, 58684 }, // ‘
+    { 7, 8, 5, 1, 21, 14, 58698 }, // ’
+    { 7, 8, 7, -2, 4, 14, 58712 }, // ‚
+    { 4, 8, 5, 3, 21, 8, 58726 }, // ‛
+    { 12, 8, 10, 1, 21, 24, 58734 }, // “
+    { 12, 8, 10, 1, 21, 24, 58758 }, // ”
+    { 12, 8, 12, -2, 4, 24, 58782 }, // „
+    { 9, 8, 10, 3, 21, 18, 58806 }, // ‟
+    { 11, 23, 14, 3, 23, 64, 58824 }, // †
+    { 15, 23, 14, 0, 23, 87, 58888 }, // ‡
+    { 8, 8, 11, 2, 15, 16, 58975 }, // •
+    { 10, 10, 11, 1, 16, 25, 58991 }, // ‣
+    { 4, 5, 15, 4, 4, 5, 59016 }, // ․
+    { 12, 5, 15, 0, 4, 15, 59021 }, // ‥
+    { 20, 5, 22, 0, 4, 25, 59036 }, // …
+    { 5, 5, 7, 1, 10, 7, 59061 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 59068 }, //  
+    { 0, 0, 18, 0, 0, 0, 59068 }, //  
+    { 8, 22, 0, -1, 18, 44, 59068 }, // ‪
+    { 8, 22, 0, -7, 18, 44, 59112 }, // ‫
+    { 8, 25, 0, -4, 21, 50, 59156 }, // ‬
+    { 8, 25, 0, -4, 21, 50, 59206 }, // ‭
+    { 8, 25, 0, -4, 21, 50, 59256 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 59306 }, //  
+    { 30, 23, 33, 2, 22, 173, 59392 }, // ‰
+    { 40, 23, 42, 2, 22, 230, 59565 }, // ‱
+    { 8, 8, 6, 1, 21, 16, 59795 }, // ′
+    { 13, 8, 11, 1, 21, 26, 59811 }, // ″
+    { 18, 8, 16, 1, 21, 36, 59837 }, // ‴
+    { 5, 8, 8, 3, 21, 10, 59873 }, // ‵
+    { 10, 8, 12, 3, 21, 20, 59883 }, // ‶
+    { 14, 8, 17, 3, 21, 28, 59903 }, // ‷
+    { 11, 10, 12, -3, 3, 28, 59931 }, // ‸
+    { 8, 13, 8, 1, 14, 26, 59959 }, // ‹
+    { 8, 13, 8, 0, 14, 26, 59985 }, // ›
+    { 22, 23, 24, 1, 22, 127, 60011 }, // ※
+    { 15, 22, 14, 0, 21, 83, 60138 }, // ‼
+    { 12, 23, 13, 2, 22, 69, 60221 }, // ‽
+    { 13, 3, 11, 2, 25, 10, 60290 }, // ‾
+    { 16, 7, 16, -2, 0, 28, 60300 }, // ‿
+    { 16, 7, 16, 2, 24, 28, 60328 }, // ⁀
+    { 14, 19, 10, -3, 12, 67, 60356 }, // ⁁
+    { 31, 27, 33, 0, 23, 210, 60423 }, // ⁂
+    { 8, 3, 8, 0, 9, 6, 60633 }, // ⁃
+    { 18, 21, 4, -7, 21, 95, 60639 }, // ⁄
+    { 12, 26, 8, -1, 21, 78, 60734 }, // ⁅
+    { 12, 26, 8, -3, 21, 78, 60812 }, // ⁆
+    { 24, 23, 25, 2, 22, 138, 60890 }, // ⁇
+    { 19, 23, 20, 2, 22, 110, 61028 }, // ⁈
+    { 21, 23, 20, 0, 22, 121, 61138 }, // ⁉
+    { 15, 16, 15, 1, 16, 60, 61259 }, // ⁊
+    { 15, 27, 17, 3, 23, 102, 61319 }, // ⁋
+    { 16, 15, 19, 1, 16, 60, 61440 }, // ⁌
+    { 16, 15, 19, 2, 16, 60, 61500 }, // ⁍
+    { 15, 15, 16, -1, 8, 57, 61560 }, // ⁎
+    { 7, 21, 7, 0, 17, 37, 61617 }, // ⁏
+    { 20, 31, 16, -2, 24, 155, 61654 }, // ⁐
+    { 17, 30, 16, 0, 23, 128, 61809 }, // ⁑
+    { 11, 23, 11, 0, 22, 64, 61937 }, // ⁒
+    { 26, 5, 29, 2, 11, 33, 62001 }, // ⁓
+    { 16, 7, 16, -3, 0, 28, 62034 }, // ⁔
+    { 16, 16, 17, 0, 15, 64, 62062 }, // ⁕
+    { 13, 23, 15, 1, 22, 75, 62126 }, // ⁖
+    { 23, 8, 21, 1, 21, 46, 62201 }, // ⁗
+    { 22, 23, 24, 1, 22, 127, 62247 }, // ⁘
+    { 22, 23, 24, 1, 22, 127, 62374 }, // ⁙
+    { 4, 23, 6, 1, 22, 23, 62501 }, // ⁚
+    { 17, 23, 19, 1, 22, 98, 62524 }, // ⁛
+    { 22, 23, 23, 1, 22, 127, 62622 }, // ⁜
+    { 4, 22, 8, 2, 21, 22, 62749 }, // ⁝
+    { 5, 23, 8, 2, 22, 29, 62771 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 62800 }, //  
+    { 0, 0, 18, 0, 0, 0, 62800 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 62800 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 62800 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 62800 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 62800 }, // ⁤
+    { 0, 0, 18, 0, 0, 0, 62800 }, // ⁦
+    { 0, 0, 18, 0, 0, 0, 62800 }, // ⁧
+    { 0, 0, 18, 0, 0, 0, 62800 }, // ⁨
+    { 0, 0, 18, 0, 0, 0, 62800 }, // ⁩
+    { 8, 25, 0, -4, 21, 50, 62800 }, // ⁪
+    { 8, 25, 0, -4, 21, 50, 62850 }, // ⁫
+    { 8, 25, 0, -4, 21, 50, 62900 }, // ⁬
+    { 8, 25, 0, -4, 21, 50, 62950 }, // ⁭
+    { 8, 25, 0, -4, 21, 50, 63000 }, // ⁮
+    { 8, 25, 0, -4, 21, 50, 63050 }, // ⁯
+    { 10, 14, 10, 2, 25, 35, 63100 }, // ⁰
+    { 5, 14, 7, 2, 22, 18, 63135 }, // ⁱ
+    { 10, 13, 10, 2, 25, 33, 63153 }, // ⁴
+    { 10, 14, 10, 2, 25, 35, 63186 }, // ⁵
+    { 10, 14, 10, 3, 25, 35, 63221 }, // ⁶
+    { 10, 13, 10, 3, 25, 33, 63256 }, // ⁷
+    { 10, 14, 10, 2, 25, 35, 63289 }, // ⁸
+    { 10, 14, 10, 2, 25, 35, 63324 }, // ⁹
+    { 8, 9, 10, 3, 22, 18, 63359 }, // ⁺
+    { 8, 3, 10, 3, 19, 6, 63377 }, // ⁻
+    { 8, 6, 10, 3, 21, 12, 63383 }, // ⁼
+    { 7, 17, 5, 3, 27, 30, 63395 }, // ⁽
+    { 7, 17, 5, 0, 27, 30, 63425 }, // ⁾
+    { 10, 10, 11, 2, 18, 25, 63455 }, // ⁿ
+    { 10, 14, 10, -1, 9, 35, 63488 }, // ₀
+    { 7, 13, 10, 0, 9, 23, 63523 }, // ₁
+    { 11, 13, 10, -2, 9, 36, 63546 }, // ₂
+    { 11, 14, 10, -2, 9, 39, 63582 }, // ₃
+    { 10, 13, 10, -1, 9, 33, 63621 }, // ₄
+    { 10, 14, 10, -1, 9, 35, 63654 }, // ₅
+    { 10, 14, 10, -1, 9, 35, 63689 }, // ₆
+    { 11, 13, 10, -1, 9, 36, 63724 }, // ₇
+    { 10, 14, 10, -1, 9, 35, 63760 }, // ₈
+    { 10, 14, 10, -1, 9, 35, 63795 }, // ₉
+    { 9, 9, 10, -1, 6, 21, 63830 }, // ₊
+    { 9, 3, 10, -1, 4, 7, 63851 }, // ₋
+    { 9, 6, 10, -1, 5, 14, 63858 }, // ₌
+    { 7, 17, 5, 0, 11, 30, 63872 }, // ₍
+    { 8, 17, 5, -4, 11, 34, 63902 }, // ₎
+    { 10, 10, 11, -1, 7, 25, 63936 }, // ₐ
+    { 9, 10, 9, -1, 7, 23, 63961 }, // ₑ
+    { 10, 10, 11, -1, 7, 25, 63984 }, // ₒ
+    { 12, 10, 9, -3, 7, 30, 64009 }, // ₓ
+    { 9, 10, 9, -2, 7, 23, 64039 }, // ₔ
+    { 10, 14, 13, 0, 11, 35, 64062 }, // ₕ
+    { 10, 14, 10, 0, 11, 35, 64097 }, // ₖ
+    { 5, 14, 7, 0, 11, 18, 64132 }, // ₗ
+    { 16, 10, 18, 0, 7, 40, 64150 }, // ₘ
+    { 11, 10, 11, -2, 7, 28, 64190 }, // ₙ
+    { 11, 14, 11, -2, 7, 39, 64218 }, // ₚ
+    { 8, 10, 9, -1, 7, 20, 64257 }, // ₛ
+    { 7, 12, 6, -1, 9, 21, 64277 }, // ₜ
+    { 15, 22, 16, 2, 22, 83, 64298 }, // ₠
+    { 17, 25, 16, 1, 23, 107, 64381 }, // ₡
+    { 16, 23, 16, 1, 22, 92, 64488 }, // ₢
+    { 17, 21, 16, 0, 21, 90, 64580 }, // ₣
+    { 18, 22, 16, -1, 22, 99, 64670 }, // ₤
+    { 24, 24, 26, 0, 20, 144, 64769 }, // ₥
+    { 17, 21, 16, 0, 21, 90, 64913 }, // ₦
+    { 21, 22, 22, 0, 21, 116, 65003 }, // ₧
+    { 24, 22, 23, 0, 21, 132, 65119 }, // ₨
+    { 21, 21, 18, 0, 21, 111, 65251 }, // ₩
+    { 24, 21, 23, 0, 21, 126, 65362 }, // ₪
+    { 19, 28, 17, 0, 23, 133, 65536 }, // ₫
+    { 18, 23, 16, 0, 22, 104, 65669 }, // €
+    { 19, 21, 16, 0, 21, 100, 65773 }, // ₭
+    { 17, 21, 15, 1, 21, 90, 65873 }, // ₮
+    { 28, 29, 28, 0, 22, 203, 65963 }, // ₯
+    { 19, 29, 16, -2, 22, 138, 66166 }, // ₰
+    { 17, 21, 16, 1, 21, 90, 66304 }, // ₱
+    { 18, 26, 20, 2, 23, 117, 66394 }, // ₲
+    { 20, 21, 16, -2, 21, 105, 66511 }, // ₳
+    { 18, 23, 15, -1, 22, 104, 66616 }, // ₴
+    { 17, 26, 17, 2, 23, 111, 66720 }, // ₵
+    { 18, 21, 17, 0, 20, 95, 66831 }, // ₶
+    { 21, 25, 19, -1, 22, 132, 66926 }, // ₷
+    { 16, 21, 14, 1, 21, 84, 67058 }, // ₸
+    { 15, 21, 16, 2, 21, 79, 67142 }, // ₹
+    { 16, 22, 16, 0, 21, 88, 67221 }, // ₺
+    { 19, 23, 20, 1, 22, 110, 67309 }, // ₻
+    { 22, 21, 22, -1, 21, 116, 67419 }, // ₼
+    { 19, 21, 17, -1, 21, 100, 67584 }, // ₽
+    { 20, 24, 17, -1, 24, 120, 67684 }, // ₾
+    { 16, 27, 16, 1, 24, 108, 67804 }, // ₿
+    { 9, 3, 9, 0, 9, 7, 67912 }, // −
+    { 27, 28, 29, 1, 23, 189, 67919 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_italicIntervals[] = {
@@ -5075,4 +3298,9 @@ static const EpdFontData notosans_14_italic = {
     32,
     -9,
     true,
+    notosans_14_italicBlockOffsets,
+    notosans_14_italicDirectGlyphs,
+    notosans_14_italicGlyphPages,
+    256,
+    notosans_14_italicPageGlyphs,
 };
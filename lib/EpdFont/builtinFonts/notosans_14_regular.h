@@ -2,3920 +2,2100 @@
  * generated by fontconvert.py
  * name: notosans_14_regular
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py notosans_14_regular 14 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_14_regular 14 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_regularBitmaps[62507] = {
-    0xBD, 0xBD, 0xBD, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x00,
-    0x00, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x3E, 0x0B, 0xCF, 0x82, 0xF3, 0xD0, 0xBC, 0xF4, 0x2E, 0x3D,
-    0x07, 0x8B, 0x41, 0xE2, 0xC0, 0x78, 0x60, 0x09, 0x00, 0x02, 0xC0, 0x1D, 0x00, 0x00, 0x0F, 0x00,
-    0xB4, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x78, 0x00,
-    0x00, 0x3D, 0x01, 0xE0, 0x00, 0xAA, 0xFA, 0xAF, 0xEA, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x05, 0x6F,
-    0x55, 0xF5, 0x50, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x02, 0xD0, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0xB4,
-    0x00, 0x00, 0x3C, 0x03, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2D, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x0F, 0x00,
-    0xF0, 0x00, 0x00, 0x78, 0x07, 0xC0, 0x00, 0x02, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x17, 0xE9, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFE, 0xFF, 0x03, 0xF0, 0xB4, 0x14, 0x0F, 0x42, 0xD0, 0x00, 0x3D, 0x0B, 0x40, 0x00, 0xFC, 0x2D,
-    0x00, 0x02, 0xFD, 0xB4, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0xB5, 0xFE, 0x00, 0x02, 0xD0, 0xFC, 0x00, 0x0B, 0x41, 0xF0, 0x00, 0x2D, 0x0B, 0xC2,
-    0x40, 0xB4, 0x7E, 0x0F, 0xFB, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x00, 0x05, 0xBE, 0x40, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x1E, 0x00, 0x1F, 0xBF, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0xF4, 0x00, 0xB8, 0x00,
-    0x7C, 0x07, 0x80, 0x0F, 0x00, 0x07, 0x80, 0x3C, 0x02, 0xE0, 0x00, 0xB8, 0x03, 0xC0, 0x3C, 0x00,
-    0x0B, 0x80, 0x3C, 0x0B, 0x80, 0x00, 0xB8, 0x03, 0xC1, 0xF0, 0x00, 0x07, 0x80, 0x3C, 0x3D, 0x1B,
-    0x80, 0x3C, 0x07, 0x87, 0xC7, 0xFF, 0x43, 0xD0, 0xF4, 0xF4, 0xF4, 0x7C, 0x1F, 0xFF, 0x2E, 0x1E,
-    0x03, 0xD0, 0x7F, 0x83, 0xC2, 0xD0, 0x1E, 0x00, 0x00, 0xB8, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x03,
-    0xD0, 0x1F, 0x00, 0x02, 0xE0, 0x3D, 0x01, 0xF0, 0x00, 0x7C, 0x02, 0xD0, 0x1E, 0x00, 0x0F, 0x40,
-    0x2E, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x3D, 0x00, 0x0F, 0xEF, 0xC0, 0x0B, 0x80,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x07, 0xC0,
-    0x0F, 0xC0, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80,
-    0x7D, 0x00, 0x00, 0x01, 0xF4, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0x50, 0x0F, 0xE3, 0xF8, 0x00, 0xFC, 0x0B, 0xE0, 0x3F,
-    0x80, 0x3D, 0x03, 0xF0, 0x03, 0xF8, 0x2F, 0x01, 0xF4, 0x00, 0x3F, 0x8F, 0x80, 0x7C, 0x00, 0x03,
-    0xFF, 0xC0, 0x1F, 0x40, 0x00, 0x3F, 0xD0, 0x03, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0x40, 0x6F,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC2, 0xF8, 0x00, 0xBF, 0xFF, 0x40, 0x2F, 0x80, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x2D, 0x2C, 0x18, 0x00, 0xB4, 0x0B, 0xC0, 0x3D, 0x02,
-    0xF0, 0x0F, 0x40, 0xBC, 0x03, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0xFC,
-    0x03, 0xF0, 0x0F, 0xC0, 0x2F, 0x00, 0xBC, 0x01, 0xF4, 0x03, 0xD0, 0x0F, 0xC0, 0x2F, 0x00, 0x3E,
-    0x00, 0xBC, 0x00, 0xF4, 0x01, 0xF0, 0x01, 0x90, 0x2E, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0,
-    0x02, 0xF0, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x3D, 0x00, 0x3E,
-    0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xF8,
-    0x01, 0xF4, 0x03, 0xF0, 0x03, 0xD0, 0x0B, 0xC0, 0x1F, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x90, 0xF0,
-    0x6E, 0xBF, 0xEF, 0xFF, 0xE6, 0xBF, 0xFF, 0xE9, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xBE, 0x00, 0x01,
-    0xF1, 0xF4, 0x00, 0x3F, 0x0F, 0xC0, 0x0B, 0xD0, 0x7E, 0x00, 0x18, 0x02, 0x40, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x2D, 0x00, 0x01, 0x55, 0xF9, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x05, 0x07, 0xD2, 0xF0, 0xFC, 0x3D, 0x1F, 0x07, 0x82, 0xC0,
-    0xFF, 0xFC, 0xFF, 0xFC, 0x55, 0x54, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x00, 0x00, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xE0,
-    0x03, 0xF4, 0x0B, 0xD0, 0x1F, 0x40, 0x0F, 0xC0, 0xFC, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x3E, 0x1F,
-    0x40, 0x00, 0xBC, 0x7C, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x1F, 0x2F, 0x00,
-    0x00, 0x7C, 0xBC, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x1F, 0x1F, 0x40, 0x00,
-    0xBC, 0x3D, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0xBC, 0x03, 0xF4, 0x0B, 0xE0,
-    0x03, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x1F,
-    0xD0, 0x2F, 0xF4, 0x3F, 0x7D, 0x3F, 0x0F, 0x4B, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F,
-    0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D,
-    0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0x18, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x1F, 0xD5, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x1B, 0xE0, 0x14, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x55, 0xBF, 0x80,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x29, 0x00, 0x0B, 0xF0, 0xBF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0x01, 0xF1, 0xF0, 0x00,
-    0x00, 0xF4, 0x7C, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3D, 0x01, 0xF0,
-    0x00, 0x3E, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x01,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x5B, 0xD5, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFE, 0x00, 0xFA, 0xAA, 0xA4, 0x03, 0xC0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0xAF,
-    0x90, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xA9, 0x5B, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x2F, 0x43, 0x80, 0x02, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF4, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xBF,
-    0x40, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x7F, 0xE0, 0x03, 0xDF, 0xFF, 0xF4, 0x1F, 0xF4, 0x07, 0xF4,
-    0x7F, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x1F, 0x4F, 0x40, 0x00, 0x3D, 0x3D,
-    0x00, 0x01, 0xF0, 0xBC, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x3E, 0x02, 0xF4, 0x07, 0xF0, 0x03, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xD6, 0xAA, 0xAA, 0xBF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xF4, 0x07, 0xF0, 0x2F, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x0F, 0x83,
-    0xE0, 0x00, 0x3E, 0x0B, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x0F, 0x80, 0x1F, 0xD2, 0xF8, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xF5, 0xFF, 0x00, 0x7E, 0x00, 0x7F, 0x03, 0xE0, 0x00,
-    0x3F, 0x1F, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x07, 0xC7, 0xD0, 0x00, 0x3F,
-    0x0F, 0xD0, 0x02, 0xF4, 0x0F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xD0, 0x07, 0xF4, 0x1F, 0xD0, 0x3F,
-    0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x7C, 0xBC, 0x00,
-    0x01, 0xF1, 0xF0, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x7F, 0x0B, 0xE0, 0x07, 0xFC, 0x0F, 0xFF, 0xFE,
-    0xF0, 0x0B, 0xFF, 0x8B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFE, 0xFE, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x00, 0x00, 0x7C, 0x0F, 0xE0, 0xFE, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x0F, 0xC0,
-    0xFC, 0x0F, 0x81, 0xF0, 0x2F, 0x03, 0xD0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x57, 0xFF, 0xFF, 0xFF, 0x2A, 0xAA,
-    0xAA, 0xA0, 0x40, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F,
-    0xD0, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xF8, 0x3D, 0x01, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00,
-    0x7D, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xE4, 0x01,
-    0xBF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x1F, 0xFF, 0x80, 0x7C, 0x1F, 0x00, 0xBF, 0xAF, 0xC0, 0x3C,
-    0x2D, 0x01, 0xF4, 0x03, 0xC0, 0x2D, 0x3C, 0x03, 0xD0, 0x03, 0xC0, 0x2D, 0x3C, 0x03, 0xC0, 0x03,
-    0xC0, 0x2E, 0x7C, 0x07, 0xC0, 0x07, 0xC0, 0x2D, 0x7C, 0x07, 0xC0, 0x07, 0xC0, 0x2D, 0x7C, 0x07,
-    0xC0, 0x0B, 0xC0, 0x3C, 0x3C, 0x03, 0xC0, 0x0F, 0xC0, 0x7C, 0x3C, 0x03, 0xF0, 0x2E, 0xD0, 0xF4,
-    0x3D, 0x00, 0xFF, 0xF4, 0xFF, 0xE0, 0x2F, 0x00, 0x2F, 0x80, 0x2E, 0x40, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0xBF,
-    0x95, 0x5B, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x5A, 0x94, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00,
-    0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0xFC,
-    0x00, 0x00, 0x01, 0xF4, 0x3F, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3E, 0x55, 0xAF, 0xF0,
-    0x3D, 0x00, 0x03, 0xF4, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8,
-    0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x0B, 0xE0, 0x3F, 0xFF, 0xFE, 0x40, 0x3F, 0xFF, 0xFE, 0x40,
-    0x3E, 0x00, 0x5B, 0xF0, 0x3D, 0x00, 0x01, 0xFC, 0x3D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x7D,
-    0x3D, 0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x01, 0xFC, 0x3E, 0x00, 0x5B, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE,
-    0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0x41, 0xBC, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x68, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3E, 0x55, 0xAF, 0xF4, 0x03, 0xD0, 0x00, 0x1F, 0xD0, 0x3D, 0x00, 0x00, 0x7F,
-    0x03, 0xD0, 0x00, 0x01, 0xF8, 0x3D, 0x00, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x3D, 0x00,
-    0x00, 0x07, 0xD3, 0xD0, 0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x7D,
-    0x3D, 0x00, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x0F, 0xC3, 0xD0, 0x00,
-    0x01, 0xF8, 0x3D, 0x00, 0x00, 0x7F, 0x03, 0xD0, 0x00, 0x1F, 0xD0, 0x3E, 0x55, 0x6F, 0xF4, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD3,
-    0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xF9, 0x55, 0x50,
-    0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xD3, 0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xE4, 0x06, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xFC, 0x3E, 0x00, 0x03, 0xFF,
-    0xF0, 0xF8, 0x00, 0x05, 0x5B, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x1F,
-    0x80, 0x00, 0x02, 0xF0, 0x3F, 0x40, 0x00, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x2F, 0x00, 0xBF, 0x90,
-    0x01, 0xBC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00,
-    0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4,
-    0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xF9, 0x55, 0x55, 0x7F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00,
-    0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00,
-    0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0xBF, 0xFE, 0xBF, 0xFE, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0xBF, 0xFD, 0xFF, 0xFE, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F,
-    0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D,
-    0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4,
-    0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x02, 0xF0, 0x01, 0xFC, 0x7F, 0xFD, 0x1F, 0xFD, 0x01,
-    0xA4, 0x00, 0x3D, 0x00, 0x00, 0xBD, 0x0F, 0x40, 0x00, 0xBE, 0x03, 0xD0, 0x00, 0x7E, 0x00, 0xF4,
-    0x00, 0x7E, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00,
-    0xF4, 0x3F, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x0F, 0x6F, 0x80, 0x00, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0x7F, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x0F, 0x40, 0xBE, 0x00, 0x03, 0xD0, 0x0F,
-    0xD0, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x02, 0xF8, 0x03, 0xD0,
-    0x00, 0x3F, 0x40, 0xF4, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0x80, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xE3, 0xEF, 0x00, 0x00, 0x07, 0xFE, 0x3D, 0xF4, 0x00, 0x00, 0xF7, 0xE3, 0xCF, 0x80, 0x00,
-    0x1F, 0x3E, 0x3C, 0x7C, 0x00, 0x02, 0xE3, 0xE3, 0xC3, 0xD0, 0x00, 0x3D, 0x3E, 0x3D, 0x2F, 0x00,
-    0x07, 0xC3, 0xE3, 0xD1, 0xF0, 0x00, 0xF8, 0x3E, 0x3D, 0x0F, 0x80, 0x0F, 0x03, 0xE3, 0xD0, 0xBC,
-    0x02, 0xF0, 0x3E, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xE3, 0xD0, 0x3E, 0x07, 0xC0, 0x3E, 0x3D, 0x01,
-    0xF0, 0xB8, 0x03, 0xE3, 0xD0, 0x0F, 0x4F, 0x40, 0x3E, 0x3D, 0x00, 0xBD, 0xF0, 0x03, 0xE3, 0xD0,
-    0x07, 0xFE, 0x00, 0x3E, 0x3D, 0x00, 0x3F, 0xC0, 0x03, 0xE3, 0xD0, 0x02, 0xF8, 0x00, 0x3E, 0x3D,
-    0x00, 0x0F, 0x40, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xD3, 0xF8, 0x00, 0x00, 0x3D, 0x3F, 0xD0,
-    0x00, 0x03, 0xD3, 0xFF, 0x00, 0x00, 0x3D, 0x3D, 0xF8, 0x00, 0x03, 0xD3, 0xCB, 0xD0, 0x00, 0x3D,
-    0x3C, 0x3F, 0x00, 0x03, 0xD3, 0xC1, 0xF8, 0x00, 0x3D, 0x3C, 0x0F, 0xC0, 0x03, 0xD3, 0xD0, 0x3F,
-    0x00, 0x3D, 0x3D, 0x01, 0xF8, 0x03, 0xD3, 0xD0, 0x0F, 0xC0, 0x3D, 0x3D, 0x00, 0x3F, 0x03, 0xD3,
-    0xD0, 0x02, 0xF4, 0x3D, 0x3D, 0x00, 0x0F, 0xC3, 0xD3, 0xD0, 0x00, 0x7F, 0x3D, 0x3D, 0x00, 0x02,
-    0xF7, 0xD3, 0xD0, 0x00, 0x0F, 0xFD, 0x3D, 0x00, 0x00, 0x7F, 0xD3, 0xD0, 0x00, 0x02, 0xFD, 0x3D,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00,
-    0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F,
-    0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0,
-    0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xA0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xE5,
-    0x6B, 0xFC, 0x0F, 0x40, 0x02, 0xF8, 0x3D, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x0B, 0xC3, 0xD0, 0x00,
-    0x2F, 0x0F, 0x40, 0x00, 0xBC, 0x3D, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x2F, 0x43, 0xE5, 0x5B, 0xF8,
-    0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00,
-    0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC,
-    0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x16, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0xFF, 0xA4,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3E, 0x56, 0xBF, 0xC0, 0x3D, 0x00, 0x0B, 0xE0, 0x3D, 0x00, 0x03,
-    0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x03,
-    0xE0, 0x3D, 0x00, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3E, 0x56, 0xF4,
-    0x00, 0x3D, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F,
-    0xC0, 0x3D, 0x00, 0x07, 0xE0, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0B, 0xDB, 0x90, 0x06, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x5B, 0xE5, 0x55, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7,
-    0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00,
-    0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x2F, 0x0B, 0xE0,
-    0x00, 0x0F, 0xC0, 0xFE, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00,
-    0x0F, 0x83, 0xF0, 0x00, 0x01, 0xF4, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x0B,
-    0xC0, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x2F,
-    0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x03,
-    0xD0, 0xF8, 0x00, 0x00, 0x3F, 0x1F, 0x40, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0x7E, 0x00,
-    0x00, 0x00, 0xFB, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x07,
-    0xD3, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFC, 0x2F, 0x00,
-    0x03, 0xDF, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x1F, 0x3D, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0xB8, 0xB8,
-    0x00, 0xBC, 0x02, 0xF0, 0x03, 0xD1, 0xF0, 0x03, 0xF0, 0x07, 0xC0, 0x1F, 0x03, 0xD0, 0x0F, 0x80,
-    0x0F, 0x40, 0xBC, 0x0F, 0x80, 0x7D, 0x00, 0x3E, 0x03, 0xE0, 0x2F, 0x02, 0xF0, 0x00, 0xBC, 0x0F,
-    0x40, 0x7C, 0x0F, 0x80, 0x01, 0xF0, 0x7C, 0x00, 0xF8, 0x3D, 0x00, 0x03, 0xD3, 0xE0, 0x02, 0xF1,
-    0xF0, 0x00, 0x0F, 0x8F, 0x40, 0x07, 0xCB, 0xC0, 0x00, 0x2F, 0x7C, 0x00, 0x0F, 0x7E, 0x00, 0x00,
-    0x7E, 0xF0, 0x00, 0x3E, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0,
-    0x00, 0x3E, 0x00, 0x00, 0x1F, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80,
-    0x07, 0xD0, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0x00,
-    0xBC, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x0B, 0xC0, 0xFC,
-    0x00, 0x07, 0xD0, 0x1F, 0x40, 0x03, 0xE0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x3E, 0x01, 0xF4, 0x00,
-    0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x00, 0x1F, 0x1F,
-    0x80, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0xF8, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0xBC, 0x2F,
-    0x00, 0x00, 0x0F, 0xDF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0xBF,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE5, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFA, 0xFF, 0xFB, 0xD5, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0,
-    0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00,
-    0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x55, 0xBF, 0xFD,
-    0xAA, 0xA0, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x2F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80,
-    0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x3F, 0xFC, 0x7F, 0xFD,
-    0x15, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D,
-    0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D,
-    0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x15, 0xBD, 0x7F, 0xFD, 0x2A, 0xA8,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1E, 0xB8, 0x00, 0x00,
-    0xF4, 0xF0, 0x00, 0x07, 0xC2, 0xE0, 0x00, 0x2D, 0x03, 0xC0, 0x00, 0xF0, 0x0B, 0x80, 0x0B, 0x40,
-    0x0F, 0x00, 0x3C, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA,
-    0x00, 0x54, 0x01, 0xF8, 0x02, 0xF4, 0x02, 0xF0, 0x02, 0xE0, 0x01, 0x40, 0x00, 0xAF, 0xE4, 0x02,
-    0xFF, 0xFF, 0x80, 0xB9, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x15, 0xBC, 0x0B, 0xFF, 0xFF, 0x1F, 0xF9, 0x5B, 0xCF, 0xC0, 0x02, 0xFB, 0xC0, 0x00, 0xBE,
-    0xF0, 0x00, 0x3F, 0xBC, 0x00, 0x1F, 0xDF, 0x80, 0x1F, 0xF3, 0xFF, 0xFF, 0x7C, 0x2F, 0xFE, 0x0F,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x0B,
-    0xF9, 0x00, 0xBC, 0xFF, 0xFF, 0x02, 0xFF, 0x91, 0xBF, 0x0B, 0xF0, 0x00, 0xBD, 0x2F, 0x80, 0x00,
-    0xFC, 0xBD, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x7D,
-    0xBC, 0x00, 0x01, 0xF6, 0xF0, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x3F, 0x2F, 0xC0, 0x01, 0xF8, 0xBF,
-    0xC0, 0x1F, 0xC2, 0xEB, 0xFF, 0xFD, 0x0B, 0x47, 0xFF, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2F,
-    0xF9, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0x56, 0xD0, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF4, 0x01, 0x80, 0x7F, 0xFF, 0xF0, 0x02,
-    0xFF, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x40, 0x1B, 0xF4, 0x3D, 0x03, 0xFF, 0xFC, 0xF4, 0x3F, 0x91, 0xBF, 0xD1, 0xF8, 0x00, 0x7F, 0x4F,
-    0xC0, 0x00, 0xBD, 0x3E, 0x00, 0x01, 0xF5, 0xF4, 0x00, 0x03, 0xD7, 0xD0, 0x00, 0x0F, 0x5F, 0x40,
-    0x00, 0x3D, 0x7D, 0x00, 0x00, 0xF4, 0xF4, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x1F, 0x4B, 0xC0, 0x00,
-    0xFD, 0x0F, 0xD0, 0x0F, 0xF4, 0x1F, 0xFF, 0xF7, 0xD0, 0x1F, 0xFF, 0x4B, 0x40, 0x01, 0x40, 0x00,
-    0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00,
-    0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00,
-    0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x2F, 0xFC, 0x00, 0xFF, 0xFC, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xFA, 0x90, 0xBF, 0xFF, 0xE0, 0x17, 0xF5, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x6F, 0xD0, 0x64, 0x0F, 0xFF, 0xF3, 0xD0, 0xFE, 0x56, 0xFF, 0x47, 0xE0, 0x01, 0xFD,
-    0x3F, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x07, 0xD7, 0xD0, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x7D,
-    0x00, 0x00, 0xF5, 0xF4, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x7D, 0x2F, 0x40,
-    0x03, 0xF4, 0x3F, 0x40, 0x2F, 0xD0, 0x7F, 0xFF, 0xDF, 0x40, 0x7F, 0xFD, 0x3D, 0x00, 0x05, 0x00,
-    0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x0E, 0x50, 0x1F, 0xD0,
-    0x3F, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC1, 0xBF, 0x80, 0xBC, 0xFF, 0xFF, 0x4B, 0xFE, 0x56, 0xFC, 0xBF, 0x40, 0x0B, 0xDB, 0xE0,
-    0x00, 0x3E, 0xBD, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xE0, 0x14, 0xBC, 0xBC, 0x28, 0x00, 0x00, 0x68,
-    0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0x00,
-    0x14, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x01, 0xF8, 0xBF, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x01, 0xA4, 0xBC, 0x00, 0x3F, 0x0B, 0xC0, 0x0F, 0xC0, 0xBC, 0x03, 0xF0, 0x0B,
-    0xC0, 0xFC, 0x00, 0xBC, 0x3F, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0xBE, 0xFC, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0xBF, 0x2F, 0x40, 0x0B, 0xC0, 0xFC, 0x00, 0xBC, 0x03, 0xF0, 0x0B, 0xC0, 0x1F, 0x80, 0xBC,
-    0x00, 0xBD, 0x0B, 0xC0, 0x03, 0xF0, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
-    0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
-    0xBC, 0x64, 0x2F, 0xE4, 0x02, 0xFE, 0x42, 0xF3, 0xFF, 0xF8, 0x7F, 0xFF, 0x8B, 0xFE, 0x57, 0xFB,
-    0xD5, 0x7F, 0x6F, 0xC0, 0x03, 0xFC, 0x00, 0x3E, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0xF4, 0x00,
-    0x2F, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBC,
-    0x00, 0x0B, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xBC, 0x00, 0x0B,
-    0xEF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x2F, 0x00,
-    0x02, 0xFB, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x64, 0x1F, 0xF8,
-    0x0B, 0xCF, 0xFF, 0xF4, 0xBF, 0xE4, 0x6F, 0xCB, 0xF0, 0x00, 0xBD, 0xBE, 0x00, 0x03, 0xEB, 0xD0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F,
-    0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00,
-    0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x64, 0x1F, 0xE4, 0x02, 0xF3, 0xFF, 0xFC,
-    0x0B, 0xFE, 0x46, 0xFC, 0x2F, 0xC0, 0x02, 0xF4, 0xBE, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x0B, 0xCB,
-    0xC0, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x7D, 0xBC, 0x00, 0x01, 0xF6, 0xF0, 0x00, 0x07, 0xDB, 0xC0,
-    0x00, 0x2F, 0x2F, 0x40, 0x00, 0xFC, 0xBF, 0x00, 0x07, 0xE2, 0xFF, 0x00, 0x7F, 0x0B, 0xEF, 0xFF,
-    0xF4, 0x2F, 0x1F, 0xFF, 0x00, 0xBC, 0x01, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xD0, 0x64, 0x0F, 0xFF, 0xF3, 0xD0, 0xFE, 0x46, 0xFF, 0x47, 0xE0, 0x01, 0xFD, 0x3F,
-    0x00, 0x02, 0xF4, 0xF8, 0x00, 0x07, 0xD7, 0xD0, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x7D, 0x00,
-    0x00, 0xF5, 0xF4, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x7D, 0x2F, 0x40, 0x03,
-    0xF4, 0x3F, 0x40, 0x3F, 0xD0, 0x7F, 0xFF, 0xDF, 0x40, 0x7F, 0xFD, 0x3D, 0x00, 0x05, 0x00, 0xF4,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x64, 0x1B, 0xDB, 0x8B, 0xFD, 0xBE, 0xF9, 0x4B, 0xF8,
-    0x00, 0xBF, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xFF, 0xA0, 0x1F, 0xFF, 0xFC, 0x3F, 0x41, 0xBC, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x64, 0x00, 0xBD, 0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x1F, 0xEA, 0x9B, 0xFF,
-    0xFF, 0x1B, 0xE5, 0x50, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00,
-    0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x02,
-    0xFF, 0xF0, 0x0B, 0xFF, 0x00, 0x01, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x7E, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00,
-    0x14, 0x00, 0x00, 0xA8, 0x00, 0x00, 0xA6, 0xF0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0xF4, 0x01, 0xF4, 0x0B,
-    0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x7D, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x68,
-    0x00, 0x0A, 0x80, 0x00, 0xA5, 0xF4, 0x00, 0x7F, 0x00, 0x07, 0xD3, 0xE0, 0x02, 0xFE, 0x00, 0x2F,
-    0x0F, 0xC0, 0x0F, 0xBC, 0x00, 0xF8, 0x2F, 0x00, 0x3C, 0xF0, 0x03, 0xD0, 0x7D, 0x02, 0xF3, 0xD0,
-    0x1F, 0x00, 0xF8, 0x0F, 0x8B, 0xC0, 0xBC, 0x02, 0xF0, 0x3C, 0x1F, 0x03, 0xE0, 0x07, 0xC1, 0xF0,
-    0x3D, 0x0F, 0x40, 0x0F, 0x4F, 0x80, 0xB8, 0x7C, 0x00, 0x3E, 0x3D, 0x01, 0xF2, 0xF0, 0x00, 0xBD,
-    0xF0, 0x03, 0xCF, 0x80, 0x01, 0xFB, 0x80, 0x0F, 0xBC, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x2A, 0x00, 0x01, 0xA0, 0x7D,
-    0x00, 0x0F, 0xC0, 0xBC, 0x00, 0xBC, 0x00, 0xFC, 0x07, 0xD0, 0x01, 0xF8, 0x3E, 0x00, 0x02, 0xF3,
-    0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x7E, 0x0F, 0x80, 0x03, 0xF0, 0x1F, 0x40, 0x2F, 0x00, 0x2F, 0x01,
-    0xF4, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x7E, 0xA8, 0x00, 0x00, 0xA6, 0xF0, 0x00, 0x07, 0xD3, 0xE0,
-    0x00, 0x2F, 0x0B, 0xC0, 0x00, 0xF8, 0x1F, 0x40, 0x07, 0xD0, 0x3E, 0x00, 0x2F, 0x00, 0xBC, 0x00,
-    0xF8, 0x00, 0xF4, 0x07, 0xC0, 0x02, 0xF0, 0x3F, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x0F, 0x87, 0xC0,
-    0x00, 0x2F, 0x3E, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xA8, 0x7F, 0xFF, 0xFD, 0x15, 0x55, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0xB0, 0x00, 0x7F, 0xC0, 0x03, 0xF9, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x3F,
-    0x80, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xF8,
-    0x00, 0x0F, 0xF0, 0x00, 0x01, 0x80, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x39, 0x00, 0x00, 0xFF, 0x40, 0x01, 0xBF, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xD0, 0x07, 0xE0, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0x1F, 0x40, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x87, 0xFF, 0xFE, 0x6F, 0x2C, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0x40,
-    0x7C, 0xFE, 0xFE, 0x7D, 0x00, 0x00, 0x24, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0xBD, 0xBD, 0xBD, 0xBD, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x7F, 0x90, 0x02, 0xFF, 0xFF, 0x02, 0xFE, 0x5B, 0x81, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0x01, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x3E, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x7E, 0x00,
-    0xB4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x15, 0xF9, 0x55, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x2A, 0xFE, 0xAA, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xD5, 0x55,
-    0x54, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x18, 0x00, 0x00, 0x83, 0xE6, 0xFE, 0x3E,
-    0x1F, 0xFF, 0xFF, 0xC0, 0xBD, 0x02, 0xF0, 0x0F, 0x40, 0x0B, 0x80, 0xF0, 0x00, 0x3C, 0x1E, 0x00,
-    0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x0F, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0xF4, 0x0F, 0xFA, 0xBF, 0x83,
-    0xFB, 0xFF, 0xBD, 0x2C, 0x05, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0x0F, 0x81, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xD0, 0x07, 0xD0, 0x02, 0xF0, 0x00,
-    0xFC, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00,
-    0x00, 0x0B, 0xDF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0A, 0xAF, 0xEA, 0x80, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x00, 0x00, 0x05, 0x00, 0x01, 0xFF, 0xFF, 0x41, 0xFE, 0xAF, 0xD0, 0xFC, 0x00, 0x10,
-    0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0xF0,
-    0x0B, 0xC0, 0xBF, 0x03, 0xD0, 0x03, 0xF0, 0xF0, 0x00, 0x7C, 0x3E, 0x00, 0x0F, 0x0B, 0xE0, 0x0B,
-    0xC0, 0xBF, 0x9B, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xBC, 0x64, 0x00, 0x7E, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x2F, 0x03, 0xDB, 0xC0, 0xF4, 0x90, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE5, 0xAF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40,
-    0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x02, 0xFE, 0x40, 0xF0, 0x1D, 0x01, 0xFF, 0xFC, 0x07,
-    0x83, 0xC0, 0x3E, 0x01, 0x40, 0x2C, 0x38, 0x0B, 0xC0, 0x00, 0x01, 0xD7, 0x40, 0xF4, 0x00, 0x00,
-    0x0E, 0xB0, 0x0F, 0x00, 0x00, 0x00, 0xFB, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xB0, 0x0F, 0x00, 0x00,
-    0x00, 0xF7, 0x40, 0xF4, 0x00, 0x00, 0x0E, 0x38, 0x0B, 0x80, 0x00, 0x01, 0xD3, 0xC0, 0x7D, 0x00,
-    0x00, 0x2C, 0x2D, 0x02, 0xFF, 0xFC, 0x03, 0xC0, 0xF0, 0x07, 0xFF, 0x40, 0xF0, 0x07, 0xC0, 0x00,
-    0x00, 0x3D, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x95, 0x6F, 0xD0, 0x00, 0x00, 0x6F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xE9, 0xF8,
-    0x00, 0x0F, 0x00, 0x03, 0xC2, 0xFF, 0xF2, 0xE4, 0x3C, 0xF0, 0x0F, 0x3C, 0x07, 0xCB, 0xEF, 0xF0,
-    0xBE, 0x18, 0x00, 0x10, 0x05, 0x00, 0x3E, 0x03, 0xD0, 0x3F, 0x03, 0xE0, 0x2F, 0x03, 0xF0, 0x1F,
-    0x42, 0xF0, 0x1F, 0x42, 0xF4, 0x0B, 0xC0, 0xFC, 0x00, 0xFC, 0x0F, 0x80, 0x0F, 0x81, 0xF4, 0x01,
-    0xF4, 0x2F, 0x40, 0x1F, 0x42, 0xF0, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x52, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x10, 0xFF,
-    0xFC, 0xFF, 0xFC, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xE5, 0xAF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x3D,
-    0x00, 0xF0, 0x2F, 0xF9, 0x00, 0xF0, 0x1D, 0x03, 0xFF, 0xF8, 0x07, 0x83, 0xC0, 0x3D, 0x0B, 0xC0,
-    0x2C, 0x38, 0x03, 0xD0, 0x3D, 0x01, 0xD7, 0x40, 0x3D, 0x03, 0xD0, 0x0E, 0xB0, 0x03, 0xD0, 0x7C,
-    0x00, 0xFB, 0x00, 0x3F, 0xFF, 0x40, 0x0F, 0xB0, 0x03, 0xFF, 0xD0, 0x00, 0xF7, 0x40, 0x3D, 0x1F,
-    0x00, 0x0E, 0x38, 0x03, 0xD0, 0xF8, 0x01, 0xD3, 0xC0, 0x3D, 0x07, 0xC0, 0x2C, 0x2D, 0x03, 0xD0,
-    0x3E, 0x03, 0xC0, 0xF0, 0x3D, 0x00, 0xF4, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x1F, 0x40,
-    0x00, 0x1F, 0x80, 0x00, 0x3F, 0x95, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xAF, 0xC3, 0xC0, 0x2E, 0x78, 0x00, 0xF7, 0x80, 0x0F, 0x78,
-    0x00, 0xE3, 0xD0, 0x3D, 0x0F, 0xFF, 0x80, 0x2F, 0x90, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x01,
-    0x55, 0xF9, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0x6A, 0xAF, 0xEA, 0xA0, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xF8, 0x0F,
-    0xFF, 0xD2, 0x80, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
-    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xFF, 0xFF, 0x7F, 0xFF, 0xC0, 0x0B, 0xF9, 0x03, 0xFF, 0xF4,
-    0x24, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x16, 0xF0, 0x0B, 0xFD, 0x00, 0x01, 0xFC, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xCB, 0xEA, 0xF8, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x2F, 0x80, 0xF8, 0x0F, 0xC0, 0x7C, 0x01, 0x40, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xEB, 0xF4, 0x02, 0xFE, 0xBF, 0xFF, 0xFA, 0xEB, 0xDF, 0xFD,
-    0x1E, 0xBC, 0x04, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xF9, 0x7C, 0x1F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF,
-    0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF,
-    0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x2F, 0xFF, 0xF4, 0x2C, 0x0F, 0xFF,
-    0xF4, 0x2C, 0x02, 0xFF, 0xF4, 0x2C, 0x00, 0x04, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00,
-    0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00,
-    0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00,
-    0x74, 0x2C, 0x00, 0x00, 0x20, 0x18, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x0B, 0x00, 0x3C, 0x00, 0xBE,
-    0x00, 0x3C, 0x00, 0xF1, 0xAF, 0xCB, 0xF8, 0x00, 0x01, 0xA0, 0xBF, 0x3E, 0xFB, 0x4F, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0xFA, 0xBC, 0x0B, 0x40, 0x78, 0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x0F, 0x0F,
-    0x00, 0x3C, 0x2E, 0x02, 0xE0, 0x3F, 0xBF, 0x00, 0x1B, 0x90, 0x00, 0x10, 0x02, 0x00, 0x2F, 0x03,
-    0xE0, 0x03, 0xF0, 0x3E, 0x00, 0x3E, 0x07, 0xD0, 0x07, 0xE0, 0x7D, 0x00, 0x7D, 0x0B, 0xC0, 0x0F,
-    0xC0, 0xF8, 0x0F, 0xC0, 0xFC, 0x0B, 0xC0, 0xFC, 0x07, 0xD0, 0xBC, 0x03, 0xE0, 0x7D, 0x01, 0xE0,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xB4, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
-    0x00, 0x2F, 0x7C, 0x00, 0x03, 0xC0, 0x02, 0xC3, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x1F,
-    0x00, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x00, 0x03, 0xC0, 0x0F,
-    0x00, 0x00, 0x00, 0x3C, 0x02, 0xD0, 0x19, 0x00, 0x03, 0xC0, 0x7C, 0x03, 0xE0, 0x00, 0x3C, 0x0F,
-    0x40, 0xFE, 0x00, 0x03, 0xC2, 0xE0, 0x2E, 0xE0, 0x00, 0x28, 0x3C, 0x07, 0x9E, 0x00, 0x00, 0x0B,
-    0x40, 0xF2, 0xE0, 0x00, 0x01, 0xF0, 0x2C, 0x2E, 0x00, 0x00, 0x3C, 0x07, 0x82, 0xE0, 0x00, 0x0B,
-    0x80, 0xFA, 0xBF, 0x90, 0x00, 0xF0, 0x0F, 0xFF, 0xFD, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xD0, 0x00,
-    0x7F, 0x80, 0x00, 0x7C, 0x00, 0x2F, 0xB8, 0x00, 0x0F, 0x40, 0x03, 0x87, 0x80, 0x02, 0xE0, 0x00,
-    0x00, 0xB8, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x0B, 0x40, 0x00, 0x00, 0xB8, 0x01, 0xF0, 0x00,
-    0x00, 0x0B, 0x80, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x81, 0xA9, 0x00, 0x0B, 0x80, 0xF1, 0xFF,
-    0xF4, 0x00, 0xB8, 0x3D, 0x1D, 0x07, 0xC0, 0x0B, 0x87, 0xC0, 0x00, 0x3C, 0x00, 0x64, 0xF0, 0x00,
-    0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xD0, 0x00, 0x1E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x00, 0x1F, 0x00, 0x03, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x78, 0x07, 0xFA, 0xF4, 0x00, 0x03, 0xC0, 0x04,
-    0x01, 0xF0, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x0F, 0x00,
-    0x00, 0x6B, 0xE0, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x3D,
-    0x00, 0x00, 0x00, 0x0F, 0x01, 0xF0, 0x19, 0x00, 0x00, 0x3D, 0x0F, 0x00, 0xF8, 0x14, 0x01, 0xF0,
-    0xB8, 0x0F, 0xE0, 0xBF, 0xFF, 0x47, 0xC0, 0xBB, 0x80, 0x6F, 0xE0, 0x3D, 0x03, 0x9E, 0x00, 0x00,
-    0x01, 0xE0, 0x3C, 0x78, 0x00, 0x00, 0x0F, 0x02, 0xC1, 0xE0, 0x00, 0x00, 0xB8, 0x1E, 0x07, 0x80,
-    0x00, 0x07, 0xC0, 0xFA, 0xBF, 0x90, 0x00, 0x3D, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xE0, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xE0,
-    0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x90, 0x7F, 0xEB, 0xFC, 0x07, 0xFF,
-    0xFE, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x02, 0xF3, 0xC0, 0x00, 0x00, 0x0F,
-    0x8F, 0x80, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0xFC,
-    0x00, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xAA, 0xAA, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00, 0x0F,
-    0x87, 0xC0, 0x00, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x02,
-    0xF3, 0xC0, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00,
-    0x1F, 0x40, 0x0B, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xAA,
-    0xAA, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x07,
-    0xD0, 0xF8, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xD3,
-    0xF0, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3E, 0xF0, 0x00, 0x00, 0x02, 0xF3, 0xC0, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x00, 0x7C, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xBC, 0x01, 0xF0, 0x00,
-    0x03, 0xE0, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x1F, 0xAA, 0xAA, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x03,
-    0xF0, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0x2F, 0x3F,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0xFF, 0x80, 0xD0, 0x00, 0x0B, 0xAF,
-    0xFF, 0x00, 0x00, 0x38, 0x0B, 0xF4, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x1F, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00,
-    0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x00,
-    0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x0B, 0xCF,
-    0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x03,
-    0xF0, 0x7D, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x1F,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x7C,
-    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x0B,
-    0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x1F, 0xBC, 0x00, 0x00,
-    0x00, 0xF0, 0x74, 0x00, 0x00, 0x03, 0x80, 0xD0, 0x00, 0x00, 0x0B, 0x4B, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEF, 0x00,
-    0x00, 0x00, 0x2F, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x00,
-    0x3F, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x3E, 0x00,
-    0x3E, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x01, 0xFA, 0xAA, 0xAF, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x00, 0x3F, 0x02, 0xF0,
-    0x00, 0x00, 0x7D, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xFA, 0xFD, 0x55, 0x54, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xFF, 0xFF,
-    0xD0, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x55, 0x54, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xF8, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x55, 0x54, 0x7D, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x3F,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x03,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0x41, 0xBC, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x68, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0A, 0xBD, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x4F,
-    0x95, 0x55, 0x43, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0x40,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x95, 0x55, 0x43, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x4F, 0x95, 0x55, 0x43, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0x40, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x95,
-    0x55, 0x43, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F,
-    0xFE, 0x00, 0x0B, 0xC7, 0xD0, 0x0B, 0xC0, 0x3D, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x4F, 0x95, 0x55, 0x43, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0x40, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x95, 0x55, 0x43, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x10, 0x00, 0xF4, 0x2F, 0x00, 0x3E, 0x0B, 0xC0, 0x06, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x3E, 0x55, 0x55,
-    0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0x95, 0x55, 0x03, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3E, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x54, 0x00, 0x7E, 0x00, 0x2F,
-    0x40, 0x0B, 0xC0, 0x02, 0xE0, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xFE, 0xBF, 0xFE, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0xBF,
-    0xFD, 0xFF, 0xFE, 0x00, 0x15, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0x40,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0xBF, 0xFE, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0,
-    0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40,
-    0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x0B, 0xFF, 0xD3,
-    0xFF, 0xF8, 0x00, 0x50, 0x00, 0x3F, 0xC0, 0x0B, 0xFE, 0x02, 0xF1, 0xF4, 0xBC, 0x03, 0xD5, 0x00,
-    0x05, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01,
-    0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4,
-    0x00, 0x1F, 0x40, 0x2F, 0xFF, 0x43, 0xFF, 0xF8, 0x00, 0x01, 0x03, 0xD0, 0xBC, 0x3E, 0x0B, 0xC1,
-    0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x82, 0xFF, 0xF8, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01,
-    0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x02, 0xFF, 0xF4, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x40,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF5, 0x5A, 0xFF, 0x40, 0x03, 0xE0, 0x00, 0x2F, 0xD0,
-    0x03, 0xE0, 0x00, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x03,
-    0xE0, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x17, 0xF5, 0x54, 0x00, 0x7D, 0x3F, 0xFF,
-    0xFC, 0x00, 0x7E, 0x3F, 0xFF, 0xF8, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00,
-    0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x07,
-    0xF0, 0x03, 0xE0, 0x00, 0x1F, 0xD0, 0x03, 0xE5, 0x56, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x03, 0xFD, 0x07, 0x40, 0x00, 0xFB,
-    0xFF, 0xF0, 0x00, 0x0E, 0x03, 0xFD, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xD3, 0xF8, 0x00, 0x00, 0x3D, 0x3F, 0xD0, 0x00, 0x03, 0xD3, 0xFF, 0x00,
-    0x00, 0x3D, 0x3D, 0xF8, 0x00, 0x03, 0xD3, 0xCB, 0xD0, 0x00, 0x3D, 0x3C, 0x3F, 0x00, 0x03, 0xD3,
-    0xC1, 0xF8, 0x00, 0x3D, 0x3C, 0x0F, 0xC0, 0x03, 0xD3, 0xD0, 0x3F, 0x00, 0x3D, 0x3D, 0x01, 0xF8,
-    0x03, 0xD3, 0xD0, 0x0F, 0xC0, 0x3D, 0x3D, 0x00, 0x3F, 0x03, 0xD3, 0xD0, 0x02, 0xF4, 0x3D, 0x3D,
-    0x00, 0x0F, 0xC3, 0xD3, 0xD0, 0x00, 0x7F, 0x3D, 0x3D, 0x00, 0x02, 0xF7, 0xD3, 0xD0, 0x00, 0x0F,
-    0xFD, 0x3D, 0x00, 0x00, 0x7F, 0xD3, 0xD0, 0x00, 0x02, 0xFD, 0x3D, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F,
-    0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC,
-    0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E,
-    0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00,
-    0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F,
-    0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40,
-    0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E,
-    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40,
-    0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00,
-    0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE,
-    0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F,
-    0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE,
-    0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x0F, 0xF8, 0x0E, 0x00, 0x00, 0x1F, 0xBF, 0xFD,
-    0x00, 0x00, 0x3C, 0x0B, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07,
-    0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00,
-    0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC,
-    0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x02, 0x40,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01,
-    0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x43, 0xE0, 0x00,
-    0x3D, 0x1F, 0x80, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x01, 0xF8, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x3F, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
-    0x83, 0xF0, 0x00, 0x7D, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x0B, 0xFF, 0xE4, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x7F, 0xD0, 0x07,
-    0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x2F, 0xF8, 0x1F, 0x80, 0x00, 0x7C, 0xFC, 0x2F, 0x00,
-    0x00, 0xF4, 0x7D, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x3E, 0x00, 0x0B, 0xC0, 0x3F, 0x3E, 0x00, 0x1F,
-    0x40, 0x3F, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0xBC, 0x00, 0x3F, 0x3E, 0x01, 0xF0, 0x00,
-    0x3F, 0x3F, 0x03, 0xE0, 0x00, 0x3E, 0x2F, 0x0F, 0xC0, 0x00, 0x7E, 0x1F, 0x5F, 0x00, 0x00, 0xBC,
-    0x0F, 0xFD, 0x00, 0x01, 0xFC, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x03, 0xFE, 0x00, 0x2F, 0xD0, 0x07,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0x8B, 0xFF, 0xF8, 0x00, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-    0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00,
-    0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00,
-    0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4,
-    0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0xF4,
-    0xFC, 0x00, 0x00, 0xBC, 0x2F, 0x80, 0x00, 0x3F, 0x03, 0xF9, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F,
-    0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0xBC,
-    0x2F, 0x80, 0x00, 0x3F, 0x03, 0xF9, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x10, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00,
-    0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40,
-    0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F,
-    0x40, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0xBC, 0x2F, 0x80, 0x00, 0x3F,
-    0x03, 0xF9, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00,
-    0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF9,
-    0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00,
-    0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00,
-    0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x03, 0xD3,
-    0xF0, 0x00, 0x02, 0xF0, 0xBE, 0x00, 0x00, 0xFC, 0x0F, 0xE4, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x3F, 0x0B,
-    0xC0, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x03, 0xE0,
-    0x00, 0xBC, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x3F, 0x7D,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xD0, 0x06, 0xFD, 0x0F, 0x40, 0x01, 0xFC, 0x3D, 0x00,
-    0x03, 0xF0, 0xF4, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0xFC, 0x3D, 0x00, 0x03,
-    0xE0, 0xF4, 0x00, 0x7F, 0x03, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x3E, 0x55, 0x40, 0x00,
-    0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x3F, 0x40, 0x1F, 0xC0, 0x7D,
-    0x00, 0x07, 0xC0, 0x7C, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x40, 0xBC,
-    0x00, 0xFD, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xBC,
-    0x03, 0xF4, 0x00, 0xBC, 0x01, 0xFE, 0x00, 0xBC, 0x00, 0x7F, 0xC0, 0xBC, 0x00, 0x0B, 0xF0, 0xBC,
-    0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x7C, 0xBC, 0x00, 0x00, 0xBC, 0xBC,
-    0x14, 0x00, 0xFC, 0xBC, 0x2F, 0xFF, 0xF0, 0xBC, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x90, 0x0B, 0xFF, 0xFE, 0x02, 0xE4, 0x1F, 0xD0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x56, 0xF0, 0x2F, 0xFF, 0xFC,
-    0x7F, 0xE5, 0x6F, 0x3F, 0x00, 0x0B, 0xEF, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xFE, 0xF0, 0x00, 0x7F,
-    0x7E, 0x00, 0x7F, 0xCF, 0xFF, 0xFD, 0xF0, 0xBF, 0xF8, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x90, 0x0B, 0xFF, 0xFE, 0x02, 0xE4, 0x1F, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x56, 0xF0, 0x2F, 0xFF, 0xFC, 0x7F, 0xE5,
-    0x6F, 0x3F, 0x00, 0x0B, 0xEF, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xFE, 0xF0, 0x00, 0x7F, 0x7E, 0x00,
-    0x7F, 0xCF, 0xFF, 0xFD, 0xF0, 0xBF, 0xF8, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xD3, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0x40, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xBF, 0x90, 0x0B, 0xFF, 0xFE, 0x02, 0xE4, 0x1F, 0xD0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x56, 0xF0, 0x2F, 0xFF, 0xFC, 0x7F, 0xE5, 0x6F, 0x3F,
-    0x00, 0x0B, 0xEF, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xFE, 0xF0, 0x00, 0x7F, 0x7E, 0x00, 0x7F, 0xCF,
-    0xFF, 0xFD, 0xF0, 0xBF, 0xF8, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x50, 0x01, 0x00, 0xFF, 0x81, 0xD0,
-    0xBA, 0xFF, 0xF0, 0x38, 0x0B, 0xF4, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x40,
-    0x2F, 0xFF, 0xF8, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x00, 0x01, 0x5B, 0xC0, 0xBF, 0xFF, 0xF1, 0xFF, 0x95, 0xBC, 0xFC, 0x00, 0x2F, 0xBC, 0x00, 0x0B,
-    0xEF, 0x00, 0x03, 0xFB, 0xC0, 0x01, 0xFD, 0xF8, 0x01, 0xFF, 0x3F, 0xFF, 0xF7, 0xC2, 0xFF, 0xE0,
-    0xF0, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3F, 0x07, 0xD0, 0x02, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x40, 0x2F, 0xFF, 0xF8, 0x0B, 0x90,
-    0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x5B, 0xC0, 0xBF,
-    0xFF, 0xF1, 0xFF, 0x95, 0xBC, 0xFC, 0x00, 0x2F, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x03, 0xFB, 0xC0,
-    0x01, 0xFD, 0xF8, 0x01, 0xFF, 0x3F, 0xFF, 0xF7, 0xC2, 0xFF, 0xE0, 0xF0, 0x01, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x2F, 0xBC, 0x00, 0x0E, 0x07, 0x40, 0x03, 0x80, 0xD0, 0x00, 0xF4, 0xB0, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE4, 0x02, 0xFF, 0xFF, 0x80,
-    0xB9, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x15, 0xBC,
-    0x0B, 0xFF, 0xFF, 0x1F, 0xF9, 0x5B, 0xCF, 0xC0, 0x02, 0xFB, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x3F,
-    0xBC, 0x00, 0x1F, 0xDF, 0x80, 0x1F, 0xF3, 0xFF, 0xFF, 0x7C, 0x2F, 0xFE, 0x0F, 0x00, 0x10, 0x00,
-    0x00, 0x01, 0xBF, 0xE0, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0xF9, 0x0B, 0xFF,
-    0xD1, 0xBD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xE0, 0x00, 0x55, 0xFD, 0x55, 0x5F, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F,
-    0xF9, 0x5F, 0xEA, 0xAA, 0xA4, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xF8, 0x02, 0xF7, 0xE0,
-    0x01, 0xC3, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x02, 0xFF, 0xE0, 0x07, 0xFF, 0xF4, 0x00, 0x10, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0x56, 0xD0, 0x7E, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF4, 0x01,
-    0x80, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xF4, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xBE,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x1A, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x02, 0xFF, 0xFE, 0x00, 0xBE, 0x46,
-    0xF8, 0x1F, 0x40, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x03, 0xF7, 0xE5, 0x55, 0x7F, 0x7F,
-    0xFF, 0xFF, 0xF7, 0xFA, 0xAA, 0xAA, 0x7D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0x80, 0x3F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x02, 0xFF,
-    0xFE, 0x00, 0xBE, 0x46, 0xF8, 0x1F, 0x40, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x03, 0xF7,
-    0xE5, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0xF7, 0xFA, 0xAA, 0xAA, 0x7D, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0x80, 0x3F, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x1F, 0x4F, 0xC0, 0x03, 0xD0, 0x2E, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFE, 0x40, 0x02, 0xFF, 0xFE, 0x00, 0xBE, 0x46, 0xF8, 0x1F, 0x40, 0x0B, 0xC3, 0xF0, 0x00, 0x3E,
-    0x3E, 0x00, 0x03, 0xF7, 0xE5, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0xF7, 0xFA, 0xAA, 0xAA, 0x7D, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0x80,
-    0x3F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x40, 0x00, 0x00, 0x2F, 0x03,
-    0xD0, 0x02, 0xF0, 0x3D, 0x00, 0x09, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x03,
-    0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7, 0xD0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x18,
-    0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x15, 0x00, 0xBD, 0x00, 0xFC,
-    0x00, 0xF8, 0x00, 0xF4, 0x00, 0x50, 0x00, 0x00, 0x68, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC,
-    0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0,
-    0x0B, 0xC0, 0x2F, 0x00, 0x01, 0x50, 0x1F, 0x80, 0xFC, 0x0B, 0xC0, 0x7C, 0x01, 0x40, 0x00, 0x00,
-    0x1A, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00,
-    0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x14, 0x00,
-    0x03, 0xF8, 0x00, 0x3F, 0xF4, 0x03, 0xF1, 0xF4, 0x2E, 0x01, 0xF4, 0x50, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC,
-    0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0x0F,
-    0x42, 0xE7, 0xD0, 0xFC, 0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B,
-    0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0xC0, 0x00, 0x7F, 0xAF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x6B, 0xA1, 0xF0, 0x02, 0xFF, 0xFE, 0xF4, 0x0F, 0xE5, 0x5F, 0xF8, 0x2F,
-    0x40, 0x02, 0xFC, 0x3E, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xBC, 0x7C, 0x00, 0x00, 0xBC, 0x7C,
-    0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x01, 0xF0, 0x0F,
-    0xD0, 0x07, 0xE0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x50, 0x01, 0x00, 0x3F, 0xD0, 0x70, 0x0F, 0xBF, 0xFF, 0x00, 0xD0, 0x7F, 0xC0, 0x04, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x1F, 0xF8, 0x0B, 0xCF, 0xFF, 0xF4, 0xBF, 0xE4, 0x6F, 0xCB, 0xF0,
-    0x00, 0xBD, 0xBE, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC,
-    0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC,
-    0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x02, 0xE0, 0x1F, 0x40,
-    0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC,
-    0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x14, 0x00, 0x40,
-    0x01, 0xFF, 0x42, 0xC0, 0x03, 0xEF, 0xFF, 0x80, 0x07, 0x41, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0,
-    0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF4, 0x2F, 0x00,
-    0x00, 0xF4, 0x2F, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0,
-    0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8,
-    0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4,
-    0xF4, 0x02, 0xFF, 0xFF, 0xF0, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x0F, 0xF0, 0x3F, 0x00, 0x2F,
-    0xF4, 0x3E, 0x00, 0x7C, 0xF8, 0x7D, 0x00, 0xF4, 0xBC, 0x7D, 0x03, 0xE0, 0xBC, 0x7D, 0x0B, 0xC0,
-    0xBC, 0x7D, 0x1F, 0x00, 0xBC, 0x3D, 0x3D, 0x00, 0xFC, 0x3F, 0xF8, 0x00, 0xF8, 0x1F, 0xF0, 0x02,
-    0xF0, 0x0F, 0xE0, 0x0B, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xBF, 0xFD, 0x00, 0x08, 0x01, 0x40,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x29, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0xFE, 0x3F, 0x40, 0x3F, 0xE2, 0xFF, 0xFF, 0xBE, 0x07, 0xFF,
-    0xD2, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0x29, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0xFE, 0x3F, 0x40, 0x3F, 0xE2, 0xFF,
-    0xFF, 0xBE, 0x07, 0xFF, 0xD2, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x2F, 0x1F, 0x80, 0x07, 0xC0, 0x3D, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x06, 0x80, 0x00, 0x29, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0xFE, 0x3F,
-    0x40, 0x3F, 0xE2, 0xFF, 0xFF, 0xBE, 0x07, 0xFF, 0xD2, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x3E, 0x07, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0x18, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xE3,
-    0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x29, 0xBC, 0x00, 0x01, 0xF4,
-    0xF8, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x3E, 0x07, 0xD0, 0x01, 0xF4, 0x0F, 0x80, 0x0B, 0xC0, 0x2F,
-    0x00, 0x3E, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0xBC, 0x0F, 0xC0, 0x01, 0xF0, 0x3D, 0x00, 0x03, 0xE1,
-    0xF0, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x07, 0xF9, 0x00, 0xBC, 0xFF, 0xFF,
-    0x02, 0xFF, 0x91, 0xBF, 0x0B, 0xF0, 0x00, 0xBD, 0x2F, 0x80, 0x00, 0xFC, 0xBD, 0x00, 0x02, 0xF2,
-    0xF0, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x7D, 0xBC, 0x00, 0x01, 0xF6, 0xF0,
-    0x00, 0x0B, 0xCB, 0xE0, 0x00, 0x3F, 0x2F, 0xC0, 0x01, 0xF8, 0xBF, 0xC0, 0x1F, 0xC2, 0xFB, 0xFF,
-    0xFD, 0x0B, 0xC7, 0xFF, 0xC0, 0x2F, 0x00, 0x50, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x24, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x0A, 0x6F, 0x00, 0x00, 0x7D, 0x3E, 0x00,
-    0x02, 0xF0, 0xBC, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x7D, 0x03, 0xE0, 0x02, 0xF0, 0x0B, 0xC0, 0x0F,
-    0x80, 0x0F, 0x40, 0x7C, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0xF8, 0x7C, 0x00,
-    0x02, 0xF3, 0xE0, 0x00, 0x03, 0xDF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00,
-    0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0xFC,
-    0x00, 0x00, 0x01, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x80, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xAF, 0xE4, 0x02, 0xFF, 0xFF, 0x80, 0xB9, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x15, 0xBC, 0x0B, 0xFF, 0xFF, 0x1F, 0xF9, 0x5B, 0xCF, 0xC0,
-    0x02, 0xFB, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x3F, 0xBC, 0x00, 0x1F, 0xDF, 0x80, 0x1F, 0xF3, 0xFF,
-    0xFF, 0x7C, 0x2F, 0xFE, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x90, 0x00, 0x00, 0xE0,
-    0x07, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3,
-    0xE0, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00,
-    0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00,
-    0x3D, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1,
-    0xF0, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x02, 0x00, 0x09, 0x00, 0xE0, 0x07,
-    0x80, 0x2F, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE,
-    0x40, 0x2F, 0xFF, 0xF8, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x2F, 0x00, 0x01, 0x5B, 0xC0, 0xBF, 0xFF, 0xF1, 0xFF, 0x95, 0xBC, 0xFC, 0x00, 0x2F, 0xBC, 0x00,
-    0x0B, 0xEF, 0x00, 0x03, 0xFB, 0xC0, 0x01, 0xFD, 0xF8, 0x01, 0xFF, 0x3F, 0xFF, 0xF7, 0xC2, 0xFF,
-    0xE0, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E,
-    0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00,
-    0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03,
-    0xD0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F,
-    0x00, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x50, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0xAF, 0xE4, 0x00, 0xBF, 0xFF,
-    0xE0, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x01, 0x5B, 0xC0, 0x2F, 0xFF, 0xFC, 0x1F, 0xF9, 0x5B, 0xC3, 0xF0, 0x00, 0xBC, 0xBC, 0x00, 0x0B,
-    0xCB, 0xC0, 0x00, 0xFC, 0xBC, 0x00, 0x1F, 0xC7, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xF7, 0xC0, 0xBF,
-    0xF8, 0x3C, 0x00, 0x10, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x3E, 0x50, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x7F, 0xE4, 0x1B, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x06, 0x80, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE4, 0x02, 0xFF, 0xFF, 0x02, 0xFD, 0x5B, 0x41, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x7F, 0xE4, 0x1B, 0xC0,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x90, 0x06, 0x80, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xD3, 0xF0, 0x03, 0xD0,
-    0x2E, 0x00, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x02, 0xFF, 0xFF, 0x02, 0xFD,
-    0x5B, 0x41, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0x90, 0x6F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x1A, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x0B, 0xFF, 0xFC,
-    0x0B, 0xF5, 0x6D, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x18, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x14,
-    0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x7F, 0xE4, 0x1B, 0xC0, 0x3F, 0x40, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x06, 0x80,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0x00, 0x05,
-    0x00, 0xF4, 0x0B, 0x80, 0x1F, 0x4F, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x02, 0xFF, 0xFF, 0x02, 0xFD, 0x5B, 0x41, 0xF8, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0,
-    0x06, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00,
-    0x0F, 0x40, 0x7C, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x03, 0xE5, 0x5A, 0xFF, 0x40, 0x3D, 0x00, 0x01, 0xFD, 0x03, 0xD0, 0x00, 0x07,
-    0xF0, 0x3D, 0x00, 0x00, 0x1F, 0x83, 0xD0, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x0B, 0xC3, 0xD0,
-    0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x00, 0x7E, 0x3D, 0x00, 0x00, 0x07,
-    0xD3, 0xD0, 0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x00, 0xFC, 0x3D, 0x00,
-    0x00, 0x1F, 0x83, 0xD0, 0x00, 0x07, 0xF0, 0x3D, 0x00, 0x01, 0xFD, 0x03, 0xE5, 0x56, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x00, 0x00,
-    0xF4, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0xF4,
-    0x00, 0x03, 0xFF, 0xFC, 0xF4, 0x00, 0x0F, 0xE4, 0x6F, 0xF4, 0x00, 0x1F, 0x80, 0x07, 0xF4, 0x00,
-    0x3F, 0x00, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0x7D,
-    0x00, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0x3D, 0x00,
-    0x00, 0xF4, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x0F,
-    0xF4, 0x00, 0x07, 0xFF, 0xFD, 0xF4, 0x00, 0x01, 0xFF, 0xF4, 0xB4, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF5, 0x5A, 0xFF, 0x40,
-    0x03, 0xE0, 0x00, 0x2F, 0xD0, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x03,
-    0xE0, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x17, 0xF5,
-    0x54, 0x00, 0x7D, 0x3F, 0xFF, 0xFC, 0x00, 0x7E, 0x3F, 0xFF, 0xF8, 0x00, 0x7D, 0x03, 0xE0, 0x00,
-    0x00, 0x7D, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x01,
-    0xF8, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x1F, 0xD0, 0x03, 0xE5, 0x56, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2A, 0xAB, 0xF9, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-    0x01, 0x55, 0x7E, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xBE, 0x43, 0xD0, 0x03, 0xFF, 0xFC, 0xF4,
-    0x03, 0xFD, 0x5B, 0xFD, 0x01, 0xF8, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x0B, 0xD0, 0x3E, 0x00, 0x01,
-    0xF4, 0x1F, 0x40, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x0F, 0x41, 0xF4, 0x00, 0x03, 0xD0, 0x7D, 0x00,
-    0x00, 0xF4, 0x0F, 0x40, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x0F, 0xD0, 0x0F,
-    0xD0, 0x0B, 0xF4, 0x01, 0xFF, 0xFF, 0x7D, 0x00, 0x1F, 0xFF, 0x4B, 0x40, 0x00, 0x14, 0x00, 0x00,
-    0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xD3, 0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0xF9, 0x55, 0x50, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00,
-    0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00,
-    0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x06, 0x00, 0x08, 0x01,
-    0xD0, 0x0B, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x3E, 0x55, 0x55, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0x0F, 0x95, 0x55, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x55, 0x55, 0x0F, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xF4, 0x02, 0x00, 0x05, 0x00, 0x38, 0x01, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0,
-    0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55,
-    0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x3E,
-    0x55, 0x55, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0x95, 0x55, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3E, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC,
-    0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA,
-    0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xD3, 0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xF0, 0xF9, 0x55, 0x50, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x7D, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0,
-    0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55,
-    0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFC, 0x00, 0x01, 0x5F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0xBD, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05, 0x40, 0x05, 0x00, 0x05, 0x02, 0xF0, 0x0F,
-    0x40, 0x2F, 0x1F, 0x40, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x4F, 0x95, 0x55, 0x43, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0x40, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x95, 0x55, 0x43, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x01, 0x00, 0x05, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF4, 0xFC, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x40, 0x02, 0xFF, 0xFE, 0x00, 0xBE, 0x46, 0xF8, 0x1F, 0x40, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x3E,
-    0x00, 0x03, 0xF7, 0xE5, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0xF7, 0xFA, 0xAA, 0xAA, 0x7D, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0x80, 0x3F,
-    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0x0B, 0x80, 0x7D,
-    0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFE, 0x40, 0x6F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xFF, 0xC3, 0xE0,
-    0x00, 0x3F, 0xFF, 0x0F, 0x80, 0x00, 0x55, 0xBC, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00,
-    0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x2F, 0x03, 0xF4, 0x00, 0x00, 0xBC, 0x07, 0xF4, 0x00, 0x02, 0xF0,
-    0x0B, 0xF9, 0x00, 0x1B, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3E,
-    0x2F, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4,
-    0x19, 0x03, 0xFF, 0xFC, 0xF4, 0x3F, 0x95, 0xBF, 0xD1, 0xF8, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0xBD,
-    0x3E, 0x00, 0x01, 0xF5, 0xF4, 0x00, 0x03, 0xD7, 0xD0, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x7D,
-    0x00, 0x00, 0xF4, 0xF4, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x1F, 0x4B, 0xD0, 0x00, 0xFD, 0x0F, 0xD0,
-    0x0B, 0xF4, 0x1F, 0xFF, 0xF7, 0xD0, 0x1F, 0xFF, 0x4F, 0x40, 0x01, 0x40, 0x3D, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x03, 0x94, 0x07, 0xF4, 0x0F, 0xFF, 0xFF, 0x40,
-    0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x2D, 0x00, 0xB0, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x90, 0x1B, 0xC0, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x03, 0xFF, 0xF0, 0xF8, 0x00, 0x0F, 0xFF, 0xC3, 0xE0, 0x00, 0x15, 0x6F, 0x0F, 0xC0,
-    0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x00,
-    0x2F, 0x01, 0xFD, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x40, 0x06, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x06, 0x00, 0x0B, 0x00, 0x3C,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFD, 0x06, 0x40, 0xFF, 0xFF, 0x3D, 0x0F, 0xE5, 0x6F, 0xF4, 0x7E, 0x00, 0x1F, 0xD3, 0xF0,
-    0x00, 0x2F, 0x4F, 0x80, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0xF5, 0xF4, 0x00, 0x03, 0xD7, 0xD0, 0x00,
-    0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x07, 0xD2, 0xF4, 0x00, 0x3F,
-    0x43, 0xF4, 0x02, 0xFD, 0x07, 0xFF, 0xFD, 0xF4, 0x07, 0xFF, 0xD3, 0xD0, 0x00, 0x50, 0x0F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xE5, 0x01, 0xFD, 0x03, 0xFF,
-    0xFF, 0xD0, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x90, 0x1B,
-    0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x03, 0xFF, 0xF0, 0xF8, 0x00, 0x0F, 0xFF, 0xC3, 0xE0, 0x00, 0x15, 0x6F,
-    0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0xFD,
-    0x00, 0x00, 0x2F, 0x01, 0xFD, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x40, 0x06, 0xF0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFD, 0x06, 0x40, 0xFF, 0xFF, 0x3D, 0x0F, 0xE5, 0x6F, 0xF4, 0x7E, 0x00, 0x1F,
-    0xD3, 0xF0, 0x00, 0x2F, 0x4F, 0x80, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0xF5, 0xF4, 0x00, 0x03, 0xD7,
-    0xD0, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x07, 0xD2, 0xF4,
-    0x00, 0x3F, 0x43, 0xF4, 0x02, 0xFD, 0x07, 0xFF, 0xFD, 0xF4, 0x07, 0xFF, 0xD3, 0xD0, 0x00, 0x50,
-    0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xE5, 0x01, 0xFD,
-    0x03, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xE4, 0x06, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFF,
-    0xFC, 0x3E, 0x00, 0x03, 0xFF, 0xF0, 0xF8, 0x00, 0x05, 0x5B, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x02, 0xF0, 0x3F, 0x40, 0x00, 0x0B, 0xC0, 0x7F, 0x40,
-    0x00, 0x2F, 0x00, 0xBF, 0x90, 0x01, 0xBC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x19,
-    0x03, 0xFF, 0xFC, 0xF4, 0x3F, 0x95, 0xBF, 0xD1, 0xF8, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0xBD, 0x3E,
-    0x00, 0x01, 0xF5, 0xF4, 0x00, 0x03, 0xD7, 0xD0, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x7D, 0x00,
-    0x00, 0xF4, 0xF4, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x1F, 0x4B, 0xD0, 0x00, 0xFD, 0x0F, 0xD0, 0x0B,
-    0xF4, 0x1F, 0xFF, 0xF7, 0xD0, 0x1F, 0xFF, 0x4F, 0x40, 0x01, 0x40, 0x3D, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x03, 0x94, 0x07, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0x1B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0xBC, 0x7D, 0x00, 0x00, 0xB8, 0x07, 0xD0, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00,
-    0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0,
-    0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xE5, 0x55, 0x55, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03,
-    0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00,
-    0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0x2E, 0x01, 0xF4, 0x00,
-    0x01, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x1B, 0xF8, 0x00, 0x0B, 0xCF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xC0, 0x0B, 0xF4, 0x00, 0xBD, 0x00, 0xBE, 0x00, 0x03, 0xE0,
-    0x0B, 0xD0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00,
-    0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00,
-    0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00,
-    0x3E, 0x03, 0xD0, 0x00, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x00,
-    0xFC, 0x05, 0x7E, 0x55, 0x55, 0x5F, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3E, 0x55,
-    0x55, 0x5F, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0,
-    0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x6F, 0xEA, 0xA8, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x5B, 0xD5, 0x54, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x14, 0x00, 0x0B, 0xC7, 0xFF, 0xE0, 0x0B, 0xDF, 0xFF, 0xF8, 0x0B, 0xFC, 0x00,
-    0xFC, 0x0B, 0xF0, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00,
-    0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00,
-    0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00,
-    0x3E, 0x01, 0x40, 0x04, 0x1F, 0xF4, 0x2C, 0x3E, 0xFF, 0xFC, 0x34, 0x1F, 0xF0, 0x10, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x0B, 0xFF, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xE0, 0x01, 0x40, 0x04, 0x1F, 0xF4, 0x2C, 0x3E, 0xFF, 0xF8, 0x70, 0x1F, 0xF0, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xFD, 0x15, 0x55, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0x82, 0xFF, 0xF8, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x02, 0xFF, 0xF4,
-    0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0xCB, 0xFF, 0xFC, 0x15, 0x55, 0x40, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x00, 0x2F, 0x00, 0x60, 0x00, 0x97, 0x40, 0x2D, 0x3F, 0xFF, 0xC0, 0xFF, 0xE0, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x82, 0xFF, 0xF8, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4,
-    0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x02, 0xFF, 0xF4, 0x3F, 0xFF, 0x80, 0x50, 0x00, 0x8B, 0x00, 0x3C, 0x3F, 0xFF,
-    0x81, 0xFF, 0xE0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00,
-    0xBF, 0xFE, 0xBF, 0xFE, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0xBF, 0xFD, 0xFF, 0xFE, 0x00, 0xB4, 0x01, 0xE0, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0xE5, 0x02, 0xFE, 0x00, 0x14, 0x01, 0x40, 0xBC, 0x0B, 0xC0, 0x28, 0x00, 0x00,
-    0x00, 0x06, 0x80, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC,
-    0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0x41, 0xE0, 0x3C, 0x03, 0xC0, 0x3E,
-    0x52, 0xFE, 0x01, 0x40, 0x01, 0x40, 0x07, 0xD0, 0x07, 0xD0, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0xBF, 0xFE, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0xBF, 0xFD, 0xFF, 0xFE, 0x68, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
-    0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBF, 0xFE, 0x01, 0xF2, 0xFF, 0xF8,
-    0x07, 0xC0, 0x7D, 0x00, 0x1F, 0x01, 0xF4, 0x00, 0x7C, 0x07, 0xD0, 0x01, 0xF0, 0x1F, 0x40, 0x07,
-    0xC0, 0x7D, 0x00, 0x1F, 0x01, 0xF4, 0x00, 0x7C, 0x07, 0xD0, 0x01, 0xF0, 0x1F, 0x40, 0x07, 0xC0,
-    0x7D, 0x00, 0x1F, 0x01, 0xF4, 0x00, 0x7C, 0x07, 0xD0, 0x01, 0xF0, 0x1F, 0x40, 0x07, 0xC0, 0x7D,
-    0x00, 0x1F, 0x01, 0xF4, 0x00, 0x7C, 0x07, 0xD0, 0x01, 0xF0, 0x1F, 0x40, 0x07, 0xC0, 0x7D, 0x00,
-    0x1F, 0x2F, 0xFF, 0x40, 0x7C, 0xFF, 0xFE, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x14, 0x00, 0x52, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xCA, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x80, 0x0A, 0x6F, 0x00, 0x3E, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xAF, 0x00,
-    0x3E, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xAF, 0x00, 0x3E, 0xBC, 0x00, 0xFA, 0xF0,
-    0x03, 0xEB, 0xC0, 0x0F, 0xAF, 0x00, 0x3E, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xE0, 0x00, 0x0F, 0x80,
-    0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x04, 0x3F, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0x80,
-    0x00, 0x05, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xE0, 0x02, 0xF1, 0xF8, 0x07, 0xC0, 0x3D, 0x05,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F,
-    0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40,
-    0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00,
-    0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F,
-    0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xFD, 0x00,
-    0x7F, 0xF4, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x14, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xF4, 0x03, 0xF1,
-    0xF4, 0x2E, 0x01, 0xF4, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x7E, 0x00, 0xBF, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBD, 0x0F, 0x40, 0x00,
-    0xBE, 0x03, 0xD0, 0x00, 0x7E, 0x00, 0xF4, 0x00, 0x7E, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x0F, 0x40,
-    0x3F, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x0F,
-    0x6F, 0x80, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00,
-    0x0F, 0x40, 0xBE, 0x00, 0x03, 0xD0, 0x0F, 0xD0, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x1F,
-    0xC0, 0x0F, 0x40, 0x02, 0xF8, 0x03, 0xD0, 0x00, 0x3F, 0x40, 0xF4, 0x00, 0x03, 0xF0, 0x3D, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xA4, 0xBC, 0x00, 0x3F, 0x0B,
-    0xC0, 0x0F, 0xC0, 0xBC, 0x03, 0xF0, 0x0B, 0xC0, 0xFC, 0x00, 0xBC, 0x3F, 0x00, 0x0B, 0xCF, 0xC0,
-    0x00, 0xBE, 0xFC, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xBF, 0x2F, 0x40, 0x0B, 0xC0, 0xFC, 0x00, 0xBC,
-    0x03, 0xF0, 0x0B, 0xC0, 0x1F, 0x80, 0xBC, 0x00, 0xBD, 0x0B, 0xC0, 0x03, 0xF0, 0xBC, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x68, 0x00, 0x1A, 0x4B, 0xC0, 0x03, 0xF0,
-    0xBC, 0x00, 0xFC, 0x0B, 0xC0, 0x3F, 0x00, 0xBC, 0x0B, 0xD0, 0x0B, 0xC2, 0xF4, 0x00, 0xBC, 0x7E,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x0B, 0xF5, 0xF8, 0x00, 0xBD, 0x0B, 0xD0, 0x0B,
-    0xC0, 0x3F, 0x00, 0xBC, 0x01, 0xF8, 0x0B, 0xC0, 0x0B, 0xD0, 0xBC, 0x00, 0x3F, 0x0B, 0xC0, 0x00,
-    0xFC, 0x01, 0x50, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x95, 0x55, 0x43, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x01, 0x50, 0x1F, 0x80,
-    0xFC, 0x0B, 0xC0, 0x7C, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F,
-    0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC,
-    0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xC2, 0xF0,
-    0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC,
-    0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x03, 0xD1, 0xF0, 0xB8, 0x3C,
-    0x04, 0x00, 0x3D, 0x00, 0x0F, 0x4F, 0x40, 0x03, 0xC3, 0xD0, 0x01, 0xF0, 0xF4, 0x00, 0xB4, 0x3D,
-    0x00, 0x38, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0x3E, 0xBC, 0x3D, 0xBC, 0x3C, 0xBC,
-    0x74, 0xBC, 0x50, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x50, 0x0F, 0x40, 0x3E, 0x03, 0xD0, 0x1F, 0x80, 0xF4, 0x02, 0x80, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x10,
-    0xBC, 0xBC, 0xBC, 0xFC, 0xBC, 0x64, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0xBF, 0xC0, 0x00, 0x3F, 0xF4,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0x3D, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x55, 0x55, 0x00,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x40, 0x2F, 0xF4,
-    0x0B, 0xFC, 0x03, 0xF8, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00,
-    0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x3F,
-    0x80, 0x00, 0x03, 0xD3, 0xFD, 0x00, 0x00, 0x3D, 0x3F, 0xF0, 0x00, 0x03, 0xD3, 0xDF, 0x80, 0x00,
-    0x3D, 0x3C, 0xBD, 0x00, 0x03, 0xD3, 0xC3, 0xF0, 0x00, 0x3D, 0x3C, 0x1F, 0x80, 0x03, 0xD3, 0xC0,
-    0xFC, 0x00, 0x3D, 0x3D, 0x03, 0xF0, 0x03, 0xD3, 0xD0, 0x1F, 0x80, 0x3D, 0x3D, 0x00, 0xFC, 0x03,
-    0xD3, 0xD0, 0x03, 0xF0, 0x3D, 0x3D, 0x00, 0x2F, 0x43, 0xD3, 0xD0, 0x00, 0xFC, 0x3D, 0x3D, 0x00,
-    0x07, 0xF3, 0xD3, 0xD0, 0x00, 0x2F, 0x7D, 0x3D, 0x00, 0x00, 0xFF, 0xD3, 0xD0, 0x00, 0x07, 0xFD,
-    0x3D, 0x00, 0x00, 0x2F, 0xD3, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x54, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x41, 0xFF, 0x80, 0xBC, 0xFF, 0xFF, 0x4B, 0xFE, 0x46, 0xFC, 0xBF, 0x00, 0x0B, 0xDB,
-    0xE0, 0x00, 0x3E, 0xBD, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xD3, 0xF8,
-    0x00, 0x00, 0x3D, 0x3F, 0xD0, 0x00, 0x03, 0xD3, 0xFF, 0x00, 0x00, 0x3D, 0x3D, 0xF8, 0x00, 0x03,
-    0xD3, 0xCB, 0xD0, 0x00, 0x3D, 0x3C, 0x3F, 0x00, 0x03, 0xD3, 0xC1, 0xF8, 0x00, 0x3D, 0x3C, 0x0F,
-    0xC0, 0x03, 0xD3, 0xD0, 0x3F, 0x00, 0x3D, 0x3D, 0x01, 0xF8, 0x03, 0xD3, 0xD0, 0x0F, 0xC0, 0x3D,
-    0x3D, 0x00, 0x3F, 0x03, 0xD3, 0xD0, 0x02, 0xF4, 0x3D, 0x3D, 0x00, 0x0F, 0xC3, 0xD3, 0xD0, 0x00,
-    0x7F, 0x3D, 0x3D, 0x00, 0x02, 0xF7, 0xD3, 0xD0, 0x00, 0x0F, 0xFD, 0x3D, 0x00, 0x00, 0x7F, 0xD3,
-    0xD0, 0x00, 0x02, 0xFD, 0x3D, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x64, 0x1F, 0xF8, 0x0B, 0xCF, 0xFF, 0xF4, 0xBF,
-    0xE4, 0x6F, 0xCB, 0xF0, 0x00, 0xBD, 0xBE, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x07, 0xC0,
-    0x3E, 0x00, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x3F, 0x80, 0x00,
-    0x03, 0xD3, 0xFD, 0x00, 0x00, 0x3D, 0x3F, 0xF0, 0x00, 0x03, 0xD3, 0xDF, 0x80, 0x00, 0x3D, 0x3C,
-    0xBD, 0x00, 0x03, 0xD3, 0xC3, 0xF0, 0x00, 0x3D, 0x3C, 0x1F, 0x80, 0x03, 0xD3, 0xC0, 0xFC, 0x00,
-    0x3D, 0x3D, 0x03, 0xF0, 0x03, 0xD3, 0xD0, 0x1F, 0x80, 0x3D, 0x3D, 0x00, 0xFC, 0x03, 0xD3, 0xD0,
-    0x03, 0xF0, 0x3D, 0x3D, 0x00, 0x2F, 0x43, 0xD3, 0xD0, 0x00, 0xFC, 0x3D, 0x3D, 0x00, 0x07, 0xF3,
-    0xD3, 0xD0, 0x00, 0x2F, 0x7D, 0x3D, 0x00, 0x00, 0xFF, 0xD3, 0xD0, 0x00, 0x07, 0xFD, 0x3D, 0x00,
-    0x00, 0x2F, 0xD3, 0xD0, 0x00, 0x00, 0xFD, 0x05, 0x00, 0x05, 0x00, 0x7C, 0x03, 0xD0, 0x02, 0xF0,
-    0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x41, 0xFF, 0x80, 0xBC, 0xFF, 0xFF, 0x4B, 0xFE, 0x46, 0xFC, 0xBF, 0x00, 0x0B, 0xDB, 0xE0, 0x00,
-    0x3E, 0xBD, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x86,
-    0x41, 0xBF, 0x80, 0xF4, 0x7C, 0xFF, 0xFF, 0x45, 0x07, 0xFE, 0x46, 0xFC, 0x00, 0x7F, 0x40, 0x07,
-    0xD0, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x7C,
-    0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x3E,
-    0x00, 0x7C, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x07, 0xC0,
-    0x00, 0x3E, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xD3, 0xF8, 0x00, 0x00, 0x3D,
-    0x3F, 0xD0, 0x00, 0x03, 0xD3, 0xFF, 0x00, 0x00, 0x3D, 0x3D, 0xF8, 0x00, 0x03, 0xD3, 0xCB, 0xD0,
-    0x00, 0x3D, 0x3C, 0x3F, 0x00, 0x03, 0xD3, 0xC1, 0xF8, 0x00, 0x3D, 0x3C, 0x0B, 0xD0, 0x03, 0xD3,
-    0xD0, 0x3F, 0x00, 0x3D, 0x3D, 0x01, 0xF8, 0x03, 0xD3, 0xD0, 0x0B, 0xD0, 0x3D, 0x3D, 0x00, 0x3F,
-    0x03, 0xD3, 0xD0, 0x00, 0xF8, 0x3D, 0x3D, 0x00, 0x0B, 0xD3, 0xD3, 0xD0, 0x00, 0x3F, 0x3D, 0x3D,
-    0x00, 0x00, 0xFB, 0xD3, 0xD0, 0x00, 0x07, 0xFD, 0x3D, 0x00, 0x00, 0x3F, 0xD3, 0xD0, 0x00, 0x00,
-    0xFD, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x64, 0x1F, 0xF8, 0x0B, 0xCF, 0xFF, 0xF4, 0xBF, 0xE5, 0x6F, 0xCB, 0xF0, 0x00, 0x7D, 0xBE,
-    0x00, 0x03, 0xEB, 0xD0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00,
-    0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0,
-    0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0,
-    0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x00, 0x0F, 0x00,
-    0x78, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00,
-    0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0,
-    0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0xD0, 0x0B, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4,
-    0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC,
-    0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0,
-    0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x02, 0xF0, 0xBD, 0x00, 0x00, 0x07, 0xD0, 0xF4, 0x00, 0x00,
-    0x0F, 0x42, 0xE0, 0x00, 0x00, 0x2E, 0x07, 0x80, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40,
-    0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E,
-    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40,
-    0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00,
-    0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x15, 0x05, 0x40, 0x00, 0x7E, 0x0F, 0x80, 0x00, 0xFC, 0x2F, 0x00, 0x01, 0xF0, 0x7C,
-    0x00, 0x03, 0xC0, 0xF0, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01,
-    0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00,
-    0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02,
-    0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF9, 0x01, 0xFD, 0x55, 0x54, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x3E, 0x00, 0x00, 0x2F,
-    0x55, 0x54, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0x90, 0x00, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x0B, 0xE4,
-    0x6F, 0xCF, 0xD1, 0xBE, 0x01, 0xF4, 0x00, 0x7F, 0xF0, 0x01, 0xF4, 0x3F, 0x00, 0x02, 0xFC, 0x00,
-    0x0F, 0x83, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xFD, 0x55, 0x5F, 0xC7, 0xD0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x7D, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x87, 0xD0, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0xF8, 0x00, 0x64, 0x03, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xA4, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x3E, 0x56, 0xBF, 0xC0, 0x3D, 0x00, 0x0B, 0xE0, 0x3D, 0x00, 0x03, 0xF0,
-    0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x03, 0xE0,
-    0x3D, 0x00, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3E, 0x56, 0xF4, 0x00,
-    0x3D, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F, 0xC0,
-    0x3D, 0x00, 0x07, 0xE0, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xBD,
-    0x00, 0x05, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x06, 0x41, 0xBD, 0xB8, 0xBF, 0xDB, 0xEF, 0x94, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0xBD, 0x00,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xFF, 0xA4, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3E, 0x56, 0xBF, 0xC0, 0x3D, 0x00, 0x0B, 0xE0, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00,
-    0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x03, 0xE0, 0x3D, 0x00,
-    0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3E, 0x56, 0xF4, 0x00, 0x3D, 0x00,
-    0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F, 0xC0, 0x3D, 0x00,
-    0x07, 0xE0, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x19, 0x06, 0xF4, 0xB8, 0xBF, 0xD2,
-    0xFB, 0xE5, 0x0B, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x07, 0xC0,
-    0x3E, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3E, 0x56,
-    0xBF, 0xC0, 0x3D, 0x00, 0x0B, 0xE0, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00,
-    0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x1F, 0xC0, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3E, 0x56, 0xF4, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x3D, 0x00,
-    0x3E, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x07, 0xE0, 0x3D, 0x00,
-    0x03, 0xF0, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xBD, 0x50, 0x00, 0x57, 0xC0, 0x3D, 0x2F,
-    0x0F, 0x80, 0xBF, 0xE0, 0x03, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x41, 0xBD, 0xB8, 0xBF,
-    0xDB, 0xEF, 0x94, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xDB, 0x90, 0x06, 0xFC, 0xBF,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xA0, 0x1F, 0xFF, 0xFC, 0x3F, 0x41, 0xBC, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x64, 0x00, 0xBD, 0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x00,
-    0x50, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0x4F, 0xC0,
-    0x03, 0xD0, 0x2E, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xDB, 0x90, 0x06, 0xFC, 0xBF, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF,
-    0x80, 0x0B, 0xC7, 0xE0, 0x1F, 0x00, 0xF4, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0,
-    0x1F, 0xFF, 0xFC, 0x3F, 0x41, 0xBC, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x3E, 0x64, 0x00, 0xBD, 0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0B, 0xDB, 0x90, 0x06, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x2D, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1A,
-    0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x1F, 0xFF, 0xFC, 0x3F, 0x41, 0xBC, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x64, 0x00, 0xBD,
-    0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x07, 0xC0, 0x00, 0x07, 0xC0, 0x02, 0xAF, 0x40, 0x03, 0xFD, 0x00, 0x01, 0x00, 0x05, 0x00, 0x3D,
-    0x02, 0xF0, 0x01, 0xF4, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0B, 0xDB, 0x90, 0x06, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00,
-    0x00, 0x14, 0x00, 0x14, 0x1F, 0x00, 0xF4, 0x0B, 0xC3, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x1F, 0xFF, 0xFC, 0x3F, 0x41, 0xBC, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x64, 0x00, 0xBD,
-    0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x00, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x55, 0x5B, 0xE5, 0x55, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x1A, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x03, 0xD0,
-    0x00, 0x3D, 0x00, 0x1F, 0xEA, 0x9B, 0xFF, 0xFF, 0x1B, 0xE5, 0x50, 0x7D, 0x00, 0x07, 0xD0, 0x00,
-    0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D,
-    0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0xF0, 0x0B, 0xFF, 0x00, 0x2D, 0x00, 0x03, 0xC0,
-    0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x1A, 0xFC, 0x02, 0xFE, 0x00, 0x01, 0x40, 0x01,
-    0x40, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x55, 0x5B, 0xE5, 0x55, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x01, 0xD0, 0x0B, 0x00, 0x3D,
-    0x00, 0x50, 0x03, 0xD0, 0x00, 0x01, 0xFE, 0xA9, 0x00, 0xBF, 0xFF, 0xF0, 0x01, 0xBE, 0x55, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x10,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x6A, 0xAB, 0xEA, 0xA9, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x06, 0xAB, 0xFA, 0x90, 0x0B, 0xFF, 0xFF, 0xE0, 0x06, 0xAB, 0xEA,
-    0x90, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x1F,
-    0xEA, 0x9B, 0xFF, 0xFF, 0x1B, 0xE5, 0x50, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x7F, 0xFF,
-    0xE3, 0xFF, 0xFD, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x00,
-    0x3F, 0x00, 0x02, 0xFF, 0xF0, 0x0B, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x2F,
-    0xF4, 0x3C, 0x00, 0x0F, 0xBF, 0xFE, 0x00, 0x0B, 0x01, 0xFF, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F,
-    0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x02, 0xF0, 0xBE, 0x00, 0x00, 0xFC,
-    0x0F, 0xE4, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x50, 0x01, 0x00, 0x3F, 0xD0, 0x70, 0x0F, 0xBF, 0xFF, 0x00, 0xD0, 0x7F, 0xC0, 0x04,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E,
-    0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9,
-    0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00,
-    0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00,
-    0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x2F, 0x0B, 0xE0, 0x00, 0x0F, 0xC0,
-    0xFE, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE,
-    0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x01, 0x80, 0x00,
-    0x2C, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E,
-    0x7D, 0x00, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x02, 0xF0, 0xBE, 0x00, 0x00,
-    0xFC, 0x0F, 0xE4, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x06, 0x00, 0x09, 0x00, 0x74, 0x02, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x7E, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x01, 0xC0, 0xF0, 0x00,
-    0x00, 0xB0, 0x3C, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00,
-    0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7,
-    0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x2F, 0x0B, 0xE0, 0x00,
-    0x0F, 0xC0, 0xFE, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xAE, 0x00, 0x00, 0xE0, 0xB0, 0x00, 0x0D, 0x07,
-    0x00, 0x00, 0xF0, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE,
-    0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x41, 0x50, 0x00,
-    0x07, 0xD1, 0xF8, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x02, 0xE0, 0x7C, 0x00, 0x00, 0xE0, 0x3C, 0x00,
-    0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E,
-    0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00,
-    0xBC, 0x2F, 0x80, 0x00, 0x3F, 0x03, 0xF9, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x54, 0x05, 0x00, 0x0F, 0x83, 0xF0, 0x02, 0xF0,
-    0xBC, 0x00, 0x7C, 0x0F, 0x40, 0x0F, 0x03, 0xD0, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x29, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0xFE, 0x3F, 0x40, 0x3F,
-    0xE2, 0xFF, 0xFF, 0xBE, 0x07, 0xFF, 0xD2, 0xE0, 0x01, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x9F,
-    0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F,
-    0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3D, 0x3F,
-    0x00, 0x00, 0x2F, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0xFE, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x05, 0x40, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xE3,
-    0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14, 0x07, 0x80, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3E, 0x50, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xF4,
-    0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x0B, 0xC0, 0x00,
-    0xF7, 0xC0, 0x00, 0xF8, 0x0F, 0x40, 0x07, 0xCF, 0x40, 0x07, 0xD0, 0x3E, 0x00, 0x2E, 0x2E, 0x00,
-    0x2F, 0x00, 0xBC, 0x00, 0xF4, 0x7C, 0x00, 0xFC, 0x01, 0xF0, 0x07, 0xC0, 0xF4, 0x03, 0xE0, 0x03,
-    0xD0, 0x2F, 0x03, 0xE0, 0x1F, 0x40, 0x0F, 0x80, 0xF8, 0x0B, 0xC0, 0xBC, 0x00, 0x2F, 0x03, 0xD0,
-    0x1F, 0x03, 0xE0, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0xF4, 0xF8, 0x00, 0xBC, 0x7C,
-    0x00, 0x03, 0xE3, 0xD0, 0x01, 0xF2, 0xF0, 0x00, 0x0B, 0xDF, 0x00, 0x03, 0xDF, 0x80, 0x00, 0x1F,
-    0xBC, 0x00, 0x0F, 0xBD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x02, 0xA0, 0x00, 0x29, 0x7D, 0x00,
-    0x1F, 0xC0, 0x01, 0xF4, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xC3, 0xF0, 0x03, 0xEF, 0x00, 0x3E, 0x0B,
-    0xC0, 0x0F, 0x3C, 0x00, 0xF4, 0x1F, 0x40, 0xBC, 0xF4, 0x07, 0xC0, 0x3E, 0x03, 0xE2, 0xF0, 0x2F,
-    0x00, 0xBC, 0x0F, 0x07, 0xC0, 0xF8, 0x01, 0xF0, 0x7C, 0x0F, 0x43, 0xD0, 0x03, 0xD3, 0xE0, 0x2E,
-    0x1F, 0x00, 0x0F, 0x8F, 0x40, 0x7C, 0xBC, 0x00, 0x2F, 0x7C, 0x00, 0xF3, 0xE0, 0x00, 0x7E, 0xE0,
-    0x03, 0xEF, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x01, 0xF4, 0xF8, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x2F, 0x00,
-    0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0xBC, 0x02, 0xF0,
-    0x00, 0x0F, 0x80, 0xF8, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x03, 0xD0, 0x2F, 0x00, 0x04,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x29, 0xBC, 0x00, 0x01, 0xF4, 0xF8, 0x00,
-    0x0B, 0xC2, 0xF0, 0x00, 0x3E, 0x07, 0xD0, 0x01, 0xF4, 0x0F, 0x80, 0x0B, 0xC0, 0x2F, 0x00, 0x3E,
-    0x00, 0x3D, 0x01, 0xF0, 0x00, 0xBC, 0x0F, 0xC0, 0x01, 0xF0, 0x3D, 0x00, 0x03, 0xE1, 0xF0, 0x00,
-    0x0B, 0xCF, 0x80, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x2F, 0x03, 0xC0, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x80, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF1, 0xF8, 0x00, 0x00, 0xFC, 0x2F,
-    0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0F, 0x80,
-    0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0xFD, 0xF4,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xF5, 0xAA, 0xAA, 0xAF, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF9, 0x55,
-    0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x50, 0x00, 0x07, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xA8, 0x7F, 0xFF, 0xFD, 0x15, 0x55, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFD, 0x6A, 0xAA, 0xAB, 0xF0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x7F, 0xFF, 0xFD, 0x15, 0x55, 0xFC, 0x00,
-    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x01, 0x00, 0x01, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x0F, 0x8B,
-    0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF5, 0xAA, 0xAA, 0xAF, 0xC0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x14,
-    0x00, 0x14, 0x2E, 0x00, 0xF4, 0x0B, 0xC7, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x7F, 0xFF, 0xFD, 0x15, 0x55, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x01,
-    0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x14, 0x02, 0xFF, 0xD2, 0xFF, 0xF0, 0xFC, 0x00, 0x7D, 0x00, 0x1F,
-    0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC,
-    0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x15, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF4, 0x00,
-    0xF0, 0x00, 0x40, 0x01, 0x50, 0x0F, 0xC0, 0xFC, 0x07, 0xC0, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x50,
-    0x00, 0x3F, 0xC0, 0x0B, 0xFE, 0x01, 0xF0, 0xF8, 0x7C, 0x03, 0xE5, 0x00, 0x05, 0x01, 0x40, 0x04,
-    0x0F, 0xF4, 0x1C, 0x3E, 0xFF, 0xFC, 0x34, 0x1F, 0xF0, 0x10, 0x00, 0x40, 0x3F, 0xFF, 0xD7, 0xFF,
-    0xFD, 0x15, 0x55, 0x40, 0x2A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x60,
-    0x00, 0x97, 0x40, 0x2D, 0x3F, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x50, 0x00, 0x14, 0x7D, 0x7D, 0x28,
-    0x04, 0x01, 0x03, 0xD0, 0x7C, 0x3E, 0x0B, 0xC1, 0x80, 0x24, 0xFE, 0x0A, 0xFC, 0x02, 0xD0, 0x3D,
-    0x2F, 0x83, 0xC0, 0x28, 0x00, 0x0B, 0xE0, 0x2E, 0xBC, 0x38, 0x2C, 0x34, 0x1C, 0x3C, 0x3C, 0x1F,
-    0xF4, 0x01, 0x40, 0x01, 0x40, 0x54, 0x2F, 0x47, 0xD0, 0xF8, 0x3E, 0x0B, 0x82, 0xE0, 0x78, 0x0F,
-    0x00, 0x40, 0x10, 0x00, 0x50, 0x00, 0x57, 0xC0, 0x3D, 0x2F, 0x0F, 0x80, 0xBF, 0xE0, 0x03, 0xFC,
-    0x00, 0x05, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x28, 0x00, 0x00, 0xBC, 0x3E, 0xBC, 0x3E, 0xBC,
-    0x3E, 0xBC, 0x3E, 0x68, 0x29, 0x15, 0x05, 0x40, 0x2F, 0x0B, 0xD0, 0x0F, 0x83, 0xF0, 0x03, 0xD0,
-    0xF4, 0x00, 0xF0, 0x3C, 0x00, 0x10, 0x04, 0x00, 0xA0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x06, 0x0A,
-    0x09, 0x74, 0x02, 0xD3, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x05, 0x00, 0x01, 0xA4, 0x01, 0xFF, 0xF4,
-    0x3E, 0xAB, 0xC7, 0x40, 0x1D, 0x10, 0x00, 0x40, 0x03, 0xC0, 0x7C, 0x0F, 0x80, 0xF4, 0x2F, 0x03,
-    0xF0, 0x3F, 0x01, 0x40, 0x0B, 0xC0, 0xFC, 0x0F, 0x81, 0xF0, 0x2F, 0x03, 0xD0, 0x3C, 0x01, 0x00,
-    0x3E, 0x03, 0xF0, 0x2F, 0x01, 0xF4, 0x0F, 0x40, 0xB8, 0x03, 0xC0, 0x14, 0x0B, 0xC0, 0xFC, 0x0F,
-    0x81, 0xF4, 0x2F, 0x02, 0xE0, 0x3C, 0x01, 0x40, 0x54, 0x0B, 0xE0, 0x2F, 0x00, 0xBC, 0x02, 0xE0,
-    0x05, 0x01, 0x50, 0xBE, 0x0F, 0x83, 0xE0, 0xB8, 0x05, 0x00, 0x00, 0x00, 0x1E, 0x16, 0xEB, 0xFE,
-    0x56, 0xE0, 0x1E, 0x00, 0x40, 0x00, 0x0B, 0x40, 0xB9, 0x4B, 0xFE, 0xB9, 0x5B, 0x40, 0x10, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x6A, 0xAF, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
-    0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x01, 0xF4, 0x2F, 0xC3, 0xF8, 0x0A, 0x00, 0x00, 0x05, 0x3E, 0x74,
-    0xB0, 0x74, 0x3E, 0x05, 0x02, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x2B, 0xE8, 0x3F, 0xFC, 0x00, 0x00,
-    0x2A, 0xA8, 0x3F, 0xFC, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x03, 0xC0, 0x3F, 0xFC, 0x2B, 0xE8, 0x03, 0xC0, 0x02, 0x80, 0x2A, 0xA8, 0x7F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x17, 0xF3, 0xFD, 0x3F, 0x40, 0x00, 0x0F,
-    0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xFD, 0x47, 0xFC, 0x1F, 0xC0, 0x00, 0x3D, 0x3F, 0x3D,
-    0x00, 0x04, 0x01, 0x03, 0xD0, 0x7C, 0x3E, 0x0B, 0xC1, 0x80, 0x24, 0x0B, 0xE0, 0x2E, 0xBC, 0x38,
-    0x2C, 0x34, 0x1C, 0x3C, 0x3C, 0x1F, 0xF4, 0x01, 0x40, 0x00, 0x3E, 0x3D, 0x7C, 0xB0, 0x50, 0x0F,
-    0x01, 0xE0, 0x1F, 0xD0, 0x1F, 0x01, 0xFA, 0xBE, 0xFF, 0x40, 0x01, 0x00, 0xF0, 0x2D, 0x03, 0xC0,
-    0x78, 0x07, 0xD4, 0x3F, 0xD0, 0x54, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x28, 0x2A, 0xAA, 0xA8, 0x3F,
-    0xFF, 0xFC, 0x3C, 0x00, 0x3C, 0x38, 0x00, 0x2C, 0x38, 0x00, 0x2C, 0x14, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x70, 0x3C, 0x0D, 0x39, 0xBE, 0x7C, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x57,
-    0xC0, 0x3E, 0x2F, 0x0F, 0x80, 0xBF, 0xE0, 0x03, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x50, 0x00, 0x3F,
-    0xC0, 0x0B, 0xFE, 0x02, 0xF1, 0xF8, 0x7C, 0x03, 0xD5, 0x00, 0x05, 0x60, 0x00, 0x97, 0x40, 0x2D,
-    0x3F, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x50, 0x00, 0x01, 0xA4, 0x01, 0xFF, 0xF4, 0x3E, 0xAB, 0xC7,
-    0x40, 0x1D, 0x10, 0x00, 0x40, 0x01, 0x40, 0x04, 0x1F, 0xF4, 0x2C, 0x3E, 0xFF, 0xFC, 0x34, 0x1F,
-    0xF0, 0x10, 0x00, 0x40, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD, 0x15, 0x55, 0x40, 0x15, 0x55, 0x55, 0x4B,
-    0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x40,
-    0x01, 0x40, 0x04, 0x0F, 0xF8, 0x1D, 0x2E, 0xBF, 0xFC, 0x38, 0x0B, 0xF4, 0x10, 0x00, 0x40, 0x2A,
-    0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x15, 0x55, 0x55, 0x55, 0x55, 0x4B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x7F, 0x80, 0x2F, 0xD0, 0x2F, 0xD0, 0x03, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00,
-    0x02, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00,
-    0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x64, 0x00, 0x00, 0x50, 0xBC, 0x1D, 0x0E, 0x1D, 0xBC, 0x50, 0x24,
-    0x00, 0x18, 0x38, 0x00, 0x2C, 0x38, 0x00, 0x2C, 0x3D, 0x55, 0x7C, 0x3F, 0xFF, 0xFC, 0x15, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xB5, 0x55, 0x5E, 0xB0, 0x00, 0x0E, 0xB0, 0x00, 0x0E,
-    0xBF, 0xFF, 0xFE, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x39, 0x7E, 0x6C, 0x70,
-    0x3C, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x4B, 0x5E, 0x3F, 0xC2, 0xF4, 0x7F, 0xDB, 0x0E, 0x00, 0x00,
-    0x00, 0x2F, 0xB8, 0xF4, 0x7C, 0x2D, 0x0F, 0x6E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x15,
-    0x55, 0x55, 0x40, 0x14, 0x01, 0xFC, 0x01, 0xF4, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x40, 0x00, 0x50,
-    0x0F, 0xD0, 0x7D, 0x03, 0xE0, 0x3D, 0x00, 0x40, 0x00, 0x01, 0x40, 0x04, 0x1F, 0xF4, 0x2C, 0x3E,
-    0xFF, 0xFC, 0x34, 0x1F, 0xF0, 0x10, 0x00, 0x40, 0x2A, 0x0F, 0xE0, 0x7C, 0x1E, 0x0F, 0x00, 0x00,
-    0x00, 0x2A, 0x00, 0x01, 0xF8, 0x47, 0xCB, 0xCF, 0x9F, 0x7E, 0x3E, 0x14, 0xF0, 0x20, 0x01, 0x00,
-    0x00, 0x28, 0x03, 0xD0, 0x3D, 0x03, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD,
-    0x7E, 0xAA, 0xAB, 0xD7, 0x80, 0x00, 0x2D, 0x78, 0x00, 0x02, 0xD6, 0x40, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43,
-    0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x40, 0x00, 0x00, 0xBC, 0x3E, 0xBC, 0x3E, 0xBC, 0x3E, 0xBC,
-    0x3E, 0x68, 0x29, 0x15, 0x4B, 0xFE, 0x6A, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x01,
-    0x4F, 0x04, 0x1F, 0xFD, 0x2C, 0x3E, 0xFF, 0xFC, 0x34, 0xBF, 0xF0, 0x10, 0xE0, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3C, 0x00, 0x06, 0x90, 0x0C, 0x2F, 0xFD, 0x2C,
-    0x3D, 0x7F, 0xF8, 0x74, 0x07, 0xE0, 0x00, 0x28, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0x7F, 0xFF, 0xEF, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xF8,
-    0x0F, 0x7F, 0xFA, 0xEF, 0x07, 0xFC, 0x40, 0x01, 0x00, 0x00, 0x41, 0x00, 0x07, 0x82, 0xD0, 0x2F,
-    0xFF, 0xF8, 0x0F, 0xEB, 0xF0, 0x02, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0x82,
-    0xF8, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xD7, 0xFC, 0x03, 0xFC, 0x03,
-    0xFD, 0x70, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x60, 0x00, 0xCA, 0x30,
-    0x00, 0x90, 0x00, 0x84, 0x01, 0x20, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x05, 0x00, 0x60, 0x60, 0x00, 0x00, 0xA0, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x70, 0xD0, 0x00,
-    0x00, 0x30, 0xD7, 0x04, 0x00, 0x00, 0x01, 0x0D, 0x70, 0x60, 0x00, 0x00, 0x50, 0xD0, 0x06, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC4, 0x01, 0x30, 0x00, 0x20, 0x01,
-    0xCA, 0x34, 0x00, 0x87, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xA8,
-    0x02, 0xA8, 0x02, 0xAD, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xD0, 0x00, 0x06, 0x40, 0x3F, 0x40, 0xBD,
-    0x1F, 0xD7, 0xE0, 0x50, 0x00, 0x0B, 0x3E, 0x74, 0x74, 0x3D, 0x1F, 0x00, 0x01, 0x54, 0x00, 0xFF,
-    0xF4, 0x3F, 0xAB, 0xC7, 0x40, 0x1D, 0x10, 0xF0, 0x40, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x08, 0x7F, 0xD2, 0xF8, 0x3F, 0xC7, 0x9D, 0x00, 0x40, 0x00, 0x90, 0xBD, 0x7E, 0x07,
-    0xE0, 0x1F, 0xC0, 0x19, 0x60, 0x07, 0xE0, 0x0B, 0xD0, 0xBD, 0x7F, 0x46, 0x00, 0x60, 0x00, 0x50,
-    0x7E, 0x02, 0xF0, 0x0B, 0xD3, 0xF4, 0x0B, 0xD7, 0x7C, 0x3F, 0x4B, 0x2C, 0x60, 0x0E, 0x0E, 0x74,
-    0x3D, 0x0F, 0x0F, 0x1E, 0x78, 0x00, 0x04, 0x3E, 0x3F, 0x18, 0x03, 0xC0, 0x17, 0xD4, 0x3F, 0xFC,
-    0x0B, 0xE0, 0x0F, 0xF0, 0x09, 0x60, 0x00, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x79, 0xBE, 0x6D, 0xB0,
-    0x3C, 0x0E, 0xB0, 0x3C, 0x0E, 0x3D, 0xBE, 0x7C, 0x1F, 0xD7, 0xF4, 0x38, 0x03, 0x40, 0x7F, 0xE6,
-    0xAD, 0x01, 0xC0, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xFF, 0xA5, 0x5A, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xFF, 0xA5, 0x5A, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x04, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x3C, 0x2F, 0xAA, 0xBF, 0xFF, 0xEB, 0xF4,
-    0x38, 0x00, 0x01, 0x6F, 0xFF, 0xD0, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x6A, 0xA9,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xA5, 0x5A, 0xFF, 0x40, 0x0B, 0xE0,
-    0x00, 0x00, 0x0B, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x42, 0x5E, 0x00, 0x71, 0xAF, 0xA0, 0x3A, 0x0B, 0x3F, 0x70, 0x00, 0x05,
-    0x40, 0xE6, 0x86, 0x03, 0x2F, 0xFD, 0xA0, 0x01, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x22, 0x17, 0x77,
-    0x77, 0x70, 0x05, 0x40, 0xE6, 0x89, 0x03, 0x74, 0x0A, 0xD0, 0x26, 0x80, 0xC2, 0xFD, 0x00, 0x00,
-    0x00, 0x12, 0x40, 0xC9, 0x03, 0x24, 0x0C, 0x90, 0x32, 0x81, 0xC3, 0xFA, 0x00, 0x00, 0x01, 0x51,
-    0xE6, 0x34, 0x03, 0x00, 0x30, 0x03, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x30, 0x00, 0xC0, 0x53, 0x1E,
-    0x7C, 0xD0, 0x33, 0x00, 0xCD, 0x03, 0x28, 0x1C, 0x2F, 0xA0, 0x00, 0x00, 0x90, 0x02, 0x80, 0x0A,
-    0x14, 0x2E, 0x6C, 0xA0, 0x36, 0x80, 0xDA, 0x03, 0x68, 0x0D, 0x90, 0x34, 0x05, 0x41, 0x42, 0xE7,
-    0xA6, 0xCA, 0x07, 0x03, 0x64, 0x0C, 0x0D, 0x90, 0x30, 0x36, 0x40, 0xC0, 0xD9, 0x03, 0x02, 0x40,
-    0x01, 0x5F, 0x97, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x00, 0x10, 0x0E, 0x47, 0x90, 0xD0, 0x34, 0x0D,
-    0x03, 0x40, 0x7D, 0x00, 0x00, 0x10, 0x00, 0x28, 0x0D, 0x1C, 0x1C, 0x0D, 0x34, 0x07, 0x30, 0x03,
-    0xA0, 0x02, 0xC0, 0x00, 0x10, 0xC2, 0x81, 0xDC, 0x02, 0xC0, 0x0E, 0x80, 0xD3, 0x4A, 0x03, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x4F, 0x95, 0x55,
-    0x43, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0x40, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x95, 0x55, 0x43, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x40, 0x10, 0x00, 0xF8,
-    0x3E, 0x00, 0x3F, 0x0F, 0x80, 0x07, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x3E, 0x55, 0x55, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0x0F, 0x95, 0x55, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x7F, 0x55,
-    0x54, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x1A, 0xA4, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFA, 0xAF, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF8, 0x00,
-    0x2F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x2F,
-    0x00, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0x95,
-    0x55, 0x43, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xF4, 0x07, 0xFD, 0x41, 0xBC, 0x03, 0xF4, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
-    0x55, 0x55, 0x50, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00,
-    0x6C, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B,
-    0xDB, 0x90, 0x06, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x04, 0x00, 0x3D, 0x3D, 0x3E, 0x7D, 0x2D, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01,
-    0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07,
-    0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F,
-    0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x02, 0xF0, 0x01, 0xFC,
-    0x7F, 0xFD, 0x1F, 0xFD, 0x01, 0xA4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x55, 0x5B, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x07, 0xFA, 0xA9, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7C, 0x00,
-    0x07, 0xEA, 0xAF, 0xF8, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0xFD, 0x00, 0xBC, 0x00, 0x07, 0xC0,
-    0x00, 0x3E, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x2F,
-    0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x01, 0xF0,
-    0x00, 0x07, 0xC0, 0x00, 0xBD, 0x47, 0xF0, 0x00, 0x07, 0xD5, 0x5B, 0xF8, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x55, 0x55, 0x7F, 0x55, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0x40, 0x00, 0x0F, 0x80,
-    0x03, 0xF8, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xD3,
-    0xD0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x3D, 0x00, 0x00,
-    0x3E, 0x00, 0x02, 0xF4, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x03, 0xF5, 0x56,
-    0xFD, 0x0F, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x3D, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x7F, 0x55, 0x54, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x1A, 0xA9, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFA, 0xAF, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0xFC,
-    0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00,
-    0x2F, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x2F,
-    0x00, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0x03, 0xF0,
-    0x3D, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x1F, 0x40, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0xFC, 0x00,
-    0x3D, 0x01, 0xF4, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x3E, 0x57, 0xE0, 0x00, 0x3D, 0x02, 0xF4, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x7E, 0x00,
-    0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x07, 0xE0, 0x3D, 0x00, 0x02, 0xF4,
-    0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x1F,
-    0xC3, 0xD0, 0x00, 0x03, 0xFC, 0x3D, 0x00, 0x00, 0xBF, 0xC3, 0xD0, 0x00, 0x1F, 0x7C, 0x3D, 0x00,
-    0x03, 0xE7, 0xC3, 0xD0, 0x00, 0xBC, 0x7C, 0x3D, 0x00, 0x1F, 0x47, 0xC3, 0xD0, 0x03, 0xE0, 0x7C,
-    0x3D, 0x00, 0xBC, 0x07, 0xC3, 0xD0, 0x0F, 0x40, 0x7C, 0x3D, 0x03, 0xE0, 0x07, 0xC3, 0xD0, 0x7C,
-    0x00, 0x7C, 0x3D, 0x0F, 0x40, 0x07, 0xC3, 0xD3, 0xF0, 0x00, 0x7C, 0x3D, 0x7C, 0x00, 0x07, 0xC3,
-    0xDF, 0x80, 0x00, 0x7C, 0x3F, 0xF0, 0x00, 0x07, 0xC3, 0xFC, 0x00, 0x00, 0x7C, 0x3F, 0x80, 0x00,
-    0x07, 0xC3, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x14, 0x00, 0x50, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00,
-    0x1F, 0x9B, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0xF8,
-    0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xBC,
-    0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x2F,
-    0x07, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x0B, 0xDF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x00,
-    0xF4, 0xF4, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x03, 0xD3, 0xD0, 0x00,
-    0x00, 0xF4, 0xF4, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x03, 0xD3, 0xD0,
-    0x00, 0x00, 0xF4, 0xF4, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x03, 0xD3,
-    0xD0, 0x00, 0x00, 0xF4, 0xF4, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x03,
-    0xD3, 0xE5, 0x55, 0x55, 0xF4, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x68, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00,
-    0x01, 0xF0, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x02, 0xF0,
-    0x07, 0xC0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00,
-    0x00, 0xBC, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x43, 0xE5,
-    0x55, 0x54, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0xAA, 0x50, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFA, 0xAF, 0xFC,
-    0x0F, 0x40, 0x02, 0xFC, 0x3D, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x1F, 0x4F,
-    0x40, 0x00, 0x7D, 0x3D, 0x00, 0x02, 0xF0, 0xF4, 0x00, 0x1F, 0xC3, 0xE5, 0x56, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3E, 0x55,
-    0xAF, 0xF0, 0x3D, 0x00, 0x03, 0xF4, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00,
-    0x00, 0xF8, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x0B, 0xE0, 0x3F, 0xFF, 0xFE, 0x40, 0x3F, 0xFF,
-    0xFE, 0x40, 0x3E, 0x00, 0x5B, 0xF0, 0x3D, 0x00, 0x01, 0xFC, 0x3D, 0x00, 0x00, 0xBC, 0x3D, 0x00,
-    0x00, 0x7D, 0x3D, 0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x01, 0xFC, 0x3E, 0x00,
-    0x5B, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xC3, 0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xF9, 0x55, 0x6F, 0x40, 0x00,
-    0x7C, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0x02,
-    0xF0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0x0B,
-    0x80, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x3D,
-    0x00, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x03, 0xE0,
-    0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x01, 0xBE, 0x55,
-    0x55, 0x6F, 0x56, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
-    0x00, 0x02, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x00,
-    0x00, 0x0B, 0xD9, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x3F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD3, 0xE5,
-    0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xF9, 0x55, 0x50, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x40, 0x3E, 0x00, 0x00,
-    0xF4, 0x00, 0x07, 0xD0, 0xBD, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x02,
-    0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x0F, 0x40, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x3D,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xF5, 0x7E, 0x5F, 0xC0, 0x00, 0x00, 0x2F,
-    0x40, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x0F, 0x40,
-    0x3F, 0x00, 0x00, 0x7E, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0xBD, 0x00,
-    0x2F, 0x40, 0x03, 0xD0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF8, 0x0F, 0xC0, 0x00,
-    0x3D, 0x00, 0x02, 0xF4, 0xBD, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF0, 0x0E, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x55, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x7E, 0x39, 0x00, 0x1B, 0xF0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x01, 0xFC, 0x3D, 0x00, 0x00, 0x3F, 0xC3,
-    0xD0, 0x00, 0x0B, 0xFC, 0x3D, 0x00, 0x01, 0xF7, 0xC3, 0xD0, 0x00, 0x3E, 0x7C, 0x3D, 0x00, 0x0B,
-    0xC7, 0xC3, 0xD0, 0x01, 0xF4, 0x7C, 0x3D, 0x00, 0x3E, 0x07, 0xC3, 0xD0, 0x0B, 0xC0, 0x7C, 0x3D,
-    0x00, 0xF4, 0x07, 0xC3, 0xD0, 0x3E, 0x00, 0x7C, 0x3D, 0x07, 0xC0, 0x07, 0xC3, 0xD0, 0xF4, 0x00,
-    0x7C, 0x3D, 0x3F, 0x00, 0x07, 0xC3, 0xD7, 0xC0, 0x00, 0x7C, 0x3D, 0xF8, 0x00, 0x07, 0xC3, 0xFF,
-    0x00, 0x00, 0x7C, 0x3F, 0xC0, 0x00, 0x07, 0xC3, 0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x14, 0x00, 0x40, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B,
-    0xC3, 0xD0, 0x00, 0x01, 0xFC, 0x3D, 0x00, 0x00, 0x3F, 0xC3, 0xD0, 0x00, 0x0B, 0xFC, 0x3D, 0x00,
-    0x01, 0xF7, 0xC3, 0xD0, 0x00, 0x3E, 0x7C, 0x3D, 0x00, 0x0B, 0xC7, 0xC3, 0xD0, 0x01, 0xF4, 0x7C,
-    0x3D, 0x00, 0x3E, 0x07, 0xC3, 0xD0, 0x0B, 0xC0, 0x7C, 0x3D, 0x00, 0xF4, 0x07, 0xC3, 0xD0, 0x3E,
-    0x00, 0x7C, 0x3D, 0x07, 0xC0, 0x07, 0xC3, 0xD0, 0xF4, 0x00, 0x7C, 0x3D, 0x3F, 0x00, 0x07, 0xC3,
-    0xD7, 0xC0, 0x00, 0x7C, 0x3D, 0xF8, 0x00, 0x07, 0xC3, 0xFF, 0x00, 0x00, 0x7C, 0x3F, 0xC0, 0x00,
-    0x07, 0xC3, 0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x00, 0xBC, 0x3D,
-    0x00, 0x01, 0xF4, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x1F, 0x40, 0x3D,
-    0x00, 0x3E, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3E, 0x57, 0xE0, 0x00, 0x3D, 0x02, 0xF4, 0x00, 0x3D,
-    0x00, 0xFC, 0x00, 0x3D, 0x00, 0x7E, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F, 0xC0, 0x3D,
-    0x00, 0x07, 0xE0, 0x3D, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x7E, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x3E, 0x55, 0x5B, 0xE0, 0x03, 0xD0, 0x00,
-    0x3E, 0x00, 0x3D, 0x00, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x07,
-    0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x03,
-    0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xB8,
-    0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x3E,
-    0x47, 0xF0, 0x00, 0x03, 0xEF, 0xFD, 0x00, 0x00, 0x3E, 0xFF, 0x80, 0x00, 0x03, 0xE1, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x3F, 0xE0, 0x00,
-    0x00, 0x3F, 0xE3, 0xEF, 0x00, 0x00, 0x07, 0xFE, 0x3D, 0xF4, 0x00, 0x00, 0xF7, 0xE3, 0xCF, 0x80,
-    0x00, 0x1F, 0x3E, 0x3C, 0x7C, 0x00, 0x02, 0xE3, 0xE3, 0xC3, 0xD0, 0x00, 0x3D, 0x3E, 0x3D, 0x2F,
-    0x00, 0x07, 0xC3, 0xE3, 0xD1, 0xF0, 0x00, 0xF8, 0x3E, 0x3D, 0x0F, 0x80, 0x0F, 0x03, 0xE3, 0xD0,
-    0xBC, 0x02, 0xF0, 0x3E, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xE3, 0xD0, 0x3E, 0x07, 0xC0, 0x3E, 0x3D,
-    0x01, 0xF0, 0xB8, 0x03, 0xE3, 0xD0, 0x0F, 0x4F, 0x40, 0x3E, 0x3D, 0x00, 0xBD, 0xF0, 0x03, 0xE3,
-    0xD0, 0x07, 0xFE, 0x00, 0x3E, 0x3D, 0x00, 0x3F, 0xC0, 0x03, 0xE3, 0xD0, 0x02, 0xF8, 0x00, 0x3E,
-    0x3D, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x03, 0xF3, 0xD0,
-    0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3,
-    0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0xFF, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0xFC, 0xF9, 0x55, 0x55, 0x7F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00,
-    0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40,
-    0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x02,
-    0xFE, 0x40, 0xBF, 0xC0, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x1F, 0x40,
-    0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00,
-    0x00, 0x7D, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x00,
-    0x7D, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x1F, 0x40, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x02,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE5, 0x55, 0x55, 0xF8,
-    0xF4, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00,
-    0xF8, 0xF4, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x03, 0xE3, 0xD0, 0x00,
-    0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x03, 0xE3, 0xD0,
-    0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x03, 0xE3,
-    0xD0, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xFF, 0xA0,
-    0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xE5, 0x6B, 0xFC, 0x0F, 0x40, 0x02, 0xF8, 0x3D, 0x00, 0x03, 0xF0,
-    0xF4, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0xBC, 0x3D, 0x00, 0x03, 0xF0, 0xF4,
-    0x00, 0x2F, 0x43, 0xE5, 0x5B, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x90, 0x00, 0xF4, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xF4, 0x07, 0xFD, 0x41, 0xBC, 0x03, 0xF4, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00,
-    0x6C, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x50, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x5B, 0xE5, 0x55, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x0F, 0xC0,
-    0xF8, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00,
-    0x2F, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x0B, 0xDF, 0x40, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x16, 0xF9, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFB, 0xFF, 0xFF, 0x80, 0x0F, 0xE0, 0x1F, 0x00, 0xBF, 0x02, 0xF4, 0x01, 0xF0, 0x02,
-    0xF4, 0x3F, 0x00, 0x1F, 0x00, 0x0F, 0xC7, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x7C, 0x00, 0x1F, 0x00,
-    0x07, 0xD7, 0xC0, 0x01, 0xF0, 0x00, 0x7D, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xD7, 0xD0, 0x01, 0xF0,
-    0x00, 0xBC, 0x3F, 0x00, 0x1F, 0x00, 0x0F, 0xC2, 0xF8, 0x01, 0xF0, 0x02, 0xF4, 0x0F, 0xE0, 0x1F,
-    0x01, 0xFE, 0x00, 0x3F, 0xFB, 0xFB, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x16,
-    0xF9, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x0B,
-    0xC0, 0x1F, 0x80, 0x07, 0xD0, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x07, 0xD1,
-    0xF4, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00,
-    0x0B, 0xC0, 0xFC, 0x00, 0x07, 0xD0, 0x1F, 0x80, 0x03, 0xE0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x3F,
-    0x01, 0xF4, 0x00, 0x07, 0xD0, 0xFC, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x55, 0x55, 0x5F, 0x94, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0xB8, 0x00, 0x00, 0xBB, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xBC, 0x00,
-    0x00, 0xFD, 0xF4, 0x00, 0x03, 0xF3, 0xF9, 0x01, 0xBF, 0xC7, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xF9,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3D,
-    0x00, 0x00, 0xF4, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0xF4,
-    0x00, 0x07, 0xD3, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD3,
-    0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x0F,
-    0x40, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7D,
-    0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x3D, 0x00, 0x00,
-    0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07,
-    0xD3, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x00,
-    0x0F, 0x40, 0x00, 0x7D, 0x3E, 0x55, 0x55, 0xF9, 0x55, 0x5B, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x3D,
-    0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0,
-    0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0,
-    0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3D,
-    0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3E, 0x55, 0x56, 0xF5, 0x55, 0x5F, 0xD4, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xBF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x57, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFA,
-    0xAB, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x07,
-    0xD0, 0x03, 0xF0, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00,
-    0xFC, 0x00, 0x1F, 0xC0, 0x03, 0xF5, 0x56, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xE4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x00,
-    0x2F, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x00, 0x2F,
-    0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3F, 0xAA, 0x90, 0x00, 0x2F, 0x3F,
-    0xFF, 0xFE, 0x00, 0x2F, 0x3E, 0xAA, 0xFF, 0xC0, 0x2F, 0x3D, 0x00, 0x0B, 0xE0, 0x2F, 0x3D, 0x00,
-    0x03, 0xF0, 0x2F, 0x3D, 0x00, 0x02, 0xF0, 0x2F, 0x3D, 0x00, 0x02, 0xF0, 0x2F, 0x3D, 0x00, 0x02,
-    0xF0, 0x2F, 0x3D, 0x00, 0x03, 0xF0, 0x2F, 0x3D, 0x00, 0x0B, 0xE0, 0x2F, 0x3E, 0x55, 0x7F, 0xC0,
-    0x2F, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0x3F, 0xFF, 0xE4, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0xAA, 0x90, 0x00, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFA, 0xAB, 0xFC, 0x0F, 0x40, 0x02, 0xF8, 0x3D, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x0B, 0xC3,
-    0xD0, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0xBC, 0x3D, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x2F, 0x83, 0xE5,
-    0x57, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xF9, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0x55, 0x55,
-    0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x01, 0x90, 0x01, 0xBF, 0x40, 0x7F,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x3D, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x03,
-    0xD0, 0x01, 0xFE, 0x41, 0xBF, 0xC0, 0x3D, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x03, 0xD0, 0x0B, 0xD0,
-    0x00, 0x03, 0xF0, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x83, 0xD0, 0x1F, 0x40, 0x00, 0x00, 0xFC,
-    0x3D, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC3, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0x07, 0xD3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7D, 0x3E, 0x57, 0xF0, 0x00, 0x00, 0x07,
-    0xD3, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x3D, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC3, 0xD0, 0x1F,
-    0x40, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x83, 0xD0, 0x0B, 0xC0, 0x00, 0x03,
-    0xF0, 0x3D, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xD0, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x3D, 0x00,
-    0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x03, 0xFE, 0x95, 0x7F, 0x07, 0xF0,
-    0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x3F, 0x0F, 0xC0,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x3F, 0x01, 0xFF, 0xFA, 0xBF, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xE5, 0x7F, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0xBD,
-    0x00, 0x3F, 0x00, 0xF8, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x3F, 0x0F, 0xC0,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0xBF, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0xF9, 0x07, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x55, 0xFC, 0x0B, 0xFF, 0xFF,
-    0x1F, 0xFA, 0x5F, 0xCF, 0xC0, 0x02, 0xFB, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x3F, 0xBC, 0x00, 0x1F,
-    0xDF, 0x80, 0x1F, 0xF3, 0xFF, 0xFE, 0x7C, 0x2F, 0xFD, 0x0F, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x02, 0xBF, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0x94, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x01, 0x40, 0x00, 0x3D, 0x2F,
-    0xFE, 0x00, 0x3D, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x0B, 0xF0, 0x7F, 0x00, 0x02, 0xF4, 0x7E, 0x00,
-    0x00, 0xF8, 0x7D, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3D, 0x00,
-    0x00, 0xFC, 0x3E, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x01, 0xF8, 0x1F, 0x40, 0x03, 0xF0, 0x0F, 0xE0,
-    0x0B, 0xD0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x6A, 0xAA,
-    0x90, 0x0B, 0xFF, 0xFF, 0xD0, 0xBD, 0x56, 0xBF, 0x0B, 0xC0, 0x01, 0xF8, 0xBC, 0x00, 0x0F, 0x8B,
-    0xC0, 0x00, 0xF4, 0xBC, 0x01, 0x7F, 0x0B, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFE, 0x0B, 0xC0, 0x02,
-    0xF8, 0xBC, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0xBC, 0xBC, 0x00, 0x0F, 0xCB, 0xC0, 0x06, 0xF8, 0xBF,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xFE, 0x40, 0x6A, 0xAA, 0xA2, 0xFF, 0xFF, 0xCB, 0xEA, 0xAA, 0x2F, 0x00,
-    0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0,
-    0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA8, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xBE, 0xAA, 0xFC, 0x00,
-    0x0B, 0x80, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x07, 0xC0, 0x00, 0xF4, 0x00,
-    0x7C, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01,
-    0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x0B,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0xBC, 0x00, 0x00, 0x03, 0xDB, 0xC0,
-    0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x0F, 0xE0, 0x7F, 0x42, 0xF4, 0x00, 0xFC, 0x3E,
-    0x00, 0x07, 0xD7, 0xD0, 0x00, 0x3E, 0x7D, 0x55, 0x57, 0xEB, 0xFF, 0xFF, 0xFF, 0xBF, 0xAA, 0xAA,
-    0xAB, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFD,
-    0x00, 0x1C, 0x07, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x29, 0x00, 0x0A,
-    0x00, 0x02, 0x82, 0xF0, 0x00, 0xF4, 0x00, 0xFC, 0x0F, 0x80, 0x0F, 0x40, 0x2F, 0x00, 0x7D, 0x00,
-    0xF4, 0x03, 0xD0, 0x02, 0xF0, 0x0F, 0x40, 0xF8, 0x00, 0x0F, 0x80, 0xF4, 0x2F, 0x00, 0x00, 0x3D,
-    0x0F, 0x47, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xD1, 0xF4, 0x7E, 0x00, 0x00, 0xF8, 0x0F, 0x42, 0xF4, 0x00, 0x3F, 0x00, 0xF4, 0x0F, 0xC0, 0x07,
-    0xD0, 0x0F, 0x40, 0x7E, 0x00, 0xFC, 0x00, 0xF4, 0x02, 0xF0, 0x3F, 0x00, 0x0F, 0x40, 0x0F, 0xC7,
-    0xD0, 0x00, 0xF4, 0x00, 0x7E, 0x06, 0xFF, 0x90, 0x0B, 0xFF, 0xFF, 0x41, 0xE4, 0x1B, 0xF0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x1B, 0xD0, 0x0B, 0xFF, 0x80, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC9,
-    0x00, 0x0F, 0xD3, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x68, 0x00, 0x06,
-    0x9B, 0xC0, 0x00, 0xFE, 0xBC, 0x00, 0x3F, 0xEB, 0xC0, 0x07, 0xFE, 0xBC, 0x00, 0xF7, 0xEB, 0xC0,
-    0x2F, 0x3E, 0xBC, 0x03, 0xC3, 0xEB, 0xC0, 0xB8, 0x3E, 0xBC, 0x1F, 0x03, 0xEB, 0xC3, 0xD0, 0x3E,
-    0xBC, 0x7C, 0x03, 0xEB, 0xCF, 0x40, 0x3E, 0xBE, 0xE0, 0x03, 0xEB, 0xFC, 0x00, 0x3E, 0xBF, 0x80,
-    0x03, 0xEB, 0xF0, 0x00, 0x3E, 0x02, 0x80, 0x19, 0x00, 0x3C, 0x03, 0xD0, 0x02, 0xF5, 0xFC, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x06, 0x9B, 0xC0, 0x00,
-    0xFE, 0xBC, 0x00, 0x3F, 0xEB, 0xC0, 0x07, 0xFE, 0xBC, 0x00, 0xF7, 0xEB, 0xC0, 0x2F, 0x3E, 0xBC,
-    0x03, 0xC3, 0xEB, 0xC0, 0xB8, 0x3E, 0xBC, 0x1F, 0x03, 0xEB, 0xC3, 0xD0, 0x3E, 0xBC, 0x7C, 0x03,
-    0xEB, 0xCF, 0x40, 0x3E, 0xBE, 0xE0, 0x03, 0xEB, 0xFC, 0x00, 0x3E, 0xBF, 0x80, 0x03, 0xEB, 0xF0,
-    0x00, 0x3E, 0x68, 0x00, 0x0A, 0x4B, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x7D, 0x0B, 0xC0, 0x0F, 0x80,
-    0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x7D, 0x00, 0xBC, 0x0F, 0x80, 0x0B, 0xFF, 0xF0, 0x00, 0xBF, 0xFF,
-    0x00, 0x0B, 0xC0, 0xFC, 0x00, 0xBC, 0x07, 0xE0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x00, 0xFC, 0x0B,
-    0xC0, 0x07, 0xE0, 0xBC, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0xAA, 0xAA, 0xA4, 0x03, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xAA, 0xAF, 0x80, 0x3C, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0xF8, 0x03, 0xC0, 0x03,
-    0xE0, 0x1F, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0xF8, 0x07, 0xC0, 0x03, 0xE0,
-    0x2F, 0x00, 0x0F, 0x80, 0xB8, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0xF8, 0x2F, 0x00, 0x03, 0xEF, 0xFC,
-    0x00, 0x0F, 0xBF, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x06, 0xAB, 0xF4,
-    0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x1F, 0xFB, 0xFD, 0x00, 0x03, 0xFF, 0xBE, 0xE0, 0x00, 0x7E,
-    0xFB, 0xDF, 0x00, 0x0B, 0x9F, 0xBC, 0xF8, 0x00, 0xF5, 0xFB, 0xC7, 0xC0, 0x2F, 0x1F, 0xBC, 0x3D,
-    0x03, 0xD1, 0xFB, 0xC2, 0xF0, 0x7C, 0x1F, 0xBC, 0x0F, 0x0F, 0x81, 0xFB, 0xC0, 0xF8, 0xF0, 0x1F,
-    0xBC, 0x07, 0xEE, 0x01, 0xFB, 0xC0, 0x3F, 0xD0, 0x1F, 0xBC, 0x02, 0xFC, 0x01, 0xFB, 0xC0, 0x0F,
-    0x40, 0x1F, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x3D,
-    0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x07, 0xDB, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xDB, 0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x03, 0xDB,
-    0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x3D, 0x00, 0x6F, 0xE4, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0xFE, 0x46, 0xFC, 0x0B, 0xD0, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF5, 0xF4, 0x00, 0x03,
-    0xE7, 0xC0, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x03, 0xF7,
-    0xD0, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x7D, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x3F, 0x40, 0x3F,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x01, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x8B, 0xFF, 0xFF,
-    0xFC, 0xBE, 0xAA, 0xAB, 0xCB, 0xC0, 0x00, 0x7C, 0xBC, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7C, 0xBC,
-    0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7C, 0xBC, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7C, 0xBC, 0x00, 0x07,
-    0xCB, 0xC0, 0x00, 0x7C, 0xBC, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7C, 0xBC, 0x00, 0x07, 0xCB, 0xC0,
-    0x00, 0x7C, 0x64, 0x1F, 0xE4, 0x02, 0xF3, 0xFF, 0xFC, 0x0B, 0xFE, 0x47, 0xFC, 0x2F, 0xC0, 0x02,
-    0xF4, 0xBE, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x7D,
-    0xBC, 0x00, 0x01, 0xF6, 0xF0, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0xFC, 0xBF,
-    0x00, 0x07, 0xE2, 0xFF, 0x00, 0x7F, 0x0B, 0xEF, 0xFF, 0xF4, 0x2F, 0x1F, 0xFF, 0x00, 0xBC, 0x01,
-    0x40, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0xBF, 0xFF, 0xC0,
-    0xFF, 0x55, 0xA0, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x40, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0x40,
-    0x00, 0x6A, 0xAA, 0xAA, 0x8B, 0xFF, 0xFF, 0xFC, 0x6A, 0xBF, 0xAA, 0x80, 0x02, 0xF0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xA8, 0x00, 0x00, 0xA6, 0xF0, 0x00, 0x07,
-    0xD3, 0xE0, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0xF8, 0x1F, 0x40, 0x07, 0xD0, 0x3E, 0x00, 0x3F, 0x00,
-    0xBC, 0x00, 0xF8, 0x00, 0xF4, 0x07, 0xC0, 0x02, 0xF0, 0x3F, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x0F,
-    0x8B, 0xC0, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x56, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xF9, 0xBD,
-    0x7F, 0xC0, 0x1F, 0xC0, 0x7C, 0x0B, 0xE0, 0x3F, 0x00, 0x7C, 0x02, 0xF4, 0x3E, 0x00, 0x7C, 0x00,
-    0xF8, 0x7D, 0x00, 0x7C, 0x00, 0xFC, 0xBC, 0x00, 0x7C, 0x00, 0xBC, 0xBC, 0x00, 0x7C, 0x00, 0xBC,
-    0xBC, 0x00, 0x7C, 0x00, 0xBC, 0x7D, 0x00, 0x7C, 0x00, 0xFC, 0x3F, 0x00, 0x7C, 0x01, 0xF8, 0x2F,
-    0x40, 0x7C, 0x03, 0xF0, 0x0F, 0xE0, 0x7C, 0x1F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBD, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x29, 0x00, 0x01, 0xA0, 0xBC, 0x00, 0x1F, 0x80, 0xFC, 0x00,
-    0xFC, 0x01, 0xF8, 0x0B, 0xC0, 0x02, 0xF4, 0x7D, 0x00, 0x03, 0xF3, 0xE0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xCF, 0x80, 0x00,
-    0xBD, 0x1F, 0x40, 0x07, 0xE0, 0x2F, 0x00, 0x3F, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x7E, 0x1F, 0x80,
-    0x00, 0xBD, 0x68, 0x00, 0x02, 0x80, 0x7C, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x07, 0xC0, 0x7C, 0x00,
-    0x07, 0xC0, 0x7C, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x07, 0xC0, 0x7C, 0x00,
-    0x07, 0xC0, 0x7C, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x07, 0xC0, 0x7C, 0x00,
-    0x07, 0xC0, 0x7C, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x07, 0xD0, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x02, 0x97, 0xD0, 0x00, 0x3E, 0x7D, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x3E, 0x7D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x3E, 0x3D, 0x00, 0x03, 0xE3, 0xF0,
-    0x00, 0x3E, 0x1F, 0xE5, 0xAF, 0xE0, 0xBF, 0xFF, 0xFE, 0x00, 0x6A, 0x93, 0xE0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x68, 0x00,
-    0x0A, 0x00, 0x02, 0x9B, 0xC0, 0x01, 0xF4, 0x00, 0x3E, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xEB, 0xC0,
-    0x01, 0xF4, 0x00, 0x3E, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xEB, 0xC0, 0x01, 0xF4, 0x00, 0x3E, 0xBC,
-    0x00, 0x1F, 0x40, 0x03, 0xEB, 0xC0, 0x01, 0xF4, 0x00, 0x3E, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xEB,
-    0xC0, 0x01, 0xF4, 0x00, 0x3E, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xEB, 0xC0, 0x01, 0xF4, 0x00, 0x3E,
-    0xBC, 0x00, 0x1F, 0x40, 0x03, 0xEB, 0xC0, 0x01, 0xF4, 0x00, 0x3E, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x68, 0x00, 0x0A, 0x00, 0x02, 0x90, 0xBC, 0x00, 0x1F, 0x40,
-    0x03, 0xD0, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0xBC, 0x00,
-    0x1F, 0x40, 0x03, 0xD0, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0,
-    0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0xBC, 0x00, 0x1F, 0x40,
-    0x03, 0xD0, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0xBC, 0x00,
-    0x1F, 0x40, 0x03, 0xD0, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0xA8, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x06, 0xAB, 0xD0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x55, 0xBF, 0x40, 0x1F, 0x40, 0x03, 0xE0, 0x07,
-    0xD0, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x1F, 0xC0,
-    0x07, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x80, 0x68, 0x00, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x00,
-    0x3E, 0xBC, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x00, 0x3E, 0xBF, 0xFF, 0x90, 0x03, 0xEB, 0xFF, 0xFF, 0xC0, 0x3E, 0xBC, 0x01, 0xBF, 0x03,
-    0xEB, 0xC0, 0x02, 0xF4, 0x3E, 0xBC, 0x00, 0x0F, 0x43, 0xEB, 0xC0, 0x00, 0xF4, 0x3E, 0xBC, 0x00,
-    0x2F, 0x43, 0xEB, 0xC0, 0x1B, 0xF0, 0x3E, 0xBF, 0xFF, 0xFC, 0x03, 0xEB, 0xFF, 0xF9, 0x00, 0x3E,
-    0x68, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x02, 0xFF, 0xFF, 0xF0, 0xBD, 0x55, 0xBF, 0x2F, 0x00, 0x07,
-    0xDB, 0xC0, 0x00, 0xFA, 0xF0, 0x00, 0x3E, 0xBC, 0x00, 0x1F, 0x6F, 0x00, 0x6F, 0xCB, 0xFF, 0xFF,
-    0xC2, 0xFF, 0xFF, 0x40, 0x1B, 0xF9, 0x00, 0x2F, 0xFF, 0xF4, 0x03, 0x95, 0xBF, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x14, 0x00,
-    0xFE, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x68, 0x00, 0x0B, 0xFD,
-    0x00, 0xBC, 0x00, 0x7F, 0xFF, 0xD0, 0xBC, 0x01, 0xFD, 0x07, 0xF0, 0xBC, 0x03, 0xF0, 0x00, 0xFC,
-    0xBC, 0x07, 0xD0, 0x00, 0x7D, 0xBC, 0x0B, 0xC0, 0x00, 0x3E, 0xBC, 0x0F, 0xC0, 0x00, 0x3F, 0xBF,
-    0xFF, 0x80, 0x00, 0x3F, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0xBC, 0x0F, 0x80, 0x00, 0x3F, 0xBC, 0x0F,
-    0xC0, 0x00, 0x3E, 0xBC, 0x0B, 0xC0, 0x00, 0x7D, 0xBC, 0x03, 0xE0, 0x00, 0xBC, 0xBC, 0x02, 0xF8,
-    0x02, 0xF8, 0xBC, 0x00, 0xBF, 0xFF, 0xE0, 0xBC, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x6A, 0xAA, 0x80, 0xBF, 0xFF, 0xFD, 0x1F, 0xEA, 0xAB, 0xD3, 0xF0, 0x00, 0x3D, 0x3E,
-    0x00, 0x03, 0xD3, 0xE0, 0x00, 0x3D, 0x3F, 0x00, 0x03, 0xD2, 0xFD, 0x00, 0x7D, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFD, 0x00, 0xF8, 0x03, 0xD0, 0x3F, 0x00, 0x3D, 0x0B, 0xD0, 0x03, 0xD1, 0xF8,
-    0x00, 0x3D, 0x3F, 0x00, 0x03, 0xDB, 0xD0, 0x00, 0x3D, 0x00, 0x54, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0xFE, 0x07, 0xF4, 0x2F, 0x40, 0x0F, 0xC3,
-    0xE0, 0x00, 0x7D, 0x7D, 0x00, 0x03, 0xE7, 0xD5, 0x55, 0x7E, 0xBF, 0xFF, 0xFF, 0xFB, 0xFA, 0xAA,
-    0xAA, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F,
-    0xD0, 0x01, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x03, 0xD0, 0x02, 0xF0, 0x7D, 0x00, 0x0E, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x0F, 0xE0, 0x7F, 0x42, 0xF4, 0x00, 0xFC,
-    0x3E, 0x00, 0x07, 0xD7, 0xD0, 0x00, 0x3E, 0x7D, 0x55, 0x57, 0xEB, 0xFF, 0xFF, 0xFF, 0xBF, 0xAA,
-    0xAA, 0xAB, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0xFD, 0x00, 0x1C, 0x07, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xAF, 0xEA, 0xA4, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x5B, 0xD5, 0x50, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x14, 0x00, 0x07, 0xC7,
-    0xFF, 0xD0, 0x07, 0xDF, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x7D, 0x07, 0xE0,
-    0x00, 0x3E, 0x07, 0xD0, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x3E, 0x07, 0xC0,
-    0x00, 0x3E, 0x07, 0xC0, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x3E, 0x07, 0xC0,
-    0x00, 0x3E, 0x07, 0xC0, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x11, 0xFC, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0x50, 0x00, 0x3F, 0x40, 0x01, 0xF4, 0x00, 0x0F,
-    0x40, 0x00, 0xB4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA8, 0xBF, 0xFF, 0xF2, 0xFA,
-    0xAA, 0x8B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0xBF, 0xFF, 0xC0, 0xFF, 0x41, 0xA0,
-    0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0xBF, 0xFF, 0xF8, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x40, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF,
-    0x90, 0x2F, 0xFF, 0xFC, 0x7E, 0x41, 0xB4, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3D, 0xA0, 0x00, 0xFC, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xC0, 0x00, 0x50,
-    0x00, 0x14, 0xBC, 0xBC, 0x28, 0x00, 0x00, 0x68, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
-    0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0x14, 0x10, 0xF2, 0xF7, 0xDF, 0xCA, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x68, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00,
-    0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x14,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0xBC, 0x01, 0xF8, 0xBF, 0xF0, 0x7F, 0x80, 0x00, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFA, 0xAA, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x01, 0xFF,
-    0xFE, 0x80, 0x01, 0xF0, 0x01, 0xFF, 0xFF, 0xF4, 0x01, 0xF0, 0x01, 0xF4, 0x06, 0xFC, 0x01, 0xF0,
-    0x01, 0xF4, 0x00, 0x7E, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0x3E, 0x02, 0xE0, 0x01, 0xF4, 0x00, 0x3E,
-    0x03, 0xD0, 0x01, 0xF4, 0x00, 0x7E, 0x0B, 0xC0, 0x01, 0xF4, 0x02, 0xFC, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xF4, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x02, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x2F,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x00,
-    0x0B, 0xEA, 0xAA, 0xBE, 0xA9, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBE, 0xAA, 0xAF, 0xEA,
-    0xAF, 0xF2, 0xF0, 0x00, 0x1F, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0xAF, 0x00, 0x01,
-    0xF0, 0x00, 0x3E, 0xBC, 0x00, 0x07, 0xC0, 0x01, 0xF6, 0xF0, 0x00, 0x1F, 0x40, 0x2F, 0xCB, 0xC0,
-    0x00, 0x7F, 0xFF, 0xFD, 0x2F, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xAF, 0xEA, 0xA8, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x5B, 0xD5,
-    0x54, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x14, 0x00, 0x07, 0xC7, 0xFF, 0xE0, 0x07, 0xDF,
-    0xFF, 0xF8, 0x07, 0xFC, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x3E, 0x07, 0xE0, 0x00, 0x3E, 0x07, 0xD0,
-    0x00, 0x3E, 0x07, 0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x3F, 0x07, 0xC0,
-    0x00, 0x3F, 0x07, 0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x3F, 0x07, 0xC0,
-    0x00, 0x3F, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x00, 0xA4, 0xBC, 0x00, 0x2F, 0x0B, 0xC0, 0x07, 0xD0, 0xBC, 0x00, 0xF8, 0x0B, 0xC0, 0x2F, 0x00,
-    0xBC, 0x07, 0xD0, 0x0B, 0xC0, 0xF8, 0x00, 0xBF, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0xBC, 0x0F,
-    0xC0, 0x0B, 0xC0, 0x7E, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x0F, 0xC0, 0xBC, 0x00, 0x7E, 0x0B,
-    0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x0F, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x69, 0xBC, 0x00, 0x0F, 0xEB, 0xC0, 0x03, 0xFE, 0xBC, 0x00, 0x7F, 0xEB, 0xC0, 0x0F,
-    0x7E, 0xBC, 0x02, 0xF3, 0xEB, 0xC0, 0x3C, 0x3E, 0xBC, 0x0B, 0x83, 0xEB, 0xC1, 0xF0, 0x3E, 0xBC,
-    0x3D, 0x03, 0xEB, 0xC7, 0xC0, 0x3E, 0xBC, 0xF4, 0x03, 0xEB, 0xEE, 0x00, 0x3E, 0xBF, 0xC0, 0x03,
-    0xEB, 0xF8, 0x00, 0x3E, 0xBF, 0x00, 0x03, 0xE0, 0x02, 0x90, 0x0A, 0x00, 0x0B, 0x80, 0xBC, 0x00,
-    0x0F, 0x9B, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x00, 0x0A, 0x6F, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x0F, 0x81, 0xF4, 0x00,
-    0x7D, 0x03, 0xE0, 0x03, 0xF0, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x7C, 0x00, 0x2F, 0x03, 0xF0,
-    0x00, 0x7C, 0x0F, 0x40, 0x00, 0xF8, 0xBC, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x03, 0xDF, 0x40, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x05, 0x6F, 0xC0, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x68, 0x00, 0x02, 0x8B, 0xC0, 0x00, 0x7C, 0xBC, 0x00, 0x07, 0xCB,
-    0xC0, 0x00, 0x7C, 0xBC, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7C, 0xBC, 0x00, 0x07, 0xCB, 0xC0, 0x00,
-    0x7C, 0xBC, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7C, 0xBC, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7C, 0xBC,
-    0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7C, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x82, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x07, 0xD0,
-    0x00, 0x3F, 0x40, 0x01, 0xF4, 0x0F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0x00, 0xBC, 0x00, 0x3E, 0xF0, 0x00, 0xFC, 0x00, 0xF8, 0x02, 0xF3, 0xE0, 0x03, 0xE0,
-    0x03, 0xF0, 0x0F, 0x4F, 0xC0, 0x1F, 0x40, 0x0B, 0xC0, 0x7C, 0x2F, 0x00, 0xBC, 0x00, 0x0F, 0x82,
-    0xF0, 0x3E, 0x03, 0xE0, 0x00, 0x3F, 0x0F, 0x40, 0xBC, 0x1F, 0x00, 0x00, 0x7D, 0x7C, 0x01, 0xF4,
-    0xFC, 0x00, 0x00, 0xFA, 0xE0, 0x03, 0xF3, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0A, 0x00, 0x00, 0xA1, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xC7,
-    0xD0, 0x00, 0xF4, 0x00, 0x1F, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0xBC, 0x3E, 0x00, 0x0F, 0xC0, 0x02,
-    0xF0, 0xFC, 0x00, 0x2F, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0xBC, 0x00, 0x3D, 0x03, 0xD0, 0x03, 0xF4,
-    0x01, 0xF0, 0x0F, 0x80, 0x2F, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xFB, 0xC0, 0x3D, 0x00, 0x3D, 0x0B,
-    0x8F, 0x41, 0xF0, 0x00, 0xBC, 0x3C, 0x2F, 0x0F, 0x80, 0x01, 0xF2, 0xE0, 0x3C, 0x7C, 0x00, 0x03,
-    0xFF, 0x00, 0xBB, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x01, 0x56, 0xF9, 0x55, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0x95, 0x6F, 0xF0, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x01, 0xF4,
-    0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x03,
-    0xF0, 0x01, 0xF4, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x17, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xE4, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x01, 0xAF, 0xEA, 0xA0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x1A, 0xBE, 0xAA, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xF0, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x03, 0xF0,
-    0x1F, 0x00, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x7F, 0x40, 0x7F, 0xFF, 0xFF,
-    0x80, 0x1F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFF,
-    0xF9, 0x03, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0xF4, 0x00, 0x0F, 0xF9, 0x05, 0xF4, 0x3D, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x2F,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3E, 0x55, 0xFD, 0x55, 0x55, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0xF4,
-    0x00, 0x60, 0x3D, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x0F, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x68, 0x00, 0x01, 0xBF, 0x92, 0xF0, 0x00, 0x7F, 0xFF, 0xDB, 0xC0,
-    0x07, 0xF9, 0x5B, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x0B, 0xC0,
-    0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC2,
-    0xF0, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
-    0xF8, 0x00, 0x02, 0xF0, 0x02, 0xF8, 0x00, 0x5B, 0xC0, 0x02, 0xFF, 0xFF, 0x6F, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00,
-    0x0B, 0xC3, 0xD0, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0xF9, 0xBD,
-    0x7F, 0x00, 0x01, 0xF0, 0x7C, 0x1F, 0x40, 0x03, 0xF0, 0x7C, 0x0F, 0xC0, 0x07, 0xD0, 0x7C, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x0F, 0x80, 0x7C, 0x02, 0xF0, 0x2F, 0x00, 0x7C, 0x01, 0xF4,
-    0x3F, 0x00, 0x7C, 0x00, 0xFC, 0x7D, 0x00, 0x7C, 0x00, 0x7D, 0xFC, 0x00, 0x7C, 0x00, 0x3E, 0x00,
-    0x06, 0xA0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0xBC, 0xF0, 0x00,
-    0x00, 0x3D, 0x3E, 0x00, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xF4, 0xF8, 0xFC, 0x00, 0xBC, 0x3D, 0x1F, 0x00, 0x3E, 0x0F,
-    0x43, 0xE0, 0x1F, 0x03, 0xD0, 0xBC, 0x0F, 0xC0, 0xF4, 0x0F, 0x47, 0xD0, 0x3D, 0x02, 0xF2, 0xF0,
-    0x0F, 0x40, 0x7D, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xEF, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0xF9, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0xBC, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xE5, 0x57, 0xF5, 0xF9, 0xBC,
-    0x00, 0x3D, 0x00, 0x7D, 0x0F, 0x43, 0xE0, 0x03, 0xD0, 0x0B, 0xC0, 0xF4, 0x3F, 0x00, 0x3D, 0x00,
-    0xF8, 0x0F, 0x41, 0xF4, 0x03, 0xD0, 0x2F, 0x00, 0xF4, 0x0F, 0xC0, 0x3D, 0x03, 0xF0, 0x0F, 0x40,
-    0xBC, 0x03, 0xD0, 0x7D, 0x00, 0xF4, 0x03, 0xE0, 0x3D, 0x0F, 0xC0, 0x0F, 0x40, 0x3F, 0x03, 0xD0,
-    0xF8, 0x00, 0xF4, 0x01, 0xF4, 0x3D, 0x2F, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x68, 0x00, 0x02, 0xA0,
-    0x00, 0x2F, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xC0, 0x00, 0xFB, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0xF4,
-    0x00, 0xBC, 0x00, 0x3D, 0x2E, 0x00, 0x2F, 0x00, 0x1F, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0x80, 0xF8,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0x00, 0xF8, 0xF8, 0xBC,
-    0x0B, 0xC0, 0xBC, 0x3E, 0x1F, 0x02, 0xF0, 0x3E, 0x0F, 0x83, 0xE0, 0xBC, 0x1F, 0x43, 0xE0, 0x7C,
-    0x2F, 0x0F, 0xC0, 0xF8, 0x0F, 0x8B, 0xC3, 0xD0, 0x3E, 0x02, 0xF2, 0xF2, 0xF0, 0x0F, 0x80, 0x3D,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xAA, 0xAA, 0xAF, 0x80,
-    0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00,
-    0x00, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x87, 0xD0, 0x00, 0x00, 0x01, 0xFB, 0xE0, 0x00, 0x00,
-    0x06, 0xFF, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xF4, 0xBC, 0x2F, 0x80, 0x03,
-    0xF0, 0x2F, 0x02, 0xF0, 0x01, 0xF4, 0x0B, 0xC0, 0x3E, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x3F,
-    0x00, 0xBC, 0x01, 0xF4, 0x1F, 0x40, 0x2F, 0x00, 0x3E, 0x0B, 0xC0, 0x0B, 0xC0, 0x0F, 0xC3, 0xF0,
-    0x02, 0xF0, 0x02, 0xF0, 0xF8, 0x00, 0xBC, 0x00, 0x3D, 0xBD, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x0A,
-    0xAA, 0xAA, 0xAA, 0x40, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x7E, 0x55, 0x57, 0xF0, 0x00, 0x7D, 0x00,
-    0x2F, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x1F, 0x00, 0x00, 0x00, 0xBD, 0xF4, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x02, 0xFE, 0xFF, 0xFD, 0x00, 0x0F, 0x83, 0xE0, 0xFC, 0x00, 0xBC,
-    0x0F, 0x81, 0xF4, 0x03, 0xD0, 0x3E, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0xF8, 0x03, 0xE0,
-    0x0F, 0x47, 0xD0, 0x0F, 0x80, 0x2F, 0x2F, 0x00, 0x3E, 0x00, 0x7C, 0x3D, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xD0, 0x0F, 0xEA, 0xAA, 0xAB, 0xF4, 0x0F,
-    0x40, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x3D, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x1F,
-    0x80, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x0B, 0xC0,
-    0x00, 0x3D, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0x95, 0x5F, 0xE4, 0xF8, 0x7F, 0x40, 0x3D, 0x00, 0x7D, 0x03,
-    0xE0, 0x3F, 0x00, 0xF4, 0x02, 0xF0, 0x0F, 0x80, 0x7D, 0x03, 0xD0, 0x0F, 0x80, 0x3E, 0x00, 0xF8,
-    0x0F, 0x40, 0x7D, 0x00, 0xF8, 0x02, 0xF0, 0x3D, 0x02, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0xF4, 0x0F,
-    0x80, 0x0F, 0x80, 0x0F, 0x83, 0xD0, 0x7D, 0x00, 0x3E, 0x00, 0x3F, 0x0F, 0x42, 0xF0, 0x00, 0xF8,
-    0x00, 0x7C, 0x3D, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x68, 0x0A, 0xAA, 0xAA, 0xAA, 0x42, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x0B, 0xC0, 0x3F, 0x55, 0x57, 0xF0, 0x2F, 0x00, 0x7D, 0x00, 0x1F, 0x00,
-    0xBC, 0x00, 0x7D, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0x7D, 0x1F, 0x40, 0x0B, 0xC0, 0x00, 0xBD, 0xF4,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xF0, 0x0F, 0x82,
-    0xE0, 0xFC, 0x0B, 0xC0, 0xBC, 0x0B, 0x80, 0xF4, 0x2F, 0x03, 0xE0, 0x2E, 0x02, 0xF0, 0xBC, 0x1F,
-    0x40, 0xB8, 0x07, 0xC2, 0xF0, 0xBC, 0x02, 0xE0, 0x0F, 0x8B, 0xC3, 0xD0, 0x0B, 0x80, 0x2F, 0x2F,
-    0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x02, 0xD0, 0x07, 0xE0, 0x00, 0xF8, 0x2F, 0xE0, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x2F, 0x90, 0x0B,
-    0xF4, 0x08, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1B, 0xE0, 0x02, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x55, 0x6F, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B,
-    0xF4, 0x01, 0xBF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0x94, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAF, 0xE4, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xAA, 0xAA,
-    0xAC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x02, 0xE0, 0x1F, 0xD0, 0x2F, 0x1F, 0x90, 0x03,
-    0xFF, 0x40, 0x06, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x41, 0xE5, 0x1B, 0xF0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x1B, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0,
-    0x6F, 0xFF, 0xE0, 0xBF, 0xFF, 0xD0, 0x7E, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x10, 0x7D, 0x00, 0x7C, 0x00, 0x7C, 0x7D,
-    0x00, 0x7D, 0x00, 0x7D, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x7D, 0x00,
-    0x7D, 0x00, 0x7D, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x7D, 0x00, 0x7D,
-    0x00, 0x7D, 0x7D, 0x00, 0x7D, 0x00, 0x7C, 0x3E, 0x00, 0x7D, 0x00, 0xBC, 0x3F, 0x00, 0x7D, 0x00,
-    0xFC, 0x1F, 0x40, 0x7D, 0x02, 0xF4, 0x0F, 0xE0, 0x7D, 0x0B, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x06, 0x80, 0x1F, 0x00, 0x68, 0xBC, 0x01, 0xF0, 0x07, 0xCB, 0xC0, 0x1F, 0x00, 0x3D,
-    0xBC, 0x01, 0xF0, 0x03, 0xEB, 0xC0, 0x1F, 0x00, 0x3E, 0xBC, 0x01, 0xF0, 0x03, 0xFB, 0xC0, 0x1F,
-    0x00, 0x2F, 0xBC, 0x01, 0xF0, 0x02, 0xFB, 0xC0, 0x1F, 0x00, 0x2F, 0xBC, 0x01, 0xF0, 0x03, 0xEB,
-    0xC0, 0x1F, 0x00, 0x3E, 0x7D, 0x01, 0xF0, 0x07, 0xD3, 0xF0, 0x1F, 0x00, 0xFC, 0x1F, 0xD1, 0xF0,
-    0xBF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0,
-    0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00,
-    0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xAA, 0xAA, 0xAA, 0xBF, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xE4, 0x5F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x00,
-    0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02,
-    0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0xB8, 0x00, 0x00, 0x01, 0xFD, 0xBC, 0x00, 0x00, 0x0B, 0xFD, 0x3E, 0x00, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x02, 0xF0,
-    0x01, 0xF0, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x07,
-    0xC0, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x1F, 0x00,
-    0x00, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x6D, 0xBC, 0x00,
-    0x01, 0xFE, 0x3D, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x0B, 0xC0, 0x0F, 0x80,
-    0x0F, 0x80, 0x0B, 0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x02, 0xF0,
-    0x3D, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x7C, 0xF4, 0x00, 0x00, 0x3E,
-    0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0x40, 0x50, 0x00, 0x00, 0x03,
-    0xF0, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0x00, 0x1E,
-    0x07, 0x80, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x01, 0xFD, 0xBC, 0x00, 0x00, 0x0B, 0xFD, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x2F,
-    0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x07, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x01,
-    0xF4, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x6F,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x15, 0x05, 0x40, 0x00, 0x2F, 0x47, 0xD0, 0x00, 0x0F, 0xC2,
-    0xF0, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA8, 0x00, 0x00, 0x6D, 0xBC, 0x00, 0x01, 0xFE, 0x3D, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x03, 0xC0, 0x1F, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x0B, 0xC0, 0x0F, 0x00, 0x07, 0xC0,
-    0x2F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0xF8,
-    0xF8, 0x00, 0x00, 0x7C, 0xF4, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x0A, 0x40, 0x00, 0x0A, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x7C, 0x00, 0x03,
-    0xE0, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x1F, 0x42, 0xF0,
-    0x00, 0xBC, 0x0F, 0x80, 0x00, 0x00, 0x7E, 0x07, 0xD0, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x01, 0xF4,
-    0x0F, 0xC0, 0x1F, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x1F, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00,
-    0x2F, 0x40, 0x3E, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x1F, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF0, 0x01, 0xF4, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xE3, 0xD0, 0x00,
-    0xBE, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xDF, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0xA8, 0x00, 0x00, 0xA8, 0x0B, 0xFF, 0xFD, 0x01, 0xF4, 0x00, 0x03, 0xE0,
-    0xBF, 0x56, 0xFD, 0x03, 0xE0, 0x00, 0x2F, 0x07, 0xE0, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0xFC, 0x3F,
-    0x00, 0x01, 0xF4, 0x0F, 0x40, 0x07, 0xD0, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x2F, 0x07, 0xD0,
-    0x00, 0x0B, 0xC0, 0x7C, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0xF8, 0x07, 0xC0, 0x7D, 0x00,
-    0x00, 0xBC, 0x02, 0xF0, 0x3F, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0xF4, 0x03, 0xE0, 0x00,
-    0x0F, 0xC0, 0x0F, 0x87, 0xC0, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x1F, 0x3E, 0x00, 0x1F, 0x40, 0x02,
-    0xF0, 0x00, 0x3D, 0xF4, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xBF, 0xDF, 0xF0, 0x00, 0x3F,
-    0x40, 0xA0, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x2F,
-    0x00, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xC3,
-    0xE0, 0x00, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0xBC,
-    0x3E, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0x81, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0x50, 0x1F,
-    0xC0, 0x01, 0xFE, 0x7F, 0xDB, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFB,
-    0xFB, 0xF8, 0x07, 0xE0, 0x14, 0x2F, 0x42, 0xF0, 0x00, 0x03, 0xF0, 0xF8, 0x00, 0x00, 0x7D, 0x7D,
-    0x00, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E,
-    0x3E, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x03, 0xE0, 0x2F, 0x8F, 0xD7,
-    0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0xB8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0x00, 0x03, 0xF8, 0x0B, 0x00, 0xE0, 0x2F, 0xC0, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x28, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0xF8, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x0B,
-    0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xE0, 0x03, 0xFD, 0x02, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x03,
-    0xD1, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xC2, 0x46, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x06, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x0B, 0xFF, 0xD0, 0x0F, 0xE1, 0xA0, 0x02, 0x47, 0xF0,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x03, 0xD0, 0x00, 0x3E, 0x7D, 0x00, 0x03, 0xD0, 0x00, 0x3E, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3D,
-    0x3F, 0x00, 0x03, 0xD0, 0x00, 0xBD, 0x2F, 0x40, 0x03, 0xE0, 0x00, 0xFC, 0x0F, 0xD0, 0x1F, 0xF8,
-    0x03, 0xF4, 0x07, 0xFF, 0xFF, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x1F, 0xFF, 0x40, 0x00, 0x01,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xFA, 0xF0,
-    0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x1F,
-    0x40, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xF0, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0xFD, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x07, 0xF8,
-    0x00, 0x1F, 0x00, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0xFB, 0xC0, 0x03, 0xF0,
-    0x03, 0xE0, 0x0B, 0xCF, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x3D, 0x3F, 0x00, 0x7D, 0x00, 0x2F, 0x01,
-    0xF0, 0xBC, 0x02, 0xF0, 0x00, 0x3E, 0x0B, 0xC0, 0xF8, 0x0F, 0x80, 0x00, 0xFC, 0x3D, 0x02, 0xF0,
-    0x7C, 0x00, 0x01, 0xF5, 0xF0, 0x07, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0x80, 0x0F, 0xCF, 0x40, 0x00,
-    0x07, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xD0, 0x70, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x28, 0x00, 0x02, 0x87, 0xC0, 0x00,
-    0xF4, 0x00, 0x1F, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0x7C, 0x3D, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0xF8,
-    0x00, 0x3F, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0xBC, 0x00, 0x3E, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xF4,
-    0x0F, 0x40, 0x0F, 0xD0, 0x07, 0xC0, 0x3E, 0x00, 0xBF, 0xC0, 0x2F, 0x00, 0xBC, 0x03, 0xEF, 0x00,
-    0xF4, 0x00, 0xF4, 0x2E, 0x3D, 0x07, 0xC0, 0x02, 0xF0, 0xF0, 0xBC, 0x3E, 0x00, 0x07, 0xCB, 0x80,
-    0xF1, 0xF0, 0x00, 0x0F, 0xFC, 0x02, 0xEF, 0x80, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x2F,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x03, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFE, 0x41, 0xBC, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x2F, 0xF9, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0x95, 0xB0, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF4, 0x01, 0x00, 0x7F, 0xFF,
-    0xC0, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x38, 0x0B, 0x80, 0x00, 0x7F, 0x4F, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0xF2, 0xFC, 0x00,
-    0x03, 0xC0, 0x38, 0x3D, 0x0B, 0x80, 0x00, 0x3F, 0x9F, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x03, 0xC0, 0x18, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x15, 0x55,
-    0xFC, 0x7F, 0xFF, 0xFC, 0x7C, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x7F, 0xF4,
-    0x3F, 0xFE, 0xBC, 0x7F, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x0A, 0x0F, 0xC3, 0xD0, 0xB0, 0x0B, 0x40,
-    0x00, 0x24, 0xBD, 0x2D, 0x2C, 0xF0, 0x00, 0x06, 0x90, 0x00, 0x3F, 0xFF, 0x40, 0x7D, 0x1F, 0xFD,
-    0x74, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x1C,
-    0x03, 0x40, 0x00, 0x00, 0x2C, 0x07, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x87, 0x56, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x75, 0x6D, 0x60, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x01,
-    0xC0, 0x34, 0x00, 0x00, 0x02, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x90, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x06, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xB8, 0x00, 0x2E, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x0B,
-    0xE5, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x3D, 0x00,
-    0x00, 0x3F, 0xE0, 0x0F, 0x40, 0x00, 0x2F, 0xF8, 0x03, 0xD0, 0x00, 0x0F, 0xAE, 0x00, 0xF4, 0x00,
-    0x0F, 0xCB, 0x80, 0x3D, 0x00, 0x0B, 0xD3, 0xE0, 0x0F, 0x40, 0x03, 0xE0, 0xF8, 0x03, 0xD0, 0x03,
-    0xF0, 0x3E, 0x00, 0xF4, 0x02, 0xF4, 0x0F, 0x80, 0x3D, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x40, 0xFC,
-    0x00, 0xF8, 0x03, 0xD0, 0xBD, 0x00, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0x0F, 0x80, 0x3C, 0x3F, 0x00,
-    0x03, 0xE0, 0x0F, 0x2F, 0x40, 0x00, 0xF8, 0x03, 0xDF, 0x80, 0x00, 0x3E, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0x80, 0x3F, 0xD0, 0x00, 0x03, 0xE5, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xC3, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x0F,
-    0xE6, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA0, 0x00, 0x0A, 0x80, 0xBC, 0x00, 0x0B, 0xF4, 0x2F, 0x00, 0x07, 0xFD, 0x0B, 0xC0, 0x03, 0xEF,
-    0x42, 0xF0, 0x02, 0xF3, 0xD0, 0xBC, 0x00, 0xF4, 0xF4, 0x2F, 0x00, 0xF8, 0x3D, 0x0B, 0xC0, 0x7C,
-    0x0F, 0x42, 0xF0, 0x3D, 0x03, 0xD0, 0xBC, 0x2F, 0x00, 0xF4, 0x2F, 0x1F, 0x00, 0x3D, 0x0B, 0xCF,
-    0x40, 0x0F, 0x42, 0xFB, 0xC0, 0x03, 0xD0, 0xBF, 0xC0, 0x00, 0xF4, 0x2F, 0xE0, 0x00, 0x3F, 0xFB,
-    0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0x95, 0x5B,
-    0xF4, 0x03, 0xD0, 0x00, 0x7F, 0x00, 0xF4, 0x00, 0x0B, 0xD0, 0x3D, 0x00, 0x01, 0xF4, 0x0F, 0x40,
-    0x00, 0x7D, 0x03, 0xD0, 0x00, 0x2F, 0x40, 0xF4, 0x00, 0x1F, 0xC0, 0x3E, 0x01, 0x6F, 0xD0, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xAF, 0xEA, 0x90, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x1B, 0xD5, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFC, 0x0B, 0xC0, 0x00, 0xBD, 0x0B, 0xC0, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x01, 0xFC, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xA4, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xE5, 0x5B, 0xFC, 0x0F,
-    0x40, 0x02, 0xFC, 0x3D, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x1F, 0x4F, 0x40,
-    0x00, 0x7C, 0x3D, 0x07, 0xC3, 0xF0, 0xF4, 0x0F, 0xAF, 0x83, 0xE5, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xBF, 0x00, 0xF4, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x34, 0x0F, 0x40, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x64, 0x1F, 0xE4, 0x02, 0xF3, 0xFF, 0xFC, 0x0B, 0xFE, 0x46, 0xFC, 0x2F, 0xC0,
-    0x02, 0xF4, 0xBE, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x1F, 0x6F, 0x00, 0x00,
-    0x7D, 0xBC, 0x00, 0x01, 0xF6, 0xF0, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x2F, 0x2F, 0x40, 0xB4, 0xFC,
-    0xBF, 0x01, 0xF7, 0xE2, 0xFF, 0x02, 0xFF, 0x0B, 0xEF, 0xFF, 0xF4, 0x2F, 0x1F, 0xFF, 0xC0, 0xBC,
-    0x01, 0x4B, 0xC2, 0xF0, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xCF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFC, 0xFA, 0xAA, 0xA9, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF1, 0xAA, 0xAF, 0xCB,
-    0xFF, 0xFF, 0x2F, 0x55, 0x54, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00,
-    0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x3E, 0xAA, 0xAA, 0x40, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x6F, 0x95, 0x50, 0x07, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x06, 0xAA, 0xAA, 0x02, 0xFF, 0xFF, 0xC0, 0xBE,
-    0xAA, 0xA0, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x3E, 0xAA, 0xAA, 0x40, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x3E, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3D, 0x00, 0x1F, 0xF0,
-    0x3D, 0x00, 0x03, 0xF8, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0x3E,
-    0x3D, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x90, 0x1B, 0xF0, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x6A, 0xAA, 0xA0, 0x2F, 0xFF, 0xFC, 0x0B, 0xEA, 0xAA, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF4, 0x2F, 0x41, 0xBF,
-    0x0B, 0xC0, 0x07, 0xF2, 0xF0, 0x00, 0xBC, 0xBC, 0x00, 0x1F, 0x6F, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0xFA, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0xFC, 0x02, 0x41, 0xFD, 0x00, 0xFF, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x02, 0xE0, 0x00, 0x2F, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x03, 0xE0, 0x00,
-    0xF8, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x07,
-    0xD0, 0x3E, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x0F,
-    0x80, 0x00, 0x00, 0x03, 0xF3, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xBE, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xE3, 0xE2,
-    0xF4, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x03, 0xE0, 0x3F, 0x00, 0x00,
-    0x0B, 0xD0, 0x3E, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x0B, 0xD0, 0x00, 0x3E, 0x00, 0x3E,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xFD, 0x53, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xFF,
-    0xBD, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x29, 0x00,
-    0x0A, 0x00, 0x0A, 0x80, 0x7D, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0xBC, 0x01, 0xF0, 0x07, 0xD0, 0x00,
-    0xBC, 0x07, 0xC0, 0x3E, 0x00, 0x00, 0xFC, 0x1F, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x7C, 0x3F, 0x00,
-    0x00, 0x00, 0xF9, 0xF2, 0xF0, 0x00, 0x00, 0x01, 0xFB, 0xEF, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xBD,
-    0x00, 0x00, 0x00, 0x7D, 0x7C, 0xBC, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x07,
-    0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x7C, 0x01, 0xF8, 0x02, 0xF4,
-    0x01, 0xF0, 0x01, 0xFF, 0xEF, 0x40, 0x07, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF0, 0x0E, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x55, 0xBF, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x7E, 0x39, 0x00, 0x1B, 0xF0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xE0, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01,
-    0xBC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x0B, 0xFF, 0xFF,
-    0x41, 0xE4, 0x1B, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x1B,
-    0xD0, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC9, 0x00, 0x0F, 0xD3, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xD0, 0x00, 0x2E,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x2F,
-    0xD0, 0x00, 0x01, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x2F, 0x40, 0x3D, 0x00,
-    0x07, 0xE0, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0x3D, 0x00, 0x7E, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00,
-    0x3D, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x03, 0xEF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xDB, 0xE0, 0x00, 0x00, 0x3D, 0x2F, 0x80, 0x00, 0x03,
-    0xD0, 0xFD, 0x00, 0x00, 0x3D, 0x03, 0xF4, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0x3D, 0x00, 0x3F,
-    0x00, 0x03, 0xD0, 0x01, 0xFC, 0x00, 0x3D, 0x00, 0x07, 0xF5, 0x43, 0xD0, 0x00, 0x1F, 0xFC, 0x3D,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0x40, 0x68,
-    0x00, 0x1A, 0x0B, 0xC0, 0x07, 0xE0, 0xBC, 0x00, 0xF8, 0x0B, 0xC0, 0x3E, 0x00, 0xBC, 0x0F, 0xC0,
-    0x0B, 0xC3, 0xF0, 0x00, 0xBC, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x00, 0xBE, 0xF4, 0x00, 0x0B, 0xCB,
-    0xD0, 0x00, 0xBC, 0x3F, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0xBC, 0x03, 0xF0, 0x0B, 0xC0, 0x0F, 0xC0,
-    0xBC, 0x00, 0x7F, 0xFB, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x15, 0x3D, 0x00, 0x00, 0xBC,
-    0x0F, 0x40, 0x00, 0xBD, 0x03, 0xD0, 0x00, 0x7E, 0x00, 0xF4, 0x60, 0x7E, 0x00, 0x3D, 0x3C, 0x7E,
-    0x00, 0x0F, 0x4F, 0x7F, 0x00, 0x03, 0xD3, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x3D, 0x3F,
-    0x00, 0x00, 0x0F, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xF6, 0xF8, 0x00, 0x00, 0x3D,
-    0x3F, 0x80, 0x00, 0x0F, 0x4F, 0xF4, 0x00, 0x03, 0xD3, 0xFF, 0x40, 0x00, 0xF4, 0xF3, 0xF0, 0x00,
-    0x3D, 0x2C, 0x3F, 0x00, 0x0F, 0x40, 0x07, 0xF0, 0x03, 0xD0, 0x00, 0x7F, 0x00, 0xF4, 0x00, 0x07,
-    0xE0, 0x3D, 0x00, 0x00, 0xBE, 0x00, 0x68, 0x00, 0x1A, 0x0B, 0xC1, 0x07, 0xE0, 0xBC, 0x78, 0xF8,
-    0x0B, 0xC7, 0xBE, 0x00, 0xBC, 0x7F, 0xC0, 0x0B, 0xC7, 0xF0, 0x00, 0xBC, 0xBC, 0x00, 0x0B, 0xEF,
-    0x80, 0x00, 0xBE, 0xF8, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0xBC, 0x7F, 0x00, 0x0B, 0xC7, 0xFC, 0x00,
-    0xBC, 0x7B, 0xF0, 0x0B, 0xC7, 0x8F, 0xC0, 0xBC, 0x24, 0x7E, 0x0B, 0xC0, 0x01, 0xF8, 0x03, 0xD0,
-    0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x01, 0xF4, 0x17, 0xE5, 0x00, 0x3F, 0x0B, 0xFF, 0xF0, 0x0B, 0xC0,
-    0xBF, 0xFF, 0x01, 0xF4, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0x3D, 0x01,
-    0xF4, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x3E, 0x57, 0xE0, 0x00, 0x03, 0xD0, 0x2F, 0x40, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x07,
-    0xE0, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x03,
-    0xD0, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x6F, 0xEA, 0xA0, 0x00, 0xBF, 0xFF, 0xF4,
-    0x00, 0x5B, 0xD5, 0x50, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xA0, 0x0B, 0xC0, 0x07,
-    0xE0, 0x0B, 0xC0, 0x0F, 0x80, 0x0B, 0xC0, 0x3E, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x0B, 0xC3, 0xF0,
-    0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x0B, 0xEF, 0x00, 0x00, 0x0B, 0xEF, 0x40, 0x00, 0x0B, 0xCB, 0xD0,
-    0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x0B, 0xC0, 0x0F,
-    0xC0, 0x0B, 0xC0, 0x07, 0xE0, 0x0B, 0xC0, 0x01, 0xF8, 0xBF, 0xFE, 0x00, 0x00, 0x7D, 0x3F, 0xFF,
-    0x80, 0x00, 0x7E, 0x06, 0xAB, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x3E,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0xF8,
-    0x3F, 0x40, 0x00, 0x00, 0x3E, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xAF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0x82,
-    0xF8, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00,
-    0x07, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x6A, 0xAA, 0x00, 0x06, 0x81, 0xFF, 0xFC, 0x00,
-    0x7D, 0x01, 0x56, 0xF0, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x03, 0xF0, 0x00,
-    0x00, 0x7C, 0x3F, 0x00, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x00, 0x07, 0xEF, 0x00, 0x00, 0x00, 0x1F,
-    0xBD, 0x00, 0x00, 0x00, 0x7C, 0xBD, 0x00, 0x00, 0x01, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0xFC,
-    0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x01, 0xF8, 0x00,
-    0x07, 0xC0, 0x01, 0xF8, 0x3D, 0x00, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00,
-    0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00,
-    0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3E, 0x55, 0x55, 0x5F, 0xC0,
-    0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D,
-    0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00,
-    0x00, 0x0F, 0xD4, 0x3D, 0x00, 0x00, 0x0F, 0xFD, 0x3D, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x68, 0x00, 0x01, 0xA0, 0x2F,
-    0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x01, 0xF0,
-    0x2F, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x2F, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x2F, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0xBC, 0x00,
-    0x01, 0xF0, 0x2F, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x1F, 0xF6, 0xF0, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0x40, 0x3D, 0x00, 0x00, 0x0B, 0xFF, 0xD3, 0xD0,
-    0x00, 0x00, 0xFF, 0xFE, 0x3D, 0x00, 0x00, 0x0F, 0xEA, 0x93, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xE5, 0x55, 0x55, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0,
-    0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0xC0, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x68, 0x00, 0x01,
-    0xAA, 0xA8, 0xBC, 0x00, 0x01, 0xFF, 0xFC, 0xBC, 0x00, 0x01, 0xF9, 0x54, 0xBC, 0x00, 0x01, 0xF0,
-    0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0xBC,
-    0x00, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0xBC, 0x00,
-    0x01, 0xF0, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3E, 0xAA, 0xAA, 0xBE, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3F,
-    0x55, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0xE0, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF4, 0x3D,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBD, 0x3D, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x7E, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x3E, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x90, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x6A, 0xAA, 0xAA, 0x80, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xEA, 0xAA, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0xBC, 0x00, 0x07, 0xFF, 0xFF, 0x02, 0xF0, 0x00, 0x1F, 0x41,
-    0xFF, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0xBD, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0xFC, 0xBC, 0x00, 0x07,
-    0xC0, 0x02, 0xF2, 0xF0, 0x00, 0x1F, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7C, 0x00, 0x1F, 0x6F, 0x00,
-    0x01, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x24, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x0B, 0xF9, 0x04, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F,
-    0xE0, 0x01, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0xBC, 0x00, 0x3F, 0x87, 0xF0, 0x3F, 0x00, 0x0F, 0x80,
-    0xBD, 0x0F, 0x80, 0x0B, 0xC0, 0x0F, 0x83, 0xE0, 0x02, 0xF0, 0x03, 0xF0, 0xF8, 0x00, 0xFC, 0x00,
-    0xFC, 0x3E, 0x00, 0x3F, 0x00, 0x3F, 0x0F, 0x80, 0x0F, 0xC0, 0x0F, 0xC3, 0xF0, 0x02, 0xF0, 0x03,
-    0xE0, 0xFC, 0x00, 0x7D, 0x00, 0xF4, 0x1F, 0x40, 0x0F, 0x80, 0xBC, 0x03, 0xF0, 0x03, 0xF0, 0x7E,
-    0x00, 0x7F, 0x00, 0x7F, 0x3F, 0x00, 0x0B, 0xF8, 0x0B, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFE, 0x44, 0x00, 0x00, 0x7D, 0x00, 0x05,
-    0x00, 0x3F, 0x00, 0x3F, 0xF8, 0x0F, 0x80, 0x3F, 0xBF, 0x47, 0xD0, 0x1F, 0x43, 0xF1, 0xF4, 0x0B,
-    0xC0, 0x7C, 0x7C, 0x03, 0xF0, 0x1F, 0x1F, 0x40, 0xFC, 0x07, 0xC3, 0xD0, 0x2F, 0x02, 0xF0, 0xFC,
-    0x07, 0xD0, 0xF8, 0x1F, 0x40, 0xFC, 0xBC, 0x03, 0xF4, 0x1F, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x40, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0x41, 0xBC, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x68, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0x56, 0xD0, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xF4, 0x01, 0x80, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x17, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x50, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x6A, 0xAB, 0xEA, 0xA9, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE5, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x15, 0x00, 0x6A, 0xAA, 0xAA, 0x87,
-    0xFF, 0xFF, 0xFD, 0x2A, 0xAF, 0xAA, 0x80, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x05, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x1F, 0x80, 0x00,
-    0x0F, 0xC2, 0xF0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xF8,
-    0x00, 0xF8, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00,
-    0x0F, 0xDF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xA8, 0x00, 0x00, 0xA6, 0xF0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0xF8, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0xF4, 0x0B,
-    0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x2F, 0x3D, 0x00,
-    0x00, 0x7D, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x1F, 0x80,
-    0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x02, 0xF0, 0x00,
-    0xF8, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0xBC, 0x2F, 0x00,
-    0x00, 0x0F, 0xDF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x55, 0xF9, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xA8, 0x00, 0x00, 0xA6, 0xF0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x2F, 0x0F,
-    0xC0, 0x00, 0xF8, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0xF4,
-    0x0B, 0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x07, 0xC1, 0xF4, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x2F, 0x3D,
-    0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x02,
-    0xF4, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x03,
-    0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x1F,
-    0x40, 0x7D, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x00, 0xBE,
-    0x53, 0xF0, 0x00, 0x03, 0xFF, 0xBC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x2A, 0x00, 0x01, 0xA0, 0x1F, 0x40, 0x03, 0xF0, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x03, 0xF0, 0x1F, 0x40, 0x01, 0xF8, 0x3E, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBC, 0xFC,
-    0x00, 0x01, 0xF8, 0x3E, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0x0B, 0xC0, 0x0B, 0xD0, 0x1F, 0x40, 0x03,
-    0xFE, 0x3E, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x02, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x06, 0xAA, 0xFE, 0xAA, 0x90, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFD,
-    0x55, 0x55, 0x7F, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x6A, 0xAA, 0xAA, 0x40, 0xA0, 0x1F, 0xFF, 0xFF, 0xE0, 0x7C,
-    0x02, 0xAB, 0xFA, 0xA4, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0,
-    0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
-    0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00,
-    0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0xBC, 0x00, 0x00, 0x3D, 0x02, 0xF0,
-    0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00,
-    0x3E, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0x0F, 0x80,
-    0xBC, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x07, 0xE0, 0x00, 0x1B, 0xE0, 0x0F, 0xFA,
-    0xAF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xBE, 0x00, 0x06, 0xBA, 0x40, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xE5, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x00, 0xA4, 0x00, 0x02, 0x90, 0xF8,
-    0x00, 0x03, 0xD0, 0xF8, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x03, 0xD0, 0xF8,
-    0x00, 0x03, 0xD0, 0xFC, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x0B, 0xD0, 0x7F, 0x55, 0xFF, 0xD0, 0x2F,
-    0xFF, 0xF7, 0xD0, 0x06, 0xFE, 0x43, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x15, 0xBC, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3E, 0xBC,
-    0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3E, 0xBC, 0x01, 0x40, 0x3E, 0xBC,
-    0x03, 0x80, 0x3E, 0xBC, 0x03, 0x80, 0x3E, 0xBC, 0x03, 0x80, 0x3E, 0x7F, 0x03, 0x80, 0xBE, 0x3F,
-    0xEB, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xBE, 0x00, 0xAF, 0xE4, 0x3E, 0x00, 0x03, 0x80, 0x3E, 0x00,
-    0x03, 0x80, 0x3E, 0x00, 0x03, 0x80, 0x3E, 0x00, 0x03, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0xA4, 0x00, 0x06, 0x8F, 0x80, 0x00, 0x7C, 0xF8, 0x00,
-    0x07, 0xCF, 0x80, 0x00, 0x7C, 0xF8, 0x04, 0x07, 0xCF, 0x82, 0xC0, 0x7C, 0xFC, 0x2C, 0x07, 0xCB,
-    0xC2, 0xC1, 0xFC, 0x7F, 0x6E, 0xFF, 0xC2, 0xFF, 0xFE, 0xBC, 0x06, 0xFE, 0x07, 0xC0, 0x02, 0xC0,
-    0x7C, 0x00, 0x2C, 0x07, 0xC0, 0x02, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x3D,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x06, 0xA4,
-    0x00, 0x3E, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xEB, 0xFF, 0x03, 0xF9, 0x00, 0x0B, 0xE0, 0xF4, 0x00,
-    0x00, 0xFC, 0x3D, 0x00, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x02, 0xF0, 0xF4,
-    0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x02, 0xF0,
-    0xF4, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC1, 0xBF, 0x80, 0xBC, 0xFF, 0xFF, 0x4B, 0xFE, 0x56, 0xFC, 0xBF, 0x40, 0x0B, 0xDB,
-    0xE0, 0x00, 0x3E, 0xBD, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x41,
-    0x7F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF4, 0x2C, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x3C, 0x2F, 0x00, 0x00, 0x00, 0xFC,
-    0x3C, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0xAA, 0xAA, 0xAA, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x01, 0xBF, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x06, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xE4,
-    0x6F, 0x81, 0x41, 0xF4, 0x00, 0xBC, 0x3C, 0x3F, 0x00, 0x03, 0xE7, 0xC3, 0xD0, 0x00, 0x3F, 0x3E,
-    0xBE, 0x55, 0x57, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFE, 0xAA, 0xAA, 0xA0, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x18, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x41, 0x7F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x00,
-    0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x2C, 0x1F, 0x40, 0x00, 0x00,
-    0xF8, 0x3C, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0xAA,
-    0xAA, 0xAA, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xAA, 0xAA, 0xAA, 0xA8, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x06, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x0B, 0xE4, 0x6F, 0x81, 0x41, 0xF4, 0x00, 0xBC, 0x3C, 0x3F, 0x00, 0x03, 0xE7,
-    0xC3, 0xD0, 0x00, 0x3F, 0x3E, 0xBE, 0x55, 0x57, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFE, 0xAA,
-    0xAA, 0xA0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x18, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x54, 0x00, 0xBF, 0xFE, 0xBF, 0xFE,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0xBF, 0xFD, 0xFF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF5, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x0F, 0x40, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xF4,
-    0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0x2F, 0x40, 0x0F, 0x40, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x07, 0xE0, 0x00, 0x00, 0xBD,
-    0x03, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x42, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x57, 0xE5, 0xFC, 0x00, 0x00,
-    0x02, 0xF4, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00,
-    0xF4, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x0B,
-    0xD0, 0x02, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x80, 0xFC,
-    0x00, 0x03, 0xD0, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x80,
-    0x19, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
-    0x0A, 0x00, 0x02, 0x82, 0xF0, 0x00, 0xF4, 0x00, 0xFC, 0x0F, 0x80, 0x0F, 0x40, 0x2F, 0x00, 0x7D,
-    0x00, 0xF4, 0x03, 0xD0, 0x02, 0xF0, 0x0F, 0x40, 0xF8, 0x00, 0x0F, 0x80, 0xF4, 0x2F, 0x00, 0x00,
-    0x3D, 0x0F, 0x47, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xD1, 0xF4, 0x7E, 0x00, 0x00, 0xF8, 0x0F, 0x42, 0xF4, 0x00, 0x3F, 0x00, 0xF4, 0x0F, 0xC0,
-    0x07, 0xD0, 0x0F, 0x40, 0x7E, 0x00, 0xFC, 0x00, 0xF4, 0x02, 0xF0, 0x3F, 0x00, 0x0F, 0x40, 0x0F,
-    0xC7, 0xD0, 0x00, 0xF4, 0x00, 0x7E, 0x3D, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0xBD, 0x03, 0xD0,
-    0x00, 0xBE, 0x00, 0xF4, 0x00, 0x7E, 0x00, 0x3D, 0x00, 0x7E, 0x00, 0x0F, 0x40, 0x7E, 0x00, 0x03,
-    0xD0, 0x3F, 0x00, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x0F, 0x6F, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x3E, 0x40, 0x5F, 0xF8, 0x0F, 0x40, 0x00,
-    0x7F, 0x43, 0xD0, 0x00, 0x07, 0xF0, 0xF4, 0x00, 0x00, 0xBD, 0x3D, 0x00, 0x00, 0x0F, 0x8F, 0x40,
-    0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x09, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x68, 0x00, 0x1A, 0x0B, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0xF8, 0x0B, 0xC0, 0x3E, 0x00,
-    0xBC, 0x0F, 0x80, 0x0B, 0xC3, 0xF0, 0x00, 0xBC, 0xFC, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0xBF, 0xFF,
-    0xF8, 0x0B, 0xE5, 0x6F, 0xE0, 0xBC, 0x00, 0x3F, 0x4B, 0xC0, 0x00, 0xFC, 0xBC, 0x00, 0x0B, 0xCB,
-    0xC0, 0x00, 0x7D, 0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x01, 0x80, 0x7F, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFD, 0x55, 0x7F, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x03, 0xF0,
-    0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00,
-    0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00,
-    0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x03, 0xF0, 0x00,
-    0x7C, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x53, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x2A, 0xAA, 0xA0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x3E, 0xAA,
-    0xF4, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x0F, 0x40, 0x00,
-    0xBC, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x0F,
-    0x40, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0xBC,
-    0x00, 0x0F, 0x40, 0xBF, 0x80, 0x00, 0xFF, 0xCF, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0x40, 0x3D, 0x00, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x03, 0xF3,
-    0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03,
-    0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFC, 0xF9, 0x55, 0x55, 0x7F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40,
-    0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF,
-    0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x09, 0x01, 0xBF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x68, 0x00, 0x01, 0xA2, 0xF0, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x2F, 0x2F, 0x00,
-    0x00, 0xBC, 0xBC, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x2F, 0x2F, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xF2, 0xF0, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0xBC,
-    0xBC, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x24,
-    0x1F, 0xC0, 0x00, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0B, 0x80, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F,
-    0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0,
-    0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x3E, 0x55, 0x55, 0x5F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00,
-    0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00,
-    0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0xD4, 0x3D, 0x00, 0x00, 0x0F,
-    0xFD, 0x3D, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x68, 0x00, 0x01, 0xA0, 0x2F, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x1F,
-    0x02, 0xF0, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00,
-    0x2F, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF0, 0x2F, 0x00, 0x00, 0x7C, 0x0B, 0xC0,
-    0x00, 0x1F, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0x7D, 0x0B,
-    0xC0, 0x00, 0x1F, 0xFA, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3E, 0xBC, 0x00,
-    0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3E, 0xBC, 0x00,
-    0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x01, 0xBE, 0x3F, 0xEA,
-    0xBF, 0xFE, 0x0F, 0xFF, 0xFF, 0xBE, 0x01, 0xAE, 0x90, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x7E, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x05, 0x40, 0xA4, 0x00,
-    0x02, 0x9F, 0x80, 0x00, 0x3D, 0xF8, 0x00, 0x03, 0xDF, 0x80, 0x00, 0x3D, 0xF8, 0x00, 0x03, 0xDF,
-    0x80, 0x00, 0x3D, 0xFC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0xBD, 0x7F, 0x55, 0xFF, 0xD2, 0xFF, 0xFF,
-    0x7D, 0x06, 0xFE, 0x43, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x1F,
-    0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xFB, 0xC0,
-    0x00, 0x01, 0xFF, 0x80, 0x3D, 0xF4, 0x00, 0x00, 0xF7, 0xE0, 0x0F, 0x3E, 0x00, 0x00, 0x7C, 0xF8,
-    0x03, 0xC7, 0xC0, 0x00, 0x2E, 0x3E, 0x00, 0xF0, 0xF4, 0x00, 0x0F, 0x4F, 0x80, 0x3D, 0x2F, 0x00,
-    0x07, 0xC3, 0xE0, 0x0F, 0x47, 0xC0, 0x03, 0xE0, 0xF8, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3E, 0x00,
-    0xF4, 0x2F, 0x00, 0xBC, 0x0F, 0x80, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xE0, 0x0F, 0x40, 0xFC, 0x1F,
-    0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x0B, 0x80, 0x3E, 0x00, 0xF4, 0x03, 0xE3, 0xD0, 0x0F, 0x80, 0x3D,
-    0x00, 0xBD, 0xF0, 0x03, 0xE0, 0x0F, 0x40, 0x1F, 0xF8, 0x00, 0xF8, 0x03, 0xD0, 0x03, 0xFC, 0x00,
-    0x3F, 0x50, 0xF4, 0x00, 0xBE, 0x00, 0x0F, 0xFC, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x6A, 0x00, 0x00, 0x0A, 0x80, 0xBF, 0x40, 0x00, 0x2F, 0xD0, 0xBF, 0x80,
-    0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x7F, 0xD0, 0xBF, 0xE0, 0x00, 0xFB, 0xD0, 0xBD, 0xF0, 0x00,
-    0xF3, 0xD0, 0xBC, 0xF4, 0x02, 0xF3, 0xD0, 0xBC, 0xB8, 0x03, 0xD3, 0xD0, 0xBC, 0x3C, 0x07, 0xC3,
-    0xD0, 0xBC, 0x3D, 0x0F, 0x83, 0xD0, 0xBC, 0x1F, 0x0F, 0x03, 0xD0, 0xBC, 0x0F, 0x6E, 0x03, 0xD0,
-    0xBC, 0x0B, 0xBD, 0x03, 0xD0, 0xBC, 0x03, 0xFC, 0x03, 0xD0, 0xBC, 0x03, 0xF8, 0x03, 0xFF, 0xBC,
-    0x01, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0xBF, 0xFE, 0xBF, 0xFE, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0xBF, 0xFD, 0xFF, 0xFE, 0x00, 0x14, 0x00, 0x40,
-    0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x02, 0xF5, 0xBC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00,
-    0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00,
-    0x3F, 0x00, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00,
-    0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x02, 0x80, 0x19,
-    0x00, 0xF8, 0x0B, 0x80, 0x1F, 0x9B, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xFE, 0x40, 0x2F, 0xFF, 0xF8, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x5B, 0xC0, 0xBF, 0xFF, 0xF1, 0xFF, 0x95, 0xBC, 0xFC, 0x00,
-    0x2F, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x03, 0xFB, 0xC0, 0x01, 0xFD, 0xF8, 0x01, 0xFF, 0x3F, 0xFF,
-    0xF7, 0xC2, 0xFF, 0xE0, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x0F,
-    0x00, 0x00, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3, 0xE0,
-    0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00,
-    0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x3D,
-    0x01, 0xF4, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1, 0xF0,
-    0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00,
-    0x3F, 0x07, 0xC0, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x40,
-    0x2F, 0xFF, 0xF8, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x00, 0x01, 0x5B, 0xC0, 0xBF, 0xFF, 0xF1, 0xFF, 0x95, 0xBC, 0xFC, 0x00, 0x2F, 0xBC, 0x00, 0x0B,
-    0xEF, 0x00, 0x03, 0xFB, 0xC0, 0x01, 0xFD, 0xF8, 0x01, 0xFF, 0x3F, 0xFF, 0xF7, 0xC2, 0xFF, 0xE0,
-    0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFA, 0xFD, 0x55, 0x54, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x55, 0x54, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xF8,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x55, 0x54, 0x7D, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x3F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xE0, 0x0B, 0xF8, 0x00, 0x3F, 0xFF,
-    0xF1, 0xFF, 0xFE, 0x00, 0xF9, 0x0B, 0xFF, 0xD1, 0xBD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x55, 0xFD, 0x55, 0x5F,
-    0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xF9, 0x5F, 0xEA, 0xAA, 0xA4, 0xFC, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x2F,
-    0xE0, 0x00, 0x01, 0xF8, 0x02, 0xF7, 0xE0, 0x01, 0xC3, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x02, 0xFF,
-    0xE0, 0x07, 0xFF, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x14, 0x01, 0xF0, 0x0F,
-    0x40, 0x3F, 0x5F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xFD, 0x3E, 0x55, 0x55, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0x0F, 0x95, 0x55, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xF4, 0x02, 0x80, 0x0A, 0x00, 0x2E, 0x02, 0xF0, 0x00, 0xF9, 0xBD, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xE4,
-    0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57, 0xF7,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x03, 0xE5, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xE1, 0x55, 0x55, 0x55, 0x5F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xF8, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0xBD, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0xFE, 0x00,
-    0x6F, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xC0, 0x3E, 0x55, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE1, 0x55, 0x55, 0x7F, 0xBF, 0xFF, 0xFF,
-    0xFB, 0xFA, 0xAA, 0xBF, 0x7C, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x7D, 0x3F, 0x00, 0x0F, 0xC1, 0xF8,
-    0x02, 0xF4, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x02, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x0F, 0x94, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0x85, 0x55, 0x55, 0x55, 0x7E, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE3, 0xE0, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x02,
-    0xF4, 0xBC, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x03,
-    0xF8, 0x01, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3D, 0x0B, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0x18, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xC0, 0x3E, 0x55,
-    0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE1,
-    0x55, 0x55, 0x7F, 0xBF, 0xFF, 0xFF, 0xFB, 0xFA, 0xAA, 0xBF, 0x7C, 0x00, 0x03, 0xE3, 0xD0, 0x00,
-    0x7D, 0x3F, 0x00, 0x0F, 0xC1, 0xF8, 0x02, 0xF4, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40,
-    0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x2F, 0x00,
-    0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0x2F, 0x40, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x3D, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x03, 0xD0, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x0F, 0x42, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x57, 0xE5, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F,
-    0x40, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0xF4, 0x03, 0xF0,
-    0x00, 0x07, 0xE0, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x0B, 0xD0, 0x02, 0xF4,
-    0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x03, 0xD0,
-    0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x0A, 0x00, 0x02,
-    0x82, 0xF0, 0x00, 0xF4, 0x00, 0xFC, 0x0F, 0x80, 0x0F, 0x40, 0x2F, 0x00, 0x7D, 0x00, 0xF4, 0x03,
-    0xD0, 0x02, 0xF0, 0x0F, 0x40, 0xF8, 0x00, 0x0F, 0x80, 0xF4, 0x2F, 0x00, 0x00, 0x3D, 0x0F, 0x47,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xD1, 0xF4,
-    0x7E, 0x00, 0x00, 0xF8, 0x0F, 0x42, 0xF4, 0x00, 0x3F, 0x00, 0xF4, 0x0F, 0xC0, 0x07, 0xD0, 0x0F,
-    0x40, 0x7E, 0x00, 0xFC, 0x00, 0xF4, 0x02, 0xF0, 0x3F, 0x00, 0x0F, 0x40, 0x0F, 0xC7, 0xD0, 0x00,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x90,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x39, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x01, 0x56, 0xFE, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0xE4, 0x00, 0x6F,
-    0xC3, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0xF4, 0x2F, 0x00, 0x3D, 0x0F, 0xC0, 0x05, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xF9, 0x00, 0xBF, 0xFF, 0xF4, 0x1E, 0x41, 0xBF, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0xBC, 0x00, 0x01, 0xBD, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x90, 0x00, 0xFD, 0x3F, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xFD, 0x00, 0x01, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x82, 0xAA,
-    0xAA, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x15, 0x6F, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xCE, 0x40, 0x01, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x43, 0xFF, 0xFF,
-    0xFC, 0x2A, 0xAA, 0xAF, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x15, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF8,
-    0xB9, 0x01, 0xBF, 0x0B, 0xFF, 0xFF, 0x80, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0B, 0xC3, 0xD0, 0x00, 0x01, 0xFC, 0x3D, 0x00, 0x00, 0x3F, 0xC3, 0xD0, 0x00, 0x0B, 0xFC, 0x3D,
-    0x00, 0x01, 0xF7, 0xC3, 0xD0, 0x00, 0x3E, 0x7C, 0x3D, 0x00, 0x0B, 0xC7, 0xC3, 0xD0, 0x01, 0xF4,
-    0x7C, 0x3D, 0x00, 0x3E, 0x07, 0xC3, 0xD0, 0x0B, 0xC0, 0x7C, 0x3D, 0x00, 0xF4, 0x07, 0xC3, 0xD0,
-    0x3E, 0x00, 0x7C, 0x3D, 0x07, 0xC0, 0x07, 0xC3, 0xD0, 0xF4, 0x00, 0x7C, 0x3D, 0x3F, 0x00, 0x07,
-    0xC3, 0xD7, 0xC0, 0x00, 0x7C, 0x3D, 0xF8, 0x00, 0x07, 0xC3, 0xFF, 0x00, 0x00, 0x7C, 0x3F, 0xC0,
-    0x00, 0x07, 0xC3, 0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xD0, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x06, 0x9B, 0xC0, 0x00,
-    0xFE, 0xBC, 0x00, 0x3F, 0xEB, 0xC0, 0x07, 0xFE, 0xBC, 0x00, 0xF7, 0xEB, 0xC0, 0x2F, 0x3E, 0xBC,
-    0x03, 0xC3, 0xEB, 0xC0, 0xB8, 0x3E, 0xBC, 0x1F, 0x03, 0xEB, 0xC3, 0xD0, 0x3E, 0xBC, 0x7C, 0x03,
-    0xEB, 0xCF, 0x40, 0x3E, 0xBE, 0xE0, 0x03, 0xEB, 0xFC, 0x00, 0x3E, 0xBF, 0x80, 0x03, 0xEB, 0xF0,
-    0x00, 0x3E, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x00,
-    0x01, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0B, 0xC3, 0xD0, 0x00, 0x01, 0xFC, 0x3D, 0x00, 0x00, 0x3F, 0xC3, 0xD0, 0x00, 0x0B, 0xFC, 0x3D,
-    0x00, 0x01, 0xF7, 0xC3, 0xD0, 0x00, 0x3E, 0x7C, 0x3D, 0x00, 0x0B, 0xC7, 0xC3, 0xD0, 0x01, 0xF4,
-    0x7C, 0x3D, 0x00, 0x3E, 0x07, 0xC3, 0xD0, 0x0B, 0xC0, 0x7C, 0x3D, 0x00, 0xF4, 0x07, 0xC3, 0xD0,
-    0x3E, 0x00, 0x7C, 0x3D, 0x07, 0xC0, 0x07, 0xC3, 0xD0, 0xF4, 0x00, 0x7C, 0x3D, 0x3F, 0x00, 0x07,
-    0xC3, 0xD7, 0xC0, 0x00, 0x7C, 0x3D, 0xF8, 0x00, 0x07, 0xC3, 0xFF, 0x00, 0x00, 0x7C, 0x3F, 0xC0,
-    0x00, 0x07, 0xC3, 0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x40, 0x00, 0x00,
-    0x3E, 0x07, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0x18, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x06, 0x9B, 0xC0, 0x00, 0xFE, 0xBC, 0x00, 0x3F, 0xEB, 0xC0, 0x07, 0xFE, 0xBC,
-    0x00, 0xF7, 0xEB, 0xC0, 0x2F, 0x3E, 0xBC, 0x03, 0xC3, 0xEB, 0xC0, 0xB8, 0x3E, 0xBC, 0x1F, 0x03,
-    0xEB, 0xC3, 0xD0, 0x3E, 0xBC, 0x7C, 0x03, 0xEB, 0xCF, 0x40, 0x3E, 0xBE, 0xE0, 0x03, 0xEB, 0xFC,
-    0x00, 0x3E, 0xBF, 0x80, 0x03, 0xEB, 0xF0, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x02, 0x40, 0x60, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8,
-    0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E,
-    0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00,
-    0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03,
-    0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0xF4, 0x2F,
-    0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01,
-    0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00,
-    0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02,
-    0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xAA, 0xAA,
-    0xAA, 0xBF, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00,
-    0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0,
-    0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xE4, 0x5F, 0xD0,
-    0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0xFC,
-    0x3E, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0xF4, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x02, 0x40, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xAA, 0xAA,
-    0xAA, 0xBF, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00,
-    0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0,
-    0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x01, 0xF4, 0x3F, 0x00,
-    0x00, 0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xE4, 0x5F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0xF4,
-    0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x7D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0,
-    0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x09, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x01, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3E, 0x41, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x55, 0x55, 0x5F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x64, 0x00, 0x6F, 0xD0, 0x1F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x81, 0xF0, 0x03, 0xF0, 0x7D,
-    0x00, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFF, 0xFF,
-    0x40, 0x39, 0x5B, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x3F, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x0B, 0xC1, 0x40, 0x0F, 0xE0, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0xF8, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x3F,
-    0x00, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x0B, 0xDF, 0x40, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x15,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0xA6, 0xF0, 0x00, 0x07, 0xD3, 0xE0, 0x00,
-    0x2F, 0x0B, 0xC0, 0x00, 0xF8, 0x1F, 0x40, 0x07, 0xD0, 0x3E, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0xF8,
-    0x00, 0xF4, 0x07, 0xC0, 0x02, 0xF0, 0x3F, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x0F, 0x8B, 0xC0, 0x00,
-    0x2F, 0x3E, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x56, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x01, 0x80, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00,
-    0x7D, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x3E,
-    0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0xBC, 0x01, 0xF4,
-    0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x0B,
-    0xDF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B,
-    0xC0, 0xF4, 0x00, 0x2F, 0x03, 0xD0, 0x00, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x80, 0x00, 0x0A, 0x6F, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x0F,
-    0x81, 0xF4, 0x00, 0x7D, 0x03, 0xE0, 0x03, 0xF0, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x7C, 0x00,
-    0x2F, 0x03, 0xF0, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0xF8, 0xBC, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x03,
-    0xDF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x05, 0x6F, 0xC0, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0x00, 0x0F, 0x42, 0xD0, 0x00, 0x00,
-    0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x07,
-    0xD2, 0xF0, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x02, 0xF0, 0x03, 0xE0,
-    0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x1F, 0x40,
-    0x00, 0x3E, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x00, 0xBD,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x50, 0x00,
-    0x3F, 0x0F, 0xC0, 0x02, 0xF0, 0x7C, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0xF0, 0x2D, 0x00, 0x01, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x29, 0xBC, 0x00, 0x01, 0xF4, 0xF8, 0x00, 0x0B,
-    0xC2, 0xF0, 0x00, 0x3E, 0x07, 0xD0, 0x01, 0xF4, 0x0F, 0x80, 0x0B, 0xC0, 0x2F, 0x00, 0x3E, 0x00,
-    0x3D, 0x01, 0xF0, 0x00, 0xBC, 0x0F, 0xC0, 0x01, 0xF0, 0x3D, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x0B,
-    0xCF, 0x80, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0xF4, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xBF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03,
-    0xFB, 0xC0, 0x00, 0x0F, 0xDF, 0x40, 0x00, 0x3F, 0x3F, 0x90, 0x1B, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0x9F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x2E, 0x03, 0xC0, 0x03, 0xF0, 0x7D, 0x00, 0x08, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x02, 0x97, 0xD0, 0x00, 0x3E, 0x7D, 0x00,
-    0x03, 0xE7, 0xD0, 0x00, 0x3E, 0x7D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x3E, 0x3D, 0x00, 0x03, 0xE3,
-    0xF0, 0x00, 0x3E, 0x1F, 0xE5, 0xAF, 0xE0, 0xBF, 0xFF, 0xFE, 0x00, 0x6A, 0x93, 0xE0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x3F,
-    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF3, 0xEA, 0xAA, 0xA4, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x15, 0x00, 0x00, 0x6A, 0xAA, 0xAB, 0xFF, 0xFF, 0xBE, 0xAA, 0x9B, 0xC0,
-    0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x03,
-    0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x02, 0x40,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x2F, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x00, 0x2F,
-    0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x3D,
-    0x00, 0x00, 0x00, 0x2F, 0x3F, 0xAA, 0x90, 0x00, 0x2F, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0x3E, 0xAA,
-    0xFF, 0xC0, 0x2F, 0x3D, 0x00, 0x0B, 0xE0, 0x2F, 0x3D, 0x00, 0x03, 0xF0, 0x2F, 0x3D, 0x00, 0x02,
-    0xF0, 0x2F, 0x3D, 0x00, 0x02, 0xF0, 0x2F, 0x3D, 0x00, 0x02, 0xF0, 0x2F, 0x3D, 0x00, 0x03, 0xF0,
-    0x2F, 0x3D, 0x00, 0x0B, 0xE0, 0x2F, 0x3E, 0x55, 0x7F, 0xC0, 0x2F, 0x3F, 0xFF, 0xFF, 0x00, 0x2F,
-    0x3F, 0xFF, 0xE4, 0x00, 0x2F, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x3E,
-    0x07, 0xC0, 0x00, 0x01, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x68, 0x00, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x00, 0x3E, 0xBC, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x3E, 0xBF, 0xFF, 0x90, 0x03, 0xEB,
-    0xFF, 0xFF, 0xC0, 0x3E, 0xBC, 0x01, 0xBF, 0x03, 0xEB, 0xC0, 0x02, 0xF4, 0x3E, 0xBC, 0x00, 0x0F,
-    0x43, 0xEB, 0xC0, 0x00, 0xF4, 0x3E, 0xBC, 0x00, 0x2F, 0x43, 0xEB, 0xC0, 0x1B, 0xF0, 0x3E, 0xBF,
-    0xFF, 0xFC, 0x03, 0xEB, 0xFF, 0xF9, 0x00, 0x3E, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x3E, 0xAA, 0xAA, 0x40, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x6F, 0x95, 0x50, 0x07, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x05, 0xBE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x06, 0xAA,
-    0xAA, 0x02, 0xFF, 0xFF, 0xC0, 0xBE, 0xAA, 0xA0, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xBC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x27, 0xF0, 0x00, 0x0F,
-    0xF8, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x02, 0xF4, 0x00, 0x03, 0xE0, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0xBC,
-    0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x7E, 0x00,
-    0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x7D, 0x00, 0x03, 0xE0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x00, 0xBE, 0x53, 0xF0, 0x00, 0x03, 0xFF,
-    0xBC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x2A, 0x00, 0x01, 0xA0, 0x1F, 0x40, 0x03, 0xF0, 0x0B, 0xC0, 0x0B, 0xC0, 0x03, 0xF0, 0x1F, 0x40,
-    0x01, 0xF8, 0x3E, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x01, 0xF8, 0x3E, 0x00,
-    0x03, 0xF0, 0x1F, 0x40, 0x0B, 0xC0, 0x0B, 0xC0, 0x1F, 0x40, 0x03, 0xFE, 0x3E, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x05, 0xBD,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x06, 0xE0, 0x3E, 0x00, 0x00, 0x1F, 0x0B, 0xD0, 0x00, 0x0F,
-    0x80, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x07, 0xD0, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x3F, 0x02,
-    0xF0, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00,
-    0x0F, 0x8B, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x07, 0xD0, 0x1F, 0x40, 0x03, 0xE0, 0x02, 0xF0,
-    0x02, 0xF0, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00,
-    0x1F, 0x80, 0x2A, 0x00, 0x01, 0xA0, 0x7D, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0xBC, 0x00, 0xFC, 0x07,
-    0xD0, 0x01, 0xF8, 0x3E, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x7E, 0x0F, 0x80, 0x03,
-    0xF0, 0x1F, 0x40, 0x2F, 0x00, 0x2F, 0x01, 0xF4, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x7E, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0xE0, 0x6A, 0xB8, 0xBA, 0xB8, 0xA0, 0xE0, 0xA1, 0x80, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x0B, 0x00, 0x2E, 0xA9, 0x2E, 0xAE, 0x0B, 0x0A, 0x02, 0x4A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0xFF, 0xFC, 0xFF, 0xFC, 0x55, 0x54, 0xFF, 0xFC, 0xFF, 0xFC, 0x55, 0x54, 0x6A, 0xAA,
-    0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAA, 0x40, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xD5, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00,
-    0x03, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3,
-    0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0,
-    0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D,
-    0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C,
-    0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF,
-    0xFC, 0x15, 0x55, 0x55, 0x40, 0x07, 0x82, 0xD0, 0xF0, 0xBC, 0x3F, 0x0F, 0x8B, 0xD0, 0x50, 0x0F,
-    0x87, 0xD2, 0xF0, 0xFC, 0x3D, 0x0F, 0x07, 0x80, 0x40, 0x0B, 0xC0, 0xFC, 0x0F, 0x80, 0xF4, 0x1F,
-    0x02, 0xE0, 0x3C, 0x01, 0x40, 0x7D, 0x1F, 0x83, 0xE0, 0xBC, 0x1F, 0x03, 0xD0, 0x78, 0x04, 0x07,
-    0x80, 0xF0, 0x2D, 0x07, 0xC0, 0xF0, 0x3E, 0x0B, 0xC0, 0xF4, 0x3F, 0x0B, 0xC0, 0xF8, 0x3F, 0x0B,
-    0xD0, 0xFC, 0x05, 0x01, 0x40, 0x0F, 0x82, 0xF0, 0x7D, 0x0F, 0xC2, 0xF0, 0x3E, 0x0F, 0xC1, 0xF0,
-    0x3D, 0x0B, 0xC0, 0xF0, 0x3D, 0x07, 0x80, 0xF0, 0x04, 0x01, 0x00, 0x0B, 0xC1, 0xF4, 0x3F, 0x07,
-    0xD0, 0xF8, 0x2F, 0x07, 0xD0, 0xF8, 0x1F, 0x03, 0xD0, 0xB8, 0x1F, 0x03, 0xC0, 0xB8, 0x05, 0x00,
-    0x40, 0x7D, 0x0F, 0x81, 0xF4, 0x3F, 0x03, 0xE0, 0xBC, 0x0B, 0xC1, 0xF4, 0x1F, 0x03, 0xD0, 0x3D,
-    0x0B, 0x80, 0x78, 0x0F, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0x00, 0x02, 0x96, 0xD5, 0xA0, 0xFF, 0xFF,
-    0xFC, 0x3A, 0xAE, 0xAB, 0x00, 0x07, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x07, 0x40, 0x07, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x00, 0x1D, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x02, 0xD0, 0x00, 0x50, 0x74, 0x14, 0x7F, 0xFF, 0xFF, 0x1F, 0xEF, 0xAF, 0xC0, 0x01, 0xD0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x00, 0xBF,
-    0x87, 0xFF, 0x6F, 0xFE, 0xBF, 0xFA, 0xFF, 0xE7, 0xFF, 0x07, 0xF4, 0x00, 0x00, 0x0D, 0x00, 0x03,
-    0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xFD, 0x0F, 0xFF, 0x83, 0xFF, 0x40, 0xFD, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x1F, 0xCB, 0xF1, 0xFC, 0x04, 0x00, 0x14, 0x00, 0x24, 0xBE, 0x00, 0xFD, 0xFE,
-    0x00, 0xFE, 0xBD, 0x00, 0xFD, 0x14, 0x00, 0x10, 0x14, 0x00, 0x24, 0x00, 0x52, 0xF8, 0x03, 0xF0,
-    0x07, 0xFF, 0xE0, 0x1F, 0xD0, 0x2F, 0xEF, 0x40, 0x3F, 0x00, 0x7E, 0x14, 0x00, 0x10, 0x00, 0x50,
-    0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x6A, 0xA8, 0xBA, 0xA8, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0x2A, 0xA9, 0x2A, 0xAE, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x7F,
-    0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00,
-    0x00, 0x7F, 0xFD, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x7F, 0xFD, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x7C, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x03, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xC3, 0xD1, 0xB8,
-    0x00, 0x1B, 0x90, 0x3C, 0x07, 0x87, 0xC7, 0xFF, 0x40, 0x7F, 0xF4, 0x3D, 0x0F, 0x4F, 0x4F, 0x47,
-    0xC0, 0xF4, 0x7C, 0x1F, 0xFF, 0x2E, 0x1E, 0x03, 0xD1, 0xF0, 0x2D, 0x07, 0xF8, 0x3C, 0x2D, 0x01,
-    0xE2, 0xE0, 0x1E, 0x00, 0x00, 0xB8, 0x3D, 0x01, 0xF2, 0xD0, 0x1F, 0x00, 0x00, 0xF0, 0x3D, 0x01,
-    0xF2, 0xD0, 0x0F, 0x00, 0x02, 0xE0, 0x3D, 0x01, 0xF2, 0xD0, 0x0F, 0x00, 0x07, 0xC0, 0x2D, 0x01,
-    0xE2, 0xE0, 0x1F, 0x00, 0x0F, 0x40, 0x2E, 0x02, 0xE1, 0xE0, 0x2E, 0x00, 0x1F, 0x00, 0x0F, 0x03,
-    0xC0, 0xF0, 0x3D, 0x00, 0x3D, 0x00, 0x0F, 0xEF, 0xC0, 0xBE, 0xFC, 0x00, 0xB8, 0x00, 0x03, 0xFF,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x43, 0xE0, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x3C, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0x0B, 0x82,
-    0xE4, 0x00, 0x2A, 0x80, 0x01, 0xB8, 0x07, 0xC0, 0x7C, 0x3C, 0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x2F,
-    0xFC, 0x0F, 0x83, 0xD3, 0xD3, 0xF1, 0xF4, 0x2F, 0x5F, 0x81, 0xF4, 0xBC, 0x1F, 0xFF, 0x1F, 0x0F,
-    0x01, 0xF0, 0xF4, 0x0F, 0x0F, 0x80, 0xF4, 0x1F, 0xE0, 0xF4, 0x7C, 0x03, 0xC3, 0xC0, 0x3D, 0x3D,
-    0x02, 0xE0, 0x00, 0x07, 0xC2, 0xE0, 0x0F, 0x5F, 0x00, 0xF4, 0xF0, 0x0B, 0x80, 0x00, 0x3C, 0x0B,
-    0x80, 0x3D, 0x7C, 0x03, 0xE3, 0xC0, 0x2E, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0xF5, 0xF0, 0x0F, 0x4F,
-    0x00, 0xB8, 0x00, 0x0F, 0x00, 0x7C, 0x03, 0xC3, 0xC0, 0x3D, 0x3C, 0x02, 0xE0, 0x00, 0xB8, 0x01,
-    0xF0, 0x1F, 0x0F, 0x00, 0xF0, 0xF4, 0x0F, 0x40, 0x03, 0xC0, 0x03, 0xD0, 0xB8, 0x2E, 0x0B, 0xC2,
-    0xF0, 0x7C, 0x00, 0x2D, 0x00, 0x07, 0xEF, 0xC0, 0x7F, 0xBD, 0x03, 0xFB, 0xE0, 0x01, 0xF0, 0x00,
-    0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xD0, 0x1F, 0x00, 0xF0, 0x07, 0x80, 0x18,
-    0x00, 0x00, 0xF0, 0x3D, 0x03, 0xE0, 0xBC, 0x07, 0xC0, 0xF0, 0x0F, 0x42, 0xE0, 0x1F, 0x03, 0xC0,
-    0x3C, 0x0B, 0x40, 0x78, 0x0E, 0x00, 0x60, 0x18, 0x00, 0x00, 0xF0, 0x3D, 0x0F, 0x40, 0xF8, 0x2F,
-    0x0B, 0xC0, 0x7C, 0x0F, 0x03, 0xD0, 0x3D, 0x0B, 0x82, 0xE0, 0x1F, 0x03, 0xC0, 0xF0, 0x0F, 0x02,
-    0xD0, 0xB4, 0x07, 0x80, 0xE0, 0x3C, 0x01, 0x80, 0x60, 0x18, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0,
-    0x02, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x09, 0x7C, 0x2E, 0x00, 0x3E, 0x0F, 0x40, 0x1F,
-    0x0B, 0xC0, 0x0B, 0x83, 0xD0, 0x03, 0xC1, 0xF0, 0x01, 0xE0, 0xB4, 0x00, 0xF0, 0x3C, 0x00, 0x24,
-    0x18, 0x7C, 0x2E, 0x0F, 0x40, 0x0F, 0x83, 0xD1, 0xF0, 0x01, 0xF0, 0xBC, 0x3E, 0x00, 0x2E, 0x0F,
-    0x43, 0xC0, 0x03, 0xC1, 0xF0, 0xB8, 0x00, 0x78, 0x2D, 0x0F, 0x00, 0x0F, 0x03, 0xC1, 0xE0, 0x00,
-    0x90, 0x60, 0x28, 0x00, 0x10, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xEF, 0x00, 0x02,
-    0xC7, 0x40, 0x03, 0x83, 0xC0, 0x0B, 0x01, 0xD0, 0x0E, 0x00, 0xF0, 0x2C, 0x00, 0x74, 0x38, 0x00,
-    0x3C, 0x00, 0x10, 0x03, 0xE0, 0x3F, 0x02, 0xF0, 0x1F, 0x41, 0xF4, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F,
-    0x80, 0x1F, 0x40, 0x1F, 0x40, 0x2D, 0x00, 0x00, 0x10, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x07,
-    0xE0, 0x07, 0xD0, 0x0F, 0xC0, 0xFC, 0x0B, 0xC0, 0x7D, 0x03, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xF4, 0x00, 0x04, 0x3D, 0x00, 0x1F, 0x80, 0x03, 0xD1,
-    0xF4, 0x01, 0xF4, 0x00, 0xF8, 0x07, 0xD0, 0x01, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80,
-    0x00, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00,
-    0x00, 0x00, 0x1F, 0x4F, 0x80, 0x00, 0x3D, 0x00, 0x7F, 0xE0, 0x03, 0xEB, 0xE0, 0x01, 0xFC, 0x00,
-    0x3F, 0x7D, 0x00, 0x3F, 0xD0, 0x03, 0xF1, 0x40, 0x0F, 0x9F, 0x40, 0x04, 0x00, 0x03, 0xE0, 0x7D,
-    0x00, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x00,
-    0x1F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF4, 0x3E, 0x00, 0x1F,
-    0x80, 0x07, 0xC1, 0x80, 0x01, 0xF8, 0x00, 0x18, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBD, 0x03,
-    0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x1F, 0x40, 0xFC, 0x7D, 0x02, 0xF1, 0xF0, 0x0B, 0xC7, 0xC0,
-    0x2F, 0x1F, 0x00, 0xBC, 0x3C, 0x02, 0xF0, 0xF0, 0x07, 0x83, 0xC0, 0x1E, 0x0F, 0x00, 0x78, 0x3C,
-    0x01, 0xE0, 0xF0, 0x07, 0x83, 0xC0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x02, 0x4B,
-    0xE0, 0x3F, 0x3F, 0x80, 0xFD, 0xBD, 0x03, 0xF0, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0x80, 0x97, 0xD1, 0xF4, 0x00, 0xF4, 0x2F, 0x00, 0x3C, 0x03, 0xC0, 0x0F,
-    0x00, 0xF0, 0x03, 0xC0, 0x7C, 0x00, 0xF0, 0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x0F, 0x3F, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x3C, 0x00, 0x00, 0x03, 0x80,
-    0xE0, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0xEA, 0xBE, 0x00, 0x00, 0x1B, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x01, 0xFE, 0x5B, 0xF0, 0x00,
-    0x7C, 0x00, 0x07, 0xC0, 0x0E, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x30, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0xC0, 0x00, 0x1D, 0x00, 0x00,
-    0xB0, 0x00, 0x03, 0x80, 0x00, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x00, 0x01,
-    0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xFC, 0x00, 0x0E, 0x34, 0x00, 0xB0, 0xF0, 0x03,
-    0xC1, 0xD0, 0x1D, 0x03, 0x80, 0xF0, 0x0B, 0x07, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x90, 0xB0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x03,
-    0x80, 0xB0, 0x1A, 0x00, 0x38, 0x0B, 0x01, 0xA1, 0xFF, 0xBE, 0xFF, 0xC0, 0x1F, 0xFB, 0xEF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x07, 0xEE, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0x3E, 0x3E,
-    0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x2F, 0x0B, 0xD0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x1F, 0x80,
-    0xFC, 0x00, 0x1C, 0x02, 0x80, 0x00, 0x01, 0xD0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0xFF, 0xEB,
-    0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E,
-    0x00, 0xBF, 0xFA, 0xFF, 0xEB, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8,
-    0x02, 0xE0, 0x0B, 0x80, 0x2F, 0x55, 0xBF, 0xF9, 0xAA, 0x90, 0x3F, 0xFC, 0x3F, 0xFD, 0x15, 0x7D,
-    0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D,
-    0x00, 0x7D, 0x7F, 0xFD, 0x7F, 0xFD, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D,
-    0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x15, 0xBD, 0x3F, 0xFD, 0x2A, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-    0xC0, 0xF4, 0x07, 0xF4, 0xF9, 0x06, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBD, 0x7F, 0xFF, 0xF8, 0x0B, 0xD3, 0xD0, 0x1F, 0xD0, 0xBD,
-    0x00, 0x00, 0x3E, 0x0B, 0xD0, 0x00, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0x03,
-    0xE0, 0x7C, 0x00, 0x00, 0x7D, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x7C, 0x00, 0x0B, 0xE0, 0x03, 0xC0,
-    0x02, 0xF8, 0x00, 0x3C, 0x00, 0x7D, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0xF0, 0x00,
-    0x03, 0xC0, 0x0F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x01, 0x40, 0x1F, 0xC0, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00,
-    0xBD, 0x00, 0x50, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0xFF, 0x40, 0xBD,
-    0x0F, 0xFF, 0xFF, 0x0B, 0xD0, 0xF9, 0x06, 0xF8, 0x7D, 0x00, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x00,
-    0x7C, 0x7C, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x00, 0xBC, 0x7C, 0x00, 0x00, 0x1F, 0x83, 0xC0,
-    0x00, 0x07, 0xF0, 0x3C, 0x00, 0x01, 0xFC, 0x03, 0xC0, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x0F, 0x80,
-    0x03, 0xC0, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x18, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00,
-    0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0xAA, 0xAA,
-    0xAA, 0xA3, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x7E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0x40, 0x79, 0x7F, 0xFF, 0xD0, 0x74, 0x2F, 0xFF, 0xF0, 0x74, 0x2F, 0xFF, 0xF8, 0x74, 0x2F,
-    0xFF, 0xFC, 0x74, 0x2F, 0xFF, 0xFC, 0x74, 0x2F, 0xFF, 0xFC, 0x74, 0x2F, 0xFF, 0xFC, 0x74, 0x2F,
-    0xFF, 0xFC, 0x74, 0x2F, 0xFF, 0xFC, 0x74, 0x2F, 0xFF, 0xF8, 0x74, 0x2F, 0xFF, 0xF4, 0x74, 0x2F,
-    0xFF, 0xE0, 0x74, 0x2F, 0xFF, 0x80, 0x74, 0x2C, 0x50, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C,
-    0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C,
-    0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C,
-    0x00, 0x00, 0x24, 0x18, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA8, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xF9, 0x7C, 0x2F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF,
-    0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF,
-    0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x1F, 0xFF, 0xF4, 0x2C, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFC, 0x6A, 0xAA, 0xA4, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x79, 0x7F, 0xFF, 0xE0, 0x74, 0x3F,
-    0xFF, 0xF4, 0x74, 0x3F, 0xFF, 0xF8, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F,
-    0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F,
-    0xFF, 0xF4, 0x74, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x07,
-    0x90, 0xF0, 0x6E, 0xBF, 0xEF, 0xFF, 0xE6, 0xBF, 0xFF, 0xE9, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xBE,
-    0x00, 0x01, 0xF1, 0xF4, 0x00, 0x3F, 0x0F, 0xC0, 0x0B, 0xD0, 0x7E, 0x00, 0x18, 0x02, 0x40, 0x00,
-    0x07, 0xD0, 0xBF, 0x0B, 0xF0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x3E, 0x03, 0xF0, 0x2F, 0x00, 0xF4, 0x0F, 0x40, 0x78, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x01, 0xFE, 0x5B, 0xF0, 0x00, 0x7C, 0x00, 0x07,
-    0xC0, 0x0E, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x30, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x1C, 0x3C, 0x00, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00,
-    0x7C, 0x00, 0x0F, 0xEA, 0xBE, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x90, 0xF0, 0x6E,
-    0xBF, 0xEF, 0xFF, 0xE6, 0xBF, 0xFF, 0xE9, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xBE, 0x00, 0x01, 0xF1,
-    0xF4, 0x00, 0x3F, 0x0F, 0xC0, 0x0B, 0xD0, 0x7E, 0x00, 0x18, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x79, 0x0F, 0x06, 0xEB, 0xFE, 0xFF, 0xFE, 0x6B, 0xFF, 0xFE, 0x90, 0x03, 0xFC, 0x00, 0x00,
-    0xBB, 0xE0, 0x00, 0x1F, 0x1F, 0x40, 0x03, 0xF0, 0xFC, 0x00, 0xBD, 0x07, 0xE0, 0x01, 0x80, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x02, 0xDB, 0xE0, 0x0F, 0x2F, 0x40, 0xB8, 0x14, 0x03, 0xD0, 0x00,
-    0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00,
-    0x2E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00,
-    0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x7D, 0x3C, 0x02, 0xFA, 0xE0, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x02, 0x83, 0xFF, 0xFF, 0xE4, 0x00, 0x01, 0xE3, 0xE0, 0x06,
-    0xFF, 0xF9, 0x46, 0xF1, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x60, 0x00, 0x00, 0x01, 0x6A, 0x90,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x02, 0xF4, 0x06, 0xF4, 0x00, 0xB4,
-    0x00, 0x02, 0xD0, 0x1D, 0x00, 0x00, 0x0B, 0x03, 0x80, 0x00, 0x00, 0x3C, 0x10, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x01, 0x80, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x03, 0x42, 0xC0, 0xE0, 0x03, 0xD2, 0xC3,
-    0xE0, 0x00, 0xF6, 0xCF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x2A, 0xAF, 0xFE, 0xA9, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFA, 0xDF, 0x40, 0x03, 0xE2, 0xC7,
-    0xD0, 0x07, 0x82, 0xC1, 0xF0, 0x01, 0x02, 0xC0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x50, 0x00, 0xF0, 0x7C, 0x1F,
-    0x07, 0xC0, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x00, 0xF4, 0x3D, 0x0F,
-    0x43, 0xD0, 0x1F, 0x07, 0xC1, 0xE0, 0x78, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x00, 0x78, 0x1E, 0x07,
-    0x81, 0xD0, 0x06, 0x02, 0x80, 0xA0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x0B, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD1,
-    0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x7D, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xBC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x14, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3E, 0x7F, 0x7E, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3E, 0x7F, 0x3E, 0x04, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x47, 0xF0, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0xFE,
-    0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x3D, 0x02, 0xE0, 0x0F, 0x40, 0x0B, 0xE0, 0x2E, 0x02, 0xFC, 0x00, 0xBE, 0x02, 0xE0, 0x1F, 0x80,
-    0x02, 0x80, 0x2E, 0x00, 0xA0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x6A, 0xAA, 0xBF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xAA, 0xAA, 0xBF, 0xAA, 0xAA, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x2E, 0x00, 0x50, 0x00, 0x7E, 0x02, 0xE0,
-    0x2F, 0x40, 0x0B, 0xE0, 0x2E, 0x03, 0xF8, 0x00, 0x3D, 0x02, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0xBD,
-    0xFE, 0xBE, 0x24, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFE, 0xFE, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0xBE, 0xFE, 0xBD, 0x14, 0x00, 0xBD, 0xFE, 0xFE, 0x38, 0x00, 0x00, 0xBD, 0xFE, 0xFE, 0x28, 0x00,
-    0x14, 0xBD, 0xFE, 0xBE, 0x14, 0x00, 0x24, 0xBE, 0xFE, 0xBD, 0x14, 0x00, 0x00, 0x7F, 0xFD, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F,
-    0xFD, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00,
-    0x00, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x07, 0xD0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x2F, 0xF8, 0x3F, 0xFC, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x38, 0x2C, 0x38, 0x2C, 0x0B, 0xE0, 0x03,
-    0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0xF8, 0x00, 0xFF, 0xF0, 0x2E, 0x0B, 0xC3, 0xC0,
-    0x3C, 0x7C, 0x02, 0xD7, 0x80, 0x2E, 0x78, 0x01, 0xE7, 0x80, 0x1E, 0x7C, 0x02, 0xE3, 0xC0, 0x3D,
-    0x3E, 0x07, 0xC1, 0xFF, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xD2, 0x00, 0x71, 0xD7, 0x5D,
-    0x75, 0xD7, 0x5D, 0x74, 0x80, 0x00, 0x0A, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0x0E, 0xF0, 0x03,
-    0xCF, 0x00, 0xB4, 0xF0, 0x1E, 0x0F, 0x03, 0xC0, 0xF0, 0xBE, 0xAF, 0xAB, 0xFF, 0xFF, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x0A, 0xAA, 0x41, 0xFF, 0xF8, 0x2D, 0x00, 0x02, 0xC0, 0x00,
-    0x2C, 0x00, 0x03, 0xFF, 0xD0, 0x2E, 0xBF, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x10,
-    0x03, 0xC3, 0xEA, 0xF8, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0xF8, 0x0F, 0x40,
-    0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xAF, 0xF4, 0x7F, 0x9B, 0xC7, 0xC0, 0x2E, 0x78, 0x01, 0xE3,
-    0xC0, 0x1E, 0x3D, 0x03, 0xD0, 0xFA, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x93, 0xFF,
-    0xFD, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x03, 0xC0,
-    0x00, 0xB4, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0x02, 0xF9, 0x00,
-    0xFF, 0xF4, 0x3D, 0x03, 0xC3, 0xC0, 0x3C, 0x2E, 0x07, 0xC0, 0xFE, 0xF0, 0x07, 0xFE, 0x01, 0xF5,
-    0xF8, 0x3C, 0x03, 0xD7, 0x80, 0x2D, 0x3C, 0x03, 0xD2, 0xFA, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x06, 0xF8, 0x01, 0xFF, 0xF4, 0x3C, 0x07, 0xC7, 0x80, 0x2D, 0x78, 0x01, 0xE7, 0x80, 0x2E, 0x3E,
-    0x5B, 0xE1, 0xFF, 0xDD, 0x01, 0x52, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0x81, 0xAB, 0xF0, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xFF, 0xFF, 0x57, 0xD5, 0x03,
-    0x80, 0x03, 0x80, 0x02, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x55, 0x55, 0xAA, 0xAA, 0xFF, 0xFE, 0x00,
-    0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x40, 0x38, 0x0F, 0x01, 0xE0, 0x2C, 0x03, 0xC0,
-    0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x2D, 0x00, 0xE0, 0x0B, 0x00, 0x3C, 0x00,
-    0x00, 0x50, 0x0F, 0x01, 0xD0, 0x3C, 0x0B, 0x01, 0xD0, 0x38, 0x0F, 0x03, 0xC0, 0xE0, 0x38, 0x1D,
-    0x0B, 0x03, 0xC2, 0xD1, 0xE0, 0x00, 0x00, 0x71, 0xFE, 0x07, 0xF5, 0xB8, 0x7C, 0x02, 0xC7, 0x40,
-    0x1C, 0x74, 0x01, 0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC2, 0x00, 0x18,
-    0x02, 0xF8, 0x00, 0xFF, 0xF0, 0x2E, 0x0B, 0xC3, 0xC0, 0x3C, 0x7C, 0x02, 0xD7, 0x80, 0x2E, 0x78,
-    0x01, 0xE7, 0x80, 0x1E, 0x7C, 0x02, 0xE3, 0xC0, 0x3D, 0x3E, 0x07, 0xC1, 0xFF, 0xF4, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xA0, 0xBF, 0x3E, 0xFB, 0x4F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
-    0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x06, 0xF8, 0x0F, 0xFF, 0xD2, 0x80, 0xBC, 0x00, 0x0F,
-    0x00, 0x03, 0xC0, 0x02, 0xD0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xC0, 0x0B, 0xF9, 0x03, 0xFF, 0xF4, 0x24, 0x07, 0xC0, 0x00, 0x3C, 0x00,
-    0x07, 0xC0, 0x16, 0xF0, 0x0B, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03,
-    0xCB, 0xEA, 0xF8, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0x00,
-    0x0E, 0xF0, 0x03, 0xCF, 0x00, 0xB4, 0xF0, 0x1E, 0x0F, 0x03, 0xC0, 0xF0, 0xBE, 0xAF, 0xAB, 0xFF,
-    0xFF, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x0A, 0xAA, 0x41, 0xFF, 0xF8, 0x2D, 0x00,
-    0x02, 0xC0, 0x00, 0x2C, 0x00, 0x03, 0xFF, 0xD0, 0x2E, 0xBF, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xD0,
-    0x00, 0x3D, 0x10, 0x03, 0xC3, 0xEA, 0xF8, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F,
-    0xF8, 0x0F, 0x40, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xAF, 0xF4, 0x7F, 0x9B, 0xC7, 0xC0, 0x2E,
-    0x78, 0x01, 0xE3, 0xC0, 0x1E, 0x3D, 0x03, 0xD0, 0xFA, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0x93, 0xFF, 0xFD, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x3D,
-    0x00, 0x03, 0xC0, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
-    0x02, 0xF9, 0x00, 0xFF, 0xF4, 0x3D, 0x03, 0xC3, 0xC0, 0x3C, 0x2E, 0x07, 0xC0, 0xFE, 0xF0, 0x07,
-    0xFE, 0x01, 0xF5, 0xF8, 0x3C, 0x03, 0xD7, 0x80, 0x2D, 0x3C, 0x03, 0xD2, 0xFA, 0xFC, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFF, 0xF4, 0x3C, 0x07, 0xC7, 0x80, 0x2D, 0x78, 0x01, 0xE7,
-    0x80, 0x2E, 0x3E, 0x5B, 0xE1, 0xFF, 0xDD, 0x01, 0x52, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0x81, 0xAB,
-    0xF0, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xFF, 0xFF,
-    0x57, 0xD5, 0x03, 0x80, 0x03, 0x80, 0x02, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x55, 0x55, 0xAA, 0xAA,
-    0xFF, 0xFE, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x40, 0x38, 0x0F, 0x01, 0xE0,
-    0x2C, 0x03, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x2D, 0x00, 0xE0, 0x0B,
-    0x00, 0x3C, 0x00, 0x00, 0x50, 0x0F, 0x01, 0xD0, 0x3C, 0x0B, 0x01, 0xD0, 0x38, 0x0F, 0x03, 0xC0,
-    0xE0, 0x38, 0x1D, 0x0B, 0x03, 0xC2, 0xD1, 0xE0, 0x00, 0x00, 0x01, 0xA9, 0x00, 0xFA, 0xF8, 0x00,
-    0x03, 0xC0, 0x00, 0x2C, 0x02, 0xBF, 0xC1, 0xF5, 0x6C, 0x3C, 0x02, 0xC3, 0x80, 0x3C, 0x3D, 0x5F,
-    0xC0, 0xBF, 0x4C, 0x06, 0xE4, 0x0B, 0xAB, 0x87, 0x40, 0x76, 0xC0, 0x0E, 0xFF, 0xFF, 0xBD, 0x55,
-    0x5F, 0x00, 0x01, 0xD0, 0x00, 0x3E, 0x56, 0x41, 0xFF, 0x80, 0x06, 0xE4, 0x02, 0xFA, 0xF0, 0x78,
-    0x03, 0xCF, 0x00, 0x2C, 0xF0, 0x01, 0xDF, 0x00, 0x1D, 0xF0, 0x01, 0xD7, 0x40, 0x3C, 0x3E, 0x5F,
-    0x40, 0x7F, 0x80, 0x24, 0x01, 0x82, 0xC0, 0x38, 0x0F, 0x0F, 0x00, 0x3A, 0xC0, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x03, 0xAC, 0x00, 0xF0, 0xF0, 0x2C, 0x03, 0x87, 0x40, 0x1D, 0x06, 0xE8, 0x02, 0xEA,
-    0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1D, 0x00, 0x01, 0xE3, 0xFF, 0xFE, 0x3C, 0x00, 0xD2, 0xC0, 0x2C,
-    0x0F, 0x5B, 0x80, 0x2F, 0xD0, 0x20, 0x00, 0x07, 0x40, 0x00, 0x74, 0x00, 0x07, 0x40, 0x00, 0x75,
-    0xA9, 0x07, 0xBA, 0xF8, 0x7C, 0x03, 0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC7, 0x40, 0x1C, 0x74, 0x01,
-    0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC7, 0x00, 0x1C, 0x20, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xD0,
-    0x00, 0x74, 0x06, 0x1D, 0x07, 0x87, 0x47, 0x81, 0xD7, 0x80, 0x7B, 0xC0, 0x1F, 0xB4, 0x07, 0x4B,
-    0x41, 0xD0, 0xF0, 0x74, 0x0F, 0x1C, 0x01, 0xE0, 0x21, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7,
-    0x5D, 0x75, 0xC0, 0x21, 0xB8, 0x0A, 0x90, 0x7B, 0xAF, 0x7A, 0xF8, 0x7C, 0x03, 0xD0, 0x2C, 0x74,
-    0x03, 0xC0, 0x1C, 0x74, 0x03, 0x80, 0x1C, 0x74, 0x03, 0x80, 0x1C, 0x74, 0x03, 0x80, 0x1C, 0x74,
-    0x03, 0x80, 0x1C, 0x74, 0x03, 0x80, 0x1C, 0x70, 0x02, 0x80, 0x1C, 0x21, 0xB9, 0x07, 0xBA, 0xF8,
-    0x7C, 0x03, 0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC7, 0x40, 0x1C, 0x74,
-    0x01, 0xC7, 0x00, 0x1C, 0x21, 0xB9, 0x07, 0xBA, 0xF4, 0x7C, 0x03, 0xC7, 0x40, 0x1D, 0x74, 0x00,
-    0xE7, 0x40, 0x0E, 0x74, 0x01, 0xE7, 0xC0, 0x2C, 0x7E, 0x5B, 0x87, 0x6F, 0xD0, 0x74, 0x00, 0x07,
-    0x40, 0x00, 0x74, 0x00, 0x07, 0x40, 0x00, 0x06, 0xE9, 0x0B, 0xAB, 0x83, 0x80, 0x00, 0xF0, 0x00,
-    0x0F, 0xD0, 0x00, 0x6F, 0x40, 0x00, 0xF0, 0x00, 0x1C, 0x39, 0x5F, 0x0B, 0xFE, 0x00, 0x09, 0x00,
-    0x34, 0x02, 0xFA, 0x1B, 0xE8, 0x1D, 0x00, 0x74, 0x01, 0xD0, 0x07, 0x40, 0x1D, 0x00, 0x34, 0x00,
-    0xF5, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xD0,
-    0x14, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0xAA,
-    0xA9, 0xF8, 0x03, 0xFF, 0xFB, 0xE0, 0x0F, 0x95, 0x4F, 0xC0, 0x3D, 0x00, 0x2F, 0x00, 0xF4, 0x00,
-    0x3F, 0x03, 0xD0, 0x00, 0x7F, 0xAF, 0xAA, 0x80, 0x7F, 0xFF, 0xFF, 0x00, 0x05, 0xF9, 0x54, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0xE0, 0x00, 0x02,
-    0xC1, 0xD0, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xDB, 0xF8, 0x0B, 0xFB,
-    0x43, 0x90, 0x1F, 0xCB, 0x07, 0x40, 0x3F, 0x0F, 0x0B, 0x00, 0x3E, 0x0F, 0x0F, 0x00, 0x7D, 0x1E,
-    0x0F, 0x00, 0x7C, 0x1D, 0x0E, 0x00, 0xBC, 0x2C, 0x1D, 0x00, 0x7C, 0x3C, 0x2C, 0x00, 0x7C, 0x3C,
-    0x3C, 0x00, 0x3D, 0x78, 0x3C, 0x00, 0x3F, 0x74, 0x38, 0x00, 0x2F, 0xF0, 0x74, 0x00, 0x0F, 0xF0,
-    0xB0, 0x00, 0x07, 0xF9, 0xF0, 0x64, 0x01, 0xFF, 0xFF, 0xF4, 0x01, 0xEF, 0xFF, 0xE0, 0x02, 0xC1,
-    0xD0, 0x00, 0x03, 0xC2, 0xC0, 0x00, 0x02, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0x40, 0x6C, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x0A, 0x1B, 0xD7,
-    0xC0, 0x3E, 0xFF, 0x1F, 0x00, 0xFF, 0x44, 0x7C, 0x03, 0xF0, 0x01, 0xF4, 0x0F, 0x80, 0x03, 0xD0,
-    0x3D, 0x00, 0x0F, 0x80, 0xF4, 0x00, 0x2F, 0x03, 0xD0, 0x00, 0x7E, 0x0F, 0x40, 0x00, 0xFD, 0x3D,
-    0x00, 0x00, 0xFD, 0xF4, 0x14, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x05, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x3E, 0x55, 0x55, 0x00, 0xF4, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xD0,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1B, 0xFE, 0xA8, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x7F, 0x40, 0x74,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x2A, 0xFE, 0xAA, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x15, 0xF9, 0x55, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xD5, 0x55, 0x54,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x64,
-    0x2F, 0xE4, 0x3E, 0xFE, 0x42, 0xF3, 0xFF, 0xF9, 0xFF, 0xFF, 0x8B, 0xFE, 0x57, 0xFF, 0xD5, 0x7F,
-    0x6F, 0xC0, 0x03, 0xFC, 0x00, 0x3E, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0xF4, 0x00, 0x2F, 0x00,
-    0x02, 0xFB, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xBC, 0x00, 0x2F,
-    0xC0, 0x00, 0xBE, 0xF0, 0x00, 0xFF, 0x00, 0x02, 0xFB, 0xC0, 0x0B, 0xFC, 0x00, 0x0B, 0xEF, 0x00,
-    0x3E, 0xF0, 0x00, 0x2F, 0xBC, 0x01, 0xEB, 0xC0, 0x00, 0xBE, 0xF0, 0x0F, 0x2F, 0x00, 0x02, 0xFB,
-    0xC0, 0x78, 0xBC, 0x00, 0x0B, 0xEF, 0x03, 0xC2, 0xF0, 0x00, 0x2F, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0x3C, 0x00, 0x7F, 0x40, 0x0F, 0x00, 0x1F,
-    0xF0, 0x03, 0xC0, 0x07, 0xBD, 0x00, 0xF0, 0x01, 0xEB, 0x80, 0x3C, 0x00, 0x7D, 0xF0, 0x0F, 0x01,
-    0xBF, 0xBE, 0xAB, 0xE8, 0xBF, 0xFF, 0xFF, 0xFF, 0x46, 0xF5, 0xF5, 0x7D, 0x40, 0x7C, 0x3E, 0x0F,
-    0x01, 0x6F, 0x5B, 0xD7, 0xD4, 0xBF, 0xFF, 0xFF, 0xFF, 0x5A, 0xFA, 0xBF, 0xBE, 0x80, 0x7C, 0x07,
-    0xCF, 0x00, 0x1F, 0x00, 0xF7, 0xC0, 0x07, 0xC0, 0x2F, 0xF0, 0x01, 0xF0, 0x03, 0xFC, 0x00, 0x7C,
-    0x00, 0xFF, 0x00, 0x1F, 0x00, 0x2F, 0xC0, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xBF, 0xF9, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFD, 0x6F, 0xF4, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x0B, 0x00, 0xFC,
-    0x00, 0x3D, 0x0F, 0x00, 0xFC, 0x00, 0xBC, 0x1F, 0x00, 0xFC, 0x01, 0xFD, 0xFF, 0xFC, 0xFD, 0x6F,
-    0xF2, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x1F, 0x00, 0xFF, 0xF9, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x0F, 0xFE,
-    0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x5B, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x1F, 0x80, 0x00, 0x00,
-    0xBC, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x6F, 0xE0, 0xBC, 0x00, 0xBC, 0x1F, 0xFF,
-    0xCB, 0xC0, 0x0B, 0xC3, 0xE4, 0x74, 0xBC, 0x00, 0xF8, 0x7C, 0x00, 0x0B, 0xC0, 0x2F, 0x07, 0xC0,
-    0x00, 0xBF, 0xFF, 0xD0, 0x7E, 0x00, 0x0B, 0xFF, 0xF4, 0x03, 0xF8, 0x00, 0xBD, 0x6F, 0x00, 0x0F,
-    0xF4, 0x0B, 0xC0, 0xF8, 0x00, 0x2F, 0xF0, 0xBC, 0x0B, 0xC0, 0x00, 0x3F, 0x8B, 0xC0, 0x3E, 0x00,
-    0x00, 0xFC, 0xBC, 0x02, 0xF0, 0x00, 0x07, 0xCB, 0xC0, 0x1F, 0x40, 0x00, 0x7C, 0xBC, 0x00, 0xFC,
-    0x90, 0x0F, 0xCB, 0xC0, 0x07, 0xDB, 0xFF, 0xF4, 0xBC, 0x00, 0x3E, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x7C, 0x3C, 0x00, 0xFD, 0x00, 0x7C, 0x3C, 0x00, 0xFE,
-    0x00, 0xB8, 0x3D, 0x00, 0xFF, 0x00, 0xF4, 0x2E, 0x01, 0xEF, 0x00, 0xF4, 0x2E, 0x02, 0xDF, 0x00,
-    0xF0, 0x1F, 0x02, 0xDB, 0x41, 0xF0, 0x0F, 0x03, 0xC7, 0x81, 0xF0, 0x0F, 0x03, 0xC7, 0x82, 0xE0,
-    0x6F, 0xAB, 0xEB, 0xEB, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1B, 0xDF, 0x97, 0xE7, 0xD4, 0x07,
-    0xCB, 0x42, 0xD3, 0xC0, 0x03, 0xCF, 0x01, 0xE3, 0xC0, 0x03, 0xCF, 0x00, 0xE7, 0x80, 0x03, 0xDE,
-    0x00, 0xF7, 0x40, 0x02, 0xEE, 0x00, 0xFB, 0x40, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00,
-    0xBF, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xA0, 0x00,
-    0x7E, 0xFF, 0xFF, 0xF4, 0x01, 0xFB, 0xC0, 0x07, 0xF4, 0x07, 0xEF, 0x00, 0x03, 0xF0, 0x1F, 0xBC,
-    0x00, 0x07, 0xC0, 0x7E, 0xF0, 0x28, 0x0F, 0x41, 0xFB, 0xC0, 0xF0, 0x3D, 0x07, 0xEF, 0x03, 0xC0,
-    0xF4, 0x1F, 0xBC, 0x0F, 0x03, 0xD0, 0x7E, 0xF0, 0x3C, 0x0F, 0x41, 0xFB, 0xC0, 0xF0, 0x3D, 0x07,
-    0xEF, 0x03, 0xC0, 0xF4, 0x1F, 0xBC, 0x0F, 0x03, 0xD0, 0x7E, 0xF0, 0x3C, 0x0F, 0x41, 0xFB, 0xC0,
-    0xF0, 0x3D, 0x07, 0xEF, 0x03, 0xC0, 0xA4, 0x2F, 0xBC, 0x0F, 0x00, 0x00, 0xFA, 0xF0, 0x3C, 0x00,
-    0x07, 0xDB, 0xC0, 0xF0, 0x00, 0xBF, 0x2F, 0x03, 0xFF, 0xFF, 0xF0, 0xBC, 0x0F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2A, 0xAB,
-    0xF9, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x01, 0x55, 0x7E, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xBE,
-    0x43, 0xD0, 0x03, 0xFF, 0xFC, 0xF4, 0x03, 0xFD, 0x5B, 0xFD, 0x01, 0xF8, 0x00, 0x7F, 0x40, 0xFC,
-    0x00, 0x0B, 0xD0, 0x3E, 0x00, 0x01, 0xF4, 0x1F, 0x40, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x0F, 0x41,
-    0xF4, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x1F,
-    0x40, 0xBC, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x0B, 0xF4, 0x01, 0xFF, 0xFF, 0x7D, 0x00, 0x1F, 0xFF,
-    0x4B, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x1A, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0x41, 0xB8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x17, 0xE5, 0x55, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x02, 0xBF, 0xAA, 0xA4, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x28, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0xF4, 0x00,
-    0x2F, 0x40, 0x3D, 0x00, 0x1F, 0x40, 0x0F, 0x40, 0x0F, 0x80, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF4,
-    0x0B, 0xC0, 0x00, 0x3D, 0x0B, 0xD0, 0x00, 0x0F, 0x47, 0xD0, 0x00, 0x03, 0xD3, 0xE0, 0x00, 0x1A,
-    0xFF, 0xFA, 0xAA, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x5F, 0xFB, 0xD5, 0x40, 0x03, 0xF0, 0xF8, 0x00,
-    0x00, 0xF4, 0x1F, 0x40, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x07,
-    0xD0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x0F, 0x40, 0x01, 0xF8, 0x03, 0xD0,
-    0x00, 0x2F, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x7F, 0x55, 0x50,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x28, 0x00, 0x00, 0x3E, 0x7F,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFE,
-    0x05, 0x00, 0x0F, 0xDF, 0x8F, 0xC0, 0x03, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFB, 0xE0, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00,
-    0x10, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x2D, 0x40, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x6A, 0x40, 0x03, 0xE0, 0x00, 0x3F, 0x02, 0xFF, 0xF0, 0x03,
-    0xD0, 0x00, 0x3E, 0x0B, 0xE6, 0xFC, 0x07, 0xC0, 0x00, 0xBC, 0x0F, 0x40, 0x7C, 0x07, 0xC0, 0x01,
-    0xF8, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x07, 0xF0, 0x3E, 0x00, 0x7C, 0x0F, 0x80, 0x2F, 0xC0, 0x3D,
-    0x00, 0xBC, 0x0F, 0x96, 0xFF, 0x00, 0x7E, 0x02, 0xF4, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0,
-    0x2F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x03, 0xD0, 0x7C,
-    0x00, 0x03, 0xD0, 0x7C, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x02, 0xF0, 0xF4, 0x00, 0x01, 0xF0, 0xF0,
-    0x00, 0x00, 0xF5, 0xE0, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x40, 0x3F, 0x00, 0x00, 0xC0, 0x7F, 0x40, 0x02, 0xF0, 0xFF, 0xC0, 0x03, 0xF6, 0xE7, 0xC0,
-    0x0F, 0xFF, 0xC3, 0xE0, 0x1F, 0x3F, 0x82, 0xF0, 0x3E, 0x0F, 0x00, 0xF4, 0x7C, 0x09, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0xE4, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3D, 0x56, 0xFD, 0x00, 0x0F, 0x40, 0x1F, 0xC0, 0x6B, 0xFA, 0xAB,
-    0xFA, 0x6F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3D, 0x00, 0x0F, 0x80, 0x0F, 0x40, 0x03, 0xE0, 0x6B, 0xEA,
-    0xAA, 0xFA, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3D, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x7F, 0x40, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x9F, 0x1B, 0xC0, 0x0F, 0xE0,
-    0x3C, 0x00, 0x00, 0xBE, 0x00, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xC0, 0x00, 0x2F, 0x40, 0x0F, 0x00,
-    0x00, 0xFC, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xC0, 0x00, 0x3E,
-    0x00, 0x0F, 0xFF, 0xF0, 0xF8, 0x00, 0x3F, 0xFF, 0xC3, 0xE0, 0x00, 0xF5, 0x6F, 0x0F, 0xC0, 0x03,
-    0xC0, 0xBC, 0x2F, 0x00, 0x0F, 0x02, 0xF0, 0x7E, 0x00, 0x3C, 0x0B, 0xC0, 0xFD, 0x00, 0xF0, 0x2F,
-    0x01, 0xFD, 0x03, 0xC0, 0xBC, 0x02, 0xFE, 0x5F, 0x06, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0x7F, 0x00, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x00, 0x3F, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0xF4, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x2F, 0x02, 0xF0,
-    0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xE4, 0x1B,
-    0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01,
-    0xF4, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xF4,
-    0x00, 0x02, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x1F, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xE4, 0x01,
-    0xB8, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFD, 0x01, 0xFF,
-    0xAD, 0x6F, 0x00, 0xFE, 0x0B, 0x40, 0x00, 0xFD, 0x02, 0xD0, 0x00, 0x7F, 0x00, 0xB4, 0x00, 0x2F,
-    0x40, 0x2D, 0x00, 0x0F, 0xC0, 0x0B, 0x40, 0x03, 0xE0, 0x02, 0xD0, 0x00, 0xF8, 0x00, 0xB4, 0x00,
-    0x3E, 0x00, 0x2D, 0x00, 0x0F, 0x80, 0x0B, 0x40, 0x03, 0xE0, 0x02, 0xD0, 0x00, 0xFC, 0x00, 0xB4,
-    0x00, 0x2F, 0x00, 0x2D, 0x00, 0x07, 0xE0, 0x0B, 0x40, 0x00, 0xFC, 0x02, 0xD0, 0x00, 0x1F, 0xC0,
-    0xB4, 0x00, 0x02, 0xFE, 0x6D, 0x1A, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x1D, 0x00, 0x74, 0x00, 0x02, 0xD0, 0x0B, 0x40, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x0B, 0xFA,
-    0xAF, 0xEA, 0x87, 0xFF, 0xFF, 0xFF, 0xFC, 0x17, 0xE5, 0xAF, 0x95, 0x40, 0x3D, 0x01, 0xF4, 0x00,
-    0x03, 0xD0, 0x1F, 0x40, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x3D, 0x01,
-    0xF4, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00,
-    0x3D, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x0B,
-    0xFF, 0xC0, 0x3D, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0xFD, 0x01, 0xBC, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1A, 0x0A, 0x82, 0xA0, 0x3E, 0x3B, 0xBA, 0xEE, 0xBC, 0x2F,
-    0x73, 0xD0, 0xF4, 0x2C, 0x2E, 0x3B, 0xC0, 0xB0, 0x1C, 0x3D, 0x1F, 0xC0, 0xB0, 0x1D, 0xFC, 0x07,
-    0xFE, 0xF5, 0x6F, 0xF0, 0x02, 0xEF, 0xFF, 0xFF, 0x40, 0x02, 0xC0, 0xB5, 0x6C, 0x00, 0x02, 0xC0,
-    0xB0, 0x1C, 0x00, 0x00, 0x40, 0x10, 0x04, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x15, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x2F, 0xFF, 0xFF, 0xDB,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xFF, 0x80, 0x02,
-    0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x01, 0x00, 0x01, 0xF0, 0x2F,
-    0x00, 0x01, 0xFB, 0xFE, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x7A, 0xF0, 0x1B,
-    0x00, 0x01, 0xFA, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x7E, 0xF0, 0x00,
-    0x2F, 0x01, 0xF0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7D, 0x01, 0xF0, 0x00,
-    0xBC, 0x01, 0xF0, 0x01, 0xF8, 0x01, 0xF0, 0x07, 0xF0, 0x01, 0xF4, 0x6F, 0xC0, 0x01, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x00, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0xB4, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xE5, 0xF9, 0x55, 0x55,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xAF, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x3C, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x40, 0x00, 0x2C, 0x00, 0x0F,
-    0x0F, 0x47, 0x80, 0xB0, 0x00, 0x3D, 0xFF, 0xBF, 0x82, 0xC0, 0x00, 0xFF, 0x5F, 0xCB, 0xEE, 0x00,
-    0x03, 0xF4, 0x1C, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x04, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1B,
-    0xF9, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xBF, 0xBF, 0xF0, 0x02, 0xFD, 0x0B,
-    0xC0, 0xBF, 0x00, 0xFC, 0x02, 0xF0, 0x0B, 0xE0, 0xBC, 0x00, 0xBC, 0x00, 0xFC, 0x3F, 0x00, 0x2F,
-    0x00, 0x1F, 0x4F, 0x80, 0x0B, 0xC0, 0x03, 0xE3, 0xD0, 0x02, 0xF0, 0x00, 0xF9, 0xF4, 0x00, 0xBC,
-    0x00, 0x3E, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00,
-    0x00, 0xF9, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xF9,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xE5, 0x5B, 0xF8, 0x03, 0xD0, 0x00, 0xFD, 0x03, 0xD0, 0x00,
-    0x3E, 0x03, 0xD0, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x3E, 0x03, 0xD0, 0x00,
-    0x7D, 0x03, 0xD0, 0x01, 0xFC, 0x6B, 0xFE, 0xBF, 0xF0, 0xBF, 0xFF, 0xFF, 0x80, 0x6B, 0xFA, 0x94,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF4,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x40, 0x00, 0x00, 0x02, 0xC1, 0xD0, 0x00, 0x00, 0x03, 0xEA, 0xD0, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x03, 0xFB, 0xC1, 0xEF, 0xD0, 0x0B,
-    0xD2, 0xC1, 0xD3, 0xF0, 0x0F, 0x82, 0xC1, 0xD0, 0xF8, 0x2F, 0x42, 0xC1, 0xD0, 0xBC, 0x3F, 0x02,
-    0xC1, 0xD0, 0x7D, 0x3F, 0x02, 0xC1, 0xD0, 0x3E, 0x3E, 0x02, 0xC1, 0xD0, 0x3E, 0x3E, 0x02, 0xC1,
-    0xD0, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xD1, 0xC0, 0x00, 0x1D, 0x2D, 0x00, 0x01, 0xD2, 0xD0, 0x03, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xE5, 0x6F, 0xF4, 0x3D, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0xFC,
-    0x3D, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0xFC, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x07, 0xF0, 0x3F, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x3E, 0x01, 0xBF, 0x43, 0xD0, 0x00, 0xFC, 0x3D, 0x00, 0x07, 0xD3,
-    0xD0, 0x00, 0x3E, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x7D, 0x3D, 0x00, 0x0F, 0xC3, 0xE0, 0x17,
-    0xF8, 0x3F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x40, 0x01, 0xD2, 0xD0, 0x00, 0x1D, 0x2D, 0x00, 0x01,
-    0xD1, 0xD0, 0x00, 0x00, 0x6F, 0xF8, 0x03, 0xFF, 0xFE, 0x0F, 0xF5, 0x6D, 0x2F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x05, 0x07, 0xFF, 0xFE,
-    0x00, 0xBF, 0xFD, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x15,
-    0x55, 0x54, 0x15, 0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE9, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x86, 0xE0, 0x2F,
-    0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+static const uint8_t notosans_14_regularBitmaps[30980] = {
+    0x95, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0x07, 0xB3, 0x42, 0x53, 0x0C, 0x85, 0x11,
+    0x11, 0x11, 0xD9, 0x96, 0x20, 0xEE, 0xF6, 0x1F, 0xB8, 0xBD, 0xDD, 0x90, 0x82, 0x82, 0x02, 0x17,
+    0x39, 0x21, 0x91, 0x86, 0xBF, 0x80, 0xB4, 0x29, 0xF6, 0x7C, 0x9B, 0xA4, 0xA0, 0x48, 0x81, 0x0B,
+    0xE8, 0x29, 0x68, 0x70, 0x93, 0xC6, 0x48, 0x2E, 0xCE, 0xBE, 0x49, 0x28, 0x52, 0x50, 0x30, 0x8A,
+    0x14, 0x5A, 0x56, 0x10, 0x81, 0x42, 0x93, 0x71, 0x98, 0x48, 0x4B, 0x38, 0xDF, 0xF0, 0xCD, 0xDE,
+    0x3A, 0xB6, 0x00, 0x21, 0xB1, 0xB6, 0xF7, 0xED, 0xBC, 0x79, 0xF3, 0xCD, 0xFB, 0xF1, 0xBD, 0xE7,
+    0x83, 0x83, 0x83, 0xE9, 0xB4, 0xAA, 0xAA, 0xD1, 0xFA, 0x01, 0x36, 0x0F, 0x57, 0x07, 0x9B, 0x63,
+    0xF9, 0xFD, 0xCD, 0xDF, 0xCD, 0xDC, 0x0D, 0xF3, 0xE4, 0xF6, 0xA5, 0x9F, 0xF4, 0xF5, 0x8F, 0x5F,
+    0x41, 0xAC, 0xDF, 0x04, 0x14, 0xF6, 0x80, 0x91, 0xD0, 0x88, 0x1A, 0x05, 0xC8, 0xFA, 0x3A, 0x90,
+    0x47, 0x0D, 0x76, 0x9F, 0xDF, 0xF9, 0x4D, 0x78, 0xEF, 0x97, 0x1B, 0xD7, 0x26, 0xCF, 0xB6, 0xB0,
+    0x9F, 0x68, 0xC4, 0xE6, 0xC2, 0xA9, 0x79, 0xC4, 0x3D, 0xDF, 0x19, 0x60, 0x40, 0x73, 0x58, 0x59,
+    0x42, 0xE8, 0x51, 0x30, 0xB0, 0xC0, 0xF5, 0x13, 0xF3, 0xEE, 0x19, 0xF0, 0x8F, 0xA7, 0x5E, 0x7F,
+    0x8C, 0xC4, 0x7B, 0x3D, 0x5B, 0x79, 0x61, 0xF7, 0x36, 0xD5, 0xBB, 0x06, 0x39, 0x0F, 0x2D, 0x07,
+    0x88, 0x8F, 0xF7, 0x10, 0xFB, 0x06, 0x91, 0x3F, 0x06, 0x8A, 0x15, 0xF0, 0xCD, 0x8A, 0xA7, 0x97,
+    0x90, 0x97, 0x2C, 0x06, 0xF2, 0x5E, 0xB9, 0xB7, 0xAD, 0xFE, 0xF4, 0xB6, 0xF0, 0x2B, 0x6C, 0x1C,
+    0x96, 0x1D, 0x54, 0x6C, 0x80, 0x97, 0x7B, 0x74, 0x2C, 0x6A, 0x5C, 0x40, 0xBA, 0x80, 0x30, 0xC2,
+    0x38, 0xEC, 0xA3, 0x4A, 0x6A, 0x85, 0xA4, 0x1E, 0xC5, 0x0D, 0xF6, 0x83, 0x4B, 0xB2, 0x1E, 0xC9,
+    0x9A, 0x9F, 0x77, 0x6D, 0xD0, 0xE6, 0xE7, 0xEB, 0x51, 0xF2, 0xE9, 0x7D, 0x7F, 0xD9, 0x38, 0xE7,
+    0xAA, 0xD4, 0x0F, 0x2F, 0x08, 0x33, 0xBB, 0x75, 0x2F, 0x38, 0xBB, 0x9F, 0x47, 0x16, 0x4A, 0x98,
+    0x14, 0x71, 0x13, 0x3E, 0xAB, 0x10, 0x82, 0x2A, 0x87, 0x71, 0xC3, 0x85, 0x1D, 0x21, 0x87, 0x7A,
+    0xA2, 0x09, 0x55, 0xD8, 0x70, 0xED, 0xAB, 0xFD, 0xF5, 0xE9, 0x2A, 0xBC, 0x3C, 0x75, 0x4A, 0x1F,
+    0x02, 0x89, 0x56, 0xCC, 0xA5, 0x8D, 0xB9, 0xAE, 0xB0, 0xA4, 0xB2, 0x9E, 0x02, 0x91, 0xE3, 0x0E,
+    0xB2, 0x60, 0x99, 0x30, 0x46, 0x48, 0x5F, 0x46, 0x5B, 0xEA, 0xE7, 0x16, 0x4B, 0xD9, 0x14, 0x75,
+    0x2E, 0xAC, 0x68, 0xB3, 0xC8, 0xA1, 0xF8, 0xAC, 0xAE, 0x20, 0xBC, 0x4E, 0x4B, 0x14, 0x46, 0xD0,
+    0x97, 0x16, 0x8B, 0xF2, 0x9A, 0xAF, 0x95, 0xF7, 0xF7, 0xF8, 0xE9, 0xCB, 0xAC, 0xC6, 0x16, 0x8F,
+    0x8F, 0xC7, 0x79, 0x9E, 0x0F, 0xDE, 0x39, 0x87, 0x3D, 0xA9, 0xF3, 0xD8, 0xAA, 0x72, 0x2E, 0x1A,
+    0x55, 0x56, 0xB1, 0x95, 0xBA, 0xC0, 0x52, 0x58, 0xA5, 0x33, 0xCC, 0x23, 0x27, 0x4C, 0xF8, 0x18,
+    0x63, 0x0E, 0x17, 0xD9, 0x68, 0x67, 0xC8, 0x58, 0xA4, 0x16, 0x26, 0xB6, 0xBC, 0xAA, 0xA5, 0xB6,
+    0xC2, 0x94, 0x31, 0x8D, 0xFB, 0x9F, 0x9C, 0xAB, 0x8A, 0xDA, 0x96, 0x07, 0xAD, 0x30, 0x52, 0xA7,
+    0xB8, 0xD8, 0x05, 0x48, 0x6B, 0xA4, 0x94, 0x21, 0x42, 0x24, 0x3B, 0xF6, 0x93, 0xC5, 0x13, 0xFF,
+    0xCB, 0xC2, 0x3F, 0x46, 0xA1, 0x21, 0x0F, 0x11, 0x1D, 0xD1, 0x71, 0xA5, 0xA5, 0xD9, 0xC6, 0xB9,
+    0xB8, 0xC4, 0xC6, 0x69, 0xC1, 0x43, 0x95, 0x58, 0x61, 0x2E, 0xA3, 0xC9, 0x1F, 0x93, 0x8C, 0x5C,
+    0x99, 0x79, 0xE6, 0xE9, 0x1F, 0xBB, 0xDD, 0x72, 0x23, 0x79, 0x60, 0x97, 0x79, 0x9A, 0xDC, 0xD4,
+    0x7E, 0xE9, 0x97, 0x93, 0x2B, 0x1D, 0x69, 0x01, 0xC7, 0x84, 0xD2, 0x39, 0x4A, 0x19, 0x24, 0x0B,
+    0x41, 0x99, 0x07, 0xA9, 0x6A, 0xCA, 0xB8, 0x93, 0x55, 0x27, 0x4B, 0x4A, 0xD1, 0x04, 0x39, 0x5F,
+    0x57, 0x26, 0xF6, 0x06, 0x85, 0x6F, 0x84, 0x93, 0x26, 0x2D, 0x95, 0x5E, 0x42, 0x5D, 0x6E, 0x30,
+    0x66, 0x72, 0xE7, 0x3C, 0xF0, 0x94, 0x6C, 0xF8, 0x4E, 0x23, 0xCD, 0x58, 0xA7, 0x39, 0xA2, 0xB0,
+    0xBC, 0xCF, 0x65, 0xD8, 0xCD, 0x21, 0x2C, 0x8D, 0x6F, 0x38, 0xCC, 0x79, 0xB6, 0x21, 0xCB, 0x3B,
+    0x7A, 0x76, 0x15, 0x4F, 0xCB, 0xD4, 0x64, 0xAE, 0x98, 0x16, 0xEA, 0x7D, 0x61, 0xE8, 0x15, 0x39,
+    0x51, 0xFE, 0xC7, 0x47, 0x70, 0x23, 0xF1, 0x86, 0xDD, 0xD2, 0xA8, 0x26, 0x6D, 0xCE, 0x91, 0x23,
+    0x01, 0x03, 0x08, 0xA4, 0x60, 0x42, 0x19, 0x4C, 0x88, 0x2E, 0xB0, 0x85, 0xDA, 0xA8, 0xA5, 0xA8,
+    0xFF, 0x4D, 0x3C, 0x9C, 0x5C, 0x59, 0x78, 0xFF, 0x94, 0xFD, 0xA6, 0xD1, 0xF1, 0xC7, 0xC4, 0x4C,
+    0xA5, 0x32, 0xE7, 0x9B, 0xCD, 0x0E, 0xE3, 0x0C, 0x64, 0xA0, 0xDF, 0x92, 0x84, 0xAC, 0xB1, 0x20,
+    0xDF, 0x26, 0xEC, 0x0E, 0x64, 0xDC, 0x2D, 0x78, 0x6C, 0xBE, 0xBE, 0x29, 0xF8, 0xB0, 0x7D, 0x11,
+    0xD2, 0x12, 0x92, 0xAC, 0x62, 0xE3, 0x75, 0x7E, 0x06, 0xB5, 0xE4, 0x76, 0x42, 0xD6, 0x8A, 0x27,
+    0x34, 0xFD, 0x95, 0x48, 0x47, 0x54, 0xB8, 0x0A, 0x68, 0xC9, 0x80, 0x8A, 0xA5, 0x08, 0x7D, 0x31,
+    0x66, 0xA2, 0x33, 0x52, 0x22, 0x0D, 0x64, 0x2F, 0x23, 0xCB, 0xAE, 0xF6, 0x47, 0x61, 0x14, 0xBC,
+    0x36, 0xB9, 0xFA, 0x70, 0xED, 0x04, 0x2D, 0xD6, 0xA4, 0xE1, 0x11, 0xB2, 0xB7, 0x0C, 0xCD, 0xFB,
+    0x7C, 0xF7, 0x2B, 0x8E, 0x19, 0x72, 0xA8, 0xDB, 0x0D, 0x56, 0xDC, 0x44, 0x76, 0x67, 0x87, 0x3E,
+    0xB4, 0xF8, 0xFA, 0x2A, 0xE3, 0x14, 0xA4, 0x9A, 0xE8, 0xD3, 0x92, 0xAD, 0x1D, 0x66, 0x45, 0x91,
+    0x5D, 0xAE, 0xE3, 0x25, 0x61, 0x74, 0xEA, 0x69, 0xB0, 0xD5, 0x37, 0x1E, 0xDB, 0x49, 0xFA, 0xD0,
+    0x21, 0x48, 0x9A, 0x2E, 0x8B, 0x67, 0x12, 0x0A, 0x37, 0x6B, 0xC4, 0x8F, 0xDE, 0xA5, 0x2E, 0x71,
+    0x33, 0x88, 0xA3, 0x16, 0x32, 0x54, 0xF7, 0x83, 0x12, 0x79, 0x20, 0xCF, 0x1C, 0xF2, 0xAE, 0xC3,
+    0x38, 0x76, 0x89, 0x65, 0x75, 0xCB, 0x38, 0xC0, 0x92, 0x6C, 0x7D, 0x8A, 0x7F, 0xD8, 0xDD, 0x5D,
+    0x10, 0xA2, 0x5D, 0x3B, 0x58, 0xAC, 0x3B, 0x20, 0x64, 0x67, 0xDA, 0xE7, 0xAF, 0x3E, 0xF5, 0xAC,
+    0xB7, 0x33, 0x7F, 0xB7, 0x13, 0xF6, 0x84, 0x83, 0x0D, 0x66, 0xDE, 0x26, 0xBC, 0x29, 0xA3, 0x59,
+    0x0B, 0x75, 0x8B, 0x1C, 0x94, 0x3A, 0x72, 0xAA, 0x56, 0x75, 0xFA, 0xA0, 0x65, 0xA5, 0xCA, 0x30,
+    0xF4, 0x92, 0x67, 0x1E, 0xDB, 0x98, 0x11, 0xB4, 0x60, 0xDE, 0xE6, 0x27, 0x94, 0x24, 0x83, 0x95,
+    0x89, 0x1D, 0x83, 0xAF, 0xE5, 0x99, 0xE0, 0x63, 0x96, 0x77, 0xE6, 0x4D, 0xE2, 0x52, 0x53, 0x30,
+    0x66, 0x07, 0xF5, 0x9E, 0x46, 0xD6, 0x73, 0x99, 0x35, 0x93, 0xDF, 0xF2, 0x5A, 0xD9, 0x24, 0xCC,
+    0xDA, 0xCA, 0x4A, 0x7F, 0x5B, 0x9F, 0xBA, 0xBA, 0x0E, 0x29, 0x26, 0xD6, 0x8C, 0x83, 0xA5, 0xED,
+    0x06, 0x6E, 0x68, 0x5A, 0x4C, 0x57, 0xAB, 0xEA, 0x64, 0xA6, 0xF6, 0xDD, 0x57, 0xA9, 0x66, 0x95,
+    0x68, 0x9C, 0x79, 0xAE, 0xB0, 0x8F, 0xD4, 0x0D, 0x9B, 0x09, 0xF3, 0x56, 0x3F, 0x04, 0xB9, 0x1F,
+    0x79, 0x82, 0x19, 0xA4, 0x6C, 0xD6, 0x16, 0x11, 0xF1, 0x38, 0xA7, 0x30, 0xDB, 0x41, 0xD0, 0x20,
+    0x09, 0x53, 0x6F, 0xC1, 0x04, 0x65, 0x7D, 0xC5, 0xA3, 0x75, 0x53, 0x78, 0xDF, 0x4D, 0x83, 0x17,
+    0xCF, 0x6B, 0x93, 0xC9, 0x87, 0x54, 0xBE, 0xBD, 0xBB, 0xFB, 0x25, 0xE9, 0xC8, 0xE1, 0x1D, 0xC0,
+    0x10, 0x87, 0xD3, 0x33, 0xC2, 0xA5, 0xBD, 0x82, 0xDC, 0x46, 0xCA, 0x00, 0x8F, 0x03, 0x70, 0x97,
+    0x06, 0x83, 0xF8, 0x11, 0xF0, 0x52, 0x0F, 0xC3, 0xD6, 0x98, 0xF9, 0x36, 0x8F, 0x8E, 0x3B, 0x1E,
+    0x64, 0xDD, 0xEF, 0x38, 0x94, 0x84, 0x7D, 0x24, 0x9B, 0xE0, 0x19, 0xAB, 0xB3, 0xDF, 0x4D, 0xB3,
+    0x17, 0x97, 0x6F, 0x05, 0xD4, 0x78, 0xD9, 0x61, 0x87, 0x04, 0xBF, 0xF1, 0x3C, 0x78, 0xE0, 0x99,
+    0x1C, 0x64, 0x8F, 0x22, 0x72, 0xE1, 0x20, 0xD4, 0x35, 0x94, 0x3E, 0xB6, 0x5D, 0x3A, 0x9C, 0x2A,
+    0xD9, 0x60, 0x55, 0x8A, 0xC5, 0x1D, 0x3D, 0x1A, 0x70, 0x60, 0xEA, 0xC1, 0x88, 0xFF, 0x7E, 0xC2,
+    0x5B, 0x0B, 0x3D, 0x64, 0xA3, 0x24, 0x7A, 0xF0, 0xE2, 0x2D, 0xF5, 0x88, 0x7A, 0xA5, 0xAB, 0x91,
+    0xB0, 0x43, 0xE3, 0x72, 0x78, 0xE7, 0x9B, 0x8C, 0xAE, 0x0C, 0xCB, 0x7E, 0x42, 0x98, 0xAE, 0xA6,
+    0x6D, 0x97, 0xCF, 0xC5, 0x17, 0x57, 0x03, 0x8F, 0x7D, 0x98, 0x38, 0xF8, 0xE8, 0x73, 0xFC, 0xEF,
+    0xE7, 0x2F, 0xBD, 0x55, 0x3D, 0x6E, 0xDC, 0x46, 0x14, 0x7E, 0x9C, 0x81, 0xCD, 0x82, 0xC5, 0x34,
+    0x46, 0x9A, 0x14, 0x3C, 0x02, 0x2F, 0xE0, 0xF9, 0x09, 0x7C, 0x00, 0xAB, 0x59, 0x37, 0xBA, 0x40,
+    0x80, 0x14, 0xBA, 0x80, 0xB4, 0xBB, 0x40, 0x0E, 0x60, 0xDD, 0xC0, 0x2E, 0x54, 0xD9, 0x85, 0x5B,
+    0x15, 0x94, 0x97, 0xC6, 0x96, 0x29, 0x34, 0xC1, 0x96, 0x6E, 0x16, 0x58, 0x0B, 0x29, 0x33, 0xB0,
+    0x09, 0x98, 0x8B, 0x70, 0x39, 0xFE, 0xDE, 0x70, 0xE5, 0x18, 0x96, 0xA0, 0xC4, 0x80, 0x13, 0x2E,
+    0x1E, 0xF7, 0x9B, 0xBF, 0x37, 0xEF, 0x7D, 0xEF, 0x87, 0x44, 0x1D, 0x11, 0xE5, 0x01, 0x2F, 0xEB,
+    0xF1, 0xFA, 0xAB, 0x21, 0x2A, 0x2E, 0x01, 0x8C, 0x21, 0xCA, 0x42, 0x4D, 0xA4, 0x9A, 0x96, 0x48,
+    0xCB, 0x40, 0x22, 0xE4, 0x0D, 0xA9, 0xB9, 0x9A, 0xD3, 0x09, 0x55, 0x24, 0x62, 0xDC, 0x91, 0x8A,
+    0xB1, 0xA3, 0xE9, 0x8B, 0x97, 0x01, 0xCB, 0xD2, 0x97, 0x0E, 0x9B, 0x71, 0xA2, 0x7C, 0xB4, 0xC6,
+    0xF9, 0x12, 0x4A, 0xEA, 0x1E, 0x4A, 0x5A, 0x1B, 0xDF, 0x91, 0x8D, 0xB1, 0x31, 0x93, 0x57, 0x41,
+    0x93, 0x6C, 0x35, 0x51, 0xF7, 0xB7, 0x08, 0xCC, 0x15, 0x6B, 0x1B, 0x07, 0xC7, 0x62, 0xE8, 0x10,
+    0xE3, 0xAC, 0xC7, 0x5A, 0x0D, 0x39, 0xD9, 0x4B, 0xCD, 0x73, 0x58, 0x83, 0xAE, 0xE8, 0x2D, 0x6E,
+    0x4E, 0x4F, 0xB6, 0x18, 0x9C, 0x8C, 0xB1, 0xCD, 0x87, 0x9F, 0x6A, 0x09, 0x2B, 0x59, 0x32, 0xF6,
+    0xE7, 0x82, 0xDD, 0x81, 0xC0, 0x56, 0x92, 0x30, 0x26, 0x39, 0x69, 0xAE, 0x27, 0xD8, 0x59, 0x18,
+    0x46, 0xE5, 0xF5, 0x60, 0x06, 0x29, 0xB6, 0xF4, 0x33, 0x2D, 0xE2, 0xC0, 0x8E, 0x39, 0xCA, 0x0E,
+    0x88, 0xAD, 0x86, 0xF2, 0x9E, 0x60, 0x76, 0x2B, 0x3D, 0x95, 0x1E, 0x76, 0xCC, 0x00, 0x32, 0x36,
+    0x5C, 0x2D, 0xFD, 0x68, 0x61, 0xBE, 0xF2, 0xA3, 0x89, 0xF9, 0xE6, 0x1A, 0xAC, 0xF6, 0x4B, 0xBC,
+    0x27, 0x6D, 0x9E, 0xA5, 0xE3, 0x66, 0x72, 0xD4, 0x26, 0x85, 0x16, 0xA4, 0x31, 0x21, 0x8F, 0x63,
+    0x5C, 0x5D, 0x4D, 0x0E, 0x98, 0x5E, 0x6C, 0x76, 0x60, 0x90, 0x68, 0x3F, 0x88, 0x71, 0x19, 0x63,
+    0xD8, 0x4E, 0x0E, 0x6E, 0xAC, 0x60, 0x80, 0x33, 0x20, 0x1F, 0x0A, 0xDC, 0xDD, 0x4A, 0xE6, 0x6C,
+    0x7F, 0xC0, 0x8D, 0xE6, 0x16, 0x25, 0x9F, 0x07, 0xFB, 0xA7, 0x88, 0x5B, 0x76, 0x7D, 0x20, 0xFB,
+    0xEE, 0x7E, 0x90, 0xCC, 0x57, 0x35, 0xDF, 0xF3, 0x54, 0xF8, 0x3D, 0x9D, 0x89, 0xC6, 0xC4, 0x27,
+    0x74, 0xB3, 0x5A, 0x19, 0x43, 0x47, 0xF7, 0x0E, 0x97, 0x20, 0xB1, 0x2A, 0x90, 0x39, 0x35, 0x28,
+    0x15, 0xC1, 0x3A, 0x2A, 0x9A, 0x99, 0x43, 0x92, 0x2C, 0x4E, 0xB3, 0x9A, 0x66, 0x30, 0x82, 0x2A,
+    0xC4, 0x96, 0xE8, 0x20, 0xDD, 0x58, 0x3C, 0xC5, 0xFD, 0x1F, 0xA0, 0xB4, 0x87, 0x05, 0x96, 0xED,
+    0xB9, 0xBC, 0x31, 0x11, 0x63, 0xFC, 0x00, 0xE9, 0xB7, 0x93, 0xC9, 0xEC, 0xF6, 0x1D, 0x5F, 0x4F,
+    0x34, 0x8B, 0x61, 0x31, 0xE4, 0xFE, 0x9F, 0x7E, 0x8B, 0x1D, 0x7C, 0x2C, 0x5D, 0xEE, 0xB3, 0x16,
+    0x79, 0xFC, 0x6F, 0x81, 0x08, 0x59, 0x3F, 0xDB, 0x95, 0xBB, 0xEC, 0x8C, 0x1D, 0xB8, 0x00, 0x81,
+    0xAF, 0xC1, 0xE0, 0x14, 0x14, 0x4E, 0x31, 0x61, 0xC1, 0xA8, 0x05, 0xA5, 0xE0, 0xA8, 0x85, 0x68,
+    0x88, 0x3A, 0x62, 0xF6, 0x61, 0x5B, 0x44, 0x72, 0x59, 0xD4, 0x97, 0x72, 0xAF, 0xB1, 0x43, 0x79,
+    0x1C, 0xE9, 0x71, 0xA4, 0x6C, 0x94, 0x13, 0x1D, 0x74, 0x58, 0xD7, 0x22, 0x09, 0xA1, 0x74, 0x4A,
+    0xFA, 0xAE, 0x30, 0xDD, 0x3D, 0x48, 0x29, 0x31, 0x20, 0x1D, 0xE6, 0x16, 0x51, 0x2B, 0x37, 0x08,
+    0x9B, 0x18, 0x2C, 0x22, 0x65, 0x37, 0x7F, 0x22, 0x23, 0x07, 0x8D, 0xAD, 0x1F, 0x37, 0x97, 0x73,
+    0x2A, 0xCD, 0xC3, 0x63, 0x12, 0x9B, 0x0D, 0x52, 0x53, 0x1B, 0x5D, 0x51, 0xBE, 0xDC, 0xFC, 0x1E,
+    0xA8, 0x33, 0x1A, 0x85, 0x2D, 0x37, 0xBE, 0x16, 0xC1, 0x68, 0xE9, 0x35, 0xA0, 0xC9, 0x1B, 0xA3,
+    0xB3, 0x70, 0x0E, 0xA8, 0x1E, 0x3B, 0xA3, 0xE9, 0x22, 0x00, 0xE6, 0x03, 0x01, 0xDA, 0x06, 0x50,
+    0x74, 0x0C, 0x95, 0x93, 0x6B, 0xF8, 0x2B, 0x57, 0x1D, 0x3B, 0xEE, 0x01, 0x22, 0x80, 0xEE, 0x00,
+    0x7E, 0xC3, 0x1D, 0x0F, 0xC1, 0xCB, 0xEA, 0x4D, 0x07, 0xA0, 0x1A, 0xB9, 0x02, 0x43, 0x5A, 0x67,
+    0x1D, 0x80, 0x6A, 0x34, 0xD4, 0x00, 0x88, 0x16, 0x40, 0x2D, 0x51, 0x33, 0x33, 0x00, 0xF1, 0x11,
+    0x40, 0xED, 0xB8, 0x66, 0x00, 0x04, 0x03, 0xE5, 0xAF, 0x13, 0x14, 0x3E, 0x20, 0x97, 0x9C, 0x18,
+    0xDC, 0x91, 0x07, 0xA3, 0x79, 0x50, 0x0D, 0xEA, 0x8B, 0xAB, 0xB8, 0xAF, 0xB0, 0xE1, 0xC4, 0xEE,
+    0xDB, 0x16, 0xD9, 0xDB, 0x5E, 0x69, 0x95, 0xF7, 0x4D, 0xD1, 0xA7, 0xA8, 0xE6, 0xB3, 0x3D, 0xB4,
+    0xC8, 0x20, 0x06, 0xAA, 0x3C, 0x4A, 0x1F, 0x65, 0x5F, 0x70, 0x65, 0xD2, 0x03, 0xAE, 0xCE, 0xE7,
+    0x84, 0xEC, 0x93, 0x57, 0xBF, 0xF4, 0x1C, 0x27, 0x74, 0xAD, 0xD0, 0x52, 0x01, 0xD2, 0x2A, 0xB0,
+    0x5D, 0x8F, 0xC3, 0xEA, 0xD1, 0xD5, 0x61, 0xA7, 0x98, 0xF2, 0x78, 0xCA, 0xA1, 0xE0, 0x88, 0x60,
+    0x35, 0xD5, 0xD4, 0x57, 0xC3, 0xFF, 0xDB, 0x83, 0x1F, 0xF8, 0x45, 0x03, 0xBF, 0x38, 0x1F, 0x48,
+    0x71, 0xCD, 0xE6, 0x68, 0x9E, 0x67, 0xDC, 0x77, 0xC8, 0x3C, 0x59, 0x34, 0xDC, 0x74, 0x75, 0xCA,
+    0x3C, 0xF1, 0x85, 0xC8, 0x35, 0xA7, 0x26, 0xEF, 0xB1, 0x30, 0xD6, 0x3C, 0x69, 0x61, 0x3E, 0xA7,
+    0xAB, 0x81, 0x54, 0x0E, 0x81, 0xC2, 0xB9, 0x7C, 0x7F, 0x8E, 0xB8, 0x49, 0x73, 0xA7, 0xA5, 0x1F,
+    0xE3, 0xBA, 0x88, 0xF1, 0xCD, 0xEE, 0xDE, 0xB9, 0x1D, 0xFB, 0x83, 0x1E, 0xFF, 0xD0, 0x08, 0x32,
+    0x18, 0x91, 0x27, 0xBB, 0x58, 0x80, 0xFB, 0x31, 0xA2, 0x66, 0xDC, 0x81, 0xBF, 0xE2, 0xED, 0xE9,
+    0xFD, 0x1E, 0xB6, 0xA7, 0xBE, 0x0B, 0xEA, 0x01, 0x23, 0xCB, 0xE4, 0xF0, 0x6A, 0x92, 0x48, 0xFC,
+    0x0E, 0x72, 0x8C, 0x4B, 0x9F, 0xA1, 0x4C, 0xFE, 0xC0, 0x70, 0x8B, 0x20, 0x98, 0x93, 0x6F, 0x9A,
+    0xE8, 0xDA, 0xB1, 0xA8, 0xAB, 0x62, 0x0D, 0x06, 0x06, 0x57, 0x35, 0x08, 0x3B, 0x12, 0x36, 0xCE,
+    0x53, 0xB2, 0x9C, 0xC3, 0xAD, 0xB7, 0xDC, 0xFD, 0xB8, 0xCF, 0xFE, 0x1A, 0xF0, 0xC5, 0x43, 0x7C,
+    0x2C, 0x9A, 0xA5, 0x5C, 0xA3, 0x29, 0x1E, 0xA3, 0x85, 0x20, 0xF7, 0xD7, 0x18, 0x57, 0xF8, 0x65,
+    0x2D, 0x3E, 0x39, 0x6A, 0xCE, 0xDF, 0x34, 0x2C, 0x4A, 0xCF, 0x9F, 0x02, 0x6C, 0x17, 0xEF, 0xD1,
+    0x43, 0xD5, 0x94, 0xBF, 0xC0, 0x7E, 0x64, 0x29, 0x45, 0x4E, 0x04, 0xFA, 0x6F, 0x9F, 0x4F, 0x95,
+    0x55, 0x3D, 0x6F, 0xDC, 0x46, 0x10, 0x7D, 0x24, 0x11, 0xB0, 0x58, 0x20, 0x4C, 0x61, 0x21, 0x01,
+    0x84, 0x84, 0xAD, 0x11, 0x20, 0xE6, 0x1F, 0xF0, 0x1D, 0x99, 0x14, 0x76, 0xA1, 0x22, 0x2A, 0x22,
+    0xB9, 0x48, 0x91, 0x46, 0x85, 0xBB, 0xFB, 0x03, 0x27, 0x91, 0xA9, 0x55, 0x24, 0xAE, 0xDD, 0xB8,
+    0x08, 0x90, 0xE0, 0x9A, 0xB4, 0x0A, 0xB0, 0x27, 0x6E, 0xD4, 0xAA, 0x10, 0x05, 0xC1, 0x49, 0xA1,
+    0x42, 0x44, 0x7C, 0x6E, 0xE2, 0xC2, 0x8C, 0x44, 0xC5, 0x94, 0xC5, 0xBB, 0xC9, 0x5B, 0xCA, 0x4A,
+    0x6C, 0x48, 0x96, 0x15, 0x7E, 0xDE, 0xEE, 0xCD, 0xCE, 0xCE, 0xBC, 0xF7, 0x66, 0x38, 0x04, 0x5A,
+    0xE0, 0xA4, 0x86, 0x5F, 0xC1, 0xDF, 0x2B, 0x11, 0xF1, 0x0A, 0x0C, 0xC4, 0xA0, 0x8D, 0xE0, 0x1D,
+    0xC0, 0x2B, 0x7B, 0x08, 0x79, 0x25, 0x0D, 0x36, 0x36, 0xA0, 0xDD, 0xCA, 0xDB, 0xAD, 0xBC, 0xCA,
+    0x37, 0xA1, 0x57, 0x04, 0x59, 0x90, 0xE8, 0x20, 0x5B, 0x45, 0xDF, 0x2B, 0x23, 0xB7, 0x82, 0x0E,
+    0x92, 0x61, 0x90, 0x39, 0xD5, 0x10, 0x4D, 0x0F, 0xDE, 0x5E, 0xE9, 0xFE, 0x55, 0x21, 0xF8, 0x2E,
+    0xF1, 0xB7, 0x0D, 0xA2, 0x21, 0x82, 0x35, 0x60, 0xAD, 0x42, 0xBF, 0x06, 0x24, 0x43, 0x6A, 0xE0,
+    0x71, 0x5F, 0x01, 0x54, 0x05, 0xAF, 0x01, 0xC2, 0x0C, 0xAA, 0x40, 0x9F, 0x3F, 0xF8, 0x0A, 0xB2,
+    0x16, 0x81, 0x09, 0x33, 0xBF, 0xE0, 0x7E, 0x25, 0x62, 0x3A, 0xF7, 0x77, 0xB9, 0x50, 0xD3, 0x30,
+    0xE0, 0x32, 0x67, 0x0A, 0x20, 0x4E, 0x78, 0x57, 0x5C, 0x40, 0xC7, 0xC1, 0xBA, 0x81, 0x32, 0x2D,
+    0xFC, 0x22, 0x4C, 0xBC, 0xD2, 0xAD, 0xB8, 0xA0, 0xEF, 0xD4, 0xF4, 0x48, 0xE3, 0x56, 0x5B, 0xEF,
+    0xF6, 0xC1, 0x3D, 0x82, 0xAD, 0x8A, 0x86, 0x7D, 0xA6, 0xA5, 0x0C, 0x8D, 0x1A, 0x9E, 0x11, 0x34,
+    0x87, 0xDC, 0x59, 0x47, 0x74, 0x74, 0x90, 0xC0, 0x61, 0xF2, 0x88, 0x0B, 0x58, 0x48, 0x40, 0x03,
+    0xD8, 0xB0, 0x18, 0x13, 0x68, 0x76, 0xC9, 0x44, 0x2A, 0x72, 0x28, 0x22, 0xBF, 0x8D, 0x46, 0x39,
+    0xE0, 0xD6, 0x5D, 0x2A, 0x16, 0x53, 0xE6, 0x61, 0xED, 0x3C, 0x3A, 0x89, 0x92, 0x6E, 0x19, 0x71,
+    0xC5, 0xF8, 0x6C, 0x51, 0x7C, 0x66, 0x1A, 0xBC, 0x32, 0x7D, 0xBA, 0xB4, 0x14, 0x8B, 0xCC, 0xE8,
+    0xA6, 0xC9, 0x5F, 0xCA, 0xE9, 0xE3, 0xC8, 0x22, 0xAD, 0xCC, 0x95, 0xAF, 0xA5, 0x7C, 0x3A, 0x7A,
+    0x34, 0x04, 0x6A, 0xEB, 0xD0, 0x37, 0x08, 0x12, 0xA6, 0x82, 0xA1, 0xDD, 0x89, 0x99, 0x79, 0x16,
+    0x45, 0x84, 0x40, 0xCF, 0xEE, 0xE0, 0x54, 0xD6, 0x48, 0x19, 0xF2, 0x68, 0x63, 0x22, 0x18, 0x75,
+    0xDC, 0xA6, 0xD3, 0xB9, 0x55, 0x5C, 0xF3, 0x9C, 0x1B, 0xA7, 0xD3, 0x4F, 0x7F, 0x42, 0xC0, 0xBC,
+    0x09, 0xB7, 0xA5, 0xEE, 0x93, 0x0D, 0x3A, 0x21, 0x2F, 0x5B, 0x25, 0x3E, 0xF3, 0x0C, 0x2A, 0x95,
+    0xA9, 0x24, 0xC0, 0x6D, 0xDC, 0x72, 0x4B, 0xDC, 0xA6, 0x1D, 0xD5, 0x02, 0x8B, 0x1F, 0xE6, 0x96,
+    0x96, 0x16, 0x99, 0xD8, 0xD6, 0x68, 0x34, 0xC2, 0x57, 0x4E, 0xE3, 0xD6, 0xA4, 0xA7, 0x74, 0x12,
+    0xFC, 0x3C, 0x71, 0x45, 0xB2, 0x5F, 0xFC, 0xBA, 0x43, 0x83, 0xB1, 0x31, 0xEA, 0x39, 0xAD, 0x44,
+    0xC2, 0x93, 0xAF, 0x77, 0x8C, 0x7B, 0x6A, 0xB0, 0x59, 0x21, 0xD6, 0x08, 0x0F, 0xB2, 0xF0, 0x48,
+    0x64, 0x18, 0xCD, 0x02, 0x7C, 0x60, 0x1D, 0x5A, 0x43, 0x6B, 0x6F, 0xD3, 0xB5, 0xA9, 0xFC, 0x3B,
+    0x54, 0x27, 0xD0, 0x22, 0xAE, 0x3C, 0xC8, 0x29, 0xAA, 0x71, 0x94, 0xA1, 0x1D, 0xC3, 0x3D, 0x64,
+    0x8C, 0x54, 0x60, 0x38, 0x00, 0x56, 0x35, 0x9C, 0xBF, 0xC9, 0xFF, 0x76, 0x81, 0x38, 0x32, 0x4E,
+    0x93, 0x9B, 0x70, 0xEB, 0x99, 0x4C, 0xD5, 0x5D, 0x4B, 0xF8, 0x22, 0x1D, 0x9C, 0x20, 0x17, 0x93,
+    0x2F, 0x17, 0x6B, 0x5D, 0x48, 0xC4, 0xCF, 0x2F, 0x40, 0x19, 0x11, 0x00, 0x0B, 0x9C, 0xE5, 0xAD,
+    0xED, 0xC8, 0xF4, 0x6A, 0x27, 0x4B, 0xA5, 0x72, 0xA5, 0x06, 0x13, 0x39, 0x3B, 0x08, 0xB8, 0xA5,
+    0xC0, 0xE2, 0x4D, 0x4A, 0x5E, 0x0D, 0xE7, 0xEB, 0x9E, 0x27, 0x6D, 0x1D, 0x3F, 0xC8, 0x77, 0x1B,
+    0xA4, 0x5F, 0x1A, 0x8C, 0xFB, 0x70, 0x8E, 0xC9, 0xD8, 0xEF, 0xA4, 0xE7, 0x9B, 0x04, 0x3D, 0x7A,
+    0xAE, 0x39, 0xDC, 0xAB, 0x10, 0x2E, 0x18, 0x4C, 0x83, 0x22, 0xA8, 0x43, 0x79, 0x51, 0x84, 0xB2,
+    0x90, 0x58, 0xCF, 0x83, 0x09, 0x22, 0x29, 0xD5, 0x64, 0xF0, 0x6D, 0x0D, 0x1D, 0xC3, 0x7B, 0xC2,
+    0x62, 0x58, 0x5B, 0xBA, 0xF7, 0x82, 0x78, 0xA6, 0xA3, 0xD1, 0x8F, 0x45, 0xB7, 0xDD, 0xB9, 0xC2,
+    0x66, 0xF8, 0xC8, 0x13, 0x29, 0x94, 0x34, 0x5D, 0x54, 0xBC, 0xA3, 0x16, 0xD2, 0x3A, 0x67, 0x7A,
+    0xE8, 0x2E, 0xF5, 0xF2, 0xFB, 0x5C, 0xCA, 0x0F, 0x8F, 0x13, 0xEF, 0x7C, 0xE6, 0xEA, 0x0B, 0x83,
+    0x62, 0x25, 0x90, 0xA3, 0x62, 0xB6, 0x2C, 0x77, 0x4B, 0x67, 0x1A, 0x53, 0xB4, 0x0D, 0xFC, 0xD7,
+    0x82, 0xB7, 0xB9, 0xEC, 0x71, 0xC8, 0xD4, 0x56, 0xA3, 0xC4, 0xAB, 0xE3, 0x24, 0x2A, 0x52, 0x39,
+    0x48, 0xD2, 0x69, 0x0F, 0xEF, 0x9D, 0xE3, 0x40, 0x15, 0xA2, 0x7D, 0x7F, 0x31, 0x2C, 0x62, 0x99,
+    0x62, 0xC0, 0xEA, 0xC7, 0x19, 0x61, 0xFA, 0xC2, 0xEB, 0xD7, 0x3C, 0x23, 0x83, 0x0B, 0xB3, 0xE5,
+    0x36, 0x4F, 0xD4, 0x7E, 0x89, 0xFE, 0x18, 0xDE, 0x33, 0x83, 0xBE, 0xBE, 0xFA, 0x55, 0xDE, 0xD0,
+    0xFA, 0x26, 0x70, 0x5F, 0xBF, 0x79, 0xE0, 0x06, 0x9D, 0x6A, 0xDC, 0xEC, 0xF8, 0xB9, 0xDF, 0xFD,
+    0x7E, 0xE7, 0x49, 0x55, 0x54, 0x69, 0xF6, 0xD6, 0x00, 0x8D, 0xF3, 0x83, 0x46, 0xAC, 0x4C, 0x60,
+    0xB4, 0x57, 0xD9, 0x8E, 0x43, 0x56, 0xD4, 0x0E, 0xA5, 0xDA, 0x42, 0x49, 0x89, 0x3C, 0x4A, 0xBA,
+    0x49, 0xFB, 0x9F, 0xED, 0x39, 0x63, 0x65, 0xBC, 0x4A, 0xDB, 0xC2, 0xD7, 0x97, 0x1E, 0x2B, 0xD1,
+    0xC4, 0x9D, 0x7D, 0x71, 0x24, 0x4D, 0x2A, 0xEB, 0xB3, 0x7B, 0xA7, 0x8F, 0xD3, 0x81, 0x61, 0x6D,
+    0xF5, 0x37, 0x6D, 0xF3, 0x98, 0xD5, 0x14, 0xB8, 0x2D, 0x03, 0x0D, 0xF5, 0xDC, 0x52, 0x18, 0x69,
+    0x1B, 0x06, 0x8B, 0xE2, 0x7A, 0xD3, 0x2B, 0x61, 0xA3, 0x76, 0xA4, 0xCE, 0x27, 0x83, 0x6D, 0x56,
+    0xC3, 0x26, 0xC1, 0x2A, 0xDE, 0x09, 0xA4, 0x7D, 0x21, 0xAA, 0xC1, 0xCA, 0x4C, 0xD4, 0xF1, 0xA0,
+    0x08, 0x33, 0xAF, 0x8A, 0x59, 0x02, 0xEC, 0x19, 0x2D, 0xD9, 0xD6, 0xAF, 0xDF, 0x76, 0x8E, 0x55,
+    0xD2, 0x84, 0x89, 0x5B, 0x05, 0x85, 0x2A, 0xA9, 0xBD, 0x0C, 0xF9, 0xB4, 0x13, 0xDE, 0x4A, 0x38,
+    0x71, 0x8F, 0xA4, 0x55, 0xB3, 0x3B, 0x6D, 0x64, 0xDC, 0x9A, 0x9B, 0x1F, 0xB2, 0x1B, 0xBF, 0x59,
+    0x86, 0xFE, 0x3E, 0xBF, 0x0B, 0xD4, 0x6D, 0x9B, 0xC3, 0xFF, 0x43, 0x90, 0xAA, 0xE7, 0x52, 0x47,
+    0xA1, 0x90, 0x82, 0xE4, 0x2D, 0x05, 0xFE, 0x9F, 0x1C, 0xEF, 0x5C, 0x5B, 0x8E, 0xF1, 0x45, 0x39,
+    0x5E, 0xA8, 0xD2, 0x95, 0xF9, 0xFD, 0xF5, 0xE9, 0xE6, 0xC9, 0x42, 0x83, 0xDC, 0x02, 0xDF, 0xE1,
+    0x79, 0xD9, 0xC3, 0x95, 0x47, 0xA1, 0xB4, 0xF1, 0xE7, 0x7A, 0xD8, 0xF5, 0x59, 0x76, 0x09, 0x7E,
+    0x2D, 0xD5, 0x2C, 0x41, 0xCE, 0x6C, 0xDA, 0xAE, 0xB7, 0x13, 0x94, 0xFE, 0x0A, 0xC6, 0xA9, 0x34,
+    0x91, 0x14, 0xB6, 0xA7, 0x00, 0x1F, 0xDB, 0x5D, 0xF8, 0x05, 0xFD, 0xF3, 0xA1, 0xC8, 0xFC, 0xD3,
+    0xC5, 0x55, 0xDB, 0x54, 0x2E, 0x3C, 0x68, 0xC2, 0x6C, 0xA4, 0x52, 0x02, 0x87, 0x52, 0x75, 0x1F,
+    0x9A, 0xEB, 0x70, 0xB5, 0x36, 0x46, 0xF0, 0xA4, 0xF6, 0x66, 0x91, 0x9C, 0x96, 0xE9, 0xF4, 0x16,
+    0xF5, 0xFE, 0xBF, 0x8F, 0x7F, 0x00, 0xBD, 0x55, 0x3D, 0x6C, 0x14, 0x47, 0x18, 0x7D, 0x3B, 0x83,
+    0xB3, 0x12, 0x2B, 0x31, 0x2E, 0x4C, 0xE4, 0x28, 0x82, 0x4D, 0x41, 0x11, 0x59, 0x67, 0x6F, 0x4B,
+    0xA4, 0xDB, 0xBD, 0x21, 0x6D, 0x0A, 0xA2, 0x88, 0xAB, 0xD2, 0xA4, 0x48, 0x11, 0xD1, 0xD0, 0xA4,
+    0x70, 0x71, 0xB6, 0x97, 0x50, 0x50, 0xA4, 0x71, 0x43, 0x85, 0x14, 0xD1, 0x24, 0x42, 0x34, 0x76,
+    0x91, 0x82, 0xE2, 0xCC, 0x0D, 0xA1, 0x48, 0x41, 0xC1, 0x2A, 0x28, 0x4A, 0x91, 0x82, 0x95, 0xF2,
+    0x23, 0x05, 0x8A, 0x4C, 0xCC, 0x4A, 0x5E, 0xDB, 0x7B, 0x3B, 0x79, 0xB3, 0x36, 0x04, 0x83, 0x44,
+    0x52, 0x65, 0xBC, 0x9F, 0x6E, 0x77, 0x76, 0xF6, 0x9B, 0xF7, 0xDE, 0xF7, 0xE6, 0xF3, 0x4D, 0xE0,
+    0x1B, 0x8B, 0xF0, 0x61, 0x89, 0x44, 0x19, 0xD4, 0x31, 0x42, 0x93, 0x61, 0x80, 0x31, 0xAA, 0xA0,
+    0x8A, 0x8C, 0x2C, 0x33, 0x44, 0xA6, 0x82, 0xFA, 0xC0, 0x20, 0xCB, 0x80, 0x15, 0x0B, 0x38, 0x03,
+    0x31, 0x05, 0x42, 0x8B, 0xCF, 0x70, 0x3C, 0xC7, 0xD7, 0x15, 0xD6, 0xFC, 0xF7, 0xA2, 0xF5, 0x19,
+    0xD4, 0x18, 0x75, 0x82, 0xBE, 0x95, 0xC5, 0x8A, 0x78, 0x5A, 0xC4, 0xA8, 0xD5, 0x97, 0x66, 0x2C,
+    0x6C, 0x3F, 0x96, 0x65, 0x78, 0xD7, 0xA6, 0x4A, 0xAB, 0xF3, 0xF9, 0xED, 0x11, 0xB2, 0x34, 0xD8,
+    0xB6, 0xD8, 0xB2, 0xF2, 0x41, 0x1E, 0xEC, 0xE7, 0xFC, 0x48, 0x4E, 0x91, 0x58, 0x28, 0x8B, 0x41,
+    0x8E, 0x24, 0xC7, 0x14, 0x0B, 0x08, 0x6E, 0xAC, 0x40, 0x99, 0x31, 0xA1, 0x34, 0x61, 0x11, 0xD4,
+    0x19, 0xC4, 0x53, 0x0B, 0xE9, 0x34, 0x64, 0x0D, 0xA8, 0x92, 0x40, 0x0A, 0x44, 0x0F, 0x0C, 0x56,
+    0x55, 0x2E, 0x6D, 0xAC, 0x13, 0x24, 0x41, 0x85, 0x81, 0xCA, 0xB1, 0x7A, 0xF3, 0x1F, 0x4E, 0x91,
+    0xE7, 0xA4, 0xC3, 0x22, 0x43, 0xC2, 0x44, 0x35, 0xAA, 0xD0, 0x08, 0x3B, 0x20, 0x49, 0x72, 0xBA,
+    0x6A, 0x90, 0x90, 0x53, 0x5A, 0x01, 0x13, 0x83, 0xA0, 0x05, 0x24, 0xE9, 0x51, 0x05, 0xA4, 0x80,
+    0xF0, 0xB7, 0x39, 0x82, 0x06, 0x82, 0x84, 0x23, 0x6E, 0x89, 0x85, 0x5B, 0x37, 0xD7, 0xDC, 0xF4,
+    0xE4, 0xB0, 0x41, 0x50, 0xFB, 0xA5, 0xCC, 0x1D, 0x6B, 0x30, 0x03, 0x27, 0x2A, 0xC8, 0xD2, 0x7F,
+    0x9A, 0x50, 0x23, 0x22, 0x73, 0x2D, 0x2F, 0x04, 0x9B, 0x58, 0x33, 0x72, 0xD7, 0xAF, 0x1A, 0xFB,
+    0x84, 0x51, 0xF7, 0xBE, 0xBB, 0x55, 0x39, 0x33, 0x93, 0x2B, 0xE9, 0x24, 0x9A, 0x7A, 0xBF, 0xB2,
+    0x20, 0x2C, 0xA0, 0x6A, 0x2F, 0x48, 0x90, 0xA3, 0xFF, 0xBA, 0x81, 0xF7, 0xB8, 0x9F, 0x0E, 0x26,
+    0xF0, 0x48, 0xEA, 0x0E, 0x46, 0xFE, 0xFC, 0x96, 0x09, 0x15, 0x55, 0x62, 0x89, 0x8A, 0xB0, 0xF4,
+    0xB9, 0x5F, 0x5E, 0x10, 0xEB, 0x88, 0x38, 0x0C, 0xD6, 0xD1, 0x8D, 0xB5, 0x0A, 0x57, 0x5D, 0x7B,
+    0xA9, 0x27, 0x1C, 0x09, 0x5F, 0xD4, 0xA3, 0xB6, 0x25, 0x9B, 0x33, 0xDD, 0x3E, 0x23, 0x3F, 0xB6,
+    0x38, 0xE6, 0xFC, 0x42, 0x51, 0x00, 0xDF, 0x72, 0xFD, 0xBA, 0x70, 0x4E, 0xB4, 0x1F, 0x5F, 0x6E,
+    0xBC, 0x0A, 0x3E, 0xAB, 0xD2, 0x1E, 0x3A, 0xF5, 0xF0, 0x3A, 0xF0, 0x81, 0x7B, 0x90, 0x10, 0x51,
+    0x04, 0x81, 0x73, 0x26, 0x76, 0x25, 0x32, 0x8D, 0x48, 0x77, 0x09, 0x66, 0x0F, 0x36, 0x0D, 0x59,
+    0xC8, 0x84, 0x1B, 0xAE, 0x32, 0x23, 0x93, 0xC0, 0x6B, 0x5D, 0x1D, 0x8D, 0x93, 0xBB, 0x43, 0x0C,
+    0x9C, 0xD3, 0x0B, 0xED, 0xAD, 0x57, 0xDE, 0x05, 0xAC, 0x94, 0xDF, 0x25, 0xFE, 0x71, 0x78, 0x81,
+    0x6B, 0x5A, 0x1F, 0xF3, 0xC0, 0x95, 0xDF, 0xDB, 0x2C, 0xE6, 0x96, 0x5B, 0xC2, 0x2A, 0x1D, 0xE5,
+    0x16, 0xFD, 0xD3, 0x90, 0x77, 0x4B, 0xF4, 0x15, 0xAB, 0x4F, 0x7B, 0xAB, 0xBD, 0xC9, 0x95, 0x7D,
+    0xB7, 0xD5, 0x9B, 0x39, 0x47, 0x24, 0x1E, 0xAC, 0xF7, 0xBF, 0xBA, 0x5C, 0x51, 0xB3, 0x01, 0x64,
+    0x11, 0x16, 0x2C, 0x42, 0xC3, 0xFC, 0x4A, 0xFB, 0x7A, 0xD0, 0x11, 0x29, 0xE5, 0x8B, 0x1E, 0x71,
+    0xAD, 0xCB, 0xE1, 0x13, 0x87, 0xCE, 0xD9, 0x03, 0xB0, 0xA4, 0x7D, 0x7C, 0xE3, 0x71, 0x7E, 0x64,
+    0xC2, 0x8B, 0xDC, 0xC1, 0x7A, 0xB1, 0x7A, 0x07, 0x7C, 0x8F, 0xCE, 0xCC, 0x80, 0xC2, 0x9C, 0x6B,
+    0x37, 0x8A, 0x06, 0xB3, 0x69, 0x67, 0x3F, 0xEF, 0xC4, 0x78, 0x8A, 0xC8, 0xD9, 0xC8, 0x4C, 0x64,
+    0x21, 0xAD, 0xC5, 0x28, 0x83, 0x8A, 0x4A, 0x3E, 0x5E, 0x37, 0xC2, 0xDB, 0x9E, 0x32, 0xC5, 0x79,
+    0xE7, 0xD1, 0xF1, 0xA7, 0x58, 0x25, 0x1A, 0xE1, 0xA6, 0x3E, 0xF3, 0x2C, 0x12, 0xF9, 0xB3, 0xA9,
+    0xD6, 0xE7, 0x0F, 0x77, 0x4A, 0x88, 0x15, 0xC9, 0x6F, 0x1B, 0xB9, 0x87, 0x93, 0x68, 0x59, 0x78,
+    0x6F, 0x5B, 0xD1, 0x6A, 0x7B, 0x2A, 0x70, 0x4D, 0x78, 0xC5, 0x64, 0x81, 0xEE, 0x9D, 0xA5, 0x4B,
+    0x82, 0x9F, 0x34, 0xA5, 0x3C, 0xB1, 0xA9, 0xF8, 0xD1, 0x3E, 0xBC, 0xF7, 0xBB, 0xDB, 0x9D, 0x6E,
+    0xF6, 0x6C, 0xC4, 0x83, 0xF0, 0xD0, 0x50, 0xA3, 0xDE, 0xA2, 0x70, 0x8D, 0x34, 0x36, 0x74, 0xDA,
+    0x86, 0xDD, 0x41, 0xA1, 0xB7, 0x89, 0x64, 0x70, 0xED, 0x12, 0x53, 0x5F, 0x72, 0x5E, 0xCA, 0x99,
+    0x6E, 0x67, 0xE1, 0xF2, 0x3F, 0xE8, 0x5F, 0xC8, 0xEF, 0xDC, 0xF6, 0xAF, 0x7D, 0xAB, 0xFA, 0xE1,
+    0xFD, 0x3F, 0xED, 0x9D, 0x79, 0xCC, 0xCE, 0x20, 0x93, 0xC5, 0x40, 0x96, 0x09, 0x0F, 0xED, 0xFB,
+    0xBC, 0xD8, 0x65, 0x1A, 0x34, 0x2A, 0xA7, 0xF4, 0x41, 0x95, 0x68, 0xCE, 0x89, 0x22, 0xF5, 0x19,
+    0x4E, 0x0E, 0x87, 0x1F, 0x39, 0xE7, 0xBE, 0x67, 0x78, 0xCD, 0x18, 0xBE, 0xD0, 0xDC, 0x54, 0x1D,
+    0x3E, 0xCE, 0xBA, 0xC6, 0x35, 0xC3, 0x0B, 0xAF, 0xA5, 0x9A, 0xEC, 0xC2, 0x9E, 0x92, 0xAE, 0x26,
+    0xD5, 0x34, 0x32, 0xBD, 0xB3, 0xB2, 0x48, 0x49, 0x35, 0x95, 0xC5, 0x89, 0x4D, 0x59, 0x8C, 0x48,
+    0x75, 0xE0, 0xB4, 0xDA, 0x94, 0x04, 0xBE, 0xA3, 0xD3, 0x98, 0x54, 0x65, 0x51, 0x93, 0x6A, 0x1A,
+    0x9A, 0xDE, 0xA2, 0x2C, 0x32, 0x52, 0x4D, 0x51, 0xFD, 0x0B, 0x55, 0xE0, 0x99, 0xED, 0xFC, 0x09,
+    0x2A, 0xE3, 0x8D, 0x7B, 0x66, 0x69, 0x19, 0x3B, 0xB9, 0x5A, 0xC6, 0x2F, 0x45, 0xAA, 0x5C, 0x9E,
+    0xAC, 0x77, 0x2B, 0x17, 0xD1, 0x9D, 0x19, 0xEF, 0x7C, 0x1E, 0x00, 0x3E, 0x06, 0xC3, 0xDD, 0x61,
+    0xE2, 0x5C, 0x73, 0x71, 0xE3, 0xF1, 0x8D, 0x57, 0xDF, 0x02, 0x9F, 0x74, 0xC9, 0x27, 0xCE, 0x6D,
+    0x53, 0x03, 0xF3, 0x46, 0xAD, 0xDC, 0x0F, 0xF9, 0xD8, 0x6B, 0x6A, 0x44, 0x11, 0xD8, 0xE7, 0x7F,
+    0xCE, 0xAD, 0x39, 0x13, 0xED, 0x4A, 0x57, 0x9D, 0x21, 0xD0, 0x3E, 0xED, 0xFD, 0xA6, 0x8D, 0xA6,
+    0xBE, 0x75, 0x51, 0x84, 0x14, 0xF2, 0xFE, 0xE3, 0x3A, 0xF1, 0xEE, 0x08, 0x3E, 0x4C, 0xF2, 0x5A,
+    0x99, 0x51, 0xA0, 0xD9, 0xB9, 0xC5, 0x75, 0x76, 0x74, 0xF6, 0xDD, 0x27, 0xAF, 0xFF, 0x59, 0xDD,
+    0x82, 0x7A, 0x52, 0x89, 0x76, 0xE2, 0xF6, 0x9E, 0x3C, 0x9A, 0x9E, 0x1E, 0x1F, 0xF3, 0x2D, 0xC5,
+    0x1F, 0xE8, 0xA3, 0x3F, 0xDD, 0x20, 0x90, 0x26, 0x72, 0xBB, 0xA3, 0xD8, 0x55, 0xBD, 0xC1, 0x61,
+    0xAC, 0xBD, 0x14, 0xCF, 0xE6, 0x13, 0x86, 0x62, 0x08, 0x06, 0x8E, 0x7D, 0xDE, 0x03, 0xFE, 0x6B,
+    0xBC, 0x33, 0x3F, 0x77, 0xA7, 0xDD, 0x9A, 0x8B, 0x48, 0xF4, 0x0E, 0xE3, 0xAF, 0x8D, 0xFB, 0x35,
+    0xFF, 0x55, 0x4C, 0xB2, 0xFD, 0xF3, 0xB0, 0xEA, 0x85, 0x8B, 0x80, 0xD8, 0xB5, 0xF7, 0xC6, 0x91,
+    0x5E, 0xEE, 0xC3, 0x5A, 0x79, 0xCF, 0x28, 0x85, 0xFE, 0x92, 0x28, 0x07, 0x13, 0xBC, 0xBD, 0x8E,
+    0x59, 0xC1, 0xA3, 0x52, 0x4A, 0x9B, 0x21, 0x0B, 0xD9, 0x1B, 0x57, 0xB0, 0x12, 0x19, 0x65, 0x28,
+    0x4F, 0x43, 0x3F, 0x86, 0xC5, 0x58, 0x96, 0x2B, 0x41, 0xB9, 0x78, 0x40, 0x6C, 0xEC, 0x2B, 0xC3,
+    0x26, 0x19, 0x23, 0x19, 0x79, 0xF1, 0xEF, 0x19, 0xDC, 0xF6, 0x16, 0x8C, 0xBD, 0x1F, 0xBD, 0xD1,
+    0xFA, 0x58, 0xF6, 0xB7, 0x9D, 0x31, 0x45, 0xF1, 0x16, 0x6F, 0x47, 0xD2, 0x77, 0x1A, 0xDD, 0xD2,
+    0xFF, 0xE5, 0x52, 0x89, 0x77, 0xFB, 0xE1, 0x57, 0xBE, 0xAE, 0xDB, 0x25, 0xDB, 0x55, 0x6F, 0x89,
+    0xCB, 0xC2, 0x2F, 0xD8, 0x9D, 0xF3, 0xBD, 0xC9, 0x3A, 0xC1, 0xF2, 0xEC, 0xD2, 0xF1, 0x09, 0x0B,
+    0x07, 0x51, 0x7A, 0xE4, 0x4B, 0xF8, 0xDF, 0xC6, 0xDF, 0xBD, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x18,
+    0x7D, 0xF6, 0x24, 0x58, 0xCA, 0x14, 0x4E, 0x11, 0x0A, 0x90, 0x88, 0x1B, 0x5A, 0xE2, 0x96, 0x22,
+    0x5E, 0x1B, 0xA5, 0xA0, 0xA0, 0x20, 0xC5, 0xED, 0x7F, 0x90, 0x22, 0x52, 0x8A, 0x34, 0x14, 0x29,
+    0xEE, 0x38, 0x43, 0x93, 0x92, 0x6B, 0xD2, 0xD2, 0xB3, 0x4D, 0x1A, 0x8A, 0x95, 0x70, 0x64, 0x07,
+    0x0A, 0x4A, 0x2C, 0x45, 0xF4, 0x46, 0x88, 0x26, 0x14, 0x71, 0x84, 0x0B, 0x73, 0xDA, 0xF3, 0xC7,
+    0x7B, 0xF6, 0x5E, 0x01, 0x42, 0x90, 0xE2, 0x74, 0xDE, 0xDD, 0xF1, 0xCC, 0x7C, 0xF3, 0xBD, 0xEF,
+    0x7D, 0xBF, 0x66, 0x31, 0x20, 0x6C, 0x71, 0x5C, 0xE2, 0x10, 0xE9, 0x16, 0x71, 0xE1, 0x1E, 0x97,
+    0x61, 0x07, 0x6C, 0x71, 0x1B, 0xF0, 0xA5, 0x2F, 0x38, 0x0D, 0x7A, 0x4D, 0xB9, 0xC6, 0xD6, 0x7F,
+    0xF1, 0x0D, 0xA7, 0xAF, 0x6D, 0xC0, 0x36, 0x7B, 0x2F, 0x6A, 0xFC, 0xE3, 0x86, 0xE7, 0xEE, 0xF5,
+    0x70, 0x0D, 0x6E, 0x81, 0x10, 0x7C, 0xC7, 0xC0, 0x00, 0xD7, 0xE2, 0xE6, 0xFC, 0x6E, 0x90, 0x09,
+    0x2C, 0x2E, 0x90, 0xC0, 0xD9, 0x8E, 0xFB, 0xB9, 0x35, 0x98, 0x9F, 0x87, 0x03, 0xF0, 0x28, 0x3A,
+    0xD5, 0xA1, 0x2B, 0x34, 0xF1, 0x01, 0x38, 0x91, 0xA9, 0x5B, 0x82, 0x78, 0xD0, 0x51, 0x2B, 0xB4,
+    0x92, 0x00, 0xF0, 0x0D, 0x31, 0x10, 0x07, 0xFD, 0x3B, 0x40, 0x16, 0x63, 0xBC, 0x11, 0xF4, 0xDB,
+    0xB8, 0xAB, 0xED, 0xE3, 0xE6, 0xBB, 0xF2, 0x61, 0x97, 0xB9, 0xAF, 0x81, 0xA0, 0xBB, 0xFD, 0x88,
+    0x47, 0xC2, 0xE7, 0xA2, 0x7E, 0x33, 0x2A, 0x11, 0x35, 0xA7, 0xF5, 0x09, 0x32, 0x67, 0x26, 0x77,
+    0xC2, 0x5E, 0x98, 0xDC, 0xFE, 0x16, 0xE2, 0xE5, 0x29, 0xEF, 0x11, 0xEC, 0x80, 0x15, 0xCE, 0x9F,
+    0x7B, 0x32, 0x2C, 0x9E, 0x51, 0x83, 0xA8, 0x83, 0x9F, 0xBF, 0x9C, 0xB8, 0x4E, 0x7E, 0xD0, 0x35,
+    0xC9, 0x5C, 0x8F, 0x93, 0xE3, 0xDF, 0x77, 0x91, 0x4D, 0x78, 0xF7, 0x04, 0xB8, 0x2A, 0xC5, 0x5C,
+    0xC3, 0xE7, 0x1A, 0x8E, 0x34, 0x1C, 0x6A, 0xB8, 0x7E, 0x8E, 0x2A, 0x7C, 0xD9, 0x41, 0x3C, 0x68,
+    0x45, 0xEF, 0xC2, 0x3F, 0xE8, 0x51, 0xFC, 0x55, 0xC9, 0x93, 0x29, 0x3D, 0xEE, 0x33, 0x01, 0xF3,
+    0x44, 0x45, 0xD7, 0x5D, 0x47, 0x6B, 0x49, 0xE1, 0x1B, 0xD4, 0x66, 0x05, 0xB9, 0x4F, 0x48, 0x36,
+    0x9B, 0x1D, 0x28, 0x1E, 0xA2, 0x96, 0x87, 0xA9, 0x11, 0xB5, 0x23, 0x35, 0x18, 0x77, 0xA4, 0xF9,
+    0x62, 0x33, 0x28, 0xF6, 0x2C, 0x42, 0xD9, 0x88, 0xB5, 0xD2, 0x24, 0xC0, 0x65, 0x92, 0xB8, 0xCB,
+    0x97, 0x27, 0x32, 0x8E, 0x39, 0x44, 0x2F, 0x38, 0x64, 0x2A, 0xA3, 0x62, 0x26, 0x77, 0x49, 0x24,
+    0xAE, 0xE2, 0x06, 0x60, 0x65, 0x0B, 0xFF, 0xD4, 0x80, 0x0F, 0xFD, 0x20, 0xFB, 0xE7, 0x41, 0x88,
+    0x4B, 0x91, 0xE3, 0xCF, 0x9D, 0x69, 0x55, 0x71, 0xA8, 0x48, 0xC2, 0xFD, 0x4A, 0x96, 0x09, 0xED,
+    0x60, 0xA7, 0xFC, 0xB6, 0x44, 0x4A, 0x95, 0xC3, 0x91, 0x9F, 0xA8, 0x65, 0xDD, 0xA4, 0x66, 0x2D,
+    0x8C, 0x65, 0x14, 0xBD, 0xDC, 0xD4, 0x0A, 0x73, 0x16, 0x10, 0x77, 0x47, 0x8D, 0x60, 0xA0, 0x4F,
+    0xEE, 0x17, 0x35, 0xC7, 0x4F, 0xD4, 0x4F, 0x0A, 0x5C, 0x91, 0xA1, 0x6A, 0xAE, 0x13, 0x86, 0x24,
+    0x9C, 0x83, 0x82, 0xCB, 0x24, 0x10, 0x6C, 0x89, 0x9A, 0x08, 0xBA, 0xFF, 0x8C, 0x22, 0x86, 0x02,
+    0xFE, 0x13, 0x59, 0x1B, 0xB5, 0xAF, 0xBE, 0x33, 0xE6, 0xC3, 0xBD, 0xE2, 0x24, 0x55, 0x3F, 0x8F,
+    0xDC, 0x8F, 0xBE, 0x27, 0x40, 0xCE, 0xC6, 0xC4, 0x10, 0x37, 0xEC, 0xB5, 0x44, 0xB9, 0x5A, 0x11,
+    0x1C, 0x15, 0xBC, 0xB1, 0xD3, 0x73, 0xB3, 0x2E, 0x38, 0xDD, 0x3C, 0x6D, 0x28, 0x8E, 0x0B, 0x3A,
+    0x96, 0x93, 0x15, 0x8E, 0xE4, 0xCF, 0x78, 0xA8, 0x34, 0x2A, 0xE3, 0x54, 0x8F, 0x48, 0xB2, 0x61,
+    0x93, 0x9B, 0x71, 0xE3, 0xF4, 0x6C, 0x7D, 0x40, 0x07, 0xE7, 0xFE, 0xCA, 0x66, 0xD7, 0x53, 0x75,
+    0x12, 0xA3, 0x20, 0x2A, 0xBE, 0x91, 0xC0, 0x75, 0x12, 0x84, 0xBD, 0x93, 0x87, 0x23, 0x64, 0xAB,
+    0x42, 0x4E, 0x3D, 0x5A, 0xA4, 0x20, 0xA1, 0x5D, 0x2A, 0xBC, 0xDC, 0x8C, 0x33, 0xBE, 0x7C, 0xED,
+    0x15, 0x45, 0x32, 0x13, 0x14, 0x4B, 0x81, 0x36, 0x44, 0xC7, 0x8C, 0x51, 0x89, 0x6D, 0x7F, 0xAF,
+    0x04, 0xF5, 0xA4, 0x82, 0x19, 0xA2, 0xE9, 0xA3, 0xCA, 0x31, 0x52, 0xFA, 0x05, 0x32, 0xFA, 0x6C,
+    0xDF, 0x26, 0x32, 0x3A, 0x73, 0x19, 0xF7, 0x65, 0x39, 0x6F, 0xA8, 0x76, 0x55, 0x9E, 0xC9, 0xF9,
+    0x42, 0xA9, 0xF2, 0x7F, 0xE2, 0x3E, 0x2B, 0x70, 0xE2, 0x4D, 0x64, 0x4A, 0x8E, 0x2E, 0x9A, 0xBD,
+    0x48, 0xD5, 0xAD, 0x3C, 0x5D, 0x7B, 0xB6, 0x64, 0x34, 0xB8, 0x3B, 0xDF, 0x02, 0x4A, 0x64, 0x35,
+    0xDF, 0x30, 0x4B, 0xF6, 0xCD, 0xCE, 0xC8, 0xEF, 0xD3, 0x27, 0xEB, 0x3B, 0xED, 0xDC, 0x96, 0xD9,
+    0x72, 0x8F, 0x2C, 0x0B, 0x4A, 0x48, 0xFB, 0x87, 0xDF, 0xD6, 0xC5, 0x3F, 0x25, 0x5A, 0x50, 0x87,
+    0x6E, 0x10, 0x00, 0x38, 0x98, 0x6D, 0xCE, 0xA5, 0xC1, 0x7B, 0x74, 0xDF, 0xDA, 0x17, 0x02, 0xCD,
+    0x2B, 0x2C, 0xEE, 0x10, 0x4F, 0xF0, 0x3F, 0xB6, 0xBC, 0x67, 0x83, 0xA5, 0x61, 0x2F, 0x86, 0xF5,
+    0x75, 0x0C, 0x29, 0x56, 0xBE, 0x79, 0x0B, 0x27, 0x4B, 0x0B, 0xB8, 0x45, 0xB2, 0x5A, 0xAF, 0xFF,
+    0xAE, 0xB3, 0x2C, 0xCC, 0x76, 0x82, 0x7E, 0xB2, 0x76, 0xFF, 0x62, 0x54, 0x3A, 0x66, 0x2F, 0x08,
+    0x70, 0xC0, 0x30, 0xA7, 0xBC, 0x19, 0x98, 0x00, 0x46, 0xB8, 0x9E, 0xEA, 0x29, 0x6A, 0xFF, 0xEF,
+    0x53, 0x9F, 0x31, 0x87, 0x6F, 0xB3, 0x03, 0xE2, 0xC6, 0x37, 0xFC, 0x4B, 0xA1, 0x8F, 0xA1, 0x8D,
+    0xF5, 0xC4, 0x52, 0x3A, 0x62, 0xDF, 0x44, 0xED, 0x7F, 0x4E, 0x3C, 0xED, 0x8E, 0x34, 0x96, 0x37,
+    0x7E, 0x0A, 0x5F, 0x0F, 0x95, 0xFB, 0x59, 0x61, 0x23, 0x40, 0x6A, 0x65, 0x52, 0xF0, 0xE0, 0x1B,
+    0x0D, 0xA9, 0xDD, 0x21, 0x4A, 0xE0, 0xDA, 0x6A, 0xE5, 0x9F, 0x97, 0xEF, 0xCF, 0x01, 0x49, 0xED,
+    0x4B, 0x1B, 0xDF, 0x14, 0x20, 0x18, 0x42, 0x1B, 0x72, 0x75, 0xC6, 0x45, 0x3E, 0x7F, 0x01, 0xC5,
+    0x55, 0x4B, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0xEE, 0x26, 0x18, 0xC9, 0x52, 0x7A, 0x16, 0x41, 0x6C,
+    0x90, 0x7C, 0x04, 0x5F, 0x20, 0x1E, 0xB7, 0xC4, 0x05, 0x58, 0x40, 0x16, 0x6C, 0xE0, 0x06, 0xB9,
+    0xC0, 0xFC, 0x24, 0x96, 0x2C, 0xE0, 0x06, 0x5C, 0xC4, 0x62, 0x8C, 0xB2, 0x64, 0x81, 0xA5, 0xB9,
+    0xC0, 0x08, 0x82, 0x58, 0xD2, 0x0B, 0x47, 0x38, 0xC4, 0x76, 0xF3, 0xAA, 0xC7, 0x89, 0x00, 0xB1,
+    0x09, 0x12, 0xC9, 0x8C, 0x5C, 0x53, 0xD3, 0xDD, 0x55, 0xF5, 0xBA, 0xEA, 0x55, 0x59, 0xFB, 0xC1,
+    0x42, 0x7B, 0xDF, 0x42, 0x9F, 0x3D, 0xF3, 0x56, 0x6F, 0x91, 0xD5, 0x14, 0xB1, 0xA3, 0x88, 0x5A,
+    0x0A, 0x74, 0x22, 0x4A, 0x11, 0xF3, 0x07, 0x67, 0x4F, 0x30, 0x2F, 0x7C, 0x87, 0x45, 0x41, 0x83,
+    0x79, 0x58, 0xBB, 0xDA, 0xED, 0x2E, 0x2D, 0x82, 0x6D, 0x5A, 0xEB, 0x2F, 0x47, 0xF4, 0xE7, 0x79,
+    0x9A, 0x62, 0x05, 0xEC, 0x61, 0x02, 0xDD, 0xC7, 0x16, 0x17, 0xDE, 0x61, 0x5F, 0xF7, 0x80, 0x8D,
+    0x10, 0x3E, 0x05, 0xA0, 0x37, 0x2D, 0x90, 0x17, 0x35, 0x15, 0x4F, 0x25, 0x27, 0x9C, 0xCD, 0x87,
+    0x1A, 0xF9, 0x61, 0x41, 0xE5, 0x7D, 0x4B, 0xC5, 0x54, 0x7A, 0x53, 0x17, 0xDC, 0x62, 0x8C, 0x4D,
+    0x6D, 0xAA, 0x3C, 0x47, 0x41, 0x45, 0x35, 0x54, 0xCC, 0xC9, 0xA6, 0xC6, 0x92, 0x8A, 0xFA, 0x4E,
+    0xC5, 0xF4, 0x39, 0xB0, 0xA4, 0xA2, 0x44, 0x31, 0x35, 0xA2, 0xC7, 0x0C, 0xA2, 0x9D, 0x84, 0x6A,
+    0x45, 0xCC, 0x45, 0x18, 0x11, 0x23, 0x00, 0x20, 0xF1, 0x0D, 0x6D, 0xBC, 0xB7, 0x6A, 0xB0, 0xC7,
+    0x75, 0xEC, 0x78, 0x09, 0x53, 0xF1, 0x3A, 0x29, 0x81, 0x77, 0x99, 0xD8, 0x10, 0x24, 0xA6, 0x53,
+    0x41, 0xFB, 0x37, 0x11, 0x76, 0xE5, 0xDC, 0x22, 0xB5, 0xCC, 0x87, 0xD8, 0x76, 0xF4, 0xA2, 0x9D,
+    0x1A, 0x98, 0x50, 0xAC, 0xE9, 0x99, 0x31, 0x24, 0xFA, 0x41, 0x88, 0x17, 0x10, 0x31, 0x24, 0xE2,
+    0x5A, 0xB0, 0x30, 0x0A, 0x72, 0x59, 0x9F, 0xDC, 0x12, 0xA0, 0xFB, 0x22, 0xD6, 0x3C, 0x19, 0xF9,
+    0x8A, 0xC8, 0x3E, 0x31, 0x59, 0xC6, 0x96, 0xC0, 0x1D, 0x7E, 0x6F, 0x03, 0x50, 0x64, 0xF7, 0x88,
+    0xA0, 0xDD, 0x07, 0xD2, 0x35, 0x99, 0x72, 0x98, 0xB4, 0x92, 0x1B, 0x7B, 0x3B, 0x58, 0x42, 0xC8,
+    0xAA, 0x19, 0x85, 0xB2, 0x2F, 0xF0, 0xCB, 0xE7, 0x46, 0xB1, 0xB0, 0x18, 0x8F, 0xB6, 0xC8, 0xD3,
+    0x95, 0xA9, 0x16, 0xDA, 0x45, 0x6D, 0x87, 0x98, 0xED, 0x92, 0x56, 0xD0, 0x03, 0x30, 0xB4, 0x28,
+    0xE2, 0xAD, 0xA9, 0xD2, 0x97, 0x0E, 0xF3, 0x87, 0x88, 0xAA, 0x11, 0xE1, 0x84, 0xF6, 0xA7, 0x8D,
+    0x60, 0xA4, 0x4F, 0xBB, 0x14, 0x8C, 0x46, 0x30, 0x66, 0x82, 0x71, 0x26, 0x18, 0x1B, 0x62, 0xD4,
+    0x5B, 0x62, 0x4C, 0x2A, 0x82, 0x4A, 0x2D, 0xC5, 0x54, 0xE0, 0x95, 0x14, 0x91, 0x23, 0x46, 0x36,
+    0xF4, 0x34, 0xA3, 0xC9, 0x22, 0x7D, 0x2E, 0x18, 0x7B, 0xC1, 0xC8, 0x16, 0x75, 0x5A, 0x30, 0xC6,
+    0x9E, 0x18, 0xCD, 0x2B, 0x62, 0x54, 0x21, 0x5F, 0xC2, 0xA5, 0x44, 0x68, 0xDD, 0x5D, 0x52, 0x5B,
+    0x88, 0xBE, 0xE3, 0x11, 0xBD, 0x61, 0xCA, 0xFE, 0x33, 0x6F, 0x39, 0x75, 0xBE, 0xF2, 0xD0, 0x79,
+    0x73, 0xAD, 0x85, 0xCF, 0x5C, 0x68, 0xE8, 0xB7, 0xCC, 0x56, 0x6C, 0xFF, 0x73, 0xAC, 0x51, 0x30,
+    0x78, 0xE4, 0x87, 0xB1, 0xA7, 0xB0, 0xC7, 0x24, 0x26, 0x9C, 0x46, 0x32, 0x91, 0xA4, 0xE5, 0xD5,
+    0xF6, 0x72, 0xE7, 0xBF, 0xC7, 0x96, 0x31, 0x13, 0xC9, 0x1F, 0xCF, 0x83, 0x2D, 0x9B, 0xA7, 0x8D,
+    0x2B, 0x26, 0x7F, 0x72, 0x23, 0xF7, 0x26, 0x49, 0x53, 0x99, 0xBD, 0x35, 0x99, 0xF2, 0xF8, 0xDE,
+    0x15, 0x3B, 0x89, 0xE0, 0xBA, 0xA1, 0x7E, 0x5B, 0x78, 0xCD, 0x85, 0x8D, 0x83, 0x72, 0xEF, 0x58,
+    0x4E, 0x73, 0xAA, 0x3A, 0x78, 0xDF, 0x93, 0x74, 0xAD, 0xB4, 0xA8, 0xA4, 0x5B, 0x4A, 0x5C, 0xED,
+    0xEA, 0xAD, 0xC7, 0x67, 0x6C, 0x53, 0xC5, 0x2B, 0xCF, 0x16, 0x64, 0x78, 0x42, 0xAA, 0x71, 0xF0,
+    0x9A, 0x55, 0x46, 0x7E, 0xE9, 0x2D, 0x51, 0x96, 0xDC, 0x33, 0x2B, 0xF2, 0xC5, 0x31, 0x4B, 0x05,
+    0xE3, 0x08, 0x8B, 0x41, 0xA2, 0x0B, 0x95, 0x43, 0xE9, 0xC2, 0xA0, 0x9E, 0x8E, 0xFC, 0xF9, 0x73,
+    0x21, 0xDF, 0x51, 0x4A, 0x62, 0xC9, 0xB6, 0xBC, 0x8B, 0x88, 0x4A, 0xD7, 0x77, 0x7B, 0x63, 0xA3,
+    0x2E, 0x67, 0xDD, 0x1B, 0x24, 0x27, 0x35, 0x32, 0x63, 0x21, 0x7F, 0xB7, 0x24, 0xBF, 0xFE, 0xE1,
+    0x1B, 0xC3, 0x74, 0x4D, 0x9F, 0xDA, 0x2B, 0x5B, 0x3B, 0x0E, 0x5D, 0x5E, 0x42, 0xD1, 0x47, 0xCA,
+    0x8C, 0x16, 0x36, 0xAD, 0xE6, 0xCC, 0xDA, 0x8C, 0x4F, 0xC9, 0x9B, 0x95, 0xC8, 0x38, 0x06, 0x7B,
+    0xBE, 0xE1, 0x1C, 0x4A, 0xCE, 0xEA, 0xF0, 0x70, 0x70, 0x97, 0x2C, 0x74, 0x89, 0x25, 0xF7, 0x13,
+    0xDE, 0x21, 0x92, 0x6A, 0x97, 0x7C, 0x66, 0xE1, 0xF7, 0x00, 0x5D, 0x99, 0x79, 0x57, 0xA6, 0x32,
+    0x4B, 0x27, 0xA1, 0x40, 0xEC, 0xF2, 0x98, 0xB7, 0x98, 0xED, 0x2A, 0x12, 0x28, 0xA1, 0xD6, 0x6F,
+    0x12, 0x3F, 0xA8, 0xD3, 0xB4, 0x0E, 0x9D, 0x92, 0xC9, 0x78, 0xC1, 0x91, 0xCB, 0x7C, 0xB7, 0xFC,
+    0x72, 0x5C, 0x20, 0xF9, 0x06, 0x75, 0x51, 0x61, 0x70, 0x58, 0x2E, 0xB0, 0xFC, 0xE8, 0x7B, 0xB7,
+    0x6E, 0x0F, 0x43, 0x6A, 0x0F, 0x82, 0xBB, 0xCC, 0xB2, 0x51, 0xE5, 0x0E, 0xBB, 0x77, 0xD8, 0xBF,
+    0x7A, 0xFB, 0x09, 0xAD, 0x55, 0x3D, 0x8F, 0xE4, 0x44, 0x14, 0x2C, 0xDB, 0x0B, 0x5E, 0x68, 0x09,
+    0x13, 0xEC, 0x49, 0x68, 0x13, 0xC7, 0x24, 0xE7, 0xF4, 0x02, 0x66, 0x6C, 0x2E, 0x20, 0x21, 0x60,
+    0x82, 0x9B, 0x23, 0xB8, 0x60, 0x09, 0x08, 0x90, 0x08, 0x86, 0x1F, 0xB0, 0xB3, 0xF6, 0xFD, 0x83,
+    0x4B, 0xF8, 0x01, 0x48, 0x48, 0x48, 0x93, 0x1C, 0x29, 0xC8, 0x3B, 0x6E, 0x71, 0x21, 0xC1, 0x1A,
+    0xF8, 0x01, 0x58, 0x30, 0x2B, 0x24, 0x08, 0xAE, 0x4F, 0x18, 0x8D, 0x97, 0xF3, 0xF8, 0x51, 0xDD,
+    0x33, 0xB7, 0x10, 0x1C, 0x1F, 0x62, 0xD7, 0x92, 0xD5, 0xED, 0xB6, 0xBB, 0xAA, 0xDE, 0xEB, 0x7A,
+    0xCF, 0x78, 0x01, 0x50, 0x06, 0x4A, 0x10, 0x7E, 0xD7, 0x84, 0x7A, 0x8C, 0xCC, 0xCB, 0x00, 0xF8,
+    0xD5, 0x03, 0x25, 0x83, 0xBF, 0x8A, 0x6B, 0xA0, 0x07, 0x12, 0x7E, 0xA4, 0x71, 0xD7, 0x24, 0xD2,
+    0xE7, 0xE7, 0xB3, 0x14, 0xEA, 0x31, 0xFC, 0xA7, 0x1A, 0x83, 0x41, 0x7E, 0x82, 0xFC, 0x4C, 0x36,
+    0xA6, 0xEA, 0xDE, 0x00, 0x37, 0x4E, 0x3C, 0xC8, 0xFD, 0xFA, 0x4B, 0x31, 0xB7, 0x54, 0xBB, 0x87,
+    0x57, 0x89, 0x84, 0x97, 0x87, 0x2C, 0x91, 0x4E, 0x3D, 0xC8, 0x33, 0x04, 0x06, 0x28, 0x2D, 0x9A,
+    0x77, 0x4F, 0x57, 0xF2, 0x44, 0x3E, 0x2E, 0x7B, 0x24, 0xA5, 0x45, 0x0B, 0x9E, 0x6A, 0x6F, 0xD3,
+    0x79, 0x92, 0xCA, 0xFA, 0x2B, 0x69, 0x8C, 0xC7, 0x7D, 0x44, 0xEB, 0x62, 0xA4, 0x61, 0xED, 0x63,
+    0x82, 0xED, 0xF5, 0x7F, 0xA1, 0xE2, 0xC2, 0xBE, 0x7B, 0x25, 0xCC, 0x82, 0xA2, 0x46, 0xFB, 0x39,
+    0xA2, 0x16, 0x3B, 0xCC, 0x87, 0x2B, 0x5F, 0xA4, 0xF8, 0x22, 0xE4, 0x42, 0xEA, 0x62, 0xF4, 0x0D,
+    0x6E, 0x94, 0x4A, 0x24, 0xBE, 0xB8, 0x77, 0xA6, 0x6D, 0x8C, 0x4B, 0x83, 0xB4, 0x44, 0xFC, 0x7D,
+    0x11, 0xFF, 0x2A, 0x72, 0x9C, 0x0C, 0x91, 0x8D, 0xCA, 0xAB, 0x1A, 0xD5, 0x21, 0x25, 0xEF, 0x80,
+    0x0B, 0x25, 0xDF, 0x9C, 0x02, 0x61, 0x6F, 0x13, 0x15, 0x69, 0xCF, 0x41, 0x05, 0x0D, 0xA6, 0x9B,
+    0xE9, 0x51, 0x51, 0x89, 0xC8, 0x10, 0x5F, 0x1C, 0xFD, 0xBC, 0xF8, 0xB4, 0xDF, 0x31, 0xB8, 0x74,
+    0x6E, 0xE5, 0x27, 0x0D, 0xBC, 0xCE, 0x5F, 0x37, 0xDE, 0x23, 0x11, 0x72, 0xFA, 0xD2, 0x84, 0xD2,
+    0x5A, 0x7C, 0x8A, 0x4B, 0x2E, 0x50, 0x89, 0xAE, 0xEE, 0xD6, 0x27, 0x4E, 0x5A, 0x54, 0x20, 0xAC,
+    0x61, 0xC1, 0xE7, 0x8C, 0x27, 0xB3, 0x04, 0x0E, 0x89, 0xB3, 0xD6, 0x2B, 0x72, 0x31, 0x3E, 0x77,
+    0x2A, 0x3E, 0x69, 0x78, 0x4B, 0xD8, 0x01, 0x06, 0x87, 0x1D, 0x28, 0xD3, 0xA2, 0x45, 0x7C, 0x26,
+    0x90, 0xDD, 0x1F, 0x72, 0xBA, 0xE7, 0x82, 0x7F, 0x71, 0xC8, 0x7C, 0x06, 0xB0, 0x7C, 0xAB, 0x8B,
+    0x33, 0xF5, 0xC8, 0x60, 0x3C, 0x46, 0xB0, 0x3E, 0x9F, 0xE6, 0xB9, 0xC8, 0xFA, 0xF7, 0xC5, 0x82,
+    0x44, 0x41, 0xED, 0xC8, 0x7D, 0x6E, 0x8B, 0x1A, 0xAF, 0x48, 0x65, 0x43, 0x51, 0x05, 0x0E, 0xB8,
+    0xF9, 0xC0, 0x81, 0xDA, 0x37, 0x23, 0xCE, 0x32, 0x77, 0x5E, 0x57, 0xC4, 0xA4, 0x15, 0x7D, 0xC6,
+    0x94, 0x1B, 0xC4, 0xEF, 0xE8, 0xA0, 0xBE, 0xC9, 0x4C, 0x4C, 0xAE, 0x8A, 0x49, 0x55, 0x49, 0x50,
+    0xFB, 0x66, 0x84, 0x97, 0xBC, 0x6C, 0x67, 0x23, 0xCC, 0x56, 0x48, 0xA4, 0x51, 0xAB, 0xD9, 0xFD,
+    0x16, 0x25, 0x0F, 0xEB, 0xC7, 0x06, 0xE9, 0xC9, 0xF4, 0xDD, 0x35, 0x0F, 0x2B, 0x5F, 0x2C, 0x3E,
+    0xAB, 0x5D, 0x4C, 0xF6, 0x88, 0x98, 0x5E, 0x0C, 0x78, 0x2D, 0x10, 0xA9, 0x95, 0x74, 0x20, 0xC2,
+    0x0D, 0x9C, 0x32, 0xEF, 0x1D, 0x5A, 0x2B, 0xED, 0x03, 0xDF, 0x28, 0x9D, 0xA0, 0x7C, 0xDE, 0xE0,
+    0x4D, 0xE2, 0xA2, 0x57, 0xFA, 0xD8, 0xB2, 0x1E, 0x3E, 0xFF, 0x13, 0x37, 0xD8, 0x4C, 0x06, 0xF4,
+    0x52, 0x1B, 0x3C, 0x69, 0x6F, 0x7A, 0xED, 0xC4, 0xE5, 0xF1, 0xD0, 0xBA, 0x83, 0x56, 0xE4, 0xEB,
+    0xE4, 0xDF, 0xA6, 0xF0, 0xA2, 0xDB, 0x3F, 0xD5, 0xFD, 0x64, 0xDF, 0x85, 0x76, 0xC8, 0x25, 0xAE,
+    0xD3, 0x5B, 0x7F, 0x3F, 0x71, 0xD7, 0x2D, 0x5F, 0x23, 0x7F, 0xA8, 0xA1, 0x06, 0xE6, 0x8C, 0x59,
+    0xAF, 0x72, 0xA0, 0x65, 0xA1, 0x38, 0x48, 0xBA, 0xEB, 0xC3, 0x4F, 0x68, 0xA9, 0xA1, 0x8D, 0xCE,
+    0x8F, 0xBA, 0x24, 0xF3, 0xFB, 0x31, 0xED, 0xC6, 0xA4, 0x94, 0xC7, 0xBB, 0x9B, 0x49, 0x2F, 0xB9,
+    0xD6, 0x31, 0x50, 0x13, 0xD5, 0x21, 0x8D, 0x2B, 0x1A, 0xD5, 0x06, 0x36, 0x47, 0xB6, 0x0B, 0xA4,
+    0xF5, 0x47, 0x51, 0x25, 0xA8, 0x73, 0xBD, 0x6B, 0x03, 0xEF, 0xC7, 0x9D, 0x3A, 0x93, 0xB6, 0x5A,
+    0xCD, 0xBE, 0x36, 0x38, 0x5D, 0x22, 0xF8, 0xA5, 0xC6, 0xB8, 0xE4, 0xA0, 0xFF, 0x79, 0xC0, 0x1D,
+    0x6E, 0xA6, 0xA3, 0x6D, 0xC8, 0x4E, 0x9B, 0x4F, 0xE7, 0x3F, 0xEB, 0x08, 0x49, 0x0B, 0xD6, 0x6F,
+    0xA6, 0x7E, 0x9B, 0xD5, 0x71, 0x11, 0x98, 0x94, 0x06, 0xB7, 0x42, 0xE7, 0x3B, 0x81, 0xF3, 0x3F,
+    0x85, 0xF6, 0xA9, 0x6D, 0x27, 0x99, 0x4F, 0xB1, 0xAA, 0xE1, 0x79, 0x16, 0x97, 0x62, 0x79, 0xA4,
+    0xAE, 0x36, 0x6C, 0x39, 0x31, 0x3D, 0xAE, 0x3E, 0x3C, 0x5C, 0x1F, 0xBE, 0xBD, 0x23, 0x6A, 0x4E,
+    0x5B, 0xF7, 0xB5, 0xDF, 0xC4, 0x6C, 0xB1, 0x3B, 0x2F, 0x5E, 0x07, 0xFE, 0x01, 0x5B, 0xB6, 0xDC,
+    0xD6, 0xC1, 0x63, 0x29, 0xC2, 0x37, 0xE5, 0x52, 0xFA, 0xF5, 0xE4, 0x86, 0x8D, 0xA2, 0x4D, 0xB6,
+    0xF7, 0x7B, 0xFB, 0xC0, 0x75, 0x62, 0xDB, 0x9E, 0x91, 0x6F, 0xD3, 0xBE, 0xCB, 0xC6, 0x74, 0x3A,
+    0x7D, 0x9B, 0x25, 0x18, 0x8B, 0xF4, 0x97, 0x4C, 0x6C, 0x5F, 0xA1, 0xD9, 0xF6, 0xAF, 0xBD, 0x67,
+    0xE4, 0xAB, 0x96, 0xE4, 0x66, 0x4B, 0x1E, 0x91, 0x3C, 0x21, 0xF9, 0x71, 0x37, 0x47, 0x5B, 0xCE,
+    0x83, 0xA6, 0x9C, 0x2B, 0x5D, 0xCE, 0x63, 0x94, 0xA3, 0x11, 0xC9, 0x3B, 0x92, 0x1B, 0x92, 0x37,
+    0xAA, 0x89, 0x48, 0x9E, 0x90, 0x7C, 0x9F, 0x6C, 0xDE, 0xC4, 0xFD, 0x14, 0x58, 0xCB, 0xEE, 0xC8,
+    0x55, 0xE1, 0xFA, 0x19, 0x3B, 0x4D, 0x81, 0xD7, 0xFF, 0x83, 0x27, 0x4B, 0x84, 0x74, 0xEF, 0x90,
+    0x66, 0xE9, 0x0F, 0x22, 0xCB, 0x50, 0xBE, 0x6D, 0x5C, 0x04, 0x77, 0x9C, 0x4E, 0xDB, 0x37, 0x58,
+    0x21, 0x11, 0x76, 0x2D, 0xF1, 0x4A, 0x98, 0x6C, 0x89, 0x81, 0x2D, 0xCE, 0x06, 0x49, 0x5C, 0x84,
+    0x7A, 0x44, 0xE3, 0x4F, 0xAE, 0xAC, 0xF3, 0xAF, 0xD7, 0x1F, 0xBD, 0x55, 0x3D, 0x73, 0xDD, 0x44,
+    0x14, 0x3D, 0x2B, 0x61, 0x6B, 0xC8, 0x16, 0x4A, 0x61, 0xCF, 0x64, 0x48, 0x21, 0x0A, 0x0A, 0xA0,
+    0x88, 0xFE, 0x40, 0x9E, 0xA4, 0x0C, 0x3F, 0x80, 0x14, 0x49, 0x0A, 0xFC, 0x07, 0x68, 0x18, 0xB7,
+    0x14, 0xEF, 0xD9, 0x62, 0xF8, 0x03, 0x8F, 0x82, 0x8A, 0x86, 0x3A, 0x14, 0xD4, 0xCC, 0xC8, 0x68,
+    0xC7, 0x29, 0x52, 0xA4, 0xB0, 0x66, 0xF2, 0x03, 0x22, 0x26, 0x4E, 0x13, 0x0A, 0x04, 0x11, 0xA0,
+    0x8C, 0xF5, 0xDE, 0xE5, 0xDC, 0xD5, 0x7B, 0xF1, 0xA4, 0xA1, 0x80, 0x49, 0x64, 0x6B, 0xBC, 0xDA,
+    0xBD, 0x7B, 0xCF, 0xB9, 0xE7, 0x7E, 0x18, 0x05, 0x90, 0x45, 0x2E, 0x6C, 0x2B, 0x5C, 0x0B, 0xB8,
+    0xF6, 0xCF, 0xE7, 0x08, 0xBE, 0x73, 0xC8, 0x2A, 0x84, 0xBF, 0xFE, 0xFB, 0x9F, 0xA3, 0x13, 0xC4,
+    0x4F, 0xFB, 0x70, 0x9D, 0xCA, 0x45, 0x7B, 0xBC, 0xBA, 0x81, 0x3D, 0xBD, 0xBD, 0x0F, 0x84, 0x3D,
+    0x90, 0xD0, 0xDB, 0x00, 0xD8, 0x12, 0xD3, 0x36, 0x3E, 0x06, 0x3E, 0xAA, 0x60, 0xFA, 0x01, 0xF6,
+    0xB4, 0x23, 0x68, 0x63, 0xFA, 0xB8, 0xB4, 0x2E, 0x45, 0x86, 0x99, 0xE9, 0x50, 0xC5, 0xCE, 0x74,
+    0x33, 0x84, 0xBF, 0x74, 0xB0, 0x67, 0x25, 0xE2, 0x05, 0x90, 0x76, 0xC0, 0x31, 0xEF, 0x8F, 0xF4,
+    0xC8, 0x65, 0x4C, 0x8F, 0x15, 0x97, 0x2D, 0x77, 0x81, 0xBA, 0x43, 0xB0, 0x9E, 0xF8, 0x06, 0x3C,
+    0xB4, 0x8E, 0xF6, 0xF0, 0x06, 0xAF, 0x3E, 0xA3, 0x97, 0xA8, 0x44, 0x02, 0xF9, 0xA6, 0xB6, 0x1D,
+    0x4E, 0xD2, 0x12, 0xE3, 0x09, 0x82, 0x3F, 0x3A, 0x44, 0x8F, 0x1C, 0x92, 0x43, 0x60, 0x41, 0x3A,
+    0x7F, 0x11, 0xEE, 0x51, 0x8B, 0x3C, 0x75, 0x66, 0xA8, 0x5D, 0x72, 0x7A, 0x21, 0x2B, 0xFB, 0x50,
+    0xC8, 0xEA, 0xF6, 0x6B, 0xAE, 0x2E, 0x3D, 0x03, 0x85, 0xEE, 0xF5, 0x48, 0x49, 0xE4, 0x83, 0xDD,
+    0x8D, 0x64, 0xB8, 0x52, 0xE2, 0x8A, 0xBA, 0xCC, 0x68, 0x54, 0x21, 0xFE, 0xAA, 0xC7, 0x22, 0x6C,
+    0x83, 0xCE, 0xBA, 0xB8, 0x8C, 0x8B, 0x39, 0x8D, 0x3B, 0xCC, 0x19, 0xC0, 0x30, 0x47, 0xF0, 0xA2,
+    0x45, 0xF8, 0xA4, 0x80, 0x65, 0x58, 0x09, 0x63, 0xC9, 0x31, 0x45, 0xD8, 0x4C, 0x30, 0xD4, 0x2C,
+    0x71, 0x48, 0xB9, 0x53, 0x33, 0x74, 0xE4, 0xC2, 0x7D, 0x91, 0x12, 0xE6, 0xEE, 0x9D, 0x2D, 0x16,
+    0x4D, 0x10, 0x29, 0x95, 0x9C, 0x67, 0xB8, 0x20, 0x3F, 0x7B, 0xC6, 0x45, 0x96, 0x01, 0x86, 0xE0,
+    0x88, 0xC9, 0x0E, 0x33, 0x22, 0x06, 0x5D, 0xE4, 0x40, 0x02, 0x25, 0x16, 0xF4, 0x1D, 0x88, 0xAC,
+    0x10, 0x8B, 0x0C, 0x38, 0xBA, 0xFF, 0x43, 0xC7, 0xE3, 0xB0, 0x61, 0x92, 0x62, 0xC7, 0x1B, 0xC9,
+    0x27, 0x24, 0x92, 0x25, 0x1A, 0x25, 0x81, 0x4D, 0x1F, 0xD2, 0x92, 0xA0, 0xFB, 0x77, 0x7D, 0x49,
+    0xFC, 0x78, 0xCE, 0xAB, 0xE5, 0x4F, 0x51, 0xEF, 0xC9, 0x52, 0x0F, 0xEA, 0xB0, 0x5F, 0x59, 0x91,
+    0xE4, 0xE5, 0xC1, 0x99, 0x0B, 0x48, 0xE0, 0xE7, 0x0E, 0x79, 0x85, 0xE4, 0x49, 0x99, 0xBC, 0x10,
+    0x99, 0xA7, 0xEB, 0x18, 0x57, 0x79, 0xEF, 0x7D, 0x2C, 0x81, 0x36, 0x2A, 0x89, 0x4C, 0xAF, 0x81,
+    0x90, 0x28, 0x65, 0xDD, 0x3C, 0xB1, 0x46, 0xC7, 0x3C, 0x22, 0x5C, 0xE9, 0x57, 0xA5, 0xD8, 0x8C,
+    0x29, 0x7C, 0x4A, 0x26, 0x89, 0x6A, 0x3E, 0x52, 0xAE, 0xB0, 0xC9, 0x55, 0x95, 0xB9, 0xC6, 0x3C,
+    0x20, 0x6A, 0x08, 0x9C, 0x0A, 0x15, 0x11, 0xF2, 0x89, 0x9E, 0xDF, 0xAF, 0x95, 0xCF, 0xCC, 0x90,
+    0xD7, 0xC8, 0x1B, 0xA6, 0xA7, 0x00, 0x5A, 0x3F, 0x94, 0xC3, 0x69, 0x01, 0x06, 0x78, 0x57, 0xE1,
+    0x53, 0x71, 0x8A, 0xBD, 0x33, 0xE5, 0x69, 0x5D, 0xA4, 0x32, 0xD8, 0xE5, 0x71, 0xE1, 0x6B, 0xAA,
+    0x52, 0xF7, 0xE6, 0xC0, 0xD5, 0xF2, 0xBB, 0x7C, 0xCB, 0xD8, 0xD3, 0x0A, 0xF6, 0x37, 0x84, 0x17,
+    0xCE, 0xAC, 0x06, 0x23, 0xB9, 0xFC, 0x7D, 0x2A, 0x6D, 0x67, 0xDE, 0x8E, 0xE8, 0x5C, 0x58, 0xD5,
+    0xFB, 0x4B, 0x15, 0x45, 0xB5, 0x8A, 0x15, 0x37, 0x53, 0xC5, 0x7C, 0x29, 0xEC, 0x31, 0x11, 0xA8,
+    0xA5, 0xF5, 0xE4, 0xB5, 0x64, 0x54, 0xA5, 0x4A, 0xD9, 0xA7, 0x32, 0x32, 0x15, 0x0F, 0xD8, 0x44,
+    0xA4, 0xCF, 0xE2, 0x1E, 0x99, 0x8B, 0x87, 0x6D, 0x34, 0x92, 0xBF, 0xAB, 0x87, 0x9B, 0xB8, 0xCA,
+    0x1C, 0x18, 0x82, 0xDD, 0x9C, 0x1C, 0xD3, 0xA5, 0x61, 0xEB, 0x18, 0x7A, 0x31, 0xB7, 0xA7, 0xEA,
+    0xF3, 0x2F, 0x5B, 0x4E, 0x4D, 0xF0, 0xCE, 0x26, 0x45, 0xD7, 0xE5, 0x9C, 0xF5, 0x27, 0xC5, 0xF1,
+    0xF9, 0x75, 0x97, 0xD3, 0x58, 0xDF, 0x84, 0x4C, 0x6C, 0x33, 0x35, 0xA4, 0xD7, 0x24, 0xDB, 0xE4,
+    0x52, 0xDB, 0xD2, 0x6F, 0x68, 0x3D, 0xC7, 0x44, 0x31, 0xDB, 0x0F, 0xAF, 0x5A, 0xBD, 0xDC, 0x2D,
+    0x59, 0x31, 0x2D, 0xF3, 0xD7, 0xFB, 0x19, 0xE1, 0xC7, 0x82, 0x66, 0xB7, 0xD0, 0xC6, 0xE6, 0xAF,
+    0x99, 0x40, 0x6B, 0x2D, 0xB6, 0x60, 0x75, 0x70, 0x6B, 0xF0, 0xA4, 0x32, 0x3F, 0x49, 0xA2, 0xC6,
+    0xEB, 0xB3, 0xF0, 0x50, 0x0A, 0x7D, 0xC2, 0x55, 0xB3, 0x6B, 0x44, 0x9C, 0x65, 0x39, 0xEC, 0x4C,
+    0xDE, 0x90, 0x6B, 0xAB, 0x6A, 0x03, 0xD1, 0x2A, 0x21, 0x99, 0x9D, 0x4D, 0xD2, 0xDF, 0x70, 0x24,
+    0x04, 0xE1, 0x80, 0x89, 0x04, 0xD1, 0xE3, 0x2E, 0x6C, 0x6E, 0xA0, 0x30, 0xC5, 0xFF, 0x8D, 0x44,
+    0xA7, 0x67, 0xA4, 0x3C, 0xBE, 0xC7, 0xE5, 0x73, 0x28, 0x4B, 0x56, 0xFE, 0xCA, 0xC8, 0xF2, 0x10,
+    0xDA, 0x34, 0xFA, 0x1E, 0xC1, 0x4B, 0xE8, 0x79, 0xBE, 0x22, 0xFE, 0x5A, 0x24, 0xE3, 0x96, 0xFC,
+    0xF6, 0x83, 0xE3, 0x85, 0xA3, 0xB3, 0x78, 0x4F, 0x5B, 0xA9, 0x64, 0x41, 0x51, 0x83, 0x3B, 0x3E,
+    0x08, 0x35, 0xE7, 0xF5, 0x0F, 0xB7, 0x78, 0x81, 0x2C, 0xAD, 0x8C, 0xF6, 0xCF, 0x2F, 0x78, 0x55,
+    0xA9, 0x0E, 0x9E, 0xF7, 0x65, 0x10, 0x99, 0x87, 0x0D, 0x74, 0x2C, 0x14, 0xD7, 0x22, 0x11, 0x3A,
+    0x2C, 0x94, 0xFD, 0x1E, 0x7F, 0x22, 0xC7, 0xD3, 0x8A, 0xAF, 0xD5, 0x21, 0x2D, 0x93, 0x4A, 0x6F,
+    0x3E, 0x17, 0x86, 0x30, 0xBD, 0x2D, 0x93, 0x4F, 0x9D, 0x61, 0xCB, 0xA7, 0x0E, 0x53, 0x2A, 0xFE,
+    0x6B, 0x2E, 0x0A, 0x68, 0x69, 0x72, 0xFC, 0x64, 0x3A, 0x9A, 0x75, 0x80, 0xE9, 0x10, 0x9C, 0xCA,
+    0x97, 0xE4, 0x64, 0x5D, 0x68, 0x28, 0x2E, 0x7C, 0xF6, 0x99, 0x14, 0x33, 0x98, 0x15, 0x87, 0x78,
+    0xC4, 0x7F, 0x62, 0x48, 0xBE, 0x66, 0x30, 0x23, 0x17, 0xF6, 0x01, 0x17, 0x0B, 0x2E, 0xA2, 0xC7,
+    0x5C, 0x1C, 0x6D, 0x17, 0x8B, 0xED, 0xD1, 0xB8, 0x31, 0xD6, 0x5B, 0xBC, 0xFE, 0xEC, 0x9E, 0x14,
+    0xDE, 0xA1, 0x66, 0xE6, 0x6D, 0x3C, 0xFF, 0x00, 0xBD, 0x55, 0xB1, 0x6E, 0xE3, 0x46, 0x10, 0x7D,
+    0x4B, 0x46, 0x52, 0x00, 0x16, 0xBC, 0xE2, 0x0E, 0x49, 0xE0, 0x82, 0x6D, 0x10, 0xE0, 0xC0, 0x36,
+    0x45, 0x24, 0x6E, 0x60, 0x20, 0xCD, 0x15, 0x72, 0x61, 0x26, 0xC0, 0x5D, 0x71, 0xF9, 0x03, 0xFD,
+    0xC0, 0x49, 0x62, 0xFE, 0xC0, 0x45, 0xFC, 0x0D, 0x01, 0x9C, 0x26, 0xC5, 0x95, 0xB4, 0xAD, 0x83,
+    0x7F, 0x60, 0x13, 0x17, 0x69, 0x09, 0x44, 0xEA, 0x59, 0xAC, 0x61, 0xF9, 0x40, 0x6A, 0xF2, 0x86,
+    0x92, 0x95, 0x20, 0xBE, 0x2A, 0x77, 0x89, 0x04, 0x0C, 0xB0, 0x4B, 0xCE, 0xEC, 0x7B, 0x6F, 0x66,
+    0x1F, 0x81, 0xED, 0xCF, 0x97, 0x1A, 0xD6, 0x1A, 0x6A, 0x0D, 0x95, 0x86, 0x42, 0x03, 0x30, 0x71,
+    0x1E, 0xA1, 0x34, 0x1E, 0xF1, 0x72, 0xE2, 0x91, 0x14, 0x03, 0x8F, 0x0C, 0x81, 0xC7, 0x08, 0xC6,
+    0x63, 0xAA, 0xAF, 0xFC, 0x23, 0x0C, 0x35, 0x64, 0xFA, 0x34, 0x45, 0xC8, 0x34, 0x17, 0x7B, 0x0C,
+    0xA4, 0xF5, 0x30, 0xE2, 0x5F, 0x03, 0x3D, 0x96, 0x0D, 0x65, 0x63, 0x19, 0x64, 0x8D, 0xF0, 0xE6,
+    0xB9, 0xD8, 0xB0, 0x42, 0xEA, 0x18, 0x06, 0x35, 0x83, 0x59, 0x33, 0xA0, 0xD1, 0x50, 0x6A, 0x98,
+    0x7E, 0x72, 0x73, 0x8C, 0x69, 0x26, 0x0D, 0x66, 0x19, 0x13, 0xA6, 0xDD, 0xDE, 0xFE, 0x69, 0x73,
+    0x9F, 0xD1, 0xE5, 0x26, 0x2E, 0x5C, 0x7D, 0xCB, 0x7A, 0xC2, 0xB7, 0x19, 0x8A, 0x1D, 0x3D, 0x85,
+    0x84, 0xD8, 0xE2, 0x8B, 0x9F, 0xEF, 0x90, 0x70, 0xDB, 0xE4, 0x33, 0xAB, 0x1B, 0xE6, 0xE2, 0xD0,
+    0x29, 0xB5, 0xB0, 0x7D, 0xD1, 0x9A, 0x35, 0xE6, 0xB6, 0x41, 0xE4, 0x94, 0x57, 0x62, 0x31, 0x1C,
+    0x38, 0xC4, 0x5F, 0x93, 0xBA, 0x53, 0x52, 0x4C, 0x1E, 0x86, 0x35, 0x12, 0x5B, 0x2A, 0x1F, 0x17,
+    0x79, 0x23, 0x32, 0x65, 0xAD, 0x67, 0x16, 0x8F, 0x41, 0x76, 0x0D, 0xD7, 0x78, 0x92, 0xB3, 0x2A,
+    0x32, 0x91, 0xB1, 0xC8, 0xF5, 0x2A, 0x3F, 0xF2, 0xDD, 0xC1, 0x4C, 0x0D, 0x5D, 0xA7, 0xA4, 0x2E,
+    0x44, 0xAE, 0x44, 0xEA, 0xBB, 0xFC, 0xE8, 0xC1, 0x13, 0x2E, 0x98, 0x23, 0xD2, 0xB2, 0x00, 0x19,
+    0xB4, 0x2C, 0x54, 0x99, 0xFC, 0xB8, 0xC3, 0x3F, 0x59, 0x22, 0x95, 0x2A, 0x5A, 0x4E, 0x7E, 0xF0,
+    0x28, 0x33, 0x84, 0x7F, 0x54, 0xC8, 0x66, 0xF9, 0x77, 0xB7, 0x22, 0x32, 0x3F, 0x3B, 0xFB, 0xC9,
+    0x75, 0x15, 0x88, 0x0F, 0x29, 0x11, 0x6C, 0xF0, 0x29, 0xB9, 0xBB, 0x88, 0x62, 0x19, 0x8B, 0x3E,
+    0x3E, 0x36, 0x2E, 0x62, 0xB1, 0x22, 0xA4, 0x1E, 0x2A, 0xBE, 0x2A, 0xE3, 0x79, 0xCE, 0x28, 0xCF,
+    0x1F, 0x20, 0xE0, 0x82, 0xDA, 0x11, 0x41, 0x7C, 0x9A, 0x3F, 0x78, 0xC2, 0x85, 0xE6, 0x90, 0x1C,
+    0x0B, 0x04, 0xAC, 0xF5, 0xA5, 0xA9, 0x02, 0x2A, 0x1D, 0xC9, 0xB6, 0xAB, 0xEF, 0x07, 0x54, 0x4B,
+    0x50, 0x73, 0x4E, 0x16, 0x3E, 0xDF, 0xB5, 0xED, 0x83, 0x00, 0x85, 0x61, 0x25, 0x8E, 0x76, 0xBC,
+    0x00, 0xBE, 0xBF, 0x1F, 0x88, 0xF7, 0x01, 0xFA, 0x41, 0x1A, 0x8C, 0x18, 0x88, 0x2C, 0x06, 0x0B,
+    0x18, 0x9D, 0x67, 0xAE, 0xF9, 0xD6, 0xF1, 0xBF, 0x84, 0xD5, 0xC0, 0xBC, 0xE4, 0x36, 0x09, 0xBE,
+    0xEE, 0xAA, 0xE2, 0x9C, 0x67, 0x35, 0x54, 0xD4, 0xF6, 0xD0, 0x0B, 0xEA, 0xD8, 0xA6, 0x89, 0xD5,
+    0xEE, 0x67, 0x45, 0x27, 0xB4, 0x4A, 0xA7, 0x20, 0xC6, 0xA7, 0xF9, 0xE1, 0x3B, 0xA4, 0x53, 0x51,
+    0xC9, 0x62, 0x95, 0xDB, 0x77, 0xF1, 0x63, 0xCE, 0xB6, 0x2B, 0x86, 0x0D, 0x1B, 0x06, 0xB5, 0xF1,
+    0x0D, 0xE7, 0x9F, 0x80, 0x78, 0xFA, 0x51, 0x27, 0x6D, 0x7F, 0x63, 0x03, 0xD9, 0xE0, 0xE2, 0x9B,
+    0x75, 0x62, 0xA3, 0xAB, 0x1A, 0xA3, 0x11, 0xC2, 0xDB, 0x55, 0x3E, 0x9F, 0x8B, 0xDC, 0xBE, 0x3D,
+    0x3B, 0xE3, 0x75, 0xD2, 0x72, 0x19, 0xBA, 0x56, 0xC7, 0x95, 0x29, 0x32, 0x0E, 0xFB, 0x25, 0xE1,
+    0xF1, 0x26, 0x6D, 0xE7, 0x68, 0xA3, 0xD7, 0xB5, 0x65, 0x28, 0xF9, 0x72, 0x54, 0x30, 0x3C, 0xC6,
+    0xA3, 0x5D, 0xE3, 0x2E, 0xE5, 0x84, 0x12, 0x49, 0x15, 0x6E, 0xEC, 0x44, 0x09, 0x21, 0x50, 0xDB,
+    0xD2, 0xE6, 0xE2, 0x1C, 0x5B, 0x6D, 0x10, 0xEB, 0xC5, 0x1F, 0xA1, 0xEB, 0x7B, 0x2C, 0x57, 0xD4,
+    0x50, 0xB8, 0x95, 0x97, 0x7A, 0x66, 0x4D, 0xAB, 0x8B, 0xDE, 0x30, 0x27, 0xA5, 0x37, 0xA1, 0xA4,
+    0x9B, 0x05, 0x75, 0x74, 0x87, 0x83, 0xC5, 0x80, 0x1A, 0x23, 0x10, 0x59, 0x6E, 0x41, 0xF4, 0x28,
+    0xD4, 0x5C, 0x4D, 0xCA, 0x62, 0x44, 0x1F, 0xAB, 0x12, 0x7C, 0xC4, 0xBF, 0xFE, 0x0E, 0xFC, 0x67,
+    0x6A, 0x1A, 0xD9, 0xE9, 0xE5, 0xAF, 0xF4, 0x8C, 0xF1, 0x02, 0xE7, 0xB4, 0x8C, 0x1B, 0x3A, 0xC5,
+    0xEF, 0x74, 0x8C, 0x97, 0x34, 0x0A, 0x35, 0x0C, 0x2E, 0xAF, 0xE9, 0x17, 0xCF, 0x1C, 0x5A, 0xB5,
+    0x8B, 0x44, 0x6E, 0x5D, 0x22, 0x63, 0x6B, 0xEC, 0x70, 0xEB, 0xAA, 0x6C, 0x3C, 0xB2, 0xF0, 0xC7,
+    0x81, 0xA7, 0xD4, 0xF6, 0x40, 0x38, 0x03, 0xBC, 0xA8, 0xC0, 0x53, 0xFC, 0xA2, 0x0D, 0x20, 0xFE,
+    0xF9, 0x1A, 0xFB, 0x5B, 0x45, 0xB0, 0x84, 0x15, 0xA9, 0x5F, 0xCA, 0xC9, 0xC1, 0x22, 0x56, 0x7B,
+    0xBE, 0xB8, 0x27, 0xAB, 0x93, 0x80, 0x46, 0x57, 0xD5, 0x5F, 0xD4, 0x43, 0xA9, 0x77, 0xD4, 0x9F,
+    0x4C, 0x54, 0x9B, 0x32, 0x55, 0xEA, 0x33, 0x52, 0x5F, 0x50, 0xD7, 0xD4, 0x30, 0x94, 0xC1, 0xC6,
+    0xF6, 0x6B, 0xFA, 0x96, 0x2C, 0x28, 0xEA, 0x1D, 0x74, 0x34, 0x8C, 0xED, 0x23, 0xC2, 0x57, 0xCC,
+    0x74, 0x48, 0x5A, 0xEC, 0xA6, 0x05, 0xFD, 0xB6, 0x6F, 0x45, 0x86, 0xF1, 0x6A, 0xE2, 0x67, 0x48,
+    0xC8, 0x2B, 0x1D, 0x17, 0x98, 0x92, 0xE6, 0xDF, 0x59, 0xAB, 0xED, 0x73, 0x14, 0x7E, 0xA3, 0xF7,
+    0x1F, 0xFA, 0xA0, 0x55, 0xC7, 0x1F, 0xC8, 0xB5, 0xC3, 0x11, 0xE7, 0x47, 0x27, 0xC7, 0xD4, 0xDA,
+    0xA6, 0x95, 0x69, 0x75, 0x66, 0xFB, 0xB2, 0xA7, 0xA7, 0x9F, 0x1E, 0x9D, 0x04, 0x04, 0x7B, 0xBB,
+    0xFE, 0x1F, 0x19, 0x77, 0xEE, 0x90, 0xEE, 0xEA, 0x9D, 0xEC, 0x4F, 0xFF, 0xAF, 0x18, 0xEB, 0x2F,
+    0xE2, 0xD1, 0x9C, 0xB3, 0x0D, 0xB2, 0x65, 0xBF, 0x0E, 0x75, 0x37, 0x2D, 0x76, 0x00, 0x22, 0x87,
+    0xEE, 0x66, 0x74, 0x86, 0xB5, 0xA7, 0x27, 0xCD, 0x8E, 0x5E, 0xEF, 0xC5, 0x95, 0x5E, 0xFD, 0x48,
+    0xE9, 0x25, 0x05, 0xE9, 0x65, 0x96, 0xF4, 0x38, 0xA5, 0x29, 0x2E, 0x4F, 0x4C, 0x09, 0xDE, 0x30,
+    0x22, 0xD5, 0x6F, 0xEB, 0xEE, 0x2A, 0x6E, 0x3F, 0x7B, 0xC0, 0x2B, 0x95, 0xB7, 0xAB, 0xA6, 0x5B,
+    0x8F, 0xF6, 0x34, 0xFF, 0x04, 0xA5, 0x55, 0xBF, 0x6F, 0x1B, 0x37, 0x14, 0xFE, 0x28, 0xDA, 0x11,
+    0x50, 0x0E, 0x97, 0xC1, 0x05, 0x5A, 0x7B, 0xB8, 0xB5, 0x43, 0x1A, 0x2D, 0x19, 0x25, 0x91, 0x45,
+    0xC6, 0x0C, 0x11, 0x8C, 0x6A, 0xEA, 0x90, 0x8C, 0xD9, 0x9C, 0x3F, 0xC0, 0x96, 0x2E, 0x59, 0xB3,
+    0x36, 0xE8, 0xDA, 0xA1, 0x43, 0xB7, 0x2E, 0x1D, 0x3C, 0x9C, 0x7D, 0x84, 0x97, 0x00, 0xED, 0xE0,
+    0x0B, 0xDA, 0xA2, 0xA3, 0xB5, 0x78, 0x69, 0x87, 0x5C, 0x9A, 0x0B, 0x7A, 0x28, 0x4E, 0x7A, 0xFD,
+    0x48, 0x2B, 0x48, 0x0A, 0xBB, 0xB5, 0x9C, 0xF2, 0xF8, 0x78, 0x8F, 0x8F, 0xE4, 0xFB, 0xC1, 0x47,
+    0x7E, 0x04, 0x1C, 0xD0, 0x25, 0xF5, 0x81, 0x4E, 0x05, 0x24, 0x19, 0xB0, 0x81, 0x58, 0xB6, 0xEA,
+    0x8F, 0xB5, 0xB4, 0xB5, 0x7D, 0x5A, 0x3C, 0x6F, 0x30, 0xBD, 0xEB, 0x71, 0x30, 0x84, 0x7A, 0x5D,
+    0x43, 0xFF, 0x5A, 0x22, 0xB9, 0xE7, 0x30, 0xD8, 0x03, 0x6A, 0x76, 0x7F, 0xAA, 0x90, 0xDE, 0x29,
+    0x31, 0x4F, 0x4A, 0x53, 0xA7, 0xF2, 0x67, 0x99, 0xCA, 0x5D, 0xA7, 0xDC, 0x80, 0x1A, 0x6A, 0xAA,
+    0xF6, 0x80, 0xD5, 0x5F, 0x76, 0xEB, 0x44, 0xC4, 0x6D, 0xC9, 0x8C, 0xD2, 0x11, 0x69, 0x41, 0x92,
+    0x12, 0xC8, 0xA9, 0x63, 0xBF, 0x5B, 0xD2, 0xE4, 0xF5, 0x68, 0x93, 0x2B, 0x6E, 0x72, 0x65, 0x72,
+    0xEC, 0xA0, 0x5F, 0x71, 0xBC, 0xA5, 0xC0, 0x9E, 0x13, 0x58, 0x11, 0x39, 0x26, 0xBD, 0x3A, 0x1D,
+    0x8F, 0x2F, 0x9E, 0x71, 0x4E, 0x10, 0x83, 0x4A, 0x68, 0x5E, 0x8B, 0x3B, 0x33, 0x7B, 0x53, 0xD5,
+    0x50, 0x4E, 0xE1, 0x9D, 0x92, 0x93, 0x8C, 0xBF, 0x98, 0xD9, 0x6A, 0x60, 0x8E, 0xA5, 0x46, 0x71,
+    0xBA, 0xE3, 0x4D, 0x8D, 0x03, 0x1C, 0x42, 0xCF, 0x4C, 0x89, 0x21, 0xE7, 0x90, 0xF1, 0xAB, 0x31,
+    0x9A, 0xFE, 0xEC, 0x23, 0x78, 0xE7, 0x03, 0xDB, 0xAE, 0x4F, 0xC6, 0xE3, 0x7B, 0x3F, 0x4B, 0x28,
+    0x2F, 0x42, 0x33, 0x8F, 0xD2, 0x77, 0x26, 0x20, 0xC4, 0xEA, 0x35, 0x9B, 0x16, 0x43, 0xCE, 0xF5,
+    0xE7, 0x26, 0x5C, 0xCA, 0x62, 0x19, 0x43, 0xA0, 0x9D, 0xDF, 0xBE, 0x45, 0x41, 0x55, 0x5F, 0xFC,
+    0xF2, 0xF9, 0x52, 0xB6, 0x01, 0xF3, 0x4C, 0x66, 0xE6, 0x44, 0x1A, 0xD3, 0xA2, 0x35, 0x15, 0xF6,
+    0x42, 0x50, 0xC1, 0xD7, 0x55, 0x48, 0xB9, 0xB5, 0xB4, 0xBE, 0x31, 0x94, 0xF6, 0x56, 0x5A, 0x5D,
+    0x0F, 0x47, 0x09, 0x86, 0xCA, 0x98, 0x66, 0x6E, 0xF0, 0x15, 0xAB, 0x91, 0x32, 0x91, 0xD9, 0x1B,
+    0x85, 0xCD, 0xC3, 0xA0, 0x30, 0x96, 0x07, 0x31, 0x0D, 0x2B, 0xD7, 0xA9, 0x3C, 0x93, 0xF9, 0x87,
+    0x63, 0xFA, 0xD2, 0x93, 0xC7, 0xD2, 0x30, 0xCB, 0xA9, 0x5B, 0xA9, 0xE9, 0x48, 0x6D, 0x25, 0x9B,
+    0xCA, 0x8F, 0xD2, 0xC6, 0xE5, 0xEA, 0x6B, 0xF4, 0xC2, 0x9D, 0xB8, 0xAC, 0xB9, 0x8F, 0xAF, 0xDC,
+    0xA7, 0x56, 0x3C, 0xA3, 0x0E, 0x47, 0xFB, 0xBD, 0xAC, 0x8E, 0xF0, 0x04, 0x7D, 0x2B, 0x8F, 0x96,
+    0x3A, 0x56, 0x35, 0x5D, 0x2C, 0x8A, 0x45, 0xB7, 0xBC, 0xEC, 0x2B, 0xE6, 0xB2, 0xC0, 0xF7, 0x6A,
+    0xA6, 0x3D, 0xBF, 0xD3, 0xCE, 0x02, 0x1B, 0xCA, 0xE5, 0xC6, 0x7F, 0x42, 0x43, 0xD7, 0x32, 0x32,
+    0x17, 0xD5, 0xCF, 0x66, 0x7D, 0xED, 0x87, 0xDB, 0x0B, 0xDE, 0x10, 0x17, 0x74, 0x74, 0xB2, 0x90,
+    0x8A, 0xD5, 0xED, 0x3D, 0xC8, 0xFF, 0x59, 0x8A, 0x85, 0xFA, 0x43, 0x9A, 0xAE, 0xDF, 0x43, 0xCA,
+    0xC0, 0x77, 0xBB, 0xA5, 0xAA, 0x52, 0x77, 0xF5, 0x6E, 0x4F, 0xDC, 0xAE, 0x2C, 0x54, 0x75, 0x06,
+    0x2C, 0x3D, 0xEE, 0x54, 0x83, 0xAE, 0x78, 0xA4, 0x73, 0x60, 0xD3, 0xF1, 0x92, 0x6F, 0x57, 0xFA,
+    0x77, 0x9F, 0xFC, 0x80, 0x8F, 0xE2, 0xD1, 0xB9, 0x96, 0x7D, 0xB0, 0x83, 0x61, 0x8E, 0xBF, 0xA2,
+    0xF4, 0xBB, 0xFF, 0x64, 0x67, 0x01, 0xFB, 0x86, 0x40, 0x03, 0x5D, 0xAE, 0x59, 0xD8, 0x06, 0x92,
+    0x61, 0x9D, 0xD0, 0xE1, 0x51, 0xCC, 0x3A, 0x2F, 0xE9, 0xFB, 0x60, 0x3D, 0xF4, 0xC1, 0xB4, 0xFD,
+    0xDF, 0x4A, 0xC7, 0xA7, 0x98, 0xCE, 0x31, 0xAD, 0x83, 0xD7, 0x74, 0x5B, 0x37, 0xB0, 0xB5, 0x7E,
+    0x59, 0x13, 0x94, 0x46, 0xF1, 0x1A, 0x6D, 0x86, 0xA3, 0xCC, 0x1C, 0xF3, 0x92, 0xF5, 0xAE, 0xC0,
+    0x4E, 0x50, 0x54, 0x8A, 0xE0, 0xCA, 0xEB, 0x7F, 0x90, 0x38, 0x1C, 0x12, 0x01, 0x26, 0x04, 0xD5,
+    0x09, 0x05, 0x16, 0x89, 0xB3, 0x8C, 0xCD, 0x12, 0x65, 0x49, 0x03, 0x52, 0xB2, 0x93, 0x11, 0x0F,
+    0x09, 0x8F, 0x32, 0x65, 0x9C, 0xDD, 0x8A, 0x33, 0x88, 0x6A, 0x65, 0x52, 0x72, 0x49, 0x80, 0x90,
+    0xD4, 0x27, 0xAE, 0xD3, 0x50, 0x87, 0x75, 0xC4, 0xF9, 0x8A, 0x4A, 0x27, 0x6F, 0xC1, 0x32, 0x71,
+    0x67, 0x49, 0xE8, 0x10, 0x64, 0xC0, 0x84, 0x2C, 0x11, 0x3C, 0xA0, 0x4A, 0x7E, 0xFE, 0xA7, 0xBE,
+    0xC9, 0x61, 0x8D, 0x4F, 0x7C, 0xAE, 0x2B, 0xE3, 0x5B, 0xE4, 0x96, 0x70, 0xEA, 0x71, 0xD8, 0x06,
+    0xC0, 0x40, 0xD1, 0x73, 0x51, 0x18, 0xC6, 0xD2, 0x2C, 0xC7, 0x81, 0xF1, 0xBA, 0xCA, 0x89, 0x60,
+    0x4B, 0x5B, 0x4C, 0x4E, 0x78, 0xA0, 0x4C, 0x16, 0x2D, 0xAD, 0x05, 0x4C, 0xD8, 0xBC, 0x13, 0xA7,
+    0xB4, 0xC6, 0x5B, 0xE4, 0xA6, 0x34, 0x47, 0x35, 0xF2, 0x09, 0xCC, 0x09, 0xB3, 0x25, 0x30, 0xAF,
+    0x1B, 0xEA, 0x28, 0xE3, 0x98, 0x6A, 0x8C, 0x37, 0x65, 0xB4, 0x8E, 0x56, 0x8D, 0x22, 0x22, 0xB6,
+    0x11, 0x73, 0xFA, 0x51, 0xD5, 0xF2, 0xD9, 0x19, 0xC4, 0x88, 0x02, 0x62, 0x5E, 0xAD, 0xF3, 0x74,
+    0x7C, 0x5B, 0xA4, 0x11, 0x1E, 0xCA, 0x51, 0x9A, 0xD1, 0x9B, 0x5D, 0xE5, 0xE2, 0x53, 0xD2, 0x61,
+    0x28, 0xBD, 0xCB, 0x7E, 0xEF, 0x6D, 0x95, 0x9D, 0xD3, 0xF1, 0x88, 0x56, 0xF9, 0x3C, 0x64, 0xCB,
+    0x4D, 0xA2, 0x3C, 0x8D, 0x7B, 0xA4, 0xB9, 0x6D, 0x74, 0xC2, 0x1C, 0x55, 0x79, 0xEF, 0x5F, 0x1A,
+    0x6E, 0xE9, 0xF3, 0x6A, 0xBF, 0xBF, 0x86, 0xBF, 0x01, 0xC5, 0x94, 0xB1, 0x6E, 0xD4, 0x40, 0x10,
+    0x86, 0x7F, 0xEF, 0x72, 0xB1, 0xD0, 0x16, 0xA6, 0x08, 0x12, 0x9D, 0xDF, 0x00, 0xB7, 0x14, 0xF1,
+    0xD9, 0x01, 0x41, 0x43, 0xC1, 0x15, 0xDC, 0x1B, 0xA4, 0x4F, 0x43, 0x41, 0x71, 0x97, 0x73, 0x45,
+    0xCD, 0xC3, 0x50, 0x3A, 0xD8, 0x28, 0x65, 0x0A, 0x16, 0x5D, 0x49, 0xC1, 0x15, 0x50, 0xD1, 0xAC,
+    0x84, 0x11, 0x96, 0x70, 0x6E, 0xF9, 0xC7, 0x77, 0x09, 0x51, 0x82, 0x92, 0x20, 0x22, 0xB2, 0xD6,
+    0xDA, 0x9F, 0xBD, 0xF6, 0x3F, 0x33, 0x3B, 0x33, 0x4E, 0x11, 0x3D, 0xCB, 0xF5, 0x81, 0x0D, 0x5C,
+    0x83, 0x37, 0x29, 0x1E, 0x44, 0x39, 0xB4, 0x05, 0x1A, 0x20, 0x05, 0x2E, 0xBE, 0xF9, 0x32, 0x1E,
+    0x79, 0xBF, 0xCC, 0xBC, 0x2F, 0x80, 0x72, 0x58, 0xA6, 0xE5, 0x56, 0xF9, 0xA2, 0x1C, 0x95, 0xB8,
+    0xEC, 0xB8, 0x48, 0x78, 0x14, 0xE5, 0x43, 0x6D, 0xE3, 0xA2, 0x51, 0xC5, 0xA5, 0x26, 0xCF, 0x1F,
+    0x77, 0xCA, 0xB2, 0xEC, 0xCA, 0x9D, 0xF3, 0x2B, 0xA2, 0xC2, 0xEF, 0x45, 0x46, 0xD4, 0xCE, 0xDE,
+    0x7E, 0x70, 0x88, 0xAA, 0x1A, 0x59, 0x83, 0x60, 0x09, 0x64, 0x0B, 0x04, 0x3E, 0x47, 0x70, 0xE6,
+    0xE5, 0xE1, 0x78, 0x0C, 0x1A, 0xD7, 0xDE, 0xB7, 0x10, 0xEB, 0x09, 0x4C, 0xAD, 0xDC, 0x29, 0xC8,
+    0x93, 0xC6, 0x74, 0xBA, 0xE5, 0xF4, 0x67, 0x97, 0x08, 0xC0, 0x80, 0x22, 0xE8, 0x38, 0x33, 0xCE,
+    0x90, 0xAA, 0x70, 0x9C, 0xB7, 0xD0, 0x0F, 0x4D, 0x4E, 0xB3, 0x02, 0x7A, 0x7E, 0x24, 0xE0, 0x08,
+    0x9F, 0x0A, 0xA4, 0x5B, 0xFB, 0x84, 0x03, 0x47, 0x88, 0x0B, 0x3D, 0xAF, 0x3B, 0xA4, 0xA9, 0x76,
+    0x7A, 0xCE, 0x1D, 0x4A, 0x53, 0x74, 0x04, 0xED, 0x08, 0xC9, 0xA3, 0xB9, 0x45, 0x47, 0x08, 0xBF,
+    0x11, 0x92, 0x29, 0x3D, 0xF7, 0x84, 0xF0, 0x88, 0x90, 0x10, 0x40, 0xCD, 0xE7, 0x8C, 0xA2, 0xEE,
+    0xCD, 0x4C, 0x48, 0xB4, 0x28, 0xDE, 0x60, 0x63, 0xDB, 0x17, 0xA5, 0xF7, 0x4F, 0x97, 0x4F, 0xBA,
+    0x0A, 0xE6, 0xE3, 0x02, 0x43, 0x1A, 0xFC, 0x5A, 0x63, 0x58, 0x5E, 0x7C, 0x59, 0x30, 0x06, 0x3D,
+    0x6F, 0xC5, 0x55, 0x4B, 0xF0, 0x84, 0xB4, 0x25, 0x1C, 0x5A, 0xBA, 0x9A, 0x11, 0xDE, 0xB5, 0x84,
+    0xA8, 0xA6, 0x87, 0x19, 0x97, 0x82, 0x96, 0x10, 0xD5, 0xF4, 0x30, 0x23, 0xA8, 0x86, 0x10, 0x1D,
+    0xD0, 0xB1, 0x19, 0x41, 0xFD, 0x20, 0x44, 0xE2, 0xEA, 0x8C, 0xA0, 0x04, 0x22, 0x8B, 0x93, 0x61,
+    0xEA, 0x55, 0x1A, 0x7A, 0x9F, 0x95, 0x2C, 0x6C, 0x02, 0x3B, 0x71, 0x6B, 0xDE, 0xFB, 0xA6, 0xFA,
+    0xBC, 0x7B, 0xE8, 0xB0, 0xFF, 0x96, 0x6E, 0xD9, 0x4B, 0x5D, 0x96, 0xCB, 0xB1, 0x68, 0x54, 0xF4,
+    0x9A, 0x31, 0x15, 0xEB, 0x5E, 0x10, 0x23, 0x1E, 0x61, 0xCD, 0x17, 0x12, 0x59, 0xAB, 0x16, 0x0C,
+    0x4F, 0x52, 0x35, 0xF8, 0x2F, 0xD9, 0x19, 0xD0, 0xCE, 0x44, 0x5B, 0xE5, 0x5A, 0x18, 0x29, 0xC0,
+    0x5A, 0xFC, 0xF9, 0x97, 0xEC, 0xC4, 0x4C, 0xAE, 0x72, 0xEB, 0x52, 0x93, 0x02, 0x96, 0xA4, 0xC3,
+    0xBC, 0xDA, 0xAE, 0x8A, 0x66, 0xE2, 0xFD, 0xE3, 0x90, 0x8A, 0x98, 0xE5, 0xA1, 0x0D, 0xA9, 0x89,
+    0x29, 0xBF, 0x08, 0x65, 0x77, 0x26, 0x57, 0x84, 0x2B, 0x25, 0xDF, 0xD8, 0xD3, 0xC9, 0x37, 0x76,
+    0x9D, 0x7C, 0xB4, 0x04, 0x33, 0x27, 0x64, 0x04, 0xFC, 0x3C, 0xDE, 0x89, 0xAC, 0xDF, 0x89, 0x74,
+    0xDD, 0x19, 0xD2, 0x7B, 0x61, 0xBD, 0xEA, 0x97, 0x58, 0x9A, 0xD1, 0xF3, 0xE9, 0xC6, 0xEB, 0x93,
+    0xC4, 0x7F, 0x91, 0xC4, 0x4F, 0xFF, 0x26, 0xF1, 0x9A, 0x29, 0xFD, 0x7D, 0x31, 0x4C, 0x44, 0xD7,
+    0x77, 0xBB, 0x91, 0x76, 0x8E, 0xE4, 0x34, 0x18, 0x8F, 0x8E, 0x6B, 0xCE, 0xB3, 0x38, 0x66, 0xDE,
+    0xE7, 0x6A, 0x99, 0xEF, 0xDA, 0xD0, 0x21, 0x74, 0xEC, 0x9D, 0xA0, 0x8D, 0x59, 0x1A, 0x9D, 0xB4,
+    0xF2, 0x54, 0xF6, 0x75, 0x28, 0xE5, 0x94, 0xFD, 0xE9, 0xD4, 0xAF, 0xCA, 0x7B, 0x7B, 0x92, 0x88,
+    0x52, 0xBE, 0xED, 0xA8, 0xA2, 0x9D, 0x5A, 0x22, 0xB1, 0xA8, 0xA8, 0xBC, 0xB2, 0x2B, 0xA5, 0x17,
+    0x78, 0x0F, 0xC5, 0x09, 0xFE, 0x5F, 0xFA, 0x91, 0x34, 0x72, 0x9F, 0x9B, 0xEF, 0xBB, 0x2C, 0x24,
+    0xED, 0x32, 0x04, 0x0D, 0x55, 0xBB, 0x29, 0x95, 0x4E, 0x4F, 0x79, 0x46, 0x43, 0x6D, 0x9C, 0x2B,
+    0x17, 0x59, 0xB3, 0xD0, 0xF2, 0x57, 0xAC, 0x58, 0x9F, 0x01, 0x6D, 0xDE, 0xC6, 0x3D, 0xE9, 0x98,
+    0x97, 0x12, 0x0B, 0xEB, 0x40, 0xF9, 0x75, 0xE3, 0xDC, 0x44, 0x7C, 0x85, 0x62, 0xDF, 0x1A, 0x16,
+    0x3D, 0x77, 0x7B, 0xD6, 0xAE, 0xFC, 0xBB, 0xAE, 0x38, 0x31, 0xDA, 0x94, 0x4A, 0xDF, 0x97, 0xB2,
+    0x61, 0x4C, 0xD1, 0x43, 0xA6, 0xF7, 0x7E, 0xC8, 0x30, 0x36, 0x83, 0x1B, 0x09, 0x16, 0x77, 0xF9,
+    0x97, 0xDF, 0xE3, 0x2F, 0x84, 0xCA, 0x81, 0x63, 0xAF, 0xD4, 0x0E, 0x01, 0xAE, 0x33, 0xE0, 0x6B,
+    0x1E, 0xBF, 0x00, 0xB5, 0x55, 0xAF, 0x73, 0xD4, 0x40, 0x14, 0xFE, 0x92, 0x70, 0x17, 0xB1, 0x22,
+    0x88, 0x33, 0xB4, 0xC3, 0xDC, 0x5F, 0x50, 0xF2, 0x0F, 0x34, 0x3F, 0xAA, 0x90, 0x9C, 0xE8, 0x81,
+    0x40, 0x60, 0xAA, 0x30, 0xD8, 0x0A, 0xCA, 0xDD, 0x0C, 0x02, 0x7B, 0x02, 0x87, 0x41, 0x60, 0xDA,
+    0x0A, 0x6C, 0xC5, 0x5D, 0x13, 0x06, 0x51, 0x49, 0xC0, 0xD6, 0x64, 0x86, 0xD6, 0xD4, 0xB0, 0x22,
+    0xE2, 0x80, 0xDC, 0x2D, 0xDF, 0xDB, 0xB4, 0x94, 0x99, 0xB6, 0x33, 0xA5, 0x73, 0xDD, 0xE4, 0x65,
+    0x93, 0xDD, 0xF7, 0xE3, 0xDB, 0x6F, 0xDF, 0xDB, 0x00, 0xB6, 0xB9, 0x86, 0xAD, 0x50, 0xF2, 0xAC,
+    0xD4, 0x4F, 0x67, 0xD6, 0x5F, 0xF7, 0x35, 0x42, 0xC0, 0xD3, 0x50, 0x39, 0x9C, 0x29, 0x5C, 0x0D,
+    0x8C, 0xED, 0x9D, 0x40, 0x26, 0x82, 0xA1, 0x4C, 0x78, 0xA5, 0x58, 0xEA, 0x29, 0x90, 0x99, 0x3A,
+    0xE6, 0x44, 0x7F, 0xFD, 0x74, 0x42, 0xFF, 0x63, 0xD1, 0x4D, 0xCF, 0x5D, 0x61, 0x60, 0x27, 0xD4,
+    0x14, 0x8C, 0x41, 0x2B, 0xB6, 0xB4, 0x09, 0x0E, 0x27, 0x15, 0x24, 0xE1, 0x11, 0xB2, 0x11, 0x42,
+    0xA3, 0x07, 0x26, 0x57, 0x47, 0x2F, 0xBE, 0x7C, 0xDD, 0x77, 0x2A, 0x0C, 0xB4, 0x53, 0x25, 0x70,
+    0x6B, 0x04, 0xAF, 0x4B, 0x74, 0x73, 0x8C, 0xB7, 0x40, 0xFB, 0x67, 0x07, 0x05, 0x02, 0x63, 0x6A,
+    0x7E, 0xCC, 0x77, 0x76, 0xDE, 0x14, 0x02, 0x0A, 0x11, 0x50, 0x43, 0x80, 0x51, 0x8D, 0x61, 0xBD,
+    0x39, 0x7D, 0xCE, 0x30, 0x9B, 0x62, 0xC3, 0x33, 0xE6, 0x21, 0xA3, 0x29, 0x33, 0x54, 0xA6, 0x84,
+    0x83, 0x26, 0xE0, 0x3A, 0x1A, 0x03, 0x82, 0xF2, 0x69, 0x11, 0xF0, 0xF3, 0x4E, 0xC3, 0x49, 0x62,
+    0x3E, 0x50, 0x0C, 0xE2, 0xC7, 0x59, 0x1E, 0x41, 0x95, 0x11, 0x95, 0x22, 0xA2, 0x3F, 0x17, 0x8F,
+    0x63, 0xDD, 0x5C, 0x74, 0x12, 0x53, 0x51, 0xAF, 0x62, 0xF4, 0x9A, 0x12, 0x53, 0xC2, 0x34, 0x42,
+    0x40, 0x3B, 0xFF, 0xD4, 0x0E, 0x35, 0x65, 0x82, 0x56, 0x4A, 0x8D, 0x44, 0x98, 0xD0, 0x36, 0x4E,
+    0x7B, 0x6D, 0xB2, 0x97, 0x1D, 0xFE, 0x78, 0x9B, 0x0D, 0x95, 0xE6, 0x34, 0xC7, 0xC7, 0x97, 0x3E,
+    0x6E, 0x07, 0xCD, 0x59, 0xF3, 0x8A, 0x66, 0xF5, 0x2A, 0xFD, 0xCB, 0xC0, 0xBD, 0x76, 0xB5, 0x97,
+    0x7D, 0xFB, 0x7D, 0xCC, 0x9D, 0x0A, 0x73, 0xAA, 0xBA, 0x76, 0xFB, 0x42, 0xD9, 0xD0, 0x0B, 0xAF,
+    0x4D, 0xAB, 0xC4, 0xC5, 0x0A, 0xB8, 0x30, 0x72, 0x8B, 0x16, 0x2F, 0x3F, 0x8F, 0xA9, 0x21, 0xD9,
+    0x51, 0x72, 0x01, 0xB9, 0x0C, 0xDE, 0x1A, 0xB3, 0x3D, 0x3C, 0xC9, 0xA3, 0x30, 0x18, 0x66, 0xA5,
+    0x57, 0xDB, 0x38, 0xD7, 0x66, 0x16, 0xE8, 0x70, 0xD5, 0x39, 0xDC, 0xCA, 0x66, 0x4F, 0x40, 0x0E,
+    0x6C, 0x26, 0x62, 0xD9, 0x94, 0xAC, 0x88, 0x4F, 0xB3, 0xD6, 0x5E, 0x62, 0x33, 0x4A, 0x66, 0xA5,
+    0x4B, 0x52, 0x38, 0x4C, 0x2B, 0xDF, 0xA4, 0x50, 0x56, 0xF8, 0xCE, 0x14, 0x0A, 0x48, 0x62, 0xDC,
+    0x68, 0xB0, 0x53, 0x87, 0xA3, 0x76, 0xCD, 0xFC, 0x66, 0x72, 0xA7, 0x12, 0x00, 0x4E, 0x4F, 0x92,
+    0x2C, 0xB0, 0xC4, 0xAD, 0x02, 0x77, 0x9B, 0xB2, 0x7B, 0xDF, 0x35, 0x75, 0xB2, 0x36, 0x7E, 0x09,
+    0xF0, 0x7E, 0xC5, 0x8C, 0x2D, 0xA1, 0xE6, 0x29, 0x32, 0x6D, 0x5D, 0x4E, 0xAC, 0xAB, 0x78, 0x03,
+    0x93, 0x81, 0x99, 0x86, 0xAC, 0x91, 0x9E, 0xE5, 0x90, 0x85, 0xC0, 0x92, 0x40, 0xF7, 0x51, 0xEE,
+    0x15, 0x0F, 0xE8, 0xA9, 0xB7, 0x78, 0xB4, 0x14, 0x43, 0x78, 0x43, 0x75, 0x50, 0x76, 0x51, 0x75,
+    0xEC, 0xD8, 0x4D, 0xD0, 0x2E, 0x14, 0xD8, 0x4A, 0x93, 0xA9, 0x61, 0x53, 0xE6, 0x7C, 0x5D, 0xAA,
+    0xAD, 0x8B, 0xFF, 0x06, 0x46, 0xA5, 0x4D, 0x52, 0x98, 0x4A, 0xC6, 0xFA, 0xB9, 0xFB, 0x31, 0xF5,
+    0x66, 0x4C, 0xDA, 0x16, 0x22, 0x97, 0x07, 0x4D, 0x4D, 0x48, 0x90, 0xA4, 0x5F, 0x38, 0xFE, 0x8E,
+    0xF0, 0xDA, 0x21, 0x9F, 0xEA, 0x73, 0x49, 0x6E, 0xC9, 0xB0, 0xE5, 0xF5, 0x26, 0xC4, 0xCA, 0xC9,
+    0x29, 0xD2, 0x7F, 0x7A, 0xDC, 0xB7, 0xA4, 0x2C, 0x42, 0x5C, 0xAE, 0xD9, 0xA3, 0xF8, 0xAC, 0x04,
+    0x01, 0x22, 0x79, 0xBA, 0xC4, 0xF2, 0x0D, 0x0B, 0x41, 0x79, 0x5F, 0x74, 0x58, 0x96, 0x27, 0xEF,
+    0x8C, 0x59, 0x3E, 0xEE, 0x6D, 0xC1, 0x2F, 0x70, 0xE1, 0x41, 0x15, 0x1E, 0xD4, 0x46, 0x93, 0x8D,
+    0x15, 0xF1, 0xC5, 0xBD, 0x5A, 0x65, 0xBF, 0x54, 0xBB, 0x73, 0x9E, 0xB7, 0xBC, 0x34, 0x0F, 0xE9,
+    0x2D, 0xF9, 0x55, 0xD0, 0x6F, 0xA0, 0x4F, 0x0F, 0x61, 0xDC, 0xCE, 0x7A, 0x6C, 0x8B, 0x9B, 0x35,
+    0x6D, 0x3A, 0x85, 0x22, 0xFA, 0x1E, 0xC7, 0x9D, 0xF9, 0x36, 0xE3, 0x69, 0x67, 0xBF, 0x2F, 0x98,
+    0x09, 0xFA, 0xEA, 0x2E, 0x6A, 0xFE, 0x0C, 0x21, 0x77, 0x8A, 0x7B, 0xC1, 0x52, 0x3B, 0xC3, 0xF9,
+    0x7C, 0xF7, 0x64, 0xFB, 0xAA, 0xB8, 0xED, 0xDD, 0x5F, 0x23, 0x66, 0x4C, 0xD9, 0xDE, 0x3D, 0x19,
+    0x5D, 0x13, 0xE7, 0xE5, 0xDC, 0x0E, 0xCC, 0x77, 0x33, 0xBB, 0x94, 0x5B, 0x07, 0x0B, 0x6A, 0x7F,
+    0x00, 0xBD, 0x55, 0x4D, 0x8E, 0xDC, 0x44, 0x14, 0xFE, 0xCA, 0x95, 0x4E, 0x09, 0x59, 0xA8, 0xB2,
+    0x48, 0x36, 0x59, 0x8C, 0xD7, 0x89, 0xD0, 0xD4, 0x05, 0x66, 0xEC, 0x42, 0x1C, 0x80, 0x59, 0x64,
+    0xEE, 0x90, 0x25, 0x0B, 0x16, 0x2C, 0x3C, 0xD3, 0x96, 0x38, 0x00, 0x07, 0x60, 0x01, 0xEB, 0x2C,
+    0x20, 0x07, 0xF0, 0xA4, 0x0B, 0x38, 0x40, 0x0C, 0x61, 0x9F, 0xCA, 0x8F, 0x94, 0x45, 0x16, 0x29,
+    0xC0, 0x28, 0x1E, 0xE1, 0xEE, 0xE2, 0xAB, 0xEA, 0xCE, 0x02, 0x29, 0x02, 0x31, 0x43, 0x28, 0x75,
+    0xBB, 0xAC, 0x67, 0xBF, 0xF7, 0xBE, 0xEF, 0x7D, 0xEF, 0x95, 0x71, 0x05, 0xD7, 0x60, 0xC6, 0x03,
+    0xE8, 0xD5, 0x06, 0xA5, 0x88, 0x80, 0xBD, 0x82, 0xB4, 0x94, 0x03, 0xCE, 0x47, 0xA0, 0x3E, 0x01,
+    0xF4, 0x57, 0x16, 0xF2, 0xC5, 0xF0, 0xAF, 0x0C, 0x5F, 0xD0, 0xF0, 0x28, 0xA0, 0x08, 0x0F, 0x80,
+    0x59, 0x3F, 0x2F, 0x66, 0xC4, 0xB8, 0x86, 0x8A, 0x13, 0x20, 0x2C, 0x70, 0x24, 0xD0, 0x0C, 0x9F,
+    0xE8, 0x55, 0xC4, 0xB0, 0x74, 0x09, 0x03, 0xD7, 0x5D, 0x14, 0x5F, 0x3A, 0xD4, 0x3D, 0xE4, 0xCB,
+    0xBF, 0xDF, 0x4E, 0xCF, 0xA0, 0x9F, 0x8D, 0x72, 0x63, 0xE2, 0x1F, 0x7E, 0xB9, 0xDE, 0xC7, 0x75,
+    0x3A, 0xAF, 0x62, 0x07, 0x13, 0x03, 0xC4, 0xF1, 0x9D, 0x8C, 0xBF, 0xBD, 0x18, 0xEC, 0x37, 0x86,
+    0x89, 0x86, 0xC3, 0x06, 0x30, 0xA5, 0x87, 0x76, 0x1B, 0x6B, 0x9C, 0x8E, 0x71, 0xC0, 0x92, 0x59,
+    0x52, 0x3A, 0x19, 0x67, 0xDE, 0x0F, 0xBB, 0x64, 0x97, 0x02, 0x7E, 0x24, 0x3A, 0x7C, 0x80, 0xC0,
+    0x90, 0x4C, 0xB9, 0x1C, 0x93, 0xE5, 0x7F, 0x10, 0xE0, 0x2A, 0xDE, 0xC3, 0xA7, 0xC5, 0x90, 0x78,
+    0xE8, 0x0D, 0xB0, 0xC0, 0xA5, 0x79, 0x14, 0xCF, 0x59, 0x96, 0x57, 0x16, 0xC2, 0x05, 0xE0, 0xFE,
+    0x01, 0xB0, 0xB7, 0x47, 0x23, 0x1B, 0x0A, 0xDB, 0x86, 0x7A, 0xC7, 0x8A, 0xC0, 0x74, 0x28, 0xBF,
+    0x01, 0xFC, 0x7D, 0xBC, 0xAF, 0x80, 0x10, 0xA0, 0xD6, 0xFF, 0x09, 0xAF, 0xC5, 0x87, 0x47, 0x50,
+    0x3F, 0x4E, 0x90, 0x7E, 0x42, 0xE1, 0x49, 0xC2, 0x93, 0xDB, 0xB5, 0x2D, 0x27, 0x11, 0x2E, 0xAE,
+    0x4F, 0x32, 0x3C, 0xA3, 0x61, 0x9C, 0x81, 0x9E, 0xE0, 0x1B, 0x79, 0x8E, 0x15, 0x9A, 0x18, 0xAD,
+    0x88, 0x9B, 0x5D, 0x17, 0xDC, 0x59, 0x40, 0x7F, 0x1E, 0x8A, 0xD0, 0xA3, 0xD5, 0x56, 0xCB, 0x01,
+    0x36, 0x0F, 0xCA, 0xD5, 0x0E, 0xB7, 0xFE, 0x99, 0x0C, 0x37, 0xF5, 0x72, 0xC0, 0xA6, 0xB1, 0xCD,
+    0xD3, 0x18, 0x1F, 0xA8, 0xF8, 0x93, 0xA7, 0xF0, 0xEF, 0x4A, 0x05, 0x3E, 0xBB, 0xE1, 0x89, 0x8D,
+    0x15, 0xC1, 0x67, 0xFC, 0xEF, 0xA5, 0x16, 0xFE, 0x99, 0x97, 0xC8, 0x69, 0x5F, 0xD8, 0x8B, 0x4B,
+    0xA0, 0x3A, 0x08, 0x06, 0x66, 0xD1, 0x25, 0x27, 0xA2, 0x3E, 0x42, 0x3A, 0xA4, 0xD2, 0x11, 0x82,
+    0xED, 0xA0, 0xAB, 0x31, 0x6F, 0x4D, 0x4A, 0x0C, 0xF9, 0x34, 0x6F, 0xB5, 0xC8, 0x9B, 0x85, 0xC5,
+    0x6E, 0x55, 0x7C, 0x23, 0x53, 0x11, 0x33, 0xC4, 0x38, 0xA1, 0xE4, 0xEF, 0x87, 0x90, 0xBC, 0x9A,
+    0xD2, 0xE1, 0xB5, 0xC3, 0xA4, 0xAD, 0x7A, 0x68, 0xD5, 0x50, 0x63, 0x7F, 0x1F, 0x06, 0x3D, 0xC6,
+    0x16, 0xB3, 0x08, 0xCA, 0x8D, 0xD2, 0xCB, 0xC1, 0x48, 0x5F, 0x59, 0xDD, 0x4D, 0xA5, 0xEB, 0x61,
+    0xE4, 0x50, 0x49, 0x8F, 0xB6, 0x42, 0xAD, 0x2D, 0x18, 0xAB, 0x6F, 0x93, 0x92, 0xE2, 0xD7, 0x80,
+    0xF2, 0x31, 0xE4, 0xE3, 0x0E, 0x55, 0x0F, 0x7D, 0xC6, 0x84, 0x1E, 0x15, 0x71, 0x10, 0x6E, 0xE3,
+    0xC0, 0xF9, 0x03, 0x65, 0x55, 0x1E, 0x45, 0x02, 0xBC, 0xC8, 0xC8, 0x96, 0xE9, 0xAA, 0x62, 0x86,
+    0x6C, 0x12, 0xFC, 0xC1, 0xE4, 0x79, 0xD9, 0x4D, 0x0C, 0x6E, 0xA2, 0xF8, 0x1A, 0xB7, 0x4E, 0x50,
+    0xB9, 0x84, 0x79, 0xD5, 0x11, 0xB2, 0x7C, 0x85, 0xBA, 0x74, 0xFA, 0x00, 0x63, 0x65, 0xFB, 0x51,
+    0xB9, 0x9A, 0x94, 0x09, 0x57, 0x2B, 0x37, 0x89, 0xD0, 0xEA, 0x8F, 0x06, 0xF9, 0xC8, 0xEF, 0x57,
+    0x69, 0xFC, 0x5B, 0x42, 0x6D, 0xF1, 0x9B, 0xC7, 0xA9, 0xA7, 0x13, 0x75, 0x28, 0x67, 0x48, 0x8E,
+    0xBB, 0x07, 0xB5, 0x6B, 0xEC, 0xB6, 0x88, 0x09, 0x96, 0x88, 0x2E, 0xD7, 0x04, 0x63, 0xD9, 0xF1,
+    0x24, 0xCE, 0xC7, 0x4F, 0x41, 0xE0, 0xED, 0x29, 0x72, 0x75, 0x0C, 0x26, 0xE8, 0xCE, 0xA0, 0x74,
+    0x2C, 0x85, 0x47, 0xCF, 0x67, 0x2C, 0x05, 0x52, 0x5B, 0xA2, 0x39, 0xD9, 0x11, 0x48, 0x32, 0x57,
+    0x14, 0x48, 0xA6, 0x26, 0x98, 0x12, 0x21, 0xFE, 0x75, 0xF7, 0x16, 0x43, 0xA2, 0x4E, 0xE2, 0xC9,
+    0x8B, 0xA4, 0x13, 0xE5, 0x1D, 0xE1, 0xDB, 0x48, 0x6D, 0x9D, 0xD5, 0xF9, 0x3E, 0xA0, 0x56, 0x83,
+    0x18, 0x75, 0x57, 0x3A, 0x43, 0xCF, 0x43, 0x0A, 0xDA, 0x6B, 0x27, 0xC2, 0x21, 0xE4, 0x13, 0xD6,
+    0xF9, 0x61, 0x07, 0xCD, 0xCC, 0x86, 0x28, 0x97, 0x0C, 0x49, 0x12, 0x92, 0xB7, 0x94, 0x83, 0xC2,
+    0xE5, 0x8C, 0x4B, 0x7E, 0x11, 0x78, 0xF8, 0xA5, 0x41, 0xCA, 0x1F, 0x17, 0xC3, 0xE6, 0xD1, 0xDF,
+    0xB1, 0xF2, 0xDD, 0xF5, 0x37, 0x2D, 0x41, 0x3E, 0x10, 0xBF, 0x10, 0xD9, 0xCC, 0xA2, 0xF7, 0x74,
+    0xAA, 0xE9, 0x6C, 0x08, 0x51, 0x77, 0x45, 0xE0, 0xB3, 0x9A, 0xA6, 0x04, 0x04, 0x6B, 0xBA, 0x55,
+    0x29, 0xC5, 0x1A, 0x39, 0xF0, 0xDB, 0x69, 0xFD, 0xC5, 0x80, 0x1B, 0x34, 0x24, 0xB7, 0x2E, 0xDB,
+    0xCA, 0xDD, 0x19, 0x45, 0x43, 0x8C, 0xF3, 0x2A, 0xC6, 0xDF, 0xEF, 0xDD, 0xFB, 0x96, 0xC5, 0x3A,
+    0xCB, 0x0D, 0x91, 0x3A, 0x33, 0x35, 0x85, 0xDE, 0x32, 0x29, 0x87, 0x1C, 0x23, 0x11, 0x32, 0x36,
+    0xBB, 0xEB, 0xED, 0xAB, 0x72, 0xF7, 0xEA, 0xF9, 0xF1, 0xF1, 0xC7, 0x31, 0x46, 0x86, 0xD9, 0xE0,
+    0xB2, 0xEB, 0x4F, 0x9D, 0x55, 0x4D, 0x68, 0x1B, 0x47, 0x14, 0xFE, 0x66, 0x47, 0xB2, 0x92, 0x6C,
+    0xAC, 0xF5, 0x41, 0x6E, 0x1C, 0x88, 0xBD, 0x39, 0xE4, 0xE0, 0x3A, 0xB6, 0x37, 0x87, 0x1C, 0x9C,
+    0xB2, 0xDA, 0x9D, 0xB6, 0xD0, 0x1C, 0x7C, 0x88, 0xA0, 0x56, 0x0B, 0x29, 0x04, 0x1D, 0x7A, 0x28,
+    0xA6, 0x3F, 0x2E, 0xE8, 0xE0, 0x82, 0x6C, 0xA9, 0x76, 0xA1, 0x87, 0x5E, 0x7C, 0xCB, 0xA9, 0xD4,
+    0x87, 0x16, 0x1C, 0x99, 0x10, 0x5F, 0x0A, 0x09, 0xC8, 0xD6, 0xF6, 0x07, 0x02, 0xE9, 0xA1, 0x4B,
+    0x92, 0x56, 0x87, 0x5E, 0xF6, 0xD2, 0x10, 0xF0, 0x21, 0x5B, 0xBA, 0x05, 0x35, 0xAC, 0x34, 0x7D,
+    0xB3, 0xAB, 0x26, 0x71, 0x43, 0xFA, 0x37, 0x1A, 0x69, 0x67, 0xE7, 0xFD, 0xCC, 0x9B, 0xEF, 0x7D,
+    0xEF, 0x09, 0xAC, 0x84, 0x5C, 0x08, 0xC3, 0x83, 0x05, 0xD4, 0x80, 0x11, 0xD0, 0x98, 0x6A, 0x6E,
+    0xD5, 0x65, 0x6F, 0xB4, 0x1C, 0x83, 0x75, 0xC1, 0x43, 0xE8, 0x1E, 0x4C, 0x01, 0x07, 0xA0, 0x8D,
+    0x08, 0x3C, 0x18, 0xA8, 0xAF, 0x00, 0x52, 0xF6, 0x69, 0x82, 0x91, 0x91, 0x0B, 0x25, 0x07, 0xDB,
+    0xC0, 0x60, 0xE4, 0xA4, 0x94, 0x96, 0x94, 0xBD, 0xC5, 0xE6, 0x76, 0x08, 0x58, 0x42, 0x39, 0x53,
+    0x96, 0xD8, 0x85, 0xF2, 0xA1, 0x0C, 0xB4, 0x88, 0x76, 0x1A, 0x89, 0x9D, 0xEE, 0x43, 0x9D, 0xC0,
+    0x53, 0x55, 0x0C, 0x54, 0xF7, 0xCA, 0xE5, 0x57, 0xC9, 0xCD, 0x03, 0xFA, 0x36, 0x50, 0x48, 0x4C,
+    0x69, 0x4E, 0x0E, 0x4E, 0xF8, 0xAF, 0x71, 0x32, 0x0A, 0xD4, 0x10, 0x2D, 0x18, 0x9F, 0x90, 0x22,
+    0x9D, 0x69, 0xD2, 0x99, 0xA3, 0x89, 0x27, 0x53, 0xCA, 0xB8, 0x2D, 0xE5, 0x6F, 0xCD, 0xE6, 0xB5,
+    0x34, 0xC0, 0xDC, 0xBF, 0x0C, 0xF0, 0x89, 0xBB, 0xFC, 0x5E, 0x2E, 0x5F, 0xA0, 0x38, 0xC9, 0x4D,
+    0xBF, 0x80, 0xC2, 0x2C, 0x22, 0xFD, 0xA6, 0xCF, 0xA5, 0x40, 0x1F, 0x2A, 0xF2, 0xFF, 0x81, 0x6A,
+    0x41, 0x93, 0xB7, 0x65, 0x18, 0xD3, 0x8E, 0x49, 0xCA, 0x5A, 0x88, 0x16, 0xC9, 0xFF, 0x76, 0x41,
+    0xB7, 0x89, 0xD1, 0x25, 0x6F, 0x21, 0x04, 0x2B, 0x19, 0x5E, 0x9C, 0xF3, 0x6C, 0x50, 0xB0, 0x25,
+    0xB8, 0x9E, 0xDE, 0x67, 0x61, 0xB7, 0xC6, 0x7F, 0x46, 0x96, 0x89, 0x8C, 0x11, 0x9D, 0x70, 0x64,
+    0x7C, 0xD6, 0x0C, 0x47, 0x20, 0x5C, 0xD9, 0x51, 0x61, 0x89, 0xA9, 0x66, 0x73, 0x9D, 0x60, 0xA0,
+    0x47, 0xA3, 0x82, 0xCB, 0x62, 0xC6, 0x95, 0x9E, 0x0C, 0xC8, 0xB4, 0xB0, 0xB2, 0x32, 0x99, 0x61,
+    0xDC, 0xAF, 0x39, 0xFA, 0x57, 0x8D, 0x53, 0xFD, 0x23, 0xB1, 0xE6, 0x17, 0xAD, 0x75, 0x6F, 0x12,
+    0x7A, 0x30, 0xDB, 0x9A, 0x9B, 0x3E, 0x7B, 0xC2, 0xB6, 0xCD, 0x88, 0x09, 0x26, 0x16, 0xAC, 0xF3,
+    0x7E, 0xD7, 0xD1, 0xD7, 0x82, 0x65, 0x03, 0x62, 0x84, 0x2C, 0x5F, 0xF7, 0x8A, 0x96, 0xD1, 0x68,
+    0x07, 0x3C, 0x46, 0x16, 0xB0, 0x69, 0x50, 0xE6, 0x5A, 0x4E, 0xFA, 0x79, 0xEB, 0xF9, 0xD1, 0xAC,
+    0xB0, 0x74, 0xDF, 0x58, 0x0F, 0xB9, 0x4F, 0x11, 0xDB, 0x18, 0xC9, 0x60, 0x93, 0x20, 0x61, 0xD1,
+    0xD0, 0x91, 0xC3, 0x55, 0xED, 0x8E, 0x8C, 0x8D, 0x3E, 0xD9, 0xB1, 0xCF, 0x99, 0x8C, 0x9C, 0xED,
+    0x9B, 0x62, 0x9C, 0x62, 0xE5, 0x5E, 0xCD, 0x68, 0x44, 0x16, 0x0F, 0x5D, 0x26, 0x74, 0x2F, 0x36,
+    0x3E, 0x0C, 0x2D, 0xEE, 0xDB, 0x0C, 0x0E, 0x0F, 0x2D, 0x16, 0x19, 0xE2, 0x3A, 0xF7, 0x0A, 0xC9,
+    0x7E, 0x64, 0x69, 0x81, 0x4D, 0x21, 0xE9, 0x81, 0x85, 0x96, 0x16, 0x64, 0x59, 0x69, 0xCF, 0x58,
+    0x0F, 0xAE, 0x53, 0x18, 0x98, 0x78, 0x6E, 0xBF, 0xFF, 0x5A, 0x30, 0x41, 0xB8, 0xE8, 0xE2, 0xC6,
+    0x7C, 0xFF, 0xC6, 0x1B, 0x42, 0x91, 0xBE, 0x2D, 0x17, 0xAF, 0xC1, 0x78, 0xF4, 0xA1, 0x64, 0xB8,
+    0x2C, 0xB2, 0xBE, 0xE9, 0x1E, 0x01, 0xB2, 0x4E, 0x75, 0xA7, 0xEA, 0x64, 0xB5, 0x06, 0xF7, 0xB8,
+    0x77, 0xFA, 0xBE, 0x4B, 0x64, 0x98, 0xDA, 0x72, 0x63, 0xF5, 0xC6, 0x3D, 0x95, 0x59, 0xF5, 0x74,
+    0xE3, 0xD3, 0xF7, 0xB9, 0xA7, 0x35, 0xA6, 0xB6, 0xEA, 0xBD, 0x84, 0x51, 0x2C, 0x54, 0xF3, 0xD8,
+    0xAF, 0x3D, 0x57, 0x10, 0xE9, 0xA2, 0x64, 0xF6, 0xCE, 0xC7, 0xA6, 0x87, 0xA2, 0x5B, 0xC4, 0x63,
+    0x40, 0x0F, 0xA2, 0x08, 0xA7, 0x58, 0xDB, 0x29, 0x19, 0x2C, 0x30, 0x7D, 0x93, 0x3D, 0xDC, 0x93,
+    0x82, 0x21, 0x9C, 0xE1, 0xDE, 0x72, 0xEE, 0xAE, 0xEB, 0x2F, 0xA4, 0x10, 0x12, 0x8F, 0x5C, 0x19,
+    0xDB, 0xB0, 0xE7, 0x30, 0x4D, 0xB3, 0x90, 0xB0, 0x6B, 0xC9, 0x1E, 0x3E, 0xB7, 0x57, 0x33, 0xF7,
+    0x89, 0xAF, 0x09, 0xF0, 0xCE, 0x13, 0xC0, 0xA7, 0xD9, 0xD7, 0x7E, 0xA1, 0xEC, 0xFF, 0x80, 0xEC,
+    0x81, 0xDC, 0x1E, 0x00, 0x97, 0x78, 0x61, 0x46, 0xD3, 0x4F, 0xF1, 0x62, 0xB4, 0x5C, 0x9E, 0x27,
+    0x3A, 0x2E, 0x36, 0x9B, 0xAA, 0xB4, 0xF9, 0x80, 0x22, 0xB4, 0x24, 0xC1, 0xCB, 0xF4, 0x46, 0x0F,
+    0x65, 0x6A, 0x74, 0xC7, 0x67, 0xDB, 0xF1, 0x9C, 0x1E, 0x91, 0xE9, 0x13, 0x54, 0x22, 0x69, 0x62,
+    0x9F, 0x7A, 0x48, 0x7D, 0x10, 0x5B, 0xEB, 0x0D, 0xCB, 0xB7, 0x7C, 0x22, 0x7D, 0x66, 0x50, 0xCB,
+    0xB3, 0x44, 0x90, 0xA4, 0x03, 0xD1, 0x0D, 0x42, 0x68, 0x01, 0x81, 0x8A, 0x9C, 0x47, 0xC8, 0xA9,
+    0x64, 0x3C, 0x2D, 0xF4, 0x95, 0x50, 0xFF, 0x53, 0x58, 0x4C, 0x84, 0x6F, 0xD2, 0x55, 0x5B, 0xE3,
+    0xF9, 0xF1, 0x56, 0xE9, 0x14, 0xC6, 0x52, 0x70, 0x8A, 0xE5, 0x9A, 0xAB, 0x22, 0x5C, 0x48, 0x32,
+    0xDC, 0xFF, 0xB2, 0x7C, 0x69, 0x07, 0x79, 0x9A, 0x6D, 0x15, 0xCD, 0x15, 0x95, 0xA6, 0xFD, 0xE8,
+    0xDC, 0xEA, 0xDB, 0x84, 0x1E, 0xAD, 0x47, 0xE6, 0x2F, 0xB9, 0x5F, 0x47, 0xF5, 0x9F, 0xF2, 0xB4,
+    0xB6, 0xAE, 0x47, 0xB5, 0x19, 0xE3, 0xDD, 0x2E, 0x9E, 0x79, 0xE5, 0x02, 0x8B, 0x59, 0xC4, 0x42,
+    0x46, 0xA5, 0x86, 0x92, 0xE1, 0xAF, 0xF0, 0xA0, 0x48, 0xAB, 0xBF, 0x60, 0x38, 0x65, 0x04, 0xB5,
+    0x09, 0x43, 0x15, 0x3F, 0x15, 0xFD, 0xF9, 0xEF, 0xBE, 0xFF, 0x6C, 0xD5, 0x29, 0x84, 0x27, 0xA9,
+    0x5D, 0x4E, 0x72, 0xBF, 0xC8, 0x15, 0x19, 0x92, 0x3E, 0xD9, 0x5B, 0x6D, 0x6E, 0x77, 0x1A, 0x98,
+    0x59, 0x86, 0xF6, 0xA3, 0xC0, 0xF1, 0x67, 0x9E, 0x79, 0xA0, 0x7A, 0xE6, 0xFB, 0x8B, 0x41, 0x1E,
+    0x81, 0x8A, 0x96, 0x5D, 0xC8, 0x98, 0xBD, 0xE4, 0xD4, 0x76, 0x38, 0x12, 0x08, 0x15, 0xB4, 0x9D,
+    0x74, 0x12, 0x1B, 0x43, 0x1B, 0x47, 0xAD, 0xDE, 0x74, 0xB1, 0xDE, 0xAD, 0x52, 0x4B, 0x9B, 0x1C,
+    0x6C, 0x26, 0x43, 0xEB, 0x1A, 0x75, 0xF9, 0x20, 0x17, 0xA7, 0xAB, 0x87, 0xB4, 0x22, 0xB2, 0xE1,
+    0x45, 0xE4, 0xD6, 0x7C, 0x4B, 0x76, 0x8D, 0xFD, 0x50, 0x5B, 0x6B, 0x24, 0x8A, 0x9B, 0xD6, 0x5A,
+    0xD7, 0x40, 0x68, 0xA0, 0xEE, 0xB9, 0x9E, 0xDB, 0x89, 0x79, 0xCC, 0x7B, 0x4B, 0x4A, 0xD0, 0x51,
+    0xDC, 0x1A, 0xAE, 0xE0, 0xD6, 0x19, 0x6C, 0xE0, 0x23, 0x76, 0x12, 0x38, 0x0A, 0x0E, 0x0C, 0x51,
+    0xC9, 0xA0, 0x52, 0x21, 0xC3, 0xCB, 0x4A, 0x6B, 0x78, 0x89, 0x3A, 0xE7, 0x99, 0x0E, 0x25, 0x9A,
+    0x0D, 0x2F, 0xD1, 0x6E, 0xC9, 0x27, 0x05, 0x2A, 0xAB, 0x43, 0xD0, 0x48, 0xFA, 0x2D, 0x3B, 0x83,
+    0x93, 0xEC, 0xD6, 0x59, 0x7C, 0x9C, 0x38, 0x4B, 0xFD, 0x6E, 0x69, 0x5B, 0xDA, 0xD5, 0xBA, 0x57,
+    0xF7, 0x5D, 0x1F, 0x43, 0xC2, 0x15, 0xBB, 0x66, 0x27, 0x28, 0x41, 0x77, 0xAA, 0xD5, 0xA2, 0x09,
+    0xB6, 0x00, 0x19, 0xB9, 0x09, 0x67, 0x43, 0xA1, 0xDA, 0x45, 0x92, 0xA3, 0x43, 0xF5, 0xDB, 0x5D,
+    0xF7, 0xE6, 0xA7, 0x94, 0x82, 0x8D, 0xDD, 0xD5, 0x5C, 0x60, 0x7A, 0xC7, 0x2B, 0xB9, 0x40, 0xF7,
+    0x77, 0xEB, 0xAF, 0xA0, 0x82, 0xD2, 0xAA, 0x16, 0xEA, 0x77, 0x22, 0xBD, 0x53, 0x73, 0xE7, 0xA7,
+    0x2B, 0xF9, 0x7C, 0xB5, 0x68, 0x18, 0x13, 0xCB, 0xC8, 0x38, 0xEE, 0x18, 0xF7, 0x8E, 0xDD, 0x75,
+    0x63, 0x3D, 0x30, 0xC2, 0xC3, 0x95, 0x94, 0x0F, 0x1F, 0xEC, 0xBD, 0xB3, 0x63, 0xE7, 0x69, 0x16,
+    0xA9, 0xA0, 0x3A, 0xD1, 0x1C, 0x17, 0xF5, 0x7B, 0x57, 0x99, 0x37, 0x96, 0xC0, 0x66, 0x9B, 0xEA,
+    0x37, 0xD2, 0xA9, 0xE7, 0xEB, 0x01, 0x93, 0x5F, 0x5C, 0xA4, 0x06, 0x4F, 0x7F, 0x72, 0x8A, 0x27,
+    0x8B, 0x57, 0x06, 0xD0, 0xFE, 0x83, 0x8E, 0xAA, 0x82, 0x6D, 0x55, 0x0F, 0x8F, 0x16, 0x50, 0x99,
+    0xCD, 0xE8, 0xB2, 0x2F, 0x60, 0x5B, 0xCD, 0xB6, 0xDC, 0x8F, 0xE6, 0xC0, 0xDE, 0x93, 0xBE, 0xEA,
+    0x4B, 0x85, 0x81, 0x55, 0xEA, 0x21, 0xF5, 0x96, 0x7A, 0x4E, 0x4F, 0xB1, 0x07, 0xC9, 0x46, 0x82,
+    0x26, 0xF5, 0xAD, 0xA4, 0xD6, 0xE4, 0x45, 0xE5, 0x3C, 0x65, 0xAF, 0x48, 0xD3, 0x9D, 0x7D, 0xE9,
+    0x12, 0xDE, 0xBF, 0xB6, 0xF9, 0x82, 0xEE, 0x2E, 0xE1, 0xF1, 0xF8, 0x03, 0xA5, 0x55, 0x3F, 0x88,
+    0x1C, 0x55, 0x18, 0xFF, 0xCD, 0xBC, 0xAC, 0x03, 0xD9, 0x6C, 0xE6, 0x90, 0x13, 0x21, 0x1E, 0x0E,
+    0x88, 0x48, 0x1A, 0xB3, 0x87, 0x1E, 0xA9, 0x32, 0x3B, 0x73, 0x5E, 0x71, 0x60, 0x93, 0x13, 0x6F,
+    0xB4, 0xB8, 0xC2, 0xC6, 0x22, 0x45, 0x8A, 0x14, 0x42, 0x9A, 0xDD, 0xDC, 0xA4, 0x11, 0xEC, 0xB6,
+    0x09, 0x16, 0x36, 0x57, 0x04, 0x21, 0x49, 0x71, 0x6D, 0x8A, 0x0D, 0x3B, 0x66, 0x2A, 0x05, 0x71,
+    0x60, 0xB1, 0xF0, 0x0F, 0x64, 0x40, 0xEF, 0x02, 0x56, 0x53, 0xAC, 0x30, 0x9E, 0x33, 0xFB, 0xFC,
+    0x7D, 0x6F, 0x36, 0x27, 0x31, 0x97, 0x70, 0x26, 0xB3, 0xBC, 0xF7, 0xBD, 0xF7, 0x7E, 0xEF, 0xFB,
+    0xDE, 0xF7, 0x7F, 0x5B, 0xE1, 0xFE, 0xE7, 0xAA, 0x5B, 0xEF, 0x58, 0x89, 0xA5, 0x81, 0x37, 0x5E,
+    0xBD, 0x7A, 0xF5, 0x4A, 0x2B, 0xDC, 0xFF, 0x42, 0x7D, 0x76, 0x32, 0x7B, 0x2B, 0xBE, 0x5F, 0x03,
+    0x78, 0x39, 0xFC, 0x56, 0xBD, 0x79, 0x6A, 0xF8, 0xCE, 0xF5, 0xF4, 0x00, 0xB0, 0x3E, 0xD8, 0x5F,
+    0x51, 0x58, 0x56, 0x71, 0x3B, 0x07, 0x96, 0x91, 0x7C, 0xF8, 0x7A, 0x3F, 0x7B, 0x17, 0xDF, 0xAB,
+    0xB3, 0x4B, 0xDD, 0x1D, 0x60, 0x68, 0xC7, 0x27, 0x17, 0xCF, 0x5D, 0xDE, 0x39, 0x1F, 0xFF, 0xAC,
+    0x2E, 0x75, 0x86, 0x2B, 0xAD, 0xD5, 0xF7, 0x1E, 0x7E, 0xFD, 0x9D, 0xA3, 0x3E, 0x3D, 0xD5, 0x19,
+    0x2E, 0x9F, 0x0F, 0x93, 0x9F, 0x94, 0x1D, 0x5A, 0x9F, 0x7C, 0x69, 0x25, 0x57, 0x96, 0x1C, 0x2C,
+    0x9C, 0x5E, 0x1F, 0x66, 0x2B, 0x1D, 0x15, 0x0E, 0x80, 0x05, 0x9C, 0xED, 0x2C, 0x2D, 0x75, 0x56,
+    0x9C, 0x65, 0xB5, 0x63, 0x27, 0x58, 0xB8, 0x7F, 0xFD, 0x57, 0x3B, 0x39, 0x1D, 0x4F, 0xDE, 0x57,
+    0xB0, 0x36, 0x80, 0x6B, 0x80, 0x93, 0x01, 0x23, 0xA0, 0x1D, 0x03, 0x3C, 0x00, 0xB4, 0xAE, 0x03,
+    0xAD, 0x2F, 0xDE, 0x88, 0xD6, 0x08, 0x4C, 0x01, 0x1F, 0x70, 0x43, 0xA8, 0x66, 0x43, 0xC4, 0xD5,
+    0x3A, 0xDD, 0x8B, 0xC2, 0xFF, 0x22, 0xB2, 0x21, 0x8F, 0xD6, 0x53, 0x0A, 0x40, 0xB8, 0x80, 0xB2,
+    0x87, 0xC0, 0x8D, 0x9D, 0xD5, 0x0C, 0xE6, 0x53, 0x0D, 0xD2, 0x8B, 0xA2, 0xC7, 0x79, 0x9A, 0x8D,
+    0xD6, 0x95, 0x88, 0xBE, 0x11, 0xA9, 0x23, 0x1E, 0x15, 0x1E, 0xAD, 0x27, 0x14, 0x30, 0xE6, 0x3D,
+    0x98, 0x29, 0xDA, 0x8E, 0x36, 0x81, 0xAE, 0x48, 0x3E, 0x72, 0x3A, 0x73, 0x93, 0x93, 0xD6, 0x09,
+    0xBA, 0x07, 0xBB, 0x05, 0xCF, 0xEC, 0x52, 0x80, 0x4A, 0xA6, 0xC1, 0xE3, 0xD3, 0xBD, 0x47, 0x80,
+    0x9A, 0xA2, 0xEB, 0xE8, 0x5C, 0xA6, 0x10, 0x8D, 0x33, 0x36, 0x05, 0x16, 0x27, 0xF5, 0x80, 0x73,
+    0x40, 0x0B, 0x8D, 0x83, 0xE6, 0xBA, 0x1E, 0xE5, 0xA0, 0x63, 0x6E, 0xCC, 0x67, 0x8D, 0x67, 0xA1,
+    0x43, 0xAB, 0x9C, 0x7A, 0x75, 0xC4, 0xC7, 0x45, 0x01, 0x58, 0x25, 0x4C, 0x38, 0x10, 0x70, 0xB8,
+    0xB1, 0xF1, 0xDB, 0x8C, 0x4F, 0xEA, 0x38, 0x88, 0xA2, 0x0D, 0x73, 0x50, 0x40, 0xF4, 0xA5, 0x79,
+    0x8F, 0x36, 0x63, 0xB9, 0xFA, 0x17, 0x2E, 0x8B, 0x67, 0x60, 0x6B, 0x6A, 0x6F, 0x99, 0x48, 0xE2,
+    0x35, 0x9D, 0xB7, 0xB5, 0xFE, 0xA6, 0x6E, 0xDD, 0xA5, 0x34, 0x95, 0x1B, 0x1D, 0x84, 0x04, 0xBC,
+    0x31, 0x63, 0xE4, 0x79, 0xB3, 0x6D, 0x06, 0xD7, 0x94, 0xE8, 0x66, 0xC6, 0x50, 0xB9, 0x41, 0xD2,
+    0xFE, 0x65, 0xF8, 0x52, 0x45, 0x89, 0x46, 0xE0, 0x22, 0x79, 0x8F, 0xFA, 0x4E, 0xF0, 0xB8, 0x37,
+    0x78, 0xFB, 0x82, 0x89, 0x70, 0x76, 0xDC, 0x1F, 0xBC, 0xD0, 0xC9, 0xAC, 0x29, 0xFD, 0x7F, 0xDC,
+    0x85, 0x5D, 0x58, 0xD5, 0x76, 0xED, 0xD5, 0xD6, 0x4D, 0x93, 0x83, 0x09, 0x0E, 0x49, 0x2F, 0xDA,
+    0x12, 0xE2, 0xC3, 0x79, 0x92, 0x5C, 0x68, 0x48, 0xFF, 0x90, 0x1C, 0xDC, 0x32, 0x44, 0xEB, 0x4C,
+    0xC8, 0x1F, 0xBB, 0x25, 0x5D, 0x4D, 0xAC, 0x6E, 0x48, 0xAF, 0x21, 0x01, 0xEE, 0x0A, 0xE9, 0xA2,
+    0x6C, 0x76, 0x53, 0x83, 0x59, 0x85, 0x90, 0x7B, 0xEB, 0x24, 0x3F, 0x6E, 0x95, 0x14, 0x40, 0x29,
+    0xB9, 0x8E, 0x49, 0x66, 0xE2, 0x1D, 0x98, 0x57, 0xC5, 0x6F, 0x12, 0xDE, 0x52, 0xBC, 0x61, 0x1C,
+    0xC9, 0x90, 0x4B, 0xD0, 0x9E, 0x01, 0x31, 0xBB, 0xB7, 0xA3, 0x50, 0x42, 0xCC, 0x54, 0x50, 0x86,
+    0x54, 0x06, 0x52, 0xA5, 0xE1, 0x52, 0x85, 0xE1, 0x72, 0x26, 0x86, 0xCB, 0xBD, 0x68, 0xB8, 0x06,
+    0x06, 0xB2, 0xA7, 0x06, 0xF2, 0x52, 0x42, 0x7F, 0x7E, 0x54, 0x0B, 0x17, 0x4D, 0xF3, 0xC5, 0x37,
+    0xBF, 0xE3, 0x7F, 0xD4, 0xCA, 0xAD, 0xA7, 0xD6, 0x4A, 0xFF, 0x70, 0x1A, 0x3C, 0x7D, 0xC2, 0x2B,
+    0x30, 0x75, 0x62, 0x4D, 0x8D, 0x6D, 0xA6, 0x95, 0xB4, 0x0E, 0x5D, 0x32, 0xF2, 0x09, 0xF8, 0x34,
+    0xC3, 0x47, 0x3B, 0xF1, 0x19, 0x4D, 0x9F, 0x9A, 0xFB, 0x14, 0xEF, 0xF3, 0xBE, 0x4F, 0x93, 0x02,
+    0xBE, 0x2C, 0xA3, 0xF7, 0x71, 0x0E, 0xDF, 0x9E, 0x36, 0x18, 0x8B, 0xCE, 0x47, 0x97, 0x77, 0x5D,
+    0xF2, 0x38, 0xB9, 0x4F, 0x5B, 0x29, 0xAB, 0xF2, 0xA5, 0x1A, 0x8D, 0x6C, 0xA9, 0x00, 0xF1, 0xA2,
+    0xB8, 0x51, 0x54, 0xE4, 0x17, 0x36, 0x8D, 0x26, 0x33, 0x6F, 0x36, 0x5E, 0x11, 0x86, 0x31, 0x17,
+    0x5E, 0x9F, 0x1A, 0x3C, 0xE4, 0x62, 0xC4, 0x85, 0xB7, 0x9E, 0x66, 0x2A, 0xE7, 0x62, 0xE4, 0xA4,
+    0x99, 0x1B, 0xF6, 0xA9, 0x04, 0x17, 0x7D, 0xF4, 0x7D, 0x37, 0x74, 0xD2, 0x49, 0xC1, 0x05, 0xB3,
+    0x23, 0x7D, 0x10, 0xA3, 0x1F, 0x30, 0xDC, 0x29, 0x9F, 0xEA, 0x07, 0x8C, 0x74, 0x5A, 0xC8, 0x43,
+    0x8B, 0xEC, 0x0C, 0x2A, 0xA7, 0xE1, 0xDE, 0x57, 0x7C, 0x69, 0x5C, 0x36, 0x6D, 0x02, 0x4D, 0xD9,
+    0xAA, 0xDF, 0xA8, 0xD2, 0x80, 0xA0, 0x9B, 0x94, 0x34, 0xBB, 0x2D, 0x69, 0xC4, 0x10, 0xE6, 0x76,
+    0x41, 0xD4, 0x8D, 0x19, 0xB9, 0x11, 0xAD, 0x56, 0x39, 0xEB, 0xB1, 0x2B, 0x8D, 0xB7, 0x94, 0xCE,
+    0xFB, 0x80, 0x8A, 0xF3, 0x21, 0xD8, 0x33, 0x31, 0x27, 0x99, 0x37, 0x01, 0x69, 0x00, 0xDE, 0xFC,
+    0x85, 0xB6, 0x20, 0x27, 0x1A, 0x7F, 0x4A, 0x06, 0xA8, 0x89, 0xB4, 0x11, 0x69, 0x2A, 0x2F, 0x72,
+    0xB0, 0x17, 0x45, 0x6C, 0xC9, 0xA6, 0xDD, 0xB3, 0xC4, 0x47, 0xF3, 0x7C, 0xA0, 0xCE, 0xB0, 0xA5,
+    0xAD, 0x5C, 0x12, 0x9B, 0x44, 0x13, 0x47, 0x76, 0x81, 0xF4, 0xF1, 0xBF, 0x89, 0xB5, 0x7F, 0x90,
+    0xAA, 0x63, 0x36, 0x5B, 0xC5, 0x48, 0xD4, 0x15, 0x91, 0x6C, 0x43, 0x76, 0xC1, 0xF2, 0x30, 0x16,
+    0x4A, 0x56, 0xD8, 0xF2, 0x27, 0xC0, 0x64, 0x2C, 0x71, 0xED, 0xF6, 0x9D, 0x82, 0xB0, 0xCA, 0x3C,
+    0x66, 0x67, 0x42, 0x0E, 0x6F, 0x4D, 0xFA, 0x8B, 0x27, 0xFE, 0xAA, 0x24, 0x67, 0xA4, 0x8E, 0xA9,
+    0xC0, 0xDA, 0x5E, 0xB4, 0x29, 0xA1, 0xF4, 0x9B, 0x32, 0x91, 0x28, 0xCA, 0x36, 0xB8, 0xBD, 0xC1,
+    0xD2, 0x28, 0xD5, 0xC1, 0x2E, 0x8B, 0xC2, 0xAE, 0x7C, 0x53, 0x0E, 0x52, 0x0B, 0x1E, 0x4D, 0x60,
+    0x15, 0xD8, 0xDC, 0x7A, 0xE9, 0x1E, 0x93, 0x9F, 0x99, 0x2F, 0x69, 0xDF, 0x0C, 0x9D, 0xF4, 0xA2,
+    0x5D, 0x66, 0x9C, 0x92, 0xAC, 0x29, 0xFF, 0x1D, 0xB6, 0x64, 0x61, 0x1E, 0xE8, 0x59, 0x28, 0xA3,
+    0x87, 0x2D, 0xEE, 0xAD, 0xAA, 0xC9, 0x52, 0x53, 0x54, 0x83, 0x79, 0xC6, 0x56, 0xC4, 0x44, 0x35,
+    0xCA, 0xAC, 0xF1, 0x5C, 0xDF, 0x3F, 0xB5, 0x95, 0xBD, 0x8E, 0xDC, 0x54, 0x14, 0xC7, 0xCF, 0xB5,
+    0x41, 0x2E, 0x2C, 0xE1, 0x06, 0xD1, 0x50, 0xB8, 0xA5, 0x73, 0x8D, 0x14, 0x7F, 0x44, 0x14, 0x94,
+    0xD9, 0x02, 0x43, 0xB1, 0x45, 0x1E, 0x00, 0xA4, 0x7D, 0x81, 0x99, 0x59, 0xF7, 0x14, 0x50, 0xF0,
+    0x00, 0x79, 0x8C, 0x14, 0xDE, 0x8C, 0xC5, 0x14, 0x29, 0xE3, 0x88, 0x22, 0xA2, 0xC2, 0x91, 0x35,
+    0x75, 0x2C, 0xC5, 0x28, 0x1E, 0xAD, 0x67, 0x2E, 0xBF, 0x73, 0xBD, 0x8B, 0x50, 0xB2, 0x29, 0x10,
+    0xC4, 0x1A, 0x5F, 0x9F, 0x7B, 0xEE, 0xB9, 0xE7, 0xF3, 0x7F, 0xCE, 0xE4, 0xD6, 0x46, 0xD6, 0xEE,
+    0xF6, 0xE5, 0xD9, 0x28, 0x92, 0x8A, 0x44, 0x85, 0xF8, 0xAD, 0xC8, 0xBF, 0xDA, 0xB0, 0xB5, 0x76,
+    0x90, 0xC0, 0xDA, 0xA3, 0x98, 0x43, 0x79, 0x51, 0xC8, 0x4A, 0x82, 0x56, 0x62, 0x31, 0xA3, 0x04,
+    0x8D, 0xAC, 0xC5, 0x1B, 0x24, 0x2E, 0xA4, 0x56, 0x66, 0xA2, 0xCC, 0xB0, 0x82, 0xE9, 0x77, 0xCA,
+    0x9C, 0x94, 0x99, 0x2A, 0x93, 0xCD, 0x5A, 0xC2, 0x86, 0x2F, 0x27, 0x41, 0x0B, 0x87, 0xDF, 0x2C,
+    0xB2, 0x36, 0x4F, 0xCA, 0xF2, 0xE2, 0x5B, 0xAB, 0xCF, 0x56, 0x97, 0x57, 0x18, 0xF4, 0xAE, 0x1B,
+    0xD6, 0x27, 0x03, 0x4B, 0x52, 0xB3, 0x84, 0xBF, 0xB3, 0x98, 0x47, 0xB9, 0xB5, 0x0F, 0xAC, 0xFD,
+    0xED, 0x3D, 0xD1, 0x10, 0x27, 0x7E, 0x1E, 0xCA, 0xB3, 0xBB, 0xA2, 0xE1, 0x0E, 0xFE, 0xA3, 0xA0,
+    0xC8, 0x94, 0x1D, 0xB4, 0x57, 0x2A, 0x90, 0xE3, 0x41, 0x54, 0xE0, 0xFF, 0x84, 0x5C, 0x5C, 0x79,
+    0xA3, 0xA8, 0x4F, 0xFE, 0xE0, 0xB7, 0x78, 0xEA, 0x77, 0x51, 0xB1, 0xC1, 0x76, 0x9B, 0xFA, 0x38,
+    0x12, 0x35, 0x63, 0xB2, 0xA4, 0x62, 0xE2, 0x83, 0xA2, 0x4E, 0xC4, 0xFF, 0x73, 0xF3, 0x10, 0x47,
+    0x93, 0x62, 0x8C, 0xF8, 0xCC, 0x7E, 0x4B, 0x90, 0x51, 0x13, 0x15, 0xB9, 0xC8, 0x06, 0x85, 0x39,
+    0x9A, 0x50, 0x78, 0x85, 0x00, 0xB6, 0x66, 0x33, 0x61, 0xCB, 0x4C, 0x88, 0xA6, 0xE2, 0x8D, 0x57,
+    0xEA, 0x86, 0x2A, 0x16, 0xB9, 0xB0, 0x2D, 0xC9, 0x1D, 0x3E, 0x29, 0x62, 0x67, 0x47, 0x34, 0x57,
+    0x24, 0x4B, 0x13, 0xA4, 0x5B, 0x33, 0x63, 0xAE, 0x12, 0x7B, 0x12, 0x29, 0xB7, 0x95, 0x9A, 0xC3,
+    0x3E, 0xD7, 0x48, 0x8C, 0x77, 0x73, 0x61, 0xF3, 0xA5, 0x7C, 0x3E, 0x90, 0xBB, 0xFB, 0xEA, 0x96,
+    0x29, 0x5C, 0xD4, 0xE1, 0xAE, 0xE5, 0x2A, 0x44, 0x0E, 0x11, 0x42, 0x98, 0x37, 0x10, 0xD9, 0x2A,
+    0x95, 0xF0, 0xE9, 0x8E, 0xFC, 0x43, 0x64, 0xC1, 0x8E, 0x40, 0x21, 0x46, 0x88, 0x4C, 0x56, 0x69,
+    0xD0, 0x40, 0x8C, 0x10, 0xB9, 0x04, 0xBB, 0x17, 0x0D, 0x04, 0x05, 0xDC, 0x59, 0x91, 0x55, 0xDE,
+    0x40, 0x4C, 0x4A, 0x88, 0x16, 0xFD, 0x53, 0x29, 0xF8, 0xA8, 0x72, 0x4D, 0x80, 0xC5, 0x51, 0xF3,
+    0x8D, 0xB8, 0xE7, 0x03, 0x5B, 0x46, 0x6B, 0xAD, 0x78, 0x4A, 0xC9, 0x1D, 0xFA, 0xD8, 0xC7, 0x05,
+    0xEA, 0x30, 0x3B, 0x4B, 0x4A, 0xC2, 0x52, 0xD0, 0x95, 0xDB, 0xC6, 0xBD, 0xD9, 0x77, 0x9D, 0xA4,
+    0xD4, 0xD4, 0x9D, 0xB9, 0x8A, 0x24, 0xC8, 0x46, 0xDC, 0x09, 0x3A, 0x2D, 0x01, 0xBA, 0xD4, 0xCB,
+    0x8D, 0x56, 0xB3, 0xF5, 0x2D, 0x09, 0xCE, 0xCA, 0xF3, 0x8E, 0x52, 0xA9, 0x3A, 0x7F, 0x21, 0xEE,
+    0x41, 0x10, 0x2F, 0x2E, 0xFE, 0x93, 0x08, 0x95, 0xA8, 0x6F, 0x89, 0xC7, 0x0A, 0x95, 0x0A, 0x82,
+    0x82, 0x76, 0xB1, 0x48, 0xF6, 0xF5, 0x20, 0xFE, 0xAB, 0x23, 0x04, 0x65, 0xF3, 0x5F, 0x16, 0x8A,
+    0x17, 0xEA, 0x16, 0xF7, 0xC0, 0xDD, 0x3B, 0xE5, 0x00, 0x27, 0xEF, 0x41, 0x79, 0x70, 0x4A, 0xC9,
+    0xDB, 0x9B, 0xFE, 0x59, 0x25, 0x71, 0x76, 0x6F, 0x25, 0x5E, 0xDF, 0x93, 0xA6, 0x34, 0x4B, 0x13,
+    0x02, 0xEE, 0x9F, 0x03, 0xCA, 0x2C, 0x8D, 0xAA, 0xC8, 0xEF, 0xDB, 0xDA, 0x1B, 0xB2, 0xD4, 0x07,
+    0x87, 0x7D, 0x9B, 0x05, 0x4D, 0x96, 0x9A, 0xE1, 0x31, 0x64, 0xF4, 0xA0, 0xC8, 0x52, 0xB9, 0x1A,
+    0x20, 0x03, 0x5C, 0x07, 0x6F, 0x0D, 0xA4, 0x37, 0x29, 0x19, 0xD1, 0x65, 0x5A, 0x89, 0x9F, 0x80,
+    0xFE, 0x6B, 0x1A, 0x61, 0xC6, 0x52, 0xAE, 0xAD, 0xF0, 0xEC, 0x1D, 0x06, 0xB0, 0x79, 0xCD, 0x3B,
+    0x1F, 0xCA, 0xF2, 0xF2, 0x6E, 0x89, 0xB7, 0x19, 0xCD, 0x52, 0xE9, 0x50, 0x5B, 0xE0, 0x92, 0xAC,
+    0x79, 0xA7, 0x62, 0xDB, 0x04, 0x83, 0x84, 0x1D, 0x47, 0xFE, 0x00, 0x7A, 0xCD, 0xA4, 0xBD, 0x32,
+    0x3B, 0x94, 0xD2, 0x6F, 0xB2, 0xBE, 0x6B, 0x71, 0xA7, 0xBA, 0xCC, 0x8A, 0xF7, 0xC9, 0xDD, 0x75,
+    0x5A, 0xBC, 0xA3, 0x5C, 0x36, 0xB2, 0x55, 0xC0, 0x87, 0x0A, 0x2D, 0xD0, 0xA6, 0x25, 0xD2, 0xDE,
+    0xB7, 0xFD, 0xBE, 0x2C, 0x27, 0x78, 0x99, 0x3A, 0xA2, 0xD1, 0xF5, 0x78, 0xF6, 0x5F, 0x18, 0x55,
+    0x6E, 0x1F, 0x09, 0xE1, 0xFB, 0xFB, 0xEF, 0x67, 0x46, 0xC1, 0xA4, 0xC0, 0x1A, 0x1D, 0x84, 0x13,
+    0xE6, 0x46, 0xBD, 0x6C, 0x93, 0xAF, 0xF6, 0xE7, 0x13, 0xAD, 0x8F, 0xF0, 0xCF, 0x3A, 0x54, 0x74,
+    0xB6, 0x44, 0x4B, 0x9B, 0xBD, 0xBD, 0x75, 0x8F, 0xD9, 0x9E, 0x0A, 0x5A, 0x7A, 0x0C, 0x8E, 0xF7,
+    0x6B, 0x5F, 0x05, 0xB4, 0x41, 0xA6, 0xA5, 0x67, 0x5D, 0xEF, 0x02, 0x17, 0x9D, 0x90, 0xF8, 0xC1,
+    0x9B, 0xDD, 0x32, 0x74, 0x1A, 0xCC, 0x3A, 0xF3, 0x6E, 0x37, 0x5B, 0x3D, 0x39, 0xC8, 0x0F, 0x24,
+    0xC3, 0x8A, 0x87, 0x7D, 0x31, 0x67, 0x4A, 0xBB, 0x49, 0x59, 0x9E, 0xEF, 0x4B, 0x67, 0xFA, 0x7F,
+    0x78, 0xF1, 0xCB, 0xEF, 0xF1, 0x67, 0x9D, 0x68, 0x7D, 0x27, 0x1A, 0x0C, 0x64, 0x27, 0x78, 0xE6,
+    0x77, 0xCC, 0x98, 0x1A, 0xF7, 0x70, 0xB0, 0x36, 0x0A, 0x70, 0xDC, 0x4F, 0x02, 0xCD, 0x20, 0x77,
+    0xC2, 0x3F, 0x74, 0x16, 0x0D, 0x0A, 0x6B, 0x59, 0x80, 0xE1, 0xA2, 0xD4, 0x08, 0x63, 0x44, 0xB6,
+    0x6C, 0x42, 0x3D, 0xF9, 0x48, 0xFE, 0x7E, 0x8C, 0x1B, 0x79, 0xB1, 0x2E, 0x9F, 0x1D, 0x0A, 0x05,
+    0x90, 0x65, 0x0E, 0x5F, 0x13, 0x5B, 0x44, 0xEF, 0x6C, 0xBD, 0xD1, 0x0C, 0xDE, 0x98, 0x23, 0x10,
+    0x3D, 0x6D, 0x91, 0xAD, 0x57, 0x90, 0xC1, 0x8B, 0x06, 0x72, 0xBD, 0x90, 0x8E, 0xEB, 0x04, 0x7E,
+    0x9D, 0x54, 0x96, 0x6B, 0xE6, 0x84, 0x86, 0x6B, 0xB2, 0xE3, 0x94, 0x2D, 0x7A, 0x17, 0x13, 0x8B,
+    0xB5, 0x8F, 0x97, 0x24, 0xC7, 0x61, 0x4B, 0x20, 0x33, 0x53, 0x23, 0xAE, 0x82, 0xD6, 0x1B, 0x74,
+    0x54, 0x10, 0x5D, 0xF0, 0x9C, 0xEA, 0xD4, 0xB8, 0x1A, 0x91, 0x7B, 0x73, 0x54, 0xFF, 0x6F, 0xA2,
+    0x8A, 0x19, 0xFF, 0xD1, 0x8F, 0x0D, 0x17, 0x66, 0xFE, 0x31, 0xE2, 0x4A, 0x93, 0xC1, 0x85, 0x5C,
+    0xFF, 0xF8, 0x5A, 0x84, 0x67, 0x52, 0x10, 0x57, 0xEE, 0x1F, 0xE6, 0x83, 0x2C, 0x59, 0x59, 0x3E,
+    0xFC, 0x45, 0x91, 0x7F, 0x74, 0xCB, 0xCD, 0x78, 0x7D, 0x67, 0xF9, 0x42, 0xDE, 0xFB, 0xFC, 0x05,
+    0xBD, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0xD1, 0x9D, 0xA5, 0x4C, 0x31, 0x0D, 0x0D,
+    0x0A, 0x92, 0xEB, 0x34, 0xF1, 0x3F, 0x90, 0xB5, 0x1D, 0x0A, 0x28, 0x68, 0xD2, 0x6C, 0xAE, 0xA0,
+    0x48, 0x7B, 0xBA, 0x26, 0xFF, 0xC0, 0xEE, 0xD9, 0x90, 0x92, 0x82, 0x2B, 0xA0, 0xA2, 0x40, 0x42,
+    0x14, 0x68, 0xAF, 0xA0, 0x3D, 0x09, 0xDF, 0x7A, 0x94, 0x2B, 0x4E, 0xE8, 0x8A, 0x38, 0x0A, 0x12,
+    0xC5, 0x15, 0x71, 0x71, 0x11, 0x12, 0x2B, 0x91, 0x91, 0xE2, 0x53, 0xBC, 0xB7, 0xDE, 0x1D, 0xBE,
+    0xF1, 0xDE, 0x05, 0x12, 0x01, 0x8A, 0x90, 0x60, 0xAC, 0xF1, 0xFC, 0x78, 0x33, 0xF3, 0xDE, 0xFB,
+    0xDE, 0x37, 0x6F, 0x0E, 0x80, 0x1F, 0x0C, 0x84, 0xD5, 0x50, 0x16, 0x48, 0x3A, 0xC0, 0xFE, 0x69,
+    0x58, 0x00, 0xCB, 0x06, 0xE2, 0xC5, 0xDC, 0x2B, 0x8F, 0xAD, 0xB5, 0xBE, 0x9D, 0x73, 0x81, 0x30,
+    0x80, 0xD2, 0x94, 0x02, 0x78, 0x73, 0x38, 0x00, 0xB8, 0xFE, 0x49, 0x05, 0x95, 0x62, 0xDC, 0x0F,
+    0x82, 0xFF, 0x7E, 0x10, 0x0F, 0x87, 0xF3, 0xE1, 0xC7, 0x4F, 0xAC, 0x2B, 0xCB, 0xA4, 0x6F, 0xAA,
+    0x01, 0x3C, 0x03, 0x99, 0x0F, 0xE0, 0x1B, 0x5A, 0xF7, 0x7F, 0x37, 0xF1, 0xF0, 0xEE, 0xF9, 0xF0,
+    0xDE, 0x4F, 0x6B, 0x5B, 0x56, 0x97, 0x0D, 0xFA, 0x12, 0xFF, 0x43, 0x73, 0xA3, 0xE4, 0x22, 0xDF,
+    0xB6, 0xC0, 0xC6, 0x56, 0xCD, 0xB1, 0xCA, 0xAF, 0x64, 0x9C, 0x82, 0x78, 0x35, 0x95, 0x4C, 0xF6,
+    0x18, 0x27, 0xDB, 0x41, 0x5C, 0xEC, 0x77, 0x54, 0xE7, 0x77, 0x44, 0x9F, 0x8A, 0x3B, 0x04, 0x15,
+    0xC3, 0xA1, 0x52, 0xC6, 0x63, 0xEC, 0xA6, 0x1A, 0x4E, 0x85, 0x5A, 0x9C, 0xDF, 0x5D, 0x32, 0x9E,
+    0xB6, 0x42, 0x62, 0xCF, 0x40, 0xE8, 0x10, 0xBD, 0xC5, 0xCF, 0x29, 0x89, 0x12, 0x9A, 0x1D, 0xC5,
+    0x13, 0xAB, 0x39, 0x27, 0x6B, 0xFE, 0x84, 0x89, 0x9C, 0x8F, 0xAF, 0xFD, 0xFA, 0x39, 0x4A, 0xE3,
+    0x61, 0xA6, 0xB9, 0xC3, 0xBA, 0x6D, 0x67, 0xEB, 0x53, 0x1A, 0x9A, 0x5D, 0xC1, 0x45, 0x09, 0x6F,
+    0x0C, 0xDD, 0xF1, 0xD6, 0xB6, 0xCE, 0x03, 0x95, 0xFA, 0xAD, 0x3B, 0xA5, 0x81, 0x3C, 0xAA, 0x10,
+    0x51, 0x5A, 0xAC, 0x87, 0xD1, 0x83, 0x67, 0x5B, 0x1D, 0x0D, 0xD7, 0xEE, 0x3C, 0x57, 0x36, 0xED,
+    0x1C, 0x81, 0xB5, 0x0D, 0xE6, 0x1B, 0x96, 0x67, 0x04, 0xA4, 0x1E, 0x32, 0x56, 0xC9, 0x43, 0x3D,
+    0x87, 0x91, 0x23, 0xA1, 0xD2, 0x91, 0xB5, 0x86, 0xDB, 0x3A, 0x6F, 0x38, 0xCC, 0xB0, 0x66, 0xA7,
+    0x63, 0x69, 0x8F, 0xE2, 0xE1, 0xE5, 0x96, 0xCC, 0xDB, 0xF3, 0xCA, 0x34, 0xB3, 0x36, 0x95, 0x2E,
+    0x34, 0x5E, 0x8A, 0xCB, 0x42, 0x03, 0x83, 0x1E, 0x26, 0x2A, 0xAA, 0x45, 0xE5, 0xAD, 0x6E, 0x97,
+    0x0C, 0x6B, 0x92, 0x62, 0x2A, 0x2A, 0xEA, 0x11, 0x66, 0xE0, 0x58, 0x1F, 0x3E, 0xA8, 0xC2, 0xD4,
+    0x11, 0x9E, 0xB0, 0x3B, 0xB3, 0x9D, 0xE2, 0xC3, 0x84, 0x77, 0x87, 0xAC, 0x24, 0x02, 0x20, 0x2B,
+    0xB7, 0xFA, 0x41, 0x2F, 0x19, 0x5F, 0x2D, 0x5B, 0xEF, 0x71, 0x86, 0xF0, 0x00, 0xA9, 0xFB, 0xD3,
+    0xB8, 0x60, 0xEA, 0xF4, 0x20, 0xD3, 0xBD, 0x52, 0x43, 0x0B, 0x24, 0x7D, 0xC4, 0xA5, 0x55, 0x9B,
+    0xB4, 0xAF, 0xB4, 0x56, 0xAC, 0xBE, 0xCC, 0xE8, 0x70, 0x42, 0x6F, 0x5E, 0xAB, 0xB4, 0x29, 0x11,
+    0x2D, 0x12, 0xCF, 0x5E, 0x94, 0xA0, 0xE7, 0x90, 0xCF, 0x32, 0x84, 0x79, 0x02, 0xF7, 0x1D, 0xB2,
+    0x52, 0x46, 0xEF, 0xFB, 0x75, 0x6E, 0x3D, 0xD5, 0x25, 0x5E, 0x59, 0x53, 0x51, 0x3A, 0x77, 0x00,
+    0xC6, 0x3D, 0x40, 0xB4, 0x6F, 0xD8, 0x49, 0x6B, 0xC3, 0x8B, 0x7B, 0x8F, 0xB4, 0xBF, 0xD0, 0x98,
+    0x1A, 0x77, 0xFD, 0xC3, 0xA7, 0x79, 0xF8, 0xC2, 0xAE, 0x46, 0xD1, 0x52, 0xE1, 0x4E, 0x0F, 0xCF,
+    0x1D, 0xF8, 0x25, 0x45, 0xD6, 0x78, 0xF6, 0x8B, 0x3E, 0x00, 0x8E, 0x91, 0x21, 0x05, 0x37, 0x69,
+    0xEC, 0x20, 0x5A, 0x61, 0xC0, 0x78, 0x65, 0x95, 0x34, 0x19, 0xE9, 0xB7, 0x4B, 0xCC, 0xC7, 0xF4,
+    0x98, 0xB5, 0x70, 0x95, 0x1C, 0xE8, 0xA8, 0xAF, 0x8B, 0x18, 0xAD, 0x30, 0x15, 0x46, 0xD5, 0xB2,
+    0x12, 0xD6, 0xE6, 0x28, 0x97, 0xBD, 0xB3, 0x3B, 0x93, 0x3D, 0xDA, 0x50, 0x1D, 0xDE, 0x2D, 0xA5,
+    0xF6, 0xDA, 0x02, 0xEA, 0x33, 0x8D, 0xA6, 0xF0, 0x32, 0x4E, 0xA6, 0xA5, 0x5D, 0x49, 0xED, 0x73,
+    0x52, 0x9E, 0x68, 0x14, 0x94, 0x9D, 0xE8, 0xCD, 0x96, 0xB8, 0x30, 0x7C, 0xE9, 0xCE, 0xE4, 0x1B,
+    0x6B, 0x4F, 0x7E, 0x9D, 0x44, 0xD4, 0xE1, 0x5C, 0x21, 0xB2, 0x7F, 0xDB, 0xA5, 0x92, 0xEF, 0x88,
+    0x2F, 0x53, 0xDC, 0x74, 0xD2, 0x31, 0x45, 0x04, 0x1A, 0x07, 0x18, 0xAD, 0x3B, 0x0D, 0x3B, 0x2A,
+    0xBD, 0xEA, 0x20, 0xD0, 0x4C, 0x22, 0x23, 0xDC, 0x64, 0x87, 0x31, 0x19, 0x31, 0xEE, 0x52, 0x53,
+    0xA3, 0x3D, 0x75, 0x89, 0x86, 0xB9, 0x51, 0x9C, 0x92, 0x59, 0x83, 0x57, 0x9D, 0x35, 0x7F, 0xEE,
+    0xD7, 0x44, 0xA7, 0x52, 0x75, 0xF6, 0x7E, 0xE3, 0x9C, 0x0D, 0x7E, 0xAE, 0x10, 0x8F, 0x87, 0x5B,
+    0x33, 0xEE, 0x29, 0x27, 0x93, 0x7D, 0x2E, 0x1C, 0xAF, 0xEF, 0x72, 0xC4, 0xE0, 0x2E, 0xF1, 0x1E,
+    0x03, 0xA1, 0x5D, 0xB8, 0xE9, 0xFE, 0x0D, 0x5C, 0x83, 0xFF, 0xA9, 0xA1, 0xF6, 0x4E, 0xE5, 0x2A,
+    0x8D, 0xB8, 0xB2, 0x11, 0x95, 0x6F, 0x54, 0xDA, 0x12, 0xE6, 0x86, 0xC6, 0x0F, 0xD4, 0x87, 0x15,
+    0x33, 0x84, 0x4B, 0x11, 0x89, 0x73, 0x21, 0x78, 0xDC, 0x63, 0xAC, 0xA8, 0x2B, 0x41, 0xA3, 0x74,
+    0x50, 0xA9, 0x74, 0x97, 0x76, 0x36, 0xBE, 0x49, 0x5C, 0x1E, 0x38, 0xAE, 0x78, 0xD8, 0xEE, 0xA6,
+    0x75, 0xB0, 0xDE, 0x3E, 0xBB, 0x6E, 0x7A, 0xE5, 0x24, 0x21, 0xA1, 0xB8, 0x5E, 0x49, 0x9B, 0xFB,
+    0x4C, 0x22, 0xFD, 0xFD, 0x68, 0xFB, 0xBB, 0xA3, 0x7E, 0x84, 0x22, 0x7D, 0xEB, 0x92, 0xB9, 0xE2,
+    0x1D, 0x60, 0x1B, 0x9B, 0x5F, 0x69, 0xAC, 0x0A, 0x24, 0x33, 0x1D, 0xB0, 0x79, 0x39, 0xD3, 0x51,
+    0x5C, 0x88, 0xA3, 0x99, 0x3E, 0x88, 0x8B, 0x50, 0xCC, 0x8E, 0xAA, 0xB8, 0x18, 0x89, 0xD9, 0xA3,
+    0x34, 0x9E, 0xD6, 0x62, 0xD6, 0x21, 0x2E, 0x73, 0x31, 0x33, 0x88, 0xFD, 0xFC, 0x5D, 0xDC, 0xA2,
+    0xE1, 0xE7, 0x04, 0x8C, 0x77, 0x61, 0xA3, 0xC7, 0xE5, 0xDF, 0x1E, 0xB6, 0x8D, 0x6B, 0x1F, 0x69,
+    0xDF, 0x14, 0x18, 0x4B, 0xAD, 0xF2, 0xC2, 0x37, 0x52, 0x8F, 0x51, 0xA8, 0x5C, 0xF2, 0xB2, 0x95,
+    0x64, 0xBB, 0xEE, 0x50, 0x04, 0xB5, 0xD4, 0x11, 0x83, 0xDC, 0x49, 0x1D, 0xD4, 0x05, 0x22, 0xBA,
+    0xD7, 0x61, 0x32, 0xF9, 0x96, 0xDC, 0xAA, 0xD5, 0xE4, 0xFB, 0xFC, 0x16, 0x59, 0x6E, 0xD0, 0x0A,
+    0x2D, 0xEA, 0x90, 0x48, 0x8E, 0x10, 0x33, 0xB0, 0x2D, 0xA3, 0x5A, 0x47, 0x1C, 0x1E, 0x20, 0x66,
+    0x78, 0xDB, 0x08, 0xE2, 0x39, 0xB3, 0x69, 0xA9, 0xD7, 0x29, 0x77, 0x87, 0x37, 0x6F, 0x9F, 0xB7,
+    0xD0, 0x72, 0x22, 0x5C, 0x2C, 0xF9, 0x28, 0x4E, 0x6B, 0xEC, 0x2E, 0x9E, 0x42, 0x7E, 0x5D, 0xB4,
+    0x38, 0x5F, 0x1C, 0xEB, 0x28, 0x2C, 0x06, 0xE2, 0xF1, 0xE2, 0xA1, 0x19, 0x85, 0x85, 0x52, 0x9F,
+    0x2C, 0x74, 0x6B, 0xC2, 0x22, 0xF8, 0xCD, 0x5B, 0xE8, 0xA4, 0x0A, 0x0B, 0xBF, 0x63, 0x47, 0xA5,
+    0xE1, 0x36, 0x7C, 0xFA, 0x4D, 0x96, 0x38, 0x92, 0xFC, 0xD1, 0x04, 0x24, 0xD1, 0x92, 0x64, 0x3A,
+    0xFD, 0x0B, 0x59, 0xDF, 0xE0, 0xFE, 0x19, 0x93, 0x76, 0x87, 0xD5, 0x07, 0x1D, 0xAF, 0x6E, 0x97,
+    0xC0, 0x3B, 0xE7, 0xD3, 0xFA, 0x0B, 0x5F, 0xE6, 0xE7, 0xEB, 0x97, 0x79, 0xC5, 0x87, 0xFA, 0x25,
+    0x5F, 0xC0, 0xCF, 0x73, 0x8C, 0x69, 0xBB, 0x49, 0x52, 0x7E, 0x64, 0x46, 0xC4, 0xD4, 0xE8, 0xE1,
+    0x2D, 0xCB, 0xEF, 0xAD, 0x54, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0x3C, 0x46, 0x67, 0x09, 0x4B,
+    0x18, 0xA4, 0x6B, 0xE0, 0x90, 0xDC, 0x1E, 0x95, 0xFF, 0x82, 0xB5, 0x1D, 0x28, 0x68, 0xAF, 0x60,
+    0x43, 0x41, 0x4B, 0xB1, 0xDA, 0xE6, 0xFE, 0x81, 0xDD, 0xB5, 0xFB, 0x34, 0x27, 0x21, 0x44, 0x41,
+    0x73, 0x05, 0x42, 0x91, 0xAF, 0x48, 0x93, 0x72, 0x36, 0xB6, 0x42, 0x81, 0x94, 0x14, 0x18, 0xA2,
+    0x88, 0x22, 0x45, 0x2C, 0x7E, 0x08, 0x29, 0x29, 0xB0, 0x2E, 0x16, 0x78, 0x0F, 0xEF, 0x3E, 0xBE,
+    0x99, 0x4D, 0xE0, 0x08, 0x24, 0x07, 0x22, 0xDE, 0x9B, 0x37, 0x73, 0xF3, 0xDE, 0xCC, 0xBC, 0x1F,
+    0xDF, 0xF7, 0xA6, 0x45, 0x71, 0x45, 0x64, 0xB8, 0x51, 0x9C, 0xDC, 0xAE, 0x30, 0xD3, 0xF0, 0xFE,
+    0xE5, 0xF4, 0x61, 0xF8, 0x83, 0x7A, 0x24, 0x83, 0xBF, 0x79, 0x77, 0x88, 0x2A, 0xD5, 0xDD, 0x80,
+    0x7B, 0xDA, 0xC2, 0xA7, 0x26, 0x3C, 0x04, 0xE6, 0x1A, 0xCE, 0x2F, 0x2D, 0xBC, 0x7B, 0x15, 0xA2,
+    0x28, 0xC5, 0x50, 0xC2, 0xFB, 0x4E, 0x90, 0xF9, 0x3F, 0x4B, 0x17, 0x85, 0x02, 0xED, 0xA4, 0xAA,
+    0x05, 0xFC, 0x0A, 0x88, 0x00, 0x68, 0xE0, 0xC9, 0xBF, 0xDC, 0x58, 0xA1, 0x94, 0x4A, 0xC6, 0xC7,
+    0x0B, 0x20, 0x01, 0xC2, 0x14, 0x5E, 0x65, 0xD5, 0xDA, 0x1A, 0x7B, 0x35, 0xD0, 0x5B, 0x8D, 0xDB,
+    0x21, 0xCD, 0xA4, 0x55, 0xD2, 0xC3, 0x49, 0x31, 0xDD, 0x86, 0x31, 0x2D, 0x8B, 0xDC, 0x18, 0x47,
+    0xDB, 0x2B, 0x2F, 0x9E, 0xAE, 0x02, 0x9F, 0xD3, 0xD1, 0x3B, 0x0D, 0x22, 0xBE, 0xDF, 0x87, 0xA9,
+    0x57, 0xC7, 0xBC, 0x5D, 0xF3, 0x91, 0xCE, 0xAB, 0x54, 0x9B, 0xF0, 0xF9, 0x0E, 0xC1, 0x15, 0x06,
+    0x12, 0x03, 0xA3, 0x0E, 0x28, 0x2B, 0x38, 0x6B, 0x3E, 0xCF, 0x2B, 0x82, 0x9C, 0xA1, 0x6E, 0x6F,
+    0x0B, 0x73, 0x5C, 0x1E, 0xA0, 0xA4, 0x82, 0xDF, 0xE3, 0x8F, 0x4F, 0x3F, 0x4F, 0xEC, 0xC9, 0x11,
+    0x1C, 0x91, 0x0D, 0xBC, 0xD5, 0x32, 0xAB, 0xC2, 0x6A, 0xE6, 0x37, 0x09, 0x66, 0xAA, 0x8B, 0x31,
+    0x43, 0x3F, 0xA7, 0x18, 0x34, 0x85, 0xFE, 0x53, 0xD8, 0x3D, 0x9A, 0x38, 0x7D, 0x94, 0xCE, 0xDC,
+    0x36, 0x68, 0x66, 0x61, 0xED, 0x8A, 0x48, 0x8A, 0x8C, 0x49, 0x80, 0xB3, 0x4C, 0x2F, 0x78, 0xF2,
+    0x2D, 0x38, 0xC7, 0x9A, 0xAE, 0x0E, 0x18, 0x9C, 0xDE, 0x67, 0xD5, 0xE6, 0x70, 0x1F, 0x35, 0x70,
+    0x85, 0x79, 0x65, 0x64, 0x21, 0x73, 0xCB, 0x00, 0x82, 0xAF, 0x72, 0x2C, 0x99, 0x88, 0x26, 0x62,
+    0x22, 0x12, 0x06, 0xB7, 0x60, 0x70, 0xCB, 0x09, 0x54, 0x3E, 0x63, 0x32, 0xFE, 0xE3, 0xA8, 0x33,
+    0x46, 0x68, 0x06, 0x3D, 0x88, 0x9F, 0x1A, 0xD8, 0x87, 0xFA, 0xA4, 0x46, 0x4C, 0x2F, 0x7E, 0xDA,
+    0x4E, 0xDF, 0x73, 0x1A, 0x71, 0x6A, 0x11, 0x87, 0x3F, 0x5E, 0x6B, 0x4A, 0x1E, 0x9B, 0x7E, 0xD4,
+    0x58, 0x6B, 0xF7, 0xDC, 0x34, 0xC1, 0xCB, 0x50, 0x9F, 0x56, 0x4E, 0x87, 0x98, 0xE1, 0xA4, 0xEE,
+    0xC3, 0xFF, 0xB3, 0x2C, 0x99, 0x41, 0x79, 0x68, 0xC4, 0xC6, 0xDE, 0x7B, 0x64, 0x75, 0xF5, 0x0B,
+    0x92, 0x8D, 0xBD, 0x5E, 0xB6, 0xD2, 0x62, 0x22, 0x7A, 0x86, 0xC4, 0x94, 0x58, 0x8C, 0x58, 0xCC,
+    0x9D, 0x13, 0xD6, 0x81, 0x9E, 0x59, 0x6C, 0x19, 0x02, 0xC0, 0x93, 0x95, 0x41, 0x4A, 0x87, 0xC5,
+    0xB8, 0x4C, 0xCD, 0xA5, 0x64, 0xC1, 0x40, 0x8B, 0x84, 0x16, 0x41, 0x1E, 0xA6, 0x61, 0xE5, 0x89,
+    0xD4, 0xB4, 0xC8, 0x27, 0x30, 0x89, 0x81, 0x09, 0x10, 0x8C, 0xEF, 0xFC, 0xA2, 0x94, 0x23, 0x97,
+    0x61, 0x56, 0xB1, 0x76, 0x4A, 0xEE, 0x10, 0x67, 0x1A, 0xC1, 0x3B, 0x54, 0x99, 0x45, 0xC4, 0xC5,
+    0x5E, 0x4B, 0x9B, 0x81, 0x36, 0x2B, 0x93, 0x61, 0xE3, 0x95, 0x7F, 0x9E, 0x79, 0xBE, 0xAC, 0x94,
+    0x48, 0xBB, 0x1C, 0x97, 0x91, 0x25, 0xF6, 0x59, 0x6B, 0xD3, 0x78, 0x88, 0xC3, 0xDB, 0x22, 0x37,
+    0x89, 0xC2, 0xBD, 0x15, 0xDD, 0xEF, 0xDC, 0x8F, 0xCB, 0xD4, 0x92, 0x63, 0x6E, 0xF9, 0xE1, 0xB6,
+    0x89, 0x0C, 0x81, 0x09, 0x9D, 0x97, 0x99, 0x6D, 0x02, 0x55, 0xEF, 0x62, 0x13, 0xC8, 0xC6, 0x11,
+    0xD2, 0x88, 0xD1, 0x4D, 0xE0, 0xAF, 0xF9, 0x46, 0x26, 0xB5, 0x76, 0xD6, 0x5E, 0xAB, 0x69, 0x35,
+    0x68, 0x46, 0x38, 0xD7, 0x3C, 0x12, 0xEB, 0xA0, 0x42, 0x52, 0x4A, 0xFE, 0x58, 0xE8, 0xC0, 0x0A,
+    0xA3, 0xA0, 0x76, 0xAE, 0x89, 0x07, 0xAD, 0x55, 0xAF, 0x7A, 0xCD, 0xB6, 0xD1, 0xD0, 0x1F, 0x31,
+    0x24, 0x38, 0x60, 0x36, 0x8B, 0xBC, 0x94, 0x75, 0xF8, 0xE0, 0xE4, 0x4E, 0x8B, 0x51, 0x0C, 0x97,
+    0x0C, 0x1F, 0x25, 0x70, 0xBF, 0x59, 0x63, 0xEE, 0x33, 0x59, 0x21, 0x1F, 0xEF, 0xDD, 0x3A, 0xC1,
+    0xC8, 0xAF, 0xDD, 0xAF, 0x7B, 0xAB, 0xBB, 0x57, 0x63, 0x84, 0xF7, 0xE8, 0x76, 0x65, 0x1B, 0x0C,
+    0x58, 0x02, 0x97, 0xCB, 0x97, 0x6C, 0x75, 0x76, 0x36, 0xE4, 0xC9, 0x1A, 0x1B, 0xAF, 0x8B, 0xD2,
+    0xE0, 0x8B, 0x06, 0x73, 0x83, 0xDA, 0xBB, 0xE3, 0x05, 0x2B, 0xFB, 0xDB, 0x59, 0x51, 0xE8, 0x6D,
+    0x6B, 0x22, 0x42, 0x15, 0x8F, 0x05, 0xB5, 0x53, 0x65, 0x32, 0xD0, 0xA5, 0x14, 0xBB, 0xF6, 0x78,
+    0xE8, 0xD6, 0xAA, 0x9D, 0xE3, 0x15, 0x55, 0x3D, 0xE9, 0x0D, 0x87, 0x0D, 0x12, 0xA9, 0x83, 0x26,
+    0x7B, 0xBB, 0xC3, 0x10, 0xC3, 0xFB, 0xD6, 0x50, 0x60, 0xFC, 0xBE, 0x41, 0x62, 0x59, 0x14, 0x27,
+    0x95, 0xCD, 0xA0, 0x81, 0x3B, 0x1B, 0x28, 0xD6, 0x78, 0x93, 0x25, 0xAE, 0x7C, 0x62, 0xC0, 0x49,
+    0xED, 0x71, 0x76, 0x45, 0x3B, 0xAE, 0x3D, 0xF8, 0x0C, 0x42, 0xFA, 0x7F, 0x70, 0xF7, 0xE0, 0xF1,
+    0xDE, 0x2E, 0xBC, 0x2F, 0xA5, 0xF6, 0xEE, 0x4B, 0xEF, 0x91, 0xE8, 0x5E, 0x8B, 0xB9, 0xD7, 0x20,
+    0xA6, 0x77, 0x31, 0xF5, 0x17, 0x8E, 0xBF, 0xF3, 0xF4, 0xB5, 0x81, 0x4D, 0x8F, 0x65, 0xCB, 0x6A,
+    0x38, 0x07, 0x48, 0x52, 0x02, 0x2F, 0x48, 0x71, 0x7D, 0xEB, 0xC8, 0x1B, 0xC5, 0xD5, 0x52, 0x4E,
+    0xCF, 0x0A, 0xD3, 0x20, 0x0D, 0x52, 0x88, 0x17, 0xFF, 0x59, 0x4B, 0xC6, 0xBC, 0x6D, 0xEE, 0x97,
+    0xCE, 0x35, 0xF7, 0x9A, 0x4D, 0x53, 0xC8, 0x92, 0xFE, 0x39, 0xCD, 0x5D, 0xC9, 0x51, 0x24, 0xC3,
+    0xE2, 0xD2, 0x75, 0x6D, 0xF5, 0x4B, 0x9A, 0xD4, 0xF0, 0xD9, 0x52, 0xCA, 0x06, 0x5E, 0x6F, 0x01,
+    0x3A, 0xE2, 0xDF, 0x31, 0x06, 0x92, 0x24, 0x63, 0x0B, 0x3B, 0xC0, 0xAE, 0xD6, 0xFB, 0x84, 0x96,
+    0xFE, 0xEB, 0xB7, 0xFB, 0xEA, 0xE9, 0xAF, 0xF7, 0x6F, 0xBD, 0x6E, 0xF2, 0x37, 0x51, 0xAD, 0x5F,
+    0x45, 0xD0, 0xFF, 0x34, 0xB1, 0x66, 0x9A, 0xBF, 0x7D, 0x9B, 0xE8, 0x89, 0x5D, 0x5F, 0xF8, 0x73,
+    0xFA, 0xB2, 0xCD, 0x72, 0x14, 0xC5, 0x31, 0xCF, 0x18, 0xAE, 0x02, 0x67, 0x85, 0x91, 0xAD, 0xF3,
+    0x94, 0x74, 0x5A, 0x47, 0x36, 0xB9, 0x91, 0xD2, 0x51, 0x76, 0x3B, 0x83, 0x91, 0x58, 0x28, 0x23,
+    0x63, 0xD5, 0x18, 0xE9, 0xD6, 0x66, 0xC7, 0x67, 0x83, 0x52, 0x83, 0xE4, 0xC6, 0x52, 0x4C, 0x07,
+    0xC8, 0xF1, 0xC2, 0xBF, 0xDF, 0x01, 0x9D, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0x21,
+    0xB1, 0x74, 0x53, 0x4C, 0x83, 0x84, 0x44, 0x81, 0xFF, 0x41, 0xFC, 0x07, 0x62, 0xAF, 0x93, 0x14,
+    0x29, 0xA1, 0xC8, 0x91, 0x22, 0x05, 0x94, 0x47, 0x75, 0x7F, 0xC0, 0x7B, 0x6B, 0x72, 0x05, 0x45,
+    0x0A, 0x22, 0xA4, 0x54, 0x34, 0x41, 0xA2, 0x80, 0xA5, 0xB8, 0x16, 0x89, 0xB9, 0xBB, 0x21, 0x29,
+    0x52, 0xA4, 0x71, 0x43, 0x95, 0x22, 0x2E, 0x42, 0x73, 0x2B, 0x91, 0xD1, 0x65, 0x40, 0x3E, 0xE2,
+    0xDD, 0xE1, 0x7B, 0xDE, 0x4B, 0x0D, 0xC2, 0x77, 0xF6, 0xCA, 0x6F, 0x66, 0xDE, 0xFB, 0xDE, 0xFB,
+    0xBE, 0xF7, 0xBC, 0x87, 0xB4, 0x45, 0xEA, 0x91, 0x03, 0xDA, 0xA1, 0x01, 0x0A, 0x24, 0x1E, 0xB0,
+    0xC8, 0xDC, 0x3B, 0xF3, 0xD9, 0xF2, 0xE4, 0xC7, 0xBA, 0x88, 0xBC, 0xFA, 0x93, 0xE5, 0xD1, 0xD9,
+    0xD1, 0xB9, 0x98, 0xF5, 0x0B, 0xD9, 0x6D, 0x8E, 0x64, 0x77, 0x25, 0xBB, 0x93, 0xBF, 0x68, 0xAE,
+    0x8B, 0xE7, 0x0E, 0x8B, 0xB8, 0xA6, 0x93, 0x18, 0x5B, 0xF0, 0xA2, 0x9B, 0xE9, 0x3E, 0x3A, 0xFB,
+    0x01, 0x31, 0x8E, 0xB8, 0xF7, 0xDB, 0x9D, 0x4B, 0xDB, 0xFB, 0xC8, 0x9E, 0xC5, 0x3E, 0x7B, 0x19,
+    0x87, 0x6C, 0xC4, 0x3A, 0xA3, 0x9B, 0xAC, 0xE7, 0xDD, 0xF1, 0x76, 0x98, 0xFD, 0xDB, 0x0D, 0xDC,
+    0x01, 0xF2, 0x16, 0xAA, 0x07, 0x06, 0xE0, 0x23, 0x86, 0xAA, 0x25, 0xDE, 0xD5, 0x16, 0xDF, 0x5B,
+    0x14, 0xDA, 0x65, 0x9D, 0xC5, 0xA0, 0x5D, 0x01, 0x9B, 0x75, 0xDA, 0x0D, 0x38, 0x8D, 0xD0, 0xD1,
+    0xC3, 0x1A, 0xA7, 0xDD, 0x01, 0x6C, 0xEA, 0xB5, 0x33, 0xCE, 0xE2, 0x40, 0xBB, 0xD4, 0x5B, 0x18,
+    0x97, 0x7C, 0x42, 0x7F, 0x04, 0x76, 0x80, 0xA9, 0x00, 0x82, 0xF1, 0xBD, 0x4B, 0x87, 0x5F, 0x70,
+    0x7D, 0xE5, 0xD4, 0xC6, 0x62, 0xB1, 0x72, 0xE6, 0xC0, 0xA6, 0x6F, 0x56, 0xEE, 0x7A, 0x65, 0xF5,
+    0xE1, 0xEA, 0x57, 0x5F, 0xD9, 0x52, 0xAD, 0x9E, 0xB9, 0xCA, 0x06, 0xB5, 0xFA, 0x03, 0xD5, 0xA9,
+    0x53, 0xAB, 0x81, 0x3F, 0xC4, 0x95, 0x3E, 0xDC, 0x81, 0x6E, 0x79, 0xF4, 0xDB, 0x0E, 0xF9, 0x9A,
+    0x5E, 0x27, 0x7C, 0x3B, 0x2D, 0x76, 0xF6, 0x81, 0x79, 0x85, 0x29, 0xEC, 0x97, 0x01, 0x73, 0xD5,
+    0x2B, 0x01, 0xD3, 0x9A, 0xBA, 0x41, 0xA1, 0x3C, 0x1A, 0x53, 0x63, 0xB0, 0x48, 0xDF, 0xF4, 0x50,
+    0x2F, 0x6B, 0xE8, 0x91, 0xC0, 0x3A, 0x48, 0xCA, 0x92, 0x29, 0x0B, 0x44, 0x8E, 0x90, 0x0C, 0xB8,
+    0xB2, 0xEF, 0x50, 0x70, 0xF1, 0x94, 0x85, 0xDE, 0x43, 0xFA, 0x80, 0x84, 0x90, 0x88, 0xE7, 0xFF,
+    0xED, 0xE7, 0x34, 0xC6, 0xE7, 0xC2, 0x47, 0xBE, 0x4D, 0xF7, 0xF2, 0x87, 0x57, 0x89, 0x24, 0x10,
+    0xDB, 0x20, 0x81, 0xF4, 0xD3, 0x1E, 0xA6, 0x45, 0x61, 0x1C, 0x2A, 0x60, 0x24, 0x82, 0x11, 0x8A,
+    0xB0, 0x09, 0xD2, 0xDC, 0x0F, 0x10, 0x33, 0x77, 0xCD, 0xEA, 0x24, 0x98, 0x36, 0xD9, 0xB0, 0x66,
+    0x33, 0x98, 0x91, 0xE8, 0x2C, 0x2A, 0xCF, 0xAD, 0x03, 0x53, 0x90, 0xE4, 0xCC, 0xC7, 0x2E, 0xAF,
+    0xB5, 0x6B, 0x64, 0xC1, 0xDC, 0xF7, 0x15, 0x39, 0x9B, 0x99, 0xDA, 0x32, 0xE6, 0xBC, 0x49, 0x02,
+    0x33, 0xF8, 0xBB, 0x57, 0x6F, 0x3A, 0x4A, 0xA6, 0xCE, 0x22, 0xA0, 0x46, 0x98, 0xC0, 0x3C, 0xFB,
+    0x89, 0x8E, 0xED, 0xB5, 0x87, 0x1D, 0xE0, 0x3B, 0x4F, 0x70, 0xD9, 0xB3, 0x0E, 0x01, 0xB9, 0xA9,
+    0xE9, 0xC4, 0x56, 0x84, 0x90, 0x7A, 0x89, 0x48, 0xB7, 0x74, 0x5E, 0xAA, 0x4E, 0x85, 0xC4, 0x9B,
+    0xB6, 0xF0, 0xC2, 0xFC, 0x5B, 0x57, 0xA2, 0xD4, 0x5F, 0xDF, 0xE0, 0xD2, 0xF5, 0x82, 0x08, 0xCF,
+    0xFB, 0xEB, 0x0D, 0x54, 0xC4, 0x2F, 0x3D, 0xB2, 0x01, 0x51, 0x14, 0x9F, 0x06, 0xC9, 0x18, 0x92,
+    0xF3, 0x65, 0x69, 0x23, 0x45, 0xC2, 0xE2, 0x74, 0xC9, 0xA7, 0x17, 0xBB, 0x5B, 0x13, 0x65, 0xCD,
+    0xC7, 0x5C, 0x76, 0xC5, 0xF8, 0x10, 0x59, 0x8C, 0x04, 0xF0, 0x68, 0xDF, 0xD3, 0x94, 0xF5, 0x89,
+    0x94, 0x81, 0xBB, 0x0A, 0xD9, 0x65, 0x69, 0x52, 0x9E, 0xA6, 0xBC, 0xCD, 0xFA, 0x0F, 0x58, 0xDC,
+    0x18, 0xA5, 0x1D, 0x5E, 0x6D, 0x6B, 0xDB, 0x60, 0x5B, 0xE7, 0xA3, 0xB3, 0xC7, 0x8C, 0x30, 0xE2,
+    0xC3, 0x93, 0xE5, 0x64, 0x98, 0xB4, 0x36, 0xED, 0x90, 0x18, 0x3C, 0xD3, 0x32, 0xC4, 0x48, 0x43,
+    0xD1, 0x12, 0xAE, 0xE7, 0x0E, 0x2B, 0x8A, 0xA7, 0xDB, 0x45, 0xBD, 0xE0, 0x6A, 0x1E, 0x37, 0xF5,
+    0xB6, 0x2C, 0x14, 0x4A, 0x1A, 0x2F, 0x14, 0x89, 0x22, 0x6A, 0x02, 0xB9, 0xB8, 0x12, 0x4A, 0xE8,
+    0x5E, 0x16, 0xD8, 0x4F, 0x60, 0x35, 0xC4, 0x6B, 0x10, 0xD9, 0x30, 0xCB, 0xF9, 0x74, 0x82, 0xDA,
+    0x61, 0x0D, 0xA2, 0x70, 0x2F, 0xCF, 0x88, 0x6A, 0x77, 0xBD, 0xBB, 0xFB, 0x6E, 0xA1, 0xD3, 0x92,
+    0x70, 0x48, 0xB6, 0x27, 0x66, 0xD3, 0x09, 0x71, 0xC8, 0x18, 0x9B, 0xC9, 0x55, 0x1E, 0xF0, 0x79,
+    0x29, 0x85, 0x58, 0x33, 0xB8, 0x8E, 0x62, 0x14, 0x65, 0xEF, 0x21, 0x39, 0xFD, 0xC6, 0x33, 0xD7,
+    0x17, 0x2E, 0xBB, 0xB8, 0x57, 0xC8, 0x49, 0x3B, 0xE9, 0x88, 0x43, 0x45, 0x53, 0x16, 0x52, 0xD7,
+    0xE8, 0x59, 0xD7, 0xF8, 0x84, 0xF4, 0x5C, 0x9A, 0x58, 0x2F, 0xFE, 0x0F, 0xDC, 0x95, 0x0E, 0xB8,
+    0xE7, 0xD2, 0x18, 0xF7, 0xE9, 0x99, 0x7A, 0xC0, 0x95, 0xCB, 0x62, 0x08, 0x49, 0x34, 0xF1, 0x91,
+    0xBE, 0xA6, 0xCA, 0x15, 0x87, 0x0E, 0x45, 0x49, 0x88, 0xE6, 0x50, 0x44, 0x7B, 0x23, 0x48, 0x5B,
+    0x10, 0xEB, 0x4C, 0x4E, 0x9D, 0x0A, 0x9A, 0x8B, 0xE3, 0x05, 0x6B, 0xD9, 0xE4, 0xB5, 0xF2, 0x8D,
+    0x10, 0xD3, 0x68, 0xF6, 0x7B, 0xA3, 0x7A, 0xD3, 0x36, 0xA9, 0x2F, 0x40, 0xBD, 0xCD, 0x48, 0xC4,
+    0x38, 0xE7, 0x63, 0x3E, 0xF2, 0x51, 0xE1, 0xEA, 0x63, 0x3A, 0x66, 0x7F, 0x52, 0x2E, 0x84, 0x43,
+    0xB7, 0x25, 0xB5, 0x9E, 0xB3, 0xE2, 0xA6, 0x1D, 0x84, 0x6C, 0x96, 0x38, 0x52, 0x73, 0xC3, 0x08,
+    0x5B, 0xE6, 0xA8, 0xCC, 0xAD, 0x3E, 0x57, 0x1D, 0xC7, 0x48, 0x30, 0xB7, 0xBB, 0x32, 0x3D, 0xF7,
+    0xA6, 0x9E, 0x53, 0x41, 0x4C, 0x8A, 0x35, 0x4A, 0xC7, 0x49, 0x4E, 0xB3, 0x4E, 0x5E, 0xF4, 0xEB,
+    0xE9, 0xE5, 0xC2, 0xCB, 0x4B, 0xCE, 0x0D, 0xE5, 0xB6, 0x79, 0x3A, 0xD1, 0x29, 0x5F, 0xA4, 0x08,
+    0x13, 0x13, 0x81, 0xF8, 0x79, 0xB5, 0xEA, 0xF7, 0xBB, 0x7F, 0x5E, 0x58, 0x61, 0x8A, 0x41, 0x48,
+    0x85, 0x23, 0xD6, 0x12, 0x83, 0xB9, 0x11, 0x54, 0x57, 0x20, 0x18, 0x57, 0xB2, 0x97, 0x6A, 0xAB,
+    0xBA, 0x39, 0x82, 0xEA, 0x4B, 0xE3, 0x4C, 0x3D, 0x53, 0xDD, 0x40, 0xBA, 0x42, 0xC9, 0x16, 0xA8,
+    0x8D, 0xE3, 0x18, 0x78, 0xCC, 0xBA, 0xA6, 0x6B, 0x19, 0xE6, 0x6F, 0xD9, 0x1B, 0xB0, 0x41, 0xFA,
+    0xE2, 0x9A, 0xE8, 0x33, 0x73, 0x32, 0x65, 0x86, 0x74, 0x62, 0x5D, 0xA8, 0xA0, 0xD3, 0x61, 0xB0,
+    0xDA, 0xD9, 0x2A, 0x4F, 0x7D, 0x65, 0x0E, 0x7B, 0x9B, 0xDF, 0xEA, 0x1B, 0x76, 0xFB, 0x60, 0x1E,
+    0x3C, 0xED, 0xAA, 0xF4, 0x9C, 0xC9, 0xB5, 0xA5, 0x16, 0xAD, 0x4C, 0x38, 0xB1, 0x58, 0x2E, 0x8F,
+    0x5A, 0x7A, 0x66, 0xE3, 0xCB, 0xC8, 0x84, 0xCC, 0x52, 0x0E, 0x25, 0x69, 0x92, 0xFC, 0x2B, 0x3E,
+    0x92, 0xB7, 0x94, 0xCA, 0x55, 0x91, 0xA7, 0x16, 0x7D, 0x65, 0xC1, 0x16, 0xAD, 0xF2, 0x45, 0xCA,
+    0x96, 0xD0, 0xAE, 0xDA, 0x0E, 0xDD, 0x99, 0x08, 0x83, 0x1F, 0x0A, 0x54, 0xC2, 0x8C, 0x79, 0xEA,
+    0xC9, 0x3E, 0xA7, 0x0D, 0x41, 0x1E, 0x4B, 0x1F, 0xBB, 0x9D, 0xE5, 0x72, 0x59, 0xB3, 0x1E, 0x1B,
+    0x1C, 0xEC, 0xDE, 0x95, 0x1E, 0xA3, 0x2E, 0x49, 0x1D, 0xA9, 0x91, 0x56, 0x39, 0x0E, 0xD2, 0x21,
+    0x94, 0xCC, 0x26, 0xAE, 0x29, 0x82, 0x9E, 0xA4, 0x70, 0x86, 0xAA, 0x8E, 0x33, 0x25, 0x27, 0x10,
+    0x37, 0x90, 0xE9, 0xDB, 0x1D, 0x07, 0x00, 0xFD, 0xA3, 0x29, 0x27, 0x89, 0xB7, 0x41, 0xD0, 0x6F,
+    0x54, 0x67, 0xCE, 0x96, 0x3F, 0x05, 0x29, 0x13, 0x7B, 0xB5, 0x14, 0xC6, 0x06, 0x11, 0x74, 0x6B,
+    0x9C, 0xF0, 0x53, 0x8F, 0xD2, 0x4E, 0xFC, 0x70, 0x4C, 0x04, 0x1E, 0x63, 0x3A, 0xBA, 0xD9, 0x12,
+    0x14, 0x6B, 0xF3, 0xE8, 0xB3, 0x57, 0xC3, 0x82, 0xA7, 0x38, 0xAD, 0x67, 0x08, 0x29, 0x0B, 0x33,
+    0xA7, 0xC3, 0xB6, 0x22, 0x3D, 0xF5, 0x9C, 0x93, 0xCE, 0x97, 0xA9, 0x57, 0x7D, 0x46, 0x55, 0xB4,
+    0xFC, 0x3B, 0x24, 0x45, 0x15, 0x87, 0xDC, 0x4D, 0xCF, 0x18, 0x0D, 0x99, 0xE2, 0xB4, 0x0A, 0x7B,
+    0x92, 0xDA, 0x4D, 0x2F, 0xB9, 0xB1, 0x0C, 0x4C, 0xAE, 0x60, 0x76, 0xB9, 0x0C, 0x8D, 0x84, 0x0E,
+    0x31, 0x97, 0x19, 0x29, 0x09, 0x4A, 0xAB, 0xAC, 0x27, 0x82, 0xD6, 0x8C, 0x73, 0xBF, 0x1F, 0xC9,
+    0x90, 0x6E, 0x43, 0xA1, 0xFA, 0x6B, 0xFC, 0x66, 0xE4, 0xF5, 0xCF, 0xD9, 0x13, 0x6F, 0xD3, 0x5E,
+    0x38, 0xD2, 0x4C, 0x34, 0xC7, 0xB5, 0x69, 0x84, 0xFD, 0xBF, 0xEB, 0x1F, 0xC5, 0x55, 0xBF, 0x8F,
+    0xDC, 0x44, 0x14, 0xFE, 0x6C, 0xE7, 0xD6, 0xE8, 0x5C, 0x0C, 0xC5, 0x51, 0x45, 0x62, 0x5A, 0x0A,
+    0x24, 0xB7, 0x14, 0x59, 0x7B, 0x72, 0x14, 0x94, 0x5C, 0x03, 0x6D, 0x5A, 0x9A, 0x68, 0xFF, 0x81,
+    0xF5, 0xED, 0x22, 0x0A, 0x4A, 0xAE, 0xE0, 0x0F, 0xA0, 0x8C, 0x56, 0x48, 0xB4, 0x29, 0x9C, 0xD8,
+    0x90, 0x92, 0x66, 0xA2, 0x14, 0x14, 0x14, 0xB1, 0xC4, 0x21, 0x24, 0xD2, 0x4C, 0xE1, 0xC2, 0xA7,
+    0xF3, 0xEE, 0xF0, 0x3D, 0x8F, 0x2F, 0x21, 0x22, 0x88, 0x02, 0x09, 0xAC, 0x9B, 0x79, 0xEF, 0xC6,
+    0xCF, 0xEF, 0xD7, 0xF7, 0xCD, 0xDB, 0xD8, 0xA6, 0x1D, 0x86, 0xBC, 0x43, 0x51, 0x01, 0xCA, 0x01,
+    0xCD, 0x01, 0xCA, 0x7B, 0x9B, 0x5F, 0x64, 0xFD, 0x5B, 0xC0, 0x08, 0xA0, 0x9E, 0x17, 0xF5, 0xB8,
+    0x07, 0x6E, 0x77, 0xB1, 0x3F, 0x40, 0x16, 0x3E, 0x59, 0x75, 0x40, 0x34, 0xF0, 0xDD, 0x23, 0x2E,
+    0x3A, 0xC0, 0x72, 0x96, 0xB4, 0xCD, 0xFA, 0xA8, 0xF1, 0x9D, 0xA2, 0x5D, 0xF9, 0x35, 0x50, 0x20,
+    0xAC, 0xF2, 0xF7, 0xEF, 0x2E, 0xE9, 0x7F, 0x8C, 0x76, 0xBB, 0x6F, 0xF9, 0x2F, 0x6E, 0xE1, 0x28,
+    0xEE, 0xB4, 0xCD, 0xF5, 0x45, 0xE2, 0xCD, 0xC2, 0xDB, 0xCC, 0xFB, 0xBB, 0xBF, 0xDE, 0x76, 0x93,
+    0x17, 0x65, 0x90, 0xB6, 0x8C, 0x97, 0xF8, 0x16, 0x7E, 0x4F, 0x8F, 0x76, 0x72, 0x9C, 0xF3, 0x4D,
+    0x8B, 0xAC, 0x5B, 0xF9, 0xAE, 0xF1, 0xF6, 0xDC, 0xC8, 0x41, 0xD6, 0x02, 0xDE, 0xEF, 0xB5, 0xF7,
+    0x5B, 0xE0, 0xED, 0x0A, 0x6B, 0xAC, 0x2B, 0xBA, 0xA8, 0xFE, 0x79, 0x5B, 0x17, 0xDC, 0xEA, 0x92,
+    0xDB, 0xA8, 0x4D, 0x15, 0xF7, 0xAA, 0xAB, 0x32, 0x97, 0x78, 0xCF, 0x98, 0x8D, 0xD4, 0x78, 0xF4,
+    0xD8, 0xCC, 0x35, 0xBD, 0x71, 0x93, 0x47, 0x73, 0x45, 0xEE, 0x0D, 0xCA, 0x62, 0xAB, 0xF1, 0x59,
+    0x1D, 0xB9, 0xF4, 0xC7, 0x56, 0x63, 0x49, 0x25, 0x79, 0x41, 0xA5, 0x10, 0xE5, 0x9A, 0x4A, 0x4E,
+    0x25, 0xBE, 0x51, 0xC2, 0xAB, 0x8A, 0xC6, 0xCF, 0x9C, 0x66, 0x2E, 0x4F, 0x5D, 0xC3, 0x04, 0xBC,
+    0x95, 0x26, 0xB2, 0x66, 0xF3, 0x37, 0x21, 0x82, 0x32, 0x3D, 0x99, 0x27, 0x3A, 0x1B, 0xEF, 0x4D,
+    0x7C, 0x30, 0x2B, 0x9B, 0x3A, 0xA4, 0x8E, 0x7D, 0x8A, 0x06, 0xCD, 0x96, 0x8C, 0xB9, 0x24, 0x5C,
+    0x0A, 0x08, 0x13, 0x0A, 0x25, 0x0B, 0xF4, 0x61, 0xDB, 0xED, 0x76, 0x4D, 0x38, 0x93, 0xB7, 0x62,
+    0x77, 0xAE, 0x19, 0xAD, 0xE6, 0xB7, 0x18, 0xE9, 0x25, 0x71, 0xF1, 0x01, 0xB9, 0x95, 0x64, 0x0C,
+    0x63, 0x08, 0xDA, 0x27, 0x5C, 0x79, 0x4F, 0x0E, 0x78, 0x93, 0x5D, 0xDE, 0xB3, 0x7A, 0x9B, 0x38,
+    0x7E, 0xDC, 0xD3, 0xCB, 0xC8, 0xA6, 0xD4, 0xCC, 0x61, 0x94, 0x25, 0x3A, 0x09, 0x31, 0xF2, 0x7C,
+    0xD0, 0x26, 0x76, 0xCA, 0x66, 0xC4, 0x92, 0x08, 0x35, 0x04, 0x33, 0x32, 0x78, 0xC8, 0x7D, 0x4F,
+    0x66, 0x65, 0xFB, 0x42, 0x20, 0x2D, 0x05, 0x5A, 0x86, 0x2E, 0xA1, 0xB6, 0x24, 0x12, 0x21, 0xAD,
+    0x91, 0x5A, 0x22, 0x9E, 0x74, 0x60, 0x30, 0xC7, 0x6A, 0xA3, 0x3E, 0x61, 0xC9, 0x23, 0x0F, 0x50,
+    0x93, 0x1A, 0x28, 0x04, 0xF7, 0x92, 0xE6, 0xD0, 0xD2, 0x06, 0xB5, 0x92, 0x8D, 0xA0, 0x21, 0x65,
+    0x04, 0x24, 0xC2, 0xDE, 0x98, 0x09, 0x3F, 0x00, 0xEE, 0xD7, 0x88, 0x0E, 0x4B, 0x24, 0x7D, 0x89,
+    0x84, 0x8D, 0xCE, 0x5A, 0xB5, 0x55, 0x5B, 0xEE, 0x64, 0x58, 0xCE, 0x00, 0x05, 0xFD, 0x33, 0xD5,
+    0x9E, 0xD9, 0x0C, 0xFC, 0x60, 0xCD, 0x4E, 0x16, 0x8C, 0x54, 0x32, 0x90, 0xB6, 0xCC, 0xF5, 0x8C,
+    0xDE, 0x1C, 0xDD, 0x45, 0xBD, 0x30, 0x7C, 0x2D, 0xC1, 0xDE, 0x4D, 0x19, 0x36, 0x82, 0x09, 0xCD,
+    0xFF, 0xCF, 0x6A, 0x79, 0xE7, 0x88, 0x84, 0xFF, 0xC8, 0x42, 0xFD, 0x40, 0x68, 0x2C, 0x0F, 0xDC,
+    0x1D, 0x32, 0xFE, 0xD6, 0x94, 0xC4, 0xBF, 0xAD, 0xF3, 0xD5, 0xB3, 0xF2, 0x66, 0xE6, 0x14, 0xEF,
+    0x81, 0x3C, 0xFE, 0x62, 0x33, 0x29, 0x99, 0x83, 0x9E, 0x94, 0x32, 0x90, 0x92, 0x65, 0xD0, 0xC5,
+    0xB1, 0xC1, 0xF1, 0xC4, 0x17, 0x9E, 0xF2, 0x2E, 0x71, 0x4E, 0xAC, 0x19, 0x8C, 0x01, 0x52, 0x66,
+    0xA8, 0x3F, 0x14, 0xEF, 0xA7, 0x8E, 0x94, 0x62, 0x71, 0xE7, 0xA9, 0x95, 0x34, 0xF8, 0x9D, 0x62,
+    0x7E, 0x93, 0x09, 0xE9, 0x2E, 0xAD, 0xC8, 0x4D, 0x91, 0x58, 0xF1, 0x52, 0xA3, 0xD6, 0xE2, 0x3C,
+    0x71, 0x51, 0x3F, 0x84, 0x40, 0xC9, 0x2F, 0x16, 0x8F, 0x11, 0x8D, 0x48, 0x9F, 0x33, 0x17, 0x93,
+    0xB7, 0x50, 0x83, 0xDC, 0x78, 0x19, 0x07, 0xAD, 0xB0, 0x9E, 0x9E, 0x37, 0x98, 0x58, 0xC5, 0xEA,
+    0x6E, 0x2E, 0x44, 0x3B, 0x2B, 0xC5, 0x2C, 0x63, 0x37, 0x2B, 0xF9, 0x36, 0xC8, 0x72, 0x9C, 0x0F,
+    0xA6, 0x72, 0x49, 0x69, 0x76, 0xF0, 0x41, 0xE6, 0xF7, 0x2C, 0x2A, 0xE9, 0x9A, 0x4F, 0xF7, 0x04,
+    0x27, 0xE7, 0x7C, 0x1C, 0xE9, 0x89, 0xA5, 0x31, 0x65, 0x23, 0x05, 0x09, 0xDB, 0x73, 0xA2, 0x99,
+    0xB5, 0x6B, 0x21, 0x36, 0x91, 0x1E, 0xD2, 0x56, 0xC8, 0x1E, 0xBB, 0x32, 0x12, 0x74, 0x13, 0xDB,
+    0xF3, 0x4B, 0xD5, 0xAA, 0x2F, 0x5B, 0xD6, 0x53, 0x40, 0xF3, 0x8F, 0xFC, 0xC7, 0xB2, 0x47, 0x69,
+    0x18, 0xBB, 0x69, 0x51, 0xCA, 0x45, 0x22, 0xBA, 0xB9, 0x97, 0x3A, 0x43, 0xE2, 0x6A, 0xCE, 0x77,
+    0xF9, 0x7A, 0xB6, 0x2A, 0x24, 0x1B, 0x85, 0x5C, 0x63, 0x1F, 0x70, 0xCA, 0x86, 0x49, 0x1C, 0xE1,
+    0x86, 0x1C, 0x0B, 0x7F, 0x45, 0x4D, 0x5A, 0x12, 0xF9, 0xE6, 0xB9, 0x63, 0xA4, 0x6F, 0x74, 0xAB,
+    0x68, 0x7C, 0x2E, 0x13, 0x3A, 0x76, 0x72, 0xB3, 0xF5, 0x17, 0xE2, 0x53, 0x2E, 0x24, 0xB2, 0x27,
+    0x9D, 0xCC, 0xF5, 0xBF, 0xA8, 0x93, 0x81, 0xD8, 0xAA, 0xCF, 0xE5, 0xB3, 0x5E, 0x92, 0xDA, 0x60,
+    0x63, 0xCE, 0x74, 0x1B, 0x1D, 0x36, 0x3F, 0xF7, 0x48, 0xA7, 0xAE, 0xA7, 0xFE, 0x25, 0x2B, 0x71,
+    0xFC, 0x92, 0x36, 0x72, 0x43, 0x1A, 0x2B, 0x26, 0xDB, 0xEC, 0xFA, 0x7A, 0x48, 0xBB, 0x93, 0xFC,
+    0x54, 0x26, 0x08, 0x3D, 0x55, 0x32, 0xD0, 0xEF, 0xB1, 0xD8, 0xDF, 0x98, 0xD2, 0x55, 0x1F, 0x06,
+    0x91, 0xFE, 0x98, 0x83, 0xFC, 0x7B, 0x69, 0x76, 0xFE, 0xD5, 0x4F, 0x8E, 0xF3, 0x84, 0xEC, 0x92,
+    0x71, 0x57, 0xB2, 0x1B, 0x0B, 0xF3, 0x8A, 0x8E, 0xEA, 0x2A, 0xC0, 0xE5, 0x2F, 0x45, 0xDC, 0x59,
+    0x48, 0x6C, 0x9C, 0x3C, 0x0C, 0xAC, 0x7F, 0x14, 0x6C, 0xDE, 0x0F, 0xE2, 0x83, 0x20, 0xFE, 0x4C,
+    0xE6, 0x7C, 0x8F, 0x4D, 0x2F, 0x6C, 0xB9, 0xEB, 0x3D, 0x92, 0x21, 0x43, 0x97, 0xB7, 0xF2, 0x5B,
+    0x82, 0xB4, 0x9B, 0x7A, 0x1B, 0x7A, 0x43, 0x78, 0xCB, 0xC9, 0x7C, 0x08, 0x74, 0xA9, 0x67, 0xB1,
+    0x7C, 0x4D, 0xF0, 0xF0, 0xBD, 0x20, 0xAA, 0x40, 0xF5, 0x2A, 0xB0, 0xBE, 0x9A, 0x66, 0x1C, 0x85,
+    0xF0, 0x9A, 0x22, 0x71, 0x59, 0x47, 0xC1, 0x81, 0xB7, 0x8F, 0xFD, 0x96, 0x77, 0x47, 0x66, 0xAD,
+    0x17, 0xBC, 0x4F, 0xA7, 0x11, 0x7A, 0x16, 0x90, 0xFB, 0xDF, 0x9F, 0x3F, 0x00, 0x9D, 0x55, 0x3D,
+    0x8C, 0xDD, 0x44, 0x10, 0x1E, 0x7B, 0xD1, 0x73, 0x92, 0x95, 0xD8, 0x14, 0x41, 0x8A, 0x00, 0x61,
+    0x8A, 0x14, 0x14, 0x49, 0xDC, 0x5C, 0x71, 0x05, 0xB6, 0x97, 0x2B, 0x42, 0x41, 0x91, 0x34, 0xD0,
+    0xA4, 0xA1, 0x48, 0x01, 0x08, 0x74, 0x29, 0xA0, 0x7B, 0x17, 0x5B, 0xA2, 0x48, 0x7B, 0x4D, 0x6A,
+    0xAE, 0xA0, 0x4A, 0x91, 0x4B, 0x41, 0x91, 0xC2, 0x0F, 0xAF, 0x72, 0xE5, 0x15, 0x67, 0x74, 0xA2,
+    0xA2, 0xC0, 0xA0, 0x1C, 0x05, 0x14, 0xB7, 0x24, 0x06, 0x1C, 0xE2, 0x7B, 0xCB, 0x37, 0xB6, 0xDF,
+    0xFD, 0x44, 0x42, 0x44, 0xAC, 0xB4, 0xB3, 0xBB, 0xB3, 0xE3, 0x99, 0xD9, 0xF9, 0xF9, 0x4C, 0xF4,
+    0x89, 0x26, 0x22, 0xCF, 0x3D, 0x05, 0x15, 0xDF, 0x95, 0x35, 0xE8, 0xC3, 0x2B, 0x1B, 0x38, 0xC8,
+    0x0A, 0x84, 0xFC, 0x9A, 0xA9, 0xD7, 0xEF, 0x25, 0x4B, 0xD2, 0x4B, 0x74, 0x38, 0xB2, 0x6A, 0x32,
+    0x27, 0xE1, 0xAC, 0x74, 0x95, 0xFA, 0x69, 0xC3, 0x7F, 0xD7, 0x86, 0x2C, 0xD1, 0xA5, 0x7C, 0x57,
+    0x24, 0x4C, 0xE3, 0x98, 0x69, 0xB2, 0x36, 0x52, 0x51, 0x2D, 0x68, 0xC2, 0x34, 0x4E, 0x99, 0xCE,
+    0x22, 0x2D, 0x6A, 0xEA, 0x54, 0x15, 0xB6, 0xA2, 0x09, 0x9C, 0x2B, 0x5D, 0x4D, 0x65, 0x1B, 0x3A,
+    0x4D, 0x1E, 0xD1, 0x35, 0x7C, 0xE8, 0xDC, 0x01, 0x3B, 0xF7, 0xDB, 0xDF, 0x16, 0xCB, 0x44, 0x78,
+    0x39, 0x9D, 0x1C, 0x0D, 0x05, 0x15, 0xC9, 0xAD, 0x9A, 0x60, 0x3E, 0x52, 0x39, 0xC1, 0x72, 0x01,
+    0x1F, 0x5A, 0x12, 0xB6, 0xC3, 0x24, 0xF5, 0x10, 0xD3, 0x50, 0x82, 0x17, 0x31, 0x1B, 0x52, 0x07,
+    0xF8, 0x22, 0xA1, 0xA0, 0xA5, 0x90, 0x3A, 0x4A, 0x2D, 0x15, 0xBE, 0xA5, 0x67, 0x46, 0x58, 0x51,
+    0xCB, 0x9D, 0x5C, 0xE5, 0xCA, 0xC0, 0xB3, 0x35, 0x8A, 0x3C, 0xCB, 0x17, 0x89, 0x34, 0x2D, 0xB4,
+    0x76, 0xB1, 0x6F, 0xA7, 0xE4, 0xFD, 0x61, 0x83, 0x5D, 0x0B, 0x67, 0x72, 0xB5, 0xA3, 0x29, 0x38,
+    0xA0, 0xB0, 0x23, 0x52, 0x96, 0x52, 0x44, 0x28, 0xCC, 0x29, 0x3B, 0xF2, 0xEA, 0xD5, 0xBB, 0x77,
+    0xE1, 0x68, 0xE6, 0x1C, 0xF6, 0xD5, 0xCD, 0xA5, 0xE3, 0x0E, 0x7B, 0x1B, 0xF4, 0x16, 0xF9, 0xB7,
+    0x0D, 0x3C, 0x0F, 0x43, 0x8D, 0x10, 0x4C, 0x63, 0x52, 0xB9, 0x6F, 0x5B, 0xF8, 0x27, 0xB7, 0xE0,
+    0x0E, 0xDB, 0x84, 0xE5, 0x46, 0x69, 0x55, 0x05, 0x26, 0xA1, 0xD2, 0x44, 0x54, 0x88, 0x7D, 0xC8,
+    0x37, 0x97, 0xE3, 0x00, 0x57, 0x16, 0xE1, 0x0D, 0xB6, 0xF3, 0xDF, 0xF1, 0xB0, 0xCE, 0xDF, 0xCF,
+    0x29, 0xAC, 0x05, 0xFC, 0x88, 0xC6, 0xA4, 0xC1, 0x42, 0x39, 0xD7, 0xC2, 0xB9, 0x56, 0xCC, 0xDF,
+    0x29, 0x44, 0x8B, 0x34, 0xB6, 0x9C, 0x18, 0xCC, 0x19, 0x26, 0xE7, 0x07, 0x0F, 0x22, 0xC1, 0xB9,
+    0xE5, 0x8B, 0x64, 0xC1, 0xB0, 0xA3, 0x54, 0xB8, 0x38, 0x64, 0x48, 0xA8, 0xE4, 0xD2, 0x28, 0x5D,
+    0x45, 0xBE, 0x6B, 0xB0, 0xE3, 0x5C, 0x2A, 0xB0, 0x45, 0xD5, 0x87, 0x1E, 0x39, 0x3E, 0xC6, 0x88,
+    0x9E, 0x42, 0xD2, 0x94, 0x77, 0xEE, 0xDF, 0xEA, 0xCD, 0x40, 0x29, 0x52, 0xE3, 0x35, 0xFD, 0x57,
+    0x88, 0x3B, 0x8B, 0xB0, 0x9F, 0xD8, 0x35, 0x1E, 0x62, 0x63, 0x7C, 0x67, 0xC9, 0xEB, 0x06, 0x59,
+    0xD3, 0x9B, 0x3C, 0x3C, 0xD0, 0xA2, 0xF0, 0xF0, 0xD1, 0xB2, 0x44, 0x68, 0xAF, 0xC2, 0x95, 0x39,
+    0x58, 0x73, 0x2E, 0x09, 0x68, 0x7D, 0x8C, 0xE4, 0x9A, 0xE5, 0x18, 0x57, 0xE9, 0x57, 0x44, 0x01,
+    0xB3, 0x4B, 0xB8, 0x01, 0x8D, 0x3E, 0xE7, 0xDD, 0x9C, 0x27, 0x5C, 0x51, 0x70, 0x18, 0xF5, 0xE5,
+    0x57, 0xDE, 0xEF, 0x32, 0xD7, 0x4D, 0x89, 0xCE, 0xB1, 0x66, 0x4D, 0x59, 0x93, 0xCE, 0x8B, 0x4C,
+    0x5F, 0xC2, 0xE9, 0x8C, 0xDA, 0xAA, 0xEE, 0xA3, 0xBE, 0x2F, 0xCC, 0x2E, 0x5D, 0xB4, 0x34, 0x59,
+    0xA7, 0xD4, 0xE9, 0xB5, 0xF0, 0xE0, 0x73, 0xFA, 0x88, 0x7B, 0xE0, 0xD1, 0xA8, 0xC1, 0xD5, 0xC3,
+    0x7A, 0x71, 0x54, 0xEA, 0xE9, 0x37, 0x8F, 0xA7, 0xB5, 0x0F, 0x32, 0x8A, 0x8A, 0x5D, 0x40, 0x47,
+    0xD5, 0xF4, 0xBA, 0xD0, 0x83, 0xB0, 0x3E, 0x0B, 0x06, 0x9D, 0xA5, 0xFF, 0x1E, 0x1F, 0xF7, 0x74,
+    0xB2, 0x9E, 0xB2, 0x2E, 0xF4, 0xD6, 0xED, 0x0F, 0xFA, 0x8C, 0x7E, 0xF1, 0xD9, 0x87, 0xA7, 0xFB,
+    0x0B, 0x5A, 0xA7, 0x17, 0x1F, 0x19, 0x47, 0x31, 0xCB, 0x49, 0x71, 0x0D, 0x86, 0x8E, 0x3C, 0x83,
+    0x32, 0xF4, 0xF3, 0x9B, 0x8B, 0x32, 0xEC, 0xA9, 0x1E, 0x4F, 0xE5, 0x58, 0x3A, 0x6F, 0x6C, 0x8E,
+    0xAF, 0xC9, 0x97, 0x9E, 0xD7, 0xB7, 0x3C, 0xAE, 0x41, 0x7E, 0xD8, 0x79, 0xC3, 0x50, 0x3D, 0x3D,
+    0x4D, 0x9E, 0xED, 0x37, 0x96, 0x53, 0x78, 0x9E, 0xFA, 0xF8, 0x53, 0x58, 0x0D, 0x25, 0x12, 0xE2,
+    0xCE, 0xB7, 0x63, 0x94, 0x5E, 0xC6, 0x3C, 0x75, 0xDC, 0xFA, 0xBF, 0x8D, 0x0B, 0x83, 0x2F, 0x28,
+    0xE6, 0xDE, 0x66, 0xBA, 0x2E, 0xBB, 0x21, 0x30, 0x66, 0x32, 0x94, 0xC8, 0xA7, 0x2F, 0x1A, 0x0C,
+    0x8E, 0xBE, 0xCF, 0x28, 0xB6, 0xC8, 0x14, 0x4F, 0x80, 0x0C, 0x05, 0xA6, 0xAF, 0xF3, 0x07, 0x74,
+    0x99, 0x0D, 0x71, 0xCD, 0x2E, 0x5E, 0x31, 0xE9, 0xD7, 0x90, 0x8E, 0x6A, 0x71, 0x48, 0xFF, 0x49,
+    0xC5, 0x96, 0x35, 0x25, 0xFC, 0x46, 0xB9, 0x97, 0xF5, 0xAD, 0xC2, 0xC2, 0x37, 0xC6, 0x5B, 0x61,
+    0xB8, 0xE9, 0x10, 0xA8, 0x34, 0x87, 0x44, 0x5A, 0xA3, 0x53, 0xA2, 0x16, 0x25, 0xAD, 0xEE, 0x81,
+    0xA9, 0xB6, 0xC1, 0x94, 0xBB, 0x60, 0x8A, 0x1A, 0x4C, 0x61, 0x13, 0x6A, 0xFC, 0x46, 0x81, 0xD9,
+    0x0A, 0x30, 0x3B, 0x2C, 0xD5, 0x0C, 0xBA, 0xC1, 0x57, 0xF9, 0xDB, 0x40, 0xCB, 0x5A, 0xA1, 0x77,
+    0x5A, 0xF1, 0x23, 0x83, 0x9C, 0x33, 0x60, 0x02, 0x77, 0xC4, 0x9E, 0x42, 0x5D, 0x3A, 0xE0, 0x06,
+    0x43, 0x19, 0xC6, 0x03, 0x1A, 0xBB, 0x72, 0x70, 0xBD, 0xEF, 0xA5, 0x80, 0x4B, 0xD7, 0xBB, 0x36,
+    0x44, 0xB3, 0x46, 0x9E, 0xA6, 0xE8, 0x34, 0xF5, 0x0B, 0x80, 0x95, 0xC1, 0x75, 0xBC, 0x00, 0x2E,
+    0x9D, 0xC9, 0x0B, 0x92, 0x4D, 0x04, 0x64, 0x93, 0x46, 0xEC, 0xAF, 0x58, 0xFF, 0x49, 0x55, 0x50,
+    0x03, 0x46, 0x1B, 0x4B, 0x33, 0x55, 0x2B, 0x36, 0x16, 0x55, 0x11, 0x51, 0x13, 0x85, 0x14, 0xCB,
+    0x1D, 0xAD, 0x56, 0x00, 0x9B, 0x55, 0x09, 0x24, 0x8B, 0x6A, 0x4A, 0x9F, 0x01, 0x8E, 0xDA, 0x05,
+    0x22, 0x70, 0xA8, 0xCD, 0x08, 0x32, 0x5C, 0x27, 0xE7, 0x8E, 0x10, 0xE3, 0x16, 0xB7, 0x07, 0xDC,
+    0xCF, 0xB8, 0x51, 0x9E, 0x87, 0x10, 0xC0, 0x3D, 0xB7, 0x9F, 0xD3, 0xEA, 0xCE, 0xF5, 0x06, 0x8C,
+    0x0C, 0x12, 0xB2, 0x8A, 0x81, 0x22, 0x90, 0x58, 0x03, 0x23, 0xD2, 0x80, 0x4D, 0x93, 0x78, 0xAB,
+    0x95, 0x72, 0xAE, 0x12, 0x6E, 0x3E, 0xD4, 0x10, 0x1B, 0x5B, 0xCC, 0xCD, 0x5F, 0xD7, 0x7B, 0xC4,
+    0x7A, 0xED, 0x7B, 0x7D, 0x82, 0x7F, 0x62, 0xC2, 0x96, 0x84, 0x02, 0xCC, 0x0E, 0xE7, 0x99, 0xE4,
+    0x3F, 0x84, 0xA1, 0x74, 0x58, 0xBD, 0x0E, 0xFC, 0x06, 0x33, 0x4F, 0xDD, 0xD7, 0x70, 0xA9, 0x13,
+    0x7B, 0xD7, 0x3B, 0xA5, 0xFD, 0x2E, 0x06, 0x4A, 0xE1, 0x87, 0xB3, 0x5B, 0x51, 0x78, 0x55, 0x03,
+    0xB8, 0x83, 0x2D, 0xDB, 0xA8, 0xCD, 0x2F, 0xF7, 0x56, 0x3B, 0xD5, 0x0B, 0x97, 0x70, 0x37, 0x81,
+    0x97, 0x4B, 0xFC, 0x9E, 0x78, 0x78, 0x30, 0x3F, 0x6B, 0x71, 0xBC, 0x11, 0x3E, 0xF2, 0x9F, 0xC0,
+    0xE2, 0xFC, 0x4A, 0x17, 0x19, 0xBF, 0xF9, 0x96, 0xC4, 0x63, 0xBC, 0x6F, 0xDB, 0x50, 0xB8, 0x0A,
+    0x94, 0x2C, 0xC8, 0xFB, 0xD3, 0x52, 0xF0, 0x83, 0xA1, 0x28, 0xD2, 0xDF, 0x74, 0xA5, 0xF7, 0xD7,
+    0xCF, 0xCE, 0x77, 0x72, 0xDF, 0x21, 0xE0, 0xCE, 0x14, 0xDE, 0x7B, 0xFC, 0x2B, 0x63, 0xEF, 0x23,
+    0xFE, 0xC5, 0x0E, 0x0D, 0x25, 0x0D, 0xFD, 0xFF, 0xF1, 0x0F, 0x95, 0x55, 0x3D, 0x8F, 0xDC, 0x44,
+    0x18, 0x7E, 0x66, 0x47, 0x3A, 0x4B, 0x19, 0x09, 0x37, 0x41, 0x48, 0x5C, 0xE1, 0x26, 0x0D, 0x12,
+    0xC2, 0x35, 0x52, 0xEC, 0xF5, 0x89, 0x1F, 0xC0, 0x49, 0xB0, 0xA1, 0xA0, 0x80, 0x32, 0xA2, 0xB9,
+    0x16, 0x89, 0xFD, 0x82, 0x3F, 0x40, 0x24, 0x44, 0x7F, 0x2D, 0x4B, 0x91, 0x3F, 0xE0, 0xDB, 0x1D,
+    0x44, 0x71, 0x42, 0x57, 0x60, 0xE9, 0xA0, 0xA2, 0x31, 0x84, 0x34, 0x47, 0x71, 0x03, 0x67, 0x22,
+    0x27, 0xF1, 0xDE, 0xF0, 0xBC, 0xE3, 0x0D, 0x5C, 0xA2, 0x4D, 0x14, 0x56, 0x9A, 0xD9, 0x99, 0xF1,
+    0x3B, 0xCF, 0xFB, 0xF5, 0xBC, 0xEF, 0x00, 0xFC, 0x0D, 0x1C, 0x50, 0x02, 0x29, 0x60, 0x7E, 0xF4,
+    0xFE, 0xC2, 0xFB, 0xEE, 0xD1, 0xE2, 0x9B, 0x0C, 0x88, 0x0B, 0xE8, 0x0A, 0x68, 0x80, 0xFF, 0xB5,
+    0x09, 0xBF, 0xC8, 0x22, 0x01, 0xC6, 0x50, 0x7F, 0x2E, 0xEE, 0x9E, 0x78, 0x9F, 0x8E, 0xDE, 0x2F,
+    0x45, 0x8F, 0xB1, 0xA2, 0xE6, 0x79, 0x4B, 0x68, 0xEF, 0xDB, 0xD8, 0x7B, 0x97, 0x2F, 0x16, 0x05,
+    0xF1, 0x04, 0x56, 0x00, 0x89, 0x8B, 0xCD, 0xF6, 0xE0, 0xEB, 0xFD, 0xC8, 0xFB, 0x2A, 0xF1, 0xBE,
+    0xD8, 0xF2, 0xF5, 0x99, 0xED, 0xCE, 0x62, 0x31, 0xF0, 0xDE, 0x2E, 0x17, 0x87, 0xE2, 0x9B, 0xDD,
+    0x38, 0xCA, 0xA3, 0x39, 0x75, 0x5C, 0xF1, 0xDA, 0x5E, 0x09, 0xC1, 0x90, 0x17, 0x64, 0x88, 0x09,
+    0x02, 0xB5, 0x6D, 0xE4, 0xA3, 0x82, 0x72, 0xEB, 0x20, 0x9B, 0x21, 0x71, 0x19, 0x74, 0xCB, 0xF3,
+    0x8E, 0x63, 0xC2, 0x91, 0x73, 0x0C, 0xAF, 0x0E, 0xB9, 0xC2, 0x31, 0x45, 0x50, 0xA2, 0x3A, 0xDC,
+    0xD9, 0x75, 0xA0, 0x17, 0x58, 0x5D, 0x72, 0x5B, 0xE0, 0x13, 0x1A, 0xE8, 0x3B, 0x73, 0xB6, 0x78,
+    0xDA, 0x26, 0x7F, 0x89, 0x95, 0x6F, 0xD2, 0xBD, 0x95, 0xB1, 0xD1, 0x5F, 0x0E, 0x65, 0x89, 0xE4,
+    0x00, 0xFA, 0x0F, 0x8B, 0x47, 0x4E, 0xF0, 0xE2, 0x39, 0x74, 0x0D, 0x45, 0x5F, 0xBB, 0xC1, 0xDE,
+    0x1A, 0x94, 0x4E, 0xD7, 0x12, 0xFA, 0x09, 0x06, 0x35, 0xD2, 0x41, 0x43, 0x99, 0xA8, 0x8E, 0x2D,
+    0x65, 0x5A, 0x9A, 0x90, 0x8B, 0x19, 0xAD, 0xAE, 0x09, 0x1C, 0x55, 0x39, 0xBF, 0x22, 0xD5, 0xB5,
+    0x58, 0xD4, 0xE5, 0x04, 0x82, 0xBE, 0xB8, 0x47, 0xDD, 0x88, 0x97, 0xA5, 0x40, 0x30, 0x42, 0x9C,
+    0xD3, 0xE9, 0x44, 0x32, 0x79, 0xEF, 0xB7, 0xA6, 0x17, 0xB3, 0x74, 0x45, 0xD7, 0x84, 0x31, 0x55,
+    0xAE, 0x5A, 0x28, 0x41, 0xAB, 0x08, 0x2C, 0xD0, 0x41, 0xCF, 0xFA, 0x3D, 0x31, 0x2C, 0xF2, 0x47,
+    0x62, 0x58, 0xEA, 0x02, 0x11, 0x52, 0x3C, 0xA1, 0xD8, 0xF6, 0x8D, 0xDA, 0x7F, 0x03, 0xD7, 0x70,
+    0x6D, 0x3E, 0x21, 0x59, 0x26, 0x28, 0x95, 0x8B, 0x2A, 0x94, 0x91, 0xA5, 0x7F, 0x5D, 0x42, 0x14,
+    0xB4, 0x63, 0x09, 0xDF, 0x43, 0xFA, 0x0F, 0xF5, 0xF8, 0x5C, 0xEC, 0x39, 0x3F, 0x12, 0x27, 0xC7,
+    0x42, 0x97, 0x5F, 0x5D, 0x47, 0x9B, 0x22, 0xDB, 0x41, 0xBB, 0x24, 0xB8, 0x39, 0x56, 0xED, 0xA0,
+    0x51, 0x4E, 0xF9, 0xF3, 0x22, 0xB2, 0x03, 0x1F, 0x54, 0x94, 0xFF, 0x29, 0xA5, 0xF7, 0xFF, 0x6A,
+    0x2E, 0x7B, 0xF5, 0x32, 0x1F, 0xF8, 0x8A, 0xAC, 0x72, 0xAF, 0x14, 0x09, 0xA5, 0xC4, 0xCF, 0xA4,
+    0x90, 0x38, 0x86, 0xE0, 0x72, 0xCB, 0x8C, 0x0D, 0x19, 0x11, 0x46, 0x18, 0xA3, 0x15, 0x23, 0x93,
+    0x16, 0x7D, 0x52, 0xCB, 0x1E, 0x56, 0x2E, 0x4C, 0xDF, 0xC6, 0xAE, 0xF3, 0xDE, 0xEF, 0x79, 0xCF,
+    0x9C, 0xD0, 0xEE, 0x01, 0xF9, 0xA7, 0xF9, 0x21, 0x26, 0x0A, 0xE5, 0x12, 0x1E, 0x5D, 0x27, 0x23,
+    0xFD, 0x1D, 0x43, 0xA1, 0xDF, 0x99, 0x7F, 0xC1, 0xA7, 0x1A, 0x5A, 0xB4, 0x5B, 0x19, 0x3F, 0x1F,
+    0xF8, 0xAE, 0x47, 0x6A, 0x03, 0x76, 0xFC, 0x03, 0xE2, 0x53, 0x62, 0xAD, 0xC8, 0x92, 0xB7, 0x7A,
+    0xB4, 0x9B, 0x01, 0x6C, 0x97, 0xB5, 0x52, 0x09, 0x69, 0x48, 0xAC, 0x92, 0x24, 0x4F, 0xC9, 0xD2,
+    0xA8, 0xD6, 0x15, 0x13, 0x92, 0x91, 0x61, 0xBA, 0x22, 0x46, 0xA6, 0x1D, 0x17, 0xC4, 0xCB, 0x88,
+    0xA4, 0xCF, 0x79, 0x77, 0xC8, 0x8D, 0xFE, 0x85, 0x36, 0x64, 0x29, 0x59, 0x53, 0x91, 0x27, 0x99,
+    0x6E, 0x36, 0xC2, 0x54, 0xC7, 0xEB, 0x1D, 0x17, 0xD1, 0xDF, 0xEF, 0x54, 0x48, 0x84, 0xC6, 0x2B,
+    0x89, 0xD3, 0xB8, 0xAF, 0xE3, 0x67, 0x16, 0xAA, 0xB8, 0x8D, 0xD7, 0xC9, 0xC8, 0xBA, 0x44, 0x6B,
+    0x98, 0xA7, 0x32, 0xB6, 0xE6, 0xFB, 0xC0, 0x4E, 0xC3, 0xF4, 0x2C, 0x1B, 0x98, 0x13, 0x66, 0x70,
+    0x48, 0xC7, 0x3A, 0x1A, 0xE8, 0x8C, 0x8D, 0x6D, 0x89, 0xD9, 0x63, 0xAB, 0x7C, 0x1F, 0xAD, 0xF4,
+    0xA9, 0xBF, 0x57, 0xC5, 0x0D, 0x96, 0xED, 0x11, 0x5D, 0x99, 0xA2, 0xF9, 0x78, 0x8A, 0xEC, 0xE6,
+    0x14, 0xF1, 0xBB, 0x33, 0xE8, 0x53, 0x5E, 0x68, 0x7C, 0xEF, 0x44, 0xBC, 0x62, 0x93, 0xF1, 0x34,
+    0xE1, 0x41, 0x2B, 0x07, 0x73, 0x4A, 0x34, 0x22, 0x51, 0xA0, 0xB9, 0x70, 0xC8, 0xDE, 0x24, 0x01,
+    0x8B, 0xC8, 0x11, 0x63, 0xC6, 0xDA, 0x8F, 0x6A, 0x82, 0x2E, 0x21, 0x66, 0x7E, 0x47, 0x33, 0x3F,
+    0x6D, 0xCD, 0xF1, 0x12, 0xE5, 0xCC, 0x9A, 0xE3, 0x8D, 0x99, 0x73, 0x2C, 0xDB, 0xDE, 0xCC, 0x19,
+    0xCC, 0x31, 0xCD, 0xFC, 0xCC, 0x99, 0xE3, 0x2F, 0x6D, 0x79, 0x63, 0x6A, 0x2C, 0x59, 0x5D, 0xD1,
+    0xF6, 0x8C, 0xB9, 0x7F, 0xED, 0x3E, 0x86, 0xC6, 0xD3, 0x83, 0x95, 0x27, 0x11, 0x32, 0x52, 0xBB,
+    0x0F, 0x98, 0x92, 0xC8, 0xE5, 0xD2, 0x2A, 0x2C, 0x8D, 0x62, 0x64, 0xF3, 0x0F, 0x6A, 0x9E, 0xA4,
+    0x92, 0x13, 0x32, 0xB1, 0x8A, 0x6A, 0x2E, 0x52, 0xE9, 0x4F, 0x21, 0xA8, 0xF5, 0x26, 0x4B, 0xE8,
+    0xB8, 0xE0, 0xB7, 0x0D, 0x0D, 0x65, 0x1C, 0x9C, 0x1D, 0x4A, 0x89, 0xE3, 0xC3, 0x9F, 0xF7, 0x37,
+    0x67, 0xEA, 0x50, 0x42, 0xCB, 0xA0, 0xCD, 0x25, 0xB6, 0x12, 0x43, 0x09, 0xAE, 0x39, 0xB1, 0x21,
+    0xBA, 0xE6, 0xBC, 0x08, 0x76, 0x87, 0x33, 0xF9, 0x66, 0x25, 0xCE, 0x4C, 0x40, 0xB8, 0xA3, 0x5A,
+    0xE9, 0x27, 0x13, 0xA1, 0xEA, 0x74, 0xE7, 0xDB, 0x5A, 0xFA, 0x4D, 0xCB, 0x80, 0xF4, 0xA5, 0x1F,
+    0xCF, 0x85, 0x0B, 0x52, 0xBD, 0x68, 0x87, 0xE4, 0x6F, 0x2E, 0x53, 0x7C, 0xB7, 0x40, 0x1F, 0x57,
+    0x3C, 0xEC, 0xA4, 0x4B, 0x91, 0x1D, 0x88, 0xBF, 0x68, 0x45, 0x52, 0x48, 0xDE, 0x92, 0x24, 0x4F,
+    0xAE, 0x0B, 0xA7, 0xEA, 0xD0, 0x44, 0x10, 0x85, 0xFE, 0x33, 0x65, 0xDF, 0xC2, 0xCE, 0xE7, 0x0C,
+    0xC0, 0x44, 0xDD, 0x72, 0xFC, 0x16, 0xAA, 0x36, 0xA1, 0x1C, 0xA4, 0x66, 0x95, 0x94, 0x6C, 0x24,
+    0x15, 0x9B, 0x48, 0xC1, 0x8E, 0x39, 0x29, 0x29, 0x57, 0xA9, 0x56, 0xBE, 0x0D, 0x9D, 0xB0, 0xA9,
+    0xE3, 0x11, 0x89, 0x1B, 0xD1, 0x74, 0xC6, 0xC7, 0xCC, 0xE5, 0x01, 0xB1, 0x2F, 0x31, 0xB1, 0xF1,
+    0xFA, 0x7E, 0xCA, 0x47, 0xA3, 0x8F, 0x5E, 0xE2, 0xC6, 0x4F, 0x32, 0xAD, 0xC3, 0xD4, 0xB7, 0xC8,
+    0xE7, 0x4C, 0xD7, 0x6F, 0x43, 0xC9, 0x63, 0x31, 0x66, 0x36, 0x12, 0xF2, 0x33, 0x22, 0x77, 0x95,
+    0xDB, 0x1C, 0xA4, 0x03, 0xD1, 0xB8, 0x62, 0xA3, 0xD8, 0x26, 0x31, 0x91, 0x83, 0x07, 0x3C, 0x10,
+    0x0D, 0xF2, 0x10, 0xC9, 0x0B, 0x24, 0x2F, 0x51, 0x78, 0x32, 0xE4, 0x40, 0x09, 0x09, 0x8C, 0x3F,
+    0xE5, 0xB9, 0xBF, 0x14, 0x5B, 0xCE, 0xBE, 0xE2, 0xB2, 0x0B, 0xCF, 0xA6, 0xD5, 0xDB, 0x97, 0xD4,
+    0x28, 0xCD, 0x87, 0x7A, 0xF5, 0xFD, 0xD1, 0xE8, 0xC5, 0xB2, 0x5B, 0x97, 0x78, 0xE1, 0xEF, 0x1F,
+    0xAD, 0x55, 0xBD, 0x6E, 0xD4, 0x40, 0x10, 0x1E, 0xDB, 0x24, 0x2E, 0x5C, 0x6C, 0x15, 0x51, 0x20,
+    0xB1, 0x0D, 0x55, 0x1A, 0x3F, 0x41, 0xEC, 0x8D, 0x40, 0xA2, 0xA0, 0x39, 0x09, 0x8E, 0x67, 0x88,
+    0xD2, 0xE4, 0x05, 0xEE, 0xC7, 0x12, 0x45, 0x0A, 0x9A, 0x3C, 0x42, 0x0A, 0x84, 0x82, 0x53, 0xA4,
+    0xA1, 0x42, 0x77, 0x39, 0x43, 0x4A, 0x9A, 0x93, 0x78, 0x00, 0x2C, 0x24, 0x9A, 0x54, 0x0B, 0xB8,
+    0xF0, 0x45, 0x3E, 0x2F, 0xDF, 0xEC, 0xDE, 0xA1, 0x90, 0x0B, 0x28, 0x0A, 0xF8, 0x6E, 0x77, 0xD6,
+    0xB3, 0xE3, 0xF9, 0xFD, 0x66, 0x77, 0x87, 0xBC, 0xFC, 0x68, 0x44, 0x9E, 0x69, 0x30, 0xCD, 0x9E,
+    0x61, 0xD2, 0x74, 0x79, 0xF2, 0x35, 0x4D, 0x8C, 0x59, 0x4C, 0x2B, 0xBB, 0xAB, 0x53, 0x6A, 0x4C,
+    0x4B, 0xB4, 0x24, 0x49, 0x9E, 0x9F, 0x82, 0x6C, 0x61, 0x75, 0x63, 0x92, 0x76, 0x95, 0x25, 0x66,
+    0xEE, 0x88, 0xC9, 0xEC, 0x9E, 0x2C, 0x2D, 0x09, 0x2A, 0x27, 0xD9, 0x38, 0x32, 0x76, 0x64, 0xE0,
+    0x48, 0x72, 0x2D, 0x21, 0xFB, 0x2C, 0x48, 0xDF, 0x91, 0xC6, 0xCE, 0x7E, 0xCD, 0xF3, 0x81, 0xD4,
+    0x4C, 0x8C, 0x29, 0x2C, 0x69, 0xED, 0x96, 0xA7, 0x68, 0x37, 0xCF, 0x33, 0xF2, 0x8D, 0x31, 0x44,
+    0xD1, 0x79, 0x3E, 0x22, 0x8A, 0x39, 0x40, 0x84, 0x19, 0x16, 0x9C, 0x16, 0x09, 0x76, 0x41, 0x3D,
+    0xCB, 0x36, 0x33, 0x66, 0x1B, 0xC3, 0xEC, 0x6D, 0x63, 0xD9, 0x63, 0x2B, 0xDD, 0xB0, 0xB4, 0xFF,
+    0x9D, 0xA5, 0xC3, 0x8F, 0xCC, 0x96, 0x7B, 0xCC, 0xB6, 0x5E, 0x78, 0x15, 0xCF, 0xA1, 0xB5, 0x1A,
+    0x5B, 0xA3, 0xEC, 0xCE, 0x03, 0xC9, 0x0C, 0x04, 0x0F, 0x01, 0x33, 0xA5, 0x4B, 0x8F, 0x8F, 0x0A,
+    0x50, 0x64, 0x20, 0x14, 0xCD, 0xEE, 0x60, 0x62, 0xAF, 0x03, 0x4D, 0x71, 0x09, 0x45, 0xA9, 0x81,
+    0x03, 0xE9, 0xBE, 0x4E, 0x49, 0x64, 0x63, 0x91, 0x45, 0x85, 0x78, 0x51, 0xFA, 0x3A, 0xD0, 0x35,
+    0x22, 0x6D, 0x12, 0x4A, 0x29, 0x15, 0x99, 0x28, 0xC4, 0x99, 0x06, 0xB3, 0x6C, 0x60, 0xBF, 0x92,
+    0x4A, 0x64, 0xA3, 0x00, 0x22, 0x03, 0x1A, 0xD2, 0x30, 0xA5, 0xA8, 0x8E, 0x8C, 0xE2, 0x32, 0xBB,
+    0x98, 0xA7, 0xC8, 0x40, 0x5C, 0x39, 0xC3, 0x7B, 0x25, 0x1C, 0x82, 0xD9, 0xF6, 0x11, 0xE7, 0x6F,
+    0x8D, 0xB5, 0xD5, 0x22, 0x4B, 0x27, 0x8F, 0xA7, 0xF2, 0xE1, 0xB7, 0x2A, 0x2A, 0x7A, 0xBD, 0x40,
+    0x4B, 0xA9, 0x9A, 0xF0, 0x6C, 0x1A, 0xFB, 0xBA, 0x09, 0xA7, 0x35, 0x5E, 0x46, 0x41, 0x25, 0xE7,
+    0x5C, 0x3E, 0xE5, 0x33, 0x16, 0x3C, 0xB5, 0xA7, 0x5C, 0x62, 0x27, 0xAD, 0x0A, 0x8C, 0xA9, 0xC2,
+    0x76, 0x1B, 0x22, 0x88, 0x00, 0xC3, 0xE3, 0xC0, 0xC7, 0x0C, 0x1B, 0x0C, 0x91, 0x81, 0x59, 0x2E,
+    0xB2, 0x91, 0x2C, 0x19, 0x7A, 0x51, 0x34, 0xB9, 0x7C, 0x19, 0x12, 0xE7, 0x81, 0x76, 0xE0, 0x72,
+    0xCB, 0x1E, 0x2B, 0x8A, 0x0E, 0xC0, 0x7A, 0xCB, 0x1F, 0x70, 0x62, 0x90, 0xC5, 0x75, 0xCE, 0x17,
+    0xC7, 0xD0, 0xE1, 0x0C, 0xCF, 0x20, 0x59, 0x4C, 0x9E, 0x4F, 0x07, 0xD6, 0x0C, 0x94, 0x86, 0x53,
+    0x5B, 0x02, 0xD4, 0x42, 0x2A, 0x6B, 0x11, 0xFA, 0x63, 0xAC, 0x2A, 0x2F, 0x1B, 0x1A, 0xED, 0x9B,
+    0x8A, 0x04, 0x5C, 0x86, 0x8E, 0xFB, 0xB6, 0x4A, 0x77, 0x4B, 0x12, 0x9A, 0x75, 0x21, 0x47, 0x86,
+    0xC7, 0xEE, 0xF1, 0xF9, 0x1B, 0x0A, 0x50, 0xA2, 0x5B, 0x8F, 0xAF, 0x18, 0xC6, 0x0D, 0x8B, 0x80,
+    0xAB, 0x63, 0x83, 0x31, 0xB8, 0x6F, 0xCC, 0x7C, 0xF3, 0x24, 0xCF, 0x18, 0x7B, 0xC0, 0xDC, 0x5F,
+    0x09, 0xC2, 0x91, 0x15, 0x70, 0x03, 0xBF, 0xB1, 0x14, 0xBF, 0x91, 0x35, 0x20, 0x84, 0x24, 0xF2,
+    0x27, 0x3E, 0x68, 0x20, 0x17, 0xAD, 0x54, 0x46, 0x05, 0x00, 0x5B, 0xE3, 0x17, 0x63, 0x2F, 0x28,
+    0x91, 0xEC, 0x11, 0xCC, 0x8A, 0xCF, 0x0A, 0x2A, 0x90, 0xBF, 0x14, 0x3E, 0x86, 0xFA, 0x6A, 0x25,
+    0xCA, 0x6B, 0x18, 0x47, 0x44, 0xAF, 0x35, 0x85, 0x9F, 0x4A, 0x8A, 0x45, 0x41, 0x28, 0x7F, 0x58,
+    0x30, 0xE8, 0x46, 0xB0, 0x0B, 0x7C, 0x04, 0x3A, 0xA1, 0xF0, 0xBD, 0x26, 0xF1, 0xB2, 0xA0, 0x18,
+    0x4D, 0xD9, 0x87, 0x4E, 0xC0, 0xCC, 0x9B, 0xBB, 0x52, 0xB2, 0x92, 0xC4, 0x29, 0x65, 0x5D, 0x97,
+    0x5E, 0x6F, 0xEB, 0x70, 0x77, 0xD6, 0xA1, 0x21, 0xFA, 0x56, 0x72, 0x4F, 0xDF, 0xDA, 0x61, 0xD4,
+    0xFF, 0xC9, 0x75, 0x0E, 0x0B, 0xF4, 0x48, 0xCA, 0xC7, 0xC4, 0xAA, 0xC3, 0x20, 0xD2, 0xAF, 0xC0,
+    0x85, 0xD2, 0x86, 0x06, 0x00, 0x16, 0xF7, 0x1B, 0x89, 0x02, 0x91, 0xF4, 0x81, 0x32, 0xFF, 0x07,
+    0xCB, 0x33, 0x8E, 0x87, 0xCA, 0x41, 0x9F, 0xD8, 0x6F, 0x09, 0x4C, 0x06, 0x5F, 0xF8, 0x6C, 0xC1,
+    0x77, 0x52, 0xF5, 0xA1, 0xC0, 0xE7, 0xF3, 0x54, 0x64, 0xF8, 0xE6, 0xF4, 0xA9, 0x06, 0x42, 0x38,
+    0x15, 0x7A, 0x01, 0x0B, 0x7F, 0x65, 0xE1, 0x75, 0x36, 0xC9, 0x3B, 0x94, 0x2A, 0xD0, 0x51, 0xC1,
+    0xEE, 0x4B, 0xE5, 0xD5, 0x9C, 0x1C, 0x58, 0x4A, 0x19, 0x01, 0xA5, 0x1B, 0xBC, 0x06, 0x8F, 0xF7,
+    0x58, 0x06, 0xB2, 0x53, 0x7C, 0xD3, 0x26, 0xE4, 0xB5, 0x8B, 0xFC, 0x5C, 0x1D, 0x1B, 0x00, 0xFA,
+    0xDC, 0x2F, 0x63, 0xC0, 0x3D, 0x6B, 0xD6, 0xF3, 0x36, 0x3F, 0x48, 0x5D, 0xFB, 0x14, 0xFC, 0x47,
+    0x32, 0xB8, 0x80, 0x8D, 0xFD, 0xFF, 0xAF, 0x8D, 0x79, 0xB7, 0x3B, 0xEC, 0xF0, 0xC1, 0x81, 0x33,
+    0x10, 0xA9, 0xE6, 0xCE, 0x26, 0xD7, 0x2F, 0x64, 0x71, 0xEC, 0x6E, 0x09, 0x72, 0xB8, 0xFE, 0xB5,
+    0xD1, 0x41, 0xA7, 0xA8, 0x43, 0x14, 0xBC, 0xEC, 0xF9, 0xC7, 0x17, 0xAF, 0x24, 0x97, 0x03, 0x4D,
+    0x9B, 0x70, 0x6B, 0xA0, 0x40, 0x3D, 0xAE, 0xD4, 0x8D, 0x98, 0x48, 0x3E, 0x6C, 0xD6, 0xB8, 0x0E,
+    0xDC, 0x4D, 0xC0, 0xD5, 0x75, 0x18, 0xB2, 0x20, 0x72, 0xF7, 0x88, 0x65, 0x7A, 0x0A, 0x45, 0xD9,
+    0xE2, 0x1A, 0xD4, 0x11, 0xC3, 0x8C, 0x91, 0x98, 0x81, 0x95, 0xFC, 0x89, 0x15, 0x96, 0x74, 0xAF,
+    0x14, 0x17, 0x27, 0x26, 0x43, 0x5C, 0xA7, 0xB4, 0xFE, 0x4E, 0xD5, 0x4B, 0xDD, 0x56, 0x61, 0xB2,
+    0x34, 0xC2, 0x07, 0x83, 0x83, 0x49, 0xAA, 0x97, 0x57, 0x84, 0xE4, 0xCD, 0x1E, 0xB9, 0x5E, 0x77,
+    0xAC, 0x35, 0xFA, 0xF7, 0xE7, 0x27, 0xBD, 0x54, 0xBD, 0x6E, 0xDC, 0x46, 0x10, 0xFE, 0x48, 0xC6,
+    0x47, 0x24, 0x5B, 0x6C, 0x13, 0x03, 0x49, 0x9A, 0x6B, 0xD2, 0x24, 0x10, 0x70, 0x2F, 0xA0, 0x23,
+    0xD7, 0x4E, 0x91, 0x42, 0x8D, 0x81, 0xF8, 0xE2, 0xD2, 0x6D, 0xAA, 0xE8, 0x05, 0x4E, 0x47, 0xC6,
+    0x2F, 0x60, 0x3F, 0x82, 0x11, 0xA8, 0x08, 0xAE, 0xC9, 0x0B, 0x50, 0x47, 0xDA, 0x2E, 0x52, 0xB8,
+    0x10, 0x03, 0xB8, 0x73, 0x43, 0x20, 0x32, 0x52, 0xA8, 0x21, 0xE4, 0x35, 0x42, 0x03, 0x3C, 0x6E,
+    0xBE, 0x21, 0xEF, 0x0C, 0x59, 0x92, 0xA3, 0x00, 0x01, 0xC2, 0xC3, 0xEC, 0x1E, 0x87, 0xBB, 0x33,
+    0xDF, 0x37, 0x7F, 0x87, 0xF0, 0x1F, 0x35, 0x08, 0xCA, 0x8B, 0xD2, 0x52, 0x32, 0xA8, 0x32, 0x99,
+    0xB9, 0x72, 0xE2, 0xFE, 0x2A, 0x47, 0xDD, 0x37, 0x25, 0xA8, 0xDB, 0x48, 0x45, 0xE9, 0x06, 0x41,
+    0x74, 0x85, 0xDC, 0xCC, 0x80, 0x29, 0x25, 0xBA, 0x24, 0x9E, 0x89, 0xB2, 0x20, 0x7D, 0x27, 0x49,
+    0x90, 0xAE, 0xE2, 0x53, 0xD7, 0x29, 0xE7, 0x56, 0xF8, 0xF5, 0x24, 0x02, 0x75, 0xEF, 0xC9, 0x39,
+    0xBB, 0x87, 0x18, 0x3D, 0x4C, 0x31, 0x6F, 0x10, 0x1E, 0xCB, 0xF6, 0x51, 0x78, 0xFC, 0xA0, 0x98,
+    0xB7, 0x3B, 0xE1, 0xF3, 0xA7, 0x4F, 0xDA, 0xE4, 0x47, 0xF7, 0xD4, 0x75, 0xD9, 0xA8, 0x0B, 0x0B,
+    0xBF, 0x98, 0x63, 0x67, 0xD8, 0x10, 0x16, 0xC0, 0x7C, 0xCA, 0xCB, 0xDA, 0x0C, 0xC8, 0x61, 0x29,
+    0xEF, 0x2B, 0x46, 0x87, 0x88, 0x72, 0x57, 0x6B, 0x77, 0xEA, 0x82, 0xB7, 0x50, 0x15, 0x4F, 0xB4,
+    0x3C, 0x31, 0xE1, 0x09, 0xF5, 0xAC, 0x84, 0x5F, 0x53, 0x91, 0x5D, 0xA9, 0xE0, 0x6D, 0x28, 0x7A,
+    0xC8, 0x2E, 0x6D, 0x4F, 0xF2, 0x34, 0x73, 0x6E, 0xAF, 0xFB, 0xBE, 0xCD, 0x8D, 0x7A, 0x59, 0x21,
+    0x3A, 0x42, 0x70, 0x5A, 0x48, 0x08, 0xFE, 0x71, 0xAB, 0xB0, 0x79, 0x42, 0x77, 0xC2, 0x35, 0x76,
+    0x8E, 0xAB, 0xBB, 0x95, 0x14, 0x08, 0x2C, 0x91, 0x21, 0x2C, 0x11, 0xD4, 0xD0, 0x05, 0x3C, 0xBB,
+    0x33, 0x26, 0x81, 0x66, 0x57, 0x30, 0xB4, 0xC3, 0x1A, 0xBB, 0xE5, 0x72, 0xD9, 0x8E, 0x1D, 0x9F,
+    0xD6, 0xCB, 0xF9, 0xFF, 0x17, 0xC4, 0xBD, 0xB1, 0x1E, 0x27, 0xE4, 0x3C, 0xE4, 0xAE, 0x80, 0x16,
+    0xE2, 0x62, 0x93, 0x8F, 0xE7, 0xCC, 0x88, 0x7E, 0x13, 0xE7, 0x2A, 0xF1, 0xEB, 0x52, 0xEA, 0x6E,
+    0xC8, 0xD9, 0xFD, 0x4A, 0x10, 0x54, 0xD0, 0x27, 0xFB, 0x3F, 0xDD, 0xB2, 0xC8, 0x76, 0x63, 0x04,
+    0x7F, 0x92, 0x7F, 0x1C, 0xAD, 0x66, 0xF7, 0xCE, 0xC4, 0xCD, 0xA8, 0x5B, 0x2E, 0x1F, 0x4B, 0x88,
+    0x71, 0x80, 0xA1, 0x28, 0x30, 0x91, 0x9B, 0x6B, 0x7C, 0x86, 0xC0, 0xB9, 0x02, 0xCA, 0x35, 0x74,
+    0x60, 0x70, 0x0D, 0x2D, 0xF5, 0x3F, 0xD1, 0x1A, 0xEE, 0x7D, 0x68, 0xBD, 0x89, 0x0D, 0xE9, 0x09,
+    0xAF, 0xA8, 0xFF, 0x48, 0x5A, 0x0A, 0x41, 0x2A, 0xE1, 0xC2, 0x9F, 0xBB, 0xC8, 0xBB, 0xBC, 0x0B,
+    0xCB, 0xEB, 0x7E, 0xF9, 0xDA, 0xB1, 0xB5, 0x3E, 0x45, 0x4F, 0xAE, 0xD6, 0x02, 0x3E, 0x78, 0x93,
+    0xF5, 0xEC, 0x5C, 0x4F, 0x92, 0x96, 0xB6, 0x0F, 0x21, 0xB0, 0x32, 0x0F, 0x48, 0x7E, 0xCA, 0x30,
+    0x32, 0x12, 0x96, 0xA1, 0xD1, 0x69, 0x50, 0x7A, 0x0D, 0x91, 0x69, 0x43, 0x4D, 0xCC, 0x4F, 0xD2,
+    0x7D, 0xB0, 0x21, 0xF1, 0x1E, 0x05, 0xA5, 0x30, 0x6E, 0xF5, 0xED, 0x5A, 0xF2, 0xD0, 0xC7, 0x86,
+    0xC8, 0xA5, 0x97, 0xE3, 0x7B, 0xAF, 0x5A, 0xC0, 0xB7, 0xDA, 0xB4, 0x12, 0xD4, 0xA9, 0x27, 0xCD,
+    0x00, 0xCB, 0xEC, 0x84, 0x55, 0x50, 0x72, 0x8B, 0xE9, 0x4B, 0x95, 0xBE, 0xA5, 0x41, 0x5D, 0x8C,
+    0x53, 0xFA, 0x1A, 0xA7, 0x32, 0x2B, 0x30, 0xD9, 0x2B, 0x05, 0x06, 0x0D, 0xFB, 0xE9, 0xE7, 0xB4,
+    0xB4, 0x2B, 0xCD, 0xE5, 0xBF, 0x69, 0x85, 0xB9, 0xA4, 0x1B, 0x37, 0xB6, 0x78, 0xBF, 0xC2, 0x27,
+    0xF0, 0x1F, 0xD4, 0xBC, 0xDA, 0xEA, 0x54, 0x9B, 0x09, 0xE3, 0x68, 0x83, 0xD2, 0xAF, 0xB5, 0x69,
+    0x08, 0xDB, 0x32, 0xAD, 0x53, 0xFD, 0x2D, 0xDB, 0xCC, 0x49, 0x1C, 0x63, 0x89, 0x68, 0xF8, 0xBB,
+    0x5D, 0xB0, 0x2A, 0xF4, 0x6D, 0x4B, 0xFB, 0x56, 0x17, 0x61, 0xA9, 0xCD, 0x42, 0x70, 0xF9, 0xB5,
+    0xE0, 0xD1, 0xBF, 0x95, 0x34, 0xB6, 0x60, 0x47, 0x66, 0x44, 0x40, 0x76, 0x58, 0xC9, 0x3B, 0x21,
+    0x2E, 0x20, 0x07, 0x7B, 0xBA, 0x96, 0x32, 0xA5, 0xE8, 0xFD, 0x9E, 0xEC, 0x23, 0xE1, 0x6D, 0x22,
+    0x73, 0xBF, 0xE1, 0x95, 0x84, 0xB3, 0x2D, 0x94, 0xAE, 0x3E, 0xA2, 0x0D, 0xFD, 0xD0, 0x20, 0xF8,
+    0x83, 0xE0, 0x5B, 0x2A, 0x62, 0x51, 0xA4, 0x43, 0x9A, 0x25, 0x16, 0x10, 0x3E, 0x2B, 0x7C, 0xEC,
+    0x39, 0x31, 0xC2, 0xE0, 0xAD, 0xF9, 0x7E, 0x07, 0xF8, 0x01, 0x5F, 0xA8, 0x22, 0xA8, 0x32, 0x34,
+    0xAA, 0x88, 0x08, 0x23, 0x55, 0xCF, 0x6A, 0x64, 0x2D, 0xA9, 0x9F, 0x20, 0x77, 0x8D, 0x7A, 0xB5,
+    0xCF, 0x6F, 0xF1, 0x5E, 0x81, 0x96, 0x43, 0xF5, 0x79, 0x81, 0x03, 0x36, 0xFB, 0xCB, 0x42, 0x06,
+    0x11, 0x5B, 0x1A, 0xF3, 0xBE, 0x80, 0xBD, 0xC6, 0x4B, 0x13, 0x8C, 0xC9, 0x37, 0x1F, 0xE6, 0x80,
+    0x92, 0xDA, 0xA5, 0x1B, 0xFA, 0x5C, 0xCF, 0x12, 0xF4, 0x21, 0x27, 0x21, 0x49, 0x06, 0x0D, 0xC1,
+    0x93, 0x6C, 0x30, 0xAD, 0x54, 0x4E, 0xFA, 0xFE, 0x49, 0xA9, 0x24, 0x50, 0x21, 0x2B, 0xCA, 0xB9,
+    0x28, 0xC7, 0x02, 0x59, 0x49, 0x05, 0x48, 0x99, 0x48, 0x6D, 0x50, 0x39, 0x17, 0x25, 0x8F, 0xC5,
+    0xDF, 0x39, 0x03, 0xBD, 0xE6, 0x12, 0x38, 0x49, 0x4F, 0x5F, 0xD5, 0xC3, 0x10, 0xEA, 0x7B, 0x28,
+    0x7B, 0xD7, 0x1C, 0x1C, 0x08, 0x5F, 0x2F, 0x1F, 0x0B, 0x18, 0x83, 0x68, 0x69, 0x79, 0x92, 0x61,
+    0x9B, 0xF3, 0x94, 0x92, 0x3F, 0x99, 0x38, 0x64, 0x2A, 0xB9, 0x59, 0xC9, 0x87, 0xF1, 0xEA, 0xA1,
+    0x08, 0x0D, 0x8D, 0x59, 0x81, 0x68, 0xF2, 0x14, 0xEE, 0x98, 0x08, 0x9A, 0xCD, 0xE8, 0x85, 0x94,
+    0xDE, 0x78, 0xEB, 0x4E, 0x06, 0xB2, 0x67, 0xB8, 0x2A, 0x09, 0xFE, 0xEB, 0xF3, 0xC1, 0x3F, 0xBE,
+    0xA4, 0x60, 0xE2, 0x5E, 0xCB, 0x30, 0x78, 0x3B, 0x9B, 0x25, 0x57, 0x9F, 0x38, 0xA7, 0x88, 0x2E,
+    0x26, 0x50, 0x38, 0x2D, 0x98, 0xC0, 0x7C, 0x93, 0xC0, 0x6E, 0x9B, 0x40, 0xEF, 0xE7, 0xBA, 0x4F,
+    0xCD, 0x84, 0x05, 0x98, 0x65, 0xF0, 0xCF, 0xB6, 0xAF, 0x74, 0x95, 0x3B, 0x77, 0xF6, 0x81, 0xAF,
+    0xBD, 0x45, 0xBF, 0x1E, 0xFA, 0x3B, 0xEE, 0x9D, 0x7C, 0x39, 0x2E, 0xA4, 0x30, 0xFC, 0x7E, 0xE6,
+    0x08, 0x37, 0x95, 0x4E, 0xFB, 0x6E, 0xBA, 0x7E, 0x61, 0xB9, 0xBB, 0x61, 0x89, 0x66, 0xB3, 0xFB,
+    0xFF, 0xE2, 0xC6, 0x0B, 0x59, 0xD6, 0xB2, 0x48, 0x65, 0x4A, 0x66, 0xD9, 0x28, 0xD8, 0x70, 0x15,
+    0x58, 0x92, 0x6F, 0xBE, 0xDE, 0xC1, 0xD5, 0xCF, 0xDF, 0xBD, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14,
+    0xFE, 0xC6, 0xC3, 0x9D, 0xA5, 0x73, 0x31, 0x29, 0x2E, 0x52, 0xA8, 0xFC, 0x0F, 0xE2, 0x3F, 0x80,
+    0xD7, 0x16, 0x14, 0x14, 0x14, 0xB9, 0x02, 0x2B, 0x45, 0x8A, 0x6B, 0x11, 0x05, 0xF7, 0x07, 0xF6,
+    0x76, 0x8D, 0x10, 0x35, 0x57, 0x90, 0x8A, 0x22, 0x14, 0x91, 0x90, 0xB6, 0xA0, 0xA6, 0xF0, 0x9E,
+    0x1D, 0xAE, 0xA0, 0xC4, 0x21, 0x25, 0x05, 0x8E, 0x92, 0x34, 0xD7, 0xE0, 0x08, 0xA3, 0xF3, 0xDD,
+    0x79, 0x3D, 0x7C, 0x6F, 0x76, 0x4F, 0x17, 0x25, 0x48, 0x91, 0x00, 0xE1, 0xD5, 0x8C, 0xD7, 0x7E,
+    0xF3, 0xDE, 0x7C, 0xDF, 0x7B, 0xDF, 0x1B, 0x7F, 0x02, 0xF5, 0x6D, 0x04, 0x4C, 0x83, 0x0A, 0xA1,
+    0xD7, 0xC2, 0xAF, 0x0A, 0xA8, 0x76, 0xF3, 0x22, 0xF2, 0xAC, 0xB5, 0x55, 0x69, 0x6D, 0xFB, 0x77,
+    0x2B, 0x0E, 0xE5, 0xC5, 0x05, 0x5F, 0xAC, 0x00, 0x18, 0x0E, 0xBF, 0x02, 0xBC, 0x86, 0x7F, 0x3A,
+    0x8E, 0x29, 0xC7, 0x16, 0x0A, 0x20, 0xE6, 0x98, 0xBC, 0x6D, 0xCC, 0xA0, 0x8E, 0x93, 0xD3, 0x72,
+    0x34, 0xD6, 0x1E, 0xAB, 0xEF, 0x8F, 0x26, 0x74, 0x7E, 0x6D, 0xA8, 0x19, 0x10, 0x8C, 0x9B, 0x51,
+    0xBD, 0x39, 0xB6, 0xD2, 0x87, 0xF0, 0x1E, 0xE4, 0x88, 0x7B, 0xE8, 0xDF, 0xAE, 0x6F, 0x03, 0xF4,
+    0xAF, 0x15, 0x96, 0xF3, 0xCC, 0xFE, 0x62, 0xED, 0xE1, 0xF6, 0xF8, 0x41, 0x4D, 0x44, 0x80, 0xE6,
+    0xED, 0x10, 0x98, 0xD7, 0x0E, 0xFD, 0x74, 0x8D, 0xFD, 0xFA, 0xA6, 0xD2, 0x24, 0x07, 0xC2, 0xC6,
+    0xB4, 0x0C, 0xDE, 0x6B, 0x6E, 0xC9, 0x71, 0x59, 0x41, 0xD9, 0x3C, 0x26, 0xB9, 0xB3, 0xC6, 0x10,
+    0xD1, 0xB4, 0xD7, 0x3F, 0x55, 0xB8, 0x3D, 0x41, 0xDB, 0xC1, 0xDC, 0xC9, 0xE3, 0x08, 0xFE, 0x49,
+    0x63, 0x3E, 0xAC, 0x74, 0xD3, 0xEB, 0xBA, 0x47, 0x3B, 0x41, 0x17, 0xA1, 0x30, 0x79, 0xAC, 0xEB,
+    0x58, 0x37, 0x26, 0x1D, 0x42, 0xD0, 0x10, 0x06, 0x39, 0x0D, 0xFA, 0x59, 0x4D, 0x03, 0x96, 0xAD,
+    0x18, 0xC2, 0x5E, 0x0C, 0x7A, 0x40, 0xB2, 0xD7, 0xE1, 0x18, 0x66, 0x88, 0x61, 0x52, 0x6D, 0x21,
+    0x57, 0x90, 0xCB, 0x2C, 0x70, 0x89, 0xAA, 0x75, 0xAF, 0x06, 0x37, 0xCF, 0xDC, 0x7C, 0x13, 0x9F,
+    0x02, 0x3B, 0x79, 0x99, 0x22, 0xAA, 0xCB, 0x1C, 0x49, 0x5D, 0x56, 0x24, 0x55, 0x36, 0xB8, 0xAC,
+    0x97, 0x2D, 0xFE, 0xA8, 0x8B, 0xCE, 0xE3, 0xF4, 0x83, 0x7E, 0x52, 0x17, 0xEF, 0xF9, 0x27, 0x75,
+    0x11, 0x9B, 0x2F, 0xEA, 0x22, 0x34, 0xBA, 0x2E, 0xCC, 0x67, 0x9C, 0x82, 0x25, 0x27, 0x3D, 0xC8,
+    0xD4, 0x6B, 0x5B, 0xA8, 0x56, 0xA8, 0xBA, 0x04, 0xAD, 0x0B, 0x28, 0xF5, 0x03, 0x7A, 0xD9, 0x5B,
+    0x6A, 0x8A, 0xBD, 0x72, 0x2C, 0x47, 0xBF, 0x7E, 0xDB, 0xAF, 0x5C, 0xD9, 0x11, 0xBB, 0x48, 0xA9,
+    0x04, 0x93, 0xC3, 0xFB, 0x93, 0x51, 0xB4, 0x15, 0x0A, 0x1F, 0x63, 0x73, 0x19, 0xA1, 0x35, 0x17,
+    0x66, 0x4E, 0x3C, 0xB2, 0x4D, 0x41, 0x76, 0xFA, 0x19, 0xE5, 0x13, 0x4A, 0x39, 0x07, 0x93, 0x92,
+    0x75, 0x02, 0x44, 0x02, 0x84, 0x09, 0x82, 0x5F, 0x53, 0x7C, 0x91, 0x65, 0x1C, 0x8A, 0x32, 0xF7,
+    0x4F, 0x17, 0x25, 0x68, 0x8E, 0x05, 0xD8, 0x40, 0x0F, 0xD5, 0xB1, 0x24, 0xFA, 0xA9, 0x14, 0xEC,
+    0x67, 0xFA, 0x87, 0xA9, 0x97, 0xBF, 0x8B, 0x3E, 0xC8, 0xC3, 0x6F, 0x2A, 0x45, 0x9F, 0x2D, 0xB7,
+    0xED, 0xCE, 0x98, 0x46, 0xB6, 0x0F, 0x8E, 0xE6, 0x0C, 0xDE, 0x3A, 0x76, 0x11, 0xD4, 0x3D, 0x2A,
+    0xFC, 0xA5, 0xBD, 0x5F, 0x0C, 0x88, 0x0A, 0x04, 0xBF, 0x43, 0x5F, 0x56, 0x6A, 0xD5, 0x2B, 0x9B,
+    0xD8, 0xB3, 0x1F, 0x6D, 0xD3, 0x2A, 0xFA, 0xBD, 0xE3, 0x72, 0x41, 0x8D, 0xEB, 0x96, 0xAA, 0xF1,
+    0xB0, 0x87, 0x57, 0xAE, 0xFF, 0x81, 0x8B, 0xA4, 0xB2, 0x0F, 0x91, 0xF8, 0xD5, 0xF5, 0xDE, 0xFF,
+    0x94, 0x0B, 0x7C, 0x69, 0x6A, 0x16, 0x84, 0x6D, 0x0D, 0x5C, 0xAC, 0x32, 0x16, 0xA5, 0x98, 0xB8,
+    0xB2, 0x3B, 0x26, 0x91, 0x6E, 0x1C, 0x29, 0xA9, 0x7A, 0x50, 0x89, 0x81, 0x1A, 0xA5, 0xC1, 0x6B,
+    0xB5, 0x00, 0xEE, 0x09, 0xB9, 0xE3, 0x6E, 0x09, 0xFD, 0x12, 0x82, 0x27, 0x3C, 0x6B, 0xE9, 0x61,
+    0x4E, 0x17, 0xF4, 0xF0, 0x6B, 0xE9, 0x55, 0xE2, 0xA1, 0x07, 0xD9, 0x48, 0x28, 0xCA, 0x95, 0x7B,
+    0x30, 0x6D, 0x5C, 0x4D, 0x92, 0xEC, 0xF0, 0x4A, 0x95, 0x4D, 0xD0, 0xF3, 0xF9, 0x25, 0x65, 0x72,
+    0x1E, 0xD8, 0xC7, 0x4B, 0x3A, 0x0E, 0xB2, 0xD0, 0x54, 0x92, 0x82, 0x44, 0xFC, 0xB2, 0x55, 0xB6,
+    0x9F, 0xF3, 0xE8, 0xB1, 0x63, 0x78, 0xBE, 0x7F, 0xBA, 0x78, 0x38, 0x48, 0x86, 0x98, 0x9B, 0x41,
+    0x78, 0xAE, 0x09, 0x47, 0x0D, 0x54, 0xEF, 0x9D, 0x35, 0xEA, 0xC4, 0xDA, 0xC0, 0x5A, 0xCF, 0x36,
+    0x3E, 0xA1, 0xDD, 0xA0, 0x4C, 0xA1, 0xB0, 0xAB, 0x5A, 0x93, 0x26, 0xFB, 0x95, 0x26, 0xD7, 0x9B,
+    0xA9, 0xB0, 0x20, 0x6E, 0x6B, 0x57, 0x93, 0x2C, 0x73, 0xE5, 0x70, 0xA7, 0x14, 0x85, 0xBE, 0x79,
+    0xB0, 0x76, 0x20, 0x3E, 0x73, 0x3F, 0x7B, 0xC3, 0xC2, 0x07, 0xF1, 0xB1, 0xF6, 0x09, 0x03, 0x78,
+    0xF9, 0x0E, 0x6E, 0xB3, 0x76, 0xE7, 0x4B, 0xA6, 0x31, 0xE5, 0x39, 0xE1, 0x4A, 0x71, 0xF0, 0x9C,
+    0xC5, 0x6C, 0x82, 0xE7, 0x07, 0x9F, 0x33, 0x33, 0x89, 0xAB, 0x7C, 0x32, 0xCB, 0xEE, 0x9E, 0x11,
+    0xFD, 0x7C, 0xB1, 0xF8, 0x6E, 0x73, 0xE4, 0x10, 0x73, 0xC4, 0xF5, 0x23, 0x6E, 0x49, 0x22, 0x03,
+    0xDB, 0x5F, 0xB9, 0x23, 0x60, 0x1E, 0x9C, 0x12, 0xF4, 0x0B, 0xC5, 0x06, 0xE6, 0x3A, 0x57, 0x08,
+    0xB1, 0x26, 0x57, 0x5D, 0xE8, 0x1A, 0x50, 0x3F, 0xCD, 0xB2, 0x6C, 0xFF, 0x81, 0x64, 0x65, 0xCE,
+    0xA9, 0xEF, 0x37, 0x32, 0x33, 0x77, 0xE8, 0xB5, 0x8C, 0x36, 0xFA, 0x0C, 0xF3, 0x01, 0x6A, 0xE0,
+    0x46, 0x07, 0x94, 0xBE, 0x65, 0xC2, 0x4A, 0x42, 0x75, 0x1D, 0xB0, 0x6D, 0x8F, 0xB8, 0x77, 0x35,
+    0xC9, 0x4A, 0xC8, 0x0A, 0x04, 0xB5, 0x3B, 0x5B, 0x25, 0xEC, 0x9C, 0xB9, 0xBE, 0xBC, 0x58, 0x94,
+    0x53, 0x46, 0xAC, 0x71, 0x98, 0xC0, 0x3C, 0xEA, 0xBD, 0x4E, 0x90, 0x85, 0xF4, 0xDE, 0xBA, 0x6A,
+    0x02, 0xAA, 0x90, 0x9B, 0x4C, 0xA5, 0x09, 0x8E, 0x5E, 0xE9, 0x01, 0x2A, 0x51, 0x12, 0x3C, 0xC2,
+    0x7C, 0xBD, 0xED, 0x0E, 0xAE, 0x63, 0x99, 0x96, 0x57, 0xC7, 0x95, 0x27, 0x27, 0x97, 0x2F, 0x27,
+    0x80, 0xF9, 0x92, 0x0C, 0x66, 0x02, 0xFE, 0x9C, 0xC3, 0x3A, 0xF0, 0x5F, 0x91, 0x6D, 0x4C, 0xA2,
+    0x5E, 0x47, 0xA2, 0xE6, 0x11, 0x89, 0xCE, 0x98, 0x2C, 0xBF, 0xD5, 0xBD, 0x2A, 0x45, 0xAD, 0x2D,
+    0x3C, 0x2B, 0xAD, 0xB5, 0x2B, 0xE1, 0x6E, 0x20, 0x0E, 0x78, 0xC4, 0x16, 0xB8, 0xE5, 0x6D, 0xB2,
+    0xF7, 0xEF, 0x58, 0xAD, 0x69, 0xAD, 0x89, 0x6D, 0xA8, 0xBD, 0x4E, 0xCE, 0x19, 0x1A, 0xD1, 0xC3,
+    0x21, 0x43, 0xC7, 0x5C, 0x64, 0x2A, 0xCA, 0x22, 0xA2, 0xC8, 0x75, 0xAD, 0x7A, 0x16, 0xCA, 0xA4,
+    0x7C, 0x93, 0xD0, 0x24, 0xDF, 0x32, 0x74, 0x3E, 0x59, 0x2D, 0x5D, 0xC7, 0xB3, 0xF7, 0xDF, 0x17,
+    0xEE, 0xD6, 0x75, 0x8A, 0xCB, 0x10, 0x6B, 0x7A, 0xF7, 0xC5, 0x20, 0x6C, 0xF9, 0x49, 0x10, 0xC9,
+    0xAF, 0xDB, 0x9E, 0xDF, 0x04, 0x72, 0x6E, 0xF8, 0x1D, 0x68, 0x19, 0xC9, 0xA4, 0x41, 0xED, 0x75,
+    0x0C, 0x68, 0xAA, 0x30, 0xE7, 0x5E, 0x52, 0x52, 0x8A, 0x31, 0xFA, 0xA8, 0x16, 0x18, 0x09, 0xFE,
+    0xBB, 0xEB, 0x2F, 0xBD, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xE3, 0xE1, 0x70, 0xC0, 0xC5,
+    0x50, 0x10, 0x29, 0x12, 0x12, 0xA6, 0xA0, 0x21, 0x8D, 0xEB, 0x14, 0x6B, 0x4F, 0x48, 0x41, 0x9B,
+    0x82, 0x4B, 0x43, 0x91, 0x14, 0x14, 0x74, 0xFB, 0x07, 0xF6, 0xEE, 0x4C, 0x5A, 0x9A, 0xEB, 0xE9,
+    0x11, 0xDA, 0x86, 0x16, 0x24, 0x07, 0x0F, 0xDA, 0x22, 0x5D, 0x70, 0x44, 0x41, 0x89, 0x25, 0xAE,
+    0xDB, 0xC6, 0xC5, 0x44, 0x31, 0x92, 0xD7, 0xC3, 0xFB, 0xEC, 0xBD, 0xDC, 0x09, 0x72, 0x14, 0x09,
+    0x60, 0xC9, 0xF6, 0xB7, 0xE3, 0x99, 0xF7, 0xBD, 0x37, 0xDF, 0x37, 0x6F, 0x01, 0x0B, 0x5E, 0x79,
+    0xEC, 0x00, 0xDD, 0xAE, 0x18, 0xDE, 0x88, 0xA6, 0x91, 0xF3, 0xEB, 0x23, 0xBC, 0x8D, 0xE8, 0x61,
+    0x07, 0x8F, 0xC1, 0x94, 0xC6, 0x66, 0x38, 0x82, 0xD7, 0x4D, 0xD4, 0x19, 0xDB, 0xC3, 0x94, 0x3E,
+    0x03, 0x16, 0xE6, 0x93, 0x06, 0x51, 0x08, 0x3D, 0x50, 0x84, 0xE0, 0x10, 0x3F, 0xF5, 0xC7, 0x40,
+    0x6F, 0x3E, 0xF6, 0x28, 0xE0, 0x8D, 0x8B, 0x1B, 0x63, 0x8F, 0x31, 0xC0, 0x47, 0x5D, 0x01, 0x63,
+    0xCD, 0xE3, 0x86, 0x60, 0xC7, 0x82, 0x9D, 0xEA, 0x06, 0x95, 0x29, 0x71, 0x7A, 0xE3, 0x3C, 0x9B,
+    0xAA, 0x83, 0x4D, 0x09, 0x72, 0x0B, 0x27, 0x24, 0x54, 0x70, 0xE4, 0x88, 0x83, 0x1E, 0x88, 0x9B,
+    0xE9, 0x67, 0xDC, 0x21, 0x8C, 0xD0, 0xCC, 0xA5, 0xEE, 0x8D, 0xFC, 0xFA, 0x88, 0xF7, 0x00, 0x44,
+    0x1D, 0x90, 0xCC, 0x0B, 0x54, 0x7F, 0x86, 0xE5, 0x26, 0x84, 0x5D, 0x1C, 0x42, 0x89, 0x03, 0x01,
+    0x7D, 0x07, 0xA4, 0xB9, 0x30, 0xEE, 0x00, 0xE5, 0x3E, 0xCD, 0xF2, 0x0F, 0xD4, 0xC1, 0xBF, 0x7F,
+    0xBB, 0x9E, 0x80, 0x05, 0xBF, 0x82, 0x7A, 0x84, 0xBA, 0x47, 0x46, 0x01, 0x82, 0x48, 0x56, 0x9A,
+    0xA0, 0xC3, 0x29, 0x76, 0x45, 0x18, 0x93, 0xB0, 0x83, 0xB2, 0x38, 0x09, 0xE1, 0x69, 0x08, 0xE1,
+    0xE1, 0x7A, 0xBD, 0xE3, 0x0C, 0x32, 0x92, 0xD7, 0x7E, 0xFE, 0xFC, 0x4A, 0x46, 0x4B, 0x88, 0x16,
+    0xD7, 0x97, 0xDD, 0x44, 0x76, 0x62, 0x95, 0xDA, 0x49, 0x46, 0xC4, 0x34, 0xE6, 0x89, 0x55, 0x04,
+    0x0C, 0xCD, 0x52, 0xB6, 0xEB, 0x2E, 0x70, 0x73, 0xBD, 0xBE, 0x13, 0xC2, 0x70, 0x73, 0xFD, 0x9D,
+    0xE5, 0xFE, 0x73, 0xDB, 0x26, 0x11, 0x44, 0x13, 0x49, 0x15, 0xD7, 0x9E, 0x71, 0x6B, 0x3D, 0xF1,
+    0xF8, 0x2D, 0x2B, 0xA7, 0x21, 0xD9, 0x8A, 0x9C, 0xD5, 0xE2, 0x6B, 0x31, 0x25, 0x50, 0xFD, 0x0F,
+    0xAA, 0x4E, 0x28, 0xF7, 0xBD, 0x70, 0x2A, 0x35, 0x68, 0x10, 0x93, 0x2F, 0xAE, 0x1F, 0xCE, 0x85,
+    0x94, 0x49, 0x1B, 0xAA, 0x1C, 0x18, 0x14, 0x0C, 0x12, 0x06, 0xEA, 0x39, 0x83, 0x7C, 0xB5, 0x40,
+    0xF2, 0x78, 0xD3, 0x28, 0xCF, 0x20, 0x8F, 0x37, 0x4D, 0xE2, 0x18, 0x78, 0x06, 0x39, 0x56, 0x8B,
+    0xD8, 0x31, 0xF0, 0x0C, 0x0A, 0xC4, 0x9B, 0x5F, 0x1D, 0x83, 0x9E, 0x41, 0x00, 0x56, 0x05, 0x6B,
+    0xBC, 0xE9, 0x25, 0x20, 0x19, 0xA7, 0x99, 0xEB, 0x24, 0x34, 0xEA, 0xF0, 0x53, 0x49, 0xF6, 0x05,
+    0xDE, 0xFC, 0xDA, 0x61, 0xAC, 0x50, 0x6C, 0x5D, 0xCC, 0xD7, 0xF3, 0xAD, 0xCB, 0xF2, 0x4A, 0x6F,
+    0xB6, 0xEE, 0xFB, 0xBC, 0x4A, 0xF5, 0x96, 0xD8, 0xD5, 0x4A, 0x6F, 0x7F, 0xB6, 0xF9, 0x8F, 0xAD,
+    0xDE, 0x0E, 0xC8, 0xEB, 0x52, 0x6F, 0x3B, 0xEA, 0x79, 0x03, 0xFB, 0x06, 0xCC, 0x45, 0x51, 0xF9,
+    0xE1, 0x45, 0x07, 0xFE, 0xC7, 0xFC, 0xE5, 0x00, 0xB0, 0xFD, 0x75, 0x5B, 0x5D, 0x6A, 0xFD, 0x57,
+    0x96, 0xA1, 0x64, 0x75, 0xE2, 0xFC, 0xFE, 0x11, 0xD9, 0x07, 0x97, 0x0F, 0x53, 0xC2, 0x52, 0x4A,
+    0x17, 0xD9, 0x68, 0xB4, 0xCB, 0x86, 0xFD, 0x11, 0x77, 0x46, 0xEA, 0x97, 0xB2, 0xB2, 0x43, 0x26,
+    0xDD, 0x2E, 0x2D, 0x9F, 0xB3, 0xBA, 0x28, 0x5E, 0xF6, 0x98, 0xBE, 0xCA, 0xBC, 0x63, 0xE9, 0xA9,
+    0x4A, 0xD6, 0x0E, 0x44, 0xD1, 0x5D, 0x34, 0x22, 0x6B, 0xD8, 0xD3, 0xC1, 0x32, 0x07, 0xA5, 0xE1,
+    0x5D, 0x49, 0xC7, 0x3D, 0x95, 0x03, 0x2A, 0xF7, 0x83, 0x6B, 0x17, 0x2C, 0x32, 0x2F, 0xC7, 0xD5,
+    0x26, 0xCF, 0x96, 0x4D, 0x5A, 0x6A, 0x1E, 0x4A, 0xE5, 0x89, 0x3E, 0xB0, 0x45, 0xAB, 0xCB, 0xB7,
+    0x8C, 0x31, 0x61, 0x9F, 0x5A, 0x9E, 0xF6, 0x26, 0x69, 0xB5, 0x1C, 0xA8, 0x9A, 0x8D, 0xA5, 0xEC,
+    0x2B, 0xC8, 0x61, 0xD3, 0x87, 0x30, 0x3F, 0xD6, 0xEB, 0x75, 0x7D, 0x85, 0x1C, 0xFC, 0x83, 0x9C,
+    0x73, 0xDA, 0x67, 0xF7, 0xF7, 0xB4, 0xF1, 0x82, 0x36, 0x39, 0x0C, 0x72, 0x4B, 0xCC, 0x2E, 0x19,
+    0xF2, 0xAB, 0x68, 0xFF, 0x7B, 0xE5, 0x79, 0x7D, 0x3D, 0xFB, 0xF2, 0x28, 0xCF, 0x65, 0x77, 0x5F,
+    0x52, 0x9E, 0xD7, 0xD1, 0x29, 0x56, 0xDA, 0x2D, 0x30, 0xB9, 0xEB, 0x5B, 0xAA, 0xC4, 0x85, 0xBF,
+    0x8E, 0x56, 0xD1, 0x1C, 0x91, 0xDF, 0x3E, 0xA1, 0x7F, 0xA8, 0x41, 0x5C, 0xD8, 0xCD, 0xDE, 0x34,
+    0x79, 0xB2, 0x70, 0xD6, 0x1D, 0xCD, 0x64, 0x20, 0x5E, 0xC0, 0xE1, 0xE1, 0xFD, 0x69, 0x60, 0xB6,
+    0x59, 0xB1, 0x1D, 0x64, 0x76, 0x5E, 0x92, 0xBA, 0xCF, 0xC1, 0x06, 0xA2, 0x97, 0x45, 0x92, 0x59,
+    0xCC, 0x8C, 0x82, 0x92, 0x2F, 0x3B, 0xDD, 0x1D, 0xE1, 0x83, 0x83, 0x17, 0x09, 0x4F, 0x45, 0xCC,
+    0xAD, 0xCF, 0xFC, 0xEC, 0xDF, 0xCD, 0x6C, 0x71, 0x04, 0x77, 0x21, 0xCC, 0x16, 0x57, 0x4C, 0x6E,
+    0x9B, 0xFC, 0x64, 0x4D, 0x1B, 0x42, 0x9B, 0xD2, 0xBE, 0xC4, 0x0B, 0xFE, 0x66, 0x63, 0x9C, 0xA9,
+    0x7F, 0xA7, 0x0B, 0x1E, 0x65, 0xC2, 0x92, 0x7F, 0x00, 0x9E, 0x46, 0x91, 0x91, 0x92, 0x6E, 0xE9,
+    0x95, 0x15, 0x31, 0x88, 0x52, 0xD1, 0xCB, 0x75, 0x4B, 0xC4, 0x6C, 0xCA, 0xC4, 0x35, 0xC9, 0x6F,
+    0x5C, 0x5E, 0x30, 0x53, 0x34, 0xEE, 0xE5, 0x29, 0x29, 0x80, 0x94, 0x2A, 0xE5, 0x14, 0x5A, 0x3E,
+    0x4D, 0x7B, 0x2E, 0x06, 0xB7, 0x7D, 0x84, 0x09, 0xC3, 0x79, 0xCA, 0x6F, 0x81, 0x6F, 0xD8, 0x03,
+    0xBF, 0xB4, 0xC8, 0x98, 0x8A, 0x1B, 0x1D, 0xD3, 0x58, 0x0A, 0xA6, 0xEA, 0x69, 0x32, 0x4E, 0xFE,
+    0xCD, 0x62, 0x36, 0x91, 0xF9, 0x8A, 0x34, 0xB8, 0x31, 0x0B, 0x2A, 0xAC, 0xD9, 0x2D, 0xBB, 0x79,
+    0xBF, 0x48, 0x66, 0x32, 0x7D, 0x86, 0x6C, 0x9F, 0x7B, 0x03, 0xC1, 0x1D, 0x92, 0x7E, 0x5F, 0xF7,
+    0x2B, 0xAC, 0xEE, 0x7F, 0xD0, 0xF8, 0x97, 0xEB, 0x4F, 0xAD, 0x55, 0x3D, 0x6C, 0xDD, 0x54, 0x14,
+    0xFE, 0x6C, 0xE7, 0xC5, 0x28, 0x16, 0xBA, 0x0C, 0xE9, 0x14, 0x21, 0x2F, 0x95, 0x80, 0x48, 0x89,
+    0x57, 0x84, 0x6A, 0xFB, 0x8A, 0x6E, 0x4C, 0x91, 0xE0, 0xED, 0x8C, 0x28, 0x4B, 0x16, 0x86, 0x0E,
+    0x79, 0x89, 0x69, 0x87, 0x0E, 0x1D, 0x88, 0x84, 0x80, 0xA1, 0x03, 0x41, 0x42, 0x42, 0xB8, 0x52,
+    0xCB, 0xC0, 0xF0, 0x84, 0xDC, 0xBC, 0xDB, 0x32, 0x32, 0xD4, 0x14, 0x75, 0xC6, 0xD0, 0x56, 0x95,
+    0xDA, 0x81, 0x5B, 0xC5, 0x48, 0x0F, 0x70, 0x72, 0xF9, 0xEE, 0xF5, 0x0B, 0x69, 0x4B, 0xA4, 0x76,
+    0xC0, 0x96, 0xAF, 0x7D, 0xEE, 0xB9, 0xE7, 0x9C, 0xEF, 0xFC, 0x1A, 0x12, 0x88, 0x54, 0x8B, 0x24,
+    0xA8, 0x71, 0x7A, 0x1E, 0xB3, 0x6B, 0xA1, 0xC0, 0xC2, 0x06, 0x30, 0xCA, 0xE0, 0xEB, 0x0A, 0xE2,
+    0xA3, 0x16, 0xA3, 0xA0, 0x09, 0x74, 0xA4, 0x44, 0x21, 0xE4, 0x26, 0x0F, 0x6B, 0x6C, 0x0A, 0x89,
+    0x69, 0x05, 0x7F, 0xBF, 0x41, 0xF0, 0x8B, 0x44, 0xD4, 0x01, 0x71, 0x0D, 0xE4, 0x94, 0x9E, 0x02,
+    0x21, 0x3F, 0x13, 0xC0, 0x9B, 0x62, 0xB0, 0xA1, 0x90, 0x90, 0x39, 0x29, 0xAC, 0xE2, 0xC5, 0x01,
+    0x20, 0x7E, 0xD0, 0x54, 0xBB, 0x09, 0xA4, 0x54, 0x21, 0xDE, 0xE6, 0x49, 0xF9, 0x8A, 0xB3, 0x1A,
+    0x29, 0x20, 0xCB, 0x28, 0x7C, 0x5B, 0x03, 0x9D, 0x28, 0x10, 0x4B, 0x1A, 0xD0, 0x41, 0x83, 0x8C,
+    0xCA, 0xC8, 0x9D, 0xF2, 0x8E, 0x54, 0x2C, 0x91, 0x05, 0x56, 0xC5, 0x88, 0xBA, 0x2E, 0x51, 0xE6,
+    0x7A, 0x0B, 0x04, 0x86, 0x0A, 0x92, 0x86, 0x0B, 0x6D, 0x21, 0xA6, 0x31, 0x1E, 0x81, 0x77, 0x40,
+    0xAD, 0x86, 0xC4, 0xC4, 0x72, 0xA4, 0x35, 0x32, 0x90, 0x6B, 0xC8, 0x85, 0xB2, 0x00, 0x04, 0x7D,
+    0xD6, 0x2B, 0xF0, 0x7A, 0xC6, 0x32, 0xF0, 0x46, 0x05, 0xAF, 0xA5, 0x89, 0x9B, 0x1A, 0x59, 0x58,
+    0x7B, 0xAD, 0x28, 0x22, 0x95, 0xD0, 0x78, 0xEA, 0x69, 0x54, 0x42, 0x79, 0x3A, 0x45, 0xF0, 0xAB,
+    0x46, 0x74, 0xAB, 0x80, 0xA0, 0xF1, 0x84, 0x16, 0xB6, 0x0B, 0x67, 0xD1, 0x1A, 0xA3, 0x37, 0xA8,
+    0xF8, 0x49, 0x53, 0xDB, 0xB4, 0x48, 0x84, 0x87, 0xB3, 0x70, 0x86, 0x2E, 0xC0, 0xCD, 0x13, 0x01,
+    0x8E, 0x0A, 0x44, 0x13, 0x46, 0x8B, 0xA2, 0x46, 0x13, 0xBC, 0x82, 0x30, 0xC7, 0xE4, 0xDF, 0x24,
+    0x19, 0xD3, 0x3C, 0xDF, 0x59, 0xEA, 0xB6, 0x8D, 0xD1, 0x89, 0xF9, 0x42, 0xF5, 0xA1, 0x3D, 0x32,
+    0xF5, 0x1F, 0x92, 0xB6, 0x57, 0x03, 0x15, 0x30, 0x26, 0x2F, 0x79, 0x72, 0x66, 0xE4, 0x75, 0xF8,
+    0x9F, 0xD7, 0xC8, 0x46, 0x08, 0x1E, 0xF4, 0xAF, 0xBB, 0x7C, 0xD1, 0x85, 0xBB, 0x74, 0x2F, 0xBE,
+    0x7F, 0xAD, 0x99, 0x98, 0x43, 0xAC, 0x7F, 0x42, 0xB8, 0x59, 0x8F, 0xFA, 0xE8, 0x95, 0x1B, 0xF3,
+    0xB1, 0x31, 0xFB, 0x0F, 0xCB, 0xAF, 0x18, 0xD8, 0xD4, 0x39, 0xC6, 0x48, 0xE1, 0x45, 0x88, 0xFB,
+    0x74, 0x40, 0x21, 0xD7, 0x2E, 0x12, 0x89, 0x4B, 0xA9, 0xDF, 0x13, 0xA7, 0x80, 0xF5, 0xF2, 0x8A,
+    0x31, 0x7B, 0xE5, 0x65, 0x45, 0x3A, 0x3A, 0x79, 0x99, 0xD4, 0xD1, 0x81, 0x55, 0x99, 0xFE, 0xBB,
+    0x2C, 0x32, 0x8B, 0x7D, 0x71, 0xB4, 0xB3, 0xC5, 0x97, 0xEF, 0xE3, 0xF8, 0x4A, 0x6D, 0xDE, 0x5F,
+    0x60, 0xC9, 0xCB, 0x1D, 0x2E, 0xF4, 0x38, 0xC9, 0x4A, 0xA3, 0xB8, 0x17, 0x35, 0x5C, 0x02, 0xCD,
+    0xC5, 0x7F, 0x7A, 0x71, 0x7B, 0xE4, 0x66, 0xC3, 0x6D, 0x45, 0x09, 0x63, 0xC5, 0xEE, 0xD1, 0x99,
+    0x39, 0xD8, 0xF8, 0xB0, 0x6E, 0xB3, 0x50, 0xC1, 0x2B, 0x4E, 0x1F, 0x63, 0xF8, 0x80, 0xA0, 0x2E,
+    0xDB, 0xE2, 0xB5, 0xE9, 0x7F, 0xF4, 0xD4, 0xC7, 0xC4, 0xEC, 0x04, 0x8F, 0x8C, 0x51, 0x59, 0xE5,
+    0x4D, 0xB8, 0xE3, 0xB7, 0x64, 0x89, 0xB3, 0x64, 0xD9, 0x8F, 0x84, 0x1F, 0x4B, 0x9A, 0x67, 0x3A,
+    0x9E, 0xF9, 0x93, 0x55, 0x6D, 0xCC, 0x54, 0x30, 0xDF, 0x59, 0x59, 0x4A, 0x5B, 0xD3, 0x75, 0x5F,
+    0x54, 0x16, 0xFF, 0x8C, 0xDC, 0xF8, 0x74, 0x2D, 0x34, 0xA6, 0x8E, 0x8D, 0x91, 0x27, 0x70, 0x2D,
+    0x99, 0xF1, 0x61, 0xC5, 0x07, 0xB6, 0xF6, 0xC6, 0xC4, 0xD5, 0xB8, 0x62, 0x1B, 0xEC, 0xB1, 0x29,
+    0x98, 0x88, 0x55, 0xEE, 0xCE, 0x97, 0xA5, 0x4F, 0x44, 0x7B, 0xE5, 0xEE, 0x93, 0x09, 0xE2, 0x56,
+    0x41, 0xD3, 0xFE, 0xB3, 0xA9, 0x9B, 0xD4, 0x48, 0x8E, 0xF3, 0xAB, 0xF0, 0x9A, 0x86, 0x98, 0xC2,
+    0xBF, 0xE7, 0xCA, 0x25, 0xF6, 0x5B, 0x86, 0x84, 0xE5, 0xD7, 0x61, 0x8B, 0xDD, 0xEA, 0x7A, 0x55,
+    0x28, 0xCA, 0x8F, 0xD8, 0xA4, 0x76, 0x34, 0x40, 0xD8, 0x76, 0xDC, 0x26, 0xA6, 0x80, 0x4A, 0x6C,
+    0x6D, 0x20, 0xDE, 0x22, 0xF1, 0x9B, 0x35, 0x43, 0xB9, 0x58, 0xB2, 0x2C, 0x1B, 0xDA, 0x61, 0x54,
+    0x0A, 0xCA, 0xEC, 0xBD, 0x6B, 0xBB, 0xA1, 0xEA, 0xC1, 0x5A, 0x14, 0x0E, 0x83, 0x83, 0xBD, 0x44,
+    0x6D, 0x61, 0xE7, 0x88, 0x65, 0x78, 0xBB, 0xB1, 0xB4, 0xF3, 0x28, 0x62, 0xC9, 0xC7, 0xD2, 0x9B,
+    0x12, 0x4B, 0x45, 0x5E, 0x4E, 0x23, 0xA2, 0xE9, 0x1F, 0xFB, 0xCD, 0x3D, 0xCB, 0xB3, 0x67, 0xEC,
+    0x59, 0xCA, 0x1C, 0x66, 0xF0, 0x0E, 0x67, 0x1A, 0xED, 0x43, 0xC1, 0xC1, 0x75, 0xB8, 0xF1, 0x35,
+    0xDF, 0x58, 0x8F, 0xA2, 0x9A, 0x48, 0x3A, 0x7A, 0x11, 0x17, 0x61, 0xED, 0x1C, 0xCA, 0x09, 0x21,
+    0xFC, 0xC9, 0x6A, 0xE3, 0x60, 0x8B, 0x59, 0x9E, 0x86, 0xD1, 0xE7, 0x53, 0xBB, 0x3A, 0x4F, 0xB6,
+    0xFA, 0x29, 0x24, 0x54, 0xC7, 0xA9, 0x47, 0x0B, 0xF4, 0x86, 0x02, 0x99, 0xD7, 0x22, 0xAA, 0xA9,
+    0xB5, 0xB3, 0xCE, 0x14, 0x16, 0xF1, 0xC8, 0x85, 0xA6, 0x42, 0xC7, 0xD1, 0x42, 0x50, 0xFE, 0xBE,
+    0x75, 0x55, 0x32, 0x9D, 0x1D, 0xD3, 0xA9, 0x41, 0x7D, 0xD1, 0x2D, 0x85, 0x2D, 0x51, 0x58, 0xB8,
+    0x09, 0x12, 0x6A, 0xC8, 0x39, 0x04, 0xA9, 0xDF, 0x2B, 0xD0, 0xAC, 0x8F, 0xBF, 0x1F, 0xEF, 0x36,
+    0x5F, 0x16, 0xBB, 0x78, 0xFE, 0x6D, 0x7B, 0x24, 0xC2, 0xEA, 0x37, 0xAB, 0x57, 0xA3, 0x05, 0xFF,
+    0x1D, 0x2C, 0x3C, 0xFF, 0x36, 0x9D, 0xE9, 0x86, 0xEF, 0xF5, 0xEB, 0x7A, 0x59, 0x7E, 0x4D, 0xF7,
+    0x1E, 0x96, 0xAC, 0x42, 0xBE, 0x39, 0x80, 0xEE, 0x0C, 0x87, 0x6B, 0xE6, 0xC9, 0xEB, 0x8F, 0xA1,
+    0xBB, 0xE4, 0x89, 0x9B, 0x4C, 0xAF, 0x4A, 0xCF, 0x04, 0x3F, 0xFF, 0x0F, 0x4B, 0xDF, 0x5E, 0x0C,
+    0x78, 0xB7, 0x5C, 0x96, 0xF6, 0x07, 0x72, 0x6A, 0x38, 0x3C, 0x4B, 0x8A, 0x2F, 0x19, 0x9E, 0xAF,
+    0x75, 0x95, 0x8B, 0x4B, 0xF5, 0x9A, 0xB8, 0x78, 0x5B, 0x77, 0xA9, 0x08, 0x0B, 0x26, 0x99, 0xBF,
+    0x8D, 0x36, 0xF6, 0x9B, 0x33, 0x9E, 0x1C, 0xC5, 0x17, 0x9A, 0x2A, 0x0E, 0xEA, 0x73, 0x73, 0x61,
+    0xA1, 0x57, 0x42, 0xA5, 0x33, 0x4E, 0x8F, 0x3C, 0x52, 0xD3, 0x9C, 0x79, 0x19, 0x78, 0x52, 0x9C,
+    0xD7, 0x23, 0x71, 0x53, 0x67, 0xE2, 0x86, 0x4E, 0x23, 0xA5, 0x53, 0x9E, 0x9A, 0xF3, 0x10, 0xDD,
+    0x68, 0xF3, 0xB0, 0x9E, 0x26, 0x7C, 0x28, 0x3B, 0x8E, 0x03, 0x35, 0x1E, 0x40, 0x8E, 0xF8, 0x0B,
+    0xCC, 0x83, 0xA6, 0x22, 0x97, 0xBB, 0x69, 0x54, 0x9C, 0x13, 0x90, 0x8B, 0x16, 0x1B, 0x13, 0x64,
+    0x67, 0x26, 0xAB, 0x63, 0x85, 0x55, 0x04, 0xFF, 0xB3, 0x3B, 0xBB, 0xC4, 0xF7, 0xD6, 0xD5, 0x2B,
+    0x08, 0x99, 0x05, 0x96, 0xFB, 0xB7, 0x3D, 0x87, 0xED, 0xC0, 0x06, 0xFD, 0xAE, 0x6F, 0xA4, 0x5E,
+    0x66, 0xEA, 0xAA, 0xCF, 0x12, 0xDA, 0xB9, 0xC9, 0x76, 0xB0, 0xDB, 0x63, 0x27, 0x10, 0xDA, 0xC2,
+    0x78, 0x4C, 0x55, 0x78, 0xD5, 0x49, 0x5B, 0x4E, 0xE7, 0x04, 0xD8, 0xCD, 0x54, 0xB5, 0xF6, 0xE1,
+    0x22, 0x13, 0x13, 0xFF, 0x7E, 0x4D, 0x79, 0xBD, 0xDE, 0xD5, 0x23, 0x55, 0x1E, 0x26, 0x17, 0xCD,
+    0xC6, 0xE1, 0xE4, 0x2F, 0xF3, 0xC0, 0x84, 0xC4, 0xF5, 0xB2, 0x95, 0x35, 0x45, 0x7E, 0x20, 0xCC,
+    0x05, 0x23, 0x0F, 0xF0, 0xA6, 0xFB, 0x0F, 0xC7, 0x3F, 0x3E, 0xEE, 0xEC, 0x40, 0xFB, 0x07, 0x95,
+    0x55, 0xBD, 0x6F, 0x1C, 0x45, 0x14, 0xFF, 0xCD, 0x4E, 0xC8, 0x00, 0xAB, 0x78, 0x5C, 0x38, 0x52,
+    0x44, 0x12, 0x6F, 0xE3, 0x22, 0x32, 0xB9, 0x3D, 0x0A, 0x0A, 0x17, 0xB7, 0xB7, 0x0B, 0x29, 0x28,
+    0x28, 0x6C, 0x21, 0x52, 0x51, 0xC4, 0x35, 0x15, 0x05, 0x85, 0x8B, 0x3D, 0xDF, 0x26, 0x57, 0xD0,
+    0xBA, 0xA3, 0x24, 0x74, 0x86, 0x02, 0xB9, 0x48, 0x71, 0x42, 0x3E, 0x7B, 0x9C, 0x14, 0x2E, 0x68,
+    0xD6, 0xF2, 0x1F, 0xC0, 0x40, 0x52, 0x11, 0x09, 0x8F, 0xA3, 0x45, 0xDA, 0x90, 0xBD, 0x1B, 0xDE,
+    0xEC, 0x6E, 0x70, 0xF8, 0x90, 0x30, 0x33, 0x5E, 0xBF, 0xD1, 0xBC, 0xF7, 0xE6, 0xBD, 0xF7, 0x7B,
+    0x1F, 0xB7, 0x80, 0xA5, 0x3D, 0x4C, 0x67, 0x98, 0x4D, 0x30, 0x5D, 0xC0, 0xFC, 0x02, 0x96, 0xF0,
+    0x51, 0xC9, 0x8D, 0xB0, 0x3A, 0xC8, 0xBB, 0x27, 0x49, 0x8C, 0x4D, 0xBA, 0xC5, 0xDA, 0xC2, 0xDE,
+    0x6C, 0xB2, 0xF0, 0xE9, 0xF6, 0xF7, 0xDB, 0xF7, 0x71, 0xBE, 0xBD, 0xFC, 0xCD, 0xF2, 0x77, 0x78,
+    0xF3, 0x9C, 0x1B, 0xC3, 0xE9, 0xD9, 0xF6, 0xB2, 0xFF, 0xDE, 0x4E, 0xE3, 0x33, 0x34, 0xFB, 0xFC,
+    0x1A, 0xB8, 0xD4, 0xEC, 0xF3, 0x6A, 0x34, 0xCB, 0x2F, 0xC1, 0x34, 0xD1, 0x60, 0x1F, 0x3C, 0x27,
+    0x1A, 0xC9, 0xC4, 0x77, 0xCC, 0x54, 0x64, 0xD2, 0xF1, 0x37, 0xB8, 0x0A, 0x1D, 0x1D, 0x73, 0xD5,
+    0x6B, 0xE9, 0xB8, 0xA1, 0x07, 0xA6, 0xE1, 0x3F, 0x3A, 0x1A, 0xE3, 0xEA, 0x56, 0x4F, 0x7C, 0x71,
+    0x68, 0x93, 0x61, 0x11, 0xC9, 0xD5, 0xD5, 0x0F, 0x54, 0x91, 0x06, 0x36, 0x5C, 0xE4, 0x47, 0xA6,
+    0x23, 0xCA, 0x5E, 0x87, 0xFD, 0xAC, 0x17, 0x49, 0x23, 0x62, 0xCF, 0xF2, 0x00, 0x30, 0x8E, 0x4A,
+    0x78, 0xBA, 0xA1, 0x42, 0x39, 0x7E, 0x00, 0x99, 0x84, 0xDE, 0x4F, 0x3A, 0x04, 0x9D, 0xB8, 0x32,
+    0x11, 0x22, 0xC8, 0x13, 0xB5, 0x57, 0x61, 0x0C, 0x6E, 0xD1, 0xAD, 0x6D, 0xCD, 0x83, 0xE1, 0x95,
+    0xD5, 0xD5, 0xE0, 0xAA, 0x3E, 0x79, 0xD6, 0x90, 0x7C, 0xBD, 0xE4, 0x2D, 0xCD, 0x4C, 0x73, 0x4C,
+    0x85, 0x92, 0x49, 0xC3, 0xD7, 0x12, 0x69, 0x1B, 0x6F, 0xD6, 0x6B, 0x95, 0x10, 0xC2, 0x84, 0xED,
+    0x53, 0x14, 0x55, 0xAB, 0x44, 0xA2, 0xFE, 0xBD, 0x27, 0x58, 0xCE, 0xD8, 0x58, 0xA8, 0xB4, 0x17,
+    0x57, 0xDC, 0xAA, 0x6E, 0x25, 0x47, 0xC7, 0xC7, 0xA7, 0x45, 0xF7, 0xCE, 0xDD, 0x62, 0x37, 0xB0,
+    0x81, 0x64, 0xA6, 0x90, 0x32, 0x2B, 0x02, 0x5D, 0xA4, 0xFC, 0x91, 0x8A, 0x22, 0x4F, 0x43, 0x3C,
+    0xD4, 0xF2, 0x0E, 0x0A, 0x43, 0xE0, 0xF5, 0xFC, 0x2C, 0x4A, 0xF9, 0x63, 0xC2, 0xCD, 0xA3, 0x78,
+    0x7E, 0x33, 0x72, 0x95, 0x82, 0x20, 0x07, 0x9C, 0x68, 0x8F, 0x44, 0xC7, 0xCC, 0x04, 0x12, 0xF4,
+    0x44, 0xC2, 0x15, 0xCF, 0xC7, 0xA1, 0xFF, 0xD0, 0xA4, 0xE8, 0x40, 0x9C, 0xA8, 0xE1, 0x84, 0xBF,
+    0x70, 0xEE, 0xFB, 0x53, 0x0C, 0xB5, 0x98, 0x39, 0x7F, 0x28, 0xE2, 0x05, 0x80, 0xC2, 0x30, 0x32,
+    0x4B, 0x39, 0xE1, 0x67, 0x44, 0x76, 0xC5, 0x81, 0xC8, 0xF5, 0xAE, 0x50, 0x46, 0xBE, 0xAF, 0x03,
+    0xCA, 0x8C, 0x9F, 0x6C, 0xCC, 0x61, 0xBD, 0xBE, 0x97, 0x49, 0xD9, 0xF5, 0x55, 0x2A, 0x79, 0x1E,
+    0xF9, 0xF7, 0x1C, 0xD3, 0x48, 0x2F, 0x7F, 0x20, 0x32, 0xDD, 0x63, 0x19, 0x49, 0xA4, 0x28, 0x99,
+    0xF1, 0x34, 0x57, 0x2E, 0xBF, 0x6F, 0xA4, 0x21, 0xFA, 0x32, 0x09, 0x7C, 0xE5, 0x8F, 0x72, 0x4A,
+    0x28, 0xD3, 0x0F, 0x60, 0x7A, 0x58, 0xBA, 0x92, 0x86, 0x32, 0x91, 0xA3, 0x23, 0xC3, 0xCC, 0x6E,
+    0x1F, 0xA1, 0xBC, 0xA5, 0x88, 0x39, 0xC6, 0x46, 0x47, 0x52, 0x72, 0x0E, 0x34, 0xB6, 0xD6, 0x6F,
+    0x50, 0x32, 0x40, 0x05, 0x31, 0x01, 0x4E, 0xE0, 0x1D, 0x26, 0x7C, 0xA4, 0x7C, 0x96, 0xCF, 0xC1,
+    0xDC, 0xC4, 0xE7, 0x2B, 0xC4, 0x98, 0xE7, 0x3A, 0xF6, 0x4C, 0xF0, 0x5E, 0xE1, 0x2B, 0xA9, 0x64,
+    0x16, 0x24, 0x41, 0xD2, 0xA1, 0x04, 0x7A, 0x86, 0x1B, 0xAE, 0x85, 0x16, 0xB9, 0x54, 0x95, 0xAF,
+    0x06, 0xDC, 0x15, 0x46, 0xBB, 0x12, 0x14, 0xB8, 0x10, 0x21, 0xC8, 0xF8, 0x51, 0xC1, 0x0A, 0x94,
+    0x22, 0x67, 0xE8, 0x23, 0x48, 0x20, 0x33, 0x0C, 0xC0, 0x35, 0xDC, 0x25, 0x20, 0xF2, 0xBE, 0x2B,
+    0xD7, 0xD5, 0x8C, 0x32, 0x3E, 0xD4, 0xFC, 0xA9, 0x66, 0x15, 0xE2, 0x01, 0xE2, 0x9C, 0x9F, 0x26,
+    0xF2, 0xAB, 0xE4, 0x02, 0x49, 0x0E, 0x48, 0xA0, 0x24, 0x69, 0x52, 0x17, 0xB9, 0x53, 0x0F, 0x12,
+    0x52, 0xA7, 0x47, 0x4A, 0xD0, 0xCB, 0xF4, 0x66, 0x26, 0x0E, 0x32, 0x56, 0x82, 0xF0, 0x7A, 0x8D,
+    0x44, 0x27, 0xFC, 0x59, 0x21, 0x7F, 0xC8, 0xE3, 0x20, 0xA9, 0x06, 0xDE, 0xA9, 0xF1, 0x0F, 0x55,
+    0x37, 0xC0, 0x6E, 0xCF, 0x33, 0x46, 0x8C, 0xD4, 0xA2, 0xC4, 0x46, 0x8F, 0x69, 0x77, 0xBC, 0xD4,
+    0xF8, 0xB9, 0xE6, 0x7D, 0xA8, 0xE3, 0x38, 0x9B, 0x4E, 0xB8, 0x59, 0x63, 0x4D, 0xF5, 0x15, 0xDC,
+    0xDA, 0xEC, 0xCB, 0xA3, 0x02, 0x45, 0x17, 0x54, 0x5E, 0x94, 0x5C, 0xAE, 0x52, 0x98, 0x3E, 0x7A,
+    0x31, 0x64, 0x0C, 0x4E, 0x99, 0xA4, 0xBF, 0x18, 0xCE, 0x17, 0x2F, 0x7F, 0xA5, 0x84, 0x5D, 0x54,
+    0x55, 0xCD, 0x69, 0x2B, 0x3B, 0xB6, 0x76, 0xE6, 0xBE, 0x9A, 0x49, 0xDF, 0x35, 0xC2, 0x98, 0x67,
+    0xE4, 0xBC, 0xA1, 0xEE, 0x4C, 0x21, 0x7F, 0xD9, 0x03, 0xAE, 0xCE, 0x9A, 0xAA, 0x06, 0xB3, 0x4F,
+    0xC0, 0x66, 0x9F, 0x18, 0x62, 0x08, 0x35, 0x07, 0xD7, 0x38, 0xC0, 0xCA, 0x3B, 0xC4, 0x68, 0xDB,
+    0x7B, 0xDD, 0x35, 0xC8, 0x75, 0x60, 0x87, 0xDE, 0xC0, 0x4D, 0x80, 0xCA, 0x34, 0xA1, 0xE4, 0x30,
+    0x02, 0xC5, 0x81, 0xE3, 0x55, 0x98, 0x7B, 0x17, 0x3B, 0x86, 0x1F, 0xE4, 0xD7, 0x79, 0x66, 0x7C,
+    0x91, 0xCC, 0xBD, 0xDA, 0x5F, 0x0E, 0xED, 0x7A, 0xF5, 0x5B, 0xDA, 0x76, 0x53, 0x33, 0x28, 0x88,
+    0x6C, 0xED, 0x74, 0x1B, 0x37, 0x66, 0xB6, 0x6E, 0xA9, 0xB7, 0xED, 0xEC, 0x7E, 0xD3, 0x64, 0x6D,
+    0x33, 0x89, 0x1F, 0x5B, 0x85, 0xC7, 0xBA, 0xA1, 0x66, 0xD0, 0x38, 0x5E, 0xCA, 0xA6, 0x07, 0x5F,
+    0x6F, 0x3C, 0x75, 0x86, 0x08, 0x9A, 0xBA, 0x87, 0x5D, 0xA6, 0x6A, 0x43, 0x45, 0x6B, 0x28, 0x22,
+    0xE7, 0x77, 0xDE, 0xC2, 0x8A, 0xCF, 0xBE, 0xB6, 0x7B, 0x56, 0x05, 0x2F, 0x4E, 0xAA, 0xA1, 0xB5,
+    0x5A, 0x58, 0x6B, 0x1B, 0x43, 0xFB, 0x64, 0xE8, 0x57, 0xE7, 0xA6, 0x21, 0x43, 0xA4, 0xD1, 0xA7,
+    0xC8, 0xCC, 0x2E, 0xCD, 0x07, 0x3F, 0xAF, 0x0D, 0x05, 0x59, 0x85, 0x6B, 0x34, 0xF1, 0x58, 0x7E,
+    0xE3, 0xCF, 0xD0, 0x6C, 0x65, 0xAB, 0xDB, 0x1F, 0xA3, 0xAE, 0x61, 0xEA, 0x4E, 0xB8, 0x99, 0xE1,
+    0xAC, 0xB9, 0xD9, 0xE7, 0xE6, 0x5E, 0xC7, 0xCD, 0x0F, 0xFA, 0x8C, 0x9B, 0x08, 0xA8, 0xE7, 0x8C,
+    0x73, 0x2A, 0x38, 0xD3, 0x40, 0xAB, 0x21, 0x5A, 0x8D, 0xB0, 0xD5, 0xD8, 0xFF, 0xDD, 0x3E, 0xCD,
+    0x42, 0x8C, 0x3D, 0xED, 0x9F, 0x91, 0x7F, 0xB9, 0xEC, 0xDE, 0xDE, 0x7F, 0xFE, 0xED, 0x56, 0x5C,
+    0xC5, 0xD3, 0xCB, 0x03, 0x44, 0x7F, 0xDB, 0x03, 0xF7, 0x53, 0xF1, 0x8F, 0xDB, 0xE8, 0xF2, 0x24,
+    0x9E, 0x2E, 0x6F, 0xB7, 0x83, 0xCA, 0x16, 0xCC, 0x96, 0x84, 0xC2, 0xC8, 0x5A, 0x55, 0x88, 0xE2,
+    0xF9, 0xC5, 0xB2, 0xCE, 0x14, 0xA5, 0xC4, 0x57, 0x54, 0x0F, 0x84, 0x41, 0x1D, 0x15, 0xDD, 0xEE,
+    0xBA, 0xDA, 0x77, 0xBC, 0xCD, 0xBA, 0xD4, 0xA8, 0x84, 0x86, 0xF5, 0xFF, 0xCD, 0x97, 0xF7, 0x61,
+    0x1D, 0x99, 0xAC, 0xC3, 0xA7, 0x50, 0xFF, 0x52, 0xA2, 0xA8, 0x9B, 0xE4, 0x22, 0x05, 0x4A, 0xF0,
+    0x1A, 0x57, 0x33, 0x6C, 0x5A, 0x3F, 0x10, 0xD7, 0x8C, 0x97, 0x13, 0x79, 0x7F, 0x8A, 0xC9, 0xD0,
+    0x96, 0xFE, 0x71, 0x1E, 0xE4, 0x34, 0x14, 0xFA, 0x7E, 0x4E, 0x0E, 0x10, 0x1E, 0x5D, 0xF2, 0x84,
+    0x6B, 0x3A, 0x0C, 0x84, 0xCB, 0x44, 0x0A, 0x9F, 0x66, 0x8F, 0x57, 0x12, 0x8A, 0xD4, 0xD3, 0xCA,
+    0x4D, 0x4B, 0x02, 0xD2, 0xB5, 0x0C, 0x56, 0xCE, 0x0C, 0xAE, 0x81, 0x25, 0x81, 0xC2, 0x94, 0x8C,
+    0x49, 0x4D, 0x87, 0x49, 0x7D, 0x83, 0xFF, 0xBF, 0xFE, 0x00, 0xAD, 0x55, 0xBF, 0x6F, 0x1C, 0x55,
+    0x10, 0xFE, 0xF6, 0xBD, 0xE3, 0x56, 0xCA, 0x8A, 0xAC, 0x8B, 0x2B, 0x1C, 0x01, 0xDE, 0xC6, 0x45,
+    0x84, 0x2E, 0x77, 0x94, 0x2E, 0xEE, 0x6E, 0x17, 0x22, 0x41, 0x9B, 0x82, 0x54, 0x28, 0x12, 0xB5,
+    0x91, 0x10, 0x48, 0x87, 0xE4, 0x48, 0xE7, 0xDB, 0x07, 0xFE, 0x03, 0x70, 0x4F, 0x13, 0x09, 0x0A,
+    0xB2, 0x14, 0x6E, 0x52, 0x44, 0x4A, 0xEE, 0x6E, 0x2D, 0x0B, 0x5D, 0x99, 0x25, 0x8D, 0x0B, 0x0A,
+    0x56, 0x18, 0x81, 0x08, 0x05, 0x2F, 0xD2, 0x82, 0xD6, 0xD6, 0xDE, 0x3E, 0x66, 0xF6, 0x9C, 0xC4,
+    0x89, 0x6C, 0xE7, 0x40, 0xCC, 0x6A, 0xF6, 0x8D, 0xDE, 0x9B, 0x1F, 0x3B, 0xF3, 0xBE, 0x99, 0x05,
+    0x00, 0x27, 0xF1, 0x4C, 0x30, 0x72, 0x8D, 0x71, 0x92, 0xC3, 0x7A, 0xBE, 0x49, 0x1B, 0xD3, 0x04,
+    0x18, 0x0C, 0x00, 0x7B, 0x1A, 0x03, 0xF7, 0x49, 0xF0, 0xB6, 0x62, 0xD8, 0xBA, 0x03, 0xAB, 0x90,
+    0x31, 0x86, 0xE8, 0xC0, 0x55, 0x32, 0xB6, 0x34, 0x09, 0x57, 0x20, 0x63, 0x41, 0xEA, 0x4F, 0xA8,
+    0x81, 0x65, 0x38, 0xA9, 0xD4, 0x28, 0x11, 0x92, 0x67, 0x12, 0x1A, 0xA8, 0x01, 0x51, 0x14, 0x7D,
+    0x6D, 0x8C, 0xF9, 0xFE, 0xFA, 0xF5, 0x21, 0x40, 0x86, 0x70, 0x03, 0xF2, 0x4C, 0x11, 0xC8, 0xB4,
+    0x07, 0x88, 0xE3, 0x9D, 0xE2, 0xB9, 0x1D, 0x6F, 0xBE, 0xC3, 0x14, 0x9A, 0x32, 0xB8, 0x19, 0x9A,
+    0xA4, 0xDF, 0x36, 0x9A, 0x38, 0x27, 0x2E, 0xCE, 0x60, 0x3E, 0xCB, 0x88, 0x53, 0x62, 0xD5, 0x6F,
+    0x5E, 0x43, 0xBF, 0x89, 0x85, 0x78, 0x75, 0x99, 0x02, 0xAD, 0x47, 0xDF, 0x4A, 0x63, 0x0A, 0xD7,
+    0x1C, 0x0E, 0xC8, 0x4D, 0xD3, 0x27, 0x0E, 0x4F, 0x61, 0xFF, 0x98, 0x3D, 0x62, 0x87, 0xF4, 0x31,
+    0x31, 0xC5, 0x7A, 0xF4, 0x0D, 0x7D, 0xA7, 0x51, 0xF4, 0x9D, 0x69, 0x9F, 0x0E, 0x89, 0x73, 0xE2,
+    0xE2, 0x0C, 0xE6, 0x73, 0x4D, 0xFA, 0x71, 0x68, 0x0E, 0xAB, 0x1C, 0xAD, 0x8C, 0x52, 0xA6, 0x95,
+    0x6B, 0x01, 0x7B, 0x5B, 0x7F, 0x3C, 0xF9, 0xD3, 0xFC, 0x3A, 0x31, 0xBF, 0xC3, 0x8F, 0xE1, 0x8C,
+    0x61, 0x3D, 0xCE, 0xE0, 0xBB, 0xB1, 0x93, 0x0C, 0xB1, 0x2C, 0x02, 0xAA, 0xD3, 0xC4, 0xD1, 0x5D,
+    0x9C, 0x20, 0x2B, 0xE8, 0x49, 0xDD, 0x46, 0xE6, 0x06, 0x1B, 0x52, 0xCD, 0x77, 0xCC, 0x2F, 0xB0,
+    0xCA, 0x0F, 0x34, 0x06, 0xB0, 0xE3, 0x8B, 0xE4, 0x96, 0x6E, 0x0F, 0x6B, 0x6F, 0xD1, 0x81, 0xC2,
+    0xFF, 0x4C, 0x92, 0xF8, 0xF5, 0x0E, 0xAD, 0x2A, 0xA5, 0x0C, 0x64, 0x42, 0x21, 0xDD, 0x47, 0x63,
+    0xE0, 0xB5, 0x32, 0xF8, 0x0F, 0xC9, 0x1D, 0x13, 0x01, 0xA0, 0xC2, 0x4A, 0x65, 0x77, 0xD3, 0xAD,
+    0xFF, 0x51, 0x9A, 0xF2, 0x23, 0x53, 0x6E, 0x4B, 0x42, 0xC5, 0xBD, 0x14, 0x9E, 0x17, 0x48, 0x5D,
+    0x60, 0x64, 0xA7, 0x96, 0x5A, 0xAD, 0x62, 0x88, 0x1F, 0x53, 0xB7, 0x1D, 0xDC, 0x6D, 0x50, 0x7C,
+    0x0A, 0x76, 0x97, 0xB0, 0xC9, 0x6B, 0x46, 0xD9, 0xA3, 0xC5, 0x3E, 0x68, 0xED, 0xF2, 0xEA, 0x28,
+    0x82, 0x2E, 0xB9, 0x76, 0x83, 0xCD, 0x8E, 0x38, 0x4A, 0x19, 0x73, 0xB0, 0x26, 0xDB, 0x04, 0xBB,
+    0x2D, 0xC3, 0x35, 0x3B, 0x48, 0xEB, 0xE6, 0xF0, 0xDD, 0xC7, 0x09, 0x55, 0xD0, 0xE8, 0x0F, 0xE9,
+    0x6C, 0x9D, 0xCE, 0xAC, 0xF7, 0x09, 0x9D, 0x26, 0x87, 0xC8, 0xEA, 0x19, 0xEE, 0x40, 0x24, 0x6F,
+    0x50, 0xAB, 0x70, 0xA5, 0x3B, 0x4B, 0x64, 0x1E, 0x54, 0x45, 0x15, 0x31, 0xE4, 0x3B, 0x71, 0x2A,
+    0x1F, 0xEE, 0xA5, 0xF8, 0xFB, 0x81, 0x82, 0x5F, 0x52, 0x16, 0x33, 0xF8, 0xC6, 0x94, 0x6F, 0xEE,
+    0x94, 0xB7, 0xE1, 0xCF, 0x80, 0xA3, 0x9F, 0x02, 0xF9, 0xF3, 0x34, 0xB1, 0xBF, 0xD8, 0xD5, 0x16,
+    0xE9, 0xB3, 0xCD, 0x53, 0x72, 0x12, 0xC8, 0x1C, 0x18, 0x9D, 0x56, 0xE1, 0x94, 0xDA, 0x0F, 0xE0,
+    0xFE, 0x39, 0xF5, 0x06, 0xA8, 0x4D, 0x7D, 0xC5, 0x0E, 0x70, 0x0D, 0x7A, 0xE0, 0xD9, 0x71, 0xCF,
+    0xDD, 0x4A, 0x73, 0x7B, 0x97, 0x64, 0x64, 0x5D, 0xF7, 0x6A, 0xE2, 0xD9, 0xBB, 0xE9, 0x86, 0x8C,
+    0x75, 0xC7, 0xC5, 0xC6, 0x8A, 0xFD, 0x79, 0x52, 0x17, 0xEA, 0xD6, 0xE5, 0x27, 0xD6, 0x22, 0xE3,
+    0xB7, 0xCF, 0xA5, 0xE7, 0xD6, 0x7B, 0x29, 0x31, 0xF2, 0x9C, 0x29, 0x6B, 0xCE, 0x86, 0x2C, 0xFE,
+    0xC0, 0x96, 0x4B, 0xE7, 0x9A, 0x58, 0xFA, 0x59, 0x88, 0x2A, 0xDA, 0x2B, 0x27, 0x52, 0x03, 0x36,
+    0x43, 0xF6, 0x73, 0x50, 0x89, 0xE7, 0xC7, 0xAE, 0xF0, 0xD1, 0xE6, 0x37, 0xD7, 0x6A, 0x3E, 0x27,
+    0x5E, 0x8A, 0x4F, 0xBE, 0xE2, 0xFB, 0x1C, 0xC2, 0xDD, 0xE7, 0xEF, 0x28, 0x1A, 0x55, 0xC7, 0xA0,
+    0x17, 0x0E, 0x1B, 0xCF, 0x29, 0xD6, 0x7A, 0x61, 0xAF, 0x86, 0x6A, 0xA4, 0xF1, 0xEC, 0xF1, 0x89,
+    0xEB, 0x67, 0xF8, 0xA7, 0xEF, 0xB7, 0xDE, 0xD3, 0x10, 0x7F, 0x91, 0x62, 0xD9, 0x9B, 0xE3, 0xFB,
+    0x34, 0xAA, 0x71, 0x54, 0xBA, 0x64, 0xA9, 0x8F, 0x9D, 0xD6, 0x9E, 0x66, 0x2F, 0x38, 0x5D, 0xC6,
+    0x26, 0xBA, 0x22, 0x75, 0x03, 0x27, 0x6D, 0x89, 0x02, 0x63, 0x91, 0x7A, 0x4A, 0xA8, 0x16, 0x6E,
+    0x9D, 0x54, 0xA8, 0xC4, 0xF5, 0x68, 0x12, 0x45, 0x5F, 0xD2, 0x24, 0x35, 0x45, 0xC4, 0xA2, 0x7A,
+    0x51, 0xC1, 0x0A, 0x5A, 0x74, 0xFF, 0x43, 0x91, 0xB6, 0xD9, 0x19, 0xD5, 0x87, 0xFC, 0x7A, 0x27,
+    0x15, 0x80, 0x4B, 0x7C, 0x53, 0xA3, 0x72, 0xBC, 0x5A, 0xA1, 0xA6, 0x2C, 0x07, 0xD5, 0xDC, 0x1E,
+    0x97, 0xA3, 0x06, 0x46, 0x65, 0xB9, 0x06, 0x7E, 0x5F, 0x46, 0x83, 0x34, 0x1A, 0x58, 0xAD, 0xB6,
+    0x11, 0xCE, 0x84, 0x9A, 0x3F, 0xCF, 0xA4, 0xF3, 0x1E, 0xB6, 0xF8, 0xE4, 0xD5, 0xF9, 0xB3, 0xA8,
+    0x85, 0x5F, 0xB4, 0x73, 0x57, 0xDB, 0x09, 0xFD, 0x4F, 0xD4, 0x62, 0x16, 0x56, 0x20, 0x63, 0x3B,
+    0x71, 0x75, 0x3B, 0xF7, 0x8B, 0xC5, 0x2C, 0x84, 0x72, 0xD2, 0xB5, 0xE6, 0x5A, 0x93, 0xFE, 0x50,
+    0xF1, 0x82, 0x79, 0xA8, 0x7F, 0x97, 0xB9, 0xC8, 0x61, 0x74, 0xCB, 0xD9, 0x8B, 0x3B, 0x03, 0xB1,
+    0xAF, 0x5A, 0x1B, 0xD6, 0x6F, 0x6A, 0x65, 0x20, 0x0E, 0xE2, 0x6E, 0xCF, 0xDE, 0x35, 0x99, 0x3D,
+    0x63, 0xD4, 0x3D, 0xC4, 0xA7, 0xFB, 0x37, 0x3E, 0xDB, 0xBF, 0xD1, 0x57, 0xB8, 0xC0, 0xA0, 0x98,
+    0xE0, 0xA2, 0x96, 0x0F, 0x70, 0x47, 0xAF, 0xD0, 0x80, 0xD6, 0xE3, 0x9D, 0xEF, 0x8C, 0xE1, 0x99,
+    0x47, 0xE3, 0x09, 0x17, 0xA2, 0xB7, 0x4D, 0x7E, 0x85, 0x47, 0x44, 0x13, 0xD2, 0x24, 0xAD, 0x89,
+    0xA2, 0x3E, 0x27, 0x2C, 0x77, 0x97, 0xE4, 0xDE, 0xA3, 0xBC, 0xCD, 0xEE, 0x30, 0x09, 0xC2, 0xDC,
+    0x0D, 0x08, 0xB1, 0x1D, 0xD8, 0x3B, 0x59, 0xF8, 0xD5, 0x34, 0xA6, 0xB0, 0x07, 0xF1, 0x4A, 0x57,
+    0x26, 0x47, 0x85, 0x2C, 0xCF, 0x6D, 0x8B, 0x7F, 0x00, 0xD5, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14,
+    0xFE, 0x66, 0x47, 0xB9, 0x15, 0x5E, 0xC9, 0x93, 0x22, 0x20, 0x24, 0xFB, 0x7C, 0x89, 0x94, 0x2A,
+    0x3A, 0xFB, 0x9A, 0x14, 0x06, 0xED, 0xED, 0xAD, 0x03, 0x82, 0x02, 0xA4, 0x20, 0x94, 0x23, 0x12,
+    0x16, 0x72, 0x93, 0x32, 0xD2, 0x81, 0xB4, 0x41, 0x16, 0x39, 0xFB, 0x36, 0xA1, 0x70, 0x91, 0x26,
+    0x12, 0x42, 0x14, 0x34, 0x94, 0xE4, 0x8C, 0x64, 0x8A, 0x14, 0x01, 0x9D, 0x7D, 0x13, 0xBB, 0x70,
+    0xE1, 0x22, 0x4B, 0x48, 0x74, 0x45, 0x04, 0x59, 0x14, 0x4B, 0x0E, 0xB1, 0x44, 0x46, 0xB0, 0x56,
+    0xF6, 0xEC, 0xBB, 0x1D, 0xDE, 0x5C, 0x7E, 0x48, 0x82, 0xD2, 0xD1, 0xB0, 0xBB, 0xF3, 0x76, 0xE7,
+    0xCD, 0x9B, 0xF7, 0xBE, 0xF7, 0x37, 0x7B, 0xA4, 0xF9, 0x85, 0xEE, 0x83, 0x4B, 0xCC, 0x42, 0x80,
+    0x29, 0x94, 0xCD, 0xF7, 0x65, 0xFA, 0xB6, 0x62, 0xB8, 0xB0, 0x43, 0x58, 0x5D, 0xE8, 0xA4, 0xCC,
+    0xD7, 0xA4, 0x3B, 0x61, 0xCB, 0x4C, 0xD9, 0x19, 0xDB, 0x49, 0x5D, 0xDE, 0x09, 0xC7, 0x5D, 0x7E,
+    0x7D, 0xB7, 0xE7, 0x64, 0x00, 0x72, 0x29, 0xD3, 0x89, 0x6B, 0xAF, 0x87, 0xE3, 0xB3, 0x6C, 0x2B,
+    0x9C, 0xF0, 0xA6, 0x7F, 0xD3, 0xBF, 0xB0, 0xF7, 0x23, 0xDA, 0xEF, 0x9C, 0x5B, 0x54, 0x85, 0x84,
+    0x44, 0x18, 0x78, 0x68, 0x6E, 0xAD, 0x4F, 0xDE, 0x34, 0x6F, 0xCB, 0x07, 0xB4, 0xAE, 0x56, 0x9B,
+    0x4D, 0x4D, 0x1A, 0xAA, 0x55, 0xAD, 0x49, 0xC6, 0x9F, 0x14, 0x2C, 0x2E, 0x72, 0xE9, 0xF2, 0x70,
+    0x92, 0x87, 0x2E, 0x97, 0xE3, 0x88, 0x1D, 0xD2, 0x82, 0xF7, 0x04, 0x8B, 0x5C, 0x87, 0x45, 0x93,
+    0x82, 0xCB, 0x78, 0x32, 0xEF, 0xF0, 0xD5, 0x9F, 0x62, 0xE0, 0x93, 0xCC, 0xDE, 0xB9, 0x52, 0xB7,
+    0xD6, 0xFD, 0xD1, 0x80, 0xFD, 0x43, 0x56, 0xF1, 0xAA, 0x95, 0x42, 0xAB, 0x09, 0x87, 0x20, 0xD7,
+    0xAD, 0x4E, 0x38, 0x61, 0x40, 0x8D, 0xD5, 0xAD, 0x3B, 0xB2, 0xEC, 0xD9, 0x57, 0x75, 0x62, 0xF7,
+    0x0D, 0x9E, 0x6F, 0xDA, 0xDE, 0xDE, 0x71, 0x28, 0xF1, 0xD4, 0x93, 0x4B, 0x85, 0xBE, 0x1E, 0xB6,
+    0xC8, 0x77, 0x2E, 0xAD, 0x88, 0xA9, 0x27, 0xB7, 0xD6, 0x0D, 0x2D, 0x9D, 0x2E, 0xD7, 0xC9, 0x61,
+    0x5B, 0x9A, 0xA8, 0xC8, 0x57, 0x94, 0xD3, 0x07, 0xEB, 0x81, 0x47, 0x26, 0x60, 0x1B, 0xF7, 0xD2,
+    0x92, 0x51, 0x8A, 0x21, 0x70, 0x85, 0x36, 0x86, 0x15, 0xBF, 0x86, 0xCB, 0x6A, 0x8C, 0xD0, 0xAA,
+    0x95, 0xA5, 0x45, 0xF2, 0x4D, 0x00, 0x8A, 0xC8, 0x50, 0x73, 0x4A, 0xA7, 0xE3, 0xB0, 0x24, 0x8A,
+    0xE0, 0x3A, 0x9A, 0x68, 0x87, 0xA8, 0x0F, 0x74, 0xEC, 0xE7, 0x6B, 0x8F, 0x75, 0xB4, 0xFD, 0x46,
+    0x2A, 0x7C, 0xCB, 0x44, 0xCF, 0x5E, 0x4A, 0x1A, 0x5F, 0xAF, 0x4B, 0x72, 0xE0, 0x8E, 0x1C, 0x2B,
+    0xF3, 0x68, 0xB7, 0xC7, 0x4D, 0xB8, 0x8F, 0xFC, 0x7F, 0x53, 0xC6, 0x2E, 0x61, 0x37, 0x35, 0x70,
+    0x8B, 0x56, 0xFB, 0xEA, 0xCE, 0x69, 0xD7, 0x5A, 0x0B, 0xDD, 0xF2, 0x8C, 0x6C, 0xBF, 0x9B, 0xDB,
+    0x74, 0x16, 0x17, 0xFC, 0x4F, 0xE5, 0xB0, 0xD6, 0xCB, 0xD5, 0x19, 0xB0, 0x08, 0xDE, 0x07, 0x53,
+    0x3A, 0xCC, 0x6D, 0x5A, 0xBB, 0x6A, 0x96, 0xA2, 0x59, 0x54, 0xEC, 0x36, 0xF2, 0x8A, 0x75, 0x7C,
+    0xD7, 0x9B, 0xF1, 0x1B, 0xE1, 0x61, 0x76, 0x5E, 0x4E, 0x0A, 0x81, 0xD7, 0x25, 0x4B, 0x50, 0xF0,
+    0xF9, 0x77, 0x50, 0xAA, 0xC8, 0x17, 0xFC, 0x7C, 0xEE, 0xAE, 0x75, 0x2F, 0x31, 0x16, 0xF2, 0x60,
+    0x77, 0x74, 0xE6, 0xE2, 0xBA, 0x2C, 0x8A, 0xE9, 0xB0, 0x14, 0x1D, 0x84, 0xED, 0x23, 0x30, 0xE4,
+    0xCC, 0x25, 0xFB, 0xC7, 0xB4, 0xCE, 0x9F, 0xAB, 0x9B, 0x75, 0x8C, 0x1E, 0xA4, 0x4D, 0xB6, 0x4F,
+    0xB6, 0x83, 0x5C, 0xDE, 0x5E, 0x78, 0xFB, 0x5C, 0x27, 0x3C, 0x2B, 0x0B, 0x97, 0xED, 0x77, 0xA6,
+    0x22, 0x15, 0x88, 0x51, 0x16, 0x1F, 0xEA, 0x7C, 0x74, 0xE6, 0xE1, 0x23, 0x0F, 0x5D, 0x19, 0xBA,
+    0x78, 0x76, 0xE9, 0x33, 0x52, 0x13, 0x15, 0x03, 0x2E, 0x47, 0x03, 0x1E, 0xFE, 0x6B, 0x7C, 0x6C,
+    0x85, 0xA3, 0x87, 0x7E, 0x78, 0x81, 0x2D, 0xB3, 0x90, 0x98, 0x85, 0x7C, 0x80, 0x2D, 0x7F, 0x38,
+    0x60, 0x5B, 0xB2, 0x38, 0x3F, 0xBD, 0x50, 0x8B, 0x82, 0x27, 0x38, 0x73, 0xBF, 0x3B, 0x8B, 0x9F,
+    0x87, 0xA6, 0x70, 0x22, 0xD4, 0x7C, 0x7A, 0x8F, 0xBE, 0x36, 0x43, 0xC9, 0x7B, 0x09, 0x47, 0xAD,
+    0xDD, 0x91, 0xBB, 0x79, 0x04, 0x2C, 0xB2, 0xFD, 0x3C, 0x8E, 0x62, 0x87, 0x0D, 0x2A, 0xC7, 0xD1,
+    0x21, 0x25, 0x08, 0x4E, 0x74, 0x00, 0x73, 0x80, 0xA5, 0x00, 0x21, 0x01, 0x0F, 0xCD, 0x4B, 0x29,
+    0xD7, 0x7B, 0xB1, 0xF8, 0xF2, 0xB8, 0x2C, 0xA3, 0x84, 0x04, 0x15, 0x2A, 0xB9, 0xC6, 0x52, 0x33,
+    0x6C, 0x90, 0xF4, 0xBE, 0xEE, 0x09, 0x53, 0x81, 0x10, 0x94, 0xDD, 0x32, 0x29, 0xA1, 0xCC, 0x73,
+    0x9D, 0x42, 0xE8, 0xD8, 0xA8, 0xA4, 0x44, 0xC4, 0xB0, 0xAE, 0x46, 0xB0, 0xB7, 0x69, 0x8B, 0xEE,
+    0x59, 0xFA, 0x56, 0xEA, 0xEC, 0xBD, 0x71, 0xB1, 0xB0, 0x61, 0xFB, 0x15, 0xE1, 0xC0, 0xA3, 0x14,
+    0xCC, 0x8D, 0x09, 0xD4, 0xF3, 0xC3, 0x68, 0x15, 0xF3, 0xA8, 0xBB, 0x45, 0x1A, 0x2E, 0xCA, 0xB3,
+    0x2E, 0x2A, 0xC1, 0x24, 0x4A, 0x2A, 0x80, 0x50, 0xDF, 0xC3, 0xEE, 0xAA, 0x53, 0xD4, 0x46, 0x09,
+    0xBB, 0xAF, 0x63, 0xA3, 0x8E, 0xAF, 0x4A, 0x58, 0xE7, 0xC3, 0x81, 0x09, 0xD4, 0x32, 0xDF, 0xD1,
+    0xDA, 0xD7, 0xFE, 0x69, 0x87, 0x8C, 0x56, 0x9E, 0x86, 0x4E, 0x78, 0x86, 0x46, 0x3A, 0xD2, 0xD3,
+    0x05, 0xE8, 0x37, 0xEB, 0x5C, 0xB1, 0x44, 0x84, 0x3C, 0x2A, 0x43, 0x84, 0x09, 0x4A, 0x04, 0x7B,
+    0x9E, 0x60, 0xF7, 0x09, 0x76, 0x3F, 0x39, 0x40, 0xEA, 0xA9, 0xF7, 0x28, 0x04, 0xFB, 0x8C, 0x07,
+    0x5A, 0x09, 0xAD, 0xA5, 0x57, 0xAD, 0x0E, 0x1C, 0x7A, 0xCE, 0xBF, 0x47, 0xD3, 0x0A, 0xD5, 0xB1,
+    0xD6, 0xE9, 0x53, 0xAB, 0x23, 0xD9, 0xB7, 0xA4, 0x22, 0xA6, 0x82, 0x7A, 0x46, 0x78, 0x70, 0xD9,
+    0xC4, 0x2F, 0xE9, 0x1E, 0x1A, 0x7E, 0x80, 0x16, 0xCD, 0xD3, 0x87, 0xEB, 0x8F, 0x47, 0x89, 0x3C,
+    0xA8, 0xD0, 0x60, 0x8F, 0xF8, 0x47, 0xB2, 0x26, 0xCC, 0xFC, 0xE5, 0x6E, 0x75, 0x30, 0xA7, 0x3E,
+    0x05, 0x27, 0xF7, 0x0A, 0x37, 0xAB, 0x27, 0x88, 0x9F, 0x99, 0x61, 0xE2, 0xEB, 0x1B, 0xDD, 0x63,
+    0x03, 0x0B, 0x6A, 0x60, 0x26, 0xC4, 0xA9, 0xD2, 0xA6, 0x97, 0x1D, 0xFB, 0x4B, 0x77, 0xB5, 0xBE,
+    0x90, 0x9D, 0xD4, 0x37, 0x1B, 0x35, 0xC9, 0x7B, 0xF0, 0x56, 0x28, 0xB3, 0xC8, 0xC8, 0x6F, 0x58,
+    0x7B, 0x92, 0x20, 0x38, 0xF7, 0xCD, 0x69, 0x53, 0x6A, 0xA1, 0x24, 0xB1, 0xA2, 0xA0, 0x0D, 0xDB,
+    0xE9, 0x19, 0xB6, 0x67, 0xD8, 0x6C, 0xDB, 0xB0, 0xC5, 0x40, 0x7A, 0xD6, 0x48, 0xF3, 0x55, 0x62,
+    0x3F, 0x63, 0x4A, 0xE2, 0xF1, 0x65, 0xC7, 0x50, 0x74, 0x9C, 0xB9, 0xE4, 0x9D, 0x40, 0x41, 0x71,
+    0x69, 0x2F, 0x13, 0x63, 0x3B, 0x74, 0x31, 0xA7, 0x04, 0x6B, 0xAF, 0x2C, 0xDE, 0x6D, 0x6B, 0xAD,
+    0xDF, 0xDA, 0xD9, 0x99, 0xF3, 0xEB, 0x9E, 0x60, 0xB5, 0xE9, 0xCE, 0x0D, 0xC3, 0xF8, 0x70, 0xB7,
+    0xBD, 0x12, 0xD6, 0xED, 0x6B, 0x28, 0xE0, 0x81, 0xB4, 0x65, 0x89, 0x0E, 0x4B, 0x42, 0x5A, 0x27,
+    0x2C, 0x05, 0x42, 0x65, 0x4B, 0x73, 0x1A, 0x76, 0x61, 0x8E, 0x0D, 0x8A, 0x62, 0xBF, 0x46, 0x61,
+    0xE8, 0x91, 0x15, 0xF4, 0xB0, 0x6C, 0x48, 0x79, 0x40, 0x1C, 0x43, 0x04, 0x91, 0x56, 0x81, 0x56,
+    0xFB, 0xBA, 0xD7, 0xAF, 0xFD, 0xA9, 0x7B, 0x94, 0x3C, 0x4A, 0x79, 0x97, 0xF4, 0x90, 0xFC, 0x8B,
+    0x89, 0x4F, 0x44, 0x64, 0x44, 0x6C, 0x13, 0x4C, 0xEC, 0x6F, 0x74, 0x07, 0x7D, 0x60, 0xDA, 0x61,
+    0x79, 0x9A, 0x9C, 0x74, 0x64, 0x81, 0x8A, 0xAC, 0x65, 0x64, 0x1D, 0xE9, 0xC8, 0x5A, 0xDC, 0x22,
+    0x33, 0x7A, 0x43, 0x3A, 0x6B, 0x9B, 0x41, 0x0B, 0x69, 0x9D, 0xB8, 0x25, 0x0A, 0x43, 0x5B, 0x47,
+    0xF3, 0xB4, 0x2D, 0xE1, 0x29, 0x96, 0x6B, 0x10, 0x89, 0x23, 0x53, 0x2A, 0xDD, 0x96, 0x23, 0x51,
+    0xB9, 0x20, 0xA9, 0x0A, 0x7B, 0x2D, 0x2A, 0x49, 0x7B, 0x43, 0x52, 0x5D, 0xD4, 0x49, 0xD9, 0x45,
+    0xB1, 0x21, 0xED, 0x5B, 0x3A, 0x69, 0xC1, 0x6B, 0x0C, 0x3A, 0xEF, 0x00, 0xF9, 0xDC, 0xA2, 0xC2,
+    0x47, 0xDF, 0x90, 0x0C, 0x57, 0xCA, 0x14, 0x82, 0x64, 0x82, 0xDD, 0x27, 0x62, 0xDD, 0x86, 0x2A,
+    0x58, 0xB7, 0xA6, 0x94, 0xE0, 0xEB, 0xE7, 0x0C, 0x39, 0x1F, 0xD7, 0x16, 0xB7, 0xB7, 0x53, 0x13,
+    0xBF, 0xFE, 0xC8, 0xED, 0xAF, 0xB6, 0x6E, 0xD8, 0x1B, 0xC7, 0x7E, 0x96, 0xFC, 0x1A, 0x1D, 0xF2,
+    0x74, 0xD0, 0x6D, 0x85, 0xFC, 0x57, 0x3C, 0xF0, 0xAD, 0x3F, 0xB0, 0xE7, 0x53, 0x5B, 0xB7, 0xCD,
+    0x5F, 0xA6, 0x6D, 0x02, 0xD5, 0x30, 0xC4, 0xC3, 0x7F, 0x7D, 0xFD, 0x0D, 0x9D, 0x55, 0xBF, 0x6F,
+    0x1C, 0x45, 0x14, 0x7E, 0xB3, 0x13, 0x58, 0x91, 0x2D, 0xC6, 0x05, 0x28, 0x92, 0x9D, 0xB0, 0xAD,
+    0x85, 0x12, 0xF6, 0x0F, 0x88, 0xEF, 0x6E, 0x2D, 0x8A, 0x14, 0x14, 0xB8, 0xE0, 0x68, 0x28, 0xDC,
+    0x13, 0xD0, 0x15, 0x50, 0xA1, 0xF3, 0xED, 0xCA, 0x0D, 0x25, 0x34, 0xA4, 0x8D, 0x8B, 0x54, 0x17,
+    0x21, 0xBB, 0x30, 0x92, 0x85, 0x36, 0xDE, 0x41, 0x29, 0x28, 0x68, 0x56, 0x42, 0x54, 0x29, 0x38,
+    0x09, 0x9B, 0x48, 0x46, 0x8A, 0x07, 0x69, 0x8C, 0xF6, 0xEE, 0xF6, 0x6E, 0xF8, 0xDE, 0xEE, 0xDA,
+    0x11, 0x14, 0x29, 0x38, 0xE9, 0xED, 0xEC, 0x7D, 0xF7, 0xE6, 0xFD, 0xFC, 0xDE, 0xBB, 0xC4, 0xED,
+    0xD1, 0xC8, 0x39, 0x2B, 0xE6, 0xDA, 0xB7, 0xFE, 0x39, 0x49, 0x13, 0x66, 0xE4, 0xEB, 0x91, 0x59,
+    0x57, 0x9B, 0x73, 0x6D, 0x3A, 0xFE, 0xB9, 0xD4, 0x36, 0xCC, 0x94, 0x2C, 0x46, 0x66, 0xE3, 0x95,
+    0xD0, 0xA3, 0x28, 0x53, 0x44, 0x33, 0xB3, 0x41, 0xFE, 0x33, 0x6D, 0x28, 0x8F, 0xA4, 0x73, 0x26,
+    0x53, 0x6E, 0x41, 0xED, 0xA7, 0x03, 0x51, 0x31, 0xBD, 0xF3, 0x78, 0x4A, 0xA1, 0x73, 0xA9, 0xE8,
+    0x8F, 0x62, 0x06, 0xC4, 0xF1, 0x7B, 0x85, 0x74, 0x95, 0x95, 0x8B, 0x8F, 0x17, 0xA2, 0xA4, 0x24,
+    0xAE, 0x28, 0x28, 0xBA, 0x24, 0x6C, 0x18, 0x53, 0xC7, 0x2F, 0x48, 0x6D, 0x5A, 0x92, 0xC5, 0x0E,
+    0x91, 0xC5, 0xE5, 0x8E, 0x34, 0x14, 0xC6, 0x19, 0xA9, 0x42, 0x15, 0x81, 0x15, 0xCE, 0xED, 0xC0,
+    0xD6, 0xFB, 0x31, 0xBD, 0xD9, 0xFA, 0xE8, 0xF7, 0xFB, 0x94, 0x3B, 0x57, 0xAC, 0x8E, 0xC7, 0x7B,
+    0x0D, 0x32, 0x58, 0x12, 0x10, 0x43, 0x6E, 0xF3, 0x88, 0x8E, 0xF1, 0xBD, 0x07, 0x09, 0x39, 0x12,
+    0x4D, 0x74, 0xE3, 0xB4, 0xCF, 0xA1, 0x4C, 0xBC, 0x7C, 0xFC, 0x08, 0x66, 0x89, 0xE0, 0x8E, 0x01,
+    0xED, 0x03, 0xAC, 0x35, 0x3C, 0x03, 0xD5, 0x2E, 0x24, 0xC0, 0x2F, 0xB4, 0xA4, 0x75, 0x52, 0xAE,
+    0x36, 0x08, 0xE5, 0x2D, 0x84, 0x45, 0x11, 0x59, 0x8A, 0xE2, 0x0E, 0x6E, 0xAB, 0x58, 0xA5, 0xB2,
+    0xC0, 0x25, 0x1B, 0x68, 0xEA, 0x40, 0x5F, 0xDD, 0x2B, 0x48, 0xFE, 0x32, 0xA1, 0x55, 0x37, 0x1B,
+    0x07, 0x0E, 0x56, 0xB7, 0xE7, 0xBF, 0xC6, 0xD2, 0x94, 0xC8, 0x84, 0x53, 0x83, 0x69, 0x15, 0xF7,
+    0x60, 0x03, 0x4E, 0x2D, 0x65, 0x28, 0x8F, 0xD2, 0xA8, 0x46, 0xC9, 0x46, 0xE3, 0x04, 0xFA, 0x08,
+    0xC4, 0xFD, 0xD8, 0x4F, 0xFA, 0x5B, 0xA4, 0x52, 0x22, 0x39, 0x41, 0x00, 0xE5, 0x3A, 0xA2, 0x49,
+    0x10, 0x3C, 0x62, 0x90, 0x28, 0xAC, 0xAC, 0x10, 0xF3, 0xF2, 0x35, 0x52, 0xBF, 0x7D, 0xAD, 0xE5,
+    0x53, 0x87, 0x80, 0x39, 0xB0, 0x9C, 0x48, 0xB8, 0x94, 0xBC, 0x39, 0xAE, 0x58, 0xB8, 0x5B, 0xE1,
+    0x04, 0xAE, 0x6C, 0x34, 0x9F, 0x35, 0x57, 0xF2, 0xD1, 0x43, 0x23, 0x70, 0xDC, 0x89, 0x07, 0xA6,
+    0x86, 0xBD, 0xB2, 0xE9, 0xD4, 0x13, 0x3E, 0x86, 0x75, 0xE6, 0x08, 0x2D, 0xE2, 0xA3, 0xAC, 0xCB,
+    0xC6, 0x07, 0x5C, 0x20, 0x62, 0x3E, 0x84, 0xA9, 0x41, 0xA4, 0x12, 0xD1, 0x27, 0x31, 0xCC, 0xF7,
+    0x3C, 0x67, 0x90, 0x40, 0x37, 0xF8, 0xA3, 0xF2, 0x35, 0x65, 0x2A, 0x1E, 0xFA, 0x5A, 0x94, 0x11,
+    0x0D, 0x03, 0xED, 0x9B, 0x2E, 0x0D, 0x55, 0x1A, 0xE9, 0x0E, 0xF0, 0x07, 0x8E, 0x46, 0x9E, 0x0D,
+    0x11, 0x44, 0xE2, 0x26, 0xD1, 0x32, 0x46, 0x45, 0xD3, 0xDA, 0xFA, 0x4A, 0x1D, 0x86, 0xAD, 0x9F,
+    0xA2, 0x8D, 0xA9, 0x3D, 0x9A, 0xE0, 0xDB, 0x1C, 0x64, 0x71, 0x99, 0x49, 0x82, 0x37, 0x67, 0xA1,
+    0x55, 0x01, 0x1C, 0xBE, 0x94, 0xC9, 0x11, 0x30, 0x0B, 0x23, 0xB8, 0x7E, 0x81, 0x4B, 0x73, 0xE8,
+    0x25, 0x69, 0x4D, 0x00, 0x94, 0x9D, 0x74, 0x12, 0x7B, 0xC6, 0x69, 0xF9, 0xF7, 0x73, 0xAD, 0xDC,
+    0xD3, 0x49, 0xD8, 0xDB, 0x35, 0x5D, 0x45, 0x76, 0xF8, 0x06, 0x95, 0x75, 0xCE, 0x9C, 0xFE, 0x4B,
+    0x01, 0x96, 0x1B, 0xBE, 0x2F, 0xDD, 0x09, 0xDC, 0xB9, 0x82, 0x3A, 0x1F, 0x2D, 0xD0, 0xBF, 0x50,
+    0xDF, 0x9F, 0x3D, 0x9E, 0x0D, 0xD0, 0xA9, 0x02, 0xFD, 0x4B, 0x15, 0x6A, 0x70, 0xFF, 0x6C, 0x3C,
+    0x8B, 0x1A, 0xA0, 0x07, 0x8D, 0x24, 0xC6, 0x1C, 0xC4, 0xC4, 0xAC, 0x69, 0x07, 0xA0, 0x89, 0xDD,
+    0xD2, 0x7F, 0x80, 0xF6, 0xB3, 0x01, 0x89, 0xE0, 0x04, 0x8C, 0x29, 0xC9, 0x3D, 0x5C, 0xD3, 0x6A,
+    0x02, 0xE8, 0x98, 0x0C, 0x46, 0x53, 0x6A, 0x50, 0x03, 0x43, 0x56, 0x41, 0x0B, 0x75, 0x00, 0x81,
+    0x52, 0x40, 0x5D, 0x70, 0x12, 0xAC, 0xEA, 0x21, 0x0B, 0xBA, 0x18, 0x28, 0x2D, 0x75, 0x16, 0x91,
+    0xF2, 0xCC, 0x88, 0x36, 0x02, 0xBD, 0x20, 0x13, 0x89, 0x05, 0x20, 0x6F, 0xB9, 0xFD, 0xBA, 0x11,
+    0x4C, 0x43, 0xD4, 0x7A, 0x0A, 0xDA, 0x68, 0x76, 0xCE, 0x1E, 0xB9, 0xE4, 0x1E, 0x87, 0xD3, 0x43,
+    0x75, 0x7C, 0x30, 0x8A, 0x72, 0xC4, 0xA3, 0x40, 0x33, 0xF1, 0x17, 0x72, 0xEE, 0x21, 0x42, 0x59,
+    0x54, 0x3C, 0x56, 0xEE, 0x19, 0x64, 0x41, 0x56, 0x72, 0xBF, 0xC3, 0xF8, 0x0A, 0x01, 0xE1, 0x77,
+    0x50, 0x22, 0x39, 0x01, 0x27, 0x22, 0xB4, 0x4B, 0x58, 0x10, 0x47, 0xFD, 0x04, 0x2B, 0x59, 0x75,
+    0xD9, 0x31, 0x91, 0x2F, 0x09, 0x63, 0x55, 0xC8, 0x93, 0x35, 0xD3, 0xFA, 0x2B, 0x1B, 0x11, 0x16,
+    0x86, 0x96, 0x2C, 0xA0, 0x2D, 0x0C, 0xA0, 0x97, 0x35, 0x21, 0x9C, 0x63, 0x8C, 0xF9, 0x15, 0xB5,
+    0x12, 0x22, 0x40, 0x75, 0x22, 0x8E, 0x7C, 0xAE, 0x4D, 0x8E, 0x26, 0x88, 0xAD, 0xB6, 0x6A, 0x01,
+    0xAA, 0x38, 0x70, 0xDF, 0xA0, 0x33, 0x0B, 0xE1, 0xBE, 0x1B, 0xD0, 0x12, 0xC0, 0xC2, 0x2B, 0x28,
+    0xA1, 0x43, 0x94, 0xEC, 0x0E, 0x46, 0x2B, 0x40, 0x6B, 0x00, 0x94, 0x00, 0xBA, 0x04, 0x20, 0x6D,
+    0x81, 0x8A, 0x35, 0x00, 0xF8, 0x13, 0x5C, 0xA9, 0x00, 0x84, 0xFA, 0x10, 0x01, 0x7C, 0xB6, 0x8A,
+    0x2E, 0x80, 0x93, 0xEC, 0x05, 0x1A, 0x18, 0x11, 0xCE, 0x01, 0x12, 0xE3, 0x71, 0x8B, 0xBE, 0x20,
+    0xAF, 0x80, 0x7E, 0x07, 0x6D, 0x0C, 0x66, 0xFB, 0x67, 0x5F, 0x21, 0xD8, 0xEA, 0xC6, 0xE9, 0xFE,
+    0xB7, 0x71, 0x47, 0xF0, 0xB6, 0xE2, 0xF9, 0x7E, 0xC5, 0x0B, 0xF1, 0x0B, 0x6F, 0x33, 0x62, 0xCE,
+    0x06, 0x0E, 0x23, 0x11, 0x71, 0xDD, 0x2F, 0xB7, 0x18, 0x9A, 0x8F, 0x9A, 0x25, 0xBC, 0x3A, 0x17,
+    0x22, 0x43, 0xE3, 0x2F, 0x79, 0xDF, 0x3C, 0xCC, 0x65, 0xC3, 0x68, 0xC9, 0xA3, 0x98, 0xD8, 0xFA,
+    0x46, 0xFD, 0xCA, 0x3F, 0xD5, 0x2D, 0xA4, 0x27, 0xAB, 0xD7, 0x77, 0xF7, 0xBA, 0x77, 0x7F, 0x78,
+    0x91, 0x45, 0x9F, 0x17, 0xF6, 0xF6, 0xBB, 0x77, 0xF5, 0xC1, 0xCD, 0x4E, 0xA8, 0x0F, 0x6E, 0x55,
+    0xFE, 0xF2, 0x62, 0x60, 0xBC, 0x73, 0xB0, 0xD2, 0xD3, 0xDF, 0x7F, 0x4A, 0x1E, 0x7E, 0x40, 0x5A,
+    0x2B, 0xD7, 0xE0, 0xD0, 0x2D, 0x50, 0xF2, 0xC5, 0x5B, 0xFD, 0xFE, 0x87, 0x6C, 0x82, 0xCF, 0xBC,
+    0xC5, 0xEA, 0xD5, 0xF8, 0x3F, 0x04, 0x77, 0x31, 0x1D, 0x45, 0x58, 0x30, 0x6B, 0x41, 0xF6, 0xA8,
+    0xA6, 0x8C, 0xE5, 0xCD, 0x82, 0x8E, 0x46, 0x69, 0xE0, 0x52, 0x6F, 0x59, 0xAF, 0x58, 0x26, 0x24,
+    0x54, 0x50, 0x1F, 0x4E, 0xB0, 0xDB, 0xAC, 0xDC, 0x06, 0x00, 0xD3, 0xEB, 0x65, 0x20, 0x8C, 0x80,
+    0x44, 0x24, 0xE6, 0x4B, 0xF2, 0xD0, 0x6D, 0xCE, 0xFC, 0x4B, 0xB3, 0x46, 0x62, 0xE6, 0x40, 0x1D,
+    0xEC, 0x4D, 0xB0, 0x69, 0x04, 0x6E, 0x42, 0xB7, 0xDB, 0xCA, 0x0E, 0x24, 0xC3, 0xBD, 0x52, 0x18,
+    0xDF, 0x08, 0x3B, 0xD0, 0x18, 0x01, 0xE8, 0x9E, 0xBC, 0x1C, 0x38, 0x8A, 0x78, 0xFA, 0xE4, 0x9F,
+    0xFC, 0x7C, 0xBB, 0x9E, 0x8A, 0x43, 0x55, 0xAF, 0x1B, 0x9E, 0x44, 0x79, 0x3A, 0xC5, 0x3F, 0x0A,
+    0xF8, 0xC6, 0x7F, 0x58, 0xFB, 0x67, 0xE3, 0x5C, 0xF3, 0x80, 0x06, 0x29, 0x47, 0xA4, 0x48, 0xEA,
+    0x98, 0x6E, 0x93, 0x52, 0xF7, 0xD2, 0x03, 0xEA, 0xB8, 0x7C, 0x57, 0x93, 0xDB, 0xFE, 0xF9, 0x05,
+    0x49, 0x7B, 0xD3, 0x47, 0x14, 0x6C, 0xCA, 0x73, 0xEC, 0xE1, 0x7A, 0xBD, 0x40, 0xA9, 0x17, 0x5F,
+    0xE3, 0x1E, 0x39, 0x53, 0x8F, 0x78, 0xBD, 0xEF, 0xB8, 0x69, 0xCD, 0x5E, 0x0D, 0xF4, 0xD5, 0xAA,
+    0xCB, 0xA8, 0xE5, 0x7B, 0x03, 0xAE, 0x4D, 0x63, 0x44, 0xEC, 0x38, 0xE5, 0x3C, 0x37, 0x1E, 0xA6,
+    0x2D, 0x07, 0x51, 0x4D, 0x30, 0xC9, 0xA0, 0x59, 0xF5, 0x78, 0x14, 0x3F, 0x48, 0x03, 0x2D, 0x7F,
+    0x2F, 0x70, 0x7D, 0xCA, 0x7F, 0x25, 0xDD, 0x1D, 0x9E, 0xED, 0x87, 0xBC, 0x59, 0x9E, 0x73, 0x5A,
+    0x53, 0x66, 0x48, 0x03, 0xA6, 0xF4, 0xEF, 0xCF, 0x3F, 0x45, 0x51, 0x31, 0x4E, 0xC3, 0x40, 0x10,
+    0x5C, 0xE7, 0x40, 0x57, 0xA4, 0xB8, 0x2A, 0xA2, 0x42, 0x7E, 0x01, 0xF2, 0x0B, 0x62, 0x5B, 0xF0,
+    0x03, 0x44, 0x2A, 0x9E, 0x10, 0xA1, 0x7C, 0x80, 0x88, 0x08, 0x24, 0x68, 0x29, 0x78, 0x4E, 0x24,
+    0xC7, 0x4A, 0x41, 0x7B, 0x49, 0x8A, 0xB4, 0x96, 0x50, 0x0A, 0xA0, 0xC0, 0x85, 0x91, 0x0E, 0x88,
+    0xBD, 0xCC, 0xAD, 0x09, 0xB1, 0x6E, 0x66, 0x6E, 0xCE, 0x7B, 0xEB, 0xDD, 0xB5, 0xE2, 0x2F, 0x52,
+    0xCC, 0x85, 0xDA, 0x5C, 0x3A, 0x65, 0xA9, 0x06, 0x62, 0x20, 0xF9, 0x83, 0xDF, 0x8F, 0x95, 0x0D,
+    0xB6, 0xC3, 0x26, 0x2B, 0x33, 0xE6, 0xC9, 0xF0, 0xFB, 0x89, 0x70, 0x26, 0xC8, 0xB8, 0x04, 0xAA,
+    0x7F, 0xBF, 0x03, 0x05, 0x69, 0x4A, 0xD4, 0xC9, 0xBD, 0x7D, 0x03, 0x85, 0xEC, 0x88, 0xF8, 0x9D,
+    0x53, 0xF5, 0x93, 0x7F, 0xD8, 0xEE, 0x32, 0x5F, 0x95, 0xE6, 0x36, 0xB7, 0x2E, 0x3A, 0xCD, 0xED,
+    0x34, 0x41, 0xDC, 0xD8, 0x53, 0x1C, 0xEF, 0x09, 0x39, 0x28, 0xF1, 0x14, 0x79, 0x0A, 0x91, 0x8D,
+    0xCC, 0x0C, 0xA4, 0x0A, 0x9F, 0xDD, 0xF9, 0xC3, 0x9B, 0x47, 0xA2, 0x2E, 0x33, 0x57, 0x42, 0xC1,
+    0x62, 0x46, 0xC7, 0x27, 0x14, 0x2C, 0xAD, 0xE2, 0x86, 0x12, 0xAE, 0xD5, 0x66, 0x54, 0xF5, 0x29,
+    0x9C, 0x5B, 0xDA, 0xF6, 0xA9, 0xDB, 0x8A, 0xB9, 0xB3, 0xBA, 0x4C, 0xD8, 0xA1, 0xDF, 0x49, 0x1C,
+    0x64, 0x67, 0x72, 0xA8, 0x57, 0xE8, 0xB2, 0x4F, 0xEA, 0x05, 0x8D, 0x22, 0x64, 0x5E, 0x1C, 0xB9,
+    0x84, 0x1B, 0x84, 0xA4, 0x48, 0x26, 0x39, 0x17, 0x68, 0x61, 0x84, 0x4B, 0x8D, 0xF9, 0xBC, 0x8A,
+    0x52, 0x5F, 0xD7, 0x98, 0xE8, 0x9A, 0x68, 0xBA, 0x5B, 0xB0, 0xB1, 0xD4, 0x1B, 0xDA, 0x43, 0x8D,
+    0xCF, 0x67, 0x35, 0x26, 0xE0, 0x4B, 0xE4, 0x06, 0xAB, 0x37, 0xB8, 0xE8, 0x0D, 0x06, 0xE7, 0xA8,
+    0xF2, 0x19, 0xA0, 0xFD, 0x63, 0x85, 0x4D, 0x2B, 0x2C, 0x62, 0x5A, 0x61, 0x11, 0xF3, 0x3A, 0xF2,
+    0x52, 0x49, 0x08, 0xDA, 0xF7, 0xC2, 0xF7, 0x45, 0x64, 0x11, 0xC6, 0xB3, 0x1B, 0x8B, 0x30, 0xEE,
+    0xB0, 0x85, 0xA9, 0x70, 0x0F, 0x26, 0xCD, 0x78, 0xDD, 0x0E, 0xE4, 0x01, 0x1D, 0x32, 0x3B, 0x14,
+    0xA3, 0xB1, 0xD3, 0xEC, 0x22, 0xFC, 0x02, 0x6C, 0x61, 0x44, 0x30, 0x41, 0x5D, 0x6B, 0x18, 0xD2,
+    0xA5, 0xF1, 0xE3, 0xD4, 0x36, 0x99, 0x78, 0x59, 0xCB, 0x6C, 0xE5, 0x0D, 0x44, 0x0C, 0x69, 0x31,
+    0x74, 0x00, 0xFC, 0x02,
+};
+
+static const uint32_t notosans_14_regularBlockOffsets[33] = {
+    0, 1202, 2127, 3190, 4345, 5199, 5955, 6842,
+    7768, 8677, 9497, 10179, 10881, 11683, 12908, 13926,
+    14880, 15955, 16934, 18172, 19149, 20234, 21280, 22150,
+    23097, 24131, 25017, 26127, 27258, 28201, 29436, 30633,
+    30980,
+};
+
+static const uint16_t notosans_14_regularDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_14_regularGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_14_regularPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 0,
 };
 
 static const EpdGlyph notosans_14_regularGlyphs[] = {
@@ -3954,848 +2134,848 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 15, 15, 17, 1, 18, 57, 1730 }, // >
     { 12, 23, 13, 0, 22, 69, 1787 }, // ?
     { 24, 24, 26, 1, 21, 144, 1856 }, // @
-    { 19, 21, 19, 0, 21, 100, 2000 }, // A
-    { 16, 21, 19, 2, 21, 84, 2100 }, // B
-    { 17, 23, 18, 1, 22, 98, 2184 }, // C
-    { 18, 21, 21, 2, 21, 95, 2282 }, // D
-    { 13, 21, 16, 2, 21, 69, 2377 }, // E
-    { 13, 21, 15, 2, 21, 69, 2446 }, // F
-    { 19, 23, 21, 1, 22, 110, 2515 }, // G
-    { 17, 21, 22, 2, 21, 90, 2625 }, // H
-    { 8, 21, 10, 1, 21, 42, 2715 }, // I
-    { 9, 27, 8, -3, 21, 61, 2757 }, // J
-    { 17, 21, 18, 2, 21, 90, 2818 }, // K
-    { 13, 21, 15, 2, 21, 69, 2908 }, // L
-    { 22, 21, 26, 2, 21, 116, 2977 }, // M
-    { 18, 21, 22, 2, 21, 95, 3093 }, // N
-    { 20, 23, 23, 1, 22, 115, 3188 }, // O
-    { 15, 21, 18, 2, 21, 79, 3303 }, // P
-    { 20, 27, 23, 1, 22, 135, 3382 }, // Q
-    { 16, 21, 18, 2, 21, 84, 3517 }, // R
-    { 14, 23, 16, 1, 22, 81, 3601 }, // S
-    { 16, 21, 16, 0, 21, 84, 3682 }, // T
-    { 17, 22, 21, 2, 21, 94, 3766 }, // U
-    { 18, 21, 18, 0, 21, 95, 3860 }, // V
-    { 27, 21, 27, 0, 21, 142, 3955 }, // W
-    { 17, 21, 17, 0, 21, 90, 4097 }, // X
-    { 17, 21, 17, 0, 21, 90, 4187 }, // Y
-    { 15, 21, 17, 1, 21, 79, 4277 }, // Z
-    { 7, 26, 10, 2, 21, 46, 4356 }, // [
-    { 11, 21, 11, 0, 21, 58, 4402 }, // <backslash>
-    { 8, 26, 10, 0, 21, 52, 4460 }, // ]
-    { 15, 14, 17, 1, 21, 53, 4512 }, // ^
-    { 15, 3, 13, -1, -2, 12, 4565 }, // _
-    { 7, 6, 8, 1, 23, 11, 4577 }, // `
-    { 13, 17, 16, 1, 16, 56, 4588 }, // a
-    { 15, 24, 18, 2, 23, 90, 4644 }, // b
-    { 13, 17, 14, 1, 16, 56, 4734 }, // c
-    { 15, 24, 18, 1, 23, 90, 4790 }, // d
-    { 14, 17, 16, 1, 16, 60, 4880 }, // e
-    { 12, 23, 10, 0, 23, 69, 4940 }, // f
-    { 15, 23, 18, 1, 16, 87, 5009 }, // g
-    { 14, 23, 18, 2, 23, 81, 5096 }, // h
-    { 4, 22, 8, 2, 22, 22, 5177 }, // i
-    { 8, 29, 8, -2, 22, 58, 5199 }, // j
-    { 14, 23, 16, 2, 23, 81, 5257 }, // k
-    { 4, 23, 8, 2, 23, 23, 5338 }, // l
-    { 23, 16, 27, 2, 16, 92, 5361 }, // m
-    { 14, 16, 18, 2, 16, 56, 5453 }, // n
-    { 16, 17, 18, 1, 16, 68, 5509 }, // o
-    { 15, 23, 18, 2, 16, 87, 5577 }, // p
-    { 15, 23, 18, 1, 16, 87, 5664 }, // q
-    { 10, 16, 12, 2, 16, 40, 5751 }, // r
-    { 12, 17, 14, 1, 16, 51, 5791 }, // s
-    { 10, 21, 11, 0, 20, 53, 5842 }, // t
-    { 14, 17, 18, 2, 16, 60, 5895 }, // u
-    { 15, 16, 15, 0, 16, 60, 5955 }, // v
-    { 23, 16, 23, 0, 16, 92, 6015 }, // w
-    { 15, 16, 15, 0, 16, 60, 6107 }, // x
-    { 15, 23, 15, 0, 16, 87, 6167 }, // y
-    { 12, 16, 14, 1, 16, 48, 6254 }, // z
-    { 11, 26, 11, 0, 21, 72, 6302 }, // {
-    { 4, 31, 16, 6, 23, 31, 6374 }, // |
-    { 11, 26, 11, 0, 21, 72, 6405 }, // }
-    { 15, 5, 17, 1, 13, 19, 6477 }, // ~
-    { 0, 0, 8, 0, 0, 0, 6496 }, //  
-    { 4, 22, 8, 2, 16, 22, 6496 }, // ¡
-    { 13, 23, 17, 2, 22, 75, 6518 }, // ¢
-    { 16, 22, 17, 0, 22, 88, 6593 }, // £
-    { 14, 14, 17, 1, 17, 49, 6681 }, // ¤
-    { 17, 21, 17, 0, 21, 90, 6730 }, // ¥
-    { 4, 31, 16, 6, 23, 31, 6820 }, // ¦
-    { 13, 24, 15, 1, 23, 78, 6851 }, // §
-    { 9, 4, 17, 4, 22, 9, 6929 }, // ¨
-    { 22, 23, 24, 1, 22, 127, 6938 }, // ©
-    { 9, 11, 10, 0, 22, 25, 7065 }, // ª
-    { 13, 13, 15, 1, 14, 43, 7090 }, // «
-    { 15, 9, 17, 1, 12, 34, 7133 }, // ¬
-    { 8, 3, 9, 1, 9, 6, 7167 }, // ­
-    { 22, 23, 24, 1, 22, 127, 7173 }, // ®
-    { 16, 3, 15, -1, 25, 12, 7300 }, // ¯
-    { 10, 10, 12, 1, 22, 25, 7312 }, // °
-    { 15, 18, 17, 1, 18, 68, 7337 }, // ±
-    { 9, 13, 10, 0, 25, 30, 7405 }, // ²
-    { 10, 14, 10, 0, 25, 35, 7435 }, // ³
-    { 7, 6, 8, 1, 23, 11, 7470 }, // ´
-    { 14, 23, 18, 2, 16, 81, 7481 }, // µ
-    { 16, 27, 19, 1, 23, 108, 7562 }, // ¶
-    { 4, 5, 8, 2, 13, 5, 7670 }, // ·
-    { 7, 7, 7, 0, 0, 13, 7675 }, // ¸
-    { 6, 13, 10, 1, 25, 20, 7688 }, // ¹
-    { 11, 11, 11, 0, 22, 31, 7708 }, // º
-    { 13, 13, 15, 1, 14, 43, 7739 }, // »
-    { 22, 21, 22, 0, 21, 116, 7782 }, // ¼
-    { 22, 21, 22, 0, 21, 116, 7898 }, // ½
-    { 23, 22, 23, 0, 22, 127, 8014 }, // ¾
-    { 13, 22, 13, 0, 16, 72, 8141 }, // ¿
-    { 19, 28, 19, 0, 28, 133, 8213 }, // À
-    { 19, 28, 19, 0, 28, 133, 8346 }, // Á
-    { 19, 28, 19, 0, 28, 133, 8479 }, // Â
-    { 19, 27, 19, 0, 27, 129, 8612 }, // Ã
-    { 19, 27, 19, 0, 27, 129, 8741 }, // Ä
-    { 19, 26, 19, 0, 26, 124, 8870 }, // Å
-    { 25, 21, 26, -1, 21, 132, 8994 }, // Æ
-    { 17, 29, 18, 1, 22, 124, 9126 }, // Ç
-    { 13, 28, 16, 2, 28, 91, 9250 }, // È
-    { 13, 28, 16, 2, 28, 91, 9341 }, // É
-    { 13, 28, 16, 2, 28, 91, 9432 }, // Ê
-    { 13, 27, 16, 2, 27, 88, 9523 }, // Ë
-    { 8, 28, 10, 1, 28, 56, 9611 }, // Ì
-    { 9, 28, 10, 1, 28, 63, 9667 }, // Í
-    { 10, 28, 10, 0, 28, 70, 9730 }, // Î
-    { 10, 27, 10, 0, 27, 68, 9800 }, // Ï
-    { 20, 21, 21, 0, 21, 105, 9868 }, // Ð
-    { 18, 27, 22, 2, 27, 122, 9973 }, // Ñ
-    { 20, 29, 23, 1, 28, 145, 10095 }, // Ò
-    { 20, 29, 23, 1, 28, 145, 10240 }, // Ó
-    { 20, 29, 23, 1, 28, 145, 10385 }, // Ô
-    { 20, 28, 23, 1, 27, 140, 10530 }, // Õ
-    { 20, 28, 23, 1, 27, 140, 10670 }, // Ö
-    { 14, 14, 17, 1, 17, 49, 10810 }, // ×
-    { 20, 23, 23, 1, 22, 115, 10859 }, // Ø
-    { 17, 29, 21, 2, 28, 124, 10974 }, // Ù
-    { 17, 29, 21, 2, 28, 124, 11098 }, // Ú
-    { 17, 29, 21, 2, 28, 124, 11222 }, // Û
-    { 17, 28, 21, 2, 27, 119, 11346 }, // Ü
-    { 17, 28, 17, 0, 28, 119, 11465 }, // Ý
-    { 15, 21, 18, 2, 21, 79, 11584 }, // Þ
-    { 16, 24, 18, 2, 23, 96, 11663 }, // ß
-    { 13, 24, 16, 1, 23, 78, 11759 }, // à
-    { 13, 24, 16, 1, 23, 78, 11837 }, // á
-    { 13, 24, 16, 1, 23, 78, 11915 }, // â
-    { 13, 23, 16, 1, 22, 75, 11993 }, // ã
-    { 13, 23, 16, 1, 22, 75, 12068 }, // ä
-    { 13, 25, 16, 1, 24, 82, 12143 }, // å
-    { 23, 17, 25, 1, 16, 98, 12225 }, // æ
-    { 13, 23, 14, 1, 16, 75, 12323 }, // ç
-    { 14, 24, 16, 1, 23, 84, 12398 }, // è
-    { 14, 24, 16, 1, 23, 84, 12482 }, // é
-    { 14, 24, 16, 1, 23, 84, 12566 }, // ê
-    { 14, 23, 16, 1, 22, 81, 12650 }, // ë
-    { 7, 23, 8, -1, 23, 41, 12731 }, // ì
-    { 7, 23, 8, 2, 23, 41, 12772 }, // í
-    { 11, 23, 8, -2, 23, 64, 12813 }, // î
-    { 9, 22, 8, -1, 22, 50, 12877 }, // ï
-    { 16, 24, 18, 1, 23, 96, 12927 }, // ð
-    { 14, 22, 18, 2, 22, 77, 13023 }, // ñ
-    { 16, 24, 18, 1, 23, 96, 13100 }, // ò
-    { 16, 24, 18, 1, 23, 96, 13196 }, // ó
-    { 16, 24, 18, 1, 23, 96, 13292 }, // ô
-    { 16, 23, 18, 1, 22, 92, 13388 }, // õ
-    { 16, 23, 18, 1, 22, 92, 13480 }, // ö
-    { 15, 14, 17, 1, 17, 53, 13572 }, // ÷
-    { 16, 18, 18, 1, 17, 72, 13625 }, // ø
-    { 14, 24, 18, 2, 23, 84, 13697 }, // ù
-    { 14, 24, 18, 2, 23, 84, 13781 }, // ú
-    { 14, 24, 18, 2, 23, 84, 13865 }, // û
-    { 14, 23, 18, 2, 22, 81, 13949 }, // ü
-    { 15, 30, 15, 0, 23, 113, 14030 }, // ý
-    { 15, 30, 18, 2, 23, 113, 14143 }, // þ
-    { 15, 29, 15, 0, 22, 109, 14256 }, // ÿ
-    { 19, 25, 19, 0, 25, 119, 14365 }, // Ā
-    { 13, 21, 16, 1, 20, 69, 14484 }, // ā
-    { 19, 27, 19, 0, 27, 129, 14553 }, // Ă
-    { 13, 23, 16, 1, 22, 75, 14682 }, // ă
-    { 19, 28, 19, 0, 21, 133, 14757 }, // Ą
-    { 14, 23, 16, 1, 16, 81, 14890 }, // ą
-    { 17, 29, 18, 1, 28, 124, 14971 }, // Ć
-    { 13, 24, 14, 1, 23, 78, 15095 }, // ć
-    { 17, 29, 18, 1, 28, 124, 15173 }, // Ĉ
-    { 13, 24, 14, 1, 23, 78, 15297 }, // ĉ
-    { 17, 28, 18, 1, 27, 119, 15375 }, // Ċ
-    { 13, 23, 14, 1, 22, 75, 15494 }, // ċ
-    { 17, 29, 18, 1, 28, 124, 15569 }, // Č
-    { 13, 24, 14, 1, 23, 78, 15693 }, // č
-    { 18, 28, 21, 2, 28, 126, 15771 }, // Ď
-    { 20, 24, 18, 1, 23, 120, 15897 }, // ď
-    { 20, 21, 21, 0, 21, 105, 16017 }, // Đ
-    { 17, 24, 18, 1, 23, 102, 16122 }, // đ
-    { 13, 25, 16, 2, 25, 82, 16224 }, // Ē
-    { 14, 21, 16, 1, 20, 74, 16306 }, // ē
-    { 13, 27, 16, 2, 27, 88, 16380 }, // Ĕ
-    { 14, 23, 16, 1, 22, 81, 16468 }, // ĕ
-    { 13, 27, 16, 2, 27, 88, 16549 }, // Ė
-    { 14, 23, 16, 1, 22, 81, 16637 }, // ė
-    { 13, 28, 16, 2, 21, 91, 16718 }, // Ę
-    { 14, 23, 16, 1, 16, 81, 16809 }, // ę
-    { 13, 28, 16, 2, 28, 91, 16890 }, // Ě
-    { 14, 24, 16, 1, 23, 84, 16981 }, // ě
-    { 19, 29, 21, 1, 28, 138, 17065 }, // Ĝ
-    { 15, 30, 18, 1, 23, 113, 17203 }, // ĝ
-    { 19, 28, 21, 1, 27, 133, 17316 }, // Ğ
-    { 15, 29, 18, 1, 22, 109, 17449 }, // ğ
-    { 19, 28, 21, 1, 27, 133, 17558 }, // Ġ
-    { 15, 29, 18, 1, 22, 109, 17691 }, // ġ
-    { 19, 29, 21, 1, 22, 138, 17800 }, // Ģ
-    { 15, 30, 18, 1, 23, 113, 17938 }, // ģ
-    { 17, 28, 22, 2, 28, 119, 18051 }, // Ĥ
-    { 18, 30, 18, -2, 30, 135, 18170 }, // ĥ
-    { 22, 21, 22, 0, 21, 116, 18305 }, // Ħ
-    { 16, 23, 18, 0, 23, 92, 18421 }, // ħ
-    { 12, 27, 10, -1, 27, 81, 18513 }, // Ĩ
-    { 12, 22, 8, -2, 22, 66, 18594 }, // ĩ
-    { 10, 25, 10, 0, 25, 63, 18660 }, // Ī
-    { 10, 20, 8, -1, 20, 50, 18723 }, // ī
-    { 10, 27, 10, 0, 27, 68, 18773 }, // Ĭ
-    { 10, 22, 8, -1, 22, 55, 18841 }, // ĭ
-    { 8, 28, 10, 1, 21, 56, 18896 }, // Į
-    { 6, 29, 8, 0, 22, 44, 18952 }, // į
-    { 8, 27, 10, 1, 27, 54, 18996 }, // İ
-    { 4, 16, 8, 2, 16, 16, 19050 }, // ı
-    { 15, 27, 18, 1, 21, 102, 19066 }, // Ĳ
-    { 11, 29, 15, 2, 22, 80, 19168 }, // ĳ
-    { 12, 34, 8, -3, 28, 102, 19248 }, // Ĵ
-    { 11, 30, 8, -2, 23, 83, 19350 }, // ĵ
-    { 17, 28, 18, 2, 21, 119, 19433 }, // Ķ
-    { 14, 30, 16, 2, 23, 105, 19552 }, // ķ
-    { 14, 16, 16, 2, 16, 56, 19657 }, // ĸ
-    { 13, 28, 15, 2, 28, 91, 19713 }, // Ĺ
-    { 7, 30, 8, 2, 30, 53, 19804 }, // ĺ
-    { 13, 28, 15, 2, 21, 91, 19857 }, // Ļ
-    { 5, 30, 8, 1, 23, 38, 19948 }, // ļ
-    { 13, 21, 15, 2, 21, 69, 19986 }, // Ľ
-    { 8, 23, 8, 2, 23, 46, 20055 }, // ľ
-    { 13, 21, 15, 2, 21, 69, 20101 }, // Ŀ
-    { 8, 23, 8, 2, 23, 46, 20170 }, // ŀ
-    { 15, 21, 15, 0, 21, 79, 20216 }, // Ł
-    { 9, 23, 8, -1, 23, 52, 20295 }, // ł
-    { 18, 28, 22, 2, 28, 126, 20347 }, // Ń
-    { 14, 23, 18, 2, 23, 81, 20473 }, // ń
-    { 18, 28, 22, 2, 21, 126, 20554 }, // Ņ
-    { 14, 23, 18, 2, 16, 81, 20680 }, // ņ
-    { 18, 28, 22, 2, 28, 126, 20761 }, // Ň
-    { 14, 23, 18, 2, 23, 81, 20887 }, // ň
-    { 18, 21, 20, 0, 21, 95, 20968 }, // ŉ
-    { 18, 27, 22, 2, 21, 122, 21063 }, // Ŋ
-    { 14, 23, 18, 2, 16, 81, 21185 }, // ŋ
-    { 20, 26, 23, 1, 25, 130, 21266 }, // Ō
-    { 16, 21, 18, 1, 20, 84, 21396 }, // ō
-    { 20, 28, 23, 1, 27, 140, 21480 }, // Ŏ
-    { 16, 23, 18, 1, 22, 92, 21620 }, // ŏ
-    { 20, 29, 23, 1, 28, 145, 21712 }, // Ő
-    { 16, 24, 18, 1, 23, 96, 21857 }, // ő
-    { 25, 23, 27, 1, 22, 144, 21953 }, // Œ
-    { 26, 17, 28, 1, 16, 111, 22097 }, // œ
-    { 16, 28, 18, 2, 28, 112, 22208 }, // Ŕ
-    { 10, 23, 12, 2, 23, 58, 22320 }, // ŕ
-    { 16, 28, 18, 2, 21, 112, 22378 }, // Ŗ
-    { 11, 23, 12, 1, 16, 64, 22490 }, // ŗ
-    { 16, 28, 18, 2, 28, 112, 22554 }, // Ř
-    { 10, 23, 12, 2, 23, 58, 22666 }, // ř
-    { 14, 29, 16, 1, 28, 102, 22724 }, // Ś
-    { 12, 24, 14, 1, 23, 72, 22826 }, // ś
-    { 14, 29, 16, 1, 28, 102, 22898 }, // Ŝ
-    { 12, 24, 14, 1, 23, 72, 23000 }, // ŝ
-    { 14, 29, 16, 1, 22, 102, 23072 }, // Ş
-    { 12, 23, 14, 1, 16, 69, 23174 }, // ş
-    { 14, 29, 16, 1, 28, 102, 23243 }, // Š
-    { 12, 24, 14, 1, 23, 72, 23345 }, // š
-    { 16, 28, 16, 0, 21, 112, 23417 }, // Ţ
-    { 10, 27, 11, 0, 20, 68, 23529 }, // ţ
-    { 16, 28, 16, 0, 28, 112, 23597 }, // Ť
-    { 14, 24, 11, 0, 23, 84, 23709 }, // ť
-    { 16, 21, 16, 0, 21, 84, 23793 }, // Ŧ
-    { 10, 21, 11, 0, 20, 53, 23877 }, // ŧ
-    { 17, 28, 21, 2, 27, 119, 23930 }, // Ũ
-    { 14, 23, 18, 2, 22, 81, 24049 }, // ũ
-    { 17, 26, 21, 2, 25, 111, 24130 }, // Ū
-    { 14, 21, 18, 2, 20, 74, 24241 }, // ū
-    { 17, 28, 21, 2, 27, 119, 24315 }, // Ŭ
-    { 14, 23, 18, 2, 22, 81, 24434 }, // ŭ
-    { 17, 30, 21, 2, 29, 128, 24515 }, // Ů
-    { 14, 25, 18, 2, 24, 88, 24643 }, // ů
-    { 17, 29, 21, 2, 28, 124, 24731 }, // Ű
-    { 14, 24, 18, 2, 23, 84, 24855 }, // ű
-    { 17, 28, 21, 2, 21, 119, 24939 }, // Ų
-    { 14, 23, 18, 2, 16, 81, 25058 }, // ų
-    { 27, 28, 27, 0, 28, 189, 25139 }, // Ŵ
-    { 23, 23, 23, 0, 23, 133, 25328 }, // ŵ
-    { 17, 28, 17, 0, 28, 119, 25461 }, // Ŷ
-    { 15, 30, 15, 0, 23, 113, 25580 }, // ŷ
-    { 17, 27, 17, 0, 27, 115, 25693 }, // Ÿ
-    { 15, 28, 17, 1, 28, 105, 25808 }, // Ź
-    { 12, 23, 14, 1, 23, 69, 25913 }, // ź
-    { 15, 27, 17, 1, 27, 102, 25982 }, // Ż
-    { 12, 22, 14, 1, 22, 66, 26084 }, // ż
-    { 15, 28, 17, 1, 28, 105, 26150 }, // Ž
-    { 12, 23, 14, 1, 23, 69, 26255 }, // ž
-    { 9, 23, 10, 2, 23, 52, 26324 }, // ſ
-    { 7, 6, 0, -15, 23, 11, 26376 }, // ̀
-    { 7, 6, 0, -10, 23, 11, 26387 }, // ́
-    { 10, 6, 0, -5, 23, 15, 26398 }, // ̂
-    { 12, 5, 0, -15, 22, 15, 26413 }, // ̃
-    { 10, 3, 0, -5, 20, 8, 26428 }, // ̄
-    { 14, 3, 0, -7, 25, 11, 26436 }, // ̅
-    { 10, 5, 0, -5, 22, 13, 26447 }, // ̆
-    { 4, 4, 0, -2, 22, 4, 26460 }, // ̇
-    { 10, 4, 0, -5, 22, 10, 26464 }, // ̈
-    { 6, 7, 0, -11, 24, 11, 26474 }, // ̉
-    { 8, 7, 0, -4, 24, 14, 26485 }, // ̊
-    { 11, 6, 0, -4, 23, 17, 26499 }, // ̋
-    { 10, 6, 0, -5, 23, 15, 26516 }, // ̌
-    { 4, 6, 0, -2, 23, 6, 26531 }, // ̍
-    { 8, 6, 0, -4, 23, 12, 26537 }, // ̎
-    { 12, 6, 0, -16, 23, 18, 26549 }, // ̏
-    { 10, 8, 0, -5, 25, 20, 26567 }, // ̐
-    { 10, 5, 0, -5, 22, 13, 26587 }, // ̑
-    { 6, 8, 0, -3, 21, 12, 26600 }, // ̒
-    { 6, 8, 0, -3, 21, 12, 26612 }, // ̓
-    { 6, 8, 0, -3, 21, 12, 26624 }, // ̔
-    { 6, 8, 0, -3, 21, 12, 26636 }, // ̕
-    { 6, 6, 0, -3, -1, 9, 26648 }, // ̖
-    { 6, 6, 0, -3, -1, 9, 26657 }, // ̗
-    { 6, 7, 0, -3, 0, 11, 26666 }, // ̘
-    { 6, 7, 0, -3, 0, 11, 26677 }, // ̙
-    { 8, 8, 9, 0, 23, 16, 26688 }, // ̚
-    { 7, 7, 0, -3, 23, 13, 26704 }, // ̛
-    { 4, 7, 0, -2, 0, 7, 26717 }, // ̜
-    { 8, 6, 0, -4, -1, 12, 26724 }, // ̝
-    { 8, 6, 0, -4, -1, 12, 26736 }, // ̞
-    { 8, 7, 0, -4, 0, 14, 26748 }, // ̟
-    { 8, 3, 0, -4, -3, 6, 26762 }, // ̠
-    { 6, 9, 0, -6, 2, 14, 26768 }, // ̡
-    { 6, 9, 0, 0, 2, 14, 26782 }, // ̢
-    { 4, 5, 0, -11, -1, 5, 26796 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 26801 }, // ̤
-    { 8, 7, 0, -4, 0, 14, 26811 }, // ̥
-    { 4, 6, 0, -2, -1, 6, 26825 }, // ̦
-    { 6, 7, 0, -3, 0, 11, 26831 }, // ̧
-    { 6, 8, 0, -3, 1, 12, 26842 }, // ̨
-    { 4, 6, 0, -2, 0, 6, 26854 }, // ̩
-    { 12, 6, 0, -6, -1, 18, 26860 }, // ̪
-    { 12, 5, 0, -6, -1, 15, 26878 }, // ̫
-    { 10, 6, 0, -5, 0, 15, 26893 }, // ̬
-    { 10, 6, 0, -5, -1, 15, 26908 }, // ̭
-    { 10, 5, 0, -5, -1, 13, 26923 }, // ̮
-    { 10, 5, 0, -5, -1, 13, 26936 }, // ̯
-    { 12, 5, 0, -6, -1, 15, 26949 }, // ̰
-    { 10, 3, 0, -5, -2, 8, 26964 }, // ̱
-    { 14, 3, 0, -7, -2, 11, 26972 }, // ̲
-    { 14, 7, 0, -7, 0, 25, 26983 }, // ̳
-    { 12, 5, 0, -6, 10, 15, 27008 }, // ̴
-    { 14, 3, 0, -7, 10, 11, 27023 }, // ̵
-    { 22, 3, 0, -11, 10, 17, 27034 }, // ̶
-    { 10, 7, 0, -5, 12, 18, 27051 }, // ̷
-    { 12, 25, 0, -6, 23, 75, 27069 }, // ̸
-    { 4, 7, 0, -2, 0, 7, 27144 }, // ̹
-    { 12, 6, 0, -6, -1, 18, 27151 }, // ̺
-    { 12, 7, 0, -6, 0, 21, 27169 }, // ̻
-    { 12, 5, 0, -6, -1, 15, 27190 }, // ̼
-    { 6, 7, 0, -3, 23, 11, 27205 }, // ̽
-    { 4, 10, 0, -2, 26, 10, 27216 }, // ̾
-    { 14, 7, 0, -7, 29, 25, 27226 }, // ̿
-    { 7, 6, 0, -5, 23, 11, 27251 }, // ̀
-    { 7, 6, 0, -2, 23, 11, 27262 }, // ́
-    { 12, 5, 0, -6, 22, 15, 27273 }, // ͂
-    { 5, 6, 0, -3, 23, 8, 27288 }, // ̓
-    { 11, 6, 0, -5, 23, 17, 27296 }, // ̈́
-    { 6, 5, 0, -2, -2, 8, 27313 }, // ͅ
-    { 14, 6, 0, -7, 23, 21, 27321 }, // ͆
-    { 14, 7, 0, -7, 0, 25, 27342 }, // ͇
-    { 8, 6, 0, -4, 0, 12, 27367 }, // ͈
-    { 6, 6, 0, -3, -1, 9, 27379 }, // ͉
-    { 12, 7, 0, -6, 23, 21, 27388 }, // ͊
-    { 12, 11, 0, -6, 27, 33, 27409 }, // ͋
-    { 10, 9, 0, -5, 26, 23, 27442 }, // ͌
-    { 12, 6, 0, -6, -1, 18, 27465 }, // ͍
-    { 6, 7, 0, -3, 0, 11, 27483 }, // ͎
-    { 22, 21, 0, -11, 21, 116, 27494 }, // ͏
-    { 6, 7, 0, -3, 24, 11, 27610 }, // ͐
-    { 4, 7, 0, -2, 24, 7, 27621 }, // ͑
-    { 10, 8, 0, -5, 25, 20, 27628 }, // ͒
-    { 6, 7, 0, -3, 0, 11, 27648 }, // ͓
-    { 6, 6, 0, -3, -1, 9, 27659 }, // ͔
-    { 6, 6, 0, -3, -1, 9, 27668 }, // ͕
-    { 12, 6, 0, -6, -1, 18, 27677 }, // ͖
-    { 4, 7, 0, -2, 24, 7, 27695 }, // ͗
-    { 4, 4, 0, 3, 22, 4, 27702 }, // ͘
-    { 8, 6, 0, -4, -1, 12, 27706 }, // ͙
-    { 12, 7, 0, -6, 0, 21, 27718 }, // ͚
-    { 6, 6, 0, -3, 23, 9, 27739 }, // ͛
-    { 24, 6, 0, -12, -1, 36, 27748 }, // ͜
-    { 24, 6, 0, -12, 23, 36, 27784 }, // ͝
-    { 18, 2, 0, -9, 20, 9, 27820 }, // ͞
-    { 18, 2, 0, -9, -2, 9, 27829 }, // ͟
-    { 24, 5, 0, -12, 22, 30, 27838 }, // ͠
-    { 24, 6, 0, -12, 25, 36, 27868 }, // ͡
-    { 23, 6, 0, -11, -1, 35, 27904 }, // ͢
-    { 6, 8, 0, -3, 25, 12, 27939 }, // ͣ
-    { 7, 8, 0, -3, 25, 14, 27951 }, // ͤ
-    { 2, 9, 0, -1, 27, 5, 27965 }, // ͥ
-    { 7, 8, 0, -3, 25, 14, 27970 }, // ͦ
-    { 7, 8, 0, -3, 25, 14, 27984 }, // ͧ
-    { 6, 8, 0, -3, 25, 12, 27998 }, // ͨ
-    { 7, 10, 0, -3, 27, 18, 28010 }, // ͩ
-    { 7, 9, 0, -3, 27, 16, 28028 }, // ͪ
-    { 11, 7, 0, -5, 25, 20, 28044 }, // ͫ
-    { 5, 7, 0, -2, 25, 9, 28064 }, // ͬ
-    { 5, 9, 0, -2, 26, 12, 28073 }, // ͭ
-    { 8, 7, 0, -4, 25, 14, 28085 }, // ͮ
-    { 7, 7, 0, -3, 25, 13, 28099 }, // ͯ
-    { 13, 28, 16, 2, 28, 91, 28112 }, // Ѐ
-    { 13, 27, 16, 2, 27, 88, 28203 }, // Ё
-    { 20, 22, 21, 0, 21, 110, 28291 }, // Ђ
-    { 13, 28, 15, 2, 28, 91, 28401 }, // Ѓ
-    { 17, 23, 19, 1, 22, 98, 28492 }, // Є
-    { 14, 23, 16, 1, 22, 81, 28590 }, // Ѕ
-    { 4, 21, 8, 2, 21, 21, 28671 }, // І
-    { 8, 27, 8, 0, 27, 54, 28692 }, // Ї
-    { 9, 27, 8, -3, 21, 61, 28746 }, // Ј
-    { 28, 22, 29, 0, 21, 154, 28807 }, // Љ
-    { 27, 21, 30, 2, 21, 142, 28961 }, // Њ
-    { 20, 21, 21, 0, 21, 105, 29103 }, // Ћ
-    { 16, 28, 18, 2, 28, 112, 29208 }, // Ќ
-    { 18, 28, 22, 2, 28, 126, 29320 }, // Ѝ
-    { 18, 28, 18, 0, 27, 126, 29446 }, // Ў
-    { 17, 26, 21, 2, 21, 111, 29572 }, // Џ
-    { 19, 21, 19, 0, 21, 100, 29683 }, // А
-    { 15, 21, 18, 2, 21, 79, 29783 }, // Б
-    { 16, 21, 19, 2, 21, 84, 29862 }, // В
-    { 13, 21, 15, 2, 21, 69, 29946 }, // Г
-    { 21, 26, 21, 0, 21, 137, 30015 }, // Д
-    { 13, 21, 16, 2, 21, 69, 30152 }, // Е
-    { 27, 21, 26, 0, 21, 142, 30221 }, // Ж
-    { 15, 23, 17, 1, 22, 87, 30363 }, // З
-    { 18, 21, 22, 2, 21, 95, 30450 }, // И
-    { 18, 27, 22, 2, 27, 122, 30545 }, // Й
-    { 16, 21, 18, 2, 21, 84, 30667 }, // К
-    { 18, 22, 20, 0, 21, 99, 30751 }, // Л
-    { 22, 21, 26, 2, 21, 116, 30850 }, // М
-    { 17, 21, 22, 2, 21, 90, 30966 }, // Н
-    { 20, 23, 22, 1, 22, 115, 31056 }, // О
-    { 17, 21, 21, 2, 21, 90, 31171 }, // П
-    { 15, 21, 18, 2, 21, 79, 31261 }, // Р
-    { 17, 23, 19, 1, 22, 98, 31340 }, // С
-    { 16, 21, 16, 0, 21, 84, 31438 }, // Т
-    { 18, 22, 18, 0, 21, 99, 31522 }, // У
-    { 22, 23, 24, 1, 22, 127, 31621 }, // Ф
-    { 17, 21, 17, 0, 21, 90, 31748 }, // Х
-    { 20, 26, 22, 2, 21, 130, 31838 }, // Ц
-    { 15, 21, 20, 2, 21, 79, 31968 }, // Ч
-    { 26, 21, 30, 2, 21, 137, 32047 }, // Ш
-    { 28, 26, 30, 2, 21, 182, 32184 }, // Щ
-    { 19, 21, 20, 0, 21, 100, 32366 }, // Ъ
-    { 20, 21, 25, 2, 21, 105, 32466 }, // Ы
-    { 15, 21, 18, 2, 21, 79, 32571 }, // Ь
-    { 17, 23, 19, 1, 22, 98, 32650 }, // Э
-    { 26, 23, 29, 2, 22, 150, 32748 }, // Ю
-    { 16, 21, 19, 0, 21, 84, 32898 }, // Я
-    { 13, 17, 16, 1, 16, 56, 32982 }, // а
-    { 16, 24, 17, 1, 23, 96, 33038 }, // б
-    { 14, 16, 16, 2, 16, 56, 33134 }, // в
-    { 11, 16, 13, 2, 16, 44, 33190 }, // г
-    { 18, 21, 18, 0, 16, 95, 33234 }, // д
-    { 14, 17, 16, 1, 16, 60, 33329 }, // е
-    { 22, 16, 22, 0, 16, 88, 33389 }, // ж
-    { 13, 17, 14, 0, 16, 56, 33477 }, // з
-    { 14, 16, 18, 2, 16, 56, 33533 }, // и
-    { 14, 22, 18, 2, 22, 77, 33589 }, // й
-    { 14, 16, 15, 2, 16, 56, 33666 }, // к
-    { 15, 17, 17, 0, 16, 64, 33722 }, // л
-    { 18, 16, 22, 2, 16, 72, 33786 }, // м
-    { 14, 16, 18, 2, 16, 56, 33858 }, // н
-    { 15, 17, 17, 1, 16, 64, 33914 }, // о
-    { 14, 16, 18, 2, 16, 56, 33978 }, // п
-    { 15, 23, 18, 2, 16, 87, 34034 }, // р
-    { 13, 17, 14, 1, 16, 56, 34121 }, // с
-    { 14, 16, 14, 0, 16, 56, 34177 }, // т
-    { 15, 23, 15, 0, 16, 87, 34233 }, // у
-    { 20, 30, 22, 1, 23, 150, 34320 }, // ф
-    { 15, 16, 15, 0, 16, 60, 34470 }, // х
-    { 16, 21, 18, 2, 16, 84, 34530 }, // ц
-    { 14, 16, 17, 1, 16, 56, 34614 }, // ч
-    { 22, 16, 26, 2, 16, 88, 34670 }, // ш
-    { 24, 21, 26, 2, 16, 126, 34758 }, // щ
-    { 17, 16, 18, 0, 16, 68, 34884 }, // ъ
-    { 18, 16, 22, 2, 16, 72, 34952 }, // ы
-    { 13, 16, 16, 2, 16, 52, 35024 }, // ь
-    { 13, 17, 14, 1, 16, 56, 35076 }, // э
-    { 20, 17, 23, 2, 16, 85, 35132 }, // ю
-    { 14, 16, 17, 1, 16, 56, 35217 }, // я
-    { 14, 24, 16, 1, 23, 84, 35273 }, // ѐ
-    { 14, 23, 16, 1, 22, 81, 35357 }, // ё
-    { 16, 30, 18, 0, 23, 120, 35438 }, // ђ
-    { 11, 23, 13, 2, 23, 64, 35558 }, // ѓ
-    { 13, 17, 14, 1, 16, 56, 35622 }, // є
-    { 12, 17, 14, 1, 16, 51, 35678 }, // ѕ
-    { 4, 22, 8, 2, 22, 22, 35729 }, // і
-    { 7, 22, 8, 0, 22, 39, 35751 }, // ї
-    { 8, 29, 8, -2, 22, 58, 35790 }, // ј
-    { 24, 17, 25, 0, 16, 102, 35848 }, // љ
-    { 23, 16, 26, 2, 16, 92, 35950 }, // њ
-    { 16, 23, 18, 0, 23, 92, 36042 }, // ћ
-    { 14, 23, 15, 2, 23, 81, 36134 }, // ќ
-    { 14, 23, 18, 2, 23, 81, 36215 }, // ѝ
-    { 15, 29, 15, 0, 22, 109, 36296 }, // ў
-    { 14, 21, 18, 2, 16, 74, 36405 }, // џ
-    { 27, 22, 27, 0, 21, 149, 36479 }, // Ѡ
-    { 23, 16, 23, 0, 16, 92, 36628 }, // ѡ
-    { 19, 21, 20, 0, 21, 100, 36720 }, // Ѣ
-    { 17, 19, 19, 0, 19, 81, 36820 }, // ѣ
-    { 25, 23, 27, 2, 22, 144, 36901 }, // Ѥ
-    { 19, 17, 22, 2, 16, 81, 37045 }, // ѥ
-    { 20, 21, 20, 0, 21, 105, 37126 }, // Ѧ
-    { 17, 16, 17, 0, 16, 68, 37231 }, // ѧ
-    { 26, 21, 27, 2, 21, 137, 37299 }, // Ѩ
-    { 21, 16, 23, 2, 16, 84, 37436 }, // ѩ
-    { 21, 21, 21, 0, 21, 111, 37520 }, // Ѫ
-    { 19, 16, 19, 0, 16, 76, 37631 }, // ѫ
-    { 27, 21, 29, 2, 21, 142, 37707 }, // Ѭ
-    { 23, 16, 25, 2, 16, 92, 37849 }, // ѭ
-    { 16, 32, 17, 0, 25, 128, 37941 }, // Ѯ
-    { 13, 26, 14, 0, 20, 85, 38069 }, // ѯ
-    { 20, 21, 23, 2, 21, 105, 38154 }, // Ѱ
-    { 18, 30, 22, 2, 23, 135, 38259 }, // ѱ
-    { 20, 23, 23, 1, 22, 115, 38394 }, // Ѳ
-    { 16, 17, 18, 1, 16, 68, 38509 }, // ѳ
-    { 20, 21, 19, 0, 21, 105, 38577 }, // Ѵ
-    { 16, 16, 15, 0, 16, 64, 38682 }, // ѵ
-    { 20, 28, 19, 0, 28, 140, 38746 }, // Ѷ
-    { 16, 23, 15, 0, 23, 92, 38886 }, // ѷ
-    { 35, 29, 36, 1, 22, 254, 38978 }, // Ѹ
-    { 31, 23, 32, 1, 16, 179, 39232 }, // ѹ
-    { 22, 25, 24, 1, 23, 138, 39411 }, // Ѻ
-    { 17, 20, 19, 1, 18, 85, 39549 }, // ѻ
-    { 28, 32, 30, 1, 31, 224, 39634 }, // Ѽ
-    { 24, 27, 26, 1, 26, 162, 39858 }, // ѽ
-    { 27, 27, 27, 0, 26, 183, 40020 }, // Ѿ
-    { 23, 21, 23, 0, 21, 121, 40203 }, // ѿ
-    { 17, 29, 19, 1, 22, 124, 40324 }, // Ҁ
-    { 13, 23, 14, 1, 16, 75, 40448 }, // ҁ
-    { 16, 20, 18, 1, 19, 80, 40523 }, // ҂
-    { 12, 5, 0, -14, 21, 15, 40603 }, // ҃
-    { 12, 5, 0, -14, 22, 15, 40618 }, // ҄
-    { 5, 6, 0, -11, 23, 8, 40633 }, // ҅
-    { 4, 6, 0, -10, 23, 6, 40641 }, // ҆
-    { 12, 4, 0, -6, 26, 12, 40647 }, // ҇
-    { 34, 31, 0, -17, 23, 264, 40659 }, // ҈
-    { 34, 33, 0, -17, 24, 281, 40923 }, // ҉
-    { 21, 33, 23, 2, 27, 174, 41204 }, // Ҋ
-    { 17, 29, 19, 2, 23, 124, 41378 }, // ҋ
-    { 17, 21, 18, 0, 21, 90, 41502 }, // Ҍ
-    { 16, 23, 17, 0, 23, 92, 41592 }, // ҍ
-    { 15, 21, 18, 2, 21, 79, 41684 }, // Ҏ
-    { 15, 23, 18, 2, 16, 87, 41763 }, // ҏ
-    { 13, 26, 16, 2, 26, 85, 41850 }, // Ґ
-    { 11, 21, 13, 2, 21, 58, 41935 }, // ґ
-    { 15, 21, 15, 0, 21, 79, 41993 }, // Ғ
-    { 13, 16, 13, 0, 16, 52, 42072 }, // ғ
-    { 16, 29, 19, 2, 21, 116, 42124 }, // Ҕ
-    { 13, 24, 16, 2, 16, 78, 42240 }, // ҕ
-    { 26, 27, 26, 0, 21, 176, 42318 }, // Җ
-    { 23, 22, 23, 0, 16, 127, 42494 }, // җ
-    { 15, 29, 17, 1, 22, 109, 42621 }, // Ҙ
-    { 13, 23, 14, 0, 16, 75, 42730 }, // ҙ
-    { 18, 27, 20, 2, 21, 122, 42805 }, // Қ
-    { 14, 22, 16, 2, 16, 77, 42927 }, // қ
-    { 17, 21, 18, 2, 21, 90, 43004 }, // Ҝ
-    { 14, 16, 15, 2, 16, 56, 43094 }, // ҝ
-    { 18, 21, 18, 0, 21, 95, 43150 }, // Ҟ
-    { 16, 23, 16, 0, 23, 92, 43245 }, // ҟ
-    { 21, 21, 20, 0, 21, 111, 43337 }, // Ҡ
-    { 19, 16, 18, 0, 16, 76, 43448 }, // ҡ
-    { 20, 27, 22, 2, 21, 135, 43524 }, // Ң
-    { 17, 22, 19, 2, 16, 94, 43659 }, // ң
-    { 22, 21, 24, 2, 21, 116, 43753 }, // Ҥ
-    { 20, 16, 22, 2, 16, 80, 43869 }, // ҥ
-    { 28, 29, 31, 2, 21, 203, 43949 }, // Ҧ
-    { 23, 24, 25, 2, 16, 138, 44152 }, // ҧ
-    { 21, 24, 23, 1, 22, 126, 44290 }, // Ҩ
-    { 17, 17, 19, 1, 16, 73, 44416 }, // ҩ
-    { 17, 29, 18, 1, 22, 124, 44489 }, // Ҫ
-    { 13, 23, 14, 1, 16, 75, 44613 }, // ҫ
-    { 16, 27, 16, 0, 21, 108, 44688 }, // Ҭ
-    { 14, 22, 14, 0, 16, 77, 44796 }, // ҭ
-    { 17, 21, 17, 0, 21, 90, 44873 }, // Ү
-    { 15, 23, 15, 0, 16, 87, 44963 }, // ү
-    { 17, 21, 17, 0, 21, 90, 45050 }, // Ұ
-    { 15, 23, 15, 0, 16, 87, 45140 }, // ұ
-    { 18, 27, 18, 0, 21, 122, 45227 }, // Ҳ
-    { 16, 22, 16, 0, 16, 88, 45349 }, // ҳ
-    { 25, 27, 25, 0, 21, 169, 45437 }, // Ҵ
-    { 21, 22, 21, 0, 16, 116, 45606 }, // ҵ
-    { 19, 27, 21, 2, 21, 129, 45722 }, // Ҷ
-    { 16, 22, 18, 2, 16, 88, 45851 }, // ҷ
-    { 16, 21, 20, 2, 21, 84, 45939 }, // Ҹ
-    { 14, 16, 18, 2, 16, 56, 46023 }, // ҹ
-    { 17, 21, 20, 2, 21, 90, 46079 }, // Һ
-    { 14, 23, 18, 2, 23, 81, 46169 }, // һ
-    { 24, 23, 25, 0, 22, 138, 46250 }, // Ҽ
-    { 18, 17, 19, 0, 16, 77, 46388 }, // ҽ
-    { 24, 28, 25, 0, 22, 168, 46465 }, // Ҿ
-    { 18, 22, 19, 0, 16, 99, 46633 }, // ҿ
-    { 8, 21, 10, 1, 21, 42, 46732 }, // Ӏ
-    { 27, 27, 26, 0, 27, 183, 46774 }, // Ӂ
-    { 22, 22, 22, 0, 22, 121, 46957 }, // ӂ
-    { 17, 29, 20, 2, 21, 124, 47078 }, // Ӄ
-    { 14, 24, 16, 2, 16, 84, 47202 }, // ӄ
-    { 21, 27, 21, 0, 21, 142, 47286 }, // Ӆ
-    { 18, 22, 17, 0, 16, 99, 47428 }, // ӆ
-    { 17, 29, 21, 2, 21, 124, 47527 }, // Ӈ
-    { 15, 24, 18, 2, 16, 90, 47651 }, // ӈ
-    { 20, 27, 22, 2, 21, 135, 47741 }, // Ӊ
-    { 17, 22, 19, 2, 16, 94, 47876 }, // ӊ
-    { 16, 27, 20, 2, 21, 108, 47970 }, // Ӌ
-    { 14, 22, 18, 2, 16, 77, 48078 }, // ӌ
-    { 25, 27, 27, 2, 21, 169, 48155 }, // Ӎ
-    { 20, 22, 22, 2, 16, 110, 48324 }, // ӎ
-    { 8, 21, 10, 1, 21, 42, 48434 }, // ӏ
-    { 19, 27, 19, 0, 27, 129, 48476 }, // Ӑ
-    { 13, 23, 16, 1, 22, 75, 48605 }, // ӑ
-    { 19, 27, 19, 0, 27, 129, 48680 }, // Ӓ
-    { 13, 23, 16, 1, 22, 75, 48809 }, // ӓ
-    { 25, 21, 26, -1, 21, 132, 48884 }, // Ӕ
-    { 23, 17, 25, 1, 16, 98, 49016 }, // ӕ
-    { 13, 27, 16, 2, 27, 88, 49114 }, // Ӗ
-    { 14, 23, 16, 1, 22, 81, 49202 }, // ӗ
-    { 19, 23, 22, 1, 22, 110, 49283 }, // Ә
-    { 14, 17, 16, 1, 16, 60, 49393 }, // ә
-    { 19, 28, 22, 1, 27, 133, 49453 }, // Ӛ
-    { 14, 23, 16, 1, 22, 81, 49586 }, // ӛ
-    { 27, 27, 26, 0, 27, 183, 49667 }, // Ӝ
-    { 22, 22, 22, 0, 22, 121, 49850 }, // ӝ
-    { 15, 28, 17, 1, 27, 105, 49971 }, // Ӟ
-    { 13, 23, 14, 0, 22, 75, 50076 }, // ӟ
-    { 15, 22, 17, 1, 21, 83, 50151 }, // Ӡ
-    { 14, 23, 15, 0, 16, 81, 50234 }, // ӡ
-    { 18, 25, 22, 2, 25, 113, 50315 }, // Ӣ
-    { 14, 20, 18, 2, 20, 70, 50428 }, // ӣ
-    { 18, 27, 22, 2, 27, 122, 50498 }, // Ӥ
-    { 14, 22, 18, 2, 22, 77, 50620 }, // ӥ
-    { 20, 28, 23, 1, 27, 140, 50697 }, // Ӧ
-    { 16, 23, 18, 1, 22, 92, 50837 }, // ӧ
-    { 20, 23, 23, 1, 22, 115, 50929 }, // Ө
-    { 16, 17, 18, 1, 16, 68, 51044 }, // ө
-    { 20, 28, 23, 1, 27, 140, 51112 }, // Ӫ
-    { 16, 23, 18, 1, 22, 92, 51252 }, // ӫ
-    { 17, 28, 19, 1, 27, 119, 51344 }, // Ӭ
-    { 13, 23, 14, 1, 22, 75, 51463 }, // ӭ
-    { 18, 26, 18, 0, 25, 117, 51538 }, // Ӯ
-    { 15, 27, 15, 0, 20, 102, 51655 }, // ӯ
-    { 18, 28, 18, 0, 27, 126, 51757 }, // Ӱ
-    { 15, 29, 15, 0, 22, 109, 51883 }, // ӱ
-    { 18, 29, 18, 0, 28, 131, 51992 }, // Ӳ
-    { 15, 30, 15, 0, 23, 113, 52123 }, // ӳ
-    { 15, 27, 20, 2, 27, 102, 52236 }, // Ӵ
-    { 14, 22, 17, 1, 22, 77, 52338 }, // ӵ
-    { 13, 27, 15, 2, 21, 88, 52415 }, // Ӷ
-    { 10, 22, 13, 2, 16, 55, 52503 }, // ӷ
-    { 20, 27, 25, 2, 27, 135, 52558 }, // Ӹ
-    { 18, 22, 22, 2, 22, 99, 52693 }, // ӹ
-    { 15, 27, 15, 0, 21, 102, 52792 }, // Ӻ
-    { 13, 22, 13, 0, 16, 72, 52894 }, // ӻ
-    { 18, 27, 18, 0, 21, 122, 52966 }, // Ӽ
-    { 16, 22, 16, 0, 16, 88, 53088 }, // ӽ
-    { 17, 21, 17, 0, 21, 90, 53176 }, // Ӿ
-    { 15, 16, 15, 0, 16, 60, 53266 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 53326 }, //  
-    { 0, 0, 29, 0, 0, 0, 53326 }, //  
-    { 0, 0, 15, 0, 0, 0, 53326 }, //  
-    { 0, 0, 29, 0, 0, 0, 53326 }, //  
-    { 0, 0, 10, 0, 0, 0, 53326 }, //  
-    { 0, 0, 7, 0, 0, 0, 53326 }, //  
-    { 0, 0, 5, 0, 0, 0, 53326 }, //  
-    { 0, 0, 17, 0, 0, 0, 53326 }, //  
-    { 0, 0, 8, 0, 0, 0, 53326 }, //  
-    { 0, 0, 5, 0, 0, 0, 53326 }, //  
-    { 0, 0, 3, 0, 0, 0, 53326 }, //  
-    { 0, 0, 0, 0, 0, 0, 53326 }, // ​
-    { 0, 0, 0, 0, 0, 0, 53326 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 53326 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 53326 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 53376 }, // ‏
-    { 8, 3, 9, 1, 9, 6, 53426 }, // ‐
-    { 8, 3, 9, 1, 9, 6, 53432 }, // ‑
-    { 15, 3, 17, 1, 12, 12, 53438 }, // ‒
-    { 13, 3, 15, 1, 9, 10, 53450 }, // –
-    { 27, 3, 29, 1, 9, 21, 53460 }, // —
-    { 27, 3, 29, 1, 9, 21, 53481 }, // ―
-    { 10, 31, 16, 3, 23, 78, 53502 }, // ‖
-    { 14, 7, 12, -1, 0, 25, 53580 }, // ‗
-    { 5, 8, 5, 0, 21, 10, 53605 }, // ‘
-    { 5, 8, 5, 0, 21, 10, 53615 }, // ’
-    { 6, 8, 7, 0, 4, 12, 53625 }, // ‚
-    { 5, 8, 5, 0, 21, 10, 53637 }, // ‛
-    { 11, 8, 10, 0, 21, 22, 53647 }, // “
-    { 11, 8, 10, 0, 21, 22, 53669 }, // ”
-    { 11, 8, 12, 0, 4, 22, 53691 }, // „
-    { 11, 8, 10, 0, 21, 22, 53713 }, // ‟
-    { 13, 23, 15, 1, 23, 75, 53735 }, // †
-    { 13, 23, 15, 1, 23, 75, 53810 }, // ‡
-    { 7, 8, 11, 2, 15, 14, 53885 }, // •
-    { 9, 10, 11, 1, 16, 23, 53899 }, // ‣
-    { 5, 5, 15, 5, 4, 7, 53922 }, // ․
-    { 12, 5, 16, 2, 4, 15, 53929 }, // ‥
-    { 19, 5, 23, 2, 4, 24, 53944 }, // …
-    { 4, 5, 8, 2, 10, 5, 53968 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 53973 }, //  
-    { 0, 0, 18, 0, 0, 0, 53973 }, //  
-    { 8, 22, 0, -1, 18, 44, 53973 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 54017 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 54061 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 54111 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 54161 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 54211 }, //  
-    { 32, 23, 34, 1, 22, 184, 54211 }, // ‰
-    { 43, 23, 45, 1, 22, 248, 54395 }, // ‱
-    { 7, 8, 7, 1, 21, 14, 54643 }, // ′
-    { 12, 8, 12, 1, 21, 24, 54657 }, // ″
-    { 17, 8, 17, 1, 21, 34, 54681 }, // ‴
-    { 7, 8, 7, -1, 21, 14, 54715 }, // ‵
-    { 12, 8, 13, -1, 21, 24, 54729 }, // ‶
-    { 17, 8, 18, -1, 21, 34, 54753 }, // ‷
-    { 12, 10, 12, 0, 3, 30, 54787 }, // ‸
-    { 7, 13, 9, 1, 14, 23, 54817 }, // ‹
-    { 7, 13, 9, 1, 14, 23, 54840 }, // ›
-    { 22, 23, 24, 1, 22, 127, 54863 }, // ※
-    { 11, 22, 15, 2, 21, 61, 54990 }, // ‼
-    { 13, 23, 13, 0, 22, 75, 55051 }, // ‽
-    { 16, 3, 15, -1, 25, 12, 55126 }, // ‾
-    { 18, 7, 18, 0, 0, 32, 55138 }, // ‿
-    { 18, 8, 18, 0, 24, 36, 55170 }, // ⁀
-    { 11, 19, 11, 0, 12, 53, 55206 }, // ⁁
-    { 33, 28, 33, 0, 23, 231, 55259 }, // ⁂
-    { 8, 3, 9, 1, 9, 6, 55490 }, // ⁃
-    { 16, 21, 4, -6, 21, 84, 55496 }, // ⁄
-    { 7, 26, 9, 2, 21, 46, 55580 }, // ⁅
-    { 8, 26, 9, 0, 21, 52, 55626 }, // ⁆
-    { 25, 23, 25, 0, 22, 144, 55678 }, // ⁇
-    { 18, 23, 20, 0, 22, 104, 55822 }, // ⁈
-    { 18, 23, 20, 2, 22, 104, 55926 }, // ⁉
-    { 15, 16, 17, 1, 16, 60, 56030 }, // ⁊
-    { 16, 27, 19, 2, 23, 108, 56090 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 56198 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 56258 }, // ⁍
-    { 14, 14, 16, 1, 8, 49, 56318 }, // ⁎
-    { 6, 21, 7, 1, 17, 32, 56367 }, // ⁏
-    { 18, 31, 18, 0, 24, 140, 56399 }, // ⁐
-    { 14, 29, 16, 1, 23, 102, 56539 }, // ⁑
-    { 11, 23, 11, 0, 22, 64, 56641 }, // ⁒
-    { 25, 5, 29, 2, 11, 32, 56705 }, // ⁓
-    { 18, 7, 18, 0, 0, 32, 56737 }, // ⁔
-    { 16, 16, 17, 0, 15, 64, 56769 }, // ⁕
-    { 13, 23, 15, 1, 22, 75, 56833 }, // ⁖
-    { 22, 8, 22, 1, 21, 44, 56908 }, // ⁗
-    { 22, 23, 24, 1, 22, 127, 56952 }, // ⁘
-    { 22, 23, 24, 1, 22, 127, 57079 }, // ⁙
-    { 4, 23, 6, 1, 22, 23, 57206 }, // ⁚
-    { 17, 23, 19, 1, 22, 98, 57229 }, // ⁛
-    { 22, 23, 23, 1, 22, 127, 57327 }, // ⁜
-    { 4, 22, 8, 2, 21, 22, 57454 }, // ⁝
-    { 4, 23, 8, 2, 22, 23, 57476 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 57499 }, //  
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 57499 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 57549 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 57599 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 57649 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 57699 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 57749 }, // ⁯
-    { 10, 14, 10, 0, 25, 35, 57799 }, // ⁰
-    { 3, 14, 5, 1, 22, 11, 57834 }, // ⁱ
-    { 10, 13, 10, 0, 25, 33, 57845 }, // ⁴
-    { 10, 14, 10, 0, 25, 35, 57878 }, // ⁵
-    { 10, 14, 10, 0, 25, 35, 57913 }, // ⁶
-    { 10, 13, 10, 0, 25, 33, 57948 }, // ⁷
-    { 10, 14, 10, 0, 25, 35, 57981 }, // ⁸
-    { 10, 14, 10, 0, 25, 35, 58016 }, // ⁹
-    { 8, 9, 10, 1, 22, 18, 58051 }, // ⁺
-    { 8, 3, 10, 1, 19, 6, 58069 }, // ⁻
-    { 8, 6, 10, 1, 20, 12, 58075 }, // ⁼
-    { 6, 17, 7, 1, 27, 26, 58087 }, // ⁽
-    { 5, 17, 7, 0, 27, 22, 58113 }, // ⁾
-    { 10, 10, 12, 1, 18, 25, 58135 }, // ⁿ
-    { 10, 14, 10, 0, 9, 35, 58160 }, // ₀
-    { 6, 13, 10, 1, 9, 20, 58195 }, // ₁
-    { 9, 13, 10, 0, 9, 30, 58215 }, // ₂
-    { 10, 14, 10, 0, 9, 35, 58245 }, // ₃
-    { 10, 13, 10, 0, 9, 33, 58280 }, // ₄
-    { 10, 14, 10, 0, 9, 35, 58313 }, // ₅
-    { 10, 14, 10, 0, 9, 35, 58348 }, // ₆
-    { 10, 13, 10, 0, 9, 33, 58383 }, // ₇
-    { 10, 14, 10, 0, 9, 35, 58416 }, // ₈
-    { 10, 14, 10, 0, 9, 35, 58451 }, // ₉
-    { 8, 9, 10, 1, 6, 18, 58486 }, // ₊
-    { 8, 3, 10, 1, 3, 6, 58504 }, // ₋
-    { 8, 6, 10, 1, 4, 12, 58510 }, // ₌
-    { 6, 17, 7, 1, 11, 26, 58522 }, // ₍
-    { 5, 17, 7, 0, 11, 22, 58548 }, // ₎
-    { 10, 10, 11, 0, 7, 25, 58570 }, // ₐ
-    { 9, 10, 11, 1, 7, 23, 58595 }, // ₑ
-    { 10, 10, 11, 1, 7, 25, 58618 }, // ₒ
-    { 10, 10, 10, 0, 7, 25, 58643 }, // ₓ
-    { 10, 10, 11, 0, 7, 25, 58668 }, // ₔ
-    { 10, 14, 12, 1, 11, 35, 58693 }, // ₕ
-    { 9, 14, 10, 1, 11, 32, 58728 }, // ₖ
-    { 3, 14, 5, 1, 11, 11, 58760 }, // ₗ
-    { 16, 10, 18, 1, 7, 40, 58771 }, // ₘ
-    { 10, 10, 12, 1, 7, 25, 58811 }, // ₙ
-    { 10, 14, 12, 1, 7, 35, 58836 }, // ₚ
-    { 9, 10, 9, 0, 7, 23, 58871 }, // ₛ
-    { 7, 12, 7, 0, 9, 21, 58894 }, // ₜ
-    { 15, 22, 17, 1, 22, 83, 58915 }, // ₠
-    { 16, 25, 17, 1, 23, 100, 58998 }, // ₡
-    { 15, 23, 17, 1, 22, 87, 59098 }, // ₢
-    { 15, 21, 17, 1, 21, 79, 59185 }, // ₣
-    { 16, 22, 17, 0, 22, 88, 59264 }, // ₤
-    { 23, 24, 27, 2, 20, 138, 59352 }, // ₥
-    { 17, 21, 17, 0, 21, 90, 59490 }, // ₦
-    { 20, 22, 23, 2, 21, 110, 59580 }, // ₧
-    { 22, 22, 24, 2, 21, 121, 59690 }, // ₨
-    { 20, 21, 20, 0, 21, 105, 59811 }, // ₩
-    { 19, 21, 23, 2, 21, 100, 59916 }, // ₪
-    { 17, 28, 18, 1, 23, 119, 60016 }, // ₫
-    { 17, 23, 17, 0, 22, 98, 60135 }, // €
-    { 17, 21, 17, 0, 21, 90, 60233 }, // ₭
-    { 17, 21, 17, 0, 21, 90, 60323 }, // ₮
-    { 28, 29, 28, 0, 22, 203, 60413 }, // ₯
-    { 16, 29, 17, 0, 22, 116, 60616 }, // ₰
-    { 17, 21, 17, 0, 21, 90, 60732 }, // ₱
-    { 19, 26, 21, 1, 23, 124, 60822 }, // ₲
-    { 18, 21, 18, 0, 21, 95, 60946 }, // ₳
-    { 16, 23, 16, 0, 22, 92, 61041 }, // ₴
-    { 17, 26, 18, 1, 23, 111, 61133 }, // ₵
-    { 18, 21, 18, 0, 20, 95, 61244 }, // ₶
-    { 20, 25, 21, 0, 22, 125, 61339 }, // ₷
-    { 16, 21, 16, 0, 21, 84, 61464 }, // ₸
-    { 13, 21, 17, 2, 21, 69, 61548 }, // ₹
-    { 16, 22, 17, 0, 21, 88, 61617 }, // ₺
-    { 23, 23, 23, 0, 22, 133, 61705 }, // ₻
-    { 21, 21, 24, 1, 21, 111, 61838 }, // ₼
-    { 16, 21, 17, 0, 21, 84, 61949 }, // ₽
-    { 20, 23, 22, 1, 23, 115, 62033 }, // ₾
-    { 14, 27, 17, 2, 24, 95, 62148 }, // ₿
-    { 12, 21, 14, 1, 16, 63, 62243 }, // ⃀
-    { 15, 3, 17, 1, 12, 12, 62306 }, // −
-    { 27, 28, 29, 1, 23, 189, 62318 }, // �
+    { 19, 21, 19, 0, 21, 100, 2048 }, // A
+    { 16, 21, 19, 2, 21, 84, 2148 }, // B
+    { 17, 23, 18, 1, 22, 98, 2232 }, // C
+    { 18, 21, 21, 2, 21, 95, 2330 }, // D
+    { 13, 21, 16, 2, 21, 69, 2425 }, // E
+    { 13, 21, 15, 2, 21, 69, 2494 }, // F
+    { 19, 23, 21, 1, 22, 110, 2563 }, // G
+    { 17, 21, 22, 2, 21, 90, 2673 }, // H
+    { 8, 21, 10, 1, 21, 42, 2763 }, // I
+    { 9, 27, 8, -3, 21, 61, 2805 }, // J
+    { 17, 21, 18, 2, 21, 90, 2866 }, // K
+    { 13, 21, 15, 2, 21, 69, 2956 }, // L
+    { 22, 21, 26, 2, 21, 116, 3025 }, // M
+    { 18, 21, 22, 2, 21, 95, 3141 }, // N
+    { 20, 23, 23, 1, 22, 115, 3236 }, // O
+    { 15, 21, 18, 2, 21, 79, 3351 }, // P
+    { 20, 27, 23, 1, 22, 135, 3430 }, // Q
+    { 16, 21, 18, 2, 21, 84, 3565 }, // R
+    { 14, 23, 16, 1, 22, 81, 3649 }, // S
+    { 16, 21, 16, 0, 21, 84, 3730 }, // T
+    { 17, 22, 21, 2, 21, 94, 3814 }, // U
+    { 18, 21, 18, 0, 21, 95, 3908 }, // V
+    { 27, 21, 27, 0, 21, 142, 4096 }, // W
+    { 17, 21, 17, 0, 21, 90, 4238 }, // X
+    { 17, 21, 17, 0, 21, 90, 4328 }, // Y
+    { 15, 21, 17, 1, 21, 79, 4418 }, // Z
+    { 7, 26, 10, 2, 21, 46, 4497 }, // [
+    { 11, 21, 11, 0, 21, 58, 4543 }, // <backslash>
+    { 8, 26, 10, 0, 21, 52, 4601 }, // ]
+    { 15, 14, 17, 1, 21, 53, 4653 }, // ^
+    { 15, 3, 13, -1, -2, 12, 4706 }, // _
+    { 7, 6, 8, 1, 23, 11, 4718 }, // `
+    { 13, 17, 16, 1, 16, 56, 4729 }, // a
+    { 15, 24, 18, 2, 23, 90, 4785 }, // b
+    { 13, 17, 14, 1, 16, 56, 4875 }, // c
+    { 15, 24, 18, 1, 23, 90, 4931 }, // d
+    { 14, 17, 16, 1, 16, 60, 5021 }, // e
+    { 12, 23, 10, 0, 23, 69, 5081 }, // f
+    { 15, 23, 18, 1, 16, 87, 5150 }, // g
+    { 14, 23, 18, 2, 23, 81, 5237 }, // h
+    { 4, 22, 8, 2, 22, 22, 5318 }, // i
+    { 8, 29, 8, -2, 22, 58, 5340 }, // j
+    { 14, 23, 16, 2, 23, 81, 5398 }, // k
+    { 4, 23, 8, 2, 23, 23, 5479 }, // l
+    { 23, 16, 27, 2, 16, 92, 5502 }, // m
+    { 14, 16, 18, 2, 16, 56, 5594 }, // n
+    { 16, 17, 18, 1, 16, 68, 5650 }, // o
+    { 15, 23, 18, 2, 16, 87, 5718 }, // p
+    { 15, 23, 18, 1, 16, 87, 5805 }, // q
+    { 10, 16, 12, 2, 16, 40, 5892 }, // r
+    { 12, 17, 14, 1, 16, 51, 5932 }, // s
+    { 10, 21, 11, 0, 20, 53, 5983 }, // t
+    { 14, 17, 18, 2, 16, 60, 6036 }, // u
+    { 15, 16, 15, 0, 16, 60, 6144 }, // v
+    { 23, 16, 23, 0, 16, 92, 6204 }, // w
+    { 15, 16, 15, 0, 16, 60, 6296 }, // x
+    { 15, 23, 15, 0, 16, 87, 6356 }, // y
+    { 12, 16, 14, 1, 16, 48, 6443 }, // z
+    { 11, 26, 11, 0, 21, 72, 6491 }, // {
+    { 4, 31, 16, 6, 23, 31, 6563 }, // |
+    { 11, 26, 11, 0, 21, 72, 6594 }, // }
+    { 15, 5, 17, 1, 13, 19, 6666 }, // ~
+    { 0, 0, 8, 0, 0, 0, 6685 }, //  
+    { 4, 22, 8, 2, 16, 22, 6685 }, // ¡
+    { 13, 23, 17, 2, 22, 75, 6707 }, // ¢
+    { 16, 22, 17, 0, 22, 88, 6782 }, // £
+    { 14, 14, 17, 1, 17, 49, 6870 }, // ¤
+    { 17, 21, 17, 0, 21, 90, 6919 }, // ¥
+    { 4, 31, 16, 6, 23, 31, 7009 }, // ¦
+    { 13, 24, 15, 1, 23, 78, 7040 }, // §
+    { 9, 4, 17, 4, 22, 9, 7118 }, // ¨
+    { 22, 23, 24, 1, 22, 127, 7127 }, // ©
+    { 9, 11, 10, 0, 22, 25, 7254 }, // ª
+    { 13, 13, 15, 1, 14, 43, 7279 }, // «
+    { 15, 9, 17, 1, 12, 34, 7322 }, // ¬
+    { 8, 3, 9, 1, 9, 6, 7356 }, // ­
+    { 22, 23, 24, 1, 22, 127, 7362 }, // ®
+    { 16, 3, 15, -1, 25, 12, 7489 }, // ¯
+    { 10, 10, 12, 1, 22, 25, 7501 }, // °
+    { 15, 18, 17, 1, 18, 68, 7526 }, // ±
+    { 9, 13, 10, 0, 25, 30, 7594 }, // ²
+    { 10, 14, 10, 0, 25, 35, 7624 }, // ³
+    { 7, 6, 8, 1, 23, 11, 7659 }, // ´
+    { 14, 23, 18, 2, 16, 81, 7670 }, // µ
+    { 16, 27, 19, 1, 23, 108, 7751 }, // ¶
+    { 4, 5, 8, 2, 13, 5, 7859 }, // ·
+    { 7, 7, 7, 0, 0, 13, 7864 }, // ¸
+    { 6, 13, 10, 1, 25, 20, 7877 }, // ¹
+    { 11, 11, 11, 0, 22, 31, 7897 }, // º
+    { 13, 13, 15, 1, 14, 43, 7928 }, // »
+    { 22, 21, 22, 0, 21, 116, 7971 }, // ¼
+    { 22, 21, 22, 0, 21, 116, 8192 }, // ½
+    { 23, 22, 23, 0, 22, 127, 8308 }, // ¾
+    { 13, 22, 13, 0, 16, 72, 8435 }, // ¿
+    { 19, 28, 19, 0, 28, 133, 8507 }, // À
+    { 19, 28, 19, 0, 28, 133, 8640 }, // Á
+    { 19, 28, 19, 0, 28, 133, 8773 }, // Â
+    { 19, 27, 19, 0, 27, 129, 8906 }, // Ã
+    { 19, 27, 19, 0, 27, 129, 9035 }, // Ä
+    { 19, 26, 19, 0, 26, 124, 9164 }, // Å
+    { 25, 21, 26, -1, 21, 132, 9288 }, // Æ
+    { 17, 29, 18, 1, 22, 124, 9420 }, // Ç
+    { 13, 28, 16, 2, 28, 91, 9544 }, // È
+    { 13, 28, 16, 2, 28, 91, 9635 }, // É
+    { 13, 28, 16, 2, 28, 91, 9726 }, // Ê
+    { 13, 27, 16, 2, 27, 88, 9817 }, // Ë
+    { 8, 28, 10, 1, 28, 56, 9905 }, // Ì
+    { 9, 28, 10, 1, 28, 63, 9961 }, // Í
+    { 10, 28, 10, 0, 28, 70, 10024 }, // Î
+    { 10, 27, 10, 0, 27, 68, 10094 }, // Ï
+    { 20, 21, 21, 0, 21, 105, 10240 }, // Ð
+    { 18, 27, 22, 2, 27, 122, 10345 }, // Ñ
+    { 20, 29, 23, 1, 28, 145, 10467 }, // Ò
+    { 20, 29, 23, 1, 28, 145, 10612 }, // Ó
+    { 20, 29, 23, 1, 28, 145, 10757 }, // Ô
+    { 20, 28, 23, 1, 27, 140, 10902 }, // Õ
+    { 20, 28, 23, 1, 27, 140, 11042 }, // Ö
+    { 14, 14, 17, 1, 17, 49, 11182 }, // ×
+    { 20, 23, 23, 1, 22, 115, 11231 }, // Ø
+    { 17, 29, 21, 2, 28, 124, 11346 }, // Ù
+    { 17, 29, 21, 2, 28, 124, 11470 }, // Ú
+    { 17, 29, 21, 2, 28, 124, 11594 }, // Û
+    { 17, 28, 21, 2, 27, 119, 11718 }, // Ü
+    { 17, 28, 17, 0, 28, 119, 11837 }, // Ý
+    { 15, 21, 18, 2, 21, 79, 11956 }, // Þ
+    { 16, 24, 18, 2, 23, 96, 12035 }, // ß
+    { 13, 24, 16, 1, 23, 78, 12131 }, // à
+    { 13, 24, 16, 1, 23, 78, 12209 }, // á
+    { 13, 24, 16, 1, 23, 78, 12288 }, // â
+    { 13, 23, 16, 1, 22, 75, 12366 }, // ã
+    { 13, 23, 16, 1, 22, 75, 12441 }, // ä
+    { 13, 25, 16, 1, 24, 82, 12516 }, // å
+    { 23, 17, 25, 1, 16, 98, 12598 }, // æ
+    { 13, 23, 14, 1, 16, 75, 12696 }, // ç
+    { 14, 24, 16, 1, 23, 84, 12771 }, // è
+    { 14, 24, 16, 1, 23, 84, 12855 }, // é
+    { 14, 24, 16, 1, 23, 84, 12939 }, // ê
+    { 14, 23, 16, 1, 22, 81, 13023 }, // ë
+    { 7, 23, 8, -1, 23, 41, 13104 }, // ì
+    { 7, 23, 8, 2, 23, 41, 13145 }, // í
+    { 11, 23, 8, -2, 23, 64, 13186 }, // î
+    { 9, 22, 8, -1, 22, 50, 13250 }, // ï
+    { 16, 24, 18, 1, 23, 96, 13300 }, // ð
+    { 14, 22, 18, 2, 22, 77, 13396 }, // ñ
+    { 16, 24, 18, 1, 23, 96, 13473 }, // ò
+    { 16, 24, 18, 1, 23, 96, 13569 }, // ó
+    { 16, 24, 18, 1, 23, 96, 13665 }, // ô
+    { 16, 23, 18, 1, 22, 92, 13761 }, // õ
+    { 16, 23, 18, 1, 22, 92, 13853 }, // ö
+    { 15, 14, 17, 1, 17, 53, 13945 }, // ÷
+    { 16, 18, 18, 1, 17, 72, 13998 }, // ø
+    { 14, 24, 18, 2, 23, 84, 14070 }, // ù
+    { 14, 24, 18, 2, 23, 84, 14154 }, // ú
+    { 14, 24, 18, 2, 23, 84, 14238 }, // û
+    { 14, 23, 18, 2, 22, 81, 14336 }, // ü
+    { 15, 30, 15, 0, 23, 113, 14417 }, // ý
+    { 15, 30, 18, 2, 23, 113, 14530 }, // þ
+    { 15, 29, 15, 0, 22, 109, 14643 }, // ÿ
+    { 19, 25, 19, 0, 25, 119, 14752 }, // Ā
+    { 13, 21, 16, 1, 20, 69, 14871 }, // ā
+    { 19, 27, 19, 0, 27, 129, 14940 }, // Ă
+    { 13, 23, 16, 1, 22, 75, 15069 }, // ă
+    { 19, 28, 19, 0, 21, 133, 15144 }, // Ą
+    { 14, 23, 16, 1, 16, 81, 15277 }, // ą
+    { 17, 29, 18, 1, 28, 124, 15358 }, // Ć
+    { 13, 24, 14, 1, 23, 78, 15482 }, // ć
+    { 17, 29, 18, 1, 28, 124, 15560 }, // Ĉ
+    { 13, 24, 14, 1, 23, 78, 15684 }, // ĉ
+    { 17, 28, 18, 1, 27, 119, 15762 }, // Ċ
+    { 13, 23, 14, 1, 22, 75, 15881 }, // ċ
+    { 17, 29, 18, 1, 28, 124, 15956 }, // Č
+    { 13, 24, 14, 1, 23, 78, 16080 }, // č
+    { 18, 28, 21, 2, 28, 126, 16158 }, // Ď
+    { 20, 24, 18, 1, 23, 120, 16384 }, // ď
+    { 20, 21, 21, 0, 21, 105, 16504 }, // Đ
+    { 17, 24, 18, 1, 23, 102, 16609 }, // đ
+    { 13, 25, 16, 2, 25, 82, 16711 }, // Ē
+    { 14, 21, 16, 1, 20, 74, 16793 }, // ē
+    { 13, 27, 16, 2, 27, 88, 16867 }, // Ĕ
+    { 14, 23, 16, 1, 22, 81, 16955 }, // ĕ
+    { 13, 27, 16, 2, 27, 88, 17036 }, // Ė
+    { 14, 23, 16, 1, 22, 81, 17124 }, // ė
+    { 13, 28, 16, 2, 21, 91, 17205 }, // Ę
+    { 14, 23, 16, 1, 16, 81, 17296 }, // ę
+    { 13, 28, 16, 2, 28, 91, 17377 }, // Ě
+    { 14, 24, 16, 1, 23, 84, 17468 }, // ě
+    { 19, 29, 21, 1, 28, 138, 17552 }, // Ĝ
+    { 15, 30, 18, 1, 23, 113, 17690 }, // ĝ
+    { 19, 28, 21, 1, 27, 133, 17803 }, // Ğ
+    { 15, 29, 18, 1, 22, 109, 17936 }, // ğ
+    { 19, 28, 21, 1, 27, 133, 18045 }, // Ġ
+    { 15, 29, 18, 1, 22, 109, 18178 }, // ġ
+    { 19, 29, 21, 1, 22, 138, 18287 }, // Ģ
+    { 15, 30, 18, 1, 23, 113, 18432 }, // ģ
+    { 17, 28, 22, 2, 28, 119, 18545 }, // Ĥ
+    { 18, 30, 18, -2, 30, 135, 18664 }, // ĥ
+    { 22, 21, 22, 0, 21, 116, 18799 }, // Ħ
+    { 16, 23, 18, 0, 23, 92, 18915 }, // ħ
+    { 12, 27, 10, -1, 27, 81, 19007 }, // Ĩ
+    { 12, 22, 8, -2, 22, 66, 19088 }, // ĩ
+    { 10, 25, 10, 0, 25, 63, 19154 }, // Ī
+    { 10, 20, 8, -1, 20, 50, 19217 }, // ī
+    { 10, 27, 10, 0, 27, 68, 19267 }, // Ĭ
+    { 10, 22, 8, -1, 22, 55, 19335 }, // ĭ
+    { 8, 28, 10, 1, 21, 56, 19390 }, // Į
+    { 6, 29, 8, 0, 22, 44, 19446 }, // į
+    { 8, 27, 10, 1, 27, 54, 19490 }, // İ
+    { 4, 16, 8, 2, 16, 16, 19544 }, // ı
+    { 15, 27, 18, 1, 21, 102, 19560 }, // Ĳ
+    { 11, 29, 15, 2, 22, 80, 19662 }, // ĳ
+    { 12, 34, 8, -3, 28, 102, 19742 }, // Ĵ
+    { 11, 30, 8, -2, 23, 83, 19844 }, // ĵ
+    { 17, 28, 18, 2, 21, 119, 19927 }, // Ķ
+    { 14, 30, 16, 2, 23, 105, 20046 }, // ķ
+    { 14, 16, 16, 2, 16, 56, 20151 }, // ĸ
+    { 13, 28, 15, 2, 28, 91, 20207 }, // Ĺ
+    { 7, 30, 8, 2, 30, 53, 20298 }, // ĺ
+    { 13, 28, 15, 2, 21, 91, 20351 }, // Ļ
+    { 5, 30, 8, 1, 23, 38, 20442 }, // ļ
+    { 13, 21, 15, 2, 21, 69, 20480 }, // Ľ
+    { 8, 23, 8, 2, 23, 46, 20549 }, // ľ
+    { 13, 21, 15, 2, 21, 69, 20595 }, // Ŀ
+    { 8, 23, 8, 2, 23, 46, 20664 }, // ŀ
+    { 15, 21, 15, 0, 21, 79, 20710 }, // Ł
+    { 9, 23, 8, -1, 23, 52, 20789 }, // ł
+    { 18, 28, 22, 2, 28, 126, 20841 }, // Ń
+    { 14, 23, 18, 2, 23, 81, 20967 }, // ń
+    { 18, 28, 22, 2, 21, 126, 21048 }, // Ņ
+    { 14, 23, 18, 2, 16, 81, 21174 }, // ņ
+    { 18, 28, 22, 2, 28, 126, 21255 }, // Ň
+    { 14, 23, 18, 2, 23, 81, 21381 }, // ň
+    { 18, 21, 20, 0, 21, 95, 21462 }, // ŉ
+    { 18, 27, 22, 2, 21, 122, 21557 }, // Ŋ
+    { 14, 23, 18, 2, 16, 81, 21679 }, // ŋ
+    { 20, 26, 23, 1, 25, 130, 21760 }, // Ō
+    { 16, 21, 18, 1, 20, 84, 21890 }, // ō
+    { 20, 28, 23, 1, 27, 140, 21974 }, // Ŏ
+    { 16, 23, 18, 1, 22, 92, 22114 }, // ŏ
+    { 20, 29, 23, 1, 28, 145, 22206 }, // Ő
+    { 16, 24, 18, 1, 23, 96, 22351 }, // ő
+    { 25, 23, 27, 1, 22, 144, 22528 }, // Œ
+    { 26, 17, 28, 1, 16, 111, 22672 }, // œ
+    { 16, 28, 18, 2, 28, 112, 22783 }, // Ŕ
+    { 10, 23, 12, 2, 23, 58, 22895 }, // ŕ
+    { 16, 28, 18, 2, 21, 112, 22953 }, // Ŗ
+    { 11, 23, 12, 1, 16, 64, 23065 }, // ŗ
+    { 16, 28, 18, 2, 28, 112, 23129 }, // Ř
+    { 10, 23, 12, 2, 23, 58, 23241 }, // ř
+    { 14, 29, 16, 1, 28, 102, 23299 }, // Ś
+    { 12, 24, 14, 1, 23, 72, 23401 }, // ś
+    { 14, 29, 16, 1, 28, 102, 23473 }, // Ŝ
+    { 12, 24, 14, 1, 23, 72, 23575 }, // ŝ
+    { 14, 29, 16, 1, 22, 102, 23647 }, // Ş
+    { 12, 23, 14, 1, 16, 69, 23749 }, // ş
+    { 14, 29, 16, 1, 28, 102, 23818 }, // Š
+    { 12, 24, 14, 1, 23, 72, 23920 }, // š
+    { 16, 28, 16, 0, 21, 112, 23992 }, // Ţ
+    { 10, 27, 11, 0, 20, 68, 24104 }, // ţ
+    { 16, 28, 16, 0, 28, 112, 24172 }, // Ť
+    { 14, 24, 11, 0, 23, 84, 24284 }, // ť
+    { 16, 21, 16, 0, 21, 84, 24368 }, // Ŧ
+    { 10, 21, 11, 0, 20, 53, 24452 }, // ŧ
+    { 17, 28, 21, 2, 27, 119, 24576 }, // Ũ
+    { 14, 23, 18, 2, 22, 81, 24695 }, // ũ
+    { 17, 26, 21, 2, 25, 111, 24776 }, // Ū
+    { 14, 21, 18, 2, 20, 74, 24887 }, // ū
+    { 17, 28, 21, 2, 27, 119, 24961 }, // Ŭ
+    { 14, 23, 18, 2, 22, 81, 25080 }, // ŭ
+    { 17, 30, 21, 2, 29, 128, 25161 }, // Ů
+    { 14, 25, 18, 2, 24, 88, 25289 }, // ů
+    { 17, 29, 21, 2, 28, 124, 25377 }, // Ű
+    { 14, 24, 18, 2, 23, 84, 25501 }, // ű
+    { 17, 28, 21, 2, 21, 119, 25585 }, // Ų
+    { 14, 23, 18, 2, 16, 81, 25704 }, // ų
+    { 27, 28, 27, 0, 28, 189, 25785 }, // Ŵ
+    { 23, 23, 23, 0, 23, 133, 25974 }, // ŵ
+    { 17, 28, 17, 0, 28, 119, 26107 }, // Ŷ
+    { 15, 30, 15, 0, 23, 113, 26226 }, // ŷ
+    { 17, 27, 17, 0, 27, 115, 26339 }, // Ÿ
+    { 15, 28, 17, 1, 28, 105, 26454 }, // Ź
+    { 12, 23, 14, 1, 23, 69, 26624 }, // ź
+    { 15, 27, 17, 1, 27, 102, 26693 }, // Ż
+    { 12, 22, 14, 1, 22, 66, 26795 }, // ż
+    { 15, 28, 17, 1, 28, 105, 26861 }, // Ž
+    { 12, 23, 14, 1, 23, 69, 26966 }, // ž
+    { 9, 23, 10, 2, 23, 52, 27035 }, // ſ
+    { 7, 6, 0, -15, 23, 11, 27087 }, // ̀
+    { 7, 6, 0, -10, 23, 11, 27098 }, // ́
+    { 10, 6, 0, -5, 23, 15, 27109 }, // ̂
+    { 12, 5, 0, -15, 22, 15, 27124 }, // ̃
+    { 10, 3, 0, -5, 20, 8, 27139 }, // ̄
+    { 14, 3, 0, -7, 25, 11, 27147 }, // ̅
+    { 10, 5, 0, -5, 22, 13, 27158 }, // ̆
+    { 4, 4, 0, -2, 22, 4, 27171 }, // ̇
+    { 10, 4, 0, -5, 22, 10, 27175 }, // ̈
+    { 6, 7, 0, -11, 24, 11, 27185 }, // ̉
+    { 8, 7, 0, -4, 24, 14, 27196 }, // ̊
+    { 11, 6, 0, -4, 23, 17, 27210 }, // ̋
+    { 10, 6, 0, -5, 23, 15, 27227 }, // ̌
+    { 4, 6, 0, -2, 23, 6, 27242 }, // ̍
+    { 8, 6, 0, -4, 23, 12, 27248 }, // ̎
+    { 12, 6, 0, -16, 23, 18, 27260 }, // ̏
+    { 10, 8, 0, -5, 25, 20, 27278 }, // ̐
+    { 10, 5, 0, -5, 22, 13, 27298 }, // ̑
+    { 6, 8, 0, -3, 21, 12, 27311 }, // ̒
+    { 6, 8, 0, -3, 21, 12, 27323 }, // ̓
+    { 6, 8, 0, -3, 21, 12, 27335 }, // ̔
+    { 6, 8, 0, -3, 21, 12, 27347 }, // ̕
+    { 6, 6, 0, -3, -1, 9, 27359 }, // ̖
+    { 6, 6, 0, -3, -1, 9, 27368 }, // ̗
+    { 6, 7, 0, -3, 0, 11, 27377 }, // ̘
+    { 6, 7, 0, -3, 0, 11, 27388 }, // ̙
+    { 8, 8, 9, 0, 23, 16, 27399 }, // ̚
+    { 7, 7, 0, -3, 23, 13, 27415 }, // ̛
+    { 4, 7, 0, -2, 0, 7, 27428 }, // ̜
+    { 8, 6, 0, -4, -1, 12, 27435 }, // ̝
+    { 8, 6, 0, -4, -1, 12, 27447 }, // ̞
+    { 8, 7, 0, -4, 0, 14, 27459 }, // ̟
+    { 8, 3, 0, -4, -3, 6, 27473 }, // ̠
+    { 6, 9, 0, -6, 2, 14, 27479 }, // ̡
+    { 6, 9, 0, 0, 2, 14, 27493 }, // ̢
+    { 4, 5, 0, -11, -1, 5, 27507 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 27512 }, // ̤
+    { 8, 7, 0, -4, 0, 14, 27522 }, // ̥
+    { 4, 6, 0, -2, -1, 6, 27536 }, // ̦
+    { 6, 7, 0, -3, 0, 11, 27542 }, // ̧
+    { 6, 8, 0, -3, 1, 12, 27553 }, // ̨
+    { 4, 6, 0, -2, 0, 6, 27565 }, // ̩
+    { 12, 6, 0, -6, -1, 18, 27571 }, // ̪
+    { 12, 5, 0, -6, -1, 15, 27589 }, // ̫
+    { 10, 6, 0, -5, 0, 15, 27604 }, // ̬
+    { 10, 6, 0, -5, -1, 15, 27619 }, // ̭
+    { 10, 5, 0, -5, -1, 13, 27634 }, // ̮
+    { 10, 5, 0, -5, -1, 13, 27647 }, // ̯
+    { 12, 5, 0, -6, -1, 15, 27660 }, // ̰
+    { 10, 3, 0, -5, -2, 8, 27675 }, // ̱
+    { 14, 3, 0, -7, -2, 11, 27683 }, // ̲
+    { 14, 7, 0, -7, 0, 25, 27694 }, // ̳
+    { 12, 5, 0, -6, 10, 15, 27719 }, // ̴
+    { 14, 3, 0, -7, 10, 11, 27734 }, // ̵
+    { 22, 3, 0, -11, 10, 17, 27745 }, // ̶
+    { 10, 7, 0, -5, 12, 18, 27762 }, // ̷
+    { 12, 25, 0, -6, 23, 75, 27780 }, // ̸
+    { 4, 7, 0, -2, 0, 7, 27855 }, // ̹
+    { 12, 6, 0, -6, -1, 18, 27862 }, // ̺
+    { 12, 7, 0, -6, 0, 21, 27880 }, // ̻
+    { 12, 5, 0, -6, -1, 15, 27901 }, // ̼
+    { 6, 7, 0, -3, 23, 11, 27916 }, // ̽
+    { 4, 10, 0, -2, 26, 10, 27927 }, // ̾
+    { 14, 7, 0, -7, 29, 25, 27937 }, // ̿
+    { 7, 6, 0, -5, 23, 11, 27962 }, // ̀
+    { 7, 6, 0, -2, 23, 11, 27973 }, // ́
+    { 12, 5, 0, -6, 22, 15, 27984 }, // ͂
+    { 5, 6, 0, -3, 23, 8, 27999 }, // ̓
+    { 11, 6, 0, -5, 23, 17, 28007 }, // ̈́
+    { 6, 5, 0, -2, -2, 8, 28024 }, // ͅ
+    { 14, 6, 0, -7, 23, 21, 28032 }, // ͆
+    { 14, 7, 0, -7, 0, 25, 28053 }, // ͇
+    { 8, 6, 0, -4, 0, 12, 28078 }, // ͈
+    { 6, 6, 0, -3, -1, 9, 28090 }, // ͉
+    { 12, 7, 0, -6, 23, 21, 28099 }, // ͊
+    { 12, 11, 0, -6, 27, 33, 28120 }, // ͋
+    { 10, 9, 0, -5, 26, 23, 28153 }, // ͌
+    { 12, 6, 0, -6, -1, 18, 28176 }, // ͍
+    { 6, 7, 0, -3, 0, 11, 28194 }, // ͎
+    { 22, 21, 0, -11, 21, 116, 28205 }, // ͏
+    { 6, 7, 0, -3, 24, 11, 28321 }, // ͐
+    { 4, 7, 0, -2, 24, 7, 28332 }, // ͑
+    { 10, 8, 0, -5, 25, 20, 28339 }, // ͒
+    { 6, 7, 0, -3, 0, 11, 28359 }, // ͓
+    { 6, 6, 0, -3, -1, 9, 28370 }, // ͔
+    { 6, 6, 0, -3, -1, 9, 28379 }, // ͕
+    { 12, 6, 0, -6, -1, 18, 28388 }, // ͖
+    { 4, 7, 0, -2, 24, 7, 28406 }, // ͗
+    { 4, 4, 0, 3, 22, 4, 28413 }, // ͘
+    { 8, 6, 0, -4, -1, 12, 28417 }, // ͙
+    { 12, 7, 0, -6, 0, 21, 28429 }, // ͚
+    { 6, 6, 0, -3, 23, 9, 28450 }, // ͛
+    { 24, 6, 0, -12, -1, 36, 28459 }, // ͜
+    { 24, 6, 0, -12, 23, 36, 28495 }, // ͝
+    { 18, 2, 0, -9, 20, 9, 28531 }, // ͞
+    { 18, 2, 0, -9, -2, 9, 28540 }, // ͟
+    { 24, 5, 0, -12, 22, 30, 28549 }, // ͠
+    { 24, 6, 0, -12, 25, 36, 28579 }, // ͡
+    { 23, 6, 0, -11, -1, 35, 28615 }, // ͢
+    { 6, 8, 0, -3, 25, 12, 28650 }, // ͣ
+    { 7, 8, 0, -3, 25, 14, 28672 }, // ͤ
+    { 2, 9, 0, -1, 27, 5, 28686 }, // ͥ
+    { 7, 8, 0, -3, 25, 14, 28691 }, // ͦ
+    { 7, 8, 0, -3, 25, 14, 28705 }, // ͧ
+    { 6, 8, 0, -3, 25, 12, 28719 }, // ͨ
+    { 7, 10, 0, -3, 27, 18, 28731 }, // ͩ
+    { 7, 9, 0, -3, 27, 16, 28749 }, // ͪ
+    { 11, 7, 0, -5, 25, 20, 28765 }, // ͫ
+    { 5, 7, 0, -2, 25, 9, 28785 }, // ͬ
+    { 5, 9, 0, -2, 26, 12, 28794 }, // ͭ
+    { 8, 7, 0, -4, 25, 14, 28806 }, // ͮ
+    { 7, 7, 0, -3, 25, 13, 28820 }, // ͯ
+    { 13, 28, 16, 2, 28, 91, 28833 }, // Ѐ
+    { 13, 27, 16, 2, 27, 88, 28924 }, // Ё
+    { 20, 22, 21, 0, 21, 110, 29012 }, // Ђ
+    { 13, 28, 15, 2, 28, 91, 29122 }, // Ѓ
+    { 17, 23, 19, 1, 22, 98, 29213 }, // Є
+    { 14, 23, 16, 1, 22, 81, 29311 }, // Ѕ
+    { 4, 21, 8, 2, 21, 21, 29392 }, // І
+    { 8, 27, 8, 0, 27, 54, 29413 }, // Ї
+    { 9, 27, 8, -3, 21, 61, 29467 }, // Ј
+    { 28, 22, 29, 0, 21, 154, 29528 }, // Љ
+    { 27, 21, 30, 2, 21, 142, 29682 }, // Њ
+    { 20, 21, 21, 0, 21, 105, 29824 }, // Ћ
+    { 16, 28, 18, 2, 28, 112, 29929 }, // Ќ
+    { 18, 28, 22, 2, 28, 126, 30041 }, // Ѝ
+    { 18, 28, 18, 0, 27, 126, 30167 }, // Ў
+    { 17, 26, 21, 2, 21, 111, 30293 }, // Џ
+    { 19, 21, 19, 0, 21, 100, 30404 }, // А
+    { 15, 21, 18, 2, 21, 79, 30504 }, // Б
+    { 16, 21, 19, 2, 21, 84, 30583 }, // В
+    { 13, 21, 15, 2, 21, 69, 30720 }, // Г
+    { 21, 26, 21, 0, 21, 137, 30789 }, // Д
+    { 13, 21, 16, 2, 21, 69, 30926 }, // Е
+    { 27, 21, 26, 0, 21, 142, 30995 }, // Ж
+    { 15, 23, 17, 1, 22, 87, 31137 }, // З
+    { 18, 21, 22, 2, 21, 95, 31224 }, // И
+    { 18, 27, 22, 2, 27, 122, 31319 }, // Й
+    { 16, 21, 18, 2, 21, 84, 31441 }, // К
+    { 18, 22, 20, 0, 21, 99, 31525 }, // Л
+    { 22, 21, 26, 2, 21, 116, 31624 }, // М
+    { 17, 21, 22, 2, 21, 90, 31740 }, // Н
+    { 20, 23, 22, 1, 22, 115, 31830 }, // О
+    { 17, 21, 21, 2, 21, 90, 31945 }, // П
+    { 15, 21, 18, 2, 21, 79, 32035 }, // Р
+    { 17, 23, 19, 1, 22, 98, 32114 }, // С
+    { 16, 21, 16, 0, 21, 84, 32212 }, // Т
+    { 18, 22, 18, 0, 21, 99, 32296 }, // У
+    { 22, 23, 24, 1, 22, 127, 32395 }, // Ф
+    { 17, 21, 17, 0, 21, 90, 32522 }, // Х
+    { 20, 26, 22, 2, 21, 130, 32612 }, // Ц
+    { 15, 21, 20, 2, 21, 79, 32768 }, // Ч
+    { 26, 21, 30, 2, 21, 137, 32847 }, // Ш
+    { 28, 26, 30, 2, 21, 182, 32984 }, // Щ
+    { 19, 21, 20, 0, 21, 100, 33166 }, // Ъ
+    { 20, 21, 25, 2, 21, 105, 33266 }, // Ы
+    { 15, 21, 18, 2, 21, 79, 33371 }, // Ь
+    { 17, 23, 19, 1, 22, 98, 33450 }, // Э
+    { 26, 23, 29, 2, 22, 150, 33548 }, // Ю
+    { 16, 21, 19, 0, 21, 84, 33698 }, // Я
+    { 13, 17, 16, 1, 16, 56, 33782 }, // а
+    { 16, 24, 17, 1, 23, 96, 33838 }, // б
+    { 14, 16, 16, 2, 16, 56, 33934 }, // в
+    { 11, 16, 13, 2, 16, 44, 33990 }, // г
+    { 18, 21, 18, 0, 16, 95, 34034 }, // д
+    { 14, 17, 16, 1, 16, 60, 34129 }, // е
+    { 22, 16, 22, 0, 16, 88, 34189 }, // ж
+    { 13, 17, 14, 0, 16, 56, 34277 }, // з
+    { 14, 16, 18, 2, 16, 56, 34333 }, // и
+    { 14, 22, 18, 2, 22, 77, 34389 }, // й
+    { 14, 16, 15, 2, 16, 56, 34466 }, // к
+    { 15, 17, 17, 0, 16, 64, 34522 }, // л
+    { 18, 16, 22, 2, 16, 72, 34586 }, // м
+    { 14, 16, 18, 2, 16, 56, 34658 }, // н
+    { 15, 17, 17, 1, 16, 64, 34714 }, // о
+    { 14, 16, 18, 2, 16, 56, 34816 }, // п
+    { 15, 23, 18, 2, 16, 87, 34872 }, // р
+    { 13, 17, 14, 1, 16, 56, 34959 }, // с
+    { 14, 16, 14, 0, 16, 56, 35015 }, // т
+    { 15, 23, 15, 0, 16, 87, 35071 }, // у
+    { 20, 30, 22, 1, 23, 150, 35158 }, // ф
+    { 15, 16, 15, 0, 16, 60, 35308 }, // х
+    { 16, 21, 18, 2, 16, 84, 35368 }, // ц
+    { 14, 16, 17, 1, 16, 56, 35452 }, // ч
+    { 22, 16, 26, 2, 16, 88, 35508 }, // ш
+    { 24, 21, 26, 2, 16, 126, 35596 }, // щ
+    { 17, 16, 18, 0, 16, 68, 35722 }, // ъ
+    { 18, 16, 22, 2, 16, 72, 35790 }, // ы
+    { 13, 16, 16, 2, 16, 52, 35862 }, // ь
+    { 13, 17, 14, 1, 16, 56, 35914 }, // э
+    { 20, 17, 23, 2, 16, 85, 35970 }, // ю
+    { 14, 16, 17, 1, 16, 56, 36055 }, // я
+    { 14, 24, 16, 1, 23, 84, 36111 }, // ѐ
+    { 14, 23, 16, 1, 22, 81, 36195 }, // ё
+    { 16, 30, 18, 0, 23, 120, 36276 }, // ђ
+    { 11, 23, 13, 2, 23, 64, 36396 }, // ѓ
+    { 13, 17, 14, 1, 16, 56, 36460 }, // є
+    { 12, 17, 14, 1, 16, 51, 36516 }, // ѕ
+    { 4, 22, 8, 2, 22, 22, 36567 }, // і
+    { 7, 22, 8, 0, 22, 39, 36589 }, // ї
+    { 8, 29, 8, -2, 22, 58, 36628 }, // ј
+    { 24, 17, 25, 0, 16, 102, 36686 }, // љ
+    { 23, 16, 26, 2, 16, 92, 36864 }, // њ
+    { 16, 23, 18, 0, 23, 92, 36956 }, // ћ
+    { 14, 23, 15, 2, 23, 81, 37048 }, // ќ
+    { 14, 23, 18, 2, 23, 81, 37129 }, // ѝ
+    { 15, 29, 15, 0, 22, 109, 37210 }, // ў
+    { 14, 21, 18, 2, 16, 74, 37319 }, // џ
+    { 27, 22, 27, 0, 21, 149, 37393 }, // Ѡ
+    { 23, 16, 23, 0, 16, 92, 37542 }, // ѡ
+    { 19, 21, 20, 0, 21, 100, 37634 }, // Ѣ
+    { 17, 19, 19, 0, 19, 81, 37734 }, // ѣ
+    { 25, 23, 27, 2, 22, 144, 37815 }, // Ѥ
+    { 19, 17, 22, 2, 16, 81, 37959 }, // ѥ
+    { 20, 21, 20, 0, 21, 105, 38040 }, // Ѧ
+    { 17, 16, 17, 0, 16, 68, 38145 }, // ѧ
+    { 26, 21, 27, 2, 21, 137, 38213 }, // Ѩ
+    { 21, 16, 23, 2, 16, 84, 38350 }, // ѩ
+    { 21, 21, 21, 0, 21, 111, 38434 }, // Ѫ
+    { 19, 16, 19, 0, 16, 76, 38545 }, // ѫ
+    { 27, 21, 29, 2, 21, 142, 38621 }, // Ѭ
+    { 23, 16, 25, 2, 16, 92, 38763 }, // ѭ
+    { 16, 32, 17, 0, 25, 128, 38912 }, // Ѯ
+    { 13, 26, 14, 0, 20, 85, 39040 }, // ѯ
+    { 20, 21, 23, 2, 21, 105, 39125 }, // Ѱ
+    { 18, 30, 22, 2, 23, 135, 39230 }, // ѱ
+    { 20, 23, 23, 1, 22, 115, 39365 }, // Ѳ
+    { 16, 17, 18, 1, 16, 68, 39480 }, // ѳ
+    { 20, 21, 19, 0, 21, 105, 39548 }, // Ѵ
+    { 16, 16, 15, 0, 16, 64, 39653 }, // ѵ
+    { 20, 28, 19, 0, 28, 140, 39717 }, // Ѷ
+    { 16, 23, 15, 0, 23, 92, 39857 }, // ѷ
+    { 35, 29, 36, 1, 22, 254, 39949 }, // Ѹ
+    { 31, 23, 32, 1, 16, 179, 40203 }, // ѹ
+    { 22, 25, 24, 1, 23, 138, 40382 }, // Ѻ
+    { 17, 20, 19, 1, 18, 85, 40520 }, // ѻ
+    { 28, 32, 30, 1, 31, 224, 40605 }, // Ѽ
+    { 24, 27, 26, 1, 26, 162, 40960 }, // ѽ
+    { 27, 27, 27, 0, 26, 183, 41122 }, // Ѿ
+    { 23, 21, 23, 0, 21, 121, 41305 }, // ѿ
+    { 17, 29, 19, 1, 22, 124, 41426 }, // Ҁ
+    { 13, 23, 14, 1, 16, 75, 41550 }, // ҁ
+    { 16, 20, 18, 1, 19, 80, 41625 }, // ҂
+    { 12, 5, 0, -14, 21, 15, 41705 }, // ҃
+    { 12, 5, 0, -14, 22, 15, 41720 }, // ҄
+    { 5, 6, 0, -11, 23, 8, 41735 }, // ҅
+    { 4, 6, 0, -10, 23, 6, 41743 }, // ҆
+    { 12, 4, 0, -6, 26, 12, 41749 }, // ҇
+    { 34, 31, 0, -17, 23, 264, 41761 }, // ҈
+    { 34, 33, 0, -17, 24, 281, 42025 }, // ҉
+    { 21, 33, 23, 2, 27, 174, 42306 }, // Ҋ
+    { 17, 29, 19, 2, 23, 124, 42480 }, // ҋ
+    { 17, 21, 18, 0, 21, 90, 42604 }, // Ҍ
+    { 16, 23, 17, 0, 23, 92, 42694 }, // ҍ
+    { 15, 21, 18, 2, 21, 79, 42786 }, // Ҏ
+    { 15, 23, 18, 2, 16, 87, 42865 }, // ҏ
+    { 13, 26, 16, 2, 26, 85, 43008 }, // Ґ
+    { 11, 21, 13, 2, 21, 58, 43093 }, // ґ
+    { 15, 21, 15, 0, 21, 79, 43151 }, // Ғ
+    { 13, 16, 13, 0, 16, 52, 43230 }, // ғ
+    { 16, 29, 19, 2, 21, 116, 43282 }, // Ҕ
+    { 13, 24, 16, 2, 16, 78, 43398 }, // ҕ
+    { 26, 27, 26, 0, 21, 176, 43476 }, // Җ
+    { 23, 22, 23, 0, 16, 127, 43652 }, // җ
+    { 15, 29, 17, 1, 22, 109, 43779 }, // Ҙ
+    { 13, 23, 14, 0, 16, 75, 43888 }, // ҙ
+    { 18, 27, 20, 2, 21, 122, 43963 }, // Қ
+    { 14, 22, 16, 2, 16, 77, 44085 }, // қ
+    { 17, 21, 18, 2, 21, 90, 44162 }, // Ҝ
+    { 14, 16, 15, 2, 16, 56, 44252 }, // ҝ
+    { 18, 21, 18, 0, 21, 95, 44308 }, // Ҟ
+    { 16, 23, 16, 0, 23, 92, 44403 }, // ҟ
+    { 21, 21, 20, 0, 21, 111, 44495 }, // Ҡ
+    { 19, 16, 18, 0, 16, 76, 44606 }, // ҡ
+    { 20, 27, 22, 2, 21, 135, 44682 }, // Ң
+    { 17, 22, 19, 2, 16, 94, 44817 }, // ң
+    { 22, 21, 24, 2, 21, 116, 44911 }, // Ҥ
+    { 20, 16, 22, 2, 16, 80, 45056 }, // ҥ
+    { 28, 29, 31, 2, 21, 203, 45136 }, // Ҧ
+    { 23, 24, 25, 2, 16, 138, 45339 }, // ҧ
+    { 21, 24, 23, 1, 22, 126, 45477 }, // Ҩ
+    { 17, 17, 19, 1, 16, 73, 45603 }, // ҩ
+    { 17, 29, 18, 1, 22, 124, 45676 }, // Ҫ
+    { 13, 23, 14, 1, 16, 75, 45800 }, // ҫ
+    { 16, 27, 16, 0, 21, 108, 45875 }, // Ҭ
+    { 14, 22, 14, 0, 16, 77, 45983 }, // ҭ
+    { 17, 21, 17, 0, 21, 90, 46060 }, // Ү
+    { 15, 23, 15, 0, 16, 87, 46150 }, // ү
+    { 17, 21, 17, 0, 21, 90, 46237 }, // Ұ
+    { 15, 23, 15, 0, 16, 87, 46327 }, // ұ
+    { 18, 27, 18, 0, 21, 122, 46414 }, // Ҳ
+    { 16, 22, 16, 0, 16, 88, 46536 }, // ҳ
+    { 25, 27, 25, 0, 21, 169, 46624 }, // Ҵ
+    { 21, 22, 21, 0, 16, 116, 46793 }, // ҵ
+    { 19, 27, 21, 2, 21, 129, 46909 }, // Ҷ
+    { 16, 22, 18, 2, 16, 88, 47104 }, // ҷ
+    { 16, 21, 20, 2, 21, 84, 47192 }, // Ҹ
+    { 14, 16, 18, 2, 16, 56, 47276 }, // ҹ
+    { 17, 21, 20, 2, 21, 90, 47332 }, // Һ
+    { 14, 23, 18, 2, 23, 81, 47422 }, // һ
+    { 24, 23, 25, 0, 22, 138, 47503 }, // Ҽ
+    { 18, 17, 19, 0, 16, 77, 47641 }, // ҽ
+    { 24, 28, 25, 0, 22, 168, 47718 }, // Ҿ
+    { 18, 22, 19, 0, 16, 99, 47886 }, // ҿ
+    { 8, 21, 10, 1, 21, 42, 47985 }, // Ӏ
+    { 27, 27, 26, 0, 27, 183, 48027 }, // Ӂ
+    { 22, 22, 22, 0, 22, 121, 48210 }, // ӂ
+    { 17, 29, 20, 2, 21, 124, 48331 }, // Ӄ
+    { 14, 24, 16, 2, 16, 84, 48455 }, // ӄ
+    { 21, 27, 21, 0, 21, 142, 48539 }, // Ӆ
+    { 18, 22, 17, 0, 16, 99, 48681 }, // ӆ
+    { 17, 29, 21, 2, 21, 124, 48780 }, // Ӈ
+    { 15, 24, 18, 2, 16, 90, 48904 }, // ӈ
+    { 20, 27, 22, 2, 21, 135, 48994 }, // Ӊ
+    { 17, 22, 19, 2, 16, 94, 49152 }, // ӊ
+    { 16, 27, 20, 2, 21, 108, 49246 }, // Ӌ
+    { 14, 22, 18, 2, 16, 77, 49354 }, // ӌ
+    { 25, 27, 27, 2, 21, 169, 49431 }, // Ӎ
+    { 20, 22, 22, 2, 16, 110, 49600 }, // ӎ
+    { 8, 21, 10, 1, 21, 42, 49710 }, // ӏ
+    { 19, 27, 19, 0, 27, 129, 49752 }, // Ӑ
+    { 13, 23, 16, 1, 22, 75, 49881 }, // ӑ
+    { 19, 27, 19, 0, 27, 129, 49956 }, // Ӓ
+    { 13, 23, 16, 1, 22, 75, 50085 }, // ӓ
+    { 25, 21, 26, -1, 21, 132, 50160 }, // Ӕ
+    { 23, 17, 25, 1, 16, 98, 50292 }, // ӕ
+    { 13, 27, 16, 2, 27, 88, 50390 }, // Ӗ
+    { 14, 23, 16, 1, 22, 81, 50478 }, // ӗ
+    { 19, 23, 22, 1, 22, 110, 50559 }, // Ә
+    { 14, 17, 16, 1, 16, 60, 50669 }, // ә
+    { 19, 28, 22, 1, 27, 133, 50729 }, // Ӛ
+    { 14, 23, 16, 1, 22, 81, 50862 }, // ӛ
+    { 27, 27, 26, 0, 27, 183, 50943 }, // Ӝ
+    { 22, 22, 22, 0, 22, 121, 51200 }, // ӝ
+    { 15, 28, 17, 1, 27, 105, 51321 }, // Ӟ
+    { 13, 23, 14, 0, 22, 75, 51426 }, // ӟ
+    { 15, 22, 17, 1, 21, 83, 51501 }, // Ӡ
+    { 14, 23, 15, 0, 16, 81, 51584 }, // ӡ
+    { 18, 25, 22, 2, 25, 113, 51665 }, // Ӣ
+    { 14, 20, 18, 2, 20, 70, 51778 }, // ӣ
+    { 18, 27, 22, 2, 27, 122, 51848 }, // Ӥ
+    { 14, 22, 18, 2, 22, 77, 51970 }, // ӥ
+    { 20, 28, 23, 1, 27, 140, 52047 }, // Ӧ
+    { 16, 23, 18, 1, 22, 92, 52187 }, // ӧ
+    { 20, 23, 23, 1, 22, 115, 52279 }, // Ө
+    { 16, 17, 18, 1, 16, 68, 52394 }, // ө
+    { 20, 28, 23, 1, 27, 140, 52462 }, // Ӫ
+    { 16, 23, 18, 1, 22, 92, 52602 }, // ӫ
+    { 17, 28, 19, 1, 27, 119, 52694 }, // Ӭ
+    { 13, 23, 14, 1, 22, 75, 52813 }, // ӭ
+    { 18, 26, 18, 0, 25, 117, 52888 }, // Ӯ
+    { 15, 27, 15, 0, 20, 102, 53005 }, // ӯ
+    { 18, 28, 18, 0, 27, 126, 53107 }, // Ӱ
+    { 15, 29, 15, 0, 22, 109, 53248 }, // ӱ
+    { 18, 29, 18, 0, 28, 131, 53357 }, // Ӳ
+    { 15, 30, 15, 0, 23, 113, 53488 }, // ӳ
+    { 15, 27, 20, 2, 27, 102, 53601 }, // Ӵ
+    { 14, 22, 17, 1, 22, 77, 53703 }, // ӵ
+    { 13, 27, 15, 2, 21, 88, 53780 }, // Ӷ
+    { 10, 22, 13, 2, 16, 55, 53868 }, // ӷ
+    { 20, 27, 25, 2, 27, 135, 53923 }, // Ӹ
+    { 18, 22, 22, 2, 22, 99, 54058 }, // ӹ
+    { 15, 27, 15, 0, 21, 102, 54157 }, // Ӻ
+    { 13, 22, 13, 0, 16, 72, 54259 }, // ӻ
+    { 18, 27, 18, 0, 21, 122, 54331 }, // Ӽ
+    { 16, 22, 16, 0, 16, 88, 54453 }, // ӽ
+    { 17, 21, 17, 0, 21, 90, 54541 }, // Ӿ
+    { 15, 16, 15, 0, 16, 60, 54631 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 54691 }, //  
+    { 0, 0, 29, 0, 0, 0, 54691 }, //  
+    { 0, 0, 15, 0, 0, 0, 54691 }, //  
+    { 0, 0, 29, 0, 0, 0, 54691 }, //  
+    { 0, 0, 10, 0, 0, 0, 54691 }, //  
+    { 0, 0, 7, 0, 0, 0, 54691 }, //  
+    { 0, 0, 5, 0, 0, 0, 54691 }, //  
+    { 0, 0, 17, 0, 0, 0, 54691 }, //  
+    { 0, 0, 8, 0, 0, 0, 54691 }, //  
+    { 0, 0, 5, 0, 0, 0, 54691 }, //  
+    { 0, 0, 3, 0, 0, 0, 54691 }, //  
+    { 0, 0, 0, 0, 0, 0, 54691 }, // ​
+    { 0, 0, 0, 0, 0, 0, 54691 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 54691 }, // ‍
+    { 8, 25, 0, -1, 21, 50, 54691 }, // ‎
+    { 8, 25, 0, -7, 21, 50, 54741 }, // ‏
+    { 8, 3, 9, 1, 9, 6, 54791 }, // ‐
+    { 8, 3, 9, 1, 9, 6, 54797 }, // ‑
+    { 15, 3, 17, 1, 12, 12, 54803 }, // ‒
+    { 13, 3, 15, 1, 9, 10, 54815 }, // –
+    { 27, 3, 29, 1, 9, 21, 54825 }, // —
+    { 27, 3, 29, 1, 9, 21, 54846 }, // ―
+    { 10, 31, 16, 3, 23, 78, 54867 }, // ‖
+    { 14, 7, 12, -1, 0, 25, 54945 }, // ‗
+    { 5, 8, 5, 0, 21, 10, 54970 }, // ‘
+    { 5, 8, 5, 0, 21, 10, 54980 }, // ’
+    { 6, 8, 7, 0, 4, 12, 54990 }, // ‚
+    { 5, 8, 5, 0, 21, 10, 55002 }, // ‛
+    { 11, 8, 10, 0, 21, 22, 55012 }, // “
+    { 11, 8, 10, 0, 21, 22, 55034 }, // ”
+    { 11, 8, 12, 0, 4, 22, 55056 }, // „
+    { 11, 8, 10, 0, 21, 22, 55078 }, // ‟
+    { 13, 23, 15, 1, 23, 75, 55100 }, // †
+    { 13, 23, 15, 1, 23, 75, 55175 }, // ‡
+    { 7, 8, 11, 2, 15, 14, 55250 }, // •
+    { 9, 10, 11, 1, 16, 23, 55264 }, // ‣
+    { 5, 5, 15, 5, 4, 7, 55287 }, // ․
+    { 12, 5, 16, 2, 4, 15, 55296 }, // ‥
+    { 19, 5, 23, 2, 4, 24, 55311 }, // …
+    { 4, 5, 8, 2, 10, 5, 55335 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 55340 }, //  
+    { 0, 0, 18, 0, 0, 0, 55340 }, //  
+    { 8, 22, 0, -1, 18, 44, 55340 }, // ‪
+    { 8, 22, 0, -7, 18, 44, 55384 }, // ‫
+    { 8, 25, 0, -4, 21, 50, 55428 }, // ‬
+    { 8, 25, 0, -4, 21, 50, 55478 }, // ‭
+    { 8, 25, 0, -4, 21, 50, 55528 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 55578 }, //  
+    { 32, 23, 34, 1, 22, 184, 55578 }, // ‰
+    { 43, 23, 45, 1, 22, 248, 55762 }, // ‱
+    { 7, 8, 7, 1, 21, 14, 56010 }, // ′
+    { 12, 8, 12, 1, 21, 24, 56024 }, // ″
+    { 17, 8, 17, 1, 21, 34, 56048 }, // ‴
+    { 7, 8, 7, -1, 21, 14, 56082 }, // ‵
+    { 12, 8, 13, -1, 21, 24, 56096 }, // ‶
+    { 17, 8, 18, -1, 21, 34, 56120 }, // ‷
+    { 12, 10, 12, 0, 3, 30, 56154 }, // ‸
+    { 7, 13, 9, 1, 14, 23, 56184 }, // ‹
+    { 7, 13, 9, 1, 14, 23, 56207 }, // ›
+    { 22, 23, 24, 1, 22, 127, 56230 }, // ※
+    { 11, 22, 15, 2, 21, 61, 56357 }, // ‼
+    { 13, 23, 13, 0, 22, 75, 56418 }, // ‽
+    { 16, 3, 15, -1, 25, 12, 56493 }, // ‾
+    { 18, 7, 18, 0, 0, 32, 56505 }, // ‿
+    { 18, 8, 18, 0, 24, 36, 56537 }, // ⁀
+    { 11, 19, 11, 0, 12, 53, 56573 }, // ⁁
+    { 33, 28, 33, 0, 23, 231, 56626 }, // ⁂
+    { 8, 3, 9, 1, 9, 6, 56857 }, // ⁃
+    { 16, 21, 4, -6, 21, 84, 56863 }, // ⁄
+    { 7, 26, 9, 2, 21, 46, 56947 }, // ⁅
+    { 8, 26, 9, 0, 21, 52, 56993 }, // ⁆
+    { 25, 23, 25, 0, 22, 144, 57045 }, // ⁇
+    { 18, 23, 20, 0, 22, 104, 57189 }, // ⁈
+    { 18, 23, 20, 2, 22, 104, 57344 }, // ⁉
+    { 15, 16, 17, 1, 16, 60, 57448 }, // ⁊
+    { 16, 27, 19, 2, 23, 108, 57508 }, // ⁋
+    { 16, 15, 19, 1, 16, 60, 57616 }, // ⁌
+    { 16, 15, 19, 2, 16, 60, 57676 }, // ⁍
+    { 14, 14, 16, 1, 8, 49, 57736 }, // ⁎
+    { 6, 21, 7, 1, 17, 32, 57785 }, // ⁏
+    { 18, 31, 18, 0, 24, 140, 57817 }, // ⁐
+    { 14, 29, 16, 1, 23, 102, 57957 }, // ⁑
+    { 11, 23, 11, 0, 22, 64, 58059 }, // ⁒
+    { 25, 5, 29, 2, 11, 32, 58123 }, // ⁓
+    { 18, 7, 18, 0, 0, 32, 58155 }, // ⁔
+    { 16, 16, 17, 0, 15, 64, 58187 }, // ⁕
+    { 13, 23, 15, 1, 22, 75, 58251 }, // ⁖
+    { 22, 8, 22, 1, 21, 44, 58326 }, // ⁗
+    { 22, 23, 24, 1, 22, 127, 58370 }, // ⁘
+    { 22, 23, 24, 1, 22, 127, 58497 }, // ⁙
+    { 4, 23, 6, 1, 22, 23, 58624 }, // ⁚
+    { 17, 23, 19, 1, 22, 98, 58647 }, // ⁛
+    { 22, 23, 23, 1, 22, 127, 58745 }, // ⁜
+    { 4, 22, 8, 2, 21, 22, 58872 }, // ⁝
+    { 4, 23, 8, 2, 22, 23, 58894 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 58917 }, //  
+    { 0, 0, 18, 0, 0, 0, 58917 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 58917 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 58917 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 58917 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 58917 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 58917 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 58917 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 58917 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 58917 }, // ⁩
+    { 8, 25, 0, -4, 21, 50, 58917 }, // ⁪
+    { 8, 25, 0, -4, 21, 50, 58967 }, // ⁫
+    { 8, 25, 0, -4, 21, 50, 59017 }, // ⁬
+    { 8, 25, 0, -4, 21, 50, 59067 }, // ⁭
+    { 8, 25, 0, -4, 21, 50, 59117 }, // ⁮
+    { 8, 25, 0, -4, 21, 50, 59167 }, // ⁯
+    { 10, 14, 10, 0, 25, 35, 59217 }, // ⁰
+    { 3, 14, 5, 1, 22, 11, 59252 }, // ⁱ
+    { 10, 13, 10, 0, 25, 33, 59263 }, // ⁴
+    { 10, 14, 10, 0, 25, 35, 59296 }, // ⁵
+    { 10, 14, 10, 0, 25, 35, 59331 }, // ⁶
+    { 10, 13, 10, 0, 25, 33, 59392 }, // ⁷
+    { 10, 14, 10, 0, 25, 35, 59425 }, // ⁸
+    { 10, 14, 10, 0, 25, 35, 59460 }, // ⁹
+    { 8, 9, 10, 1, 22, 18, 59495 }, // ⁺
+    { 8, 3, 10, 1, 19, 6, 59513 }, // ⁻
+    { 8, 6, 10, 1, 20, 12, 59519 }, // ⁼
+    { 6, 17, 7, 1, 27, 26, 59531 }, // ⁽
+    { 5, 17, 7, 0, 27, 22, 59557 }, // ⁾
+    { 10, 10, 12, 1, 18, 25, 59579 }, // ⁿ
+    { 10, 14, 10, 0, 9, 35, 59604 }, // ₀
+    { 6, 13, 10, 1, 9, 20, 59639 }, // ₁
+    { 9, 13, 10, 0, 9, 30, 59659 }, // ₂
+    { 10, 14, 10, 0, 9, 35, 59689 }, // ₃
+    { 10, 13, 10, 0, 9, 33, 59724 }, // ₄
+    { 10, 14, 10, 0, 9, 35, 59757 }, // ₅
+    { 10, 14, 10, 0, 9, 35, 59792 }, // ₆
+    { 10, 13, 10, 0, 9, 33, 59827 }, // ₇
+    { 10, 14, 10, 0, 9, 35, 59860 }, // ₈
+    { 10, 14, 10, 0, 9, 35, 59895 }, // ₉
+    { 8, 9, 10, 1, 6, 18, 59930 }, // ₊
+    { 8, 3, 10, 1, 3, 6, 59948 }, // ₋
+    { 8, 6, 10, 1, 4, 12, 59954 }, // ₌
+    { 6, 17, 7, 1, 11, 26, 59966 }, // ₍
+    { 5, 17, 7, 0, 11, 22, 59992 }, // ₎
+    { 10, 10, 11, 0, 7, 25, 60014 }, // ₐ
+    { 9, 10, 11, 1, 7, 23, 60039 }, // ₑ
+    { 10, 10, 11, 1, 7, 25, 60062 }, // ₒ
+    { 10, 10, 10, 0, 7, 25, 60087 }, // ₓ
+    { 10, 10, 11, 0, 7, 25, 60112 }, // ₔ
+    { 10, 14, 12, 1, 11, 35, 60137 }, // ₕ
+    { 9, 14, 10, 1, 11, 32, 60172 }, // ₖ
+    { 3, 14, 5, 1, 11, 11, 60204 }, // ₗ
+    { 16, 10, 18, 1, 7, 40, 60215 }, // ₘ
+    { 10, 10, 12, 1, 7, 25, 60255 }, // ₙ
+    { 10, 14, 12, 1, 7, 35, 60280 }, // ₚ
+    { 9, 10, 9, 0, 7, 23, 60315 }, // ₛ
+    { 7, 12, 7, 0, 9, 21, 60338 }, // ₜ
+    { 15, 22, 17, 1, 22, 83, 60359 }, // ₠
+    { 16, 25, 17, 1, 23, 100, 60442 }, // ₡
+    { 15, 23, 17, 1, 22, 87, 60542 }, // ₢
+    { 15, 21, 17, 1, 21, 79, 60629 }, // ₣
+    { 16, 22, 17, 0, 22, 88, 60708 }, // ₤
+    { 23, 24, 27, 2, 20, 138, 60796 }, // ₥
+    { 17, 21, 17, 0, 21, 90, 60934 }, // ₦
+    { 20, 22, 23, 2, 21, 110, 61024 }, // ₧
+    { 22, 22, 24, 2, 21, 121, 61134 }, // ₨
+    { 20, 21, 20, 0, 21, 105, 61255 }, // ₩
+    { 19, 21, 23, 2, 21, 100, 61440 }, // ₪
+    { 17, 28, 18, 1, 23, 119, 61540 }, // ₫
+    { 17, 23, 17, 0, 22, 98, 61659 }, // €
+    { 17, 21, 17, 0, 21, 90, 61757 }, // ₭
+    { 17, 21, 17, 0, 21, 90, 61847 }, // ₮
+    { 28, 29, 28, 0, 22, 203, 61937 }, // ₯
+    { 16, 29, 17, 0, 22, 116, 62140 }, // ₰
+    { 17, 21, 17, 0, 21, 90, 62256 }, // ₱
+    { 19, 26, 21, 1, 23, 124, 62346 }, // ₲
+    { 18, 21, 18, 0, 21, 95, 62470 }, // ₳
+    { 16, 23, 16, 0, 22, 92, 62565 }, // ₴
+    { 17, 26, 18, 1, 23, 111, 62657 }, // ₵
+    { 18, 21, 18, 0, 20, 95, 62768 }, // ₶
+    { 20, 25, 21, 0, 22, 125, 62863 }, // ₷
+    { 16, 21, 16, 0, 21, 84, 62988 }, // ₸
+    { 13, 21, 17, 2, 21, 69, 63072 }, // ₹
+    { 16, 22, 17, 0, 21, 88, 63141 }, // ₺
+    { 23, 23, 23, 0, 22, 133, 63229 }, // ₻
+    { 21, 21, 24, 1, 21, 111, 63362 }, // ₼
+    { 16, 21, 17, 0, 21, 84, 63488 }, // ₽
+    { 20, 23, 22, 1, 23, 115, 63572 }, // ₾
+    { 14, 27, 17, 2, 24, 95, 63687 }, // ₿
+    { 12, 21, 14, 1, 16, 63, 63782 }, // ⃀
+    { 15, 3, 17, 1, 12, 12, 63845 }, // −
+    { 27, 28, 29, 1, 23, 189, 63857 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_regularIntervals[] = {
@@ -4825,4 +3005,9 @@ static const EpdFontData notosans_14_regular = {
     32,
     -9,
     true,
+    notosans_14_regularBlockOffsets,
+    notosans_14_regularDirectGlyphs,
+    notosans_14_regularGlyphPages,
+    256,
+    notosans_14_regularPageGlyphs,
 };
@@ -2,5562 +2,2636 @@
  * generated by fontconvert.py
  * name: notosans_16_bold
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py notosans_16_bold 16 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_16_bold 16 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_boldBitmaps[88779] = {
-    0x3F, 0xF4, 0xFF, 0xD3, 0xFF, 0x4F, 0xFD, 0x3F, 0xF4, 0xFF, 0xD3, 0xFF, 0x0F, 0xFC, 0x2F, 0xF0,
-    0xBF, 0xC2, 0xFF, 0x0B, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xF8, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x3F, 0xF4, 0xFF, 0xE3, 0xFF, 0x4B, 0xFC, 0x01, 0x40, 0xFF, 0x82, 0xFE, 0xFF,
-    0x83, 0xFF, 0xFF, 0x82, 0xFE, 0xBF, 0x82, 0xFE, 0xBF, 0x82, 0xFE, 0xBF, 0x41, 0xFD, 0x7F, 0x41,
-    0xFD, 0x7F, 0x41, 0xFD, 0x7F, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x0F,
-    0xD0, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0xFE, 0x5B, 0xF5,
-    0x50, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x80,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x05, 0x6F, 0xD5, 0xFF, 0x55, 0x40, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00,
-    0x00, 0xFE, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00,
-    0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x6F, 0xFA, 0x40, 0x02, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xDB, 0x96, 0xF0, 0xBF, 0xD2, 0xE0, 0x04, 0x2F, 0xF4, 0xB8, 0x00, 0x07,
-    0xFF, 0x6E, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0xB8,
-    0xFF, 0xE0, 0x00, 0x2E, 0x0F, 0xFD, 0x80, 0x0B, 0x87, 0xFE, 0xBF, 0x96, 0xFB, 0xFF, 0x6F, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x6B, 0xF5, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xCB, 0xF8, 0x00, 0x3F, 0x80, 0x00,
-    0x2F, 0xD0, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x1F, 0xE0, 0x00, 0x03, 0xFC,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x02, 0xFD, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xBF,
-    0x43, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC2, 0xFD, 0x06, 0xA0, 0x02, 0xFD, 0x0F, 0xF0, 0xFF,
-    0x0F, 0xFF, 0x80, 0x3F, 0xDB, 0xF8, 0xBF, 0x4F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFC, 0x3F, 0x8B, 0xFE,
-    0xFF, 0x00, 0xFF, 0xFD, 0x3F, 0xC3, 0xFC, 0x1F, 0xE0, 0x06, 0xE8, 0x1F, 0xE0, 0xFF, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x3F, 0xC0, 0x00,
-    0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0xBF, 0x80, 0x00, 0x3F, 0x80, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x02,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0x6F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0x00, 0x2F, 0xF8, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xF4, 0x3F, 0xF8, 0xBF, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x2F, 0xFD, 0xFF, 0xD0, 0xBF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0xBF, 0xF0, 0x00, 0xBF, 0xFE,
-    0x00, 0x7F, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFD, 0xBF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x2F, 0xFD, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xEF, 0xFA, 0xFE, 0xBF, 0xAF, 0xD7, 0xF5, 0xFD, 0x7F,
-    0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xFC, 0x00, 0x7F, 0xC0,
-    0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-    0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x54, 0xBF, 0x40, 0x0F, 0xF0,
-    0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF,
-    0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x0B, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x2F, 0xF0,
-    0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x7F, 0x80, 0x05, 0x40, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xD0, 0x2F, 0x80, 0x68, 0x2F, 0xFA, 0xFA, 0xFF, 0x83,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x15, 0xFF, 0xF5, 0x40, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x02,
-    0xFE, 0x07, 0xF8, 0x00, 0x02, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x06, 0xAA, 0xBF, 0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xC2, 0xFF, 0x0F, 0xF8, 0x3F, 0xC1, 0xFF,
-    0x0B, 0xF4, 0x3F, 0xC0, 0x54, 0x00, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0xBF, 0xC0, 0x14, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0x03,
-    0xFF, 0x83, 0xFF, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x0B, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x6F, 0xF4,
-    0x00, 0x7F, 0xEB, 0xFD, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x07, 0xFE, 0xBF, 0xD0, 0x01, 0xFF,
-    0x9F, 0xF4, 0x00, 0x7F, 0xE3, 0xFE, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x0F, 0xFC, 0x2F, 0xF8, 0x0B,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF3, 0xFF, 0xDF, 0xFC, 0x3F, 0x83,
-    0xFF, 0x07, 0x40, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x7F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00,
-    0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x7F, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFD, 0x03, 0xFF, 0xC0, 0xF4,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFE, 0x03, 0xE4, 0x03, 0xFF, 0xC0, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x17, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0A, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFE, 0xA4, 0x00, 0x0B, 0xFF, 0x6F, 0xFA, 0xBF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xBF, 0xE0,
-    0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x2F, 0xD3, 0xFE, 0x00, 0x01, 0xFE, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF0, 0x7F, 0xE0, 0x00, 0xBF, 0x41, 0xFF, 0x80, 0x07, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x1F, 0xF9, 0x55, 0x54, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x3F, 0xF1, 0xE4, 0x00, 0x3F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF,
-    0xFD, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x1F, 0xF0, 0x15, 0x40, 0x07, 0xFC, 0x7F, 0xFE, 0x02, 0xFF, 0x7F, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x97, 0xFF, 0xDF, 0xFF, 0x00, 0x2F, 0xFB, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xEF, 0xF0, 0x00, 0x3F, 0xF7, 0xFD, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x07,
-    0xFE, 0x3F, 0xF8, 0x03, 0xFF, 0x47, 0xFF, 0xEF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0x55,
-    0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFE, 0xAF, 0xFE, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC3, 0xFE, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x0B, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0x07, 0xFF, 0x43,
-    0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xBF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xF8, 0x7F, 0xE0, 0x03, 0xFF, 0x6F,
-    0xF0, 0x00, 0x3F, 0xEF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xBF, 0xE0, 0x01, 0xFF,
-    0x9F, 0xFE, 0x56, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x01, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFD, 0x03, 0xFF, 0x8B,
-    0xFE, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0xFF, 0x80, 0x0F, 0xFF, 0x7F, 0xF8, 0x1F, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xE3, 0xFE, 0x00, 0x6A, 0x90, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x03,
-    0xAA, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xE4, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x06, 0x40, 0xBF, 0xC3, 0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0F,
-    0xFD, 0x3F, 0xF8, 0xFF, 0xD2, 0xFF, 0x00, 0x50, 0x06, 0x40, 0xBF, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F,
-    0xF4, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x2F, 0xF0, 0xBF, 0xC3, 0xFE, 0x0F, 0xF0, 0x7F, 0xC2, 0xFD, 0x0F, 0xF0,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0x40, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x10, 0x6A,
-    0xAA, 0xAA, 0xAA, 0x6F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x6F, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F,
-    0x40, 0x1F, 0xFC, 0x04, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x1B, 0xFF, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x07, 0xF8, 0x00,
-    0xAF, 0xA4, 0x0B, 0xF4, 0x0F, 0xF0, 0x0B, 0xFF, 0xFF, 0x43, 0xF8, 0x1F, 0xD0, 0x3F, 0xFF, 0xFF,
-    0x42, 0xFC, 0x2F, 0xC0, 0xBF, 0xD0, 0xBF, 0x41, 0xFC, 0x3F, 0x81, 0xFF, 0x00, 0x7F, 0x41, 0xFD,
-    0x3F, 0x42, 0xFD, 0x00, 0x7F, 0x00, 0xFD, 0x7F, 0x43, 0xFC, 0x00, 0xBF, 0x00, 0xFD, 0x7F, 0x03,
-    0xFC, 0x00, 0xBF, 0x01, 0xFC, 0x7F, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFC, 0x7F, 0x43, 0xFC, 0x00,
-    0xFF, 0x03, 0xFC, 0x7F, 0x42, 0xFE, 0x02, 0xFF, 0x47, 0xF4, 0x3F, 0x80, 0xFF, 0xEF, 0xFF, 0xEF,
-    0xF0, 0x3F, 0xC0, 0x7F, 0xFF, 0xCF, 0xFF, 0xC0, 0x2F, 0xD0, 0x1F, 0xFE, 0x03, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0xFF, 0xFE, 0x56, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00,
-    0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56,
-    0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4,
-    0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC,
-    0x3F, 0xFF, 0xFA, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xF0, 0x06, 0xFF, 0xE0, 0xFF, 0xC0, 0x02, 0xFF, 0xC3, 0xFF, 0x00, 0x07,
-    0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0xFF, 0xD5, 0x5F, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xEA,
-    0xAF, 0xFF, 0x43, 0xFF, 0x00, 0x0B, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x3F,
-    0xF4, 0xFF, 0xC0, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x07, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x06, 0xF0,
-    0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xF5, 0x5B, 0xFF, 0xF8, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0x00,
-    0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0x0F, 0xFC, 0x00,
-    0x07, 0xFF, 0x83, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xC0, 0x5F, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF9,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF,
-    0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xEA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xEA, 0xAA, 0x8F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x40, 0x6F, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x05, 0x55, 0x54, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x4F, 0xFC,
-    0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x3F, 0xF8,
-    0x00, 0x01, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x3F, 0xFC,
-    0x00, 0x07, 0xFD, 0x07, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0xFF, 0xD5, 0x55, 0x5F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA, 0xAA, 0xAF, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x15, 0xBF, 0xF4, 0x7F, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0xFF,
-    0xC0, 0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0xFF, 0xC1, 0xFF,
-    0xD0, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xF6, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0xFF, 0xC0,
-    0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFD, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xDF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xBF, 0xC0, 0x00, 0xBF, 0xBF, 0xDF,
-    0xF7, 0xFC, 0x00, 0x0F, 0xF7, 0xFD, 0xFF, 0x6F, 0xD0, 0x00, 0xFF, 0x3F, 0xDF, 0xF5, 0xFE, 0x00,
-    0x1F, 0xD3, 0xFD, 0xFF, 0x4F, 0xF0, 0x03, 0xFC, 0x3F, 0xDF, 0xF4, 0xFF, 0x40, 0x3F, 0xC7, 0xFD,
-    0xFF, 0x47, 0xF8, 0x07, 0xF4, 0x7F, 0xDF, 0xF8, 0x3F, 0xC0, 0xFF, 0x07, 0xFD, 0xFF, 0x83, 0xFD,
-    0x0F, 0xF0, 0x7F, 0xDF, 0xF8, 0x2F, 0xE1, 0xFE, 0x07, 0xFD, 0xFF, 0x80, 0xFF, 0x3F, 0xC0, 0x7F,
-    0xDF, 0xF8, 0x0F, 0xF7, 0xFC, 0x07, 0xFD, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x7F, 0xDF, 0xF8, 0x07,
-    0xFF, 0xF0, 0x07, 0xFD, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x7F, 0xDF, 0xF8, 0x02, 0xFF, 0xE0, 0x07,
-    0xFD, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x7F, 0xDF, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xCF, 0xFF,
-    0xF4, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0xFF,
-    0xBF, 0xF0, 0x00, 0x7F, 0xCF, 0xF7, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xCF,
-    0xF4, 0xBF, 0xF0, 0x07, 0xFC, 0xFF, 0x43, 0xFF, 0x40, 0x7F, 0xCF, 0xF4, 0x2F, 0xFC, 0x07, 0xFC,
-    0xFF, 0x40, 0xFF, 0xD0, 0x7F, 0xCF, 0xF8, 0x07, 0xFF, 0x07, 0xFC, 0xFF, 0x80, 0x3F, 0xF8, 0x7F,
-    0xCF, 0xF8, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x80, 0x0B, 0xFF, 0x7F, 0xCF, 0xF8, 0x00, 0x3F, 0xFB,
-    0xFC, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0xCF, 0xF8, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xCF, 0xF8, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3F, 0xFF,
-    0xFA, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xF5, 0x6F, 0xFF, 0xC3, 0xFF, 0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0xC3,
-    0xFF, 0xAB, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xAA, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF,
-    0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC,
-    0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC,
-    0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00,
-    0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xA8, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x1B, 0xFF, 0xC0, 0x3F, 0xF0, 0x01,
-    0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF,
-    0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xF0, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0,
-    0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00,
-    0x7F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0x00, 0x7E, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF1, 0x40, 0x00, 0x0F,
-    0xFC, 0x7E, 0x40, 0x0B, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
-    0xFF, 0x80, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x57,
-    0xFF, 0x95, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF,
-    0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xDB, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x0F, 0xF8,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x07, 0xFD, 0x0B, 0xFC, 0x00, 0x00, 0x3F,
-    0xE0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF2, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x6F, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0xFF, 0x80,
-    0x00, 0xFF, 0xF4, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x7F, 0xFE, 0x00, 0x0B, 0xFC, 0x0B, 0xFC,
-    0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x3F,
-    0xE0, 0x03, 0xFE, 0xFD, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x01, 0xFE, 0x7F, 0x80, 0x2F, 0xF0, 0x02,
-    0xFF, 0x00, 0xBF, 0x4F, 0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xC3, 0xFC, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x0F, 0xF0, 0xFF, 0x41, 0xFF, 0x40, 0x03, 0xFF, 0x07, 0xFC, 0x2F, 0xE0, 0xBF, 0xC0,
-    0x00, 0xBF, 0xC2, 0xFD, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0xFF, 0x00, 0xFF, 0x0F, 0xF8,
-    0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x3F, 0xD7, 0xFD, 0x00, 0x00, 0xFF, 0x9F, 0xE0, 0x0B, 0xF9, 0xFF,
-    0x00, 0x00, 0x2F, 0xFB, 0xF4, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF,
-    0xD0, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x03,
-    0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC2,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x0B, 0xFF,
-    0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x2F,
-    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F, 0xFC, 0x00, 0x01, 0xFF, 0xC3,
-    0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF8, 0x00,
-    0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x07, 0xFF, 0x00, 0x00,
-    0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0x2F, 0xFF, 0xCB, 0xFF, 0xF2, 0xFF, 0xA8, 0xBF, 0x80,
-    0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00,
-    0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02,
-    0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B,
-    0xFF, 0xF2, 0xFF, 0xFC, 0xBF, 0xFF, 0x05, 0x55, 0x40, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x8F, 0xFF, 0xE3, 0xFF, 0xF8, 0xAB, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B,
-    0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F,
-    0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF,
-    0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE3, 0xFF, 0xF8, 0xFF, 0xFE,
-    0x3F, 0xFF, 0x85, 0x55, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xBF,
-    0x00, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00,
-    0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x0F, 0xF0,
-    0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x0A, 0x90, 0x00, 0x01,
-    0xA8, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0x55, 0x00, 0x6A, 0xA0, 0x03,
-    0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0xBE, 0x00, 0x05, 0x65, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xF5, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x5B, 0xFE, 0x01, 0xBF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFE, 0xBF, 0xF9, 0xFF, 0xD0, 0x07, 0xFE, 0xBF,
-    0xE0, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x7F, 0xF9, 0xFF, 0xE5, 0xBF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xE0, 0x7F, 0xFE, 0x03, 0xF8, 0x00, 0x50, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFD, 0x01, 0x94, 0x00, 0xBF, 0xD3, 0xFF, 0xF0, 0x0B, 0xFD, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xEA, 0xFF, 0xF8, 0xBF, 0xF4, 0x02, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFC,
-    0xBF, 0xE0, 0x00, 0xFF, 0xDB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00,
-    0x0B, 0xFD, 0xBF, 0xE0, 0x00, 0xFF, 0xDB, 0xFE, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x01, 0xFF, 0xCB,
-    0xFF, 0x80, 0x3F, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xCF, 0xFF,
-    0xFC, 0x0B, 0xF8, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00,
-    0x6F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F,
-    0xFC, 0x00, 0x10, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x28, 0x0F, 0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x65, 0x07, 0xFE, 0x00,
-    0xFF, 0xFC, 0x7F, 0xE0, 0x3F, 0xFF, 0xF7, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFA, 0xBF,
-    0xFE, 0x3F, 0xFC, 0x01, 0xFF, 0xE3, 0xFF, 0x40, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0x7F, 0xE7, 0xFF,
-    0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x3F,
-    0xE7, 0xFF, 0x00, 0x07, 0xFE, 0x3F, 0xF4, 0x00, 0xBF, 0xE3, 0xFF, 0xC0, 0x1F, 0xFE, 0x1F, 0xFF,
-    0xEF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x3F, 0xE0, 0x0B, 0xFF, 0x81, 0xFE,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0x03, 0xFF, 0x42, 0xFF, 0x80, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x07, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0x00, 0xFF, 0xF9, 0x5B, 0xF4, 0x07, 0xFF, 0xFF,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x01, 0x55, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF,
-    0xE6, 0x90, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF,
-    0x81, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x0A, 0xFF, 0xEA, 0x90, 0x02, 0xFF, 0x40, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0xD3, 0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x9B, 0xFF, 0xE3, 0xFF, 0xC0, 0x0F, 0xFE, 0x3F, 0xF4, 0x00, 0xBF,
-    0xE7, 0xFF, 0x00, 0x07, 0xFE, 0x7F, 0xF0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xE0,
-    0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x3F, 0xE3, 0xFF, 0x40, 0x0B, 0xFE,
-    0x3F, 0xFC, 0x01, 0xFF, 0xE1, 0xFF, 0xFA, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xF7, 0xFE, 0x00, 0xBF, 0xF8, 0x7F, 0xE0, 0x00, 0x54, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x0F, 0xFD, 0x1E, 0x40, 0x07, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xBF, 0xFE, 0x80, 0x00, 0x15, 0x40, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0x94, 0x00, 0xBF,
-    0xD3, 0xFF, 0xF8, 0x0B, 0xFD, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xF9, 0xBF,
-    0xFC, 0xBF, 0xF8, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xDB, 0xFE,
-    0x00, 0x0B, 0xFD, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF,
-    0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0,
-    0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD,
-    0x05, 0x07, 0xFD, 0xBF, 0xEB, 0xFE, 0x7F, 0xD0, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xEB, 0xFE, 0xBF,
-    0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB,
-    0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0x00, 0x05, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xE0, 0x0B,
-    0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x0B, 0xFD,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00,
-    0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF,
-    0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0,
-    0x1F, 0xFD, 0xFF, 0xFF, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0B, 0xFE, 0x40, 0x15, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xE1, 0xFF, 0x80, 0x0F, 0xFE, 0x07, 0xFE, 0x00, 0xFF, 0xE0,
-    0x1F, 0xF8, 0x0F, 0xFF, 0x00, 0x7F, 0xE0, 0xBF, 0xF0, 0x01, 0xFF, 0x8B, 0xFF, 0x00, 0x07, 0xFD,
-    0x7F, 0xF0, 0x00, 0x1F, 0xFB, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x2F, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x01,
-    0xFF, 0x80, 0x7F, 0xF4, 0x07, 0xFE, 0x00, 0xBF, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xF0, 0x7F, 0xE0,
-    0x00, 0xFF, 0xE1, 0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x15, 0x4B, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB,
-    0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD,
-    0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0x00,
-    0x00, 0x19, 0x40, 0x00, 0x69, 0x00, 0x2F, 0xE1, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x0B, 0xFD, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xAF, 0xFF,
-    0xFE, 0x6F, 0xFF, 0x2F, 0xFE, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xCB, 0xFF, 0x00, 0x1F, 0xFD, 0x00,
-    0x3F, 0xF2, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF2, 0xFF,
-    0x40, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x2F, 0xF4, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF2, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1A, 0x40, 0x0B, 0xF8, 0x3F,
-    0xFF, 0x80, 0xBF, 0xCF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0x9B, 0xFF, 0xCB,
-    0xFF, 0x80, 0x1F, 0xFC, 0xBF, 0xF0, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00,
-    0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF,
-    0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00,
-    0x01, 0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0x57, 0xFF, 0xC0, 0xBF, 0xF0, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x07, 0xFF,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFE,
-    0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xD0, 0x02,
-    0xFF, 0x82, 0xFF, 0xC0, 0x0F, 0xFD, 0x03, 0xFF, 0xEA, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x40, 0x0B, 0xF8, 0x3F, 0xFF, 0x40, 0xBF, 0xCF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFE, 0xAF, 0xFF, 0x8B, 0xFF, 0x40, 0x2F, 0xFC, 0xBF, 0xF0, 0x00, 0xFF, 0xCB, 0xFE, 0x00,
-    0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB,
-    0xFE, 0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x1F, 0xFC, 0xBF, 0xF8, 0x03,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFD, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xD2, 0xFF, 0xE0, 0x0B, 0xFD, 0x01, 0x50, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0xC3,
-    0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x5B, 0xFF, 0xE3, 0xFF,
-    0xC0, 0x0F, 0xFE, 0x3F, 0xF4, 0x00, 0xBF, 0xE7, 0xFF, 0x00, 0x07, 0xFE, 0x7F, 0xF0, 0x00, 0x3F,
-    0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xF0,
-    0x00, 0x7F, 0xE3, 0xFF, 0x40, 0x0B, 0xFE, 0x3F, 0xFC, 0x01, 0xFF, 0xE1, 0xFF, 0xFA, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF7, 0xFE, 0x00, 0xBF, 0xF8, 0x7F, 0xE0, 0x00, 0x54,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x19, 0x2F, 0xD0, 0xBF, 0xDB, 0xF8, 0xBF, 0xF6, 0xFF, 0xBF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xD0, 0x4B, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B,
-    0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x16, 0x94, 0x00, 0x0B, 0xFF, 0xFE, 0x41, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF4, 0x7F,
-    0xE0, 0x0B, 0xC1, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0xBF, 0xD6, 0x00, 0x02, 0xFF, 0x5F, 0xE5, 0x6F, 0xFC, 0x7F, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x2B, 0xFF, 0xAA, 0x80, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0xAD, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F,
-    0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFE, 0x00, 0x2F, 0xFC, 0xBF, 0xF4,
-    0x07, 0xFF, 0xC7, 0xFF, 0xFB, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE3, 0xFC,
-    0x02, 0xFF, 0xF4, 0x3F, 0xC0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00,
-    0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x01, 0xFF,
-    0x40, 0x03, 0xFE, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00,
-    0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0xBF, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xE0, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x80, 0x1F, 0xF4, 0x2F, 0xF0, 0x07, 0xFF, 0xF0, 0x0B, 0xFC, 0x07, 0xFD, 0x02, 0xFE,
-    0xFC, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0xFE, 0x7F, 0x40, 0xFF, 0x80, 0x3F, 0xF0, 0x3F, 0x8F, 0xE0,
-    0x7F, 0xD0, 0x07, 0xFD, 0x1F, 0xD3, 0xFC, 0x2F, 0xF0, 0x00, 0xFF, 0x8B, 0xF0, 0xBF, 0x0F, 0xF8,
-    0x00, 0x3F, 0xE3, 0xFC, 0x1F, 0xD3, 0xFD, 0x00, 0x0B, 0xFC, 0xFE, 0x03, 0xF9, 0xFF, 0x00, 0x01,
-    0xFF, 0x3F, 0x40, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEF, 0xC0, 0x2F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xF0, 0x07, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x01, 0xFF, 0xCB, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xCF, 0xFD, 0x00, 0x03, 0xFF, 0x87, 0xFF, 0x00, 0x0B, 0xFF, 0x02,
-    0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0xBF, 0xF0, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x0B,
-    0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x02, 0xFF,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xCF,
-    0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x6A, 0xAA, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x01, 0xAE, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xE0, 0x00,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
-    0xC0, 0x00, 0xFF, 0xC0, 0x17, 0xFF, 0x80, 0xBF, 0xFF, 0x00, 0xBF, 0xE4, 0x00, 0xBF, 0xFD, 0x00,
-    0x7F, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xF9, 0x00, 0x3F,
-    0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6A, 0xBA, 0x40, 0x00, 0xBF,
-    0xF4, 0x00, 0xBF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00,
-    0x02, 0xFF, 0xD4, 0x00, 0xBF, 0xFE, 0x00, 0x1B, 0xFE, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFD, 0x02,
-    0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x6F, 0xFD, 0x00, 0xBF, 0xFC, 0x00, 0xBF, 0xF8, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0xAB, 0xFF,
-    0xFF, 0xEA, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xB8, 0x07, 0xFF, 0xFF, 0x50, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0x7F, 0xC0, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC2, 0xFF, 0x0B, 0xFC,
-    0x2F, 0xF0, 0xBF, 0xC3, 0xFF, 0x0F, 0xFC, 0x3F, 0xF4, 0xFF, 0xD3, 0xFF, 0x4F, 0xFD, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00,
-    0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xD6, 0xFC, 0x3F, 0xF8,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0xFF, 0xF0, 0x01, 0x91, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x01,
-    0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFC, 0x01, 0x90, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x57, 0xFF, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x02, 0xFE, 0xFF, 0xEF, 0xE0,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-    0x80, 0x3F, 0x40, 0x0B, 0xF0, 0x0F, 0xD0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0xBF, 0x40,
-    0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8,
-    0x6A, 0x4B, 0xC0, 0x04, 0x00, 0x00, 0x80, 0xBF, 0xD0, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC3, 0xFF, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F,
-    0xF8, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x00, 0xBF, 0xCF,
-    0xF8, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x02, 0xAF, 0xFF, 0xEA, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x15,
-    0xFF, 0xD5, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x06, 0xAF, 0xFE, 0xA4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0x57, 0xFF, 0x55, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6A, 0x00, 0x15, 0x50, 0x00, 0x2F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xAB, 0xFC, 0x3F, 0xC0, 0x06, 0x43, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x1F, 0xEB,
-    0xFF, 0x83, 0xFC, 0x07, 0xFC, 0x3F, 0x80, 0x1F, 0xD3, 0xFC, 0x00, 0xFE, 0x3F, 0xE0, 0x1F, 0xD1,
-    0xFF, 0xD3, 0xFC, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFE, 0x78, 0x00, 0x3F, 0xD7, 0xFF, 0xBF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFD,
-    0xBF, 0x82, 0xFF, 0xFF, 0x82, 0xFF, 0x7F, 0x40, 0xFD, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x16,
-    0x50, 0x2F, 0x80, 0x07, 0xC0, 0x1F, 0xFF, 0xD0, 0xBD, 0x00, 0xF4, 0x07, 0xFF, 0xFC, 0x03, 0xF0,
-    0x1F, 0x00, 0xFD, 0x00, 0x40, 0x1F, 0x43, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0xF8, 0x3C, 0x03, 0xF0,
-    0x00, 0x00, 0x0B, 0xC7, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x07, 0xD0, 0x00, 0x00, 0x07,
-    0xC7, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xC3, 0xC0, 0x3E,
-    0x00, 0x00, 0x00, 0xBC, 0x3D, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x82, 0xF0, 0x1F, 0x80, 0x00, 0x00,
-    0xF4, 0x0F, 0x40, 0xFF, 0xAB, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xFF, 0xFC, 0x07, 0xD0, 0x03, 0xF0,
-    0x02, 0xA9, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x0F, 0xAB,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x6A, 0xFD, 0x0B, 0xFF, 0xFD, 0x2F, 0xE5, 0xFD, 0x3F, 0x40, 0xFD,
-    0x3F, 0x42, 0xFD, 0x3F, 0xEF, 0xFD, 0x1F, 0xFF, 0x7D, 0x06, 0xE4, 0x28, 0x00, 0x08, 0x00, 0x09,
-    0x00, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0x0B, 0xFE, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x03,
-    0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x2F, 0xF8, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x2F, 0xF8, 0x1F,
-    0xFC, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x7F, 0xF0,
-    0x00, 0xFF, 0xD0, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x01,
-    0xF4, 0x00, 0xF4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0x6F, 0xFF, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x0F, 0xE0, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x05, 0x55, 0x00, 0x2F, 0x80, 0x07, 0xC0, 0xFF, 0xFF, 0x00, 0xBD, 0x00, 0xF4, 0x0F,
-    0xFF, 0xFC, 0x03, 0xF0, 0x1F, 0x00, 0xFC, 0x0B, 0xE0, 0x1F, 0x43, 0xE0, 0x0F, 0xC0, 0x3F, 0x00,
-    0xF8, 0x3C, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xC7, 0xC0, 0x0F, 0xC0, 0x7E, 0x00, 0x7C, 0x7C, 0x00,
-    0xFD, 0x6F, 0xC0, 0x07, 0xC7, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x7C, 0x7C, 0x00, 0xFF, 0xFE, 0x00,
-    0x07, 0xC3, 0xC0, 0x0F, 0xC2, 0xF0, 0x00, 0xBC, 0x3D, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0x82, 0xF0,
-    0x0F, 0xC0, 0xBD, 0x00, 0xF4, 0x0F, 0x40, 0xFC, 0x03, 0xF0, 0x2F, 0x00, 0xBC, 0x0F, 0xC0, 0x1F,
-    0x87, 0xD0, 0x03, 0xF0, 0x54, 0x00, 0x55, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x7F, 0x90, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF2, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0x41, 0xFD, 0xBE, 0x00, 0xBE, 0xBE, 0x00, 0x7F,
-    0xBE, 0x00, 0xBE, 0x7F, 0x41, 0xFD, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF4, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x06, 0xAA, 0xBF, 0xAA, 0xA6,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0x9B, 0xFF,
-    0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x0B,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xF4, 0x2F, 0xEF, 0xFC, 0x0A, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x0B,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1F, 0x9B, 0xFC, 0x04, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x5B,
-    0xF4, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x00, 0x06, 0xFD, 0x00, 0x00, 0xFE, 0x10, 0x00, 0xFE,
-    0x3F, 0xAB, 0xFD, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x00, 0x55, 0x00, 0x00, 0xAA, 0x90, 0x2F,
-    0xFC, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00,
-    0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF,
-    0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xFF, 0xDB, 0xFD, 0x00, 0x0F,
-    0xFD, 0xBF, 0xE0, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x1F, 0xFD, 0xBF, 0xF4, 0x03, 0xFF, 0xDB, 0xFF,
-    0xFB, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF3, 0xFD, 0xBF, 0xEF, 0xFC, 0x2F,
-    0xDB, 0xFD, 0x14, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x0B, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0xBF, 0x2F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF, 0xF4, 0x2F,
-    0x3F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF, 0xF4, 0x2F, 0x7F, 0xFF, 0xFF, 0x42, 0xF7, 0xFF, 0xFF,
-    0xF4, 0x2F, 0x3F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF, 0xF4, 0x2F, 0x3F, 0xFF, 0xFF, 0x42, 0xF2,
-    0xFF, 0xFF, 0xF4, 0x2F, 0x0F, 0xFF, 0xFF, 0x42, 0xF0, 0x7F, 0xFF, 0xF4, 0x2F, 0x00, 0xBF, 0xFF,
-    0x42, 0xF0, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x01, 0xF4, 0x2F, 0x00,
-    0x00, 0x1F, 0x42, 0xF0, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x01, 0xF4,
-    0x2F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00,
-    0x01, 0xF4, 0x2F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0xBF, 0xC0, 0x14, 0x00, 0x07, 0xD0,
-    0x02, 0xF8, 0x00, 0xBF, 0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x1F, 0xFF, 0xC7, 0xFF, 0xD0, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x7F, 0xFC, 0xBF, 0xFF, 0x1F, 0xEF, 0xC2, 0x87, 0xF0,
-    0x01, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x1F, 0xFB, 0xFC,
-    0x3F, 0xC0, 0xFE, 0x3F, 0x40, 0xBF, 0x3F, 0x40, 0x7F, 0x3F, 0x40, 0x7F, 0x3F, 0x40, 0xBF, 0x2F,
-    0xC0, 0xFE, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x00, 0x6E, 0x40, 0x02, 0x00, 0x01, 0x40, 0x00,
-    0x7F, 0x00, 0x7F, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x07, 0xFF, 0x00, 0x0F, 0xFD,
-    0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x1F,
-    0xFC, 0x00, 0xBF, 0xE0, 0x7F, 0xF0, 0x0B, 0xFE, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x3F, 0xF4, 0x03,
-    0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x2F, 0xF8, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xB8, 0x00,
-    0xBC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x7F, 0x40, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x0D, 0x3F, 0x80, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x05, 0x40, 0x00, 0x3F, 0x80,
-    0x7F, 0x80, 0x3F, 0xD0, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0x81, 0xFD, 0x01,
-    0xFF, 0xD0, 0x00, 0x3F, 0x83, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x15, 0x4B, 0xF4, 0x0B, 0xEF, 0xD0,
-    0x00, 0x00, 0x0F, 0xF0, 0x1F, 0x6F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x3F, 0x2F, 0xD0, 0x00, 0x00,
-    0x3F, 0x80, 0xBC, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x01, 0xF8, 0x2F, 0xD0, 0x00, 0x01, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xF4, 0x01, 0xAA, 0xBF,
-    0xE8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0xFF,
-    0x00, 0x00, 0x0D, 0x3F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x3F, 0xC0, 0x6A, 0x40, 0x00, 0x3F, 0x80, 0x7F, 0x87, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0xFF,
-    0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0x81, 0xFD, 0x0F, 0xEB, 0xFD, 0x00, 0x3F, 0x83, 0xFC, 0x02, 0x01,
-    0xFE, 0x00, 0x15, 0x4B, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xF9, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x08, 0x07, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x07, 0xF4, 0x00, 0x00, 0x0A, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x82, 0xFD, 0x01,
-    0x54, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x2F, 0xF0, 0xB8, 0x07, 0xF8, 0xBF, 0x00, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xD7, 0xF8, 0x0F, 0xFF, 0x07, 0xFF, 0xFD, 0x3F, 0xC0, 0xBF, 0xFC, 0x01, 0xAA, 0x41, 0xFE,
-    0x03, 0xDF, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x42, 0xF4, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x0F, 0x83, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0xFD, 0x0F, 0xF0, 0x00, 0x00,
-    0xFF, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x2A,
-    0xAB, 0xFE, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x10,
-    0x3F, 0xF4, 0x06, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0x6F, 0xFE, 0x40, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x3F,
-    0xD0, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x47, 0xFF,
-    0xC0, 0x00, 0x00, 0x3D, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00,
-    0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x2F,
-    0xC0, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x3E,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF,
-    0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F,
-    0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE,
-    0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x95, 0x55, 0x50, 0x00, 0x0B, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xFD, 0x55, 0x54, 0x00, 0x0F, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x1F, 0xFE, 0xAA, 0xA8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0x56, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xB4, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x06,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xEF, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x2A, 0xA4, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xAA, 0x80, 0x00,
-    0x7F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x6A, 0x90, 0x00, 0x1F,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x6F, 0xF0, 0x3F, 0xD0, 0xBF, 0x8B, 0xE0, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x03, 0xF4, 0x3F, 0xE0, 0xBF, 0xC3, 0xFE, 0x0B, 0xFC, 0x1F, 0xC0, 0x7F, 0x40, 0x10, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x6A, 0xA0, 0x00, 0x3F, 0xF8,
-    0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1B, 0xFF, 0xF8, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x0A, 0xA8, 0x00, 0x3F,
-    0xF8, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x6F, 0xFF, 0xE0, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x2F,
-    0xFF, 0xE0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x00, 0x2A, 0xA0, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0x7F, 0xD0, 0x1F, 0xE0, 0x3F, 0xD0, 0xFD, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x87, 0xFC, 0x0F, 0xF5, 0xFF, 0x03, 0xFD,
-    0x3F, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x6F, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0,
-    0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xA4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0x55, 0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xF0,
-    0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x9F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFE,
-    0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xF9, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xE1, 0x7F, 0xF5, 0x50, 0x03,
-    0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFC, 0x00,
-    0x07, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC0, 0x5F, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7D, 0x00,
-    0x00, 0x3F, 0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x2F, 0xFF, 0x00,
-    0x00, 0x0F, 0x40, 0x1E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0xFE, 0x00, 0x00,
-    0x7F, 0xCF, 0xFF, 0xF4, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF, 0xFF, 0xFD, 0x00,
-    0x07, 0xFC, 0xFF, 0xBF, 0xF0, 0x00, 0x7F, 0xCF, 0xF7, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x4F, 0xFC,
-    0x00, 0x7F, 0xCF, 0xF4, 0xBF, 0xF0, 0x07, 0xFC, 0xFF, 0x43, 0xFF, 0x40, 0x7F, 0xCF, 0xF4, 0x2F,
-    0xFC, 0x07, 0xFC, 0xFF, 0x40, 0xFF, 0xD0, 0x7F, 0xCF, 0xF8, 0x07, 0xFF, 0x07, 0xFC, 0xFF, 0x80,
-    0x3F, 0xF8, 0x7F, 0xCF, 0xF8, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x80, 0x0B, 0xFF, 0x7F, 0xCF, 0xF8,
-    0x00, 0x3F, 0xFB, 0xFC, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0xFF,
-    0x80, 0x00, 0x7F, 0xFF, 0xCF, 0xF8, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xCF,
-    0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4,
-    0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x00,
-    0x1F, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F,
-    0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
-    0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00,
-    0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0xBC, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xC6, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x1F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF,
-    0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00,
-    0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00,
-    0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07,
-    0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x07, 0x03, 0xF4, 0x00, 0x7F, 0x2F, 0xF4,
-    0x07, 0xFE, 0x2F, 0xF4, 0x7F, 0xE0, 0x2F, 0xFB, 0xFE, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF4, 0x07, 0xFE, 0x2F, 0xF0,
-    0x7F, 0xE0, 0x2F, 0xF1, 0xFE, 0x00, 0x2F, 0xE2, 0xE0, 0x00, 0x2E, 0x01, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x8F,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x1F,
-    0xFD, 0x00, 0x0F, 0xFF, 0xF8, 0x2F, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x3F, 0xF8, 0x00, 0x3F, 0x9F,
-    0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0x0F, 0xFD, 0x3F, 0xF4, 0x02, 0xFC, 0x0F, 0xFD, 0x3F, 0xF0, 0x03,
-    0xF8, 0x0F, 0xFD, 0x3F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFD, 0x3F, 0xF4, 0x2F, 0xC0, 0x0F, 0xFD, 0x3F,
-    0xF4, 0x3F, 0x80, 0x0F, 0xFD, 0x3F, 0xF8, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0xFC, 0x00, 0x2F,
-    0xFC, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFA, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0xF0, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F,
-    0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF,
-    0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3,
-    0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF,
-    0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC,
-    0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80,
-    0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xDF, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x3F, 0x80,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF,
-    0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x07, 0xFC, 0x0F, 0xF4,
-    0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF,
-    0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3,
-    0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F,
-    0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F,
-    0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F, 0xFC,
-    0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE,
-    0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03, 0xFF,
-    0x07, 0xFF, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x40, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xC0, 0x1F, 0xFF, 0x3F, 0xF0, 0x00,
-    0xFF, 0xCF, 0xFC, 0x00, 0x3F, 0xF7, 0xFF, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x03, 0xFF, 0x7F, 0xF0,
-    0x00, 0xFF, 0xCF, 0xFC, 0x01, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE4, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0x9B, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x2F, 0xFC, 0x0B, 0xFE, 0x00, 0x03,
-    0xFF, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0xFF, 0xD0, 0x2F, 0xF4, 0x00, 0xFF,
-    0xE0, 0x0B, 0xFD, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0xBF, 0xD0, 0xBF, 0xE0,
-    0x00, 0x2F, 0xF4, 0x2F, 0xFC, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0xBF, 0xFF,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFF, 0xF4, 0x2F, 0xF4, 0x00, 0x7F, 0xFF, 0x4B, 0xFD, 0x00, 0x02, 0xFF,
-    0xF2, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xFF,
-    0xCB, 0xFD, 0x0F, 0x95, 0xFF, 0xF2, 0xFF, 0x43, 0xFF, 0xFF, 0xF8, 0xBF, 0xD0, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xF4, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE,
-    0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F,
-    0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF,
-    0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFD, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F,
-    0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40,
-    0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF,
-    0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xC0, 0x1F, 0xFF, 0xEB,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xE1, 0xBF, 0xF4, 0x01, 0xF0, 0x02, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF,
-    0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01,
-    0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF,
-    0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00,
-    0x3F, 0xE0, 0xBF, 0xC0, 0x0F, 0xF8, 0x2F, 0xF0, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x04, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF,
-    0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC,
-    0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x03, 0xF6, 0xFC, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00,
-    0x0F, 0xEB, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x59, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0xBD, 0x42, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x56, 0xFF, 0x80, 0x6F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xAF, 0xFE, 0x7F,
-    0xF4, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x7F, 0xEB, 0xFD, 0x00, 0x2F, 0xFA, 0xFF, 0x80, 0x1F, 0xFE,
-    0x7F, 0xF9, 0x6F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xF8, 0x1F, 0xFF, 0x80,
-    0xFE, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x05, 0x94, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x02, 0xE4, 0x0B, 0xFF, 0xF4, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x0B, 0xFC,
-    0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFA, 0xBF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x81, 0xFF, 0xE5, 0xBF, 0xFF, 0xF9, 0x5B, 0xF0, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x40,
-    0x00, 0x54, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F, 0xFC, 0x00, 0x10, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x28, 0x0F, 0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00,
-    0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xA9, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10,
-    0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x7F, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xFE, 0x0B, 0xFC, 0x00, 0x3F,
-    0xE0, 0xBF, 0xC0, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC,
-    0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x7F, 0xF0,
-    0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0x0B,
-    0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x2F, 0xF8, 0x00,
-    0xBF, 0xE0, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x80,
-    0x0B, 0xFE, 0x00, 0x00, 0xAA, 0x90, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE,
-    0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00,
-    0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF,
-    0xE0, 0x0B, 0xFE, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x1F, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0xFF,
-    0xAF, 0xF0, 0x3F, 0xD0, 0x7F, 0xC7, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0xFD, 0xFF, 0x82, 0xFF, 0xFF, 0x82, 0xFF, 0x7F, 0x41, 0xFD, 0x04, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80,
-    0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02,
-    0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x02, 0xFF, 0xAF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xE1, 0xFF, 0x80, 0x00, 0x09, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0xFF, 0xE7,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFE, 0xAF, 0xFF, 0xC3,
-    0xFF, 0x80, 0x0F, 0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF1, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x7F,
-    0xE0, 0xFF, 0xE0, 0x03, 0xFF, 0x41, 0xFF, 0xF5, 0x7F, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xE0, 0x02, 0xFF, 0xFE, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xD1, 0xFF, 0xF4, 0x00, 0xB8, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0xBF, 0x83, 0xFF, 0xF8, 0x0B, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x8B,
-    0xFF, 0xF9, 0xBF, 0xFC, 0xBF, 0xF8, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00,
-    0xFF, 0xDB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF,
-    0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD,
-    0x00, 0x0B, 0xFD, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC, 0x00, 0xFF,
-    0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x7F,
-    0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA, 0xBF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC, 0x00,
-    0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA, 0xBF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xF7, 0xFD, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xE0, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC,
-    0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA,
-    0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7D, 0x00,
-    0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xF0, 0xBF, 0xFC, 0x00, 0x0F, 0x40,
-    0x1E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F,
-    0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF,
-    0xFA, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xE0,
-    0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0,
-    0x2F, 0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40,
-    0xFF, 0xFA, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xAA, 0xAA, 0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x30, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0x6F, 0xFF, 0x03, 0xFF, 0x80,
-    0x7F, 0xFD, 0x0F, 0xFC, 0x03, 0xFF, 0xF8, 0x7F, 0xF0, 0x3F, 0xFF, 0xF1, 0xFF, 0x81, 0xFD, 0xFF,
-    0xC7, 0xFE, 0x0F, 0xE3, 0xFF, 0x1F, 0xF8, 0xFF, 0x0F, 0xFC, 0x7F, 0xE7, 0xF0, 0x3F, 0xF0, 0xFF,
-    0xFF, 0x80, 0xFF, 0xC3, 0xFF, 0xFC, 0x0B, 0xFE, 0x0B, 0xFF, 0xC0, 0x7F, 0xF4, 0x0F, 0xFF, 0xAF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x02, 0xC0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC,
-    0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00,
-    0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F,
-    0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0,
-    0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA9, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xF6, 0xFE, 0x00,
-    0x03, 0xFD, 0x0B, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF,
-    0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F,
-    0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F,
-    0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F,
-    0x00, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x02, 0xFC, 0x07, 0xF4, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0,
-    0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC,
-    0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00,
-    0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x7F,
-    0xF0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFC,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x02,
-    0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0xBF, 0xCB, 0xFC,
-    0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0x94, 0x00,
-    0xBF, 0xD3, 0xFF, 0xF0, 0x0B, 0xFD, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xEA,
-    0xFF, 0xF8, 0xBF, 0xF4, 0x02, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0xFF, 0xDB,
-    0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xE0, 0x00,
-    0xBF, 0xDB, 0xFE, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xCB, 0xFF, 0x80, 0x3F, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xDF, 0xFF, 0xFC, 0x0B, 0xFD, 0x2F, 0xFE,
-    0x00, 0xBF, 0xD0, 0x15, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x01,
-    0xFF, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x10,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x7F,
-    0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF, 0x80,
-    0x03, 0xFF, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00,
-    0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00,
-    0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF,
-    0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0xFC, 0x01, 0x55, 0x55, 0x54, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x40, 0x00, 0x1F, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xBD, 0x42, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x56, 0xFF, 0x80, 0x6F, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xAF, 0xFE, 0x7F, 0xF4, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x7F, 0xEB,
-    0xFD, 0x00, 0x2F, 0xFA, 0xFF, 0x80, 0x1F, 0xFE, 0x7F, 0xF9, 0x6F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
-    0xE1, 0xFF, 0xFF, 0xC7, 0xF8, 0x1F, 0xFF, 0x80, 0xFE, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x00, 0x01, 0xA0, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xFA, 0xBF, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F,
-    0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00,
-    0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00,
-    0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x02, 0xA0,
-    0x00, 0x29, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x2F, 0xFA, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F,
-    0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF,
-    0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0,
-    0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0,
-    0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55,
-    0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F,
-    0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x05, 0x65, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x02, 0xF5, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x01, 0x5B, 0xFE, 0x01, 0xBF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFE, 0xBF, 0xF9,
-    0xFF, 0xD0, 0x07, 0xFE, 0xBF, 0xE0, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x7F,
-    0xF9, 0xFF, 0xE5, 0xBF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xE0, 0x7F, 0xFE,
-    0x03, 0xF8, 0x00, 0x50, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xB4,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F, 0xFC, 0x00, 0x10, 0x3F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x28, 0x0F, 0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x3F, 0xD0, 0x00, 0x3F,
-    0x40, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01,
-    0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0xE0, 0x03, 0xFC, 0x0B, 0xF8, 0x0B, 0xE0,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F, 0xFC, 0x00, 0x10, 0x3F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x28, 0x0F, 0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x01, 0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F, 0xFC, 0x00, 0x10, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x28, 0x0F, 0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2A, 0x00, 0x01, 0xA4, 0x00, 0x2F, 0xE0, 0x0F,
-    0xF4, 0x00, 0x0F, 0xF8, 0x7F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x01, 0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x0A, 0x90, 0x00, 0x6A,
-    0x01, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x6F,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x3F, 0xFE, 0xAB, 0xC0, 0x2F,
-    0xFC, 0x00, 0x10, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x0A, 0x00, 0xFF, 0xFE, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01,
-    0xA8, 0x00, 0x0A, 0x90, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xF5,
-    0x5B, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00,
-    0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x8F, 0xFC, 0x00,
-    0x00, 0xFF, 0xE3, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0x0B, 0xFF, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x83, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xC0, 0x5F,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x55, 0x40, 0x00, 0x00,
-    0x1F, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x87, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xE2, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x19, 0x41, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0xE0, 0x00, 0x00,
-    0xFF, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0xAF, 0xFF,
-    0x80, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xFF,
-    0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xE0,
-    0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xC0,
-    0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x00,
-    0x01, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF,
-    0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x55, 0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x9F,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFE, 0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xF9, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xE1, 0x7F, 0xF5, 0x50, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00,
-    0xBF, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC0,
-    0x5F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x06, 0xAB, 0xFF, 0xE8, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x1A, 0xAB, 0xFF, 0xA0, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x05, 0x50, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0x1F, 0xF8, 0x00, 0x7F,
-    0xFF, 0xF7, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xAB, 0xFF, 0xE0, 0x0F, 0xFF,
-    0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x80, 0x0B, 0xFE, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x7F, 0xF0,
-    0x00, 0x3F, 0xE0, 0x1F, 0xFC, 0x00, 0x0F, 0xF8, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0xD0,
-    0x00, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0x40, 0x3F, 0xF8, 0x02, 0xFF, 0xFE,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x3F, 0xE0, 0x00, 0x2F, 0xFD,
-    0x0B, 0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x42, 0xFF, 0xFF, 0xF8, 0x2F,
-    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFE, 0x01, 0x55, 0x55, 0x54, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8,
-    0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x2A, 0x00, 0x02, 0x93, 0xF0, 0x00, 0xBD, 0x2F, 0xFA, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFD, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55,
-    0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFE, 0x02, 0xA0, 0x00, 0x29, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0xAF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07,
-    0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0,
-    0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F,
-    0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFD, 0x50, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x01, 0xA9, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0x03, 0xFF, 0x42, 0xFF, 0x80, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x07, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0x00, 0xFF, 0xF9, 0x5B, 0xF4, 0x07, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x7F, 0x80,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x69, 0x00, 0x02, 0xA1, 0xFF, 0x00, 0xBF, 0x81, 0xFF, 0x4F, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xD5, 0x55,
-    0x43, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xAA, 0xAA, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF8, 0x06, 0x90, 0x00, 0x2A, 0x00, 0x3F, 0xD0, 0x1F,
-    0xF0, 0x00, 0xFF, 0x4B, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8,
-    0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x07, 0xF4, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xF9, 0x01, 0xBC, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x15, 0x55, 0x50, 0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x3F, 0xF0, 0x03, 0xFF, 0xFF,
-    0x4F, 0xFC, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0x40, 0x3F, 0xFF, 0xF4, 0xFF, 0xE0, 0x00, 0x07, 0xFD,
-    0x2F, 0xFC, 0x00, 0x01, 0xFF, 0x47, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0xFF, 0xF0, 0x00, 0x1F, 0xF4,
-    0x1F, 0xFF, 0x40, 0x0B, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0B, 0xFD,
-    0xFF, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x7F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x65, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x3F, 0xE0, 0x3F, 0xFF, 0xF7, 0xFE, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE1, 0xFF, 0xF9, 0xBF, 0xFE, 0x3F, 0xFC, 0x00, 0xFF, 0xE3, 0xFF, 0x40, 0x0B, 0xFE, 0x7F,
-    0xF0, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03,
-    0xFE, 0x7F, 0xF0, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x3F, 0xF4, 0x00, 0xBF, 0xE3, 0xFF,
-    0xC0, 0x1F, 0xFE, 0x1F, 0xFF, 0xAF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x7F,
-    0xE0, 0x0B, 0xFF, 0x87, 0xFE, 0x00, 0x05, 0x40, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xD1, 0xE4, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x2B, 0xFF, 0xE8, 0x00, 0x00, 0x0A, 0x80, 0x00, 0xA8, 0x00, 0x02,
-    0xF4, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xF9, 0x01, 0xBC, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x15, 0x55, 0x50, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFD, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x4F, 0xFC, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF4, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0x47, 0xFF, 0x40, 0x00,
-    0x7F, 0xD0, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x40, 0x0B, 0xFD, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x2A, 0x00, 0x2F, 0x40, 0x07, 0xF0,
-    0x01, 0xFF, 0xAB, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x2B,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x3F, 0xE0,
-    0x3F, 0xFF, 0xF7, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xF9, 0xBF, 0xFE, 0x3F, 0xFC, 0x00,
-    0xFF, 0xE3, 0xFF, 0x40, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F,
-    0xE0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03,
-    0xFE, 0x3F, 0xF4, 0x00, 0xBF, 0xE3, 0xFF, 0xC0, 0x1F, 0xFE, 0x1F, 0xFF, 0xAF, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x0B, 0xFF, 0x87, 0xFE, 0x00, 0x05, 0x40, 0x7F,
-    0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD1, 0xE4, 0x00, 0x7F, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x2B, 0xFF, 0xE8, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xF9, 0x01, 0xBC, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x15, 0x55, 0x50, 0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x4F, 0xFC,
-    0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0x40, 0x3F, 0xFF, 0xF4, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x2F, 0xFC,
-    0x00, 0x01, 0xFF, 0x47, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF,
-    0x40, 0x0B, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x3F, 0xE0, 0x3F, 0xFF, 0xF7, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xF9, 0xBF, 0xFE, 0x3F, 0xFC, 0x00, 0xFF, 0xE3, 0xFF, 0x40, 0x0B, 0xFE, 0x7F, 0xF0, 0x00,
-    0x7F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F,
-    0xF0, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x3F, 0xF4, 0x00, 0xBF, 0xE3, 0xFF, 0xC0, 0x1F,
-    0xFE, 0x1F, 0xFF, 0xAF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x0B,
-    0xFF, 0x87, 0xFE, 0x00, 0x05, 0x40, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0xD1, 0xE4, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x2B, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFE, 0x40, 0x6F, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x05, 0x55, 0x54, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x4F, 0xFC, 0x00, 0xFF, 0xFF,
-    0xD3, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x3F, 0xF8, 0x00, 0x01, 0xFF,
-    0x4B, 0xFF, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x3F, 0xFC, 0x00, 0x07, 0xFD,
-    0x07, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x3F, 0xE0, 0x3F, 0xFF,
-    0xF7, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xF9, 0xBF, 0xFE, 0x3F, 0xFC, 0x00, 0xFF, 0xE3,
-    0xFF, 0x40, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00,
-    0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x3F,
-    0xF4, 0x00, 0xBF, 0xE3, 0xFF, 0xC0, 0x1F, 0xFE, 0x1F, 0xFF, 0xAF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x0B, 0xFF, 0x87, 0xFE, 0x00, 0x05, 0x40, 0x7F, 0xE0, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD1, 0xE4, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x81, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x2B, 0xFF, 0xE8, 0x00, 0x00, 0x02,
-    0xAA, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xDF,
-    0xF8, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFE, 0xFF, 0xD5, 0x55, 0x5F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA, 0xAA, 0xAF, 0xFE, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x6A,
-    0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xAF, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x19, 0x40,
-    0x00, 0x0B, 0xFD, 0x3F, 0xFF, 0x80, 0x00, 0xBF, 0xDF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0x9B, 0xFF, 0xC0, 0x0B, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0xBF, 0xF0, 0x00,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xD0, 0x0B, 0xFE, 0x00,
-    0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x0B, 0xFD,
-    0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0xBF,
-    0xD0, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x0A, 0xBF, 0xFA, 0xAA, 0xAB, 0xFF, 0xE9, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAB, 0xFF, 0xAA, 0xAA, 0xBF,
-    0xFE, 0x90, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xFA, 0xAA, 0xAB, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xAF,
-    0xFF, 0xAA, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xAB, 0xFF,
-    0xAA, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xA4, 0x00, 0x07, 0xFD, 0x2F,
-    0xFF, 0x80, 0x07, 0xFD, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xF9, 0xBF,
-    0xFC, 0x07, 0xFF, 0xC0, 0x1F, 0xFD, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x07, 0xFF, 0x00, 0x0B, 0xFD,
-    0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07,
-    0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE,
-    0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xD0, 0xFF, 0xFE, 0xBF, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x3F, 0x0B, 0xFF, 0xC0, 0xF4, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x3F, 0x1F, 0xFF, 0xEB, 0xE3, 0xFF, 0xFF, 0xFC, 0x7E, 0x1B, 0xFF, 0x47, 0xC0, 0x0B, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0x1B, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x55,
-    0x55, 0x55, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80,
-    0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02,
-    0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x68, 0x00, 0x0A, 0x87, 0xE0, 0x01, 0xFC, 0x3F, 0xEA,
-    0xFF, 0x82, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x01, 0xBF, 0xFF,
-    0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x2A, 0x00, 0x02, 0x93, 0xF0, 0x00, 0xBE, 0x2F, 0xFA,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xF8, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00,
-    0xFF, 0x54, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x01, 0xA9, 0x01, 0x40, 0x7F, 0xD2, 0xFF, 0x8B,
-    0xFE, 0x1F, 0xF4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0xBF, 0xE2, 0xFF, 0x8B, 0xFE, 0x2F,
-    0xF8, 0xBF, 0xE2, 0xFF, 0x8B, 0xFE, 0x2F, 0xF8, 0xBF, 0xE2, 0xFF, 0x8B, 0xFE, 0x2F, 0xF8, 0xBF,
-    0xE2, 0xFF, 0x8B, 0xFE, 0x2F, 0xF8, 0xBF, 0xE0, 0xBE, 0x0B, 0xE0, 0x3F, 0x02, 0xFC, 0x0B, 0xF5,
-    0x5F, 0xFF, 0x3F, 0xFC, 0x1A, 0x90, 0x00, 0x10, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE,
-    0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xE0, 0xBF, 0xFF, 0xF8, 0x02, 0xFF,
-    0x7F, 0xFF, 0xFF, 0x00, 0xBF, 0xDF, 0xFF, 0xFF, 0xC0, 0x2F, 0xF5, 0xBF, 0xFF, 0x80, 0x0B, 0xFD,
-    0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40,
-    0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x0F,
-    0xFC, 0x00, 0x0B, 0xFD, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0xBF, 0xDF, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xF7, 0xFF, 0xFF, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x55, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x05, 0x00,
-    0x00, 0x50, 0x7F, 0xD0, 0x03, 0xFD, 0xBF, 0xE0, 0x07, 0xFF, 0xBF, 0xE0, 0x0B, 0xFF, 0x7F, 0xD0,
-    0x03, 0xFE, 0x05, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0,
-    0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0,
-    0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0,
-    0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0,
-    0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x02, 0xFF, 0x7F, 0xD0, 0x07, 0xF8, 0x0F, 0xF4, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x15, 0xBF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xAF, 0xF0,
-    0x3F, 0xD0, 0xBF, 0xCB, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0xFF, 0xC1, 0xFF, 0xD0,
-    0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xF6, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xF4, 0x00, 0xFF, 0xC0,
-    0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0xFF, 0xC0, 0x03,
-    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0xFF, 0xE1, 0xFF, 0x80, 0x0F, 0xFE, 0x07, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xF8, 0x0F,
-    0xFF, 0x00, 0x7F, 0xE0, 0xBF, 0xF0, 0x01, 0xFF, 0x8B, 0xFF, 0x00, 0x07, 0xFD, 0x7F, 0xF0, 0x00,
-    0x1F, 0xFB, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x2F, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x01, 0xFF, 0x80, 0x7F,
-    0xF4, 0x07, 0xFE, 0x00, 0xBF, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0xFF, 0xE1,
-    0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x02, 0xFF, 0x87, 0xFE, 0x00, 0x2F, 0xF8, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x1F, 0xFC, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0xFF, 0xD0,
-    0x00, 0x7F, 0xEB, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFD, 0xFF, 0xE0, 0x01, 0xFF, 0x80, 0xFF, 0xD0, 0x07, 0xFE, 0x01,
-    0xFF, 0xC0, 0x1F, 0xF8, 0x02, 0xFF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x81, 0xFF, 0x80, 0x03, 0xFF,
-    0x87, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x6A, 0xA0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xAA, 0x90, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0xFF, 0x80,
-    0x3F, 0xD0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF,
-    0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0,
-    0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B,
-    0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x15, 0x4B, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF,
-    0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB,
-    0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xE3, 0xFD, 0x3F, 0xC7, 0xF4, 0xBE, 0x05, 0x40, 0x3F, 0xE0, 0x00, 0xFF,
-    0x4F, 0xFC, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x2F, 0xD0, 0xFF, 0xC0, 0x0B, 0xF0, 0x3F, 0xF0, 0x03,
-    0xF4, 0x0F, 0xFC, 0x00, 0xA4, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x15, 0x40, 0x55, 0x2F, 0xF4, 0x3F, 0xDB, 0xFD, 0x1F, 0xF2, 0xFF, 0x4B, 0xF4, 0xBF,
-    0xD2, 0xFC, 0x2F, 0xF4, 0xFC, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B,
-    0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0x40, 0x3F, 0xF0, 0x0F, 0xF4, 0x3F,
-    0xF0, 0x2F, 0xF8, 0x3F, 0xF0, 0x2F, 0xFC, 0x3F, 0xF0, 0x1F, 0xF4, 0x3F, 0xF0, 0x01, 0x40, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x15, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00,
-    0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF,
-    0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x50, 0xBF, 0xD3, 0xFD, 0xBF, 0xDB, 0xFF, 0xBF, 0xDB,
-    0xFF, 0xBF, 0xD7, 0xFD, 0xBF, 0xD0, 0x60, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00,
-    0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF,
-    0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x40, 0x00, 0x03, 0xFF, 0xBC, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x55, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0xA0, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0x07, 0xFF, 0xE0, 0x3F, 0xFF,
-    0x80, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x0A, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7F,
-    0xCF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0xFF, 0xBF, 0xF0, 0x00,
-    0x7F, 0xCF, 0xF7, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xCF, 0xF4, 0xBF, 0xF0,
-    0x07, 0xFC, 0xFF, 0x43, 0xFF, 0x40, 0x7F, 0xCF, 0xF4, 0x2F, 0xFC, 0x07, 0xFC, 0xFF, 0x40, 0xFF,
-    0xD0, 0x7F, 0xCF, 0xF8, 0x07, 0xFF, 0x07, 0xFC, 0xFF, 0x80, 0x3F, 0xF8, 0x7F, 0xCF, 0xF8, 0x00,
-    0xFF, 0xC7, 0xFC, 0xFF, 0x80, 0x0B, 0xFF, 0x7F, 0xCF, 0xF8, 0x00, 0x3F, 0xFB, 0xFC, 0xFF, 0x80,
-    0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xCF, 0xF8,
-    0x00, 0x02, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x0A, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA4, 0x00, 0xBF, 0x83, 0xFF, 0xF8, 0x0B, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x8B, 0xFF, 0xF9, 0xBF, 0xFC, 0xBF, 0xF8, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xF0,
-    0x00, 0xFF, 0xDB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD,
-    0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00,
-    0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB,
-    0xFD, 0x00, 0x0B, 0xFD, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF,
-    0xFE, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xF4, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF,
-    0xFF, 0xFD, 0x00, 0x07, 0xFC, 0xFF, 0xBF, 0xF0, 0x00, 0x7F, 0xCF, 0xF7, 0xFF, 0x80, 0x07, 0xFC,
-    0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xCF, 0xF4, 0xBF, 0xF0, 0x07, 0xFC, 0xFF, 0x43, 0xFF, 0x40, 0x7F,
-    0xCF, 0xF4, 0x2F, 0xFC, 0x07, 0xFC, 0xFF, 0x40, 0xFF, 0xD0, 0x7F, 0xCF, 0xF8, 0x07, 0xFF, 0x07,
-    0xFC, 0xFF, 0x80, 0x3F, 0xF8, 0x7F, 0xCF, 0xF8, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x80, 0x0B, 0xFF,
-    0x7F, 0xCF, 0xF8, 0x00, 0x3F, 0xFB, 0xFC, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xCF, 0xF8, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x0B, 0xF8, 0x3F, 0xFF, 0x80, 0xBF, 0xCF, 0xFF,
-    0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0x9B, 0xFF, 0xCB, 0xFF, 0x80, 0x1F, 0xFC, 0xBF,
-    0xF0, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD,
-    0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF,
-    0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xA8,
-    0x00, 0x06, 0x90, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xCF,
-    0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xF4, 0x00, 0x07, 0xFC,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0xFF, 0xBF, 0xF0, 0x00, 0x7F,
-    0xCF, 0xF7, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xCF, 0xF4, 0xBF, 0xF0, 0x07,
-    0xFC, 0xFF, 0x43, 0xFF, 0x40, 0x7F, 0xCF, 0xF4, 0x2F, 0xFC, 0x07, 0xFC, 0xFF, 0x40, 0xFF, 0xD0,
-    0x7F, 0xCF, 0xF8, 0x07, 0xFF, 0x07, 0xFC, 0xFF, 0x80, 0x3F, 0xF8, 0x7F, 0xCF, 0xF8, 0x00, 0xFF,
-    0xC7, 0xFC, 0xFF, 0x80, 0x0B, 0xFF, 0x7F, 0xCF, 0xF8, 0x00, 0x3F, 0xFB, 0xFC, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xCF, 0xF8, 0x00,
-    0x02, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x06, 0x90,
-    0x00, 0x2A, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x01, 0xFF, 0x4F, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0xBF, 0x83, 0xFF, 0xF8, 0x0B, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x8B,
-    0xFF, 0xF9, 0xBF, 0xFC, 0xBF, 0xF8, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00,
-    0xFF, 0xDB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF,
-    0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD,
-    0x00, 0x0B, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1A, 0x40, 0x02, 0xFD, 0x1F, 0xE0, 0xBF, 0xFF, 0x00, 0xFF,
-    0x07, 0xFC, 0xFF, 0xFF, 0xF0, 0x15, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x9B,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x01,
-    0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x2F,
-    0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x7F,
-    0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD,
-    0x00, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xF8,
-    0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xCF, 0xFF,
-    0xD0, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0xFF,
-    0xFF, 0xD0, 0x00, 0x7F, 0xCF, 0xFF, 0xFF, 0x00, 0x07, 0xFC, 0xFF, 0xBF, 0xFC, 0x00, 0x7F, 0xCF,
-    0xF6, 0xFF, 0xE0, 0x07, 0xFC, 0xFF, 0x4F, 0xFF, 0x00, 0x7F, 0xCF, 0xF4, 0x7F, 0xFC, 0x07, 0xFC,
-    0xFF, 0x42, 0xFF, 0xE0, 0x7F, 0xCF, 0xF4, 0x0F, 0xFF, 0x47, 0xFC, 0xFF, 0x80, 0x3F, 0xFC, 0x7F,
-    0xCF, 0xF8, 0x01, 0xFF, 0xE7, 0xFC, 0xFF, 0x80, 0x0F, 0xFF, 0xBF, 0xCF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFC, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0B, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xCF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xCF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFC, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x19, 0x40, 0x0B, 0xF8, 0x3F, 0xFF, 0x80, 0xBF, 0xDF, 0xFF,
-    0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0x9B, 0xFF, 0xCB, 0xFF, 0x80, 0x1F, 0xFC, 0xBF,
-    0xF0, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD,
-    0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF,
-    0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x01,
-    0x55, 0x55, 0x50, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0,
-    0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
-    0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF,
-    0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x94, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0xFD, 0x5F, 0xFF, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x03, 0xFF, 0x1F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0xC3, 0xFF, 0x40,
-    0x0B, 0xFE, 0x0B, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xFF, 0xAB, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0x00, 0xA8, 0x00, 0x00, 0x0B, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0xAF, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1A,
-    0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40,
-    0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF,
-    0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x2A, 0x00, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0x0F,
-    0xFA, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0A, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC,
-    0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA,
-    0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x46, 0xA8, 0x00, 0x00, 0x03, 0xFF, 0x1F,
-    0xF8, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x2F,
-    0xC1, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8,
-    0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD,
-    0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x2A, 0xA1, 0xAA,
-    0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x07,
-    0xF4, 0x3F, 0x80, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF,
-    0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00,
-    0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0,
-    0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x7F, 0xFD, 0x00, 0x7F, 0xF9, 0x55, 0x54, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x95, 0x55, 0x43,
-    0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xEA, 0xAA, 0x83, 0xFF, 0x40,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA5, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFF, 0x9B, 0xFF, 0xFF, 0x41, 0xFF, 0xD0, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0x83, 0xFF,
-    0x00, 0x07, 0xFF, 0x40, 0x02, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFC, 0x7F, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xD0, 0x00, 0x08, 0x03, 0xFF, 0xFB, 0xFF, 0xFF, 0xF5, 0x5B, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x1B, 0xFF, 0xC0, 0x3F, 0xF0, 0x01, 0xFF,
-    0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0,
-    0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF0,
-    0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F,
-    0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xAA, 0x80, 0x00,
-    0x7F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0xBF, 0x42, 0xFF, 0x4B, 0xF8, 0xBF, 0xF4, 0xBF, 0xEF,
-    0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0x41, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x1B, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x01, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0,
-    0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x3F,
-    0xF0, 0x00, 0x7F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2F, 0xD0, 0xBF, 0xDB, 0xF8, 0xBF, 0xF6,
-    0xFF, 0xBF, 0xFC, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xD0, 0x4B, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00,
-    0xBF, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00,
-    0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x2A, 0x00, 0x03, 0xFC, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x1B, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x01, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0,
-    0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x3F,
-    0xF0, 0x00, 0x7F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x2A, 0x00,
-    0x01, 0xA4, 0xFF, 0x40, 0x7F, 0xC0, 0xFF, 0x8B, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x2F, 0xD0, 0xBF, 0xD0,
-    0xBF, 0x8B, 0xFF, 0x42, 0xFF, 0xBF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x40, 0xBF,
-    0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x01, 0xF8, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC5, 0x00,
-    0x00, 0x3F, 0xF1, 0xF9, 0x00, 0x2F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0xA0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x7F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xF8, 0x02, 0xF0, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xF5, 0x80, 0x00, 0xBF, 0xD7,
-    0xF9, 0x5B, 0xFF, 0x1F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x0B, 0xFD, 0xFF, 0x40, 0x0B, 0xF8, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x01, 0xF8, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC5, 0x00, 0x00, 0x3F, 0xF1, 0xF9, 0x00, 0x2F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x2A, 0x90, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0, 0x02, 0xFE, 0x7F, 0xC0, 0x2F,
-    0xE0, 0x7F, 0xC1, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x02, 0xFF,
-    0xFF, 0x90, 0x7F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xF8, 0x02, 0xF0, 0x7F, 0xD0, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xF5, 0x80,
-    0x00, 0xBF, 0xD7, 0xF9, 0x5B, 0xFF, 0x1F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF,
-    0xF4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x2F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x00, 0x7E, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF1, 0x40, 0x00, 0x0F, 0xFC, 0x7E, 0x40, 0x0B, 0xFE, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x80, 0x1B, 0xFF, 0xFE, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x16, 0x94, 0x00, 0x0B, 0xFF, 0xFE, 0x41, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xE0, 0x0B, 0xC1, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD6, 0x00, 0x02, 0xFF, 0x5F, 0xE5, 0x6F, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xEF, 0xFC,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x69, 0x03, 0xFD, 0x01,
-    0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x01, 0xF8,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC5, 0x00, 0x00, 0x3F, 0xF1, 0xF9, 0x00, 0x2F, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xF8,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2A, 0x00, 0x01, 0xA4, 0xFF, 0x40, 0x7F, 0xC0, 0xFF, 0x8B,
-    0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0xA5, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x7F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xF8, 0x02, 0xF0, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0xF5, 0x80, 0x00, 0xBF, 0xD7, 0xF9, 0x5B, 0xFF, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x15,
-    0x57, 0xFF, 0x95, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC,
-    0x2B, 0xFF, 0xAA, 0x80, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xAD, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFD, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x1E, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0x00, 0x0F, 0xF9,
-    0x00, 0x02, 0xA4, 0x00, 0x1A, 0x80, 0x07, 0xF8, 0x02, 0xFD, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x57, 0xFF, 0x95, 0x54, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x1F,
-    0xC0, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0A, 0xFF, 0xEA,
-    0xA0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xAD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x57, 0xFF,
-    0x95, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x7F, 0xF5,
-    0x50, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x2B, 0xFF, 0xAA, 0x80, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0x7F, 0xF5, 0x50, 0x3F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0x40, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F,
-    0xFF, 0xAD, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xD0, 0x00, 0x0F, 0xFF, 0xEB, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0x7F, 0xFC, 0x00, 0x00, 0xF4, 0x01, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F,
-    0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF,
-    0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC,
-    0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8,
-    0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xE0, 0x02, 0xFF, 0xFE, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xD1, 0xFF, 0xF4, 0x00, 0xB8, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF,
-    0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F,
-    0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F,
-    0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x3F,
-    0xF4, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x07, 0xFF, 0x80, 0x0B, 0xFF,
-    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF,
-    0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F,
-    0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF,
-    0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x06,
-    0x80, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x03, 0xFE, 0xAF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF,
-    0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3,
-    0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F,
-    0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x29, 0x00, 0x3F,
-    0x00, 0x0F, 0xD0, 0x02, 0xFF, 0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC,
-    0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00,
-    0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xBE, 0x7F, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x02,
-    0xFA, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00,
-    0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00,
-    0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x07, 0xFF, 0x80, 0x0B,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x6F, 0x80, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x3D,
-    0x0F, 0xC0, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00,
-    0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF,
-    0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA8, 0x6A, 0x90, 0x00, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x02,
-    0xFE, 0x0F, 0xF0, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC,
-    0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00,
-    0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00,
-    0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00,
-    0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x82,
-    0xA9, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x0F,
-    0xE0, 0xBF, 0x00, 0x02, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0,
-    0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC,
-    0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF,
-    0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F,
-    0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF,
-    0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x15, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F,
-    0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFE, 0x00, 0x2F, 0xFC, 0xBF, 0xF4,
-    0x07, 0xFF, 0xC7, 0xFF, 0xFB, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE3, 0xFC,
-    0x02, 0xFF, 0xF4, 0x3F, 0xC0, 0x00, 0x50, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x94, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF4,
-    0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x7F, 0xE0, 0xFF, 0x80, 0x00, 0xFF, 0xF4, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x7F,
-    0xFE, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F,
-    0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x03, 0xFE, 0xFD, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x01,
-    0xFE, 0x7F, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0xBF, 0x4F, 0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0,
-    0x3F, 0xC3, 0xFC, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x0F, 0xF0, 0xFF, 0x41, 0xFF, 0x40, 0x03, 0xFF,
-    0x07, 0xFC, 0x2F, 0xE0, 0xBF, 0xC0, 0x00, 0xBF, 0xC2, 0xFD, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x1F,
-    0xF4, 0xFF, 0x00, 0xFF, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x3F, 0xD7, 0xFD, 0x00, 0x00,
-    0xFF, 0x9F, 0xE0, 0x0B, 0xF9, 0xFF, 0x00, 0x00, 0x2F, 0xFB, 0xF4, 0x00, 0xFF, 0xBF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0xC0,
-    0x03, 0xFF, 0x0F, 0xF8, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x7F,
-    0xD0, 0xBF, 0xC0, 0x1F, 0xFF, 0xC0, 0x2F, 0xF0, 0x1F, 0xF4, 0x0B, 0xFB, 0xF0, 0x0F, 0xFC, 0x03,
-    0xFE, 0x03, 0xF9, 0xFD, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0xFE, 0x3F, 0x81, 0xFF, 0x40, 0x1F, 0xF4,
-    0x7F, 0x4F, 0xF0, 0xBF, 0xC0, 0x03, 0xFE, 0x2F, 0xC2, 0xFC, 0x3F, 0xE0, 0x00, 0xFF, 0x8F, 0xF0,
-    0x7F, 0x4F, 0xF4, 0x00, 0x2F, 0xF3, 0xF8, 0x0F, 0xE7, 0xFC, 0x00, 0x07, 0xFC, 0xFD, 0x03, 0xFA,
-    0xFF, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0xBF, 0xBF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xDF, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F, 0xFC, 0x00,
-    0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x07,
-    0xFF, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xDF, 0xF4, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x03,
-    0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00,
-    0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF,
-    0x80, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00,
-    0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x80, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00,
-    0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F,
-    0xFC, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B,
-    0xFE, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03,
-    0xFF, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x15, 0x55, 0x55, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x6A, 0xA0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x1A, 0xAA, 0xBF, 0xF8, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0x1A, 0xAA, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF8,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xA4, 0x00, 0x1A,
-    0x80, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x2A, 0x00, 0x01, 0xA4, 0xFF, 0x40, 0x7F, 0xC0, 0xFF, 0x8B, 0xFC, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x1A, 0xAA, 0xBF,
-    0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x50, 0x07, 0xFF, 0xFD, 0x1F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFC, 0x3F, 0xF9, 0x64, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00,
-    0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F,
-    0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x00, 0x7F, 0xE0, 0x00, 0x6A, 0xA0, 0x03, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x00, 0xFE, 0x00, 0x2A, 0xA0, 0x03, 0xFF, 0x80, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0x1F, 0xF0,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF,
-    0x6F, 0xF0, 0x3F, 0xD0, 0xBF, 0x8B, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07,
-    0xD0, 0xFF, 0xFE, 0xBF, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0x4B, 0xFF, 0xC0, 0xF4, 0x01, 0xB4, 0x00,
-    0x55, 0x55, 0x55, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x50, 0x2A, 0x00,
-    0x02, 0xA3, 0xF0, 0x00, 0xBE, 0x2F, 0xFA, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFE, 0x00,
-    0x06, 0xFA, 0x00, 0x05, 0x07, 0xFD, 0xBF, 0xEB, 0xFE, 0x7F, 0xD0, 0x50, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0xFD, 0xFF, 0x82, 0xFF, 0xFF, 0x82, 0xFF, 0x7F, 0x01, 0xFD, 0x04, 0x00, 0x10, 0x6A, 0x80,
-    0xFF, 0xF8, 0xFF, 0xFC, 0x42, 0xFD, 0x01, 0xFD, 0x07, 0xFC, 0x1F, 0xE0, 0x1F, 0x80, 0x00, 0x00,
-    0x07, 0xF8, 0x0B, 0xFF, 0xC3, 0xF6, 0xF9, 0xF0, 0x3F, 0x7C, 0x0F, 0xCF, 0xDB, 0xE2, 0xFF, 0xF0,
-    0x1B, 0xD0, 0x00, 0xAA, 0x46, 0xA8, 0x03, 0xFF, 0x1F, 0xF8, 0x07, 0xFD, 0x3F, 0xE0, 0x0F, 0xF0,
-    0xBF, 0x80, 0x2F, 0xC1, 0xFD, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x69, 0x00, 0x02, 0xA0, 0xFF, 0x00,
-    0xBF, 0x81, 0xFF, 0x4F, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x69, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x00, 0x6A, 0x0A, 0x9B, 0xF0, 0xFE, 0xBF, 0x0F, 0xEB,
-    0xF0, 0xFE, 0xBF, 0x0F, 0xEB, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xAA, 0x46, 0xA8, 0x0B, 0xFC, 0x3F,
-    0xE0, 0x2F, 0xE0, 0xFF, 0x00, 0xBF, 0x47, 0xFC, 0x02, 0xFC, 0x0F, 0xD0, 0x0B, 0xD0, 0x3E, 0x00,
-    0x14, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xA4, 0xFF, 0x1A, 0xBC, 0x28, 0x3E, 0x7E, 0x00,
-    0xFD, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x6A, 0x90, 0x00, 0x3F, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xC7, 0xD0, 0x00, 0x7D, 0x01,
-    0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x0B, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x3F, 0xF0, 0x3F, 0xE0, 0x15,
-    0x40, 0x0B, 0xFC, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x15, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x2F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x03,
-    0xFC, 0x02, 0xFC, 0x00, 0x54, 0x0B, 0xFC, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x2F,
-    0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0x15, 0x00, 0x2A, 0xA0, 0x00, 0xBF, 0xF0, 0x00, 0xBF, 0xE0, 0x00,
-    0x7F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0xAA, 0x90, 0x2F, 0xFC, 0x07, 0xFF, 0x00,
-    0xFF, 0x80, 0x3F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-    0x01, 0xF0, 0x05, 0x00, 0x0F, 0x40, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0xF4, 0x05, 0x00, 0x15,
-    0x55, 0x2F, 0xFF, 0xE6, 0xAA, 0xF8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00,
-    0x2E, 0x00, 0x06, 0x40, 0x00, 0x55, 0x40, 0x3F, 0xF0, 0x1F, 0xF8, 0x0B, 0xFD, 0x0B, 0xFF, 0x0F,
-    0xFF, 0x03, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43, 0xF2, 0xFC, 0xF8, 0x3D, 0x0F,
-    0xD1, 0xFC, 0x1F, 0x01, 0x40, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xBF, 0xFE, 0x7F, 0xFD, 0x15,
-    0x54, 0xBF, 0xFE, 0x6B, 0xE9, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x03,
-    0xC0, 0x6F, 0xF9, 0xBF, 0xFE, 0x17, 0xD4, 0x03, 0xC0, 0x02, 0x80, 0x00, 0x00, 0xBF, 0xFD, 0xBF,
-    0xFD, 0x00, 0xAA, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x6B, 0xFF, 0x7F,
-    0xFD, 0x7F, 0xFC, 0x7F, 0xE0, 0xAA, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-    0x40, 0xFF, 0xE9, 0xBF, 0xFD, 0x3F, 0xFD, 0x0B, 0xFD, 0x0B, 0x90, 0xFF, 0xC3, 0xFF, 0x4F, 0xFD,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0xFF, 0x82, 0xFF, 0xFF, 0x82, 0xFF,
-    0x7F, 0x01, 0xFD, 0x04, 0x00, 0x10, 0x07, 0xF8, 0x0B, 0xFF, 0xC3, 0xF6, 0xF9, 0xF0, 0x3F, 0x7C,
-    0x0F, 0xCF, 0xDB, 0xE2, 0xFF, 0xF0, 0x1B, 0xD0, 0x3F, 0xF3, 0xFD, 0x3F, 0xC7, 0xF4, 0xBF, 0x05,
-    0x40, 0x0B, 0xC0, 0x0F, 0xD0, 0x1B, 0xFC, 0x00, 0xFE, 0x00, 0xFE, 0xBF, 0xFE, 0xBF, 0xFC, 0xBF,
-    0xE0, 0x00, 0x90, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x40, 0x3F, 0x00, 0x7F, 0x94, 0x3F, 0xFD, 0x1F,
-    0xFD, 0x02, 0xA8, 0x69, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x00, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF,
-    0xFA, 0xAA, 0xAF, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0x50, 0x00, 0x05, 0x78,
-    0x0F, 0x01, 0xD3, 0xC0, 0xF0, 0x3C, 0x2F, 0xFF, 0xFF, 0x80, 0x7E, 0x0B, 0xD0, 0x69, 0x00, 0x02,
-    0xA0, 0xFF, 0x40, 0x7F, 0xC0, 0xFF, 0x4B, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF,
-    0xAF, 0xF0, 0x3F, 0xD0, 0xBF, 0xCB, 0xE0, 0x01, 0xFD, 0x29, 0x00, 0x06, 0x93, 0xF0, 0x00, 0xFC,
-    0x3F, 0xFA, 0xFF, 0xC1, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFD, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x6A,
-    0x90, 0x00, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xC7,
-    0xD0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x3E, 0x2F, 0xFF, 0xEF, 0xD3, 0xFF, 0xFF,
-    0xFC, 0xBD, 0x1F, 0xFF, 0x4B, 0x80, 0x1B, 0x80, 0x55, 0x55, 0x55, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0x55, 0x54,
-    0x15, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xAA, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0x1A, 0xAA, 0xAA, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x0B, 0xC1, 0xFF, 0xFE, 0xBE, 0x0F, 0xFF, 0xFF, 0xF4, 0x7E, 0x1B, 0xFF,
-    0x81, 0xF0, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xA8, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x03, 0xFF, 0xE0,
-    0x2F, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x90, 0x3F, 0x0F, 0xE0, 0xBC, 0x1F, 0x1F, 0xCF, 0xD3, 0xD0, 0x50, 0x00, 0x05, 0xF4, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xFE, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA, 0xAB, 0xD7, 0x80, 0x00, 0x2D, 0x78, 0x00,
-    0x02, 0xD7, 0x80, 0x00, 0x2D, 0x7F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA8, 0x0B, 0xF5, 0xFE, 0x02,
-    0xFB, 0xFE, 0xF8, 0x3C, 0x0F, 0x03, 0xC7, 0x40, 0xB0, 0x1D, 0x14, 0x14, 0x3D, 0x7C, 0x2F, 0xF4,
-    0x0B, 0xE0, 0x1F, 0xF4, 0x3D, 0xBC, 0x14, 0x24, 0x06, 0xC2, 0xFC, 0x3D, 0x03, 0xD0, 0x2F, 0x00,
-    0xF8, 0x07, 0xC0, 0xBC, 0x3F, 0x43, 0x80, 0x15, 0x55, 0x55, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xF6,
-    0xAA, 0xAA, 0xAA, 0x2A, 0xA4, 0x00, 0xBF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
-    0xD0, 0x00, 0x2F, 0xC0, 0x00, 0xAA, 0x90, 0x3F, 0xF8, 0x0B, 0xFE, 0x01, 0xFF, 0x40, 0x3F, 0xD0,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0x1F, 0xFF, 0xEB, 0xE3, 0xFF, 0xFF,
-    0xFC, 0x7E, 0x1B, 0xFF, 0x47, 0xC0, 0x0B, 0x90, 0x3F, 0xD0, 0xFF, 0xC2, 0xFF, 0x40, 0xFC, 0x0B,
-    0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x07, 0xF0, 0x7F, 0xF2, 0xF8, 0xFF, 0x8B,
-    0xFC, 0x3F, 0xCF, 0xF8, 0xFF, 0x83, 0xFD, 0x7F, 0x0F, 0xF0, 0x3F, 0xC0, 0x40, 0xFC, 0x00, 0x00,
-    0x15, 0x01, 0xFE, 0x07, 0xF8, 0x1F, 0xF0, 0x7F, 0xF8, 0xFF, 0xE1, 0xFF, 0x40, 0x15, 0x55, 0x55,
-    0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA, 0xAA, 0xBD, 0x7C, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00,
-    0x3D, 0x7C, 0x00, 0x00, 0x3D, 0x14, 0x00, 0x00, 0x14, 0x15, 0x55, 0x55, 0x5F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF,
-    0xFF, 0xF6, 0xAA, 0xAA, 0xAA, 0x6A, 0x0A, 0x9B, 0xF0, 0xFE, 0xBF, 0x0F, 0xEB, 0xF0, 0xFE, 0xBF,
-    0x0F, 0xEB, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x00, 0x40, 0x00, 0x15, 0x3D, 0x18, 0x0B, 0xFF, 0x87, 0xC1, 0xFF, 0xFE,
-    0xF8, 0x3D, 0x2F, 0xFF, 0x03, 0xC7, 0xDA, 0x80, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x4A, 0x01,
-    0x40, 0xBF, 0x90, 0x7C, 0x2F, 0xFF, 0xEF, 0x83, 0xFB, 0xFF, 0xF4, 0x3D, 0x07, 0xFE, 0x01, 0x40,
-    0xA4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x50, 0x00,
-    0x06, 0x90, 0x09, 0x3F, 0xFD, 0x7E, 0x7F, 0xFF, 0xFC, 0xB8, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x1E, 0x3F, 0xFE, 0xBD, 0x7D, 0xBF, 0xFC, 0xB4, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x41,
-    0xD0, 0x2F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFD, 0x0F, 0x41, 0xF0, 0x02, 0x41, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x2F, 0xF8, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-    0xBF, 0xC0, 0x2F, 0xF8, 0x03, 0xFE, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x53, 0xC5, 0x00, 0x0F, 0x50, 0x00,
-    0xB2, 0x8E, 0x00, 0x05, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x09, 0x00, 0x50, 0x70, 0x00, 0x00, 0x0E, 0x05, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x90, 0x00, 0x00, 0x03, 0x0F, 0xF0, 0xD0, 0x00, 0x00, 0x07, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xA0, 0x70, 0x00, 0x00, 0x0E, 0x0A, 0x00, 0x70, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB1, 0x4E,
-    0x00, 0x00, 0xF0, 0x00, 0x63, 0xC9, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF,
-    0x00, 0x0F, 0x40, 0x7F, 0x80, 0xBE, 0x0B, 0xE7, 0xF8, 0xF4, 0x00, 0x00, 0x06, 0x0F, 0xD7, 0xF2,
-    0xF0, 0xBC, 0x1F, 0xC3, 0xF4, 0x1D, 0x00, 0x15, 0x00, 0x07, 0xFF, 0xE0, 0x2F, 0xFF, 0xF8, 0x3F,
-    0x96, 0xFD, 0xBD, 0x00, 0x3E, 0xFC, 0xBE, 0x2F, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x29,
-    0x00, 0x08, 0x20, 0x3E, 0xFC, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xF8, 0x1D, 0x38, 0x00, 0x00, 0x00,
-    0x50, 0x7E, 0x7F, 0x8F, 0xC0, 0xBF, 0x40, 0xBE, 0x00, 0xA0, 0x40, 0x0F, 0x90, 0x3F, 0xD0, 0x7E,
-    0x1F, 0xEB, 0xE0, 0xA0, 0x00, 0x20, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x1F, 0xE0, 0xBF, 0x00,
-    0x2F, 0x4F, 0xF0, 0x0B, 0xF5, 0xE7, 0x83, 0xF4, 0x2C, 0x3C, 0x34, 0x03, 0x81, 0xD0, 0xA4, 0x2F,
-    0x47, 0xF0, 0x7D, 0x1F, 0x5F, 0xCB, 0xD2, 0x90, 0x05, 0x07, 0xFC, 0xFF, 0xEF, 0xFE, 0x7F, 0xD1,
-    0x90, 0x02, 0x80, 0x13, 0xC4, 0x3F, 0xFC, 0x7F, 0xFD, 0x0B, 0xE0, 0x2E, 0xB8, 0x08, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x5F, 0xE0, 0x3F, 0xBF, 0xEF, 0xC7, 0x80, 0xF0, 0x2C, 0x74, 0x0F, 0x01,
-    0xD7, 0x80, 0xF0, 0x2C, 0x3F, 0xBF, 0xEF, 0xC0, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x1C,
-    0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xA8, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x03, 0xFF, 0xF9, 0x55, 0x6B, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xA8, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x03, 0xFF, 0xF9, 0x55, 0x6B, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x1B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x14, 0x02, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0xAB, 0xF8,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0x40, 0x05, 0xBF, 0xFF, 0xFF, 0xD0, 0x3D, 0x00,
-    0x00, 0x00, 0x5A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xE5, 0x01, 0x5B, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x19, 0x7E, 0x00, 0x2F, 0x2F, 0xFF, 0x7C, 0x1F, 0xBC,
-    0x3F, 0x3F, 0xEF, 0x05, 0x05, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xE6, 0xE1, 0xF0, 0x3C, 0x7F, 0xFF,
-    0x1F, 0x00, 0x03, 0xE0, 0x10, 0x7F, 0xF8, 0x01, 0x54, 0x00, 0x77, 0xD0, 0x2D, 0xF7, 0xDF, 0x7D,
-    0xF7, 0xD5, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xEB, 0xE1, 0xF0, 0x3C, 0xB8, 0x0F, 0x6F, 0x03,
-    0xC3, 0xD2, 0xF0, 0x7F, 0xF0, 0x01, 0x50, 0x00, 0x78, 0x0F, 0x2F, 0x03, 0xCB, 0xC0, 0xF2, 0xF0,
-    0x3C, 0xBC, 0x1F, 0x1F, 0x4F, 0xC3, 0xFF, 0xF0, 0x15, 0x04, 0x00, 0x00, 0x7F, 0xD7, 0xEA, 0x6E,
-    0x00, 0xF4, 0x03, 0xE0, 0x0B, 0xD1, 0x4B, 0xFE, 0x01, 0x50, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1F,
-    0x1F, 0xEF, 0x3E, 0xBF, 0xBC, 0x1F, 0xB8, 0x0F, 0xB8, 0x0F, 0x7D, 0x2F, 0x3F, 0xEF, 0x05, 0x45,
-    0x78, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xFB, 0xF4, 0x7F, 0xBF, 0x1F, 0x03, 0xC7, 0xC0, 0xF1,
-    0xF0, 0x3C, 0x7C, 0x0F, 0x1F, 0x03, 0xC1, 0x40, 0x50, 0x00, 0x00, 0x00, 0x3D, 0xFE, 0x7F, 0x8F,
-    0xEB, 0xFA, 0xF7, 0xE0, 0xF8, 0x2E, 0xF4, 0x3D, 0x0B, 0xBD, 0x0F, 0x42, 0xEF, 0x43, 0xD0, 0xBB,
-    0xD0, 0xF4, 0x2E, 0x50, 0x14, 0x01, 0x00, 0x00, 0x0F, 0x3D, 0xFF, 0xDF, 0x80, 0xF4, 0x0F, 0x40,
-    0xF4, 0x0F, 0x40, 0x50, 0x00, 0x05, 0x00, 0x3C, 0x03, 0xFF, 0x1B, 0xE8, 0x1F, 0x00, 0x7C, 0x01,
-    0xF0, 0x07, 0xC0, 0x0F, 0xF0, 0x05, 0x40, 0xB8, 0x0F, 0x5F, 0x07, 0xC3, 0xD2, 0xE0, 0x78, 0xF0,
-    0x0F, 0x78, 0x02, 0xFD, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x2F, 0x07, 0xC0, 0xF8, 0xF4, 0x03, 0xFE,
-    0x00, 0x1F, 0xC0, 0x03, 0xFD, 0x00, 0xBD, 0xF0, 0x1F, 0x0B, 0xC1, 0x40, 0x14, 0x06, 0xA9, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF5, 0x55, 0x54, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD5, 0x55,
-    0x43, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xEA, 0xAA, 0x83,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0xFF, 0x83, 0xFE,
-    0x03, 0xFE, 0x0F, 0xF8, 0x0B, 0xF8, 0x2F, 0xE0, 0x0A, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xF5, 0x55, 0x54, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xEA, 0xAA, 0x83, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x5F, 0xFE, 0x55, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x5A, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xE5, 0x6F, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x1F,
-    0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0xBF,
-    0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFD, 0x0E, 0xFF, 0xFD,
-    0x00, 0x02, 0xFF, 0x43, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF4,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x57, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x06, 0xF0,
-    0x0F, 0xFF, 0x40, 0x00, 0x10, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x78, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xF8, 0x06, 0xF8, 0x3F, 0xF0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x50, 0x00, 0x03, 0xFF, 0xBD, 0x00, 0x0F, 0xFE, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x3F, 0xE3, 0xFF, 0x3F,
-    0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xF3,
-    0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF,
-    0x00, 0x00, 0x00, 0xBD, 0x1F, 0x87, 0xFC, 0xFF, 0x5F, 0xF3, 0xFD, 0x3F, 0xCB, 0xF0, 0x68, 0x0A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x15, 0xBF, 0xF4, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x7F,
-    0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x55, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xEA, 0xA4, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xEA, 0xBF, 0xFF,
-    0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xE0, 0x03, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x2F,
-    0xFC, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xFD, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x03, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
-    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x55, 0x55, 0x7F, 0xF5, 0x5B, 0xFF,
-    0xDF, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0x01, 0x7F, 0xFD, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF9, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x15, 0x5F, 0xFE, 0x55, 0x50, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x1A, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xEA,
-    0xBF, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x0B,
-    0xFD, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF,
-    0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x00,
-    0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x1A, 0xA8, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x3F, 0xF0,
-    0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0xFF,
-    0xC0, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0xFF, 0xD0, 0x00, 0xFF, 0xD6, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xEB, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xE0,
-    0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xFF,
-    0xC0, 0x00, 0xBF, 0xF4, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x2A,
-    0xA4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x3F, 0xF0, 0x00,
-    0x0B, 0xFF, 0xCF, 0xFC, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x3F, 0xF0, 0x00, 0xBF, 0xFF, 0xCF, 0xFC, 0x00, 0x3F, 0xFF, 0xF3, 0xFF, 0x00, 0x3F,
-    0xEB, 0xFC, 0xFF, 0xC0, 0x1F, 0xF2, 0xFF, 0x3F, 0xF0, 0x0F, 0xF8, 0xBF, 0xCF, 0xFC, 0x07, 0xFC,
-    0x3F, 0xF3, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0xFF, 0xC1, 0xFF, 0x03, 0xFF, 0x3F, 0xF0, 0xFF, 0x80,
-    0xFF, 0xCF, 0xFC, 0x7F, 0xC0, 0x3F, 0xF3, 0xFF, 0x3F, 0xE0, 0x0F, 0xFC, 0xFF, 0xDF, 0xF0, 0x03,
-    0xFF, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x3F, 0xF3, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFC, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF3, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x01, 0xFF,
-    0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x2F, 0xF8, 0x00,
-    0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xF0,
-    0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0x01,
-    0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07,
-    0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00,
-    0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F,
-    0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xD5, 0x55, 0x54, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFD, 0x5A, 0xFF, 0xF4, 0xFF, 0xC0, 0x03, 0xFF,
-    0xCF, 0xFC, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x1F, 0xFC, 0xFF, 0xC0,
-    0x02, 0xFF, 0xCF, 0xFC, 0x01, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFA, 0x50, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xF0, 0x06, 0xFF,
-    0xF0, 0xFF, 0xC0, 0x02, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x3F,
-    0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xD5, 0x5F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xEA, 0xAF, 0xFF, 0x43, 0xFF, 0x00, 0x0B, 0xFF,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0xFF, 0xE3, 0xFF,
-    0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xE8, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x57, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xFD, 0x55, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0x40,
-    0x02, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xE0,
-    0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4,
-    0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xEB, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xEB, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xF5, 0x55, 0x54, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xF4, 0xFF, 0xEA, 0xAA, 0x83, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF4, 0x00, 0x0B,
-    0xFC, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x00, 0x03, 0xFF,
-    0x40, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x0B,
-    0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x3F, 0xF0, 0x3F, 0xF8, 0x00,
-    0x00, 0x3F, 0xF8, 0x0F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xF0, 0x02, 0xFF,
-    0xC0, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x07,
-    0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xF1, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x0B, 0xD0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x05, 0x56, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1A, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x75, 0x00, 0x0B, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0xCF, 0xFC, 0x00, 0x03, 0xFF,
-    0xF3, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x3F, 0xF0, 0x00, 0xBF, 0xFF,
-    0xCF, 0xFC, 0x00, 0x3F, 0xFF, 0xF3, 0xFF, 0x00, 0x3F, 0xEB, 0xFC, 0xFF, 0xC0, 0x1F, 0xF2, 0xFF,
-    0x3F, 0xF0, 0x0F, 0xF8, 0xBF, 0xCF, 0xFC, 0x07, 0xFC, 0x3F, 0xF3, 0xFF, 0x03, 0xFE, 0x0F, 0xFC,
-    0xFF, 0xC1, 0xFF, 0x03, 0xFF, 0x3F, 0xF0, 0xFF, 0x80, 0xFF, 0xCF, 0xFC, 0x7F, 0xC0, 0x3F, 0xF3,
-    0xFF, 0x3F, 0xE0, 0x0F, 0xFC, 0xFF, 0xDF, 0xF0, 0x03, 0xFF, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xCF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xF3, 0xFF, 0xFE, 0x00, 0x0F, 0xFC, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x3F,
-    0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFF, 0xC0, 0x00, 0x3F, 0xF3, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x02,
-    0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x3F, 0xF0,
-    0x00, 0x0B, 0xFF, 0xCF, 0xFC, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x3F, 0xF0, 0x00, 0xBF, 0xFF, 0xCF, 0xFC, 0x00, 0x3F, 0xFF, 0xF3, 0xFF, 0x00,
-    0x3F, 0xEB, 0xFC, 0xFF, 0xC0, 0x1F, 0xF2, 0xFF, 0x3F, 0xF0, 0x0F, 0xF8, 0xBF, 0xCF, 0xFC, 0x07,
-    0xFC, 0x3F, 0xF3, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0xFF, 0xC1, 0xFF, 0x03, 0xFF, 0x3F, 0xF0, 0xFF,
-    0x80, 0xFF, 0xCF, 0xFC, 0x7F, 0xC0, 0x3F, 0xF3, 0xFF, 0x3F, 0xE0, 0x0F, 0xFC, 0xFF, 0xDF, 0xF0,
-    0x03, 0xFF, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x3F, 0xF3, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFC, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF3, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
-    0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0xFF, 0xD0, 0x00, 0xFF, 0xD6, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xEB, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xFF,
-    0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFE,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xE0,
-    0xFF, 0xC0, 0x00, 0xBF, 0xF4, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF5, 0x55, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x0B, 0xFE,
-    0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF,
-    0xE0, 0x03, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xFE, 0x00, 0x0B,
-    0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x07, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0xD0, 0x00,
-    0xBF, 0xE0, 0x07, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xE0, 0x0B, 0xFC, 0x00,
-    0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x2F, 0xF8, 0x00, 0x0B, 0xFE, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xEF, 0xFF, 0xF0, 0x00, 0x0B, 0xFE, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xEF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xDF,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0xF0, 0x00,
-    0x02, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xDF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFD,
-    0xFF, 0xBF, 0xC0, 0x00, 0xBF, 0xBF, 0xDF, 0xF7, 0xFC, 0x00, 0x0F, 0xF7, 0xFD, 0xFF, 0x6F, 0xD0,
-    0x00, 0xFF, 0x3F, 0xDF, 0xF5, 0xFE, 0x00, 0x1F, 0xD3, 0xFD, 0xFF, 0x4F, 0xF0, 0x03, 0xFC, 0x3F,
-    0xDF, 0xF4, 0xFF, 0x40, 0x3F, 0xC7, 0xFD, 0xFF, 0x47, 0xF8, 0x07, 0xF4, 0x7F, 0xDF, 0xF8, 0x3F,
-    0xC0, 0xFF, 0x07, 0xFD, 0xFF, 0x83, 0xFD, 0x0F, 0xF0, 0x7F, 0xDF, 0xF8, 0x2F, 0xE1, 0xFE, 0x07,
-    0xFD, 0xFF, 0x80, 0xFF, 0x3F, 0xC0, 0x7F, 0xDF, 0xF8, 0x0F, 0xF7, 0xFC, 0x07, 0xFD, 0xFF, 0x80,
-    0xBF, 0xFF, 0x80, 0x7F, 0xDF, 0xF8, 0x07, 0xFF, 0xF0, 0x07, 0xFD, 0xFF, 0x80, 0x3F, 0xFF, 0x00,
-    0x7F, 0xDF, 0xF8, 0x02, 0xFF, 0xE0, 0x07, 0xFD, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x7F, 0xDF, 0xF8,
-    0x00, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF,
-    0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0,
-    0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00,
-    0x07, 0xFE, 0xFF, 0xD5, 0x55, 0x5B, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA, 0xAA, 0xAF, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE,
-    0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF,
-    0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0,
-    0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x0B, 0xFF,
-    0xD0, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x2F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF8, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00,
-    0x00, 0x2F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x0F,
-    0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xD5, 0x55,
-    0x5F, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x3F, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xF5, 0x6F, 0xFF, 0x83, 0xFF, 0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC3, 0xFF, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xF0,
-    0x03, 0xFF, 0xC3, 0xFF, 0xAA, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xAA, 0x90, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x06, 0xF0, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0xE4, 0x00, 0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x15, 0x57, 0xFF, 0x95, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x2F, 0xF8, 0x00, 0x01,
-    0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC0,
-    0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0x01, 0xFF,
-    0x4F, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFA, 0xFF,
-    0xAF, 0xFF, 0xE0, 0x0F, 0xFF, 0x41, 0xFF, 0x40, 0xFF, 0xF0, 0x2F, 0xFC, 0x01, 0xFF, 0x40, 0x3F,
-    0xF8, 0x3F, 0xF4, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0, 0x01,
-    0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF4, 0x01, 0xFF, 0x40, 0x1F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x40,
-    0x3F, 0xF8, 0x0F, 0xFF, 0x41, 0xFF, 0x41, 0xFF, 0xF0, 0x07, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0xBF, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xD0, 0x00,
-    0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0xFF,
-    0xC0, 0x07, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFE, 0x03,
-    0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00,
-    0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x03, 0xFF,
-    0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xBF,
-    0xD0, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0xBF, 0xD0, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x3F, 0xFB, 0xFD, 0x00, 0x00, 0xFF,
-    0xEF, 0xF4, 0x00, 0x03, 0xFF, 0xBF, 0xD0, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x3F, 0xFB, 0xFD,
-    0x00, 0x00, 0xFF, 0xEF, 0xF4, 0x00, 0x03, 0xFF, 0xBF, 0xD0, 0x00, 0x0F, 0xFE, 0xFF, 0x80, 0x00,
-    0x3F, 0xF7, 0xFF, 0x40, 0x00, 0xFF, 0xCF, 0xFF, 0xA5, 0xBF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xAA, 0x43, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0xBF,
-    0xD0, 0x00, 0x7F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xCF, 0xFC, 0x00, 0x0B, 0xFD,
-    0x00, 0x07, 0xFF, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x00, 0x7F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xCF, 0xFC, 0x00, 0x0B, 0xFD, 0x00,
-    0x07, 0xFF, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00,
-    0x7F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xCF, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x07,
-    0xFF, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x7F,
-    0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xCF, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF,
-    0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF3,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xCF, 0xFD, 0x55, 0x5F, 0xFD, 0x55, 0x5B, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE0,
-    0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x3F,
-    0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x02,
-    0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x5B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x55, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xAB, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x2F,
-    0xFC, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xFE,
-    0x00, 0x0B, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFD, 0x00,
-    0x07, 0xFE, 0x01, 0xBF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFB,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF,
-    0xEA, 0x94, 0x00, 0x01, 0xFF, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFB, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFE, 0xFF, 0xEA, 0xBF, 0xFF, 0x01, 0xFF, 0xBF, 0xF0,
-    0x01, 0xFF, 0xD0, 0x7F, 0xEF, 0xFC, 0x00, 0x2F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0x07, 0xFF, 0x07,
-    0xFE, 0xFF, 0xC0, 0x01, 0xFF, 0xC1, 0xFF, 0xBF, 0xF0, 0x00, 0xBF, 0xF0, 0x7F, 0xEF, 0xFC, 0x00,
-    0x3F, 0xF8, 0x1F, 0xFB, 0xFF, 0x01, 0xBF, 0xFD, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFB, 0xFF, 0xFF, 0xF8,
-    0x00, 0x07, 0xFE, 0xAA, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xEA, 0xFF, 0xFF, 0x3F, 0xF0, 0x01, 0xFF, 0xEF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x7E, 0x40, 0x6F, 0xFF, 0x00, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x05, 0x55, 0x55, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x39, 0x00, 0x0B, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xF4, 0x07,
-    0xFF, 0xD0, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x8F, 0xFC, 0x0B, 0xFD, 0x00, 0x00, 0x1F, 0xF8,
-    0xFF, 0xD5, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xEA,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x0B, 0xFD, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x00, 0x01, 0xFF, 0xCF, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xF8, 0xFF, 0xC0, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0xFF, 0xC0, 0x0F, 0xFF, 0x00,
-    0x3F, 0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xF5, 0x5B,
-    0xFE, 0x03, 0xFF, 0x80, 0x07, 0xFE, 0x07, 0xFF, 0x00, 0x07, 0xFE, 0x07, 0xFF, 0x00, 0x07, 0xFE,
-    0x03, 0xFF, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF4,
-    0x07, 0xFE, 0x00, 0xBF, 0xF0, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x80, 0x07,
-    0xFE, 0x0B, 0xFF, 0x00, 0x07, 0xFE, 0x1F, 0xFD, 0x00, 0x07, 0xFE, 0x3F, 0xF8, 0x00, 0x07, 0xFE,
-    0x00, 0x05, 0xA5, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x07, 0xE4, 0x1B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x01,
-    0x5B, 0xFE, 0x01, 0xBF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFE, 0xBF, 0xF9, 0xFF,
-    0xD0, 0x07, 0xFE, 0xBF, 0xE0, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x7F, 0xF9,
-    0xFF, 0xE5, 0xBF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x2F, 0xE0, 0x7F, 0xFE, 0x03,
-    0xF8, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xE4,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x05, 0x40, 0x00,
-    0xFF, 0x87, 0xFF, 0xE0, 0x03, 0xFD, 0xBF, 0xFF, 0xF0, 0x1F, 0xFB, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xAB, 0xFF, 0xD1, 0xFF, 0xF0, 0x03, 0xFF, 0xC7, 0xFF, 0x40, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFD, 0x7F, 0xF0, 0x00, 0x2F, 0xF5, 0xFF, 0xC0, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x02, 0xFF, 0x4F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xFA,
-    0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE4, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xE5, 0x5F, 0xFF, 0x2F, 0xF4, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x3F, 0xF2, 0xFF, 0x80, 0x2F, 0xF4, 0xBF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0x95, 0x6F, 0xFC, 0xBF, 0xD0, 0x03, 0xFF, 0x6F, 0xF4, 0x00,
-    0xBF, 0xEB, 0xFD, 0x00, 0x3F, 0xF6, 0xFF, 0x95, 0xBF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFA, 0xAA, 0x87, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xEA, 0xBF, 0xF4, 0x00, 0x2F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xF8, 0x02, 0xFF, 0x40, 0x03,
-    0xFE, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x80, 0x2F, 0xF4, 0x00, 0x3F, 0xE0, 0x0B, 0xFD, 0x00, 0x0F,
-    0xF4, 0x02, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x0B, 0xFD, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFE, 0xAA, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFD, 0x07, 0xFF, 0x43, 0xFF,
-    0x40, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0xBF, 0xC7, 0xFF, 0x00, 0x0B, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x06, 0x00, 0xFF, 0xFE, 0xAB, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x01, 0xFF,
-    0x80, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x02,
-    0xFF, 0x40, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x07, 0xFE,
-    0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xFB, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x83, 0xFF, 0x40,
-    0x00, 0x3F, 0xF4, 0x3F, 0xE0, 0xBF, 0xF0, 0x00, 0x2F, 0xFC, 0x0F, 0xF8, 0x0F, 0xFE, 0x00, 0x1F,
-    0xFC, 0x03, 0xFE, 0x01, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0xFF, 0x80, 0x2F, 0xFC, 0x0F, 0xFF, 0x00,
-    0x3F, 0xE0, 0x03, 0xFF, 0x87, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x5A, 0x50, 0x01,
-    0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFC, 0x3E, 0x40, 0x7F, 0xF4, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xF4, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x55, 0x6F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x02, 0xFF, 0xEF, 0xAA, 0xBF, 0xFE, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x46,
-    0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF,
-    0x7F, 0xE0, 0x03, 0xFF, 0xF7, 0xFE, 0x00, 0x7F, 0xFF, 0x7F, 0xE0, 0x0F, 0xFF, 0xF7, 0xFE, 0x01,
-    0xFF, 0xFF, 0x7F, 0xE0, 0x3F, 0xFF, 0xF7, 0xFE, 0x07, 0xFB, 0xFF, 0x7F, 0xD0, 0xFF, 0x3F, 0xF7,
-    0xFD, 0x2F, 0xD3, 0xFF, 0x7F, 0xD3, 0xFC, 0x3F, 0xF7, 0xFD, 0xBF, 0x43, 0xFF, 0x7F, 0xDF, 0xF0,
-    0x3F, 0xF7, 0xFF, 0xFD, 0x03, 0xFF, 0x7F, 0xFF, 0x80, 0x3F, 0xF7, 0xFF, 0xF0, 0x03, 0xFF, 0x7F,
-    0xFE, 0x00, 0x3F, 0xF7, 0xFF, 0xC0, 0x03, 0xFF, 0x7F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xA8, 0x02,
-    0xA9, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x02, 0xFF, 0x4B, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xF7, 0xFE, 0x00, 0x3F, 0xFF, 0x7F, 0xE0, 0x07, 0xFF, 0xF7, 0xFE,
-    0x00, 0xFF, 0xFF, 0x7F, 0xE0, 0x1F, 0xFF, 0xF7, 0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x7F, 0xBF,
-    0xF7, 0xFD, 0x0F, 0xF3, 0xFF, 0x7F, 0xD2, 0xFD, 0x3F, 0xF7, 0xFD, 0x3F, 0xC3, 0xFF, 0x7F, 0xDB,
-    0xF4, 0x3F, 0xF7, 0xFD, 0xFF, 0x03, 0xFF, 0x7F, 0xFF, 0xD0, 0x3F, 0xF7, 0xFF, 0xF8, 0x03, 0xFF,
-    0x7F, 0xFF, 0x00, 0x3F, 0xF7, 0xFF, 0xE0, 0x03, 0xFF, 0x7F, 0xFC, 0x00, 0x3F, 0xF7, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x47, 0xFE, 0x00, 0x2F, 0xF8,
-    0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0xBF, 0xD0, 0x07, 0xFE,
-    0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFE, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0xFF, 0xF0, 0x01,
-    0xFF, 0x80, 0xFF, 0xE0, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x03, 0xFF, 0x81, 0xFF, 0x80, 0x07, 0xFF, 0x47, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x00, 0xFF, 0xEA, 0xBF, 0xF4, 0x03, 0xFD, 0x00, 0xBF, 0xD0, 0x0F, 0xF4, 0x02, 0xFF, 0x40, 0x3F,
-    0xD0, 0x0B, 0xFD, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x07, 0xFC, 0x00, 0xBF, 0xD0, 0x1F, 0xF0, 0x02,
-    0xFF, 0x40, 0x7F, 0xC0, 0x0B, 0xFD, 0x02, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xD0,
-    0x7F, 0xE0, 0x02, 0xFF, 0x7F, 0xFF, 0x40, 0x0B, 0xFD, 0xFF, 0xFC, 0x00, 0x2F, 0xF7, 0xFF, 0xE0,
-    0x00, 0xBF, 0xDF, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0xFF, 0x40, 0x00, 0xFF, 0xFC, 0x7F, 0xFF,
-    0x80, 0x02, 0xFF, 0xFC, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0xD0, 0x03, 0xFF, 0xFC,
-    0x7F, 0xEF, 0xE0, 0x0B, 0xFB, 0xFC, 0x7F, 0xDF, 0xF0, 0x0F, 0xF7, 0xFC, 0x7F, 0xDB, 0xF4, 0x1F,
-    0xE7, 0xFC, 0x7F, 0xD3, 0xFC, 0x2F, 0xC7, 0xFC, 0x7F, 0xD3, 0xFC, 0x3F, 0xC7, 0xFC, 0x7F, 0xD2,
-    0xFD, 0x7F, 0x47, 0xFC, 0x7F, 0xD0, 0xFF, 0xBF, 0x07, 0xFC, 0x7F, 0xD0, 0xFF, 0xFF, 0x07, 0xFC,
-    0x7F, 0xD0, 0x7F, 0xFD, 0x07, 0xFC, 0x7F, 0xD0, 0x3F, 0xFC, 0x07, 0xFC, 0x7F, 0xD0, 0x3F, 0xF8,
-    0x07, 0xFC, 0x7F, 0xD0, 0x1F, 0xF4, 0x07, 0xFC, 0x7F, 0xD0, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC,
-    0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00,
-    0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xAA, 0xAF, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F,
-    0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFE, 0x57, 0xFF, 0xC0, 0xFF, 0xE0, 0x03, 0xFF,
-    0x43, 0xFF, 0x00, 0x07, 0xFF, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF2, 0xFF,
-    0x80, 0x00, 0xFF, 0xDB, 0xFE, 0x00, 0x03, 0xFF, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00,
-    0x3F, 0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0x82, 0xFF, 0x80, 0x0F, 0xFD, 0x03, 0xFF, 0xE6, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFA, 0xAA, 0xFF, 0xDF, 0xF8, 0x00, 0x3F, 0xF7, 0xFE, 0x00, 0x0F,
-    0xFD, 0xFF, 0x80, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x3F, 0xF7, 0xFE, 0x00,
-    0x0F, 0xFD, 0xFF, 0x80, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x3F, 0xF7, 0xFE,
-    0x00, 0x0F, 0xFD, 0xFF, 0x80, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x3F, 0xF7,
-    0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x19, 0x40, 0x07, 0xFC, 0x2F, 0xFF, 0x40, 0x7F, 0xCF, 0xFF,
-    0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0x5B, 0xFF, 0x87, 0xFF, 0x80, 0x1F, 0xFC, 0x7F,
-    0xF0, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x0B, 0xFE, 0x7F, 0xE0, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0x07,
-    0xFE, 0x7F, 0xE0, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0xBF, 0xD7, 0xFF,
-    0x00, 0x0F, 0xFD, 0x7F, 0xFC, 0x02, 0xFF, 0xC7, 0xFF, 0xFE, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x07, 0xFE, 0xFF, 0xFF, 0xC0, 0x7F, 0xE2, 0xFF, 0xE0, 0x07, 0xFE, 0x00, 0x50, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x69, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
-    0x96, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x04, 0x1F, 0xFF, 0xFB, 0xF8, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A,
-    0xAF, 0xFE, 0xAA, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x2F,
-    0xF4, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x00, 0x2F,
-    0xF0, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x1F,
-    0xF3, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x41, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x7F, 0xF5, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFD, 0x3F, 0xF1, 0xFF, 0xF0, 0x2F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFE, 0x0F, 0xFC,
-    0x03, 0xFF, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0xFF, 0xC0, 0x2F, 0xF5, 0xFF, 0x80, 0x3F, 0xF0, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x0F, 0xFC, 0x01, 0xFF, 0xAF, 0xF4, 0x03, 0xFF, 0x00, 0x7F, 0xE7, 0xFE, 0x00,
-    0xFF, 0xC0, 0x2F, 0xF5, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFD, 0x3F, 0xF4, 0x0F, 0xFC, 0x07, 0xFF,
-    0x0B, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x80, 0xFF, 0xF9, 0xFF, 0xDB, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x01, 0xFF, 0xCB, 0xFE, 0x00,
-    0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xCF, 0xFD, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x0B, 0xFF, 0x02,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0xBF, 0xF0, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x01, 0xFF, 0xC0,
-    0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0xBF,
-    0xE0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0,
-    0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x01,
-    0xFF, 0xC0, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x7F, 0xEF, 0xFC, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x01, 0xFF, 0xBF, 0xF0,
-    0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x07, 0xFE, 0xFF, 0xF0, 0x02, 0xFF, 0xAF,
-    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFA, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x7F,
-    0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x7F, 0xE0, 0x02,
-    0xFF, 0x40, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x40,
-    0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC,
-    0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x7F, 0xE0,
-    0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xFF,
-    0x40, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x02,
-    0xFF, 0x40, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x02, 0xFF,
-    0x40, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x02, 0xFF, 0x40,
-    0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F,
-    0xFC, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC,
-    0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6A, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xF9, 0x6B, 0xFF, 0x80,
-    0x02, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF4, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0xEB, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF,
-    0x7F, 0xF5, 0x54, 0x00, 0x03, 0xFF, 0x7F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x7F, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x7F, 0xE5, 0x6F, 0xFF, 0x03, 0xFF, 0x7F, 0xE0,
-    0x03, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0x03, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0x03, 0xFF, 0x03, 0xFF,
-    0x7F, 0xE0, 0x0B, 0xFF, 0x03, 0xFF, 0x7F, 0xFA, 0xFF, 0xFE, 0x03, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0x7F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x7F, 0xFF, 0xFE, 0x40, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0x56, 0xFF, 0xF1, 0xFF, 0x80, 0x0F,
-    0xFD, 0x7F, 0xE0, 0x02, 0xFF, 0x5F, 0xF8, 0x00, 0xFF, 0xD7, 0xFE, 0x00, 0x7F, 0xF1, 0xFF, 0xEB,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x01,
-    0x69, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x2E,
-    0x56, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0x55, 0x5F, 0xFC, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x40, 0x00, 0xBF, 0xF0, 0xBF, 0xAB, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x94, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xFF, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0x01, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xE0, 0x2F, 0xFE, 0x6F, 0xFE, 0x1F, 0xF8,
-    0x0F, 0xFC, 0x00, 0xFF, 0xC7, 0xFE, 0x07, 0xFE, 0x00, 0x2F, 0xF9, 0xFF, 0x82, 0xFF, 0x40, 0x07,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xDF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF7, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFD, 0xFF, 0xEB, 0xFF, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0xBF, 0xD0, 0x01, 0xFF,
-    0x9F, 0xF8, 0x1F, 0xF8, 0x00, 0xBF, 0xD7, 0xFE, 0x03, 0xFF, 0x40, 0x7F, 0xF1, 0xFF, 0x80, 0xBF,
-    0xFE, 0xFF, 0xF8, 0x7F, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFE, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0x55, 0x7F, 0xE0, 0xFF, 0xC0, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x07, 0xFE,
-    0x0F, 0xFF, 0x40, 0x7F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xF5, 0xBF, 0xE0, 0x0F, 0xFE, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x3F, 0xF4, 0x07, 0xFE, 0x0F, 0xFE, 0x00, 0x7F, 0xE2, 0xFF, 0xC0, 0x07, 0xFE, 0x7F, 0xF4, 0x00,
-    0x7F, 0xE0, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF4, 0x3F, 0xF4, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x0B,
-    0xFC, 0x7F, 0xF0, 0x00, 0xBF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x60, 0x0F, 0xFF, 0xEA, 0xBF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xB8, 0x02, 0xE0,
-    0x00, 0x2F, 0xE0, 0xBF, 0x80, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xE0, 0xBF, 0x80, 0x00, 0x68,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFD, 0x07, 0xFF, 0x43, 0xFF, 0x40,
-    0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0xBF, 0xC7, 0xFF, 0x00, 0x0B, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x06, 0x00, 0xFF, 0xFE, 0xAB, 0xF0, 0x07,
-    0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xAB,
-    0xFF, 0xAA, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x50, 0x00, 0x07, 0xFE,
-    0x1F, 0xFF, 0x80, 0x07, 0xFD, 0xBF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFA,
-    0xFF, 0xFC, 0x07, 0xFF, 0xC0, 0x2F, 0xFC, 0x07, 0xFF, 0x40, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x0F,
-    0xFD, 0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD,
-    0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07,
-    0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xAA, 0xA8, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0x95, 0xB0, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF,
-    0xFF, 0x80, 0xBF, 0xE5, 0x55, 0x40, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x04, 0x1F, 0xFF, 0xEA, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x2F,
-    0xFF, 0xE4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x16, 0x94, 0x00, 0x1F, 0xFF, 0xFE, 0x41, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xF4, 0x7F, 0xE0, 0x1B, 0xC2, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x06, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xC5, 0x00, 0x02, 0xFF, 0x2F, 0xE9,
-    0xBF, 0xFC, 0xBF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x40,
-    0x00, 0x01, 0x03, 0xFD, 0x7F, 0xFB, 0xFF, 0x3F, 0xD0, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xE7, 0xFE,
-    0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F,
-    0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x04, 0x01, 0x03, 0xF4, 0xFC, 0x3F, 0x9F, 0xE3,
-    0xF9, 0xFE, 0x3F, 0x4F, 0xD0, 0x90, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F,
-    0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0,
-    0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07,
-    0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x00, 0x07, 0xFD, 0x00, 0xBF,
-    0xE0, 0x0B, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B,
-    0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00,
-    0xBF, 0xD0, 0x1F, 0xFD, 0xFF, 0xFF, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0B, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x03, 0xFF, 0x55, 0x40,
-    0x00, 0x03, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xF4, 0x03, 0xFF, 0x55, 0xFF, 0xF0, 0x03, 0xFD,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x7F, 0xC0, 0x0F,
-    0xFC, 0x00, 0xBF, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xF7, 0xFF, 0xFC, 0x00, 0xFF, 0xEB,
-    0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xFA, 0xAB, 0xFF, 0xEA, 0xA5, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xE0, 0x00, 0xFF,
-    0xC0, 0x1F, 0xFD, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFE, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x7F, 0xE0, 0x00, 0xFF, 0xEA, 0xFF, 0xFC, 0x7F,
-    0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0xAB, 0xFF, 0xAA, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x50,
-    0x00, 0x07, 0xFE, 0x1F, 0xFF, 0x80, 0x07, 0xFD, 0xBF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x07, 0xFF, 0xFA, 0xFF, 0xFC, 0x07, 0xFF, 0xC0, 0x2F, 0xFC, 0x07, 0xFF, 0x40, 0x0F, 0xFC, 0x07,
-    0xFF, 0x00, 0x0F, 0xFD, 0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE,
-    0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00,
-    0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B,
-    0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF,
-    0xD1, 0xFF, 0x80, 0x0B, 0xFE, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F,
-    0xE0, 0x2F, 0xF4, 0x01, 0xFF, 0x81, 0xFF, 0x80, 0x07, 0xFE, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xBF, 0xFC, 0x00,
-    0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x07, 0xFE,
-    0x00, 0xFF, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xE0, 0x7F, 0xE0, 0x01, 0xFF, 0xD1, 0xFF, 0x80, 0x02,
-    0xFF, 0xC0, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xF7, 0xFE, 0x00, 0x3F, 0xFF, 0x7F,
-    0xE0, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0xFF, 0xFF, 0x7F, 0xE0, 0x1F, 0xFF, 0xF7, 0xFE, 0x03, 0xFF,
-    0xFF, 0x7F, 0xE0, 0x7F, 0xBF, 0xF7, 0xFD, 0x0F, 0xF3, 0xFF, 0x7F, 0xD2, 0xFD, 0x3F, 0xF7, 0xFD,
-    0x3F, 0xC3, 0xFF, 0x7F, 0xDB, 0xF4, 0x3F, 0xF7, 0xFD, 0xFF, 0x03, 0xFF, 0x7F, 0xFF, 0xD0, 0x3F,
-    0xF7, 0xFF, 0xF8, 0x03, 0xFF, 0x7F, 0xFF, 0x00, 0x3F, 0xF7, 0xFF, 0xE0, 0x03, 0xFF, 0x7F, 0xFC,
-    0x00, 0x3F, 0xF7, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x6A, 0x80, 0x2A, 0x90, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF4, 0x00, 0x03, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0xD0, 0x0F, 0xFC,
-    0x00, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF8, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00,
-    0x00, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01,
-    0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x3F, 0xF7, 0xFE, 0x00, 0x0F, 0xFD, 0xFF, 0x80, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0xFF, 0xDF,
-    0xF8, 0x00, 0x3F, 0xF7, 0xFE, 0x00, 0x0F, 0xFD, 0xFF, 0x80, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0xFF,
-    0xDF, 0xF8, 0x00, 0x3F, 0xF7, 0xFE, 0x00, 0x0F, 0xFD, 0xFF, 0x80, 0x03, 0xFF, 0x7F, 0xE0, 0x00,
-    0xFF, 0xDF, 0xF8, 0x00, 0x3F, 0xF7, 0xFE, 0x00, 0x0F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1A, 0xA0, 0x00,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xFC,
-    0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xF8,
-    0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xF4,
-    0x0F, 0xFD, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xF0,
-    0x07, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x01, 0xFF, 0xFF, 0x40, 0xBF, 0xD0,
-    0x02, 0xFF, 0x43, 0xFF, 0xFF, 0x80, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFD, 0xFF, 0xC0, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0xD1, 0xFF, 0x80, 0x00, 0xBF, 0xEB, 0xF8, 0x7F, 0xE2, 0xFF, 0x00,
-    0x00, 0x3F, 0xFB, 0xF4, 0x3F, 0xF7, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFE,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0xFF, 0xD0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x82, 0xFF, 0x40, 0x07, 0xFE,
-    0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x01, 0xFF, 0xC0, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xF0, 0x0F,
-    0xFC, 0x03, 0xFF, 0x00, 0x3F, 0xFD, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x2F, 0xFF, 0x81, 0xFF, 0x40,
-    0x0F, 0xF8, 0x0F, 0xFF, 0xF0, 0xBF, 0xC0, 0x02, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xE0, 0x00, 0x7F,
-    0xD7, 0xFC, 0xFF, 0x5F, 0xF0, 0x00, 0x0F, 0xFB, 0xFD, 0x2F, 0xEF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0xBF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xAB, 0xFF, 0xAA, 0xA0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0xA9, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-    0xF9, 0x6F, 0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xFF,
-    0x40, 0x7F, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x57, 0xFF, 0x55,
-    0x50, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFD, 0x55, 0xBF, 0xF8, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x0F, 0xFE, 0x56, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xD0, 0x06, 0xF4, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x10, 0xFF, 0xC0, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xD5, 0xBF, 0xF5, 0x55, 0x55, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xEA,
-    0xFF, 0xFA, 0xAA, 0xA9, 0x00, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0x01, 0xB8, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0xFD, 0xBF, 0xD0,
-    0x01, 0xFF, 0xFF, 0xFD, 0xBF, 0xD0, 0x07, 0xFF, 0xFF, 0xFC, 0xBF, 0xD0, 0x0F, 0xFF, 0x41, 0xB8,
-    0xBF, 0xD0, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xE0, 0x3F, 0xF4,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFA, 0xBF, 0xFA, 0xAA, 0x80, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x00,
-    0xBF, 0xD0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xFC, 0x00, 0x04, 0xBF, 0xD0, 0x0F, 0xFF,
-    0x96, 0xBC, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0xFF, 0xFC, 0xBF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0xBF,
-    0xD0, 0x00, 0x1F, 0xF0, 0xFF, 0x4B, 0xF8, 0x00, 0x0F, 0xF8, 0x3F, 0xD1, 0xFF, 0x00, 0x03, 0xFD,
-    0x0F, 0xF4, 0x3F, 0xD0, 0x02, 0xFF, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0x41, 0xFF,
-    0x00, 0x7F, 0xD0, 0x3F, 0xD0, 0x3F, 0xE0, 0x2F, 0xF0, 0x0F, 0xF4, 0x0B, 0xFC, 0x0F, 0xFC, 0x03,
-    0xFD, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xF3, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x2F, 0xE0,
-    0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x7F,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x07, 0xFC, 0xBF, 0xCF, 0xF8, 0x00, 0xBF, 0x87, 0xFC, 0x7F, 0xC0, 0x0F, 0xF4, 0x7F,
-    0xC3, 0xFD, 0x02, 0xFF, 0x07, 0xFC, 0x2F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC1, 0xFF, 0x47, 0xFD, 0x07,
-    0xFC, 0x0F, 0xF8, 0xFF, 0xC0, 0x7F, 0xC0, 0xBF, 0xC0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF3, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x8F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0x3F,
-    0xF0, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0xBF, 0x80, 0x03, 0xFF,
-    0x55, 0x5B, 0xFC, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xAA,
-    0xBF, 0xFB, 0xFF, 0xBF, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0x0F, 0xF8, 0xBF, 0xC0, 0x3F, 0xF0, 0x0B,
-    0xFC, 0x3F, 0xE0, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xE0, 0xFF, 0x83, 0xFE, 0x03, 0xFF, 0x01, 0xFF,
-    0x03, 0xFE, 0x0B, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x3F, 0xF0, 0x3F, 0xE0,
-    0x3F, 0xE0, 0x3F, 0xF0, 0xFF, 0xC2, 0xFF, 0x00, 0xFF, 0x80, 0xBF, 0xC3, 0xFF, 0x0F, 0xFC, 0x03,
-    0xFE, 0x00, 0xFF, 0x8F, 0xFC, 0x7F, 0xE0, 0x0F, 0xF8, 0x03, 0xFF, 0x3F, 0xF2, 0xFF, 0x40, 0x3F,
-    0xE0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-    0x7F, 0xC0, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE3, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0xAA, 0xBF, 0xEF, 0xFE, 0xFF, 0x00, 0x7F, 0xC0, 0x2F, 0xF2, 0xFE, 0x3F,
-    0xD0, 0x1F, 0xF0, 0x0F, 0xF4, 0xBF, 0x8B, 0xF8, 0x07, 0xFC, 0x07, 0xFC, 0x2F, 0xE1, 0xFF, 0x01,
-    0xFF, 0x03, 0xFF, 0x0B, 0xF8, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x42, 0xFE, 0x0B, 0xFC, 0x1F, 0xF0,
-    0xBF, 0xC0, 0xBF, 0x80, 0xFF, 0x47, 0xFC, 0x3F, 0xE0, 0x2F, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xE5, 0x55, 0x7F, 0xF4, 0x00, 0x00,
-    0xBF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x3F, 0xF2,
-    0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x07, 0xFE, 0x00,
-    0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x2F, 0xF4, 0x03, 0xFF, 0x00,
-    0xFF, 0xC0, 0x7F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x0F, 0xFC, 0x02,
-    0xFF, 0x43, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0x00, 0x03,
-    0xFD, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xDF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFC,
-    0xBF, 0x8F, 0xF0, 0x03, 0xFD, 0x2F, 0xE2, 0xFE, 0x00, 0xFF, 0x0B, 0xF8, 0x3F, 0xC0, 0x7F, 0x82,
-    0xFE, 0x0F, 0xF4, 0x3F, 0xD0, 0xBF, 0x82, 0xFE, 0x0F, 0xF0, 0x2F, 0xE0, 0x3F, 0xCB, 0xF8, 0x0B,
-    0xF8, 0x0F, 0xF4, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x55, 0x57, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0x80, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x3F, 0xF5, 0x55,
-    0x57, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFA,
-    0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xE3, 0xFF, 0x2F, 0xFC, 0x03, 0xFF,
-    0x00, 0x7F, 0xE0, 0xFF, 0xC3, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x7F, 0xE0, 0x3F,
-    0xF0, 0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x0B, 0xFD, 0x03, 0xFF, 0x02, 0xFF, 0x43,
-    0xFF, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0xFF, 0xC0, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC,
-    0x3F, 0xF0, 0xBF, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0x4F, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x7F,
-    0xE3, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xC0, 0x0F, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF4, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x3F, 0xEF, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xFA, 0xAB, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xC0, 0x3F, 0xD3, 0xFC, 0xBF,
-    0xC1, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x07, 0xFC, 0x0B, 0xF8, 0x3F, 0xC2, 0xFD, 0x1F, 0xF0,
-    0x3F, 0xC0, 0xFF, 0x07, 0xFC, 0x7F, 0xC1, 0xFF, 0x03, 0xFC, 0x0F, 0xF1, 0xFF, 0x0B, 0xF8, 0x0F,
-    0xF0, 0x2F, 0xD7, 0xFC, 0x3F, 0xD0, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0x54, 0x00, 0x1B, 0xD0, 0x00,
-    0xFF, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xC2, 0xFF, 0xA0, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xE4, 0x00, 0x7F, 0xF8, 0x02, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x15, 0x5B, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2A, 0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x16, 0xAF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF9, 0x54, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAB, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x7F, 0x40, 0x1F, 0xF8, 0x01, 0xFE, 0x07, 0xFF,
-    0x80, 0x0B, 0xF9, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0x94, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0x5A, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFE, 0x55, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0xAF, 0xE4, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3F,
-    0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x4F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0xBF, 0xC0,
-    0x0F, 0xF8, 0xFF, 0x80, 0x2F, 0xF0, 0x03, 0xFE, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x8F, 0xF8,
-    0x02, 0xFF, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0xFF, 0x80, 0x2F, 0xF0, 0x03,
-    0xFE, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x4F, 0xF8, 0x02, 0xFF, 0x00, 0x7F, 0xD3, 0xFE, 0x00,
-    0xBF, 0xC0, 0x1F, 0xF4, 0xFF, 0xC0, 0x2F, 0xF0, 0x0F, 0xFC, 0x1F, 0xF8, 0x0B, 0xFC, 0x07, 0xFF,
-    0x03, 0xFF, 0xD2, 0xFF, 0x1B, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x1F, 0xF8, 0xBF, 0xC0, 0x2F, 0xF0, 0x0F,
-    0xFC, 0xBF, 0xC0, 0x2F, 0xF0, 0x0F, 0xFC, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0xBF, 0xC0, 0x2F,
-    0xF0, 0x0B, 0xFD, 0xBF, 0xC0, 0x2F, 0xF0, 0x07, 0xFD, 0xBF, 0xC0, 0x2F, 0xF0, 0x07, 0xFE, 0xBF,
-    0xC0, 0x2F, 0xF0, 0x07, 0xFE, 0xBF, 0xC0, 0x2F, 0xF0, 0x03, 0xFE, 0xBF, 0xC0, 0x2F, 0xF0, 0x07,
-    0xFE, 0xBF, 0xC0, 0x2F, 0xF0, 0x07, 0xFE, 0xBF, 0xD0, 0x2F, 0xF0, 0x0B, 0xFD, 0x7F, 0xF0, 0x2F,
-    0xF0, 0x0F, 0xFC, 0x3F, 0xF8, 0x2F, 0xF0, 0x7F, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x2F,
-    0xF8, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0x00, 0x0B, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x1F, 0xFC, 0x00,
-    0x00, 0x1F, 0xF8, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x65,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0xFF, 0xE0, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x07, 0xFE, 0x1F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFE, 0xAA, 0xAF, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x02, 0xFF, 0x82,
-    0xFF, 0xC0, 0x1F, 0xFD, 0x03, 0xFF, 0xFB, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x0B, 0xF9, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xFE, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0xD4, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x00, 0xFF,
-    0x80, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0xBF, 0xC0, 0x00,
-    0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF1, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF6, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFC, 0x2F, 0xF4, 0x00, 0x3F, 0xFB, 0x03, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x00, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0xFF, 0xC0,
-    0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xCF, 0xF8, 0x00,
-    0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x06, 0xA8, 0x2A, 0x90, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xF9, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x3F, 0xF0, 0x00, 0x00,
-    0xBF, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0xD4, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00,
-    0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x2F,
-    0xF4, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x7F,
-    0xD0, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x2A, 0x91, 0xAA, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x00, 0x00,
-    0x0B, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0x1F,
-    0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0xBF, 0xD0, 0x00, 0xFF, 0xEC, 0x0F,
-    0xF8, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF8, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0x0B, 0xFE, 0x2F,
-    0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xC0,
-    0xFF, 0xD0, 0x01, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4,
-    0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x1F, 0xF8, 0x0B, 0xFD, 0x03,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0xBF, 0xD0, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x8B, 0xFD, 0x00,
-    0xBF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFE,
-    0x00, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFB, 0xFC, 0x00,
-    0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xF4,
-    0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x57, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0xBF, 0xF0, 0x03,
-    0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0x40, 0x3F, 0xF0,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x0F,
-    0xFC, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x3F, 0xF0, 0x07, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xC7, 0xFC,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x02, 0xFF, 0x80,
-    0x03, 0xFE, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xEA, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xBF, 0xEF, 0xFF, 0xC0,
-    0x3F, 0xFE, 0x0B, 0xD0, 0xFF, 0xF4, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFE, 0x3F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF3, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x8F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x3F,
-    0xFC, 0x0F, 0xFF, 0x41, 0xA0, 0x2F, 0xFE, 0x01, 0xFF, 0xFA, 0xFF, 0x7F, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xF1, 0xFC, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC7, 0xFF,
-    0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xD0, 0x50, 0x2F, 0xF8, 0x1F, 0xFC,
-    0x7F, 0x5F, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x2F, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0x40, 0xB0, 0x00,
-    0xA0, 0x1F, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x82, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x3F,
-    0xF0, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x0F,
-    0xFC, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00,
-    0x3F, 0xF4, 0x0F, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x7F, 0xFE, 0x02, 0xFF, 0xF8,
-    0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF,
-    0x80, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x2A, 0x2E, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xF0, 0x1F, 0xFF, 0xAE, 0x00, 0x0E, 0x6F, 0xFE, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC3, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x9F, 0xFC, 0x00, 0x2A, 0xA0, 0x00, 0x7F, 0xE7, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x02, 0xFF, 0x8F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xD2, 0xFF, 0xC0, 0x2F, 0xFF, 0x00,
-    0xBF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x5B, 0xD6, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x03, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xF4,
-    0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x1F, 0xFC,
-    0x00, 0x3F, 0xFC, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xF4, 0x0F, 0xFD,
-    0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFF,
-    0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x01, 0xFF, 0xFF, 0x40, 0xBF, 0xD0, 0x02, 0xFF,
-    0x43, 0xFF, 0xFF, 0x80, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFD, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC7, 0xFC, 0xFF, 0xD1, 0xFF, 0x80, 0x00, 0xBF, 0xEB, 0xF8, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0x3F,
-    0xFB, 0xF4, 0x3F, 0xF7, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xAA, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xF4, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0xFF, 0xC0,
-    0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x07, 0xFE, 0x00, 0x1F,
-    0xFC, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x03, 0xFF, 0xD0,
-    0x3F, 0xE0, 0x07, 0xFD, 0x02, 0xFF, 0xF8, 0x1F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xFF, 0x0B, 0xFC,
-    0x00, 0x2F, 0xF0, 0xFF, 0xFF, 0xC3, 0xFE, 0x00, 0x07, 0xFD, 0x7F, 0xCF, 0xF5, 0xFF, 0x00, 0x00,
-    0xFF, 0xBF, 0xD2, 0xFE, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x00, 0x03, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFD, 0x00, 0x7F, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x40, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x10, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x1F, 0xFF, 0x9A, 0xF4, 0x3F, 0xFC, 0x00, 0x10, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xEB, 0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x04, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x0F, 0x80,
-    0x00, 0x2F, 0xE3, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x0B, 0xC1, 0xFD, 0x18, 0x00, 0xF8, 0x01, 0x83,
-    0xF4, 0x3F, 0x00, 0x00, 0x2F, 0xFB, 0xD0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBC, 0xBF, 0x80, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x03,
-    0xF0, 0x01, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2A, 0xAA, 0xBF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0x47, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xFF,
-    0xF4, 0x16, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFD, 0x7F, 0xFD, 0x0F, 0xE3, 0xA4, 0x00, 0x7E, 0x05,
-    0x43, 0xFD, 0x7F, 0xE7, 0xF4, 0x3F, 0x02, 0xFD, 0x07, 0xE0, 0x00, 0x05, 0x03, 0xFC, 0x7F, 0xE1,
-    0xFE, 0x0B, 0xD2, 0xFC, 0x7D, 0x00, 0x00, 0x01, 0x54, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x3F, 0xFF,
-    0xFE, 0x97, 0xFF, 0xFF, 0xFD, 0x7F, 0x02, 0xFF, 0xD6, 0x90, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFA, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xEB,
-    0xE0, 0x00, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0xB4, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x41,
-    0xED, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00,
-    0x18, 0x00, 0x90, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x5B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x02, 0x90, 0x00, 0x01, 0xBC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x06, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x06, 0xA4,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xFA, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x1F, 0xFB, 0xFD, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0xCF, 0xF4, 0x00, 0xFF, 0x80, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x00,
-    0x7F, 0xF0, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFF, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x0F,
-    0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x3F, 0xD0, 0x03, 0xFE, 0x0B, 0xFD, 0x00, 0xFF, 0x40, 0x0F,
-    0xF8, 0x7F, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x6F, 0xF8,
-    0x00, 0x3F, 0xD0, 0x03, 0xFE, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFD,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xF9, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFB, 0xFF,
-    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x3F, 0xFD, 0x00, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6B, 0xE9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xFF,
-    0x40, 0x07, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xD0,
-    0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0xFF, 0x40, 0x07, 0xFD, 0x01, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0x40, 0xFF, 0xDF, 0xF4, 0x00, 0x7F, 0xD0, 0xBF, 0xD7, 0xFD, 0x00, 0x1F, 0xF4, 0x7F,
-    0xF1, 0xFF, 0x40, 0x07, 0xFD, 0x3F, 0xF0, 0x7F, 0xD0, 0x01, 0xFF, 0x2F, 0xF4, 0x1F, 0xF4, 0x00,
-    0x7F, 0xDF, 0xFC, 0x07, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0xFE, 0x00,
-    0x7F, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xFE, 0xA8, 0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x1F,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC7, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x17, 0xFF, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x5A, 0xFF, 0xFC, 0x03, 0xFF,
-    0x00, 0x1F, 0xFD, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x03, 0xFF, 0x00,
-    0x07, 0xFE, 0x03, 0xFF, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x01, 0xBF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE4, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xAA, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xAB, 0xFF, 0xAA, 0x90, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x40,
-    0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFE, 0x55, 0x7F, 0xFC, 0x07,
-    0xFE, 0x00, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x07, 0xFF,
-    0x55, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF,
-    0xF9, 0x00, 0xFF, 0xFF, 0xE9, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFF, 0xF4, 0xFF, 0xD5, 0x6F, 0xFF, 0x3F, 0xF0, 0x01, 0xFF, 0xCF, 0xFC, 0x00, 0x3F, 0xF7,
-    0xFF, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0xE2, 0xFF, 0x7F, 0xF0, 0xFD, 0xFF, 0xCF, 0xFC, 0x3F, 0xFF,
-    0xF3, 0xFF, 0xAB, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xA9, 0x5F, 0xD0, 0xFF, 0xC0, 0x02, 0xF4, 0x3F, 0xF0, 0x00, 0x20, 0x0F, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x40, 0x07, 0xFC, 0x2F, 0xFF,
-    0x40, 0x7F, 0xCF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0x5B, 0xFF, 0x87, 0xFF,
-    0x80, 0x2F, 0xFC, 0x7F, 0xF0, 0x00, 0xFF, 0xD7, 0xFE, 0x00, 0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0xBF,
-    0xE7, 0xFE, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x7F, 0xE7, 0xFE, 0x02, 0xCB, 0xFE, 0x7F, 0xF0,
-    0xFF, 0xFF, 0xD7, 0xFF, 0x0B, 0xFF, 0xFC, 0x7F, 0xFC, 0x3F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xFD, 0xFF, 0xFF, 0xD0, 0x7F, 0xD2, 0xFF, 0xFF, 0x07, 0xFE, 0x01,
-    0x57, 0xF4, 0x7F, 0xE0, 0x00, 0x1D, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFD, 0x55, 0x55, 0x43, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x02, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xAA,
-    0xA9, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0x55, 0x55, 0x50, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x17, 0xFF, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xAF, 0xFE,
-    0xAA, 0x40, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFD,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xD5,
-    0x55, 0x54, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0x54, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xD5, 0x5B, 0xFF, 0xF4, 0xFF, 0xC0, 0x00, 0xBF, 0xFC, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0,
-    0x00, 0x03, 0xFE, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x09, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x7F, 0xE5, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xF8, 0x07, 0xFF, 0xC7, 0xFE, 0x00, 0x3F, 0xF5, 0xFF,
-    0x80, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x3F, 0xF7, 0xFE, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x06, 0x41, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xF8, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xD0, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x2F, 0xF0, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x1F, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0x82, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF2, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xF3,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF,
-    0xFB, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF6, 0xFF, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x2F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x2F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x02, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x00, 0x3F, 0xF5, 0x54,
-    0x0B, 0xFE, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xFF, 0xE1, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFE, 0x3F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xEB, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xD0, 0x03, 0xFF,
-    0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x2F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0xBF,
-    0xE0, 0x2F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFC, 0x2F, 0xF0, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x2F, 0xF1, 0xFF, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0x6F, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xAF, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x2F, 0xF2, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFD, 0x2F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xBF,
-    0xF0, 0x2F, 0xF0, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFF, 0xFE, 0x03, 0xFF,
-    0x40, 0x2F, 0xF0, 0x03, 0xFF, 0xFF, 0x0F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xFF, 0x2F, 0xFC,
-    0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x0B, 0xD0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x05, 0x56, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1A, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0x75, 0x00, 0x0B, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xD1,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0x6F, 0xD0, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x01, 0xBF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFC, 0x3E, 0x40, 0x7F, 0xF4, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x55, 0x6F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x02, 0xFF, 0xEF, 0xAA, 0xBF, 0xFE, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x46, 0xFF,
-    0xFF, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x02, 0xA8, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x01, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xC2, 0xFF,
-    0x80, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC3,
-    0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x1F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xF5, 0x54, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xEF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xEF,
-    0xFC, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xD0, 0xBF, 0xD0, 0x03, 0xFF, 0x80, 0xBF, 0xD0, 0x0B, 0xFE, 0x00,
-    0xBF, 0xD0, 0x1F, 0xFC, 0x00, 0xBF, 0xD0, 0x7F, 0xF0, 0x00, 0xBF, 0xD0, 0xFF, 0xD0, 0x00, 0xBF,
-    0xD3, 0xFF, 0x40, 0x00, 0xBF, 0xDB, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xEF,
-    0xFE, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x40, 0x00, 0xBF, 0xD1, 0xFF, 0xD0, 0x00, 0xBF, 0xD0, 0xBF,
-    0xF0, 0x00, 0xBF, 0xD0, 0x3F, 0xFC, 0x00, 0xBF, 0xD0, 0x0F, 0xFF, 0xFD, 0xBF, 0xD0, 0x03, 0xFF,
-    0xFE, 0xBF, 0xD0, 0x01, 0xFF, 0xFE, 0xBF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xA9, 0x3F, 0xE0,
-    0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x0A, 0x07, 0xFF, 0x00, 0xFF, 0xC3,
-    0xC3, 0xFF, 0x40, 0x3F, 0xF0, 0xF7, 0xFF, 0x80, 0x0F, 0xFC, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0x0F,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC3, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x7F,
-    0xF0, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFB, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF0, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0x0F, 0xBF,
-    0xF4, 0x00, 0xFF, 0xC3, 0xCB, 0xFF, 0x00, 0x3F, 0xF0, 0xF0, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFD, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x03, 0xFF, 0x4B, 0xFD, 0x29, 0x3F, 0xF8, 0x2F, 0xF4, 0xF6, 0xFF, 0x80, 0xBF,
-    0xD3, 0xFF, 0xFC, 0x02, 0xFF, 0x4F, 0xFF, 0xC0, 0x0B, 0xFD, 0x3F, 0xFD, 0x00, 0x2F, 0xF4, 0xFF,
-    0xD0, 0x00, 0xBF, 0xDB, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00,
-    0x2F, 0xF4, 0xFF, 0xD0, 0x00, 0xBF, 0xD3, 0xFF, 0xC0, 0x02, 0xFF, 0x4F, 0xFF, 0xC0, 0x0B, 0xFD,
-    0x3F, 0xFF, 0xC0, 0x2F, 0xF4, 0xFB, 0xFF, 0x80, 0xBF, 0xD3, 0xD3, 0xFF, 0x42, 0xFF, 0x45, 0x07,
-    0xFF, 0x4B, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x6F, 0xFE, 0xA0, 0x0F, 0xFE, 0x0B, 0xFF, 0xFF, 0x01, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0,
-    0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0x0F, 0xFD, 0x00, 0x6F, 0xFE, 0x91, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD6, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xEB, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x0F,
-    0xFC, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xF4, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xF4,
-    0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xBF, 0xFE, 0xA9, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xBF, 0xFA, 0xA0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0x80, 0x0B, 0xFE, 0x00,
-    0x7F, 0xE0, 0x0B, 0xFF, 0x00, 0x1F, 0xF8, 0x07, 0xFF, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0x01,
-    0xFF, 0x83, 0xFF, 0x40, 0x00, 0x7F, 0xE2, 0xFF, 0x80, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0x7F, 0xE3, 0xFF, 0x80, 0x00, 0x1F,
-    0xF8, 0x3F, 0xF4, 0x00, 0x07, 0xFE, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0x7F,
-    0xE0, 0x0F, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xE0, 0x07, 0xFE, 0x00, 0x0F, 0xFE, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0xD0, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFE, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0x4F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0x43, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x55, 0x7F, 0xF4,
-    0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xD0, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x3F,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x4F, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x1F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x07, 0xFF,
-    0x40, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF0, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x02,
-    0xFF, 0x40, 0xAA, 0xAF, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x1F, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF6, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xF8, 0xFF, 0xC0, 0x00, 0x07,
-    0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x80, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xF5, 0x55, 0x57, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFA, 0xAA,
-    0xAB, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00,
-    0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF9, 0x54, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0x00, 0x00, 0x2F,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x07, 0xFE,
-    0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x7F,
-    0xE0, 0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xAA, 0xAF, 0xFD, 0x00,
-    0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0,
-    0x07, 0xFE, 0x00, 0x0B, 0xFF, 0xAA, 0x7F, 0xE0, 0x00, 0xBF, 0xFF, 0xF7, 0xFE, 0x00, 0x0B, 0xFF,
-    0xFF, 0x7F, 0xE0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFF, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x55, 0x7F, 0xF0, 0x00, 0x02,
-    0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xF5, 0x55, 0x57, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFA,
-    0xAA, 0xAB, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x7F,
-    0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x7F, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x7F, 0xE0, 0x00, 0xBF, 0xFA,
-    0xA8, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00,
-    0xBF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFA, 0xAA, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0,
-    0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00,
-    0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x7F,
-    0xE0, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x45, 0x50, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0x00, 0x00, 0xFF, 0xE5, 0x5B, 0xFF, 0xF4, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x1F,
-    0xFF, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xDF, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xFB, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x7F, 0xFA, 0xAA, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFF,
-    0xD5, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x80,
-    0x07, 0xFE, 0x07, 0xFF, 0x87, 0xFE, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x1F, 0xF8, 0x00, 0x7F, 0xE0,
-    0x0B, 0xFD, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x1F, 0xF5, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x7F, 0xD7,
-    0xFE, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x90, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x07, 0xFF, 0xD0, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0x50, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x2F, 0xF4, 0x02, 0xFF, 0xFF, 0xF0, 0x3F,
-    0xF0, 0x03, 0xFF, 0x6F, 0xF8, 0x3F, 0xF0, 0x07, 0xFD, 0x0B, 0xFC, 0x3F, 0xF0, 0x0B, 0xFC, 0x07,
-    0xFC, 0x3F, 0xF0, 0x0B, 0xFC, 0x07, 0xFC, 0x3F, 0xF0, 0x0B, 0xFC, 0x07, 0xFC, 0x3F, 0xF0, 0x07,
-    0xFC, 0x07, 0xFC, 0x3F, 0xF4, 0x07, 0xFC, 0x0B, 0xFC, 0x2F, 0xFC, 0x03, 0xFD, 0x0F, 0xF8, 0x1F,
-    0xFD, 0x02, 0xFF, 0x2F, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xBF, 0xF0, 0x07, 0xFF, 0xE0, 0xBF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0x40, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x59, 0x00, 0x00, 0x3F, 0xF8,
-    0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x0F, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F, 0xFF, 0xF8, 0x7F, 0xE0, 0x3F,
-    0xEF, 0xFC, 0x7F, 0xE0, 0x7F, 0x83, 0xFC, 0x7F, 0xE0, 0x7F, 0x42, 0xFD, 0x7F, 0xE0, 0x7F, 0x42,
-    0xFC, 0x7F, 0xF0, 0x7F, 0x83, 0xFC, 0x3F, 0xF0, 0x3F, 0xCB, 0xFC, 0x2F, 0xFC, 0x2F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xBF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD5, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x50, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00,
-    0x10, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x57, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x6A, 0x40, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F, 0xFC, 0x00, 0x10, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x28, 0x0F,
-    0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x05, 0xBF, 0x40, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x15, 0x57, 0xFF, 0x95, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x50, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFF, 0xFE, 0x2A, 0xAB, 0xFF, 0xAA, 0x90, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0xA0, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F, 0xFC, 0x00,
-    0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x07,
-    0xFF, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xFC,
-    0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F, 0xFC, 0x00, 0xBF, 0xE0, 0x0F,
-    0xFC, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x03, 0xFF, 0x00, 0x02, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x00, 0xFF, 0xCF,
-    0xFC, 0x00, 0x00, 0x7F, 0xDF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x02, 0xFF, 0x9F, 0xFC, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00,
-    0x7F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F,
-    0xFD, 0x00, 0x03, 0xFF, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0A, 0xAB, 0xFF, 0xAA,
-    0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0A, 0xAB, 0xFF, 0xAA, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x2F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F,
-    0xFC, 0x00, 0xBF, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x01, 0xFF, 0xC0, 0x07, 0xFF,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x7F, 0xDF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xAB, 0xFF, 0xEA, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF,
-    0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x1F, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0xD3, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x2F,
-    0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF5, 0x54, 0x0B,
-    0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x1F,
-    0xFF, 0xF2, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0xFF,
-    0xD0, 0x0B, 0xFF, 0x00, 0x2F, 0xFC, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x7F,
-    0xF2, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF6, 0xFF, 0x80, 0x00, 0x2F, 0xFC,
-    0x3F, 0xF4, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0xFE, 0x0F, 0xFE, 0x00, 0xFF, 0xFF, 0x8B, 0xFF, 0x00,
-    0x1F, 0xFF, 0xE7, 0xFF, 0x40, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x4B, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xF4, 0x00, 0x15, 0x5B, 0xFF, 0x55,
-    0x50, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF9, 0x54, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x8B, 0xFD, 0x00, 0x2A, 0xBF, 0xFA, 0xA4, 0xBF, 0xD0, 0x00, 0x03,
-    0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00,
-    0x03, 0xFF, 0xAA, 0xAF, 0xFF, 0xAA, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF,
-    0xC0, 0x06, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF9, 0x3F, 0xF4, 0x00, 0x00,
-    0x01, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x54, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0xBF,
-    0xD0, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00, 0x0B,
-    0xFD, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xD0, 0x0F, 0xFF, 0x45, 0xBF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF8, 0xBF, 0xD0, 0x00, 0x05, 0x50, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xA9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xA9,
-    0xBF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF,
-    0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0,
-    0x14, 0x07, 0xFE, 0xFF, 0xC0, 0x7C, 0x07, 0xFE, 0xFF, 0xC0, 0x7C, 0x07, 0xFE, 0xFF, 0xD0, 0x7C,
-    0x07, 0xFE, 0xFF, 0xE0, 0x7C, 0x07, 0xFE, 0xFF, 0xF4, 0x7C, 0x6F, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x87, 0xFE,
-    0x00, 0x00, 0xBC, 0x07, 0xFE, 0x00, 0x00, 0x7C, 0x07, 0xFE, 0x00, 0x00, 0x7C, 0x07, 0xFE, 0x00,
-    0x00, 0x7C, 0x07, 0xFE, 0x00, 0x00, 0x7C, 0x07, 0xFE, 0x00, 0x00, 0x14, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0xE3, 0xFF, 0x00, 0x02, 0xFF, 0x8F, 0xFC, 0x00, 0x0B, 0xFE, 0x3F, 0xF0, 0x00, 0x2F, 0xF8,
-    0xFF, 0xC0, 0x40, 0xBF, 0xE3, 0xFF, 0x0B, 0x82, 0xFF, 0x8F, 0xFC, 0x2E, 0x0B, 0xFE, 0x3F, 0xF0,
-    0xB8, 0x3F, 0xF8, 0xFF, 0xF7, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x02, 0xFF, 0xFE, 0x6F, 0xF8, 0x00, 0x57, 0xE0, 0xBF, 0xE0, 0x00, 0x0B, 0x82, 0xFF, 0x80,
-    0x00, 0x2E, 0x0B, 0xFE, 0x00, 0x00, 0xB8, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x6F,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0x94, 0x1F, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x15, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFD, 0x01, 0x94, 0x00, 0xBF, 0xD3, 0xFF, 0xF8, 0x0B, 0xFD, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x8B, 0xFF, 0xF9, 0xBF, 0xFC, 0xBF, 0xF8, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFD,
-    0xBF, 0xF0, 0x00, 0xFF, 0xDB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFD, 0x00,
-    0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB,
-    0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00,
-    0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x1F,
-    0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xE1, 0xFD, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFC,
-    0xBF, 0x43, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x7F, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xEF, 0xFE,
-    0xBF, 0xF5, 0x55, 0x55, 0x6F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x6A, 0xFF, 0xFA, 0xAA,
-    0xAA, 0xAA, 0xA8, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x06, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x7F,
-    0xF0, 0x2F, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0x87, 0xFE, 0x00, 0x0F, 0xFC, 0x3F, 0xDB, 0xFE,
-    0x00, 0x0B, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x20, 0x00, 0x01, 0xFF,
-    0xF9, 0x5B, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xE1, 0xFD, 0x0F,
-    0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0x43, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x7F, 0xD1, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xEF, 0xFE, 0xBF, 0xF5, 0x55, 0x55, 0x6F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x6A, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x06, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x7F,
-    0xF0, 0x2F, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0x87, 0xFE, 0x00, 0x0F, 0xFC, 0x3F, 0xDB, 0xFE,
-    0x00, 0x0B, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x20, 0x00, 0x01, 0xFF,
-    0xF9, 0x5B, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0xBF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x03,
-    0xFF, 0x00, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xE7, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xF4, 0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFC, 0x0B, 0xFF, 0x00, 0x00,
-    0x2F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFD, 0x00,
-    0x0F, 0xFF, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF8,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xBF,
-    0xF1, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xAA, 0x40, 0x6A, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x03,
-    0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xF8, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x03, 0xFE, 0x01, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x3F, 0xE0, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xEF, 0xFE,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC3, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0x82, 0xFF,
-    0xC0, 0x00, 0xBF, 0xF0, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x0F, 0xF8, 0x07, 0xFF, 0x40,
-    0x3F, 0xF4, 0x03, 0xFE, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xFE, 0x1F, 0xFC,
-    0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFD,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0x00,
-    0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x40, 0x00,
-    0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0xE9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0x95, 0x5B, 0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x00, 0x1F, 0xFB, 0xFF,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x19, 0x01, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x87, 0xFE, 0x00,
-    0x3F, 0xFC, 0x1F, 0xF8, 0x03, 0xFF, 0xC0, 0x7F, 0xE0, 0x2F, 0xFC, 0x01, 0xFF, 0x82, 0xFF, 0xC0,
-    0x07, 0xFE, 0x1F, 0xFC, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-    0xFF, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFE, 0xAF,
-    0xFF, 0xC1, 0xFF, 0x80, 0x07, 0xFF, 0x87, 0xFE, 0x00, 0x07, 0xFF, 0x1F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF5, 0xFF, 0x80, 0x00, 0x7F, 0xD7, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x50, 0x2F,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x55, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x3F, 0xF5, 0x54, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0xBF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xF4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xEA, 0xAF, 0xFC, 0x00,
-    0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x0F,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0x80, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x00,
-    0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFE, 0xA9, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFD, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xFC, 0x05, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0xFF, 0xC0,
-    0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xD5, 0x55, 0x5F, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xEA, 0xAA, 0xAF, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x19, 0x01, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0xBF,
-    0xD7, 0xFE, 0x00, 0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0xBF, 0xD7, 0xFE, 0x00, 0x0B, 0xFD, 0x7F, 0xE0,
-    0x00, 0xBF, 0xD7, 0xFE, 0x00, 0x0B, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xAA, 0xAF, 0xFD, 0x7F, 0xE0, 0x00, 0xBF, 0xD7, 0xFE, 0x00,
-    0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0xBF, 0xD7, 0xFE, 0x00, 0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0xBF, 0xD7,
-    0xFE, 0x00, 0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x24, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xF5, 0x55, 0x57, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFA, 0xAA, 0xAB, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x80, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF9, 0x55, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0xBF, 0xFF,
-    0xF3, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x07, 0xFE,
-    0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x01,
-    0xFF, 0x80, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFE, 0xAA, 0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80,
-    0x02, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xFE, 0xA8, 0x7F,
-    0xE0, 0x00, 0xBF, 0xFF, 0xF1, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xC7, 0xFE, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0,
-    0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00,
-    0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x07,
-    0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x00, 0x07, 0xFE,
-    0xFF, 0xF4, 0x01, 0xBF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFE, 0x47, 0xFE, 0x00, 0x01, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0x5B, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00,
-    0xBF, 0xDF, 0xFC, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0xBF, 0xDF, 0xFC, 0x00, 0x0B, 0xFD, 0xFF,
-    0xC0, 0x00, 0xBF, 0xDF, 0xFC, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0xFF, 0xDF, 0xFF, 0x45, 0xBF,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF8, 0xBF, 0xD0, 0x05,
-    0x50, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x06, 0xAF, 0xFD, 0x00, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xA8, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xFB, 0xFC, 0x00, 0x0B, 0xFB, 0xFD, 0x00, 0x3F,
-    0xDF, 0xF0, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0xFF, 0x6F, 0xD0, 0x00, 0xFF, 0x3F, 0xD0, 0x03, 0xFD,
-    0x7F, 0x80, 0x07, 0xF4, 0xFF, 0x40, 0x0F, 0xF4, 0xFF, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x3F, 0xD3,
-    0xFD, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0xFF, 0x47, 0xF8, 0x07, 0xF4, 0x7F, 0xD0, 0x03, 0xFE, 0x0F,
-    0xF0, 0x3F, 0xC1, 0xFF, 0x40, 0x0F, 0xF8, 0x3F, 0xD0, 0xFF, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0xBF,
-    0x87, 0xF8, 0x1F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0x3F, 0xC0, 0x7F, 0xD0, 0x03, 0xFE, 0x03, 0xFD,
-    0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xF8, 0x0B, 0xFF, 0xF8, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x1F, 0xFF,
-    0xC0, 0x1F, 0xF9, 0x55, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0xFB, 0xFE, 0x00, 0xBF, 0xF8,
-    0x01, 0xFF, 0xFF, 0xDF, 0xF8, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x3F, 0xE0, 0x03, 0xFF, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFD, 0xFE, 0x00, 0x7F, 0xBF, 0xE0, 0x01, 0xFF, 0x3F, 0xC0,
-    0x2F, 0xCF, 0xF8, 0x00, 0x7F, 0xCB, 0xF4, 0x0F, 0xF3, 0xFE, 0x00, 0x1F, 0xF1, 0xFF, 0x07, 0xF4,
-    0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xE0, 0x01, 0xFF, 0x0B, 0xF8, 0xFE, 0x0F, 0xF8,
-    0x00, 0x7F, 0xC0, 0xFF, 0xBF, 0x43, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0x80, 0x07,
-    0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0xA8, 0x7F, 0xC0,
-    0x2F, 0xFC, 0x03, 0xFF, 0xFF, 0x1F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xFF, 0xC7, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB,
-    0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0xBF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8,
-    0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
-    0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x02, 0xA9, 0x00, 0xAA, 0x00, 0xBF, 0xC0,
-    0x7F, 0xC0, 0x0F, 0xF8, 0x7F, 0xE0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x01,
-    0xAF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE, 0xBF, 0xD0,
-    0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F,
-    0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF,
-    0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0xFD, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x0F, 0xF8, 0x2F, 0xF0, 0x01, 0xFD, 0x07,
-    0xF4, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07,
-    0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-    0xEA, 0xFF, 0x95, 0x55, 0x50, 0x00, 0x0B, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xFD, 0x55, 0x54, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFE, 0x00, 0x1F, 0xFE, 0xAA, 0xA8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0x56, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x05, 0xA4, 0x00, 0x05, 0x94, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x02, 0xE4, 0x0B, 0xFF, 0xF4, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x0B, 0xFC, 0x01, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFA, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF1, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x81,
-    0xFF, 0xE5, 0xBF, 0xFF, 0xF9, 0x5B, 0xF0, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x54, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x7F, 0xC0, 0x7F, 0xC3, 0xFF,
-    0xBF, 0xF8, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5,
-    0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA,
-    0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0x02, 0xA9, 0x01, 0xAA, 0x00, 0x2F, 0xE0, 0x2F, 0xF0, 0x01, 0xFF, 0x47,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF,
-    0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xF9, 0x40, 0x1B,
-    0xFF, 0xD0, 0x0F, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x04, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x2A, 0xAA, 0xAA, 0xAA, 0xAF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xAA, 0xAA, 0xAF, 0xFC, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xF4,
-    0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x16, 0x94, 0x00, 0x00, 0xBF,
-    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0x90, 0x6F, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x15, 0x55,
-    0x55, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xD0, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0x81, 0xFF, 0xD5,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x1F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xF9, 0x40, 0x1B,
-    0xFF, 0xD0, 0x0F, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x04, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x2A, 0xAA, 0xAA, 0xAA, 0xAF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xAA, 0xAA, 0xAF, 0xFC, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xF4,
-    0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x7F, 0x00, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x02, 0xFC, 0x0B, 0xF0,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFD, 0x01, 0xF9, 0x06, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0x55, 0x55,
-    0x5F, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFD, 0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x3F, 0xF8, 0x1F, 0xFD, 0x5F,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xFE, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x00,
-    0x1F, 0xF8, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0xC3, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFC, 0x0B,
-    0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0,
-    0x1F, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x00, 0xBF, 0xF1, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0x03, 0xFF, 0x00,
-    0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xF8, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x03, 0xFE,
-    0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x3F, 0xE0, 0xFF,
-    0xC0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0xEF, 0xFE, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC3, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD0,
-    0xFF, 0x82, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x0F, 0xF8,
-    0x07, 0xFF, 0x40, 0x3F, 0xF4, 0x03, 0xFE, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0xFF, 0x80, 0x0F,
-    0xFE, 0x1F, 0xFC, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01,
-    0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x1F, 0xF0, 0x3F, 0xD0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0x40, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x15, 0x5B, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0x6A, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0xD4, 0x00, 0x2F, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBE, 0x01, 0xFF, 0x07,
-    0xFC, 0x07, 0xFC, 0x1F, 0xF0, 0x0F, 0xE0, 0x3F, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x16, 0x94, 0x00, 0x6F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x0F,
-    0x90, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x15, 0x5B, 0xFF, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xFB, 0xEA, 0xAF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xD1, 0xBF, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x05,
-    0x55, 0x5F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0xAA, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x0E, 0x40, 0x00, 0x7F, 0xFC, 0x3F, 0xFE, 0xBF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x0A, 0xAA, 0xAB, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0x56, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x40, 0x00, 0x03, 0xFF, 0x83, 0xE4, 0x00, 0x7F, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1B,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0xBF, 0xFC, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0xCF, 0xFC, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x3F, 0xF0, 0x03, 0xFE, 0xBF, 0xCF, 0xFC, 0x01,
-    0xFF, 0x2F, 0xF3, 0xFF, 0x00, 0xFF, 0x8B, 0xFC, 0xFF, 0xC0, 0x7F, 0xC3, 0xFF, 0x3F, 0xF0, 0x3F,
-    0xE0, 0xFF, 0xCF, 0xFC, 0x1F, 0xF0, 0x3F, 0xF3, 0xFF, 0x0F, 0xF8, 0x0F, 0xFC, 0xFF, 0xC7, 0xFC,
-    0x03, 0xFF, 0x3F, 0xF3, 0xFE, 0x00, 0xFF, 0xCF, 0xFD, 0xFF, 0x00, 0x3F, 0xF3, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFC, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xCF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xF3, 0xFF, 0xF8, 0x00, 0x0F, 0xFC, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x3F, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x55, 0x55, 0x54, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x01,
-    0xFF, 0xF7, 0xFE, 0x00, 0x3F, 0xFF, 0x7F, 0xE0, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0xFF, 0xFF, 0x7F,
-    0xE0, 0x1F, 0xFF, 0xF7, 0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x7F, 0xBF, 0xF7, 0xFD, 0x0F, 0xF3,
-    0xFF, 0x7F, 0xD2, 0xFD, 0x3F, 0xF7, 0xFD, 0x3F, 0xC3, 0xFF, 0x7F, 0xDB, 0xF4, 0x3F, 0xF7, 0xFD,
-    0xFF, 0x03, 0xFF, 0x7F, 0xFF, 0xD0, 0x3F, 0xF7, 0xFF, 0xF8, 0x03, 0xFF, 0x7F, 0xFF, 0x00, 0x3F,
-    0xF7, 0xFF, 0xE0, 0x03, 0xFF, 0x7F, 0xFC, 0x00, 0x3F, 0xF7, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x0B, 0xF8, 0x2F, 0xF0, 0x00, 0x03, 0xFE,
-    0x0B, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0xFD, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x3F, 0xF0, 0x00,
-    0x0B, 0xFF, 0xCF, 0xFC, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x3F, 0xF0, 0x00, 0xBF, 0xFF, 0xCF, 0xFC, 0x00, 0x3F, 0xFF, 0xF3, 0xFF, 0x00, 0x3F,
-    0xEB, 0xFC, 0xFF, 0xC0, 0x1F, 0xF2, 0xFF, 0x3F, 0xF0, 0x0F, 0xF8, 0xBF, 0xCF, 0xFC, 0x07, 0xFC,
-    0x3F, 0xF3, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0xFF, 0xC1, 0xFF, 0x03, 0xFF, 0x3F, 0xF0, 0xFF, 0x80,
-    0xFF, 0xCF, 0xFC, 0x7F, 0xC0, 0x3F, 0xF3, 0xFF, 0x3F, 0xE0, 0x0F, 0xFC, 0xFF, 0xDF, 0xF0, 0x03,
-    0xFF, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x3F, 0xF3, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFC, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF3, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x02,
-    0xFF, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xF7, 0xFE,
-    0x00, 0x3F, 0xFF, 0x7F, 0xE0, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0xFF, 0xFF, 0x7F, 0xE0, 0x1F, 0xFF,
-    0xF7, 0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x7F, 0xBF, 0xF7, 0xFD, 0x0F, 0xF3, 0xFF, 0x7F, 0xD2,
-    0xFD, 0x3F, 0xF7, 0xFD, 0x3F, 0xC3, 0xFF, 0x7F, 0xDB, 0xF4, 0x3F, 0xF7, 0xFD, 0xFF, 0x03, 0xFF,
-    0x7F, 0xFF, 0xD0, 0x3F, 0xF7, 0xFF, 0xF8, 0x03, 0xFF, 0x7F, 0xFF, 0x00, 0x3F, 0xF7, 0xFF, 0xE0,
-    0x03, 0xFF, 0x7F, 0xFC, 0x00, 0x3F, 0xF7, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFC,
-    0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xE0, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00,
-    0x7F, 0xC0, 0xFF, 0x40, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC, 0x00, 0xFF, 0xD0, 0xFF,
-    0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00,
-    0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA, 0xBF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0x00,
-    0x2F, 0xF8, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x1F, 0xFC,
-    0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01,
-    0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0xFF, 0xE0, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x07, 0xFE, 0x1F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xFE, 0xAA, 0xAF, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x02, 0xFF,
-    0x82, 0xFF, 0xC0, 0x1F, 0xFD, 0x03, 0xFF, 0xFB, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x1F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x7F,
-    0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x07,
-    0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x1F, 0xF0, 0x3F,
-    0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x40, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xE6, 0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0xFF,
-    0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xAA, 0xAB, 0xFF, 0x1F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x07, 0xFF, 0x40, 0xFF, 0xFE, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xBF, 0x81,
-    0xFF, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x07, 0xF4, 0x0F, 0xE0, 0x00, 0x01, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x01, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0x90, 0x1B,
-    0xFF, 0xC0, 0x10, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0x55, 0x55, 0x7F, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0x0E, 0x40, 0x02, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x3F, 0xD0, 0xFF,
-    0x80, 0x2F, 0xC0, 0x7F, 0x40, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40,
-    0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x2E, 0x56, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0x55, 0x5F, 0xFC, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x40, 0x00, 0xBF, 0xF0, 0xBF, 0xAB, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xC0, 0x03,
-    0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x07, 0xFD, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF8, 0x00,
-    0x00, 0x0F, 0xFD, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00,
-    0x2F, 0xF4, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x40, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0x2F, 0xF2, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x10, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x80,
-    0x00, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x10, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0xBF, 0xD3, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x07, 0xFD,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0F,
-    0xFD, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80,
-    0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0xFF, 0xC0,
-    0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00,
-    0x1F, 0xF8, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0xFF, 0xC0, 0x00,
-    0x0F, 0xF8, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00,
-    0x0F, 0xFB, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0xAA, 0x80, 0x00,
-    0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00,
-    0x03, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x2F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFE,
-    0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x01, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xBF,
-    0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xAA, 0x1A, 0xA0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x00, 0x3F,
-    0xD1, 0xFF, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0,
-    0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x7F,
-    0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x07, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x00, 0xBF, 0x02, 0xFC,
-    0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x3F, 0xFB, 0xFD, 0x00, 0x00, 0xFF, 0xEF, 0xF4, 0x00,
-    0x03, 0xFF, 0xBF, 0xD0, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x3F, 0xFB, 0xFD, 0x00, 0x00, 0xFF,
-    0xEF, 0xF4, 0x00, 0x03, 0xFF, 0xBF, 0xD0, 0x00, 0x0F, 0xFE, 0xFF, 0x80, 0x00, 0x3F, 0xF7, 0xFF,
-    0x40, 0x00, 0xFF, 0xCF, 0xFF, 0xA5, 0xBF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xAA, 0x43, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x02, 0xF4, 0x00, 0xBF, 0xC1, 0xFF, 0x00, 0x2F, 0xF0,
-    0x7F, 0xC0, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x1F, 0xFB,
-    0xFF, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x1F,
-    0xFB, 0xFF, 0xC0, 0x0B, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xEB, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xD5, 0x55, 0x54, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD5, 0x50, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFA, 0xAA, 0x87, 0xFE, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x07, 0xFF, 0xAA, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0xEA, 0x94, 0x00, 0x01,
-    0xFF, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFE, 0xFF, 0xEA, 0xBF, 0xFF, 0x01, 0xFF, 0xBF, 0xF0, 0x01, 0xFF, 0xD0, 0x7F,
-    0xEF, 0xFC, 0x00, 0x2F, 0xF8, 0x1F, 0xFB, 0xFF, 0x00, 0x07, 0xFF, 0x07, 0xFE, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC1, 0xFF, 0xBF, 0xF0, 0x00, 0xBF, 0xF0, 0x7F, 0xEF, 0xFC, 0x00, 0x3F, 0xF8, 0x1F, 0xFB,
-    0xFF, 0x01, 0xBF, 0xFD, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFB, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x1F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x40,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xF5, 0x54,
-    0x00, 0x03, 0xFF, 0x7F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x7F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x7F, 0xE5, 0x6F, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0x03, 0xFF, 0x03,
-    0xFF, 0x7F, 0xE0, 0x03, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0x03, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0x0B,
-    0xFF, 0x03, 0xFF, 0x7F, 0xFA, 0xFF, 0xFE, 0x03, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x7F, 0xFF, 0xFE, 0x40, 0x03, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0x55,
-    0x55, 0x50, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x17, 0xFF, 0x55, 0x50, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0xAF, 0xFE, 0xAA, 0x40, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0xA8, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF,
-    0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF4, 0x00,
-    0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF9, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF5, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x03, 0xFF,
-    0x80, 0x1F, 0xFD, 0x54, 0x0B, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0xFE,
-    0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xFE, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFD, 0x01, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x7F, 0xF2, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF3, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x7F, 0xF0,
-    0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0xA8, 0x0F, 0xFD, 0x00, 0xFF, 0xFF, 0x4F, 0xFE, 0x00, 0x1F, 0xFF,
-    0xDB, 0xFF, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x7F,
-    0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x40,
-    0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF5, 0xFF,
-    0xC0, 0x00, 0x02, 0xFF, 0xC2, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0,
-    0x07, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFE, 0x03, 0xFF,
-    0x80, 0x00, 0x2F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0xFF, 0xE0, 0x0B, 0xFE, 0x01, 0xFF, 0xC0, 0x03, 0xFF,
-    0x43, 0xFF, 0x40, 0x01, 0xFF, 0xCB, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0A, 0xBF, 0xFF, 0xFE, 0x90, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xCF, 0xFD, 0x00,
-    0x03, 0xFF, 0x87, 0xFF, 0x00, 0x0B, 0xFF, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0xFF, 0xD0, 0x3F,
-    0xF8, 0x00, 0x7F, 0xF0, 0xBF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC2,
-    0xFF, 0xFC, 0xB0, 0x3C, 0x28, 0x2C, 0x0A, 0x0C, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x0A, 0x00, 0x01, 0x40, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFF,
-    0xFE, 0x0E, 0x03, 0x80, 0xE0, 0xA0, 0x0C, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x05, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x3F, 0xFF, 0xE3, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7,
-    0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD,
-    0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F,
-    0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F,
-    0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07,
-    0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01,
-    0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00,
-    0x7F, 0x6A, 0x40, 0x0A, 0x80, 0x15, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA3, 0xFF, 0xFF, 0xFF, 0xCA,
-    0xAA, 0xAA, 0xA9, 0x02, 0xF8, 0x1F, 0xE0, 0xBF, 0x43, 0xFC, 0x1F, 0xF0, 0xFF, 0x83, 0xFE, 0x1F,
-    0xF4, 0x15, 0x40, 0x0F, 0xF8, 0x3F, 0xE1, 0xFF, 0x4B, 0xFC, 0x3F, 0xE0, 0xFF, 0x03, 0xFC, 0x1F,
-    0xD0, 0x15, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x2F, 0xE0, 0x2F,
-    0xC0, 0x3F, 0xC0, 0x15, 0x00, 0x7F, 0xC1, 0xFF, 0x43, 0xFE, 0x0B, 0xFC, 0x1F, 0xF0, 0x3F, 0xC0,
-    0xBF, 0x40, 0xFE, 0x01, 0x54, 0x02, 0xF8, 0x07, 0xF4, 0x1F, 0xE0, 0x2F, 0xC0, 0xBF, 0x40, 0xFF,
-    0x03, 0xFC, 0x0B, 0xF8, 0x1F, 0xF0, 0x3F, 0xD0, 0xFF, 0x80, 0xFF, 0x43, 0xFE, 0x0B, 0xFC, 0x1F,
-    0xF4, 0x3F, 0xF0, 0x15, 0x40, 0x55, 0x40, 0x0F, 0xF8, 0x1F, 0xF4, 0x3F, 0xE0, 0xBF, 0xC1, 0xFF,
-    0x43, 0xFF, 0x0B, 0xFC, 0x0F, 0xF8, 0x3F, 0xE0, 0x3F, 0xC0, 0xFF, 0x01, 0xFF, 0x03, 0xFC, 0x0B,
-    0xF4, 0x1F, 0xD0, 0x3F, 0xC0, 0x15, 0x00, 0x54, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0xBF, 0xC0, 0xFF,
-    0xC2, 0xFF, 0x03, 0xFD, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xC0, 0xBF, 0xC1, 0xFF, 0x02, 0xFD, 0x0B,
-    0xF4, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0x80, 0x55, 0x00, 0x54, 0x00, 0x7F, 0xC0, 0xBF, 0x81, 0xFF,
-    0x42, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0B, 0xFC, 0x0F, 0xF4, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xC0,
-    0x7F, 0xC0, 0xBF, 0x40, 0xFF, 0x00, 0xFE, 0x02, 0xFC, 0x01, 0x54, 0x01, 0x50, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xEB, 0xFA, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xEA, 0xFE, 0xAF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0x00, 0x02, 0x95, 0xFD, 0x5A, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x25, 0x4F, 0xD1, 0x64, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x10, 0x0F, 0xC0, 0x10, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x50, 0x00, 0xBF, 0xF0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFE, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xD1, 0xFF, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x3C, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x47, 0xFF, 0x2F, 0xFC, 0x7F, 0xF0, 0xFF, 0x80, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x43, 0xFF, 0x40, 0x3F, 0xF0, 0xFF, 0xE0,
-    0x1F, 0xFD, 0x3F, 0xF4, 0x07, 0xFF, 0x4B, 0xFC, 0x00, 0xBF, 0xC0, 0x14, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x07, 0xF8, 0x3F, 0xF4, 0x0B, 0xFF,
-    0x00, 0xFF, 0xD3, 0xFF, 0x80, 0xBF, 0xF0, 0x0F, 0xFE, 0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0xFF, 0xD2,
-    0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x01, 0x40, 0x00, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F,
-    0x83, 0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0xBF, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xCB, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x50,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x55, 0xD0, 0x00, 0xD0, 0x00,
-    0xD0, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40,
-    0xFF, 0xFF, 0x55, 0x5B, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0B, 0xFF, 0xFF, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xCB, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xFD, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC2, 0xFD, 0x06, 0xA0, 0x00, 0x01, 0xA4, 0x02, 0xFD, 0x0F, 0xF0, 0xFF, 0x0F, 0xFF, 0x80,
-    0x07, 0xFF, 0xD0, 0x3F, 0xDB, 0xF8, 0xBF, 0x4F, 0xFF, 0xF8, 0x07, 0xFF, 0xFD, 0x0B, 0xFF, 0xFC,
-    0x3F, 0x8B, 0xFE, 0xFF, 0x03, 0xFE, 0xFF, 0xC0, 0xFF, 0xFD, 0x3F, 0xC3, 0xFC, 0x1F, 0xE1, 0xFF,
-    0x0F, 0xF0, 0x06, 0xE8, 0x1F, 0xE0, 0xFF, 0x03, 0xFC, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x3F, 0x80, 0xFF, 0x2F, 0xD0, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x3F, 0xCB, 0xF4, 0x1F,
-    0xE0, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF2, 0xFD, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE,
-    0x03, 0xFC, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x1F, 0xE0, 0xBF, 0x40,
-    0x00, 0xBF, 0x40, 0x0B, 0xF4, 0xBF, 0x83, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF0, 0x00, 0x1F,
-    0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0,
-    0x7F, 0x41, 0xA9, 0x00, 0x00, 0x69, 0x00, 0x00, 0x1A, 0x40, 0x0B, 0xF4, 0x3F, 0xC3, 0xFC, 0x3F,
-    0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0B, 0xFF, 0xC0, 0x1F, 0xF7, 0xFE, 0x2F, 0xD3, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0, 0xFF, 0x1F, 0xFB, 0xFD, 0x0B, 0xFE, 0xFF,
-    0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x4B, 0xF4, 0xFF, 0x47, 0xFC, 0x3F, 0xC2, 0xFD, 0x1F, 0xE0,
-    0xFF, 0x00, 0x1B, 0xA0, 0x3F, 0x83, 0xFC, 0x0F, 0xF1, 0xFE, 0x07, 0xF8, 0xBF, 0x42, 0xFD, 0x00,
-    0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC7, 0xF8, 0x0F, 0xF3, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x1F,
-    0xE0, 0x3F, 0xC0, 0xBF, 0x5F, 0xE0, 0x3F, 0xCF, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-    0x03, 0xFC, 0x7F, 0x80, 0xFF, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x07, 0xF4, 0x03, 0xFC, 0x0F, 0xF1,
-    0xFE, 0x03, 0xFC, 0xBF, 0x42, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC3, 0xFC, 0x1F,
-    0xE2, 0xFD, 0x0B, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xE1, 0xFE, 0x0F, 0xF0, 0xFF, 0x43, 0xFC,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x01, 0xFF,
-    0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x3F, 0xE0, 0x7F, 0xC0, 0x1F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x1F,
-    0xE0, 0x07, 0xF8, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF4, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0x3E, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x42, 0xFE, 0x00, 0x3F, 0xE0,
-    0x7F, 0xC0, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0xBF, 0x80, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0,
-    0x07, 0xF8, 0x0F, 0xF0, 0x2F, 0xD0, 0x03, 0xFC, 0x07, 0xF4, 0x0F, 0xE0, 0x01, 0xFC, 0x03, 0xF8,
-    0x0B, 0xF0, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x3E, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0xD0, 0xBF, 0x80, 0x07, 0xFC, 0x0F, 0xF0, 0x00,
-    0xFF, 0x41, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x7F,
-    0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x3F, 0xD0,
-    0xBF, 0x80, 0xFF, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x2F, 0xE0, 0x00, 0xFF, 0x41, 0xFE, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x7F, 0x80, 0x01, 0xFD, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x3F, 0xC0,
-    0x7F, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0xFC, 0x03, 0xF8,
-    0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF8,
-    0x00, 0x03, 0xFF, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0xFC, 0xBC, 0x00, 0x7D, 0x0F, 0x80, 0x2F, 0x02,
-    0xF0, 0x0F, 0x80, 0x3E, 0x0B, 0xC0, 0x0B, 0xC3, 0xE0, 0x00, 0xF8, 0x00, 0x08, 0x00, 0x02, 0xF8,
-    0x00, 0xBF, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xD0, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x7F,
-    0xF0, 0x02, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x1F,
-    0x40, 0x00, 0x40, 0x02, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x80, 0x0F, 0xFD, 0x00,
-    0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x2F, 0xF8, 0x07, 0xFF, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF4, 0x07, 0xFD, 0x00, 0x0B, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x2F, 0xC0, 0x00, 0x40, 0x07, 0xC0, 0x03, 0xFE, 0x00, 0x2E, 0x01, 0xFF,
-    0x00, 0x7F, 0xE0, 0x0B, 0xF8, 0x0F, 0xFC, 0x03, 0xFD, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x1F, 0x80,
-    0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xEF,
-    0xF4, 0x00, 0x02, 0xFC, 0x03, 0xFF, 0xFD, 0x03, 0xFC, 0x3F, 0xE0, 0x0F, 0xFF, 0x40, 0x7F, 0xE7,
-    0xFF, 0x00, 0xBF, 0xF0, 0x07, 0xFE, 0x3F, 0xE0, 0x2F, 0xFF, 0xC0, 0x3F, 0xD0, 0xA4, 0x0B, 0xFF,
-    0xFF, 0x01, 0xA4, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40,
-    0x50, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xC0, 0x3F, 0xF0, 0x1F, 0xF4, 0x07, 0xFE, 0x00, 0xFF,
-    0x80, 0xBD, 0x00, 0x7F, 0xE0, 0x03, 0xF0, 0x02, 0x40, 0x03, 0xFD, 0x00, 0x0C, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x07, 0xFF, 0x0F, 0xFD, 0x02, 0xFF, 0xC3, 0xFF, 0x40, 0xBF,
-    0xF0, 0xFF, 0xD0, 0x1F, 0xFC, 0x3F, 0xF4, 0x07, 0xFF, 0x0F, 0xFD, 0x01, 0xFF, 0xC3, 0xFF, 0x00,
-    0x7F, 0xE0, 0xFF, 0xC0, 0x1F, 0xF8, 0x2F, 0xF0, 0x03, 0xFE, 0x0B, 0xFC, 0x00, 0xFF, 0x82, 0xFF,
-    0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0x41,
-    0xFF, 0x00, 0x3F, 0xD0, 0x7F, 0x80, 0x0F, 0xF0, 0x05, 0x40, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x3F, 0xF4, 0x0B, 0xFF, 0x0F, 0xFE, 0x02,
-    0xFF, 0xC3, 0xFF, 0x40, 0xBF, 0xF0, 0xBF, 0xC0, 0x0F, 0xF4, 0x01, 0x40, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0xFF, 0x07, 0xFC, 0x00,
-    0xFF, 0x0B, 0xFC, 0x00, 0xFF, 0x1F, 0xF4, 0x00, 0xFF, 0xBF, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF2, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x0D, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xD0, 0x00,
-    0x03, 0xF0, 0x01, 0xFE, 0x41, 0x7F, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x7C, 0x3C,
-    0x00, 0x00, 0x00, 0x2D, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0x7D,
-    0x00, 0x02, 0xF1, 0xF0, 0x00, 0x3D, 0x0F, 0x40, 0x0B, 0xC0, 0xBC, 0x00, 0xF8, 0x03, 0xD0, 0x2F,
-    0x00, 0x2F, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x0F, 0xC0, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF7, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xF9, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xEF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF3, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0x80, 0x1E, 0x01, 0xD0, 0x0A, 0xA0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x7E,
-    0x47, 0xE0, 0x6F, 0x00, 0x3E, 0x43, 0xF4, 0x6F, 0x6F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x07, 0xFB, 0xFC, 0x00,
-    0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x03, 0xFE,
-    0x0F, 0xF8, 0x01, 0xFE, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x07, 0x00, 0xA0, 0x00,
-    0x00, 0x01, 0x80, 0x34, 0x00, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x2F, 0xFF, 0xCB, 0xFF, 0xF2, 0xFF, 0xA8, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00,
-    0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xCB, 0xFF, 0xF2,
-    0xFF, 0xFC, 0xBF, 0xD5, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B,
-    0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xFF, 0xF2, 0xFF, 0xFC, 0xBF, 0xFF, 0x05,
-    0x55, 0x40, 0x3F, 0xFF, 0x8F, 0xFF, 0xE3, 0xFF, 0xF8, 0xAB, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0,
-    0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x8F,
-    0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 0xFE, 0x15, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00,
-    0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE3, 0xFF, 0xF8, 0xFF,
-    0xFE, 0x3F, 0xFF, 0x85, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x1B, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0xBD, 0x00, 0x7F,
-    0xF0, 0xF9, 0x00, 0xBF, 0xF0, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xFD, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFD, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x2F, 0x40,
-    0x1F, 0xFC, 0x0F, 0xFC, 0x04, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF0,
-    0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F,
-    0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF8,
-    0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFD,
-    0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x01, 0xBF, 0xFE, 0x40, 0x3F, 0xF4, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xF4, 0x2F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF4, 0x0F, 0x90, 0x0F, 0xFE,
-    0x3F, 0xF4, 0x04, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00,
-    0x07, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x2F, 0xF0,
-    0x00, 0x02, 0xFF, 0xE0, 0x2F, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x0F, 0xFD, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x2F,
-    0xC0, 0x00, 0x05, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x00,
-    0x3F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x3F,
-    0xE0, 0x00, 0x01, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x56, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xEA, 0xFF, 0xFF, 0xF4, 0x7C, 0x0F, 0xFF, 0xFF, 0xC7,
-    0xC0, 0xFF, 0xFF, 0xFD, 0x7C, 0x0F, 0xFF, 0xFF, 0xE7, 0xC0, 0xFF, 0xFF, 0xFE, 0x7C, 0x0F, 0xFF,
-    0xFF, 0xE7, 0xC0, 0xFF, 0xFF, 0xFE, 0x7C, 0x0F, 0xFF, 0xFF, 0xE7, 0xC0, 0xFF, 0xFF, 0xFE, 0x7C,
-    0x0F, 0xFF, 0xFF, 0xD7, 0xC0, 0xFF, 0xFF, 0xFC, 0x7C, 0x0F, 0xFF, 0xFF, 0x87, 0xC0, 0xFF, 0xFF,
-    0xE0, 0x7C, 0x0F, 0xFF, 0xF4, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x07, 0xC0,
-    0xF8, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00,
-    0x07, 0xC0, 0xF8, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x7C, 0x0F,
-    0x80, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x82, 0xF3, 0xFF, 0xFF, 0xF8, 0x2F,
-    0x3F, 0xFF, 0xFF, 0x82, 0xF3, 0xFF, 0xFF, 0xF8, 0x2F, 0x3F, 0xFF, 0xFF, 0x82, 0xF3, 0xFF, 0xFF,
-    0xF8, 0x2F, 0x3F, 0xFF, 0xFF, 0x82, 0xF3, 0xFF, 0xFF, 0xF8, 0x2F, 0x3F, 0xFF, 0xFF, 0x82, 0xF2,
-    0xFF, 0xFF, 0xF8, 0x2F, 0x0F, 0xFF, 0xFF, 0xEB, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x6A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3E, 0x0F, 0xFF, 0xFF, 0xD0, 0xF8, 0x3F,
-    0xFF, 0xFF, 0x83, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x83, 0xFF, 0xFF, 0xFC, 0x3E, 0x0F, 0xFF, 0xFF,
-    0xF0, 0xF8, 0x3F, 0xFF, 0xFF, 0xC3, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x83, 0xFF, 0xFF, 0xFC, 0x3E,
-    0x0F, 0xFF, 0xFF, 0xE0, 0xF8, 0x3F, 0xFF, 0xFF, 0x43, 0xFA, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xAA, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x01, 0xD0, 0x2F, 0x80, 0x68, 0x2F, 0xFA, 0xFA, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x15, 0xFF, 0xF5, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x02, 0xFE, 0x07, 0xF8, 0x00,
-    0x02, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x2F, 0xF0, 0x3F, 0xF8, 0x3F,
-    0xF8, 0x3F, 0xF4, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B,
-    0xF8, 0x07, 0xFC, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x54, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x0F, 0x80, 0x00,
-    0x01, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x2D, 0x10, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0D, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x1F,
-    0x00, 0x00, 0x00, 0xB8, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x01, 0xFE, 0x41, 0x7F, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xD0,
-    0x2F, 0x80, 0x68, 0x2F, 0xFA, 0xFA, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x15, 0xFF, 0xF5, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0x5F, 0xF0, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x02, 0xFE, 0x07, 0xF8, 0x00, 0x02, 0xC0, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1D, 0x02, 0xF8, 0x06, 0x82,
-    0xFF, 0xAF, 0xAF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0x5F, 0xFF,
-    0x54, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x02,
-    0xFF, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x7F, 0x80, 0x00, 0x2C, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFE, 0xBF, 0xE0, 0x2F, 0xDF, 0xFE, 0x03, 0xFC, 0xBF,
-    0xE0, 0x7F, 0x83, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x2F, 0xC1, 0xFE, 0x07, 0xFF, 0x3F, 0xC0,
-    0xBF, 0xF7, 0xF8, 0x0B, 0xFF, 0xBF, 0x40, 0x3F, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF9, 0x40, 0x00, 0x00, 0xBC, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x90, 0x07, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0x40, 0x01, 0xAF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x0B, 0x80, 0x00, 0x02, 0xF0, 0x1E, 0x00, 0x00,
-    0x00, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x2D, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x70, 0x3F, 0x0B, 0x00, 0x7F, 0x0F, 0xCB, 0xF0, 0x0F, 0xF7, 0xFB,
-    0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFB, 0xFF, 0xF0, 0x07, 0xF8, 0xFC, 0xFF, 0x00, 0xB8, 0x3F, 0x0F, 0x40, 0x04, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFE, 0x0F, 0xF8,
-    0x3F, 0xE0, 0xFF, 0x80, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x00, 0xFF, 0x03, 0xFC, 0x0F,
-    0xF4, 0x3F, 0xD0, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFE, 0x00, 0x3F, 0xC0, 0xFF, 0x03, 0xFC,
-    0x0F, 0xF0, 0x01, 0xFC, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x40, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03,
-    0xF8, 0x00, 0x3E, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x02,
-    0xA4, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2A, 0x40, 0x00, 0x00,
-    0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x4F,
-    0xFE, 0x3F, 0xF4, 0x7F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xFF,
-    0xD3, 0xFF, 0x8F, 0xFD, 0x1F, 0xF0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x02, 0x90, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x0F, 0xFE, 0x00, 0x01,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x0B, 0xD0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x2F, 0xC0, 0x1F, 0x80, 0x01,
-    0xFF, 0x80, 0xBF, 0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0x02, 0xFC, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x0B,
-    0xF0, 0x1F, 0xFC, 0x00, 0x7F, 0xD0, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x29, 0x00, 0xBF, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2F, 0xC0, 0x05, 0x40, 0x01, 0xFF, 0x40, 0xBF, 0x00,
-    0xFF, 0x80, 0x0B, 0xFF, 0x02, 0xFC, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x0B, 0xF0, 0x1F, 0xFC, 0x00,
-    0xBF, 0xE0, 0x2F, 0xC0, 0x7F, 0xF0, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xF8, 0xFF, 0xE3, 0xFF, 0x87, 0xFC, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x43, 0xFF, 0x4F, 0xFE, 0x3F, 0xF8, 0xBF, 0xD0,
-    0x68, 0x00, 0x05, 0x40, 0xBF, 0xC3, 0xFF, 0x8F, 0xFE, 0x2F, 0xF0, 0x2A, 0x40, 0x00, 0x02, 0xE4,
-    0x3F, 0xF4, 0xFF, 0xE3, 0xFF, 0x8B, 0xFC, 0x01, 0x40, 0x00, 0x01, 0xFE, 0x0F, 0xFD, 0x3F, 0xF8,
-    0xFF, 0xD1, 0xFE, 0x00, 0x00, 0x01, 0x40, 0xBF, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F, 0xF4, 0x2E, 0x40,
-    0xFF, 0xFF, 0x57, 0xD5, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x5B, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xE0, 0x0B, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40,
-    0xBF, 0xFE, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0,
-    0x0F, 0xF0, 0x1F, 0xF4, 0x3F, 0xFC, 0xBF, 0xFE, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x01, 0x40, 0x02, 0x80, 0x0B, 0xE0, 0x2C, 0x38, 0xB0, 0x0E, 0x3C, 0x3C, 0x0F, 0xF0, 0x03, 0xC0,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0x80, 0x57, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x01, 0x40, 0x00, 0x15, 0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x2F, 0xFF, 0xFC, 0x3F, 0xD3,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x7F, 0xC0, 0xFF, 0x7F, 0xC0, 0xFF, 0x7F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF,
-    0x3F, 0xC1, 0xFF, 0x3F, 0xD3, 0xFE, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x00,
-    0x15, 0x00, 0x2D, 0x2F, 0xC7, 0xF0, 0x00, 0x29, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1,
-    0xFC, 0x7F, 0x1F, 0xC7, 0xF0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x40,
-    0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xF4, 0x00, 0xBD, 0xFD, 0x00, 0x7E, 0x7F, 0x40, 0x3F, 0x1F, 0xD0,
-    0x2F, 0x07, 0xF4, 0x1F, 0xD6, 0xFE, 0x4B, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x6A, 0xAB, 0xFA,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFE, 0x0F, 0xEA, 0xA4, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xFF, 0xF4, 0x1F, 0xFF, 0xF8,
-    0x19, 0x6F, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x90, 0x01, 0xFE, 0xB9, 0x6F, 0xF2, 0xFF, 0xFF,
-    0x87, 0xFF, 0xF4, 0x00, 0x54, 0x00, 0x00, 0x01, 0x54, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xFC, 0x0F,
-    0xFE, 0x54, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x9F, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0xE6,
-    0xFE, 0x3F, 0x40, 0xFF, 0x3F, 0x40, 0xFF, 0x3F, 0x80, 0xFF, 0x2F, 0xE6, 0xFE, 0x0F, 0xFF, 0xFC,
-    0x02, 0xFF, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x2F,
-    0xD2, 0xFD, 0x2F, 0x80, 0xFD, 0x2F, 0xC1, 0xFC, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xF8, 0x3F, 0xD7, 0xFE, 0x3F, 0x40, 0xFF, 0x3F, 0x40, 0xBF, 0x3F, 0xD1, 0xFE, 0x2F, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xF0, 0x00, 0x55, 0x00, 0x00, 0x55, 0x00, 0x07, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8, 0x3F,
-    0xE7, 0xFC, 0x3F, 0x80, 0xFE, 0x7F, 0x40, 0xBF, 0x3F, 0x80, 0xFF, 0x3F, 0xD6, 0xFF, 0x2F, 0xFF,
-    0xFF, 0x07, 0xFC, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x09, 0x6F, 0xF8, 0x0F, 0xFF, 0xF0,
-    0x0F, 0xFF, 0x80, 0x05, 0x54, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x55,
-    0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC2,
-    0xF4, 0x3F, 0x07, 0xE0, 0xBD, 0x0B, 0xD0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFD, 0x0B, 0xD0,
-    0x7E, 0x03, 0xF0, 0x2F, 0x40, 0xFC, 0x0B, 0xD0, 0x15, 0x00, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F,
-    0xC0, 0xBD, 0x07, 0xE0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x7E, 0x0B, 0xD0,
-    0xFC, 0x0F, 0xC2, 0xF4, 0x7E, 0x05, 0x40, 0x28, 0x1A, 0x90, 0x7D, 0xFF, 0xF8, 0x7F, 0xFB, 0xFC,
-    0x7F, 0x80, 0xFD, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F,
-    0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x15, 0x00, 0x54, 0x00, 0x15, 0x00, 0x03, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xF8, 0x2F, 0xFF, 0xFC, 0x3F, 0xD3, 0xFE, 0x3F, 0xC1, 0xFE, 0x7F, 0xC0, 0xFF,
-    0x7F, 0xC0, 0xFF, 0x7F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC1, 0xFF, 0x3F, 0xD3, 0xFE, 0x1F,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x3F, 0xF0, 0x7F, 0xFC, 0xBF, 0xFF, 0x1F, 0xEF, 0xC2, 0x87, 0xF0, 0x01, 0xFC, 0x00, 0xBF, 0x00,
-    0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x0B, 0xFF, 0xE0, 0x3F, 0xFF, 0xF4, 0x2F, 0xEF, 0xFC, 0x0A, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00,
-    0x0F, 0xF4, 0x00, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x0B, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1F, 0x9B, 0xFC, 0x04, 0x01, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0x5B, 0xF4, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x00, 0x06, 0xFD, 0x00, 0x00, 0xFE,
-    0x10, 0x00, 0xFE, 0x3F, 0xAB, 0xFD, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xF4, 0x00,
-    0xBD, 0xFD, 0x00, 0x7E, 0x7F, 0x40, 0x3F, 0x1F, 0xD0, 0x2F, 0x07, 0xF4, 0x1F, 0xD6, 0xFE, 0x4B,
-    0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x6A, 0xAB, 0xFA, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xEA, 0xA4, 0x3F, 0x00,
-    0x00, 0xF8, 0x00, 0x07, 0xFF, 0xF4, 0x1F, 0xFF, 0xF8, 0x19, 0x6F, 0xF4, 0x00, 0x1F, 0xE0, 0x00,
-    0x3F, 0x90, 0x01, 0xFE, 0xB9, 0x6F, 0xF2, 0xFF, 0xFF, 0x87, 0xFF, 0xF4, 0x00, 0x54, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xFC, 0x0F, 0xFE, 0x54, 0x1F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0x9F, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0xE6, 0xFE, 0x3F, 0x40, 0xFF, 0x3F, 0x40, 0xFF,
-    0x3F, 0x80, 0xFF, 0x2F, 0xE6, 0xFE, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x02,
-    0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x2F, 0xD2, 0xFD, 0x2F, 0x80, 0xFD, 0x2F, 0xC1,
-    0xFC, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x3F, 0xD7, 0xFE, 0x3F, 0x40, 0xFF,
-    0x3F, 0x40, 0xBF, 0x3F, 0xD1, 0xFE, 0x2F, 0xFF, 0xFC, 0x0B, 0xFF, 0xF0, 0x00, 0x55, 0x00, 0x00,
-    0x55, 0x00, 0x07, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8, 0x3F, 0xE7, 0xFC, 0x3F, 0x80, 0xFE, 0x7F, 0x40,
-    0xBF, 0x3F, 0x80, 0xFF, 0x3F, 0xD6, 0xFF, 0x2F, 0xFF, 0xFF, 0x07, 0xFC, 0xFE, 0x00, 0x00, 0xFD,
-    0x00, 0x03, 0xFC, 0x09, 0x6F, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0x05, 0x54, 0x00, 0x01,
-    0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF4,
-    0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC2, 0xF4, 0x3F, 0x07, 0xE0, 0xBD, 0x0B, 0xD0,
-    0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFD, 0x0B, 0xD0, 0x7E, 0x03, 0xF0, 0x2F, 0x40, 0xFC, 0x0B,
-    0xD0, 0x15, 0x00, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0xBD, 0x07, 0xE0, 0x3F, 0x03, 0xF0,
-    0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x7E, 0x0B, 0xD0, 0xFC, 0x0F, 0xC2, 0xF4, 0x7E, 0x05, 0x40,
-    0x01, 0xBF, 0xD0, 0x0B, 0xFF, 0xF8, 0x03, 0x96, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x5A, 0xFD, 0x0F,
-    0xFF, 0xFD, 0x3F, 0xD0, 0xFD, 0x3F, 0x40, 0xFD, 0x3F, 0x41, 0xFD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFE,
-    0x3D, 0x01, 0x50, 0x00, 0x02, 0xFE, 0x40, 0x7F, 0xFF, 0x83, 0xF9, 0x7F, 0x6F, 0x80, 0x7E, 0xFE,
-    0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0x7F, 0x80, 0x00, 0x7F, 0x40, 0x10, 0xFF, 0xFF, 0xD0,
-    0xBF, 0xFF, 0x00, 0x15, 0x40, 0x02, 0xFE, 0x40, 0x1F, 0xFF, 0xF0, 0x3F, 0x97, 0xF8, 0xBF, 0x01,
-    0xFC, 0xFD, 0x00, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0x00, 0xFD, 0xBE, 0x00, 0xFD, 0x7F, 0x42, 0xFC,
-    0x2F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x54, 0x00, 0x6A, 0x00, 0xAA, 0x0F, 0xF0, 0x7F, 0x40,
-    0xFD, 0x3F, 0x80, 0x1F, 0xEF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xFC, 0x00,
-    0x0F, 0xFF, 0x80, 0x0F, 0xE3, 0xF4, 0x0B, 0xF0, 0x7F, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x1E, 0x57, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x3F,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0x00, 0xBE, 0x2F, 0x80, 0xFD, 0x0F, 0xFF, 0xF8, 0x03, 0xFF,
-    0xE0, 0x00, 0x15, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x2F, 0xD0, 0x7F, 0xFF, 0xFC, 0x7F, 0xE7, 0xFD, 0x7F, 0x40, 0xFD, 0x7F, 0x00, 0xFE, 0x7F,
-    0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0xAA, 0x1F, 0xC0, 0xBF, 0x07, 0xF0, 0xBF, 0x01, 0xFC, 0xBF, 0x00, 0x7F, 0xBF,
-    0x00, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x01, 0xFD, 0x3F, 0x40, 0x7F, 0x07, 0xF4, 0x1F, 0xC0,
-    0xBF, 0x07, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x68, 0x2F, 0xD0, 0xBF, 0x81, 0xFB, 0xFF, 0xEF,
-    0xFF, 0xC7, 0xFE, 0xBF, 0xF9, 0xBF, 0x5F, 0xD0, 0x7F, 0x80, 0xFE, 0x7F, 0x00, 0xFD, 0x02, 0xF9,
-    0xFC, 0x03, 0xF0, 0x0B, 0xE7, 0xF0, 0x0F, 0xC0, 0x2F, 0x9F, 0xC0, 0x3F, 0x00, 0xBE, 0x7F, 0x00,
-    0xFC, 0x02, 0xF9, 0xFC, 0x03, 0xF0, 0x0B, 0xE7, 0xF0, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x2F, 0xE0, 0x7E, 0xFF, 0xFC, 0x7F, 0xE7, 0xFD, 0x7F, 0x40, 0xFD, 0x7F, 0x00, 0xBE,
-    0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x69, 0x2F, 0xD0, 0x7E, 0xFF, 0xF4, 0x7F, 0xEB, 0xFC, 0x7F, 0x40,
-    0xFD, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xFE, 0x7F, 0x82, 0xFC,
-    0x7F, 0xFF, 0xF8, 0x7F, 0xBF, 0xE0, 0x7F, 0x05, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x06, 0xFF, 0x81, 0xFF, 0xFE, 0x3F, 0x96, 0xC3, 0xF4, 0x00, 0x2F,
-    0xF8, 0x00, 0xBF, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0x20, 0x07, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF,
-    0x80, 0x15, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x7F, 0xE9, 0x7F, 0xFF, 0x9B, 0xFA,
-    0x90, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x0B, 0xFF,
-    0x80, 0xFF, 0xE0, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x05,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x2A, 0xAA, 0xA1,
-    0xFF, 0x41, 0xFF, 0xFF, 0xD7, 0xFD, 0x07, 0xFF, 0xFF, 0x4F, 0xF4, 0x1F, 0xFF, 0xFD, 0x3F, 0xE0,
-    0x7F, 0xC0, 0x00, 0xFF, 0xC1, 0xFF, 0x00, 0x01, 0xFF, 0xEB, 0xFD, 0x55, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFD, 0x55, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x01,
-    0x40, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0x0B, 0xF8, 0x2F, 0xFD, 0xBC, 0x3E, 0x00, 0xFF, 0xD3, 0xE0, 0xF4, 0x07, 0xFF, 0x0F, 0x43, 0xC0,
-    0x2F, 0xF4, 0x3C, 0x1F, 0x00, 0xFF, 0xD1, 0xF0, 0xBC, 0x03, 0xFF, 0x0B, 0xC3, 0xE0, 0x0F, 0xFC,
-    0x3E, 0x0F, 0x40, 0x3F, 0xF0, 0xF4, 0x3C, 0x00, 0xBF, 0xD3, 0xC1, 0xF0, 0x02, 0xFF, 0x9F, 0x0B,
-    0xC0, 0x07, 0xFF, 0xBC, 0x3E, 0x00, 0x0F, 0xFF, 0xE0, 0xF4, 0x00, 0x1F, 0xFF, 0x83, 0xC1, 0x90,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0xF4, 0x7D, 0x00, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x00, 0x1F, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xF8, 0x01, 0xB0, 0x1F, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x29, 0x0A, 0x8B, 0xFD, 0x07, 0xF3, 0xFC, 0xFF, 0xC0, 0x7F, 0xBF, 0xCF, 0xFC, 0x07, 0xFF, 0xFC,
-    0xFF, 0xD0, 0x7F, 0xF9, 0x4B, 0xFD, 0x07, 0xFE, 0x00, 0xBF, 0xE0, 0x7F, 0xC0, 0x07, 0xFF, 0x07,
-    0xFC, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x03, 0xFF, 0xC7, 0xFC, 0x00, 0x1F, 0xFE, 0xBF, 0xC1, 0x40,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xFE, 0x00, 0x00, 0x01, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x55, 0x55, 0x40, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x06, 0xBF, 0xFA, 0xA8, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFC, 0x01, 0x90, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x05, 0x7F, 0xF9, 0x55, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x57, 0xFF, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x6B, 0xFF, 0xEA, 0xA0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x40, 0xBF, 0x69, 0x00, 0x2F, 0xE1, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x0B, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xAF,
-    0xFF, 0xFE, 0x6F, 0xFF, 0x2F, 0xFE, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xCB, 0xFF, 0x00, 0x1F, 0xFD,
-    0x00, 0x3F, 0xF2, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x03,
-    0xFF, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF2,
-    0xFF, 0x40, 0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x2F, 0xF4,
-    0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF2, 0xFF, 0x40, 0xBF,
-    0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0x2F, 0xF4, 0x2F, 0xFF, 0xF0,
-    0x00, 0xFF, 0xCB, 0xFD, 0x0F, 0xEF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0x80, 0x2F, 0xFC, 0x00, 0xFF,
-    0x00, 0xBF, 0xF0, 0x03, 0xFC, 0x02, 0xFF, 0xE0, 0x0F, 0xF0, 0x0B, 0xFF, 0xC0, 0x3F, 0xC0, 0x2F,
-    0xBF, 0x00, 0xFF, 0x00, 0xBE, 0xBD, 0x03, 0xFC, 0x02, 0xFD, 0xFC, 0x0F, 0xF0, 0x6F, 0xFB, 0xFA,
-    0xBF, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0xFC, 0x7F, 0x0F, 0xF0,
-    0x0B, 0xF0, 0xFD, 0x3F, 0xC1, 0xBF, 0xEB, 0xFE, 0xFF, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x0B, 0xF0, 0x2F, 0x6F, 0xC0, 0x2F, 0xC0, 0x7E, 0xBF, 0x00, 0xBF, 0x00, 0xFE,
-    0xFC, 0x02, 0xFC, 0x03, 0xFF, 0xF0, 0x0B, 0xF0, 0x0B, 0xFF, 0xC0, 0x2F, 0xC0, 0x0F, 0xFF, 0x00,
-    0xBF, 0x00, 0x3F, 0xFC, 0x02, 0xFC, 0x00, 0xBF, 0xF0, 0x7F, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE5, 0xBF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xF4, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0xBF, 0xD0, 0x2A, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x80, 0xFC, 0x00, 0x7F,
-    0xD0, 0x07, 0xFD, 0x0B, 0xF0, 0x01, 0xFF, 0x40, 0x2F, 0xF4, 0x3F, 0xC0, 0x07, 0xFD, 0x01, 0xFF,
-    0xC2, 0xFF, 0xFF, 0x1F, 0xFA, 0xBF, 0xFE, 0x7F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xF5, 0xFF, 0xFF, 0xFF, 0x4A, 0xFF, 0xEA, 0x87, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x1F, 0xFA,
-    0x94, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xFD, 0x65, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xD7, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x7F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD5,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x00, 0x69, 0x40, 0xBF, 0xC0, 0x2F, 0xF4,
-    0x0F, 0xFF, 0xF8, 0xBF, 0xC0, 0x1F, 0xF4, 0x3F, 0xFF, 0xFC, 0xBF, 0xC0, 0x2F, 0xF0, 0xBF, 0xFF,
-    0xF8, 0xBF, 0xC0, 0x3F, 0xF0, 0xFF, 0xC1, 0xB4, 0xBF, 0xD1, 0xFF, 0xE0, 0xFF, 0x40, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xE0, 0xBF, 0xC3, 0xFF, 0x00, 0x03,
-    0xFF, 0xF8, 0xBF, 0xC2, 0xFF, 0x40, 0x00, 0x7F, 0xFC, 0xBF, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFD,
-    0xBF, 0xC0, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0xBF, 0xC0, 0x7F, 0xE0, 0x40, 0x03, 0xFD, 0xBF, 0xC0,
-    0x3F, 0xF0, 0xF9, 0x1B, 0xFC, 0xBF, 0xC0, 0x2F, 0xF8, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x0F, 0xFC,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xC0, 0x0B, 0xFE, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x3F, 0x80, 0x0F, 0xF4, 0x00, 0xFE, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0x83, 0xFC, 0x01,
-    0xFF, 0xC0, 0x1F, 0xE0, 0xFF, 0x00, 0x7F, 0xF0, 0x07, 0xF4, 0x2F, 0xC0, 0x2F, 0xFC, 0x02, 0xFC,
-    0x0B, 0xF4, 0x0B, 0xEF, 0x40, 0xFF, 0x01, 0xFD, 0x03, 0xF7, 0xD0, 0x3F, 0xC0, 0x3F, 0x80, 0xFD,
-    0xF8, 0x0F, 0xE0, 0x0F, 0xE0, 0x3E, 0x3F, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0x8F, 0xC1, 0xFD, 0x00,
-    0xFF, 0x0B, 0xE3, 0xF4, 0xBF, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x45, 0xFE, 0x7F, 0x5B, 0xF7, 0xFD, 0x40, 0x3F, 0x4F, 0xC1, 0xFC, 0xFE, 0x00, 0x0F,
-    0xE7, 0xF0, 0x3F, 0x3F, 0x40, 0x02, 0xFA, 0xF8, 0x0F, 0xDF, 0xD0, 0x00, 0xBF, 0xBD, 0x03, 0xFB,
-    0xF0, 0x00, 0x1F, 0xFF, 0x40, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x2F, 0xFE, 0x00, 0x00, 0xFF,
-    0xF0, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x1F, 0xE3, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
-    0xFF, 0x3F, 0xC0, 0x00, 0x7F, 0xF0, 0x2F, 0xF3, 0xFC, 0x00, 0x01, 0xFF, 0x42, 0xFF, 0x3F, 0xC0,
-    0xAA, 0x0F, 0xF8, 0x2F, 0xF3, 0xFC, 0x1F, 0xF0, 0xBF, 0xC2, 0xFF, 0x3F, 0xC1, 0xFF, 0x07, 0xFC,
-    0x2F, 0xF3, 0xFC, 0x1F, 0xF0, 0x7F, 0xC2, 0xFF, 0x3F, 0xC1, 0xFF, 0x07, 0xFC, 0x2F, 0xF3, 0xFC,
-    0x1F, 0xF0, 0x7F, 0xC2, 0xFF, 0x3F, 0xC1, 0xFF, 0x07, 0xFC, 0x2F, 0xF3, 0xFC, 0x1F, 0xF0, 0x7F,
-    0xC2, 0xFF, 0x3F, 0xC1, 0xFF, 0x07, 0xFC, 0x2F, 0xF3, 0xFC, 0x1F, 0xF0, 0x7F, 0xC2, 0xFF, 0x3F,
-    0xC1, 0xFF, 0x07, 0xFC, 0x2F, 0xE3, 0xFC, 0x1F, 0xF0, 0x7F, 0xC3, 0xFE, 0x3F, 0xC1, 0xFF, 0x00,
-    0x00, 0x7F, 0xD3, 0xFC, 0x1F, 0xF0, 0x00, 0x0F, 0xFC, 0x3F, 0xC1, 0xFF, 0xAA, 0xAF, 0xFF, 0x83,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x06, 0xAB, 0xFF, 0xE8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1A, 0xAB, 0xFF, 0xA0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x05, 0x50,
-    0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0x1F, 0xF8, 0x00, 0x7F, 0xFF, 0xF7, 0xFE, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x2F, 0xFF, 0xAB, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x80, 0x0B,
-    0xFE, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x1F, 0xFC, 0x00, 0x0F,
-    0xF8, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0xBF,
-    0xE0, 0x0F, 0xFF, 0x40, 0x7F, 0xF8, 0x02, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFE, 0x3F, 0xE0, 0x00, 0x2F, 0xFD, 0x0B, 0xF8, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xE4,
-    0x07, 0x40, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x5F,
-    0xFE, 0x55, 0x50, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x05, 0xFF, 0xD5, 0x55,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0A, 0xFF, 0xEA, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x18, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x0B, 0xFD, 0x00, 0x1F,
-    0xF8, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0xFF, 0xC0,
-    0x0B, 0xFD, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x03, 0xFE, 0x00, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x0B,
-    0xFD, 0x1F, 0xF4, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x1F, 0xFE,
-    0xFF, 0xD5, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0x7F, 0xE0, 0x00, 0x0B, 0xFD, 0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x0F, 0xFC,
-    0x00, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x02, 0xFF, 0x80,
-    0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0xBF, 0xE0, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x0B,
-    0xFD, 0x00, 0x2F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x57, 0xFF, 0x55, 0x50, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF1, 0xE0, 0x00, 0x00, 0xFF, 0xEF, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0x1E, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x7F, 0xFF, 0xC0, 0x00, 0x20, 0xFF, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xC0, 0x00, 0x02, 0xF7, 0xFF, 0x00, 0x00, 0x02, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0x90, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x05, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x2F,
-    0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x3F, 0xFF, 0xF8, 0x07, 0xFD, 0x00, 0x1F, 0xFC, 0x3F,
-    0xFB, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xFE, 0x1F, 0xF0, 0x2F, 0xD0, 0xFF, 0xC0, 0x0B, 0xFF, 0x0F,
-    0xF4, 0x03, 0xF8, 0x3F, 0xF0, 0x0B, 0xFF, 0x43, 0xFC, 0x00, 0xFE, 0x0F, 0xF8, 0x2F, 0xFF, 0x81,
-    0xFF, 0x00, 0x7F, 0x47, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xC0, 0x3F, 0xC2, 0xFF, 0xFF, 0xFF, 0x80,
-    0x3F, 0xFE, 0xBF, 0xE0, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE4, 0x00,
-    0x03, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xBF, 0xF0, 0x00,
-    0x2F, 0xF4, 0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF, 0x03, 0xFD, 0x00, 0x0B, 0xFC,
-    0x0F, 0xF0, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x00, 0x7F, 0xF2, 0xFF, 0x00, 0x00, 0xFF, 0xDF, 0xF4,
-    0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x70, 0x1F, 0xFC, 0x00, 0x03, 0xD0, 0x7F, 0xF8, 0x00, 0x1F, 0xC3, 0xFF,
-    0xF0, 0x00, 0xFF, 0x6F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0xFF, 0xC0, 0x3F, 0xFF, 0xE3, 0xFF, 0x42,
-    0xFD, 0xFF, 0x07, 0xFE, 0x0F, 0xC2, 0xF4, 0x0F, 0xFC, 0xBE, 0x03, 0xC0, 0x3F, 0xF0, 0x00, 0x04,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xF9, 0x00, 0x0B, 0xFF, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFC, 0x03, 0xFF, 0x81, 0xBF, 0xFA, 0xAB, 0xFF,
-    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xEA, 0xBF, 0xFE, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F,
-    0xF0, 0x02, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFD, 0x56,
-    0xFF, 0x90, 0x3F, 0xF0, 0x1F, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFA, 0x94, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x1B, 0xC0, 0x2F, 0xFF, 0x1F, 0x80, 0x00,
-    0x0F, 0xFF, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0x01, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x7E, 0x00, 0x00,
-    0xFF, 0xD0, 0x1F, 0x80, 0x00, 0x3F, 0xF4, 0x07, 0xE5, 0x55, 0x0F, 0xFC, 0x01, 0xFF, 0xFF, 0xD3,
-    0xFF, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x3F, 0xF4, 0x07, 0xFF, 0xFF, 0x4F,
-    0xFE, 0x01, 0xF8, 0x7F, 0xD2, 0xFF, 0xC0, 0x7E, 0x1F, 0xF4, 0x7F, 0xF4, 0x1F, 0x87, 0xFD, 0x0F,
-    0xFF, 0x07, 0xE1, 0xFF, 0x41, 0xFF, 0xF5, 0xF8, 0xBF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xD0, 0x00,
-    0x00, 0x0F, 0xF6, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xAF, 0xFE, 0xAB, 0xFF,
-    0xA8, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x5B, 0xFE, 0x55, 0x5F, 0xFE, 0x40, 0xFF, 0xC0, 0x00,
-    0x7F, 0xD0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x01, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xD4, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xAA, 0xAA,
-    0xAB, 0xFF, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x06, 0xBF, 0xFF, 0xFA, 0xAA, 0x6F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xEB,
-    0xE7, 0xF0, 0x0B, 0xFF, 0x47, 0xE0, 0x10, 0x0F, 0xFE, 0x07, 0xE0, 0x00, 0x1F, 0xFC, 0x07, 0xE0,
-    0x00, 0x2F, 0xF8, 0x07, 0xE0, 0x00, 0x3F, 0xF4, 0x07, 0xE0, 0x00, 0x3F, 0xF4, 0x07, 0xE0, 0x00,
-    0x3F, 0xF0, 0x07, 0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xE0, 0x00, 0x3F,
-    0xF4, 0x07, 0xE0, 0x00, 0x3F, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xFC,
-    0x07, 0xE0, 0x00, 0x0F, 0xFF, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0xD7, 0xE1, 0xB0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2B, 0xFF,
-    0xAA, 0xFF, 0xEA, 0xA0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x3F, 0xFE, 0xBC, 0x03, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xE0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x0A, 0x42, 0xA4, 0x6A, 0x0F, 0xFC, 0x3F, 0xEF, 0xFE, 0xFF, 0xC7, 0xFC, 0x7A, 0xFD, 0x7F, 0x8B,
-    0xC7, 0xFC, 0x39, 0xF4, 0x2F, 0x03, 0xD7, 0xF8, 0x2F, 0xF4, 0x2F, 0x03, 0xEF, 0xF4, 0x0B, 0xFF,
-    0xBF, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFA, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xF4, 0x2F, 0x57, 0xD0, 0x00, 0x00, 0xF4, 0x2F, 0x03, 0xD0, 0x00, 0x00, 0xA0, 0x19, 0x02,
-    0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x5F, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xFF, 0xFA, 0xA8,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x55, 0x5B, 0xFE, 0x54, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0xD2, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x4B, 0xD0, 0x02, 0x4B,
-    0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x0A, 0xA3, 0xFF, 0xFD, 0x00, 0x7F, 0xC9, 0x2F, 0xF4, 0x01, 0xFF, 0x00, 0xBF, 0xD0, 0x0B, 0xFC,
-    0x02, 0xFF, 0x40, 0x3F, 0xE0, 0x0B, 0xFD, 0x01, 0xFF, 0x40, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF,
-    0xD1, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFA, 0xBF, 0xAA, 0xAA, 0xA5, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xF0, 0x04,
-    0x00, 0x00, 0xF4, 0x00, 0x0F, 0xC1, 0xF4, 0x78, 0x03, 0xD0, 0x00, 0x3F, 0x2F, 0xFB, 0xF8, 0x0F,
-    0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFD, 0xFC, 0x00, 0x03, 0xFF, 0x07, 0xF6, 0xFF, 0xD0, 0x00, 0x0F,
-    0xF0, 0x07, 0x01, 0xB8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0xBF, 0xE4, 0x01, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xD0, 0xBF, 0xC0, 0xBF, 0xF0, 0x1F, 0xFC, 0x02, 0xFF,
-    0x00, 0xBF, 0xE0, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x2F, 0xF0, 0x02, 0xFF,
-    0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x1F, 0xF5, 0xFF, 0x40,
-    0x0B, 0xFC, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x05, 0x50, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xD7,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0xFF,
-    0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0x55, 0xBF, 0xFC, 0x03, 0xFF, 0x00, 0x1F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD,
-    0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x2F, 0xFC, 0x6B,
-    0xFF, 0xAA, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x6B, 0xFF, 0xAA, 0x50, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x57, 0xFF, 0x55, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x29, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x0B,
-    0xFF, 0x7D, 0x3E, 0xBF, 0xF0, 0x0F, 0xFC, 0x3D, 0x3E, 0x3F, 0xF8, 0x2F, 0xF8, 0x3D, 0x3E, 0x1F,
-    0xFC, 0x3F, 0xF4, 0x3D, 0x3E, 0x0F, 0xFC, 0x3F, 0xF0, 0x3D, 0x3E, 0x0F, 0xFD, 0x3F, 0xF0, 0x3D,
-    0x3E, 0x0B, 0xFD, 0x3F, 0xF0, 0x3D, 0x3E, 0x0B, 0xFE, 0x3F, 0xF0, 0x14, 0x14, 0x01, 0x54, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x2E, 0x0F, 0x00, 0x00, 0xB8, 0x3C, 0x00,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xD6, 0xFF, 0xF3, 0xFF, 0x00, 0xFF, 0xDF, 0xFC, 0x03, 0xFF, 0x7F, 0xF0, 0x0F, 0xFD, 0xFF, 0xC0,
-    0x3F, 0xF3, 0xFF, 0x57, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xAB, 0xFF, 0xCF, 0xFC, 0x03, 0xFF, 0xBF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x2F, 0xFE, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x0B, 0x83,
-    0xC0, 0x00, 0x2E, 0x0F, 0x00, 0x00, 0x10, 0x14, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x7F, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xAB, 0xF0, 0x3F, 0xFC, 0x00,
-    0x10, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x28, 0x1F, 0xFF, 0xEF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF,
-    0xF8, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA,
-    0xAA, 0x5F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x06, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xC1, 0xA8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x0B, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xFF, 0x5B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t notosans_16_boldBitmaps[39537] = {
+    0xB5, 0x54, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xB6, 0xD9, 0x8C, 0x84, 0x0B, 0x37, 0x59, 0x51,
+    0x50, 0xF8, 0x1F, 0xC4, 0x2D, 0xDD, 0x78, 0xA1, 0xA0, 0xA0, 0xD8, 0x2D, 0x76, 0x2B, 0x8A, 0xB4,
+    0x48, 0x48, 0xBC, 0x9F, 0x30, 0x16, 0x5B, 0x50, 0xD0, 0x50, 0x85, 0x12, 0x0A, 0x44, 0x91, 0x26,
+    0xED, 0x76, 0xE3, 0x6C, 0xCA, 0x34, 0x16, 0x11, 0xA2, 0x48, 0x11, 0x47, 0x1B, 0x09, 0x24, 0x8A,
+    0x75, 0x14, 0xAF, 0xF0, 0xEE, 0xDA, 0x73, 0x39, 0x67, 0xFC, 0x96, 0x2C, 0xA9, 0x68, 0xF0, 0x7B,
+    0x33, 0x1E, 0xDF, 0x99, 0xB9, 0x1F, 0xE7, 0x9E, 0x7B, 0xED, 0xA8, 0xCF, 0x74, 0x7F, 0xB1, 0x7C,
+    0x15, 0x73, 0x35, 0xF8, 0x53, 0xCD, 0xE7, 0x72, 0x70, 0x8F, 0xD5, 0x4C, 0x3B, 0xB5, 0x88, 0x98,
+    0x09, 0x7B, 0x67, 0xFA, 0xD9, 0x9C, 0xD4, 0xFA, 0x75, 0xD0, 0x63, 0xC5, 0xEC, 0xD7, 0xFF, 0xDE,
+    0xE2, 0xD6, 0xBF, 0xCC, 0x22, 0x8B, 0x19, 0x44, 0x5C, 0x8A, 0x55, 0xD5, 0x06, 0x91, 0x62, 0xB0,
+    0x8D, 0x64, 0x53, 0xD1, 0xDD, 0xEC, 0x7C, 0x3C, 0x8B, 0x55, 0x3C, 0x05, 0xA7, 0x27, 0x9C, 0x86,
+    0xA3, 0xF0, 0xF9, 0xC5, 0x41, 0xDC, 0x91, 0xB2, 0xF5, 0x22, 0x39, 0xEE, 0x18, 0xEE, 0xBC, 0xE4,
+    0x34, 0x39, 0x4C, 0x61, 0x67, 0xF3, 0xAB, 0x1E, 0xD5, 0xF9, 0x5B, 0x6D, 0xC1, 0x8C, 0x22, 0x76,
+    0xEF, 0xF6, 0x1D, 0x78, 0x49, 0x4F, 0x4F, 0x30, 0xEE, 0x61, 0x6C, 0xAE, 0xEA, 0x14, 0x37, 0xB3,
+    0xAD, 0x9D, 0x97, 0xFA, 0xFC, 0xC1, 0xE0, 0x7F, 0xE9, 0xDF, 0xAB, 0xC6, 0x13, 0x31, 0xFA, 0x95,
+    0x88, 0x6A, 0x23, 0xA5, 0x5E, 0x4A, 0xA2, 0x3A, 0x4A, 0xBE, 0x7E, 0xCD, 0x82, 0x3B, 0xB5, 0x9C,
+    0x68, 0x2F, 0xF7, 0x8A, 0xA5, 0xC9, 0xBF, 0x09, 0xFE, 0xC1, 0xB5, 0x6E, 0x70, 0xFF, 0x29, 0x46,
+    0xEB, 0x79, 0xEA, 0xCB, 0x8B, 0x5B, 0x56, 0x72, 0x9A, 0x5D, 0x1F, 0xED, 0x24, 0x5D, 0xA0, 0x6D,
+    0xC1, 0x92, 0xDA, 0x5B, 0xF1, 0xB5, 0xB8, 0xA7, 0x93, 0xC0, 0xB5, 0xAA, 0x53, 0xB1, 0x2D, 0xE0,
+    0xA8, 0xDA, 0xB2, 0x97, 0x6C, 0xCE, 0xC7, 0x02, 0x68, 0x68, 0xBA, 0x98, 0x09, 0x61, 0xB4, 0xFE,
+    0x93, 0x39, 0x62, 0x75, 0xBA, 0xDC, 0xF9, 0x31, 0x5D, 0x8A, 0x01, 0xF0, 0x34, 0xF6, 0xF9, 0xE4,
+    0xF7, 0x75, 0xCA, 0x75, 0xB6, 0xDF, 0x06, 0x15, 0x5D, 0xEC, 0x93, 0xB9, 0xEC, 0xEF, 0xFC, 0x51,
+    0xF6, 0x9A, 0xAD, 0xA7, 0x1B, 0x65, 0x5E, 0xCA, 0x1E, 0x8A, 0xB3, 0x19, 0xB0, 0x0C, 0xB4, 0x1F,
+    0xB8, 0x49, 0x63, 0xD8, 0xF4, 0x75, 0x3E, 0xFA, 0x06, 0xF6, 0x13, 0x7A, 0x83, 0x63, 0x15, 0x7C,
+    0x84, 0xFD, 0x04, 0x2F, 0x3E, 0xC9, 0x3F, 0xBE, 0x7F, 0xA8, 0x8C, 0x83, 0x40, 0x08, 0x00, 0x43,
+    0x04, 0x46, 0xCF, 0xA1, 0x20, 0x5F, 0x32, 0xCE, 0x73, 0x1A, 0x67, 0xAE, 0x4D, 0xC8, 0x03, 0xCF,
+    0x6C, 0x60, 0x05, 0x5A, 0x11, 0x84, 0x78, 0xE8, 0xC6, 0x3A, 0x48, 0x01, 0x67, 0x55, 0xAA, 0xA9,
+    0x84, 0x35, 0x3B, 0xDA, 0xC9, 0x0F, 0x0E, 0xBF, 0x6A, 0xD1, 0xCE, 0xF7, 0x39, 0xD1, 0xEB, 0x09,
+    0xAE, 0x1F, 0xC4, 0x07, 0x71, 0xB3, 0xF8, 0x65, 0xA5, 0x42, 0x5D, 0x72, 0xEE, 0x90, 0xF2, 0xC5,
+    0x8F, 0xD0, 0xD6, 0x55, 0xB0, 0x7F, 0x40, 0x77, 0xFC, 0xF9, 0x55, 0xF0, 0x8F, 0x7E, 0xBB, 0x00,
+    0xB5, 0xE0, 0x7D, 0x3E, 0x26, 0x88, 0xAB, 0x33, 0xB3, 0xE0, 0xCA, 0x90, 0x06, 0xAC, 0x11, 0xAB,
+    0x6B, 0x21, 0xF0, 0x6D, 0x3E, 0x89, 0x6F, 0xD6, 0x69, 0x2B, 0xC3, 0x6E, 0x90, 0x6A, 0x00, 0x16,
+    0xC5, 0x04, 0x09, 0xCE, 0x03, 0x20, 0xD7, 0xC8, 0xA1, 0xAF, 0x8B, 0xF5, 0x36, 0x4E, 0x42, 0x61,
+    0x6F, 0xE2, 0xAB, 0x2B, 0x26, 0x44, 0xE9, 0xDA, 0x72, 0x30, 0x73, 0xC2, 0x45, 0x35, 0xE4, 0x13,
+    0x34, 0x68, 0xCD, 0x65, 0x31, 0x9A, 0x39, 0x0B, 0x90, 0xE3, 0xB3, 0x61, 0x41, 0x24, 0x87, 0x42,
+    0x9F, 0x00, 0xC5, 0xBC, 0x5D, 0xA4, 0x93, 0x24, 0x5D, 0xD5, 0x7C, 0x51, 0x5D, 0x5D, 0xB1, 0x3C,
+    0x90, 0x36, 0x32, 0x66, 0x57, 0x2F, 0x6A, 0xF0, 0xAA, 0x06, 0x64, 0xCC, 0xCB, 0xFD, 0x01, 0x2E,
+    0x69, 0x93, 0x06, 0xE4, 0x3D, 0x6D, 0x3F, 0xDA, 0xA2, 0x9F, 0x01, 0xF6, 0x04, 0x41, 0x8B, 0x83,
+    0xE6, 0x12, 0xB9, 0x31, 0xAB, 0xE0, 0xCE, 0x43, 0xFF, 0xF0, 0x67, 0xD2, 0x1F, 0xBC, 0xD3, 0x47,
+    0x18, 0xFD, 0xBB, 0x27, 0xDE, 0x5E, 0x49, 0x80, 0x58, 0x39, 0xA2, 0x6E, 0x8B, 0xC9, 0x3E, 0xD6,
+    0x7C, 0xB4, 0xED, 0x21, 0xE0, 0x3D, 0xD3, 0x10, 0xA7, 0x68, 0xC6, 0x1D, 0xEB, 0x7E, 0xB0, 0xA3,
+    0x6F, 0xEF, 0xD2, 0xE5, 0x4E, 0x0C, 0x3D, 0x02, 0x29, 0x47, 0x61, 0x7E, 0x6D, 0x2F, 0x06, 0x0A,
+    0x7D, 0x4B, 0xBC, 0x12, 0x0A, 0x06, 0xC9, 0x20, 0x70, 0x51, 0x80, 0xC0, 0x09, 0x26, 0x00, 0x11,
+    0xD7, 0x81, 0x0B, 0x10, 0xA0, 0x5E, 0x20, 0xD0, 0xA8, 0x8A, 0x82, 0x7F, 0x91, 0xA9, 0x02, 0x89,
+    0x2A, 0x64, 0x15, 0x75, 0x3E, 0xE7, 0x9A, 0x01, 0x11, 0xB1, 0xAF, 0x15, 0xC9, 0x71, 0x20, 0xC1,
+    0x66, 0x14, 0xF7, 0xE7, 0x22, 0xE5, 0xB5, 0x92, 0x6D, 0xAD, 0x90, 0x47, 0x16, 0xF8, 0x14, 0x41,
+    0x6B, 0x13, 0x7C, 0x97, 0xE8, 0x0F, 0x38, 0x71, 0x86, 0xF4, 0x8D, 0xDA, 0xA2, 0x1D, 0x4D, 0x79,
+    0x2C, 0xE3, 0x1A, 0xAD, 0xA0, 0x89, 0x85, 0xEA, 0xE0, 0x8D, 0x30, 0x03, 0xC8, 0xB7, 0xE8, 0x90,
+    0x28, 0x18, 0xAA, 0x69, 0x2C, 0xF4, 0x37, 0xFA, 0x62, 0xB6, 0xC7, 0x6A, 0x6A, 0xE8, 0x75, 0x83,
+    0x94, 0x33, 0xA8, 0x8C, 0x70, 0xFE, 0xD3, 0xC7, 0xEA, 0x7C, 0x07, 0xF5, 0x0A, 0x1E, 0xEA, 0x80,
+    0x77, 0x60, 0x09, 0xB4, 0x23, 0xC1, 0x40, 0x35, 0x48, 0x8C, 0x97, 0xA0, 0x89, 0xEB, 0x23, 0x42,
+    0x62, 0x59, 0xC0, 0x6C, 0x77, 0xEF, 0x8E, 0x69, 0x3B, 0xB8, 0x86, 0xF3, 0xD7, 0xCC, 0x23, 0x89,
+    0xCE, 0x5C, 0xB6, 0xD1, 0xD4, 0x46, 0xBF, 0x83, 0xCF, 0x9A, 0xB0, 0x09, 0x5A, 0xB6, 0xAA, 0x57,
+    0x30, 0x55, 0x47, 0xAD, 0x05, 0x6E, 0x11, 0xEB, 0x14, 0x81, 0x7E, 0xA0, 0x75, 0xC6, 0xA6, 0xC4,
+    0x2C, 0x5A, 0xC0, 0xFA, 0xBE, 0x67, 0xF9, 0x52, 0x6F, 0xC6, 0xAA, 0xF5, 0xFD, 0x6A, 0xA8, 0x08,
+    0x3F, 0xA1, 0x8B, 0x6D, 0xAE, 0x7C, 0x6C, 0x55, 0xA7, 0xB4, 0x52, 0xF2, 0xDA, 0xCE, 0x41, 0xA4,
+    0x18, 0x29, 0x40, 0x5F, 0x53, 0x90, 0x48, 0x0A, 0x5E, 0xA4, 0xBE, 0x5C, 0x21, 0x72, 0x50, 0x91,
+    0x2D, 0x4C, 0xDA, 0xB3, 0x20, 0x49, 0x40, 0xB6, 0x8B, 0x01, 0xE1, 0xF9, 0x3D, 0x6D, 0xCC, 0x6C,
+    0x50, 0x29, 0x6D, 0x39, 0xA1, 0xB3, 0xB8, 0x9E, 0x85, 0xBA, 0xB0, 0x1F, 0x5F, 0x32, 0x90, 0xDF,
+    0x39, 0x35, 0x40, 0xB0, 0x61, 0x5B, 0x80, 0xFA, 0x72, 0x92, 0x15, 0x17, 0x88, 0x90, 0xF7, 0x89,
+    0x39, 0x13, 0xFA, 0x81, 0xE0, 0x86, 0xF2, 0xF2, 0xE8, 0x90, 0xFC, 0x22, 0xB3, 0x48, 0x32, 0xB2,
+    0x89, 0x5D, 0xB7, 0xBF, 0x39, 0x35, 0x10, 0x25, 0xA9, 0x0D, 0xC1, 0xB1, 0x60, 0x77, 0x1E, 0xC3,
+    0x67, 0x80, 0x88, 0xD6, 0xBE, 0x7E, 0x05, 0x94, 0x61, 0x7A, 0x81, 0x0F, 0x01, 0xAD, 0x02, 0x1D,
+    0x84, 0xAE, 0xEF, 0xD6, 0x37, 0xA4, 0xDB, 0x28, 0xDB, 0x7D, 0x07, 0x6D, 0x23, 0x3B, 0x58, 0x0C,
+    0x93, 0xAA, 0x68, 0x0A, 0xD4, 0x06, 0x57, 0x77, 0x6B, 0x33, 0xBB, 0x90, 0xAA, 0xD3, 0x81, 0x39,
+    0xB0, 0xFA, 0xBD, 0xBE, 0x40, 0xBB, 0xBA, 0x8E, 0xF0, 0x82, 0x84, 0xE7, 0x20, 0xE1, 0x5F, 0x0B,
+    0xA0, 0xD7, 0xD6, 0x04, 0x0B, 0xEF, 0x3F, 0x45, 0x0F, 0x64, 0xCB, 0xEF, 0xE0, 0x66, 0x87, 0x24,
+    0xC2, 0x97, 0xBB, 0x12, 0x7B, 0xD6, 0x1B, 0x8D, 0x0A, 0xB6, 0x8B, 0xDD, 0xA3, 0x23, 0xFA, 0x58,
+    0xC4, 0x96, 0xD8, 0xAC, 0xB4, 0x88, 0x78, 0xDF, 0x48, 0x99, 0xC5, 0x95, 0x41, 0x61, 0xCB, 0x1E,
+    0x42, 0x15, 0xA9, 0xE4, 0x98, 0xEC, 0x65, 0x2B, 0xAD, 0xC6, 0xAD, 0x94, 0x39, 0x2D, 0x6E, 0x97,
+    0xD4, 0xFF, 0xFD, 0xFC, 0x0D, 0xAD, 0x55, 0xBB, 0x72, 0xE4, 0x44, 0x14, 0xBD, 0x33, 0xC2, 0x56,
+    0x30, 0x81, 0x36, 0x71, 0xE4, 0x40, 0x9F, 0xA0, 0x4F, 0x68, 0xAD, 0x1D, 0x10, 0x10, 0xD8, 0x45,
+    0x79, 0x9C, 0x10, 0x38, 0xDF, 0xC4, 0x9F, 0x20, 0x53, 0x84, 0x04, 0xF6, 0x1F, 0x90, 0x10, 0x50,
+    0x93, 0x38, 0x21, 0xA5, 0x24, 0xF0, 0x07, 0xAC, 0x60, 0xCB, 0x11, 0x89, 0xAA, 0x76, 0x23, 0x13,
+    0x8C, 0xB6, 0x10, 0x94, 0x0C, 0xAD, 0x3E, 0x9C, 0xD3, 0xB3, 0xE3, 0xB2, 0x6B, 0x03, 0x6F, 0x40,
+    0xD7, 0x74, 0xB7, 0xD4, 0xBA, 0xCF, 0x73, 0xCF, 0xED, 0x31, 0xE3, 0xD8, 0xC7, 0x95, 0x39, 0x40,
+    0xB3, 0x2F, 0xC2, 0x75, 0xC8, 0xBC, 0xE1, 0x26, 0x58, 0xD1, 0xE3, 0x62, 0xE1, 0x5D, 0x9F, 0x20,
+    0xC5, 0x21, 0xCA, 0x1A, 0x7C, 0x05, 0x4A, 0xAB, 0xE3, 0x1C, 0x0D, 0x40, 0x83, 0xAE, 0x1A, 0xAB,
+    0x2E, 0xC1, 0x79, 0x6F, 0x6E, 0xED, 0x2D, 0xA3, 0x95, 0x04, 0x75, 0x37, 0xC3, 0x77, 0xE1, 0x14,
+    0xBF, 0x51, 0xA2, 0x2B, 0x38, 0x67, 0x35, 0x2E, 0xCC, 0x4E, 0x6C, 0x33, 0xF6, 0xA9, 0xEF, 0x30,
+    0xC9, 0x5D, 0xCB, 0xE9, 0xF3, 0x29, 0xC1, 0xB7, 0xC1, 0xDC, 0x9F, 0xB0, 0xC5, 0x84, 0x66, 0x86,
+    0x9A, 0xC6, 0xE0, 0x2D, 0x0F, 0xB8, 0xC8, 0x50, 0x8D, 0x39, 0x5E, 0xD3, 0xD0, 0x7B, 0x60, 0xCD,
+    0xC7, 0xB7, 0xC1, 0x5E, 0x5D, 0xD1, 0x80, 0x55, 0x8D, 0x99, 0xEB, 0xCD, 0x8A, 0x81, 0xBB, 0x4F,
+    0x56, 0xF0, 0x33, 0xD0, 0x68, 0x25, 0x45, 0xBC, 0x33, 0x5B, 0xD2, 0xD3, 0x6E, 0x59, 0xDF, 0xE0,
+    0x28, 0xB8, 0xC1, 0x95, 0xF6, 0x78, 0xCC, 0x42, 0x36, 0xB9, 0x91, 0xF1, 0xD9, 0x71, 0x14, 0xB9,
+    0x94, 0xC8, 0x85, 0x3D, 0x1D, 0xE9, 0x54, 0xF4, 0xF5, 0x4D, 0xC8, 0xFA, 0xEA, 0x97, 0x29, 0xEB,
+    0xF7, 0xA2, 0x1E, 0xCD, 0xA4, 0x9D, 0x59, 0x3E, 0xD2, 0x7F, 0xB0, 0x19, 0x82, 0xA5, 0x04, 0x22,
+    0x47, 0x4B, 0xBF, 0x04, 0x65, 0x62, 0x38, 0x9C, 0x3A, 0xDB, 0x04, 0x51, 0xF1, 0x8B, 0x29, 0xF9,
+    0xB9, 0x8E, 0xD2, 0x40, 0x1B, 0xB9, 0xFC, 0xBC, 0x78, 0xB5, 0x5A, 0xAD, 0xCE, 0x99, 0xD5, 0x1F,
+    0x9C, 0xF7, 0x9C, 0xE1, 0x21, 0xB4, 0xE5, 0x72, 0xF9, 0xA5, 0x0E, 0x08, 0x37, 0xAE, 0x05, 0xA0,
+    0x4E, 0x8F, 0x39, 0x0B, 0x3A, 0x5F, 0xD0, 0xFA, 0x1C, 0xCC, 0xB8, 0x90, 0x61, 0xF9, 0x9C, 0x21,
+    0x3A, 0x1C, 0x04, 0xEB, 0x05, 0xDF, 0x3A, 0x5B, 0xF0, 0xE5, 0x1C, 0x2D, 0xD1, 0x28, 0x17, 0xB8,
+    0xE7, 0x6B, 0x47, 0x15, 0xEA, 0xFE, 0x24, 0xBF, 0x5B, 0x37, 0x73, 0x7A, 0xAC, 0x88, 0x3F, 0xBD,
+    0xF4, 0xAA, 0x41, 0x51, 0xE6, 0xFE, 0x33, 0x5B, 0x78, 0x8B, 0x93, 0x04, 0xB0, 0x82, 0x01, 0xB3,
+    0x10, 0x09, 0x1A, 0x56, 0x95, 0x10, 0xF3, 0xD5, 0xD1, 0xA7, 0x23, 0xEC, 0x15, 0x53, 0xD8, 0x7B,
+    0x84, 0x94, 0xA0, 0x53, 0x9C, 0xDB, 0xA9, 0xD2, 0xEC, 0xE8, 0xC3, 0x2E, 0xFD, 0x9B, 0x00, 0x50,
+    0xB4, 0xE4, 0x0E, 0x6B, 0x63, 0x2E, 0x94, 0xFB, 0xB4, 0x17, 0x81, 0x69, 0xE6, 0xCA, 0xBB, 0xE8,
+    0xD2, 0xD1, 0xAE, 0xBF, 0x5F, 0x0C, 0x59, 0x4F, 0x99, 0xC3, 0x31, 0x17, 0x2B, 0x0E, 0x7C, 0xD1,
+    0xD4, 0x6D, 0xFD, 0xD2, 0xBB, 0xAF, 0x61, 0xD5, 0xCB, 0xC9, 0x1D, 0xB0, 0xB6, 0x36, 0x55, 0x87,
+    0xDE, 0x6A, 0x6E, 0x09, 0xB7, 0x99, 0xD7, 0x06, 0x6E, 0x3C, 0x44, 0xE2, 0xAB, 0x83, 0x30, 0xC7,
+    0xE7, 0x2C, 0x24, 0xD6, 0x58, 0xF7, 0xAE, 0xA9, 0xC8, 0x9B, 0xA6, 0x68, 0xF3, 0x90, 0xC0, 0xB2,
+    0x3E, 0x66, 0xAF, 0xE4, 0x38, 0x12, 0x41, 0x75, 0xC5, 0x20, 0xC2, 0x69, 0xDD, 0x0A, 0xCC, 0x18,
+    0xE0, 0x9C, 0x9B, 0x8A, 0xB3, 0xBB, 0xBA, 0x8A, 0x51, 0x8F, 0x5A, 0x15, 0xF2, 0x06, 0x64, 0x6A,
+    0x41, 0x6B, 0xD0, 0xBA, 0xF0, 0x12, 0xCD, 0x3C, 0xD1, 0xB1, 0x6C, 0xAC, 0x1B, 0xF1, 0xD0, 0x75,
+    0x62, 0xA4, 0x38, 0x59, 0x75, 0x62, 0x65, 0xDD, 0x8A, 0x27, 0x68, 0x88, 0xE6, 0x8C, 0xAD, 0x33,
+    0x45, 0x07, 0x41, 0x66, 0x68, 0x28, 0xD5, 0x5A, 0x0A, 0x13, 0x0A, 0x84, 0xE5, 0x29, 0x9A, 0xDC,
+    0x0B, 0x15, 0x17, 0x61, 0x77, 0x54, 0xAF, 0xFA, 0xAA, 0x17, 0xEE, 0x42, 0xB4, 0xF0, 0x0E, 0xFF,
+    0x94, 0xEA, 0xB8, 0x41, 0xEA, 0x63, 0xA6, 0x27, 0xD7, 0xEF, 0xA2, 0x43, 0x33, 0xC7, 0x8D, 0xCC,
+    0xD1, 0x4B, 0x3E, 0xD2, 0x39, 0x5A, 0xDC, 0x9E, 0x41, 0x52, 0x5D, 0x86, 0x4D, 0x97, 0xA1, 0xC4,
+    0xDD, 0x35, 0x5B, 0x98, 0x25, 0xA0, 0x14, 0xA9, 0xCF, 0xFE, 0x1A, 0x18, 0x39, 0xDE, 0x48, 0xF1,
+    0xC8, 0x5B, 0xE5, 0x25, 0xD5, 0x29, 0x98, 0xAD, 0xE2, 0xBB, 0x2D, 0x1F, 0x6B, 0x5E, 0x0E, 0x99,
+    0x2A, 0x47, 0xBA, 0xA8, 0xC5, 0x30, 0x26, 0x18, 0x76, 0x59, 0xA9, 0xD2, 0x5E, 0x64, 0xB1, 0x7C,
+    0x42, 0x48, 0x61, 0x9B, 0xA2, 0x8E, 0x3D, 0xF9, 0xD1, 0x32, 0x6C, 0x45, 0xA2, 0x70, 0x2E, 0x34,
+    0xB3, 0x08, 0x23, 0xEF, 0x86, 0x1F, 0xE5, 0x72, 0x88, 0xB9, 0xA9, 0x12, 0x03, 0x59, 0xA3, 0x6A,
+    0xEC, 0x1C, 0x5B, 0xCC, 0x59, 0xA9, 0x96, 0x31, 0x69, 0x8B, 0x60, 0xB9, 0xBF, 0xBE, 0x62, 0xFE,
+    0x6A, 0xF2, 0x44, 0x34, 0x22, 0x00, 0x42, 0x47, 0x44, 0x3D, 0x12, 0x80, 0x6F, 0x22, 0x57, 0x45,
+    0xDA, 0x10, 0x0F, 0x2F, 0x75, 0xF8, 0x56, 0x87, 0xCA, 0x38, 0x93, 0x64, 0x44, 0x21, 0xC5, 0x37,
+    0x4A, 0xBE, 0x41, 0x73, 0x16, 0x6F, 0xA1, 0x98, 0x34, 0xBA, 0x24, 0x72, 0x00, 0xE2, 0x2D, 0x9F,
+    0xD6, 0xAC, 0xD7, 0x76, 0xBB, 0x5D, 0x46, 0xFB, 0x4D, 0x6C, 0x0E, 0x6D, 0xD3, 0xF2, 0x84, 0xDF,
+    0x78, 0x35, 0x79, 0x6D, 0x61, 0xF5, 0xC3, 0xA3, 0x6F, 0x8F, 0xB6, 0xA7, 0x56, 0x9E, 0xB1, 0xA9,
+    0xED, 0x6E, 0x75, 0xF9, 0xC1, 0xA6, 0x36, 0xBE, 0x7D, 0x2C, 0xF2, 0x64, 0x7B, 0xB8, 0x55, 0xEF,
+    0x63, 0xA7, 0xF5, 0x16, 0xFB, 0x2C, 0x52, 0x0D, 0xA1, 0x3C, 0xB7, 0x3A, 0xD6, 0x27, 0xE2, 0xEE,
+    0x23, 0xE4, 0x91, 0xCA, 0xBA, 0x10, 0xD1, 0xEE, 0x2C, 0x4F, 0x74, 0xBF, 0x0B, 0x3A, 0x08, 0x3A,
+    0x87, 0x01, 0x6D, 0x06, 0x5E, 0x8E, 0xA4, 0xEC, 0x17, 0x94, 0xAC, 0x7E, 0x65, 0x2D, 0xF2, 0x81,
+    0xEA, 0xE9, 0x94, 0xA2, 0x9D, 0xC7, 0xBF, 0x01, 0x89, 0xA8, 0x50, 0xB5, 0xF8, 0x35, 0x8F, 0x60,
+    0xCD, 0x4E, 0x62, 0x3C, 0x29, 0xEF, 0x6F, 0x5B, 0x84, 0x4F, 0x59, 0x6E, 0x97, 0x67, 0xC2, 0x01,
+    0x8F, 0x97, 0xBB, 0xD5, 0x75, 0xF8, 0x64, 0x03, 0x0F, 0x4B, 0x8D, 0x7F, 0xA5, 0x8E, 0xDF, 0x45,
+    0x4D, 0x41, 0xA2, 0x2E, 0x68, 0x9E, 0x7D, 0x2C, 0x48, 0x8B, 0x0F, 0x43, 0x67, 0xFF, 0xD7, 0xAF,
+    0x18, 0xF7, 0xEA, 0xA1, 0x42, 0xCF, 0xAB, 0x9F, 0xF7, 0x73, 0x35, 0x0A, 0x96, 0x42, 0x84, 0xAC,
+    0x7B, 0xFD, 0xB7, 0xB5, 0x8A, 0xA1, 0x54, 0xCF, 0x2B, 0x04, 0xC2, 0xDE, 0xF0, 0x92, 0xC5, 0xCF,
+    0x44, 0x99, 0x6D, 0x4C, 0xE6, 0xBD, 0x66, 0x4B, 0x61, 0x1D, 0x89, 0x33, 0x45, 0xF6, 0xC4, 0x85,
+    0x1F, 0xFE, 0x56, 0xC3, 0x36, 0x2A, 0x6F, 0x53, 0x0D, 0x5B, 0xDD, 0x68, 0x25, 0x95, 0xBD, 0x44,
+    0x54, 0xDE, 0xB4, 0x83, 0x1C, 0x6D, 0x0A, 0xFE, 0xFC, 0xF8, 0x0F, 0xCD, 0x55, 0xBD, 0x6E, 0xD4,
+    0x40, 0x10, 0x9E, 0x3B, 0x17, 0x2E, 0x5C, 0x6C, 0x95, 0x2A, 0x85, 0x1F, 0xC1, 0x8F, 0xB0, 0x46,
+    0x14, 0x29, 0x8F, 0x82, 0x88, 0x77, 0xA0, 0xC9, 0x1B, 0x64, 0x0F, 0xF1, 0x00, 0xD0, 0x50, 0xA7,
+    0x45, 0xF0, 0x10, 0xB6, 0x92, 0x22, 0x65, 0x2C, 0xA5, 0xA0, 0xA0, 0x38, 0x03, 0x91, 0x68, 0x17,
+    0xE4, 0xD3, 0x19, 0xB2, 0xEB, 0xE1, 0xFB, 0xF6, 0x2E, 0xE2, 0x28, 0x48, 0x43, 0x0A, 0x4E, 0xF2,
+    0x68, 0x66, 0x3D, 0xDE, 0xF9, 0xE6, 0x9B, 0x9F, 0xB3, 0xBD, 0x88, 0xF5, 0x0F, 0xF8, 0xA8, 0x4E,
+    0xFB, 0x8F, 0x06, 0x91, 0x5C, 0x57, 0xDA, 0x89, 0x68, 0xD4, 0x49, 0xC4, 0xC0, 0xF0, 0x32, 0x87,
+    0xA1, 0xF4, 0x5E, 0xE9, 0x28, 0x19, 0x8C, 0xA6, 0x95, 0xA6, 0x59, 0x6D, 0x82, 0x98, 0x4D, 0xD4,
+    0x93, 0x4E, 0xD4, 0xAE, 0xD6, 0x93, 0x94, 0xD7, 0x51, 0x17, 0x3E, 0x0B, 0x76, 0x35, 0x68, 0x6D,
+    0x2F, 0xA3, 0x1E, 0x8D, 0xF9, 0xE0, 0x56, 0xA3, 0x6D, 0x35, 0x8F, 0xFA, 0x32, 0x1A, 0x0F, 0xA3,
+    0xFA, 0x34, 0xC1, 0x58, 0xAA, 0x6D, 0x61, 0x98, 0x4D, 0xA0, 0xD1, 0xE8, 0x12, 0x46, 0xAE, 0x9E,
+    0x86, 0x55, 0x81, 0x31, 0xD7, 0x9E, 0x46, 0x19, 0x68, 0x88, 0xB6, 0x30, 0x06, 0x11, 0x77, 0xA5,
+    0xAD, 0xE4, 0x81, 0xC8, 0xA0, 0x0E, 0x54, 0x71, 0x00, 0x35, 0x52, 0x6D, 0x3C, 0xD4, 0x8D, 0x2E,
+    0xA1, 0x2E, 0xF0, 0xDD, 0xD5, 0xD0, 0x78, 0xA8, 0x8F, 0xB5, 0x86, 0x5A, 0x05, 0xA8, 0xB5, 0x76,
+    0xEE, 0x0A, 0x71, 0xA0, 0x2E, 0xED, 0x08, 0x55, 0xF4, 0x12, 0x6A, 0xA1, 0x54, 0xED, 0x2D, 0xD4,
+    0x99, 0x2A, 0x54, 0xA3, 0x50, 0xC5, 0x51, 0x9D, 0x27, 0xD5, 0x50, 0x95, 0x06, 0xEC, 0xA4, 0xDF,
+    0x0C, 0x80, 0x45, 0x4A, 0x55, 0x1E, 0x2A, 0xA8, 0x99, 0x43, 0x00, 0xA3, 0xDE, 0xE4, 0xDA, 0x1B,
+    0xAD, 0x45, 0x7D, 0x19, 0xC1, 0xD7, 0x58, 0xE1, 0x8B, 0x2A, 0x58, 0xB8, 0x95, 0xC1, 0x02, 0xBF,
+    0x89, 0x3B, 0xE9, 0xF7, 0xE4, 0xFE, 0x39, 0x3C, 0x4D, 0xD8, 0x7E, 0xB5, 0xBD, 0xC1, 0x80, 0xF7,
+    0x66, 0xC0, 0xB5, 0x60, 0x27, 0x4B, 0x51, 0x84, 0xB2, 0x96, 0x4A, 0x59, 0x2C, 0x04, 0x7E, 0x4D,
+    0x40, 0x4F, 0x58, 0x9D, 0x9F, 0x42, 0x8F, 0x1A, 0x85, 0x8C, 0x54, 0x06, 0xBB, 0x3E, 0xD1, 0x0B,
+    0x25, 0x00, 0x2F, 0x54, 0x52, 0xC4, 0xA4, 0xE0, 0x24, 0x83, 0xF2, 0x1E, 0x3E, 0x70, 0xA4, 0x73,
+    0x0B, 0xA5, 0xCB, 0xF4, 0x5D, 0x9D, 0xFA, 0x22, 0x43, 0xD4, 0xFB, 0x94, 0xFF, 0x91, 0x07, 0x4F,
+    0x40, 0x6E, 0x24, 0xAE, 0x72, 0xA2, 0x2C, 0x08, 0x0E, 0x78, 0x3B, 0x1A, 0xEC, 0x1E, 0x91, 0xE7,
+    0x6F, 0xC1, 0x52, 0xCD, 0xB6, 0x1F, 0x52, 0xEF, 0x53, 0xA0, 0x15, 0xFC, 0x21, 0xF2, 0xF7, 0x33,
+    0xED, 0xC8, 0xCF, 0x1F, 0x62, 0xC6, 0x17, 0x05, 0x9B, 0x12, 0xD9, 0x59, 0x26, 0x4A, 0x9E, 0x28,
+    0x3C, 0xD8, 0x00, 0x58, 0xEB, 0xD1, 0xA2, 0x70, 0xC1, 0x55, 0xC0, 0x55, 0x5B, 0x3F, 0xE7, 0x17,
+    0xA2, 0x3D, 0x84, 0x1B, 0x20, 0x2C, 0xD9, 0x37, 0x09, 0x90, 0x1C, 0xEA, 0x0D, 0xF1, 0xF6, 0xBC,
+    0x08, 0xAC, 0x05, 0x24, 0x75, 0x9A, 0xF8, 0x44, 0x36, 0x89, 0x5C, 0x66, 0x39, 0x27, 0x9B, 0x56,
+    0x7B, 0x16, 0x93, 0xE9, 0x21, 0x3B, 0x66, 0x9B, 0x31, 0x83, 0x12, 0xEF, 0x67, 0xC9, 0xF9, 0x5B,
+    0x0D, 0x82, 0x4E, 0xEB, 0x62, 0xC2, 0x3D, 0x7A, 0x84, 0xE7, 0x05, 0x33, 0x39, 0xE4, 0x64, 0xB0,
+    0x19, 0x1C, 0xAC, 0x35, 0x09, 0xFA, 0x4A, 0x71, 0x86, 0x67, 0x3A, 0x78, 0xA6, 0x6F, 0x9E, 0xE2,
+    0xA3, 0x5D, 0x1D, 0x53, 0xCC, 0x14, 0xFC, 0x61, 0x8E, 0x6C, 0x0F, 0xE4, 0x18, 0x3B, 0x69, 0xAE,
+    0xF1, 0xAE, 0x1A, 0x70, 0x54, 0xB0, 0xB2, 0xFF, 0x78, 0x98, 0xE9, 0x02, 0xF5, 0x47, 0xAF, 0x2E,
+    0xA5, 0xF1, 0xA8, 0x6E, 0x83, 0x4E, 0x60, 0xC5, 0x21, 0x22, 0xE8, 0x22, 0x3B, 0x2E, 0xD5, 0xF6,
+    0x00, 0x0F, 0xD6, 0x92, 0xB8, 0x8F, 0x5C, 0x5B, 0x24, 0x3D, 0xB5, 0xBA, 0x94, 0x63, 0x35, 0x10,
+    0x2E, 0x21, 0x7A, 0x20, 0xCE, 0x27, 0x69, 0xB0, 0xB0, 0xDA, 0x6C, 0x22, 0x7E, 0x56, 0xB8, 0x9E,
+    0x6B, 0x5D, 0xA1, 0x46, 0x23, 0x93, 0xD2, 0xD6, 0x75, 0x92, 0xC7, 0x02, 0xF7, 0xDA, 0x3E, 0xD1,
+    0x6E, 0xC8, 0xFB, 0xF7, 0x54, 0xA5, 0x13, 0x96, 0xE8, 0x16, 0x78, 0x10, 0x33, 0x91, 0x90, 0x08,
+    0x40, 0x95, 0x50, 0x14, 0xD2, 0xC0, 0x32, 0x03, 0x43, 0x39, 0x20, 0x17, 0x44, 0x2D, 0x78, 0xDF,
+    0xE5, 0x04, 0x3F, 0xEC, 0xA8, 0x1E, 0x19, 0x00, 0x68, 0xC5, 0x9E, 0x70, 0x93, 0x14, 0x01, 0x21,
+    0x2A, 0xC0, 0x50, 0x00, 0x30, 0xF8, 0x1A, 0x3D, 0xD6, 0x67, 0x53, 0x14, 0xD7, 0x99, 0x30, 0x9B,
+    0xDC, 0xB2, 0x42, 0x27, 0x49, 0xB3, 0x20, 0x64, 0xD7, 0xD9, 0x8B, 0x40, 0xBC, 0xA3, 0xF1, 0xFA,
+    0x48, 0xEB, 0x0C, 0x0B, 0xAC, 0xEA, 0xB9, 0x83, 0xCF, 0x63, 0xCE, 0x4C, 0xCB, 0x01, 0xF9, 0x19,
+    0xAC, 0xE6, 0x68, 0x5B, 0xFB, 0x81, 0x7C, 0x9D, 0xF5, 0xC5, 0x0F, 0xF2, 0x78, 0x3B, 0x08, 0x97,
+    0x75, 0x0E, 0xA4, 0x6C, 0x29, 0xD0, 0x06, 0x54, 0x03, 0x41, 0x63, 0xD5, 0x05, 0xCE, 0x08, 0x9B,
+    0x79, 0x8B, 0xDF, 0x70, 0x5E, 0x6C, 0x00, 0x76, 0x9C, 0xC1, 0x47, 0xBB, 0x86, 0x87, 0xE8, 0x65,
+    0x71, 0x1C, 0x84, 0x4C, 0x97, 0x68, 0x6E, 0x0C, 0x65, 0xC6, 0x45, 0x8A, 0x3B, 0x99, 0x6E, 0x31,
+    0xB9, 0xD4, 0xB7, 0x24, 0xA1, 0xDC, 0xF1, 0xD1, 0x52, 0xB2, 0xE3, 0x67, 0xA9, 0x32, 0x26, 0x71,
+    0x93, 0x06, 0x34, 0x57, 0x82, 0xB0, 0x6B, 0xB8, 0xCC, 0xF5, 0x1C, 0xB2, 0x0C, 0x19, 0x79, 0xC1,
+    0x54, 0x93, 0x2D, 0x04, 0x73, 0x03, 0x58, 0xE4, 0x59, 0x95, 0xC6, 0xDF, 0x86, 0x86, 0x7D, 0x75,
+    0x16, 0x70, 0xD7, 0x45, 0xF2, 0x24, 0x7D, 0x69, 0xDC, 0xF8, 0xAF, 0x80, 0xD9, 0xAB, 0x46, 0x13,
+    0x81, 0x28, 0xE7, 0x7E, 0xF8, 0x0C, 0x14, 0x26, 0xE2, 0xDA, 0x19, 0x87, 0x14, 0x48, 0x52, 0xC8,
+    0x14, 0x9D, 0x7B, 0xA1, 0x0C, 0x72, 0xB7, 0xBF, 0xB6, 0x18, 0xFD, 0x5D, 0x13, 0xFF, 0xF5, 0x10,
+    0xD3, 0xAA, 0x9E, 0x23, 0x74, 0x41, 0x91, 0x5A, 0xEF, 0xE0, 0xF8, 0x98, 0x97, 0xB3, 0xB8, 0xE2,
+    0xD2, 0x42, 0x44, 0xEA, 0xD5, 0xB8, 0x1B, 0x4C, 0xC3, 0xEE, 0x60, 0x92, 0xF9, 0xEF, 0x85, 0xB9,
+    0xE4, 0x1A, 0xDB, 0x7F, 0xDF, 0xA4, 0xF7, 0x75, 0xFA, 0xFF, 0xD5, 0x91, 0x37, 0x7F, 0xA1, 0x78,
+    0xC5, 0x31, 0x95, 0xFB, 0x7E, 0xBF, 0x00, 0x95, 0x54, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x9D, 0x3D,
+    0x42, 0x21, 0x60, 0x16, 0x4C, 0xA3, 0x22, 0x29, 0xC2, 0x36, 0x1D, 0x3F, 0x81, 0x44, 0x5C, 0xBA,
+    0x51, 0xE1, 0x43, 0x0A, 0xD5, 0x2A, 0x9C, 0xC6, 0x9F, 0x40, 0xDA, 0x40, 0x90, 0xC2, 0x45, 0x54,
+    0xA4, 0x73, 0x93, 0xC6, 0x80, 0x91, 0x14, 0xFA, 0x83, 0x2C, 0x63, 0x17, 0x29, 0x54, 0x98, 0x88,
+    0x8B, 0x14, 0x6E, 0x68, 0x08, 0x8E, 0x01, 0xBB, 0xF0, 0xDA, 0x60, 0x90, 0x55, 0x42, 0xEE, 0xF3,
+    0x9B, 0x3D, 0x1E, 0x12, 0x40, 0x36, 0x74, 0x3A, 0xDC, 0x1E, 0xE6, 0x66, 0x67, 0x66, 0x67, 0xDE,
+    0xBC, 0x19, 0x8B, 0x12, 0xA7, 0x78, 0x87, 0x87, 0xB6, 0x2D, 0x87, 0xCC, 0xAF, 0x82, 0xEC, 0x2C,
+    0xD0, 0x6B, 0xB2, 0xD8, 0x5B, 0xD7, 0xB6, 0x93, 0x74, 0x16, 0xA9, 0x06, 0x59, 0x41, 0x24, 0x1F,
+    0x45, 0x40, 0xCD, 0x44, 0x4D, 0x1F, 0x35, 0x85, 0xA3, 0xA6, 0x95, 0x6C, 0xA3, 0x49, 0xC2, 0xA2,
+    0xA9, 0x25, 0xA7, 0xA6, 0xE9, 0xA2, 0xA6, 0x74, 0x62, 0x54, 0xE3, 0x45, 0x18, 0x2E, 0x61, 0x38,
+    0x1A, 0xE3, 0x7B, 0x9C, 0xC1, 0xFF, 0x7C, 0x85, 0x9C, 0x16, 0x81, 0x5E, 0x08, 0x15, 0xBE, 0x5D,
+    0xD7, 0x62, 0x98, 0x8E, 0xE4, 0x4E, 0xE2, 0xDB, 0x4C, 0xA7, 0xE3, 0x3F, 0x26, 0x23, 0xD6, 0x8A,
+    0x24, 0x5E, 0x5F, 0x7E, 0xC4, 0x2C, 0x42, 0xE2, 0x25, 0x75, 0x99, 0x93, 0xAA, 0xCB, 0x07, 0x33,
+    0x4B, 0xD9, 0xD1, 0xA5, 0x6A, 0x9B, 0x5A, 0x6C, 0xC2, 0x6B, 0x5C, 0x3B, 0x16, 0xF3, 0xB0, 0x02,
+    0x26, 0x00, 0x6F, 0xD7, 0xEB, 0xB5, 0x7C, 0xF3, 0x63, 0x82, 0x36, 0xA3, 0xE1, 0xA8, 0x15, 0xFC,
+    0x22, 0x7B, 0x47, 0x2C, 0x05, 0x93, 0x58, 0xA0, 0xCB, 0x69, 0xB7, 0xFA, 0x2B, 0x63, 0x39, 0x62,
+    0xF9, 0x66, 0xE1, 0xC5, 0x1C, 0x06, 0xC3, 0x9B, 0xBB, 0xF4, 0x3E, 0x43, 0xB0, 0xE7, 0xE8, 0xD3,
+    0x60, 0x07, 0x83, 0x93, 0x51, 0xEC, 0xEB, 0x20, 0xCD, 0x39, 0x5E, 0x58, 0xE6, 0x0B, 0x7C, 0x07,
+    0x14, 0x43, 0xA3, 0xD9, 0x1C, 0x88, 0xEC, 0x33, 0x40, 0xA6, 0x48, 0x68, 0x94, 0x0F, 0x09, 0xE6,
+    0x07, 0xB1, 0x4F, 0xE1, 0xB2, 0x19, 0xE8, 0x19, 0x1E, 0x19, 0x5E, 0xC1, 0xDB, 0x71, 0xC5, 0x8E,
+    0x12, 0x5B, 0x3B, 0x08, 0x9E, 0x05, 0x9A, 0xD1, 0xD8, 0x3E, 0x9B, 0x55, 0xD8, 0x68, 0xF2, 0xD9,
+    0x3A, 0x43, 0x9B, 0xB6, 0x9A, 0xD4, 0xEB, 0x06, 0x8F, 0xB3, 0x4F, 0x30, 0x65, 0xBE, 0x24, 0x1E,
+    0xB2, 0xCF, 0x63, 0x6E, 0x89, 0xDC, 0x86, 0x5F, 0xB1, 0x92, 0x0C, 0xF0, 0x39, 0x7E, 0x72, 0xE5,
+    0x24, 0x9F, 0x56, 0x04, 0xB3, 0x22, 0x96, 0x8D, 0x9E, 0x61, 0x39, 0x6E, 0xA3, 0xD3, 0xBB, 0x72,
+    0x96, 0x2F, 0x73, 0xBC, 0x51, 0x9F, 0x49, 0x7D, 0xA5, 0x04, 0x2D, 0x6E, 0x6A, 0x33, 0xB5, 0x98,
+    0x54, 0xC3, 0xAB, 0xCF, 0x05, 0xE1, 0x88, 0x02, 0xA6, 0x66, 0xA8, 0xF0, 0x77, 0x20, 0x7C, 0x78,
+    0x8E, 0x7F, 0x08, 0xC8, 0x64, 0x08, 0x57, 0x9D, 0x05, 0x3E, 0xD1, 0xBC, 0x04, 0x79, 0x42, 0xCB,
+    0xEA, 0x65, 0x50, 0x81, 0xDD, 0xA1, 0x26, 0x0D, 0x7C, 0xD5, 0x9E, 0xA1, 0x2B, 0x42, 0x81, 0x37,
+    0x18, 0xE8, 0x19, 0x12, 0xA0, 0x22, 0x39, 0xEF, 0x04, 0xD9, 0xD3, 0x77, 0xCD, 0x03, 0xBE, 0x82,
+    0x20, 0x31, 0x1D, 0x96, 0xEB, 0x72, 0x5A, 0x7C, 0x85, 0x36, 0x9F, 0x98, 0x74, 0xF3, 0x98, 0x31,
+    0xE6, 0x86, 0x6E, 0x7F, 0xF0, 0x2C, 0x82, 0x6C, 0xEA, 0x49, 0xB4, 0x7F, 0x2C, 0xDA, 0x08, 0xCE,
+    0x0F, 0xC7, 0x94, 0x57, 0x75, 0x01, 0x8C, 0x2C, 0x89, 0x0D, 0x30, 0x6C, 0x8F, 0x21, 0xBB, 0x1A,
+    0x74, 0xAC, 0x95, 0x4C, 0xF5, 0x06, 0x7F, 0x1E, 0x67, 0x4A, 0xA7, 0x31, 0x76, 0x87, 0xA6, 0x77,
+    0x98, 0x0C, 0xDD, 0xFC, 0x35, 0xBC, 0x3A, 0x5E, 0x31, 0x98, 0x36, 0x6E, 0xB9, 0xDD, 0xED, 0xAF,
+    0x7C, 0x72, 0xA0, 0x64, 0x7D, 0xAA, 0x25, 0x35, 0xB1, 0xB6, 0x02, 0xF7, 0x89, 0x48, 0x97, 0xC7,
+    0xB2, 0x63, 0xFD, 0x11, 0x88, 0xB0, 0x85, 0x06, 0x0B, 0x34, 0x11, 0x35, 0x85, 0x8F, 0x38, 0x22,
+    0x02, 0x1A, 0x91, 0x15, 0xEB, 0x69, 0x76, 0x33, 0x82, 0x4E, 0x2E, 0x90, 0x08, 0x5F, 0xD4, 0x29,
+    0x7E, 0xE5, 0xB5, 0x67, 0xBE, 0x30, 0x3C, 0xED, 0xCA, 0x86, 0x76, 0x57, 0xE6, 0x79, 0x65, 0x9E,
+    0x53, 0x0E, 0xDD, 0xC3, 0xB9, 0x9D, 0xAC, 0x37, 0x91, 0x79, 0xA4, 0xD7, 0x96, 0x79, 0xC3, 0x96,
+    0x79, 0xFD, 0xE5, 0xC2, 0x5E, 0x3A, 0x73, 0x18, 0x9A, 0xFE, 0x40, 0x5F, 0x79, 0x1D, 0x3E, 0xF6,
+    0x65, 0x5B, 0xB9, 0x6D, 0xEC, 0x40, 0xB0, 0x9B, 0x5E, 0xC7, 0x44, 0x62, 0x56, 0x4C, 0xEE, 0x8A,
+    0x3F, 0x05, 0x93, 0x7F, 0xA2, 0x8B, 0x22, 0x0B, 0xB5, 0x16, 0x6C, 0x74, 0x2D, 0x44, 0x6C, 0x38,
+    0xB1, 0x1B, 0x7A, 0x5E, 0x54, 0x11, 0xD1, 0x36, 0x0F, 0xCA, 0xD6, 0xA1, 0xE0, 0x58, 0x50, 0xA5,
+    0xB3, 0x74, 0x2F, 0xD2, 0xC8, 0x49, 0xF1, 0x2F, 0x94, 0x13, 0x81, 0x8E, 0x64, 0x49, 0xAA, 0x94,
+    0x2B, 0x02, 0x39, 0x44, 0x62, 0x13, 0x9B, 0xB6, 0x19, 0xE9, 0x68, 0x1D, 0x63, 0xC1, 0x2D, 0xB1,
+    0x0C, 0xFA, 0xFD, 0x1B, 0x33, 0x01, 0xB8, 0xF4, 0x2B, 0xF2, 0x59, 0x2D, 0xB7, 0xA4, 0x7C, 0xAE,
+    0x14, 0x8F, 0xC8, 0x9F, 0x01, 0x8F, 0x10, 0x3F, 0xA3, 0xC5, 0x09, 0xC2, 0x6D, 0x94, 0x3A, 0x45,
+    0x71, 0xFC, 0x8B, 0x59, 0xAA, 0x77, 0x68, 0xD3, 0xED, 0x22, 0xE8, 0x12, 0x90, 0x5D, 0xE4, 0x35,
+    0x4E, 0x67, 0xDD, 0xBB, 0xBC, 0xAC, 0x93, 0x78, 0xD9, 0x5F, 0xF5, 0x92, 0xB3, 0xF1, 0x79, 0x9D,
+    0xF9, 0x0A, 0x2D, 0x97, 0x06, 0x77, 0x0E, 0xD9, 0x63, 0xC9, 0x4B, 0xEE, 0x93, 0x62, 0x8A, 0x9D,
+    0x8F, 0x14, 0xB8, 0x4A, 0xE7, 0x55, 0xE8, 0xC5, 0x1C, 0x29, 0xE0, 0x44, 0xBC, 0xE4, 0x3A, 0xE3,
+    0xB8, 0xA2, 0xCF, 0xF1, 0x35, 0x3A, 0xEB, 0x12, 0x5C, 0x27, 0xBE, 0xE0, 0xDB, 0xF9, 0xA4, 0xEC,
+    0x7E, 0x4B, 0x1B, 0xFC, 0x46, 0xD2, 0xA3, 0x50, 0x15, 0x13, 0xAA, 0x9C, 0x7A, 0xDC, 0xE5, 0x64,
+    0xCC, 0x09, 0x77, 0xA0, 0xD3, 0x69, 0x55, 0xF8, 0x1D, 0x67, 0x69, 0xBB, 0xD2, 0x08, 0x9F, 0x26,
+    0x5D, 0x33, 0xE9, 0x39, 0x8B, 0x2B, 0x2F, 0x9C, 0xB0, 0x71, 0x75, 0x19, 0x93, 0x3E, 0x0D, 0x17,
+    0x92, 0x5E, 0x34, 0x5A, 0x0F, 0x0B, 0xF3, 0x09, 0x2B, 0x8C, 0x48, 0xB3, 0x66, 0x82, 0xDF, 0xD9,
+    0xDF, 0x31, 0x70, 0x10, 0x0E, 0x3E, 0x3A, 0x23, 0x8B, 0xB0, 0x1D, 0xE3, 0xC7, 0xFF, 0x1F, 0xE3,
+    0xC3, 0x5D, 0xC6, 0xB8, 0xD9, 0x61, 0x8C, 0x3F, 0xB8, 0x4D, 0xFF, 0x13, 0x2E, 0xFD, 0xBC, 0x07,
+    0x95, 0x55, 0xBF, 0x6F, 0xDE, 0x54, 0x14, 0xBD, 0xB6, 0x9B, 0x18, 0xE4, 0xC1, 0x5D, 0x52, 0x84,
+    0x2A, 0xE1, 0x15, 0x89, 0xC1, 0xFF, 0x00, 0xF0, 0x4C, 0x33, 0x30, 0x74, 0x68, 0x06, 0x50, 0x47,
+    0xF6, 0x2C, 0x59, 0x19, 0xDA, 0xDA, 0xA4, 0x43, 0x87, 0x0E, 0x04, 0x09, 0xFE, 0x03, 0x16, 0x12,
+    0x41, 0x57, 0x84, 0x0A, 0x36, 0xCD, 0x90, 0x21, 0x43, 0x5D, 0x05, 0xCA, 0xD0, 0x01, 0xA3, 0xA4,
+    0x4B, 0x3B, 0xC4, 0x83, 0x05, 0x0E, 0xBC, 0xF7, 0x0E, 0xE7, 0xDA, 0x5F, 0x14, 0x5A, 0x8A, 0x80,
+    0xA7, 0xEF, 0xF9, 0xB3, 0xFD, 0xDE, 0xBB, 0x3F, 0xCE, 0x39, 0xF7, 0x5A, 0xE4, 0xD5, 0xBC, 0xAD,
+    0x1F, 0x8D, 0xF5, 0xAF, 0xA8, 0x6D, 0x0D, 0xE4, 0x68, 0x2F, 0xA3, 0x0A, 0xD1, 0x48, 0xDD, 0x49,
+    0x3E, 0x48, 0xE2, 0x24, 0x44, 0x21, 0x75, 0xFB, 0xA2, 0x07, 0x91, 0x0B, 0x9F, 0x4A, 0x02, 0xFF,
+    0x0E, 0x80, 0x14, 0x18, 0xCA, 0x2E, 0xF9, 0x9E, 0xEB, 0x31, 0x67, 0x0A, 0x6E, 0xC2, 0xC8, 0xE9,
+    0x24, 0x83, 0x9E, 0xB3, 0x22, 0x75, 0xCF, 0xF9, 0x90, 0xF7, 0x1F, 0x3C, 0xDE, 0xB0, 0x25, 0xF0,
+    0x0B, 0xE0, 0x43, 0x70, 0xE7, 0x52, 0x21, 0x3A, 0x62, 0x5D, 0x17, 0x49, 0x7B, 0x09, 0xD4, 0x0D,
+    0xAC, 0x01, 0x76, 0x01, 0xFB, 0x06, 0xB6, 0x2B, 0xD3, 0x4B, 0x04, 0x91, 0x7F, 0xFE, 0x2B, 0xE8,
+    0xEB, 0xCB, 0x80, 0xD6, 0x12, 0xBA, 0xCB, 0x99, 0xC0, 0xD2, 0x64, 0x93, 0x61, 0xA6, 0x96, 0x11,
+    0x63, 0xFF, 0x7F, 0xDD, 0x78, 0xC9, 0x6D, 0x3D, 0xC4, 0xD8, 0xC3, 0x1F, 0x53, 0x18, 0x68, 0x80,
+    0x43, 0x1B, 0x62, 0x30, 0x8D, 0xAC, 0xC9, 0x3C, 0xB8, 0x31, 0xB3, 0x65, 0x2F, 0x66, 0x60, 0x00,
+    0xA6, 0x27, 0x26, 0x65, 0x97, 0x5A, 0x41, 0x33, 0x5D, 0x62, 0xC7, 0x24, 0x22, 0xE6, 0xC7, 0x7C,
+    0x23, 0xCF, 0x8C, 0xDE, 0x25, 0x60, 0xB8, 0xAD, 0x30, 0xDC, 0x1F, 0x19, 0xF3, 0x31, 0x93, 0x35,
+    0xE0, 0x25, 0x23, 0x00, 0xC4, 0xAB, 0x61, 0xAC, 0xA8, 0x64, 0x42, 0x6F, 0x31, 0xB2, 0x41, 0x21,
+    0xC3, 0xAE, 0x17, 0xE3, 0xC4, 0x74, 0x34, 0x8C, 0x2A, 0x1B, 0xF2, 0x3E, 0x46, 0x9F, 0xD8, 0xD8,
+    0x85, 0xDE, 0x32, 0x7B, 0x54, 0xBE, 0x2C, 0x40, 0x7C, 0xCC, 0xC7, 0x5D, 0xD9, 0xC6, 0x2E, 0x3B,
+    0xB0, 0x39, 0x0F, 0xDD, 0xEE, 0xEB, 0x74, 0x14, 0x73, 0x68, 0xB3, 0x03, 0x27, 0x89, 0xF5, 0xD1,
+    0x09, 0x18, 0x83, 0x29, 0x7C, 0xDD, 0xD0, 0x77, 0x93, 0x1F, 0x77, 0xF4, 0x49, 0x4B, 0x03, 0xDF,
+    0x8E, 0xA2, 0xEC, 0xA8, 0x0F, 0xAF, 0x91, 0xF0, 0x57, 0x30, 0xE8, 0x46, 0x55, 0x30, 0x0D, 0x43,
+    0x43, 0x43, 0xC6, 0xA4, 0xBA, 0xD4, 0x07, 0x68, 0x22, 0xAC, 0xA2, 0x08, 0x14, 0x23, 0xC1, 0x74,
+    0x90, 0x46, 0x98, 0x45, 0xB7, 0xC8, 0x42, 0xA9, 0x9F, 0x33, 0xAB, 0x75, 0x15, 0xF7, 0x1D, 0xD9,
+    0xB9, 0x05, 0x66, 0x47, 0x83, 0xA9, 0x13, 0xB4, 0xB4, 0x57, 0xF6, 0xCC, 0xCC, 0xD8, 0x19, 0xC7,
+    0x6E, 0xC6, 0x31, 0x5F, 0xE0, 0x38, 0xCE, 0x38, 0xD6, 0x6D, 0x32, 0xE1, 0x48, 0x97, 0x55, 0x84,
+    0x19, 0x47, 0x92, 0x8D, 0x5B, 0xC4, 0xB1, 0xDE, 0xE7, 0xD1, 0x72, 0xC6, 0x91, 0xCE, 0x73, 0xF5,
+    0x96, 0x6A, 0x04, 0x89, 0x46, 0x10, 0xEB, 0x45, 0x15, 0x31, 0xA9, 0x43, 0x62, 0x06, 0x4A, 0x5E,
+    0x79, 0x29, 0xED, 0x22, 0x32, 0xA3, 0x7B, 0x8D, 0xEE, 0xA0, 0xB7, 0x69, 0x50, 0x87, 0xD8, 0x87,
+    0x16, 0x00, 0xEC, 0xFA, 0x36, 0x97, 0x27, 0x61, 0x0D, 0x7C, 0x5F, 0x31, 0x3A, 0xBA, 0x6D, 0x24,
+    0x75, 0x53, 0xAC, 0xF1, 0x5F, 0x15, 0x07, 0xC7, 0x33, 0xBF, 0x71, 0xFE, 0xCC, 0x59, 0x48, 0xF0,
+    0x95, 0xE2, 0x67, 0xA0, 0x48, 0x96, 0x9D, 0x94, 0xCD, 0xF3, 0x3F, 0x34, 0xAF, 0xA0, 0xAA, 0x21,
+    0xF5, 0x91, 0xD4, 0x4E, 0x4A, 0xC5, 0x91, 0xA5, 0xD6, 0xBC, 0x60, 0x67, 0x79, 0xA2, 0x76, 0x72,
+    0x4C, 0xFE, 0xE8, 0xF8, 0x5F, 0xC6, 0xFA, 0x37, 0xAC, 0x18, 0xEA, 0xC5, 0xAA, 0xDD, 0x98, 0x90,
+    0x3F, 0xF7, 0xF3, 0x9A, 0x50, 0x88, 0x1F, 0xA4, 0xF6, 0x72, 0x91, 0xC1, 0x11, 0x55, 0x17, 0xAA,
+    0x40, 0xFF, 0xB6, 0xD3, 0xC9, 0x86, 0x9B, 0xEC, 0x8C, 0xAA, 0x70, 0x8E, 0xE0, 0x3D, 0xC5, 0xF5,
+    0x48, 0x76, 0x80, 0x27, 0xBF, 0x33, 0x4D, 0xFF, 0x75, 0x0C, 0xAC, 0x49, 0xE2, 0x17, 0x32, 0x2D,
+    0x6F, 0xE2, 0x8A, 0x37, 0x43, 0xD9, 0x9C, 0x9F, 0x9E, 0x3E, 0x42, 0x6C, 0xB3, 0xBE, 0xBC, 0x87,
+    0x84, 0x42, 0xAC, 0x77, 0x91, 0x5A, 0x33, 0xE0, 0x00, 0x57, 0x9C, 0x99, 0xA1, 0x4E, 0x49, 0x8E,
+    0xA1, 0x55, 0xAF, 0x25, 0x3E, 0xB2, 0x6F, 0x74, 0xB4, 0x99, 0xE0, 0xA1, 0xE5, 0xBA, 0xA2, 0xA1,
+    0x76, 0x59, 0x4B, 0xEA, 0x5C, 0xBB, 0x8D, 0x3E, 0x66, 0x3C, 0x49, 0x81, 0x08, 0xFA, 0xE0, 0x13,
+    0x6E, 0x5E, 0x85, 0xC6, 0x8E, 0x21, 0xA8, 0x49, 0x8E, 0x21, 0x89, 0xE4, 0x27, 0xE2, 0xF2, 0xD2,
+    0x69, 0xE5, 0x6C, 0x60, 0x4B, 0xB9, 0xA9, 0x12, 0x90, 0x6C, 0x1E, 0x20, 0x83, 0xC1, 0x56, 0x38,
+    0xD1, 0xDD, 0x2B, 0xD5, 0x32, 0xDF, 0x28, 0x85, 0x89, 0xF2, 0xC6, 0xC6, 0x37, 0x4C, 0x37, 0x57,
+    0xF1, 0xD9, 0xDA, 0xD9, 0x1E, 0xD3, 0x2F, 0x14, 0xA4, 0x38, 0xA8, 0x50, 0x74, 0x8F, 0xE3, 0x66,
+    0x3C, 0x3A, 0xBD, 0x99, 0x00, 0x8A, 0x1A, 0x79, 0x2D, 0xF4, 0x38, 0xEE, 0xF8, 0x66, 0xE4, 0x9E,
+    0x91, 0xC5, 0x4E, 0xE9, 0x8A, 0xA9, 0x4C, 0x91, 0xF4, 0x69, 0x1B, 0xDA, 0x68, 0x14, 0x2F, 0x75,
+    0x51, 0x17, 0x19, 0x3B, 0x09, 0xA7, 0x4D, 0xB5, 0xA5, 0x8C, 0xEB, 0x97, 0x9B, 0x73, 0x22, 0x95,
+    0x36, 0x92, 0x13, 0x66, 0xCE, 0x66, 0x47, 0xA2, 0x48, 0x49, 0xDE, 0xAB, 0xF4, 0xAB, 0x74, 0xE4,
+    0x5F, 0xDE, 0x9B, 0x4E, 0xCC, 0x03, 0x2C, 0xFA, 0x06, 0x28, 0x96, 0x10, 0x5E, 0x03, 0xEB, 0x25,
+    0xBC, 0x83, 0x27, 0x14, 0x1C, 0xCB, 0xCC, 0x68, 0xA6, 0x2B, 0xF8, 0x71, 0x0E, 0x78, 0xF9, 0x8E,
+    0xFF, 0x7C, 0x7E, 0xA5, 0x6E, 0x82, 0xAB, 0x78, 0x7F, 0x51, 0x00, 0x9A, 0x91, 0x4A, 0xF9, 0x59,
+    0x39, 0xCD, 0xA0, 0xAD, 0x3F, 0x23, 0x27, 0x59, 0x59, 0xD3, 0x06, 0x4E, 0xE3, 0xF7, 0xB0, 0x63,
+    0x4D, 0xB3, 0xBC, 0xAA, 0xB5, 0xD3, 0x91, 0x21, 0xAD, 0x80, 0x8E, 0xD4, 0x75, 0xD9, 0x53, 0xDC,
+    0xB4, 0xB1, 0x35, 0x15, 0x5B, 0x8E, 0x78, 0xD3, 0x65, 0x0F, 0x70, 0x60, 0x29, 0x8D, 0x8A, 0x8D,
+    0x45, 0x2E, 0x92, 0x1A, 0xFD, 0x44, 0xE4, 0x3C, 0xE2, 0x3F, 0x14, 0xF3, 0x13, 0xBF, 0x2F, 0x6C,
+    0xF9, 0x6C, 0xD0, 0x95, 0xAC, 0xCC, 0x5D, 0x45, 0x5C, 0xBD, 0x09, 0x6C, 0xA2, 0x2C, 0xDC, 0x39,
+    0x39, 0x7F, 0xDA, 0xF4, 0x96, 0x71, 0xA2, 0x35, 0x4B, 0x7C, 0xC9, 0x02, 0xB5, 0xCA, 0x9C, 0x79,
+    0x97, 0x10, 0x03, 0xB9, 0xB0, 0x96, 0x57, 0x31, 0xE1, 0x6B, 0xBF, 0x15, 0xB6, 0x66, 0x1B, 0xF5,
+    0x19, 0x97, 0x8A, 0x6C, 0xB5, 0xCB, 0xC9, 0xEC, 0xF8, 0xA6, 0x4A, 0x20, 0xD9, 0x6B, 0x6E, 0xF0,
+    0xF8, 0xB5, 0x6B, 0x31, 0x99, 0x89, 0xF7, 0x9A, 0xEB, 0x67, 0x0F, 0xBB, 0xCD, 0xDB, 0x7C, 0xB8,
+    0xFB, 0x96, 0x6E, 0x4B, 0x37, 0xFB, 0x8C, 0xBD, 0x76, 0x48, 0x0B, 0xEC, 0x34, 0xB9, 0xDC, 0xE5,
+    0xE7, 0x29, 0x6E, 0xA3, 0x3E, 0xFC, 0x22, 0xB0, 0x92, 0x35, 0xD3, 0x57, 0xA8, 0xDC, 0xD2, 0x2A,
+    0x64, 0x9E, 0xDA, 0x2A, 0x34, 0x5D, 0x0D, 0x6E, 0xE5, 0x34, 0xC6, 0x36, 0xC5, 0x90, 0xEE, 0x58,
+    0x95, 0xDE, 0xBA, 0xE3, 0x17, 0x27, 0x7F, 0xEC, 0x4C, 0xE1, 0xCC, 0x25, 0x67, 0x8E, 0x5D, 0x86,
+    0xEB, 0xCB, 0x47, 0xAF, 0xCB, 0x4B, 0xF2, 0xB2, 0xC8, 0x77, 0x72, 0x83, 0x0A, 0x66, 0x09, 0x97,
+    0xBD, 0xE9, 0x23, 0x36, 0xB0, 0xC2, 0x0C, 0xF9, 0x18, 0xE1, 0x12, 0x9A, 0x7C, 0x64, 0x5F, 0xD1,
+    0xD7, 0x6C, 0x2A, 0x14, 0x37, 0xDA, 0xE9, 0xC2, 0x06, 0xC3, 0x6F, 0x4D, 0xCB, 0x9E, 0x47, 0xE2,
+    0x06, 0x61, 0x7B, 0x56, 0x6A, 0xB6, 0xB7, 0xB7, 0x37, 0x48, 0xE5, 0x53, 0xCE, 0xA9, 0x02, 0x15,
+    0x3E, 0xC6, 0x9F, 0x32, 0xA8, 0x48, 0xAB, 0xEA, 0xEC, 0x85, 0xC1, 0x21, 0xFC, 0x74, 0x91, 0xFF,
+    0x32, 0xFE, 0x04, 0xD5, 0x54, 0xBF, 0x8F, 0x1D, 0x35, 0x10, 0xFE, 0xF6, 0x2D, 0xB9, 0x45, 0x59,
+    0x21, 0xA7, 0x48, 0x1A, 0x28, 0xB6, 0x4F, 0xB3, 0xFF, 0x00, 0xC8, 0x9B, 0xA3, 0xA4, 0xE0, 0x8A,
+    0x7B, 0x34, 0xFC, 0x07, 0x29, 0xB8, 0x7F, 0x20, 0x62, 0x97, 0x5C, 0x71, 0xED, 0x49, 0x94, 0x69,
+    0xA8, 0x28, 0x5E, 0x0A, 0xDA, 0x14, 0xC7, 0xD9, 0x3A, 0x8A, 0xB4, 0xDB, 0xA5, 0xB8, 0x82, 0x57,
+    0x22, 0x51, 0x9C, 0x95, 0xAC, 0xC4, 0x86, 0xB3, 0x77, 0xF8, 0xC6, 0x2F, 0x07, 0x22, 0x12, 0x42,
+    0x82, 0x06, 0xFC, 0xD6, 0x9E, 0x79, 0xF6, 0xFC, 0xF8, 0xC6, 0x9E, 0x19, 0x60, 0x37, 0xF6, 0xE4,
+    0x35, 0xD7, 0x4A, 0x24, 0x01, 0xAB, 0x05, 0x1F, 0xCC, 0x00, 0xB9, 0x7A, 0x0B, 0x7B, 0x6B, 0x8D,
+    0x76, 0xA8, 0xBC, 0x08, 0xBE, 0xC7, 0x64, 0x24, 0x96, 0xA1, 0x41, 0xAC, 0xB7, 0xCD, 0xC7, 0x5B,
+    0xE3, 0x2D, 0xE6, 0x0F, 0xC1, 0x9D, 0xFA, 0xB9, 0x37, 0xFE, 0x4B, 0x3C, 0x7A, 0x84, 0x74, 0xE4,
+    0x2B, 0xFE, 0x91, 0xA0, 0x7F, 0x64, 0x41, 0xF5, 0x83, 0x37, 0x17, 0x01, 0x67, 0x1F, 0x21, 0x1A,
+    0x6F, 0x1E, 0x07, 0xE3, 0xD5, 0x4A, 0x47, 0x9D, 0x16, 0x67, 0xC6, 0x37, 0x27, 0x63, 0x19, 0x0E,
+    0xB1, 0x8E, 0x68, 0x3C, 0xE0, 0x80, 0xFE, 0x14, 0xBD, 0x72, 0x22, 0x5B, 0x28, 0xD1, 0x15, 0xF7,
+    0x38, 0xEF, 0x6F, 0x36, 0x9B, 0xAF, 0x85, 0xC3, 0x72, 0xBE, 0xE4, 0x9F, 0x0D, 0x37, 0x57, 0x32,
+    0xD0, 0x95, 0x95, 0xD8, 0x3F, 0x48, 0xE7, 0x38, 0x3F, 0x47, 0xCF, 0x95, 0x3C, 0x77, 0x8C, 0x4C,
+    0x3C, 0x55, 0xED, 0x72, 0x02, 0x0A, 0x06, 0x83, 0xBE, 0x03, 0x9A, 0x91, 0x51, 0xEE, 0x36, 0xF6,
+    0x36, 0x6E, 0xF3, 0x2D, 0x8D, 0x2D, 0x74, 0x26, 0xDF, 0x89, 0x7A, 0x7C, 0x4B, 0xE2, 0x0F, 0x95,
+    0xE2, 0x00, 0xEF, 0xD3, 0xE5, 0x13, 0x4A, 0xFD, 0x7A, 0xA3, 0x32, 0x60, 0x8D, 0x5A, 0xB6, 0x56,
+    0xA6, 0xF6, 0x2A, 0xDE, 0x2E, 0x23, 0xF8, 0x55, 0x33, 0x4C, 0x80, 0x1D, 0x21, 0x5D, 0x99, 0x60,
+    0x26, 0x58, 0x49, 0xBB, 0x4F, 0x91, 0xBC, 0x91, 0x9F, 0x9B, 0x27, 0xF1, 0x9D, 0x22, 0x62, 0x15,
+    0xF1, 0x39, 0x41, 0xFA, 0x95, 0x4C, 0xD8, 0xA3, 0xC0, 0x72, 0x07, 0x8B, 0x7D, 0xAA, 0xE0, 0x5B,
+    0x62, 0x59, 0x03, 0x9B, 0xD3, 0x36, 0x56, 0x02, 0x19, 0xEC, 0x58, 0x85, 0xFC, 0x4C, 0x75, 0xE2,
+    0xE7, 0x46, 0xB8, 0xCB, 0xBF, 0x67, 0x84, 0x8C, 0x49, 0x6E, 0x4B, 0x46, 0xD0, 0x24, 0x37, 0x95,
+    0x64, 0xAE, 0x25, 0x29, 0xF6, 0x4B, 0x91, 0x57, 0xC9, 0x5D, 0xC5, 0xF6, 0x32, 0xDD, 0xE5, 0x35,
+    0x8F, 0xD9, 0xF2, 0x5F, 0x31, 0x0C, 0x7F, 0xBD, 0x3E, 0xA8, 0xA9, 0xC6, 0xFC, 0x90, 0xA0, 0xE1,
+    0xB7, 0x22, 0xFB, 0xAF, 0x84, 0x91, 0xDB, 0x1B, 0xA6, 0x27, 0xF3, 0xCB, 0x9F, 0x76, 0x94, 0x79,
+    0xA9, 0x8C, 0x21, 0x13, 0x7A, 0x32, 0x7C, 0xCF, 0xFD, 0x80, 0x82, 0x0C, 0x9A, 0x7F, 0xC4, 0xE4,
+    0xD1, 0x1F, 0xCB, 0xA7, 0x8B, 0x9D, 0x9C, 0xBF, 0x8B, 0x6A, 0x5C, 0xCD, 0x84, 0xC8, 0x8B, 0x77,
+    0x8D, 0x3C, 0x97, 0x51, 0x4E, 0x79, 0xDE, 0x7A, 0x1B, 0xFA, 0xE8, 0xA4, 0xB9, 0xBA, 0x38, 0x09,
+    0xBC, 0x66, 0xC7, 0x9D, 0x3A, 0xAC, 0x6E, 0x98, 0x6C, 0xA3, 0x90, 0xA1, 0x96, 0xA9, 0xB9, 0x8E,
+    0xD6, 0x2F, 0xB6, 0x73, 0xB6, 0xEB, 0xF3, 0xE7, 0x5A, 0xBF, 0x30, 0xC5, 0x2B, 0xA6, 0xEF, 0x17,
+    0xDD, 0x0A, 0x45, 0x87, 0x9E, 0xBF, 0x6A, 0x29, 0x05, 0xF5, 0xC2, 0x97, 0x30, 0xA9, 0x5E, 0x60,
+    0xA2, 0x49, 0x68, 0x74, 0x69, 0xE7, 0x86, 0x56, 0xB7, 0x7D, 0xC8, 0x87, 0x7D, 0xB0, 0xBC, 0xE2,
+    0x52, 0x3A, 0x3B, 0xB5, 0x73, 0x21, 0x9D, 0x78, 0x3C, 0xC3, 0x19, 0xD0, 0xA9, 0xC3, 0x76, 0x80,
+    0xBA, 0x66, 0xD2, 0x34, 0x5B, 0x96, 0xD9, 0x00, 0xEB, 0xD1, 0x92, 0x30, 0xC1, 0x6C, 0x3F, 0x40,
+    0x80, 0xF7, 0xEC, 0xB0, 0xD2, 0x1B, 0xB7, 0x03, 0xC3, 0x51, 0x92, 0xA1, 0xDA, 0xC1, 0x6C, 0x33,
+    0xB1, 0xFE, 0x16, 0x45, 0x87, 0x9E, 0xB9, 0x40, 0x22, 0xFA, 0x30, 0xF6, 0xAB, 0x54, 0x08, 0xC9,
+    0x71, 0x2C, 0x49, 0xEE, 0x7D, 0x32, 0xD5, 0x57, 0x7C, 0x2D, 0x13, 0x9A, 0x23, 0x92, 0x76, 0xB4,
+    0xED, 0xA8, 0x8A, 0x67, 0x4A, 0xA4, 0x98, 0x49, 0x0A, 0x06, 0xC2, 0x4C, 0x2C, 0x63, 0x26, 0xD5,
+    0x54, 0x6C, 0xDC, 0x4F, 0x9A, 0xAF, 0x14, 0xD6, 0x2F, 0x93, 0x7F, 0x8F, 0xF3, 0x61, 0xC6, 0x79,
+    0xC2, 0xA4, 0x26, 0xCE, 0x46, 0xA2, 0xE2, 0x34, 0x3F, 0x27, 0xC5, 0xB9, 0x2A, 0x16, 0xC5, 0x99,
+    0x6B, 0x8B, 0x7E, 0xD5, 0x00, 0x7D, 0xD6, 0x93, 0x2A, 0xA2, 0xA5, 0x01, 0xDA, 0x77, 0x03, 0x71,
+    0xA2, 0x5C, 0xA0, 0xC7, 0xE6, 0xF5, 0xA1, 0x16, 0x23, 0xD3, 0x4D, 0xE5, 0x95, 0x28, 0x46, 0x92,
+    0xDD, 0x68, 0x92, 0x3E, 0x77, 0xC9, 0x3E, 0x43, 0x4D, 0x73, 0x1D, 0x15, 0xFB, 0xBB, 0x94, 0x27,
+    0x52, 0x18, 0x9F, 0xF1, 0x2D, 0x1A, 0x48, 0xC1, 0x7A, 0x12, 0x6D, 0x6F, 0x83, 0x56, 0xF6, 0x6D,
+    0xE7, 0x19, 0x15, 0x7D, 0x3E, 0x4E, 0xC5, 0x21, 0x35, 0x4D, 0x68, 0xC3, 0xB3, 0x6A, 0x76, 0x90,
+    0x0B, 0x91, 0x17, 0xB3, 0x61, 0x9A, 0x27, 0xEB, 0x5D, 0x2C, 0x36, 0x0F, 0x96, 0xF2, 0xC7, 0xA0,
+    0x50, 0xAD, 0x2A, 0xF4, 0xFB, 0x93, 0x28, 0x2A, 0x73, 0x9C, 0x71, 0x27, 0xBD, 0x39, 0x2D, 0x09,
+    0x75, 0xDB, 0xB0, 0x30, 0xE8, 0xF6, 0xFE, 0xD3, 0xA5, 0x53, 0xB7, 0x3C, 0xA2, 0x5B, 0xBD, 0x3C,
+    0x1C, 0xD0, 0xAF, 0x86, 0x2B, 0xBB, 0xC9, 0x04, 0x02, 0x93, 0xF6, 0xF7, 0xA1, 0x08, 0x54, 0x43,
+    0x67, 0xCD, 0x69, 0x67, 0xA2, 0x0D, 0x84, 0xEA, 0x61, 0x28, 0x6A, 0xF5, 0x6E, 0x68, 0xA9, 0xE7,
+    0xF3, 0xF4, 0x5B, 0xDC, 0xB1, 0xD3, 0xDE, 0xCC, 0xC2, 0x8A, 0xF4, 0xC7, 0x9C, 0x93, 0x19, 0x47,
+    0x4B, 0xC7, 0x4E, 0x96, 0xFB, 0x9C, 0x68, 0x50, 0xCC, 0xC7, 0x9C, 0x6F, 0x93, 0xAE, 0x55, 0xCC,
+    0x3E, 0xCE, 0xF1, 0xD6, 0x70, 0x19, 0x80, 0xC4, 0x5C, 0x09, 0x29, 0xEB, 0xEA, 0x95, 0x96, 0x8B,
+    0xAE, 0x75, 0xD4, 0xBE, 0x69, 0xA2, 0x9A, 0x33, 0xB3, 0xF3, 0x6A, 0x4C, 0x21, 0xD8, 0x60, 0x83,
+    0x82, 0x50, 0xD3, 0x6E, 0x6C, 0x68, 0x42, 0xBC, 0x89, 0xB9, 0x94, 0x12, 0x3B, 0x31, 0x01, 0xA9,
+    0x19, 0x1A, 0xD2, 0x2E, 0x21, 0x9D, 0xF6, 0x0B, 0x0A, 0x2C, 0xEB, 0xCF, 0xC4, 0xB3, 0x4C, 0x20,
+    0x23, 0x43, 0x83, 0x0B, 0x1A, 0x51, 0x1F, 0xFA, 0xA0, 0xA1, 0x6A, 0x7B, 0x6F, 0x15, 0xC5, 0xC3,
+    0x6F, 0x32, 0xA0, 0x6D, 0x86, 0xD2, 0xE1, 0x4D, 0xF3, 0x41, 0x93, 0xAB, 0xD5, 0x0E, 0xFF, 0x79,
+    0xFC, 0xFF, 0xDB, 0xF1, 0x1B, 0xD5, 0x55, 0xB1, 0x8E, 0xD4, 0x30, 0x10, 0x1D, 0xAF, 0xA5, 0x5B,
+    0x89, 0x14, 0xB9, 0x9E, 0x22, 0xFD, 0x35, 0xFE, 0x02, 0x48, 0x3A, 0x4A, 0x28, 0x58, 0x3E, 0xE2,
+    0x0A, 0xEE, 0x13, 0x12, 0x2A, 0x8A, 0x6B, 0xB6, 0xA1, 0xBF, 0x82, 0xE2, 0x74, 0x35, 0xBD, 0x23,
+    0xDD, 0x07, 0x90, 0x86, 0x3E, 0x35, 0x14, 0x17, 0x89, 0x20, 0x05, 0xC9, 0xC9, 0xF0, 0x9E, 0x93,
+    0xC0, 0x9D, 0x68, 0xD8, 0x62, 0xA5, 0xC3, 0x9B, 0x7D, 0xDE, 0x59, 0xDB, 0x6F, 0x9E, 0xC7, 0x33,
+    0x8E, 0xC8, 0xD9, 0x95, 0xA0, 0xF9, 0x00, 0xD8, 0xE8, 0x04, 0xDC, 0x8E, 0x5A, 0x88, 0x64, 0x5D,
+    0xDE, 0x88, 0xE4, 0x55, 0xD2, 0xC9, 0xC3, 0xE6, 0x07, 0xA2, 0x72, 0xBE, 0xD1, 0x11, 0x68, 0x55,
+    0x89, 0x13, 0x31, 0x09, 0x5A, 0x89, 0xA4, 0x41, 0x6B, 0xE0, 0xE0, 0x81, 0xAE, 0xCF, 0x5B, 0xF0,
+    0x74, 0x39, 0x78, 0xCA, 0xD6, 0xF5, 0x20, 0x68, 0x32, 0x50, 0x68, 0x9D, 0x06, 0x10, 0x54, 0xC9,
+    0x08, 0xB7, 0x0A, 0xC7, 0xA0, 0x01, 0xD1, 0x96, 0x58, 0x24, 0xC4, 0x3A, 0x9D, 0x76, 0x6F, 0xB4,
+    0xCE, 0xE0, 0x49, 0x9B, 0x1C, 0x4B, 0x7C, 0x97, 0x63, 0x79, 0xD9, 0x95, 0xA0, 0xCA, 0x07, 0x05,
+    0xAD, 0x0B, 0x8B, 0x28, 0x3B, 0x19, 0x0C, 0xA5, 0xFA, 0x0D, 0x43, 0x4E, 0x95, 0x13, 0x5E, 0x50,
+    0xC3, 0x33, 0x79, 0x2B, 0xFF, 0x83, 0xFE, 0xA4, 0x75, 0xD5, 0x1A, 0xF3, 0x19, 0xD3, 0xCE, 0xC1,
+    0xBB, 0xC1, 0xE7, 0x91, 0xEB, 0x77, 0x4D, 0xD4, 0x43, 0x55, 0xE6, 0x27, 0xF5, 0x6C, 0xBA, 0xE7,
+    0xBF, 0x71, 0x56, 0xF8, 0x88, 0xD4, 0xC6, 0x15, 0xF8, 0xAD, 0x71, 0xBD, 0x64, 0xEC, 0xBA, 0x99,
+    0x0D, 0x66, 0xF9, 0x55, 0x3F, 0xEC, 0x5E, 0x41, 0x57, 0x36, 0x07, 0xF9, 0x1D, 0xF5, 0x89, 0xEB,
+    0xA2, 0x69, 0xD5, 0x44, 0xB3, 0x6C, 0xB2, 0x71, 0xF7, 0x1A, 0xB2, 0x0D, 0xDD, 0xE2, 0x3F, 0x90,
+    0x04, 0x68, 0x8E, 0xE6, 0x76, 0x92, 0x6C, 0xBA, 0xB9, 0x16, 0x0F, 0x83, 0x7B, 0x43, 0x37, 0x48,
+    0xD4, 0x4C, 0x33, 0x9F, 0xCD, 0x84, 0x52, 0x2B, 0xEE, 0x4A, 0xC8, 0x8C, 0x2F, 0xD7, 0x7E, 0x5F,
+    0xF4, 0x40, 0x30, 0x4D, 0x46, 0x2B, 0x8B, 0xAA, 0xD8, 0x8C, 0xD7, 0x3D, 0xD9, 0x82, 0x94, 0x00,
+    0x8E, 0x0F, 0x56, 0xFB, 0x93, 0x2E, 0x41, 0xAD, 0x9E, 0xA6, 0x2C, 0xDB, 0x98, 0x4B, 0xDC, 0xB8,
+    0x70, 0xDF, 0xC2, 0x08, 0xFE, 0x05, 0xFD, 0x3A, 0x25, 0x4E, 0xCE, 0x78, 0x1E, 0x69, 0x3C, 0x08,
+    0x6D, 0xCD, 0x27, 0x06, 0xA1, 0x97, 0x08, 0x8E, 0x70, 0xA2, 0xCA, 0x6C, 0xDC, 0x73, 0x7A, 0x0C,
+    0x43, 0x0C, 0x42, 0xBC, 0x27, 0x00, 0xE6, 0x8E, 0xA0, 0x64, 0x84, 0xB2, 0xB3, 0x8F, 0xF8, 0xDD,
+    0x20, 0xBA, 0x3C, 0x4E, 0x4C, 0x45, 0x84, 0xCB, 0x62, 0x49, 0x58, 0x30, 0xDE, 0xE1, 0xC8, 0xD6,
+    0xEE, 0xCB, 0xEE, 0x65, 0x88, 0x5B, 0x4F, 0x97, 0x0E, 0xC1, 0xC4, 0xD8, 0x67, 0x6C, 0x8B, 0x1D,
+    0x82, 0x77, 0x6F, 0xEC, 0x5E, 0xF7, 0x80, 0x45, 0xCC, 0x4D, 0x25, 0x65, 0xCF, 0x11, 0x0B, 0x9F,
+    0x08, 0x66, 0xD6, 0xC8, 0x31, 0xFD, 0x9D, 0xEF, 0x71, 0x18, 0xF0, 0x15, 0x44, 0x2F, 0x50, 0x9F,
+    0xFE, 0xB2, 0x35, 0xE3, 0x31, 0xFD, 0x21, 0xB6, 0xC1, 0xA2, 0x18, 0xFC, 0xED, 0x84, 0x6C, 0xAC,
+    0xCB, 0xE2, 0x54, 0x8E, 0x19, 0xCF, 0xF3, 0x2B, 0xE6, 0x45, 0xAC, 0xAE, 0x42, 0xCA, 0x1A, 0xF7,
+    0xD1, 0xEC, 0xCB, 0xE9, 0x84, 0x9C, 0xC5, 0xF3, 0x14, 0x79, 0x8B, 0x95, 0x87, 0x3C, 0x89, 0x0E,
+    0xF3, 0x5A, 0x3C, 0xF2, 0xE4, 0x9A, 0x0E, 0x7C, 0x6B, 0xB4, 0xD8, 0x06, 0x49, 0xDB, 0xF5, 0x32,
+    0xD3, 0x21, 0xEA, 0x0C, 0x17, 0xDA, 0x5A, 0xC6, 0xF7, 0x80, 0xC7, 0x69, 0x3B, 0xAF, 0x65, 0x55,
+    0xE0, 0x2D, 0x66, 0x51, 0xD7, 0x4E, 0x9B, 0x8D, 0xA2, 0x40, 0xDB, 0xBC, 0x19, 0x85, 0x17, 0xE8,
+    0x7C, 0xBB, 0xA2, 0xF8, 0x28, 0x82, 0x95, 0xE3, 0x91, 0x2B, 0x2C, 0x06, 0x48, 0xB4, 0x4B, 0xB6,
+    0x1E, 0x62, 0xF2, 0x15, 0xB9, 0x50, 0xD9, 0xF8, 0x9E, 0x91, 0xA4, 0x71, 0xEF, 0x43, 0xFA, 0x43,
+    0xED, 0x98, 0x57, 0xFA, 0xE7, 0xB6, 0x46, 0xE4, 0x50, 0xAE, 0xB7, 0x98, 0x83, 0xAD, 0x91, 0x00,
+    0x3C, 0x6B, 0xB6, 0xFE, 0x93, 0x81, 0xF0, 0x2D, 0x04, 0xAA, 0x41, 0x8E, 0xD5, 0x7E, 0x01, 0xD5,
+    0x95, 0x31, 0x8E, 0xD4, 0x40, 0x10, 0x45, 0xCB, 0xEE, 0xC0, 0x81, 0x83, 0x26, 0x21, 0xD9, 0x00,
+    0xDF, 0x60, 0x3B, 0x21, 0x77, 0x4B, 0x1C, 0x60, 0x37, 0x21, 0x26, 0xE7, 0x0E, 0xA8, 0x7D, 0x03,
+    0xB8, 0xC1, 0x12, 0x6C, 0x80, 0x48, 0xB8, 0x00, 0xC2, 0x23, 0x21, 0x41, 0x38, 0x96, 0x08, 0x48,
+    0x0D, 0xE2, 0x00, 0x8D, 0xD4, 0x08, 0xEF, 0x6E, 0x8F, 0x3F, 0xBF, 0x7A, 0x40, 0xCC, 0x22, 0x32,
+    0x12, 0xA6, 0x83, 0xD2, 0x57, 0xBB, 0xA6, 0xAA, 0x5E, 0x95, 0xCB, 0x63, 0x80, 0x4B, 0x11, 0x0B,
+    0xAC, 0x5E, 0x7A, 0x00, 0x83, 0x40, 0xAD, 0xC1, 0xC3, 0x11, 0x83, 0xCD, 0xD2, 0x41, 0xFA, 0x28,
+    0xDD, 0x2A, 0xD8, 0x88, 0xCB, 0x06, 0x22, 0x7D, 0xE2, 0xB5, 0xE0, 0x23, 0x90, 0x0C, 0x2E, 0x80,
+    0xC9, 0xAE, 0x01, 0xF0, 0xFD, 0x15, 0xB0, 0x13, 0x7C, 0x0A, 0xDF, 0xCE, 0x0D, 0x3C, 0xBD, 0x6D,
+    0xF1, 0x1E, 0x23, 0xBD, 0x1B, 0x0C, 0x0C, 0x12, 0x32, 0x83, 0x3C, 0xC2, 0x64, 0x98, 0x60, 0xD5,
+    0x94, 0x98, 0x35, 0xE5, 0xC2, 0x60, 0xB8, 0x92, 0x5F, 0x07, 0xC3, 0x13, 0xE6, 0xC0, 0xAB, 0x8D,
+    0xB4, 0xE5, 0x59, 0x76, 0x8C, 0x62, 0xFD, 0x3D, 0x2F, 0x07, 0x07, 0x49, 0x24, 0x6C, 0x99, 0xA4,
+    0xC9, 0x0C, 0xA5, 0x32, 0xA9, 0xE4, 0x05, 0xE5, 0x4E, 0xE5, 0xC8, 0x7C, 0xDB, 0xEF, 0x18, 0x28,
+    0xCF, 0x32, 0x65, 0x1A, 0x23, 0xE5, 0x03, 0x78, 0x4A, 0x97, 0x29, 0x3D, 0xA6, 0xB0, 0x5D, 0x1A,
+    0x50, 0x0E, 0xFD, 0x42, 0x29, 0x78, 0x4F, 0xD9, 0x42, 0x65, 0x7F, 0x43, 0x59, 0x01, 0x94, 0x16,
+    0x94, 0x12, 0x54, 0xD6, 0x45, 0x5A, 0x95, 0x32, 0x66, 0xA9, 0x5E, 0x6A, 0x4D, 0x15, 0x26, 0xAD,
+    0x88, 0x7C, 0x3C, 0xDA, 0x19, 0xA1, 0x5F, 0x29, 0x32, 0xDC, 0x2A, 0x99, 0x9E, 0xEC, 0xA8, 0xB0,
+    0xA1, 0x4A, 0x35, 0x92, 0x9E, 0x7E, 0x3C, 0x9B, 0x06, 0x5F, 0x1A, 0xCC, 0x16, 0x5E, 0x10, 0xBB,
+    0x1D, 0x23, 0x2D, 0x8E, 0x51, 0x5C, 0xEE, 0xE9, 0xD6, 0xE5, 0x9E, 0xA4, 0x76, 0xF7, 0xD3, 0xC6,
+    0x03, 0x7B, 0x78, 0xBF, 0x68, 0xE6, 0xFD, 0xAF, 0xF6, 0x11, 0xAC, 0x76, 0x3E, 0x31, 0x6C, 0x83,
+    0x68, 0x4A, 0x96, 0x32, 0x56, 0x2F, 0x0E, 0xC8, 0x5A, 0x20, 0x9E, 0x69, 0x41, 0xE7, 0xA5, 0xAE,
+    0x93, 0x17, 0xA5, 0xDA, 0x54, 0x1A, 0xBB, 0xA1, 0x31, 0xA5, 0x7E, 0xBB, 0xA8, 0xED, 0x26, 0x39,
+    0x0A, 0x8A, 0x93, 0xCB, 0x32, 0x85, 0x5D, 0x81, 0xA0, 0x8B, 0xD4, 0x6B, 0x20, 0x4B, 0xBB, 0x74,
+    0x51, 0x21, 0xEA, 0xE5, 0x38, 0x66, 0x51, 0x6A, 0x83, 0x7F, 0x2D, 0xDC, 0x99, 0xEB, 0x5C, 0x16,
+    0x53, 0xC3, 0xBE, 0xE3, 0xAA, 0x48, 0x27, 0xA7, 0xFE, 0x78, 0x28, 0x4C, 0xB2, 0x7C, 0x75, 0xDA,
+    0xAC, 0xFD, 0xDF, 0xDB, 0x26, 0x59, 0x52, 0x88, 0xAF, 0xE4, 0x48, 0x28, 0xEE, 0x4B, 0x63, 0x92,
+    0x04, 0x97, 0x9A, 0xD5, 0xA5, 0x30, 0xBB, 0x9B, 0x95, 0x7E, 0xB3, 0xB8, 0xB5, 0x6C, 0x4B, 0xC3,
+    0xC9, 0x04, 0xE8, 0xB3, 0xC8, 0x67, 0x5F, 0xF9, 0xEC, 0xF3, 0x2C, 0xA7, 0x84, 0xBB, 0xF3, 0x1B,
+    0xCD, 0x14, 0xBA, 0xA7, 0x93, 0xD2, 0x31, 0x97, 0xD2, 0x0D, 0x7F, 0xD0, 0x99, 0x42, 0x67, 0xA1,
+    0x74, 0x0E, 0x4A, 0xD7, 0x5F, 0x28, 0x1D, 0x94, 0xA2, 0xCE, 0xCA, 0x65, 0x16, 0xB5, 0x36, 0xEA,
+    0x8D, 0xDB, 0xA8, 0xED, 0x07, 0xA5, 0x83, 0xD2, 0xAD, 0x59, 0xE9, 0xD8, 0x3B, 0xA5, 0x8B, 0x7F,
+    0xA5, 0xD3, 0x8C, 0x59, 0xCC, 0xB5, 0xD2, 0x55, 0xF1, 0x60, 0x46, 0x8F, 0x9F, 0xD3, 0xB4, 0x65,
+    0xDB, 0x47, 0x1D, 0x4D, 0x53, 0xD6, 0x47, 0xF7, 0x46, 0x6E, 0x2F, 0x4C, 0x3F, 0xB3, 0x37, 0xFC,
+    0x8E, 0xCA, 0xF8, 0x81, 0xDE, 0x2E, 0x31, 0x72, 0xAB, 0x0D, 0xFF, 0xC7, 0x4B, 0x83, 0x33, 0x66,
+    0xC4, 0x5B, 0xCE, 0x7F, 0x8C, 0x61, 0x91, 0x71, 0xB1, 0xA5, 0x54, 0xE8, 0x5F, 0x89, 0x2D, 0x23,
+    0x09, 0xFA, 0xFE, 0xCB, 0xDD, 0x52, 0x45, 0xAD, 0x1F, 0x5C, 0xA3, 0x2F, 0x4B, 0xAD, 0xA6, 0xD2,
+    0x35, 0x97, 0x62, 0xDE, 0xC8, 0xFF, 0x57, 0xED, 0x71, 0x9C, 0x1F, 0xCD, 0x55, 0xB1, 0x6E, 0xD4,
+    0x40, 0x10, 0x9D, 0xB5, 0x49, 0x2C, 0xE1, 0xC2, 0x29, 0x48, 0x43, 0x73, 0x2D, 0x9D, 0xBF, 0x00,
+    0xF9, 0x04, 0x25, 0x45, 0x52, 0x00, 0x12, 0xA2, 0xA0, 0xA6, 0xBA, 0x4F, 0xB0, 0xF3, 0x05, 0x50,
+    0x24, 0x34, 0x14, 0x34, 0x34, 0x49, 0x93, 0x2F, 0x40, 0x6B, 0x29, 0x05, 0x05, 0x05, 0x27, 0x81,
+    0x44, 0x19, 0x07, 0x05, 0x51, 0xA4, 0x60, 0x01, 0x0B, 0x9C, 0x68, 0xED, 0xC7, 0x9B, 0xF5, 0x1D,
+    0x20, 0x21, 0xD1, 0xA0, 0x93, 0x70, 0xEE, 0x46, 0xBE, 0xD9, 0xD9, 0x9D, 0xB7, 0x6F, 0x66, 0x5E,
+    0x44, 0x0E, 0x2A, 0x11, 0x41, 0x47, 0x63, 0xC1, 0xD7, 0xF2, 0xB8, 0xA5, 0xA9, 0x31, 0x95, 0xA2,
+    0x4A, 0x9D, 0xFC, 0x7A, 0x8A, 0x46, 0x22, 0x6C, 0x79, 0x86, 0xBD, 0x81, 0x48, 0xDE, 0xA2, 0x96,
+    0xB4, 0x2F, 0xDC, 0xBF, 0x3A, 0x63, 0x6C, 0xF5, 0xCC, 0x7F, 0xC4, 0xDC, 0xD6, 0x95, 0x9D, 0xD8,
+    0x2E, 0x03, 0xE0, 0x85, 0xA6, 0x97, 0x4C, 0xDF, 0xA4, 0x04, 0x21, 0xC9, 0xE6, 0x4F, 0x24, 0x69,
+    0x93, 0x57, 0x92, 0xF8, 0xAC, 0x15, 0x83, 0x98, 0x9B, 0x8B, 0xDA, 0x8A, 0x18, 0xFE, 0xFD, 0x77,
+    0x68, 0xCD, 0x48, 0xEE, 0x7C, 0x69, 0x6C, 0xAD, 0x46, 0x7D, 0xC5, 0xF4, 0x77, 0xB4, 0x56, 0xD1,
+    0x3E, 0xF3, 0xBC, 0x8F, 0x9E, 0x8C, 0x86, 0x99, 0x4A, 0x97, 0x0E, 0x52, 0x74, 0x82, 0x7A, 0xE2,
+    0x25, 0xEF, 0xB2, 0x9E, 0xB9, 0x13, 0x62, 0xB1, 0xEF, 0x59, 0x9A, 0xAC, 0x27, 0x20, 0x03, 0x3D,
+    0xB3, 0x00, 0x8B, 0x94, 0xA8, 0x19, 0x8B, 0xC8, 0x68, 0x61, 0xA8, 0x9E, 0x0A, 0xCD, 0x56, 0xE8,
+    0x4A, 0xF6, 0x57, 0xA7, 0xBA, 0xD4, 0xA3, 0x8E, 0x10, 0x04, 0x0C, 0xD3, 0x02, 0x08, 0x77, 0x3B,
+    0xE2, 0xB7, 0x23, 0x08, 0x30, 0x02, 0xAF, 0xBD, 0x14, 0xDF, 0x41, 0x2A, 0x50, 0xC7, 0x28, 0x83,
+    0xC3, 0xE0, 0x2B, 0x23, 0x5A, 0x65, 0x61, 0xB1, 0xE5, 0x34, 0x26, 0xC2, 0x3F, 0x0F, 0x15, 0x73,
+    0x87, 0x26, 0xC7, 0xA0, 0x14, 0x91, 0x23, 0x1A, 0x30, 0xCB, 0x53, 0xB8, 0x49, 0x2F, 0xB9, 0xE7,
+    0x6D, 0x63, 0x44, 0xDC, 0x89, 0xDA, 0xCE, 0xC9, 0x56, 0xDE, 0x92, 0x87, 0xB4, 0x37, 0x68, 0xE8,
+    0xE4, 0x45, 0xED, 0x9C, 0x24, 0xE5, 0x6D, 0xEE, 0x99, 0x3D, 0x09, 0x4E, 0x0B, 0x3A, 0x53, 0xB4,
+    0xB9, 0x9E, 0x75, 0xAB, 0x27, 0x83, 0x5F, 0xB8, 0x7D, 0xE2, 0xB9, 0x3D, 0xC6, 0x8C, 0x45, 0xC0,
+    0xAB, 0x3E, 0xDB, 0xA3, 0xF3, 0x26, 0x71, 0xD9, 0x39, 0x01, 0x72, 0xFB, 0x58, 0x1C, 0xE2, 0x3B,
+    0x78, 0x3C, 0x72, 0x65, 0x14, 0x68, 0xA0, 0x42, 0xEB, 0x92, 0x2C, 0x3A, 0x7E, 0x73, 0x57, 0xE9,
+    0x75, 0x11, 0x31, 0x92, 0x61, 0xB8, 0xF4, 0x6D, 0xCE, 0xBA, 0x2B, 0x3C, 0x29, 0x1B, 0x59, 0x9B,
+    0x75, 0xEB, 0xE4, 0x28, 0xE5, 0xEA, 0x23, 0x5C, 0xE0, 0x23, 0xA6, 0x93, 0x0B, 0x54, 0xC9, 0x60,
+    0xE7, 0x11, 0x0E, 0x3B, 0x43, 0xC7, 0x13, 0x72, 0xC6, 0x88, 0x09, 0x7C, 0xB9, 0x43, 0x52, 0x1A,
+    0x13, 0xCA, 0x7D, 0x79, 0x9F, 0xCD, 0x0B, 0x2D, 0x17, 0x39, 0x21, 0x0F, 0xDA, 0xBC, 0x91, 0x97,
+    0x15, 0xA6, 0x5C, 0xDF, 0xD7, 0x6C, 0x4A, 0x88, 0x67, 0x46, 0x5B, 0xC7, 0x7D, 0xE2, 0x8D, 0x5F,
+    0x76, 0xDF, 0x6A, 0x6E, 0xA9, 0x4D, 0xD8, 0x66, 0xEC, 0x98, 0xB3, 0x86, 0xDD, 0xE0, 0x92, 0x13,
+    0xDB, 0x1A, 0x17, 0x9D, 0xCA, 0x6A, 0x53, 0x96, 0xD2, 0x73, 0xE8, 0x6D, 0x9D, 0x75, 0xB9, 0x33,
+    0x7D, 0xD2, 0xCA, 0x25, 0xD9, 0x58, 0x25, 0xB1, 0xDD, 0x82, 0xD8, 0x6F, 0xAC, 0x5F, 0x9B, 0x8B,
+    0x5C, 0x4F, 0x6B, 0xC9, 0xCE, 0x1C, 0x53, 0x39, 0x55, 0xA8, 0x31, 0xB5, 0xB9, 0xC7, 0x86, 0x64,
+    0xDA, 0x9C, 0x69, 0x63, 0xCD, 0xFF, 0xE2, 0x86, 0xCE, 0x2C, 0x3B, 0x56, 0x12, 0xD6, 0xFF, 0x2E,
+    0xAA, 0x19, 0xD0, 0x58, 0x9D, 0x30, 0x1C, 0x0E, 0x65, 0x6B, 0x98, 0x52, 0xCA, 0x33, 0xCE, 0x03,
+    0x31, 0x4C, 0x86, 0xF2, 0x7C, 0x46, 0x50, 0xC0, 0x09, 0xF0, 0xB2, 0x9B, 0xA0, 0x1A, 0xE4, 0x8A,
+    0x9E, 0xBA, 0xF6, 0x5C, 0xD6, 0x76, 0x55, 0xAE, 0xDB, 0x42, 0x07, 0x03, 0xE0, 0x47, 0xC5, 0x87,
+    0x4F, 0x13, 0x9D, 0x72, 0x22, 0x38, 0x50, 0xEC, 0x7E, 0x8E, 0x27, 0x3B, 0x3A, 0xEF, 0x24, 0x27,
+    0xA2, 0x07, 0x83, 0xA4, 0xDE, 0xD8, 0x10, 0x14, 0x07, 0xCB, 0xC9, 0xBE, 0xD0, 0xDF, 0x9F, 0x31,
+    0x4F, 0xFB, 0xA0, 0x41, 0xD1, 0x22, 0x3E, 0xDC, 0x60, 0x90, 0x92, 0x08, 0x77, 0xF0, 0xC1, 0xE2,
+    0xFC, 0xBE, 0x23, 0x6F, 0xC7, 0x1C, 0xA0, 0x04, 0xA8, 0x47, 0x1A, 0xAB, 0x84, 0x1A, 0x21, 0xB7,
+    0x09, 0x66, 0x9B, 0xD7, 0x7C, 0x28, 0x32, 0x43, 0x47, 0x86, 0x7D, 0x1A, 0x34, 0xE0, 0xC0, 0x71,
+    0x4E, 0x37, 0x8A, 0x76, 0x94, 0x80, 0xD2, 0x05, 0xA6, 0xC7, 0xAF, 0x1B, 0x7D, 0xBA, 0xC6, 0x32,
+    0x5C, 0xCB, 0xF0, 0x49, 0xF7, 0x78, 0xDD, 0x4B, 0x9A, 0xA8, 0x83, 0x5C, 0x88, 0xDB, 0x71, 0x46,
+    0xA4, 0x24, 0xA0, 0xA2, 0xA2, 0xBF, 0x62, 0xCA, 0x80, 0x2D, 0xCC, 0x6D, 0x58, 0x0B, 0x42, 0x17,
+    0x84, 0x4C, 0x07, 0xD7, 0x2C, 0xC7, 0xE8, 0xEA, 0xB6, 0xEA, 0x4B, 0xA3, 0x94, 0xD7, 0x5A, 0x54,
+    0x55, 0xD3, 0x56, 0x2F, 0x75, 0x04, 0xFE, 0xCF, 0x50, 0x61, 0x7D, 0xA7, 0x62, 0xAD, 0xEA, 0x33,
+    0xBE, 0xB8, 0x85, 0x3E, 0x29, 0xA2, 0x88, 0x62, 0xB0, 0x91, 0x61, 0xCF, 0x4E, 0x55, 0xA2, 0x8C,
+    0x2A, 0x54, 0x14, 0x54, 0x76, 0x73, 0x39, 0xBE, 0x1A, 0x11, 0x2E, 0x91, 0x75, 0xE3, 0xFC, 0x8A,
+    0x95, 0xD5, 0x67, 0x5E, 0xDD, 0xF3, 0x03, 0xBD, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0x7B,
+    0x93, 0xB3, 0xC0, 0x85, 0xD3, 0xD0, 0x50, 0xE0, 0x9E, 0xC6, 0xFC, 0x02, 0xEC, 0x88, 0x3F, 0x40,
+    0x41, 0xC3, 0x5F, 0x48, 0xC3, 0x2F, 0x40, 0x6B, 0xA0, 0xA4, 0x49, 0x01, 0x3D, 0x45, 0x84, 0x94,
+    0x6B, 0xAE, 0x4D, 0xC5, 0x5A, 0xA2, 0x48, 0x91, 0xC6, 0x14, 0x88, 0x22, 0xCD, 0x22, 0x8A, 0x14,
+    0x34, 0x1B, 0xC9, 0x01, 0x13, 0xED, 0x7A, 0x78, 0x63, 0xFB, 0x52, 0x87, 0xA0, 0x8B, 0xB5, 0xB7,
+    0xB7, 0xF2, 0xEE, 0x7C, 0xBC, 0x79, 0x6F, 0xC7, 0xB4, 0x38, 0x24, 0x8A, 0xB8, 0x23, 0x2A, 0xB9,
+    0xA1, 0xEC, 0x92, 0x49, 0x85, 0xC4, 0x93, 0xA6, 0xAC, 0xA5, 0xF1, 0xB9, 0xFF, 0x94, 0x48, 0xB3,
+    0xA5, 0x82, 0xB9, 0x49, 0x99, 0x99, 0xD8, 0x96, 0x5D, 0xD1, 0x13, 0x7F, 0x66, 0x4A, 0x7C, 0xE9,
+    0x48, 0x7F, 0xC3, 0xDB, 0xA0, 0x31, 0x4D, 0x0B, 0x47, 0xA4, 0x18, 0x86, 0x25, 0x7C, 0xC6, 0xF0,
+    0xB9, 0x93, 0xF1, 0x7B, 0x53, 0x61, 0xBF, 0x8B, 0xB0, 0x5F, 0xC5, 0xCC, 0xF0, 0x7C, 0x6F, 0x72,
+    0x4E, 0x79, 0x53, 0x56, 0x6A, 0x48, 0x3D, 0x95, 0xD6, 0x34, 0x51, 0x48, 0x3A, 0x8A, 0x68, 0x8B,
+    0x36, 0x1C, 0xF9, 0xE1, 0x01, 0xE1, 0x2C, 0x06, 0x7C, 0x14, 0x16, 0x39, 0x8C, 0xE1, 0x62, 0xAE,
+    0xD3, 0x81, 0xE0, 0xDF, 0xD8, 0x6B, 0x2E, 0x69, 0xB9, 0x5F, 0xF8, 0x04, 0x79, 0xD5, 0x65, 0x9B,
+    0xBA, 0x29, 0x69, 0x63, 0xB1, 0x71, 0xDD, 0x89, 0xF6, 0xF6, 0x29, 0xE7, 0x4A, 0xB1, 0x27, 0x5E,
+    0xB9, 0xB2, 0xD5, 0xC7, 0x8E, 0xC2, 0x8C, 0x1E, 0x27, 0x48, 0x8E, 0xDC, 0xF4, 0x0F, 0xB5, 0xA3,
+    0xC0, 0xAF, 0x19, 0x43, 0xEF, 0x86, 0x2D, 0xDA, 0xA1, 0x35, 0xCA, 0x1B, 0x8C, 0x89, 0x93, 0xC7,
+    0x91, 0x83, 0xFD, 0xCA, 0x52, 0x82, 0x6A, 0x62, 0x65, 0x09, 0xDC, 0x34, 0xA8, 0x39, 0xA6, 0xE4,
+    0x3B, 0x4E, 0xDD, 0x89, 0xF1, 0x5E, 0x38, 0x58, 0xF0, 0x99, 0x27, 0xC3, 0xDC, 0x0B, 0x6F, 0x4E,
+    0x0F, 0x2B, 0x70, 0x56, 0x67, 0x9C, 0x79, 0xCA, 0xBD, 0xD4, 0xFD, 0x1C, 0x16, 0x7C, 0x0C, 0xAD,
+    0x71, 0xEE, 0x29, 0x1B, 0xB9, 0xB4, 0x6C, 0x15, 0xEF, 0xF2, 0x85, 0xF6, 0xE0, 0x89, 0x1B, 0x4C,
+    0x1E, 0x58, 0xC4, 0xDF, 0x76, 0x35, 0x57, 0x24, 0xED, 0x15, 0x2A, 0x3F, 0x04, 0x48, 0x15, 0x8A,
+    0xF8, 0x02, 0xD1, 0x1E, 0x45, 0x47, 0xF3, 0x5E, 0x74, 0x40, 0xE6, 0x0D, 0xE2, 0x79, 0xC4, 0x43,
+    0x60, 0x7E, 0xCB, 0x7F, 0x8C, 0x37, 0x7D, 0xC4, 0x27, 0x4C, 0x59, 0x30, 0x8E, 0xF8, 0x74, 0xA0,
+    0x34, 0x98, 0x96, 0xCC, 0x69, 0xB8, 0xE6, 0x82, 0xF6, 0x3E, 0xC0, 0xB3, 0xC0, 0x24, 0xD3, 0xAE,
+    0x27, 0x2D, 0x6A, 0x29, 0xEA, 0x39, 0xEC, 0xF3, 0x6A, 0xD2, 0x28, 0x70, 0x76, 0x02, 0xB8, 0x53,
+    0xFC, 0x95, 0x5D, 0x01, 0x3E, 0x5B, 0x6E, 0x22, 0x51, 0xEA, 0x0C, 0x51, 0x5B, 0x41, 0x5D, 0xCF,
+    0xA8, 0xB3, 0x11, 0x35, 0x2C, 0xAC, 0x71, 0x8A, 0x2B, 0xBE, 0x34, 0x5E, 0x24, 0x0A, 0x8B, 0x09,
+    0x75, 0xBD, 0x46, 0xBD, 0x58, 0xCE, 0x7A, 0x56, 0x52, 0x89, 0x02, 0x22, 0x8B, 0x85, 0xDB, 0xF5,
+    0xE5, 0xDC, 0x78, 0x02, 0xF1, 0x18, 0x7F, 0x10, 0xDD, 0x60, 0x2A, 0x7E, 0x07, 0xF4, 0x0A, 0x15,
+    0x28, 0xB3, 0xB1, 0xBF, 0xA5, 0x0A, 0xC8, 0xC3, 0xF5, 0x4B, 0xCA, 0xF8, 0xA7, 0x13, 0xFF, 0xB5,
+    0x72, 0x06, 0xB6, 0xD5, 0x83, 0xEA, 0xF6, 0x12, 0x88, 0xBB, 0x14, 0x6D, 0xC2, 0x95, 0x0D, 0xD8,
+    0x07, 0x0F, 0x83, 0xC2, 0x89, 0xAB, 0xE4, 0x36, 0x4E, 0x81, 0x9D, 0x49, 0xC7, 0x9D, 0x91, 0x76,
+    0x45, 0x6A, 0x6A, 0x35, 0x8B, 0xE5, 0x72, 0xF9, 0x11, 0x06, 0x83, 0xC8, 0x7D, 0x85, 0x9F, 0x9D,
+    0x5E, 0xC3, 0x26, 0xE9, 0x66, 0x13, 0x03, 0x27, 0xB9, 0x68, 0xE5, 0x2A, 0xDB, 0xED, 0x77, 0x8F,
+    0xE4, 0xFA, 0x8E, 0x89, 0xB6, 0x63, 0x57, 0xD5, 0xC3, 0x0B, 0x56, 0x5C, 0xEB, 0x90, 0x79, 0xC5,
+    0xBD, 0x76, 0x25, 0x9F, 0xF3, 0xAB, 0xC0, 0xC7, 0x43, 0xF6, 0x83, 0xF3, 0x1E, 0x69, 0xEA, 0x33,
+    0x57, 0x3A, 0x14, 0x1E, 0x48, 0x7C, 0x3A, 0xA4, 0xDC, 0xE8, 0x2E, 0x43, 0xC0, 0x26, 0x97, 0x44,
+    0xD1, 0x5D, 0x1B, 0x25, 0xFE, 0xE2, 0xE6, 0xD9, 0x3A, 0xC6, 0x72, 0x1F, 0x77, 0x55, 0x1A, 0x71,
+    0x2E, 0x22, 0xD1, 0x92, 0x97, 0xA8, 0xF7, 0x4A, 0x32, 0xD3, 0x55, 0xE2, 0x13, 0xE8, 0xC8, 0xFF,
+    0xDB, 0x02, 0xD7, 0xFF, 0x84, 0x2B, 0xED, 0x35, 0x1B, 0x64, 0x83, 0xF8, 0x19, 0x0F, 0x65, 0x53,
+    0xF0, 0x13, 0x4F, 0xDB, 0xA3, 0xDF, 0xBB, 0x87, 0x53, 0xEB, 0x97, 0x2E, 0x48, 0x79, 0x8F, 0x62,
+    0x49, 0x3F, 0xFD, 0x44, 0x1B, 0x8F, 0x3C, 0x7D, 0x46, 0x9D, 0x28, 0x01, 0x9F, 0xD1, 0x5F, 0x03,
+    0x02, 0xA7, 0x3D, 0x02, 0xE7, 0xED, 0xC6, 0x31, 0xFF, 0xD7, 0xF3, 0x17, 0xCD, 0x54, 0x3D, 0x6F,
+    0xD4, 0x40, 0x10, 0x1D, 0xDB, 0xDC, 0x9D, 0x84, 0x0B, 0xA7, 0x20, 0x0D, 0x14, 0x6E, 0x81, 0xC6,
+    0x3F, 0xC1, 0x16, 0x94, 0x34, 0x29, 0x72, 0x91, 0x10, 0x35, 0x05, 0x34, 0xF9, 0x09, 0x36, 0x34,
+    0x29, 0x43, 0x11, 0x51, 0xA7, 0xA0, 0x40, 0x69, 0xD2, 0xD0, 0x92, 0xB5, 0x44, 0x41, 0x91, 0x82,
+    0x93, 0x80, 0x2A, 0x05, 0x46, 0x80, 0x90, 0x48, 0x11, 0x17, 0x46, 0x72, 0xA2, 0xF5, 0x3E, 0xDE,
+    0xEC, 0x5D, 0x42, 0x10, 0x08, 0x89, 0x02, 0x29, 0x6B, 0xED, 0x68, 0xE5, 0x9D, 0x8F, 0x37, 0x6F,
+    0x66, 0x56, 0x84, 0x2B, 0xAD, 0x4B, 0x89, 0x86, 0xA4, 0x97, 0x7C, 0x86, 0x2A, 0xB4, 0x93, 0x4E,
+    0x02, 0xB9, 0x24, 0x67, 0xCB, 0xCC, 0x04, 0xFB, 0x83, 0x24, 0xF6, 0xDF, 0x0E, 0x4D, 0x88, 0x7D,
+    0x14, 0xA5, 0x2D, 0x61, 0xF0, 0x0A, 0x80, 0x4D, 0xE0, 0xF2, 0x3A, 0xC3, 0x6D, 0x2B, 0x23, 0xEF,
+    0x77, 0xBC, 0x43, 0x91, 0x38, 0x8A, 0xBC, 0x9B, 0x87, 0x91, 0x00, 0x3C, 0x44, 0xBD, 0x9C, 0x5B,
+    0xA6, 0x91, 0xD4, 0x96, 0xAD, 0x64, 0x5D, 0xDE, 0x4A, 0xDE, 0x66, 0xBD, 0x94, 0x4D, 0x62, 0xA9,
+    0x1D, 0x5B, 0x41, 0x3D, 0x71, 0x01, 0xAA, 0x08, 0x21, 0x24, 0x44, 0x44, 0x63, 0x6C, 0x0C, 0x34,
+    0xD9, 0xB7, 0x22, 0xE5, 0x1B, 0xBA, 0xC9, 0x8F, 0xE8, 0x39, 0x43, 0xCB, 0x38, 0x68, 0x44, 0x62,
+    0xD4, 0x22, 0x13, 0x15, 0x11, 0x0A, 0x15, 0xF4, 0x3F, 0x51, 0x00, 0x74, 0x48, 0x0B, 0x8A, 0x5C,
+    0x75, 0x73, 0xD5, 0xCD, 0x55, 0x23, 0x53, 0x28, 0xCB, 0x3C, 0xC4, 0xC3, 0x02, 0xE1, 0x9F, 0x0E,
+    0xC1, 0x96, 0x98, 0xB7, 0x68, 0xE3, 0x01, 0x98, 0x19, 0x66, 0x1A, 0xE3, 0x1B, 0x7A, 0xD3, 0x69,
+    0xFE, 0x9E, 0x08, 0xC1, 0x81, 0xA3, 0x1A, 0x95, 0xCD, 0xC1, 0xA0, 0x87, 0x86, 0x07, 0x27, 0xC9,
+    0x60, 0x5A, 0x92, 0x85, 0x2A, 0xB7, 0x6A, 0x75, 0x87, 0xBB, 0x35, 0x1F, 0x60, 0xE3, 0x21, 0x73,
+    0xF4, 0xBC, 0xFC, 0xF7, 0xA0, 0x67, 0x04, 0xED, 0x85, 0x3D, 0x79, 0x8B, 0x86, 0xB9, 0x10, 0x84,
+    0x4C, 0x63, 0x89, 0xDF, 0x45, 0xA2, 0x50, 0x46, 0xD3, 0x69, 0xA1, 0x1E, 0xD4, 0xF0, 0xBC, 0xFC,
+    0x65, 0x19, 0xAF, 0x0A, 0x75, 0x14, 0x40, 0x13, 0x8C, 0xE0, 0xFB, 0xC1, 0xA9, 0x8C, 0x2D, 0x2A,
+    0x8D, 0xE2, 0x6D, 0x7B, 0x43, 0xC9, 0x74, 0x34, 0x48, 0xCB, 0xA4, 0x98, 0x50, 0xD6, 0x29, 0x33,
+    0x29, 0x5D, 0xA0, 0x26, 0x16, 0xE6, 0x44, 0x8E, 0x42, 0x72, 0xEA, 0xD4, 0x0D, 0x1D, 0x4D, 0x54,
+    0x16, 0xB1, 0xCA, 0x3A, 0x71, 0xD3, 0x35, 0xD4, 0x29, 0x23, 0x61, 0x96, 0xD3, 0xC4, 0xB4, 0xDA,
+    0x82, 0x65, 0x5B, 0x2A, 0xF4, 0x5E, 0xB1, 0x67, 0x36, 0x98, 0x4E, 0x57, 0xC5, 0xD0, 0x3C, 0x03,
+    0x2A, 0x1A, 0xCF, 0x3C, 0xC6, 0xE0, 0x6E, 0x21, 0x29, 0xBD, 0xF1, 0x67, 0xAB, 0x7E, 0xE5, 0xE5,
+    0x2D, 0xBD, 0xD1, 0xE8, 0x4A, 0xC3, 0x1A, 0xAA, 0x75, 0xA0, 0x61, 0x3D, 0x7B, 0x60, 0xD7, 0x95,
+    0x5D, 0x80, 0x5D, 0xD2, 0x7D, 0x38, 0x48, 0x76, 0x82, 0x2A, 0x75, 0xE5, 0xF1, 0x3A, 0x36, 0x69,
+    0xF6, 0x11, 0x78, 0xDD, 0xA7, 0xA8, 0x9C, 0x5C, 0x51, 0xAF, 0x57, 0x25, 0xD8, 0xE6, 0x1C, 0x56,
+    0x13, 0xA5, 0xF9, 0x84, 0xF5, 0x52, 0xB4, 0xB5, 0xD2, 0xA0, 0xA9, 0xCB, 0xB5, 0xCF, 0x72, 0xA1,
+    0xA9, 0x0A, 0xB7, 0xE5, 0x86, 0x58, 0xC9, 0x2A, 0x26, 0x59, 0x47, 0x4A, 0x55, 0xCE, 0x1D, 0xEC,
+    0x15, 0x73, 0xB0, 0xCB, 0x5B, 0x9A, 0x48, 0xAB, 0x11, 0x78, 0xC1, 0x41, 0x79, 0x97, 0x11, 0x72,
+    0xA8, 0xDD, 0x51, 0x36, 0x32, 0x5A, 0xEF, 0xC7, 0x0C, 0xAD, 0xD1, 0x36, 0x71, 0x82, 0xAF, 0x28,
+    0x52, 0x52, 0x35, 0x71, 0x66, 0x16, 0x92, 0xBB, 0x80, 0x3F, 0x9E, 0x2A, 0x99, 0x70, 0x29, 0x6C,
+    0xF9, 0x08, 0x7D, 0xD2, 0x04, 0xC5, 0xC5, 0xA3, 0x40, 0xB1, 0x24, 0xBE, 0x45, 0x72, 0x8F, 0xAE,
+    0xF4, 0x99, 0x3B, 0x2F, 0xB1, 0xFA, 0x13, 0x6F, 0xEE, 0xE5, 0xF8, 0x99, 0x8C, 0xEE, 0x53, 0x89,
+    0xE8, 0x8D, 0x06, 0xE0, 0xEB, 0x18, 0x7E, 0x8F, 0x95, 0x10, 0x1D, 0x6E, 0xC2, 0x0A, 0xEE, 0xB9,
+    0x80, 0x37, 0x8F, 0x19, 0xFE, 0x13, 0x9C, 0x39, 0xC6, 0x8C, 0x84, 0x34, 0x6C, 0xA6, 0x4E, 0xCC,
+    0xA1, 0x93, 0xF2, 0x18, 0x5F, 0x8C, 0x23, 0x97, 0xD8, 0x00, 0xD2, 0xA6, 0x74, 0x7C, 0x33, 0x57,
+    0xF8, 0x0E, 0x88, 0x6E, 0x51, 0x30, 0x86, 0x3B, 0x7B, 0xBF, 0x18, 0x55, 0x9D, 0x48, 0x86, 0x14,
+    0x79, 0xB8, 0xAD, 0x70, 0x66, 0x8B, 0xE1, 0xF5, 0x23, 0x9B, 0x35, 0x67, 0x98, 0x4F, 0x17, 0x23,
+    0x3F, 0xD1, 0xF9, 0xB4, 0x04, 0x08, 0xCB, 0xD2, 0xA1, 0x8F, 0xD0, 0x8D, 0x5B, 0x05, 0xB8, 0xE4,
+    0x1F, 0x6C, 0x9F, 0xAF, 0x4F, 0xC5, 0x3F, 0xDD, 0xCA, 0xE9, 0x6F, 0xA2, 0x3B, 0x55, 0xF1, 0xCA,
+    0xA9, 0x56, 0x28, 0xF1, 0xA5, 0x41, 0x13, 0xBC, 0x50, 0x92, 0x3B, 0xF1, 0x22, 0x53, 0x31, 0xF6,
+    0xF3, 0x35, 0x5A, 0xE1, 0xFD, 0xE5, 0xE7, 0x73, 0x3B, 0x4E, 0x81, 0xB6, 0xC8, 0x84, 0xD6, 0x49,
+    0xB3, 0x00, 0xF6, 0x40, 0x64, 0x1D, 0x3D, 0xEB, 0x64, 0x59, 0x99, 0x3E, 0xC1, 0x4E, 0x4B, 0xE7,
+    0x4B, 0x1A, 0xCA, 0x97, 0xD5, 0x97, 0x76, 0xB1, 0xDB, 0xF9, 0x3F, 0xBD, 0x63, 0xB7, 0x5D, 0x4F,
+    0x70, 0xA4, 0x36, 0x56, 0x6D, 0x19, 0x92, 0x1A, 0x5A, 0x94, 0x9B, 0x9E, 0x0F, 0xE5, 0x4D, 0x3B,
+    0x88, 0x0F, 0x38, 0x87, 0xBB, 0xC9, 0xD9, 0xBE, 0x45, 0xDC, 0x5E, 0x18, 0x42, 0xFE, 0xE7, 0xFA,
+    0x01, 0xCD, 0x95, 0xBD, 0x6E, 0xD4, 0x40, 0x14, 0x85, 0xAF, 0xD7, 0xCA, 0xAE, 0x14, 0x17, 0x4E,
+    0x93, 0x82, 0x34, 0xDB, 0x02, 0x8D, 0x1F, 0x61, 0x0C, 0x2F, 0x40, 0x8A, 0xB8, 0xA2, 0xA0, 0x86,
+    0x26, 0x8F, 0x60, 0x23, 0x0A, 0x4A, 0x22, 0x21, 0x6A, 0x52, 0xA4, 0x88, 0x92, 0x22, 0x0D, 0x2D,
+    0xF2, 0x4A, 0x3C, 0x00, 0x2B, 0x21, 0x44, 0x89, 0x81, 0x86, 0x2E, 0x2E, 0x1C, 0xE1, 0x44, 0xB6,
+    0x0F, 0xE7, 0x8C, 0x77, 0xA5, 0x44, 0xD4, 0x2B, 0x61, 0xC9, 0xE3, 0xDD, 0x99, 0x3B, 0xF7, 0xE7,
+    0xBB, 0x67, 0x6C, 0xDB, 0x3E, 0x35, 0x4B, 0x60, 0x96, 0xA3, 0x08, 0x90, 0x57, 0x61, 0x17, 0xB5,
+    0x51, 0x15, 0x74, 0xA6, 0x2B, 0x78, 0x6E, 0x76, 0x88, 0x76, 0x02, 0x74, 0x11, 0xD0, 0xC6, 0x38,
+    0xAB, 0x93, 0xCE, 0x76, 0x5C, 0x63, 0xE6, 0x6A, 0x6E, 0xD1, 0x5D, 0xAD, 0xEE, 0x7A, 0x9C, 0xD3,
+    0x5A, 0xD2, 0xDB, 0xFD, 0x18, 0x97, 0xDA, 0xD3, 0x69, 0x2F, 0xFD, 0xD3, 0xE2, 0x80, 0x0E, 0xB7,
+    0xE4, 0xD5, 0xF1, 0x8F, 0xB7, 0x1F, 0x07, 0xFF, 0x77, 0x9A, 0xDA, 0xAD, 0x2B, 0x28, 0x71, 0x64,
+    0xB1, 0x76, 0xE6, 0x1C, 0x02, 0x30, 0x76, 0x88, 0x66, 0x5A, 0x47, 0x48, 0x6D, 0x27, 0x1E, 0x68,
+    0x91, 0x28, 0x41, 0xD7, 0xDA, 0x18, 0xD0, 0x47, 0xFE, 0x67, 0x68, 0xD6, 0x26, 0xDE, 0x78, 0xDE,
+    0x73, 0x88, 0x59, 0xA8, 0x45, 0xA8, 0x82, 0x0F, 0x21, 0x9D, 0x36, 0xE6, 0x87, 0x44, 0xC3, 0x14,
+    0x58, 0x32, 0xBF, 0x7D, 0xAE, 0xF3, 0x8E, 0xB8, 0x23, 0xEE, 0xC7, 0x5B, 0xBF, 0x83, 0x23, 0xDB,
+    0x08, 0x90, 0x87, 0x16, 0x9C, 0x58, 0x52, 0xC5, 0x8D, 0xC5, 0x6D, 0xBE, 0x34, 0x26, 0x45, 0x0E,
+    0x50, 0x81, 0x79, 0xFB, 0xBF, 0x00, 0xD9, 0x3E, 0xB2, 0x17, 0xC1, 0x60, 0x65, 0x91, 0xD4, 0x28,
+    0x98, 0x7D, 0x61, 0x0E, 0x0B, 0xA6, 0xBA, 0x18, 0x53, 0xDB, 0x3A, 0xF1, 0x48, 0xAC, 0x04, 0x74,
+    0x17, 0x6E, 0x38, 0x5F, 0x88, 0x89, 0xD0, 0x85, 0xF4, 0x1E, 0xC8, 0x50, 0x40, 0xE6, 0x8C, 0x3C,
+    0x53, 0x38, 0x4D, 0x28, 0x17, 0x26, 0xBF, 0xCD, 0x62, 0xB1, 0x60, 0xBC, 0xDA, 0x63, 0x89, 0xE8,
+    0xC7, 0xB6, 0x52, 0x0B, 0x4E, 0x15, 0xD5, 0x2D, 0xE7, 0xB5, 0x85, 0x43, 0x22, 0x88, 0xA8, 0xB5,
+    0x59, 0x05, 0x94, 0x77, 0xC0, 0x38, 0xDC, 0xA4, 0x02, 0x83, 0x54, 0xF9, 0xB7, 0xCA, 0x1F, 0x0B,
+    0x77, 0xF5, 0x94, 0xBD, 0xE9, 0x6C, 0x0E, 0x25, 0x80, 0x8A, 0x01, 0x93, 0x8E, 0x08, 0x42, 0x3C,
+    0x61, 0xE1, 0xF8, 0x02, 0x61, 0xE0, 0x64, 0x3C, 0xF8, 0xC9, 0x37, 0x9A, 0xFC, 0xA5, 0xC9, 0x46,
+    0x93, 0xB2, 0x8C, 0xC0, 0xED, 0x33, 0xBC, 0x02, 0x87, 0x05, 0x16, 0xCF, 0xB0, 0x74, 0x74, 0x5C,
+    0x29, 0x50, 0xA5, 0x40, 0x05, 0x03, 0x5D, 0xFB, 0x04, 0x76, 0xD3, 0x2C, 0x55, 0x6D, 0x52, 0xF1,
+    0x6C, 0x88, 0x6B, 0x15, 0xFC, 0x5A, 0x29, 0xE6, 0x3F, 0x3D, 0xE4, 0x56, 0x94, 0x67, 0xEA, 0xD0,
+    0xBD, 0x47, 0xDC, 0x66, 0xE8, 0xC4, 0x02, 0xF8, 0xDE, 0x6A, 0x54, 0xAB, 0xF3, 0xE1, 0x42, 0x4C,
+    0xD9, 0xD5, 0x4A, 0x7A, 0x4B, 0x5A, 0x51, 0xE2, 0x0E, 0x81, 0xE3, 0x02, 0xCD, 0xE9, 0x9B, 0xF0,
+    0x62, 0xBF, 0x10, 0xFA, 0x85, 0x40, 0x3B, 0x1A, 0x2B, 0x2B, 0x35, 0x90, 0x52, 0x09, 0x88, 0x71,
+    0x10, 0x0D, 0xA5, 0xC6, 0x04, 0x95, 0x4D, 0x32, 0xCC, 0xDA, 0x51, 0xCD, 0x6A, 0x04, 0x4E, 0xD4,
+    0x6C, 0x0C, 0xE9, 0xCA, 0x48, 0xA0, 0x8A, 0x10, 0x59, 0x89, 0xC2, 0x93, 0x92, 0x44, 0xE6, 0x83,
+    0x79, 0x54, 0xA1, 0x67, 0x11, 0x0B, 0xCB, 0x37, 0x4A, 0x21, 0xC4, 0x7B, 0x6A, 0x21, 0x1E, 0x28,
+    0xBD, 0xD4, 0x5D, 0x03, 0xBD, 0xE1, 0x47, 0x7E, 0xB5, 0x1F, 0x22, 0xF5, 0xB8, 0x64, 0x5D, 0xD6,
+    0x9E, 0x57, 0x41, 0x27, 0x79, 0x67, 0x1E, 0x58, 0xE8, 0xAB, 0xF3, 0xC4, 0x14, 0xD2, 0x97, 0xBB,
+    0x46, 0x66, 0xA3, 0x1A, 0x3C, 0x97, 0xE9, 0x39, 0x7E, 0x1B, 0xBB, 0x2F, 0x2F, 0xEC, 0x9D, 0xED,
+    0x9D, 0xE3, 0x58, 0x10, 0x0B, 0x6A, 0x4F, 0xB5, 0x83, 0x96, 0x39, 0xFE, 0x0C, 0x63, 0xDE, 0x09,
+    0xCE, 0xD5, 0x06, 0xD6, 0x1C, 0xA2, 0x88, 0x86, 0x11, 0x05, 0x8F, 0x9A, 0xAB, 0xE6, 0x1D, 0x09,
+    0x79, 0x40, 0x01, 0x85, 0xCB, 0x54, 0x28, 0x49, 0x5A, 0xA6, 0x8E, 0xA7, 0x55, 0x70, 0xDC, 0x58,
+    0xF0, 0x40, 0x34, 0x49, 0x1F, 0xB5, 0x23, 0x98, 0xDD, 0x2C, 0x7B, 0xCC, 0xDC, 0x28, 0xC0, 0x97,
+    0xF0, 0xEA, 0xD2, 0x45, 0xC3, 0x4B, 0xE6, 0xBE, 0x7E, 0x7C, 0xCD, 0xBC, 0x6A, 0x54, 0xEA, 0xF8,
+    0xE8, 0xB3, 0x03, 0xAE, 0x7D, 0xA6, 0x60, 0xF5, 0x18, 0xCE, 0x4E, 0x6F, 0xAD, 0xDD, 0x7A, 0xDC,
+    0xF1, 0x12, 0x64, 0xD9, 0x81, 0xCE, 0x95, 0x0E, 0x50, 0x4B, 0xDC, 0x58, 0xBD, 0xEF, 0xF6, 0xF6,
+    0xF5, 0xE6, 0xAD, 0xB4, 0xB4, 0x88, 0x04, 0x01, 0x95, 0x6B, 0x28, 0x01, 0x7C, 0xA2, 0x06, 0xA4,
+    0xC4, 0x9C, 0x1D, 0x40, 0x4F, 0xF4, 0x18, 0x7F, 0xD4, 0xE3, 0xA9, 0xF2, 0x07, 0x68, 0xC2, 0x50,
+    0x3B, 0x31, 0xDE, 0x95, 0x29, 0xD7, 0x1B, 0xBD, 0x15, 0xD2, 0x89, 0x3F, 0xB5, 0xBB, 0x7A, 0xB3,
+    0x4C, 0xDE, 0xD6, 0xF6, 0x31, 0xB9, 0xA1, 0x7E, 0xD5, 0xC2, 0xDE, 0xA6, 0xD7, 0xB6, 0xC1, 0x02,
+    0x27, 0xC7, 0xF6, 0xC0, 0x9C, 0x45, 0xD5, 0x04, 0x17, 0x9D, 0xDA, 0x2E, 0xA1, 0x31, 0x95, 0xC3,
+    0xD5, 0x9B, 0x73, 0x73, 0x95, 0xEA, 0xA3, 0x12, 0xF2, 0x94, 0xF1, 0x30, 0x44, 0xFA, 0x8E, 0x2D,
+    0x57, 0x9A, 0xDF, 0x54, 0xA5, 0xA3, 0x7B, 0x85, 0x89, 0x74, 0xAC, 0x4B, 0x1D, 0xFC, 0x7E, 0xFD,
+    0x6D, 0xDB, 0x6C, 0xA5, 0x1B, 0xB8, 0xFE, 0x02, 0xCD, 0x95, 0xBD, 0x6E, 0xD4, 0x50, 0x10, 0x85,
+    0x8F, 0x6D, 0x25, 0x96, 0x70, 0x61, 0x9A, 0x34, 0x50, 0xB8, 0x27, 0x85, 0x1F, 0xC1, 0x16, 0x14,
+    0x14, 0x29, 0x92, 0x22, 0x5B, 0x51, 0xD0, 0x40, 0x41, 0x95, 0x47, 0x70, 0x52, 0x51, 0x42, 0x43,
+    0x1F, 0x24, 0x90, 0x92, 0xA5, 0x48, 0x8F, 0x10, 0x5E, 0x29, 0x0F, 0xC0, 0x46, 0x08, 0x51, 0xB2,
+    0x28, 0x91, 0x82, 0xD2, 0xE0, 0xC2, 0x12, 0x5E, 0xC9, 0xBE, 0x87, 0x33, 0x5E, 0x2B, 0x6C, 0xBA,
+    0x54, 0x24, 0x57, 0xDA, 0xF1, 0x95, 0xEF, 0xFC, 0x7E, 0x73, 0x3D, 0x4B, 0xF2, 0x37, 0xE9, 0x38,
+    0x3C, 0xBE, 0x8D, 0x36, 0x5B, 0x80, 0x13, 0xC4, 0xC3, 0xA3, 0x1B, 0x6D, 0xEB, 0xEC, 0x0B, 0xD9,
+    0xDA, 0xC3, 0x8D, 0x0F, 0x96, 0xCE, 0x96, 0x1E, 0x57, 0xBC, 0x00, 0x59, 0x8E, 0x78, 0x0A, 0x4F,
+    0x27, 0xD9, 0x2E, 0x82, 0x6E, 0x0B, 0xA9, 0x5E, 0x72, 0x06, 0xEF, 0x10, 0xDE, 0x7B, 0x20, 0x94,
+    0x8E, 0x2F, 0x97, 0x28, 0xC9, 0x2A, 0x76, 0x01, 0x1F, 0x72, 0x37, 0x6E, 0xB3, 0x0A, 0xE5, 0x31,
+    0x11, 0x76, 0x85, 0xFC, 0x7C, 0xD7, 0x6F, 0xD8, 0x40, 0x5E, 0x2A, 0x20, 0x60, 0x0E, 0xA4, 0x2D,
+    0x3C, 0x70, 0xFE, 0xA4, 0x0E, 0x75, 0x94, 0x27, 0x64, 0x8D, 0xD4, 0x02, 0xAE, 0x14, 0xBB, 0x40,
+    0x34, 0x93, 0xAA, 0x62, 0x22, 0x9D, 0x00, 0xBE, 0x6D, 0x12, 0x33, 0xA6, 0x8C, 0x7D, 0x87, 0x17,
+    0xF0, 0xDF, 0x12, 0xE5, 0x1E, 0x37, 0x1B, 0x8F, 0x9C, 0xF8, 0x0A, 0xEF, 0x73, 0x8A, 0x61, 0xC9,
+    0xDD, 0xA9, 0x7E, 0xAF, 0x94, 0x7E, 0x46, 0x36, 0x02, 0xF1, 0x48, 0xB6, 0x56, 0x9B, 0xC5, 0x56,
+    0x99, 0x01, 0x47, 0xA3, 0x58, 0x39, 0xEB, 0xB4, 0x92, 0xE2, 0x31, 0xC7, 0xE3, 0x2B, 0xA7, 0x4B,
+    0xCA, 0x57, 0x5D, 0xAD, 0xBE, 0xC6, 0x03, 0x64, 0xD3, 0xA4, 0x02, 0x37, 0x5A, 0x95, 0x4E, 0x4B,
+    0x4B, 0x09, 0x96, 0xF5, 0x10, 0xFA, 0xDE, 0x16, 0x50, 0x08, 0x4E, 0xAA, 0xAC, 0x22, 0x19, 0x0A,
+    0x54, 0x56, 0xA7, 0x0D, 0x68, 0x30, 0x8C, 0x4A, 0xB1, 0x04, 0xC3, 0x36, 0x3D, 0x0C, 0xA3, 0x22,
+    0x0F, 0xBE, 0x5C, 0xDD, 0x8D, 0xF9, 0xA6, 0xCC, 0x75, 0x5E, 0x7B, 0x46, 0x45, 0x64, 0x55, 0xD6,
+    0x5A, 0xEF, 0xFA, 0x9D, 0x44, 0x6C, 0xE0, 0x62, 0x91, 0x42, 0x34, 0x97, 0x59, 0xD4, 0x28, 0x95,
+    0xB0, 0xC6, 0x67, 0x2C, 0xAF, 0x1D, 0x9E, 0x59, 0x4B, 0x38, 0x09, 0x24, 0x2A, 0x13, 0x4D, 0xC0,
+    0xB9, 0xF7, 0xC9, 0x37, 0x7A, 0x3D, 0x42, 0x58, 0x5C, 0x6B, 0x80, 0x9C, 0x75, 0xE8, 0xFB, 0xB1,
+    0x36, 0xDA, 0xE2, 0x24, 0x66, 0x97, 0x99, 0x81, 0x2E, 0x0E, 0xF9, 0x95, 0x79, 0xC6, 0x5A, 0xC5,
+    0x84, 0x9D, 0xB5, 0x8A, 0x8F, 0x15, 0xBB, 0x98, 0xCA, 0x3C, 0xA9, 0x13, 0xE6, 0x51, 0x67, 0x21,
+    0x4C, 0x45, 0x29, 0xDA, 0xB6, 0x86, 0x0A, 0x3E, 0x53, 0xFB, 0x84, 0x00, 0xFE, 0xA1, 0x45, 0x6A,
+    0x54, 0x97, 0xF2, 0x8F, 0x3A, 0xAA, 0x69, 0x61, 0x8B, 0x22, 0xEF, 0xDB, 0xAA, 0xF5, 0xDC, 0x8E,
+    0xBB, 0x6C, 0x96, 0xF1, 0x8F, 0x53, 0x27, 0xF8, 0x93, 0xF3, 0xD2, 0x65, 0x8A, 0x7A, 0x2A, 0xCF,
+    0x4E, 0xD9, 0x15, 0xE7, 0x44, 0xE0, 0x8A, 0x19, 0xB2, 0x73, 0x67, 0x9B, 0x4A, 0x1B, 0x7B, 0x23,
+    0x4E, 0xE5, 0x29, 0x27, 0x89, 0x4B, 0x78, 0xC4, 0x99, 0x2C, 0x75, 0xE3, 0x58, 0xCC, 0x22, 0xBE,
+    0x74, 0x58, 0xC9, 0xA5, 0x8F, 0xC8, 0x99, 0xEF, 0x93, 0x33, 0x14, 0xAD, 0xEE, 0x14, 0xF7, 0x8C,
+    0x81, 0x36, 0x0D, 0xD6, 0xF9, 0x0B, 0xB8, 0xB3, 0x8B, 0x03, 0xF8, 0x35, 0x0A, 0x31, 0xB8, 0x50,
+    0x41, 0xCA, 0xD9, 0xFA, 0x47, 0x5D, 0x39, 0xFF, 0x23, 0x6E, 0x19, 0x46, 0x7F, 0x5F, 0xD7, 0x2D,
+    0xCD, 0xC3, 0xCA, 0xE3, 0x87, 0x6E, 0x91, 0x6A, 0x2A, 0x47, 0x58, 0xDF, 0xC7, 0x0D, 0x63, 0x84,
+    0x97, 0x5B, 0xBD, 0xA6, 0xE3, 0x19, 0xC0, 0x05, 0x89, 0xB8, 0xB1, 0xA4, 0x9E, 0xDD, 0x36, 0x8C,
+    0x80, 0x89, 0x6C, 0x6A, 0xC3, 0x6A, 0x88, 0xD6, 0x67, 0xBE, 0x9A, 0xDF, 0x38, 0xC6, 0x7E, 0xDD,
+    0xE7, 0x1C, 0xFD, 0xF8, 0xB4, 0x71, 0x63, 0xB5, 0x6A, 0x0A, 0xD2, 0xE5, 0x3B, 0x28, 0x0D, 0x49,
+    0xD6, 0x0F, 0x3F, 0x13, 0x11, 0x31, 0x8C, 0x4E, 0x70, 0xBA, 0x32, 0xDA, 0x5E, 0x86, 0x03, 0x83,
+    0x33, 0x35, 0x62, 0x8D, 0xE0, 0x6C, 0x48, 0xB3, 0x38, 0xD1, 0xA7, 0x97, 0xD4, 0x32, 0x0F, 0xBB,
+    0xD0, 0xA0, 0xE4, 0xA5, 0xC1, 0x89, 0x7B, 0x38, 0xDA, 0x76, 0xD6, 0x15, 0x05, 0xF6, 0xB6, 0x2F,
+    0x5B, 0x95, 0xF5, 0x4D, 0xB4, 0x59, 0x16, 0x58, 0x3C, 0xCF, 0x9A, 0x81, 0xD2, 0xC4, 0xDA, 0x62,
+    0xBA, 0xD9, 0x49, 0x35, 0xBC, 0x8B, 0x17, 0xA3, 0x78, 0x01, 0xF6, 0x1F, 0xC6, 0xF6, 0x06, 0x30,
+    0xFA, 0xE3, 0x9E, 0xCE, 0xC4, 0xA6, 0xB1, 0x94, 0x8B, 0x1F, 0xC6, 0x20, 0xE8, 0x10, 0x34, 0xF6,
+    0x9D, 0x5F, 0x2E, 0x29, 0x84, 0x9D, 0x44, 0xE4, 0xAE, 0x23, 0xBE, 0x8D, 0x9E, 0xDA, 0x9F, 0x20,
+    0x97, 0xC5, 0xC5, 0xF8, 0xC8, 0x5D, 0xDB, 0xC1, 0xA5, 0xC0, 0x7F, 0x5A, 0x7F, 0x01, 0xB5, 0x55,
+    0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x1D, 0xFB, 0x14, 0x56, 0xBA, 0x2D, 0x4C, 0x93, 0x02, 0x52, 0x5C,
+    0x4F, 0xE3, 0x4F, 0xB0, 0x3B, 0x5A, 0x8A, 0x5C, 0x4D, 0x43, 0x81, 0x68, 0xF8, 0x03, 0x7C, 0xA2,
+    0xA1, 0xA0, 0x39, 0x89, 0x92, 0x96, 0x02, 0x2E, 0x05, 0x7F, 0x90, 0x35, 0xA2, 0xA4, 0xC0, 0xA2,
+    0xA5, 0xC0, 0x22, 0x69, 0x20, 0x45, 0x5C, 0x38, 0xE0, 0x04, 0xDB, 0x8F, 0x37, 0x3E, 0xFB, 0x12,
+    0x90, 0x02, 0x5C, 0x12, 0xAC, 0xDD, 0xD9, 0x1D, 0xEF, 0x7A, 0x66, 0xF6, 0xBD, 0xF1, 0xAC, 0x3C,
+    0x98, 0x8B, 0x48, 0x80, 0x58, 0x64, 0x84, 0x9A, 0x53, 0xBC, 0x2E, 0x44, 0xA2, 0x2C, 0x49, 0xC5,
+    0x14, 0xD2, 0x4A, 0xFF, 0x78, 0xDB, 0x2A, 0x5D, 0x46, 0x61, 0x9B, 0x3F, 0x4D, 0x6F, 0xC4, 0x9C,
+    0x46, 0x98, 0x89, 0xFB, 0x04, 0x88, 0x05, 0x50, 0x89, 0xC3, 0x73, 0xA4, 0x16, 0xB3, 0x49, 0x2D,
+    0xAE, 0x10, 0x64, 0x16, 0x12, 0x34, 0xE2, 0x72, 0x6E, 0xB7, 0xAD, 0x7E, 0x49, 0x0B, 0x9C, 0x36,
+    0xFF, 0x3E, 0x1D, 0x41, 0x64, 0x52, 0x4A, 0x54, 0x88, 0x8F, 0x99, 0x2A, 0x61, 0x35, 0x76, 0x27,
+    0x8B, 0x1D, 0x7C, 0x41, 0xF7, 0x1C, 0x76, 0xB2, 0xDD, 0xC1, 0x62, 0xE1, 0xDA, 0xF9, 0xD9, 0x6D,
+    0x12, 0xE9, 0x36, 0x2A, 0x5D, 0x64, 0x91, 0x0E, 0xBF, 0x2B, 0xCB, 0x6D, 0xBF, 0x7C, 0xB3, 0x8E,
+    0xD2, 0x41, 0x65, 0xDA, 0x41, 0xBC, 0xC6, 0x22, 0x16, 0x35, 0xBC, 0x14, 0x3B, 0xAA, 0xF6, 0xAB,
+    0xDE, 0x0B, 0x31, 0x4D, 0x88, 0x99, 0x69, 0x80, 0xC2, 0x68, 0x0C, 0x06, 0xC7, 0xAE, 0x36, 0x48,
+    0x27, 0x8D, 0x51, 0x8C, 0x28, 0x6C, 0x63, 0xDA, 0x75, 0x85, 0x32, 0x11, 0x54, 0x26, 0x43, 0xEB,
+    0x48, 0x40, 0x15, 0x59, 0xA4, 0xA5, 0xB7, 0x3F, 0x50, 0xE9, 0x03, 0x79, 0x00, 0xA4, 0x3C, 0xAE,
+    0x3C, 0x44, 0x2E, 0x01, 0x59, 0x67, 0xE4, 0x82, 0x54, 0xF4, 0x1C, 0x6B, 0xA9, 0x0E, 0xB3, 0xC1,
+    0x14, 0xBA, 0xEC, 0x91, 0x24, 0x8B, 0x26, 0x38, 0xD8, 0xA3, 0xF6, 0x68, 0x0B, 0xB7, 0x53, 0x3B,
+    0x1F, 0xDC, 0x92, 0x6E, 0x92, 0x7D, 0xD1, 0x61, 0x73, 0x3A, 0xA5, 0x93, 0x65, 0x5B, 0xDA, 0x0B,
+    0xD1, 0x2E, 0xD5, 0x2D, 0x52, 0xC7, 0x70, 0xD6, 0x69, 0x96, 0xA0, 0x0C, 0xD6, 0xA6, 0xD3, 0xA9,
+    0x23, 0x50, 0x68, 0x13, 0x34, 0x03, 0x40, 0xB3, 0x0B, 0xB4, 0xFB, 0x32, 0x7E, 0x92, 0x7B, 0x75,
+    0xF4, 0x15, 0x8F, 0xC9, 0xA6, 0x25, 0x1A, 0xE3, 0xE3, 0xE1, 0xEC, 0x8C, 0x95, 0x39, 0x56, 0xD0,
+    0x9B, 0xE7, 0x34, 0x11, 0xD2, 0x0E, 0xC7, 0x75, 0x07, 0x46, 0xDD, 0x5B, 0xD1, 0xE1, 0x96, 0xF8,
+    0xCF, 0x0A, 0xD9, 0x0D, 0x4F, 0x90, 0x02, 0xE5, 0x88, 0xC1, 0x5F, 0x5B, 0xF9, 0xBB, 0x24, 0xD8,
+    0x0E, 0x3F, 0xBA, 0xFF, 0xE7, 0xA3, 0x3A, 0x54, 0xCF, 0x64, 0x1C, 0xE9, 0x5F, 0xA7, 0x21, 0xF6,
+    0xD0, 0x3F, 0x12, 0x64, 0xD2, 0x68, 0x01, 0x89, 0x78, 0xDA, 0x6D, 0x1F, 0xF9, 0x88, 0xFF, 0xC5,
+    0x2B, 0x2F, 0x4E, 0x3E, 0xE0, 0x69, 0x3B, 0x29, 0x37, 0x3A, 0x50, 0x2A, 0xF7, 0x99, 0xDA, 0x79,
+    0x43, 0xBE, 0x6B, 0xF3, 0xC8, 0xAF, 0xED, 0xD1, 0x5D, 0x44, 0xF5, 0xCD, 0xB9, 0x5C, 0x17, 0x5B,
+    0xAD, 0x5C, 0x7A, 0x7D, 0x5A, 0x5D, 0x41, 0xA4, 0xB6, 0x75, 0x07, 0xE7, 0xB4, 0xDC, 0xA1, 0xF2,
+    0x91, 0x70, 0x93, 0x16, 0xB3, 0x34, 0x3C, 0x22, 0x79, 0xB6, 0xA1, 0x1D, 0x1F, 0x31, 0x29, 0x71,
+    0x19, 0x8D, 0x85, 0xA5, 0x32, 0x73, 0xD9, 0x97, 0x21, 0xF2, 0xB3, 0x8E, 0xBE, 0x6B, 0x06, 0x69,
+    0x36, 0x8E, 0xB4, 0x2E, 0x2B, 0xFD, 0x32, 0x85, 0x96, 0x65, 0x94, 0x5A, 0xAB, 0x2B, 0x5D, 0xA8,
+    0x74, 0x61, 0x5F, 0x08, 0xE5, 0x9D, 0x24, 0x1B, 0x35, 0x2E, 0x37, 0x70, 0xB9, 0x05, 0xE7, 0x2D,
+    0xDF, 0xDD, 0x3B, 0xCD, 0x04, 0xD3, 0x5E, 0x45, 0x5F, 0x56, 0x33, 0xED, 0x9A, 0x27, 0x13, 0x96,
+    0x62, 0xD4, 0x7D, 0x2F, 0xC4, 0x30, 0xCC, 0xF1, 0x4B, 0xC6, 0xA7, 0x29, 0x84, 0x98, 0x47, 0xC9,
+    0x4C, 0x15, 0x94, 0x41, 0xE6, 0xD7, 0xAB, 0x94, 0xD4, 0x3C, 0xFE, 0xDF, 0x9D, 0x35, 0x78, 0xD3,
+    0x95, 0x92, 0x30, 0xA4, 0x04, 0x19, 0x7B, 0x2C, 0x89, 0xE2, 0xC4, 0x3B, 0x6E, 0x82, 0xEE, 0x7E,
+    0xE3, 0xED, 0x16, 0x65, 0xEE, 0x5D, 0xEE, 0x35, 0x2B, 0x80, 0xB2, 0xAE, 0x62, 0x5E, 0x7E, 0x20,
+    0x26, 0xE4, 0x4E, 0xD9, 0x01, 0x8B, 0x70, 0x1B, 0x2B, 0x6D, 0x61, 0xA5, 0x44, 0x17, 0x48, 0x3D,
+    0x64, 0x9A, 0x81, 0xE4, 0x3D, 0x68, 0x35, 0x01, 0x19, 0x49, 0xAA, 0x77, 0xE1, 0x1B, 0x86, 0x89,
+    0xB7, 0x5A, 0x13, 0xDE, 0x13, 0x3B, 0x1C, 0xEA, 0xCF, 0xAE, 0x75, 0x48, 0x33, 0xB3, 0xBF, 0x35,
+    0xBE, 0x75, 0x25, 0x0B, 0x9A, 0xB7, 0x49, 0x39, 0x7C, 0xDB, 0x59, 0x31, 0x6A, 0x6F, 0xC4, 0x35,
+    0x6E, 0xC8, 0x7B, 0x47, 0x12, 0x9D, 0x42, 0xCE, 0x34, 0xD1, 0x63, 0x1A, 0x7D, 0x63, 0x15, 0x87,
+    0xA0, 0x50, 0xA1, 0xD7, 0xF5, 0x46, 0xDC, 0xEF, 0xF8, 0x09, 0xCD, 0x55, 0xBB, 0x6E, 0xD4, 0x40,
+    0x14, 0xBD, 0x5E, 0x6B, 0xB1, 0x14, 0x17, 0x6E, 0xD8, 0x86, 0x66, 0x3E, 0xC1, 0x9F, 0x60, 0x4B,
+    0x94, 0x29, 0xA0, 0x20, 0x3D, 0x35, 0x3F, 0x61, 0xA3, 0x14, 0x14, 0x69, 0xD2, 0xD3, 0xA4, 0x48,
+    0x01, 0xF9, 0x06, 0x94, 0x59, 0x89, 0x22, 0x05, 0xC5, 0x5A, 0x50, 0x50, 0x6C, 0x63, 0x44, 0x49,
+    0x33, 0x41, 0x23, 0x61, 0x94, 0xB1, 0x0F, 0xE7, 0x7A, 0x93, 0x10, 0xA4, 0x2C, 0x6C, 0x22, 0x22,
+    0x65, 0x34, 0x33, 0x3A, 0x33, 0xBE, 0x33, 0xF7, 0xCC, 0x7D, 0x79, 0x56, 0x8A, 0x44, 0xA8, 0x45,
+    0x92, 0x41, 0x44, 0x4C, 0xC7, 0xA9, 0x6A, 0xAF, 0xDB, 0xC2, 0x17, 0xD4, 0xD9, 0xC0, 0x2D, 0xB4,
+    0xA6, 0xCB, 0xC0, 0x2D, 0xEB, 0x22, 0xEC, 0x41, 0x92, 0xBE, 0x72, 0x62, 0xCE, 0x50, 0x4A, 0x85,
+    0x81, 0x07, 0xD1, 0x4B, 0x02, 0x04, 0x31, 0x43, 0x1E, 0x28, 0x55, 0x74, 0xBC, 0xAB, 0xF2, 0x3C,
+    0x68, 0x1D, 0xEF, 0x82, 0x3B, 0xBF, 0x2B, 0x42, 0x23, 0x97, 0x2D, 0x09, 0x9C, 0x72, 0xC7, 0x89,
+    0xD7, 0x48, 0xAC, 0x2B, 0x33, 0xE7, 0xF4, 0xF0, 0xFC, 0x3B, 0xAF, 0x98, 0xE0, 0xD5, 0x20, 0x79,
+    0x67, 0x78, 0xDD, 0xBC, 0x6A, 0x4D, 0xE0, 0x16, 0xE6, 0xC9, 0x90, 0xF5, 0x64, 0xC8, 0xAB, 0xAA,
+    0x6F, 0xA3, 0x6E, 0xAF, 0xBA, 0x49, 0x47, 0xA7, 0xAA, 0x47, 0xAB, 0x52, 0x4D, 0x32, 0xF0, 0x8C,
+    0xE9, 0x26, 0x7A, 0x30, 0xC6, 0x4B, 0xD4, 0xB1, 0xDE, 0x95, 0x50, 0xD5, 0x8B, 0x03, 0x51, 0x1E,
+    0x31, 0x44, 0x32, 0x2A, 0xCD, 0xF9, 0xF2, 0xAA, 0xFC, 0x4D, 0xAB, 0xE0, 0xBA, 0x70, 0xFF, 0x71,
+    0x00, 0xC3, 0xD5, 0x21, 0x47, 0xFB, 0x79, 0x48, 0x20, 0xA8, 0x8B, 0x26, 0x6D, 0xF5, 0x9D, 0xCF,
+    0xC4, 0x36, 0x69, 0x7F, 0xFB, 0xE9, 0xEE, 0x29, 0x5F, 0xB4, 0x94, 0xF6, 0xCA, 0x18, 0x1B, 0x19,
+    0x85, 0x0C, 0x95, 0xE6, 0xF4, 0xD7, 0x54, 0x64, 0xB6, 0xDD, 0xDB, 0xE5, 0xBF, 0xBB, 0x1A, 0xF7,
+    0x6B, 0x5F, 0x9C, 0xF8, 0xE3, 0x69, 0x49, 0xCA, 0x78, 0xC2, 0x50, 0x79, 0x0F, 0xC9, 0x1B, 0xCC,
+    0x53, 0x57, 0xB8, 0xD8, 0xD3, 0x1D, 0x87, 0xEA, 0x16, 0xC1, 0x7C, 0x45, 0x44, 0xFD, 0x73, 0x93,
+    0x0D, 0x72, 0xCD, 0x00, 0xEC, 0x72, 0xB4, 0x1C, 0xDD, 0xAC, 0xDC, 0xC9, 0x7D, 0xB1, 0xEC, 0xCD,
+    0x77, 0x6C, 0x7B, 0xFB, 0x31, 0xE4, 0x3E, 0xD0, 0x62, 0x13, 0x06, 0x01, 0xAD, 0x96, 0x7B, 0xB9,
+    0xCD, 0x62, 0x03, 0x6B, 0x47, 0x65, 0xE1, 0x32, 0x5F, 0xB8, 0xBC, 0xE3, 0x08, 0x85, 0x33, 0x7E,
+    0xB5, 0xB7, 0x99, 0xB5, 0x67, 0xA3, 0xA6, 0xF5, 0xFD, 0xA9, 0xFD, 0x44, 0x6B, 0x42, 0xFB, 0xE7,
+    0xDE, 0x36, 0xCF, 0xFF, 0x2A, 0xBC, 0x32, 0x8E, 0xAA, 0x59, 0x07, 0x4E, 0x4B, 0x82, 0x77, 0x4A,
+    0xA3, 0x25, 0x80, 0x82, 0x92, 0xB9, 0x54, 0x4B, 0xCA, 0x74, 0x62, 0x7A, 0xAB, 0x1C, 0x41, 0x72,
+    0xCD, 0x71, 0x5A, 0x59, 0x09, 0x5F, 0x02, 0xD9, 0xD1, 0xA4, 0x5D, 0xDF, 0x0F, 0x22, 0xF8, 0x08,
+    0xCC, 0xE2, 0x3E, 0xD1, 0x03, 0x35, 0x3B, 0x15, 0x6D, 0xAD, 0x91, 0x67, 0x66, 0x1C, 0xD5, 0xAA,
+    0x8B, 0x36, 0x97, 0x4C, 0xA3, 0x67, 0xA2, 0xAA, 0xC5, 0xEA, 0x66, 0x76, 0xA5, 0x90, 0xA8, 0xF7,
+    0x29, 0x53, 0x2D, 0x18, 0x03, 0x49, 0xD0, 0x70, 0x25, 0xF4, 0x0A, 0xB9, 0x41, 0xD8, 0x2B, 0xB4,
+    0xAC, 0x0D, 0x8B, 0x1F, 0xA8, 0x09, 0x35, 0xEE, 0x16, 0xDE, 0x3A, 0xC2, 0xC7, 0x28, 0x09, 0x99,
+    0x8F, 0x01, 0x25, 0x9A, 0x6A, 0xD1, 0x25, 0x20, 0xAC, 0x8B, 0x8E, 0x50, 0x70, 0x42, 0x98, 0x42,
+    0x61, 0x71, 0x16, 0x94, 0x13, 0x08, 0x33, 0x10, 0xD2, 0x2E, 0x84, 0x93, 0x11, 0x66, 0x0A, 0xC5,
+    0x32, 0x10, 0xB7, 0xDE, 0x2A, 0x47, 0x06, 0xA2, 0x6D, 0x57, 0x35, 0x34, 0x56, 0xD6, 0xC7, 0x17,
+    0x24, 0xA3, 0x43, 0xB1, 0xBB, 0xE8, 0x52, 0xF2, 0x72, 0x96, 0x36, 0xDB, 0xC3, 0x4F, 0x1B, 0x2C,
+    0x6B, 0xDB, 0x07, 0xF0, 0x7D, 0x24, 0x88, 0xE5, 0xC0, 0x58, 0x53, 0xBF, 0x31, 0x59, 0x36, 0x03,
+    0xF7, 0xE3, 0xE1, 0x57, 0x5A, 0x35, 0x3F, 0xAF, 0x13, 0xAB, 0xB2, 0x3E, 0x96, 0x0A, 0x89, 0xC6,
+    0xF5, 0x74, 0x14, 0x78, 0x54, 0xA6, 0x1D, 0x1D, 0x6F, 0x17, 0x40, 0xAA, 0x39, 0x6A, 0xF1, 0x9A,
+    0x06, 0xA8, 0x4D, 0x18, 0x0D, 0x30, 0x5A, 0xA2, 0xBD, 0x81, 0x01, 0x56, 0x51, 0xFE, 0x47, 0xF5,
+    0x1E, 0x7F, 0x25, 0x15, 0xA3, 0x24, 0x55, 0xDD, 0x5A, 0xBD, 0xA6, 0xCA, 0xE4, 0x8D, 0x3C, 0xD8,
+    0x97, 0xB4, 0x53, 0x9F, 0xE4, 0xA7, 0xCA, 0x0D, 0xFA, 0x37, 0x8A, 0xA1, 0xFF, 0x3A, 0x33, 0xDC,
+    0xC3, 0x70, 0xBA, 0xB3, 0xF6, 0x0B, 0xD5, 0x55, 0xB1, 0xAE, 0xD4, 0x46, 0x14, 0xBD, 0xF6, 0x0A,
+    0x8C, 0x9E, 0x0B, 0x57, 0x14, 0x21, 0x85, 0x7B, 0x9A, 0xFD, 0x03, 0xC6, 0x49, 0x24, 0x28, 0x1F,
+    0xC5, 0xDB, 0x22, 0x4A, 0x41, 0xC5, 0x77, 0xD8, 0xD2, 0x2B, 0xD3, 0x50, 0x24, 0x55, 0x9A, 0x44,
+    0x4A, 0x24, 0xF2, 0x28, 0xF8, 0x84, 0xD9, 0x88, 0x82, 0x82, 0xE2, 0xB9, 0xA1, 0xA2, 0xC0, 0xC5,
+    0x93, 0x12, 0xA5, 0x1A, 0x24, 0x83, 0xFC, 0x5E, 0xC6, 0x7B, 0x72, 0xCE, 0x78, 0x91, 0x16, 0xD1,
+    0x90, 0x26, 0x12, 0x23, 0xED, 0xF8, 0xCC, 0xCC, 0x9D, 0x7B, 0xCF, 0x9C, 0xB9, 0x73, 0xF7, 0xFA,
+    0x23, 0xBB, 0x6D, 0xED, 0x76, 0x3D, 0x64, 0x38, 0x9E, 0xAC, 0x00, 0xCC, 0xD6, 0xD8, 0x9A, 0xF9,
+    0xD1, 0x96, 0x96, 0xFD, 0x6A, 0xFE, 0x14, 0x53, 0x19, 0x81, 0xE0, 0x01, 0x7C, 0x8F, 0x4B, 0x1F,
+    0xFD, 0x94, 0xE1, 0x05, 0xAC, 0x9A, 0x7D, 0x30, 0xBC, 0xDA, 0x59, 0x39, 0xFB, 0xDE, 0xFC, 0xAB,
+    0xF9, 0x13, 0x41, 0x11, 0xE5, 0x39, 0x47, 0x0A, 0xA0, 0x68, 0x66, 0xAE, 0x57, 0x5F, 0x07, 0xF5,
+    0xC5, 0x64, 0x76, 0xAB, 0xC9, 0xE7, 0x7A, 0xF0, 0x30, 0x14, 0x8A, 0x7C, 0x33, 0x63, 0x68, 0xDA,
+    0xB7, 0xF8, 0x89, 0xF6, 0x35, 0xAC, 0x1D, 0x49, 0x96, 0x04, 0x2C, 0xC3, 0x36, 0x47, 0x63, 0x6D,
+    0x30, 0xBA, 0xAF, 0x27, 0x5B, 0x73, 0x41, 0x84, 0xB8, 0xD0, 0xA5, 0x85, 0xE1, 0x53, 0x17, 0xC0,
+    0xB0, 0xED, 0x39, 0x7A, 0x53, 0xC4, 0x04, 0xA7, 0x04, 0x7B, 0x41, 0x08, 0xFA, 0x48, 0xF8, 0x0E,
+    0x03, 0xE1, 0x31, 0x29, 0x9C, 0x8F, 0x6D, 0x24, 0xFC, 0x1A, 0x03, 0x61, 0x85, 0x7B, 0x11, 0x9D,
+    0x8B, 0xED, 0x39, 0xB5, 0xF9, 0x93, 0xB0, 0x82, 0x3F, 0x9F, 0xCC, 0x81, 0x90, 0xE4, 0x09, 0x4B,
+    0x41, 0x4E, 0x10, 0x66, 0x09, 0x96, 0x82, 0xE6, 0x04, 0xB3, 0x04, 0xCB, 0xA4, 0x4B, 0x2B, 0x41,
+    0x12, 0xCC, 0xD3, 0x4D, 0x80, 0x57, 0x51, 0x62, 0x67, 0x82, 0x1D, 0xD5, 0x51, 0x67, 0x5F, 0x34,
+    0xE5, 0xE4, 0xD0, 0xF9, 0xD7, 0x40, 0x49, 0x65, 0x26, 0x4F, 0x61, 0x5E, 0xA0, 0xAB, 0x63, 0xBA,
+    0x91, 0x74, 0x35, 0xC3, 0x7F, 0xB8, 0x11, 0x01, 0xDE, 0x00, 0xD5, 0xB1, 0x04, 0x28, 0x6C, 0x8A,
+    0x4E, 0xCE, 0x0A, 0xDB, 0x10, 0x0C, 0x64, 0x76, 0xC1, 0x7C, 0xD8, 0x6C, 0xEE, 0x8B, 0x84, 0xC6,
+    0x87, 0xFD, 0x61, 0xCB, 0x12, 0xD1, 0x1A, 0x52, 0x54, 0x39, 0x43, 0x57, 0x6C, 0xDB, 0x02, 0x17,
+    0x05, 0x86, 0x8A, 0xDE, 0x10, 0x6A, 0x06, 0x70, 0xD3, 0x9A, 0xDE, 0xD7, 0xD1, 0xD1, 0xAC, 0x8E,
+    0x6E, 0x54, 0xD8, 0x7D, 0x1F, 0x0E, 0xFA, 0xC3, 0x79, 0x5A, 0x56, 0x71, 0xD9, 0xB5, 0x78, 0xA8,
+    0xA0, 0x5C, 0xA5, 0xDB, 0x02, 0x61, 0x95, 0xA2, 0x98, 0xFA, 0x86, 0x59, 0x2C, 0xEA, 0x0C, 0xFC,
+    0x48, 0x84, 0x48, 0xD9, 0x36, 0x9B, 0x13, 0xA3, 0x49, 0xB0, 0x4A, 0x56, 0x0E, 0xD8, 0xB3, 0xBD,
+    0xF6, 0x83, 0xCE, 0xB0, 0x4B, 0x54, 0x1B, 0x89, 0xD9, 0xB8, 0xF9, 0x01, 0x78, 0xFA, 0x6A, 0xAE,
+    0xA2, 0x88, 0x05, 0x73, 0x6F, 0xE4, 0xF7, 0xF9, 0x8E, 0xFB, 0x99, 0x30, 0x55, 0x64, 0xB6, 0xB9,
+    0xA0, 0xA9, 0x67, 0xDC, 0xB1, 0x2B, 0x61, 0x8E, 0xF7, 0xFF, 0x04, 0xDB, 0x5A, 0x41, 0x6B, 0x24,
+    0xE1, 0x48, 0xD5, 0x4E, 0xF8, 0x3B, 0xEA, 0xEC, 0x31, 0x95, 0xED, 0x73, 0x4E, 0x14, 0xBB, 0xA7,
+    0x3C, 0xC7, 0x6A, 0x11, 0x2C, 0x89, 0x64, 0xB7, 0xFE, 0xB2, 0xCF, 0x40, 0xBC, 0xEC, 0x67, 0x96,
+    0x89, 0x62, 0xC8, 0xA2, 0x55, 0x57, 0x4C, 0xAC, 0xF5, 0x52, 0x27, 0x18, 0xE2, 0xE8, 0xF2, 0x3D,
+    0xEF, 0x6F, 0x1B, 0x3D, 0xCF, 0x81, 0x27, 0x67, 0xC2, 0x92, 0xF8, 0xB8, 0xC2, 0x4B, 0x04, 0x86,
+    0x43, 0x8F, 0x6D, 0x46, 0xA5, 0x24, 0x5E, 0x94, 0x78, 0x83, 0xF4, 0xEC, 0xA8, 0xA7, 0xA6, 0x2A,
+    0x4D, 0x91, 0xA0, 0x1F, 0x3C, 0x39, 0x34, 0xB8, 0xF2, 0x51, 0x6F, 0x9D, 0x3B, 0x96, 0xD4, 0xA3,
+    0x16, 0xD7, 0x1A, 0xF9, 0x3F, 0xBB, 0xFB, 0xD8, 0x16, 0xFD, 0xAD, 0x98, 0x1D, 0x05, 0xAC, 0x82,
+    0xE7, 0xE2, 0xFA, 0x0F, 0xE5, 0xEC, 0x9D, 0x3C, 0x7C, 0x0E, 0x32, 0xDA, 0xED, 0x5F, 0xCE, 0x38,
+    0x3E, 0xE6, 0x99, 0x47, 0x4F, 0xAB, 0x7B, 0xD1, 0x8A, 0xD1, 0x75, 0x76, 0x27, 0x1B, 0xFF, 0x2F,
+    0x19, 0xF7, 0x6D, 0x2D, 0x86, 0xF3, 0xF2, 0x41, 0x5F, 0xA5, 0xCF, 0x9C, 0x24, 0xE2, 0xB0, 0x9D,
+    0xAD, 0xBD, 0xDC, 0x9C, 0x54, 0x12, 0x8D, 0x9B, 0x58, 0x01, 0x59, 0x23, 0x79, 0xDC, 0x34, 0x5C,
+    0xD1, 0x97, 0x86, 0x0C, 0x96, 0xE3, 0xC7, 0xCD, 0x37, 0x29, 0x13, 0xA0, 0x57, 0xA2, 0xED, 0xCF,
+    0x0E, 0x87, 0x7F, 0x9F, 0x9D, 0x4A, 0x85, 0xF7, 0xC6, 0x4D, 0x2A, 0x29, 0x1A, 0xD6, 0x71, 0xEF,
+    0x39, 0xA4, 0x61, 0x81, 0xBE, 0xD0, 0xD0, 0x2D, 0x34, 0x6C, 0x4F, 0x23, 0xDF, 0x0F, 0xAF, 0x2F,
+    0xC3, 0xE5, 0x39, 0x51, 0xC8, 0xDF, 0x2C, 0x7B, 0xC8, 0x0F, 0x58, 0xFE, 0x44, 0x0D, 0x60, 0x11,
+    0x1C, 0xF6, 0xDC, 0x87, 0x9A, 0x85, 0x10, 0x5F, 0x51, 0xAC, 0x61, 0x45, 0xEF, 0x38, 0x65, 0xE1,
+    0x46, 0x93, 0x27, 0xC9, 0x58, 0xE8, 0x92, 0x6A, 0x34, 0x4B, 0xC2, 0xB1, 0xA5, 0x27, 0xCD, 0x96,
+    0x5E, 0xB5, 0x6A, 0xAF, 0x1E, 0x76, 0xFA, 0x53, 0xCA, 0xF5, 0x46, 0x73, 0x3D, 0xE9, 0xDE, 0x6E,
+    0xAC, 0xF0, 0x0F, 0xF0, 0xF6, 0xBB, 0x50, 0x2C, 0x41, 0x98, 0x45, 0xF4, 0x90, 0x72, 0x6A, 0xA6,
+    0xB6, 0xAC, 0x8A, 0x37, 0x29, 0xAF, 0xEE, 0xF7, 0xE8, 0x77, 0x4B, 0x42, 0x25, 0x4F, 0x74, 0x43,
+    0xD9, 0x57, 0xCA, 0xCF, 0xF2, 0x83, 0x0A, 0xE9, 0x70, 0xD5, 0x88, 0xC6, 0xA8, 0x6E, 0x97, 0x08,
+    0x75, 0x2E, 0x7C, 0x89, 0xAD, 0x0B, 0x19, 0x7A, 0x12, 0xF8, 0xB0, 0xCB, 0xB4, 0x50, 0xD2, 0x44,
+    0x21, 0x9D, 0x32, 0xDA, 0x49, 0x0E, 0xA7, 0x5A, 0xE6, 0x02, 0xA5, 0x75, 0x81, 0xC7, 0xA3, 0x09,
+    0x5D, 0xE9, 0xF2, 0x5D, 0xC8, 0xB5, 0xC3, 0x30, 0xB0, 0x6B, 0x47, 0xD5, 0x2F, 0xDD, 0x47, 0xB5,
+    0xB3, 0x8F, 0xDB, 0xBF, 0xC5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0xDB, 0x0A, 0x27, 0xC5,
+    0x85, 0x2B, 0x90, 0x20, 0x12, 0xEE, 0x8F, 0xC2, 0x3F, 0x61, 0x9D, 0x34, 0x14, 0x29, 0xA0, 0x40,
+    0xA2, 0xA0, 0xA0, 0x86, 0x26, 0xFF, 0x20, 0x36, 0x75, 0x9A, 0x2B, 0xA0, 0x26, 0x45, 0x90, 0x50,
+    0x24, 0xFE, 0x02, 0xEB, 0x08, 0xD1, 0xBB, 0x82, 0x82, 0xC6, 0x91, 0x82, 0x28, 0xB3, 0x91, 0x2E,
+    0xC8, 0x87, 0xF6, 0x3C, 0xBC, 0xB7, 0x77, 0x10, 0x90, 0x42, 0x1A, 0x22, 0xDD, 0x48, 0x9E, 0xB3,
+    0x77, 0xE7, 0x63, 0xDF, 0x9B, 0x99, 0x3D, 0x89, 0x0E, 0x6B, 0xA9, 0xA6, 0x92, 0x79, 0x49, 0x54,
+    0xC4, 0xD6, 0x92, 0xB7, 0x12, 0x24, 0x9A, 0xD8, 0x2D, 0xDD, 0xEE, 0xED, 0xD4, 0x9E, 0x6A, 0xAA,
+    0xEA, 0xAC, 0x6E, 0xA6, 0x5A, 0x8B, 0x75, 0x92, 0x0E, 0x30, 0x6C, 0x25, 0x9D, 0x5F, 0xFD, 0x63,
+    0xF4, 0x47, 0x09, 0xA5, 0x53, 0xAA, 0x81, 0x4A, 0x6B, 0xE3, 0x36, 0xB4, 0x31, 0x2E, 0xD2, 0xD6,
+    0x38, 0xF9, 0x5B, 0x45, 0xDC, 0x40, 0x06, 0xDA, 0xD1, 0xB8, 0xA7, 0x6A, 0xA9, 0x9C, 0x18, 0x67,
+    0x10, 0xC5, 0xE5, 0x1E, 0x0A, 0xD9, 0x8D, 0x4B, 0xB4, 0x34, 0x2E, 0xA6, 0x87, 0x68, 0x07, 0x55,
+    0x4D, 0xA1, 0x8C, 0x87, 0xCA, 0x06, 0xB9, 0x90, 0x08, 0x90, 0x24, 0xA6, 0x4A, 0xE6, 0x54, 0x1E,
+    0x6A, 0xE4, 0xB8, 0xF1, 0x90, 0xDB, 0xB7, 0x8B, 0xD6, 0x7E, 0xE9, 0xED, 0x77, 0xB5, 0xDE, 0xAA,
+    0x16, 0xDA, 0x6E, 0x6B, 0x8D, 0xA0, 0x62, 0x3B, 0x29, 0xA6, 0xC4, 0x10, 0x6B, 0x49, 0x34, 0x97,
+    0x7C, 0x2C, 0x25, 0xEB, 0x43, 0x64, 0x64, 0xA8, 0x4A, 0x29, 0x6A, 0x59, 0x2B, 0x45, 0x6E, 0x4C,
+    0x64, 0x8C, 0x54, 0xF1, 0x80, 0xF4, 0x0F, 0x90, 0xB1, 0x02, 0x00, 0x29, 0x10, 0x56, 0x52, 0x44,
+    0xB8, 0x90, 0x55, 0xF1, 0x33, 0x96, 0xE8, 0x40, 0xCB, 0xAA, 0xD1, 0x3D, 0x2F, 0x8C, 0xA0, 0x73,
+    0x1C, 0xB4, 0xFB, 0x55, 0x74, 0x50, 0xD2, 0xDA, 0x3D, 0xDD, 0x02, 0x27, 0xAC, 0x3A, 0x48, 0x29,
+    0x6D, 0x2F, 0x64, 0x85, 0x65, 0x07, 0x78, 0x72, 0x40, 0x2A, 0x48, 0xC2, 0xE5, 0x9F, 0x90, 0xF1,
+    0x3E, 0xF0, 0xF5, 0x58, 0xE9, 0x17, 0xAB, 0x39, 0x28, 0xC8, 0xBA, 0x3F, 0xC0, 0xEF, 0xE8, 0x44,
+    0xC0, 0x79, 0x0D, 0x30, 0x5D, 0x85, 0x3C, 0xC6, 0x47, 0x3D, 0x7A, 0x30, 0x34, 0xA1, 0x90, 0x2B,
+    0xE3, 0xC9, 0x17, 0x5C, 0x60, 0x24, 0x99, 0xB2, 0xAD, 0x00, 0x34, 0x01, 0x76, 0x7C, 0x21, 0x47,
+    0x85, 0xFD, 0x51, 0x30, 0xFE, 0x08, 0xE3, 0xB3, 0x19, 0x52, 0x21, 0xCE, 0x3C, 0x07, 0x95, 0x23,
+    0xD2, 0xB9, 0x03, 0x82, 0x42, 0x39, 0x44, 0x9E, 0xEF, 0xC3, 0x12, 0x54, 0xBB, 0x10, 0xBD, 0xE8,
+    0x24, 0x5A, 0xD6, 0x6F, 0xED, 0x0D, 0x8E, 0xAE, 0x13, 0xF8, 0x7D, 0xA0, 0x6B, 0x1F, 0xBB, 0xAA,
+    0x05, 0x17, 0x2D, 0xEC, 0x50, 0x64, 0x04, 0x01, 0x03, 0x25, 0xA2, 0xA1, 0xEE, 0x74, 0x44, 0xC6,
+    0xE2, 0x1C, 0x13, 0xF0, 0x79, 0xF6, 0x44, 0x91, 0x87, 0xF9, 0x6A, 0x0B, 0xCB, 0xD0, 0x4C, 0xEB,
+    0x6F, 0x79, 0xB0, 0x1A, 0x2E, 0xEC, 0x0F, 0x2D, 0xD3, 0x3E, 0x73, 0xC9, 0x54, 0xDE, 0xAF, 0x04,
+    0xF2, 0x78, 0x02, 0x37, 0xF6, 0x46, 0x1B, 0x0F, 0x55, 0x53, 0x74, 0xD5, 0xD1, 0x9C, 0xDD, 0x79,
+    0xCD, 0x90, 0x29, 0x1B, 0x7A, 0x82, 0xDE, 0x46, 0x8F, 0x61, 0x13, 0x06, 0x3E, 0x53, 0xD9, 0xBD,
+    0x00, 0xC4, 0xAA, 0x2B, 0x27, 0xB0, 0x67, 0xBB, 0x77, 0xC4, 0x82, 0x31, 0x51, 0x4F, 0x88, 0x4D,
+    0x48, 0x29, 0xB9, 0x72, 0x4C, 0x69, 0x7C, 0x56, 0xE2, 0x16, 0xDA, 0x2D, 0xD3, 0x01, 0x71, 0xF4,
+    0x3E, 0x9E, 0x17, 0x9C, 0x88, 0x0D, 0x9C, 0x49, 0x12, 0xCE, 0x2C, 0x8B, 0x56, 0xE1, 0x25, 0xE2,
+    0x84, 0x1B, 0x32, 0xCD, 0x53, 0x63, 0xC1, 0xB2, 0xB1, 0x6E, 0xBD, 0xE4, 0xF1, 0x37, 0xE1, 0x92,
+    0x61, 0xA4, 0xAA, 0x2E, 0x3D, 0x42, 0x2A, 0x96, 0x9D, 0xD4, 0x15, 0x38, 0x40, 0x01, 0x42, 0x73,
+    0xE5, 0x18, 0x23, 0xBD, 0xA5, 0xDB, 0x27, 0xBC, 0x3F, 0xFD, 0xBA, 0xE3, 0x01, 0xEA, 0x18, 0xFC,
+    0xC5, 0x1C, 0x86, 0xB4, 0x0D, 0xB1, 0x43, 0x1B, 0x9B, 0x86, 0x93, 0x1D, 0x9F, 0x7A, 0x44, 0x6E,
+    0x24, 0x07, 0x86, 0xF5, 0x5A, 0x9E, 0x25, 0x73, 0xDC, 0x2A, 0xE6, 0x58, 0x17, 0x60, 0x4C, 0xC8,
+    0x52, 0xAF, 0xA2, 0xCA, 0x57, 0xCC, 0xF1, 0x35, 0x56, 0x19, 0xEF, 0x7A, 0x8E, 0x47, 0xBF, 0x51,
+    0xBD, 0xC6, 0x33, 0xDC, 0x7C, 0xAC, 0xAF, 0x1E, 0xF1, 0x1F, 0x63, 0x51, 0xE1, 0x80, 0x2A, 0xC0,
+    0xBB, 0xA6, 0x25, 0x01, 0x40, 0x49, 0x4F, 0x64, 0x71, 0x7D, 0x48, 0xCA, 0xF5, 0x82, 0xF5, 0x08,
+    0xAC, 0xF4, 0xF4, 0x59, 0xDC, 0xA3, 0xBC, 0xCA, 0x2D, 0xBC, 0x1D, 0xB0, 0x11, 0x8A, 0x37, 0x01,
+    0xB0, 0xBF, 0xA7, 0x87, 0xF5, 0x72, 0xDA, 0xFF, 0xFD, 0xC3, 0x46, 0x7C, 0x17, 0x81, 0xB8, 0x14,
+    0xC4, 0xF1, 0x7A, 0xCE, 0x6B, 0x89, 0x67, 0xCB, 0x2B, 0xAB, 0x91, 0xD8, 0xCB, 0x5D, 0x6D, 0x22,
+    0xB0, 0x90, 0xCD, 0x24, 0x3E, 0x90, 0x3B, 0xF5, 0xA8, 0x8F, 0xE7, 0x92, 0x7A, 0xD3, 0x05, 0x06,
+    0x51, 0xAC, 0x65, 0x77, 0xFF, 0x96, 0x55, 0x50, 0xF5, 0xBF, 0xF2, 0x13, 0xCD, 0x55, 0x31, 0x6E,
+    0xD4, 0x40, 0x14, 0x7D, 0x9E, 0x11, 0xB1, 0x84, 0x8B, 0xA9, 0x5C, 0x51, 0x6C, 0x8D, 0x28, 0xF6,
+    0x04, 0x60, 0x4B, 0x39, 0x40, 0x52, 0x64, 0xC5, 0x15, 0x50, 0x9A, 0x1C, 0xC1, 0x0E, 0x5C, 0x60,
+    0x1B, 0x6A, 0x28, 0x01, 0x09, 0xA5, 0x4D, 0x81, 0x76, 0x2C, 0x51, 0xA6, 0x31, 0xE2, 0x02, 0x2E,
+    0x90, 0x90, 0xA0, 0xD9, 0xC2, 0x91, 0xAC, 0x68, 0xEC, 0xCF, 0xFB, 0xB3, 0x02, 0x2D, 0x45, 0x84,
+    0x10, 0x59, 0xB1, 0x23, 0xF9, 0x7B, 0xF6, 0x8D, 0xE7, 0xFB, 0xFD, 0xF7, 0x9F, 0x67, 0x01, 0x24,
+    0x27, 0x00, 0xE6, 0x6B, 0x06, 0x29, 0x01, 0x1B, 0x50, 0x61, 0xD6, 0x98, 0x80, 0x15, 0x9C, 0x82,
+    0x55, 0x0B, 0x64, 0x22, 0x0D, 0x44, 0x04, 0x56, 0x24, 0xE0, 0xBE, 0x7C, 0x7B, 0xCD, 0x19, 0xD7,
+    0x5C, 0x60, 0x28, 0xE2, 0xD6, 0x06, 0xB7, 0x43, 0xA3, 0xBE, 0x40, 0xDE, 0x33, 0x97, 0xF4, 0x80,
+    0x97, 0x56, 0x03, 0xB1, 0x7B, 0x9A, 0x9E, 0x69, 0xAF, 0x79, 0xC9, 0x57, 0x0D, 0xAF, 0x78, 0x4D,
+    0xF9, 0x53, 0x79, 0x79, 0x72, 0x5B, 0xEE, 0x42, 0x64, 0xAD, 0x54, 0x1A, 0xAB, 0x7C, 0x9C, 0xF2,
+    0xC9, 0xAB, 0xEB, 0xE3, 0x3F, 0x30, 0xF8, 0x0D, 0xE2, 0x48, 0x39, 0xF7, 0xD0, 0x02, 0x13, 0x16,
+    0xED, 0x25, 0x30, 0xED, 0x47, 0xE6, 0x7A, 0x24, 0xEF, 0x6A, 0x3E, 0xC7, 0x4D, 0x09, 0x93, 0x12,
+    0x3C, 0x14, 0xE9, 0x79, 0x2B, 0x37, 0x20, 0xE2, 0xAD, 0xD4, 0x62, 0x12, 0x91, 0x36, 0x93, 0x91,
+    0xD3, 0x26, 0xD6, 0xA1, 0xC3, 0x0D, 0x69, 0x4B, 0x4A, 0xDF, 0xD7, 0x2A, 0x58, 0x80, 0xED, 0x2B,
+    0xBE, 0xB7, 0x4F, 0x2E, 0xB1, 0x35, 0x8A, 0x0E, 0x46, 0x8E, 0x88, 0xFB, 0xCF, 0xCC, 0x37, 0xEF,
+    0xB9, 0x3D, 0x1B, 0x99, 0xF6, 0x1F, 0x41, 0x2B, 0x47, 0x54, 0x99, 0x35, 0xD4, 0xF0, 0xEB, 0x6A,
+    0x80, 0x1F, 0x28, 0x0D, 0x39, 0x30, 0x8C, 0x1B, 0x95, 0x36, 0xE2, 0x23, 0xFF, 0x49, 0x24, 0x1B,
+    0x6C, 0x67, 0x64, 0x1A, 0x55, 0xD1, 0x26, 0xFB, 0xC4, 0xC5, 0xCB, 0x6D, 0xA6, 0xBE, 0x85, 0x5C,
+    0x71, 0x6B, 0xF8, 0xBB, 0x09, 0x53, 0x5E, 0x49, 0x59, 0x85, 0x4A, 0xBC, 0x0A, 0x2A, 0xC1, 0xC9,
+    0x54, 0x34, 0x73, 0x39, 0x0C, 0x1B, 0x95, 0xF2, 0xC5, 0x02, 0xCA, 0xA7, 0x51, 0x2B, 0xB1, 0x09,
+    0x91, 0xD9, 0xAF, 0x61, 0xA7, 0x3B, 0x94, 0x64, 0x0B, 0x2C, 0x7A, 0x7A, 0xCE, 0x85, 0x62, 0x60,
+    0x63, 0x52, 0xA9, 0x33, 0xA9, 0xD5, 0x6C, 0x8D, 0x4A, 0xD4, 0x46, 0x33, 0x21, 0x15, 0x35, 0x7F,
+    0x42, 0x1F, 0x25, 0x8B, 0xC5, 0x31, 0xBB, 0x2A, 0xA5, 0x61, 0xEB, 0xE3, 0x64, 0xD7, 0x9A, 0x3C,
+    0xC3, 0x41, 0x8D, 0x59, 0x4D, 0x4F, 0xDA, 0xE9, 0x62, 0xD0, 0x46, 0x91, 0x77, 0x1A, 0x85, 0x79,
+    0xF0, 0x65, 0xDF, 0xBC, 0x63, 0x96, 0x78, 0x88, 0x02, 0xAE, 0x35, 0x72, 0x11, 0x74, 0xB5, 0xA4,
+    0x81, 0xF8, 0x41, 0x9F, 0x2D, 0x77, 0xEE, 0x1D, 0xAC, 0xB4, 0x15, 0x91, 0xC9, 0xAA, 0x62, 0x78,
+    0xC2, 0xAF, 0x0D, 0xEE, 0x9C, 0xBF, 0xCD, 0x4D, 0xFC, 0xC0, 0xF5, 0x9C, 0x31, 0x03, 0xF6, 0xCC,
+    0x50, 0x48, 0x49, 0x29, 0x51, 0xB3, 0x17, 0x67, 0x35, 0x6C, 0xCB, 0x1C, 0x8F, 0x1D, 0xFD, 0x7F,
+    0x43, 0x78, 0xA6, 0xA7, 0x13, 0xD1, 0x5D, 0x4B, 0x77, 0xF0, 0xE6, 0x74, 0x89, 0x74, 0xD2, 0x66,
+    0x4F, 0x3C, 0xEA, 0xCD, 0xA4, 0x27, 0xDF, 0xE8, 0x3A, 0xE0, 0x43, 0xDA, 0xED, 0xDD, 0xF1, 0x74,
+    0xFA, 0xFC, 0x6D, 0xAC, 0xCE, 0xCA, 0xAC, 0x47, 0xF5, 0x82, 0x4F, 0x74, 0x1E, 0xA6, 0x77, 0x3B,
+    0xD7, 0xE9, 0x7F, 0x56, 0xAF, 0x0E, 0xCE, 0xC7, 0x68, 0xF3, 0xD8, 0x08, 0xF5, 0xBA, 0xD3, 0x7F,
+    0x2B, 0x1B, 0x1D, 0x1D, 0xD5, 0x99, 0xEB, 0x7A, 0x22, 0xB8, 0xBB, 0xF1, 0x03, 0xC5, 0x55, 0x3D,
+    0x6F, 0xD5, 0x30, 0x14, 0xBD, 0x49, 0x04, 0x91, 0xC8, 0xE0, 0x85, 0x0E, 0x74, 0xC9, 0xDE, 0xC5,
+    0x3F, 0xC1, 0x61, 0x66, 0x68, 0x97, 0xF7, 0x0F, 0x98, 0xBA, 0xF0, 0x13, 0x1C, 0xC4, 0xC0, 0xD0,
+    0x01, 0x06, 0xF6, 0x56, 0xA2, 0x0B, 0x9D, 0x99, 0x71, 0x54, 0x06, 0x86, 0x0E, 0x64, 0x63, 0x24,
+    0xA2, 0x03, 0x03, 0x03, 0x16, 0x44, 0x22, 0x6D, 0x1D, 0x5F, 0xCE, 0x75, 0x1E, 0xDF, 0x12, 0x12,
+    0xA8, 0x52, 0xAD, 0x67, 0x3B, 0xFE, 0xBA, 0xF7, 0x9C, 0x73, 0xEF, 0xB3, 0x89, 0x88, 0xAA, 0x99,
+    0x54, 0x70, 0x3D, 0xF1, 0xC9, 0x3F, 0x7D, 0x44, 0xD2, 0xC1, 0x8D, 0x25, 0xBF, 0xE2, 0x0B, 0x0E,
+    0x86, 0x99, 0x3B, 0xE6, 0xD3, 0x90, 0xF3, 0x68, 0x3A, 0xDA, 0x29, 0x07, 0xA2, 0x2C, 0xC0, 0xB8,
+    0x41, 0x2D, 0x3D, 0x1A, 0xFB, 0x84, 0xA8, 0xE0, 0x8E, 0x70, 0x0A, 0xA3, 0xDD, 0x16, 0xCD, 0xE6,
+    0x21, 0xA5, 0x52, 0x73, 0x93, 0x7A, 0xC5, 0x7E, 0xE9, 0xCF, 0x79, 0xE9, 0xC7, 0x3A, 0x4D, 0xE0,
+    0xFC, 0x4C, 0x7F, 0x16, 0xD7, 0x51, 0x3D, 0x52, 0xCE, 0x7A, 0xA4, 0x0A, 0x07, 0xF8, 0x55, 0x4C,
+    0x0E, 0xEC, 0xC0, 0x2D, 0xF1, 0x48, 0x7A, 0x34, 0x9E, 0x6C, 0xA4, 0x2A, 0x54, 0x81, 0x34, 0x77,
+    0x05, 0x67, 0xDC, 0x88, 0x0B, 0x6E, 0xCD, 0x50, 0xC4, 0x99, 0x6C, 0xAF, 0x42, 0x16, 0x6D, 0xAB,
+    0x7D, 0xCE, 0xE4, 0xB6, 0xBD, 0x0A, 0x98, 0x32, 0x2F, 0x43, 0x11, 0x49, 0x4D, 0xCA, 0xF3, 0x6D,
+    0x6E, 0x0A, 0x2E, 0x83, 0x1E, 0xE0, 0xC8, 0x1D, 0xCF, 0x65, 0x80, 0xBD, 0x7A, 0x64, 0x62, 0x35,
+    0x51, 0x31, 0x9B, 0xCE, 0xBC, 0x01, 0x2A, 0xDE, 0x1F, 0xAA, 0x33, 0x78, 0xD7, 0x17, 0x23, 0x31,
+    0x36, 0x96, 0x1C, 0xC8, 0x30, 0xD8, 0x33, 0x03, 0xD5, 0x08, 0x01, 0xB8, 0xCD, 0x30, 0x87, 0x41,
+    0x8F, 0x6F, 0xA8, 0x02, 0x04, 0x0A, 0x08, 0xC9, 0x04, 0x60, 0xEF, 0x85, 0xC8, 0x51, 0x9B, 0xF8,
+    0xF0, 0xB4, 0xD0, 0x5A, 0xD4, 0x70, 0x6F, 0x47, 0xE9, 0x6C, 0x9B, 0x86, 0xA6, 0xA9, 0xFC, 0xEF,
+    0xFC, 0x6D, 0x9F, 0x0B, 0x2B, 0xA0, 0x81, 0x1F, 0x7E, 0xC0, 0x64, 0x22, 0xE6, 0x5C, 0x57, 0x73,
+    0xA7, 0x7D, 0x3D, 0x56, 0x17, 0x60, 0x54, 0xC4, 0xE2, 0x6C, 0x06, 0x21, 0xEE, 0xA2, 0xB9, 0xCF,
+    0x4D, 0x3D, 0xDA, 0x6D, 0xEF, 0xBA, 0x22, 0xEA, 0xE3, 0x60, 0x06, 0xE2, 0x47, 0xDE, 0x6E, 0x43,
+    0xA9, 0xCF, 0x93, 0x7A, 0x1F, 0xA8, 0x0C, 0x73, 0x21, 0xCA, 0xB3, 0x23, 0xE7, 0x5A, 0x80, 0x85,
+    0xA5, 0x1E, 0x84, 0x86, 0x42, 0xE2, 0x22, 0x3E, 0xA6, 0x84, 0xDA, 0xCC, 0xC2, 0x26, 0x69, 0xBE,
+    0xC6, 0x9E, 0x90, 0x3B, 0x21, 0x95, 0x50, 0xDB, 0x0E, 0x98, 0x4D, 0xFB, 0x0B, 0x62, 0x37, 0x80,
+    0xED, 0x7E, 0x00, 0xFD, 0x97, 0x12, 0x9E, 0x41, 0x62, 0xE3, 0xAB, 0x48, 0x06, 0xE8, 0xBB, 0x1A,
+    0x01, 0x9A, 0xD4, 0x8C, 0xF0, 0x95, 0x30, 0xEA, 0xDE, 0xE1, 0xB8, 0x9A, 0x11, 0xCA, 0x8C, 0x45,
+    0x20, 0x23, 0xEE, 0xCB, 0x94, 0x1B, 0xC9, 0x51, 0x2D, 0x09, 0x54, 0x24, 0xEF, 0x92, 0x4F, 0x64,
+    0x64, 0x45, 0xFD, 0x7D, 0x32, 0x3F, 0x92, 0x44, 0x4F, 0xE9, 0x27, 0xC1, 0xB1, 0x80, 0x99, 0x71,
+    0x01, 0x8F, 0x13, 0xB9, 0x5F, 0x51, 0xD6, 0xC1, 0xFA, 0x25, 0x77, 0x8C, 0xD7, 0x13, 0xB2, 0x09,
+    0x46, 0x5C, 0x8F, 0x14, 0xE2, 0xAE, 0x8C, 0x19, 0xB7, 0x05, 0x23, 0x5B, 0x72, 0x16, 0xAB, 0xFC,
+    0x10, 0x4A, 0xB8, 0x13, 0x38, 0xB1, 0xAF, 0x45, 0x9A, 0x8F, 0xA3, 0x98, 0xF7, 0x92, 0xC8, 0xC3,
+    0xDA, 0x5B, 0x29, 0x4D, 0x21, 0x21, 0x4C, 0x30, 0xCA, 0xF8, 0x0D, 0x95, 0x0D, 0x6B, 0x62, 0x29,
+    0x59, 0x8C, 0xEC, 0xD0, 0xD3, 0x77, 0x1C, 0x55, 0xAF, 0x5B, 0xC4, 0x43, 0xF9, 0x05, 0x25, 0xC4,
+    0x94, 0xCC, 0xF9, 0x2D, 0xFD, 0xAF, 0x56, 0x51, 0xBA, 0xF1, 0x4C, 0x40, 0x24, 0x43, 0xB2, 0x0A,
+    0x16, 0x82, 0x94, 0x74, 0xF7, 0x13, 0x46, 0x8D, 0x6B, 0xC1, 0xA3, 0x02, 0x22, 0x8A, 0x42, 0x0D,
+    0x1B, 0xAB, 0x95, 0x40, 0x48, 0xD9, 0x03, 0xA5, 0x17, 0x71, 0x84, 0x7A, 0x26, 0x5E, 0x94, 0x98,
+    0x10, 0x45, 0x16, 0xA3, 0x69, 0xBD, 0x5D, 0xEE, 0x8C, 0x1F, 0xEB, 0x2E, 0xAD, 0x37, 0xC2, 0x83,
+    0x79, 0x12, 0xCB, 0xA7, 0xD2, 0x3C, 0x42, 0x85, 0xBE, 0xBB, 0x07, 0x69, 0x11, 0x67, 0x05, 0xA7,
+    0x1E, 0x28, 0xFB, 0x71, 0x79, 0x38, 0xE6, 0x4F, 0xD8, 0x75, 0x82, 0xBA, 0x79, 0xE4, 0xA6, 0xC4,
+    0x4C, 0x4C, 0xC2, 0xA2, 0x38, 0x4C, 0x67, 0x1A, 0x41, 0x23, 0xCE, 0x84, 0x2B, 0xA0, 0x56, 0xD8,
+    0x6C, 0x99, 0x67, 0x74, 0x5F, 0x38, 0xC9, 0x77, 0x53, 0x22, 0x99, 0x2E, 0xB7, 0x69, 0x8D, 0x36,
+    0x13, 0xB4, 0xD9, 0xE3, 0xAB, 0x65, 0x7E, 0x4D, 0x0C, 0x34, 0xE9, 0xBC, 0x04, 0x54, 0x22, 0x72,
+    0xEB, 0x52, 0x99, 0xE7, 0x87, 0xB4, 0xD9, 0x96, 0x53, 0x2E, 0x77, 0x2A, 0xAC, 0x57, 0xA2, 0xB6,
+    0x5A, 0xF2, 0xFD, 0x4A, 0x99, 0x6F, 0x51, 0x76, 0xC8, 0x0D, 0x6E, 0x9D, 0x3D, 0xFC, 0x4B, 0xE1,
+    0x88, 0x67, 0x1C, 0x1C, 0x2E, 0x35, 0xE6, 0x1B, 0x3B, 0x25, 0xCF, 0xB5, 0xBC, 0x73, 0xC1, 0x9C,
+    0xDD, 0x05, 0x07, 0x3B, 0xFC, 0xFF, 0x6F, 0xF7, 0x00, 0x04, 0x01, 0x41, 0xC3, 0x4C, 0x47, 0x91,
+    0xB6, 0x64, 0x6C, 0xC6, 0x1C, 0xF7, 0xB3, 0x27, 0xB9, 0x21, 0x76, 0x1F, 0xE3, 0x4D, 0x04, 0x2C,
+    0xD0, 0xB9, 0xE7, 0x4D, 0xEF, 0xF6, 0x86, 0x25, 0x87, 0xD5, 0x54, 0xF6, 0x1C, 0x1D, 0xD0, 0x4D,
+    0xE6, 0x0E, 0x77, 0x63, 0xF6, 0x9C, 0x56, 0xAB, 0x95, 0xC3, 0x14, 0x47, 0xCB, 0x73, 0x7A, 0x42,
+    0xBF, 0x17, 0xAC, 0xEC, 0x6C, 0x51, 0xFE, 0xD4, 0xD3, 0x0B, 0x7D, 0x2E, 0x8F, 0xF3, 0x54, 0x20,
+    0x60, 0xD7, 0xCF, 0xE9, 0x5A, 0x39, 0xBB, 0x0F, 0xD1, 0xF6, 0x3B, 0xD8, 0xFF, 0x15, 0x9D, 0x55,
+    0x3F, 0x8C, 0x15, 0x45, 0x18, 0xFF, 0x76, 0xD7, 0x77, 0x0B, 0x6C, 0x64, 0x4C, 0xBC, 0x17, 0x95,
+    0x03, 0x96, 0xC2, 0x42, 0x08, 0xB2, 0x0D, 0x05, 0xC5, 0xBD, 0x9B, 0x05, 0x12, 0x49, 0x24, 0x91,
+    0x97, 0xC0, 0x6B, 0xB4, 0xC0, 0xC4, 0x4A, 0x28, 0xB0, 0xB0, 0xA0, 0x38, 0xDE, 0x2E, 0x52, 0x58,
+    0x98, 0xC8, 0x4B, 0x34, 0x36, 0x36, 0x57, 0x5C, 0x71, 0x2E, 0x05, 0x68, 0x2C, 0x28, 0xEE, 0xDE,
+    0x2E, 0x9C, 0xE6, 0x62, 0x28, 0x6E, 0x01, 0x13, 0x12, 0x6D, 0xD6, 0x3F, 0x48, 0x08, 0xC5, 0x4D,
+    0x70, 0x21, 0x73, 0x30, 0xB3, 0x9F, 0xDF, 0xEC, 0x3E, 0x0E, 0x04, 0x43, 0xE1, 0xB7, 0xBB, 0x33,
+    0xF3, 0x7D, 0x33, 0xF3, 0xCD, 0xF7, 0xE7, 0x37, 0xDF, 0x02, 0x40, 0x04, 0x1A, 0x3F, 0x41, 0x7A,
+    0x23, 0x4B, 0xBF, 0x00, 0x2F, 0x1D, 0x8B, 0x51, 0xA2, 0xDA, 0xA7, 0x2D, 0xED, 0x2A, 0xBF, 0xF0,
+    0x63, 0x00, 0x57, 0x7A, 0xB8, 0x78, 0x7F, 0x55, 0xF0, 0x69, 0xB6, 0xFC, 0xEB, 0xEF, 0x28, 0x26,
+    0x72, 0x48, 0xDE, 0x9A, 0x73, 0xD0, 0x97, 0xAE, 0xE6, 0x05, 0x13, 0x69, 0x1C, 0x5C, 0xD2, 0x30,
+    0x65, 0x0B, 0xF8, 0x10, 0xEC, 0x19, 0x84, 0xF4, 0x34, 0x1E, 0x52, 0x16, 0x62, 0x66, 0xA3, 0x02,
+    0x1B, 0x73, 0xF8, 0x70, 0x68, 0x08, 0x8E, 0x6D, 0xF8, 0x5A, 0x54, 0x29, 0xBB, 0x33, 0x6A, 0x00,
+    0x8C, 0x1A, 0x4F, 0xF1, 0x22, 0x28, 0x68, 0xD3, 0x01, 0x65, 0x2B, 0x96, 0x7B, 0xF9, 0x14, 0x8C,
+    0x03, 0xA0, 0x79, 0x67, 0x71, 0xD3, 0xFC, 0x1B, 0x53, 0x7D, 0xD0, 0x1C, 0x15, 0x43, 0x61, 0x0D,
+    0x43, 0x38, 0x36, 0x00, 0x8E, 0x39, 0x43, 0xDC, 0x87, 0xA8, 0x78, 0xC8, 0x96, 0x72, 0x38, 0x65,
+    0x29, 0x47, 0x91, 0x89, 0x92, 0x95, 0xBE, 0xE0, 0x82, 0x17, 0xED, 0xD0, 0x53, 0x4C, 0xB1, 0x9A,
+    0x0F, 0x0A, 0x9E, 0xF1, 0xAC, 0x0D, 0xBC, 0xE0, 0x22, 0x10, 0xBE, 0x60, 0xA5, 0x27, 0x1D, 0x3A,
+    0x08, 0x8E, 0x3C, 0xBB, 0x66, 0xC7, 0x0C, 0xA4, 0x02, 0xD2, 0x02, 0xA2, 0x02, 0x78, 0x0E, 0x41,
+    0x06, 0xC9, 0x20, 0x50, 0x2E, 0x02, 0xC6, 0x3C, 0x77, 0x05, 0x99, 0xEB, 0x93, 0x53, 0x28, 0x7C,
+    0x4B, 0xB4, 0x80, 0x85, 0x25, 0x59, 0x81, 0x61, 0xD9, 0x82, 0x76, 0x2F, 0xC0, 0xBF, 0x12, 0x09,
+    0xBB, 0xC0, 0x8B, 0xED, 0x02, 0x2E, 0xD2, 0x60, 0x2C, 0x84, 0x5E, 0xC8, 0x85, 0x2F, 0x3D, 0xED,
+    0x21, 0x43, 0xA7, 0x02, 0x49, 0xDB, 0xC1, 0xDA, 0x7F, 0x57, 0xC9, 0x0E, 0xBB, 0xAA, 0x7C, 0x2B,
+    0x74, 0x32, 0xF3, 0xA4, 0x55, 0xA4, 0xDB, 0x47, 0xD2, 0xEA, 0xF8, 0xED, 0x86, 0x07, 0x30, 0xED,
+    0x89, 0xD5, 0xB4, 0x7A, 0xE5, 0x67, 0x27, 0xB3, 0x29, 0xF8, 0xA9, 0x4E, 0x35, 0x24, 0x14, 0x8D,
+    0xFA, 0xB1, 0xF0, 0x38, 0x46, 0x3A, 0x52, 0x51, 0xB1, 0x26, 0x02, 0x0C, 0xF1, 0x76, 0xAA, 0xB9,
+    0xA6, 0xB3, 0x06, 0xB8, 0x88, 0x87, 0xB4, 0x5F, 0x98, 0xC3, 0x9E, 0xCE, 0xEB, 0xB3, 0x59, 0xE4,
+    0x7F, 0x6B, 0xBE, 0x54, 0xA6, 0xAD, 0xD0, 0xCB, 0x58, 0x3E, 0xA1, 0xA0, 0x82, 0x2A, 0xAD, 0x52,
+    0x45, 0x11, 0x18, 0xB8, 0x82, 0x65, 0x3C, 0xE4, 0x10, 0x7D, 0xC9, 0xB5, 0xAF, 0xED, 0xB9, 0x51,
+    0x06, 0x7B, 0xBD, 0x1E, 0x39, 0xFD, 0x20, 0x39, 0x5F, 0x82, 0xDF, 0xBC, 0x5D, 0x68, 0x9D, 0x64,
+    0xD6, 0xF5, 0x4C, 0x4C, 0x06, 0x88, 0x71, 0xDF, 0xCB, 0x6B, 0x08, 0x84, 0x51, 0x86, 0x07, 0x6B,
+    0x08, 0x58, 0x23, 0x08, 0x98, 0xCC, 0xF9, 0x08, 0x0E, 0xB1, 0x78, 0x5E, 0xF0, 0x3C, 0xBD, 0x52,
+    0x58, 0x7A, 0x3B, 0x8C, 0x7D, 0x21, 0x40, 0xF1, 0x07, 0x78, 0x09, 0xB1, 0x74, 0x51, 0xC3, 0xD8,
+    0x2A, 0xFC, 0x67, 0x8E, 0x8D, 0x3F, 0x69, 0x3C, 0x15, 0xE0, 0xCA, 0x75, 0x12, 0x2E, 0xF8, 0x78,
+    0x30, 0x9E, 0x88, 0xC9, 0x9A, 0x14, 0x2B, 0x7A, 0x23, 0xD4, 0x38, 0xA2, 0x76, 0xAF, 0x77, 0x84,
+    0xBE, 0xC3, 0x34, 0x5C, 0xA6, 0x0F, 0x1A, 0xB2, 0x93, 0x24, 0x39, 0x4B, 0xEC, 0xA6, 0x24, 0x99,
+    0x33, 0xBC, 0x5F, 0x7A, 0x97, 0xB0, 0x1A, 0xD2, 0x19, 0x65, 0x7F, 0x02, 0x4F, 0x0B, 0xFB, 0x4F,
+    0x23, 0x65, 0xB8, 0x46, 0xA4, 0xBA, 0xCB, 0xEB, 0xD1, 0x62, 0xDD, 0xAA, 0x86, 0xB9, 0x9C, 0x18,
+    0x22, 0x15, 0x04, 0x51, 0x05, 0x9E, 0x86, 0x48, 0x3B, 0x58, 0x04, 0x84, 0xDE, 0x12, 0x78, 0x0C,
+    0x9B, 0x47, 0xC7, 0x59, 0x5D, 0x80, 0x21, 0xE9, 0xCB, 0xC1, 0x52, 0x00, 0x41, 0x08, 0x8E, 0xF8,
+    0x97, 0x20, 0xAE, 0x05, 0xFD, 0xA7, 0x05, 0x51, 0x2D, 0x80, 0xE7, 0x0B, 0x3C, 0x12, 0x0C, 0x38,
+    0x2B, 0xE6, 0x7D, 0x7F, 0xF9, 0x7A, 0x4E, 0xE1, 0x5F, 0x4B, 0x45, 0x95, 0xA4, 0x8D, 0xE5, 0x64,
+    0x81, 0x8B, 0xA8, 0xFB, 0xC9, 0xB9, 0x1B, 0x31, 0xBC, 0x79, 0x12, 0x6C, 0xD3, 0x45, 0x88, 0xD7,
+    0xC8, 0x74, 0xEF, 0x5E, 0x65, 0x3F, 0xAC, 0xE4, 0x24, 0x73, 0x96, 0xC2, 0x0B, 0x5B, 0xC6, 0xC7,
+    0x3B, 0xD3, 0x41, 0xE9, 0x15, 0x7E, 0xD9, 0x99, 0x1F, 0x7F, 0x7D, 0xEC, 0xB2, 0xEA, 0x38, 0x79,
+    0x00, 0xD2, 0xCD, 0xE6, 0xF9, 0xFE, 0x98, 0xC2, 0x78, 0xB4, 0x89, 0x86, 0x68, 0xDC, 0xDA, 0x40,
+    0xBE, 0x13, 0x77, 0x9F, 0xBA, 0x1D, 0xB3, 0xE6, 0xAE, 0x44, 0xE2, 0xC9, 0xBB, 0xC2, 0xA5, 0x57,
+    0x59, 0x18, 0xF2, 0xDC, 0x1B, 0xE1, 0x2F, 0xE7, 0x3E, 0xDE, 0xF9, 0x83, 0x82, 0x47, 0x31, 0x3E,
+    0x90, 0x79, 0x03, 0x9E, 0xE3, 0x65, 0x0C, 0x95, 0x57, 0x6C, 0x35, 0xD3, 0x0E, 0x86, 0xAE, 0x88,
+    0xEE, 0x4A, 0xFC, 0x4C, 0xF1, 0x65, 0x89, 0x67, 0x74, 0xC4, 0x04, 0xCF, 0x42, 0x72, 0xB6, 0x6D,
+    0x55, 0xAE, 0xF4, 0x45, 0x24, 0xF1, 0x37, 0x0C, 0x4D, 0x42, 0xA3, 0xDA, 0x9B, 0x64, 0x61, 0x1A,
+    0xA0, 0xF3, 0xE8, 0xA3, 0x0C, 0x8C, 0x3F, 0xCF, 0xC2, 0x67, 0x8B, 0x0D, 0x57, 0x5C, 0xC1, 0xE4,
+    0xE8, 0x81, 0x10, 0xDA, 0x9D, 0x57, 0x3D, 0xFC, 0x94, 0x70, 0x20, 0x3B, 0x01, 0x3A, 0x4B, 0xBF,
+    0xC4, 0xB0, 0xBB, 0xD1, 0xD2, 0x22, 0xE3, 0xC8, 0x0C, 0x9E, 0xD5, 0xDD, 0xDB, 0x56, 0x98, 0x0E,
+    0xA6, 0x09, 0x79, 0x67, 0x1E, 0x62, 0xD9, 0x71, 0x2B, 0x2B, 0x9C, 0x5D, 0x9B, 0xA3, 0x0E, 0xBA,
+    0x30, 0x36, 0x58, 0xCF, 0x75, 0x3F, 0x42, 0x75, 0x91, 0xD2, 0x40, 0x29, 0x2B, 0xB6, 0xF2, 0x6A,
+    0xE1, 0x54, 0xAA, 0xBE, 0x77, 0x4D, 0x20, 0xDC, 0xBD, 0x79, 0x80, 0x92, 0x20, 0xCA, 0xF6, 0x0A,
+    0x7B, 0x6F, 0xDC, 0xE0, 0x31, 0xF6, 0x8A, 0x40, 0x36, 0x57, 0x9E, 0x8A, 0x40, 0x46, 0xE3, 0x0A,
+    0xF3, 0x40, 0xBA, 0x8D, 0x23, 0xEC, 0x51, 0x7B, 0xF8, 0x47, 0x60, 0x5D, 0xF8, 0xEE, 0x73, 0x32,
+    0x69, 0x23, 0xC0, 0x05, 0x80, 0xF5, 0x00, 0xEF, 0x03, 0x6C, 0x33, 0x83, 0xEE, 0x47, 0x00, 0x1B,
+    0x5B, 0xA3, 0x95, 0x03, 0x32, 0x99, 0x09, 0x82, 0x86, 0x3B, 0xDA, 0x3B, 0x63, 0x66, 0x37, 0x00,
+    0xB5, 0x2F, 0x3E, 0xDA, 0xD5, 0x68, 0x80, 0x6F, 0xDF, 0x01, 0x10, 0xF0, 0xC1, 0x4F, 0x8F, 0x4F,
+    0xA9, 0xA1, 0x6F, 0x6C, 0xC0, 0xC6, 0x06, 0x2A, 0x6E, 0x51, 0x3C, 0xF4, 0x6E, 0x49, 0xF2, 0x66,
+    0x8C, 0xDD, 0xB8, 0x2B, 0xE6, 0xFD, 0xC5, 0x72, 0x0B, 0xB4, 0x09, 0x55, 0x84, 0x75, 0xC9, 0xBF,
+    0xD2, 0x0B, 0x30, 0xA5, 0x86, 0x41, 0x53, 0xA5, 0x61, 0x3B, 0xAC, 0xDB, 0x36, 0xA5, 0x58, 0x49,
+    0xE9, 0x93, 0x5B, 0xF6, 0x90, 0xB2, 0x6E, 0x3F, 0x3A, 0x9B, 0xA5, 0xE1, 0x10, 0x66, 0x42, 0x46,
+    0x49, 0xEF, 0xFB, 0x77, 0x8A, 0x19, 0x63, 0xB3, 0x53, 0x38, 0x85, 0x5F, 0xA4, 0x10, 0x1C, 0x12,
+    0xDE, 0xBD, 0x5B, 0x67, 0xCA, 0x9D, 0x93, 0xBB, 0x9D, 0xD3, 0xF9, 0x6C, 0x70, 0x40, 0x9C, 0xF2,
+    0x8F, 0x5E, 0xB9, 0x36, 0x68, 0xB9, 0x0A, 0x57, 0xAA, 0xE8, 0xEA, 0xC0, 0x8E, 0x5F, 0xFE, 0x81,
+    0xAB, 0x48, 0x7B, 0xC5, 0xAE, 0x8B, 0xEB, 0xB6, 0xD5, 0x77, 0xFF, 0x68, 0xC1, 0xD3, 0x95, 0xA5,
+    0x58, 0xEC, 0xFC, 0x98, 0x59, 0x37, 0xA8, 0x23, 0x2E, 0x4B, 0x59, 0x61, 0xBC, 0xDA, 0xDC, 0x64,
+    0x76, 0x8F, 0x71, 0x76, 0x47, 0x68, 0xAE, 0xDF, 0x5C, 0x90, 0x9B, 0xC0, 0x4B, 0xA6, 0x0D, 0x0C,
+    0x85, 0x83, 0xAB, 0xBD, 0xE3, 0x98, 0x81, 0xB9, 0x1E, 0x04, 0x84, 0x09, 0xEA, 0x4C, 0x62, 0x4E,
+    0xE0, 0xEA, 0xFF, 0xD8, 0x50, 0x57, 0x80, 0x1A, 0x73, 0xC9, 0x1A, 0x3D, 0x66, 0xA1, 0x65, 0xF4,
+    0x8D, 0xDB, 0x88, 0x37, 0xE9, 0xDE, 0x9A, 0x82, 0x52, 0x9D, 0x93, 0x41, 0x03, 0x51, 0x1E, 0xB6,
+    0x48, 0x61, 0xDE, 0xA1, 0x05, 0xEF, 0x7E, 0x03, 0x6B, 0x54, 0x6B, 0xA5, 0xDA, 0x48, 0xB5, 0x08,
+    0xEA, 0x13, 0x4D, 0x95, 0xBC, 0x69, 0xBD, 0x87, 0x19, 0x33, 0x3F, 0x8D, 0x13, 0x62, 0x64, 0xDB,
+    0xA6, 0x7A, 0xF5, 0x2C, 0x3C, 0x41, 0x23, 0xBC, 0x4A, 0xBF, 0xA9, 0x51, 0xF5, 0x66, 0x2C, 0x7B,
+    0x86, 0xA2, 0x66, 0xAA, 0xB9, 0x89, 0x96, 0x39, 0x40, 0xBE, 0xD6, 0x87, 0x20, 0xC0, 0x69, 0x7F,
+    0x9E, 0xF3, 0x95, 0x56, 0x6B, 0xA4, 0xE2, 0x1F, 0xCD, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0x7E,
+    0x7B, 0xCB, 0xF9, 0xA4, 0xAC, 0xC4, 0xA4, 0x88, 0x9B, 0xA4, 0x98, 0x9A, 0x82, 0xEC, 0x1F, 0xB0,
+    0xD9, 0x15, 0x16, 0x15, 0x85, 0xAF, 0xC8, 0x09, 0x09, 0x0A, 0xB7, 0x88, 0x02, 0x97, 0x5C, 0x91,
+    0x68, 0x2C, 0xA5, 0xA0, 0x24, 0x3F, 0x81, 0x22, 0x05, 0xF0, 0x0B, 0x2C, 0x11, 0xB3, 0x13, 0xB9,
+    0xA0, 0x48, 0xC1, 0x11, 0x29, 0x50, 0x7A, 0x11, 0x02, 0x21, 0xBB, 0xF0, 0x80, 0xC7, 0xF2, 0x24,
+    0xD9, 0xDD, 0xC7, 0xF7, 0x66, 0x0E, 0xEB, 0x24, 0x40, 0x01, 0x04, 0x12, 0xA3, 0x7D, 0x6F, 0x66,
+    0xEF, 0xBD, 0x79, 0xEF, 0xED, 0xF7, 0xBE, 0x99, 0x23, 0x1A, 0x0D, 0xF9, 0x8F, 0xDF, 0xB9, 0x0D,
+    0xC3, 0x9A, 0xF2, 0xF6, 0xAA, 0x09, 0xD9, 0x2D, 0xFA, 0x60, 0xF1, 0xEA, 0xC5, 0xD1, 0x9D, 0x8B,
+    0x27, 0x44, 0x62, 0x3D, 0x81, 0x75, 0x5F, 0xED, 0xE6, 0x87, 0x8F, 0x9D, 0x71, 0xD9, 0x94, 0xE6,
+    0xAA, 0xCC, 0x1F, 0xD9, 0x5F, 0xDC, 0xC6, 0x03, 0xAD, 0xB7, 0x0F, 0xD9, 0xAD, 0xBF, 0x44, 0x64,
+    0xBE, 0x3D, 0x7E, 0x9F, 0x7C, 0xDE, 0x16, 0x5F, 0xBF, 0x39, 0xC0, 0x45, 0x91, 0x26, 0xAD, 0x4F,
+    0x5F, 0x6B, 0x1E, 0xE8, 0x7D, 0xB5, 0xAF, 0xEE, 0x94, 0xD5, 0xE9, 0xF8, 0x8D, 0x39, 0x7E, 0x9C,
+    0xD8, 0xEC, 0xB9, 0x37, 0x8D, 0xCE, 0xBF, 0xB4, 0x3F, 0xBB, 0x8D, 0xDB, 0x4A, 0xE7, 0x0F, 0xEB,
+    0x29, 0xD2, 0x6C, 0x0E, 0xE6, 0xA3, 0x93, 0x67, 0x17, 0x6D, 0xB8, 0xE9, 0x37, 0x8B, 0x03, 0xF5,
+    0xFA, 0xE9, 0xD6, 0xE2, 0xF3, 0x85, 0xBF, 0x39, 0xBD, 0x96, 0x11, 0xA9, 0x4D, 0x3E, 0xDA, 0xF3,
+    0xAA, 0xC6, 0x33, 0xA5, 0x31, 0x6D, 0xE4, 0x7C, 0xE3, 0x27, 0x4D, 0xB7, 0x33, 0x37, 0xB1, 0xCA,
+    0x8D, 0xEB, 0x7D, 0xB5, 0x33, 0x39, 0x7C, 0xDC, 0xCE, 0x9D, 0x9A, 0x8F, 0x7A, 0xAA, 0xE0, 0x51,
+    0x4E, 0x6C, 0xF0, 0xF9, 0x40, 0xDA, 0xE6, 0x3D, 0x1D, 0x38, 0x5D, 0x3C, 0xAC, 0xAF, 0xAD, 0x7D,
+    0x8A, 0x40, 0x3D, 0xA4, 0x4B, 0x52, 0x04, 0x88, 0xA3, 0xE5, 0xA8, 0x98, 0x03, 0x33, 0x9F, 0x41,
+    0xBE, 0x82, 0x54, 0xE7, 0xB3, 0x5B, 0x6C, 0x29, 0xE7, 0xE4, 0x5B, 0xC1, 0x8F, 0x9F, 0xCC, 0xB6,
+    0x60, 0xD9, 0x66, 0xEE, 0xE1, 0xEC, 0xF9, 0xF8, 0xB3, 0xBB, 0xAB, 0xD6, 0x15, 0x67, 0xE6, 0x6E,
+    0x25, 0x94, 0x44, 0x57, 0xB6, 0x22, 0xBE, 0x3B, 0xE4, 0x83, 0x0A, 0x45, 0x28, 0xDB, 0x2B, 0xF5,
+    0x2B, 0xFF, 0x7D, 0x5E, 0x03, 0xF1, 0xA4, 0xA1, 0x7B, 0x9A, 0x40, 0x73, 0x9D, 0x89, 0x5E, 0xD0,
+    0xFA, 0xCE, 0x30, 0x03, 0xE2, 0x23, 0xAE, 0xA5, 0x80, 0x66, 0x21, 0xBA, 0xF4, 0xA2, 0x8B, 0x5E,
+    0xF4, 0x88, 0xDF, 0x7E, 0x2A, 0x06, 0x84, 0x83, 0x01, 0x5B, 0x2C, 0x15, 0x2C, 0x2F, 0x23, 0xFE,
+    0x61, 0x17, 0x9B, 0xB0, 0x83, 0x5B, 0xD9, 0xA1, 0x3B, 0xD9, 0x81, 0xF4, 0x12, 0x0A, 0x5E, 0x30,
+    0x18, 0x27, 0x86, 0x2A, 0xC0, 0xF0, 0x32, 0xF2, 0x8E, 0x78, 0x4B, 0x00, 0x68, 0x16, 0xA2, 0x4B,
+    0x5F, 0x0D, 0x12, 0x1F, 0xF4, 0xC2, 0x78, 0xEF, 0x63, 0xEC, 0xAC, 0xA9, 0xF2, 0x70, 0x42, 0xFD,
+    0xF8, 0x94, 0x2F, 0x7E, 0xC3, 0x84, 0x90, 0xED, 0x39, 0xE4, 0x14, 0x82, 0x2A, 0x06, 0x20, 0xF0,
+    0xD6, 0x9F, 0x7C, 0xF2, 0xDF, 0x7D, 0x4D, 0x23, 0x6B, 0xF8, 0x9E, 0x20, 0xD3, 0x13, 0x40, 0xEA,
+    0x04, 0x96, 0x90, 0xB3, 0x5F, 0x73, 0x0A, 0x05, 0x5D, 0xD5, 0x02, 0x42, 0xD9, 0x49, 0x6F, 0xFC,
+    0xA5, 0x12, 0xF8, 0xCC, 0xA5, 0x8A, 0xAF, 0x31, 0x5C, 0xB2, 0x82, 0x49, 0x02, 0x06, 0xD2, 0x48,
+    0xB7, 0x0B, 0xA0, 0x33, 0xCF, 0x25, 0x28, 0x45, 0x55, 0x8A, 0x1A, 0x09, 0xF2, 0x34, 0x9E, 0xA6,
+    0x02, 0x76, 0xF9, 0x1E, 0x1C, 0x7A, 0x05, 0x81, 0xB5, 0xAB, 0xC2, 0x5A, 0x90, 0x70, 0xA6, 0x25,
+    0x41, 0x30, 0x06, 0x2C, 0x79, 0x0F, 0xE1, 0x82, 0xB4, 0x0E, 0xE0, 0x22, 0xA4, 0xC6, 0x4B, 0x86,
+    0x92, 0x49, 0x03, 0xC5, 0x09, 0x12, 0xE5, 0x3C, 0x85, 0x1C, 0x90, 0x1A, 0xA4, 0x55, 0x90, 0x00,
+    0x69, 0x6F, 0x30, 0xCC, 0x63, 0x00, 0xFB, 0x3D, 0x57, 0x67, 0x2F, 0x78, 0x50, 0xC9, 0x81, 0xFE,
+    0xB0, 0xE3, 0x9D, 0xB3, 0xBE, 0x7A, 0xE4, 0xDE, 0xBD, 0x12, 0x09, 0x21, 0x78, 0x01, 0x2E, 0xD4,
+    0xC3, 0xF6, 0x1F, 0x2E, 0x65, 0xF1, 0x6F, 0x3D, 0x65, 0x58, 0x6F, 0xBC, 0x61, 0x67, 0x78, 0x61,
+    0x00, 0x3F, 0x90, 0xD1, 0x91, 0x92, 0x14, 0x49, 0xED, 0x22, 0x5F, 0x23, 0x53, 0x23, 0x63, 0xE3,
+    0x69, 0x2B, 0xCF, 0x67, 0xD1, 0xA1, 0xE8, 0x52, 0xCF, 0x47, 0xB1, 0x32, 0xE1, 0x95, 0x14, 0x49,
+    0x91, 0x09, 0x7C, 0x7C, 0x1F, 0xED, 0x0A, 0xD2, 0x59, 0x4F, 0xB8, 0x29, 0xD0, 0x0A, 0x00, 0xCE,
+    0x7B, 0xA9, 0x6F, 0x55, 0x0B, 0x87, 0x06, 0xDB, 0xC0, 0x65, 0x97, 0x71, 0x8B, 0x5B, 0x44, 0x4A,
+    0x01, 0x55, 0x6A, 0x44, 0x00, 0xF8, 0xC6, 0xCA, 0x67, 0xB2, 0x2D, 0x9D, 0x04, 0x33, 0x2E, 0xD5,
+    0x5A, 0x85, 0x82, 0x85, 0xD5, 0xA6, 0x4F, 0x4D, 0xC3, 0x79, 0x86, 0x97, 0xB0, 0x45, 0xA1, 0xFB,
+    0x92, 0x22, 0xC7, 0x9C, 0x4B, 0x86, 0xF1, 0x25, 0xD7, 0x23, 0x5A, 0x91, 0xA4, 0x52, 0xAC, 0xAC,
+    0xA5, 0x78, 0xAC, 0x63, 0xAD, 0x7F, 0xD5, 0x2C, 0xE3, 0x59, 0xAD, 0xE2, 0xCC, 0x6D, 0x95, 0x66,
+    0x97, 0x26, 0x5C, 0x09, 0xB3, 0x99, 0x39, 0x7F, 0x87, 0x8F, 0xBA, 0x84, 0x41, 0x13, 0x77, 0x4F,
+    0x78, 0xD9, 0x29, 0x4E, 0xC1, 0x0D, 0xAF, 0x9A, 0x33, 0x7C, 0x84, 0x8D, 0x35, 0x0B, 0x4F, 0x24,
+    0xE0, 0x76, 0x17, 0x4F, 0xA6, 0x8B, 0xB9, 0xF9, 0x29, 0xA5, 0x0B, 0xE6, 0xF7, 0x7A, 0x79, 0xBF,
+    0xA4, 0xCB, 0xE4, 0x8F, 0xF4, 0xF5, 0xFB, 0x14, 0x6F, 0x94, 0xBD, 0xA8, 0xDD, 0xF2, 0x76, 0x29,
+    0x80, 0x78, 0x2F, 0x3E, 0x6A, 0x10, 0x5D, 0x44, 0x0D, 0xA8, 0x5F, 0xAC, 0x87, 0xA5, 0xA6, 0xEB,
+    0x9F, 0x20, 0xBE, 0xF1, 0x09, 0x97, 0x78, 0xAF, 0xD0, 0x44, 0x1A, 0x5F, 0xB4, 0xB4, 0x32, 0x60,
+    0xD3, 0x41, 0xFA, 0xE2, 0xA4, 0x85, 0x2D, 0xDB, 0x8C, 0x6D, 0x64, 0x06, 0x5B, 0xFC, 0x3F, 0xB0,
+    0xC5, 0x49, 0x66, 0x1B, 0x79, 0x8C, 0x66, 0xF1, 0x37, 0xE2, 0x24, 0x08, 0xB1, 0x1C, 0xAC, 0xB4,
+    0x3A, 0x89, 0xBD, 0xC7, 0x99, 0x64, 0x6B, 0xC4, 0xAF, 0x92, 0x1D, 0x28, 0x9B, 0x6D, 0xC1, 0xB5,
+    0x84, 0xB2, 0xCB, 0xC8, 0xD4, 0x78, 0x49, 0xD4, 0x09, 0x92, 0x03, 0xFD, 0x3F, 0xC7, 0xAF, 0xCD,
+    0x55, 0xBD, 0x6E, 0xD4, 0x40, 0x10, 0x5E, 0xDB, 0x82, 0x2B, 0x5C, 0x6C, 0x4F, 0xE3, 0x9E, 0xC6,
+    0x8F, 0xB0, 0x27, 0xDD, 0x03, 0x24, 0x45, 0x0E, 0x24, 0x1A, 0x9E, 0x82, 0xFA, 0x4E, 0xE2, 0x05,
+    0xF2, 0x06, 0x69, 0xA8, 0xD2, 0xF0, 0x08, 0xBB, 0x88, 0x82, 0xF2, 0x8C, 0xD0, 0xD1, 0x62, 0x09,
+    0x24, 0x50, 0xAE, 0x88, 0xE1, 0x8C, 0x64, 0xC1, 0xDA, 0xC3, 0xF7, 0x8D, 0x4D, 0x48, 0x42, 0x68,
+    0x90, 0x22, 0xC5, 0x92, 0xF7, 0x76, 0xC6, 0xB3, 0xF3, 0xF3, 0xCD, 0x37, 0x7B, 0xE6, 0xE1, 0x0B,
+    0x63, 0xCC, 0x4C, 0xB0, 0x98, 0x55, 0x83, 0x25, 0x1B, 0xB8, 0x75, 0x15, 0x96, 0xB4, 0x33, 0x97,
+    0x1E, 0x09, 0xC6, 0x8A, 0x6B, 0x4C, 0x2E, 0x9B, 0x68, 0x32, 0xD9, 0x8B, 0x49, 0x25, 0x42, 0x29,
+    0x54, 0x7A, 0x2A, 0x1D, 0x95, 0x6E, 0x07, 0x65, 0xF1, 0x0D, 0x4A, 0xDB, 0xF9, 0x4D, 0x9C, 0x45,
+    0xB7, 0x97, 0x6C, 0xB0, 0x51, 0x5E, 0x49, 0x06, 0xA5, 0xAC, 0x61, 0xB9, 0x0A, 0x50, 0xBA, 0x1A,
+    0xCA, 0x0F, 0x0D, 0x94, 0xD2, 0x19, 0xD9, 0x08, 0xCE, 0xEF, 0x65, 0x30, 0x50, 0x8A, 0xA1, 0x72,
+    0x4D, 0x65, 0xA0, 0xB2, 0x86, 0x72, 0xCC, 0x61, 0x16, 0x13, 0x64, 0xEA, 0x6A, 0x57, 0x23, 0xF8,
+    0x39, 0x94, 0x56, 0x64, 0x6E, 0x4C, 0x01, 0xE3, 0x4B, 0xCF, 0xAA, 0x36, 0xC6, 0xBF, 0xC3, 0x07,
+    0x1B, 0xCB, 0xCE, 0x24, 0x08, 0x09, 0x37, 0x4D, 0xDE, 0xB3, 0x36, 0xD4, 0xE8, 0x43, 0x26, 0x73,
+    0x78, 0x2C, 0xBA, 0x04, 0x36, 0x12, 0x90, 0xFE, 0xAC, 0x67, 0xD9, 0xAE, 0xF1, 0x01, 0xE6, 0x07,
+    0x28, 0xDB, 0xF6, 0xF4, 0xEB, 0x05, 0x88, 0x64, 0xD2, 0xC3, 0x67, 0x09, 0x1F, 0xC0, 0x80, 0x88,
+    0xE4, 0x0A, 0x16, 0xB2, 0x42, 0xA4, 0x8B, 0x14, 0x84, 0xB2, 0xD5, 0xEF, 0x6A, 0x6F, 0x8E, 0x26,
+    0xCC, 0x66, 0x3D, 0x96, 0x7C, 0xB8, 0xC5, 0x05, 0xCF, 0xF5, 0x05, 0xE8, 0xB0, 0x7F, 0x37, 0x2C,
+    0xC6, 0x6B, 0x53, 0x85, 0x80, 0x26, 0x9A, 0x69, 0x26, 0xA2, 0x6D, 0xE7, 0x9A, 0x47, 0x22, 0x69,
+    0xD9, 0x56, 0x83, 0xF6, 0x61, 0x2D, 0x5B, 0x60, 0x0D, 0x64, 0x00, 0x12, 0x70, 0x2D, 0x5B, 0x38,
+    0xA8, 0x8A, 0x8E, 0x95, 0x01, 0x41, 0x40, 0x0B, 0x54, 0x53, 0x8D, 0x98, 0x31, 0x30, 0x88, 0x84,
+    0x67, 0x9E, 0x73, 0x0D, 0x76, 0x58, 0x3E, 0x02, 0x15, 0x10, 0x49, 0x2A, 0x87, 0x23, 0xBE, 0x71,
+    0x2D, 0x49, 0x46, 0x9A, 0xB9, 0x8E, 0x78, 0x95, 0xE8, 0xB5, 0xF4, 0x00, 0x50, 0xAA, 0x3F, 0x9B,
+    0xED, 0xF2, 0x48, 0xDB, 0xAD, 0x39, 0x5C, 0x6C, 0x86, 0xD3, 0x63, 0x60, 0x2C, 0x35, 0x6D, 0x02,
+    0xDD, 0xDB, 0xFE, 0x89, 0xB4, 0x82, 0x56, 0x82, 0x78, 0x85, 0xF2, 0x70, 0xDA, 0xA4, 0xD8, 0x24,
+    0xD2, 0xA9, 0xCD, 0xE4, 0xB9, 0xC1, 0xE6, 0x13, 0xE8, 0xF9, 0xE3, 0x90, 0x3E, 0x5A, 0xA6, 0xDA,
+    0xF1, 0x5B, 0xEB, 0x9A, 0xFB, 0xD2, 0xF0, 0xC8, 0x6B, 0xA6, 0x4E, 0x4E, 0x44, 0x14, 0x2A, 0xB5,
+    0x6C, 0x9F, 0x4A, 0x36, 0x85, 0x1B, 0x70, 0x10, 0x35, 0xC9, 0xD9, 0x4B, 0x59, 0x08, 0x9A, 0x0F,
+    0x2B, 0xDB, 0xC3, 0x0A, 0x25, 0x20, 0xE8, 0x47, 0x92, 0xF5, 0x20, 0x82, 0x09, 0xB4, 0xAA, 0x19,
+    0xF5, 0xF7, 0xC1, 0x2F, 0x0C, 0xF6, 0x13, 0xEF, 0x39, 0x5E, 0xCF, 0xD6, 0x6C, 0x97, 0x8F, 0x65,
+    0x2C, 0x8A, 0x70, 0xE2, 0x78, 0xF6, 0xBF, 0xA2, 0x21, 0xC4, 0x2D, 0x69, 0x47, 0xF6, 0xD9, 0x2B,
+    0x42, 0xBF, 0x5C, 0x51, 0x58, 0xA7, 0x14, 0x3A, 0x53, 0xFE, 0x25, 0xCC, 0x55, 0x68, 0x29, 0x24,
+    0xA3, 0x50, 0x34, 0x14, 0x52, 0x8E, 0xF4, 0xDC, 0x94, 0x2A, 0x64, 0xA3, 0x80, 0xEE, 0x43, 0xD0,
+    0x2E, 0x73, 0x56, 0x28, 0xA0, 0x97, 0x18, 0x20, 0xCF, 0x68, 0xB2, 0xD3, 0x75, 0xB8, 0x2A, 0x70,
+    0x52, 0x56, 0x3B, 0xB6, 0x6E, 0x76, 0x93, 0x50, 0x03, 0x29, 0xB6, 0x67, 0x8F, 0x77, 0x83, 0xD7,
+    0x7D, 0x5F, 0x1E, 0x5D, 0xAF, 0x76, 0xBB, 0x5C, 0xE0, 0xCB, 0x01, 0x48, 0x01, 0xE3, 0x56, 0xCE,
+    0x4E, 0x9F, 0xFF, 0x03, 0x0B, 0x91, 0x78, 0xC9, 0x15, 0x53, 0x8D, 0x08, 0x94, 0xB1, 0x2B, 0xCC,
+    0x12, 0x5C, 0x63, 0x7B, 0xD7, 0xB6, 0xE7, 0x49, 0x36, 0x8C, 0xBC, 0x95, 0x0A, 0xC3, 0x0F, 0x03,
+    0x5F, 0xD3, 0x46, 0x6F, 0x00, 0xA5, 0x38, 0xF9, 0x99, 0xE3, 0xAE, 0x2A, 0x74, 0x8C, 0x3F, 0xCB,
+    0x09, 0xD3, 0x26, 0xB8, 0xD3, 0x9C, 0xE8, 0xA4, 0x24, 0xFC, 0xE5, 0xF0, 0xB3, 0xB7, 0x34, 0xF0,
+    0x0D, 0xE8, 0x83, 0xCA, 0x56, 0xA0, 0x13, 0x79, 0xEE, 0x3A, 0x1B, 0x79, 0x47, 0x94, 0x11, 0x21,
+    0x70, 0x83, 0x20, 0x36, 0xC6, 0xA0, 0x87, 0x23, 0x04, 0x49, 0x25, 0xE0, 0xB2, 0x45, 0x0E, 0x0E,
+    0x09, 0xAC, 0x33, 0xD2, 0x6E, 0xA1, 0x69, 0x19, 0xFF, 0x15, 0x69, 0x21, 0x13, 0xAB, 0x17, 0x70,
+    0xE2, 0xE5, 0x98, 0xC3, 0xC4, 0x68, 0x0D, 0xA9, 0x95, 0x57, 0x33, 0x06, 0xD1, 0x14, 0xFB, 0x71,
+    0x98, 0x13, 0x09, 0xF7, 0x30, 0x61, 0xA0, 0x02, 0x4A, 0x44, 0x7B, 0x3C, 0xF2, 0x7C, 0xE0, 0x75,
+    0xB0, 0xD4, 0x22, 0x8C, 0x70, 0x11, 0xA7, 0x5C, 0x9E, 0xE1, 0x3D, 0x81, 0x9F, 0x37, 0x78, 0xDF,
+    0x72, 0x2E, 0x0A, 0x1E, 0x49, 0x0E, 0xEF, 0xC6, 0xC5, 0xBE, 0x0A, 0x25, 0x84, 0xD6, 0xB6, 0xD3,
+    0xBD, 0xEE, 0x44, 0x2B, 0xB8, 0x43, 0x7F, 0x40, 0xD8, 0x15, 0x9D, 0xFE, 0x91, 0x30, 0x64, 0x2D,
+    0x01, 0xE8, 0xF3, 0xFA, 0x21, 0xA3, 0xB4, 0xC1, 0x71, 0xFC, 0x2B, 0x81, 0xB6, 0x32, 0xF2, 0x5E,
+    0xF3, 0x12, 0xCE, 0xE4, 0x60, 0xA6, 0xDD, 0x4E, 0xFB, 0x0C, 0x67, 0x12, 0x94, 0x96, 0x8E, 0x27,
+    0xD0, 0x6D, 0x76, 0x70, 0x4E, 0x57, 0x61, 0xF2, 0x6C, 0x7C, 0xCB, 0x40, 0x0C, 0x39, 0x92, 0xE1,
+    0x16, 0x9F, 0x5F, 0xBD, 0x55, 0xB1, 0x6A, 0xDC, 0x40, 0x10, 0x9D, 0x3B, 0x61, 0xAB, 0xB8, 0x42,
+    0x55, 0x6A, 0x7D, 0x82, 0x3E, 0x61, 0xCF, 0x49, 0x91, 0xD2, 0x29, 0x7C, 0xA4, 0x70, 0x91, 0x4F,
+    0xF0, 0x27, 0xE8, 0xC0, 0x3F, 0xE0, 0x26, 0x75, 0xAA, 0x34, 0xD7, 0xB8, 0x49, 0x2F, 0x41, 0x8A,
+    0x94, 0x16, 0x18, 0xD7, 0xA7, 0x80, 0x21, 0x90, 0xC6, 0x02, 0xEB, 0x38, 0x25, 0xDE, 0xD5, 0xE4,
+    0xBD, 0xD1, 0xF9, 0x6C, 0x4C, 0x62, 0x1C, 0x88, 0x23, 0xC4, 0xE8, 0xCD, 0xEE, 0xEC, 0xCE, 0xCE,
+    0x9B, 0x99, 0x95, 0xA4, 0xAA, 0x5A, 0x8F, 0x21, 0x7A, 0xC9, 0xEE, 0xA0, 0x5B, 0xCD, 0x8A, 0x3A,
+    0x52, 0x99, 0x00, 0x36, 0xB2, 0x85, 0x35, 0x61, 0xFF, 0x3B, 0x18, 0x07, 0xC2, 0xBC, 0xDA, 0xC2,
+    0xA2, 0x04, 0x9C, 0x78, 0x42, 0x25, 0xCC, 0x3A, 0x40, 0xD5, 0xA9, 0x14, 0x57, 0xDA, 0x10, 0x06,
+    0x21, 0x9C, 0x02, 0xEE, 0x08, 0x1F, 0xF5, 0x22, 0xB1, 0x2E, 0xB5, 0x02, 0x0C, 0x38, 0x82, 0x24,
+    0x50, 0x1A, 0x19, 0x43, 0x51, 0x11, 0x07, 0xA5, 0x93, 0x08, 0x0A, 0x37, 0x2E, 0x96, 0x6B, 0x2F,
+    0xC9, 0x3A, 0xE8, 0x51, 0x25, 0xEA, 0x96, 0xAB, 0x5E, 0xD2, 0xF3, 0xA0, 0xFB, 0x4D, 0xE4, 0xDD,
+    0xB2, 0xD5, 0xA9, 0xFB, 0x12, 0xF4, 0x75, 0x17, 0xB7, 0xF9, 0xB2, 0x73, 0xA5, 0xC6, 0x41, 0x8F,
+    0x43, 0xD2, 0x40, 0xC9, 0xBE, 0xF6, 0x50, 0xE6, 0xEA, 0x4A, 0x28, 0xC9, 0xDA, 0x53, 0x29, 0x74,
+    0x0E, 0x25, 0xD6, 0x86, 0x8A, 0x53, 0x81, 0x32, 0xD6, 0x9A, 0x4A, 0xEA, 0xA9, 0xE0, 0xF4, 0x50,
+    0x4A, 0x89, 0xFB, 0x27, 0x8B, 0x8B, 0xD9, 0x21, 0x22, 0x05, 0x8D, 0xF7, 0xC4, 0xF7, 0xC5, 0x69,
+    0xFF, 0x77, 0xBB, 0x50, 0xC8, 0xF0, 0x8C, 0x0A, 0xF0, 0x24, 0xC8, 0x54, 0x0B, 0xCE, 0x98, 0x1E,
+    0x26, 0x49, 0xE7, 0xB1, 0x5E, 0x4E, 0xB4, 0x4A, 0xC0, 0x8E, 0x36, 0x29, 0xE8, 0xCC, 0xDB, 0x0C,
+    0x1C, 0xBA, 0xCE, 0xC1, 0x2C, 0xF3, 0xC8, 0x9B, 0xA4, 0x26, 0x13, 0x9F, 0xDF, 0x93, 0x6E, 0x2B,
+    0x31, 0x6B, 0x96, 0xC3, 0x2A, 0x84, 0x8B, 0x1D, 0x86, 0xDD, 0x62, 0xAD, 0xF0, 0x46, 0xE6, 0x45,
+    0x28, 0x85, 0xC5, 0xD1, 0x09, 0x1D, 0xCF, 0x79, 0x20, 0x1C, 0x87, 0xC3, 0xE1, 0xA1, 0xB8, 0x98,
+    0xBD, 0x23, 0x59, 0x93, 0x67, 0x14, 0x4E, 0x7F, 0x08, 0x4F, 0x36, 0x75, 0x70, 0x48, 0xD0, 0xBA,
+    0xD5, 0x91, 0x1E, 0xEB, 0x10, 0xB2, 0x7E, 0x56, 0x49, 0x02, 0xC1, 0xB9, 0x5A, 0x98, 0x11, 0x46,
+    0x16, 0xB0, 0x81, 0x21, 0x8D, 0x4B, 0x00, 0x54, 0xF3, 0xE2, 0x84, 0x75, 0x8D, 0x7D, 0x10, 0xCC,
+    0x23, 0x60, 0x4B, 0xFF, 0x09, 0xD9, 0xF7, 0x24, 0xDF, 0x93, 0xFB, 0x36, 0xD6, 0x76, 0xB7, 0x49,
+    0x2C, 0x2B, 0x4C, 0x12, 0x19, 0x04, 0x85, 0x14, 0xED, 0x66, 0xBD, 0xE4, 0x5B, 0xE1, 0xEE, 0x84,
+    0xCD, 0xD2, 0x98, 0xF9, 0x12, 0xDB, 0x60, 0xA2, 0x97, 0xF2, 0xC9, 0xE2, 0x10, 0x13, 0x19, 0x05,
+    0x9C, 0xA0, 0x0F, 0x76, 0xDE, 0x48, 0x8E, 0xB1, 0x15, 0xB9, 0xFD, 0x46, 0xF1, 0x81, 0xB5, 0xF4,
+    0xE2, 0xAD, 0xBE, 0x3F, 0x40, 0x6C, 0xB7, 0x9B, 0x82, 0x95, 0xE1, 0xB4, 0xFF, 0x66, 0x28, 0xAF,
+    0x51, 0x64, 0xE7, 0x38, 0x59, 0xE2, 0xD1, 0xB3, 0x23, 0xB4, 0x4B, 0x89, 0xB9, 0x49, 0x10, 0x74,
+    0x3B, 0xC2, 0x29, 0xCA, 0x48, 0xA7, 0x58, 0x90, 0x76, 0x23, 0xD8, 0x80, 0xCF, 0x46, 0xE2, 0x80,
+    0x29, 0xD8, 0xA0, 0x33, 0x47, 0xBA, 0x0F, 0x16, 0x92, 0xC0, 0xC0, 0x0A, 0x35, 0x1A, 0x19, 0x68,
+    0x46, 0x57, 0xC2, 0x02, 0x42, 0xB8, 0xD6, 0xEC, 0x35, 0xC9, 0xF1, 0xA4, 0x40, 0xAD, 0x96, 0x6A,
+    0x42, 0xCE, 0x9B, 0xBD, 0x1C, 0xC8, 0xFD, 0x87, 0x9E, 0xEE, 0x3E, 0xBB, 0xC8, 0x06, 0xAF, 0x0A,
+    0xA3, 0x88, 0xFC, 0x84, 0xA1, 0x1F, 0x74, 0x3E, 0xD1, 0x9F, 0x7A, 0xAA, 0x75, 0xA2, 0x7B, 0x3A,
+    0xD5, 0x26, 0xF3, 0x58, 0xC0, 0x6E, 0x18, 0xF1, 0xC0, 0xAE, 0x79, 0xE4, 0x43, 0x93, 0xD4, 0x6F,
+    0x16, 0x70, 0xF9, 0x1E, 0x7B, 0xE0, 0xE6, 0xF6, 0x3E, 0x64, 0xD1, 0x0F, 0x8E, 0xE0, 0x5C, 0xCD,
+    0xFD, 0xD8, 0xFA, 0xE0, 0xC1, 0xC9, 0x64, 0xB6, 0xE1, 0x51, 0xAB, 0xA2, 0x61, 0xA4, 0x38, 0x21,
+    0x5D, 0x94, 0xB0, 0x1E, 0xDB, 0x85, 0x12, 0xD9, 0x58, 0xAC, 0x6C, 0x6D, 0x2B, 0x53, 0x49, 0x7A,
+    0xAE, 0xCD, 0xD4, 0x52, 0x60, 0x34, 0xE5, 0xBD, 0xED, 0xDF, 0x59, 0x81, 0x58, 0x52, 0x28, 0x71,
+    0x63, 0xD6, 0xDC, 0x1C, 0x26, 0x91, 0xBE, 0x84, 0x4C, 0x7D, 0xC4, 0xE6, 0x2C, 0x63, 0xBB, 0x9A,
+    0xE1, 0x0C, 0xC9, 0x49, 0x7A, 0x24, 0x07, 0x33, 0x48, 0x1C, 0xCA, 0xCC, 0xDA, 0x85, 0x09, 0xCE,
+    0x5A, 0x66, 0xB8, 0xA8, 0x1C, 0xAF, 0xD3, 0xE9, 0xB3, 0x0D, 0xC3, 0xB7, 0x91, 0x75, 0x63, 0xF2,
+    0xCA, 0x64, 0x61, 0xD7, 0x1F, 0xB9, 0x49, 0x19, 0x90, 0x55, 0x17, 0x8B, 0x8A, 0x19, 0xDC, 0x0C,
+    0x17, 0xD5, 0x40, 0x82, 0xBB, 0x01, 0xBF, 0x7A, 0xD5, 0x62, 0x9F, 0x3F, 0x0E, 0xCD, 0xC5, 0xAD,
+    0x59, 0x76, 0x67, 0xFA, 0xB1, 0x50, 0xFE, 0xAF, 0x3C, 0x1B, 0xBB, 0x21, 0x2A, 0x77, 0x17, 0xAF,
+    0x9E, 0x58, 0xF2, 0xF8, 0x63, 0x65, 0x0D, 0x3C, 0xF3, 0xC7, 0x54, 0x49, 0x7E, 0xAD, 0x8C, 0x68,
+    0xA4, 0x67, 0xF8, 0x5B, 0x05, 0x24, 0x07, 0x96, 0x59, 0x0B, 0x16, 0xFF, 0xEB, 0x74, 0xC0, 0xCD,
+    0x39, 0x3B, 0x54, 0x67, 0xAC, 0xA9, 0x1F, 0x3E, 0x7A, 0xBD, 0xF9, 0x9E, 0x6D, 0xBE, 0xF2, 0xAF,
+    0x9F, 0x5F, 0xCD, 0x54, 0xBD, 0x8E, 0xD5, 0x46, 0x14, 0x1E, 0x5F, 0x6B, 0xE3, 0xC2, 0x85, 0x2B,
+    0x2A, 0x8A, 0xFB, 0x08, 0xAE, 0xD3, 0x64, 0x2C, 0x90, 0xD2, 0xB2, 0x05, 0xDB, 0xB0, 0x45, 0x1E,
+    0x20, 0xC5, 0xBE, 0x41, 0x7C, 0x95, 0x14, 0x94, 0x69, 0xE0, 0x11, 0x68, 0x2E, 0x45, 0x1E, 0x61,
+    0x0C, 0xCD, 0x16, 0x14, 0x38, 0x5A, 0x51, 0xC7, 0x4A, 0x96, 0x66, 0x53, 0x30, 0x42, 0x26, 0xD7,
+    0xCB, 0x8E, 0xE7, 0xCB, 0xF7, 0x8D, 0xEF, 0x2E, 0x02, 0x14, 0x85, 0x22, 0x45, 0x46, 0xF7, 0x1E,
+    0xCF, 0xCC, 0x99, 0xF3, 0xFF, 0x9D, 0x63, 0x07, 0x53, 0x7B, 0x53, 0x8F, 0x39, 0x0C, 0x7F, 0x2B,
+    0x34, 0xD6, 0x1B, 0xFB, 0xBF, 0xBB, 0x68, 0x72, 0x6C, 0x2C, 0x96, 0xF5, 0xC7, 0xFE, 0x1B, 0x3F,
+    0xBB, 0x30, 0xCB, 0x6A, 0x87, 0xE5, 0x5B, 0xFC, 0xEB, 0x45, 0x76, 0xBF, 0x4D, 0x52, 0x9F, 0xD3,
+    0x5B, 0xC7, 0xF1, 0x83, 0xC4, 0x47, 0x14, 0x47, 0x8D, 0xA8, 0x5E, 0x91, 0xA2, 0x4F, 0xD4, 0x93,
+    0x3E, 0x45, 0xD0, 0x9B, 0x3A, 0xD1, 0x6A, 0x16, 0x2D, 0xE3, 0xA7, 0x34, 0xDD, 0x67, 0x2E, 0x24,
+    0xA9, 0xE9, 0x46, 0x16, 0xD8, 0x88, 0x9E, 0x1B, 0x74, 0xF4, 0x0A, 0xCE, 0xCB, 0x91, 0x37, 0x81,
+    0x74, 0x7D, 0x85, 0x64, 0xFB, 0x9F, 0x19, 0x17, 0x8F, 0xC4, 0x00, 0x46, 0x32, 0xA4, 0x88, 0x0C,
+    0xAA, 0x16, 0xC3, 0x41, 0x12, 0x19, 0x7A, 0x49, 0xD4, 0x93, 0x24, 0x0A, 0x48, 0x55, 0x86, 0x67,
+    0x52, 0xE5, 0xBC, 0x18, 0x56, 0x8C, 0xCC, 0xCD, 0x64, 0x70, 0x25, 0x55, 0x48, 0xAA, 0xA2, 0x6C,
+    0xC8, 0xC9, 0xB8, 0xDD, 0x18, 0x15, 0xC3, 0x54, 0x34, 0x9C, 0xCB, 0xAC, 0xBC, 0xF9, 0xF8, 0xE2,
+    0xD5, 0x7D, 0xC3, 0x7A, 0x9C, 0x57, 0x14, 0xFE, 0x49, 0xF6, 0x71, 0x01, 0x58, 0xDA, 0x96, 0x65,
+    0xA8, 0x84, 0x14, 0x51, 0xAC, 0x2D, 0xB3, 0x64, 0x65, 0x60, 0x96, 0x35, 0x95, 0x50, 0x22, 0x64,
+    0x5F, 0x2E, 0x25, 0x29, 0xB9, 0x51, 0x3E, 0x9A, 0xB5, 0x88, 0xF8, 0xCD, 0x0F, 0xCD, 0x09, 0x4C,
+    0x63, 0x2A, 0xE5, 0x7F, 0xAD, 0xD0, 0xED, 0x98, 0x6A, 0x78, 0x70, 0x74, 0x84, 0x4E, 0xDE, 0xAE,
+    0xF8, 0x0F, 0xA5, 0x52, 0x49, 0x53, 0x72, 0xAD, 0x90, 0x4B, 0xF5, 0x24, 0xBF, 0xFA, 0xFD, 0xC9,
+    0x86, 0xAF, 0xA9, 0xBB, 0x17, 0x4C, 0x68, 0x0C, 0x03, 0xAD, 0xCE, 0xE6, 0xB6, 0xF2, 0x6E, 0x6E,
+    0x99, 0x9B, 0xA5, 0x78, 0x5A, 0xDE, 0x51, 0x49, 0x4B, 0x5E, 0x95, 0x9C, 0x07, 0x8F, 0xA9, 0x5C,
+    0x3C, 0x62, 0x2C, 0xA8, 0xA4, 0x63, 0x91, 0x2B, 0x54, 0x41, 0xA1, 0x5B, 0x8F, 0xAE, 0xF5, 0x0C,
+    0xF0, 0xE7, 0x50, 0xCE, 0x74, 0x70, 0xC2, 0x2B, 0x1A, 0xCD, 0xF0, 0x92, 0x3E, 0x49, 0xE1, 0xE2,
+    0xD1, 0x87, 0xE3, 0xC5, 0x72, 0x5C, 0x1E, 0x07, 0x06, 0x90, 0x1E, 0x07, 0xA1, 0xAB, 0x9E, 0xD0,
+    0x59, 0xA9, 0xBA, 0x17, 0x56, 0x4A, 0x17, 0x35, 0x57, 0x30, 0x76, 0xA6, 0x5D, 0x85, 0xD9, 0xA1,
+    0x53, 0xA4, 0x9E, 0xC7, 0x52, 0x75, 0xE1, 0x93, 0x72, 0x9F, 0xB6, 0xEC, 0x50, 0xF4, 0x7B, 0x95,
+    0x4C, 0x75, 0xA3, 0xEF, 0x31, 0x5B, 0x42, 0x7D, 0x77, 0x4C, 0xB2, 0x29, 0x22, 0x93, 0xB0, 0x27,
+    0xF9, 0x42, 0x9A, 0x22, 0xAE, 0xD0, 0xD3, 0x2C, 0xAE, 0x25, 0xA4, 0x35, 0xAA, 0x52, 0x84, 0x69,
+    0x24, 0x63, 0x2D, 0xA7, 0xEC, 0x48, 0xE2, 0x3C, 0x41, 0xCB, 0x24, 0x2C, 0xAA, 0x4A, 0x29, 0x58,
+    0x0B, 0xC8, 0x56, 0xE0, 0x30, 0x07, 0x4F, 0x18, 0x01, 0x26, 0x19, 0xEC, 0xAC, 0xA0, 0x77, 0x7E,
+    0x1B, 0xFB, 0xD4, 0xD7, 0xA3, 0xC9, 0x8E, 0x89, 0x77, 0xE0, 0x47, 0x72, 0x7F, 0x47, 0x74, 0x97,
+    0xB2, 0xE9, 0x86, 0x0C, 0xBF, 0x8C, 0xC6, 0xFD, 0x49, 0xC3, 0x97, 0x78, 0xED, 0x52, 0x2B, 0x3F,
+    0x04, 0xEA, 0xA1, 0x8D, 0xF9, 0x64, 0x52, 0x30, 0xE6, 0x41, 0xC3, 0x31, 0x30, 0x27, 0xD5, 0xAA,
+    0xC2, 0xB0, 0x4A, 0xE0, 0x66, 0x8F, 0x18, 0x0C, 0xFB, 0x6E, 0xAC, 0xFD, 0x41, 0x63, 0x28, 0x38,
+    0xE4, 0xB3, 0x83, 0x17, 0x5A, 0x7D, 0xCB, 0x3E, 0xFC, 0x15, 0x3E, 0xC7, 0xA9, 0x86, 0x06, 0xE1,
+    0x52, 0xCD, 0xAC, 0x4E, 0xFD, 0x8E, 0xC9, 0x72, 0x67, 0x1A, 0x2C, 0xF7, 0x78, 0x15, 0xE8, 0x97,
+    0xF5, 0x2D, 0x5F, 0x6D, 0xF0, 0x9E, 0xCD, 0xA8, 0x3E, 0xCE, 0x04, 0x08, 0xE6, 0x99, 0x80, 0xA0,
+    0xD2, 0xB4, 0x68, 0xF5, 0x5C, 0xB0, 0x7A, 0xAE, 0xE2, 0xBB, 0xD7, 0xDF, 0x81, 0x62, 0x78, 0x31,
+    0x1B, 0xFB, 0x16, 0x9B, 0x7A, 0x64, 0x50, 0x13, 0x5F, 0x8C, 0xCB, 0x8B, 0xC7, 0x27, 0xC1, 0xF5,
+    0x39, 0x4E, 0x14, 0x15, 0x5F, 0xFC, 0x85, 0xC7, 0x2E, 0xF0, 0x45, 0xE4, 0x8B, 0x98, 0xAA, 0x95,
+    0x66, 0x07, 0x02, 0x13, 0x7D, 0xAA, 0xCF, 0xFB, 0xED, 0xC3, 0x98, 0x06, 0x51, 0xF1, 0xC5, 0x1F,
+    0x73, 0xE3, 0xD5, 0xAC, 0x52, 0xA1, 0x59, 0xA5, 0xF9, 0xE3, 0x2E, 0xDC, 0xC8, 0x4C, 0x10, 0x4F,
+    0xE5, 0xC4, 0xB9, 0x99, 0xB3, 0x5C, 0xBD, 0x91, 0x83, 0xC6, 0x0E, 0xBC, 0xAC, 0x46, 0x5D, 0xCE,
+    0xBC, 0xCC, 0xA0, 0x7A, 0xA0, 0xE3, 0x65, 0xDB, 0xAF, 0x70, 0x27, 0xCD, 0x4C, 0x7C, 0xBA, 0x0C,
+    0x73, 0x24, 0x88, 0x32, 0xA1, 0xB2, 0x45, 0xD0, 0x96, 0x71, 0x4B, 0x84, 0x6D, 0x4D, 0xF6, 0x44,
+    0x21, 0x44, 0xF1, 0x13, 0x20, 0xFD, 0x7A, 0x2E, 0x70, 0x17, 0x4D, 0x35, 0x11, 0xB4, 0xEE, 0x14,
+    0xA6, 0x54, 0xC4, 0x78, 0xA1, 0x6E, 0x4C, 0x9B, 0xB8, 0x1F, 0xB5, 0xF9, 0xD2, 0x80, 0xE6, 0x2B,
+    0x83, 0xF8, 0xD4, 0xAB, 0x95, 0x04, 0x53, 0x56, 0x45, 0xE8, 0x3D, 0x38, 0xBC, 0x0E, 0x8C, 0x7E,
+    0x59, 0x02, 0x63, 0x43, 0xD4, 0x0B, 0xDC, 0xEB, 0x89, 0xA1, 0x08, 0xF2, 0x0D, 0x36, 0xD4, 0x62,
+    0xBD, 0x1D, 0x68, 0xA7, 0x88, 0xC9, 0x9C, 0x8A, 0xC9, 0x60, 0x8C, 0x86, 0x47, 0xD0, 0x64, 0x4C,
+    0xD5, 0x53, 0x21, 0x93, 0xEF, 0x57, 0x70, 0xCC, 0x78, 0xEB, 0x39, 0x8B, 0x1A, 0x42, 0xD8, 0x0E,
+    0x9C, 0x76, 0x75, 0xA8, 0xA6, 0x4A, 0xA8, 0xCE, 0x89, 0xE5, 0x9E, 0x83, 0x98, 0x39, 0x0A, 0xEA,
+    0xAF, 0x21, 0x27, 0x84, 0x0C, 0x6D, 0xB6, 0xA3, 0x79, 0x70, 0x48, 0xB0, 0x6A, 0x96, 0xCC, 0xD4,
+    0x1C, 0xBE, 0x69, 0x78, 0xA5, 0x74, 0xAE, 0xA0, 0xEE, 0xCC, 0x35, 0x12, 0x38, 0x67, 0x2D, 0x6D,
+    0x1D, 0x9D, 0x04, 0x35, 0x7B, 0x1A, 0x46, 0x2B, 0xBC, 0xD9, 0xBA, 0xC8, 0x90, 0xDF, 0xD2, 0xFC,
+    0xB7, 0x84, 0xEA, 0x35, 0x82, 0xD4, 0x44, 0x68, 0xA9, 0x7F, 0xA7, 0x0E, 0x6B, 0x39, 0x74, 0x76,
+    0xEA, 0xCB, 0x76, 0xB0, 0xDC, 0x14, 0x57, 0x68, 0x7B, 0xD8, 0xDD, 0x5C, 0x9F, 0xA1, 0x3D, 0x0B,
+    0xDC, 0xB8, 0xBB, 0x68, 0x7F, 0xF3, 0x76, 0x87, 0x39, 0x07, 0xA7, 0x10, 0x37, 0x44, 0x68, 0xCB,
+    0x1E, 0xDC, 0xA1, 0xE3, 0x66, 0x4A, 0x23, 0xF7, 0x3F, 0x5E, 0x7F, 0x03, 0xB5, 0x55, 0xBD, 0x8E,
+    0xDE, 0x44, 0x14, 0xBD, 0x9F, 0x4D, 0x70, 0xE1, 0x62, 0xAA, 0x14, 0x54, 0xF3, 0x08, 0x7E, 0x84,
+    0x31, 0xA2, 0x48, 0x41, 0x43, 0xB1, 0x12, 0x05, 0x35, 0x45, 0x42, 0xC1, 0x23, 0xCC, 0x47, 0x1A,
+    0x5A, 0x2A, 0x6A, 0xCA, 0x64, 0x9B, 0x7D, 0x04, 0x1B, 0x51, 0x6C, 0x91, 0x22, 0x56, 0x28, 0x52,
+    0x6C, 0xB1, 0x56, 0x40, 0x44, 0x22, 0x45, 0x4C, 0xE2, 0xE8, 0xF3, 0x66, 0x67, 0xE6, 0xE4, 0xDC,
+    0xF1, 0xB7, 0x28, 0x1B, 0x36, 0x09, 0x08, 0x65, 0xA4, 0xB9, 0xBE, 0xBE, 0xF3, 0x77, 0xE6, 0xDC,
+    0x9F, 0x29, 0xEE, 0x14, 0x77, 0xC5, 0x0D, 0x6E, 0x28, 0xF0, 0x79, 0x10, 0x03, 0x6C, 0xC5, 0x63,
+    0x14, 0xF9, 0xF6, 0x27, 0xF9, 0xBB, 0xF9, 0x71, 0x83, 0x5D, 0x12, 0x07, 0x3F, 0x56, 0xAA, 0x80,
+    0x8A, 0xA5, 0x52, 0xAA, 0xE2, 0xBB, 0x5D, 0x34, 0xCF, 0xE1, 0x1F, 0x44, 0xB7, 0x8B, 0xEE, 0x17,
+    0xF8, 0x93, 0x99, 0x0A, 0x4A, 0x78, 0x0C, 0x6E, 0x87, 0x45, 0x15, 0xA1, 0x32, 0x52, 0x09, 0xAA,
+    0x6C, 0x4B, 0xE8, 0xA6, 0x1B, 0x55, 0x6E, 0x24, 0x69, 0x16, 0xBB, 0x08, 0x7A, 0x3F, 0x9A, 0x40,
+    0x53, 0x37, 0x54, 0xA9, 0x4A, 0x62, 0x17, 0x3F, 0x11, 0x07, 0xDA, 0x0D, 0x10, 0xA4, 0x02, 0x66,
+    0xB1, 0x09, 0x34, 0x8D, 0x98, 0x38, 0x0B, 0x63, 0x95, 0x36, 0xE8, 0x2D, 0x37, 0xE7, 0xC2, 0x12,
+    0xDF, 0x61, 0x5B, 0xE9, 0x5E, 0x35, 0x56, 0xC0, 0x04, 0x86, 0x81, 0x77, 0x41, 0xEB, 0x80, 0x28,
+    0xF8, 0xB3, 0x9B, 0xCB, 0x28, 0xDD, 0x60, 0xE6, 0x82, 0xA6, 0xA1, 0xA6, 0xA9, 0x6D, 0xE6, 0x2A,
+    0xD0, 0x64, 0x27, 0x9A, 0x7C, 0x5F, 0xC7, 0x02, 0xD2, 0xCC, 0x46, 0x4D, 0x7E, 0x2C, 0x88, 0xB9,
+    0xAD, 0x23, 0x8F, 0x6E, 0x08, 0x5C, 0xBA, 0xD3, 0x28, 0x9C, 0xF5, 0x1A, 0x21, 0x3C, 0x07, 0x81,
+    0x73, 0xB2, 0xDC, 0x16, 0x2A, 0xFB, 0x52, 0xE5, 0xA0, 0xF2, 0xE9, 0x58, 0x9F, 0x07, 0x7F, 0x3A,
+    0x99, 0x5D, 0x20, 0x1B, 0xF6, 0x71, 0xF0, 0xBF, 0x86, 0xE6, 0x58, 0xA5, 0xA3, 0x7C, 0x10, 0xFD,
+    0x8D, 0xE0, 0x07, 0x74, 0x95, 0x4A, 0xA8, 0xF4, 0x51, 0xA5, 0x0B, 0x59, 0x2E, 0x2A, 0xED, 0xAC,
+    0xD2, 0x4C, 0xC4, 0xC8, 0x46, 0x46, 0x4C, 0xF0, 0xA3, 0xE0, 0xF8, 0x2D, 0x0A, 0xAF, 0x7A, 0xCC,
+    0xBE, 0x57, 0x0E, 0x8F, 0xDE, 0x39, 0x99, 0x4A, 0x2F, 0x9B, 0xAF, 0xD5, 0x05, 0xF4, 0x76, 0x43,
+    0xAA, 0x0A, 0xE5, 0xCB, 0xA6, 0x2F, 0xD1, 0xAB, 0x9B, 0x3E, 0x03, 0x19, 0xA7, 0x53, 0xF2, 0x54,
+    0xF7, 0x8C, 0x73, 0x70, 0x92, 0xC8, 0xE9, 0x6A, 0x9A, 0xC4, 0x4D, 0xE8, 0x37, 0xB8, 0x8D, 0xAD,
+    0x89, 0x25, 0xFE, 0xC0, 0x44, 0xF7, 0xE8, 0x0A, 0xBA, 0xA7, 0x20, 0xD9, 0x22, 0xD7, 0x57, 0x92,
+    0x2C, 0xCD, 0x3B, 0xF6, 0xC8, 0x0E, 0xFF, 0xF2, 0x10, 0xA7, 0x0B, 0xDD, 0x4F, 0x04, 0x51, 0x3D,
+    0xAF, 0x28, 0xFE, 0xBD, 0x81, 0x2C, 0x7C, 0xD2, 0x56, 0xA1, 0xA1, 0xAB, 0xEE, 0x23, 0xEA, 0x81,
+    0x93, 0xC7, 0x57, 0xF8, 0x1E, 0x5B, 0xAB, 0x88, 0xF0, 0x10, 0x52, 0x27, 0x2E, 0xF0, 0x8F, 0x13,
+    0xC9, 0xDA, 0x2B, 0xB4, 0x4C, 0xD2, 0x71, 0xC8, 0x44, 0x1F, 0x0A, 0xF2, 0x92, 0xB0, 0x28, 0x41,
+    0x55, 0x02, 0xC3, 0xE6, 0x91, 0x06, 0x91, 0x7C, 0xC1, 0x90, 0xCA, 0xFC, 0xCA, 0x5B, 0x14, 0xB2,
+    0x74, 0xB3, 0xA5, 0xC3, 0x17, 0x72, 0x14, 0x6A, 0x60, 0xB1, 0xF8, 0x71, 0x72, 0xC4, 0xE3, 0x66,
+    0x4E, 0x98, 0x44, 0xBA, 0xF1, 0x72, 0x57, 0x9B, 0x8E, 0xB9, 0x28, 0x1F, 0x59, 0x9C, 0x2F, 0xBA,
+    0x86, 0x6B, 0x17, 0x12, 0xFD, 0xBB, 0xC8, 0x41, 0xA6, 0x86, 0x9C, 0xE3, 0x09, 0xFB, 0x4B, 0xF6,
+    0x74, 0xEB, 0x28, 0x1D, 0xB6, 0x39, 0x27, 0xE8, 0x16, 0x92, 0x2B, 0xF9, 0xBA, 0xFF, 0xC1, 0xA0,
+    0xCD, 0x24, 0x7A, 0xF3, 0x67, 0xFE, 0x75, 0x03, 0x0F, 0x77, 0x53, 0xAD, 0x39, 0xC4, 0x51, 0x86,
+    0x7A, 0x33, 0x73, 0xA6, 0xE6, 0x0B, 0xFD, 0xD8, 0x77, 0xBD, 0x34, 0x13, 0x77, 0x28, 0x93, 0x25,
+    0xC6, 0xEE, 0x1E, 0xF7, 0xB1, 0xCF, 0x79, 0xD7, 0x32, 0x69, 0x7C, 0x77, 0xBA, 0x9D, 0xD1, 0xF4,
+    0x2F, 0xE8, 0x4D, 0xDE, 0x45, 0xA3, 0xCF, 0x44, 0xD9, 0x1F, 0xA6, 0x5B, 0xAC, 0x47, 0x7E, 0xAA,
+    0xC3, 0x4E, 0x85, 0x61, 0x6A, 0x72, 0x94, 0x22, 0xDF, 0x9E, 0xED, 0xDA, 0x81, 0x5C, 0x2C, 0xB8,
+    0xC0, 0xA7, 0x90, 0x57, 0xD0, 0x97, 0x07, 0x36, 0xFE, 0xC5, 0x1A, 0x28, 0x51, 0x73, 0x4A, 0xB3,
+    0x5C, 0x25, 0x53, 0x34, 0xBA, 0xBF, 0x30, 0x35, 0xC1, 0x04, 0x93, 0x4C, 0xE0, 0x0A, 0x8D, 0x5C,
+    0xF4, 0xCD, 0x0B, 0x6C, 0x79, 0xB5, 0xC8, 0x44, 0x66, 0xAD, 0x38, 0xD2, 0x7B, 0xA9, 0x9F, 0xF3,
+    0x40, 0xEF, 0x26, 0x13, 0x1D, 0x13, 0xB8, 0x42, 0xCD, 0xE2, 0x53, 0xB2, 0x48, 0x9C, 0xE1, 0x04,
+    0xBD, 0x56, 0x01, 0xA5, 0x05, 0x1A, 0xEB, 0xF4, 0x43, 0x6A, 0xDF, 0x8B, 0xEA, 0xAA, 0x01, 0xC9,
+    0x4E, 0x75, 0xB3, 0x0D, 0x82, 0xD1, 0x68, 0xF1, 0xD1, 0x3C, 0x61, 0x79, 0xBA, 0x47, 0xF2, 0xF0,
+    0x54, 0xE3, 0x41, 0x39, 0x68, 0x94, 0x3B, 0xB3, 0xB2, 0x38, 0xEC, 0x19, 0xEA, 0x58, 0x46, 0x04,
+    0xF7, 0xA3, 0xE4, 0xCC, 0xAA, 0x51, 0x10, 0x14, 0x77, 0x61, 0xA2, 0x33, 0x56, 0xBA, 0x49, 0x9A,
+    0x7C, 0x0E, 0xD9, 0xE3, 0xA6, 0xFF, 0x5F, 0x68, 0xC2, 0xBD, 0x21, 0xB4, 0x80, 0x5C, 0x21, 0x3E,
+    0xBE, 0xB3, 0xBF, 0xAB, 0x27, 0x7C, 0x7B, 0xAE, 0x31, 0xA2, 0x79, 0xDD, 0x5D, 0x32, 0xB0, 0x3A,
+    0x1E, 0x71, 0x8F, 0xDF, 0xD8, 0x35, 0x77, 0x52, 0xC1, 0x98, 0xDD, 0xAE, 0x99, 0xC1, 0xF8, 0xCA,
+    0x69, 0xB2, 0x79, 0xDD, 0xB0, 0x7F, 0x2F, 0x58, 0x2D, 0xB5, 0x7A, 0x7C, 0xB8, 0x8F, 0x7A, 0x15,
+    0x57, 0x7F, 0xF6, 0x20, 0x08, 0xAD, 0x99, 0xF3, 0xC3, 0x92, 0x57, 0x7C, 0xC0, 0xDF, 0x7C, 0x2C,
+    0xE2, 0x7A, 0x3C, 0x4B, 0xD1, 0xA5, 0xDF, 0x61, 0x7D, 0x90, 0xE2, 0x3E, 0x86, 0xAE, 0xFC, 0xE5,
+    0x0B, 0xAC, 0x8D, 0x95, 0x22, 0xE7, 0xE0, 0x7C, 0xA1, 0xDE, 0xEA, 0x34, 0xAD, 0xD6, 0x97, 0xA7,
+    0x39, 0x3B, 0x90, 0x1C, 0xBF, 0xB9, 0x7A, 0xE8, 0x7B, 0xA4, 0x05, 0xB7, 0x39, 0xFB, 0x46, 0x9F,
+    0x9F, 0x96, 0x61, 0x99, 0x21, 0x65, 0x40, 0x54, 0x0B, 0x55, 0x9F, 0x70, 0x27, 0xAD, 0x34, 0x79,
+    0x6E, 0xAF, 0xEA, 0x0F, 0xF2, 0x8F, 0xF6, 0x0A, 0xCD, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD,
+    0x7E, 0x2F, 0x59, 0x17, 0x2E, 0xDC, 0x51, 0x40, 0xE1, 0x86, 0x1A, 0xFF, 0x84, 0x31, 0xE2, 0x07,
+    0xB0, 0x45, 0x5E, 0xDA, 0x50, 0x02, 0xCD, 0xFE, 0x84, 0x71, 0xA0, 0x48, 0xBB, 0x05, 0xD4, 0x69,
+    0x88, 0x94, 0x64, 0x1B, 0x4A, 0xBA, 0xB1, 0x40, 0x68, 0x0B, 0x0A, 0x4C, 0x9A, 0x14, 0x14, 0x8C,
+    0x20, 0x11, 0xE2, 0xA5, 0x71, 0x14, 0x47, 0xCF, 0xBB, 0x78, 0xE6, 0xE4, 0xDC, 0xF1, 0xEE, 0x66,
+    0x01, 0x45, 0x5A, 0x44, 0x83, 0xF5, 0xE6, 0xCE, 0xBC, 0x99, 0x3B, 0xF7, 0xE3, 0xDC, 0x8F, 0x11,
+    0xD1, 0xCF, 0x7A, 0x91, 0x35, 0xDE, 0x48, 0x5F, 0xDE, 0x50, 0x0A, 0xF4, 0x89, 0x4E, 0x89, 0x06,
+    0xD2, 0xA7, 0x07, 0x50, 0x9E, 0xF5, 0x3F, 0x68, 0xA1, 0xF4, 0x14, 0x31, 0x71, 0xCE, 0x89, 0x0E,
+    0x4A, 0x63, 0xB3, 0x86, 0xEA, 0xAB, 0x26, 0x91, 0x3C, 0x8A, 0x64, 0x68, 0x17, 0xE5, 0x69, 0x03,
+    0x1B, 0x6E, 0x00, 0x8D, 0xEA, 0xA8, 0xB8, 0xB8, 0x83, 0x9B, 0x78, 0x8E, 0xB6, 0x0C, 0xD6, 0xAF,
+    0x70, 0x6B, 0x12, 0x3C, 0x8E, 0x62, 0x9F, 0xE3, 0x19, 0x66, 0x95, 0x4A, 0x8E, 0x90, 0x03, 0x4F,
+    0x24, 0xFB, 0xA4, 0x11, 0x8B, 0x49, 0x1C, 0xAF, 0x1A, 0x1A, 0xF9, 0xDE, 0x4D, 0x0C, 0x94, 0x3A,
+    0x8A, 0xD4, 0x94, 0x5A, 0x52, 0x3D, 0x2E, 0x46, 0xB6, 0xB9, 0x35, 0x53, 0x1B, 0x87, 0x99, 0x1A,
+    0x71, 0x83, 0x3B, 0x82, 0xE7, 0xBD, 0x8E, 0x43, 0x0E, 0xC0, 0x2B, 0x37, 0x12, 0x1E, 0xD7, 0xBF,
+    0x50, 0x8B, 0x6A, 0x78, 0x1A, 0x49, 0x91, 0x34, 0x93, 0x74, 0xB0, 0xBE, 0x8E, 0x07, 0xB1, 0x9A,
+    0xCA, 0x59, 0x70, 0x1C, 0x79, 0x54, 0x9F, 0xE0, 0x33, 0x34, 0x79, 0xA4, 0x39, 0x9D, 0xE0, 0x17,
+    0xB2, 0x88, 0xD9, 0x51, 0x8B, 0x94, 0x81, 0x56, 0x26, 0xFC, 0x5C, 0x9F, 0xE1, 0xEE, 0x44, 0x61,
+    0xEE, 0x31, 0xD1, 0x68, 0x68, 0x7E, 0xEB, 0x22, 0x26, 0xEB, 0x4B, 0x75, 0x81, 0x3E, 0x61, 0xA6,
+    0xA0, 0x5C, 0x55, 0x53, 0x6D, 0x93, 0xB4, 0xCB, 0x0A, 0x88, 0x1C, 0xF0, 0x14, 0x1C, 0x4B, 0x6C,
+    0xAC, 0x47, 0x97, 0x47, 0xAA, 0x3D, 0x5B, 0x50, 0x4E, 0x3A, 0x4A, 0x3C, 0xC4, 0x80, 0x46, 0xBE,
+    0x74, 0xBE, 0xA4, 0x49, 0x19, 0x3A, 0xEB, 0xCD, 0x48, 0x1E, 0x42, 0xF5, 0xAB, 0x32, 0x13, 0x07,
+    0xEB, 0xB3, 0x87, 0xC4, 0x99, 0x5B, 0x74, 0x5B, 0x15, 0xB9, 0x8E, 0x3A, 0xF4, 0x5F, 0x3E, 0x2C,
+    0x0A, 0xE5, 0xED, 0x7D, 0x22, 0x06, 0x4F, 0x97, 0xD1, 0x15, 0x50, 0x8F, 0x7B, 0x3B, 0x92, 0x17,
+    0x9F, 0x43, 0x8A, 0xD9, 0x0E, 0xE2, 0x7E, 0xE0, 0xEE, 0x4C, 0x98, 0xB0, 0x2C, 0xFC, 0x12, 0x40,
+    0x31, 0x83, 0x66, 0x48, 0x27, 0x1F, 0x95, 0xD8, 0x3A, 0xD1, 0x38, 0x6B, 0x08, 0xD5, 0x83, 0x43,
+    0x91, 0x0D, 0x19, 0xBE, 0x59, 0x51, 0xAA, 0x77, 0xED, 0x0A, 0xB4, 0xBF, 0xE2, 0x42, 0x3E, 0xCE,
+    0x0E, 0x17, 0xA5, 0xD9, 0x3D, 0x0D, 0x7A, 0x54, 0xE6, 0x59, 0xA3, 0x37, 0x54, 0x0C, 0xE8, 0x07,
+    0x68, 0xCA, 0x89, 0x52, 0xDD, 0xB1, 0x6A, 0x7E, 0xAD, 0x50, 0x17, 0xF1, 0x22, 0x55, 0x55, 0xF3,
+    0x2C, 0x7B, 0x82, 0x78, 0x34, 0xE4, 0xAA, 0xB0, 0x52, 0xF0, 0x6B, 0x9C, 0x10, 0xC4, 0x7D, 0xC9,
+    0x34, 0x8A, 0xC9, 0xBC, 0x44, 0x78, 0xDE, 0x5F, 0x22, 0x47, 0x20, 0x1A, 0xE7, 0xA7, 0xFB, 0x24,
+    0x15, 0xDA, 0x3C, 0xB8, 0x84, 0x24, 0xC6, 0x1C, 0xA7, 0x0C, 0x09, 0xBA, 0x9A, 0xA4, 0x29, 0x49,
+    0x18, 0x4C, 0x92, 0x22, 0x90, 0xF9, 0xEA, 0x84, 0xC2, 0x13, 0xA1, 0xCF, 0x67, 0xA4, 0xD6, 0x9C,
+    0x63, 0x96, 0x92, 0x0C, 0x4A, 0x7A, 0xA6, 0xA1, 0x72, 0x7C, 0x7A, 0xA8, 0xE9, 0xA8, 0x1E, 0xB1,
+    0x16, 0x6A, 0x2F, 0xEB, 0xF1, 0x2C, 0x24, 0x0A, 0xE6, 0x31, 0x52, 0xAE, 0x1F, 0xE3, 0xE1, 0x7D,
+    0xFA, 0xAD, 0x36, 0x5F, 0x7D, 0x92, 0xEC, 0x41, 0xAA, 0x0B, 0x45, 0xB7, 0x48, 0x15, 0xF5, 0xE5,
+    0xD7, 0x66, 0x5A, 0x22, 0xA6, 0x20, 0x12, 0xD1, 0xF6, 0x62, 0x3C, 0xDD, 0x34, 0xBA, 0xA7, 0x67,
+    0xC4, 0xF5, 0x5A, 0x85, 0xED, 0xA4, 0x77, 0x78, 0x57, 0xCB, 0xE0, 0x49, 0xAA, 0x8B, 0xB7, 0x58,
+    0x14, 0x88, 0xEF, 0xA7, 0x94, 0xC4, 0x68, 0xFD, 0x3B, 0xDF, 0xD2, 0xE8, 0x82, 0xA3, 0x62, 0xAC,
+    0x6B, 0x66, 0x70, 0x8D, 0xC0, 0x75, 0x90, 0x3D, 0x86, 0x93, 0xB5, 0xC5, 0xF1, 0x3D, 0x63, 0x5B,
+    0xFF, 0xE1, 0x34, 0x7A, 0x8F, 0x96, 0x7C, 0xED, 0x35, 0xC9, 0xB3, 0x75, 0xB0, 0x7F, 0xC2, 0xF4,
+    0x5F, 0xA9, 0x97, 0xBF, 0xC7, 0x37, 0xFD, 0xAE, 0x65, 0xEB, 0x71, 0x36, 0x77, 0x7F, 0x3B, 0x89,
+    0xE6, 0xC3, 0xFE, 0xF0, 0xDD, 0x04, 0x0A, 0x3D, 0xB3, 0xFE, 0xAA, 0x44, 0xAE, 0x4B, 0x1E, 0xC4,
+    0xF9, 0x82, 0x7F, 0x7A, 0x86, 0x3A, 0x7D, 0xAE, 0x67, 0x64, 0xFE, 0x25, 0xA9, 0x02, 0xF0, 0x23,
+    0x26, 0xC4, 0x22, 0x36, 0xE7, 0xE1, 0xA9, 0x35, 0x6B, 0x15, 0x00, 0x60, 0x29, 0x59, 0x56, 0x01,
+    0xA5, 0x6F, 0xD5, 0x71, 0x31, 0x7E, 0x89, 0x3C, 0x7B, 0xE5, 0xA6, 0x91, 0x75, 0xD4, 0xCC, 0x6B,
+    0x25, 0xB5, 0x91, 0x59, 0x4C, 0x5F, 0x2A, 0x77, 0x39, 0xF2, 0x90, 0x7D, 0x31, 0x08, 0xD7, 0x24,
+    0x8D, 0x19, 0x56, 0x68, 0x6D, 0xC7, 0x9B, 0xCE, 0x1B, 0xF6, 0x4B, 0xB1, 0x3B, 0x72, 0x6B, 0xBF,
+    0x23, 0xA8, 0xBC, 0x19, 0x0C, 0x93, 0x91, 0x13, 0x0B, 0x79, 0xAD, 0x8D, 0xEF, 0xAF, 0x1F, 0xDD,
+    0x55, 0x0B, 0xAE, 0x32, 0x9D, 0x1E, 0x61, 0x7B, 0x4F, 0xF3, 0x4B, 0xEB, 0x61, 0x99, 0xC6, 0x65,
+    0x9A, 0x13, 0x4B, 0x15, 0xD2, 0x54, 0xC4, 0xCB, 0x53, 0x99, 0x36, 0xB7, 0x0B, 0x0B, 0xB4, 0x85,
+    0x49, 0x6A, 0x51, 0x3A, 0xC5, 0xFF, 0x45, 0xC9, 0xED, 0x3D, 0x50, 0x18, 0x86, 0xF3, 0xFE, 0x30,
+    0x9C, 0x35, 0xB9, 0xD2, 0xFF, 0x0D, 0xA5, 0x9F, 0xD0, 0x16, 0xDA, 0xBE, 0xCD, 0x50, 0x4D, 0x8A,
+    0xB2, 0xAF, 0xC7, 0x0C, 0xB7, 0x69, 0x51, 0x64, 0x25, 0x56, 0x6A, 0x2F, 0xC1, 0xD0, 0xA7, 0x28,
+    0xB0, 0x3D, 0x39, 0x6E, 0x4D, 0x46, 0x5B, 0xAF, 0x99, 0xF8, 0x0E, 0xD8, 0x81, 0x17, 0xD9, 0xA9,
+    0xD8, 0xB9, 0xE9, 0x7A, 0xA6, 0xB2, 0x56, 0xE8, 0x5E, 0xF7, 0xD7, 0xFA, 0xBC, 0xBF, 0x66, 0x6A,
+    0x43, 0x3E, 0x5E, 0xD6, 0x9C, 0x61, 0xA7, 0xCF, 0x09, 0x93, 0x53, 0x17, 0xE0, 0xA2, 0xE2, 0x62,
+    0xAD, 0x0B, 0xEB, 0x76, 0xA1, 0x7C, 0x01, 0xFB, 0x28, 0x98, 0x5D, 0x30, 0xDF, 0xC1, 0xFE, 0x3C,
+    0x72, 0xA1, 0xAF, 0x28, 0x7A, 0x3E, 0x29, 0xE9, 0xC9, 0xD5, 0xB7, 0x85, 0xEF, 0xAB, 0x9D, 0x75,
+    0xD1, 0x2E, 0x0F, 0xE9, 0x7F, 0xFE, 0x5E, 0x01, 0x9D, 0x55, 0xA1, 0xB6, 0x1C, 0x45, 0x10, 0xAD,
+    0xD9, 0x01, 0x46, 0xAC, 0x68, 0x04, 0x8A, 0x88, 0xF5, 0x98, 0xF9, 0x84, 0xDE, 0x80, 0x88, 0x40,
+    0x10, 0xB3, 0x20, 0x10, 0x68, 0x30, 0x7C, 0x42, 0x2F, 0x41, 0x20, 0x10, 0x0F, 0x85, 0x8E, 0xCD,
+    0xF2, 0x03, 0x11, 0x9C, 0xD3, 0x4D, 0x9E, 0x40, 0x20, 0x98, 0x08, 0x0E, 0xF2, 0x0D, 0x01, 0xCE,
+    0xE1, 0x80, 0x48, 0x9F, 0x64, 0x38, 0x6F, 0x78, 0xE9, 0x99, 0xE2, 0xDE, 0x9A, 0x5D, 0x78, 0x89,
+    0x83, 0xD9, 0x6C, 0x57, 0x76, 0xBA, 0xBA, 0xFA, 0xD6, 0xAD, 0x5B, 0xF5, 0xE4, 0xA3, 0xFD, 0x1B,
+    0x5F, 0x88, 0xCB, 0x6E, 0x90, 0x5A, 0xD7, 0x45, 0x24, 0xE8, 0x24, 0xD2, 0x70, 0x91, 0x1B, 0xBF,
+    0xC8, 0xB5, 0xC7, 0x8F, 0x78, 0xDD, 0xA8, 0xAC, 0x74, 0xAB, 0x9D, 0x68, 0x6A, 0x47, 0x09, 0x7D,
+    0xAD, 0xD2, 0x0E, 0x12, 0x3B, 0x57, 0x64, 0x33, 0x36, 0x33, 0x62, 0xAC, 0x54, 0x24, 0x26, 0x4D,
+    0xE2, 0xC6, 0xD0, 0xC1, 0xB9, 0xCD, 0x88, 0xF9, 0xFD, 0x28, 0xE2, 0x9E, 0x21, 0xE6, 0x4A, 0x95,
+    0xA1, 0x74, 0x2F, 0xB2, 0x86, 0x8F, 0x54, 0x9A, 0xF9, 0x7B, 0xC0, 0x82, 0x10, 0xB8, 0x78, 0xC6,
+    0x82, 0xA0, 0x52, 0x35, 0xDC, 0x56, 0x2E, 0x1E, 0xD7, 0x89, 0xE3, 0xB2, 0xE2, 0x39, 0x7B, 0x36,
+    0xA3, 0xF8, 0xCB, 0x59, 0xDC, 0xA4, 0xFB, 0x5A, 0x43, 0x2F, 0x7A, 0xF1, 0x1F, 0x5E, 0xE0, 0x09,
+    0xF8, 0x5E, 0xE0, 0x7B, 0x89, 0x6F, 0x11, 0x62, 0x64, 0xEE, 0xC4, 0x0E, 0xF0, 0x22, 0xAF, 0xDF,
+    0x15, 0x9F, 0xF9, 0xCF, 0x95, 0x70, 0xB4, 0xFC, 0x3D, 0x5C, 0xB7, 0x03, 0x19, 0xD9, 0xD0, 0xB6,
+    0x66, 0xB9, 0x00, 0x57, 0x5B, 0x68, 0xDB, 0x11, 0x8B, 0x87, 0x1D, 0x90, 0x96, 0x9F, 0x70, 0xC4,
+    0x4D, 0x12, 0x66, 0x84, 0x5A, 0xCF, 0xC8, 0x0A, 0x16, 0x4C, 0xC2, 0x92, 0xC1, 0x4A, 0x75, 0x1B,
+    0xBB, 0x95, 0xBE, 0xA5, 0xBA, 0xD7, 0x54, 0xE9, 0xF9, 0xA4, 0xE4, 0x4F, 0xBF, 0x2D, 0xFA, 0x10,
+    0x09, 0xC7, 0x3F, 0xC6, 0xF0, 0x08, 0xC0, 0xFC, 0xB3, 0x81, 0xF8, 0xA5, 0xD5, 0xBC, 0x61, 0x79,
+    0x9C, 0xF6, 0x0E, 0xD8, 0xC1, 0x63, 0xD7, 0xE8, 0x40, 0xD6, 0x52, 0xAD, 0x3D, 0x93, 0x40, 0x8C,
+    0x24, 0xD7, 0x88, 0xCA, 0x88, 0x35, 0x93, 0x5F, 0x9F, 0xE9, 0xB3, 0x24, 0xA1, 0x5D, 0xAD, 0x8E,
+    0x00, 0x2B, 0xBD, 0xA3, 0x5B, 0xF0, 0x1E, 0xFA, 0xD0, 0xE3, 0xA0, 0x21, 0x8E, 0xD9, 0x15, 0x38,
+    0xFA, 0xA9, 0xC6, 0xFB, 0xAE, 0xD5, 0x4F, 0x74, 0xEB, 0x46, 0xA7, 0x39, 0xA6, 0x95, 0xE2, 0x52,
+    0xDF, 0x4B, 0xF8, 0xB1, 0xE8, 0x07, 0x99, 0x45, 0x6D, 0x1F, 0x17, 0x94, 0x51, 0x6B, 0x62, 0xF2,
+    0xC8, 0x64, 0xA6, 0x7C, 0x92, 0x33, 0x2A, 0xBB, 0x8A, 0x15, 0x23, 0xA3, 0x44, 0xB1, 0xD4, 0x78,
+    0xF5, 0x95, 0x1E, 0xEE, 0x22, 0x77, 0xF8, 0x7B, 0xAC, 0x5B, 0x87, 0xA5, 0x03, 0xFA, 0x2D, 0xF6,
+    0x0D, 0xB7, 0xBF, 0xBA, 0xC7, 0xEC, 0xB0, 0x5F, 0x63, 0xAB, 0xA7, 0x2B, 0x88, 0xFB, 0xEB, 0x63,
+    0xA5, 0xCA, 0xFC, 0x08, 0x5C, 0xE4, 0x0E, 0x04, 0x25, 0xC4, 0x0C, 0xF9, 0xF8, 0x72, 0x1B, 0x26,
+    0x7A, 0xAA, 0x05, 0xE5, 0x71, 0x8A, 0x51, 0x7F, 0x3B, 0xC5, 0x3C, 0xDD, 0xBE, 0x5C, 0x64, 0x55,
+    0x3F, 0x39, 0xC2, 0xE1, 0x3D, 0xDD, 0xDD, 0x7E, 0xCE, 0x73, 0x32, 0x4F, 0xA0, 0xFB, 0x17, 0x68,
+    0x72, 0xD3, 0x2E, 0xBE, 0x70, 0x7B, 0xEC, 0xDD, 0xFC, 0xAE, 0x0E, 0xB5, 0xC5, 0x3B, 0x05, 0xFD,
+    0xA7, 0x6B, 0xE0, 0x55, 0x45, 0xD6, 0x54, 0x36, 0xD8, 0x82, 0x89, 0x66, 0xD0, 0x03, 0x3A, 0x6A,
+    0x42, 0xDD, 0x5E, 0x19, 0x10, 0x15, 0x7C, 0xBD, 0x0A, 0xDA, 0x8B, 0x1D, 0xB0, 0x4E, 0xD0, 0x14,
+    0x08, 0x42, 0x7F, 0x88, 0x7F, 0xEE, 0x76, 0x96, 0x94, 0xCE, 0x2F, 0x9A, 0xDF, 0xF5, 0xEA, 0x70,
+    0x0F, 0x9E, 0x31, 0x5F, 0x3B, 0x70, 0x3A, 0xEE, 0x97, 0x60, 0x9B, 0xD9, 0x0C, 0x5A, 0xA7, 0xBA,
+    0xAF, 0xA9, 0x59, 0xAE, 0xAD, 0x16, 0x83, 0x3E, 0x37, 0xD3, 0x90, 0x7C, 0x3C, 0x2F, 0xDF, 0xE6,
+    0x5A, 0x7D, 0x08, 0x25, 0x42, 0x61, 0x13, 0x2B, 0xC7, 0x15, 0xDB, 0x05, 0xDD, 0xAD, 0x37, 0xEF,
+    0xC7, 0x0E, 0x8A, 0x46, 0x45, 0xD1, 0xEE, 0x48, 0x9B, 0x17, 0x45, 0x42, 0x49, 0xCF, 0xAD, 0x57,
+    0xF1, 0xEA, 0xB0, 0x8F, 0x1D, 0x39, 0x3C, 0x7A, 0xF2, 0xD4, 0x4B, 0x8C, 0xF0, 0xE5, 0xD7, 0x11,
+    0x8A, 0x63, 0xB4, 0xCA, 0x56, 0x70, 0x42, 0xB0, 0xF2, 0x1A, 0x39, 0x9F, 0x4C, 0xAA, 0xC6, 0xBF,
+    0xB3, 0x89, 0x50, 0x2B, 0xB1, 0xAF, 0xE6, 0xC0, 0x57, 0xFA, 0x0E, 0x3D, 0xC3, 0x03, 0xBE, 0x6A,
+    0x7B, 0x8F, 0x57, 0x36, 0xAF, 0xD0, 0xB2, 0x6C, 0xD8, 0xDA, 0x2A, 0x68, 0x69, 0x2D, 0x98, 0xD8,
+    0x2A, 0xCA, 0x0B, 0xB2, 0xBE, 0x3D, 0x62, 0x0C, 0xF9, 0x87, 0x2A, 0xF5, 0xE4, 0x06, 0x8F, 0x1E,
+    0xAB, 0x27, 0xF4, 0x39, 0x4A, 0x72, 0x13, 0xAD, 0xD7, 0xF9, 0xCE, 0xF7, 0x2D, 0x22, 0xAD, 0x0B,
+    0xD4, 0x3E, 0x55, 0x7A, 0x0B, 0x0A, 0xDA, 0xFA, 0xA7, 0x90, 0x50, 0xC7, 0x69, 0x60, 0x4F, 0xAB,
+    0x86, 0xC6, 0x00, 0x10, 0x9F, 0xBB, 0x2C, 0x9C, 0x5A, 0x2D, 0x1A, 0xAD, 0xED, 0x78, 0x7B, 0x59,
+    0x33, 0xCD, 0x3D, 0x80, 0x9A, 0x64, 0x2B, 0x93, 0xAC, 0x49, 0xAB, 0x29, 0x11, 0x73, 0x2F, 0x7E,
+    0x56, 0x42, 0x72, 0x43, 0x38, 0x9F, 0x56, 0xDA, 0x94, 0x36, 0xFB, 0x3E, 0x7C, 0x83, 0x9B, 0x9A,
+    0xE2, 0x40, 0x7F, 0x48, 0x36, 0x2A, 0xD9, 0xB7, 0x1C, 0x7A, 0x64, 0x80, 0x22, 0x8D, 0xD0, 0x1D,
+    0x38, 0x34, 0x12, 0xA8, 0x9E, 0xA7, 0xC5, 0xB6, 0xF5, 0x8C, 0x83, 0x07, 0x57, 0x6E, 0x6C, 0x26,
+    0x19, 0x15, 0x54, 0xE2, 0x36, 0x62, 0xC4, 0xED, 0xDE, 0x2F, 0xD5, 0x22, 0xE7, 0x93, 0x60, 0x49,
+    0x88, 0x19, 0xCD, 0xB5, 0x1E, 0x22, 0x38, 0xE9, 0x71, 0x5A, 0xDD, 0x18, 0x21, 0xDD, 0x35, 0x9A,
+    0x18, 0x83, 0x3C, 0x61, 0xFD, 0x74, 0xE6, 0x0C, 0xAA, 0x67, 0xD2, 0x80, 0xCF, 0x08, 0xA6, 0x80,
+    0x12, 0x9F, 0xAC, 0x0F, 0x20, 0xF5, 0x7D, 0x3C, 0xC7, 0xA0, 0xC0, 0x20, 0xD0, 0xB3, 0x12, 0x7A,
+    0x87, 0x0E, 0xF0, 0x4F, 0x40, 0x53, 0xBF, 0x9E, 0x4E, 0x23, 0x26, 0x5B, 0x02, 0x0D, 0xC7, 0x00,
+    0xBF, 0x6C, 0xAF, 0xBD, 0x80, 0x10, 0x7F, 0x91, 0xB9, 0xD9, 0xFE, 0x3C, 0x71, 0xD3, 0xE5, 0x00,
+    0xF1, 0xA1, 0x68, 0x2E, 0x53, 0x7C, 0x54, 0xF1, 0xC6, 0xD0, 0x99, 0x32, 0x55, 0x31, 0x88, 0x0E,
+    0xF1, 0xF1, 0x8C, 0xC2, 0xA4, 0xF6, 0xC9, 0xEC, 0xBB, 0x0D, 0x2A, 0x13, 0x3F, 0x1F, 0x9B, 0x02,
+    0xD6, 0x7E, 0x22, 0x40, 0x5D, 0x8F, 0x20, 0x2F, 0xE9, 0x9B, 0x40, 0xBA, 0xC1, 0x28, 0x8A, 0x7B,
+    0xBD, 0x85, 0x2C, 0x40, 0x43, 0xAE, 0x2D, 0xC2, 0x92, 0xFD, 0xD2, 0xD8, 0x7A, 0xBC, 0x04, 0x64,
+    0xFE, 0xBA, 0x0B, 0x2C, 0x51, 0xB2, 0x59, 0x84, 0x76, 0x18, 0xAD, 0x2B, 0x96, 0xBF, 0x3E, 0x67,
+    0xAC, 0xF3, 0x6A, 0xE9, 0x81, 0x1B, 0x84, 0xCD, 0x1F, 0x9C, 0xA2, 0xDE, 0x0C, 0xAB, 0x89, 0x3D,
+    0x37, 0x23, 0x65, 0xB4, 0x4C, 0xAF, 0xE7, 0x90, 0x12, 0x90, 0x34, 0x1C, 0xA7, 0xFC, 0x50, 0x45,
+    0xB9, 0xC5, 0x00, 0x60, 0x0F, 0xF6, 0x36, 0x34, 0x97, 0xFF, 0x70, 0x9C, 0x73, 0xCA, 0xCF, 0xA4,
+    0x3C, 0xB9, 0x45, 0x4E, 0x96, 0xA8, 0xD5, 0x24, 0xB5, 0x0C, 0x0C, 0xF9, 0x62, 0x94, 0x52, 0x84,
+    0x10, 0xA8, 0xFD, 0xA1, 0xBC, 0x18, 0xD8, 0x01, 0x85, 0x52, 0x38, 0x8E, 0x0D, 0x4B, 0x6A, 0x0F,
+    0x2D, 0x9D, 0x65, 0xF8, 0x3C, 0x42, 0x19, 0x40, 0x43, 0x0A, 0x77, 0x66, 0x0A, 0x3A, 0xC2, 0x64,
+    0x10, 0xF0, 0xDD, 0xB8, 0x1E, 0xDD, 0x20, 0xFF, 0xE3, 0xF9, 0x1B, 0xDD, 0x55, 0xBD, 0x8E, 0x1D,
+    0x35, 0x14, 0x3E, 0x73, 0x87, 0x64, 0x8A, 0x29, 0xDC, 0x10, 0x9A, 0x14, 0xEE, 0xB7, 0x99, 0x37,
+    0xC0, 0x17, 0xF1, 0x00, 0x49, 0x91, 0x08, 0x09, 0x6A, 0x6A, 0x1E, 0xC1, 0x57, 0xF0, 0x00, 0x80,
+    0x44, 0x47, 0x43, 0x89, 0x92, 0x62, 0x1F, 0x61, 0x9C, 0xA4, 0x48, 0xC9, 0x40, 0x90, 0x28, 0x19,
+    0x69, 0xB7, 0x44, 0xC2, 0x2B, 0x0D, 0x30, 0x9B, 0xF5, 0xF5, 0xE1, 0xFB, 0xCE, 0x6C, 0xB4, 0x04,
+    0x81, 0x10, 0x1D, 0xC2, 0xF7, 0xEA, 0xD8, 0xBE, 0xB6, 0xBF, 0xF3, 0x9D, 0xDF, 0xAB, 0x29, 0x28,
+    0x46, 0x0E, 0xD9, 0x71, 0x2E, 0xAE, 0xB4, 0x9C, 0xB5, 0x55, 0x89, 0x9C, 0x45, 0x53, 0x5F, 0x1F,
+    0xBE, 0xA7, 0xFB, 0x90, 0x65, 0x4C, 0x8D, 0x1E, 0x5C, 0x11, 0x7C, 0xF5, 0x80, 0x0B, 0x90, 0x9A,
+    0x70, 0x41, 0xFC, 0x0A, 0x11, 0x7E, 0xC1, 0x35, 0x9D, 0xC4, 0x70, 0x74, 0x95, 0x0D, 0x47, 0x67,
+    0xD9, 0xE6, 0x2A, 0xE1, 0xE5, 0x63, 0x2E, 0x12, 0x9F, 0x9F, 0xE9, 0x50, 0xA8, 0x62, 0xD6, 0x67,
+    0x54, 0x11, 0xA0, 0x3F, 0xCE, 0xE0, 0x50, 0xB6, 0x4F, 0x7F, 0x6C, 0x75, 0xA7, 0xEF, 0x92, 0x85,
+    0x26, 0x5C, 0x4A, 0xBC, 0xE2, 0x4A, 0xC8, 0xE3, 0x4C, 0x82, 0xF7, 0xB0, 0xE2, 0xEB, 0x33, 0x25,
+    0x16, 0x01, 0x6D, 0x34, 0x78, 0x83, 0xF1, 0xBC, 0xF4, 0xD4, 0xE7, 0xCD, 0xA2, 0x1C, 0x93, 0x5B,
+    0x76, 0xDA, 0xA8, 0x60, 0xBF, 0x74, 0x45, 0x86, 0xAC, 0x07, 0x9F, 0x25, 0xFC, 0x5C, 0x36, 0x03,
+    0xA7, 0x66, 0xA3, 0xD9, 0x6D, 0x93, 0x37, 0x92, 0x53, 0x4C, 0xE1, 0x45, 0x19, 0x9F, 0x40, 0xBD,
+    0xCB, 0xDA, 0x95, 0x7E, 0x0D, 0x4F, 0x8F, 0x3E, 0x87, 0x84, 0x75, 0x7C, 0xA2, 0x6D, 0x71, 0x17,
+    0xDA, 0xAF, 0x2E, 0x0F, 0x3F, 0x94, 0x30, 0x85, 0x14, 0x93, 0x3C, 0x90, 0xBB, 0x93, 0xA8, 0x8C,
+    0xB3, 0x84, 0xA7, 0xFA, 0x95, 0xB8, 0xAB, 0x45, 0xE0, 0x81, 0x59, 0xE4, 0x23, 0xB8, 0x82, 0xD8,
+    0x87, 0xC1, 0xE0, 0x21, 0x96, 0xFE, 0x5C, 0xE2, 0xBA, 0x13, 0xF1, 0xE4, 0x6D, 0xE4, 0xDD, 0x0A,
+    0x01, 0x0F, 0xDF, 0xF9, 0x00, 0x0E, 0x44, 0x40, 0xF6, 0x10, 0x00, 0xC0, 0xEA, 0x20, 0x27, 0xA7,
+    0x9A, 0x71, 0x1A, 0xED, 0xDE, 0x11, 0xA2, 0xAB, 0xAF, 0x84, 0x6D, 0x87, 0x22, 0x6F, 0x9D, 0xEA,
+    0x4A, 0xD3, 0x33, 0xE1, 0x0F, 0x81, 0xDE, 0x0F, 0x97, 0x0F, 0xF0, 0x66, 0xE6, 0x43, 0xBE, 0x0E,
+    0xF5, 0x71, 0x15, 0x32, 0xD8, 0xD3, 0x37, 0xFB, 0x66, 0xA4, 0x8E, 0xEB, 0x71, 0x47, 0xE2, 0xDE,
+    0xAF, 0x4D, 0xED, 0xF4, 0xD0, 0x5F, 0x56, 0x6A, 0x4D, 0xC2, 0x73, 0xCF, 0xA0, 0x91, 0x6F, 0xF7,
+    0xC5, 0x6D, 0xF0, 0xD8, 0x48, 0x62, 0xD1, 0x00, 0x71, 0xD0, 0x22, 0x3B, 0x1C, 0x63, 0x01, 0x71,
+    0x6B, 0xB4, 0xA3, 0x24, 0xD2, 0x17, 0x5B, 0x34, 0xEF, 0xAB, 0xE5, 0xD1, 0x3B, 0xF4, 0x65, 0xA0,
+    0x77, 0xEB, 0x43, 0x30, 0xC1, 0x85, 0x8E, 0x17, 0xE2, 0xCB, 0xD3, 0x73, 0x1E, 0x27, 0xA8, 0x28,
+    0xA4, 0x85, 0x03, 0x79, 0x43, 0xC2, 0xD4, 0xAD, 0xA2, 0xF7, 0x60, 0x8A, 0x84, 0xB3, 0x8A, 0x74,
+    0x73, 0x2B, 0xDC, 0x96, 0xDB, 0x1A, 0x66, 0xE0, 0xEA, 0xA7, 0x7F, 0x77, 0x60, 0x2F, 0xE2, 0x0B,
+    0x1E, 0xF8, 0x45, 0xD3, 0x80, 0x4C, 0xF1, 0x6B, 0x5F, 0x3A, 0xA4, 0xCF, 0x77, 0x7A, 0x57, 0xF7,
+    0x16, 0xE7, 0x43, 0x6F, 0xC9, 0x67, 0x41, 0x87, 0x0D, 0xA3, 0x5E, 0xD2, 0xF6, 0x91, 0x9A, 0x91,
+    0x13, 0x94, 0xC6, 0x1D, 0x56, 0xC9, 0x9F, 0x0F, 0x6E, 0xDD, 0xBF, 0x59, 0xFF, 0xB3, 0x1C, 0x41,
+    0xC0, 0xAF, 0xA3, 0xD1, 0xB8, 0x91, 0xFD, 0x26, 0x8F, 0x94, 0xDD, 0x26, 0xEB, 0x8D, 0x6C, 0xEB,
+    0x6B, 0xBF, 0x4C, 0xBC, 0x19, 0x33, 0xDF, 0x86, 0x75, 0xC8, 0x71, 0x1D, 0xAC, 0x46, 0xAD, 0xB2,
+    0x26, 0xCB, 0xF1, 0x3D, 0xF2, 0x4A, 0xCF, 0xA9, 0x71, 0xF9, 0x37, 0xDC, 0xAE, 0x07, 0xAC, 0x47,
+    0x3C, 0x3D, 0xF3, 0x84, 0x91, 0x56, 0x31, 0xCC, 0xD4, 0x11, 0x7C, 0x76, 0x95, 0x39, 0xC3, 0xDC,
+    0x1C, 0x56, 0xA2, 0xB3, 0xEC, 0x5E, 0xC9, 0xFE, 0x68, 0xDD, 0xE2, 0xAF, 0xE4, 0x76, 0x6A, 0x37,
+    0xB7, 0x57, 0x44, 0xF0, 0x2B, 0xD1, 0xC2, 0x82, 0xD4, 0x6A, 0x34, 0xB7, 0x5B, 0x04, 0x36, 0xFE,
+    0x03, 0x43, 0x4F, 0xC5, 0x9F, 0x91, 0x10, 0x3D, 0xDC, 0x7C, 0xC8, 0x12, 0x06, 0xB3, 0xE1, 0xDA,
+    0x4A, 0xA4, 0xC7, 0x97, 0x28, 0xFD, 0xB9, 0x45, 0x27, 0x40, 0xC2, 0x7B, 0x76, 0x1E, 0x86, 0xEF,
+    0xC2, 0xAA, 0x9C, 0xC2, 0xD7, 0x47, 0xA7, 0x05, 0xE9, 0x18, 0xB2, 0xA6, 0x9D, 0x7E, 0x8C, 0x17,
+    0x68, 0x1C, 0x57, 0x9A, 0x59, 0x70, 0xAC, 0xBA, 0x0C, 0x05, 0x47, 0x4B, 0x71, 0x0B, 0x68, 0x7F,
+    0x89, 0xFA, 0x44, 0x2D, 0x90, 0xE6, 0x68, 0x52, 0x2B, 0xC8, 0x36, 0xFA, 0x3D, 0xAA, 0x10, 0x0D,
+    0x85, 0xB2, 0xC2, 0x0C, 0x7E, 0xB1, 0xB8, 0xFE, 0x71, 0x05, 0xC8, 0x9E, 0x36, 0xA1, 0xB4, 0xF8,
+    0x24, 0x05, 0x80, 0xC4, 0x89, 0x80, 0x61, 0x66, 0xEA, 0x42, 0x3B, 0xDD, 0x79, 0xC1, 0xCC, 0x71,
+    0xBF, 0x9A, 0xBC, 0xB2, 0x42, 0xA5, 0x85, 0x80, 0xD8, 0xE4, 0x62, 0x1D, 0xCA, 0x82, 0xC0, 0xBE,
+    0xC0, 0xF1, 0xA6, 0x29, 0x7F, 0xCE, 0x4E, 0x9A, 0x59, 0x74, 0xF4, 0x5C, 0xB8, 0x82, 0x66, 0xCC,
+    0xD6, 0xD6, 0xFC, 0x82, 0x4D, 0x5B, 0x99, 0x93, 0x63, 0x62, 0xA3, 0x5D, 0xE2, 0x84, 0xBD, 0xA5,
+    0xD9, 0x37, 0x08, 0x9E, 0xFB, 0xAD, 0x10, 0x9A, 0x2A, 0x23, 0x0B, 0xDA, 0x91, 0xCE, 0xCE, 0xE0,
+    0x49, 0xF5, 0xF6, 0xD7, 0x27, 0xF0, 0x6E, 0x67, 0x61, 0x69, 0xD4, 0x91, 0x41, 0xFC, 0x84, 0x6C,
+    0x7C, 0xB2, 0x1E, 0x32, 0x0F, 0xF2, 0xDA, 0xF8, 0xAF, 0xF9, 0xE8, 0xE4, 0xF3, 0x47, 0x2C, 0x4B,
+    0x62, 0x8D, 0xE4, 0xDD, 0xE7, 0x08, 0x90, 0xB1, 0xC3, 0xB5, 0x7E, 0x7A, 0xFB, 0x0F, 0xC4, 0xEF,
+    0x8F, 0x13, 0x90, 0x3C, 0xB9, 0x3C, 0x63, 0x36, 0x67, 0xEC, 0xF5, 0x27, 0xB0, 0x1A, 0x27, 0xB0,
+    0x03, 0xA3, 0x38, 0x61, 0xE3, 0xD0, 0x14, 0x70, 0xC8, 0x7F, 0xAE, 0xF8, 0x2D, 0xDC, 0xE5, 0x50,
+    0xA5, 0xD8, 0x13, 0x3E, 0xFC, 0xC8, 0xCC, 0x25, 0x8B, 0xC6, 0x12, 0x26, 0x90, 0x61, 0x4F, 0xCA,
+    0xD6, 0xD6, 0xFE, 0xBF, 0xE3, 0x77, 0xCD, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0x1D, 0xDB, 0xCA,
+    0x5A, 0x8A, 0xA5, 0xB8, 0x42, 0x42, 0x50, 0xB8, 0xDF, 0x22, 0x7E, 0x01, 0xA4, 0x71, 0xC4, 0x0B,
+    0x6C, 0x47, 0x41, 0x11, 0x1A, 0xEA, 0x7D, 0x04, 0x7F, 0xA2, 0xA5, 0x48, 0xDE, 0x80, 0x2D, 0x68,
+    0xD8, 0x02, 0xF1, 0x06, 0xB6, 0xF8, 0x8A, 0x2D, 0x63, 0x82, 0x44, 0x6D, 0x45, 0x91, 0x90, 0xA0,
+    0xC0, 0x51, 0x8C, 0x70, 0xB2, 0xB6, 0x0F, 0xE7, 0xDC, 0xB1, 0xBF, 0x5D, 0x85, 0x17, 0x60, 0x64,
+    0x79, 0xEE, 0xFC, 0x78, 0xE6, 0xDE, 0x73, 0xCF, 0xB9, 0x76, 0xEE, 0xAE, 0x65, 0x78, 0xB7, 0x59,
+    0x31, 0x80, 0xCD, 0xF4, 0x27, 0x33, 0xC1, 0xC9, 0x2C, 0x50, 0x5D, 0xAE, 0xC1, 0xC4, 0xE0, 0xCA,
+    0xD9, 0xAC, 0x94, 0x8B, 0x7E, 0x2C, 0x27, 0x97, 0xAD, 0x7C, 0xB9, 0x66, 0xA8, 0x07, 0x8E, 0xD1,
+    0xB9, 0x08, 0x2D, 0xBA, 0x08, 0x47, 0x54, 0x3C, 0x23, 0xC6, 0x21, 0x5B, 0x73, 0x7E, 0x91, 0xCF,
+    0x09, 0x9C, 0x1F, 0xFC, 0xA0, 0xAF, 0xB2, 0xC5, 0x71, 0x53, 0xCB, 0xE3, 0xBA, 0x62, 0xCA, 0x16,
+    0xAE, 0xB8, 0x6D, 0x35, 0x5F, 0xB4, 0xD5, 0x35, 0x1D, 0x0E, 0x7E, 0xE4, 0xD6, 0xC1, 0xE1, 0xDB,
+    0xC5, 0x35, 0xBD, 0x4E, 0x8D, 0xE1, 0x07, 0x76, 0x2E, 0x5F, 0x5D, 0xBA, 0xE0, 0x90, 0xE0, 0xE0,
+    0x78, 0x67, 0x7E, 0x3B, 0x33, 0x94, 0x2E, 0xE3, 0xA8, 0xA4, 0x77, 0x39, 0xBD, 0x9E, 0x15, 0x47,
+    0x65, 0x66, 0x47, 0xCF, 0x74, 0x3B, 0xC0, 0x83, 0x23, 0xF4, 0xCE, 0x9D, 0x81, 0x4B, 0xBC, 0x8E,
+    0x2F, 0xF7, 0x91, 0x02, 0xC9, 0xE7, 0x13, 0x24, 0x75, 0xBF, 0x5B, 0x09, 0xEE, 0x26, 0xA7, 0xDD,
+    0x82, 0x5C, 0xDE, 0x96, 0x97, 0x7D, 0x32, 0xD7, 0x1D, 0xA1, 0x95, 0xB6, 0x33, 0xFA, 0x7A, 0x1B,
+    0x46, 0x50, 0xF0, 0xFC, 0xAC, 0x2D, 0xE9, 0x08, 0xAF, 0xC9, 0x56, 0x21, 0xDD, 0x31, 0x30, 0x06,
+    0x8A, 0x2F, 0xD0, 0xF2, 0x3E, 0xB4, 0xCD, 0x40, 0x67, 0xD0, 0x1A, 0x0C, 0x29, 0x01, 0xAB, 0xB8,
+    0x38, 0x0B, 0xAF, 0xD5, 0xE1, 0x20, 0x50, 0x39, 0xCC, 0x96, 0x88, 0xF1, 0xA1, 0x2D, 0x46, 0x3F,
+    0xA4, 0xAB, 0x81, 0xD5, 0xE3, 0x50, 0xCC, 0x86, 0xD5, 0xCD, 0x2C, 0x9C, 0x04, 0x15, 0x77, 0xA3,
+    0x23, 0xE4, 0xC9, 0x8A, 0x2A, 0x46, 0x4B, 0x30, 0x53, 0x82, 0x91, 0xE0, 0x0F, 0x03, 0xA6, 0xE7,
+    0x48, 0x29, 0x2D, 0x19, 0x3B, 0x2D, 0x65, 0x62, 0x56, 0xF2, 0x95, 0x5A, 0x21, 0x63, 0x70, 0xDC,
+    0x05, 0x5E, 0x9C, 0x70, 0x39, 0x45, 0x98, 0xEF, 0x8B, 0x25, 0xC6, 0xCD, 0x6A, 0xE8, 0xD7, 0x46,
+    0xA2, 0x1D, 0xA7, 0x6C, 0xE3, 0x4A, 0xF4, 0x3A, 0xA0, 0xA0, 0xF7, 0xA7, 0x76, 0x4B, 0x0D, 0x6D,
+    0xE2, 0x9B, 0x40, 0xD6, 0x96, 0x28, 0x8F, 0xE6, 0x2F, 0xB4, 0x7E, 0xCD, 0x3A, 0x8C, 0xCC, 0x2B,
+    0x6F, 0xC8, 0xA0, 0x6F, 0x8E, 0x3A, 0xD6, 0xE8, 0xC4, 0x74, 0x8B, 0x09, 0x31, 0x5E, 0xC8, 0x9F,
+    0xE6, 0xAD, 0x8E, 0x2B, 0x67, 0x65, 0x22, 0x43, 0x58, 0x78, 0x66, 0x01, 0xBC, 0xD2, 0x54, 0x3D,
+    0x2A, 0x5B, 0x7E, 0xCE, 0xF1, 0xE4, 0xAA, 0x5C, 0x23, 0xBC, 0x47, 0x0D, 0x3A, 0xCB, 0x56, 0xC5,
+    0xF6, 0x26, 0x97, 0x8D, 0xD5, 0x97, 0x81, 0xFC, 0xB5, 0x25, 0x34, 0xEB, 0xDC, 0x07, 0x2D, 0xD7,
+    0x7C, 0x3E, 0x99, 0xCB, 0xA3, 0x12, 0x89, 0x36, 0x32, 0x7F, 0x75, 0x48, 0xDB, 0xBC, 0x99, 0xFD,
+    0xC8, 0xBB, 0x33, 0x88, 0x3B, 0xB8, 0x91, 0x12, 0xDE, 0xD0, 0xE1, 0x7C, 0x66, 0x42, 0x13, 0x08,
+    0x38, 0x06, 0x20, 0xF6, 0xA2, 0xBB, 0x28, 0xA7, 0x62, 0xAE, 0x9F, 0x2E, 0x92, 0xD3, 0x1A, 0xE4,
+    0x15, 0xCB, 0xE2, 0xC7, 0x3A, 0xBE, 0xD4, 0xD5, 0x71, 0xA0, 0xDD, 0x27, 0xCF, 0x77, 0x94, 0xFB,
+    0x5D, 0x96, 0xEF, 0x77, 0x51, 0x0E, 0xC6, 0xBA, 0x31, 0x0B, 0x09, 0x38, 0x2F, 0x9F, 0x5C, 0x04,
+    0xA8, 0xF7, 0x1C, 0xD5, 0x7B, 0x08, 0xCB, 0xFD, 0x08, 0x24, 0xD3, 0x9D, 0xD2, 0x5F, 0x6D, 0xAA,
+    0x7D, 0xEE, 0xCA, 0xD5, 0xD4, 0x4D, 0x56, 0x2E, 0x0A, 0x6D, 0x8E, 0x95, 0x15, 0xDE, 0x51, 0x51,
+    0x25, 0xD4, 0x51, 0xF5, 0x93, 0xBB, 0x2A, 0xB0, 0x25, 0xDD, 0x8F, 0x81, 0x06, 0x31, 0xBE, 0x31,
+    0xC5, 0x30, 0x46, 0x3F, 0x04, 0x52, 0x1C, 0x83, 0x2F, 0xA7, 0x89, 0xE6, 0xD7, 0x30, 0x91, 0x2D,
+    0x9C, 0x38, 0xFB, 0x61, 0x9B, 0x20, 0x22, 0xB6, 0x23, 0x95, 0x10, 0x7E, 0xE6, 0x19, 0x36, 0x51,
+    0x4C, 0x9A, 0x20, 0xA7, 0x79, 0x0B, 0x27, 0xFC, 0x48, 0x66, 0x91, 0x36, 0x0C, 0xAF, 0xA6, 0x46,
+    0xA6, 0x14, 0xBD, 0xA5, 0x4B, 0x88, 0xE7, 0xC1, 0x10, 0xE7, 0xF0, 0xD4, 0x14, 0x58, 0xE3, 0x50,
+    0x9A, 0x77, 0x0F, 0xEC, 0x91, 0x71, 0x71, 0x5F, 0x8A, 0x19, 0xF0, 0x7A, 0x2B, 0x60, 0x86, 0x48,
+    0x6A, 0xB2, 0x3D, 0x7F, 0x7C, 0x76, 0x65, 0xD4, 0x0D, 0xDE, 0xA6, 0x1B, 0x50, 0xBE, 0xBA, 0x0F,
+    0x57, 0x11, 0xBA, 0x87, 0x36, 0xF9, 0xE0, 0x7B, 0x3D, 0xBC, 0xB7, 0x2F, 0x88, 0xBF, 0x97, 0x5B,
+    0xA8, 0x4A, 0x23, 0xC1, 0x50, 0xE0, 0x47, 0xF7, 0xE8, 0x72, 0xB5, 0x7C, 0x84, 0x5A, 0x67, 0x74,
+    0x6D, 0x8D, 0xFE, 0xF5, 0x60, 0xB3, 0xDF, 0xCD, 0xEE, 0xFC, 0xCA, 0xD5, 0xBF, 0x43, 0x2A, 0x2D,
+    0xDE, 0xA1, 0x4D, 0x14, 0xA4, 0x74, 0xCA, 0x52, 0xF6, 0x6C, 0x31, 0xC5, 0xBE, 0x54, 0x1A, 0x54,
+    0x3C, 0x2D, 0xC8, 0x89, 0xAE, 0xDF, 0x2A, 0xE8, 0x06, 0x53, 0xCD, 0x2E, 0xC5, 0x68, 0xB2, 0x8A,
+    0x2A, 0x3D, 0x77, 0xCD, 0x23, 0x88, 0x6D, 0xEF, 0x8B, 0x2F, 0x7F, 0xB3, 0xA8, 0x1E, 0x25, 0x87,
+    0xDE, 0xFD, 0xA7, 0x85, 0xE2, 0x40, 0x72, 0x6E, 0xBD, 0xC6, 0xE3, 0xFD, 0x9E, 0xF5, 0x68, 0xA2,
+    0xDC, 0xD9, 0x97, 0xD6, 0xEB, 0xE5, 0x8A, 0x89, 0x85, 0x9E, 0xBD, 0xF8, 0xAB, 0x42, 0x51, 0x8E,
+    0x8C, 0xC2, 0x2F, 0xCA, 0xD5, 0xC2, 0x2C, 0xF1, 0x28, 0x26, 0x0C, 0xAA, 0xDA, 0xFC, 0x13, 0xB0,
+    0xAF, 0xFB, 0x04, 0x64, 0x53, 0xD5, 0xB0, 0x00, 0x7D, 0xCE, 0xCA, 0x27, 0xC5, 0x1C, 0x17, 0x2B,
+    0xF3, 0xB8, 0x99, 0xF1, 0x0B, 0xF5, 0xD1, 0xFC, 0x39, 0xD5, 0xAF, 0xA4, 0x8B, 0xDB, 0xD1, 0xFF,
+    0xB3, 0x0A, 0x59, 0xE2, 0xB8, 0x18, 0xE1, 0x73, 0x15, 0x6D, 0x96, 0xF1, 0x54, 0x85, 0x25, 0x11,
+    0x54, 0xBD, 0x48, 0xD7, 0xAA, 0xDE, 0xBB, 0xE8, 0xFA, 0xFA, 0xFA, 0x60, 0xB5, 0xC6, 0x74, 0x50,
+    0x84, 0xA8, 0x93, 0x6E, 0xFC, 0xCC, 0x88, 0xFD, 0xF1, 0xD9, 0x87, 0x11, 0x47, 0xFA, 0x3B, 0x04,
+    0x39, 0xEA, 0xA8, 0xDC, 0x0A, 0xA4, 0x08, 0x9B, 0x0B, 0x75, 0xC1, 0x5F, 0x31, 0xBC, 0x91, 0x3E,
+    0xA7, 0x2B, 0x79, 0x58, 0x50, 0x02, 0xAA, 0xC0, 0x8C, 0xA3, 0xF5, 0xAC, 0xC6, 0x9D, 0xEF, 0xD3,
+    0x85, 0xC0, 0x17, 0x23, 0x2B, 0x30, 0x40, 0x91, 0x95, 0x03, 0x70, 0xD4, 0x6F, 0xA7, 0x7E, 0xF1,
+    0x37, 0x03, 0x40, 0xF3, 0x72, 0xA5, 0x63, 0xA4, 0x85, 0x27, 0xE5, 0x12, 0x50, 0x97, 0x74, 0xB7,
+    0x9E, 0xF5, 0x7B, 0x24, 0xFF, 0x89, 0x9D, 0xFB, 0x7F, 0xB6, 0x7F, 0x01, 0x9D, 0x55, 0xBF, 0x8F,
+    0xDC, 0x44, 0x14, 0x7E, 0x63, 0xDF, 0xDD, 0x16, 0x2E, 0x9C, 0x0A, 0x22, 0x82, 0xE2, 0x2B, 0x11,
+    0xCD, 0xB6, 0x14, 0x44, 0xB3, 0x88, 0x82, 0x36, 0x45, 0xB6, 0x81, 0x22, 0x55, 0x8A, 0x08, 0x89,
+    0xF0, 0x07, 0x00, 0x63, 0x29, 0xFF, 0xC0, 0x76, 0x48, 0xD4, 0x29, 0x8E, 0xA4, 0xA0, 0xA1, 0x41,
+    0x3A, 0xC9, 0x4B, 0x45, 0x91, 0x22, 0x16, 0x08, 0x28, 0xCF, 0x90, 0x93, 0x50, 0x14, 0x21, 0x19,
+    0x61, 0x09, 0x5F, 0x6E, 0xEC, 0xC7, 0xF7, 0xCD, 0xAC, 0x93, 0xDB, 0x4B, 0x84, 0x48, 0x46, 0xDA,
+    0xE7, 0xD9, 0xF9, 0xDE, 0x7C, 0xEF, 0xD7, 0xCC, 0x1B, 0x91, 0x30, 0x2E, 0xE9, 0xB1, 0x48, 0xA5,
+    0xDA, 0x8A, 0xAA, 0x7A, 0x8A, 0x51, 0x74, 0x10, 0x27, 0x55, 0x2F, 0xB2, 0xB0, 0x10, 0x52, 0x78,
+    0x88, 0x6C, 0x84, 0x48, 0x75, 0x01, 0xA9, 0x6B, 0x08, 0xDB, 0x42, 0xE4, 0x3E, 0x2C, 0x92, 0x47,
+    0x6B, 0x2E, 0x52, 0x3D, 0x3B, 0xF3, 0x9F, 0xF8, 0x4C, 0x1B, 0xB9, 0x40, 0x13, 0x1E, 0x90, 0x02,
+    0x74, 0x0A, 0x06, 0x43, 0x93, 0x22, 0xD7, 0xCF, 0x30, 0xBC, 0x90, 0x76, 0x5A, 0x34, 0x37, 0xE8,
+    0x66, 0x9F, 0x82, 0x26, 0x57, 0xED, 0x0B, 0xFD, 0xAA, 0x03, 0xFB, 0x05, 0x42, 0x8E, 0xBF, 0xE6,
+    0xDC, 0x0F, 0x6B, 0xB6, 0x13, 0x99, 0x0F, 0xA0, 0xD3, 0xC7, 0xED, 0x0C, 0xE6, 0x82, 0xC9, 0xB9,
+    0x6E, 0x76, 0xD8, 0xFF, 0xF8, 0xC9, 0x45, 0x3A, 0xD0, 0xC8, 0x8E, 0x1C, 0x8A, 0xE9, 0xF2, 0x52,
+    0xE6, 0x0F, 0xB9, 0x0B, 0x5C, 0xE2, 0x10, 0x97, 0xA1, 0x57, 0xB6, 0x2A, 0x25, 0xFB, 0x7E, 0xB8,
+    0x28, 0xBD, 0xB9, 0xDD, 0x59, 0x58, 0x3A, 0x05, 0x32, 0xF7, 0x1B, 0x95, 0x94, 0xF1, 0x1F, 0x42,
+    0xA5, 0x28, 0x7B, 0x49, 0x5B, 0x23, 0xF2, 0x39, 0x90, 0x64, 0x2D, 0x67, 0x87, 0x7F, 0xFB, 0x6E,
+    0x75, 0x1F, 0x01, 0x21, 0x37, 0x1F, 0xC0, 0xE7, 0x9D, 0xB0, 0x78, 0x15, 0xF4, 0xDD, 0x6B, 0xAA,
+    0x3F, 0xA8, 0x0E, 0x6E, 0xC8, 0x1F, 0xDE, 0x91, 0x2F, 0x76, 0xDF, 0x1F, 0xDC, 0x1F, 0x9D, 0x4D,
+    0x86, 0x59, 0x23, 0xBB, 0xA9, 0x77, 0xBF, 0x8D, 0xD9, 0x8F, 0x1E, 0x7C, 0xE6, 0x1A, 0x74, 0x4F,
+    0xC4, 0xEA, 0xF8, 0x25, 0x95, 0x13, 0xFD, 0x65, 0x25, 0x37, 0xB7, 0x2C, 0x64, 0xFD, 0x66, 0x92,
+    0x84, 0x6C, 0x73, 0xBC, 0x33, 0x2B, 0xE3, 0x24, 0x95, 0xB7, 0xB6, 0x74, 0x65, 0x97, 0xC5, 0x95,
+    0x25, 0x2B, 0xB6, 0xD8, 0x14, 0xEF, 0xC9, 0x21, 0x49, 0x1E, 0x37, 0xF2, 0xA6, 0xC0, 0x41, 0x69,
+    0x32, 0x9C, 0x09, 0xBA, 0xB9, 0x83, 0x8A, 0xBE, 0xE4, 0xB8, 0xD4, 0x85, 0x8F, 0x19, 0x43, 0x6A,
+    0x30, 0x2A, 0xFF, 0x6D, 0x11, 0x26, 0xF9, 0x7B, 0x7F, 0xCA, 0xA7, 0x61, 0x56, 0x67, 0xF2, 0xCA,
+    0x23, 0xD4, 0x2D, 0xD1, 0x12, 0xE5, 0x66, 0x96, 0xDD, 0x28, 0xA6, 0xBE, 0x4C, 0x76, 0x69, 0x51,
+    0xCE, 0x15, 0x66, 0xAB, 0x64, 0x7B, 0xC7, 0xDE, 0xF1, 0x66, 0x62, 0x9E, 0x26, 0xE7, 0xCA, 0x47,
+    0x53, 0x72, 0x16, 0xEF, 0x3E, 0x67, 0xC1, 0x2C, 0xA6, 0xD9, 0x53, 0x6C, 0xCA, 0xA5, 0xC8, 0x94,
+    0x68, 0x29, 0xA2, 0xD6, 0xBE, 0x24, 0x91, 0x34, 0x2B, 0xC5, 0x46, 0xE4, 0x33, 0x49, 0x56, 0x62,
+    0x90, 0xD1, 0xB4, 0x0D, 0x46, 0xCB, 0x8D, 0x72, 0xF0, 0x37, 0xDC, 0xB1, 0x66, 0xA2, 0xDC, 0x97,
+    0x49, 0xFC, 0xDF, 0x31, 0xBB, 0x13, 0xBF, 0xDF, 0xC5, 0x63, 0x1A, 0x2E, 0x6C, 0xD5, 0x84, 0x19,
+    0x16, 0x3E, 0x89, 0xE0, 0x1B, 0xF5, 0xAB, 0xE5, 0x96, 0x2E, 0x19, 0x8A, 0x2B, 0xA1, 0x70, 0xB2,
+    0x09, 0x81, 0x17, 0x2D, 0x84, 0x30, 0x6F, 0x64, 0xAF, 0x64, 0x08, 0xB8, 0x33, 0xF8, 0xA4, 0xD1,
+    0x0C, 0xEE, 0xCD, 0xE5, 0x98, 0xB8, 0x2E, 0x52, 0x40, 0x71, 0x62, 0x4C, 0x9A, 0xE7, 0x72, 0x19,
+    0xD3, 0x9B, 0x1C, 0xC8, 0x1E, 0x42, 0xC9, 0x3B, 0xB1, 0x35, 0x8B, 0x9A, 0xB0, 0x0D, 0xB8, 0x27,
+    0xEC, 0x46, 0xEC, 0x21, 0xA4, 0x71, 0x1A, 0x8E, 0x92, 0xB9, 0xFA, 0xCC, 0x41, 0x1C, 0xD8, 0x44,
+    0xEB, 0x14, 0x3D, 0xAA, 0xD0, 0x45, 0x0E, 0x5D, 0xB4, 0x30, 0xDB, 0xA0, 0xDF, 0x74, 0x82, 0x2D,
+    0x36, 0x40, 0x68, 0x1D, 0x84, 0x8A, 0xD3, 0x00, 0xE9, 0x03, 0x42, 0xD9, 0x60, 0x09, 0xB9, 0x96,
+    0x50, 0xAA, 0x29, 0xA1, 0xA2, 0xCF, 0x09, 0xE9, 0x9A, 0x50, 0x36, 0x08, 0x21, 0xD7, 0x12, 0xFA,
+    0x49, 0xE9, 0x97, 0xDE, 0xEA, 0x85, 0x10, 0xCA, 0x06, 0x08, 0x86, 0x08, 0xE1, 0x04, 0xE5, 0x27,
+    0x4B, 0x76, 0x37, 0xAB, 0xA7, 0x4A, 0x07, 0xF4, 0x08, 0x0A, 0xB0, 0x69, 0x43, 0x07, 0xF2, 0xF1,
+    0x8C, 0x36, 0x93, 0xB7, 0x2C, 0x90, 0x7F, 0x76, 0x6E, 0xC3, 0xC1, 0x65, 0xCA, 0x62, 0xED, 0xDC,
+    0x74, 0x1E, 0xE1, 0x1B, 0xD5, 0xAA, 0x75, 0x08, 0xAD, 0x67, 0x4F, 0x4C, 0x34, 0x64, 0x61, 0xAE,
+    0x81, 0xE5, 0xE3, 0x47, 0xE7, 0x4A, 0x55, 0x74, 0xB0, 0xB6, 0x98, 0x0D, 0x88, 0xBD, 0x36, 0x98,
+    0x20, 0x03, 0xAE, 0x4E, 0xE1, 0x65, 0xD1, 0x61, 0x27, 0x00, 0x74, 0x41, 0x02, 0x7A, 0x44, 0xA0,
+    0xFA, 0x95, 0x80, 0xFB, 0x8B, 0x80, 0x6D, 0x1D, 0x80, 0x79, 0x07, 0x06, 0x77, 0xE4, 0xC1, 0x50,
+    0xA8, 0x0F, 0x0C, 0xC8, 0x0F, 0x00, 0x95, 0x62, 0x3C, 0x70, 0x8A, 0xE6, 0xA0, 0x85, 0x96, 0x86,
+    0x0D, 0x6A, 0x8D, 0x52, 0x84, 0x88, 0xF2, 0x50, 0x90, 0xD4, 0xC7, 0xCB, 0x14, 0x63, 0x0C, 0xF1,
+    0xD8, 0x70, 0x12, 0x8A, 0x10, 0xCE, 0xDE, 0x41, 0xEC, 0xE9, 0x41, 0xBC, 0xAE, 0xCB, 0x05, 0x52,
+    0x05, 0x8A, 0x2D, 0x51, 0x9E, 0x51, 0x49, 0xF5, 0xEE, 0x8A, 0x09, 0x0C, 0x95, 0xD3, 0x86, 0xA2,
+    0x4B, 0xF5, 0x43, 0xF5, 0x40, 0x8B, 0x01, 0x22, 0x43, 0x2B, 0x81, 0x3B, 0x14, 0x9C, 0xE5, 0x10,
+    0xA6, 0xF2, 0xD4, 0xE3, 0x33, 0xA1, 0x2D, 0x45, 0x09, 0x71, 0xCC, 0x46, 0x89, 0x1B, 0x32, 0x6E,
+    0x89, 0x6F, 0x48, 0x4F, 0xE2, 0x28, 0xEE, 0xF1, 0xEF, 0x39, 0x95, 0x17, 0x0A, 0x38, 0x84, 0x9C,
+    0x60, 0x0B, 0x45, 0x3F, 0x1B, 0x97, 0xCE, 0x03, 0xC8, 0x29, 0xB2, 0x21, 0xCE, 0x74, 0x59, 0x79,
+    0xA2, 0x1D, 0x45, 0x0D, 0x71, 0x02, 0x1B, 0x8F, 0x18, 0x5F, 0x87, 0xB7, 0x4B, 0x6F, 0x13, 0xD2,
+    0x9F, 0x6F, 0xA9, 0xC5, 0x93, 0xF4, 0xC0, 0x8B, 0xFD, 0x07, 0xB1, 0x0C, 0xBA, 0xFE, 0x5D, 0x5D,
+    0x3B, 0x60, 0xC1, 0xEA, 0xDF, 0x7A, 0x4F, 0x7B, 0xBE, 0xC7, 0x36, 0x3E, 0x77, 0x88, 0xEC, 0xEB,
+    0xEB, 0xB5, 0xAE, 0x93, 0x0E, 0xA7, 0x65, 0x9F, 0xCF, 0x63, 0xC8, 0x50, 0x78, 0x86, 0xDA, 0xF8,
+    0x5E, 0xC6, 0xE7, 0xF2, 0x25, 0xC6, 0xBF, 0xA5, 0x55, 0xB1, 0x8E, 0x1C, 0x45, 0x10, 0xED, 0x99,
+    0x95, 0x19, 0xE1, 0x09, 0x26, 0x42, 0x08, 0x24, 0x34, 0x31, 0xD1, 0xFC, 0x81, 0x7B, 0x01, 0x41,
+    0x42, 0xC0, 0x05, 0xB7, 0x58, 0xC2, 0x1F, 0x71, 0x11, 0xF1, 0x8C, 0x9C, 0x38, 0x34, 0x7F, 0x40,
+    0x42, 0xC0, 0x5D, 0x72, 0x5F, 0x80, 0x7A, 0xE0, 0x02, 0x07, 0x0E, 0x3C, 0xE6, 0x64, 0x39, 0x70,
+    0xE0, 0xB5, 0x10, 0x72, 0x40, 0x70, 0xC3, 0x79, 0xCE, 0x37, 0xD2, 0xF5, 0xF4, 0xE3, 0xBD, 0x9E,
+    0x5D, 0x7C, 0x70, 0x46, 0x60, 0xB1, 0x52, 0xD7, 0xD6, 0x56, 0x57, 0x75, 0x55, 0xBD, 0x7E, 0xD5,
+    0x6B, 0xCC, 0x7B, 0xCB, 0xCC, 0x57, 0x58, 0xD6, 0x0F, 0x30, 0x65, 0x00, 0xFA, 0x1A, 0xB7, 0x70,
+    0x07, 0x4D, 0xE5, 0xEB, 0xDE, 0xE0, 0x71, 0x30, 0xF9, 0x54, 0xAF, 0x8D, 0x7B, 0x1E, 0x4C, 0x16,
+    0xA8, 0xD4, 0xCF, 0x43, 0x7A, 0x3F, 0xD4, 0x3D, 0xF0, 0x18, 0x39, 0x7C, 0xED, 0x2D, 0xEE, 0x31,
+    0x6A, 0xA8, 0x29, 0xB2, 0x09, 0xE8, 0xEA, 0x9F, 0xA9, 0x84, 0xE4, 0xE6, 0x40, 0xE7, 0x0F, 0xB2,
+    0x60, 0x8C, 0xA1, 0x62, 0xAE, 0x2A, 0xFA, 0x60, 0x69, 0x8C, 0xA5, 0x5E, 0x8C, 0xC6, 0x2C, 0xB4,
+    0x81, 0xBB, 0x3C, 0xE6, 0x17, 0xAE, 0x91, 0x2B, 0x58, 0x8A, 0xBB, 0xD3, 0x6A, 0xF5, 0x09, 0xB4,
+    0xD5, 0xD2, 0xB7, 0xA7, 0xAF, 0xA7, 0xEF, 0xFF, 0x34, 0xCC, 0x9F, 0x94, 0xA6, 0xAA, 0x7F, 0xF5,
+    0xC5, 0x16, 0xCE, 0x99, 0x31, 0x7E, 0x1D, 0xEC, 0xB3, 0x46, 0xD5, 0xFA, 0xDF, 0xBF, 0x16, 0x02,
+    0x4F, 0x25, 0x5F, 0x52, 0x56, 0xAB, 0x1D, 0xE5, 0x8B, 0xC9, 0xFF, 0xA2, 0x70, 0x7B, 0x90, 0x5F,
+    0x43, 0x65, 0x8C, 0xCA, 0xBB, 0x58, 0xED, 0x98, 0xD7, 0x3B, 0x5F, 0x55, 0xF4, 0xC9, 0x89, 0xD0,
+    0xA5, 0x35, 0xE5, 0x13, 0x6D, 0x9B, 0x75, 0x18, 0x0E, 0x96, 0x3A, 0x74, 0xBB, 0x8A, 0x4B, 0x7B,
+    0x7F, 0x5F, 0xDC, 0xF7, 0x57, 0xC4, 0xA3, 0xD5, 0x6E, 0x44, 0xEB, 0xF5, 0xE2, 0xC7, 0xDD, 0x18,
+    0xB6, 0x96, 0x08, 0x12, 0x31, 0x0B, 0xD6, 0x78, 0x74, 0x0B, 0x03, 0x5D, 0x9C, 0xA7, 0x28, 0x25,
+    0x8A, 0x89, 0x22, 0x0B, 0x14, 0x8B, 0x28, 0xB0, 0x15, 0x91, 0x07, 0xB9, 0x84, 0x6A, 0x33, 0x95,
+    0x37, 0x6F, 0x27, 0x18, 0x4D, 0x49, 0xE8, 0x24, 0x3A, 0x89, 0xA5, 0x29, 0x68, 0x32, 0xE6, 0x9D,
+    0xB9, 0x61, 0x5A, 0xBC, 0x18, 0x9A, 0x70, 0xB5, 0xBC, 0xA5, 0x75, 0x39, 0xCE, 0x7C, 0x4A, 0xD0,
+    0xF0, 0x16, 0x7E, 0xDD, 0x89, 0x81, 0xF4, 0x08, 0xF2, 0x58, 0xD3, 0x23, 0x94, 0x63, 0x86, 0x7B,
+    0xC1, 0xD8, 0x33, 0x34, 0x91, 0xBD, 0x78, 0x3A, 0x1A, 0x7B, 0x1E, 0xFE, 0x64, 0x44, 0x8C, 0x44,
+    0xF7, 0xD6, 0x47, 0xE8, 0x19, 0x33, 0x9A, 0x9A, 0xBD, 0x97, 0x5C, 0x29, 0x86, 0x98, 0x92, 0xE4,
+    0x24, 0x35, 0xCA, 0x31, 0x45, 0x43, 0x9A, 0x30, 0x82, 0x81, 0x34, 0xB0, 0x3C, 0xDB, 0xD3, 0xC0,
+    0x02, 0xB8, 0x53, 0xF5, 0x3A, 0xAA, 0xF0, 0x34, 0x70, 0x83, 0x3B, 0x55, 0xAF, 0xCA, 0x12, 0xDC,
+    0x46, 0xBC, 0xB0, 0xDC, 0x57, 0x7D, 0xC4, 0xCD, 0x9E, 0xA2, 0xD4, 0xB9, 0x09, 0x0E, 0x5F, 0x60,
+    0x73, 0x85, 0x71, 0xC3, 0xE0, 0xE4, 0x22, 0xC4, 0x7C, 0x2F, 0x61, 0xE5, 0x91, 0x85, 0x4D, 0x08,
+    0x7E, 0x42, 0x04, 0xC9, 0x0E, 0x55, 0xAF, 0x9D, 0x3C, 0xA4, 0xEC, 0xBF, 0xD5, 0x45, 0x54, 0xBD,
+    0x76, 0xEC, 0xC0, 0xB4, 0xF6, 0x6C, 0x97, 0x7A, 0xA5, 0x1E, 0x9E, 0xA1, 0xA5, 0x21, 0xE7, 0xF0,
+    0x0C, 0xAA, 0xD4, 0xE2, 0xB7, 0x20, 0x86, 0x27, 0x08, 0x1B, 0xD6, 0xDB, 0xCD, 0xEC, 0x2D, 0xDE,
+    0xDC, 0x10, 0xEF, 0x2A, 0xB6, 0xCF, 0xBE, 0x2A, 0x02, 0xD0, 0x24, 0x2A, 0x23, 0x63, 0x2F, 0x6E,
+    0x5D, 0xF5, 0x02, 0x75, 0x5B, 0x67, 0xC1, 0x9E, 0x9D, 0xC6, 0x1D, 0xD5, 0xEF, 0xC2, 0x38, 0xC5,
+    0xDE, 0xDC, 0x32, 0x3B, 0x9E, 0xE2, 0xEC, 0x1D, 0x9E, 0xEB, 0x37, 0xF7, 0x4F, 0xD5, 0x4E, 0x31,
+    0xB1, 0x61, 0xFA, 0xDB, 0x71, 0x8E, 0x77, 0x02, 0xD1, 0x9B, 0x78, 0x3E, 0x9B, 0x59, 0x60, 0x29,
+    0x94, 0x51, 0x84, 0x98, 0x1F, 0x55, 0xBC, 0x86, 0x1A, 0xAF, 0x06, 0xF9, 0x4D, 0xBE, 0x93, 0xFD,
+    0x28, 0x1D, 0xBE, 0xD9, 0xD2, 0x29, 0x8E, 0x6B, 0x4E, 0xEE, 0xE8, 0x81, 0x18, 0xE6, 0xB9, 0x48,
+    0x23, 0x3F, 0xDA, 0x6B, 0x5F, 0xA2, 0xE5, 0x3D, 0x11, 0x55, 0xF2, 0xD1, 0xB1, 0xF8, 0xF7, 0x9D,
+    0x0A, 0xAD, 0xA2, 0xC7, 0xA5, 0x07, 0x26, 0xC7, 0xD7, 0x5C, 0xDF, 0xF2, 0x1C, 0xBD, 0x87, 0x0F,
+    0xB9, 0xBA, 0x48, 0xE1, 0xE4, 0x07, 0xE1, 0x46, 0x5E, 0x18, 0x2F, 0x28, 0x69, 0xD8, 0xE3, 0x0F,
+    0xF1, 0xCB, 0x92, 0x24, 0xD7, 0xBF, 0xA3, 0xF1, 0xAB, 0x1D, 0xD6, 0xE2, 0x35, 0xC3, 0x05, 0x29,
+    0x7E, 0x63, 0x59, 0x0B, 0x80, 0x6E, 0x7E, 0x98, 0xF4, 0x38, 0x34, 0x05, 0xDD, 0x2D, 0x53, 0xAF,
+    0xF6, 0x78, 0x86, 0xB8, 0xC5, 0x1A, 0x53, 0x9C, 0x1C, 0xB8, 0xE0, 0x80, 0x53, 0xA6, 0xFA, 0x4C,
+    0xC3, 0x98, 0xE9, 0x85, 0xE0, 0xCA, 0x59, 0x5E, 0xD9, 0x9A, 0x6B, 0x0C, 0xAF, 0x23, 0x84, 0x26,
+    0xFD, 0x3E, 0x4E, 0x6E, 0x35, 0xB2, 0x50, 0xDE, 0x16, 0x55, 0xB4, 0x54, 0x79, 0x0A, 0x7B, 0xD3,
+    0x34, 0x24, 0xD1, 0xC4, 0x56, 0x0A, 0xAF, 0x71, 0x24, 0xEB, 0x1A, 0xAA, 0xFC, 0x03, 0x30, 0x78,
+    0xC0, 0x94, 0x85, 0x1A, 0x21, 0x49, 0xA5, 0x7A, 0x75, 0x8F, 0x23, 0x0D, 0xA7, 0xE7, 0x0D, 0x31,
+    0xCC, 0x29, 0x6C, 0xC1, 0x08, 0xB4, 0xE5, 0x24, 0x2C, 0xDC, 0xD9, 0x2E, 0x5A, 0xD6, 0x4D, 0xFF,
+    0x02, 0x1A, 0xFB, 0x5A, 0x6A, 0x3A, 0x53, 0x30, 0xBE, 0xFD, 0xD9, 0xBF, 0xA9, 0x11, 0x00, 0x74,
+    0x8E, 0x4C, 0x6B, 0x5C, 0xC7, 0x1A, 0x5D, 0xC7, 0x64, 0xAE, 0x63, 0x49, 0xAE, 0xE3, 0x94, 0xB9,
+    0x63, 0xDD, 0xC6, 0x13, 0x06, 0x10, 0x39, 0x8A, 0x13, 0x69, 0xD1, 0xF6, 0x50, 0xBB, 0x9D, 0x93,
+    0x9F, 0x55, 0x44, 0x81, 0x49, 0xA7, 0x04, 0xD7, 0x25, 0x12, 0xC6, 0x85, 0x2D, 0xB5, 0xFF, 0x51,
+    0xA4, 0xFB, 0x64, 0x7C, 0x31, 0xB1, 0x93, 0x9C, 0x13, 0x7C, 0x5D, 0x88, 0x1D, 0xB1, 0x61, 0xDB,
+    0x9F, 0xF3, 0x2A, 0xF8, 0x87, 0xC7, 0xDE, 0x0A, 0x01, 0x76, 0x14, 0xDF, 0x01, 0xE2, 0x11, 0xA1,
+    0x5A, 0x40, 0x54, 0xD0, 0x2B, 0x62, 0xEC, 0x05, 0x36, 0x48, 0x2D, 0x50, 0x4E, 0x11, 0xAE, 0x56,
+    0x9E, 0xC4, 0x83, 0xE1, 0x0D, 0xC3, 0x1D, 0xA1, 0x3F, 0xBA, 0xCF, 0xC9, 0xED, 0x19, 0xCF, 0x44,
+    0xE5, 0xC4, 0x91, 0x22, 0x9F, 0xE4, 0xE7, 0x67, 0xAE, 0x2E, 0x17, 0xF8, 0x7C, 0xFA, 0x90, 0x03,
+    0x31, 0xBC, 0x24, 0x06, 0xC7, 0xE0, 0xFB, 0xF2, 0x05, 0xAF, 0x6B, 0xB2, 0x9C, 0xC1, 0x41, 0x4D,
+    0x3E, 0xD1, 0x64, 0xF3, 0xB9, 0xCC, 0x03, 0x13, 0xCD, 0xA6, 0x63, 0xF1, 0x74, 0xF6, 0xE2, 0xE4,
+    0x0C, 0x17, 0x0A, 0x3C, 0xC6, 0xC7, 0xF8, 0x34, 0xE3, 0x59, 0xEC, 0xC6, 0x5C, 0xF9, 0xFC, 0x01,
+    0xB5, 0x55, 0x3B, 0x8E, 0xDC, 0x46, 0x14, 0x7C, 0x1C, 0xC2, 0x4B, 0x18, 0x0C, 0x5A, 0x37, 0xE0,
+    0x11, 0x78, 0x84, 0x1E, 0xD8, 0x70, 0xAC, 0x0D, 0x76, 0x21, 0x18, 0xBE, 0x81, 0x93, 0x3D, 0x02,
+    0x07, 0x50, 0xE0, 0x54, 0xBA, 0x81, 0x02, 0x07, 0xF6, 0x28, 0xD8, 0xC4, 0x39, 0x47, 0x50, 0xE8,
+    0x64, 0x92, 0xB5, 0x43, 0x13, 0xFE, 0x44, 0x0E, 0xCC, 0xA0, 0x65, 0x8D, 0x56, 0x24, 0xCB, 0x55,
+    0xAF, 0x67, 0x05, 0xED, 0x4A, 0x5E, 0x38, 0x31, 0x81, 0x79, 0xEC, 0xE9, 0xAA, 0xEE, 0xAE, 0x57,
+    0xAF, 0xBB, 0x19, 0x26, 0x2B, 0xB0, 0xC1, 0xCE, 0xE2, 0x78, 0xB1, 0x3C, 0x0B, 0x4B, 0x0D, 0x14,
+    0xD8, 0xF5, 0x18, 0xE3, 0xC8, 0x66, 0x98, 0xED, 0x62, 0x79, 0x4A, 0x14, 0xBB, 0x38, 0x5A, 0x98,
+    0xF8, 0xDF, 0xF0, 0x13, 0xFF, 0x07, 0x60, 0x64, 0x13, 0x8B, 0xDD, 0x34, 0xFF, 0x54, 0xEF, 0x14,
+    0xD8, 0x81, 0x5D, 0x27, 0x6E, 0xE9, 0xC3, 0xD8, 0x11, 0x26, 0xEB, 0x13, 0x9B, 0xEC, 0x60, 0x93,
+    0x1D, 0x04, 0xFA, 0xC4, 0x26, 0x3B, 0x34, 0x68, 0x29, 0xCE, 0xCC, 0xA4, 0x82, 0xB1, 0x1B, 0xCC,
+    0x56, 0xFD, 0xF2, 0xBD, 0xE6, 0xC6, 0xDA, 0x22, 0xB0, 0xB7, 0x93, 0xFE, 0xFA, 0x99, 0x59, 0x73,
+    0x20, 0x5C, 0x2D, 0xA2, 0x63, 0x53, 0x2F, 0x64, 0xD6, 0x60, 0x67, 0x05, 0x76, 0x96, 0x58, 0x17,
+    0x78, 0x4C, 0x7E, 0xF7, 0x2B, 0x67, 0x69, 0xDE, 0x70, 0xD6, 0x0A, 0x0C, 0x05, 0x2E, 0x27, 0xCE,
+    0xF9, 0x9B, 0x3A, 0x0F, 0x31, 0x91, 0x59, 0x89, 0xB9, 0xE9, 0x47, 0x0E, 0x0F, 0x1A, 0x6E, 0x18,
+    0x6E, 0xE6, 0x2C, 0xB0, 0x07, 0xC4, 0x89, 0x98, 0x29, 0xED, 0x21, 0xD7, 0x2F, 0xF1, 0x39, 0x05,
+    0xAC, 0xB0, 0x39, 0xEF, 0x12, 0x5D, 0xB1, 0x7A, 0x96, 0xF6, 0x15, 0xD6, 0x54, 0x65, 0xFD, 0xBE,
+    0xA7, 0xD8, 0x36, 0x31, 0x59, 0x02, 0xB4, 0x87, 0x40, 0x97, 0x28, 0xB2, 0x07, 0x17, 0xB5, 0xF6,
+    0x2D, 0x4C, 0x40, 0xEF, 0xC0, 0xC3, 0x45, 0xC0, 0x5E, 0xE3, 0xDA, 0xD4, 0x4C, 0x02, 0x56, 0x79,
+    0xAA, 0x78, 0x10, 0x40, 0x5D, 0x04, 0x8C, 0x64, 0xAE, 0x41, 0x65, 0x04, 0x28, 0x8D, 0x80, 0x35,
+    0xB4, 0x5C, 0x8F, 0xB4, 0xC5, 0x51, 0x91, 0xAE, 0x21, 0x91, 0xB0, 0xBD, 0x4C, 0x24, 0x5B, 0x48,
+    0xB2, 0x26, 0x24, 0x29, 0x08, 0x89, 0x93, 0x5A, 0xF8, 0x5B, 0x4B, 0x07, 0x15, 0xC7, 0x82, 0xCB,
+    0x38, 0xF6, 0xBB, 0xD6, 0x90, 0x5A, 0xE7, 0xE7, 0xB1, 0xB4, 0x8E, 0x51, 0x69, 0x31, 0xAA, 0x6E,
+    0xC9, 0xDA, 0x83, 0xFC, 0x9B, 0xB9, 0x1A, 0x65, 0x6C, 0x58, 0x27, 0xEB, 0x87, 0x92, 0xB3, 0x70,
+    0x98, 0x3C, 0x58, 0xEE, 0x01, 0x5E, 0x9D, 0x3F, 0x22, 0xC0, 0xD2, 0x81, 0x00, 0x9F, 0x83, 0xCA,
+    0x48, 0x1D, 0xF1, 0x7A, 0xFB, 0xFC, 0xBF, 0x4D, 0xF5, 0xE6, 0x4C, 0x00, 0xD0, 0x09, 0xC0, 0x2F,
+    0x02, 0xF0, 0x5A, 0x00, 0xDC, 0x07, 0xF9, 0xE2, 0x4E, 0x2A, 0xB6, 0x72, 0x5B, 0x86, 0xDD, 0x05,
+    0x1A, 0x07, 0xB4, 0x5B, 0x08, 0x76, 0xB2, 0xF1, 0xDE, 0x26, 0x25, 0xB2, 0x00, 0xC0, 0xBB, 0xE6,
+    0xF6, 0xF2, 0xE3, 0x5C, 0x6C, 0xD5, 0xC4, 0xEB, 0xC5, 0x15, 0xAA, 0x39, 0xFA, 0xD2, 0x2E, 0xE6,
+    0xDF, 0x9B, 0xC5, 0x36, 0x6F, 0xC8, 0xDE, 0x73, 0x82, 0xE7, 0x04, 0xCF, 0x09, 0xEE, 0xC2, 0x79,
+    0xF7, 0x3F, 0x1A, 0x7A, 0x0F, 0x90, 0x1F, 0xCF, 0x63, 0xBE, 0x1B, 0xAF, 0xBF, 0xF3, 0xAC, 0xED,
+    0x56, 0x94, 0x3B, 0xB7, 0xE3, 0xF5, 0x16, 0x77, 0x38, 0xF7, 0x46, 0x89, 0x97, 0x23, 0x31, 0xDB,
+    0x60, 0x9E, 0x19, 0xDF, 0x9E, 0xDB, 0x4E, 0xBB, 0xFC, 0x4A, 0x66, 0x98, 0xF9, 0x6D, 0x23, 0x82,
+    0x6E, 0x09, 0x27, 0xE8, 0x5E, 0x31, 0x0F, 0xF1, 0x03, 0xC2, 0x17, 0xA7, 0x99, 0x00, 0xFC, 0xEE,
+    0x04, 0x36, 0x36, 0x22, 0x68, 0x15, 0x27, 0xF0, 0x79, 0x29, 0xC2, 0x1F, 0x5F, 0x21, 0xE5, 0x19,
+    0x1A, 0xE4, 0x19, 0x0A, 0xED, 0x31, 0xF7, 0xE3, 0x6D, 0x5E, 0xA2, 0x5A, 0x8E, 0x4B, 0x48, 0xA9,
+    0x96, 0x88, 0xC8, 0x84, 0x80, 0x1B, 0x42, 0xF6, 0x6D, 0xE5, 0x17, 0x96, 0x24, 0xED, 0x8F, 0x6F,
+    0xE9, 0xB2, 0x4F, 0x0B, 0xB8, 0xB3, 0x55, 0xCE, 0x90, 0x0B, 0xE4, 0x9D, 0x4B, 0xC7, 0xF2, 0x3B,
+    0xE0, 0xE8, 0xFC, 0x27, 0xEB, 0x63, 0x05, 0xC4, 0xD1, 0x61, 0xAD, 0xBC, 0xC0, 0x94, 0xC6, 0x6A,
+    0x9B, 0x7B, 0xBB, 0xD1, 0xB5, 0xA8, 0x05, 0xF9, 0xD3, 0x29, 0xE7, 0x4F, 0x37, 0x64, 0x37, 0x14,
+    0xB8, 0x72, 0x08, 0x0E, 0x73, 0xC4, 0x5E, 0x10, 0x5F, 0x82, 0x80, 0x17, 0xEA, 0xAE, 0xF0, 0x8D,
+    0x46, 0x95, 0xF0, 0x51, 0xF5, 0x2C, 0x68, 0xD3, 0xBC, 0xF2, 0x11, 0xDD, 0xCF, 0x82, 0x8A, 0x7C,
+    0x68, 0xAA, 0x2C, 0xCC, 0xF7, 0xAA, 0x15, 0x6E, 0xF3, 0x93, 0x66, 0xF1, 0x14, 0x3D, 0xA7, 0x1A,
+    0xCE, 0x6B, 0xE1, 0xC7, 0xAA, 0x5B, 0xEC, 0xF6, 0xB3, 0xCA, 0xF7, 0x9D, 0x47, 0x4F, 0xBA, 0xD4,
+    0x2D, 0xC5, 0x6C, 0xF6, 0x0F, 0x94, 0xAD, 0x15, 0xA7, 0xF2, 0x31, 0x62, 0xAD, 0xBD, 0x88, 0x7D,
+    0x9B, 0x34, 0x6D, 0x1C, 0x4B, 0x5C, 0x1C, 0xE2, 0x58, 0xCD, 0xF5, 0xC4, 0x4F, 0xCD, 0x54, 0xDD,
+    0x89, 0x95, 0x62, 0xAA, 0xA6, 0x7A, 0x6A, 0xA7, 0x72, 0x0E, 0x87, 0x86, 0xF7, 0x65, 0x9B, 0x02,
+    0x3F, 0x4E, 0xFD, 0x58, 0x61, 0xE8, 0xB1, 0xD3, 0x51, 0xD2, 0x2D, 0xC9, 0xE7, 0xB9, 0x1F, 0x25,
+    0xF8, 0xE9, 0x82, 0x8C, 0x6D, 0xFD, 0xF0, 0xD9, 0x99, 0x15, 0xDF, 0xBA, 0xF3, 0x6B, 0x69, 0x52,
+    0x22, 0x8B, 0xEC, 0xFD, 0x92, 0x45, 0x3D, 0xE8, 0xEA, 0x1D, 0x03, 0x86, 0x6E, 0x88, 0x38, 0x30,
+    0xFC, 0x35, 0x75, 0x43, 0xF7, 0x58, 0xE1, 0xB3, 0x59, 0x61, 0xEA, 0x46, 0xFE, 0x8D, 0x63, 0xFC,
+    0x91, 0x0A, 0x98, 0x7A, 0x40, 0xCF, 0x6F, 0x05, 0xE7, 0xBF, 0xCA, 0xD5, 0x6A, 0xBD, 0x64, 0xA7,
+    0xF5, 0xFB, 0x6E, 0x14, 0x3D, 0x9E, 0x68, 0x9F, 0x4C, 0x2A, 0xC5, 0x24, 0x1E, 0xDD, 0x4F, 0x27,
+    0xFC, 0x92, 0xAE, 0xED, 0x81, 0x3E, 0x8D, 0xD6, 0xCA, 0x24, 0x5D, 0xF9, 0x16, 0x53, 0xDE, 0xC5,
+    0x1F, 0x86, 0x74, 0x43, 0x71, 0xB2, 0xDF, 0xFF, 0xC1, 0xBF, 0x25, 0x18, 0x8A, 0x1F, 0xB4, 0x97,
+    0x93, 0x79, 0x68, 0x15, 0x4E, 0x74, 0x0C, 0xAD, 0xD1, 0x16, 0xAC, 0x07, 0x1D, 0x14, 0x8D, 0x2E,
+    0x35, 0xFA, 0x91, 0x82, 0xEF, 0x35, 0x2F, 0xE2, 0xD7, 0x6B, 0xFB, 0xD8, 0xF3, 0x0F, 0xC5, 0x55,
+    0xBB, 0x6E, 0xD5, 0x40, 0x10, 0x1D, 0xDB, 0x4A, 0x2C, 0xC5, 0x85, 0x69, 0xD2, 0xD0, 0xB8, 0x45,
+    0x69, 0xFC, 0x09, 0xEB, 0x86, 0x8A, 0x26, 0x45, 0x10, 0x05, 0x5F, 0x40, 0xC5, 0x27, 0xF8, 0x4A,
+    0x14, 0x14, 0x69, 0xD2, 0x50, 0x27, 0x45, 0x9A, 0xDC, 0x14, 0x7C, 0x82, 0xAF, 0x44, 0x49, 0x81,
+    0x05, 0xA2, 0xE6, 0x0A, 0x8A, 0x48, 0x50, 0x60, 0x45, 0x06, 0x39, 0x91, 0xED, 0xC3, 0x99, 0x59,
+    0xA3, 0xAB, 0xA0, 0x40, 0x42, 0x00, 0x61, 0x69, 0xD7, 0xFB, 0x9C, 0x39, 0x73, 0xCE, 0x8C, 0x2D,
+    0xC1, 0x23, 0x91, 0xC7, 0xE8, 0x42, 0xA0, 0x4F, 0x80, 0x2E, 0xC5, 0xBC, 0xC9, 0x7B, 0xB9, 0xE5,
+    0x5A, 0x11, 0xD7, 0x88, 0x94, 0xDA, 0x96, 0x53, 0x6B, 0xFC, 0x9A, 0xEE, 0xE5, 0x83, 0xDC, 0x49,
+    0xF1, 0x59, 0xEF, 0xF4, 0x7A, 0x57, 0x72, 0x2C, 0x25, 0xEC, 0x44, 0x64, 0x60, 0x73, 0xDA, 0x0A,
+    0x59, 0xAB, 0x0A, 0x49, 0x21, 0x92, 0x8E, 0x22, 0x1B, 0x87, 0x52, 0x02, 0x38, 0x63, 0xC3, 0x89,
+    0x76, 0xFB, 0x6C, 0xE3, 0xE6, 0x03, 0x3C, 0xDB, 0x91, 0xB4, 0x17, 0x6F, 0x59, 0xB0, 0x10, 0x89,
+    0x78, 0xE3, 0xF7, 0x97, 0xDE, 0x6E, 0x73, 0x89, 0x1B, 0x29, 0xB8, 0xE1, 0x08, 0x48, 0x80, 0x6B,
+    0x5D, 0xD7, 0x31, 0x91, 0x38, 0x76, 0x1F, 0x74, 0xB0, 0x75, 0x8C, 0xF9, 0x9E, 0xC5, 0x1B, 0x13,
+    0xF6, 0xF5, 0x06, 0xE7, 0x07, 0x12, 0xAB, 0xDF, 0x92, 0x2E, 0x6D, 0x20, 0x19, 0x1D, 0x05, 0x97,
+    0x0F, 0x36, 0x0E, 0x2A, 0x52, 0x85, 0xFD, 0x9E, 0xD3, 0x17, 0x98, 0x09, 0x96, 0x44, 0x55, 0x36,
+    0xC9, 0x28, 0xAE, 0x23, 0xB6, 0x8C, 0x5C, 0x76, 0xE9, 0x40, 0x54, 0x31, 0x4F, 0x57, 0xEF, 0x41,
+    0x0E, 0x07, 0x42, 0x0E, 0x80, 0x5A, 0x23, 0xA3, 0x99, 0xD8, 0x47, 0xA6, 0x6C, 0x67, 0xBD, 0x4C,
+    0xC1, 0x58, 0x58, 0x3E, 0xC0, 0xF4, 0x8A, 0x45, 0x3E, 0x84, 0x90, 0xF7, 0x14, 0xD4, 0xB5, 0x54,
+    0xB3, 0x54, 0xC9, 0xAB, 0x25, 0x4F, 0xA0, 0x4E, 0x87, 0x00, 0x8B, 0x18, 0x21, 0x66, 0x11, 0x78,
+    0x3A, 0xC4, 0x53, 0x5E, 0xC1, 0x4B, 0xAA, 0x8A, 0x57, 0xB4, 0x50, 0xBE, 0xEB, 0x26, 0x10, 0xB9,
+    0x76, 0x99, 0x62, 0x4A, 0xD5, 0x49, 0xC2, 0x48, 0x68, 0xBE, 0x98, 0x7C, 0x5C, 0xDD, 0xFD, 0x65,
+    0x12, 0x36, 0x28, 0xDB, 0x8C, 0xDC, 0xA3, 0xE1, 0x19, 0xCA, 0xAF, 0xC9, 0xE6, 0x17, 0xFF, 0x07,
+    0x09, 0x2C, 0x0B, 0x2C, 0x56, 0xDD, 0xFA, 0x31, 0x3E, 0xCE, 0x2E, 0x23, 0x41, 0x41, 0xA1, 0x4E,
+    0x34, 0xC6, 0x86, 0x03, 0x9D, 0x5B, 0xE8, 0x74, 0x39, 0xD3, 0xA8, 0x5C, 0x43, 0x12, 0x18, 0xAA,
+    0xA5, 0x19, 0xDE, 0x58, 0xD2, 0x8E, 0x4A, 0x72, 0x08, 0x1F, 0x94, 0xF5, 0x31, 0x6B, 0x4F, 0x97,
+    0x3A, 0x53, 0xDC, 0xEB, 0x6E, 0xEC, 0x54, 0x9F, 0x46, 0x8B, 0x5C, 0x4F, 0xB9, 0x96, 0xF1, 0xD1,
+    0x7A, 0x44, 0x8C, 0x0C, 0xB2, 0xFC, 0xB2, 0x43, 0xB2, 0x89, 0x4E, 0x09, 0x06, 0x35, 0x28, 0x18,
+    0xC7, 0x29, 0x14, 0x65, 0x2F, 0x2B, 0x92, 0xCC, 0xBE, 0xE7, 0x6E, 0x2A, 0x97, 0x0B, 0x1B, 0xB9,
+    0x6D, 0x68, 0x91, 0xB3, 0xC6, 0x2D, 0x90, 0xBC, 0x8F, 0x51, 0x44, 0x78, 0x42, 0x4B, 0xE5, 0x29,
+    0x0F, 0x25, 0xA6, 0x18, 0x14, 0x61, 0xA6, 0x98, 0x42, 0xB4, 0x7A, 0x5B, 0x71, 0x55, 0xBA, 0x53,
+    0xAA, 0x3B, 0xF7, 0x95, 0xC7, 0xF3, 0x9E, 0x2A, 0x64, 0xFC, 0xA2, 0x8C, 0x6A, 0x0B, 0xBB, 0xE0,
+    0x85, 0x13, 0x14, 0x3E, 0xAC, 0x68, 0x34, 0xA7, 0x33, 0x05, 0xA3, 0xC1, 0xA6, 0x3F, 0x2C, 0xDE,
+    0xDE, 0x53, 0xC1, 0x9B, 0xB2, 0x56, 0xF5, 0xF1, 0x1A, 0x85, 0xA6, 0x02, 0xEE, 0x0D, 0xB4, 0x01,
+    0x0C, 0x79, 0x2B, 0x9B, 0x0F, 0x71, 0x7F, 0xBB, 0xA2, 0xC3, 0x4C, 0xC9, 0x2D, 0xAC, 0x7A, 0x93,
+    0x41, 0x4B, 0x92, 0x9E, 0x5B, 0x5F, 0xC8, 0xFF, 0x66, 0xFB, 0x6C, 0x47, 0x0C, 0x0C, 0x03, 0xCF,
+    0xEC, 0x5D, 0x5B, 0x72, 0x02, 0x85, 0x61, 0xC5, 0xE0, 0x93, 0x51, 0xCD, 0x58, 0x52, 0xD6, 0xF6,
+    0x32, 0x33, 0x7C, 0x92, 0x5F, 0x6F, 0xDB, 0xC7, 0x6B, 0x77, 0x60, 0x22, 0xA0, 0xAB, 0xEA, 0x69,
+    0xB2, 0x55, 0x9D, 0x1F, 0xF2, 0x1C, 0x95, 0xD2, 0xDB, 0x14, 0xEF, 0xC6, 0x93, 0xF9, 0x73, 0xCC,
+    0xD5, 0x36, 0xA9, 0x8D, 0x0C, 0xEC, 0x34, 0xF1, 0x10, 0x64, 0x95, 0x02, 0x3F, 0x9F, 0x04, 0x47,
+    0x4E, 0x2B, 0xDD, 0xA7, 0x7B, 0xAB, 0x96, 0x23, 0x4D, 0x90, 0x9B, 0x4C, 0x16, 0xEB, 0xE4, 0xD0,
+    0xAD, 0xA8, 0x6B, 0x3D, 0xB1, 0x5A, 0x6E, 0x67, 0xFA, 0x53, 0x0A, 0x8A, 0xC8, 0xD3, 0xE2, 0x5A,
+    0x4F, 0x8D, 0x9F, 0x50, 0x00, 0xF1, 0x3F, 0x87, 0xE9, 0xCF, 0x70, 0x71, 0x42, 0x4E, 0x2D, 0x97,
+    0x93, 0xEB, 0x4D, 0xB4, 0x0C, 0x48, 0x11, 0x0D, 0x54, 0xF5, 0x15, 0x43, 0x7E, 0x48, 0x70, 0xB7,
+    0x1A, 0x4C, 0xEE, 0x3A, 0x34, 0xA9, 0x13, 0x95, 0x49, 0xD6, 0xB6, 0xBD, 0xAC, 0x26, 0x66, 0x32,
+    0x1E, 0x59, 0x31, 0x2C, 0xF5, 0xFB, 0x31, 0x7E, 0x1F, 0x4A, 0x68, 0xC9, 0x9D, 0xFF, 0x7C, 0x18,
+    0x1C, 0xC9, 0x9F, 0x3F, 0xDF, 0x00, 0xD5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0xDF, 0x09,
+    0x5C, 0xB8, 0x70, 0x13, 0x0A, 0x2A, 0x53, 0x53, 0xE0, 0x9F, 0xB0, 0x96, 0xF2, 0x03, 0x48, 0x13,
+    0x21, 0x91, 0x7F, 0x90, 0xE6, 0x5A, 0x8A, 0x48, 0xB6, 0x42, 0x41, 0x41, 0x01, 0x45, 0xA8, 0x69,
+    0x28, 0x50, 0x1A, 0xDA, 0x14, 0x48, 0x7B, 0x90, 0x32, 0x05, 0x87, 0x28, 0x28, 0xD2, 0x18, 0x28,
+    0x10, 0x55, 0x1C, 0xC9, 0x51, 0x7C, 0xC4, 0xDE, 0xE1, 0xBD, 0xDD, 0x4B, 0x52, 0x70, 0x24, 0x0D,
+    0x42, 0xC2, 0x89, 0x66, 0xAD, 0xF1, 0xEC, 0xCC, 0xBC, 0x37, 0x1F, 0x67, 0xA7, 0x12, 0x3B, 0xFD,
+    0xB3, 0x58, 0xA1, 0xD8, 0x3A, 0x17, 0x33, 0x8A, 0x9A, 0xA2, 0xDD, 0x9A, 0x38, 0xAB, 0xAA, 0xCE,
+    0x50, 0xA4, 0x14, 0x91, 0xEA, 0x13, 0x27, 0xF2, 0x36, 0x86, 0xD8, 0x5A, 0x22, 0x56, 0x28, 0xE4,
+    0x52, 0x88, 0x20, 0x86, 0xFD, 0xA6, 0x32, 0xD2, 0x67, 0xBD, 0x24, 0xCE, 0x34, 0x92, 0x77, 0x3A,
+    0x2D, 0xA0, 0x4A, 0xB6, 0xA1, 0xBA, 0x47, 0xD5, 0x9E, 0xE9, 0xF4, 0x54, 0xF5, 0x2B, 0x02, 0xE8,
+    0x63, 0x46, 0x19, 0xA9, 0x9B, 0x74, 0xF2, 0xA0, 0xB6, 0xB5, 0xC0, 0xAA, 0x12, 0x58, 0x89, 0xEC,
+    0xE5, 0x1D, 0xDC, 0x41, 0x05, 0x5F, 0x95, 0xC1, 0x21, 0x69, 0x0F, 0x31, 0xD6, 0x45, 0x14, 0x11,
+    0x38, 0x5F, 0xA6, 0x9C, 0x68, 0xC5, 0xDC, 0x87, 0x31, 0xFD, 0xCF, 0x28, 0x7A, 0xA3, 0x3B, 0x99,
+    0xD2, 0x52, 0x3F, 0xC1, 0xD2, 0xB4, 0xB0, 0x4C, 0x06, 0x5C, 0x1F, 0xE9, 0x7D, 0x28, 0x2D, 0x95,
+    0xF9, 0x15, 0xCA, 0x5B, 0x85, 0x40, 0x32, 0x9B, 0xD9, 0xF2, 0x97, 0x68, 0x87, 0xF6, 0x5D, 0x32,
+    0xA8, 0x36, 0x64, 0xF0, 0xA9, 0xCE, 0x6D, 0x6F, 0xBB, 0x48, 0x0F, 0x54, 0xD2, 0xC1, 0x36, 0xA2,
+    0x87, 0x0E, 0x66, 0x00, 0x63, 0x0F, 0x07, 0xBE, 0xCC, 0xAE, 0x7F, 0x91, 0x8B, 0x27, 0xD1, 0x39,
+    0x8F, 0x5C, 0xB5, 0x25, 0x40, 0xF8, 0xAF, 0xC2, 0xD1, 0xF2, 0x28, 0x32, 0x24, 0x9A, 0xC1, 0xDC,
+    0x7E, 0x19, 0x52, 0x47, 0x42, 0xEC, 0xAA, 0x92, 0xB4, 0xF2, 0x23, 0x09, 0x29, 0x8F, 0x9C, 0x3D,
+    0x59, 0x5F, 0x9F, 0x9C, 0x69, 0x78, 0x6C, 0x38, 0x0E, 0xC2, 0xD1, 0x6C, 0xEA, 0xCF, 0xDD, 0xDD,
+    0xDD, 0xD7, 0xE2, 0xC9, 0x46, 0x11, 0x55, 0xE4, 0x82, 0x4A, 0x78, 0x3F, 0xD7, 0x22, 0xE0, 0x23,
+    0x68, 0x07, 0xB9, 0xC9, 0x08, 0x1A, 0x52, 0xE0, 0x51, 0x33, 0x3D, 0x7F, 0x30, 0xBF, 0x82, 0xD6,
+    0x37, 0xBC, 0x94, 0x87, 0x85, 0x4F, 0x7D, 0x08, 0x29, 0x07, 0xF3, 0x1A, 0x69, 0xCD, 0xCA, 0x26,
+    0xDF, 0x07, 0x2D, 0x9D, 0x41, 0x67, 0xA5, 0xBD, 0x21, 0x33, 0xBD, 0xF1, 0x65, 0xCA, 0xBD, 0x8C,
+    0xBD, 0x5C, 0x30, 0x90, 0xB8, 0xCB, 0xB4, 0xC6, 0xF0, 0x72, 0x47, 0x22, 0x9D, 0x6F, 0xA0, 0xF0,
+    0xC0, 0xD1, 0xF8, 0x98, 0x0D, 0xB1, 0xEA, 0x73, 0x06, 0x5E, 0x93, 0xFF, 0x96, 0xB4, 0xB2, 0xF6,
+    0x97, 0xB2, 0x36, 0xDC, 0x0D, 0xD5, 0x8F, 0xC2, 0x37, 0x29, 0x67, 0x4B, 0x3E, 0xFE, 0x7B, 0x7E,
+    0x8D, 0x4F, 0xE3, 0x6A, 0x79, 0xB7, 0xC2, 0xCD, 0x40, 0xDB, 0xA1, 0x76, 0x98, 0x4B, 0x4C, 0x1D,
+    0x66, 0x4A, 0xA7, 0xD7, 0xBE, 0xE6, 0xFA, 0x6D, 0xC1, 0xB6, 0x5E, 0x56, 0x71, 0xA4, 0x62, 0xAB,
+    0x40, 0x41, 0xF0, 0x9F, 0x3A, 0xDB, 0x04, 0xB2, 0xB5, 0x59, 0xD4, 0xB9, 0x96, 0xDF, 0x9F, 0xBC,
+    0x05, 0x68, 0xAC, 0x24, 0xF8, 0xF7, 0xFF, 0x45, 0xC9, 0x10, 0x58, 0x24, 0xE9, 0x10, 0xA2, 0xE1,
+    0x1F, 0x81, 0x75, 0x26, 0x19, 0x93, 0xC4, 0x60, 0xC2, 0x46, 0xA7, 0xDC, 0x28, 0xA6, 0xC1, 0x5F,
+    0x4B, 0x66, 0xD2, 0x3E, 0x63, 0x29, 0xF5, 0xBB, 0xBE, 0xE4, 0x92, 0xF1, 0x4B, 0xC5, 0xD3, 0x14,
+    0x52, 0x8C, 0x16, 0xA5, 0x14, 0xE2, 0xA5, 0x81, 0x6D, 0x74, 0xDF, 0x77, 0x4F, 0x0B, 0x0F, 0x1D,
+    0x1B, 0x21, 0xED, 0x13, 0x6E, 0x91, 0x1E, 0x21, 0x90, 0x2E, 0x62, 0xEB, 0x14, 0x4D, 0x97, 0x2A,
+    0x82, 0x8C, 0x74, 0x1A, 0x07, 0xF0, 0x48, 0xA0, 0x82, 0x41, 0xAC, 0xAB, 0x3E, 0x2D, 0xB1, 0xC7,
+    0x48, 0x0B, 0x99, 0xB0, 0x2F, 0x77, 0x8B, 0x4D, 0xC2, 0x37, 0x75, 0xCE, 0x40, 0xC9, 0x10, 0x5A,
+    0x20, 0x84, 0x83, 0x9F, 0xD0, 0x69, 0x93, 0x57, 0xCB, 0xF0, 0x6B, 0xE5, 0xE1, 0x9B, 0x1A, 0xA2,
+    0xAC, 0x53, 0xC2, 0x4C, 0x86, 0x31, 0x36, 0x7A, 0x85, 0x20, 0x5A, 0x21, 0x50, 0xD6, 0x99, 0x1A,
+    0x07, 0xF7, 0x1D, 0xD7, 0x18, 0x7B, 0xA4, 0x61, 0x2F, 0xF8, 0x19, 0x59, 0xA0, 0x1C, 0xE9, 0x11,
+    0x7E, 0x1D, 0x80, 0x75, 0xDF, 0x21, 0x7D, 0x10, 0xA6, 0xDB, 0x4C, 0xB1, 0x31, 0x35, 0x10, 0x96,
+    0x4D, 0xDA, 0xC5, 0x5A, 0x98, 0x76, 0xEC, 0xA8, 0x02, 0x9F, 0x55, 0xEA, 0x32, 0x40, 0xAA, 0x23,
+    0x18, 0x22, 0x40, 0x4F, 0x18, 0x03, 0x40, 0xA6, 0x03, 0x2B, 0xED, 0x10, 0x39, 0x21, 0x78, 0x8F,
+    0xDC, 0x17, 0x06, 0xB4, 0x8B, 0xBE, 0x87, 0x30, 0xC7, 0x48, 0x2C, 0xED, 0x71, 0x0B, 0x91, 0x7F,
+    0xF8, 0x6E, 0x1E, 0x42, 0x4A, 0x7E, 0x72, 0x56, 0xF5, 0xC5, 0x86, 0x36, 0xF8, 0x9A, 0x3B, 0xBF,
+    0xA2, 0x3F, 0x80, 0x01, 0x73, 0xAA, 0x2C, 0x13, 0x94, 0x91, 0xB2, 0x2B, 0xCA, 0x23, 0x28, 0xB3,
+    0x33, 0x5D, 0xFC, 0x16, 0x8D, 0xFC, 0xF4, 0xF8, 0xA1, 0x04, 0xAE, 0xDB, 0x11, 0x50, 0xC5, 0x64,
+    0x2E, 0xF2, 0xF4, 0x95, 0x14, 0x99, 0x5F, 0x0E, 0x8B, 0x85, 0x85, 0x0F, 0xA8, 0x03, 0x86, 0xC6,
+    0xF4, 0x6C, 0x8A, 0x69, 0x59, 0xE7, 0x7D, 0x44, 0xB8, 0x31, 0x31, 0x65, 0x73, 0x78, 0x2A, 0xC3,
+    0x75, 0x57, 0x90, 0xA4, 0x59, 0x46, 0x51, 0xBA, 0x37, 0xFA, 0x0E, 0x5C, 0xF3, 0x62, 0xAC, 0x68,
+    0x98, 0xB4, 0xC7, 0x2C, 0xE7, 0x27, 0x40, 0x53, 0x7E, 0x76, 0x61, 0x84, 0xFD, 0xA8, 0xB1, 0xB7,
+    0x22, 0xF8, 0x58, 0xCB, 0x07, 0x0E, 0x54, 0xC3, 0x15, 0xC0, 0x01, 0x43, 0x06, 0xA5, 0x93, 0xBF,
+    0xF9, 0xFC, 0x02, 0xAD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x5D, 0x9F, 0x95, 0xB8, 0xB8, 0xC2,
+    0x15, 0x05, 0x95, 0x1B, 0x2A, 0x1A, 0x7F, 0xC2, 0x9E, 0x84, 0x50, 0x5A, 0x0A, 0x0E, 0x0A, 0x0A,
+    0x3E, 0x81, 0x4F, 0x38, 0x77, 0xFC, 0x4A, 0x38, 0x8A, 0xFB, 0x84, 0x35, 0x4A, 0x41, 0x41, 0x81,
+    0x05, 0x42, 0x29, 0x28, 0xCE, 0x12, 0x5D, 0x2A, 0x47, 0x71, 0x24, 0xC3, 0xD9, 0x3B, 0xBC, 0x37,
+    0xEB, 0xCB, 0x9D, 0xA2, 0x24, 0x5C, 0xC1, 0x4A, 0x7E, 0xB3, 0xDA, 0xD9, 0x5D, 0xBF, 0x9D, 0x79,
+    0x3B, 0x6B, 0x62, 0x11, 0xA9, 0x8D, 0x49, 0x60, 0x9A, 0x1B, 0x33, 0x0D, 0x26, 0x1D, 0xE6, 0x8E,
+    0xA6, 0x37, 0x96, 0xA6, 0xDB, 0x37, 0x59, 0xBB, 0x6F, 0xF2, 0x46, 0x8D, 0xBD, 0xCB, 0x2C, 0xEA,
+    0x60, 0x2A, 0x35, 0x2E, 0x18, 0x29, 0xF7, 0xCC, 0x44, 0x0A, 0x63, 0xAF, 0x5F, 0x3A, 0xC1, 0x1A,
+    0xE9, 0xB7, 0xA6, 0xA7, 0xE9, 0x48, 0xC0, 0x4A, 0x7B, 0x64, 0xD0, 0xB2, 0x86, 0xA8, 0x0B, 0x8D,
+    0xEE, 0xCB, 0x86, 0x0D, 0xD9, 0xB0, 0x13, 0x1A, 0x77, 0x42, 0x8B, 0x65, 0x66, 0x42, 0xB3, 0x22,
+    0xFD, 0x2D, 0xBC, 0x58, 0x11, 0x2B, 0x9C, 0xCA, 0x2C, 0xCA, 0x1D, 0x3A, 0x45, 0x09, 0x58, 0xDC,
+    0x60, 0x24, 0x33, 0xE0, 0x44, 0x18, 0x85, 0x44, 0x51, 0xBC, 0x49, 0xFD, 0x07, 0x6C, 0x95, 0x8A,
+    0x97, 0x16, 0x38, 0x20, 0x80, 0xA9, 0xF4, 0xA4, 0x98, 0xF4, 0xFC, 0xE9, 0xB4, 0x23, 0xA6, 0xED,
+    0x8E, 0x73, 0xAE, 0x68, 0x95, 0xF1, 0xD3, 0x02, 0x5C, 0x93, 0x01, 0x30, 0xF5, 0x87, 0xC0, 0x8F,
+    0xF9, 0x5B, 0x8F, 0x7C, 0xC8, 0x3E, 0x5C, 0x2C, 0x57, 0xFE, 0xE0, 0x0D, 0x00, 0xFA, 0xB7, 0x81,
+    0xA4, 0x14, 0xC8, 0xD2, 0xF6, 0xE6, 0x71, 0x04, 0xFE, 0x39, 0x53, 0x0D, 0x28, 0x09, 0xE0, 0x2B,
+    0x24, 0xFF, 0x28, 0x44, 0x2F, 0xF1, 0x58, 0x85, 0x38, 0xBB, 0xF3, 0x7B, 0x3A, 0x20, 0x73, 0x8E,
+    0x6F, 0xEC, 0x2C, 0x57, 0x0F, 0x4E, 0xAE, 0x35, 0x57, 0x4A, 0x43, 0xD0, 0xC9, 0x7A, 0xF3, 0x24,
+    0x91, 0x12, 0x02, 0x84, 0x86, 0x10, 0x54, 0x74, 0x0A, 0xFC, 0xBE, 0xD8, 0xA6, 0x33, 0x19, 0x46,
+    0x6D, 0x68, 0x76, 0xEA, 0x18, 0xE4, 0xF2, 0xCE, 0xE8, 0x91, 0x1E, 0x70, 0x5C, 0xCF, 0x5F, 0xC3,
+    0xC1, 0x28, 0xD5, 0x94, 0x36, 0x4E, 0xA3, 0x11, 0x33, 0xF6, 0xCF, 0xF2, 0xE3, 0x61, 0x5B, 0xFD,
+    0x9E, 0xD3, 0x21, 0xE2, 0xE8, 0x90, 0x35, 0x1D, 0x72, 0x45, 0x87, 0x68, 0x72, 0x27, 0x3E, 0x10,
+    0x54, 0x85, 0xB9, 0x72, 0x27, 0xC8, 0x2C, 0x64, 0x7D, 0xD0, 0xC0, 0x49, 0x08, 0x60, 0x24, 0xC5,
+    0x44, 0x66, 0x1A, 0x46, 0xFA, 0xF3, 0xD6, 0x68, 0x14, 0xEE, 0x18, 0x06, 0x49, 0x0C, 0xA3, 0xCD,
+    0x78, 0x07, 0x31, 0xEC, 0x97, 0xEE, 0x9E, 0xD9, 0xFE, 0x94, 0xC3, 0x72, 0xC9, 0x61, 0xF9, 0x8C,
+    0x61, 0x51, 0x4A, 0x53, 0xD5, 0x9B, 0x2D, 0xF5, 0xB7, 0x3B, 0x19, 0xDA, 0xEA, 0x66, 0xE0, 0xF8,
+    0x94, 0x84, 0x13, 0x2A, 0xE2, 0x30, 0xA8, 0x08, 0x35, 0xA1, 0x8D, 0x9C, 0x27, 0x47, 0x6F, 0x09,
+    0x8C, 0xAF, 0x9F, 0x88, 0x3F, 0xF1, 0x26, 0xA2, 0x48, 0xCC, 0x0E, 0xA2, 0x37, 0xDE, 0x04, 0x46,
+    0xB7, 0x81, 0x81, 0x79, 0x18, 0x54, 0x99, 0xAA, 0x55, 0xB7, 0xBE, 0xB7, 0x23, 0x6B, 0x79, 0xEE,
+    0x54, 0x70, 0xDF, 0x18, 0xA8, 0x29, 0x4A, 0x44, 0x75, 0xF4, 0x42, 0xD7, 0x43, 0x5E, 0xC7, 0x2B,
+    0x74, 0x16, 0x24, 0x2E, 0xDB, 0x0E, 0xB3, 0xB6, 0x28, 0xCD, 0x1D, 0x9D, 0xC9, 0xA9, 0x61, 0x4E,
+    0x13, 0xA9, 0x62, 0x68, 0x10, 0x22, 0x9C, 0xA5, 0xAC, 0x85, 0x58, 0x69, 0x55, 0x02, 0xAD, 0x11,
+    0xAD, 0x45, 0x70, 0xE3, 0x00, 0x48, 0x4D, 0xBA, 0x01, 0x89, 0x0D, 0xDC, 0x6B, 0x94, 0xB6, 0x35,
+    0xDC, 0xEF, 0x2A, 0x23, 0xB6, 0x8A, 0x87, 0x45, 0x91, 0xB4, 0x70, 0xB7, 0x62, 0xEC, 0x19, 0xDC,
+    0xDF, 0x07, 0x23, 0xB8, 0xFE, 0x72, 0xD2, 0x25, 0xED, 0xA2, 0x8A, 0x7D, 0xDA, 0xD8, 0x4F, 0x70,
+    0x77, 0xB6, 0x12, 0xAA, 0xBA, 0x76, 0xEF, 0x3B, 0x14, 0x4E, 0x29, 0xC4, 0x96, 0x74, 0xC7, 0x83,
+    0xB0, 0xCC, 0x74, 0x38, 0x8B, 0xBA, 0x33, 0x29, 0x33, 0xA8, 0xB0, 0xB0, 0x82, 0x13, 0x6C, 0xBC,
+    0x71, 0x1D, 0x94, 0xB1, 0x06, 0x94, 0xD0, 0x86, 0xA5, 0x4A, 0xB3, 0xA0, 0xC5, 0x6D, 0x49, 0xD9,
+    0xCA, 0xD1, 0x4C, 0xB7, 0xC3, 0xA1, 0x44, 0x8E, 0xE5, 0x70, 0x14, 0x25, 0x0E, 0xDD, 0x8C, 0x65,
+    0x11, 0x1B, 0xF0, 0xBE, 0x17, 0x89, 0x16, 0xB0, 0x3A, 0xD2, 0xEB, 0xD7, 0xE1, 0x6F, 0x25, 0xB2,
+    0x0A, 0x27, 0x4F, 0x5E, 0x24, 0x83, 0x37, 0x0B, 0x07, 0xA7, 0x2D, 0xF3, 0xAF, 0x70, 0x7E, 0x69,
+    0xD3, 0x2B, 0x38, 0x2F, 0x05, 0x67, 0x2D, 0x92, 0xDE, 0x9E, 0xF5, 0x16, 0xCE, 0x69, 0xE7, 0xF1,
+    0x24, 0x2C, 0x4A, 0x71, 0xCF, 0xE0, 0x6C, 0x10, 0x39, 0x3A, 0x13, 0xA9, 0xE9, 0x34, 0xD2, 0xA4,
+    0x90, 0x6B, 0x99, 0xF7, 0xB8, 0x8C, 0x59, 0x03, 0x81, 0x40, 0xB1, 0x28, 0xA1, 0x08, 0x6A, 0x20,
+    0x1E, 0x44, 0x6B, 0xE2, 0x7E, 0xBC, 0x2E, 0x81, 0x9D, 0x2B, 0xF6, 0x0F, 0x97, 0x85, 0x39, 0x54,
+    0xAF, 0x6C, 0x78, 0x45, 0xE4, 0xA7, 0x74, 0xB1, 0x8C, 0xEF, 0x12, 0x2B, 0xC8, 0x3F, 0xBA, 0xB9,
+    0xFC, 0x92, 0xB1, 0x8D, 0xC7, 0xCF, 0x6B, 0x56, 0xE7, 0xAC, 0x61, 0x75, 0x4E, 0xBD, 0xAB, 0xF9,
+    0x64, 0xE8, 0x0B, 0xE2, 0xBC, 0xB9, 0xD5, 0x9C, 0xDE, 0x22, 0x8D, 0x77, 0x44, 0x4D, 0x71, 0x26,
+    0xD1, 0x8B, 0xC6, 0x9B, 0x11, 0x4E, 0x7B, 0xAE, 0x4D, 0x3B, 0x56, 0x83, 0xBC, 0x25, 0x6B, 0xDB,
+    0x84, 0x97, 0x0F, 0x37, 0x1B, 0xAA, 0x64, 0x65, 0xD0, 0x87, 0x05, 0x37, 0x19, 0x42, 0x9D, 0x68,
+    0x41, 0xD2, 0xEA, 0xA4, 0x0F, 0xAE, 0xCC, 0xF8, 0xDE, 0x62, 0x82, 0x9F, 0xBF, 0x42, 0xE6, 0xF9,
+    0xF2, 0x54, 0x16, 0x4B, 0x5C, 0x63, 0x5B, 0xE6, 0x8C, 0x59, 0xB3, 0x1D, 0x03, 0x96, 0xF7, 0xE6,
+    0x3F, 0xB7, 0xBF, 0xCD, 0x55, 0xB1, 0x72, 0xDC, 0x36, 0x10, 0x5D, 0x92, 0x3A, 0xB1, 0x60, 0x01,
+    0x35, 0x4A, 0x11, 0x17, 0xEC, 0xD3, 0xF0, 0x13, 0xC0, 0x99, 0x14, 0x2E, 0xAD, 0xC2, 0x97, 0x26,
+    0x85, 0xEA, 0x54, 0xFA, 0x04, 0x50, 0xFE, 0x81, 0xB8, 0xB0, 0xD3, 0xA6, 0x71, 0x11, 0x5F, 0xA3,
+    0x3F, 0x08, 0x99, 0x51, 0x91, 0x32, 0x2C, 0xE2, 0x49, 0x19, 0x16, 0xC9, 0x64, 0x26, 0x8D, 0xE1,
+    0x31, 0x0B, 0x4A, 0x01, 0xB1, 0x79, 0xBB, 0xB8, 0xD3, 0x48, 0x4E, 0x9A, 0x14, 0x9E, 0x09, 0xEE,
+    0x0E, 0x20, 0x08, 0x60, 0x77, 0xDF, 0xDB, 0x87, 0xBD, 0xFC, 0x35, 0xED, 0xA8, 0x1F, 0xDC, 0x60,
+    0x16, 0x37, 0xE5, 0xCC, 0x9E, 0x1A, 0xFC, 0xB2, 0xAB, 0xE7, 0xA4, 0xED, 0xF4, 0x05, 0x65, 0x78,
+    0x89, 0x05, 0x26, 0x8B, 0x87, 0xEA, 0xE7, 0x66, 0x25, 0xCA, 0xB9, 0x25, 0x72, 0x13, 0x6D, 0x2E,
+    0x96, 0x63, 0xE6, 0x58, 0x61, 0xF5, 0x6B, 0xBE, 0xE5, 0x3F, 0xB8, 0xAD, 0x6F, 0xB9, 0x2B, 0x63,
+    0x3F, 0xE6, 0x7C, 0xB5, 0x64, 0x78, 0xF1, 0x0D, 0x2F, 0x58, 0x8C, 0x35, 0x07, 0x77, 0xC9, 0x8B,
+    0x99, 0xB2, 0x96, 0x0E, 0xAD, 0x9A, 0x9A, 0x8E, 0xA8, 0xF6, 0x76, 0x3C, 0xF4, 0x66, 0x6A, 0x06,
+    0xA2, 0x0C, 0x9F, 0x0F, 0x5A, 0xBF, 0x48, 0xCF, 0x01, 0x5D, 0xC6, 0xF0, 0x4F, 0x05, 0xC2, 0x41,
+    0x1F, 0xA5, 0xAF, 0x02, 0xC3, 0x8E, 0x09, 0x8C, 0xB3, 0x66, 0xE9, 0xD1, 0x37, 0xB3, 0x9D, 0x88,
+    0xAC, 0xB7, 0x5E, 0xA2, 0x6C, 0x66, 0x18, 0x18, 0x6B, 0x98, 0xE0, 0xC1, 0x04, 0x18, 0xE8, 0xAA,
+    0x95, 0x04, 0x50, 0x14, 0x33, 0x30, 0x54, 0x4A, 0xDF, 0x0A, 0x08, 0x6C, 0x88, 0xDB, 0x2F, 0x78,
+    0xA8, 0xE1, 0x89, 0x47, 0x8B, 0x23, 0xBD, 0xB7, 0x38, 0xEE, 0xBC, 0x83, 0x29, 0xBB, 0x30, 0xCC,
+    0x36, 0x41, 0x43, 0x72, 0xB4, 0x92, 0x9D, 0x7A, 0xD0, 0xD6, 0xF8, 0x6C, 0x2D, 0x67, 0x3A, 0xA2,
+    0x93, 0x8F, 0x49, 0x99, 0x06, 0x09, 0xF7, 0xAC, 0x21, 0x53, 0x2D, 0x83, 0x4F, 0x00, 0x30, 0x75,
+    0x7F, 0xF2, 0xCB, 0xED, 0x19, 0xA8, 0xA8, 0x13, 0x53, 0x97, 0x42, 0x09, 0x35, 0x5E, 0xA7, 0x05,
+    0x67, 0x3A, 0x75, 0x63, 0xBD, 0x6E, 0x9F, 0x82, 0xA9, 0x4C, 0x90, 0xE2, 0x1D, 0x8C, 0x04, 0xD0,
+    0xA4, 0xD3, 0x32, 0x52, 0x1D, 0x77, 0xDF, 0x51, 0x8F, 0x89, 0xD0, 0x89, 0x61, 0x21, 0xA5, 0x49,
+    0xA6, 0x36, 0x4D, 0x2B, 0x61, 0xA7, 0x13, 0x22, 0x49, 0x2C, 0xE3, 0x27, 0x67, 0xDF, 0xEF, 0xE3,
+    0x01, 0x47, 0x32, 0x95, 0x04, 0xC9, 0x94, 0x36, 0xAF, 0x68, 0xF3, 0x02, 0x14, 0xF2, 0x6C, 0x79,
+    0x14, 0xC3, 0xF8, 0xAA, 0x61, 0x00, 0xC9, 0x7F, 0xAB, 0x78, 0xAE, 0x25, 0x95, 0x40, 0x21, 0x26,
+    0x9B, 0x05, 0xE1, 0x12, 0x9D, 0x47, 0x80, 0xC8, 0x7A, 0xDD, 0x94, 0xC0, 0xF1, 0x35, 0xDF, 0xCA,
+    0xFC, 0x1D, 0x8F, 0x95, 0xEC, 0xEF, 0xA1, 0xD2, 0xB4, 0x1F, 0x27, 0x11, 0x11, 0xB9, 0x48, 0x74,
+    0xC9, 0xBF, 0xF7, 0x7C, 0xF3, 0xA5, 0x47, 0x9C, 0xBF, 0x02, 0x14, 0xC8, 0x1A, 0x12, 0xFD, 0x5D,
+    0xC9, 0xB1, 0xA5, 0xA7, 0x44, 0x9B, 0x33, 0xD5, 0xDC, 0x52, 0xAC, 0x6E, 0x70, 0xD7, 0xDC, 0x2F,
+    0x08, 0x11, 0x52, 0x3F, 0xC8, 0x11, 0xBB, 0xDF, 0x82, 0xF4, 0xC3, 0xF0, 0x66, 0xFB, 0x24, 0x28,
+    0x4C, 0xB3, 0x1F, 0x40, 0x1C, 0xD6, 0x7E, 0x82, 0x6D, 0x19, 0x40, 0xD4, 0xBD, 0xB5, 0x7B, 0xC3,
+    0x03, 0x2B, 0xF9, 0xEB, 0x6C, 0x47, 0xCD, 0x04, 0x7D, 0xF0, 0xE3, 0x55, 0x80, 0x0F, 0x08, 0x08,
+    0x31, 0x5F, 0xBC, 0xDA, 0x3B, 0xFD, 0x14, 0x31, 0x39, 0x24, 0xB5, 0xC1, 0x92, 0x08, 0x82, 0x78,
+    0xB2, 0xB3, 0x00, 0xBB, 0x86, 0x28, 0x03, 0xD4, 0xEB, 0x7E, 0x11, 0x3A, 0x1D, 0xBA, 0xF4, 0xE0,
+    0x25, 0x99, 0x38, 0x28, 0x9A, 0xCC, 0x61, 0xEE, 0xC4, 0xF0, 0xCB, 0xBE, 0xC5, 0xFA, 0x2C, 0xC4,
+    0xB7, 0xC8, 0x16, 0x6E, 0xD1, 0xE9, 0xDD, 0xB5, 0x79, 0x24, 0xD8, 0x25, 0x85, 0xB3, 0xD2, 0xBE,
+    0x26, 0xF2, 0x5B, 0x73, 0xD3, 0x3E, 0xE2, 0xD1, 0xB4, 0xC2, 0xFD, 0xD1, 0xDE, 0x9A, 0x12, 0x8A,
+    0x56, 0xAB, 0xBA, 0x4D, 0xF8, 0x6C, 0xB7, 0xDB, 0x5D, 0x05, 0xC7, 0x07, 0xFF, 0xFB, 0x3E, 0xD8,
+    0x5B, 0x79, 0x2F, 0x17, 0xCB, 0x68, 0x5F, 0x87, 0x7A, 0x16, 0x0B, 0x82, 0xBE, 0xF7, 0x15, 0xB7,
+    0x25, 0x4F, 0x9A, 0xB7, 0x81, 0x92, 0x32, 0xAD, 0x0A, 0xE7, 0x58, 0x55, 0x44, 0x1B, 0xA1, 0xFB,
+    0x13, 0xD5, 0xC4, 0x22, 0x1A, 0xD1, 0xB0, 0xC7, 0xFA, 0xF9, 0x85, 0x82, 0x92, 0x00, 0xF4, 0x12,
+    0x87, 0xD3, 0xED, 0x96, 0x1F, 0x40, 0x0F, 0x6E, 0x04, 0x2B, 0xAB, 0x3A, 0x2D, 0xA0, 0xEE, 0x37,
+    0xEC, 0x8D, 0x00, 0x82, 0xF5, 0x16, 0x14, 0x76, 0xF7, 0x51, 0x57, 0x53, 0x2D, 0x46, 0xB4, 0x06,
+    0xA4, 0xBE, 0xF2, 0x52, 0x57, 0xA8, 0xFD, 0xB0, 0xAE, 0xFC, 0x3F, 0xF9, 0x51, 0x67, 0x9D, 0xA3,
+    0x62, 0x35, 0x0B, 0xD9, 0x91, 0xBB, 0x3C, 0x54, 0xB8, 0x59, 0x74, 0x94, 0x96, 0xB2, 0xAF, 0x5A,
+    0x82, 0x58, 0x3A, 0xCD, 0x38, 0x38, 0x5C, 0xB3, 0x9B, 0x63, 0x56, 0x61, 0x68, 0x15, 0x14, 0x0E,
+    0x7F, 0xD8, 0x6E, 0xCF, 0xEF, 0xA9, 0x06, 0xDD, 0x8F, 0x4A, 0xDD, 0xA8, 0xCA, 0xB2, 0x4B, 0xBD,
+    0x9E, 0xB3, 0xB8, 0x1F, 0x0B, 0x81, 0x5E, 0x4A, 0x00, 0xD9, 0xD9, 0x03, 0x66, 0xBE, 0xCF, 0x52,
+    0x95, 0xB3, 0x43, 0xBA, 0x21, 0xE0, 0x71, 0x94, 0xB1, 0x90, 0x50, 0x52, 0x3B, 0xA1, 0x7F, 0x36,
+    0x94, 0xDA, 0x2A, 0x50, 0x19, 0x21, 0x52, 0xFD, 0xB6, 0x50, 0x2C, 0x0F, 0xB8, 0xAF, 0x06, 0xA9,
+    0x92, 0xC7, 0x54, 0x82, 0xA1, 0xD2, 0x7A, 0xC1, 0x86, 0x7E, 0x92, 0x3D, 0x3C, 0x08, 0x51, 0x52,
+    0xAD, 0x85, 0xE8, 0x2A, 0x9A, 0x54, 0xC4, 0x50, 0x09, 0xBF, 0x95, 0x20, 0x52, 0x66, 0x68, 0x5F,
+    0xAB, 0x29, 0x95, 0x98, 0x49, 0x36, 0xFC, 0xC5, 0xFA, 0x8F, 0xD0, 0x7B, 0xA0, 0x42, 0x7E, 0xDD,
+    0x0C, 0x0B, 0x8B, 0xE8, 0xC8, 0x84, 0x8A, 0xA5, 0x50, 0xC3, 0x05, 0x98, 0x81, 0x6F, 0x54, 0x74,
+    0x49, 0x2E, 0x9C, 0xE0, 0xD6, 0x94, 0x2C, 0x34, 0x59, 0x04, 0xD0, 0x15, 0x52, 0xFC, 0x3F, 0xD7,
+    0xB0, 0xA8, 0x47, 0x81, 0x91, 0x20, 0x4D, 0xBC, 0x83, 0x63, 0x46, 0xF9, 0x87, 0xC2, 0x55, 0x34,
+    0x5E, 0x1D, 0x97, 0xAB, 0x72, 0xD2, 0xB1, 0xE6, 0xE1, 0xDF, 0xF1, 0x4B, 0x2D, 0x87, 0x59, 0x8B,
+    0x2C, 0xA3, 0xDC, 0x1B, 0x81, 0x59, 0xAD, 0x45, 0x94, 0x0A, 0x8C, 0x9A, 0xD4, 0x69, 0xE5, 0xB4,
+    0x13, 0x86, 0x9C, 0x9F, 0x84, 0x7E, 0x4C, 0xA5, 0xD5, 0xA7, 0xFA, 0x3E, 0xDF, 0xA1, 0xCC, 0xF9,
+    0x6D, 0x04, 0xC8, 0x8C, 0xAF, 0x23, 0xC2, 0x07, 0x61, 0xFC, 0x4C, 0x42, 0xF4, 0x76, 0x02, 0x42,
+    0xE7, 0xCD, 0x52, 0x72, 0x6B, 0xE7, 0x22, 0xCA, 0x2B, 0xF0, 0xD9, 0x99, 0x08, 0x61, 0xDA, 0x29,
+    0xE3, 0x91, 0xFE, 0x63, 0xFB, 0x1B, 0xC5, 0x55, 0xB1, 0x8E, 0xE4, 0x44, 0x14, 0x7C, 0x1E, 0xDF,
+    0x62, 0x89, 0x91, 0x30, 0xC9, 0x91, 0x10, 0xF8, 0x13, 0xFC, 0x09, 0x6D, 0x74, 0x01, 0xE9, 0x05,
+    0x2C, 0x12, 0x22, 0x20, 0x22, 0x21, 0xE1, 0x13, 0x7A, 0x04, 0x01, 0x01, 0xC9, 0x05, 0x64, 0xFC,
+    0xC1, 0x12, 0xEC, 0x1F, 0x5C, 0xFB, 0xB4, 0xC1, 0x86, 0x3B, 0x20, 0x88, 0x08, 0x70, 0xB0, 0x22,
+    0xE0, 0x92, 0x3E, 0xC6, 0xD2, 0x1A, 0xAE, 0xED, 0xA2, 0xCA, 0x9E, 0x19, 0xED, 0x48, 0x48, 0x2B,
+    0x21, 0x9D, 0xB0, 0xE4, 0xD6, 0x9B, 0x72, 0xF7, 0xEB, 0x7A, 0xD5, 0xF5, 0x7A, 0xCC, 0xF8, 0x3C,
+    0xCF, 0x06, 0x73, 0x2D, 0x9A, 0x2A, 0xBA, 0x6D, 0x9E, 0xD6, 0x91, 0xD0, 0xBB, 0x76, 0x78, 0xDE,
+    0xC2, 0xD4, 0x54, 0x40, 0x2A, 0x00, 0xB4, 0x7C, 0x53, 0xCD, 0x9F, 0xC4, 0xB1, 0x35, 0xAB, 0x7B,
+    0xB3, 0x75, 0x32, 0x2B, 0x60, 0x8F, 0x3F, 0x85, 0xD5, 0x80, 0xAD, 0x31, 0xDA, 0x0A, 0xE8, 0xED,
+    0x0B, 0x60, 0x63, 0x16, 0x34, 0x63, 0x9E, 0xDE, 0x9A, 0x39, 0x66, 0xAE, 0xC7, 0x9F, 0xAD, 0x9E,
+    0x3C, 0x13, 0x31, 0x29, 0x3E, 0xE4, 0xDB, 0x78, 0x2E, 0xB1, 0xB3, 0x66, 0xD9, 0xCE, 0x35, 0xCF,
+    0x33, 0x14, 0xA9, 0x48, 0x55, 0x2C, 0x3B, 0xD7, 0x3E, 0xDA, 0xB3, 0x78, 0xEF, 0x3B, 0xFB, 0x12,
+    0x60, 0x62, 0x3C, 0xE1, 0x5B, 0x3E, 0xAB, 0xC6, 0x65, 0xF7, 0xD0, 0xDA, 0x7A, 0x32, 0xA0, 0xCB,
+    0x99, 0xA4, 0x64, 0x32, 0xF1, 0xB0, 0x62, 0x32, 0x2B, 0x39, 0x23, 0xBC, 0xFE, 0xE3, 0x12, 0x97,
+    0xE4, 0x1C, 0x80, 0x1F, 0x03, 0x06, 0xCB, 0x9E, 0x9A, 0x66, 0x61, 0x2B, 0x02, 0x1F, 0xF0, 0x1D,
+    0x55, 0x56, 0x3C, 0x3B, 0xFF, 0x0C, 0xDC, 0x3F, 0xC4, 0x3D, 0x59, 0x05, 0xE5, 0xCC, 0x3A, 0xAA,
+    0xB8, 0xBF, 0xCC, 0x2A, 0x55, 0xE3, 0x35, 0x5C, 0x04, 0x4D, 0x9D, 0x25, 0x28, 0x59, 0xFA, 0xCC,
+    0xC2, 0x02, 0xC5, 0xC8, 0xF1, 0x4E, 0x63, 0x3E, 0xB9, 0x29, 0x60, 0xCB, 0xA4, 0x53, 0xCE, 0xA1,
+    0x23, 0xE3, 0x81, 0xC5, 0x3D, 0xDD, 0x97, 0x71, 0xB2, 0x6D, 0xFF, 0xF6, 0xC5, 0x0F, 0x92, 0xA5,
+    0x1E, 0xB4, 0x98, 0x62, 0xB9, 0x63, 0xD0, 0xEF, 0x83, 0x8A, 0x42, 0x72, 0x51, 0xB2, 0x0C, 0x1A,
+    0x3E, 0x86, 0x76, 0x0C, 0xFD, 0x9E, 0xE2, 0x2C, 0x6A, 0x7E, 0x64, 0xE2, 0x63, 0xC3, 0x5F, 0x5F,
+    0xDF, 0x9A, 0x1F, 0x55, 0x63, 0xE7, 0x38, 0x98, 0x02, 0x7B, 0x1F, 0xB7, 0xFC, 0xFE, 0xF8, 0xFC,
+    0x7C, 0x5F, 0x48, 0x21, 0x30, 0x9B, 0xA9, 0x1D, 0x1F, 0xA5, 0xC0, 0x8E, 0xC9, 0x42, 0x62, 0x5A,
+    0x07, 0x1E, 0x56, 0x8D, 0x9B, 0x44, 0x1D, 0x76, 0x3A, 0x55, 0x82, 0x2C, 0xC8, 0xC5, 0x7C, 0x0A,
+    0x37, 0x29, 0x43, 0x4D, 0x10, 0xDF, 0x12, 0xF4, 0x57, 0x04, 0x5D, 0xC7, 0x99, 0x74, 0xCF, 0x0E,
+    0xE5, 0x50, 0x26, 0x5C, 0xA7, 0x1C, 0x6E, 0xC7, 0x63, 0xB9, 0x19, 0x61, 0x04, 0xB1, 0x21, 0xA8,
+    0xF5, 0x8E, 0xDB, 0xE2, 0x86, 0xA2, 0x12, 0x1C, 0xB8, 0x23, 0xCB, 0x21, 0x38, 0xCD, 0x85, 0x9C,
+    0x9F, 0x7F, 0x24, 0x72, 0xED, 0x5C, 0x69, 0x39, 0x9B, 0xE7, 0x20, 0x5A, 0x97, 0xE1, 0x6E, 0x22,
+    0x25, 0xDF, 0x15, 0x0A, 0xC0, 0xA0, 0x62, 0x90, 0x2B, 0xF0, 0xE1, 0x6E, 0x2C, 0x77, 0xF0, 0x3F,
+    0x8D, 0xEE, 0x6E, 0x74, 0x57, 0xF0, 0xBF, 0xF6, 0x0C, 0x90, 0xC3, 0x63, 0xEB, 0xEE, 0x30, 0x28,
+    0x30, 0x06, 0x34, 0x88, 0x4F, 0x0A, 0x36, 0xB3, 0x60, 0x2A, 0xB8, 0x75, 0x8D, 0xAD, 0x87, 0x3A,
+    0x5A, 0x3E, 0xC9, 0xC4, 0xBE, 0xA1, 0x63, 0x32, 0x7B, 0x74, 0x4F, 0x13, 0xF1, 0x2A, 0xA5, 0xC4,
+    0x5A, 0x4A, 0xE4, 0x52, 0x62, 0x25, 0x25, 0x4C, 0x4A, 0x58, 0x10, 0xE8, 0x04, 0xBA, 0x97, 0x04,
+    0xAB, 0x3F, 0x09, 0x96, 0x03, 0xE5, 0x29, 0x12, 0xEB, 0xCB, 0x27, 0xD6, 0xF7, 0x82, 0x44, 0x5C,
+    0xC4, 0x86, 0x33, 0x7D, 0x4B, 0xD0, 0x75, 0x04, 0x7F, 0x8B, 0x52, 0x62, 0x90, 0x12, 0x49, 0x4A,
+    0x4C, 0x52, 0x02, 0x52, 0x82, 0x45, 0x13, 0x6C, 0x05, 0x76, 0xCB, 0x99, 0x92, 0xE6, 0xD6, 0x35,
+    0x2B, 0x76, 0x84, 0xD5, 0xD1, 0xB7, 0xD9, 0x98, 0x0F, 0xA7, 0x1C, 0xDF, 0x90, 0x38, 0x96, 0xF7,
+    0xE5, 0x56, 0xCD, 0x5D, 0xC5, 0xC3, 0x58, 0xF4, 0x65, 0xC7, 0x0F, 0x4D, 0x66, 0xA7, 0x4F, 0x16,
+    0x16, 0xA7, 0xCA, 0x4D, 0x41, 0x96, 0x53, 0x97, 0xA2, 0x2D, 0x70, 0x5B, 0xA0, 0x2B, 0xD9, 0x2C,
+    0x88, 0xEA, 0x56, 0x37, 0xD4, 0x2C, 0xA8, 0x4E, 0x32, 0x79, 0x95, 0xE4, 0xF0, 0x72, 0xDC, 0x8F,
+    0xF1, 0xDE, 0x78, 0x1F, 0x1F, 0xE4, 0xCA, 0x65, 0xD5, 0x92, 0x41, 0x3D, 0x19, 0x7A, 0xA6, 0x2D,
+    0x10, 0xF3, 0x79, 0x17, 0xF9, 0x9B, 0x5B, 0xD4, 0x32, 0x8D, 0x36, 0x7E, 0x26, 0x42, 0x87, 0x6E,
+    0x5B, 0xF5, 0xEB, 0xCE, 0x68, 0xCB, 0xD6, 0x3C, 0x6F, 0x37, 0x9B, 0x72, 0xCE, 0x69, 0x8E, 0xBC,
+    0x3F, 0x69, 0xD4, 0x5A, 0x1D, 0xCF, 0x96, 0x4D, 0x46, 0xE2, 0x7D, 0x8E, 0x5F, 0x10, 0xB9, 0x1D,
+    0xDB, 0x97, 0x2E, 0xBC, 0xD2, 0x89, 0x54, 0xB4, 0x62, 0xF2, 0x9D, 0xB9, 0x57, 0x3A, 0x9A, 0x6B,
+    0x41, 0xA5, 0x20, 0x12, 0x0C, 0x5D, 0x20, 0x87, 0x06, 0x7F, 0x07, 0xB6, 0xC3, 0xC1, 0xB7, 0x36,
+    0x6B, 0x71, 0xD6, 0x3C, 0x2C, 0xCE, 0x76, 0x45, 0x71, 0x26, 0x35, 0x6D, 0xA5, 0x02, 0x07, 0x5D,
+    0x23, 0xCC, 0x1B, 0x0F, 0xE3, 0x7A, 0x54, 0xFB, 0xE2, 0xDF, 0xC6, 0xE5, 0xEB, 0x3C, 0x73, 0x59,
+    0xA5, 0x0C, 0xD5, 0xA0, 0x6C, 0x8E, 0xE2, 0x6C, 0xB2, 0x07, 0xC5, 0xC9, 0x3E, 0x37, 0xB5, 0xFF,
+    0x46, 0x9F, 0xB6, 0x62, 0xD4, 0x56, 0xF8, 0x9E, 0xB7, 0x3B, 0x7D, 0xF0, 0x04, 0xBC, 0x3D, 0x97,
+    0xB2, 0x89, 0xBF, 0x52, 0x86, 0x6B, 0x0D, 0xD5, 0x74, 0x71, 0x99, 0x3C, 0x3B, 0x37, 0xA2, 0x5D,
+    0xE1, 0x2B, 0xAE, 0x18, 0x73, 0xBC, 0x46, 0xD4, 0x45, 0xA6, 0xFB, 0x24, 0x72, 0x83, 0x51, 0x97,
+    0xCC, 0xB1, 0xF4, 0x53, 0x07, 0xD5, 0xFF, 0xC5, 0x41, 0xFF, 0xAB, 0x48, 0x4B, 0x0D, 0x47, 0x07,
+    0xBD, 0x78, 0xD8, 0x41, 0x14, 0xE3, 0x77, 0x44, 0xDA, 0x76, 0x71, 0xD0, 0x37, 0xB3, 0x83, 0xF4,
+    0x97, 0x79, 0x4F, 0x4A, 0x5E, 0xF9, 0xB3, 0xBA, 0xBA, 0x3F, 0xE8, 0xA0, 0x82, 0x0E, 0x9A, 0x70,
+    0xEA, 0xA0, 0xE6, 0xC4, 0x41, 0x6F, 0xF6, 0xF9, 0x07, 0xCD, 0x55, 0xBD, 0x6E, 0xD4, 0x40, 0x10,
+    0x1E, 0xDB, 0x10, 0x17, 0x96, 0xD8, 0x34, 0x34, 0xA1, 0xB8, 0x37, 0xC0, 0x8F, 0xB0, 0x96, 0xF2,
+    0x00, 0x50, 0xE4, 0x68, 0xA9, 0xA9, 0x78, 0x03, 0xD6, 0x54, 0x29, 0xA1, 0xE0, 0x01, 0x28, 0xA0,
+    0x39, 0x1E, 0x62, 0x37, 0xA2, 0xA0, 0xA0, 0x88, 0x11, 0x4A, 0x6F, 0x5A, 0x28, 0x62, 0xA1, 0x93,
+    0xB0, 0x88, 0xED, 0xE1, 0xFB, 0xD6, 0x97, 0xE4, 0x12, 0x11, 0x24, 0xA8, 0xD8, 0x68, 0xD6, 0x39,
+    0xCF, 0xCF, 0x7E, 0xF3, 0xCD, 0xEC, 0x58, 0x04, 0xCB, 0x04, 0x5B, 0x89, 0x7F, 0xAE, 0x92, 0x6A,
+    0x31, 0x48, 0xBE, 0x36, 0xAD, 0x24, 0x72, 0x4B, 0x2E, 0x57, 0xAA, 0x53, 0x95, 0xA8, 0x6A, 0x93,
+    0x73, 0x33, 0xDC, 0x16, 0x2F, 0xEF, 0x69, 0xD8, 0x95, 0x4C, 0x6B, 0x91, 0x5C, 0x19, 0x64, 0xC4,
+    0xB6, 0xE8, 0x93, 0xE5, 0xD2, 0x75, 0x25, 0x2C, 0x82, 0xC7, 0x96, 0x42, 0x86, 0x02, 0x5B, 0x27,
+    0x92, 0x68, 0x10, 0x29, 0x26, 0x58, 0xD9, 0xF5, 0xE6, 0x97, 0xD1, 0x3B, 0x55, 0xAA, 0x6B, 0x0B,
+    0x83, 0x1A, 0xD2, 0x67, 0xD8, 0xAA, 0x1D, 0xD5, 0x56, 0xE4, 0x76, 0x35, 0x1F, 0xBD, 0x08, 0x4E,
+    0x6C, 0xA3, 0x35, 0xA5, 0x0C, 0xAE, 0x3A, 0x07, 0x96, 0x3C, 0xA9, 0xC4, 0x69, 0x2F, 0x38, 0xA5,
+    0x82, 0x7F, 0x73, 0xFF, 0x11, 0xCF, 0x70, 0x88, 0x5C, 0xF6, 0x08, 0x3C, 0x20, 0xD4, 0x85, 0x24,
+    0xCB, 0xC7, 0x03, 0x22, 0x41, 0x6C, 0x8F, 0x44, 0x3B, 0xFF, 0x4E, 0x5B, 0x3F, 0x23, 0x94, 0xA7,
+    0x0A, 0x97, 0x03, 0x04, 0xBC, 0xBB, 0x5C, 0x32, 0x51, 0xFE, 0x04, 0xFC, 0x6A, 0xF3, 0xEF, 0xE5,
+    0x72, 0x00, 0xE5, 0x3F, 0x43, 0x61, 0x06, 0x9C, 0x90, 0x00, 0x70, 0x10, 0xDB, 0x15, 0xA3, 0x64,
+    0x93, 0xB8, 0x4E, 0x7C, 0xC8, 0xB4, 0x32, 0x03, 0x19, 0x80, 0x8D, 0x06, 0xDB, 0x49, 0x3E, 0x42,
+    0x05, 0x1B, 0x1F, 0x60, 0xFE, 0x80, 0xA8, 0x46, 0xA8, 0x80, 0x18, 0x40, 0x33, 0x25, 0x5D, 0x25,
+    0x49, 0x10, 0x64, 0x01, 0x62, 0xC8, 0xA1, 0x30, 0x73, 0x71, 0x03, 0x99, 0xA1, 0x69, 0x64, 0xC2,
+    0x44, 0x7D, 0xB4, 0x8F, 0x40, 0x37, 0x50, 0x61, 0x11, 0x10, 0x86, 0xC1, 0x90, 0xE2, 0x16, 0x50,
+    0x96, 0xC4, 0x75, 0x80, 0x54, 0xAE, 0x51, 0x13, 0x33, 0xA4, 0x5A, 0xE7, 0x13, 0x60, 0xA4, 0x5A,
+    0x01, 0xAD, 0x06, 0x40, 0x47, 0x2E, 0xB6, 0x2B, 0x3B, 0x29, 0x06, 0x20, 0x16, 0x3D, 0x44, 0xEC,
+    0xF2, 0x3B, 0x00, 0xE4, 0x03, 0xCB, 0xA9, 0xBE, 0x21, 0xB4, 0x88, 0x92, 0x47, 0x7B, 0x46, 0x5F,
+    0x68, 0x0C, 0xCD, 0xAA, 0x44, 0xD0, 0xA4, 0x03, 0x41, 0x44, 0x76, 0x67, 0xB8, 0xC3, 0x79, 0x4E,
+    0x73, 0x62, 0xFD, 0x05, 0x9C, 0x64, 0xC8, 0x61, 0xC5, 0xF2, 0x49, 0x36, 0x1A, 0xBC, 0x67, 0x15,
+    0xE1, 0x26, 0xD5, 0x7F, 0xCA, 0x6E, 0x5C, 0x45, 0x5B, 0xD6, 0xA0, 0xC3, 0xAC, 0x11, 0x3C, 0x83,
+    0xD2, 0xD6, 0x1E, 0xA9, 0xE0, 0x6F, 0x6B, 0xD9, 0x1E, 0x9D, 0x9F, 0xF3, 0xD6, 0x54, 0xDA, 0x00,
+    0x14, 0x80, 0xBB, 0x36, 0x53, 0xF0, 0x2E, 0xBE, 0x89, 0x60, 0xC1, 0x7B, 0x86, 0x3B, 0x00, 0x54,
+    0x01, 0x58, 0x4C, 0xEF, 0x1A, 0x18, 0x97, 0xEC, 0xD3, 0x63, 0x02, 0x3E, 0x1B, 0x63, 0xC7, 0x31,
+    0x14, 0x79, 0x2F, 0x88, 0x37, 0x21, 0xFE, 0x78, 0x43, 0x84, 0xB5, 0x91, 0x7C, 0x8A, 0xBC, 0x43,
+    0x91, 0x53, 0xCD, 0xA2, 0xC3, 0xBA, 0x21, 0xF0, 0x86, 0xDE, 0x75, 0x84, 0xB2, 0xF7, 0x66, 0x05,
+    0x7A, 0x75, 0x01, 0x37, 0xFF, 0x1E, 0x1E, 0xA6, 0xF3, 0x95, 0x64, 0xFD, 0x02, 0x26, 0xCF, 0xB2,
+    0xF6, 0x3F, 0x25, 0x3A, 0x5D, 0xED, 0xBD, 0x96, 0x62, 0xC4, 0x11, 0x66, 0x8D, 0xE0, 0xF6, 0x13,
+    0x7C, 0xDD, 0x3E, 0xAC, 0xFA, 0xBC, 0xD9, 0x42, 0xEC, 0x5B, 0x5C, 0xDD, 0xD8, 0xCE, 0xB0, 0x44,
+    0xDB, 0x92, 0x65, 0x20, 0xF4, 0x0D, 0x66, 0x95, 0x86, 0x7C, 0x42, 0x0E, 0x91, 0xE4, 0x54, 0x49,
+    0x53, 0x6C, 0x66, 0xFF, 0x71, 0xD8, 0x70, 0x6C, 0x4F, 0xD7, 0x9B, 0x5E, 0x36, 0x04, 0x11, 0x29,
+    0x8E, 0x44, 0xC6, 0x56, 0xA6, 0xC3, 0xCC, 0x70, 0xE4, 0x9A, 0x88, 0x2D, 0x6D, 0x2D, 0x6D, 0x2D,
+    0x2D, 0x2E, 0x1B, 0x39, 0xED, 0x73, 0x02, 0xB5, 0xED, 0xDC, 0xCB, 0x3E, 0x1D, 0xAE, 0x35, 0x31,
+    0x6E, 0x8D, 0x99, 0xE0, 0x63, 0x59, 0x56, 0xC5, 0xB9, 0x99, 0xDE, 0xF8, 0xAA, 0x16, 0xFB, 0x83,
+    0xFC, 0x1E, 0xEB, 0x5B, 0xAF, 0x9C, 0x96, 0x03, 0x67, 0xE0, 0x3C, 0x37, 0x77, 0x56, 0xFB, 0x7A,
+    0x8E, 0x88, 0x17, 0x4C, 0x66, 0xB8, 0xBF, 0x7F, 0x25, 0x32, 0xA6, 0x68, 0xB7, 0x23, 0x74, 0x5D,
+    0xE7, 0x42, 0xC6, 0xD1, 0xBD, 0x0D, 0x8A, 0xB7, 0xDD, 0x77, 0xE2, 0x4E, 0x51, 0xD1, 0x33, 0x45,
+    0xAA, 0x57, 0x5F, 0x84, 0x62, 0xE2, 0x94, 0x7E, 0x01, 0xF9, 0xC2, 0xF9, 0x5B, 0xE8, 0xB7, 0x89,
+    0x2D, 0x58, 0xCF, 0x7D, 0xB2, 0xE8, 0x67, 0x76, 0x36, 0x2F, 0x08, 0xF3, 0x8A, 0x9C, 0x2C, 0x0F,
+    0x62, 0x4F, 0xFE, 0x8B, 0x9C, 0x3C, 0x14, 0xCE, 0xAE, 0x6D, 0x89, 0xA9, 0xDD, 0x24, 0x2C, 0x9B,
+    0x0E, 0x4E, 0xF5, 0x03, 0x1F, 0x3F, 0x57, 0x87, 0x53, 0xC4, 0x98, 0xFF, 0xE9, 0xA1, 0x2B, 0x7C,
+    0x22, 0x3A, 0xF8, 0xF1, 0x81, 0x2C, 0x90, 0xD1, 0xF5, 0x87, 0xAC, 0x2E, 0xB8, 0x1A, 0xD3, 0x38,
+    0xEC, 0x8E, 0x48, 0x2B, 0xC9, 0x04, 0xC3, 0xBD, 0x61, 0x23, 0x5F, 0x1B, 0x55, 0x73, 0x02, 0x91,
+    0x46, 0x89, 0x44, 0x4A, 0xE4, 0x56, 0x22, 0xBB, 0x37, 0x29, 0xBE, 0xBE, 0xA2, 0x82, 0x9F, 0x14,
+    0x77, 0xCA, 0xAF, 0x1D, 0x14, 0xE0, 0x9B, 0x0A, 0xAF, 0xF4, 0x48, 0xB4, 0xA1, 0x47, 0xD9, 0xC7,
+    0x32, 0xE9, 0x5C, 0xA8, 0x23, 0x86, 0xF2, 0x1D, 0x15, 0x96, 0x8A, 0xC4, 0x8F, 0x50, 0x60, 0xC5,
+    0x50, 0x1A, 0x43, 0x4D, 0x3C, 0x03, 0x57, 0x2B, 0x76, 0xF1, 0xDF, 0xAF, 0x5F, 0xB5, 0x55, 0xBD,
+    0x8F, 0xDC, 0x54, 0x10, 0x1F, 0xDB, 0x3A, 0x59, 0x3A, 0x47, 0xBC, 0x2B, 0xB2, 0xA2, 0x74, 0x85,
+    0x94, 0x02, 0xC9, 0x2D, 0x45, 0xA4, 0xB1, 0xB8, 0x82, 0x82, 0xE2, 0xB6, 0xD8, 0x6D, 0xA8, 0x53,
+    0x5D, 0x93, 0x3F, 0xC1, 0x46, 0x29, 0x68, 0x69, 0xE8, 0x23, 0xD1, 0x24, 0xDB, 0x1C, 0xFF, 0x81,
+    0x9D, 0xA4, 0x23, 0x05, 0x0E, 0x94, 0x29, 0x30, 0x42, 0x34, 0xA4, 0xB1, 0x88, 0x43, 0x4C, 0x78,
+    0x7E, 0xC3, 0x6F, 0xE6, 0xBC, 0xB9, 0x8D, 0x00, 0x29, 0x41, 0xC2, 0xDA, 0x37, 0x3B, 0xEF, 0xCD,
+    0xF7, 0xC7, 0x9B, 0x47, 0x64, 0x5F, 0x32, 0xBA, 0x8E, 0x28, 0xF3, 0xF9, 0xB0, 0x87, 0xE9, 0xE8,
+    0x7A, 0x10, 0xCA, 0x88, 0xDE, 0xF8, 0x2A, 0x1C, 0x26, 0xF2, 0xAF, 0xF0, 0xC5, 0x46, 0xA1, 0x48,
+    0x67, 0x70, 0x32, 0x38, 0x03, 0xFE, 0x72, 0x5B, 0x94, 0x27, 0xF9, 0x1B, 0xCC, 0x14, 0xBE, 0x92,
+    0x60, 0x9C, 0xDE, 0xE0, 0xA0, 0x30, 0x94, 0x4A, 0xC7, 0x86, 0x01, 0x0E, 0x90, 0xED, 0x76, 0xCD,
+    0x83, 0x9A, 0x82, 0x2F, 0x6F, 0x20, 0x20, 0x8F, 0xCA, 0x57, 0xB3, 0xD9, 0x05, 0xF2, 0xBE, 0x6C,
+    0xD7, 0xF4, 0xCF, 0xCC, 0xA0, 0xB7, 0x90, 0xF0, 0x57, 0x08, 0x11, 0x10, 0x72, 0x7B, 0x24, 0x07,
+    0xD2, 0x48, 0x4D, 0x99, 0x8C, 0x40, 0x02, 0x92, 0x22, 0xE5, 0x55, 0x12, 0x32, 0x91, 0x70, 0xB0,
+    0xE6, 0x6C, 0xC6, 0xD9, 0xB2, 0x2E, 0xC2, 0xAE, 0x54, 0xEB, 0xFB, 0xE5, 0x0E, 0x68, 0x59, 0xB8,
+    0x07, 0xD9, 0xF9, 0xF5, 0xA2, 0x78, 0x59, 0xC9, 0xB2, 0xD4, 0x11, 0x99, 0xB0, 0xE0, 0xE3, 0x79,
+    0x49, 0x0C, 0xE3, 0xD2, 0x15, 0xEA, 0x66, 0xEB, 0x02, 0xA5, 0xA2, 0x3F, 0x20, 0xB1, 0xB4, 0x85,
+    0x72, 0x76, 0xCA, 0x50, 0x0D, 0x82, 0xDC, 0x17, 0x7F, 0x98, 0xFF, 0xA2, 0x6E, 0xA6, 0xA2, 0x71,
+    0x26, 0x16, 0x95, 0xA9, 0xA3, 0x48, 0xC3, 0x58, 0x4E, 0x9C, 0x51, 0x73, 0xE3, 0xE4, 0x17, 0x2A,
+    0xD5, 0x0C, 0xCD, 0x00, 0x96, 0x16, 0xDA, 0x12, 0xA9, 0xF3, 0x79, 0x93, 0xC1, 0x8A, 0x84, 0x7C,
+    0xC6, 0x36, 0xF0, 0x04, 0x73, 0x01, 0x0C, 0x24, 0xC1, 0x3A, 0xE5, 0x00, 0xA6, 0x06, 0x35, 0xC2,
+    0x45, 0xF7, 0x1E, 0x0E, 0x06, 0xEB, 0x83, 0xBE, 0x81, 0xD7, 0x6E, 0x8E, 0x2C, 0x0C, 0x9E, 0x10,
+    0x45, 0x22, 0xA7, 0x70, 0xA0, 0xFA, 0x0D, 0x4C, 0x4E, 0x6B, 0x40, 0xE8, 0x19, 0xF5, 0xAA, 0xDF,
+    0x8B, 0x6B, 0x7A, 0xC8, 0x28, 0x8D, 0x86, 0xC0, 0xCF, 0xC1, 0xCE, 0x53, 0x35, 0x50, 0xE1, 0x33,
+    0xB9, 0x07, 0x9B, 0x22, 0x67, 0x01, 0x02, 0x4F, 0x55, 0x97, 0x45, 0x37, 0x5B, 0xB8, 0x5A, 0x26,
+    0xEE, 0xD4, 0xA2, 0x1E, 0x9A, 0x3F, 0x1C, 0x2C, 0x6C, 0xCD, 0xC3, 0xFD, 0x25, 0xA7, 0x88, 0x07,
+    0x07, 0xB0, 0x56, 0x0D, 0x70, 0x0A, 0xAE, 0x5E, 0xA6, 0x34, 0x91, 0x12, 0x6E, 0xA4, 0xE2, 0xB4,
+    0xE2, 0x01, 0xC6, 0x96, 0x8C, 0x16, 0x56, 0x18, 0x59, 0x5A, 0x4C, 0x3A, 0xA7, 0xB0, 0xD4, 0x8E,
+    0xD4, 0xA2, 0xA9, 0xBF, 0xC8, 0x79, 0xBF, 0xE4, 0x33, 0x96, 0x87, 0x80, 0xB9, 0xD7, 0x04, 0x48,
+    0x8F, 0x58, 0x2D, 0x9D, 0x54, 0x8D, 0x48, 0x82, 0x9E, 0x15, 0x5E, 0x8B, 0xC7, 0x56, 0x1D, 0x84,
+    0x04, 0x8F, 0xD0, 0x6D, 0xD2, 0x67, 0xC1, 0x3C, 0x41, 0x5A, 0x22, 0x79, 0x1C, 0x54, 0xAD, 0x72,
+    0x21, 0x34, 0x94, 0x4A, 0xFA, 0x2B, 0x70, 0xDC, 0x48, 0xF8, 0x12, 0x49, 0x51, 0x8F, 0xBE, 0xD3,
+    0x12, 0x7D, 0xA1, 0x16, 0xE0, 0xBF, 0xE6, 0xA4, 0x83, 0xBE, 0x4A, 0xCB, 0x09, 0xF5, 0x2D, 0xDD,
+    0xA4, 0xE4, 0xA1, 0xF8, 0x6F, 0x6E, 0xDE, 0xF8, 0xF0, 0xF8, 0x5A, 0x5C, 0xD3, 0x5D, 0xBA, 0x41,
+    0xC7, 0xF4, 0x36, 0x48, 0x84, 0x98, 0x5B, 0xEA, 0x69, 0x40, 0xD1, 0xDF, 0x4B, 0xEA, 0xFE, 0xEE,
+    0xB5, 0xB7, 0x95, 0x5C, 0x90, 0x23, 0x96, 0x9F, 0xD1, 0x3B, 0x0A, 0x34, 0xC8, 0xC3, 0xCD, 0xF9,
+    0x6E, 0xB7, 0xBB, 0x40, 0x20, 0x7F, 0x62, 0x05, 0xCD, 0xA3, 0xE5, 0xA1, 0x11, 0xF9, 0x1D, 0xF8,
+    0x53, 0xAC, 0xDB, 0xC8, 0x6A, 0x23, 0xF6, 0xF9, 0xFF, 0xFA, 0xAF, 0x46, 0xEB, 0xFC, 0xC7, 0x3E,
+    0x7D, 0x39, 0x45, 0x73, 0xA0, 0xAA, 0xFA, 0xFF, 0x36, 0xE7, 0xE5, 0x71, 0xBD, 0xC2, 0x58, 0x82,
+    0xD9, 0xE7, 0x62, 0x0D, 0x6B, 0x1F, 0xA2, 0xFC, 0x1A, 0xDB, 0x6F, 0x77, 0xBB, 0xFB, 0xF1, 0x94,
+    0xF7, 0xCD, 0x29, 0xA6, 0xAA, 0xDC, 0x09, 0xF9, 0xB8, 0x2A, 0xDD, 0xC4, 0x3F, 0xC9, 0xA7, 0x9E,
+    0x7B, 0x49, 0x7C, 0xDE, 0xAD, 0x28, 0xF5, 0x99, 0x77, 0x93, 0x1B, 0xF3, 0xA1, 0xE8, 0x8B, 0x96,
+    0xDB, 0x15, 0x55, 0x0F, 0xE4, 0x34, 0xE8, 0x1C, 0xE6, 0xB6, 0x29, 0x43, 0xB4, 0x89, 0xA7, 0x74,
+    0xCC, 0x41, 0x6B, 0x4A, 0x88, 0x64, 0x13, 0xCE, 0x3B, 0x4C, 0x17, 0x63, 0x19, 0x79, 0x58, 0x95,
+    0x5B, 0xE8, 0x04, 0xD6, 0x37, 0x90, 0x13, 0x55, 0xC6, 0x3D, 0xB7, 0x12, 0x29, 0xF3, 0x98, 0x77,
+    0xAA, 0x71, 0x43, 0xF9, 0x58, 0x0C, 0x4D, 0x8B, 0xDE, 0x4C, 0x66, 0x37, 0x99, 0xE6, 0x07, 0x12,
+    0xCF, 0xD9, 0xE8, 0x80, 0x72, 0xBD, 0x05, 0x47, 0xD5, 0x36, 0x9F, 0xCB, 0xC7, 0x92, 0x04, 0x73,
+    0xC8, 0xDC, 0xE1, 0xB6, 0x52, 0xA3, 0x14, 0x62, 0x1F, 0x6D, 0xA2, 0x35, 0xAD, 0xD0, 0x18, 0x68,
+    0x61, 0x9D, 0x59, 0x19, 0x2E, 0x52, 0x8E, 0x68, 0x2B, 0x04, 0xEB, 0xC9, 0x3D, 0x7B, 0xE5, 0x71,
+    0x1F, 0x06, 0x84, 0xFC, 0xE8, 0xD7, 0x70, 0x41, 0x89, 0xDE, 0x1D, 0x50, 0xD9, 0xA8, 0x94, 0x0E,
+    0xAF, 0x99, 0x23, 0x7F, 0x29, 0x5B, 0xE0, 0x92, 0x36, 0xA5, 0xA9, 0x72, 0x7A, 0xC1, 0x7B, 0xD3,
+    0x4C, 0x47, 0x6B, 0x1C, 0xB7, 0x14, 0xA1, 0x55, 0x12, 0x1C, 0xEB, 0xB3, 0xC4, 0x14, 0x7F, 0x35,
+    0x7F, 0x76, 0x86, 0xB6, 0xD0, 0x21, 0xAF, 0xF7, 0x4F, 0x55, 0x26, 0x6A, 0x1F, 0x42, 0x15, 0x84,
+    0x82, 0x6D, 0x3F, 0x38, 0x7B, 0x72, 0x0B, 0xD4, 0x1F, 0xB0, 0x94, 0xF9, 0xC4, 0xB5, 0x27, 0xC4,
+    0x70, 0x18, 0x16, 0xD2, 0xE9, 0x92, 0x19, 0x9A, 0x69, 0x8D, 0x81, 0x57, 0xC8, 0x23, 0x09, 0x95,
+    0xBC, 0x14, 0x3C, 0x35, 0xA8, 0x1A, 0xCB, 0x13, 0xF1, 0xB1, 0x4D, 0xB3, 0x8F, 0x48, 0x65, 0xF0,
+    0x48, 0x60, 0x6A, 0x30, 0xEE, 0x93, 0x4C, 0x2C, 0x3D, 0x8B, 0xCE, 0x0D, 0xAE, 0x71, 0xA3, 0xE8,
+    0xC4, 0xDA, 0xF5, 0x13, 0x29, 0x3C, 0x26, 0x6F, 0xBD, 0xB6, 0x62, 0x43, 0x7D, 0x85, 0x8B, 0xCB,
+    0x18, 0xC5, 0xF9, 0xCC, 0x63, 0x8A, 0xEA, 0xC2, 0xD4, 0x75, 0x3A, 0x5A, 0x1E, 0x0D, 0x44, 0x53,
+    0x74, 0xE9, 0xC4, 0x23, 0x46, 0x01, 0xFC, 0xAB, 0x9B, 0xC1, 0x85, 0xCB, 0xCD, 0xF7, 0xD0, 0xDC,
+    0x65, 0x1E, 0x17, 0x6E, 0x4D, 0x47, 0xFA, 0xBE, 0xDE, 0xC1, 0x58, 0xE3, 0x51, 0x85, 0x75, 0xEC,
+    0x3C, 0xA6, 0x77, 0xBA, 0xB7, 0x86, 0x5C, 0xA7, 0x77, 0xF8, 0xFE, 0x02, 0x95, 0x55, 0x3D, 0x8F,
+    0xDD, 0x44, 0x14, 0xBD, 0xB6, 0xD9, 0x75, 0x14, 0x83, 0x26, 0x0D, 0x0D, 0x08, 0xA6, 0x45, 0x91,
+    0xC8, 0x34, 0x29, 0x28, 0xC2, 0x8E, 0x5F, 0xB6, 0x48, 0x41, 0x91, 0x2D, 0xD8, 0x8A, 0x82, 0x1A,
+    0x09, 0x69, 0xFF, 0x00, 0x8B, 0x47, 0xA4, 0xA4, 0x41, 0xE2, 0x0F, 0x6C, 0xB1, 0x0D, 0xFB, 0x0B,
+    0x28, 0x36, 0xF2, 0x28, 0x5B, 0x50, 0xA4, 0xC0, 0x12, 0x25, 0xCD, 0x04, 0x81, 0x40, 0xA2, 0xC8,
+    0x64, 0x63, 0x69, 0x0D, 0x3B, 0xF6, 0xE5, 0x5C, 0xFB, 0xBD, 0x4D, 0xE8, 0x12, 0xFB, 0x8D, 0x9F,
+    0x3D, 0xBE, 0xE7, 0x7E, 0x9C, 0xFB, 0x61, 0x22, 0xC5, 0x81, 0x3E, 0xA2, 0xEB, 0x94, 0x3B, 0x3A,
+    0xA2, 0x0F, 0x5E, 0xFD, 0x66, 0x8F, 0xFF, 0x77, 0xE4, 0xEE, 0xD5, 0xCE, 0xAC, 0x66, 0xFE, 0x63,
+    0xBF, 0x23, 0x39, 0x03, 0xBD, 0x1E, 0x6E, 0xFF, 0x33, 0x2A, 0xE7, 0xB3, 0x7A, 0x1D, 0x1C, 0xBD,
+    0x38, 0xB8, 0xA3, 0x7C, 0x94, 0x9B, 0x8C, 0xF1, 0xC7, 0xCB, 0x1E, 0x7B, 0x6A, 0x67, 0xA1, 0xE6,
+    0xF1, 0x40, 0xD6, 0xC9, 0x9D, 0xE9, 0x98, 0xAC, 0x97, 0x3B, 0x15, 0x8D, 0xD7, 0x41, 0xEE, 0x8A,
+    0x54, 0xF5, 0x2A, 0x2E, 0x90, 0x7C, 0x2C, 0x87, 0xF9, 0xCE, 0xFA, 0x76, 0x37, 0xD1, 0x22, 0x68,
+    0x1F, 0x8D, 0xDB, 0x47, 0x94, 0x1D, 0xE7, 0xA3, 0x8A, 0xAC, 0xD8, 0x95, 0xDC, 0xD9, 0x5F, 0x87,
+    0xF6, 0x3E, 0x0F, 0x25, 0x8F, 0x15, 0x27, 0xFB, 0xED, 0xC4, 0xC5, 0xC4, 0x9E, 0x47, 0x7B, 0x96,
+    0xF4, 0x13, 0x56, 0x71, 0xFB, 0x2F, 0x1D, 0xB8, 0x48, 0xCD, 0x6A, 0x9C, 0xF1, 0x8E, 0x4D, 0xD7,
+    0x38, 0x2A, 0x07, 0x1D, 0xEC, 0xE3, 0x1E, 0x56, 0x8B, 0x54, 0x0C, 0xEA, 0x5C, 0x6C, 0xC1, 0xEB,
+    0xA9, 0x48, 0xED, 0x6A, 0x12, 0xAF, 0xAD, 0x67, 0x1D, 0xE0, 0x72, 0x5B, 0x57, 0x7D, 0xFB, 0x20,
+    0xC1, 0x51, 0xEB, 0x32, 0x84, 0xD1, 0x22, 0x93, 0x78, 0x30, 0xDC, 0x29, 0x8E, 0x04, 0x7C, 0x86,
+    0x78, 0xDB, 0xC5, 0xE5, 0x0C, 0xBF, 0x97, 0x99, 0x90, 0xA3, 0xE4, 0x9A, 0xCA, 0x7E, 0xF3, 0xD4,
+    0xB0, 0x5B, 0xC7, 0x2C, 0xC1, 0x32, 0xD7, 0x0B, 0x53, 0x72, 0xE8, 0x73, 0xA6, 0x75, 0xE8, 0x38,
+    0x24, 0xE2, 0x76, 0xF3, 0x20, 0xAC, 0x14, 0xC3, 0xE6, 0x09, 0x6C, 0x75, 0x57, 0x3A, 0x84, 0x1C,
+    0x71, 0x78, 0xC3, 0xBD, 0xF0, 0xF2, 0x02, 0xA6, 0x62, 0xB3, 0xFA, 0x81, 0xE8, 0x0B, 0xA2, 0x77,
+    0x10, 0x06, 0x18, 0xB1, 0x4C, 0x9A, 0x5D, 0xC5, 0x5E, 0x5F, 0x4C, 0xE6, 0x17, 0x66, 0x24, 0xA6,
+    0x6E, 0xD9, 0x1B, 0x8E, 0xAC, 0x2F, 0xC7, 0x0A, 0xDC, 0x31, 0x3B, 0xCB, 0x9F, 0xF4, 0x7C, 0x2F,
+    0x81, 0x6A, 0x30, 0x47, 0xEF, 0x1E, 0xD9, 0x07, 0x49, 0x3D, 0x9B, 0xCA, 0xA1, 0xBD, 0x3B, 0x2E,
+    0x4A, 0xED, 0x4F, 0x83, 0x7A, 0x9E, 0x24, 0x3B, 0x20, 0xD1, 0xB7, 0x9F, 0x07, 0xFB, 0x73, 0x94,
+    0xFC, 0x41, 0x1D, 0x88, 0x76, 0x6C, 0xBD, 0x30, 0xDC, 0x17, 0x02, 0x03, 0xA1, 0x02, 0xB3, 0x1E,
+    0x30, 0x64, 0xE4, 0xB7, 0xB1, 0xEA, 0x85, 0x68, 0xF3, 0x64, 0x42, 0x02, 0x77, 0x85, 0x57, 0x38,
+    0x6C, 0xB9, 0xD7, 0x9C, 0x14, 0x23, 0x10, 0x50, 0xDE, 0x88, 0x0B, 0x33, 0xBD, 0x12, 0x74, 0x33,
+    0x90, 0x19, 0x49, 0xAD, 0x63, 0x7C, 0x83, 0x68, 0x6B, 0x61, 0xB9, 0xF1, 0x6A, 0xC8, 0x24, 0x4F,
+    0xF0, 0x03, 0x51, 0x79, 0xC8, 0xEE, 0x08, 0xC3, 0x9E, 0x6B, 0x1B, 0x1A, 0xAF, 0xA3, 0x98, 0xD4,
+    0xA1, 0x1C, 0x54, 0x2C, 0x52, 0xD9, 0x67, 0x48, 0x33, 0x4D, 0x59, 0x82, 0xD0, 0xC3, 0x45, 0xEC,
+    0xEE, 0x44, 0x22, 0x08, 0x2C, 0x44, 0x5B, 0x27, 0xC2, 0xA2, 0x4C, 0xE8, 0x15, 0x80, 0x0A, 0x02,
+    0xA9, 0xA2, 0x80, 0x8A, 0x5E, 0x60, 0x19, 0xBC, 0xB1, 0x1D, 0x6C, 0xAA, 0x1E, 0x66, 0xB3, 0x71,
+    0xF6, 0xBC, 0xCE, 0x13, 0x55, 0x9D, 0xED, 0x5A, 0x57, 0x82, 0x19, 0x62, 0x24, 0x03, 0x91, 0xE2,
+    0x2D, 0xCC, 0x81, 0x07, 0x2A, 0xA0, 0x08, 0x99, 0x14, 0x21, 0xED, 0x44, 0x8C, 0x49, 0x04, 0x4D,
+    0x10, 0xD1, 0x22, 0xCD, 0xC2, 0x8D, 0x13, 0x71, 0x98, 0x12, 0xC0, 0x34, 0x43, 0xB4, 0x17, 0x10,
+    0x74, 0xCC, 0x30, 0xA2, 0xF7, 0x90, 0x77, 0x8F, 0xAA, 0x45, 0xD1, 0x50, 0x76, 0x11, 0x28, 0x9D,
+    0xD2, 0xA1, 0x72, 0x26, 0x8F, 0xCA, 0xED, 0x54, 0xBE, 0x3A, 0x0B, 0x34, 0xD0, 0x35, 0xCA, 0x07,
+    0x6A, 0x83, 0x4E, 0x90, 0x41, 0x5B, 0xF4, 0xD5, 0x44, 0x4D, 0xCC, 0xD9, 0xA9, 0x91, 0x6C, 0x4F,
+    0xEC, 0xCB, 0x89, 0x74, 0x4D, 0x75, 0x4E, 0x60, 0xA1, 0x09, 0xEB, 0x17, 0x31, 0x63, 0x0F, 0xC1,
+    0x36, 0x18, 0x74, 0x10, 0x84, 0x6C, 0x5F, 0x8E, 0x54, 0x39, 0xBA, 0xB1, 0xA9, 0xA2, 0x1B, 0x64,
+    0x3C, 0xD5, 0xA5, 0x2F, 0x26, 0xBA, 0x85, 0xD8, 0x9B, 0x50, 0x0D, 0x2A, 0x15, 0x63, 0x0E, 0x9A,
+    0xA3, 0x76, 0x6D, 0x07, 0x0C, 0x99, 0x5E, 0xFC, 0xAA, 0xA4, 0xC3, 0x12, 0x5E, 0x80, 0xA6, 0x88,
+    0x17, 0x28, 0x88, 0xA7, 0x48, 0x36, 0xDC, 0x19, 0x8B, 0x64, 0x83, 0xE2, 0xBA, 0xF9, 0x93, 0xD1,
+    0x2B, 0xE5, 0x64, 0x83, 0x81, 0xA5, 0xEE, 0x18, 0x23, 0x26, 0x3B, 0xA6, 0x9C, 0xEF, 0x4B, 0x7B,
+    0xB7, 0x9D, 0x45, 0xE9, 0x1A, 0xF1, 0x54, 0x54, 0x41, 0x21, 0x54, 0xED, 0xA9, 0x24, 0x2F, 0x3C,
+    0x6C, 0xF5, 0xF0, 0x9F, 0xDD, 0x43, 0x78, 0x50, 0xC4, 0xBC, 0x2E, 0x46, 0x7A, 0x93, 0xA4, 0xAE,
+    0x61, 0xAC, 0x2F, 0x59, 0xC1, 0xA1, 0x33, 0xD4, 0x72, 0xE4, 0x4E, 0xA7, 0x65, 0x23, 0xC3, 0x06,
+    0x84, 0x51, 0xEB, 0x83, 0x89, 0xC5, 0x54, 0x25, 0xE2, 0x6F, 0x50, 0x2F, 0xA1, 0xF5, 0xAA, 0xD7,
+    0xB1, 0x18, 0x4B, 0x6C, 0xAC, 0xB0, 0x81, 0x71, 0xA0, 0xE2, 0x56, 0x4D, 0x9F, 0x5E, 0x75, 0x51,
+    0xE3, 0xAA, 0x08, 0xFA, 0x58, 0x4D, 0x6B, 0xA5, 0x02, 0x41, 0xCD, 0xED, 0xCD, 0x6F, 0x73, 0x8C,
+    0xB5, 0x66, 0x9E, 0x04, 0x1C, 0x2D, 0xF3, 0x60, 0x18, 0x3E, 0x72, 0xB9, 0x5E, 0x62, 0x46, 0x23,
+    0x06, 0x8C, 0x04, 0xB4, 0x12, 0xCD, 0x25, 0xDD, 0x4B, 0x70, 0x58, 0x7E, 0x59, 0x2F, 0x1F, 0x32,
+    0x0A, 0x31, 0x40, 0x88, 0xC3, 0xB2, 0x1A, 0x3F, 0x17, 0xF8, 0xCD, 0x93, 0x93, 0x93, 0xEF, 0x65,
+    0xE2, 0xC3, 0x00, 0x9F, 0xE3, 0xE1, 0x64, 0x96, 0xBE, 0x8D, 0xF5, 0xD6, 0x1D, 0x5C, 0xEE, 0x68,
+    0x5C, 0x7E, 0x2C, 0x3B, 0x2A, 0x62, 0x36, 0xAD, 0x00, 0x6A, 0xC4, 0xD0, 0x36, 0x7F, 0x87, 0xED,
+    0x7D, 0x19, 0x26, 0x2C, 0x36, 0xD1, 0xDF, 0xA8, 0x5C, 0xDD, 0x29, 0x47, 0x59, 0xBC, 0x85, 0xED,
+    0xAF, 0x04, 0xFB, 0xA1, 0xA4, 0xF6, 0xDA, 0xD2, 0x44, 0xA7, 0xC8, 0x98, 0xA3, 0x1C, 0xBC, 0xA3,
+    0x77, 0x4A, 0xD8, 0x96, 0x9E, 0x46, 0x93, 0xC3, 0x93, 0xC3, 0xB9, 0xE2, 0x32, 0xE8, 0x41, 0xF9,
+    0x49, 0x23, 0xC2, 0x75, 0x75, 0x48, 0xF9, 0xB3, 0x48, 0x1F, 0xAB, 0xBA, 0xF2, 0xA7, 0x34, 0x14,
+    0x9D, 0x21, 0x03, 0xD9, 0x79, 0xBC, 0xBD, 0xBD, 0x09, 0xC9, 0x84, 0xCD, 0xE8, 0xDB, 0x8C, 0xBD,
+    0xEC, 0x6A, 0xC8, 0xD9, 0xF5, 0xFF, 0xEF, 0xCA, 0x7F, 0xB9, 0x6C, 0x5C, 0x5C, 0x2E, 0x5F, 0x08,
+    0x8D, 0x40, 0xBB, 0x65, 0x60, 0x82, 0xD3, 0x79, 0x6B, 0xAB, 0xFD, 0x67, 0x6F, 0x0D, 0xE3, 0x8D,
+    0xEE, 0xA7, 0x6B, 0xE5, 0xFA, 0xF9, 0x5A, 0xA7, 0xEA, 0x9B, 0x85, 0x52, 0x74, 0xD5, 0x6C, 0xEF,
+    0xA6, 0x7B, 0x3F, 0xEB, 0xAE, 0x1F, 0xD1, 0x32, 0x4C, 0x91, 0x12, 0x8C, 0x2C, 0xD9, 0x97, 0x01,
+    0xD2, 0x6E, 0x28, 0x37, 0x82, 0x51, 0x1D, 0x7D, 0x7D, 0x2F, 0x1C, 0xD0, 0xCE, 0x6E, 0x7F, 0x70,
+    0x00, 0xAB, 0x5E, 0xE1, 0xF2, 0x37, 0x56, 0xC4, 0x14, 0xE4, 0x7F, 0xB1, 0x90, 0x4B, 0x06, 0xB1,
+    0x56, 0x14, 0xC8, 0x04, 0xC2, 0xEC, 0x24, 0x7C, 0x17, 0x3B, 0x52, 0x97, 0xB0, 0x55, 0x5E, 0xA2,
+    0x7D, 0x7B, 0x16, 0x23, 0x8D, 0xAF, 0x92, 0xC1, 0xBC, 0x9A, 0x30, 0x93, 0x26, 0x70, 0x4E, 0x0D,
+    0x62, 0x2E, 0xF1, 0x1D, 0xA7, 0xCC, 0xDD, 0xA6, 0xFF, 0x00, 0xBD, 0x55, 0x3F, 0x8F, 0xD5, 0x46,
+    0x10, 0x1F, 0xDB, 0x77, 0xE7, 0x48, 0x16, 0xDA, 0x14, 0xBC, 0x0A, 0x11, 0xF7, 0x08, 0xD8, 0x26,
+    0x05, 0x05, 0xCA, 0x6E, 0x94, 0x2F, 0x40, 0x71, 0x8F, 0x26, 0x05, 0x6D, 0x94, 0x8A, 0x0F, 0x70,
+    0x92, 0x2D, 0x4E, 0x88, 0x32, 0xF7, 0x11, 0x68, 0x22, 0xA1, 0x4B, 0x71, 0x2D, 0x05, 0x91, 0x1D,
+    0x51, 0x50, 0xD0, 0xBC, 0x26, 0xA2, 0x8C, 0xA5, 0x14, 0x48, 0xD0, 0xAC, 0x88, 0x11, 0xCB, 0x61,
+    0xEF, 0xF0, 0x9B, 0xB5, 0xEF, 0xDD, 0x71, 0x79, 0x42, 0x8A, 0x12, 0x65, 0xDF, 0xCD, 0xDC, 0xCC,
+    0xEC, 0x78, 0x76, 0xFE, 0xED, 0x6C, 0xC5, 0x2F, 0x78, 0xAC, 0x04, 0x51, 0x5C, 0xE5, 0x8A, 0x28,
+    0x1B, 0x40, 0x54, 0x96, 0x48, 0x39, 0xA2, 0x54, 0x36, 0x4C, 0x4B, 0x54, 0x80, 0x49, 0xC2, 0xCC,
+    0xE4, 0x1E, 0x04, 0x9F, 0xD5, 0x6F, 0x4E, 0xF4, 0x85, 0x31, 0xF5, 0xC4, 0x9C, 0xEA, 0xF7, 0xB3,
+    0xBE, 0x5E, 0xEB, 0xB3, 0xE6, 0xE7, 0xFC, 0x86, 0x1F, 0x35, 0xB5, 0xEE, 0x0A, 0x9F, 0x06, 0x3A,
+    0x4B, 0xC4, 0xAD, 0xA1, 0xF9, 0x7D, 0xC3, 0x56, 0x57, 0xC4, 0x2D, 0xDE, 0x5E, 0x5A, 0xC3, 0x3F,
+    0xF1, 0x9F, 0xEC, 0x7F, 0x39, 0xAF, 0x10, 0x89, 0xB8, 0xC5, 0x61, 0xB1, 0xD1, 0x7E, 0xDC, 0x32,
+    0x7C, 0x7F, 0x69, 0x69, 0x5E, 0x05, 0x7B, 0xBA, 0xC4, 0x7D, 0xCE, 0x3C, 0x02, 0x06, 0x0D, 0x30,
+    0x33, 0x54, 0xCC, 0xFE, 0x57, 0xAA, 0xDC, 0x7B, 0x6A, 0x9C, 0xA5, 0x06, 0xE1, 0x70, 0x4B, 0x29,
+    0xA2, 0xC9, 0x00, 0x0A, 0xC1, 0x28, 0x64, 0xA3, 0xE9, 0x20, 0x5E, 0xC1, 0x0C, 0x58, 0x44, 0xCD,
+    0x8E, 0x12, 0x80, 0x02, 0x5B, 0x0A, 0x3B, 0xED, 0x66, 0x48, 0x66, 0x3E, 0x4E, 0xB9, 0x29, 0x21,
+    0xAA, 0xEA, 0x29, 0x71, 0xBB, 0x34, 0xC1, 0xB9, 0x25, 0x69, 0x84, 0x4A, 0xC6, 0x02, 0x36, 0xDA,
+    0x55, 0xF8, 0xDA, 0xE0, 0x38, 0x83, 0x84, 0x56, 0xF0, 0x44, 0xBC, 0xB9, 0x48, 0x13, 0xC4, 0x95,
+    0x72, 0x80, 0x12, 0x5C, 0x5E, 0xA9, 0xB1, 0x61, 0x76, 0x6A, 0x94, 0x10, 0xD4, 0xA8, 0x6D, 0x39,
+    0xA8, 0x61, 0x8B, 0x8A, 0x41, 0x3C, 0x9E, 0xB0, 0x8A, 0x58, 0x7B, 0xC1, 0x8D, 0x03, 0xCE, 0xB8,
+    0x2D, 0x06, 0x71, 0x1A, 0x18, 0xA7, 0x08, 0x46, 0x48, 0x5E, 0x4A, 0x08, 0x0C, 0x57, 0x50, 0xF7,
+    0x05, 0xCA, 0x7A, 0xEB, 0xBC, 0x9B, 0x90, 0x23, 0x44, 0x38, 0x07, 0x5C, 0x8E, 0x33, 0x0D, 0xFF,
+    0x60, 0x61, 0xFB, 0x54, 0xDF, 0xF4, 0x49, 0x13, 0xAC, 0xE9, 0x91, 0xDC, 0xCE, 0xF4, 0xF0, 0xCB,
+    0x47, 0x7A, 0x34, 0xBD, 0x3A, 0x50, 0xC1, 0xF4, 0x5B, 0x94, 0x05, 0x83, 0xD4, 0x4C, 0x38, 0x0F,
+    0xDA, 0x89, 0x8F, 0x82, 0x2B, 0x0F, 0x9C, 0x72, 0x07, 0x5C, 0xB0, 0x2D, 0x9D, 0x98, 0x07, 0x06,
+    0x2B, 0x78, 0x25, 0xC9, 0xD4, 0x2D, 0x6D, 0x5B, 0xF9, 0x3B, 0xBB, 0x44, 0xBE, 0x92, 0x64, 0x55,
+    0x4E, 0x02, 0xAA, 0xFA, 0x99, 0xC6, 0x87, 0xA6, 0xA3, 0x64, 0xAD, 0x0F, 0x2F, 0xF8, 0x35, 0xE0,
+    0x18, 0x30, 0x2E, 0x96, 0xB7, 0xA5, 0x55, 0x91, 0xF1, 0x98, 0x5E, 0xE9, 0x5F, 0x28, 0xCB, 0x49,
+    0xA4, 0x7A, 0xC9, 0xDD, 0x54, 0xC4, 0x0C, 0xE5, 0x48, 0xA2, 0x62, 0x3D, 0x29, 0x56, 0xE8, 0x6D,
+    0x71, 0x7C, 0xB1, 0x5C, 0x12, 0x7A, 0x88, 0x2D, 0xAA, 0x10, 0xF2, 0x57, 0xCC, 0xFD, 0x9E, 0x62,
+    0x7E, 0xD6, 0xC2, 0xB4, 0x10, 0x2F, 0x41, 0x84, 0xCD, 0xC4, 0x0B, 0x10, 0x83, 0x10, 0x0F, 0x40,
+    0x74, 0x20, 0xFA, 0xBC, 0x45, 0xB1, 0xF7, 0x14, 0x32, 0xFC, 0x8F, 0x89, 0xD3, 0x55, 0xC0, 0x99,
+    0x0C, 0xE0, 0x00, 0x5C, 0x32, 0xDF, 0xFB, 0x0B, 0xA9, 0xD7, 0xE6, 0xF3, 0xC4, 0x1B, 0x21, 0xE0,
+    0xCA, 0x6B, 0x87, 0x30, 0x38, 0x91, 0xCF, 0xE9, 0xC7, 0xC3, 0xC3, 0x68, 0x10, 0xCC, 0x2A, 0x1A,
+    0x54, 0x82, 0xBE, 0x01, 0x5E, 0x79, 0x7C, 0xB3, 0xDF, 0x81, 0x55, 0xFB, 0x88, 0x41, 0x44, 0x4E,
+    0x44, 0x4F, 0x3F, 0x11, 0x75, 0x22, 0xFA, 0xEE, 0x58, 0x1A, 0x52, 0x4C, 0x48, 0x67, 0xD2, 0xE1,
+    0xE1, 0xCF, 0xB0, 0x98, 0xEC, 0xCE, 0x93, 0x22, 0x0E, 0x07, 0x21, 0x52, 0x4F, 0xC9, 0x4A, 0xD7,
+    0x3F, 0xE8, 0xE3, 0x63, 0xC6, 0xF7, 0xF1, 0x2A, 0x72, 0xBB, 0xE0, 0xB7, 0x96, 0x4A, 0x94, 0x26,
+    0xC3, 0xA7, 0xC4, 0x77, 0xA4, 0x94, 0x5C, 0xA7, 0x01, 0x0D, 0x98, 0xB6, 0x37, 0xA6, 0x70, 0x77,
+    0xAC, 0x76, 0xC6, 0xE3, 0xD7, 0xAB, 0x6E, 0xC3, 0xA5, 0x72, 0xDA, 0x95, 0x4E, 0xF5, 0x85, 0xCF,
+    0x87, 0x6C, 0x48, 0x46, 0xB9, 0x78, 0x4B, 0x69, 0x15, 0xEE, 0x65, 0x2A, 0x31, 0x65, 0x3D, 0xA6,
+    0x1A, 0x92, 0x98, 0xB8, 0xEB, 0x10, 0xEF, 0xDD, 0x04, 0xBA, 0xF6, 0x25, 0xD0, 0x17, 0xF4, 0x3F,
+    0xAC, 0xAF, 0x01, 0x17, 0xE4, 0xC8, 0x9B, 0x25, 0xD0, 0xE3, 0x1C, 0x33, 0xC3, 0x25, 0xE1, 0x5B,
+    0x5C, 0xA5, 0x0A, 0x17, 0x9B, 0x76, 0xF8, 0xE0, 0xBF, 0xCD, 0x15, 0x2D, 0xEC, 0x19, 0x3B, 0x91,
+    0xD0, 0x35, 0x5D, 0x4E, 0xFD, 0xCE, 0x3D, 0x3E, 0x3A, 0x92, 0x72, 0xF1, 0x53, 0x31, 0x98, 0xDC,
+    0xE1, 0x5D, 0x74, 0x3B, 0x52, 0x64, 0x30, 0xFC, 0xD4, 0x5B, 0xC6, 0x6D, 0xC4, 0xD8, 0xD3, 0x1D,
+    0x86, 0xC2, 0xD5, 0xAC, 0x3E, 0x71, 0x1F, 0x06, 0x42, 0xD3, 0xE9, 0x3F, 0x42, 0x36, 0x34, 0x5D,
+    0xB5, 0x3F, 0xC8, 0xA0, 0xE3, 0x38, 0xF5, 0xC5, 0x34, 0x74, 0x21, 0x90, 0x47, 0x61, 0x16, 0x60,
+    0xF6, 0xCD, 0x02, 0x9C, 0xBE, 0x16, 0xE8, 0xDF, 0x42, 0xCE, 0xA6, 0x6D, 0xDE, 0xF9, 0x82, 0x1B,
+    0x8B, 0x09, 0x44, 0xB7, 0x68, 0x7B, 0x1A, 0x8F, 0x68, 0xC3, 0xF7, 0x70, 0xF8, 0x89, 0x74, 0x74,
+    0x38, 0xC8, 0xBD, 0xDC, 0x5B, 0x69, 0x41, 0x63, 0x93, 0x23, 0x09, 0xF9, 0x09, 0x74, 0xBE, 0x3F,
+    0x79, 0xCB, 0xE2, 0x92, 0xC1, 0x78, 0x69, 0x5D, 0x5A, 0x4F, 0x65, 0x5B, 0xD4, 0x94, 0xBA, 0xAF,
+    0xD6, 0xA5, 0xBD, 0x18, 0x4B, 0x9B, 0x3E, 0xC4, 0x3F, 0x38, 0x70, 0xD7, 0x14, 0x54, 0xA9, 0xE7,
+    0x4E, 0xBD, 0xFB, 0x80, 0x91, 0x86, 0x37, 0x41, 0xB1, 0x97, 0x4E, 0x0F, 0x72, 0x0C, 0x4C, 0x30,
+    0x9E, 0x9F, 0x5E, 0x2E, 0x14, 0x15, 0x1F, 0xD8, 0xE5, 0x7E, 0x60, 0x7A, 0x6C, 0x94, 0xDD, 0x52,
+    0x92, 0x3D, 0x17, 0x4F, 0x14, 0x4F, 0xB9, 0x9D, 0x46, 0x74, 0x39, 0x4E, 0xAF, 0x04, 0x5D, 0xF9,
+    0x7B, 0xA9, 0xE5, 0xE0, 0x38, 0x5F, 0xFC, 0xF4, 0x64, 0xC8, 0x88, 0xA7, 0x2B, 0x76, 0x73, 0x5F,
+    0x6C, 0x34, 0x7A, 0xFD, 0xDF, 0xF7, 0xDB, 0x47, 0xB5, 0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0x1E,
+    0xDB, 0xBC, 0x58, 0x60, 0x89, 0xA5, 0xC8, 0x15, 0xA4, 0x71, 0x0B, 0x11, 0x64, 0x5B, 0x8A, 0x88,
+    0xB5, 0x94, 0x92, 0x82, 0xE6, 0x4E, 0x29, 0xF2, 0x07, 0x10, 0x05, 0xF7, 0x0B, 0xB8, 0x35, 0x4A,
+    0x71, 0x05, 0x45, 0xAE, 0xA7, 0x80, 0x22, 0x5D, 0x1A, 0x5A, 0x8A, 0x8B, 0xF7, 0x2E, 0x45, 0x0A,
+    0x1A, 0x87, 0x88, 0xD0, 0x5A, 0x02, 0x82, 0x44, 0x93, 0x05, 0x2C, 0x64, 0xC1, 0x7A, 0x87, 0x6F,
+    0xD6, 0xF7, 0x88, 0x72, 0x52, 0xDE, 0xDD, 0x21, 0xB1, 0xDE, 0xB7, 0xBB, 0x5E, 0xCF, 0x7C, 0x33,
+    0xFB, 0xCD, 0xEC, 0x3C, 0xB2, 0x47, 0x5C, 0x04, 0xE5, 0x8B, 0xA8, 0x26, 0x33, 0x70, 0x5B, 0x7B,
+    0x6C, 0x94, 0x81, 0x64, 0x73, 0x34, 0x7D, 0x39, 0xD5, 0x83, 0xFD, 0x2C, 0x92, 0x71, 0x49, 0x2A,
+    0x0B, 0xE5, 0x58, 0xF7, 0xB6, 0x51, 0x83, 0x69, 0x63, 0x31, 0xD1, 0xFB, 0x14, 0x0A, 0xAF, 0x1C,
+    0xA1, 0x6D, 0xCB, 0x40, 0x2A, 0xA4, 0xC9, 0x8C, 0x32, 0x66, 0xDC, 0xCB, 0x54, 0x70, 0xDA, 0xCB,
+    0xBF, 0xA2, 0x8D, 0xED, 0x72, 0x42, 0xA9, 0x04, 0x00, 0xAE, 0x4C, 0x98, 0xAC, 0xE7, 0x41, 0x50,
+    0x1E, 0x70, 0x23, 0x28, 0xF9, 0x5D, 0xEC, 0x5D, 0x1A, 0x36, 0xA3, 0x9C, 0xED, 0x86, 0x00, 0xAC,
+    0x9A, 0x34, 0x74, 0xE2, 0x39, 0xDF, 0xE6, 0x96, 0xA8, 0x64, 0x15, 0xF1, 0x52, 0x87, 0xA4, 0x63,
+    0xFC, 0x55, 0x91, 0xB8, 0xBA, 0xD9, 0x56, 0x42, 0x01, 0x80, 0x5B, 0xE0, 0xD3, 0x5B, 0x3D, 0x2F,
+    0x96, 0x7D, 0x9A, 0xCE, 0x00, 0xC8, 0x92, 0x1B, 0xB4, 0xC1, 0x8D, 0x6B, 0x22, 0xF1, 0x89, 0x70,
+    0x71, 0x9B, 0x3F, 0x8C, 0x66, 0xB4, 0xEE, 0xF2, 0x4B, 0xB0, 0xEA, 0x81, 0x1F, 0xF3, 0x9D, 0xB9,
+    0xF6, 0xAB, 0xE7, 0x3B, 0x6B, 0x26, 0xCA, 0xE4, 0x5B, 0xA2, 0x41, 0x27, 0xFE, 0x9A, 0x97, 0x80,
+    0x5C, 0x01, 0x3F, 0x07, 0xDA, 0xE3, 0x30, 0x70, 0x43, 0x88, 0x6F, 0x25, 0x08, 0x3D, 0x50, 0xAA,
+    0x9E, 0xB2, 0x69, 0xD3, 0x59, 0xCA, 0x69, 0xCD, 0xF1, 0xC2, 0x77, 0x3A, 0x40, 0x35, 0xFD, 0x1B,
+    0xD9, 0x7C, 0x09, 0x49, 0x25, 0xC4, 0xE8, 0x56, 0xBB, 0xBA, 0xCD, 0xB8, 0xED, 0x40, 0x5E, 0xC5,
+    0x79, 0x28, 0x99, 0x74, 0xA8, 0x7C, 0x1D, 0xC8, 0xF6, 0xDA, 0x81, 0xBC, 0xB7, 0xA9, 0xC3, 0xEF,
+    0x45, 0x2D, 0xE8, 0x81, 0x28, 0xCD, 0xD2, 0x42, 0x1A, 0xF9, 0x8F, 0x65, 0xFA, 0x76, 0x99, 0x20,
+    0xD1, 0xD1, 0x69, 0x5B, 0x2B, 0x68, 0xAD, 0x9A, 0x8C, 0x1B, 0xD8, 0x6A, 0x5F, 0xB4, 0xD5, 0x0D,
+    0xDA, 0x59, 0x4F, 0xF7, 0xA1, 0xD5, 0x35, 0xA7, 0x6D, 0x9D, 0x34, 0xFB, 0x80, 0xEF, 0x44, 0x33,
+    0x59, 0xB7, 0xDE, 0x28, 0x90, 0x9B, 0xFC, 0x23, 0xEF, 0x87, 0x6C, 0x4D, 0xA2, 0xBE, 0x21, 0xA1,
+    0x99, 0xBA, 0xFE, 0x23, 0x49, 0x29, 0x91, 0xD7, 0x92, 0x3E, 0xF9, 0x4F, 0x66, 0x84, 0xE0, 0xE7,
+    0x22, 0x98, 0x45, 0x35, 0x43, 0xED, 0x51, 0x94, 0x98, 0x27, 0x11, 0x33, 0x5E, 0x6B, 0x98, 0x6F,
+    0x7E, 0x9F, 0xB7, 0xF2, 0x14, 0x8E, 0x79, 0x59, 0x9D, 0xFD, 0x64, 0xD0, 0xFB, 0xF9, 0x56, 0x5F,
+    0xCA, 0x33, 0x54, 0x17, 0xD1, 0xEB, 0xA2, 0x09, 0x7A, 0x52, 0xBE, 0x1A, 0x0A, 0x77, 0x5E, 0x2D,
+    0xD1, 0x13, 0xA7, 0x0B, 0x57, 0xF6, 0xCA, 0xD7, 0xA3, 0x09, 0x5D, 0x3C, 0xBF, 0x66, 0xDE, 0x56,
+    0xC3, 0x3B, 0xEF, 0x7D, 0xFD, 0xFA, 0xF5, 0xEB, 0xA8, 0x30, 0xEE, 0x02, 0x27, 0x6C, 0x6F, 0xB6,
+    0xFF, 0x85, 0x19, 0xDA, 0x42, 0x0A, 0x0E, 0x8A, 0x27, 0xCD, 0xC1, 0x3C, 0x8E, 0xE6, 0x28, 0x5A,
+    0xC7, 0x4B, 0x47, 0x05, 0x33, 0x47, 0x8C, 0xCD, 0x9A, 0x03, 0x04, 0x20, 0x06, 0xE1, 0x77, 0xF5,
+    0x43, 0xE4, 0x5A, 0xFD, 0xF0, 0xB7, 0x60, 0x4F, 0x06, 0x9F, 0x0A, 0x48, 0x31, 0x53, 0xCE, 0x8D,
+    0x24, 0x32, 0x8F, 0x74, 0x38, 0xD3, 0x9E, 0x6D, 0x4C, 0xDD, 0x6B, 0x14, 0xBF, 0x27, 0xF1, 0x03,
+    0xE6, 0x3F, 0x99, 0xE7, 0x8F, 0xEF, 0xFD, 0x45, 0x19, 0x2E, 0xBB, 0x3D, 0x49, 0x03, 0xC6, 0x05,
+    0x8E, 0xEA, 0xD7, 0xBB, 0x86, 0x68, 0xC2, 0x85, 0x1B, 0x6B, 0x9E, 0xDE, 0xDC, 0x1D, 0xE5, 0x12,
+    0x9A, 0x83, 0x2C, 0x7E, 0xB3, 0xFB, 0x3B, 0xF3, 0x3E, 0xC0, 0x00, 0x9F, 0x6D, 0x53, 0x17, 0x0A,
+    0x78, 0x11, 0xB7, 0xE5, 0xAB, 0x23, 0xF3, 0xA5, 0x37, 0x1C, 0xEC, 0xD3, 0x68, 0x1A, 0x96, 0xDE,
+    0xB2, 0x7E, 0x1A, 0x15, 0x87, 0x9C, 0x3D, 0x7C, 0x94, 0xBB, 0xC4, 0xBC, 0x74, 0xA2, 0x59, 0xD2,
+    0xB4, 0x18, 0x25, 0x4B, 0xD5, 0x20, 0x17, 0xC2, 0xB4, 0x92, 0xF4, 0x4C, 0xF9, 0x4C, 0xC5, 0x92,
+    0xC0, 0x3B, 0x30, 0xEF, 0x71, 0x4A, 0xFD, 0xDD, 0xAC, 0xDB, 0x59, 0x1F, 0xE1, 0xB8, 0xE3, 0xC2,
+    0x8A, 0xF9, 0x61, 0x31, 0xD1, 0x99, 0x47, 0x11, 0x0C, 0x55, 0xC0, 0xDF, 0x59, 0xE4, 0x7B, 0xB8,
+    0x6B, 0x7E, 0x09, 0xA8, 0xEA, 0x16, 0x5F, 0x5B, 0x36, 0x4F, 0x18, 0x17, 0xAD, 0x0C, 0x51, 0x2C,
+    0x16, 0xE1, 0xD5, 0xDD, 0x49, 0xB1, 0x57, 0xDC, 0xAE, 0xB6, 0x29, 0xF3, 0x54, 0x37, 0x19, 0x4E,
+    0xD6, 0xA4, 0x4B, 0x97, 0x56, 0x69, 0x40, 0xB1, 0x91, 0x0D, 0x2F, 0x5C, 0xA0, 0x6D, 0xED, 0x34,
+    0x27, 0xAB, 0xE4, 0xD5, 0x9E, 0x3A, 0x1E, 0x4D, 0x39, 0x1C, 0x56, 0x7D, 0x50, 0x0E, 0x7D, 0xAE,
+    0xFA, 0xBD, 0xC2, 0xEB, 0x06, 0x95, 0x65, 0x8B, 0xCA, 0xC1, 0x64, 0x93, 0x72, 0x87, 0x98, 0x0B,
+    0xBF, 0xF4, 0x3D, 0x11, 0x3C, 0x1E, 0xF7, 0x56, 0xCD, 0x5B, 0x57, 0x0E, 0x3E, 0xE5, 0xC9, 0xFE,
+    0x1D, 0x6C, 0x3B, 0x5B, 0x8A, 0x96, 0xEE, 0x9F, 0xEA, 0x5B, 0x60, 0xF5, 0x82, 0x81, 0x4F, 0xC5,
+    0xC4, 0x78, 0x1B, 0x3A, 0xAE, 0x9F, 0x1D, 0xEF, 0xE3, 0x8F, 0x0D, 0x2C, 0x6A, 0x57, 0xF9, 0x7C,
+    0xBD, 0x48, 0x44, 0x56, 0x3C, 0x18, 0x1E, 0xF5, 0xB3, 0xF0, 0x1A, 0xB8, 0x45, 0x47, 0x91, 0x53,
+    0x9E, 0x0C, 0xD2, 0xA2, 0x41, 0x8A, 0xA8, 0x11, 0x91, 0x99, 0x97, 0x4E, 0xCF, 0xE5, 0xA7, 0xFA,
+    0x8B, 0xF0, 0x0A, 0x00, 0x01, 0x75, 0x6B, 0xCC, 0xD9, 0xE5, 0x08, 0xFB, 0x25, 0x08, 0xC4, 0x37,
+    0x28, 0x9A, 0x7B, 0x10, 0x0E, 0x1A, 0x3E, 0xEC, 0xD0, 0xFF, 0x9E, 0x68, 0xE7, 0x69, 0xFF, 0x00,
+    0xD5, 0x55, 0xB1, 0x8E, 0x1D, 0x35, 0x14, 0xBD, 0xF3, 0x46, 0x6F, 0x47, 0x30, 0x85, 0x69, 0xB6,
+    0x40, 0x48, 0x0C, 0x2D, 0x69, 0xFC, 0x03, 0x49, 0x3C, 0x81, 0x0E, 0x0A, 0x52, 0xEC, 0x53, 0x24,
+    0x9A, 0x54, 0x48, 0x09, 0x14, 0xFB, 0x05, 0x79, 0x9E, 0x90, 0x82, 0x82, 0x66, 0x0B, 0x08, 0x05,
+    0x45, 0x40, 0xA2, 0x08, 0x4B, 0x11, 0x3E, 0x20, 0x59, 0xCF, 0x4B, 0x8A, 0x14, 0x29, 0x98, 0x10,
+    0x89, 0x14, 0x34, 0x83, 0x10, 0x89, 0xC8, 0x16, 0x6B, 0xB1, 0x83, 0x34, 0xBB, 0xB1, 0xE7, 0x72,
+    0xEE, 0x4C, 0xA2, 0xDD, 0x44, 0xF9, 0x01, 0x2C, 0xAF, 0x9F, 0xC7, 0xE7, 0xFA, 0xDE, 0xEB, 0x73,
+    0xAE, 0xBD, 0x94, 0x6C, 0x90, 0x0B, 0x29, 0x07, 0x35, 0x6C, 0x14, 0x2D, 0x99, 0x9A, 0xCC, 0x35,
+    0x6F, 0x38, 0xD8, 0x47, 0x83, 0x29, 0x59, 0x7A, 0xC5, 0xFA, 0xD1, 0xA0, 0x38, 0xCC, 0xD8, 0xD3,
+    0x3A, 0xA1, 0x19, 0xE6, 0xA9, 0x13, 0x45, 0x9A, 0x05, 0x4A, 0x3B, 0xCA, 0x3D, 0xA9, 0x96, 0x34,
+    0x36, 0x57, 0xE4, 0x88, 0x98, 0x66, 0x91, 0xD2, 0x20, 0xC6, 0xB4, 0xA0, 0x8C, 0x7D, 0xC1, 0x41,
+    0xFF, 0x1A, 0x75, 0x15, 0xF5, 0x2A, 0x28, 0xEE, 0x52, 0x6E, 0x15, 0xF7, 0xE6, 0xE1, 0x14, 0xC2,
+    0x99, 0xFB, 0x83, 0xE6, 0x90, 0xC3, 0xFF, 0x62, 0xB2, 0x6F, 0x0A, 0xA0, 0x8F, 0x83, 0xA9, 0x06,
+    0x0B, 0xB4, 0x62, 0xF3, 0x1B, 0x6B, 0xE6, 0x2C, 0x0C, 0x12, 0x31, 0x0D, 0xAF, 0x6D, 0xF6, 0x8A,
+    0xBD, 0xE2, 0x6A, 0xBE, 0x41, 0x89, 0xA7, 0xA2, 0x4C, 0x3A, 0x0C, 0x2C, 0x6D, 0x9C, 0x8D, 0x03,
+    0x91, 0x92, 0x05, 0x8F, 0x6C, 0xA4, 0xAD, 0x2F, 0xCA, 0x67, 0xB3, 0x31, 0xAB, 0xA5, 0xBA, 0xDD,
+    0x99, 0xAC, 0xBD, 0x95, 0x37, 0x41, 0xD5, 0xE8, 0x31, 0x6F, 0x96, 0xA9, 0xD7, 0x65, 0xC8, 0x9B,
+    0x75, 0xCA, 0x5A, 0x93, 0xF4, 0xAA, 0xBE, 0x85, 0xDF, 0xD4, 0x4F, 0x7D, 0x29, 0x86, 0xB7, 0xBB,
+    0xE5, 0xBC, 0x4C, 0x5C, 0x93, 0x73, 0x9F, 0x5E, 0x0D, 0x92, 0xCB, 0xC7, 0x51, 0x71, 0x34, 0x4D,
+    0x34, 0x65, 0x34, 0x67, 0xA2, 0xE1, 0xA8, 0x86, 0x53, 0xC9, 0x59, 0x9A, 0x0D, 0xA5, 0xE5, 0x2B,
+    0x07, 0x76, 0xB3, 0x5A, 0x0E, 0xDB, 0x12, 0xF3, 0xC9, 0xB6, 0xAD, 0xC8, 0x96, 0x6F, 0x30, 0x37,
+    0x8E, 0x69, 0xBD, 0x84, 0x41, 0xC1, 0xDE, 0x7C, 0xD3, 0xBB, 0x24, 0x44, 0x8A, 0x53, 0xDF, 0xA1,
+    0x68, 0xDF, 0x0B, 0x9A, 0xBB, 0x9C, 0x1B, 0xDA, 0xA0, 0x4F, 0x69, 0x5B, 0x79, 0x0B, 0xC7, 0x55,
+    0xB1, 0x57, 0xCF, 0x18, 0xDC, 0x82, 0xE1, 0x80, 0x53, 0x55, 0xEA, 0xCF, 0x2E, 0xF7, 0x36, 0xF3,
+    0x60, 0x9D, 0x68, 0x8D, 0xE1, 0xAA, 0x7B, 0xFB, 0x1C, 0xF2, 0x01, 0x3D, 0xEE, 0x99, 0x38, 0xB4,
+    0x03, 0xB2, 0xC1, 0x31, 0x98, 0x86, 0x68, 0x96, 0x8E, 0x75, 0xDD, 0x58, 0xC8, 0xFB, 0x38, 0xC2,
+    0xB5, 0xA5, 0xC1, 0xD2, 0xCE, 0x4B, 0x9D, 0x46, 0xB3, 0xA2, 0xA6, 0xCC, 0x53, 0x12, 0xE4, 0x63,
+    0xBB, 0xA8, 0x5D, 0xE6, 0x91, 0xAA, 0x23, 0xEB, 0xA8, 0xE0, 0x3A, 0xE3, 0x3E, 0xC1, 0x99, 0x6D,
+    0xD6, 0x8D, 0x88, 0x92, 0x3C, 0xEC, 0x8B, 0x8D, 0x2E, 0xE8, 0xC6, 0x5D, 0x7E, 0xCA, 0x7B, 0x7C,
+    0x77, 0x70, 0x07, 0xEE, 0x7C, 0x63, 0x21, 0x26, 0xC5, 0xD9, 0x41, 0x48, 0x7D, 0xFE, 0xD8, 0xAB,
+    0x5A, 0x5F, 0xAB, 0x8D, 0xC4, 0x0B, 0xC7, 0x96, 0x2A, 0x91, 0xE6, 0x82, 0x6E, 0x97, 0x47, 0x09,
+    0xEE, 0xBC, 0x32, 0xC1, 0x8B, 0xBA, 0x59, 0x72, 0x67, 0x77, 0xC3, 0x8B, 0x87, 0x18, 0xEC, 0xE7,
+    0xC1, 0x72, 0x6F, 0x5D, 0x6B, 0xE7, 0x2F, 0x1C, 0x7A, 0x8D, 0x2F, 0xF3, 0x60, 0xAE, 0xDE, 0xE9,
+    0x48, 0xF7, 0xE4, 0xD0, 0x5B, 0x72, 0xEF, 0x64, 0xFB, 0x58, 0xE3, 0x6A, 0x1D, 0x85, 0x41, 0x1D,
+    0x5D, 0x22, 0xFB, 0xB7, 0xE5, 0x6F, 0x0F, 0xB7, 0x22, 0x99, 0x52, 0x35, 0x28, 0x6A, 0x4C, 0xAA,
+    0x9C, 0x2B, 0x6E, 0xE7, 0xE5, 0x58, 0x33, 0xE4, 0x40, 0x70, 0xC1, 0x91, 0x12, 0x29, 0x2B, 0x54,
+    0x17, 0x6A, 0xDD, 0xCF, 0x29, 0x95, 0x8A, 0x52, 0xBD, 0x5C, 0x8C, 0xE6, 0xC4, 0xF6, 0xF7, 0x7C,
+    0x86, 0xF9, 0x61, 0xCC, 0x98, 0x3F, 0xEA, 0x60, 0x6B, 0x5A, 0x5B, 0x13, 0xAF, 0x18, 0x7B, 0x76,
+    0xE3, 0x22, 0x45, 0x29, 0x04, 0x19, 0xFC, 0x0C, 0x43, 0x4D, 0x6F, 0x45, 0x14, 0x7C, 0x31, 0xB2,
+    0x57, 0x93, 0xB8, 0x05, 0xE9, 0xCC, 0xE5, 0x18, 0x84, 0x2C, 0x77, 0x44, 0xF3, 0x04, 0xB1, 0x4F,
+    0x15, 0x00, 0xFD, 0x4D, 0xA2, 0x4D, 0xA8, 0x89, 0x8B, 0xD0, 0x89, 0x8B, 0x06, 0x32, 0x33, 0x26,
+    0x79, 0xAF, 0xE3, 0xCD, 0xD3, 0xC4, 0x0F, 0xDA, 0x2E, 0x63, 0xF5, 0x7E, 0xAD, 0xBB, 0x93, 0x05,
+    0xF1, 0x7D, 0x7F, 0x33, 0xE5, 0xFC, 0x4E, 0xAB, 0xC2, 0x69, 0x55, 0x1A, 0xDF, 0x9D, 0x24, 0xF7,
+    0x60, 0x85, 0xA8, 0xD7, 0x72, 0x88, 0x07, 0x73, 0xC5, 0x2D, 0x2E, 0x09, 0x5F, 0x59, 0x6D, 0x89,
+    0x9B, 0x12, 0x43, 0x1C, 0x3D, 0xCB, 0xE5, 0x2E, 0xA9, 0xBB, 0x44, 0x94, 0xAE, 0x90, 0x57, 0x91,
+    0x57, 0xD3, 0xD1, 0x11, 0x7A, 0x4B, 0xB0, 0xBA, 0x78, 0x76, 0x82, 0x12, 0x25, 0xF0, 0x73, 0x81,
+    0x34, 0x53, 0xD0, 0x40, 0x06, 0xB6, 0xD9, 0x20, 0x14, 0x35, 0xEF, 0xBE, 0xFE, 0x65, 0xCC, 0xF6,
+    0x03, 0xD7, 0xD6, 0xFD, 0x12, 0x32, 0x0E, 0xDC, 0xD8, 0x83, 0x0F, 0x23, 0x40, 0x88, 0x82, 0xD8,
+    0x59, 0x80, 0xB1, 0xAD, 0x53, 0xBE, 0x1B, 0xA8, 0x18, 0xDC, 0x4A, 0xAE, 0x6D, 0x2F, 0x0E, 0x2B,
+    0x10, 0xDA, 0x23, 0x25, 0x78, 0xC1, 0x0D, 0x92, 0x95, 0x5A, 0xB2, 0x7A, 0x7E, 0x54, 0x4C, 0x16,
+    0x8B, 0x52, 0xE2, 0x8C, 0x7C, 0xBF, 0x34, 0xC1, 0x76, 0xF3, 0xDC, 0xCF, 0x34, 0x39, 0x66, 0x03,
+    0x4A, 0x03, 0xD8, 0xE4, 0x7A, 0xCD, 0x1D, 0x5E, 0x7F, 0xC5, 0xF6, 0xA3, 0x03, 0x82, 0x01, 0x28,
+    0x0E, 0x71, 0xE5, 0x99, 0xD0, 0x21, 0xD9, 0x9A, 0x81, 0x0C, 0xD2, 0xB0, 0x99, 0xC1, 0x78, 0x6E,
+    0x0F, 0x16, 0xE4, 0x00, 0xE7, 0x02, 0x9F, 0xE3, 0xAF, 0xCF, 0x8E, 0xD0, 0x67, 0xFC, 0xE4, 0xBB,
+    0x71, 0x45, 0xA0, 0x23, 0xCF, 0xAE, 0x21, 0x29, 0x36, 0x12, 0x28, 0x02, 0xE2, 0xDF, 0x9F, 0x4F,
+    0x1A, 0x3A, 0x6A, 0xE9, 0x14, 0x7F, 0xD6, 0x4F, 0x9F, 0xE3, 0x93, 0xF9, 0x66, 0xE9, 0x2E, 0x92,
+    0xFE, 0x43, 0x8A, 0xB3, 0xCF, 0xE3, 0xF8, 0x66, 0xDD, 0x1E, 0x47, 0xEE, 0x1C, 0xDF, 0xE0, 0x61,
+    0x93, 0xF5, 0x40, 0xF2, 0x1E, 0xDF, 0x63, 0x82, 0x02, 0xE6, 0x1F, 0xAE, 0x32, 0x26, 0x15, 0x50,
+    0xD4, 0x0C, 0x62, 0x75, 0x27, 0x49, 0xF0, 0xBD, 0x48, 0x45, 0x10, 0xB0, 0xCC, 0x47, 0xB0, 0x49,
+    0x27, 0x50, 0x9E, 0x71, 0x01, 0x79, 0x02, 0xDD, 0x04, 0x9A, 0x09, 0xD4, 0x13, 0xA8, 0xF6, 0x44,
+    0x25, 0x79, 0x00, 0xC6, 0x1C, 0xBB, 0xF1, 0x27, 0x99, 0xDE, 0x73, 0xFA, 0x71, 0x1C, 0x73, 0xD4,
+    0x4B, 0x85, 0xE7, 0x08, 0xC7, 0xF6, 0x29, 0x72, 0x69, 0x15, 0x68, 0xA9, 0x4D, 0xAD, 0x1D, 0x96,
+    0x76, 0x6E, 0x61, 0x29, 0x06, 0xE5, 0x37, 0x9F, 0x1E, 0xBA, 0x47, 0x92, 0xF9, 0xAE, 0x0C, 0xB8,
+    0x9C, 0xB0, 0xF2, 0xD1, 0xAC, 0xDC, 0xEE, 0xC0, 0x3F, 0xC9, 0xD2, 0x0D, 0xFC, 0x0D, 0xB9, 0xD7,
+    0x9B, 0xB5, 0xAE, 0x97, 0x0E, 0xFF, 0x3B, 0x86, 0x30, 0x43, 0x7D, 0xC1, 0x0A, 0xDE, 0x74, 0xAD,
+    0xE0, 0x9E, 0x0C, 0x96, 0x10, 0xC5, 0xF2, 0x0F, 0x34, 0x5E, 0x12, 0x14, 0x9D, 0x68, 0x2A, 0xE5,
+    0x56, 0x4C, 0x5F, 0xF6, 0x2F, 0x17, 0x04, 0x2A, 0x0D, 0x52, 0xCD, 0x22, 0xB8, 0x3F, 0x41, 0x45,
+    0x97, 0x70, 0x05, 0xDD, 0x9B, 0x2C, 0xE6, 0x1E, 0x90, 0xEE, 0x4C, 0x9D, 0xC5, 0x44, 0xA8, 0x2C,
+    0x0E, 0xDD, 0x60, 0x39, 0xA2, 0x24, 0xF6, 0x99, 0xFF, 0x45, 0x06, 0x1F, 0xF0, 0x93, 0x2F, 0x98,
+    0x5B, 0x88, 0x5C, 0x1C, 0x7E, 0x45, 0xB9, 0xEC, 0x12, 0xD9, 0x13, 0x51, 0xDF, 0x61, 0xD7, 0xA8,
+    0x7F, 0x21, 0xBE, 0x27, 0xA8, 0x88, 0x9F, 0x08, 0x64, 0x70, 0xD1, 0x45, 0x69, 0x3E, 0x2F, 0x0C,
+    0xB9, 0x38, 0x12, 0x33, 0xA7, 0xFF, 0x55, 0xFB, 0x0F, 0xBD, 0x55, 0x31, 0x73, 0xDD, 0x44, 0x10,
+    0x5E, 0x3D, 0x61, 0x6B, 0x06, 0x15, 0x57, 0x65, 0x86, 0x21, 0x33, 0x88, 0x7F, 0xA0, 0x7F, 0xC0,
+    0x09, 0x67, 0x18, 0x4A, 0xBB, 0xC8, 0x83, 0x22, 0x85, 0x6B, 0x2A, 0xF3, 0x0B, 0xD0, 0xCB, 0xA4,
+    0xA0, 0xC4, 0x05, 0x1D, 0x05, 0x14, 0x14, 0x8C, 0x5D, 0xB8, 0xA1, 0x25, 0x27, 0xDB, 0x3F, 0x00,
+    0x41, 0x30, 0x14, 0x14, 0x11, 0xE3, 0x30, 0x30, 0xA1, 0xC8, 0x41, 0x14, 0xAC, 0x38, 0xD2, 0x7D,
+    0x7C, 0x7B, 0x7A, 0x4E, 0x26, 0x33, 0x34, 0x34, 0x5C, 0x71, 0xFB, 0xF6, 0xDE, 0xEE, 0xDE, 0xDE,
+    0xB7, 0xDF, 0xAE, 0x6A, 0x7C, 0x21, 0x5C, 0x0E, 0x58, 0x8B, 0x66, 0x16, 0x9D, 0x8A, 0x33, 0x78,
+    0x15, 0x8D, 0xF5, 0xF2, 0x41, 0xE5, 0x9A, 0xB2, 0x37, 0x18, 0x5C, 0x53, 0xF4, 0x16, 0x23, 0x35,
+    0xEF, 0x54, 0xB3, 0x1E, 0xC7, 0x5F, 0xBB, 0xEF, 0xD0, 0xA1, 0x8A, 0xEE, 0x0C, 0xA0, 0xC1, 0xD0,
+    0x53, 0x8C, 0x52, 0x83, 0x62, 0x92, 0x02, 0x9D, 0x3B, 0x85, 0xA4, 0x74, 0x38, 0xA1, 0x5D, 0x4D,
+    0x77, 0xDA, 0x99, 0x29, 0x8A, 0x94, 0xA2, 0xEE, 0x2A, 0x15, 0xD6, 0x3F, 0xBD, 0xAE, 0xA1, 0x07,
+    0xE8, 0x0D, 0x66, 0x04, 0xBC, 0x6B, 0xF2, 0xE0, 0xB0, 0xD2, 0xEC, 0x92, 0x1D, 0xB1, 0x2B, 0xD3,
+    0x4B, 0x30, 0x3E, 0x0D, 0x62, 0xEF, 0x8C, 0x09, 0x9A, 0xA2, 0x83, 0xD4, 0x3E, 0xEB, 0xCB, 0xA6,
+    0x1C, 0x17, 0x63, 0xDE, 0xE7, 0x8F, 0x2A, 0x24, 0x53, 0x7A, 0xD1, 0xDA, 0xC6, 0xAE, 0xA6, 0xC1,
+    0x74, 0xA6, 0x7B, 0xCB, 0xA6, 0x43, 0x3A, 0x16, 0x9F, 0x1C, 0x4F, 0x82, 0xFC, 0xBC, 0x77, 0x5B,
+    0xD0, 0x35, 0xB9, 0x28, 0xDE, 0x09, 0xF5, 0xAD, 0x8B, 0xA9, 0xB2, 0xDB, 0xC7, 0x63, 0x10, 0xF3,
+    0x9B, 0xB7, 0xB6, 0x5A, 0x5C, 0x0E, 0xE6, 0x7E, 0x2B, 0xEE, 0x9B, 0xF4, 0x99, 0x67, 0xE6, 0x95,
+    0x1B, 0x99, 0x78, 0x53, 0x06, 0x11, 0xF8, 0x8C, 0x99, 0xD8, 0x41, 0xD0, 0x4A, 0xCE, 0x0C, 0xBC,
+    0x2C, 0x50, 0x99, 0x51, 0x2C, 0xB0, 0x2F, 0xC5, 0x39, 0xC3, 0x75, 0x0B, 0x50, 0xA1, 0xF5, 0x63,
+    0xEE, 0x81, 0x4A, 0xC3, 0xEC, 0xCA, 0xC7, 0xA3, 0x24, 0xD8, 0xA2, 0x72, 0x60, 0x06, 0x2A, 0x85,
+    0x27, 0x0A, 0xF6, 0x18, 0xD9, 0x18, 0x95, 0xFA, 0x3F, 0x2A, 0xE7, 0xAA, 0x9C, 0x06, 0x2A, 0x22,
+    0xF5, 0x3D, 0x2A, 0x62, 0x46, 0x2A, 0x07, 0x47, 0xB8, 0x33, 0x16, 0xBC, 0xD6, 0x53, 0x01, 0xF4,
+    0xC9, 0xDC, 0x15, 0xB7, 0x6B, 0x15, 0xB7, 0x42, 0x7F, 0x66, 0x7C, 0xC4, 0xE6, 0x21, 0x7E, 0x67,
+    0xDE, 0x5A, 0xF0, 0x58, 0xEE, 0xD7, 0x0F, 0x95, 0x02, 0x09, 0x1F, 0xB6, 0xB1, 0x53, 0x77, 0x7C,
+    0x0B, 0x2D, 0x6B, 0x5C, 0x04, 0x7D, 0x15, 0x56, 0x25, 0x0E, 0xD1, 0x19, 0x62, 0x3C, 0xA4, 0x58,
+    0xE5, 0x81, 0x88, 0xD3, 0xB2, 0xF6, 0x62, 0xBB, 0x62, 0x14, 0x33, 0x64, 0x2C, 0x2A, 0x0F, 0x5B,
+    0x1E, 0x12, 0x16, 0x47, 0xCB, 0xAA, 0x1E, 0x16, 0x08, 0x58, 0xBB, 0xA7, 0x08, 0xB6, 0x93, 0x72,
+    0xCA, 0x79, 0xFB, 0x8E, 0xBC, 0xB4, 0x14, 0x2D, 0x35, 0x1A, 0x64, 0x63, 0xB9, 0xBC, 0xC9, 0x83,
+    0x3D, 0x26, 0x57, 0xD3, 0xB1, 0x04, 0xDA, 0x9C, 0x04, 0x48, 0xF0, 0x20, 0xAB, 0x18, 0x95, 0xE8,
+    0x2B, 0x0B, 0x5B, 0x91, 0xDD, 0xB0, 0xDC, 0x31, 0xC4, 0x35, 0xFA, 0x6E, 0xE0, 0x6C, 0xC9, 0x97,
+    0x8B, 0xBC, 0x8A, 0x87, 0x5F, 0xEA, 0xC9, 0xCA, 0x68, 0xB0, 0x7C, 0xA2, 0x31, 0xDF, 0x41, 0x2F,
+    0x3E, 0x9B, 0x55, 0x7B, 0x4D, 0xFF, 0x6B, 0x52, 0x06, 0x14, 0xA3, 0xEF, 0x2D, 0x48, 0x4D, 0xA5,
+    0x12, 0x0D, 0x8B, 0x81, 0x9B, 0xF5, 0xDC, 0xEA, 0x8E, 0x1B, 0x9A, 0x7C, 0x62, 0x41, 0xF3, 0x89,
+    0xEC, 0xCA, 0x27, 0x86, 0xCE, 0xA7, 0xA2, 0xE7, 0xC6, 0x3A, 0xE7, 0x24, 0xA7, 0x14, 0x01, 0x67,
+    0x95, 0xD2, 0xA6, 0x7B, 0xB1, 0xE5, 0xE0, 0x5D, 0xF9, 0x54, 0xFA, 0x2B, 0x0F, 0xC6, 0x61, 0x00,
+    0x88, 0x86, 0x5A, 0xAD, 0x83, 0x12, 0x98, 0xAB, 0x8B, 0xCA, 0xB1, 0xA6, 0xDB, 0x13, 0xA5, 0xDE,
+    0x4F, 0xBA, 0xED, 0x2A, 0x15, 0xAF, 0xBD, 0x8F, 0xE5, 0x4E, 0x7C, 0x8B, 0xD8, 0x3F, 0x99, 0x3A,
+    0x1E, 0xB1, 0x2B, 0x98, 0x2F, 0x13, 0x26, 0xF1, 0x2D, 0xF3, 0x5D, 0x68, 0x5F, 0x5A, 0xBC, 0x21,
+    0x0A, 0x8C, 0xD8, 0x9A, 0xEA, 0x9B, 0xB8, 0x82, 0xA6, 0xA4, 0x65, 0xA6, 0xAD, 0xEA, 0x78, 0xBC,
+    0xB8, 0xE0, 0xD1, 0x62, 0x8E, 0xA5, 0xDD, 0x1B, 0x1B, 0x7A, 0x5E, 0x89, 0xC3, 0x03, 0x95, 0xC4,
+    0x82, 0x04, 0x9E, 0x4B, 0x10, 0x54, 0x16, 0x98, 0x1B, 0x3E, 0xDD, 0x17, 0x37, 0xCD, 0xB6, 0x69,
+    0xF4, 0x4B, 0x50, 0xC5, 0x20, 0x9C, 0x01, 0x11, 0x57, 0x86, 0x4C, 0x62, 0x2F, 0x9A, 0x81, 0x0C,
+    0x50, 0x42, 0x4D, 0x73, 0xDA, 0x84, 0x2D, 0x8D, 0xA1, 0x22, 0x3F, 0x36, 0x2A, 0xBD, 0xDB, 0xB5,
+    0x25, 0xBB, 0x83, 0x86, 0xDE, 0x62, 0xA0, 0x61, 0x31, 0xDA, 0x67, 0x58, 0x40, 0x4C, 0x28, 0x7C,
+    0xD9, 0x12, 0x17, 0x98, 0x3E, 0x1D, 0x88, 0x0A, 0x6E, 0x8C, 0xEC, 0xE9, 0xA1, 0xC4, 0x6D, 0xF2,
+    0xEC, 0x5D, 0xAD, 0x16, 0x27, 0xC1, 0x89, 0x56, 0xD4, 0x06, 0xD7, 0x51, 0x56, 0x46, 0x59, 0xCD,
+    0xE4, 0xD3, 0x10, 0xF3, 0x64, 0x5E, 0x1B, 0x73, 0x9A, 0x6E, 0x35, 0x4B, 0xDB, 0xCE, 0xD2, 0xF8,
+    0x75, 0xFA, 0xE3, 0xFA, 0xC9, 0x41, 0xFE, 0xDD, 0x30, 0x9E, 0x0D, 0x8A, 0xF0, 0xA8, 0x38, 0x0C,
+    0x04, 0xD0, 0x79, 0x29, 0x7B, 0x36, 0x2C, 0x67, 0x58, 0x95, 0x22, 0x65, 0x1D, 0x47, 0xA3, 0x47,
+    0x35, 0x7B, 0xF8, 0x2F, 0x82, 0x8A, 0xFB, 0x3D, 0x2F, 0xD6, 0x81, 0xC5, 0x89, 0xC6, 0x42, 0x78,
+    0xF5, 0x16, 0xF9, 0x90, 0x8D, 0x90, 0xB6, 0xF5, 0x20, 0xC5, 0x29, 0x8F, 0xB0, 0xA7, 0x9C, 0x08,
+    0x68, 0x2C, 0xCE, 0xB1, 0x35, 0x21, 0x0B, 0xE6, 0xA4, 0x37, 0xE3, 0xDD, 0x54, 0x87, 0xE8, 0x2B,
+    0x91, 0xC5, 0x89, 0x12, 0x33, 0x53, 0x38, 0xB5, 0xB2, 0x56, 0x81, 0xD6, 0x32, 0xA4, 0x31, 0xE0,
+    0x53, 0x06, 0xBE, 0xAC, 0xB4, 0x2F, 0xDA, 0xC8, 0x72, 0xAD, 0x15, 0x07, 0x61, 0x8A, 0xDB, 0xEE,
+    0xF2, 0x10, 0x9F, 0x2B, 0x65, 0xFE, 0xC0, 0x43, 0x17, 0x88, 0xBA, 0x6B, 0xAD, 0x5F, 0x60, 0x1B,
+    0x57, 0xAB, 0x98, 0xDE, 0xC3, 0xBE, 0xF5, 0xC5, 0xF4, 0xDC, 0x51, 0x09, 0xCF, 0x1E, 0xBB, 0xFC,
+    0x74, 0xA6, 0x41, 0x24, 0xCB, 0xCB, 0xCC, 0x88, 0x47, 0x4C, 0x49, 0x27, 0x44, 0xA2, 0x13, 0x62,
+    0x13, 0xA1, 0xD2, 0x0E, 0x8C, 0x43, 0x0D, 0x73, 0x13, 0x5B, 0x84, 0xEB, 0x4D, 0x89, 0x62, 0xC5,
+    0x78, 0x59, 0x47, 0xA4, 0x68, 0x49, 0x42, 0x7E, 0xC4, 0x10, 0x2D, 0x0F, 0x6D, 0x9F, 0xFD, 0xBA,
+    0x34, 0x6C, 0x57, 0xDC, 0x63, 0xFD, 0xD0, 0x73, 0x28, 0x63, 0xE2, 0x21, 0xB0, 0x1D, 0x92, 0xA1,
+    0xFE, 0x9E, 0x96, 0x45, 0x5F, 0xF7, 0xC5, 0xC7, 0x13, 0xDD, 0x7F, 0xC1, 0xDB, 0x78, 0x32, 0x28,
+    0x35, 0x80, 0x5E, 0x73, 0x9C, 0xF4, 0xB6, 0xF8, 0xED, 0xE0, 0xC5, 0x72, 0x37, 0xD2, 0x51, 0x6B,
+    0xB5, 0xB9, 0x1F, 0xE9, 0xD4, 0x45, 0x7A, 0x46, 0x86, 0xF5, 0x9A, 0xB8, 0xB2, 0x2F, 0xD3, 0x9A,
+    0x89, 0x53, 0x2C, 0xCD, 0xDF, 0x41, 0x01, 0xE5, 0x0C, 0xE4, 0x9B, 0xD8, 0xBA, 0x2F, 0x26, 0xFB,
+    0x8F, 0x47, 0xE1, 0x10, 0x5F, 0x09, 0xB3, 0xEF, 0xA4, 0xE8, 0x17, 0xFA, 0x1D, 0xE2, 0xFA, 0x39,
+    0x1A, 0xDC, 0x0A, 0xCB, 0xDD, 0x50, 0xF1, 0xFD, 0x75, 0x6B, 0x74, 0xB8, 0x6B, 0x45, 0xC8, 0x52,
+    0xCF, 0x48, 0x37, 0xA0, 0x10, 0xE9, 0xFC, 0xC0, 0xB7, 0xBC, 0x65, 0x66, 0xBD, 0x76, 0xCE, 0xFC,
+    0x75, 0x5B, 0xAC, 0x67, 0x09, 0x87, 0xCD, 0x0F, 0xF9, 0x73, 0x38, 0x4B, 0x4D, 0x0D, 0xC7, 0x07,
+    0x07, 0x87, 0xF8, 0x4C, 0x2F, 0x38, 0x8A, 0x8D, 0x55, 0x42, 0x63, 0xA3, 0xDA, 0x74, 0xB8, 0x3C,
+    0xD8, 0xD3, 0x23, 0x4D, 0x61, 0x50, 0xEC, 0x63, 0x13, 0xCD, 0xE5, 0x08, 0x92, 0x35, 0xE5, 0x1A,
+    0x6A, 0xFD, 0x5E, 0x92, 0x05, 0xA5, 0xF2, 0x2B, 0xB9, 0x29, 0xFF, 0xC7, 0xFA, 0x07, 0x8D, 0x55,
+    0x31, 0x8B, 0x24, 0x45, 0x14, 0x7E, 0xDD, 0xAD, 0xDB, 0x70, 0x8D, 0xD4, 0x06, 0x7B, 0x81, 0x18,
+    0x74, 0x7A, 0x2A, 0xD8, 0x89, 0x89, 0xE0, 0x4E, 0x35, 0x26, 0x06, 0x97, 0x6C, 0xB0, 0xC3, 0x06,
+    0x1B, 0x5C, 0x64, 0xA2, 0x81, 0xA9, 0x88, 0xDA, 0x03, 0x86, 0x06, 0xFA, 0x13, 0x0E, 0x3C, 0xE1,
+    0x98, 0x4B, 0x0C, 0x37, 0x38, 0xAC, 0x3E, 0x0C, 0x0E, 0x23, 0x47, 0x05, 0x27, 0xB4, 0x85, 0x83,
+    0x03, 0x0D, 0xB6, 0x60, 0xFB, 0xA4, 0x77, 0xAF, 0x7A, 0x9E, 0xDF, 0x7B, 0x35, 0x33, 0xCC, 0x6A,
+    0x72, 0x0D, 0xFD, 0xBD, 0xA9, 0x7A, 0x55, 0xAF, 0xDF, 0xFB, 0xDE, 0x57, 0x35, 0x44, 0x49, 0x4D,
+    0x44, 0x79, 0x47, 0x94, 0xB8, 0x55, 0x4D, 0x86, 0x79, 0xA0, 0x06, 0x90, 0x30, 0x73, 0x9F, 0xF1,
+    0xDF, 0x4F, 0x7D, 0xC1, 0xEF, 0x77, 0xFB, 0x66, 0x85, 0x25, 0x65, 0x00, 0x54, 0x03, 0xC0, 0xF6,
+    0x5B, 0xF0, 0xD7, 0x41, 0xE7, 0x64, 0x49, 0x15, 0x36, 0x3B, 0x0C, 0x03, 0x72, 0x5E, 0xFE, 0xF9,
+    0x7D, 0x86, 0xA0, 0x9E, 0x14, 0x2A, 0x81, 0x3D, 0xE6, 0x6F, 0x88, 0x8A, 0x6E, 0x9D, 0x01, 0xED,
+    0x61, 0xA4, 0x4F, 0x12, 0xC8, 0xC1, 0xE1, 0xB3, 0x40, 0x64, 0xDB, 0xD2, 0x53, 0xC2, 0xB5, 0x6B,
+    0x65, 0x13, 0xF3, 0x8F, 0x02, 0x6C, 0x04, 0xC2, 0x9B, 0x3C, 0xE7, 0xBF, 0xEE, 0x9A, 0x90, 0x31,
+    0xD6, 0x79, 0x83, 0xD5, 0xDC, 0x5A, 0x4F, 0x18, 0x72, 0x4B, 0x2F, 0x36, 0xBD, 0x7A, 0x88, 0xA1,
+    0x63, 0x19, 0xB2, 0xAE, 0x72, 0x2B, 0xC9, 0xE0, 0x26, 0x6D, 0x1E, 0xE5, 0x85, 0x0A, 0x21, 0x86,
+    0xAC, 0x62, 0x23, 0xB9, 0x13, 0x4B, 0xBD, 0x12, 0x90, 0xFE, 0x83, 0x5E, 0x30, 0x46, 0xB1, 0x2C,
+    0x65, 0x19, 0x1E, 0x81, 0x29, 0xAB, 0xBF, 0x51, 0x7F, 0xCA, 0xBD, 0xF8, 0x9B, 0x70, 0xE3, 0xBD,
+    0x7B, 0x1F, 0x9A, 0x60, 0xCF, 0x57, 0xFC, 0x38, 0x7C, 0x3A, 0x36, 0x5F, 0x3D, 0x0E, 0xEF, 0xF4,
+    0x55, 0xB6, 0x1C, 0x2A, 0xE0, 0x79, 0x5F, 0xB0, 0xCB, 0xB9, 0x93, 0x5E, 0xF0, 0x8C, 0xAE, 0xF4,
+    0xE3, 0x7D, 0x75, 0xB2, 0x10, 0xCC, 0x80, 0x77, 0x5F, 0x4D, 0x67, 0x92, 0x13, 0x3F, 0x93, 0x15,
+    0x4B, 0x81, 0x3B, 0x78, 0xC7, 0x9B, 0xD3, 0xE9, 0xF4, 0x68, 0x5B, 0x40, 0x29, 0x53, 0xCD, 0xB5,
+    0x55, 0xB5, 0xE6, 0x2A, 0x3C, 0x90, 0xD0, 0x00, 0x36, 0xD6, 0xE9, 0xBF, 0xD0, 0x94, 0x03, 0xF3,
+    0xC2, 0xFE, 0x9C, 0xAF, 0xEE, 0x43, 0x0F, 0xEA, 0x9D, 0x9E, 0xAE, 0x8E, 0x79, 0x3D, 0x4F, 0xC5,
+    0x18, 0x77, 0x34, 0x03, 0xC5, 0x86, 0xCF, 0x48, 0x79, 0xC3, 0x7E, 0x5D, 0x3E, 0x0A, 0x9F, 0x12,
+    0x79, 0x86, 0xC6, 0xB6, 0x91, 0xB2, 0x06, 0x84, 0x54, 0x41, 0xC8, 0xC2, 0x1C, 0xBE, 0x23, 0x31,
+    0xA8, 0x12, 0x96, 0xDC, 0xAF, 0xBD, 0x90, 0xB7, 0xC0, 0x9E, 0x15, 0x7C, 0xE8, 0x86, 0xC5, 0x00,
+    0x51, 0x6F, 0x2F, 0xD2, 0xDB, 0x52, 0x4B, 0x85, 0xE0, 0x39, 0x5F, 0xCA, 0x54, 0x7D, 0xE3, 0x5B,
+    0x90, 0xDD, 0xFC, 0x54, 0xF5, 0x08, 0xE2, 0x16, 0x45, 0x48, 0xB9, 0xB6, 0x5D, 0x31, 0x42, 0x3F,
+    0x55, 0x8F, 0x94, 0xDC, 0x2F, 0xBC, 0x40, 0x2C, 0x96, 0x7E, 0x8A, 0x08, 0xD1, 0x25, 0x87, 0x2C,
+    0x76, 0xDA, 0x4D, 0xE5, 0x20, 0x98, 0x5E, 0x49, 0xC5, 0x64, 0x52, 0xED, 0xD3, 0x59, 0xA6, 0x4D,
+    0xF3, 0x46, 0x3A, 0x58, 0x5C, 0xB9, 0xF9, 0xFC, 0x3B, 0xA5, 0x15, 0x95, 0x59, 0x35, 0x6D, 0x34,
+    0xB3, 0xD7, 0xD4, 0x10, 0x61, 0x73, 0x32, 0x52, 0xE6, 0x5F, 0x42, 0xAB, 0xC8, 0x3C, 0xEA, 0x3F,
+    0x41, 0xBB, 0x6C, 0xF5, 0x7C, 0x30, 0x48, 0xF2, 0x39, 0x8F, 0x01, 0xB5, 0xE7, 0xFF, 0xA0, 0x0A,
+    0xE3, 0xF3, 0xE4, 0x6C, 0xA3, 0x9C, 0x32, 0x9A, 0xCF, 0xDC, 0x93, 0x44, 0x0E, 0x82, 0x36, 0x1D,
+    0x05, 0xB3, 0x4A, 0x49, 0x9B, 0x2F, 0xF2, 0x59, 0xA8, 0x28, 0x6B, 0x4D, 0x52, 0x3D, 0x54, 0x68,
+    0xAA, 0x54, 0xA9, 0xF0, 0xC8, 0x69, 0x90, 0x94, 0x77, 0x5D, 0x42, 0x2E, 0x84, 0xCC, 0x22, 0x47,
+    0xC9, 0x54, 0xF8, 0x52, 0xA3, 0x69, 0x0F, 0x19, 0x2F, 0x5C, 0xEB, 0x7C, 0x09, 0xB6, 0xC8, 0x75,
+    0xAE, 0xC5, 0x2E, 0x1C, 0x33, 0x04, 0x4C, 0xD9, 0x0C, 0x08, 0x98, 0x8F, 0xB6, 0x83, 0xAB, 0x7C,
+    0xC6, 0x35, 0x5C, 0xCD, 0x72, 0xA4, 0x97, 0x8F, 0x12, 0xBE, 0x23, 0x41, 0xF3, 0xB1, 0x91, 0x84,
+    0xC4, 0x25, 0xDF, 0x59, 0x4A, 0xD7, 0xB6, 0x2E, 0x9C, 0xF7, 0x7B, 0x24, 0x87, 0x7E, 0x26, 0xD0,
+    0x65, 0xF1, 0x4E, 0x99, 0x3A, 0x39, 0x81, 0x25, 0xBC, 0x50, 0x02, 0xA0, 0xD8, 0xFE, 0xAA, 0xC2,
+    0x47, 0x38, 0xD0, 0x83, 0x93, 0x1B, 0x42, 0x60, 0xE1, 0xA4, 0x78, 0xCC, 0x1D, 0x45, 0x15, 0x2A,
+    0x38, 0x8E, 0x12, 0x5C, 0xC3, 0x09, 0x4F, 0xEB, 0x1D, 0x6F, 0x16, 0xEB, 0xBE, 0xF5, 0xBA, 0xE0,
+    0xE1, 0x44, 0xF0, 0x8B, 0x1F, 0x24, 0x99, 0x4D, 0xED, 0xA3, 0x12, 0x2B, 0x19, 0x8D, 0x90, 0x51,
+    0xC1, 0x9F, 0x4F, 0x1C, 0xCE, 0xFE, 0xE1, 0xC4, 0x0E, 0xD5, 0x70, 0x38, 0x29, 0x83, 0xED, 0x0F,
+    0x27, 0x38, 0x90, 0x1E, 0x38, 0x0A, 0x16, 0x11, 0x57, 0xD6, 0x1F, 0x1C, 0x24, 0xC7, 0x7A, 0x04,
+    0xA2, 0x2C, 0xD7, 0x42, 0xD1, 0x93, 0x81, 0xF0, 0x91, 0x74, 0xE5, 0xBE, 0xB9, 0x94, 0xBB, 0x4C,
+    0xBE, 0xE2, 0xCD, 0xFF, 0x50, 0xBB, 0xF2, 0x65, 0x4B, 0x6F, 0x41, 0x0A, 0x67, 0xEF, 0x92, 0x32,
+    0xC2, 0x01, 0x3E, 0xA4, 0x83, 0xE3, 0xF3, 0x3B, 0x5F, 0xE0, 0x96, 0xFA, 0x03, 0x0C, 0x35, 0xDE,
+    0x8C, 0xD0, 0xD5, 0x05, 0x9F, 0xF0, 0xD7, 0xF0, 0xC0, 0xDB, 0x62, 0xFF, 0x6F, 0xFC, 0x80, 0x7F,
+    0x86, 0xD7, 0x79, 0x54, 0xD4, 0x42, 0x83, 0x50, 0x04, 0xDA, 0xC6, 0xBE, 0x5A, 0xC1, 0x7B, 0x81,
+    0x17, 0x8B, 0x7B, 0x0B, 0xDA, 0xD2, 0xCE, 0x6F, 0x3F, 0xB4, 0x7F, 0x80, 0xAE, 0x7C, 0x20, 0xEA,
+    0x19, 0xB0, 0x36, 0x40, 0xFC, 0x7D, 0xC9, 0x0F, 0xBC, 0x0D, 0xB4, 0x2F, 0x15, 0xC9, 0xC1, 0x74,
+    0xDD, 0xF5, 0x57, 0xE6, 0x2C, 0xEA, 0xB4, 0x23, 0xDD, 0x2A, 0xF9, 0x7C, 0x90, 0x0B, 0x30, 0x15,
+    0xC9, 0x7C, 0x2C, 0x44, 0x1E, 0x2B, 0xCB, 0xB8, 0x67, 0x8E, 0x71, 0xB1, 0x84, 0xCD, 0xFB, 0xC6,
+    0x7C, 0x3E, 0x97, 0x0B, 0xE8, 0x29, 0xDE, 0x4B, 0x5E, 0x0B, 0x77, 0xF7, 0x79, 0x65, 0x6D, 0xC7,
+    0x68, 0xCC, 0xDA, 0x72, 0xB4, 0x66, 0x6D, 0x39, 0x5A, 0xF3, 0x64, 0x4F, 0xED, 0x10, 0xD7, 0x9B,
+    0x2E, 0x5A, 0x7E, 0x74, 0x3F, 0x93, 0xFB, 0x85, 0x5D, 0x5F, 0xC4, 0x66, 0x76, 0xD5, 0x28, 0x7F,
+    0x5C, 0x2C, 0x71, 0x84, 0xE2, 0x9C, 0x47, 0x1D, 0x36, 0xCA, 0xA9, 0x10, 0x05, 0x42, 0x78, 0x06,
+    0xB9, 0xD4, 0x96, 0x45, 0x94, 0x3D, 0x84, 0x00, 0x02, 0xB8, 0x8E, 0xFA, 0xEF, 0xE3, 0xA1, 0x10,
+    0x05, 0x5B, 0x3E, 0xD5, 0x9B, 0x19, 0x7F, 0x0F, 0x2A, 0x68, 0xDB, 0xC6, 0x5E, 0x5B, 0xD2, 0x21,
+    0xD9, 0x53, 0x1D, 0x62, 0x5D, 0x1D, 0x6D, 0x1C, 0x92, 0x8D, 0x43, 0x7A, 0x7B, 0xA7, 0xD8, 0x7F,
+    0x01,
+};
+
+static const uint32_t notosans_16_boldBlockOffsets[46] = {
+    0, 1109, 2107, 3015, 3936, 5075, 6005, 6607,
+    7179, 7959, 8636, 9409, 10200, 10910, 11610, 12262,
+    13108, 13836, 14365, 15182, 16440, 17343, 18147, 18914,
+    19868, 20760, 21688, 22763, 23638, 24620, 25543, 26512,
+    27406, 28118, 28947, 29779, 30742, 31625, 32445, 33404,
+    34522, 35432, 36304, 37433, 38558, 39537,
+};
+
+static const uint16_t notosans_16_boldDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_16_boldGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_16_boldPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 0,
 };
 
 static const EpdGlyph notosans_16_boldGlyphs[] = {
@@ -5587,857 +2661,857 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 17, 25, 19, 1, 24, 107, 1617 }, // 5
     { 17, 26, 19, 1, 25, 111, 1724 }, // 6
     { 18, 24, 19, 0, 24, 108, 1835 }, // 7
-    { 17, 26, 19, 1, 25, 111, 1943 }, // 8
-    { 17, 26, 19, 1, 25, 111, 2054 }, // 9
-    { 7, 20, 9, 1, 19, 35, 2165 }, // :
-    { 7, 24, 10, 1, 19, 42, 2200 }, // ;
-    { 17, 18, 19, 1, 21, 77, 2242 }, // <
-    { 17, 11, 19, 1, 17, 47, 2319 }, // =
-    { 17, 18, 19, 1, 21, 77, 2366 }, // >
-    { 16, 26, 16, 0, 25, 104, 2443 }, // ?
-    { 28, 27, 30, 1, 24, 189, 2547 }, // @
-    { 24, 24, 23, 0, 24, 144, 2736 }, // A
-    { 19, 24, 22, 2, 24, 114, 2880 }, // B
-    { 20, 26, 21, 1, 25, 130, 2994 }, // C
-    { 21, 24, 24, 2, 24, 126, 3124 }, // D
-    { 14, 24, 19, 3, 24, 84, 3250 }, // E
-    { 14, 24, 18, 3, 24, 84, 3334 }, // F
-    { 21, 26, 24, 1, 25, 137, 3418 }, // G
-    { 20, 24, 26, 3, 24, 120, 3555 }, // H
-    { 11, 24, 13, 1, 24, 66, 3675 }, // I
-    { 12, 31, 11, -3, 24, 93, 3741 }, // J
-    { 20, 24, 22, 3, 24, 120, 3834 }, // K
-    { 16, 24, 19, 2, 24, 96, 3954 }, // L
-    { 26, 24, 31, 3, 24, 156, 4050 }, // M
-    { 22, 24, 27, 3, 24, 132, 4206 }, // N
-    { 24, 26, 26, 1, 25, 156, 4338 }, // O
-    { 18, 24, 21, 2, 24, 108, 4494 }, // P
-    { 24, 31, 26, 1, 25, 186, 4602 }, // Q
-    { 20, 24, 22, 2, 24, 120, 4788 }, // R
-    { 17, 26, 18, 1, 25, 111, 4908 }, // S
-    { 19, 24, 19, 0, 24, 114, 5019 }, // T
-    { 21, 25, 25, 2, 24, 132, 5133 }, // U
-    { 22, 24, 22, 0, 24, 132, 5265 }, // V
-    { 33, 24, 32, 0, 24, 198, 5397 }, // W
-    { 23, 24, 22, 0, 24, 138, 5595 }, // X
-    { 21, 24, 21, 0, 24, 126, 5733 }, // Y
-    { 19, 24, 19, 0, 24, 114, 5859 }, // Z
-    { 9, 30, 11, 2, 24, 68, 5973 }, // [
-    { 14, 25, 14, 0, 24, 88, 6041 }, // <backslash>
-    { 9, 30, 11, 0, 24, 68, 6129 }, // ]
-    { 19, 16, 19, 0, 24, 76, 6197 }, // ^
-    { 15, 3, 14, -1, -3, 12, 6273 }, // _
-    { 10, 6, 12, 1, 26, 15, 6285 }, // `
-    { 17, 20, 20, 1, 19, 85, 6300 }, // a
-    { 18, 27, 21, 2, 26, 122, 6385 }, // b
-    { 16, 20, 17, 1, 19, 80, 6507 }, // c
-    { 18, 27, 21, 1, 26, 122, 6587 }, // d
-    { 18, 20, 20, 1, 19, 90, 6709 }, // e
-    { 15, 26, 13, 0, 26, 98, 6799 }, // f
-    { 18, 27, 21, 1, 19, 122, 6897 }, // g
-    { 18, 26, 22, 2, 26, 117, 7019 }, // h
-    { 6, 26, 10, 2, 26, 39, 7136 }, // i
-    { 10, 34, 10, -2, 26, 85, 7175 }, // j
-    { 19, 26, 21, 2, 26, 124, 7260 }, // k
-    { 6, 26, 10, 2, 26, 39, 7384 }, // l
-    { 29, 19, 33, 2, 19, 138, 7423 }, // m
-    { 18, 19, 22, 2, 19, 86, 7561 }, // n
-    { 19, 20, 21, 1, 19, 95, 7647 }, // o
-    { 18, 27, 21, 2, 19, 122, 7742 }, // p
-    { 18, 27, 21, 1, 19, 122, 7864 }, // q
-    { 13, 19, 15, 2, 19, 62, 7986 }, // r
-    { 15, 20, 17, 1, 19, 75, 8048 }, // s
-    { 14, 24, 14, 0, 23, 84, 8123 }, // t
-    { 18, 20, 22, 2, 19, 90, 8207 }, // u
-    { 20, 19, 19, 0, 19, 95, 8297 }, // v
-    { 29, 19, 29, 0, 19, 138, 8392 }, // w
-    { 20, 19, 19, 0, 19, 95, 8530 }, // x
-    { 20, 27, 19, 0, 19, 135, 8625 }, // y
-    { 15, 19, 16, 1, 19, 72, 8760 }, // z
-    { 12, 30, 13, 0, 24, 90, 8832 }, // {
-    { 4, 34, 18, 7, 26, 34, 8922 }, // |
-    { 12, 30, 13, 1, 24, 90, 8956 }, // }
-    { 17, 7, 19, 1, 15, 30, 9046 }, // ~
-    { 0, 0, 9, 0, 0, 0, 9076 }, //  
-    { 7, 25, 10, 1, 19, 44, 9076 }, // ¡
-    { 15, 26, 19, 2, 25, 98, 9120 }, // ¢
-    { 18, 25, 19, 1, 25, 113, 9218 }, // £
-    { 17, 16, 19, 1, 20, 68, 9331 }, // ¤
-    { 19, 24, 19, 0, 24, 114, 9399 }, // ¥
-    { 4, 34, 18, 7, 26, 34, 9513 }, // ¦
-    { 14, 27, 16, 1, 26, 95, 9547 }, // §
-    { 12, 6, 20, 4, 26, 18, 9642 }, // ¨
-    { 26, 26, 28, 1, 25, 169, 9660 }, // ©
-    { 12, 13, 13, 0, 25, 39, 9829 }, // ª
-    { 19, 16, 20, 1, 17, 76, 9868 }, // «
-    { 17, 10, 19, 1, 14, 43, 9944 }, // ¬
-    { 10, 5, 11, 0, 11, 13, 9987 }, // ­
-    { 26, 26, 28, 1, 25, 169, 10000 }, // ®
-    { 18, 4, 17, -1, 29, 18, 10169 }, // ¯
-    { 12, 13, 14, 1, 25, 39, 10187 }, // °
-    { 17, 21, 19, 1, 21, 90, 10226 }, // ±
-    { 12, 16, 13, 0, 29, 48, 10316 }, // ²
-    { 12, 16, 13, 0, 29, 48, 10364 }, // ³
-    { 10, 6, 12, 1, 26, 15, 10412 }, // ´
-    { 18, 27, 22, 2, 19, 122, 10427 }, // µ
-    { 18, 31, 22, 1, 26, 140, 10549 }, // ¶
-    { 7, 7, 9, 1, 15, 13, 10689 }, // ·
-    { 9, 8, 9, 0, 0, 18, 10702 }, // ¸
-    { 9, 16, 13, 1, 29, 36, 10720 }, // ¹
-    { 12, 13, 13, 0, 25, 39, 10756 }, // º
-    { 19, 16, 20, 1, 17, 76, 10795 }, // »
-    { 28, 24, 28, 0, 24, 168, 10871 }, // ¼
-    { 28, 24, 29, 0, 24, 168, 11039 }, // ½
-    { 27, 25, 28, 1, 25, 169, 11207 }, // ¾
-    { 16, 25, 16, 0, 19, 100, 11376 }, // ¿
-    { 24, 32, 23, 0, 32, 192, 11476 }, // À
-    { 24, 32, 23, 0, 32, 192, 11668 }, // Á
-    { 24, 32, 23, 0, 32, 192, 11860 }, // Â
-    { 24, 32, 23, 0, 32, 192, 12052 }, // Ã
-    { 24, 32, 23, 0, 32, 192, 12244 }, // Ä
-    { 24, 29, 23, 0, 29, 174, 12436 }, // Å
-    { 30, 24, 32, 0, 24, 180, 12610 }, // Æ
-    { 20, 33, 21, 1, 25, 165, 12790 }, // Ç
-    { 14, 32, 19, 3, 32, 112, 12955 }, // È
-    { 14, 32, 19, 3, 32, 112, 13067 }, // É
-    { 14, 32, 19, 3, 32, 112, 13179 }, // Ê
-    { 14, 32, 19, 3, 32, 112, 13291 }, // Ë
-    { 12, 32, 13, 0, 32, 96, 13403 }, // Ì
-    { 12, 32, 13, 1, 32, 96, 13499 }, // Í
-    { 15, 32, 13, -1, 32, 120, 13595 }, // Î
-    { 13, 32, 13, 0, 32, 104, 13715 }, // Ï
-    { 23, 24, 24, 0, 24, 138, 13819 }, // Ð
-    { 22, 32, 27, 3, 32, 176, 13957 }, // Ñ
-    { 24, 33, 26, 1, 32, 198, 14133 }, // Ò
-    { 24, 33, 26, 1, 32, 198, 14331 }, // Ó
-    { 24, 33, 26, 1, 32, 198, 14529 }, // Ô
-    { 24, 33, 26, 1, 32, 198, 14727 }, // Õ
-    { 24, 33, 26, 1, 32, 198, 14925 }, // Ö
-    { 15, 16, 19, 2, 20, 60, 15123 }, // ×
-    { 24, 28, 26, 1, 26, 168, 15183 }, // Ø
-    { 21, 33, 25, 2, 32, 174, 15351 }, // Ù
-    { 21, 33, 25, 2, 32, 174, 15525 }, // Ú
-    { 21, 33, 25, 2, 32, 174, 15699 }, // Û
-    { 21, 33, 25, 2, 32, 174, 15873 }, // Ü
-    { 21, 32, 21, 0, 32, 168, 16047 }, // Ý
-    { 17, 24, 21, 3, 24, 102, 16215 }, // Þ
-    { 21, 27, 23, 2, 26, 142, 16317 }, // ß
-    { 17, 27, 20, 1, 26, 115, 16459 }, // à
-    { 17, 27, 20, 1, 26, 115, 16574 }, // á
-    { 17, 27, 20, 1, 26, 115, 16689 }, // â
-    { 17, 27, 20, 1, 26, 115, 16804 }, // ã
-    { 17, 27, 20, 1, 26, 115, 16919 }, // ä
-    { 17, 29, 20, 1, 28, 124, 17034 }, // å
-    { 29, 20, 31, 1, 19, 145, 17158 }, // æ
-    { 16, 27, 17, 1, 19, 108, 17303 }, // ç
-    { 18, 27, 20, 1, 26, 122, 17411 }, // è
-    { 18, 27, 20, 1, 26, 122, 17533 }, // é
-    { 18, 27, 20, 1, 26, 122, 17655 }, // ê
-    { 18, 27, 20, 1, 26, 122, 17777 }, // ë
-    { 11, 26, 10, -1, 26, 72, 17899 }, // ì
-    { 10, 26, 10, 2, 26, 65, 17971 }, // í
-    { 14, 26, 10, -2, 26, 91, 18036 }, // î
-    { 12, 26, 10, -1, 26, 78, 18127 }, // ï
-    { 19, 27, 21, 1, 26, 129, 18205 }, // ð
-    { 18, 26, 22, 2, 26, 117, 18334 }, // ñ
-    { 19, 27, 21, 1, 26, 129, 18451 }, // ò
-    { 19, 27, 21, 1, 26, 129, 18580 }, // ó
-    { 19, 27, 21, 1, 26, 129, 18709 }, // ô
-    { 19, 27, 21, 1, 26, 129, 18838 }, // õ
-    { 19, 27, 21, 1, 26, 129, 18967 }, // ö
-    { 17, 17, 19, 1, 20, 73, 19096 }, // ÷
-    { 19, 22, 21, 1, 20, 105, 19169 }, // ø
-    { 18, 27, 22, 2, 26, 122, 19274 }, // ù
-    { 18, 27, 22, 2, 26, 122, 19396 }, // ú
-    { 18, 27, 22, 2, 26, 122, 19518 }, // û
-    { 18, 27, 22, 2, 26, 122, 19640 }, // ü
-    { 20, 34, 19, 0, 26, 170, 19762 }, // ý
-    { 18, 34, 21, 2, 26, 153, 19932 }, // þ
-    { 20, 34, 19, 0, 26, 170, 20085 }, // ÿ
-    { 24, 30, 23, 0, 30, 180, 20255 }, // Ā
-    { 17, 25, 20, 1, 24, 107, 20435 }, // ā
-    { 24, 32, 23, 0, 32, 192, 20542 }, // Ă
-    { 17, 27, 20, 1, 26, 115, 20734 }, // ă
-    { 24, 32, 23, 0, 24, 192, 20849 }, // Ą
-    { 17, 27, 20, 1, 19, 115, 21041 }, // ą
-    { 20, 33, 21, 1, 32, 165, 21156 }, // Ć
-    { 16, 27, 17, 1, 26, 108, 21321 }, // ć
-    { 20, 33, 21, 1, 32, 165, 21429 }, // Ĉ
-    { 16, 27, 17, 1, 26, 108, 21594 }, // ĉ
-    { 20, 33, 21, 1, 32, 165, 21702 }, // Ċ
-    { 16, 27, 17, 1, 26, 108, 21867 }, // ċ
-    { 20, 33, 21, 1, 32, 165, 21975 }, // Č
-    { 17, 27, 17, 1, 26, 115, 22140 }, // č
-    { 21, 32, 24, 2, 32, 168, 22255 }, // Ď
-    { 25, 27, 21, 1, 26, 169, 22423 }, // ď
-    { 23, 24, 24, 0, 24, 138, 22592 }, // Đ
-    { 21, 27, 22, 1, 26, 142, 22730 }, // đ
-    { 14, 30, 19, 3, 30, 105, 22872 }, // Ē
-    { 18, 25, 20, 1, 24, 113, 22977 }, // ē
-    { 14, 32, 19, 3, 32, 112, 23090 }, // Ĕ
-    { 18, 27, 20, 1, 26, 122, 23202 }, // ĕ
-    { 14, 32, 19, 3, 32, 112, 23324 }, // Ė
-    { 18, 27, 20, 1, 26, 122, 23436 }, // ė
-    { 14, 32, 19, 3, 24, 112, 23558 }, // Ę
-    { 18, 27, 20, 1, 19, 122, 23670 }, // ę
-    { 15, 32, 19, 3, 32, 120, 23792 }, // Ě
-    { 18, 27, 20, 1, 26, 122, 23912 }, // ě
-    { 21, 33, 24, 1, 32, 174, 24034 }, // Ĝ
-    { 18, 34, 21, 1, 26, 153, 24208 }, // ĝ
-    { 21, 33, 24, 1, 32, 174, 24361 }, // Ğ
-    { 18, 34, 21, 1, 26, 153, 24535 }, // ğ
-    { 21, 33, 24, 1, 32, 174, 24688 }, // Ġ
-    { 18, 34, 21, 1, 26, 153, 24862 }, // ġ
-    { 21, 33, 24, 1, 25, 174, 25015 }, // Ģ
-    { 18, 34, 21, 1, 26, 153, 25189 }, // ģ
-    { 20, 32, 26, 3, 32, 160, 25342 }, // Ĥ
-    { 22, 33, 22, -2, 33, 182, 25502 }, // ĥ
-    { 26, 24, 26, 0, 24, 156, 25684 }, // Ħ
-    { 20, 26, 22, 0, 26, 130, 25840 }, // ħ
-    { 15, 32, 13, -2, 32, 120, 25970 }, // Ĩ
-    { 14, 26, 10, -2, 26, 91, 26090 }, // ĩ
-    { 12, 30, 13, 0, 30, 90, 26181 }, // Ī
-    { 12, 24, 10, -1, 24, 72, 26271 }, // ī
-    { 14, 32, 13, 0, 32, 112, 26343 }, // Ĭ
-    { 14, 26, 10, -2, 26, 91, 26455 }, // ĭ
-    { 11, 32, 13, 1, 24, 88, 26546 }, // Į
-    { 7, 34, 10, 1, 26, 60, 26634 }, // į
-    { 11, 32, 13, 1, 32, 88, 26694 }, // İ
-    { 6, 19, 10, 2, 19, 29, 26782 }, // ı
-    { 21, 31, 24, 1, 24, 163, 26811 }, // Ĳ
-    { 16, 34, 20, 2, 26, 136, 26974 }, // ĳ
-    { 16, 39, 11, -3, 32, 156, 27110 }, // Ĵ
-    { 14, 34, 10, -2, 26, 119, 27266 }, // ĵ
-    { 20, 32, 22, 3, 24, 160, 27385 }, // Ķ
-    { 19, 34, 21, 2, 26, 162, 27545 }, // ķ
-    { 19, 19, 21, 2, 19, 91, 27707 }, // ĸ
-    { 16, 32, 19, 2, 32, 128, 27798 }, // Ĺ
-    { 10, 33, 10, 2, 33, 83, 27926 }, // ĺ
-    { 16, 32, 19, 2, 24, 128, 28009 }, // Ļ
-    { 6, 34, 10, 2, 26, 51, 28137 }, // ļ
-    { 17, 24, 19, 2, 24, 102, 28188 }, // Ľ
-    { 13, 26, 10, 2, 26, 85, 28290 }, // ľ
-    { 16, 24, 19, 2, 24, 96, 28375 }, // Ŀ
-    { 12, 26, 12, 2, 26, 78, 28471 }, // ŀ
-    { 18, 24, 19, 0, 24, 108, 28549 }, // Ł
-    { 12, 26, 10, -1, 26, 78, 28657 }, // ł
-    { 22, 32, 27, 3, 32, 176, 28735 }, // Ń
-    { 18, 26, 22, 2, 26, 117, 28911 }, // ń
-    { 22, 32, 27, 3, 24, 176, 29028 }, // Ņ
-    { 18, 27, 22, 2, 19, 122, 29204 }, // ņ
-    { 22, 32, 27, 3, 32, 176, 29326 }, // Ň
-    { 18, 26, 22, 2, 26, 117, 29502 }, // ň
-    { 25, 24, 26, -1, 24, 150, 29619 }, // ŉ
-    { 22, 31, 27, 3, 24, 171, 29769 }, // Ŋ
-    { 18, 27, 22, 2, 19, 122, 29940 }, // ŋ
-    { 24, 31, 26, 1, 30, 186, 30062 }, // Ō
-    { 19, 25, 21, 1, 24, 119, 30248 }, // ō
-    { 24, 33, 26, 1, 32, 198, 30367 }, // Ŏ
-    { 19, 27, 21, 1, 26, 129, 30565 }, // ŏ
-    { 24, 33, 26, 1, 32, 198, 30694 }, // Ő
-    { 19, 27, 21, 1, 26, 129, 30892 }, // ő
-    { 30, 26, 32, 1, 25, 195, 31021 }, // Œ
-    { 31, 20, 33, 1, 19, 155, 31216 }, // œ
-    { 20, 32, 22, 2, 32, 160, 31371 }, // Ŕ
-    { 14, 26, 15, 2, 26, 91, 31531 }, // ŕ
-    { 20, 32, 22, 2, 24, 160, 31622 }, // Ŗ
-    { 13, 27, 15, 2, 19, 88, 31782 }, // ŗ
-    { 20, 32, 22, 2, 32, 160, 31870 }, // Ř
-    { 15, 26, 15, 1, 26, 98, 32030 }, // ř
-    { 17, 33, 18, 1, 32, 141, 32128 }, // Ś
-    { 15, 27, 17, 1, 26, 102, 32269 }, // ś
-    { 17, 33, 18, 1, 32, 141, 32371 }, // Ŝ
-    { 15, 27, 17, 1, 26, 102, 32512 }, // ŝ
-    { 17, 33, 18, 1, 25, 141, 32614 }, // Ş
-    { 15, 27, 17, 1, 19, 102, 32755 }, // ş
-    { 17, 33, 18, 1, 32, 141, 32857 }, // Š
-    { 15, 27, 17, 1, 26, 102, 32998 }, // š
-    { 19, 32, 19, 0, 24, 152, 33100 }, // Ţ
-    { 14, 31, 14, 0, 23, 109, 33252 }, // ţ
-    { 19, 32, 19, 0, 32, 152, 33361 }, // Ť
-    { 19, 27, 14, 0, 26, 129, 33513 }, // ť
-    { 19, 24, 19, 0, 24, 114, 33642 }, // Ŧ
-    { 14, 24, 14, 0, 23, 84, 33756 }, // ŧ
-    { 21, 33, 25, 2, 32, 174, 33840 }, // Ũ
-    { 18, 27, 22, 2, 26, 122, 34014 }, // ũ
-    { 21, 31, 25, 2, 30, 163, 34136 }, // Ū
-    { 18, 25, 22, 2, 24, 113, 34299 }, // ū
-    { 21, 33, 25, 2, 32, 174, 34412 }, // Ŭ
-    { 18, 27, 22, 2, 26, 122, 34586 }, // ŭ
-    { 21, 35, 25, 2, 34, 184, 34708 }, // Ů
-    { 18, 29, 22, 2, 28, 131, 34892 }, // ů
-    { 21, 33, 25, 2, 32, 174, 35023 }, // Ű
-    { 18, 27, 22, 2, 26, 122, 35197 }, // ű
-    { 21, 32, 25, 2, 24, 168, 35319 }, // Ų
-    { 18, 27, 22, 2, 19, 122, 35487 }, // ų
-    { 33, 32, 32, 0, 32, 264, 35609 }, // Ŵ
-    { 29, 26, 29, 0, 26, 189, 35873 }, // ŵ
-    { 21, 32, 21, 0, 32, 168, 36062 }, // Ŷ
-    { 20, 34, 19, 0, 26, 170, 36230 }, // ŷ
-    { 21, 32, 21, 0, 32, 168, 36400 }, // Ÿ
-    { 19, 32, 19, 0, 32, 152, 36568 }, // Ź
-    { 15, 26, 16, 1, 26, 98, 36720 }, // ź
-    { 19, 32, 19, 0, 32, 152, 36818 }, // Ż
-    { 15, 26, 16, 1, 26, 98, 36970 }, // ż
-    { 19, 32, 19, 0, 32, 152, 37068 }, // Ž
-    { 15, 26, 16, 1, 26, 98, 37220 }, // ž
-    { 12, 26, 13, 2, 26, 78, 37318 }, // ſ
-    { 10, 6, 0, -18, 26, 15, 37396 }, // ̀
-    { 11, 6, 0, -13, 26, 17, 37411 }, // ́
-    { 14, 6, 0, -7, 26, 21, 37428 }, // ̂
-    { 15, 6, 0, -19, 26, 23, 37449 }, // ̃
-    { 12, 4, 0, -6, 24, 12, 37472 }, // ̄
-    { 14, 5, 0, -7, 29, 18, 37484 }, // ̅
-    { 14, 6, 0, -7, 26, 21, 37502 }, // ̆
-    { 6, 6, 0, -3, 26, 9, 37523 }, // ̇
-    { 12, 6, 0, -6, 26, 18, 37532 }, // ̈
-    { 8, 9, 0, -14, 28, 18, 37550 }, // ̉
-    { 9, 8, 0, -5, 28, 18, 37568 }, // ̊
-    { 16, 6, 0, -6, 26, 24, 37586 }, // ̋
-    { 15, 6, 0, -7, 26, 23, 37610 }, // ̌
-    { 4, 7, 0, -2, 26, 7, 37633 }, // ̍
-    { 10, 7, 0, -5, 26, 18, 37640 }, // ̎
-    { 14, 6, 0, -19, 26, 21, 37658 }, // ̏
-    { 12, 9, 0, -6, 29, 27, 37679 }, // ̐
-    { 14, 6, 0, -7, 26, 21, 37706 }, // ̑
-    { 8, 9, 0, -4, 24, 18, 37727 }, // ̒
-    { 8, 9, 0, -4, 24, 18, 37745 }, // ̓
-    { 8, 9, 0, -4, 24, 18, 37763 }, // ̔
-    { 8, 9, 0, -4, 24, 18, 37781 }, // ̕
-    { 11, 6, 0, -6, -1, 17, 37799 }, // ̖
-    { 10, 6, 0, -5, -1, 15, 37816 }, // ̗
-    { 6, 8, 0, -3, 0, 12, 37831 }, // ̘
-    { 6, 8, 0, -3, 0, 12, 37843 }, // ̙
-    { 9, 9, 10, 0, 26, 21, 37855 }, // ̚
-    { 9, 9, 0, -4, 26, 21, 37876 }, // ̛
-    { 5, 8, 0, -3, 0, 10, 37897 }, // ̜
-    { 8, 6, 0, -4, -1, 12, 37907 }, // ̝
-    { 8, 6, 0, -4, -1, 12, 37919 }, // ̞
-    { 8, 8, 0, -4, 0, 16, 37931 }, // ̟
-    { 8, 3, 0, -4, -3, 6, 37947 }, // ̠
-    { 8, 10, 0, -8, 2, 20, 37953 }, // ̡
-    { 8, 10, 0, 0, 2, 20, 37973 }, // ̢
-    { 7, 6, 0, -15, -2, 11, 37993 }, // ̣
-    { 12, 6, 0, -6, -1, 18, 38004 }, // ̤
-    { 9, 8, 0, -5, 0, 18, 38022 }, // ̥
-    { 6, 6, 0, -3, -2, 9, 38040 }, // ̦
-    { 8, 8, 0, -4, 0, 16, 38049 }, // ̧
-    { 8, 9, 0, -4, 1, 18, 38065 }, // ̨
-    { 4, 7, 0, -2, -1, 7, 38083 }, // ̩
-    { 12, 7, 0, -6, -1, 21, 38090 }, // ̪
-    { 14, 4, 0, -7, -2, 14, 38111 }, // ̫
-    { 15, 6, 0, -7, -1, 23, 38125 }, // ̬
-    { 14, 6, 0, -7, -1, 21, 38148 }, // ̭
-    { 14, 6, 0, -7, -1, 21, 38169 }, // ̮
-    { 14, 6, 0, -7, -1, 21, 38190 }, // ̯
-    { 14, 6, 0, -7, -1, 21, 38211 }, // ̰
-    { 12, 4, 0, -6, -2, 12, 38232 }, // ̱
-    { 16, 3, 0, -8, -3, 12, 38244 }, // ̲
-    { 15, 8, 0, -8, 0, 30, 38256 }, // ̳
-    { 15, 6, 0, -7, 13, 23, 38286 }, // ̴
-    { 14, 5, 0, -7, 12, 18, 38309 }, // ̵
-    { 26, 4, 0, -13, 11, 26, 38327 }, // ̶
-    { 12, 10, 0, -6, 14, 30, 38353 }, // ̷
-    { 14, 28, 0, -7, 26, 98, 38383 }, // ̸
-    { 5, 8, 0, -2, 0, 10, 38481 }, // ̹
-    { 12, 7, 0, -6, -1, 21, 38491 }, // ̺
-    { 14, 8, 0, -7, 0, 28, 38512 }, // ̻
-    { 14, 4, 0, -7, -2, 14, 38540 }, // ̼
-    { 8, 7, 0, -4, 26, 14, 38554 }, // ̽
-    { 6, 10, 0, -3, 29, 15, 38568 }, // ̾
-    { 14, 8, 0, -8, 33, 28, 38583 }, // ̿
-    { 11, 6, 0, -8, 26, 17, 38611 }, // ̀
-    { 10, 6, 0, -2, 26, 15, 38628 }, // ́
-    { 14, 6, 0, -7, 26, 21, 38643 }, // ͂
-    { 7, 7, 0, -4, 26, 13, 38664 }, // ̓
-    { 18, 6, 0, -7, 26, 27, 38677 }, // ̈́
-    { 7, 7, 0, -2, -1, 13, 38704 }, // ͅ
-    { 16, 7, 0, -8, 26, 28, 38717 }, // ͆
-    { 14, 8, 0, -8, 0, 28, 38745 }, // ͇
-    { 10, 7, 0, -5, -1, 18, 38773 }, // ͈
-    { 8, 6, 0, -4, -2, 12, 38791 }, // ͉
-    { 14, 8, 0, -7, 26, 28, 38803 }, // ͊
-    { 14, 14, 0, -7, 32, 49, 38831 }, // ͋
-    { 12, 9, 0, -6, 29, 27, 38880 }, // ͌
-    { 12, 7, 0, -6, -1, 21, 38907 }, // ͍
-    { 8, 8, 0, -4, 0, 16, 38928 }, // ͎
-    { 24, 24, 0, -12, 24, 144, 38944 }, // ͏
-    { 6, 8, 0, -3, 27, 12, 39088 }, // ͐
-    { 5, 8, 0, -2, 27, 10, 39100 }, // ͑
-    { 12, 9, 0, -6, 29, 27, 39110 }, // ͒
-    { 8, 7, 0, -4, -1, 14, 39137 }, // ͓
-    { 6, 7, 0, -3, -1, 11, 39151 }, // ͔
-    { 6, 7, 0, -3, -1, 11, 39162 }, // ͕
-    { 14, 7, 0, -7, -1, 25, 39173 }, // ͖
-    { 5, 8, 0, -2, 27, 10, 39198 }, // ͗
-    { 6, 6, 0, 3, 26, 9, 39208 }, // ͘
-    { 8, 7, 0, -4, -1, 14, 39217 }, // ͙
-    { 14, 8, 0, -7, 0, 28, 39231 }, // ͚
-    { 8, 8, 0, -4, 27, 16, 39259 }, // ͛
-    { 28, 7, 0, -14, -1, 49, 39275 }, // ͜
-    { 28, 7, 0, -14, 26, 49, 39324 }, // ͝
-    { 20, 3, 0, -10, 23, 15, 39373 }, // ͞
-    { 20, 3, 0, -10, -2, 15, 39388 }, // ͟
-    { 28, 6, 0, -14, 26, 42, 39403 }, // ͠
-    { 28, 8, 0, -14, 30, 56, 39445 }, // ͡
-    { 27, 8, 0, -13, 0, 54, 39501 }, // ͢
-    { 8, 9, 0, -4, 29, 18, 39555 }, // ͣ
-    { 9, 9, 0, -4, 29, 21, 39573 }, // ͤ
-    { 3, 11, 0, -1, 31, 9, 39594 }, // ͥ
-    { 9, 9, 0, -4, 29, 21, 39603 }, // ͦ
-    { 9, 8, 0, -4, 28, 18, 39624 }, // ͧ
-    { 7, 9, 0, -3, 29, 16, 39642 }, // ͨ
-    { 8, 11, 0, -4, 31, 22, 39658 }, // ͩ
-    { 9, 11, 0, -4, 31, 25, 39680 }, // ͪ
-    { 13, 9, 0, -6, 29, 30, 39705 }, // ͫ
-    { 6, 9, 0, -2, 29, 14, 39735 }, // ͬ
-    { 7, 10, 0, -3, 30, 18, 39749 }, // ͭ
-    { 9, 8, 0, -4, 28, 18, 39767 }, // ͮ
-    { 10, 8, 0, -5, 28, 20, 39785 }, // ͯ
-    { 15, 32, 19, 2, 32, 120, 39805 }, // Ѐ
-    { 15, 32, 19, 2, 32, 120, 39925 }, // Ё
-    { 25, 25, 26, 0, 24, 157, 40045 }, // Ђ
-    { 15, 32, 19, 3, 32, 120, 40202 }, // Ѓ
-    { 20, 26, 22, 1, 25, 130, 40322 }, // Є
-    { 16, 26, 18, 1, 25, 104, 40452 }, // Ѕ
-    { 6, 24, 11, 2, 24, 36, 40556 }, // І
-    { 11, 32, 11, 0, 32, 88, 40592 }, // Ї
-    { 12, 31, 11, -3, 24, 93, 40680 }, // Ј
-    { 33, 25, 34, 0, 24, 207, 40773 }, // Љ
-    { 31, 24, 35, 3, 24, 186, 40980 }, // Њ
-    { 24, 24, 26, 0, 24, 144, 41166 }, // Ћ
-    { 20, 32, 23, 3, 32, 160, 41310 }, // Ќ
-    { 21, 32, 26, 3, 32, 168, 41470 }, // Ѝ
-    { 22, 33, 22, 0, 32, 182, 41638 }, // Ў
-    { 20, 29, 26, 3, 24, 145, 41820 }, // Џ
-    { 24, 24, 23, 0, 24, 144, 41965 }, // А
-    { 18, 24, 22, 3, 24, 108, 42109 }, // Б
-    { 19, 24, 22, 2, 24, 114, 42217 }, // В
-    { 15, 24, 19, 3, 24, 90, 42331 }, // Г
-    { 26, 29, 26, 0, 24, 189, 42421 }, // Д
-    { 15, 24, 19, 2, 24, 90, 42610 }, // Е
-    { 33, 24, 33, 0, 24, 198, 42700 }, // Ж
-    { 17, 26, 20, 1, 25, 111, 42898 }, // З
-    { 21, 24, 26, 3, 24, 126, 43009 }, // И
-    { 21, 32, 26, 3, 32, 168, 43135 }, // Й
-    { 20, 24, 23, 3, 24, 120, 43303 }, // К
-    { 22, 25, 24, 0, 24, 138, 43423 }, // Л
-    { 26, 24, 31, 3, 24, 156, 43561 }, // М
-    { 20, 24, 26, 3, 24, 120, 43717 }, // Н
-    { 24, 26, 26, 1, 25, 156, 43837 }, // О
-    { 20, 24, 25, 3, 24, 120, 43993 }, // П
-    { 18, 24, 21, 2, 24, 108, 44113 }, // Р
-    { 20, 26, 22, 1, 25, 130, 44221 }, // С
-    { 19, 24, 19, 0, 24, 114, 44351 }, // Т
-    { 22, 25, 22, 0, 24, 138, 44465 }, // У
-    { 28, 26, 30, 1, 25, 182, 44603 }, // Ф
-    { 23, 24, 22, 0, 24, 138, 44785 }, // Х
-    { 23, 29, 26, 3, 24, 167, 44923 }, // Ц
-    { 19, 24, 24, 2, 24, 114, 45090 }, // Ч
-    { 31, 24, 36, 2, 24, 186, 45204 }, // Ш
-    { 34, 30, 36, 2, 24, 255, 45390 }, // Щ
-    { 24, 24, 25, 0, 24, 144, 45645 }, // Ъ
-    { 25, 24, 31, 3, 24, 150, 45789 }, // Ы
-    { 17, 24, 22, 3, 24, 102, 45939 }, // Ь
-    { 19, 26, 22, 1, 25, 124, 46041 }, // Э
-    { 30, 26, 34, 3, 25, 195, 46165 }, // Ю
-    { 20, 24, 23, 0, 24, 120, 46360 }, // Я
-    { 17, 20, 20, 1, 19, 85, 46480 }, // а
-    { 19, 27, 21, 1, 26, 129, 46565 }, // б
-    { 17, 19, 20, 2, 19, 81, 46694 }, // в
-    { 14, 19, 16, 2, 19, 67, 46775 }, // г
-    { 21, 24, 21, 0, 19, 126, 46842 }, // д
-    { 18, 20, 19, 1, 19, 90, 46968 }, // е
-    { 29, 19, 29, 0, 19, 138, 47058 }, // ж
-    { 15, 20, 17, 1, 19, 75, 47196 }, // з
-    { 18, 19, 22, 2, 19, 86, 47271 }, // и
-    { 18, 26, 22, 2, 26, 117, 47357 }, // й
-    { 19, 19, 21, 2, 19, 91, 47474 }, // к
-    { 19, 20, 21, 0, 19, 95, 47565 }, // л
-    { 24, 19, 28, 2, 19, 114, 47660 }, // м
-    { 18, 19, 22, 2, 19, 86, 47774 }, // н
-    { 19, 20, 21, 1, 19, 95, 47860 }, // о
-    { 17, 19, 22, 2, 19, 81, 47955 }, // п
-    { 18, 27, 21, 2, 19, 122, 48036 }, // р
-    { 16, 20, 17, 1, 19, 80, 48158 }, // с
-    { 17, 19, 17, 0, 19, 81, 48238 }, // т
-    { 21, 27, 19, -1, 19, 142, 48319 }, // у
-    { 25, 34, 27, 1, 26, 213, 48461 }, // ф
-    { 20, 19, 19, 0, 19, 95, 48674 }, // х
-    { 20, 24, 22, 2, 19, 120, 48769 }, // ц
-    { 17, 19, 21, 2, 19, 81, 48889 }, // ч
-    { 28, 19, 32, 2, 19, 133, 48970 }, // ш
-    { 30, 24, 32, 2, 19, 180, 49103 }, // щ
-    { 22, 19, 22, 0, 19, 105, 49283 }, // ъ
-    { 24, 19, 28, 2, 19, 114, 49388 }, // ы
-    { 17, 19, 20, 2, 19, 81, 49502 }, // ь
-    { 16, 20, 17, 1, 19, 80, 49583 }, // э
-    { 25, 20, 28, 2, 19, 125, 49663 }, // ю
-    { 18, 19, 20, 0, 19, 86, 49788 }, // я
-    { 18, 27, 19, 1, 26, 122, 49874 }, // ѐ
-    { 18, 26, 19, 1, 25, 117, 49996 }, // ё
-    { 20, 34, 22, 0, 26, 170, 50113 }, // ђ
-    { 14, 26, 16, 2, 26, 91, 50283 }, // ѓ
-    { 16, 20, 17, 1, 19, 80, 50374 }, // є
-    { 15, 20, 17, 1, 19, 75, 50454 }, // ѕ
-    { 6, 26, 10, 2, 26, 39, 50529 }, // і
-    { 10, 26, 10, 0, 26, 65, 50568 }, // ї
-    { 10, 34, 10, -2, 26, 85, 50633 }, // ј
-    { 29, 20, 30, 0, 19, 145, 50718 }, // љ
-    { 28, 19, 31, 2, 19, 133, 50863 }, // њ
-    { 20, 26, 22, 0, 26, 130, 50996 }, // ћ
-    { 19, 26, 21, 2, 26, 124, 51126 }, // ќ
-    { 18, 26, 22, 2, 26, 117, 51250 }, // ѝ
-    { 21, 34, 19, -1, 26, 179, 51367 }, // ў
-    { 17, 24, 22, 2, 19, 102, 51546 }, // џ
-    { 32, 24, 32, 0, 24, 192, 51648 }, // Ѡ
-    { 29, 19, 30, 0, 19, 138, 51840 }, // ѡ
-    { 21, 24, 22, 0, 24, 126, 51978 }, // Ѣ
-    { 21, 22, 22, 0, 22, 116, 52104 }, // ѣ
-    { 28, 26, 32, 3, 25, 182, 52220 }, // Ѥ
-    { 24, 20, 27, 2, 19, 120, 52402 }, // ѥ
-    { 25, 24, 24, 0, 24, 150, 52522 }, // Ѧ
-    { 22, 19, 21, 0, 19, 105, 52672 }, // ѧ
-    { 31, 24, 34, 3, 24, 186, 52777 }, // Ѩ
-    { 29, 19, 30, 2, 19, 138, 52963 }, // ѩ
-    { 27, 24, 27, 0, 24, 162, 53101 }, // Ѫ
-    { 21, 19, 21, 0, 19, 100, 53263 }, // ѫ
-    { 33, 24, 36, 3, 24, 198, 53363 }, // Ѭ
-    { 27, 19, 29, 2, 19, 129, 53561 }, // ѭ
-    { 20, 37, 21, 0, 29, 185, 53690 }, // Ѯ
-    { 18, 31, 19, 0, 23, 140, 53875 }, // ѯ
-    { 25, 24, 29, 2, 24, 150, 54015 }, // Ѱ
-    { 24, 34, 28, 2, 26, 204, 54165 }, // ѱ
-    { 24, 26, 26, 1, 25, 156, 54369 }, // Ѳ
-    { 19, 20, 21, 1, 19, 95, 54525 }, // ѳ
-    { 24, 24, 24, 0, 24, 144, 54620 }, // Ѵ
-    { 21, 19, 20, 0, 19, 100, 54764 }, // ѵ
-    { 24, 32, 24, 0, 32, 192, 54864 }, // Ѷ
-    { 21, 26, 20, 0, 26, 137, 55056 }, // ѷ
-    { 43, 33, 44, 1, 25, 355, 55193 }, // Ѹ
-    { 39, 27, 39, 1, 19, 264, 55548 }, // ѹ
-    { 25, 29, 28, 1, 26, 182, 55812 }, // Ѻ
-    { 21, 23, 23, 1, 21, 121, 55994 }, // ѻ
-    { 34, 37, 36, 1, 36, 315, 56115 }, // Ѽ
-    { 29, 32, 32, 1, 31, 232, 56430 }, // ѽ
-    { 32, 31, 32, 0, 31, 248, 56662 }, // Ѿ
-    { 29, 25, 30, 0, 25, 182, 56910 }, // ѿ
-    { 21, 33, 23, 1, 25, 174, 57092 }, // Ҁ
-    { 16, 27, 17, 1, 19, 108, 57266 }, // ҁ
-    { 18, 22, 20, 1, 21, 99, 57374 }, // ҂
-    { 14, 7, 0, -16, 25, 25, 57473 }, // ҃
-    { 14, 6, 0, -16, 26, 21, 57498 }, // ҄
-    { 6, 8, 0, -12, 27, 12, 57519 }, // ҅
-    { 6, 8, 0, -12, 27, 12, 57531 }, // ҆
-    { 14, 6, 0, -7, 31, 21, 57543 }, // ҇
-    { 38, 36, 0, -19, 27, 342, 57564 }, // ҈
-    { 38, 38, 0, -19, 28, 361, 57906 }, // ҉
-    { 27, 39, 31, 3, 32, 264, 58267 }, // Ҋ
-    { 25, 34, 27, 2, 27, 213, 58531 }, // ҋ
-    { 20, 24, 21, 0, 24, 120, 58744 }, // Ҍ
-    { 20, 26, 20, 0, 26, 130, 58864 }, // ҍ
-    { 17, 24, 21, 3, 24, 102, 58994 }, // Ҏ
-    { 18, 27, 21, 2, 19, 122, 59096 }, // ҏ
-    { 17, 29, 19, 2, 29, 124, 59218 }, // Ґ
-    { 14, 24, 17, 2, 24, 84, 59342 }, // ґ
-    { 18, 24, 19, 0, 24, 108, 59426 }, // Ғ
-    { 16, 19, 16, 0, 19, 76, 59534 }, // ғ
-    { 20, 33, 24, 3, 24, 165, 59610 }, // Ҕ
-    { 17, 28, 20, 2, 19, 119, 59775 }, // ҕ
-    { 34, 31, 34, 0, 24, 264, 59894 }, // Җ
-    { 32, 26, 31, -1, 19, 208, 60158 }, // җ
-    { 17, 33, 20, 1, 25, 141, 60366 }, // Ҙ
-    { 15, 27, 17, 1, 19, 102, 60507 }, // ҙ
-    { 22, 31, 25, 3, 24, 171, 60609 }, // Қ
-    { 20, 26, 22, 2, 19, 130, 60780 }, // қ
-    { 21, 24, 22, 2, 24, 126, 60910 }, // Ҝ
-    { 19, 19, 21, 2, 19, 91, 61036 }, // ҝ
-    { 22, 24, 23, 1, 24, 132, 61127 }, // Ҟ
-    { 21, 26, 21, 0, 26, 137, 61259 }, // ҟ
-    { 25, 24, 24, 0, 24, 150, 61396 }, // Ҡ
-    { 24, 19, 23, 0, 19, 114, 61546 }, // ҡ
-    { 25, 31, 28, 3, 24, 194, 61660 }, // Ң
-    { 22, 26, 25, 2, 19, 143, 61854 }, // ң
-    { 25, 24, 28, 3, 24, 150, 61997 }, // Ҥ
-    { 24, 19, 25, 2, 19, 114, 62147 }, // ҥ
-    { 33, 33, 38, 3, 24, 273, 62261 }, // Ҧ
-    { 27, 28, 30, 2, 19, 189, 62534 }, // ҧ
-    { 24, 27, 26, 1, 25, 162, 62723 }, // Ҩ
-    { 20, 21, 22, 1, 19, 105, 62885 }, // ҩ
-    { 20, 33, 21, 1, 25, 165, 62990 }, // Ҫ
-    { 16, 27, 17, 1, 19, 108, 63155 }, // ҫ
-    { 19, 31, 19, 0, 24, 148, 63263 }, // Ҭ
-    { 18, 26, 18, 0, 19, 117, 63411 }, // ҭ
-    { 21, 24, 21, 0, 24, 126, 63528 }, // Ү
-    { 20, 27, 19, 0, 19, 135, 63654 }, // ү
-    { 21, 24, 21, 0, 24, 126, 63789 }, // Ұ
-    { 20, 27, 19, 0, 19, 135, 63915 }, // ұ
-    { 25, 31, 25, 0, 24, 194, 64050 }, // Ҳ
-    { 21, 26, 21, 0, 19, 137, 64244 }, // ҳ
-    { 31, 31, 31, 0, 24, 241, 64381 }, // Ҵ
-    { 26, 26, 26, 0, 19, 169, 64622 }, // ҵ
-    { 26, 31, 27, 1, 24, 202, 64791 }, // Ҷ
-    { 22, 26, 24, 2, 19, 143, 64993 }, // ҷ
-    { 20, 24, 25, 2, 24, 120, 65136 }, // Ҹ
-    { 19, 19, 22, 1, 19, 91, 65256 }, // ҹ
-    { 21, 24, 25, 2, 24, 126, 65347 }, // Һ
-    { 18, 26, 22, 2, 26, 117, 65473 }, // һ
-    { 29, 26, 32, 0, 25, 189, 65590 }, // Ҽ
-    { 24, 20, 24, -1, 19, 120, 65779 }, // ҽ
-    { 29, 32, 32, 0, 25, 232, 65899 }, // Ҿ
-    { 24, 26, 24, -1, 19, 156, 66131 }, // ҿ
-    { 11, 24, 13, 1, 24, 66, 66287 }, // Ӏ
-    { 33, 32, 33, 0, 32, 264, 66353 }, // Ӂ
-    { 29, 26, 29, 0, 26, 189, 66617 }, // ӂ
-    { 21, 33, 25, 3, 24, 174, 66806 }, // Ӄ
-    { 19, 28, 22, 2, 19, 133, 66980 }, // ӄ
-    { 28, 31, 28, 0, 24, 217, 67113 }, // Ӆ
-    { 24, 26, 24, 0, 19, 156, 67330 }, // ӆ
-    { 20, 33, 26, 3, 24, 165, 67486 }, // Ӈ
-    { 18, 28, 22, 2, 19, 126, 67651 }, // ӈ
-    { 25, 31, 29, 3, 24, 194, 67777 }, // Ӊ
-    { 23, 26, 25, 2, 19, 150, 67971 }, // ӊ
-    { 20, 31, 25, 2, 24, 155, 68121 }, // Ӌ
-    { 18, 26, 22, 2, 19, 117, 68276 }, // ӌ
-    { 31, 31, 35, 3, 24, 241, 68393 }, // Ӎ
-    { 29, 26, 31, 2, 19, 189, 68634 }, // ӎ
-    { 11, 24, 13, 1, 24, 66, 68823 }, // ӏ
-    { 24, 32, 23, 0, 32, 192, 68889 }, // Ӑ
-    { 17, 27, 20, 1, 26, 115, 69081 }, // ӑ
-    { 24, 32, 23, 0, 32, 192, 69196 }, // Ӓ
-    { 17, 27, 20, 1, 26, 115, 69388 }, // ӓ
-    { 30, 24, 32, 0, 24, 180, 69503 }, // Ӕ
-    { 29, 20, 31, 1, 19, 145, 69683 }, // ӕ
-    { 14, 32, 19, 3, 32, 112, 69828 }, // Ӗ
-    { 18, 27, 20, 1, 26, 122, 69940 }, // ӗ
-    { 24, 26, 27, 2, 25, 156, 70062 }, // Ә
-    { 18, 20, 20, 1, 19, 90, 70218 }, // ә
-    { 24, 33, 27, 2, 32, 198, 70308 }, // Ӛ
-    { 18, 27, 20, 1, 26, 122, 70506 }, // ӛ
-    { 33, 32, 33, 0, 32, 264, 70628 }, // Ӝ
-    { 29, 26, 29, 0, 26, 189, 70892 }, // ӝ
-    { 17, 33, 20, 1, 32, 141, 71081 }, // Ӟ
-    { 15, 27, 17, 1, 26, 102, 71222 }, // ӟ
-    { 19, 25, 20, 0, 24, 119, 71324 }, // Ӡ
-    { 19, 27, 19, 0, 19, 129, 71443 }, // ӡ
-    { 21, 30, 26, 3, 30, 158, 71572 }, // Ӣ
-    { 18, 24, 22, 2, 24, 108, 71730 }, // ӣ
-    { 21, 32, 26, 3, 32, 168, 71838 }, // Ӥ
-    { 18, 26, 22, 2, 26, 117, 72006 }, // ӥ
-    { 24, 33, 26, 1, 32, 198, 72123 }, // Ӧ
-    { 19, 27, 21, 1, 26, 129, 72321 }, // ӧ
-    { 24, 26, 26, 1, 25, 156, 72450 }, // Ө
-    { 19, 20, 21, 1, 19, 95, 72606 }, // ө
-    { 24, 33, 26, 1, 32, 198, 72701 }, // Ӫ
-    { 19, 27, 21, 1, 26, 129, 72899 }, // ӫ
-    { 19, 33, 22, 1, 32, 157, 73028 }, // Ӭ
-    { 16, 27, 17, 1, 26, 108, 73185 }, // ӭ
-    { 22, 31, 22, 0, 30, 171, 73293 }, // Ӯ
-    { 21, 32, 19, -1, 24, 168, 73464 }, // ӯ
-    { 22, 33, 22, 0, 32, 182, 73632 }, // Ӱ
-    { 21, 34, 19, -1, 26, 179, 73814 }, // ӱ
-    { 22, 33, 22, 0, 32, 182, 73993 }, // Ӳ
-    { 20, 34, 19, 0, 26, 170, 74175 }, // ӳ
-    { 19, 32, 24, 2, 32, 152, 74345 }, // Ӵ
-    { 17, 26, 21, 2, 26, 111, 74497 }, // ӵ
-    { 16, 31, 19, 3, 24, 124, 74608 }, // Ӷ
-    { 14, 26, 16, 2, 19, 91, 74732 }, // ӷ
-    { 25, 32, 31, 3, 32, 200, 74823 }, // Ӹ
-    { 24, 26, 28, 2, 26, 156, 75023 }, // ӹ
-    { 18, 33, 19, 0, 24, 149, 75179 }, // Ӻ
-    { 16, 27, 16, 0, 19, 108, 75328 }, // ӻ
-    { 24, 33, 24, 0, 24, 198, 75436 }, // Ӽ
-    { 21, 27, 22, 0, 19, 142, 75634 }, // ӽ
-    { 23, 24, 22, 0, 24, 138, 75776 }, // Ӿ
-    { 20, 19, 19, 0, 19, 95, 75914 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 76009 }, //  
-    { 0, 0, 33, 0, 0, 0, 76009 }, //  
-    { 0, 0, 17, 0, 0, 0, 76009 }, //  
-    { 0, 0, 33, 0, 0, 0, 76009 }, //  
-    { 0, 0, 11, 0, 0, 0, 76009 }, //  
-    { 0, 0, 8, 0, 0, 0, 76009 }, //  
-    { 0, 0, 6, 0, 0, 0, 76009 }, //  
-    { 0, 0, 19, 0, 0, 0, 76009 }, //  
-    { 0, 0, 9, 0, 0, 0, 76009 }, //  
-    { 0, 0, 6, 0, 0, 0, 76009 }, //  
-    { 0, 0, 3, 0, 0, 0, 76009 }, //  
-    { 0, 0, 0, 0, 0, 0, 76009 }, // ​
-    { 0, 0, 0, 0, 0, 0, 76009 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 76009 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 76009 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 76072 }, // ‏
-    { 10, 5, 11, 0, 11, 13, 76135 }, // ‐
-    { 10, 5, 11, 0, 11, 13, 76148 }, // ‑
-    { 17, 5, 19, 1, 14, 22, 76161 }, // ‒
-    { 15, 4, 17, 1, 11, 15, 76183 }, // –
-    { 32, 4, 33, 1, 11, 32, 76198 }, // —
-    { 32, 4, 33, 1, 11, 32, 76230 }, // ―
-    { 13, 34, 18, 3, 26, 111, 76262 }, // ‖
-    { 15, 8, 14, -1, 0, 30, 76373 }, // ‗
-    { 7, 9, 7, 0, 24, 16, 76403 }, // ‘
-    { 7, 9, 7, 0, 24, 16, 76419 }, // ’
-    { 8, 9, 10, 0, 5, 18, 76435 }, // ‚
-    { 7, 9, 7, 0, 24, 16, 76453 }, // ‛
-    { 15, 9, 15, 0, 24, 34, 76469 }, // “
-    { 15, 9, 15, 0, 24, 34, 76503 }, // ”
-    { 15, 9, 17, 1, 4, 34, 76537 }, // „
-    { 15, 9, 15, 0, 24, 34, 76571 }, // ‟
-    { 15, 26, 17, 1, 26, 98, 76605 }, // †
-    { 15, 26, 17, 1, 26, 98, 76703 }, // ‡
-    { 10, 11, 13, 1, 18, 28, 76801 }, // •
-    { 12, 13, 13, 1, 19, 39, 76829 }, // ‣
-    { 7, 7, 17, 5, 6, 13, 76868 }, // ․
-    { 17, 7, 19, 1, 6, 30, 76881 }, // ‥
-    { 26, 7, 29, 1, 6, 46, 76911 }, // …
-    { 7, 7, 9, 1, 12, 13, 76957 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 76970 }, //  
-    { 0, 0, 20, 0, 0, 0, 76970 }, //  
-    { 9, 26, 0, -1, 21, 59, 76970 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 77029 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 77088 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 77144 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 77200 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 77256 }, //  
-    { 41, 26, 43, 1, 25, 267, 77256 }, // ‰
-    { 55, 26, 56, 0, 25, 358, 77523 }, // ‱
-    { 10, 9, 10, 1, 24, 23, 77881 }, // ′
-    { 17, 9, 17, 1, 24, 39, 77904 }, // ″
-    { 25, 9, 25, 1, 24, 57, 77943 }, // ‴
-    { 10, 9, 14, 1, 24, 23, 78000 }, // ‵
-    { 17, 9, 21, 1, 24, 39, 78023 }, // ‶
-    { 25, 9, 29, 1, 24, 57, 78062 }, // ‷
-    { 13, 11, 14, 0, 3, 36, 78119 }, // ‸
-    { 10, 16, 12, 1, 17, 40, 78155 }, // ‹
-    { 10, 16, 12, 1, 17, 40, 78195 }, // ›
-    { 26, 26, 28, 1, 25, 169, 78235 }, // ※
-    { 17, 25, 19, 1, 24, 107, 78404 }, // ‼
-    { 16, 26, 16, 0, 25, 104, 78511 }, // ‽
-    { 18, 4, 17, -1, 29, 18, 78615 }, // ‾
-    { 20, 8, 20, 0, 0, 40, 78633 }, // ‿
-    { 20, 8, 20, 0, 27, 40, 78673 }, // ⁀
-    { 14, 22, 14, 0, 14, 77, 78713 }, // ⁁
-    { 37, 31, 37, 0, 26, 287, 78790 }, // ⁂
-    { 10, 5, 11, 1, 11, 13, 79077 }, // ⁃
-    { 18, 24, 4, -7, 24, 108, 79090 }, // ⁄
-    { 9, 30, 11, 2, 24, 68, 79198 }, // ⁅
-    { 9, 30, 11, 0, 24, 68, 79266 }, // ⁆
-    { 31, 26, 32, 0, 25, 202, 79334 }, // ⁇
-    { 24, 26, 25, 0, 25, 156, 79536 }, // ⁈
-    { 24, 26, 25, 1, 25, 156, 79692 }, // ⁉
-    { 17, 19, 20, 1, 19, 81, 79848 }, // ⁊
-    { 18, 31, 22, 2, 26, 140, 79929 }, // ⁋
-    { 18, 18, 22, 1, 19, 81, 80069 }, // ⁌
-    { 19, 18, 22, 2, 19, 86, 80150 }, // ⁍
-    { 18, 17, 18, 0, 9, 77, 80236 }, // ⁎
-    { 8, 24, 10, 1, 19, 48, 80313 }, // ⁏
-    { 20, 35, 20, 0, 27, 175, 80361 }, // ⁐
-    { 18, 34, 18, 0, 26, 153, 80536 }, // ⁑
-    { 14, 26, 14, 0, 25, 91, 80689 }, // ⁒
-    { 32, 7, 33, 1, 13, 56, 80780 }, // ⁓
-    { 20, 8, 20, 0, 0, 40, 80836 }, // ⁔
-    { 17, 17, 19, 1, 17, 73, 80876 }, // ⁕
-    { 17, 26, 19, 1, 25, 111, 80949 }, // ⁖
-    { 31, 9, 31, 1, 24, 70, 81060 }, // ⁗
-    { 27, 26, 29, 1, 25, 176, 81130 }, // ⁘
-    { 27, 26, 29, 1, 25, 176, 81306 }, // ⁙
-    { 7, 26, 10, 1, 25, 46, 81482 }, // ⁚
-    { 21, 28, 23, 1, 27, 147, 81528 }, // ⁛
-    { 27, 27, 28, 1, 25, 183, 81675 }, // ⁜
-    { 7, 27, 9, 1, 26, 48, 81858 }, // ⁝
-    { 7, 26, 10, 1, 25, 46, 81906 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 81952 }, //  
-    { 0, 0, 20, 0, 0, 0, 81952 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 81952 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 81952 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 81952 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 81952 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 81952 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 81952 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 81952 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 81952 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 81952 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 82008 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 82064 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 82120 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 82178 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 82234 }, // ⁯
-    { 12, 16, 13, 0, 29, 48, 82290 }, // ⁰
-    { 5, 16, 6, 1, 25, 20, 82338 }, // ⁱ
-    { 13, 16, 13, 0, 29, 52, 82358 }, // ⁴
-    { 11, 16, 13, 1, 29, 44, 82410 }, // ⁵
-    { 12, 16, 13, 0, 29, 48, 82454 }, // ⁶
-    { 12, 16, 13, 0, 29, 48, 82502 }, // ⁷
-    { 12, 16, 13, 0, 29, 48, 82550 }, // ⁸
-    { 12, 16, 13, 0, 29, 48, 82598 }, // ⁹
-    { 10, 10, 12, 1, 25, 25, 82646 }, // ⁺
-    { 10, 4, 12, 1, 22, 10, 82671 }, // ⁻
-    { 10, 7, 12, 1, 23, 18, 82681 }, // ⁼
-    { 6, 20, 8, 2, 31, 30, 82699 }, // ⁽
-    { 6, 20, 8, 0, 31, 30, 82729 }, // ⁾
-    { 12, 12, 14, 1, 21, 36, 82759 }, // ⁿ
-    { 12, 16, 13, 0, 11, 48, 82795 }, // ₀
-    { 9, 16, 13, 1, 11, 36, 82843 }, // ₁
-    { 12, 16, 13, 0, 11, 48, 82879 }, // ₂
-    { 12, 16, 13, 0, 11, 48, 82927 }, // ₃
-    { 13, 16, 13, 0, 11, 52, 82975 }, // ₄
-    { 11, 16, 13, 1, 11, 44, 83027 }, // ₅
-    { 12, 16, 13, 0, 11, 48, 83071 }, // ₆
-    { 12, 16, 13, 0, 11, 48, 83119 }, // ₇
-    { 12, 16, 13, 0, 11, 48, 83167 }, // ₈
-    { 12, 16, 13, 0, 11, 48, 83215 }, // ₉
-    { 10, 10, 12, 1, 8, 25, 83263 }, // ₊
-    { 10, 4, 12, 1, 5, 10, 83288 }, // ₋
-    { 10, 7, 12, 1, 6, 18, 83298 }, // ₌
-    { 6, 20, 8, 2, 13, 30, 83316 }, // ₍
-    { 6, 20, 8, 0, 13, 30, 83346 }, // ₎
-    { 12, 12, 13, 0, 8, 36, 83376 }, // ₐ
-    { 11, 12, 13, 1, 8, 33, 83412 }, // ₑ
-    { 12, 12, 14, 1, 8, 36, 83445 }, // ₒ
-    { 13, 12, 13, 0, 8, 39, 83481 }, // ₓ
-    { 12, 12, 13, 0, 8, 36, 83520 }, // ₔ
-    { 12, 16, 14, 1, 12, 48, 83556 }, // ₕ
-    { 13, 16, 13, 1, 12, 52, 83604 }, // ₖ
-    { 4, 16, 6, 1, 12, 16, 83656 }, // ₗ
-    { 19, 12, 21, 1, 8, 57, 83672 }, // ₘ
-    { 12, 12, 14, 1, 8, 36, 83729 }, // ₙ
-    { 12, 16, 14, 1, 8, 48, 83765 }, // ₚ
-    { 10, 12, 11, 0, 8, 30, 83813 }, // ₛ
-    { 9, 15, 9, 0, 11, 34, 83843 }, // ₜ
-    { 19, 25, 19, 0, 25, 119, 83877 }, // ₠
-    { 19, 28, 20, 1, 26, 133, 83996 }, // ₡
-    { 18, 26, 19, 1, 25, 117, 84129 }, // ₢
-    { 18, 24, 19, 0, 24, 108, 84246 }, // ₣
-    { 18, 25, 19, 1, 25, 113, 84354 }, // ₤
-    { 29, 27, 33, 2, 23, 196, 84467 }, // ₥
-    { 19, 24, 19, 0, 24, 114, 84663 }, // ₦
-    { 27, 25, 30, 2, 24, 169, 84777 }, // ₧
-    { 28, 25, 31, 2, 24, 175, 84946 }, // ₨
-    { 25, 24, 25, 0, 24, 150, 85121 }, // ₩
-    { 26, 24, 31, 2, 24, 156, 85271 }, // ₪
-    { 21, 32, 22, 1, 26, 168, 85427 }, // ₫
-    { 18, 25, 19, 1, 24, 113, 85595 }, // €
-    { 20, 24, 19, 0, 24, 120, 85708 }, // ₭
-    { 19, 24, 19, 0, 24, 114, 85828 }, // ₮
-    { 33, 33, 34, 0, 25, 273, 85942 }, // ₯
-    { 19, 33, 20, 0, 25, 157, 86215 }, // ₰
-    { 19, 24, 19, 0, 24, 114, 86372 }, // ₱
-    { 21, 29, 24, 1, 26, 153, 86486 }, // ₲
-    { 22, 24, 22, 0, 24, 132, 86639 }, // ₳
-    { 19, 26, 19, 0, 25, 124, 86771 }, // ₴
-    { 20, 29, 21, 1, 26, 145, 86895 }, // ₵
-    { 23, 24, 23, 0, 23, 138, 87040 }, // ₶
-    { 24, 28, 24, 0, 25, 168, 87178 }, // ₷
-    { 19, 24, 19, 0, 24, 114, 87346 }, // ₸
-    { 16, 24, 19, 2, 24, 96, 87460 }, // ₹
-    { 19, 25, 19, 0, 24, 119, 87556 }, // ₺
-    { 27, 26, 27, 0, 25, 176, 87675 }, // ₻
-    { 27, 24, 29, 1, 24, 162, 87851 }, // ₼
-    { 20, 24, 20, 0, 24, 120, 88013 }, // ₽
-    { 24, 26, 26, 1, 26, 156, 88133 }, // ₾
-    { 15, 32, 19, 3, 28, 120, 88289 }, // ₿
-    { 16, 25, 17, 1, 19, 100, 88409 }, // ⃀
-    { 17, 5, 19, 1, 14, 22, 88509 }, // −
-    { 31, 32, 33, 1, 26, 248, 88531 }, // �
+    { 17, 26, 19, 1, 25, 111, 2048 }, // 8
+    { 17, 26, 19, 1, 25, 111, 2159 }, // 9
+    { 7, 20, 9, 1, 19, 35, 2270 }, // :
+    { 7, 24, 10, 1, 19, 42, 2305 }, // ;
+    { 17, 18, 19, 1, 21, 77, 2347 }, // <
+    { 17, 11, 19, 1, 17, 47, 2424 }, // =
+    { 17, 18, 19, 1, 21, 77, 2471 }, // >
+    { 16, 26, 16, 0, 25, 104, 2548 }, // ?
+    { 28, 27, 30, 1, 24, 189, 2652 }, // @
+    { 24, 24, 23, 0, 24, 144, 2841 }, // A
+    { 19, 24, 22, 2, 24, 114, 2985 }, // B
+    { 20, 26, 21, 1, 25, 130, 3099 }, // C
+    { 21, 24, 24, 2, 24, 126, 3229 }, // D
+    { 14, 24, 19, 3, 24, 84, 3355 }, // E
+    { 14, 24, 18, 3, 24, 84, 3439 }, // F
+    { 21, 26, 24, 1, 25, 137, 3523 }, // G
+    { 20, 24, 26, 3, 24, 120, 3660 }, // H
+    { 11, 24, 13, 1, 24, 66, 3780 }, // I
+    { 12, 31, 11, -3, 24, 93, 3846 }, // J
+    { 20, 24, 22, 3, 24, 120, 3939 }, // K
+    { 16, 24, 19, 2, 24, 96, 4096 }, // L
+    { 26, 24, 31, 3, 24, 156, 4192 }, // M
+    { 22, 24, 27, 3, 24, 132, 4348 }, // N
+    { 24, 26, 26, 1, 25, 156, 4480 }, // O
+    { 18, 24, 21, 2, 24, 108, 4636 }, // P
+    { 24, 31, 26, 1, 25, 186, 4744 }, // Q
+    { 20, 24, 22, 2, 24, 120, 4930 }, // R
+    { 17, 26, 18, 1, 25, 111, 5050 }, // S
+    { 19, 24, 19, 0, 24, 114, 5161 }, // T
+    { 21, 25, 25, 2, 24, 132, 5275 }, // U
+    { 22, 24, 22, 0, 24, 132, 5407 }, // V
+    { 33, 24, 32, 0, 24, 198, 5539 }, // W
+    { 23, 24, 22, 0, 24, 138, 5737 }, // X
+    { 21, 24, 21, 0, 24, 126, 5875 }, // Y
+    { 19, 24, 19, 0, 24, 114, 6001 }, // Z
+    { 9, 30, 11, 2, 24, 68, 6144 }, // [
+    { 14, 25, 14, 0, 24, 88, 6212 }, // <backslash>
+    { 9, 30, 11, 0, 24, 68, 6300 }, // ]
+    { 19, 16, 19, 0, 24, 76, 6368 }, // ^
+    { 15, 3, 14, -1, -3, 12, 6444 }, // _
+    { 10, 6, 12, 1, 26, 15, 6456 }, // `
+    { 17, 20, 20, 1, 19, 85, 6471 }, // a
+    { 18, 27, 21, 2, 26, 122, 6556 }, // b
+    { 16, 20, 17, 1, 19, 80, 6678 }, // c
+    { 18, 27, 21, 1, 26, 122, 6758 }, // d
+    { 18, 20, 20, 1, 19, 90, 6880 }, // e
+    { 15, 26, 13, 0, 26, 98, 6970 }, // f
+    { 18, 27, 21, 1, 19, 122, 7068 }, // g
+    { 18, 26, 22, 2, 26, 117, 7190 }, // h
+    { 6, 26, 10, 2, 26, 39, 7307 }, // i
+    { 10, 34, 10, -2, 26, 85, 7346 }, // j
+    { 19, 26, 21, 2, 26, 124, 7431 }, // k
+    { 6, 26, 10, 2, 26, 39, 7555 }, // l
+    { 29, 19, 33, 2, 19, 138, 7594 }, // m
+    { 18, 19, 22, 2, 19, 86, 7732 }, // n
+    { 19, 20, 21, 1, 19, 95, 7818 }, // o
+    { 18, 27, 21, 2, 19, 122, 7913 }, // p
+    { 18, 27, 21, 1, 19, 122, 8035 }, // q
+    { 13, 19, 15, 2, 19, 62, 8192 }, // r
+    { 15, 20, 17, 1, 19, 75, 8254 }, // s
+    { 14, 24, 14, 0, 23, 84, 8329 }, // t
+    { 18, 20, 22, 2, 19, 90, 8413 }, // u
+    { 20, 19, 19, 0, 19, 95, 8503 }, // v
+    { 29, 19, 29, 0, 19, 138, 8598 }, // w
+    { 20, 19, 19, 0, 19, 95, 8736 }, // x
+    { 20, 27, 19, 0, 19, 135, 8831 }, // y
+    { 15, 19, 16, 1, 19, 72, 8966 }, // z
+    { 12, 30, 13, 0, 24, 90, 9038 }, // {
+    { 4, 34, 18, 7, 26, 34, 9128 }, // |
+    { 12, 30, 13, 1, 24, 90, 9162 }, // }
+    { 17, 7, 19, 1, 15, 30, 9252 }, // ~
+    { 0, 0, 9, 0, 0, 0, 9282 }, //  
+    { 7, 25, 10, 1, 19, 44, 9282 }, // ¡
+    { 15, 26, 19, 2, 25, 98, 9326 }, // ¢
+    { 18, 25, 19, 1, 25, 113, 9424 }, // £
+    { 17, 16, 19, 1, 20, 68, 9537 }, // ¤
+    { 19, 24, 19, 0, 24, 114, 9605 }, // ¥
+    { 4, 34, 18, 7, 26, 34, 9719 }, // ¦
+    { 14, 27, 16, 1, 26, 95, 9753 }, // §
+    { 12, 6, 20, 4, 26, 18, 9848 }, // ¨
+    { 26, 26, 28, 1, 25, 169, 9866 }, // ©
+    { 12, 13, 13, 0, 25, 39, 10035 }, // ª
+    { 19, 16, 20, 1, 17, 76, 10074 }, // «
+    { 17, 10, 19, 1, 14, 43, 10150 }, // ¬
+    { 10, 5, 11, 0, 11, 13, 10193 }, // ­
+    { 26, 26, 28, 1, 25, 169, 10240 }, // ®
+    { 18, 4, 17, -1, 29, 18, 10409 }, // ¯
+    { 12, 13, 14, 1, 25, 39, 10427 }, // °
+    { 17, 21, 19, 1, 21, 90, 10466 }, // ±
+    { 12, 16, 13, 0, 29, 48, 10556 }, // ²
+    { 12, 16, 13, 0, 29, 48, 10604 }, // ³
+    { 10, 6, 12, 1, 26, 15, 10652 }, // ´
+    { 18, 27, 22, 2, 19, 122, 10667 }, // µ
+    { 18, 31, 22, 1, 26, 140, 10789 }, // ¶
+    { 7, 7, 9, 1, 15, 13, 10929 }, // ·
+    { 9, 8, 9, 0, 0, 18, 10942 }, // ¸
+    { 9, 16, 13, 1, 29, 36, 10960 }, // ¹
+    { 12, 13, 13, 0, 25, 39, 10996 }, // º
+    { 19, 16, 20, 1, 17, 76, 11035 }, // »
+    { 28, 24, 28, 0, 24, 168, 11111 }, // ¼
+    { 28, 24, 29, 0, 24, 168, 11279 }, // ½
+    { 27, 25, 28, 1, 25, 169, 11447 }, // ¾
+    { 16, 25, 16, 0, 19, 100, 11616 }, // ¿
+    { 24, 32, 23, 0, 32, 192, 11716 }, // À
+    { 24, 32, 23, 0, 32, 192, 11908 }, // Á
+    { 24, 32, 23, 0, 32, 192, 12288 }, // Â
+    { 24, 32, 23, 0, 32, 192, 12480 }, // Ã
+    { 24, 32, 23, 0, 32, 192, 12672 }, // Ä
+    { 24, 29, 23, 0, 29, 174, 12864 }, // Å
+    { 30, 24, 32, 0, 24, 180, 13038 }, // Æ
+    { 20, 33, 21, 1, 25, 165, 13218 }, // Ç
+    { 14, 32, 19, 3, 32, 112, 13383 }, // È
+    { 14, 32, 19, 3, 32, 112, 13495 }, // É
+    { 14, 32, 19, 3, 32, 112, 13607 }, // Ê
+    { 14, 32, 19, 3, 32, 112, 13719 }, // Ë
+    { 12, 32, 13, 0, 32, 96, 13831 }, // Ì
+    { 12, 32, 13, 1, 32, 96, 13927 }, // Í
+    { 15, 32, 13, -1, 32, 120, 14023 }, // Î
+    { 13, 32, 13, 0, 32, 104, 14143 }, // Ï
+    { 23, 24, 24, 0, 24, 138, 14336 }, // Ð
+    { 22, 32, 27, 3, 32, 176, 14474 }, // Ñ
+    { 24, 33, 26, 1, 32, 198, 14650 }, // Ò
+    { 24, 33, 26, 1, 32, 198, 14848 }, // Ó
+    { 24, 33, 26, 1, 32, 198, 15046 }, // Ô
+    { 24, 33, 26, 1, 32, 198, 15244 }, // Õ
+    { 24, 33, 26, 1, 32, 198, 15442 }, // Ö
+    { 15, 16, 19, 2, 20, 60, 15640 }, // ×
+    { 24, 28, 26, 1, 26, 168, 15700 }, // Ø
+    { 21, 33, 25, 2, 32, 174, 15868 }, // Ù
+    { 21, 33, 25, 2, 32, 174, 16042 }, // Ú
+    { 21, 33, 25, 2, 32, 174, 16384 }, // Û
+    { 21, 33, 25, 2, 32, 174, 16558 }, // Ü
+    { 21, 32, 21, 0, 32, 168, 16732 }, // Ý
+    { 17, 24, 21, 3, 24, 102, 16900 }, // Þ
+    { 21, 27, 23, 2, 26, 142, 17002 }, // ß
+    { 17, 27, 20, 1, 26, 115, 17144 }, // à
+    { 17, 27, 20, 1, 26, 115, 17259 }, // á
+    { 17, 27, 20, 1, 26, 115, 17374 }, // â
+    { 17, 27, 20, 1, 26, 115, 17489 }, // ã
+    { 17, 27, 20, 1, 26, 115, 17604 }, // ä
+    { 17, 29, 20, 1, 28, 124, 17719 }, // å
+    { 29, 20, 31, 1, 19, 145, 17843 }, // æ
+    { 16, 27, 17, 1, 19, 108, 17988 }, // ç
+    { 18, 27, 20, 1, 26, 122, 18096 }, // è
+    { 18, 27, 20, 1, 26, 122, 18218 }, // é
+    { 18, 27, 20, 1, 26, 122, 18432 }, // ê
+    { 18, 27, 20, 1, 26, 122, 18554 }, // ë
+    { 11, 26, 10, -1, 26, 72, 18676 }, // ì
+    { 10, 26, 10, 2, 26, 65, 18748 }, // í
+    { 14, 26, 10, -2, 26, 91, 18813 }, // î
+    { 12, 26, 10, -1, 26, 78, 18904 }, // ï
+    { 19, 27, 21, 1, 26, 129, 18982 }, // ð
+    { 18, 26, 22, 2, 26, 117, 19111 }, // ñ
+    { 19, 27, 21, 1, 26, 129, 19228 }, // ò
+    { 19, 27, 21, 1, 26, 129, 19357 }, // ó
+    { 19, 27, 21, 1, 26, 129, 19486 }, // ô
+    { 19, 27, 21, 1, 26, 129, 19615 }, // õ
+    { 19, 27, 21, 1, 26, 129, 19744 }, // ö
+    { 17, 17, 19, 1, 20, 73, 19873 }, // ÷
+    { 19, 22, 21, 1, 20, 105, 19946 }, // ø
+    { 18, 27, 22, 2, 26, 122, 20051 }, // ù
+    { 18, 27, 22, 2, 26, 122, 20173 }, // ú
+    { 18, 27, 22, 2, 26, 122, 20295 }, // û
+    { 18, 27, 22, 2, 26, 122, 20480 }, // ü
+    { 20, 34, 19, 0, 26, 170, 20602 }, // ý
+    { 18, 34, 21, 2, 26, 153, 20772 }, // þ
+    { 20, 34, 19, 0, 26, 170, 20925 }, // ÿ
+    { 24, 30, 23, 0, 30, 180, 21095 }, // Ā
+    { 17, 25, 20, 1, 24, 107, 21275 }, // ā
+    { 24, 32, 23, 0, 32, 192, 21382 }, // Ă
+    { 17, 27, 20, 1, 26, 115, 21574 }, // ă
+    { 24, 32, 23, 0, 24, 192, 21689 }, // Ą
+    { 17, 27, 20, 1, 19, 115, 21881 }, // ą
+    { 20, 33, 21, 1, 32, 165, 21996 }, // Ć
+    { 16, 27, 17, 1, 26, 108, 22161 }, // ć
+    { 20, 33, 21, 1, 32, 165, 22269 }, // Ĉ
+    { 16, 27, 17, 1, 26, 108, 22528 }, // ĉ
+    { 20, 33, 21, 1, 32, 165, 22636 }, // Ċ
+    { 16, 27, 17, 1, 26, 108, 22801 }, // ċ
+    { 20, 33, 21, 1, 32, 165, 22909 }, // Č
+    { 17, 27, 17, 1, 26, 115, 23074 }, // č
+    { 21, 32, 24, 2, 32, 168, 23189 }, // Ď
+    { 25, 27, 21, 1, 26, 169, 23357 }, // ď
+    { 23, 24, 24, 0, 24, 138, 23526 }, // Đ
+    { 21, 27, 22, 1, 26, 142, 23664 }, // đ
+    { 14, 30, 19, 3, 30, 105, 23806 }, // Ē
+    { 18, 25, 20, 1, 24, 113, 23911 }, // ē
+    { 14, 32, 19, 3, 32, 112, 24024 }, // Ĕ
+    { 18, 27, 20, 1, 26, 122, 24136 }, // ĕ
+    { 14, 32, 19, 3, 32, 112, 24258 }, // Ė
+    { 18, 27, 20, 1, 26, 122, 24370 }, // ė
+    { 14, 32, 19, 3, 24, 112, 24576 }, // Ę
+    { 18, 27, 20, 1, 19, 122, 24688 }, // ę
+    { 15, 32, 19, 3, 32, 120, 24810 }, // Ě
+    { 18, 27, 20, 1, 26, 122, 24930 }, // ě
+    { 21, 33, 24, 1, 32, 174, 25052 }, // Ĝ
+    { 18, 34, 21, 1, 26, 153, 25226 }, // ĝ
+    { 21, 33, 24, 1, 32, 174, 25379 }, // Ğ
+    { 18, 34, 21, 1, 26, 153, 25553 }, // ğ
+    { 21, 33, 24, 1, 32, 174, 25706 }, // Ġ
+    { 18, 34, 21, 1, 26, 153, 25880 }, // ġ
+    { 21, 33, 24, 1, 25, 174, 26033 }, // Ģ
+    { 18, 34, 21, 1, 26, 153, 26207 }, // ģ
+    { 20, 32, 26, 3, 32, 160, 26360 }, // Ĥ
+    { 22, 33, 22, -2, 33, 182, 26624 }, // ĥ
+    { 26, 24, 26, 0, 24, 156, 26806 }, // Ħ
+    { 20, 26, 22, 0, 26, 130, 26962 }, // ħ
+    { 15, 32, 13, -2, 32, 120, 27092 }, // Ĩ
+    { 14, 26, 10, -2, 26, 91, 27212 }, // ĩ
+    { 12, 30, 13, 0, 30, 90, 27303 }, // Ī
+    { 12, 24, 10, -1, 24, 72, 27393 }, // ī
+    { 14, 32, 13, 0, 32, 112, 27465 }, // Ĭ
+    { 14, 26, 10, -2, 26, 91, 27577 }, // ĭ
+    { 11, 32, 13, 1, 24, 88, 27668 }, // Į
+    { 7, 34, 10, 1, 26, 60, 27756 }, // į
+    { 11, 32, 13, 1, 32, 88, 27816 }, // İ
+    { 6, 19, 10, 2, 19, 29, 27904 }, // ı
+    { 21, 31, 24, 1, 24, 163, 27933 }, // Ĳ
+    { 16, 34, 20, 2, 26, 136, 28096 }, // ĳ
+    { 16, 39, 11, -3, 32, 156, 28232 }, // Ĵ
+    { 14, 34, 10, -2, 26, 119, 28388 }, // ĵ
+    { 20, 32, 22, 3, 24, 160, 28507 }, // Ķ
+    { 19, 34, 21, 2, 26, 162, 28672 }, // ķ
+    { 19, 19, 21, 2, 19, 91, 28834 }, // ĸ
+    { 16, 32, 19, 2, 32, 128, 28925 }, // Ĺ
+    { 10, 33, 10, 2, 33, 83, 29053 }, // ĺ
+    { 16, 32, 19, 2, 24, 128, 29136 }, // Ļ
+    { 6, 34, 10, 2, 26, 51, 29264 }, // ļ
+    { 17, 24, 19, 2, 24, 102, 29315 }, // Ľ
+    { 13, 26, 10, 2, 26, 85, 29417 }, // ľ
+    { 16, 24, 19, 2, 24, 96, 29502 }, // Ŀ
+    { 12, 26, 12, 2, 26, 78, 29598 }, // ŀ
+    { 18, 24, 19, 0, 24, 108, 29676 }, // Ł
+    { 12, 26, 10, -1, 26, 78, 29784 }, // ł
+    { 22, 32, 27, 3, 32, 176, 29862 }, // Ń
+    { 18, 26, 22, 2, 26, 117, 30038 }, // ń
+    { 22, 32, 27, 3, 24, 176, 30155 }, // Ņ
+    { 18, 27, 22, 2, 19, 122, 30331 }, // ņ
+    { 22, 32, 27, 3, 32, 176, 30453 }, // Ň
+    { 18, 26, 22, 2, 26, 117, 30720 }, // ň
+    { 25, 24, 26, -1, 24, 150, 30837 }, // ŉ
+    { 22, 31, 27, 3, 24, 171, 30987 }, // Ŋ
+    { 18, 27, 22, 2, 19, 122, 31158 }, // ŋ
+    { 24, 31, 26, 1, 30, 186, 31280 }, // Ō
+    { 19, 25, 21, 1, 24, 119, 31466 }, // ō
+    { 24, 33, 26, 1, 32, 198, 31585 }, // Ŏ
+    { 19, 27, 21, 1, 26, 129, 31783 }, // ŏ
+    { 24, 33, 26, 1, 32, 198, 31912 }, // Ő
+    { 19, 27, 21, 1, 26, 129, 32110 }, // ő
+    { 30, 26, 32, 1, 25, 195, 32239 }, // Œ
+    { 31, 20, 33, 1, 19, 155, 32434 }, // œ
+    { 20, 32, 22, 2, 32, 160, 32589 }, // Ŕ
+    { 14, 26, 15, 2, 26, 91, 32768 }, // ŕ
+    { 20, 32, 22, 2, 24, 160, 32859 }, // Ŗ
+    { 13, 27, 15, 2, 19, 88, 33019 }, // ŗ
+    { 20, 32, 22, 2, 32, 160, 33107 }, // Ř
+    { 15, 26, 15, 1, 26, 98, 33267 }, // ř
+    { 17, 33, 18, 1, 32, 141, 33365 }, // Ś
+    { 15, 27, 17, 1, 26, 102, 33506 }, // ś
+    { 17, 33, 18, 1, 32, 141, 33608 }, // Ŝ
+    { 15, 27, 17, 1, 26, 102, 33749 }, // ŝ
+    { 17, 33, 18, 1, 25, 141, 33851 }, // Ş
+    { 15, 27, 17, 1, 19, 102, 33992 }, // ş
+    { 17, 33, 18, 1, 32, 141, 34094 }, // Š
+    { 15, 27, 17, 1, 26, 102, 34235 }, // š
+    { 19, 32, 19, 0, 24, 152, 34337 }, // Ţ
+    { 14, 31, 14, 0, 23, 109, 34489 }, // ţ
+    { 19, 32, 19, 0, 32, 152, 34598 }, // Ť
+    { 19, 27, 14, 0, 26, 129, 34816 }, // ť
+    { 19, 24, 19, 0, 24, 114, 34945 }, // Ŧ
+    { 14, 24, 14, 0, 23, 84, 35059 }, // ŧ
+    { 21, 33, 25, 2, 32, 174, 35143 }, // Ũ
+    { 18, 27, 22, 2, 26, 122, 35317 }, // ũ
+    { 21, 31, 25, 2, 30, 163, 35439 }, // Ū
+    { 18, 25, 22, 2, 24, 113, 35602 }, // ū
+    { 21, 33, 25, 2, 32, 174, 35715 }, // Ŭ
+    { 18, 27, 22, 2, 26, 122, 35889 }, // ŭ
+    { 21, 35, 25, 2, 34, 184, 36011 }, // Ů
+    { 18, 29, 22, 2, 28, 131, 36195 }, // ů
+    { 21, 33, 25, 2, 32, 174, 36326 }, // Ű
+    { 18, 27, 22, 2, 26, 122, 36500 }, // ű
+    { 21, 32, 25, 2, 24, 168, 36622 }, // Ų
+    { 18, 27, 22, 2, 19, 122, 36864 }, // ų
+    { 33, 32, 32, 0, 32, 264, 36986 }, // Ŵ
+    { 29, 26, 29, 0, 26, 189, 37250 }, // ŵ
+    { 21, 32, 21, 0, 32, 168, 37439 }, // Ŷ
+    { 20, 34, 19, 0, 26, 170, 37607 }, // ŷ
+    { 21, 32, 21, 0, 32, 168, 37777 }, // Ÿ
+    { 19, 32, 19, 0, 32, 152, 37945 }, // Ź
+    { 15, 26, 16, 1, 26, 98, 38097 }, // ź
+    { 19, 32, 19, 0, 32, 152, 38195 }, // Ż
+    { 15, 26, 16, 1, 26, 98, 38347 }, // ż
+    { 19, 32, 19, 0, 32, 152, 38445 }, // Ž
+    { 15, 26, 16, 1, 26, 98, 38597 }, // ž
+    { 12, 26, 13, 2, 26, 78, 38695 }, // ſ
+    { 10, 6, 0, -18, 26, 15, 38773 }, // ̀
+    { 11, 6, 0, -13, 26, 17, 38788 }, // ́
+    { 14, 6, 0, -7, 26, 21, 38805 }, // ̂
+    { 15, 6, 0, -19, 26, 23, 38826 }, // ̃
+    { 12, 4, 0, -6, 24, 12, 38849 }, // ̄
+    { 14, 5, 0, -7, 29, 18, 38861 }, // ̅
+    { 14, 6, 0, -7, 26, 21, 38879 }, // ̆
+    { 6, 6, 0, -3, 26, 9, 38900 }, // ̇
+    { 12, 6, 0, -6, 26, 18, 38912 }, // ̈
+    { 8, 9, 0, -14, 28, 18, 38930 }, // ̉
+    { 9, 8, 0, -5, 28, 18, 38948 }, // ̊
+    { 16, 6, 0, -6, 26, 24, 38966 }, // ̋
+    { 15, 6, 0, -7, 26, 23, 38990 }, // ̌
+    { 4, 7, 0, -2, 26, 7, 39013 }, // ̍
+    { 10, 7, 0, -5, 26, 18, 39020 }, // ̎
+    { 14, 6, 0, -19, 26, 21, 39038 }, // ̏
+    { 12, 9, 0, -6, 29, 27, 39059 }, // ̐
+    { 14, 6, 0, -7, 26, 21, 39086 }, // ̑
+    { 8, 9, 0, -4, 24, 18, 39107 }, // ̒
+    { 8, 9, 0, -4, 24, 18, 39125 }, // ̓
+    { 8, 9, 0, -4, 24, 18, 39143 }, // ̔
+    { 8, 9, 0, -4, 24, 18, 39161 }, // ̕
+    { 11, 6, 0, -6, -1, 17, 39179 }, // ̖
+    { 10, 6, 0, -5, -1, 15, 39196 }, // ̗
+    { 6, 8, 0, -3, 0, 12, 39211 }, // ̘
+    { 6, 8, 0, -3, 0, 12, 39223 }, // ̙
+    { 9, 9, 10, 0, 26, 21, 39235 }, // ̚
+    { 9, 9, 0, -4, 26, 21, 39256 }, // ̛
+    { 5, 8, 0, -3, 0, 10, 39277 }, // ̜
+    { 8, 6, 0, -4, -1, 12, 39287 }, // ̝
+    { 8, 6, 0, -4, -1, 12, 39299 }, // ̞
+    { 8, 8, 0, -4, 0, 16, 39311 }, // ̟
+    { 8, 3, 0, -4, -3, 6, 39327 }, // ̠
+    { 8, 10, 0, -8, 2, 20, 39333 }, // ̡
+    { 8, 10, 0, 0, 2, 20, 39353 }, // ̢
+    { 7, 6, 0, -15, -2, 11, 39373 }, // ̣
+    { 12, 6, 0, -6, -1, 18, 39384 }, // ̤
+    { 9, 8, 0, -5, 0, 18, 39402 }, // ̥
+    { 6, 6, 0, -3, -2, 9, 39420 }, // ̦
+    { 8, 8, 0, -4, 0, 16, 39429 }, // ̧
+    { 8, 9, 0, -4, 1, 18, 39445 }, // ̨
+    { 4, 7, 0, -2, -1, 7, 39463 }, // ̩
+    { 12, 7, 0, -6, -1, 21, 39470 }, // ̪
+    { 14, 4, 0, -7, -2, 14, 39491 }, // ̫
+    { 15, 6, 0, -7, -1, 23, 39505 }, // ̬
+    { 14, 6, 0, -7, -1, 21, 39528 }, // ̭
+    { 14, 6, 0, -7, -1, 21, 39549 }, // ̮
+    { 14, 6, 0, -7, -1, 21, 39570 }, // ̯
+    { 14, 6, 0, -7, -1, 21, 39591 }, // ̰
+    { 12, 4, 0, -6, -2, 12, 39612 }, // ̱
+    { 16, 3, 0, -8, -3, 12, 39624 }, // ̲
+    { 15, 8, 0, -8, 0, 30, 39636 }, // ̳
+    { 15, 6, 0, -7, 13, 23, 39666 }, // ̴
+    { 14, 5, 0, -7, 12, 18, 39689 }, // ̵
+    { 26, 4, 0, -13, 11, 26, 39707 }, // ̶
+    { 12, 10, 0, -6, 14, 30, 39733 }, // ̷
+    { 14, 28, 0, -7, 26, 98, 39763 }, // ̸
+    { 5, 8, 0, -2, 0, 10, 39861 }, // ̹
+    { 12, 7, 0, -6, -1, 21, 39871 }, // ̺
+    { 14, 8, 0, -7, 0, 28, 39892 }, // ̻
+    { 14, 4, 0, -7, -2, 14, 39920 }, // ̼
+    { 8, 7, 0, -4, 26, 14, 39934 }, // ̽
+    { 6, 10, 0, -3, 29, 15, 39948 }, // ̾
+    { 14, 8, 0, -8, 33, 28, 39963 }, // ̿
+    { 11, 6, 0, -8, 26, 17, 39991 }, // ̀
+    { 10, 6, 0, -2, 26, 15, 40008 }, // ́
+    { 14, 6, 0, -7, 26, 21, 40023 }, // ͂
+    { 7, 7, 0, -4, 26, 13, 40044 }, // ̓
+    { 18, 6, 0, -7, 26, 27, 40057 }, // ̈́
+    { 7, 7, 0, -2, -1, 13, 40084 }, // ͅ
+    { 16, 7, 0, -8, 26, 28, 40097 }, // ͆
+    { 14, 8, 0, -8, 0, 28, 40125 }, // ͇
+    { 10, 7, 0, -5, -1, 18, 40153 }, // ͈
+    { 8, 6, 0, -4, -2, 12, 40171 }, // ͉
+    { 14, 8, 0, -7, 26, 28, 40183 }, // ͊
+    { 14, 14, 0, -7, 32, 49, 40211 }, // ͋
+    { 12, 9, 0, -6, 29, 27, 40260 }, // ͌
+    { 12, 7, 0, -6, -1, 21, 40287 }, // ͍
+    { 8, 8, 0, -4, 0, 16, 40308 }, // ͎
+    { 24, 24, 0, -12, 24, 144, 40324 }, // ͏
+    { 6, 8, 0, -3, 27, 12, 40468 }, // ͐
+    { 5, 8, 0, -2, 27, 10, 40480 }, // ͑
+    { 12, 9, 0, -6, 29, 27, 40490 }, // ͒
+    { 8, 7, 0, -4, -1, 14, 40517 }, // ͓
+    { 6, 7, 0, -3, -1, 11, 40531 }, // ͔
+    { 6, 7, 0, -3, -1, 11, 40542 }, // ͕
+    { 14, 7, 0, -7, -1, 25, 40553 }, // ͖
+    { 5, 8, 0, -2, 27, 10, 40578 }, // ͗
+    { 6, 6, 0, 3, 26, 9, 40588 }, // ͘
+    { 8, 7, 0, -4, -1, 14, 40597 }, // ͙
+    { 14, 8, 0, -7, 0, 28, 40611 }, // ͚
+    { 8, 8, 0, -4, 27, 16, 40639 }, // ͛
+    { 28, 7, 0, -14, -1, 49, 40655 }, // ͜
+    { 28, 7, 0, -14, 26, 49, 40704 }, // ͝
+    { 20, 3, 0, -10, 23, 15, 40753 }, // ͞
+    { 20, 3, 0, -10, -2, 15, 40768 }, // ͟
+    { 28, 6, 0, -14, 26, 42, 40783 }, // ͠
+    { 28, 8, 0, -14, 30, 56, 40825 }, // ͡
+    { 27, 8, 0, -13, 0, 54, 40881 }, // ͢
+    { 8, 9, 0, -4, 29, 18, 40935 }, // ͣ
+    { 9, 9, 0, -4, 29, 21, 40960 }, // ͤ
+    { 3, 11, 0, -1, 31, 9, 40981 }, // ͥ
+    { 9, 9, 0, -4, 29, 21, 40990 }, // ͦ
+    { 9, 8, 0, -4, 28, 18, 41011 }, // ͧ
+    { 7, 9, 0, -3, 29, 16, 41029 }, // ͨ
+    { 8, 11, 0, -4, 31, 22, 41045 }, // ͩ
+    { 9, 11, 0, -4, 31, 25, 41067 }, // ͪ
+    { 13, 9, 0, -6, 29, 30, 41092 }, // ͫ
+    { 6, 9, 0, -2, 29, 14, 41122 }, // ͬ
+    { 7, 10, 0, -3, 30, 18, 41136 }, // ͭ
+    { 9, 8, 0, -4, 28, 18, 41154 }, // ͮ
+    { 10, 8, 0, -5, 28, 20, 41172 }, // ͯ
+    { 15, 32, 19, 2, 32, 120, 41192 }, // Ѐ
+    { 15, 32, 19, 2, 32, 120, 41312 }, // Ё
+    { 25, 25, 26, 0, 24, 157, 41432 }, // Ђ
+    { 15, 32, 19, 3, 32, 120, 41589 }, // Ѓ
+    { 20, 26, 22, 1, 25, 130, 41709 }, // Є
+    { 16, 26, 18, 1, 25, 104, 41839 }, // Ѕ
+    { 6, 24, 11, 2, 24, 36, 41943 }, // І
+    { 11, 32, 11, 0, 32, 88, 41979 }, // Ї
+    { 12, 31, 11, -3, 24, 93, 42067 }, // Ј
+    { 33, 25, 34, 0, 24, 207, 42160 }, // Љ
+    { 31, 24, 35, 3, 24, 186, 42367 }, // Њ
+    { 24, 24, 26, 0, 24, 144, 42553 }, // Ћ
+    { 20, 32, 23, 3, 32, 160, 42697 }, // Ќ
+    { 21, 32, 26, 3, 32, 168, 43008 }, // Ѝ
+    { 22, 33, 22, 0, 32, 182, 43176 }, // Ў
+    { 20, 29, 26, 3, 24, 145, 43358 }, // Џ
+    { 24, 24, 23, 0, 24, 144, 43503 }, // А
+    { 18, 24, 22, 3, 24, 108, 43647 }, // Б
+    { 19, 24, 22, 2, 24, 114, 43755 }, // В
+    { 15, 24, 19, 3, 24, 90, 43869 }, // Г
+    { 26, 29, 26, 0, 24, 189, 43959 }, // Д
+    { 15, 24, 19, 2, 24, 90, 44148 }, // Е
+    { 33, 24, 33, 0, 24, 198, 44238 }, // Ж
+    { 17, 26, 20, 1, 25, 111, 44436 }, // З
+    { 21, 24, 26, 3, 24, 126, 44547 }, // И
+    { 21, 32, 26, 3, 32, 168, 44673 }, // Й
+    { 20, 24, 23, 3, 24, 120, 44841 }, // К
+    { 22, 25, 24, 0, 24, 138, 45056 }, // Л
+    { 26, 24, 31, 3, 24, 156, 45194 }, // М
+    { 20, 24, 26, 3, 24, 120, 45350 }, // Н
+    { 24, 26, 26, 1, 25, 156, 45470 }, // О
+    { 20, 24, 25, 3, 24, 120, 45626 }, // П
+    { 18, 24, 21, 2, 24, 108, 45746 }, // Р
+    { 20, 26, 22, 1, 25, 130, 45854 }, // С
+    { 19, 24, 19, 0, 24, 114, 45984 }, // Т
+    { 22, 25, 22, 0, 24, 138, 46098 }, // У
+    { 28, 26, 30, 1, 25, 182, 46236 }, // Ф
+    { 23, 24, 22, 0, 24, 138, 46418 }, // Х
+    { 23, 29, 26, 3, 24, 167, 46556 }, // Ц
+    { 19, 24, 24, 2, 24, 114, 46723 }, // Ч
+    { 31, 24, 36, 2, 24, 186, 46837 }, // Ш
+    { 34, 30, 36, 2, 24, 255, 47104 }, // Щ
+    { 24, 24, 25, 0, 24, 144, 47359 }, // Ъ
+    { 25, 24, 31, 3, 24, 150, 47503 }, // Ы
+    { 17, 24, 22, 3, 24, 102, 47653 }, // Ь
+    { 19, 26, 22, 1, 25, 124, 47755 }, // Э
+    { 30, 26, 34, 3, 25, 195, 47879 }, // Ю
+    { 20, 24, 23, 0, 24, 120, 48074 }, // Я
+    { 17, 20, 20, 1, 19, 85, 48194 }, // а
+    { 19, 27, 21, 1, 26, 129, 48279 }, // б
+    { 17, 19, 20, 2, 19, 81, 48408 }, // в
+    { 14, 19, 16, 2, 19, 67, 48489 }, // г
+    { 21, 24, 21, 0, 19, 126, 48556 }, // д
+    { 18, 20, 19, 1, 19, 90, 48682 }, // е
+    { 29, 19, 29, 0, 19, 138, 48772 }, // ж
+    { 15, 20, 17, 1, 19, 75, 48910 }, // з
+    { 18, 19, 22, 2, 19, 86, 48985 }, // и
+    { 18, 26, 22, 2, 26, 117, 49152 }, // й
+    { 19, 19, 21, 2, 19, 91, 49269 }, // к
+    { 19, 20, 21, 0, 19, 95, 49360 }, // л
+    { 24, 19, 28, 2, 19, 114, 49455 }, // м
+    { 18, 19, 22, 2, 19, 86, 49569 }, // н
+    { 19, 20, 21, 1, 19, 95, 49655 }, // о
+    { 17, 19, 22, 2, 19, 81, 49750 }, // п
+    { 18, 27, 21, 2, 19, 122, 49831 }, // р
+    { 16, 20, 17, 1, 19, 80, 49953 }, // с
+    { 17, 19, 17, 0, 19, 81, 50033 }, // т
+    { 21, 27, 19, -1, 19, 142, 50114 }, // у
+    { 25, 34, 27, 1, 26, 213, 50256 }, // ф
+    { 20, 19, 19, 0, 19, 95, 50469 }, // х
+    { 20, 24, 22, 2, 19, 120, 50564 }, // ц
+    { 17, 19, 21, 2, 19, 81, 50684 }, // ч
+    { 28, 19, 32, 2, 19, 133, 50765 }, // ш
+    { 30, 24, 32, 2, 19, 180, 50898 }, // щ
+    { 22, 19, 22, 0, 19, 105, 51078 }, // ъ
+    { 24, 19, 28, 2, 19, 114, 51200 }, // ы
+    { 17, 19, 20, 2, 19, 81, 51314 }, // ь
+    { 16, 20, 17, 1, 19, 80, 51395 }, // э
+    { 25, 20, 28, 2, 19, 125, 51475 }, // ю
+    { 18, 19, 20, 0, 19, 86, 51600 }, // я
+    { 18, 27, 19, 1, 26, 122, 51686 }, // ѐ
+    { 18, 26, 19, 1, 25, 117, 51808 }, // ё
+    { 20, 34, 22, 0, 26, 170, 51925 }, // ђ
+    { 14, 26, 16, 2, 26, 91, 52095 }, // ѓ
+    { 16, 20, 17, 1, 19, 80, 52186 }, // є
+    { 15, 20, 17, 1, 19, 75, 52266 }, // ѕ
+    { 6, 26, 10, 2, 26, 39, 52341 }, // і
+    { 10, 26, 10, 0, 26, 65, 52380 }, // ї
+    { 10, 34, 10, -2, 26, 85, 52445 }, // ј
+    { 29, 20, 30, 0, 19, 145, 52530 }, // љ
+    { 28, 19, 31, 2, 19, 133, 52675 }, // њ
+    { 20, 26, 22, 0, 26, 130, 52808 }, // ћ
+    { 19, 26, 21, 2, 26, 124, 52938 }, // ќ
+    { 18, 26, 22, 2, 26, 117, 53062 }, // ѝ
+    { 21, 34, 19, -1, 26, 179, 53248 }, // ў
+    { 17, 24, 22, 2, 19, 102, 53427 }, // џ
+    { 32, 24, 32, 0, 24, 192, 53529 }, // Ѡ
+    { 29, 19, 30, 0, 19, 138, 53721 }, // ѡ
+    { 21, 24, 22, 0, 24, 126, 53859 }, // Ѣ
+    { 21, 22, 22, 0, 22, 116, 53985 }, // ѣ
+    { 28, 26, 32, 3, 25, 182, 54101 }, // Ѥ
+    { 24, 20, 27, 2, 19, 120, 54283 }, // ѥ
+    { 25, 24, 24, 0, 24, 150, 54403 }, // Ѧ
+    { 22, 19, 21, 0, 19, 105, 54553 }, // ѧ
+    { 31, 24, 34, 3, 24, 186, 54658 }, // Ѩ
+    { 29, 19, 30, 2, 19, 138, 54844 }, // ѩ
+    { 27, 24, 27, 0, 24, 162, 54982 }, // Ѫ
+    { 21, 19, 21, 0, 19, 100, 55144 }, // ѫ
+    { 33, 24, 36, 3, 24, 198, 55296 }, // Ѭ
+    { 27, 19, 29, 2, 19, 129, 55494 }, // ѭ
+    { 20, 37, 21, 0, 29, 185, 55623 }, // Ѯ
+    { 18, 31, 19, 0, 23, 140, 55808 }, // ѯ
+    { 25, 24, 29, 2, 24, 150, 55948 }, // Ѱ
+    { 24, 34, 28, 2, 26, 204, 56098 }, // ѱ
+    { 24, 26, 26, 1, 25, 156, 56302 }, // Ѳ
+    { 19, 20, 21, 1, 19, 95, 56458 }, // ѳ
+    { 24, 24, 24, 0, 24, 144, 56553 }, // Ѵ
+    { 21, 19, 20, 0, 19, 100, 56697 }, // ѵ
+    { 24, 32, 24, 0, 32, 192, 56797 }, // Ѷ
+    { 21, 26, 20, 0, 26, 137, 56989 }, // ѷ
+    { 43, 33, 44, 1, 25, 355, 57344 }, // Ѹ
+    { 39, 27, 39, 1, 19, 264, 57699 }, // ѹ
+    { 25, 29, 28, 1, 26, 182, 57963 }, // Ѻ
+    { 21, 23, 23, 1, 21, 121, 58145 }, // ѻ
+    { 34, 37, 36, 1, 36, 315, 58266 }, // Ѽ
+    { 29, 32, 32, 1, 31, 232, 58581 }, // ѽ
+    { 32, 31, 32, 0, 31, 248, 58813 }, // Ѿ
+    { 29, 25, 30, 0, 25, 182, 59061 }, // ѿ
+    { 21, 33, 23, 1, 25, 174, 59392 }, // Ҁ
+    { 16, 27, 17, 1, 19, 108, 59566 }, // ҁ
+    { 18, 22, 20, 1, 21, 99, 59674 }, // ҂
+    { 14, 7, 0, -16, 25, 25, 59773 }, // ҃
+    { 14, 6, 0, -16, 26, 21, 59798 }, // ҄
+    { 6, 8, 0, -12, 27, 12, 59819 }, // ҅
+    { 6, 8, 0, -12, 27, 12, 59831 }, // ҆
+    { 14, 6, 0, -7, 31, 21, 59843 }, // ҇
+    { 38, 36, 0, -19, 27, 342, 59864 }, // ҈
+    { 38, 38, 0, -19, 28, 361, 60206 }, // ҉
+    { 27, 39, 31, 3, 32, 264, 60567 }, // Ҋ
+    { 25, 34, 27, 2, 27, 213, 60831 }, // ҋ
+    { 20, 24, 21, 0, 24, 120, 61044 }, // Ҍ
+    { 20, 26, 20, 0, 26, 130, 61164 }, // ҍ
+    { 17, 24, 21, 3, 24, 102, 61294 }, // Ҏ
+    { 18, 27, 21, 2, 19, 122, 61440 }, // ҏ
+    { 17, 29, 19, 2, 29, 124, 61562 }, // Ґ
+    { 14, 24, 17, 2, 24, 84, 61686 }, // ґ
+    { 18, 24, 19, 0, 24, 108, 61770 }, // Ғ
+    { 16, 19, 16, 0, 19, 76, 61878 }, // ғ
+    { 20, 33, 24, 3, 24, 165, 61954 }, // Ҕ
+    { 17, 28, 20, 2, 19, 119, 62119 }, // ҕ
+    { 34, 31, 34, 0, 24, 264, 62238 }, // Җ
+    { 32, 26, 31, -1, 19, 208, 62502 }, // җ
+    { 17, 33, 20, 1, 25, 141, 62710 }, // Ҙ
+    { 15, 27, 17, 1, 19, 102, 62851 }, // ҙ
+    { 22, 31, 25, 3, 24, 171, 62953 }, // Қ
+    { 20, 26, 22, 2, 19, 130, 63124 }, // қ
+    { 21, 24, 22, 2, 24, 126, 63254 }, // Ҝ
+    { 19, 19, 21, 2, 19, 91, 63380 }, // ҝ
+    { 22, 24, 23, 1, 24, 132, 63488 }, // Ҟ
+    { 21, 26, 21, 0, 26, 137, 63620 }, // ҟ
+    { 25, 24, 24, 0, 24, 150, 63757 }, // Ҡ
+    { 24, 19, 23, 0, 19, 114, 63907 }, // ҡ
+    { 25, 31, 28, 3, 24, 194, 64021 }, // Ң
+    { 22, 26, 25, 2, 19, 143, 64215 }, // ң
+    { 25, 24, 28, 3, 24, 150, 64358 }, // Ҥ
+    { 24, 19, 25, 2, 19, 114, 64508 }, // ҥ
+    { 33, 33, 38, 3, 24, 273, 64622 }, // Ҧ
+    { 27, 28, 30, 2, 19, 189, 64895 }, // ҧ
+    { 24, 27, 26, 1, 25, 162, 65084 }, // Ҩ
+    { 20, 21, 22, 1, 19, 105, 65246 }, // ҩ
+    { 20, 33, 21, 1, 25, 165, 65351 }, // Ҫ
+    { 16, 27, 17, 1, 19, 108, 65536 }, // ҫ
+    { 19, 31, 19, 0, 24, 148, 65644 }, // Ҭ
+    { 18, 26, 18, 0, 19, 117, 65792 }, // ҭ
+    { 21, 24, 21, 0, 24, 126, 65909 }, // Ү
+    { 20, 27, 19, 0, 19, 135, 66035 }, // ү
+    { 21, 24, 21, 0, 24, 126, 66170 }, // Ұ
+    { 20, 27, 19, 0, 19, 135, 66296 }, // ұ
+    { 25, 31, 25, 0, 24, 194, 66431 }, // Ҳ
+    { 21, 26, 21, 0, 19, 137, 66625 }, // ҳ
+    { 31, 31, 31, 0, 24, 241, 66762 }, // Ҵ
+    { 26, 26, 26, 0, 19, 169, 67003 }, // ҵ
+    { 26, 31, 27, 1, 24, 202, 67172 }, // Ҷ
+    { 22, 26, 24, 2, 19, 143, 67374 }, // ҷ
+    { 20, 24, 25, 2, 24, 120, 67584 }, // Ҹ
+    { 19, 19, 22, 1, 19, 91, 67704 }, // ҹ
+    { 21, 24, 25, 2, 24, 126, 67795 }, // Һ
+    { 18, 26, 22, 2, 26, 117, 67921 }, // һ
+    { 29, 26, 32, 0, 25, 189, 68038 }, // Ҽ
+    { 24, 20, 24, -1, 19, 120, 68227 }, // ҽ
+    { 29, 32, 32, 0, 25, 232, 68347 }, // Ҿ
+    { 24, 26, 24, -1, 19, 156, 68579 }, // ҿ
+    { 11, 24, 13, 1, 24, 66, 68735 }, // Ӏ
+    { 33, 32, 33, 0, 32, 264, 68801 }, // Ӂ
+    { 29, 26, 29, 0, 26, 189, 69065 }, // ӂ
+    { 21, 33, 25, 3, 24, 174, 69254 }, // Ӄ
+    { 19, 28, 22, 2, 19, 133, 69428 }, // ӄ
+    { 28, 31, 28, 0, 24, 217, 69632 }, // Ӆ
+    { 24, 26, 24, 0, 19, 156, 69849 }, // ӆ
+    { 20, 33, 26, 3, 24, 165, 70005 }, // Ӈ
+    { 18, 28, 22, 2, 19, 126, 70170 }, // ӈ
+    { 25, 31, 29, 3, 24, 194, 70296 }, // Ӊ
+    { 23, 26, 25, 2, 19, 150, 70490 }, // ӊ
+    { 20, 31, 25, 2, 24, 155, 70640 }, // Ӌ
+    { 18, 26, 22, 2, 19, 117, 70795 }, // ӌ
+    { 31, 31, 35, 3, 24, 241, 70912 }, // Ӎ
+    { 29, 26, 31, 2, 19, 189, 71153 }, // ӎ
+    { 11, 24, 13, 1, 24, 66, 71342 }, // ӏ
+    { 24, 32, 23, 0, 32, 192, 71408 }, // Ӑ
+    { 17, 27, 20, 1, 26, 115, 71680 }, // ӑ
+    { 24, 32, 23, 0, 32, 192, 71795 }, // Ӓ
+    { 17, 27, 20, 1, 26, 115, 71987 }, // ӓ
+    { 30, 24, 32, 0, 24, 180, 72102 }, // Ӕ
+    { 29, 20, 31, 1, 19, 145, 72282 }, // ӕ
+    { 14, 32, 19, 3, 32, 112, 72427 }, // Ӗ
+    { 18, 27, 20, 1, 26, 122, 72539 }, // ӗ
+    { 24, 26, 27, 2, 25, 156, 72661 }, // Ә
+    { 18, 20, 20, 1, 19, 90, 72817 }, // ә
+    { 24, 33, 27, 2, 32, 198, 72907 }, // Ӛ
+    { 18, 27, 20, 1, 26, 122, 73105 }, // ӛ
+    { 33, 32, 33, 0, 32, 264, 73227 }, // Ӝ
+    { 29, 26, 29, 0, 26, 189, 73491 }, // ӝ
+    { 17, 33, 20, 1, 32, 141, 73728 }, // Ӟ
+    { 15, 27, 17, 1, 26, 102, 73869 }, // ӟ
+    { 19, 25, 20, 0, 24, 119, 73971 }, // Ӡ
+    { 19, 27, 19, 0, 19, 129, 74090 }, // ӡ
+    { 21, 30, 26, 3, 30, 158, 74219 }, // Ӣ
+    { 18, 24, 22, 2, 24, 108, 74377 }, // ӣ
+    { 21, 32, 26, 3, 32, 168, 74485 }, // Ӥ
+    { 18, 26, 22, 2, 26, 117, 74653 }, // ӥ
+    { 24, 33, 26, 1, 32, 198, 74770 }, // Ӧ
+    { 19, 27, 21, 1, 26, 129, 74968 }, // ӧ
+    { 24, 26, 26, 1, 25, 156, 75097 }, // Ө
+    { 19, 20, 21, 1, 19, 95, 75253 }, // ө
+    { 24, 33, 26, 1, 32, 198, 75348 }, // Ӫ
+    { 19, 27, 21, 1, 26, 129, 75546 }, // ӫ
+    { 19, 33, 22, 1, 32, 157, 75776 }, // Ӭ
+    { 16, 27, 17, 1, 26, 108, 75933 }, // ӭ
+    { 22, 31, 22, 0, 30, 171, 76041 }, // Ӯ
+    { 21, 32, 19, -1, 24, 168, 76212 }, // ӯ
+    { 22, 33, 22, 0, 32, 182, 76380 }, // Ӱ
+    { 21, 34, 19, -1, 26, 179, 76562 }, // ӱ
+    { 22, 33, 22, 0, 32, 182, 76741 }, // Ӳ
+    { 20, 34, 19, 0, 26, 170, 76923 }, // ӳ
+    { 19, 32, 24, 2, 32, 152, 77093 }, // Ӵ
+    { 17, 26, 21, 2, 26, 111, 77245 }, // ӵ
+    { 16, 31, 19, 3, 24, 124, 77356 }, // Ӷ
+    { 14, 26, 16, 2, 19, 91, 77480 }, // ӷ
+    { 25, 32, 31, 3, 32, 200, 77571 }, // Ӹ
+    { 24, 26, 28, 2, 26, 156, 77824 }, // ӹ
+    { 18, 33, 19, 0, 24, 149, 77980 }, // Ӻ
+    { 16, 27, 16, 0, 19, 108, 78129 }, // ӻ
+    { 24, 33, 24, 0, 24, 198, 78237 }, // Ӽ
+    { 21, 27, 22, 0, 19, 142, 78435 }, // ӽ
+    { 23, 24, 22, 0, 24, 138, 78577 }, // Ӿ
+    { 20, 19, 19, 0, 19, 95, 78715 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 78810 }, //  
+    { 0, 0, 33, 0, 0, 0, 78810 }, //  
+    { 0, 0, 17, 0, 0, 0, 78810 }, //  
+    { 0, 0, 33, 0, 0, 0, 78810 }, //  
+    { 0, 0, 11, 0, 0, 0, 78810 }, //  
+    { 0, 0, 8, 0, 0, 0, 78810 }, //  
+    { 0, 0, 6, 0, 0, 0, 78810 }, //  
+    { 0, 0, 19, 0, 0, 0, 78810 }, //  
+    { 0, 0, 9, 0, 0, 0, 78810 }, //  
+    { 0, 0, 6, 0, 0, 0, 78810 }, //  
+    { 0, 0, 3, 0, 0, 0, 78810 }, //  
+    { 0, 0, 0, 0, 0, 0, 78810 }, // ​
+    { 0, 0, 0, 0, 0, 0, 78810 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 78810 }, // ‍
+    { 9, 28, 0, -1, 23, 63, 78810 }, // ‎
+    { 9, 28, 0, -8, 23, 63, 78873 }, // ‏
+    { 10, 5, 11, 0, 11, 13, 78936 }, // ‐
+    { 10, 5, 11, 0, 11, 13, 78949 }, // ‑
+    { 17, 5, 19, 1, 14, 22, 78962 }, // ‒
+    { 15, 4, 17, 1, 11, 15, 78984 }, // –
+    { 32, 4, 33, 1, 11, 32, 78999 }, // —
+    { 32, 4, 33, 1, 11, 32, 79031 }, // ―
+    { 13, 34, 18, 3, 26, 111, 79063 }, // ‖
+    { 15, 8, 14, -1, 0, 30, 79174 }, // ‗
+    { 7, 9, 7, 0, 24, 16, 79204 }, // ‘
+    { 7, 9, 7, 0, 24, 16, 79220 }, // ’
+    { 8, 9, 10, 0, 5, 18, 79236 }, // ‚
+    { 7, 9, 7, 0, 24, 16, 79254 }, // ‛
+    { 15, 9, 15, 0, 24, 34, 79270 }, // “
+    { 15, 9, 15, 0, 24, 34, 79304 }, // ”
+    { 15, 9, 17, 1, 4, 34, 79338 }, // „
+    { 15, 9, 15, 0, 24, 34, 79372 }, // ‟
+    { 15, 26, 17, 1, 26, 98, 79406 }, // †
+    { 15, 26, 17, 1, 26, 98, 79504 }, // ‡
+    { 10, 11, 13, 1, 18, 28, 79602 }, // •
+    { 12, 13, 13, 1, 19, 39, 79630 }, // ‣
+    { 7, 7, 17, 5, 6, 13, 79669 }, // ․
+    { 17, 7, 19, 1, 6, 30, 79682 }, // ‥
+    { 26, 7, 29, 1, 6, 46, 79712 }, // …
+    { 7, 7, 9, 1, 12, 13, 79758 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 79771 }, //  
+    { 0, 0, 20, 0, 0, 0, 79771 }, //  
+    { 9, 26, 0, -1, 21, 59, 79771 }, // ‪
+    { 9, 26, 0, -8, 21, 59, 79872 }, // ‫
+    { 8, 28, 0, -4, 23, 56, 79931 }, // ‬
+    { 8, 28, 0, -4, 23, 56, 79987 }, // ‭
+    { 8, 28, 0, -4, 23, 56, 80043 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 80099 }, //  
+    { 41, 26, 43, 1, 25, 267, 80099 }, // ‰
+    { 55, 26, 56, 0, 25, 358, 80366 }, // ‱
+    { 10, 9, 10, 1, 24, 23, 80724 }, // ′
+    { 17, 9, 17, 1, 24, 39, 80747 }, // ″
+    { 25, 9, 25, 1, 24, 57, 80786 }, // ‴
+    { 10, 9, 14, 1, 24, 23, 80843 }, // ‵
+    { 17, 9, 21, 1, 24, 39, 80866 }, // ‶
+    { 25, 9, 29, 1, 24, 57, 80905 }, // ‷
+    { 13, 11, 14, 0, 3, 36, 80962 }, // ‸
+    { 10, 16, 12, 1, 17, 40, 80998 }, // ‹
+    { 10, 16, 12, 1, 17, 40, 81038 }, // ›
+    { 26, 26, 28, 1, 25, 169, 81078 }, // ※
+    { 17, 25, 19, 1, 24, 107, 81247 }, // ‼
+    { 16, 26, 16, 0, 25, 104, 81354 }, // ‽
+    { 18, 4, 17, -1, 29, 18, 81458 }, // ‾
+    { 20, 8, 20, 0, 0, 40, 81476 }, // ‿
+    { 20, 8, 20, 0, 27, 40, 81516 }, // ⁀
+    { 14, 22, 14, 0, 14, 77, 81556 }, // ⁁
+    { 37, 31, 37, 0, 26, 287, 81633 }, // ⁂
+    { 10, 5, 11, 1, 11, 13, 81920 }, // ⁃
+    { 18, 24, 4, -7, 24, 108, 81933 }, // ⁄
+    { 9, 30, 11, 2, 24, 68, 82041 }, // ⁅
+    { 9, 30, 11, 0, 24, 68, 82109 }, // ⁆
+    { 31, 26, 32, 0, 25, 202, 82177 }, // ⁇
+    { 24, 26, 25, 0, 25, 156, 82379 }, // ⁈
+    { 24, 26, 25, 1, 25, 156, 82535 }, // ⁉
+    { 17, 19, 20, 1, 19, 81, 82691 }, // ⁊
+    { 18, 31, 22, 2, 26, 140, 82772 }, // ⁋
+    { 18, 18, 22, 1, 19, 81, 82912 }, // ⁌
+    { 19, 18, 22, 2, 19, 86, 82993 }, // ⁍
+    { 18, 17, 18, 0, 9, 77, 83079 }, // ⁎
+    { 8, 24, 10, 1, 19, 48, 83156 }, // ⁏
+    { 20, 35, 20, 0, 27, 175, 83204 }, // ⁐
+    { 18, 34, 18, 0, 26, 153, 83379 }, // ⁑
+    { 14, 26, 14, 0, 25, 91, 83532 }, // ⁒
+    { 32, 7, 33, 1, 13, 56, 83623 }, // ⁓
+    { 20, 8, 20, 0, 0, 40, 83679 }, // ⁔
+    { 17, 17, 19, 1, 17, 73, 83719 }, // ⁕
+    { 17, 26, 19, 1, 25, 111, 83792 }, // ⁖
+    { 31, 9, 31, 1, 24, 70, 83968 }, // ⁗
+    { 27, 26, 29, 1, 25, 176, 84038 }, // ⁘
+    { 27, 26, 29, 1, 25, 176, 84214 }, // ⁙
+    { 7, 26, 10, 1, 25, 46, 84390 }, // ⁚
+    { 21, 28, 23, 1, 27, 147, 84436 }, // ⁛
+    { 27, 27, 28, 1, 25, 183, 84583 }, // ⁜
+    { 7, 27, 9, 1, 26, 48, 84766 }, // ⁝
+    { 7, 26, 10, 1, 25, 46, 84814 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 84860 }, //  
+    { 0, 0, 20, 0, 0, 0, 84860 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 84860 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 84860 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 84860 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 84860 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 84860 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 84860 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 84860 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 84860 }, // ⁩
+    { 8, 28, 0, -4, 23, 56, 84860 }, // ⁪
+    { 8, 28, 0, -4, 23, 56, 84916 }, // ⁫
+    { 8, 28, 0, -4, 23, 56, 84972 }, // ⁬
+    { 8, 29, 0, -4, 24, 58, 85028 }, // ⁭
+    { 8, 28, 0, -4, 23, 56, 85086 }, // ⁮
+    { 8, 28, 0, -4, 23, 56, 85142 }, // ⁯
+    { 12, 16, 13, 0, 29, 48, 85198 }, // ⁰
+    { 5, 16, 6, 1, 25, 20, 85246 }, // ⁱ
+    { 13, 16, 13, 0, 29, 52, 85266 }, // ⁴
+    { 11, 16, 13, 1, 29, 44, 85318 }, // ⁵
+    { 12, 16, 13, 0, 29, 48, 85362 }, // ⁶
+    { 12, 16, 13, 0, 29, 48, 85410 }, // ⁷
+    { 12, 16, 13, 0, 29, 48, 85458 }, // ⁸
+    { 12, 16, 13, 0, 29, 48, 85506 }, // ⁹
+    { 10, 10, 12, 1, 25, 25, 85554 }, // ⁺
+    { 10, 4, 12, 1, 22, 10, 85579 }, // ⁻
+    { 10, 7, 12, 1, 23, 18, 85589 }, // ⁼
+    { 6, 20, 8, 2, 31, 30, 85607 }, // ⁽
+    { 6, 20, 8, 0, 31, 30, 85637 }, // ⁾
+    { 12, 12, 14, 1, 21, 36, 85667 }, // ⁿ
+    { 12, 16, 13, 0, 11, 48, 85703 }, // ₀
+    { 9, 16, 13, 1, 11, 36, 85751 }, // ₁
+    { 12, 16, 13, 0, 11, 48, 85787 }, // ₂
+    { 12, 16, 13, 0, 11, 48, 85835 }, // ₃
+    { 13, 16, 13, 0, 11, 52, 85883 }, // ₄
+    { 11, 16, 13, 1, 11, 44, 85935 }, // ₅
+    { 12, 16, 13, 0, 11, 48, 86016 }, // ₆
+    { 12, 16, 13, 0, 11, 48, 86064 }, // ₇
+    { 12, 16, 13, 0, 11, 48, 86112 }, // ₈
+    { 12, 16, 13, 0, 11, 48, 86160 }, // ₉
+    { 10, 10, 12, 1, 8, 25, 86208 }, // ₊
+    { 10, 4, 12, 1, 5, 10, 86233 }, // ₋
+    { 10, 7, 12, 1, 6, 18, 86243 }, // ₌
+    { 6, 20, 8, 2, 13, 30, 86261 }, // ₍
+    { 6, 20, 8, 0, 13, 30, 86291 }, // ₎
+    { 12, 12, 13, 0, 8, 36, 86321 }, // ₐ
+    { 11, 12, 13, 1, 8, 33, 86357 }, // ₑ
+    { 12, 12, 14, 1, 8, 36, 86390 }, // ₒ
+    { 13, 12, 13, 0, 8, 39, 86426 }, // ₓ
+    { 12, 12, 13, 0, 8, 36, 86465 }, // ₔ
+    { 12, 16, 14, 1, 12, 48, 86501 }, // ₕ
+    { 13, 16, 13, 1, 12, 52, 86549 }, // ₖ
+    { 4, 16, 6, 1, 12, 16, 86601 }, // ₗ
+    { 19, 12, 21, 1, 8, 57, 86617 }, // ₘ
+    { 12, 12, 14, 1, 8, 36, 86674 }, // ₙ
+    { 12, 16, 14, 1, 8, 48, 86710 }, // ₚ
+    { 10, 12, 11, 0, 8, 30, 86758 }, // ₛ
+    { 9, 15, 9, 0, 11, 34, 86788 }, // ₜ
+    { 19, 25, 19, 0, 25, 119, 86822 }, // ₠
+    { 19, 28, 20, 1, 26, 133, 86941 }, // ₡
+    { 18, 26, 19, 1, 25, 117, 87074 }, // ₢
+    { 18, 24, 19, 0, 24, 108, 87191 }, // ₣
+    { 18, 25, 19, 1, 25, 113, 87299 }, // ₤
+    { 29, 27, 33, 2, 23, 196, 87412 }, // ₥
+    { 19, 24, 19, 0, 24, 114, 87608 }, // ₦
+    { 27, 25, 30, 2, 24, 169, 87722 }, // ₧
+    { 28, 25, 31, 2, 24, 175, 88064 }, // ₨
+    { 25, 24, 25, 0, 24, 150, 88239 }, // ₩
+    { 26, 24, 31, 2, 24, 156, 88389 }, // ₪
+    { 21, 32, 22, 1, 26, 168, 88545 }, // ₫
+    { 18, 25, 19, 1, 24, 113, 88713 }, // €
+    { 20, 24, 19, 0, 24, 120, 88826 }, // ₭
+    { 19, 24, 19, 0, 24, 114, 88946 }, // ₮
+    { 33, 33, 34, 0, 25, 273, 89060 }, // ₯
+    { 19, 33, 20, 0, 25, 157, 89333 }, // ₰
+    { 19, 24, 19, 0, 24, 114, 89490 }, // ₱
+    { 21, 29, 24, 1, 26, 153, 89604 }, // ₲
+    { 22, 24, 22, 0, 24, 132, 89757 }, // ₳
+    { 19, 26, 19, 0, 25, 124, 89889 }, // ₴
+    { 20, 29, 21, 1, 26, 145, 90112 }, // ₵
+    { 23, 24, 23, 0, 23, 138, 90257 }, // ₶
+    { 24, 28, 24, 0, 25, 168, 90395 }, // ₷
+    { 19, 24, 19, 0, 24, 114, 90563 }, // ₸
+    { 16, 24, 19, 2, 24, 96, 90677 }, // ₹
+    { 19, 25, 19, 0, 24, 119, 90773 }, // ₺
+    { 27, 26, 27, 0, 25, 176, 90892 }, // ₻
+    { 27, 24, 29, 1, 24, 162, 91068 }, // ₼
+    { 20, 24, 20, 0, 24, 120, 91230 }, // ₽
+    { 24, 26, 26, 1, 26, 156, 91350 }, // ₾
+    { 15, 32, 19, 3, 28, 120, 91506 }, // ₿
+    { 16, 25, 17, 1, 19, 100, 91626 }, // ⃀
+    { 17, 5, 19, 1, 14, 22, 91726 }, // −
+    { 31, 32, 33, 1, 26, 248, 91748 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_boldIntervals[] = {
@@ -6467,4 +3541,9 @@ static const EpdFontData notosans_16_bold = {
     36,
     -10,
     true,
+    notosans_16_boldBlockOffsets,
+    notosans_16_boldDirectGlyphs,
+    notosans_16_boldGlyphPages,
+    256,
+    notosans_16_boldPageGlyphs,
 };
@@ -2,5914 +2,3046 @@
  * generated by fontconvert.py
  * name: notosans_16_bolditalic
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py notosans_16_bolditalic 16 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_16_bolditalic 16 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_bolditalicBitmaps[94410] = {
-    0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0x80, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x0F,
-    0xF4, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x4B, 0xF8, 0x3F, 0xC3, 0xFD, 0x1F, 0xF0, 0xFF,
-    0x07, 0xF8, 0x3F, 0x82, 0xFD, 0x1F, 0xD0, 0xBF, 0x07, 0xF0, 0x3F, 0x82, 0xFC, 0x0F, 0xD0, 0xBD,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x41, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00,
-    0x00, 0xFE, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x01, 0x5B, 0xF5, 0x7F, 0xD5, 0x40, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00,
-    0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xD0,
-    0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xF7, 0xE6, 0xF0, 0x02, 0xFF, 0x4F,
-    0x40, 0x00, 0x0B, 0xFC, 0x3C, 0x00, 0x00, 0x2F, 0xF9, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x03, 0xD7, 0xFF, 0x00, 0x00, 0x0F, 0x0F,
-    0xFC, 0x09, 0x00, 0x7C, 0x7F, 0xE0, 0x3F, 0x92, 0xF7, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xE9, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0,
-    0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC2,
-    0xFD, 0x00, 0xBF, 0x00, 0x02, 0xFE, 0x0B, 0xF4, 0x07, 0xF4, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x3F,
-    0x80, 0x00, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x03,
-    0xFC, 0x1F, 0xE1, 0xFD, 0x0A, 0x90, 0x0F, 0xF0, 0xFF, 0x4F, 0xE2, 0xFF, 0xF0, 0x3F, 0xEF, 0xFC,
-    0xFF, 0x3F, 0xFF, 0xE0, 0xBF, 0xFF, 0xCB, 0xF2, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x7F, 0x4F, 0xF4,
-    0xFF, 0x40, 0x6E, 0x43, 0xF8, 0x7F, 0x82, 0xFD, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x0B, 0xF4, 0x00,
-    0x02, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0xFE, 0x00,
-    0xFF, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0xBF, 0x40, 0x0F, 0xF1, 0xFF,
-    0x00, 0x07, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x07,
-    0xFC, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0x9F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x2F, 0xF0, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0xFF, 0xFC,
-    0x0B, 0xFC, 0x0F, 0xFF, 0x3F, 0xF8, 0x3F, 0xE0, 0x7F, 0xF0, 0x3F, 0xF7, 0xFF, 0x02, 0xFF, 0x40,
-    0x7F, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0xFF, 0xFC, 0x00, 0xFF,
-    0xF0, 0x07, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFB, 0xFF, 0x40, 0x02, 0xFF, 0xFE, 0x0B, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE2, 0xFE, 0x3F, 0xD3, 0xFC, 0x3F, 0x87, 0xF4, 0x7F, 0x0B, 0xF0, 0xBD, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0,
-    0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
-    0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x0E, 0x00, 0xFD, 0x00, 0x07, 0xF8, 0x3F, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x14, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xD1, 0x64, 0x0B, 0xFE,
-    0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0x00, 0x02, 0xFE, 0x0F, 0xE0, 0x00, 0x1F, 0x03, 0xFC, 0x00, 0x01,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x02, 0xAA, 0xBF, 0xEA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x7F, 0xD0, 0x2F, 0xF0, 0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFC,
-    0x01, 0xFE, 0x00, 0x15, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xFF, 0x2F, 0xFC, 0xBF, 0xF1, 0xFF, 0x40, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF8,
-    0x2F, 0xF8, 0x0B, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F, 0xFC, 0x1F, 0xF8, 0x00, 0xFF, 0xC3,
-    0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x02, 0xFF, 0x8F, 0xFC, 0x00, 0x3F, 0xF4, 0xFF,
-    0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x0F, 0xFD, 0x0F, 0xFC, 0x01, 0xFF,
-    0xC0, 0xBF, 0xE0, 0x7F, 0xF4, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xEF, 0xFC, 0x03, 0xFC, 0x3F, 0xE0, 0x07, 0x81, 0xFF, 0x40, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0x41, 0xFF, 0xE0, 0x01, 0xE0, 0x01, 0xFF, 0xC0, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xE0, 0x0F, 0xFF, 0x00, 0x10, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x1A, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0xE4, 0x00, 0x1F, 0xFF, 0x0F, 0xFE, 0xBF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE2,
-    0xFF, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x01, 0xFF, 0x01, 0xFF, 0x40,
-    0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xE5, 0x55, 0x40, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x2D, 0x00,
-    0x0B, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x50, 0x00, 0x1F, 0xF1, 0xFF, 0xF0, 0x02, 0xFF, 0xBF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xF5, 0xFF, 0xF0, 0x7F, 0xF8, 0x03, 0xFF, 0x07, 0xFF,
-    0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x03, 0xFF,
-    0x07, 0xFD, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x1F, 0xFC, 0x03, 0xFF, 0xEF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x05, 0x55, 0x55, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFA, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0xFF, 0xD0, 0x0F,
-    0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0x42,
-    0xFF, 0x40, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0xFF, 0xD0, 0x03, 0xFF, 0x81, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x02, 0xFF, 0x80, 0xFF, 0xC0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F,
-    0xE0, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0xBF, 0xF9, 0x7F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0x80, 0xFF, 0xD1, 0xFF, 0xC0, 0x1F, 0xF8, 0xBF, 0xD0, 0x03, 0xFE,
-    0x3F, 0xF0, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x2F, 0xF8, 0xFF, 0xC0, 0x1F,
-    0xFE, 0x2F, 0xFD, 0x6F, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xEF, 0xF0, 0x0F, 0xFF,
-    0xCF, 0xFC, 0x00, 0x6A, 0x47, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x2F, 0xAF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x2F, 0xFC, 0x02, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x07, 0xFF, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x50, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x03,
-    0xFE, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x00, 0x7F, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x10, 0x2A, 0xAA, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xE0, 0x01, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xE4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x3E, 0x00, 0xFF, 0xD0, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xF4,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x95, 0x5B, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x05,
-    0x50, 0x07, 0xF8, 0x07, 0xF8, 0x01, 0xFF, 0xFF, 0x43, 0xFC, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0x42,
-    0xFC, 0x1F, 0xD0, 0x3F, 0xFA, 0xFF, 0x01, 0xFC, 0x2F, 0xC0, 0xBF, 0x80, 0xBF, 0x01, 0xFC, 0x3F,
-    0x80, 0xFF, 0x00, 0xFE, 0x01, 0xFC, 0x3F, 0x42, 0xFD, 0x00, 0xFD, 0x02, 0xFC, 0x7F, 0x43, 0xFC,
-    0x01, 0xFC, 0x03, 0xFC, 0x7F, 0x03, 0xF8, 0x03, 0xFC, 0x03, 0xF8, 0x7F, 0x03, 0xF8, 0x03, 0xF8,
-    0x0B, 0xF0, 0x7F, 0x03, 0xF8, 0x0F, 0xF8, 0x1F, 0xE0, 0x7F, 0x43, 0xFE, 0x6F, 0xFD, 0xBF, 0xC0,
-    0x3F, 0x82, 0xFF, 0xFE, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0xBF, 0xF4, 0xFF, 0xFC, 0x00, 0x2F, 0xD0,
-    0x1A, 0x80, 0x1A, 0x90, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x01, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC,
-    0x00, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF4,
-    0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x1F, 0xF4, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x2F, 0xF4, 0x00, 0x03, 0xFD, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0x8B, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF5, 0x5F, 0xFF, 0x40, 0x0F,
-    0xFC, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF5, 0x5B, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xEA, 0xBF, 0xFC, 0x00, 0x3F, 0xF0,
-    0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00,
-    0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80,
-    0x6F, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x40, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x1B, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE9, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xF5, 0x6F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00,
-    0x0B, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xFD, 0x02, 0xFF, 0x40,
-    0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x00, 0x3F, 0xF8, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x0F, 0xFC,
-    0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC1, 0x7F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55,
-    0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF5, 0x55, 0x50,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xEA, 0xAA, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA,
-    0xA9, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xE4, 0x06, 0xF0,
-    0x01, 0xFF, 0xF4, 0x00, 0x01, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x05, 0x55,
-    0x50, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0x43, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x3F, 0xF0, 0x03, 0xFF,
-    0xFF, 0x03, 0xFF, 0x00, 0x6A, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x40,
-    0x2F, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xEA, 0xAA, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFD,
-    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x14, 0x6F, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xE0,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x3F,
-    0xFC, 0x00, 0x00, 0x7F, 0xD0, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC7, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFD,
-    0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x02,
-    0xFE, 0xFF, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0xFF, 0x7F, 0xC0, 0x0B, 0xF6,
-    0xFE, 0x00, 0x0F, 0xF6, 0xFC, 0x00, 0xFF, 0x3F, 0xE0, 0x01, 0xFF, 0x2F, 0xC0, 0x2F, 0xD3, 0xFD,
-    0x00, 0x1F, 0xF2, 0xFC, 0x03, 0xFC, 0x7F, 0xC0, 0x02, 0xFF, 0x2F, 0xC0, 0xBF, 0x4B, 0xFC, 0x00,
-    0x3F, 0xE2, 0xFD, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x1F, 0xD2, 0xFD, 0x0F, 0xF4, 0x00, 0x7F,
-    0xC1, 0xFD, 0x3F, 0xC1, 0xFF, 0x40, 0x0B, 0xFC, 0x1F, 0xDB, 0xF4, 0x2F, 0xF0, 0x00, 0xFF, 0x81,
-    0xFE, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xFF, 0xD0, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xFF,
-    0xFC, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0x40, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0xFF, 0xF0,
-    0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x0F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0x00,
-    0x0B, 0xFA, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x5F, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xFF,
-    0x80, 0x3F, 0xD0, 0x01, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x7F, 0xD0, 0xBF, 0xC0,
-    0x02, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x01,
-    0xFF, 0x4F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xDF, 0xF0,
-    0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0x40,
-    0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x1F, 0xFF,
-    0x40, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x47, 0xFF, 0x00,
-    0x00, 0x0F, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x03, 0xFF,
-    0xC0, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x5F, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0xFF,
-    0xC0, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x01, 0xFF, 0xF0, 0x07, 0xFF,
-    0xAB, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFE, 0xA5, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xF4, 0x1F, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFC,
-    0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x47, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x0B,
-    0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0xBF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xAA, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xE9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x6F, 0xFE, 0x00, 0x3F,
-    0xF0, 0x0B, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0xC0,
-    0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFE, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xD0, 0x2F, 0xF4,
-    0x00, 0xBF, 0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x6E, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x79, 0x00, 0x2F, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x1B,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x15, 0x5F, 0xFE, 0x55,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF,
-    0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F,
-    0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0,
-    0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF,
-    0xC0, 0x00, 0x2F, 0xF4, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0xBF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x02, 0xFF, 0x40, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xD0, 0x0B,
-    0xFD, 0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xF4, 0x00, 0x3F, 0xD0, 0x3F, 0xF0,
-    0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x00, 0x3F, 0xE1, 0xFF, 0x40, 0x00,
-    0x2F, 0xE3, 0xFF, 0x00, 0x00, 0x2F, 0xE7, 0xFD, 0x00, 0x00, 0x2F, 0xEB, 0xFC, 0x00, 0x00, 0x1F,
-    0xEF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x7F, 0xC0, 0x00, 0x3F, 0xEF, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0xFF, 0x80, 0x01, 0xFF,
-    0xC0, 0x00, 0xFF, 0xCF, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xF4, 0xFF, 0x80, 0x03, 0xFF, 0xC0,
-    0x03, 0xFF, 0x0F, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xE0, 0xFF, 0x80, 0x0F, 0xFF, 0xD0, 0x0B,
-    0xFC, 0x0F, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0x80, 0x3F, 0xEF, 0xD0, 0x2F, 0xF4,
-    0x0B, 0xF8, 0x07, 0xFA, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0xFF, 0x2F, 0xD0, 0x7F, 0xD0, 0x0B,
-    0xFC, 0x1F, 0xF2, 0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0xC3, 0xFD, 0x2F, 0xD0, 0xFF, 0x40, 0x0B, 0xFC,
-    0x7F, 0xC1, 0xFD, 0x2F, 0xF0, 0x00, 0xBF, 0xCB, 0xF8, 0x1F, 0xD3, 0xFE, 0x00, 0x0B, 0xF8, 0xFF,
-    0x01, 0xFD, 0x7F, 0xC0, 0x00, 0xBF, 0x9F, 0xE0, 0x1F, 0xDF, 0xF8, 0x00, 0x07, 0xFB, 0xFC, 0x01,
-    0xFD, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF4, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0xBF,
-    0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xF0,
-    0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x02, 0xFF,
-    0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF,
-    0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0x42, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x15,
-    0x55, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFE, 0xA4, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0x40, 0x00, 0x55, 0x54, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0x2F, 0xD0, 0x0B, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0x2F, 0xE0, 0x07, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0xBF,
-    0x40, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x00, 0x01, 0xAF, 0xFC,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0B, 0xF6,
-    0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x0B, 0xF4, 0x0F, 0xF0, 0x00,
-    0xFE, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x03, 0xF4, 0x07, 0xF4, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x02,
-    0xFC, 0x3F, 0xC0, 0x00, 0x1F, 0xC2, 0xA4, 0x00, 0x00, 0xA8, 0x2F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xE1, 0x55, 0x55, 0x55, 0x00, 0x2A, 0xA0, 0x3F, 0xF4, 0x0F, 0xF8, 0x07, 0xFC, 0x01, 0xFD,
-    0x00, 0xBE, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x3F, 0xC0, 0x0B, 0xFF, 0xFD, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xEB, 0xFF, 0xD0, 0x3F, 0xFC, 0x07, 0xFF, 0x41, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07,
-    0xFD, 0x07, 0xFE, 0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x07, 0xFF, 0x02,
-    0xFF, 0x80, 0x3F, 0xF8, 0x07, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0xBF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x9F, 0xE0, 0x00, 0x7F, 0xF4, 0xBF, 0x80, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x19, 0x00, 0x00, 0xBF, 0xCB, 0xFF, 0x40, 0x03, 0xFF, 0xBF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x7F, 0xFC, 0x02, 0xFF, 0xC0, 0x3F, 0xF4, 0x0F,
-    0xFD, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0xFF, 0x80, 0x0B, 0xFD, 0x07, 0xFC, 0x00,
-    0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF4,
-    0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xF4, 0x0F, 0xFE, 0x02, 0xFF, 0xFA, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0xCF, 0xFF, 0xF4, 0x01, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xE6, 0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x01, 0x80, 0x3F, 0xFF,
-    0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x94, 0x2F, 0xF4, 0x00, 0x1F, 0xFE, 0x2F, 0xF0, 0x00,
-    0xBF, 0xFF, 0xBF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xDB, 0xFF, 0xD0, 0x0F, 0xFE,
-    0x01, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0xFF, 0x80, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xE0, 0x01, 0xFF, 0x00, 0x7F, 0xD0, 0x02, 0xFF,
-    0x00, 0xBF, 0xD0, 0x03, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0x7F, 0xF0, 0x1F, 0xFD, 0x00,
-    0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF7, 0xF8, 0x00, 0x07,
-    0xFF, 0x87, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x81, 0xFF, 0x83, 0xFF,
-    0x40, 0x3F, 0xE1, 0xFF, 0x80, 0x0F, 0xF8, 0xBF, 0xD0, 0x1F, 0xFD, 0x3F, 0xFA, 0xBF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFA, 0x90, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0xF9, 0x6F, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x58, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2B, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xFF, 0xE7, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x07,
-    0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFC,
-    0x00, 0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x01,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xBF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x74,
-    0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x19, 0x40, 0x00, 0xBF,
-    0xCB, 0xFF, 0x80, 0x03, 0xFF, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x6F,
-    0xFD, 0x02, 0xFF, 0xE0, 0x2F, 0xF4, 0x0F, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x02, 0xFF, 0x40,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0,
-    0x07, 0xFD, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF,
-    0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF,
-    0x80, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x80, 0x0F, 0xFE, 0x00,
-    0x2F, 0xF0, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x0B, 0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0x0B, 0xFF, 0x00, 0x07, 0xFE,
-    0x0B, 0xFF, 0x00, 0x02, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x3F, 0xF7,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x3F,
-    0xF8, 0x00, 0x07, 0xFD, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFE,
-    0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x02, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x06, 0x50, 0x00, 0x2F, 0xC2, 0xFF,
-    0xE0, 0x1F, 0xFF, 0x00, 0x0F, 0xF2, 0xFF, 0xFD, 0x2F, 0xFF, 0xE0, 0x03, 0xFE, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0xBF, 0xFF, 0xEB, 0xFF, 0x40, 0xBF, 0xF8, 0x0F, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x2F, 0xFC, 0x02, 0xFF, 0xC0, 0x1F, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x0B, 0xFD, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xD0,
-    0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x0B, 0xFD, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xF8, 0x00,
-    0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x1F, 0xF4,
-    0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x00, 0x02, 0xFC, 0x2F, 0xFE, 0x00, 0x0F, 0xF2, 0xFF, 0xFE, 0x00, 0x3F, 0xEF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0xBF, 0xD0, 0x2F, 0xFC, 0x02, 0xFF,
-    0x40, 0xFF, 0xD0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xE0, 0x03,
-    0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x40,
-    0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xEB, 0xFF,
-    0x40, 0xFF, 0xE0, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x1F, 0xF8,
-    0xBF, 0xD0, 0x03, 0xFF, 0x47, 0xFE, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xEF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x02, 0xFC, 0x2F, 0xFD, 0x00, 0x00,
-    0xFF, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x9F, 0xFF, 0x00, 0x0B,
-    0xFF, 0x00, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x3F,
-    0xE0, 0x02, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
-    0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x1F, 0xFD,
-    0x03, 0xFF, 0x80, 0x0B, 0xFF, 0xEB, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xAF,
-    0xFF, 0xD0, 0x00, 0x7F, 0xD2, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x05, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x3F, 0xC0, 0x0B, 0xFF, 0xFD, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xDB, 0xFF, 0xD0, 0x3F, 0xF8, 0x07, 0xFF, 0x01, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x03,
-    0xFD, 0x07, 0xFE, 0x00, 0x1F, 0xF0, 0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0xBF, 0xD0, 0x03, 0xFF, 0x02,
-    0xFF, 0x80, 0x2F, 0xF8, 0x07, 0xFF, 0x01, 0xFF, 0xD0, 0x0F, 0xFF, 0xBF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x7F, 0xE0, 0x00, 0x7F, 0xF4, 0xFF, 0x40, 0x00, 0x04, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0xBF, 0x4B, 0xFC, 0x00, 0xFF, 0x6F, 0xFC, 0x00,
-    0xFF, 0xBF, 0xF8, 0x01, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xF9, 0x10, 0x03, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xA5, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0x01, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x50, 0x00, 0xBF, 0xD0, 0xBE, 0x9B, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x2B, 0xFF, 0xAA, 0x40, 0x3F,
-    0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0xEF, 0x00, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x02,
-    0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x01, 0xFF, 0x80,
-    0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xD0,
-    0x03, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x3F, 0xE0, 0x07, 0xFF,
-    0x00, 0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xFF, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xBF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF7, 0xFC, 0x00, 0x7F, 0xFF, 0x8F, 0xF0, 0x00, 0x7F, 0xF4, 0x3F, 0xC0, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFE, 0x3F, 0xE0, 0x00, 0xFF, 0xC3,
-    0xFE, 0x00, 0x2F, 0xF8, 0x3F, 0xF0, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x2F, 0xF0, 0x0F,
-    0xFC, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0x1F, 0xF0, 0x3F, 0xF0, 0x01, 0xFF, 0x0B, 0xFD, 0x00, 0x0F,
-    0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0x6F, 0xF0, 0x00, 0x0F, 0xF7, 0xFE, 0x00, 0x00, 0xFF, 0xBF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0xFF, 0xD0, 0x07, 0xFE, 0xFF, 0x80, 0x2F, 0xFD, 0x00, 0xFF, 0xCF, 0xF8, 0x03, 0xFF, 0xD0,
-    0x0F, 0xF8, 0xFF, 0x80, 0x7F, 0xFD, 0x02, 0xFF, 0x0F, 0xF8, 0x0F, 0xEF, 0xD0, 0x3F, 0xE0, 0xBF,
-    0x81, 0xFD, 0xFD, 0x0B, 0xFD, 0x0B, 0xF8, 0x3F, 0xCF, 0xD0, 0xFF, 0xC0, 0xBF, 0x83, 0xF8, 0xFD,
-    0x1F, 0xF4, 0x0B, 0xF8, 0xBF, 0x0F, 0xD3, 0xFF, 0x00, 0xBF, 0x8F, 0xF0, 0xFD, 0x3F, 0xD0, 0x07,
-    0xF9, 0xFD, 0x0F, 0xDB, 0xFC, 0x00, 0x7F, 0xBF, 0xC0, 0xFD, 0xFF, 0x40, 0x07, 0xFB, 0xF8, 0x0F,
-    0xEF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x00,
-    0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0x81, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00,
-    0x00, 0xBF, 0xDB, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xF8, 0x00,
-    0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xD2, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x7F,
-    0xD0, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xAA, 0xAF, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6A, 0x00, 0x1E, 0x90,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x03, 0xFE, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0xBF, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xBF,
-    0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x73, 0xFF,
-    0xFF, 0xFA, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0x06, 0xFF, 0xFF, 0x84, 0x00, 0x06, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x00,
-    0x3F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x07, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0,
-    0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0,
-    0x02, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xD5, 0xB4, 0x0F, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF4, 0x01, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x00, 0x0F, 0xFE, 0x01, 0xA0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x1A, 0xBF, 0xFA, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x02, 0xFE, 0xFF, 0xEF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x0B,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x07, 0xF0,
-    0x0F, 0xE0, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x0F, 0xFE, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x6A, 0x4B, 0xC0, 0x08, 0x00,
-    0x00, 0x80, 0x0B, 0xFC, 0x00, 0x07, 0xFE, 0x07, 0xFD, 0x00, 0x0F, 0xFC, 0x03, 0xFD, 0x00, 0x2F,
-    0xF4, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x01, 0xFF, 0x40,
-    0x00, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0xBF, 0x9F, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0A, 0xBF,
-    0xFF, 0xA8, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x6F, 0xF5,
-    0x50, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1A, 0xBF, 0xFA, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0xBF, 0xE5, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6A, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xEB, 0xFC, 0x00, 0xBF, 0xC0,
-    0x0A, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFB, 0xFF, 0x80, 0x0F, 0xF0, 0x3F, 0xF0, 0x07,
-    0xF8, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0xFD, 0x3F, 0xD0,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x0B, 0x40, 0x0B, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x81, 0xFC, 0x3F, 0xC3, 0xFD, 0x3F, 0xC3, 0xFD, 0x3F, 0x82, 0xFC, 0x04, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x00, 0x16, 0x50, 0x2F, 0x80, 0x07, 0xC0, 0x1F, 0xFF, 0xD0, 0xBD, 0x00, 0xF4,
-    0x07, 0xFF, 0xFC, 0x03, 0xF0, 0x1F, 0x00, 0xFD, 0x00, 0x40, 0x1F, 0x43, 0xE0, 0x2F, 0x40, 0x00,
-    0x00, 0xF8, 0x3C, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC7, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x7C,
-    0x07, 0xD0, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xC3, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x3D, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x82,
-    0xF0, 0x1F, 0x80, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0xFF, 0xAB, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xFF,
-    0xFC, 0x07, 0xD0, 0x03, 0xF0, 0x02, 0xA9, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0x90, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x87,
-    0xC0, 0x7F, 0xFF, 0xF0, 0x3F, 0xEB, 0xFC, 0x2F, 0xC0, 0xFE, 0x0F, 0xE0, 0x3F, 0x47, 0xF0, 0x0F,
-    0xC1, 0xFC, 0x03, 0xF0, 0xBF, 0x02, 0xF8, 0x2F, 0xC0, 0xFD, 0x07, 0xFE, 0xFF, 0x00, 0xBF, 0xEB,
-    0xC0, 0x06, 0x91, 0x90, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x7F,
-    0xE0, 0x7F, 0xE0, 0x0F, 0xFC, 0x1F, 0xFD, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0xFF, 0xE0, 0xFF, 0xE0,
-    0x3F, 0xF8, 0x3F, 0xF8, 0x0B, 0xFF, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0xBF, 0xE0, 0x03, 0xFF, 0x03,
-    0xFF, 0x00, 0x2F, 0xF4, 0x3F, 0xF4, 0x01, 0xFF, 0x81, 0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x7F, 0xD0, 0x03, 0xE4, 0x03, 0xE4, 0x00, 0x10, 0x00, 0x10, 0x00, 0x2A, 0xAA, 0xAA,
-    0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xD7,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x05, 0x55, 0x00, 0x2F, 0x80, 0x07, 0xC0, 0xFF, 0xFF,
-    0x00, 0xBD, 0x00, 0xF4, 0x0F, 0xFF, 0xFC, 0x03, 0xF0, 0x1F, 0x00, 0xFC, 0x0B, 0xE0, 0x1F, 0x43,
-    0xE0, 0x0F, 0xC0, 0x3F, 0x00, 0xF8, 0x3C, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xC7, 0xC0, 0x0F, 0xC0,
-    0x7E, 0x00, 0x7C, 0x7C, 0x00, 0xFD, 0x6F, 0xC0, 0x07, 0xC7, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x7C,
-    0x7C, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xC3, 0xC0, 0x0F, 0xC2, 0xF0, 0x00, 0xBC, 0x3D, 0x00, 0xFC,
-    0x0F, 0xC0, 0x0F, 0x82, 0xF0, 0x0F, 0xC0, 0xBD, 0x00, 0xF4, 0x0F, 0x40, 0xFC, 0x03, 0xF0, 0x2F,
-    0x00, 0xBC, 0x0F, 0xC0, 0x1F, 0x87, 0xD0, 0x03, 0xF0, 0x54, 0x00, 0x55, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xAA, 0xA9, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x6A, 0xAA, 0xAA, 0xA8, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0x41, 0xFD, 0xBE, 0x00, 0xBE,
-    0xBE, 0x00, 0x7F, 0xBE, 0x00, 0xBE, 0x7F, 0x41, 0xFD, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF4, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xAA,
-    0xBF, 0xEA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x0A, 0xAA, 0xAA,
-    0xAA, 0xA3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x1F, 0xEF, 0xFC, 0x00, 0x90, 0x3F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF,
-    0xE0, 0x0F, 0x9B, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x05, 0x7F, 0xC0, 0x03, 0xFF,
-    0x80, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xC1, 0x00, 0x0F, 0xF0, 0xBA, 0x6F,
-    0xF8, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00, 0x6A, 0x90, 0x1F, 0xFC,
-    0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x01, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFD, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xBF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFB, 0xF4, 0x00, 0x3F, 0xFF, 0xFD, 0xBF, 0x00, 0x07, 0xFE, 0xFF,
-    0x4B, 0xF0, 0x00, 0xBF, 0xD1, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x40, 0x1F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0x03, 0xE3, 0xFF, 0xFF, 0xF0, 0x3E, 0x7F, 0xFF, 0xFF, 0x03, 0xEB, 0xFF,
-    0xFF, 0xF0, 0x3E, 0xBF, 0xFF, 0xFF, 0x03, 0xEB, 0xFF, 0xFF, 0xF0, 0x3E, 0xBF, 0xFF, 0xFF, 0x03,
-    0xE7, 0xFF, 0xFF, 0xF0, 0x3E, 0x3F, 0xFF, 0xFF, 0x03, 0xE3, 0xFF, 0xFF, 0xF0, 0x3E, 0x1F, 0xFF,
-    0xFF, 0x03, 0xE0, 0xBF, 0xFF, 0xF0, 0x3E, 0x01, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x3E,
-    0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x3E, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x1F, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x1F,
-    0x03, 0xE0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x47, 0xFF,
-    0x2F, 0xFC, 0xFF, 0xF1, 0xFF, 0x00, 0x50, 0x00, 0x02, 0xF4, 0x01, 0xFE, 0x00, 0x7F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF, 0xD0, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0xFF, 0xE0, 0xBF, 0xFD, 0x7F, 0xFF, 0xCB, 0xFF, 0xFC, 0x3E, 0x3F, 0x81, 0x07, 0xF4, 0x00, 0xBF,
-    0x40, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0xF4, 0x0F, 0xFB, 0xFC, 0x1F, 0xD1, 0xFC, 0x3F, 0x80,
-    0xFD, 0x3F, 0x40, 0xFC, 0x3F, 0x01, 0xFC, 0x3F, 0x02, 0xFC, 0x3F, 0x47, 0xF4, 0x3F, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x07,
-    0xFD, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x1F,
-    0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0B, 0xFE, 0x0B, 0xFD, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x3F,
-    0xF4, 0x3F, 0xF4, 0x0F, 0xFD, 0x0F, 0xFD, 0x02, 0xFF, 0x83, 0xFF, 0x80, 0xBF, 0xE0, 0xBF, 0xE0,
-    0x07, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xBF,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0x40, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0x80, 0x1F, 0xFF, 0xF0,
-    0x00, 0x3F, 0xC0, 0x02, 0xE3, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x10, 0xFF, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x7F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x0B,
-    0xF4, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x03, 0xF8, 0x03, 0xFF, 0x40,
-    0x7F, 0x83, 0xFC, 0x03, 0xFF, 0xC0, 0x2F, 0xD2, 0xFD, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0xFE, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x01, 0xFD, 0xFD, 0x00, 0x00, 0xFF, 0x01, 0xFC, 0xBF, 0x00, 0x00,
-    0xBF, 0x40, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0xFD, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xC0, 0x2F, 0xFF, 0xFF, 0xD0, 0x2F, 0xD0, 0x0A, 0xAA, 0xFF, 0xA0, 0x1F, 0xE0,
-    0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x7F, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xE3, 0xFC, 0x00, 0x3F, 0xC0, 0x00,
-    0x01, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x05, 0x40, 0x00, 0x3F, 0xC0, 0x7F, 0x47,
-    0xFF, 0xF0, 0x00, 0xFF, 0x03, 0xF8, 0xBF, 0xFF, 0xF0, 0x07, 0xF8, 0x3F, 0xC0, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xD2, 0xFC, 0x01, 0x80, 0xFF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F,
-    0xF0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xBE, 0xBF, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40,
-    0x07, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0x6F, 0xD0, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF4,
-    0x07, 0xFD, 0x7E, 0x6F, 0xFC, 0x3F, 0x80, 0x3F, 0xF1, 0xFF, 0xFF, 0xD3, 0xFC, 0x03, 0xFF, 0xC7,
-    0xFF, 0xF8, 0x2F, 0xD0, 0x3F, 0xFF, 0x00, 0x55, 0x01, 0xFE, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0xF0, 0x1F, 0xDF, 0xD0, 0x00, 0x00, 0xFF, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0xC3,
-    0xFC, 0x00, 0x00, 0x7F, 0x80, 0xFD, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x02, 0xFD, 0x00, 0xAA, 0xAF, 0xFA, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x0F,
-    0xFF, 0x00, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x10, 0xFF, 0xE0, 0x1F, 0x8B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xD1, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x07,
-    0xFD, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0xFF,
-    0xC3, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4,
-    0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x2F, 0xF4, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0x8B, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF,
-    0xF0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xC3, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x01,
-    0xFF, 0x40, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x02, 0xFF, 0x40, 0x00,
-    0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x02,
-    0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xF5, 0x55, 0x6F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80,
-    0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0xFF, 0x40, 0xBC, 0x00, 0x00, 0x03,
-    0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xC2, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD3, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x03, 0xFE, 0x00, 0x00, 0x07, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00,
-    0x1F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0x55,
-    0x56, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x2F,
-    0xF4, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x03, 0xFE,
-    0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD2, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00,
-    0x1F, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0xE0, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0x55, 0x56, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x0F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0x82, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xE7,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0xDF,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xC0,
-    0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00,
-    0x01, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x55, 0x56, 0xFF, 0x42, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF8, 0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xEF, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xEB, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x7F, 0xF1, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x07, 0xFF, 0x55, 0x54, 0x00, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xC0, 0x0F, 0xFE, 0xAA, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x55, 0x5F, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x6F, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x40, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x1B, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5,
-    0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5,
-    0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x03, 0xFD, 0x07,
-    0xFC, 0x00, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5,
-    0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x03, 0xF4, 0x00, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0xBF, 0x0B,
-    0xF0, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5,
-    0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x9F, 0xF0, 0x00, 0x3F, 0xD0, 0x7F, 0x80, 0x0F,
-    0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x1F,
-    0xC0, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x40,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF5, 0x6F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x3F,
-    0xFC, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xE3, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFD, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xD7, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x17, 0xFF, 0x54,
-    0x01, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xF8, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xD0,
-    0x01, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC1, 0x7F, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x07,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x0B, 0xD1, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x01,
-    0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x5F, 0xF4,
-    0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x3F, 0xD0, 0x01, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x00,
-    0x2F, 0xF0, 0x7F, 0xD0, 0xBF, 0xC0, 0x02, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x2F,
-    0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0xFF, 0xDF, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0,
-    0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07,
-    0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x4B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4,
-    0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03,
-    0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80,
-    0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B,
-    0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02,
-    0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0,
-    0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFD, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0x40, 0x00, 0x03, 0xF8,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x03, 0xFF,
-    0xC0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00,
-    0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF,
-    0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x1F, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xC0, 0x00, 0x01, 0xFF, 0xFE, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7E, 0x1F, 0xFF, 0x40, 0x00, 0x02, 0xF0, 0x06, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x3F,
-    0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4,
-    0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00, 0x00, 0x0F,
-    0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00,
-    0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00,
-    0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0xD0, 0x2F, 0x80, 0x03, 0xF4, 0x7F, 0xE0, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x07, 0xFE,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x3F, 0xC0,
-    0x07, 0xFC, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x3F, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80,
-    0x2F, 0xFE, 0x00, 0x7F, 0xF4, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0x40, 0x0B, 0xFF, 0xF0, 0x1F, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0xFF, 0xD0, 0x07, 0xFA, 0xFF, 0x43, 0xFF, 0x00, 0x3F, 0xCB, 0xFD, 0x1F,
-    0xF8, 0x03, 0xFC, 0x2F, 0xF0, 0xBF, 0xD0, 0x2F, 0xC0, 0xFF, 0xC3, 0xFF, 0x01, 0xFD, 0x03, 0xFF,
-    0x0F, 0xFC, 0x1F, 0xE0, 0x0F, 0xFC, 0x3F, 0xF0, 0xFF, 0x00, 0x7F, 0xE0, 0xFF, 0xCF, 0xF0, 0x03,
-    0xFF, 0x03, 0xFF, 0xBF, 0x40, 0x1F, 0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xD0, 0x2F, 0xFF, 0x80,
-    0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
-    0xF0, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00,
-    0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00,
-    0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF8,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF,
-    0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0x07,
-    0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD,
-    0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF,
-    0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00,
-    0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x03, 0xFD,
-    0x07, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F,
-    0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F,
-    0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02,
-    0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80,
-    0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0,
-    0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00,
-    0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
-    0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF,
-    0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40,
-    0x02, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF,
-    0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0x42, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFC, 0xFF, 0xC0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x01, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0x3F,
-    0xF8, 0x03, 0xFF, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x40, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x07, 0xFF, 0xD6, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0xF8, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x4B, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD3, 0xD5, 0x7F, 0xF8, 0x00, 0x03,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0xBF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x05, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFA,
-    0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xFC,
-    0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFE,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0xBF,
-    0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8, 0x00,
-    0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF,
-    0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F,
-    0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07,
-    0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0,
-    0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8,
-    0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x3F, 0xD0, 0x00, 0x2F,
-    0xE0, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01,
-    0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80,
-    0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC,
-    0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF,
-    0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7,
-    0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x0B, 0xF8, 0x07, 0xD0, 0x00, 0xFF, 0xFE, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0x4B, 0xFF, 0xC0, 0x00, 0xF4, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF,
-    0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B,
-    0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01,
-    0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xE7, 0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x03, 0xFE, 0x2F, 0xF0,
-    0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x65, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02,
-    0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80,
-    0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE,
-    0x01, 0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xE7, 0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x9F, 0xD0, 0x00, 0x00, 0xBC, 0x0F,
-    0x40, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x07, 0xE7, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0xFF, 0x00, 0x2F, 0xFF, 0xF7, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xAF, 0xFF,
-    0x40, 0xFF, 0xF0, 0x1F, 0xFD, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF,
-    0xC0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03,
-    0xFF, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x0B, 0xFF, 0x40,
-    0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x7F, 0x80, 0x01, 0xFF,
-    0xD2, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x65, 0x00, 0x00,
-    0x2F, 0xFF, 0x0F, 0xDF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xDB, 0xFF, 0xFD, 0x0F, 0xFC, 0x0F, 0xFE, 0x02, 0xFF, 0xF0,
-    0x07, 0xFC, 0x1F, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xFC, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x2F, 0xFC,
-    0x3F, 0xF0, 0x00, 0xFF, 0xEA, 0xFF, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xE0,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0xFA, 0x50, 0x00, 0xBF, 0xD0, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xFF, 0x80, 0x01,
-    0x40, 0x3F, 0xFE, 0xFF, 0xFF, 0xE5, 0x6F, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0x87, 0xE3, 0xFF, 0xF9, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xE6, 0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x01, 0x80,
-    0x3F, 0xFF, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x65, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFE, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0xFF, 0x87, 0xFE, 0x00, 0x3F, 0xE2, 0xFF, 0x40, 0x7F, 0xF4,
-    0xFF, 0xEA, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xEA, 0x40,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x08, 0x03, 0xFF, 0xE5,
-    0xBF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF8, 0x1F, 0xF8, 0x0F, 0xFD, 0x00, 0xFF, 0x81, 0xFF, 0x80,
-    0x0F, 0xF8, 0x2F, 0xF4, 0x07, 0xFF, 0x43, 0xFF, 0xAB, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0xA4, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x02, 0x00, 0x3F, 0xFE, 0x5B, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00,
-    0x3F, 0xD0, 0x7F, 0x80, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F,
-    0xF8, 0x1F, 0xF8, 0x0F, 0xFD, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x0F, 0xF8, 0x2F, 0xF4, 0x07, 0xFF,
-    0x43, 0xFF, 0xAB, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFE,
-    0xA4, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0x00,
-    0x3F, 0xFE, 0x5B, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0,
-    0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x40, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0xFF, 0x87, 0xFE,
-    0x00, 0x3F, 0xE2, 0xFF, 0x40, 0x7F, 0xF4, 0xFF, 0xEA, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xEA, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x08, 0x03, 0xFF, 0xE5, 0xBF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x2F, 0xF4, 0x00,
-    0xFF, 0x80, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFF, 0x00,
-    0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x01, 0xFF,
-    0x80, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1A, 0xA8, 0x00, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0x00, 0xBF, 0xCB, 0xF4, 0x2F, 0xE0, 0x3F, 0xC7, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xE0, 0xBF, 0x87, 0xFC, 0x2F, 0xE1, 0xFF, 0x07, 0xF0,
-    0x3F, 0x40, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x3C, 0x00,
-    0x01, 0xFF, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x2F, 0xF0, 0x00, 0x03, 0x40, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xFD, 0x7F, 0xC0, 0x1F, 0xFF, 0xFB, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFC, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x2F, 0xFC, 0x7F, 0xE0,
-    0x01, 0xFF, 0xCB, 0xFD, 0x00, 0x2F, 0xF8, 0xFF, 0xC0, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x3F, 0xF0,
-    0xFF, 0xC0, 0x07, 0xFF, 0x0B, 0xFD, 0x00, 0xFF, 0xD0, 0x7F, 0xF9, 0xBF, 0xF8, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0x00, 0x01, 0xFF, 0xFE, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xE1, 0xFF, 0xF4, 0x00, 0x0B, 0xC0, 0x1B, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0xBF, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0x2F,
-    0xFF, 0xE0, 0x00, 0xFF, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0xBF, 0xF4, 0x02, 0xFF, 0xE0, 0x2F,
-    0xF4, 0x02, 0xFF, 0xC0, 0x2F, 0xF4, 0x03, 0xFF, 0x40, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0xF0,
-    0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x0F,
-    0xFC, 0x00, 0xBF, 0xD0, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x2F, 0xF0,
-    0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x7F, 0xE0, 0x03,
-    0xFF, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF,
-    0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00,
-    0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE,
-    0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3,
-    0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01,
-    0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F,
-    0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x3F, 0xD0, 0x7F, 0x80, 0x0B, 0xE0, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF,
-    0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0,
-    0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4,
-    0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0xF4, 0x0B, 0xC0, 0x00, 0xFF, 0xFE, 0xBF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x0B, 0xFF, 0x80, 0x01, 0xF0, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFA, 0xFF, 0xD0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x7F, 0xF0,
-    0x03, 0xFF, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0xFF,
-    0xC1, 0xFF, 0x80, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x2F, 0xF4, 0x00, 0xFF, 0xD0, 0x7F,
-    0xE0, 0x07, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00,
-    0xFF, 0x0F, 0xF4, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00,
-    0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF, 0x07,
-    0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x06, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x97, 0xFF,
-    0x40, 0x3F, 0xF0, 0x1F, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0xFC, 0x0F, 0xFC, 0x0F, 0xFF, 0xF0, 0x3F,
-    0xE0, 0xFF, 0xFF, 0xC1, 0xFF, 0x8B, 0xF3, 0xFF, 0x07, 0xFD, 0x7F, 0x0F, 0xFC, 0x2F, 0xFB, 0xF4,
-    0x7F, 0xE0, 0xBF, 0xFF, 0x82, 0xFF, 0x41, 0xFF, 0xF8, 0x0F, 0xFC, 0x07, 0xFF, 0xC0, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xAF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x2F, 0x01, 0x50, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03,
-    0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0,
-    0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xFF,
-    0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0xFF, 0x00, 0x1F,
-    0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xE0,
-    0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF,
-    0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF,
-    0xC0, 0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F,
-    0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0xFF, 0x00,
-    0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xA4, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x02, 0xFF,
-    0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F,
-    0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x02,
-    0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80,
-    0xFF, 0xC0, 0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xE0,
-    0x0F, 0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0xFF,
-    0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBD, 0x00, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x02,
-    0xFE, 0x2F, 0xF0, 0x00, 0x07, 0xF0, 0x7F, 0x40, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0,
-    0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0,
-    0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF,
-    0x80, 0xFF, 0xC0, 0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F,
-    0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD,
-    0xFF, 0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF8,
-    0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x3F,
-    0xF0, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF4,
-    0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x00, 0x02,
-    0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x19, 0x00, 0x00,
-    0x0B, 0xFC, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFE, 0xBF, 0xFC, 0x00, 0x2F, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFE, 0x00, 0xFF, 0xD0, 0x03,
-    0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x2F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0xFF,
-    0xC0, 0x1F, 0xFC, 0x00, 0x7F, 0xF4, 0x0F, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFE, 0xBF, 0xFF, 0x40, 0x01, 0xFF, 0x8B, 0xFF, 0x40, 0x00, 0xBF, 0xD0,
-    0x14, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0,
-    0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00,
-    0x1F, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0xE0, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0x55, 0x56, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x0F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0x82, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0xFF, 0x00, 0x2F, 0xFF, 0xF7, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xAF, 0xFF,
-    0x40, 0xFF, 0xF0, 0x1F, 0xFD, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF,
-    0xC0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03,
-    0xFF, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x0B, 0xFF, 0x40,
-    0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x7F, 0x80, 0x01, 0xFF,
-    0xD2, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x01, 0xA0, 0x00, 0x00,
-    0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xEA, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFB, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x02, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF5,
-    0x55, 0x6F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xBF,
-    0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x0A, 0x80, 0x02, 0x90, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xAB, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0,
-    0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF,
-    0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF,
-    0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0xFF,
-    0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0xFF, 0xC3, 0xFD,
-    0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x0B, 0xF8,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x2F, 0xF4, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x8B,
-    0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x94, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x3F, 0xC0, 0x0B, 0xFF, 0xFD, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xEB, 0xFF, 0xD0, 0x3F, 0xFC, 0x07, 0xFF, 0x41, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD, 0x07, 0xFE,
-    0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x07, 0xFF, 0x02, 0xFF, 0x80, 0x3F,
-    0xF8, 0x07, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0x9F, 0xE0, 0x00, 0x7F, 0xF4, 0xBF, 0x80, 0x00, 0x04, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x01, 0xBD, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x6D, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA5, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0x80, 0x1F, 0xFF, 0x9B, 0xD0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x60, 0x03,
-    0xFF, 0xFB, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0xFF, 0x41, 0xFE, 0x00,
-    0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x01, 0xBD, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x6D, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0x8F, 0xF0, 0x00, 0xFF, 0x41, 0xFE, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0x9B, 0xD0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x60,
-    0x03, 0xFF, 0xFB, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x01, 0xBD, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x6D, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xE6, 0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x01, 0x80, 0x3F, 0xFF, 0xBF, 0x80,
-    0x1F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x69, 0x00, 0x0A, 0x90, 0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD2, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x01, 0xBD, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x40, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x01, 0xB4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x0A, 0x90, 0x07, 0xF8, 0x07, 0xF8, 0x00,
-    0x2F, 0xD2, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x6F, 0x40, 0x0F, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x18, 0x00, 0x3F, 0xFF, 0xBF, 0x80, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0x40, 0x06, 0xA0, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x0F,
-    0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xE9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xF5, 0x6F, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xFF,
-    0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0xE0,
-    0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x3F,
-    0xF0, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00,
-    0x3F, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x05, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x65, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0xF6, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xE0, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x7F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF7, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF5, 0x6F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x3F, 0xFC,
-    0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0xBF,
-    0xD0, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xE3, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFD, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xD7, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x17, 0xFF, 0x54, 0x01,
-    0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xF8, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xD0, 0x01,
-    0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC1, 0x7F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2A, 0xAF, 0xFA, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x01, 0x90, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0xE3, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xDB, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x00,
-    0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x40,
-    0x07, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xE0,
-    0x00, 0x7F, 0xE0, 0x0B, 0xFE, 0x00, 0x07, 0xFF, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF7, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F,
-    0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xE0, 0x7F, 0xE0, 0xFF, 0xD0, 0x0F, 0xF8, 0x7F, 0xE0, 0x03,
-    0xFE, 0x2F, 0xF4, 0x07, 0xFF, 0x4F, 0xFE, 0xAF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0x40, 0xBF, 0xFE, 0xA4, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x80, 0x3F, 0xFE, 0x5B, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x69, 0x00, 0x00,
-    0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0xAB, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1A, 0x40, 0x0A, 0x80, 0x02, 0xF8,
-    0x01, 0xFC, 0x00, 0x1F, 0xFA, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF8, 0x1F, 0xF8, 0x0F,
-    0xFD, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x0F, 0xF8, 0x2F, 0xF4, 0x07, 0xFF, 0x43, 0xFF, 0xAB, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0xA4, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0x00, 0x3F, 0xFE, 0x5B, 0xF0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFE, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0xFF, 0x87, 0xFE, 0x00, 0x3F, 0xE2, 0xFF,
-    0x40, 0x7F, 0xF4, 0xFF, 0xEA, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xEA, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x08,
-    0x03, 0xFF, 0xE5, 0xBF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x81, 0xFF,
-    0x83, 0xFF, 0x40, 0x3F, 0xE1, 0xFF, 0x80, 0x0F, 0xF8, 0xBF, 0xD0, 0x1F, 0xFD, 0x3F, 0xFA, 0xBF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFA, 0x90, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0xF9, 0x6F, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x17, 0xF8, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0x2A, 0x40, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0xBF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xF5,
-    0x55, 0x50, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAA,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1A, 0x40, 0x02, 0xA4, 0x00, 0x7F, 0x80, 0x7F, 0x80,
-    0x00, 0xBF, 0x4B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xE0, 0x7F, 0xE0, 0x0F,
-    0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x03, 0xFE, 0x02, 0xFF, 0x40, 0x7F, 0xF4, 0x0F, 0xFE, 0xAF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xEA, 0x40, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x80, 0x03, 0xFF,
-    0xE5, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x5F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0xBF, 0x40, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x40, 0x6F, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x10, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x55, 0x55, 0x02,
-    0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xF4, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xF0, 0x06, 0xAF, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF4, 0x02, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xA9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x2F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xFF, 0xE7, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x07, 0xFF,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xBF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x74, 0x00,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x0A, 0x80, 0x00, 0x02, 0xF8,
-    0x01, 0xFC, 0x00, 0x00, 0x1F, 0xFA, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x40, 0x6F, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x10, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x55, 0x55, 0x02,
-    0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xF4, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xF0, 0x06, 0xAF, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF4, 0x02, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90,
-    0x01, 0xA4, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x03, 0xFE, 0xAF, 0xF0, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xFF, 0xE7, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x07, 0xFF,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xBF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x74, 0x00,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x40, 0x6F, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x10, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x55, 0x55, 0x02,
-    0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xF4, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xF0, 0x06, 0xAF, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF4, 0x02, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xFF, 0xE7, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x07, 0xFF,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xBF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x74, 0x00,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xE4, 0x06, 0xF0, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x05, 0x55, 0x50, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0x43, 0xFF,
-    0x40, 0x3F, 0xFF, 0xF0, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x6A, 0xFF, 0xE0, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x02,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xFF, 0xE7, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x07, 0xFF,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xBF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x74, 0x00,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x7F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF8,
-    0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
-    0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xEA,
-    0xAA, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x00,
-    0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFD, 0x07, 0xF8, 0x00, 0x3F,
-    0x80, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x06, 0x50, 0x00, 0x2F,
-    0xF2, 0xFF, 0xE0, 0x00, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xDB,
-    0xFF, 0x40, 0xBF, 0xF8, 0x0B, 0xFD, 0x03, 0xFF, 0xC0, 0x2F, 0xF4, 0x0F, 0xFD, 0x00, 0xBF, 0xD0,
-    0x3F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x3F, 0xF0,
-    0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x1F, 0xF4, 0x00, 0xFF,
-    0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F,
-    0xE0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF,
-    0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x6B, 0xFF, 0xEA, 0xAA, 0xFF, 0xE9, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0A, 0xFF, 0xFA, 0xAA, 0xBF,
-    0xFA, 0x80, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x0F,
-    0xFE, 0xAA, 0xAB, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xAF,
-    0xFF, 0xAA, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x6B, 0xFF, 0xAA,
-    0x40, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x64, 0x00, 0x03, 0xFF, 0x2F, 0xFE, 0x00,
-    0x0F, 0xFB, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF9, 0xBF, 0xF0, 0x0F, 0xFF,
-    0x40, 0xFF, 0xC0, 0x3F, 0xF8, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x3F,
-    0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F,
-    0xF8, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x7F, 0xD0, 0x3F, 0x00, 0x1F, 0xFF, 0xEF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7E,
-    0x1F, 0xFF, 0x40, 0x0B, 0xC0, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xFE, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x0B, 0xF8, 0x03, 0xE0, 0xBF, 0xFE, 0xBF, 0x07, 0xFF, 0xFF, 0xFC, 0x2F, 0x47, 0xFF, 0xC0, 0xB8,
-    0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x55,
-    0x55, 0x41, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0x00, 0x0A,
-    0x80, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x2F, 0xFA, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x0A, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xFE, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x0A, 0x80, 0x02, 0x90,
-    0xFD, 0x00, 0xBE, 0x0F, 0xFA, 0xBF, 0xC0, 0x7F, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x00, 0x06, 0xFA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x3F,
-    0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80,
-    0x1F, 0xF8, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF,
-    0x80, 0x02, 0xFF, 0xFE, 0x40, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF,
-    0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x1F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x07,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0B,
-    0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0xBF, 0xFF, 0xFC, 0x02,
-    0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x14, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0xFF, 0xE0,
-    0x0B, 0xFE, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x01, 0x90, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x2F,
-    0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00,
-    0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x14, 0x6F, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xCB, 0xF4, 0x00,
-    0x0B, 0xF8, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xE0,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x3F,
-    0xFC, 0x00, 0x00, 0x7F, 0xD0, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC7, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFD,
-    0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0x00, 0x3F, 0xF0,
-    0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0x0B, 0xFF, 0x00, 0x07, 0xFE, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0x4B,
-    0xFF, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xF8, 0x00, 0x07, 0xFD, 0x07, 0xFF,
-    0x00, 0x02, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
-    0x40, 0x1F, 0xF8, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xC0, 0x0F, 0xFC, 0x02, 0xFF,
-    0xC0, 0x03, 0xFF, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0x82, 0xFF, 0xC0, 0x00, 0xBF, 0xD1, 0xFF, 0xC0,
-    0x00, 0x2F, 0xF1, 0xFF, 0xC0, 0x00, 0x0F, 0xF9, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0x7F, 0xF0, 0x00, 0x03, 0xFE, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x00,
-    0xBF, 0xC0, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x07,
-    0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0A,
-    0xA8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x06, 0xA8, 0x00, 0x1F, 0xF8, 0x0F, 0xF8, 0x00, 0x2F, 0xF4, 0x1F, 0xF0, 0x00,
-    0x3F, 0xF0, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0xE0, 0x69, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x54, 0x15, 0x50, 0x00, 0xFF, 0xC3,
-    0xFD, 0x00, 0x1F, 0xF8, 0xBF, 0xC0, 0x02, 0xFF, 0x4F, 0xF0, 0x00, 0x3F, 0xF1, 0xFD, 0x00, 0x03,
-    0xFF, 0x3F, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x05, 0x00, 0x1F, 0xF8, 0x0F, 0xF4, 0x07, 0xFD, 0x0B, 0xFF,
-    0x02, 0xFF, 0x42, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xF0, 0x06, 0x40, 0x1F, 0xF8, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0x80, 0x50, 0x02, 0xFF, 0x43, 0xFD, 0x03, 0xFF, 0x0B, 0xFE, 0x03, 0xFF, 0x0F, 0xFE, 0x03,
-    0xFF, 0x0B, 0xFC, 0x07, 0xFE, 0x01, 0x90, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD5, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x06,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x01, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4,
-    0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x00,
-    0xBF, 0xE4, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFD, 0x01, 0xFF, 0xFE, 0x0B, 0xFF, 0xE0, 0xBF, 0xFF,
-    0x40, 0xBF, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF,
-    0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x5F, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4,
-    0xFF, 0x80, 0x3F, 0xD0, 0x01, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x7F, 0xD0, 0xBF,
-    0xC0, 0x02, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0xFF, 0x80, 0x03, 0xFD,
-    0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xDF,
-    0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF,
-    0x40, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x19, 0x40, 0x00, 0xBF, 0x0B, 0xFF, 0x80, 0x03, 0xFC, 0xBF, 0xFF, 0x80, 0x0F,
-    0xFB, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x6F, 0xFD, 0x02, 0xFF, 0xE0, 0x2F, 0xF4, 0x0B, 0xFF, 0x00,
-    0xBF, 0xD0, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0,
-    0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xF8,
-    0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x7F,
-    0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x3F, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03,
-    0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00,
-    0x1F, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x2F, 0xF0, 0x00,
-    0xFF, 0x5F, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x3F, 0xD0, 0x01, 0xFF, 0x0B, 0xFC,
-    0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x7F, 0xD0, 0xBF, 0xC0, 0x02, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x00,
-    0x3F, 0xE0, 0x2F, 0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F,
-    0xF9, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xDF, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00,
-    0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00,
-    0x02, 0xFC, 0x2F, 0xFE, 0x00, 0x0F, 0xF2, 0xFF, 0xFE, 0x00, 0x3F, 0xEF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFD, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0xBF, 0xD0, 0x2F, 0xFC, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x0B,
-    0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFE, 0x03,
-    0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xE0, 0x03, 0xFF, 0x01, 0xFF, 0x40,
-    0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x69, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-    0x80, 0x07, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x0B, 0xFA,
-    0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x5F, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x3F,
-    0xD0, 0x01, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x7F, 0xD0, 0xBF, 0xC0, 0x02, 0xFF,
-    0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x01, 0xFF, 0x4F,
-    0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xDF, 0xF0, 0x00, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFF,
-    0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xA4, 0x00,
-    0x6A, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0xBF, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xCB, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFB, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF6, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x2F, 0xF4,
-    0x00, 0xBF, 0xF0, 0x0B, 0xFD, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0xC0,
-    0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F,
-    0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x16, 0x40, 0x1F, 0xE1, 0xFE, 0x1F, 0xFF, 0x43, 0xFC, 0x1F, 0xD7, 0xFF,
-    0xFC, 0x15, 0x42, 0xFE, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x9F, 0xFE, 0x00, 0x03, 0xFF, 0xC0,
-    0x7F, 0xF0, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xD0,
-    0x07, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F, 0xF4,
-    0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8,
-    0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF0,
-    0x00, 0x7F, 0xBF, 0xE0, 0x02, 0xFF, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x4F,
-    0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x3F, 0xD0, 0x01, 0xFF, 0x07, 0xFD, 0x07, 0xFC,
-    0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0xBF, 0xC0, 0x02, 0xFF, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0xFF, 0xCF, 0xF4, 0x00, 0x7F, 0xC0, 0x07, 0xFD, 0xFF,
-    0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xF4,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF,
-    0xC0, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFD,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x02, 0xFC, 0x2F, 0xFE, 0x00, 0x0F, 0xF2, 0xFF,
-    0xFE, 0x00, 0x3F, 0xEF, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0xBF, 0xD0,
-    0x2F, 0xFC, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF,
-    0xD0, 0x3F, 0xE0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F,
-    0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xD0, 0x7F, 0xFD, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x2F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x0F, 0xFD,
-    0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC,
-    0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFD, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF,
-    0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF,
-    0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x0A, 0x80, 0x00, 0x00,
-    0xBE, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xBA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD,
-    0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x06, 0x80, 0x01, 0xFC, 0x00, 0xFC, 0x00,
-    0x0F, 0xFA, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF,
-    0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0,
-    0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4,
-    0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xA0, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF4, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00,
-    0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x07, 0xFF,
-    0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFD,
-    0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00,
-    0xFF, 0xE0, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFD, 0x01, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xA0, 0xAA, 0x80, 0x00, 0x03, 0xFE, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x83, 0xFD, 0x00,
-    0x00, 0x2F, 0xE0, 0xFF, 0x40, 0x00, 0x07, 0xF4, 0x2F, 0xC0, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0xBF, 0xF4,
-    0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x0F,
-    0xFC, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xE0, 0x07,
-    0xFF, 0x00, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x40, 0xBF, 0xF5, 0x55,
-    0x50, 0x07, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xD0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFA, 0xAA, 0xA0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x01, 0x65, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0x9B, 0xFF, 0xFE, 0x0B, 0xFD, 0x0F, 0xFD, 0x02, 0xFF, 0xF4, 0x03,
-    0xFE, 0x2F, 0xF8, 0x01, 0xFF, 0xE0, 0x07, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x3F,
-    0xF0, 0x00, 0xFF, 0xEA, 0xFF, 0xF8, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xE0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xD0, 0x02, 0xFF, 0xFA, 0x90, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0xC0, 0x00, 0x40,
-    0x3F, 0xFE, 0xFF, 0xFF, 0xF5, 0x6F, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xE9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x6F, 0xFE, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x07, 0xFE, 0x00,
-    0x7F, 0xF0, 0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x40, 0x1F, 0xFC, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x2F, 0xF4,
-    0x00, 0x0B, 0xFD, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x2F, 0xFC,
-    0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xAA, 0x40,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0xBF, 0x4B,
-    0xFC, 0x00, 0x3F, 0xDB, 0xFF, 0x00, 0x0F, 0xFB, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xF9, 0x10, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE9, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xF0, 0x6F, 0xFE, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0xBF, 0xD0,
-    0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x01, 0xFF, 0xC0, 0x7F,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0x00, 0x0F,
-    0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xF8,
-    0x00, 0xFF, 0xD0, 0x2F, 0xF4, 0x00, 0xBF, 0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0xBF, 0x4B, 0xFC, 0x00, 0x0F, 0xF6, 0xFF, 0xC0, 0x00, 0xFF, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xF9, 0x10, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x0A, 0x80, 0x00, 0x07, 0xF4, 0x0B, 0xF8, 0x00,
-    0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x6F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xE0, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x7F, 0xE0, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xD0,
-    0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x1F, 0xF8,
-    0x00, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x0B, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x2A, 0x00, 0x06, 0x90, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xF1,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0xBF, 0x4B, 0xFC, 0x00, 0x0F, 0xF6, 0xFF,
-    0xC0, 0x00, 0xFF, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xF9, 0x10, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x1B, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1E, 0x40, 0x0B, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x2F, 0xFC, 0x07, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x14,
-    0x00, 0x2F, 0xF4, 0x0B, 0xE9, 0xBF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x1B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x0F, 0xF8, 0x0F,
-    0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x1B, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1E, 0x40, 0x0B, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x5F, 0xF0, 0x01, 0xFF, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x2F, 0xFC, 0x07, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x14,
-    0x00, 0x2F, 0xF4, 0x0B, 0xE9, 0xBF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x1B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0x80, 0x6E, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x79, 0x00, 0x2F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0x01, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x50, 0x00,
-    0xBF, 0xD0, 0xBE, 0x9B, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0F, 0xF9,
-    0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0xA9, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x2F,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xE0, 0x1B, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x79, 0x00, 0x2F, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x1A, 0x80, 0x0B, 0xF4, 0x0B, 0xF8,
-    0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xF0, 0x1F, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x05, 0x00, 0x0B, 0xFD, 0x00, 0xBE, 0x9B, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x15, 0x5F, 0xFE, 0x55, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x2B, 0xFF, 0xAA, 0x40, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xEF, 0x00, 0x3F,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x06, 0xA0, 0x00, 0xFF, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x15,
-    0x5F, 0xFE, 0x55, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x02,
-    0xBF, 0xFA, 0xA4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x15, 0x5F, 0xFE, 0x55, 0x40,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0x5F, 0xFE, 0x54, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x0A, 0xFF, 0xEA, 0x90, 0x03, 0xFE, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x05, 0xBF, 0xE5, 0x40, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xEF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFD, 0x02, 0xF0, 0x00,
-    0x00, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE1, 0xBF, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F,
-    0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07,
-    0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00,
-    0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00,
-    0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x0B, 0xF8, 0x07, 0xD0, 0x00, 0xBF, 0xFE, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0x47,
-    0xFF, 0xC0, 0x00, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF,
-    0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFE, 0x03,
-    0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xC0,
-    0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0xFF, 0x00, 0x1F, 0xFF, 0xE3, 0xFC,
-    0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00,
-    0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0,
-    0x00, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE,
-    0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF,
-    0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F,
-    0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x0F, 0xFC, 0x00,
-    0xBF, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0x80, 0x1F, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0xF0,
-    0x0F, 0xFC, 0x0B, 0xFF, 0x80, 0x3F, 0xFE, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xDF, 0xF0, 0x01, 0xFF,
-    0xFE, 0x3F, 0xC0, 0x01, 0xFF, 0xD0, 0xFF, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4,
-    0x00, 0x68, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x01, 0xFF, 0xAB, 0xF8, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00,
-    0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
-    0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF,
-    0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x02, 0x90, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0xFF, 0xAB,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBE, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC,
-    0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F,
-    0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01,
-    0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFD, 0xFF, 0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00,
-    0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF,
-    0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F,
-    0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0,
-    0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xDF, 0xD0, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x07, 0xFB,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x2F,
-    0xF4, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x0F,
-    0xFC, 0x00, 0xBF, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0x80, 0x1F, 0xFC, 0x03, 0xFE, 0x00,
-    0xFF, 0xF0, 0x0F, 0xFC, 0x0B, 0xFF, 0x80, 0x3F, 0xFE, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xDF, 0xF0,
-    0x01, 0xFF, 0xFE, 0x3F, 0xC0, 0x01, 0xFF, 0xD0, 0xFF, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAA, 0x0A, 0xA8, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x3F,
-    0xD0, 0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0xF8,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF,
-    0xD0, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x6A, 0x90, 0x00, 0x02, 0xFF, 0x0F, 0xFC,
-    0x00, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x03, 0xF8, 0x0F, 0xD0,
-    0x00, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFD, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x03, 0xFE, 0x00,
-    0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xFE,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x00, 0x7F,
-    0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0,
-    0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
-    0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF,
-    0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F,
-    0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03,
-    0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01,
-    0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF,
-    0x80, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x0B,
-    0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFE, 0x03,
-    0xFF, 0x00, 0x2F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x3F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x80,
-    0x3F, 0xFC, 0x03, 0xFF, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF7, 0xFC,
-    0x00, 0x7F, 0xFF, 0x8F, 0xF0, 0x00, 0x7F, 0xF4, 0x3F, 0xC0, 0x00, 0x14, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xCF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xEF, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD,
-    0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xCF, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xF4, 0xFF,
-    0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x0F, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xE0, 0xFF, 0x80,
-    0x0F, 0xFF, 0xD0, 0x0B, 0xFC, 0x0F, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0x80, 0x3F,
-    0xEF, 0xD0, 0x2F, 0xF4, 0x0B, 0xF8, 0x07, 0xFA, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0xFF, 0x2F,
-    0xD0, 0x7F, 0xD0, 0x0B, 0xFC, 0x1F, 0xF2, 0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0xC3, 0xFD, 0x2F, 0xD0,
-    0xFF, 0x40, 0x0B, 0xFC, 0x7F, 0xC1, 0xFD, 0x2F, 0xF0, 0x00, 0xBF, 0xCB, 0xF8, 0x1F, 0xD3, 0xFE,
-    0x00, 0x0B, 0xF8, 0xFF, 0x01, 0xFD, 0x7F, 0xC0, 0x00, 0xBF, 0x9F, 0xE0, 0x1F, 0xDF, 0xF8, 0x00,
-    0x07, 0xFB, 0xFC, 0x01, 0xFD, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x40, 0x00, 0x00,
-    0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x7F, 0xEF,
-    0xF8, 0x02, 0xFF, 0xD0, 0x0F, 0xFC, 0xFF, 0x80, 0x3F, 0xFD, 0x00, 0xFF, 0x8F, 0xF8, 0x07, 0xFF,
-    0xD0, 0x2F, 0xF0, 0xFF, 0x80, 0xFE, 0xFD, 0x03, 0xFE, 0x0B, 0xF8, 0x1F, 0xDF, 0xD0, 0xBF, 0xD0,
-    0xBF, 0x83, 0xFC, 0xFD, 0x0F, 0xFC, 0x0B, 0xF8, 0x3F, 0x8F, 0xD1, 0xFF, 0x40, 0xBF, 0x8B, 0xF0,
-    0xFD, 0x3F, 0xF0, 0x0B, 0xF8, 0xFF, 0x0F, 0xD3, 0xFD, 0x00, 0x7F, 0x9F, 0xD0, 0xFD, 0xBF, 0xC0,
-    0x07, 0xFB, 0xFC, 0x0F, 0xDF, 0xF4, 0x00, 0x7F, 0xBF, 0x80, 0xFE, 0xFF, 0x00, 0x07, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0x80,
-    0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF5, 0xFF,
-    0x00, 0x01, 0xFF, 0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x02, 0xFF, 0xC7, 0xFE, 0x00,
-    0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF0,
-    0x01, 0xFF, 0x42, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFB, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF6, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x9F, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xFD, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0xFF, 0x40, 0x00, 0x3F, 0x83,
-    0xFC, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x02, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x0F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0x42, 0xFF,
-    0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x15, 0x55, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0A, 0xAA, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x15,
-    0x55, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x02, 0xAA, 0xBF, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x1A, 0x80, 0x00, 0x0B, 0xF4, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x15, 0x55, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1A, 0x80, 0x01, 0xA4, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
-    0x00, 0x7F, 0x87, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x2A, 0xAB, 0xFF, 0xC0, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x64, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x7F, 0xE0,
-    0x3F, 0xF0, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0xFC, 0x00, 0xAA, 0x80, 0x3F, 0xF8, 0x07, 0xFE, 0x00,
-    0xFF, 0x80, 0x3F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1A, 0xA8, 0x00, 0x07, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0x00, 0x7F, 0xDB, 0xF8, 0x1F, 0xF0, 0x2F, 0xD3, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x50,
-    0x1F, 0xF4, 0x0F, 0xC1, 0xFF, 0xFE, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x7E, 0x1F, 0xFF, 0x41, 0xF0,
-    0x06, 0xE0, 0x00, 0x15, 0x55, 0x55, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xAF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x55,
-    0x40, 0x68, 0x00, 0x2A, 0x2F, 0x80, 0x1F, 0xCB, 0xFA, 0xBF, 0xD0, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xE0, 0x00, 0xAE, 0x90, 0x00, 0x05, 0x03, 0xFD, 0xBF, 0xEF, 0xFE, 0xBF, 0xC1, 0x90, 0x00, 0x00,
-    0x00, 0x2F, 0x41, 0xF8, 0x7F, 0xC3, 0xFC, 0xBF, 0xC7, 0xFC, 0x7F, 0x43, 0xF8, 0x04, 0x00, 0x40,
-    0x6A, 0x80, 0xFF, 0xF4, 0xFF, 0xFC, 0x43, 0xFC, 0x02, 0xFC, 0x1B, 0xF4, 0x3F, 0xD0, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xE4, 0x0F, 0xFF, 0x8B, 0xE7, 0xF3, 0xF0, 0x3D, 0xFC, 0x1F, 0x6F, 0xAF, 0xC3,
-    0xFF, 0xD0, 0x2F, 0x90, 0x00, 0x6A, 0x82, 0xA9, 0x01, 0xFF, 0x4B, 0xFC, 0x03, 0xFD, 0x1F, 0xF0,
-    0x0F, 0xF4, 0x3F, 0xC0, 0x2F, 0xC0, 0xFE, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x2A, 0x40, 0x06, 0xA0,
-    0xBF, 0x00, 0xBF, 0x40, 0xFF, 0x0F, 0xF4, 0x01, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x06, 0x90, 0xFD, 0x0F, 0xC1, 0xFC, 0x2F, 0xC2, 0xF8, 0x3F, 0x43, 0xF0, 0x7F,
-    0x05, 0x50, 0x0A, 0x80, 0xA8, 0x0F, 0xC2, 0xFC, 0x1F, 0xC2, 0xF8, 0x2F, 0x83, 0xF4, 0x3F, 0x83,
-    0xF0, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0x91, 0xAA, 0x02, 0xFF, 0x1F, 0xF0, 0x0F, 0xF4,
-    0xBF, 0x40, 0x3F, 0x83, 0xFC, 0x01, 0xFC, 0x0F, 0xD0, 0x07, 0xD0, 0x3E, 0x00, 0x14, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x40, 0x68, 0xFF, 0x1A, 0xBC, 0x28, 0x3E, 0x7E, 0x00, 0xFC, 0x3F, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xE0, 0x01, 0xBE, 0x40, 0x00, 0x1A, 0x90, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFC, 0x3F, 0x40, 0x3F, 0x4F, 0x80, 0x07, 0xD0, 0x00, 0xBF, 0x00, 0x3F, 0xC0,
-    0x3F, 0xD0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x15, 0x40, 0x00,
-    0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x3F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x03, 0xFC, 0x01,
-    0xFE, 0x00, 0x55, 0x00, 0x00, 0xFF, 0x7F, 0xEF, 0xFA, 0xFE, 0xBF, 0x9F, 0xE3, 0xF8, 0xFE, 0x15,
-    0x00, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x3F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x03, 0xFC,
-    0x01, 0xFE, 0x00, 0x55, 0x00, 0x00, 0x6A, 0x90, 0x3F, 0xF0, 0x1F, 0xF0, 0x0B, 0xF8, 0x03, 0xFC,
-    0x00, 0xBD, 0x00, 0x6A, 0x90, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0x9F, 0xFD, 0xBF, 0xF0, 0x07, 0xC0, 0x1E, 0x00, 0x10, 0x00,
-    0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1F, 0xFD, 0x2F, 0xFC, 0x3D, 0x00, 0x3C, 0x00, 0x14, 0x00, 0x05,
-    0x55, 0x54, 0xFF, 0xFF, 0xE2, 0xAA, 0xAF, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0,
-    0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x6A, 0x80, 0x0F, 0xFC,
-    0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x1F, 0xFD, 0x0B, 0xFF, 0x80, 0xBF, 0xD0, 0x0F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0xFC, 0x3F, 0xC7, 0xD0, 0xBC, 0x0B, 0xC0, 0x3F, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0x50, 0x01, 0xE0, 0x02, 0xE0, 0x03, 0xD0, 0x7F, 0xFD, 0xBF, 0xFD, 0x15, 0x55, 0x0F, 0xFF,
-    0xC2, 0xBF, 0xA0, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xF0,
-    0x2B, 0xFA, 0x3F, 0xFE, 0x17, 0xD4, 0x07, 0xC0, 0x06, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFE,
-    0x00, 0x6A, 0x40, 0x2F, 0xE0, 0x0F, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x8A, 0xBF, 0xD3,
-    0xFF, 0xF0, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x1A, 0x90, 0x3F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F,
-    0xC0, 0xBF, 0xC0, 0x7F, 0xFE, 0x3F, 0xFE, 0x1F, 0xFE, 0x02, 0xA8, 0x0B, 0xD0, 0xFF, 0xD3, 0xFF,
-    0x4F, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x81, 0xFC, 0x3F, 0xC3, 0xFD, 0x3F,
-    0xC3, 0xFD, 0x3F, 0x82, 0xFC, 0x04, 0x00, 0x10, 0x0B, 0xE4, 0x0F, 0xFF, 0x4B, 0xE7, 0xF3, 0xE0,
-    0x7D, 0xF8, 0x1F, 0x6F, 0xAF, 0xC3, 0xFF, 0xD0, 0x2F, 0x90, 0x0F, 0xF8, 0xBF, 0xC3, 0xFD, 0x1F,
-    0xE0, 0xFE, 0x01, 0x50, 0x00, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x02, 0xFD, 0x00, 0xBF,
-    0x4F, 0xFF, 0xC3, 0xFF, 0xE0, 0xFF, 0x90, 0x07, 0xF4, 0x7F, 0x07, 0xF0, 0x3F, 0xC0, 0xFF, 0x03,
-    0xFF, 0xDB, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x02, 0xA0, 0x1F, 0xC0, 0xBE, 0x03, 0xF4, 0x0F, 0xC0,
-    0x7F, 0x02, 0xFC, 0x0F, 0xE0, 0x3F, 0x40, 0x54, 0x00, 0x05, 0x55, 0x55, 0x51, 0xFF, 0xFF, 0xFE,
-    0x2F, 0xAA, 0xAB, 0xD2, 0xE0, 0x00, 0x3C, 0x3D, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0xB8, 0x14, 0x00,
-    0x01, 0x00, 0xB0, 0x0D, 0x03, 0xEC, 0x0F, 0x82, 0xE7, 0xFF, 0xFF, 0xF0, 0x7E, 0x4B, 0xE0, 0x69,
-    0x00, 0x0A, 0x93, 0xF8, 0x07, 0xFC, 0x2F, 0xE2, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x0F, 0xFF, 0xC0, 0x02, 0xFF, 0xFE, 0x00, 0xBF,
-    0xCF, 0xF4, 0x3F, 0xE0, 0x3F, 0xCB, 0xF4, 0x00, 0xFD, 0x2A, 0x00, 0x0A, 0x4F, 0xC0, 0x0F, 0xD3,
-    0xFE, 0xAF, 0xF0, 0xBF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x6A, 0x40,
-    0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xEF, 0xFC, 0x7F, 0x00, 0x7F, 0x1F, 0x40, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x50, 0x1F, 0xF4, 0x0F, 0xC1, 0xFF, 0xFE, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x7E, 0x1F, 0xFF, 0x41, 0xF0, 0x06, 0xE0, 0x00, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55,
-    0x40, 0x05, 0x55, 0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0x7F, 0xFF, 0xFF, 0xF0, 0x6A, 0xAA, 0xAA,
-    0x90, 0x00, 0x00, 0x00, 0x40, 0xBF, 0xD0, 0x3E, 0x2F, 0xFF, 0xAF, 0xD3, 0xFF, 0xFF, 0xFC, 0xBD,
-    0x1F, 0xFF, 0x0B, 0x80, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xFC, 0x07, 0xFF, 0xD0, 0x3F, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x3F,
-    0x40, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x0F, 0xC0, 0x7D, 0x03, 0xD0, 0x7D, 0x3F, 0xC7, 0xF0, 0x10, 0x00, 0x05,
-    0x00, 0x00, 0x50, 0xF0, 0x00, 0x1E, 0x1F, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x3D, 0x3F, 0xAA, 0xAB,
-    0xC3, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x0F,
-    0xAA, 0xAB, 0xD0, 0xE0, 0x00, 0x3C, 0x1D, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x78, 0x3F, 0xFF, 0xFF,
-    0x42, 0xAA, 0xAA, 0xA0, 0x07, 0xF4, 0xBE, 0x0B, 0xEF, 0xFB, 0xE7, 0x81, 0xF0, 0x3E, 0xC0, 0x34,
-    0x0E, 0x08, 0x08, 0x2F, 0x3E, 0x0F, 0xF8, 0x0B, 0xF0, 0x1F, 0xF0, 0x7D, 0xFC, 0x20, 0x20, 0x00,
-    0x6C, 0x03, 0xFC, 0x07, 0xC0, 0x0B, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xE0, 0x2F,
-    0xC0, 0x29, 0x00, 0x05, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0xAA, 0x8B, 0xFF, 0xFF, 0xFF, 0x1A, 0xAA, 0xAA,
-    0xA4, 0x2A, 0x90, 0x3F, 0xF0, 0x1F, 0xF4, 0x0B, 0xF8, 0x02, 0xFC, 0x00, 0xBD, 0x01, 0xAA, 0x80,
-    0x3F, 0xF4, 0x0B, 0xFD, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0xBF, 0xD0, 0x3E, 0x2F, 0xFF, 0xAF, 0xD3, 0xFF, 0xFF, 0xFC, 0xBD, 0x1F, 0xFF, 0x0B, 0x80, 0x1B,
-    0x80, 0x7F, 0x87, 0xFF, 0x6F, 0xF0, 0x7F, 0x0F, 0xD0, 0xB4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x02, 0xF8, 0x3F, 0xF4, 0xFD, 0x7F, 0xC7, 0xFE, 0x3F, 0xEB, 0xF8, 0xBF, 0x83, 0xFD, 0xBF, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x41, 0xFC, 0x00, 0x40, 0x0F, 0xE0, 0x7F, 0x42, 0xFD, 0x0F, 0xFE, 0x3F, 0xF4,
-    0x3F, 0xC0, 0x05, 0x55, 0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xAA, 0xAA, 0xFC, 0x3D, 0x00,
-    0x00, 0xB8, 0x3C, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x50, 0x05, 0x55,
-    0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0x7F, 0xFF, 0xFF, 0xF0, 0x6A, 0xAA, 0xAA, 0x90, 0x1A, 0x42,
-    0xA0, 0xFD, 0x0F, 0xC3, 0xF4, 0x7F, 0x1F, 0xC2, 0xFC, 0x7F, 0x0F, 0xE2, 0xF8, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xE0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x01, 0x00,
-    0x00, 0x54, 0xF0, 0x50, 0xBF, 0xF4, 0x78, 0x7F, 0xFF, 0xBD, 0x3D, 0x3F, 0xFE, 0x0E, 0x1E, 0x69,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x02, 0xFD, 0x02, 0xD3, 0xFF, 0xE6, 0xF1, 0xF5, 0xFF,
-    0xF4, 0xF0, 0x07, 0xF4, 0x00, 0x19, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x68, 0x01, 0x90, 0x3F, 0xFD, 0x7C, 0x0B, 0xFF, 0xFF, 0x80,
-    0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xB4, 0x0F, 0xFF, 0xAF, 0x02, 0xE6, 0xFF,
-    0xD0, 0x3C, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0xB0, 0x2D, 0x01, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xF8, 0x0F, 0x81, 0xF4, 0x00, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0xBE, 0x0B, 0xFD, 0x07, 0xC0, 0x2E, 0x00, 0xF4, 0x03, 0xC0, 0xBF, 0xC0, 0x2F, 0xF8, 0x03, 0xFE,
-    0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x53, 0xC5, 0x00, 0x0F, 0x50, 0x00, 0xB2, 0x8E, 0x00, 0x05, 0x00, 0x0E,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x09, 0x00,
-    0x50, 0x70, 0x00, 0x00, 0x0E, 0x05, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x90, 0x00, 0x00,
-    0x03, 0x0F, 0xF0, 0xD0, 0x00, 0x00, 0x07, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x70,
-    0x00, 0x00, 0x0E, 0x0A, 0x00, 0x70, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB1, 0x4E, 0x00, 0x00, 0xF0, 0x00, 0x63, 0xC9,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0x00, 0x0F, 0x40, 0xBF, 0x40, 0xBE,
-    0x0B, 0xEB, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x40, 0xBC, 0x3F, 0xC7, 0xD0, 0xBC, 0x0B, 0xC0, 0x3F,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x3F, 0x95, 0xFD,
-    0x7D, 0x00, 0x3E, 0xBC, 0xBE, 0x3E, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x08,
-    0x20, 0x3E, 0xFC, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xF8, 0x1D, 0x38, 0x00, 0x00, 0x00, 0x50, 0x7E,
-    0x7F, 0x8F, 0xC0, 0xBF, 0x40, 0xBE, 0x00, 0xA0, 0x20, 0x00, 0xF8, 0x01, 0xFE, 0x00, 0xBD, 0x0B,
-    0xF4, 0xFD, 0x03, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x40, 0x3F, 0x03, 0xFD, 0x0F, 0xC0, 0x1F,
-    0x8B, 0xB8, 0x1F, 0xE3, 0xCF, 0x2F, 0x81, 0xE2, 0xDA, 0x00, 0xB0, 0x38, 0x00, 0x01, 0xE0, 0x1F,
-    0x80, 0xBC, 0x07, 0xC0, 0xBC, 0x7F, 0x8B, 0xE0, 0x50, 0x00, 0x05, 0x03, 0xFD, 0xBF, 0xEF, 0xFE,
-    0xBF, 0xC1, 0x90, 0x01, 0x90, 0x00, 0x74, 0x02, 0xEE, 0xE0, 0xBF, 0xF8, 0x07, 0xF4, 0x03, 0xDF,
-    0x00, 0x62, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xBF, 0x47, 0xEB, 0xFE, 0xF6, 0xC0, 0xB8, 0x0F,
-    0xF0, 0x1D, 0x03, 0xEC, 0x0B, 0x80, 0xF7, 0xEF, 0xFE, 0xF4, 0x7F, 0x8B, 0xF4, 0x00, 0x00, 0xE0,
-    0x07, 0x40, 0x2F, 0xFC, 0xFF, 0xF0, 0x03, 0x80, 0x1D, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x93, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0x00, 0xFF,
-    0xF9, 0x55, 0x6B, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x87,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xF9, 0x55,
-    0x6B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x06, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFC, 0x1A, 0xAA, 0xAA, 0xAA, 0xA4, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0B, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE, 0xAA, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7E, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x02, 0xE0, 0x00,
-    0x00, 0x06, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x05, 0xAA, 0x94, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xEA, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x82, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xD2,
-    0xFB, 0xF0, 0xF4, 0x7C, 0x7C, 0x2E, 0x2F, 0x0F, 0x4B, 0xCB, 0xC0, 0xFF, 0xF0, 0x05, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0xF9, 0xF0, 0xB8, 0x7C, 0x3F, 0xFD, 0x0F, 0x50, 0x03, 0xD0, 0x40,
-    0xBF, 0xF0, 0x01, 0x50, 0x00, 0x07, 0x42, 0xE0, 0x00, 0x3C, 0x1F, 0x0B, 0x83, 0xD0, 0xF0, 0x7C,
-    0x2E, 0x01, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0xBE, 0x3D, 0x1F, 0x7C, 0x1F, 0xB8, 0x2E, 0x7C,
-    0x7C, 0x3F, 0xF4, 0x05, 0x40, 0x1E, 0x0F, 0x4B, 0x43, 0xC3, 0xC1, 0xF0, 0xF0, 0xB8, 0x7C, 0x3D,
-    0x1F, 0x2F, 0x03, 0xFB, 0xC0, 0x14, 0x50, 0x00, 0x00, 0x2F, 0xE2, 0xFA, 0x5F, 0x00, 0xB8, 0x02,
-    0xE0, 0x0B, 0xC1, 0x0F, 0xFC, 0x05, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0xBE,
-    0xF4, 0x2F, 0xBF, 0x03, 0xD1, 0xF0, 0x7C, 0x1E, 0x0B, 0x83, 0xD0, 0x7C, 0x7C, 0x03, 0xFF, 0xC0,
-    0x05, 0x14, 0x00, 0x02, 0xD0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0xBD, 0x0B, 0xEB, 0xC3, 0xE1,
-    0xF0, 0xF0, 0x7C, 0x7C, 0x2E, 0x2E, 0x0F, 0x4F, 0x43, 0xC1, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0xB7, 0xF2, 0xF8, 0x0F, 0xEF, 0xFB, 0xC0, 0xF4, 0xBC, 0x3C, 0x1F, 0x0F, 0x43, 0xC2, 0xE0, 0xF0,
-    0x7C, 0x3D, 0x1F, 0x0B, 0x83, 0xC2, 0xE0, 0xF4, 0x14, 0x04, 0x05, 0x00, 0x00, 0x00, 0x3D, 0xF1,
-    0xFF, 0x8B, 0xC0, 0x3E, 0x00, 0xF0, 0x03, 0xC0, 0x1F, 0x00, 0x10, 0x00, 0x01, 0x40, 0x0E, 0x02,
-    0xFF, 0x4B, 0xE8, 0x1F, 0x00, 0x78, 0x02, 0xD0, 0x0F, 0x40, 0x3F, 0xC0, 0x15, 0x00, 0xB4, 0x2E,
-    0xB4, 0x3C, 0xB8, 0xF4, 0x79, 0xF0, 0x7B, 0xC0, 0x3F, 0x80, 0x3F, 0x00, 0x14, 0x00, 0x07, 0xC3,
-    0xE0, 0x3D, 0xF8, 0x02, 0xFE, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0xFB, 0xD0, 0x2F, 0x1F, 0x01,
-    0x40, 0x50, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xF5, 0x55, 0x50, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xA9, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0x0F,
-    0xF0, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x01, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0xA4, 0x06, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xF5, 0x55, 0x50, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xA9, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x15, 0x5F, 0xFE, 0x55, 0x50, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x59, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFE, 0xAB, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x7F,
-    0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0xFF,
-    0xC0, 0x2F, 0xF4, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0x0F, 0xFF, 0xFC,
-    0x00, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x7F, 0xE0, 0xFF, 0xFE, 0x00, 0x2F, 0xF4, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0x40, 0x2F, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x40, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x0B, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x1E, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x79, 0x00,
-    0x2F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBF,
-    0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07,
-    0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x1F, 0x80, 0x07, 0xFC, 0xFF, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x7F, 0x4F, 0xE0,
-    0x00, 0xA4, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x14, 0x7F, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x56, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x03, 0xFE, 0x00,
-    0x2F, 0xF4, 0x02, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xF8, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x01, 0x5F, 0xFF, 0x00, 0x0B, 0xFD, 0x06, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFD, 0x55, 0x5F, 0xFD, 0x5F, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x07, 0xFE, 0x00,
-    0x07, 0xFF, 0x01, 0xFF, 0xF0, 0x2F, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x15, 0x5F, 0xFE, 0x55, 0x50, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x59, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0xAB, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xE0,
-    0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x2F,
-    0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00,
-    0x00, 0x7F, 0xE0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0xBF,
-    0xE0, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0xFE,
-    0x00, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xE0, 0x00,
-    0x2F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xFC,
-    0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x3F,
-    0xEF, 0xF4, 0x00, 0xFF, 0x80, 0xBF, 0x9F, 0xF0, 0x00, 0xFF, 0x41, 0xFF, 0x2F, 0xF0, 0x01, 0xFF,
-    0x03, 0xFD, 0x3F, 0xE0, 0x02, 0xFF, 0x0B, 0xFC, 0x3F, 0xD0, 0x03, 0xFE, 0x1F, 0xF0, 0x7F, 0xC0,
-    0x03, 0xFD, 0x3F, 0xE0, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0xFF, 0xC0, 0x0B, 0xFD, 0xFF, 0x00,
-    0xFF, 0x80, 0x0B, 0xFB, 0xFE, 0x01, 0xFF, 0x40, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x0F, 0xFF,
-    0xF4, 0x02, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
-    0x3F, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x3F, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0B,
-    0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x00,
-    0x1F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC1, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0x03, 0xFE, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x40, 0x02,
-    0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00,
-    0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x0B,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00,
-    0x07, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x7F, 0xD0,
-    0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x02,
-    0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xF5, 0x55, 0x5F,
-    0xF4, 0x2F, 0xF4, 0x00, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x8B, 0xFE, 0x00, 0x00, 0x3F,
-    0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xF5, 0x55, 0x50, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x90, 0x00, 0x01, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x56, 0xFF,
-    0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x3F, 0xF0,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x1F, 0xF8, 0x07, 0xFF, 0xD0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF5, 0x5F, 0xFF, 0x40, 0x0F, 0xFC,
-    0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0xC0,
-    0x07, 0xFE, 0x00, 0x3F, 0xF5, 0x5B, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xEA, 0xBF, 0xFC, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x0B,
-    0xFE, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x55, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xD5, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xA9, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0x3F,
-    0xE0, 0x01, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xE0,
-    0x00, 0x00, 0x07, 0xFE, 0x03, 0xFE, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x1F, 0xF4, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xC3, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFF,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x07, 0xFD, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x2F, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xF8,
-    0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0xE0, 0x02,
-    0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x79, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x05, 0x56, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x64, 0x00, 0x0B, 0xFF, 0x80, 0x7F, 0xEA, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x7F,
-    0xC0, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x3F, 0xEF, 0xF4,
-    0x00, 0xFF, 0x80, 0xBF, 0x9F, 0xF0, 0x00, 0xFF, 0x41, 0xFF, 0x2F, 0xF0, 0x01, 0xFF, 0x03, 0xFD,
-    0x3F, 0xE0, 0x02, 0xFF, 0x0B, 0xFC, 0x3F, 0xD0, 0x03, 0xFE, 0x1F, 0xF0, 0x7F, 0xC0, 0x03, 0xFD,
-    0x3F, 0xE0, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0xFF, 0xC0, 0x0B, 0xFD, 0xFF, 0x00, 0xFF, 0x80,
-    0x0B, 0xFB, 0xFE, 0x01, 0xFF, 0x40, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x02,
-    0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xFF,
-    0x40, 0x07, 0xFD, 0x00, 0x3F, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFA, 0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x7F,
-    0xC0, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x3F, 0xEF, 0xF4,
-    0x00, 0xFF, 0x80, 0xBF, 0x9F, 0xF0, 0x00, 0xFF, 0x41, 0xFF, 0x2F, 0xF0, 0x01, 0xFF, 0x03, 0xFD,
-    0x3F, 0xE0, 0x02, 0xFF, 0x0B, 0xFC, 0x3F, 0xD0, 0x03, 0xFE, 0x1F, 0xF0, 0x7F, 0xC0, 0x03, 0xFD,
-    0x3F, 0xE0, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0xFF, 0xC0, 0x0B, 0xFD, 0xFF, 0x00, 0xFF, 0x80,
-    0x0B, 0xFB, 0xFE, 0x01, 0xFF, 0x40, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x02,
-    0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xFF,
-    0x40, 0x07, 0xFD, 0x00, 0x3F, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF4, 0x00,
-    0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x7F,
-    0xE0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0xBF, 0xE0, 0x00,
-    0x00, 0xFF, 0xC2, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF,
-    0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0xFE, 0x00, 0x00,
-    0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x02, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0xF4,
-    0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF9, 0x56, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x07,
-    0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0x02,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x01,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x01, 0x1F, 0xFF, 0x00, 0x07,
-    0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0xBF, 0xBF, 0x80, 0x02, 0xFE, 0xFF, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x3F, 0xEF, 0xF0, 0x00,
-    0xFF, 0x7F, 0xC0, 0x0B, 0xF7, 0xFE, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0xFF, 0x3F, 0xD0, 0x01, 0xFF,
-    0x3F, 0xC0, 0x2F, 0xD7, 0xFC, 0x00, 0x2F, 0xF2, 0xFC, 0x03, 0xFC, 0xBF, 0xC0, 0x03, 0xFE, 0x2F,
-    0xC0, 0xBF, 0x4F, 0xFC, 0x00, 0x3F, 0xD2, 0xFC, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x2F, 0xC2,
-    0xFD, 0x0F, 0xF4, 0x00, 0x7F, 0xC1, 0xFD, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xFC, 0x1F, 0xDB, 0xF4,
-    0x2F, 0xF0, 0x00, 0xFF, 0x81, 0xFE, 0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x1F, 0xFF, 0xD0, 0x3F,
-    0xE0, 0x01, 0xFF, 0x01, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0x40, 0x7F, 0xC0,
-    0x02, 0xFF, 0x00, 0xFF, 0xF0, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0xFF, 0x80, 0x03,
-    0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF4,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xEA,
-    0xAA, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xE4, 0x1F, 0xFF, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xFE, 0x00,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xFF,
-    0xC0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00,
-    0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00,
-    0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x03, 0xFF,
-    0x40, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF5, 0x55, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
-    0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x02,
-    0xFF, 0x40, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x00,
-    0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xE8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xF5, 0x7F, 0xFE, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0xC0, 0x0B, 0xFD, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x80, 0x1F, 0xF8, 0x02, 0xFF, 0xC0, 0x0B, 0xFF, 0xAF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xF9, 0x55, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x40, 0x2F, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x40,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x0B, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x15, 0x5F, 0xFE, 0x55, 0x40, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x03, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0F,
-    0xF8, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC1, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF,
-    0xD0, 0x3F, 0xD0, 0x7F, 0xFC, 0x0F, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x1F, 0xFC, 0x00, 0x7F,
-    0xC0, 0x0B, 0xFD, 0x2F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x07,
-    0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFD, 0x3F, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xFC, 0x3F,
-    0xF4, 0x02, 0xFF, 0x00, 0x1F, 0xFC, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x7F, 0xF4, 0x0F, 0xFF, 0x43,
-    0xFE, 0x06, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0xBF,
-    0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x03,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x40, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x02, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
-    0x40, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x01,
-    0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
-    0xFC, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x07,
-    0xFF, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF4, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF,
-    0x80, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0x1F, 0xF8, 0x0B, 0xFD,
-    0x00, 0x0B, 0xFD, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xBF, 0xFE, 0x5B, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6A,
-    0xA7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x2F,
-    0xF4, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F,
-    0xE0, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xE0,
-    0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0,
-    0x02, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00,
-    0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00,
-    0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x2F, 0xF4,
-    0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x7F,
-    0xE0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00,
-    0x2F, 0xF4, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x5F,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xF4,
-    0x07, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0,
-    0x07, 0xFF, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x80, 0x2F, 0xF4, 0x01, 0xFF, 0xD0, 0x0F, 0xFD, 0x06,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xD4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00,
-    0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0x01, 0xFF, 0xC0,
-    0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0B,
-    0xFD, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x7F, 0xF0, 0x01, 0xFF, 0x80, 0x7F, 0xFC, 0x0B, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x80, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE4, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xD4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xE0,
-    0x03, 0xFF, 0x41, 0xFF, 0x80, 0x0F, 0xFD, 0x0B, 0xFD, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0xFF, 0xC0, 0x0F, 0xFF, 0x07, 0xFE, 0x01, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x0E, 0x40, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x34, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFC, 0x01, 0xFF, 0xF4, 0x1F, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0,
-    0x02, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xF4, 0x00, 0x03, 0xFF,
-    0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x5F, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFA, 0xBF, 0xF8, 0x00, 0x00,
-    0x7F, 0xE0, 0x0F, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0xBF, 0xF4,
-    0x07, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x01, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0x07, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xF8,
-    0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x0F, 0xF0, 0x03, 0xFF, 0xFE, 0xBF, 0x80, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x03, 0xFF, 0xE6, 0xFF, 0xF0, 0x1F, 0xFD, 0x03, 0xFF, 0xC0, 0xFF, 0xD0, 0x07, 0xFE, 0x03, 0xFF,
-    0x00, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0xBF, 0xD0, 0x01, 0xFF, 0x03, 0xFF, 0x00, 0x0B,
-    0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x03,
-    0xFF, 0x80, 0xBF, 0xF0, 0x0B, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xE7, 0xF4, 0x00, 0x2F, 0xFD, 0x2F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x90, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0x80, 0x00, 0xFF, 0x9F, 0xFF, 0xC0,
-    0x07, 0xFE, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xEF, 0xFF, 0x40, 0xFF, 0xF8, 0x0F, 0xFE, 0x03, 0xFF,
-    0x80, 0x1F, 0xF8, 0x1F, 0xFC, 0x00, 0x7F, 0xE0, 0x7F, 0xF0, 0x01, 0xFF, 0x82, 0xFF, 0x80, 0x07,
-    0xFD, 0x0B, 0xFE, 0x00, 0x2F, 0xF4, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x07, 0xFE, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x03, 0xFF, 0xEB, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xD0, 0xBF, 0xE0, 0x7F, 0xF0, 0x03, 0xFE, 0x0F, 0xFD, 0x00, 0x7F, 0xD0, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0x55, 0xBF, 0xF0, 0x3F, 0xF0, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x1F, 0xF8, 0x2F, 0xF4, 0x02, 0xFF,
-    0x40, 0xFF, 0xD0, 0x7F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xB9, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x00, 0xBF, 0xF5, 0x6F, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x3A,
-    0xAF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x47, 0xFE, 0x02, 0xFF, 0xFE, 0x7F, 0xE0, 0xBF, 0xFF,
-    0xFB, 0xFE, 0x1F, 0xFF, 0xEF, 0xFF, 0xE3, 0xFF, 0xC0, 0x3F, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xD7,
-    0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x02,
-    0xFF, 0x4F, 0xFC, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x0B, 0xFE, 0x0B, 0xFE, 0x01, 0xFF, 0xC0, 0x7F,
-    0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x90,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0x43, 0xFF, 0x03, 0xFF, 0x00, 0xBF, 0xC2,
-    0xFF, 0x40, 0x3F, 0xF0, 0xFF, 0xC0, 0x2F, 0xF8, 0x7F, 0xFA, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFA, 0x90, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x05, 0x01, 0xFF, 0xF5, 0x6F, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x1F, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xFC, 0x00,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x0F, 0xF8, 0x0B, 0xFF, 0xF4, 0x00, 0x5F, 0xFF,
-    0x01, 0xFF, 0x41, 0xFF, 0xE5, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0x42, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x0F, 0xF8, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x41, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xF8, 0x1F, 0xF4, 0x1F, 0xFC, 0x00, 0x01, 0xAF, 0xFF, 0x02, 0xFF, 0x00,
-    0xFF, 0xFA, 0x00, 0x2F, 0xFF, 0xD0, 0x3F, 0xF0, 0x0B, 0xFF, 0xF0, 0x03, 0xFF, 0xF4, 0x03, 0xFE,
-    0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xF0, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFD, 0x02, 0xE4, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x55, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF8, 0x7E, 0xAA, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF9,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F,
-    0xE0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x01,
-    0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0,
-    0xBF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x07, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0xF8, 0x07, 0xFF, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0xBF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xF7, 0xFC, 0x00, 0xBF, 0xFF, 0x8F, 0xF0, 0x00, 0xBF, 0xF4, 0x3F, 0x80, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x0A, 0xA0, 0x00, 0xBF, 0x40, 0x7F, 0x80, 0x01, 0xFE,
-    0x03, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F,
-    0xF8, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xF0,
-    0x2F, 0xF0, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x01, 0xFF, 0xC0, 0x7F, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0xFF, 0xF8, 0x07, 0xFF, 0xEF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFD, 0xFF, 0x00, 0x2F, 0xFF, 0xE3, 0xFC, 0x00, 0x2F, 0xFD, 0x0F, 0xE0, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80,
-    0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x07, 0xFE, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x00,
-    0xBF, 0xC0, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0xFF, 0xE0, 0x00, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFB, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x7F, 0xF0, 0x00, 0x07, 0xFD, 0x0F, 0xFD, 0x00, 0x02, 0xFF,
-    0x42, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x1F, 0xF8,
-    0x01, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFE, 0xAB, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0xBF,
-    0xC0, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x03, 0xFF, 0x00, 0x07, 0xFC,
-    0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x80, 0x2F, 0xF4, 0x00, 0x7F, 0xD0,
-    0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0xFF, 0xFC, 0x00,
-    0x7F, 0xE0, 0x3F, 0xFD, 0x00, 0x2F, 0xF4, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x02, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0x80, 0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x02, 0xFE, 0xFF, 0x00,
-    0x3F, 0xEF, 0xD0, 0x3F, 0xEF, 0xF0, 0x07, 0xFD, 0xFD, 0x0B, 0xF7, 0xFE, 0x00, 0xBF, 0xCF, 0xE0,
-    0xFF, 0x3F, 0xD0, 0x0F, 0xF8, 0xFE, 0x2F, 0xD3, 0xFD, 0x00, 0xFF, 0x4F, 0xE3, 0xFC, 0x7F, 0xC0,
-    0x0F, 0xF0, 0xFE, 0xBF, 0x4B, 0xFC, 0x01, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0x80, 0x2F, 0xF0, 0xFF,
-    0xFD, 0x0F, 0xF4, 0x03, 0xFE, 0x0F, 0xFF, 0xC1, 0xFF, 0x00, 0x3F, 0xD0, 0xFF, 0xF4, 0x2F, 0xF0,
-    0x07, 0xFC, 0x0F, 0xFF, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0xD0, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0x80,
-    0x1F, 0xF8, 0x02, 0xFF, 0x40, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F,
-    0xF0, 0x03, 0xFF, 0x55, 0x7F, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0xAA, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F,
-    0xF8, 0x01, 0xFF, 0x80, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF0,
-    0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x59,
-    0x40, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xD6, 0xFF, 0xD0, 0x1F, 0xFC, 0x02, 0xFF, 0x80, 0xFF, 0xE0, 0x07, 0xFF, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0xBF, 0xE0, 0x01, 0xFF, 0x83, 0xFF, 0x40, 0x0B,
-    0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xD0, 0x0B, 0xFE, 0x02,
-    0xFF, 0x80, 0x7F, 0xF0, 0x03, 0xFF, 0xAB, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x03, 0xFC, 0x2F, 0xFE, 0x00, 0x0F, 0xF3, 0xFF, 0xFD, 0x00, 0x7F, 0xAF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xF9, 0xBF, 0xF0, 0x0B, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xF8, 0x02, 0xFF, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD,
-    0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF, 0x02, 0xFF,
-    0x40, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x0F,
-    0xFC, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x02, 0xFC, 0x2F,
-    0xFE, 0x00, 0x00, 0xFF, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9B,
-    0xFF, 0x80, 0x0B, 0xFF, 0x40, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x07,
-    0xFF, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x7F, 0xE0, 0x0B, 0xFC, 0x00, 0x2F,
-    0xF4, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
-    0x80, 0x1F, 0xFE, 0x02, 0xFF, 0xC0, 0x0B, 0xFF, 0xFB, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xAF, 0xFF, 0xE0, 0x00, 0x7F, 0xD2, 0xFF, 0xD0, 0x00, 0x2F, 0xF4, 0x05, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE5, 0xBC, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x40, 0x1F, 0xFF, 0xAF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x06, 0x40, 0x00, 0x3F, 0xC2, 0xFF,
-    0xD0, 0x2F, 0xFE, 0x00, 0x0F, 0xF3, 0xFF, 0xFC, 0x2F, 0xFF, 0xD0, 0x07, 0xFA, 0xFF, 0xFF, 0xAF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xF9, 0xFF, 0xFF, 0xDB, 0xFF, 0x00, 0xBF, 0xF4, 0x0F, 0xFF, 0x80, 0xFF,
-    0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0xC0, 0x2F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x0F, 0xFC, 0x07,
-    0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0xFF, 0x80, 0xFF, 0xC0,
-    0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xF8, 0x00, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x1F, 0xF4, 0x00,
-    0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x2F, 0xF4,
-    0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFD, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFD,
-    0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8,
-    0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFB, 0xFF, 0xBF, 0xF8,
-    0x0F, 0xFD, 0x0F, 0xF8, 0x7F, 0xF0, 0xBF, 0xE0, 0x3F, 0xD0, 0xBF, 0xD3, 0xFF, 0x01, 0xFF, 0x01,
-    0xFF, 0x9F, 0xF8, 0x0B, 0xFC, 0x07, 0xFE, 0xBF, 0xD0, 0x3F, 0xF0, 0x1F, 0xFB, 0xFF, 0x00, 0xFF,
-    0x80, 0xBF, 0xDF, 0xFC, 0x07, 0xFD, 0x03, 0xFF, 0x3F, 0xF0, 0x1F, 0xF0, 0x1F, 0xFC, 0xBF, 0xE0,
-    0xBF, 0xC0, 0xFF, 0xD1, 0xFF, 0xC3, 0xFE, 0x0F, 0xFF, 0x03, 0xFF, 0xEF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0x00,
-    0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xCF, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xC7, 0xFE,
-    0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0xBF, 0xD0, 0x3F, 0xE0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x7F, 0xE0,
-    0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4,
-    0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x7F, 0xE0, 0x07, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0xF8, 0x07, 0xFF, 0x03, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xF7, 0xFF, 0xF0, 0xBF, 0xFF, 0x8B, 0xFF, 0x80, 0xBF, 0xF4,
-    0x0B, 0xFD, 0x00, 0x14, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x0B, 0xFD, 0x3F, 0xE0, 0x03, 0xFF, 0x1F,
-    0xF8, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x3F, 0xF4, 0xBF, 0xD0, 0x2F, 0xFD,
-    0x2F, 0xFE, 0xBF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xBF, 0xE0, 0x0F, 0xFF, 0x5F,
-    0xF4, 0x00, 0x54, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x3F,
-    0xF0, 0x1F, 0xF4, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xD0, 0x07, 0xFE, 0x03,
-    0xFF, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xE0,
-    0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0xBF,
-    0xD0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-    0xFF, 0xC0, 0x7F, 0xE0, 0x0B, 0xFF, 0x00, 0x7F, 0xF0, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0x3F, 0xF8,
-    0x07, 0xFE, 0x03, 0xFF, 0xF0, 0x3F, 0xFE, 0x01, 0xFF, 0xEB, 0xFF, 0xFF, 0xBF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF6, 0xFF, 0xFF, 0x7F, 0xC0, 0x0B, 0xFF, 0xF4, 0x3F, 0xFF, 0x8F, 0xF0, 0x00, 0xBF, 0xF4,
-    0x07, 0xFF, 0x43, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x7F, 0xE0, 0x03, 0xFF, 0x00,
-    0x3F, 0xF0, 0x1F, 0xF4, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xD0, 0x07, 0xFE,
-    0x03, 0xFF, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F,
-    0xE0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFC, 0x00,
-    0xBF, 0xD0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x0B, 0xFF, 0x00, 0x7F, 0xF0, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0x3F,
-    0xFC, 0x07, 0xFE, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0x01, 0xFF, 0xEB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xF6, 0xFF, 0xFF, 0x7F, 0xFF, 0x0B, 0xFF, 0xF4, 0x3F, 0xFF, 0x8B, 0xFF, 0x80, 0xBF,
-    0xF4, 0x07, 0xFF, 0x40, 0xBF, 0xD0, 0x01, 0x40, 0x00, 0x14, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x6A, 0xBF, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFE, 0x40,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0xAF, 0xFF, 0x00, 0xBF,
-    0xD0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x03,
-    0xFF, 0x00, 0xBF, 0xE0, 0x6F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0xEF, 0xE4, 0x00, 0x3F, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x3F, 0xFE, 0xBF, 0xFD, 0x0B, 0xFC,
-    0x03, 0xFF, 0x00, 0xBF, 0xE0, 0xFF, 0xC0, 0x7F, 0xE0, 0x07, 0xFE, 0x0F, 0xFC, 0x07, 0xFE, 0x00,
-    0x7F, 0xD1, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xFC, 0x2F, 0xF4, 0x03, 0xFF, 0x42, 0xFF, 0xC3, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFE, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFB, 0xFE, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xAA, 0xFF, 0xE0, 0xFF, 0xC0, 0x1F, 0xFC, 0x7F, 0xE0,
-    0x03, 0xFF, 0x1F, 0xF8, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x7F, 0xE0, 0xFF, 0xD0, 0x7F, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x15, 0x50, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x02,
-    0x95, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x40, 0x6A, 0xAF, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x1F, 0xAB, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0x41, 0xFF, 0xE5, 0xFF, 0xC0, 0x0B, 0xFC, 0x0F,
-    0xFD, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x3F, 0xF0, 0x03, 0xFE, 0x00, 0xFF, 0xD6, 0xFF, 0x40, 0x0F,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0xFF,
-    0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x03, 0xFF, 0xAB, 0xFE, 0x00, 0x2F, 0xF4, 0x0F, 0xF8, 0x0F, 0xF8,
-    0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xE0, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xF0,
-    0x0F, 0xFC, 0x02, 0xFF, 0xEB, 0xFF, 0x80, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xF9, 0x5F, 0xFC, 0x00, 0xBF, 0xE0, 0x0F, 0xFC,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0xBF, 0xF0, 0x2F, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFD, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0xBF, 0xD0, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x03, 0xFF, 0x80,
-    0xFF, 0xC0, 0x0B, 0xFF, 0x01, 0xFF, 0x80, 0x1F, 0xFC, 0x02, 0xFF, 0x40, 0x3F, 0xF4, 0x02, 0xFF,
-    0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA4, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFD, 0x0F, 0xFC, 0x0F, 0xFC, 0x02, 0xFF, 0x0B, 0xFD, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0xBF,
-    0xE1, 0xFF, 0xEB, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xEA,
-    0x40, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x14, 0x07, 0xFF,
-    0xD5, 0xBD, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0B, 0xF8, 0x7F, 0x80, 0x02, 0xFE, 0x2F,
-    0xE0, 0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x06, 0x40, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xF4, 0x3F, 0xF0, 0x3F, 0xF0, 0x0B, 0xFC, 0x2F, 0xF4, 0x03, 0xFF, 0x0F, 0xFC, 0x02, 0xFF, 0x87,
-    0xFF, 0xAF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xA9, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x50, 0x1F, 0xFF, 0x56,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x01, 0xAF, 0xFF, 0xAA, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
-    0xAB, 0xFF, 0xAA, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x64, 0x00, 0x03, 0xFF,
-    0x2F, 0xFE, 0x00, 0x0F, 0xFB, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF9, 0xBF,
-    0xF0, 0x0F, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x0B,
-    0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFF, 0x00,
-    0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF8,
-    0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xE0, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0x90, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x00, 0x2F, 0xFD, 0x5B, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xE5, 0xBC, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xF5, 0x55, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x40, 0x1F, 0xFF, 0xAF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x05, 0xA5, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE,
-    0x06, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0x08, 0x00, 0x0F, 0xFC, 0x3F, 0x96, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xF4, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x7F, 0xC0,
-    0x03, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x02, 0xFF, 0x40, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x10, 0x04, 0x00, 0x3F, 0x1F, 0xC0, 0x1F, 0xDB, 0xF0, 0x0B, 0xF3, 0xFC, 0x01,
-    0xFC, 0xFE, 0x00, 0x14, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xAF,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xFB, 0xFE, 0x40, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0F, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFC, 0x02, 0xFF, 0xEA, 0xFF, 0xF0, 0x02,
-    0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x7F, 0xD0,
-    0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF3, 0xFF, 0xF8, 0x00, 0xFF,
-    0xE0, 0x7F, 0xF8, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xEA, 0xBF, 0xFE, 0xA9, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F,
-    0xFD, 0x1F, 0xF8, 0x01, 0xFF, 0x40, 0x2F, 0xF8, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD2, 0xFF,
-    0x40, 0x1F, 0xF8, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x7F, 0xF4, 0x7F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD1, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xAF, 0xFF, 0xAA, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x00, 0xAB, 0xFF, 0xAA, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x64, 0x00, 0x03, 0xFF, 0x2F, 0xFE, 0x00, 0x0F, 0xFB, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xF9, 0xBF, 0xF0, 0x0F, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x01, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x0B,
-    0xFD, 0x03, 0xFF, 0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFE, 0x03,
-    0xFF, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xE0, 0x03, 0xFF, 0x01, 0xFF, 0x80,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x1F, 0xF8, 0x0B, 0xFF, 0x00, 0x07, 0xFD, 0x07,
-    0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x3F, 0xF7, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x3F, 0xF4,
-    0x00, 0x0B, 0xFD, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xA9, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF,
-    0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF,
-    0x80, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x0B,
-    0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xE0, 0x0F, 0xFE, 0x01,
-    0xFF, 0xC0, 0xFF, 0xF8, 0x07, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0xFF, 0x00, 0x2F, 0xFF,
-    0xE3, 0xFC, 0x00, 0x2F, 0xFD, 0x0F, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x00, 0x2A, 0x40, 0x00, 0x02, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFD, 0x00,
-    0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0xF4, 0x00, 0x00, 0xFF,
-    0x80, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x00,
-    0x2F, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xCF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xE0, 0x03, 0xFF, 0x01,
-    0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0,
-    0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFE,
-    0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x07, 0xFF, 0x01, 0xFF,
-    0x80, 0x3F, 0xF8, 0x07, 0xFF, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF7,
-    0xFC, 0x00, 0xBF, 0xFF, 0x8F, 0xF0, 0x00, 0xBF, 0xF4, 0x3F, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x07,
-    0xFE, 0x00, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4, 0x3F, 0xF4, 0x00, 0xBF,
-    0xD0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0xC0,
-    0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0xBF, 0xFC, 0x00,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x03, 0xFF, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x0B, 0xFF, 0xFC, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFD, 0x3F, 0xEF, 0xF4, 0x7F, 0xE0, 0x00, 0x2F, 0xF6, 0xFD, 0x7F, 0xD3, 0xFF, 0x00,
-    0x00, 0x7F, 0xEF, 0xF1, 0xFF, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x1F, 0xF8, 0x00, 0xFF, 0xC7, 0xFD, 0x00, 0xBF, 0xD0, 0x03, 0xFE, 0x2F, 0xF0, 0x02, 0xFF, 0x40,
-    0x2F, 0xF4, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0xC2, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x0B,
-    0xFC, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x2F, 0xF0, 0x0B, 0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x3F,
-    0xFC, 0x07, 0xFD, 0x02, 0xFF, 0x03, 0xFF, 0xF0, 0x3F, 0xF0, 0x0B, 0xFC, 0x1F, 0xFF, 0xC1, 0xFF,
-    0x40, 0x1F, 0xF4, 0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xDB, 0xFB, 0xFD, 0x7F, 0xC0, 0x00, 0xFF,
-    0xBF, 0xCF, 0xFB, 0xFE, 0x00, 0x03, 0xFF, 0xFD, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xE0, 0xBF,
-    0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xAF, 0xFF, 0xAA, 0x80, 0x7F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xFA, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xFF, 0x40, 0xBF, 0xE5, 0xBF, 0xFC, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x1F, 0xF8, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0, 0x02, 0xFF, 0xC3, 0xFF, 0x01,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF2, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xFF, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0xFD, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xFC, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0x00, 0x1F, 0xF9, 0x5F, 0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x3F, 0xE0, 0x02, 0xFF,
-    0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x0B, 0xFC, 0x02, 0xFF, 0x4B, 0xFC, 0x00, 0x2F, 0xFC, 0x2F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFD, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0x80, 0x1F, 0x40, 0x03, 0xFF, 0x00, 0xFF, 0xF0, 0x00,
-    0x04, 0x00, 0x1F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x5F, 0xFE, 0x55, 0x55, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFA, 0xBF, 0xFE, 0xAA, 0xA8, 0x00, 0x00,
-    0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF4, 0x01, 0xB4, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x0B, 0xFD, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x01,
-    0xFF, 0x80, 0x7F, 0xFE, 0x6F, 0x00, 0x2F, 0xF4, 0x0F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xE5, 0xFF,
-    0xE5, 0x54, 0x00, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x07, 0xFF, 0x00, 0x14, 0x02, 0xFF, 0x40, 0x3F, 0xFE, 0xBF, 0x80, 0x3F, 0xF0, 0x02,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x4F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x03, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x3F, 0xE7, 0xFC, 0x00, 0x1F, 0xF8,
-    0xFF, 0x4F, 0xF0, 0x00, 0xFF, 0xC3, 0xFC, 0x3F, 0xD0, 0x07, 0xFE, 0x1F, 0xF0, 0xFF, 0x40, 0x3F,
-    0xF0, 0xBF, 0xC3, 0xFE, 0x02, 0xFF, 0x83, 0xFE, 0x0F, 0xF8, 0x0F, 0xFC, 0x0F, 0xF4, 0x2F, 0xF0,
-    0xBF, 0xE0, 0x7F, 0xC0, 0xBF, 0xC3, 0xFF, 0x02, 0xFF, 0x01, 0xFF, 0x2F, 0xF4, 0x0B, 0xFC, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF6, 0xFD,
-    0x00, 0x00, 0x0B, 0xFC, 0xBF, 0x80, 0x00, 0x07, 0xFD, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0x47, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xEB, 0xFB, 0xFE, 0x00, 0x3F, 0xF3, 0xFD, 0xBF, 0x80, 0x1F, 0xF4, 0xFF, 0x2F, 0xF0,
-    0x0F, 0xFC, 0x7F, 0xC7, 0xFC, 0x0B, 0xFD, 0x2F, 0xE0, 0xFF, 0x03, 0xFF, 0x0F, 0xF8, 0x3F, 0xD2,
-    0xFF, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF7, 0xFD,
-    0x00, 0x07, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0x80, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x2F, 0xE0, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x07, 0xFC, 0x00, 0x3F, 0xF5, 0x56, 0xFF, 0x81, 0xFF, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xEA, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF9, 0xFF,
-    0x3F, 0xE0, 0x1F, 0xF4, 0x0F, 0xFC, 0xBF, 0xCB, 0xF8, 0x0B, 0xFD, 0x07, 0xFE, 0x2F, 0xE2, 0xFF,
-    0x03, 0xFF, 0x03, 0xFF, 0x0F, 0xF8, 0xBF, 0xC0, 0xFF, 0xC1, 0xFF, 0x83, 0xFD, 0x1F, 0xF0, 0x3F,
-    0xE0, 0xFF, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF4, 0xBF, 0xE0, 0xBF, 0xC0, 0xFF, 0x4B, 0xFC, 0x3F,
-    0xF0, 0x3F, 0xE0, 0x3F, 0xD3, 0xFF, 0x2F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0xFF, 0xCF, 0xFC, 0x03,
-    0xFD, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF,
-    0x00, 0x03, 0xFE, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF3, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xFF,
-    0x4F, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xAA,
-    0xFF, 0xBF, 0xFF, 0xF0, 0x0F, 0xF4, 0x0B, 0xFC, 0xFF, 0x7F, 0xC0, 0x3F, 0xC0, 0x7F, 0xE7, 0xFC,
-    0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x2F, 0xE3, 0xFD, 0x0B, 0xF8, 0x1F, 0xF4, 0xFF, 0x4F, 0xF8, 0x3F,
-    0xE0, 0xFF, 0xC3, 0xFD, 0x2F, 0xE0, 0xFF, 0x4B, 0xFD, 0x1F, 0xF0, 0xBF, 0xC7, 0xFC, 0x3F, 0xF0,
-    0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xFF, 0xD5, 0x57, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFB, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x7F, 0xE1, 0xFF, 0x40,
-    0x00, 0xFF, 0xC2, 0xFF, 0x47, 0xFD, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF4, 0x00, 0x3F, 0xF0,
-    0x3F, 0xF0, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0x80, 0x0F, 0xFC, 0x07, 0xFE, 0x03,
-    0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x0F, 0xF8, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F,
-    0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xF8, 0x07,
-    0xFE, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xFB,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x3F, 0xDB, 0xF4, 0x00, 0x3F, 0xD3,
-    0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x3F, 0xC3, 0xF8, 0x00, 0xFF, 0x47, 0xFC, 0x3F, 0xC0, 0x1F, 0xF0,
-    0xBF, 0x83, 0xFC, 0x03, 0xFD, 0x0F, 0xF4, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x2F, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x55, 0x6F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC,
-    0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC7, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x55, 0x57,
-    0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFA,
-    0xAF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x8B, 0xFD, 0x3F, 0xE0, 0x00, 0x7F,
-    0xE0, 0x3F, 0xF0, 0xFF, 0xC3, 0xFF, 0x00, 0x0B, 0xFD, 0x07, 0xFD, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x00, 0x0F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8, 0x2F, 0xF0,
-    0x00, 0xFF, 0xC3, 0xFF, 0x02, 0xFF, 0x42, 0xFF, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x3F, 0xF0, 0x2F,
-    0xF0, 0x02, 0xFF, 0x4B, 0xFD, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x2F, 0xF4, 0x03, 0xFF, 0x2F, 0xF4, 0x0B, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x0B, 0xF4, 0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0xFE, 0x1F, 0xF0, 0x00, 0x0F, 0xF8,
-    0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFA, 0xAF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xF4, 0x0F, 0xF1, 0xFE, 0x3F, 0xC0, 0x03, 0xFC, 0x0B, 0xF8, 0xBF, 0x8F, 0xF0,
-    0x01, 0xFF, 0x03, 0xFC, 0x3F, 0xD3, 0xFC, 0x00, 0xBF, 0x82, 0xFE, 0x0F, 0xF0, 0xFF, 0x00, 0x3F,
-    0xE0, 0xFF, 0x07, 0xFC, 0x3F, 0xD0, 0x0F, 0xF4, 0xBF, 0x82, 0xFE, 0x0B, 0xF4, 0x07, 0xFC, 0x3F,
-    0xD0, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1B, 0xD0, 0x00, 0x01, 0xFC, 0x0B, 0xFE,
-    0x00, 0x00, 0x0B, 0xE2, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x40, 0x2F, 0xFD, 0x00, 0x02, 0x40, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x55, 0x6F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00,
-    0x6B, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F,
-    0xFF, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x03, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0xFC, 0x1F, 0xFD,
-    0x00, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x90, 0x7F, 0xF8, 0x00, 0x04,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x06, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x01, 0x6F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xFA, 0x50, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xFA, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xFD, 0x00, 0xBF,
-    0x80, 0x1F, 0xF4, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0xFF, 0xC0, 0x1F, 0xF4, 0x02, 0xFF,
-    0x03, 0xFF, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0xD0,
-    0x0F, 0xFC, 0x01, 0xFF, 0x42, 0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x0F, 0xFC, 0x01, 0xFF, 0x40,
-    0x3F, 0xF0, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFD, 0x07,
-    0xFD, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x1F,
-    0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0xF9, 0xBF, 0xD6, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0x01, 0xFF, 0x42, 0xFF, 0x40, 0xFF, 0xC0, 0xBF, 0xC0, 0xBF, 0xD0, 0x7F, 0xE0, 0x3F,
-    0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x0F, 0xF8, 0x0B, 0xFD, 0x0B, 0xFC, 0x03, 0xFE, 0x02, 0xFF, 0x43,
-    0xFF, 0x01, 0xFF, 0x40, 0xBF, 0xD0, 0xFF, 0xC0, 0xBF, 0xC0, 0x3F, 0xF0, 0x7F, 0xE0, 0x3F, 0xF0,
-    0x0F, 0xFC, 0x2F, 0xF4, 0x0F, 0xF8, 0x03, 0xFF, 0x0F, 0xFC, 0x07, 0xFD, 0x01, 0xFF, 0x83, 0xFF,
-    0x01, 0xFF, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0xBF, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x2F,
-    0xF4, 0x0F, 0xFC, 0x0F, 0xF8, 0x2F, 0xFC, 0x03, 0xFF, 0xEB, 0xFF, 0xBF, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xE0, 0x0B, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x3F,
-    0xF0, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF8,
-    0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0x2F, 0xFF, 0xEF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0x97, 0xFF, 0x40,
-    0xFF, 0xD0, 0x1F, 0xFC, 0x1F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFE, 0xAA, 0xAF, 0xF8, 0xBF,
-    0xD0, 0x02, 0xFF, 0x47, 0xFD, 0x00, 0x3F, 0xF0, 0x7F, 0xF0, 0x0F, 0xFE, 0x03, 0xFF, 0xEB, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x01, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xC0, 0x00, 0xBF, 0xF4, 0x6F, 0xF0, 0x00,
-    0x3F, 0xF0, 0x07, 0xFC, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x0B,
-    0xFD, 0x00, 0x0F, 0xF4, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0xFF,
-    0xC0, 0x00, 0x3F, 0xE0, 0xBF, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x1F, 0xF4,
-    0x00, 0x00, 0xBF, 0x8F, 0xFC, 0x00, 0x00, 0x2F, 0xE7, 0xFD, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0x00,
-    0x00, 0x01, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xFF, 0x80, 0x00, 0xBF, 0xD3, 0xFE, 0x00, 0x0F, 0xFF, 0x4F,
-    0xF8, 0x00, 0xBF, 0xFD, 0x3F, 0xF0, 0x03, 0xFF, 0xE4, 0xFF, 0xC0, 0x2F, 0xF8, 0x02, 0xFF, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFD, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x7F, 0xC2, 0xFF, 0x40,
-    0x00, 0xFF, 0x0F, 0xFC, 0x00, 0x03, 0xFD, 0xBF, 0xC0, 0x00, 0x0F, 0xF7, 0xFE, 0x00, 0x00, 0x3F,
-    0xEF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0xAA, 0x00,
-    0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00,
-    0x00, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xBF, 0xF0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xC0, 0x00, 0xBF, 0xF4,
-    0x6F, 0xF0, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x0B, 0xFD, 0x00, 0x0F, 0xF4, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0x40, 0x00,
-    0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0xBF, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x03,
-    0xFE, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0x8F, 0xFC, 0x00, 0x00, 0x2F, 0xE7, 0xFD, 0x00, 0x00, 0x0B,
-    0xFA, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x2A, 0x91, 0xAA, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0xFF, 0x4B,
-    0xF4, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3F, 0xE0, 0x00, 0x2F, 0xF4, 0xFF,
-    0x80, 0x03, 0xFF, 0xD3, 0xFE, 0x00, 0x2F, 0xFF, 0x4F, 0xFC, 0x00, 0xFF, 0xF9, 0x3F, 0xF0, 0x0B,
-    0xFE, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0x07, 0xFC, 0x0F, 0xFC, 0x00,
-    0x1F, 0xF0, 0xBF, 0xD0, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x6F, 0xF0, 0x00, 0x03, 0xFD,
-    0xFF, 0x80, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFC, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0xFF,
-    0xD0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0xBF, 0xC0, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x07, 0xFD, 0x00, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xF4, 0x0B, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xC0, 0x3F, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0x82, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x02, 0xFE, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0xFF, 0xD0, 0x0B, 0xFC, 0xBF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xF3, 0xFE,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x80,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xEB, 0xFF, 0x40, 0x7F, 0xD0,
-    0x0B, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x3F, 0xE0, 0x2F, 0xF8, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x0F,
-    0xFC, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xF1, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x1F, 0xF8,
-    0x01, 0xFF, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xF7, 0xFD, 0x00, 0x07, 0xFE,
-    0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x7F, 0xF0, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xBF, 0xBF, 0xFC, 0x02, 0xFF, 0xE0, 0x64,
-    0x3F, 0xF8, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x40,
-    0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF3, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE3, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0x2F,
-    0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xF4, 0x14, 0x0F, 0xFF, 0x00, 0xFF, 0xF7, 0xFA,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xE7, 0xF3, 0xFF, 0x0B, 0xFF, 0x00, 0x0B,
-    0xFD, 0x3F, 0xF4, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0x01, 0xFF, 0x9F,
-    0xF4, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0x3F, 0xF5, 0xFF, 0x40, 0x00, 0xFF, 0xC7, 0xFE, 0x00,
-    0x0B, 0xFE, 0x0F, 0xFD, 0xBD, 0xBF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2E, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0xF4, 0x1D, 0x00, 0x34, 0x7F, 0xFC,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE2,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEB, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0xF4, 0x00, 0x0A, 0xA4, 0x00, 0x0F, 0xFD, 0xFF, 0xC0,
-    0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0xCF, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0xBF, 0xE0, 0x01,
-    0xFF, 0x80, 0x03, 0xFF, 0xC1, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x2F, 0xFD, 0x03, 0xFF, 0xD0, 0xBF,
-    0xFD, 0x07, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x1F,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x83, 0xD0, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x01, 0x64, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFA, 0xD0, 0x0E, 0xBF, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x7F, 0xE0, 0x02, 0xAA, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0xC7,
-    0xFD, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x2F, 0xF4, 0x01, 0xFF, 0x40, 0x1F, 0xF8, 0x7F, 0xE0, 0x0B,
-    0xFC, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF8, 0x00, 0x0B,
-    0xFF, 0x80, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x7E, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0xF0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF0, 0xBF, 0xE0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x83, 0xFF, 0x40, 0x07, 0xFE, 0x00,
-    0x0B, 0xFD, 0x0F, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x01,
-    0xFF, 0x80, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFC, 0x00, 0xBF, 0xF0, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x03, 0xFF, 0xC0, 0x0B, 0xFD,
-    0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0x80,
-    0x0F, 0xFC, 0x0B, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xFF, 0xC0, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC2, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x4F, 0xFB, 0xFD, 0x1F, 0xF8, 0x00, 0x0B,
-    0xFD, 0xBF, 0x5F, 0xF4, 0xFF, 0xC0, 0x00, 0x1F, 0xFB, 0xFC, 0x7F, 0xEB, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x7C, 0x2E, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x80, 0x20, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x01,
-    0xFF, 0x80, 0x0F, 0xFC, 0x7F, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x2F, 0xF4, 0x02,
-    0xFF, 0x4B, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0x42, 0xFF, 0x00, 0xBF, 0xF0, 0x0F, 0xFC, 0x0B, 0xFC, 0x03, 0xFF,
-    0xC0, 0x7F, 0xD0, 0x2F, 0xF0, 0x3F, 0xFF, 0x03, 0xFF, 0x00, 0xBF, 0xC1, 0xFF, 0xFC, 0x1F, 0xF4,
-    0x01, 0xFF, 0x4F, 0xFF, 0xF0, 0xFF, 0xC0, 0x03, 0xFD, 0xBF, 0xBF, 0xD7, 0xFC, 0x00, 0x0F, 0xFB,
-    0xFC, 0xFF, 0xBF, 0xE0, 0x00, 0x3F, 0xFF, 0xD2, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x0B, 0xFF,
-    0xF4, 0x00, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x6F, 0x40, 0x1F, 0xFF, 0x00, 0x00, 0x40, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x04, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xE6, 0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x01,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFC,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x04, 0x00, 0xBC, 0x00, 0x01,
-    0xF4, 0x0F, 0x80, 0x00, 0x2F, 0xE3, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x0B, 0xC1, 0xFD, 0x18, 0x00,
-    0xF8, 0x01, 0x83, 0xF4, 0x3F, 0x00, 0x00, 0x2F, 0xFB, 0xD0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBC, 0xBF, 0x80, 0x00, 0x1F, 0x80,
-    0xF8, 0x00, 0x03, 0xF0, 0x01, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xAA, 0xAB, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0xBF, 0xF4, 0x16, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFE, 0x0F, 0xD3, 0xE9, 0x00, 0xBD,
-    0x05, 0x03, 0xFD, 0xBF, 0xDB, 0xE4, 0xBC, 0x03, 0xF4, 0x0B, 0xC0, 0x00, 0x01, 0x40, 0x3F, 0xC1,
-    0xFF, 0x41, 0xFD, 0x02, 0xF0, 0xBF, 0x43, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xFF, 0xF9,
-    0x00, 0x3F, 0xFF, 0xFE, 0x87, 0xFF, 0xFF, 0xFD, 0xBF, 0x02, 0xFF, 0xCA, 0x90, 0x01, 0xA8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFA, 0xBC, 0x00, 0x00,
-    0x00, 0x0B, 0xEB, 0xE0, 0x00, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x00, 0x00, 0x40,
-    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0xB4, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x41, 0xED, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0xF0, 0x00, 0x18, 0x00, 0x90, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x5B, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x02, 0x90, 0x00, 0x01, 0xBC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x06, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x80, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x2F,
-    0xFF, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x0B, 0xFF, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0xBF, 0xC0, 0x00, 0xFF, 0x80, 0x3F, 0xF3, 0xFE,
-    0x00, 0x03, 0xFD, 0x02, 0xFF, 0x4F, 0xF4, 0x00, 0x1F, 0xF4, 0x1F, 0xF8, 0x7F, 0xC0, 0x00, 0x7F,
-    0xC0, 0xFF, 0xC2, 0xFF, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x7F, 0xE0,
-    0x3F, 0xE0, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0x3F, 0xF0, 0x07, 0xFC, 0x00,
-    0x0B, 0xFE, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xF9, 0x54, 0x1F, 0xFF, 0xD0, 0x00, 0x7F,
-    0xFF, 0xF0, 0xBF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x0F,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x03, 0xFD,
-    0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xAF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0x00, 0x2F, 0xF0, 0x07, 0xFE, 0x00,
-    0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xBF,
-    0xD0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0xFF, 0x80,
-    0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0xE0, 0x07, 0xFF, 0x00, 0x3F,
-    0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF0, 0x2F, 0xFE, 0x00, 0x3F, 0xFE, 0xFF, 0xFF, 0xA9, 0x3F, 0xFF,
-    0xFB, 0xFF, 0xFC, 0x1F, 0xFF, 0xE3, 0xFF, 0xF8, 0x07, 0xFF, 0x43, 0xFF, 0xF0, 0x00, 0x50, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x6F, 0xF9, 0x50, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xFA, 0x90, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x54, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFA, 0xBF, 0xFD, 0x03,
-    0xFF, 0x00, 0xFF, 0xE0, 0x7F, 0xE0, 0x07, 0xFF, 0x0B, 0xFD, 0x00, 0x7F, 0xF0, 0xFF, 0xD0, 0x07,
-    0xFE, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x50, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x1A, 0xFF, 0xEA,
-    0xA0, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xAF, 0xFE, 0xAA, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0x95, 0xFF, 0xF0, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0xC3, 0xFF, 0x81, 0xFF, 0xD0, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x5F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x07,
-    0xFE, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x52, 0xFF, 0x40, 0x3F,
-    0xF0, 0xFC, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xAF, 0xFF, 0xF4, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFE,
-    0xA5, 0xBF, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0x40, 0x03, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x02, 0xFC, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x9F, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xD0, 0x02, 0xFF, 0x40,
-    0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x40, 0x1F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x01, 0x1F, 0xFC, 0x00, 0xFF, 0xC3, 0xDB,
-    0xFD, 0x00, 0x3F, 0xF2, 0xFF, 0xFF, 0x00, 0x1F, 0xFD, 0x3F, 0xFF, 0x80, 0x0B, 0xFF, 0xEF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xAF, 0xFF, 0xE0, 0x00, 0x7F, 0xD2, 0xFF, 0xFC,
-    0x00, 0x2F, 0xF4, 0x05, 0x3F, 0x80, 0x0B, 0xFC, 0x00, 0x07, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x40,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFE, 0xAA,
-    0x90, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x17, 0xFF, 0x55, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1A, 0xFF, 0xEA, 0x80,
-    0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x85, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0xBF, 0xF8, 0x0B, 0xFD,
-    0x00, 0x2F, 0xFC, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x0F, 0xF8, 0x00,
-    0x0B, 0xFD, 0x1F, 0xF8, 0x00, 0x0B, 0xFD, 0x2F, 0xF4, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x80, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x54, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0xBF, 0xFD, 0x03, 0xFE, 0x03, 0xFF, 0x81, 0xFF,
-    0x40, 0x7F, 0xF0, 0xBF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0xC7,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x60, 0x1B, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x01,
-    0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x03, 0xFE, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x1F, 0xF4, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0xFF, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFB, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xEB,
-    0xFD, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x3F, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0xFF, 0x87, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x47, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x2F, 0xF0, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0xBF, 0xC0, 0x7F, 0xE0, 0x00,
-    0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0x0F, 0xF8, 0x02, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0xF4, 0x00, 0xFF, 0xE0, 0x02, 0xFF, 0x00,
-    0x0F, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x3F, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xF8, 0x00, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x0F, 0xF8, 0x07, 0xFF, 0xF8, 0x02, 0x9F, 0xFF, 0x01,
-    0xFF, 0x40, 0xFF, 0xF9, 0x40, 0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x3F, 0xF0, 0xBF, 0xD0, 0x00, 0x00, 0x02,
-    0xFF, 0xAB, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0xFF, 0xEB, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFD, 0x0F, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0x01, 0xAF, 0xFF, 0x02, 0xFF, 0x00, 0xFF,
-    0xFA, 0xD0, 0x3F, 0xFF, 0xD0, 0x3F, 0xF0, 0x07, 0xFF, 0xFC, 0x03, 0xFF, 0xF4, 0x03, 0xFE, 0x00,
-    0x2F, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x79, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x05, 0x56, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x2A, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x64, 0x00, 0x0B, 0xFF, 0x80,
-    0x7F, 0xEA, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-    0xFD, 0x02, 0xE4, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x55, 0xBF,
-    0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x7E, 0xAA, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x6F, 0xC0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0x40,
-    0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF,
-    0x80, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x7F, 0xF0, 0x00, 0x00,
-    0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x80, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF3, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x0F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0xFF, 0xD0, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0x03,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x80, 0x0F,
-    0xFC, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0x81, 0xFF, 0xC0, 0x00, 0xBF,
-    0xD0, 0xFF, 0xD0, 0x00, 0x2F, 0xF0, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xEF, 0xFC, 0x00, 0x00, 0x3F, 0xF3,
-    0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x03, 0xFE, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x42,
-    0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x3F, 0xFF, 0xF0, 0x3F, 0xF0, 0x0B, 0xFF, 0xF8, 0x0F, 0xFC, 0x00,
-    0xFF, 0xFD, 0x07, 0xFE, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF4, 0x64, 0xFF, 0xE0, 0x00,
-    0x3F, 0xF0, 0xFA, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xE1, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC3,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xCF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x2F,
-    0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0x40, 0x00, 0x0F,
-    0xFC, 0x3E, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x7C, 0xFF, 0xD0, 0x00, 0x2F, 0xF4, 0x14, 0xBF, 0xF0,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x0F, 0xFC, 0xA2, 0xFF, 0x80, 0x03, 0xFE, 0x3E,
-    0xFF, 0xC0, 0x01, 0xFF, 0x5F, 0xFF, 0xC0, 0x00, 0xBF, 0xDB, 0xFF, 0xC0, 0x00, 0x3F, 0xF3, 0xFF,
-    0xD0, 0x00, 0x0F, 0xFC, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xEF, 0xF8, 0x00, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0,
-    0x00, 0x07, 0xFE, 0x7F, 0xFC, 0x00, 0x02, 0xFF, 0x6F, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xBF, 0xF0,
-    0x00, 0x3F, 0xF3, 0xCB, 0xFE, 0x00, 0x0F, 0xF8, 0xA0, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xF0, 0x02, 0xBF, 0xFE,
-    0x41, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x43, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x0F, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0x2F, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xAF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x1F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x2F,
-    0xF4, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x0A, 0xFF, 0xFA, 0xA0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x6B, 0xFF, 0xAA, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x0F, 0xFE,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0x0B, 0xFF, 0x00, 0x07, 0xFE, 0x07, 0xFF, 0x00,
-    0x02, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0xBF, 0xC3, 0xFF, 0x40, 0x00, 0x3F, 0xF3, 0xFF, 0x80, 0x00,
-    0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xBF, 0xF0, 0x00, 0x00,
-    0xFF, 0xCF, 0xFD, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xF4, 0x00, 0x07,
-    0xFD, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFE,
-    0x0B, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0x40, 0x15, 0x6F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0x82, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0xBF, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0x43, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00,
-    0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0x40,
-    0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x87, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFC, 0x2F, 0xFF, 0xFE, 0x02, 0xFF, 0xC0, 0x6A, 0xBF, 0xF4, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xD1,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xEF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00,
-    0x00, 0x2F, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xE0, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xD5, 0x55, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xAA, 0xAB,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x0B, 0xFD,
-    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x2F, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFE, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x80,
-    0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x00,
-    0xBF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFA, 0xAA, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x03, 0xFE, 0x00, 0x3F,
-    0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0xFE, 0x3F, 0xF0, 0x01, 0xFF,
-    0xFF, 0x4F, 0xFC, 0x00, 0xBF, 0xFF, 0xC7, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xA9,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x1F, 0xF9, 0x55, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x6F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xEA, 0xAA, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0x80, 0x0B, 0xFE, 0xAA, 0x40,
-    0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x01,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xEA, 0xAB, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF,
-    0xC5, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xFC, 0x0B, 0xFD, 0x00, 0x07, 0xFE,
-    0x00, 0x2F, 0xFC, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x1F, 0xF8, 0x00, 0x0F, 0xF8,
-    0x00, 0x0B, 0xFE, 0x2F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xEA, 0xAF, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF5, 0x50, 0x00,
-    0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0xEA, 0xFF, 0xE0, 0x3F, 0xE0, 0x03, 0xFF, 0x02,
-    0xFF, 0xC1, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x02, 0xFF, 0x40, 0x2F, 0xF0, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x3F,
-    0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x40, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x54, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF0, 0x1F, 0xFC, 0x03, 0xFF, 0xFF, 0x0F,
-    0xFD, 0x03, 0xFF, 0xFF, 0xE3, 0xFF, 0x01, 0xFF, 0x9F, 0xFD, 0xFF, 0x80, 0xFF, 0xC2, 0xFF, 0xBF,
-    0xD0, 0x3F, 0xD0, 0xBF, 0xFF, 0xF4, 0x1F, 0xF0, 0x2F, 0xFF, 0xFC, 0x0B, 0xFC, 0x0F, 0xFF, 0xFF,
-    0x02, 0xFF, 0x03, 0xFE, 0xFF, 0xC0, 0xBF, 0xC2, 0xFF, 0x3F, 0xF0, 0x2F, 0xF0, 0xFF, 0xCF, 0xFD,
-    0x0B, 0xFC, 0xBF, 0xD2, 0xFF, 0xC1, 0xFF, 0xBF, 0xE0, 0x3F, 0xF4, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xEF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xA0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x54, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x59, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xD5, 0x40, 0x00, 0xFF, 0xE0, 0x1A, 0x90, 0x2F, 0xFC, 0x1F, 0xFF, 0x83, 0xFF, 0x47,
-    0xFF, 0xFD, 0x3F, 0xF0, 0xFF, 0xFF, 0xF7, 0xFE, 0x0F, 0xF0, 0xFF, 0x7F, 0xE1, 0xFE, 0x0F, 0xFB,
-    0xFD, 0x2F, 0xE1, 0xFF, 0xBF, 0xD2, 0xFD, 0x2F, 0xE7, 0xFE, 0x1F, 0xE3, 0xFC, 0x3F, 0xF0, 0xFF,
-    0xFF, 0x83, 0xFF, 0x9F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFD, 0x40, 0xBF, 0xFF, 0xFF, 0xFD, 0x01,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x54, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x6F, 0x40, 0x1F, 0xFE, 0x00,
-    0x00, 0x40, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x1B, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xE6, 0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x01, 0x80, 0x3F, 0xFF, 0xBF, 0x80,
-    0x1F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x15, 0x5F, 0xFE, 0x55, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x06, 0x50, 0x00, 0x0B, 0xF0, 0xBF, 0xF8,
-    0x07, 0xFF, 0xC0, 0x00, 0xFF, 0x2F, 0xFF, 0xD2, 0xFF, 0xFE, 0x00, 0x0F, 0xFB, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0xBF, 0xFF, 0xEB, 0xFF, 0x40, 0x2F, 0xFE, 0x03, 0xFF, 0xF0, 0x2F,
-    0xF4, 0x02, 0xFF, 0xC0, 0x2F, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xF4, 0x03, 0xFF, 0x80, 0x2F, 0xF4,
-    0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x0B,
-    0xFD, 0x00, 0x7F, 0xE0, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x7F, 0xD0, 0x0F, 0xFC,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00,
-    0xFF, 0x80, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xFD, 0x3F, 0xF0, 0x02, 0xFF,
-    0x40, 0x0F, 0xFF, 0xC3, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xFC, 0x7F, 0xE0, 0x03, 0xFF, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x02, 0xFF,
-    0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF,
-    0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0x42, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x0B, 0xFE, 0x3F, 0xE0, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x2F, 0xF8, 0x3F, 0xF0, 0x03, 0xFF, 0x02,
-    0xFF, 0x00, 0xBF, 0xD0, 0x2F, 0xF0, 0x0F, 0xFC, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x1F, 0xF0, 0x3F,
-    0xF0, 0x00, 0xFF, 0x0B, 0xFD, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x00, 0xFF, 0x6F, 0xF0, 0x00, 0x0F,
-    0xF7, 0xFE, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x42, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x00, 0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xD0,
-    0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x2F, 0xF8, 0x00, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xCF,
-    0xFC, 0x00, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0xAA, 0xBF, 0xFA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xAA, 0xFF, 0xEA, 0x90, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFE, 0x03, 0xFE, 0x00, 0x0F, 0xFC,
-    0x03, 0xFE, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0xBF, 0xD0, 0x02,
-    0xFF, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0x0B, 0xFD, 0x00, 0x00, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xFF, 0x7F,
-    0xE0, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xAA,
-    0xFF, 0xFA, 0xA0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x00, 0x1F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x7F,
-    0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x82, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x1F, 0xF8, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xE3, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x1F,
-    0xFF, 0xF4, 0x07, 0xFF, 0x40, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x3F, 0xFC, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0x8B,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xE3, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFC, 0x15, 0x5F, 0xFE, 0x55, 0x43, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F,
-    0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF,
-    0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0,
-    0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00,
-    0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x54, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x7F, 0xD3, 0xFF, 0xFF, 0xFF, 0x2F, 0xF5, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC,
-    0x2A, 0xFF, 0xEA, 0x93, 0xFF, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xD0,
-    0x03, 0xFF, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00,
-    0x2F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0xBF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xAF, 0xFF, 0x00, 0x7F, 0xFF, 0x87, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0xBF, 0xE0, 0x00,
-    0x04, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xA8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x41, 0xFF,
-    0x80, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x0F, 0xFC,
-    0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x41, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0xBF, 0xD0,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x80,
-    0x1F, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x9B, 0xFD, 0x00, 0x00, 0x10, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFC,
-    0x1F, 0xF8, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x0F, 0xF8, 0x3F, 0xF0, 0x01, 0xFF, 0x43, 0xFF, 0x00,
-    0x3F, 0xF4, 0x3F, 0xE0, 0x03, 0xFF, 0x07, 0xFE, 0x00, 0xBF, 0xF0, 0x7F, 0xF0, 0x1F, 0xFE, 0x03,
-    0xFF, 0x9B, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0xFF, 0xC0, 0x0B, 0xFF, 0x8F,
-    0xFC, 0x00, 0x05, 0x41, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x0F, 0xFC, 0x00, 0x07,
-    0xFD, 0x1F, 0xFC, 0x00, 0x0B, 0xFD, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x2F, 0xF8, 0x7F, 0xF0, 0x10, 0x2F, 0xF4, 0x7F,
-    0xE0, 0xF4, 0x3F, 0xF0, 0xBF, 0xD0, 0xF0, 0x3F, 0xF0, 0xFF, 0xC1, 0xF0, 0x7F, 0xE0, 0xFF, 0xD2,
-    0xF0, 0xBF, 0xD0, 0xFF, 0xF3, 0xE7, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xE6, 0xFF, 0x40, 0x00, 0x1F, 0x83, 0xFF,
-    0x00, 0x00, 0x0F, 0x43, 0xFF, 0x00, 0x00, 0x1F, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0x07, 0xFE, 0x00,
-    0x00, 0x2E, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x1F, 0xF8, 0x00,
-    0xBF, 0xC2, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0x05, 0x1F, 0xF8, 0x3F,
-    0xE2, 0xE3, 0xFF, 0x47, 0xFE, 0x3D, 0x7F, 0xF0, 0x7F, 0xF3, 0xDF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xBF, 0xD0, 0x07, 0xFF, 0x8F, 0xFC, 0x00, 0x06,
-    0xF0, 0xFF, 0xC0, 0x00, 0x1F, 0x1F, 0xF8, 0x00, 0x02, 0xE1, 0xFF, 0x40, 0x00, 0x2D, 0x2F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC6, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xF9, 0x0B, 0xFF, 0x80, 0xFF,
-    0xD0, 0x00, 0xBF, 0xE0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x0B, 0xFE,
-    0x00, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x3F, 0xF0,
-    0x00, 0x2F, 0xF4, 0x1F, 0xF8, 0x00, 0x0F, 0xFD, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x40,
-    0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x19, 0x40, 0x00, 0xBF,
-    0xCB, 0xFF, 0x80, 0x03, 0xFF, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x6F,
-    0xFD, 0x02, 0xFF, 0xE0, 0x2F, 0xF4, 0x0F, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x02, 0xFF, 0x40,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0,
-    0x07, 0xFD, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF,
-    0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF,
-    0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFC,
-    0xFF, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0xBF, 0x83, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xD1, 0xFF, 0xC0,
-    0x01, 0xFF, 0xEF, 0xFC, 0xFF, 0xE0, 0x1B, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x06, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xD0, 0xFF, 0xC3, 0xF4, 0x7F, 0xF0, 0x0B, 0xFC, 0xBF, 0x0F, 0xFC, 0x00, 0xFF, 0xCB, 0xF1, 0xFF,
-    0x80, 0x2F, 0xFC, 0xBF, 0xFF, 0xFE, 0xAF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xFA, 0x50, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x14, 0x00, 0x01, 0xFF, 0xE5, 0x6F, 0x40, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x0F,
-    0xFC, 0xFF, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0xBF, 0x83, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xD1, 0xFF,
-    0xC0, 0x01, 0xFF, 0xEF, 0xFC, 0xFF, 0xE0, 0x1B, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x06, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0xFF, 0xC3, 0xF4, 0x7F, 0xF0, 0x0B, 0xFC, 0xBF, 0x0F,
-    0xFC, 0x00, 0xFF, 0xCB, 0xF1, 0xFF, 0x80, 0x2F, 0xFC, 0xBF, 0xFF, 0xFE, 0xAF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xFA, 0x50, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x14, 0x00,
-    0x01, 0xFF, 0xE5, 0x6F, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x3F,
-    0xE0, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x0B, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFE, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x1F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xC3, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x07, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x2F, 0xF0, 0x1F, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xD0, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xC0, 0x07, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0xBF,
-    0xFF, 0x40, 0x05, 0xFF, 0xF0, 0x1F, 0xF4, 0x1F, 0xFE, 0x50, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x2F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x43, 0xFF,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0x82, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x0F, 0xF4, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x81, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x1A,
-    0xFF, 0xF0, 0x2F, 0xF0, 0x0F, 0xFF, 0xA0, 0x02, 0xFF, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xFF, 0x00,
-    0x3F, 0xFF, 0x40, 0x3F, 0xE0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x0B, 0xFF,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF4,
-    0x00, 0x7F, 0xE0, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x01, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x0B,
-    0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x01, 0xFF, 0xD0, 0x6F, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x1F,
-    0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00,
-    0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x04, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x03, 0xFF, 0x80, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0x81,
-    0xFF, 0xC0, 0x00, 0xBF, 0xD1, 0xFF, 0xD0, 0x00, 0x2F, 0xF0, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xBF, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0xBF,
-    0xF0, 0x01, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x7F,
-    0xE0, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x09, 0x01, 0xFF, 0xF4,
-    0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF5, 0x5B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x7F, 0xE0, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xFD, 0x00, 0x2F, 0xF5, 0x54, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF4, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xE7, 0xFF,
-    0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x7F,
-    0xD0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x02,
-    0xFF, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xAA, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xDF, 0xFF, 0x40, 0x0B, 0xFF, 0xFC, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x81, 0x40, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xA9, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF,
-    0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xEA, 0xAA, 0xBF, 0xE0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xFE,
-    0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F,
-    0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x01, 0xFF,
-    0x80, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x03, 0xFF, 0x40,
-    0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFE, 0xAA, 0xBF, 0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x0F, 0xF8, 0x00, 0xBF, 0xD0,
-    0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x3F,
-    0xF0, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x80, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00,
-    0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00,
-    0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
-    0xF5, 0x55, 0x6F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xEA, 0xAA, 0xFF, 0xE0, 0x00, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF9, 0x54, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x83,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x01, 0xFF,
-    0x80, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x3F,
-    0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xEA, 0xAB, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x00,
-    0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFF, 0xFC,
-    0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0x43, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x7F, 0xE0, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x0F, 0xF8, 0x00, 0x0B,
-    0xFD, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
-    0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0xBF,
-    0xD0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0xFF, 0xE0,
-    0x07, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xE6, 0xFF, 0x40, 0x00, 0x10, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x1F, 0xF8, 0x00, 0xFF, 0xC2,
-    0xFF, 0x40, 0x0F, 0xF8, 0x3F, 0xF0, 0x01, 0xFF, 0x43, 0xFF, 0x00, 0x3F, 0xF4, 0x3F, 0xE0, 0x03,
-    0xFF, 0x07, 0xFE, 0x00, 0xBF, 0xF0, 0x7F, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0x9B, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0xFF, 0xC0, 0x0B, 0xFF, 0x4F, 0xFC, 0x00, 0x05, 0x41, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xEF, 0xF0, 0x00, 0x2F, 0xEF,
-    0xF0, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0xFF, 0x7F, 0xC0, 0x0B, 0xF6, 0xFE, 0x00, 0x03, 0xFD, 0xBF,
-    0x00, 0x3F, 0xCF, 0xF8, 0x00, 0x1F, 0xF2, 0xFC, 0x02, 0xFD, 0x3F, 0xD0, 0x00, 0x7F, 0xCB, 0xF0,
-    0x0F, 0xF1, 0xFF, 0x00, 0x02, 0xFF, 0x2F, 0xC0, 0xBF, 0x4B, 0xFC, 0x00, 0x0F, 0xF8, 0xBF, 0x43,
-    0xFC, 0x3F, 0xE0, 0x00, 0x3F, 0xD1, 0xFD, 0x2F, 0xD0, 0xFF, 0x40, 0x01, 0xFF, 0x07, 0xF4, 0xFF,
-    0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x1F, 0xDB, 0xF4, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x7F, 0xBF, 0xC0,
-    0xBF, 0xC0, 0x00, 0xFF, 0x40, 0xFF, 0xFD, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0xF0, 0x0F,
-    0xF9, 0x54, 0x1F, 0xF0, 0x0F, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0xBF, 0xC0, 0x3F, 0xFC, 0x02, 0xFF,
-    0xFF, 0x83, 0xFE, 0x00, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x0F, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x00, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0x40,
-    0x0B, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF4, 0x00, 0xFF, 0xBF, 0x80, 0xFF, 0x7F, 0xC0, 0x03, 0xFD,
-    0xFF, 0x07, 0xF9, 0xFF, 0x00, 0x1F, 0xF3, 0xFC, 0x3F, 0xCB, 0xFC, 0x00, 0x7F, 0xCF, 0xF1, 0xFE,
-    0x3F, 0xE0, 0x02, 0xFE, 0x3F, 0xCF, 0xF0, 0xFF, 0x40, 0x0F, 0xF8, 0xFF, 0x7F, 0x87, 0xFC, 0x00,
-    0x3F, 0xD2, 0xFF, 0xFC, 0x2F, 0xF0, 0x01, 0xFF, 0x0B, 0xFF, 0xE0, 0xFF, 0x80, 0x0B, 0xFC, 0x2F,
-    0xFF, 0x03, 0xFF, 0xA9, 0x2F, 0xE0, 0xBF, 0xF8, 0x0F, 0xFF, 0xF4, 0xFF, 0x81, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xC3, 0xFD, 0x07, 0xFE, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0xAF, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE3,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD3, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x43, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFD, 0x02, 0xFE, 0x00,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0x55, 0x56, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00,
-    0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0A, 0xA0, 0x06, 0xA0, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x00, 0xFF, 0x02, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFA, 0xFF,
-    0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x0F,
-    0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFE, 0x00,
-    0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0xBF, 0xF4,
-    0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8, 0x00, 0x1F,
-    0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD2, 0xFE, 0x00,
-    0x00, 0x02, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x03,
-    0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0xE0, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40,
-    0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x55, 0x56, 0xFF, 0x40, 0xBF, 0xD0,
-    0x00, 0x0F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x82, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0xBD, 0x00, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x0B, 0xF0, 0x7F,
-    0x40, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFA,
-    0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xFC,
-    0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFE,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0xBF,
-    0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8, 0x00,
-    0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xEB,
-    0xFF, 0x55, 0x55, 0x00, 0x00, 0x00, 0x7F, 0xF1, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x07, 0xFF, 0x55, 0x54, 0x00, 0x00, 0x07, 0xFF,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFE, 0xAA, 0xA4, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x55, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0x94, 0x00, 0x00, 0x65, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xDF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xDB, 0xFF,
-    0xFD, 0x0F, 0xFC, 0x0F, 0xFE, 0x02, 0xFF, 0xF0, 0x07, 0xFC, 0x1F, 0xFC, 0x01, 0xFF, 0xC0, 0x0B,
-    0xFC, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xEA, 0xFF, 0xF4, 0x3F,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xD0, 0x03,
-    0xFF, 0xFA, 0x50, 0x00, 0xBF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xFF, 0x80, 0x01, 0x40, 0x3F, 0xFE, 0xFF, 0xFF, 0xE5, 0x6F, 0x80,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0x87, 0xE3, 0xFF, 0xF9, 0x00, 0x00, 0x10, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0xAF,
-    0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xF5, 0x55, 0x50,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAA, 0x80, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0A, 0xA0, 0x06, 0xA4, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x00, 0xBF,
-    0x41, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xAF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xE0, 0x7F, 0xE0, 0x0F, 0xFD, 0x00,
-    0xFF, 0x80, 0x7F, 0xE0, 0x03, 0xFE, 0x02, 0xFF, 0x40, 0x7F, 0xF4, 0x0F, 0xFE, 0xAF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xEA, 0x40, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x80, 0x03, 0xFF, 0xE5, 0xBF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF9,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x6A, 0xFF,
-    0xFF, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0x95, 0x5F, 0xFC, 0x7F, 0xF4, 0x00, 0x1F, 0xFC, 0xBF, 0xE0, 0x00, 0x3F, 0xF8, 0xFF,
-    0xC0, 0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0xFF, 0xE0, 0x0B, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x01, 0xF5, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xF9, 0x6F, 0xF8, 0x3F, 0xF4, 0x03,
-    0xFF, 0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x3F, 0xE0, 0x0F, 0xFD, 0x03, 0xFF, 0x47, 0xFF, 0x80, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0x4B, 0xF8,
-    0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF9, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x6A, 0xFF, 0xFF,
-    0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0x95, 0x5F, 0xFC, 0x7F, 0xF4, 0x00, 0x1F, 0xFC, 0xBF, 0xE0, 0x00, 0x3F, 0xF8, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0xFF, 0xE0, 0x0B, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xF4, 0x00,
-    0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x04, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x50, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0x96, 0xFF, 0x83, 0xFF, 0x40, 0x3F, 0xF0,
-    0x3F, 0xE0, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0xFF, 0xD0, 0x3F, 0xF4, 0x7F, 0xF8, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD3,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF4, 0x00,
-    0x2F, 0xF4, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x2F, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x0F,
-    0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFE,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x1F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0xBF, 0xC3, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0x83, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x07, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x2F, 0xF0,
-    0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x03,
-    0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFD,
-    0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x1F,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x42, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x01, 0xFF, 0xE0, 0x00,
-    0xBF, 0xC0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0xFC, 0x01, 0xFF, 0xFE,
-    0x00, 0xFF, 0x80, 0xBF, 0xFF, 0x40, 0x05, 0xFF, 0xF0, 0x1F, 0xF4, 0x1F, 0xFE, 0x50, 0x00, 0x03,
-    0xFF, 0x02, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x2F, 0xF0, 0x7F, 0xE0, 0x00, 0x00,
-    0x01, 0xFF, 0x43, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0x82, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x81, 0xFF, 0x41,
-    0xFF, 0xC0, 0x00, 0x1A, 0xFF, 0xF0, 0x2F, 0xF0, 0x0F, 0xFF, 0xA0, 0x02, 0xFF, 0xFD, 0x03, 0xFF,
-    0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x3F, 0xE0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x07,
-    0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xE0, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x01, 0xFF,
-    0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x79, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x05, 0x56, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x64, 0x00, 0x0B, 0xFF, 0x80, 0x7F, 0xEA, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x01, 0xFF, 0x0F, 0xF4,
-    0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x16, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x0B, 0x90, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x05, 0x5B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFE,
-    0x07, 0xEA, 0xAF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE,
-    0x40, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x55, 0xFF, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0x5B, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x38, 0x00, 0x07, 0xFF, 0xC0, 0x3F, 0xFA, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x2A, 0xAA, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x6F, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x79, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFF,
-    0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xFF, 0xF4, 0x00, 0xFF, 0xC0,
-    0x3F, 0xEF, 0xF4, 0x00, 0xFF, 0x80, 0xBF, 0x9F, 0xF0, 0x00, 0xFF, 0x41, 0xFF, 0x2F, 0xF0, 0x01,
-    0xFF, 0x03, 0xFD, 0x3F, 0xE0, 0x02, 0xFF, 0x0B, 0xFC, 0x3F, 0xD0, 0x03, 0xFE, 0x1F, 0xF0, 0x7F,
-    0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0xFF, 0xC0, 0x0B, 0xFD, 0xFF,
-    0x00, 0xFF, 0x80, 0x0B, 0xFB, 0xFE, 0x01, 0xFF, 0x40, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x0F,
-    0xFF, 0xF4, 0x02, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFE,
-    0x00, 0x3F, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x3F, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4,
-    0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x3F,
-    0xF0, 0x03, 0xFF, 0x40, 0xFF, 0x80, 0x1F, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0xF0, 0x0F, 0xFC, 0x0B,
-    0xFF, 0x80, 0x3F, 0xFE, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xDF, 0xF0, 0x01, 0xFF, 0xFE, 0x3F, 0xC0,
-    0x01, 0xFF, 0xD0, 0xFF, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xFE,
-    0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x02,
-    0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0xF8, 0x00, 0xBF,
-    0xC0, 0x1F, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x3F, 0xEF, 0xF4, 0x00, 0xFF, 0x80, 0xBF, 0x9F, 0xF0,
-    0x00, 0xFF, 0x41, 0xFF, 0x2F, 0xF0, 0x01, 0xFF, 0x03, 0xFD, 0x3F, 0xE0, 0x02, 0xFF, 0x0B, 0xFC,
-    0x3F, 0xD0, 0x03, 0xFE, 0x1F, 0xF0, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0xBF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0xFF, 0xC0, 0x0B, 0xFD, 0xFF, 0x00, 0xFF, 0x80, 0x0B, 0xFB, 0xFE, 0x01, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x02, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x03,
-    0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x3F, 0xFF,
-    0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0xBD, 0x00, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x02, 0xFE, 0x2F, 0xF0, 0x00, 0x07, 0xF0,
-    0x7F, 0x40, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF,
-    0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFE, 0x03,
-    0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xC0,
-    0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0xFF, 0x00, 0x1F, 0xFF, 0xE3, 0xFC,
-    0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x81, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC,
-    0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x07,
-    0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00,
-    0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFE,
-    0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x03, 0xF0, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0x0F, 0xE0, 0xBF, 0x00,
-    0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F,
-    0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F,
-    0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD,
-    0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xE0, 0x0B, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x3F,
-    0xF0, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF8,
-    0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0x2F, 0xFF, 0xEF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0x97, 0xFF, 0x40,
-    0xFF, 0xD0, 0x1F, 0xFC, 0x1F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFE, 0xAA, 0xAF, 0xF8, 0xBF,
-    0xD0, 0x02, 0xFF, 0x47, 0xFD, 0x00, 0x3F, 0xF0, 0x7F, 0xF0, 0x0F, 0xFE, 0x03, 0xFF, 0xEB, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0x02, 0xFF, 0xD0, 0x07, 0xFF,
-    0x40, 0x02, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F,
-    0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00,
-    0x01, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x03, 0xFF,
-    0x80, 0x0F, 0xFF, 0x40, 0x0B, 0xFF, 0xFB, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x0B, 0xE0, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x02,
-    0xFF, 0x1F, 0xF0, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0xF9, 0x7F, 0xF4, 0x0F, 0xFD, 0x01, 0xFF, 0xC1, 0xFF, 0x80, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xEA, 0xAA, 0xFF, 0x8B, 0xFD, 0x00, 0x2F, 0xF4, 0x7F, 0xD0, 0x03, 0xFF, 0x07,
-    0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xFE, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40,
-    0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x39, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x81,
-    0xF8, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0x04, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x02, 0x95, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-    0xF4, 0x01, 0xAA, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x01, 0xFF,
-    0xC0, 0x7E, 0xAF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0xBF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x0F, 0xFD, 0x00,
-    0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x1F, 0xF8,
-    0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEB, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFE,
-    0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x4B, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xEB, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x7F,
-    0xC0, 0x00, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x10,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0B, 0xFE, 0x00,
-    0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x1F, 0xFC,
-    0x00, 0x07, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x3F,
-    0xF0, 0x00, 0x00, 0xBF, 0xC1, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x03, 0xFE,
-    0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00,
-    0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0x01,
-    0xFF, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xD0, 0x00,
-    0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0xBF, 0xC0,
-    0x00, 0x00, 0x07, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x46, 0xA8, 0x00, 0x00, 0x03, 0xFF, 0x1F, 0xF8, 0x00, 0x00,
-    0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0x41, 0xFD, 0x00,
-    0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF,
-    0x40, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40,
-    0x00, 0xBF, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x1F,
-    0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x1F,
-    0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x46, 0xA8, 0x00, 0x00,
-    0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x80,
-    0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x3F,
-    0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00,
-    0x00, 0x2F, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x2F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xD0, 0x00, 0x00, 0x0F,
-    0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xF4, 0x00, 0x00,
-    0x2F, 0xE1, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x02, 0xFC, 0x1F, 0xD0, 0x00, 0x00,
-    0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4,
-    0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0x1F, 0xF8, 0x0B, 0xFD, 0x00,
-    0x0B, 0xFD, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xBF, 0xFE, 0x5B, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6A, 0xA7,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x3F, 0x83,
-    0xFC, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x2F, 0xF4, 0xFF, 0x80, 0x0F, 0xFC, 0x7F,
-    0xE0, 0x03, 0xFF, 0x2F, 0xF4, 0x02, 0xFF, 0x8B, 0xFD, 0x00, 0xFF, 0xD2, 0xFF, 0x40, 0xBF, 0xF4,
-    0xBF, 0xFA, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0xFF, 0x80, 0x3F, 0xFD, 0x7F,
-    0xD0, 0x01, 0x50, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xD4,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0x01, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x1F,
-    0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x7F, 0xF0, 0x01,
-    0xFF, 0x80, 0x7F, 0xFC, 0x0B, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xE4, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00,
-    0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x1F, 0xFE, 0xFE, 0x40, 0x03, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xE0, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFD, 0x03, 0xFF, 0xEB, 0xFF, 0xD0, 0xBF, 0xC0, 0x3F, 0xF0, 0x0B, 0xFE, 0x0F, 0xFC,
-    0x07, 0xFE, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x7F, 0xE0, 0x07, 0xFD, 0x1F, 0xF8, 0x07, 0xFE, 0x00,
-    0xFF, 0xC2, 0xFF, 0x40, 0x3F, 0xF4, 0x2F, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xE0, 0x00, 0x2F, 0xFF, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x17, 0xFF, 0x55, 0x40, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1A, 0xFF,
-    0xEA, 0x80, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x55, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x00, 0x1F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x7F,
-    0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x82, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x3F, 0xF8, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0x81, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xDF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x55, 0x00, 0x2F, 0xFC, 0x3F, 0xFF, 0xF4, 0x0B,
-    0xFF, 0x02, 0xFF, 0xFF, 0x41, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x3F, 0xF4, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0xBF,
-    0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFA, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xF0,
-    0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x3F, 0xF8, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0x81, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xDF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1A, 0xFF, 0xFF, 0xEA, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE7, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0x0B,
-    0xFF, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC2, 0xFF, 0xFC, 0xB0, 0x3C, 0x28, 0x2C, 0x0A, 0x0C, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0xC0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFF, 0xFE, 0x0E, 0x03, 0x80, 0xE0, 0xA0, 0x0C, 0x28, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x05, 0x2F, 0xFF,
-    0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80,
-    0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0,
-    0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8,
-    0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE,
-    0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F,
-    0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF,
-    0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x6A, 0x40, 0x0A, 0x80, 0x05, 0x55, 0x55,
-    0x54, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0x3F, 0xFF, 0xFF, 0xF0, 0x2A, 0xAA, 0xAA, 0xA0, 0x00, 0x3F, 0x80,
-    0x2F, 0xD0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x15,
-    0x50, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0xD0, 0x3F, 0xF0, 0x1F, 0xF4, 0x0B, 0xF8, 0x03, 0xFC, 0x02,
-    0xFE, 0x00, 0xFF, 0x00, 0x15, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x3F, 0xF0,
-    0x0F, 0xF4, 0x0B, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x3F,
-    0xC3, 0xFC, 0x3F, 0xC2, 0xFC, 0x2F, 0xC1, 0xFC, 0x05, 0x40, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x2F,
-    0xC0, 0x7F, 0x80, 0x1F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF4, 0x2F, 0xE0, 0x07, 0xFC, 0x0F, 0xF4, 0x03,
-    0xFE, 0x0B, 0xFC, 0x01, 0xFF, 0x43, 0xFE, 0x00, 0xFF, 0xC2, 0xFF, 0x00, 0x15, 0x50, 0x55, 0x40,
-    0x00, 0x00, 0xFF, 0x43, 0xFE, 0x02, 0xFF, 0x07, 0xFE, 0x03, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x0F,
-    0xF8, 0x0B, 0xF8, 0x1F, 0xF0, 0x0F, 0xF0, 0x3F, 0xD0, 0x2F, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF,
-    0x00, 0x15, 0x00, 0x55, 0x00, 0x02, 0xFF, 0x07, 0xFD, 0x03, 0xFF, 0x0B, 0xFC, 0x07, 0xFD, 0x0F,
-    0xF8, 0x0F, 0xFC, 0x1F, 0xF0, 0x0F, 0xF0, 0x3F, 0xE0, 0x2F, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF,
-    0x40, 0x7F, 0x80, 0xFF, 0x00, 0x15, 0x00, 0x54, 0x00, 0x7F, 0xC1, 0xFF, 0x1F, 0xF0, 0x7F, 0xC7,
-    0xFC, 0x0F, 0xF0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x4B, 0xF0, 0x2F, 0xD1, 0xFD, 0x07, 0xF4,
-    0x3F, 0x40, 0xFD, 0x05, 0x40, 0x15, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0xEB, 0xFA, 0xFC, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x4B, 0xEB, 0xFA, 0xBD,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x29, 0x5F, 0xD5, 0xA0, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x25, 0x4F, 0xD5,
-    0x60, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x50, 0x3F,
-    0x40, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0x87,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xDB, 0xFF, 0xFE, 0xBF, 0xFF, 0xEB, 0xFF, 0xFD, 0x7F, 0xFF, 0xC2, 0xFF,
-    0xF4, 0x07, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xFE, 0x00, 0x0F,
-    0xFE, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x07, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0xFF, 0xE0, 0x03,
-    0xF8, 0x00, 0x1F, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xFF, 0x8F, 0xFE, 0x3F,
-    0xF8, 0xBF, 0xC0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x7F, 0xF0, 0x0B,
-    0xFE, 0xBF, 0xF0, 0x0F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFE, 0x7F, 0xD0, 0x0B, 0xFC, 0x05, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x01, 0xFE, 0x00, 0x7F, 0x87, 0xFF, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF6, 0xFF, 0xC0, 0xBF, 0xF0, 0x1F, 0xFD, 0xBF, 0xF0, 0x2F, 0xFC, 0x07, 0xFF,
-    0x1F, 0xF4, 0x07, 0xFD, 0x00, 0xFF, 0x80, 0x50, 0x00, 0x14, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F,
-    0x83, 0xFF, 0x5F, 0xFD, 0x7F, 0xF0, 0xFF, 0x80, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xCB, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x50,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x55, 0xD0, 0x00, 0xD0, 0x00,
-    0xD0, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40,
-    0xFF, 0xFF, 0x55, 0x5B, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0B, 0xFF, 0xFF, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x0B, 0xF4, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xD0,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xE1, 0xFD, 0x0A, 0x90,
-    0x00, 0x0A, 0x90, 0x0F, 0xF0, 0xFF, 0x4F, 0xE2, 0xFF, 0xF0, 0x02, 0xFF, 0xF0, 0x3F, 0xEF, 0xFC,
-    0xFF, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF0, 0xBF, 0xFF, 0xCB, 0xF2, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFC, 0x7F, 0x4F, 0xF4, 0xFF, 0x4F, 0xF4, 0xBF, 0x40, 0x6E, 0x43, 0xF8, 0x7F, 0x82,
-    0xFD, 0x7F, 0xC2, 0xFD, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x0B, 0xF6, 0xFD, 0x0B, 0xF4, 0x00, 0x02,
-    0xFC, 0x0F, 0xF0, 0x3F, 0xCF, 0xF0, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0,
-    0xFF, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x07, 0xFC, 0xFF, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFC,
-    0x2F, 0xD3, 0xFC, 0x2F, 0xD0, 0x00, 0xBF, 0x40, 0x0F, 0xF1, 0xFF, 0x0F, 0xF1, 0xFF, 0x00, 0x07,
-    0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x7F,
-    0xFF, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x0B, 0xF4, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x3F, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xE1, 0xFD, 0x0A, 0x90, 0x00, 0x0A, 0x90, 0x00,
-    0x06, 0x90, 0x0F, 0xF0, 0xFF, 0x4F, 0xE2, 0xFF, 0xF0, 0x02, 0xFF, 0xF0, 0x02, 0xFF, 0xF0, 0x3F,
-    0xEF, 0xFC, 0xFF, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0xBF, 0xFF, 0xCB, 0xF2,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x7F, 0x4F, 0xF4, 0xFF, 0x4F,
-    0xF4, 0xBF, 0x4F, 0xF4, 0xBF, 0x40, 0x6E, 0x43, 0xF8, 0x7F, 0x82, 0xFD, 0x7F, 0xC2, 0xFD, 0x7F,
-    0xC2, 0xFD, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x0B, 0xF6, 0xFD, 0x0B, 0xF6, 0xFE, 0x0B, 0xF4, 0x00,
-    0x02, 0xFC, 0x0F, 0xF0, 0x3F, 0xCF, 0xF0, 0x3F, 0xCF, 0xF4, 0x2F, 0xD0, 0x00, 0x1F, 0xD0, 0x3F,
-    0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x07, 0xFC, 0xFF,
-    0x07, 0xFC, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x2F, 0xD3, 0xFC, 0x2F, 0xD3, 0xFC,
-    0x2F, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xF1, 0xFF, 0x0F, 0xF1, 0xFF, 0x0F, 0xF5, 0xFF, 0x00, 0x07,
-    0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x7F,
-    0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x7F,
-    0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xF8, 0x00, 0xFF,
-    0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x0B, 0xF8,
-    0x0F, 0xF4, 0x01, 0xFF, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xF0, 0x00,
-    0xFF, 0x01, 0xFE, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0xBF, 0x40, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x1F,
-    0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x2F, 0xE0, 0x07, 0xF8, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x07, 0xF8, 0x0B, 0xF0, 0x02, 0xFC, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0xFD, 0x01,
-    0xFC, 0x03, 0xFC, 0x00, 0xBE, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00,
-    0xFF, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x2F, 0x40,
-    0x3F, 0xC0, 0x7F, 0x80, 0x0B, 0xF8, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x3F,
-    0xC0, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x01, 0xFC,
-    0x02, 0xF8, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0xBF, 0x40, 0x2F, 0xE0, 0x3F,
-    0xD0, 0x7F, 0xC0, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xE0, 0x03,
-    0xFC, 0x07, 0xF4, 0x0B, 0xF0, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFD, 0x02,
-    0xFC, 0x00, 0x7F, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x7E, 0x00, 0x02, 0x80,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x7E, 0xE0, 0x00, 0xF4, 0xF0, 0x02,
-    0xF0, 0xF0, 0x07, 0xD0, 0xF4, 0x0F, 0x80, 0xB8, 0x2F, 0x00, 0x78, 0x3D, 0x00, 0x7C, 0x00, 0x08,
-    0x00, 0x01, 0xF4, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0xFF, 0xE0, 0x2F, 0xF8, 0x0B,
-    0xFF, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F,
-    0xD0, 0x03, 0xE4, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x01, 0xFF, 0xC0, 0x3F, 0xF4, 0x0F,
-    0xFD, 0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x07, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0F, 0xF0, 0x00, 0x20, 0x00, 0xBC, 0x00, 0x7F, 0xE0,
-    0x02, 0xF0, 0x0B, 0xFC, 0x01, 0xFF, 0x80, 0x2F, 0xF0, 0x0F, 0xFC, 0x03, 0xFC, 0x02, 0xFF, 0x40,
-    0x0F, 0xFC, 0x01, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x10, 0x1F, 0xE0, 0x0F, 0xFF, 0xF4, 0x07, 0xF4, 0xFF,
-    0xC0, 0x0F, 0xFF, 0x40, 0x3F, 0xF3, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xCB, 0xFC, 0x02, 0xFF,
-    0xFC, 0x02, 0xFF, 0x06, 0x80, 0x2F, 0xFF, 0xFC, 0x01, 0x90, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x0B, 0xE0,
-    0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x7F, 0xD0, 0x0F, 0xF8, 0x03, 0xF4, 0x01, 0xFF, 0x80, 0x0F, 0xD0,
-    0x03, 0x40, 0x07, 0xFD, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0xF4, 0x0F, 0xFD, 0x00, 0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0xBF, 0xE0,
-    0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x7F, 0xE0, 0x02, 0xFF, 0x00, 0x7F, 0xD0,
-    0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x01, 0x50,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x07,
-    0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0xBF, 0xF0, 0x1F, 0xFD, 0x00, 0xBF, 0xF0, 0x1F, 0xFC,
-    0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00, 0x05, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFD,
-    0x7F, 0xD0, 0x4F, 0xF0, 0xFF, 0x40, 0x3F, 0x83, 0xFD, 0x01, 0xFD, 0x2F, 0xF0, 0x0B, 0xF6, 0xFF,
-    0x80, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA,
-    0xA9, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x6A, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0xAB, 0x40, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x7C, 0x2E, 0x00,
-    0x00, 0xBC, 0x03, 0xF9, 0x06, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x2F, 0x80, 0x02,
-    0xF0, 0x0B, 0xC0, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x00, 0x2C, 0x3C, 0x00, 0x00, 0x00, 0xE1, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x01, 0xF4, 0xF0, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00,
-    0xBC, 0x0B, 0x80, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x1F, 0x40, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x07, 0xC0, 0xFF, 0x40, 0x64, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x10, 0x00,
-    0xBF, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x40, 0x0B, 0xF0, 0x00, 0x0F, 0x40, 0xFD, 0x00,
-    0x00, 0x0F, 0x80, 0xFE, 0x00, 0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0xFF, 0x8F, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFD, 0x5A, 0x80, 0x2F, 0xFF, 0xFD, 0x56, 0x81, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x40, 0x3F,
-    0xFB, 0xF0, 0x00, 0x00, 0x2F, 0xF7, 0xF0, 0x00, 0x0F, 0xFC, 0x7F, 0x40, 0x00, 0x0B, 0xFD, 0x3F,
-    0x80, 0x00, 0x7F, 0x43, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x00, 0xE0, 0x2F, 0xD0, 0x00,
-    0x00, 0xB0, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE2, 0xFF, 0xFE, 0x3F, 0xFF, 0xD3,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0xA4, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFE, 0x54, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x00, 0x01, 0xAF, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x5B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x6F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xC0, 0xF8, 0x03, 0xFF, 0x47, 0xD0, 0x0F, 0xFC, 0x04, 0x00, 0x1F, 0xF4, 0x10, 0x00, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xFD, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x01, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x03, 0xE0, 0x0F,
-    0xFD, 0x07, 0xFF, 0x00, 0x40, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xD0,
-    0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF8,
-    0x03, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xF4, 0x00, 0x7F, 0xC0, 0x00,
-    0xBF, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x03,
-    0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0,
-    0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0x40, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x1B, 0xFF, 0x80, 0x00, 0x7F,
-    0xF4, 0x2F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xE0, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFD, 0x01, 0xF4, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x0F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x1F, 0xF4, 0x00, 0x00,
-    0x2F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x03,
-    0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x57, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0xBC, 0x1F, 0xFF,
-    0xFF, 0xCB, 0xC1, 0xFF, 0xFF, 0xFC, 0xBC, 0x1F, 0xFF, 0xFF, 0xDB, 0xC1, 0xFF, 0xFF, 0xFD, 0xBC,
-    0x1F, 0xFF, 0xFF, 0xEB, 0xC1, 0xFF, 0xFF, 0xFE, 0xBC, 0x1F, 0xFF, 0xFF, 0xDB, 0xC1, 0xFF, 0xFF,
-    0xFD, 0xBC, 0x1F, 0xFF, 0xFF, 0xCB, 0xC1, 0xFF, 0xFF, 0xFC, 0xBC, 0x1F, 0xFF, 0xFF, 0x4B, 0xC1,
-    0xFF, 0xFF, 0xE0, 0xBC, 0x1F, 0xFF, 0xF4, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00,
-    0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x1F,
-    0x40, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x00,
-    0xBC, 0x1F, 0x40, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x0B, 0xC1, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF,
-    0xF4, 0x2F, 0x3F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF, 0xF4, 0x2F, 0x7F, 0xFF, 0xFF, 0x42, 0xF7,
-    0xFF, 0xFF, 0xF4, 0x2F, 0x3F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF, 0xF4, 0x2F, 0x3F, 0xFF, 0xFF,
-    0x42, 0xF2, 0xFF, 0xFF, 0xF4, 0x2F, 0x1F, 0xFF, 0xFF, 0xAB, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0xBC, 0x0F, 0xFF, 0xFF, 0xCB, 0xC0,
-    0xFF, 0xFF, 0xFC, 0xBC, 0x0F, 0xFF, 0xFF, 0xDB, 0xC0, 0xFF, 0xFF, 0xFE, 0xBC, 0x0F, 0xFF, 0xFF,
-    0xEB, 0xC0, 0xFF, 0xFF, 0xFE, 0xBC, 0x0F, 0xFF, 0xFF, 0xEB, 0xC0, 0xFF, 0xFF, 0xFE, 0xBC, 0x0F,
-    0xFF, 0xFF, 0xDB, 0xC0, 0xFF, 0xFF, 0xFC, 0xBE, 0xAF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x06, 0xAA, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2D, 0x02, 0xFC, 0x00, 0x0F, 0xF4,
-    0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0x81, 0x60, 0x0F, 0xFB, 0xF0, 0x00, 0x1F, 0xF8, 0xFE, 0x00,
-    0x07, 0xFC, 0x2F, 0xC0, 0x00, 0x3D, 0x07, 0xF8, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0xBF, 0xC0, 0x7F, 0xF0, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0x7F,
-    0x80, 0x1F, 0xD0, 0x03, 0xF4, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0x01,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x80, 0x0B, 0x40, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x00,
-    0x1F, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xE4, 0x1B, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x38, 0x03,
-    0xF4, 0x00, 0x00, 0x7F, 0x83, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x05, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xF4, 0x59,
-    0x00, 0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0xFE, 0x00, 0x00,
-    0x07, 0xC0, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x2D, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD2, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x05,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFC, 0x16, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0xFE, 0x00, 0x00, 0x1F,
-    0xF0, 0xBF, 0x00, 0x00, 0x03, 0xD0, 0x7F, 0x80, 0x00, 0x00, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFE, 0xBF, 0xE0, 0x2F, 0xDF, 0xFE, 0x03,
-    0xFC, 0xBF, 0xE0, 0x7F, 0x83, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x2F, 0xC1, 0xFE, 0x07, 0xFF,
-    0x3F, 0xC0, 0xBF, 0xF7, 0xF8, 0x0B, 0xFF, 0xBF, 0x40, 0x3F, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x1B,
-    0xFA, 0x40, 0x00, 0x00, 0x00, 0x68, 0x02, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xA5, 0x1B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xC0,
-    0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x1F, 0xD0, 0x02, 0xF4, 0x1F, 0x40, 0x00, 0x1F, 0x0F, 0x00, 0x00, 0x01, 0xDB,
-    0x00, 0x00, 0x00, 0x3C, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x04, 0x0F, 0xC0, 0x40, 0x00, 0xF8, 0x3F, 0x0B, 0x80, 0x0B, 0xF8, 0xFC, 0xBF, 0x40,
-    0x0F, 0xFB, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xCF, 0xCF, 0xF4, 0x00,
-    0xFC, 0x3F, 0x0F, 0xC0, 0x00, 0x80, 0xFC, 0x08, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x3F, 0xC1, 0xFE, 0x0B,
-    0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x3F, 0xD1, 0xFF, 0x0B, 0xF8, 0x01, 0xFF, 0x0B, 0xF8, 0x3F, 0xD1,
-    0xFF, 0x00, 0x3F, 0xD0, 0xFF, 0x0B, 0xF8, 0x3F, 0xD0, 0x07, 0xF8, 0x3F, 0xC0, 0xFF, 0x07, 0xF8,
-    0x00, 0xFF, 0x07, 0xF8, 0x2F, 0xC0, 0xFF, 0x00, 0x2F, 0xC0, 0xFF, 0x03, 0xF8, 0x2F, 0xC0, 0x03,
-    0xF4, 0x1F, 0xC0, 0xFF, 0x03, 0xF4, 0x00, 0xBE, 0x03, 0xF4, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x19, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xE3, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0xB8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x05, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x1A,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xA8, 0x00, 0x00, 0x00, 0x01,
-    0xA0, 0x01, 0x40, 0xBF, 0xC3, 0xFF, 0x4F, 0xFD, 0x3F, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xFF, 0xC3, 0xFF, 0x4F, 0xFD, 0x3F, 0xF0, 0x1A, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x02, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0x01,
-    0xFF, 0xC1, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x7F, 0xC0, 0x3F, 0x80, 0x7F, 0xC0, 0x03,
-    0xFF, 0x80, 0xFE, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x03, 0xF8, 0x0F, 0xFE, 0x00, 0x2F, 0xF4, 0x0F,
-    0xE0, 0x2F, 0xF4, 0x00, 0x2F, 0x40, 0x3F, 0x80, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0A, 0xAA,
-    0xAA, 0xBF, 0xEA, 0xAA, 0xA9, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x90,
-    0x0F, 0xE0, 0x06, 0x80, 0x00, 0xBF, 0xD0, 0x3F, 0x80, 0xBF, 0xC0, 0x03, 0xFF, 0x80, 0xFE, 0x03,
-    0xFF, 0x40, 0x0F, 0xFE, 0x03, 0xF8, 0x0F, 0xFD, 0x00, 0x2F, 0xF4, 0x0F, 0xE0, 0x2F, 0xF0, 0x00,
-    0x1A, 0x40, 0x3F, 0x80, 0x2A, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFF,
-    0x8F, 0xFE, 0x3F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0xF8, 0xFF, 0xE3, 0xFF, 0x87, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x43, 0xFF, 0x4F, 0xFE, 0x3F, 0xF8, 0xBF, 0xD0, 0x68, 0x00, 0x05, 0x47, 0xFE, 0xBF, 0xFB,
-    0xFF, 0x7F, 0xE1, 0xA4, 0x00, 0x01, 0xB8, 0x7F, 0xEB, 0xFF, 0xBF, 0xF3, 0xFD, 0x05, 0x00, 0x00,
-    0x2F, 0xCB, 0xFF, 0xBF, 0xFB, 0xFF, 0x2F, 0xC0, 0x00, 0x05, 0x03, 0xFD, 0xBF, 0xFB, 0xFF, 0x7F,
-    0xE1, 0xB8, 0xFF, 0xFF, 0x57, 0xD5, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x5B, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xE0, 0x0B, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x01, 0x40, 0xBF, 0xFE, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0,
-    0x07, 0xD0, 0x0F, 0xF0, 0x1F, 0xF4, 0x3F, 0xFC, 0xBF, 0xFE, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x01, 0x40, 0x02, 0x80, 0x0B, 0xE0, 0x2C, 0x38, 0xB0, 0x0E, 0x3C, 0x3C, 0x0F, 0xF0,
-    0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0x80, 0x57, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x01, 0x40, 0x00, 0x15, 0x00, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD,
-    0x2F, 0xE2, 0xFE, 0x3F, 0xC1, 0xFE, 0x7F, 0x81, 0xFE, 0xBF, 0x42, 0xFD, 0xFF, 0x42, 0xFD, 0xFF,
-    0x03, 0xFC, 0xFF, 0x07, 0xFC, 0xFF, 0x4F, 0xF4, 0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0xB4, 0x0B, 0xF0, 0x1F, 0x80, 0x00, 0x02, 0xA0, 0x1F, 0xC0, 0xBE,
-    0x03, 0xF4, 0x0F, 0xC0, 0x7F, 0x02, 0xFC, 0x0B, 0xE0, 0x3F, 0x40, 0xFC, 0x07, 0xF0, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x1F,
-    0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x00, 0xFD, 0xFF, 0x00, 0x3F, 0x8F, 0xE0, 0x0B, 0xE1, 0xFD, 0x02,
-    0xFC, 0x2F, 0xD0, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x2A, 0xAF, 0xFE, 0x40, 0x00, 0x7F,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xD0, 0x06, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0xB9,
-    0x6F, 0xF4, 0x2F, 0xFF, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0xBF, 0xFE, 0x03, 0xFF, 0xFD, 0x0F, 0xFE, 0xAC, 0x2F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x7F,
-    0xD0, 0xBF, 0xFF, 0xF4, 0xFF, 0xDB, 0xF8, 0xFF, 0x03, 0xFC, 0xFE, 0x03, 0xFC, 0xFE, 0x03, 0xF8,
-    0xBF, 0x9F, 0xF0, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00,
-    0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x1F, 0xE2, 0xFD, 0x07, 0xF0, 0x7F,
-    0x41, 0xFE, 0x2F, 0xC0, 0x3F, 0xFF, 0xD0, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x0B, 0xF9, 0xFF,
-    0x47, 0xF8, 0x1F, 0xE1, 0xFD, 0x07, 0xF8, 0x7F, 0x83, 0xFD, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFE,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x15, 0x00, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x2F, 0xE7, 0xFC,
-    0x3F, 0x80, 0xFD, 0x7F, 0x40, 0xFD, 0x7F, 0x41, 0xFD, 0x3F, 0xDB, 0xFD, 0x3F, 0xFF, 0xFC, 0x0F,
-    0xFA, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0xAA, 0xFF, 0xD0, 0xFF, 0xFF, 0x40, 0xFF, 0xF8,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x78, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x3F,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xA0, 0x00,
-    0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x29, 0x00,
-    0xBC, 0x02, 0xF4, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0x40, 0x3F, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0xBC,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x3E,
-    0x00, 0x1A, 0x00, 0x00, 0x64, 0x00, 0x1F, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x0B,
-    0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0xBC,
-    0x00, 0x3E, 0x00, 0x2F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0B, 0xC0, 0x06, 0x80, 0x00, 0x02, 0x82,
-    0xA0, 0x0B, 0xCF, 0xFC, 0x0F, 0xFE, 0xFE, 0x0F, 0xF0, 0xBE, 0x0F, 0xC0, 0xBE, 0x1F, 0xC0, 0xBD,
-    0x2F, 0x40, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x01, 0xFC, 0x7F, 0x02, 0xF8, 0xBE, 0x03, 0xF4, 0x54,
-    0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x2F, 0xF1,
-    0xFE, 0x3F, 0xD0, 0xFF, 0x3F, 0xC1, 0xFF, 0x7F, 0x81, 0xFE, 0xBF, 0x42, 0xFE, 0xBF, 0x43, 0xFD,
-    0xBF, 0x43, 0xFC, 0xBF, 0x4B, 0xF8, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0x40, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xC0, 0xF5, 0xFE, 0x01, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x2F, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0xC0, 0x7F, 0x80, 0x00,
-    0x1F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x2F,
-    0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x0B, 0xAB, 0xFC, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x05, 0x7F, 0xD0, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0xBE, 0x6F, 0xFC, 0x2F, 0xFF, 0xFC, 0x07,
-    0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFF, 0x80, 0x2F, 0xDF, 0xD0, 0x1F, 0xCB, 0xF0,
-    0x1F, 0xC3, 0xFC, 0x0F, 0xD0, 0xFE, 0x0B, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFC, 0xAA, 0xAF, 0xFA,
-    0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF0, 0x02, 0x9B, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B,
-    0xF4, 0x39, 0x5B, 0xFC, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x1F, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x2F, 0xFA, 0xA4, 0x1F, 0xF0, 0x00, 0x0B, 0xF0,
-    0x00, 0x03, 0xFA, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x7F, 0xD7, 0xFC, 0x2F, 0xD0, 0x7F, 0x0B, 0xF0,
-    0x1F, 0xC1, 0xFC, 0x0B, 0xF0, 0x3F, 0xDB, 0xF8, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFC, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00,
-    0x2F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x2F, 0xFF, 0x40, 0x2F, 0xFF, 0xF0,
-    0x0F, 0xF1, 0xFE, 0x07, 0xF4, 0x3F, 0x80, 0xFE, 0x2F, 0xC0, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xC0,
-    0x07, 0xFF, 0xF8, 0x07, 0xFD, 0xFF, 0x43, 0xFC, 0x0F, 0xF0, 0xFE, 0x03, 0xFC, 0x3F, 0xC2, 0xFE,
-    0x0B, 0xFF, 0xFF, 0x00, 0xBF, 0xFE, 0x00, 0x01, 0x54, 0x00, 0x00, 0x15, 0x00, 0x02, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFC, 0x1F, 0xF6, 0xFD, 0x3F, 0xC0, 0xFE, 0x3F, 0x80, 0xFE, 0x3F, 0x80, 0xFE, 0x3F,
-    0xD7, 0xFE, 0x2F, 0xFF, 0xFD, 0x0B, 0xFA, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0xAA, 0xBF,
-    0xE0, 0xBF, 0xFF, 0x40, 0xBF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x1F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0A, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0x55, 0x55, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x0F, 0xC0, 0x0B, 0xD0, 0x03, 0xF0, 0x01, 0xF4,
-    0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00,
-    0x07, 0xD0, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xA0, 0x00, 0x00, 0x28, 0x00, 0x0F,
-    0x40, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F,
-    0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x0F, 0xC0,
-    0x0B, 0xC0, 0x07, 0xD0, 0x02, 0x90, 0x00, 0x01, 0xFD, 0x2A, 0x0B, 0xFF, 0xBE, 0x1F, 0xFB, 0xFD,
-    0x3F, 0x81, 0xFC, 0x7F, 0x01, 0xFC, 0xBF, 0x01, 0xF8, 0xBE, 0x03, 0xF4, 0xFE, 0x07, 0xF0, 0xBF,
-    0x1F, 0xF0, 0x7F, 0xFF, 0xE0, 0x2F, 0xF7, 0xD0, 0x01, 0x40, 0x00, 0x00, 0xBF, 0x90, 0x1F, 0xFF,
-    0xD1, 0xFE, 0x2F, 0x8F, 0xD0, 0x7E, 0x7F, 0x07, 0xF6, 0xFF, 0xFF, 0x8B, 0xFF, 0x90, 0x2F, 0x40,
-    0x00, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0x55, 0x00, 0x00, 0xBF, 0x80, 0x2F,
-    0xFF, 0xC1, 0xFE, 0xBF, 0x8F, 0xD0, 0x7F, 0x7F, 0x01, 0xFE, 0xF8, 0x07, 0xFB, 0xD0, 0x2F, 0xFF,
-    0x40, 0xFD, 0xBF, 0x0B, 0xF0, 0xFF, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x54, 0x00, 0x02, 0xA4, 0x0A,
-    0x90, 0x2F, 0xC3, 0xFC, 0x00, 0xFC, 0xBF, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x07, 0xF3, 0xF4, 0x01, 0xFD, 0x2F, 0xC0,
-    0x3F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x07, 0xFF, 0xF4, 0x07, 0x56, 0xFC,
-    0x00, 0x00, 0xFD, 0x00, 0x05, 0xFD, 0x07, 0xFF, 0xFD, 0x1F, 0xFA, 0xFC, 0x3F, 0x42, 0xF8, 0x3F,
-    0x07, 0xF0, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x01, 0x50, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF5, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xEB, 0xF4, 0x1F, 0xD0, 0xFD, 0x0B, 0xF0, 0x3F, 0x43, 0xF4, 0x0F, 0xC0, 0xFC, 0x07, 0xF0, 0x7F,
-    0x02, 0xF8, 0x1F, 0x80, 0xFD, 0x0B, 0xD0, 0x3F, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0A,
-    0x90, 0x3F, 0x43, 0xF8, 0x03, 0xF0, 0xFD, 0x00, 0x7F, 0x3F, 0x40, 0x0B, 0xEF, 0xD0, 0x00, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFD, 0xBE, 0x00, 0x2F, 0x83, 0xF0, 0x03, 0xF4, 0x3F, 0x80,
-    0x3F, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x02,
-    0xF8, 0x03, 0xF4, 0x03, 0xF0, 0x07, 0xF0, 0x0B, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xA1, 0xFC, 0x0B, 0xE0, 0x0F, 0xAF, 0xFC, 0xFF,
-    0xE0, 0x3F, 0xEB, 0xFF, 0xBF, 0xC1, 0xFD, 0x0F, 0xF0, 0x3F, 0x0B, 0xF0, 0x3F, 0x41, 0xFC, 0x3F,
-    0x40, 0xFC, 0x0B, 0xE0, 0xFC, 0x07, 0xF0, 0x3F, 0x43, 0xF0, 0x2F, 0x80, 0xFC, 0x1F, 0x80, 0xFD,
-    0x03, 0xF0, 0xBD, 0x03, 0xF0, 0x1F, 0x83, 0xF4, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x92, 0xF8, 0x00, 0xFB, 0xFF, 0xC0, 0x7F, 0xEB, 0xF0, 0x2F, 0xC0, 0xFC, 0x0F, 0xE0, 0x3F,
-    0x03, 0xF0, 0x1F, 0xC1, 0xFC, 0x0B, 0xE0, 0x7E, 0x02, 0xF4, 0x2F, 0x40, 0xFC, 0x0F, 0xC0, 0x3F,
-    0x03, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xBD, 0x00, 0x0F, 0xBF, 0xF8, 0x01, 0xFF,
-    0x7F, 0xC0, 0x2F, 0xC0, 0xFC, 0x03, 0xF4, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x07, 0xF0, 0x1F, 0xC0,
-    0x7E, 0x03, 0xF8, 0x0B, 0xF0, 0xBF, 0x00, 0xFF, 0xFF, 0xD0, 0x0F, 0xDF, 0xF4, 0x01, 0xF8, 0x14,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0xFF, 0xFE, 0x1F, 0xD5, 0xC2, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xE0, 0x01, 0xFF,
-    0x80, 0x02, 0xFC, 0x40, 0x2F, 0x8B, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x3E, 0x00, 0x6F, 0xE9, 0xBF, 0xFF, 0x5B, 0xFA, 0x81, 0xFC, 0x00, 0xBE, 0x00, 0x3F,
-    0x40, 0x0F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0xF4, 0x0F, 0xFD, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x01, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x2A, 0xAA, 0xA4, 0xFF, 0xC0, 0xFF, 0xFF, 0xD3, 0xFE,
-    0x07, 0xFF, 0xFF, 0x0F, 0xF8, 0x2F, 0xFF, 0xFC, 0x3F, 0xE0, 0xBF, 0x80, 0x00, 0xFF, 0xC3, 0xFD,
-    0x00, 0x03, 0xFF, 0xEF, 0xF9, 0x54, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE5, 0x50, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0xBC, 0x3E,
-    0x00, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00, 0x1B, 0xFE, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x9B, 0xF4, 0x07, 0xFF,
-    0xEF, 0x0B, 0xE0, 0x0F, 0xFF, 0x3E, 0x0F, 0x40, 0x2F, 0xFC, 0x3D, 0x1F, 0x00, 0x3F, 0xF4, 0xBC,
-    0x3E, 0x00, 0x7F, 0xF0, 0xF4, 0x3C, 0x00, 0xBF, 0xE1, 0xF0, 0xBC, 0x00, 0xBF, 0xD3, 0xE0, 0xF4,
-    0x00, 0xFF, 0xC3, 0xD1, 0xF0, 0x00, 0xFF, 0xCB, 0xC3, 0xE0, 0x00, 0xFF, 0xCF, 0x83, 0xD0, 0x00,
-    0xFF, 0xEF, 0x0B, 0xC0, 0x00, 0xBF, 0xFE, 0x0F, 0x40, 0x00, 0x7F, 0xFD, 0x1F, 0x1C, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xE4, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x00, 0x0F, 0x83, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xF4, 0x06, 0xF0,
-    0x07, 0xFF, 0x80, 0x00, 0x10, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x1A, 0x42, 0xD0, 0x7F, 0xF0, 0x3F, 0x4F, 0xD0, 0xBF, 0xE0,
-    0x3F, 0x7F, 0xC0, 0xBF, 0xD0, 0x7F, 0xFF, 0xC0, 0xFF, 0xD0, 0xBF, 0xE4, 0x40, 0xFF, 0xC0, 0xBF,
-    0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0xFF, 0x00, 0x00, 0xBF, 0xE1, 0xFF, 0x00,
-    0x00, 0x7F, 0xF2, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x6C, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF9, 0x55, 0x54, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0xAF, 0xFF, 0xA9, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x01, 0xA0, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x7F,
-    0xF9, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x5F,
-    0xFE, 0x55, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xAF, 0xFE, 0xAA, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x64, 0x03, 0xFA, 0x50, 0x00, 0x2F, 0xC2, 0xFF, 0xE2, 0xFF,
-    0xFF, 0x00, 0x0F, 0xF2, 0xFF, 0xFE, 0xFF, 0xFF, 0xE0, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFD, 0xBF, 0xFF, 0xEB, 0xFF, 0x40, 0xBF, 0xF8, 0x0F, 0xFF, 0xC0, 0xBF, 0xD0, 0x2F,
-    0xFC, 0x02, 0xFF, 0xC0, 0x1F, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x0B, 0xFD, 0x03, 0xFF, 0x00,
-    0x3F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x0B, 0xFE,
-    0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x1F, 0xF4, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x0B,
-    0xFD, 0x03, 0xFE, 0x02, 0xFF, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0xFF, 0xF8, 0x00, 0xFF, 0xC0,
-    0xBF, 0xC0, 0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x7F, 0xFF, 0x40, 0x1F, 0xF4, 0x0F, 0xFC,
-    0x3F, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x3F, 0xBF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBE, 0x00,
-    0x0B, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0xF0, 0x07, 0xF4, 0x00,
-    0x7F, 0xFC, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0x40, 0xFF, 0x00, 0x0B, 0xFB, 0xD0, 0x3F, 0x80, 0x03,
-    0xFA, 0xF4, 0x1F, 0xD0, 0x0A, 0xFF, 0xFF, 0xAF, 0xFA, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xF1, 0xFC, 0x3F, 0x80, 0x03, 0xF8, 0x7F, 0x1F, 0xD0, 0x0A, 0xFF,
-    0xBF, 0xEF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF0,
-    0x3F, 0x3F, 0x80, 0x03, 0xF8, 0x0F, 0xDF, 0xD0, 0x00, 0xFD, 0x03, 0xFB, 0xF0, 0x00, 0x7F, 0x00,
-    0xBF, 0xFC, 0x00, 0x2F, 0xC0, 0x2F, 0xFE, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0x40, 0x03, 0xF8, 0x01,
-    0xFF, 0xD0, 0x01, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0xA8, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0,
-    0x7F, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0x80, 0x00, 0x3F, 0xE0, 0x0B, 0xFD, 0x1F, 0xD0,
-    0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x1F, 0xFF, 0xF0, 0x07, 0xFE, 0xAF, 0xFF, 0xAF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x86, 0xFF, 0xEA, 0x40, 0x3F, 0xFF,
-    0xFE, 0x40, 0x3F, 0xD0, 0x00, 0x1F, 0xFA, 0x94, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x70,
-    0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE6,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x01, 0xFF, 0xC0, 0x06, 0x50, 0x00, 0x0F, 0xFC, 0x03,
-    0xFF, 0x07, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0x80, 0x7F,
-    0xF3, 0xFF, 0xFF, 0xD0, 0x07, 0xFD, 0x03, 0xFF, 0x9F, 0xF8, 0x1F, 0x00, 0x2F, 0xF5, 0xBF, 0xFC,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x0B,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFC, 0x2F, 0xF0, 0x00, 0x0F,
-    0xFF, 0x00, 0x3F, 0xE0, 0xBF, 0xD0, 0x00, 0x0F, 0xFD, 0x01, 0xFF, 0x41, 0xFF, 0x40, 0x00, 0x1F,
-    0xF4, 0x0B, 0xFD, 0x03, 0xFE, 0x10, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0xBD, 0x5B, 0xFF,
-    0x00, 0xFF, 0xC0, 0x3F, 0xF2, 0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x00, 0xBF, 0xDB, 0xFF, 0xFF, 0x80,
-    0x1F, 0xF4, 0x01, 0xFF, 0x8B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x07, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xC0,
-    0x0F, 0xFC, 0x01, 0xFD, 0x00, 0x7F, 0x00, 0x7F, 0xF0, 0x0F, 0xF0, 0x02, 0xFC, 0x03, 0xFF, 0x80,
-    0x3F, 0x80, 0x0B, 0xF0, 0x0F, 0xFE, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0xBE, 0xF8, 0x0F, 0xF0, 0x00,
-    0xBF, 0x03, 0xF7, 0xE0, 0x3F, 0x40, 0x02, 0xFC, 0x1F, 0xDF, 0x82, 0xFC, 0x00, 0x0F, 0xF0, 0xBD,
-    0xBD, 0x0F, 0xE0, 0x00, 0x3F, 0x83, 0xF6, 0xF4, 0x7F, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x5F, 0xE7, 0xF5, 0xFE, 0xBF, 0x54, 0x00, 0x3F,
-    0x6F, 0x83, 0xF2, 0xFC, 0x00, 0x00, 0xFD, 0xFD, 0x0F, 0xCF, 0xE0, 0x00, 0x03, 0xF7, 0xF0, 0x3F,
-    0x7F, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0xFE, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x03, 0xFF, 0xD0, 0x00,
-    0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x02, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x03, 0xFC, 0x00, 0xBF,
-    0x40, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0xFF, 0x0A, 0xA0,
-    0xFF, 0x0B, 0xF8, 0x01, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF4, 0x02, 0xFE, 0x1F, 0xF0, 0xFF, 0x0F,
-    0xF0, 0x03, 0xFD, 0x2F, 0xE1, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xD2, 0xFE, 0x1F, 0xE0, 0x03,
-    0xFC, 0x3F, 0xC3, 0xFD, 0x2F, 0xE0, 0x07, 0xF8, 0x7F, 0xC3, 0xFC, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F,
-    0x87, 0xFC, 0x3F, 0xC0, 0x0F, 0xF4, 0xBF, 0x87, 0xF8, 0x7F, 0xC0, 0x0F, 0xF0, 0xFF, 0x4B, 0xF8,
-    0xBF, 0x80, 0x1F, 0xF0, 0xFF, 0x0F, 0xF4, 0xFF, 0x40, 0x2F, 0xE1, 0xFF, 0x0F, 0xF0, 0xFF, 0x00,
-    0x2F, 0xD2, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xC3,
-    0xFE, 0xAA, 0xBF, 0xF8, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x87, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0x4B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xAA, 0xFF,
-    0xF9, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xAA,
-    0xBF, 0xEA, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x64, 0x0B, 0xFC, 0x00, 0x00, 0x2F,
-    0xFE, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x02,
-    0xFF, 0xF6, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xE0, 0x01, 0xFF,
-    0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x02,
-    0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x83, 0xF4, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE0,
-    0x1E, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x01, 0x6F, 0xFD, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x06, 0xFF, 0xD5, 0x54, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xBF, 0xFE, 0xA8, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x06, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF,
-    0xF0, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x02,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xD0, 0x00, 0x07, 0xFE,
-    0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0x3F, 0xF4, 0x00, 0x01, 0x6F, 0xFE, 0xFF, 0xD5, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8,
-    0x03, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x05, 0x57, 0xFF, 0x95, 0x50, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x2D, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x10,
-    0x00, 0x01, 0xFF, 0xF8, 0xB4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xBF, 0xFF, 0xD0, 0x00,
-    0x09, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x7D, 0xFF, 0xC0, 0x00, 0x00, 0x20, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0x90, 0x01, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x05, 0x40,
-    0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x7F, 0xFF,
-    0xF8, 0x07, 0xFD, 0x00, 0x1F, 0xFC, 0x3F, 0xFA, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xFE, 0x1F, 0xF0,
-    0x2F, 0xD0, 0xFF, 0xC0, 0x0B, 0xFF, 0x0F, 0xF4, 0x07, 0xF8, 0x3F, 0xF0, 0x0B, 0xFF, 0x43, 0xFC,
-    0x00, 0xFE, 0x0F, 0xF8, 0x2F, 0xFF, 0x81, 0xFF, 0x00, 0x7F, 0x47, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xC0, 0x3F, 0xC2, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFE, 0xBF, 0xF0, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE4, 0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xC1, 0xFE, 0x00,
-    0x00, 0x1F, 0xF8, 0x1F, 0xE0, 0x00, 0x02, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xD0,
-    0x00, 0x02, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x9F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x09, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xE0, 0x3F, 0xF8,
-    0x00, 0x00, 0x3F, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xF7, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xDF, 0xF4, 0x7F, 0xE0, 0x03, 0xF8, 0x7E, 0x03,
-    0xFF, 0x00, 0xBF, 0x03, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x10, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xE4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xC1, 0xBF, 0xF0, 0x01, 0x7F,
-    0xF5, 0x5F, 0xFD, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xFD, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0x9B, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0xA4,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x6F, 0x40, 0x1F, 0xFF, 0x5F, 0x80, 0x10, 0x03, 0xFF,
-    0xC2, 0xF4, 0x00, 0x00, 0xBF, 0xF0, 0x2F, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xF0, 0x00, 0x01, 0xFF,
-    0xC0, 0x3E, 0x00, 0x00, 0x2F, 0xF8, 0x07, 0xE5, 0x55, 0x43, 0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x3F,
-    0xF4, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x0F, 0xEB, 0xFF, 0x03,
-    0xFF, 0x01, 0xF4, 0x3F, 0xE0, 0x3F, 0xF0, 0x2F, 0x07, 0xFE, 0x03, 0xFF, 0x43, 0xF0, 0xBF, 0xD0,
-    0x2F, 0xFC, 0x3F, 0x0F, 0xFC, 0x01, 0xFF, 0xFB, 0xE1, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE8,
-    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF3, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0xAB, 0xFF, 0xAB, 0xFF, 0xA8, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xD0,
-    0x2F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x06, 0xFF,
-    0xD5, 0x5B, 0xFE, 0x40, 0x0B, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xD0, 0x02,
-    0xFF, 0x40, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x90, 0x7F, 0xF4, 0x00, 0x04, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x0A, 0xAA, 0xAA, 0xBF, 0xF9, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x6B, 0xFF, 0xFF, 0xEA, 0xA4, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x6D, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF7, 0xF2,
-    0xF4, 0x07, 0xFF, 0x83, 0xE0, 0x10, 0x0F, 0xFE, 0x07, 0xE0, 0x00, 0x1F, 0xFC, 0x0B, 0xD0, 0x00,
-    0x3F, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0xE0, 0x0F, 0x80, 0x00, 0xBF,
-    0xD0, 0x1F, 0x40, 0x00, 0xFF, 0xD0, 0x2F, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xFF, 0xC0,
-    0x3F, 0x00, 0x00, 0xFF, 0xC0, 0x7E, 0x00, 0x00, 0xFF, 0xC0, 0xBD, 0x00, 0x00, 0xFF, 0xD0, 0xBC,
-    0x00, 0x00, 0xBF, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0xFC, 0x6C, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0A,
-    0xFF, 0xEA, 0xBF, 0xFA, 0xA0, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0xD0,
-    0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0xFF, 0x80, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x0B,
-    0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x1F, 0xF8, 0x03, 0xFF, 0xEF, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0x02,
-    0xFF, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x06, 0x90, 0x68, 0x1A, 0x0F, 0xF8, 0x03,
-    0xFE, 0x7F, 0xAF, 0xE3, 0xFE, 0x02, 0xDF, 0xFB, 0xFE, 0xFC, 0xFF, 0x40, 0xB7, 0xF4, 0xFD, 0x3F,
-    0x7F, 0xC0, 0x1F, 0xFC, 0x3F, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xEF, 0x87, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xEF, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xF0, 0xBD, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x29, 0x0A, 0x42, 0x90, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x05, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x54, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0xAA, 0x40, 0x6B, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x05, 0x56, 0xFF, 0x94, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x6F, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x06, 0x80, 0x00,
-    0x2F, 0xFB, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x68, 0x00, 0x53, 0xFF, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x40,
-    0x06, 0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x3F,
-    0xF0, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x2F, 0xF0, 0x03,
-    0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x0B, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x43, 0xE0,
-    0x00, 0x00, 0x0F, 0xF5, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xF8, 0x00,
-    0x01, 0xFD, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x40, 0x2F, 0x0B, 0x0D, 0x03, 0xD0, 0x0F, 0xCF, 0xEF,
-    0xC1, 0xF0, 0x03, 0xFF, 0xFF, 0xF9, 0xFC, 0x00, 0xFF, 0xDF, 0xEF, 0xFC, 0x00, 0x3F, 0x82, 0x82,
-    0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x14,
-    0x00, 0x06, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFE, 0x0F, 0xF8, 0x7F, 0xFC, 0x01, 0xFF, 0xC0,
-    0x7F, 0xD0, 0x3F, 0xF0, 0x0F, 0xFD, 0x01, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x0B, 0xFC, 0x02,
-    0xFF, 0x41, 0xFF, 0x40, 0x3F, 0xE0, 0x0B, 0xFC, 0x0B, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x3F,
-    0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02,
-    0xFF, 0xFE, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFD, 0x5B, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x80, 0x0B, 0xFC,
-    0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xBF, 0xE5, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xB8, 0x00, 0x00, 0x00,
-    0x0B, 0x83, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xF9, 0x7F, 0xF0,
-    0x00, 0xBF, 0xFF, 0xD0, 0xF0, 0x40, 0x07, 0xFF, 0x8F, 0x07, 0xC0, 0x00, 0x3F, 0xFC, 0x7C, 0x2E,
-    0x00, 0x00, 0xFF, 0xD2, 0xE0, 0xF4, 0x00, 0x07, 0xFF, 0x0F, 0x43, 0xD0, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE5, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x00, 0x0F, 0x4B, 0x80,
-    0x00, 0x0F, 0xFF, 0xBE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE5, 0xFF, 0xF4, 0x00, 0xFF, 0x40, 0xFF, 0xD0, 0x07, 0xFC, 0x03,
-    0xFF, 0x40, 0x2F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x03, 0xFE, 0x5B, 0xFF, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFE,
-    0xBF, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0x40, 0x7F, 0xE0, 0x0B, 0xFC, 0x01, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xF8, 0x03, 0xFE, 0x07, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x00, 0x2E, 0x1F, 0x00, 0x00,
-    0x00, 0x10, 0x10, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x06, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xC1, 0xA8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x0B, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF,
-    0x5B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x5B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t notosans_16_bolditalicBitmaps[46083] = {
+    0x85, 0x55, 0xBB, 0x8E, 0xE5, 0x44, 0x10, 0x2D, 0xDB, 0x20, 0x0B, 0x2C, 0xD1, 0x04, 0x4C, 0x02,
+    0x81, 0xBF, 0x00, 0xFC, 0x03, 0x48, 0xED, 0x85, 0x80, 0x80, 0x60, 0x36, 0x58, 0x22, 0x52, 0x62,
+    0xF6, 0x07, 0x90, 0xEC, 0x9D, 0x84, 0x90, 0x15, 0x3F, 0x40, 0x8A, 0xF8, 0x87, 0x91, 0x5B, 0x6C,
+    0xB0, 0xC1, 0x06, 0x18, 0x21, 0xB4, 0x21, 0x66, 0xC4, 0xAE, 0x04, 0xC9, 0xF4, 0x40, 0xAF, 0xA6,
+    0x11, 0x6D, 0x17, 0xE7, 0xF4, 0xF5, 0x5C, 0x34, 0x04, 0x60, 0xE9, 0xFA, 0xB6, 0xAB, 0xAB, 0xEB,
+    0x71, 0xEA, 0x54, 0xB5, 0xD8, 0x50, 0xE8, 0x5C, 0xAB, 0x74, 0x51, 0x74, 0xAE, 0x54, 0x4C, 0x92,
+    0x61, 0x29, 0xB4, 0x6F, 0x92, 0x58, 0x2F, 0x3A, 0x56, 0xAB, 0xB4, 0x5E, 0x06, 0x57, 0x6E, 0x52,
+    0xDC, 0x95, 0xFC, 0xD4, 0x11, 0x5B, 0xA5, 0xBA, 0x06, 0xDA, 0x41, 0x5E, 0x16, 0x69, 0x17, 0xFD,
+    0x30, 0xDA, 0x47, 0x6B, 0xEB, 0xB5, 0x8E, 0xF6, 0x6C, 0x6D, 0xE7, 0xA9, 0xF6, 0xF6, 0x2C, 0x99,
+    0xF9, 0xBC, 0xF2, 0x38, 0xD0, 0x8D, 0xE7, 0x22, 0x55, 0x34, 0xB3, 0x88, 0xBD, 0x93, 0x44, 0x1A,
+    0xDF, 0x39, 0x91, 0xAD, 0x0A, 0x22, 0x66, 0x1E, 0x44, 0x8A, 0xB5, 0x81, 0x0B, 0x55, 0xDD, 0x6A,
+    0xBC, 0x74, 0xE1, 0x72, 0x95, 0x26, 0xD8, 0xDB, 0x5A, 0x09, 0x5A, 0x96, 0x0A, 0x15, 0x5F, 0x3E,
+    0x1F, 0x28, 0x3E, 0x7E, 0x31, 0xFC, 0xD8, 0x8B, 0xDE, 0xD6, 0x92, 0xCE, 0x6D, 0x47, 0x8F, 0xEF,
+    0xA5, 0x1C, 0x35, 0x83, 0xAF, 0x61, 0x50, 0xDE, 0xC1, 0xEF, 0xAD, 0xAD, 0x97, 0x06, 0x36, 0x04,
+    0x36, 0x9C, 0xA1, 0xB7, 0xE1, 0xFA, 0x39, 0x72, 0x3A, 0x85, 0x38, 0xBD, 0x8B, 0xF3, 0x7F, 0xC2,
+    0xC8, 0xA0, 0xA3, 0x40, 0x21, 0xBF, 0x60, 0x68, 0xD2, 0x05, 0x1B, 0x87, 0xD5, 0x28, 0xD5, 0x53,
+    0x85, 0x47, 0x93, 0x5E, 0x91, 0xCF, 0x86, 0xC5, 0x7E, 0x79, 0xAD, 0x3D, 0x4C, 0x25, 0x46, 0x06,
+    0x5C, 0x34, 0x8A, 0xDC, 0xFF, 0x75, 0xF7, 0x25, 0x08, 0x4D, 0x2A, 0x27, 0xC7, 0x67, 0x9A, 0xA5,
+    0x8C, 0xD2, 0xC2, 0x52, 0x3B, 0xC3, 0xB4, 0x2B, 0x36, 0x31, 0x2B, 0xB0, 0x44, 0x76, 0xDF, 0xAE,
+    0x32, 0x49, 0xB9, 0x35, 0xA1, 0x0E, 0xC0, 0xD6, 0xCE, 0x76, 0x14, 0xEB, 0xB4, 0x42, 0x06, 0x78,
+    0x01, 0xB4, 0x2A, 0xB5, 0x3F, 0xAF, 0xAF, 0x3E, 0x34, 0x5E, 0x4F, 0x2F, 0xD4, 0xDB, 0xCB, 0xA4,
+    0x56, 0x97, 0x49, 0x9F, 0xFC, 0x0E, 0x33, 0x9A, 0x86, 0xD3, 0xA0, 0xFD, 0xA7, 0xEF, 0xC7, 0xE1,
+    0x6C, 0x15, 0xDA, 0x6A, 0x82, 0x94, 0xC9, 0x78, 0xC0, 0xD8, 0xCE, 0x30, 0x03, 0x30, 0x45, 0xEB,
+    0x04, 0x47, 0xB0, 0x35, 0xCB, 0xD4, 0x9B, 0x2B, 0xCD, 0xC5, 0xD4, 0x00, 0x2F, 0x4C, 0x97, 0x8E,
+    0x86, 0x90, 0x83, 0x7C, 0xE9, 0x18, 0x6E, 0xC9, 0xBC, 0xB1, 0x0B, 0x79, 0x45, 0xC8, 0xC4, 0x6E,
+    0x04, 0x41, 0x47, 0xA0, 0x50, 0xA7, 0x0A, 0x40, 0xB7, 0xBE, 0xC5, 0xE6, 0xE0, 0x14, 0x49, 0xEA,
+    0x57, 0x6B, 0xD6, 0x83, 0x46, 0x0D, 0x58, 0x79, 0xB0, 0xEF, 0xBC, 0xD1, 0xC4, 0x03, 0x9A, 0x9A,
+    0x64, 0xD4, 0x46, 0xBB, 0x0C, 0xDE, 0x5E, 0x6B, 0xA9, 0x3D, 0xCC, 0x1A, 0xE4, 0xAC, 0xCE, 0x06,
+    0xA1, 0x8E, 0xAF, 0x75, 0x2E, 0x59, 0x5E, 0x97, 0x8B, 0xEC, 0x40, 0x88, 0xBF, 0xB4, 0x2F, 0x75,
+    0x03, 0xD9, 0xE4, 0x84, 0xE1, 0xB4, 0x17, 0x9B, 0xFD, 0x21, 0xD9, 0xCF, 0xC3, 0xD0, 0xF8, 0x73,
+    0xA2, 0x89, 0xEA, 0x8F, 0x32, 0x8D, 0xF0, 0x2F, 0x76, 0x16, 0xBB, 0x90, 0xAF, 0x26, 0x22, 0x34,
+    0x41, 0x6C, 0x05, 0x8E, 0x4D, 0x8E, 0x52, 0x50, 0x15, 0xA2, 0x92, 0xDF, 0xA3, 0x74, 0x0B, 0x55,
+    0x18, 0xBB, 0xE6, 0x8F, 0x26, 0x66, 0x4D, 0xA0, 0x80, 0x2A, 0x94, 0xEB, 0xCD, 0x4A, 0xEE, 0xED,
+    0x18, 0xE0, 0x13, 0x55, 0xCA, 0x22, 0x96, 0x3D, 0x64, 0x23, 0x35, 0xD1, 0x72, 0xF9, 0xCF, 0xB2,
+    0x34, 0xC7, 0x2F, 0xFC, 0x35, 0x29, 0x9B, 0x86, 0x26, 0xED, 0x76, 0x5E, 0xD0, 0x47, 0x94, 0x9B,
+    0xDD, 0xD1, 0x4C, 0x8D, 0x7D, 0x05, 0x19, 0xBA, 0x4B, 0x4E, 0xFA, 0x1B, 0x9A, 0x42, 0x96, 0x5D,
+    0x55, 0x51, 0x5E, 0x93, 0x15, 0x25, 0xB2, 0x44, 0x74, 0x7C, 0x63, 0x02, 0x22, 0xEC, 0x93, 0x11,
+    0xA8, 0x2C, 0x8D, 0x7E, 0xFF, 0x49, 0xB3, 0x25, 0xD8, 0x19, 0x70, 0xDC, 0x20, 0x6D, 0x44, 0x50,
+    0x10, 0x8E, 0x5C, 0x3B, 0x9C, 0x65, 0xBD, 0x61, 0x0C, 0xFC, 0xC5, 0xEE, 0x8D, 0xA0, 0xFC, 0x66,
+    0xFA, 0xED, 0x6B, 0x42, 0xCB, 0x4E, 0xFA, 0x8E, 0x7D, 0xF4, 0x6F, 0x8D, 0x7F, 0x8E, 0xB0, 0xE1,
+    0x51, 0x23, 0x75, 0xC3, 0x8C, 0x12, 0x06, 0x14, 0x3B, 0x01, 0x85, 0x13, 0x76, 0xC1, 0x1F, 0xBA,
+    0x59, 0x7D, 0x9A, 0x0B, 0x8C, 0xBC, 0x3E, 0xD0, 0x2E, 0x4D, 0x57, 0xDA, 0xE7, 0x01, 0x41, 0x2E,
+    0x30, 0xF7, 0x0C, 0x05, 0x91, 0xCF, 0xA0, 0x33, 0xCB, 0x5C, 0x8A, 0x8C, 0x04, 0x11, 0x41, 0xFA,
+    0xFD, 0x2E, 0x1E, 0x28, 0xDE, 0x76, 0xB1, 0x50, 0xDC, 0xA4, 0x1D, 0x87, 0x4A, 0xFF, 0xC3, 0x64,
+    0x90, 0x5B, 0x4F, 0x47, 0x2E, 0x82, 0x45, 0x80, 0xC7, 0x17, 0x48, 0xAD, 0xB7, 0xB1, 0x8B, 0x20,
+    0x0E, 0x7A, 0xC3, 0x99, 0xD4, 0x62, 0xC2, 0x3D, 0xD2, 0xDE, 0x24, 0xCE, 0xB5, 0xC7, 0x9C, 0x74,
+    0xD3, 0x22, 0xFA, 0x04, 0xF3, 0x2D, 0xAA, 0x2B, 0xF5, 0x0B, 0x0C, 0xBC, 0x40, 0xDA, 0xE5, 0x09,
+    0x88, 0x03, 0xAB, 0x49, 0x85, 0xBA, 0x69, 0x19, 0x02, 0xEC, 0x6D, 0x9C, 0x3C, 0x4E, 0x08, 0x57,
+    0xC9, 0x4E, 0x38, 0xCC, 0x42, 0x30, 0xAD, 0x82, 0x74, 0x52, 0xB8, 0x8D, 0xA0, 0xED, 0x8C, 0xE2,
+    0x94, 0x7A, 0x09, 0x9C, 0xEC, 0x52, 0x3F, 0x40, 0x1E, 0x0D, 0xA9, 0x44, 0xD2, 0x80, 0x18, 0xDB,
+    0x21, 0x0F, 0x40, 0xC0, 0x9C, 0x0C, 0x79, 0xB2, 0x10, 0xDE, 0xBC, 0xCC, 0x4A, 0x63, 0x56, 0xEA,
+    0xC2, 0xB1, 0xF1, 0x22, 0x67, 0x0D, 0x1A, 0x56, 0xD9, 0x1A, 0x0A, 0xBF, 0x7A, 0x47, 0x97, 0x02,
+    0xE3, 0xD9, 0x15, 0x3B, 0x30, 0xF1, 0x30, 0x4F, 0x90, 0x32, 0x81, 0xC9, 0x2D, 0x0A, 0x98, 0x6C,
+    0xDC, 0x17, 0x43, 0xE4, 0x16, 0xF0, 0x9C, 0xB0, 0xC5, 0x16, 0x92, 0x09, 0x8E, 0x0C, 0x25, 0x37,
+    0xE3, 0x36, 0xB4, 0xEC, 0xB3, 0x4C, 0xAD, 0xC3, 0x73, 0x1F, 0x07, 0x91, 0x47, 0x9F, 0xBD, 0x42,
+    0xBE, 0x54, 0x8B, 0x51, 0x79, 0x3D, 0x87, 0x98, 0x9D, 0x22, 0xEC, 0x1C, 0x73, 0x03, 0x33, 0x6C,
+    0xF4, 0x56, 0x1F, 0x22, 0x56, 0xEC, 0xBC, 0x39, 0xE5, 0x86, 0xF7, 0x99, 0x35, 0x87, 0x6C, 0xF3,
+    0xC2, 0x86, 0x5F, 0xA0, 0x64, 0xB6, 0x49, 0x67, 0xB8, 0x89, 0x79, 0xDE, 0x76, 0x80, 0xF4, 0xE6,
+    0x46, 0xC9, 0x59, 0x70, 0xCA, 0x1C, 0x02, 0x5B, 0x69, 0xDA, 0x33, 0x75, 0xA0, 0x46, 0x35, 0xFB,
+    0x53, 0x00, 0x3D, 0xD8, 0xDF, 0x17, 0x0A, 0x8B, 0xF0, 0xDD, 0x79, 0x0B, 0x14, 0x40, 0x20, 0x13,
+    0x1A, 0x4E, 0x16, 0xEB, 0x1B, 0xDE, 0x19, 0xE4, 0x74, 0x20, 0xB9, 0x1F, 0x6B, 0xCE, 0xA7, 0x3A,
+    0x12, 0x6F, 0x98, 0xF7, 0x58, 0x48, 0x2C, 0xC3, 0x32, 0x22, 0x45, 0xC7, 0x49, 0xC3, 0x2F, 0xCC,
+    0xC0, 0x67, 0x1F, 0xF5, 0x6C, 0xC7, 0x9D, 0x78, 0xCB, 0xCE, 0xCE, 0x26, 0xBB, 0xE7, 0x1D, 0x00,
+    0xCD, 0x31, 0xAB, 0x17, 0xD2, 0x31, 0x4B, 0x9B, 0x91, 0x5F, 0x76, 0xAB, 0xE6, 0x90, 0xF8, 0xDB,
+    0x38, 0x30, 0x02, 0xB2, 0x44, 0xCD, 0xB9, 0x61, 0x9E, 0x80, 0xB8, 0xDF, 0x27, 0x57, 0x7E, 0x0A,
+    0x58, 0xC4, 0x2E, 0x98, 0x87, 0x4D, 0x9B, 0x6F, 0x9F, 0x11, 0x02, 0x77, 0xA0, 0x40, 0xF6, 0xAE,
+    0x0F, 0xEE, 0x4A, 0x7B, 0xA5, 0xB8, 0x8E, 0x38, 0x17, 0x51, 0xA6, 0x4A, 0x5F, 0xE0, 0xBA, 0x8B,
+    0x95, 0xA2, 0xCA, 0xD6, 0x4F, 0xB8, 0xA6, 0xC1, 0xAB, 0xC3, 0xA2, 0xC6, 0xF0, 0x9C, 0xAD, 0x6F,
+    0x71, 0xF3, 0x5C, 0xEA, 0xD8, 0x32, 0xB1, 0x49, 0x39, 0x63, 0x18, 0xD0, 0x3D, 0xF9, 0xDF, 0xE7,
+    0x6F, 0x85, 0x55, 0xB1, 0x72, 0xE4, 0x44, 0x10, 0x6D, 0x49, 0xF8, 0x14, 0x6C, 0xA0, 0x0B, 0x20,
+    0xE0, 0x08, 0x94, 0x93, 0xE8, 0x0B, 0x60, 0xA6, 0xEC, 0xE0, 0x42, 0x36, 0xB8, 0x8D, 0x2E, 0x20,
+    0x3F, 0x82, 0xFD, 0x04, 0x2D, 0xA4, 0x04, 0x38, 0xE1, 0x23, 0xD8, 0x84, 0x3F, 0x60, 0x44, 0xF1,
+    0x01, 0x27, 0x02, 0x72, 0x55, 0xE1, 0xE4, 0x9C, 0x30, 0x55, 0xAC, 0xAB, 0xC6, 0x46, 0x52, 0xF3,
+    0x5E, 0x6B, 0xF7, 0xEC, 0xBB, 0x73, 0xC1, 0x96, 0x35, 0xB2, 0x5A, 0xD3, 0xFD, 0xBA, 0x5F, 0xBF,
+    0x1E, 0x15, 0xAA, 0x9A, 0x6A, 0x2C, 0x43, 0xC0, 0x72, 0x81, 0x6B, 0x3C, 0xDB, 0x6C, 0xB4, 0x17,
+    0x29, 0x55, 0x44, 0xDC, 0x41, 0x24, 0xD7, 0x9D, 0x48, 0x35, 0xE2, 0xE9, 0x43, 0x73, 0x6D, 0xE6,
+    0x41, 0x64, 0x75, 0x6F, 0xEE, 0x1E, 0x33, 0x17, 0x6F, 0xCD, 0xCB, 0xEF, 0x89, 0xC2, 0x18, 0x34,
+    0x61, 0x07, 0x96, 0xF6, 0x4E, 0x63, 0xA1, 0x88, 0x5F, 0xA5, 0x4C, 0xBD, 0x1B, 0xCA, 0x51, 0xB4,
+    0x73, 0x31, 0xD7, 0x73, 0xF5, 0x85, 0x86, 0x04, 0x54, 0xF5, 0x52, 0x21, 0x62, 0xAE, 0x48, 0xC2,
+    0xCD, 0xDA, 0x17, 0xFA, 0xAD, 0x76, 0x4D, 0x42, 0x16, 0xDA, 0x15, 0x33, 0x9C, 0xAB, 0x11, 0x39,
+    0xBA, 0xC1, 0x1D, 0x72, 0xF5, 0xE1, 0xB6, 0x45, 0x04, 0x6C, 0xCD, 0x54, 0x27, 0xE2, 0x20, 0xD5,
+    0x33, 0x7F, 0x84, 0xCE, 0x01, 0x8D, 0x78, 0x3B, 0x22, 0xE3, 0xAE, 0x05, 0x42, 0xFC, 0xAE, 0x5D,
+    0x9D, 0x42, 0x5F, 0xCC, 0x2E, 0x8A, 0xBE, 0x1E, 0xA5, 0xFD, 0x53, 0xA5, 0x49, 0x30, 0xCE, 0xCD,
+    0xB4, 0xD5, 0xE7, 0x0C, 0xA5, 0xFA, 0x57, 0xAC, 0xF8, 0xEE, 0xD5, 0xF3, 0x89, 0xF5, 0x88, 0x64,
+    0x0C, 0x8B, 0xBA, 0x72, 0x1D, 0x9A, 0x9F, 0x35, 0x22, 0x1E, 0x32, 0x46, 0x8E, 0x06, 0xF7, 0x82,
+    0x50, 0x9F, 0x22, 0x2B, 0x10, 0xD2, 0x60, 0xD9, 0x55, 0x83, 0x3C, 0xF2, 0xAB, 0x7B, 0x10, 0x1A,
+    0xE0, 0x2B, 0x6D, 0x2F, 0x6B, 0xC4, 0xBC, 0x24, 0xD5, 0xCD, 0xF2, 0x97, 0xE4, 0x71, 0xA7, 0xB7,
+    0x85, 0x48, 0x31, 0x4B, 0x39, 0x49, 0x95, 0xA4, 0x8E, 0xD2, 0x0C, 0xE2, 0x3A, 0x69, 0xBD, 0x7C,
+    0xB2, 0xBC, 0x46, 0x12, 0x79, 0x44, 0x0B, 0x40, 0x7A, 0x83, 0x6C, 0xC3, 0xEC, 0x73, 0xE3, 0x7B,
+    0xC0, 0xE3, 0x4E, 0x1C, 0x8A, 0xA8, 0xAC, 0x90, 0x5B, 0x64, 0xC1, 0x6E, 0x34, 0x6C, 0x58, 0x00,
+    0xBD, 0x99, 0x8E, 0x6C, 0x10, 0x42, 0xAC, 0xD0, 0x34, 0x79, 0xFA, 0xF9, 0x7E, 0xBF, 0xFF, 0x01,
+    0x14, 0xFC, 0x4D, 0x75, 0xE0, 0xD2, 0x53, 0x02, 0xD9, 0x66, 0xB3, 0x79, 0x41, 0x83, 0xC3, 0xF5,
+    0x1A, 0x57, 0xA4, 0xF5, 0x29, 0xAE, 0x0A, 0x64, 0x17, 0x13, 0x45, 0x70, 0x60, 0x74, 0xE8, 0xA6,
+    0x45, 0x03, 0xB3, 0x30, 0x2D, 0xF4, 0x23, 0x0B, 0x44, 0x0E, 0x11, 0x7D, 0x48, 0xC4, 0xCD, 0x02,
+    0xDB, 0x31, 0x21, 0x99, 0x2B, 0xB8, 0x20, 0xF1, 0x2F, 0xE0, 0xFA, 0xD1, 0x03, 0xAD, 0xA0, 0x8F,
+    0x63, 0xB5, 0x28, 0x35, 0x7E, 0x09, 0x9D, 0x78, 0xC8, 0x44, 0x56, 0x88, 0xE6, 0x18, 0xC3, 0x0B,
+    0x24, 0x52, 0xC1, 0x0F, 0xA1, 0xA9, 0x38, 0x37, 0xA0, 0x06, 0x80, 0xA4, 0x77, 0xA9, 0x1E, 0xAC,
+    0x5B, 0xDC, 0x4E, 0x21, 0x3A, 0x24, 0xF5, 0xF1, 0xF2, 0xE6, 0x9B, 0x37, 0xF6, 0x5E, 0x99, 0x19,
+    0x90, 0x74, 0x46, 0x01, 0xFA, 0xE3, 0x4B, 0x6C, 0xA6, 0x74, 0xDB, 0xC1, 0x52, 0xAA, 0x62, 0x3E,
+    0xCB, 0xD9, 0xBA, 0x4C, 0x25, 0x34, 0xAA, 0x17, 0x63, 0x05, 0x35, 0xE8, 0xF9, 0x58, 0xF7, 0xEE,
+    0x4E, 0xB3, 0xB1, 0xE9, 0xC2, 0x2E, 0x64, 0xA3, 0xDB, 0xA9, 0xCC, 0xB8, 0x9D, 0x4F, 0x32, 0xE5,
+    0x63, 0x7B, 0x31, 0x66, 0x63, 0x31, 0xB6, 0x45, 0x2A, 0xC6, 0x22, 0xF1, 0x96, 0x56, 0x11, 0xB7,
+    0x2A, 0xD5, 0x43, 0x7B, 0x31, 0x6F, 0xA7, 0xD0, 0xB9, 0xEF, 0x74, 0x86, 0xB6, 0x5D, 0x17, 0x0E,
+    0x60, 0xBD, 0xE9, 0x9F, 0xED, 0x9E, 0x41, 0x01, 0xC6, 0xA3, 0xD5, 0x27, 0xEC, 0x50, 0x9F, 0xFD,
+    0x22, 0x6C, 0x0D, 0x13, 0x63, 0x9A, 0xB4, 0x67, 0x61, 0xBE, 0x7C, 0x58, 0x5D, 0x38, 0x70, 0xD2,
+    0xB8, 0xA1, 0xB1, 0x51, 0x63, 0x2F, 0xAA, 0x7F, 0x50, 0x67, 0x39, 0x81, 0x0A, 0x08, 0xBB, 0x43,
+    0x69, 0x5F, 0x61, 0x93, 0xFE, 0x06, 0xF7, 0xB6, 0x07, 0x0B, 0x2E, 0x82, 0xA8, 0xFA, 0x00, 0x9A,
+    0xA8, 0x52, 0x0A, 0x29, 0x74, 0x85, 0x2E, 0x2A, 0x56, 0x9B, 0x1F, 0x25, 0xA8, 0xF6, 0xEE, 0x66,
+    0xB3, 0x3D, 0x34, 0x07, 0x74, 0x94, 0xC7, 0x80, 0x7E, 0x4F, 0xDE, 0x31, 0x20, 0x52, 0xCD, 0x88,
+    0xC2, 0xD1, 0xD3, 0x3B, 0xCF, 0x91, 0x9A, 0x38, 0x9E, 0x68, 0xB6, 0xB9, 0xBB, 0x9B, 0xAF, 0xD5,
+    0x63, 0xBF, 0xF6, 0xE5, 0x2C, 0x36, 0x95, 0x7C, 0xE8, 0xF8, 0x70, 0xF3, 0x52, 0x59, 0xC6, 0x4C,
+    0x9F, 0x64, 0x3E, 0x68, 0xDD, 0x75, 0x80, 0x0F, 0x4E, 0x01, 0x5F, 0xE3, 0x3C, 0x18, 0x50, 0x7B,
+    0x9D, 0x10, 0x1A, 0xDB, 0x31, 0xDF, 0x20, 0x28, 0x96, 0x98, 0x46, 0x9E, 0x53, 0x2B, 0x2E, 0xC5,
+    0x11, 0x67, 0x3E, 0x0D, 0x35, 0x42, 0xDD, 0x1E, 0x5B, 0xE8, 0x98, 0x08, 0x15, 0x49, 0x9D, 0x6F,
+    0x7D, 0x0D, 0x4E, 0x7C, 0xA5, 0x72, 0x3C, 0xBA, 0x0A, 0xF6, 0x92, 0x3A, 0xB0, 0xC6, 0x82, 0x2D,
+    0xF2, 0xC6, 0x41, 0xB0, 0x91, 0x3E, 0xBE, 0x71, 0xF1, 0xDE, 0xC8, 0xED, 0xC1, 0x9E, 0xD5, 0x7F,
+    0xE6, 0x17, 0x60, 0x47, 0x9C, 0xC2, 0x1A, 0xD1, 0x10, 0x77, 0x19, 0xB9, 0x4A, 0xDF, 0x98, 0x7E,
+    0x66, 0x5A, 0xC1, 0x80, 0x71, 0x89, 0x6A, 0xB7, 0xBA, 0x43, 0x6C, 0x37, 0x9A, 0x92, 0x3A, 0x54,
+    0x86, 0xC8, 0x80, 0x09, 0x3D, 0x08, 0x59, 0xCD, 0x19, 0xFF, 0x1D, 0x50, 0xF4, 0x6A, 0x02, 0x47,
+    0xA0, 0x0B, 0xE0, 0xD5, 0x08, 0x07, 0xBC, 0x80, 0x83, 0x4B, 0x70, 0x28, 0x79, 0x36, 0x66, 0x3A,
+    0xC0, 0x81, 0x07, 0xDB, 0xAF, 0x18, 0x26, 0x72, 0xD1, 0x93, 0x3A, 0x2B, 0x38, 0x11, 0xEC, 0xCA,
+    0x72, 0x00, 0x70, 0xCD, 0xA5, 0xA1, 0xD5, 0x5E, 0xA1, 0x7D, 0xEB, 0xA5, 0x24, 0xAB, 0x38, 0xF4,
+    0xA7, 0x32, 0xF5, 0x8F, 0x8D, 0xA7, 0xDE, 0x77, 0x5C, 0x3C, 0x83, 0x21, 0xCC, 0x7E, 0xBF, 0x30,
+    0x51, 0xCE, 0x27, 0x09, 0x1A, 0x11, 0xF6, 0x01, 0xB0, 0xE5, 0xFD, 0xE8, 0x36, 0x36, 0x1F, 0xE2,
+    0x1E, 0xFE, 0x03, 0xB7, 0x23, 0x4F, 0xD7, 0x7B, 0x1B, 0x36, 0x39, 0xE2, 0x2E, 0xE0, 0x3F, 0x3D,
+    0xC4, 0x1D, 0xDF, 0xC5, 0x4D, 0xA7, 0x76, 0x59, 0x4C, 0x17, 0xEF, 0xC5, 0x8F, 0xF3, 0xE3, 0xD2,
+    0x82, 0xF5, 0x14, 0xAC, 0xE5, 0xC0, 0x03, 0xE5, 0xEA, 0x49, 0xCC, 0x90, 0x47, 0x46, 0xEE, 0xC5,
+    0x06, 0x7F, 0xF9, 0x2A, 0x2D, 0xF1, 0xC0, 0xEF, 0xD9, 0x66, 0xDD, 0x40, 0x65, 0xF8, 0xEE, 0x79,
+    0xA7, 0x91, 0xEA, 0xC3, 0xD7, 0x40, 0x5E, 0xE9, 0x80, 0xE0, 0xAB, 0xA9, 0x60, 0x3B, 0x3A, 0xB7,
+    0x8C, 0x47, 0x87, 0x7F, 0xA1, 0x00, 0x9C, 0xC9, 0x1C, 0x09, 0xBF, 0xF4, 0xB6, 0xB2, 0xC3, 0xB0,
+    0x36, 0x19, 0x66, 0x6B, 0x06, 0x4E, 0x1C, 0xA3, 0x3A, 0xD9, 0x21, 0x7E, 0xE0, 0xEA, 0x96, 0x35,
+    0xD2, 0x88, 0x15, 0x46, 0x36, 0x35, 0x92, 0x0D, 0x7E, 0x6B, 0x3A, 0x13, 0xC5, 0xF5, 0x3E, 0x0C,
+    0x4C, 0xDF, 0x3E, 0x58, 0xAA, 0x5D, 0x6E, 0x2B, 0x31, 0x4C, 0x3A, 0xD0, 0x05, 0x58, 0x41, 0x3A,
+    0xAB, 0xC9, 0xC6, 0x6D, 0x59, 0x47, 0x52, 0x45, 0x09, 0xBD, 0x07, 0x18, 0xEF, 0x01, 0xFF, 0xFF,
+    0xF7, 0x2F, 0xD5, 0x55, 0xBD, 0xAE, 0xDE, 0x54, 0x10, 0x5C, 0xDB, 0x52, 0xBE, 0xC2, 0xC5, 0x69,
+    0xA0, 0x4A, 0xE1, 0x47, 0xF0, 0x23, 0x1C, 0x77, 0x14, 0x14, 0x50, 0x40, 0x7D, 0xDF, 0x80, 0xD4,
+    0xA9, 0x8E, 0x79, 0x18, 0x1A, 0x28, 0x78, 0x04, 0x3B, 0xA2, 0xA0, 0xC4, 0x40, 0x49, 0x81, 0x21,
+    0x48, 0x28, 0x4A, 0x71, 0x8F, 0x22, 0x13, 0xF9, 0x82, 0xED, 0x61, 0x66, 0xFD, 0xE5, 0x8F, 0xA4,
+    0x49, 0xC9, 0x27, 0xF9, 0x5C, 0xFB, 0x7A, 0x7F, 0x66, 0x67, 0x67, 0xD7, 0x16, 0xB1, 0x9B, 0xAE,
+    0x84, 0xCD, 0x5A, 0xFC, 0x61, 0x15, 0xCC, 0x2E, 0x87, 0x59, 0xBD, 0xF3, 0xDA, 0xCC, 0xC2, 0xF5,
+    0x6A, 0x56, 0xB3, 0x76, 0x31, 0x8B, 0xF9, 0xD5, 0x95, 0x66, 0xB3, 0x61, 0x32, 0xC3, 0xE8, 0x57,
+    0x81, 0xDE, 0x6A, 0xCC, 0x1E, 0x6A, 0xE0, 0x05, 0xD0, 0x87, 0x16, 0xE3, 0x19, 0xC1, 0xCD, 0x14,
+    0xA6, 0x44, 0x77, 0xFA, 0x2B, 0x97, 0xA5, 0x7C, 0x26, 0xF4, 0x48, 0xFF, 0xB1, 0xEB, 0x69, 0xB7,
+    0x5C, 0xED, 0xE2, 0xBB, 0xED, 0x78, 0xA3, 0xBC, 0x8E, 0xCD, 0xED, 0x86, 0x6C, 0x1F, 0x3C, 0xD8,
+    0x79, 0xCF, 0xD7, 0x09, 0xD9, 0x2E, 0x2C, 0xCE, 0xE2, 0x9D, 0x5D, 0x7F, 0x61, 0xB5, 0x76, 0x53,
+    0xF8, 0xB4, 0xD0, 0xA7, 0x20, 0xDC, 0x98, 0x2B, 0x06, 0x88, 0x39, 0xD0, 0x3B, 0xCE, 0x91, 0x01,
+    0xD3, 0xC4, 0x20, 0x36, 0xFC, 0x08, 0xD5, 0xF6, 0xBD, 0xD0, 0xE2, 0x87, 0x43, 0x79, 0xBE, 0x5D,
+    0x75, 0x32, 0x28, 0xB1, 0xC1, 0x0B, 0x50, 0x89, 0x15, 0x6E, 0x37, 0x61, 0x0B, 0xA2, 0x6C, 0xAF,
+    0x0F, 0xC1, 0xBB, 0x40, 0x67, 0x45, 0xDF, 0xB0, 0x95, 0x44, 0xC2, 0x84, 0x3C, 0x09, 0xD2, 0x13,
+    0xAA, 0x68, 0x9E, 0xAA, 0x8D, 0x78, 0xDE, 0xE6, 0x76, 0x7E, 0x27, 0xB7, 0x05, 0xA3, 0x89, 0x3B,
+    0x95, 0xF9, 0x7A, 0x9B, 0xC2, 0xEB, 0x6D, 0x02, 0xB6, 0x96, 0xA8, 0x22, 0xB0, 0xE8, 0xB2, 0x40,
+    0x87, 0x0B, 0xA6, 0x42, 0x40, 0xBD, 0xC5, 0x3D, 0xAF, 0xB1, 0xE2, 0x63, 0xC5, 0xC7, 0xC8, 0xC7,
+    0x01, 0xBD, 0x6E, 0x03, 0x8D, 0x13, 0xC6, 0xF2, 0x80, 0xD5, 0xFF, 0xF0, 0xCD, 0x6D, 0x36, 0xA4,
+    0xB1, 0x7E, 0x7E, 0x58, 0x78, 0xCE, 0x5E, 0xC6, 0xB9, 0x40, 0x3B, 0xB6, 0x3F, 0xEF, 0xD6, 0x3C,
+    0xDB, 0xAA, 0x2D, 0x8D, 0x25, 0x1F, 0x87, 0x8F, 0x69, 0xF8, 0xFB, 0x1E, 0x32, 0x43, 0xEC, 0xCD,
+    0x4F, 0x7B, 0x60, 0x88, 0x47, 0x7B, 0x7C, 0x84, 0xAE, 0xDE, 0x9A, 0x5F, 0x96, 0x96, 0x21, 0xBE,
+    0x3C, 0x50, 0xC2, 0xC2, 0x12, 0x30, 0xB1, 0x2C, 0x74, 0xD8, 0x2A, 0x86, 0x20, 0xD9, 0x9D, 0x42,
+    0x18, 0x32, 0x45, 0x16, 0x67, 0x52, 0x47, 0x50, 0x3A, 0xC4, 0x47, 0x60, 0x61, 0x91, 0x90, 0xD9,
+    0x3C, 0x21, 0xEE, 0x28, 0x21, 0x01, 0xE6, 0xAB, 0x48, 0x2A, 0xD0, 0xAB, 0xA5, 0x8D, 0xD0, 0x12,
+    0x93, 0xD5, 0x7F, 0xC3, 0x94, 0xE8, 0x66, 0xA9, 0x08, 0x75, 0x41, 0x2F, 0xCF, 0x7A, 0x93, 0x67,
+    0x66, 0x23, 0x99, 0xA4, 0x3A, 0x82, 0x72, 0xB4, 0x8E, 0xB2, 0xC0, 0x27, 0xF4, 0x1C, 0xC3, 0x1D,
+    0x24, 0x6F, 0xFC, 0x4A, 0xCF, 0xF1, 0x02, 0x9C, 0xC1, 0x05, 0xB0, 0x52, 0xF0, 0x4C, 0x22, 0x05,
+    0x4F, 0x94, 0x11, 0x76, 0xA0, 0x27, 0x31, 0x0D, 0xCB, 0x0B, 0x15, 0x31, 0x37, 0x55, 0xD1, 0x4A,
+    0x63, 0xD4, 0x00, 0xCF, 0xA8, 0xB3, 0xC2, 0xD2, 0xA0, 0x6B, 0x08, 0x03, 0xEA, 0x73, 0xB3, 0xD5,
+    0x92, 0x54, 0x56, 0x9B, 0x31, 0xB9, 0xE9, 0x47, 0x92, 0xC5, 0xDE, 0xAE, 0xFA, 0xB7, 0xAB, 0xEB,
+    0x3B, 0xF5, 0x11, 0xEA, 0x5C, 0xBB, 0xAA, 0xF5, 0xB4, 0x9B, 0x38, 0x44, 0xAE, 0xC8, 0x95, 0xEE,
+    0x15, 0x19, 0x21, 0x55, 0xBB, 0x72, 0x49, 0x3A, 0x80, 0xB8, 0x81, 0x7C, 0x1B, 0x38, 0x9C, 0x4F,
+    0x5D, 0xD5, 0xB8, 0x53, 0x1C, 0x92, 0x54, 0x3A, 0x1C, 0xE8, 0x36, 0xFE, 0x75, 0x03, 0x89, 0x02,
+    0x13, 0x95, 0xD2, 0x2E, 0x94, 0x4E, 0x2D, 0x86, 0xF9, 0x37, 0xAA, 0xEA, 0x66, 0x25, 0xC3, 0x17,
+    0x7C, 0x83, 0xA5, 0x74, 0x73, 0x48, 0x2E, 0x51, 0x59, 0x9A, 0xE3, 0xAB, 0x53, 0x59, 0xE7, 0x44,
+    0xB9, 0x06, 0x5D, 0x98, 0xAE, 0xD4, 0xB7, 0xDE, 0xBC, 0x1F, 0x27, 0x97, 0x93, 0x93, 0xF5, 0xBD,
+    0x38, 0x19, 0x9D, 0x93, 0x8E, 0x43, 0xFB, 0x92, 0x93, 0xE1, 0xE4, 0x64, 0x52, 0x9A, 0xDD, 0x39,
+    0xD1, 0x3A, 0x80, 0x16, 0x43, 0x91, 0x7C, 0xF1, 0x44, 0xE7, 0x47, 0xA3, 0x6C, 0x4A, 0xAD, 0xA1,
+    0x15, 0xDC, 0xF2, 0xEB, 0x5E, 0x84, 0x3D, 0xF1, 0x61, 0x99, 0x14, 0xC4, 0xCB, 0x66, 0xA3, 0xF3,
+    0x83, 0x83, 0x07, 0x07, 0x38, 0xCD, 0x44, 0x39, 0x88, 0x36, 0x8C, 0xB5, 0x8E, 0x40, 0xDD, 0x8C,
+    0x69, 0xE3, 0xEC, 0x23, 0x97, 0x67, 0x59, 0xF0, 0x1D, 0xB3, 0x71, 0x0A, 0xC9, 0x47, 0xBD, 0xD3,
+    0x21, 0xEC, 0x15, 0x7C, 0xDC, 0xFB, 0x40, 0xCB, 0x51, 0x23, 0x3F, 0x71, 0xAC, 0x87, 0xAC, 0x51,
+    0xF7, 0x63, 0x3D, 0x89, 0xBA, 0xA7, 0x61, 0x1C, 0x24, 0x3A, 0xF1, 0x3E, 0x78, 0xB8, 0xFE, 0x0B,
+    0xDF, 0x65, 0x36, 0xCC, 0xD7, 0xC5, 0x27, 0x9E, 0x7C, 0x7A, 0x7D, 0x66, 0x5D, 0xF9, 0xE7, 0xE1,
+    0x8F, 0x8D, 0xDE, 0x36, 0xFB, 0x8B, 0x2A, 0xB5, 0x29, 0x98, 0xFC, 0x21, 0x77, 0x9B, 0x30, 0x12,
+    0x3E, 0xA3, 0x37, 0xEA, 0xE5, 0x7D, 0x29, 0xC3, 0x3E, 0x33, 0xAF, 0x16, 0x99, 0xC9, 0xC8, 0x2F,
+    0x55, 0x14, 0xD4, 0xEE, 0x0F, 0x6F, 0x8E, 0xCF, 0xBB, 0xB3, 0xB3, 0x8A, 0xEC, 0x3D, 0xF5, 0x16,
+    0x5F, 0xE3, 0x5D, 0x17, 0x6D, 0xCA, 0x57, 0x4C, 0xDE, 0xF9, 0x97, 0xE6, 0xBE, 0x8D, 0xD5, 0x37,
+    0xC3, 0x9B, 0xE6, 0xF3, 0x75, 0xC7, 0x6B, 0x69, 0x0D, 0x23, 0x29, 0x38, 0x37, 0x21, 0x46, 0xBA,
+    0x36, 0x2B, 0x0D, 0xF9, 0x36, 0x69, 0x0F, 0xD6, 0xE2, 0x50, 0xB1, 0x52, 0x0E, 0x62, 0x92, 0xAC,
+    0x31, 0x35, 0x43, 0x8A, 0xC5, 0x37, 0x1D, 0x7A, 0x39, 0x2C, 0x6C, 0x46, 0xA5, 0xCE, 0xD0, 0x41,
+    0xAC, 0x1F, 0xA4, 0xAB, 0xD0, 0xFC, 0x76, 0x69, 0x75, 0xB9, 0xB9, 0xFC, 0x35, 0x40, 0x9A, 0x8D,
+    0xC6, 0xBF, 0x3F, 0x85, 0x06, 0x44, 0x5F, 0xA6, 0x9D, 0xC1, 0xC3, 0xE6, 0x5B, 0x98, 0x9F, 0xA4,
+    0x98, 0x07, 0xE5, 0xE2, 0xC1, 0xC6, 0x6A, 0x26, 0x12, 0x9B, 0xC0, 0xCD, 0xCF, 0xB0, 0x71, 0xD2,
+    0xBE, 0x50, 0xEB, 0xE2, 0xA4, 0xAE, 0xCD, 0x89, 0x22, 0x9B, 0x25, 0xE8, 0xDF, 0x08, 0xAA, 0x7D,
+    0xCC, 0x42, 0xDB, 0x3F, 0xC9, 0x44, 0xFB, 0x54, 0x0B, 0xF7, 0xD6, 0x33, 0x65, 0xF5, 0x4A, 0x1F,
+    0x26, 0x11, 0xE3, 0x5D, 0x0B, 0xB0, 0xFF, 0xC1, 0xEF, 0x5F, 0xA5, 0x55, 0xB1, 0xAE, 0xDD, 0x44,
+    0x10, 0x1D, 0xDB, 0x3C, 0xB9, 0x70, 0xE1, 0x86, 0x14, 0x11, 0xC5, 0xF6, 0xA4, 0xF0, 0x27, 0xAC,
+    0xE1, 0x0B, 0x28, 0x72, 0x25, 0xF8, 0x00, 0x0A, 0xAA, 0x34, 0xF4, 0x6B, 0x94, 0x82, 0x96, 0x22,
+    0x7D, 0x28, 0x52, 0x20, 0x1A, 0xFE, 0x80, 0x35, 0xA4, 0x48, 0x91, 0x22, 0x96, 0x28, 0x29, 0x70,
+    0x1A, 0x28, 0x28, 0x62, 0x21, 0x2B, 0xD9, 0xBC, 0xD8, 0x3B, 0x9C, 0x33, 0xBE, 0x41, 0xEF, 0x0A,
+    0x45, 0x42, 0xE2, 0x49, 0x6F, 0xF2, 0xBC, 0x33, 0x3B, 0x73, 0xE6, 0xEC, 0x99, 0x89, 0x0E, 0x12,
+    0x46, 0xF1, 0x2F, 0x92, 0xB4, 0x9B, 0x34, 0xBB, 0x0E, 0x85, 0x8E, 0xA2, 0xCF, 0x92, 0xF8, 0x4D,
+    0xDC, 0xAA, 0x43, 0xA5, 0x63, 0xA5, 0x6D, 0x92, 0xB8, 0x49, 0x98, 0x75, 0x68, 0x75, 0x6A, 0xB6,
+    0x36, 0x95, 0xBA, 0x8B, 0x0E, 0x71, 0xF0, 0x2F, 0xA6, 0x6E, 0x6D, 0x52, 0x7D, 0xBD, 0x57, 0x2A,
+    0x71, 0xD4, 0x6E, 0x0A, 0xF0, 0xBB, 0xBF, 0x76, 0x24, 0x8B, 0x8F, 0xF7, 0x6E, 0xD2, 0xBE, 0xD9,
+    0xC2, 0x4F, 0x7B, 0xB7, 0x48, 0x7C, 0x9A, 0xDC, 0x2F, 0x59, 0x9A, 0xA4, 0xC5, 0x8E, 0x8A, 0xF1,
+    0xE1, 0xEC, 0x7E, 0x4B, 0x52, 0xBF, 0xD9, 0x8A, 0x5D, 0x7B, 0x09, 0x3A, 0x38, 0x5D, 0xA4, 0xD6,
+    0xB5, 0x40, 0x6A, 0x7C, 0x8A, 0x03, 0x8E, 0x5A, 0xA7, 0x42, 0x57, 0x7C, 0x02, 0x8B, 0x0A, 0x3E,
+    0x7B, 0xD1, 0x59, 0x84, 0x50, 0x2B, 0x42, 0xEB, 0x4B, 0x04, 0xC5, 0x99, 0x90, 0xDD, 0x26, 0x3A,
+    0xE1, 0xD4, 0x02, 0xE2, 0x14, 0x17, 0x46, 0x05, 0xD8, 0x4A, 0x3D, 0x32, 0x48, 0xD4, 0xC4, 0x8B,
+    0xBA, 0x09, 0x8F, 0x68, 0x25, 0xEE, 0xB4, 0x01, 0x49, 0x45, 0xBC, 0xE5, 0xF5, 0xE6, 0xE8, 0x32,
+    0x8F, 0xDC, 0x16, 0x70, 0xD4, 0xB2, 0x13, 0x69, 0x33, 0x6A, 0x49, 0xA3, 0x12, 0x08, 0xB1, 0x7F,
+    0x5B, 0x9E, 0xE4, 0x48, 0x5C, 0x08, 0xC2, 0xED, 0x68, 0x5F, 0xBA, 0x97, 0x84, 0xF4, 0x24, 0x1F,
+    0xD7, 0x74, 0xF6, 0x4B, 0x0D, 0x5A, 0x26, 0xBF, 0x14, 0xFA, 0x31, 0xA2, 0x33, 0x40, 0xB6, 0x1B,
+    0xA2, 0xBB, 0x37, 0xD6, 0x23, 0xD0, 0xA9, 0x12, 0x0E, 0x00, 0x36, 0x38, 0x66, 0x13, 0x38, 0x47,
+    0xD9, 0x82, 0x08, 0x1A, 0x7E, 0x79, 0x04, 0x09, 0x7D, 0x75, 0x26, 0x34, 0x6B, 0x65, 0xE4, 0x1D,
+    0x62, 0xEF, 0x54, 0x81, 0x06, 0x66, 0xAA, 0x60, 0x50, 0x45, 0xD1, 0xC0, 0xAD, 0x53, 0xB0, 0x2E,
+    0xD8, 0x9D, 0xE3, 0xA5, 0xD6, 0x0C, 0x2F, 0x34, 0x34, 0x64, 0x91, 0xF8, 0x69, 0xC6, 0xB3, 0x29,
+    0xC1, 0x1D, 0x8A, 0x92, 0x83, 0xC3, 0xB0, 0x2A, 0x39, 0x94, 0x90, 0x8C, 0x17, 0xD5, 0x81, 0xC5,
+    0xA6, 0x06, 0x66, 0xAD, 0xAC, 0x0E, 0x12, 0x2D, 0x40, 0x30, 0xB2, 0x87, 0x2A, 0x3F, 0x12, 0x87,
+    0xF0, 0x38, 0x48, 0x85, 0xBA, 0x2D, 0xFE, 0xF4, 0x23, 0x12, 0xA2, 0x24, 0xEE, 0x7B, 0x24, 0x67,
+    0x9F, 0xB8, 0xE3, 0xE6, 0x8B, 0x20, 0x08, 0xA1, 0x04, 0xBA, 0x66, 0xFD, 0x27, 0xA8, 0x46, 0x50,
+    0x87, 0x20, 0xE0, 0xAB, 0xF0, 0x64, 0xD0, 0x9B, 0xBD, 0xD0, 0xE9, 0x2E, 0x83, 0xDB, 0x05, 0x39,
+    0xB4, 0xEF, 0xA6, 0x26, 0x15, 0xF9, 0xC6, 0xF7, 0x5C, 0x27, 0xD4, 0xF2, 0xFC, 0xC6, 0x3B, 0xF0,
+    0x1B, 0xC7, 0xFC, 0x5E, 0x2B, 0x7B, 0x63, 0x32, 0xEC, 0x90, 0x29, 0xAA, 0x14, 0x3F, 0xBC, 0x13,
+    0x45, 0xBB, 0x1A, 0xEA, 0x0B, 0x14, 0xFD, 0x81, 0x9A, 0x41, 0xC3, 0xCD, 0xA0, 0xCB, 0xD6, 0x4A,
+    0xD0, 0xD1, 0x82, 0x0D, 0x0F, 0xD4, 0x44, 0x0A, 0x1F, 0xF2, 0x14, 0xAC, 0xED, 0xE7, 0x83, 0x76,
+    0xD3, 0x31, 0xFD, 0xCD, 0x4B, 0x24, 0xCC, 0x0E, 0x33, 0x37, 0xEE, 0x68, 0x1C, 0xF5, 0xD1, 0x09,
+    0x3E, 0xAA, 0xB5, 0x5E, 0xC5, 0x0F, 0x48, 0xB6, 0x21, 0xBF, 0xFB, 0xF9, 0x91, 0xC8, 0x77, 0xA0,
+    0x3C, 0x81, 0xEB, 0xE7, 0xA7, 0xD3, 0x49, 0x3E, 0xFC, 0xD6, 0xAF, 0x6D, 0xAA, 0x31, 0x2E, 0xF2,
+    0xA3, 0x14, 0x0F, 0xF8, 0x3E, 0x08, 0x6C, 0x74, 0x87, 0xC2, 0x10, 0x56, 0xEB, 0x9F, 0x3A, 0xF9,
+    0xAD, 0xD6, 0x8F, 0x74, 0x6C, 0xB7, 0x26, 0x43, 0x38, 0x90, 0x8E, 0x0E, 0x3A, 0xD6, 0x3B, 0xA4,
+    0xD3, 0x2D, 0x2E, 0x41, 0x46, 0x71, 0xAE, 0xB5, 0xD4, 0xC1, 0x27, 0xFE, 0x33, 0xB5, 0x0A, 0x42,
+    0x3C, 0xDF, 0x32, 0xE8, 0xC3, 0x59, 0xC2, 0x0A, 0x4E, 0xDE, 0x23, 0xFA, 0xAB, 0xBB, 0x67, 0xE4,
+    0x87, 0x0E, 0xF7, 0x7F, 0xE9, 0xD0, 0xAD, 0xB7, 0x51, 0xFF, 0xA9, 0xF6, 0x15, 0x53, 0x40, 0x81,
+    0xE8, 0x21, 0x87, 0x0D, 0x93, 0x00, 0x90, 0xBB, 0x49, 0xBE, 0xD4, 0x5E, 0x87, 0x66, 0x07, 0x93,
+    0x7E, 0xC1, 0xF8, 0xEB, 0x08, 0x24, 0x18, 0x23, 0x48, 0xB8, 0xDD, 0x30, 0xB0, 0x61, 0x6D, 0x73,
+    0xA9, 0xD7, 0xBA, 0x50, 0xBE, 0xBD, 0x7F, 0x86, 0xC1, 0xCF, 0xA6, 0xD1, 0x82, 0xE3, 0x28, 0x5F,
+    0xF4, 0x78, 0x30, 0xEC, 0x10, 0x45, 0x4E, 0x36, 0xF7, 0xFB, 0x4A, 0x27, 0xE7, 0x83, 0xD3, 0x4C,
+    0x30, 0x9C, 0x6D, 0x8E, 0x4A, 0x3C, 0xFF, 0xF2, 0xEF, 0xB0, 0x16, 0x83, 0xD7, 0x88, 0x55, 0x82,
+    0xD2, 0xCA, 0x5D, 0x06, 0xB0, 0x57, 0x96, 0xB0, 0x60, 0x4B, 0x86, 0xDD, 0xDA, 0xE1, 0x54, 0x9F,
+    0x0D, 0x05, 0x0E, 0x72, 0x8A, 0x07, 0x18, 0x2E, 0x97, 0xB9, 0xA9, 0x94, 0x33, 0xAD, 0x0A, 0xAE,
+    0x7E, 0x05, 0x49, 0x19, 0x68, 0xB9, 0x5D, 0x46, 0xF8, 0xD1, 0x1F, 0x49, 0xA5, 0xE9, 0x03, 0xF6,
+    0x8E, 0x84, 0xA9, 0xE4, 0x84, 0x57, 0x19, 0x18, 0x40, 0x7A, 0x58, 0xB0, 0x08, 0x7C, 0x06, 0x72,
+    0xA3, 0xB5, 0xD5, 0x57, 0x58, 0x71, 0xFA, 0x35, 0x20, 0xBF, 0x4F, 0x10, 0xF2, 0x59, 0x0F, 0xAD,
+    0x64, 0x1C, 0x29, 0x36, 0x83, 0x62, 0x69, 0x7E, 0xA5, 0xF7, 0xD1, 0xFD, 0x73, 0x2C, 0xD6, 0x14,
+    0x27, 0xB7, 0xFB, 0xEB, 0xA8, 0x00, 0xAF, 0x74, 0x82, 0x9D, 0x6F, 0x90, 0xDA, 0xC0, 0xE1, 0x86,
+    0x94, 0xA2, 0xAF, 0xEF, 0x8D, 0xF0, 0x12, 0x1C, 0x17, 0x22, 0x8E, 0x6F, 0x59, 0xD6, 0xAB, 0x4F,
+    0x6C, 0x17, 0x8C, 0x34, 0x60, 0xC1, 0x51, 0x6A, 0x6D, 0xFE, 0xF4, 0xBC, 0x25, 0x0A, 0x8E, 0xBA,
+    0x25, 0xC2, 0x7E, 0x98, 0x71, 0x46, 0xB7, 0x0D, 0xF0, 0x1D, 0xFD, 0xFE, 0xFC, 0xA8, 0xC7, 0xF3,
+    0x1A, 0x1F, 0xC6, 0x51, 0x69, 0x4B, 0xF1, 0x86, 0x27, 0xBD, 0xCB, 0xE3, 0xCC, 0xB3, 0x5F, 0x7A,
+    0xC2, 0xDB, 0xCD, 0xD1, 0xB0, 0x0C, 0x3B, 0x06, 0x00, 0xD3, 0xCD, 0x6B, 0x03, 0x2C, 0x9F, 0xDB,
+    0x32, 0x7A, 0x4C, 0x9A, 0xFE, 0xD8, 0x4C, 0xBF, 0x05, 0xB4, 0x80, 0xC5, 0x02, 0x5D, 0xA0, 0x55,
+    0xBF, 0x98, 0x80, 0x81, 0xC7, 0xCF, 0x30, 0x61, 0x42, 0x95, 0x38, 0x9A, 0x82, 0x3B, 0x44, 0xC2,
+    0x60, 0x7F, 0xB9, 0xAD, 0xE1, 0xF2, 0x3B, 0xF4, 0xA7, 0x60, 0xE8, 0x55, 0x46, 0x87, 0x4F, 0x2E,
+    0x9F, 0x18, 0x77, 0xBE, 0x84, 0x2C, 0x20, 0x70, 0xB4, 0x0E, 0x33, 0xC2, 0x20, 0xE2, 0x03, 0xDB,
+    0x72, 0xFF, 0x45, 0xE6, 0x3D, 0x65, 0x3E, 0x50, 0xE6, 0x83, 0x95, 0x09, 0x7A, 0x0F, 0x2F, 0x33,
+    0x77, 0xD4, 0x23, 0x64, 0xBE, 0x52, 0xE6, 0x18, 0xB8, 0x9A, 0x78, 0x29, 0x10, 0x1B, 0xB8, 0x43,
+    0xE6, 0x84, 0x1B, 0xB0, 0x99, 0xA1, 0x10, 0x97, 0xAC, 0x0D, 0x4E, 0x05, 0x9E, 0x83, 0xC8, 0x20,
+    0x73, 0x0F, 0xED, 0x0C, 0x2D, 0x67, 0x53, 0x6E, 0x1F, 0xB4, 0x50, 0x49, 0x4A, 0xE0, 0x61, 0x2E,
+    0xED, 0xBF, 0x19, 0x0A, 0x6D, 0xE4, 0xF8, 0x52, 0x7A, 0x74, 0xA5, 0x1B, 0xAE, 0xE3, 0x61, 0xFF,
+    0xE7, 0xCF, 0xDF, 0xAD, 0x55, 0x31, 0x92, 0xDD, 0x44, 0x10, 0x6D, 0x7D, 0xE1, 0x55, 0xA0, 0x60,
+    0x08, 0xC8, 0x08, 0x74, 0x00, 0x02, 0x1D, 0x61, 0x94, 0x11, 0x38, 0x60, 0x03, 0x1F, 0x01, 0xAA,
+    0x80, 0x64, 0x8F, 0xA0, 0xEF, 0xE2, 0x00, 0x76, 0xE0, 0x8C, 0x80, 0xC8, 0x89, 0x13, 0xDF, 0x80,
+    0x51, 0xE1, 0x60, 0x03, 0x02, 0xAB, 0xEC, 0x70, 0x03, 0x94, 0x13, 0x7C, 0x15, 0xA5, 0xAA, 0x1D,
+    0xC3, 0x8C, 0x9A, 0xF7, 0x5A, 0xFA, 0xBB, 0xC6, 0xE5, 0x2A, 0x27, 0xA8, 0x76, 0xF4, 0x57, 0x9A,
+    0xE9, 0xD7, 0xAF, 0xBB, 0x5F, 0xB7, 0x44, 0xE4, 0x52, 0xA4, 0xCC, 0x22, 0xF5, 0xBA, 0xAD, 0x2A,
+    0x89, 0x14, 0x4F, 0xE5, 0xEE, 0x6A, 0x17, 0x11, 0x3F, 0x6F, 0xAB, 0x9F, 0xB6, 0x15, 0x46, 0x11,
+    0x1D, 0x6C, 0x15, 0x7A, 0x94, 0x83, 0x76, 0x58, 0x80, 0xD9, 0x57, 0x45, 0x28, 0x40, 0xBA, 0x74,
+    0xBF, 0x9A, 0x78, 0x0F, 0xA5, 0xB3, 0xF4, 0x3A, 0x62, 0x0D, 0x58, 0x78, 0x85, 0xD7, 0xF2, 0xE0,
+    0x11, 0x6E, 0x25, 0x0C, 0x81, 0xD8, 0xC9, 0xE6, 0xC2, 0x0E, 0x9B, 0xB5, 0x41, 0x9E, 0x77, 0x86,
+    0x5A, 0xB1, 0x83, 0x9B, 0x4B, 0xB8, 0x55, 0x2B, 0x6E, 0x07, 0x7D, 0x08, 0x20, 0xBD, 0x26, 0xDA,
+    0x2D, 0x6E, 0x4E, 0x49, 0x43, 0x8D, 0x9B, 0xD2, 0xA3, 0xC2, 0xDE, 0x67, 0x38, 0x74, 0xD1, 0x47,
+    0xA9, 0x72, 0x45, 0x1B, 0x01, 0x09, 0x1D, 0x9A, 0x04, 0xB4, 0x52, 0x3B, 0x30, 0x0C, 0xB3, 0x11,
+    0xF1, 0x33, 0xA2, 0x42, 0x00, 0x70, 0xAF, 0x03, 0x3C, 0x37, 0x0B, 0xE8, 0x94, 0xF4, 0x87, 0xE8,
+    0x11, 0xAC, 0x4B, 0x77, 0x5B, 0x08, 0x49, 0x07, 0x6C, 0xC1, 0xF8, 0x7E, 0x8B, 0x39, 0xC1, 0xF5,
+    0xAD, 0x5C, 0x5C, 0x4A, 0xFB, 0x9B, 0x4E, 0x0D, 0x4C, 0xFF, 0xD2, 0xDC, 0xEA, 0x54, 0xAE, 0xAA,
+    0x7F, 0x68, 0x2A, 0x34, 0x07, 0xFD, 0x53, 0xBB, 0x10, 0x9D, 0x0E, 0x61, 0x6C, 0xD3, 0x01, 0x34,
+    0x16, 0x97, 0x45, 0xA7, 0x3A, 0x97, 0x6A, 0x7C, 0x00, 0x02, 0x30, 0x6E, 0xC3, 0x8D, 0x9F, 0xFC,
+    0x0C, 0x74, 0x9C, 0xE1, 0x2B, 0x9C, 0x59, 0xF7, 0x33, 0x9D, 0x8B, 0x3C, 0x33, 0x54, 0xF9, 0xC3,
+    0x33, 0xA9, 0xDA, 0xCE, 0x90, 0xC9, 0x77, 0x72, 0x48, 0xED, 0x4A, 0x12, 0x78, 0x77, 0xDA, 0xFC,
+    0x2F, 0xB5, 0x1E, 0x37, 0xD7, 0x9D, 0x8E, 0xBB, 0xD7, 0xC6, 0xC0, 0xC6, 0x72, 0x65, 0x44, 0xC4,
+    0x09, 0xA3, 0x9F, 0x36, 0x37, 0xA9, 0x66, 0xF0, 0x8C, 0xAD, 0xBB, 0x03, 0x07, 0xF2, 0x0F, 0xAC,
+    0x0A, 0x7C, 0x04, 0xCD, 0xD2, 0x22, 0xD5, 0x15, 0xC3, 0x42, 0xC4, 0x09, 0x59, 0xD5, 0x57, 0xB4,
+    0x63, 0xA6, 0xAE, 0xE1, 0x3B, 0x41, 0x38, 0xFA, 0x7B, 0x46, 0xA6, 0x98, 0xCB, 0xAF, 0x57, 0xE9,
+    0xE7, 0x7E, 0x6E, 0xE0, 0xE9, 0x84, 0xD8, 0x59, 0xA4, 0xA0, 0x09, 0x58, 0x90, 0x8D, 0x3C, 0x32,
+    0xE1, 0x5D, 0x74, 0x64, 0x8D, 0x67, 0xF5, 0xA8, 0x9B, 0x57, 0x8D, 0xD2, 0xE8, 0x2F, 0x2A, 0x35,
+    0xEB, 0x06, 0xD6, 0x96, 0x7A, 0x56, 0x89, 0x79, 0x6F, 0x66, 0x8B, 0x79, 0x8B, 0xB8, 0x49, 0xFB,
+    0x0E, 0xE8, 0x48, 0x83, 0xD0, 0x8E, 0x35, 0x68, 0xA1, 0x4C, 0xCA, 0x82, 0xBF, 0xA4, 0xF4, 0xDE,
+    0x00, 0xB2, 0x5D, 0x1E, 0x40, 0xA7, 0x54, 0xD7, 0x96, 0x25, 0x2A, 0xDA, 0xE4, 0x6D, 0x42, 0xDD,
+    0x74, 0xB7, 0xED, 0x48, 0xF1, 0x8C, 0x5B, 0xC9, 0x43, 0x7A, 0x59, 0xC1, 0x54, 0x63, 0xA5, 0x37,
+    0x3A, 0x7A, 0xFC, 0x14, 0x3A, 0x20, 0x39, 0x74, 0xC6, 0x48, 0x8F, 0x70, 0x93, 0x29, 0x99, 0x99,
+    0xA2, 0x61, 0x2E, 0xF5, 0xA0, 0xC7, 0xD6, 0xCE, 0x8D, 0x4E, 0x83, 0x32, 0x10, 0xD0, 0x54, 0xF8,
+    0xE9, 0x17, 0xE8, 0xF9, 0x33, 0x36, 0xCA, 0x96, 0x4B, 0xFA, 0x37, 0x9D, 0x37, 0x8B, 0xC9, 0x7C,
+    0xF7, 0x6E, 0x3C, 0x44, 0xBE, 0x97, 0xF0, 0x10, 0x71, 0x5D, 0x61, 0x85, 0x88, 0x9C, 0x2F, 0x07,
+    0x7D, 0xF7, 0x79, 0x89, 0x58, 0x10, 0xDE, 0xC7, 0xBB, 0x2E, 0xFE, 0xB7, 0xEB, 0xCE, 0x0D, 0x2C,
+    0xC5, 0x73, 0xFC, 0xA3, 0x0B, 0x30, 0x12, 0x52, 0x02, 0x1D, 0x14, 0x73, 0x7D, 0x1E, 0x00, 0xE0,
+    0x50, 0x22, 0xD1, 0x56, 0x53, 0xF6, 0x67, 0xA5, 0x6C, 0x75, 0xB6, 0xFC, 0x74, 0x09, 0x35, 0xFC,
+    0xFA, 0x33, 0xF4, 0x81, 0xB6, 0x0A, 0x10, 0xD2, 0x95, 0x2E, 0xE7, 0x52, 0x89, 0xC0, 0xBE, 0x85,
+    0x69, 0x32, 0xDE, 0xA8, 0x24, 0xA2, 0xBC, 0x46, 0x96, 0xBE, 0xD2, 0x17, 0x9D, 0x9F, 0xD0, 0x6F,
+    0xD6, 0xD0, 0x64, 0x05, 0xCC, 0x26, 0x5A, 0x27, 0xB7, 0xB3, 0xD1, 0xF6, 0xFC, 0x39, 0x21, 0x23,
+    0x10, 0x2F, 0x8B, 0x3B, 0x49, 0xD1, 0x6D, 0x98, 0x6C, 0xB7, 0x91, 0x9A, 0xB6, 0x56, 0xB0, 0x14,
+    0xB7, 0xEC, 0x2D, 0x6B, 0x80, 0x0F, 0xE5, 0xDA, 0x46, 0xCA, 0x1E, 0x72, 0x45, 0xC9, 0xF5, 0xE8,
+    0x13, 0xF3, 0x3E, 0x31, 0xE1, 0x9D, 0xD7, 0x5B, 0x00, 0xE9, 0x13, 0x0C, 0x9D, 0xC5, 0x0F, 0xF2,
+    0xC5, 0xCE, 0x18, 0x2D, 0x54, 0xAF, 0xE0, 0xA6, 0xAF, 0xD0, 0xC5, 0x91, 0xBA, 0x01, 0x0A, 0x1A,
+    0x62, 0x76, 0x68, 0x09, 0x53, 0x14, 0xC5, 0x0E, 0xAF, 0x6E, 0x06, 0x67, 0xBD, 0x9A, 0xC5, 0xDD,
+    0x22, 0x43, 0x8A, 0xF8, 0x6A, 0x64, 0x08, 0x41, 0x72, 0xC2, 0x70, 0x20, 0x26, 0x16, 0xAA, 0x3B,
+    0xCF, 0x4B, 0x36, 0x24, 0x5A, 0x16, 0x45, 0x47, 0x3B, 0xBF, 0x8E, 0xA8, 0x90, 0x8B, 0x7A, 0xEC,
+    0xF3, 0x41, 0x5D, 0x74, 0x27, 0x10, 0x0C, 0x8F, 0x73, 0xAE, 0x73, 0x1D, 0xFD, 0xEB, 0x11, 0xEC,
+    0x7F, 0x8A, 0xB9, 0x59, 0xEA, 0x18, 0xDC, 0x5B, 0x78, 0x7F, 0x32, 0x67, 0x3F, 0x56, 0xEF, 0xB2,
+    0xBB, 0x01, 0xE3, 0x30, 0x64, 0xED, 0xAA, 0x7F, 0x60, 0xC4, 0x71, 0x29, 0xE8, 0x8C, 0x8A, 0x11,
+    0x0D, 0x74, 0x08, 0x02, 0x25, 0x74, 0xB7, 0x0D, 0x4F, 0x92, 0xD8, 0x63, 0x42, 0x56, 0x20, 0x2E,
+    0x94, 0x14, 0x19, 0x7E, 0xCC, 0x69, 0x97, 0x38, 0x5C, 0xC3, 0xCD, 0xCA, 0x3D, 0x4E, 0x25, 0xCF,
+    0x69, 0x58, 0x28, 0x25, 0xE5, 0xC8, 0xF9, 0xC0, 0x67, 0xC0, 0x63, 0xAB, 0x51, 0x0B, 0xC4, 0x66,
+    0xFB, 0x5B, 0x22, 0x47, 0xD8, 0xD6, 0x4C, 0xBE, 0x49, 0x5C, 0xFA, 0xF8, 0x9E, 0x27, 0x3D, 0x42,
+    0xD6, 0x25, 0xDB, 0x9A, 0x7F, 0x61, 0xDA, 0x47, 0x4D, 0x18, 0x5A, 0x16, 0x97, 0x55, 0xAE, 0x92,
+    0x89, 0x71, 0x31, 0xE9, 0xBD, 0xA1, 0x2F, 0xFD, 0x86, 0x0E, 0xD6, 0x1E, 0x0E, 0xEA, 0xBF, 0xA9,
+    0xEC, 0xE6, 0xB4, 0x9C, 0x9D, 0x8B, 0x6E, 0xDD, 0x36, 0x19, 0x31, 0xFB, 0xEE, 0xC4, 0xBB, 0x9E,
+    0xA4, 0x32, 0x71, 0x8E, 0x4C, 0x2B, 0x02, 0x35, 0xCC, 0xBF, 0xC9, 0x13, 0xBE, 0xE2, 0xF9, 0xBB,
+    0xB1, 0x5F, 0x9C, 0x25, 0x35, 0xA4, 0x87, 0x78, 0xB3, 0xBC, 0x78, 0x69, 0x55, 0xDA, 0xEC, 0x4A,
+    0x5B, 0xFC, 0x24, 0x0C, 0xB6, 0x0A, 0xFB, 0x84, 0x8D, 0xFB, 0xA2, 0xC6, 0x55, 0x07, 0x08, 0x77,
+    0x6E, 0xAC, 0xBF, 0xF9, 0xC9, 0x90, 0x8B, 0x68, 0x5B, 0xCC, 0x55, 0x9F, 0x4D, 0xAF, 0x0E, 0x9C,
+    0x7B, 0x1A, 0x83, 0x17, 0x36, 0x3D, 0x6D, 0x4D, 0xAB, 0x17, 0x9C, 0x2B, 0x2B, 0x90, 0x8F, 0x16,
+    0xC1, 0x97, 0xBA, 0x7D, 0x4B, 0x79, 0xDE, 0x0F, 0x76, 0x88, 0x8F, 0x2D, 0xFC, 0x90, 0x07, 0x73,
+    0x63, 0xDF, 0x24, 0xA0, 0x11, 0x11, 0x30, 0x05, 0xBB, 0xFE, 0x13, 0xD7, 0x8F, 0xF2, 0xFF, 0x5E,
+    0xFF, 0x02, 0xAD, 0x55, 0xBF, 0x6F, 0xE5, 0x44, 0x10, 0x9E, 0xB5, 0x49, 0x7C, 0x8A, 0x25, 0xF6,
+    0x0A, 0x42, 0x71, 0x48, 0xB8, 0xA7, 0x71, 0x8D, 0x04, 0x59, 0xA3, 0x14, 0x29, 0xD2, 0xBC, 0xE2,
+    0xF2, 0x4F, 0xBC, 0x26, 0x05, 0x6D, 0xC0, 0xCE, 0x09, 0xE9, 0x4A, 0x1E, 0x35, 0x05, 0x48, 0x50,
+    0xE4, 0x1E, 0x2D, 0x15, 0x3A, 0xB2, 0x7B, 0x5C, 0x91, 0x82, 0xE2, 0x7C, 0x05, 0xA2, 0x5D, 0xC4,
+    0x21, 0x24, 0x52, 0x9C, 0x11, 0x46, 0xF2, 0x5D, 0xD6, 0x1E, 0xBE, 0xD9, 0xF7, 0xF2, 0x43, 0x34,
+    0x27, 0x21, 0xF6, 0xBD, 0xB5, 0xF7, 0xC7, 0xCC, 0xEC, 0xCC, 0xB7, 0xDF, 0x8C, 0xE9, 0xED, 0x05,
+    0x25, 0xDC, 0x50, 0x39, 0x52, 0xCA, 0x1E, 0x9D, 0xA8, 0xF4, 0x94, 0x4C, 0x44, 0xA6, 0xA5, 0x34,
+    0x10, 0xD5, 0x8E, 0xF2, 0x81, 0xC8, 0x3A, 0xCA, 0x64, 0x11, 0xFB, 0xD6, 0x53, 0x3D, 0x52, 0xC1,
+    0x2E, 0xE5, 0x2A, 0x6E, 0x43, 0xCA, 0x36, 0xA4, 0x7B, 0x22, 0xEC, 0x16, 0x1D, 0xA5, 0x13, 0x6D,
+    0x72, 0x4B, 0x36, 0x50, 0x0E, 0x09, 0x6C, 0x29, 0x22, 0x52, 0x77, 0x89, 0x32, 0xEE, 0xE9, 0x43,
+    0xE6, 0x97, 0x81, 0xD1, 0xDE, 0xDD, 0x64, 0xFE, 0x04, 0x82, 0x15, 0xAD, 0x5B, 0xD9, 0x2A, 0x76,
+    0x9A, 0xC9, 0x0C, 0x62, 0xF5, 0xF6, 0x7A, 0x75, 0xA2, 0x6C, 0x10, 0x97, 0xB8, 0x82, 0x37, 0x30,
+    0x6E, 0x1D, 0xCC, 0x6B, 0x88, 0xB4, 0xF0, 0x55, 0x07, 0xAA, 0x3B, 0xB8, 0xAF, 0x27, 0x32, 0x3D,
+    0x5D, 0xB5, 0x12, 0x36, 0x0D, 0xDE, 0xF5, 0x0C, 0x6E, 0x8E, 0x54, 0x73, 0x50, 0xCC, 0x21, 0xE5,
+    0x9F, 0xBE, 0x85, 0x79, 0x51, 0xA2, 0x12, 0x21, 0x99, 0x6E, 0xDD, 0x3D, 0x24, 0x2F, 0xBB, 0xCC,
+    0x7B, 0xE5, 0x0C, 0xB3, 0x2B, 0xD0, 0x33, 0x74, 0xB2, 0xD3, 0xDA, 0x1C, 0xFA, 0x29, 0xFA, 0x1B,
+    0xD7, 0x27, 0x15, 0xBC, 0x80, 0x41, 0x11, 0x4A, 0x99, 0x61, 0xB3, 0x66, 0x39, 0x60, 0x52, 0x5F,
+    0x12, 0x62, 0x11, 0x4F, 0xC4, 0xAB, 0x84, 0x45, 0x54, 0x8E, 0x8A, 0xF8, 0xD2, 0x1D, 0xFB, 0xF2,
+    0x6B, 0x2C, 0x32, 0x42, 0xC7, 0x39, 0x9D, 0xA8, 0xCA, 0x72, 0x54, 0x28, 0x86, 0xA8, 0x50, 0x5D,
+    0x2A, 0x88, 0xB3, 0xC0, 0xAD, 0xA2, 0xA8, 0x30, 0x51, 0x89, 0x67, 0x2B, 0x0A, 0xA3, 0xE8, 0x46,
+    0x15, 0x6C, 0x39, 0x7A, 0x3D, 0x99, 0xF8, 0x79, 0x67, 0xE1, 0x44, 0x8E, 0xAE, 0x78, 0x6F, 0x24,
+    0x4B, 0xA6, 0x31, 0x4D, 0xD6, 0x69, 0xAF, 0x02, 0xB0, 0xB3, 0x54, 0x37, 0x35, 0x90, 0xE2, 0x16,
+    0xFE, 0x06, 0x2D, 0xCA, 0xC3, 0x7C, 0xDF, 0xDD, 0x22, 0x6A, 0x70, 0x83, 0xD9, 0x94, 0x8D, 0x38,
+    0x2C, 0x1D, 0xE1, 0x32, 0x00, 0x36, 0x40, 0x15, 0x0E, 0x29, 0x56, 0x38, 0x9A, 0x77, 0x01, 0x00,
+    0xEF, 0xCB, 0x35, 0x7F, 0xD1, 0x4B, 0x8C, 0x5E, 0x88, 0xE0, 0xE4, 0x51, 0xD1, 0x96, 0xE5, 0x13,
+    0x41, 0x00, 0x97, 0x23, 0x08, 0x6C, 0x1C, 0xFE, 0x3D, 0x43, 0xD8, 0x5D, 0x8C, 0x72, 0xB1, 0x8A,
+    0x0F, 0xA0, 0x78, 0xDA, 0xB6, 0xBF, 0x55, 0x91, 0x46, 0xEB, 0x40, 0xC1, 0x39, 0x4C, 0x6F, 0xB6,
+    0x15, 0xA2, 0xF3, 0x9B, 0x4B, 0x73, 0xA2, 0xED, 0x19, 0xA0, 0xE4, 0x06, 0xD1, 0xF7, 0x8A, 0xCF,
+    0x11, 0x86, 0xDB, 0x12, 0x6A, 0x46, 0x60, 0x94, 0x78, 0x52, 0xC2, 0x52, 0x21, 0xC7, 0x5F, 0x80,
+    0x07, 0x9D, 0xE9, 0xB2, 0x21, 0x0D, 0xC9, 0x08, 0x2A, 0xD6, 0xCE, 0x38, 0x3D, 0x9A, 0x16, 0xAA,
+    0x2D, 0x24, 0xA0, 0x03, 0x46, 0x92, 0x90, 0x76, 0x65, 0xA0, 0xCF, 0xAB, 0x3C, 0x24, 0x02, 0xAA,
+    0x45, 0xCF, 0x81, 0x28, 0x6D, 0xAC, 0xC8, 0x58, 0x1C, 0x07, 0xF3, 0x78, 0x94, 0xFF, 0xBD, 0xF0,
+    0xDA, 0x15, 0x13, 0xC1, 0xD5, 0x17, 0xF1, 0x32, 0x44, 0x12, 0x19, 0xF2, 0x16, 0xAE, 0x0A, 0xA3,
+    0xDC, 0x83, 0x1C, 0x6F, 0xCE, 0xCA, 0x26, 0x03, 0x63, 0xDA, 0xEF, 0xA9, 0xCF, 0x40, 0xB5, 0xAE,
+    0xC0, 0x56, 0x55, 0xEC, 0x7A, 0xA1, 0xE2, 0xF0, 0x5E, 0x0A, 0x3C, 0xF2, 0x33, 0xF7, 0x31, 0xD4,
+    0x8F, 0x8E, 0x32, 0x1C, 0x9E, 0x9D, 0xB9, 0x8F, 0xAE, 0x27, 0x8F, 0xDD, 0x0E, 0x26, 0x0F, 0xDF,
+    0x17, 0x31, 0x7D, 0xAF, 0x2B, 0x00, 0x4D, 0xAF, 0x2B, 0xFE, 0xC6, 0x95, 0xF4, 0x30, 0xE1, 0x90,
+    0xB5, 0x69, 0x97, 0x3C, 0x50, 0x08, 0x11, 0xC0, 0x01, 0xA6, 0x7A, 0x21, 0x09, 0x02, 0xAF, 0x25,
+    0x7C, 0xBC, 0xE4, 0x49, 0xDB, 0x6B, 0x27, 0xEB, 0xFB, 0xAE, 0xE6, 0xCE, 0x9C, 0x87, 0xD2, 0x4D,
+    0xDA, 0x9B, 0xBD, 0x4E, 0x3F, 0x82, 0x3B, 0x36, 0x19, 0x4A, 0x37, 0x66, 0x13, 0x93, 0x3D, 0x77,
+    0x9B, 0x9F, 0x81, 0xB4, 0xB7, 0xF0, 0x53, 0xBD, 0xEA, 0x41, 0xFB, 0xDA, 0xEB, 0x50, 0x8C, 0x29,
+    0xEF, 0x72, 0xC5, 0x9E, 0xBD, 0x19, 0x0C, 0x48, 0x94, 0x43, 0xD4, 0x5B, 0x9F, 0x32, 0x28, 0x5B,
+    0xF6, 0xC8, 0x09, 0x3E, 0x06, 0xBE, 0x41, 0x32, 0xAE, 0x45, 0xEE, 0x3D, 0x4B, 0x9F, 0x01, 0x98,
+    0xDB, 0xF4, 0xCE, 0x72, 0xB9, 0xFC, 0x14, 0x5C, 0xFA, 0x0B, 0x3D, 0xA6, 0xB5, 0x90, 0x1E, 0xCE,
+    0xE5, 0x08, 0x25, 0x11, 0xEE, 0xDA, 0xAB, 0x85, 0x12, 0x42, 0x93, 0xE1, 0x9F, 0x05, 0x3E, 0x7A,
+    0x35, 0xA6, 0x1B, 0x07, 0x24, 0x98, 0xC2, 0x22, 0x30, 0xD5, 0x2B, 0x4C, 0x43, 0xEE, 0x81, 0xA9,
+    0x76, 0x06, 0x98, 0x12, 0x56, 0x80, 0xA9, 0x06, 0xAA, 0x47, 0x47, 0x34, 0x1E, 0x3A, 0x60, 0xAA,
+    0xC1, 0x36, 0x4C, 0x70, 0x9D, 0xC0, 0x54, 0xFF, 0xD0, 0x01, 0x53, 0x0A, 0xDA, 0x01, 0x53, 0xED,
+    0xC4, 0x4A, 0x05, 0x1D, 0x60, 0xAA, 0x5D, 0x71, 0x1F, 0x98, 0xDE, 0xA5, 0x83, 0x57, 0x63, 0x8A,
+    0x00, 0x1F, 0x80, 0xC5, 0x01, 0x24, 0x0E, 0xF3, 0xE5, 0xF2, 0x24, 0xA6, 0x67, 0x83, 0x83, 0x0C,
+    0xD6, 0x3E, 0x18, 0x4F, 0xE9, 0xF4, 0x94, 0x6A, 0x3C, 0x31, 0x36, 0x92, 0x56, 0x7D, 0x12, 0x99,
+    0x4D, 0xE9, 0x10, 0x8B, 0x17, 0xB8, 0x86, 0xA9, 0xF6, 0x57, 0x0B, 0xC9, 0xD2, 0xFE, 0x71, 0x22,
+    0x40, 0x49, 0xFA, 0x3E, 0x61, 0xC9, 0x8F, 0x7F, 0x49, 0x5C, 0xAB, 0xA8, 0x19, 0x6D, 0x01, 0xDF,
+    0xAF, 0x2E, 0xB1, 0x5D, 0x65, 0x3C, 0x56, 0x33, 0xF6, 0x20, 0x6E, 0x53, 0x3C, 0x0F, 0xB4, 0x30,
+    0x6E, 0x55, 0xA7, 0x1B, 0xA9, 0x8E, 0xC8, 0xE4, 0x54, 0x92, 0x15, 0x85, 0x59, 0x38, 0x8F, 0xCB,
+    0xC3, 0x7D, 0xF2, 0x14, 0xA1, 0x06, 0xB9, 0xEB, 0x49, 0xB2, 0x57, 0x7F, 0x1E, 0x62, 0xCC, 0xC6,
+    0x6D, 0xD4, 0x28, 0xE2, 0x8D, 0x82, 0x0F, 0x4A, 0x0A, 0xFF, 0x23, 0xD2, 0xDD, 0x77, 0x87, 0x43,
+    0x09, 0xCA, 0x49, 0x2A, 0x23, 0x91, 0xE7, 0x8B, 0x02, 0x75, 0x13, 0x49, 0x57, 0xF8, 0xE8, 0x5D,
+    0x6C, 0xD6, 0xE1, 0x53, 0x10, 0x89, 0x80, 0x54, 0xC6, 0x89, 0xA8, 0x59, 0xEC, 0x50, 0xB3, 0xB0,
+    0x54, 0x76, 0x8A, 0x9B, 0xC8, 0x18, 0x94, 0x10, 0xBC, 0x33, 0x29, 0x25, 0x64, 0xDB, 0x95, 0x82,
+    0x15, 0x05, 0x2D, 0x75, 0x26, 0x91, 0xDA, 0xE2, 0x6A, 0x28, 0xB0, 0x15, 0x05, 0xBE, 0x80, 0x02,
+    0x8F, 0x16, 0x0A, 0xBC, 0x0F, 0x85, 0xA7, 0x48, 0x1B, 0xF9, 0xAE, 0xAC, 0x8B, 0x45, 0xAC, 0x82,
+    0x2A, 0x02, 0x1B, 0x2B, 0x6A, 0x7A, 0x5D, 0x51, 0x11, 0xD7, 0xC1, 0x41, 0x85, 0x50, 0x27, 0x14,
+    0x3E, 0xFE, 0x45, 0x8A, 0x24, 0x60, 0x4A, 0x7F, 0x05, 0xB0, 0x3B, 0xB8, 0xB3, 0xF4, 0x5C, 0x06,
+    0xF6, 0xE6, 0xE0, 0x77, 0x19, 0x5C, 0xC9, 0x08, 0x48, 0xDE, 0x62, 0xA0, 0x64, 0x40, 0xAA, 0x43,
+    0x2A, 0x16, 0xFF, 0x69, 0xB0, 0xC2, 0x66, 0x8F, 0xCB, 0xC0, 0x7F, 0x32, 0xCD, 0x28, 0xE9, 0x15,
+    0xE0, 0xEE, 0x70, 0x39, 0x5C, 0xF0, 0x19, 0xB7, 0xF2, 0xA9, 0x10, 0x9C, 0xD9, 0xDB, 0xB1, 0xE6,
+    0x1F, 0x39, 0xEC, 0x98, 0xE3, 0xAC, 0x27, 0x5B, 0xE9, 0x0E, 0xD5, 0xAA, 0xF0, 0x28, 0x5A, 0xC6,
+    0xA5, 0x31, 0x68, 0x8B, 0x12, 0xDF, 0xEB, 0x8B, 0x50, 0x3C, 0x0D, 0xA6, 0x19, 0x4D, 0x15, 0x8C,
+    0x0A, 0x26, 0x09, 0x66, 0xAF, 0x37, 0xDC, 0x69, 0x80, 0xFD, 0x82, 0xFE, 0xA7, 0xF6, 0x0F, 0xCD,
+    0x94, 0xB1, 0xCE, 0xDC, 0x44, 0x14, 0x85, 0xAF, 0x6D, 0x85, 0x91, 0xE2, 0x62, 0x52, 0xA4, 0x77,
+    0x4F, 0x81, 0xDF, 0x20, 0x63, 0x41, 0x41, 0x49, 0xC3, 0xD2, 0xF2, 0x08, 0xFF, 0x1B, 0xC4, 0x16,
+    0x29, 0x53, 0x90, 0x47, 0x48, 0x41, 0xC3, 0xDF, 0xF0, 0x02, 0x11, 0x1E, 0x48, 0x41, 0x41, 0x63,
+    0x92, 0x07, 0x88, 0xA5, 0x1F, 0x89, 0x82, 0x02, 0x47, 0x72, 0x84, 0x15, 0x3C, 0xBE, 0x9C, 0x73,
+    0x67, 0x57, 0xE4, 0x47, 0x69, 0x91, 0x70, 0xE1, 0xB5, 0x77, 0x67, 0xCF, 0xFD, 0xEE, 0xB9, 0x67,
+    0x46, 0xEE, 0xCB, 0x7D, 0x69, 0x63, 0x1B, 0x5D, 0x72, 0x49, 0xC2, 0x12, 0xE6, 0x52, 0x4B, 0x95,
+    0x66, 0x6B, 0x36, 0xD1, 0xA8, 0xB1, 0x3E, 0xEA, 0x54, 0xE8, 0x0F, 0x1A, 0xC3, 0x1A, 0x56, 0x9F,
+    0x7C, 0x2A, 0xF5, 0x91, 0x0E, 0xE3, 0x3C, 0xCE, 0x6E, 0x77, 0xBB, 0x78, 0x69, 0xE4, 0xDD, 0x0B,
+    0x5F, 0xC9, 0x21, 0xB5, 0x8A, 0x8C, 0xD2, 0xE8, 0x20, 0x7D, 0x17, 0x74, 0x92, 0x30, 0x34, 0xBA,
+    0x48, 0x88, 0xE5, 0xCD, 0x8E, 0x5A, 0x72, 0x0F, 0xFA, 0x93, 0x48, 0x3F, 0xF8, 0x59, 0xA4, 0x9D,
+    0xFC, 0x22, 0xE2, 0x97, 0x7A, 0x15, 0xA9, 0x76, 0xB7, 0x56, 0x49, 0xB4, 0xDA, 0x2A, 0xED, 0xFA,
+    0x47, 0x7B, 0xA5, 0xB1, 0x7D, 0x81, 0x8A, 0x8B, 0x14, 0x47, 0xA9, 0x9B, 0x88, 0x16, 0x29, 0xF1,
+    0xBE, 0x8F, 0x28, 0xD0, 0xA5, 0x10, 0x21, 0x92, 0x3C, 0xA5, 0x7B, 0xD5, 0x2E, 0xC4, 0x56, 0x75,
+    0x6A, 0xA7, 0xBB, 0xD7, 0xFA, 0xB4, 0x81, 0x74, 0x88, 0x26, 0x3D, 0xCB, 0xED, 0xAB, 0x8F, 0xFC,
+    0x8E, 0x8C, 0x2A, 0x05, 0x54, 0x51, 0x99, 0x90, 0xFD, 0x50, 0xA8, 0x02, 0x41, 0x48, 0x09, 0xE5,
+    0xC2, 0x2F, 0x65, 0xE2, 0xF2, 0x81, 0x5A, 0x78, 0xC4, 0x1F, 0xC8, 0xB9, 0xDC, 0xE9, 0x58, 0xEF,
+    0x53, 0x50, 0x01, 0x74, 0xD4, 0xC5, 0x6D, 0x21, 0x2A, 0x49, 0xF7, 0x62, 0xD0, 0x8E, 0xAD, 0x55,
+    0xE6, 0x82, 0x34, 0x0B, 0xD6, 0xA3, 0x04, 0x59, 0xF9, 0xE2, 0x36, 0x81, 0xB5, 0xD4, 0x0E, 0x33,
+    0xD7, 0xA0, 0x55, 0xB4, 0x2F, 0xBD, 0xEE, 0xC5, 0x81, 0x5F, 0x74, 0xC1, 0x6A, 0xAF, 0x70, 0xED,
+    0x7C, 0xA1, 0x10, 0x2D, 0x45, 0x21, 0xA8, 0x05, 0x35, 0xB5, 0xEF, 0xC7, 0x48, 0x35, 0x18, 0x0B,
+    0x35, 0x29, 0x8D, 0xF4, 0xCE, 0xD5, 0x84, 0x07, 0x09, 0x9B, 0xD9, 0xAA, 0x2B, 0x6B, 0xA3, 0x1E,
+    0x9B, 0x87, 0xDD, 0x23, 0x45, 0x46, 0xB7, 0xBA, 0xF4, 0xF0, 0x6A, 0x0F, 0x43, 0x78, 0xAD, 0xFA,
+    0x12, 0xCE, 0xFE, 0xA4, 0x5B, 0x3B, 0x05, 0x95, 0xD3, 0xD9, 0x5A, 0xBF, 0x34, 0xAF, 0xA6, 0x8B,
+    0xB7, 0xF5, 0xEA, 0x9F, 0xEF, 0x72, 0x36, 0x17, 0x53, 0x51, 0x88, 0x9A, 0xBB, 0x11, 0x3E, 0x5C,
+    0x7F, 0xF7, 0x56, 0xB2, 0xBD, 0x66, 0xC9, 0xF1, 0x8F, 0xB3, 0x1F, 0x74, 0x52, 0xE1, 0x75, 0x64,
+    0x1B, 0xF8, 0x98, 0xA4, 0xDC, 0xDE, 0x35, 0x1E, 0x5A, 0xEC, 0xBF, 0x9F, 0xA4, 0xDD, 0xB9, 0xC2,
+    0xE9, 0x54, 0x30, 0x17, 0x18, 0x01, 0xA7, 0x8A, 0xB1, 0xEC, 0xC8, 0xC6, 0xDC, 0x3C, 0x56, 0xDD,
+    0x83, 0xEA, 0x2F, 0xAA, 0x5B, 0xA9, 0xBF, 0xF2, 0x9F, 0xD7, 0xF4, 0x24, 0x20, 0x21, 0xA6, 0x6F,
+    0x23, 0x84, 0x31, 0x7C, 0x97, 0x87, 0xB7, 0x87, 0x3B, 0xF2, 0xCB, 0xC0, 0x45, 0x2D, 0x04, 0x85,
+    0xB9, 0x13, 0xFF, 0x17, 0x7A, 0x71, 0x49, 0xF9, 0x6F, 0x0E, 0x56, 0x3F, 0xC3, 0x22, 0x7D, 0x9E,
+    0x88, 0x82, 0x81, 0x31, 0xF4, 0xD2, 0xAC, 0xF5, 0x86, 0xFA, 0xE0, 0xC3, 0x36, 0x18, 0x63, 0xA5,
+    0x18, 0x07, 0x46, 0xA2, 0xBB, 0xE0, 0xA6, 0x32, 0xE2, 0x36, 0x85, 0x37, 0xA7, 0xAB, 0xB5, 0x5D,
+    0x31, 0x37, 0x80, 0x8A, 0x3E, 0x86, 0x40, 0xB8, 0x81, 0xAA, 0x3F, 0xA0, 0x52, 0xD1, 0x0B, 0xF9,
+    0xF0, 0x29, 0x19, 0x6D, 0x84, 0x8D, 0xF5, 0x6E, 0x8F, 0xDE, 0x48, 0xFB, 0x7F, 0xE5, 0x30, 0xB3,
+    0x56, 0x3A, 0x5F, 0x60, 0x99, 0xBF, 0x33, 0xAD, 0xF4, 0xAF, 0x96, 0x33, 0x2E, 0xD0, 0x20, 0x9F,
+    0x79, 0x5D, 0xA2, 0x94, 0x01, 0x17, 0xDA, 0x8D, 0x43, 0x26, 0x46, 0x1B, 0x35, 0xD2, 0x44, 0x64,
+    0x08, 0x61, 0x48, 0x99, 0xB9, 0xC6, 0x0D, 0x5B, 0x9A, 0xD0, 0x25, 0xDB, 0x9C, 0x8C, 0x7A, 0xC0,
+    0x58, 0xAA, 0x83, 0xB4, 0x7E, 0x6F, 0x4D, 0x0C, 0xD5, 0xEE, 0x7E, 0x6B, 0xAC, 0x2C, 0xEC, 0x19,
+    0x06, 0xD1, 0xAF, 0xE9, 0xDB, 0xC6, 0x08, 0x8D, 0xE2, 0xA7, 0xFF, 0x2B, 0xB7, 0xE0, 0xF0, 0xA2,
+    0xE2, 0x33, 0xF2, 0xBC, 0xC5, 0xB2, 0x9A, 0x49, 0x15, 0xFF, 0x23, 0xE1, 0x1A, 0xF9, 0xA8, 0x7B,
+    0x9F, 0xE3, 0x62, 0x1D, 0x96, 0xD6, 0xAD, 0xCB, 0x3D, 0x1B, 0x7A, 0xF3, 0x27, 0xEF, 0xE1, 0xC6,
+    0xDA, 0x78, 0xC9, 0xAD, 0x6F, 0xEC, 0x85, 0x7E, 0x92, 0x28, 0xCF, 0xE4, 0xB9, 0x54, 0x1E, 0x72,
+    0x86, 0x6F, 0x56, 0xDB, 0xCC, 0x24, 0xB6, 0x78, 0x48, 0xA6, 0x67, 0x68, 0xB4, 0xAB, 0xF4, 0xF4,
+    0x85, 0x76, 0x16, 0xEB, 0x2E, 0xE3, 0x93, 0x59, 0x07, 0x52, 0x6B, 0x1C, 0x27, 0x8B, 0xFB, 0x65,
+    0x5B, 0x44, 0xEA, 0x1F, 0x2D, 0xB7, 0xD4, 0x8B, 0x83, 0x9B, 0xBA, 0xA1, 0xA9, 0x72, 0xEF, 0x3D,
+    0xEC, 0x9E, 0x79, 0xCA, 0xE8, 0x3D, 0x15, 0x8C, 0xBC, 0x50, 0xEE, 0x07, 0x03, 0x77, 0x29, 0x4C,
+    0x67, 0xEE, 0x66, 0xC5, 0x63, 0xC6, 0xEE, 0x27, 0x88, 0x1B, 0x35, 0xBC, 0x6A, 0x97, 0x0C, 0x5D,
+    0x9B, 0xEF, 0xC6, 0x4C, 0xF3, 0xD7, 0x8C, 0x0C, 0x34, 0xBF, 0x1A, 0xF1, 0x57, 0xF0, 0xDE, 0x6F,
+    0x06, 0xFC, 0x73, 0x62, 0xD3, 0x97, 0x2D, 0x67, 0x0C, 0xEE, 0x37, 0x3C, 0x96, 0xCB, 0x03, 0xBC,
+    0x3F, 0xF3, 0xB0, 0xD9, 0x0E, 0x8F, 0x9C, 0x89, 0xE6, 0xC9, 0x2D, 0xEE, 0x9A, 0x29, 0xB0, 0x5F,
+    0x8C, 0x3B, 0x87, 0x45, 0x71, 0x8C, 0xE5, 0xAC, 0x18, 0xB6, 0x45, 0xC5, 0xEF, 0x00, 0xB6, 0xA4,
+    0x18, 0x75, 0x0E, 0x0A, 0xCE, 0xD5, 0x25, 0xE7, 0x24, 0x5C, 0x48, 0xA3, 0x27, 0xB9, 0xA5, 0xC4,
+    0x98, 0x3F, 0xB6, 0x90, 0xF0, 0xF8, 0xD8, 0x2C, 0x23, 0x86, 0xFC, 0xC7, 0x25, 0x22, 0x8C, 0x17,
+    0x81, 0xED, 0x73, 0xB6, 0xFA, 0x96, 0x11, 0xEB, 0x9C, 0x43, 0x1E, 0x7F, 0xD7, 0xD3, 0x89, 0x7E,
+    0xBE, 0xCE, 0x27, 0x6F, 0x58, 0x46, 0xCB, 0x7B, 0xBB, 0xE5, 0x88, 0xF9, 0xDD, 0x5A, 0x17, 0x9F,
+    0x9C, 0x9E, 0x3E, 0x67, 0x64, 0x4A, 0x9B, 0x76, 0x65, 0xA7, 0x42, 0x44, 0x57, 0x43, 0xA0, 0x93,
+    0x05, 0xC0, 0x8E, 0xEB, 0x6F, 0x4C, 0xD8, 0x0E, 0x29, 0x86, 0xA2, 0xB3, 0x41, 0xA9, 0x0D, 0x3B,
+    0x98, 0xE1, 0x10, 0x4E, 0xA7, 0x2F, 0x2D, 0x75, 0xBB, 0x38, 0x2E, 0xF4, 0x76, 0xF8, 0xEB, 0xE0,
+    0x72, 0x84, 0xA6, 0x8A, 0xFD, 0xD8, 0xF1, 0x33, 0xE0, 0xFC, 0xB2, 0x59, 0xFF, 0x77, 0xD7, 0xDF,
+    0xCD, 0x55, 0x3B, 0x6E, 0x9D, 0x40, 0x14, 0x1D, 0x20, 0x0A, 0x52, 0x28, 0xA6, 0x89, 0x94, 0x22,
+    0x05, 0xBD, 0x9B, 0xB7, 0x84, 0x99, 0xDE, 0x85, 0x53, 0xC4, 0x75, 0x96, 0xE0, 0x25, 0xC0, 0x0E,
+    0xE2, 0x1D, 0x24, 0xA5, 0xF3, 0xF6, 0x10, 0x41, 0xE4, 0x0D, 0xE0, 0x22, 0x4A, 0x19, 0xA4, 0xB8,
+    0x49, 0x47, 0x81, 0x25, 0x6C, 0x01, 0x27, 0xE7, 0x0C, 0xE0, 0xF8, 0xB9, 0x48, 0x19, 0xBD, 0x91,
+    0xE6, 0x3E, 0x1E, 0x33, 0xF7, 0xDE, 0x73, 0xCF, 0xFD, 0x60, 0x4C, 0x58, 0x29, 0xEE, 0x8D, 0xC9,
+    0x81, 0xDE, 0x38, 0x60, 0x92, 0x80, 0xD9, 0xA1, 0xBC, 0xF0, 0xF9, 0x6C, 0x8C, 0xB7, 0x08, 0x57,
+    0x28, 0x12, 0x94, 0x94, 0xA8, 0x29, 0x8A, 0x96, 0x62, 0xD7, 0x53, 0xD8, 0x29, 0x9C, 0x98, 0xED,
+    0xC4, 0x75, 0x7F, 0x5F, 0xEA, 0x7A, 0x15, 0xFE, 0xC3, 0xBF, 0xF5, 0x09, 0xED, 0x36, 0xB2, 0xDE,
+    0xF3, 0x88, 0x7E, 0xE8, 0xE3, 0x5E, 0x0A, 0x5E, 0xA6, 0x1A, 0x8A, 0x4C, 0x5A, 0xC6, 0xC9, 0x8A,
+    0xA5, 0x56, 0x8C, 0x41, 0xFA, 0xA3, 0x8E, 0x87, 0x00, 0xF4, 0xE4, 0x72, 0x73, 0x90, 0xCB, 0x75,
+    0xA6, 0xA3, 0x58, 0xC2, 0x7C, 0x35, 0x4F, 0x96, 0x05, 0x46, 0xC5, 0x33, 0xD2, 0x03, 0x6D, 0xB8,
+    0x20, 0xEE, 0xCE, 0xDF, 0x2D, 0xAA, 0x01, 0x7A, 0xD5, 0x6C, 0x78, 0xF1, 0xFD, 0xDC, 0x47, 0x44,
+    0x56, 0x4A, 0xF8, 0x58, 0xB1, 0x27, 0xD8, 0xEF, 0x97, 0x90, 0xD2, 0x79, 0x83, 0x15, 0x22, 0xB2,
+    0xE3, 0x26, 0x9E, 0x5B, 0x57, 0x50, 0x5C, 0xAF, 0xAE, 0x04, 0x70, 0xD8, 0xBC, 0x88, 0x80, 0x44,
+    0x8A, 0x69, 0x77, 0x14, 0xF8, 0xE2, 0xBD, 0x97, 0x77, 0x9A, 0x75, 0xA0, 0x17, 0x7C, 0xEC, 0x08,
+    0x2F, 0x1D, 0x4D, 0xD6, 0x46, 0xE3, 0x51, 0xF0, 0xA7, 0x55, 0x24, 0x7C, 0xC4, 0x29, 0x49, 0xC4,
+    0x19, 0x45, 0x95, 0xD1, 0xE9, 0x0B, 0xE3, 0x8F, 0x00, 0x5F, 0xFC, 0x65, 0xA9, 0xF4, 0x08, 0x44,
+    0x53, 0x31, 0xB7, 0x3B, 0x3A, 0xC8, 0x9A, 0x47, 0x5C, 0x2E, 0x34, 0xCF, 0x64, 0x8A, 0xA0, 0x7B,
+    0x1B, 0xEE, 0xCA, 0x83, 0x1C, 0xA8, 0x56, 0xED, 0xBA, 0xF3, 0x61, 0xE9, 0x1D, 0xC1, 0xDD, 0xB6,
+    0x50, 0x0B, 0xB4, 0x30, 0x73, 0x47, 0x2C, 0x9D, 0x8C, 0x39, 0x92, 0xA9, 0x8A, 0x1B, 0xA1, 0x17,
+    0xA2, 0x3D, 0x9D, 0xBA, 0x7E, 0xB1, 0x18, 0x50, 0xA8, 0x59, 0xB2, 0xF6, 0x09, 0x37, 0xF2, 0x9F,
+    0xA8, 0xCF, 0xA4, 0x19, 0x63, 0xF6, 0x4B, 0xA0, 0x32, 0x1F, 0xE2, 0xAC, 0xEA, 0x35, 0x42, 0x39,
+    0x12, 0x90, 0x38, 0x98, 0xE9, 0xD6, 0x1E, 0xD6, 0x43, 0x20, 0x45, 0x58, 0x0E, 0xEE, 0x09, 0x4D,
+    0x0A, 0xFE, 0x13, 0x1C, 0x66, 0x40, 0xBD, 0x7D, 0xF2, 0x79, 0x29, 0xA7, 0x44, 0xDD, 0x8C, 0x4F,
+    0x9D, 0x71, 0x4D, 0x51, 0xDA, 0x83, 0x62, 0xFA, 0xAF, 0x78, 0x44, 0xD1, 0x90, 0xD7, 0x06, 0x96,
+    0xA3, 0xEC, 0x7A, 0x32, 0xB6, 0xAD, 0x38, 0xC0, 0xA2, 0x43, 0x34, 0xBC, 0xEB, 0x57, 0xC5, 0xCB,
+    0x35, 0x9D, 0xE5, 0x62, 0x7F, 0xD7, 0x2D, 0x3E, 0x0E, 0x5E, 0xBA, 0x7F, 0xBD, 0x0C, 0xD9, 0x25,
+    0x10, 0x96, 0x0B, 0x7F, 0x51, 0x33, 0xD2, 0x56, 0x94, 0xFC, 0xD6, 0x5D, 0xCC, 0x1A, 0x71, 0x44,
+    0xA7, 0xC1, 0x47, 0x6E, 0xEE, 0x2E, 0x50, 0xD2, 0x8A, 0x1B, 0x15, 0x3D, 0x6A, 0x86, 0xCF, 0xA2,
+    0x13, 0x8E, 0x86, 0xA6, 0xB2, 0x99, 0x57, 0x7D, 0xF5, 0x8B, 0x85, 0x96, 0x4D, 0x2C, 0x37, 0x83,
+    0x1F, 0x54, 0xB2, 0xE3, 0x1B, 0xBC, 0x8F, 0x50, 0x53, 0xC1, 0x0D, 0x54, 0xE0, 0x18, 0x46, 0x13,
+    0xA1, 0xA5, 0x42, 0xC1, 0xA2, 0xF8, 0x56, 0xC0, 0xE7, 0x9A, 0xAA, 0x2A, 0xEB, 0x7E, 0x29, 0x55,
+    0x3A, 0xBB, 0x5D, 0xA3, 0x7D, 0xAD, 0xE2, 0x1E, 0xD2, 0x56, 0xA4, 0x3E, 0x88, 0xBB, 0x22, 0xD0,
+    0x94, 0xDD, 0x40, 0x7D, 0x32, 0x44, 0x83, 0x39, 0x5C, 0x96, 0x80, 0x1D, 0xCD, 0x77, 0x26, 0x55,
+    0x01, 0x7B, 0x26, 0x27, 0xA1, 0x45, 0xAB, 0xFA, 0x27, 0xA9, 0x65, 0x4A, 0xF6, 0x38, 0x78, 0x0B,
+    0xB4, 0x11, 0xC3, 0x7D, 0x80, 0x08, 0xC3, 0x87, 0x3E, 0x99, 0x8D, 0xED, 0x51, 0x4A, 0x33, 0x1B,
+    0xA5, 0xD9, 0x15, 0x4D, 0x55, 0xC7, 0x48, 0x66, 0xC2, 0x74, 0xED, 0xAE, 0x63, 0xD8, 0x53, 0x84,
+    0x33, 0x6A, 0xD6, 0xF6, 0x1E, 0x6A, 0x05, 0xFC, 0xA4, 0x66, 0xCD, 0x2C, 0x2C, 0xC6, 0x49, 0x87,
+    0x57, 0x0D, 0xE5, 0x1D, 0x99, 0xA4, 0x26, 0xB3, 0x2C, 0x4D, 0x12, 0x59, 0xD2, 0xB8, 0xA9, 0x34,
+    0x1B, 0x5E, 0x6A, 0xB4, 0x86, 0xCC, 0xAF, 0x9F, 0x00, 0x42, 0x7D, 0xFC, 0x5C, 0x18, 0xF7, 0x2C,
+    0x94, 0x9C, 0x15, 0xA7, 0x8C, 0xF0, 0x62, 0x20, 0xDF, 0x06, 0x89, 0x29, 0x45, 0x93, 0x2A, 0x0B,
+    0x35, 0x87, 0x74, 0x8A, 0x98, 0x61, 0xD9, 0x51, 0xAD, 0xEF, 0x7A, 0xD9, 0xC4, 0x4D, 0x28, 0xE6,
+    0xD3, 0x59, 0xD9, 0x75, 0xA1, 0x43, 0x43, 0x2F, 0x5E, 0x13, 0x51, 0xA6, 0x68, 0x74, 0xAF, 0x27,
+    0x9B, 0x35, 0x21, 0xDB, 0x59, 0xEA, 0xE8, 0x12, 0x34, 0x39, 0x3C, 0x7D, 0x89, 0x2A, 0x0D, 0x1A,
+    0xC9, 0x5E, 0x9F, 0xCC, 0x69, 0x4B, 0xC2, 0xB1, 0xAE, 0x3F, 0xCD, 0x95, 0x31, 0x8E, 0xD5, 0x30,
+    0x10, 0x86, 0x27, 0xF1, 0xB2, 0x91, 0x48, 0xE1, 0x86, 0xDE, 0x47, 0xC8, 0x11, 0x1C, 0x41, 0xB9,
+    0x0D, 0xE7, 0xD8, 0x43, 0x90, 0x70, 0x03, 0x8E, 0x40, 0x89, 0xF6, 0x10, 0xC4, 0x12, 0x05, 0x05,
+    0x05, 0xE1, 0x06, 0x39, 0x82, 0x8B, 0x08, 0x65, 0xC1, 0xF1, 0xF0, 0xFF, 0x7E, 0xEF, 0xA1, 0xF7,
+    0x68, 0x69, 0x92, 0x62, 0x94, 0x38, 0x9E, 0xF1, 0x37, 0xBF, 0x3D, 0x63, 0x11, 0xA9, 0x9E, 0x7A,
+    0x11, 0xB1, 0x3B, 0x8C, 0xE8, 0x0C, 0xD3, 0x26, 0xBE, 0x0E, 0x01, 0xC6, 0x6C, 0x72, 0xFB, 0x38,
+    0xCE, 0x68, 0x55, 0x23, 0xE6, 0xD2, 0xDA, 0x62, 0x75, 0x6F, 0x74, 0x6E, 0x74, 0x34, 0x1A, 0xFC,
+    0x26, 0x8D, 0xD6, 0x1A, 0xC4, 0x26, 0x86, 0xF4, 0xAB, 0xE7, 0xD4, 0x1F, 0x18, 0x30, 0xFA, 0x90,
+    0xB1, 0x4E, 0xF2, 0x2B, 0x86, 0x23, 0x06, 0x2A, 0xFD, 0xA2, 0x08, 0x96, 0x6D, 0x2A, 0xF3, 0x56,
+    0x81, 0x9B, 0x2E, 0x62, 0x33, 0xDD, 0x35, 0x1A, 0x9D, 0x9D, 0xF6, 0x58, 0x4B, 0xB7, 0xB2, 0xCC,
+    0x48, 0x0B, 0xDF, 0x46, 0x0B, 0xEA, 0xAB, 0x13, 0xD0, 0xE3, 0x47, 0xE1, 0xD0, 0x42, 0x62, 0xB8,
+    0x49, 0xB3, 0x4F, 0x23, 0xE1, 0xA7, 0x9E, 0xF0, 0x9F, 0x0F, 0x4E, 0x2F, 0x02, 0xED, 0xDD, 0x6A,
+    0x19, 0x2E, 0xE3, 0x87, 0x2D, 0x6C, 0xEF, 0xE0, 0x29, 0x75, 0xBC, 0x5F, 0x0E, 0x4F, 0x4F, 0xAA,
+    0xF7, 0x3C, 0x2E, 0x6A, 0xF9, 0x37, 0x79, 0x10, 0xDA, 0x05, 0x91, 0xE5, 0x4E, 0x8E, 0x7E, 0x72,
+    0xE4, 0xA5, 0xC8, 0xDC, 0x8D, 0x66, 0x1D, 0x16, 0x9B, 0xDC, 0xE6, 0x63, 0x93, 0x35, 0x54, 0x8A,
+    0xC0, 0x03, 0xC3, 0xE2, 0xE4, 0x6B, 0xC6, 0xD2, 0x3A, 0xDA, 0x34, 0x2C, 0x3E, 0x62, 0x46, 0x68,
+    0x92, 0x95, 0x2A, 0x9E, 0x76, 0xED, 0xF2, 0x18, 0x54, 0x90, 0xEE, 0xBE, 0x97, 0x49, 0x35, 0x95,
+    0xE5, 0x66, 0x26, 0xA8, 0xC8, 0x75, 0xEC, 0xB2, 0x0C, 0xAB, 0x68, 0x32, 0xA4, 0x89, 0x2E, 0x61,
+    0x4E, 0x40, 0xBA, 0xBF, 0xF4, 0x8D, 0x8A, 0xFF, 0xB6, 0xBB, 0xCD, 0xA4, 0x2E, 0x4E, 0x73, 0x17,
+    0x90, 0x4F, 0xB5, 0x1B, 0x05, 0x07, 0x58, 0x90, 0xA2, 0x0C, 0x8B, 0x7E, 0x47, 0x1E, 0x46, 0xA7,
+    0xDE, 0x25, 0x0B, 0x78, 0x9D, 0x3B, 0x90, 0xC0, 0x2D, 0x55, 0xF8, 0xC2, 0x5A, 0xDA, 0xD7, 0x25,
+    0xC1, 0x8E, 0xAF, 0x92, 0x07, 0xCA, 0x1B, 0x5F, 0x5C, 0x81, 0x3D, 0x7E, 0x20, 0x1D, 0xF7, 0x42,
+    0x3A, 0x32, 0x0B, 0x0B, 0x43, 0x4C, 0x29, 0xEE, 0x76, 0xBE, 0xDE, 0x9A, 0x0A, 0x0A, 0x4D, 0xA1,
+    0x5B, 0x21, 0x31, 0x48, 0x05, 0x5B, 0x11, 0x05, 0x6C, 0x0A, 0x59, 0xFB, 0x61, 0x81, 0xE4, 0xED,
+    0xCE, 0x40, 0xD0, 0x76, 0x88, 0x90, 0xBC, 0xC9, 0x15, 0x5E, 0x81, 0x0D, 0x75, 0x53, 0xFD, 0x8F,
+    0xC3, 0x48, 0x87, 0xB5, 0xA5, 0x72, 0x98, 0x02, 0x07, 0xF8, 0xE2, 0x6B, 0x5A, 0xE0, 0xD3, 0x20,
+    0xDC, 0x26, 0x9E, 0xE2, 0xD4, 0x45, 0xA7, 0xB6, 0x6C, 0x8B, 0x53, 0x76, 0x99, 0xEA, 0xED, 0x79,
+    0x57, 0x3E, 0x15, 0x6C, 0x26, 0x32, 0x91, 0xD2, 0xAD, 0x7F, 0xA9, 0x6F, 0xAB, 0xF9, 0x48, 0xD4,
+    0xF5, 0x53, 0xE9, 0x9E, 0xA4, 0xF4, 0xDC, 0x08, 0xFB, 0x0C, 0xDD, 0xCD, 0xDE, 0x6C, 0x84, 0x76,
+    0xE1, 0xA8, 0x5A, 0xF3, 0x69, 0x22, 0xCE, 0xAE, 0xE8, 0x03, 0xC6, 0xED, 0x0A, 0x38, 0x99, 0xDA,
+    0x72, 0xC2, 0xEF, 0x8E, 0xAA, 0xF5, 0x3D, 0xB5, 0x66, 0x2B, 0x28, 0x87, 0x84, 0x47, 0xBB, 0xE2,
+    0x21, 0xB7, 0xD7, 0xDD, 0x72, 0x0A, 0xD2, 0xFD, 0x64, 0x85, 0x7C, 0xCD, 0xB8, 0xD9, 0x40, 0xA4,
+    0xA8, 0xE0, 0x86, 0xEB, 0xF9, 0x58, 0xE9, 0x6B, 0xF4, 0x9B, 0x8C, 0x6A, 0xB4, 0x09, 0x94, 0xDD,
+    0xEF, 0x9D, 0x57, 0x47, 0x69, 0x4B, 0x8C, 0xB9, 0xB2, 0x4B, 0x61, 0xC7, 0x1C, 0x37, 0x13, 0xA8,
+    0x88, 0xDE, 0x9F, 0xEF, 0x44, 0x36, 0x24, 0x29, 0x97, 0x4C, 0x66, 0x51, 0xAD, 0xA7, 0x85, 0xCE,
+    0x35, 0x66, 0x89, 0xE8, 0xB6, 0xCB, 0x0F, 0x5F, 0x8C, 0x3E, 0xD3, 0x40, 0xBC, 0x81, 0xCD, 0x6E,
+    0x62, 0x32, 0x1A, 0x90, 0xA1, 0x06, 0x87, 0x3A, 0x0E, 0x16, 0x66, 0x2C, 0x0A, 0x39, 0xE8, 0x8A,
+    0x9E, 0x63, 0xB4, 0x52, 0x70, 0xAA, 0x2E, 0xEC, 0x5E, 0x01, 0xDD, 0x24, 0xB3, 0xA5, 0xA0, 0xB5,
+    0xED, 0xFD, 0x4D, 0xF4, 0x78, 0x31, 0xFF, 0xF9, 0xFC, 0x01, 0xBD, 0x55, 0xBD, 0xAE, 0xD6, 0x46,
+    0x10, 0x1D, 0xDB, 0xBA, 0x38, 0x92, 0x8B, 0x4D, 0x93, 0x86, 0x66, 0xFB, 0x34, 0x7E, 0x82, 0x68,
+    0x1D, 0x51, 0x52, 0xE4, 0x16, 0xA1, 0xA2, 0xA6, 0x48, 0x9A, 0xBC, 0x41, 0xD6, 0xA9, 0x6E, 0x09,
+    0x05, 0x7D, 0x1A, 0x8A, 0x04, 0x0A, 0x5E, 0x00, 0xB0, 0x3B, 0x0A, 0x1A, 0x03, 0x82, 0x26, 0x05,
+    0x56, 0x08, 0x5C, 0x89, 0x86, 0x2D, 0x56, 0x8A, 0x41, 0x6B, 0x9F, 0x9C, 0x59, 0x7F, 0x17, 0xE8,
+    0x09, 0xF7, 0x93, 0xF6, 0xE7, 0x9B, 0xDD, 0x9D, 0x9F, 0x33, 0x73, 0xC6, 0x22, 0x22, 0x57, 0x3A,
+    0x4E, 0xE2, 0x11, 0x39, 0x1B, 0x60, 0xE1, 0x82, 0xBC, 0xD4, 0x78, 0x8E, 0x20, 0xE2, 0x96, 0x02,
+    0x23, 0x65, 0x63, 0x05, 0xCA, 0x36, 0x31, 0x49, 0xA4, 0x8D, 0x82, 0x59, 0x65, 0x2D, 0x65, 0x15,
+    0x2A, 0xBD, 0x67, 0x17, 0xB7, 0xF2, 0xED, 0xF0, 0x58, 0x6F, 0x97, 0xB8, 0xBC, 0xA9, 0xBE, 0xD4,
+    0xF2, 0xB6, 0xB8, 0xE0, 0x79, 0x54, 0xA0, 0x1F, 0xB8, 0x34, 0xAB, 0xE8, 0xE2, 0x82, 0xF8, 0xA4,
+    0x2A, 0xC4, 0x07, 0x51, 0xD5, 0xDC, 0xD9, 0x25, 0xEF, 0x86, 0xA7, 0xCF, 0xBC, 0xEE, 0xE8, 0xCD,
+    0x48, 0x15, 0x0E, 0xBC, 0xEE, 0xC3, 0x80, 0x5E, 0x55, 0x1C, 0x75, 0x59, 0x85, 0x64, 0xB5, 0x3A,
+    0x57, 0x6A, 0x8F, 0x73, 0x96, 0x19, 0x64, 0x99, 0x43, 0xBE, 0x80, 0x29, 0x2F, 0x52, 0xDE, 0xCE,
+    0xBE, 0xE8, 0xA4, 0xE1, 0x59, 0xBD, 0xD3, 0xEA, 0x59, 0xDB, 0xEF, 0x17, 0xE4, 0x9A, 0xFE, 0x81,
+    0x09, 0x25, 0xE0, 0x19, 0x14, 0xB6, 0x02, 0xEF, 0x11, 0x0D, 0x0A, 0x4C, 0x3E, 0x54, 0x28, 0xD1,
+    0x9B, 0x44, 0x05, 0x6E, 0x76, 0xA1, 0xC0, 0xF7, 0xE8, 0x9B, 0x44, 0x24, 0x5C, 0x68, 0x15, 0x9B,
+    0x61, 0x36, 0x9B, 0x2E, 0xB1, 0xC2, 0x5B, 0x8C, 0x74, 0x1A, 0x62, 0x71, 0xBA, 0x88, 0x5D, 0xDB,
+    0x59, 0x8A, 0x83, 0x81, 0xDB, 0x37, 0xE8, 0xB6, 0x7A, 0xC5, 0x68, 0xA5, 0x52, 0x6C, 0x78, 0x28,
+    0xC5, 0x2A, 0xE7, 0xE4, 0xC0, 0xB7, 0xB7, 0x34, 0x29, 0x41, 0x8D, 0xCC, 0xDC, 0xB8, 0x89, 0xF6,
+    0xDD, 0x58, 0xAE, 0xE2, 0xBA, 0x73, 0x42, 0x40, 0x8E, 0xA5, 0x59, 0xEA, 0x49, 0xB0, 0x0D, 0x2C,
+    0x2D, 0x16, 0x98, 0xBB, 0xCC, 0xCC, 0xC5, 0xF2, 0x9F, 0xF3, 0x4A, 0x81, 0xA6, 0x7F, 0xBC, 0xCF,
+    0xF2, 0x3A, 0x49, 0xCC, 0x40, 0x1B, 0xA4, 0x09, 0xBE, 0xE3, 0xE9, 0xD7, 0xE7, 0xE4, 0x80, 0x9D,
+    0xB4, 0x4C, 0x99, 0x75, 0xFB, 0x3B, 0x77, 0xF7, 0x4C, 0x27, 0x65, 0xF8, 0x8E, 0x94, 0x3A, 0x0D,
+    0x5A, 0xB7, 0xAC, 0xC4, 0xFA, 0x0C, 0x8A, 0x0B, 0xC7, 0x39, 0x59, 0xA0, 0x3B, 0xFF, 0x26, 0xBA,
+    0x83, 0xD9, 0xE2, 0x2E, 0x3A, 0x04, 0xBB, 0xD6, 0xC8, 0x26, 0xC9, 0x16, 0x12, 0x72, 0x23, 0x5B,
+    0x6C, 0x24, 0x6B, 0x86, 0xD1, 0xCF, 0xD9, 0x43, 0x9B, 0x9A, 0x8D, 0xD4, 0xE4, 0x82, 0xCE, 0x6D,
+    0x48, 0x4A, 0x65, 0x7A, 0xBB, 0xF9, 0xBE, 0xC0, 0x13, 0x56, 0x5D, 0x8E, 0xB5, 0xB8, 0x99, 0x83,
+    0x65, 0xAC, 0x2F, 0xC8, 0x10, 0xE0, 0x05, 0x10, 0xD5, 0x0A, 0x90, 0x6A, 0xFC, 0x85, 0x95, 0x61,
+    0x6E, 0x34, 0x5F, 0x27, 0x9B, 0x18, 0x53, 0x93, 0x94, 0xED, 0x63, 0x9B, 0x48, 0x37, 0xBC, 0x41,
+    0xD4, 0xE8, 0x41, 0x48, 0x66, 0x3E, 0xD9, 0xC4, 0x4F, 0x15, 0xDE, 0x1F, 0xCB, 0x30, 0xD5, 0x5A,
+    0xDC, 0x84, 0x61, 0xAF, 0xF1, 0x16, 0x7D, 0xA1, 0x0E, 0xE0, 0xD5, 0x2F, 0xBD, 0xCB, 0xAA, 0x7B,
+    0x83, 0x53, 0x2E, 0x5D, 0x8D, 0x93, 0x97, 0x78, 0x97, 0x3D, 0xF9, 0x46, 0x9D, 0xF9, 0xA9, 0x23,
+    0x52, 0x49, 0x06, 0x68, 0xA0, 0x4B, 0x8D, 0xD7, 0x51, 0x55, 0x58, 0x92, 0xD5, 0xC5, 0x9D, 0xE2,
+    0xCA, 0x18, 0x3F, 0xAB, 0xF2, 0x7D, 0xE8, 0xDE, 0xC7, 0x82, 0x7A, 0x87, 0xDE, 0x52, 0x71, 0xC3,
+    0xC1, 0x10, 0x29, 0x64, 0x29, 0x83, 0x63, 0x20, 0xBC, 0x76, 0xCE, 0xC3, 0x30, 0x40, 0xC3, 0x32,
+    0xCB, 0x1D, 0xA3, 0xFC, 0x53, 0x72, 0x9B, 0x21, 0x66, 0xDA, 0x8D, 0x0E, 0x4D, 0xA0, 0x5C, 0x76,
+    0xD0, 0x8B, 0x6B, 0xCA, 0x50, 0xA6, 0x8C, 0x5D, 0x87, 0x23, 0x9A, 0xAD, 0xDE, 0xCC, 0x2A, 0x38,
+    0x61, 0x92, 0xFF, 0x46, 0xE7, 0x23, 0x83, 0x4F, 0x9E, 0x18, 0xE9, 0x61, 0x83, 0x37, 0x5D, 0xA9,
+    0xB6, 0xD4, 0x19, 0x3A, 0xFB, 0x55, 0x85, 0x57, 0x03, 0x9B, 0x28, 0xE1, 0x22, 0xE0, 0xDC, 0x50,
+    0xFC, 0xE3, 0x4E, 0xFC, 0x5E, 0x5B, 0x28, 0x55, 0x6F, 0x6A, 0x93, 0x2F, 0x48, 0x3D, 0x69, 0xE6,
+    0x43, 0xA6, 0x8F, 0x6E, 0xEE, 0x46, 0xEB, 0x9C, 0x26, 0xC2, 0xE3, 0x16, 0xBB, 0xA8, 0xD5, 0xDF,
+    0x08, 0xD8, 0xD2, 0xC6, 0x1A, 0x97, 0x70, 0x07, 0xC1, 0xE7, 0xD4, 0xB0, 0xC5, 0x0D, 0xDB, 0xAD,
+    0x3D, 0x16, 0xB5, 0x4B, 0xC8, 0x4B, 0x71, 0xDB, 0xD5, 0xFC, 0x52, 0xB2, 0x61, 0xAB, 0x8D, 0xFB,
+    0xA8, 0x3B, 0x63, 0xBC, 0x86, 0x9E, 0x3B, 0x23, 0xAE, 0x07, 0x1A, 0xF6, 0x7D, 0x33, 0x17, 0xE9,
+    0x8B, 0x5B, 0x56, 0x30, 0x93, 0x19, 0x05, 0x3F, 0x90, 0xE4, 0x4F, 0x57, 0x31, 0x61, 0x10, 0xE9,
+    0x8A, 0x2F, 0x07, 0x33, 0xFB, 0xBB, 0xD6, 0x68, 0x5F, 0x27, 0xCD, 0xF9, 0xAF, 0xBB, 0xA1, 0x61,
+    0x22, 0x59, 0x69, 0x63, 0xA1, 0x02, 0x47, 0xFE, 0xB2, 0x96, 0xC8, 0xD7, 0x83, 0xD4, 0x90, 0xB4,
+    0x7D, 0x1B, 0xCF, 0xA4, 0x22, 0x3F, 0xDF, 0x50, 0xFD, 0x87, 0xEF, 0x10, 0x39, 0x5B, 0xC5, 0x0F,
+    0x4D, 0x83, 0xE5, 0x64, 0xD2, 0xD9, 0xF7, 0x49, 0xBD, 0x71, 0xFB, 0x07, 0x8B, 0x8B, 0x3E, 0xFD,
+    0x78, 0xCC, 0x8F, 0x0B, 0xB5, 0xAA, 0x2B, 0x9F, 0x1C, 0xCB, 0xC5, 0x3F, 0x18, 0xEF, 0xC4, 0xE2,
+    0x96, 0xE1, 0x51, 0x64, 0xD3, 0x7D, 0x18, 0xE5, 0xC1, 0xFF, 0xA4, 0xFA, 0xB3, 0x7F, 0xFF, 0x01,
+    0xBD, 0x55, 0x3D, 0xCE, 0xDD, 0x44, 0x14, 0xBD, 0x63, 0x27, 0x9F, 0x0B, 0x17, 0x93, 0x22, 0x0D,
+    0xA1, 0x70, 0x4F, 0x33, 0x1B, 0x40, 0x1A, 0xB3, 0x82, 0xA4, 0x80, 0x25, 0x50, 0x50, 0xB1, 0x03,
+    0xE6, 0x41, 0x43, 0x91, 0x22, 0x74, 0x94, 0x34, 0x14, 0xF0, 0x1A, 0x56, 0x10, 0xCD, 0x44, 0x29,
+    0x28, 0x52, 0xC4, 0x12, 0x1B, 0x98, 0x08, 0x7A, 0x2C, 0xE1, 0xC2, 0xC9, 0x67, 0xFB, 0xE4, 0xDC,
+    0xB1, 0x1F, 0x49, 0x24, 0x44, 0xF7, 0x7D, 0x96, 0x3C, 0x7A, 0x7E, 0x33, 0x77, 0xCE, 0xB9, 0x3F,
+    0xE7, 0x5E, 0x11, 0x91, 0xB5, 0xCD, 0xF1, 0xFB, 0xC5, 0xBD, 0x42, 0x33, 0xFA, 0xFE, 0x9E, 0x91,
+    0xE3, 0x89, 0x83, 0xF8, 0x51, 0xEC, 0x22, 0xCD, 0x26, 0x15, 0x7A, 0x41, 0xFA, 0xCF, 0xEF, 0xF9,
+    0xC3, 0xEF, 0x6E, 0xBE, 0xD8, 0xB7, 0xA7, 0x4F, 0xC5, 0xE0, 0xEB, 0x2C, 0x0E, 0xAB, 0x48, 0xE0,
+    0xDB, 0xF1, 0x48, 0x0B, 0xF0, 0x6A, 0x37, 0x4A, 0xDD, 0xE3, 0xC4, 0x43, 0x8B, 0xB8, 0x35, 0xA4,
+    0x0E, 0xD7, 0x4B, 0x03, 0x20, 0xE1, 0x0D, 0x16, 0xBF, 0xD4, 0x78, 0x0E, 0x71, 0x4B, 0xC8, 0x06,
+    0x2F, 0x56, 0x71, 0x33, 0x52, 0x85, 0x87, 0x0B, 0xAF, 0x47, 0x6A, 0xD0, 0xAE, 0x82, 0x21, 0xBC,
+    0x8E, 0x73, 0x4D, 0x03, 0xB1, 0x34, 0x22, 0xC2, 0x20, 0x72, 0xB7, 0xDF, 0x71, 0xEF, 0x10, 0x6C,
+    0xF0, 0x84, 0xDE, 0x56, 0xE1, 0x11, 0xF2, 0x7D, 0x85, 0x49, 0xDA, 0xF4, 0xF1, 0xE9, 0xC2, 0xEC,
+    0x4B, 0x32, 0x68, 0x89, 0x0E, 0x87, 0x2C, 0x88, 0x18, 0x0D, 0xD6, 0x38, 0x55, 0xC8, 0x8E, 0x4B,
+    0x72, 0x53, 0x8D, 0x5E, 0x17, 0xE2, 0xD1, 0x35, 0x3F, 0x12, 0xD0, 0x67, 0xFA, 0x1D, 0x06, 0x2E,
+    0x71, 0xA0, 0xC7, 0x48, 0xDD, 0xC4, 0xC5, 0xD1, 0xF0, 0xE4, 0xB9, 0xF4, 0x7E, 0xAC, 0x20, 0x21,
+    0xD3, 0x46, 0xAE, 0x7E, 0x25, 0x02, 0x03, 0x41, 0x02, 0x1A, 0x04, 0x0D, 0x87, 0x4F, 0x5C, 0x9E,
+    0x1E, 0xE0, 0x57, 0x3F, 0x68, 0x20, 0x46, 0x0D, 0xC4, 0x50, 0xA9, 0x07, 0x61, 0x8B, 0x93, 0xDD,
+    0x0C, 0x9E, 0x21, 0xD9, 0xC5, 0xF3, 0x5E, 0xFA, 0x6E, 0xE9, 0xBB, 0xE0, 0xF7, 0x8D, 0x3F, 0xE2,
+    0x60, 0xF0, 0x98, 0x0C, 0xA6, 0x90, 0x1B, 0x34, 0x30, 0xC8, 0x7E, 0xC3, 0x62, 0xD4, 0xB2, 0x55,
+    0xDF, 0xBB, 0xF7, 0x7C, 0x3F, 0xD3, 0x45, 0x4F, 0xC4, 0x76, 0x53, 0x78, 0xFE, 0xE7, 0xB9, 0xD7,
+    0xE6, 0x9B, 0x47, 0xFE, 0xE4, 0x67, 0x61, 0x26, 0x12, 0xE3, 0xCD, 0x34, 0xE3, 0xC9, 0x48, 0xE0,
+    0x70, 0x6A, 0xB3, 0x59, 0x6E, 0xDE, 0x67, 0x79, 0x24, 0xDD, 0xD4, 0x26, 0xC1, 0x16, 0x75, 0x73,
+    0x12, 0xCF, 0xD4, 0x9A, 0xB1, 0xFA, 0xEB, 0xF0, 0xFA, 0x41, 0xBF, 0x63, 0x57, 0xBA, 0xE7, 0xA0,
+    0xC9, 0x7E, 0x83, 0x41, 0xC1, 0x53, 0x18, 0x6B, 0x30, 0xD7, 0x76, 0xB1, 0x5A, 0x5B, 0x8A, 0xFE,
+    0x0C, 0xA7, 0x5A, 0x0B, 0xAC, 0x9B, 0xDD, 0xA4, 0x55, 0x96, 0x15, 0x3C, 0x05, 0x96, 0xDA, 0xDF,
+    0x5A, 0x7A, 0x2C, 0xA6, 0x82, 0xDF, 0xF0, 0x2A, 0x91, 0xCF, 0x2F, 0xF5, 0x24, 0xDF, 0xD4, 0x14,
+    0xC2, 0xA4, 0x15, 0x65, 0x27, 0xB1, 0x39, 0x8A, 0xDC, 0x93, 0xFE, 0xA6, 0x5D, 0x37, 0xD3, 0x51,
+    0x63, 0x81, 0xE5, 0xD5, 0xB1, 0xE0, 0xAA, 0xA9, 0x20, 0x56, 0xE7, 0xF3, 0xF9, 0x17, 0x9E, 0x87,
+    0xE7, 0xFB, 0x92, 0xEF, 0x58, 0xFE, 0x36, 0xB4, 0xA9, 0x97, 0xF7, 0x4C, 0x6C, 0x2E, 0xC1, 0xBB,
+    0x3C, 0x5F, 0x5D, 0xF1, 0xEF, 0x1D, 0x65, 0x96, 0x08, 0x75, 0xF7, 0x47, 0x2D, 0xEC, 0x8E, 0x1C,
+    0xBE, 0x05, 0x43, 0x64, 0x31, 0xFA, 0x0C, 0xF2, 0x7E, 0xFC, 0x0F, 0x9A, 0x35, 0xD8, 0xC5, 0x5D,
+    0x93, 0x64, 0xC4, 0x77, 0xF8, 0x0C, 0xB3, 0xA5, 0x7C, 0x13, 0xB2, 0xC5, 0x6F, 0x28, 0x41, 0x96,
+    0x43, 0x9B, 0x83, 0x38, 0xF3, 0x48, 0xC3, 0xB1, 0x33, 0x53, 0x45, 0xB0, 0x42, 0xB4, 0x6B, 0xEC,
+    0x9C, 0xA5, 0x1B, 0x74, 0xF9, 0x57, 0x9A, 0xE4, 0x08, 0xE6, 0x53, 0x85, 0x96, 0x54, 0x4F, 0x95,
+    0xA6, 0x87, 0x4D, 0x22, 0x64, 0x95, 0x58, 0xAF, 0x31, 0x2B, 0x9A, 0xD4, 0xF4, 0x9C, 0x90, 0xDA,
+    0x4D, 0x65, 0x3A, 0xD9, 0x99, 0x59, 0xA2, 0x46, 0x41, 0x51, 0xC6, 0x92, 0xAC, 0xC1, 0x62, 0xE5,
+    0x45, 0xF8, 0x73, 0x91, 0x6E, 0xB5, 0xA3, 0xDC, 0x3D, 0x6E, 0x3F, 0x33, 0x1D, 0x2D, 0x0E, 0x85,
+    0xAA, 0x5C, 0xC5, 0x31, 0x0C, 0x66, 0x95, 0x5B, 0x22, 0xF0, 0x80, 0x42, 0xA9, 0xB4, 0x7A, 0x5C,
+    0x29, 0x49, 0xEA, 0xD3, 0x65, 0x9F, 0x88, 0xEF, 0xFB, 0x5B, 0x8A, 0x80, 0x46, 0x7F, 0x60, 0x33,
+    0x62, 0xCB, 0x97, 0x6A, 0x63, 0x23, 0x6E, 0xC6, 0xD0, 0x8B, 0x39, 0x52, 0x74, 0x0B, 0x04, 0x4A,
+    0x83, 0x94, 0x30, 0xCA, 0x91, 0x80, 0x92, 0x0A, 0x52, 0xD9, 0x99, 0xC9, 0x07, 0x8F, 0xCF, 0x12,
+    0xA9, 0x0C, 0x8A, 0x52, 0xCF, 0xBA, 0x59, 0xC7, 0x8F, 0xF6, 0xFB, 0x51, 0x3B, 0x5C, 0x48, 0xB4,
+    0x34, 0xCA, 0x4F, 0xEA, 0x95, 0x1B, 0x94, 0x20, 0x67, 0x96, 0xF8, 0x3F, 0xF4, 0x56, 0xFC, 0x34,
+    0xE9, 0xA5, 0x91, 0x85, 0xDE, 0x5C, 0x6B, 0x7A, 0x3B, 0x68, 0xBD, 0xFB, 0x82, 0x88, 0xB9, 0x80,
+    0x6B, 0x5B, 0x6E, 0xB7, 0x77, 0x14, 0x74, 0x20, 0x49, 0xA7, 0x3D, 0xCB, 0xA8, 0xCA, 0x1A, 0x6C,
+    0xB2, 0x8B, 0x97, 0x58, 0xE5, 0x18, 0x8E, 0x3A, 0xFD, 0xA2, 0xBF, 0xD8, 0x94, 0x71, 0x57, 0x4A,
+    0x7A, 0xF7, 0xA5, 0xDC, 0x19, 0x14, 0xA9, 0x9B, 0x3E, 0xD2, 0xF1, 0x16, 0x27, 0xEE, 0x44, 0xEE,
+    0x15, 0x21, 0x52, 0xFC, 0x3A, 0xF0, 0xB4, 0xE9, 0x6C, 0xEC, 0x2F, 0xEA, 0x93, 0x46, 0xD1, 0xAE,
+    0x1C, 0x2E, 0xFA, 0x41, 0xDD, 0x24, 0x9D, 0x34, 0xA3, 0xC6, 0xB4, 0xCC, 0x19, 0x7E, 0xB0, 0x5D,
+    0xA8, 0xA6, 0x8A, 0x9E, 0xD0, 0xD7, 0x5B, 0x44, 0xCF, 0x1E, 0x41, 0xAF, 0xE3, 0x70, 0x5F, 0xD4,
+    0x46, 0x34, 0x2C, 0x07, 0x03, 0x53, 0x38, 0x6A, 0x1C, 0x76, 0x82, 0x76, 0x91, 0xFF, 0x7B, 0xDE,
+    0x02, 0xCD, 0x95, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x86, 0x67, 0xED, 0x80, 0xA5, 0xB8, 0x70, 0xDE,
+    0xC0, 0x35, 0x95, 0x1F, 0x61, 0x1D, 0xF1, 0x00, 0xA4, 0xE0, 0xA8, 0x69, 0x28, 0x28, 0x50, 0x1E,
+    0xC1, 0x16, 0x2D, 0x05, 0x29, 0xE8, 0x28, 0x42, 0x43, 0x13, 0x0A, 0x9E, 0x20, 0x59, 0x4B, 0x94,
+    0x34, 0x27, 0x78, 0x00, 0x2C, 0x81, 0x40, 0x82, 0x02, 0x23, 0x19, 0x61, 0x11, 0xDB, 0xC3, 0xFF,
+    0x8F, 0xEF, 0x02, 0x91, 0x68, 0x23, 0xC5, 0xBA, 0xDD, 0xDB, 0xF3, 0xEE, 0xCE, 0xFC, 0xF3, 0xED,
+    0xCC, 0x9E, 0xC8, 0xF2, 0x9C, 0xA6, 0xAD, 0x48, 0x32, 0xFA, 0x46, 0xA4, 0xF8, 0xA1, 0x78, 0x51,
+    0xDD, 0x1E, 0xD0, 0xEF, 0x39, 0xB9, 0xF4, 0xF8, 0x56, 0x42, 0x2B, 0x5A, 0xC7, 0x2A, 0xF8, 0x14,
+    0x83, 0x64, 0xA3, 0x68, 0x23, 0x45, 0x97, 0xCE, 0xD8, 0xD2, 0xF8, 0x4E, 0x9C, 0x46, 0x5A, 0x4A,
+    0x3C, 0x61, 0x42, 0xB2, 0x3E, 0xAC, 0xB1, 0xE7, 0x3D, 0xED, 0xE9, 0x71, 0x2F, 0x12, 0xCD, 0x01,
+    0x0E, 0x92, 0xF3, 0x09, 0x2F, 0x72, 0x6D, 0x69, 0x90, 0x73, 0xA2, 0xF4, 0x15, 0xC3, 0x90, 0x08,
+    0x0D, 0xE1, 0x75, 0x87, 0x2E, 0xD2, 0x9A, 0xEB, 0x60, 0x08, 0x56, 0x61, 0x28, 0xD1, 0xD9, 0xF6,
+    0x71, 0xAE, 0xB2, 0x65, 0xB6, 0x80, 0xCF, 0x6A, 0x75, 0x00, 0xE1, 0x3A, 0xD1, 0x0A, 0xCD, 0x78,
+    0x1D, 0x2F, 0x0B, 0x0F, 0xF0, 0x2E, 0x19, 0xD7, 0x47, 0x36, 0x55, 0x71, 0x55, 0x76, 0x3E, 0xD2,
+    0x74, 0xC5, 0x0D, 0x1F, 0x31, 0x4C, 0x26, 0x0F, 0x37, 0xFA, 0x06, 0x66, 0xF2, 0x1E, 0xC3, 0x58,
+    0x63, 0x86, 0xB5, 0x2E, 0x5A, 0xC4, 0x19, 0x29, 0x96, 0x96, 0x45, 0x07, 0xDB, 0xAA, 0x92, 0xA2,
+    0xEB, 0x44, 0x39, 0x2C, 0xD0, 0xF5, 0xB1, 0xAE, 0xEE, 0x69, 0x89, 0x70, 0xB3, 0x9E, 0x91, 0xEB,
+    0x63, 0x40, 0xC8, 0x06, 0x86, 0xA1, 0x6F, 0x61, 0x0E, 0xEF, 0xDC, 0x6A, 0x55, 0x62, 0x2D, 0x0C,
+    0x62, 0xF9, 0x46, 0x26, 0x9F, 0x9B, 0x07, 0xD4, 0xD4, 0xD1, 0xCE, 0x2F, 0x38, 0x51, 0x6D, 0x73,
+    0x7D, 0xAD, 0xA5, 0x76, 0xF9, 0x94, 0x28, 0x40, 0x00, 0xB2, 0x36, 0xDA, 0xC4, 0x33, 0x80, 0xE7,
+    0x7D, 0x3E, 0x48, 0x68, 0xAA, 0x36, 0x06, 0xE5, 0x3A, 0x1F, 0x01, 0x0B, 0xCB, 0xC7, 0x54, 0x4B,
+    0x3F, 0x23, 0x2C, 0x6A, 0x72, 0x3A, 0x57, 0xB5, 0xD3, 0x77, 0xF0, 0xB3, 0x67, 0xF6, 0xA3, 0x23,
+    0xF7, 0x02, 0xF1, 0x34, 0x19, 0xA3, 0xFC, 0x4A, 0x6C, 0x6A, 0x04, 0x15, 0x0A, 0x45, 0x0E, 0x8F,
+    0xE4, 0x3F, 0xA0, 0x62, 0x3B, 0x9B, 0x82, 0x12, 0x9D, 0xF2, 0x84, 0x8C, 0x94, 0x54, 0x1F, 0xB0,
+    0x31, 0x9E, 0x99, 0x24, 0x79, 0xCF, 0xED, 0x86, 0x2A, 0x99, 0xB2, 0x9E, 0x27, 0x86, 0xDC, 0x00,
+    0xA0, 0x50, 0x2F, 0xAC, 0x80, 0x2D, 0x1D, 0x19, 0x26, 0x9C, 0x91, 0x50, 0xB3, 0xC0, 0x22, 0xB7,
+    0x49, 0xFC, 0xCF, 0xD5, 0x61, 0xCF, 0x3C, 0xF1, 0x6B, 0xA3, 0x55, 0x03, 0x9C, 0x05, 0x88, 0xBD,
+    0x85, 0x19, 0x93, 0xDD, 0x3A, 0x3A, 0x12, 0x2F, 0xBE, 0x14, 0x7D, 0x35, 0x02, 0x10, 0x12, 0x20,
+    0xE2, 0xF9, 0xBA, 0xB3, 0x72, 0xA3, 0xF4, 0x81, 0x49, 0xCC, 0x3A, 0xCC, 0x55, 0x0D, 0x5C, 0xCC,
+    0x4E, 0x7F, 0x6B, 0x9F, 0x29, 0x72, 0xA5, 0xEA, 0x0C, 0x50, 0x36, 0xC2, 0xBA, 0x6F, 0x3D, 0xA0,
+    0xEC, 0x6B, 0x9D, 0x8E, 0xC9, 0x6C, 0x3C, 0x9D, 0x36, 0xA1, 0xCD, 0x66, 0x7E, 0xE1, 0xDC, 0xBE,
+    0x6B, 0x93, 0x51, 0x59, 0xAE, 0x5F, 0x06, 0xC9, 0x27, 0x9C, 0xB5, 0xFB, 0x17, 0x85, 0x9F, 0xB7,
+    0x24, 0x2C, 0xF1, 0x0C, 0x44, 0x32, 0xE9, 0x86, 0x83, 0xD3, 0x3B, 0xFD, 0x06, 0x43, 0xB5, 0x66,
+    0x3C, 0xA4, 0x90, 0xF7, 0xE9, 0xB0, 0x40, 0x48, 0x26, 0x9C, 0x96, 0x31, 0xE0, 0xC1, 0x8E, 0x0B,
+    0x82, 0x80, 0x6E, 0x6D, 0x04, 0x10, 0xEA, 0x52, 0x28, 0xFA, 0x64, 0x62, 0x0A, 0x32, 0xFE, 0x99,
+    0xD5, 0x43, 0xE4, 0x91, 0xD5, 0x84, 0x75, 0x56, 0x01, 0xAC, 0x19, 0xA9, 0x4A, 0xAB, 0x80, 0x8B,
+    0x6A, 0x29, 0xDA, 0x8D, 0x56, 0xF7, 0x8C, 0x82, 0x51, 0xBF, 0xA9, 0x4E, 0xE6, 0x62, 0x48, 0xF4,
+    0x1B, 0xDC, 0x8C, 0x09, 0x42, 0x6F, 0x32, 0x66, 0x0A, 0xB4, 0x21, 0x63, 0x6B, 0x6D, 0x92, 0x09,
+    0x20, 0x8A, 0x2E, 0x67, 0x62, 0x85, 0x36, 0x21, 0x29, 0x3F, 0xF0, 0x6B, 0x9D, 0x69, 0x50, 0xE6,
+    0xF7, 0x88, 0xFA, 0x38, 0x6E, 0xA5, 0xEA, 0x71, 0x9A, 0x3B, 0x09, 0xB3, 0x25, 0xA0, 0xD9, 0xC0,
+    0xB3, 0xE4, 0x16, 0x01, 0xA8, 0x95, 0x94, 0x59, 0x90, 0xFE, 0xAD, 0xB5, 0xE8, 0xC4, 0x66, 0xEA,
+    0x4D, 0xF1, 0x3A, 0xCB, 0x31, 0xEB, 0xC2, 0xE5, 0x34, 0xCB, 0xF5, 0x13, 0x8B, 0x10, 0x36, 0x58,
+    0x3D, 0x62, 0x74, 0xC2, 0xEC, 0x4E, 0xA5, 0x1A, 0xC0, 0xDF, 0x8F, 0xDB, 0xC2, 0xCF, 0x66, 0x33,
+    0x68, 0x57, 0x00, 0x3D, 0xF3, 0x42, 0x11, 0x6F, 0xC5, 0x3C, 0x6E, 0x67, 0xC4, 0x50, 0x2C, 0x2F,
+    0x67, 0xBB, 0x37, 0xEC, 0xF7, 0x24, 0x8F, 0x84, 0x27, 0x5B, 0xD2, 0xFA, 0x9A, 0x43, 0xAC, 0x08,
+    0xF4, 0x2B, 0x77, 0x2F, 0xC4, 0x52, 0x2B, 0xA5, 0x9A, 0x52, 0xB6, 0xAD, 0x4E, 0xF7, 0x92, 0x22,
+    0x47, 0xE6, 0x2E, 0x5B, 0x9D, 0xEB, 0x73, 0xE0, 0xE1, 0x25, 0xC4, 0x4D, 0xE5, 0xE2, 0xB4, 0x02,
+    0x11, 0x60, 0xB4, 0x4B, 0xCB, 0x02, 0xAE, 0x70, 0x1E, 0xF9, 0x24, 0xF7, 0x63, 0x3D, 0x1F, 0x10,
+    0xDE, 0xCC, 0x7C, 0xAF, 0x31, 0xA8, 0xB7, 0x3E, 0x4F, 0x58, 0x6F, 0x76, 0x03, 0x59, 0xFD, 0xE9,
+    0x53, 0xDE, 0x10, 0xFB, 0xD8, 0x7E, 0x86, 0x12, 0xBD, 0x6E, 0x80, 0x28, 0x96, 0x5A, 0x6D, 0x09,
+    0x94, 0x52, 0xE8, 0x85, 0xCE, 0x2B, 0x02, 0xB4, 0x23, 0xDB, 0xB4, 0xB6, 0xF0, 0x92, 0x45, 0x3F,
+    0x33, 0x68, 0xB7, 0xBC, 0x76, 0x19, 0x44, 0xB1, 0x81, 0xC9, 0xD3, 0x58, 0x33, 0x9D, 0xB7, 0x36,
+    0xFA, 0x1E, 0x96, 0x86, 0x27, 0x28, 0x2F, 0x75, 0x94, 0xD7, 0xE7, 0x9E, 0x74, 0x28, 0xC9, 0x2F,
+    0x37, 0x9C, 0xC1, 0x21, 0x8F, 0xB0, 0x69, 0x1C, 0x57, 0xBD, 0xAB, 0xBD, 0x06, 0xD0, 0xC4, 0x85,
+    0x85, 0xE6, 0xF8, 0x87, 0x71, 0xA3, 0x94, 0xAB, 0x7A, 0xFE, 0x00, 0xCD, 0x55, 0x31, 0x8E, 0xDC,
+    0x46, 0x10, 0x6C, 0x72, 0xB1, 0x47, 0xE1, 0x18, 0x30, 0x31, 0x2C, 0xC3, 0x09, 0x73, 0x25, 0x7C,
+    0xC2, 0x10, 0xF0, 0x03, 0xA4, 0x60, 0x37, 0x30, 0x94, 0x5A, 0x81, 0xA3, 0x7B, 0x02, 0x29, 0x38,
+    0x70, 0xBA, 0x81, 0x1E, 0xE0, 0x40, 0xD1, 0x29, 0x50, 0xE2, 0xD4, 0x20, 0x15, 0x39, 0x25, 0x04,
+    0x08, 0x0A, 0x9C, 0xD0, 0x3A, 0x29, 0x90, 0x12, 0x33, 0xA0, 0xEC, 0xB9, 0x03, 0x77, 0xDA, 0x55,
+    0x3D, 0x5C, 0xF9, 0xEC, 0x0F, 0x58, 0x1B, 0x0C, 0x66, 0x67, 0xA6, 0xBB, 0xAA, 0xAB, 0x6B, 0x86,
+    0x22, 0xDF, 0xCB, 0xF9, 0x41, 0x32, 0x9F, 0x79, 0x91, 0xEA, 0x65, 0x10, 0x11, 0xD5, 0x56, 0x24,
+    0xD7, 0x11, 0x53, 0x87, 0xC5, 0xDB, 0xBF, 0x52, 0xDF, 0x72, 0xD0, 0x59, 0x0A, 0x55, 0xAD, 0x37,
+    0x18, 0x26, 0xE9, 0x42, 0xF2, 0x8B, 0x94, 0x88, 0xC4, 0xFF, 0x1E, 0x87, 0x9A, 0x09, 0x43, 0xC1,
+    0x4C, 0x62, 0xFF, 0x4B, 0x26, 0x49, 0xB5, 0x66, 0xBE, 0x19, 0xC3, 0x46, 0xB9, 0xE5, 0xA6, 0x7F,
+    0xA6, 0x71, 0x15, 0xA8, 0x52, 0x2D, 0x16, 0x36, 0x27, 0x3F, 0x47, 0x04, 0x71, 0x04, 0x13, 0x9B,
+    0xA6, 0xAA, 0x07, 0x6C, 0xEE, 0x78, 0x82, 0xA4, 0x8D, 0xB3, 0x51, 0x26, 0x63, 0x23, 0xFC, 0x89,
+    0xEF, 0xD9, 0x13, 0xF2, 0x5C, 0xB0, 0xAA, 0x3D, 0xE2, 0xBC, 0x34, 0xE1, 0xA2, 0x2E, 0x80, 0x96,
+    0x90, 0x12, 0x01, 0x0D, 0x9A, 0x54, 0x33, 0x32, 0xED, 0x10, 0x9C, 0x73, 0xD2, 0x60, 0x92, 0x69,
+    0xFD, 0x15, 0x80, 0xBB, 0x36, 0x61, 0x64, 0xCE, 0xEC, 0x25, 0xB3, 0x6F, 0x59, 0x82, 0xDC, 0xAB,
+    0xCF, 0x7E, 0x42, 0x40, 0xDD, 0xE1, 0x9F, 0x16, 0x33, 0x53, 0xB2, 0xB6, 0x0D, 0x79, 0x22, 0xB4,
+    0xFD, 0x97, 0x60, 0x85, 0xBE, 0x67, 0x52, 0xA6, 0x00, 0x0D, 0x60, 0x17, 0x36, 0xBA, 0x8F, 0x17,
+    0x58, 0xD1, 0x1E, 0x8C, 0x00, 0x5F, 0x2C, 0x52, 0xCD, 0x24, 0x85, 0x9D, 0x6E, 0x00, 0xB1, 0x54,
+    0xDB, 0x72, 0x21, 0x1F, 0xB0, 0xA9, 0x66, 0x4A, 0xA7, 0x03, 0x0E, 0x61, 0x07, 0xAA, 0x95, 0x4B,
+    0xC2, 0xD8, 0x31, 0x3F, 0x02, 0x8D, 0x51, 0x8D, 0x47, 0x60, 0xA6, 0xFD, 0x46, 0xB7, 0x7A, 0x64,
+    0x77, 0x74, 0x90, 0x4E, 0x31, 0x65, 0x7B, 0x5A, 0x22, 0x1E, 0x8C, 0x4B, 0xB2, 0xDB, 0xEE, 0xAC,
+    0x1D, 0x6E, 0x60, 0xC5, 0x2F, 0xD5, 0x54, 0x2F, 0xAC, 0x5B, 0x4B, 0x63, 0xED, 0xB9, 0x62, 0x0D,
+    0x89, 0xD5, 0xF0, 0x08, 0xF9, 0x71, 0x38, 0x54, 0x13, 0x9B, 0x17, 0x28, 0x5B, 0xA5, 0x1A, 0xB8,
+    0xFD, 0x27, 0x4B, 0x2D, 0x82, 0x49, 0xD9, 0x4C, 0x14, 0x12, 0x14, 0xC1, 0x8F, 0x85, 0xB8, 0xD1,
+    0x5A, 0x0B, 0xCA, 0x48, 0x93, 0x61, 0x2D, 0x3B, 0x0A, 0x53, 0xA0, 0x40, 0xA6, 0xED, 0xC6, 0xDC,
+    0x52, 0xF4, 0x8D, 0xB5, 0xE0, 0x0F, 0xA6, 0xA0, 0x24, 0x26, 0xD5, 0x5F, 0xDE, 0x10, 0x4B, 0xD2,
+    0x4B, 0xEA, 0x5B, 0x02, 0x26, 0x06, 0x0C, 0xF8, 0x45, 0xA2, 0xE5, 0x4C, 0x3F, 0xCA, 0xB1, 0x50,
+    0x22, 0xED, 0xC1, 0xB5, 0x38, 0x46, 0xF9, 0x0A, 0x0A, 0x87, 0xA3, 0x75, 0x77, 0x05, 0xEB, 0xE4,
+    0x47, 0x18, 0x48, 0xF4, 0x35, 0x82, 0x8A, 0xE5, 0xAE, 0xEE, 0x88, 0x3C, 0xC2, 0x26, 0x51, 0x3C,
+    0x1D, 0x12, 0x1D, 0x11, 0xD0, 0x2C, 0xA2, 0x2F, 0x1A, 0xAD, 0x4D, 0x3B, 0xF6, 0x69, 0xA6, 0xEF,
+    0x3C, 0xC1, 0xDE, 0xAE, 0xD2, 0xC9, 0xEA, 0x0D, 0xA1, 0x2C, 0xC9, 0xA5, 0x5E, 0x0B, 0x8F, 0x0C,
+    0x3C, 0x82, 0x22, 0xEF, 0x3D, 0xBF, 0x69, 0xA3, 0xC7, 0x93, 0x03, 0xAA, 0x4D, 0xF5, 0x4A, 0xE9,
+    0x4A, 0xB8, 0xCA, 0xB1, 0x11, 0xB9, 0xFE, 0x06, 0x6E, 0x3A, 0xA2, 0xA9, 0x15, 0x9B, 0x05, 0xE6,
+    0x85, 0x8F, 0x32, 0xA1, 0xFD, 0xE5, 0x84, 0xCC, 0xA9, 0x32, 0x33, 0xD4, 0x6B, 0xA8, 0x50, 0xA6,
+    0x09, 0x72, 0xBB, 0xB0, 0x16, 0xDC, 0xAF, 0xE2, 0x38, 0xEF, 0x20, 0xCB, 0x17, 0x51, 0x99, 0xFD,
+    0xFE, 0x01, 0xF4, 0x8C, 0xB7, 0x63, 0x5A, 0x87, 0x5B, 0xBE, 0x43, 0x68, 0xC9, 0xA1, 0x62, 0x21,
+    0x56, 0x8D, 0xFB, 0x88, 0x08, 0xBB, 0x76, 0x56, 0x48, 0x37, 0x9C, 0x2E, 0xA8, 0xBE, 0xDA, 0xD7,
+    0x09, 0xBD, 0xC2, 0xA1, 0x66, 0xFD, 0x40, 0xBD, 0xBC, 0x8C, 0x57, 0xC4, 0xAE, 0x87, 0x79, 0xA1,
+    0xB0, 0x61, 0x39, 0x0D, 0xFF, 0xCD, 0x6E, 0x17, 0x75, 0xBB, 0xDF, 0x93, 0xF1, 0x60, 0x74, 0x9C,
+    0xAE, 0xD7, 0xF1, 0x4B, 0x63, 0xCA, 0xF4, 0x8B, 0x41, 0xE8, 0xD8, 0x8C, 0x70, 0xB4, 0x6F, 0xC6,
+    0x4D, 0xA8, 0xE6, 0x4C, 0xEF, 0x87, 0xE7, 0xFA, 0x2B, 0x36, 0x5E, 0x70, 0xB3, 0x0B, 0x4F, 0xE9,
+    0x16, 0x03, 0xA6, 0xC5, 0x5A, 0x17, 0x1E, 0x4E, 0x19, 0xC1, 0x60, 0x6A, 0x28, 0x13, 0x4E, 0x17,
+    0xF1, 0x29, 0x5E, 0x01, 0x59, 0x04, 0xAC, 0xF4, 0xD9, 0xB2, 0x4A, 0xE1, 0x00, 0x2D, 0x67, 0xD7,
+    0xF2, 0x19, 0x48, 0xF1, 0x75, 0x7D, 0xDE, 0xA6, 0x3E, 0x01, 0xF6, 0x0D, 0xEF, 0x2B, 0xF4, 0xC8,
+    0x68, 0x95, 0xF3, 0x13, 0xB9, 0xED, 0x13, 0xBE, 0xB2, 0x1E, 0xAB, 0x3A, 0x19, 0x9A, 0xF3, 0xA5,
+    0xA7, 0x8B, 0x1F, 0x6B, 0x5B, 0x78, 0xCA, 0xF2, 0x8D, 0x3E, 0xD3, 0x09, 0x6F, 0xC7, 0x92, 0xD1,
+    0x44, 0xD4, 0xC5, 0xC0, 0xE3, 0x13, 0x25, 0xA9, 0x50, 0x18, 0x46, 0xF2, 0x89, 0xC2, 0xBB, 0x40,
+    0xB5, 0xA3, 0x32, 0x66, 0x91, 0x54, 0x4F, 0x0F, 0x6C, 0x66, 0x33, 0x7B, 0x90, 0xBF, 0xFB, 0x1C,
+    0x94, 0x91, 0x84, 0xA7, 0x7D, 0x24, 0x16, 0x1F, 0x64, 0xC0, 0xA4, 0xF1, 0x95, 0x92, 0xE4, 0x51,
+    0xD4, 0x05, 0xA1, 0x3D, 0x3F, 0x35, 0x45, 0xC8, 0x02, 0x65, 0xF9, 0x31, 0x88, 0x7B, 0xA3, 0x75,
+    0x33, 0xEB, 0x07, 0x5D, 0xA8, 0x0A, 0x37, 0x73, 0xFD, 0x50, 0xDB, 0xA7, 0x85, 0x6C, 0x71, 0xBD,
+    0xEE, 0x6C, 0xF4, 0x5D, 0xC7, 0xF7, 0xB6, 0x37, 0x4D, 0x1A, 0x3E, 0xDB, 0xBB, 0xFF, 0xB3, 0xD4,
+    0x8A, 0x6F, 0x29, 0x43, 0x36, 0xBC, 0x0B, 0x19, 0x97, 0xF2, 0xF8, 0xA1, 0xE8, 0xD9, 0x1D, 0x83,
+    0xFB, 0xF4, 0xC9, 0xF8, 0x96, 0x1F, 0xB9, 0x60, 0x8E, 0x60, 0xCB, 0x37, 0xB0, 0xC2, 0x0F, 0xF0,
+    0xC5, 0xEF, 0x34, 0x44, 0x37, 0x94, 0x47, 0x77, 0xD3, 0x29, 0xDF, 0x28, 0x6E, 0xA6, 0x7A, 0x73,
+    0x30, 0xCE, 0xA5, 0x5F, 0xED, 0xA0, 0xD7, 0x17, 0x14, 0x6C, 0x4A, 0x63, 0xAD, 0x58, 0xBE, 0xEB,
+    0x23, 0x6E, 0x4A, 0x6C, 0xB3, 0x4E, 0x4D, 0x9E, 0x2B, 0x70, 0xC5, 0xAA, 0xFF, 0x06, 0xCD, 0x55,
+    0xA1, 0x6E, 0xDC, 0x40, 0x10, 0x1D, 0xDB, 0x4A, 0x2C, 0xC5, 0xC0, 0x25, 0x2D, 0x68, 0x80, 0x71,
+    0x43, 0xFC, 0x09, 0xBB, 0x52, 0x61, 0xC9, 0x81, 0x1E, 0x2E, 0x2A, 0x09, 0x29, 0x29, 0x5F, 0x7F,
+    0xC2, 0x7D, 0x42, 0xC0, 0x91, 0x96, 0xDC, 0x1F, 0x74, 0x57, 0x2A, 0x28, 0xF5, 0x27, 0x18, 0xA4,
+    0xAA, 0x14, 0x64, 0xE0, 0xAA, 0x4E, 0xE4, 0xF3, 0xF4, 0xBD, 0xF5, 0x5D, 0x92, 0xF6, 0x0B, 0xCE,
+    0xE0, 0xC9, 0xDE, 0x9D, 0xD9, 0x79, 0xF3, 0x66, 0x3C, 0x2B, 0xC9, 0x56, 0xAE, 0xAC, 0x98, 0xC6,
+    0x05, 0x29, 0x46, 0x1F, 0x44, 0x54, 0x01, 0x15, 0x21, 0x23, 0x3C, 0x3D, 0xA5, 0xEA, 0x24, 0xB9,
+    0xAA, 0x4A, 0x0A, 0x68, 0x60, 0xA8, 0x9D, 0x98, 0xDF, 0xEB, 0x95, 0x94, 0x13, 0xB6, 0xF3, 0x19,
+    0x90, 0xAA, 0x05, 0x46, 0xBF, 0xB8, 0x53, 0xA9, 0x8E, 0xF4, 0xD9, 0x47, 0x1F, 0xEC, 0xDC, 0x7D,
+    0x6D, 0xC4, 0xF4, 0xD8, 0xAE, 0x46, 0x40, 0xB1, 0x17, 0x86, 0x79, 0xF2, 0x89, 0x3B, 0x8C, 0x53,
+    0xA8, 0xCE, 0xD8, 0x39, 0xC4, 0x69, 0x45, 0x5E, 0xDB, 0x74, 0x2B, 0xAE, 0x71, 0x8D, 0xF8, 0x77,
+    0x23, 0x59, 0x36, 0x38, 0x72, 0xA4, 0x77, 0x73, 0xE0, 0xF7, 0x6A, 0x85, 0x03, 0xB1, 0x94, 0xD0,
+    0x1F, 0x87, 0x0C, 0xA2, 0x9D, 0xEB, 0xCA, 0xBD, 0x68, 0xE3, 0xBA, 0x6C, 0x06, 0x35, 0x37, 0x94,
+    0xF3, 0x4E, 0x83, 0x83, 0x01, 0x8C, 0xD4, 0x16, 0x7A, 0x67, 0xA5, 0x1E, 0xE0, 0xEB, 0x3A, 0x81,
+    0x5F, 0x90, 0x26, 0xD3, 0x9F, 0x9E, 0x84, 0x23, 0x83, 0x1E, 0x6F, 0xCC, 0xEA, 0xFD, 0x12, 0xE0,
+    0xFA, 0x26, 0xB2, 0x43, 0xBC, 0x1C, 0xFB, 0xB0, 0xFF, 0x00, 0xBA, 0x2E, 0x78, 0x2B, 0x65, 0x97,
+    0x4E, 0xCF, 0xA5, 0x92, 0x4B, 0xBD, 0x8F, 0x89, 0xEC, 0x79, 0x8C, 0x06, 0x26, 0x3F, 0x8A, 0x9F,
+    0xED, 0x27, 0x2C, 0x5A, 0x79, 0xB1, 0x28, 0xEB, 0x18, 0xB9, 0x64, 0x80, 0x25, 0xFB, 0x6A, 0x92,
+    0xF5, 0x3A, 0xD5, 0xC6, 0xE8, 0x60, 0x06, 0xE4, 0x9E, 0xA9, 0x18, 0xED, 0x4D, 0x7F, 0xBE, 0x9B,
+    0xF1, 0x2A, 0xBE, 0x35, 0x03, 0xA4, 0x66, 0xC2, 0x1A, 0xEA, 0x89, 0xAA, 0xEB, 0x00, 0x73, 0x46,
+    0x18, 0x60, 0x19, 0xF5, 0x25, 0x69, 0xE4, 0x76, 0x8B, 0xE3, 0x5E, 0x46, 0x26, 0x17, 0x5F, 0xA8,
+    0xAB, 0xCA, 0x22, 0x59, 0x36, 0x9B, 0x20, 0xE5, 0x50, 0xF6, 0x52, 0x37, 0xF9, 0x70, 0x20, 0xFB,
+    0x91, 0x95, 0xD0, 0xEF, 0x13, 0xCC, 0x7E, 0x4D, 0xE2, 0x41, 0x35, 0xD1, 0x07, 0x05, 0x83, 0xE0,
+    0x86, 0x1C, 0x1C, 0xFA, 0x62, 0x06, 0x20, 0x9C, 0xE9, 0x00, 0xAE, 0x45, 0xE9, 0x7C, 0x00, 0x80,
+    0x05, 0x2C, 0x01, 0xA0, 0x54, 0x4D, 0x85, 0xDA, 0x52, 0xBD, 0xB2, 0x4D, 0x14, 0x02, 0xFD, 0x99,
+    0xC1, 0xE3, 0xC7, 0x7C, 0x2C, 0x72, 0x6C, 0x11, 0xF8, 0x7C, 0x66, 0xD6, 0x8E, 0x9D, 0xE3, 0xD8,
+    0x68, 0x8E, 0xFA, 0x5E, 0xE2, 0x4B, 0x58, 0xE1, 0x0B, 0xD4, 0x74, 0x4C, 0x60, 0x59, 0x3D, 0x50,
+    0x65, 0xE6, 0xB2, 0x48, 0x2D, 0x17, 0xF7, 0x72, 0x9A, 0xFA, 0xA6, 0x1B, 0xFC, 0x40, 0x59, 0x9F,
+    0x0D, 0x90, 0x76, 0xD7, 0xB3, 0xCB, 0x5B, 0x5A, 0xA1, 0xA3, 0x2F, 0x6F, 0xE5, 0xB4, 0xF4, 0x95,
+    0x33, 0x42, 0x46, 0x6B, 0x71, 0xFC, 0xD1, 0x8A, 0x28, 0x8D, 0x03, 0x61, 0x49, 0x6E, 0x4E, 0x54,
+    0x5F, 0x91, 0x15, 0x99, 0x4E, 0x8F, 0x29, 0xC6, 0x37, 0xCE, 0x8E, 0x64, 0x73, 0x6A, 0xFA, 0xF2,
+    0x49, 0xBC, 0x6E, 0x98, 0x00, 0xDA, 0xC0, 0x73, 0x8A, 0xD4, 0x1C, 0x61, 0x85, 0xDE, 0x9E, 0xF7,
+    0x09, 0x92, 0x4C, 0xC4, 0xC4, 0x51, 0xB9, 0x4C, 0xBC, 0xEE, 0x78, 0x2E, 0x48, 0x9C, 0xAD, 0x57,
+    0xE4, 0xA1, 0x6F, 0xD5, 0x46, 0xCD, 0x16, 0xF9, 0xAE, 0xB5, 0xC3, 0x48, 0x2C, 0xF6, 0x1C, 0x91,
+    0x1A, 0xCC, 0x08, 0xF3, 0x14, 0x51, 0x35, 0x94, 0x6A, 0xEB, 0x91, 0x11, 0xD4, 0x66, 0x51, 0xB3,
+    0xC8, 0x1A, 0xC5, 0x99, 0x71, 0x72, 0xB2, 0x7A, 0xA4, 0x53, 0xB1, 0xCE, 0x59, 0x2C, 0x91, 0x61,
+    0x89, 0x8A, 0xF8, 0xCF, 0xC7, 0x16, 0x38, 0xB3, 0x8B, 0xC9, 0x9B, 0xE3, 0x4A, 0x46, 0x2A, 0xC5,
+    0x78, 0xF4, 0xAA, 0xBB, 0x53, 0xD3, 0xF7, 0x6A, 0x1B, 0x5B, 0x6D, 0x8A, 0x77, 0xC6, 0x1C, 0xFB,
+    0x80, 0x73, 0xCD, 0xB4, 0xB8, 0x14, 0xE4, 0x9B, 0x54, 0xFF, 0xDC, 0x56, 0x6C, 0x92, 0x7C, 0xCF,
+    0x23, 0x71, 0x74, 0xCD, 0xC6, 0x13, 0xB3, 0x60, 0xCF, 0x45, 0x20, 0x16, 0x31, 0xF6, 0xF1, 0xE2,
+    0x5B, 0x22, 0xA3, 0x75, 0xBC, 0xA0, 0x7C, 0xC7, 0xFA, 0x69, 0x1B, 0x31, 0xB6, 0xBE, 0x06, 0x8A,
+    0xAC, 0xB8, 0x1C, 0x78, 0xC1, 0xE5, 0xBC, 0x98, 0x2C, 0x58, 0xE3, 0xB3, 0x5C, 0x70, 0xE2, 0xED,
+    0x07, 0x2C, 0xFE, 0x0B, 0xD8, 0x3F, 0x05, 0x3C, 0xD1, 0xE7, 0x2F, 0xC5, 0x55, 0x3D, 0x6E, 0xD5,
+    0x40, 0x10, 0x1E, 0xDB, 0x4A, 0x2C, 0xC5, 0x85, 0x29, 0x68, 0x08, 0x85, 0x8F, 0xE0, 0x23, 0xD8,
+    0x54, 0xB4, 0x14, 0xBC, 0x1B, 0xD0, 0x71, 0x07, 0xD6, 0x47, 0xC8, 0x39, 0x5E, 0x0A, 0xDA, 0x54,
+    0xEC, 0x1E, 0xC1, 0x3D, 0x8D, 0x0B, 0x24, 0x14, 0x9A, 0x58, 0xC8, 0x85, 0xF3, 0xB0, 0x3D, 0x7C,
+    0xDF, 0xF8, 0x25, 0xEF, 0x05, 0x25, 0x34, 0x08, 0x65, 0x25, 0xAF, 0xED, 0xDD, 0xF9, 0xF9, 0xBE,
+    0x99, 0xD9, 0x59, 0x89, 0xB7, 0x22, 0x52, 0xA9, 0x48, 0xA2, 0x33, 0x3E, 0xBE, 0x4F, 0x92, 0xCC,
+    0xE9, 0x28, 0x55, 0x93, 0xF6, 0x62, 0x23, 0xDA, 0x60, 0xCA, 0x47, 0x4C, 0xAE, 0x15, 0x89, 0xB5,
+    0xC6, 0xDF, 0x44, 0x1D, 0xEC, 0x47, 0xDA, 0x88, 0xA4, 0xF3, 0xE9, 0x3B, 0x29, 0x7F, 0x6A, 0x27,
+    0x7A, 0xA3, 0x5D, 0xA2, 0xAA, 0xA1, 0xD0, 0xAF, 0x5A, 0xFB, 0x31, 0x9B, 0x13, 0x0D, 0xE5, 0x90,
+    0xCF, 0xE2, 0xDB, 0xAA, 0x4F, 0x14, 0xE2, 0xF9, 0x94, 0xCD, 0x52, 0x75, 0x55, 0x1F, 0x69, 0xAD,
+    0x01, 0x02, 0x0B, 0x0C, 0x15, 0x83, 0x68, 0xF0, 0x21, 0x5D, 0x12, 0x95, 0x62, 0x80, 0x75, 0x1F,
+    0x1C, 0x0C, 0x99, 0xDB, 0x74, 0x36, 0x2F, 0xDA, 0x4A, 0x39, 0xD0, 0xF1, 0x47, 0xFD, 0xB1, 0xD5,
+    0xEB, 0x5C, 0x39, 0x3A, 0x9B, 0xE7, 0x33, 0xDD, 0x6D, 0xFD, 0xAE, 0x81, 0x61, 0xEA, 0x68, 0x10,
+    0xD7, 0x4B, 0xBE, 0x6C, 0x2F, 0x17, 0x68, 0x62, 0x40, 0x13, 0xF3, 0x04, 0xE8, 0x84, 0x06, 0xAE,
+    0xAA, 0x23, 0x25, 0x63, 0x98, 0x75, 0x9D, 0x54, 0x83, 0xDC, 0x69, 0xB6, 0x24, 0x05, 0x1F, 0xE9,
+    0x62, 0x66, 0x7C, 0x2B, 0xC5, 0xC8, 0x7F, 0x92, 0xA6, 0xA6, 0x6D, 0x42, 0xD2, 0x68, 0x9F, 0xBC,
+    0x67, 0x10, 0x3A, 0x06, 0x01, 0x21, 0xF9, 0xAC, 0x5B, 0x49, 0xE9, 0x05, 0xBE, 0x3A, 0x80, 0xDC,
+    0xD6, 0x60, 0x02, 0x01, 0x1F, 0x3E, 0x40, 0xA3, 0x5C, 0x24, 0xFF, 0x85, 0xF8, 0x3A, 0x48, 0xC4,
+    0x7A, 0xEB, 0xFB, 0x9C, 0xEC, 0xAB, 0x31, 0x56, 0xD8, 0xCD, 0xA7, 0x54, 0x61, 0x1B, 0xF4, 0xB4,
+    0xD1, 0x90, 0x22, 0x66, 0xA0, 0x0A, 0xE6, 0x1A, 0x5C, 0x9B, 0x28, 0x7C, 0x17, 0x23, 0xDC, 0x3A,
+    0x44, 0x30, 0x5E, 0x23, 0x68, 0x69, 0xA9, 0xB9, 0x22, 0x85, 0xDE, 0x40, 0x06, 0x6E, 0x3F, 0x15,
+    0x5A, 0x67, 0xE1, 0x75, 0x23, 0xF7, 0xA3, 0x52, 0xB2, 0x02, 0x27, 0x67, 0xDC, 0x97, 0xDA, 0x38,
+    0x92, 0x31, 0xF9, 0x12, 0xD9, 0x3E, 0x91, 0x60, 0x46, 0x9E, 0x6B, 0x6A, 0x99, 0x55, 0x93, 0xE3,
+    0x07, 0xE3, 0xC0, 0x28, 0x3C, 0x94, 0xCB, 0x40, 0x30, 0x65, 0x24, 0x3D, 0x0C, 0x23, 0x11, 0xE6,
+    0xF3, 0x45, 0x36, 0x26, 0x9D, 0x5F, 0x3C, 0x63, 0x50, 0xBE, 0xD5, 0x70, 0x15, 0x5D, 0xDD, 0x23,
+    0x81, 0x05, 0x4B, 0xE6, 0x64, 0xDE, 0xE9, 0x86, 0x9F, 0x74, 0x00, 0x23, 0xF4, 0x01, 0xEA, 0xFC,
+    0xDC, 0x67, 0xFC, 0x0F, 0x21, 0x0B, 0xB6, 0x9C, 0x6C, 0x36, 0x64, 0x13, 0x44, 0xB5, 0x07, 0xA3,
+    0xF1, 0xDE, 0xB8, 0x51, 0x54, 0x1D, 0x8C, 0x66, 0xA6, 0xB7, 0xAB, 0x61, 0xC3, 0x39, 0x93, 0xD3,
+    0x1E, 0xF8, 0xF1, 0x62, 0xF2, 0xD7, 0x45, 0x06, 0xC8, 0x5B, 0xE9, 0xF4, 0xC6, 0xB0, 0xD2, 0x85,
+    0x87, 0x60, 0xF3, 0x06, 0x89, 0xF5, 0x3A, 0x96, 0x3C, 0x26, 0x36, 0x8E, 0xEA, 0xAD, 0xDB, 0x17,
+    0xE7, 0xA3, 0xFF, 0xCD, 0x83, 0x7F, 0xA3, 0x73, 0x2E, 0x67, 0x4D, 0x3C, 0x46, 0xA8, 0x96, 0x1D,
+    0x4B, 0x0B, 0x9E, 0x52, 0x78, 0x92, 0xB3, 0x6B, 0x79, 0x96, 0xFC, 0x01, 0xCC, 0xC5, 0x2C, 0x5F,
+    0xF2, 0x1D, 0xCE, 0x9D, 0xA2, 0x28, 0x17, 0x39, 0xDD, 0x1D, 0x67, 0x8F, 0xEA, 0x90, 0x87, 0x32,
+    0x7D, 0xC0, 0x32, 0x3D, 0xE0, 0x45, 0xFB, 0x87, 0x6D, 0xA4, 0x8E, 0xE4, 0xC0, 0xF4, 0x68, 0xDB,
+    0x68, 0x54, 0x56, 0xFA, 0x3C, 0x1B, 0xDF, 0x6C, 0x8F, 0x1B, 0xE4, 0x90, 0x4D, 0x2B, 0x34, 0x3E,
+    0x44, 0xC6, 0x3A, 0x20, 0xEE, 0xBB, 0xC7, 0x52, 0xD1, 0xAE, 0xC8, 0xF1, 0xD0, 0x3A, 0xC1, 0xD3,
+    0x14, 0xB1, 0xF3, 0x1C, 0x8B, 0x03, 0x71, 0xA8, 0xB3, 0x5B, 0xE5, 0x10, 0xCF, 0xF9, 0x06, 0xC8,
+    0x0C, 0x8F, 0x25, 0xDF, 0xC6, 0x4B, 0xD8, 0x43, 0x1B, 0xC0, 0x61, 0x5E, 0x6C, 0xF5, 0x95, 0xFC,
+    0x73, 0x0E, 0x8B, 0x20, 0x65, 0xE0, 0x0C, 0xAF, 0x09, 0x70, 0x20, 0x87, 0xE5, 0x74, 0x70, 0x19,
+    0xED, 0x9B, 0x03, 0x5A, 0x91, 0xF8, 0x7E, 0xED, 0x9D, 0xE7, 0x0F, 0x93, 0xFB, 0x3F, 0xA3, 0x62,
+    0x96, 0xD8, 0x5A, 0xB0, 0x5B, 0x0E, 0x09, 0xFB, 0x0B, 0x26, 0xD7, 0xED, 0x57, 0x41, 0xA8, 0x40,
+    0x9E, 0xEB, 0xFD, 0xEA, 0x8A, 0x47, 0x03, 0xCB, 0x8D, 0xAD, 0x46, 0xA9, 0xC6, 0x92, 0x5B, 0x73,
+    0x49, 0x70, 0x6C, 0x94, 0x3D, 0x8D, 0xA2, 0x57, 0xB1, 0xF4, 0x7C, 0x47, 0x7C, 0x84, 0xCB, 0x33,
+    0x19, 0x0E, 0x8D, 0x92, 0x70, 0x20, 0x79, 0xA7, 0x69, 0xE5, 0xB2, 0xD6, 0x02, 0xCD, 0x00, 0xB7,
+    0x7B, 0x54, 0x13, 0x0C, 0x22, 0x34, 0x3F, 0x94, 0x25, 0xB2, 0xE4, 0xD9, 0x25, 0x6B, 0x96, 0x66,
+    0x65, 0x97, 0x50, 0xBA, 0x46, 0x15, 0x24, 0xD1, 0x68, 0xDC, 0x64, 0x2B, 0xD6, 0x15, 0x9C, 0xF6,
+    0xF6, 0x63, 0x2D, 0xD1, 0xDD, 0x1E, 0xE2, 0x1B, 0xD5, 0xC8, 0x79, 0x82, 0x18, 0xB7, 0xE8, 0xF2,
+    0xB0, 0xA8, 0x5D, 0xB6, 0x48, 0x89, 0x4B, 0x47, 0xA2, 0x8B, 0x43, 0xF6, 0xD7, 0xF2, 0xE6, 0x85,
+    0xC4, 0x38, 0x30, 0x2C, 0xB8, 0x83, 0x00, 0x10, 0xCE, 0xD9, 0x8D, 0xC3, 0xD3, 0x3B, 0x58, 0x59,
+    0x77, 0xC6, 0xA7, 0x76, 0x8A, 0x71, 0x6D, 0x5C, 0x8C, 0xAE, 0xA5, 0x70, 0x3D, 0x84, 0xB9, 0xF2,
+    0xC2, 0xE0, 0x49, 0x75, 0xDC, 0x2E, 0x98, 0x44, 0x46, 0xE9, 0xB9, 0xC6, 0x6F, 0xA5, 0x54, 0x3B,
+    0x8E, 0xD4, 0x40, 0x14, 0x6C, 0xDB, 0x9A, 0xB1, 0x84, 0x83, 0x4E, 0xD8, 0x78, 0x72, 0x12, 0x1F,
+    0xC1, 0x06, 0x42, 0x02, 0x36, 0x58, 0x0E, 0x41, 0xC4, 0x11, 0x3C, 0xE2, 0x02, 0x70, 0x08, 0x82,
+    0x15, 0x09, 0x37, 0xC0, 0x96, 0x08, 0x08, 0x08, 0x58, 0x02, 0x72, 0x07, 0xE4, 0x78, 0x25, 0x4B,
+    0x78, 0x25, 0xDB, 0x8F, 0xAA, 0xB2, 0x67, 0xC6, 0xBB, 0x33, 0xA0, 0x45, 0x8C, 0xC6, 0x4F, 0x6E,
+    0xF7, 0xFB, 0x54, 0xD5, 0x7B, 0xDD, 0xCE, 0xB9, 0x47, 0xEF, 0x9C, 0x73, 0xDE, 0x2A, 0xE7, 0x22,
+    0x1B, 0xF1, 0x6A, 0x6F, 0x1A, 0xE7, 0xB2, 0x3A, 0xAB, 0x5C, 0xD2, 0xB8, 0xC1, 0xDD, 0xFA, 0x95,
+    0x15, 0x7D, 0x7B, 0xBE, 0x32, 0xC0, 0x6D, 0x3A, 0x98, 0xD0, 0x72, 0xD8, 0x0C, 0x51, 0xC8, 0xC0,
+    0xAD, 0x82, 0xAF, 0xF1, 0xA8, 0x80, 0xAB, 0x93, 0x01, 0x5B, 0x06, 0xB4, 0xFB, 0x80, 0xEC, 0x2F,
+    0x01, 0x7C, 0x0D, 0x14, 0x90, 0x1E, 0x02, 0x4A, 0x04, 0x3C, 0x7C, 0x35, 0x70, 0x49, 0xAF, 0xC2,
+    0xB0, 0x8E, 0x8D, 0x60, 0xB3, 0x9B, 0x05, 0xDC, 0xF5, 0x7B, 0xFA, 0xE2, 0x73, 0x62, 0x48, 0x53,
+    0x7E, 0x69, 0x5D, 0xD2, 0xF9, 0xC6, 0x15, 0x79, 0x52, 0x2F, 0xBC, 0x94, 0x77, 0xE2, 0xBF, 0x43,
+    0x58, 0xD4, 0x33, 0x2D, 0x21, 0x21, 0x3C, 0x41, 0x48, 0x58, 0x21, 0x6D, 0x8E, 0xDC, 0x09, 0x5A,
+    0xAB, 0x13, 0xEE, 0x5C, 0x45, 0x70, 0x17, 0xBC, 0x0D, 0x81, 0x16, 0xF4, 0x34, 0xF2, 0x74, 0xBE,
+    0x73, 0x69, 0xCF, 0x1C, 0x45, 0x0B, 0x18, 0x81, 0xD5, 0x70, 0x8F, 0x10, 0x9A, 0x35, 0xDE, 0xD4,
+    0x04, 0xE4, 0x2B, 0xAE, 0xC8, 0xB6, 0xFC, 0xC6, 0x08, 0xFB, 0x4C, 0x50, 0xF6, 0x75, 0x64, 0x85,
+    0x0F, 0x1D, 0x2D, 0x33, 0x86, 0xB2, 0xD0, 0xA2, 0xA3, 0xFD, 0xD9, 0x53, 0x4C, 0x4F, 0xDA, 0x43,
+    0x32, 0x12, 0x54, 0x6C, 0xB4, 0x11, 0x62, 0x7D, 0x1F, 0x02, 0x0B, 0x0A, 0xC2, 0x82, 0xB7, 0x0A,
+    0xB2, 0x5F, 0xB0, 0xEA, 0xC7, 0xE2, 0x17, 0xAB, 0xF7, 0x89, 0x5A, 0xE1, 0x1B, 0x09, 0x25, 0xCC,
+    0x19, 0x7B, 0xE1, 0xCE, 0xE4, 0xB3, 0xBA, 0x60, 0x4B, 0x46, 0xB5, 0x28, 0xDF, 0x75, 0x4F, 0xDD,
+    0x94, 0x12, 0xF1, 0x62, 0xA7, 0x4A, 0x0C, 0x3B, 0x30, 0xBE, 0x87, 0x89, 0x47, 0x98, 0xD0, 0x9E,
+    0x99, 0x38, 0x21, 0xE6, 0x17, 0x21, 0x9A, 0xB1, 0x8D, 0xE0, 0x3F, 0x11, 0x32, 0xCE, 0x63, 0x36,
+    0x00, 0xAA, 0xEF, 0xB2, 0x0E, 0x80, 0x62, 0xC6, 0x50, 0x3A, 0xAB, 0x30, 0x17, 0x94, 0x2A, 0x07,
+    0x95, 0xB2, 0x59, 0xC2, 0xF6, 0xED, 0x0E, 0x75, 0x44, 0x02, 0x81, 0x58, 0x8C, 0x07, 0xC8, 0x53,
+    0xCB, 0x1B, 0xC8, 0x20, 0x2D, 0x22, 0x83, 0x09, 0xEC, 0x35, 0x8A, 0x40, 0x62, 0x88, 0x72, 0xCD,
+    0x72, 0x37, 0x30, 0x1A, 0x2D, 0xE8, 0x8B, 0x51, 0x28, 0x39, 0x3E, 0x19, 0x81, 0x79, 0x83, 0x58,
+    0xD1, 0xE8, 0x47, 0xEC, 0x3C, 0x66, 0x4C, 0x05, 0xD9, 0xB2, 0x26, 0x26, 0x2D, 0x00, 0x03, 0xE1,
+    0xB4, 0x9F, 0x07, 0x8F, 0x72, 0x73, 0x86, 0xC4, 0x9F, 0x2D, 0xFF, 0xB8, 0x44, 0xD9, 0x4D, 0xEA,
+    0x68, 0xC8, 0x38, 0x4C, 0x14, 0xED, 0xE4, 0x47, 0x0E, 0x18, 0x5B, 0x71, 0xF4, 0x31, 0x19, 0xE6,
+    0xA1, 0xDB, 0x7F, 0x34, 0x83, 0xB4, 0x36, 0x02, 0xB8, 0xE5, 0x78, 0xD0, 0x8B, 0x07, 0x97, 0xD3,
+    0x39, 0x43, 0x5F, 0x08, 0x23, 0x02, 0xB6, 0xDD, 0xE8, 0xB3, 0x75, 0x6C, 0x12, 0x53, 0xF1, 0x04,
+    0x30, 0x03, 0x1F, 0x8E, 0x7E, 0x71, 0x35, 0xB5, 0x92, 0x99, 0x25, 0xC2, 0x56, 0xE5, 0x59, 0x6D,
+    0xF7, 0x10, 0x27, 0x11, 0x30, 0xC5, 0x2E, 0xCD, 0xA9, 0x54, 0x22, 0x75, 0x77, 0x23, 0xAB, 0xA7,
+    0xCD, 0x3B, 0x35, 0x82, 0x59, 0xB1, 0x3F, 0xD5, 0x50, 0x1D, 0x90, 0x4C, 0x31, 0xE8, 0xE8, 0x46,
+    0xCB, 0x67, 0xAF, 0xA8, 0x0A, 0x22, 0x57, 0xB9, 0x95, 0xDA, 0x21, 0x7C, 0x83, 0x73, 0x6E, 0xBC,
+    0xC8, 0xB9, 0x07, 0x08, 0x48, 0xC5, 0xAC, 0x28, 0x86, 0xDA, 0x9B, 0xF6, 0xF6, 0x1A, 0xF0, 0x90,
+    0xFE, 0xC4, 0x9A, 0xC0, 0xEE, 0xAE, 0xF7, 0x07, 0x84, 0xA3, 0x8F, 0x90, 0x12, 0x25, 0x72, 0xB7,
+    0xCA, 0x45, 0x77, 0x7D, 0x89, 0x62, 0x3C, 0xD8, 0xED, 0x86, 0xE7, 0x0A, 0xF7, 0x28, 0x0C, 0x1C,
+    0xEA, 0x97, 0xB3, 0x22, 0x3A, 0x24, 0xBA, 0xDC, 0x68, 0x94, 0x4F, 0x33, 0xA2, 0x0E, 0xAB, 0xA3,
+    0x32, 0x3A, 0x3C, 0xBA, 0x42, 0x74, 0x96, 0x0E, 0x86, 0x12, 0x38, 0x6A, 0xE0, 0x24, 0xC0, 0xA4,
+    0xC2, 0xEA, 0xE2, 0xEC, 0xDC, 0xD9, 0xA7, 0x01, 0xB5, 0xCB, 0x2A, 0xB4, 0xE7, 0x28, 0x7D, 0x4D,
+    0x7E, 0xA8, 0xCC, 0xA2, 0x3A, 0xCC, 0x2C, 0xAC, 0x0C, 0xAC, 0xCB, 0x9E, 0xA8, 0xE2, 0x74, 0x41,
+    0xCD, 0x0A, 0xAA, 0xE8, 0x91, 0x9F, 0x30, 0xB2, 0x81, 0xB7, 0xFD, 0xEE, 0x3D, 0xC5, 0x2B, 0x2A,
+    0xD2, 0xC6, 0x43, 0x82, 0xC3, 0xF6, 0xC4, 0xB6, 0x56, 0x15, 0x55, 0xD6, 0xAC, 0xF3, 0x7B, 0x4E,
+    0xF1, 0xBF, 0x4D, 0xEA, 0x79, 0x68, 0x4F, 0x87, 0xC8, 0x12, 0x24, 0xF0, 0x78, 0x92, 0x3E, 0x1E,
+    0x83, 0xB7, 0xF7, 0x9A, 0xD4, 0x68, 0x9C, 0x99, 0x32, 0xA1, 0x98, 0xF4, 0xCB, 0x8F, 0xDF, 0x79,
+    0x05, 0xE0, 0x6E, 0x80, 0xEE, 0xC0, 0x06, 0x7A, 0x03, 0xEE, 0x2A, 0x4C, 0x05, 0x6E, 0xAA, 0x40,
+    0xF7, 0x03, 0x3C, 0xD7, 0xE4, 0x5C, 0x56, 0x87, 0x70, 0xDC, 0x66, 0xE0, 0x8C, 0x9B, 0x83, 0x4C,
+    0xD4, 0xA9, 0xE0, 0x82, 0x1B, 0xFC, 0x77, 0x1C, 0xC2, 0x74, 0xBA, 0x7B, 0x1B, 0x42, 0x00, 0x99,
+    0xF2, 0x87, 0x43, 0x2E, 0x1B, 0x02, 0xC3, 0x05, 0x59, 0x97, 0x96, 0x97, 0xC6, 0xC4, 0xE9, 0xC0,
+    0x2B, 0xED, 0x38, 0xEE, 0xBF, 0x7F, 0xBF, 0x01, 0xD5, 0x55, 0xBD, 0x8E, 0xDE, 0x36, 0x10, 0x5C,
+    0x89, 0x70, 0x04, 0x58, 0x85, 0x1A, 0x27, 0x40, 0xDC, 0xF0, 0x11, 0xF4, 0x08, 0x14, 0x7C, 0x65,
+    0x0A, 0x37, 0x71, 0xED, 0x2A, 0x45, 0xD2, 0xE4, 0x11, 0xF8, 0xF5, 0x6E, 0x5C, 0xB8, 0xB7, 0x0B,
+    0xF7, 0xE9, 0x53, 0x98, 0x32, 0x5C, 0xA4, 0x70, 0x61, 0xA5, 0x4A, 0x69, 0xE5, 0x09, 0x42, 0x04,
+    0x44, 0xF0, 0x39, 0xA1, 0xB4, 0x9E, 0x59, 0xDD, 0x9D, 0xFF, 0x6A, 0x03, 0xB1, 0x0A, 0xE2, 0xC8,
+    0xE3, 0xEE, 0xCE, 0xCE, 0xCC, 0xF2, 0x13, 0x11, 0xB9, 0xFD, 0x14, 0x8B, 0x74, 0xCA, 0x55, 0x74,
+    0xE6, 0x1A, 0x32, 0xD7, 0xFE, 0x6C, 0x47, 0x9B, 0x7C, 0xF4, 0x0D, 0x3B, 0x6E, 0x2C, 0x8D, 0x66,
+    0xE9, 0xAA, 0x8C, 0x3A, 0x49, 0x9A, 0x9D, 0x9E, 0x65, 0x38, 0x4B, 0x40, 0xB8, 0x9E, 0x3A, 0xDD,
+    0xC4, 0x17, 0x89, 0xBA, 0x36, 0x2A, 0xFD, 0xBF, 0x2A, 0x63, 0x16, 0xBD, 0x5F, 0xDC, 0x2E, 0x43,
+    0xD1, 0x13, 0x23, 0xFB, 0xCA, 0xC8, 0x1C, 0x97, 0x34, 0xB7, 0xEA, 0xF6, 0xA1, 0x4A, 0x58, 0xC7,
+    0xAC, 0x27, 0xB7, 0x35, 0x7A, 0x17, 0x91, 0xF3, 0xF0, 0x06, 0x91, 0x55, 0xF4, 0x35, 0x22, 0xE7,
+    0x4E, 0xF5, 0x48, 0xBE, 0x8A, 0x4E, 0x8E, 0xC9, 0xB3, 0x78, 0x45, 0x24, 0xE0, 0x32, 0x52, 0x06,
+    0x44, 0x02, 0x53, 0x2A, 0x72, 0xD5, 0x8E, 0x2E, 0x80, 0x49, 0xE0, 0x09, 0xFD, 0xA0, 0x16, 0x00,
+    0x9F, 0xAE, 0xE0, 0x7F, 0x0B, 0xC0, 0x3D, 0x22, 0x6A, 0xD2, 0xD3, 0xF0, 0x1F, 0x72, 0x47, 0xFD,
+    0x79, 0x6B, 0x75, 0x1D, 0x4B, 0xAF, 0x92, 0x96, 0x50, 0x5A, 0x9D, 0x74, 0x1E, 0x6A, 0xB7, 0x83,
+    0x87, 0xB1, 0xA0, 0x21, 0x40, 0xD8, 0x1C, 0xDA, 0x28, 0x40, 0xA1, 0x73, 0x5C, 0x9C, 0xA2, 0xB6,
+    0x3F, 0x03, 0x76, 0x5C, 0x42, 0x6E, 0xB5, 0x41, 0xA2, 0xFA, 0x7F, 0xE7, 0xE5, 0xFD, 0xEF, 0x50,
+    0xD9, 0x9B, 0xCA, 0xED, 0x6E, 0x47, 0xC1, 0x8E, 0x7A, 0x3B, 0x92, 0xEF, 0x2F, 0xEF, 0xFD, 0x20,
+    0x6D, 0x1D, 0x01, 0xEF, 0x6F, 0x05, 0x17, 0x7F, 0x69, 0x6D, 0x74, 0x4B, 0x60, 0xE9, 0x94, 0x96,
+    0xB1, 0x92, 0xA5, 0xA5, 0x27, 0x2F, 0x21, 0x7B, 0xF2, 0x92, 0x16, 0xB7, 0x63, 0xE7, 0x0B, 0x60,
+    0x83, 0xC6, 0xD5, 0x81, 0x97, 0x69, 0xA8, 0x80, 0x1B, 0xD7, 0x90, 0x1B, 0x92, 0xDA, 0x1F, 0xA4,
+    0xBE, 0x87, 0x24, 0x40, 0x28, 0x02, 0x06, 0x05, 0x58, 0xE2, 0x24, 0xE2, 0xE8, 0xBA, 0x1B, 0x93,
+    0xFD, 0xB7, 0x7D, 0x22, 0x3F, 0x1A, 0x36, 0x5E, 0x6B, 0xD4, 0x00, 0xF7, 0x5A, 0x2D, 0xD0, 0xFC,
+    0xDA, 0x52, 0xE8, 0x2F, 0xC6, 0x9C, 0xED, 0x53, 0xF9, 0x09, 0x7F, 0x4D, 0x69, 0x92, 0x21, 0x03,
+    0x5A, 0xA3, 0x58, 0x10, 0x3A, 0x71, 0xFC, 0xAE, 0xFD, 0xD9, 0x3C, 0x12, 0x33, 0xA8, 0x84, 0x97,
+    0x04, 0x4E, 0x87, 0x76, 0xFA, 0x8F, 0x2E, 0x66, 0x51, 0x49, 0xB9, 0xDF, 0xC4, 0x3C, 0x0A, 0x60,
+    0x28, 0x4F, 0x3E, 0xB9, 0xA1, 0x02, 0xDD, 0xF6, 0xE9, 0x46, 0xFC, 0x27, 0x1B, 0x20, 0x63, 0x31,
+    0x4F, 0xC6, 0x9D, 0x5E, 0xA9, 0xC0, 0x96, 0x68, 0x8D, 0x49, 0xBE, 0x99, 0xFC, 0x9F, 0xBB, 0xD7,
+    0x8B, 0xEA, 0xFF, 0xD0, 0xFA, 0xF5, 0x9D, 0x5D, 0xD1, 0x5B, 0xD0, 0xC7, 0x3B, 0x2E, 0xCF, 0x31,
+    0x4B, 0x2C, 0x08, 0xC2, 0xA8, 0xA0, 0x37, 0x5D, 0x90, 0xD8, 0xE4, 0x16, 0x1B, 0x01, 0xA4, 0x64,
+    0xEB, 0x04, 0x60, 0x8A, 0x3B, 0xA3, 0x37, 0xC2, 0x0A, 0x62, 0x08, 0x20, 0x06, 0x00, 0xDB, 0xDC,
+    0xD8, 0x78, 0x86, 0xF9, 0x5A, 0x28, 0xF9, 0x48, 0xA8, 0x2B, 0x2E, 0x63, 0x5A, 0xDB, 0x43, 0x28,
+    0x84, 0x83, 0x7F, 0x13, 0x2A, 0xCD, 0x14, 0xAA, 0xDB, 0x10, 0xE9, 0x73, 0x58, 0x29, 0x54, 0xAB,
+    0x8C, 0x5C, 0x29, 0xA2, 0xDB, 0x44, 0x5F, 0x51, 0xA8, 0x6E, 0x33, 0xA1, 0x02, 0x6A, 0xE8, 0xA9,
+    0x55, 0x46, 0x42, 0x9B, 0x85, 0x3D, 0x1E, 0xC9, 0xFB, 0x43, 0xA8, 0x60, 0x42, 0x39, 0x8B, 0x3C,
+    0x68, 0x81, 0x34, 0xF2, 0xEE, 0x21, 0xF4, 0x9B, 0x3D, 0x90, 0x36, 0x35, 0x51, 0xB3, 0x6D, 0x0E,
+    0x13, 0xBE, 0xF9, 0xDC, 0x73, 0xC2, 0x9A, 0x1D, 0x27, 0x74, 0xA4, 0x7F, 0xB0, 0x73, 0x28, 0x01,
+    0x4F, 0xE5, 0xCB, 0x09, 0x48, 0x2B, 0xEB, 0xDF, 0xB8, 0x77, 0xCF, 0x46, 0xA2, 0x12, 0x38, 0xD4,
+    0x22, 0xD8, 0xE9, 0x83, 0xB1, 0x00, 0x22, 0xDE, 0x86, 0x97, 0x10, 0xCC, 0x55, 0xB9, 0x0E, 0xBA,
+    0xC4, 0x4D, 0x22, 0x88, 0xAB, 0xE8, 0x5E, 0x62, 0x1E, 0x2B, 0x4B, 0x82, 0x22, 0xA7, 0x17, 0xBC,
+    0xBA, 0x79, 0x1C, 0x84, 0xC2, 0x2A, 0xFA, 0x02, 0x29, 0x9D, 0xF2, 0xA1, 0xF3, 0x95, 0xD8, 0xD2,
+    0x6A, 0x70, 0x2E, 0x70, 0x3C, 0x56, 0x8E, 0x1D, 0xFC, 0x59, 0x91, 0x52, 0x02, 0x06, 0xA5, 0xB0,
+    0x16, 0x52, 0x62, 0x39, 0x5B, 0xB1, 0x89, 0xD4, 0xD1, 0x66, 0xCD, 0x74, 0x8D, 0x58, 0xD1, 0xC6,
+    0x70, 0x80, 0x59, 0x0F, 0x98, 0x5F, 0x3D, 0x44, 0x76, 0xA5, 0x30, 0xF4, 0x3B, 0xDF, 0xE6, 0x3D,
+    0x95, 0x61, 0x6F, 0xF4, 0x39, 0x5F, 0xE4, 0x50, 0x88, 0x02, 0xFE, 0x89, 0xB0, 0xDE, 0x6F, 0x34,
+    0x52, 0x82, 0x0D, 0x1E, 0x70, 0x1E, 0xE2, 0xDA, 0x69, 0x07, 0x22, 0xD7, 0xB0, 0x93, 0x7E, 0xA5,
+    0x43, 0x01, 0x8F, 0x6A, 0x5F, 0x3E, 0x26, 0xB7, 0xE5, 0x26, 0x5C, 0xFF, 0x4C, 0x22, 0x79, 0xFC,
+    0xA5, 0xD0, 0xFA, 0x46, 0xAE, 0x29, 0xD9, 0xFE, 0xFA, 0x21, 0x5D, 0x47, 0x60, 0x4F, 0x80, 0x04,
+    0x6F, 0x30, 0xE9, 0xA2, 0xAD, 0x83, 0xE5, 0xE1, 0x13, 0x9D, 0xC3, 0x19, 0xA1, 0x14, 0x64, 0xA8,
+    0xE6, 0xE4, 0x42, 0x4A, 0xF4, 0x77, 0xA3, 0xE4, 0x3B, 0x4A, 0x44, 0xB4, 0xD0, 0x10, 0x07, 0x0D,
+    0x41, 0x4B, 0xCF, 0x97, 0x84, 0xF7, 0x0A, 0x75, 0x44, 0xC3, 0xC3, 0xCE, 0x70, 0xCD, 0x4E, 0x17,
+    0xAF, 0x53, 0x6F, 0x4C, 0x0D, 0x46, 0x1A, 0xD6, 0x42, 0x64, 0xF6, 0xCB, 0x7B, 0x4B, 0x3E, 0xE3,
+    0xF7, 0x16, 0xB5, 0x95, 0x31, 0x8F, 0xE4, 0x44, 0x10, 0x85, 0x9F, 0xC7, 0xDA, 0xB1, 0x74, 0x0E,
+    0x9A, 0xE0, 0x48, 0x38, 0x09, 0xE7, 0x97, 0xF8, 0x27, 0xB4, 0x73, 0x12, 0x02, 0xEE, 0x27, 0x10,
+    0x10, 0xED, 0x4F, 0xB0, 0x25, 0xC2, 0x4B, 0x2E, 0x20, 0x23, 0xD9, 0x78, 0x7F, 0x04, 0x36, 0x22,
+    0x20, 0x1D, 0x89, 0x90, 0xC4, 0xE9, 0x11, 0x19, 0xC9, 0x87, 0xBC, 0x8B, 0xED, 0xE2, 0xBD, 0xEA,
+    0x99, 0x65, 0xF6, 0x74, 0xE9, 0x59, 0x3B, 0xED, 0x19, 0xB7, 0xBB, 0xBA, 0xDE, 0x57, 0xAF, 0x6B,
+    0xF1, 0xA2, 0x39, 0x76, 0xD9, 0x8A, 0x15, 0xE1, 0xB1, 0xEF, 0x60, 0x36, 0x21, 0xB7, 0x0D, 0x38,
+    0x3E, 0x20, 0x5D, 0xC7, 0x77, 0x40, 0xC5, 0xA7, 0xA5, 0xD9, 0xE9, 0x60, 0x66, 0x68, 0xF7, 0x7E,
+    0x0E, 0x7B, 0x66, 0xBF, 0xDA, 0x10, 0xD6, 0x38, 0xC3, 0x7E, 0x33, 0x84, 0xB5, 0x1D, 0x61, 0xBF,
+    0xEF, 0xFC, 0xD2, 0x9F, 0x32, 0x7B, 0xBB, 0x21, 0xCE, 0xED, 0x58, 0x58, 0x61, 0x99, 0x8D, 0x71,
+    0xB7, 0x35, 0xD3, 0x4A, 0x86, 0x18, 0x18, 0xEB, 0x04, 0xDC, 0x34, 0x1E, 0xFB, 0xAB, 0xBB, 0x7B,
+    0x7E, 0xA9, 0xE6, 0x7E, 0x00, 0xC2, 0xDC, 0xFA, 0x18, 0x39, 0x96, 0x53, 0xEC, 0x80, 0x62, 0xAC,
+    0x1A, 0x3C, 0xBF, 0x7C, 0x31, 0x7A, 0xC6, 0x02, 0x53, 0x65, 0x56, 0x1A, 0xF9, 0xC3, 0xB6, 0x82,
+    0x33, 0xED, 0x82, 0xB8, 0x22, 0x2E, 0x28, 0x0C, 0xF5, 0xCA, 0xA7, 0x43, 0xA0, 0x92, 0x38, 0xE7,
+    0x7C, 0x23, 0x6C, 0x19, 0x37, 0xCF, 0xAD, 0xE9, 0x47, 0x4D, 0x30, 0x6F, 0xC4, 0x29, 0xF0, 0xA5,
+    0x6A, 0xD5, 0x74, 0xB9, 0x23, 0x4D, 0x73, 0xE2, 0xC0, 0x75, 0x3B, 0x5F, 0x1A, 0xF9, 0x05, 0xDC,
+    0x23, 0x72, 0xE9, 0xAC, 0xE4, 0x6D, 0xF1, 0xFD, 0x38, 0x06, 0xE3, 0x13, 0xA0, 0xF5, 0x74, 0xF0,
+    0x12, 0x17, 0x35, 0x1D, 0xF2, 0xBD, 0xE2, 0x8C, 0xFD, 0xC8, 0x8D, 0xEB, 0xD1, 0x1A, 0x14, 0x73,
+    0x4D, 0x41, 0x4B, 0x3E, 0xE2, 0x8A, 0xA7, 0x03, 0x75, 0xA2, 0x70, 0xA4, 0xCE, 0x14, 0x82, 0x3A,
+    0x64, 0xA2, 0x0A, 0x61, 0x1D, 0x72, 0x71, 0x85, 0xC0, 0x0E, 0x85, 0xC8, 0x42, 0x68, 0xBB, 0x52,
+    0x6C, 0x21, 0xB8, 0x70, 0xBA, 0x10, 0x5E, 0x38, 0xDF, 0x04, 0xF8, 0x0C, 0xE9, 0xE6, 0x19, 0xBB,
+    0x42, 0x9C, 0xD6, 0x74, 0x53, 0x64, 0x73, 0x1D, 0x7E, 0xB3, 0xA6, 0x26, 0x95, 0x0F, 0x6F, 0xBE,
+    0x2D, 0xAC, 0xCB, 0x77, 0x81, 0x1D, 0xB5, 0x29, 0xC1, 0x80, 0x7B, 0x89, 0x89, 0xD0, 0x90, 0x16,
+    0x19, 0xBE, 0xF9, 0x8E, 0x99, 0x68, 0xAF, 0xA6, 0x3F, 0xA1, 0x66, 0x01, 0x08, 0xD8, 0x15, 0xF0,
+    0x8D, 0xF8, 0x78, 0x7F, 0xC7, 0x24, 0x73, 0xAF, 0xCD, 0xE0, 0x21, 0x42, 0x0A, 0x01, 0x26, 0xA4,
+    0x10, 0xA5, 0x0B, 0x62, 0xA8, 0x55, 0xB5, 0xF0, 0x85, 0x4A, 0x2A, 0xF8, 0xBD, 0x43, 0xD4, 0x6D,
+    0x16, 0x55, 0x17, 0x83, 0x2F, 0x53, 0xEA, 0xD9, 0xF7, 0xFA, 0x93, 0xAA, 0x9A, 0x99, 0x99, 0x3D,
+    0x30, 0xF3, 0x24, 0x60, 0x2D, 0xED, 0x67, 0xDB, 0xCB, 0x2D, 0x6C, 0x07, 0x9B, 0xF3, 0xBD, 0x5E,
+    0x88, 0xA3, 0xD8, 0x98, 0xA8, 0x0D, 0xD5, 0xAA, 0xDB, 0x5F, 0xB6, 0xB4, 0xA3, 0xD2, 0x1D, 0xD3,
+    0x8D, 0x59, 0x1F, 0xEC, 0xF1, 0x1D, 0x41, 0x7A, 0x96, 0xED, 0x58, 0x52, 0x1C, 0xDA, 0xA9, 0x62,
+    0x3A, 0x0D, 0x39, 0xDA, 0x87, 0xDB, 0xA1, 0x4A, 0x88, 0x88, 0xF2, 0xD6, 0x54, 0x8E, 0xA5, 0x30,
+    0x42, 0xB9, 0xB9, 0xA4, 0x73, 0xBC, 0x47, 0x62, 0xC2, 0xF4, 0x39, 0x64, 0x1A, 0xA0, 0x60, 0xF8,
+    0xE5, 0x99, 0x53, 0x83, 0xBD, 0x77, 0xEA, 0xB3, 0xCB, 0x6C, 0x92, 0x5B, 0xE3, 0x74, 0xAB, 0x42,
+    0x1E, 0xAC, 0x23, 0xC6, 0x76, 0x62, 0x84, 0x8A, 0x45, 0x18, 0x68, 0xBE, 0x38, 0x31, 0x66, 0xB5,
+    0x16, 0x2C, 0xB5, 0x76, 0xD7, 0x9A, 0x01, 0xBE, 0x30, 0xFA, 0xA1, 0x59, 0x6A, 0x3A, 0x90, 0x26,
+    0xD7, 0xD6, 0x9A, 0x19, 0x6A, 0x7A, 0x7D, 0xE2, 0x6F, 0x05, 0x38, 0x11, 0x72, 0x2D, 0x1B, 0xE7,
+    0x5E, 0x08, 0x52, 0xC2, 0x81, 0x07, 0x4B, 0xF6, 0xC5, 0xE5, 0xC3, 0xB3, 0x8D, 0xF6, 0x62, 0x89,
+    0xEC, 0x0E, 0xFD, 0x37, 0x74, 0xD9, 0x9F, 0x2C, 0xC8, 0xBF, 0x4C, 0xC6, 0x8F, 0xF6, 0xC3, 0x17,
+    0x10, 0xFD, 0xB8, 0x78, 0xDD, 0xC0, 0x0C, 0x93, 0xC4, 0x73, 0xF1, 0x11, 0x96, 0x4F, 0x3C, 0xE4,
+    0xF6, 0x17, 0xB1, 0x95, 0xEC, 0x5C, 0x4B, 0x71, 0x54, 0x55, 0x5D, 0x6B, 0x9C, 0xA8, 0xCD, 0xBD,
+    0xDA, 0x9F, 0x8A, 0x3D, 0x49, 0xD5, 0xA9, 0x64, 0xFD, 0x5B, 0xEF, 0x09, 0xD3, 0xE1, 0xEC, 0xC7,
+    0x8D, 0xC9, 0xCB, 0xA0, 0x2C, 0x67, 0x12, 0x1A, 0x36, 0xF7, 0x3F, 0x59, 0x05, 0xD9, 0xC5, 0x75,
+    0x12, 0x42, 0x3F, 0x45, 0x71, 0xD4, 0xB0, 0x5C, 0xE1, 0x2E, 0xE5, 0x2B, 0x65, 0x88, 0x6A, 0x92,
+    0xC3, 0x06, 0x9C, 0xE5, 0x9E, 0xCF, 0xE6, 0xB1, 0x73, 0xC5, 0xE1, 0x1F, 0xF1, 0xE9, 0x17, 0x25,
+    0xDB, 0xB8, 0xE4, 0xE8, 0x16, 0xEF, 0x92, 0x1A, 0xC9, 0x63, 0xA6, 0x09, 0x80, 0x6B, 0x54, 0xC8,
+    0x4C, 0xD3, 0xDC, 0x3A, 0x59, 0xFB, 0xE9, 0xBD, 0xA7, 0xAB, 0x3D, 0x9D, 0xF7, 0xD7, 0x74, 0xC5,
+    0x1F, 0xF9, 0xF2, 0xBF, 0x7B, 0x7F, 0xC0, 0x8B, 0x8E, 0x4D, 0xA0, 0xE4, 0xA3, 0xF8, 0x87, 0x9F,
+    0x2E, 0x45, 0x2B, 0x55, 0xA3, 0xE7, 0x0A, 0xCE, 0x14, 0x33, 0xA1, 0x48, 0x18, 0x73, 0x37, 0x81,
+    0x73, 0xE4, 0xCE, 0xFD, 0x98, 0x40, 0x92, 0x8F, 0xB7, 0x84, 0xD2, 0x5B, 0x82, 0x9D, 0x1C, 0xA5,
+    0xF4, 0x18, 0x92, 0x6B, 0xA2, 0xEA, 0xE0, 0x30, 0xF9, 0x22, 0xC5, 0x38, 0x4D, 0xBE, 0xA8, 0x03,
+    0x2C, 0x9C, 0x7E, 0x3A, 0x92, 0x6F, 0x58, 0x4A, 0x9E, 0x49, 0x07, 0xEA, 0xEE, 0xE9, 0xF0, 0x9A,
+    0xFD, 0x29, 0x5F, 0x73, 0xCE, 0xFF, 0x6D, 0x6A, 0xB4, 0xEA, 0x89, 0x14, 0x5C, 0x6F, 0x4F, 0xED,
+    0xEB, 0xB3, 0x80, 0x7C, 0x7D, 0x27, 0x5F, 0x75, 0x67, 0x3F, 0xE9, 0x4B, 0x98, 0x71, 0x65, 0x58,
+    0x37, 0x6D, 0xBF, 0x3B, 0x18, 0xB9, 0x65, 0xF7, 0xE6, 0x43, 0xA7, 0xBF, 0xEA, 0x24, 0x0E, 0xB5,
+    0x96, 0xA9, 0xB3, 0x7B, 0x63, 0xC9, 0xD5, 0x00, 0x1D, 0x71, 0x50, 0xF2, 0x21, 0x35, 0xDB, 0x51,
+    0xE7, 0x71, 0xD0, 0xD0, 0xE8, 0xDF, 0x01, 0x52, 0x2A, 0x4C, 0xEE, 0x6B, 0x41, 0x60, 0xD3, 0x59,
+    0x64, 0x48, 0x9D, 0xBF, 0x05, 0x47, 0xDB, 0x9B, 0xEB, 0x13, 0xAF, 0x03, 0xAF, 0x8F, 0xBC, 0x9F,
+    0xD9, 0xD5, 0x61, 0x3F, 0xFE, 0xA4, 0x7E, 0x35, 0x6B, 0xB9, 0xC0, 0x37, 0xF5, 0x5A, 0x0C, 0x6A,
+    0x79, 0x2E, 0xA6, 0x5F, 0xB5, 0xF9, 0xA8, 0x9A, 0x9E, 0x5B, 0x7E, 0x7B, 0x81, 0xD4, 0x8F, 0x2F,
+    0xB9, 0x7D, 0xF9, 0xBE, 0x67, 0x45, 0xA8, 0xA6, 0xE7, 0xE7, 0x95, 0x0A, 0x7F, 0xF3, 0xF1, 0x7F,
+    0xBC, 0xCF, 0x7D, 0xFD, 0x07, 0xCD, 0x55, 0xBB, 0x8E, 0xD4, 0x40, 0x10, 0x6C, 0x7B, 0xB5, 0x67,
+    0x09, 0x07, 0x93, 0x40, 0xC2, 0x49, 0x38, 0x87, 0xC0, 0x9F, 0x30, 0xCE, 0x48, 0x37, 0xE0, 0xE2,
+    0xFB, 0x03, 0x88, 0x11, 0x48, 0xF6, 0x1F, 0x40, 0x40, 0x46, 0x42, 0x00, 0xC1, 0xF1, 0x07, 0x24,
+    0x8C, 0x25, 0x02, 0xD2, 0x95, 0xF8, 0x01, 0x23, 0x20, 0x80, 0xE4, 0x1C, 0x38, 0x30, 0x68, 0x76,
+    0x9A, 0xAA, 0xB6, 0x97, 0x13, 0x64, 0x24, 0x88, 0x93, 0xC6, 0xEB, 0xB9, 0xE9, 0x47, 0x55, 0x75,
+    0x4F, 0x5B, 0xE4, 0xDA, 0x85, 0x88, 0x68, 0x14, 0x71, 0x3A, 0xE3, 0xE5, 0xC9, 0x28, 0x6E, 0x76,
+    0xA3, 0x04, 0x71, 0x7B, 0xF9, 0xF5, 0x97, 0x85, 0x24, 0x52, 0xAB, 0xF6, 0x1B, 0xD5, 0xC4, 0x97,
+    0x51, 0x74, 0x38, 0xED, 0x0A, 0xC5, 0x59, 0x0D, 0x37, 0x09, 0x03, 0x8C, 0xB4, 0x17, 0xD9, 0x28,
+    0xDC, 0x4A, 0x1D, 0x18, 0x6F, 0x5C, 0x1F, 0xB6, 0x2D, 0x78, 0x5A, 0x68, 0x83, 0xFF, 0x1D, 0xE8,
+    0x35, 0x31, 0x6D, 0x7F, 0xAB, 0x29, 0x55, 0x5A, 0xD5, 0x39, 0x53, 0x44, 0x2F, 0xF0, 0x22, 0x27,
+    0x9A, 0x60, 0x74, 0xC3, 0xD2, 0xBE, 0xEE, 0x10, 0x75, 0xC6, 0x52, 0xAC, 0xF3, 0x31, 0xD3, 0xFC,
+    0x20, 0xC8, 0xDF, 0x1B, 0xA8, 0x93, 0x67, 0x02, 0xD7, 0x89, 0xEE, 0xE2, 0x55, 0x9B, 0x3A, 0x16,
+    0x7D, 0x89, 0xD8, 0xB9, 0x76, 0x00, 0x64, 0x8C, 0x06, 0x73, 0x95, 0x8A, 0x28, 0xDA, 0x03, 0xD1,
+    0xF1, 0x68, 0xB8, 0x8E, 0xF4, 0xE5, 0xD7, 0x10, 0x73, 0xB2, 0x09, 0x58, 0xA7, 0x8A, 0xC3, 0x6D,
+    0x73, 0xA4, 0x7B, 0x42, 0x29, 0x02, 0x3C, 0x1D, 0x01, 0x05, 0xE3, 0xDD, 0xDD, 0x97, 0x2A, 0xAE,
+    0x4C, 0x2D, 0x83, 0x91, 0x77, 0x24, 0x54, 0x73, 0xEB, 0xC9, 0xCF, 0x1E, 0xB6, 0xAD, 0x78, 0x5A,
+    0x91, 0xA9, 0x27, 0xD3, 0xB0, 0x67, 0x72, 0x79, 0x28, 0x75, 0x24, 0xD3, 0x01, 0x4C, 0x15, 0x36,
+    0x00, 0x78, 0xAA, 0xDF, 0x71, 0x4E, 0xC3, 0x62, 0x3E, 0xAA, 0x09, 0xFD, 0xE1, 0x87, 0x50, 0x8F,
+    0x94, 0xB2, 0x22, 0x40, 0x91, 0x4C, 0x8F, 0x57, 0xC6, 0x18, 0x11, 0x22, 0x0A, 0x31, 0x95, 0x9A,
+    0x8D, 0x24, 0x5C, 0x26, 0x6A, 0xDC, 0x23, 0xC1, 0x22, 0x15, 0x6C, 0x7A, 0xC0, 0x43, 0x4A, 0x0A,
+    0x1F, 0x86, 0x1D, 0xD2, 0xBF, 0x7D, 0xAE, 0x3D, 0x88, 0x74, 0x64, 0xFB, 0x80, 0x11, 0xE1, 0x97,
+    0xA5, 0xB5, 0x68, 0x7E, 0x59, 0x95, 0x72, 0x35, 0xE2, 0x88, 0xE8, 0xE4, 0x85, 0x5C, 0xC8, 0x26,
+    0x16, 0x51, 0xF2, 0x54, 0x03, 0x8F, 0xD2, 0xB0, 0xB5, 0x82, 0x47, 0x91, 0x3F, 0x5A, 0xA3, 0x64,
+    0x47, 0x78, 0xD2, 0xA1, 0x58, 0xD6, 0x1B, 0x16, 0xD8, 0x84, 0xB2, 0x87, 0x6D, 0x45, 0x4D, 0x0B,
+    0x72, 0x31, 0xA5, 0xAC, 0x3B, 0x72, 0x8A, 0x2D, 0x6D, 0x3C, 0xEA, 0x65, 0xED, 0x51, 0xDA, 0x5B,
+    0x34, 0xC1, 0xAC, 0x3F, 0xF8, 0x18, 0xF9, 0xE8, 0x56, 0xC5, 0xAC, 0x41, 0x2E, 0xE4, 0x66, 0x57,
+    0x4E, 0xE5, 0x2C, 0xFE, 0x5D, 0x22, 0xF5, 0xCE, 0x6A, 0x2E, 0xED, 0xBC, 0x82, 0xBB, 0xB9, 0x5B,
+    0x5A, 0xA4, 0x5A, 0x5A, 0x77, 0x92, 0x30, 0x56, 0x4B, 0x6C, 0x96, 0xB1, 0x5C, 0x4A, 0xD6, 0x2D,
+    0xA2, 0x15, 0xBC, 0x04, 0xA6, 0x9A, 0x4B, 0x66, 0xB0, 0xA5, 0x25, 0x75, 0x2B, 0x97, 0x2E, 0x48,
+    0xE8, 0x0B, 0x96, 0xFB, 0x1E, 0x91, 0xA2, 0x7E, 0x23, 0xB8, 0xEA, 0x3B, 0xAC, 0x84, 0x36, 0xD1,
+    0xE9, 0xC6, 0x79, 0x3A, 0x6B, 0xC4, 0x8F, 0xD6, 0xD7, 0x56, 0x6D, 0x98, 0xCD, 0x57, 0xB5, 0x37,
+    0x3E, 0x80, 0x33, 0xAE, 0x8A, 0x18, 0x8C, 0x5F, 0xE6, 0x56, 0x60, 0x2B, 0xBE, 0xFE, 0x6E, 0x6E,
+    0xED, 0x86, 0xAC, 0x39, 0xA5, 0xAB, 0x06, 0xC6, 0x3B, 0x76, 0x87, 0x58, 0x77, 0x1C, 0x51, 0x57,
+    0x47, 0xD2, 0x2C, 0x2D, 0xAE, 0xC8, 0x06, 0x07, 0xA1, 0x07, 0xEE, 0x88, 0xC2, 0xBC, 0x07, 0x85,
+    0x3B, 0xFA, 0xBA, 0xF1, 0x83, 0x14, 0x07, 0x83, 0xC4, 0xE8, 0xAC, 0x37, 0x5B, 0xA6, 0x11, 0x54,
+    0x98, 0x39, 0x3D, 0x7F, 0x2E, 0xA1, 0xC9, 0x88, 0xAB, 0x61, 0xF7, 0xB6, 0xEE, 0xAC, 0x2F, 0x89,
+    0x1A, 0xE7, 0x8E, 0xB7, 0xCD, 0xD2, 0xF9, 0xCF, 0x48, 0x74, 0x9B, 0x5D, 0xA2, 0x02, 0x7F, 0xAD,
+    0x46, 0xA1, 0x0B, 0xDC, 0x27, 0x0A, 0xDB, 0x5C, 0x35, 0xC8, 0xBF, 0x97, 0x8A, 0xDD, 0x81, 0x9F,
+    0x32, 0x2E, 0x12, 0x49, 0x3D, 0x88, 0xFB, 0x30, 0x4B, 0x1E, 0xDB, 0x45, 0x37, 0x1E, 0x94, 0x4B,
+    0x47, 0x58, 0x73, 0x75, 0x79, 0xF8, 0xF1, 0x52, 0x36, 0x0C, 0xDB, 0xEE, 0xD7, 0x6C, 0xD6, 0x9E,
+    0x91, 0xFA, 0xF2, 0x32, 0x4F, 0x8C, 0xBC, 0x62, 0xB0, 0x84, 0x3E, 0x51, 0x29, 0xE5, 0x65, 0x1F,
+    0xD7, 0x8E, 0xBE, 0xFE, 0xF7, 0x5C, 0x73, 0x5D, 0x66, 0x4C, 0xB4, 0xBB, 0xC3, 0xC1, 0xD0, 0x64,
+    0xE7, 0xE9, 0xDE, 0x5F, 0x72, 0x15, 0x1B, 0xD5, 0x41, 0xAC, 0xE2, 0x28, 0x24, 0xA9, 0x21, 0x14,
+    0x87, 0xE9, 0x35, 0xFD, 0xF6, 0x94, 0xBC, 0x40, 0x60, 0x1B, 0xBE, 0x34, 0xC8, 0x82, 0x7B, 0x3C,
+    0xE3, 0x64, 0xCF, 0xA2, 0x53, 0x07, 0x66, 0xB2, 0xD1, 0x71, 0x09, 0x20, 0xD1, 0xE8, 0x70, 0x7E,
+    0x65, 0x4B, 0xE8, 0x2D, 0x10, 0x1C, 0x72, 0x9A, 0xA4, 0xC4, 0xAB, 0x42, 0xCB, 0x8F, 0x01, 0x70,
+    0x1E, 0xCB, 0x9B, 0xDF, 0x86, 0x00, 0x5C, 0x42, 0x8F, 0x99, 0xEE, 0x30, 0x98, 0xD0, 0x0D, 0x3D,
+    0xC2, 0x56, 0x33, 0xE0, 0x02, 0x23, 0xA0, 0x7A, 0x8E, 0x29, 0xEC, 0xE0, 0xDE, 0x8E, 0xC0, 0x5F,
+    0x24, 0x8E, 0x83, 0xB0, 0x07, 0x31, 0x17, 0xF3, 0x3F, 0x1C, 0x3A, 0x3A, 0x4C, 0x98, 0x69, 0xD8,
+    0x41, 0xA3, 0x96, 0xBE, 0xD8, 0x05, 0xE8, 0x83, 0x0F, 0x44, 0x83, 0xBB, 0xED, 0x29, 0x1B, 0xB5,
+    0xDB, 0x93, 0xEB, 0x44, 0xD9, 0xA9, 0x50, 0xB6, 0x5B, 0xD1, 0xEC, 0xA4, 0x9C, 0x8B, 0x3D, 0xAA,
+    0x12, 0xC4, 0xBE, 0x28, 0xF5, 0x5D, 0x64, 0x9B, 0xB3, 0xF9, 0x0A, 0x2F, 0x42, 0x57, 0x13, 0x80,
+    0x84, 0xBE, 0x1D, 0x36, 0x0A, 0x04, 0x2E, 0x42, 0x8C, 0x76, 0xF0, 0xE8, 0xFB, 0x46, 0x7B, 0x17,
+    0xA1, 0xBB, 0x1F, 0xC1, 0x47, 0x3B, 0x5C, 0xFF, 0x04, 0x73, 0x3F, 0x39, 0x7C, 0xA3, 0x7A, 0x3F,
+    0x38, 0xD2, 0x08, 0x80, 0x7A, 0xA9, 0x7B, 0xA7, 0x07, 0x4E, 0xF1, 0x4F, 0x11, 0x93, 0x0B, 0x33,
+    0x7B, 0xBB, 0x04, 0x3F, 0x3B, 0xDB, 0x71, 0xB4, 0xB1, 0x56, 0xBA, 0x7C, 0x03, 0xD3, 0x7F, 0xAB,
+    0xD5, 0x4F, 0xCD, 0x94, 0x31, 0x8E, 0xDE, 0x36, 0x10, 0x85, 0x47, 0x12, 0x0C, 0x01, 0xAB, 0x82,
+    0x8D, 0x2B, 0x37, 0x3A, 0x02, 0x6F, 0x60, 0x09, 0x3E, 0x81, 0x1B, 0xDF, 0x21, 0x48, 0x93, 0x0B,
+    0x38, 0x20, 0x81, 0x94, 0x29, 0x76, 0x6F, 0xE0, 0x66, 0x8B, 0xC0, 0x2E, 0x7C, 0x01, 0xC3, 0x94,
+    0x93, 0xC2, 0x45, 0x0A, 0xD3, 0xF0, 0x01, 0x56, 0x40, 0xD2, 0xAF, 0x10, 0x28, 0x09, 0xE1, 0x25,
+    0x39, 0x79, 0x33, 0x5A, 0xEC, 0xDA, 0xEB, 0x32, 0x80, 0x61, 0x15, 0xFA, 0x49, 0xFD, 0x24, 0xE7,
+    0xCD, 0x37, 0x6F, 0x48, 0xCD, 0x93, 0x27, 0x33, 0x8D, 0x5C, 0x89, 0x02, 0xEF, 0xD4, 0x32, 0x2F,
+    0x74, 0xF3, 0x4C, 0x5B, 0xC3, 0x33, 0x2F, 0x43, 0xEE, 0x2B, 0xC6, 0x76, 0x27, 0x5E, 0xC2, 0xD2,
+    0xD7, 0x8E, 0xC9, 0xEE, 0x26, 0x63, 0xE6, 0xD6, 0x8E, 0x5B, 0x9E, 0x4D, 0xC2, 0x2C, 0xAC, 0xD3,
+    0xD6, 0x61, 0xB9, 0x1F, 0x73, 0x57, 0x89, 0x37, 0x93, 0x07, 0xF6, 0x53, 0xE5, 0x42, 0xCC, 0x17,
+    0x38, 0xA8, 0x4E, 0x4B, 0xC3, 0x91, 0x89, 0x1E, 0xEB, 0xD9, 0xE7, 0xF4, 0x1D, 0xD1, 0xB8, 0x98,
+    0x85, 0x1A, 0x7E, 0x91, 0x88, 0x0C, 0xB3, 0x44, 0xD4, 0xF0, 0x3F, 0x9C, 0xD1, 0x27, 0x4F, 0xC3,
+    0x9E, 0xC2, 0x82, 0xE8, 0x26, 0xE3, 0x7C, 0x44, 0x9D, 0x36, 0x1A, 0x13, 0x44, 0x20, 0xB2, 0x5B,
+    0x21, 0x6C, 0x28, 0x84, 0x19, 0x76, 0x3A, 0x04, 0xA5, 0xBE, 0x36, 0x18, 0x86, 0x68, 0x13, 0x36,
+    0xB4, 0x77, 0x36, 0x78, 0xD9, 0xB0, 0x0F, 0x55, 0x36, 0x84, 0x88, 0x0D, 0xD8, 0x8B, 0x59, 0x58,
+    0xB1, 0xA7, 0xC7, 0x71, 0x09, 0x0A, 0x58, 0x16, 0x32, 0x47, 0x1A, 0x18, 0x44, 0xC0, 0x26, 0x89,
+    0x08, 0x55, 0x7D, 0xE2, 0xDB, 0x33, 0x9A, 0x66, 0xEB, 0x89, 0x5F, 0x64, 0x08, 0xE3, 0x15, 0x4B,
+    0x81, 0xAE, 0x79, 0xED, 0x6F, 0xF5, 0xE2, 0xE8, 0x51, 0xF0, 0x84, 0x1B, 0x3C, 0x79, 0xC8, 0xE4,
+    0x80, 0xA7, 0x15, 0x9A, 0xE6, 0x96, 0xA6, 0x07, 0x5B, 0xA1, 0x39, 0xED, 0x26, 0x41, 0xC0, 0xB4,
+    0x1A, 0x49, 0x23, 0x40, 0xEA, 0x25, 0x47, 0xC3, 0x05, 0x07, 0xF1, 0x1F, 0x99, 0xC6, 0x62, 0x36,
+    0xBA, 0x77, 0x1C, 0xDE, 0x8A, 0x18, 0x12, 0x5D, 0x34, 0xBD, 0x04, 0xAB, 0x6E, 0x7D, 0x8A, 0xE1,
+    0xC3, 0x5E, 0x86, 0x1F, 0x33, 0x09, 0xC7, 0x19, 0x6F, 0xEB, 0xBF, 0x51, 0x82, 0x34, 0x46, 0x24,
+    0x01, 0x6E, 0x34, 0x5E, 0x60, 0xF4, 0xCA, 0x78, 0x6A, 0xB7, 0x87, 0x44, 0xFD, 0x15, 0x16, 0xC2,
+    0x30, 0x18, 0xFD, 0x49, 0x5F, 0xC7, 0x81, 0xCD, 0xF3, 0x93, 0x5F, 0x40, 0xAD, 0x8E, 0x88, 0x6C,
+    0xD2, 0x04, 0x35, 0x36, 0x0A, 0x3C, 0xF7, 0x48, 0x38, 0xA6, 0x6E, 0xA5, 0x2F, 0x19, 0x1E, 0x34,
+    0xBA, 0xEB, 0xB7, 0x7C, 0x3C, 0x28, 0xF6, 0xCA, 0xE3, 0xC0, 0x28, 0x04, 0x8F, 0x77, 0xA5, 0x31,
+    0xCB, 0x47, 0x05, 0x49, 0xCA, 0x9F, 0x94, 0xA4, 0xBC, 0xF1, 0x51, 0x51, 0x42, 0xB6, 0x4C, 0x95,
+    0xA5, 0xBC, 0x31, 0x55, 0x98, 0xE4, 0xF6, 0x1E, 0x31, 0x95, 0x26, 0x59, 0x46, 0x16, 0xD7, 0x38,
+    0x61, 0x3B, 0x7F, 0xCB, 0xF3, 0xE4, 0xFC, 0xFB, 0x33, 0x28, 0xC0, 0xC9, 0xE4, 0x7E, 0xC5, 0x4A,
+    0xB3, 0x39, 0x4F, 0x5D, 0x32, 0x48, 0xE7, 0xC7, 0x76, 0xFF, 0x34, 0x03, 0xF5, 0x25, 0x89, 0x0B,
+    0x49, 0x69, 0x22, 0x98, 0x68, 0x16, 0x6B, 0x22, 0x1B, 0xC8, 0x54, 0xA0, 0x48, 0xE9, 0xD0, 0xAA,
+    0xA9, 0x59, 0x91, 0x8A, 0x74, 0xC1, 0x13, 0xEA, 0xD4, 0xA0, 0xC2, 0x1B, 0x8A, 0x05, 0x6B, 0xC7,
+    0xEC, 0x96, 0xC3, 0xA3, 0x50, 0x3B, 0x2D, 0xD7, 0x64, 0xBF, 0x09, 0xBB, 0x0D, 0x92, 0x7B, 0x2B,
+    0x95, 0x24, 0x27, 0x2F, 0xA3, 0xE5, 0x64, 0xBA, 0x69, 0x91, 0xA0, 0x0B, 0xF8, 0xB3, 0x22, 0x0B,
+    0x02, 0x17, 0x05, 0x91, 0x62, 0x40, 0x2C, 0x98, 0x0E, 0xCE, 0x91, 0x46, 0x2D, 0xD2, 0xA8, 0x1B,
+    0x6A, 0x07, 0x0B, 0xC6, 0x4E, 0x2D, 0x28, 0xA6, 0xE3, 0x38, 0xAD, 0x28, 0x37, 0x8C, 0x96, 0x95,
+    0x8C, 0xE1, 0xC0, 0xF3, 0xC4, 0xFF, 0xE2, 0x20, 0x3E, 0xDD, 0x0E, 0x2C, 0xF7, 0x3B, 0x89, 0xE5,
+    0x10, 0x55, 0x07, 0x76, 0xB9, 0x56, 0xD2, 0x41, 0x33, 0xBC, 0x82, 0xEF, 0x7D, 0xB9, 0x91, 0xF0,
+    0xE0, 0x5C, 0x7F, 0x06, 0xF9, 0x4F, 0x04, 0x1E, 0x0A, 0xC3, 0x3B, 0xAD, 0xA5, 0x5D, 0x85, 0x32,
+    0xF5, 0x3B, 0x15, 0xBA, 0xFB, 0x80, 0x3A, 0xAA, 0x31, 0x5D, 0xAA, 0xD9, 0x86, 0xC2, 0x5E, 0xB0,
+    0xF2, 0x3B, 0x10, 0xC2, 0x15, 0xB2, 0x4B, 0x39, 0x61, 0x59, 0x93, 0x28, 0x48, 0xC5, 0x91, 0x1E,
+    0xC7, 0x21, 0x9B, 0xD4, 0x4A, 0x7B, 0xF8, 0xE0, 0xA7, 0xCB, 0x68, 0xF7, 0x21, 0xF5, 0x1F, 0x25,
+    0xCF, 0xB0, 0xB0, 0x8D, 0x0E, 0xFF, 0x8F, 0x7F, 0x15, 0x69, 0xAC, 0xDF, 0x8A, 0xB4, 0xC6, 0x90,
+    0xDD, 0x9B, 0x62, 0xE1, 0x9B, 0xDF, 0xD3, 0xF8, 0xA1, 0xD2, 0x90, 0xB8, 0x29, 0x88, 0x18, 0x9E,
+    0xAD, 0xE3, 0x45, 0x42, 0x07, 0xE7, 0xA6, 0x20, 0x17, 0x87, 0xFE, 0xE3, 0x0D, 0x69, 0xED, 0x8D,
+    0x78, 0xD6, 0xC9, 0x25, 0xB6, 0x60, 0x1A, 0x1B, 0x29, 0x8E, 0x83, 0x16, 0x3E, 0x92, 0x66, 0xAD,
+    0x48, 0xFB, 0x7C, 0xD6, 0xFC, 0xB4, 0x52, 0x16, 0x1B, 0x91, 0x7A, 0x16, 0x24, 0x6D, 0xED, 0xB2,
+    0x52, 0x33, 0xF1, 0x6E, 0x9E, 0xA6, 0x90, 0xBB, 0x84, 0xF2, 0x68, 0x32, 0xB8, 0x43, 0xFF, 0x69,
+    0xC2, 0xF9, 0x76, 0x63, 0x5F, 0x4B, 0x57, 0x87, 0x84, 0xAB, 0x25, 0xC4, 0xF0, 0x53, 0x86, 0xF6,
+    0x21, 0x4D, 0xA7, 0xEF, 0x79, 0x0E, 0x3F, 0x6F, 0x05, 0xBE, 0x4B, 0x6C, 0x3E, 0x60, 0xEF, 0xB3,
+    0x58, 0x70, 0x8B, 0x5C, 0x65, 0x73, 0xB1, 0x93, 0x0B, 0xBE, 0xA2, 0x21, 0x70, 0x5B, 0x00, 0xB8,
+    0xC3, 0xB5, 0x21, 0xDD, 0xBB, 0x18, 0xE9, 0x3C, 0x14, 0x77, 0x43, 0x8D, 0x66, 0x53, 0xF5, 0xB6,
+    0xF0, 0x62, 0x2D, 0x2F, 0xED, 0x87, 0xC1, 0xDF, 0xD2, 0xFC, 0x2D, 0x7A, 0x66, 0x3D, 0x3C, 0x76,
+    0x3C, 0x61, 0x21, 0xFB, 0x0F, 0xCF, 0x2D, 0xBF, 0xAD, 0x64, 0x84, 0x1C, 0xE3, 0x4A, 0xEA, 0xC5,
+    0xB9, 0x72, 0x91, 0x3D, 0x42, 0x0D, 0x2A, 0x6E, 0x04, 0xA8, 0xC6, 0xBA, 0x2B, 0x85, 0x83, 0x7C,
+    0xE5, 0xBC, 0x8E, 0xF5, 0xFA, 0x43, 0x6D, 0x47, 0x4D, 0x7A, 0x95, 0x2E, 0x9A, 0x05, 0x85, 0x5E,
+    0x82, 0x92, 0x35, 0xFE, 0xEB, 0x45, 0x88, 0xDD, 0x8F, 0x40, 0xD2, 0x11, 0xFF, 0xFF, 0xF9, 0x0F,
+    0xCD, 0x55, 0xC1, 0x6E, 0xE4, 0x44, 0x10, 0x2D, 0xDB, 0x9B, 0xB1, 0x14, 0x1F, 0x7A, 0x0F, 0x44,
+    0x88, 0x41, 0xA2, 0xAF, 0x28, 0x48, 0xF8, 0x07, 0xD8, 0x6D, 0x2F, 0x39, 0x70, 0xE0, 0xB0, 0x39,
+    0x30, 0x7F, 0xC0, 0x61, 0x35, 0x17, 0xFE, 0x20, 0x36, 0x9B, 0x03, 0x12, 0x5C, 0x86, 0x2F, 0xC8,
+    0x1E, 0x38, 0x24, 0x83, 0x44, 0x7E, 0x60, 0x37, 0xED, 0x24, 0x87, 0x1C, 0xB8, 0xB4, 0x14, 0x6E,
+    0x5C, 0x2C, 0x40, 0xE2, 0xB8, 0x2D, 0x61, 0xAD, 0xAC, 0x6C, 0xDB, 0x45, 0x55, 0x79, 0x8C, 0x26,
+    0x88, 0x0F, 0xC0, 0xB2, 0x5B, 0xF6, 0x74, 0x57, 0xD5, 0xAB, 0x57, 0xF5, 0x6A, 0x00, 0xA2, 0x75,
+    0x05, 0x00, 0x1A, 0x0B, 0x80, 0x08, 0x91, 0x5F, 0xDF, 0x0C, 0xFC, 0x9A, 0x04, 0x7A, 0x75, 0x71,
+    0x07, 0xDB, 0x97, 0x69, 0xC0, 0x36, 0x80, 0x55, 0x82, 0x40, 0x77, 0xDE, 0x81, 0x0A, 0x80, 0x35,
+    0xE4, 0x3E, 0x23, 0x9B, 0xB2, 0x36, 0x9E, 0x0C, 0x63, 0x72, 0x95, 0xF4, 0xB4, 0x01, 0xAA, 0xB5,
+    0x8E, 0x6C, 0x6E, 0xD9, 0x2B, 0x9E, 0xB4, 0x00, 0xF1, 0x60, 0x6B, 0x80, 0xF4, 0x6D, 0x2F, 0x11,
+    0x1B, 0x76, 0xC8, 0x7B, 0x80, 0x1C, 0x25, 0x21, 0x47, 0x00, 0xEC, 0x88, 0x7E, 0xF6, 0xB4, 0xC4,
+    0x28, 0xC8, 0xC8, 0x11, 0x79, 0x25, 0x47, 0x29, 0x0E, 0x62, 0xC7, 0x7B, 0xA5, 0x1C, 0x93, 0x03,
+    0x9B, 0xEB, 0x22, 0xF5, 0x90, 0x04, 0xE3, 0x40, 0x7B, 0x02, 0x60, 0x8E, 0xC9, 0xEC, 0x61, 0xB4,
+    0x05, 0x9D, 0x22, 0xE7, 0x6F, 0xB0, 0x88, 0xF1, 0x66, 0x00, 0xC5, 0xF0, 0xB0, 0x31, 0x3E, 0x45,
+    0xB0, 0xCE, 0xF8, 0x08, 0x3F, 0xA5, 0x9C, 0x06, 0x0A, 0xA5, 0x02, 0xA7, 0xC3, 0x00, 0x4B, 0x8E,
+    0xC3, 0x84, 0x24, 0x48, 0xC8, 0x33, 0x06, 0x27, 0x50, 0xCA, 0x86, 0xE1, 0x10, 0x5B, 0x59, 0x98,
+    0x80, 0xF2, 0x5E, 0xCA, 0x80, 0xF2, 0x76, 0x0C, 0xC4, 0xE4, 0xC8, 0x35, 0x3B, 0x03, 0xC6, 0x0D,
+    0x9B, 0x5F, 0x62, 0x94, 0x5C, 0x78, 0x67, 0xB8, 0xC7, 0x6B, 0x8E, 0x88, 0x85, 0xA2, 0xC5, 0x25,
+    0xB4, 0x10, 0x1E, 0xC4, 0x00, 0x7B, 0x8B, 0x92, 0x43, 0xE4, 0xC2, 0x16, 0x9F, 0x57, 0xB2, 0xB0,
+    0x79, 0x86, 0xE2, 0xB7, 0x60, 0xBF, 0xD5, 0x86, 0x3A, 0x59, 0x62, 0x26, 0x2A, 0x12, 0x6A, 0xC7,
+    0x85, 0xF1, 0x59, 0x61, 0xAC, 0x13, 0xBA, 0x11, 0x2B, 0x0E, 0xE6, 0x32, 0x5A, 0xDA, 0x44, 0xE2,
+    0xD0, 0xB5, 0x5E, 0x51, 0x9C, 0xB0, 0x81, 0xCA, 0x1E, 0x73, 0x32, 0x4E, 0xDB, 0x2D, 0x84, 0x25,
+    0x62, 0x4D, 0x36, 0x1D, 0x30, 0xD2, 0xDD, 0x35, 0xFB, 0xD5, 0x61, 0x83, 0x81, 0x63, 0x9A, 0x6E,
+    0x44, 0x15, 0x33, 0x8A, 0x92, 0x76, 0x55, 0xCF, 0x90, 0x8A, 0x11, 0x07, 0x85, 0xF4, 0x1C, 0x8C,
+    0xDD, 0x34, 0x29, 0x4A, 0x21, 0xE1, 0x1D, 0xA9, 0xB4, 0xE3, 0x14, 0xBB, 0xA9, 0xF2, 0xC2, 0x10,
+    0xBC, 0xF7, 0x7F, 0x22, 0x27, 0x22, 0x47, 0x69, 0x98, 0x92, 0xA9, 0xC7, 0x9A, 0x47, 0xAB, 0xFB,
+    0xD4, 0x90, 0x59, 0x43, 0x10, 0xDB, 0x78, 0x6D, 0xC3, 0xC8, 0x8C, 0xEE, 0x47, 0x0E, 0x18, 0x17,
+    0x23, 0xE2, 0x27, 0xC5, 0xD1, 0xCD, 0xF8, 0x54, 0x04, 0x88, 0x28, 0xA1, 0xA7, 0x66, 0x5A, 0x34,
+    0x8A, 0x0C, 0xCE, 0x60, 0x5E, 0x41, 0xD6, 0x66, 0x44, 0xBE, 0xB9, 0xEE, 0x45, 0x94, 0x05, 0x27,
+    0xE6, 0x26, 0x98, 0xFF, 0x22, 0x86, 0x61, 0xB6, 0x82, 0x9D, 0xDC, 0x13, 0x3D, 0x13, 0x33, 0xD9,
+    0xA8, 0x68, 0x11, 0x59, 0x37, 0x51, 0x23, 0xD5, 0x81, 0xB2, 0x9D, 0xF8, 0x1A, 0x35, 0x27, 0x3C,
+    0x08, 0x93, 0xA9, 0x28, 0x6A, 0x34, 0x0A, 0x13, 0x95, 0x1B, 0x27, 0xCC, 0x8E, 0x10, 0x03, 0x76,
+    0x2A, 0x08, 0xD9, 0xCD, 0xAB, 0xE8, 0x07, 0x30, 0x75, 0x59, 0x43, 0xF9, 0x4D, 0x60, 0xC1, 0xD4,
+    0x74, 0x3E, 0x4C, 0x91, 0xB6, 0x29, 0x8A, 0xB9, 0xEC, 0xCC, 0x11, 0xEC, 0xFF, 0x38, 0xA9, 0x49,
+    0x74, 0xCD, 0x2C, 0x49, 0x4C, 0x89, 0xC6, 0xF5, 0x90, 0x36, 0x34, 0xED, 0x86, 0x73, 0x86, 0x2F,
+    0x4C, 0x29, 0x2E, 0x08, 0x53, 0xC5, 0x2D, 0x20, 0xD2, 0xDF, 0x39, 0x64, 0x53, 0xE9, 0x34, 0x9E,
+    0x37, 0xBC, 0xE8, 0xE1, 0xCB, 0x8D, 0x10, 0x45, 0x9B, 0xA6, 0xD9, 0x68, 0x16, 0x78, 0x16, 0xC1,
+    0x98, 0x6F, 0xBD, 0xE9, 0x72, 0xD1, 0x71, 0x3C, 0x76, 0xCA, 0xA4, 0x51, 0x11, 0x72, 0xCA, 0x90,
+    0x44, 0xE0, 0xEA, 0x9F, 0x45, 0x77, 0x70, 0xCF, 0xF1, 0x7D, 0xEF, 0x9C, 0x88, 0xE4, 0x2C, 0xC8,
+    0x64, 0x90, 0x4A, 0xF7, 0x58, 0xDE, 0x5C, 0x56, 0x25, 0x0D, 0x1B, 0xD5, 0xD2, 0x4C, 0x0D, 0xB0,
+    0xAE, 0x4C, 0x47, 0x41, 0xB0, 0x32, 0x2E, 0x65, 0x02, 0x4F, 0x29, 0x5D, 0xCE, 0x08, 0xCA, 0x5F,
+    0x3B, 0xED, 0xF3, 0xDB, 0x0E, 0x2E, 0xC8, 0xE4, 0x50, 0xB7, 0xEA, 0x12, 0x87, 0x81, 0x72, 0xF6,
+    0x47, 0x1A, 0x9F, 0xF8, 0x59, 0x43, 0x95, 0x5D, 0x20, 0xBE, 0x45, 0x3C, 0xE7, 0x8C, 0xB9, 0x31,
+    0xF0, 0x86, 0x1E, 0xEA, 0x82, 0xB0, 0x58, 0x2C, 0x8A, 0x67, 0xB0, 0x9F, 0x57, 0xFA, 0xE7, 0x3B,
+    0xEB, 0xC8, 0x84, 0xA7, 0xEB, 0x4F, 0x2B, 0xD8, 0x49, 0x7A, 0xFB, 0x7A, 0xB0, 0x97, 0xDC, 0xAD,
+    0xF9, 0x93, 0xAE, 0xBC, 0x0E, 0xF6, 0x26, 0x94, 0x07, 0xDD, 0x03, 0x28, 0x96, 0x15, 0xB6, 0x18,
+    0x0E, 0x42, 0x1C, 0xDE, 0x6F, 0x8D, 0x33, 0x9C, 0xEF, 0x1F, 0x0A, 0xBF, 0xFB, 0xF3, 0x2F, 0xFF,
+    0x28, 0xE8, 0xAF, 0xCE, 0xAF, 0xD1, 0xE5, 0x2B, 0x58, 0x3E, 0x3F, 0x8B, 0xF0, 0xF3, 0x90, 0xF4,
+    0x9A, 0xD0, 0x9B, 0x3A, 0xAF, 0x07, 0x38, 0x8A, 0xA8, 0x80, 0xC5, 0xEC, 0x85, 0x05, 0x5B, 0xA0,
+    0x6A, 0x23, 0x69, 0xC1, 0x56, 0xF4, 0x36, 0x5B, 0xF5, 0xEA, 0x32, 0xE4, 0x57, 0x9D, 0x39, 0xF0,
+    0xE5, 0xCE, 0xE1, 0x6E, 0x75, 0xAA, 0xAE, 0x82, 0xBE, 0xEA, 0xF2, 0xE3, 0xD6, 0x1C, 0x7B, 0xF3,
+    0x19, 0x33, 0xB6, 0xFF, 0xFD, 0x3A, 0x46, 0xF6, 0x66, 0x0B, 0x9A, 0xD1, 0x51, 0x50, 0x2E, 0x75,
+    0x8F, 0x79, 0x14, 0x58, 0x22, 0xAC, 0x78, 0x86, 0xF3, 0x97, 0x1F, 0x3E, 0x3E, 0x82, 0x60, 0xB0,
+    0x53, 0xC4, 0xCA, 0x45, 0x01, 0xF3, 0x15, 0x88, 0x48, 0xBC, 0xC5, 0x60, 0x0A, 0xF3, 0xB4, 0x4A,
+    0x1D, 0x9D, 0x35, 0xB5, 0x71, 0xE4, 0xA5, 0x4B, 0x43, 0x82, 0x54, 0xC5, 0xBD, 0x82, 0x27, 0x07,
+    0xE9, 0xC8, 0x31, 0xCD, 0x59, 0x97, 0x84, 0x68, 0x80, 0x05, 0x79, 0x2C, 0x5F, 0xDF, 0x0D, 0xF6,
+    0xE4, 0xF7, 0x6E, 0xD8, 0xFB, 0xEF, 0x03, 0xCB, 0x95, 0xF1, 0xDA, 0xF3, 0x37, 0xBC, 0xA2, 0x0F,
+    0x4D, 0xEE, 0x68, 0x80, 0x6B, 0x9F, 0x70, 0xB1, 0x23, 0x9F, 0x9D, 0xF4, 0xD6, 0xA7, 0xF5, 0x07,
+    0xF0, 0x90, 0x9A, 0x00, 0x34, 0x89, 0x3A, 0x0F, 0x8F, 0xE0, 0x13, 0xC2, 0xBB, 0xB3, 0xF8, 0x02,
+    0xF1, 0xB7, 0xF5, 0x79, 0x41, 0x5F, 0xE0, 0x21, 0xAD, 0xE1, 0x63, 0x80, 0x16, 0x92, 0x1A, 0x76,
+    0xB9, 0xDE, 0x2A, 0x44, 0x54, 0x60, 0xAF, 0xFB, 0x0C, 0x2B, 0xEB, 0xD4, 0x38, 0x2D, 0x8A, 0x60,
+    0x6E, 0xDC, 0xCB, 0xAC, 0x36, 0x11, 0x37, 0xC5, 0x61, 0xD4, 0xC4, 0x4D, 0xE2, 0xCA, 0xDE, 0xF6,
+    0x7B, 0x0B, 0x85, 0x57, 0xF6, 0x85, 0x2A, 0xC8, 0x9C, 0x49, 0x02, 0x1F, 0xF9, 0x8F, 0xEE, 0xCC,
+    0xF0, 0xEE, 0x2F, 0x69, 0x3D, 0x2B, 0x58, 0x3E, 0x76, 0x80, 0x65, 0x91, 0x37, 0xDC, 0x42, 0xF4,
+    0xFF, 0x61, 0xBF, 0xB5, 0xB7, 0xE8, 0xD1, 0xD3, 0x94, 0x9E, 0xAF, 0xA8, 0x78, 0x35, 0x0B, 0xD0,
+    0xD6, 0xE5, 0x60, 0x06, 0x3D, 0xC4, 0xA7, 0x99, 0xC3, 0x5B, 0x7C, 0x1A, 0xB4, 0x93, 0xA8, 0xFA,
+    0xEB, 0x40, 0x83, 0x84, 0xEF, 0xE7, 0xE1, 0x01, 0x27, 0xB2, 0x7D, 0xFD, 0x0D, 0xBD, 0x55, 0x3D,
+    0x6C, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0x9B, 0xF3, 0x06, 0xAF, 0xE2, 0x49, 0x61, 0x4B, 0x10, 0x64,
+    0xAF, 0x0B, 0x1A, 0x2C, 0xE1, 0x6D, 0x28, 0x52, 0xF8, 0x6E, 0x36, 0x4E, 0x41, 0x61, 0x89, 0x1C,
+    0xC2, 0x57, 0x83, 0xA0, 0x21, 0x01, 0x29, 0x14, 0x14, 0x46, 0x9C, 0xB3, 0x97, 0xA4, 0x48, 0x61,
+    0x09, 0x4E, 0x0A, 0xF4, 0x2E, 0x22, 0x21, 0x36, 0x85, 0x0D, 0xB2, 0xC4, 0x15, 0xF6, 0xED, 0xD8,
+    0x27, 0x14, 0xA1, 0x14, 0x59, 0x62, 0x21, 0x24, 0x28, 0x58, 0x0C, 0x22, 0x88, 0x44, 0x78, 0x42,
+    0x26, 0xB0, 0x89, 0x77, 0xF7, 0xF1, 0x66, 0xD7, 0x0E, 0x29, 0x22, 0xD1, 0x31, 0xBA, 0x7B, 0x7B,
+    0xB7, 0xF3, 0xE6, 0xFD, 0x7C, 0xEF, 0x7D, 0x6F, 0x9C, 0x5F, 0x18, 0xCE, 0xDD, 0xBA, 0x97, 0x2C,
+    0xA6, 0xEE, 0xD9, 0x95, 0x01, 0xC6, 0x5E, 0x97, 0xA5, 0xD1, 0x20, 0x77, 0x93, 0xC2, 0x68, 0x82,
+    0x99, 0x42, 0x01, 0x81, 0x34, 0x73, 0x88, 0x4E, 0xE1, 0x00, 0x13, 0xEC, 0xDA, 0x2A, 0xB0, 0x25,
+    0x17, 0x68, 0xE1, 0x0F, 0x38, 0x97, 0x01, 0x98, 0xCB, 0xAE, 0xE8, 0x5B, 0x8A, 0x89, 0xC0, 0xCC,
+    0x58, 0xC2, 0xFD, 0x79, 0xA8, 0xB5, 0x5A, 0xAF, 0x20, 0x16, 0x5E, 0x78, 0xF5, 0x66, 0x02, 0x33,
+    0x75, 0xB0, 0x07, 0x02, 0x7A, 0xA3, 0x60, 0xC0, 0xEA, 0x11, 0xEB, 0x0E, 0xBB, 0x70, 0x0B, 0x51,
+    0x9E, 0x9B, 0x4B, 0x4E, 0xC3, 0xF0, 0xE5, 0xD4, 0xCE, 0xBC, 0x1D, 0x04, 0x44, 0x61, 0xA3, 0x04,
+    0x4E, 0xD6, 0xA6, 0xAE, 0x00, 0x43, 0x61, 0x62, 0x01, 0xD1, 0x0D, 0xC5, 0x13, 0x7E, 0x5D, 0x41,
+    0x3E, 0x05, 0xC3, 0xA7, 0x04, 0xDB, 0x2E, 0x56, 0x64, 0x84, 0xCA, 0x41, 0x05, 0x67, 0xBB, 0x00,
+    0x67, 0x7C, 0x03, 0x0B, 0x03, 0x31, 0xC6, 0xDD, 0x2C, 0x80, 0xC0, 0xF5, 0x1D, 0x01, 0x00, 0x4D,
+    0x57, 0xB1, 0x4D, 0x2C, 0x0A, 0xA6, 0x7D, 0xB8, 0x78, 0x42, 0x0E, 0x25, 0x30, 0xD6, 0x9A, 0xE7,
+    0x98, 0x73, 0xCC, 0xCA, 0x0F, 0x22, 0xED, 0xE1, 0x66, 0xAB, 0xD5, 0xF2, 0x29, 0xCE, 0x79, 0x17,
+    0x31, 0xF3, 0x10, 0x53, 0xD8, 0x5F, 0x53, 0x61, 0xB8, 0x1C, 0xD0, 0xE1, 0x33, 0x61, 0x48, 0x4E,
+    0xC0, 0x8F, 0xE2, 0x86, 0x87, 0x2B, 0xDB, 0xA4, 0xB5, 0xE1, 0xA2, 0xD3, 0x79, 0xB6, 0xA3, 0x95,
+    0xC8, 0xC0, 0x77, 0xF4, 0xD5, 0x67, 0xC7, 0x5A, 0xAD, 0x66, 0x75, 0xD2, 0x44, 0xBD, 0x4A, 0x0F,
+    0x48, 0x48, 0xE9, 0xF5, 0xC8, 0x2A, 0x3C, 0x07, 0x46, 0x06, 0x8C, 0x92, 0xCA, 0x6C, 0x8C, 0x39,
+    0x3D, 0x13, 0xE0, 0x3E, 0x3C, 0x5D, 0x6D, 0xCE, 0xD3, 0x97, 0xB6, 0x01, 0x2C, 0x45, 0xC2, 0x96,
+    0x24, 0x98, 0x4E, 0xC6, 0xD3, 0xCE, 0xB8, 0xD6, 0xE8, 0xFF, 0x2F, 0x1A, 0x00, 0x54, 0xC5, 0x45,
+    0x2B, 0x5E, 0xE4, 0xD7, 0xE4, 0x51, 0xA8, 0x11, 0x9A, 0x12, 0x26, 0x5C, 0x30, 0x77, 0x12, 0xA8,
+    0xF3, 0xF0, 0xEA, 0xA0, 0x4A, 0x17, 0x2A, 0x04, 0x0A, 0x16, 0x5E, 0x8D, 0xA9, 0xBC, 0xE3, 0x60,
+    0x6D, 0xC5, 0xB0, 0x40, 0x69, 0xCF, 0x12, 0x74, 0xB6, 0xEA, 0x3B, 0xBB, 0x7B, 0xB7, 0xCE, 0xCB,
+    0x86, 0x78, 0x71, 0xE4, 0xF0, 0x61, 0xAF, 0xC1, 0x52, 0x47, 0xBA, 0x72, 0x31, 0x9B, 0x9C, 0x84,
+    0x77, 0xAC, 0xCC, 0x16, 0x4E, 0xC7, 0x16, 0x56, 0x62, 0x4A, 0x2B, 0xF1, 0xC4, 0xF3, 0xBA, 0x53,
+    0xE6, 0x23, 0xC4, 0x7B, 0x84, 0x55, 0xA7, 0x8A, 0xC0, 0x08, 0xC3, 0x70, 0x89, 0xFE, 0x1E, 0x0B,
+    0xC3, 0x2B, 0x53, 0x5D, 0x2E, 0x5D, 0xE5, 0xA4, 0x66, 0x06, 0x1B, 0x46, 0xD8, 0xE1, 0xCA, 0xC9,
+    0x0D, 0xF4, 0xB9, 0x70, 0x12, 0x78, 0x62, 0x69, 0x82, 0x4B, 0x78, 0x56, 0x06, 0x2C, 0x5E, 0xD3,
+    0x76, 0xA8, 0x89, 0x52, 0xAE, 0xF2, 0xE0, 0x5A, 0xC1, 0x6F, 0xA7, 0xD1, 0xC5, 0x3C, 0x62, 0xD4,
+    0xB4, 0x27, 0x32, 0xF0, 0x59, 0x12, 0xCC, 0xE6, 0xAC, 0xE0, 0x8A, 0x8B, 0x47, 0x0D, 0x10, 0x86,
+    0x59, 0x1D, 0xA0, 0x37, 0x43, 0x08, 0xB4, 0x01, 0x28, 0x79, 0x68, 0xFE, 0x57, 0x73, 0x1C, 0x9B,
+    0x5D, 0xCE, 0xD9, 0x40, 0x05, 0xEE, 0x56, 0x16, 0xB0, 0x9D, 0x94, 0xAA, 0x09, 0x10, 0x14, 0x98,
+    0x30, 0x7F, 0x06, 0xA4, 0x2D, 0xA8, 0xDB, 0x61, 0x5E, 0x36, 0x23, 0xB5, 0x10, 0xE0, 0x46, 0x9D,
+    0x17, 0x23, 0x13, 0xA7, 0xC1, 0xDE, 0x4F, 0xB1, 0x44, 0xDF, 0xA2, 0x52, 0x20, 0xC0, 0x30, 0x98,
+    0xB9, 0xB9, 0x8D, 0xBF, 0xDE, 0xBD, 0x8F, 0x4A, 0xDA, 0x0A, 0x9E, 0x01, 0x70, 0x63, 0x70, 0x14,
+    0x50, 0xD2, 0x70, 0x88, 0xB4, 0xDF, 0x32, 0xBA, 0x3C, 0x6F, 0x3B, 0x04, 0x90, 0xF4, 0xCA, 0xBC,
+    0x79, 0x67, 0x8D, 0xE1, 0x8A, 0xF9, 0x2B, 0xC6, 0x33, 0xA6, 0x7E, 0xE1, 0xC3, 0xEA, 0x0B, 0x25,
+    0x0F, 0x30, 0x65, 0xE7, 0x15, 0x74, 0x5F, 0xAF, 0xBC, 0xD8, 0xD0, 0x77, 0x72, 0x5B, 0x4C, 0x83,
+    0xB2, 0x44, 0x24, 0xBC, 0xD4, 0x2A, 0x88, 0xD9, 0xA9, 0xA6, 0x99, 0x2E, 0xFC, 0x81, 0x7C, 0xF5,
+    0x2B, 0x60, 0x4D, 0xF8, 0xE2, 0x43, 0xAA, 0xF6, 0x08, 0xC0, 0x2A, 0xC0, 0x53, 0x00, 0x64, 0x60,
+    0x52, 0xFF, 0x68, 0xBE, 0x0B, 0x30, 0x52, 0xDB, 0xD7, 0x24, 0x32, 0x58, 0x4C, 0xC6, 0x64, 0x77,
+    0xFF, 0xEC, 0xB2, 0xDE, 0x1D, 0x06, 0x92, 0x47, 0x0E, 0x4E, 0x55, 0x16, 0xE0, 0xF3, 0x97, 0x09,
+    0x42, 0x78, 0xF3, 0xEB, 0x7F, 0xBD, 0x68, 0x89, 0x3A, 0x06, 0xAC, 0x62, 0x00, 0xE6, 0x47, 0x7E,
+    0xDF, 0xB9, 0x9D, 0xEA, 0x4E, 0xF4, 0xD7, 0xF9, 0xB5, 0x78, 0xDD, 0x11, 0xDC, 0xD0, 0x8A, 0x63,
+    0x60, 0x63, 0xE2, 0x12, 0x8D, 0x3E, 0xC9, 0x17, 0xA1, 0xB1, 0xDE, 0x6F, 0x68, 0x90, 0xE8, 0xB3,
+    0x00, 0x87, 0x27, 0x1B, 0x19, 0x53, 0x54, 0xC5, 0x74, 0xFC, 0xB8, 0x66, 0xFA, 0xB9, 0xE0, 0x23,
+    0x41, 0x56, 0x60, 0x79, 0x12, 0x52, 0xA3, 0x80, 0x0D, 0x47, 0xE5, 0x96, 0x4F, 0x68, 0x40, 0xC3,
+    0xE7, 0x56, 0xCE, 0x84, 0xBB, 0xD4, 0x73, 0x7F, 0xBE, 0xE1, 0x9D, 0xDF, 0xF9, 0x1E, 0x56, 0x8F,
+    0x83, 0x91, 0xB8, 0x9D, 0x75, 0x5B, 0xAC, 0x07, 0x4B, 0x49, 0x13, 0x6A, 0x56, 0x1E, 0xED, 0x16,
+    0xD1, 0x66, 0xD7, 0xE8, 0xC2, 0x7B, 0xE6, 0x1F, 0x49, 0x94, 0xDA, 0xCA, 0xFA, 0x11, 0xDE, 0xD0,
+    0x35, 0xB4, 0xD3, 0xE8, 0xA5, 0xDB, 0xC5, 0x5F, 0xA2, 0xC7, 0xE4, 0xB8, 0x75, 0xC7, 0xE9, 0xFC,
+    0xBD, 0x5B, 0xA8, 0x60, 0x89, 0x02, 0x4D, 0x6C, 0xDF, 0xCB, 0x50, 0x5A, 0x9D, 0x71, 0x80, 0xD3,
+    0x3A, 0xA5, 0xE1, 0xCB, 0x3A, 0x7C, 0x2B, 0xD3, 0x65, 0x19, 0xA2, 0x21, 0xF6, 0xA0, 0xF5, 0x36,
+    0x0A, 0x4B, 0xF3, 0x3E, 0xA1, 0x24, 0xB4, 0x04, 0x23, 0xC2, 0xEE, 0x81, 0xF6, 0xA5, 0x92, 0x76,
+    0x29, 0xA7, 0xD7, 0xF6, 0xBE, 0x76, 0xA7, 0xD4, 0xA6, 0x72, 0x57, 0xDA, 0x43, 0x51, 0xD1, 0x2D,
+    0x9B, 0x2C, 0xFC, 0x94, 0x5E, 0x14, 0x44, 0x0C, 0x1A, 0xB1, 0xD4, 0x82, 0xC4, 0x85, 0xF0, 0x8A,
+    0xFE, 0xB7, 0x8D, 0xFB, 0xE3, 0x2B, 0xD3, 0xEC, 0x24, 0x0C, 0x1C, 0x2C, 0x7C, 0x70, 0x84, 0xD6,
+    0x0E, 0xF5, 0xCC, 0x43, 0x3D, 0xF6, 0x28, 0x18, 0x2C, 0x74, 0x6B, 0x0C, 0x85, 0x9A, 0x54, 0xB5,
+    0xF0, 0x63, 0xED, 0x98, 0xB6, 0x7C, 0x62, 0x05, 0x2D, 0x01, 0x1C, 0x7F, 0x8F, 0x30, 0xB6, 0x28,
+    0x36, 0xA2, 0x09, 0x8F, 0x75, 0xE7, 0x5E, 0x28, 0x9B, 0x3C, 0x80, 0xC7, 0x57, 0xD5, 0x49, 0x86,
+    0xAC, 0x0C, 0xAB, 0xA0, 0xB2, 0xDF, 0xD2, 0xAB, 0x5F, 0x6D, 0xC5, 0xE5, 0x43, 0xB7, 0xA9, 0xF9,
+    0xF0, 0xE6, 0x9E, 0x54, 0xED, 0xF6, 0xB4, 0xC7, 0xE6, 0xAE, 0x0B, 0x94, 0xB5, 0x51, 0xBD, 0x13,
+    0xF9, 0x0F, 0x64, 0xAF, 0xCD, 0x73, 0xD6, 0xB4, 0x62, 0x3F, 0x92, 0x74, 0x9F, 0xD8, 0xB3, 0x34,
+    0x33, 0x5C, 0xE7, 0x62, 0x2C, 0xDB, 0xD3, 0x46, 0x09, 0x88, 0xD7, 0xAF, 0xBB, 0x6D, 0xB7, 0x37,
+    0xDD, 0x6E, 0x73, 0x55, 0xF3, 0x27, 0xD8, 0xDC, 0xC9, 0xC1, 0xA6, 0xA4, 0x53, 0x75, 0xD7, 0xB3,
+    0xF6, 0xC4, 0x28, 0x4D, 0x57, 0x6F, 0xE7, 0xE1, 0x6B, 0xD0, 0x33, 0x13, 0x67, 0x93, 0x65, 0x35,
+    0x1F, 0x2C, 0x01, 0x6D, 0x70, 0x3A, 0x7D, 0xE5, 0x45, 0xD6, 0x37, 0xB2, 0x3D, 0x41, 0xC6, 0xDA,
+    0x6D, 0x0B, 0x05, 0xB9, 0x34, 0x63, 0x50, 0x30, 0x03, 0xEE, 0x86, 0x73, 0x7B, 0xF0, 0x93, 0x94,
+    0x14, 0xCE, 0x34, 0x3B, 0x75, 0x72, 0xD3, 0x2F, 0x47, 0xF4, 0x97, 0x7F, 0xA6, 0x6C, 0x77, 0x4F,
+    0xA8, 0xF5, 0x19, 0x97, 0x9D, 0xDC, 0x4A, 0x24, 0x79, 0x70, 0x2E, 0x6E, 0x25, 0x6A, 0xF4, 0x90,
+    0x06, 0xB3, 0x7E, 0x17, 0x97, 0x44, 0x03, 0xA4, 0x25, 0x5C, 0x38, 0x0A, 0x86, 0x3F, 0x62, 0xE2,
+    0xDC, 0x6F, 0x2E, 0x2C, 0x98, 0x31, 0xA3, 0x91, 0x33, 0x06, 0x6B, 0xD3, 0x6B, 0x33, 0x3D, 0xF5,
+    0xBE, 0xFC, 0x40, 0xF0, 0x0E, 0x87, 0x51, 0xBA, 0xD4, 0x92, 0x7A, 0x6A, 0x16, 0x34, 0x43, 0x89,
+    0xC9, 0x7B, 0xB1, 0xE7, 0x1A, 0xDA, 0xCB, 0x94, 0xBE, 0x34, 0x78, 0x39, 0x5B, 0xCB, 0x72, 0xEB,
+    0x79, 0xAB, 0x99, 0x0C, 0xB0, 0xF1, 0x38, 0xB2, 0x7A, 0xB0, 0x80, 0xA7, 0x05, 0xD7, 0xE3, 0x85,
+    0x84, 0x02, 0x7E, 0x9F, 0x6E, 0x92, 0x40, 0x33, 0x3A, 0xD2, 0xB0, 0xA2, 0x78, 0x24, 0xBE, 0x6D,
+    0x95, 0x85, 0xF3, 0xF5, 0x0D, 0x03, 0x56, 0x25, 0xC2, 0xCF, 0xC0, 0x2E, 0x68, 0xD3, 0x29, 0x45,
+    0xAE, 0x1D, 0x66, 0x07, 0xC2, 0xD5, 0xC2, 0xDB, 0x37, 0x7C, 0x60, 0x1D, 0x2B, 0xE6, 0x3F, 0x61,
+    0xFD, 0x03, 0xB5, 0x55, 0x3D, 0x6E, 0xD6, 0x40, 0x10, 0x9D, 0xEF, 0xB3, 0x94, 0x95, 0x70, 0xE1,
+    0x86, 0x34, 0x20, 0xB1, 0x47, 0xF0, 0x11, 0xD6, 0x9C, 0x80, 0x14, 0x04, 0x89, 0x2A, 0xE7, 0xA0,
+    0xB2, 0x25, 0x2E, 0xC0, 0x0D, 0x68, 0x52, 0x40, 0x38, 0x03, 0xF2, 0x8A, 0x13, 0x7C, 0x0D, 0x15,
+    0x8D, 0x6F, 0x80, 0x0B, 0x23, 0x1C, 0x61, 0x7B, 0x78, 0x6F, 0xD6, 0xFE, 0xC2, 0x47, 0xD2, 0x21,
+    0xAC, 0x68, 0x12, 0x7B, 0x67, 0xE7, 0xE7, 0xBD, 0x37, 0x13, 0x11, 0x7B, 0x3E, 0xBB, 0x83, 0x88,
+    0x16, 0xBD, 0xEC, 0xD4, 0xC3, 0xCC, 0xBE, 0x13, 0xB9, 0x3E, 0x6B, 0xE4, 0xEE, 0xF1, 0xAA, 0x93,
+    0x94, 0x34, 0x41, 0x75, 0xA4, 0x19, 0x24, 0xFC, 0xB8, 0xBC, 0x90, 0x1A, 0xAE, 0xD2, 0xE2, 0xBA,
+    0x68, 0x3C, 0x9A, 0xAF, 0x97, 0x88, 0xA4, 0x5A, 0xED, 0x61, 0x24, 0x4B, 0xE6, 0xE6, 0xA3, 0xB8,
+    0x05, 0x87, 0xB9, 0x99, 0x19, 0xA6, 0x98, 0x36, 0xE3, 0x69, 0xCA, 0x35, 0xF0, 0x16, 0x5D, 0xB5,
+    0x67, 0x5A, 0x1D, 0x73, 0x98, 0x85, 0x51, 0xB4, 0xA2, 0x89, 0xE7, 0x57, 0x0B, 0x12, 0x67, 0x2A,
+    0x5B, 0x3E, 0xAB, 0xC1, 0x8F, 0x16, 0xF7, 0x75, 0xC5, 0x84, 0xC8, 0x01, 0xCF, 0x4E, 0x6A, 0xD5,
+    0x59, 0xCA, 0xE5, 0x93, 0xC6, 0x7C, 0x92, 0xBA, 0xC7, 0x1D, 0xE4, 0xD3, 0x98, 0x69, 0x85, 0x3B,
+    0x1A, 0xCB, 0x01, 0x1F, 0xF1, 0x25, 0x8C, 0x99, 0x16, 0xE8, 0x4D, 0xDF, 0xE2, 0x66, 0xDD, 0xC1,
+    0x94, 0x43, 0x60, 0x89, 0x72, 0x61, 0xDD, 0x3F, 0xFA, 0xC0, 0xFA, 0xC6, 0x2D, 0x95, 0x56, 0x22,
+    0x19, 0x8F, 0xDD, 0xF0, 0x07, 0x44, 0x52, 0x10, 0x9E, 0x0D, 0xA8, 0x3F, 0x31, 0x0A, 0xBC, 0x54,
+    0x1F, 0xEE, 0x01, 0xB5, 0xD3, 0x86, 0x06, 0xD1, 0xF6, 0x6C, 0x26, 0x3B, 0x1A, 0xF7, 0x00, 0x46,
+    0xC5, 0xB8, 0x35, 0x59, 0x32, 0x6B, 0xE8, 0x37, 0xB3, 0x3E, 0xB9, 0xDE, 0x1A, 0x86, 0x86, 0x9C,
+    0xD1, 0xB4, 0xC0, 0x54, 0xA5, 0x78, 0x04, 0xAB, 0x0A, 0x8B, 0x98, 0x12, 0x54, 0x5B, 0x0D, 0x2D,
+    0xBD, 0x8D, 0xD4, 0x62, 0x23, 0xAA, 0x49, 0x27, 0x16, 0xD8, 0xD2, 0x66, 0xAC, 0x51, 0x5A, 0x7B,
+    0xD7, 0x2A, 0x17, 0x52, 0x1A, 0x13, 0x39, 0x19, 0x6F, 0xA2, 0x61, 0xE4, 0x95, 0xF3, 0x6A, 0xAB,
+    0xE3, 0x8C, 0xEF, 0x0C, 0x57, 0x10, 0x04, 0xA4, 0x00, 0xDA, 0xCD, 0xB3, 0x44, 0x71, 0xDB, 0xB1,
+    0x55, 0x04, 0x74, 0x9A, 0xE2, 0xB1, 0x62, 0xBC, 0x06, 0x26, 0x35, 0x63, 0xAF, 0x9E, 0xA7, 0x9E,
+    0xED, 0x87, 0x61, 0x05, 0x0D, 0x55, 0xBF, 0x91, 0x72, 0xA2, 0xAA, 0x3A, 0xC7, 0xE8, 0x9E, 0xF4,
+    0x3E, 0xB5, 0xDC, 0x2F, 0x25, 0x21, 0xD3, 0x1E, 0xE0, 0x45, 0x36, 0x7B, 0x00, 0x0B, 0xF4, 0xD0,
+    0x04, 0x93, 0x6F, 0x47, 0xEC, 0xA7, 0xEE, 0xF6, 0x77, 0x47, 0x8E, 0x34, 0x8B, 0xAE, 0x47, 0x69,
+    0x10, 0x7C, 0xE3, 0x26, 0x95, 0xF2, 0x27, 0x5C, 0x5F, 0x74, 0x72, 0xFD, 0xE4, 0x8E, 0xDC, 0xD1,
+    0x28, 0xDC, 0xA3, 0x66, 0x3A, 0x87, 0xDE, 0xD8, 0x23, 0x47, 0xC4, 0x0A, 0xA5, 0x93, 0x38, 0xD2,
+    0x83, 0x6A, 0xF9, 0xA7, 0x39, 0x75, 0x7F, 0x3B, 0x91, 0x58, 0xD2, 0xD7, 0xC6, 0xA3, 0x93, 0xD8,
+    0x9B, 0xFD, 0x69, 0x7A, 0xA0, 0xCC, 0x98, 0xC5, 0xAE, 0x98, 0x1A, 0xA8, 0x39, 0x13, 0x83, 0x1E,
+    0xD6, 0x2B, 0x44, 0xCA, 0xDF, 0xF7, 0xEB, 0xD7, 0xE9, 0x6A, 0x1F, 0xF6, 0x1B, 0x56, 0x3F, 0x00,
+    0xF7, 0xB8, 0x9E, 0xC1, 0x01, 0x8E, 0x6B, 0xF0, 0xE8, 0x48, 0x63, 0xB8, 0x3D, 0xB6, 0x4A, 0x7C,
+    0x0F, 0x92, 0xF4, 0x31, 0xAD, 0xC2, 0x36, 0x55, 0x90, 0x56, 0xFB, 0xE0, 0x6F, 0x5F, 0x99, 0x2C,
+    0x20, 0x5B, 0x13, 0x23, 0x6A, 0x48, 0xE3, 0x88, 0xFE, 0x92, 0x26, 0x8D, 0x8B, 0xA4, 0xA1, 0x5A,
+    0x47, 0x2B, 0x25, 0xA7, 0x1E, 0x58, 0x8E, 0x4D, 0x26, 0x4A, 0x32, 0xD1, 0x25, 0xB6, 0xEA, 0x51,
+    0x32, 0xB2, 0xB1, 0x67, 0x49, 0x07, 0x84, 0x85, 0x5C, 0x36, 0x26, 0x13, 0x89, 0x80, 0x25, 0x8C,
+    0x80, 0xC2, 0xE9, 0xEE, 0x4A, 0x01, 0xC7, 0x99, 0xF6, 0x35, 0xC2, 0xB0, 0x22, 0xB7, 0x0A, 0xB8,
+    0xAA, 0xD5, 0x4A, 0x8C, 0x0E, 0x97, 0xBC, 0xEA, 0xC9, 0xFE, 0x1A, 0xD3, 0xEC, 0x00, 0x9A, 0x55,
+    0x4E, 0x56, 0x5F, 0x31, 0x25, 0xA0, 0x50, 0x34, 0xEB, 0x46, 0x36, 0xE3, 0x00, 0x68, 0x1B, 0xE0,
+    0xEB, 0x67, 0xE2, 0x48, 0x00, 0x6C, 0x07, 0x2D, 0x95, 0x6D, 0x25, 0x42, 0xD4, 0xA6, 0xDF, 0xF6,
+    0x19, 0x69, 0x8B, 0xF9, 0xF2, 0x6A, 0xBE, 0x42, 0x33, 0xD8, 0x3B, 0x7D, 0xBE, 0x40, 0x69, 0xF8,
+    0xF1, 0x53, 0x0A, 0x56, 0x77, 0x16, 0x0C, 0x5F, 0x2C, 0x58, 0x31, 0x03, 0x2A, 0xF4, 0xA2, 0x7D,
+    0x69, 0x23, 0x88, 0xD5, 0x76, 0x60, 0xED, 0x43, 0x96, 0xE6, 0x90, 0x3A, 0x46, 0x4F, 0xEF, 0xFE,
+    0x71, 0x03, 0xF6, 0xDC, 0x80, 0xCB, 0x83, 0x1B, 0x50, 0x8E, 0x1B, 0xB0, 0xC3, 0x97, 0x72, 0x58,
+    0x4F, 0x9A, 0x93, 0x13, 0x26, 0xB8, 0x69, 0x8E, 0x6B, 0xC0, 0x40, 0x11, 0x9F, 0x28, 0x37, 0x89,
+    0xD4, 0x72, 0xFA, 0x60, 0x4C, 0x40, 0x1D, 0x3C, 0xA0, 0x36, 0x0E, 0x57, 0x67, 0x3D, 0x63, 0x61,
+    0xF4, 0x1C, 0x79, 0xA4, 0x9A, 0xC9, 0x41, 0xB0, 0x11, 0xE0, 0x36, 0xD0, 0x2F, 0xAC, 0x5F, 0xBF,
+    0x29, 0xC1, 0xC7, 0xAE, 0xE6, 0x7E, 0x19, 0x0D, 0x69, 0xB3, 0x2D, 0xC8, 0xC9, 0x16, 0x5E, 0x72,
+    0x0B, 0xA5, 0x9D, 0xCF, 0x69, 0x6C, 0x32, 0x1B, 0x43, 0x06, 0xA6, 0x9E, 0x22, 0x13, 0x22, 0x95,
+    0xAD, 0x73, 0x23, 0x6D, 0x30, 0x4B, 0x3C, 0xF6, 0x37, 0x22, 0xEB, 0x00, 0x20, 0xA7, 0x49, 0x22,
+    0x98, 0x96, 0x0B, 0x6B, 0xCE, 0x75, 0xA7, 0xF5, 0xE3, 0xDF, 0x5F, 0x09, 0xBC, 0x70, 0xD9, 0x94,
+    0x8C, 0x8A, 0x02, 0x56, 0x06, 0x94, 0x08, 0x96, 0x81, 0x5F, 0x2C, 0xB8, 0xD3, 0xA2, 0xC7, 0xDE,
+    0xD4, 0x18, 0xBE, 0xC3, 0x36, 0xED, 0x7B, 0xB8, 0x3D, 0xD7, 0x12, 0x52, 0xCD, 0x66, 0x3A, 0xE7,
+    0x13, 0x9C, 0x17, 0xDF, 0xD7, 0x91, 0xEF, 0x6D, 0x74, 0x53, 0x1B, 0x81, 0xFE, 0xAC, 0x70, 0xCE,
+    0x7F, 0x2D, 0x3B, 0x0A, 0x1F, 0x8B, 0x0C, 0xF4, 0x0E, 0x14, 0xBA, 0x76, 0x54, 0x3E, 0x18, 0xB1,
+    0x75, 0xED, 0x90, 0x10, 0xF2, 0x46, 0xC2, 0xE9, 0xB8, 0x94, 0xFE, 0xE3, 0xF3, 0x1B, 0xCD, 0x55,
+    0x31, 0x72, 0xD5, 0x40, 0x0C, 0xD5, 0xFF, 0x1E, 0xC6, 0x85, 0x0B, 0x57, 0x54, 0x14, 0xEE, 0x69,
+    0x7C, 0x84, 0x35, 0x27, 0x80, 0x26, 0x69, 0x28, 0xD2, 0x70, 0x09, 0x2A, 0xFF, 0x81, 0x92, 0x86,
+    0x1B, 0x50, 0xC3, 0x25, 0x76, 0x21, 0x17, 0x70, 0x43, 0x45, 0xE3, 0x19, 0xBA, 0xDF, 0x60, 0x66,
+    0x9C, 0xC1, 0x24, 0xF6, 0x8A, 0xF7, 0xB4, 0x76, 0xF2, 0x93, 0xA1, 0xA0, 0xC4, 0x93, 0x28, 0xB1,
+    0xBD, 0x92, 0x9E, 0x9E, 0x9E, 0x64, 0x11, 0xBB, 0x8A, 0x31, 0x9B, 0x45, 0xAA, 0xBE, 0x1A, 0x44,
+    0xDC, 0x51, 0x1B, 0x91, 0x56, 0x47, 0x3C, 0x6F, 0xA3, 0x9C, 0x5E, 0x99, 0x8A, 0xD4, 0x53, 0x81,
+    0xA3, 0x1A, 0xAA, 0x51, 0x8A, 0x28, 0xAE, 0x17, 0x37, 0xE0, 0x2E, 0xD3, 0x66, 0xAF, 0x52, 0xCD,
+    0x92, 0x2F, 0xA2, 0x9D, 0x94, 0x53, 0x0E, 0x4F, 0x37, 0xE0, 0x9D, 0xF8, 0xCF, 0x7A, 0x90, 0x9D,
+    0x3E, 0x87, 0x57, 0x16, 0x7D, 0x87, 0x64, 0x8A, 0x30, 0x52, 0x29, 0xDE, 0x89, 0xC3, 0x3B, 0x44,
+    0xC3, 0x3B, 0xD9, 0xC3, 0x8F, 0x2F, 0x99, 0xA8, 0x1D, 0xED, 0x5F, 0xBC, 0xF3, 0x7C, 0xB7, 0x57,
+    0x0D, 0xBC, 0x9F, 0xCD, 0x8F, 0x1E, 0xBB, 0xC6, 0x00, 0x55, 0x13, 0x52, 0x09, 0x82, 0xB6, 0xBD,
+    0x21, 0x68, 0xCA, 0x59, 0xCA, 0x85, 0x90, 0xDC, 0xB0, 0xC3, 0x41, 0x0D, 0xC5, 0x22, 0x80, 0x82,
+    0x07, 0xF5, 0x88, 0x3B, 0x43, 0xCA, 0x32, 0xE8, 0x38, 0x6F, 0x8E, 0xB2, 0x3A, 0xCE, 0xB8, 0xC3,
+    0xD1, 0xBD, 0x1E, 0xE0, 0x0B, 0xC7, 0xE2, 0x9E, 0x63, 0xAE, 0x82, 0x9F, 0x5A, 0x55, 0x27, 0x81,
+    0xD1, 0x2E, 0xA3, 0x6D, 0x4A, 0x18, 0x2B, 0xCD, 0xF0, 0x10, 0x37, 0xC3, 0x26, 0xAE, 0x84, 0x31,
+    0x4F, 0x2E, 0x3F, 0xB1, 0x64, 0x9E, 0xAC, 0x59, 0x50, 0x49, 0x0A, 0x8A, 0x1B, 0x7A, 0x2F, 0x4A,
+    0x0F, 0x17, 0x48, 0x14, 0x62, 0xE8, 0xE5, 0x02, 0x12, 0x3A, 0x54, 0xE0, 0x86, 0xBA, 0x47, 0xD8,
+    0x82, 0x78, 0xC1, 0x30, 0xE8, 0xF5, 0x81, 0x89, 0x51, 0x1E, 0xF3, 0x12, 0x02, 0x38, 0x02, 0x1A,
+    0x77, 0x75, 0x76, 0x31, 0x02, 0x6B, 0x16, 0x99, 0x53, 0xDF, 0x91, 0xFF, 0xEF, 0x88, 0x5A, 0x46,
+    0x44, 0x01, 0x98, 0x92, 0xC7, 0x2B, 0x9A, 0x9A, 0xC6, 0xB1, 0x0C, 0xF8, 0xBC, 0x60, 0xCD, 0x2B,
+    0x64, 0x1F, 0xD8, 0x0B, 0x33, 0xC7, 0xF7, 0x40, 0xA2, 0x91, 0xCC, 0xAB, 0xE5, 0x03, 0x4D, 0xE7,
+    0x3A, 0xA0, 0xCA, 0x76, 0xC8, 0x49, 0x70, 0x41, 0x83, 0x4C, 0x66, 0x7C, 0x5F, 0x4D, 0xB9, 0x76,
+    0x88, 0xAE, 0x07, 0x12, 0xB4, 0x46, 0x57, 0xB6, 0xAA, 0xD4, 0xEB, 0x06, 0xC4, 0xE9, 0x62, 0xB1,
+    0x3A, 0x31, 0xD8, 0xEE, 0xEA, 0xC2, 0x28, 0xD7, 0x8E, 0xCD, 0x19, 0x13, 0xFF, 0xA0, 0x18, 0x37,
+    0x57, 0x2F, 0x95, 0x30, 0x49, 0x36, 0x62, 0xD0, 0x07, 0x6D, 0x3C, 0x7A, 0x66, 0x42, 0x8B, 0xD1,
+    0xB7, 0xB6, 0x47, 0xEE, 0x6A, 0x42, 0x49, 0xE8, 0x8F, 0x29, 0xCF, 0x0D, 0x39, 0xF4, 0x48, 0x90,
+    0x05, 0x99, 0x31, 0xB8, 0xC8, 0x13, 0x1B, 0xB9, 0x5F, 0xB5, 0x41, 0x1A, 0x53, 0xD5, 0x8E, 0x55,
+    0xB7, 0xDD, 0x56, 0xBA, 0x6E, 0xA5, 0x53, 0x35, 0x30, 0x0D, 0x45, 0xB7, 0x75, 0xD1, 0x0C, 0x05,
+    0x2D, 0xC8, 0xBC, 0xF6, 0x34, 0x99, 0x29, 0x69, 0x50, 0x28, 0x12, 0xEA, 0x7D, 0x33, 0x0C, 0xC1,
+    0x7C, 0xD4, 0x3A, 0xB0, 0x30, 0x2F, 0x43, 0x26, 0xA9, 0xE4, 0xF1, 0xCC, 0xE3, 0x50, 0x6D, 0x0A,
+    0x4D, 0x12, 0xA5, 0x7C, 0xDC, 0x68, 0xFA, 0x21, 0x08, 0x53, 0xE9, 0x2A, 0x53, 0xFE, 0x12, 0xA2,
+    0xEF, 0xD6, 0x67, 0xCC, 0x4C, 0x1A, 0x06, 0x9E, 0x63, 0x08, 0xA8, 0x92, 0x21, 0xE0, 0x8F, 0xDC,
+    0x7B, 0x53, 0xBD, 0xD4, 0x0B, 0x1F, 0x53, 0x9B, 0xC8, 0xDF, 0xDA, 0x9F, 0x37, 0x66, 0x97, 0xC2,
+    0xFE, 0xD8, 0x64, 0xE2, 0x20, 0xB3, 0xE5, 0xD1, 0x6A, 0xAB, 0x46, 0x2B, 0xC2, 0x77, 0x7C, 0x96,
+    0xD4, 0x9B, 0x66, 0xEC, 0x81, 0x66, 0x6E, 0x29, 0xBC, 0x13, 0x8E, 0xDE, 0x09, 0xE7, 0xEB, 0x99,
+    0x95, 0xDE, 0xB0, 0x71, 0x92, 0x25, 0xF3, 0xE9, 0xE3, 0xCA, 0xDE, 0x5F, 0x28, 0xAC, 0x66, 0x9B,
+    0x86, 0x14, 0x78, 0x8B, 0xAE, 0x36, 0x18, 0x36, 0xDB, 0xA8, 0x0A, 0xB0, 0x1C, 0xE4, 0x87, 0x59,
+    0xE8, 0xD1, 0x98, 0x7A, 0xA6, 0x50, 0x8B, 0x79, 0x67, 0x44, 0x1D, 0xA0, 0xBF, 0xC5, 0x7A, 0xA5,
+    0x07, 0x12, 0x9D, 0xC7, 0x2C, 0xDA, 0x0A, 0x29, 0xE7, 0x6A, 0x24, 0x45, 0x28, 0xCB, 0x5F, 0x92,
+    0x7B, 0x71, 0xBF, 0xB4, 0x9D, 0x6C, 0x0A, 0x4D, 0x53, 0x62, 0xE8, 0x6C, 0x3C, 0x29, 0xD9, 0xC1,
+    0x36, 0x90, 0x46, 0x5B, 0x42, 0x55, 0x74, 0x3F, 0x53, 0x39, 0x83, 0xBE, 0xB5, 0x68, 0x9A, 0x2F,
+    0xCC, 0x23, 0x7E, 0xAC, 0x07, 0x42, 0xCE, 0x91, 0x2E, 0x90, 0xC3, 0x76, 0x06, 0x55, 0xC8, 0x9C,
+    0x69, 0x28, 0xA7, 0x3D, 0x9C, 0xDC, 0x02, 0x59, 0xD9, 0x4E, 0xE9, 0x81, 0xAA, 0x8C, 0xE0, 0x8F,
+    0x95, 0xD6, 0xDB, 0x22, 0x78, 0xA2, 0xBF, 0x8D, 0xA1, 0x20, 0x96, 0x55, 0x59, 0xF0, 0x6B, 0x31,
+    0x64, 0x76, 0xA6, 0xBA, 0xD5, 0x14, 0xC2, 0x3F, 0x3A, 0x07, 0x9E, 0x9A, 0xDA, 0xA9, 0x93, 0x8C,
+    0xF0, 0xFC, 0xA9, 0xAD, 0xCF, 0x3C, 0x2D, 0xCE, 0x70, 0x6A, 0x90, 0xFE, 0x15, 0xB7, 0x66, 0x7B,
+    0xC4, 0x91, 0x96, 0x23, 0xD7, 0x32, 0xBA, 0xF9, 0xCB, 0x63, 0x72, 0x80, 0xFD, 0x5E, 0x47, 0x28,
+    0x8F, 0x4B, 0x88, 0x7B, 0x1B, 0x43, 0x0C, 0x94, 0xE8, 0x2C, 0x10, 0x63, 0xFB, 0x85, 0x12, 0x09,
+    0x3C, 0x46, 0x89, 0x32, 0x74, 0x3F, 0x60, 0x0F, 0xFE, 0x03, 0x8E, 0x3D, 0x53, 0x8A, 0x35, 0x5B,
+    0x78, 0xB8, 0x98, 0x71, 0x38, 0x56, 0x43, 0x1B, 0x78, 0xEF, 0x43, 0x3E, 0xFB, 0x40, 0x0D, 0xB3,
+    0x03, 0xC5, 0x4D, 0xDC, 0x71, 0x23, 0xA2, 0x39, 0xA0, 0x6C, 0xE4, 0x17, 0x01, 0x8B, 0x23, 0x72,
+    0xDB, 0x51, 0xE0, 0xDA, 0x70, 0x75, 0x40, 0xAD, 0x48, 0x38, 0x9F, 0xAE, 0xC6, 0xBA, 0x2B, 0x07,
+    0x7E, 0x7E, 0x00, 0x4C, 0xCA, 0x6B, 0x6F, 0xBB, 0x9E, 0x98, 0x77, 0x3A, 0xDD, 0xFB, 0xFE, 0xFC,
+    0x77, 0xF8, 0x21, 0x50, 0xA8, 0x01, 0x53, 0x9B, 0x64, 0xAA, 0xE9, 0xF3, 0x01, 0x11, 0x60, 0x23,
+    0x41, 0x1B, 0x3D, 0x35, 0xE3, 0x3B, 0x4E, 0xB6, 0x0F, 0x1E, 0x0D, 0xD4, 0x2F, 0xA6, 0xDA, 0x6F,
+    0x6A, 0x0B, 0xC2, 0x84, 0xCB, 0x12, 0xB3, 0xD5, 0x7A, 0xFB, 0x90, 0xD0, 0x29, 0x8F, 0x1C, 0x96,
+    0x62, 0xE1, 0x1C, 0x96, 0x90, 0x58, 0x63, 0xEB, 0x3F, 0x50, 0x18, 0xB4, 0x96, 0x0A, 0x09, 0xDB,
+    0xC1, 0xBE, 0x75, 0x36, 0xF9, 0xEE, 0x01, 0x57, 0xFF, 0x74, 0xFD, 0x01, 0xBD, 0x55, 0x3B, 0x8E,
+    0xD4, 0x40, 0x10, 0x2D, 0x8F, 0x05, 0x0E, 0x1C, 0x38, 0xDA, 0xD8, 0x47, 0xE8, 0x23, 0x74, 0x4B,
+    0x1C, 0x80, 0x4D, 0x96, 0x84, 0x80, 0x9C, 0x4B, 0x78, 0x10, 0x87, 0x41, 0x22, 0xE1, 0x08, 0xF6,
+    0xC2, 0x05, 0x2C, 0x12, 0x02, 0x92, 0x09, 0x08, 0x10, 0x09, 0x16, 0xF4, 0x8A, 0x59, 0x6D, 0xBB,
+    0x8B, 0xF7, 0xAA, 0x3D, 0xBB, 0xFC, 0x36, 0xC5, 0x82, 0x1A, 0xBB, 0xBB, 0xBE, 0xAF, 0xEA, 0xD5,
+    0x8A, 0x34, 0xAA, 0x3A, 0x8B, 0x8C, 0xAA, 0xAB, 0x48, 0x87, 0x8F, 0x49, 0x2A, 0xC8, 0x24, 0xE2,
+    0xAE, 0x9F, 0xE0, 0xA3, 0x56, 0xE9, 0x8F, 0x22, 0xFE, 0xB0, 0xD3, 0x20, 0xCD, 0x2A, 0x7E, 0x81,
+    0xF2, 0x84, 0x53, 0xE9, 0x92, 0x0C, 0xF8, 0xD0, 0x7D, 0x9B, 0x45, 0xFA, 0x28, 0xE3, 0x2C, 0x3B,
+    0xE5, 0x29, 0x75, 0x60, 0xD9, 0x64, 0xB3, 0x1C, 0x67, 0x5A, 0xE2, 0xD8, 0x47, 0x78, 0xDE, 0xD3,
+    0x12, 0x6F, 0x7E, 0xA9, 0x7A, 0xA5, 0x8A, 0xD7, 0x03, 0x54, 0x6A, 0x04, 0xA4, 0x0A, 0x2E, 0x15,
+    0xCE, 0xF7, 0xE6, 0x66, 0x7B, 0x3A, 0x98, 0xB7, 0x3A, 0x55, 0x1A, 0x71, 0x99, 0xC4, 0xE1, 0xD3,
+    0x51, 0xE9, 0x28, 0xFC, 0xEF, 0xA1, 0x3C, 0x6A, 0x68, 0xF0, 0xDA, 0x41, 0x63, 0x1C, 0xF7, 0xBB,
+    0xAC, 0xD2, 0xDE, 0xC0, 0xD9, 0x57, 0xA4, 0x31, 0x4C, 0xED, 0x8F, 0x2C, 0xDD, 0xF7, 0x24, 0xEA,
+    0xE7, 0x4A, 0xFD, 0xE4, 0x3E, 0xC0, 0xC5, 0xB7, 0x54, 0x27, 0x14, 0x91, 0xDD, 0x34, 0x3E, 0x86,
+    0xE2, 0xFB, 0xD4, 0x2D, 0xC8, 0x2C, 0xB9, 0xB7, 0x6B, 0x17, 0x65, 0xB8, 0x5C, 0xFD, 0x25, 0x5C,
+    0xA4, 0xFE, 0x63, 0x74, 0x70, 0xF1, 0x22, 0x6B, 0x0D, 0x17, 0xB1, 0xD7, 0xD9, 0x1F, 0x2A, 0xAD,
+    0x34, 0x01, 0x86, 0x7E, 0x41, 0x5A, 0xC3, 0x84, 0x82, 0x75, 0x69, 0xE1, 0xE2, 0xD0, 0xAD, 0x40,
+    0xA2, 0x86, 0x98, 0xE0, 0x82, 0x85, 0xE3, 0xD4, 0xC5, 0xAD, 0x6E, 0xCA, 0x85, 0x87, 0x90, 0x38,
+    0x1C, 0x0E, 0x7C, 0x01, 0x5E, 0x05, 0xA8, 0x22, 0x71, 0xA8, 0x5F, 0x5E, 0xEB, 0x4C, 0xF4, 0x15,
+    0x8E, 0x29, 0xEB, 0x3B, 0xB9, 0x6F, 0x14, 0xF0, 0x06, 0x60, 0x0D, 0x04, 0xDB, 0x95, 0x12, 0x5E,
+    0x01, 0x20, 0x24, 0x3E, 0xE1, 0x1B, 0x19, 0xDC, 0x17, 0xF0, 0xF4, 0x8C, 0x39, 0xA0, 0xAF, 0x70,
+    0x26, 0xB5, 0x75, 0xDA, 0xD3, 0x71, 0xAD, 0x9F, 0xD0, 0x0A, 0xB7, 0x4A, 0x97, 0x05, 0xA3, 0xD0,
+    0xA7, 0x96, 0x2D, 0x5A, 0x3C, 0xE1, 0x9E, 0x6C, 0x02, 0x10, 0x05, 0x1E, 0xE9, 0xC7, 0x2F, 0x38,
+    0x10, 0x7D, 0x07, 0x8D, 0x26, 0xB3, 0x47, 0x2E, 0x72, 0x20, 0x4C, 0xAF, 0xD5, 0x1A, 0xAD, 0xF1,
+    0x11, 0xE6, 0x35, 0x50, 0x00, 0x3C, 0x2B, 0x63, 0xA1, 0xBF, 0x08, 0x03, 0x0F, 0xDE, 0x06, 0xAD,
+    0x47, 0xA3, 0xF0, 0x9C, 0x53, 0xF4, 0x36, 0x68, 0xCE, 0x24, 0x53, 0x39, 0x9A, 0xC4, 0x70, 0x5C,
+    0x5D, 0x60, 0xB2, 0x6E, 0x51, 0x22, 0x32, 0x13, 0x5F, 0x20, 0xB5, 0x48, 0x4C, 0xC3, 0x5E, 0x88,
+    0x52, 0x28, 0x23, 0x85, 0x97, 0x9A, 0x61, 0x09, 0x08, 0xF1, 0xC9, 0x98, 0x6B, 0xC2, 0x72, 0x8B,
+    0x4F, 0x67, 0xF3, 0x45, 0x94, 0xAC, 0x2D, 0x44, 0x26, 0x8A, 0x3B, 0xE1, 0x03, 0xC9, 0x32, 0x3A,
+    0xFD, 0x2C, 0x24, 0xC4, 0x22, 0x84, 0x3F, 0x88, 0xF2, 0xD5, 0x5F, 0x0D, 0x1C, 0xE4, 0x9D, 0x4E,
+    0x2D, 0xA7, 0xBF, 0x8C, 0xB8, 0x4E, 0xF0, 0xEF, 0x17, 0x4C, 0x6A, 0xB9, 0xD1, 0x37, 0x7A, 0xA8,
+    0x4D, 0xBD, 0xD8, 0xB0, 0xD4, 0xFE, 0xFA, 0x42, 0x18, 0x5A, 0x98, 0x91, 0x10, 0x24, 0x08, 0xD4,
+    0x62, 0x64, 0xF9, 0xFB, 0x66, 0x7B, 0x5A, 0xBD, 0xB6, 0x16, 0x45, 0x3A, 0x49, 0x05, 0x3A, 0xAF,
+    0xC1, 0x49, 0x0F, 0x08, 0x03, 0x5A, 0x44, 0x15, 0xB3, 0x0C, 0x27, 0xCB, 0x91, 0x3E, 0xAD, 0xCB,
+    0xC6, 0x9A, 0x5F, 0x7C, 0xB2, 0xA8, 0xD3, 0xE1, 0x9E, 0x9A, 0x4B, 0xE1, 0x53, 0x6B, 0x05, 0x5A,
+    0xFF, 0x17, 0x8E, 0x42, 0x62, 0x2F, 0x10, 0x57, 0xCE, 0x42, 0xE9, 0xCA, 0x82, 0x7D, 0x80, 0x2E,
+    0x23, 0x38, 0x57, 0x42, 0x3C, 0x7B, 0x96, 0x2F, 0x42, 0xF1, 0x46, 0xBF, 0x0D, 0x23, 0x90, 0xDB,
+    0x6C, 0x4A, 0x89, 0x67, 0x41, 0x58, 0xDC, 0x8E, 0x81, 0xAC, 0xB6, 0x3B, 0xF5, 0x7C, 0xCA, 0x4F,
+    0xFF, 0xA1, 0x1E, 0xCA, 0x91, 0x3B, 0x82, 0x30, 0x50, 0x07, 0x36, 0xE8, 0x9E, 0x3F, 0x14, 0x56,
+    0xA0, 0x4A, 0x00, 0xDE, 0x27, 0x6E, 0x1E, 0x18, 0x77, 0x47, 0xFA, 0xC2, 0x6C, 0x72, 0x09, 0x5D,
+    0x22, 0x52, 0xA5, 0xE0, 0xAF, 0xD4, 0x99, 0x79, 0xB4, 0x6A, 0x69, 0x29, 0xC3, 0x7A, 0x2B, 0x97,
+    0x75, 0x21, 0xC2, 0x7C, 0xC2, 0x4C, 0x06, 0x03, 0x9E, 0x77, 0x23, 0xEF, 0x76, 0xC4, 0x00, 0xDF,
+    0xC9, 0xEC, 0x68, 0x51, 0x05, 0xF9, 0xED, 0x69, 0xCB, 0x1A, 0xDA, 0xB6, 0x91, 0x95, 0xCC, 0x55,
+    0x19, 0x2D, 0x1A, 0x47, 0x64, 0xE0, 0xCF, 0x6C, 0x6C, 0xD5, 0xD8, 0x60, 0x43, 0xCC, 0x43, 0x42,
+    0x93, 0x86, 0xB9, 0x4B, 0xC8, 0x1A, 0xDB, 0x67, 0x45, 0xE1, 0xE3, 0xD4, 0x64, 0x96, 0xB3, 0x6F,
+    0x56, 0xFE, 0x84, 0x16, 0x3F, 0x15, 0xE7, 0xC8, 0x47, 0xAB, 0xCE, 0x25, 0x20, 0x30, 0xC4, 0x4E,
+    0x1F, 0xE5, 0x87, 0x58, 0x27, 0x7A, 0xB7, 0x01, 0xD4, 0xC2, 0x31, 0x1E, 0xC6, 0x92, 0xE4, 0x05,
+    0x04, 0x25, 0x95, 0x42, 0xEA, 0x7E, 0xB1, 0x9F, 0x07, 0xE7, 0x5B, 0x7A, 0xF5, 0xC6, 0x03, 0xD0,
+    0x05, 0xAB, 0x6A, 0x22, 0x72, 0x28, 0x1F, 0x47, 0x60, 0x21, 0x9A, 0xC5, 0xFE, 0xF7, 0x47, 0x6E,
+    0xED, 0x5A, 0xC9, 0x6F, 0x38, 0x3F, 0x5A, 0xED, 0x65, 0x44, 0xAC, 0x4A, 0xFE, 0x1D, 0x00, 0x52,
+    0x86, 0x17, 0x97, 0x33, 0x25, 0x2F, 0xDC, 0x0D, 0x5B, 0xD5, 0x27, 0x76, 0xAD, 0x5B, 0x89, 0x48,
+    0x97, 0x6B, 0x5B, 0xCD, 0x1C, 0xC0, 0xC6, 0x68, 0x61, 0xE1, 0x83, 0x85, 0x07, 0x51, 0x2C, 0xBC,
+    0x71, 0xEE, 0x58, 0x68, 0x6C, 0xDD, 0x0C, 0x85, 0x8A, 0x46, 0xB9, 0xC2, 0xE2, 0xC2, 0xD3, 0xC2,
+    0x44, 0x23, 0x77, 0xA1, 0x32, 0x0C, 0x61, 0xBF, 0x19, 0xCA, 0xAD, 0xA1, 0xAD, 0x05, 0x4C, 0x19,
+    0x6C, 0x61, 0x68, 0x9C, 0x24, 0x97, 0xCD, 0x10, 0x59, 0xE0, 0x1F, 0x17, 0x8A, 0x2E, 0x06, 0xDF,
+    0x4B, 0x3D, 0xCD, 0xB0, 0xC6, 0x5B, 0x56, 0x14, 0x82, 0x6C, 0xCD, 0x9C, 0x6D, 0x44, 0xB6, 0x76,
+    0xE3, 0xA6, 0xD2, 0x60, 0xAE, 0x2C, 0x8C, 0x6D, 0x0A, 0x5B, 0xB3, 0x25, 0x03, 0x4B, 0xF7, 0xEE,
+    0xC6, 0xE2, 0xEF, 0x6C, 0x4A, 0xC7, 0xFC, 0x14, 0xB3, 0xCB, 0xB8, 0x3B, 0x5B, 0x64, 0xCE, 0xFE,
+    0x9E, 0x3E, 0x7F, 0xF5, 0x07, 0x17, 0x2D, 0xE8, 0xFD, 0x3B, 0xE1, 0xBF, 0x3F, 0x3F, 0x01, 0xB5,
+    0x55, 0x31, 0x92, 0xDD, 0x44, 0x10, 0x6D, 0x7D, 0xD5, 0xAE, 0x82, 0xA9, 0x62, 0xA2, 0x4D, 0x48,
+    0x74, 0x04, 0x25, 0x44, 0x24, 0x92, 0x4D, 0x40, 0x08, 0x81, 0x89, 0x9D, 0x90, 0x10, 0xF9, 0x08,
+    0xA3, 0xC2, 0x17, 0xD8, 0x1B, 0x70, 0x04, 0xC7, 0x8E, 0x46, 0xC5, 0x05, 0xAC, 0x80, 0x2A, 0x52,
+    0x55, 0x41, 0x41, 0x40, 0x80, 0x02, 0xB9, 0x4A, 0x2C, 0xA3, 0x69, 0xDE, 0xEB, 0xD1, 0x5F, 0xAF,
+    0x13, 0x88, 0x98, 0x40, 0xD2, 0xFF, 0xDD, 0x7A, 0xD3, 0xFD, 0xDE, 0xEB, 0x91, 0xF8, 0x5D, 0xFA,
+    0x55, 0xE2, 0x54, 0xE9, 0x58, 0xAB, 0xF8, 0x24, 0xDD, 0x26, 0x61, 0x29, 0xBF, 0xDC, 0x21, 0xED,
+    0xC6, 0xB0, 0x4E, 0x17, 0x1D, 0xEA, 0xCC, 0x30, 0x7E, 0x7D, 0x1C, 0x0E, 0x4B, 0x09, 0xE3, 0x57,
+    0x09, 0x3F, 0xC1, 0xFA, 0x38, 0xDC, 0xEE, 0x1F, 0xB0, 0xF4, 0x11, 0x0B, 0x7F, 0x9C, 0x58, 0x08,
+    0x9F, 0xC9, 0xCD, 0x75, 0xAB, 0x38, 0x97, 0x30, 0xB1, 0xD4, 0x16, 0xC2, 0xB6, 0x90, 0x5C, 0x1E,
+    0x80, 0x65, 0x6B, 0x13, 0xF1, 0x05, 0x61, 0x6C, 0x0C, 0x2C, 0x2C, 0x65, 0x5B, 0x34, 0x74, 0xC5,
+    0xB0, 0xED, 0xF1, 0x68, 0x51, 0x54, 0x59, 0xA2, 0x4C, 0x14, 0x97, 0xFE, 0x3B, 0x31, 0xCE, 0x67,
+    0xF4, 0x49, 0xE2, 0xF2, 0xAF, 0x89, 0xEB, 0x63, 0x22, 0xA3, 0x53, 0xA3, 0xD7, 0x36, 0xD4, 0x9D,
+    0xF7, 0xD7, 0xE7, 0x7D, 0x3E, 0xEF, 0xAB, 0xD8, 0xC2, 0x1B, 0xB6, 0x40, 0xBA, 0x2D, 0x40, 0x97,
+    0x07, 0x30, 0x62, 0x0B, 0xD0, 0x80, 0x12, 0x01, 0xCE, 0x24, 0xB5, 0xBD, 0x47, 0x52, 0xE4, 0xEE,
+    0xE5, 0xC1, 0xD7, 0x94, 0x39, 0x88, 0x08, 0x19, 0x16, 0x69, 0xFF, 0x12, 0x4B, 0xBD, 0x67, 0x6A,
+    0x66, 0xAA, 0x2E, 0x12, 0x54, 0x59, 0x6D, 0x83, 0xAA, 0x93, 0xC4, 0x95, 0x5D, 0x24, 0xB1, 0x22,
+    0xC9, 0xC8, 0xD8, 0x6D, 0x95, 0xCE, 0xFE, 0xB8, 0xD5, 0xB5, 0x36, 0x7A, 0xED, 0x12, 0xB8, 0x53,
+    0x47, 0x20, 0xB2, 0x0D, 0xF4, 0xB9, 0xD2, 0x41, 0xA4, 0xB4, 0x2D, 0xA5, 0x5B, 0x39, 0x5B, 0x17,
+    0x76, 0xCC, 0xFA, 0xBB, 0xDD, 0xCA, 0xAE, 0x21, 0x47, 0x2A, 0xA5, 0xEB, 0x4F, 0x56, 0xA3, 0x87,
+    0x7C, 0xC6, 0x8C, 0x9A, 0x03, 0x80, 0x8B, 0x02, 0x66, 0x6E, 0xB7, 0x18, 0x44, 0xAB, 0x80, 0x00,
+    0x05, 0x61, 0x35, 0x7E, 0x6B, 0x2D, 0x8A, 0xF6, 0xAB, 0x11, 0xDB, 0x68, 0xA1, 0x56, 0x97, 0xB0,
+    0x82, 0x9F, 0x90, 0x5C, 0x36, 0x7A, 0xC7, 0x38, 0x5F, 0xAE, 0x10, 0x56, 0x38, 0x8A, 0xD2, 0x5F,
+    0x29, 0xD1, 0xB5, 0x66, 0x91, 0x0B, 0xAB, 0xF6, 0x67, 0x35, 0x85, 0x5D, 0x47, 0xE2, 0x3A, 0xF2,
+    0x5F, 0xAA, 0xD3, 0x99, 0x68, 0x10, 0x53, 0x0B, 0x03, 0xAB, 0x4F, 0xB5, 0x4E, 0x3D, 0xAA, 0x78,
+    0xA6, 0xA3, 0x3F, 0x58, 0xC7, 0x66, 0x75, 0xE8, 0xE4, 0xB5, 0xC9, 0x95, 0x6E, 0x65, 0x73, 0x34,
+    0xC1, 0xF4, 0xD1, 0x1B, 0x4B, 0xB6, 0x6E, 0xC9, 0xB9, 0x27, 0x18, 0x23, 0x43, 0x61, 0xF1, 0x93,
+    0xA1, 0xCB, 0xA6, 0x2C, 0x55, 0xEA, 0xC9, 0x9E, 0xCB, 0x8F, 0x4A, 0x43, 0xB5, 0x9E, 0x7A, 0xB6,
+    0xD4, 0xC8, 0x5D, 0x6D, 0x6E, 0x7A, 0xAE, 0x85, 0xD1, 0xB3, 0x7C, 0xAF, 0xA6, 0xEC, 0xF0, 0x19,
+    0x52, 0xB9, 0xA5, 0x35, 0x8B, 0x44, 0x56, 0x80, 0xBF, 0x88, 0x78, 0xF3, 0xB5, 0x3C, 0x59, 0x74,
+    0x54, 0x40, 0x0D, 0xD0, 0xAD, 0x22, 0xDF, 0x52, 0xD8, 0x9A, 0x40, 0x04, 0xEF, 0x09, 0xB0, 0xD6,
+    0x0A, 0x87, 0x10, 0x26, 0x51, 0x4E, 0x11, 0xF6, 0x84, 0x35, 0xE2, 0xD4, 0xB3, 0x01, 0xEA, 0x92,
+    0x28, 0xB5, 0x3F, 0x5E, 0x66, 0xF2, 0xD7, 0x58, 0x4F, 0x3E, 0x15, 0x18, 0x24, 0x14, 0x1B, 0x83,
+    0xAB, 0x87, 0xB8, 0xB3, 0x15, 0xBF, 0xD3, 0x06, 0x70, 0x5A, 0x66, 0x73, 0x4C, 0x24, 0xA2, 0x53,
+    0x62, 0x24, 0xDA, 0xA2, 0x07, 0xC1, 0x38, 0x32, 0x26, 0x48, 0x14, 0xE1, 0xC7, 0x19, 0x03, 0xCC,
+    0x56, 0xB8, 0x75, 0x65, 0x56, 0x05, 0x6E, 0xCB, 0x3B, 0xC5, 0x8A, 0xD7, 0x51, 0x78, 0x51, 0x26,
+    0xE3, 0x0D, 0x9B, 0x68, 0x4B, 0x2B, 0xA4, 0xEC, 0x62, 0x46, 0x05, 0x4A, 0x6F, 0x7B, 0xE0, 0xEA,
+    0x0F, 0xBB, 0x72, 0x08, 0x79, 0x85, 0x17, 0xF1, 0x0F, 0x20, 0x41, 0x5B, 0x19, 0x1E, 0x20, 0x56,
+    0x76, 0x25, 0xC2, 0x60, 0xCF, 0x74, 0xC0, 0x6B, 0x25, 0xBF, 0x56, 0x7B, 0xA2, 0x3B, 0xC2, 0x46,
+    0xCA, 0xCD, 0x58, 0xB5, 0x95, 0xEE, 0x6C, 0xF0, 0xDB, 0x4C, 0xF3, 0xF7, 0xC5, 0xF3, 0xF2, 0x2D,
+    0xE5, 0xC9, 0x1E, 0x1D, 0xE5, 0x38, 0x42, 0xC3, 0xA3, 0xD6, 0xDF, 0x74, 0x6D, 0x71, 0x9B, 0xD0,
+    0x58, 0xB6, 0xB3, 0x82, 0x6E, 0x9E, 0x23, 0x46, 0x87, 0x27, 0x5F, 0xB2, 0x63, 0xA4, 0x87, 0x85,
+    0x07, 0x82, 0x82, 0x89, 0xB8, 0x3A, 0xFD, 0x93, 0xAE, 0x82, 0x7C, 0x9D, 0xFE, 0xBE, 0x49, 0x77,
+    0x74, 0x93, 0xDC, 0x7C, 0xD0, 0xF0, 0x16, 0xA5, 0x82, 0x75, 0x31, 0x01, 0xD1, 0x3A, 0xDE, 0xCD,
+    0xF7, 0x28, 0x75, 0x60, 0x75, 0x22, 0x36, 0x74, 0xFD, 0x1A, 0x47, 0xD1, 0x1F, 0x38, 0x82, 0x90,
+    0xA5, 0x07, 0xE0, 0xA0, 0xBB, 0xC7, 0xFE, 0x23, 0xF6, 0x27, 0x15, 0x1C, 0x9A, 0xEF, 0x79, 0x58,
+    0x3A, 0xD6, 0xDF, 0x72, 0x4E, 0xC2, 0x42, 0xD1, 0x27, 0xCA, 0xF1, 0x07, 0x05, 0x01, 0x7A, 0x43,
+    0x4D, 0x1B, 0x9E, 0xAE, 0x27, 0xDF, 0x9F, 0x0E, 0xF4, 0xCF, 0x4C, 0x7B, 0xD2, 0x6F, 0x10, 0x73,
+    0x8E, 0xC0, 0xAA, 0x33, 0x38, 0x0D, 0x33, 0x34, 0x4C, 0x1C, 0x83, 0xE7, 0xF4, 0x44, 0x6F, 0xA3,
+    0xF0, 0x4D, 0x5C, 0x69, 0xAD, 0x2F, 0xD8, 0x78, 0xB7, 0x41, 0x52, 0x9D, 0x03, 0x1A, 0xB4, 0xDE,
+    0xD0, 0x07, 0xB1, 0xAC, 0xB7, 0xEA, 0x3B, 0xCA, 0x98, 0xA8, 0x3C, 0x3D, 0xBC, 0xCB, 0x5B, 0xA7,
+    0xE7, 0x21, 0x06, 0xB7, 0x54, 0xB0, 0x92, 0x53, 0x4E, 0x34, 0x6A, 0x47, 0x39, 0x3D, 0x86, 0x8B,
+    0xF3, 0x83, 0x5D, 0x69, 0xB9, 0x4A, 0xE2, 0xFB, 0x57, 0x13, 0xA9, 0xB8, 0x14, 0x4E, 0x50, 0xF0,
+    0x1D, 0xBD, 0xFF, 0x82, 0x12, 0x1E, 0xE5, 0x70, 0x74, 0xB4, 0xD0, 0xE7, 0x6F, 0xF4, 0x3A, 0x40,
+    0x84, 0xB6, 0xA9, 0x0F, 0x18, 0x81, 0x2F, 0xF3, 0x45, 0x73, 0x58, 0xA2, 0xFE, 0x9D, 0x5B, 0x90,
+    0xF5, 0x0B, 0x68, 0x38, 0x38, 0xDE, 0x3F, 0xF3, 0x5B, 0xC4, 0xEF, 0xD0, 0x3B, 0xC0, 0xEE, 0xFC,
+    0xFE, 0x7C, 0x45, 0xA5, 0x75, 0x72, 0xD9, 0xC1, 0xCF, 0x53, 0x78, 0x88, 0x9B, 0x1D, 0xAA, 0x9E,
+    0xDD, 0x74, 0x9C, 0xF9, 0xA2, 0x14, 0xDA, 0x69, 0x34, 0xD9, 0x01, 0x4D, 0x9E, 0x1C, 0x18, 0x40,
+    0xA1, 0xF1, 0x47, 0xDA, 0x5D, 0xA7, 0x6E, 0x0F, 0x0F, 0x9A, 0xC0, 0xC0, 0x81, 0xE0, 0x5E, 0xEB,
+    0xC3, 0xBD, 0x95, 0xC3, 0x73, 0x00, 0x7A, 0xDC, 0x54, 0xFA, 0xFE, 0x15, 0xF9, 0xE3, 0x61, 0x08,
+    0xFD, 0xA9, 0xEA, 0x9D, 0xFC, 0x0F, 0xEB, 0x1F, 0xAD, 0x55, 0xB1, 0xAE, 0xDD, 0x44, 0x10, 0x1D,
+    0x5F, 0x2B, 0xB1, 0x84, 0x8B, 0x6D, 0x42, 0x43, 0xB3, 0x9F, 0xE0, 0x4F, 0x58, 0x43, 0x4B, 0x01,
+    0xCD, 0x2B, 0xA0, 0xA1, 0xA1, 0xE1, 0x27, 0x58, 0x4B, 0x94, 0x14, 0x7C, 0x00, 0x05, 0x14, 0x54,
+    0x49, 0xF1, 0x7E, 0x00, 0x61, 0x03, 0x05, 0x05, 0x45, 0x0C, 0x91, 0x68, 0x28, 0xB0, 0x94, 0xA4,
+    0x7E, 0x2B, 0x61, 0x29, 0x9B, 0xBC, 0xDD, 0x1D, 0xCE, 0x59, 0xBF, 0x7B, 0x93, 0x0A, 0x1A, 0x56,
+    0xEF, 0xFA, 0xEE, 0xBB, 0x3B, 0x33, 0x7B, 0xE6, 0xCC, 0x99, 0xB1, 0x7C, 0x26, 0x5C, 0xEF, 0x8C,
+    0xB6, 0x48, 0x9F, 0xC4, 0xA7, 0x46, 0x93, 0xE8, 0x32, 0xE8, 0x62, 0x75, 0x33, 0xB1, 0xD7, 0x5D,
+    0x3E, 0xD1, 0x46, 0xDF, 0xD5, 0xE7, 0x22, 0x2E, 0x0C, 0xC1, 0xED, 0x22, 0x27, 0x7D, 0x4F, 0xBB,
+    0x02, 0x2F, 0xBB, 0xBB, 0xA0, 0x8B, 0x48, 0xA3, 0x58, 0x09, 0x3F, 0x0C, 0xDC, 0x8C, 0xB4, 0xC0,
+    0x82, 0xA5, 0x38, 0x6E, 0xF0, 0xDD, 0x15, 0x13, 0x87, 0x80, 0x8D, 0x2E, 0x88, 0x05, 0x8B, 0x21,
+    0xDA, 0xDD, 0x26, 0x69, 0xAE, 0xF5, 0xA4, 0xA2, 0xAF, 0xE0, 0xB9, 0xBA, 0xD0, 0x6B, 0x68, 0x75,
+    0x6F, 0x0B, 0xDC, 0xC4, 0x47, 0xF1, 0xAB, 0xCC, 0xA1, 0xF9, 0xB0, 0x02, 0x7C, 0x20, 0x72, 0xEF,
+    0x3B, 0xC6, 0x5D, 0x3B, 0xD5, 0xD8, 0xAA, 0xE6, 0xD3, 0x33, 0x40, 0x16, 0x18, 0x0B, 0xB1, 0x20,
+    0x96, 0xD7, 0x20, 0x33, 0x62, 0xC3, 0x46, 0xAE, 0x66, 0x5C, 0x66, 0xE3, 0xF1, 0x71, 0xF1, 0xF3,
+    0x87, 0xBA, 0x7B, 0xD5, 0x0D, 0x9F, 0xC9, 0xEB, 0x4B, 0x91, 0x2B, 0x39, 0x96, 0x49, 0x32, 0xAF,
+    0x6E, 0x6B, 0x91, 0xE2, 0x68, 0x52, 0x9F, 0xC5, 0x6F, 0x2E, 0x60, 0xAF, 0x4B, 0x9F, 0x10, 0x16,
+    0x19, 0xEF, 0x80, 0x3C, 0x2F, 0x5D, 0x69, 0x55, 0x86, 0xDD, 0x90, 0x1B, 0xBF, 0x75, 0x30, 0x9F,
+    0x5C, 0xEC, 0xB4, 0xD5, 0xCD, 0x2A, 0xEE, 0x74, 0xFA, 0x02, 0x81, 0xF4, 0x2B, 0x00, 0xD8, 0xDD,
+    0x44, 0xB0, 0xA0, 0x74, 0x7A, 0xEB, 0x5B, 0x99, 0x47, 0x3F, 0x35, 0xA5, 0x4D, 0x02, 0xC4, 0x9B,
+    0x74, 0x0A, 0xA4, 0xCD, 0x0F, 0xA3, 0x5C, 0xD6, 0x11, 0x35, 0x32, 0xEA, 0xDA, 0x82, 0x8A, 0xD1,
+    0x46, 0xDC, 0xE1, 0xC1, 0xC5, 0x89, 0x77, 0x54, 0x48, 0xA4, 0x1D, 0x7B, 0x40, 0xCA, 0x30, 0x77,
+    0xC1, 0xC6, 0x86, 0x20, 0x4C, 0xC1, 0x97, 0x02, 0xC4, 0x8D, 0xAE, 0x46, 0x33, 0x02, 0xE9, 0xD3,
+    0x24, 0x43, 0x36, 0x9B, 0xDC, 0x7B, 0x7D, 0x81, 0x03, 0xA3, 0x08, 0xD3, 0x2A, 0x52, 0x38, 0xE9,
+    0xC2, 0x4A, 0x2E, 0x32, 0x2F, 0xA0, 0x08, 0xA5, 0x5B, 0xC5, 0xE4, 0x0A, 0x0B, 0xCC, 0x9D, 0xF8,
+    0x90, 0x5A, 0x46, 0x77, 0x0B, 0x16, 0x4D, 0xF4, 0x41, 0xBA, 0x6C, 0x72, 0x2D, 0xF7, 0x02, 0x84,
+    0x2E, 0xC0, 0xA7, 0x2F, 0x52, 0xEF, 0xEF, 0x80, 0x2B, 0x9E, 0x2F, 0x51, 0x26, 0xE7, 0x59, 0x71,
+    0x08, 0x20, 0x8B, 0x29, 0x8F, 0x94, 0x85, 0xE1, 0x75, 0xA3, 0xDF, 0x70, 0x9D, 0xDD, 0xE9, 0x9A,
+    0xC4, 0xEC, 0xC8, 0xA0, 0x23, 0x89, 0xA8, 0x3A, 0x4E, 0x74, 0x02, 0xBF, 0x7E, 0xC5, 0x09, 0x71,
+    0xB6, 0x0A, 0x22, 0x26, 0x20, 0x40, 0x11, 0x32, 0x79, 0xC9, 0xAC, 0xCF, 0x9B, 0xCB, 0x10, 0x48,
+    0xE2, 0x5F, 0x15, 0xE8, 0xD2, 0x6A, 0x3A, 0x29, 0x99, 0x9F, 0x06, 0x92, 0x80, 0xE8, 0xF9, 0x54,
+    0xC0, 0xD1, 0xCD, 0xEA, 0x6E, 0x42, 0x97, 0x73, 0xFF, 0xA2, 0xC8, 0xFC, 0x78, 0x53, 0xB7, 0x9A,
+    0x58, 0x86, 0x27, 0x59, 0xF4, 0x83, 0xA7, 0xC9, 0x2F, 0x26, 0x94, 0xF9, 0x7D, 0x28, 0xDD, 0x68,
+    0x80, 0x67, 0xD0, 0x0C, 0x5C, 0xC5, 0xE8, 0x8F, 0xF0, 0x5C, 0x75, 0x1F, 0x42, 0x97, 0x0C, 0xC0,
+    0x88, 0x5F, 0xA8, 0x8D, 0x73, 0x8E, 0x4B, 0x2D, 0xBE, 0x81, 0xDB, 0x64, 0x23, 0x2A, 0x35, 0xEC,
+    0xB5, 0x1A, 0x77, 0x8F, 0x2B, 0x1F, 0x3A, 0xD2, 0xD0, 0xE3, 0x01, 0x24, 0x0A, 0xCB, 0xF2, 0x10,
+    0x18, 0x59, 0xDA, 0x01, 0x84, 0x21, 0x51, 0xF8, 0x5C, 0xCC, 0x91, 0x22, 0xE4, 0x35, 0xAF, 0x28,
+    0xAF, 0xC8, 0x47, 0xEC, 0x07, 0x30, 0xD8, 0xB2, 0x04, 0xE8, 0x18, 0xD4, 0xFE, 0x0F, 0x5D, 0x2D,
+    0x52, 0x9B, 0x74, 0xA3, 0xC8, 0x40, 0x03, 0xF5, 0x1D, 0xE6, 0xAD, 0xD1, 0x2F, 0x74, 0xEC, 0x0B,
+    0xA0, 0x38, 0xF4, 0x1E, 0xBB, 0x69, 0xED, 0x51, 0xD7, 0xC9, 0x23, 0xE6, 0x23, 0x9D, 0x70, 0x7B,
+    0x04, 0x49, 0x3A, 0xA1, 0xA6, 0xCF, 0x10, 0xF9, 0xE8, 0x9D, 0x4F, 0xA5, 0x4D, 0x43, 0x11, 0xF3,
+    0x37, 0x6A, 0xE3, 0xAF, 0x49, 0xD9, 0xCB, 0x19, 0xBD, 0x06, 0x91, 0xBB, 0xC8, 0xEE, 0x43, 0x52,
+    0x9D, 0xDE, 0x69, 0x7D, 0x62, 0x69, 0xFF, 0x53, 0x95, 0xAC, 0x3E, 0xBB, 0x59, 0xEE, 0x8F, 0x72,
+    0x62, 0x6C, 0x51, 0x87, 0x04, 0x1C, 0xE5, 0x63, 0xF5, 0x6B, 0x02, 0x19, 0x75, 0x03, 0x2E, 0x4B,
+    0xCE, 0x18, 0x1C, 0xC8, 0xA9, 0x02, 0xBF, 0xA1, 0xD6, 0x95, 0x39, 0x73, 0x3E, 0xA1, 0x40, 0x2D,
+    0xB5, 0xD9, 0xEB, 0xAD, 0xE2, 0x3A, 0x6A, 0x49, 0xAF, 0x29, 0xA8, 0xDF, 0x21, 0xD0, 0x61, 0x87,
+    0x98, 0xFB, 0x74, 0xB4, 0x4A, 0x2D, 0x03, 0x1E, 0x9E, 0x45, 0x19, 0xF6, 0xA3, 0x7F, 0xCF, 0x27,
+    0x22, 0x1F, 0x8F, 0xD2, 0x2B, 0x87, 0x47, 0xA1, 0x8E, 0x5B, 0x7D, 0xFE, 0x7D, 0x47, 0x21, 0xE7,
+    0xC3, 0x8C, 0x93, 0x80, 0x3E, 0x04, 0xFE, 0xE6, 0x67, 0x88, 0x32, 0x5A, 0xBD, 0x5E, 0x40, 0x1B,
+    0xF4, 0xC4, 0xEE, 0x80, 0x53, 0x33, 0x1E, 0xC4, 0x21, 0x3F, 0xF7, 0x93, 0xAE, 0x07, 0x7B, 0x09,
+    0x22, 0xEB, 0x5E, 0xA9, 0x1E, 0x14, 0xAA, 0xFE, 0xA9, 0x68, 0x77, 0x43, 0xCA, 0x1C, 0x26, 0xD2,
+    0x32, 0x04, 0xE6, 0xB4, 0x9A, 0x63, 0x70, 0xDC, 0xF1, 0x26, 0x47, 0xE3, 0xD6, 0xB9, 0xF2, 0x9A,
+    0xD6, 0x83, 0xC1, 0xED, 0xB0, 0xD9, 0x2F, 0x36, 0xEB, 0x9D, 0x8D, 0xBD, 0xD8, 0xF8, 0xED, 0x9C,
+    0x9C, 0xD4, 0x76, 0x5A, 0xC8, 0x5C, 0xAE, 0x93, 0x3A, 0x54, 0x1E, 0x47, 0x78, 0xE1, 0x5A, 0x34,
+    0xDA, 0xBC, 0xA2, 0xE7, 0x68, 0x8D, 0x49, 0x5B, 0xD3, 0x84, 0x0A, 0x64, 0xFE, 0x35, 0x71, 0x1A,
+    0x53, 0xC5, 0x5D, 0xD6, 0xDA, 0x41, 0xB1, 0x8E, 0x65, 0xD2, 0xC8, 0x69, 0x04, 0xF2, 0x58, 0xC8,
+    0x9E, 0x33, 0x59, 0x86, 0xDA, 0x6D, 0x08, 0x04, 0xEB, 0x7A, 0x2D, 0xA7, 0x3D, 0xB6, 0x0B, 0xFD,
+    0x52, 0xF5, 0xE3, 0x99, 0xE6, 0xEA, 0x77, 0x1E, 0x63, 0x6F, 0x73, 0x73, 0x52, 0x39, 0x97, 0x43,
+    0x6A, 0xCF, 0x34, 0xF5, 0xBC, 0x3F, 0x7E, 0x08, 0xF5, 0x07, 0x84, 0xB9, 0x4F, 0x81, 0x36, 0x7A,
+    0xE8, 0x04, 0xCF, 0x06, 0x35, 0x9F, 0xA3, 0xC9, 0x9C, 0x36, 0xF3, 0xE6, 0xD6, 0xF9, 0x09, 0x04,
+    0xD6, 0xE8, 0x37, 0x91, 0xE3, 0x17, 0xDD, 0x17, 0xEC, 0x2D, 0x04, 0x3A, 0xCD, 0x7F, 0x25, 0xAA,
+    0x12, 0xFF, 0x06, 0x9B, 0xE6, 0x0D, 0xF3, 0xEB, 0x37, 0xFD, 0xB9, 0xB0, 0x49, 0x6F, 0xD0, 0x2E,
+    0x5D, 0x7D, 0xC9, 0xD4, 0xF6, 0x63, 0xEC, 0x78, 0xBE, 0x51, 0xC8, 0x00, 0xF2, 0xE6, 0x76, 0x08,
+    0x17, 0xF5, 0xF0, 0x95, 0x71, 0xC8, 0x41, 0xF8, 0x8A, 0x39, 0x2F, 0x4C, 0x36, 0x4C, 0x34, 0x17,
+    0x4C, 0x41, 0x6E, 0x9C, 0x78, 0x96, 0x13, 0x50, 0xF4, 0x71, 0x26, 0x3D, 0xCC, 0x86, 0x12, 0xC7,
+    0x19, 0x53, 0xB2, 0x7A, 0xA1, 0xAE, 0x1E, 0x0D, 0xBC, 0x15, 0x88, 0x17, 0x00, 0xF8, 0xA5, 0xC8,
+    0xD1, 0x9D, 0x06, 0xAA, 0x1E, 0x21, 0x6C, 0x34, 0x01, 0x5E, 0x47, 0xBA, 0xFE, 0x4F, 0xAF, 0x9C,
+    0xC0, 0x57, 0x4E, 0xC2, 0x2B, 0x47, 0xC3, 0xAC, 0x5F, 0x82, 0x9C, 0x1D, 0x41, 0x1E, 0x88, 0x25,
+    0x18, 0x00, 0x38, 0xF2, 0x33, 0xF1, 0x5C, 0x99, 0x7F, 0x5F, 0xFF, 0x00, 0xBD, 0x55, 0xB1, 0x72,
+    0xE5, 0x44, 0x10, 0x1C, 0x49, 0xD8, 0x02, 0x14, 0x88, 0xC0, 0x26, 0x80, 0x40, 0x9F, 0xA0, 0x4F,
+    0x58, 0xC1, 0x85, 0x24, 0x0E, 0x0E, 0x02, 0x08, 0x2E, 0xB9, 0xE8, 0x92, 0xFB, 0x04, 0x89, 0x88,
+    0x80, 0x00, 0x27, 0xF0, 0x05, 0x50, 0x05, 0x76, 0xF0, 0x7E, 0xE0, 0xA8, 0x55, 0x41, 0x40, 0x40,
+    0x22, 0x02, 0x48, 0x48, 0xC4, 0x9D, 0x2F, 0xE1, 0x02, 0xB6, 0x0A, 0x41, 0xE9, 0xCA, 0xD2, 0x0E,
+    0xDD, 0x23, 0x9D, 0x71, 0x51, 0x84, 0x14, 0xAE, 0x92, 0x9E, 0x56, 0x9A, 0x9D, 0xE9, 0xE9, 0xEE,
+    0x1D, 0x8B, 0x88, 0x14, 0xAB, 0xB8, 0x27, 0x2A, 0xD5, 0xAC, 0x7D, 0xB1, 0xBA, 0x31, 0xD3, 0x6A,
+    0x16, 0xFD, 0x7E, 0x15, 0xFF, 0x58, 0x1B, 0x37, 0xF9, 0xA1, 0x5E, 0xEB, 0xE8, 0x35, 0x57, 0xD5,
+    0x5E, 0xD5, 0x8F, 0xA5, 0xDE, 0x9B, 0xE4, 0x6E, 0xB1, 0x88, 0x64, 0x8A, 0xDD, 0xDA, 0x8B, 0xB4,
+    0xA3, 0x48, 0x3D, 0x89, 0x94, 0x78, 0xB9, 0xFF, 0x69, 0x8F, 0x85, 0x1F, 0x5A, 0xA4, 0x13, 0x17,
+    0xAA, 0x29, 0xD1, 0xAE, 0x5C, 0xB0, 0xA9, 0x1D, 0xF2, 0x88, 0x57, 0x75, 0x48, 0xB4, 0xD9, 0x62,
+    0xFA, 0x3D, 0xA6, 0xBE, 0x89, 0xF1, 0x5B, 0x8C, 0x0B, 0xE9, 0x1E, 0xA3, 0x88, 0x29, 0x54, 0xDA,
+    0x50, 0xCD, 0x99, 0x76, 0x6E, 0xE6, 0xE7, 0xE0, 0x62, 0xA2, 0xCF, 0x00, 0x08, 0x20, 0xF5, 0x4F,
+    0xD5, 0xB6, 0x2F, 0x74, 0x72, 0xFA, 0x49, 0x10, 0x3F, 0xE5, 0x7A, 0x67, 0x96, 0xA4, 0x91, 0x13,
+    0x91, 0xFF, 0x05, 0xD0, 0xB2, 0x01, 0xD2, 0x1D, 0xD0, 0xB2, 0x01, 0x52, 0x03, 0xF4, 0xB1, 0x76,
+    0x04, 0xD4, 0xF8, 0xC1, 0x00, 0x55, 0xC1, 0xD0, 0x14, 0x1B, 0x53, 0xC6, 0x20, 0xC1, 0x75, 0xF6,
+    0x73, 0xDA, 0x6C, 0x2B, 0x1D, 0x04, 0x74, 0x8B, 0x54, 0x8A, 0xB0, 0x07, 0x1E, 0x5B, 0x12, 0x46,
+    0x40, 0x28, 0x11, 0x77, 0x1D, 0x1B, 0xA1, 0x16, 0x19, 0x6E, 0x5D, 0x15, 0x0F, 0x0A, 0x78, 0xC5,
+    0x9A, 0x51, 0x40, 0xEB, 0xD0, 0x05, 0x3C, 0xFB, 0xF1, 0xE1, 0x92, 0x30, 0x2A, 0x55, 0xE4, 0xC0,
+    0x13, 0x32, 0x9F, 0xDE, 0x70, 0xE1, 0x02, 0xB5, 0xCA, 0xA2, 0xD1, 0x42, 0xF1, 0xCA, 0x99, 0xB9,
+    0x8D, 0x01, 0x2A, 0x59, 0x9A, 0xB8, 0x89, 0xFE, 0x76, 0x45, 0x1A, 0x54, 0x43, 0x1E, 0x53, 0x26,
+    0x6B, 0x07, 0x17, 0xFD, 0x5A, 0x2C, 0x56, 0x80, 0x3B, 0xF3, 0x58, 0xA2, 0x77, 0x69, 0x7F, 0xD0,
+    0xAE, 0x1D, 0xCB, 0xA5, 0x9E, 0x32, 0x7D, 0x5B, 0xBF, 0x05, 0x53, 0xD8, 0x83, 0x22, 0xAA, 0x2B,
+    0x8A, 0xA4, 0x1A, 0xCD, 0x21, 0x77, 0x6F, 0x69, 0x01, 0x0C, 0x78, 0x03, 0xA3, 0x59, 0x53, 0x7F,
+    0x1B, 0xE9, 0x3A, 0x0A, 0xEA, 0x4D, 0x05, 0xAA, 0xDD, 0xD1, 0x0B, 0x45, 0x91, 0x6A, 0x69, 0x77,
+    0x4B, 0x7E, 0xC7, 0x34, 0x3A, 0xB4, 0x20, 0x55, 0x41, 0xBB, 0xCE, 0x08, 0x1D, 0xB7, 0xB6, 0x4E,
+    0xCF, 0xE4, 0x4D, 0xAC, 0x5B, 0xF4, 0x8A, 0xF7, 0xE9, 0xA7, 0x8A, 0x06, 0x41, 0x22, 0x59, 0x03,
+    0xBC, 0x2D, 0x7C, 0xAC, 0xC0, 0xC2, 0x83, 0xC3, 0x62, 0xED, 0xA7, 0xF8, 0x52, 0x2D, 0xD5, 0xA5,
+    0x8E, 0xAD, 0xA2, 0x51, 0x85, 0xB2, 0xC0, 0xB1, 0xFB, 0xE5, 0x8D, 0x86, 0x88, 0x2A, 0x24, 0x2F,
+    0x17, 0xF4, 0x1D, 0x50, 0x16, 0xA0, 0xC6, 0x44, 0xDF, 0xD2, 0xA7, 0x38, 0x23, 0x4B, 0xB9, 0x22,
+    0xB1, 0x43, 0x83, 0x68, 0x4E, 0x7F, 0xD2, 0x06, 0x1C, 0x90, 0xE5, 0x8D, 0x2A, 0x68, 0x49, 0x61,
+    0xE8, 0x88, 0xCB, 0x48, 0x2E, 0xE7, 0x72, 0x36, 0x96, 0xDD, 0x48, 0x16, 0xC1, 0xB0, 0x0B, 0x4C,
+    0xFB, 0x8C, 0x29, 0x00, 0x0B, 0x32, 0x75, 0xD8, 0xDE, 0xE7, 0x2B, 0x40, 0x4D, 0x56, 0xFF, 0x86,
+    0xA8, 0xC4, 0xC3, 0x05, 0xE0, 0xC2, 0x48, 0x59, 0xA5, 0x7D, 0x7E, 0x0F, 0x02, 0x8F, 0xE6, 0x3F,
+    0xBB, 0x81, 0x15, 0x0F, 0x9B, 0x1A, 0xDD, 0x52, 0xF2, 0x86, 0xE0, 0x51, 0xAA, 0xD5, 0x8F, 0xF0,
+    0xA6, 0x1F, 0xC0, 0x01, 0x7D, 0xD2, 0x01, 0x34, 0x9A, 0xEC, 0x2A, 0x94, 0xC5, 0x89, 0x4E, 0xC1,
+    0xF6, 0xAB, 0x5F, 0x9A, 0xDC, 0x10, 0x1B, 0x4C, 0x65, 0xE6, 0x2B, 0x18, 0x2C, 0x0F, 0x7B, 0xDD,
+    0xCF, 0xE9, 0xBD, 0xC0, 0xAA, 0x96, 0xBB, 0x5E, 0xCB, 0x85, 0x98, 0xA1, 0x15, 0xD5, 0xF5, 0xBF,
+    0x00, 0x7D, 0x00, 0x36, 0x2A, 0x81, 0x79, 0xF0, 0x6B, 0xB3, 0x09, 0x38, 0x20, 0xDD, 0x2C, 0x27,
+    0xB9, 0xFE, 0xF8, 0x35, 0x1D, 0xDA, 0x94, 0x34, 0xB2, 0xA7, 0x73, 0xD9, 0x51, 0xD1, 0x3F, 0x92,
+    0x62, 0x6E, 0xBB, 0x34, 0xD6, 0xA3, 0xF8, 0x77, 0x26, 0x39, 0x6E, 0xEE, 0x6F, 0xE5, 0x8E, 0xCF,
+    0xA1, 0x3C, 0xE4, 0xF7, 0x26, 0x9F, 0xF6, 0x7E, 0x22, 0xB9, 0x85, 0xD9, 0x89, 0x65, 0x3F, 0xD2,
+    0x83, 0x7E, 0x83, 0x0F, 0x03, 0x89, 0x75, 0xFA, 0x95, 0x6C, 0xFE, 0x04, 0x7A, 0xF4, 0x79, 0x56,
+    0xE9, 0x7B, 0x88, 0x03, 0x3D, 0x00, 0xD3, 0xD0, 0x6B, 0x92, 0x9C, 0x21, 0xE9, 0x11, 0x6F, 0xB4,
+    0x1D, 0x7A, 0x96, 0xE4, 0xA0, 0x17, 0xE4, 0x66, 0x61, 0xD0, 0x28, 0x97, 0x58, 0xD9, 0xC0, 0x02,
+    0x87, 0xF7, 0x91, 0xA9, 0x8E, 0x52, 0x5E, 0x93, 0x60, 0x44, 0xA4, 0xFA, 0xDC, 0x87, 0xD2, 0x74,
+    0x9A, 0x79, 0x06, 0xC0, 0x74, 0x11, 0x5F, 0x4C, 0x03, 0x4E, 0x48, 0x1B, 0x16, 0xF4, 0x63, 0xEF,
+    0x87, 0x2C, 0xDE, 0x3A, 0x77, 0x23, 0xC3, 0x3B, 0x9B, 0x81, 0x34, 0xB7, 0xD1, 0x6B, 0x2B, 0x1E,
+    0x60, 0x20, 0x47, 0x21, 0xAC, 0x4A, 0x3B, 0x62, 0xB3, 0x35, 0x7E, 0x71, 0xBE, 0x3D, 0xE6, 0x71,
+    0x9F, 0x01, 0x0E, 0x14, 0xE6, 0xD3, 0xAE, 0xFE, 0xEB, 0x46, 0x8B, 0x09, 0xDB, 0x0B, 0x4D, 0x50,
+    0x9C, 0x33, 0x93, 0x71, 0xDD, 0xE2, 0xE1, 0x21, 0x76, 0x79, 0xFB, 0x04, 0x87, 0xC2, 0x3A, 0xA5,
+    0x5E, 0xA1, 0x59, 0x54, 0x76, 0x93, 0x45, 0x25, 0x52, 0xAF, 0x1F, 0x04, 0x4E, 0x01, 0xB6, 0x1E,
+    0xA0, 0x28, 0xDE, 0x1F, 0xD9, 0x88, 0x79, 0xBF, 0xC1, 0x2B, 0x74, 0xA5, 0x3C, 0x1C, 0x68, 0xF9,
+    0xE9, 0x23, 0x4C, 0x28, 0x29, 0xD7, 0x0D, 0x30, 0x0F, 0x0A, 0xA4, 0xC7, 0x5C, 0x85, 0xFC, 0x7F,
+    0xBC, 0x6B, 0xE3, 0xC2, 0xAE, 0x59, 0x9A, 0x4A, 0x0F, 0x3D, 0x01, 0xD1, 0xB2, 0xA8, 0xDE, 0x70,
+    0xCC, 0xCA, 0xD1, 0x17, 0x28, 0xAC, 0x1D, 0xF6, 0x7C, 0x88, 0x74, 0x65, 0x3C, 0x1E, 0xDD, 0x76,
+    0x00, 0x33, 0xC0, 0xC9, 0x51, 0xB6, 0xC0, 0xE1, 0xE4, 0x6F, 0x0A, 0x18, 0xA0, 0x14, 0xEF, 0x5F,
+    0x46, 0x25, 0xF7, 0x99, 0x06, 0x3B, 0xE8, 0x8A, 0x01, 0x19, 0xB7, 0x93, 0x8C, 0x74, 0x2D, 0x2D,
+    0x0B, 0x2C, 0xB0, 0xE6, 0xE9, 0xCD, 0xC0, 0x30, 0x9E, 0xC1, 0x72, 0xCA, 0xE3, 0x06, 0x34, 0x60,
+    0x9A, 0xFF, 0xB7, 0xC2, 0xAD, 0x4F, 0xF8, 0xC5, 0xA7, 0x76, 0xB4, 0x59, 0xF9, 0xDA, 0x4B, 0xE2,
+    0xAA, 0xBE, 0xFA, 0x39, 0x14, 0xBF, 0x2F, 0xC9, 0x12, 0xE5, 0xE4, 0x95, 0x5B, 0xC3, 0x07, 0xDB,
+    0xB0, 0x03, 0xFB, 0xC9, 0xE5, 0xBF, 0xAC, 0x61, 0x9B, 0xFA, 0x9F, 0xEB, 0x4D, 0x15, 0x98, 0x2A,
+    0xA7, 0x88, 0xEB, 0x76, 0x71, 0x8C, 0x9B, 0xDB, 0x6E, 0x0D, 0x56, 0x5E, 0xF4, 0x1D, 0x8E, 0x9F,
+    0x5D, 0xD4, 0x1B, 0x17, 0x51, 0xD1, 0x8A, 0x4C, 0xF9, 0xE2, 0xA2, 0xEE, 0xC5, 0x4E, 0xBA, 0x11,
+    0x3F, 0x6F, 0x17, 0x8B, 0x59, 0x1A, 0xB2, 0x35, 0x9A, 0xC8, 0x3C, 0x46, 0x1E, 0xE1, 0xED, 0x95,
+    0xFC, 0x97, 0x7F, 0x7F, 0x01, 0x7D, 0x55, 0x3D, 0x93, 0xDC, 0x44, 0x14, 0x7C, 0x92, 0xB8, 0x53,
+    0xA0, 0x40, 0x89, 0x9D, 0x90, 0x28, 0x27, 0x99, 0x9F, 0x30, 0xCA, 0x09, 0x20, 0xC0, 0xB1, 0x13,
+    0x48, 0x48, 0xF8, 0x09, 0xDA, 0x2A, 0xFF, 0x00, 0x08, 0xF8, 0x09, 0x04, 0xB6, 0x09, 0x2E, 0x21,
+    0x9F, 0xC1, 0x1B, 0x10, 0x5A, 0x86, 0x90, 0x44, 0x14, 0x75, 0x45, 0x95, 0x93, 0x13, 0xF6, 0x14,
+    0xA7, 0xF3, 0x49, 0xF3, 0xE8, 0x7E, 0xBA, 0xB5, 0x8F, 0x04, 0xD5, 0xD5, 0x68, 0xF7, 0x76, 0xE6,
+    0x7D, 0x74, 0xF7, 0xEB, 0x11, 0xB9, 0x7B, 0x54, 0x35, 0xE2, 0x35, 0xA8, 0xCE, 0x78, 0x39, 0xD5,
+    0x15, 0xAF, 0x36, 0x5F, 0x64, 0xBC, 0xAA, 0x5C, 0x68, 0x2F, 0x82, 0x25, 0x70, 0x4F, 0x88, 0xFE,
+    0x36, 0xF7, 0xE2, 0xE7, 0x56, 0x75, 0x91, 0x76, 0xA9, 0x71, 0xF6, 0x50, 0xAF, 0xA5, 0xBE, 0xD6,
+    0xB9, 0x54, 0xD1, 0xD8, 0xAE, 0xA2, 0x07, 0x8F, 0xCF, 0xFD, 0x30, 0xE2, 0x33, 0xF6, 0xCF, 0x95,
+    0x8A, 0x7F, 0x8B, 0xDD, 0x3A, 0x0D, 0x0B, 0x42, 0x77, 0x88, 0xEF, 0xB3, 0x94, 0x78, 0xB5, 0x9B,
+    0xE0, 0x6B, 0x92, 0xCF, 0x11, 0xF9, 0xE1, 0xA9, 0x1A, 0xE1, 0x7E, 0x14, 0xD2, 0xAE, 0x85, 0x1E,
+    0x50, 0xD5, 0xD4, 0x60, 0x17, 0xE2, 0xED, 0xFF, 0x13, 0x96, 0xEA, 0xE7, 0x9A, 0xB5, 0xE9, 0xEB,
+    0x90, 0x9F, 0x09, 0x4B, 0x40, 0x11, 0x6E, 0x7F, 0xD9, 0xAA, 0x08, 0x31, 0x4C, 0xED, 0xD6, 0x2D,
+    0xA8, 0xDB, 0x2D, 0x61, 0x44, 0x88, 0xF0, 0xAB, 0xF6, 0xDD, 0x52, 0x29, 0x42, 0x0C, 0x69, 0x58,
+    0x11, 0x0D, 0xFB, 0x5E, 0x21, 0x83, 0xEA, 0xC6, 0x0C, 0x81, 0xC9, 0x44, 0xCE, 0xD0, 0xEC, 0x19,
+    0xEB, 0x19, 0x26, 0xCB, 0x2A, 0xC5, 0x85, 0x3E, 0x97, 0x86, 0x98, 0x78, 0xD5, 0x49, 0x7E, 0xC4,
+    0x37, 0x71, 0x89, 0xD9, 0xE3, 0x97, 0x28, 0xD5, 0x65, 0x69, 0x6F, 0x75, 0x23, 0x78, 0x40, 0xE1,
+    0x26, 0x00, 0x98, 0x5E, 0xA3, 0x47, 0xA2, 0x82, 0x60, 0xA0, 0x4E, 0x3F, 0xBB, 0x84, 0x4E, 0x34,
+    0x36, 0x1B, 0xCA, 0x72, 0x73, 0x07, 0x24, 0x62, 0x18, 0xAB, 0x8C, 0x6F, 0xDD, 0x42, 0x8C, 0x46,
+    0x3F, 0x71, 0xFB, 0xA1, 0x25, 0xEE, 0xF2, 0xF1, 0x53, 0xB1, 0x46, 0xEF, 0x96, 0x86, 0x4B, 0xCD,
+    0xA5, 0x5A, 0xE4, 0xFE, 0x83, 0xF0, 0xD9, 0x88, 0x40, 0x94, 0x46, 0xA5, 0xDE, 0x6A, 0x45, 0xC1,
+    0x15, 0x4A, 0xD6, 0x23, 0x16, 0x7F, 0x8D, 0x86, 0x3A, 0x32, 0xDB, 0x70, 0xA9, 0x8C, 0x5C, 0xBD,
+    0x42, 0xA7, 0xFE, 0x0F, 0x7C, 0xEF, 0x92, 0x4F, 0xD2, 0x6C, 0x38, 0x58, 0x91, 0x36, 0xFC, 0xB9,
+    0x05, 0x3D, 0x23, 0x46, 0x97, 0xC0, 0x14, 0x7A, 0x7F, 0x76, 0x4A, 0xDE, 0x32, 0x6F, 0x4B, 0x69,
+    0x74, 0x23, 0x97, 0x83, 0xDC, 0xA7, 0xCA, 0xA5, 0x96, 0x0D, 0x0D, 0x63, 0xA5, 0x25, 0x11, 0x26,
+    0xBE, 0x23, 0x05, 0x60, 0x0D, 0x01, 0x59, 0xF4, 0x3F, 0x7F, 0xE8, 0xDF, 0xCF, 0x24, 0x25, 0x82,
+    0x1D, 0x08, 0x2B, 0x2A, 0x04, 0x74, 0xA5, 0x63, 0xAB, 0x1B, 0x02, 0xE9, 0x9F, 0xAB, 0xB8, 0xAD,
+    0x9D, 0xE4, 0x6C, 0x0F, 0xFE, 0xB5, 0x7C, 0xD2, 0x4B, 0xB9, 0x95, 0xA0, 0xBA, 0x5E, 0x3A, 0xB2,
+    0xAF, 0x94, 0x22, 0x05, 0x23, 0x72, 0x7E, 0xF3, 0x1F, 0x30, 0xA8, 0x98, 0x01, 0x94, 0x46, 0xF4,
+    0x0F, 0x1D, 0x76, 0x2B, 0x7A, 0x13, 0x1D, 0xD1, 0x0C, 0x72, 0xA2, 0x20, 0x32, 0xC6, 0x1A, 0xA0,
+    0x67, 0x92, 0xDD, 0xAE, 0x1E, 0x2D, 0xBA, 0x37, 0x4A, 0x49, 0xBF, 0x5C, 0xA8, 0xEF, 0x21, 0xB2,
+    0x1D, 0xCA, 0xAA, 0xB5, 0x31, 0xF0, 0xA6, 0x07, 0x1B, 0x85, 0x52, 0xD9, 0x77, 0xC3, 0xCD, 0x3B,
+    0xF5, 0x85, 0xCD, 0x0B, 0xD5, 0x8B, 0x8F, 0x33, 0xCF, 0xA9, 0x9D, 0x4B, 0x76, 0xAE, 0xE7, 0xB9,
+    0xF1, 0x7D, 0x65, 0xF7, 0x18, 0xEE, 0x0D, 0x90, 0x61, 0xF2, 0x00, 0x04, 0x2A, 0x69, 0x4E, 0xF2,
+    0xA0, 0x20, 0x62, 0x9D, 0x77, 0x34, 0x29, 0x71, 0x12, 0x01, 0xCC, 0x3C, 0xE0, 0xA9, 0x74, 0xEA,
+    0x34, 0x40, 0xFE, 0x7A, 0x8D, 0x40, 0xFA, 0xED, 0x2C, 0x21, 0xF9, 0x83, 0x3C, 0x60, 0xE8, 0x7A,
+    0x64, 0x01, 0x27, 0x9E, 0xD8, 0x92, 0x30, 0x7B, 0x49, 0x05, 0x41, 0x66, 0xC0, 0xC4, 0x4F, 0x61,
+    0x32, 0x7A, 0x5F, 0x60, 0x4C, 0xB3, 0xD4, 0x19, 0x45, 0xE3, 0x17, 0x47, 0xF6, 0xC3, 0x88, 0x5F,
+    0x34, 0x82, 0x35, 0x4B, 0x8D, 0xC4, 0x96, 0x9D, 0x93, 0x11, 0x49, 0x20, 0x2A, 0xA2, 0xC8, 0x58,
+    0x14, 0x7E, 0x0E, 0xAB, 0x4D, 0x77, 0xA5, 0x73, 0x63, 0x45, 0x73, 0x0F, 0xCF, 0xB3, 0xCE, 0x4A,
+    0x1B, 0x0C, 0xF3, 0x0A, 0x44, 0xFC, 0x55, 0xC2, 0xE0, 0xB8, 0x7F, 0xB6, 0xE1, 0x37, 0xE2, 0x7E,
+    0xF5, 0xB7, 0x5E, 0x2C, 0x28, 0x51, 0x9F, 0xEC, 0x1A, 0x5C, 0xC1, 0x34, 0x81, 0x9A, 0x1C, 0x25,
+    0xE6, 0x60, 0x12, 0xAC, 0x7E, 0x40, 0x68, 0x9B, 0xA8, 0xB1, 0x32, 0xF0, 0xEC, 0x29, 0x28, 0x26,
+    0xD1, 0x5F, 0x30, 0xB9, 0x98, 0x15, 0x47, 0x47, 0x71, 0x29, 0x00, 0x33, 0xF6, 0x82, 0x02, 0x40,
+    0x24, 0x2B, 0x72, 0xC9, 0xCD, 0x8D, 0x1A, 0x80, 0x7E, 0xAD, 0x37, 0x0E, 0xC0, 0xEC, 0xE7, 0x66,
+    0xED, 0xF4, 0x67, 0x04, 0x48, 0xCA, 0x79, 0xF7, 0xBF, 0xDF, 0x6E, 0xA0, 0x57, 0xC3, 0xCB, 0xDB,
+    0x8C, 0x22, 0x36, 0x07, 0xCE, 0x1A, 0x9D, 0x00, 0x2A, 0xC4, 0x54, 0xC0, 0x99, 0x84, 0xF3, 0x1A,
+    0xE9, 0x6E, 0x06, 0xA4, 0xD9, 0x4F, 0xA5, 0xBB, 0x09, 0x94, 0x98, 0xFF, 0x03, 0xA7, 0xBB, 0xA1,
+    0x4D, 0x2A, 0x6D, 0x0F, 0x75, 0x99, 0x35, 0x88, 0x7F, 0xF7, 0x03, 0xB9, 0x4F, 0x9C, 0xFE, 0x89,
+    0x3E, 0xD4, 0x87, 0xCB, 0xB0, 0xD2, 0xB8, 0x22, 0xB1, 0x62, 0xFD, 0x2F, 0x48, 0x3A, 0xD1, 0x3C,
+    0x22, 0x53, 0x82, 0x85, 0x28, 0xF7, 0xC5, 0x80, 0x03, 0x90, 0xF3, 0x77, 0xCC, 0xF6, 0x15, 0x25,
+    0xB6, 0x3A, 0x93, 0xDE, 0x1B, 0x53, 0xA0, 0xBF, 0xA2, 0xEE, 0x0A, 0xDD, 0x42, 0xA2, 0xEE, 0x0E,
+    0x60, 0x4A, 0xDC, 0x6A, 0x29, 0x95, 0x5E, 0x66, 0x16, 0xA9, 0x3B, 0x40, 0x4C, 0x0A, 0xDC, 0xCC,
+    0xF3, 0xBA, 0x9B, 0xC7, 0x9B, 0xC9, 0xAD, 0x5B, 0xFC, 0x84, 0x31, 0x18, 0x5E, 0x69, 0xDF, 0xE0,
+    0xDC, 0xA7, 0xA0, 0x76, 0x75, 0xF4, 0x3C, 0x9C, 0x1A, 0xD1, 0x69, 0xD0, 0x8D, 0x0E, 0x3A, 0x7C,
+    0xF0, 0xBC, 0xF7, 0x73, 0x34, 0xC9, 0x39, 0x38, 0x02, 0xA9, 0x05, 0xED, 0x14, 0xC9, 0x60, 0xAC,
+    0x1C, 0x62, 0xF8, 0xB5, 0x92, 0x70, 0xA7, 0x87, 0xAE, 0xA7, 0x67, 0xCC, 0xF2, 0x11, 0xFD, 0xCB,
+    0xA6, 0x22, 0x8C, 0xC3, 0x6C, 0x76, 0x50, 0x5A, 0xC4, 0x76, 0x7B, 0x9C, 0x1F, 0x3D, 0xB2, 0x1B,
+    0x85, 0x78, 0x15, 0xE6, 0xC9, 0x23, 0x8D, 0x48, 0x39, 0x29, 0xFE, 0x5D, 0xC8, 0xCF, 0x9F, 0xD2,
+    0xC1, 0x6C, 0x4C, 0xA8, 0xBE, 0xDE, 0x46, 0xCB, 0x26, 0x6A, 0xB7, 0x22, 0xEB, 0xD1, 0x82, 0x72,
+    0x20, 0x52, 0xF1, 0x13, 0xB8, 0x60, 0x09, 0x23, 0x50, 0x60, 0xB7, 0x40, 0x95, 0xD0, 0xB3, 0x32,
+    0xC6, 0x37, 0x20, 0xE5, 0xE1, 0x5D, 0x23, 0xE7, 0xDF, 0x73, 0xFC, 0x3B, 0xDE, 0x39, 0x91, 0xEE,
+    0xD7, 0x02, 0x03, 0x85, 0xED, 0x1C, 0x86, 0xFC, 0x0D, 0xD3, 0x64, 0xF2, 0x57, 0xEC, 0x37, 0x09,
+    0x06, 0x81, 0x81, 0xD8, 0x1C, 0xCB, 0xCD, 0x7B, 0x95, 0x18, 0x8D, 0x4B, 0xBD, 0xFC, 0x42, 0x6C,
+    0x60, 0x69, 0x1D, 0xA4, 0xA0, 0x4B, 0xB0, 0xC7, 0x07, 0xBC, 0x8A, 0x72, 0xB0, 0x3B, 0x4E, 0x17,
+    0xCE, 0x0D, 0x60, 0xA2, 0xE6, 0xA9, 0xE8, 0x13, 0x96, 0x7E, 0x33, 0xDB, 0x48, 0xE6, 0x0A, 0xFC,
+    0xBF, 0xDD, 0x2E, 0x75, 0x26, 0x58, 0xFE, 0xDA, 0xB8, 0xFD, 0xCC, 0xAE, 0x33, 0x1F, 0xE9, 0x4E,
+    0x68, 0xBF, 0xD2, 0x6A, 0xB3, 0xBB, 0x77, 0xB1, 0xFB, 0x78, 0xB2, 0x32, 0x22, 0xF9, 0xA2, 0x43,
+    0xFB, 0xBF, 0x70, 0x6F, 0x2E, 0x3C, 0xA3, 0xC7, 0xD5, 0x8F, 0x75, 0xEE, 0x66, 0x5E, 0x88, 0xE1,
+    0x98, 0x4B, 0x7D, 0x92, 0x5B, 0x98, 0x6E, 0x8B, 0x39, 0x08, 0xD3, 0x10, 0xC3, 0x51, 0xD9, 0x9A,
+    0x4B, 0x30, 0x97, 0x55, 0xFE, 0xF7, 0xF9, 0x17, 0xA5, 0x55, 0xBD, 0x72, 0xDE, 0x44, 0x14, 0xBD,
+    0xFA, 0x04, 0xA8, 0x50, 0xB1, 0x34, 0x54, 0x29, 0xF4, 0x08, 0x7A, 0x84, 0xFD, 0xC6, 0x14, 0x2E,
+    0x5C, 0x24, 0x05, 0x26, 0xCF, 0xC0, 0x50, 0xE4, 0x11, 0x24, 0x48, 0x49, 0x41, 0x3A, 0xDE, 0xC1,
+    0x8D, 0x1F, 0x61, 0x15, 0x5C, 0xB8, 0x48, 0x81, 0x86, 0x0C, 0x34, 0x14, 0x88, 0x00, 0xC3, 0x4C,
+    0x52, 0xB0, 0x4C, 0x04, 0x28, 0xF6, 0x4A, 0x97, 0x73, 0xEE, 0xCA, 0xA1, 0xA0, 0x44, 0x9F, 0xBF,
+    0xD5, 0x7E, 0xFB, 0x73, 0xF7, 0xEC, 0xB9, 0xE7, 0x1E, 0x8B, 0xE4, 0x27, 0x2C, 0x68, 0x3A, 0x45,
+    0xE3, 0x75, 0x10, 0x69, 0x35, 0x8A, 0xB8, 0xBF, 0x56, 0x91, 0x3A, 0x85, 0x5E, 0xAA, 0xB5, 0x99,
+    0xA4, 0xD4, 0xD3, 0x24, 0x85, 0x2A, 0x16, 0xA1, 0x19, 0x24, 0xA8, 0xCE, 0xE2, 0x5F, 0xDD, 0x6E,
+    0xE2, 0x5F, 0xAF, 0xA1, 0x6F, 0x66, 0x6D, 0xA3, 0x4B, 0xDD, 0x75, 0xAA, 0xD7, 0x76, 0xD2, 0x52,
+    0xDD, 0xE2, 0xBF, 0xD5, 0x72, 0x75, 0x8B, 0xE0, 0xEF, 0xA0, 0x13, 0xA2, 0x60, 0x67, 0x42, 0xF7,
+    0x88, 0xBD, 0xE8, 0x0E, 0x76, 0x96, 0x8F, 0x78, 0xCD, 0x5C, 0xD3, 0xFC, 0xBD, 0x72, 0x8D, 0xC3,
+    0x89, 0x07, 0x45, 0xAF, 0x9D, 0xB0, 0xA6, 0xD4, 0x2A, 0x89, 0xFF, 0xF3, 0x63, 0xFD, 0x4C, 0xA5,
+    0x51, 0x3E, 0x43, 0x65, 0xAF, 0x78, 0xB0, 0xD7, 0x2A, 0xFA, 0x12, 0x48, 0xF4, 0xE8, 0xA7, 0xE6,
+    0x8D, 0xA2, 0x99, 0xB1, 0xFF, 0xD9, 0x52, 0xAF, 0xD5, 0xD6, 0xBE, 0x00, 0x0A, 0xE2, 0x08, 0x83,
+    0x3E, 0xD5, 0xC7, 0x6B, 0x13, 0xFD, 0x84, 0x4E, 0x95, 0x9A, 0x39, 0x4C, 0x18, 0x3B, 0x4B, 0x1E,
+    0x23, 0xFE, 0xB9, 0xB6, 0x8B, 0xC3, 0x47, 0xBF, 0x49, 0xE5, 0x5A, 0x6E, 0x3B, 0x21, 0x07, 0x22,
+    0x8C, 0x84, 0xE5, 0x74, 0x14, 0x3F, 0x82, 0x9C, 0xBE, 0x50, 0x29, 0xB7, 0x0D, 0x94, 0x48, 0xFB,
+    0x1A, 0x5F, 0xC0, 0xBB, 0x1F, 0x45, 0x7B, 0x97, 0x3C, 0x60, 0xF2, 0x39, 0x1A, 0xC2, 0x8D, 0xD4,
+    0xA8, 0x2E, 0xA5, 0x5E, 0x68, 0xD0, 0xE8, 0xE6, 0x3A, 0x69, 0x37, 0xF8, 0xA1, 0xFB, 0x2D, 0x69,
+    0x01, 0x40, 0xED, 0xCF, 0x6B, 0xBD, 0x80, 0xAE, 0xFB, 0x0B, 0xF0, 0x5C, 0x91, 0xAC, 0x33, 0x60,
+    0x0B, 0xD7, 0x80, 0xD3, 0x3D, 0xC5, 0xB1, 0x85, 0xED, 0x96, 0xDA, 0x6E, 0x89, 0x54, 0x30, 0x30,
+    0x38, 0xE2, 0x98, 0xE8, 0x77, 0x0F, 0xB5, 0xC7, 0x8A, 0x63, 0x93, 0x04, 0x19, 0x21, 0x89, 0x60,
+    0xCA, 0xE1, 0x07, 0xA0, 0xF2, 0x87, 0x34, 0xB7, 0xC9, 0xE0, 0x33, 0x83, 0x39, 0x47, 0x16, 0x09,
+    0xAF, 0xEE, 0x96, 0x83, 0x20, 0x24, 0x85, 0x41, 0x9A, 0xB9, 0xFB, 0x09, 0x61, 0xF5, 0x6B, 0x3D,
+    0x05, 0xEB, 0x9B, 0x03, 0x29, 0x48, 0x05, 0x09, 0x29, 0xB4, 0xD7, 0x81, 0xB7, 0xAA, 0x36, 0xB0,
+    0xE1, 0x63, 0x3B, 0xBB, 0x05, 0x39, 0xD3, 0xC1, 0x23, 0xBD, 0xFB, 0x91, 0x7C, 0x0A, 0xBB, 0x2A,
+    0xE1, 0x8D, 0x92, 0x01, 0x2F, 0x15, 0xD8, 0xF3, 0x03, 0x01, 0x32, 0x79, 0xE2, 0x6E, 0x17, 0x5B,
+    0x26, 0x54, 0x4C, 0xA2, 0xB4, 0xC8, 0x28, 0x15, 0x54, 0xA8, 0xFF, 0x01, 0xE7, 0x3D, 0x4F, 0x5D,
+    0x5F, 0x25, 0x7F, 0xB5, 0x08, 0xB4, 0xE5, 0x07, 0x90, 0xF0, 0x18, 0x39, 0x70, 0x33, 0xB8, 0x1A,
+    0xB4, 0x4C, 0xBC, 0x93, 0xB1, 0x30, 0x12, 0x93, 0x25, 0x1B, 0x60, 0x4C, 0x03, 0xC0, 0x11, 0x8C,
+    0x1E, 0x1F, 0xCB, 0xED, 0xFC, 0xD1, 0x4A, 0x2E, 0xD0, 0xC5, 0x8D, 0x3A, 0x5C, 0xE0, 0x18, 0x46,
+    0xA9, 0xA9, 0xA4, 0x76, 0x31, 0x9D, 0x75, 0xD7, 0x00, 0xE6, 0xD6, 0xF3, 0x87, 0x6A, 0xE4, 0x69,
+    0xE6, 0x23, 0xCB, 0x29, 0x4A, 0x16, 0x12, 0xA5, 0x78, 0x73, 0x69, 0x87, 0x94, 0x48, 0xD3, 0x17,
+    0xAB, 0x9F, 0x10, 0xCB, 0x47, 0xBD, 0x52, 0xC4, 0x22, 0xC7, 0x50, 0xAA, 0x9A, 0x92, 0x14, 0x91,
+    0x9B, 0xA5, 0x59, 0x5A, 0x0C, 0x5C, 0xE9, 0x41, 0x4F, 0x20, 0xCD, 0xA5, 0x03, 0x79, 0x2D, 0x44,
+    0x79, 0xB6, 0x96, 0x18, 0x02, 0x18, 0x1D, 0xBA, 0xA9, 0x9D, 0x91, 0xEE, 0xB9, 0xDE, 0x00, 0x69,
+    0xD7, 0x95, 0xB4, 0x91, 0xA9, 0x1C, 0xA0, 0x38, 0xBC, 0x26, 0x28, 0x8E, 0x18, 0xA0, 0x2C, 0x28,
+    0x24, 0x4A, 0x18, 0xEA, 0x19, 0x51, 0x41, 0xDE, 0xD6, 0x98, 0xF8, 0xFC, 0x8F, 0xCC, 0x98, 0xE1,
+    0xCD, 0xB8, 0xFB, 0x2C, 0xAE, 0x98, 0xC1, 0x6E, 0xE2, 0x66, 0xF7, 0xC7, 0x06, 0xFD, 0xA5, 0x7A,
+    0x09, 0x5F, 0x22, 0x4E, 0x99, 0xC0, 0xAA, 0x84, 0xCF, 0x37, 0x17, 0x01, 0x62, 0x82, 0xDA, 0xFD,
+    0xE8, 0x66, 0xFC, 0xAE, 0x67, 0x76, 0xF5, 0x84, 0x02, 0xFF, 0x40, 0xEE, 0x8D, 0x52, 0xA4, 0x1A,
+    0xFD, 0xFA, 0x85, 0x3E, 0x61, 0x66, 0x7A, 0xB1, 0x1A, 0x95, 0x22, 0x6C, 0x47, 0x32, 0xB2, 0x49,
+    0x4E, 0xAA, 0x33, 0x66, 0xBA, 0x63, 0xBB, 0xCA, 0x01, 0x72, 0xC1, 0x0A, 0x32, 0x2B, 0x92, 0x65,
+    0x40, 0x7E, 0xCF, 0x1F, 0x21, 0xC1, 0x2E, 0x33, 0x8B, 0xBD, 0x50, 0x04, 0xE6, 0x8B, 0x0B, 0xAA,
+    0x15, 0x23, 0x23, 0xDA, 0xCA, 0x8A, 0xAA, 0xA3, 0x20, 0x2B, 0xB5, 0xBD, 0x76, 0x10, 0x96, 0x7D,
+    0x8A, 0xE0, 0x85, 0x5D, 0x27, 0xF0, 0x30, 0x88, 0xE9, 0x17, 0x5C, 0xF7, 0x57, 0xDA, 0x50, 0x7C,
+    0xBB, 0xD1, 0x6F, 0x97, 0xB3, 0x91, 0x30, 0xF0, 0x98, 0xC4, 0x13, 0xEE, 0x34, 0x68, 0xCF, 0x47,
+    0x52, 0xCE, 0xF4, 0x96, 0xD4, 0xA0, 0x09, 0x1D, 0xA6, 0x3A, 0xEC, 0xBB, 0x47, 0x44, 0x7E, 0xAF,
+    0x20, 0xF8, 0xCB, 0x93, 0x6E, 0x91, 0x77, 0x90, 0x27, 0x96, 0xC8, 0xCC, 0xE3, 0x27, 0x5E, 0xB3,
+    0x47, 0x60, 0xAB, 0x24, 0x26, 0xE8, 0x3D, 0x0B, 0x1B, 0xC6, 0xBB, 0x06, 0xE0, 0x8B, 0x47, 0x19,
+    0xE0, 0xD1, 0x99, 0xFA, 0x14, 0x64, 0xF9, 0x9B, 0x07, 0x38, 0x81, 0x2B, 0x73, 0x73, 0x83, 0xB5,
+    0x76, 0x4E, 0xB3, 0x8B, 0x89, 0xC8, 0xE5, 0x7D, 0x5A, 0x19, 0x5D, 0xB1, 0x85, 0x40, 0x91, 0x57,
+    0x1D, 0x9A, 0xF9, 0x80, 0xE2, 0x97, 0x6E, 0x74, 0x89, 0x05, 0x85, 0xE4, 0xB0, 0x5B, 0x50, 0x3D,
+    0x7E, 0xAA, 0x13, 0xBB, 0x47, 0xD6, 0x1F, 0xEC, 0x05, 0x6A, 0xEF, 0x7D, 0xAC, 0xA0, 0x3A, 0xD0,
+    0xDC, 0xC6, 0x66, 0x41, 0x08, 0xD6, 0x1F, 0xCC, 0x0D, 0x23, 0x6F, 0xC2, 0xF7, 0x77, 0xEE, 0x97,
+    0xB5, 0x91, 0x25, 0xBC, 0x59, 0xBD, 0x33, 0x03, 0x74, 0x28, 0xB9, 0xE3, 0x10, 0xD7, 0xE8, 0xD9,
+    0x56, 0xEB, 0x2E, 0xBF, 0xEC, 0xF7, 0x3B, 0x81, 0xEF, 0x3E, 0x60, 0x6B, 0xFE, 0x21, 0xD9, 0xFB,
+    0x76, 0xA9, 0xE6, 0x05, 0x79, 0xF5, 0xBF, 0xD3, 0xAC, 0x8C, 0x13, 0x7A, 0x41, 0x18, 0xC2, 0xC8,
+    0xEA, 0x68, 0x67, 0xDA, 0x43, 0xBD, 0xD6, 0xA9, 0xDC, 0x0E, 0xFA, 0xA1, 0x5A, 0xED, 0x71, 0x1A,
+    0x5E, 0x36, 0xD1, 0x30, 0x38, 0x4D, 0xCB, 0xA9, 0xD6, 0x02, 0x85, 0x03, 0x9D, 0xDF, 0x4D, 0xF3,
+    0x83, 0x49, 0x70, 0xD1, 0xC2, 0x55, 0x5E, 0x69, 0x48, 0xB0, 0x58, 0xA6, 0xB7, 0xCE, 0x4E, 0xD7,
+    0xAA, 0x69, 0xC7, 0x12, 0xB6, 0x83, 0x3F, 0xA8, 0xBC, 0x55, 0x1E, 0x38, 0x33, 0x68, 0xF3, 0x7F,
+    0xA6, 0xF7, 0xA7, 0xD3, 0xE3, 0xAE, 0x94, 0x2C, 0x1D, 0x9F, 0x6D, 0x63, 0xAA, 0xE1, 0x9D, 0x2B,
+    0x0E, 0x61, 0x76, 0x5D, 0xC2, 0x9B, 0xB6, 0x37, 0x8B, 0xE1, 0x42, 0x88, 0x53, 0xF3, 0x19, 0x33,
+    0xDD, 0x68, 0x14, 0x5F, 0x59, 0x4B, 0x0A, 0x9A, 0x85, 0x84, 0x2A, 0xD7, 0x55, 0x4A, 0xAB, 0xF1,
+    0x70, 0x27, 0x6C, 0x19, 0x1C, 0x6C, 0x92, 0xE2, 0xF8, 0x1D, 0xBA, 0xF6, 0x96, 0x08, 0x6F, 0xE0,
+    0x1B, 0x35, 0x74, 0x46, 0xB1, 0x7C, 0xB2, 0x5B, 0x61, 0xC8, 0x3A, 0x8A, 0x95, 0x7E, 0x05, 0x22,
+    0xC7, 0x06, 0x4E, 0x42, 0x17, 0x01, 0x16, 0x22, 0xBC, 0x26, 0x05, 0xE4, 0xE1, 0xD9, 0x76, 0x71,
+    0xB9, 0x84, 0xF1, 0x40, 0x7B, 0x06, 0x97, 0xD1, 0x6D, 0x24, 0x69, 0x68, 0x72, 0xAD, 0xF0, 0x1F,
+    0xF1, 0x6A, 0xD2, 0xFF, 0x9F, 0xCF, 0x3F, 0xD5, 0x55, 0xBD, 0x8E, 0xE5, 0x34, 0x14, 0x3E, 0x49,
+    0x24, 0x22, 0x88, 0x84, 0x29, 0x68, 0x40, 0x42, 0x69, 0xA8, 0xB6, 0x20, 0x0D, 0x05, 0x0D, 0x72,
+    0xA8, 0x29, 0x66, 0x0A, 0x1A, 0xFA, 0x69, 0xA8, 0x78, 0x03, 0x12, 0xED, 0x16, 0x94, 0x0B, 0x4F,
+    0x00, 0x05, 0xD5, 0x36, 0x34, 0x94, 0x20, 0x07, 0xB6, 0x98, 0x72, 0x83, 0x78, 0x00, 0xA2, 0x65,
+    0xA5, 0x29, 0xB6, 0xD8, 0xA0, 0x09, 0x9A, 0xCC, 0xAC, 0xED, 0xC3, 0xF7, 0x39, 0xB9, 0x97, 0x2B,
+    0x5E, 0x00, 0x61, 0x69, 0x6E, 0x9C, 0x93, 0x63, 0xFB, 0xFB, 0x39, 0xC7, 0xA3, 0xBD, 0x88, 0x73,
+    0xB3, 0x64, 0xAA, 0x1E, 0x3F, 0x51, 0x45, 0x54, 0xDD, 0x20, 0x6E, 0xF9, 0x7C, 0x16, 0x3B, 0x97,
+    0x5E, 0x9A, 0x25, 0x53, 0x31, 0x5E, 0xBA, 0xB1, 0x0A, 0x62, 0x96, 0x42, 0xA5, 0x08, 0xB9, 0xB6,
+    0xA2, 0xAD, 0x0E, 0x62, 0x27, 0x37, 0x8A, 0x59, 0xED, 0x2C, 0x45, 0xAC, 0x17, 0x6C, 0xF5, 0xD0,
+    0x8B, 0x34, 0x57, 0x41, 0xA4, 0xBA, 0xC3, 0x56, 0x59, 0x44, 0xA2, 0x74, 0x48, 0x14, 0xA3, 0xA3,
+    0x48, 0xA1, 0xB3, 0xE0, 0x00, 0x24, 0x8A, 0x45, 0x22, 0x47, 0xD6, 0x6A, 0x2F, 0xEE, 0xB7, 0x88,
+    0x84, 0xB3, 0x55, 0x5C, 0xB0, 0x73, 0xA1, 0xCF, 0x74, 0x68, 0xD6, 0x5C, 0x45, 0x87, 0xCA, 0xE3,
+    0xD0, 0x7A, 0xC6, 0xFE, 0xDD, 0x2F, 0x3C, 0x13, 0x38, 0x8A, 0x00, 0x78, 0xE6, 0x26, 0x62, 0x8B,
+    0x17, 0xD8, 0xCD, 0x61, 0x79, 0x0E, 0xEC, 0x52, 0xEA, 0x24, 0x52, 0x2B, 0xB7, 0xE6, 0xFE, 0x6F,
+    0x7F, 0xFB, 0x08, 0xB1, 0x60, 0x11, 0x74, 0x5F, 0xE2, 0xB3, 0x99, 0x1D, 0xA2, 0xA1, 0xC2, 0xBB,
+    0xE9, 0x7F, 0x94, 0x93, 0xA1, 0xFF, 0xA9, 0x04, 0xF7, 0xBE, 0x06, 0x4E, 0x77, 0x89, 0xA9, 0x7E,
+    0x8C, 0x60, 0x34, 0x00, 0xE2, 0xCD, 0x28, 0xD9, 0x62, 0xFA, 0x23, 0xC4, 0x73, 0xD0, 0x68, 0x16,
+    0xED, 0x0B, 0x85, 0x50, 0x8D, 0x9E, 0x79, 0xD1, 0x5B, 0x3B, 0x57, 0x51, 0xDC, 0x60, 0xE7, 0x5C,
+    0x81, 0xA5, 0xF4, 0xC0, 0x57, 0xCF, 0x80, 0x62, 0x1F, 0x93, 0x00, 0xA0, 0x17, 0x01, 0xCC, 0xCC,
+    0x4B, 0xA2, 0xA1, 0x34, 0x8E, 0x60, 0x74, 0xA5, 0x50, 0xC4, 0x12, 0xE4, 0x5F, 0xA3, 0x23, 0xCE,
+    0x34, 0x1A, 0x65, 0x06, 0x47, 0xA1, 0xC7, 0xA9, 0x3D, 0x4E, 0x0B, 0x5D, 0xEA, 0x3D, 0xB7, 0xA6,
+    0x6D, 0xBB, 0x8A, 0x93, 0xD4, 0x09, 0x83, 0xAF, 0x10, 0xB1, 0xB4, 0x4C, 0x47, 0x3A, 0xA1, 0xA3,
+    0x1B, 0x4A, 0x7A, 0x89, 0x85, 0x1F, 0x29, 0xCC, 0xC1, 0x0B, 0x8E, 0x2F, 0x83, 0xD0, 0x65, 0xA6,
+    0x9A, 0x05, 0xB2, 0x52, 0x1B, 0x1D, 0xEC, 0x44, 0xFF, 0x89, 0x51, 0xF4, 0xBE, 0xB6, 0x86, 0xE0,
+    0xD7, 0x3C, 0x9A, 0x15, 0x69, 0xDC, 0xAA, 0xF2, 0x30, 0x06, 0xA9, 0x38, 0xA3, 0xBE, 0x8E, 0xD8,
+    0xB1, 0x17, 0xBB, 0x4A, 0xF7, 0xFB, 0xCC, 0x48, 0x81, 0x33, 0x94, 0x9C, 0xB5, 0xED, 0x02, 0xDE,
+    0x12, 0x73, 0x05, 0x30, 0x43, 0xFE, 0x20, 0x10, 0x19, 0xD8, 0xB8, 0xE0, 0x34, 0x47, 0x0F, 0x6A,
+    0x3A, 0x91, 0x6D, 0xCC, 0xCE, 0xF1, 0x57, 0xFD, 0xA3, 0x0B, 0x4F, 0x3C, 0xC8, 0xD0, 0x1E, 0x55,
+    0xF2, 0xC7, 0xB2, 0x39, 0x28, 0x83, 0xCF, 0xC7, 0x45, 0xE6, 0x18, 0x14, 0xFB, 0x6C, 0x7B, 0x7E,
+    0xB6, 0xBF, 0xA3, 0xBC, 0xA4, 0xF2, 0x2C, 0x23, 0x87, 0x7C, 0x37, 0xE4, 0xDA, 0x03, 0xDD, 0x0C,
+    0x1D, 0x50, 0x63, 0xFA, 0x1C, 0x98, 0x47, 0x18, 0xAA, 0x53, 0xED, 0x0B, 0x4A, 0x53, 0xFB, 0x24,
+    0x47, 0xB3, 0x16, 0x94, 0xA1, 0x88, 0x50, 0x85, 0x92, 0x0E, 0x0D, 0x3C, 0x2E, 0x21, 0xBB, 0xCF,
+    0xD9, 0x0C, 0xDD, 0xC4, 0xD4, 0x3F, 0xB5, 0x65, 0x9B, 0xAC, 0x99, 0x22, 0xC5, 0x8D, 0x5C, 0x71,
+    0x13, 0x04, 0x59, 0x1D, 0x56, 0x40, 0xB0, 0x6E, 0x4E, 0x46, 0xA1, 0x24, 0xF4, 0x05, 0x00, 0xBA,
+    0x48, 0xDE, 0x4A, 0xCD, 0x06, 0xD6, 0x05, 0x28, 0x75, 0x2B, 0x01, 0x06, 0x72, 0x21, 0xD6, 0x4F,
+    0xC8, 0x74, 0x3A, 0x70, 0x3A, 0x50, 0xCE, 0xF5, 0x50, 0x91, 0x3A, 0x1F, 0xE8, 0x86, 0xA3, 0x1A,
+    0xED, 0x21, 0x34, 0xEE, 0x21, 0xB7, 0x4F, 0xB2, 0x1F, 0x52, 0x9C, 0x4B, 0x4A, 0xD6, 0x5F, 0x9E,
+    0x8C, 0x48, 0x76, 0xB0, 0xBE, 0x22, 0xA6, 0xCE, 0x81, 0xCE, 0x74, 0x61, 0x57, 0x83, 0x2F, 0x6E,
+    0x76, 0xF4, 0xFA, 0x31, 0x76, 0x2C, 0xB4, 0x66, 0xEB, 0x7A, 0x47, 0xFF, 0xAE, 0x79, 0x84, 0x3E,
+    0xF1, 0x04, 0x49, 0x6F, 0x6A, 0x9F, 0xE0, 0xFF, 0xA1, 0x0C, 0x9C, 0x01, 0x48, 0xE3, 0x59, 0x4F,
+    0x3A, 0x75, 0xCB, 0x9B, 0xA8, 0x4A, 0xBD, 0xB9, 0x53, 0xF4, 0x2D, 0x46, 0x8F, 0x13, 0x71, 0x30,
+    0x7F, 0x5B, 0xF2, 0xFD, 0x8A, 0xEE, 0x24, 0x76, 0x5F, 0x9C, 0xD4, 0xFF, 0xAB, 0x84, 0x1A, 0x89,
+    0x1B, 0xDB, 0xC2, 0x99, 0x91, 0xF9, 0x23, 0x0B, 0x68, 0xD0, 0xAB, 0x6B, 0x45, 0x7D, 0x55, 0x01,
+    0xF5, 0x5C, 0xAF, 0xF8, 0xDC, 0x5D, 0x45, 0xC8, 0xF5, 0xCD, 0x82, 0x10, 0x3B, 0xEE, 0x2F, 0xDE,
+    0x05, 0x97, 0x51, 0xAA, 0x68, 0xC2, 0x4F, 0x6E, 0xE6, 0x9A, 0xDE, 0xF2, 0x48, 0xCB, 0x72, 0x4C,
+    0xDD, 0x57, 0xB1, 0xD8, 0xAA, 0x5D, 0xA3, 0x37, 0x76, 0xA9, 0x62, 0xBB, 0x6B, 0x97, 0x4A, 0xA5,
+    0x1C, 0x1A, 0x26, 0xC9, 0x5B, 0xEF, 0xBD, 0xB2, 0xE9, 0xBC, 0x6B, 0x9B, 0x2D, 0xBB, 0xFC, 0x7B,
+    0x69, 0x7D, 0x78, 0xB8, 0x38, 0x4F, 0xBB, 0xD7, 0xDD, 0xB2, 0x19, 0x61, 0x2B, 0x0A, 0x45, 0x49,
+    0x75, 0x31, 0x78, 0xB2, 0x93, 0x1B, 0x8D, 0x99, 0x2E, 0xEF, 0xC8, 0xFB, 0x9D, 0xDF, 0x7A, 0xD5,
+    0x2E, 0x5D, 0xB2, 0xCF, 0x3D, 0x4D, 0x7E, 0x66, 0xFA, 0x30, 0x19, 0x5C, 0xEA, 0x16, 0xAE, 0x6F,
+    0x37, 0x9B, 0xBB, 0xE7, 0x61, 0x33, 0xFD, 0xFB, 0x45, 0x5E, 0xFB, 0x0E, 0x1D, 0x4B, 0xDE, 0x23,
+    0x6D, 0x40, 0x0C, 0xAB, 0x9E, 0xA4, 0x5A, 0xAE, 0x22, 0x34, 0x81, 0x1B, 0x76, 0x71, 0x53, 0xC6,
+    0x0B, 0xEA, 0x67, 0x5C, 0xDA, 0x41, 0x9A, 0x50, 0xA0, 0xEF, 0x03, 0xEE, 0xE4, 0x4A, 0xD3, 0x40,
+    0x5D, 0x70, 0xCC, 0x7C, 0x5A, 0xFA, 0x5F, 0xE9, 0x58, 0x27, 0x27, 0xCE, 0x0F, 0x4C, 0xB2, 0xBD,
+    0x4D, 0x92, 0x33, 0x20, 0xC2, 0x68, 0xBA, 0x2C, 0x24, 0x7F, 0x30, 0x5E, 0xA4, 0x8B, 0x69, 0x53,
+    0xA0, 0xDE, 0x28, 0x7F, 0x20, 0x9B, 0x6A, 0xE9, 0xF1, 0xEE, 0x89, 0x16, 0x9F, 0xB6, 0xD9, 0x05,
+    0x3B, 0x7D, 0xEC, 0x52, 0x85, 0x41, 0x0C, 0x18, 0xE1, 0x4B, 0x8D, 0xB9, 0xDE, 0x8D, 0xAF, 0x3B,
+    0x9F, 0xEE, 0x3E, 0x3B, 0xB3, 0xA8, 0xF0, 0x9F, 0x27, 0x1D, 0xC0, 0x2B, 0x95, 0xCD, 0xDF, 0x4D,
+    0xF9, 0x23, 0x69, 0xD0, 0x4F, 0xB8, 0x71, 0xF4, 0x32, 0x80, 0x70, 0xA1, 0xBC, 0xFD, 0xDB, 0x7A,
+    0xED, 0x26, 0x74, 0xAF, 0xFE, 0xAA, 0x43, 0xB7, 0x1A, 0x65, 0x23, 0x41, 0xE3, 0x8D, 0x5C, 0x8F,
+    0x36, 0xB0, 0x70, 0xBB, 0x62, 0x47, 0xB7, 0x27, 0x8C, 0xFE, 0x07, 0xE3, 0x6F, 0x9D, 0x55, 0x3D,
+    0x8F, 0xDD, 0x44, 0x14, 0xBD, 0x63, 0x6F, 0xF6, 0x15, 0x53, 0x98, 0x02, 0xA1, 0x08, 0x50, 0xBC,
+    0x25, 0xA2, 0xC0, 0x6D, 0x0A, 0xA2, 0x71, 0x48, 0x49, 0xB1, 0x14, 0xA1, 0xA2, 0x48, 0x4D, 0x03,
+    0xFC, 0x80, 0x80, 0x2D, 0xA5, 0xA0, 0xDD, 0x1F, 0x91, 0x22, 0x3C, 0x8A, 0x34, 0x34, 0x48, 0x8B,
+    0xEC, 0x85, 0x8E, 0xCA, 0x22, 0x05, 0x05, 0x8D, 0x21, 0x11, 0x12, 0x8A, 0x90, 0x46, 0xC2, 0x85,
+    0x97, 0xB5, 0x7D, 0x39, 0x67, 0xE6, 0x79, 0xB3, 0x9B, 0x48, 0x08, 0x32, 0x7A, 0x6F, 0x66, 0x3C,
+    0x73, 0xEF, 0x9D, 0x73, 0xBF, 0x45, 0xD6, 0x91, 0xA9, 0xCE, 0x5C, 0x9D, 0xAA, 0xE7, 0x3A, 0x7F,
+    0x71, 0xA7, 0xC4, 0x92, 0xB4, 0xFE, 0xBA, 0x3C, 0x3F, 0x36, 0x8B, 0x64, 0x93, 0x64, 0x63, 0x31,
+    0x8A, 0xF3, 0xF8, 0x35, 0xBD, 0xD1, 0xDA, 0xE8, 0x3D, 0x2D, 0x71, 0x63, 0xE7, 0x6C, 0x96, 0x62,
+    0xC0, 0x31, 0xEE, 0x9A, 0x0E, 0x37, 0xDA, 0xA6, 0x8A, 0x63, 0x4C, 0xE0, 0x72, 0x1E, 0x53, 0xE3,
+    0x71, 0xEC, 0x7C, 0xAA, 0xAD, 0x9D, 0x45, 0xDB, 0x42, 0x85, 0x1F, 0xA2, 0x53, 0xA2, 0x75, 0x36,
+    0x59, 0xF5, 0x81, 0xD0, 0x69, 0x5B, 0xF5, 0xA2, 0xDF, 0xAB, 0xE2, 0x2E, 0xD5, 0xC3, 0xB3, 0x39,
+    0x1F, 0x21, 0xA7, 0xB9, 0x33, 0x68, 0x2B, 0xF9, 0xD9, 0x54, 0x3D, 0x5D, 0x44, 0x2A, 0xED, 0x03,
+    0x62, 0x12, 0x69, 0x09, 0xB2, 0xD1, 0xEA, 0x28, 0x62, 0xB5, 0xCB, 0x41, 0x25, 0x39, 0x44, 0x53,
+    0x2F, 0x37, 0x88, 0x76, 0xC4, 0x6E, 0xB6, 0xDB, 0x6D, 0xC9, 0x7B, 0x05, 0xB3, 0x14, 0x51, 0xDB,
+    0xBB, 0xEF, 0x64, 0x54, 0xB6, 0x3E, 0xB8, 0xFA, 0x9C, 0xA6, 0xF9, 0x60, 0x88, 0xA8, 0xEA, 0x80,
+    0xD3, 0xFD, 0xA6, 0xD0, 0x2B, 0xD1, 0xF7, 0x81, 0xBF, 0xCD, 0xA6, 0x82, 0x88, 0x5D, 0xCF, 0x6D,
+    0xA2, 0xEF, 0x29, 0x74, 0x02, 0xF2, 0x09, 0x2A, 0x55, 0x5D, 0x01, 0xE8, 0xB8, 0x6C, 0x4E, 0x74,
+    0xA2, 0x80, 0x43, 0xF5, 0x30, 0xC1, 0xDC, 0x34, 0x3F, 0xC3, 0x68, 0x67, 0x93, 0x36, 0x3D, 0xAC,
+    0xFC, 0x93, 0xAA, 0x48, 0xB3, 0x58, 0x1D, 0xC4, 0xA8, 0xCF, 0xB5, 0x06, 0xF4, 0xDA, 0x4D, 0x40,
+    0x46, 0xF1, 0xCF, 0x4C, 0xAD, 0xA7, 0x54, 0x02, 0x54, 0x8E, 0x0E, 0xC2, 0x04, 0x10, 0x5A, 0x7F,
+    0x5A, 0x42, 0x31, 0x29, 0x33, 0x0D, 0x24, 0x98, 0xC0, 0x8C, 0x99, 0x1A, 0x4B, 0x45, 0x8D, 0xE0,
+    0x1A, 0xF8, 0x74, 0x0E, 0x37, 0xB2, 0xDE, 0x38, 0xFF, 0xEC, 0x90, 0xE4, 0x4D, 0xF8, 0xD6, 0x72,
+    0x0F, 0xDF, 0x84, 0x03, 0xE9, 0x84, 0x41, 0x43, 0x15, 0xC1, 0x2E, 0xF9, 0xB4, 0xCA, 0x37, 0x91,
+    0xA1, 0x3B, 0x97, 0x32, 0xC5, 0x38, 0x40, 0x84, 0x28, 0x4D, 0x27, 0x1F, 0x97, 0x80, 0x09, 0xE8,
+    0xF4, 0xA1, 0x8E, 0x1B, 0xFD, 0x7D, 0x20, 0x38, 0x0A, 0x80, 0xE9, 0x03, 0x0F, 0x71, 0xC1, 0x9F,
+    0xD2, 0xEC, 0xFE, 0xDC, 0x57, 0x83, 0xC1, 0xAB, 0x0B, 0x58, 0x67, 0xB8, 0x64, 0xC2, 0x33, 0x60,
+    0x80, 0x97, 0x19, 0x40, 0xE1, 0x4F, 0x46, 0xB7, 0x32, 0x76, 0x3B, 0x3D, 0x84, 0x6E, 0x4A, 0x7B,
+    0xD9, 0x93, 0x63, 0x31, 0x43, 0x56, 0x4B, 0xF1, 0x98, 0x24, 0x54, 0xAC, 0xEA, 0x88, 0x15, 0x44,
+    0xAE, 0xA9, 0xC5, 0x9E, 0xCC, 0x57, 0x65, 0x34, 0xF7, 0x06, 0x07, 0x61, 0x67, 0xD4, 0x6A, 0xDA,
+    0x91, 0xA4, 0xD4, 0xF1, 0x18, 0x24, 0x79, 0x3D, 0x4A, 0xEA, 0x8D, 0xC8, 0xE7, 0x21, 0xD8, 0x2F,
+    0xFA, 0x3E, 0xFD, 0x75, 0xFB, 0xF5, 0xA2, 0x1C, 0x4B, 0x51, 0x8A, 0x09, 0x67, 0xAF, 0x02, 0xC5,
+    0xF0, 0x9A, 0xEA, 0x0F, 0x70, 0x86, 0x5B, 0xB2, 0x47, 0x7F, 0xC8, 0x77, 0x57, 0xE0, 0xD9, 0x5F,
+    0x9E, 0x1C, 0xA7, 0x83, 0x6D, 0xC5, 0x94, 0xEE, 0x44, 0x6F, 0xCE, 0x89, 0x6F, 0x6E, 0x01, 0xAF,
+    0xDC, 0x06, 0xDE, 0x53, 0xEA, 0xF7, 0x25, 0xC8, 0x9B, 0x44, 0x7F, 0x3C, 0x32, 0x0F, 0x2E, 0x85,
+    0x97, 0x1D, 0x77, 0x9B, 0x24, 0x26, 0x1D, 0xC6, 0xF5, 0x4D, 0xBD, 0x7B, 0x5E, 0xDE, 0xBA, 0x1C,
+    0x8B, 0x57, 0x82, 0x9D, 0x3F, 0xA4, 0x43, 0xB8, 0x63, 0xAC, 0xFC, 0x7D, 0x4C, 0x21, 0x4F, 0x7B,
+    0x79, 0x53, 0xF8, 0x5E, 0x6F, 0x11, 0x13, 0x7B, 0xD8, 0xEC, 0xC9, 0x2B, 0xF2, 0x3F, 0xC7, 0x1B,
+    0x43, 0x58, 0xCC, 0x92, 0xC6, 0x3C, 0x91, 0x66, 0xFA, 0x26, 0x8F, 0x95, 0xE1, 0xE6, 0x9F, 0xF2,
+    0x59, 0xD8, 0x75, 0x56, 0x5E, 0x7A, 0x84, 0xA8, 0x41, 0x7A, 0x23, 0xDE, 0x42, 0x90, 0x2E, 0x62,
+    0xBA, 0x6B, 0x94, 0x2E, 0x1E, 0xEE, 0x3C, 0xC2, 0xEE, 0x28, 0xB9, 0xCC, 0xB1, 0xFF, 0x64, 0xB7,
+    0x31, 0xE7, 0xC6, 0xB9, 0xF1, 0xD1, 0x6A, 0x9C, 0xF2, 0xDD, 0x17, 0x5E, 0x30, 0xE5, 0xBA, 0x3B,
+    0xBF, 0x5B, 0x6D, 0x29, 0x32, 0x9E, 0x67, 0x74, 0xA4, 0x3A, 0x90, 0x24, 0x0A, 0xB5, 0xB5, 0xB8,
+    0x78, 0x73, 0x57, 0x92, 0x23, 0x31, 0xB0, 0x68, 0xEA, 0xD7, 0x80, 0x0F, 0xC4, 0x01, 0x2F, 0x03,
+    0xC7, 0xF6, 0xAB, 0xC8, 0x03, 0x59, 0xA7, 0xFF, 0x3A, 0x36, 0xF7, 0xE3, 0xFA, 0x6D, 0x0C, 0x53,
+    0x08, 0x5B, 0x42, 0x12, 0x48, 0x88, 0xDB, 0x4F, 0xE2, 0xE5, 0xEB, 0xDD, 0xCB, 0xD9, 0x96, 0x90,
+    0x0C, 0xA7, 0x1B, 0xC1, 0x71, 0xB2, 0x53, 0x81, 0x39, 0x13, 0x54, 0x28, 0x7A, 0xD9, 0xAF, 0xA9,
+    0x02, 0x72, 0x06, 0x4B, 0x1A, 0x9F, 0x41, 0xDE, 0x5C, 0x8B, 0x86, 0x1B, 0xA2, 0x08, 0x10, 0xAE,
+    0x12, 0x93, 0xFE, 0x05, 0x5B, 0xAE, 0xE6, 0x7D, 0xBB, 0x96, 0x2D, 0xAD, 0x52, 0x5A, 0x0A, 0x5C,
+    0x42, 0x3A, 0x59, 0x7D, 0xA8, 0xB1, 0x87, 0xF0, 0x5D, 0x1B, 0x3B, 0xC9, 0xC5, 0x18, 0xCC, 0x06,
+    0xF8, 0xBE, 0x95, 0xAA, 0x45, 0x61, 0xC1, 0x2E, 0xE4, 0x39, 0x5B, 0x88, 0xA2, 0x14, 0xA2, 0xC4,
+    0x23, 0xA0, 0x21, 0x0F, 0x67, 0x9B, 0x09, 0x05, 0xDD, 0x0B, 0x6B, 0x2B, 0x8A, 0x20, 0x0A, 0xE2,
+    0x5F, 0x8B, 0xA4, 0x73, 0xA2, 0x87, 0x03, 0x4A, 0x71, 0x3E, 0x56, 0x14, 0x81, 0x86, 0x00, 0x11,
+    0x76, 0xCA, 0x46, 0xB4, 0xA0, 0xAA, 0x07, 0xBF, 0x7B, 0x84, 0xDE, 0x51, 0x1A, 0x75, 0x1E, 0xFC,
+    0x76, 0xD1, 0xB2, 0x40, 0x57, 0x42, 0x17, 0x80, 0x0B, 0x95, 0x95, 0x17, 0xE9, 0x3E, 0x49, 0x7E,
+    0x7A, 0x3B, 0x47, 0x68, 0x43, 0x7C, 0x43, 0x7E, 0xBD, 0x85, 0x77, 0x32, 0x9D, 0x50, 0xFE, 0x40,
+    0xDB, 0xC5, 0x24, 0x8C, 0x58, 0x63, 0xAC, 0xC4, 0x4A, 0x13, 0x4A, 0xDC, 0x2E, 0x7A, 0x43, 0xF8,
+    0xAE, 0x15, 0x34, 0xE6, 0x48, 0x0D, 0xE1, 0x4D, 0x4B, 0xD4, 0x3D, 0xAA, 0x56, 0xE8, 0x9D, 0x19,
+    0x8B, 0xA8, 0x79, 0x78, 0xFF, 0x62, 0x25, 0x51, 0xA0, 0xC7, 0x54, 0x78, 0x88, 0x73, 0x9E, 0xBD,
+    0xC4, 0x5B, 0xF2, 0xB0, 0x15, 0x76, 0x98, 0xB4, 0x05, 0x37, 0xFA, 0xE0, 0x40, 0x95, 0x7D, 0x12,
+    0x7B, 0x63, 0xE9, 0xFA, 0x0D, 0x3B, 0x0C, 0xEA, 0x68, 0xE5, 0x0B, 0x30, 0xA2, 0x18, 0x7D, 0xE5,
+    0xF4, 0x0C, 0x4D, 0x45, 0x1F, 0xB3, 0xC4, 0x52, 0x83, 0x0F, 0x20, 0x94, 0xF8, 0xA8, 0x40, 0x68,
+    0x1B, 0xAC, 0x0D, 0x41, 0x91, 0x94, 0xC8, 0xF7, 0x1F, 0xFC, 0x7B, 0xE4, 0xFC, 0x03, 0x8D, 0x55,
+    0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0xB6, 0xB5, 0x71, 0xE1, 0xC2, 0x15, 0x42, 0xCA, 0x16, 0xD3,
+    0xD3, 0xF8, 0x13, 0xC6, 0xA2, 0xA1, 0x5D, 0xA1, 0x5D, 0x5A, 0x28, 0x68, 0xA8, 0x52, 0xD3, 0x60,
+    0x23, 0x14, 0xD1, 0xA6, 0xA1, 0x0E, 0x05, 0x48, 0x68, 0x29, 0xF6, 0x13, 0x3C, 0x12, 0x45, 0x5A,
+    0x8B, 0x96, 0xE6, 0x15, 0xA9, 0x92, 0x22, 0x23, 0xE2, 0x48, 0xDE, 0xC5, 0xF6, 0xCD, 0x39, 0x77,
+    0x9E, 0x1F, 0x1B, 0x45, 0x41, 0x58, 0x7A, 0xA3, 0xF7, 0x3C, 0x33, 0xF7, 0x9E, 0x7B, 0xEE, 0xB9,
+    0xE7, 0x49, 0x3D, 0x8B, 0x64, 0xDA, 0x4B, 0xF6, 0xE8, 0xF6, 0x42, 0xBC, 0x6A, 0x5B, 0xAA, 0x46,
+    0x19, 0x54, 0xE5, 0x81, 0xDE, 0x3D, 0x91, 0x6A, 0x15, 0x11, 0x0D, 0x22, 0xF5, 0x76, 0x89, 0x73,
+    0x3A, 0x4B, 0x83, 0xFD, 0x5C, 0x55, 0x83, 0xBF, 0x1B, 0xD6, 0x42, 0x45, 0x0F, 0xDD, 0xA1, 0x54,
+    0x9C, 0xEB, 0xA2, 0x8E, 0xE5, 0x56, 0x2F, 0xA2, 0xA3, 0x86, 0x6E, 0x71, 0x38, 0xF3, 0x29, 0x3E,
+    0x07, 0x04, 0x9D, 0x0A, 0xD5, 0xE7, 0x22, 0x1F, 0x5D, 0x20, 0x0E, 0xF2, 0x95, 0x08, 0x9A, 0x6B,
+    0x2B, 0x0F, 0xF5, 0xC5, 0xCF, 0x95, 0xEA, 0x82, 0xDD, 0x4D, 0x6E, 0xB6, 0x6B, 0xBC, 0x3C, 0x66,
+    0xF3, 0x51, 0xC4, 0xE1, 0x24, 0xD3, 0x17, 0xA7, 0x97, 0x40, 0x87, 0xA8, 0x0B, 0xAE, 0xE8, 0x0F,
+    0xFA, 0x93, 0x46, 0x0D, 0xF5, 0xE2, 0x63, 0xA1, 0xCC, 0xF9, 0x87, 0x7E, 0xAF, 0x23, 0x60, 0xC7,
+    0x1A, 0x29, 0x81, 0x7F, 0x14, 0xB9, 0xC4, 0xBD, 0x5A, 0x6F, 0x91, 0x8F, 0xB8, 0x0D, 0xB3, 0x28,
+    0xBF, 0xFA, 0x37, 0x5F, 0xAA, 0x18, 0xD0, 0x72, 0x93, 0x66, 0x02, 0x14, 0xE4, 0xD1, 0xF0, 0xB9,
+    0xB6, 0x3E, 0x2E, 0x1A, 0xDC, 0xEC, 0x35, 0x96, 0x7A, 0xA3, 0x53, 0x6E, 0xC7, 0xB1, 0x4C, 0x4C,
+    0x3E, 0x89, 0xDB, 0x7E, 0x1D, 0x88, 0xA9, 0x6E, 0x01, 0x2A, 0x4B, 0xA8, 0x0C, 0xAB, 0x81, 0x4D,
+    0x64, 0x19, 0xDC, 0xB4, 0x83, 0xE7, 0x41, 0x2B, 0xF9, 0xD2, 0xE0, 0xBD, 0x7A, 0xBC, 0xF2, 0x0C,
+    0xE7, 0xF4, 0xA9, 0x4A, 0x05, 0xE2, 0x46, 0x24, 0x6E, 0x26, 0x1C, 0xC5, 0x3D, 0x7F, 0xC0, 0x0F,
+    0x17, 0xF9, 0x63, 0x11, 0xD6, 0x94, 0x39, 0x16, 0xF5, 0x17, 0x76, 0xFE, 0x46, 0x2F, 0xDC, 0xEA,
+    0xB5, 0xAF, 0xF4, 0x95, 0x06, 0x70, 0x85, 0xDA, 0x00, 0xEE, 0x20, 0xDD, 0x9F, 0xBA, 0x00, 0xFE,
+    0x99, 0xEF, 0x71, 0xA7, 0x0C, 0x4C, 0xDC, 0xA6, 0xC4, 0xDD, 0x01, 0x0B, 0x42, 0x0B, 0xAB, 0xDC,
+    0x21, 0x09, 0x1B, 0xCD, 0x75, 0x30, 0xD4, 0x3C, 0x52, 0xF3, 0x48, 0xB9, 0x08, 0x83, 0xB2, 0xBB,
+    0xB8, 0x3C, 0x90, 0x3E, 0x2B, 0xB6, 0x5E, 0xAF, 0x2E, 0xD3, 0x55, 0xEA, 0x03, 0xD7, 0xC6, 0xBD,
+    0x58, 0x0B, 0x5A, 0x7E, 0x78, 0x67, 0x93, 0xD4, 0x5F, 0x54, 0xFD, 0xE1, 0x9D, 0x13, 0x75, 0xFB,
+    0x43, 0x55, 0x18, 0x36, 0x3B, 0xCA, 0xC0, 0x6E, 0x32, 0x21, 0xD6, 0x54, 0x24, 0x11, 0xBA, 0xED,
+    0xFA, 0x89, 0xDD, 0xE6, 0x3D, 0x43, 0xC6, 0x2F, 0x16, 0x94, 0x10, 0xD2, 0xBD, 0x90, 0x34, 0x66,
+    0xC8, 0x48, 0xC1, 0xBB, 0xE7, 0x18, 0x6C, 0x11, 0xAA, 0x88, 0x42, 0x9E, 0x53, 0xA5, 0xFE, 0xCD,
+    0xD5, 0x45, 0xC2, 0x62, 0xC4, 0x59, 0x39, 0x86, 0x8F, 0x4B, 0x73, 0x24, 0x64, 0x4C, 0x4B, 0x47,
+    0x92, 0x3E, 0xD6, 0xAB, 0x36, 0xC5, 0xB3, 0x96, 0xD7, 0xEB, 0x5E, 0xA0, 0x2D, 0xA6, 0x05, 0x63,
+    0xDF, 0x62, 0xFE, 0x5B, 0x24, 0xE4, 0xB4, 0x32, 0x0A, 0x9B, 0xB8, 0x30, 0x52, 0x5F, 0xDD, 0xAF,
+    0x19, 0xE3, 0xD0, 0xE7, 0xDC, 0xC1, 0x91, 0xBE, 0x20, 0xB0, 0x84, 0xFD, 0xF0, 0x1E, 0x37, 0xE1,
+    0x98, 0xE4, 0x3F, 0xAA, 0x61, 0x21, 0xDD, 0xF8, 0x5E, 0x35, 0x99, 0x3E, 0x96, 0x34, 0xC7, 0xD4,
+    0x76, 0x6B, 0x6A, 0xE2, 0x12, 0x51, 0xCD, 0x30, 0x03, 0x4E, 0xB3, 0x20, 0x45, 0x6D, 0xCB, 0x0A,
+    0x1E, 0xAB, 0xD5, 0x71, 0x69, 0x28, 0x07, 0x14, 0xC2, 0x79, 0x4B, 0x18, 0x1A, 0xE6, 0xF7, 0x2C,
+    0x12, 0xCD, 0xE9, 0x4B, 0x6A, 0x12, 0xA8, 0xAD, 0x4D, 0xC2, 0xF0, 0xE8, 0x1C, 0x1A, 0x90, 0x5D,
+    0x1C, 0x4B, 0x07, 0xBC, 0x91, 0x7D, 0x64, 0xE5, 0x19, 0xC7, 0x9D, 0xB0, 0x9A, 0x98, 0x0A, 0x2A,
+    0xD4, 0xBC, 0xC5, 0x6C, 0xA7, 0xF5, 0x9C, 0xE1, 0x0D, 0xD6, 0xB2, 0x15, 0x18, 0xE9, 0xB6, 0x8B,
+    0xC3, 0xBD, 0x29, 0x7F, 0xB6, 0x9D, 0xAC, 0x81, 0xA4, 0x63, 0x8A, 0xBE, 0x3A, 0xD7, 0x1E, 0x04,
+    0x04, 0xCC, 0x78, 0xC8, 0xD8, 0x9B, 0x6E, 0x6B, 0x4F, 0x7A, 0x42, 0x01, 0x09, 0x2F, 0xC7, 0xAB,
+    0x47, 0x4F, 0x32, 0x4C, 0xDC, 0x4C, 0x4A, 0x2B, 0xA0, 0x08, 0xA4, 0xD4, 0x47, 0x22, 0x80, 0x5A,
+    0x34, 0x50, 0xAC, 0x85, 0x16, 0x5B, 0x95, 0x1A, 0xEB, 0x26, 0x53, 0x43, 0x3D, 0x0F, 0xCF, 0x6C,
+    0x6C, 0x9A, 0xD7, 0x9A, 0x5A, 0xD9, 0xBD, 0xFA, 0xC7, 0x24, 0x9C, 0xCC, 0x24, 0x75, 0xC1, 0x84,
+    0x2E, 0xC3, 0xCB, 0xD5, 0x06, 0xA2, 0x52, 0xFF, 0xDA, 0xEE, 0xC0, 0x13, 0x7F, 0xDC, 0x6C, 0x02,
+    0x3F, 0x5B, 0x8D, 0x36, 0x3F, 0x37, 0x91, 0xD2, 0xC8, 0x35, 0x0C, 0x81, 0xF1, 0xDD, 0x42, 0x0F,
+    0x0D, 0x40, 0x30, 0xD6, 0x73, 0x0E, 0x62, 0x50, 0x57, 0x87, 0x96, 0xC0, 0x17, 0x80, 0x19, 0xA1,
+    0x43, 0x65, 0x5E, 0xE5, 0xF6, 0x19, 0xB6, 0x30, 0xB2, 0x6B, 0xF5, 0x34, 0x4F, 0xF7, 0x77, 0x4E,
+    0x8A, 0x33, 0x30, 0xFB, 0x68, 0x7D, 0x63, 0x5F, 0x1F, 0xB6, 0x7E, 0x13, 0x7A, 0x0C, 0xF2, 0xC2,
+    0xDA, 0x82, 0x83, 0x91, 0x33, 0x75, 0xA9, 0x73, 0xFE, 0x54, 0xC1, 0x8F, 0xDE, 0xB6, 0x08, 0xE0,
+    0xA2, 0x9F, 0x19, 0x3A, 0x57, 0xD3, 0x60, 0x13, 0x7D, 0x64, 0xC7, 0x72, 0xFD, 0x5D, 0x6F, 0x96,
+    0xD4, 0x4F, 0x92, 0x6D, 0xCE, 0x61, 0x24, 0xF8, 0x3B, 0x7D, 0xC9, 0x74, 0x15, 0x54, 0x63, 0xDA,
+    0x04, 0x9F, 0x3D, 0x5F, 0xF8, 0xD9, 0x4D, 0x40, 0x96, 0xDD, 0x20, 0x96, 0xE8, 0xDD, 0x88, 0x6C,
+    0x1E, 0xEE, 0x8A, 0xF4, 0x53, 0x01, 0xF7, 0x45, 0xFA, 0x99, 0x42, 0xED, 0x16, 0xB9, 0x78, 0x07,
+    0xB3, 0x79, 0xD3, 0xC9, 0xB3, 0x38, 0x56, 0x71, 0xAF, 0x77, 0x2F, 0x73, 0x27, 0xE0, 0xB7, 0xE3,
+    0x8B, 0x73, 0x98, 0x7D, 0xB6, 0xDB, 0x7C, 0x4C, 0xBE, 0xFD, 0xAD, 0x74, 0x36, 0x8E, 0xA7, 0xC1,
+    0xB4, 0x05, 0x0C, 0x9D, 0x7D, 0x81, 0x9E, 0xA1, 0x8C, 0x16, 0xCB, 0x81, 0x7F, 0x2E, 0x78, 0xFF,
+    0x09, 0xD5, 0x0B, 0x67, 0xEB, 0xEF, 0x8F, 0x8C, 0x2D, 0xE8, 0xD7, 0xD7, 0x68, 0x6B, 0xDF, 0xBD,
+    0xC0, 0x91, 0x8E, 0x73, 0xDC, 0x31, 0xBA, 0xDD, 0x97, 0x73, 0x02, 0x29, 0x08, 0x2F, 0x67, 0xF0,
+    0xDC, 0x3C, 0xD7, 0x54, 0x65, 0x46, 0x14, 0x77, 0x9F, 0xB4, 0xE7, 0xEC, 0x17, 0x8E, 0xDE, 0xC8,
+    0xFF, 0x24, 0x90, 0xB7, 0xE6, 0xCF, 0x1D, 0x04, 0x02, 0x26, 0xCC, 0x4F, 0x1C, 0x6D, 0x81, 0x73,
+    0x00, 0x23, 0x07, 0xBC, 0xAB, 0xE1, 0x28, 0x76, 0x7E, 0xFC, 0xFC, 0xDD, 0xB5, 0x4E, 0x48, 0x7B,
+    0xA0, 0x73, 0x74, 0xFC, 0x63, 0x7B, 0x44, 0x47, 0x40, 0x5B, 0xCA, 0x98, 0x3E, 0x75, 0x44, 0x43,
+    0xA2, 0x70, 0x1A, 0x8B, 0x4D, 0xFE, 0xCF, 0xF3, 0x16, 0xA5, 0x55, 0xBB, 0x92, 0xDC, 0x44, 0x14,
+    0xBD, 0x33, 0x2A, 0x98, 0x2A, 0x2B, 0xE8, 0x04, 0x12, 0x12, 0x7D, 0x82, 0xFE, 0xC0, 0x3D, 0xE0,
+    0x0F, 0xC0, 0x01, 0x1B, 0x93, 0x10, 0x41, 0xB0, 0x3F, 0x40, 0x95, 0x06, 0x27, 0x4E, 0xF9, 0x04,
+    0x17, 0x19, 0xEB, 0x80, 0x4F, 0x90, 0xAA, 0x28, 0xCA, 0x01, 0x81, 0x05, 0x55, 0x44, 0x24, 0x43,
+    0xEA, 0x64, 0x45, 0x79, 0x28, 0xE4, 0x45, 0xEA, 0xC3, 0x39, 0xB7, 0x5B, 0x5E, 0x27, 0x44, 0xA8,
+    0x76, 0x5B, 0x23, 0xF5, 0xED, 0x7B, 0xCF, 0x39, 0xF7, 0x21, 0x0B, 0xB3, 0xB5, 0x17, 0xEB, 0xCE,
+    0x7B, 0x0C, 0x7B, 0x1C, 0xDB, 0xC5, 0xC2, 0xB2, 0xC3, 0x68, 0x71, 0x0A, 0xAB, 0x19, 0x4E, 0x38,
+    0xDB, 0x21, 0xD5, 0x30, 0x1A, 0x75, 0x13, 0x5F, 0xBC, 0xE0, 0xCF, 0x0A, 0xF1, 0x62, 0xD6, 0xFC,
+    0x83, 0x93, 0x59, 0x87, 0xC5, 0x6C, 0x0F, 0x9A, 0x59, 0x58, 0x31, 0x98, 0xC5, 0xD7, 0x38, 0xDA,
+    0x0E, 0x4F, 0x69, 0x57, 0xAF, 0xF2, 0x11, 0xA7, 0x76, 0xE6, 0xC1, 0x81, 0xC7, 0x2B, 0x18, 0x5D,
+    0x37, 0x33, 0xED, 0xC7, 0x7E, 0xAC, 0x00, 0xBE, 0x08, 0x58, 0xC2, 0x62, 0x8D, 0x1C, 0xF0, 0xD8,
+    0x91, 0x6B, 0x4D, 0x8F, 0x3A, 0xA6, 0x55, 0x1E, 0x09, 0x40, 0x3F, 0x89, 0x92, 0x57, 0xAF, 0x17,
+    0xF9, 0xB1, 0xC2, 0x29, 0x2C, 0x84, 0x5D, 0x81, 0xCB, 0x0E, 0xDF, 0xD0, 0xB6, 0x1F, 0xE9, 0xBF,
+    0x9D, 0xB8, 0x84, 0x85, 0x1E, 0x2B, 0xF4, 0x13, 0x9D, 0x82, 0xAE, 0xFA, 0xDB, 0xA5, 0x60, 0x0B,
+    0x8B, 0x90, 0x24, 0x42, 0xDB, 0xE1, 0x13, 0x3F, 0x13, 0x31, 0xC5, 0xA9, 0xC6, 0x4C, 0x1C, 0x58,
+    0x19, 0xAC, 0x75, 0x18, 0x9D, 0x22, 0xB5, 0x42, 0x41, 0x89, 0x48, 0x7A, 0x75, 0x80, 0xB6, 0xED,
+    0x7C, 0xF4, 0xAD, 0x6F, 0x08, 0xFB, 0x6C, 0xD4, 0xA3, 0xBD, 0x7C, 0xC1, 0x88, 0x71, 0xBA, 0xA3,
+    0x2A, 0x71, 0x02, 0xC4, 0x40, 0xDA, 0x74, 0x7F, 0x78, 0xF8, 0x5F, 0xC5, 0x04, 0x3F, 0xCA, 0x33,
+    0x5E, 0xAE, 0xF2, 0xF4, 0xC3, 0xAC, 0x55, 0xBC, 0x25, 0x87, 0xAB, 0x3A, 0x69, 0x15, 0xCF, 0x43,
+    0x6A, 0x16, 0xE9, 0xD7, 0xAE, 0x92, 0x35, 0xD2, 0x59, 0x58, 0xA2, 0x63, 0x7F, 0x48, 0x3F, 0xCD,
+    0xFC, 0xB5, 0x68, 0x5E, 0x3E, 0x20, 0xBB, 0xB8, 0xFD, 0x49, 0x64, 0xCB, 0xC2, 0xB9, 0x30, 0xDF,
+    0xE1, 0x54, 0xA5, 0x87, 0x12, 0xE6, 0x73, 0x91, 0xFC, 0x9D, 0x0B, 0xE9, 0xBB, 0x30, 0x23, 0xFD,
+    0x33, 0x6E, 0xCE, 0x5A, 0x7F, 0x3B, 0xBB, 0x30, 0x96, 0x25, 0x3B, 0xA4, 0x6E, 0xE1, 0xCE, 0x35,
+    0x59, 0xE0, 0xA5, 0xFC, 0xBF, 0xFE, 0x39, 0x91, 0xE7, 0x33, 0x0C, 0x87, 0xD5, 0x63, 0xA8, 0x5E,
+    0x66, 0x71, 0xEE, 0xA7, 0x7D, 0x9F, 0x3E, 0x86, 0xD2, 0xF8, 0x08, 0xC7, 0x03, 0x10, 0x92, 0xD5,
+    0x00, 0x2B, 0xE8, 0x7D, 0xBC, 0xE9, 0xC5, 0xF9, 0x97, 0x77, 0x39, 0xA7, 0x8D, 0xF3, 0xDE, 0xF3,
+    0x91, 0x83, 0x57, 0xE8, 0xA6, 0xAD, 0x9E, 0x36, 0xCE, 0xC1, 0x39, 0xD7, 0x0E, 0xA8, 0x2A, 0xEB,
+    0x89, 0x01, 0x77, 0xF4, 0x46, 0x6D, 0xBC, 0x36, 0xAD, 0x30, 0xE7, 0xB1, 0xF7, 0x3E, 0x53, 0x72,
+    0xE0, 0xC9, 0x61, 0x3D, 0x3E, 0xC0, 0xDD, 0x33, 0x23, 0x18, 0x91, 0x50, 0x12, 0xBE, 0xC2, 0xCD,
+    0xB1, 0xD4, 0x55, 0x3F, 0x12, 0xA1, 0x12, 0x4D, 0x97, 0x5C, 0x0E, 0xE9, 0x00, 0x1A, 0x11, 0xBB,
+    0xF5, 0xC2, 0x48, 0x0D, 0x4E, 0x16, 0x12, 0xA3, 0xF0, 0xF8, 0xC0, 0x1D, 0x71, 0xF0, 0x5C, 0xC5,
+    0x3F, 0xF9, 0x1C, 0x66, 0x46, 0x3B, 0x08, 0x17, 0xDB, 0x84, 0x20, 0x30, 0x90, 0xA9, 0xB4, 0x3E,
+    0xBA, 0x16, 0xAC, 0x60, 0xD2, 0x67, 0xA7, 0xE0, 0x54, 0xB3, 0xAC, 0x31, 0x1E, 0x68, 0x05, 0x6D,
+    0x7F, 0x78, 0xED, 0x04, 0x0E, 0xA9, 0x72, 0xAF, 0x4F, 0x24, 0x4A, 0x96, 0x26, 0xAA, 0x50, 0x73,
+    0x42, 0xB8, 0xDD, 0x9F, 0x37, 0x6D, 0x0C, 0x50, 0x32, 0xE3, 0xDF, 0x62, 0xB5, 0x6D, 0x37, 0xDE,
+    0x67, 0x8F, 0x5C, 0xCC, 0x41, 0xB6, 0x71, 0xD2, 0xAB, 0xA6, 0x38, 0x37, 0x0A, 0x49, 0x60, 0xDE,
+    0xB4, 0x6C, 0xE4, 0x41, 0xF2, 0x74, 0x97, 0x52, 0x12, 0x0E, 0xE4, 0x29, 0x59, 0xC5, 0xA5, 0x45,
+    0xE2, 0xEE, 0x97, 0xFD, 0x85, 0xE8, 0x33, 0x8C, 0x0A, 0xAE, 0xB8, 0x92, 0x6F, 0xDD, 0x6D, 0xDA,
+    0x40, 0xD4, 0x49, 0x72, 0x7A, 0x61, 0x18, 0x58, 0x03, 0x8C, 0xC1, 0x5A, 0x67, 0x06, 0x72, 0x37,
+    0x47, 0xEF, 0x66, 0xE2, 0x08, 0x9E, 0x98, 0x6E, 0x14, 0x0C, 0x15, 0x07, 0xCB, 0x84, 0x82, 0xB0,
+    0x87, 0x99, 0xAB, 0x20, 0x85, 0xCA, 0xAA, 0x2E, 0x99, 0xF2, 0xA8, 0xF1, 0x04, 0x7A, 0x1A, 0x85,
+    0xF3, 0x6C, 0xF8, 0xED, 0xAA, 0x3F, 0xB3, 0x15, 0xA8, 0x9A, 0xAF, 0xC3, 0xDE, 0xD7, 0x0A, 0x37,
+    0xCF, 0x59, 0xC4, 0x50, 0xFA, 0x48, 0x90, 0xEC, 0xEA, 0x55, 0x41, 0xE9, 0x2F, 0xAF, 0x7C, 0xC9,
+    0xB5, 0xF6, 0x80, 0x01, 0x6A, 0x9C, 0x80, 0xA4, 0x80, 0x58, 0x15, 0x10, 0x3E, 0x47, 0xC2, 0x3B,
+    0x6B, 0x33, 0xDF, 0x0F, 0x92, 0x3C, 0x5F, 0xCA, 0x7A, 0xDE, 0x66, 0x0A, 0x11, 0xD1, 0xB4, 0x3B,
+    0x33, 0x40, 0x7B, 0xD9, 0xA9, 0x8F, 0x4C, 0x83, 0xAA, 0x3C, 0xAC, 0x24, 0xCC, 0xDC, 0xE2, 0x22,
+    0x98, 0xDC, 0x51, 0x85, 0xC5, 0xBB, 0x9B, 0xCD, 0x4C, 0xD5, 0x75, 0x7F, 0x26, 0xE9, 0x01, 0x9F,
+    0xCA, 0xEC, 0x05, 0x77, 0x70, 0x3F, 0x49, 0xD2, 0xDB, 0x51, 0xE7, 0xD3, 0x2C, 0xBE, 0xDD, 0xD9,
+    0x7F, 0x9F, 0x25, 0x44, 0x21, 0x8C, 0x91, 0xA4, 0x95, 0x3D, 0x17, 0x0A, 0x59, 0xC7, 0x37, 0x57,
+    0x85, 0xB5, 0xF8, 0xAB, 0xF0, 0xDD, 0x66, 0xB0, 0x22, 0xA6, 0xC5, 0xBF, 0xAE, 0xAE, 0xE9, 0xAC,
+    0x21, 0x38, 0xD9, 0xC0, 0xDB, 0x20, 0x2B, 0x4A, 0x9B, 0x57, 0x37, 0xF0, 0xDA, 0xB1, 0xE6, 0xE2,
+    0x7A, 0xC8, 0x4F, 0x96, 0xD5, 0xFF, 0x8B, 0x9F, 0x2E, 0xDB, 0xB4, 0xD9, 0x26, 0x2C, 0xFF, 0x65,
+    0x53, 0x2E, 0x6E, 0x46, 0x06, 0xE3, 0x8C, 0x80, 0xEB, 0xD7, 0x83, 0xDF, 0x90, 0x53, 0x9D, 0x6E,
+    0x8E, 0xAE, 0x28, 0xA3, 0x3B, 0x3F, 0x57, 0xC7, 0x5C, 0x40, 0x7D, 0x38, 0x84, 0x8B, 0xFD, 0x22,
+    0x61, 0xF0, 0xEA, 0x79, 0xF2, 0x24, 0x75, 0xA3, 0x3E, 0x3A, 0x02, 0xD5, 0x94, 0x93, 0x47, 0x45,
+    0xDF, 0x4E, 0x3A, 0x6A, 0x7D, 0xAB, 0x3C, 0xA7, 0xC8, 0x7D, 0xD2, 0x94, 0x7B, 0x5B, 0xEE, 0x31,
+    0x07, 0x90, 0x10, 0x9A, 0x2E, 0x65, 0x3E, 0x9A, 0x17, 0xDE, 0xD9, 0xE7, 0x80, 0x87, 0x31, 0x9F,
+    0xFD, 0xF9, 0x2E, 0x4A, 0x8A, 0x80, 0x9F, 0x7C, 0x58, 0xEC, 0x24, 0x1D, 0x43, 0x4B, 0x35, 0x15,
+    0xA0, 0xEE, 0x2A, 0x09, 0x87, 0x9E, 0x55, 0xEF, 0x17, 0x82, 0xD4, 0xB7, 0x62, 0xC9, 0xC9, 0x08,
+    0x6B, 0x58, 0x72, 0x5E, 0xCA, 0x3D, 0x49, 0x38, 0xEA, 0x9B, 0x28, 0x81, 0xEB, 0x9C, 0xF5, 0xF4,
+    0x7B, 0x6E, 0x0A, 0xBF, 0x9A, 0x72, 0x8F, 0x65, 0x7C, 0xF7, 0x5E, 0x90, 0x8F, 0xF7, 0xFE, 0x3D,
+    0xB4, 0x9C, 0x34, 0xBF, 0x97, 0x46, 0xCE, 0xE6, 0xBD, 0x66, 0x82, 0xAA, 0xE8, 0xB1, 0xFD, 0xCF,
+    0xEB, 0x5F, 0xCD, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0xBD, 0xB6, 0x05, 0x5F, 0xE1, 0xC2, 0x15,
+    0x0D, 0x14, 0xEE, 0x69, 0xE6, 0x11, 0xC6, 0xA2, 0x49, 0x9B, 0x62, 0x29, 0xA8, 0x68, 0x68, 0xA8,
+    0xF2, 0x08, 0x9F, 0x45, 0x5E, 0x20, 0x6F, 0x90, 0x14, 0x54, 0xDB, 0xF0, 0x08, 0xF3, 0x91, 0x14,
+    0x94, 0xF9, 0xB4, 0x12, 0xBD, 0xA3, 0x95, 0x88, 0xB4, 0x14, 0xB8, 0x30, 0xC4, 0xC9, 0x8E, 0x7D,
+    0x38, 0xE7, 0xDA, 0x9B, 0x4D, 0x84, 0x84, 0x28, 0x19, 0xC9, 0xE3, 0xF1, 0xFC, 0xDC, 0x7B, 0xCF,
+    0xB9, 0xF7, 0x8C, 0xCD, 0xBC, 0x95, 0x00, 0x26, 0xB3, 0x86, 0xAF, 0xB3, 0x59, 0xE4, 0xCB, 0xAC,
+    0xC0, 0xCD, 0x4F, 0xD9, 0xAC, 0x5E, 0xEC, 0x38, 0x98, 0x85, 0xB1, 0x44, 0x67, 0x86, 0x53, 0xCD,
+    0xB9, 0x0A, 0x16, 0xFF, 0x7C, 0x68, 0xED, 0x6C, 0x3A, 0x96, 0xCE, 0x07, 0xBE, 0x38, 0x17, 0x80,
+    0xB1, 0xC9, 0x86, 0x1B, 0x0C, 0x71, 0xA8, 0x50, 0xE2, 0x67, 0x74, 0xCD, 0x5C, 0x41, 0x26, 0xCE,
+    0x4D, 0x8E, 0x32, 0x11, 0x46, 0x9C, 0xB4, 0xE7, 0x97, 0xD5, 0xE2, 0xC8, 0x33, 0x6A, 0xFC, 0x56,
+    0x4B, 0x83, 0xFA, 0x83, 0xE6, 0xCA, 0x2E, 0x69, 0x8E, 0xF1, 0x9C, 0x4C, 0xF1, 0x2C, 0x5A, 0xF1,
+    0xD8, 0x18, 0xEA, 0x64, 0x1F, 0xB7, 0x56, 0xF3, 0x49, 0xD3, 0x40, 0x56, 0xB7, 0xB2, 0xD3, 0x89,
+    0xE3, 0x6C, 0x17, 0x16, 0xE7, 0x12, 0x63, 0x9B, 0x2B, 0xA0, 0x59, 0xD8, 0x5D, 0xA3, 0xC0, 0xD3,
+    0x05, 0x3D, 0x9E, 0x23, 0x9D, 0xE3, 0x99, 0xC7, 0xDA, 0x31, 0x20, 0xD7, 0x99, 0xBE, 0x4A, 0x54,
+    0x2B, 0x4E, 0xE9, 0x39, 0xE2, 0xC8, 0x30, 0x5F, 0x2E, 0x75, 0x4E, 0x57, 0xC4, 0x90, 0x86, 0x38,
+    0x45, 0x8C, 0x35, 0xFE, 0xC0, 0x48, 0xEB, 0x58, 0x9F, 0x89, 0xA7, 0x6C, 0x47, 0xA7, 0xE9, 0xA2,
+    0xF6, 0x18, 0x3F, 0xE1, 0xF3, 0x4D, 0x47, 0xD2, 0x56, 0xC5, 0x72, 0x26, 0x17, 0x99, 0x50, 0x7E,
+    0xED, 0x0C, 0xC3, 0xE7, 0x4F, 0x42, 0x6E, 0xF1, 0x18, 0x0F, 0xB0, 0xC4, 0x11, 0x78, 0xB3, 0x36,
+    0x23, 0x8E, 0xAF, 0xD6, 0xE6, 0x76, 0x09, 0xAF, 0x90, 0xAE, 0x96, 0xF0, 0x7A, 0x6D, 0xAF, 0xB3,
+    0x96, 0x1E, 0xE3, 0x29, 0x86, 0x16, 0x58, 0xBA, 0xC4, 0xAE, 0xF0, 0x6C, 0x5C, 0xD4, 0xCB, 0x87,
+    0x60, 0x0F, 0x78, 0x2B, 0xC4, 0x44, 0xCB, 0x2C, 0x2D, 0x5B, 0xAA, 0x02, 0xFA, 0x47, 0x5D, 0x4B,
+    0xC7, 0x5D, 0x83, 0x3B, 0x06, 0x2B, 0xF4, 0xA2, 0x4C, 0xA1, 0x29, 0x7D, 0x16, 0xC4, 0x5A, 0xB3,
+    0xF8, 0x8A, 0xDD, 0xAD, 0xC4, 0xF1, 0x7E, 0x52, 0xDB, 0x93, 0x7F, 0xA3, 0xFB, 0xA2, 0xAB, 0xDC,
+    0x77, 0x94, 0x9F, 0x4A, 0x7E, 0xE8, 0xE3, 0xAD, 0xA8, 0xD6, 0xA9, 0x72, 0x96, 0x81, 0xA3, 0xDD,
+    0x7D, 0x37, 0x3A, 0x25, 0xE6, 0x2D, 0xCA, 0x54, 0x33, 0xDF, 0x47, 0xFB, 0x7D, 0xC7, 0x58, 0x33,
+    0x09, 0xC9, 0xAC, 0xB0, 0xF9, 0x80, 0xDF, 0x26, 0x45, 0xD8, 0x72, 0x6F, 0x9C, 0x36, 0xF7, 0xC7,
+    0x71, 0x0B, 0x30, 0xED, 0x8F, 0xC6, 0xC7, 0xA9, 0xE8, 0x23, 0x52, 0x4F, 0x98, 0x7D, 0xCD, 0xC7,
+    0x49, 0x0D, 0x74, 0xD5, 0x30, 0xD1, 0x35, 0x37, 0xD4, 0xA3, 0x7B, 0x3D, 0x60, 0xE0, 0x73, 0xB2,
+    0xC3, 0x7A, 0x57, 0x08, 0x2C, 0x40, 0x32, 0x87, 0x17, 0xCA, 0x92, 0x92, 0x34, 0x7D, 0xF6, 0xED,
+    0xFA, 0x75, 0xB7, 0xE1, 0x14, 0x62, 0xC7, 0xDE, 0x2A, 0xC0, 0x74, 0xDE, 0xBF, 0xBC, 0xF8, 0xE2,
+    0xA0, 0x7A, 0xEF, 0xBD, 0xDA, 0xED, 0x7E, 0xBB, 0x1B, 0x76, 0xE6, 0x92, 0x1F, 0xE6, 0x8E, 0x46,
+    0x64, 0x1C, 0x59, 0x08, 0x25, 0xFE, 0x93, 0x41, 0xB6, 0xEF, 0xEC, 0xD3, 0x87, 0x0C, 0x39, 0xCD,
+    0x8A, 0x15, 0x01, 0x57, 0x84, 0xD3, 0xDC, 0x02, 0xB4, 0x52, 0x60, 0x49, 0xF8, 0x9D, 0xAA, 0x58,
+    0x2B, 0x8C, 0x61, 0x2A, 0x71, 0x0A, 0xB9, 0x40, 0x17, 0xA9, 0xA6, 0x3E, 0x48, 0x52, 0xAE, 0x91,
+    0xE3, 0xE0, 0x23, 0x57, 0x62, 0xB5, 0x4A, 0x83, 0x9B, 0xA0, 0xB6, 0x11, 0x7A, 0x1F, 0xB5, 0x93,
+    0x8F, 0x4A, 0x98, 0x46, 0x8B, 0x8B, 0xAD, 0x21, 0x13, 0x42, 0x93, 0xB2, 0x9B, 0x28, 0x3D, 0xE9,
+    0xF7, 0x19, 0x92, 0xA0, 0x15, 0xFE, 0xB8, 0xDF, 0x01, 0xDB, 0x6C, 0x74, 0x19, 0x5A, 0xB5, 0x97,
+    0xDD, 0x97, 0x3D, 0xB1, 0x87, 0xBF, 0xD0, 0x95, 0xD2, 0x6C, 0xB3, 0xC8, 0xD9, 0x10, 0x47, 0x16,
+    0x19, 0xF5, 0x43, 0x00, 0x5F, 0xA1, 0xAF, 0x56, 0x66, 0xB4, 0xC9, 0xB4, 0x1E, 0x6E, 0x77, 0x76,
+    0x4C, 0xD2, 0xA8, 0xA4, 0x49, 0x97, 0x87, 0x32, 0xEE, 0xA9, 0x2D, 0xE4, 0xB3, 0xCE, 0xFF, 0x46,
+    0xF2, 0x5E, 0x3A, 0x04, 0x5A, 0xAF, 0x8C, 0x05, 0x2F, 0x56, 0x0B, 0xB3, 0x78, 0x28, 0xE5, 0x32,
+    0xF0, 0x86, 0x29, 0x38, 0xEC, 0xDA, 0x91, 0x16, 0x74, 0xB5, 0x50, 0x4D, 0xBD, 0xE1, 0xD1, 0x68,
+    0xCD, 0x1B, 0x69, 0x8F, 0x46, 0x6A, 0xCC, 0x8A, 0x42, 0x4A, 0xD0, 0x6D, 0xE6, 0x17, 0x56, 0xB7,
+    0x79, 0x74, 0x67, 0xAA, 0x33, 0x4F, 0xB4, 0xDC, 0x2B, 0x5D, 0x9E, 0x29, 0x0F, 0x81, 0xA1, 0x95,
+    0x84, 0x44, 0xB0, 0x27, 0x86, 0x0B, 0x27, 0x59, 0xD4, 0xB1, 0x4C, 0x05, 0x97, 0xDC, 0x86, 0xD9,
+    0x1C, 0xAF, 0xE1, 0x25, 0x3B, 0x07, 0x7C, 0x10, 0x58, 0x47, 0x4C, 0xC5, 0x74, 0x3B, 0xE4, 0x42,
+    0xDD, 0x65, 0x7A, 0xF7, 0xE3, 0x26, 0x54, 0xD5, 0x26, 0x17, 0x58, 0x34, 0xC5, 0x25, 0x6E, 0x9E,
+    0x7C, 0xA4, 0xCA, 0x6C, 0x1F, 0xE0, 0xDE, 0x80, 0xB3, 0x6B, 0x72, 0x25, 0xE4, 0x9E, 0x7A, 0x87,
+    0xCE, 0x8E, 0xA7, 0x85, 0xBD, 0x80, 0xB6, 0x0B, 0xBC, 0x41, 0xC9, 0x14, 0x7A, 0x83, 0xCB, 0x48,
+    0x1C, 0x26, 0xC1, 0x11, 0x7E, 0x3B, 0x7A, 0x39, 0x3B, 0xDD, 0x93, 0xA6, 0x74, 0x5B, 0x53, 0x23,
+    0x5B, 0x77, 0x89, 0x77, 0xCF, 0xF6, 0x8B, 0x60, 0x0B, 0xB8, 0x57, 0x11, 0x74, 0x5B, 0x81, 0x90,
+    0xB1, 0xBD, 0x62, 0xD2, 0x59, 0x50, 0x88, 0x98, 0x64, 0x72, 0x0A, 0xF2, 0x72, 0xD6, 0x4D, 0xD1,
+    0xCE, 0x62, 0xB4, 0x42, 0xF4, 0xDC, 0x89, 0x73, 0xAA, 0x63, 0xC3, 0xE2, 0x17, 0x7A, 0xF2, 0x0A,
+    0x8A, 0xD8, 0x7A, 0xDD, 0xDD, 0xC1, 0x17, 0x82, 0x33, 0xD5, 0x66, 0xC5, 0xEB, 0xF5, 0x64, 0xCD,
+    0xAA, 0x04, 0xD5, 0x50, 0x66, 0x58, 0x58, 0xB4, 0xE2, 0xEE, 0x89, 0x92, 0xEE, 0xF1, 0x83, 0xDC,
+    0xFB, 0xF9, 0xAD, 0x68, 0xF6, 0xFF, 0x45, 0xE5, 0xAA, 0xDF, 0x45, 0x96, 0xFE, 0xB1, 0xEC, 0x71,
+    0x74, 0x21, 0x33, 0xCC, 0x03, 0x8D, 0xE3, 0xC4, 0xC0, 0xEB, 0x25, 0xA8, 0x32, 0x5E, 0x7B, 0x6D,
+    0x0A, 0x73, 0xF0, 0x9F, 0x89, 0xFF, 0x2C, 0x1A, 0x19, 0x2A, 0x1C, 0x45, 0xF4, 0xBA, 0xD0, 0x6C,
+    0x05, 0x01, 0x4D, 0xD7, 0x34, 0xD0, 0xF2, 0x0E, 0x9F, 0x68, 0x09, 0xA2, 0xA0, 0xC1, 0x18, 0xF3,
+    0x46, 0xF1, 0xA6, 0x97, 0x83, 0x63, 0x4D, 0xA7, 0xF7, 0xEE, 0x3D, 0xAC, 0xD6, 0x7F, 0x55, 0x97,
+    0xF6, 0xFF, 0x6D, 0x7F, 0x03, 0xED, 0x55, 0xBD, 0xCE, 0xDD, 0x44, 0x10, 0x9D, 0x7B, 0xCD, 0xF7,
+    0x59, 0xC2, 0x85, 0x53, 0x90, 0x82, 0xA4, 0x70, 0x8F, 0x04, 0x7E, 0x02, 0x64, 0x23, 0x0A, 0x5A,
+    0x8A, 0x50, 0xF3, 0x08, 0x79, 0x84, 0xB5, 0x94, 0x82, 0x82, 0x82, 0x48, 0x94, 0x69, 0x28, 0xE9,
+    0xF2, 0x08, 0x36, 0x44, 0xA2, 0x49, 0x63, 0xE0, 0x01, 0x30, 0x84, 0x1F, 0x89, 0x06, 0xA3, 0x6F,
+    0x91, 0x1C, 0xE4, 0xEB, 0xC3, 0x39, 0xB3, 0xBE, 0xDF, 0x17, 0x81, 0xD2, 0x22, 0x0A, 0x56, 0xF2,
+    0x5C, 0xD9, 0xB3, 0x3B, 0x67, 0xCE, 0xD9, 0x99, 0xB9, 0x15, 0x80, 0x11, 0x1F, 0xD3, 0xC6, 0xF0,
+    0x8C, 0x76, 0xAD, 0x23, 0x2D, 0xCA, 0xF5, 0xF6, 0x87, 0xDB, 0x07, 0xEF, 0xC2, 0x32, 0xD8, 0x01,
+    0x9D, 0x61, 0xB0, 0x30, 0x5A, 0x33, 0x5B, 0x3D, 0x5B, 0xB5, 0x58, 0xB9, 0x5A, 0x71, 0x92, 0xEF,
+    0xC6, 0xDD, 0xD3, 0x3D, 0x69, 0xC7, 0x4B, 0xDD, 0xC1, 0xDD, 0x75, 0xDC, 0xDD, 0x39, 0xEE, 0x65,
+    0x82, 0x82, 0xB9, 0xED, 0x82, 0xEC, 0x58, 0xCB, 0xCE, 0xC6, 0xC5, 0x5D, 0x5C, 0x8C, 0xC0, 0xA5,
+    0x20, 0x5C, 0x0C, 0xC2, 0x55, 0xBF, 0xE8, 0xDE, 0xCC, 0x57, 0xC9, 0xCC, 0xC3, 0xB7, 0x3C, 0x5A,
+    0xFF, 0x41, 0xF3, 0xC9, 0xFA, 0x06, 0x7E, 0xFD, 0x14, 0xDC, 0xC9, 0x83, 0xDC, 0x18, 0xC6, 0xEC,
+    0x25, 0x2F, 0xD0, 0x0B, 0xB3, 0xC2, 0xD0, 0xAC, 0xFC, 0xAD, 0xC1, 0x48, 0x3D, 0x56, 0x26, 0xF6,
+    0x18, 0x16, 0xF0, 0x11, 0x86, 0x1C, 0x6D, 0x3F, 0xD9, 0x2B, 0x56, 0x46, 0xC1, 0xAD, 0x9E, 0x8C,
+    0xE7, 0x32, 0xD0, 0x90, 0xB1, 0x25, 0xCF, 0xF1, 0x73, 0x2B, 0x17, 0xCB, 0x4F, 0x4C, 0xE8, 0x88,
+    0x77, 0x9C, 0xB3, 0x14, 0x99, 0x5D, 0x10, 0x27, 0x9C, 0x27, 0x4F, 0xFB, 0x4F, 0x4F, 0x86, 0xAE,
+    0x4A, 0x2A, 0x0C, 0x95, 0xD8, 0x4B, 0x96, 0xC5, 0x6A, 0x3C, 0x3A, 0x99, 0xDD, 0x4A, 0x02, 0xE0,
+    0x1A, 0x8D, 0xF2, 0x9A, 0x15, 0x54, 0x8D, 0xD2, 0x48, 0x15, 0x80, 0x5F, 0x03, 0xE2, 0x59, 0x12,
+    0xDF, 0x9F, 0xF4, 0x0A, 0xE3, 0x59, 0xAD, 0x1B, 0x8F, 0x62, 0x91, 0x38, 0xA3, 0xE0, 0x4B, 0xB4,
+    0xE5, 0xD2, 0x50, 0x08, 0x5E, 0x73, 0x13, 0x9B, 0x29, 0x03, 0x53, 0xEC, 0xE7, 0x30, 0x57, 0x5B,
+    0x86, 0x47, 0x18, 0x1B, 0x6A, 0x7A, 0xC0, 0x86, 0xA1, 0xA0, 0xA0, 0x76, 0x21, 0x52, 0xBA, 0x3D,
+    0xE1, 0x32, 0x17, 0xC2, 0x66, 0x38, 0x09, 0x9A, 0xA9, 0xE5, 0xEB, 0xAE, 0x48, 0xA9, 0xEC, 0xC8,
+    0xD1, 0x2A, 0xC2, 0x1E, 0x05, 0x78, 0xE7, 0x21, 0xC1, 0xF3, 0x53, 0x25, 0xA2, 0x5E, 0x1A, 0x5E,
+    0x00, 0x22, 0x2F, 0x53, 0x2F, 0x61, 0xBE, 0x55, 0xC7, 0x30, 0xC5, 0x66, 0xEE, 0x47, 0x6A, 0x82,
+    0x2F, 0xE6, 0x30, 0xE1, 0x1B, 0xBE, 0xE0, 0xEA, 0x17, 0x56, 0xA6, 0x44, 0xE9, 0x65, 0x1A, 0xD5,
+    0x48, 0x81, 0x9F, 0x19, 0xBC, 0x7A, 0xC0, 0xC0, 0x25, 0xB3, 0xB6, 0x4A, 0x9C, 0x6A, 0xA6, 0x6D,
+    0x6F, 0xB1, 0xA2, 0x76, 0x9E, 0x6E, 0xAA, 0xF5, 0x4C, 0x36, 0x17, 0x6C, 0x2F, 0xB2, 0x02, 0xC4,
+    0x13, 0x5C, 0x54, 0x4B, 0xF3, 0xC3, 0x33, 0xBC, 0xB7, 0xBD, 0x1D, 0xE6, 0x70, 0xF5, 0x1D, 0x24,
+    0xF7, 0xC4, 0xF0, 0xDB, 0x01, 0xE8, 0xC7, 0x5C, 0x64, 0x2F, 0x67, 0xB2, 0xAA, 0x78, 0xEE, 0xF8,
+    0x3D, 0xF1, 0xDE, 0x94, 0x86, 0xAE, 0x1E, 0x03, 0x24, 0x8A, 0x82, 0x24, 0xBF, 0x56, 0x08, 0xE3,
+    0xEE, 0x48, 0xC0, 0x2F, 0x7A, 0xBE, 0xA2, 0x48, 0xCA, 0xBB, 0xF5, 0x6B, 0xCD, 0x69, 0x4E, 0x47,
+    0x3C, 0x2F, 0xD0, 0xF1, 0x4C, 0x3F, 0x79, 0x33, 0x30, 0xCF, 0xF2, 0x54, 0x6C, 0x0C, 0x7F, 0xF4,
+    0xD2, 0x50, 0xA3, 0xED, 0x9E, 0x45, 0x1E, 0xB5, 0x51, 0x76, 0xE3, 0xB1, 0x8B, 0x7B, 0x7B, 0x21,
+    0x1C, 0x04, 0xE1, 0xA4, 0x1D, 0xDB, 0x6F, 0x41, 0xD0, 0x55, 0x7C, 0xBD, 0xB5, 0xFE, 0x29, 0xBA,
+    0x8C, 0x85, 0xDC, 0x95, 0xEA, 0xAF, 0x80, 0xFB, 0xC4, 0x9D, 0xEA, 0x58, 0x82, 0x2D, 0xD4, 0x44,
+    0x22, 0x61, 0x28, 0x57, 0x6E, 0x67, 0xC5, 0x47, 0x4A, 0xC4, 0x2A, 0x3F, 0xA9, 0x29, 0x22, 0xB9,
+    0x61, 0x50, 0x83, 0xF0, 0xEA, 0xBC, 0x38, 0xC3, 0xD8, 0xCC, 0x47, 0xA4, 0x5E, 0xB9, 0x5E, 0x97,
+    0x58, 0x52, 0xCB, 0x91, 0x39, 0x99, 0xAD, 0x6E, 0x59, 0x1D, 0x15, 0xBA, 0x7E, 0xE6, 0x77, 0x0A,
+    0x81, 0x42, 0xCD, 0xDF, 0x3F, 0x40, 0x4B, 0x51, 0xBF, 0xC6, 0x70, 0xC0, 0x6F, 0x2B, 0xA6, 0xBB,
+    0xB8, 0xF2, 0x5E, 0x8F, 0xBD, 0xDB, 0x42, 0x76, 0xB2, 0xBB, 0xC0, 0x73, 0x95, 0xCF, 0xE4, 0xCD,
+    0xAD, 0xD0, 0x89, 0x09, 0x29, 0xAA, 0xEA, 0x59, 0x9B, 0xA9, 0xC3, 0xBB, 0xCB, 0x81, 0x9F, 0x7C,
+    0x3A, 0xD4, 0x8E, 0x7A, 0x14, 0x39, 0xE3, 0xF9, 0x4D, 0x6A, 0x5F, 0xB4, 0x9E, 0xDC, 0x1D, 0xFD,
+    0x04, 0xA5, 0x46, 0xE5, 0x5B, 0x1F, 0x0C, 0xDC, 0x38, 0xE2, 0x49, 0x0C, 0x73, 0xB1, 0xF6, 0xEA,
+    0xF9, 0xA7, 0xBF, 0xA3, 0xAB, 0xD7, 0x1E, 0xDB, 0x63, 0xBF, 0x7B, 0x8C, 0xD5, 0x9E, 0xC7, 0x9F,
+    0xEF, 0xEF, 0x6A, 0xA6, 0x56, 0x69, 0x16, 0x7B, 0x8D, 0x88, 0x3F, 0xDD, 0xF7, 0x30, 0x71, 0x8F,
+    0x68, 0x3D, 0x1E, 0xD2, 0x79, 0xDB, 0xFE, 0xEB, 0x82, 0xA4, 0xCD, 0x21, 0x45, 0x89, 0x7F, 0x1F,
+    0xA9, 0x96, 0x46, 0x6A, 0x72, 0xFF, 0x5B, 0xAA, 0xA5, 0x71, 0xDD, 0x8C, 0xE7, 0x51, 0x6A, 0x41,
+    0x39, 0x16, 0xEB, 0x75, 0x3E, 0xAF, 0x7E, 0x26, 0x3F, 0xE7, 0x8A, 0x9E, 0xC0, 0x24, 0x6A, 0xFC,
+    0xE8, 0x71, 0x25, 0x80, 0xAA, 0x5D, 0x7B, 0xCB, 0xFD, 0xD1, 0x28, 0x14, 0x31, 0x81, 0x9F, 0x1F,
+    0xF1, 0xD1, 0xDF, 0x84, 0xC8, 0x63, 0xF0, 0x41, 0x58, 0x30, 0x4B, 0x85, 0xE2, 0x5C, 0x37, 0xF8,
+    0x4D, 0xFD, 0xBF, 0xAE, 0xD7, 0x5F, 0x7D, 0x55, 0x3D, 0x8E, 0xE6, 0x54, 0x10, 0x6C, 0xFB, 0x83,
+    0xB1, 0x58, 0x07, 0x26, 0x21, 0x21, 0x79, 0x47, 0xF0, 0x11, 0x6C, 0xC4, 0x05, 0x26, 0x18, 0x12,
+    0x38, 0xC4, 0x1E, 0xC1, 0x5E, 0xB8, 0x00, 0x47, 0x98, 0x60, 0x13, 0x86, 0x3B, 0xF0, 0x2C, 0x6D,
+    0xB0, 0x21, 0xDE, 0x13, 0xAC, 0x23, 0x90, 0x26, 0x32, 0x92, 0x47, 0x78, 0x85, 0xED, 0xDE, 0xAA,
+    0x7A, 0xDE, 0x99, 0x11, 0x42, 0x58, 0x33, 0xFD, 0xBD, 0xCF, 0x76, 0xFF, 0x55, 0x55, 0xF7, 0x67,
+    0xF6, 0x74, 0x95, 0xCB, 0x65, 0xD3, 0x21, 0x4C, 0xF5, 0xA4, 0x43, 0x73, 0xEF, 0xE9, 0x51, 0xF4,
+    0x25, 0x1D, 0xBA, 0xC3, 0xFE, 0xEB, 0x2A, 0x57, 0xAB, 0x56, 0x6B, 0x16, 0xAB, 0x17, 0x6B, 0xA6,
+    0x8B, 0xF7, 0xB0, 0x99, 0xB7, 0x35, 0xE2, 0xC5, 0xA1, 0xDC, 0x32, 0x1F, 0xCC, 0xBC, 0x6F, 0xE6,
+    0x6A, 0x37, 0xCB, 0x1D, 0x47, 0x47, 0x82, 0xE2, 0xB8, 0x1C, 0x25, 0x13, 0x54, 0x5B, 0x58, 0xBA,
+    0x99, 0x89, 0x97, 0xF8, 0xC6, 0x5B, 0x26, 0xFE, 0xDB, 0xBB, 0x35, 0x25, 0x76, 0x04, 0x33, 0xBB,
+    0xE0, 0x53, 0xC5, 0xD5, 0x38, 0xF0, 0xD5, 0xDC, 0xFD, 0xF0, 0x91, 0x3E, 0x47, 0xF3, 0x17, 0xC3,
+    0x9B, 0xCF, 0xFE, 0x93, 0xA2, 0x79, 0xB1, 0x33, 0x8F, 0xC5, 0xA5, 0x9E, 0x03, 0x9C, 0x0A, 0xA4,
+    0x1B, 0x1A, 0x38, 0x75, 0xDB, 0x05, 0xB9, 0x27, 0x04, 0x1B, 0xAA, 0x35, 0x87, 0x53, 0xB3, 0x5B,
+    0x37, 0xE2, 0x5E, 0xEE, 0x13, 0xAA, 0xAA, 0x0E, 0x0B, 0xB0, 0x9B, 0xD5, 0xCA, 0xF4, 0xE2, 0xF6,
+    0xEA, 0x56, 0xCD, 0xC1, 0x47, 0x9F, 0xD5, 0x72, 0xC2, 0x12, 0x53, 0x29, 0xAC, 0x21, 0xB5, 0x7F,
+    0xF5, 0x5B, 0xFB, 0x0C, 0x8C, 0xAB, 0x9F, 0x69, 0xB3, 0xD7, 0x19, 0x52, 0xC5, 0xA1, 0xF0, 0x21,
+    0x20, 0xDF, 0x96, 0x3B, 0x60, 0x38, 0xD0, 0x7A, 0xF4, 0xF6, 0x73, 0x9F, 0xC3, 0x12, 0x8E, 0x6B,
+    0x54, 0x92, 0xFB, 0x85, 0x1D, 0xD7, 0xA8, 0xB5, 0x43, 0xF4, 0xCC, 0xBF, 0xF5, 0x8A, 0xD1, 0x03,
+    0xFA, 0x64, 0x5B, 0x39, 0x3F, 0x97, 0xB3, 0x71, 0xBE, 0x49, 0x24, 0x84, 0x40, 0x37, 0xF9, 0x8F,
+    0x09, 0xBD, 0x6A, 0x09, 0x0B, 0xDF, 0x7C, 0xE5, 0xDF, 0xC0, 0xE5, 0x6B, 0x9F, 0xEB, 0xB9, 0xF2,
+    0xDB, 0xDC, 0x77, 0xB4, 0x16, 0xDD, 0x1A, 0x6F, 0xC9, 0xC9, 0x0C, 0x1C, 0x8A, 0xDD, 0x80, 0xF8,
+    0x57, 0x2A, 0x33, 0x43, 0x30, 0x90, 0x06, 0xC6, 0x3A, 0x74, 0x3F, 0xE4, 0xA2, 0xAB, 0x12, 0x57,
+    0x89, 0x28, 0xB1, 0x54, 0x88, 0xA2, 0x5A, 0xFC, 0xF8, 0x5B, 0x67, 0x7E, 0xD0, 0x6C, 0xE1, 0x1F,
+    0xD2, 0xD2, 0xF9, 0x9E, 0x2A, 0xEC, 0x81, 0x3A, 0xCB, 0x6D, 0x78, 0xCE, 0x7C, 0x7C, 0xE9, 0x6D,
+    0xB9, 0x13, 0x50, 0xC0, 0x0E, 0x0A, 0x14, 0x12, 0xC5, 0xE0, 0x10, 0x56, 0x63, 0x55, 0x23, 0x32,
+    0xF1, 0x06, 0x32, 0x6D, 0x26, 0x79, 0x58, 0x29, 0x69, 0x91, 0x27, 0x12, 0x64, 0x9F, 0x59, 0x87,
+    0xE0, 0x08, 0x08, 0x54, 0xC0, 0xB5, 0x1A, 0x9F, 0xC8, 0xAE, 0x74, 0x71, 0xF3, 0x88, 0x76, 0x8D,
+    0xC0, 0x3D, 0xE1, 0x1D, 0x08, 0xE6, 0x90, 0x01, 0x85, 0xC1, 0xE2, 0x3B, 0x68, 0xA3, 0x9E, 0x9D,
+    0x69, 0x44, 0x38, 0x4C, 0x26, 0x1C, 0xE3, 0x59, 0x26, 0x5A, 0xF5, 0x08, 0x9F, 0xC3, 0xE2, 0x0C,
+    0xA5, 0xA2, 0xDF, 0x38, 0x66, 0x94, 0x28, 0xD0, 0x40, 0x49, 0x61, 0x2D, 0x0E, 0xF4, 0x2E, 0x92,
+    0xC9, 0x6D, 0x52, 0xD8, 0x64, 0x5F, 0x64, 0x08, 0x82, 0x8E, 0xD7, 0x53, 0x05, 0x35, 0x4F, 0x85,
+    0x4F, 0x4F, 0x93, 0xE0, 0x12, 0x45, 0xE2, 0x28, 0xE8, 0x0B, 0x01, 0xC2, 0x0B, 0xCD, 0xC3, 0x0F,
+    0xBB, 0xA9, 0xF9, 0xC1, 0x52, 0x12, 0x03, 0x46, 0x9A, 0x0C, 0xA2, 0x62, 0x94, 0x64, 0xCB, 0x74,
+    0x84, 0x20, 0xC1, 0x85, 0xFF, 0x66, 0xE2, 0xCB, 0xE0, 0x8D, 0xC2, 0x04, 0x6C, 0x46, 0x2D, 0x21,
+    0xEF, 0x4A, 0x4F, 0x3C, 0xA7, 0x67, 0x9C, 0xE8, 0x59, 0xEF, 0x56, 0x3F, 0xDC, 0x38, 0x71, 0xF0,
+    0xDF, 0x91, 0xBD, 0xF1, 0x05, 0xF4, 0x14, 0xEE, 0x95, 0xB3, 0xD8, 0x91, 0xAC, 0x97, 0x49, 0xB8,
+    0x1A, 0xA9, 0x04, 0x75, 0x6A, 0xF2, 0x6C, 0x90, 0x61, 0x79, 0x4B, 0x2D, 0xDB, 0xF7, 0xD7, 0xD4,
+    0x23, 0x1B, 0xEC, 0xC8, 0x70, 0x20, 0x7E, 0x17, 0xFF, 0x93, 0xD1, 0x66, 0xF8, 0x82, 0xC0, 0x03,
+    0xCF, 0xFB, 0x6E, 0x44, 0x24, 0x74, 0xC2, 0xD9, 0x02, 0xF2, 0x6C, 0x0C, 0x7F, 0x70, 0x40, 0x5B,
+    0x5C, 0x08, 0x98, 0xAC, 0xC2, 0x49, 0xB4, 0x43, 0x84, 0x77, 0x00, 0xAD, 0xF3, 0xF7, 0x90, 0x87,
+    0x6F, 0x60, 0x27, 0xFA, 0x2B, 0xAA, 0x50, 0x03, 0x9D, 0xE8, 0x1F, 0xA5, 0x68, 0xCA, 0x33, 0x2D,
+    0x02, 0x3D, 0xFA, 0x45, 0x4A, 0x05, 0x08, 0xE8, 0x96, 0xF3, 0xB9, 0xD0, 0x36, 0xC9, 0xCE, 0xBC,
+    0x09, 0x2B, 0x1D, 0xF3, 0x10, 0x59, 0x0F, 0x4B, 0xC1, 0x57, 0xBF, 0xBF, 0x8B, 0x58, 0x44, 0xB8,
+    0x46, 0xD9, 0x41, 0xE3, 0x34, 0x68, 0x86, 0x7A, 0x0D, 0x7E, 0x8B, 0xFE, 0x2F, 0x52, 0x2B, 0xBE,
+    0x56, 0xC9, 0x6E, 0x04, 0x05, 0xB6, 0xFC, 0x57, 0x42, 0x69, 0x99, 0xA9, 0x84, 0x52, 0xA3, 0x95,
+    0xA8, 0xBD, 0x45, 0x65, 0xD8, 0x75, 0x41, 0x0C, 0xA3, 0xF6, 0x55, 0x94, 0x08, 0xD2, 0x9E, 0xE8,
+    0xB4, 0xA6, 0xB2, 0xEB, 0x47, 0x89, 0xC4, 0x51, 0x50, 0x21, 0x87, 0x0F, 0xE5, 0x9E, 0x25, 0xF5,
+    0xB6, 0x32, 0x61, 0x45, 0x2D, 0xF5, 0xCA, 0xFA, 0x96, 0x82, 0x1A, 0xA2, 0x9C, 0xE6, 0xEA, 0xB8,
+    0x13, 0xAC, 0x71, 0x04, 0x0A, 0x71, 0x0C, 0xE4, 0x1E, 0x25, 0x71, 0xA9, 0x49, 0xB2, 0x70, 0xEC,
+    0x26, 0xEA, 0xC5, 0x64, 0xC4, 0x28, 0x07, 0xB8, 0xEF, 0x36, 0x2A, 0x71, 0xA1, 0xE1, 0xF8, 0xAA,
+    0xB2, 0x0F, 0x9F, 0xCA, 0x48, 0x88, 0xE2, 0xE5, 0x5C, 0x38, 0x10, 0x31, 0xCD, 0xE9, 0x09, 0x69,
+    0xEA, 0x5F, 0xE8, 0x3C, 0x7F, 0x0C, 0x88, 0x1F, 0xBE, 0x7B, 0xB9, 0x4A, 0xDA, 0x52, 0x97, 0x7B,
+    0xDA, 0x51, 0x03, 0xC1, 0x76, 0x31, 0x00, 0xDA, 0x11, 0xA0, 0x54, 0x00, 0x78, 0xA7, 0xC1, 0x3F,
+    0x19, 0x21, 0x7C, 0x1F, 0x6E, 0x18, 0xDF, 0x5D, 0x8F, 0xB5, 0xB4, 0xE1, 0xCE, 0xC7, 0x69, 0x8E,
+    0xC2, 0x7C, 0x96, 0x67, 0x9A, 0x10, 0x09, 0xD2, 0xD4, 0x5C, 0x2B, 0x5D, 0x48, 0xA9, 0x02, 0xF5,
+    0x7C, 0x43, 0x74, 0x27, 0xCA, 0x34, 0xC4, 0x89, 0x31, 0xAD, 0x34, 0x6A, 0x03, 0x0A, 0xEC, 0x85,
+    0x28, 0x75, 0xEC, 0x9A, 0x50, 0x38, 0xDC, 0xFF, 0x7A, 0x3A, 0x98, 0x1C, 0x04, 0x2A, 0x69, 0xF0,
+    0x8D, 0xA8, 0x62, 0x0D, 0x63, 0xB6, 0x67, 0xC2, 0x2A, 0x5D, 0x76, 0xC3, 0xA7, 0x92, 0x9E, 0xE9,
+    0xB2, 0xD8, 0x1F, 0x27, 0xE7, 0xC5, 0xEB, 0x84, 0x27, 0x4C, 0xB9, 0x0B, 0x3D, 0x69, 0x46, 0x50,
+    0x4A, 0x9C, 0x68, 0x1D, 0x86, 0xD2, 0x94, 0x3E, 0x05, 0x06, 0xC7, 0x65, 0xF4, 0x09, 0xBA, 0x11,
+    0x80, 0xAC, 0x6E, 0xD0, 0x06, 0x2D, 0xFD, 0x0F, 0x64, 0xF9, 0xF2, 0x89, 0xD2, 0xCB, 0x71, 0xF2,
+    0x5A, 0x71, 0xE3, 0x86, 0xB4, 0x79, 0x36, 0xAE, 0xC7, 0xF5, 0xAC, 0x85, 0x3F, 0x1E, 0xDA, 0x0F,
+    0x5A, 0x2F, 0xE7, 0xBE, 0xEA, 0x59, 0x6E, 0x6F, 0xFF, 0x73, 0x7D, 0x04, 0xB5, 0x55, 0xB1, 0x8E,
+    0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x28, 0x58, 0xC2, 0x85, 0x69, 0xA0, 0xA1, 0x70, 0x4F, 0xE3, 0x4F,
+    0x18, 0xAF, 0xB6, 0xA4, 0x20, 0xC5, 0x2E, 0x6D, 0x2A, 0x1A, 0x9A, 0x7C, 0xC2, 0x18, 0x28, 0xD2,
+    0xA6, 0x80, 0x8A, 0x26, 0x45, 0x1A, 0xD2, 0xEC, 0x17, 0xA0, 0xB1, 0xA0, 0xDC, 0x62, 0x1F, 0x50,
+    0xA6, 0x88, 0xA5, 0x10, 0x45, 0xDA, 0x14, 0x99, 0x05, 0x03, 0xDE, 0x30, 0xF6, 0xE1, 0xDC, 0x99,
+    0xF7, 0x96, 0x15, 0x42, 0x74, 0x58, 0x9A, 0xB1, 0xE5, 0x99, 0xB9, 0x3E, 0xE7, 0xDC, 0x73, 0xAF,
+    0x45, 0x78, 0x61, 0x68, 0x62, 0xBB, 0x08, 0xBE, 0x43, 0xDF, 0x2C, 0x36, 0x14, 0x38, 0x86, 0xD8,
+    0xD9, 0x4E, 0x06, 0xD5, 0x26, 0x3E, 0xB8, 0xD0, 0x6E, 0x06, 0x5F, 0x63, 0x67, 0x81, 0x58, 0x60,
+    0xC3, 0x58, 0xE3, 0xA3, 0x28, 0x77, 0x8E, 0x30, 0x88, 0x74, 0xB3, 0x18, 0x40, 0xC4, 0x22, 0xF0,
+    0x61, 0x13, 0x71, 0x98, 0xA4, 0x5E, 0x34, 0x6A, 0x2F, 0xD2, 0xCC, 0x22, 0x05, 0x57, 0xA5, 0x0B,
+    0x22, 0x86, 0xAB, 0xF2, 0xC1, 0x43, 0x4E, 0x0D, 0xD7, 0x2A, 0xEC, 0xC4, 0x6D, 0x7A, 0x50, 0x4A,
+    0x2C, 0x1C, 0x91, 0xAF, 0x27, 0x8E, 0xC0, 0x57, 0x83, 0x78, 0x0E, 0xC6, 0x35, 0x58, 0xB9, 0x33,
+    0x4A, 0xF7, 0x3A, 0xA4, 0x01, 0x3F, 0x0A, 0xDC, 0x58, 0xFF, 0xBE, 0x89, 0x59, 0xBD, 0xD8, 0x8B,
+    0x45, 0xDA, 0x5F, 0x62, 0xB9, 0x5A, 0x06, 0x3B, 0x0F, 0xCD, 0x95, 0x06, 0xEB, 0x46, 0xFF, 0x21,
+    0x83, 0x2D, 0xFE, 0x38, 0xDA, 0x49, 0xEC, 0x0F, 0x6B, 0xB7, 0x43, 0x5F, 0xA0, 0x9A, 0x51, 0x45,
+    0xA9, 0x63, 0xFB, 0x74, 0x26, 0x1A, 0x3B, 0x39, 0x3F, 0x6A, 0xB0, 0x1E, 0xAB, 0xD1, 0x60, 0x06,
+    0xA1, 0xB9, 0x3E, 0x69, 0x03, 0xB1, 0x39, 0x04, 0x3F, 0xDA, 0x58, 0x02, 0x5F, 0x6C, 0x82, 0x5D,
+    0x83, 0xD8, 0xCC, 0x86, 0x92, 0x10, 0x9E, 0x5E, 0x89, 0x90, 0xB2, 0x58, 0xF2, 0xDD, 0xEF, 0xD2,
+    0xAD, 0xDA, 0xBF, 0xB6, 0xF3, 0x7E, 0xD7, 0x98, 0x77, 0xAD, 0x72, 0xB8, 0x4A, 0xCC, 0xD2, 0x51,
+    0x63, 0x32, 0x27, 0x2D, 0x8B, 0xBE, 0x26, 0x59, 0x6A, 0xE6, 0x30, 0x56, 0x58, 0x54, 0xBD, 0x0E,
+    0x53, 0xCB, 0x4D, 0xF0, 0x03, 0x49, 0x9A, 0x15, 0xD5, 0x35, 0xA4, 0xFD, 0x35, 0xDA, 0xF3, 0x28,
+    0xEE, 0xE2, 0x6A, 0xB3, 0x53, 0xB9, 0xD9, 0x8B, 0xA0, 0x69, 0x82, 0x7B, 0x10, 0xC5, 0xFE, 0x88,
+    0xD8, 0x31, 0x5F, 0x35, 0x26, 0x0C, 0x75, 0xEC, 0x60, 0xF0, 0x4D, 0x37, 0xF9, 0xA5, 0xC1, 0x8C,
+    0xCF, 0x30, 0x3A, 0x7C, 0xBF, 0x56, 0x5B, 0xA9, 0x59, 0x51, 0x20, 0x41, 0x72, 0xB2, 0x13, 0xD8,
+    0x98, 0xB1, 0x86, 0x0C, 0xB5, 0x4F, 0x1B, 0xF2, 0x3B, 0xCD, 0x90, 0x4D, 0xF8, 0x56, 0x22, 0xA3,
+    0xF4, 0xF8, 0x99, 0x69, 0xE0, 0x11, 0x86, 0xA9, 0x49, 0xA6, 0x8E, 0x79, 0xAB, 0x0E, 0xBA, 0x46,
+    0x1D, 0x90, 0xE2, 0x1C, 0x86, 0x9B, 0xB2, 0x24, 0xCA, 0x9F, 0xA3, 0xE0, 0x07, 0x89, 0x2F, 0x85,
+    0xF2, 0x1C, 0xC0, 0x72, 0x23, 0x48, 0x3D, 0x1B, 0x06, 0xA9, 0x17, 0xF5, 0x4B, 0xB5, 0x9D, 0x05,
+    0x95, 0x08, 0xAA, 0xA6, 0xDB, 0xE4, 0x1F, 0x97, 0x4F, 0xAA, 0xA6, 0xB3, 0x6A, 0x15, 0x49, 0xAE,
+    0x20, 0x88, 0x3F, 0x75, 0x6E, 0xFF, 0xD0, 0xD9, 0x3E, 0xD7, 0xD9, 0xFD, 0xA4, 0x82, 0x93, 0xB9,
+    0xF2, 0x3A, 0xE6, 0x6C, 0xA0, 0xC6, 0xAB, 0xD6, 0x72, 0x53, 0xCC, 0x25, 0x99, 0xB4, 0x73, 0x99,
+    0x1C, 0xAB, 0xBE, 0xF5, 0x69, 0x86, 0xCE, 0xA5, 0xCE, 0xBD, 0xC1, 0xE9, 0xC7, 0xCC, 0xCC, 0xAA,
+    0x06, 0x56, 0x8A, 0x18, 0x94, 0x20, 0x06, 0xA5, 0x86, 0x71, 0x4F, 0xEC, 0xED, 0x47, 0x6F, 0x3D,
+    0x12, 0x3B, 0x5A, 0xFA, 0x87, 0x61, 0x79, 0x30, 0xE4, 0x2A, 0x28, 0xFC, 0xC3, 0x3D, 0xDE, 0x4F,
+    0xD4, 0xF4, 0x68, 0x02, 0xD7, 0xDC, 0xD8, 0x01, 0x5B, 0x81, 0x37, 0x98, 0x1B, 0x14, 0xD8, 0xB9,
+    0x60, 0x50, 0x6A, 0xCD, 0x31, 0xBC, 0x9D, 0xB4, 0xDE, 0x8E, 0x34, 0x7B, 0xD4, 0xD7, 0x86, 0x6E,
+    0xA1, 0x6F, 0xFC, 0xD4, 0x6C, 0x7A, 0xA3, 0xE9, 0x5E, 0x63, 0x6C, 0x14, 0x5B, 0x8B, 0x97, 0x74,
+    0xFA, 0xDA, 0x4D, 0x52, 0xDC, 0x56, 0xA5, 0x19, 0x95, 0xE0, 0xC6, 0xD7, 0xF4, 0x02, 0xF9, 0x95,
+    0xB1, 0xA5, 0xEA, 0x85, 0xBC, 0xF3, 0x2F, 0xE2, 0x35, 0x9A, 0xF9, 0xAC, 0x9D, 0xD3, 0xDC, 0x24,
+    0xE9, 0x0A, 0xA2, 0xDB, 0x2B, 0x57, 0x69, 0x11, 0x65, 0xE1, 0xDA, 0x99, 0x8F, 0x59, 0x37, 0xB7,
+    0x63, 0xF0, 0x24, 0x1B, 0x5D, 0xA2, 0x75, 0xA3, 0x68, 0x6A, 0x28, 0xE3, 0x24, 0x1A, 0xA9, 0x61,
+    0xCE, 0x9A, 0x51, 0x9B, 0x66, 0x4E, 0x92, 0x7D, 0x4E, 0x43, 0x69, 0x27, 0xE1, 0xE3, 0xF9, 0x7A,
+    0x63, 0x2C, 0xA2, 0xFD, 0x96, 0x58, 0xE8, 0x5B, 0x22, 0x0E, 0x52, 0x07, 0xD7, 0xDF, 0x82, 0xFA,
+    0xBF, 0x0B, 0x66, 0x14, 0xEF, 0xB0, 0xBF, 0x4F, 0x4A, 0x5D, 0xA1, 0x4B, 0x4E, 0xBE, 0x7A, 0xC6,
+    0xBF, 0xC2, 0xE9, 0xA9, 0xAA, 0x73, 0x95, 0x6B, 0xC4, 0x86, 0x5C, 0xD9, 0xDD, 0x92, 0xCB, 0x24,
+    0x7D, 0x3F, 0x55, 0x74, 0x85, 0xD3, 0x13, 0x75, 0x60, 0x99, 0xCC, 0xC3, 0xE2, 0xA0, 0x8B, 0x46,
+    0x6A, 0x3B, 0x58, 0xD5, 0x85, 0x48, 0x9A, 0xED, 0xC9, 0xE3, 0x14, 0x38, 0xF9, 0x58, 0x3D, 0xD6,
+    0x27, 0xD9, 0x91, 0x9A, 0x82, 0x4D, 0xF2, 0x31, 0xF0, 0x7A, 0x7A, 0x2F, 0xE6, 0xC2, 0xD3, 0xE2,
+    0x92, 0x26, 0x59, 0x09, 0x43, 0x95, 0x1D, 0xB9, 0x33, 0x3C, 0xA5, 0x11, 0x19, 0x98, 0x7C, 0x34,
+    0x73, 0xC5, 0x97, 0x49, 0x28, 0xEA, 0xF4, 0x4C, 0x9B, 0x08, 0x9E, 0x91, 0x41, 0xB2, 0x2D, 0x62,
+    0x85, 0xA7, 0x58, 0x09, 0x91, 0xF5, 0x1E, 0xAA, 0xD8, 0xB2, 0x51, 0x8F, 0xEC, 0x08, 0xEC, 0x25,
+    0x63, 0x17, 0x89, 0x1F, 0x97, 0x98, 0x55, 0x39, 0x86, 0x75, 0x53, 0xA9, 0xC0, 0x1C, 0xE3, 0xBF,
+    0xB9, 0xCB, 0x52, 0x4D, 0x8D, 0x8B, 0x12, 0xEA, 0xCD, 0x85, 0x0E, 0x43, 0xD1, 0xDB, 0x0D, 0x78,
+    0x71, 0x5F, 0xE9, 0x28, 0x9E, 0x06, 0x2F, 0x95, 0x41, 0x85, 0x07, 0xCF, 0x71, 0x2D, 0x9A, 0xB1,
+    0x77, 0xFF, 0xB6, 0x56, 0xCF, 0x22, 0x68, 0x27, 0xE6, 0xD3, 0xA4, 0x02, 0xF6, 0x2A, 0x69, 0xB5,
+    0xEF, 0x94, 0x07, 0x97, 0x2A, 0xF6, 0xEA, 0x50, 0x62, 0xDA, 0xD7, 0xB9, 0x6E, 0x7F, 0x3B, 0xBD,
+    0x9B, 0x9D, 0x91, 0xB8, 0x97, 0x49, 0xA1, 0x2C, 0x8F, 0xAE, 0xB4, 0xDA, 0x27, 0x2A, 0x4D, 0x4C,
+    0x16, 0x19, 0x97, 0x4F, 0x86, 0xDC, 0xAE, 0xB4, 0xE7, 0xA4, 0x46, 0x24, 0xE6, 0xD6, 0x99, 0xB4,
+    0xA2, 0xDF, 0xA9, 0x95, 0x9B, 0x39, 0x7C, 0x87, 0x09, 0x64, 0xAD, 0x3E, 0x66, 0xAD, 0x76, 0x3B,
+    0xF1, 0x47, 0xEA, 0x62, 0x02, 0x2C, 0x53, 0x3E, 0xCE, 0x0E, 0xB5, 0xFA, 0xDE, 0x5D, 0x06, 0xE4,
+    0xE7, 0x0A, 0x3D, 0xDF, 0xEA, 0x06, 0x4C, 0x6E, 0x62, 0xE3, 0xC6, 0xE0, 0x26, 0x43, 0x41, 0x7B,
+    0x37, 0x37, 0xDB, 0x99, 0x36, 0x54, 0xFD, 0x01, 0x42, 0x1B, 0xF7, 0x65, 0x9F, 0x1A, 0x5F, 0xEA,
+    0x76, 0xDA, 0xEA, 0x07, 0x83, 0x17, 0x5E, 0x01, 0x27, 0x04, 0x81, 0x4F, 0xCA, 0xEA, 0xE4, 0x46,
+    0x83, 0xF7, 0x55, 0xB9, 0x03, 0xAA, 0x54, 0x3B, 0x8B, 0x5C, 0x8B, 0x8B, 0x87, 0x3F, 0x44, 0xBD,
+    0x25, 0x42, 0xB7, 0xA6, 0xE2, 0x53, 0xF2, 0xBE, 0xCF, 0x8D, 0x4A, 0x66, 0x53, 0x53, 0xAF, 0x16,
+    0x5F, 0xDD, 0x8B, 0x6E, 0x96, 0x36, 0x7A, 0x0A, 0xB8, 0xF0, 0xB3, 0x3E, 0x60, 0x2C, 0xB1, 0xC3,
+    0x54, 0xD3, 0xFE, 0x2A, 0x94, 0xDD, 0x73, 0x98, 0x24, 0xF7, 0xFD, 0x3B, 0xBD, 0xFC, 0xD7, 0xF5,
+    0x17, 0xCD, 0x55, 0x2D, 0x93, 0x24, 0x45, 0x10, 0xCD, 0xEE, 0xDE, 0xB9, 0x16, 0x2D, 0xEA, 0xCC,
+    0x22, 0x40, 0xB4, 0x3F, 0xD3, 0x16, 0x57, 0x7D, 0x87, 0x40, 0x20, 0x58, 0xB3, 0x18, 0x04, 0x06,
+    0x73, 0x98, 0xD5, 0xA8, 0x1A, 0x40, 0x62, 0xD6, 0x80, 0x05, 0x81, 0xC2, 0xF0, 0x0F, 0xE8, 0x22,
+    0x4E, 0x60, 0x27, 0x82, 0x1F, 0x40, 0xEB, 0x33, 0xD4, 0x45, 0x14, 0x41, 0xEF, 0x51, 0x5D, 0xC9,
+    0x7B, 0xD5, 0x3B, 0xB3, 0x37, 0x11, 0x78, 0xE8, 0x88, 0xC9, 0xE8, 0x8F, 0xCA, 0xCC, 0x97, 0x2F,
+    0xF3, 0xE5, 0x48, 0xF5, 0x5C, 0xA4, 0x53, 0x1D, 0x2B, 0xD5, 0x55, 0x7A, 0xD5, 0x50, 0xFD, 0xD9,
+    0xEA, 0x5E, 0xA4, 0x4F, 0x22, 0xA2, 0x5E, 0xC4, 0x24, 0x79, 0xA4, 0xEA, 0xF1, 0x29, 0xB5, 0xAA,
+    0xFA, 0x8B, 0xDE, 0xDD, 0x2C, 0x36, 0x36, 0xDA, 0x64, 0x71, 0xC1, 0xCE, 0x66, 0x6D, 0xF4, 0x7D,
+    0xDD, 0x0F, 0xF0, 0x14, 0xD5, 0x45, 0x6A, 0xFC, 0x44, 0xAE, 0xE4, 0x78, 0xB9, 0x26, 0x20, 0xCE,
+    0x07, 0x78, 0xA9, 0x1F, 0xD2, 0x74, 0x78, 0x7C, 0x2C, 0xA3, 0x3C, 0x5C, 0xEF, 0xE8, 0x1D, 0xDE,
+    0x2B, 0x92, 0xEA, 0x16, 0x04, 0x11, 0xEE, 0xC4, 0x31, 0xBF, 0x59, 0x61, 0xBA, 0x0C, 0xD3, 0xE8,
+    0x1B, 0xA6, 0xFA, 0x4C, 0x55, 0x6E, 0x70, 0xB0, 0xC1, 0x2F, 0x1B, 0x98, 0xD5, 0xEA, 0x37, 0x9F,
+    0x24, 0x17, 0x01, 0x7B, 0x9A, 0xC5, 0x2E, 0x00, 0x3E, 0x05, 0xF5, 0xB5, 0x1E, 0x74, 0xEE, 0xD4,
+    0x4F, 0x38, 0x22, 0x16, 0x15, 0xB0, 0xC2, 0x19, 0x18, 0x19, 0x72, 0x77, 0x02, 0x61, 0x9F, 0x45,
+    0xE9, 0x16, 0xE7, 0x45, 0xBF, 0x4E, 0xD2, 0x05, 0x37, 0xCA, 0xC5, 0x11, 0xE1, 0x5B, 0xB7, 0x22,
+    0x93, 0x46, 0xFA, 0x1D, 0x2A, 0x46, 0xE9, 0xAF, 0x1C, 0xCA, 0xA8, 0xEE, 0x99, 0x29, 0x14, 0xDD,
+    0x68, 0xE2, 0x27, 0xEF, 0x90, 0xA0, 0xD7, 0x6F, 0xF5, 0x2B, 0x1D, 0x2D, 0x98, 0x69, 0x49, 0x91,
+    0x1E, 0x6C, 0x74, 0x4B, 0x4D, 0x4F, 0xC3, 0x12, 0x07, 0x72, 0xBB, 0x93, 0xF3, 0xAB, 0x4A, 0xC6,
+    0x97, 0x1B, 0x13, 0xF9, 0x99, 0x88, 0x7E, 0x5B, 0xB7, 0x4F, 0x85, 0x2F, 0x5E, 0x63, 0x25, 0xFF,
+    0x76, 0x75, 0x8B, 0x98, 0x45, 0x6C, 0x94, 0x21, 0x8A, 0x9D, 0x1B, 0xB8, 0xDB, 0xB9, 0xD2, 0x71,
+    0x00, 0xB4, 0xC9, 0x77, 0xA9, 0xE0, 0xD4, 0xBD, 0x0D, 0x64, 0xB2, 0x56, 0xDC, 0xA2, 0x7C, 0x69,
+    0x73, 0x93, 0x3B, 0x72, 0x69, 0x52, 0x1F, 0x1D, 0x13, 0xF4, 0x71, 0x7A, 0xA1, 0x2C, 0xD9, 0xFE,
+    0xA5, 0xAC, 0x8F, 0x45, 0x6B, 0xC1, 0x42, 0x8A, 0x59, 0x27, 0x90, 0xB3, 0x3B, 0x8C, 0xA2, 0x59,
+    0x0F, 0xF4, 0xC9, 0xF6, 0x15, 0xC3, 0x8B, 0x06, 0x94, 0xCC, 0x68, 0xDA, 0xAE, 0xA5, 0x63, 0x53,
+    0x1C, 0x02, 0xE7, 0x07, 0x83, 0xA4, 0xDE, 0xC2, 0xC9, 0x25, 0x74, 0x0D, 0x99, 0x1B, 0xF5, 0x06,
+    0x64, 0x78, 0xB1, 0xAB, 0xB8, 0x03, 0xDE, 0xD5, 0x3A, 0x03, 0x95, 0xC9, 0xE0, 0x97, 0x74, 0x0E,
+    0xE9, 0xAC, 0xB8, 0xE1, 0x59, 0x81, 0x22, 0x6D, 0x72, 0x1B, 0x3F, 0xD3, 0xAF, 0xDB, 0x81, 0x36,
+    0xDA, 0x8D, 0xA7, 0x8B, 0xB3, 0x49, 0x7A, 0x74, 0x5B, 0xD8, 0xFC, 0xA1, 0x42, 0xAA, 0xC9, 0xB7,
+    0x1C, 0x5A, 0x6F, 0x52, 0xCD, 0xF6, 0xA0, 0x13, 0xFB, 0x49, 0xC7, 0x9D, 0x86, 0x3E, 0xF6, 0xF9,
+    0x0A, 0x48, 0x6A, 0x4C, 0x0F, 0x9C, 0x07, 0x60, 0x75, 0x33, 0x3B, 0xFA, 0x9E, 0x96, 0x86, 0xA2,
+    0xD3, 0xCA, 0xB2, 0xD8, 0x33, 0x34, 0x7E, 0x2B, 0x9C, 0x27, 0xC9, 0x44, 0x61, 0xC0, 0xCD, 0xFA,
+    0xE5, 0xC6, 0x9E, 0x89, 0x7D, 0xE4, 0xC9, 0x2F, 0xF4, 0x29, 0x5C, 0xDE, 0xD6, 0x30, 0x04, 0xA3,
+    0xDF, 0xD7, 0x0A, 0x4D, 0x80, 0x40, 0x4C, 0xDC, 0xC8, 0x9E, 0x04, 0xF0, 0xD0, 0xAE, 0x50, 0x99,
+    0x5C, 0x6E, 0xED, 0x3E, 0x61, 0xFE, 0xB9, 0x9D, 0x91, 0xD8, 0x84, 0xCD, 0xC8, 0x6A, 0x00, 0xE4,
+    0xF1, 0x59, 0xA3, 0x29, 0x8E, 0x32, 0x5C, 0x27, 0x71, 0x44, 0xF9, 0x5C, 0x4A, 0x8B, 0x0A, 0x59,
+    0xFD, 0x72, 0x34, 0xE0, 0x79, 0xF7, 0x11, 0x1A, 0x33, 0x10, 0xEC, 0xC0, 0x36, 0x5B, 0x4A, 0xF1,
+    0x89, 0x12, 0x6A, 0x91, 0xB4, 0x6C, 0xDD, 0x3A, 0x1A, 0xF4, 0xE1, 0x53, 0x80, 0xDA, 0xBB, 0x97,
+    0x38, 0xE2, 0x28, 0x7F, 0xC7, 0xE8, 0xC5, 0x5F, 0x2E, 0x8F, 0x18, 0xEB, 0xA5, 0xF7, 0x40, 0x17,
+    0xC5, 0xBD, 0x48, 0x62, 0x0E, 0x10, 0xCE, 0x78, 0x71, 0x92, 0x46, 0xBD, 0xA9, 0x22, 0x53, 0x5B,
+    0x87, 0xEE, 0x96, 0xB0, 0x30, 0xF3, 0x00, 0xBC, 0xA7, 0x42, 0x2A, 0xC2, 0x06, 0xE9, 0xF8, 0x1A,
+    0x65, 0xF7, 0xB1, 0x16, 0xEA, 0x36, 0xB4, 0x26, 0xB7, 0x2F, 0x7F, 0x02, 0x69, 0x98, 0x31, 0x24,
+    0xDD, 0xF7, 0x9A, 0x47, 0xD9, 0x5D, 0x95, 0x19, 0x52, 0x0E, 0x03, 0xCC, 0x40, 0x44, 0x45, 0xB3,
+    0x97, 0xD7, 0xA4, 0x9D, 0x63, 0xB3, 0xED, 0x02, 0xCB, 0x72, 0x59, 0x60, 0x69, 0x60, 0xA7, 0xB7,
+    0x74, 0x4B, 0xC5, 0x57, 0x98, 0xC7, 0xDF, 0xEB, 0x53, 0xCA, 0x98, 0x4E, 0x87, 0xFB, 0x3B, 0xBC,
+    0x7B, 0x17, 0x44, 0x78, 0xFB, 0x1A, 0x15, 0xDA, 0xFB, 0xE8, 0x11, 0x0C, 0x33, 0xCA, 0xC3, 0x32,
+    0x18, 0x98, 0xD2, 0x9E, 0xCC, 0x93, 0x1F, 0x39, 0x04, 0x25, 0x5E, 0xCB, 0x0A, 0xCA, 0x5E, 0xA4,
+    0x66, 0xAA, 0x13, 0x1E, 0x03, 0xF0, 0xC0, 0x1C, 0x69, 0xF0, 0xBC, 0xBB, 0xD9, 0xD6, 0xD4, 0xFE,
+    0x04, 0xE3, 0x68, 0xC8, 0xCB, 0x11, 0x34, 0xBB, 0x98, 0xC9, 0x78, 0xA2, 0x09, 0x34, 0x7B, 0xBC,
+    0x5E, 0x1E, 0x96, 0xC2, 0xF5, 0xF5, 0xC8, 0x9C, 0xF4, 0xE9, 0x8E, 0x76, 0x3C, 0xD3, 0x47, 0x1F,
+    0x64, 0x00, 0x51, 0x41, 0x6C, 0x66, 0xFB, 0x59, 0x11, 0xE4, 0x04, 0xE0, 0x90, 0x16, 0xC2, 0x7A,
+    0x83, 0x70, 0x93, 0x27, 0x32, 0x54, 0xFD, 0x47, 0xA4, 0x04, 0xBE, 0xC3, 0xB1, 0xA7, 0x3A, 0x84,
+    0x4A, 0x9B, 0x95, 0x87, 0xBB, 0x84, 0xC3, 0xB9, 0x0F, 0xCE, 0xF3, 0x19, 0xA2, 0x49, 0x93, 0x57,
+    0xDF, 0xAD, 0x5C, 0x15, 0xDD, 0xDF, 0x19, 0xAB, 0xC4, 0x50, 0x3E, 0xE0, 0x36, 0x42, 0xA8, 0xBD,
+    0xCE, 0x0D, 0x3B, 0xE3, 0x1B, 0xB6, 0x7C, 0x6C, 0x49, 0xA1, 0x74, 0x48, 0x98, 0xCA, 0x32, 0x2C,
+    0x90, 0x0B, 0x07, 0x5C, 0x99, 0x75, 0x91, 0xD1, 0x69, 0xC7, 0x22, 0xE5, 0x88, 0xC8, 0xA9, 0x25,
+    0xD6, 0x81, 0x90, 0x90, 0x2D, 0x43, 0x28, 0x43, 0x84, 0x2F, 0xB6, 0xE7, 0x4C, 0x4D, 0x8E, 0x66,
+    0xC1, 0xD3, 0x34, 0xDB, 0x00, 0x9E, 0x30, 0x18, 0x89, 0x3B, 0x34, 0x98, 0x84, 0x39, 0xB5, 0x19,
+    0x05, 0xAA, 0xFE, 0x8E, 0x40, 0xD9, 0x62, 0xB8, 0x0E, 0xFA, 0xE6, 0xFF, 0x0C, 0x88, 0x0D, 0x03,
+    0x99, 0xE5, 0x1E, 0xC7, 0x4E, 0x9C, 0xD8, 0x1D, 0xAE, 0xF2, 0x87, 0x81, 0xFD, 0xBF, 0xD2, 0xF6,
+    0x5F, 0x5E, 0xFF, 0x00, 0x85, 0x55, 0xAD, 0xAE, 0xDE, 0x46, 0x10, 0x1D, 0xDB, 0x49, 0x0C, 0x0C,
+    0x36, 0xA0, 0x17, 0x15, 0xF8, 0x11, 0x8C, 0x8B, 0xFC, 0x49, 0x01, 0x01, 0x17, 0x24, 0xA0, 0x7D,
+    0x88, 0xBE, 0xC4, 0x5D, 0xB7, 0xA4, 0xA0, 0xA4, 0x24, 0x2A, 0x2C, 0xBF, 0x24, 0x4F, 0x10, 0xAD,
+    0xAB, 0x0B, 0x02, 0x42, 0x1C, 0xE5, 0x05, 0xAC, 0x96, 0xF5, 0x82, 0x6C, 0x25, 0x03, 0x47, 0xD9,
+    0xF5, 0xF4, 0x9C, 0xF1, 0x77, 0xBF, 0x7C, 0x57, 0x51, 0x9A, 0x95, 0xBC, 0xF2, 0xCF, 0xEC, 0xCC,
+    0x99, 0x33, 0x67, 0xC6, 0x22, 0x5C, 0x6E, 0x7A, 0x25, 0x12, 0x7E, 0x49, 0x52, 0x6E, 0x5D, 0x94,
+    0x3A, 0xFA, 0x83, 0x14, 0xF2, 0x58, 0x4E, 0xAB, 0x52, 0x69, 0x17, 0x97, 0x24, 0x8C, 0x7E, 0xAE,
+    0xB4, 0xD4, 0x83, 0x4B, 0x4D, 0x12, 0x3F, 0xF7, 0x11, 0xF7, 0x3A, 0xBA, 0x54, 0x6F, 0xD2, 0xC7,
+    0x6E, 0x11, 0x1D, 0x74, 0x6C, 0x36, 0x98, 0xF7, 0x8B, 0x5B, 0x0B, 0x1D, 0xFB, 0xD9, 0xA9, 0xE8,
+    0x18, 0xD6, 0x4A, 0xDF, 0xEB, 0xE4, 0x34, 0xC3, 0x91, 0xFE, 0x9D, 0xA4, 0xCD, 0x2E, 0xCA, 0x43,
+    0x39, 0x5B, 0xDD, 0x4F, 0xAB, 0x48, 0xA1, 0x78, 0x2D, 0x75, 0xEA, 0x47, 0x62, 0xDA, 0xF0, 0xFA,
+    0x81, 0x1C, 0xE4, 0xDE, 0x6A, 0x75, 0x12, 0x69, 0x54, 0x61, 0xA7, 0xDC, 0x9D, 0xED, 0x9A, 0x6B,
+    0x9D, 0x6A, 0x1D, 0x2A, 0x84, 0x5C, 0xA5, 0x06, 0xC4, 0x51, 0x5C, 0x72, 0x59, 0x00, 0xA4, 0xA7,
+    0xE9, 0x5B, 0xBC, 0xA8, 0xF4, 0x12, 0x2E, 0x5D, 0xEA, 0x17, 0xBC, 0x8E, 0x78, 0x51, 0xE8, 0x8D,
+    0xC2, 0xD9, 0x86, 0xCC, 0x68, 0xB7, 0x08, 0x8E, 0xE9, 0x2C, 0x6E, 0xE3, 0x71, 0x8D, 0x95, 0x4E,
+    0xAD, 0x1E, 0x10, 0x4B, 0x57, 0x0B, 0x33, 0x70, 0xC7, 0xD9, 0x5A, 0x33, 0x91, 0x7C, 0x73, 0xC2,
+    0x74, 0x55, 0x01, 0xC7, 0x82, 0xEF, 0xEA, 0x16, 0x71, 0x73, 0x10, 0x70, 0x77, 0x84, 0xFD, 0xE8,
+    0x37, 0x42, 0x8E, 0x44, 0x3C, 0x95, 0xF0, 0x21, 0x7E, 0x0B, 0x8B, 0xDB, 0x0A, 0xFD, 0x93, 0xB4,
+    0x21, 0x24, 0x21, 0xB8, 0xE4, 0x67, 0xD1, 0xD7, 0x1B, 0x6E, 0xC2, 0x54, 0xE8, 0xAF, 0x19, 0x68,
+    0xFC, 0x5C, 0x6B, 0xAD, 0x85, 0xCE, 0xFD, 0xA6, 0xA9, 0xE0, 0x49, 0xB8, 0x18, 0xF7, 0xF4, 0x1F,
+    0x9E, 0x71, 0xE2, 0x15, 0x0F, 0x9D, 0x5A, 0x7A, 0xDC, 0x7B, 0xEE, 0x95, 0xCE, 0x8D, 0x1E, 0xDA,
+    0x8C, 0x33, 0x82, 0x03, 0xA8, 0x96, 0x32, 0x65, 0x26, 0x1E, 0x26, 0x18, 0x95, 0xFA, 0x14, 0x66,
+    0x9A, 0x3B, 0xEE, 0x91, 0x1B, 0x60, 0x70, 0x91, 0x89, 0x76, 0x35, 0xC6, 0x68, 0x57, 0x6B, 0x05,
+    0xF7, 0xFD, 0x8A, 0xE3, 0xA0, 0xC4, 0xA1, 0xC8, 0x19, 0xB1, 0xDE, 0x83, 0x23, 0x84, 0x01, 0x97,
+    0xD8, 0x27, 0xE6, 0xB7, 0x10, 0xC9, 0x73, 0xC3, 0xF3, 0x23, 0xAB, 0x88, 0x68, 0x41, 0x69, 0xAA,
+    0xB1, 0xD6, 0xDF, 0x21, 0x91, 0xA9, 0x4D, 0xED, 0x7A, 0xCC, 0x95, 0x08, 0x5F, 0xE3, 0x4A, 0x1E,
+    0xDB, 0x9B, 0xED, 0xFA, 0xE5, 0x1A, 0x40, 0xCD, 0x53, 0x24, 0x1D, 0x7D, 0x74, 0x10, 0xCF, 0xAD,
+    0x8E, 0x2D, 0x8B, 0x1A, 0x34, 0xC1, 0x17, 0xB9, 0xFE, 0xFE, 0x2C, 0x5F, 0x70, 0x2D, 0x55, 0xEE,
+    0x67, 0x54, 0x32, 0x32, 0xF7, 0xFE, 0x67, 0x60, 0xFE, 0x44, 0xF8, 0x57, 0x74, 0xB2, 0x96, 0xD4,
+    0xC9, 0x01, 0xD9, 0x80, 0x8C, 0xEA, 0x4C, 0x27, 0x9D, 0xE9, 0x24, 0xBC, 0x35, 0x1A, 0x2E, 0xB9,
+    0x19, 0xD0, 0x13, 0x3B, 0x28, 0xFB, 0x9D, 0x4E, 0x22, 0x50, 0x8D, 0xA4, 0xD5, 0x74, 0x12, 0xA0,
+    0x93, 0xC1, 0x51, 0x27, 0x1F, 0xBF, 0xA6, 0x93, 0x57, 0xCD, 0x2C, 0x6D, 0x24, 0x97, 0x6D, 0x94,
+    0x96, 0xFA, 0x7E, 0x5C, 0xC8, 0x97, 0x74, 0xF2, 0xC1, 0x2F, 0x2E, 0x53, 0x27, 0x03, 0x28, 0x8B,
+    0x62, 0x05, 0x32, 0xCA, 0x8C, 0xBB, 0xF0, 0xCF, 0x35, 0x75, 0xD2, 0x2D, 0x7E, 0xAA, 0xA0, 0x13,
+    0xA1, 0x4E, 0xC2, 0xFF, 0xE8, 0xE4, 0xAA, 0x46, 0x76, 0xFD, 0x4D, 0x3E, 0xB2, 0x56, 0xAD, 0xDD,
+    0xF8, 0x19, 0x69, 0xDF, 0x02, 0xFF, 0x5E, 0x52, 0xE0, 0xCF, 0x2C, 0x23, 0x1C, 0x7D, 0x27, 0x01,
+    0x6F, 0x91, 0x0B, 0x2D, 0xE8, 0x54, 0x3A, 0x7B, 0x66, 0x73, 0x16, 0x94, 0xBC, 0x42, 0x0D, 0x9E,
+    0xF9, 0x76, 0x3C, 0xC4, 0xFC, 0xED, 0x0B, 0xDC, 0x4B, 0x40, 0x91, 0x84, 0xB4, 0x4A, 0xCF, 0x1A,
+    0x75, 0x59, 0x26, 0xE8, 0xDF, 0x24, 0xBA, 0x1B, 0x56, 0xA6, 0x22, 0xCF, 0xB8, 0x72, 0x71, 0x38,
+    0x1F, 0x05, 0xFE, 0x26, 0xD9, 0xD5, 0x3F, 0x59, 0x4F, 0x33, 0xE0, 0xE2, 0xB9, 0x3C, 0x82, 0x7D,
+    0x6D, 0x02, 0xD7, 0xB9, 0x7C, 0xC1, 0xE2, 0x52, 0xD3, 0x90, 0x16, 0x2F, 0xF6, 0x29, 0x2E, 0xE0,
+    0x5E, 0x8A, 0xEB, 0x10, 0xF7, 0xD0, 0xC0, 0x00, 0x30, 0x57, 0x2F, 0x75, 0xF0, 0x64, 0x15, 0x92,
+    0xEA, 0x98, 0x85, 0x89, 0xF5, 0xE2, 0x07, 0x08, 0xAB, 0x64, 0x02, 0x84, 0x43, 0x2D, 0x69, 0xBA,
+    0x27, 0x22, 0x38, 0x28, 0x75, 0x08, 0xD4, 0x48, 0x81, 0xEF, 0x61, 0xAE, 0x36, 0xCE, 0x42, 0xE8,
+    0x00, 0x61, 0xBB, 0xC8, 0x2C, 0xFD, 0x44, 0xF5, 0xC0, 0xFB, 0x8C, 0x2F, 0x15, 0xC7, 0x49, 0x32,
+    0x38, 0x0B, 0x19, 0xE8, 0x6F, 0xA9, 0x80, 0x40, 0x9C, 0xD6, 0x14, 0x30, 0x61, 0xAA, 0xCE, 0xD8,
+    0xE9, 0x4C, 0x1D, 0xC4, 0x89, 0x94, 0x98, 0x21, 0x89, 0xB6, 0xE2, 0x01, 0x62, 0xB2, 0x73, 0x23,
+    0xCF, 0xAD, 0xE7, 0x22, 0x32, 0xC8, 0x85, 0xC9, 0xBA, 0xA1, 0xD2, 0x60, 0x9A, 0xEF, 0x41, 0x06,
+    0xC2, 0x06, 0x83, 0x64, 0x25, 0x76, 0x8E, 0x67, 0x54, 0x08, 0x83, 0x06, 0x69, 0x90, 0x89, 0x3A,
+    0x11, 0x61, 0xCB, 0x49, 0x2D, 0x3D, 0x1B, 0x5C, 0xF4, 0x32, 0x5B, 0x3B, 0xC1, 0x9F, 0xFB, 0x60,
+    0xA3, 0xE4, 0x96, 0xA1, 0x7D, 0x98, 0x18, 0x66, 0x33, 0xC8, 0xD1, 0x20, 0x0F, 0x77, 0x65, 0xDC,
+    0xCB, 0x5A, 0x99, 0x20, 0x4C, 0x0B, 0x7B, 0xB1, 0xDB, 0x6C, 0xD3, 0x68, 0xBE, 0x4B, 0xB5, 0xE6,
+    0x2D, 0x81, 0x9C, 0xAD, 0xDC, 0xB0, 0x29, 0x57, 0x4F, 0x6A, 0xFE, 0xA2, 0x51, 0xA8, 0x39, 0x3A,
+    0x4E, 0x5D, 0x70, 0xFA, 0xDB, 0xC0, 0x31, 0x7E, 0x30, 0x80, 0xDE, 0x2E, 0x4C, 0x07, 0xDD, 0xCE,
+    0x16, 0x40, 0xD9, 0xD1, 0xB9, 0xD2, 0x26, 0xA9, 0xB3, 0xCD, 0xB5, 0x95, 0x32, 0xC4, 0x5C, 0x63,
+    0x9D, 0xD1, 0x28, 0x88, 0xFC, 0x2C, 0x91, 0x82, 0xB0, 0xF7, 0xBE, 0xEC, 0x3D, 0xC5, 0xBA, 0x12,
+    0xBD, 0x91, 0x5A, 0x9A, 0x86, 0x1B, 0x43, 0xEF, 0x17, 0xBB, 0x1D, 0xC4, 0x46, 0x0D, 0x95, 0x30,
+    0xF2, 0x39, 0xD9, 0x39, 0x9E, 0x28, 0xEE, 0xF5, 0x07, 0xDB, 0xF7, 0xF8, 0x73, 0xEA, 0xFE, 0xA5,
+    0x03, 0xFF, 0x64, 0xFD, 0x1C, 0x3D, 0xC1, 0x82, 0x21, 0xFE, 0x8B, 0x98, 0x09, 0x18, 0x02, 0xFD,
+    0x70, 0xDC, 0xC5, 0x86, 0x5A, 0x1F, 0x6D, 0x7C, 0x94, 0xEC, 0xC1, 0xCC, 0x79, 0xE2, 0x16, 0x82,
+    0xED, 0xDF, 0xD1, 0x9F, 0xFE, 0x01, 0x40, 0xE5, 0x06, 0xBD, 0x49, 0xFD, 0x31, 0x1B, 0x0A, 0xEB,
+    0xA0, 0xBD, 0xF7, 0x56, 0xA3, 0x86, 0x54, 0xD3, 0xD1, 0xB1, 0xB1, 0x4A, 0xC3, 0xD9, 0x26, 0x2B,
+    0xC3, 0x44, 0xD6, 0xB7, 0x53, 0xD6, 0xDE, 0xCC, 0xCC, 0xE0, 0x8B, 0xEB, 0x3F, 0x8D, 0x55, 0x31,
+    0xAE, 0xE5, 0x44, 0x10, 0x6C, 0xDB, 0x20, 0x07, 0x2F, 0xF0, 0x66, 0x48, 0x24, 0x3E, 0x82, 0x8F,
+    0x30, 0x5E, 0x02, 0xE2, 0x4D, 0x7E, 0xC4, 0x0D, 0xF6, 0x10, 0xD8, 0x0B, 0x21, 0x01, 0xC7, 0x58,
+    0xC4, 0x19, 0x40, 0x36, 0x9C, 0xC0, 0x42, 0xE4, 0x78, 0x05, 0x12, 0x12, 0x24, 0x0E, 0x8C, 0x64,
+    0x3E, 0x63, 0x37, 0x55, 0x35, 0xFE, 0xEF, 0xBF, 0x07, 0x42, 0xC2, 0xFA, 0x6A, 0xFD, 0xE7, 0xE9,
+    0xE9, 0xAE, 0xAA, 0xA9, 0x69, 0x9B, 0xD9, 0xD7, 0x1F, 0x7F, 0x65, 0x56, 0x78, 0xBD, 0x99, 0x5D,
+    0x62, 0x98, 0xCD, 0xEA, 0x79, 0x68, 0xCD, 0xC2, 0xCB, 0xDD, 0xCC, 0xBE, 0x29, 0xF0, 0xE2, 0xE6,
+    0x29, 0xDC, 0xAC, 0xD9, 0x72, 0xC4, 0xB0, 0x64, 0xDE, 0xDA, 0x30, 0x9B, 0xF7, 0xE6, 0x23, 0xFE,
+    0x0A, 0xFE, 0x1C, 0x4B, 0x2C, 0x75, 0x53, 0x85, 0xBD, 0x61, 0x66, 0xC9, 0xB0, 0x84, 0x05, 0x5B,
+    0x96, 0x8E, 0x85, 0x57, 0x24, 0x5A, 0xF5, 0x88, 0x44, 0xBB, 0x38, 0x12, 0xAD, 0xF4, 0xA8, 0xA2,
+    0x9B, 0x22, 0x12, 0x2D, 0xF7, 0x49, 0x71, 0xD4, 0x2A, 0x12, 0xAD, 0x39, 0x10, 0x06, 0x25, 0x0E,
+    0x4A, 0x19, 0xB4, 0xD8, 0xF1, 0xB5, 0x65, 0xED, 0x09, 0xEC, 0x64, 0x51, 0xC5, 0x2B, 0x8B, 0x65,
+    0xE8, 0xD1, 0xFE, 0x0D, 0x59, 0x7C, 0x9B, 0x2F, 0x77, 0x2C, 0x80, 0x8D, 0xC8, 0x11, 0x51, 0x2A,
+    0x2C, 0x39, 0x28, 0x84, 0x45, 0xD4, 0x96, 0xCB, 0xC1, 0xAD, 0x2C, 0x53, 0x2F, 0xCD, 0x0A, 0xB4,
+    0x2B, 0xF1, 0x57, 0xEB, 0x30, 0x31, 0x0A, 0xFF, 0x9F, 0xC2, 0xFF, 0x28, 0xFC, 0x7F, 0xED, 0xC2,
+    0xF9, 0x8C, 0xBF, 0xF0, 0x59, 0x71, 0x14, 0x8B, 0xFE, 0x94, 0x0C, 0xF9, 0x82, 0x5B, 0x93, 0x85,
+    0x75, 0x2B, 0x83, 0x12, 0xBB, 0x1B, 0x2E, 0xE1, 0x56, 0xEA, 0xF0, 0x11, 0x92, 0x9A, 0x77, 0xD8,
+    0x5B, 0x6D, 0xC3, 0x68, 0x79, 0xAC, 0x01, 0xE0, 0x3D, 0x6B, 0xEF, 0xCF, 0x02, 0x47, 0x20, 0xED,
+    0xA1, 0x6E, 0x20, 0xDC, 0x7A, 0x03, 0xF2, 0xF2, 0xC0, 0x4A, 0x8E, 0x95, 0xFE, 0x6E, 0xE5, 0xB2,
+    0xDB, 0x65, 0xCF, 0x75, 0x4E, 0xC3, 0xF1, 0x89, 0x8F, 0xB5, 0xBB, 0x83, 0xBA, 0x03, 0x7C, 0xE3,
+    0x0E, 0x1E, 0xAF, 0xDF, 0x0A, 0xA9, 0x10, 0x91, 0xB4, 0xF1, 0xFC, 0xB0, 0xE7, 0xCA, 0x21, 0x61,
+    0x25, 0xCA, 0x7A, 0x4D, 0x10, 0x2E, 0x73, 0x67, 0x45, 0x0C, 0x53, 0xE6, 0xD5, 0x6A, 0xE1, 0xF3,
+    0x68, 0x99, 0xBD, 0xB8, 0xE2, 0x43, 0x57, 0xFF, 0x32, 0x5A, 0xF7, 0xB3, 0xE3, 0x5F, 0xEF, 0xAB,
+    0xD8, 0xCD, 0x85, 0x37, 0x6B, 0xEE, 0x5F, 0xEC, 0xE6, 0x3F, 0x00, 0xC5, 0x3A, 0x3C, 0x7A, 0x24,
+    0x8C, 0xC2, 0x0F, 0xEF, 0xC3, 0xDE, 0x4D, 0xD9, 0xAB, 0x86, 0x6A, 0xC7, 0xD4, 0x31, 0xA3, 0x7E,
+    0x14, 0x5E, 0x47, 0xE0, 0xB0, 0x40, 0xCD, 0xD0, 0x10, 0x72, 0x70, 0x47, 0xC7, 0x3F, 0x1E, 0x5E,
+    0x25, 0xD9, 0x3A, 0xBA, 0x86, 0xA9, 0x09, 0x24, 0x83, 0x76, 0xD3, 0xA3, 0x46, 0xBB, 0x26, 0x0A,
+    0x0A, 0xE5, 0xF1, 0x44, 0x8B, 0x8D, 0xCE, 0x40, 0xAA, 0x35, 0x4D, 0xD6, 0x30, 0x04, 0x9E, 0x68,
+    0xF0, 0x35, 0xB1, 0x38, 0xE5, 0x50, 0x10, 0x7D, 0x35, 0x1A, 0x9E, 0x1A, 0x25, 0xB2, 0xEE, 0x13,
+    0x20, 0xC2, 0x45, 0x1E, 0x33, 0xF7, 0x43, 0x39, 0x57, 0x32, 0xC7, 0x3F, 0xC9, 0x5C, 0x5F, 0xB6,
+    0xC9, 0xCF, 0x01, 0x6E, 0xA8, 0xD0, 0xAF, 0xE4, 0x41, 0x64, 0x7E, 0x96, 0x27, 0x35, 0x08, 0x6B,
+    0x65, 0x3C, 0x5F, 0xBE, 0x6E, 0xEF, 0x6C, 0x1C, 0x2F, 0x93, 0x7A, 0xBF, 0xD3, 0xF1, 0x14, 0x47,
+    0x23, 0x9B, 0x37, 0xDF, 0xED, 0x5A, 0x7D, 0x91, 0xD9, 0xBF, 0x1E, 0xF1, 0x84, 0xCE, 0xB2, 0xF0,
+    0x9E, 0xC8, 0xD1, 0x12, 0x49, 0x07, 0x42, 0xCB, 0x7C, 0x94, 0x40, 0xCD, 0x26, 0xB4, 0x70, 0xCB,
+    0x25, 0x26, 0xF2, 0xFE, 0xA3, 0x04, 0x04, 0xCB, 0x16, 0x32, 0x80, 0xA4, 0xAB, 0x04, 0x8F, 0xC4,
+    0x27, 0xF0, 0xF6, 0x59, 0x25, 0x6A, 0x47, 0x09, 0x90, 0xEB, 0x16, 0xF8, 0x87, 0x47, 0x0E, 0x2B,
+    0x22, 0x4F, 0x83, 0x00, 0xB5, 0x9D, 0x25, 0xB0, 0x63, 0xEE, 0x30, 0x40, 0xFA, 0x2E, 0xE2, 0x62,
+    0xD0, 0x02, 0xFD, 0x30, 0xE5, 0x4F, 0x25, 0x78, 0xB4, 0x04, 0xE5, 0xBF, 0x24, 0x0B, 0x9E, 0xCF,
+    0xA7, 0x25, 0xE9, 0x55, 0x8B, 0xA6, 0x02, 0x0D, 0x87, 0x1F, 0xF3, 0x20, 0xA6, 0x76, 0xAF, 0x4B,
+    0x3A, 0x67, 0x1F, 0xA5, 0x5F, 0x14, 0x1D, 0x36, 0xA0, 0x6F, 0xA9, 0x7C, 0xAE, 0x5B, 0x43, 0xA8,
+    0xC7, 0xD1, 0x12, 0x1F, 0x98, 0x74, 0x33, 0x89, 0x94, 0x7B, 0xE1, 0xBF, 0xFB, 0x34, 0x8C, 0x01,
+    0x83, 0x40, 0x3B, 0xBB, 0x99, 0x77, 0xA8, 0xDC, 0xEB, 0x0D, 0x3F, 0xFC, 0x7B, 0x6F, 0xC3, 0xDA,
+    0x44, 0x0E, 0x0B, 0xF7, 0xA4, 0xC5, 0x84, 0x26, 0x8D, 0xCF, 0x6C, 0xF2, 0x7E, 0x42, 0xF1, 0xDF,
+    0x4E, 0xBD, 0x37, 0xD0, 0xD5, 0xA9, 0x48, 0x9B, 0x99, 0x36, 0xA5, 0xD0, 0x39, 0x5E, 0x7E, 0xE0,
+    0x0F, 0xED, 0xAD, 0x53, 0x9F, 0xED, 0xEA, 0x9C, 0x50, 0xB4, 0xC9, 0xE9, 0xD4, 0xA7, 0x90, 0xB4,
+    0x7A, 0xB6, 0xEB, 0xB0, 0x70, 0x81, 0x86, 0x13, 0x59, 0x2A, 0x12, 0xB6, 0x3B, 0x95, 0x72, 0x5E,
+    0x7B, 0xB4, 0xA4, 0xD4, 0x91, 0x6D, 0x7B, 0xF5, 0xA2, 0xF3, 0xD8, 0xEA, 0x43, 0xFF, 0xAD, 0xCF,
+    0xB9, 0x82, 0x94, 0xBE, 0x20, 0x0B, 0xC9, 0x4A, 0x51, 0xCB, 0xE3, 0x21, 0x4D, 0xE3, 0x8A, 0x63,
+    0x9C, 0xF0, 0x85, 0xE8, 0xBA, 0x55, 0xB4, 0xD0, 0x2D, 0xE3, 0x72, 0x8D, 0xE5, 0x8C, 0x08, 0xAB,
+    0xFD, 0xC6, 0x86, 0x30, 0x96, 0xC6, 0xD4, 0x08, 0x31, 0x60, 0x18, 0x8E, 0x46, 0x80, 0xC5, 0x2B,
+    0xCE, 0xC5, 0x61, 0x22, 0xFA, 0x7A, 0x23, 0x91, 0xC2, 0xC3, 0xAA, 0xA9, 0xBF, 0x89, 0x7D, 0xFA,
+    0x60, 0x68, 0x8E, 0x0E, 0xAA, 0x27, 0x66, 0x89, 0x69, 0x92, 0x84, 0x7A, 0x6A, 0xD6, 0x52, 0xEA,
+    0x6A, 0x27, 0x9E, 0xEA, 0xE0, 0xD7, 0xE9, 0xE2, 0xC4, 0x5C, 0xF2, 0xD8, 0xA2, 0xDA, 0x3B, 0xE7,
+    0xF4, 0xE0, 0x9F, 0xB1, 0xBD, 0xA7, 0xAB, 0xA4, 0x1B, 0x24, 0x0A, 0xE7, 0xD0, 0x2B, 0x34, 0xC4,
+    0xD3, 0x9C, 0xAE, 0x35, 0xB3, 0x4B, 0x0D, 0x7A, 0x4B, 0x1B, 0xEE, 0x3C, 0x07, 0xC6, 0x61, 0xBD,
+    0x70, 0x2C, 0xBF, 0x41, 0x7E, 0x15, 0x09, 0x7C, 0xF8, 0x69, 0xE7, 0x1A, 0xAB, 0x34, 0xDC, 0x2E,
+    0x25, 0x80, 0x40, 0xFA, 0xCB, 0x10, 0xF4, 0xB3, 0x78, 0x15, 0x3C, 0x7D, 0xF3, 0x5F, 0xFD, 0xC1,
+    0xE0, 0x31, 0x47, 0x25, 0xC8, 0xFF, 0xD2, 0xC7, 0xCA, 0x17, 0x54, 0x72, 0xBF, 0x7E, 0x24, 0xCA,
+    0xFD, 0x0A, 0x40, 0x5F, 0x14, 0x55, 0xAF, 0x54, 0x4D, 0xC7, 0x90, 0x3E, 0x36, 0xFF, 0xE7, 0xF9,
+    0x1B, 0xED, 0x55, 0x31, 0x8F, 0xD5, 0x46, 0x10, 0x1E, 0xDB, 0x3C, 0x59, 0x7A, 0x86, 0x6C, 0xC3,
+    0x35, 0x69, 0x5C, 0x21, 0x01, 0x42, 0x72, 0x9B, 0x02, 0x69, 0x57, 0xA2, 0xA4, 0x78, 0xAF, 0x38,
+    0x57, 0x29, 0x48, 0x9D, 0x22, 0xFF, 0x00, 0xAD, 0x13, 0x0A, 0xCA, 0xF0, 0x13, 0xAE, 0xA6, 0xCA,
+    0x1F, 0x48, 0xEC, 0x7B, 0x29, 0x52, 0x50, 0xC4, 0x51, 0x84, 0x28, 0x52, 0xE0, 0x20, 0x45, 0x48,
+    0xB9, 0x82, 0x25, 0xAC, 0x0E, 0xEB, 0xB4, 0xEB, 0xE1, 0x9B, 0xBD, 0x53, 0xD0, 0x49, 0x91, 0x72,
+    0x57, 0xA4, 0xCB, 0x7A, 0xBD, 0x5E, 0xCF, 0xCC, 0xCE, 0xF7, 0xAD, 0x67, 0x66, 0x4D, 0x2A, 0x50,
+    0xC1, 0x5D, 0xC1, 0x26, 0xE7, 0x81, 0xFA, 0x29, 0xC3, 0x58, 0x07, 0xE2, 0x11, 0x52, 0xBC, 0x12,
+    0xF5, 0xA3, 0x75, 0x44, 0x6A, 0xD6, 0x18, 0x0B, 0xD6, 0x9E, 0x20, 0x7A, 0x33, 0x63, 0xAC, 0x39,
+    0x12, 0x95, 0xCC, 0x78, 0xE4, 0x18, 0xD9, 0x90, 0x8C, 0x03, 0x69, 0x8C, 0xB0, 0xD5, 0x1C, 0x60,
+    0xD4, 0x9C, 0x40, 0x0E, 0x87, 0x16, 0x9E, 0x54, 0x04, 0x16, 0xA9, 0x25, 0x87, 0xA8, 0x62, 0x82,
+    0xDB, 0x92, 0x29, 0xC1, 0x9B, 0xC4, 0x00, 0xF0, 0x4E, 0x48, 0xD4, 0xF0, 0x9B, 0x1A, 0x18, 0xE8,
+    0x99, 0xB4, 0x87, 0x71, 0xC6, 0x5F, 0x43, 0xA3, 0x82, 0xE0, 0xF7, 0x2F, 0xA3, 0xE8, 0xB8, 0x83,
+    0x7B, 0x41, 0x02, 0x9E, 0x27, 0x25, 0x0C, 0xB2, 0x04, 0xFD, 0x29, 0xF3, 0x9F, 0xC0, 0x11, 0x7C,
+    0x58, 0x8D, 0x30, 0x78, 0xBD, 0xC0, 0x34, 0x60, 0x07, 0x15, 0xE7, 0xDC, 0x61, 0x8B, 0x40, 0x85,
+    0x27, 0xD1, 0x0D, 0x74, 0x97, 0x8A, 0x1D, 0x87, 0xEF, 0xEE, 0xDE, 0xBC, 0xB3, 0xBE, 0x9A, 0x77,
+    0x74, 0x40, 0x37, 0x69, 0x4D, 0x17, 0x99, 0x64, 0x46, 0x96, 0x4F, 0xE4, 0x88, 0x97, 0x4F, 0x8A,
+    0x6E, 0x3A, 0xB8, 0x7A, 0xD1, 0x95, 0x67, 0x93, 0x55, 0xC3, 0xEF, 0x78, 0xD1, 0xFC, 0x42, 0xBE,
+    0x24, 0x9D, 0x7B, 0xD9, 0x6B, 0xDB, 0x76, 0x83, 0xDD, 0xBC, 0xC6, 0x7D, 0x8C, 0x3B, 0x88, 0x00,
+    0x26, 0x1C, 0xF4, 0xC7, 0x7B, 0x6E, 0x38, 0x35, 0x99, 0xFF, 0xD3, 0xF3, 0x5F, 0xF5, 0x00, 0xD2,
+    0x5D, 0xFD, 0x72, 0x2A, 0xDF, 0xCF, 0x59, 0x5C, 0xC8, 0xDA, 0xFF, 0xEE, 0xE5, 0x4B, 0xB3, 0xEE,
+    0x56, 0x6D, 0xBB, 0x8F, 0x38, 0x85, 0x9A, 0x53, 0x6E, 0xA4, 0x76, 0xFB, 0xE9, 0xD3, 0x03, 0xD0,
+    0x71, 0xF2, 0x04, 0x99, 0x66, 0xAC, 0x9D, 0x9A, 0xCB, 0x50, 0x70, 0xC6, 0x86, 0x87, 0xBD, 0x2D,
+    0xA2, 0x67, 0xFA, 0x51, 0xBB, 0xDA, 0x57, 0x73, 0x11, 0xF2, 0x85, 0x98, 0xF6, 0x08, 0x09, 0x47,
+    0x3C, 0x58, 0x88, 0x55, 0x12, 0x67, 0x8B, 0x08, 0xED, 0x4F, 0x41, 0xFF, 0x18, 0xF4, 0x2E, 0x34,
+    0x87, 0x61, 0x65, 0x48, 0x9B, 0x1F, 0xA8, 0x19, 0x40, 0xC2, 0xE9, 0x41, 0xF9, 0x66, 0x2A, 0x83,
+    0xF2, 0xC5, 0x52, 0x85, 0x8C, 0xEF, 0xC1, 0xCB, 0x0E, 0x7E, 0xB6, 0x2D, 0x22, 0x88, 0xB7, 0x9C,
+    0xCB, 0xA5, 0xE0, 0x2A, 0xC0, 0x62, 0xAE, 0x66, 0x10, 0x70, 0x7A, 0x6C, 0x26, 0x3D, 0xE8, 0xA1,
+    0x87, 0xDF, 0x16, 0x68, 0x65, 0x4C, 0xFA, 0xA8, 0x66, 0x15, 0x92, 0x7E, 0x3A, 0xD3, 0x1B, 0xDB,
+    0x09, 0xA1, 0x7D, 0xB2, 0x87, 0x5C, 0x3B, 0x30, 0x50, 0x8E, 0x8B, 0xA0, 0x07, 0xBE, 0xEF, 0x9A,
+    0x5F, 0x62, 0xE9, 0xB5, 0x89, 0x2B, 0x03, 0x6E, 0xD9, 0x3E, 0x02, 0x2C, 0xB9, 0x6A, 0xA8, 0x90,
+    0x22, 0x40, 0x39, 0x68, 0x80, 0x07, 0x52, 0x47, 0x27, 0xC1, 0x32, 0xBF, 0x42, 0x38, 0xEE, 0x1F,
+    0x9D, 0x7C, 0x4F, 0x6A, 0xC0, 0x46, 0xB0, 0x41, 0xC4, 0x46, 0x8D, 0xC9, 0x28, 0x83, 0x7D, 0x25,
+    0x05, 0x35, 0x10, 0xF6, 0x49, 0x15, 0x34, 0x5A, 0x92, 0x1A, 0xC5, 0x17, 0xCE, 0x9C, 0x0E, 0xF2,
+    0x25, 0xF7, 0xA4, 0xD0, 0xDC, 0xA9, 0x41, 0x2E, 0x39, 0xD4, 0x4B, 0x52, 0x75, 0x74, 0xEB, 0xC1,
+    0xF3, 0x03, 0xF9, 0xEA, 0x52, 0xAA, 0x52, 0xA8, 0x9D, 0x08, 0x13, 0x03, 0xB1, 0x2C, 0xC4, 0x92,
+    0x53, 0x22, 0xD0, 0x8D, 0xCD, 0xF3, 0x2F, 0xCE, 0x59, 0x6E, 0xB5, 0x31, 0x89, 0x91, 0xE0, 0x0B,
+    0xEF, 0x64, 0xD9, 0x0B, 0xDC, 0x96, 0x78, 0xD2, 0xFC, 0x98, 0x43, 0xCF, 0xBF, 0xF1, 0xD2, 0xF3,
+    0x11, 0x47, 0x8B, 0x8F, 0xEA, 0xCB, 0x48, 0x19, 0xD1, 0x35, 0xA2, 0x87, 0x84, 0x60, 0xA9, 0x05,
+    0xE7, 0x00, 0x0A, 0xB4, 0xE4, 0xD8, 0x70, 0xC7, 0x53, 0x31, 0x53, 0x2D, 0x6B, 0x85, 0xD9, 0x8E,
+    0xBF, 0x5D, 0xF4, 0xDC, 0x0F, 0xFB, 0x29, 0x0F, 0xEA, 0x31, 0x0F, 0xD6, 0x55, 0x4B, 0xEF, 0x54,
+    0xBA, 0xED, 0x58, 0x85, 0x15, 0x65, 0xDB, 0xD3, 0x2C, 0x29, 0x3D, 0xB6, 0x6E, 0x1F, 0x4B, 0xD4,
+    0xF5, 0x31, 0x0F, 0xBD, 0xAB, 0x63, 0xEF, 0x1A, 0x10, 0xAD, 0x05, 0x10, 0x44, 0xE9, 0x3A, 0xAD,
+    0x60, 0x67, 0x1F, 0xF1, 0x83, 0x68, 0x9D, 0x08, 0xA4, 0xA0, 0x9E, 0xD1, 0xA5, 0x0A, 0x3A, 0x4D,
+    0xAE, 0x0B, 0x9E, 0xE2, 0x89, 0x3E, 0xBB, 0x5C, 0x31, 0xA7, 0xC9, 0x96, 0xCF, 0xB5, 0xBC, 0xBB,
+    0xD8, 0x95, 0x19, 0xE6, 0x3F, 0xDA, 0x91, 0xE4, 0x9A, 0xE8, 0x72, 0xEB, 0xDA, 0xCF, 0xA9, 0x4C,
+    0x57, 0x75, 0x99, 0x75, 0xF4, 0xB1, 0xF5, 0x63, 0xCA, 0x36, 0x39, 0xD0, 0x47, 0x84, 0x41, 0x66,
+    0x38, 0xC6, 0x25, 0xD5, 0xE4, 0xC8, 0xC6, 0x09, 0xED, 0x64, 0xA6, 0x77, 0x31, 0x25, 0x14, 0xA2,
+    0x5A, 0xF9, 0xD2, 0x27, 0xA5, 0xD7, 0x23, 0xB2, 0x46, 0x94, 0x03, 0x17, 0xA7, 0x15, 0x8D, 0x67,
+    0x93, 0xB2, 0xB1, 0x08, 0xF5, 0xEF, 0x71, 0xFD, 0x84, 0xD6, 0x4F, 0x50, 0x11, 0x9B, 0x57, 0x8C,
+    0x93, 0xDD, 0xE9, 0x37, 0x81, 0x35, 0x4F, 0x38, 0xB4, 0x7B, 0x7E, 0xF6, 0x17, 0xF3, 0x21, 0x70,
+    0x38, 0xD8, 0x8D, 0xE7, 0x8D, 0xEF, 0xCD, 0x57, 0xF7, 0x66, 0xFB, 0x4D, 0xB4, 0xC0, 0x11, 0xB0,
+    0xEA, 0x38, 0x56, 0x9E, 0x72, 0xD4, 0x93, 0xFE, 0x19, 0x05, 0x0C, 0x62, 0x00, 0x41, 0x27, 0x42,
+    0xF1, 0x96, 0x01, 0x1D, 0xC4, 0x00, 0xF6, 0x6B, 0x68, 0x46, 0xEA, 0x8D, 0x7A, 0xCB, 0xE8, 0x54,
+    0xE2, 0x77, 0xC1, 0x1E, 0x5D, 0xAA, 0xC5, 0x72, 0x87, 0x2E, 0xC4, 0xAC, 0x27, 0x9B, 0xB6, 0x48,
+    0x57, 0x52, 0xFF, 0xBF, 0xFD, 0xDD, 0x3E, 0x00, 0xC5, 0x55, 0xBD, 0xAE, 0xDD, 0x44, 0x10, 0x9E,
+    0xB5, 0xC9, 0x75, 0x84, 0x85, 0xF6, 0x16, 0x34, 0x48, 0x48, 0xA6, 0x46, 0x08, 0xB7, 0x14, 0x24,
+    0xBB, 0x52, 0x1E, 0xE0, 0xA4, 0xB8, 0x97, 0x22, 0xB4, 0xA9, 0x28, 0xA8, 0x53, 0x44, 0xB1, 0x09,
+    0x0F, 0xC0, 0x7D, 0x08, 0x0A, 0xB8, 0x14, 0x50, 0x52, 0x5C, 0xE1, 0x4D, 0xDA, 0x14, 0x58, 0xCA,
+    0x0B, 0x38, 0x51, 0xFA, 0x6C, 0x60, 0x93, 0x38, 0x62, 0xED, 0xE1, 0x9B, 0xF5, 0x9E, 0xC3, 0xBD,
+    0x4F, 0xC0, 0xD1, 0x78, 0x7F, 0xEC, 0x99, 0x6F, 0x76, 0xBE, 0x99, 0x9D, 0x43, 0x74, 0xF9, 0x37,
+    0x8C, 0x54, 0xCC, 0x79, 0xDD, 0xF0, 0x48, 0xCD, 0x98, 0x37, 0xCC, 0x4E, 0xAD, 0x79, 0xAD, 0x17,
+    0x26, 0xED, 0xF3, 0xC6, 0x3C, 0x5E, 0x68, 0xC8, 0xEB, 0x62, 0xAD, 0x43, 0x15, 0xF6, 0x5A, 0xC1,
+    0x8C, 0xA6, 0xDF, 0x6B, 0x39, 0x2E, 0xE3, 0xDE, 0x09, 0x96, 0xAD, 0xCB, 0xEB, 0x32, 0x36, 0xCF,
+    0x96, 0xF7, 0xCF, 0x08, 0x72, 0x74, 0xA6, 0x3D, 0xEF, 0x9E, 0xB3, 0x2F, 0x92, 0x98, 0x97, 0x91,
+    0x0D, 0x4F, 0x2D, 0x7B, 0xC8, 0xC0, 0x4F, 0xFE, 0x62, 0x7E, 0x94, 0xC4, 0x71, 0xEC, 0x76, 0x81,
+    0x77, 0x61, 0x80, 0xD8, 0x6F, 0x6F, 0xCD, 0xDD, 0xC3, 0xA5, 0x7B, 0x2C, 0x92, 0x4E, 0x53, 0xBF,
+    0x81, 0xE0, 0x20, 0x54, 0x44, 0xED, 0xCD, 0x9F, 0x90, 0xD0, 0x4A, 0x20, 0x38, 0xC2, 0x26, 0x44,
+    0x2B, 0x71, 0x15, 0x45, 0x70, 0x26, 0xED, 0x71, 0x9A, 0xA7, 0x49, 0x26, 0x1A, 0xAC, 0x7E, 0xC5,
+    0x22, 0xAF, 0x99, 0xAA, 0x99, 0x0C, 0x07, 0x48, 0xCB, 0x58, 0x39, 0xEA, 0xB8, 0x87, 0x18, 0x76,
+    0x12, 0x48, 0x17, 0xA8, 0x9B, 0x45, 0xE4, 0xF7, 0xDE, 0x5E, 0xA0, 0x56, 0xCF, 0x8A, 0xC9, 0x8C,
+    0x30, 0x66, 0x6A, 0x5D, 0x19, 0xE8, 0x8F, 0xF4, 0xBA, 0xEB, 0xEB, 0x59, 0x07, 0xC5, 0xC5, 0x8A,
+    0x8F, 0xC6, 0x55, 0x33, 0xF8, 0x63, 0x10, 0xDA, 0x3A, 0x03, 0xA5, 0xCA, 0x43, 0x6D, 0xC9, 0x8A,
+    0x83, 0x6D, 0x27, 0x33, 0x76, 0xAE, 0xF1, 0x32, 0xEB, 0xA0, 0x31, 0x8B, 0xBE, 0x1C, 0xB4, 0x9A,
+    0x6B, 0x5F, 0x44, 0xCC, 0x81, 0x16, 0x85, 0x59, 0xCC, 0x54, 0xDC, 0xFC, 0x8A, 0xC3, 0x11, 0xAF,
+    0x06, 0xD2, 0x13, 0xDE, 0xB5, 0x76, 0xEF, 0x75, 0x73, 0x04, 0xAF, 0xC9, 0x6E, 0x80, 0x9E, 0x9E,
+    0x9A, 0x51, 0x45, 0x24, 0x1A, 0x4A, 0x57, 0x7C, 0x6A, 0xDF, 0x60, 0xAE, 0x83, 0xCC, 0xA2, 0xBD,
+    0x79, 0x2B, 0x67, 0x5A, 0xD5, 0x52, 0x44, 0xEA, 0xD2, 0x31, 0xC5, 0xE8, 0x01, 0x15, 0x3D, 0xD5,
+    0x8E, 0xB4, 0x43, 0x3C, 0xF4, 0x60, 0xA2, 0xE0, 0x0B, 0xEF, 0xAB, 0x31, 0xE8, 0xFE, 0xF7, 0x96,
+    0xEE, 0xDD, 0xA0, 0xFB, 0x74, 0x9D, 0x14, 0x48, 0x9A, 0x74, 0x2C, 0xD9, 0x22, 0x8D, 0x73, 0xCD,
+    0x34, 0x4C, 0x25, 0xC8, 0x01, 0x0D, 0xBD, 0x06, 0xD8, 0x58, 0xBE, 0xA0, 0x63, 0xA2, 0x0F, 0x41,
+    0x42, 0xB5, 0x90, 0x41, 0xCE, 0xA9, 0x41, 0x14, 0xAE, 0x5E, 0x15, 0x3B, 0x13, 0xF4, 0x52, 0x70,
+    0x3F, 0x4C, 0x15, 0x52, 0x94, 0x6B, 0xE5, 0x36, 0x9E, 0xEB, 0x52, 0x79, 0x9F, 0xD0, 0x05, 0x90,
+    0x0B, 0x5F, 0x47, 0x40, 0xB5, 0x1E, 0x2E, 0x62, 0xC1, 0x56, 0x47, 0x65, 0xDB, 0x40, 0x80, 0xC6,
+    0x46, 0x26, 0x6C, 0x30, 0xC9, 0x06, 0x93, 0x6C, 0x48, 0xAF, 0x6C, 0x8F, 0x9B, 0x49, 0x33, 0xCA,
+    0x94, 0x9D, 0x66, 0x6B, 0xFE, 0x06, 0x6B, 0x91, 0xF8, 0x09, 0xD4, 0x20, 0x47, 0x7D, 0xCB, 0x51,
+    0x9D, 0x01, 0x60, 0x27, 0xD5, 0xDA, 0x06, 0xA0, 0x50, 0x82, 0x96, 0xCD, 0x15, 0xE8, 0x7A, 0x4A,
+    0xD0, 0xDD, 0xA8, 0xE7, 0x32, 0x45, 0x34, 0x96, 0x16, 0x61, 0x7C, 0x00, 0xB3, 0x6A, 0x4A, 0x25,
+    0x1F, 0xEA, 0x15, 0x75, 0xA2, 0x17, 0xEA, 0x7C, 0x83, 0xB4, 0x4C, 0x18, 0x78, 0x6C, 0x25, 0x42,
+    0x13, 0x64, 0xF0, 0xB0, 0x92, 0xC1, 0x22, 0x14, 0x16, 0x3A, 0x40, 0x90, 0x2B, 0x51, 0x9B, 0xAE,
+    0x5C, 0x88, 0x7B, 0x04, 0xCE, 0xB6, 0x42, 0x84, 0x94, 0x6A, 0x4A, 0xDD, 0xA6, 0x93, 0x4B, 0x17,
+    0xB5, 0x99, 0xA4, 0x3E, 0x3D, 0xD0, 0x07, 0xDF, 0xA4, 0x21, 0x92, 0x54, 0x0B, 0x5D, 0x23, 0x65,
+    0xB7, 0xCB, 0xC8, 0x30, 0xE3, 0xA8, 0x99, 0xE7, 0x86, 0x71, 0x9D, 0x96, 0x6E, 0xDC, 0x79, 0x44,
+    0xFC, 0xFD, 0xA2, 0x96, 0xD6, 0xD7, 0x6F, 0x58, 0x62, 0xC5, 0xBD, 0xEE, 0x4B, 0x46, 0x64, 0xB8,
+    0x15, 0xDD, 0x04, 0x1B, 0x82, 0xB7, 0x2B, 0x1D, 0x41, 0x23, 0x18, 0x34, 0x82, 0x72, 0x8B, 0x9B,
+    0xCC, 0x24, 0x19, 0x23, 0xFA, 0xF4, 0xFC, 0xFC, 0x67, 0x03, 0xF8, 0x0E, 0xCF, 0x37, 0xE7, 0xE7,
+    0x3F, 0x89, 0xEA, 0xC7, 0x78, 0x7E, 0x81, 0xF3, 0x7B, 0xE8, 0x0D, 0xF7, 0x3F, 0x27, 0xBA, 0x28,
+    0xDF, 0x1D, 0xE1, 0x54, 0xF0, 0xA2, 0x86, 0x17, 0xF8, 0x76, 0x4A, 0xA4, 0x18, 0x4D, 0x64, 0x60,
+    0x14, 0x51, 0x8F, 0xF4, 0x39, 0xAA, 0x1E, 0x01, 0xEF, 0xB3, 0x2F, 0xF1, 0xF1, 0xD9, 0x76, 0x91,
+    0x70, 0x7E, 0x92, 0xC2, 0xA2, 0x0A, 0x9D, 0xA7, 0xC4, 0xC7, 0x02, 0x60, 0x4A, 0x72, 0x27, 0x09,
+    0xB9, 0xC0, 0x73, 0x53, 0xB8, 0x15, 0x06, 0x24, 0xAD, 0xE8, 0x2F, 0x35, 0x14, 0xA5, 0xE9, 0x80,
+    0x39, 0x2A, 0xDE, 0x3A, 0x28, 0xC3, 0x22, 0xDE, 0x80, 0x72, 0xDD, 0xD3, 0x4D, 0x98, 0x1B, 0x14,
+    0x63, 0x63, 0xF5, 0xC6, 0x4A, 0x26, 0x47, 0x92, 0x3B, 0x1E, 0x5A, 0x10, 0x1D, 0xBA, 0xD4, 0x36,
+    0x7F, 0x51, 0xE6, 0x26, 0x56, 0xCD, 0x66, 0xDF, 0x18, 0xD9, 0x5F, 0x4B, 0x8B, 0x9A, 0x41, 0xE6,
+    0x06, 0x85, 0x55, 0x56, 0x63, 0x9E, 0xF2, 0xAB, 0xF0, 0x51, 0xD6, 0x7F, 0x99, 0xB1, 0xDA, 0xD7,
+    0xCB, 0xBE, 0x39, 0xE6, 0x9E, 0x79, 0xB7, 0x72, 0x6C, 0xEF, 0xA6, 0x0E, 0x49, 0x75, 0x48, 0x74,
+    0x03, 0xE7, 0x18, 0xCD, 0x87, 0xAC, 0xB0, 0x6D, 0x6B, 0x4F, 0xDA, 0x2E, 0x12, 0xDD, 0x0A, 0xC4,
+    0x1D, 0x80, 0xF8, 0x87, 0x11, 0x3C, 0x2E, 0x77, 0x90, 0xB2, 0xE5, 0xAB, 0xEF, 0x06, 0x70, 0x4E,
+    0x69, 0x40, 0x62, 0x7B, 0x19, 0x5C, 0x81, 0x2C, 0xCB, 0x81, 0xF0, 0x5E, 0xDC, 0x75, 0x4C, 0xD6,
+    0xFC, 0x03, 0x77, 0xED, 0x5B, 0x60, 0xC5, 0xCE, 0x52, 0xBD, 0xA0, 0x17, 0x77, 0xB7, 0x24, 0x83,
+    0x0F, 0x31, 0x4C, 0x12, 0xFD, 0x6F, 0x0D, 0xBC, 0xA9, 0x94, 0xEE, 0x77, 0x97, 0x4B, 0x8B, 0x9F,
+    0xF3, 0x6A, 0xF8, 0x29, 0xEF, 0x79, 0xD1, 0xE3, 0x81, 0xA5, 0xD4, 0xE9, 0xD3, 0x9F, 0x42, 0x99,
+    0xEC, 0x12, 0x01, 0xA9, 0x99, 0x6F, 0x7D, 0x7F, 0x3D, 0xD0, 0x58, 0xCB, 0x5E, 0xFD, 0xB7, 0x4F,
+    0xC1, 0x17, 0x89, 0x8B, 0xAE, 0xDF, 0xEF, 0x33, 0xA8, 0x4D, 0x05, 0x7D, 0xD8, 0xF3, 0x21, 0x3D,
+    0xD5, 0x9C, 0xF9, 0xF5, 0xD4, 0xB2, 0x43, 0xB1, 0x22, 0xCB, 0x3F, 0x52, 0x03, 0xD3, 0xA1, 0xA7,
+    0x72, 0xD9, 0x50, 0x00, 0xAF, 0x72, 0xDD, 0xA2, 0x17, 0x89, 0xB5, 0x54, 0x74, 0x03, 0xFD, 0x41,
+    0xF4, 0x4F, 0x92, 0x52, 0xE7, 0x90, 0x80, 0xED, 0x54, 0x59, 0xA9, 0x92, 0x3B, 0x2D, 0xC5, 0x0D,
+    0x24, 0x90, 0xA7, 0x51, 0xE4, 0x1D, 0x8A, 0xFC, 0x54, 0x6E, 0xD9, 0x06, 0x30, 0x0A, 0x80, 0xFA,
+    0x35, 0x6E, 0x87, 0xBB, 0xE4, 0x31, 0x83, 0xE9, 0xB0, 0xC5, 0x06, 0x2F, 0xE0, 0x4A, 0xA3, 0x06,
+    0x04, 0xE0, 0x6B, 0xD1, 0xF7, 0x29, 0xCA, 0x4B, 0x4A, 0x57, 0x4F, 0x58, 0x24, 0x7D, 0x94, 0x26,
+    0x9C, 0x9F, 0x9E, 0xD0, 0xFF, 0xF9, 0xFB, 0x17, 0xBD, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D,
+    0xDB, 0x77, 0x31, 0x92, 0x0B, 0xA7, 0xE0, 0x90, 0xC8, 0x57, 0xF8, 0x0F, 0x80, 0xDC, 0x52, 0x04,
+    0xED, 0x42, 0x43, 0x41, 0x73, 0x48, 0x39, 0x45, 0x74, 0x94, 0x74, 0xA1, 0xA4, 0xB3, 0x51, 0x4A,
+    0x1A, 0x7E, 0x44, 0x68, 0x3E, 0x0A, 0x5A, 0x8A, 0xE8, 0xD6, 0x57, 0x51, 0xA4, 0x88, 0xA1, 0xBD,
+    0x22, 0x96, 0xA0, 0x4B, 0xE3, 0xC0, 0x4A, 0xB7, 0x70, 0xFB, 0x79, 0x78, 0x6F, 0x7D, 0x77, 0x21,
+    0xE1, 0x12, 0x41, 0x83, 0x25, 0xEF, 0xBD, 0x6F, 0x3D, 0x3B, 0xFB, 0x66, 0xE6, 0xCD, 0x9C, 0xC8,
+    0xFA, 0x6C, 0x74, 0x94, 0x7B, 0x8B, 0x6D, 0x54, 0x07, 0xA7, 0x4B, 0xA1, 0xBA, 0xD4, 0xAA, 0x1E,
+    0x3F, 0x67, 0x87, 0xAD, 0x50, 0xE8, 0x47, 0x63, 0x1D, 0xF7, 0xA4, 0xF1, 0x37, 0x45, 0x07, 0xC9,
+    0xD5, 0x4A, 0x1D, 0x45, 0xCC, 0x2C, 0x99, 0xF6, 0xD2, 0xEC, 0x44, 0xDC, 0x2C, 0x15, 0xA0, 0xD9,
+    0x49, 0xA1, 0x93, 0x34, 0x30, 0x50, 0x0F, 0x38, 0x48, 0x0B, 0x3B, 0xEC, 0x14, 0x8B, 0xE0, 0xB4,
+    0x48, 0x87, 0xD3, 0x80, 0x55, 0xC0, 0xE9, 0x51, 0x5E, 0xF1, 0x34, 0x13, 0x1C, 0x5A, 0x1C, 0x07,
+    0xC4, 0xF1, 0xCE, 0xE3, 0xC6, 0x41, 0x4A, 0xFC, 0xA4, 0x37, 0x9C, 0xCB, 0x00, 0xE5, 0x50, 0x24,
+    0xB3, 0x57, 0x67, 0xEE, 0xA9, 0xCD, 0xF4, 0x44, 0x35, 0x8A, 0xCE, 0xAA, 0xDA, 0x9B, 0x40, 0xF6,
+    0x75, 0x2C, 0xA6, 0x7A, 0x87, 0x93, 0xF8, 0xF8, 0x01, 0xF8, 0x89, 0x1B, 0xDD, 0x48, 0xE2, 0xA0,
+    0x0E, 0xBF, 0x0C, 0xC2, 0x05, 0x72, 0xD3, 0x90, 0xAD, 0x9C, 0x41, 0x10, 0xB1, 0xB4, 0xB3, 0x98,
+    0x49, 0xEA, 0x20, 0xCD, 0x2C, 0xC5, 0x2E, 0xD1, 0xD5, 0x74, 0xCD, 0x81, 0x7D, 0x99, 0x69, 0x11,
+    0x99, 0x8B, 0x5C, 0xFB, 0x92, 0x0E, 0xA6, 0x0C, 0x4C, 0x8D, 0x27, 0xC9, 0x2A, 0x26, 0x7E, 0x77,
+    0xAE, 0x8C, 0x0B, 0xB5, 0x1B, 0x70, 0xE8, 0x7C, 0xAB, 0x6A, 0x4B, 0x2D, 0x49, 0xD6, 0x4D, 0x46,
+    0x15, 0x14, 0x33, 0x0F, 0x92, 0x38, 0x0A, 0x6A, 0x24, 0x55, 0x68, 0x96, 0xD8, 0x4E, 0xCC, 0x59,
+    0x1B, 0x73, 0x5C, 0x5E, 0xAB, 0x05, 0xE9, 0x52, 0x47, 0xD0, 0xCD, 0x90, 0x51, 0xDC, 0x80, 0x7B,
+    0xCA, 0x28, 0xE5, 0x2E, 0xA5, 0x15, 0xF6, 0xA0, 0x59, 0x23, 0xAE, 0x83, 0x6B, 0x33, 0xDA, 0x0E,
+    0x4C, 0x68, 0xB9, 0xA4, 0x5A, 0x29, 0xCB, 0x25, 0xF5, 0x92, 0xB2, 0x89, 0xC3, 0x4C, 0xE6, 0xE1,
+    0x6A, 0x0A, 0x3E, 0xFA, 0x04, 0xEF, 0x19, 0xDE, 0x78, 0x74, 0x74, 0x17, 0x36, 0x29, 0xDD, 0x88,
+    0x4E, 0xDC, 0xB0, 0x96, 0x0D, 0xB9, 0x61, 0x66, 0x98, 0x20, 0x86, 0xC9, 0x14, 0xA5, 0x6A, 0x31,
+    0x87, 0x92, 0x88, 0xC3, 0xB0, 0x83, 0xD1, 0xC1, 0xD1, 0x1D, 0x5C, 0x84, 0x70, 0x21, 0xA3, 0x85,
+    0xC0, 0x3F, 0x44, 0x59, 0x1E, 0xB1, 0x4E, 0x04, 0xA7, 0x00, 0x3B, 0x82, 0xA7, 0x00, 0xCB, 0x0B,
+    0x3B, 0x57, 0x36, 0x1F, 0x03, 0x4C, 0x00, 0xBE, 0x3A, 0x41, 0x2E, 0x1E, 0x36, 0x56, 0xFE, 0x3B,
+    0x78, 0xFE, 0x90, 0x03, 0xE4, 0x9D, 0x34, 0xA2, 0xF0, 0xFE, 0xE1, 0xEF, 0xE0, 0xD4, 0x9A, 0x4B,
+    0xD0, 0x01, 0x9C, 0xBD, 0xB0, 0x43, 0xF0, 0x1B, 0x01, 0x8C, 0xBF, 0x63, 0x37, 0x68, 0xCE, 0xE3,
+    0xD9, 0x76, 0xBB, 0xBD, 0xF0, 0xB7, 0x08, 0x76, 0x77, 0x6B, 0x70, 0xE8, 0x9A, 0x47, 0x03, 0x89,
+    0x03, 0x9C, 0x0E, 0x8C, 0x09, 0xE0, 0xE9, 0x3F, 0x00, 0x3F, 0xC5, 0xE3, 0xEF, 0x55, 0xBF, 0xD6,
+    0xB5, 0xC5, 0xE2, 0x8D, 0xED, 0xF6, 0x01, 0xDC, 0x51, 0x5D, 0x5D, 0xBF, 0x76, 0x40, 0x35, 0xCB,
+    0xBB, 0x39, 0xC4, 0xE5, 0x77, 0xA8, 0xBA, 0xCA, 0x27, 0xAC, 0x47, 0x06, 0x5B, 0x28, 0x41, 0x87,
+    0x5A, 0xBF, 0xFA, 0xAC, 0x3E, 0x9F, 0xA5, 0x09, 0x0B, 0x34, 0x80, 0xDA, 0xBE, 0x5F, 0x06, 0xC9,
+    0x04, 0xC5, 0x92, 0x9B, 0x42, 0xD1, 0xB9, 0xA1, 0x9B, 0xDB, 0x08, 0x51, 0x1D, 0x5F, 0xD7, 0x61,
+    0xE8, 0x41, 0xED, 0xDB, 0xA9, 0x0A, 0x00, 0x5D, 0xDF, 0x8C, 0x85, 0x5F, 0x75, 0x7A, 0x24, 0x2C,
+    0x22, 0xBD, 0x38, 0x45, 0x4D, 0xDB, 0x3E, 0x87, 0x50, 0xD0, 0x7A, 0x43, 0x06, 0x42, 0xEF, 0xC8,
+    0x6D, 0x7C, 0x98, 0x32, 0x2C, 0x7B, 0xF2, 0xBF, 0x3E, 0x5F, 0x80, 0x71, 0x5F, 0x21, 0x39, 0x5F,
+    0x92, 0x42, 0x23, 0xF9, 0x44, 0x56, 0xF5, 0xAF, 0x9B, 0x99, 0x7A, 0x8D, 0x6C, 0xFF, 0x3F, 0x92,
+    0x61, 0x1A, 0x08, 0x54, 0x23, 0xDB, 0x12, 0x0B, 0xF4, 0xF9, 0x5E, 0xC1, 0xB1, 0x73, 0x1F, 0x96,
+    0xD0, 0xD1, 0x3E, 0x6B, 0xA5, 0x08, 0x91, 0x31, 0x76, 0x58, 0x72, 0xF5, 0x9F, 0x4A, 0xB5, 0xC0,
+    0xB8, 0x7D, 0xC6, 0x65, 0xC2, 0x7E, 0x39, 0x50, 0xCA, 0x9C, 0x40, 0x6B, 0x32, 0xF9, 0x37, 0x5B,
+    0x2E, 0x17, 0x94, 0x24, 0xD5, 0x45, 0xCC, 0xCF, 0x81, 0x3E, 0xE6, 0x7D, 0x2C, 0x50, 0x78, 0x2A,
+    0x0D, 0xBB, 0x07, 0x17, 0xC5, 0xB7, 0x30, 0xF0, 0xC0, 0x82, 0xD5, 0x41, 0xA3, 0x38, 0x30, 0x19,
+    0x59, 0x56, 0x6B, 0xFA, 0x0B, 0x9F, 0x89, 0xE0, 0xE2, 0xA6, 0xF6, 0xC9, 0x52, 0x44, 0x37, 0x75,
+    0xF7, 0x23, 0x3B, 0x97, 0x13, 0x6E, 0x4C, 0xD4, 0x61, 0x8D, 0x0D, 0x5E, 0x78, 0xB1, 0x01, 0x36,
+    0x17, 0x1B, 0x66, 0x78, 0xBE, 0xD1, 0x9E, 0x2C, 0xA5, 0x9A, 0xC1, 0x9D, 0x85, 0x4A, 0x9D, 0x65,
+    0x6B, 0x1E, 0xCA, 0xE6, 0x4F, 0x12, 0xFE, 0x9C, 0x32, 0xFD, 0x46, 0x24, 0x52, 0x98, 0xFA, 0xED,
+    0x26, 0x36, 0x9A, 0x1E, 0x6F, 0x86, 0x0C, 0xC2, 0xD3, 0xD1, 0xA4, 0xA1, 0xA9, 0xF2, 0x66, 0x1A,
+    0x6B, 0x87, 0xEB, 0x40, 0xAD, 0xD2, 0xF0, 0x56, 0xDB, 0x8C, 0xB9, 0x47, 0xF3, 0x34, 0x35, 0x82,
+    0x3E, 0xC5, 0xA7, 0xDB, 0xF6, 0xAA, 0xE6, 0x05, 0x78, 0xEE, 0xD5, 0x83, 0x95, 0x60, 0xAA, 0xBE,
+    0x0A, 0xD1, 0xD9, 0xFA, 0xFC, 0x3C, 0x26, 0x51, 0x62, 0x89, 0x29, 0x19, 0xCF, 0x78, 0xD3, 0x8F,
+    0x5C, 0xE0, 0x2D, 0x50, 0x4C, 0x81, 0x9D, 0x12, 0xC4, 0x3D, 0x7E, 0xEC, 0x25, 0x9A, 0x7A, 0x90,
+    0x3E, 0xBE, 0xB1, 0xFA, 0x92, 0xFD, 0x75, 0xA4, 0xE2, 0x76, 0x4E, 0x32, 0x8C, 0xA5, 0xF4, 0x72,
+    0x50, 0xE5, 0xE1, 0x65, 0x21, 0xDC, 0xB0, 0xE9, 0xBF, 0x0E, 0x27, 0xDF, 0xFA, 0x02, 0x57, 0xFD,
+    0x75, 0x92, 0xC9, 0x1E, 0xAC, 0x3E, 0xFE, 0xEE, 0x0F, 0x7B, 0xE6, 0x64, 0xA9, 0x82, 0x19, 0xF1,
+    0xFE, 0xA4, 0x15, 0x66, 0x7E, 0x02, 0x98, 0x69, 0x04, 0x63, 0x19, 0xCC, 0xA0, 0xE8, 0x23, 0xBC,
+    0x2D, 0x34, 0x80, 0xB7, 0x00, 0x28, 0x7C, 0x03, 0xE0, 0xE5, 0x98, 0xE0, 0xF8, 0x92, 0x2B, 0x1B,
+    0x75, 0x5C, 0x27, 0x40, 0xFA, 0xE1, 0x18, 0x4A, 0xBA, 0x45, 0xD8, 0x37, 0xAF, 0x53, 0x33, 0x83,
+    0x90, 0xB7, 0x39, 0x2F, 0x31, 0x3C, 0x19, 0x85, 0xE8, 0x2F, 0x1C, 0x9C, 0xF5, 0xC2, 0x70, 0x44,
+    0xC7, 0x1F, 0x28, 0x33, 0xFF, 0x3A, 0x17, 0x8C, 0xEE, 0x15, 0x0C, 0x76, 0xE9, 0xC7, 0x2D, 0xFB,
+    0xAF, 0x1A, 0xEB, 0x2F, 0x9D, 0x55, 0x3F, 0x6C, 0x1E, 0x35, 0x14, 0xF7, 0xDD, 0xF1, 0xF5, 0xA4,
+    0x9E, 0x84, 0xA7, 0x2C, 0x59, 0x3C, 0x53, 0x21, 0x79, 0x05, 0xA9, 0xD4, 0x57, 0x32, 0x64, 0x60,
+    0x48, 0x87, 0x54, 0x1D, 0xBA, 0x32, 0xB0, 0x75, 0x65, 0x00, 0xF9, 0x80, 0x81, 0xB1, 0xEC, 0x0C,
+    0x64, 0xC8, 0x40, 0x03, 0x52, 0x18, 0x18, 0x5A, 0x29, 0x8D, 0x1D, 0x32, 0x30, 0x74, 0xE0, 0x00,
+    0xA1, 0x0E, 0x19, 0xB8, 0x14, 0x10, 0x12, 0x2C, 0xAE, 0xB8, 0x56, 0x47, 0xB0, 0xFD, 0xF8, 0xD9,
+    0xDF, 0x97, 0xB4, 0xAA, 0x48, 0x09, 0x9C, 0xEF, 0xFC, 0xF9, 0xDF, 0x7B, 0xEF, 0xE7, 0xF7, 0x7E,
+    0xEF, 0x7D, 0xB3, 0x96, 0x31, 0x36, 0x2B, 0x09, 0x7D, 0xED, 0xD5, 0x88, 0x1F, 0xFA, 0x89, 0xB0,
+    0xC6, 0xA3, 0x72, 0x98, 0x98, 0xFE, 0x2E, 0xFA, 0x32, 0xAD, 0x9F, 0xFE, 0x6C, 0xE6, 0x5E, 0x0F,
+    0xA9, 0x6F, 0x28, 0x4F, 0x4C, 0x12, 0x66, 0x75, 0xCC, 0x93, 0xE5, 0xF6, 0x79, 0xD2, 0xE7, 0xBB,
+    0x74, 0xA4, 0x4A, 0x72, 0x7C, 0x81, 0xE0, 0xFB, 0x8C, 0x20, 0x64, 0x04, 0x64, 0x3F, 0x45, 0x5F,
+    0x6C, 0x14, 0xAD, 0xD9, 0xA7, 0x35, 0xAC, 0xE9, 0x53, 0xB5, 0x35, 0x1D, 0xCD, 0x8F, 0x2C, 0x63,
+    0x22, 0x93, 0x5A, 0x1E, 0xD2, 0x3A, 0x25, 0x64, 0x3C, 0x63, 0xD1, 0x36, 0xF5, 0x57, 0x4E, 0xD3,
+    0x50, 0xE0, 0x7B, 0xA1, 0xC4, 0x49, 0x3E, 0x02, 0x49, 0x41, 0x5F, 0x03, 0x88, 0xF4, 0xC0, 0x51,
+    0xD0, 0x1E, 0x54, 0x35, 0xEE, 0xB9, 0x7E, 0x28, 0x7F, 0xCE, 0x57, 0xEF, 0x4F, 0xAC, 0x65, 0xC3,
+    0x4D, 0xC6, 0xB0, 0x3C, 0x3F, 0x72, 0x2B, 0xF7, 0xD5, 0x94, 0x6C, 0xB5, 0x7C, 0x28, 0x5A, 0x20,
+    0x52, 0x9D, 0xB6, 0x15, 0x75, 0x11, 0x1F, 0x8F, 0xD5, 0x04, 0x51, 0x39, 0xF2, 0x41, 0x8E, 0x4C,
+    0xB6, 0xAA, 0x93, 0xE9, 0xB6, 0xF1, 0x89, 0x14, 0x54, 0x43, 0xE9, 0xF9, 0xAD, 0x2D, 0xF3, 0xDB,
+    0xD6, 0x2D, 0x45, 0xE9, 0x99, 0x72, 0x8F, 0xB0, 0xE5, 0x07, 0xD7, 0x56, 0x5D, 0x3E, 0xF8, 0x94,
+    0xD4, 0xB9, 0x8F, 0xF8, 0x70, 0xAE, 0x03, 0x34, 0xD5, 0x99, 0x85, 0xAD, 0x36, 0xDB, 0x0A, 0x73,
+    0x5B, 0x0E, 0x31, 0x52, 0xDD, 0x05, 0xF6, 0xAC, 0xAD, 0xC5, 0xA3, 0xF7, 0xE9, 0x66, 0x54, 0xD3,
+    0xDC, 0x79, 0xF3, 0x6D, 0x35, 0xC1, 0xE0, 0x87, 0xBE, 0x38, 0x0E, 0x86, 0x5C, 0xA1, 0x35, 0x1C,
+    0x31, 0xFD, 0x5B, 0x6C, 0xB6, 0x1A, 0xCD, 0x5F, 0xA4, 0x0F, 0x37, 0x59, 0x71, 0x5B, 0xFF, 0x4E,
+    0xE6, 0x8F, 0x30, 0xC3, 0xFE, 0x3D, 0xC2, 0xA2, 0xB4, 0x6C, 0x56, 0x85, 0xBC, 0x7B, 0x9B, 0xE8,
+    0xDA, 0x0F, 0x65, 0x97, 0x5A, 0x65, 0x89, 0xE6, 0xA3, 0x7F, 0x6F, 0x45, 0x4B, 0xF4, 0xCB, 0xF5,
+    0xBE, 0x4E, 0x6D, 0x68, 0xFE, 0x8B, 0x9C, 0x89, 0xCA, 0xCB, 0x89, 0xBB, 0x66, 0xA8, 0xEC, 0x59,
+    0xA5, 0x92, 0x5C, 0x8A, 0x54, 0x65, 0xEB, 0x9E, 0x3B, 0x31, 0x2A, 0x6F, 0xE2, 0xD9, 0x25, 0xCB,
+    0xAE, 0x19, 0x5E, 0x7E, 0xE5, 0x8B, 0x17, 0x2F, 0x5E, 0xE4, 0xEE, 0xEC, 0x36, 0x71, 0xC3, 0xEE,
+    0x5A, 0xF7, 0x7F, 0x3C, 0xC3, 0x96, 0xC0, 0x53, 0x57, 0x93, 0xE7, 0x14, 0xE4, 0x83, 0xA8, 0xF6,
+    0xA2, 0x7E, 0x2F, 0x9A, 0xD7, 0x03, 0xE1, 0xAD, 0x3C, 0xD5, 0x9E, 0xD6, 0x46, 0x43, 0x4E, 0x91,
+    0x15, 0xC4, 0x0A, 0x24, 0xC1, 0x97, 0x8D, 0x13, 0x1D, 0x2B, 0x37, 0x84, 0xDD, 0xAD, 0x46, 0x6E,
+    0x75, 0xE9, 0x9B, 0x41, 0xB5, 0xBE, 0x76, 0x4B, 0xF3, 0xB0, 0x36, 0x9E, 0x95, 0x64, 0x99, 0x9E,
+    0x98, 0xA0, 0xB6, 0x22, 0xC7, 0x02, 0x31, 0x75, 0x73, 0x68, 0x0E, 0x43, 0xE9, 0x65, 0x0F, 0xF6,
+    0xED, 0x13, 0xF9, 0x0B, 0xDB, 0x11, 0x2C, 0x6E, 0x9F, 0x4A, 0x0E, 0x43, 0x56, 0x91, 0xE3, 0x34,
+    0xD5, 0x43, 0x2E, 0x1D, 0x14, 0x98, 0xA2, 0xFE, 0xDC, 0xB6, 0xC7, 0x10, 0xEC, 0xB4, 0x8C, 0xBB,
+    0x3B, 0x37, 0x46, 0x89, 0x7D, 0x1A, 0xD9, 0x2C, 0x39, 0x78, 0x9D, 0x19, 0x50, 0x32, 0xF0, 0xF8,
+    0xB9, 0xEC, 0x13, 0x7D, 0xB5, 0xEE, 0x0D, 0x8D, 0x74, 0x30, 0x01, 0x77, 0x4C, 0xEF, 0x64, 0x3E,
+    0x01, 0xEE, 0x81, 0x23, 0x1F, 0xD7, 0x73, 0x65, 0x21, 0xFA, 0x8E, 0xC8, 0x19, 0x02, 0xC2, 0xC0,
+    0x8A, 0x98, 0x35, 0x1B, 0xE0, 0xE8, 0x92, 0x7E, 0x28, 0x11, 0x0E, 0x56, 0x58, 0x33, 0xA1, 0xAA,
+    0xCD, 0x41, 0xC1, 0x8E, 0x04, 0x7A, 0x72, 0xE2, 0x41, 0xA8, 0x9D, 0xBE, 0x1C, 0x25, 0x40, 0xF6,
+    0xC8, 0x85, 0x86, 0xC6, 0xE6, 0x4F, 0x5A, 0x9D, 0xC4, 0x61, 0xA8, 0x27, 0xFD, 0x41, 0xE0, 0x44,
+    0x8C, 0x62, 0xC2, 0x04, 0x7F, 0x96, 0xC9, 0xE6, 0x24, 0x7F, 0xF5, 0xAA, 0x0B, 0xBA, 0x0D, 0xFA,
+    0x72, 0x50, 0x07, 0x41, 0xC1, 0xC3, 0x47, 0x3E, 0xE5, 0x08, 0x77, 0x5B, 0xD4, 0x13, 0xB5, 0x34,
+    0xB1, 0xAB, 0xB0, 0xF1, 0x36, 0x2B, 0x1C, 0xAB, 0x61, 0x1F, 0x76, 0x90, 0x95, 0x03, 0x86, 0x82,
+    0xB1, 0x77, 0x50, 0xBD, 0x98, 0xA6, 0x47, 0x44, 0xDF, 0x5E, 0x4D, 0xA7, 0x78, 0x4A, 0xD3, 0xEC,
+    0xAC, 0x93, 0xD1, 0x4B, 0x6C, 0xA7, 0x1C, 0xAB, 0x81, 0x5B, 0xD1, 0x2A, 0x76, 0x89, 0xBD, 0xCB,
+    0x76, 0x98, 0x5F, 0xB4, 0x1D, 0xB4, 0xD7, 0xB0, 0x86, 0x02, 0xF2, 0x26, 0xB4, 0x55, 0x3D, 0xD6,
+    0x24, 0x6B, 0x6C, 0xE9, 0xB0, 0x21, 0x19, 0xB7, 0xD5, 0x50, 0x8C, 0x18, 0x5E, 0xC2, 0x44, 0x74,
+    0xDC, 0x36, 0x16, 0x89, 0x5E, 0xBE, 0xBF, 0xD1, 0x7C, 0xE3, 0x79, 0x8C, 0xDC, 0xED, 0x72, 0xBB,
+    0x2B, 0xEC, 0x5D, 0xD9, 0x7A, 0xC5, 0xBC, 0x2A, 0xBC, 0x2E, 0x27, 0x04, 0x7B, 0x1D, 0xE1, 0x87,
+    0x47, 0x16, 0x6C, 0x89, 0xF2, 0x61, 0x54, 0x3D, 0xA9, 0x3D, 0xCA, 0x84, 0x89, 0x66, 0x25, 0x98,
+    0x15, 0x6F, 0xDE, 0x98, 0x74, 0x62, 0x4B, 0x0F, 0xAF, 0x17, 0xEB, 0xF3, 0x2C, 0x1F, 0x6A, 0x6A,
+    0x8D, 0x17, 0xC9, 0xF3, 0xF6, 0x51, 0x2C, 0x9A, 0x31, 0xB9, 0x9B, 0x58, 0xE5, 0x99, 0x18, 0xE0,
+    0x7F, 0xFC, 0xF2, 0x7C, 0xB3, 0xD9, 0x15, 0x78, 0xBB, 0xCD, 0x2C, 0x88, 0xCC, 0x22, 0x2A, 0xA2,
+    0x4F, 0x3B, 0x7C, 0x4C, 0xAF, 0x40, 0x69, 0x73, 0xD0, 0x05, 0x2F, 0x05, 0x41, 0xB4, 0x4A, 0x64,
+    0x17, 0x11, 0xD2, 0x39, 0x42, 0xCD, 0x67, 0x88, 0x99, 0x81, 0x35, 0x3B, 0xD3, 0x29, 0x42, 0x20,
+    0x35, 0x88, 0x9D, 0xE6, 0xD0, 0xB1, 0x7B, 0xC3, 0x4B, 0xF2, 0x35, 0x3C, 0x3E, 0x5B, 0x94, 0x71,
+    0x0D, 0xCA, 0x38, 0xA6, 0x3C, 0x53, 0xA8, 0x9C, 0xD4, 0xC9, 0x1F, 0x7B, 0x71, 0xCF, 0x89, 0x7D,
+    0xCF, 0xFB, 0x88, 0x02, 0xF1, 0x18, 0x14, 0xDD, 0xDA, 0x3E, 0x4A, 0x10, 0x8B, 0x78, 0xCC, 0x50,
+    0x50, 0x49, 0x20, 0xEC, 0xE4, 0x2B, 0xA0, 0x85, 0x31, 0x9D, 0x24, 0x5D, 0xF9, 0x31, 0x4A, 0xF5,
+    0x1C, 0x6B, 0x33, 0xBE, 0x7A, 0x1D, 0x8E, 0xF1, 0xD5, 0xC2, 0x0E, 0xEE, 0x2F, 0xC8, 0x4A, 0x1A,
+    0xE4, 0xD1, 0x26, 0xA8, 0x05, 0xAE, 0x57, 0x47, 0xB1, 0x40, 0x88, 0xF5, 0x7D, 0x64, 0x82, 0x46,
+    0x1E, 0xED, 0xF9, 0xC6, 0xA9, 0x83, 0x09, 0x3A, 0x99, 0x99, 0x72, 0x76, 0xA1, 0x4C, 0x12, 0x1D,
+    0x12, 0x8D, 0x9A, 0xFC, 0x3F, 0x52, 0x74, 0xC8, 0x14, 0x1D, 0x13, 0x45, 0xAB, 0x63, 0x96, 0x66,
+    0xBF, 0x01, 0x0B, 0x7F, 0x18, 0xEB, 0x51, 0x75, 0x60, 0xA9, 0x4C, 0x2C, 0xB5, 0xB8, 0x70, 0x1D,
+    0x68, 0xC5, 0x73, 0x87, 0x7C, 0x50, 0x5F, 0xA5, 0x9B, 0x21, 0x67, 0x9E, 0xB0, 0x14, 0x76, 0xC5,
+    0xE3, 0xA0, 0x6C, 0x84, 0x4C, 0x7A, 0xEF, 0x47, 0x49, 0xA1, 0x39, 0x61, 0xA9, 0x19, 0x0C, 0x02,
+    0x37, 0xB1, 0xA5, 0x67, 0xFF, 0x3C, 0xFF, 0x06, 0x7D, 0x55, 0xB1, 0x8E, 0xDE, 0x44, 0x10, 0x1E,
+    0xDB, 0x4A, 0x2C, 0x9D, 0x8B, 0x4D, 0x11, 0x9A, 0x80, 0xB4, 0x2D, 0x4A, 0xB3, 0x2F, 0x00, 0x59,
+    0x27, 0x79, 0x00, 0x52, 0xDC, 0xD1, 0xA4, 0xA0, 0xA1, 0x44, 0x82, 0x07, 0x08, 0x59, 0xA3, 0x48,
+    0x34, 0x29, 0x72, 0x42, 0x74, 0x14, 0x04, 0xE9, 0x0A, 0x48, 0x73, 0x2F, 0x90, 0xDC, 0xEE, 0xE5,
+    0xCA, 0x14, 0x38, 0x89, 0xA8, 0x28, 0xE2, 0xA0, 0x80, 0x04, 0x57, 0xDC, 0x92, 0x6C, 0xC0, 0xB9,
+    0x5B, 0x7B, 0xF8, 0xC6, 0xFF, 0x1F, 0x5D, 0xC7, 0x16, 0x6B, 0x7B, 0x77, 0x66, 0xE7, 0x9B, 0x6F,
+    0xBE, 0x59, 0x53, 0x24, 0x45, 0x14, 0x49, 0x13, 0xCB, 0xA0, 0xF5, 0xE7, 0x06, 0x3E, 0x8F, 0x78,
+    0xDE, 0xDA, 0x6A, 0x89, 0x4A, 0xE6, 0x47, 0xD8, 0x91, 0x71, 0xFA, 0x7A, 0x81, 0x74, 0xAB, 0x3A,
+    0x15, 0x9A, 0xBE, 0x8A, 0x45, 0xA2, 0x4C, 0x97, 0xB0, 0x50, 0xF7, 0x65, 0xA4, 0xFB, 0x64, 0xA8,
+    0xEE, 0x29, 0x61, 0xA5, 0x09, 0x74, 0x97, 0xE8, 0x7D, 0x52, 0x6D, 0x25, 0xEB, 0x1A, 0xEB, 0xB0,
+    0xFD, 0x12, 0x96, 0x4D, 0xC0, 0xCA, 0x88, 0x57, 0x2B, 0xE7, 0x84, 0x26, 0xC0, 0x75, 0x9B, 0x8A,
+    0xE9, 0x62, 0xC3, 0x7B, 0xFA, 0x64, 0xB2, 0x5F, 0x65, 0x57, 0x64, 0x5F, 0x8C, 0x7B, 0x55, 0x9A,
+    0xEB, 0xE8, 0x75, 0x74, 0x3C, 0x98, 0x7F, 0xFB, 0x02, 0x70, 0xFC, 0xB6, 0xE6, 0xC7, 0xB3, 0xB9,
+    0xD3, 0xDF, 0x74, 0xF5, 0x3F, 0xCC, 0xB7, 0x79, 0xDB, 0xB4, 0xE4, 0xA9, 0x65, 0x2E, 0x38, 0xD3,
+    0x16, 0x0C, 0x3A, 0xC3, 0xFB, 0xB3, 0xBF, 0xD3, 0x3B, 0x57, 0xCC, 0x63, 0x7D, 0xD2, 0x1B, 0x6E,
+    0x27, 0xDF, 0x44, 0xE6, 0xCB, 0x1C, 0x69, 0x93, 0xCA, 0x9D, 0x8D, 0x6D, 0x73, 0x90, 0x29, 0x7B,
+    0x6A, 0x38, 0x90, 0x8B, 0x54, 0x4D, 0xF0, 0xEA, 0xC9, 0x30, 0xD5, 0xAF, 0x52, 0x31, 0x99, 0x80,
+    0xF8, 0x92, 0x64, 0xE1, 0xB7, 0x6B, 0x4E, 0xF5, 0xC7, 0xF8, 0x98, 0xE8, 0xCC, 0x54, 0xF3, 0xA4,
+    0x8F, 0xB3, 0xBD, 0x32, 0xDA, 0x3A, 0x5A, 0xEE, 0x35, 0xB7, 0xC5, 0x35, 0xD9, 0x41, 0x12, 0xA4,
+    0x02, 0xD5, 0x03, 0x95, 0xAF, 0x27, 0x10, 0x17, 0xEC, 0x61, 0xD2, 0xFD, 0xD4, 0x44, 0x7B, 0x35,
+    0xA9, 0x90, 0xEB, 0xE8, 0xCA, 0x51, 0x77, 0x53, 0xD3, 0xDB, 0x2A, 0xC2, 0x8E, 0x16, 0x1F, 0x79,
+    0xC1, 0xB9, 0xBA, 0xA3, 0x32, 0x6D, 0x6C, 0xDB, 0xAB, 0x63, 0x15, 0x27, 0x72, 0xB6, 0x6D, 0x8E,
+    0x7A, 0xE2, 0x91, 0x14, 0x87, 0x62, 0xDA, 0x23, 0x73, 0x2B, 0x56, 0xC9, 0x76, 0xB6, 0x58, 0xF0,
+    0xD0, 0x1E, 0x3C, 0x73, 0x91, 0xCB, 0xB1, 0x4A, 0x55, 0xAC, 0x63, 0x33, 0xA8, 0x5E, 0x05, 0x15,
+    0x74, 0x30, 0x9D, 0x05, 0x35, 0xC5, 0x0F, 0x19, 0x4B, 0xBB, 0x99, 0x07, 0x7B, 0xC8, 0x7E, 0x7F,
+    0x52, 0xD1, 0x02, 0xC4, 0xE5, 0x6C, 0x5B, 0xAC, 0x03, 0x87, 0xBD, 0x1A, 0x4D, 0x97, 0x01, 0xA5,
+    0x8A, 0x0F, 0xAA, 0xA8, 0x6F, 0x25, 0x1D, 0xF6, 0x56, 0x75, 0xFD, 0x66, 0xA4, 0x13, 0x0E, 0xEE,
+    0x30, 0x9A, 0x90, 0xD5, 0x00, 0x9C, 0x7A, 0x1F, 0x2E, 0x37, 0xCB, 0x64, 0xDA, 0xAC, 0x82, 0x7C,
+    0x2F, 0xB8, 0x77, 0x1E, 0x90, 0xF2, 0x63, 0xC1, 0x2E, 0xC0, 0xAE, 0x42, 0x72, 0x96, 0x70, 0xAC,
+    0x0E, 0x37, 0xAB, 0xB1, 0x89, 0x1E, 0xA9, 0xF7, 0xEA, 0x59, 0x2A, 0xC6, 0xF3, 0x64, 0x3A, 0xAA,
+    0xD2, 0x42, 0x4C, 0x1D, 0x45, 0x36, 0x1D, 0xCF, 0xFA, 0x97, 0x87, 0x99, 0x74, 0x22, 0x3F, 0x14,
+    0xDC, 0x95, 0xB9, 0x35, 0xB7, 0x39, 0xF9, 0x09, 0xF5, 0xC0, 0xB8, 0x01, 0xB1, 0x7C, 0xFE, 0xA7,
+    0xE7, 0xEB, 0xC7, 0x20, 0x7E, 0x8F, 0x2C, 0x24, 0x51, 0x47, 0xE4, 0xEC, 0x92, 0x5A, 0x5B, 0x60,
+    0x68, 0xDE, 0xA6, 0x0A, 0xEC, 0x92, 0xE5, 0x49, 0x5E, 0x22, 0x99, 0x09, 0x82, 0xC0, 0x02, 0xD5,
+    0x20, 0x94, 0x4C, 0xBC, 0x78, 0x6F, 0x87, 0x03, 0xF3, 0xD3, 0xB9, 0x66, 0x56, 0xA3, 0xE1, 0x6C,
+    0x07, 0xDF, 0x11, 0x1F, 0x88, 0xF9, 0xD1, 0x9B, 0x4D, 0xAC, 0xF2, 0xD0, 0x60, 0x6A, 0xF1, 0x06,
+    0x0F, 0xF7, 0x3B, 0xCA, 0x27, 0x6A, 0xAE, 0x85, 0x5D, 0x03, 0xD6, 0x91, 0xC1, 0x20, 0x47, 0xB7,
+    0x08, 0xB6, 0x30, 0x7E, 0xFE, 0x0C, 0xA6, 0xFB, 0x97, 0x30, 0xA5, 0x1B, 0x44, 0xEF, 0xCE, 0x59,
+    0x5A, 0x60, 0xC2, 0x2E, 0x26, 0xCF, 0x9C, 0xF1, 0xF5, 0x5D, 0xAA, 0xF9, 0x08, 0xB4, 0xF3, 0x25,
+    0xD5, 0x9A, 0xFC, 0xA1, 0x26, 0x9B, 0xE0, 0xE0, 0x62, 0xFA, 0x80, 0xFC, 0xF3, 0x78, 0x9F, 0xFC,
+    0xD3, 0x21, 0x01, 0xC3, 0xE3, 0x48, 0xFC, 0xE8, 0x60, 0x20, 0xFE, 0xF9, 0x16, 0x0A, 0x7C, 0x84,
+    0xD6, 0xF0, 0xB3, 0x6A, 0xC9, 0x4D, 0xFA, 0x3D, 0x24, 0x84, 0x68, 0x4A, 0xA6, 0x5A, 0x26, 0x00,
+    0x78, 0x41, 0xD5, 0x13, 0xF0, 0xD7, 0xC0, 0x81, 0x14, 0x1C, 0xDE, 0x0E, 0x07, 0x0E, 0x16, 0xF0,
+    0x46, 0x0C, 0x91, 0xCA, 0x58, 0x72, 0x3A, 0x1B, 0x6B, 0xEE, 0xE8, 0x9C, 0x92, 0x54, 0xF4, 0x92,
+    0x0A, 0x32, 0x21, 0x1B, 0x2F, 0x5C, 0xE9, 0x5D, 0xB4, 0x1F, 0xF5, 0x7E, 0xB0, 0x2E, 0xF8, 0xDE,
+    0x81, 0x9B, 0xDE, 0xBF, 0x68, 0x39, 0xF8, 0x00, 0xD6, 0x90, 0x24, 0xF7, 0x70, 0xF1, 0xCF, 0x31,
+    0xB9, 0x97, 0x33, 0x3C, 0x78, 0xFE, 0x6C, 0x75, 0xB0, 0x5A, 0xC3, 0xC0, 0x61, 0x1E, 0x58, 0x48,
+    0x74, 0xBE, 0x8A, 0xAB, 0xD6, 0xD3, 0xDA, 0x46, 0xBF, 0xD9, 0xDA, 0x24, 0x93, 0x96, 0x70, 0x6F,
+    0x27, 0x07, 0xCC, 0xA8, 0xB2, 0x4C, 0x52, 0x2D, 0x80, 0xEC, 0x96, 0xA9, 0x10, 0xE6, 0x4B, 0x84,
+    0xC5, 0xC9, 0xB4, 0x9E, 0xBC, 0xDC, 0x26, 0x72, 0xEF, 0xD0, 0x2E, 0xFF, 0x84, 0x54, 0x05, 0xFD,
+    0x32, 0x69, 0x49, 0x41, 0x27, 0x3A, 0x1D, 0x52, 0x7E, 0x09, 0x1A, 0x04, 0xD8, 0xB8, 0x76, 0x55,
+    0x73, 0x71, 0x97, 0x0A, 0x91, 0xC0, 0x0A, 0xC5, 0x72, 0xE8, 0x19, 0xF7, 0x66, 0x8B, 0x24, 0x9A,
+    0xB4, 0xB4, 0x14, 0xFA, 0x93, 0x59, 0xEE, 0x31, 0xB1, 0x2A, 0x77, 0xE7, 0x7B, 0x20, 0x9D, 0x39,
+    0x51, 0xB3, 0x84, 0xAD, 0x04, 0xCF, 0x0A, 0xF7, 0x12, 0xB7, 0xE6, 0xD5, 0x8D, 0xC7, 0xB3, 0xF8,
+    0x72, 0x8F, 0x58, 0x38, 0x01, 0x05, 0x5A, 0x62, 0x9C, 0x0E, 0xB5, 0xAA, 0x49, 0x33, 0x2C, 0x0F,
+    0x11, 0x39, 0xD1, 0xA7, 0xD5, 0xF1, 0x35, 0x32, 0x0F, 0xF9, 0x37, 0x1C, 0xAC, 0x5E, 0xF2, 0x0C,
+    0x31, 0x55, 0xB3, 0xDC, 0xAA, 0xB9, 0xE0, 0xC9, 0xF3, 0x21, 0xB7, 0x7E, 0x44, 0x5F, 0xFB, 0xDE,
+    0x40, 0x37, 0x41, 0x8B, 0xB6, 0xA1, 0xC7, 0x09, 0x98, 0x6D, 0xAC, 0x70, 0x7B, 0x75, 0x40, 0x20,
+    0xDB, 0xCD, 0x4C, 0x76, 0x90, 0xA5, 0x16, 0x36, 0xB9, 0xE2, 0x00, 0x9B, 0xB9, 0xE4, 0xC5, 0xA6,
+    0x45, 0xEA, 0x52, 0x40, 0x01, 0x05, 0x1B, 0xB7, 0xB2, 0xB1, 0xB0, 0xC9, 0xF5, 0x6C, 0x7D, 0x14,
+    0x02, 0x56, 0xBD, 0x4A, 0x6A, 0xFD, 0x58, 0x41, 0x2C, 0xEF, 0xAE, 0x69, 0x1C, 0xD1, 0x60, 0x0D,
+    0x42, 0x76, 0x38, 0x18, 0x7B, 0x1C, 0xEB, 0x44, 0x2E, 0x97, 0xA8, 0x25, 0x0E, 0xA7, 0xE6, 0xA4,
+    0xC7, 0xCE, 0x31, 0xEE, 0xAF, 0x0D, 0xE6, 0xDD, 0x63, 0x49, 0x9F, 0xF7, 0x79, 0x69, 0x9C, 0xBF,
+    0x33, 0x76, 0x46, 0x27, 0x3B, 0xFE, 0x68, 0x3E, 0xDD, 0xE9, 0x71, 0xCD, 0xC8, 0x8E, 0x7A, 0xD6,
+    0xD3, 0x54, 0x9D, 0x44, 0x72, 0xE4, 0x33, 0x99, 0x60, 0x66, 0x52, 0xB1, 0xE1, 0xB6, 0xC2, 0x85,
+    0xD1, 0x17, 0x93, 0x5C, 0xB4, 0xA8, 0xDF, 0x0E, 0xAD, 0xA4, 0x24, 0xFC, 0x15, 0x4B, 0x75, 0xD6,
+    0x3A, 0x41, 0x15, 0x5E, 0x7B, 0xA9, 0xA1, 0x1A, 0xEB, 0x99, 0x96, 0x9E, 0xE6, 0xF0, 0x23, 0x6A,
+    0x01, 0x76, 0x9C, 0x54, 0x4F, 0x8F, 0xB6, 0x43, 0xD2, 0xCD, 0xA4, 0x7B, 0x52, 0xA9, 0x61, 0x0D,
+    0xE8, 0xF3, 0x2E, 0xEF, 0x2E, 0x5D, 0xC8, 0xCF, 0x50, 0x31, 0x3C, 0xBE, 0xE6, 0xBF, 0x5A, 0xE8,
+    0xB8, 0xB5, 0x3D, 0xE9, 0xE3, 0x6F, 0x49, 0xC7, 0xA5, 0xB9, 0x1B, 0xE9, 0x5B, 0x70, 0x30, 0xAF,
+    0x54, 0x80, 0x1A, 0x5B, 0xB0, 0x22, 0x36, 0x08, 0xA8, 0xA6, 0x2F, 0xB0, 0x0F, 0x25, 0xE4, 0x72,
+    0x25, 0x49, 0x82, 0x60, 0x41, 0x51, 0xB7, 0xF0, 0xF5, 0xCE, 0x5B, 0xE9, 0x91, 0x08, 0x55, 0x54,
+    0xB9, 0xD6, 0xDF, 0x22, 0xC6, 0x45, 0xA0, 0xEE, 0x0F, 0x1E, 0x96, 0x9F, 0x23, 0x84, 0x78, 0xF6,
+    0x1A, 0x49, 0xC9, 0x6A, 0xA9, 0x4F, 0x54, 0xD9, 0x49, 0xED, 0x3B, 0xF7, 0x0A, 0xF9, 0xD6, 0x28,
+    0xF4, 0xF7, 0xA3, 0x26, 0xF3, 0xDA, 0x67, 0x1F, 0x16, 0xD5, 0x3F, 0x59, 0x04, 0xC8, 0x73, 0x23,
+    0x45, 0x13, 0x22, 0x11, 0xD3, 0x23, 0x0F, 0xCD, 0xA1, 0x62, 0x25, 0x15, 0x81, 0x24, 0x0C, 0x7E,
+    0xC9, 0xE0, 0x60, 0xC0, 0x0F, 0x4A, 0x4D, 0x05, 0xFE, 0x61, 0xB8, 0x9C, 0x92, 0x28, 0xE2, 0x1C,
+    0xB9, 0x20, 0x31, 0x1E, 0x5C, 0x07, 0xE2, 0x60, 0x5F, 0x02, 0x4D, 0x35, 0x93, 0xFF, 0x15, 0xAD,
+    0xA6, 0x53, 0x81, 0x1F, 0xE3, 0xBA, 0x7B, 0x36, 0xE9, 0x7F, 0xC6, 0x7F, 0xC5, 0x55, 0x3D, 0x8F,
+    0xDD, 0x44, 0x14, 0xBD, 0xB6, 0x59, 0x9E, 0x12, 0x17, 0x93, 0x1A, 0x24, 0xCC, 0x1F, 0x40, 0xFE,
+    0x07, 0x8C, 0xC5, 0x16, 0x29, 0xD2, 0xA4, 0xC8, 0x8A, 0x82, 0x22, 0x0D, 0x1D, 0x42, 0xF9, 0x05,
+    0x60, 0xC3, 0x16, 0x29, 0x49, 0x43, 0x45, 0x41, 0x8A, 0x14, 0xD1, 0xA6, 0xA5, 0x0D, 0xF3, 0x92,
+    0x2D, 0x28, 0x79, 0x8A, 0x94, 0x3A, 0x8E, 0x14, 0x04, 0x0A, 0x05, 0x23, 0x70, 0x92, 0xD9, 0xC4,
+    0x9E, 0xCB, 0x39, 0xD7, 0x2F, 0x08, 0x10, 0x3D, 0x53, 0xCC, 0x58, 0x9E, 0xFB, 0x71, 0xEE, 0xB9,
+    0x1F, 0x53, 0xCC, 0xE2, 0x87, 0x3A, 0x6E, 0x62, 0xA9, 0xF8, 0x68, 0xB6, 0x6E, 0x2E, 0x16, 0xE9,
+    0xA5, 0x8F, 0x2E, 0x96, 0x73, 0xA5, 0x03, 0x2F, 0x5D, 0x2E, 0x67, 0x69, 0xB7, 0xDF, 0x27, 0x17,
+    0x25, 0x54, 0x2F, 0x46, 0xDF, 0x95, 0x73, 0xF3, 0xE8, 0xCB, 0x59, 0x5C, 0xBC, 0x7B, 0xD7, 0x8D,
+    0xE2, 0x8F, 0x9F, 0x4F, 0x7D, 0xE7, 0x94, 0x6B, 0xEB, 0xED, 0x90, 0xAB, 0x3F, 0x3F, 0xCB, 0xE1,
+    0x8A, 0xF8, 0x6B, 0xC7, 0xBF, 0xCF, 0x22, 0xCB, 0xE2, 0x7E, 0x1C, 0xA5, 0x7A, 0x11, 0x7D, 0x2F,
+    0xE2, 0x7E, 0x1B, 0x32, 0xFE, 0xF5, 0x30, 0xBF, 0x93, 0x42, 0xA3, 0x53, 0x91, 0x8D, 0x76, 0x3E,
+    0x89, 0x34, 0xB3, 0xE0, 0x9F, 0xF4, 0x63, 0x85, 0x7F, 0x40, 0xE4, 0xF0, 0x4F, 0x5A, 0x7D, 0x29,
+    0x45, 0x16, 0x18, 0x1E, 0xCB, 0x2C, 0xBD, 0x6A, 0x2A, 0x17, 0x09, 0xAA, 0x4B, 0x35, 0x4B, 0xE8,
+    0xAA, 0x8C, 0x43, 0x61, 0x67, 0x83, 0xE3, 0xFC, 0x4D, 0xAD, 0x53, 0xA1, 0x2E, 0xAA, 0x9B, 0xCA,
+    0xDC, 0xE0, 0x88, 0xD5, 0xD2, 0x3E, 0xE6, 0x31, 0xFB, 0x07, 0xB9, 0x19, 0x71, 0x9C, 0x2E, 0xED,
+    0xB8, 0x49, 0xFD, 0xE9, 0xEC, 0x77, 0x75, 0xEA, 0xAF, 0xCF, 0x7E, 0xEB, 0xA6, 0x70, 0x3D, 0xF5,
+    0x5B, 0x68, 0x5D, 0x4A, 0x61, 0xA0, 0xD6, 0xA4, 0x9D, 0x69, 0xA9, 0xB4, 0x0F, 0xB2, 0xC0, 0x2B,
+    0xB4, 0xA4, 0x06, 0x55, 0xA7, 0xF9, 0x24, 0x24, 0xE9, 0x4F, 0x11, 0x22, 0xB8, 0xB8, 0x8E, 0x63,
+    0x10, 0xBD, 0x04, 0x48, 0x62, 0xEB, 0x88, 0xDB, 0x26, 0x73, 0x6F, 0x27, 0x91, 0xE2, 0x44, 0xCF,
+    0x10, 0xAF, 0x2A, 0xBE, 0x01, 0x7F, 0x2B, 0x72, 0x12, 0x9E, 0x0A, 0x23, 0xEB, 0x44, 0x3E, 0x86,
+    0x3D, 0x69, 0xB3, 0x8F, 0x52, 0x69, 0x86, 0x19, 0x08, 0x2C, 0xB8, 0x79, 0x0E, 0xC3, 0x2E, 0x17,
+    0x10, 0x0E, 0x64, 0xA1, 0x32, 0x12, 0x1C, 0x5C, 0xEF, 0x40, 0x4B, 0xC1, 0x40, 0x07, 0x28, 0xD6,
+    0x8B, 0xF8, 0x51, 0x9A, 0x54, 0x42, 0xB1, 0x8F, 0xCD, 0x22, 0xA2, 0xAF, 0x94, 0x96, 0xE8, 0xA5,
+    0xD2, 0x05, 0x10, 0x2A, 0x3D, 0x86, 0x5B, 0xB9, 0x2C, 0xFF, 0x58, 0x85, 0x49, 0xD4, 0x4C, 0x91,
+    0x1C, 0x1C, 0x1D, 0xFD, 0xED, 0x36, 0x2C, 0x04, 0xB6, 0x1A, 0x49, 0xFC, 0x9A, 0x21, 0x3C, 0xBE,
+    0x23, 0x96, 0x11, 0x80, 0xC1, 0x06, 0xAC, 0x52, 0x5C, 0x5B, 0x10, 0xA5, 0x59, 0xF1, 0x94, 0x7E,
+    0x53, 0x1F, 0x5E, 0xC1, 0x35, 0x64, 0xCA, 0x90, 0x6F, 0xDB, 0x8D, 0x05, 0x3B, 0xE0, 0x73, 0xBB,
+    0xD7, 0x21, 0x5C, 0xBA, 0xDE, 0xBD, 0xB9, 0xE7, 0xA1, 0xA6, 0xA6, 0xD0, 0x05, 0x32, 0xCF, 0xBB,
+    0x03, 0x10, 0xC2, 0x40, 0x43, 0x44, 0x94, 0x28, 0x86, 0xD2, 0xEA, 0xC1, 0xCD, 0x25, 0xDD, 0x44,
+    0x94, 0x85, 0xE8, 0x00, 0x1C, 0x9B, 0xEC, 0x32, 0xA9, 0x0D, 0xD4, 0x3E, 0x55, 0x06, 0xE9, 0x27,
+    0x40, 0xCA, 0xFA, 0x90, 0x34, 0xC3, 0x1E, 0xCB, 0x2F, 0x32, 0x48, 0x32, 0x4A, 0x5A, 0x0B, 0x3D,
+    0x56, 0x02, 0x00, 0x85, 0xB0, 0xD4, 0x26, 0xC2, 0xEA, 0x19, 0x24, 0xE1, 0x35, 0xA9, 0x42, 0x2A,
+    0xC2, 0xAE, 0x36, 0xA2, 0xE1, 0x86, 0x44, 0x4F, 0xC0, 0x04, 0x53, 0xE4, 0x68, 0xA6, 0xD1, 0xC4,
+    0x6D, 0x3A, 0xF8, 0x50, 0xBF, 0xBE, 0x4C, 0x29, 0x3A, 0x7D, 0x8F, 0x5B, 0x26, 0x78, 0x50, 0x5C,
+    0x33, 0x56, 0xC7, 0x28, 0xDA, 0xF9, 0x02, 0xFC, 0xA5, 0xEF, 0x18, 0x5F, 0x92, 0x26, 0x00, 0xF1,
+    0x39, 0x9F, 0x5F, 0x93, 0xA0, 0x23, 0x65, 0x59, 0xDE, 0x24, 0xE6, 0x33, 0x6E, 0xEF, 0x72, 0x2B,
+    0xA8, 0x6F, 0x25, 0xF1, 0x57, 0x92, 0x02, 0x65, 0x65, 0x9F, 0x4E, 0x31, 0x52, 0x69, 0x5F, 0x1A,
+    0x7C, 0x30, 0x1B, 0xD5, 0x8D, 0x22, 0xCC, 0xAB, 0xEC, 0xC6, 0x24, 0x0A, 0xED, 0xFA, 0x68, 0x59,
+    0xDC, 0x1A, 0xD7, 0xF0, 0x68, 0x66, 0xC9, 0xA9, 0xA7, 0xAD, 0xCD, 0xC2, 0xD8, 0xCC, 0x4F, 0x65,
+    0xF5, 0xA9, 0x5B, 0x08, 0x80, 0x76, 0x40, 0x0B, 0xBB, 0x56, 0x3B, 0x0A, 0xC6, 0x5E, 0x13, 0x04,
+    0x9B, 0xD9, 0xBF, 0x54, 0x76, 0x1F, 0x3A, 0xA8, 0xDD, 0xE9, 0xB6, 0x46, 0x43, 0x6C, 0x92, 0x8F,
+    0xB5, 0x1E, 0xCE, 0x92, 0x5D, 0x6A, 0xF5, 0x0B, 0x95, 0xFE, 0x22, 0xC1, 0x85, 0xAD, 0xBF, 0x4F,
+    0xAE, 0x7D, 0x0E, 0x11, 0x27, 0x87, 0x40, 0xF4, 0xFA, 0x44, 0xAA, 0xBC, 0x46, 0x50, 0xE4, 0x83,
+    0x7D, 0x75, 0x0D, 0xEB, 0xE9, 0x77, 0xEB, 0xE9, 0xE2, 0x7A, 0x56, 0xFB, 0x30, 0x8A, 0x2C, 0xFF,
+    0x2D, 0x68, 0xAB, 0x64, 0xD4, 0x85, 0x15, 0x95, 0x67, 0xD1, 0xD4, 0xCA, 0x7A, 0xD4, 0x7B, 0x50,
+    0x6A, 0x52, 0x33, 0xE2, 0xFE, 0x03, 0xAB, 0x0B, 0x28, 0x95, 0x7A, 0x11, 0x02, 0x0D, 0x3A, 0x18,
+    0x0A, 0xDF, 0x46, 0xB6, 0xDF, 0x6C, 0x0C, 0x76, 0x54, 0x23, 0xA8, 0x1E, 0x35, 0x70, 0x8E, 0x79,
+    0x2F, 0x46, 0xCE, 0x1C, 0xEF, 0xC0, 0xA0, 0x7B, 0x01, 0xA9, 0xD2, 0xD8, 0xED, 0xF5, 0x87, 0x2C,
+    0xEE, 0xD1, 0x84, 0x21, 0x94, 0x3E, 0x47, 0xBE, 0x43, 0x35, 0x30, 0x7D, 0x17, 0x2C, 0xF5, 0x6B,
+    0x26, 0xD7, 0x0E, 0x27, 0xA6, 0xCA, 0x8C, 0x7B, 0x02, 0xAB, 0xCC, 0xB8, 0x7F, 0x62, 0x13, 0xEB,
+    0x96, 0xB5, 0xFD, 0x96, 0x95, 0x34, 0x5B, 0xCF, 0x0D, 0x12, 0xEE, 0x85, 0x58, 0xF4, 0xCF, 0xAE,
+    0x2E, 0x1D, 0xAB, 0x33, 0xB2, 0x50, 0x13, 0x87, 0x6E, 0x44, 0x2A, 0xDC, 0x5C, 0xD9, 0xF0, 0xB4,
+    0x9B, 0x7A, 0xC1, 0xDC, 0x2D, 0xF5, 0x1B, 0xA8, 0x1B, 0x20, 0xEB, 0x18, 0xC7, 0x00, 0x36, 0xF9,
+    0x96, 0x8D, 0x45, 0x79, 0xDD, 0x5B, 0xF4, 0xD8, 0x4C, 0xAF, 0x1B, 0x6C, 0xBD, 0xC1, 0x7A, 0xCB,
+    0x98, 0x25, 0xD2, 0xB7, 0x39, 0x80, 0x1A, 0x56, 0x0F, 0xCB, 0x79, 0x57, 0x59, 0x8F, 0x04, 0x9D,
+    0xAF, 0x75, 0x8D, 0x5E, 0x1D, 0x10, 0xD3, 0x7D, 0x68, 0x87, 0xD8, 0x02, 0x6E, 0x86, 0x02, 0xC6,
+    0xCE, 0xFB, 0x80, 0x9F, 0x36, 0x3F, 0x1D, 0x1D, 0x6A, 0x17, 0x34, 0xF9, 0x09, 0x8E, 0x0F, 0xD1,
+    0x2B, 0x00, 0x1C, 0xDD, 0xAF, 0x5A, 0x69, 0x31, 0xF9, 0x11, 0x7D, 0xB4, 0xC9, 0x95, 0x1E, 0x46,
+    0x54, 0xCE, 0xEC, 0xF1, 0x64, 0xE8, 0xAB, 0xC7, 0x08, 0x82, 0x11, 0x59, 0x03, 0x76, 0x62, 0xF3,
+    0x11, 0x71, 0xFF, 0x82, 0xB4, 0x9D, 0xD9, 0x38, 0x64, 0x79, 0x17, 0x37, 0x57, 0x7C, 0xC6, 0x54,
+    0xBD, 0x86, 0xA0, 0x06, 0x9C, 0x2C, 0x3A, 0xCE, 0x04, 0x80, 0xC3, 0xEF, 0x6A, 0x61, 0xBA, 0xDA,
+    0x3F, 0x18, 0x95, 0x7E, 0x95, 0xAC, 0xB7, 0x75, 0xB4, 0xA7, 0x65, 0xB8, 0xA3, 0x77, 0xF4, 0x36,
+    0x8A, 0x99, 0xE3, 0x13, 0xFE, 0x23, 0x7D, 0x69, 0x36, 0xFE, 0x12, 0x86, 0xD1, 0x47, 0xB9, 0x03,
+    0x19, 0x20, 0x05, 0xC4, 0xFA, 0x1D, 0xDB, 0x4A, 0x07, 0x54, 0x3E, 0x8A, 0x1E, 0x33, 0x8A, 0x3C,
+    0x33, 0x87, 0xE8, 0xF1, 0x95, 0x41, 0x6B, 0x9D, 0xB3, 0xFD, 0xC0, 0xE2, 0x0B, 0x83, 0xDC, 0x71,
+    0x00, 0xDF, 0xE8, 0x27, 0x79, 0x03, 0xB5, 0x45, 0x7E, 0xED, 0x0D, 0x9A, 0xCE, 0x9F, 0x9C, 0x84,
+    0xB3, 0x96, 0x8D, 0xD8, 0x1A, 0x89, 0x2D, 0xFB, 0x9F, 0x0A, 0x9F, 0xA8, 0x3E, 0xBD, 0x15, 0x38,
+    0x22, 0xB8, 0xC5, 0x55, 0x3C, 0xEE, 0x5F, 0x00, 0x8C, 0x04, 0xF9, 0x94, 0xF0, 0x2D, 0x01, 0x0B,
+    0x3B, 0x7A, 0xE1, 0x00, 0x00, 0x01, 0xC5, 0xBF, 0x26, 0xF3, 0xFF, 0xB3, 0xFE, 0x04, 0x5D, 0x55,
+    0xBD, 0x8E, 0xDE, 0x44, 0x14, 0xBD, 0xFE, 0xAC, 0xFD, 0x2C, 0xC5, 0x8A, 0x66, 0x8B, 0x54, 0x34,
+    0xAE, 0x69, 0xE2, 0x86, 0x32, 0xD2, 0x18, 0xB6, 0xA4, 0x41, 0x22, 0x4B, 0xB3, 0x2F, 0x10, 0x89,
+    0x48, 0xFB, 0x02, 0x04, 0x5B, 0xD9, 0x82, 0x92, 0x2D, 0x78, 0x00, 0x4A, 0x44, 0x43, 0x49, 0x0A,
+    0x82, 0xBD, 0x4F, 0x80, 0xA1, 0x49, 0x19, 0x4B, 0x24, 0x0D, 0xCD, 0x8E, 0x82, 0xA3, 0x78, 0x13,
+    0x7B, 0x6E, 0xCE, 0x99, 0x99, 0x25, 0x2B, 0x46, 0xFA, 0xEE, 0xF8, 0xE7, 0xFA, 0xDE, 0x73, 0xCF,
+    0x3D, 0x77, 0x3E, 0x11, 0xB9, 0x23, 0x58, 0x2B, 0x7E, 0xA7, 0x3A, 0x4A, 0xA1, 0xBA, 0x89, 0xA5,
+    0x51, 0xD5, 0x75, 0xA7, 0x6F, 0x5E, 0xCD, 0x85, 0x9E, 0x4D, 0x87, 0xC6, 0x17, 0x93, 0x54, 0x6B,
+    0x39, 0x8A, 0x9D, 0xCD, 0x20, 0xD6, 0xC1, 0xB4, 0x93, 0xE9, 0xA4, 0x1F, 0xAB, 0x46, 0x74, 0xAC,
+    0x61, 0x06, 0x2B, 0xD7, 0xE6, 0x5B, 0x9A, 0xA7, 0x30, 0xE3, 0x6F, 0x22, 0xBD, 0x43, 0x74, 0xBB,
+    0xAD, 0x0F, 0xA5, 0x46, 0x4C, 0x31, 0x34, 0x39, 0x8D, 0xF4, 0xFA, 0x42, 0xA4, 0x70, 0xC8, 0x8D,
+    0xE8, 0x22, 0xFB, 0x4E, 0xAE, 0x57, 0x3E, 0x13, 0x52, 0xE9, 0x76, 0xB0, 0xC6, 0xE5, 0xB0, 0xB5,
+    0x33, 0x8B, 0xEC, 0x94, 0xB0, 0x4C, 0xB0, 0x15, 0xED, 0x72, 0x4B, 0xFF, 0xE9, 0xDF, 0xFE, 0x28,
+    0xDA, 0xB5, 0x93, 0x64, 0xDA, 0xF4, 0x23, 0x7C, 0x1A, 0x1D, 0x90, 0x40, 0x92, 0xED, 0xA4, 0xF0,
+    0x78, 0x23, 0xC5, 0x86, 0x37, 0x52, 0xAE, 0x78, 0x26, 0xE6, 0x86, 0xAD, 0x96, 0x5C, 0x2F, 0xA5,
+    0x9E, 0x01, 0x09, 0x49, 0x90, 0x01, 0xD5, 0x49, 0xEF, 0x89, 0xE2, 0xA0, 0xF9, 0x0F, 0x10, 0xC2,
+    0x5E, 0xC1, 0x96, 0xAA, 0x2E, 0x58, 0x20, 0x0A, 0x5C, 0x21, 0xC5, 0x58, 0x09, 0xCB, 0xA5, 0x53,
+    0xCB, 0x5A, 0xC0, 0x53, 0x28, 0x41, 0xC3, 0xD7, 0x3A, 0x87, 0x47, 0xDA, 0x85, 0x18, 0xE1, 0x4D,
+    0x1D, 0x9C, 0xD3, 0x4D, 0xA5, 0x21, 0xBC, 0x8E, 0xFB, 0xF3, 0x07, 0x1F, 0x99, 0x25, 0xF7, 0xED,
+    0x2F, 0x7F, 0xFB, 0xDD, 0xF3, 0x77, 0x7E, 0xD5, 0xE6, 0xD7, 0x79, 0xB3, 0xED, 0x50, 0xAD, 0xD6,
+    0xE8, 0x04, 0x90, 0xDF, 0x21, 0x37, 0x7A, 0xA3, 0x93, 0x94, 0x97, 0xAA, 0xE7, 0x92, 0xBB, 0xA7,
+    0x2D, 0x7B, 0x67, 0xD1, 0x0C, 0xF9, 0xF8, 0xD6, 0x67, 0xE7, 0x01, 0x93, 0x2E, 0x35, 0x7D, 0xC8,
+    0xCE, 0x11, 0x79, 0x3A, 0x38, 0x3E, 0x3E, 0xFE, 0x82, 0x29, 0x32, 0x5C, 0xDC, 0x27, 0x77, 0x8E,
+    0x41, 0x2E, 0xE8, 0x50, 0xD2, 0x9D, 0x2C, 0x91, 0x06, 0x18, 0xD0, 0x17, 0xEF, 0xCC, 0x9A, 0xAA,
+    0xC9, 0x08, 0xBC, 0x44, 0x9D, 0x64, 0x25, 0x96, 0x59, 0xFC, 0xCF, 0x5D, 0x75, 0x68, 0x91, 0xA7,
+    0x50, 0xFF, 0x73, 0xF3, 0x35, 0xE9, 0x09, 0x95, 0xD7, 0x0B, 0x4A, 0x53, 0xCF, 0x8E, 0x8D, 0x07,
+    0x5F, 0xE9, 0x0F, 0x31, 0xC0, 0xA9, 0xE7, 0x07, 0xD0, 0x0E, 0x8B, 0x40, 0x09, 0x10, 0x51, 0xCA,
+    0x58, 0x2F, 0x29, 0x7C, 0xE9, 0x53, 0x32, 0xB6, 0x2B, 0x72, 0x09, 0x61, 0xC6, 0xAC, 0x25, 0x9D,
+    0xEC, 0x44, 0x58, 0x78, 0x57, 0xAE, 0x50, 0x4C, 0xFD, 0x0E, 0xFE, 0x0A, 0x96, 0x4F, 0xD1, 0xA0,
+    0x1C, 0xD5, 0x20, 0xED, 0xF0, 0x40, 0xBE, 0xD4, 0x7E, 0xA2, 0xD4, 0x9A, 0x3D, 0x99, 0xB2, 0xA8,
+    0x22, 0x23, 0xDF, 0x07, 0x16, 0x1D, 0x86, 0x26, 0xCC, 0x52, 0x6C, 0xD2, 0x8E, 0xB5, 0x0B, 0x3A,
+    0xB1, 0x90, 0x40, 0xA9, 0x43, 0x50, 0x26, 0x4A, 0x19, 0x76, 0x64, 0xC5, 0x28, 0x02, 0x67, 0xF7,
+    0xAF, 0xFB, 0x9F, 0x69, 0x30, 0x24, 0x61, 0x85, 0xBC, 0xE5, 0x11, 0x49, 0xAF, 0x8F, 0x80, 0xC5,
+    0xBC, 0x5E, 0x24, 0x2A, 0x73, 0xC4, 0xC7, 0xBA, 0x05, 0x79, 0x0E, 0xBD, 0x12, 0xD4, 0x22, 0xD9,
+    0x26, 0x8F, 0xE0, 0xD3, 0xD4, 0xE5, 0xED, 0x7C, 0x34, 0x7F, 0x5C, 0x5E, 0x20, 0xA5, 0x5E, 0xAD,
+    0xA2, 0xCF, 0x2F, 0x57, 0xB1, 0x8F, 0x1F, 0x2F, 0xD2, 0x52, 0x0D, 0x3D, 0x65, 0x62, 0xB5, 0xB9,
+    0x23, 0xFB, 0x3A, 0xCA, 0x8A, 0xF9, 0xDA, 0xC8, 0x37, 0x87, 0x23, 0x4B, 0x32, 0x0C, 0xC2, 0x14,
+    0xB3, 0x84, 0x8D, 0x54, 0x24, 0x32, 0x48, 0x47, 0x7C, 0xE6, 0xA2, 0xA0, 0x28, 0xB8, 0x3D, 0x0B,
+    0x09, 0xD8, 0xBC, 0x04, 0xE9, 0x68, 0xE8, 0x17, 0x67, 0xDC, 0x9B, 0xA5, 0x5D, 0x33, 0xB4, 0x6E,
+    0xC4, 0x30, 0x6F, 0xA8, 0xAE, 0xC7, 0x45, 0x89, 0x91, 0xFF, 0x54, 0x1B, 0x3B, 0x95, 0x2B, 0x7A,
+    0x8E, 0x0B, 0x67, 0x1D, 0x88, 0xD2, 0x41, 0x87, 0xCA, 0xE5, 0x3E, 0x67, 0xF2, 0x6A, 0xAE, 0x88,
+    0xB5, 0x1F, 0xFA, 0x81, 0x30, 0x93, 0x5C, 0x82, 0x60, 0x00, 0x67, 0xA7, 0xBE, 0x63, 0x3F, 0x62,
+    0xBE, 0x89, 0x1A, 0xD8, 0xA0, 0x9F, 0x13, 0xED, 0xE0, 0x08, 0x41, 0x81, 0x65, 0x70, 0x3C, 0x21,
+    0x52, 0x35, 0x43, 0x5B, 0xC0, 0xAC, 0x63, 0xAE, 0xE0, 0x95, 0xE3, 0x3C, 0x53, 0x8F, 0x1C, 0x44,
+    0x30, 0x47, 0x3A, 0x63, 0xD3, 0x43, 0x29, 0x59, 0xFF, 0xB2, 0x21, 0xF6, 0x85, 0xC1, 0x37, 0x32,
+    0x83, 0xA2, 0x83, 0x38, 0xD1, 0x46, 0xCA, 0xC7, 0xC9, 0x8D, 0x75, 0x8F, 0x23, 0x99, 0xB9, 0x27,
+    0x64, 0xE5, 0x6C, 0x0C, 0x44, 0x36, 0xE1, 0x9B, 0x91, 0xB3, 0x8B, 0xEB, 0xC0, 0x81, 0xD1, 0x2B,
+    0x20, 0xEA, 0x75, 0x74, 0x4D, 0xA1, 0xDF, 0x17, 0x38, 0xD6, 0xD6, 0x6F, 0xEE, 0x22, 0xFE, 0x5F,
+    0xD3, 0x8C, 0xCC, 0xE6, 0x68, 0x8C, 0xA2, 0x0C, 0x32, 0x4F, 0xE3, 0x1C, 0x26, 0x01, 0x87, 0xC5,
+    0x07, 0xF2, 0xE3, 0xE0, 0x07, 0x9B, 0xA5, 0xB9, 0x06, 0x52, 0x8E, 0xE0, 0xCA, 0x2C, 0x1C, 0x5C,
+    0xAC, 0xAE, 0x0A, 0x19, 0xD3, 0x7A, 0x72, 0x0F, 0xF1, 0xFE, 0x04, 0x62, 0xF3, 0x79, 0x07, 0x14,
+    0xBF, 0x13, 0x9A, 0x67, 0x9B, 0x7C, 0x3C, 0x1D, 0xED, 0x4B, 0x12, 0xD0, 0xE8, 0x58, 0xE0, 0x84,
+    0x6A, 0x70, 0xF2, 0x21, 0xD4, 0xD0, 0xA2, 0x01, 0x27, 0x4A, 0x42, 0x1D, 0xDC, 0x37, 0xBA, 0xE3,
+    0x30, 0xF5, 0x3D, 0xDC, 0x27, 0x0B, 0x2E, 0x9B, 0x16, 0x5D, 0x03, 0x04, 0x74, 0xCC, 0x83, 0x32,
+    0x68, 0xDA, 0x17, 0x68, 0x1B, 0x83, 0x42, 0x8B, 0x54, 0x5D, 0x88, 0x0E, 0xD6, 0x1C, 0xE0, 0x17,
+    0x67, 0xC0, 0x7A, 0x97, 0x34, 0x1D, 0x1E, 0xF2, 0x44, 0xFA, 0x57, 0xBD, 0xD5, 0x67, 0x1F, 0x20,
+    0xC6, 0x75, 0x3B, 0xED, 0xE9, 0xB1, 0x49, 0x7B, 0x72, 0x33, 0x69, 0x4F, 0x95, 0x99, 0x17, 0xFB,
+    0xB0, 0x2F, 0xD1, 0xDF, 0x4C, 0x71, 0xD7, 0x8B, 0x9F, 0xF2, 0x8D, 0xCE, 0xFD, 0x4C, 0xF6, 0x48,
+    0x49, 0x4D, 0xEE, 0xA1, 0xC5, 0xF8, 0x37, 0xE3, 0x8A, 0x38, 0x33, 0xAC, 0xCA, 0x86, 0x5B, 0x9D,
+    0xB1, 0x77, 0x40, 0xDD, 0x58, 0xDD, 0x72, 0xAA, 0xC1, 0xEA, 0x5C, 0x11, 0x7B, 0xD0, 0xF0, 0x9C,
+    0xB4, 0xDC, 0x70, 0x3F, 0x09, 0x07, 0x2C, 0x34, 0x1C, 0xFA, 0x63, 0x87, 0xD4, 0x1B, 0x89, 0x33,
+    0x61, 0x4F, 0xE6, 0x38, 0x14, 0xF1, 0x16, 0xFF, 0x5E, 0xB1, 0x02, 0x9B, 0x4E, 0xF6, 0x4F, 0x6E,
+    0x14, 0xFB, 0x1E,
+};
+
+static const uint32_t notosans_16_bolditalicBlockOffsets[49] = {
+    0, 1105, 2146, 3066, 4115, 5138, 6255, 7200,
+    7914, 8522, 9328, 10161, 11019, 11918, 12587, 13389,
+    14184, 15010, 15957, 16850, 17744, 18813, 20130, 21006,
+    21932, 22863, 23816, 24892, 25925, 27048, 28151, 29117,
+    30110, 31113, 32098, 33061, 33862, 34860, 35921, 36868,
+    37869, 38801, 39672, 40712, 41684, 42744, 43996, 45102,
+    46083,
+};
+
+static const uint16_t notosans_16_bolditalicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_16_bolditalicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_16_bolditalicPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 876, 0, 0,
 };
 
 static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
@@ -5938,857 +3070,857 @@ static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
     { 19, 24, 18, -1, 24, 114, 1666 }, // 4
     { 19, 25, 18, 0, 24, 119, 1780 }, // 5
     { 18, 26, 18, 1, 25, 117, 1899 }, // 6
-    { 19, 24, 18, 1, 24, 114, 2016 }, // 7
-    { 19, 26, 18, 0, 25, 124, 2130 }, // 8
-    { 17, 26, 18, 1, 25, 111, 2254 }, // 9
-    { 10, 20, 10, 0, 19, 50, 2365 }, // :
-    { 12, 24, 10, -2, 19, 72, 2415 }, // ;
-    { 17, 18, 19, 1, 21, 77, 2487 }, // <
-    { 17, 11, 19, 1, 17, 47, 2564 }, // =
-    { 17, 18, 19, 1, 21, 77, 2611 }, // >
-    { 15, 26, 15, 2, 25, 98, 2688 }, // ?
-    { 28, 28, 29, 1, 24, 196, 2786 }, // @
-    { 21, 24, 21, -2, 24, 126, 2982 }, // A
-    { 21, 24, 21, 0, 24, 126, 3108 }, // B
-    { 21, 26, 20, 1, 25, 137, 3234 }, // C
-    { 22, 24, 23, 0, 24, 132, 3371 }, // D
-    { 20, 24, 18, 0, 24, 120, 3503 }, // E
-    { 20, 24, 18, 0, 24, 120, 3623 }, // F
-    { 22, 26, 23, 1, 25, 143, 3743 }, // G
-    { 24, 24, 23, 0, 24, 144, 3886 }, // H
-    { 16, 24, 13, -1, 24, 96, 4030 }, // I
-    { 18, 32, 11, -6, 24, 144, 4126 }, // J
-    { 24, 24, 20, 0, 24, 144, 4270 }, // K
-    { 16, 24, 17, 0, 24, 96, 4414 }, // L
-    { 30, 24, 29, 0, 24, 180, 4510 }, // M
-    { 26, 24, 25, 0, 24, 156, 4690 }, // N
-    { 23, 26, 24, 1, 25, 150, 4846 }, // O
-    { 21, 24, 20, 0, 24, 126, 4996 }, // P
-    { 23, 31, 24, 1, 25, 179, 5122 }, // Q
-    { 20, 24, 21, 0, 24, 120, 5301 }, // R
-    { 19, 26, 18, 0, 25, 124, 5421 }, // S
-    { 19, 24, 18, 2, 24, 114, 5545 }, // T
-    { 22, 25, 23, 2, 24, 138, 5659 }, // U
-    { 20, 24, 20, 3, 24, 120, 5797 }, // V
-    { 30, 24, 30, 3, 24, 180, 5917 }, // W
-    { 25, 24, 20, -2, 24, 150, 6097 }, // X
-    { 19, 24, 19, 3, 24, 114, 6247 }, // Y
-    { 21, 24, 18, -1, 24, 126, 6361 }, // Z
-    { 15, 30, 11, -1, 24, 113, 6487 }, // [
-    { 9, 25, 14, 3, 24, 57, 6600 }, // <backslash>
-    { 15, 30, 11, -3, 24, 113, 6657 }, // ]
-    { 18, 16, 18, 0, 24, 72, 6770 }, // ^
-    { 15, 3, 13, -4, -3, 12, 6842 }, // _
-    { 8, 6, 11, 4, 26, 12, 6854 }, // `
-    { 19, 20, 20, 1, 19, 95, 6866 }, // a
-    { 19, 27, 20, 0, 26, 129, 6961 }, // b
-    { 16, 20, 16, 1, 19, 80, 7090 }, // c
-    { 20, 27, 20, 1, 26, 135, 7170 }, // d
-    { 17, 20, 19, 1, 19, 85, 7305 }, // e
-    { 21, 34, 12, -4, 26, 179, 7390 }, // f
-    { 20, 27, 20, 0, 19, 135, 7569 }, // g
-    { 19, 26, 20, 0, 26, 124, 7704 }, // h
-    { 11, 26, 10, 0, 26, 72, 7828 }, // i
-    { 16, 34, 10, -5, 26, 136, 7900 }, // j
-    { 21, 26, 19, 0, 26, 137, 8036 }, // k
-    { 11, 26, 10, 0, 26, 72, 8173 }, // l
-    { 29, 19, 30, 0, 19, 138, 8245 }, // m
-    { 19, 19, 20, 0, 19, 91, 8383 }, // n
-    { 18, 20, 20, 1, 19, 90, 8474 }, // o
-    { 21, 27, 20, -2, 19, 142, 8564 }, // p
-    { 19, 27, 20, 1, 19, 129, 8706 }, // q
-    { 16, 19, 14, 0, 19, 76, 8835 }, // r
-    { 16, 20, 16, 0, 19, 80, 8911 }, // s
-    { 14, 24, 14, 1, 23, 84, 8991 }, // t
-    { 19, 20, 20, 1, 19, 95, 9075 }, // u
-    { 18, 19, 17, 1, 19, 86, 9170 }, // v
-    { 26, 19, 26, 2, 19, 124, 9256 }, // w
-    { 22, 19, 18, -2, 19, 105, 9380 }, // x
-    { 23, 27, 17, -3, 19, 156, 9485 }, // y
-    { 17, 19, 16, -1, 19, 81, 9641 }, // z
-    { 15, 30, 12, -1, 24, 113, 9722 }, // {
-    { 4, 34, 18, 7, 26, 34, 9835 }, // |
-    { 14, 30, 12, -2, 24, 105, 9869 }, // }
-    { 17, 7, 19, 1, 15, 30, 9974 }, // ~
-    { 0, 0, 9, 0, 0, 0, 10004 }, //  
-    { 11, 26, 10, -2, 19, 72, 10004 }, // ¡
-    { 16, 26, 18, 2, 25, 104, 10076 }, // ¢
-    { 22, 25, 18, -1, 25, 138, 10180 }, // £
-    { 17, 16, 18, 1, 20, 68, 10318 }, // ¤
-    { 20, 24, 18, 1, 24, 120, 10386 }, // ¥
-    { 4, 34, 18, 7, 26, 34, 10506 }, // ¦
-    { 17, 27, 16, 0, 26, 115, 10540 }, // §
-    { 12, 6, 18, 6, 26, 18, 10655 }, // ¨
-    { 26, 26, 28, 1, 25, 169, 10673 }, // ©
-    { 13, 13, 13, 2, 25, 43, 10842 }, // ª
-    { 18, 16, 19, 1, 17, 72, 10885 }, // «
-    { 17, 10, 19, 1, 14, 43, 10957 }, // ¬
-    { 10, 5, 11, 0, 11, 13, 11000 }, // ­
-    { 26, 26, 28, 1, 25, 169, 11013 }, // ®
-    { 16, 4, 14, 3, 29, 16, 11182 }, // ¯
-    { 12, 13, 14, 1, 25, 39, 11198 }, // °
-    { 17, 21, 19, 1, 21, 90, 11237 }, // ±
-    { 14, 16, 13, 1, 29, 56, 11327 }, // ²
-    { 13, 16, 13, 2, 29, 52, 11383 }, // ³
-    { 10, 6, 11, 3, 26, 15, 11435 }, // ´
-    { 22, 27, 20, -2, 19, 149, 11450 }, // µ
-    { 18, 31, 22, 2, 26, 140, 11599 }, // ¶
-    { 7, 7, 10, 2, 15, 13, 11739 }, // ·
-    { 9, 8, 7, -4, 0, 18, 11752 }, // ¸
-    { 10, 16, 13, 3, 29, 40, 11770 }, // ¹
-    { 12, 12, 12, 2, 24, 36, 11810 }, // º
-    { 18, 16, 19, 0, 17, 72, 11846 }, // »
-    { 25, 26, 28, 2, 25, 163, 11918 }, // ¼
-    { 27, 26, 30, 2, 25, 176, 12081 }, // ½
-    { 27, 26, 29, 1, 25, 176, 12257 }, // ¾
-    { 14, 25, 16, -1, 19, 88, 12433 }, // ¿
-    { 21, 32, 21, -2, 32, 168, 12521 }, // À
-    { 23, 32, 21, -2, 32, 184, 12689 }, // Á
-    { 23, 32, 21, -2, 32, 184, 12873 }, // Â
-    { 24, 32, 21, -2, 32, 192, 13057 }, // Ã
-    { 22, 32, 21, -2, 32, 176, 13249 }, // Ä
-    { 21, 34, 21, -2, 34, 179, 13425 }, // Å
-    { 33, 24, 30, -2, 24, 198, 13604 }, // Æ
-    { 21, 33, 20, 1, 25, 174, 13802 }, // Ç
-    { 20, 32, 18, 0, 32, 160, 13976 }, // È
-    { 20, 32, 18, 0, 32, 160, 14136 }, // É
-    { 20, 32, 18, 0, 32, 160, 14296 }, // Ê
-    { 20, 32, 18, 0, 32, 160, 14456 }, // Ë
-    { 16, 32, 13, -1, 32, 128, 14616 }, // Ì
-    { 18, 32, 13, -1, 32, 144, 14744 }, // Í
-    { 18, 32, 13, -1, 32, 144, 14888 }, // Î
-    { 17, 32, 13, -1, 32, 136, 15032 }, // Ï
-    { 22, 24, 23, 0, 24, 132, 15168 }, // Ð
-    { 26, 32, 25, 0, 32, 208, 15300 }, // Ñ
-    { 23, 33, 24, 1, 32, 190, 15508 }, // Ò
-    { 23, 33, 24, 1, 32, 190, 15698 }, // Ó
-    { 23, 33, 24, 1, 32, 190, 15888 }, // Ô
-    { 23, 33, 24, 1, 32, 190, 16078 }, // Õ
-    { 23, 33, 24, 1, 32, 190, 16268 }, // Ö
-    { 16, 16, 19, 2, 20, 64, 16458 }, // ×
-    { 23, 28, 24, 1, 26, 161, 16522 }, // Ø
-    { 22, 33, 23, 2, 32, 182, 16683 }, // Ù
-    { 22, 33, 23, 2, 32, 182, 16865 }, // Ú
-    { 22, 33, 23, 2, 32, 182, 17047 }, // Û
-    { 22, 33, 23, 2, 32, 182, 17229 }, // Ü
-    { 19, 32, 19, 3, 32, 152, 17411 }, // Ý
-    { 20, 24, 20, 0, 24, 120, 17563 }, // Þ
-    { 27, 34, 22, -5, 26, 230, 17683 }, // ß
-    { 19, 27, 20, 1, 26, 129, 17913 }, // à
-    { 19, 27, 20, 1, 26, 129, 18042 }, // á
-    { 19, 27, 20, 1, 26, 129, 18171 }, // â
-    { 19, 27, 20, 1, 26, 129, 18300 }, // ã
-    { 19, 27, 20, 1, 26, 129, 18429 }, // ä
-    { 19, 29, 20, 1, 28, 138, 18558 }, // å
-    { 28, 20, 29, 1, 19, 140, 18696 }, // æ
-    { 16, 27, 16, 1, 19, 108, 18836 }, // ç
-    { 17, 27, 19, 1, 26, 115, 18944 }, // è
-    { 18, 27, 19, 1, 26, 122, 19059 }, // é
-    { 18, 27, 19, 1, 26, 122, 19181 }, // ê
-    { 17, 27, 19, 1, 26, 115, 19303 }, // ë
-    { 10, 26, 10, 0, 26, 65, 19418 }, // ì
-    { 14, 26, 10, 0, 26, 91, 19483 }, // í
-    { 14, 26, 10, 0, 26, 91, 19574 }, // î
-    { 13, 26, 10, 0, 26, 85, 19665 }, // ï
-    { 18, 27, 19, 1, 26, 122, 19750 }, // ð
-    { 20, 26, 20, 0, 26, 130, 19872 }, // ñ
-    { 18, 27, 20, 1, 26, 122, 20002 }, // ò
-    { 18, 27, 20, 1, 26, 122, 20124 }, // ó
-    { 18, 27, 20, 1, 26, 122, 20246 }, // ô
-    { 19, 27, 20, 1, 26, 129, 20368 }, // õ
-    { 18, 27, 20, 1, 26, 122, 20497 }, // ö
-    { 17, 17, 19, 1, 20, 73, 20619 }, // ÷
-    { 19, 22, 20, 0, 20, 105, 20692 }, // ø
-    { 19, 27, 20, 1, 26, 129, 20797 }, // ù
-    { 19, 27, 20, 1, 26, 129, 20926 }, // ú
-    { 19, 27, 20, 1, 26, 129, 21055 }, // û
-    { 19, 27, 20, 1, 26, 129, 21184 }, // ü
-    { 23, 34, 17, -3, 26, 196, 21313 }, // ý
-    { 21, 34, 20, -2, 26, 179, 21509 }, // þ
-    { 23, 34, 17, -3, 26, 196, 21688 }, // ÿ
-    { 22, 30, 21, -2, 30, 165, 21884 }, // Ā
-    { 19, 25, 20, 1, 24, 119, 22049 }, // ā
-    { 23, 32, 21, -2, 32, 184, 22168 }, // Ă
-    { 19, 27, 20, 1, 26, 129, 22352 }, // ă
-    { 21, 33, 21, -2, 24, 174, 22481 }, // Ą
-    { 19, 28, 20, 1, 19, 133, 22655 }, // ą
-    { 21, 33, 20, 1, 32, 174, 22788 }, // Ć
-    { 17, 27, 16, 1, 26, 115, 22962 }, // ć
-    { 21, 33, 20, 1, 32, 174, 23077 }, // Ĉ
-    { 17, 27, 16, 1, 26, 115, 23251 }, // ĉ
-    { 21, 33, 20, 1, 32, 174, 23366 }, // Ċ
-    { 16, 27, 16, 1, 26, 108, 23540 }, // ċ
-    { 22, 33, 20, 1, 32, 182, 23648 }, // Č
-    { 18, 27, 16, 1, 26, 122, 23830 }, // č
-    { 23, 32, 23, 0, 32, 184, 23952 }, // Ď
-    { 27, 27, 23, 1, 26, 183, 24136 }, // ď
-    { 22, 24, 23, 0, 24, 132, 24319 }, // Đ
-    { 22, 27, 20, 1, 26, 149, 24451 }, // đ
-    { 20, 30, 18, 0, 30, 150, 24600 }, // Ē
-    { 17, 25, 19, 1, 24, 107, 24750 }, // ē
-    { 20, 32, 18, 0, 32, 160, 24857 }, // Ĕ
-    { 18, 27, 19, 1, 26, 122, 25017 }, // ĕ
-    { 20, 32, 18, 0, 32, 160, 25139 }, // Ė
-    { 17, 27, 19, 1, 26, 115, 25299 }, // ė
-    { 20, 33, 18, 0, 24, 165, 25414 }, // Ę
-    { 17, 27, 19, 1, 19, 115, 25579 }, // ę
-    { 21, 32, 18, 0, 32, 168, 25694 }, // Ě
-    { 19, 27, 19, 1, 26, 129, 25862 }, // ě
-    { 22, 33, 23, 1, 32, 182, 25991 }, // Ĝ
-    { 20, 34, 20, 0, 26, 170, 26173 }, // ĝ
-    { 22, 33, 23, 1, 32, 182, 26343 }, // Ğ
-    { 20, 34, 20, 0, 26, 170, 26525 }, // ğ
-    { 22, 33, 23, 1, 32, 182, 26695 }, // Ġ
-    { 20, 34, 20, 0, 26, 170, 26877 }, // ġ
-    { 22, 33, 23, 1, 25, 182, 27047 }, // Ģ
-    { 20, 34, 20, 0, 26, 170, 27229 }, // ģ
-    { 24, 32, 23, 0, 32, 192, 27399 }, // Ĥ
-    { 19, 33, 20, 0, 33, 157, 27591 }, // ĥ
-    { 26, 24, 23, 0, 24, 156, 27748 }, // Ħ
-    { 19, 26, 20, 0, 26, 124, 27904 }, // ħ
-    { 18, 32, 13, -1, 32, 144, 28028 }, // Ĩ
-    { 15, 26, 10, 0, 26, 98, 28172 }, // ĩ
-    { 17, 30, 13, -1, 30, 128, 28270 }, // Ī
-    { 13, 24, 10, 0, 24, 78, 28398 }, // ī
-    { 18, 32, 13, -1, 32, 144, 28476 }, // Ĭ
-    { 14, 26, 10, 0, 26, 91, 28620 }, // ĭ
-    { 16, 33, 13, -1, 24, 132, 28711 }, // Į
-    { 13, 35, 10, -2, 26, 114, 28843 }, // į
-    { 16, 32, 13, -1, 32, 128, 28957 }, // İ
-    { 10, 19, 10, 0, 19, 48, 29085 }, // ı
-    { 26, 32, 24, -1, 24, 208, 29133 }, // Ĳ
-    { 21, 34, 20, 0, 26, 179, 29341 }, // ĳ
-    { 22, 40, 11, -6, 32, 220, 29520 }, // Ĵ
-    { 19, 34, 10, -5, 26, 162, 29740 }, // ĵ
-    { 24, 32, 20, 0, 24, 192, 29902 }, // Ķ
-    { 21, 34, 19, 0, 26, 179, 30094 }, // ķ
-    { 21, 19, 19, 0, 19, 100, 30273 }, // ĸ
-    { 17, 32, 17, 0, 32, 136, 30373 }, // Ĺ
-    { 16, 33, 10, 0, 33, 132, 30509 }, // ĺ
-    { 16, 32, 17, 0, 24, 128, 30641 }, // Ļ
-    { 13, 34, 10, -2, 26, 111, 30769 }, // ļ
-    { 20, 24, 17, 0, 24, 120, 30880 }, // Ľ
-    { 18, 26, 13, 0, 26, 117, 31000 }, // ľ
-    { 17, 24, 17, 0, 24, 102, 31117 }, // Ŀ
-    { 16, 26, 15, 0, 26, 104, 31219 }, // ŀ
-    { 17, 24, 17, -1, 24, 102, 31323 }, // Ł
-    { 12, 26, 11, 0, 26, 78, 31425 }, // ł
-    { 26, 32, 25, 0, 32, 208, 31503 }, // Ń
-    { 19, 26, 20, 0, 26, 124, 31711 }, // ń
-    { 26, 32, 25, 0, 24, 208, 31835 }, // Ņ
-    { 19, 27, 20, 0, 19, 129, 32043 }, // ņ
-    { 26, 32, 25, 0, 32, 208, 32172 }, // Ň
-    { 21, 26, 20, 0, 26, 137, 32380 }, // ň
-    { 22, 24, 24, 0, 24, 132, 32517 }, // ŉ
-    { 26, 31, 25, 0, 24, 202, 32649 }, // Ŋ
-    { 19, 27, 20, 0, 19, 129, 32851 }, // ŋ
-    { 23, 31, 24, 1, 30, 179, 32980 }, // Ō
-    { 18, 25, 20, 1, 24, 113, 33159 }, // ō
-    { 23, 33, 24, 1, 32, 190, 33272 }, // Ŏ
-    { 18, 27, 20, 1, 26, 122, 33462 }, // ŏ
-    { 25, 33, 24, 1, 32, 207, 33584 }, // Ő
-    { 22, 27, 20, 1, 26, 149, 33791 }, // ő
-    { 30, 26, 30, 2, 25, 195, 33940 }, // Œ
-    { 28, 20, 29, 1, 19, 140, 34135 }, // œ
-    { 21, 32, 21, 0, 32, 168, 34275 }, // Ŕ
-    { 17, 26, 14, 0, 26, 111, 34443 }, // ŕ
-    { 20, 32, 21, 0, 24, 160, 34554 }, // Ŗ
-    { 18, 27, 14, -2, 19, 122, 34714 }, // ŗ
-    { 22, 32, 21, 0, 32, 176, 34836 }, // Ř
-    { 18, 26, 14, 0, 26, 117, 35012 }, // ř
-    { 19, 33, 18, 0, 32, 157, 35129 }, // Ś
-    { 17, 27, 16, 0, 26, 115, 35286 }, // ś
-    { 19, 33, 18, 0, 32, 157, 35401 }, // Ŝ
-    { 17, 27, 16, 0, 26, 115, 35558 }, // ŝ
-    { 19, 33, 18, 0, 25, 157, 35673 }, // Ş
-    { 16, 27, 16, 0, 19, 108, 35830 }, // ş
-    { 20, 33, 18, 0, 32, 165, 35938 }, // Š
-    { 18, 27, 16, 0, 26, 122, 36103 }, // š
-    { 19, 32, 18, 2, 24, 152, 36225 }, // Ţ
-    { 14, 31, 14, 1, 23, 109, 36377 }, // ţ
-    { 19, 32, 18, 2, 32, 152, 36486 }, // Ť
-    { 18, 27, 14, 1, 26, 122, 36638 }, // ť
-    { 19, 24, 18, 2, 24, 114, 36760 }, // Ŧ
-    { 15, 24, 14, 0, 23, 90, 36874 }, // ŧ
-    { 22, 33, 23, 2, 32, 182, 36964 }, // Ũ
-    { 19, 27, 20, 1, 26, 129, 37146 }, // ũ
-    { 22, 31, 23, 2, 30, 171, 37275 }, // Ū
-    { 19, 25, 20, 1, 24, 119, 37446 }, // ū
-    { 22, 33, 23, 2, 32, 182, 37565 }, // Ŭ
-    { 19, 27, 20, 1, 26, 129, 37747 }, // ŭ
-    { 22, 35, 23, 2, 34, 193, 37876 }, // Ů
-    { 19, 29, 20, 1, 28, 138, 38069 }, // ů
-    { 24, 33, 23, 2, 32, 198, 38207 }, // Ű
-    { 22, 27, 20, 1, 26, 149, 38405 }, // ű
-    { 22, 33, 23, 2, 24, 182, 38554 }, // Ų
-    { 19, 28, 20, 1, 19, 133, 38736 }, // ų
-    { 30, 32, 30, 3, 32, 240, 38869 }, // Ŵ
-    { 26, 26, 26, 2, 26, 169, 39109 }, // ŵ
-    { 19, 32, 19, 3, 32, 152, 39278 }, // Ŷ
-    { 23, 34, 17, -3, 26, 196, 39430 }, // ŷ
-    { 19, 32, 19, 3, 32, 152, 39626 }, // Ÿ
-    { 21, 32, 18, -1, 32, 168, 39778 }, // Ź
-    { 18, 26, 16, -1, 26, 117, 39946 }, // ź
-    { 21, 32, 18, -1, 32, 168, 40063 }, // Ż
-    { 17, 26, 16, -1, 26, 111, 40231 }, // ż
-    { 22, 32, 18, -1, 32, 176, 40342 }, // Ž
-    { 19, 26, 16, -1, 26, 124, 40518 }, // ž
-    { 20, 34, 12, -4, 26, 170, 40642 }, // ſ
-    { 8, 6, 0, -14, 26, 12, 40812 }, // ̀
-    { 10, 6, 0, -8, 26, 15, 40824 }, // ́
-    { 14, 6, 0, -5, 26, 21, 40839 }, // ̂
-    { 15, 6, 0, -15, 26, 23, 40860 }, // ̃
-    { 11, 4, 0, -3, 24, 11, 40883 }, // ̄
-    { 15, 5, 0, -4, 29, 19, 40894 }, // ̅
-    { 13, 6, 0, -3, 26, 20, 40913 }, // ̆
-    { 6, 6, 0, 0, 26, 9, 40933 }, // ̇
-    { 12, 6, 0, -3, 26, 18, 40942 }, // ̈
-    { 8, 9, 0, -10, 28, 18, 40960 }, // ̉
-    { 9, 8, 0, -1, 28, 18, 40978 }, // ̊
-    { 16, 6, 0, -4, 26, 24, 40996 }, // ̋
-    { 15, 6, 0, -4, 26, 23, 41020 }, // ̌
-    { 6, 10, 0, 0, 26, 15, 41043 }, // ̍
-    { 12, 7, 0, -3, 26, 21, 41058 }, // ̎
-    { 14, 6, 0, -16, 26, 21, 41079 }, // ̏
-    { 12, 9, 0, -3, 29, 27, 41100 }, // ̐
-    { 13, 6, 0, -4, 26, 20, 41127 }, // ̑
-    { 9, 9, 0, -2, 24, 21, 41147 }, // ̒
-    { 9, 9, 0, -2, 24, 21, 41168 }, // ̓
-    { 5, 9, 0, 0, 24, 12, 41189 }, // ̔
-    { 9, 9, 0, -2, 24, 21, 41201 }, // ̕
-    { 8, 6, 0, -7, -1, 12, 41222 }, // ̖
-    { 10, 6, 0, -8, -1, 15, 41234 }, // ̗
-    { 7, 8, 0, -6, 0, 14, 41249 }, // ̘
-    { 8, 8, 0, -7, 0, 16, 41263 }, // ̙
-    { 11, 10, 10, 2, 26, 28, 41279 }, // ̚
-    { 10, 9, 0, -2, 26, 23, 41307 }, // ̛
-    { 6, 9, 0, -2, 0, 14, 41330 }, // ̜
-    { 8, 6, 0, -7, -1, 12, 41344 }, // ̝
-    { 9, 6, 0, -7, -1, 14, 41356 }, // ̞
-    { 8, 8, 0, -7, 0, 16, 41370 }, // ̟
-    { 8, 3, 0, -7, -2, 6, 41386 }, // ̠
-    { 9, 10, 0, -7, 2, 23, 41392 }, // ̡
-    { 8, 10, 0, -4, 2, 20, 41415 }, // ̢
-    { 7, 6, 0, -16, -2, 11, 41435 }, // ̣
-    { 12, 6, 0, -9, -1, 18, 41446 }, // ̤
-    { 9, 8, 0, -7, 0, 18, 41464 }, // ̥
-    { 7, 6, 0, 2, -2, 11, 41482 }, // ̦
-    { 9, 8, 0, -7, 0, 18, 41493 }, // ̧
-    { 7, 9, 0, -6, 0, 16, 41511 }, // ̨
-    { 7, 10, 0, -6, -1, 18, 41527 }, // ̩
-    { 14, 7, 0, -10, -1, 25, 41545 }, // ̪
-    { 13, 4, 0, -9, -2, 13, 41570 }, // ̫
-    { 14, 6, 0, -9, -1, 21, 41583 }, // ̬
-    { 14, 6, 0, -10, -1, 21, 41604 }, // ̭
-    { 13, 6, 0, -9, -1, 20, 41625 }, // ̮
-    { 13, 6, 0, -9, -1, 20, 41645 }, // ̯
-    { 15, 6, 0, -10, -1, 23, 41665 }, // ̰
-    { 12, 4, 0, -9, -2, 12, 41688 }, // ̱
-    { 17, 3, 0, -11, -3, 13, 41700 }, // ̲
-    { 16, 8, 0, -11, 0, 32, 41713 }, // ̳
-    { 14, 6, 0, -7, 13, 21, 41745 }, // ̴
-    { 15, 5, 0, -8, 11, 19, 41766 }, // ̵
-    { 26, 5, 0, -13, 12, 33, 41785 }, // ̶
-    { 12, 9, 0, -6, 14, 27, 41818 }, // ̷
-    { 20, 28, 0, -10, 26, 140, 41845 }, // ̸
-    { 6, 9, 0, -3, 0, 14, 41985 }, // ̹
-    { 14, 7, 0, -10, -1, 25, 41999 }, // ̺
-    { 14, 8, 0, -10, 0, 28, 42024 }, // ̻
-    { 13, 4, 0, -9, -2, 13, 42052 }, // ̼
-    { 8, 7, 0, -1, 26, 14, 42065 }, // ̽
-    { 8, 10, 0, -1, 29, 20, 42079 }, // ̾
-    { 15, 8, 0, -4, 33, 30, 42099 }, // ̿
-    { 8, 6, 0, -3, 26, 12, 42129 }, // ̀
-    { 10, 6, 0, 0, 26, 15, 42141 }, // ́
-    { 14, 6, 0, 5, 26, 21, 42156 }, // ͂
-    { 6, 7, 0, 0, 26, 11, 42177 }, // ̓
-    { 18, 6, 0, -5, 26, 27, 42188 }, // ̈́
-    { 7, 6, 0, -5, -2, 11, 42215 }, // ͅ
-    { 16, 7, 0, -5, 26, 28, 42226 }, // ͆
-    { 16, 8, 0, -11, 0, 32, 42254 }, // ͇
-    { 11, 7, 0, -8, -1, 20, 42286 }, // ͈
-    { 7, 6, 0, -6, -2, 11, 42306 }, // ͉
-    { 13, 8, 0, -4, 26, 26, 42317 }, // ͊
-    { 13, 14, 0, -3, 32, 46, 42343 }, // ͋
-    { 14, 9, 0, -4, 29, 32, 42389 }, // ͌
-    { 13, 7, 0, -9, -1, 23, 42421 }, // ͍
-    { 7, 8, 0, -6, 0, 14, 42444 }, // ͎
-    { 24, 24, 0, -12, 24, 144, 42458 }, // ͏
-    { 6, 8, 0, 0, 27, 12, 42602 }, // ͐
-    { 6, 9, 0, 4, 29, 14, 42614 }, // ͑
-    { 12, 9, 0, -3, 29, 27, 42628 }, // ͒
-    { 8, 7, 0, -6, -1, 14, 42655 }, // ͓
-    { 6, 7, 0, -5, -1, 11, 42669 }, // ͔
-    { 7, 7, 0, -5, -1, 13, 42680 }, // ͕
-    { 13, 7, 0, -8, -1, 23, 42693 }, // ͖
-    { 6, 9, 0, 3, 28, 14, 42716 }, // ͗
-    { 6, 6, 0, 0, 26, 9, 42730 }, // ͘
-    { 9, 7, 0, -7, -1, 16, 42739 }, // ͙
-    { 13, 8, 0, -9, 0, 26, 42755 }, // ͚
-    { 7, 8, 0, 0, 27, 14, 42781 }, // ͛
-    { 26, 7, 0, -15, -1, 46, 42795 }, // ͜
-    { 26, 7, 0, -10, 26, 46, 42841 }, // ͝
-    { 18, 4, 0, -6, 24, 18, 42887 }, // ͞
-    { 19, 4, 0, -12, -1, 19, 42905 }, // ͟
-    { 27, 6, 0, -10, 26, 41, 42924 }, // ͠
-    { 27, 7, 0, -10, 29, 48, 42965 }, // ͡
-    { 27, 8, 0, -17, 0, 54, 43013 }, // ͢
-    { 9, 9, 0, -1, 29, 21, 43067 }, // ͣ
-    { 9, 9, 0, -1, 29, 21, 43088 }, // ͤ
-    { 5, 11, 0, 1, 31, 14, 43109 }, // ͥ
-    { 8, 9, 0, -1, 29, 18, 43123 }, // ͦ
-    { 9, 8, 0, -1, 28, 18, 43141 }, // ͧ
-    { 7, 9, 0, 0, 29, 16, 43159 }, // ͨ
-    { 10, 11, 0, -1, 31, 28, 43175 }, // ͩ
-    { 9, 11, 0, -2, 31, 25, 43203 }, // ͪ
-    { 14, 9, 0, -4, 29, 32, 43228 }, // ͫ
-    { 7, 9, 0, 0, 29, 16, 43260 }, // ͬ
-    { 7, 10, 0, 0, 30, 18, 43276 }, // ͭ
-    { 8, 8, 0, 0, 28, 16, 43294 }, // ͮ
-    { 10, 8, 0, -2, 28, 20, 43310 }, // ͯ
-    { 20, 32, 18, 0, 32, 160, 43330 }, // Ѐ
-    { 20, 32, 18, 0, 32, 160, 43490 }, // Ё
-    { 21, 25, 24, 2, 24, 132, 43650 }, // Ђ
-    { 20, 32, 17, 0, 32, 160, 43782 }, // Ѓ
-    { 21, 26, 20, 1, 25, 137, 43942 }, // Є
-    { 19, 26, 18, 0, 25, 124, 44079 }, // Ѕ
-    { 11, 24, 10, 0, 24, 66, 44203 }, // І
-    { 15, 32, 10, 0, 32, 120, 44269 }, // Ї
-    { 18, 32, 11, -6, 24, 144, 44389 }, // Ј
-    { 34, 25, 32, -2, 24, 213, 44533 }, // Љ
-    { 31, 24, 31, 0, 24, 186, 44746 }, // Њ
-    { 21, 24, 24, 2, 24, 126, 44932 }, // Ћ
-    { 24, 32, 21, 0, 32, 192, 45058 }, // Ќ
-    { 24, 32, 23, 0, 32, 192, 45250 }, // Ѝ
-    { 23, 33, 20, 0, 32, 190, 45442 }, // Ў
-    { 23, 30, 22, 0, 24, 173, 45632 }, // Џ
-    { 21, 24, 21, -2, 24, 126, 45805 }, // А
-    { 20, 24, 20, 0, 24, 120, 45931 }, // Б
-    { 21, 24, 21, 0, 24, 126, 46051 }, // В
-    { 20, 24, 17, 0, 24, 120, 46177 }, // Г
-    { 27, 30, 24, -3, 24, 203, 46297 }, // Д
-    { 20, 24, 18, 0, 24, 120, 46500 }, // Е
-    { 35, 24, 30, -2, 24, 210, 46620 }, // Ж
-    { 20, 26, 19, 0, 25, 130, 46830 }, // З
-    { 24, 24, 23, 0, 24, 144, 46960 }, // И
-    { 24, 32, 23, 0, 32, 192, 47104 }, // Й
-    { 24, 24, 21, 0, 24, 144, 47296 }, // К
-    { 26, 25, 23, -2, 24, 163, 47440 }, // Л
-    { 30, 24, 29, 0, 24, 180, 47603 }, // М
-    { 24, 24, 23, 0, 24, 144, 47783 }, // Н
-    { 23, 26, 24, 1, 25, 150, 47927 }, // О
-    { 24, 24, 23, 0, 24, 144, 48077 }, // П
-    { 21, 24, 20, 0, 24, 126, 48221 }, // Р
-    { 21, 26, 20, 1, 25, 137, 48347 }, // С
-    { 19, 24, 17, 2, 24, 114, 48484 }, // Т
-    { 23, 25, 20, 0, 24, 144, 48598 }, // У
-    { 28, 26, 29, 1, 25, 182, 48742 }, // Ф
-    { 25, 24, 20, -2, 24, 150, 48924 }, // Х
-    { 23, 30, 23, 0, 24, 173, 49074 }, // Ц
-    { 21, 24, 22, 2, 24, 126, 49247 }, // Ч
-    { 34, 24, 33, 0, 24, 204, 49373 }, // Ш
-    { 33, 29, 33, 0, 24, 240, 49577 }, // Щ
-    { 21, 24, 23, 2, 24, 126, 49817 }, // Ъ
-    { 30, 24, 29, 0, 24, 180, 49943 }, // Ы
-    { 19, 24, 20, 0, 24, 114, 50123 }, // Ь
-    { 21, 26, 20, 0, 25, 137, 50237 }, // Э
-    { 33, 26, 33, 0, 25, 215, 50374 }, // Ю
-    { 24, 24, 21, -2, 24, 144, 50589 }, // Я
-    { 19, 20, 19, 0, 19, 95, 50733 }, // а
-    { 19, 27, 19, 1, 26, 129, 50828 }, // б
-    { 18, 20, 18, 0, 19, 90, 50957 }, // в
-    { 17, 20, 15, -1, 19, 85, 51047 }, // г
-    { 18, 27, 19, 1, 26, 122, 51132 }, // д
-    { 17, 20, 17, 1, 19, 85, 51254 }, // е
-    { 34, 20, 32, -1, 19, 170, 51339 }, // ж
-    { 16, 20, 17, 0, 19, 80, 51509 }, // з
-    { 19, 20, 20, 1, 19, 95, 51589 }, // и
-    { 19, 27, 20, 1, 26, 129, 51684 }, // й
-    { 21, 19, 19, 0, 19, 100, 51813 }, // к
-    { 21, 20, 20, -1, 19, 105, 51913 }, // л
-    { 26, 19, 26, 0, 19, 124, 52018 }, // м
-    { 20, 19, 20, 0, 19, 95, 52142 }, // н
-    { 19, 20, 19, 0, 19, 95, 52237 }, // о
-    { 19, 19, 20, 0, 19, 91, 52332 }, // п
-    { 21, 27, 20, -2, 19, 142, 52423 }, // р
-    { 16, 20, 16, 0, 19, 80, 52565 }, // с
-    { 29, 19, 30, 0, 19, 138, 52645 }, // т
-    { 23, 27, 18, -3, 19, 156, 52783 }, // у
-    { 23, 34, 25, 1, 26, 196, 52939 }, // ф
-    { 22, 19, 17, -2, 19, 105, 53135 }, // х
-    { 19, 24, 20, 1, 19, 114, 53240 }, // ц
-    { 17, 19, 19, 2, 19, 81, 53354 }, // ч
-    { 29, 20, 30, 1, 19, 145, 53435 }, // ш
-    { 29, 24, 30, 1, 19, 174, 53580 }, // щ
-    { 19, 20, 21, 1, 19, 95, 53754 }, // ъ
-    { 26, 20, 27, 1, 19, 130, 53849 }, // ы
-    { 17, 20, 18, 1, 19, 85, 53979 }, // ь
-    { 15, 20, 16, 0, 19, 75, 54064 }, // э
-    { 27, 20, 27, 0, 19, 135, 54139 }, // ю
-    { 20, 19, 18, -2, 19, 95, 54274 }, // я
-    { 17, 27, 17, 1, 26, 115, 54369 }, // ѐ
-    { 17, 26, 17, 1, 25, 111, 54484 }, // ё
-    { 19, 34, 20, 0, 26, 162, 54595 }, // ђ
-    { 18, 27, 15, -1, 26, 122, 54757 }, // ѓ
-    { 16, 20, 16, 0, 19, 80, 54879 }, // є
-    { 15, 20, 15, 0, 19, 75, 54959 }, // ѕ
-    { 11, 26, 10, 0, 26, 72, 55034 }, // і
-    { 13, 26, 10, 0, 26, 85, 55106 }, // ї
-    { 16, 34, 10, -5, 26, 136, 55191 }, // ј
-    { 29, 20, 29, -1, 19, 145, 55327 }, // љ
-    { 27, 20, 28, 0, 19, 135, 55472 }, // њ
-    { 19, 26, 20, 0, 26, 124, 55607 }, // ћ
-    { 21, 26, 19, 0, 26, 137, 55731 }, // ќ
-    { 19, 27, 20, 1, 26, 129, 55868 }, // ѝ
-    { 23, 34, 18, -3, 26, 196, 55997 }, // ў
-    { 19, 26, 20, 1, 19, 124, 56193 }, // џ
-    { 31, 24, 30, 2, 24, 186, 56317 }, // Ѡ
-    { 27, 19, 27, 2, 19, 129, 56503 }, // ѡ
-    { 18, 24, 21, 2, 24, 108, 56632 }, // Ѣ
-    { 27, 20, 28, 0, 19, 135, 56740 }, // ѣ
-    { 31, 26, 30, 0, 25, 202, 56875 }, // Ѥ
-    { 26, 20, 25, 0, 19, 130, 57077 }, // ѥ
-    { 23, 24, 22, -2, 24, 138, 57207 }, // Ѧ
-    { 21, 19, 19, -3, 19, 100, 57345 }, // ѧ
-    { 29, 24, 31, 0, 24, 174, 57445 }, // Ѩ
-    { 27, 19, 28, 0, 19, 129, 57619 }, // ѩ
-    { 27, 24, 24, -2, 24, 162, 57748 }, // Ѫ
-    { 22, 19, 19, -2, 19, 105, 57910 }, // ѫ
-    { 34, 24, 33, 0, 24, 204, 58015 }, // Ѭ
-    { 29, 19, 28, 0, 19, 138, 58219 }, // ѭ
-    { 22, 37, 20, -2, 29, 204, 58357 }, // Ѯ
-    { 20, 31, 17, -2, 23, 155, 58561 }, // ѯ
-    { 27, 24, 28, 3, 24, 162, 58716 }, // Ѱ
-    { 25, 34, 27, 1, 26, 213, 58878 }, // ѱ
-    { 23, 26, 24, 1, 25, 150, 59091 }, // Ѳ
-    { 18, 20, 20, 1, 19, 90, 59241 }, // ѳ
-    { 21, 24, 22, 3, 24, 126, 59331 }, // Ѵ
-    { 19, 19, 18, 1, 19, 91, 59457 }, // ѵ
-    { 21, 32, 22, 3, 32, 168, 59548 }, // Ѷ
-    { 19, 26, 18, 1, 26, 124, 59716 }, // ѷ
-    { 43, 33, 42, 1, 25, 355, 59840 }, // Ѹ
-    { 38, 27, 37, 1, 19, 257, 60195 }, // ѹ
-    { 23, 29, 25, 2, 26, 167, 60452 }, // Ѻ
-    { 19, 22, 21, 1, 20, 105, 60619 }, // ѻ
-    { 31, 36, 34, 2, 35, 279, 60724 }, // Ѽ
-    { 27, 31, 29, 1, 30, 210, 61003 }, // ѽ
-    { 31, 31, 30, 2, 31, 241, 61213 }, // Ѿ
-    { 27, 25, 27, 2, 25, 169, 61454 }, // ѿ
-    { 21, 33, 20, 1, 25, 174, 61623 }, // Ҁ
-    { 16, 27, 16, 1, 19, 108, 61797 }, // ҁ
-    { 18, 22, 20, 1, 21, 99, 61905 }, // ҂
-    { 13, 7, 0, -13, 25, 23, 62004 }, // ҃
-    { 14, 6, 0, -14, 26, 21, 62027 }, // ҄
-    { 6, 8, 0, -9, 27, 12, 62048 }, // ҅
-    { 7, 8, 0, -10, 27, 14, 62060 }, // ҆
-    { 14, 6, 0, -3, 31, 21, 62074 }, // ҇
-    { 38, 36, 0, -19, 27, 342, 62095 }, // ҈
-    { 38, 38, 0, -19, 28, 361, 62437 }, // ҉
-    { 27, 39, 27, 0, 32, 264, 62798 }, // Ҋ
-    { 20, 34, 21, 1, 27, 170, 63062 }, // ҋ
-    { 18, 24, 20, 0, 24, 108, 63232 }, // Ҍ
-    { 17, 27, 19, 1, 26, 115, 63340 }, // ҍ
-    { 21, 24, 20, 0, 24, 126, 63455 }, // Ҏ
-    { 21, 27, 20, -2, 19, 142, 63581 }, // ҏ
-    { 21, 29, 17, 0, 29, 153, 63723 }, // Ґ
-    { 18, 24, 15, 0, 24, 108, 63876 }, // ґ
-    { 20, 24, 17, 0, 24, 120, 63984 }, // Ғ
-    { 18, 19, 15, -1, 19, 86, 64104 }, // ғ
-    { 20, 33, 22, 0, 24, 165, 64190 }, // Ҕ
-    { 17, 28, 19, 0, 19, 119, 64355 }, // ҕ
-    { 35, 31, 31, -3, 24, 272, 64474 }, // Җ
-    { 34, 26, 32, -1, 19, 221, 64746 }, // җ
-    { 20, 34, 19, 0, 25, 170, 64967 }, // Ҙ
-    { 16, 28, 17, 0, 19, 112, 65137 }, // ҙ
-    { 23, 31, 23, 0, 24, 179, 65249 }, // Қ
-    { 21, 26, 20, 0, 19, 137, 65428 }, // қ
-    { 24, 24, 21, 0, 24, 144, 65565 }, // Ҝ
-    { 21, 19, 20, 1, 19, 100, 65709 }, // ҝ
-    { 24, 24, 20, 0, 24, 144, 65809 }, // Ҟ
-    { 21, 26, 19, 0, 26, 137, 65953 }, // ҟ
-    { 25, 24, 23, 2, 24, 150, 66090 }, // Ҡ
-    { 23, 19, 22, 1, 19, 110, 66240 }, // ҡ
-    { 24, 31, 26, 0, 24, 186, 66350 }, // Ң
-    { 21, 26, 22, 0, 19, 137, 66536 }, // ң
-    { 29, 24, 26, 0, 24, 174, 66673 }, // Ҥ
-    { 26, 19, 24, 0, 19, 124, 66847 }, // ҥ
-    { 32, 33, 34, 0, 24, 264, 66971 }, // Ҧ
-    { 27, 28, 29, 0, 19, 189, 67235 }, // ҧ
-    { 21, 27, 24, 2, 25, 142, 67424 }, // Ҩ
-    { 18, 21, 20, 1, 19, 95, 67566 }, // ҩ
-    { 21, 34, 20, 1, 25, 179, 67661 }, // Ҫ
-    { 16, 28, 16, 1, 19, 112, 67840 }, // ҫ
-    { 19, 31, 18, 2, 24, 148, 67952 }, // Ҭ
-    { 30, 26, 31, 0, 19, 195, 68100 }, // ҭ
-    { 19, 24, 19, 3, 24, 114, 68295 }, // Ү
-    { 18, 27, 17, 1, 19, 122, 68409 }, // ү
-    { 21, 24, 19, 1, 24, 126, 68531 }, // Ұ
-    { 20, 27, 17, -1, 19, 135, 68657 }, // ұ
-    { 25, 31, 23, -2, 24, 194, 68792 }, // Ҳ
-    { 22, 26, 20, -2, 19, 143, 68986 }, // ҳ
-    { 25, 31, 28, 2, 24, 194, 69129 }, // Ҵ
-    { 21, 26, 23, 1, 19, 137, 69323 }, // ҵ
-    { 21, 31, 25, 3, 24, 163, 69460 }, // Ҷ
-    { 18, 26, 21, 2, 19, 117, 69623 }, // ҷ
-    { 20, 24, 23, 3, 24, 120, 69740 }, // Ҹ
-    { 18, 19, 20, 2, 19, 86, 69860 }, // ҹ
-    { 21, 24, 23, 0, 24, 126, 69946 }, // Һ
-    { 19, 26, 20, 0, 26, 124, 70072 }, // һ
-    { 25, 26, 26, 1, 25, 163, 70196 }, // Ҽ
-    { 22, 20, 22, 0, 19, 110, 70359 }, // ҽ
-    { 25, 32, 26, 1, 25, 200, 70469 }, // Ҿ
-    { 22, 26, 22, 0, 19, 143, 70669 }, // ҿ
-    { 16, 24, 13, -1, 24, 96, 70812 }, // Ӏ
-    { 35, 32, 30, -2, 32, 280, 70908 }, // Ӂ
-    { 34, 27, 32, -1, 26, 230, 71188 }, // ӂ
-    { 23, 33, 23, 0, 24, 190, 71418 }, // Ӄ
-    { 21, 28, 21, 0, 19, 147, 71608 }, // ӄ
-    { 26, 31, 25, -1, 24, 202, 71755 }, // Ӆ
-    { 22, 26, 22, -1, 19, 143, 71957 }, // ӆ
-    { 24, 33, 23, 0, 24, 198, 72100 }, // Ӈ
-    { 20, 28, 21, 0, 19, 140, 72298 }, // ӈ
-    { 25, 31, 26, 0, 24, 194, 72438 }, // Ӊ
-    { 22, 26, 23, 0, 19, 143, 72632 }, // ӊ
-    { 20, 31, 22, 3, 24, 155, 72775 }, // Ӌ
-    { 18, 26, 20, 2, 19, 117, 72930 }, // ӌ
-    { 31, 31, 32, 0, 24, 241, 73047 }, // Ӎ
-    { 27, 26, 28, 0, 19, 176, 73288 }, // ӎ
-    { 16, 24, 13, -1, 24, 96, 73464 }, // ӏ
-    { 24, 32, 21, -2, 32, 192, 73560 }, // Ӑ
-    { 19, 27, 20, 1, 26, 129, 73752 }, // ӑ
-    { 22, 32, 21, -2, 32, 176, 73881 }, // Ӓ
-    { 19, 27, 20, 1, 26, 129, 74057 }, // ӓ
-    { 33, 24, 30, -2, 24, 198, 74186 }, // Ӕ
-    { 28, 20, 29, 1, 19, 140, 74384 }, // ӕ
-    { 21, 32, 18, 0, 32, 168, 74524 }, // Ӗ
-    { 19, 27, 19, 1, 26, 129, 74692 }, // ӗ
-    { 20, 26, 22, 1, 25, 130, 74821 }, // Ә
-    { 18, 20, 19, 0, 19, 90, 74951 }, // ә
-    { 20, 33, 22, 1, 32, 165, 75041 }, // Ӛ
-    { 18, 27, 19, 0, 26, 122, 75206 }, // ӛ
-    { 35, 32, 30, -2, 32, 280, 75328 }, // Ӝ
-    { 34, 27, 32, -1, 26, 230, 75608 }, // ӝ
-    { 20, 33, 19, 0, 32, 165, 75838 }, // Ӟ
-    { 17, 27, 17, 0, 26, 115, 76003 }, // ӟ
-    { 20, 25, 19, -1, 24, 125, 76118 }, // Ӡ
-    { 20, 28, 18, -2, 19, 140, 76243 }, // ӡ
-    { 24, 30, 23, 0, 30, 180, 76383 }, // Ӣ
-    { 19, 25, 20, 1, 24, 119, 76563 }, // ӣ
-    { 24, 32, 23, 0, 32, 192, 76682 }, // Ӥ
-    { 19, 27, 20, 1, 26, 129, 76874 }, // ӥ
-    { 23, 33, 24, 1, 32, 190, 77003 }, // Ӧ
-    { 18, 27, 20, 1, 26, 122, 77193 }, // ӧ
-    { 23, 26, 24, 1, 25, 150, 77315 }, // Ө
-    { 18, 20, 20, 1, 19, 90, 77465 }, // ө
-    { 23, 33, 24, 1, 32, 190, 77555 }, // Ӫ
-    { 18, 27, 20, 1, 26, 122, 77745 }, // ӫ
-    { 21, 33, 20, 0, 32, 174, 77867 }, // Ӭ
-    { 16, 27, 16, 0, 26, 108, 78041 }, // ӭ
-    { 23, 31, 20, 0, 30, 179, 78149 }, // Ӯ
-    { 23, 32, 17, -3, 24, 184, 78328 }, // ӯ
-    { 23, 33, 20, 0, 32, 190, 78512 }, // Ӱ
-    { 23, 34, 17, -3, 26, 196, 78702 }, // ӱ
-    { 24, 33, 20, 0, 32, 198, 78898 }, // Ӳ
-    { 24, 34, 17, -3, 26, 204, 79096 }, // ӳ
-    { 21, 32, 22, 2, 32, 168, 79300 }, // Ӵ
-    { 17, 26, 19, 2, 26, 111, 79468 }, // ӵ
-    { 20, 31, 17, 0, 24, 155, 79579 }, // Ӷ
-    { 17, 26, 15, 0, 19, 111, 79734 }, // ӷ
-    { 30, 32, 29, 0, 32, 240, 79845 }, // Ӹ
-    { 26, 27, 27, 1, 26, 176, 80085 }, // ӹ
-    { 20, 33, 17, 0, 24, 165, 80261 }, // Ӻ
-    { 18, 28, 15, -1, 19, 126, 80426 }, // ӻ
-    { 25, 33, 23, -2, 24, 207, 80552 }, // Ӽ
-    { 22, 28, 20, -2, 19, 154, 80759 }, // ӽ
-    { 25, 24, 20, -2, 24, 150, 80913 }, // Ӿ
-    { 22, 19, 18, -2, 19, 105, 81063 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 81168 }, //  
-    { 0, 0, 33, 0, 0, 0, 81168 }, //  
-    { 0, 0, 17, 0, 0, 0, 81168 }, //  
-    { 0, 0, 33, 0, 0, 0, 81168 }, //  
-    { 0, 0, 11, 0, 0, 0, 81168 }, //  
-    { 0, 0, 8, 0, 0, 0, 81168 }, //  
-    { 0, 0, 6, 0, 0, 0, 81168 }, //  
-    { 0, 0, 18, 0, 0, 0, 81168 }, //  
-    { 0, 0, 10, 0, 0, 0, 81168 }, //  
-    { 0, 0, 6, 0, 0, 0, 81168 }, //  
-    { 0, 0, 3, 0, 0, 0, 81168 }, //  
-    { 0, 0, 0, 0, 0, 0, 81168 }, // ​
-    { 0, 0, 0, 0, 0, 0, 81168 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 81168 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 81168 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 81231 }, // ‏
-    { 10, 5, 11, 0, 11, 13, 81294 }, // ‐
-    { 10, 5, 11, 0, 11, 13, 81307 }, // ‑
-    { 17, 5, 18, 1, 14, 22, 81320 }, // ‒
-    { 16, 4, 16, 0, 11, 16, 81342 }, // –
-    { 32, 4, 32, 0, 11, 32, 81358 }, // —
-    { 32, 4, 32, 0, 11, 32, 81390 }, // ―
-    { 13, 34, 18, 3, 26, 111, 81422 }, // ‖
-    { 16, 8, 13, -4, 0, 32, 81533 }, // ‗
-    { 9, 9, 7, 1, 24, 21, 81565 }, // ‘
-    { 9, 9, 7, 1, 24, 21, 81586 }, // ’
-    { 9, 9, 9, -2, 4, 21, 81607 }, // ‚
-    { 6, 9, 7, 3, 24, 14, 81628 }, // ‛
-    { 17, 9, 14, 1, 24, 39, 81642 }, // “
-    { 16, 9, 14, 1, 24, 36, 81681 }, // ”
-    { 16, 9, 17, -2, 4, 36, 81717 }, // „
-    { 13, 9, 14, 3, 24, 30, 81753 }, // ‟
-    { 15, 26, 17, 3, 26, 98, 81783 }, // †
-    { 17, 26, 17, 1, 26, 111, 81881 }, // ‡
-    { 10, 11, 13, 2, 18, 28, 81992 }, // •
-    { 11, 13, 12, 1, 19, 36, 82020 }, // ‣
-    { 7, 7, 17, 3, 6, 13, 82056 }, // ․
-    { 16, 7, 19, 0, 6, 28, 82069 }, // ‥
-    { 25, 7, 28, 0, 6, 44, 82097 }, // …
-    { 7, 7, 11, 2, 13, 13, 82141 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 82154 }, //  
-    { 0, 0, 20, 0, 0, 0, 82154 }, //  
-    { 9, 26, 0, -1, 21, 59, 82154 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 82213 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 82272 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 82328 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 82384 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 82440 }, //  
-    { 39, 26, 41, 1, 25, 254, 82440 }, // ‰
-    { 51, 26, 53, 1, 25, 332, 82694 }, // ‱
-    { 10, 9, 9, 2, 24, 23, 83026 }, // ′
-    { 18, 9, 17, 2, 24, 41, 83049 }, // ″
-    { 25, 9, 25, 2, 24, 57, 83090 }, // ‴
-    { 9, 9, 9, 2, 24, 21, 83147 }, // ‵
-    { 17, 9, 17, 2, 24, 39, 83168 }, // ‶
-    { 24, 9, 25, 2, 24, 54, 83207 }, // ‷
-    { 12, 11, 12, -3, 3, 33, 83261 }, // ‸
-    { 10, 16, 11, 1, 17, 40, 83294 }, // ‹
-    { 10, 16, 11, 0, 17, 40, 83334 }, // ›
-    { 27, 26, 28, 1, 25, 176, 83374 }, // ※
-    { 20, 25, 19, 0, 24, 125, 83550 }, // ‼
-    { 15, 26, 15, 2, 25, 98, 83675 }, // ‽
-    { 16, 4, 14, 3, 29, 16, 83773 }, // ‾
-    { 17, 8, 18, -2, 0, 34, 83789 }, // ‿
-    { 18, 8, 18, 2, 27, 36, 83823 }, // ⁀
-    { 17, 22, 13, -3, 14, 94, 83859 }, // ⁁
-    { 38, 31, 38, -1, 26, 295, 83953 }, // ⁂
-    { 10, 5, 11, 0, 11, 13, 84248 }, // ⁃
-    { 22, 24, 4, -9, 24, 132, 84261 }, // ⁄
-    { 15, 30, 11, -1, 24, 113, 84393 }, // ⁅
-    { 15, 30, 11, -3, 24, 113, 84506 }, // ⁆
-    { 30, 26, 30, 2, 25, 195, 84619 }, // ⁇
-    { 25, 26, 25, 2, 25, 163, 84814 }, // ⁈
-    { 26, 26, 25, 0, 25, 169, 84977 }, // ⁉
-    { 17, 19, 18, 2, 19, 81, 85146 }, // ⁊
-    { 18, 31, 21, 3, 26, 140, 85227 }, // ⁋
-    { 18, 18, 21, 1, 19, 81, 85367 }, // ⁌
-    { 18, 18, 21, 2, 19, 81, 85448 }, // ⁍
-    { 17, 17, 18, -1, 9, 73, 85529 }, // ⁎
-    { 9, 24, 10, 1, 19, 54, 85602 }, // ⁏
-    { 22, 35, 18, -2, 27, 193, 85656 }, // ⁐
-    { 20, 34, 18, -1, 26, 170, 85849 }, // ⁑
-    { 14, 26, 14, 0, 25, 91, 86019 }, // ⁒
-    { 32, 7, 33, 1, 13, 56, 86110 }, // ⁓
-    { 17, 8, 18, -3, 0, 34, 86166 }, // ⁔
-    { 19, 19, 19, 0, 18, 91, 86200 }, // ⁕
-    { 16, 26, 19, 1, 25, 104, 86291 }, // ⁖
-    { 30, 9, 29, 2, 24, 68, 86395 }, // ⁗
-    { 26, 26, 28, 1, 25, 169, 86463 }, // ⁘
-    { 26, 26, 28, 1, 25, 169, 86632 }, // ⁙
-    { 7, 26, 9, 1, 25, 46, 86801 }, // ⁚
-    { 22, 27, 24, 1, 26, 149, 86847 }, // ⁛
-    { 27, 27, 28, 0, 25, 183, 86996 }, // ⁜
-    { 7, 27, 9, 1, 26, 48, 87179 }, // ⁝
-    { 6, 26, 10, 2, 25, 39, 87227 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 87266 }, //  
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁤
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁦
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁧
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁨
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 87266 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 87322 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 87378 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 87434 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 87492 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 87548 }, // ⁯
-    { 12, 16, 13, 3, 29, 48, 87604 }, // ⁰
-    { 7, 16, 8, 2, 25, 28, 87652 }, // ⁱ
-    { 14, 16, 13, 1, 29, 56, 87680 }, // ⁴
-    { 13, 16, 13, 2, 29, 52, 87736 }, // ⁵
-    { 12, 16, 13, 3, 29, 48, 87788 }, // ⁶
-    { 13, 16, 13, 3, 29, 52, 87836 }, // ⁷
-    { 13, 16, 13, 2, 29, 52, 87888 }, // ⁸
-    { 12, 16, 13, 3, 29, 48, 87940 }, // ⁹
-    { 11, 10, 13, 3, 25, 28, 87988 }, // ⁺
-    { 11, 3, 13, 3, 21, 9, 88016 }, // ⁻
-    { 10, 8, 13, 4, 24, 20, 88025 }, // ⁼
-    { 8, 19, 7, 4, 30, 38, 88045 }, // ⁽
-    { 9, 19, 7, 0, 30, 43, 88083 }, // ⁾
-    { 12, 12, 13, 2, 21, 36, 88126 }, // ⁿ
-    { 12, 16, 13, -1, 11, 48, 88162 }, // ₀
-    { 11, 16, 13, -1, 11, 44, 88210 }, // ₁
-    { 13, 16, 13, -2, 11, 52, 88254 }, // ₂
-    { 13, 16, 13, -2, 11, 52, 88306 }, // ₃
-    { 13, 16, 13, -2, 11, 52, 88358 }, // ₄
-    { 13, 16, 13, -2, 11, 52, 88410 }, // ₅
-    { 13, 16, 13, -1, 11, 52, 88462 }, // ₆
-    { 13, 16, 13, -1, 11, 52, 88514 }, // ₇
-    { 13, 16, 13, -2, 11, 52, 88566 }, // ₈
-    { 12, 16, 13, -1, 11, 48, 88618 }, // ₉
-    { 10, 10, 13, 0, 8, 25, 88666 }, // ₊
-    { 10, 3, 13, 0, 4, 8, 88691 }, // ₋
-    { 11, 8, 13, 0, 6, 22, 88699 }, // ₌
-    { 9, 19, 7, 0, 13, 43, 88721 }, // ₍
-    { 9, 19, 7, -4, 13, 43, 88764 }, // ₎
-    { 12, 12, 13, -1, 8, 36, 88807 }, // ₐ
-    { 11, 12, 12, -1, 8, 33, 88843 }, // ₑ
-    { 11, 12, 13, -1, 8, 33, 88876 }, // ₒ
-    { 14, 12, 12, -3, 8, 42, 88909 }, // ₓ
-    { 12, 12, 12, -2, 8, 36, 88951 }, // ₔ
-    { 13, 16, 15, -1, 12, 52, 88987 }, // ₕ
-    { 14, 16, 13, -1, 12, 56, 89039 }, // ₖ
-    { 8, 16, 8, -1, 12, 32, 89095 }, // ₗ
-    { 19, 12, 21, -1, 8, 57, 89127 }, // ₘ
-    { 13, 12, 13, -2, 8, 39, 89184 }, // ₙ
-    { 14, 16, 13, -3, 8, 56, 89223 }, // ₚ
-    { 10, 12, 11, -1, 8, 30, 89279 }, // ₛ
-    { 9, 15, 9, -1, 11, 34, 89309 }, // ₜ
-    { 19, 25, 19, 1, 25, 119, 89343 }, // ₠
-    { 20, 28, 18, 1, 26, 140, 89462 }, // ₡
-    { 20, 26, 19, 1, 25, 130, 89602 }, // ₢
-    { 20, 24, 18, 0, 24, 120, 89732 }, // ₣
-    { 22, 25, 18, -1, 25, 138, 89852 }, // ₤
-    { 29, 27, 30, 0, 23, 196, 89990 }, // ₥
-    { 21, 24, 19, 0, 24, 126, 90186 }, // ₦
-    { 29, 25, 29, 0, 24, 182, 90312 }, // ₧
-    { 31, 25, 30, 0, 24, 194, 90494 }, // ₨
-    { 27, 24, 24, 0, 24, 162, 90688 }, // ₩
-    { 28, 24, 29, 1, 24, 168, 90850 }, // ₪
-    { 23, 32, 20, 0, 26, 184, 91018 }, // ₫
-    { 21, 26, 18, 0, 25, 137, 91202 }, // €
-    { 23, 24, 19, 0, 24, 138, 91339 }, // ₭
-    { 20, 24, 18, 1, 24, 120, 91477 }, // ₮
-    { 33, 33, 34, 0, 25, 273, 91597 }, // ₯
-    { 22, 33, 20, -2, 25, 182, 91870 }, // ₰
-    { 21, 24, 19, 0, 24, 126, 92052 }, // ₱
-    { 22, 29, 23, 1, 26, 160, 92178 }, // ₲
-    { 23, 24, 20, -2, 24, 138, 92338 }, // ₳
-    { 20, 26, 19, 0, 25, 130, 92476 }, // ₴
-    { 20, 29, 20, 2, 26, 145, 92606 }, // ₵
-    { 24, 24, 23, 0, 23, 144, 92751 }, // ₶
-    { 25, 28, 23, -1, 25, 175, 92895 }, // ₷
-    { 19, 24, 18, 1, 24, 114, 93070 }, // ₸
-    { 18, 24, 18, 2, 24, 108, 93184 }, // ₹
-    { 19, 25, 18, 0, 24, 119, 93292 }, // ₺
-    { 21, 26, 21, 2, 25, 137, 93411 }, // ₻
-    { 27, 24, 27, -1, 24, 162, 93548 }, // ₼
-    { 21, 24, 19, -1, 24, 126, 93710 }, // ₽
-    { 23, 28, 20, -1, 28, 161, 93836 }, // ₾
-    { 19, 32, 18, 0, 28, 152, 93997 }, // ₿
-    { 10, 5, 11, 0, 11, 13, 94149 }, // −
-    { 31, 32, 33, 1, 26, 248, 94162 }, // �
+    { 19, 24, 18, 1, 24, 114, 2048 }, // 7
+    { 19, 26, 18, 0, 25, 124, 2162 }, // 8
+    { 17, 26, 18, 1, 25, 111, 2286 }, // 9
+    { 10, 20, 10, 0, 19, 50, 2397 }, // :
+    { 12, 24, 10, -2, 19, 72, 2447 }, // ;
+    { 17, 18, 19, 1, 21, 77, 2519 }, // <
+    { 17, 11, 19, 1, 17, 47, 2596 }, // =
+    { 17, 18, 19, 1, 21, 77, 2643 }, // >
+    { 15, 26, 15, 2, 25, 98, 2720 }, // ?
+    { 28, 28, 29, 1, 24, 196, 2818 }, // @
+    { 21, 24, 21, -2, 24, 126, 3014 }, // A
+    { 21, 24, 21, 0, 24, 126, 3140 }, // B
+    { 21, 26, 20, 1, 25, 137, 3266 }, // C
+    { 22, 24, 23, 0, 24, 132, 3403 }, // D
+    { 20, 24, 18, 0, 24, 120, 3535 }, // E
+    { 20, 24, 18, 0, 24, 120, 3655 }, // F
+    { 22, 26, 23, 1, 25, 143, 3775 }, // G
+    { 24, 24, 23, 0, 24, 144, 3918 }, // H
+    { 16, 24, 13, -1, 24, 96, 4096 }, // I
+    { 18, 32, 11, -6, 24, 144, 4192 }, // J
+    { 24, 24, 20, 0, 24, 144, 4336 }, // K
+    { 16, 24, 17, 0, 24, 96, 4480 }, // L
+    { 30, 24, 29, 0, 24, 180, 4576 }, // M
+    { 26, 24, 25, 0, 24, 156, 4756 }, // N
+    { 23, 26, 24, 1, 25, 150, 4912 }, // O
+    { 21, 24, 20, 0, 24, 126, 5062 }, // P
+    { 23, 31, 24, 1, 25, 179, 5188 }, // Q
+    { 20, 24, 21, 0, 24, 120, 5367 }, // R
+    { 19, 26, 18, 0, 25, 124, 5487 }, // S
+    { 19, 24, 18, 2, 24, 114, 5611 }, // T
+    { 22, 25, 23, 2, 24, 138, 5725 }, // U
+    { 20, 24, 20, 3, 24, 120, 5863 }, // V
+    { 30, 24, 30, 3, 24, 180, 6144 }, // W
+    { 25, 24, 20, -2, 24, 150, 6324 }, // X
+    { 19, 24, 19, 3, 24, 114, 6474 }, // Y
+    { 21, 24, 18, -1, 24, 126, 6588 }, // Z
+    { 15, 30, 11, -1, 24, 113, 6714 }, // [
+    { 9, 25, 14, 3, 24, 57, 6827 }, // <backslash>
+    { 15, 30, 11, -3, 24, 113, 6884 }, // ]
+    { 18, 16, 18, 0, 24, 72, 6997 }, // ^
+    { 15, 3, 13, -4, -3, 12, 7069 }, // _
+    { 8, 6, 11, 4, 26, 12, 7081 }, // `
+    { 19, 20, 20, 1, 19, 95, 7093 }, // a
+    { 19, 27, 20, 0, 26, 129, 7188 }, // b
+    { 16, 20, 16, 1, 19, 80, 7317 }, // c
+    { 20, 27, 20, 1, 26, 135, 7397 }, // d
+    { 17, 20, 19, 1, 19, 85, 7532 }, // e
+    { 21, 34, 12, -4, 26, 179, 7617 }, // f
+    { 20, 27, 20, 0, 19, 135, 7796 }, // g
+    { 19, 26, 20, 0, 26, 124, 7931 }, // h
+    { 11, 26, 10, 0, 26, 72, 8055 }, // i
+    { 16, 34, 10, -5, 26, 136, 8192 }, // j
+    { 21, 26, 19, 0, 26, 137, 8328 }, // k
+    { 11, 26, 10, 0, 26, 72, 8465 }, // l
+    { 29, 19, 30, 0, 19, 138, 8537 }, // m
+    { 19, 19, 20, 0, 19, 91, 8675 }, // n
+    { 18, 20, 20, 1, 19, 90, 8766 }, // o
+    { 21, 27, 20, -2, 19, 142, 8856 }, // p
+    { 19, 27, 20, 1, 19, 129, 8998 }, // q
+    { 16, 19, 14, 0, 19, 76, 9127 }, // r
+    { 16, 20, 16, 0, 19, 80, 9203 }, // s
+    { 14, 24, 14, 1, 23, 84, 9283 }, // t
+    { 19, 20, 20, 1, 19, 95, 9367 }, // u
+    { 18, 19, 17, 1, 19, 86, 9462 }, // v
+    { 26, 19, 26, 2, 19, 124, 9548 }, // w
+    { 22, 19, 18, -2, 19, 105, 9672 }, // x
+    { 23, 27, 17, -3, 19, 156, 9777 }, // y
+    { 17, 19, 16, -1, 19, 81, 9933 }, // z
+    { 15, 30, 12, -1, 24, 113, 10014 }, // {
+    { 4, 34, 18, 7, 26, 34, 10127 }, // |
+    { 14, 30, 12, -2, 24, 105, 10240 }, // }
+    { 17, 7, 19, 1, 15, 30, 10345 }, // ~
+    { 0, 0, 9, 0, 0, 0, 10375 }, //  
+    { 11, 26, 10, -2, 19, 72, 10375 }, // ¡
+    { 16, 26, 18, 2, 25, 104, 10447 }, // ¢
+    { 22, 25, 18, -1, 25, 138, 10551 }, // £
+    { 17, 16, 18, 1, 20, 68, 10689 }, // ¤
+    { 20, 24, 18, 1, 24, 120, 10757 }, // ¥
+    { 4, 34, 18, 7, 26, 34, 10877 }, // ¦
+    { 17, 27, 16, 0, 26, 115, 10911 }, // §
+    { 12, 6, 18, 6, 26, 18, 11026 }, // ¨
+    { 26, 26, 28, 1, 25, 169, 11044 }, // ©
+    { 13, 13, 13, 2, 25, 43, 11213 }, // ª
+    { 18, 16, 19, 1, 17, 72, 11256 }, // «
+    { 17, 10, 19, 1, 14, 43, 11328 }, // ¬
+    { 10, 5, 11, 0, 11, 13, 11371 }, // ­
+    { 26, 26, 28, 1, 25, 169, 11384 }, // ®
+    { 16, 4, 14, 3, 29, 16, 11553 }, // ¯
+    { 12, 13, 14, 1, 25, 39, 11569 }, // °
+    { 17, 21, 19, 1, 21, 90, 11608 }, // ±
+    { 14, 16, 13, 1, 29, 56, 11698 }, // ²
+    { 13, 16, 13, 2, 29, 52, 11754 }, // ³
+    { 10, 6, 11, 3, 26, 15, 11806 }, // ´
+    { 22, 27, 20, -2, 19, 149, 11821 }, // µ
+    { 18, 31, 22, 2, 26, 140, 11970 }, // ¶
+    { 7, 7, 10, 2, 15, 13, 12110 }, // ·
+    { 9, 8, 7, -4, 0, 18, 12123 }, // ¸
+    { 10, 16, 13, 3, 29, 40, 12141 }, // ¹
+    { 12, 12, 12, 2, 24, 36, 12181 }, // º
+    { 18, 16, 19, 0, 17, 72, 12288 }, // »
+    { 25, 26, 28, 2, 25, 163, 12360 }, // ¼
+    { 27, 26, 30, 2, 25, 176, 12523 }, // ½
+    { 27, 26, 29, 1, 25, 176, 12699 }, // ¾
+    { 14, 25, 16, -1, 19, 88, 12875 }, // ¿
+    { 21, 32, 21, -2, 32, 168, 12963 }, // À
+    { 23, 32, 21, -2, 32, 184, 13131 }, // Á
+    { 23, 32, 21, -2, 32, 184, 13315 }, // Â
+    { 24, 32, 21, -2, 32, 192, 13499 }, // Ã
+    { 22, 32, 21, -2, 32, 176, 13691 }, // Ä
+    { 21, 34, 21, -2, 34, 179, 13867 }, // Å
+    { 33, 24, 30, -2, 24, 198, 14046 }, // Æ
+    { 21, 33, 20, 1, 25, 174, 14336 }, // Ç
+    { 20, 32, 18, 0, 32, 160, 14510 }, // È
+    { 20, 32, 18, 0, 32, 160, 14670 }, // É
+    { 20, 32, 18, 0, 32, 160, 14830 }, // Ê
+    { 20, 32, 18, 0, 32, 160, 14990 }, // Ë
+    { 16, 32, 13, -1, 32, 128, 15150 }, // Ì
+    { 18, 32, 13, -1, 32, 144, 15278 }, // Í
+    { 18, 32, 13, -1, 32, 144, 15422 }, // Î
+    { 17, 32, 13, -1, 32, 136, 15566 }, // Ï
+    { 22, 24, 23, 0, 24, 132, 15702 }, // Ð
+    { 26, 32, 25, 0, 32, 208, 15834 }, // Ñ
+    { 23, 33, 24, 1, 32, 190, 16042 }, // Ò
+    { 23, 33, 24, 1, 32, 190, 16384 }, // Ó
+    { 23, 33, 24, 1, 32, 190, 16574 }, // Ô
+    { 23, 33, 24, 1, 32, 190, 16764 }, // Õ
+    { 23, 33, 24, 1, 32, 190, 16954 }, // Ö
+    { 16, 16, 19, 2, 20, 64, 17144 }, // ×
+    { 23, 28, 24, 1, 26, 161, 17208 }, // Ø
+    { 22, 33, 23, 2, 32, 182, 17369 }, // Ù
+    { 22, 33, 23, 2, 32, 182, 17551 }, // Ú
+    { 22, 33, 23, 2, 32, 182, 17733 }, // Û
+    { 22, 33, 23, 2, 32, 182, 17915 }, // Ü
+    { 19, 32, 19, 3, 32, 152, 18097 }, // Ý
+    { 20, 24, 20, 0, 24, 120, 18249 }, // Þ
+    { 27, 34, 22, -5, 26, 230, 18432 }, // ß
+    { 19, 27, 20, 1, 26, 129, 18662 }, // à
+    { 19, 27, 20, 1, 26, 129, 18791 }, // á
+    { 19, 27, 20, 1, 26, 129, 18920 }, // â
+    { 19, 27, 20, 1, 26, 129, 19049 }, // ã
+    { 19, 27, 20, 1, 26, 129, 19178 }, // ä
+    { 19, 29, 20, 1, 28, 138, 19307 }, // å
+    { 28, 20, 29, 1, 19, 140, 19445 }, // æ
+    { 16, 27, 16, 1, 19, 108, 19585 }, // ç
+    { 17, 27, 19, 1, 26, 115, 19693 }, // è
+    { 18, 27, 19, 1, 26, 122, 19808 }, // é
+    { 18, 27, 19, 1, 26, 122, 19930 }, // ê
+    { 17, 27, 19, 1, 26, 115, 20052 }, // ë
+    { 10, 26, 10, 0, 26, 65, 20167 }, // ì
+    { 14, 26, 10, 0, 26, 91, 20232 }, // í
+    { 14, 26, 10, 0, 26, 91, 20323 }, // î
+    { 13, 26, 10, 0, 26, 85, 20480 }, // ï
+    { 18, 27, 19, 1, 26, 122, 20565 }, // ð
+    { 20, 26, 20, 0, 26, 130, 20687 }, // ñ
+    { 18, 27, 20, 1, 26, 122, 20817 }, // ò
+    { 18, 27, 20, 1, 26, 122, 20939 }, // ó
+    { 18, 27, 20, 1, 26, 122, 21061 }, // ô
+    { 19, 27, 20, 1, 26, 129, 21183 }, // õ
+    { 18, 27, 20, 1, 26, 122, 21312 }, // ö
+    { 17, 17, 19, 1, 20, 73, 21434 }, // ÷
+    { 19, 22, 20, 0, 20, 105, 21507 }, // ø
+    { 19, 27, 20, 1, 26, 129, 21612 }, // ù
+    { 19, 27, 20, 1, 26, 129, 21741 }, // ú
+    { 19, 27, 20, 1, 26, 129, 21870 }, // û
+    { 19, 27, 20, 1, 26, 129, 21999 }, // ü
+    { 23, 34, 17, -3, 26, 196, 22128 }, // ý
+    { 21, 34, 20, -2, 26, 179, 22324 }, // þ
+    { 23, 34, 17, -3, 26, 196, 22528 }, // ÿ
+    { 22, 30, 21, -2, 30, 165, 22724 }, // Ā
+    { 19, 25, 20, 1, 24, 119, 22889 }, // ā
+    { 23, 32, 21, -2, 32, 184, 23008 }, // Ă
+    { 19, 27, 20, 1, 26, 129, 23192 }, // ă
+    { 21, 33, 21, -2, 24, 174, 23321 }, // Ą
+    { 19, 28, 20, 1, 19, 133, 23495 }, // ą
+    { 21, 33, 20, 1, 32, 174, 23628 }, // Ć
+    { 17, 27, 16, 1, 26, 115, 23802 }, // ć
+    { 21, 33, 20, 1, 32, 174, 23917 }, // Ĉ
+    { 17, 27, 16, 1, 26, 115, 24091 }, // ĉ
+    { 21, 33, 20, 1, 32, 174, 24206 }, // Ċ
+    { 16, 27, 16, 1, 26, 108, 24380 }, // ċ
+    { 22, 33, 20, 1, 32, 182, 24576 }, // Č
+    { 18, 27, 16, 1, 26, 122, 24758 }, // č
+    { 23, 32, 23, 0, 32, 184, 24880 }, // Ď
+    { 27, 27, 23, 1, 26, 183, 25064 }, // ď
+    { 22, 24, 23, 0, 24, 132, 25247 }, // Đ
+    { 22, 27, 20, 1, 26, 149, 25379 }, // đ
+    { 20, 30, 18, 0, 30, 150, 25528 }, // Ē
+    { 17, 25, 19, 1, 24, 107, 25678 }, // ē
+    { 20, 32, 18, 0, 32, 160, 25785 }, // Ĕ
+    { 18, 27, 19, 1, 26, 122, 25945 }, // ĕ
+    { 20, 32, 18, 0, 32, 160, 26067 }, // Ė
+    { 17, 27, 19, 1, 26, 115, 26227 }, // ė
+    { 20, 33, 18, 0, 24, 165, 26342 }, // Ę
+    { 17, 27, 19, 1, 19, 115, 26507 }, // ę
+    { 21, 32, 18, 0, 32, 168, 26624 }, // Ě
+    { 19, 27, 19, 1, 26, 129, 26792 }, // ě
+    { 22, 33, 23, 1, 32, 182, 26921 }, // Ĝ
+    { 20, 34, 20, 0, 26, 170, 27103 }, // ĝ
+    { 22, 33, 23, 1, 32, 182, 27273 }, // Ğ
+    { 20, 34, 20, 0, 26, 170, 27455 }, // ğ
+    { 22, 33, 23, 1, 32, 182, 27625 }, // Ġ
+    { 20, 34, 20, 0, 26, 170, 27807 }, // ġ
+    { 22, 33, 23, 1, 25, 182, 27977 }, // Ģ
+    { 20, 34, 20, 0, 26, 170, 28159 }, // ģ
+    { 24, 32, 23, 0, 32, 192, 28329 }, // Ĥ
+    { 19, 33, 20, 0, 33, 157, 28672 }, // ĥ
+    { 26, 24, 23, 0, 24, 156, 28829 }, // Ħ
+    { 19, 26, 20, 0, 26, 124, 28985 }, // ħ
+    { 18, 32, 13, -1, 32, 144, 29109 }, // Ĩ
+    { 15, 26, 10, 0, 26, 98, 29253 }, // ĩ
+    { 17, 30, 13, -1, 30, 128, 29351 }, // Ī
+    { 13, 24, 10, 0, 24, 78, 29479 }, // ī
+    { 18, 32, 13, -1, 32, 144, 29557 }, // Ĭ
+    { 14, 26, 10, 0, 26, 91, 29701 }, // ĭ
+    { 16, 33, 13, -1, 24, 132, 29792 }, // Į
+    { 13, 35, 10, -2, 26, 114, 29924 }, // į
+    { 16, 32, 13, -1, 32, 128, 30038 }, // İ
+    { 10, 19, 10, 0, 19, 48, 30166 }, // ı
+    { 26, 32, 24, -1, 24, 208, 30214 }, // Ĳ
+    { 21, 34, 20, 0, 26, 179, 30422 }, // ĳ
+    { 22, 40, 11, -6, 32, 220, 30720 }, // Ĵ
+    { 19, 34, 10, -5, 26, 162, 30940 }, // ĵ
+    { 24, 32, 20, 0, 24, 192, 31102 }, // Ķ
+    { 21, 34, 19, 0, 26, 179, 31294 }, // ķ
+    { 21, 19, 19, 0, 19, 100, 31473 }, // ĸ
+    { 17, 32, 17, 0, 32, 136, 31573 }, // Ĺ
+    { 16, 33, 10, 0, 33, 132, 31709 }, // ĺ
+    { 16, 32, 17, 0, 24, 128, 31841 }, // Ļ
+    { 13, 34, 10, -2, 26, 111, 31969 }, // ļ
+    { 20, 24, 17, 0, 24, 120, 32080 }, // Ľ
+    { 18, 26, 13, 0, 26, 117, 32200 }, // ľ
+    { 17, 24, 17, 0, 24, 102, 32317 }, // Ŀ
+    { 16, 26, 15, 0, 26, 104, 32419 }, // ŀ
+    { 17, 24, 17, -1, 24, 102, 32523 }, // Ł
+    { 12, 26, 11, 0, 26, 78, 32625 }, // ł
+    { 26, 32, 25, 0, 32, 208, 32768 }, // Ń
+    { 19, 26, 20, 0, 26, 124, 32976 }, // ń
+    { 26, 32, 25, 0, 24, 208, 33100 }, // Ņ
+    { 19, 27, 20, 0, 19, 129, 33308 }, // ņ
+    { 26, 32, 25, 0, 32, 208, 33437 }, // Ň
+    { 21, 26, 20, 0, 26, 137, 33645 }, // ň
+    { 22, 24, 24, 0, 24, 132, 33782 }, // ŉ
+    { 26, 31, 25, 0, 24, 202, 33914 }, // Ŋ
+    { 19, 27, 20, 0, 19, 129, 34116 }, // ŋ
+    { 23, 31, 24, 1, 30, 179, 34245 }, // Ō
+    { 18, 25, 20, 1, 24, 113, 34424 }, // ō
+    { 23, 33, 24, 1, 32, 190, 34537 }, // Ŏ
+    { 18, 27, 20, 1, 26, 122, 34816 }, // ŏ
+    { 25, 33, 24, 1, 32, 207, 34938 }, // Ő
+    { 22, 27, 20, 1, 26, 149, 35145 }, // ő
+    { 30, 26, 30, 2, 25, 195, 35294 }, // Œ
+    { 28, 20, 29, 1, 19, 140, 35489 }, // œ
+    { 21, 32, 21, 0, 32, 168, 35629 }, // Ŕ
+    { 17, 26, 14, 0, 26, 111, 35797 }, // ŕ
+    { 20, 32, 21, 0, 24, 160, 35908 }, // Ŗ
+    { 18, 27, 14, -2, 19, 122, 36068 }, // ŗ
+    { 22, 32, 21, 0, 32, 176, 36190 }, // Ř
+    { 18, 26, 14, 0, 26, 117, 36366 }, // ř
+    { 19, 33, 18, 0, 32, 157, 36483 }, // Ś
+    { 17, 27, 16, 0, 26, 115, 36640 }, // ś
+    { 19, 33, 18, 0, 32, 157, 36864 }, // Ŝ
+    { 17, 27, 16, 0, 26, 115, 37021 }, // ŝ
+    { 19, 33, 18, 0, 25, 157, 37136 }, // Ş
+    { 16, 27, 16, 0, 19, 108, 37293 }, // ş
+    { 20, 33, 18, 0, 32, 165, 37401 }, // Š
+    { 18, 27, 16, 0, 26, 122, 37566 }, // š
+    { 19, 32, 18, 2, 24, 152, 37688 }, // Ţ
+    { 14, 31, 14, 1, 23, 109, 37840 }, // ţ
+    { 19, 32, 18, 2, 32, 152, 37949 }, // Ť
+    { 18, 27, 14, 1, 26, 122, 38101 }, // ť
+    { 19, 24, 18, 2, 24, 114, 38223 }, // Ŧ
+    { 15, 24, 14, 0, 23, 90, 38337 }, // ŧ
+    { 22, 33, 23, 2, 32, 182, 38427 }, // Ũ
+    { 19, 27, 20, 1, 26, 129, 38609 }, // ũ
+    { 22, 31, 23, 2, 30, 171, 38738 }, // Ū
+    { 19, 25, 20, 1, 24, 119, 38912 }, // ū
+    { 22, 33, 23, 2, 32, 182, 39031 }, // Ŭ
+    { 19, 27, 20, 1, 26, 129, 39213 }, // ŭ
+    { 22, 35, 23, 2, 34, 193, 39342 }, // Ů
+    { 19, 29, 20, 1, 28, 138, 39535 }, // ů
+    { 24, 33, 23, 2, 32, 198, 39673 }, // Ű
+    { 22, 27, 20, 1, 26, 149, 39871 }, // ű
+    { 22, 33, 23, 2, 24, 182, 40020 }, // Ų
+    { 19, 28, 20, 1, 19, 133, 40202 }, // ų
+    { 30, 32, 30, 3, 32, 240, 40335 }, // Ŵ
+    { 26, 26, 26, 2, 26, 169, 40575 }, // ŵ
+    { 19, 32, 19, 3, 32, 152, 40744 }, // Ŷ
+    { 23, 34, 17, -3, 26, 196, 40960 }, // ŷ
+    { 19, 32, 19, 3, 32, 152, 41156 }, // Ÿ
+    { 21, 32, 18, -1, 32, 168, 41308 }, // Ź
+    { 18, 26, 16, -1, 26, 117, 41476 }, // ź
+    { 21, 32, 18, -1, 32, 168, 41593 }, // Ż
+    { 17, 26, 16, -1, 26, 111, 41761 }, // ż
+    { 22, 32, 18, -1, 32, 176, 41872 }, // Ž
+    { 19, 26, 16, -1, 26, 124, 42048 }, // ž
+    { 20, 34, 12, -4, 26, 170, 42172 }, // ſ
+    { 8, 6, 0, -14, 26, 12, 42342 }, // ̀
+    { 10, 6, 0, -8, 26, 15, 42354 }, // ́
+    { 14, 6, 0, -5, 26, 21, 42369 }, // ̂
+    { 15, 6, 0, -15, 26, 23, 42390 }, // ̃
+    { 11, 4, 0, -3, 24, 11, 42413 }, // ̄
+    { 15, 5, 0, -4, 29, 19, 42424 }, // ̅
+    { 13, 6, 0, -3, 26, 20, 42443 }, // ̆
+    { 6, 6, 0, 0, 26, 9, 42463 }, // ̇
+    { 12, 6, 0, -3, 26, 18, 42472 }, // ̈
+    { 8, 9, 0, -10, 28, 18, 42490 }, // ̉
+    { 9, 8, 0, -1, 28, 18, 42508 }, // ̊
+    { 16, 6, 0, -4, 26, 24, 42526 }, // ̋
+    { 15, 6, 0, -4, 26, 23, 42550 }, // ̌
+    { 6, 10, 0, 0, 26, 15, 42573 }, // ̍
+    { 12, 7, 0, -3, 26, 21, 42588 }, // ̎
+    { 14, 6, 0, -16, 26, 21, 42609 }, // ̏
+    { 12, 9, 0, -3, 29, 27, 42630 }, // ̐
+    { 13, 6, 0, -4, 26, 20, 42657 }, // ̑
+    { 9, 9, 0, -2, 24, 21, 42677 }, // ̒
+    { 9, 9, 0, -2, 24, 21, 42698 }, // ̓
+    { 5, 9, 0, 0, 24, 12, 42719 }, // ̔
+    { 9, 9, 0, -2, 24, 21, 42731 }, // ̕
+    { 8, 6, 0, -7, -1, 12, 42752 }, // ̖
+    { 10, 6, 0, -8, -1, 15, 42764 }, // ̗
+    { 7, 8, 0, -6, 0, 14, 42779 }, // ̘
+    { 8, 8, 0, -7, 0, 16, 42793 }, // ̙
+    { 11, 10, 10, 2, 26, 28, 42809 }, // ̚
+    { 10, 9, 0, -2, 26, 23, 42837 }, // ̛
+    { 6, 9, 0, -2, 0, 14, 42860 }, // ̜
+    { 8, 6, 0, -7, -1, 12, 42874 }, // ̝
+    { 9, 6, 0, -7, -1, 14, 42886 }, // ̞
+    { 8, 8, 0, -7, 0, 16, 42900 }, // ̟
+    { 8, 3, 0, -7, -2, 6, 42916 }, // ̠
+    { 9, 10, 0, -7, 2, 23, 42922 }, // ̡
+    { 8, 10, 0, -4, 2, 20, 42945 }, // ̢
+    { 7, 6, 0, -16, -2, 11, 42965 }, // ̣
+    { 12, 6, 0, -9, -1, 18, 42976 }, // ̤
+    { 9, 8, 0, -7, 0, 18, 43008 }, // ̥
+    { 7, 6, 0, 2, -2, 11, 43026 }, // ̦
+    { 9, 8, 0, -7, 0, 18, 43037 }, // ̧
+    { 7, 9, 0, -6, 0, 16, 43055 }, // ̨
+    { 7, 10, 0, -6, -1, 18, 43071 }, // ̩
+    { 14, 7, 0, -10, -1, 25, 43089 }, // ̪
+    { 13, 4, 0, -9, -2, 13, 43114 }, // ̫
+    { 14, 6, 0, -9, -1, 21, 43127 }, // ̬
+    { 14, 6, 0, -10, -1, 21, 43148 }, // ̭
+    { 13, 6, 0, -9, -1, 20, 43169 }, // ̮
+    { 13, 6, 0, -9, -1, 20, 43189 }, // ̯
+    { 15, 6, 0, -10, -1, 23, 43209 }, // ̰
+    { 12, 4, 0, -9, -2, 12, 43232 }, // ̱
+    { 17, 3, 0, -11, -3, 13, 43244 }, // ̲
+    { 16, 8, 0, -11, 0, 32, 43257 }, // ̳
+    { 14, 6, 0, -7, 13, 21, 43289 }, // ̴
+    { 15, 5, 0, -8, 11, 19, 43310 }, // ̵
+    { 26, 5, 0, -13, 12, 33, 43329 }, // ̶
+    { 12, 9, 0, -6, 14, 27, 43362 }, // ̷
+    { 20, 28, 0, -10, 26, 140, 43389 }, // ̸
+    { 6, 9, 0, -3, 0, 14, 43529 }, // ̹
+    { 14, 7, 0, -10, -1, 25, 43543 }, // ̺
+    { 14, 8, 0, -10, 0, 28, 43568 }, // ̻
+    { 13, 4, 0, -9, -2, 13, 43596 }, // ̼
+    { 8, 7, 0, -1, 26, 14, 43609 }, // ̽
+    { 8, 10, 0, -1, 29, 20, 43623 }, // ̾
+    { 15, 8, 0, -4, 33, 30, 43643 }, // ̿
+    { 8, 6, 0, -3, 26, 12, 43673 }, // ̀
+    { 10, 6, 0, 0, 26, 15, 43685 }, // ́
+    { 14, 6, 0, 5, 26, 21, 43700 }, // ͂
+    { 6, 7, 0, 0, 26, 11, 43721 }, // ̓
+    { 18, 6, 0, -5, 26, 27, 43732 }, // ̈́
+    { 7, 6, 0, -5, -2, 11, 43759 }, // ͅ
+    { 16, 7, 0, -5, 26, 28, 43770 }, // ͆
+    { 16, 8, 0, -11, 0, 32, 43798 }, // ͇
+    { 11, 7, 0, -8, -1, 20, 43830 }, // ͈
+    { 7, 6, 0, -6, -2, 11, 43850 }, // ͉
+    { 13, 8, 0, -4, 26, 26, 43861 }, // ͊
+    { 13, 14, 0, -3, 32, 46, 43887 }, // ͋
+    { 14, 9, 0, -4, 29, 32, 43933 }, // ͌
+    { 13, 7, 0, -9, -1, 23, 43965 }, // ͍
+    { 7, 8, 0, -6, 0, 14, 43988 }, // ͎
+    { 24, 24, 0, -12, 24, 144, 44002 }, // ͏
+    { 6, 8, 0, 0, 27, 12, 44146 }, // ͐
+    { 6, 9, 0, 4, 29, 14, 44158 }, // ͑
+    { 12, 9, 0, -3, 29, 27, 44172 }, // ͒
+    { 8, 7, 0, -6, -1, 14, 44199 }, // ͓
+    { 6, 7, 0, -5, -1, 11, 44213 }, // ͔
+    { 7, 7, 0, -5, -1, 13, 44224 }, // ͕
+    { 13, 7, 0, -8, -1, 23, 44237 }, // ͖
+    { 6, 9, 0, 3, 28, 14, 44260 }, // ͗
+    { 6, 6, 0, 0, 26, 9, 44274 }, // ͘
+    { 9, 7, 0, -7, -1, 16, 44283 }, // ͙
+    { 13, 8, 0, -9, 0, 26, 44299 }, // ͚
+    { 7, 8, 0, 0, 27, 14, 44325 }, // ͛
+    { 26, 7, 0, -15, -1, 46, 44339 }, // ͜
+    { 26, 7, 0, -10, 26, 46, 44385 }, // ͝
+    { 18, 4, 0, -6, 24, 18, 44431 }, // ͞
+    { 19, 4, 0, -12, -1, 19, 44449 }, // ͟
+    { 27, 6, 0, -10, 26, 41, 44468 }, // ͠
+    { 27, 7, 0, -10, 29, 48, 44509 }, // ͡
+    { 27, 8, 0, -17, 0, 54, 44557 }, // ͢
+    { 9, 9, 0, -1, 29, 21, 44611 }, // ͣ
+    { 9, 9, 0, -1, 29, 21, 44632 }, // ͤ
+    { 5, 11, 0, 1, 31, 14, 44653 }, // ͥ
+    { 8, 9, 0, -1, 29, 18, 44667 }, // ͦ
+    { 9, 8, 0, -1, 28, 18, 44685 }, // ͧ
+    { 7, 9, 0, 0, 29, 16, 44703 }, // ͨ
+    { 10, 11, 0, -1, 31, 28, 44719 }, // ͩ
+    { 9, 11, 0, -2, 31, 25, 44747 }, // ͪ
+    { 14, 9, 0, -4, 29, 32, 44772 }, // ͫ
+    { 7, 9, 0, 0, 29, 16, 44804 }, // ͬ
+    { 7, 10, 0, 0, 30, 18, 44820 }, // ͭ
+    { 8, 8, 0, 0, 28, 16, 44838 }, // ͮ
+    { 10, 8, 0, -2, 28, 20, 44854 }, // ͯ
+    { 20, 32, 18, 0, 32, 160, 44874 }, // Ѐ
+    { 20, 32, 18, 0, 32, 160, 45056 }, // Ё
+    { 21, 25, 24, 2, 24, 132, 45216 }, // Ђ
+    { 20, 32, 17, 0, 32, 160, 45348 }, // Ѓ
+    { 21, 26, 20, 1, 25, 137, 45508 }, // Є
+    { 19, 26, 18, 0, 25, 124, 45645 }, // Ѕ
+    { 11, 24, 10, 0, 24, 66, 45769 }, // І
+    { 15, 32, 10, 0, 32, 120, 45835 }, // Ї
+    { 18, 32, 11, -6, 24, 144, 45955 }, // Ј
+    { 34, 25, 32, -2, 24, 213, 46099 }, // Љ
+    { 31, 24, 31, 0, 24, 186, 46312 }, // Њ
+    { 21, 24, 24, 2, 24, 126, 46498 }, // Ћ
+    { 24, 32, 21, 0, 32, 192, 46624 }, // Ќ
+    { 24, 32, 23, 0, 32, 192, 46816 }, // Ѝ
+    { 23, 33, 20, 0, 32, 190, 47104 }, // Ў
+    { 23, 30, 22, 0, 24, 173, 47294 }, // Џ
+    { 21, 24, 21, -2, 24, 126, 47467 }, // А
+    { 20, 24, 20, 0, 24, 120, 47593 }, // Б
+    { 21, 24, 21, 0, 24, 126, 47713 }, // В
+    { 20, 24, 17, 0, 24, 120, 47839 }, // Г
+    { 27, 30, 24, -3, 24, 203, 47959 }, // Д
+    { 20, 24, 18, 0, 24, 120, 48162 }, // Е
+    { 35, 24, 30, -2, 24, 210, 48282 }, // Ж
+    { 20, 26, 19, 0, 25, 130, 48492 }, // З
+    { 24, 24, 23, 0, 24, 144, 48622 }, // И
+    { 24, 32, 23, 0, 32, 192, 48766 }, // Й
+    { 24, 24, 21, 0, 24, 144, 48958 }, // К
+    { 26, 25, 23, -2, 24, 163, 49152 }, // Л
+    { 30, 24, 29, 0, 24, 180, 49315 }, // М
+    { 24, 24, 23, 0, 24, 144, 49495 }, // Н
+    { 23, 26, 24, 1, 25, 150, 49639 }, // О
+    { 24, 24, 23, 0, 24, 144, 49789 }, // П
+    { 21, 24, 20, 0, 24, 126, 49933 }, // Р
+    { 21, 26, 20, 1, 25, 137, 50059 }, // С
+    { 19, 24, 17, 2, 24, 114, 50196 }, // Т
+    { 23, 25, 20, 0, 24, 144, 50310 }, // У
+    { 28, 26, 29, 1, 25, 182, 50454 }, // Ф
+    { 25, 24, 20, -2, 24, 150, 50636 }, // Х
+    { 23, 30, 23, 0, 24, 173, 50786 }, // Ц
+    { 21, 24, 22, 2, 24, 126, 50959 }, // Ч
+    { 34, 24, 33, 0, 24, 204, 51200 }, // Ш
+    { 33, 29, 33, 0, 24, 240, 51404 }, // Щ
+    { 21, 24, 23, 2, 24, 126, 51644 }, // Ъ
+    { 30, 24, 29, 0, 24, 180, 51770 }, // Ы
+    { 19, 24, 20, 0, 24, 114, 51950 }, // Ь
+    { 21, 26, 20, 0, 25, 137, 52064 }, // Э
+    { 33, 26, 33, 0, 25, 215, 52201 }, // Ю
+    { 24, 24, 21, -2, 24, 144, 52416 }, // Я
+    { 19, 20, 19, 0, 19, 95, 52560 }, // а
+    { 19, 27, 19, 1, 26, 129, 52655 }, // б
+    { 18, 20, 18, 0, 19, 90, 52784 }, // в
+    { 17, 20, 15, -1, 19, 85, 52874 }, // г
+    { 18, 27, 19, 1, 26, 122, 52959 }, // д
+    { 17, 20, 17, 1, 19, 85, 53081 }, // е
+    { 34, 20, 32, -1, 19, 170, 53248 }, // ж
+    { 16, 20, 17, 0, 19, 80, 53418 }, // з
+    { 19, 20, 20, 1, 19, 95, 53498 }, // и
+    { 19, 27, 20, 1, 26, 129, 53593 }, // й
+    { 21, 19, 19, 0, 19, 100, 53722 }, // к
+    { 21, 20, 20, -1, 19, 105, 53822 }, // л
+    { 26, 19, 26, 0, 19, 124, 53927 }, // м
+    { 20, 19, 20, 0, 19, 95, 54051 }, // н
+    { 19, 20, 19, 0, 19, 95, 54146 }, // о
+    { 19, 19, 20, 0, 19, 91, 54241 }, // п
+    { 21, 27, 20, -2, 19, 142, 54332 }, // р
+    { 16, 20, 16, 0, 19, 80, 54474 }, // с
+    { 29, 19, 30, 0, 19, 138, 54554 }, // т
+    { 23, 27, 18, -3, 19, 156, 54692 }, // у
+    { 23, 34, 25, 1, 26, 196, 54848 }, // ф
+    { 22, 19, 17, -2, 19, 105, 55044 }, // х
+    { 19, 24, 20, 1, 19, 114, 55149 }, // ц
+    { 17, 19, 19, 2, 19, 81, 55296 }, // ч
+    { 29, 20, 30, 1, 19, 145, 55377 }, // ш
+    { 29, 24, 30, 1, 19, 174, 55522 }, // щ
+    { 19, 20, 21, 1, 19, 95, 55696 }, // ъ
+    { 26, 20, 27, 1, 19, 130, 55791 }, // ы
+    { 17, 20, 18, 1, 19, 85, 55921 }, // ь
+    { 15, 20, 16, 0, 19, 75, 56006 }, // э
+    { 27, 20, 27, 0, 19, 135, 56081 }, // ю
+    { 20, 19, 18, -2, 19, 95, 56216 }, // я
+    { 17, 27, 17, 1, 26, 115, 56311 }, // ѐ
+    { 17, 26, 17, 1, 25, 111, 56426 }, // ё
+    { 19, 34, 20, 0, 26, 162, 56537 }, // ђ
+    { 18, 27, 15, -1, 26, 122, 56699 }, // ѓ
+    { 16, 20, 16, 0, 19, 80, 56821 }, // є
+    { 15, 20, 15, 0, 19, 75, 56901 }, // ѕ
+    { 11, 26, 10, 0, 26, 72, 56976 }, // і
+    { 13, 26, 10, 0, 26, 85, 57048 }, // ї
+    { 16, 34, 10, -5, 26, 136, 57133 }, // ј
+    { 29, 20, 29, -1, 19, 145, 57344 }, // љ
+    { 27, 20, 28, 0, 19, 135, 57489 }, // њ
+    { 19, 26, 20, 0, 26, 124, 57624 }, // ћ
+    { 21, 26, 19, 0, 26, 137, 57748 }, // ќ
+    { 19, 27, 20, 1, 26, 129, 57885 }, // ѝ
+    { 23, 34, 18, -3, 26, 196, 58014 }, // ў
+    { 19, 26, 20, 1, 19, 124, 58210 }, // џ
+    { 31, 24, 30, 2, 24, 186, 58334 }, // Ѡ
+    { 27, 19, 27, 2, 19, 129, 58520 }, // ѡ
+    { 18, 24, 21, 2, 24, 108, 58649 }, // Ѣ
+    { 27, 20, 28, 0, 19, 135, 58757 }, // ѣ
+    { 31, 26, 30, 0, 25, 202, 58892 }, // Ѥ
+    { 26, 20, 25, 0, 19, 130, 59094 }, // ѥ
+    { 23, 24, 22, -2, 24, 138, 59224 }, // Ѧ
+    { 21, 19, 19, -3, 19, 100, 59392 }, // ѧ
+    { 29, 24, 31, 0, 24, 174, 59492 }, // Ѩ
+    { 27, 19, 28, 0, 19, 129, 59666 }, // ѩ
+    { 27, 24, 24, -2, 24, 162, 59795 }, // Ѫ
+    { 22, 19, 19, -2, 19, 105, 59957 }, // ѫ
+    { 34, 24, 33, 0, 24, 204, 60062 }, // Ѭ
+    { 29, 19, 28, 0, 19, 138, 60266 }, // ѭ
+    { 22, 37, 20, -2, 29, 204, 60404 }, // Ѯ
+    { 20, 31, 17, -2, 23, 155, 60608 }, // ѯ
+    { 27, 24, 28, 3, 24, 162, 60763 }, // Ѱ
+    { 25, 34, 27, 1, 26, 213, 60925 }, // ѱ
+    { 23, 26, 24, 1, 25, 150, 61138 }, // Ѳ
+    { 18, 20, 20, 1, 19, 90, 61288 }, // ѳ
+    { 21, 24, 22, 3, 24, 126, 61440 }, // Ѵ
+    { 19, 19, 18, 1, 19, 91, 61566 }, // ѵ
+    { 21, 32, 22, 3, 32, 168, 61657 }, // Ѷ
+    { 19, 26, 18, 1, 26, 124, 61825 }, // ѷ
+    { 43, 33, 42, 1, 25, 355, 61949 }, // Ѹ
+    { 38, 27, 37, 1, 19, 257, 62304 }, // ѹ
+    { 23, 29, 25, 2, 26, 167, 62561 }, // Ѻ
+    { 19, 22, 21, 1, 20, 105, 62728 }, // ѻ
+    { 31, 36, 34, 2, 35, 279, 62833 }, // Ѽ
+    { 27, 31, 29, 1, 30, 210, 63112 }, // ѽ
+    { 31, 31, 30, 2, 31, 241, 63488 }, // Ѿ
+    { 27, 25, 27, 2, 25, 169, 63729 }, // ѿ
+    { 21, 33, 20, 1, 25, 174, 63898 }, // Ҁ
+    { 16, 27, 16, 1, 19, 108, 64072 }, // ҁ
+    { 18, 22, 20, 1, 21, 99, 64180 }, // ҂
+    { 13, 7, 0, -13, 25, 23, 64279 }, // ҃
+    { 14, 6, 0, -14, 26, 21, 64302 }, // ҄
+    { 6, 8, 0, -9, 27, 12, 64323 }, // ҅
+    { 7, 8, 0, -10, 27, 14, 64335 }, // ҆
+    { 14, 6, 0, -3, 31, 21, 64349 }, // ҇
+    { 38, 36, 0, -19, 27, 342, 64370 }, // ҈
+    { 38, 38, 0, -19, 28, 361, 64712 }, // ҉
+    { 27, 39, 27, 0, 32, 264, 65073 }, // Ҋ
+    { 20, 34, 21, 1, 27, 170, 65337 }, // ҋ
+    { 18, 24, 20, 0, 24, 108, 65536 }, // Ҍ
+    { 17, 27, 19, 1, 26, 115, 65644 }, // ҍ
+    { 21, 24, 20, 0, 24, 126, 65759 }, // Ҏ
+    { 21, 27, 20, -2, 19, 142, 65885 }, // ҏ
+    { 21, 29, 17, 0, 29, 153, 66027 }, // Ґ
+    { 18, 24, 15, 0, 24, 108, 66180 }, // ґ
+    { 20, 24, 17, 0, 24, 120, 66288 }, // Ғ
+    { 18, 19, 15, -1, 19, 86, 66408 }, // ғ
+    { 20, 33, 22, 0, 24, 165, 66494 }, // Ҕ
+    { 17, 28, 19, 0, 19, 119, 66659 }, // ҕ
+    { 35, 31, 31, -3, 24, 272, 66778 }, // Җ
+    { 34, 26, 32, -1, 19, 221, 67050 }, // җ
+    { 20, 34, 19, 0, 25, 170, 67271 }, // Ҙ
+    { 16, 28, 17, 0, 19, 112, 67441 }, // ҙ
+    { 23, 31, 23, 0, 24, 179, 67584 }, // Қ
+    { 21, 26, 20, 0, 19, 137, 67763 }, // қ
+    { 24, 24, 21, 0, 24, 144, 67900 }, // Ҝ
+    { 21, 19, 20, 1, 19, 100, 68044 }, // ҝ
+    { 24, 24, 20, 0, 24, 144, 68144 }, // Ҟ
+    { 21, 26, 19, 0, 26, 137, 68288 }, // ҟ
+    { 25, 24, 23, 2, 24, 150, 68425 }, // Ҡ
+    { 23, 19, 22, 1, 19, 110, 68575 }, // ҡ
+    { 24, 31, 26, 0, 24, 186, 68685 }, // Ң
+    { 21, 26, 22, 0, 19, 137, 68871 }, // ң
+    { 29, 24, 26, 0, 24, 174, 69008 }, // Ҥ
+    { 26, 19, 24, 0, 19, 124, 69182 }, // ҥ
+    { 32, 33, 34, 0, 24, 264, 69306 }, // Ҧ
+    { 27, 28, 29, 0, 19, 189, 69632 }, // ҧ
+    { 21, 27, 24, 2, 25, 142, 69821 }, // Ҩ
+    { 18, 21, 20, 1, 19, 95, 69963 }, // ҩ
+    { 21, 34, 20, 1, 25, 179, 70058 }, // Ҫ
+    { 16, 28, 16, 1, 19, 112, 70237 }, // ҫ
+    { 19, 31, 18, 2, 24, 148, 70349 }, // Ҭ
+    { 30, 26, 31, 0, 19, 195, 70497 }, // ҭ
+    { 19, 24, 19, 3, 24, 114, 70692 }, // Ү
+    { 18, 27, 17, 1, 19, 122, 70806 }, // ү
+    { 21, 24, 19, 1, 24, 126, 70928 }, // Ұ
+    { 20, 27, 17, -1, 19, 135, 71054 }, // ұ
+    { 25, 31, 23, -2, 24, 194, 71189 }, // Ҳ
+    { 22, 26, 20, -2, 19, 143, 71383 }, // ҳ
+    { 25, 31, 28, 2, 24, 194, 71680 }, // Ҵ
+    { 21, 26, 23, 1, 19, 137, 71874 }, // ҵ
+    { 21, 31, 25, 3, 24, 163, 72011 }, // Ҷ
+    { 18, 26, 21, 2, 19, 117, 72174 }, // ҷ
+    { 20, 24, 23, 3, 24, 120, 72291 }, // Ҹ
+    { 18, 19, 20, 2, 19, 86, 72411 }, // ҹ
+    { 21, 24, 23, 0, 24, 126, 72497 }, // Һ
+    { 19, 26, 20, 0, 26, 124, 72623 }, // һ
+    { 25, 26, 26, 1, 25, 163, 72747 }, // Ҽ
+    { 22, 20, 22, 0, 19, 110, 72910 }, // ҽ
+    { 25, 32, 26, 1, 25, 200, 73020 }, // Ҿ
+    { 22, 26, 22, 0, 19, 143, 73220 }, // ҿ
+    { 16, 24, 13, -1, 24, 96, 73363 }, // Ӏ
+    { 35, 32, 30, -2, 32, 280, 73728 }, // Ӂ
+    { 34, 27, 32, -1, 26, 230, 74008 }, // ӂ
+    { 23, 33, 23, 0, 24, 190, 74238 }, // Ӄ
+    { 21, 28, 21, 0, 19, 147, 74428 }, // ӄ
+    { 26, 31, 25, -1, 24, 202, 74575 }, // Ӆ
+    { 22, 26, 22, -1, 19, 143, 74777 }, // ӆ
+    { 24, 33, 23, 0, 24, 198, 74920 }, // Ӈ
+    { 20, 28, 21, 0, 19, 140, 75118 }, // ӈ
+    { 25, 31, 26, 0, 24, 194, 75258 }, // Ӊ
+    { 22, 26, 23, 0, 19, 143, 75452 }, // ӊ
+    { 20, 31, 22, 3, 24, 155, 75595 }, // Ӌ
+    { 18, 26, 20, 2, 19, 117, 75776 }, // ӌ
+    { 31, 31, 32, 0, 24, 241, 75893 }, // Ӎ
+    { 27, 26, 28, 0, 19, 176, 76134 }, // ӎ
+    { 16, 24, 13, -1, 24, 96, 76310 }, // ӏ
+    { 24, 32, 21, -2, 32, 192, 76406 }, // Ӑ
+    { 19, 27, 20, 1, 26, 129, 76598 }, // ӑ
+    { 22, 32, 21, -2, 32, 176, 76727 }, // Ӓ
+    { 19, 27, 20, 1, 26, 129, 76903 }, // ӓ
+    { 33, 24, 30, -2, 24, 198, 77032 }, // Ӕ
+    { 28, 20, 29, 1, 19, 140, 77230 }, // ӕ
+    { 21, 32, 18, 0, 32, 168, 77370 }, // Ӗ
+    { 19, 27, 19, 1, 26, 129, 77538 }, // ӗ
+    { 20, 26, 22, 1, 25, 130, 77667 }, // Ә
+    { 18, 20, 19, 0, 19, 90, 77824 }, // ә
+    { 20, 33, 22, 1, 32, 165, 77914 }, // Ӛ
+    { 18, 27, 19, 0, 26, 122, 78079 }, // ӛ
+    { 35, 32, 30, -2, 32, 280, 78201 }, // Ӝ
+    { 34, 27, 32, -1, 26, 230, 78481 }, // ӝ
+    { 20, 33, 19, 0, 32, 165, 78711 }, // Ӟ
+    { 17, 27, 17, 0, 26, 115, 78876 }, // ӟ
+    { 20, 25, 19, -1, 24, 125, 78991 }, // Ӡ
+    { 20, 28, 18, -2, 19, 140, 79116 }, // ӡ
+    { 24, 30, 23, 0, 30, 180, 79256 }, // Ӣ
+    { 19, 25, 20, 1, 24, 119, 79436 }, // ӣ
+    { 24, 32, 23, 0, 32, 192, 79555 }, // Ӥ
+    { 19, 27, 20, 1, 26, 129, 79872 }, // ӥ
+    { 23, 33, 24, 1, 32, 190, 80001 }, // Ӧ
+    { 18, 27, 20, 1, 26, 122, 80191 }, // ӧ
+    { 23, 26, 24, 1, 25, 150, 80313 }, // Ө
+    { 18, 20, 20, 1, 19, 90, 80463 }, // ө
+    { 23, 33, 24, 1, 32, 190, 80553 }, // Ӫ
+    { 18, 27, 20, 1, 26, 122, 80743 }, // ӫ
+    { 21, 33, 20, 0, 32, 174, 80865 }, // Ӭ
+    { 16, 27, 16, 0, 26, 108, 81039 }, // ӭ
+    { 23, 31, 20, 0, 30, 179, 81147 }, // Ӯ
+    { 23, 32, 17, -3, 24, 184, 81326 }, // ӯ
+    { 23, 33, 20, 0, 32, 190, 81510 }, // Ӱ
+    { 23, 34, 17, -3, 26, 196, 81700 }, // ӱ
+    { 24, 33, 20, 0, 32, 198, 81920 }, // Ӳ
+    { 24, 34, 17, -3, 26, 204, 82118 }, // ӳ
+    { 21, 32, 22, 2, 32, 168, 82322 }, // Ӵ
+    { 17, 26, 19, 2, 26, 111, 82490 }, // ӵ
+    { 20, 31, 17, 0, 24, 155, 82601 }, // Ӷ
+    { 17, 26, 15, 0, 19, 111, 82756 }, // ӷ
+    { 30, 32, 29, 0, 32, 240, 82867 }, // Ӹ
+    { 26, 27, 27, 1, 26, 176, 83107 }, // ӹ
+    { 20, 33, 17, 0, 24, 165, 83283 }, // Ӻ
+    { 18, 28, 15, -1, 19, 126, 83448 }, // ӻ
+    { 25, 33, 23, -2, 24, 207, 83574 }, // Ӽ
+    { 22, 28, 20, -2, 19, 154, 83781 }, // ӽ
+    { 25, 24, 20, -2, 24, 150, 83968 }, // Ӿ
+    { 22, 19, 18, -2, 19, 105, 84118 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 84223 }, //  
+    { 0, 0, 33, 0, 0, 0, 84223 }, //  
+    { 0, 0, 17, 0, 0, 0, 84223 }, //  
+    { 0, 0, 33, 0, 0, 0, 84223 }, //  
+    { 0, 0, 11, 0, 0, 0, 84223 }, //  
+    { 0, 0, 8, 0, 0, 0, 84223 }, //  
+    { 0, 0, 6, 0, 0, 0, 84223 }, //  
+    { 0, 0, 18, 0, 0, 0, 84223 }, //  
+    { 0, 0, 10, 0, 0, 0, 84223 }, //  
+    { 0, 0, 6, 0, 0, 0, 84223 }, //  
+    { 0, 0, 3, 0, 0, 0, 84223 }, //  
+    { 0, 0, 0, 0, 0, 0, 84223 }, // ​
+    { 0, 0, 0, 0, 0, 0, 84223 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 84223 }, // ‍
+    { 9, 28, 0, -1, 23, 63, 84223 }, // ‎
+    { 9, 28, 0, -8, 23, 63, 84286 }, // ‏
+    { 10, 5, 11, 0, 11, 13, 84349 }, // ‐
+    { 10, 5, 11, 0, 11, 13, 84362 }, // ‑
+    { 17, 5, 18, 1, 14, 22, 84375 }, // ‒
+    { 16, 4, 16, 0, 11, 16, 84397 }, // –
+    { 32, 4, 32, 0, 11, 32, 84413 }, // —
+    { 32, 4, 32, 0, 11, 32, 84445 }, // ―
+    { 13, 34, 18, 3, 26, 111, 84477 }, // ‖
+    { 16, 8, 13, -4, 0, 32, 84588 }, // ‗
+    { 9, 9, 7, 1, 24, 21, 84620 }, // ‘
+    { 9, 9, 7, 1, 24, 21, 84641 }, // ’
+    { 9, 9, 9, -2, 4, 21, 84662 }, // ‚
+    { 6, 9, 7, 3, 24, 14, 84683 }, // ‛
+    { 17, 9, 14, 1, 24, 39, 84697 }, // “
+    { 16, 9, 14, 1, 24, 36, 84736 }, // ”
+    { 16, 9, 17, -2, 4, 36, 84772 }, // „
+    { 13, 9, 14, 3, 24, 30, 84808 }, // ‟
+    { 15, 26, 17, 3, 26, 98, 84838 }, // †
+    { 17, 26, 17, 1, 26, 111, 84936 }, // ‡
+    { 10, 11, 13, 2, 18, 28, 85047 }, // •
+    { 11, 13, 12, 1, 19, 36, 85075 }, // ‣
+    { 7, 7, 17, 3, 6, 13, 85111 }, // ․
+    { 16, 7, 19, 0, 6, 28, 85124 }, // ‥
+    { 25, 7, 28, 0, 6, 44, 85152 }, // …
+    { 7, 7, 11, 2, 13, 13, 85196 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 85209 }, //  
+    { 0, 0, 20, 0, 0, 0, 85209 }, //  
+    { 9, 26, 0, -1, 21, 59, 85209 }, // ‪
+    { 9, 26, 0, -8, 21, 59, 85268 }, // ‫
+    { 8, 28, 0, -4, 23, 56, 85327 }, // ‬
+    { 8, 28, 0, -4, 23, 56, 85383 }, // ‭
+    { 8, 28, 0, -4, 23, 56, 85439 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 85495 }, //  
+    { 39, 26, 41, 1, 25, 254, 85495 }, // ‰
+    { 51, 26, 53, 1, 25, 332, 86016 }, // ‱
+    { 10, 9, 9, 2, 24, 23, 86348 }, // ′
+    { 18, 9, 17, 2, 24, 41, 86371 }, // ″
+    { 25, 9, 25, 2, 24, 57, 86412 }, // ‴
+    { 9, 9, 9, 2, 24, 21, 86469 }, // ‵
+    { 17, 9, 17, 2, 24, 39, 86490 }, // ‶
+    { 24, 9, 25, 2, 24, 54, 86529 }, // ‷
+    { 12, 11, 12, -3, 3, 33, 86583 }, // ‸
+    { 10, 16, 11, 1, 17, 40, 86616 }, // ‹
+    { 10, 16, 11, 0, 17, 40, 86656 }, // ›
+    { 27, 26, 28, 1, 25, 176, 86696 }, // ※
+    { 20, 25, 19, 0, 24, 125, 86872 }, // ‼
+    { 15, 26, 15, 2, 25, 98, 86997 }, // ‽
+    { 16, 4, 14, 3, 29, 16, 87095 }, // ‾
+    { 17, 8, 18, -2, 0, 34, 87111 }, // ‿
+    { 18, 8, 18, 2, 27, 36, 87145 }, // ⁀
+    { 17, 22, 13, -3, 14, 94, 87181 }, // ⁁
+    { 38, 31, 38, -1, 26, 295, 87275 }, // ⁂
+    { 10, 5, 11, 0, 11, 13, 87570 }, // ⁃
+    { 22, 24, 4, -9, 24, 132, 87583 }, // ⁄
+    { 15, 30, 11, -1, 24, 113, 87715 }, // ⁅
+    { 15, 30, 11, -3, 24, 113, 87828 }, // ⁆
+    { 30, 26, 30, 2, 25, 195, 88064 }, // ⁇
+    { 25, 26, 25, 2, 25, 163, 88259 }, // ⁈
+    { 26, 26, 25, 0, 25, 169, 88422 }, // ⁉
+    { 17, 19, 18, 2, 19, 81, 88591 }, // ⁊
+    { 18, 31, 21, 3, 26, 140, 88672 }, // ⁋
+    { 18, 18, 21, 1, 19, 81, 88812 }, // ⁌
+    { 18, 18, 21, 2, 19, 81, 88893 }, // ⁍
+    { 17, 17, 18, -1, 9, 73, 88974 }, // ⁎
+    { 9, 24, 10, 1, 19, 54, 89047 }, // ⁏
+    { 22, 35, 18, -2, 27, 193, 89101 }, // ⁐
+    { 20, 34, 18, -1, 26, 170, 89294 }, // ⁑
+    { 14, 26, 14, 0, 25, 91, 89464 }, // ⁒
+    { 32, 7, 33, 1, 13, 56, 89555 }, // ⁓
+    { 17, 8, 18, -3, 0, 34, 89611 }, // ⁔
+    { 19, 19, 19, 0, 18, 91, 89645 }, // ⁕
+    { 16, 26, 19, 1, 25, 104, 89736 }, // ⁖
+    { 30, 9, 29, 2, 24, 68, 89840 }, // ⁗
+    { 26, 26, 28, 1, 25, 169, 89908 }, // ⁘
+    { 26, 26, 28, 1, 25, 169, 90112 }, // ⁙
+    { 7, 26, 9, 1, 25, 46, 90281 }, // ⁚
+    { 22, 27, 24, 1, 26, 149, 90327 }, // ⁛
+    { 27, 27, 28, 0, 25, 183, 90476 }, // ⁜
+    { 7, 27, 9, 1, 26, 48, 90659 }, // ⁝
+    { 6, 26, 10, 2, 25, 39, 90707 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 90746 }, //  
+    { 0, 0, 20, 0, 0, 0, 90746 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 90746 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 90746 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 90746 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 90746 }, // ⁤
+    { 0, 0, 20, 0, 0, 0, 90746 }, // ⁦
+    { 0, 0, 20, 0, 0, 0, 90746 }, // ⁧
+    { 0, 0, 20, 0, 0, 0, 90746 }, // ⁨
+    { 0, 0, 20, 0, 0, 0, 90746 }, // ⁩
+    { 8, 28, 0, -4, 23, 56, 90746 }, // ⁪
+    { 8, 28, 0, -4, 23, 56, 90802 }, // ⁫
+    { 8, 28, 0, -4, 23, 56, 90858 }, // ⁬
+    { 8, 29, 0, -4, 24, 58, 90914 }, // ⁭
+    { 8, 28, 0, -4, 23, 56, 90972 }, // ⁮
+    { 8, 28, 0, -4, 23, 56, 91028 }, // ⁯
+    { 12, 16, 13, 3, 29, 48, 91084 }, // ⁰
+    { 7, 16, 8, 2, 25, 28, 91132 }, // ⁱ
+    { 14, 16, 13, 1, 29, 56, 91160 }, // ⁴
+    { 13, 16, 13, 2, 29, 52, 91216 }, // ⁵
+    { 12, 16, 13, 3, 29, 48, 91268 }, // ⁶
+    { 13, 16, 13, 3, 29, 52, 91316 }, // ⁷
+    { 13, 16, 13, 2, 29, 52, 91368 }, // ⁸
+    { 12, 16, 13, 3, 29, 48, 91420 }, // ⁹
+    { 11, 10, 13, 3, 25, 28, 91468 }, // ⁺
+    { 11, 3, 13, 3, 21, 9, 91496 }, // ⁻
+    { 10, 8, 13, 4, 24, 20, 91505 }, // ⁼
+    { 8, 19, 7, 4, 30, 38, 91525 }, // ⁽
+    { 9, 19, 7, 0, 30, 43, 91563 }, // ⁾
+    { 12, 12, 13, 2, 21, 36, 91606 }, // ⁿ
+    { 12, 16, 13, -1, 11, 48, 91642 }, // ₀
+    { 11, 16, 13, -1, 11, 44, 91690 }, // ₁
+    { 13, 16, 13, -2, 11, 52, 91734 }, // ₂
+    { 13, 16, 13, -2, 11, 52, 91786 }, // ₃
+    { 13, 16, 13, -2, 11, 52, 91838 }, // ₄
+    { 13, 16, 13, -2, 11, 52, 91890 }, // ₅
+    { 13, 16, 13, -1, 11, 52, 91942 }, // ₆
+    { 13, 16, 13, -1, 11, 52, 91994 }, // ₇
+    { 13, 16, 13, -2, 11, 52, 92046 }, // ₈
+    { 12, 16, 13, -1, 11, 48, 92098 }, // ₉
+    { 10, 10, 13, 0, 8, 25, 92160 }, // ₊
+    { 10, 3, 13, 0, 4, 8, 92185 }, // ₋
+    { 11, 8, 13, 0, 6, 22, 92193 }, // ₌
+    { 9, 19, 7, 0, 13, 43, 92215 }, // ₍
+    { 9, 19, 7, -4, 13, 43, 92258 }, // ₎
+    { 12, 12, 13, -1, 8, 36, 92301 }, // ₐ
+    { 11, 12, 12, -1, 8, 33, 92337 }, // ₑ
+    { 11, 12, 13, -1, 8, 33, 92370 }, // ₒ
+    { 14, 12, 12, -3, 8, 42, 92403 }, // ₓ
+    { 12, 12, 12, -2, 8, 36, 92445 }, // ₔ
+    { 13, 16, 15, -1, 12, 52, 92481 }, // ₕ
+    { 14, 16, 13, -1, 12, 56, 92533 }, // ₖ
+    { 8, 16, 8, -1, 12, 32, 92589 }, // ₗ
+    { 19, 12, 21, -1, 8, 57, 92621 }, // ₘ
+    { 13, 12, 13, -2, 8, 39, 92678 }, // ₙ
+    { 14, 16, 13, -3, 8, 56, 92717 }, // ₚ
+    { 10, 12, 11, -1, 8, 30, 92773 }, // ₛ
+    { 9, 15, 9, -1, 11, 34, 92803 }, // ₜ
+    { 19, 25, 19, 1, 25, 119, 92837 }, // ₠
+    { 20, 28, 18, 1, 26, 140, 92956 }, // ₡
+    { 20, 26, 19, 1, 25, 130, 93096 }, // ₢
+    { 20, 24, 18, 0, 24, 120, 93226 }, // ₣
+    { 22, 25, 18, -1, 25, 138, 93346 }, // ₤
+    { 29, 27, 30, 0, 23, 196, 93484 }, // ₥
+    { 21, 24, 19, 0, 24, 126, 93680 }, // ₦
+    { 29, 25, 29, 0, 24, 182, 93806 }, // ₧
+    { 31, 25, 30, 0, 24, 194, 93988 }, // ₨
+    { 27, 24, 24, 0, 24, 162, 94208 }, // ₩
+    { 28, 24, 29, 1, 24, 168, 94370 }, // ₪
+    { 23, 32, 20, 0, 26, 184, 94538 }, // ₫
+    { 21, 26, 18, 0, 25, 137, 94722 }, // €
+    { 23, 24, 19, 0, 24, 138, 94859 }, // ₭
+    { 20, 24, 18, 1, 24, 120, 94997 }, // ₮
+    { 33, 33, 34, 0, 25, 273, 95117 }, // ₯
+    { 22, 33, 20, -2, 25, 182, 95390 }, // ₰
+    { 21, 24, 19, 0, 24, 126, 95572 }, // ₱
+    { 22, 29, 23, 1, 26, 160, 95698 }, // ₲
+    { 23, 24, 20, -2, 24, 138, 95858 }, // ₳
+    { 20, 26, 19, 0, 25, 130, 95996 }, // ₴
+    { 20, 29, 20, 2, 26, 145, 96256 }, // ₵
+    { 24, 24, 23, 0, 23, 144, 96401 }, // ₶
+    { 25, 28, 23, -1, 25, 175, 96545 }, // ₷
+    { 19, 24, 18, 1, 24, 114, 96720 }, // ₸
+    { 18, 24, 18, 2, 24, 108, 96834 }, // ₹
+    { 19, 25, 18, 0, 24, 119, 96942 }, // ₺
+    { 21, 26, 21, 2, 25, 137, 97061 }, // ₻
+    { 27, 24, 27, -1, 24, 162, 97198 }, // ₼
+    { 21, 24, 19, -1, 24, 126, 97360 }, // ₽
+    { 23, 28, 20, -1, 28, 161, 97486 }, // ₾
+    { 19, 32, 18, 0, 28, 152, 97647 }, // ₿
+    { 10, 5, 11, 0, 11, 13, 97799 }, // −
+    { 31, 32, 33, 1, 26, 248, 97812 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_bolditalicIntervals[] = {
@@ -6818,4 +3950,9 @@ static const EpdFontData notosans_16_bolditalic = {
     36,
     -10,
     true,
+    notosans_16_bolditalicBlockOffsets,
+    notosans_16_bolditalicDirectGlyphs,
+    notosans_16_bolditalicGlyphPages,
+    256,
+    notosans_16_bolditalicPageGlyphs,
 };
@@ -2,5374 +2,2833 @@
  * generated by fontconvert.py
  * name: notosans_16_italic
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py notosans_16_italic 16 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_16_italic 16 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_italicBitmaps[85772] = {
-    0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00,
-    0xBE, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x03, 0xF4, 0x00, 0x04, 0x00, 0x00, 0x0F,
-    0x81, 0xF4, 0x7E, 0x0B, 0xD2, 0xF4, 0x3F, 0x0B, 0xC0, 0xFC, 0x3F, 0x03, 0xD0, 0xF4, 0x0F, 0x03,
-    0xC0, 0x7C, 0x0F, 0x01, 0xE0, 0x74, 0x07, 0x40, 0x00, 0x00, 0x3D, 0x00, 0xB4, 0x00, 0x00, 0x1F,
-    0x00, 0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x0B, 0x80, 0x00, 0x00, 0xF0,
-    0x03, 0xD0, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x2A, 0xAF, 0xEA,
-    0xBF, 0xAA, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x57, 0xF5, 0x5F, 0xD5, 0x50, 0x00, 0xF4, 0x03,
-    0xE0, 0x00, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x2E,
-    0x00, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x00,
-    0x00, 0x03, 0xE0, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00,
-    0x00, 0x2E, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x01, 0xBD, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xD3, 0xD1, 0xE0, 0x0B, 0xD0, 0xF0, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0xF8, 0x2E, 0x00,
-    0x00, 0x3F, 0x0B, 0x40, 0x00, 0x0B, 0xE3, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xC3, 0xF0, 0x00, 0x00,
-    0xF0, 0x7D, 0x00, 0x00, 0x78, 0x1F, 0x40, 0x00, 0x2E, 0x0B, 0xD0, 0x40, 0x0F, 0x47, 0xF0, 0x3E,
-    0x43, 0xDB, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xE0, 0x02, 0xFF, 0xF0, 0x00, 0x0B, 0xC0, 0x07,
-    0xE0, 0xF8, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0xBC, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0x2E, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0xF8,
-    0x0F, 0x80, 0x00, 0x7C, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x7C, 0x1A, 0x40, 0x7C,
-    0x03, 0xE0, 0xF4, 0xFF, 0xF0, 0x3D, 0x07, 0xC3, 0xE3, 0xFA, 0xF8, 0x3F, 0x6F, 0x8B, 0xC7, 0xD0,
-    0xBC, 0x1F, 0xFE, 0x1F, 0x0F, 0x80, 0x7C, 0x06, 0xE4, 0x3D, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0xF8,
-    0x2F, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3D, 0x03,
-    0xE0, 0x01, 0xF0, 0x00, 0x3F, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x1F, 0xFF, 0x40, 0x0F, 0x80, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x86, 0xFC, 0x00, 0x00, 0x3F,
-    0x40, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x00, 0xF8,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC1, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x00, 0x01, 0x40, 0xBF, 0x4B, 0xE0, 0x03, 0xF0, 0xBE, 0x00, 0xFC, 0x01, 0xF8, 0x7F, 0x00, 0x1F,
-    0xC0, 0xFC, 0x2F, 0x40, 0x02, 0xF8, 0xBD, 0x0F, 0xC0, 0x00, 0x3F, 0xBE, 0x03, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0xE0, 0x03, 0xF9, 0x06, 0xFE,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x1F, 0xC0, 0x07, 0xFF, 0xF8, 0x02, 0xFC, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0x87, 0xE2, 0xF4, 0xBC, 0x3F, 0x0F, 0x43, 0xC0, 0xF0, 0x74, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00,
-    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x0B, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x24, 0x01, 0xF0, 0x00, 0x3F, 0x41, 0xE0, 0x00, 0x7F, 0xF6, 0xC0, 0x00, 0x06, 0xFF,
-    0xEB, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x2F, 0xE0, 0x59, 0x00, 0xFC, 0xF0, 0x00, 0x03, 0xF0,
-    0xF4, 0x00, 0x0F, 0xD0, 0xBC, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x57, 0xE5, 0x55, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0,
-    0x0F, 0x80, 0x2F, 0x00, 0x3D, 0x00, 0x14, 0x00, 0x05, 0x55, 0x42, 0xFF, 0xFC, 0x3F, 0xFF, 0xC1,
-    0x55, 0x54, 0x00, 0x07, 0xD3, 0xFD, 0xFF, 0x3F, 0x41, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xFF, 0x97,
-    0xF8, 0x00, 0xBF, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x01, 0xF8, 0x1F, 0xC0,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x01, 0xF8, 0x7E,
-    0x00, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0,
-    0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x0F,
-    0xC0, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x03, 0xF0, 0x07, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x47,
-    0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0x40, 0xFF, 0xFC, 0x2F, 0xF7, 0xF0, 0xFE, 0x1F, 0x81,
-    0xD0, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x07,
-    0xFE, 0x5B, 0xFC, 0x00, 0x2D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA8, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x07, 0xFE, 0x5B, 0xFC, 0x00, 0x2D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x6A, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFC,
-    0x01, 0x00, 0x00, 0x2F, 0xC0, 0x7E, 0x50, 0x6F, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xDF, 0x80, 0x00, 0x01,
-    0xF8, 0xF4, 0x00, 0x00, 0x7F, 0x2F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0xFD, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x0B, 0xE0, 0x0B, 0xC0, 0x01, 0xF8, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAB, 0xFA, 0x80, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x69, 0x00, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x40, 0x00, 0x0B, 0xF0, 0x3E, 0x40, 0x6F, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xE5, 0x64, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x6F, 0xE0, 0x00, 0xFC, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFD, 0x6F, 0xF0, 0x1F, 0xF4, 0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x2F, 0x83, 0xF8, 0x00,
-    0x07, 0xE0, 0xFC, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x2F, 0x43, 0xF0,
-    0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x03, 0xF0, 0x03, 0xFD, 0x0B, 0xF8, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x03, 0xFD, 0x5B, 0xF4, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x07, 0xF0,
-    0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00,
-    0xFC, 0x03, 0xF4, 0x00, 0x3F, 0x80, 0x2F, 0xE0, 0x1F, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF4,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x5B, 0xF4, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0xBD, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x2F, 0x43, 0xF0,
-    0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x01, 0xFF, 0x01,
-    0xFE, 0x46, 0xFF, 0xC0, 0x2F, 0xFF, 0xF7, 0xE0, 0x01, 0xFF, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x06, 0x51, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFD, 0x02, 0xFD, 0x02, 0xFD, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x3F, 0xC0, 0x7F, 0xC0, 0x3F, 0x40, 0x04, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xBF, 0xD0, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x02,
-    0xF9, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x01, 0xFE, 0x5B, 0xF8, 0x08, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xE9, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x96, 0xBF, 0xD0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x1F, 0x80, 0x00, 0x10, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x7C, 0x0B, 0xC0,
-    0x0B, 0xFF, 0xFF, 0x00, 0xF4, 0x3E, 0x00, 0xBE, 0x00, 0xF4, 0x03, 0xD1, 0xF0, 0x0B, 0xD0, 0x07,
-    0xC0, 0x0F, 0x4B, 0xC0, 0x3E, 0x00, 0x2F, 0x00, 0x3D, 0x3E, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xF0,
-    0xF4, 0x0F, 0xC0, 0x03, 0xD0, 0x07, 0xC3, 0xD0, 0x3E, 0x00, 0x1F, 0x00, 0x2F, 0x0F, 0x40, 0xF8,
-    0x00, 0xFC, 0x00, 0xF4, 0x3D, 0x03, 0xE0, 0x07, 0xF0, 0x0B, 0xC0, 0xF4, 0x0F, 0xC0, 0x7F, 0xC0,
-    0x7D, 0x03, 0xE0, 0x1F, 0xEF, 0xCF, 0xEF, 0xE0, 0x0F, 0xC0, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x1F,
-    0x40, 0x05, 0x00, 0x05, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBF, 0xD4, 0x16, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00,
-    0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07,
-    0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03,
-    0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF,
-    0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x80, 0x02, 0xFC,
-    0x00, 0xBD, 0x00, 0x03, 0xF8, 0x02, 0xF4, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F,
-    0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x0B, 0xD0, 0x00, 0x7F, 0x40, 0x3F, 0xEA, 0xBF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0x80, 0x02, 0xFC, 0x00,
-    0xBD, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x7E, 0x00,
-    0x00, 0x3F, 0x01, 0xF4, 0x00, 0x01, 0xFC, 0x0B, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0xFF,
-    0x00, 0xFE, 0xAA, 0xBF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55,
-    0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
-    0x00, 0x01, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0xBD, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x80, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x0B, 0xE0,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x07, 0xE0, 0x00, 0x01, 0xFD, 0x01,
-    0xF4, 0x00, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x06, 0xFF, 0x00, 0x0F,
-    0xEA, 0xAF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA,
-    0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAA,
-    0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFA, 0xAB, 0xF8, 0x00, 0x7F, 0xD0, 0x00,
-    0x18, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xAA, 0xA4, 0x1F, 0xC0, 0x00, 0xFF, 0xFE,
-    0x0B, 0xE0, 0x00, 0x3F, 0xFF, 0x42, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x03, 0xF0,
-    0x2F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40,
-    0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xE5, 0x5B, 0xF8, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xD0, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x01,
-    0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0xAA, 0xAA, 0xFE, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xD0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x02, 0xF9, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x25, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x03,
-    0xF0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x00, 0x2F,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xF8,
-    0x3F, 0x80, 0x00, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x03,
-    0xF4, 0x00, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02,
-    0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xBE, 0xF0, 0x00,
-    0x00, 0xFE, 0xF0, 0x00, 0xFD, 0xF0, 0x00, 0x01, 0xF7, 0xF0, 0x00, 0xF8, 0xF4, 0x00, 0x03, 0xF3,
-    0xF0, 0x00, 0xF8, 0xF4, 0x00, 0x07, 0xD7, 0xE0, 0x01, 0xF4, 0xF8, 0x00, 0x0F, 0xC7, 0xD0, 0x02,
-    0xF0, 0xF8, 0x00, 0x1F, 0x0B, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0x3E, 0x0F, 0xC0, 0x03, 0xF0, 0xBC,
-    0x00, 0xBC, 0x0F, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0xF8, 0x1F, 0x80, 0x07, 0xD0, 0x7C, 0x02, 0xF0,
-    0x2F, 0x40, 0x0B, 0xC0, 0x7D, 0x03, 0xD0, 0x3F, 0x00, 0x0F, 0xC0, 0x3D, 0x0F, 0xC0, 0x3F, 0x00,
-    0x0F, 0x80, 0x3D, 0x1F, 0x40, 0x3F, 0x00, 0x1F, 0x80, 0x3E, 0x3F, 0x00, 0x7E, 0x00, 0x2F, 0x40,
-    0x3E, 0x7D, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x2F, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0xF0,
-    0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0xE0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x01, 0xF8,
-    0x00, 0xBC, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xD0, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF7, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D,
-    0x00, 0x3E, 0x2F, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00,
-    0x3F, 0x00, 0x3F, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0xFC, 0x03, 0xE0, 0x0B, 0xD0, 0x03, 0xE0, 0x0F,
-    0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0xFC, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0,
-    0x00, 0xBC, 0x1F, 0x80, 0x0F, 0x80, 0x01, 0xF8, 0xBD, 0x00, 0x7E, 0x00, 0x03, 0xF2, 0xF0, 0x02,
-    0xF4, 0x00, 0x0B, 0xDF, 0xC0, 0x0B, 0xC0, 0x00, 0x0F, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x02,
-    0xFA, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x2F,
-    0xC7, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA0, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xE0, 0x02, 0xFD, 0x00, 0xBD, 0x00,
-    0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01,
-    0xF8, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x1F,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xA5, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01,
-    0xFE, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00,
-    0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x07,
-    0xFB, 0xE0, 0x00, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x3F,
-    0x2F, 0x80, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x17, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFD, 0x00, 0xBD, 0x00, 0x0B,
-    0xF0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8,
-    0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x55, 0xBF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x02,
-    0xF4, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00,
-    0xFD, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xAB, 0xF8, 0x00, 0xBF, 0x00, 0x01, 0x40, 0x0F, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x01, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x55, 0xBF, 0xD0, 0x07, 0xFF, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02,
-    0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xFC,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x07, 0xE0,
-    0x2F, 0x40, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x07,
-    0xFD, 0x56, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x2F, 0xCB, 0xC0,
-    0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x7D, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x02,
-    0xF8, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x2F, 0x00,
-    0x3F, 0x00, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0xBD, 0x00,
-    0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x3E, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0xF8, 0x00, 0x00, 0x03,
-    0xFB, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x1F, 0x80,
-    0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x0B,
-    0xFC, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xEF, 0x00, 0x02, 0xF4, 0x0F, 0x80, 0x02, 0xF7, 0xD0,
-    0x00, 0xFC, 0x03, 0xE0, 0x00, 0xF8, 0xF4, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x7C, 0x3D, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x3F, 0x0F, 0x40, 0x1F, 0x80, 0x0F, 0xC0, 0x1F, 0x43, 0xD0, 0x0F, 0xC0, 0x03,
-    0xF0, 0x0F, 0xC0, 0xF4, 0x03, 0xF0, 0x00, 0xFC, 0x07, 0xD0, 0x3E, 0x02, 0xF4, 0x00, 0x3F, 0x03,
-    0xF0, 0x0F, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0xF4, 0x03, 0xE0, 0x7D, 0x00, 0x03, 0xF0, 0xBC, 0x00,
-    0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x3F, 0x2F, 0x00, 0x0F, 0xCB,
-    0xC0, 0x00, 0x0B, 0xCF, 0x80, 0x02, 0xF3, 0xE0, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0xBD, 0xF0, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF4, 0x01,
-    0xFC, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0x4B, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x9F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x03,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0xBC,
-    0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x1F,
-    0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x00, 0xFC,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x07, 0xD3, 0xF0, 0x00,
-    0x00, 0x3E, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xAA, 0xAA, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xFC,
-    0x00, 0x0B, 0xEA, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0x55,
-    0x40, 0x00, 0x7D, 0x00, 0xF4, 0x03, 0xE0, 0x0F, 0xC0, 0x3F, 0x00, 0xBC, 0x01, 0xF0, 0x07, 0xD0,
-    0x0F, 0x40, 0x3E, 0x00, 0xFC, 0x02, 0xF0, 0x0B, 0xC0, 0x1F, 0x00, 0x7D, 0x00, 0xF8, 0x03, 0xE0,
-    0x0F, 0xC0, 0x2F, 0x00, 0xBC, 0x01, 0xF4, 0x03, 0xD0, 0x0F, 0x80, 0x3E, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFC, 0x00, 0x06, 0xAF, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFC,
-    0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x0B,
-    0x80, 0xF4, 0x00, 0x03, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x0B,
-    0xC7, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
-    0xD1, 0x55, 0x55, 0x55, 0x00, 0x2A, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5,
-    0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00,
-    0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E,
-    0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE, 0x2F,
-    0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E,
-    0x0B, 0xFD, 0x00, 0x0B, 0xD7, 0xFF, 0xF4, 0x00, 0xFD, 0xF9, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0xFD,
-    0x00, 0xFF, 0x00, 0x07, 0xE0, 0x1F, 0xD0, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x07, 0xE0, 0x3F, 0x40,
-    0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFD, 0x07, 0xD0, 0x00, 0x0F, 0xC0,
-    0xBD, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x07, 0xF0, 0x1F, 0xF0, 0x01,
-    0xFD, 0x02, 0xFB, 0xD0, 0xBF, 0x80, 0x2E, 0x3F, 0xFF, 0xE0, 0x03, 0xD0, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00,
-    0x3F, 0xE5, 0x68, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x1F, 0xE0, 0x1B, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xFE, 0x0B, 0xC0, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x0F,
-    0xF5, 0x7E, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x00,
-    0xFC, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x7E, 0x00,
-    0xFC, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x7E, 0x00,
-    0x03, 0xF8, 0x01, 0xF8, 0x00, 0x2F, 0xD0, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xF0, 0x7E, 0xBC,
-    0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x1F, 0xFD, 0x0F, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0xFD, 0x03,
-    0xF8, 0x01, 0xF8, 0x2F, 0x80, 0x07, 0xE0, 0xFC, 0x00, 0x2F, 0x47, 0xE0, 0x01, 0xFC, 0x3F, 0x41,
-    0xBF, 0xD0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x40, 0x1F, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40,
-    0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x5B, 0xF5, 0x40, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x29, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x01, 0xFF, 0xFF, 0x1F, 0x00, 0x0F, 0xF5, 0x6E, 0xFC,
-    0x00, 0xFE, 0x00, 0x3F, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xF8,
-    0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x02,
-    0xF4, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x01,
-    0xF8, 0x00, 0x2F, 0xD0, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xF4, 0x7E, 0xBC, 0x00, 0x1F, 0xFF,
-    0xE3, 0xF0, 0x00, 0x1F, 0xFD, 0x0F, 0x80, 0x00, 0x01, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x08, 0x00, 0x07, 0xF0, 0x00, 0x3F,
-    0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7E, 0x0B, 0xFE, 0x00, 0x0B, 0xD7, 0xFF, 0xF8, 0x00, 0xFD, 0xF9, 0x6F, 0xC0,
-    0x0F, 0xFC, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x0B, 0xD0, 0x1F, 0xD0, 0x00, 0xBD, 0x02, 0xFC, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xF8, 0x07,
-    0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07,
-    0xE0, 0x1F, 0x80, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x06, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x01, 0xF8,
-    0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x26, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x01,
-    0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x1F, 0x47, 0xF0, 0x00, 0x02,
-    0xF1, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x0B, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x02, 0xF4, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00,
-    0x2F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B,
-    0xFC, 0x00, 0xBF, 0xE0, 0x00, 0xBC, 0x7F, 0xFF, 0x03, 0xFF, 0xF8, 0x00, 0xFD, 0xF9, 0x7F, 0x4F,
-    0x96, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xBD, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBD,
-    0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xBC, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF4,
-    0x00, 0x1F, 0x80, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x3F,
-    0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x03,
-    0xF0, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F,
-    0x80, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x01,
-    0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x07, 0xC0, 0xFF, 0xE0, 0x00, 0xBC, 0x7F, 0xFF, 0xC0, 0x0F, 0xDF, 0xD6, 0xFD, 0x00, 0xFF, 0xD0,
-    0x0F, 0xD0, 0x1F, 0xF0, 0x00, 0xBE, 0x02, 0xFD, 0x00, 0x0B, 0xD0, 0x3F, 0xC0, 0x00, 0xFD, 0x03,
-    0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x02,
-    0xF4, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xF8,
-    0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFD,
-    0x5F, 0xF0, 0x03, 0xF8, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0xBD,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1,
-    0xF8, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x2F,
-    0x80, 0xFD, 0x00, 0x1F, 0xC0, 0x1F, 0xE4, 0x6F, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0xFD, 0x00,
-    0x02, 0xF1, 0xFF, 0xFD, 0x00, 0x0F, 0xDF, 0x97, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xF4, 0x00, 0xFF,
-    0x00, 0x07, 0xE0, 0x07, 0xF4, 0x00, 0x1F, 0x80, 0x2F, 0xC0, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0x01,
-    0xF8, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x0F, 0x80, 0x00, 0x3F, 0x40, 0x7D, 0x00, 0x00, 0xFC, 0x02,
-    0xF4, 0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x01, 0xFC, 0x01, 0xFF, 0x00,
-    0x1F, 0xD0, 0x0B, 0xEF, 0x42, 0xFE, 0x00, 0x2F, 0x3F, 0xFF, 0xE0, 0x00, 0xFC, 0x2F, 0xFD, 0x00,
-    0x03, 0xF0, 0x05, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C,
-    0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00,
-    0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x7F, 0x03,
-    0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01,
-    0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F,
-    0xC1, 0xFA, 0xF0, 0x01, 0xFF, 0xFE, 0x3F, 0x00, 0x07, 0xFF, 0x47, 0xE0, 0x00, 0x01, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7F, 0xC0, 0x0B, 0xC7, 0xFF, 0x00, 0x3F, 0x7E, 0xA4,
-    0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xE0, 0x3F, 0x95, 0xBC, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xF0, 0xF4, 0x02, 0xFD, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xD0, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x1B, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFC, 0x17, 0xF5, 0x54, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x41, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x50, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B,
-    0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0,
-    0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0,
-    0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x1F, 0x80,
-    0x00, 0x2F, 0x43, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x07, 0xF0, 0x0F,
-    0xC0, 0x03, 0xF4, 0x02, 0xF0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x7E, 0x00,
-    0x07, 0xD0, 0x3F, 0x00, 0x00, 0xF8, 0x2F, 0x80, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x0F, 0x87, 0xD0,
-    0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0xBD, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x0F, 0xC0, 0x02,
-    0xFC, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0xBB, 0xD0, 0x03, 0xF0,
-    0x3F, 0x00, 0x3D, 0xF4, 0x02, 0xF4, 0x0F, 0xC0, 0x2F, 0x3D, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0x4F,
-    0x40, 0xBD, 0x00, 0xFC, 0x0B, 0xC3, 0xD0, 0x3F, 0x00, 0x3F, 0x03, 0xE0, 0xF8, 0x1F, 0x40, 0x0B,
-    0xC1, 0xF0, 0x3E, 0x0F, 0xC0, 0x02, 0xF0, 0xF8, 0x0F, 0x87, 0xE0, 0x00, 0xBC, 0x7C, 0x03, 0xE2,
-    0xF0, 0x00, 0x2F, 0x3E, 0x00, 0xB8, 0xF8, 0x00, 0x0B, 0xCF, 0x00, 0x2E, 0xBC, 0x00, 0x02, 0xFB,
-    0x80, 0x0B, 0xBE, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0,
-    0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0xFD, 0x00,
-    0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xF7, 0xE0,
-    0x00, 0x00, 0x2F, 0x8B, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00,
-    0x07, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0x00, 0x02, 0xF1, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0x5B, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x15, 0x56, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1A, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x0F, 0xE4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xF9, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x01, 0x1F, 0xFF,
-    0xF8, 0x02, 0xCB, 0xE6, 0xFF, 0xFF, 0xF2, 0x40, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF4,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x0B, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xE0, 0x06, 0x00, 0xFD, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x5B, 0xC0, 0x07, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x96, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x04, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x02, 0xAF, 0xFA, 0xA8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x15, 0xFD, 0x55,
-    0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x08, 0x00, 0x00, 0x20, 0xF8, 0x7F, 0x93, 0xE2, 0xFF,
-    0xFF, 0xFF, 0x02, 0xFE, 0x5B, 0xF0, 0x0B, 0xC0, 0x07, 0xD0, 0x3D, 0x00, 0x0B, 0x81, 0xF0, 0x00,
-    0x1F, 0x07, 0xC0, 0x00, 0x3C, 0x0F, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0xFC,
-    0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0x7F, 0xFA, 0xF8, 0xB0, 0x05, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4,
-    0x00, 0x0F, 0xD0, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x3F,
-    0x00, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00,
-    0x07, 0xC7, 0xD0, 0x00, 0x00, 0x0F, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0xF5, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x01, 0xAA, 0xFE, 0xA9, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x2A, 0xBF, 0xEA, 0x80, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x14, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFD, 0x00, 0x14, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x0F, 0x80, 0xBF, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0x3E,
-    0x00, 0x3F, 0x00, 0x1F, 0x40, 0x0B, 0xF0, 0x0F, 0xC0, 0x00, 0xFF, 0x9F, 0xC0, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xE4, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x06,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x47, 0xD0, 0x7D, 0xBD, 0x0B, 0xD7,
-    0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0xAF, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x3E, 0x00, 0x05, 0x40, 0x0F, 0x80, 0x0B, 0x80, 0x0B, 0xFF, 0xC0, 0x3D, 0x00,
-    0xF0, 0x07, 0xFF, 0xFC, 0x01, 0xF0, 0x2D, 0x00, 0xFD, 0x00, 0x40, 0x0F, 0x43, 0xC0, 0x2F, 0x40,
-    0x00, 0x00, 0x78, 0x3C, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x3C,
-    0x78, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x78, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xC3, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0x82, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0xBF, 0xAB, 0xC0, 0x0F, 0x00, 0xB8, 0x01,
-    0xFF, 0xFC, 0x03, 0xD0, 0x03, 0xD0, 0x01, 0xA5, 0x00, 0xBC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xA5, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0xA0, 0x7F, 0xBB, 0x83, 0xD0, 0x7D, 0x1E, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x0E, 0x0E, 0x00,
-    0xB4, 0x78, 0x03, 0xD0, 0xF0, 0x2F, 0x03, 0xFB, 0xFC, 0x03, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xD0, 0x07, 0xE0, 0x3F, 0x00, 0x7E, 0x02, 0xF0, 0x0B, 0xE0,
-    0x2F, 0x40, 0xBF, 0x02, 0xF8, 0x07, 0xF0, 0x1F, 0xC0, 0x1F, 0x80, 0xFC, 0x00, 0x3F, 0x02, 0xF4,
-    0x00, 0x7E, 0x03, 0xF0, 0x00, 0xFC, 0x0B, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x03, 0xF0, 0x1F, 0x00,
-    0x03, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x55, 0x55, 0x55, 0x6F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1A, 0x05, 0x55, 0x42, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xC1, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x06, 0xF8, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0xBF,
-    0xFE, 0x00, 0x3D, 0x00, 0xF0, 0x0B, 0xFF, 0xFC, 0x01, 0xF0, 0x2D, 0x00, 0xBC, 0x07, 0xE0, 0x0F,
-    0x43, 0xC0, 0x0B, 0xC0, 0x3F, 0x00, 0x78, 0x3C, 0x00, 0xBC, 0x03, 0xF0, 0x03, 0xC7, 0x80, 0x0B,
-    0xC0, 0x3E, 0x00, 0x3C, 0x78, 0x00, 0xBD, 0x6F, 0xC0, 0x03, 0xC7, 0x80, 0x0B, 0xFF, 0xF0, 0x00,
-    0x3C, 0x78, 0x00, 0xBE, 0xBE, 0x00, 0x03, 0xC3, 0xC0, 0x0B, 0xC2, 0xF0, 0x00, 0x3C, 0x3C, 0x00,
-    0xBC, 0x0F, 0xC0, 0x07, 0x82, 0xD0, 0x0B, 0xC0, 0x7D, 0x00, 0xB4, 0x0F, 0x00, 0xBC, 0x03, 0xF0,
-    0x0F, 0x00, 0xB8, 0x0B, 0xC0, 0x1F, 0x83, 0xD0, 0x03, 0xD0, 0x54, 0x00, 0x54, 0xBC, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xA5, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xFF, 0xC6, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0x00, 0xBC, 0x3D, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x3D,
-    0x3D, 0x00, 0x3C, 0x2F, 0x00, 0xBC, 0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0xF9, 0x55, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x40, 0x01, 0xFF, 0xF4, 0x03, 0xFA, 0xFC, 0x01, 0x40, 0x7C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x02, 0xFF, 0xF0, 0x03, 0xE6, 0xFC, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x06, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0xAF, 0xD0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x10, 0x02, 0xF0, 0x7E, 0xAF, 0xD0, 0x3F, 0xFF,
-    0x40, 0x01, 0x50, 0x00, 0x00, 0x69, 0x00, 0xFD, 0x03, 0xF4, 0x0B, 0xD0, 0x1F, 0x40, 0x3C, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0xBD,
-    0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00,
-    0x07, 0xE0, 0x01, 0xF4, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F,
-    0xC0, 0x03, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x1F, 0xDF, 0x40,
-    0x0B, 0xFF, 0xFF, 0x2F, 0x00, 0x0F, 0xDF, 0xF8, 0x2F, 0x00, 0x0F, 0x81, 0x40, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xFF, 0xF5, 0x5E, 0x3F, 0xFF, 0xFD, 0x07, 0x9F, 0xFF, 0xFF, 0x41, 0xEB, 0xFF, 0xFF, 0xD0, 0x7B,
-    0xFF, 0xFF, 0xF4, 0x1E, 0xFF, 0xFF, 0xFD, 0x07, 0xBF, 0xFF, 0xFF, 0x41, 0xEF, 0xFF, 0xFF, 0xD0,
-    0x7A, 0xFF, 0xFF, 0xF4, 0x1E, 0x7F, 0xFF, 0xFD, 0x07, 0x8F, 0xFF, 0xFF, 0x41, 0xE2, 0xFF, 0xFF,
-    0xD0, 0x78, 0x3F, 0xFF, 0xF4, 0x1E, 0x01, 0xFF, 0xFD, 0x07, 0x80, 0x00, 0x0B, 0x41, 0xE0, 0x00,
-    0x02, 0xD0, 0x78, 0x00, 0x00, 0xB4, 0x1E, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x0B, 0x41, 0xE0,
-    0x00, 0x02, 0xD0, 0x78, 0x00, 0x00, 0xB4, 0x1E, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x0B, 0x41,
-    0xE0, 0x00, 0x02, 0xD0, 0x78, 0x00, 0x00, 0xB4, 0x1E, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x0B,
-    0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD3, 0xFD, 0xFF, 0x3F, 0x41, 0x00, 0x03, 0xC0,
-    0x1E, 0x00, 0xFE, 0x00, 0x7D, 0x00, 0xF4, 0x07, 0xDB, 0xFE, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7E,
-    0x02, 0xFD, 0x1F, 0xBC, 0x3D, 0x7C, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x01, 0xF0,
-    0x02, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x7F, 0xBE, 0x03, 0xD0, 0x3C, 0x1E, 0x00, 0xB4, 0xF0, 0x02, 0xD3, 0xC0, 0x0B, 0x4F,
-    0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xF0, 0x0F, 0x41, 0xFA, 0xF8, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x08, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0xBC, 0x07, 0xD0, 0x00,
-    0xF8, 0x0F, 0xC0, 0x02, 0xF0, 0x1F, 0x40, 0x07, 0xE0, 0x3F, 0x00, 0x2F, 0xC0, 0xBD, 0x01, 0xFC,
-    0x07, 0xF0, 0x0F, 0xC0, 0x7F, 0x00, 0xFC, 0x07, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0x7D, 0x03, 0xF0,
-    0x00, 0x90, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0xB8, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0x00, 0x7E, 0xF0, 0x00, 0x03, 0xD0, 0x0F,
-    0x5F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00,
-    0x03, 0xD0, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00,
-    0x00, 0xB8, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0xFC, 0x00, 0xF0, 0x0F, 0xC0, 0x2F,
-    0xC0, 0x1F, 0x02, 0xF0, 0x07, 0xF8, 0x02, 0xF0, 0x7D, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0x80, 0x3C,
-    0xF0, 0x00, 0x03, 0xF0, 0x0F, 0x1F, 0x00, 0x00, 0xBC, 0x03, 0xD2, 0xE0, 0x00, 0x1F, 0x40, 0xB8,
-    0x2D, 0x00, 0x03, 0xE0, 0x1F, 0x03, 0xD0, 0x00, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0x00, 0x7F,
-    0xFF, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0x40, 0x07, 0xEF, 0x00, 0x00, 0x3E, 0x00,
-    0x0F, 0x5F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xB8, 0x01, 0xF4, 0x05, 0x40, 0x00, 0xF4, 0x03, 0xE0, 0xBF, 0xF4,
-    0x00, 0xF0, 0x0F, 0xC3, 0xFA, 0xFC, 0x01, 0xF0, 0x2F, 0x00, 0x40, 0x3D, 0x02, 0xF0, 0x7D, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x2F, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07,
-    0x80, 0x3E, 0xAF, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x6F, 0x40, 0x01, 0xF4, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xAF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0xFC, 0x10,
-    0x02, 0xF0, 0x2F, 0x00, 0xBF, 0x0F, 0xAB, 0xF4, 0x1F, 0x00, 0x7F, 0x83, 0xFF, 0xF4, 0x0F, 0x40,
-    0x7F, 0xD0, 0x05, 0x40, 0x0F, 0x80, 0x3C, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x3D, 0x7C, 0x00, 0x00,
-    0x07, 0xC0, 0x3D, 0x1E, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x0B, 0x80, 0x00, 0x03, 0xE0, 0x1F, 0x03,
-    0xD0, 0x00, 0x02, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xF4,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03,
-    0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0,
-    0x00, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF8,
-    0x07, 0xE0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0,
-    0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xDF, 0x80,
-    0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x00,
-    0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x7D, 0x00,
-    0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC2, 0xF8,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x3D, 0x00, 0x00, 0x1E,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00,
-    0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02,
-    0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB,
-    0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x3C, 0x00,
-    0x00, 0x0F, 0xFF, 0xEF, 0x80, 0x00, 0x01, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x1C, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x7D, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x00, 0x2F, 0x40, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00,
-    0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00,
-    0x02, 0xD0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0,
-    0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00,
-    0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B,
-    0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02,
-    0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,
-    0x01, 0xD0, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00,
-    0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02,
-    0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB,
-    0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xD3,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xFA, 0xAA, 0xA0, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x02, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xAA, 0xAB, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x03, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFE,
-    0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xB8,
-    0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xD4, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x0B, 0xD3, 0xD0, 0x00, 0x02, 0xF0, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xEA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFD, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xA8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xF8, 0xF8, 0x00, 0x1F,
-    0x40, 0xF4, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0x90, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x3F, 0x03, 0xF0, 0x00,
-    0xFC, 0x0F, 0xC0, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x7F,
-    0xE0, 0x00, 0xBD, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x00, 0x07,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x3F,
-    0x1A, 0xFA, 0xA9, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x07, 0xE0, 0x00, 0x01, 0xFD, 0x01, 0xF4, 0x00, 0x00, 0xFE, 0x00,
-    0xBD, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x06, 0xFF, 0x00, 0x0F, 0xEA, 0xAF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40,
-    0x00, 0x00, 0x1F, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xF4, 0x00, 0x00, 0x0B, 0x42, 0xFF,
-    0x80, 0x00, 0x00, 0x28, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0xFF,
-    0x40, 0x00, 0x0B, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0xFD, 0xF8, 0x00, 0x03, 0xE0, 0x03, 0xE3, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x8B, 0xC0, 0x00, 0xBC,
-    0x00, 0x7D, 0x1F, 0x80, 0x03, 0xF0, 0x02, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0xBD, 0x00,
-    0x7E, 0x00, 0x3F, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF8, 0x03, 0xF0, 0x0B, 0xC0, 0x07, 0xD0, 0x07,
-    0xD0, 0x3F, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0xFC, 0x00, 0x2F, 0x07, 0xE0, 0x03, 0xE0,
-    0x00, 0x7E, 0x2F, 0x40, 0x1F, 0x80, 0x00, 0xFC, 0xBC, 0x00, 0xBD, 0x00, 0x02, 0xF7, 0xF0, 0x02,
-    0xF0, 0x00, 0x03, 0xEF, 0x80, 0x0F, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0xF0,
-    0x01, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x02, 0xFF, 0xA6, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x00,
-    0x7F, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00,
-    0x7F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x00, 0x0B,
-    0xEB, 0xE0, 0x00, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xBF,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x2F, 0xC0,
-    0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xA6, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00,
-    0xFD, 0x00, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x2F,
-    0x80, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x00, 0x0B, 0xEB, 0xE0,
-    0x00, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x1F, 0xC0,
-    0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x5F, 0x40, 0x00, 0x00,
-    0x3F, 0x02, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xA6, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00,
-    0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x00, 0x0B, 0xEB, 0xE0, 0x00, 0x00,
-    0x03, 0xF6, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x00,
-    0x3F, 0x43, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F,
-    0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 0x00, 0x00, 0x07, 0xFE,
-    0x03, 0xC0, 0x00, 0x03, 0xFF, 0xFB, 0xD0, 0x00, 0x02, 0xE0, 0xBF, 0xF0, 0x00, 0x00, 0xA0, 0x02,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x9B, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x1F,
-    0xE0, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x00, 0x0B,
-    0xE0, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xBE, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0x80, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x07, 0xF2,
-    0xF8, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x03,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x40, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFE, 0x9B, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00,
-    0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0x80, 0x00,
-    0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x00,
-    0xFF, 0x40, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x24, 0x3F,
-    0x00, 0x00, 0xBD, 0x1F, 0xC0, 0x02, 0xF8, 0x07, 0xF0, 0x0B, 0xE0, 0x01, 0xFC, 0x2F, 0x80, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0xBE, 0x7F, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x0B, 0xE0, 0x07, 0xF0, 0x2F, 0x80, 0x01, 0xFC, 0x2E,
-    0x00, 0x00, 0x7C, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x01, 0xFF, 0xF8, 0x1F, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0xFC, 0x00, 0x0B,
-    0xFE, 0x5B, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xFC, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0xF4, 0x02, 0xF8, 0x00, 0x03, 0xFB, 0xE0, 0x0F, 0xC0, 0x00, 0x3F, 0x1F,
-    0xC0, 0xBE, 0x00, 0x03, 0xF4, 0x3F, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0xFC, 0x0F, 0xC0, 0x01, 0xF8,
-    0x03, 0xF0, 0x7F, 0x00, 0x0F, 0xC0, 0x1F, 0xC1, 0xF8, 0x00, 0xFC, 0x00, 0x7F, 0x0B, 0xE0, 0x0F,
-    0xD0, 0x02, 0xF8, 0x2F, 0x80, 0xBE, 0x00, 0x0F, 0xD0, 0xBE, 0x07, 0xE0, 0x00, 0x3F, 0x02, 0xF8,
-    0x3F, 0x00, 0x02, 0xFC, 0x07, 0xF3, 0xF0, 0x00, 0x0F, 0xD0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0x00,
-    0x3F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0xE5, 0x6F, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFD, 0x2F, 0xFF, 0xD0, 0x00, 0x01, 0xD0, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00,
-    0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x07,
-    0xE0, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x00, 0x03, 0xF0,
-    0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00,
-    0x07, 0xFD, 0x56, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4,
-    0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x7E, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x2F,
-    0x40, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFD,
-    0x56, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x00, 0x00, 0xBD, 0x07, 0xD0, 0x00, 0x00,
-    0x78, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0,
-    0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00,
-    0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00,
-    0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x01,
-    0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFD, 0x56, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x00, 0xB4, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3E,
-    0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40,
-    0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00,
-    0xFE, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF5, 0x5B, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x1F, 0xC0,
-    0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00,
-    0x3E, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xAA, 0x40,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x01, 0xF8,
-    0x00, 0x2F, 0xC0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x03, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x02, 0xF8, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0xFC, 0x00,
-    0x2F, 0xE0, 0x0F, 0xEA, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xA4, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0x40,
-    0x7F, 0x80, 0x00, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3E, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xF8, 0x00,
-    0x1F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF0,
-    0x00, 0x0B, 0xD3, 0xD0, 0x2F, 0xD0, 0x00, 0x0F, 0xC3, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xC1, 0xFF,
-    0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x05, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x26, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C, 0x00,
-    0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80, 0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0,
-    0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF8,
-    0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F, 0xFF,
-    0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C, 0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80,
-    0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03,
-    0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00,
-    0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F,
-    0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0x80, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x01, 0xE0, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03,
-    0xFF, 0xFC, 0x7C, 0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80, 0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F,
-    0x40, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0,
-    0x7E, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F,
-    0xEF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x01, 0x80, 0x00, 0x7F, 0xE0, 0x3C, 0x00, 0x0F, 0xFF, 0xEF, 0x80, 0x01, 0xE0,
-    0xBF, 0xF0, 0x00, 0x2C, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00,
-    0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F,
-    0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F,
-    0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0,
-    0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x07,
-    0xE0, 0x7E, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5,
-    0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00,
-    0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E,
-    0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE, 0x2F,
-    0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x1D, 0x07, 0x80, 0x00, 0x02, 0xC0, 0x38,
-    0x00, 0x00, 0x1E, 0x0B, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C,
-    0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80, 0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00,
-    0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03,
-    0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03,
-    0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F,
-    0xFF, 0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0xB0, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0x4F, 0x7F, 0xFF,
-    0xC0, 0x0F, 0xF5, 0x7E, 0xFF, 0xD5, 0xFD, 0x03, 0xF8, 0x01, 0xFF, 0xE0, 0x07, 0xE0, 0xBF, 0x00,
-    0x0F, 0xF8, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0xFF, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x0F, 0xD0, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0xFC, 0x06, 0xFF, 0x03, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0x00,
-    0x01, 0xFF, 0xFF, 0x90, 0x07, 0xE0, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x82, 0xF7, 0xFF, 0x80, 0x6D, 0x01, 0xFF, 0xFC, 0x7E, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFE, 0x07, 0x87, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0x68, 0x03, 0xF8,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x0F, 0x50, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x7F, 0x40, 0xFE,
-    0x00, 0x7E, 0x0B, 0xE0, 0x01, 0xF8, 0x3F, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x7F, 0x0F, 0xD0, 0x6F,
-    0xF4, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x90, 0x07, 0xE4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x06, 0xD0, 0x0B,
-    0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0x57, 0xF4, 0x03, 0xF8, 0x01, 0xF8, 0x0B, 0xE0, 0x01, 0xF8, 0x0F,
-    0xC0, 0x02, 0xF4, 0x1F, 0x80, 0x07, 0xF0, 0x3F, 0x41, 0xBF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xE4, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x2F, 0x41, 0xF4, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x7F,
-    0x40, 0xFE, 0x00, 0x7E, 0x0B, 0xE0, 0x01, 0xF8, 0x3F, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x7F, 0x0F,
-    0xD0, 0x6F, 0xF4, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x90, 0x07, 0xE4, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x06,
-    0xD0, 0x0B, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x10, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x03,
-    0xFD, 0x5F, 0xD0, 0x3F, 0x80, 0x1F, 0x82, 0xF8, 0x00, 0x7E, 0x0F, 0xC0, 0x02, 0xF4, 0x7E, 0x00,
-    0x1F, 0xC3, 0xF4, 0x1B, 0xFD, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE4, 0x01, 0xF9, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01,
-    0xFE, 0x01, 0xB4, 0x02, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01,
-    0xA0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x2F,
-    0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0,
-    0x01, 0xF8, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8,
-    0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00,
-    0x07, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F,
-    0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0xE0, 0x02, 0xF5, 0xF4, 0x0F, 0xC0, 0xBC, 0x2E, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01,
-    0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xD0,
-    0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00,
-    0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x40, 0x04, 0x03, 0xE0, 0x3D, 0x07, 0xE0, 0x7E, 0x03,
-    0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0B, 0xF4, 0xFC,
-    0x00, 0x00, 0x74, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x06,
-    0xA8, 0x1F, 0x00, 0x07, 0xFF, 0xF9, 0xF4, 0x02, 0xFF, 0xAF, 0xEF, 0x40, 0xBF, 0x40, 0x1F, 0xF4,
-    0x0F, 0xC0, 0x00, 0xBF, 0x42, 0xF4, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00,
-    0x03, 0xF0, 0x7E, 0x00, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0x0B, 0xD0, 0xBD, 0x00, 0x00, 0xFC, 0x07,
-    0xE0, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x07, 0xF0, 0x02, 0xFD, 0x06, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24,
-    0x00, 0x03, 0xFE, 0x02, 0xD0, 0x00, 0x2F, 0xFF, 0xBF, 0x00, 0x00, 0xF0, 0x7F, 0xF0, 0x00, 0x07,
-    0x40, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0x03, 0xFF,
-    0x80, 0x00, 0xBC, 0x7F, 0xFF, 0xC0, 0x03, 0xF7, 0xF5, 0xBF, 0x40, 0x0F, 0xFD, 0x00, 0xFD, 0x00,
-    0x7F, 0xC0, 0x02, 0xF8, 0x02, 0xFD, 0x00, 0x0B, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0x40,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x2F, 0x80, 0x00, 0xBD,
-    0x00, 0xFD, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x7E,
-    0x00, 0x02, 0xF8, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xF5, 0x7F,
-    0xC0, 0x0F, 0xE0, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC2, 0xF4, 0x00,
-    0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x0F, 0xC7, 0xE0,
-    0x00, 0x07, 0xE1, 0xF8, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xBE, 0x03,
-    0xF4, 0x00, 0x7F, 0x00, 0x7F, 0x91, 0xBF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x1F, 0xF5, 0x7F, 0xC0, 0x0F, 0xE0, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F,
-    0xC2, 0xF4, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00,
-    0x0F, 0xC7, 0xE0, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0xBE, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x7F, 0x91, 0xBF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x0F, 0x40,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x1F, 0xF5, 0x7F, 0xC0, 0x0F, 0xE0, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F,
-    0x1F, 0x80, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00,
-    0xFC, 0x0F, 0xC0, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x7F, 0x91, 0xBF, 0x40, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x50, 0x02, 0x40,
-    0x03, 0xFF, 0x02, 0xD0, 0x02, 0xFF, 0xFA, 0xF0, 0x00, 0xF0, 0x7F, 0xF4, 0x00, 0x74, 0x01, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x7F, 0xD5, 0xFF, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x7E,
-    0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x01, 0xFC, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x2F, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0xF0, 0x2F, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2E, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x7F, 0xD5, 0xFF, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x00, 0x3F, 0x1F, 0x80, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x01, 0xFC, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0x15,
-    0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0xFF, 0xE3, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xD5, 0xFF, 0x40, 0x0F, 0xD0, 0x07, 0xF8, 0x02, 0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0x00, 0x3E,
-    0xFC, 0x0B, 0xD0, 0x0F, 0xCB, 0xC0, 0xFC, 0x02, 0xF0, 0xBC, 0x0F, 0xC0, 0x7D, 0x0F, 0xC0, 0xF8,
-    0x1F, 0x80, 0xFC, 0x1F, 0x43, 0xE0, 0x0F, 0x81, 0xF4, 0xFC, 0x01, 0xF4, 0x1F, 0xAF, 0x00, 0x3F,
-    0x00, 0xFF, 0xD0, 0x0B, 0xD0, 0x0F, 0xF8, 0x01, 0xFC, 0x00, 0x7F, 0x80, 0xBF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x02, 0xF7, 0xFF, 0xE0, 0x00, 0x1D, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B,
-    0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0,
-    0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0,
-    0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8,
-    0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F,
-    0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0x07, 0xD0, 0x3D, 0x00, 0x01, 0xE0, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD,
-    0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E,
-    0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00,
-    0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x00,
-    0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x04, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x2D, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0xBC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80,
-    0x7E, 0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF,
-    0x40, 0x3F, 0x81, 0xFA, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0x5B, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x82, 0xFF, 0x40, 0x00, 0xBD, 0x7F, 0xFF, 0x40, 0x03, 0xF7,
-    0xE5, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x01, 0xF8, 0x01, 0xFD, 0x00, 0x07,
-    0xE0, 0x0B, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x07,
-    0xE0, 0x00, 0x0F, 0xD0, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x07, 0xF4, 0x02, 0xFB, 0xD0, 0xBF, 0x80,
-    0x0B, 0xCF, 0xFF, 0xF8, 0x00, 0x3F, 0x0B, 0xFF, 0x40, 0x00, 0xFC, 0x01, 0x40, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x42, 0xF4,
-    0x00, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0,
-    0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x07, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0x00, 0x01,
-    0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x25, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F,
-    0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0,
-    0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80,
-    0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E,
-    0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF,
-    0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00,
-    0x3F, 0xAF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0x7E, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0xBC, 0x00, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x01,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAF,
-    0xC0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0x40, 0x0A, 0x00, 0x00, 0x78, 0x01, 0xF0, 0x00,
-    0x03, 0xFA, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F,
-    0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F,
-    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00,
-    0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80,
-    0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE,
-    0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00,
-    0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4,
-    0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0,
-    0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x90, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00,
-    0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F,
-    0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F,
-    0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0,
-    0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0,
-    0x00, 0x01, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00,
-    0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xF9, 0x5A, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x07, 0xF8, 0x06, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0x7E, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x55, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x02, 0xF5, 0xF4, 0x00, 0x3F, 0x02, 0xF0, 0x02, 0xE0, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xF9, 0x5A, 0x00, 0xFE,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x06, 0xC0, 0x0B,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0,
-    0x00, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFE, 0x56,
-    0x80, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x01,
-    0xB0, 0x02, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x18, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x55, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0x95, 0xA0, 0x03, 0xF8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xE0,
-    0x1B, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x19, 0x00, 0x00, 0x03, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0xBD, 0x00,
-    0x02, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00,
-    0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x02,
-    0xFC, 0x07, 0xE0, 0x00, 0x01, 0xFD, 0x01, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x01, 0xFF,
-    0x00, 0x3F, 0x00, 0x06, 0xFF, 0x00, 0x0F, 0xEA, 0xAF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD2, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x0B, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xF5, 0x7E, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFE, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x07, 0xEB, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xE2, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0xF8, 0x00, 0x7F, 0xE0, 0x00, 0xBD, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x80, 0x0F,
-    0xC0, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xBD,
-    0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0xBF, 0xFF,
-    0xFC, 0x00, 0x3F, 0x1A, 0xFA, 0xA9, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x07, 0xE0, 0x00, 0x01, 0xFD, 0x01, 0xF4, 0x00,
-    0x00, 0xFE, 0x00, 0xBD, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x06, 0xFF, 0x00, 0x0F, 0xEA, 0xAF,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x15,
-    0x5B, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xFE, 0x0B, 0xC0, 0x00, 0x1F, 0xFF, 0xF3,
-    0xF0, 0x00, 0x1F, 0xF5, 0x6E, 0xFC, 0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x7F,
-    0x40, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0x0F, 0xC0,
-    0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0x80, 0x02, 0xFD, 0x00,
-    0x03, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x07, 0xEB, 0xC0, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00,
-    0x01, 0xFF, 0xD0, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x40,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xEA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0A,
-    0xAA, 0xA4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0xFD, 0x03, 0xF8, 0x01, 0xF8,
-    0x2F, 0x80, 0x07, 0xE0, 0xFC, 0x00, 0x2F, 0x47, 0xE0, 0x01, 0xFC, 0x3F, 0x41, 0xBF, 0xD0, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x40, 0x1F, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40, 0x2F, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x90, 0x02, 0x80, 0x00, 0x1E, 0x00,
-    0x7C, 0x00, 0x00, 0xFE, 0xBF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x0F, 0xEB, 0xF4,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0x57, 0xF4, 0x03, 0xF8, 0x01, 0xF8,
-    0x0B, 0xE0, 0x01, 0xF8, 0x0F, 0xC0, 0x02, 0xF4, 0x1F, 0x80, 0x07, 0xF0, 0x3F, 0x41, 0xBF, 0xD0,
-    0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40,
-    0x0B, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0x40, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFD, 0x5F, 0xD0, 0x3F, 0x80,
-    0x1F, 0x82, 0xF8, 0x00, 0x7E, 0x0F, 0xC0, 0x02, 0xF4, 0x7E, 0x00, 0x1F, 0xC3, 0xF4, 0x1B, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE4, 0x01, 0xF9, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x01, 0xB4, 0x02, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x80,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0xFD, 0x03, 0xF8, 0x01, 0xF8, 0x2F, 0x80, 0x07,
-    0xE0, 0xFC, 0x00, 0x2F, 0x47, 0xE0, 0x01, 0xFC, 0x3F, 0x41, 0xBF, 0xD0, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFE, 0x40, 0x1F, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x90, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x09, 0x00, 0x0A, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x07, 0xD2, 0xF4, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0x57, 0xF4, 0x03, 0xF8, 0x01, 0xF8,
-    0x0B, 0xE0, 0x01, 0xF8, 0x0F, 0xC0, 0x02, 0xF4, 0x1F, 0x80, 0x07, 0xF0, 0x3F, 0x41, 0xBF, 0xD0,
-    0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40,
-    0x0B, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x4F,
-    0x80, 0x00, 0x00, 0x2F, 0x41, 0xF4, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xEA, 0xAF, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x60, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x06, 0xAA, 0x90, 0x7F, 0x00, 0x03, 0xFF, 0xF8, 0x2F, 0x80, 0x00, 0xFF, 0xFD, 0x0B,
-    0xE0, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x1F,
-    0xC0, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x1F,
-    0xE0, 0x00, 0x0F, 0xC0, 0x02, 0xFF, 0x95, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x5F, 0x40, 0x00, 0x02, 0xF0,
-    0x2F, 0x00, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0xF0, 0x00, 0x7F, 0xFF, 0xC7, 0xC0, 0x03, 0xFD, 0x5B, 0xBF, 0x00, 0x3F,
-    0x80, 0x0F, 0xF8, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00,
-    0xFC, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0xBD, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x7E, 0x00,
-    0x0B, 0xF4, 0x00, 0xFC, 0x00, 0xBF, 0xD0, 0x03, 0xFD, 0x1F, 0xAF, 0x00, 0x07, 0xFF, 0xF8, 0xFC,
-    0x00, 0x07, 0xFF, 0x43, 0xE0, 0x00, 0x00, 0x40, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x02, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE5, 0xBF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x2B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x18, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xAA, 0xBF,
-    0x80, 0x07, 0xFD, 0x00, 0x01, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1A, 0xAA, 0x41,
-    0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0xBE, 0x00, 0x03, 0xFF, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x0B,
-    0xE0, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x0F,
-    0xC0, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0x00, 0x0B,
-    0xFE, 0x55, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x80, 0x02, 0x80, 0x00, 0x07, 0x80, 0x1E, 0x00, 0x00, 0x1F,
-    0xEB, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x1F, 0xFF, 0xF1, 0xF0, 0x00,
-    0xFF, 0x56, 0xEF, 0xC0, 0x0F, 0xE0, 0x03, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xF4, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-    0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xE0,
-    0x00, 0x3F, 0x80, 0x1F, 0x80, 0x02, 0xFD, 0x00, 0x3F, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x47, 0xEB,
-    0xC0, 0x01, 0xFF, 0xFE, 0x3F, 0x00, 0x01, 0xFF, 0xD0, 0xF8, 0x00, 0x00, 0x10, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x80, 0x00,
-    0x7F, 0x00, 0x03, 0xF9, 0x6F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0A, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xAA, 0xBF, 0x80, 0x07, 0xFD, 0x00, 0x01, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x1A, 0xAA, 0x41, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0xBE, 0x00, 0x03, 0xFF, 0xF4, 0x2F,
-    0x80, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x7F,
-    0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F,
-    0x80, 0x00, 0x3F, 0x00, 0x0B, 0xFE, 0x55, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00,
-    0x1F, 0xFF, 0xF1, 0xF0, 0x00, 0xFF, 0x56, 0xEF, 0xC0, 0x0F, 0xE0, 0x03, 0xFE, 0x00, 0xBF, 0x00,
-    0x07, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x01, 0xFC,
-    0x03, 0xF0, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0xFC, 0x01, 0xF8,
-    0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x1F, 0x80, 0x02, 0xFD, 0x00, 0x3F, 0x00, 0x2F,
-    0xF4, 0x00, 0xFF, 0x47, 0xEB, 0xC0, 0x01, 0xFF, 0xFE, 0x3F, 0x00, 0x01, 0xFF, 0xD0, 0xF8, 0x00,
-    0x00, 0x10, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x03, 0xF9, 0x6F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0x0A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFA, 0xAB, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x18,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xAA, 0xA4, 0x1F, 0xC0, 0x00, 0xFF, 0xFE, 0x0B,
-    0xE0, 0x00, 0x3F, 0xFF, 0x42, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x2F,
-    0x80, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x3F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xE5, 0x5B, 0xF8, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xF0, 0x00,
-    0x7F, 0xFF, 0xC7, 0xC0, 0x03, 0xFD, 0x5B, 0xBF, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x02, 0xFC, 0x00,
-    0x1F, 0xD0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x07, 0xF0,
-    0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x00, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0x0B, 0xF4, 0x00, 0xFC, 0x00, 0xBF,
-    0xD0, 0x03, 0xFD, 0x1F, 0xAF, 0x00, 0x07, 0xFF, 0xF8, 0xFC, 0x00, 0x07, 0xFF, 0x43, 0xE0, 0x00,
-    0x00, 0x40, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x02, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE5, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x00, 0x2B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x41,
-    0xF0, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0,
-    0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x01, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0xAA, 0xAA, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0,
-    0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xBF, 0xE0, 0x00, 0xBD,
-    0x7F, 0xFF, 0x80, 0x0F, 0xDF, 0x96, 0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xD0, 0x0F, 0xF0, 0x00, 0xBD,
-    0x01, 0xFD, 0x00, 0x0B, 0xD0, 0x2F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x07, 0xD0, 0x2F, 0x40, 0x00,
-    0xBD, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC2, 0xAF, 0xEA, 0xAA, 0xAB, 0xFE, 0x90, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xEA, 0xAA, 0xAF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x16,
-    0xFD, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF9, 0x00, 0x0B, 0xC3, 0xFF, 0xF4, 0x00, 0xFC,
-    0xFE, 0xBF, 0xC0, 0x0F, 0xFD, 0x00, 0xFD, 0x00, 0xFF, 0x40, 0x0B, 0xD0, 0x1F, 0xD0, 0x00, 0xBD,
-    0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00,
-    0x01, 0xF8, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x40, 0x02, 0x00, 0x03, 0xFE, 0x02, 0xC0, 0x03,
-    0xFF, 0xFB, 0xF0, 0x00, 0xF0, 0x7F, 0xF0, 0x00, 0x74, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBE, 0x40,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x01, 0x80, 0x7F, 0xE0,
-    0x3C, 0x0F, 0xFF, 0xEF, 0x42, 0xE0, 0xBF, 0xF0, 0x28, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xBE, 0x40,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x06,
-    0xAA, 0xA9, 0x0B, 0xFF, 0xFD, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00,
-    0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B,
-    0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F, 0xEB, 0xF8,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x06, 0x00, 0x0A, 0x02, 0xE0, 0x07, 0x80, 0x7F, 0xAF, 0xC0, 0x0B, 0xFF, 0xD0, 0x00, 0x6E, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x7F,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
-    0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F,
-    0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0xC0, 0x00, 0x3D,
-    0x00, 0x00, 0xF4, 0x00, 0x03, 0xFA, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2F, 0x90,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02,
-    0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0xBD, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF8, 0x02, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xE0, 0x07, 0xD0,
-    0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0x80, 0x2F, 0x40, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x0B, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x02, 0xF9, 0x00, 0x1F, 0x80, 0x00,
-    0x2F, 0x40, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0xBD, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x7E,
-    0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x80, 0x01, 0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x2F, 0x40, 0x0B, 0xFF, 0xFC, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x40, 0x00, 0xFC,
-    0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xBD, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x01,
-    0xF8, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x1F,
-    0x40, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0xBC, 0x00, 0x2F, 0x40, 0x0F, 0xC0,
-    0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x67, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xE3, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x25, 0x7F, 0xC0,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x02,
-    0xF5, 0xF4, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x02, 0xE0, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x9B, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00,
-    0x3F, 0x40, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0x3F, 0x80,
-    0x00, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF4, 0x00,
-    0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x00,
-    0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x1F, 0x47, 0xF0, 0x00, 0x02, 0xF1, 0xFC, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0B, 0xF8, 0xFC, 0x00, 0x00,
-    0xBD, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x0F,
-    0xC0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x01, 0xF8, 0x1F, 0xC0, 0x00, 0x1F, 0x47, 0xF0, 0x00, 0x02, 0xF0,
-    0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x0B, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x02,
-    0xF4, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x03,
-    0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07,
-    0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA7,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1A, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x03,
-    0xF0, 0x07, 0xC0, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0xBD, 0x01, 0xE0, 0x00, 0x2F, 0x00, 0xA0, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xEA, 0xAA, 0xA0, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x50,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0xFC, 0x3F, 0x00, 0x07, 0xE1, 0xF0, 0x00, 0x2F, 0x4F, 0x40, 0x00,
-    0xBC, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF0, 0x01, 0x40, 0x3F, 0x00, 0xBE, 0x03, 0xE0, 0x0F, 0xE0, 0x7E, 0x00, 0xBC, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F,
-    0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x14, 0x00, 0xF8, 0xBE, 0x01, 0xF4, 0xFE, 0x02, 0xF4, 0x7C, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0B, 0xD1, 0xC0, 0x00, 0xFD, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x23, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x2F,
-    0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00,
-    0x0F, 0xED, 0x00, 0xFF, 0xD0, 0x2F, 0xF0, 0x0B, 0xF4, 0x07, 0xFF, 0x00, 0xBF, 0xF0, 0x01, 0x7E,
-    0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xD0, 0x03,
-    0xFD, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xF0,
-    0x03, 0xF7, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x2F, 0x00, 0x02,
-    0xF0, 0x01, 0xF4, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x02, 0xF4,
-    0x01, 0xF8, 0x00, 0xFC, 0x03, 0xE0, 0x0B, 0xD0, 0x03, 0xE0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40,
-    0x1F, 0x40, 0xFC, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xBC, 0x1F, 0x80, 0x0F,
-    0x80, 0x01, 0xF8, 0xBD, 0x00, 0x7E, 0x00, 0x03, 0xF2, 0xF0, 0x02, 0xF4, 0x00, 0x0B, 0xDF, 0xC0,
-    0x0B, 0xC0, 0x00, 0x0F, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x7F,
-    0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x7C, 0x0F, 0xFE, 0x00, 0x0B, 0xC7, 0xFF, 0xFC, 0x00, 0xFD, 0xFD, 0x6F, 0xD0, 0x0F,
-    0xFD, 0x00, 0xFD, 0x01, 0xFF, 0x00, 0x0B, 0xE0, 0x2F, 0xD0, 0x00, 0xBD, 0x03, 0xFC, 0x00, 0x0F,
-    0xD0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x02, 0xF8, 0x0B, 0xE0,
-    0x00, 0x2F, 0x40, 0xFD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xF0,
-    0x1F, 0x80, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xFD,
-    0x00, 0x00, 0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x03,
-    0xF7, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x2F, 0x00, 0x02, 0xF0,
-    0x01, 0xF4, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x02, 0xF4, 0x01,
-    0xF8, 0x00, 0xFC, 0x03, 0xE0, 0x0B, 0xD0, 0x03, 0xE0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x1F,
-    0x40, 0xFC, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xBC, 0x1F, 0x80, 0x0F, 0x80,
-    0x01, 0xF8, 0xBD, 0x00, 0x7E, 0x00, 0x03, 0xF2, 0xF0, 0x02, 0xF4, 0x00, 0x0B, 0xDF, 0xC0, 0x0B,
-    0xC0, 0x00, 0x0F, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x07, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07,
-    0xC0, 0xFF, 0xE0, 0x00, 0xBC, 0x7F, 0xFF, 0xC0, 0x0F, 0xDF, 0xD6, 0xFD, 0x00, 0xFF, 0xD0, 0x0F,
-    0xD0, 0x1F, 0xF0, 0x00, 0xBE, 0x02, 0xFD, 0x00, 0x0B, 0xD0, 0x3F, 0xC0, 0x00, 0xFD, 0x03, 0xF4,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x02, 0xF4,
-    0x0F, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xF8, 0x00,
-    0x0B, 0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x40, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xFD,
-    0x00, 0x00, 0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x03,
-    0xF7, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x2F, 0x00, 0x02, 0xF0,
-    0x01, 0xF4, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x02, 0xF4, 0x01,
-    0xF8, 0x00, 0xFC, 0x03, 0xE0, 0x0B, 0xD0, 0x03, 0xE0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x1F,
-    0x40, 0xFC, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xBC, 0x1F, 0x80, 0x0F, 0x80,
-    0x01, 0xF8, 0xBD, 0x00, 0x7E, 0x00, 0x03, 0xF2, 0xF0, 0x02, 0xF4, 0x00, 0x0B, 0xDF, 0xC0, 0x0B,
-    0xC0, 0x00, 0x0F, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x07, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x90, 0x00,
-    0xA0, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x7C, 0x0F, 0xFE, 0x00, 0x02, 0xF1, 0xFF, 0xFF, 0x00, 0x0F, 0xDF, 0xD6, 0xFD,
-    0x00, 0x3F, 0xF4, 0x03, 0xF4, 0x01, 0xFF, 0x00, 0x0B, 0xE0, 0x0B, 0xF4, 0x00, 0x2F, 0x40, 0x3F,
-    0xC0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00,
-    0xBE, 0x00, 0xBE, 0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x01, 0xFC, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x3F, 0x40,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x04, 0x00, 0x3F, 0x0F, 0xC1, 0xFF, 0xD0, 0x7C, 0x0F, 0x8F, 0xFF, 0xF4,
-    0x14, 0x1F, 0xBF, 0x97, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xFC, 0x00,
-    0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0xBE,
-    0x00, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x07, 0xF0, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xFD, 0x00, 0x00,
-    0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF7, 0xE0,
-    0x00, 0x1F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x2F, 0x40, 0x02, 0xF0, 0x01, 0xF4,
-    0x3E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x01, 0xF4, 0x01, 0xF8, 0x00,
-    0xFC, 0x03, 0xF0, 0x0B, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x3F, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0xFC,
-    0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xBD, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0xF8,
-    0xBD, 0x00, 0x7E, 0x00, 0x02, 0xF2, 0xF0, 0x02, 0xF4, 0x00, 0x07, 0xDF, 0xC0, 0x0B, 0xC0, 0x00,
-    0x0F, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xD0,
-    0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x6F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xBF, 0xE0, 0x00, 0xBC, 0x7F, 0xFF,
-    0x80, 0x0F, 0xDF, 0x96, 0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xD0, 0x0F, 0xF0, 0x00, 0xBD, 0x01, 0xFD,
-    0x00, 0x0B, 0xD0, 0x2F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x07, 0xE0, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0xBD, 0x02,
-    0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x02, 0x6F, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x02,
-    0xFA, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x2F,
-    0xC7, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA8, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFD, 0x5F, 0xF0, 0x03, 0xF8, 0x00,
-    0xBE, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x01, 0xF8, 0x7E,
-    0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x1F, 0xC0,
-    0x1F, 0xE4, 0x6F, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x28, 0x00, 0x00, 0x0B, 0x80, 0x1E, 0x00, 0x00, 0x01, 0xFE, 0xBF,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x9B, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0x01, 0xFC,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x01, 0xFC,
-    0xBE, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x03, 0xF7,
-    0xF0, 0x00, 0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xAF,
-    0x80, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x00, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x7F,
-    0x80, 0x00, 0xFF, 0x40, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x19, 0x00, 0x03, 0xC0,
-    0x0F, 0x00, 0x00, 0xFE, 0xAF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x7F, 0xD5, 0xFF, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x3F,
-    0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00,
-    0x3F, 0x1F, 0x80, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x02, 0xF8, 0x0F, 0xD0, 0x01, 0xFC, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x02, 0xA0, 0x00, 0x00,
-    0x01, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00,
-    0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x38, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0xA6, 0xFF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFD, 0x00,
-    0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x03, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x1F,
-    0xC2, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00,
-    0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x2F,
-    0xF9, 0x5B, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x81, 0xA4, 0x00, 0x00, 0xBD, 0x0F, 0xC0,
-    0x00, 0x07, 0xD0, 0xFC, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x2D,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xF5, 0x7F, 0xC0, 0x00, 0xFE, 0x00, 0x2F, 0x80, 0x0B,
-    0xE0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x07, 0xE0,
-    0x1F, 0x80, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x03, 0xF4,
-    0x00, 0x7F, 0x00, 0x07, 0xF9, 0x1B, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFA, 0x6B,
-    0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xEA, 0xAA, 0x80, 0x7F, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x7E, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x57, 0xFE, 0xAA, 0xA9, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0xFF,
-    0xFF, 0x00, 0x3F, 0xD5, 0xFF, 0x2F, 0xD5, 0xFE, 0x03, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0xFC, 0x2F,
-    0x80, 0x00, 0xFF, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x0F,
-    0xE0, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x41, 0xBF, 0xE0, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFD,
-    0x07, 0xE0, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x1F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xE4, 0x6F, 0xCF, 0xE4, 0x1B, 0x80,
-    0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFD, 0x00, 0xBD, 0x00, 0x0B, 0xF0, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x07,
-    0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x55, 0xBF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x02, 0xF4, 0x00,
-    0x3F, 0x40, 0x3F, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0xFD, 0x0B,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0xF0, 0x00, 0xBC, 0x7F, 0xF0, 0x00, 0xFD, 0xFA, 0x90,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFD, 0x00, 0xBD,
-    0x00, 0x0B, 0xF0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F,
-    0x01, 0xF8, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x55,
-    0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0x40, 0x03,
-    0xF0, 0x02, 0xF4, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E,
-    0x00, 0x00, 0xFD, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x7F, 0xC0, 0x00, 0xBC, 0x7F, 0xF0, 0x00, 0x3F, 0x7E, 0xA4, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x60, 0x00, 0x02, 0xE0, 0x1F, 0x80, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0x07, 0xF4, 0x00, 0xBD, 0x00, 0x0B, 0xF0, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x07, 0xE0,
-    0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0xFD, 0x56, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x2F, 0x80, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x0B,
-    0xD0, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00,
-    0x0F, 0xD0, 0x2F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x03, 0xE0, 0x1F, 0x40,
-    0x00, 0x3D, 0x2F, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0xF0, 0x00, 0x2F, 0x1F,
-    0xFC, 0x00, 0x0F, 0xDF, 0xA9, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFA, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0x14, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x10, 0x00, 0x0B, 0xF0, 0x07, 0xE5, 0x5B, 0xFD, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0x80, 0x3F, 0x95, 0xBC, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x3D, 0x00, 0xBF, 0x40, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x0B, 0xD7, 0xD0, 0x00, 0x02, 0xF0, 0x1F, 0x00, 0x00, 0x78, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFA, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0x14, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x10,
-    0x00, 0x0B, 0xF0, 0x07, 0xE5, 0x5B, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x7E, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0x95, 0xBC, 0x02,
-    0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x3D, 0x00, 0xBF, 0x40,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xAB, 0xF8, 0x00, 0xBF,
-    0x00, 0x01, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x01, 0x00, 0x00, 0xBF, 0x00, 0x7E,
-    0x55, 0xBF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xE0, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xE0, 0x3F, 0x95, 0xBC, 0x0B,
-    0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0xF4, 0x02, 0xFD, 0x0F, 0xFF, 0xFF, 0x80,
-    0x7F, 0xFF, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x01, 0x90, 0x01, 0x90, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFA,
-    0xBF, 0x80, 0x0B, 0xF0, 0x00, 0x14, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x10, 0x00,
-    0x0B, 0xF0, 0x07, 0xE5, 0x5B, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x18, 0x00, 0x2E, 0x01, 0xF8, 0x00, 0x0F, 0x87,
-    0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xE0, 0x03, 0xF9, 0x5B,
-    0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0xF4, 0x02, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x1B, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFC, 0x17, 0xF5, 0x54, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B,
-    0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x40,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x41, 0x00, 0x2F, 0xFF, 0x00,
-    0x0B, 0xFF, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF4, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x24, 0x00, 0x28, 0x00,
-    0x0F, 0x80, 0x7D, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0xF4, 0x00, 0x1D, 0x3E, 0x00, 0x03, 0xC7, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1B,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x17, 0xF5, 0x54, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x10, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x05,
-    0x5F, 0xD5, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0xC0, 0x5F, 0xD5, 0x50, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xBF,
-    0xAA, 0x00, 0xFF, 0xFF, 0xC0, 0x2B, 0xFA, 0xA0, 0x01, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x41, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00,
-    0x0F, 0xF8, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0x80, 0x00, 0x07, 0x82, 0xFF, 0xC0, 0x00, 0x01,
-    0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x40,
-    0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00,
-    0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00,
-    0x0B, 0xD0, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00,
-    0x7E, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x07,
-    0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF5, 0x5B, 0xFC,
-    0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x80, 0x00, 0x3F, 0xE0, 0x2C, 0x00, 0x0F, 0xFF, 0xEF, 0xC0, 0x00,
-    0xF0, 0x7F, 0xF0, 0x00, 0x1D, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x1F, 0x80, 0x7E, 0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x03,
-    0xF0, 0x02, 0xFF, 0x40, 0x3F, 0x81, 0xFA, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x0B, 0xFF, 0x43,
-    0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xBD,
-    0x02, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x1F, 0x80, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x0B,
-    0xD0, 0x00, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x01, 0xF8,
-    0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
-    0x55, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x01,
-    0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8,
-    0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC,
-    0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0x81,
-    0xFA, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x60, 0x00, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFA, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-    0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x7E, 0x00,
-    0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00,
-    0x03, 0xFC, 0x00, 0x1F, 0xF5, 0x5B, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x00, 0x00, 0x3C, 0x00,
-    0xF0, 0x00, 0x03, 0xFA, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x01, 0xF4, 0x0B, 0xD0,
-    0x00, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x07, 0xE0,
-    0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00,
-    0x3F, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0x81, 0xFA, 0xF0, 0x01,
-    0xFF, 0xFE, 0x2F, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x00, 0x00, 0x74,
-    0x0E, 0x00, 0x00, 0x00, 0x1D, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x40, 0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x7E,
-    0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00,
-    0x7F, 0xD5, 0x6F, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFA, 0xF4, 0x00, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0x01, 0xD0, 0x3C, 0x00, 0x00, 0x0F, 0x07, 0x80,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F,
-    0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF,
-    0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0xBF,
-    0xF4, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x06, 0x80, 0x00, 0x00,
-    0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x02, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x01,
-    0xF8, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0,
-    0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0xF8,
-    0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x03,
-    0xF4, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x55, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x90, 0x68, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x00, 0x7D,
-    0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x02, 0x80, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x0B,
-    0xD0, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-    0x00, 0x7E, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x01,
-    0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0x00, 0x2F, 0xF4,
-    0x00, 0x3F, 0x81, 0xFA, 0xF0, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0,
-    0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E,
-    0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80,
-    0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80,
-    0x00, 0xFF, 0x00, 0x07, 0xFD, 0x56, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE4,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07,
-    0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4,
-    0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50,
-    0x0B, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0x1F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0B, 0xD1, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xEF, 0x00, 0x02, 0xF4,
-    0x0F, 0x80, 0x02, 0xF7, 0xD0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0xF8, 0xF4, 0x00, 0x7E, 0x00, 0xF8,
-    0x00, 0x7C, 0x3D, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x0F, 0x40, 0x1F, 0x80, 0x0F, 0xC0, 0x1F,
-    0x43, 0xD0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0xF4, 0x03, 0xF0, 0x00, 0xFC, 0x07, 0xD0, 0x3E,
-    0x02, 0xF4, 0x00, 0x3F, 0x03, 0xF0, 0x0F, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0xF4, 0x03, 0xE0, 0x7D,
-    0x00, 0x03, 0xF0, 0xBC, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x3E, 0x1F, 0x40, 0x00,
-    0x3F, 0x2F, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x0B, 0xCF, 0x80, 0x02, 0xF3, 0xE0, 0x00, 0x02, 0xF7,
-    0xC0, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xF0,
-    0x00, 0x3F, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xD0, 0xFC,
-    0x00, 0xBB, 0xD0, 0x03, 0xF0, 0x3F, 0x00, 0x3D, 0xF4, 0x02, 0xF4, 0x0F, 0xC0, 0x2F, 0x3D, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0x4F, 0x40, 0xBD, 0x00, 0xFC, 0x0B, 0xC3, 0xD0, 0x3F, 0x00, 0x3F, 0x03,
-    0xE0, 0xF8, 0x1F, 0x40, 0x0B, 0xC1, 0xF0, 0x3E, 0x0F, 0xC0, 0x02, 0xF0, 0xF8, 0x0F, 0x87, 0xE0,
-    0x00, 0xBC, 0x7C, 0x03, 0xE2, 0xF0, 0x00, 0x2F, 0x3E, 0x00, 0xB8, 0xF8, 0x00, 0x0B, 0xCF, 0x00,
-    0x2E, 0xBC, 0x00, 0x02, 0xFB, 0x80, 0x0B, 0xBE, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x40, 0x00,
-    0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00,
-    0x7D, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0,
-    0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x1F, 0x80,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x07, 0xD3,
-    0xF0, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFC, 0x7C, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00,
-    0xF8, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00,
-    0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00,
-    0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF1, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0x5B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x02, 0xF0, 0x2F,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF8, 0xBD, 0x00, 0x00, 0x3F,
-    0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x2F, 0x40,
-    0x0F, 0xD0, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00,
-    0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xAA, 0xAA,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x01, 0x55, 0x6F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xEA,
-    0xAA, 0xAA, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x15, 0x56, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x18, 0x00, 0x19, 0x00, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xBC,
-    0x7F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xAA, 0xAA, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0x40, 0x02, 0x40, 0x00,
-    0xF4, 0x0B, 0xC0, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x01, 0x55, 0x6F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x26, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x68, 0x07, 0xE0, 0x3F, 0x00, 0xF8, 0x07, 0xC0, 0x1D, 0x00, 0x69, 0x01, 0xFC,
-    0x03, 0xF0, 0x0F, 0xC0, 0x2F, 0x00, 0x78, 0x00, 0x00, 0x29, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF8,
-    0x02, 0xF5, 0xF4, 0x3F, 0x02, 0xF2, 0xE0, 0x02, 0xD0, 0x01, 0x40, 0x06, 0x07, 0xFE, 0x03, 0xC3,
-    0xFF, 0xFB, 0xE1, 0xE0, 0xBF, 0xF0, 0xB0, 0x02, 0xE0, 0x00, 0x1A, 0xAA, 0xA0, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC1, 0x55, 0x55,
-    0x54, 0x60, 0x00, 0xAB, 0x80, 0x2E, 0x7F, 0xAF, 0xC2, 0xFF, 0xF4, 0x06, 0xE8, 0x00, 0x14, 0x7E,
-    0xBE, 0x7C, 0x00, 0x04, 0x00, 0x47, 0xD0, 0x7D, 0xBD, 0x0B, 0xD7, 0xC0, 0x78, 0x15, 0x01, 0xFF,
-    0x46, 0x6F, 0x00, 0x3D, 0x02, 0xF0, 0xBF, 0x43, 0xD0, 0x1E, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x3E, 0xBD, 0x78, 0x0F, 0x74, 0x0F, 0x3C, 0x1E, 0x2F, 0xFC, 0x06, 0xE0, 0x00, 0xA4, 0x1A,
-    0x00, 0xFC, 0x1F, 0xC0, 0xBD, 0x0F, 0xC0, 0x7D, 0x0F, 0xC0, 0x7C, 0x0B, 0x80, 0x28, 0x03, 0x80,
-    0x00, 0x64, 0x00, 0x64, 0xF4, 0x0B, 0xC2, 0xF0, 0xFC, 0x03, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0x40, 0xBC, 0x0B, 0xC0, 0xF8, 0x0F, 0x41, 0xF4, 0x2F, 0x03, 0xF0, 0x3E, 0x01,
-    0x40, 0x05, 0x01, 0x41, 0xF0, 0x7D, 0x2F, 0x0B, 0xC3, 0xF0, 0xBC, 0x3E, 0x0F, 0x87, 0xD0, 0xF4,
-    0x00, 0x00, 0x00, 0x29, 0x06, 0x90, 0x3F, 0x07, 0xF0, 0x1F, 0x82, 0xF0, 0x0B, 0xC0, 0xF8, 0x03,
-    0xE0, 0x3D, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x60, 0x60, 0xA1, 0xE0, 0x07, 0xC3, 0xFA, 0xFD, 0x0B, 0xFF, 0xD0, 0x06, 0xE8, 0x00, 0x00, 0x69,
-    0x00, 0x1F, 0xFF, 0x41, 0xFF, 0xFF, 0x0F, 0x40, 0x3C, 0x38, 0x00, 0x70, 0x00, 0xB4, 0x07, 0xC0,
-    0x3E, 0x02, 0xF0, 0x0F, 0xC0, 0xBD, 0x07, 0xF0, 0x2F, 0x80, 0x54, 0x00, 0x02, 0xF4, 0x0F, 0xC0,
-    0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xBC, 0x03, 0xD0, 0x2F, 0x00, 0x50, 0x00, 0x3E, 0x0F, 0xC3, 0xF0,
-    0xFC, 0x3F, 0x0B, 0xC1, 0xF0, 0x7C, 0x05, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F,
-    0x80, 0xBC, 0x03, 0xD0, 0x2F, 0x00, 0x50, 0x00, 0x2A, 0x00, 0xBD, 0x00, 0xFC, 0x01, 0xF4, 0x02,
-    0xF0, 0x02, 0xD0, 0x00, 0xA8, 0x03, 0xF8, 0x0B, 0xE0, 0x1F, 0x80, 0x3E, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x78, 0x7F, 0xF8, 0xBF, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x40, 0x00,
-    0x00, 0x0F, 0x40, 0x0F, 0x00, 0x1F, 0xFD, 0x2F, 0xFD, 0x2D, 0x00, 0x3C, 0x00, 0x14, 0x00, 0x15,
-    0x55, 0x57, 0xFF, 0xFF, 0x6A, 0xAB, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B,
-    0x80, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0x00, 0xA0, 0x00, 0x15, 0x00, 0xBE, 0x00, 0xFD, 0x01, 0xFC,
-    0x03, 0xF4, 0x2F, 0xD0, 0x3E, 0x00, 0x10, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0xF0, 0x74, 0x1E, 0x03,
-    0xE0, 0x24, 0x00, 0x50, 0x01, 0xF0, 0x01, 0xE0, 0x02, 0xD0, 0x7F, 0xFE, 0x7F, 0xFD, 0x15, 0x54,
-    0xBF, 0xFD, 0xAF, 0xE8, 0x0B, 0x40, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x1F,
-    0x00, 0xAF, 0xE8, 0x3F, 0xFF, 0x05, 0xF5, 0x00, 0x3C, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xBF, 0xFE, 0x00, 0x15, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF8,
-    0x6B, 0xF0, 0x7F, 0xE0, 0x7F, 0x40, 0x05, 0x40, 0x3E, 0x01, 0xF4, 0x0B, 0xC0, 0x3F, 0x00, 0xFC,
-    0x03, 0xE0, 0x0F, 0xE9, 0x2F, 0xF4, 0x2F, 0xC0, 0x3C, 0xFD, 0xFD, 0x78, 0x04, 0x00, 0x43, 0xF0,
-    0x3F, 0x3F, 0x03, 0xF2, 0xD0, 0x2D, 0x00, 0x00, 0x0B, 0xF8, 0x3E, 0xBE, 0x38, 0x0F, 0x78, 0x0F,
-    0x3C, 0x1F, 0x2F, 0xFD, 0x06, 0xE0, 0x07, 0xE0, 0xBC, 0x0F, 0x42, 0xE0, 0x7C, 0x01, 0x00, 0x02,
-    0xD0, 0x0F, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0xBC, 0x03, 0xE7, 0xFF, 0x1F, 0xE0, 0x03, 0xC1, 0xF0,
-    0x3C, 0x0B, 0x80, 0xB8, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x05, 0x43, 0xE0, 0xF4, 0x7C, 0x2F, 0x0F,
-    0xC3, 0xE1, 0xF4, 0x7C, 0x15, 0x00, 0x05, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFE, 0x1F, 0xAA, 0xAB,
-    0xE2, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x7C, 0x14, 0x00, 0x01, 0x00, 0x74,
-    0x0E, 0x02, 0xC7, 0x42, 0xF0, 0x7C, 0x3F, 0xFF, 0xFF, 0x01, 0xFD, 0x2F, 0x80, 0xA0, 0x00, 0x62,
-    0xF0, 0x0F, 0x83, 0xE1, 0xF8, 0x07, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x69,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xF2, 0xF0, 0x3E, 0x03, 0xF2, 0xD0, 0x02, 0xC0, 0xA0,
-    0x00, 0x9F, 0x40, 0x3D, 0xBE, 0xAF, 0xC3, 0xFF, 0xF0, 0x06, 0xE4, 0x00, 0x00, 0x69, 0x00, 0x2F,
-    0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0x40, 0x3C, 0x34, 0x00, 0xB0, 0x01, 0x40, 0x02, 0x03, 0xFE, 0x03,
-    0xC3, 0xFF, 0xFB, 0xE1, 0xE0, 0xBF, 0xF0, 0xB0, 0x02, 0xA0, 0x00, 0x2A, 0xAA, 0xA3, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAA, 0xAA, 0xAA, 0x8B, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x50, 0x00, 0x50, 0x01,
-    0x40, 0xBF, 0xD0, 0x38, 0x0F, 0xFF, 0xEF, 0x42, 0xD0, 0xBF, 0xE0, 0x38, 0x01, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x54, 0x2A, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x1F, 0xE0, 0x0B, 0xF8, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x7E, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x41, 0xF0, 0x2D, 0x0B, 0x47, 0xCF, 0xD2, 0x40, 0x05, 0x00, 0x00, 0x50, 0xF0, 0x00, 0x1E,
-    0x1F, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x3D, 0x3F, 0xAA, 0xAB, 0xC3, 0xFF, 0xFF, 0xFC, 0x15, 0x55,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x0F, 0xAA, 0xAB, 0xD0, 0xE0, 0x00, 0x3C,
-    0x1D, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x78, 0x3F, 0xFF, 0xFF, 0x42, 0xAA, 0xAA, 0xA0, 0x07, 0xF4,
-    0xBE, 0x0B, 0xEF, 0xFB, 0xE7, 0x81, 0xF0, 0x3E, 0xC0, 0x34, 0x0E, 0x08, 0x08, 0x2F, 0x3E, 0x0F,
-    0xF8, 0x0B, 0xF0, 0x1F, 0xF0, 0x7D, 0xFC, 0x20, 0x20, 0x00, 0x6C, 0x02, 0xFC, 0x07, 0xC0, 0x0B,
-    0x80, 0x07, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xE0, 0x2F, 0xC0, 0x29, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0xAA, 0xAA, 0x8B, 0xFF, 0xFF, 0xFE, 0x15, 0x55, 0x55, 0x50, 0x29, 0x00, 0xFC, 0x01, 0xF8,
-    0x02, 0xF0, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0xA8, 0x03, 0xF8, 0x0B, 0xE0, 0x1F, 0x80, 0x3E, 0x00,
-    0xB4, 0x00, 0x01, 0x50, 0x02, 0x43, 0xFF, 0x42, 0xD2, 0xFF, 0xFE, 0xF0, 0xF0, 0x7F, 0xF4, 0x34,
-    0x01, 0xA4, 0x00, 0xBE, 0x3F, 0xE0, 0xF8, 0x2E, 0x1F, 0x06, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0x0B,
-    0xE1, 0x07, 0xD3, 0xF3, 0xF2, 0xF6, 0xF4, 0xFC, 0x78, 0xF4, 0x3D, 0x00, 0x78, 0x00, 0x00, 0x14,
-    0x03, 0xE0, 0x7D, 0x0B, 0xD0, 0xBF, 0xC2, 0xF8, 0x05, 0x55, 0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xAA, 0xAA, 0xBC, 0x3D, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0xF4,
-    0x10, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x15, 0x55, 0x55, 0x50, 0x05, 0x01, 0x50, 0xF8, 0x3E, 0x1F, 0x43, 0xD1, 0xF0, 0x7D, 0x2F, 0x0B,
-    0xC3, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF4,
-    0x00, 0xF0, 0x00, 0x01, 0x40, 0x00, 0x05, 0x3C, 0x14, 0x07, 0xFF, 0x83, 0x80, 0xFF, 0xFE, 0xF4,
-    0x2D, 0x2F, 0xFE, 0x03, 0x87, 0x9A, 0x40, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x0B, 0xF4, 0x0B, 0x0B, 0xFF,
-    0x9B, 0xC3, 0xD7, 0xFF, 0xD2, 0xD0, 0x1F, 0xD0, 0x00, 0x24, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x50, 0x01, 0x42, 0xFF, 0x82, 0xD1, 0xFB, 0xFF, 0xF0, 0xF0,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x03, 0x83, 0xFF, 0xD7, 0xD1, 0xE5, 0xFF, 0xE0, 0xB0,
-    0x06, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00, 0xB0, 0x2D, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF8,
-    0x0F, 0x81, 0xF4, 0x00, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xBE, 0x0B,
-    0xFD, 0x07, 0xC0, 0x2E, 0x00, 0xF4, 0x03, 0xC0, 0xBF, 0xC0, 0x2F, 0xF8, 0x03, 0xFE, 0xFF, 0xD0,
-    0x2F, 0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x53, 0xC5, 0x00, 0x0F, 0x50, 0x00, 0xB2, 0x8E, 0x00, 0x05, 0x00, 0x0E, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x09, 0x00, 0x50, 0x70,
-    0x00, 0x00, 0x0E, 0x05, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x90, 0x00, 0x00, 0x03, 0x0F,
-    0xF0, 0xD0, 0x00, 0x00, 0x07, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x70, 0x00, 0x00,
-    0x0E, 0x0A, 0x00, 0x70, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB1, 0x4E, 0x00, 0x00, 0xF0, 0x00, 0x63, 0xC9, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0x00, 0x0F, 0x40, 0xBF, 0x40, 0xBE, 0x0B, 0xEB,
-    0xF8, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE3, 0xE2, 0xD0, 0xB0, 0x2D, 0x03, 0xD0, 0x60, 0x00, 0x00,
-    0x00, 0x6F, 0xF0, 0x1F, 0xFF, 0xC3, 0xE5, 0x7E, 0xB8, 0x00, 0xE5, 0x0B, 0x05, 0x02, 0xF8, 0x00,
-    0x2F, 0x80, 0x01, 0xE0, 0x00, 0x08, 0x20, 0x3E, 0xFC, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xF8, 0x1D,
-    0x38, 0x00, 0x00, 0x00, 0x50, 0x7E, 0x7F, 0x8F, 0xC0, 0xBF, 0x40, 0xBE, 0x00, 0xA0, 0x20, 0x00,
-    0xF8, 0x01, 0xFE, 0x00, 0xBD, 0x0B, 0xF4, 0xFD, 0x03, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x40,
-    0x3F, 0x03, 0xFD, 0x0F, 0xC0, 0x1F, 0x8B, 0xB8, 0x1F, 0xE3, 0xCF, 0x2F, 0x81, 0xE2, 0xDA, 0x00,
-    0xB0, 0x38, 0x04, 0x03, 0xC0, 0xB8, 0x0F, 0x03, 0xC2, 0xE3, 0xF0, 0x90, 0x14, 0xBE, 0xFE, 0x7C,
-    0x00, 0x01, 0x90, 0x00, 0x74, 0x02, 0xEE, 0xE0, 0xBF, 0xF8, 0x07, 0xF4, 0x03, 0xDF, 0x00, 0x62,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xBF, 0x47, 0xEB, 0xFE, 0xF6, 0xC0, 0xB8, 0x0F, 0xF0, 0x1D,
-    0x03, 0xEC, 0x0B, 0x80, 0xF7, 0xEF, 0xFE, 0xF4, 0x7F, 0x8B, 0xF4, 0x00, 0x00, 0xE0, 0x07, 0x40,
-    0x2F, 0xFC, 0xFF, 0xF0, 0x03, 0x80, 0x1D, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x29, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x7F,
-    0xC0, 0x03, 0xFF, 0xFA, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x6A,
-    0xA4, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x29, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xE4, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFF, 0xFA, 0xFF, 0xFE,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xAA, 0xA4, 0x00, 0x00, 0x2A, 0xAA, 0xAA,
-    0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x6A, 0xAA, 0xAA, 0xAA, 0x6F,
-    0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x15, 0x50, 0x00, 0x00, 0x01, 0x80, 0x2F,
-    0xFF, 0xF9, 0x00, 0x00, 0x3C, 0x0F, 0xFA, 0xFF, 0xFF, 0xA5, 0xAF, 0x42, 0xF0, 0x00, 0x1B, 0xFF,
-    0xFF, 0xD0, 0x28, 0x00, 0x00, 0x01, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x40, 0x00, 0x1F,
-    0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x68, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF2, 0x03, 0x83, 0xC2, 0x80, 0xE0, 0xD0, 0x34, 0x30, 0x1C, 0x0C, 0x0F, 0x03, 0xEE, 0x80, 0x14,
-    0x00, 0x07, 0xE0, 0xB0, 0xE3, 0x03, 0x6E, 0xF4, 0xA0, 0x02, 0xC0, 0x03, 0xAA, 0x01, 0x50, 0x01,
-    0x00, 0xD0, 0x00, 0x18, 0x0D, 0x03, 0x01, 0xC0, 0xB0, 0x38, 0x0D, 0x01, 0x00, 0x02, 0xF4, 0x0E,
-    0x0D, 0x38, 0x0A, 0x34, 0x0A, 0x30, 0x0D, 0x34, 0x1C, 0x2E, 0xB4, 0x01, 0x40, 0x0C, 0x03, 0x07,
-    0x01, 0xC2, 0xC0, 0xA0, 0xE0, 0x34, 0x34, 0x1C, 0x0C, 0x0F, 0x03, 0xAE, 0x80, 0x14, 0x00, 0x02,
-    0xF4, 0x74, 0x03, 0x80, 0x0C, 0x00, 0x70, 0x01, 0xC0, 0x03, 0xEA, 0x01, 0x50, 0x00, 0x01, 0x80,
-    0x00, 0xA0, 0x00, 0x34, 0x0B, 0x9C, 0x0D, 0x0F, 0x0E, 0x03, 0x83, 0x00, 0xD1, 0xC0, 0x70, 0x70,
-    0x3C, 0x0F, 0xBA, 0x00, 0x50, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x0D, 0xBC, 0x1F, 0x4A,
-    0x1C, 0x0A, 0x28, 0x0D, 0x34, 0x0C, 0x30, 0x1C, 0x70, 0x2C, 0x00, 0x10, 0x08, 0xF8, 0x7D, 0x1E,
-    0x0E, 0x4B, 0x2C, 0x0E, 0x07, 0x34, 0x1C, 0x0A, 0x30, 0x2C, 0x0D, 0x70, 0x38, 0x0C, 0xA0, 0x34,
-    0x1C, 0x40, 0x10, 0x04, 0x09, 0xB8, 0x3D, 0x00, 0xD0, 0x07, 0x00, 0x28, 0x00, 0xD0, 0x03, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0xD0, 0x7F, 0xC1, 0xC0, 0x28, 0x03, 0x40, 0x30, 0x07, 0x00, 0x39, 0x01,
-    0x50, 0x60, 0x0C, 0x70, 0x28, 0x30, 0x70, 0x30, 0xD0, 0x36, 0xC0, 0x37, 0x40, 0x2E, 0x00, 0x04,
-    0x00, 0x09, 0x06, 0x02, 0xC7, 0x00, 0x3B, 0x00, 0x0B, 0x00, 0x07, 0xD0, 0x03, 0x5C, 0x03, 0x43,
-    0x41, 0x40, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xA4, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xF0, 0x00, 0x00, 0xFC, 0x2F,
-    0x40, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x00, 0xA0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xAA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xAA, 0xAA, 0x40, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC5, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x01, 0xFD, 0x01, 0xBF, 0x40, 0x2F, 0x40, 0x02, 0xFC, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFD, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0xBD, 0x00, 0x00, 0xFC,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x7F, 0x41, 0xF8, 0x15,
-    0x6F, 0xE0, 0x2F, 0x41, 0xFF, 0xFC, 0x03, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
-    0xFF, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0B, 0xFE, 0x96, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x04, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x95, 0x6D, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFE, 0x5A, 0xF8, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
-    0x01, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x55, 0xBF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4,
-    0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x02,
-    0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x7C, 0x00, 0xFC, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x25, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x03, 0xFA, 0x50, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x1B, 0xF4, 0x00, 0x01,
-    0xF4, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x1F,
-    0x80, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xF0, 0x2A, 0xFE,
-    0x00, 0x00, 0xBE, 0xAA, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xE5, 0x55, 0x57, 0xF5, 0x6F, 0xFC, 0x02, 0xF4, 0x00, 0x00,
-    0xFC, 0x00, 0x7F, 0x80, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0xFC, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0x82, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x3F,
-    0x00, 0x00, 0x2F, 0x40, 0x07, 0xF8, 0x1F, 0x80, 0x00, 0x0F, 0xEA, 0xAF, 0xF8, 0x0B, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x01, 0xFD, 0x40, 0x7F, 0xC0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xD0,
-    0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x0F, 0x80, 0xFC, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x03, 0xF0, 0x2F,
-    0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x07, 0xE0, 0x00,
-    0x3F, 0x40, 0x02, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBC, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x2F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xF4, 0x0F, 0xD0,
-    0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00,
-    0x02, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xE0, 0x00, 0x03, 0xFE, 0x00,
-    0x2F, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0xBD, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xBF,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0xC7, 0xE0, 0x02, 0xF4, 0x00, 0xBD,
-    0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0x3F, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0xFC, 0x03,
-    0xF0, 0x1F, 0x80, 0x07, 0xE0, 0x2F, 0x00, 0xBD, 0x00, 0x2F, 0x41, 0xF4, 0x02, 0xF0, 0x00, 0xFC,
-    0x0F, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x8B, 0xC0, 0x01, 0xF8, 0x00,
-    0xBD, 0x7D, 0x00, 0x0B, 0xD0, 0x02, 0xF7, 0xE0, 0x00, 0x3F, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0xF0, 0x00, 0x07, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x0B, 0xF8, 0x00, 0x00,
-    0xBD, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xA4, 0x00, 0xA4, 0x00, 0x00, 0x0F,
-    0xC0, 0x2F, 0x00, 0x00, 0x00, 0xBE, 0x5B, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x02, 0xF4, 0x00,
-    0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xC1, 0xF8, 0x00,
-    0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x56, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0xBD,
-    0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x1F,
-    0x80, 0x00, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x1F, 0x80, 0x00, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xFA, 0xAA, 0xAA, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0,
-    0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00,
-    0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA,
-    0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01,
-    0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x55,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xE0, 0x5B, 0xFC, 0x00,
-    0xBD, 0x00, 0x1F, 0xD0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00,
-    0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x3F,
-    0x00, 0x0B, 0xF4, 0x07, 0xFA, 0xAF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x2F, 0xFE, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0x40, 0x0B, 0xF8, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0xFE,
-    0x00, 0x3F, 0xAA, 0xBF, 0xE0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x2F,
-    0x40, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x00,
-    0x2F, 0x40, 0x7D, 0x00, 0x00, 0xFD, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x2F, 0xC0,
-    0x3F, 0x00, 0x02, 0xFD, 0x01, 0xFE, 0xAA, 0xBF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x7E,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0x80, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0xAF, 0xFA, 0xAA, 0xAA, 0xFF, 0xA0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA4, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xA4, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFD,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xD2, 0xF4, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x87, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xC0, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x7E, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x40, 0x2F, 0x40, 0x00,
-    0x00, 0xFE, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE5, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xAA, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x07, 0xE5, 0x56, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x07, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0xBD, 0x00, 0x02, 0xFF,
-    0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0xF8, 0x00, 0x7E, 0x00, 0x0F,
-    0xC7, 0xE0, 0x02, 0xF4, 0x00, 0xBD, 0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0x3F, 0x00,
-    0x3E, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x1F, 0x80, 0x07, 0xE0, 0x2F, 0x00, 0xBD, 0x00, 0x2F,
-    0x41, 0xF4, 0x02, 0xF0, 0x00, 0xFC, 0x0F, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0x3F, 0x00,
-    0x1F, 0x8B, 0xC0, 0x01, 0xF8, 0x00, 0xBD, 0x7D, 0x00, 0x0B, 0xD0, 0x02, 0xF7, 0xE0, 0x00, 0x3F,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xE0, 0x01, 0xFF, 0x40, 0x00,
-    0x1F, 0x80, 0x0B, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x2A, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF9, 0x5F, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0x40,
-    0x00, 0xBF, 0xF0, 0x00, 0xFC, 0x00, 0x07, 0xEF, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x3E, 0x00, 0x1F,
-    0x80, 0x03, 0xF1, 0xF8, 0x00, 0xBD, 0x00, 0x2F, 0x4B, 0xD0, 0x03, 0xF0, 0x01, 0xF8, 0x3F, 0x00,
-    0x0F, 0xC0, 0x0F, 0x80, 0xFC, 0x00, 0x3F, 0x00, 0xFC, 0x07, 0xE0, 0x01, 0xF8, 0x0B, 0xC0, 0x2F,
-    0x40, 0x0B, 0xD0, 0x7D, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x3F, 0x00,
-    0x0F, 0xC0, 0x07, 0xE2, 0xF0, 0x00, 0x7E, 0x00, 0x2F, 0x5F, 0x40, 0x02, 0xF4, 0x00, 0xBD, 0xF8,
-    0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x7F,
-    0xD0, 0x00, 0x07, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x07, 0xE0, 0x00, 0x3F,
-    0x40, 0x02, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBC, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x2F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xF4, 0x0F, 0xD0, 0x00,
-    0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0x80, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x7D, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x0A, 0xBF, 0x80, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0xBE, 0xF0, 0x00, 0x00, 0xFE, 0xF0, 0x03, 0xEB,
-    0xC0, 0x00, 0x0B, 0xCF, 0xC0, 0x0F, 0x9F, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x7D, 0x7C, 0x00, 0x02,
-    0xF1, 0xF4, 0x02, 0xF0, 0xF4, 0x00, 0x0F, 0x8B, 0xD0, 0x0F, 0xC3, 0xD0, 0x00, 0xBC, 0x3F, 0x00,
-    0x3F, 0x0F, 0x80, 0x03, 0xD0, 0xFC, 0x00, 0xF8, 0x3E, 0x00, 0x3F, 0x07, 0xE0, 0x07, 0xD0, 0xBC,
-    0x01, 0xF4, 0x1F, 0x40, 0x2F, 0x02, 0xF0, 0x0F, 0xC0, 0xBC, 0x00, 0xFC, 0x07, 0xC0, 0x7D, 0x03,
-    0xF0, 0x03, 0xE0, 0x1F, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3D, 0x1F, 0x00, 0x7E, 0x00, 0x7D,
-    0x00, 0xF4, 0xF8, 0x02, 0xF4, 0x02, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xFE,
-    0x00, 0x3F, 0x00, 0x3E, 0x00, 0x2F, 0xF0, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0xBF, 0x40, 0x07, 0xE0,
-    0x0B, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xFA, 0xAA, 0xAA, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x01, 0xF8,
-    0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xD0, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0xE5, 0xBF, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x40, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00,
-    0x3F, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x7F,
-    0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xD0,
-    0x0B, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x95, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xD0, 0x00, 0x01,
-    0xF8, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00,
-    0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00,
-    0x00, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x2F, 0x40,
-    0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE0,
-    0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x2F, 0xFE, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0B, 0xD0, 0x07,
-    0xFC, 0x00, 0xBC, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x1F,
-    0x80, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F,
-    0x40, 0x3E, 0x00, 0x1F, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0F, 0xEA,
-    0xA9, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0x96, 0xFC, 0x00, 0xBF,
-    0x80, 0x00, 0x10, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xE5, 0x5B, 0x40, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xEB,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xD0, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0x40, 0x00, 0x00,
-    0xF8, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x00,
-    0x07, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x05, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0x9B,
-    0xF6, 0xFF, 0x80, 0x07, 0xF8, 0x02, 0xF4, 0x07, 0xF4, 0x03, 0xF8, 0x00, 0xBD, 0x00, 0x7F, 0x02,
-    0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x7E, 0x00, 0x07, 0xE0,
-    0x00, 0xBD, 0x2F, 0x40, 0x02, 0xF4, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xC2, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x1F, 0x80, 0x02, 0xF8, 0x2F, 0x80, 0x07, 0xE0, 0x00,
-    0xFC, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0x0F, 0xFD,
-    0x7F, 0x5B, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0x80, 0x00, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x9F, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xF4,
-    0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x7E, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0,
-    0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x2F,
-    0x40, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x03,
-    0xF0, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xFA, 0xAA, 0xAA, 0xFE, 0xA0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0xFC, 0x00,
-    0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0xF8, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x0F, 0xC2,
-    0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3E, 0x00, 0x00,
-    0x3F, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3E, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x1F,
-    0xFA, 0xAF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00,
-    0x02, 0xF0, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B,
-    0xD0, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xF4, 0x02, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x1F, 0x80,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00,
-    0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x7E, 0x00, 0x00,
-    0xFC, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F,
-    0x80, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x02, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x01, 0xFE, 0xAA, 0xAB, 0xFA, 0xAA, 0xAF, 0xD0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x07,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0xBD,
-    0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x02, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00,
-    0xBD, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x00, 0x3F, 0x00,
-    0x00, 0xBD, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x01,
-    0xF8, 0x01, 0xFE, 0xAA, 0xAB, 0xFA, 0xAA, 0xAF, 0xFA, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F,
-    0xA5, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xF8, 0x06, 0xFE, 0x00,
-    0xBD, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x2F,
-    0x42, 0xF4, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF8, 0x0F, 0xC0, 0x02,
-    0xFC, 0x07, 0xFA, 0xAF, 0xFD, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0F,
-    0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xA5, 0x40, 0x00, 0x07, 0xE0, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0xBD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x1B, 0xF8,
-    0x00, 0xFC, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFD, 0x01, 0xF8, 0x00,
-    0xFC, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x1F, 0x80, 0x00, 0xFD, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x2F, 0x40, 0x01, 0xFC, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x7D, 0x00,
-    0x3F, 0x00, 0x0F, 0xF0, 0x0B, 0xD0, 0x07, 0xFA, 0xAF, 0xFC, 0x00, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xFA,
-    0x54, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xE0, 0x0B, 0xF8, 0x0B, 0xD0,
-    0x01, 0xFC, 0x0F, 0xC0, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0xBE, 0x1F, 0x80, 0x00, 0xBD, 0x1F, 0x40,
-    0x00, 0xFD, 0x2F, 0x40, 0x00, 0xFC, 0x3F, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x0B, 0xF0, 0x7F, 0xAA,
-    0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFE, 0x96, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x0A, 0xAA, 0xAB, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x7A, 0x55, 0xBF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0xE5, 0xBF, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0xE0, 0x00,
-    0xBF, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x1F,
-    0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xD0,
-    0x2F, 0x40, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x3F,
-    0xAA, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0xFC, 0x01, 0xFC,
-    0x00, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x41, 0xF8, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x00,
-    0x1F, 0xC0, 0x3F, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFE,
-    0x00, 0x7E, 0x00, 0x01, 0xFF, 0x55, 0xFF, 0xC0, 0x0B, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xD0, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
-    0x00, 0x00, 0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xF5, 0x5F,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0x02,
-    0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xBD, 0x00, 0x02, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0x7F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80, 0x03, 0xF8, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x7C, 0x00, 0x7F, 0xFF, 0x8B,
-    0xC0, 0x1F, 0xF5, 0x7D, 0xF8, 0x03, 0xF4, 0x00, 0xFF, 0x40, 0xBE, 0x00, 0x0B, 0xF0, 0x0F, 0xC0,
-    0x00, 0x7F, 0x02, 0xF8, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0,
-    0x7E, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x02, 0xF8, 0x0B, 0xD0, 0x00,
-    0x3F, 0x40, 0xBE, 0x00, 0x0F, 0xF4, 0x07, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0x81, 0xFA, 0xF0, 0x01,
-    0xFF, 0xFE, 0x3E, 0x00, 0x0B, 0xFF, 0x43, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x6B, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x90, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0xFD, 0x00, 0x0F, 0xCB, 0xFF, 0xF8, 0x00, 0xFE,
-    0xF5, 0x7F, 0xD0, 0x1F, 0xF4, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0x00, 0x3F,
-    0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3E, 0x00,
-    0x00, 0x7E, 0x03, 0xE0, 0x00, 0x0B, 0xD0, 0x3E, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0x80,
-    0x2F, 0x40, 0x07, 0xF0, 0x01, 0xFD, 0x02, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x7F, 0xFF, 0xF0, 0x01, 0xFE, 0x57, 0xFC, 0x03, 0xF4, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0xFC, 0x1F,
-    0x80, 0x00, 0xFC, 0x2F, 0x40, 0x02, 0xF8, 0x3F, 0x00, 0x1F, 0xE0, 0x7F, 0xFF, 0xFE, 0x40, 0x7F,
-    0xFF, 0xFE, 0x00, 0xBE, 0x55, 0x6F, 0xD0, 0xBD, 0x00, 0x07, 0xF0, 0xBD, 0x00, 0x03, 0xF0, 0x7E,
-    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x07, 0xF0, 0x2F, 0xD0, 0x2F, 0xD0, 0x0F, 0xFF, 0xFF, 0x40, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x2F,
-    0xFF, 0xFD, 0x00, 0x3E, 0x56, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xF9, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x1F, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x40, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x06, 0xFF, 0x83, 0xF0, 0x0B, 0xFF, 0xFC,
-    0xFC, 0x0B, 0xF8, 0x1F, 0xFE, 0x0B, 0xF0, 0x00, 0xFF, 0x83, 0xF0, 0x00, 0x1F, 0xE2, 0xF8, 0x00,
-    0x03, 0xF4, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x1F, 0x8B, 0xD0,
-    0x00, 0x0B, 0xD2, 0xF4, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x02, 0xF8, 0x1F, 0x80, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x41, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x7F, 0xD6, 0xFD, 0x03, 0xF4, 0x02, 0xF4, 0x2F, 0x80, 0x07, 0xD0, 0xFC, 0x00, 0x2F, 0x4B,
-    0xD0, 0x02, 0xFC, 0x3F, 0x01, 0xBF, 0xC0, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0x2F, 0x90,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0xD0, 0x1B, 0x40, 0x3F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0xD0,
-    0x0F, 0xFE, 0x00, 0x0F, 0x80, 0x0F, 0xFF, 0x40, 0x15, 0xFD, 0x00, 0x7D, 0x00, 0xFF, 0x58, 0x00,
-    0x01, 0xFC, 0x02, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xBD, 0x07, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x57, 0xF5, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x1F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7D, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x02,
-    0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x2F, 0x40, 0x00, 0x10, 0x7F, 0x40, 0x3E,
-    0x00, 0x7F, 0x40, 0x00, 0xFF, 0xF4, 0x01, 0xF4, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0x40, 0x0B, 0xC0,
-    0x00, 0xBF, 0xD0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x80, 0x3E, 0x56, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x15, 0xBF, 0x40, 0x0B, 0xFF, 0x80, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x03, 0xF0, 0xE4, 0x01, 0xFE, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x05, 0x40,
-    0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x7E,
-    0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40,
-    0x3F, 0x00, 0x2F, 0xF0, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x2F, 0xFF, 0xE3, 0xE0, 0x00, 0xBF, 0xF4,
-    0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0xFC, 0x02, 0xF0,
-    0x00, 0x0B, 0xD0, 0xBE, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x00, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x07, 0xD0, 0x2F,
-    0x40, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x03, 0xE0, 0x00, 0x3F,
-    0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0x81, 0xFA, 0xF0, 0x02, 0xFF,
-    0xFE, 0x3E, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x0B,
-    0xE0, 0x0B, 0xC0, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x01, 0xF8,
-    0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x5F, 0xD0, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x02,
-    0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAF, 0xE0, 0x00, 0x03, 0xE0,
-    0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x0F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x00, 0x0B,
-    0xD0, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x5F, 0xF0, 0x00, 0x3F,
-    0x00, 0x7F, 0xF0, 0x00, 0x1F, 0x80, 0x1F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xE0, 0x03, 0xEF, 0x00, 0x00, 0x7E, 0xF4, 0x01, 0xF7, 0xD0, 0x00, 0x3F, 0xBC,
-    0x00, 0xBC, 0xF4, 0x00, 0x2F, 0x3F, 0x00, 0x3F, 0x3E, 0x00, 0x0F, 0x8F, 0x80, 0x0F, 0x8B, 0xC0,
-    0x0F, 0xC7, 0xD0, 0x03, 0xD1, 0xF0, 0x07, 0xD2, 0xF4, 0x01, 0xF4, 0x3C, 0x03, 0xF0, 0xBC, 0x00,
-    0xBC, 0x0F, 0x42, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xE0, 0xF8, 0x0F, 0x80, 0x0F, 0x80, 0xB8, 0xFC,
-    0x07, 0xD0, 0x07, 0xD0, 0x1F, 0x7D, 0x02, 0xF0, 0x01, 0xF0, 0x07, 0xFF, 0x00, 0xFC, 0x00, 0xBC,
-    0x00, 0xFF, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x07,
-    0xD0, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0xFD, 0x55, 0x5B, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x7E, 0x00,
-    0x7E, 0x00, 0x02, 0xF4, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xF9, 0x5F, 0xF0, 0x03, 0xF4, 0x00, 0xBE, 0x03, 0xF4, 0x00,
-    0x0F, 0xC1, 0xFC, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1, 0xF4, 0x00, 0x01, 0xF8, 0x7D, 0x00, 0x00, 0xBD, 0x1F,
-    0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x1F, 0xC0, 0x1F, 0xD0, 0x2F, 0xC0,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC1, 0xFF, 0xD0, 0x00, 0xBC, 0xBF, 0xFF, 0x00, 0x0F, 0xAF, 0x9B, 0xF8, 0x00,
-    0xFF, 0xC0, 0x1F, 0xC0, 0x1F, 0xF0, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0xBD,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0xBD,
-    0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0xFD, 0x00, 0x02, 0xF1, 0xFF,
-    0xFD, 0x00, 0x0F, 0x9F, 0x97, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xF4, 0x01, 0xFF, 0x00, 0x0B, 0xE0,
-    0x0B, 0xF4, 0x00, 0x1F, 0x80, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x03, 0xF0,
-    0x00, 0x0B, 0xD0, 0x1F, 0xC0, 0x00, 0x2F, 0x40, 0xBE, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x07,
-    0xF0, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x7F, 0x80, 0x01, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xD0, 0x0B,
-    0xEF, 0x42, 0xFE, 0x00, 0x3F, 0x3F, 0xFF, 0xE0, 0x00, 0xFC, 0x2F, 0xFD, 0x00, 0x07, 0xE0, 0x05,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00,
-    0x7F, 0xD5, 0xB8, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0xD0, 0x1A, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0xBC, 0x7F,
-    0xFF, 0x07, 0xFF, 0xF4, 0x00, 0xF9, 0xF5, 0x7F, 0x5F, 0x97, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xBC,
-    0x00, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0xFC,
-    0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x01, 0xF4, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x7E,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x07,
-    0xE0, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x2F,
-    0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x02,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x07,
-    0xE0, 0x02, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0x4B, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0x00, 0x00, 0x3D,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xAF, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xF9, 0xFE, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0x80,
-    0xFD, 0x07, 0xF0, 0x0B, 0xD0, 0x1F, 0x83, 0xF0, 0x02, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x00,
-    0xFC, 0x7E, 0x00, 0x3E, 0x00, 0x3F, 0x2F, 0x40, 0x1F, 0x40, 0x0F, 0x8B, 0xD0, 0x0B, 0xD0, 0x07,
-    0xE2, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x7E, 0x00, 0xFC, 0x01, 0xFC, 0x0F, 0xC0, 0x3E, 0x00, 0xFD,
-    0x02, 0xFC, 0x1F, 0x40, 0xFE, 0x00, 0x3F, 0xEB, 0xD6, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x07,
-    0xD0, 0x2F, 0x80, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFB, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x03, 0xF4,
-    0x3F, 0x00, 0x00, 0x3F, 0x40, 0x7E, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xF4,
-    0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03,
-    0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x7D, 0x02, 0xF4,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x03, 0xF8,
-    0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x80, 0x2F, 0xFF,
-    0xE1, 0xFF, 0x80, 0xBF, 0xF4, 0x0F, 0xF4, 0x00, 0x50, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x69, 0x00, 0x0F, 0x80,
-    0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x2F, 0x40, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x01, 0xFC, 0x3F, 0x00, 0x02, 0xF8, 0x7E, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x0F, 0xF0, 0x7F, 0x00,
-    0x7F, 0xF0, 0x3F, 0xEB, 0xF7, 0xE0, 0x1F, 0xFF, 0xD7, 0xE0, 0x02, 0xF9, 0x0B, 0xD0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x1F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x3F, 0x00,
-    0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80,
-    0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF8,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x3F,
-    0x40, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x00, 0x3F,
-    0x81, 0xF5, 0xFC, 0x1F, 0x7F, 0x00, 0x2F, 0xFF, 0xD0, 0xFF, 0xFE, 0x3E, 0x00, 0x0B, 0xFF, 0x40,
-    0x7F, 0xF4, 0x3D, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x01, 0xF8,
-    0x07, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x0B, 0xC0,
-    0x00, 0x7E, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0x00, 0x3F,
-    0xF4, 0x02, 0xFF, 0x00, 0x3F, 0x81, 0xF5, 0xFC, 0x1F, 0x6F, 0x40, 0x2F, 0xFF, 0xD0, 0xFF, 0xFE,
-    0x2F, 0xF8, 0x0B, 0xFF, 0x40, 0x7F, 0xF4, 0x0F, 0xF4, 0x00, 0x50, 0x00, 0x05, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x2F, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x2A, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xD4, 0x07, 0xF8, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0x80,
-    0x0B, 0xF4, 0x0B, 0xF0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x2F,
-    0x40, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x14, 0x00, 0x00, 0xBD, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xC0, 0x7E, 0x40, 0x7F, 0x80, 0x7E, 0x02, 0xF4, 0x00, 0x3F, 0x01,
-    0xF4, 0x0B, 0xC0, 0x00, 0xFC, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0xBC, 0x00, 0x0F,
-    0xC0, 0xFC, 0x02, 0xF8, 0x00, 0xBE, 0x07, 0xE0, 0x03, 0xF4, 0x0B, 0xF0, 0x2F, 0x40, 0x0B, 0xFF,
-    0xFF, 0x40, 0xBC, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x04, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xC0, 0xBE, 0x40, 0x7F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0xBD, 0x3F, 0x00, 0x02,
-    0xF4, 0xFC, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x7F, 0x07, 0xF4, 0x0B, 0xF4, 0x0B, 0xFF, 0xFF, 0x40,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0xF9, 0x6F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x55, 0x57, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xD0, 0x39, 0x06, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0xE4, 0x00,
-    0x0B, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x03, 0xF0, 0x02, 0xFE, 0x5B, 0xF4, 0x00, 0xFC, 0x01, 0xFC,
-    0x00, 0x7F, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x7E, 0x00, 0x02, 0xF4, 0x0B,
-    0xD0, 0x2F, 0x40, 0x00, 0xBD, 0x03, 0xF9, 0x5F, 0xC0, 0x00, 0x2F, 0x40, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0B, 0xD0, 0x7F, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0xBD, 0x00, 0x00, 0xFC, 0x0B, 0xC0,
-    0x2F, 0x40, 0x00, 0x7E, 0x03, 0xF0, 0x07, 0xD0, 0x00, 0x3F, 0x40, 0xFC, 0x01, 0xF8, 0x00, 0x1F,
-    0xC0, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x2F, 0x40, 0x0B, 0xF4, 0x1F, 0xE0, 0x0B, 0xC0, 0x00,
-    0xFF, 0xFF, 0xE0, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xAA, 0xBE, 0x00, 0x0F,
-    0xD0, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00,
-    0xFC, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xE5, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x01, 0xFC,
-    0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x0B, 0xC0, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0xFC,
-    0x00, 0xBF, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xF5, 0xBF, 0x40,
-    0xFD, 0x00, 0xBD, 0x0B, 0xE0, 0x01, 0xF4, 0x3F, 0x00, 0x0B, 0xD2, 0xF4, 0x00, 0xBF, 0x0F, 0xC0,
-    0x6F, 0xF0, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xE4, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x06, 0xD0,
-    0x0F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE0,
-    0x01, 0xFF, 0x5B, 0xF4, 0x03, 0xF4, 0x02, 0xF4, 0x0B, 0xE0, 0x01, 0xF4, 0x0F, 0xC0, 0x02, 0xF4,
-    0x2F, 0x40, 0x0B, 0xF0, 0x3F, 0x01, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0xBE, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1B, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xF9, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x16, 0xFD, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x01, 0x94, 0x00, 0x0B, 0xD2, 0xFF,
-    0xF0, 0x00, 0xFC, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x42, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xC0, 0x1F,
-    0xE0, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x7E, 0x00, 0x01, 0xF8, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x0B, 0xD0,
-    0x2F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0xAB, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xA8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE,
-    0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xF9, 0x5B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xFD,
-    0x00, 0x02, 0xFF, 0x90, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x1F, 0x00, 0x1F, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xD5, 0xB8, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xF4, 0x07, 0xFF,
-    0xFF, 0xC0, 0x2F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x1A, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x01, 0xFF, 0xFF, 0xE0, 0x3F,
-    0x95, 0xBC, 0x0B, 0xE0, 0x00, 0x40, 0xBC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0xF4, 0x02, 0xFD, 0x0F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xD0, 0x00, 0x05, 0x40, 0x00, 0x00, 0x06, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF8,
-    0x00, 0x2F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x60, 0x03, 0xE3, 0xE0, 0x1F,
-    0x9F, 0x40, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x6A, 0xFC, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0xAA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x02,
-    0xF4, 0x10, 0x00, 0x00, 0x07, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x07, 0xFC, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x00, 0xFD, 0x00,
-    0x1F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x3F, 0x00,
-    0x0B, 0xD0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x17, 0xFC, 0x00, 0x03, 0xF8,
-    0x07, 0xF4, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xAA, 0xAB, 0xFA, 0xAF, 0xF4, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x2F, 0xC0, 0xFC,
-    0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x0B, 0xD0,
-    0x00, 0xFC, 0x1F, 0x40, 0x00, 0xBE, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x3F,
-    0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x16, 0xFD, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF9, 0x00, 0x0B, 0xC3, 0xFF, 0xF4,
-    0x00, 0xFC, 0xFE, 0xBF, 0xC0, 0x0F, 0xFD, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x0B, 0xD0, 0x1F, 0xD0,
-    0x00, 0xBD, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x7E, 0x00, 0x01, 0xF8, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x2F,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x0B,
-    0xE0, 0x0B, 0xC0, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x01, 0xF8,
-    0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x5F, 0xD0, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x02,
-    0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xA4,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x7E,
-    0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40,
-    0x3F, 0x00, 0x2F, 0xF0, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x2F, 0xFF, 0xE3, 0xE0, 0x00, 0xBF, 0xF4,
-    0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0x00, 0x1F, 0x40,
-    0x3E, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x1F,
-    0x80, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF0,
-    0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0xBD, 0x00,
-    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x00, 0x1F, 0x4F, 0x80, 0x00,
-    0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x0A, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x0F, 0x80, 0x7E, 0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x7D, 0x02, 0xF4, 0x00,
-    0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x03, 0xF8, 0x07,
-    0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF0, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x2F, 0xFF, 0xE3,
-    0xE0, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE3, 0xF0, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x03, 0xF0,
-    0x00, 0x02, 0xF4, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x07, 0xF0, 0x00,
-    0x07, 0xF0, 0xBE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x0B, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x0F,
-    0xC0, 0xBE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0x00,
-    0x7E, 0x00, 0x1F, 0x7F, 0x40, 0x07, 0xF0, 0x07, 0xF0, 0x03, 0xF3, 0xF4, 0x00, 0xBD, 0x00, 0x3F,
-    0x00, 0x7D, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0x81, 0xF8, 0x02, 0xF4, 0x00, 0x3F, 0x02,
-    0xF0, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x8B, 0xC0,
-    0x0F, 0xC1, 0xF8, 0x00, 0x01, 0xF8, 0xF4, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x07,
-    0xEF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0xBD,
-    0x00, 0x07, 0xE0, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x07, 0xD0,
-    0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0xFD, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x2F, 0xE0, 0x03, 0xF0, 0x0B, 0xD0, 0x07, 0xFE,
-    0x00, 0x7D, 0x00, 0x7E, 0x00, 0xFB, 0xE0, 0x0F, 0xC0, 0x03, 0xE0, 0x3F, 0x3F, 0x01, 0xF4, 0x00,
-    0x3F, 0x07, 0xC2, 0xF0, 0x3E, 0x00, 0x03, 0xF0, 0xF4, 0x2F, 0x0F, 0xC0, 0x00, 0x2F, 0x7E, 0x01,
-    0xF6, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x15, 0xBF, 0x55, 0x50, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02,
-    0xFE, 0xA9, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x07, 0xE0, 0x02, 0xFC, 0x0B,
-    0xD0, 0x00, 0xFE, 0x0B, 0xC0, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x7E, 0x1F,
-    0x80, 0x00, 0xFD, 0x2F, 0x40, 0x01, 0xFC, 0x3F, 0x00, 0x0B, 0xF4, 0x3F, 0xAA, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xDF, 0xD6, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC5,
-    0x50, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0xBE,
-    0x00, 0x02, 0xF4, 0x00, 0xFE, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x2F,
-    0x40, 0x00, 0x2F, 0xD0, 0x7F, 0xC3, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xF8, 0x00, 0x7E, 0x00, 0x03, 0xFD, 0x00, 0x01, 0x00, 0x0B,
-    0xD0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xBF, 0xEA,
-    0xAA, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x07, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0xBF, 0xE5, 0x5B, 0xC0, 0x07, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBD, 0x00, 0x00,
-    0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0xBD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFC,
-    0x00, 0x7F, 0xD5, 0x68, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0x00,
-    0x01, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF9, 0x5F, 0xE5,
-    0x55, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xD0,
-    0x1F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xF8,
-    0x06, 0xC0, 0x2F, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x00, 0x0F, 0xFA, 0xBF, 0x40, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF4, 0xBC, 0x3F, 0x00, 0x01, 0xF8,
-    0x3F, 0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0x82, 0xF0, 0x00, 0xBE, 0x07, 0xD0, 0x7D, 0x00, 0x3F, 0x02,
-    0xF0, 0x1F, 0x80, 0x2F, 0x40, 0xBC, 0x03, 0xE0, 0x1F, 0xC0, 0x3F, 0x00, 0xFC, 0x0F, 0xC0, 0x0F,
-    0x80, 0x3F, 0x07, 0xE0, 0x07, 0xD0, 0x0B, 0xC3, 0xF0, 0x02, 0xF0, 0x02, 0xF6, 0xF4, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x03, 0xE7, 0xC0, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x03, 0xF0,
-    0x3E, 0x00, 0x00, 0x7E, 0x57, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0x2F, 0x1F, 0x40, 0x0B, 0xC3, 0xF1, 0xF8, 0x01, 0xF8, 0x3E, 0x0F, 0x80, 0x3F, 0x07, 0xD0,
-    0xFC, 0x07, 0xD0, 0xBC, 0x0F, 0xC0, 0xFC, 0x0B, 0xC0, 0xBC, 0x2F, 0x40, 0xF8, 0x07, 0xD3, 0xF0,
-    0x0F, 0x80, 0x7E, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0xBE, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xCF, 0x80, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0xF8,
-    0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x40,
-    0x01, 0xF8, 0x0B, 0xC0, 0x03, 0xFE, 0xAA, 0xBF, 0xEA, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7E, 0x00, 0x2F, 0x4B, 0xC3, 0xF0, 0x0B, 0xD0,
-    0x07, 0xE0, 0xFC, 0x3F, 0x00, 0xFC, 0x00, 0xFC, 0x0F, 0x82, 0xF0, 0x0F, 0xC0, 0x1F, 0x81, 0xF4,
-    0x1F, 0x41, 0xF8, 0x03, 0xF0, 0x1F, 0x01, 0xF8, 0x1F, 0x40, 0xBD, 0x02, 0xF0, 0x0F, 0x82, 0xF4,
-    0x1F, 0xC0, 0x3F, 0x00, 0xFC, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x0F, 0xC3, 0xF0, 0x7E, 0x00, 0x7D,
-    0x00, 0xBC, 0x7E, 0x0F, 0xC0, 0x0B, 0xC0, 0x0B, 0xDB, 0xD2, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00,
-    0x7D, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xE0,
-    0x00, 0x3F, 0x00, 0x07, 0xDF, 0x80, 0x00, 0xF8, 0x00, 0x3F, 0x2F, 0x00, 0x07, 0xE0, 0x02, 0xF0,
-    0xBC, 0x00, 0x2F, 0x40, 0x0F, 0x81, 0xF4, 0x00, 0xFE, 0x55, 0xFD, 0x5B, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7D, 0x02, 0xF4, 0xF8, 0xFC, 0x02, 0xF0,
-    0x0F, 0xC7, 0xD2, 0xF0, 0x0F, 0xC0, 0xFC, 0x1F, 0x0B, 0xD0, 0x3F, 0x07, 0xE0, 0xBC, 0x1F, 0x41,
-    0xF8, 0x3F, 0x03, 0xF0, 0x3E, 0x0B, 0xD2, 0xF4, 0x0F, 0x80, 0xFC, 0x2F, 0x0F, 0xC0, 0x7D, 0x03,
-    0xF0, 0xFC, 0xBD, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD2, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x17, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0xFD, 0x0F, 0xC0,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0xFC, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x1F, 0x80, 0x7E, 0x00, 0x00,
-    0xFD, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x03, 0xF0,
-    0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B,
-    0xEA, 0xAA, 0xBF, 0x40, 0x00, 0x3E, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFE, 0xFE, 0xBF, 0x00, 0x00, 0xBE, 0x0F, 0xC1, 0xF8, 0x00,
-    0x1F, 0x80, 0xF8, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0x40, 0xFC, 0x00, 0x7E, 0x01, 0xF0, 0x0B, 0xC0,
-    0x0F, 0xC0, 0x2F, 0x00, 0xBD, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xD0, 0x3F, 0x00, 0x3E, 0x00, 0x7E,
-    0x0B, 0xE0, 0x07, 0xD0, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00,
-    0x3F, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0xFD, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xAF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xBF, 0xEF, 0xF0, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0xBD,
-    0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0,
-    0x3F, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03,
-    0xF0, 0x01, 0xF4, 0x07, 0xE0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0B, 0xD0, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x3F, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0xFC, 0x0F, 0xD0, 0x07, 0xE0, 0x02, 0xF4,
-    0x07, 0xE0, 0x7F, 0x00, 0x1F, 0x40, 0x0B, 0xD0, 0x2F, 0x43, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40,
-    0x00, 0x7D, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xC0,
-    0x3F, 0xAA, 0xAA, 0xFD, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0xBC, 0x00,
-    0xFC, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x01, 0xF4, 0xFC, 0x00, 0x00,
-    0xFE, 0x55, 0x57, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF,
-    0xEF, 0xEB, 0xF0, 0x00, 0x7D, 0x02, 0xF4, 0x3F, 0x0B, 0xE0, 0x02, 0xF0, 0x1F, 0x80, 0xF8, 0x0F,
-    0xC0, 0x0F, 0xC0, 0xFC, 0x07, 0xD0, 0x3F, 0x00, 0x3F, 0x07, 0xE0, 0x2F, 0x00, 0xBC, 0x01, 0xF8,
-    0x3F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xD2, 0xF8, 0x03, 0xF0, 0x07, 0xD0, 0x2F, 0x0F, 0xC0, 0x0F,
-    0x80, 0x1F, 0x80, 0xFC, 0xBD, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x00,
-    0x00, 0x1F, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xC3, 0xF9, 0x00, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF9,
-    0x5B, 0xFC, 0x00, 0x07, 0x40, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xAA, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1B, 0xFF,
-    0x40, 0x00, 0x6F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x2F, 0xFA, 0x50, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x55, 0x40, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x55, 0x55, 0x68, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x07, 0xF0, 0x00, 0x1F, 0x07, 0xFC, 0x00, 0x02, 0xF7, 0xD0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7E, 0x57, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x02, 0xAB, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0xFF, 0x90, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xA4,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0xBC, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x40, 0x07, 0xE0, 0x01, 0xFC, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x7E, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x1F, 0xC0, 0x03, 0xF0,
-    0x2F, 0x40, 0x07, 0xE0, 0x01, 0xF8, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x1F, 0x80, 0x0F, 0xC0, 0x0B,
-    0xF0, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0xFF, 0x43, 0xF4, 0x1F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xBF, 0xE9, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x01, 0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x03, 0xE0, 0x0F,
-    0xC0, 0x3F, 0x00, 0x7D, 0x00, 0xFC, 0x07, 0xE0, 0x0B, 0xC0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x00,
-    0xFC, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xF8, 0x00, 0xF8, 0x1F, 0x80, 0x2F, 0x40,
-    0x1F, 0x81, 0xF4, 0x02, 0xF0, 0x02, 0xF4, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xE0,
-    0x07, 0xE0, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x02, 0xF4, 0x0B, 0xD0, 0x2F, 0x80, 0x2F, 0xC0, 0xFC,
-    0x0B, 0xF0, 0x00, 0xFF, 0x4F, 0xDB, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xCB, 0xE0,
-    0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0x55, 0x55, 0x55, 0xBF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE0, 0x00, 0x00, 0x02, 0xFA, 0xF8, 0x00,
-    0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00,
-    0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00,
-    0x0F, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFD, 0x5F, 0xF0, 0x03, 0xF8, 0x00, 0xBE, 0x02, 0xF8, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0xBD, 0x3F, 0x95, 0x55, 0x7F, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF8, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0xBD, 0x1F,
-    0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x1F, 0xC0, 0x1F, 0xE0, 0x6F, 0xC0,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x02, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0xBC, 0x00, 0x00, 0x2F, 0xD5, 0xBD, 0x00, 0x00, 0x3F,
-    0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00,
-    0x3E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x2F, 0x40, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40,
-    0xFC, 0x00, 0x00, 0x1F, 0x42, 0xF4, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x0F, 0x87, 0xD0,
-    0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x7F, 0xD3, 0xF0, 0x00,
-    0x3F, 0x40, 0xFC, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xD0, 0x02, 0xF0,
-    0x03, 0xF0, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x07, 0xD0, 0x7E, 0x00, 0x00,
-    0xF8, 0x3F, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x03, 0xF3, 0xE0, 0x00,
-    0x00, 0xBE, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x1A, 0x41, 0xA0, 0x00, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x00, 0x00, 0x78, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xFD, 0xFC,
-    0x00, 0x00, 0x0F, 0xFE, 0xBC, 0x00, 0x00, 0x2F, 0xD5, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x7D, 0x00,
-    0x00, 0xFD, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00, 0x3E, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x2F, 0x40,
-    0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00,
-    0x1F, 0x42, 0xF4, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x0F, 0x87, 0xD0, 0x00, 0x00, 0x0F,
-    0x8F, 0xC0, 0x00, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x69, 0x06, 0x80, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0x3F,
-    0x03, 0xE0, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x78, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x3F,
-    0x40, 0xFC, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xD0, 0x02, 0xF0, 0x03,
-    0xF0, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x07, 0xD0, 0x7E, 0x00, 0x00, 0xF8,
-    0x3F, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x03, 0xF3, 0xE0, 0x00, 0x00,
-    0xBE, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFA, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x81, 0xF8, 0x00, 0x00,
-    0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0xF8, 0x00, 0x02, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0x0F,
-    0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x0B, 0xD0, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xBD,
-    0x00, 0x3F, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7D, 0x00, 0x7E, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x7E, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3E, 0x01, 0xF8,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x3F, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x1F,
-    0x3F, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x0B, 0xFE, 0x56,
-    0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xE0, 0x07, 0xFF, 0xFF,
-    0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x7F, 0xD5, 0xFF, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x03, 0xF8,
-    0x00, 0xBE, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBE, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x2F,
-    0x40, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x01, 0xF4,
-    0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80,
-    0x0F, 0x82, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3E, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x03,
-    0xF0, 0x00, 0xFC, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x02, 0xF3, 0xE0, 0x00, 0x0F, 0xD0,
-    0x01, 0xFC, 0x00, 0x0B, 0xEF, 0x00, 0x00, 0x1F, 0xE4, 0x6F, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x5F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xF8, 0x3F, 0x4F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x3F,
-    0x40, 0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x2F,
-    0x80, 0x00, 0x00, 0x0B, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xE7,
-    0xF0, 0x00, 0x00, 0x00, 0xBE, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0xFD,
-    0xBE, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0x3F,
-    0x47, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x0F, 0xE0, 0xFC, 0x1F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x7F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xFE, 0x1A,
-    0x0F, 0xC0, 0xBE, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0x0F, 0xCF, 0xC0,
-    0x00, 0x03, 0xF3, 0xF0, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x2F, 0x5F,
-    0x80, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0x41, 0x43, 0xF8,
-    0x07, 0xFB, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x68, 0x78, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0xBE, 0x01, 0xFA, 0xBF, 0xC0, 0x0B, 0xF4, 0x01, 0x00,
-    0x20, 0x07, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x1F, 0x80,
-    0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x03,
-    0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xF5,
-    0x6F, 0xFF, 0x96, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x2F, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x0A, 0x0B, 0x41, 0xA0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x1F, 0xFF, 0xD0,
-    0x7F, 0xFF, 0x00, 0x1F, 0xF5, 0xA0, 0x0E, 0x6F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC0,
-    0x01, 0xF8, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0xBD, 0x00, 0x0B, 0xE1, 0xF8, 0x00, 0x2F, 0x00, 0x03,
-    0xF4, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x03, 0xF4, 0x01,
-    0xF8, 0x00, 0xBF, 0x00, 0xBF, 0x56, 0xFF, 0x95, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xF8, 0x7F, 0xFE, 0x00, 0x00, 0x01, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x02,
-    0xC0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x50, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x03, 0xE3, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B,
-    0xD7, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xCB,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x0B, 0xE0,
-    0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x0B, 0xE0, 0x00,
-    0x2F, 0xF0, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x00, 0xBF,
-    0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x1F, 0x7F, 0x40, 0x07, 0xF0, 0x07, 0xF0, 0x03, 0xF3, 0xF4,
-    0x00, 0xBD, 0x00, 0x3F, 0x00, 0x7D, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0x81, 0xF8, 0x02,
-    0xF4, 0x00, 0x3F, 0x02, 0xF0, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0x2F, 0x8B, 0xC0, 0x0F, 0xC1, 0xF8, 0x00, 0x01, 0xF8, 0xF4, 0x00, 0xBD, 0x3F, 0x00, 0x00,
-    0x0F, 0xEF, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xD0, 0x38, 0x0F, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0xBD, 0x00, 0x07, 0xE0, 0x00, 0x2F,
-    0x4B, 0xD0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x07, 0xD0, 0x00, 0x3E, 0x0B, 0xC0, 0x00,
-    0x7D, 0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0xFD, 0x00, 0x1F,
-    0x40, 0xBD, 0x00, 0x2F, 0xE0, 0x03, 0xF0, 0x0B, 0xD0, 0x07, 0xFE, 0x00, 0x7D, 0x00, 0x7E, 0x00,
-    0xFB, 0xE0, 0x0F, 0xC0, 0x03, 0xE0, 0x3F, 0x3F, 0x01, 0xF4, 0x00, 0x3F, 0x07, 0xC2, 0xF0, 0x3E,
-    0x00, 0x03, 0xF0, 0xF4, 0x2F, 0x0F, 0xC0, 0x00, 0x2F, 0x7E, 0x01, 0xF6, 0xF4, 0x00, 0x01, 0xFF,
-    0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1F, 0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x56, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0x68, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x2F, 0xE4, 0x64, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x04, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x0F, 0xC0, 0x00,
-    0x1F, 0xF2, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x07, 0xD0, 0xFD, 0x08, 0x00, 0xF8, 0x01, 0xC3, 0xF4,
-    0x2F, 0x00, 0x00, 0x1F, 0xF7, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBD, 0xBF, 0xC0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x02, 0xF0,
-    0x01, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x15, 0x55, 0xFD, 0x3F, 0xFF, 0xFF, 0xC3, 0xF5, 0x55, 0x50, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xBF, 0xF0, 0x1A, 0xFF, 0xFF, 0xC3, 0xFF, 0x80, 0x3C,
-    0x29, 0x00, 0x02, 0x80, 0x2D, 0xFE, 0xF8, 0xB0, 0x2E, 0x06, 0x2D, 0x1F, 0xC1, 0xF4, 0x3C, 0x7C,
-    0x14, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x43, 0xD0, 0x1F, 0xFC,
-    0x28, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0xFA, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xEB, 0xE0, 0x00, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0xE0, 0x0B, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0xB4,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x41, 0xED, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xD0,
-    0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x18, 0x00, 0x90, 0x00, 0x00, 0x00, 0x90, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x5B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x02, 0x90, 0x00, 0x01, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB9, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x06, 0x80, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x00,
-    0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x00,
-    0x07, 0xFF, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0xF8, 0x00, 0xFC, 0x00, 0x03, 0xF7, 0xD0, 0x03, 0xF0,
-    0x00, 0x3F, 0x2F, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0xFC, 0x00, 0x7D, 0x00, 0x1F, 0x83, 0xF0, 0x02,
-    0xF0, 0x00, 0xFC, 0x0F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x7D, 0x00, 0x3F, 0x00, 0xBD, 0x02, 0xF0,
-    0x00, 0xF8, 0x07, 0xE0, 0x0F, 0xC0, 0x07, 0xD0, 0x3F, 0x00, 0x3E, 0x00, 0x2F, 0x03, 0xF0, 0x01,
-    0xF8, 0x00, 0xFC, 0x2F, 0x40, 0x0B, 0xD0, 0x03, 0xE2, 0xF8, 0x00, 0x2F, 0x00, 0x1F, 0x5F, 0xC0,
-    0x00, 0xFC, 0x00, 0xBD, 0xFC, 0x00, 0x03, 0xE0, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x0F, 0xFD,
-    0x00, 0x00, 0xBC, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFA, 0x81, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x01, 0x40, 0x01, 0xF0, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0xFE, 0x5B, 0xF4,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F,
-    0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF,
-    0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x94, 0x1F, 0xFF, 0xE2, 0xFF, 0x40, 0xBF,
-    0xF4, 0x3F, 0xF0, 0x00, 0x50, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x0A, 0xFF, 0xAA, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0xA9, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x07, 0xE0, 0x07, 0xFC, 0x0B, 0xD0, 0x00, 0xFD, 0x0F,
-    0xC0, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x1F, 0x40, 0x00, 0xFD, 0x2F,
-    0x40, 0x02, 0xFC, 0x3F, 0x00, 0x0B, 0xF4, 0x3F, 0xAA, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xA0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x17, 0xF9, 0x50, 0x07, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF1, 0x55, 0x00, 0x3F, 0xFF, 0xFE, 0x07, 0xFF,
-    0xFF, 0xF8, 0xBD, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0xBD, 0xFC, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0xBC,
-    0xFD, 0x00, 0x1F, 0xC7, 0xF4, 0x0B, 0xF4, 0x3F, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x07, 0xE0, 0x01, 0xFD, 0x00, 0x7D, 0x00, 0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x2F, 0x41, 0xF0, 0xFD, 0x02,
-    0xF0, 0x0F, 0x6F, 0xC0, 0x3F, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFA, 0xA6, 0xF4, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0xFD, 0x00, 0x02, 0xF1, 0xFF, 0xFD, 0x00, 0x0F, 0xDF, 0x97,
-    0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xF4, 0x00, 0xFF, 0x00, 0x07, 0xE0, 0x07, 0xF4, 0x00, 0x1F, 0x80,
-    0x2F, 0xC0, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x0F, 0x80,
-    0x00, 0x3F, 0x40, 0x7D, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x34, 0x3F,
-    0x40, 0x3F, 0x43, 0xF1, 0xFC, 0x01, 0xFF, 0x03, 0xEF, 0xD0, 0x0B, 0xEF, 0x4F, 0xFE, 0x00, 0x2F,
-    0x3F, 0xFF, 0xE0, 0x00, 0xFC, 0x2F, 0xFF, 0x00, 0x03, 0xF0, 0x05, 0x3E, 0x00, 0x1F, 0x80, 0x00,
-    0x7C, 0x00, 0xBD, 0x00, 0x00, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x55, 0x50, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x06, 0xBE, 0xAA, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x9A, 0xFF, 0x80, 0x0B, 0xD0, 0x02, 0xFD, 0x00, 0xFC, 0x00, 0x0F,
-    0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x1F, 0x80, 0x00, 0x2F, 0x42, 0xF4,
-    0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0x3F,
-    0x47, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xE5, 0x6F, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFD, 0x50, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x7E, 0x06, 0xFC, 0x02, 0xF0, 0x02, 0xF8, 0x0F, 0xC0, 0x03, 0xF0, 0x3F,
-    0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0xFD, 0x2F, 0x00, 0x03, 0xF0, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0B, 0xF4, 0x03, 0x96, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x7D, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0xF8, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x42,
-    0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD3,
-    0xF3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xEB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xCF,
-    0xCF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0x8B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x1F,
-    0x83, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0x42, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3E,
-    0x00, 0x3F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0xBD,
-    0x00, 0x0F, 0xEA, 0x00, 0x1F, 0xD0, 0x00, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0xFC,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xD0, 0x01, 0xFF, 0xC0, 0x2F, 0xFF, 0x00, 0x2F,
-    0x00, 0x3F, 0xFF, 0x00, 0x55, 0xFE, 0x00, 0xFC, 0x03, 0xFD, 0x54, 0x00, 0x01, 0xFC, 0x03, 0xE0,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x7D, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0x42, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC2, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x07, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x2F, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xE0, 0x3F, 0x40, 0x00,
-    0x00, 0x07, 0xF0, 0x1F, 0x40, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x7C, 0x00, 0xFE, 0x00, 0x00,
-    0xFF, 0xF4, 0x02, 0xF0, 0x02, 0xFF, 0xF4, 0x07, 0xFE, 0x00, 0x0F, 0x80, 0x01, 0xFF, 0xC0, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE5, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xAA, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xE5,
-    0x56, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x80, 0x3E, 0x56,
-    0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00,
-    0x15, 0xBF, 0x40, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0xE4, 0x01, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0E, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00,
-    0x3F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x40, 0x3F,
-    0x80, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x00, 0x01, 0xF8, 0x3F, 0x80,
-    0x00, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x2F, 0x80, 0x00,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00,
-    0x01, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xC0, 0x00, 0x7F, 0xA4, 0x07, 0xE0, 0x00, 0x0F, 0xFD, 0x01, 0xF8, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x1F, 0x43, 0xF0, 0x00,
-    0x02, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7E, 0xFC,
-    0x00, 0x00, 0x07, 0xD7, 0xE0, 0x00, 0x00, 0xBC, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00,
-    0xFC, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x02, 0xF4, 0x00, 0xFD, 0x50, 0x2F, 0x00, 0x0B,
-    0xFF, 0x03, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x00, 0x3F,
-    0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x7D, 0x0A, 0x3F, 0x80,
-    0x00, 0x2F, 0x47, 0xFF, 0x80, 0x00, 0x0F, 0xC1, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0xBF, 0x80, 0x00,
-    0x01, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x7F, 0xC0, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xF9, 0xFD, 0x00, 0x00, 0x00,
-    0xBD, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC2, 0xFE, 0x00, 0x00, 0x03,
-    0xE0, 0xFF, 0xD0, 0x00, 0x01, 0xF8, 0x3E, 0xFC, 0x00, 0x00, 0xBD, 0x05, 0x2F, 0x80, 0x00, 0x3F,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xE0, 0x01, 0xF4,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x90, 0xBE, 0x00, 0x0F, 0xC7,
-    0xCF, 0xE0, 0x00, 0x3F, 0x2E, 0xFD, 0x00, 0x00, 0xF8, 0xFF, 0xD0, 0x00, 0x07, 0xD3, 0xFD, 0x00,
-    0x00, 0x2F, 0x4F, 0xD0, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
-    0xBF, 0x40, 0x00, 0x00, 0x7D, 0x7E, 0x00, 0x00, 0x02, 0xF1, 0xFD, 0x00, 0x00, 0x0F, 0xC7, 0xFC,
-    0x00, 0x00, 0x3F, 0x2F, 0xF8, 0x00, 0x01, 0xF8, 0xF7, 0xF4, 0x00, 0x0B, 0xD3, 0xC3, 0xF0, 0x00,
-    0x3F, 0x09, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x2F, 0xFF, 0xE0, 0x3F, 0x40, 0x0F,
-    0xFF, 0xF4, 0x3F, 0x40, 0x02, 0xBF, 0xE8, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x03,
-    0xF0, 0x3F, 0x80, 0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x3F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xF9,
-    0xFC, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0xBE, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0xBD, 0x00,
-    0x2F, 0x80, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x07, 0xE0, 0x00,
-    0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x16, 0xFD, 0x54, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x1F,
-    0xD0, 0x0B, 0xD0, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xF8,
-    0x0F, 0xD0, 0x00, 0x1F, 0x43, 0xF4, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x7E, 0xFD, 0x00, 0x00, 0x07, 0xD7, 0xF0, 0x00, 0x00, 0xBC, 0x2F,
-    0x80, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x80, 0x02,
-    0xF4, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x0B, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x7F, 0xFF, 0x80,
-    0x00, 0x2F, 0x8B, 0xFF, 0xF8, 0x00, 0x0B, 0xF0, 0xFF, 0xFF, 0x40, 0x02, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x7D,
-    0x02, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
-    0xC7, 0xF0, 0x00, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xFB, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00,
-    0x7E, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x02, 0xF8, 0x00,
-    0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8,
-    0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xF8, 0x7F, 0xFF, 0xC0, 0x0B, 0xF0, 0x6A, 0xAF, 0xC0, 0x1F, 0xC0,
-    0x00, 0x1F, 0x80, 0x7F, 0x00, 0x00, 0x1F, 0x41, 0xFC, 0x00, 0x00, 0x2F, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xBE,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x1F,
-    0xC0, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x01, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xE0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x00,
-    0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x02, 0xFE, 0xAA, 0xAA, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-    0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0,
-    0x00, 0x00, 0xBF, 0xA0, 0x7E, 0x00, 0x00, 0x0F, 0xFF, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0xF8,
-    0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x03, 0xF9, 0x55, 0x5B, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00,
-    0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x3F,
-    0x00, 0x2F, 0x40, 0x00, 0x3F, 0x50, 0x2F, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xAA, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x2F, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0x1F, 0xEA, 0xA0, 0x03, 0xF0,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xE5, 0x55, 0x6F, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0xE6, 0xBF, 0xE0, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0xBF, 0x40, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD2, 0xF4, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0xBE, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xBD, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xD7, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x79, 0x5B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x50, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7E,
-    0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x07, 0xD0, 0x00, 0x2F, 0x41, 0xFF, 0x00, 0xBC, 0x00, 0x03, 0xF0,
-    0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x1F,
-    0x80, 0x00, 0xBD, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x96, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xE9, 0xBC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x10, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0x80, 0x2F, 0x80, 0x03, 0xFF, 0xFC, 0x0F, 0xC0,
-    0x02, 0xFD, 0x7F, 0x4B, 0xE0, 0x01, 0xFC, 0x0B, 0xE3, 0xF4, 0x00, 0xFD, 0x01, 0xFC, 0xFC, 0x00,
-    0x3F, 0x00, 0x7F, 0x7F, 0x00, 0x2F, 0x80, 0x1F, 0xDF, 0x80, 0x0F, 0xD0, 0x07, 0xEB, 0xE0, 0x03,
-    0xF0, 0x02, 0xFA, 0xF8, 0x00, 0xFC, 0x00, 0xFD, 0xBE, 0x00, 0x3F, 0x00, 0x3F, 0x2F, 0x80, 0x0F,
-    0xC0, 0x2F, 0x87, 0xF0, 0x03, 0xF0, 0x0F, 0xD0, 0xFD, 0x00, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x2F,
-    0x8B, 0xF0, 0x07, 0xF8, 0x07, 0xFB, 0xF4, 0x00, 0xBF, 0xE5, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF9, 0x60, 0x00, 0x6F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x2F, 0xE5, 0x50, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0xE0, 0x1F, 0x80, 0x1F,
-    0xFF, 0x82, 0xF4, 0x03, 0xF9, 0xFC, 0x3F, 0x00, 0xFD, 0x0B, 0xD3, 0xF0, 0x0F, 0xC0, 0x7D, 0x7E,
-    0x01, 0xF8, 0x0B, 0xD7, 0xE0, 0x2F, 0x80, 0xFC, 0x7E, 0x02, 0xF4, 0x0F, 0xC7, 0xE0, 0x2F, 0x82,
-    0xF4, 0x3F, 0x01, 0xF8, 0x7F, 0x03, 0xF8, 0x0F, 0xEF, 0xC0, 0x1F, 0xE0, 0xBF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xFE, 0x60, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x50, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0xAB, 0xF4,
-    0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xB8, 0x00, 0x02,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0x68,
-    0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x1B,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xFE, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x0B, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0xBC, 0x7F, 0xFF, 0x03, 0xFF, 0xF8,
-    0x00, 0xFD, 0xF9, 0x7F, 0x4F, 0x96, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xBD, 0x00, 0xFC, 0x00, 0xFF,
-    0x00, 0x0F, 0xF4, 0x00, 0xBD, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xBC, 0x02, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x0B,
-    0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x00,
-    0x0B, 0xE0, 0x2F, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFF, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0,
-    0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x1F, 0x80,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x07, 0xD3,
-    0xF0, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x3F, 0x0F, 0x80, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x07, 0xE0, 0x0B, 0xC0, 0x03, 0xF0, 0x02, 0xF4, 0x02, 0xF8, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x1F,
-    0x80, 0xBD, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x3F, 0x1F, 0x80, 0x00,
-    0x0F, 0xCF, 0xC0, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01,
-    0xF8, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xC0,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x00, 0x7D,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x05, 0x5F, 0xD5, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x15, 0x7F, 0x55, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x3F, 0x00,
-    0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x03, 0xF0,
-    0x00, 0x2F, 0x40, 0x2F, 0x80, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x03,
-    0xE0, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x00, 0x00,
-    0x3E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0x9F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC,
-    0x00, 0x00, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xA4, 0x02, 0xF8,
-    0x00, 0x00, 0xFF, 0xD0, 0x1F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x01, 0xF4, 0x01,
-    0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0x8F, 0xD0, 0x00,
-    0x00, 0x2F, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x00, 0x2F, 0x4F, 0xC0,
-    0x00, 0x02, 0xF8, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0xBE, 0x50, 0x0F,
-    0xC0, 0x00, 0xFF, 0xC0, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00,
-    0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFA, 0xAA, 0xAB, 0xFE, 0x80, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x3E, 0x7F, 0xFF, 0xFF, 0xE0, 0x7E, 0x6A, 0xBF,
-    0xEA, 0x90, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x7E, 0x00, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x01, 0xF4, 0x00, 0x0F, 0xD0,
-    0x02, 0xF4, 0x00, 0x2F, 0xC0, 0x02, 0xF0, 0x00, 0x7F, 0xC0, 0x02, 0xF4, 0x01, 0xFF, 0xC0, 0x01,
-    0xFD, 0x0B, 0xDF, 0xC0, 0x00, 0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xF8, 0x07, 0xFC, 0x00, 0x01,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x3F, 0x02,
-    0xF4, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x2F, 0x41, 0xFC, 0x00,
-    0x00, 0xBC, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x7E,
-    0x03, 0xF0, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x06, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xEB, 0xE0, 0x00, 0x6A, 0xA4, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xEA, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x1F, 0x80, 0x00, 0xBD, 0x2F, 0x40, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x03, 0xF8, 0x7E, 0x00, 0x07,
-    0xF4, 0x7E, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x7F, 0xF0, 0x3F, 0xEB, 0xF7, 0xE0, 0x1F, 0xFF, 0xC7,
-    0xD0, 0x02, 0xF9, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x2F, 0x94, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x0F, 0xC0,
-    0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x07,
-    0xE0, 0x3F, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x18, 0x03, 0xF0, 0x2F,
-    0x40, 0xF0, 0x0F, 0xC0, 0xFC, 0x07, 0xC0, 0x7E, 0x03, 0xF0, 0x2F, 0x02, 0xF4, 0x0F, 0xC0, 0xB8,
-    0x0F, 0xC0, 0x3F, 0x83, 0xD6, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xEB, 0xE0,
-    0x00, 0x2B, 0xF4, 0x2F, 0x40, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x00,
-    0xF0, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0xBD, 0x00, 0x00, 0x19, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x1F,
-    0x80, 0x00, 0xBD, 0x2F, 0x40, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x7E,
-    0x0B, 0x83, 0xF8, 0x7E, 0x0F, 0x47, 0xF4, 0x7E, 0x0F, 0x0F, 0xF0, 0x7F, 0x0F, 0x3F, 0xF0, 0x3F,
-    0xFF, 0xF7, 0xE0, 0x1F, 0xFF, 0xC7, 0xD0, 0x02, 0xFE, 0x0B, 0xC0, 0x00, 0x3C, 0x0F, 0xC0, 0x00,
-    0x7C, 0x0F, 0xC0, 0x00, 0x78, 0x1F, 0x80, 0x00, 0xB4, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x05, 0x94, 0x00, 0x0B, 0xE7,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xE4, 0x07, 0xFC, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x0F,
-    0xC0, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x03, 0xF0,
-    0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xFE, 0x00, 0x0B, 0xD7,
-    0xFF, 0xF8, 0x00, 0xFD, 0xF9, 0x6F, 0xC0, 0x0F, 0xFC, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x0B, 0xD0,
-    0x1F, 0xD0, 0x00, 0xBD, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xF8, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0x0B,
-    0xD0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFA,
-    0xAF, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x7C, 0x2F, 0x80, 0x00, 0x01, 0xFC,
-    0xFC, 0x3F, 0x00, 0x00, 0x07, 0xF8, 0xFC, 0x7F, 0x00, 0x00, 0x6F, 0xF0, 0xFD, 0xBE, 0x55, 0xAF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x1F,
-    0xF9, 0x56, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x57, 0xFC, 0x00, 0x0B, 0xF0, 0x03, 0xF0, 0x50, 0x3F,
-    0x00, 0x0F, 0xCB, 0xC2, 0xF4, 0x00, 0x3F, 0x2F, 0x0F, 0xC0, 0x03, 0xF4, 0xFD, 0xBE, 0x05, 0xFF,
-    0x81, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFA, 0xAF, 0xF8, 0x00, 0x00, 0xFF,
-    0x80, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x7C, 0x2F, 0x80, 0x00, 0x01, 0xFC, 0xFC, 0x3F, 0x00, 0x00, 0x07,
-    0xF8, 0xFC, 0x7F, 0x00, 0x00, 0x6F, 0xF0, 0xFD, 0xBE, 0x55, 0xAF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xF9, 0x56, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x57, 0xFC, 0x00, 0x0B, 0xF0, 0x03, 0xF0, 0x50, 0x3F, 0x00,
-    0x0F, 0xCB, 0xC2, 0xF4, 0x00, 0x3F, 0x2F, 0x0F, 0xC0, 0x03, 0xF4, 0xFD, 0xBE, 0x05, 0xFF, 0x81,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x2F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF5, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x2F, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF4,
-    0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0xBD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xC1, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD2, 0xF4, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x0B, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x2F, 0x40, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x00,
-    0x7E, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0xF8,
-    0x00, 0xFF, 0xF4, 0x01, 0x5F, 0xD0, 0x07, 0xD0, 0x0F, 0xF5, 0x80, 0x00, 0x1F, 0xC0, 0x2F, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x2F,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x7D, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xE5, 0x7F, 0x57, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x01, 0x07, 0xF4, 0x03, 0xE0, 0x07, 0xF4, 0x00, 0x0F,
-    0xFF, 0x40, 0x1F, 0x40, 0x0B, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0xBC, 0x00, 0x0B, 0xFD, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x00,
-    0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x2F, 0x40, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x3F, 0x40,
-    0x00, 0x01, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x7F, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xBE, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x03, 0xE0, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40,
-    0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x00, 0xFD, 0x01,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x02,
-    0x95, 0x6F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x1F, 0x43, 0xF0, 0x00,
-    0x02, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF,
-    0xF8, 0x00, 0x07, 0xE4, 0x6F, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x01, 0xFC, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x39, 0x6F, 0xF4,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xD0, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xBD, 0x00, 0x15, 0xFF, 0x00,
-    0x00, 0xBF, 0xA0, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x05,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE6, 0xF8, 0x00, 0x00, 0x7F,
-    0x01, 0xF4, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x07, 0xD0, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00,
-    0x7E, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x17, 0xF8, 0x00, 0x3F, 0x54, 0x7F, 0xF0,
-    0x00, 0x7F, 0xF0, 0x7F, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xE0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x00,
-    0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x02, 0xFE, 0xAA, 0xAA, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-    0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0,
-    0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBA, 0x5B, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x02,
-    0xF4, 0x00, 0x07, 0xE0, 0x03, 0xF9, 0x55, 0x5B, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00,
-    0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x00, 0x2F, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0xE5, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0x03, 0xF0,
-    0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7D,
-    0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0F,
-    0xC0, 0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x02,
-    0xFE, 0xAA, 0xAA, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0,
-    0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xBF,
-    0xA0, 0x7E, 0x00, 0x00, 0x0F, 0xFF, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00,
-    0x01, 0xF8, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x03,
-    0xF0, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x03, 0xF9, 0x55, 0x5B, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x1F, 0x80, 0x0F,
-    0xC0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x2F, 0x40,
-    0x00, 0x3F, 0x50, 0x2F, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x3F, 0x02, 0xF4,
-    0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x00,
-    0xFC, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x7E, 0x03,
-    0xF0, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x06, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xEB, 0xE0, 0x00, 0x6A, 0xA4, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xAF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x02, 0xF4, 0xBD, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x0B, 0xF0,
-    0xFD, 0x00, 0x1F, 0xF0, 0xBE, 0x00, 0xBF, 0xE0, 0x7F, 0xEB, 0xFB, 0xD0, 0x2F, 0xFF, 0xCF, 0xC0,
-    0x06, 0xF9, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x01, 0x7F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0xBE, 0xF0, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0xFD, 0xF0, 0x00, 0x01,
-    0xF7, 0xF0, 0x00, 0xFC, 0xF4, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0xF8, 0xF4, 0x00, 0x07, 0xD7, 0xE0,
-    0x01, 0xF4, 0xF8, 0x00, 0x0F, 0xCB, 0xD0, 0x02, 0xF0, 0xF8, 0x00, 0x1F, 0x0B, 0xC0, 0x03, 0xF0,
-    0xFC, 0x00, 0x3E, 0x0F, 0xC0, 0x03, 0xF0, 0xBC, 0x00, 0xBC, 0x0F, 0xC0, 0x03, 0xE0, 0xBC, 0x00,
-    0xF8, 0x1F, 0x80, 0x07, 0xD0, 0x7C, 0x02, 0xF0, 0x2F, 0x40, 0x0B, 0xC0, 0x7D, 0x03, 0xD0, 0x3F,
-    0x00, 0x0F, 0xC0, 0x3D, 0x0F, 0xC0, 0x3F, 0x00, 0x0F, 0x80, 0x3D, 0x1F, 0x40, 0x3E, 0x00, 0x1F,
-    0x80, 0x3E, 0x3F, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x3E, 0x7D, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x2F,
-    0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0xE0, 0x01,
-    0xFE, 0x90, 0x7D, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0xC0, 0xBC, 0x00, 0x0F, 0x80, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0x00, 0x3E, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0xF7, 0xC0, 0x00, 0xF7, 0xD0, 0x07, 0xCF,
-    0x00, 0x0B, 0xDF, 0x40, 0x2F, 0x3D, 0x00, 0x3D, 0xBC, 0x00, 0xF8, 0xF4, 0x03, 0xE3, 0xF0, 0x03,
-    0xD2, 0xE0, 0x1F, 0x0F, 0x80, 0x0F, 0x4B, 0xC0, 0xF8, 0x3D, 0x00, 0x7C, 0x1F, 0x07, 0xC1, 0xF0,
-    0x02, 0xF0, 0x7C, 0x3E, 0x0B, 0xC0, 0x0F, 0x80, 0xF2, 0xF0, 0x3F, 0x00, 0x3D, 0x03, 0xDF, 0x40,
-    0xF8, 0x01, 0xF0, 0x0F, 0xFC, 0x07, 0xD0, 0x0B, 0xC0, 0x2F, 0xD0, 0x1F, 0x94, 0x2F, 0x00, 0xBE,
-    0x00, 0xBF, 0xD0, 0xF8, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x0A, 0x40, 0x00, 0x02, 0xF0, 0x07, 0xD0,
-    0x00, 0x00, 0x7E, 0x5B, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0xBC, 0x00, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00,
-    0xBD, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA,
-    0xAA, 0xAF, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x0B, 0x80, 0x00, 0x7C, 0x00,
-    0xF8, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7,
-    0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0,
-    0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-    0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00,
-    0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01,
-    0xFF, 0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x04, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x02, 0xD0,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00,
-    0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC,
-    0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03,
-    0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07,
-    0xE0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x3E, 0x03,
-    0xE0, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7,
-    0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0,
-    0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-    0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00,
-    0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01,
-    0xFF, 0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x42,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xFA,
-    0xAA, 0xA0, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAB, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0xB0, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0x4F, 0x7F, 0xFF, 0xC0, 0x0F, 0xF5, 0x7E, 0xFF, 0xD5,
-    0xFD, 0x03, 0xF8, 0x01, 0xFF, 0xE0, 0x07, 0xE0, 0xBF, 0x00, 0x0F, 0xF8, 0x00, 0x7E, 0x0F, 0xC0,
-    0x00, 0xFF, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0xFC, 0x06,
-    0xFF, 0x03, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x07, 0xE0,
-    0x00, 0x2F, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x7E, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0x82, 0xF7, 0xFF, 0x80, 0x6D, 0x01, 0xFF, 0xFC, 0x7E, 0xFF, 0xFF, 0xD0, 0x07, 0xFE, 0x07, 0x87,
-    0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xA0, 0x02, 0xA0, 0x00, 0x1F,
-    0x00, 0x3E, 0x00, 0x01, 0xFD, 0x5F, 0xC0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x1B, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0xBD,
-    0x0B, 0xD0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0xAE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xD5, 0xFD, 0x00,
-    0x3F, 0x80, 0x1F, 0x80, 0x2F, 0x80, 0x07, 0xE0, 0x0F, 0xC0, 0x02, 0xF4, 0x07, 0xE0, 0x01, 0xFC,
-    0x03, 0xF4, 0x1B, 0xFD, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x1F, 0x90, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x01, 0xFE, 0x01, 0xB4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xA5, 0xBF, 0xF0, 0x00, 0xA0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x01, 0xAF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0xAA, 0xFD, 0x0F,
-    0xF9, 0x00, 0x00, 0xFC, 0x3F, 0xC0, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0xBE, 0x00,
-    0x00, 0x0B, 0xF0, 0xBE, 0x00, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x02,
-    0xFE, 0x00, 0x3F, 0xE5, 0x6F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0xF9, 0x57, 0xFC, 0x01, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x6F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x82,
-    0xFF, 0x95, 0xFD, 0x1F, 0xD0, 0x03, 0xF0, 0xFC, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0xFC, 0x0F, 0xC0,
-    0x0F, 0xD0, 0x3F, 0x81, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x07, 0xE0,
-    0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xA5, 0xBF, 0xF0, 0x00, 0xA0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xAF, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0xAA, 0xFD, 0x0F, 0xF9, 0x00, 0x00, 0xFC, 0x3F,
-    0xC0, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x00, 0x0B, 0xF0, 0xBE, 0x00,
-    0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xE5, 0x6F,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x07, 0x80,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xE5, 0x5F, 0xF0, 0x01, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1B, 0xFF,
-    0xF8, 0x01, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x57, 0xF4, 0x1F, 0xD0, 0x03, 0xF0, 0x3F, 0x00, 0x07,
-    0xE0, 0x3E, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x81, 0xFE, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF8, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xF8, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD2, 0xF4, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xD2, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x0B, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0x00, 0x0F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xE0,
-    0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xFD, 0x00,
-    0xFF, 0xE0, 0x00, 0xF8, 0x00, 0xFF, 0xF4, 0x01, 0x5F, 0xD0, 0x07, 0xD0, 0x0F, 0xF5, 0x80, 0x00,
-    0x1F, 0xC0, 0x2F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xBC, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x7D, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE5, 0x7F, 0x57, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x41,
-    0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x2F,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x01, 0x07, 0xF4, 0x03, 0xE0,
-    0x07, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x1F, 0x40, 0x0B, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0xBC, 0x00,
-    0x0B, 0xFD, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40,
-    0x00, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0x0B, 0xE0, 0xBE, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x5B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2A, 0xAF, 0xF0,
-    0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x7E, 0x55, 0x6F, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x02, 0xF4, 0x2F, 0x40, 0x07,
-    0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0x95, 0xBF, 0x40, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x5B, 0xF4, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xFC, 0x0E, 0x40, 0x1F, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x07, 0xF4, 0x03, 0xF5, 0x01, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1A, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x0A, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x10,
-    0x00, 0x0F, 0xF0, 0x03, 0xF9, 0x6B, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0xBD, 0x00, 0x00, 0xFF, 0xD0, 0x02, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0xFC,
-    0x00, 0x3F, 0x00, 0x03, 0xF3, 0xE0, 0x01, 0xF8, 0x00, 0x3F, 0x1F, 0x80, 0x0B, 0xD0, 0x02, 0xF4,
-    0xBD, 0x00, 0x3F, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0xFC, 0x00, 0xF8, 0x0F, 0xC0, 0x03, 0xF0, 0x0F,
-    0xC0, 0x7E, 0x00, 0x1F, 0x80, 0xBC, 0x02, 0xF4, 0x00, 0xBD, 0x07, 0xD0, 0x0B, 0xC0, 0x03, 0xF0,
-    0x3E, 0x00, 0x3F, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x2F, 0x00, 0x07, 0xE0, 0x02,
-    0xF5, 0xF4, 0x00, 0x2F, 0x40, 0x0B, 0xDF, 0x80, 0x00, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0xFF, 0xC0, 0x00, 0x1F, 0x80, 0x07, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x2F, 0xE0, 0x00, 0x02,
-    0xF4, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F,
-    0x80, 0x7E, 0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0,
-    0x00, 0x3F, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02,
-    0xFF, 0x40, 0x3F, 0x81, 0xFA, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xD0,
-    0x00, 0x0F, 0xFD, 0x00, 0x2F, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0xFC, 0x00, 0x07, 0xEF, 0xC0, 0x03,
-    0xF0, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0x80, 0x03, 0xF1, 0xF8, 0x00, 0xBD, 0x00, 0x2F, 0x4B, 0xD0,
-    0x03, 0xF0, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0xFC, 0x00, 0x3F, 0x00, 0xFC, 0x07,
-    0xE0, 0x01, 0xF8, 0x0B, 0xC0, 0x2F, 0x40, 0x0B, 0xD0, 0x7D, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0,
-    0x03, 0xF0, 0x00, 0xFC, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE2, 0xF0, 0x00, 0x7E, 0x00, 0x2F, 0x5F,
-    0x40, 0x02, 0xF4, 0x00, 0xBD, 0xF8, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0x40,
-    0x0F, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x3F, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x2D, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00,
-    0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x1F,
-    0x40, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F,
-    0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0x81, 0xFA, 0xF0, 0x01, 0xFF,
-    0xFE, 0x2F, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x10, 0x00, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0x3C, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x9B, 0xFF,
-    0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x42, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFD,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0x80, 0x00, 0x00, 0x0F, 0xDB,
-    0xE0, 0x00, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x0F,
-    0xC0, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x40, 0x0B,
-    0xFE, 0x56, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0xFC, 0x0F,
-    0xC0, 0x00, 0x2E, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xD5, 0xFF, 0x00, 0x3F,
-    0x80, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x1F,
-    0x87, 0xE0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x01,
-    0xFC, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0x40,
-    0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0x55, 0x55,
-    0x55, 0xBF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE0, 0x00, 0x00,
-    0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00,
-    0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFD, 0x5F, 0xF0, 0x03, 0xF8, 0x00,
-    0xBE, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0xBD, 0x3F, 0x95,
-    0x55, 0x7F, 0x0F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF8, 0x00, 0x01, 0xF8, 0x7E,
-    0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x1F, 0xC0,
-    0x1F, 0xE0, 0x6F, 0xC0, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x7E,
-    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x9B, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0x01, 0xFC,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x01, 0xFC,
-    0xBE, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xCF, 0xE5, 0x55, 0x55, 0x5B, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xAF,
-    0x80, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x00, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x7F,
-    0x80, 0x00, 0xFF, 0x40, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2D, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0x7F, 0xD5, 0xFF, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x3F,
-    0x0B, 0xE0, 0x00, 0x0B, 0xD3, 0xF9, 0x55, 0x57, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x1F, 0x80, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x02, 0xF8, 0x0F, 0xD0, 0x01, 0xFC, 0x01, 0xFE, 0x06, 0xFC, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x02, 0xF0,
-    0x2F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFE, 0x96, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x0A, 0xAA,
-    0xAB, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x7A, 0x55, 0xBF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0xF8, 0x0F, 0x80,
-    0x07, 0xE0, 0x7E, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x0F, 0x96, 0xFF, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x05, 0x55, 0x7F,
-    0x00, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x03, 0x90, 0x6F, 0xE0, 0x0F, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x90, 0x00,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x2F,
-    0x80, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF4, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-    0xD0, 0x00, 0x00, 0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE7,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x56, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xAA, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFD,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x7E,
-    0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x1F,
-    0x40, 0x00, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x25, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x02,
-    0xF4, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xC1,
-    0xF8, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x56, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00,
-    0x00, 0x01, 0xF4, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x01,
-    0xF8, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF0,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x25,
-    0xBF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x29, 0x06, 0x80, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x3F,
-    0x00, 0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x00, 0x02, 0x80, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xD0, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x0B, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0x40, 0x00, 0x00, 0xF8,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x00, 0x07,
-    0xD3, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x05,
-    0x6F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x02, 0x90, 0x00, 0x00, 0x07, 0xE0,
-    0xFD, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0x80,
-    0xF4, 0x00, 0x00, 0x01, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xE0, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00,
-    0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x02, 0x5B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00,
-    0x1E, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0x80,
-    0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x01, 0xF8,
-    0x3F, 0x00, 0x00, 0x2F, 0x43, 0xE0, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00,
-    0x03, 0xE0, 0x3F, 0x80, 0x00, 0xBE, 0x01, 0xFF, 0xAA, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0B, 0xFF, 0xAF, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x04, 0x00,
-    0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x2D, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x7E, 0x1F, 0x80, 0x00,
-    0xBD, 0x2F, 0x40, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x02,
-    0xF8, 0x7E, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x7F, 0xF0, 0x3F, 0xEB, 0xF7,
-    0xE0, 0x1F, 0xFF, 0xD7, 0xE0, 0x02, 0xF9, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xFA, 0x40, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xE5, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x03, 0xFA, 0x54, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0B, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x01, 0xBF, 0x80, 0x0F, 0xC0, 0x0B, 0xD0, 0x01,
-    0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0xBD, 0x02, 0xF4,
-    0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x02, 0xF4, 0x00,
-    0x1F, 0xC0, 0x7E, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0xBD,
-    0x00, 0x7F, 0xAA, 0xFF, 0xC0, 0x0F, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x07, 0xC0,
-    0x00, 0x00, 0x02, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x07, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xD0,
-    0x3F, 0x05, 0x00, 0x00, 0x2F, 0x40, 0xFF, 0xFF, 0xE0, 0x00, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x03,
-    0xF0, 0x1F, 0x90, 0x1F, 0xE0, 0x1F, 0x80, 0xBD, 0x00, 0x0F, 0xC0, 0x7D, 0x02, 0xF0, 0x00, 0x3F,
-    0x02, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0xBE, 0x00,
-    0x2F, 0x81, 0xF8, 0x00, 0xFD, 0x02, 0xFC, 0x0B, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x2F, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x6B, 0xEA, 0xA4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xA0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F, 0xAA, 0xA8, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE5, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x7E, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF4, 0x01, 0xFC, 0x00,
-    0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xD0,
-    0x00, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x9F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00,
-    0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0xA0, 0x02, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x01, 0xF8, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0xFD, 0x00, 0x00, 0x0F,
-    0xCB, 0xD0, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x00,
-    0x2F, 0x8B, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x7E, 0x50, 0x0F, 0xD0, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x6A, 0xFF, 0xFA, 0xA0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0x9F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00,
-    0xBD, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x1F,
-    0xC0, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0xFD, 0x00, 0x00,
-    0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x15, 0x7F, 0xF5, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00,
-    0x00, 0x2F, 0x8B, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xC0, 0x00,
-    0x3C, 0x00, 0x03, 0xC2, 0xFF, 0xFC, 0xB0, 0x3C, 0x28, 0x2C, 0x0A, 0x0C, 0x02, 0x80, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80,
-    0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x01, 0x40, 0x00, 0x00, 0xC0, 0x00, 0xE0,
-    0x00, 0xF0, 0x00, 0xFF, 0xFE, 0x0E, 0x03, 0x80, 0xE0, 0xA0, 0x0C, 0x28, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x05, 0x05, 0x55, 0x42, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xC1, 0x55, 0x54, 0x05, 0x55, 0x42, 0xFF, 0xFC, 0x3F, 0xFF, 0xC1, 0x55, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x54,
-    0x05, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x85, 0x55, 0x55, 0x54, 0x05,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x50, 0x00, 0x4F,
-    0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40,
-    0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E,
-    0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4,
-    0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02,
-    0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF,
-    0x40, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x15, 0x55, 0x55, 0x50, 0x00, 0xB4, 0x07, 0xC0, 0x3E, 0x02, 0xF0, 0x0F, 0xC0, 0xFD, 0x07,
-    0xF0, 0x3F, 0x80, 0x54, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0xBE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x03,
-    0xD0, 0x2F, 0x00, 0x50, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x3F, 0x02, 0xF4, 0x0F, 0xC0, 0x7D, 0x03,
-    0xE0, 0x1F, 0x00, 0x10, 0x00, 0x3E, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0B, 0xC1, 0xF0, 0x3C, 0x05,
-    0x00, 0x00, 0xB4, 0x0B, 0x40, 0x7C, 0x07, 0xC0, 0x3E, 0x03, 0xF0, 0x2F, 0x02, 0xF4, 0x0F, 0xC0,
-    0xFC, 0x0F, 0xD0, 0xBE, 0x07, 0xF0, 0x3F, 0x03, 0xF8, 0x2F, 0x80, 0x54, 0x05, 0x40, 0x00, 0x02,
-    0xF4, 0x2F, 0x80, 0xFC, 0x0F, 0xD0, 0xBE, 0x07, 0xF0, 0x3F, 0x03, 0xF4, 0x1F, 0x80, 0xF8, 0x0F,
-    0xC0, 0xBC, 0x03, 0xD0, 0x3E, 0x02, 0xF0, 0x1F, 0x00, 0x50, 0x05, 0x00, 0x00, 0x01, 0xFC, 0x1F,
-    0xC0, 0x3F, 0x82, 0xF8, 0x03, 0xF0, 0x3F, 0x00, 0xBD, 0x0B, 0xE0, 0x0F, 0xC0, 0xFC, 0x01, 0xF4,
-    0x1F, 0x40, 0x3E, 0x03, 0xF0, 0x07, 0xC0, 0x3C, 0x00, 0x10, 0x01, 0x00, 0x00, 0x7E, 0x07, 0xD7,
-    0xE0, 0xBD, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x03, 0xE2, 0xF0, 0x3E, 0x1F, 0x02, 0xE0, 0xF0,
-    0x1F, 0x05, 0x00, 0x50, 0x00, 0x01, 0x50, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0xFE, 0xBE, 0xBF, 0x3F, 0xFF,
-    0xFF, 0x9E, 0x9F, 0xAA, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x02, 0x94, 0xF5, 0x68, 0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x15, 0x1E, 0x05,
-    0x40, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x40, 0x3C, 0x01, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x01, 0x40, 0x2F, 0xF4, 0x7F, 0xFC, 0xBF, 0xFD, 0xFF, 0xFE, 0xBF, 0xFE, 0xBF, 0xFD, 0x3F,
-    0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xFF,
-    0x40, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x47, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD3, 0xFD, 0xFF, 0x3F, 0x41, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0xF8, 0x3F, 0xC0, 0x2F, 0xC7, 0xFC, 0x03, 0xFC, 0x3F, 0x40, 0x3F, 0x80, 0x40, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x7E, 0x3F, 0xC0, 0x2F, 0xD0, 0x0F, 0xF7,
-    0xFC, 0x02, 0xFD, 0x00, 0xFF, 0x3F, 0x40, 0x2F, 0xC0, 0x0F, 0xD0, 0x40, 0x00, 0x50, 0x00, 0x14,
-    0x00, 0x0B, 0xC7, 0xF6, 0xFD, 0xBF, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xCB, 0x00, 0x02, 0x80,
-    0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x50, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x55, 0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x00,
-    0xE0, 0x00, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF,
-    0x55, 0x5B, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0B, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0B, 0xC0, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x2E, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F,
-    0x07, 0xC1, 0xA4, 0x00, 0x06, 0x90, 0x1F, 0x00, 0xF8, 0x3D, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x3D,
-    0x07, 0xC3, 0xE3, 0xFA, 0xF8, 0x0F, 0xEB, 0xE0, 0xFD, 0xBE, 0x2F, 0x1F, 0x42, 0xF0, 0xBC, 0x0B,
-    0xC1, 0xFF, 0xE1, 0xF0, 0xF8, 0x07, 0xC3, 0xE0, 0x1F, 0x01, 0xB9, 0x0F, 0x47, 0xC0, 0x1F, 0x1F,
-    0x00, 0x7C, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x7C, 0xBC, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0xF8, 0x02,
-    0xF3, 0xE0, 0x0B, 0xC0, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x8F, 0x40, 0x3E, 0x00, 0x03, 0xD0, 0x0F,
-    0x40, 0x3D, 0x3D, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x3D, 0x01, 0xF0, 0xF0, 0x07, 0xC0, 0x02, 0xF0,
-    0x00, 0xF4, 0x0F, 0x83, 0xD0, 0x3E, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0xBC, 0x0F, 0x82, 0xF0, 0x00,
-    0xF4, 0x00, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x40, 0x0F, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xE0, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0B,
-    0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x07, 0xC1, 0xA4,
-    0x00, 0x06, 0x90, 0x00, 0x1A, 0x41, 0xF0, 0x0F, 0x83, 0xD3, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F,
-    0xFC, 0x3D, 0x07, 0xC3, 0xE3, 0xFA, 0xF8, 0x0F, 0xEB, 0xE0, 0x3F, 0xAF, 0x4F, 0xDB, 0xE2, 0xF1,
-    0xF4, 0x2F, 0x0B, 0xC0, 0xBC, 0x2F, 0x03, 0xF1, 0xFF, 0xE1, 0xF0, 0xF8, 0x07, 0xC3, 0xD0, 0x1F,
-    0x0F, 0x40, 0xBC, 0x1B, 0x90, 0xF4, 0x7C, 0x01, 0xF1, 0xF0, 0x07, 0xCB, 0xC0, 0x1F, 0x00, 0x00,
-    0xF8, 0x2F, 0x00, 0x7C, 0xBC, 0x01, 0xF3, 0xE0, 0x0B, 0xC0, 0x00, 0xBC, 0x0F, 0x80, 0x2F, 0x3E,
-    0x00, 0xBC, 0xF4, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x8F, 0x40, 0x3E, 0x3D, 0x00, 0xF4,
-    0x00, 0x3D, 0x00, 0xF4, 0x03, 0xD3, 0xD0, 0x0F, 0x5F, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x3D, 0x01,
-    0xF0, 0xF0, 0x07, 0xC7, 0xC0, 0x2F, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x3D, 0x03, 0xE1, 0xF0,
-    0x0F, 0x40, 0x1F, 0x00, 0x03, 0xF0, 0xBC, 0x0F, 0x82, 0xF0, 0x3E, 0x0B, 0xC0, 0x0F, 0x40, 0x00,
-    0x7F, 0xFD, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x0F, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xF4,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0xFC, 0x02, 0xF0, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0x40, 0x2E, 0x00, 0x3C, 0x00, 0x74,
-    0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x0F, 0xC2, 0xF4, 0x02, 0xF0, 0x3F, 0x00, 0x3E, 0x0B, 0xC0, 0x0B,
-    0xC0, 0xF8, 0x00, 0xF4, 0x1F, 0x00, 0x2E, 0x03, 0xC0, 0x03, 0xC0, 0x78, 0x00, 0x74, 0x0A, 0x00,
-    0x00, 0x00, 0xBD, 0x0F, 0xC1, 0xF8, 0x03, 0xF0, 0xBD, 0x0F, 0xC0, 0x2F, 0x03, 0xF0, 0x7D, 0x00,
-    0xF8, 0x2F, 0x03, 0xF0, 0x0B, 0xC0, 0xF8, 0x1F, 0x00, 0x3D, 0x07, 0xC0, 0xF8, 0x02, 0xE0, 0x3C,
-    0x07, 0xC0, 0x0F, 0x01, 0xE0, 0x3C, 0x00, 0x74, 0x0A, 0x00, 0xE0, 0x00, 0x7D, 0x0F, 0x83, 0xE0,
-    0xBC, 0x1F, 0x03, 0xD0, 0xB4, 0x1E, 0x03, 0x80, 0x7D, 0x1F, 0x40, 0xF8, 0x3E, 0x03, 0xE0, 0xFC,
-    0x0B, 0xC1, 0xF0, 0x1F, 0x03, 0xC0, 0x3D, 0x0F, 0x40, 0xB4, 0x2E, 0x01, 0xE0, 0x7C, 0x03, 0x80,
-    0xF0, 0x7D, 0x1F, 0x43, 0xE0, 0x3E, 0x0F, 0x83, 0xF0, 0x3E, 0x0F, 0xC2, 0xF0, 0x2F, 0x07, 0xC1,
-    0xF0, 0x1F, 0x03, 0xC0, 0xF4, 0x0F, 0x43, 0xD0, 0xB8, 0x0B, 0x42, 0xE0, 0x78, 0x07, 0x81, 0xF0,
-    0x3C, 0x03, 0x80, 0xF0, 0x2C, 0x00, 0x01, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0xBB, 0xC0, 0x00, 0x7C, 0xB0, 0x00, 0x3C, 0x1D, 0x00, 0x2D, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x0F,
-    0x00, 0x2D, 0x0F, 0x40, 0x03, 0x8B, 0x80, 0x00, 0xF0, 0x00, 0x04, 0x00, 0x07, 0xC0, 0x07, 0xE0,
-    0x07, 0xE0, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00,
-    0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0xF0, 0x00,
-    0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0xFE, 0x00,
-    0xFD, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x7D, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x10, 0x2F, 0x00, 0x03, 0xF8, 0x00, 0x0F,
-    0x41, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x07, 0xF0, 0x01, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x0F, 0xC0, 0x00, 0x01, 0x90, 0x01, 0xFF, 0xF0, 0x00, 0xA4, 0x3F, 0x00, 0x07, 0xFC, 0x00,
-    0x1F, 0xC7, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x3F, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x03, 0xF4,
-    0x00, 0x7E, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xF4, 0x08, 0x00, 0x03, 0xF4, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x0B, 0xF0, 0x0F, 0xE0, 0x03,
-    0xF8, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x2F, 0x80,
-    0x0B, 0xE0, 0x0F, 0xD0, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x7E,
-    0x00, 0x0F, 0x80, 0x1F, 0x40, 0x07, 0xD0, 0x0B, 0xC0, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0xF8, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x1F, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x50,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0x00, 0x0F,
-    0xF0, 0x1F, 0xE0, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x04, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x01, 0xFF, 0xFB, 0xF8, 0x08,
-    0x7E, 0x1F, 0xC0, 0x0B, 0xD0, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC0, 0xFC, 0x00, 0xF8, 0x1F,
-    0x80, 0x1F, 0x43, 0xF4, 0x01, 0xF0, 0xFE, 0x00, 0x2F, 0x7F, 0x80, 0x03, 0xFF, 0xD0, 0x00, 0x3F,
-    0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA1,
-    0xFF, 0xFF, 0xFF, 0xC6, 0xAA, 0xAA, 0xA9, 0x00, 0x30, 0x00, 0x00, 0x01, 0x87, 0x40, 0x00, 0x00,
-    0x38, 0x3C, 0x00, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0xBF, 0x55, 0xFD, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0x03, 0x81, 0xD0,
-    0x00, 0x00, 0x2C, 0x38, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3D, 0xD0, 0x00, 0x00, 0xF0, 0xE0, 0x00,
-    0x01, 0xE0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x0E, 0x00, 0xB4, 0x00,
-    0x3C, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEB, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x81, 0x68, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC2, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0xA4, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x10, 0x02, 0xE0, 0x00, 0x00, 0x10, 0x03, 0xD0, 0x00, 0x7D,
-    0x02, 0xD0, 0x00, 0x00, 0xBD, 0x03, 0xC0, 0x00, 0xBF, 0xD3, 0xC0, 0x00, 0x00, 0xFF, 0xD3, 0xC0,
-    0x00, 0x1B, 0xFF, 0xD5, 0xA9, 0x00, 0x1B, 0xFF, 0x95, 0xA8, 0x00, 0x6F, 0xFF, 0xFD, 0x00, 0x00,
-    0x6F, 0xFF, 0xFC, 0x00, 0x2F, 0xD6, 0xBD, 0x00, 0x00, 0x3F, 0xDA, 0xFC, 0x00, 0xBE, 0xE0, 0x00,
-    0x00, 0x00, 0xFA, 0xD0, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0xF0, 0x00, 0x0F, 0xD0,
-    0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x2F, 0x80, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00,
-    0x0B, 0x00, 0x7D, 0x00, 0x00, 0x0E, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE3,
-    0xFF, 0xF4, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x0B, 0xEA, 0x80, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0xD5, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0xBF, 0xFC, 0x00, 0x06, 0xAF, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x05, 0x6F, 0x40, 0x01, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFC, 0x00,
-    0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x1B,
-    0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0x1F, 0xE5, 0xBF, 0x80, 0xFE, 0x5B, 0xFC,
-    0x08, 0x00, 0x1F, 0xC0, 0x50, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0xFD, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xC1, 0xFE, 0x5B, 0xF8, 0x01, 0xFC,
-    0x08, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x0B,
-    0xD0, 0x00, 0x00, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xC0, 0x00, 0x2F, 0xE0, 0x00,
-    0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x00,
-    0x00, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x0B, 0xFF, 0xD0, 0x00, 0x2F, 0xC0, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0x80, 0xBF, 0x97,
-    0xFD, 0x00, 0x3F, 0x40, 0x20, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x2F,
-    0xD0, 0x01, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0B, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xC0, 0x01,
-    0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55,
-    0x57, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xC2, 0xE5,
-    0x7F, 0xFF, 0xF8, 0xB4, 0x0F, 0xFF, 0xFF, 0x2D, 0x03, 0xFF, 0xFF, 0xEB, 0x40, 0xFF, 0xFF, 0xFE,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xB4, 0x0F, 0xFF, 0xFF, 0xED, 0x03, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF,
-    0xFE, 0xD0, 0x3F, 0xFF, 0xFF, 0xB4, 0x0F, 0xFF, 0xFF, 0xAD, 0x03, 0xFF, 0xFF, 0xDB, 0x40, 0xFF,
-    0xFF, 0xF2, 0xD0, 0x3F, 0xFF, 0xF0, 0xB4, 0x0F, 0xFF, 0xE0, 0x2D, 0x03, 0xC0, 0x00, 0x0B, 0x40,
-    0xF0, 0x00, 0x02, 0xD0, 0x3C, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0x00, 0x2D, 0x03, 0xC0, 0x00, 0x0B,
-    0x40, 0xF0, 0x00, 0x02, 0xD0, 0x3C, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0x00, 0x2D, 0x03, 0xC0, 0x00,
-    0x0B, 0x40, 0xF0, 0x00, 0x02, 0xD0, 0x3C, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0x00, 0x2D, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFF, 0x57, 0xD1, 0xFF, 0xFF, 0xF0, 0x2D, 0x2F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0,
-    0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF,
-    0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x2F, 0xFF, 0xFF, 0x02,
-    0xD0, 0xFF, 0xFF, 0xF0, 0x2D, 0x0B, 0xFF, 0xFF, 0xAB, 0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x1A,
-    0xAA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3D, 0x5F, 0xFF, 0xFF,
-    0x03, 0xC0, 0xBF, 0xFF, 0xF8, 0x3C, 0x0B, 0xFF, 0xFF, 0xC3, 0xC0, 0xBF, 0xFF, 0xFC, 0x3C, 0x0B,
-    0xFF, 0xFF, 0xD3, 0xC0, 0xBF, 0xFF, 0xFD, 0x3C, 0x0B, 0xFF, 0xFF, 0xE3, 0xC0, 0xBF, 0xFF, 0xFD,
-    0x3C, 0x0B, 0xFF, 0xFF, 0xD3, 0xC0, 0xBF, 0xFF, 0xFC, 0x3C, 0x0B, 0xFF, 0xFF, 0xC3, 0xC0, 0xBF,
-    0xFF, 0xF8, 0x3E, 0xAF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x2A, 0xAA, 0xAA, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x18, 0x00, 0xF4, 0x00, 0x0F, 0xE0, 0x3C, 0x00, 0x03, 0xFF, 0x9E, 0x00, 0x00, 0x06, 0xFF,
-    0xEF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x07, 0xFC, 0x16, 0x80, 0x07, 0xDB, 0x40, 0x00, 0x0B,
-    0xE1, 0xF0, 0x00, 0x0B, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x24, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x40, 0x0F, 0xD0, 0xBF, 0x42, 0xFD, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x2F, 0x00, 0xBC, 0x01, 0xF0, 0x03, 0xC0, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x55, 0xFD, 0x00, 0x00,
-    0x2F, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x03, 0x80, 0x01, 0xD0, 0x00, 0x00, 0x2C, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0xD0, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x01, 0x80, 0x07, 0x40, 0x00,
-    0x00, 0x38, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80,
-    0x02, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x90, 0x07, 0xC0, 0x00, 0x03, 0xF4, 0x1E, 0x00, 0x00, 0x1F, 0xFD, 0xB0, 0x00,
-    0x00, 0x06, 0xFF, 0xEB, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x02, 0xFE, 0x05, 0x90, 0x00,
-    0x3F, 0x3C, 0x00, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x3F, 0x42, 0xF0, 0x00, 0x00, 0xF8, 0x07,
-    0xD0, 0x00, 0x00, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x80, 0x0F, 0x40, 0x00, 0x0B, 0xE0, 0x3C, 0x00, 0x00, 0x2F, 0xF8, 0xF0, 0x00,
-    0x00, 0x06, 0xFF, 0xEF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x07, 0xFC, 0x16, 0x80, 0x00,
-    0x7D, 0xB8, 0x00, 0x00, 0x07, 0xE1, 0xF0, 0x00, 0x00, 0x7F, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B,
-    0xC0, 0x00, 0x01, 0x40, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x07, 0xCB, 0xF0, 0x03, 0xE2, 0xFC, 0x01, 0xF4, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x07, 0xC0, 0x0A, 0x43, 0xF0, 0x0B, 0xF0, 0xF4, 0x02, 0xFC, 0xBC, 0x00, 0x7F, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xD0,
-    0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x1B, 0xFF, 0xFA, 0x57, 0xF4, 0x78, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x1C, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x9A, 0xF8, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x0F,
-    0x40, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x74, 0x00, 0x00, 0x02, 0xC1, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0x80, 0xB8, 0x0D, 0x00, 0x3E,
-    0x0B, 0x83, 0xF0, 0x00, 0xF8, 0xB8, 0xFC, 0x00, 0x03, 0xEB, 0xBF, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x01, 0x55, 0xBF, 0xF9, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xF2, 0xAA, 0xFF, 0xFA, 0xAA, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x03, 0xFB, 0xBF, 0x00, 0x00, 0xFC, 0xB8, 0xFC, 0x00, 0x3F, 0x0B, 0x83, 0xF0,
-    0x02, 0xC0, 0xB8, 0x0E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0xBD, 0x0F, 0xC1, 0xF4, 0x2F, 0x00, 0x3F, 0x0B, 0xD0, 0xFC, 0x1F,
-    0x80, 0x2F, 0x03, 0xF0, 0x7D, 0x0F, 0xC0, 0x0F, 0x82, 0xF0, 0x3E, 0x07, 0xD0, 0x0B, 0xC0, 0xF8,
-    0x1F, 0x03, 0xE0, 0x03, 0xD0, 0x7C, 0x0F, 0x41, 0xF0, 0x02, 0xE0, 0x3C, 0x07, 0xC0, 0xF4, 0x00,
-    0xF0, 0x1E, 0x03, 0xC0, 0x7C, 0x00, 0x74, 0x0A, 0x01, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x43, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x42, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x0F, 0xC3, 0xF8, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x83, 0xF4,
-    0xFE, 0x3F, 0x41, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x3F, 0x40, 0x00, 0x01, 0xF8,
-    0x3F, 0x80, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x1E, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0F, 0x80, 0x09, 0x00, 0x03,
-    0xF8, 0x03, 0xE0, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0xF8, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x3E, 0x00,
-    0xFD, 0x00, 0x01, 0x40, 0x0F, 0x80, 0x05, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x55, 0x55,
-    0x7E, 0x55, 0x55, 0x50, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x0F, 0xD0, 0x0F,
-    0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xE0, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0xF8, 0x07, 0xF0, 0x00,
-    0x1E, 0x00, 0x3E, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xF6, 0xFD, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91, 0xFD, 0xBF, 0x9F, 0xD2, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x2F, 0xDB, 0xF9, 0xFC, 0x04, 0x00, 0x00, 0x1F, 0x8F, 0xF3, 0xFC, 0xBF, 0x05,
-    0x00, 0x00, 0x50, 0xBF, 0x3F, 0xCF, 0xF1, 0xF8, 0x00, 0x00, 0x02, 0x93, 0xFC, 0xFF, 0x3F, 0xC2,
-    0x90, 0x00, 0x00, 0x1F, 0x8F, 0xF3, 0xFC, 0xBF, 0x05, 0x00, 0xFF, 0xFF, 0x57, 0xD5, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x5B, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xE0, 0x0B, 0xFF, 0xFF,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xBF, 0xFE, 0x3F, 0xFC, 0x2F, 0xF8,
-    0x0F, 0xF0, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x1F, 0xF4, 0x3F, 0xFC,
-    0xBF, 0xFE, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x02, 0x80, 0x0B, 0xE0,
-    0x2C, 0x38, 0xB0, 0x0E, 0x3C, 0x3C, 0x0F, 0xF0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x01, 0x40, 0xFF, 0x80, 0x57, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xC0,
-    0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x19, 0x00, 0x07,
-    0xFF, 0x40, 0x7E, 0xBF, 0x03, 0xE0, 0x3D, 0x2F, 0x00, 0xF4, 0xF4, 0x03, 0xE3, 0xC0, 0x0F, 0x5F,
-    0x00, 0x3D, 0xBC, 0x00, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x2E, 0x2F, 0x00, 0xF4, 0x7C, 0x0B, 0xC0,
-    0xFE, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x01, 0x40,
-    0x3C, 0x03, 0x80, 0x74, 0x0B, 0x00, 0xF0, 0x0E, 0x01, 0xE0, 0x2D, 0x03, 0xC0, 0x3C, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x1E, 0xF4, 0x00,
-    0x7C, 0xF0, 0x00, 0xF1, 0xF0, 0x03, 0xD2, 0xE0, 0x0B, 0x43, 0xD0, 0x2E, 0x03, 0xC0, 0x3F, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFC, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x3F, 0xFF, 0x40, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00,
-    0x00, 0xFB, 0x90, 0x07, 0xFF, 0xE0, 0x04, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00,
-    0xF4, 0x40, 0x0B, 0xC3, 0xEA, 0xFD, 0x0B, 0xFF, 0xD0, 0x01, 0x50, 0x00, 0x00, 0x01, 0x50, 0x01,
-    0xFF, 0xE0, 0x1F, 0xEA, 0x41, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x78, 0x00, 0x03, 0xDB, 0xF4, 0x0F,
-    0xFF, 0xF4, 0x7E, 0x03, 0xE1, 0xF0, 0x07, 0xC7, 0xC0, 0x1E, 0x1F, 0x00, 0xB8, 0x7C, 0x07, 0xC0,
-    0xFE, 0xBE, 0x00, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x1F,
-    0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0xBF, 0xF4, 0x02, 0xF9,
-    0xBC, 0x03, 0xD0, 0x3D, 0x03, 0xC0, 0x3D, 0x03, 0xD0, 0x7C, 0x01, 0xF6, 0xF4, 0x00, 0xFF, 0x80,
-    0x07, 0xFF, 0xD0, 0x1F, 0x42, 0xF0, 0x3D, 0x00, 0xF4, 0x3C, 0x00, 0xF4, 0x3D, 0x01, 0xF0, 0x2F,
-    0x9B, 0xE0, 0x0B, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x14, 0x00, 0x0B, 0xFF, 0x00, 0xBE, 0xBF,
-    0x07, 0xD0, 0x3C, 0x2E, 0x00, 0xF4, 0xF4, 0x03, 0xD3, 0xD0, 0x0F, 0x4F, 0x80, 0xFC, 0x1F, 0xFF,
-    0xF0, 0x1F, 0xDB, 0x80, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x02, 0xAB, 0xF4, 0x0F, 0xFE,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0xA0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x7F, 0xFF,
-    0xE6, 0xAF, 0xA9, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0x6A, 0xAA, 0x90, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xE2, 0xAA, 0xA9, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x07, 0xC0, 0x03,
-    0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x3C,
-    0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0xB4, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00,
-    0x7C, 0x00, 0xBC, 0x00, 0xF4, 0x01, 0xF0, 0x02, 0xE0, 0x07, 0xC0, 0x0F, 0x40, 0x2E, 0x00, 0xB8,
-    0x00, 0x01, 0x01, 0x90, 0x07, 0x6F, 0xF8, 0x0B, 0xF4, 0x7C, 0x0F, 0xC0, 0x3C, 0x0F, 0x40, 0x3C,
-    0x1F, 0x00, 0x7C, 0x2D, 0x00, 0xB8, 0x3C, 0x00, 0xB4, 0x3C, 0x00, 0xF0, 0x7C, 0x00, 0xF0, 0x78,
-    0x01, 0xE0, 0x50, 0x01, 0x40, 0x00, 0x19, 0x00, 0x07, 0xFF, 0x40, 0x7F, 0xBF, 0x03, 0xE0, 0x3D,
-    0x1F, 0x00, 0xB8, 0xF8, 0x02, 0xE3, 0xD0, 0x0B, 0x8F, 0x00, 0x3E, 0x7C, 0x00, 0xF5, 0xF0, 0x03,
-    0xC7, 0xC0, 0x2F, 0x1F, 0x00, 0xF8, 0x3D, 0x0B, 0xC0, 0xFE, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x9F, 0xFD, 0xB8, 0xF0, 0x07, 0xC0, 0x2F, 0x00, 0xF8, 0x03,
-    0xD0, 0x1F, 0x00, 0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x3D, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0xFF, 0xF4, 0x03, 0xFA, 0xFC, 0x01, 0x40, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0,
-    0x00, 0x1F, 0x40, 0x00, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x01, 0xFF, 0xF4, 0x03, 0xEA, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x06, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0xAF, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xF4, 0x10, 0x02, 0xF0, 0x3E, 0xAF, 0xD0, 0x3F, 0xFF, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xB8, 0x00, 0x3D, 0xF4, 0x00,
-    0xB4, 0xF0, 0x02, 0xE0, 0xF0, 0x07, 0xC1, 0xF0, 0x0F, 0x02, 0xE0, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFC, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x3F, 0xFF, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x00, 0xFB, 0x90,
-    0x07, 0xFF, 0xE0, 0x04, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x40, 0x0B,
-    0xC3, 0xEA, 0xFC, 0x0B, 0xFF, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x01, 0x50, 0x00, 0xBF, 0xF0, 0x1F,
-    0xEA, 0x40, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xE7, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F,
-    0x02, 0xF0, 0xF4, 0x07, 0xC7, 0xC0, 0x1F, 0x1F, 0x00, 0xB8, 0x3D, 0x03, 0xD0, 0xBE, 0xBE, 0x00,
-    0xFF, 0xE0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x07, 0xFF, 0x80, 0x7E, 0x6F, 0x43, 0xE0, 0x2E,
-    0x0F, 0x40, 0xB8, 0x2E, 0x03, 0xD0, 0x3E, 0xBD, 0x00, 0xBF, 0xC0, 0x0F, 0xEF, 0x80, 0xF8, 0x1F,
-    0x4B, 0x80, 0x3E, 0x3D, 0x00, 0xB8, 0xB8, 0x03, 0xD1, 0xFD, 0xBF, 0x01, 0xFF, 0xE0, 0x00, 0x54,
-    0x00, 0x00, 0x14, 0x00, 0x07, 0xFF, 0x00, 0xBE, 0xBF, 0x03, 0xD0, 0x3D, 0x2F, 0x00, 0xB4, 0xB8,
-    0x02, 0xD3, 0xE0, 0x0F, 0x4B, 0xC0, 0xBD, 0x0F, 0xFF, 0xF0, 0x1F, 0xE7, 0xC0, 0x00, 0x3D, 0x00,
-    0x01, 0xF0, 0x00, 0x1F, 0x42, 0xAB, 0xF4, 0x0B, 0xFE, 0x00, 0x05, 0x40, 0x00, 0x00, 0x60, 0x00,
-    0x0B, 0x00, 0x00, 0xB0, 0x00, 0x0B, 0x00, 0x3F, 0xFF, 0xE2, 0xAF, 0xAA, 0x00, 0xB0, 0x00, 0x0B,
-    0x00, 0x00, 0xB0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x2A, 0xAA, 0xA0, 0x3F, 0xFF,
-    0xE3, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE2, 0xAA, 0xA9, 0x00, 0x3C, 0x00,
-    0xF4, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0x40, 0x2F, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xB8,
-    0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x2D,
-    0x00, 0x00, 0xB0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x2D, 0x00,
-    0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x02, 0xF0, 0x03, 0xC0, 0x0F,
-    0x80, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0x69, 0x08, 0x03, 0xFF, 0xAC, 0x0F, 0x40, 0xF8, 0x2D, 0x00,
-    0xF4, 0x3C, 0x00, 0xF4, 0x78, 0x00, 0xF0, 0xB4, 0x00, 0xF0, 0xB4, 0x02, 0xE0, 0xB4, 0x07, 0xD0,
-    0x7C, 0x2F, 0xC0, 0x2F, 0xF2, 0xC0, 0x05, 0x40, 0x00, 0x00, 0x6A, 0x00, 0x3F, 0xFC, 0x0F, 0x02,
-    0xD2, 0xD0, 0x2D, 0x3C, 0x0B, 0xC7, 0xFF, 0xE0, 0xBA, 0x50, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x03,
-    0xD0, 0x60, 0x1F, 0xFF, 0x00, 0x15, 0x00, 0x00, 0x6A, 0x00, 0x1F, 0xFF, 0x40, 0xF4, 0x0F, 0x0F,
-    0x40, 0x2D, 0x3C, 0x00, 0xB6, 0xD0, 0x02, 0xDB, 0x40, 0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x02, 0xD0,
-    0xF4, 0x2E, 0x01, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x01, 0x80, 0x0A, 0x00, 0xB4, 0x0F, 0x40, 0x0F,
-    0x0B, 0x40, 0x02, 0xD7, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03,
-    0xED, 0x00, 0x03, 0xC3, 0xC0, 0x03, 0xC0, 0xB4, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA9, 0x00, 0xFF, 0xFC, 0x04, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x1A, 0xFF, 0x0F, 0xEA,
-    0xE3, 0xD0, 0x2D, 0x38, 0x07, 0xC3, 0xC1, 0xF0, 0x2F, 0xFC, 0x00, 0x14, 0x00, 0x01, 0xD0, 0x00,
-    0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x86, 0x90, 0x2D, 0xFF, 0xE0, 0xFE, 0x03,
-    0xC3, 0xE0, 0x0F, 0x1F, 0x00, 0x38, 0x74, 0x01, 0xE2, 0xC0, 0x0B, 0x4F, 0x00, 0x3C, 0x38, 0x00,
-    0xF1, 0xD0, 0x07, 0x8B, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x64, 0x2D, 0x07, 0xC0, 0xF0, 0x78, 0x03, 0xC7, 0x80, 0x1E,
-    0xB8, 0x00, 0x7F, 0xC0, 0x02, 0xFB, 0x80, 0x0F, 0x0F, 0x00, 0x38, 0x1E, 0x01, 0xD0, 0x3C, 0x0B,
-    0x40, 0x78, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x2D, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xB4, 0x0F, 0x00,
-    0xF0, 0x0E, 0x01, 0xD0, 0x2C, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xB4, 0x00, 0x00, 0x02, 0x06, 0x80,
-    0x2A, 0x00, 0xB7, 0xFF, 0x1F, 0xFC, 0x0F, 0xD0, 0x7B, 0x42, 0xD0, 0xF4, 0x07, 0xC0, 0x2D, 0x0F,
-    0x00, 0x78, 0x02, 0xC1, 0xE0, 0x0B, 0x00, 0x3C, 0x2C, 0x00, 0xF0, 0x03, 0x83, 0xC0, 0x0E, 0x00,
-    0x74, 0x3C, 0x01, 0xE0, 0x0B, 0x07, 0x80, 0x2D, 0x00, 0xF0, 0xB4, 0x03, 0xC0, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x82, 0xE4, 0x03, 0xDF, 0xFD, 0x03, 0xF4, 0x2E, 0x07, 0xD0, 0x1E, 0x0B,
-    0x80, 0x2D, 0x0F, 0x00, 0x3D, 0x0F, 0x00, 0x3C, 0x1E, 0x00, 0x7C, 0x2D, 0x00, 0xB8, 0x3C, 0x00,
-    0xF4, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0xA8, 0x00, 0x3D, 0xFF, 0xC0, 0x0F, 0xD0,
-    0xB8, 0x07, 0xC0, 0x0E, 0x02, 0xE0, 0x03, 0x80, 0xF0, 0x01, 0xE0, 0x3C, 0x00, 0xB4, 0x1F, 0x00,
-    0x3C, 0x07, 0xC0, 0x2E, 0x02, 0xF8, 0x2F, 0x00, 0xF3, 0xFF, 0x00, 0x38, 0x14, 0x00, 0x1D, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xA9, 0x03, 0xFF, 0xF1,
-    0xE0, 0x00, 0x74, 0x00, 0x0F, 0x40, 0x01, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x24,
-    0x0B, 0x8F, 0xFF, 0x80, 0x15, 0x00, 0x02, 0x80, 0x03, 0x40, 0x1F, 0xA8, 0xBF, 0xFC, 0x0F, 0x00,
-    0x1E, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3F, 0xC0,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F,
-    0xF4, 0x19, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x6A, 0xAA, 0x5F, 0x80, 0x3F, 0xFF, 0xEB, 0xD0, 0x0F, 0xEA,
-    0xA6, 0xF4, 0x07, 0xD0, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x03, 0xF4, 0x3F,
-    0x00, 0x00, 0xBF, 0xFF, 0xEA, 0xA0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x17, 0xF9, 0x55, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x10, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x01, 0xFA, 0xF4,
-    0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0xFB, 0x00, 0x2F,
-    0xDF, 0x07, 0xC0, 0x01, 0xFC, 0x7C, 0x2D, 0x00, 0x0F, 0xC2, 0xD0, 0xF0, 0x00, 0xBE, 0x0F, 0x07,
-    0x80, 0x03, 0xF0, 0xB8, 0x3D, 0x00, 0x1F, 0x83, 0xC1, 0xF0, 0x00, 0xBD, 0x1F, 0x0B, 0x40, 0x03,
-    0xF0, 0xB4, 0x3C, 0x00, 0x0F, 0xC3, 0xC1, 0xE0, 0x00, 0x3F, 0x2E, 0x0F, 0x00, 0x00, 0xFC, 0xF0,
-    0x7C, 0x00, 0x03, 0xF7, 0xC2, 0xD0, 0x00, 0x0F, 0xFD, 0x0F, 0x00, 0x00, 0x1F, 0xF0, 0x78, 0x00,
-    0x00, 0x3F, 0xC3, 0xC0, 0x00, 0x00, 0x7F, 0xEF, 0xAF, 0x40, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0x5F, 0xFF, 0x90, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x00, 0x0F, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xAA, 0xFC, 0x00, 0xFF, 0x40, 0x01, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0xA0, 0x6D, 0x07, 0xE0, 0x0F, 0x3F, 0xE0, 0xBD, 0x01, 0xFF, 0xEC, 0x0F, 0xC0, 0x2F, 0xE0,
-    0x00, 0xFC, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x00, 0xFD, 0x0B, 0xC0, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x7F, 0x0F, 0x80, 0x00,
-    0x03, 0xFD, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x9B, 0xC0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xAA, 0xAA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x15, 0xFD, 0x54, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x2B, 0xFE, 0xA8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0x56, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x04, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x55, 0x50, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0xBF,
-    0xAA, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xAF, 0xEA, 0xA8, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xAA, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x0B, 0xFC, 0x0F, 0xFF, 0xE0, 0x00, 0xBC, 0x7F,
-    0xFF, 0x3F, 0xFF, 0xF8, 0x00, 0xFD, 0xF9, 0x7F, 0xFF, 0x96, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFD,
-    0x00, 0xFD, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBD, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xBC,
-    0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x7F, 0x40, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0xFF, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x02, 0xFF,
-    0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xFD, 0x00, 0x03,
-    0xF0, 0x0F, 0xC0, 0x2F, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x3C, 0xFC, 0x00, 0x0B, 0xD0, 0x2F,
-    0x40, 0xF8, 0xFC, 0x00, 0x0F, 0xC0, 0x2F, 0x01, 0xF1, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x03, 0xD2,
-    0xF4, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0xF4, 0x00, 0x1F, 0xF0, 0x01, 0xF0, 0x00,
-    0x2F, 0xF0, 0x02, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0xF0, 0x03, 0xE0, 0x00, 0x3D,
-    0xF4, 0x07, 0xD0, 0x00, 0x7C, 0xF8, 0x07, 0xC0, 0x0A, 0xFE, 0xFE, 0xAF, 0xE8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0A, 0xFE, 0xFE, 0xAF, 0xE8, 0x01, 0xF4, 0x7C, 0x1F, 0x40, 0x01, 0xF0, 0x7C, 0x2F,
-    0x00, 0x2B, 0xFA, 0xFF, 0xBF, 0xA0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1B, 0xE5, 0x7F, 0xBE, 0x50,
-    0x07, 0xD0, 0x2E, 0x7C, 0x00, 0x0B, 0xC0, 0x2F, 0xBC, 0x00, 0x0B, 0xC0, 0x1F, 0xBC, 0x00, 0x0F,
-    0x80, 0x1F, 0xF8, 0x00, 0x0F, 0x40, 0x0F, 0xF4, 0x00, 0x1F, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0x42, 0xD0, 0x00, 0xFC, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0xFC,
-    0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0xFE, 0x7F, 0xFE, 0x01, 0xF4, 0x07, 0xFF, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xF1, 0x7F, 0x95, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x03, 0xFA, 0x90, 0x00,
-    0x3F, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x10, 0x3F, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0F,
-    0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x2F, 0xFE, 0x00, 0x2F, 0x40,
-    0x0F, 0xC3, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x3F, 0x2F, 0xD5, 0xB0, 0x03, 0xF0, 0x02, 0xF8, 0xFC,
-    0x00, 0x00, 0x1F, 0x80, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x7E, 0x57, 0xFD, 0x0F, 0xC0, 0x00, 0x02,
-    0xFF, 0xFF, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x07, 0xE0,
-    0x00, 0xBF, 0x80, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xBF, 0x80, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x7F,
-    0x40, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x03, 0xE0,
-    0x07, 0xE0, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x3F, 0x2D,
-    0x01, 0xFD, 0x03, 0xF0, 0x00, 0xFD, 0xBF, 0xFF, 0xE0, 0x0F, 0xC0, 0x02, 0xF4, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x3D, 0x01, 0xF0, 0x01,
-    0xFC, 0x00, 0xBC, 0x02, 0xF0, 0x02, 0xFC, 0x00, 0xF8, 0x02, 0xF0, 0x03, 0xFC, 0x01, 0xF4, 0x02,
-    0xF0, 0x07, 0xBC, 0x02, 0xF0, 0x02, 0xF0, 0x0F, 0x7C, 0x03, 0xE0, 0x02, 0xF0, 0x1F, 0x78, 0x07,
-    0xC0, 0x03, 0xF0, 0x2E, 0x78, 0x0B, 0xC0, 0x03, 0xE0, 0x3C, 0x78, 0x0F, 0x40, 0x03, 0xE0, 0x7C,
-    0xB8, 0x1F, 0x00, 0x03, 0xE0, 0xF8, 0xB8, 0x3F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xD3, 0xD0, 0xF4, 0xF8, 0x00, 0x03, 0xD7, 0xC0, 0xF4, 0xF4,
-    0x00, 0x03, 0xCB, 0x80, 0xF5, 0xF0, 0x00, 0x03, 0xCF, 0x40, 0xF2, 0xE0, 0x00, 0x07, 0xDF, 0x00,
-    0xF3, 0xC0, 0x00, 0x07, 0xEE, 0x00, 0xF7, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0xFB, 0x40, 0x00, 0x07,
-    0xFC, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFD, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0xBC, 0x00, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xAA, 0xAB, 0xF4, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x01,
-    0xFC, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x02,
-    0xF0, 0x00, 0x7D, 0x02, 0x90, 0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xC0, 0x7C, 0x03, 0xE0, 0x00,
-    0xFC, 0x0B, 0xC0, 0xBC, 0x07, 0xD0, 0x00, 0xF8, 0x0F, 0xC0, 0xFC, 0x0B, 0xC0, 0x00, 0xF8, 0x0F,
-    0x80, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x1F, 0x41, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x2F, 0x01, 0xF0,
-    0x0F, 0x40, 0x03, 0xF0, 0x3F, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x3E, 0x03, 0xF0, 0x2F, 0x00,
-    0x07, 0xD0, 0x3E, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xC0, 0x7D, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0,
-    0xBC, 0x0B, 0xC0, 0x7D, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0xF8, 0x00,
-    0x01, 0xF8, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x01, 0xF5, 0x55, 0x7F, 0xD0,
-    0x00, 0x2F, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3E, 0x03, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x15, 0x5B, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xFF, 0x82, 0xF0,
-    0x00, 0x01, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x7F, 0xD5, 0xBB, 0xF0, 0x00, 0x0F, 0xE0, 0x02, 0xFE,
-    0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x02,
-    0xF4, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x00,
-    0xFE, 0x00, 0x01, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0x07,
-    0xEB, 0xC0, 0x00, 0x07, 0xFF, 0xF8, 0xBC, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0x80, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xAA, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x20, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x17, 0xF5, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x95,
-    0xB8, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F,
-    0x40, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,
-    0x00, 0xBD, 0x3F, 0x80, 0x00, 0x01, 0x7F, 0x7F, 0xD5, 0x50, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF4, 0x00, 0x01,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xC0, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xC0,
-    0x00, 0x00, 0x7E, 0xBF, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xD1, 0xE0, 0x00, 0x3F, 0x6F, 0x7F,
-    0x80, 0x00, 0xE0, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x34, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xA5, 0x6F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x02, 0xFF, 0x80, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x1F, 0xFF,
-    0xF0, 0x02, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x97, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0xBD, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x7F, 0x41, 0xF8, 0x00,
-    0xFC, 0x0B, 0xD0, 0x01, 0xFE, 0x02, 0xF4, 0x00, 0xFC, 0x0B, 0xC0, 0x1F, 0xF8, 0x03, 0xF0, 0x02,
-    0xF8, 0x0F, 0xEA, 0xFF, 0xD0, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0x90, 0x00, 0x07, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0xBC, 0x00, 0x00,
-    0x01, 0xF4, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-    0x3E, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x00, 0x02, 0xF7, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xD0, 0xFF, 0xC0, 0x00, 0x01, 0xFC, 0xBD,
-    0xF0, 0x00, 0x00, 0xFF, 0x7D, 0x3D, 0x00, 0x00, 0xFA, 0xFE, 0x0F, 0x80, 0x00, 0xBC, 0x7F, 0x03,
-    0xE0, 0x00, 0x7D, 0x0F, 0x00, 0xFC, 0x00, 0x3E, 0x02, 0x40, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x09, 0x6F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xAB, 0xFE, 0x00, 0x00, 0x7D, 0x00, 0x7F, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0x80,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2B, 0xFE, 0xAA, 0xBF, 0xE8, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x02,
-    0xF4, 0x00, 0x2F, 0x40, 0x17, 0xF5, 0x55, 0x7F, 0x50, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x6B, 0xFA,
-    0xAA, 0xFE, 0x90, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0x0B, 0xD1, 0x6F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFA, 0xFE, 0x00, 0x1F, 0xF4, 0x78, 0x06, 0x00, 0x0F,
-    0xF0, 0x2D, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xC0, 0x00, 0x03, 0xF4,
-    0x01, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0xBE, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x00,
-    0x0F, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xEA, 0xA9, 0x07, 0xF0, 0x01, 0xFF, 0xFF, 0x82, 0xF8, 0x00,
-    0xBF, 0xFF, 0xD0, 0xBE, 0x00, 0x3D, 0x03, 0xF0, 0x2F, 0x80, 0x0F, 0x00, 0xFC, 0x0B, 0xE0, 0x07,
-    0xC0, 0x3F, 0x01, 0xFC, 0x01, 0xE0, 0x1F, 0x80, 0x3F, 0x00, 0xB4, 0x0B, 0xD0, 0x0F, 0xF0, 0x3D,
-    0x03, 0xF0, 0x01, 0xFE, 0x0F, 0x00, 0xFC, 0x00, 0x2F, 0xFB, 0xD6, 0xFE, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x3D, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xEF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x40, 0x03, 0xF4, 0x00, 0x01, 0xF4,
-    0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFA, 0xBF, 0xE0,
-    0x00, 0x02, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x06, 0xAA, 0xAA, 0xAF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0A, 0xAA, 0xAF, 0xFF, 0xA8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x2A, 0xFF, 0xFE, 0xAA, 0xA0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xF5, 0x55, 0x55,
-    0x50, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x56, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFB, 0xF4, 0x00, 0x7F, 0xD1, 0xE0, 0x10, 0x00, 0xFE, 0x02, 0xD0,
-    0x00, 0x03, 0xF8, 0x03, 0xD0, 0x00, 0x07, 0xF0, 0x03, 0xC0, 0x00, 0x0F, 0xD0, 0x07, 0xC0, 0x00,
-    0x1F, 0xC0, 0x0B, 0x80, 0x00, 0x2F, 0x80, 0x0B, 0x40, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x00, 0x3F,
-    0x00, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x00, 0xBE, 0x00, 0x2E, 0x00, 0x00, 0xBE, 0x00,
-    0x3D, 0x00, 0x00, 0xBE, 0x00, 0x3C, 0x00, 0x00, 0xBE, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0x00, 0x78,
-    0x00, 0x00, 0x3F, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0xC0, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0xF0, 0x00,
-    0x00, 0x0B, 0xFE, 0xF5, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x5F,
-    0xD5, 0x5F, 0xD5, 0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x7E,
-    0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00,
-    0xFC, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x41, 0x00, 0x2F, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xC0, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xAB, 0xFC,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x14, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0A, 0x42,
-    0x80, 0xA4, 0x1F, 0xC0, 0x3F, 0xCF, 0xF3, 0xFC, 0x0F, 0xC0, 0x72, 0xF0, 0xBD, 0x1D, 0x1F, 0xC0,
-    0x76, 0xD0, 0x78, 0x1D, 0x2F, 0x80, 0x3F, 0xC0, 0xB0, 0x1D, 0x7F, 0x00, 0x1F, 0xD0, 0xF0, 0x2E,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFA, 0xBF, 0xF4, 0x00, 0x07, 0xAF, 0xFF, 0xFE, 0x40, 0x00, 0x0B, 0x01,
-    0xD5, 0x74, 0x00, 0x00, 0x0F, 0x02, 0xC0, 0x70, 0x00, 0x00, 0x09, 0x02, 0x80, 0x60, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0x4B, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x56,
-    0xFF, 0x55, 0x50, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x01, 0x5A, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x90, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x06, 0xC0, 0x00,
-    0x1F, 0x86, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xBF, 0x00, 0xBC, 0x00, 0x41, 0xF9, 0xBF, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x01, 0xBF, 0xE4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x02, 0xEB, 0xF0, 0x00, 0x0A, 0x80, 0x1F,
-    0x80, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00,
-    0x7F, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x02, 0xF4, 0x00, 0x3F, 0x80, 0x0B, 0xD0, 0x0B, 0xFC, 0x00,
-    0x3F, 0xAB, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x02, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xC0,
-    0x7C, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFE, 0xAA, 0xAA, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0,
-    0x02, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xD0, 0x03, 0xC1, 0xC0, 0x80, 0x2D,
-    0x00, 0x7C, 0x7D, 0x3E, 0x02, 0xC0, 0x0B, 0xEF, 0xFF, 0xF4, 0x3C, 0x00, 0xBF, 0x8F, 0xD7, 0xEF,
-    0x40, 0x0B, 0xD0, 0x74, 0x1F, 0xE0, 0x02, 0xF8, 0x00, 0x00, 0x10, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x2E, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x47, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD5, 0x68,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x05, 0xBF,
-    0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xE0, 0x3F, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0xBD, 0x00, 0x7E,
-    0x03, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0xFC,
-    0x00, 0x3F, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x7E, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x0F, 0xC0,
-    0x01, 0x50, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFC,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xAB,
-    0xFF, 0xF0, 0x00, 0x1F, 0x80, 0x02, 0xFE, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xC0, 0x02, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00,
-    0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xFC, 0x05, 0xBF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x5F, 0xE5, 0x50, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xAA, 0x80, 0x00,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0x5F, 0xE5, 0x54, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x0F,
-    0x00, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x03, 0xC5, 0x00, 0x07, 0xF8, 0xF0,
-    0x78, 0x00, 0x00, 0xFD, 0x1E, 0x0B, 0x40, 0x00, 0x3F, 0x81, 0xE0, 0xF0, 0x00, 0x07, 0xF0, 0x2D,
-    0x0F, 0x00, 0x00, 0xBE, 0x03, 0xC0, 0xF0, 0x00, 0x0F, 0xC0, 0x3C, 0x1E, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0xAA, 0xBF, 0xFE, 0xAA, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC3, 0xC0, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0x0B, 0x47, 0x80, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xE0, 0x03, 0xFC, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC,
-    0x01, 0xF8, 0x00, 0x2F, 0x80, 0x2F, 0x40, 0x0B, 0xF0, 0x03, 0xFE, 0xAF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x7E, 0x00, 0x2F, 0xC0, 0x0B, 0xD0, 0x00, 0xFD, 0x00,
-    0xFC, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00,
-    0xBE, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xF8, 0x03, 0xFA, 0xAB, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x00, 0x3C, 0x3C, 0x00,
-    0x00, 0x07, 0x83, 0xC0, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x05, 0x55, 0x42, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xC1, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x06, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0xC1, 0xA8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x0B, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFD,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0x5B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t notosans_16_italicBitmaps[42697] = {
+    0x9D, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0xF6, 0x90, 0x73, 0xE1, 0x62, 0x9A, 0x54, 0x5C,
+    0xE1, 0x86, 0x26, 0x48, 0x9C, 0xFF, 0x01, 0xF6, 0xEC, 0xE4, 0x8A, 0x14, 0x34, 0x57, 0xE4, 0x14,
+    0xA1, 0x14, 0x34, 0x34, 0xA4, 0xB9, 0x26, 0x05, 0xC5, 0xDE, 0xDA, 0xA7, 0x48, 0x50, 0x50, 0x50,
+    0xF2, 0x2F, 0xA0, 0xA3, 0xA0, 0xA1, 0x48, 0xB1, 0x7B, 0x3B, 0x51, 0x0A, 0x5A, 0x87, 0x13, 0x15,
+    0x05, 0x16, 0x21, 0x4D, 0x68, 0x06, 0xC9, 0xC0, 0x10, 0x6C, 0x0F, 0xDF, 0x37, 0xDE, 0xBD, 0x1C,
+    0x88, 0x34, 0x58, 0x1E, 0xAF, 0x77, 0xE6, 0xFD, 0xFC, 0xDE, 0xF7, 0x9E, 0x25, 0x33, 0x71, 0x2F,
+    0x45, 0xAD, 0x3A, 0x29, 0x24, 0xB1, 0x72, 0x2E, 0x69, 0x23, 0xBD, 0x68, 0x23, 0x4E, 0xB2, 0x32,
+    0xB6, 0xD8, 0x55, 0xAD, 0xCC, 0x24, 0x31, 0x72, 0x5D, 0xC2, 0x95, 0x95, 0xAA, 0x97, 0xCA, 0x40,
+    0xE1, 0x0D, 0x11, 0x7D, 0xDA, 0x2D, 0xD2, 0xEF, 0xBA, 0x22, 0x35, 0x7D, 0xA1, 0x9A, 0x4E, 0x2B,
+    0x33, 0xD7, 0x51, 0xFB, 0x20, 0x29, 0x05, 0x3A, 0xDF, 0x40, 0x58, 0xDE, 0x15, 0x49, 0x4D, 0x26,
+    0xA2, 0x9A, 0xB4, 0x16, 0xB1, 0xAA, 0x11, 0x99, 0x47, 0x56, 0x64, 0x5F, 0x96, 0xF2, 0xF6, 0xD7,
+    0x2F, 0xD6, 0x67, 0xDA, 0xE3, 0x3A, 0xBD, 0xFB, 0xDB, 0x07, 0xDF, 0x1F, 0x4A, 0x07, 0x5F, 0xD0,
+    0xE8, 0xA8, 0x38, 0x87, 0xF5, 0x7A, 0x8F, 0x8A, 0xBA, 0x56, 0x94, 0xB1, 0x7C, 0xF4, 0xB0, 0xEB,
+    0x70, 0x82, 0x1F, 0xC4, 0x44, 0xBB, 0x2D, 0xED, 0x76, 0x97, 0x76, 0xF7, 0x60, 0x17, 0x57, 0x24,
+    0xD4, 0xC4, 0x03, 0x5B, 0xD1, 0x0A, 0x31, 0xF8, 0x51, 0x32, 0xEF, 0x8D, 0xBE, 0x78, 0xDA, 0xA6,
+    0x8D, 0x15, 0x65, 0x61, 0xDF, 0xC1, 0x7C, 0x91, 0x96, 0x92, 0x3E, 0x33, 0x22, 0x1E, 0x92, 0xDA,
+    0x23, 0xF0, 0x8A, 0xF6, 0x7D, 0x2D, 0xEA, 0x09, 0x76, 0xEC, 0x89, 0xC8, 0xC7, 0x59, 0x29, 0x7B,
+    0x69, 0x53, 0xEA, 0xDB, 0x76, 0xFF, 0xE0, 0x87, 0x0E, 0x01, 0x77, 0xD1, 0xDA, 0x23, 0xD2, 0x85,
+    0x30, 0x12, 0x38, 0x82, 0x3A, 0x7D, 0x6F, 0xAE, 0xAA, 0x91, 0xB8, 0x8D, 0x61, 0x2F, 0x35, 0x49,
+    0x4B, 0x18, 0x75, 0xBD, 0x44, 0xBE, 0x19, 0x22, 0x5B, 0x32, 0x3E, 0x88, 0xCE, 0xE4, 0x11, 0xA2,
+    0x43, 0x2A, 0xBA, 0x46, 0xA2, 0x5D, 0x1E, 0x82, 0x9F, 0xBF, 0x59, 0xCE, 0x55, 0xDB, 0x79, 0x3B,
+    0x4B, 0x9E, 0x3C, 0x7B, 0xE9, 0x8A, 0xE3, 0xCF, 0xBE, 0x6D, 0x96, 0xD9, 0x98, 0xE9, 0x7A, 0xBE,
+    0xF3, 0xF3, 0x2C, 0x20, 0xE2, 0x72, 0x3C, 0x63, 0x4B, 0xF0, 0x12, 0x03, 0x23, 0xA2, 0xCB, 0x19,
+    0xE0, 0xDA, 0x97, 0x19, 0x8C, 0x2E, 0x65, 0xA6, 0x5A, 0xFC, 0xA2, 0x1A, 0x30, 0x9E, 0x79, 0xF8,
+    0x95, 0x74, 0x08, 0x21, 0x1D, 0x6E, 0x63, 0xCB, 0xF9, 0xBF, 0xF2, 0x40, 0xA6, 0xFA, 0xA4, 0x47,
+    0xF6, 0x65, 0x5E, 0xA2, 0xD8, 0x49, 0x03, 0x1C, 0x23, 0xC0, 0xEE, 0x84, 0x9B, 0x60, 0x81, 0xA4,
+    0x8F, 0x47, 0x24, 0xE5, 0x29, 0x5E, 0x38, 0x2A, 0xE2, 0x54, 0xD6, 0x5E, 0xA2, 0x72, 0xFD, 0x5E,
+    0xAB, 0xEC, 0xB9, 0xF4, 0x91, 0xAB, 0x24, 0x33, 0x7D, 0x5E, 0xC6, 0x6E, 0x05, 0xBE, 0x14, 0xE7,
+    0x0A, 0xB0, 0x7A, 0x1A, 0xF0, 0x92, 0xD7, 0xE2, 0x5B, 0xF5, 0xE7, 0xCE, 0x38, 0x40, 0x67, 0xC8,
+    0x4C, 0xE2, 0x1D, 0x68, 0x76, 0xAD, 0x24, 0x60, 0x9F, 0xFE, 0xD4, 0x2D, 0x0B, 0x7D, 0x60, 0xEC,
+    0x03, 0xFC, 0x7B, 0x84, 0x6C, 0x48, 0xB9, 0xAC, 0x86, 0x5B, 0x59, 0x49, 0xE4, 0x50, 0x1A, 0x49,
+    0x5A, 0x32, 0x10, 0x37, 0x90, 0x2F, 0x18, 0x10, 0x32, 0x94, 0x13, 0x9E, 0xB3, 0xBA, 0x57, 0xEF,
+    0x93, 0x70, 0xEF, 0x07, 0x19, 0xA0, 0xA8, 0x51, 0xCC, 0x1A, 0x31, 0x86, 0x9A, 0x80, 0x4C, 0x30,
+    0x2E, 0x21, 0x2D, 0x86, 0x75, 0xA9, 0xB4, 0xDA, 0xDE, 0xCB, 0xB0, 0x1F, 0x6E, 0x38, 0x8E, 0xBB,
+    0x2B, 0xBE, 0x6B, 0x9A, 0x5B, 0xF0, 0x04, 0xDB, 0xDC, 0x0B, 0x01, 0x86, 0x1E, 0x60, 0x16, 0xD0,
+    0xA1, 0x55, 0xA0, 0xFD, 0x16, 0x11, 0xBF, 0xD9, 0x4A, 0xF5, 0xBB, 0x91, 0x1D, 0xFF, 0xCB, 0x08,
+    0xEE, 0x8C, 0x92, 0xB7, 0xEF, 0x4B, 0x4F, 0x96, 0x75, 0xA2, 0x9B, 0x25, 0x94, 0x4F, 0x24, 0xA6,
+    0xBE, 0xDC, 0x98, 0x68, 0xF9, 0x9A, 0xB5, 0x06, 0xC3, 0xB9, 0x8E, 0xEE, 0x3E, 0x3F, 0x7A, 0xAD,
+    0x1C, 0xB2, 0x8B, 0xFA, 0xD8, 0x29, 0x9B, 0xB4, 0xDA, 0xE8, 0x3A, 0x07, 0x8D, 0xAE, 0xCB, 0xB5,
+    0xA3, 0x5B, 0xBE, 0x2F, 0xFC, 0xE3, 0xA3, 0x3B, 0x92, 0x5C, 0x0C, 0xBE, 0xB8, 0x39, 0xB5, 0xAA,
+    0x30, 0x17, 0xE2, 0xCB, 0xCC, 0x98, 0xC9, 0x14, 0x39, 0x17, 0xC9, 0xCB, 0x88, 0x80, 0xFC, 0xFF,
+    0x13, 0x8A, 0xFA, 0x57, 0x8C, 0x77, 0xE4, 0x86, 0x11, 0xFF, 0x85, 0x93, 0x35, 0x14, 0x2A, 0x08,
+    0x16, 0x65, 0xE4, 0x32, 0xD0, 0x02, 0x2A, 0x1A, 0x9D, 0xA4, 0x7E, 0x25, 0xC6, 0xB0, 0xB7, 0x00,
+    0xE3, 0xB2, 0xCF, 0x8D, 0xA4, 0x17, 0xC4, 0x87, 0xD8, 0xC3, 0xC1, 0x02, 0xC6, 0xF3, 0x03, 0x0B,
+    0x1F, 0xBD, 0xA4, 0x6D, 0x51, 0x32, 0x39, 0xE5, 0x64, 0xBC, 0xDD, 0x83, 0xC7, 0x0E, 0x3C, 0xEC,
+    0x42, 0xDE, 0xC2, 0x32, 0xE5, 0x6D, 0xE2, 0x4B, 0xDF, 0xE7, 0x7F, 0xD8, 0x31, 0x3B, 0x6D, 0x4E,
+    0x58, 0x63, 0xD2, 0x8F, 0x47, 0xF0, 0x55, 0x30, 0x70, 0x54, 0x1E, 0x11, 0xAF, 0x18, 0x2A, 0x8E,
+    0x16, 0x0C, 0x37, 0x35, 0xD3, 0xD1, 0x74, 0xED, 0xA2, 0xBF, 0x31, 0x0E, 0x24, 0x19, 0xEF, 0xF5,
+    0xF2, 0x8E, 0x64, 0x9C, 0x14, 0x20, 0x3D, 0x0B, 0x3D, 0xBD, 0x30, 0xD1, 0x20, 0x8D, 0x68, 0x39,
+    0x17, 0xA7, 0x6C, 0x2B, 0x6E, 0x10, 0x06, 0x42, 0xC0, 0x0D, 0x4F, 0x7C, 0x88, 0x0D, 0xF4, 0x14,
+    0x63, 0x0C, 0xED, 0xF5, 0xE2, 0xEC, 0xCB, 0x14, 0x55, 0x34, 0x61, 0x5E, 0x6D, 0xA6, 0x26, 0x1C,
+    0xE6, 0xAF, 0x1C, 0x6A, 0x9A, 0x5F, 0x6D, 0xFD, 0xF0, 0x85, 0xE8, 0xC6, 0x6E, 0xF2, 0x7E, 0x1F,
+    0xC2, 0x1C, 0x45, 0x53, 0xFB, 0xA5, 0x2C, 0x08, 0x90, 0x9C, 0xE4, 0x42, 0x84, 0x2C, 0x4B, 0xCA,
+    0x97, 0x3E, 0x62, 0x40, 0x8B, 0xC3, 0x63, 0x9B, 0xD0, 0xD7, 0x2E, 0x15, 0xA2, 0xA9, 0xD9, 0xE9,
+    0x42, 0x85, 0x18, 0xA1, 0x9A, 0xE3, 0x25, 0xFD, 0x11, 0x9D, 0xE1, 0x60, 0xAC, 0x62, 0xA3, 0xB0,
+    0x24, 0x16, 0x88, 0x0C, 0x30, 0x98, 0x97, 0x2B, 0x98, 0x4B, 0x4D, 0xC4, 0xF6, 0x2F, 0xC0, 0x56,
+    0x8D, 0x57, 0x60, 0x97, 0x97, 0x15, 0x52, 0xF8, 0x0B, 0x6B, 0xBC, 0x7F, 0xF6, 0xD5, 0xCB, 0x3A,
+    0xF4, 0x1A, 0x91, 0x9C, 0xA0, 0x61, 0xC8, 0x51, 0x18, 0x96, 0xBE, 0x86, 0xFB, 0x16, 0x53, 0xBA,
+    0x63, 0x53, 0x04, 0xA9, 0x7C, 0x23, 0xC0, 0x89, 0x1E, 0x66, 0xE3, 0xF0, 0x11, 0xA0, 0x42, 0x2D,
+    0x21, 0x6D, 0x36, 0x49, 0xAD, 0xB7, 0x32, 0x76, 0x63, 0xB1, 0xD8, 0x64, 0xAA, 0x1B, 0xF4, 0xB1,
+    0xDD, 0x2F, 0x8F, 0x2D, 0xA4, 0x2D, 0xA8, 0x85, 0x5C, 0xEE, 0x5C, 0xB2, 0x6D, 0x17, 0x06, 0x0A,
+    0x6C, 0x57, 0xCF, 0x3F, 0x94, 0xAA, 0xE6, 0x10, 0x9B, 0xD6, 0x96, 0xA4, 0x84, 0x28, 0xEE, 0x8E,
+    0x5B, 0xE9, 0x01, 0x78, 0x31, 0x1C, 0xDB, 0xAC, 0x93, 0x01, 0x25, 0xCB, 0x1F, 0x3A, 0x9C, 0xC1,
+    0x8F, 0xFB, 0x07, 0xE3, 0x56, 0xD8, 0xCC, 0x8C, 0xB2, 0x6A, 0x48, 0x5D, 0x88, 0x30, 0x26, 0xDB,
+    0x38, 0xAB, 0xF8, 0x69, 0x7A, 0x88, 0xF5, 0xD4, 0xFB, 0x40, 0x40, 0xF7, 0xAF, 0xAE, 0xC8, 0x37,
+    0xFD, 0x45, 0xA8, 0xE9, 0x34, 0x74, 0xC6, 0x56, 0x68, 0xB5, 0xE1, 0xCB, 0x7F, 0xB5, 0x8F, 0xBA,
+    0x6A, 0x6D, 0x4B, 0x90, 0x32, 0x4C, 0x0E, 0x35, 0xDC, 0xEB, 0x84, 0x83, 0x15, 0xF2, 0x7D, 0xF8,
+    0x12, 0x6F, 0x5E, 0xB2, 0x3A, 0x6D, 0x41, 0xC4, 0xE2, 0x16, 0x07, 0xEC, 0xC8, 0x2F, 0x1A, 0x17,
+    0x32, 0x72, 0xDA, 0xCA, 0x00, 0x16, 0x02, 0x82, 0x3E, 0x10, 0x1E, 0xE1, 0xAD, 0xC2, 0x14, 0xE3,
+    0xF8, 0xE2, 0x87, 0xBD, 0xCE, 0xDB, 0xCC, 0x0A, 0x09, 0x12, 0x53, 0xF3, 0x0A, 0x94, 0xF2, 0x37,
+    0x9D, 0x55, 0xB1, 0x8E, 0xE4, 0x44, 0x10, 0x2D, 0xBB, 0xD9, 0x33, 0x92, 0x03, 0x6F, 0x02, 0x42,
+    0x22, 0x70, 0x84, 0x44, 0xD6, 0x5F, 0x70, 0xD3, 0x16, 0x48, 0x24, 0x44, 0x48, 0x47, 0xB4, 0x7F,
+    0x70, 0xC9, 0xFD, 0xC0, 0xED, 0x78, 0xFE, 0x00, 0x22, 0x62, 0x82, 0x0D, 0x0E, 0x6F, 0x40, 0x4A,
+    0xC0, 0xEC, 0xB4, 0xC4, 0x07, 0x9C, 0x41, 0xE4, 0x38, 0x80, 0xE0, 0x2E, 0x39, 0x07, 0x96, 0xE8,
+    0x3D, 0x79, 0xDC, 0xBC, 0x57, 0xED, 0xBD, 0xDB, 0x5B, 0x2D, 0x01, 0x78, 0xE4, 0xF6, 0x8C, 0xBB,
+    0xAA, 0x5E, 0xD5, 0xAB, 0xD7, 0x35, 0x22, 0xB8, 0xB2, 0xC3, 0x24, 0x79, 0x8C, 0x3B, 0xB3, 0x9C,
+    0x4D, 0xF9, 0x2C, 0xAD, 0xCC, 0x52, 0xF9, 0xBD, 0xE4, 0x93, 0x13, 0xD9, 0x57, 0x5E, 0xEC, 0xE7,
+    0xA3, 0x94, 0xFD, 0x2C, 0x06, 0x2F, 0xB2, 0xB9, 0x1C, 0xB2, 0x98, 0x2D, 0x5F, 0x44, 0x6F, 0xE3,
+    0xDF, 0xF8, 0xFA, 0xDB, 0x84, 0x08, 0x33, 0xEE, 0x2D, 0x6E, 0x38, 0x48, 0xED, 0x05, 0xEE, 0x78,
+    0x0E, 0x0F, 0xBE, 0x6A, 0x61, 0x10, 0x7B, 0x69, 0xE3, 0x4E, 0xE4, 0x11, 0xA1, 0x4E, 0xE5, 0x98,
+    0xE3, 0x93, 0x05, 0xB9, 0xE7, 0xAA, 0x1B, 0xE7, 0x5B, 0xEF, 0x9A, 0xF7, 0x90, 0x92, 0xC8, 0x51,
+    0x6C, 0x9F, 0x1F, 0xA5, 0xDE, 0xC9, 0xBF, 0x5D, 0xB5, 0x37, 0x01, 0x90, 0x65, 0x0F, 0xFC, 0xBA,
+    0x31, 0x83, 0x3C, 0xA5, 0xDF, 0x7A, 0xE5, 0x48, 0xA1, 0x1C, 0x45, 0x2C, 0xA0, 0x0E, 0x03, 0xEA,
+    0x6B, 0xA4, 0x3C, 0xE2, 0x27, 0xD2, 0x6D, 0x7B, 0x3C, 0x71, 0x17, 0x78, 0x27, 0xE5, 0x02, 0x63,
+    0x8B, 0x1D, 0x69, 0x03, 0xA9, 0x18, 0xE0, 0xCA, 0x72, 0x8A, 0x37, 0x91, 0xDA, 0x18, 0x23, 0xEF,
+    0xBB, 0xF0, 0x8F, 0xBB, 0xEE, 0x87, 0x75, 0x8F, 0x31, 0xE4, 0x53, 0xDC, 0x25, 0xDC, 0x33, 0x56,
+    0x5B, 0xF0, 0x55, 0xCD, 0x32, 0x9F, 0xE0, 0x95, 0x1C, 0xF0, 0x2A, 0x57, 0x24, 0x0F, 0x8C, 0x5E,
+    0xA1, 0x91, 0x59, 0x16, 0x07, 0xFD, 0x9A, 0x5F, 0x63, 0xEB, 0xFB, 0x77, 0x6A, 0x8B, 0x8D, 0x8D,
+    0xE0, 0xF9, 0x2C, 0xBC, 0xAF, 0x8C, 0xCE, 0x89, 0x54, 0x3C, 0x40, 0x88, 0x41, 0x5D, 0x08, 0xD6,
+    0xEE, 0xC4, 0x0E, 0x52, 0x4E, 0x68, 0x8A, 0x52, 0x5F, 0xC0, 0xE0, 0x67, 0xB9, 0xC5, 0x41, 0x86,
+    0x62, 0xDD, 0x4E, 0x0A, 0xA4, 0xD1, 0xE2, 0x57, 0x93, 0xD2, 0x7E, 0xC1, 0xF5, 0x49, 0x64, 0x96,
+    0xD5, 0xF2, 0x1D, 0x92, 0xC9, 0x10, 0xAB, 0xEE, 0xC5, 0xF2, 0x85, 0xCF, 0x83, 0x76, 0x02, 0x28,
+    0xA7, 0x88, 0x19, 0x50, 0x7D, 0xF3, 0xB4, 0xF4, 0x25, 0xCA, 0x9F, 0x36, 0x72, 0x25, 0x93, 0xF9,
+    0x75, 0x2C, 0xFB, 0xC2, 0x57, 0x5F, 0xFA, 0x8D, 0x58, 0x79, 0xB8, 0xC9, 0x46, 0x18, 0x8D, 0x53,
+    0xE5, 0x4D, 0x5F, 0xFC, 0xD2, 0x6F, 0xA4, 0x16, 0x5B, 0x35, 0x01, 0x89, 0x4E, 0x0F, 0xCD, 0x50,
+    0x8C, 0xA5, 0xC7, 0x56, 0xEB, 0xCF, 0xCD, 0x50, 0xBF, 0x7A, 0xFE, 0x6A, 0xA8, 0xBC, 0x9D, 0x6B,
+    0x34, 0xB5, 0x39, 0x91, 0x93, 0x46, 0xE5, 0xB2, 0x2A, 0x87, 0x1C, 0xA5, 0xD4, 0x0F, 0xBF, 0x7F,
+    0x38, 0x27, 0xD6, 0x51, 0xA5, 0x7C, 0x1C, 0xFF, 0xBC, 0x4D, 0x8B, 0x7A, 0x1C, 0x58, 0x08, 0x7B,
+    0x67, 0x94, 0xE9, 0x3F, 0x98, 0xF7, 0x73, 0x2A, 0xEE, 0x1B, 0x2C, 0xAE, 0xC4, 0xB2, 0xE5, 0x32,
+    0x43, 0x18, 0xF9, 0x54, 0xF4, 0xA0, 0xAB, 0x00, 0x4D, 0x3D, 0x04, 0x82, 0x2C, 0x47, 0xB1, 0x8C,
+    0xAC, 0xE1, 0x97, 0xEE, 0x72, 0x04, 0x77, 0xF9, 0x84, 0xB7, 0xB0, 0x1C, 0x24, 0x0B, 0x20, 0x39,
+    0x0B, 0x64, 0x62, 0x26, 0xD4, 0x7C, 0xA5, 0xE2, 0xB6, 0x4C, 0x82, 0x5D, 0x36, 0x5C, 0xEA, 0x1D,
+    0x04, 0xB2, 0x17, 0x13, 0xF2, 0x09, 0xFD, 0xE6, 0xF9, 0xD8, 0xF1, 0xA0, 0x40, 0xD3, 0x28, 0x17,
+    0x62, 0x6F, 0xDC, 0xCB, 0xC3, 0x08, 0xF3, 0x6B, 0x9A, 0x87, 0x1B, 0xF3, 0x3C, 0x00, 0xC4, 0x8C,
+    0x30, 0xAF, 0x3C, 0x0A, 0x76, 0x19, 0xDB, 0x06, 0xF3, 0x6A, 0x80, 0x73, 0x44, 0x2A, 0x87, 0xB1,
+    0xA0, 0xC8, 0xAC, 0x36, 0x26, 0x5D, 0x16, 0x67, 0x07, 0x07, 0x13, 0xEA, 0x5E, 0x2E, 0x27, 0xCA,
+    0xF6, 0x94, 0x6D, 0x07, 0x32, 0xF5, 0x49, 0x76, 0xAA, 0x7E, 0x3D, 0x70, 0xDA, 0xBC, 0xC4, 0x8E,
+    0x2E, 0x2D, 0x97, 0xAB, 0x7B, 0x96, 0xF6, 0x8D, 0x89, 0xA3, 0x5B, 0x4D, 0x71, 0x96, 0xCB, 0xD7,
+    0x3F, 0x11, 0x87, 0x32, 0x51, 0xBA, 0x1F, 0x29, 0xF6, 0x05, 0xE2, 0xF3, 0xF4, 0x6A, 0xD1, 0xA8,
+    0xAE, 0x1D, 0x58, 0x06, 0xD8, 0x40, 0xE3, 0x76, 0xA8, 0xA3, 0x18, 0xA9, 0xC3, 0x99, 0x67, 0xD9,
+    0x61, 0x07, 0x75, 0x21, 0xAE, 0x56, 0x28, 0x33, 0x77, 0x1C, 0x77, 0x6A, 0x0C, 0x12, 0xB0, 0x74,
+    0xB3, 0x93, 0xCF, 0x64, 0xF9, 0x48, 0x61, 0x2E, 0xF0, 0xC9, 0x22, 0x5C, 0x1F, 0x44, 0xA9, 0x5E,
+    0xFE, 0xB8, 0xE0, 0x20, 0xC4, 0x23, 0xD3, 0xF8, 0x56, 0xD1, 0x63, 0x6F, 0x58, 0xB9, 0x8B, 0xD1,
+    0x17, 0x4C, 0x72, 0xCF, 0x44, 0xFD, 0x3A, 0x6B, 0x88, 0xA1, 0x33, 0xC4, 0x52, 0x05, 0x4B, 0x77,
+    0x41, 0xBB, 0x06, 0x0E, 0x93, 0x8A, 0xA9, 0xEC, 0xEF, 0xDA, 0xD5, 0xB0, 0xCB, 0xA7, 0xB5, 0x74,
+    0xF3, 0xBA, 0x7B, 0x46, 0x01, 0x50, 0xD5, 0xE1, 0x3F, 0x62, 0x91, 0x75, 0xD7, 0x75, 0x09, 0x0B,
+    0x31, 0xEE, 0xC3, 0xDA, 0xDD, 0xC6, 0x1A, 0x57, 0x81, 0xAB, 0xDD, 0x7A, 0x95, 0xD0, 0xC6, 0x2A,
+    0xC3, 0xD7, 0x97, 0x81, 0x8D, 0xFD, 0x28, 0xB5, 0x23, 0xF5, 0xC4, 0xDF, 0x74, 0x56, 0x7B, 0xAC,
+    0xA1, 0x14, 0x01, 0x01, 0xB3, 0xEE, 0x02, 0xDB, 0x71, 0xC1, 0x9C, 0x71, 0xF1, 0xB3, 0x40, 0xD4,
+    0x2B, 0x82, 0xA8, 0x62, 0x69, 0xBE, 0xA5, 0xA5, 0xC5, 0x20, 0xC5, 0x0E, 0xCE, 0x3D, 0xE0, 0x0F,
+    0x7F, 0x9D, 0x05, 0x20, 0x46, 0x0E, 0x3F, 0xE2, 0xCA, 0x07, 0x92, 0x8A, 0x31, 0x83, 0x51, 0x07,
+    0xC7, 0xE4, 0x58, 0xF7, 0x2C, 0xE7, 0x0C, 0x88, 0x4C, 0xB3, 0xA0, 0x93, 0xA6, 0x61, 0xC7, 0xA6,
+    0xD4, 0x60, 0x3A, 0x8C, 0xF9, 0xD2, 0x75, 0x0B, 0x79, 0x52, 0xC6, 0x40, 0xD9, 0x76, 0x75, 0x80,
+    0xB9, 0x8E, 0x26, 0x75, 0x10, 0x75, 0xD0, 0x39, 0xC5, 0xE4, 0x37, 0x3A, 0x9B, 0x14, 0x6C, 0x9F,
+    0x1C, 0x0A, 0x75, 0xA0, 0xBC, 0x0D, 0x5B, 0x7E, 0x9D, 0xD2, 0x19, 0xD3, 0x10, 0x43, 0x22, 0xE7,
+    0x89, 0xFE, 0x34, 0xF3, 0x08, 0xFF, 0x76, 0x3B, 0xA5, 0x2C, 0x09, 0x52, 0x39, 0x0F, 0x2A, 0x7E,
+    0xFC, 0xC5, 0x94, 0x51, 0x49, 0xDA, 0xAF, 0x6C, 0xCD, 0xA9, 0x1D, 0x94, 0x1A, 0xB3, 0xA0, 0x23,
+    0x6F, 0xC6, 0xA7, 0x77, 0xE5, 0xDF, 0xDE, 0xEC, 0x18, 0xBB, 0xEB, 0xD6, 0xA6, 0x6D, 0xD6, 0x9E,
+    0xDD, 0x09, 0xA5, 0x61, 0xD6, 0x50, 0xD5, 0x20, 0x9F, 0xB4, 0x1E, 0x54, 0xE0, 0x30, 0x60, 0xEB,
+    0x44, 0x39, 0xA5, 0x37, 0xE2, 0xB9, 0x06, 0x16, 0xAE, 0x81, 0x8B, 0x6B, 0x10, 0x03, 0x8B, 0xE5,
+    0x82, 0xF3, 0xC1, 0x32, 0xB0, 0x64, 0x01, 0x53, 0x59, 0xF6, 0x5C, 0x5C, 0xCB, 0xE9, 0x85, 0xBF,
+    0x01, 0x1C, 0x33, 0xC2, 0x2C, 0xCC, 0x65, 0x9F, 0x8A, 0xD5, 0x33, 0x85, 0x76, 0x83, 0xBB, 0x89,
+    0x75, 0x6C, 0x99, 0x11, 0xE3, 0x63, 0x98, 0xF0, 0xD9, 0xB2, 0x98, 0xAA, 0xCF, 0xD3, 0x1F, 0xC0,
+    0xFF, 0xBA, 0xFE, 0x01, 0xB5, 0x55, 0xBD, 0x6E, 0xEC, 0x44, 0x14, 0x3E, 0xF6, 0x08, 0xB9, 0x70,
+    0x31, 0x15, 0xA2, 0xA0, 0x98, 0x47, 0x98, 0x27, 0x88, 0xC7, 0x12, 0x25, 0x0D, 0x4D, 0x78, 0x8D,
+    0xFB, 0x02, 0x77, 0xB3, 0x96, 0x28, 0x28, 0x28, 0xEE, 0x7D, 0x03, 0x68, 0x10, 0x28, 0xBC, 0xC2,
+    0xEE, 0x7A, 0xBA, 0x14, 0xB7, 0xC0, 0x88, 0x82, 0x32, 0xD3, 0x50, 0x70, 0x1B, 0x2C, 0x62, 0x29,
+    0x56, 0xAE, 0x9D, 0xE1, 0xFB, 0xCE, 0x26, 0x61, 0x03, 0x17, 0x51, 0xB1, 0xC9, 0x7A, 0xD6, 0x3E,
+    0x33, 0xE7, 0x7C, 0xDF, 0x77, 0x7E, 0x2C, 0x5E, 0xC4, 0x46, 0x31, 0xA3, 0x14, 0xB3, 0xC8, 0x5E,
+    0xE4, 0xEF, 0xF7, 0xE1, 0x78, 0x9F, 0x9E, 0xDF, 0x57, 0xB8, 0x9F, 0x9E, 0xEE, 0xDF, 0x5E, 0x7E,
+    0x97, 0xF3, 0x3D, 0xFE, 0xC5, 0x0F, 0x22, 0xF5, 0x22, 0x21, 0xE1, 0x29, 0x96, 0x11, 0xFE, 0x66,
+    0xD9, 0x62, 0x09, 0x93, 0x1C, 0xB0, 0xDC, 0x8F, 0xB2, 0xC2, 0xF5, 0xED, 0x28, 0xF3, 0x24, 0xE6,
+    0x46, 0x97, 0xEA, 0x97, 0x54, 0x4C, 0xB3, 0xD8, 0xAB, 0xA1, 0x1C, 0x67, 0x71, 0x75, 0x34, 0xE3,
+    0x22, 0x8D, 0xC5, 0xB2, 0x93, 0x1D, 0x96, 0xB4, 0x93, 0xD9, 0x75, 0xD5, 0xF0, 0xB2, 0x1C, 0x7D,
+    0x5B, 0xC7, 0x8D, 0x19, 0x02, 0x20, 0x9C, 0xD9, 0x88, 0xA5, 0x3B, 0x73, 0x6D, 0x10, 0xD7, 0x35,
+    0x41, 0x2E, 0xC4, 0xB7, 0xCD, 0x06, 0x90, 0x3C, 0x63, 0x22, 0xB8, 0xF8, 0x11, 0x4B, 0x23, 0x2E,
+    0x01, 0xFA, 0x46, 0x5C, 0xC4, 0xB2, 0xC3, 0x91, 0x12, 0xC0, 0x7D, 0x27, 0x32, 0x4B, 0x16, 0xA9,
+    0x06, 0xB3, 0xE2, 0xB6, 0x75, 0x8B, 0x60, 0x73, 0x3F, 0x82, 0xB9, 0xB9, 0x4D, 0xD8, 0x65, 0x5F,
+    0x45, 0x1C, 0x6A, 0xBC, 0x94, 0x63, 0x31, 0x5D, 0x20, 0x60, 0x1D, 0xE9, 0x33, 0x94, 0x13, 0xDC,
+    0x2C, 0x26, 0xD5, 0x83, 0x49, 0x36, 0x7A, 0x71, 0xAD, 0x6B, 0x17, 0xF8, 0x0D, 0x26, 0x41, 0xB4,
+    0x9D, 0xEB, 0x6C, 0x57, 0xCC, 0x7B, 0xA0, 0x31, 0x7F, 0x8C, 0x88, 0x54, 0x5F, 0xE3, 0xA0, 0xD8,
+    0x03, 0x75, 0x82, 0x06, 0xD0, 0x70, 0x1B, 0x2B, 0x88, 0x94, 0x29, 0x74, 0x89, 0xA0, 0xC7, 0x8F,
+    0xCB, 0xAF, 0x61, 0x81, 0x80, 0xD2, 0xFF, 0x06, 0x10, 0x7D, 0x57, 0xDC, 0xCB, 0xB6, 0x05, 0xE6,
+    0xD0, 0x8A, 0x99, 0x88, 0xF6, 0x00, 0xD5, 0xC5, 0xBD, 0x81, 0xB0, 0xE6, 0x06, 0x04, 0x64, 0xE1,
+    0xD9, 0xB0, 0xE5, 0xD9, 0x6B, 0x98, 0xAB, 0x77, 0xB0, 0x94, 0x77, 0xF0, 0x2F, 0xEB, 0x01, 0x97,
+    0x2D, 0xCF, 0xF8, 0x2B, 0x48, 0x6E, 0x07, 0xEC, 0xB4, 0x63, 0x88, 0x52, 0x8F, 0x15, 0x64, 0x9E,
+    0xA4, 0xFF, 0xF5, 0xC5, 0x2C, 0x75, 0xCE, 0xD4, 0x21, 0x03, 0x8B, 0x7C, 0x48, 0x08, 0x3E, 0x7F,
+    0x23, 0x26, 0xE7, 0x24, 0x21, 0xE7, 0xAE, 0x4A, 0xE5, 0x0A, 0x29, 0x6B, 0xD0, 0x04, 0xF2, 0x05,
+    0xAA, 0x20, 0x7C, 0x00, 0xF3, 0x2A, 0xF9, 0x56, 0x56, 0x30, 0xF5, 0x90, 0xDF, 0x4D, 0x38, 0xB0,
+    0x2A, 0xEE, 0xFA, 0xEE, 0x5B, 0x0A, 0xA8, 0xC5, 0xA1, 0xA5, 0x02, 0x61, 0x00, 0x88, 0x48, 0xC1,
+    0x9C, 0xF5, 0x24, 0xD0, 0x04, 0xC5, 0x31, 0x88, 0xFC, 0x6F, 0xA4, 0x83, 0x92, 0xFE, 0xF2, 0x9F,
+    0xA4, 0x6B, 0x25, 0x3D, 0x3D, 0x23, 0xFD, 0x11, 0x1D, 0x0A, 0x7D, 0x61, 0x23, 0xAF, 0xF7, 0x8A,
+    0x89, 0xA6, 0xF2, 0x7B, 0x6E, 0x7A, 0xFD, 0x24, 0x47, 0xAC, 0x52, 0xA1, 0x72, 0x8C, 0xFF, 0x2A,
+    0x47, 0xE8, 0xC2, 0x79, 0x3F, 0xE2, 0x00, 0xCA, 0x1D, 0x31, 0xEA, 0x01, 0xCF, 0x17, 0xFC, 0xD9,
+    0x68, 0x59, 0x77, 0x07, 0xC8, 0x61, 0x58, 0x0F, 0x01, 0xE5, 0x5A, 0xCE, 0x38, 0x60, 0x23, 0xE4,
+    0x58, 0xE1, 0xAF, 0x1A, 0x8F, 0x6A, 0x7C, 0x0C, 0x54, 0x16, 0xB1, 0x4C, 0xFE, 0x61, 0x96, 0x5E,
+    0x8A, 0x56, 0x95, 0x24, 0x61, 0xD7, 0x3D, 0xFE, 0xC0, 0x13, 0xC9, 0xD0, 0xD5, 0x10, 0xAB, 0x5D,
+    0x45, 0xDB, 0x0B, 0x24, 0x20, 0x83, 0xF4, 0x7C, 0x3E, 0x3F, 0xEC, 0x7A, 0xDA, 0x6E, 0xE6, 0x02,
+    0x26, 0xB9, 0x38, 0xEF, 0x87, 0x8A, 0xE4, 0x3D, 0x00, 0xCA, 0x07, 0x9F, 0x51, 0xF7, 0x9C, 0x5F,
+    0xE0, 0x7B, 0x8D, 0x2F, 0xB2, 0xD9, 0x1E, 0x33, 0xA7, 0x79, 0x5A, 0x1E, 0x72, 0x75, 0xFA, 0x50,
+    0x53, 0x7A, 0x78, 0xDF, 0xC3, 0xFD, 0x43, 0x8A, 0xDF, 0xFB, 0x90, 0xBE, 0x6C, 0x87, 0x5F, 0x55,
+    0x02, 0x8B, 0x72, 0x62, 0xFA, 0x77, 0xDC, 0x15, 0xD4, 0x42, 0x0D, 0x4E, 0x2C, 0xCB, 0x5F, 0x96,
+    0x4E, 0x2D, 0x08, 0x06, 0x4B, 0x3C, 0xB5, 0x38, 0x5A, 0xEA, 0x01, 0x67, 0xCC, 0xC8, 0x29, 0x44,
+    0x91, 0x65, 0x85, 0xFE, 0x68, 0xA9, 0x6A, 0xFD, 0x1C, 0x2D, 0xDD, 0x67, 0xF6, 0x75, 0xA6, 0x3A,
+    0x05, 0xC0, 0xA2, 0x37, 0x75, 0xD2, 0x88, 0x7F, 0x43, 0x47, 0x70, 0x59, 0xA7, 0x8D, 0x68, 0xF6,
+    0xCA, 0x19, 0x1E, 0x90, 0xA1, 0x4E, 0xD8, 0x9F, 0x86, 0xE3, 0xC2, 0x77, 0xBA, 0xD4, 0x11, 0x78,
+    0x3C, 0x29, 0xEC, 0x91, 0xB4, 0x62, 0xD2, 0x91, 0x07, 0x52, 0xF6, 0x0B, 0x38, 0x6A, 0xA8, 0xC1,
+    0x02, 0x9A, 0xE6, 0x1D, 0x3C, 0x5A, 0xE6, 0xC2, 0x53, 0xB7, 0xFE, 0x31, 0x4F, 0x1B, 0x25, 0xEF,
+    0x81, 0xD1, 0x47, 0x71, 0x57, 0x89, 0x05, 0x56, 0xFF, 0x34, 0x73, 0x32, 0x9A, 0x11, 0x93, 0xE1,
+    0x77, 0xB0, 0xC2, 0x1C, 0xBA, 0x1D, 0x38, 0x48, 0x38, 0x02, 0x2F, 0x30, 0x18, 0x5E, 0x9E, 0x71,
+    0xBC, 0x48, 0xB0, 0x2D, 0x66, 0x48, 0x74, 0x9F, 0x0C, 0x9C, 0x80, 0x36, 0x4E, 0xC4, 0x53, 0x0D,
+    0x0D, 0x6B, 0x07, 0xF7, 0x1D, 0x4B, 0x6A, 0x32, 0x60, 0xC0, 0xF1, 0x38, 0x23, 0xCC, 0xD2, 0x48,
+    0x83, 0x5E, 0x0B, 0x5E, 0x2C, 0x08, 0xD6, 0x3F, 0x76, 0xE5, 0x4D, 0x92, 0xF2, 0x36, 0xCA, 0x1E,
+    0x98, 0xFA, 0xA4, 0x15, 0x02, 0x78, 0x88, 0xCD, 0x6F, 0x09, 0x6D, 0xD0, 0xDA, 0xEC, 0x33, 0xD6,
+    0xBE, 0x56, 0x14, 0xF8, 0x03, 0x06, 0x07, 0x54, 0x0B, 0x24, 0xEC, 0x59, 0xEA, 0x80, 0x1F, 0x24,
+    0x53, 0x25, 0x26, 0xD6, 0x46, 0x2D, 0xB6, 0x4F, 0xD9, 0x1D, 0x0D, 0x6B, 0x43, 0x32, 0x19, 0x17,
+    0x99, 0x3F, 0x8D, 0x76, 0x12, 0x67, 0x3E, 0xDC, 0xD3, 0xA1, 0xFB, 0x9A, 0xBA, 0x03, 0x18, 0x0F,
+    0x52, 0x90, 0x3D, 0x5F, 0x16, 0x15, 0x07, 0x24, 0x82, 0x1E, 0x5F, 0x2F, 0x10, 0x07, 0xE1, 0xD8,
+    0x0C, 0x4C, 0x1F, 0x70, 0xE8, 0x74, 0x16, 0xF7, 0xD5, 0xA0, 0x1A, 0x69, 0x53, 0x61, 0x12, 0x88,
+    0x76, 0x0D, 0x36, 0x74, 0x38, 0xB0, 0x68, 0xDF, 0x00, 0x09, 0xC6, 0xAC, 0x54, 0x3F, 0x33, 0x15,
+    0x7B, 0xC6, 0x84, 0xEE, 0x8E, 0x70, 0xD6, 0xD3, 0xF9, 0xC3, 0x24, 0x69, 0x39, 0xEB, 0xFC, 0x49,
+    0xA7, 0xF3, 0x47, 0xC7, 0x2E, 0x7A, 0x2D, 0xB3, 0xC3, 0x73, 0x2C, 0x32, 0xFB, 0x1C, 0x36, 0xEE,
+    0xD6, 0x76, 0x54, 0x46, 0xDA, 0x4C, 0x84, 0x77, 0x4C, 0xAA, 0x5E, 0x34, 0xC4, 0x71, 0x52, 0xF4,
+    0x4F, 0xE3, 0x43, 0x0B, 0x3D, 0x90, 0x32, 0xAA, 0x50, 0x98, 0xF3, 0x47, 0x61, 0x87, 0xC7, 0x4B,
+    0x7D, 0x77, 0x79, 0xD9, 0x19, 0x6D, 0xB5, 0xCC, 0x19, 0x81, 0xC0, 0x51, 0xB6, 0xA8, 0xB3, 0xB7,
+    0xDD, 0xB1, 0xDC, 0xF9, 0x3A, 0xE2, 0xC8, 0x2C, 0xB5, 0xCE, 0x15, 0x2F, 0xAA, 0x88, 0xA5, 0xBF,
+    0x3B, 0x72, 0x7A, 0x6E, 0x26, 0x75, 0xBE, 0xBC, 0x9E, 0x99, 0x3B, 0x7D, 0x27, 0x7B, 0x3A, 0x47,
+    0x3A, 0x57, 0x29, 0xCE, 0x5B, 0xF9, 0xAF, 0xCF, 0x9F, 0x8D, 0x55, 0xBB, 0x92, 0xDC, 0x44, 0x14,
+    0x3D, 0xAD, 0xC6, 0x16, 0x55, 0x0A, 0xFA, 0x03, 0x08, 0x94, 0x51, 0x05, 0x81, 0xF5, 0x03, 0xEC,
+    0xB6, 0x70, 0xB2, 0x21, 0x04, 0x6C, 0x44, 0x40, 0x4A, 0x84, 0x7F, 0xC0, 0x23, 0xE9, 0x13, 0x88,
+    0xCC, 0x67, 0xF8, 0x07, 0x66, 0x76, 0x44, 0xB4, 0x69, 0x13, 0x00, 0xA1, 0xBB, 0x78, 0xC4, 0xB4,
+    0xAB, 0xE4, 0xAA, 0x31, 0xB4, 0xD4, 0x9C, 0xDB, 0x9A, 0x59, 0xAF, 0xB1, 0xD7, 0x58, 0x89, 0xA4,
+    0xEE, 0xDB, 0xF7, 0x9E, 0x7B, 0xCE, 0xD1, 0xD5, 0x06, 0x93, 0xF6, 0x66, 0xB4, 0xD8, 0xAA, 0x50,
+    0x3A, 0xD3, 0x9E, 0x23, 0x16, 0xA1, 0x1A, 0x6B, 0x6C, 0x70, 0x90, 0x8D, 0x86, 0x1B, 0x93, 0x76,
+    0x66, 0x38, 0x47, 0x99, 0x46, 0xEC, 0x23, 0xEE, 0x3F, 0x1D, 0xA0, 0x0E, 0x40, 0xDD, 0xA2, 0x08,
+    0x80, 0x05, 0xB4, 0x07, 0xC3, 0x51, 0x8D, 0x40, 0x04, 0x0C, 0x6F, 0x6F, 0x6C, 0x77, 0x40, 0xE9,
+    0x80, 0xED, 0x7F, 0xB7, 0x1B, 0x6E, 0x07, 0xD9, 0xD6, 0xC9, 0xA1, 0x8F, 0x50, 0x97, 0x2D, 0x57,
+    0x18, 0xA2, 0x98, 0x09, 0x89, 0x2F, 0x1D, 0xB7, 0xCF, 0xCF, 0x78, 0x8E, 0xE9, 0xAB, 0x61, 0x82,
+    0x76, 0x0D, 0x4F, 0x6A, 0x87, 0x89, 0xD9, 0xB6, 0x30, 0xED, 0x19, 0x5F, 0x99, 0xE6, 0xCC, 0x0C,
+    0xA8, 0xAE, 0x79, 0x72, 0xE2, 0x41, 0x34, 0x29, 0x1D, 0x52, 0x4A, 0x3F, 0x5D, 0x5E, 0x5E, 0xE2,
+    0x53, 0xCC, 0x88, 0x6A, 0x2A, 0x42, 0x31, 0x22, 0x5F, 0x7B, 0xFF, 0x19, 0x6C, 0xBA, 0x1E, 0xCD,
+    0x8B, 0x2E, 0xEA, 0x03, 0xD2, 0xB0, 0x47, 0x39, 0x11, 0x97, 0x65, 0x5B, 0x3A, 0xD8, 0x16, 0x96,
+    0x98, 0x4A, 0x4F, 0xE8, 0xBB, 0xD2, 0x13, 0x70, 0x47, 0x34, 0x7C, 0xB0, 0x43, 0x87, 0x6A, 0xD2,
+    0xA1, 0x48, 0xAD, 0xFD, 0x71, 0x09, 0x2A, 0x2D, 0x0D, 0x39, 0x79, 0xE8, 0xA1, 0x24, 0xA9, 0x22,
+    0x56, 0x69, 0x3F, 0x37, 0x28, 0xFC, 0xA0, 0xE1, 0x8A, 0xF4, 0x28, 0x1C, 0xE4, 0x2E, 0xD1, 0x55,
+    0x33, 0xAA, 0x5F, 0xD3, 0x84, 0xF9, 0x65, 0x3F, 0x9A, 0x48, 0x5C, 0x89, 0x75, 0x6A, 0x87, 0xAE,
+    0x88, 0x52, 0xB0, 0x45, 0xC7, 0xB8, 0xCA, 0x91, 0xAD, 0x99, 0x74, 0x99, 0x71, 0xC7, 0xCA, 0xC6,
+    0xC1, 0xB6, 0x33, 0xCA, 0x50, 0x07, 0x35, 0x17, 0xFF, 0xB8, 0xFD, 0xF0, 0xC0, 0x26, 0xAF, 0xDD,
+    0x5E, 0x1A, 0xFD, 0x72, 0xED, 0x08, 0x75, 0x1A, 0x74, 0x4A, 0xB0, 0x7F, 0x7E, 0xCB, 0x86, 0xD0,
+    0xAC, 0x4A, 0x54, 0x7E, 0xAD, 0xCD, 0xC7, 0x92, 0xE5, 0xEB, 0x21, 0xEB, 0x20, 0xD8, 0x04, 0x0D,
+    0xF3, 0xA2, 0xF6, 0x1F, 0x91, 0xAA, 0xC8, 0xE3, 0x0E, 0x6A, 0xCD, 0xF5, 0x15, 0x56, 0xC5, 0x72,
+    0x38, 0x76, 0x27, 0xE8, 0xD2, 0x15, 0xCE, 0xA5, 0xCF, 0x09, 0xD5, 0x42, 0x2D, 0x52, 0xB2, 0x10,
+    0x02, 0xB1, 0xC0, 0xFA, 0x2A, 0xA0, 0x6F, 0x59, 0x2A, 0x66, 0x06, 0x8D, 0x40, 0xB7, 0x52, 0x2C,
+    0xA2, 0x98, 0x32, 0x85, 0x4C, 0xD6, 0x8B, 0xCA, 0x07, 0x06, 0x34, 0x2E, 0x73, 0x68, 0x42, 0xB7,
+    0x65, 0xE1, 0xDF, 0x02, 0xEA, 0x99, 0xDA, 0x29, 0x9C, 0xAE, 0x66, 0x41, 0xEE, 0xE5, 0xE7, 0x59,
+    0xC2, 0x9B, 0xA1, 0xF4, 0x11, 0xCD, 0x85, 0x57, 0xD1, 0x7E, 0xBE, 0x77, 0x29, 0x45, 0x9D, 0x96,
+    0xB6, 0xFE, 0xFE, 0x6D, 0xBD, 0xB4, 0x4D, 0x9A, 0xD7, 0x5E, 0x44, 0x0C, 0xDC, 0x63, 0x47, 0x3A,
+    0x09, 0x09, 0x34, 0x92, 0x3A, 0x69, 0x93, 0x29, 0x51, 0x42, 0x9E, 0x18, 0x56, 0xED, 0x17, 0xD9,
+    0x67, 0x9E, 0xAF, 0x5F, 0xB4, 0xAB, 0x66, 0xE2, 0xD2, 0x5B, 0x4D, 0xB3, 0x0C, 0xBB, 0xB8, 0x7D,
+    0x38, 0xCB, 0x5C, 0xFA, 0xA3, 0xC4, 0xF9, 0x2D, 0x87, 0x67, 0xC6, 0x36, 0x6F, 0x84, 0x67, 0x33,
+    0xC8, 0xDB, 0x27, 0x8B, 0x98, 0x8F, 0x91, 0xC5, 0x72, 0xD3, 0x2C, 0xC9, 0xD4, 0xA3, 0x4A, 0xA9,
+    0x26, 0x99, 0xDF, 0xDD, 0x41, 0x66, 0xFD, 0x1E, 0x64, 0x4E, 0x99, 0xCC, 0xDF, 0x6F, 0xC8, 0xCC,
+    0x30, 0x6E, 0x7A, 0xB8, 0xC2, 0x87, 0x62, 0x01, 0xFB, 0x84, 0x44, 0x24, 0xFA, 0x0F, 0x4F, 0x5F,
+    0xBE, 0x8F, 0x67, 0x7D, 0xF6, 0xEC, 0x22, 0x9E, 0x3D, 0xD0, 0xB3, 0x8F, 0xC4, 0xB3, 0x3B, 0x7A,
+    0xB6, 0x72, 0xF4, 0xEC, 0x8E, 0x9E, 0xA5, 0xCC, 0x2D, 0x22, 0x9B, 0xCF, 0x1F, 0xC9, 0x81, 0x9E,
+    0x6D, 0xDA, 0xAD, 0x80, 0xE6, 0xC7, 0x04, 0xB1, 0x34, 0xA1, 0x6E, 0xC8, 0x46, 0xC5, 0x8F, 0xF6,
+    0x18, 0x87, 0xFB, 0xDC, 0xA7, 0x18, 0x67, 0xC7, 0xFE, 0xA9, 0xC4, 0x8E, 0xC1, 0x66, 0xD4, 0x9E,
+    0x08, 0xD6, 0xC7, 0xD2, 0xDF, 0xAC, 0x96, 0xBE, 0x90, 0x0F, 0x3D, 0xD3, 0xAE, 0x86, 0x8C, 0x4B,
+    0xBC, 0x7C, 0x86, 0x5B, 0x97, 0x88, 0x49, 0xE0, 0xFA, 0xF5, 0x69, 0xE4, 0xEE, 0x98, 0x46, 0x79,
+    0xDC, 0xE4, 0xED, 0x5B, 0xD3, 0x68, 0xC8, 0x9A, 0xD9, 0x2C, 0xEB, 0xC7, 0x33, 0x5D, 0x33, 0xC0,
+    0x3A, 0xB1, 0xD0, 0x5B, 0x19, 0xD2, 0xAF, 0x7F, 0xD5, 0x14, 0xA8, 0x72, 0x44, 0x15, 0x95, 0x30,
+    0xD2, 0x33, 0x63, 0x3D, 0xA2, 0xBE, 0x08, 0x28, 0x9E, 0xF3, 0xA8, 0x95, 0xA2, 0x89, 0x81, 0x3D,
+    0x93, 0x56, 0x07, 0xAE, 0xEC, 0x2A, 0xBF, 0x7E, 0x20, 0x91, 0x45, 0xEB, 0xC1, 0x8C, 0xBC, 0xCD,
+    0xCC, 0x57, 0x06, 0xE6, 0x23, 0xA1, 0x94, 0x45, 0x12, 0x89, 0xBA, 0x2D, 0x51, 0x5B, 0x29, 0xD3,
+    0x09, 0x62, 0x59, 0x25, 0xDC, 0xBA, 0xE5, 0x81, 0x57, 0xAB, 0x5B, 0x59, 0xE5, 0x37, 0x3C, 0x9C,
+    0x56, 0x4F, 0xD7, 0xE3, 0x2A, 0x72, 0xD6, 0x61, 0xDB, 0x27, 0x9D, 0xF5, 0xEB, 0xBF, 0x78, 0x12,
+    0x91, 0x46, 0xB3, 0xCB, 0x83, 0xC7, 0x90, 0x62, 0x35, 0xC3, 0x30, 0x80, 0x4A, 0x12, 0x71, 0xD4,
+    0x82, 0x26, 0xCB, 0xD4, 0xB4, 0x14, 0x93, 0x13, 0x4F, 0x1C, 0xE7, 0xE4, 0xC6, 0x5F, 0x82, 0x38,
+    0x4E, 0x84, 0xDD, 0xAD, 0xB7, 0xA3, 0xBA, 0x51, 0xB4, 0x5D, 0xF1, 0x36, 0x42, 0x90, 0xF4, 0x45,
+    0x1C, 0x66, 0xC8, 0xC3, 0xA9, 0x1C, 0x53, 0xAE, 0x3F, 0x9A, 0x67, 0xBF, 0xB0, 0xA6, 0x33, 0xAE,
+    0x0E, 0xB8, 0x2A, 0x38, 0x05, 0x9D, 0x1D, 0x31, 0xB3, 0xA0, 0xC4, 0x73, 0xBA, 0xB2, 0xE4, 0x70,
+    0xC5, 0x83, 0x32, 0xEC, 0x98, 0x2C, 0x57, 0xE8, 0x99, 0xAE, 0xF2, 0x4C, 0x7E, 0x8A, 0xCB, 0x42,
+    0x88, 0xDE, 0x4C, 0x5A, 0x72, 0x42, 0x94, 0xF3, 0x37, 0x81, 0xE3, 0xEE, 0xAA, 0x90, 0xB2, 0x72,
+    0x88, 0xD3, 0x2A, 0x32, 0xCC, 0xF2, 0xB0, 0xB9, 0xF6, 0xD0, 0xCF, 0x0F, 0x84, 0x44, 0xB1, 0x77,
+    0x04, 0x2A, 0x33, 0xBD, 0x19, 0x38, 0x1E, 0xC6, 0xFA, 0x8F, 0x47, 0xAE, 0x48, 0x9C, 0x12, 0x1C,
+    0x9A, 0xC0, 0x07, 0xAF, 0xD8, 0x9A, 0x29, 0x18, 0x07, 0x88, 0x79, 0xF6, 0x43, 0x84, 0x0D, 0x2C,
+    0x2A, 0xD3, 0xB9, 0x14, 0x52, 0x1A, 0xE9, 0x7E, 0x66, 0xB2, 0x3C, 0x9E, 0xD9, 0x9C, 0x6D, 0x37,
+    0xAB, 0x7C, 0x65, 0xC8, 0xF3, 0xD9, 0xB6, 0x2A, 0xAA, 0x84, 0xDA, 0x55, 0x7F, 0x3D, 0x5C, 0xD0,
+    0x70, 0x40, 0x23, 0x36, 0xF4, 0x51, 0xB8, 0xF7, 0xAE, 0x41, 0xBA, 0xDA, 0xF0, 0x74, 0xDD, 0xFD,
+    0x5B, 0x8A, 0xEB, 0x6F, 0xA9, 0xFF, 0xFF, 0xDF, 0xD2, 0xDF, 0xF2, 0x5B, 0xA2, 0x93, 0xD2, 0x85,
+    0x3F, 0x0E, 0x01, 0x19, 0x72, 0xEF, 0x70, 0xF0, 0xBF, 0x9D, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x18,
+    0x7D, 0xF6, 0xE4, 0xCE, 0x48, 0x96, 0x32, 0xCD, 0x9D, 0x90, 0x82, 0xC0, 0x94, 0x08, 0x09, 0xFC,
+    0x0F, 0xEC, 0xEE, 0x18, 0x52, 0x50, 0x92, 0x22, 0x4B, 0x73, 0x7F, 0x04, 0xED, 0x15, 0x77, 0xBB,
+    0x86, 0x14, 0x29, 0x68, 0x90, 0x10, 0xB4, 0x50, 0x24, 0x12, 0x5C, 0x8A, 0xA3, 0x48, 0x71, 0x52,
+    0x6E, 0xB3, 0x13, 0xA5, 0xB8, 0x22, 0x05, 0xEE, 0x68, 0xAD, 0x28, 0xA2, 0xA0, 0x32, 0xE0, 0x28,
+    0x93, 0xC4, 0xBB, 0xC3, 0xFB, 0x66, 0xF6, 0x2E, 0x4A, 0x1A, 0x24, 0x2C, 0x5B, 0x6B, 0xCF, 0x7C,
+    0x3F, 0xDE, 0xBC, 0xEF, 0x7D, 0xDF, 0x02, 0x40, 0xD2, 0xCD, 0x6D, 0x7E, 0xE6, 0x61, 0x66, 0xB7,
+    0xE0, 0x1B, 0xA8, 0x01, 0x28, 0x1A, 0x60, 0x09, 0xA8, 0x1E, 0xD0, 0x16, 0x98, 0xD1, 0x88, 0xAF,
+    0x39, 0x5F, 0x0D, 0x1D, 0x68, 0x90, 0xB5, 0x40, 0x59, 0x01, 0xA7, 0x34, 0xEA, 0x10, 0xAF, 0xD4,
+    0xF7, 0x89, 0xF7, 0xAD, 0xF9, 0xFE, 0x34, 0x6F, 0xC3, 0x4E, 0xCE, 0x28, 0x73, 0x1A, 0xAC, 0x19,
+    0x65, 0x45, 0x7B, 0xC7, 0x67, 0x13, 0xB8, 0x0B, 0x91, 0xB2, 0xAE, 0x4F, 0x57, 0xDA, 0xFB, 0x7A,
+    0xCE, 0xBC, 0x5B, 0x0C, 0xF7, 0x2E, 0x30, 0x0A, 0xAE, 0x03, 0xDE, 0xF1, 0xC3, 0xDC, 0x0F, 0x6F,
+    0x3F, 0xBD, 0x4E, 0x5B, 0xDE, 0x4C, 0xC8, 0x70, 0x04, 0xC3, 0xBB, 0xA8, 0x51, 0x54, 0x92, 0xDE,
+    0xE0, 0xFC, 0xFE, 0x04, 0xA5, 0x47, 0xEE, 0x81, 0x6B, 0x82, 0x34, 0xB7, 0x5C, 0x1B, 0xE8, 0xA5,
+    0xF9, 0x92, 0x38, 0xFA, 0x16, 0xD5, 0x02, 0x69, 0x47, 0x5F, 0xC3, 0xD0, 0xAA, 0x63, 0x84, 0x99,
+    0xD8, 0x35, 0x0C, 0x22, 0x76, 0x05, 0xED, 0x94, 0xE3, 0xCB, 0xB2, 0x32, 0x28, 0x7B, 0xE5, 0x8A,
+    0x63, 0x14, 0xFE, 0x31, 0xBF, 0xFB, 0x89, 0xC4, 0x04, 0x0E, 0x99, 0x84, 0x5E, 0xE5, 0x55, 0x09,
+    0x3A, 0x40, 0x37, 0x86, 0xE8, 0xB5, 0x55, 0x7D, 0xDA, 0x25, 0x0E, 0x0B, 0x46, 0x2D, 0xAA, 0x19,
+    0x32, 0x2E, 0xC3, 0x95, 0x35, 0x26, 0x82, 0xF4, 0x26, 0xC9, 0xFC, 0x87, 0x27, 0x5D, 0x90, 0xBB,
+    0x92, 0xA4, 0xE5, 0x24, 0x21, 0x21, 0x46, 0x4C, 0xE8, 0x0B, 0xA3, 0x6D, 0x4A, 0xAF, 0x1B, 0x1D,
+    0x3C, 0xC3, 0x0D, 0xB8, 0xD7, 0xA8, 0xCE, 0x60, 0xDC, 0xA7, 0xBD, 0xB6, 0xE5, 0x58, 0x60, 0xE9,
+    0xCF, 0x89, 0x7A, 0xC8, 0x1F, 0x32, 0xA8, 0x51, 0xAD, 0x2B, 0xAA, 0xFC, 0x41, 0xC7, 0xC0, 0x69,
+    0xE7, 0xF4, 0xCD, 0x16, 0xA7, 0x07, 0x8A, 0x00, 0xCB, 0x09, 0x4E, 0x1C, 0xF2, 0xDF, 0xF0, 0xF1,
+    0x29, 0xD2, 0x97, 0x75, 0x7E, 0x9F, 0x94, 0x37, 0xA9, 0xAF, 0x50, 0x10, 0xBC, 0x45, 0xD6, 0x87,
+    0x5A, 0x32, 0x63, 0xEA, 0x04, 0xA3, 0x4D, 0x5C, 0x22, 0x04, 0x10, 0x5E, 0xD6, 0x10, 0x8E, 0x7E,
+    0xC4, 0xDD, 0x92, 0x4E, 0x30, 0x52, 0x46, 0x96, 0x26, 0xD4, 0x1F, 0x86, 0x90, 0xD5, 0x33, 0x29,
+    0xF2, 0x37, 0x96, 0x0C, 0x0A, 0xE3, 0x81, 0x53, 0x4A, 0x41, 0x37, 0xFC, 0x59, 0x23, 0xA5, 0x05,
+    0x97, 0x19, 0xC8, 0xC9, 0x7B, 0xA0, 0x16, 0x42, 0x0C, 0x5F, 0x99, 0x82, 0x45, 0x94, 0x02, 0x37,
+    0x22, 0x94, 0x99, 0x28, 0x46, 0xB5, 0xB4, 0xE6, 0x39, 0x3A, 0xA9, 0x3E, 0x05, 0x85, 0x52, 0x94,
+    0x95, 0xFE, 0xC5, 0x30, 0x28, 0x44, 0x55, 0xC9, 0x33, 0x01, 0xAA, 0x25, 0x3B, 0x88, 0x9F, 0xAF,
+    0x2D, 0xA2, 0xD8, 0x42, 0xA2, 0x73, 0xA1, 0xDD, 0x0F, 0xDF, 0xE2, 0xBA, 0x27, 0xDF, 0x66, 0x85,
+    0xA8, 0x30, 0x5E, 0x73, 0xBF, 0x0A, 0xCF, 0xEE, 0x17, 0x43, 0xD4, 0xAE, 0xE8, 0x90, 0xC5, 0x10,
+    0x11, 0x62, 0xB3, 0xA4, 0x9B, 0x8B, 0x25, 0x41, 0x29, 0x31, 0xCF, 0x97, 0x4C, 0x10, 0xA2, 0xA4,
+    0xBE, 0x62, 0x91, 0x0F, 0x2C, 0x55, 0x1D, 0xCE, 0xD0, 0x86, 0xEA, 0x8B, 0xF8, 0xE9, 0xA0, 0xEB,
+    0xD0, 0x0A, 0x65, 0x74, 0x5D, 0x41, 0xD1, 0x68, 0x5E, 0x23, 0x5B, 0xC5, 0x05, 0xEA, 0x52, 0xB6,
+    0xF9, 0x93, 0x46, 0x89, 0xAB, 0xE8, 0x9D, 0x35, 0xB1, 0x23, 0xB8, 0x67, 0x5A, 0x24, 0x11, 0xEF,
+    0xCE, 0xC1, 0x7F, 0x5D, 0xF4, 0xF8, 0x96, 0x6C, 0xD4, 0x41, 0x3A, 0x12, 0x63, 0x7C, 0x11, 0x4A,
+    0xD8, 0x73, 0x31, 0xA1, 0xE4, 0x8D, 0x1D, 0xAA, 0x9F, 0x84, 0x16, 0x23, 0x78, 0xF5, 0x9C, 0xBA,
+    0x7B, 0x13, 0xEE, 0x24, 0x7A, 0x2F, 0x82, 0x77, 0xE6, 0x08, 0x9E, 0x70, 0x68, 0x41, 0x2C, 0xF9,
+    0x73, 0x24, 0x85, 0x77, 0xE9, 0xA3, 0x3F, 0xBC, 0xFF, 0xBB, 0xDA, 0xF6, 0xB4, 0x96, 0x86, 0x0C,
+    0x2C, 0x19, 0x4B, 0x4D, 0x98, 0x0A, 0x55, 0xEC, 0xF3, 0x11, 0x32, 0x8B, 0x13, 0xE8, 0x0A, 0x14,
+    0x97, 0x9C, 0xD3, 0xC8, 0x29, 0x0F, 0xA5, 0x3F, 0x87, 0x58, 0xFC, 0xB2, 0x26, 0xD5, 0x66, 0x63,
+    0xCE, 0x4B, 0xC4, 0x64, 0x03, 0xD6, 0xDC, 0x77, 0x9C, 0x11, 0xB6, 0x68, 0xB7, 0xB1, 0x8A, 0x15,
+    0x66, 0x21, 0xD2, 0xCD, 0x98, 0x21, 0x5D, 0xEC, 0xA5, 0x40, 0xB8, 0x14, 0x7C, 0xB6, 0xA9, 0x9A,
+    0x2C, 0xAD, 0xF6, 0x6C, 0xE6, 0x3D, 0x47, 0x4C, 0x1B, 0x23, 0x71, 0xEB, 0x84, 0xCF, 0xAB, 0x14,
+    0x98, 0x8B, 0x10, 0xBC, 0xE0, 0xF6, 0x3F, 0x38, 0x91, 0xC9, 0xA5, 0x38, 0xAC, 0xA2, 0x76, 0xE4,
+    0xD8, 0xA1, 0x24, 0x1B, 0x41, 0x5D, 0xEC, 0xA4, 0xC7, 0x2F, 0x7E, 0x16, 0x3F, 0x32, 0xB1, 0xBB,
+    0x9A, 0x56, 0x81, 0xA3, 0x80, 0x34, 0x8E, 0xAF, 0x8D, 0xE8, 0xDC, 0x85, 0xE3, 0x22, 0x0C, 0xBA,
+    0xA3, 0xA3, 0x5B, 0xE2, 0xB3, 0xA6, 0xDC, 0x44, 0x30, 0x6F, 0x01, 0xEF, 0xBB, 0xF9, 0x77, 0x8F,
+    0xF9, 0x91, 0xAE, 0xF7, 0xBA, 0xDC, 0x66, 0xCD, 0x18, 0xF9, 0x57, 0x9C, 0x2B, 0x64, 0x6A, 0xA4,
+    0x59, 0xA1, 0x09, 0x2B, 0xC1, 0x36, 0x50, 0xDE, 0x3B, 0x33, 0x7F, 0xE1, 0x7E, 0xDD, 0x4A, 0x25,
+    0xB8, 0x94, 0x27, 0x65, 0xD3, 0x93, 0x30, 0x99, 0x79, 0xAC, 0x94, 0x6E, 0x48, 0x25, 0x7B, 0xCC,
+    0x32, 0x6F, 0x29, 0x28, 0x0F, 0x85, 0x11, 0x47, 0x76, 0xD2, 0x4E, 0xC6, 0xEE, 0x19, 0xDD, 0x34,
+    0x29, 0xDB, 0x9A, 0x3F, 0xAD, 0xB0, 0x64, 0x6E, 0x46, 0xDC, 0x48, 0x43, 0x8A, 0x9C, 0x1C, 0xAD,
+    0x7F, 0x21, 0xC7, 0xBE, 0xC7, 0x87, 0xCB, 0x3F, 0xEB, 0xA0, 0xBC, 0x78, 0x6A, 0xA1, 0x37, 0x1C,
+    0xED, 0x35, 0xCD, 0xED, 0x6C, 0xB8, 0xFB, 0xE0, 0x75, 0xCD, 0x61, 0xF7, 0x9A, 0x50, 0x52, 0x27,
+    0x42, 0xE7, 0x0A, 0x3B, 0xC1, 0x51, 0xC8, 0x92, 0x06, 0x12, 0xB5, 0x43, 0xCB, 0x48, 0x67, 0x16,
+    0x5D, 0x2F, 0x19, 0x3A, 0x6F, 0x95, 0x94, 0xBE, 0xA7, 0x9D, 0x21, 0x75, 0xB9, 0x4C, 0x17, 0xFF,
+    0x23, 0x7B, 0x88, 0xC2, 0x45, 0x29, 0xE9, 0xD7, 0x1B, 0x08, 0xC2, 0x26, 0x0F, 0xF4, 0x84, 0x83,
+    0xCF, 0x10, 0xF7, 0xB6, 0x77, 0x11, 0xC0, 0x25, 0x7C, 0xD6, 0x1C, 0x2E, 0xF2, 0xDF, 0xEB, 0xFD,
+    0xF3, 0x72, 0x6E, 0xFB, 0xE7, 0x52, 0x82, 0xF5, 0xF1, 0x2A, 0x28, 0x60, 0xDB, 0x85, 0x22, 0x50,
+    0x1A, 0x13, 0xEA, 0x52, 0xD7, 0x79, 0x9D, 0x7B, 0x3B, 0x46, 0x97, 0xF9, 0x21, 0xE9, 0x3E, 0x22,
+    0xC8, 0x4A, 0x5F, 0xB5, 0xF2, 0x87, 0xB4, 0x3F, 0x0A, 0x13, 0xE6, 0xAC, 0x16, 0xCC, 0xA3, 0x7D,
+    0x02, 0x93, 0x8F, 0xF1, 0xAB, 0x8F, 0x87, 0x36, 0xEC, 0x8C, 0x84, 0x96, 0xEC, 0xEB, 0x86, 0x15,
+    0xC0, 0x5D, 0x8D, 0xE5, 0x1D, 0xAB, 0x71, 0x92, 0xF8, 0x41, 0x35, 0xAA, 0x49, 0x6E, 0xB3, 0xC1,
+    0xC2, 0xB4, 0xE2, 0x69, 0xF9, 0x47, 0x43, 0xE0, 0xCB, 0xDB, 0x4B, 0x99, 0x46, 0x4B, 0x1F, 0x66,
+    0xD2, 0x6E, 0xC4, 0xA8, 0xDC, 0x4F, 0xF3, 0x7B, 0x37, 0x9A, 0xC3, 0xF7, 0xD0, 0x75, 0x8C, 0x7B,
+    0xF9, 0x32, 0xEE, 0x32, 0x47, 0x57, 0xAA, 0x97, 0x83, 0x72, 0x6D, 0x3C, 0x17, 0x70, 0xA0, 0x38,
+    0x04, 0x0D, 0x66, 0x69, 0x97, 0xB7, 0x65, 0xB5, 0x4C, 0x5D, 0xD6, 0x15, 0xB6, 0xA8, 0xC9, 0x00,
+    0x75, 0x3F, 0x23, 0xDA, 0x21, 0xB7, 0x49, 0xAF, 0x6B, 0xFE, 0x2B, 0x41, 0xD5, 0xA3, 0x10, 0x99,
+    0x95, 0xF5, 0xF2, 0x4C, 0xA7, 0xD3, 0x2F, 0x11, 0xE5, 0xFE, 0xE6, 0x73, 0x65, 0x6B, 0xFA, 0xA9,
+    0x1F, 0x8C, 0x7F, 0x30, 0xBD, 0x8E, 0xFF, 0x7F, 0xFD, 0x0B, 0xCD, 0x55, 0x31, 0x6F, 0xE4, 0x44,
+    0x18, 0x7D, 0xB6, 0xB5, 0x31, 0x92, 0x8B, 0xA1, 0xA1, 0x43, 0x71, 0x7F, 0x52, 0xE2, 0x3F, 0x90,
+    0x5D, 0x4F, 0x44, 0x49, 0xC1, 0x15, 0x97, 0x16, 0x6A, 0xAA, 0x6B, 0x23, 0xC8, 0x66, 0x0D, 0xF7,
+    0x03, 0x8E, 0x7F, 0x80, 0x90, 0xA0, 0x60, 0xAF, 0x48, 0x93, 0x22, 0xC5, 0x26, 0xB6, 0xEE, 0x24,
+    0x28, 0xB1, 0xB8, 0x92, 0x22, 0x16, 0x05, 0x05, 0x14, 0x19, 0x81, 0x91, 0x7C, 0x27, 0x67, 0x87,
+    0xF7, 0x66, 0x93, 0xE8, 0x22, 0xAE, 0xA0, 0x64, 0xE2, 0xFD, 0xE2, 0xF9, 0xFC, 0xF9, 0x9B, 0x37,
+    0xEF, 0x7B, 0xDF, 0x18, 0xD8, 0x8C, 0x2D, 0xFF, 0x8A, 0x36, 0x5B, 0x9F, 0x5C, 0x03, 0xC9, 0x80,
+    0xAD, 0x01, 0xE0, 0x95, 0x76, 0x98, 0xD1, 0x6D, 0xAA, 0xAC, 0xAA, 0xD7, 0x98, 0xC2, 0x65, 0x7E,
+    0x8C, 0xDC, 0x0E, 0x56, 0x69, 0x67, 0x3E, 0x68, 0xB2, 0xA6, 0xC4, 0xE1, 0x1E, 0x56, 0x89, 0x4B,
+    0x7E, 0xAC, 0xB2, 0x66, 0x86, 0xBD, 0x43, 0x9C, 0x3F, 0x6E, 0x34, 0xF1, 0x4E, 0x93, 0x8B, 0x0B,
+    0x24, 0x2F, 0x9A, 0xEC, 0x39, 0x27, 0x0C, 0x33, 0x4D, 0xFA, 0x65, 0x9B, 0x35, 0x73, 0x9C, 0x1A,
+    0xBD, 0x63, 0x70, 0x96, 0x35, 0xF9, 0x93, 0x36, 0x69, 0x1F, 0xE1, 0xD1, 0x0A, 0x79, 0x05, 0x94,
+    0xC0, 0xC2, 0xA2, 0x68, 0x80, 0xFA, 0xBB, 0xBA, 0xE3, 0xC2, 0xB5, 0x97, 0xC5, 0x7B, 0xFC, 0x3D,
+    0x58, 0x2E, 0xBF, 0xF1, 0xDE, 0xFF, 0xB0, 0x5C, 0x7E, 0x2F, 0x57, 0xEC, 0x2B, 0xE3, 0x5D, 0x81,
+    0xD5, 0x54, 0xB9, 0xA7, 0xBC, 0x78, 0xC3, 0x29, 0x9D, 0x7C, 0xA4, 0x88, 0xA4, 0xA5, 0xE9, 0xF9,
+    0x9B, 0x6A, 0x07, 0xF6, 0x9E, 0x23, 0x66, 0xA6, 0xB1, 0xA6, 0x99, 0x1C, 0xBC, 0x3A, 0xB0, 0x6F,
+    0x8B, 0xD8, 0x38, 0x38, 0x26, 0x07, 0x07, 0x07, 0x1F, 0x32, 0xF2, 0x4F, 0xBD, 0x82, 0x89, 0x8D,
+    0x7C, 0x9F, 0xBC, 0x1E, 0x23, 0x7B, 0x04, 0xEC, 0x01, 0x47, 0xA2, 0x29, 0x76, 0xC8, 0x1A, 0x14,
+    0xBA, 0x4D, 0x3A, 0xE4, 0x16, 0xA5, 0x77, 0x35, 0x19, 0x10, 0x72, 0x1B, 0x7B, 0x97, 0xFC, 0x36,
+    0x86, 0xC8, 0x10, 0xBF, 0xE5, 0xE0, 0x2D, 0x4E, 0x5A, 0xBD, 0x05, 0x5D, 0xEF, 0xC6, 0xEE, 0xF8,
+    0xA4, 0x2D, 0xBD, 0x8D, 0x1E, 0x02, 0x9F, 0xE2, 0x3A, 0xE9, 0xB3, 0x36, 0xB7, 0x8C, 0x65, 0xA2,
+    0x39, 0x0A, 0x8B, 0x95, 0x78, 0x19, 0x6F, 0x4D, 0x34, 0xE0, 0x18, 0x71, 0x8F, 0x73, 0x25, 0x18,
+    0x91, 0xDC, 0x98, 0x81, 0xB5, 0x8A, 0x7A, 0x98, 0x96, 0x8F, 0x4C, 0x43, 0x47, 0x29, 0x53, 0x57,
+    0xA9, 0x8B, 0xBC, 0xCD, 0xC6, 0xFC, 0xD2, 0x66, 0xDE, 0x17, 0x30, 0x97, 0x03, 0xCD, 0x17, 0x36,
+    0x64, 0x87, 0xB2, 0x07, 0xD6, 0x6F, 0x8C, 0x6A, 0xCD, 0x35, 0x39, 0x56, 0xB7, 0x7B, 0xC7, 0xC2,
+    0xFB, 0x8E, 0x5B, 0x1F, 0x6A, 0xFF, 0xF7, 0xC7, 0xA5, 0xBF, 0x4E, 0xBF, 0xF6, 0x7E, 0xFF, 0x0F,
+    0xEF, 0xDB, 0xCF, 0xBD, 0xEF, 0xB7, 0x3D, 0x1D, 0xA4, 0x71, 0xFF, 0x8A, 0x8E, 0xCF, 0xE4, 0x58,
+    0xD0, 0xF1, 0x94, 0x8E, 0x5F, 0xE9, 0x38, 0x2C, 0xE9, 0x88, 0xE8, 0xA8, 0x90, 0xED, 0x77, 0x88,
+    0xDB, 0x43, 0xE0, 0x74, 0x1B, 0xD8, 0xF9, 0xCF, 0x0E, 0x8D, 0xF4, 0xE5, 0xB5, 0x2F, 0xF7, 0x91,
+    0x34, 0xDB, 0x58, 0x13, 0x5B, 0x9F, 0xFE, 0xB2, 0x2E, 0x55, 0xA6, 0xE3, 0xF8, 0x3A, 0x5F, 0x4D,
+    0x8F, 0x88, 0x74, 0x40, 0x1F, 0xB9, 0xC8, 0xC5, 0x5D, 0x42, 0x2D, 0xA5, 0x54, 0x65, 0x78, 0x2F,
+    0x5E, 0x63, 0x71, 0x91, 0xB4, 0x7B, 0xDB, 0x38, 0x75, 0xF1, 0xCB, 0x26, 0xFB, 0x48, 0x3A, 0x71,
+    0xCE, 0xEC, 0xBF, 0x1E, 0x36, 0x02, 0x89, 0xEC, 0x3B, 0xC8, 0x59, 0xED, 0x19, 0x79, 0x5C, 0xA5,
+    0x2D, 0x06, 0xD3, 0xC4, 0x2E, 0xB7, 0x69, 0x57, 0x52, 0x81, 0xE7, 0xD1, 0x98, 0x3A, 0xD3, 0x2C,
+    0xC0, 0x7F, 0x92, 0xF9, 0x9C, 0x64, 0x7E, 0x95, 0xE1, 0x8D, 0xC1, 0x3A, 0xE0, 0x0C, 0xB5, 0x65,
+    0x8E, 0x63, 0x47, 0xE5, 0x98, 0x4F, 0x82, 0x14, 0x3A, 0xE9, 0x60, 0x86, 0xB4, 0x91, 0x98, 0x7A,
+    0x15, 0x9C, 0xA4, 0x66, 0x01, 0xD4, 0x19, 0xEB, 0x43, 0x55, 0xCD, 0x58, 0x30, 0xA6, 0x2E, 0x9A,
+    0x3C, 0x76, 0xE9, 0x10, 0xBB, 0x39, 0x0B, 0xC4, 0x0E, 0xDB, 0x63, 0x12, 0x67, 0x72, 0x52, 0x9F,
+    0xFC, 0x2C, 0x11, 0x9D, 0xED, 0x50, 0x4C, 0x39, 0x93, 0x8C, 0x89, 0xF7, 0x4D, 0xC1, 0x3A, 0x8C,
+    0x04, 0xC9, 0x25, 0x07, 0x25, 0x51, 0xB9, 0xDC, 0x9B, 0x70, 0xD4, 0x3F, 0x59, 0x15, 0xF0, 0xD8,
+    0xF4, 0x4A, 0x10, 0x04, 0x88, 0xBA, 0xDB, 0x0D, 0x42, 0x23, 0xA2, 0x56, 0xB2, 0x36, 0x95, 0x20,
+    0x95, 0xA1, 0xC2, 0xAA, 0x31, 0x31, 0x4D, 0x2C, 0xFA, 0xA4, 0xAB, 0x7B, 0x82, 0x7A, 0x41, 0x61,
+    0xB3, 0xA7, 0xEC, 0x94, 0xA8, 0x42, 0x13, 0x0C, 0x12, 0xAD, 0xDE, 0x5F, 0x69, 0x47, 0xBC, 0x61,
+    0x53, 0x70, 0x2B, 0xDC, 0x52, 0x11, 0x34, 0x32, 0x22, 0x72, 0xD2, 0x3C, 0x61, 0x32, 0x33, 0xAF,
+    0x52, 0x3D, 0x49, 0xAC, 0xB7, 0xD8, 0x26, 0xA1, 0x89, 0x16, 0x3C, 0x54, 0xD2, 0x6A, 0x76, 0xD2,
+    0x04, 0x14, 0xBD, 0xDE, 0x60, 0x76, 0x52, 0x4A, 0xF2, 0x94, 0xFD, 0xB1, 0x25, 0x35, 0xC9, 0x3A,
+    0xAC, 0xC7, 0xCE, 0x10, 0xB0, 0x23, 0x35, 0x0C, 0x97, 0x9B, 0x86, 0x4E, 0x26, 0x67, 0x6C, 0x93,
+    0x02, 0xB5, 0x79, 0xD6, 0xE7, 0x58, 0x3C, 0xF1, 0xBD, 0xB1, 0x8B, 0x76, 0x62, 0x03, 0x6D, 0x44,
+    0x44, 0x1D, 0x10, 0xE0, 0x74, 0x5B, 0xB1, 0xBB, 0xA4, 0x61, 0xC3, 0x5C, 0xEC, 0x8C, 0xF7, 0x44,
+    0x98, 0x92, 0x40, 0xD5, 0x62, 0x17, 0x1B, 0xF2, 0xB4, 0x40, 0x68, 0xF5, 0xBB, 0xC1, 0x73, 0x2E,
+    0xE1, 0x5E, 0xD6, 0xA1, 0x0F, 0xA2, 0x3B, 0xF7, 0x51, 0xD8, 0xA7, 0x76, 0xD6, 0x20, 0x6F, 0x51,
+    0xB4, 0xEC, 0x2A, 0x5D, 0x45, 0xF0, 0x70, 0x2F, 0x6C, 0x36, 0x36, 0xA2, 0xE6, 0xE9, 0x90, 0x76,
+    0xB5, 0x1F, 0x33, 0x3F, 0xB0, 0xE7, 0x25, 0x8F, 0x6F, 0x95, 0x60, 0x94, 0x39, 0xBF, 0xEB, 0xAF,
+    0x70, 0xA4, 0x24, 0xD5, 0xBD, 0xBA, 0x85, 0x07, 0xB5, 0x1E, 0x78, 0x9D, 0x40, 0x92, 0x66, 0x7A,
+    0x49, 0x63, 0x7E, 0xA2, 0x64, 0xF2, 0xA7, 0x34, 0xA5, 0xC4, 0x73, 0x2C, 0x33, 0x66, 0x5A, 0x92,
+    0xEB, 0x26, 0x8E, 0x88, 0xB3, 0x96, 0x3C, 0x86, 0x5E, 0x2F, 0x3C, 0x09, 0x5F, 0xC8, 0xAC, 0x97,
+    0xCF, 0x5C, 0x34, 0x32, 0x88, 0x5E, 0x46, 0x76, 0x94, 0x29, 0x91, 0x46, 0x03, 0x11, 0x62, 0xD4,
+    0x52, 0xE3, 0xC5, 0x2D, 0xAC, 0x07, 0x32, 0xF2, 0x23, 0x57, 0xC7, 0x98, 0x60, 0x34, 0xCD, 0x2C,
+    0xFE, 0x8D, 0xB0, 0x10, 0x5F, 0x46, 0x67, 0xA3, 0x59, 0xE3, 0x06, 0x62, 0xF2, 0x97, 0x53, 0x1F,
+    0x28, 0xDB, 0x58, 0xE0, 0x06, 0x63, 0x29, 0x4E, 0x0A, 0x3B, 0x57, 0x46, 0x69, 0x52, 0x20, 0xC3,
+    0x21, 0xA5, 0x33, 0x17, 0x91, 0x57, 0x2D, 0x84, 0x12, 0x0B, 0x31, 0x53, 0x2A, 0x96, 0x61, 0xFC,
+    0x9E, 0x08, 0x66, 0x46, 0x61, 0x94, 0xD2, 0x85, 0x79, 0xCE, 0x4A, 0xE9, 0x06, 0x5B, 0x82, 0x54,
+    0xE8, 0x2C, 0x58, 0x84, 0xD5, 0xF4, 0x55, 0x6A, 0xA9, 0x8A, 0x6D, 0xFE, 0xFD, 0x1F, 0x78, 0x7C,
+    0x08, 0x7D, 0xB8, 0x3A, 0x9E, 0xD7, 0xC6, 0x5F, 0x55, 0x54, 0x9B, 0x60, 0xBE, 0xCF, 0x3E, 0xBD,
+    0x37, 0xC2, 0x56, 0x36, 0xF0, 0x02, 0x89, 0x01, 0x1F, 0xE6, 0x03, 0x6E, 0x00, 0x6E, 0x58, 0x0C,
+    0x08, 0xD3, 0x4E, 0xFA, 0x17, 0xC4, 0x0D, 0x8D, 0x01, 0x23, 0xA9, 0x9A, 0x61, 0x03, 0x32, 0xF0,
+    0xB8, 0x41, 0x69, 0x7E, 0x5F, 0xD6, 0x08, 0x30, 0x37, 0x44, 0x06, 0x9C, 0x42, 0x95, 0x57, 0x01,
+    0x68, 0x60, 0xB2, 0xB9, 0xAB, 0xF8, 0xDB, 0xC6, 0x3F, 0xCD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10,
+    0x1D, 0xDB, 0x28, 0x96, 0x70, 0xE1, 0xD4, 0x41, 0xC2, 0x2D, 0x0D, 0xF2, 0x0F, 0x40, 0x7C, 0xCA,
+    0x17, 0xD0, 0xF0, 0x11, 0xF4, 0x14, 0x69, 0x72, 0x76, 0x4F, 0x41, 0x3E, 0x21, 0x45, 0x8A, 0x70,
+    0x29, 0x68, 0x28, 0x28, 0x92, 0x9C, 0xFF, 0x00, 0x4B, 0xA1, 0xC7, 0x12, 0xA9, 0xD2, 0xB0, 0x48,
+    0x96, 0x70, 0x4E, 0x7B, 0x5E, 0xDE, 0x9B, 0xF5, 0x5D, 0xEE, 0x20, 0x3D, 0x58, 0xF2, 0x58, 0x67,
+    0xCF, 0xBC, 0x79, 0xF3, 0x66, 0x76, 0x4E, 0x44, 0x26, 0x8F, 0x44, 0x22, 0x53, 0x8C, 0x26, 0x6C,
+    0x9E, 0xCB, 0x5F, 0x57, 0x41, 0x33, 0x9F, 0xC0, 0x38, 0x98, 0xC8, 0x55, 0x22, 0xF1, 0x37, 0x98,
+    0xF4, 0x4B, 0x2D, 0x92, 0xBD, 0x87, 0x29, 0x12, 0x98, 0x29, 0x8D, 0x4D, 0x1A, 0x09, 0xBB, 0xB8,
+    0x01, 0x5C, 0xDC, 0x4A, 0xD2, 0x44, 0xAD, 0xA4, 0x75, 0x64, 0x24, 0x77, 0xCE, 0x48, 0x49, 0x33,
+    0xCC, 0xCE, 0x4D, 0x60, 0xE1, 0x84, 0xB7, 0xF0, 0x6C, 0x25, 0xE8, 0xD3, 0x1A, 0x26, 0x07, 0xA2,
+    0x65, 0x2A, 0x7B, 0x45, 0xB3, 0x4E, 0xDE, 0xC0, 0x2C, 0x3A, 0x91, 0xA0, 0x7D, 0x01, 0xD3, 0xC0,
+    0x88, 0x39, 0x24, 0x21, 0x03, 0xF3, 0xA4, 0xFA, 0x2F, 0x98, 0x86, 0xCE, 0xB9, 0x1E, 0x4F, 0xC4,
+    0xBA, 0x96, 0xD9, 0x71, 0x81, 0x40, 0x7A, 0x6D, 0x94, 0xD6, 0x14, 0x61, 0x42, 0x85, 0xA7, 0xFA,
+    0x33, 0x3F, 0xE8, 0xF8, 0x08, 0xAC, 0x7F, 0x9D, 0xD6, 0x4A, 0x5B, 0xAE, 0x02, 0x42, 0x48, 0x6C,
+    0x92, 0xC5, 0xEC, 0x04, 0x4C, 0x27, 0x40, 0xAB, 0x25, 0xEC, 0x81, 0x36, 0x88, 0xE7, 0xE6, 0xA1,
+    0x59, 0x73, 0xEC, 0xDC, 0x52, 0x2B, 0x9E, 0x9D, 0x13, 0x2C, 0xEA, 0x45, 0xC1, 0xB2, 0xDA, 0x6B,
+    0xB0, 0x14, 0x05, 0x4B, 0x58, 0x18, 0x9E, 0x25, 0x1D, 0x67, 0x55, 0xD4, 0x69, 0xBC, 0xE4, 0x35,
+    0xB4, 0x71, 0x6B, 0x89, 0x73, 0xD7, 0xB0, 0x02, 0x2B, 0xD9, 0x00, 0xB0, 0xB2, 0x91, 0x5D, 0x19,
+    0x3C, 0x26, 0xD9, 0x90, 0x61, 0xE3, 0xA1, 0xE1, 0x5A, 0xAD, 0x54, 0x56, 0x53, 0x2A, 0xEF, 0x07,
+    0x4C, 0xB9, 0x76, 0x29, 0x94, 0x16, 0x45, 0x49, 0x86, 0xD7, 0x9F, 0x99, 0x07, 0xB0, 0xA5, 0xBB,
+    0x01, 0xFE, 0x57, 0x26, 0x21, 0x60, 0xCA, 0xCF, 0x81, 0x8A, 0xA2, 0x12, 0x74, 0xAB, 0xF6, 0x6A,
+    0x2B, 0xE5, 0xCD, 0x8A, 0x47, 0xBE, 0xF2, 0x88, 0x08, 0xFA, 0x74, 0xA3, 0xF1, 0x90, 0xAA, 0xD1,
+    0x92, 0x0A, 0x68, 0x16, 0x13, 0xEE, 0x92, 0x19, 0xEB, 0xB1, 0x3F, 0xD4, 0x46, 0x05, 0xC9, 0x39,
+    0x16, 0xC3, 0xEC, 0x94, 0x7E, 0x13, 0x04, 0x74, 0xC2, 0x96, 0xA8, 0x46, 0x5B, 0x7E, 0x19, 0xFC,
+    0xC2, 0x6E, 0xAC, 0x21, 0x5A, 0xCC, 0xCE, 0x38, 0x11, 0x75, 0xE2, 0xBB, 0x2C, 0x8F, 0xAB, 0x51,
+    0x1D, 0xD6, 0x9A, 0xF1, 0x07, 0x33, 0x7E, 0xFA, 0x57, 0x7C, 0xC2, 0x93, 0x51, 0xAA, 0x1C, 0x31,
+    0xC9, 0x35, 0x9A, 0x69, 0x32, 0x91, 0x43, 0x79, 0xFB, 0x8F, 0xF8, 0xEC, 0x06, 0xF0, 0xAC, 0x7A,
+    0x78, 0x42, 0x9B, 0x54, 0xCC, 0xF6, 0x36, 0x09, 0x39, 0xB9, 0xA4, 0xA1, 0x7C, 0xD6, 0xF0, 0x17,
+    0x23, 0xBC, 0xE6, 0xA1, 0xA6, 0x1E, 0xFE, 0x76, 0xE6, 0x69, 0x90, 0xCF, 0x9A, 0xF7, 0x96, 0x9F,
+    0xCE, 0x8D, 0xF2, 0x36, 0xE2, 0xC7, 0x3C, 0x26, 0xF0, 0x5C, 0xCF, 0xC9, 0xCE, 0xB1, 0x52, 0xA4,
+    0x0F, 0x83, 0x5E, 0xC2, 0xA3, 0xDD, 0x18, 0xFB, 0x08, 0x54, 0xC2, 0x3B, 0x0D, 0x67, 0x34, 0x3C,
+    0x99, 0xE3, 0xC8, 0x2B, 0x63, 0x35, 0x86, 0xE5, 0xDE, 0x7F, 0xE6, 0x63, 0xEA, 0x19, 0xFB, 0xCF,
+    0x1C, 0x47, 0x1C, 0x8A, 0xD2, 0x55, 0x89, 0x3F, 0x50, 0x67, 0x60, 0x6E, 0xFD, 0xBC, 0xF2, 0xF3,
+    0xBE, 0xB0, 0x13, 0xB2, 0x79, 0xD4, 0x0A, 0x1E, 0xB7, 0x3B, 0x5F, 0x20, 0xF1, 0x78, 0x33, 0x2D,
+    0x56, 0x91, 0xE6, 0x4D, 0xC7, 0x9B, 0xC5, 0xB1, 0xAE, 0x42, 0xEE, 0xEF, 0xE9, 0xA8, 0x80, 0x1D,
+    0x6F, 0x64, 0x0F, 0xF5, 0x3C, 0x55, 0x28, 0x98, 0xAA, 0xEC, 0xE1, 0x05, 0x0E, 0x6F, 0x66, 0x41,
+    0xBC, 0x47, 0x9B, 0xBA, 0xA0, 0x0D, 0x36, 0x2B, 0x16, 0x2E, 0xA6, 0xFC, 0x58, 0x51, 0xA2, 0x91,
+    0xE3, 0xD4, 0x0B, 0xC4, 0xDC, 0x85, 0xC7, 0x25, 0x1D, 0xA6, 0xB6, 0x5B, 0x4E, 0xE1, 0xA8, 0x62,
+    0xE1, 0x13, 0x63, 0xB9, 0xC4, 0xE8, 0x77, 0x8E, 0x4D, 0x29, 0x01, 0x76, 0x46, 0x01, 0x57, 0xAC,
+    0xB4, 0x3F, 0xFE, 0x42, 0x12, 0x6D, 0x5E, 0x23, 0xC9, 0xCD, 0x16, 0x24, 0x8B, 0x83, 0xCE, 0xA1,
+    0x59, 0x43, 0x52, 0x68, 0xEA, 0x3A, 0x52, 0x58, 0x39, 0x6D, 0xF0, 0xDC, 0xD7, 0x62, 0x03, 0x6C,
+    0x43, 0xAF, 0x75, 0xEE, 0x4E, 0xF1, 0x01, 0x93, 0xCD, 0x6D, 0x36, 0x10, 0xA0, 0x6C, 0xE1, 0x0F,
+    0xF9, 0x91, 0xA8, 0xA8, 0x10, 0x12, 0x1B, 0xC6, 0x5A, 0x42, 0x17, 0x44, 0xD2, 0x55, 0x1B, 0xFD,
+    0xE4, 0x72, 0xB7, 0x73, 0x9E, 0x86, 0xBD, 0xC5, 0x07, 0x2C, 0xB6, 0x4B, 0x16, 0xA3, 0xDD, 0x45,
+    0x4C, 0x68, 0xB9, 0xE9, 0x97, 0x54, 0x64, 0x40, 0x4C, 0xE0, 0x10, 0xBA, 0xE3, 0x24, 0xBD, 0xFD,
+    0x38, 0xF8, 0xAD, 0x8B, 0x01, 0x3E, 0xD6, 0xD2, 0x5E, 0x05, 0xA8, 0x27, 0xEB, 0x52, 0x6E, 0xE5,
+    0x81, 0x02, 0x1E, 0x70, 0xE4, 0x9E, 0x05, 0xA7, 0x5B, 0xF3, 0x0E, 0x99, 0xC0, 0x1C, 0x6B, 0x10,
+    0x88, 0xD0, 0x3E, 0x69, 0x62, 0x47, 0x36, 0x3C, 0xAB, 0x56, 0x96, 0x3D, 0x76, 0x47, 0xF4, 0xDD,
+    0xA0, 0x53, 0xE9, 0xBB, 0x1A, 0x87, 0xE0, 0x28, 0xAB, 0x22, 0x13, 0xE2, 0xAF, 0x38, 0xAD, 0x53,
+    0xF0, 0x9A, 0xC2, 0xB3, 0x87, 0xEE, 0x7D, 0x64, 0x92, 0x3A, 0x6E, 0xE2, 0x06, 0x81, 0xF8, 0xD4,
+    0x23, 0x34, 0x8F, 0x5B, 0xAC, 0x9D, 0x69, 0x3E, 0x81, 0x4A, 0xF6, 0x82, 0x75, 0xFF, 0x42, 0xA0,
+    0x44, 0x3F, 0x58, 0x78, 0xBA, 0xA4, 0x5A, 0x99, 0x61, 0x15, 0x45, 0xCD, 0xCE, 0xCE, 0xE5, 0x81,
+    0xEB, 0x37, 0xCD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x9D, 0xDD, 0x0D, 0x71, 0x61, 0xA4, 0xA5,
+    0xA6, 0xC0, 0x0D, 0x0D, 0x05, 0xD9, 0x1F, 0x88, 0xCE, 0x16, 0xFC, 0x00, 0x05, 0x4A, 0x93, 0x82,
+    0x4F, 0xA0, 0xA5, 0x80, 0xB3, 0x7B, 0x6A, 0x2A, 0x9A, 0x14, 0x08, 0x21, 0x1A, 0x9A, 0x94, 0xB9,
+    0xF3, 0xF2, 0x05, 0x58, 0xA2, 0xA4, 0x71, 0x43, 0x03, 0x05, 0x56, 0x30, 0x60, 0x94, 0xB5, 0x87,
+    0x37, 0xBE, 0xDC, 0x9D, 0x13, 0x89, 0xFE, 0xD6, 0xD2, 0x48, 0xDE, 0xE7, 0x9D, 0xF7, 0x66, 0xE7,
+    0xED, 0x9A, 0x68, 0xBF, 0x20, 0x22, 0xD5, 0x21, 0x50, 0x2A, 0xC1, 0xD4, 0x12, 0x9F, 0x4B, 0x88,
+    0x32, 0x9A, 0x8E, 0x7C, 0xC8, 0x48, 0x31, 0x77, 0xA4, 0xF9, 0x2D, 0x7B, 0x3D, 0x50, 0xD4, 0xA9,
+    0x1E, 0xD3, 0x84, 0x60, 0xAB, 0x25, 0x91, 0xEE, 0x24, 0x43, 0xEE, 0x90, 0xD1, 0x7E, 0xAA, 0x90,
+    0xEA, 0x67, 0x83, 0xF7, 0x3E, 0xC8, 0xE4, 0x1C, 0x21, 0xF9, 0x01, 0x24, 0xFE, 0x0E, 0x02, 0xF3,
+    0x1B, 0x84, 0x2A, 0x60, 0x0D, 0x95, 0x89, 0x07, 0xF3, 0x43, 0x7C, 0x99, 0x7A, 0x26, 0x72, 0x3E,
+    0xA9, 0x29, 0xAD, 0x34, 0xBF, 0x2A, 0x6B, 0x72, 0xCC, 0x48, 0x53, 0xB2, 0xE8, 0x78, 0xBC, 0x12,
+    0xA1, 0xDE, 0x49, 0xEC, 0x37, 0x61, 0x21, 0xE1, 0x85, 0x84, 0x43, 0xDA, 0x3D, 0xB5, 0xF7, 0xC6,
+    0x6D, 0xC5, 0x12, 0x72, 0xB2, 0xC3, 0xEE, 0x09, 0xB0, 0x54, 0x63, 0xF5, 0x01, 0xDD, 0xDF, 0x39,
+    0xB5, 0x2A, 0xDB, 0x47, 0xCF, 0x07, 0xE3, 0xC9, 0xF0, 0x45, 0x45, 0xBA, 0x2E, 0xB1, 0xF0, 0x44,
+    0x9F, 0x4C, 0x75, 0x2A, 0xFE, 0x8B, 0x6F, 0x98, 0x6B, 0x8A, 0x87, 0xD7, 0x4C, 0x71, 0x47, 0x49,
+    0x1D, 0xB5, 0xA0, 0x33, 0x2D, 0x48, 0x1E, 0x80, 0x39, 0xAE, 0xC3, 0x9A, 0x3E, 0x4D, 0x33, 0x51,
+    0x0B, 0x0D, 0xE6, 0x0F, 0x52, 0xA9, 0x5E, 0xF6, 0x20, 0x17, 0xC4, 0x7D, 0x90, 0x3A, 0xBE, 0x40,
+    0x6D, 0x74, 0x8E, 0x49, 0x1D, 0x72, 0x29, 0xC6, 0xE2, 0x4B, 0x36, 0x58, 0x5E, 0x52, 0x5E, 0x10,
+    0x67, 0xF1, 0x70, 0xC4, 0x05, 0x24, 0x42, 0xA3, 0x66, 0xE9, 0xB6, 0x7A, 0x34, 0x6A, 0xA0, 0x5B,
+    0x62, 0xD3, 0x99, 0xD8, 0x36, 0x41, 0x9E, 0x43, 0xE3, 0xE9, 0xFA, 0xD8, 0x05, 0x9D, 0x44, 0x37,
+    0x89, 0xEE, 0xA2, 0x6D, 0x8B, 0xC4, 0xEB, 0x2E, 0x6A, 0xE2, 0x5A, 0x05, 0xF4, 0x2F, 0x1F, 0xD0,
+    0x2D, 0x24, 0xB3, 0xA0, 0x72, 0x48, 0xB2, 0xCC, 0xD1, 0xDC, 0xC4, 0xC7, 0x75, 0xD4, 0xB8, 0x42,
+    0x85, 0x03, 0x1C, 0xBE, 0x3D, 0x92, 0x12, 0xD7, 0x43, 0x17, 0x28, 0x47, 0x2A, 0xCD, 0x79, 0x08,
+    0xA8, 0xE7, 0x98, 0x3D, 0x95, 0x85, 0x82, 0x47, 0x5A, 0x8A, 0x03, 0x41, 0x7C, 0xDE, 0xEA, 0x8E,
+    0xCC, 0x45, 0x0D, 0x61, 0x69, 0xE2, 0x97, 0x64, 0xDA, 0x14, 0x75, 0xBA, 0x22, 0x58, 0xAF, 0x3A,
+    0xD3, 0xE4, 0x64, 0x7D, 0xF2, 0xB1, 0xA3, 0x40, 0x79, 0x5C, 0xDB, 0x4A, 0x77, 0xAE, 0x58, 0x8A,
+    0xAB, 0x22, 0xB8, 0x41, 0x7C, 0xA5, 0x43, 0x04, 0x37, 0xD9, 0xCA, 0xA2, 0x00, 0xA6, 0x14, 0x59,
+    0x1B, 0xCA, 0xC1, 0x81, 0xB7, 0xAF, 0x4F, 0x3B, 0xB2, 0x2C, 0x95, 0xF5, 0x0E, 0x7E, 0x51, 0xD5,
+    0xBA, 0x34, 0x19, 0xB7, 0xC5, 0x3B, 0xA6, 0xD9, 0x1C, 0x43, 0x3B, 0xF6, 0xA1, 0x95, 0x70, 0xE7,
+    0x4A, 0x37, 0x50, 0xA5, 0x2D, 0xB0, 0x11, 0x51, 0x8D, 0x2A, 0x74, 0x1B, 0xC3, 0x78, 0x67, 0xB2,
+    0x2E, 0x1D, 0x11, 0x3F, 0xBF, 0x82, 0x84, 0x2D, 0x52, 0x8C, 0x88, 0xCB, 0x04, 0xF1, 0x53, 0x24,
+    0x11, 0x24, 0xAE, 0xB0, 0xC6, 0x34, 0xA8, 0x42, 0x05, 0x99, 0xEC, 0x29, 0x45, 0x37, 0x28, 0xEA,
+    0x8F, 0x58, 0x8C, 0xCD, 0x62, 0x80, 0xB1, 0x1B, 0x97, 0xD7, 0xD8, 0xE8, 0x64, 0x23, 0xBD, 0xD5,
+    0xDD, 0xE6, 0xCE, 0x1B, 0xC3, 0xE9, 0x0E, 0xAA, 0x1D, 0xEF, 0xB9, 0x52, 0x5E, 0xE4, 0x18, 0xD2,
+    0x62, 0x26, 0x21, 0x02, 0xE3, 0x33, 0x3C, 0xBB, 0xA6, 0x76, 0x8F, 0xE4, 0x04, 0xF9, 0x20, 0x76,
+    0x90, 0x7B, 0xEA, 0x34, 0xCE, 0xAE, 0x9F, 0x48, 0xC9, 0x3F, 0x9B, 0xE4, 0x17, 0xE6, 0xC6, 0x6E,
+    0x98, 0xA5, 0x1B, 0x5B, 0xC4, 0x6C, 0x91, 0xD9, 0x0A, 0x59, 0x8C, 0x08, 0x4D, 0x91, 0xB9, 0x20,
+    0x2E, 0x9B, 0x0B, 0x33, 0xD4, 0x46, 0x0D, 0x26, 0x61, 0xFB, 0x81, 0x70, 0x34, 0x93, 0x5F, 0xC7,
+    0x01, 0x87, 0x91, 0x85, 0x8F, 0xC5, 0x91, 0x37, 0xB6, 0x16, 0x28, 0xE5, 0xBA, 0xF4, 0x97, 0xCE,
+    0x0D, 0xD7, 0xCC, 0x7A, 0x06, 0xEC, 0x65, 0x05, 0x0C, 0x69, 0x7B, 0x7C, 0x91, 0xF8, 0x14, 0x2F,
+    0xBA, 0xC5, 0x0E, 0x24, 0x05, 0x58, 0x84, 0xD9, 0x7A, 0x94, 0x7E, 0x26, 0x94, 0x9F, 0x45, 0x20,
+    0xA4, 0x69, 0x9C, 0x7F, 0x4A, 0x9A, 0xCB, 0x9F, 0x92, 0x28, 0x1C, 0xDD, 0x85, 0x4A, 0x56, 0x2C,
+    0xE9, 0xFA, 0xC7, 0x2A, 0x57, 0xB5, 0x34, 0x62, 0xE4, 0x25, 0x47, 0x13, 0x3C, 0x12, 0xBC, 0x7C,
+    0x9F, 0x51, 0xCC, 0xC8, 0x86, 0x33, 0x87, 0x3C, 0x71, 0x8B, 0x3C, 0xCE, 0x23, 0xCF, 0x8A, 0x37,
+    0x95, 0xD2, 0x6B, 0x88, 0x9A, 0xC3, 0xC3, 0xC8, 0x93, 0x23, 0x8F, 0xAB, 0xED, 0x37, 0xEE, 0xF0,
+    0xF3, 0x80, 0x42, 0x7E, 0x83, 0x76, 0xAE, 0xF9, 0x9A, 0x29, 0xDF, 0x7F, 0xC6, 0x3F, 0xB5, 0x55,
+    0x3D, 0x8F, 0xDD, 0x44, 0x14, 0x3D, 0xE3, 0xC9, 0x3E, 0x4B, 0x71, 0x61, 0x0A, 0xBA, 0x88, 0xB8,
+    0xA3, 0x88, 0x20, 0x6E, 0x29, 0x76, 0x33, 0x93, 0xFC, 0x81, 0x6C, 0x83, 0x52, 0xD2, 0x22, 0x24,
+    0x44, 0x43, 0x41, 0xB1, 0xEB, 0x37, 0x4A, 0x43, 0xBB, 0x3F, 0x81, 0x82, 0x22, 0x1D, 0x14, 0x29,
+    0x28, 0xF2, 0x64, 0x47, 0x29, 0x68, 0x8D, 0x22, 0x7A, 0x0B, 0x2D, 0xF5, 0xBA, 0x70, 0x84, 0x13,
+    0xCD, 0x7B, 0x97, 0x73, 0xC7, 0x0F, 0x76, 0xB7, 0x0D, 0xEC, 0xC8, 0xEF, 0x6A, 0xDE, 0x7C, 0x9D,
+    0x73, 0xE7, 0xDE, 0x73, 0x07, 0x80, 0xF9, 0x1C, 0x6C, 0xB5, 0x0C, 0xB4, 0x22, 0x33, 0x90, 0x6D,
+    0x4D, 0x04, 0xEC, 0x88, 0x0D, 0x50, 0xF4, 0x6A, 0xCB, 0x0E, 0x51, 0x6D, 0xC6, 0xD9, 0x2A, 0x94,
+    0x5C, 0x59, 0xFB, 0x75, 0x00, 0x9C, 0xD9, 0x72, 0x93, 0xE3, 0x52, 0xE0, 0x41, 0xDE, 0xD3, 0x9E,
+    0x26, 0xBB, 0xB1, 0x13, 0x6D, 0xCC, 0x74, 0x36, 0xA2, 0x0D, 0x30, 0x33, 0xAA, 0x1E, 0x66, 0x42,
+    0x3E, 0x22, 0x1B, 0xF5, 0x6C, 0xFD, 0xA6, 0x7D, 0x27, 0x1F, 0x74, 0xBC, 0x78, 0xDD, 0xD7, 0x3D,
+    0xCA, 0x57, 0x22, 0x01, 0xE5, 0x4B, 0xD9, 0x2A, 0xE0, 0x81, 0x57, 0xC0, 0xC4, 0xCF, 0xAB, 0x75,
+    0x6A, 0xD0, 0xA8, 0xF9, 0x38, 0xA6, 0x81, 0x29, 0xD9, 0x3E, 0x8D, 0x9B, 0x1F, 0x69, 0xAA, 0x8E,
+    0xE6, 0x05, 0x7F, 0x56, 0x1D, 0x2A, 0x75, 0xDB, 0x77, 0xB8, 0x6C, 0xC5, 0xCE, 0x76, 0x56, 0xE2,
+    0x09, 0xE4, 0xC9, 0x45, 0xE7, 0x42, 0x39, 0x17, 0x23, 0xD6, 0x3E, 0x92, 0x06, 0x71, 0x5C, 0xA2,
+    0x44, 0x90, 0x86, 0xAC, 0x8A, 0x9E, 0x38, 0x91, 0xDC, 0xAA, 0xAE, 0x81, 0x9D, 0xD9, 0x69, 0xBD,
+    0x43, 0x3D, 0xD9, 0x58, 0x5D, 0xA0, 0x92, 0x3F, 0xB8, 0x6F, 0xBA, 0x0F, 0x7C, 0xB0, 0x9C, 0x7B,
+    0x4F, 0xC1, 0x88, 0xA8, 0x57, 0x94, 0x08, 0x96, 0xA4, 0x9D, 0xF5, 0x37, 0x8F, 0x7C, 0x5B, 0x71,
+    0xF4, 0xA2, 0x5B, 0x46, 0xA1, 0x7E, 0x1C, 0x50, 0x74, 0x27, 0x30, 0x83, 0x19, 0x6E, 0x1C, 0xF9,
+    0xD8, 0x04, 0xAC, 0x87, 0x43, 0x94, 0x72, 0x11, 0xCC, 0x40, 0xF8, 0x4F, 0xF0, 0xCB, 0x15, 0x7F,
+    0x5B, 0x4E, 0x39, 0xF9, 0xB5, 0x2B, 0xDF, 0x34, 0xD1, 0xCE, 0x90, 0xD0, 0x22, 0x9F, 0x98, 0x49,
+    0x8E, 0xC9, 0x40, 0x40, 0x9F, 0xF2, 0x26, 0x1F, 0x88, 0xBC, 0x21, 0x4E, 0x49, 0x40, 0xA3, 0xC8,
+    0x2E, 0x34, 0x28, 0x26, 0x3B, 0x66, 0xE2, 0xDD, 0xCB, 0xDD, 0x68, 0x64, 0x57, 0x23, 0x97, 0x47,
+    0x03, 0x4C, 0x3A, 0xD5, 0xDF, 0x62, 0xAA, 0x31, 0xB4, 0xF9, 0x40, 0xA6, 0x87, 0xB6, 0xC3, 0xF5,
+    0x76, 0x33, 0xA0, 0xDA, 0x72, 0xBD, 0xE3, 0x77, 0xBC, 0xE3, 0x8F, 0xF2, 0x80, 0xAC, 0xFB, 0x0C,
+    0xB8, 0x5B, 0x30, 0xB9, 0x64, 0xDC, 0xC7, 0xFC, 0xA6, 0x13, 0x6C, 0x71, 0xAF, 0xFF, 0xB9, 0x1D,
+    0xB0, 0x96, 0xC7, 0x6B, 0x51, 0x17, 0xE5, 0xF7, 0xAD, 0x9D, 0x8D, 0x0C, 0xF9, 0xD0, 0xA2, 0x9C,
+    0xD1, 0xD0, 0x51, 0x41, 0xF1, 0xDB, 0x8C, 0xB2, 0x37, 0x91, 0xCE, 0xC6, 0x95, 0x10, 0xA7, 0x14,
+    0xE9, 0x1C, 0x8C, 0xC8, 0x19, 0x21, 0xEA, 0x33, 0x4D, 0x4F, 0xD5, 0xA7, 0xE2, 0x05, 0xFD, 0x53,
+    0x25, 0xB5, 0xE7, 0xC2, 0x64, 0x75, 0x4F, 0xFF, 0x92, 0xF0, 0xB5, 0x91, 0xD8, 0x88, 0xF4, 0xF9,
+    0x2E, 0xFF, 0x5E, 0x26, 0x1C, 0x50, 0x58, 0x7E, 0x81, 0xAF, 0x24, 0x58, 0x11, 0xB8, 0x3F, 0xBF,
+    0xE4, 0xDD, 0xA2, 0xEE, 0x54, 0xDD, 0x28, 0x86, 0x45, 0x97, 0xEC, 0x52, 0xC5, 0x49, 0xAE, 0xF4,
+    0x8B, 0xF7, 0xAD, 0xD2, 0x26, 0x13, 0x0E, 0x0D, 0x77, 0x58, 0x5F, 0x22, 0xB7, 0x53, 0xDF, 0xC7,
+    0x49, 0x8F, 0x4A, 0x20, 0xE3, 0xCF, 0xEA, 0xB4, 0x47, 0xCD, 0xD5, 0xA2, 0x20, 0xAB, 0xB3, 0x54,
+    0x6D, 0x92, 0xDC, 0xF5, 0xD0, 0xA3, 0x6B, 0xF2, 0x2D, 0x58, 0x1A, 0x44, 0x3D, 0x5F, 0xFB, 0x1D,
+    0x9A, 0x62, 0x30, 0xB3, 0x4B, 0xEE, 0xAE, 0xCB, 0xFE, 0x9B, 0xC9, 0x91, 0x99, 0xFA, 0x78, 0xFE,
+    0x2F, 0x07, 0xA5, 0x94, 0x3C, 0x9D, 0x57, 0x7D, 0x21, 0xE2, 0x73, 0x7A, 0x83, 0xE3, 0x74, 0xD2,
+    0x33, 0xCE, 0xCC, 0x0B, 0x77, 0x5D, 0xFC, 0x80, 0x43, 0xCF, 0x71, 0x0D, 0xC7, 0x31, 0xB2, 0xF2,
+    0x64, 0xE2, 0xFD, 0xCE, 0x0A, 0xC4, 0xE2, 0x37, 0x55, 0x21, 0x1F, 0xDD, 0xC3, 0xB6, 0x57, 0x24,
+    0x27, 0xE7, 0x68, 0xFC, 0x02, 0xD3, 0xEC, 0x2B, 0x93, 0xF3, 0xC9, 0x57, 0xAF, 0x58, 0x46, 0x0B,
+    0xD8, 0xC1, 0xBE, 0x32, 0xA8, 0x3E, 0xEB, 0x48, 0x87, 0x67, 0xD4, 0x0F, 0xA7, 0xAB, 0xE2, 0xFC,
+    0xBF, 0x3C, 0x32, 0x4C, 0x13, 0x4D, 0xED, 0x58, 0x76, 0xB6, 0x3F, 0xBA, 0xAA, 0x88, 0x8C, 0x85,
+    0x9D, 0xBE, 0xD8, 0xED, 0x17, 0xBD, 0x0B, 0xD5, 0xD3, 0x94, 0x25, 0xD9, 0xC4, 0xA8, 0xBF, 0x9A,
+    0xEE, 0x6C, 0x53, 0x6A, 0xC8, 0xB9, 0x79, 0x9B, 0xD2, 0x21, 0xA1, 0xA8, 0x23, 0xA4, 0x6B, 0x76,
+    0xE6, 0x79, 0xC6, 0x24, 0x48, 0x7E, 0x7C, 0xC8, 0xFF, 0x3F, 0x10, 0x9F, 0x91, 0x61, 0x21, 0x87,
+    0x59, 0xCA, 0xDA, 0x29, 0xA3, 0x44, 0xB8, 0x91, 0x63, 0xCD, 0xBE, 0xCB, 0xA8, 0x9F, 0x5E, 0x76,
+    0x37, 0xA8, 0x53, 0x30, 0xF1, 0x95, 0x1E, 0x49, 0xDE, 0x7C, 0x4D, 0x18, 0xEC, 0xC3, 0x7F, 0xA8,
+    0x9D, 0x42, 0x1F, 0x97, 0x98, 0xBE, 0x59, 0x33, 0x26, 0xBB, 0xFA, 0x22, 0xF4, 0xBA, 0x9C, 0xDB,
+    0xF9, 0x91, 0x17, 0x13, 0xA2, 0x5E, 0xC8, 0xDD, 0xA6, 0x88, 0x3B, 0x0A, 0x3D, 0x7B, 0x43, 0x61,
+    0xBF, 0xB8, 0x8F, 0x4F, 0xFF, 0xD3, 0x69, 0xFE, 0x96, 0x1D, 0x8E, 0x58, 0x4C, 0x6C, 0x77, 0x78,
+    0x79, 0x67, 0xEF, 0x77, 0xD4, 0x12, 0xD0, 0x70, 0x02, 0xEC, 0x28, 0x0D, 0xAB, 0x0F, 0x6A, 0xAD,
+    0x82, 0x60, 0x62, 0x17, 0x13, 0x4F, 0xFA, 0x36, 0xBD, 0x8D, 0xBA, 0x92, 0x4F, 0xE0, 0xEA, 0x59,
+    0xC5, 0x0A, 0xF3, 0x76, 0xCA, 0xE4, 0xA7, 0x0B, 0xDF, 0xFA, 0x4A, 0x8B, 0x54, 0xFB, 0x48, 0x1F,
+    0x48, 0x2E, 0x70, 0x84, 0xB1, 0x23, 0xE3, 0xDD, 0x14, 0x0A, 0xB6, 0x59, 0xCA, 0x44, 0x1D, 0x1C,
+    0xA7, 0xB3, 0xED, 0x2A, 0xAA, 0xA4, 0x09, 0xCB, 0xDC, 0x59, 0x52, 0xEC, 0xFD, 0xDB, 0xDF, 0xB5,
+    0x55, 0x3D, 0x6F, 0xDD, 0x36, 0x14, 0x3D, 0xA4, 0x92, 0x6A, 0x60, 0x01, 0x66, 0x48, 0x96, 0x02,
+    0xB5, 0x96, 0x76, 0x29, 0xD0, 0x68, 0xCD, 0x12, 0x93, 0x68, 0x80, 0xCE, 0x5E, 0x3C, 0xF5, 0x6F,
+    0x74, 0xF5, 0x93, 0x92, 0x25, 0x63, 0xDB, 0xFF, 0x90, 0x25, 0xC9, 0x90, 0x3F, 0x60, 0xFB, 0x11,
+    0xC9, 0x90, 0x21, 0x43, 0xD4, 0x21, 0x73, 0xD4, 0x16, 0xDD, 0x59, 0x54, 0x81, 0x85, 0x54, 0x7A,
+    0xEC, 0xB9, 0x7C, 0x7A, 0x76, 0x3E, 0x86, 0x2C, 0xB1, 0x1E, 0x48, 0x4B, 0x32, 0x79, 0xCF, 0xE1,
+    0xB9, 0xE7, 0x5E, 0x01, 0xD7, 0xF1, 0x0D, 0x8A, 0x8D, 0xEE, 0x50, 0xA7, 0x35, 0x10, 0x9B, 0x88,
+    0xD2, 0x7F, 0x85, 0xE5, 0xBA, 0x0A, 0x54, 0x45, 0x6A, 0x71, 0xDC, 0xA4, 0x50, 0x9C, 0xBD, 0x59,
+    0x7B, 0x3B, 0x63, 0x46, 0x13, 0xF4, 0xA8, 0x67, 0x98, 0xCE, 0x46, 0x38, 0xEF, 0x3C, 0x26, 0xFE,
+    0xCA, 0x58, 0x46, 0xD4, 0x6D, 0xDD, 0xE2, 0x84, 0x4B, 0x8A, 0x58, 0x44, 0xD8, 0x60, 0x03, 0x1A,
+    0xAC, 0xC0, 0xE5, 0x03, 0x6C, 0x67, 0x3B, 0x38, 0xFE, 0xB8, 0x18, 0xFA, 0x57, 0xE4, 0xBF, 0xA8,
+    0x5A, 0x3E, 0x44, 0xDE, 0xEC, 0x73, 0xE8, 0x80, 0xF3, 0xAB, 0x24, 0x6C, 0x95, 0x26, 0x54, 0x6F,
+    0x9A, 0x60, 0x7B, 0x3D, 0x9A, 0x1E, 0x4E, 0x62, 0x3E, 0x1D, 0x18, 0x9C, 0x3B, 0x27, 0x06, 0x72,
+    0xDC, 0x6D, 0x9F, 0xF7, 0x28, 0xFF, 0x18, 0xA1, 0x87, 0x15, 0x5F, 0x12, 0xF0, 0xB4, 0x18, 0x08,
+    0xDA, 0xFC, 0xB6, 0xF6, 0x26, 0x25, 0x8F, 0x66, 0xC3, 0x60, 0xD7, 0x72, 0xC8, 0x87, 0x1C, 0x3C,
+    0xA3, 0x50, 0x38, 0x1F, 0x7B, 0xB8, 0x4C, 0x48, 0x11, 0xB2, 0xEA, 0x39, 0x66, 0x8E, 0x5F, 0x02,
+    0x4F, 0x3B, 0xC2, 0x7A, 0x7B, 0x89, 0x90, 0xEA, 0x40, 0xFB, 0x22, 0xE9, 0x4E, 0xA7, 0xB7, 0x91,
+    0xD9, 0x1C, 0xF0, 0xB3, 0x7A, 0x70, 0x01, 0x57, 0x71, 0x59, 0x93, 0x22, 0x9A, 0x57, 0x09, 0xAE,
+    0x35, 0x3D, 0xB3, 0x25, 0xC1, 0x9C, 0xE9, 0x60, 0x9F, 0xC5, 0x05, 0x72, 0xB5, 0x85, 0xAC, 0xEE,
+    0xF7, 0x30, 0xBF, 0x8F, 0x7C, 0xE9, 0x98, 0x40, 0xDB, 0xA9, 0x49, 0x6D, 0x7E, 0x9C, 0x69, 0x93,
+    0x19, 0x2A, 0x8D, 0x0C, 0xE6, 0x05, 0x8E, 0xA0, 0x3A, 0xD6, 0x5B, 0x4E, 0x37, 0xE9, 0xA2, 0xF7,
+    0xAE, 0xCF, 0x0F, 0xC7, 0x49, 0x4D, 0x4B, 0x1A, 0x6B, 0xBA, 0x45, 0xB5, 0xE7, 0x60, 0x3A, 0xA5,
+    0x34, 0xAD, 0x39, 0xDD, 0x38, 0x3C, 0x3C, 0xF4, 0x17, 0x0A, 0x53, 0x7E, 0xBD, 0xDB, 0x62, 0x2F,
+    0xDE, 0x7F, 0xC9, 0xB0, 0x7F, 0xF5, 0xE0, 0x1E, 0xA1, 0xE7, 0x6D, 0x57, 0xD2, 0xA4, 0x2A, 0x05,
+    0x87, 0xFD, 0x89, 0xCE, 0x7E, 0x11, 0x26, 0x1D, 0x8F, 0x6D, 0x38, 0xB2, 0x61, 0xAC, 0xDA, 0xA9,
+    0xBA, 0xD3, 0xDB, 0xBB, 0xC3, 0xA4, 0x86, 0xEA, 0x09, 0x6D, 0x93, 0x3A, 0xAE, 0x18, 0x49, 0xA4,
+    0x69, 0xD7, 0xB0, 0x29, 0x05, 0x7D, 0x96, 0x7A, 0x7C, 0x8D, 0x5D, 0xF4, 0x2C, 0xB9, 0x15, 0x33,
+    0x1F, 0x71, 0x14, 0x71, 0x87, 0x7C, 0xEB, 0x42, 0x1A, 0x35, 0xC0, 0x04, 0xA9, 0x85, 0x5C, 0x27,
+    0x0E, 0x6A, 0x24, 0xD1, 0xCA, 0x9F, 0x50, 0x4D, 0x51, 0x88, 0xB5, 0x51, 0x44, 0xAA, 0xB2, 0x92,
+    0x75, 0x5D, 0xED, 0xF3, 0xBA, 0x8A, 0xEB, 0x8A, 0x91, 0x37, 0x6B, 0xEF, 0x50, 0x0F, 0xC5, 0x48,
+    0x32, 0x55, 0xFA, 0x93, 0xCF, 0x03, 0xAB, 0xE7, 0x60, 0x1B, 0xF8, 0x3B, 0x0E, 0x13, 0x17, 0x99,
+    0xC4, 0xE1, 0x96, 0x12, 0xA9, 0xFE, 0xF2, 0x91, 0xBF, 0x90, 0x4A, 0x16, 0x1B, 0xB2, 0x85, 0xD0,
+    0xEC, 0x2D, 0xCA, 0xEE, 0x36, 0x81, 0xDF, 0x81, 0xBE, 0x2C, 0x64, 0x7F, 0x05, 0xB9, 0x6A, 0xC4,
+    0x3A, 0xF8, 0xFE, 0x23, 0x13, 0x7A, 0x1C, 0x2F, 0x80, 0xDB, 0x88, 0xED, 0x8A, 0x4C, 0x68, 0xC1,
+    0x3A, 0x03, 0x0A, 0xB2, 0x1A, 0x69, 0x13, 0xAE, 0x3B, 0x91, 0x36, 0x25, 0xC4, 0x64, 0x9D, 0x6B,
+    0x1D, 0xCC, 0x50, 0x44, 0x9D, 0xBC, 0xBB, 0xFB, 0x36, 0xAA, 0xB4, 0xA9, 0x61, 0xD2, 0x9D, 0x5E,
+    0x9A, 0xE2, 0x79, 0x92, 0xD9, 0xFF, 0x44, 0x62, 0x81, 0xE4, 0xDE, 0x25, 0xE1, 0xB0, 0x1F, 0x30,
+    0x68, 0xC5, 0x0C, 0x52, 0xBC, 0xC8, 0xE7, 0x24, 0x2E, 0x77, 0xD8, 0x20, 0x29, 0x3A, 0x96, 0xE7,
+    0xB2, 0x13, 0x97, 0xAE, 0xA4, 0x21, 0x16, 0xBD, 0x74, 0x44, 0x39, 0x0D, 0xB9, 0xAD, 0xC4, 0xE5,
+    0xE2, 0x23, 0xFD, 0x8F, 0x04, 0xAF, 0x24, 0x9D, 0xEA, 0x4C, 0xC0, 0xAC, 0x64, 0x17, 0x29, 0x83,
+    0x67, 0x81, 0xA7, 0x05, 0x68, 0xB1, 0x1B, 0x4E, 0xF3, 0xB3, 0x6C, 0xFD, 0x49, 0x9E, 0xDD, 0x2C,
+    0xFF, 0xD9, 0x6C, 0xF9, 0x1C, 0xEC, 0xDC, 0x99, 0xE3, 0x49, 0x6D, 0x19, 0x89, 0x59, 0xEF, 0xE2,
+    0xE4, 0x08, 0xD5, 0x3D, 0x46, 0x3F, 0x69, 0x92, 0x2F, 0xCE, 0xFE, 0x4E, 0x82, 0x37, 0xC3, 0x05,
+    0x35, 0xAA, 0x99, 0x52, 0x19, 0x51, 0x91, 0x27, 0x17, 0xC6, 0x7A, 0x20, 0x77, 0xDB, 0x51, 0x3D,
+    0xC7, 0xCE, 0x4F, 0xE5, 0x96, 0x4E, 0xCF, 0xE6, 0x14, 0xCA, 0x41, 0xFF, 0xD7, 0xAD, 0x5B, 0xF3,
+    0x92, 0x05, 0xEC, 0x0C, 0xE3, 0x4D, 0x2C, 0x60, 0x39, 0x2A, 0x6A, 0xFF, 0x2E, 0x96, 0x58, 0x34,
+    0x2B, 0xB7, 0xD5, 0x70, 0xDB, 0x56, 0x98, 0x24, 0x06, 0x45, 0xFD, 0xC3, 0x20, 0xFE, 0xDD, 0xC3,
+    0x47, 0x97, 0x30, 0x9F, 0x64, 0xAF, 0x58, 0x05, 0x39, 0xC5, 0x24, 0xC9, 0x5B, 0x1E, 0xDB, 0x04,
+    0x09, 0x7C, 0x44, 0x86, 0xC4, 0x93, 0xB3, 0xEE, 0xCB, 0xEA, 0x6C, 0x10, 0xB8, 0xDC, 0x12, 0xA4,
+    0xF7, 0xA0, 0x16, 0x04, 0xF5, 0x6F, 0x3E, 0x6F, 0xCE, 0x5C, 0x12, 0x59, 0x6C, 0x66, 0x91, 0xC5,
+    0xCA, 0x32, 0x65, 0x89, 0xB2, 0x58, 0x30, 0x42, 0x3E, 0x97, 0xD6, 0xB7, 0xD2, 0x4F, 0x8A, 0x24,
+    0xC2, 0xB9, 0xC5, 0xE2, 0xFA, 0xD1, 0x43, 0xE9, 0xE8, 0x1B, 0x99, 0xE6, 0xF7, 0xA8, 0xE6, 0xBD,
+    0x6B, 0xBF, 0xA4, 0x4C, 0xBE, 0xA8, 0x28, 0x5F, 0x73, 0xB2, 0x2F, 0xC3, 0xF6, 0xC3, 0x40, 0x79,
+    0x38, 0xAD, 0x64, 0x62, 0xF7, 0x11, 0x51, 0x3B, 0xB2, 0x25, 0x51, 0xD3, 0x15, 0x94, 0x57, 0x4E,
+    0x53, 0x27, 0xE9, 0xA4, 0x32, 0x6D, 0x1E, 0x3D, 0x8E, 0x4A, 0x94, 0xE7, 0xDB, 0x2C, 0xBF, 0x1A,
+    0xC9, 0x53, 0x8D, 0x6C, 0xAF, 0xF9, 0x83, 0x81, 0xE9, 0x74, 0xE7, 0x88, 0x4F, 0x5D, 0xFF, 0x03,
+    0xCD, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x9D, 0xDD, 0x15, 0xB1, 0x84, 0x0B, 0x53, 0x04, 0x09,
+    0x44, 0xE1, 0x16, 0x1A, 0xFC, 0x07, 0x22, 0xD6, 0xE2, 0x37, 0x00, 0x05, 0xBF, 0x80, 0x8E, 0x96,
+    0x02, 0xEE, 0xDC, 0x51, 0x92, 0x86, 0x9E, 0x22, 0x05, 0x24, 0x45, 0x28, 0x53, 0xE4, 0xC3, 0x88,
+    0x82, 0x82, 0x02, 0xFF, 0x03, 0x2C, 0x85, 0x8A, 0x6A, 0x0B, 0x47, 0x32, 0xC8, 0xE7, 0xE1, 0x3D,
+    0xDB, 0x77, 0x5C, 0x04, 0x25, 0x11, 0xF1, 0xC9, 0xA3, 0xBD, 0xDD, 0xD9, 0x99, 0xF7, 0xDE, 0x8C,
+    0x77, 0xC5, 0xEE, 0xBE, 0x13, 0x99, 0x6B, 0x25, 0xB1, 0x76, 0xF2, 0xFB, 0x39, 0xA9, 0xB7, 0xC4,
+    0xEB, 0xA7, 0x32, 0x39, 0x9B, 0x75, 0xAE, 0x15, 0x2D, 0x4E, 0x24, 0x6A, 0x92, 0x52, 0xBC, 0x69,
+    0xC5, 0x05, 0x9F, 0x8B, 0x77, 0x41, 0xA2, 0xDA, 0x8B, 0x1C, 0x45, 0xB5, 0x24, 0xE5, 0x4C, 0x4C,
+    0x87, 0x81, 0x2F, 0x66, 0x12, 0x37, 0x2E, 0x58, 0xCD, 0xFD, 0x87, 0x3E, 0x18, 0xED, 0x33, 0x89,
+    0xF4, 0x7E, 0x2D, 0x66, 0x88, 0x6A, 0xF3, 0x0D, 0xD8, 0xE0, 0x4A, 0x11, 0xBF, 0x5F, 0x0B, 0x96,
+    0x60, 0x24, 0xDB, 0x96, 0x73, 0xCF, 0x80, 0xE3, 0x24, 0x87, 0xF1, 0x15, 0x4D, 0x0B, 0x93, 0xCE,
+    0x60, 0x92, 0x2F, 0xD8, 0x18, 0x9D, 0x06, 0x01, 0x84, 0x43, 0x11, 0xD3, 0x66, 0xF4, 0x8E, 0xE1,
+    0x74, 0x64, 0x1A, 0x38, 0x0A, 0x9C, 0xB2, 0x3C, 0x29, 0x80, 0x07, 0xE8, 0x62, 0x05, 0xA3, 0x48,
+    0x55, 0xC5, 0xFD, 0xDC, 0xDD, 0x2F, 0x4D, 0x27, 0xB6, 0x61, 0xEC, 0x23, 0xBA, 0xA5, 0x05, 0xA0,
+    0x47, 0x75, 0x56, 0x20, 0x40, 0x42, 0x38, 0x31, 0x90, 0x60, 0x60, 0xF3, 0xAB, 0x22, 0xCF, 0x4C,
+    0xC0, 0x9E, 0x05, 0x82, 0x29, 0xD6, 0x9F, 0x16, 0x17, 0xAE, 0x0B, 0xA0, 0x2F, 0x29, 0x2B, 0x8C,
+    0x63, 0xDA, 0xE8, 0x6B, 0x31, 0x31, 0x4E, 0x5F, 0x0D, 0x00, 0x61, 0x66, 0x34, 0x24, 0x6C, 0x9B,
+    0xA8, 0x42, 0x3E, 0x44, 0x8E, 0x2B, 0x57, 0x8F, 0x7C, 0x33, 0xD5, 0x80, 0x4A, 0xC2, 0xF4, 0xBB,
+    0x7B, 0x61, 0xA0, 0x8B, 0x59, 0x78, 0x22, 0x4B, 0x0B, 0x88, 0x90, 0x8B, 0x6C, 0x99, 0xAA, 0x3B,
+    0x9E, 0x64, 0xB6, 0xD4, 0x3F, 0x21, 0xC1, 0xBB, 0x44, 0xB0, 0xB5, 0x32, 0x9E, 0x35, 0x49, 0xEB,
+    0x0B, 0x65, 0x7E, 0x80, 0xA8, 0xF7, 0xF0, 0xC6, 0xCC, 0x1F, 0x08, 0x84, 0x79, 0x7A, 0x08, 0x10,
+    0xB5, 0xAB, 0xB4, 0x66, 0x07, 0x26, 0x1A, 0x56, 0xCB, 0xA5, 0x50, 0x87, 0x9C, 0xAF, 0xCF, 0xF5,
+    0x4C, 0x86, 0x0E, 0xB6, 0x2C, 0x78, 0xDA, 0xEF, 0x35, 0x32, 0xAF, 0xE4, 0x9A, 0xF4, 0x98, 0x76,
+    0xED, 0x6A, 0x37, 0x5B, 0x29, 0x65, 0x08, 0xAA, 0x30, 0xC6, 0x19, 0xCC, 0x9C, 0xE6, 0xF8, 0x2F,
+    0x66, 0xBE, 0x72, 0xF1, 0xE5, 0x52, 0x8C, 0xB8, 0x7F, 0x78, 0xC0, 0x3C, 0x2D, 0xBF, 0x99, 0x6F,
+    0x98, 0x78, 0x30, 0x60, 0x7C, 0x3B, 0xC6, 0x47, 0xC7, 0xB0, 0x19, 0x5F, 0x20, 0x6F, 0xB9, 0x42,
+    0xC6, 0x1E, 0x57, 0x2D, 0x93, 0x1F, 0x8F, 0x89, 0x28, 0x0E, 0x43, 0x4C, 0xDB, 0x8E, 0x7C, 0x30,
+    0x44, 0xA1, 0x20, 0x1B, 0x3B, 0x52, 0xD8, 0x98, 0x2C, 0x8B, 0x6B, 0x28, 0xC1, 0x46, 0x89, 0x0E,
+    0xC6, 0xF6, 0x66, 0xCA, 0x22, 0x4F, 0x98, 0x4A, 0xC9, 0x8A, 0x4D, 0x92, 0x7C, 0x66, 0x43, 0xA0,
+    0xF8, 0xD2, 0x0C, 0xE2, 0x5D, 0x0E, 0x29, 0xEE, 0x20, 0x11, 0x18, 0x64, 0xAD, 0xD8, 0xB3, 0x46,
+    0xBC, 0x0D, 0xB6, 0xB6, 0xD5, 0xBF, 0x97, 0x62, 0x93, 0x66, 0xB1, 0x32, 0x9D, 0xFC, 0xF1, 0xFC,
+    0x57, 0x15, 0x36, 0x79, 0x38, 0x8D, 0x0C, 0xD3, 0x7C, 0x1D, 0x95, 0x81, 0xA3, 0xD7, 0xE0, 0xFA,
+    0x47, 0x85, 0x2F, 0xC4, 0x76, 0x23, 0xF5, 0x63, 0x1E, 0x68, 0xE3, 0x70, 0x3E, 0xEE, 0x5C, 0xAA,
+    0xE0, 0x47, 0x86, 0xA6, 0x37, 0xEF, 0x91, 0xA4, 0x34, 0x8A, 0x3F, 0xD7, 0x19, 0xE8, 0xB6, 0xDC,
+    0x00, 0x70, 0xA1, 0x76, 0x2F, 0x87, 0x83, 0x14, 0xCE, 0x8E, 0x04, 0x4D, 0x7B, 0x69, 0x64, 0xB8,
+    0x89, 0x5F, 0x92, 0x1F, 0x4A, 0xFC, 0x11, 0xC7, 0xA9, 0x96, 0x63, 0xEF, 0xAE, 0x95, 0x8A, 0xED,
+    0x00, 0x31, 0x44, 0x5F, 0xBF, 0x71, 0x93, 0x5A, 0x94, 0x20, 0x9B, 0x78, 0xFB, 0x29, 0xD7, 0x6C,
+    0xED, 0x1D, 0xE6, 0x73, 0x26, 0xBD, 0xC5, 0xF3, 0x5D, 0x06, 0x41, 0xAE, 0xE4, 0x53, 0x32, 0x71,
+    0x15, 0x6F, 0x84, 0xE7, 0xF4, 0x4A, 0x74, 0xF9, 0xB5, 0xE0, 0x4A, 0x38, 0xAF, 0xC8, 0x0E, 0x57,
+    0xA1, 0x8B, 0x53, 0xED, 0xA9, 0xD7, 0xBC, 0xC6, 0x9D, 0x80, 0x5A, 0xC0, 0xCF, 0x17, 0x40, 0x10,
+    0x05, 0x56, 0xA3, 0xA3, 0x92, 0x1E, 0x2B, 0x00, 0xE5, 0x59, 0x20, 0x62, 0xEB, 0xB8, 0xC2, 0x13,
+    0x0F, 0x92, 0x61, 0x25, 0xAE, 0x97, 0x2B, 0x96, 0x67, 0x9D, 0x59, 0xF0, 0x1A, 0xEA, 0xB1, 0x07,
+    0x89, 0xBD, 0x6C, 0xA8, 0x24, 0xDF, 0xF7, 0x7B, 0xDE, 0x41, 0x0B, 0x8A, 0xB3, 0x2D, 0x97, 0xEF,
+    0xF9, 0x05, 0xC5, 0x55, 0xBD, 0xAE, 0xD4, 0x46, 0x18, 0x3D, 0x63, 0x2B, 0x58, 0xE0, 0xC2, 0x0D,
+    0x48, 0x51, 0xAE, 0xC4, 0xF4, 0x41, 0xE0, 0x27, 0x08, 0x36, 0x4A, 0x91, 0x32, 0x0D, 0x12, 0x05,
+    0x05, 0x79, 0x82, 0xE4, 0x05, 0x60, 0xD7, 0x4A, 0x5E, 0x60, 0x1B, 0xDE, 0x80, 0x22, 0xD9, 0xE6,
+    0x36, 0x94, 0x5C, 0xD6, 0x52, 0x8A, 0xB4, 0x16, 0x52, 0x7A, 0x0B, 0x5D, 0x9A, 0x4B, 0xE3, 0x28,
+    0x46, 0x72, 0x90, 0xED, 0xC9, 0x39, 0x9F, 0xF7, 0xAE, 0xD8, 0x1A, 0x04, 0x5E, 0x79, 0xB4, 0xF2,
+    0x37, 0xF3, 0x7D, 0xE7, 0x9C, 0xEF, 0x67, 0x00, 0xE0, 0xFE, 0x57, 0x5C, 0x70, 0x37, 0xAD, 0xB9,
+    0xFA, 0xDF, 0x5A, 0xAE, 0xE9, 0xAB, 0x8E, 0x6B, 0xDC, 0x69, 0xC5, 0xF8, 0xDC, 0xCC, 0x5A, 0xE0,
+    0x4B, 0x1A, 0x67, 0xED, 0xCC, 0xC2, 0xBF, 0xB4, 0x66, 0xEF, 0x56, 0x23, 0xD7, 0x36, 0x9E, 0xF9,
+    0xBD, 0xC3, 0xBA, 0xE4, 0x21, 0x64, 0x35, 0xDC, 0xA0, 0x3F, 0x98, 0x78, 0x1A, 0x28, 0x80, 0x15,
+    0xF4, 0x35, 0x2F, 0x91, 0xB4, 0x7B, 0x73, 0xD2, 0xE9, 0x6B, 0x3C, 0xD0, 0x67, 0x15, 0x4D, 0x0A,
+    0x16, 0x05, 0x3A, 0x0F, 0xC9, 0x5B, 0x3A, 0xF7, 0xE1, 0x35, 0xCD, 0x2E, 0x34, 0x34, 0xC3, 0x59,
+    0x64, 0xE4, 0xE1, 0x99, 0xA2, 0x86, 0x06, 0x71, 0x08, 0xB3, 0x5C, 0xAC, 0x5B, 0x9C, 0x21, 0x1A,
+    0xE5, 0xB6, 0xA8, 0xE8, 0x35, 0xE9, 0x14, 0x73, 0xA4, 0x85, 0x21, 0xCF, 0x14, 0x91, 0x91, 0xE3,
+    0x7F, 0x42, 0xE8, 0x30, 0xEE, 0xC2, 0x88, 0xE2, 0x9B, 0xF7, 0x7F, 0xC0, 0xD7, 0xB4, 0xA4, 0xAD,
+    0x2C, 0x1D, 0xCF, 0x44, 0x23, 0x11, 0xB9, 0xC9, 0xF5, 0xC0, 0xCC, 0x33, 0x2E, 0xF0, 0xE8, 0x95,
+    0x80, 0xEC, 0xE2, 0x74, 0x46, 0x12, 0xC2, 0x84, 0x28, 0x84, 0xCD, 0x02, 0xE0, 0xFE, 0x41, 0x06,
+    0x5F, 0x01, 0x37, 0x1E, 0x9E, 0x33, 0x4C, 0x08, 0xD5, 0x82, 0xC9, 0x28, 0x9A, 0x3E, 0x26, 0x8F,
+    0x97, 0x3A, 0xFE, 0xDD, 0xCF, 0x23, 0xB5, 0x89, 0xE6, 0x45, 0x1A, 0x53, 0x66, 0x11, 0xC6, 0x74,
+    0x31, 0x59, 0x4C, 0x15, 0x13, 0x65, 0xD1, 0xC4, 0x24, 0x31, 0x45, 0x16, 0x41, 0x4C, 0x0F, 0x93,
+    0x63, 0x51, 0x63, 0x2F, 0xC6, 0x76, 0x5B, 0x52, 0x90, 0x5E, 0xE8, 0x70, 0x78, 0x22, 0xE1, 0x25,
+    0xA4, 0x9A, 0x02, 0x8D, 0x86, 0x27, 0x15, 0xB0, 0x17, 0x30, 0xF1, 0x2D, 0x15, 0x06, 0x3D, 0x22,
+    0x59, 0x14, 0x17, 0xDB, 0x92, 0xFB, 0x7A, 0x1D, 0x10, 0x00, 0x48, 0xB1, 0xE3, 0x7D, 0x12, 0x45,
+    0xE2, 0x5A, 0x2A, 0x51, 0x6C, 0xB7, 0x55, 0x22, 0xC7, 0x3B, 0x91, 0xC6, 0xB5, 0xED, 0x33, 0xAC,
+    0x43, 0xEB, 0x82, 0xB2, 0xB6, 0xCF, 0xD0, 0xAC, 0xD4, 0xA0, 0xF8, 0x7B, 0x8A, 0x07, 0x37, 0xE4,
+    0x55, 0xD2, 0x32, 0x37, 0x3F, 0xB4, 0x6E, 0x2C, 0xEE, 0xED, 0x1A, 0x9E, 0x8C, 0xC3, 0x5C, 0xFA,
+    0x8D, 0x29, 0xA5, 0x1C, 0xC9, 0x6B, 0x46, 0x80, 0xBE, 0x3D, 0x29, 0x73, 0x22, 0xF7, 0x94, 0xD1,
+    0xD1, 0x99, 0xDB, 0x44, 0x15, 0x6E, 0xE2, 0x31, 0x33, 0xB2, 0xA3, 0x9C, 0x81, 0xD8, 0x4E, 0xDA,
+    0x2F, 0xC4, 0xF2, 0x2A, 0xBE, 0x86, 0x27, 0x94, 0xEC, 0x6D, 0xCF, 0x72, 0xE0, 0xF9, 0x97, 0x07,
+    0xB6, 0x44, 0x56, 0xD1, 0x6D, 0x87, 0xF0, 0xA0, 0x17, 0xDF, 0xB4, 0x75, 0x43, 0x56, 0x47, 0xBD,
+    0xAF, 0x92, 0x4E, 0x84, 0x0B, 0x49, 0x11, 0xCE, 0xB1, 0x2A, 0x97, 0xDA, 0xD0, 0x5B, 0xE8, 0x2D,
+    0x17, 0xCA, 0x29, 0x11, 0x39, 0x52, 0x81, 0x75, 0x9F, 0x63, 0x30, 0xAC, 0x61, 0x5D, 0x04, 0x3C,
+    0xC1, 0xF1, 0xF3, 0x59, 0x39, 0x93, 0xB4, 0xED, 0x54, 0x87, 0x66, 0xD5, 0x31, 0x8C, 0x56, 0x8C,
+    0xE3, 0xE9, 0x51, 0x53, 0x54, 0xFE, 0xD7, 0x01, 0x2B, 0x11, 0x5E, 0xC1, 0xFF, 0xD9, 0x9F, 0x4C,
+    0x6C, 0x83, 0x9A, 0x7C, 0xDD, 0x7F, 0x50, 0x93, 0x5B, 0x18, 0xD1, 0x25, 0x41, 0x37, 0xBB, 0xE7,
+    0x64, 0xD0, 0x18, 0xDB, 0xEB, 0xD6, 0xCA, 0xA1, 0x31, 0x26, 0xA2, 0x74, 0x40, 0x98, 0x5E, 0x22,
+    0x14, 0x54, 0x15, 0xC8, 0x82, 0x70, 0x66, 0xA1, 0x89, 0x89, 0x51, 0x3A, 0x50, 0x3F, 0xDA, 0xA7,
+    0xA9, 0xB4, 0x50, 0xD7, 0xD4, 0x7A, 0xBF, 0xFD, 0x9D, 0x95, 0x19, 0x6A, 0x0A, 0x2C, 0x23, 0xEB,
+    0x08, 0x77, 0xF8, 0x26, 0x72, 0xAF, 0x0F, 0x99, 0x52, 0x38, 0x13, 0x5E, 0x32, 0x7E, 0xC0, 0xED,
+    0xA3, 0x8B, 0x97, 0x63, 0x84, 0x69, 0x8B, 0xF9, 0xED, 0x3B, 0x6E, 0xE9, 0x96, 0x80, 0x9E, 0x43,
+    0x22, 0x6F, 0xF6, 0x21, 0x36, 0xFC, 0x65, 0x25, 0x93, 0xF6, 0x58, 0xD3, 0x27, 0xC8, 0xDC, 0xED,
+    0xB9, 0x1F, 0x50, 0x7C, 0x46, 0x65, 0xAE, 0xE2, 0x1A, 0xE1, 0x3C, 0x41, 0xF2, 0x4A, 0x73, 0x84,
+    0x47, 0xD5, 0xC9, 0x1F, 0x80, 0xF9, 0xA4, 0xF5, 0x8D, 0x6F, 0x8D, 0x9E, 0x00, 0xE6, 0x42, 0x98,
+    0xFF, 0xC8, 0x04, 0xE4, 0xF7, 0x08, 0xED, 0x26, 0x7F, 0x38, 0x92, 0x80, 0x9A, 0xB1, 0x12, 0x6B,
+    0x17, 0x2E, 0x4E, 0x39, 0x5F, 0x4A, 0xFC, 0x04, 0x1B, 0x72, 0xB6, 0xA8, 0x45, 0x2C, 0x04, 0x07,
+    0xF9, 0x25, 0xE3, 0x78, 0xB9, 0xA6, 0x70, 0x65, 0xBB, 0x59, 0x53, 0x57, 0x26, 0x0F, 0x61, 0x4A,
+    0x29, 0x5E, 0x11, 0x0D, 0xD2, 0xE2, 0xA5, 0xB6, 0x78, 0xDD, 0x3A, 0xDA, 0x79, 0x26, 0x47, 0x05,
+    0x21, 0xD2, 0x12, 0x85, 0xA7, 0xBF, 0xB4, 0x12, 0xBD, 0x57, 0xC8, 0xF3, 0xCB, 0x21, 0x8F, 0x48,
+    0x23, 0xBF, 0xA8, 0x55, 0xF1, 0x5C, 0xF2, 0x47, 0x25, 0xA2, 0x2E, 0x57, 0x19, 0xDD, 0x3E, 0xEA,
+    0x86, 0x8A, 0x63, 0x3D, 0xFC, 0x55, 0xC7, 0xD3, 0xC3, 0x9D, 0x6E, 0xA0, 0x81, 0x77, 0x91, 0x6F,
+    0xA8, 0x7D, 0x21, 0x31, 0xC6, 0x98, 0x23, 0x43, 0x57, 0x8C, 0xAF, 0x28, 0xCB, 0x99, 0x0D, 0x7E,
+    0x66, 0xD4, 0xD7, 0xEC, 0x8C, 0x99, 0x1B, 0xD2, 0x9E, 0x90, 0x77, 0x4D, 0x3C, 0xF9, 0x53, 0x8E,
+    0x96, 0x61, 0xE4, 0xF2, 0x3D, 0x31, 0x97, 0x4A, 0x99, 0x75, 0xB6, 0xD1, 0xCA, 0xAB, 0x08, 0x8E,
+    0xB7, 0xC8, 0x9B, 0x5D, 0x43, 0xB5, 0xA9, 0xE6, 0xAD, 0xB9, 0xC4, 0x27, 0x7C, 0xFE, 0x07, 0xC5,
+    0x55, 0xBD, 0x6E, 0xD5, 0x30, 0x14, 0x3E, 0x49, 0x10, 0x16, 0x64, 0x30, 0x03, 0xA0, 0x0A, 0x24,
+    0xB2, 0x22, 0x18, 0xF2, 0x02, 0x85, 0x04, 0x18, 0x58, 0x59, 0x60, 0xE1, 0x21, 0x58, 0x18, 0x69,
+    0xAF, 0x1F, 0xA1, 0x13, 0x73, 0x07, 0x06, 0x08, 0x43, 0x5F, 0x80, 0xDB, 0x44, 0x30, 0xB0, 0xE6,
+    0x0D, 0xB0, 0x84, 0xBA, 0x94, 0x81, 0x20, 0x65, 0xB8, 0x85, 0x24, 0xE6, 0xFB, 0xEC, 0x5C, 0x7A,
+    0x0B, 0x62, 0x43, 0xC2, 0x83, 0xE5, 0x5C, 0x9F, 0x73, 0xBE, 0x1F, 0x1F, 0xFB, 0x8A, 0x5C, 0x90,
+    0x2D, 0x11, 0xD5, 0x64, 0x22, 0x32, 0xD5, 0xA5, 0x48, 0xE6, 0x0C, 0x96, 0x87, 0x58, 0x6D, 0x8C,
+    0xDA, 0xED, 0x49, 0xEC, 0x9C, 0x13, 0xE5, 0xAA, 0xDA, 0xA8, 0x51, 0x22, 0x93, 0x0C, 0xF8, 0xDD,
+    0x4F, 0x11, 0x27, 0x19, 0x39, 0x2D, 0x38, 0xE5, 0xCC, 0xD5, 0x0D, 0xB7, 0x3B, 0xB9, 0x56, 0xDD,
+    0x1B, 0x44, 0x3B, 0x7B, 0x28, 0x89, 0xEB, 0x73, 0x94, 0x1E, 0x52, 0x2B, 0x52, 0xC4, 0x2B, 0x86,
+    0x20, 0x5C, 0x59, 0x44, 0xC6, 0x3D, 0x0B, 0x0D, 0xB2, 0x30, 0x52, 0x48, 0x3A, 0x3D, 0xAE, 0x0D,
+    0x10, 0x5D, 0x4B, 0xC8, 0x3D, 0xD4, 0x7F, 0x44, 0x10, 0x13, 0x1B, 0x51, 0xE6, 0x06, 0x08, 0x7E,
+    0xE9, 0x80, 0xE1, 0x00, 0x72, 0x7D, 0xFF, 0x0C, 0x47, 0xBB, 0x0D, 0xF2, 0xDF, 0x3A, 0x71, 0x4F,
+    0xBE, 0x36, 0xDA, 0x26, 0x93, 0xD4, 0xA2, 0x7A, 0x50, 0xD0, 0x4D, 0xC6, 0xBA, 0x20, 0x3D, 0xE0,
+    0xCB, 0x03, 0xE6, 0xE5, 0x2E, 0xF0, 0xA2, 0x95, 0xA8, 0x4E, 0x59, 0x29, 0x4C, 0x66, 0xE2, 0x11,
+    0x21, 0x79, 0x2F, 0xEE, 0xE1, 0x97, 0x26, 0x72, 0x53, 0x21, 0x91, 0x6B, 0xC1, 0xF1, 0x92, 0x6A,
+    0xA9, 0x88, 0xF5, 0xA9, 0x12, 0xDC, 0x0D, 0x44, 0x26, 0x27, 0xCF, 0x7A, 0x88, 0x02, 0x87, 0x8B,
+    0x24, 0x88, 0x71, 0x41, 0xD6, 0x9A, 0x55, 0xC7, 0xE5, 0x4A, 0xFE, 0x1C, 0xFF, 0xDF, 0x44, 0x20,
+    0x62, 0xCA, 0x58, 0xB5, 0xE6, 0x57, 0xFF, 0x27, 0xC7, 0xFF, 0x69, 0x22, 0x47, 0xEA, 0x4E, 0x78,
+    0xBA, 0xAE, 0x93, 0xC5, 0xF7, 0xB7, 0x2B, 0x59, 0xB4, 0x68, 0xCF, 0x82, 0x84, 0xFD, 0xE4, 0xA9,
+    0xEB, 0x76, 0x6D, 0x73, 0xDC, 0xAF, 0x6B, 0x02, 0x37, 0xAA, 0x5E, 0x61, 0xDB, 0x4D, 0x28, 0x5F,
+    0xB8, 0xFB, 0xDE, 0x9A, 0x43, 0xBA, 0xE7, 0xFD, 0x62, 0xF8, 0x2E, 0x23, 0xF3, 0x12, 0x85, 0x74,
+    0xA3, 0x56, 0xF4, 0xB5, 0x3E, 0x7A, 0xBA, 0x02, 0xA2, 0x1B, 0x09, 0x09, 0x5C, 0xB9, 0xF2, 0x8B,
+    0x87, 0xA7, 0x9C, 0x74, 0xBF, 0x5C, 0xF2, 0x07, 0xFA, 0x82, 0xD3, 0xB9, 0x39, 0x62, 0x8B, 0x7B,
+    0x0C, 0xD0, 0xE5, 0x4C, 0xE2, 0x54, 0xE6, 0x7A, 0xC4, 0xCE, 0x40, 0x88, 0xFB, 0xD8, 0x24, 0xE3,
+    0xD3, 0x1A, 0x16, 0xE9, 0x55, 0x3C, 0x48, 0xD6, 0xC2, 0xBC, 0x42, 0x68, 0x5E, 0xD2, 0x43, 0x08,
+    0xBE, 0x32, 0x53, 0x88, 0x2C, 0x23, 0x92, 0x82, 0x95, 0x19, 0xBD, 0x9E, 0x10, 0x90, 0xF6, 0xA8,
+    0x5B, 0xB7, 0xC9, 0x98, 0x1D, 0xA0, 0x69, 0x56, 0x03, 0xA6, 0x07, 0x38, 0xF8, 0x32, 0x23, 0xE2,
+    0xBB, 0x35, 0xC1, 0xDC, 0xC4, 0x6C, 0x1F, 0x7D, 0x54, 0xB7, 0x50, 0x0E, 0x2D, 0xB7, 0xA7, 0x70,
+    0x7B, 0x6F, 0x79, 0x43, 0x7B, 0xCF, 0x83, 0xC6, 0x2D, 0xEF, 0x32, 0xFA, 0x1E, 0x72, 0x94, 0x51,
+    0x66, 0x93, 0x27, 0xBA, 0x2D, 0xB1, 0x89, 0xF7, 0x08, 0x44, 0xD2, 0x16, 0x24, 0x80, 0xBC, 0x43,
+    0x0F, 0xD3, 0x56, 0xC0, 0x0B, 0xF2, 0xB2, 0xD2, 0x37, 0x19, 0x3E, 0x78, 0xC8, 0x48, 0xE8, 0xE2,
+    0xA9, 0xAA, 0x26, 0x40, 0xA2, 0xCB, 0x12, 0x4C, 0x03, 0x25, 0xF9, 0x04, 0x84, 0x33, 0xC1, 0xF8,
+    0x04, 0xF1, 0x09, 0x50, 0x84, 0x04, 0x70, 0xB9, 0x4B, 0x04, 0xE5, 0xC1, 0x96, 0x21, 0x41, 0xF9,
+    0x04, 0x89, 0x78, 0x9B, 0xD1, 0xBC, 0x92, 0x41, 0x82, 0xFA, 0xDC, 0x01, 0x56, 0x1B, 0xB9, 0x23,
+    0xDB, 0x33, 0xC7, 0xCB, 0xEB, 0x0B, 0x41, 0xAB, 0x51, 0x2E, 0x9C, 0x7E, 0xBE, 0x76, 0x81, 0xDA,
+    0x94, 0xAD, 0xAD, 0x2C, 0x17, 0xCE, 0xE8, 0x4F, 0x2F, 0x07, 0x71, 0xA0, 0xA2, 0x3B, 0xD8, 0x3A,
+    0x42, 0x51, 0xDE, 0x78, 0xB7, 0x75, 0x53, 0xB0, 0x1B, 0xE0, 0xB1, 0xD9, 0x41, 0x81, 0x94, 0x07,
+    0x31, 0xA0, 0x00, 0x0A, 0xEF, 0xB2, 0x93, 0x5B, 0x08, 0x5B, 0xC6, 0xDD, 0x1C, 0xE7, 0xCB, 0x27,
+    0x96, 0xB0, 0xFE, 0x6C, 0x48, 0x39, 0xE8, 0xCF, 0x1C, 0x87, 0xF6, 0xF3, 0xFB, 0x83, 0xE3, 0xEA,
+    0xED, 0xB4, 0xB7, 0xB9, 0x8D, 0x05, 0x93, 0x8A, 0xE3, 0xEA, 0xC0, 0xB2, 0xC7, 0x5D, 0x2F, 0xC1,
+    0xA1, 0xB3, 0xDB, 0x64, 0x2C, 0xC1, 0xA4, 0xE0, 0x38, 0x7B, 0x2D, 0x6C, 0xFB, 0xDB, 0xF6, 0xFB,
+    0x76, 0x1C, 0xB6, 0x25, 0x5A, 0x77, 0x1C, 0xFD, 0xB8, 0x3A, 0x3E, 0x66, 0xF1, 0x0E, 0x07, 0x31,
+    0x85, 0x6D, 0x30, 0x16, 0xD9, 0x51, 0x27, 0x92, 0x7E, 0x00, 0xF0, 0x30, 0xD5, 0x8D, 0x1E, 0x71,
+    0x73, 0x5D, 0x99, 0xB6, 0x59, 0x0B, 0x79, 0x03, 0xE5, 0x95, 0x32, 0xF8, 0x6B, 0xBD, 0x0B, 0x4E,
+    0x38, 0x81, 0xBC, 0x7C, 0x17, 0x6C, 0xF0, 0x7E, 0x58, 0xC0, 0xEF, 0x00, 0x0D, 0xBE, 0xC9, 0x1C,
+    0x07, 0xD0, 0x58, 0x92, 0x29, 0x6E, 0x12, 0xF7, 0xA3, 0x93, 0x6E, 0xD1, 0xC9, 0xF3, 0x78, 0x7F,
+    0xF3, 0x71, 0x2B, 0x41, 0xA0, 0x0D, 0xFF, 0x1C, 0x7C, 0xBC, 0x48, 0x8D, 0x96, 0x50, 0x31, 0x3B,
+    0xC9, 0x9F, 0xD4, 0x99, 0x1F, 0x97, 0x12, 0xE8, 0xFE, 0xFD, 0x47, 0xE8, 0xE0, 0x1B, 0x97, 0x39,
+    0x8B, 0x5B, 0x4A, 0xBD, 0x8F, 0x22, 0xB3, 0xB0, 0xDB, 0xDA, 0x7D, 0xBD, 0x6F, 0xEB, 0xEE, 0xA6,
+    0xBC, 0xDE, 0xBC, 0xAD, 0xC1, 0x53, 0xDA, 0x82, 0xB6, 0x61, 0x2D, 0xDF, 0xA3, 0x32, 0xDB, 0x48,
+    0x0A, 0xA1, 0x33, 0xE7, 0xD3, 0xE4, 0x76, 0x1C, 0xB6, 0x45, 0x2E, 0x56, 0xAF, 0x70, 0x4D, 0x6D,
+    0xC4, 0xD7, 0xE8, 0x54, 0x50, 0xC2, 0xCB, 0x04, 0x3D, 0xB4, 0x9D, 0xA5, 0x8B, 0xC0, 0x91, 0x60,
+    0x79, 0x38, 0x00, 0xD6, 0x67, 0x2B, 0x2E, 0xC3, 0x72, 0x23, 0x88, 0x58, 0xC5, 0x1C, 0x64, 0x79,
+    0x47, 0xBD, 0x8A, 0x1A, 0xF7, 0xF0, 0x7C, 0xF5, 0x26, 0x75, 0x63, 0xD0, 0x23, 0xC1, 0x9B, 0xA5,
+    0x8F, 0x1B, 0xF8, 0xCA, 0x20, 0x17, 0x70, 0x28, 0xE6, 0x5F, 0x59, 0x62, 0xA1, 0x92, 0xE6, 0x93,
+    0x45, 0x20, 0x70, 0xCE, 0x67, 0xCA, 0xFF, 0x66, 0xFC, 0x04, 0xBD, 0x55, 0xBD, 0x6E, 0xD4, 0x40,
+    0x10, 0x1E, 0xDB, 0x49, 0x56, 0x89, 0x0B, 0x37, 0x20, 0x21, 0x1A, 0x57, 0xD4, 0x7E, 0x01, 0xC8,
+    0xBA, 0xA3, 0xE5, 0x11, 0xE8, 0xE8, 0xA8, 0x29, 0xB8, 0x3B, 0x3F, 0x42, 0x7A, 0x1E, 0x00, 0x94,
+    0x86, 0x26, 0x05, 0xC5, 0x39, 0x71, 0x4F, 0xE3, 0x47, 0xB0, 0x44, 0x07, 0x8D, 0x91, 0x8C, 0x64,
+    0x22, 0x27, 0xCB, 0xF7, 0xCD, 0x6E, 0xCE, 0x77, 0x27, 0x82, 0x10, 0x05, 0xD6, 0xED, 0xEE, 0x79,
+    0x67, 0x77, 0xE6, 0x9B, 0x6F, 0x7E, 0x2C, 0xC7, 0xF2, 0x48, 0x32, 0x79, 0x2A, 0xD9, 0xB7, 0x51,
+    0x8C, 0xEB, 0x44, 0x2E, 0x4B, 0xB9, 0x7B, 0x0A, 0xD7, 0x8A, 0xC5, 0x88, 0x7F, 0x8A, 0xC4, 0x83,
+    0x48, 0xD2, 0xFB, 0x61, 0x70, 0xCC, 0xB4, 0x22, 0x69, 0x23, 0x92, 0x85, 0x91, 0x57, 0x38, 0x8F,
+    0xAB, 0x56, 0xE6, 0xB1, 0xC4, 0xA8, 0x31, 0xA6, 0x30, 0x46, 0xA8, 0xC1, 0x58, 0xB9, 0x4A, 0xAE,
+    0x5C, 0x23, 0x47, 0x72, 0x12, 0x77, 0xA6, 0x5A, 0x7D, 0x6C, 0x52, 0x18, 0x79, 0x5D, 0x05, 0xAB,
+    0xD1, 0xA0, 0xB7, 0xAC, 0xEA, 0x4D, 0x3A, 0x89, 0xC6, 0xAD, 0x77, 0x98, 0xDE, 0x91, 0xE3, 0x9D,
+    0xC8, 0xD6, 0xDE, 0x20, 0x11, 0x27, 0xEE, 0x46, 0x01, 0x03, 0x0C, 0xB1, 0x5A, 0x0F, 0x77, 0xE1,
+    0xD1, 0x4E, 0x7A, 0x89, 0x1A, 0x67, 0x31, 0x17, 0x20, 0x4D, 0xDB, 0x3B, 0x31, 0x71, 0x16, 0x15,
+    0x61, 0xA6, 0x0E, 0x3B, 0x17, 0x22, 0xCF, 0xB0, 0x5F, 0x4A, 0x84, 0x83, 0x05, 0xF0, 0xDD, 0x96,
+    0x92, 0x0E, 0x01, 0xEC, 0x4B, 0x5E, 0xCF, 0x1B, 0x9E, 0x98, 0xE1, 0x43, 0x95, 0xA5, 0x32, 0x80,
+    0x07, 0x2D, 0x35, 0x8F, 0x40, 0xED, 0x72, 0x5B, 0x04, 0x4C, 0x40, 0xB0, 0xA6, 0xC8, 0x54, 0xF2,
+    0x89, 0xE0, 0xA0, 0x62, 0x90, 0xE4, 0x5A, 0xCC, 0xE8, 0x15, 0x1D, 0x7B, 0x68, 0x2B, 0xA1, 0x9E,
+    0xF9, 0x89, 0xE1, 0x1F, 0x83, 0x52, 0x9C, 0xA9, 0xE7, 0xB3, 0x03, 0x8C, 0xC8, 0xDA, 0x3B, 0x30,
+    0x69, 0x3C, 0xB6, 0xC4, 0x81, 0x85, 0x7A, 0x23, 0xCE, 0x2A, 0x86, 0xC2, 0xB8, 0x51, 0x23, 0x01,
+    0x7A, 0x6A, 0xEC, 0x4E, 0x32, 0x46, 0x63, 0x3C, 0x24, 0x7D, 0xD2, 0x9B, 0xCE, 0xB4, 0x69, 0x9B,
+    0x35, 0x59, 0x93, 0x57, 0x45, 0x59, 0x50, 0x01, 0xB8, 0x4D, 0x1B, 0xB2, 0x3B, 0x91, 0x5F, 0xE8,
+    0x2F, 0x4A, 0x10, 0x09, 0xED, 0x70, 0xC4, 0xAA, 0x23, 0x1D, 0x8F, 0x2D, 0xB8, 0xC2, 0x9D, 0x9A,
+    0x76, 0xB0, 0xC2, 0xE0, 0x44, 0xC6, 0xB1, 0xEE, 0x5F, 0xC0, 0xCF, 0x12, 0x3A, 0x56, 0xF0, 0xB2,
+    0xD4, 0x0B, 0xAD, 0xBF, 0x20, 0xFE, 0x42, 0x85, 0x0B, 0x88, 0x43, 0x51, 0x22, 0x12, 0xB1, 0x72,
+    0xAE, 0x61, 0x36, 0x3D, 0xE7, 0x1B, 0x8C, 0x87, 0x57, 0x40, 0x6F, 0x1C, 0xDF, 0x57, 0xCA, 0xDB,
+    0x0B, 0x4E, 0x47, 0x12, 0x95, 0x50, 0x52, 0x23, 0x32, 0x59, 0x0B, 0x56, 0xD7, 0xB2, 0xF3, 0x98,
+    0x36, 0xEE, 0x21, 0xB4, 0x30, 0x01, 0x6A, 0x27, 0x58, 0xCE, 0xAA, 0xB4, 0x85, 0xA9, 0x09, 0xD0,
+    0xB0, 0xD7, 0xC3, 0xBA, 0x95, 0xBC, 0x34, 0x1D, 0xCE, 0x2D, 0xF0, 0x37, 0x6D, 0xB1, 0xA7, 0xE7,
+    0x1A, 0x3D, 0xB7, 0xD6, 0x73, 0x31, 0xF7, 0xAC, 0x66, 0xBE, 0x62, 0x23, 0x34, 0x92, 0xAD, 0x79,
+    0x0F, 0xBB, 0xF2, 0x0A, 0x7E, 0xA4, 0x8E, 0xD0, 0x7C, 0x6E, 0x3F, 0x96, 0xF0, 0x3F, 0x42, 0xFC,
+    0xC4, 0x7C, 0xE9, 0x19, 0xA6, 0x91, 0xE9, 0xF5, 0x74, 0x07, 0x1F, 0x6B, 0x46, 0x0B, 0x46, 0x27,
+    0x66, 0xAB, 0x26, 0xBD, 0xB7, 0xA2, 0x16, 0x74, 0x62, 0x44, 0x35, 0x6D, 0x35, 0xA8, 0x5B, 0x13,
+    0x11, 0x69, 0x31, 0x7A, 0xB6, 0x74, 0x3A, 0x95, 0x00, 0xEC, 0x77, 0xDA, 0xBD, 0xE2, 0x8D, 0xF6,
+    0x0C, 0x8A, 0x9F, 0xAC, 0xA0, 0xC9, 0x3A, 0x56, 0x34, 0x4F, 0x1C, 0x86, 0xE4, 0x3B, 0xC3, 0x91,
+    0x89, 0x49, 0xD8, 0x48, 0xFC, 0x63, 0x90, 0xB8, 0x2F, 0x24, 0xEE, 0xE2, 0x76, 0xC6, 0x9E, 0x97,
+    0x1E, 0x93, 0x2A, 0x9A, 0x82, 0xE1, 0xFB, 0x37, 0x9B, 0xAD, 0xCD, 0x65, 0x40, 0xBD, 0xD9, 0x1C,
+    0xB7, 0x36, 0xE9, 0x18, 0x1D, 0x7E, 0x37, 0x78, 0x44, 0x99, 0x66, 0x43, 0x21, 0x1A, 0x45, 0xB1,
+    0x25, 0x73, 0x89, 0xE9, 0x65, 0x4B, 0x46, 0xB6, 0x84, 0x04, 0x53, 0xD6, 0x58, 0x96, 0x39, 0xA6,
+    0x68, 0xB4, 0x20, 0xA5, 0xE6, 0x64, 0x19, 0x81, 0x8C, 0xAD, 0x2E, 0x61, 0x79, 0x47, 0xB7, 0xA4,
+    0xAB, 0xF6, 0x55, 0xA2, 0x05, 0x92, 0xB3, 0xAD, 0x80, 0x0D, 0x70, 0xBE, 0x24, 0x5D, 0xD4, 0xCF,
+    0x6A, 0xC1, 0xBA, 0x22, 0x86, 0xAC, 0x05, 0x5F, 0xD1, 0xB4, 0x13, 0xB2, 0x71, 0xC3, 0xEC, 0x69,
+    0xC0, 0x05, 0x4D, 0xDA, 0x0E, 0x54, 0x7C, 0x58, 0x06, 0x1F, 0xE9, 0x86, 0x52, 0x4E, 0x9F, 0xD4,
+    0xC9, 0xAD, 0xAC, 0xC9, 0x91, 0x5D, 0x48, 0xED, 0x09, 0xBA, 0xB3, 0x06, 0x75, 0x3F, 0x02, 0x49,
+    0xFE, 0xBC, 0x97, 0xF8, 0x3B, 0xAE, 0x5A, 0x96, 0x32, 0x13, 0x9D, 0xED, 0x33, 0x1D, 0xB1, 0x53,
+    0xA7, 0x1D, 0x3D, 0x84, 0x62, 0xE0, 0xC9, 0x2B, 0x24, 0xE4, 0x80, 0x9A, 0xB0, 0xA8, 0x0E, 0x25,
+    0x63, 0x06, 0xA7, 0x46, 0x87, 0x80, 0xCD, 0x30, 0x43, 0x68, 0xEF, 0x80, 0xA2, 0xC5, 0xBE, 0xD1,
+    0x68, 0x63, 0xB4, 0xFF, 0x37, 0xA3, 0x27, 0x95, 0x24, 0x70, 0xF0, 0x52, 0xD3, 0x90, 0x9D, 0xEB,
+    0x62, 0xFE, 0x9E, 0xEC, 0x37, 0xA3, 0x7B, 0x5B, 0x72, 0xB7, 0xD7, 0x92, 0x29, 0x46, 0xBE, 0xDC,
+    0x75, 0xB4, 0xEB, 0xF3, 0x0F, 0x2B, 0xE7, 0x3E, 0x3B, 0xB4, 0x2F, 0xDA, 0x8B, 0x27, 0x6D, 0x93,
+    0xFC, 0x5C, 0xE0, 0xFE, 0x1B, 0x6F, 0xEC, 0xC1, 0x7E, 0x2B, 0x2C, 0xEE, 0x6F, 0x85, 0x24, 0x67,
+    0xF7, 0x7B, 0xF1, 0x07, 0x70, 0xAA, 0xC9, 0xDB, 0x0A, 0x9F, 0xA6, 0xFD, 0xF7, 0xBF, 0xF9, 0x74,
+    0x7D, 0x3D, 0x7F, 0xEF, 0xDC, 0x2D, 0x7E, 0x81, 0x1B, 0xDE, 0x1E, 0x34, 0x8F, 0xDE, 0x0A, 0xDB,
+    0xC1, 0x81, 0xFC, 0x97, 0xE7, 0x17, 0xCD, 0x95, 0xBD, 0x6E, 0xD4, 0x40, 0x14, 0x85, 0x8F, 0x6D,
+    0x88, 0x25, 0x5C, 0x0C, 0x45, 0x68, 0x68, 0x5C, 0xF0, 0x00, 0x7E, 0x01, 0xC8, 0xF8, 0x0D, 0xC8,
+    0x6B, 0x50, 0xA5, 0x4D, 0x91, 0xAC, 0xFD, 0x06, 0xA1, 0x82, 0x36, 0x25, 0xDA, 0x67, 0xD8, 0x9F,
+    0xA1, 0xA2, 0xA0, 0x31, 0x14, 0xB4, 0x31, 0x2D, 0x12, 0x92, 0x89, 0x2C, 0xB1, 0x42, 0xF6, 0x0E,
+    0xE7, 0xDE, 0xD9, 0xBF, 0x48, 0x91, 0xE8, 0x50, 0x46, 0x96, 0xB5, 0x9A, 0x99, 0x7B, 0xE7, 0xDC,
+    0xEF, 0x1E, 0xCF, 0x02, 0xC7, 0xC0, 0x20, 0x4F, 0xB4, 0x42, 0xDC, 0x23, 0xEE, 0x90, 0xE8, 0x93,
+    0xB6, 0xC8, 0x1A, 0x18, 0xA7, 0x4F, 0x8D, 0xBC, 0x44, 0x51, 0xC2, 0x42, 0x9E, 0x09, 0x30, 0x07,
+    0x66, 0x77, 0xE2, 0x42, 0x50, 0x18, 0x12, 0xDD, 0x68, 0x10, 0xF0, 0x12, 0x78, 0xCA, 0xA9, 0x02,
+    0xCF, 0x99, 0xC8, 0xB8, 0xA4, 0x4B, 0x5D, 0xB4, 0x4A, 0x5A, 0xCC, 0xA3, 0x96, 0x93, 0xD7, 0x92,
+    0x5D, 0x03, 0x99, 0x45, 0xB3, 0x4A, 0xFE, 0x30, 0xD9, 0xDE, 0x33, 0x99, 0xCA, 0x64, 0x7F, 0x38,
+    0xF9, 0x63, 0x7A, 0x9D, 0x7A, 0x3F, 0xC4, 0xDE, 0xAF, 0xB9, 0x54, 0x9E, 0xC2, 0x52, 0xF5, 0x60,
+    0x91, 0x7E, 0xEF, 0x50, 0xBC, 0x2E, 0x31, 0x3B, 0xD7, 0xF4, 0x12, 0x4C, 0xD9, 0x14, 0xAA, 0x3F,
+    0x25, 0x94, 0xB9, 0xA9, 0x52, 0xAA, 0x92, 0x3A, 0x64, 0x53, 0x5E, 0x6B, 0xE2, 0xB8, 0xDB, 0x6D,
+    0x12, 0x01, 0xCC, 0xA7, 0xFB, 0x07, 0x68, 0x1D, 0xBA, 0xD3, 0x06, 0x29, 0xDC, 0x9C, 0x39, 0x5D,
+    0xE1, 0x7E, 0xD9, 0xCB, 0x64, 0x49, 0x17, 0x95, 0x16, 0x8B, 0xA4, 0x35, 0xED, 0x04, 0x33, 0x09,
+    0xDE, 0x2F, 0x13, 0xA2, 0x28, 0x60, 0x74, 0xF2, 0x67, 0xFA, 0xA1, 0xF2, 0xFE, 0xB3, 0xF7, 0x2B,
+    0xAA, 0xDE, 0x60, 0xE6, 0xF9, 0x4C, 0x50, 0xE0, 0x0E, 0x66, 0x61, 0x7C, 0x8C, 0xD5, 0x22, 0xEA,
+    0xD7, 0x71, 0x7F, 0x71, 0xD8, 0x9B, 0xCC, 0xDD, 0x89, 0x0B, 0x41, 0xF7, 0x09, 0x0A, 0x27, 0x76,
+    0x9A, 0x31, 0xFB, 0xE2, 0x30, 0xAE, 0x61, 0x7C, 0x0D, 0x3E, 0x55, 0x03, 0xDB, 0x23, 0xF5, 0xC0,
+    0x8B, 0xB0, 0xBC, 0xA9, 0x4A, 0xCA, 0x5F, 0x4F, 0xA7, 0xB9, 0xF7, 0xB7, 0x02, 0x96, 0x0A, 0x07,
+    0xCE, 0x31, 0x61, 0x51, 0x92, 0x8E, 0x95, 0x64, 0x13, 0x91, 0xC0, 0xD9, 0x9F, 0xF0, 0x4D, 0xD1,
+    0x65, 0x3D, 0x93, 0x2C, 0xBB, 0x68, 0x22, 0x4C, 0x67, 0x12, 0x3F, 0x50, 0x16, 0x8B, 0xB5, 0x5B,
+    0x5B, 0xBC, 0x51, 0x67, 0x48, 0xEF, 0x60, 0x89, 0x5C, 0x41, 0x28, 0x11, 0x8E, 0xAD, 0x71, 0x36,
+    0xA3, 0xA8, 0xA5, 0x3B, 0x5E, 0xFA, 0x93, 0x8C, 0x52, 0x43, 0xAE, 0x46, 0x5B, 0x4A, 0xED, 0xC9,
+    0xEF, 0x96, 0xCE, 0x32, 0x57, 0x0E, 0x97, 0x38, 0x29, 0xD8, 0xAB, 0xA8, 0x9F, 0xF0, 0xB8, 0xCC,
+    0x0D, 0x3C, 0xCA, 0xC6, 0x3D, 0x35, 0x0E, 0x49, 0x9B, 0x35, 0xE4, 0xEF, 0x0A, 0xA6, 0xCF, 0xCB,
+    0x81, 0x7A, 0x6C, 0xD2, 0x52, 0xC6, 0x2C, 0xAF, 0x4D, 0x1D, 0xAD, 0xE6, 0xD4, 0x9E, 0xDC, 0x76,
+    0x14, 0x90, 0xDD, 0x38, 0x81, 0xB8, 0x50, 0x76, 0xBD, 0x38, 0xA2, 0x72, 0xE2, 0x09, 0x2F, 0x4D,
+    0x88, 0xB5, 0xE1, 0x4F, 0xEA, 0xCD, 0xAF, 0xEA, 0xC0, 0x97, 0x38, 0xDF, 0x4A, 0x7D, 0x0C, 0x5C,
+    0x98, 0x35, 0xB2, 0x4F, 0x7E, 0xC0, 0x38, 0x9E, 0x35, 0x66, 0xC4, 0x18, 0x79, 0x64, 0x6D, 0xD1,
+    0x60, 0x9E, 0x10, 0x4F, 0xC3, 0x62, 0x07, 0x9E, 0x9D, 0xBB, 0x0A, 0xF1, 0x2A, 0xA3, 0xE9, 0xCB,
+    0x91, 0x65, 0x30, 0x93, 0x65, 0x49, 0x69, 0xC7, 0xDE, 0x2D, 0xA8, 0x64, 0xB7, 0x8F, 0x0B, 0x0F,
+    0xA9, 0xFC, 0xFD, 0x08, 0x9D, 0xD2, 0xC9, 0xD4, 0xC9, 0xFB, 0x44, 0x5E, 0x51, 0xAB, 0xEF, 0xCD,
+    0x9E, 0x53, 0x2E, 0xF9, 0x16, 0xB3, 0xCA, 0x3B, 0x73, 0xF3, 0x6D, 0xA4, 0x33, 0x4C, 0x93, 0x77,
+    0x2C, 0x70, 0xA4, 0x59, 0x2C, 0x8D, 0xC7, 0xFE, 0x1B, 0x67, 0x11, 0x0D, 0x29, 0xBF, 0xCE, 0x7A,
+    0x41, 0x13, 0x98, 0x46, 0x41, 0x28, 0x91, 0x8A, 0xEA, 0x49, 0xAE, 0xDC, 0xED, 0xC3, 0xA1, 0x86,
+    0xF9, 0xA6, 0x01, 0x91, 0xB8, 0xE5, 0x95, 0xC8, 0xA8, 0xF5, 0x48, 0x19, 0x47, 0x38, 0xA2, 0xBC,
+    0x5C, 0xEE, 0x24, 0x14, 0xB2, 0x09, 0x56, 0x43, 0x97, 0x6E, 0x27, 0xFA, 0x41, 0xDA, 0xEB, 0x2D,
+    0x6F, 0xC0, 0xA4, 0x25, 0xDA, 0xE4, 0x2B, 0x3F, 0x87, 0xCC, 0xB3, 0x08, 0x23, 0xDF, 0x85, 0xDC,
+    0x44, 0x61, 0x1C, 0x07, 0x83, 0xC5, 0xBF, 0xBC, 0x87, 0x32, 0xB5, 0x7D, 0xD2, 0xAB, 0xC3, 0xB2,
+    0x9E, 0xD2, 0x05, 0x2A, 0xC4, 0x50, 0x6A, 0xB1, 0xDC, 0x61, 0x01, 0xA1, 0xAA, 0xFC, 0xD4, 0x63,
+    0x02, 0x5B, 0xB1, 0xF2, 0x6B, 0xB5, 0xA5, 0x98, 0x4C, 0x69, 0x87, 0xAB, 0x35, 0x59, 0x85, 0xDB,
+    0x9A, 0x47, 0xB7, 0x1B, 0xBA, 0xD2, 0xE7, 0x47, 0xB0, 0xE6, 0xA3, 0x6F, 0x2E, 0xCC, 0x95, 0xEF,
+    0x8F, 0xF3, 0xE5, 0xFB, 0x01, 0x85, 0x44, 0x15, 0x1D, 0x5F, 0x56, 0xBE, 0x6C, 0x5B, 0x46, 0x03,
+    0xC4, 0xCF, 0x7A, 0x98, 0x9E, 0x1F, 0xB2, 0x8A, 0xA3, 0xF5, 0x34, 0x2E, 0x99, 0x46, 0x55, 0xA8,
+    0xA7, 0xD9, 0xEE, 0xBC, 0x16, 0xF3, 0xD7, 0xFF, 0xA4, 0x9F, 0xEF, 0xE8, 0x97, 0x42, 0xFF, 0x64,
+    0x4F, 0x3F, 0x0A, 0xF4, 0x3B, 0xA1, 0x9F, 0xD1, 0x1D, 0xA4, 0x5F, 0xEF, 0xE9, 0xCF, 0x85, 0x3E,
+    0x94, 0x7E, 0xAC, 0xF4, 0xD3, 0x40, 0x7F, 0x2D, 0xF4, 0x0B, 0xA5, 0x6F, 0xF7, 0xF4, 0xA3, 0x60,
+    0x64, 0x75, 0xAF, 0xFC, 0x03, 0x84, 0x89, 0x67, 0x67, 0x5C, 0x87, 0x1F, 0x85, 0x8A, 0x6F, 0xB0,
+    0xB3, 0x97, 0x7A, 0x7E, 0xA9, 0xC6, 0xAE, 0xCD, 0xCD, 0xBB, 0x01, 0xDE, 0x65, 0x8D, 0xE1, 0x99,
+    0x91, 0x18, 0xBB, 0x20, 0x92, 0x9D, 0x61, 0x53, 0xA9, 0xE0, 0x92, 0x54, 0x32, 0xB7, 0x37, 0xF6,
+    0x84, 0xC2, 0x53, 0x31, 0xF6, 0x3C, 0xEE, 0xF6, 0xC6, 0x96, 0x26, 0xEB, 0x2D, 0x68, 0xB7, 0x5D,
+    0x58, 0x70, 0xE2, 0x8C, 0x4D, 0xA8, 0x38, 0x2B, 0x70, 0xFE, 0xC3, 0xF8, 0x0B, 0xBD, 0x55, 0x31,
+    0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xF6, 0x44, 0xB2, 0x38, 0x17, 0xA6, 0x41, 0x82, 0x44, 0xCA, 0xB4,
+    0x34, 0xC8, 0x2D, 0x4D, 0x18, 0x43, 0x41, 0x9D, 0x02, 0x42, 0x91, 0x02, 0x7A, 0x8A, 0xB4, 0x14,
+    0x61, 0x6D, 0x2A, 0x0A, 0x9A, 0xEB, 0x69, 0x28, 0x22, 0x94, 0x5C, 0x43, 0x8F, 0x6E, 0xD7, 0x13,
+    0x28, 0x52, 0x50, 0x64, 0x29, 0xAE, 0xA2, 0x88, 0x91, 0x42, 0x01, 0x95, 0x81, 0x45, 0xF8, 0x0E,
+    0xDB, 0xC3, 0x7B, 0xE3, 0xD3, 0xB1, 0xCB, 0x0F, 0x88, 0xF7, 0x6E, 0xC7, 0x1E, 0xCF, 0x7C, 0xF3,
+    0xDE, 0xFB, 0xDE, 0xF7, 0x2D, 0x70, 0xFD, 0xE4, 0x01, 0x90, 0x87, 0x09, 0x48, 0x43, 0xC0, 0xFE,
+    0x65, 0xC3, 0x31, 0x50, 0x87, 0x19, 0x68, 0x7F, 0x6D, 0x7B, 0xB4, 0x4D, 0x32, 0xA3, 0xAE, 0x60,
+    0xBD, 0xAB, 0x60, 0x76, 0x65, 0x03, 0x6C, 0x0A, 0xCF, 0x65, 0x3F, 0x74, 0x80, 0xF9, 0x73, 0xC7,
+    0x1D, 0xE3, 0xC8, 0x2F, 0x57, 0x6B, 0xEF, 0x33, 0xBE, 0xCE, 0xFE, 0xE1, 0x9B, 0xF4, 0x62, 0xE0,
+    0xF3, 0xB4, 0xE1, 0x57, 0xAD, 0x3D, 0xE5, 0x93, 0x1E, 0x28, 0xB6, 0x5C, 0x59, 0xF4, 0xCE, 0x23,
+    0xEF, 0xB3, 0x01, 0xC5, 0x0E, 0xED, 0x2F, 0xF7, 0x06, 0xC2, 0x08, 0x0C, 0x53, 0x86, 0x2D, 0x17,
+    0xBF, 0x22, 0x08, 0x47, 0x27, 0x0F, 0x61, 0x08, 0x2B, 0x09, 0xA1, 0xB9, 0xC2, 0x95, 0x84, 0x0E,
+    0x19, 0x27, 0xB3, 0xE9, 0xC3, 0xDE, 0x0C, 0xD8, 0xA4, 0x0C, 0xE0, 0x47, 0x98, 0x7E, 0x4D, 0x04,
+    0x8E, 0x00, 0x88, 0xAA, 0x78, 0xD2, 0xC1, 0xFC, 0x3E, 0x20, 0x19, 0x56, 0xC0, 0xDA, 0x36, 0x70,
+    0xA6, 0x47, 0xD9, 0x4C, 0x44, 0x6F, 0x9F, 0xDF, 0xDB, 0x92, 0xEA, 0x96, 0xFC, 0x18, 0xF3, 0x9A,
+    0x22, 0xBE, 0x8A, 0xD7, 0xA9, 0x41, 0x73, 0x93, 0xB1, 0xE7, 0x16, 0x42, 0x50, 0xF1, 0xF6, 0xDB,
+    0x03, 0x35, 0x92, 0x70, 0x0E, 0x1D, 0xDB, 0x21, 0x9F, 0xBF, 0x0C, 0xC8, 0x07, 0xD8, 0x2E, 0xDB,
+    0x21, 0x19, 0x0D, 0x21, 0xBB, 0x77, 0x48, 0x32, 0xEF, 0x48, 0x2A, 0x19, 0xC5, 0xD4, 0x51, 0x22,
+    0x14, 0x4F, 0xA9, 0x8E, 0xF9, 0x9B, 0x74, 0x93, 0x49, 0x1A, 0xD4, 0x7A, 0x53, 0x7E, 0xC3, 0x43,
+    0x8B, 0x9F, 0x28, 0x4C, 0xF6, 0x07, 0x27, 0xD3, 0x51, 0x6A, 0x4D, 0xD2, 0x31, 0x18, 0x6E, 0x6F,
+    0x51, 0x37, 0x08, 0x55, 0x3E, 0xDF, 0x21, 0xB8, 0x36, 0x10, 0x47, 0xAA, 0xD4, 0x20, 0xB9, 0x2D,
+    0x35, 0xF0, 0x1A, 0x8C, 0x2F, 0x80, 0x99, 0x41, 0x8A, 0xC0, 0x3D, 0x9B, 0x6A, 0x2F, 0x5D, 0xB3,
+    0xB2, 0xD5, 0xA3, 0x3E, 0x0B, 0x70, 0x4D, 0xDE, 0x51, 0xEC, 0x91, 0x71, 0x5D, 0xBE, 0x45, 0xF1,
+    0x7D, 0x4F, 0x79, 0x18, 0x7E, 0xA4, 0x1A, 0x8E, 0x6A, 0xD8, 0xCF, 0x49, 0xE3, 0xC7, 0x81, 0x93,
+    0x0E, 0xE9, 0x50, 0x6C, 0x93, 0x31, 0x99, 0xDF, 0x9D, 0xC8, 0x7B, 0x22, 0x4F, 0x61, 0x5D, 0xE2,
+    0x5E, 0x4F, 0xBF, 0x12, 0xA3, 0x52, 0x64, 0x1E, 0x6B, 0xFA, 0xB4, 0x20, 0xFA, 0xDC, 0x2B, 0xD7,
+    0x6F, 0x66, 0xD5, 0x81, 0x3E, 0xA8, 0xE7, 0x4A, 0x9E, 0x21, 0xEE, 0x34, 0x7C, 0x4D, 0x70, 0x65,
+    0x47, 0x2E, 0x09, 0xC1, 0xD7, 0x4C, 0x37, 0x39, 0x82, 0xF4, 0xD3, 0x81, 0x69, 0x40, 0xD6, 0xCB,
+    0x08, 0x85, 0x17, 0x31, 0xE5, 0x85, 0xB8, 0xAC, 0xD7, 0xF4, 0x4A, 0x34, 0xBE, 0xD3, 0x41, 0x9B,
+    0x5C, 0xA6, 0x8A, 0x26, 0xB3, 0x5E, 0xBA, 0xB5, 0xC9, 0xA8, 0x09, 0xAD, 0x76, 0xBE, 0xE8, 0x29,
+    0x1C, 0xF5, 0x87, 0xDB, 0xA2, 0x3C, 0xBF, 0x3B, 0x2B, 0x63, 0x32, 0x4D, 0x2E, 0xFB, 0x00, 0xEF,
+    0x45, 0x3C, 0x47, 0x9F, 0xD1, 0xD8, 0x6B, 0x2A, 0x90, 0xC9, 0x6C, 0xB7, 0x72, 0x0F, 0xB3, 0xBD,
+    0x0F, 0xBC, 0x61, 0x9A, 0x3D, 0xD0, 0x19, 0xE1, 0xD2, 0x5C, 0x1E, 0xF6, 0xAF, 0xDA, 0x63, 0xA6,
+    0x45, 0x78, 0xB0, 0xE3, 0x07, 0x63, 0xBA, 0xA3, 0x3C, 0xB2, 0x92, 0x97, 0xA7, 0x12, 0xA2, 0x1A,
+    0x33, 0x1A, 0xAF, 0xA3, 0x7C, 0x65, 0x45, 0xA4, 0x23, 0x3F, 0x79, 0xC7, 0xEC, 0xD7, 0xC8, 0xCE,
+    0x6F, 0xEC, 0x64, 0xDE, 0x8A, 0xF1, 0x88, 0x1B, 0x2F, 0x1F, 0xE8, 0x12, 0x02, 0x6B, 0x88, 0xCE,
+    0xD1, 0x50, 0x5E, 0x7C, 0x1C, 0x28, 0x72, 0xDB, 0x98, 0x68, 0x0B, 0x68, 0x60, 0x08, 0x06, 0x66,
+    0xAC, 0x38, 0xF0, 0x44, 0x66, 0x8C, 0x40, 0x74, 0x07, 0xFA, 0x28, 0x0E, 0x94, 0xE1, 0xB7, 0x93,
+    0xA6, 0x8E, 0x44, 0xBD, 0x92, 0x48, 0x9D, 0x37, 0x71, 0x1E, 0xFF, 0x0D, 0xAB, 0x65, 0x58, 0xEB,
+    0x50, 0xE1, 0x8B, 0x2F, 0xE2, 0xE0, 0xE3, 0x60, 0x3B, 0xB1, 0xA0, 0x7F, 0x3F, 0x98, 0x4F, 0x1E,
+    0xA9, 0xDC, 0x05, 0x45, 0x11, 0x83, 0xDE, 0xDE, 0x3E, 0xA8, 0xFD, 0x59, 0x7F, 0x2C, 0x3D, 0x35,
+    0x05, 0x77, 0x16, 0xCA, 0xB3, 0x99, 0xA5, 0xD6, 0x0E, 0x18, 0x09, 0x2C, 0x78, 0x99, 0x89, 0x76,
+    0xB5, 0x5F, 0xD0, 0x5B, 0x5D, 0x12, 0x8B, 0xEE, 0xED, 0x56, 0xF6, 0x67, 0x44, 0x92, 0x30, 0x61,
+    0xAE, 0x28, 0x93, 0xD2, 0xBE, 0x92, 0xA7, 0x59, 0x86, 0x5A, 0x2E, 0xB6, 0x65, 0xAC, 0x7E, 0x95,
+    0x30, 0x58, 0x88, 0x4F, 0x9F, 0xDF, 0x68, 0xCA, 0x30, 0x5A, 0x2A, 0x63, 0x43, 0x65, 0xA3, 0x78,
+    0x8B, 0xD7, 0x71, 0x74, 0xAC, 0xEA, 0x58, 0x38, 0x44, 0x0D, 0xA2, 0x51, 0x3E, 0xD9, 0xC3, 0x58,
+    0xB2, 0x3F, 0x19, 0x15, 0x24, 0xC5, 0xF0, 0x59, 0x47, 0x35, 0xD7, 0x6C, 0x27, 0x14, 0xCF, 0x61,
+    0x5C, 0x52, 0xA7, 0xAC, 0x65, 0x1D, 0xED, 0x3B, 0x71, 0xB3, 0x6B, 0xDC, 0xFB, 0x6D, 0xCF, 0x0D,
+    0x03, 0x53, 0xC2, 0x74, 0x6D, 0x39, 0xAF, 0x1C, 0x16, 0xBE, 0xF0, 0x5C, 0xB7, 0x81, 0xAD, 0x4C,
+    0xCF, 0xA4, 0xBB, 0xCA, 0x2D, 0x3E, 0x2D, 0x24, 0xF4, 0xC4, 0x78, 0x99, 0x4E, 0x7E, 0xB8, 0xC0,
+    0xD1, 0xBD, 0xD0, 0xBC, 0x75, 0x08, 0xE6, 0xBE, 0xED, 0x71, 0x5A, 0xF7, 0x98, 0x2E, 0x8E, 0x21,
+    0x27, 0x86, 0x98, 0xDD, 0xB8, 0x43, 0xFD, 0x21, 0xBA, 0x5E, 0x35, 0x2F, 0x93, 0xFA, 0x25, 0x42,
+    0xEC, 0x9D, 0x6A, 0x88, 0x2C, 0x9B, 0xF2, 0x92, 0xE7, 0x0B, 0xE6, 0x74, 0x79, 0x09, 0x49, 0xA2,
+    0xCA, 0x11, 0xA9, 0x8C, 0x0F, 0xD0, 0xCB, 0x6B, 0x57, 0x9D, 0xAF, 0x67, 0x69, 0x88, 0x9C, 0x5B,
+    0x3D, 0x40, 0x41, 0x56, 0x4A, 0xA5, 0xD8, 0x29, 0xB3, 0x88, 0x9D, 0xCE, 0x2F, 0xF4, 0x62, 0x90,
+    0xD3, 0xBD, 0x9C, 0x69, 0x32, 0xDD, 0x9F, 0xBC, 0xBA, 0x94, 0xD9, 0x4F, 0x2F, 0x27, 0xAD, 0x56,
+    0xAB, 0xE3, 0x2E, 0x1D, 0xE5, 0x18, 0x1F, 0x21, 0x55, 0x99, 0x99, 0x9F, 0x87, 0xA5, 0x42, 0x51,
+    0xC8, 0xB7, 0xB6, 0xF9, 0x5F, 0xF2, 0x21, 0xDE, 0x46, 0xEE, 0xB5, 0x0D, 0x5B, 0xB1, 0x94, 0xE2,
+    0x61, 0xE2, 0x7E, 0x59, 0xC2, 0x51, 0x2A, 0x89, 0x47, 0xFA, 0xB4, 0xEF, 0x74, 0x87, 0xCE, 0xD5,
+    0x1E, 0x2B, 0xDF, 0xAF, 0x63, 0x81, 0x47, 0x4D, 0xB8, 0x61, 0xC5, 0x8A, 0x23, 0x7C, 0xA7, 0xE2,
+    0x9B, 0x20, 0xB5, 0xA2, 0xE0, 0x24, 0x50, 0x48, 0x54, 0xF6, 0xA7, 0x97, 0xD8, 0x7F, 0x4D, 0x67,
+    0x2B, 0xDC, 0xE2, 0x73, 0xAE, 0x5F, 0x08, 0xFD, 0x97, 0xCD, 0xA1, 0x09, 0x4A, 0x4B, 0xF5, 0x9F,
+    0x3D, 0x22, 0xAC, 0x2A, 0xBA, 0x40, 0xBF, 0x98, 0x28, 0x95, 0xEE, 0xED, 0x62, 0x83, 0x58, 0x82,
+    0x62, 0x5E, 0xEE, 0xF9, 0x3A, 0x4E, 0xAE, 0xF7, 0x26, 0x5F, 0xD4, 0xF5, 0x2F, 0xC5, 0x55, 0x3D,
+    0x6F, 0xD4, 0x40, 0x14, 0x1C, 0x7B, 0x95, 0x18, 0xE1, 0xC2, 0x29, 0x90, 0x40, 0x8A, 0xA2, 0x6B,
+    0x28, 0x90, 0x40, 0xF8, 0x0F, 0xC0, 0xD9, 0x88, 0x3F, 0x90, 0x22, 0xA9, 0x52, 0xA4, 0xA5, 0xA3,
+    0xA5, 0x20, 0x77, 0x86, 0x86, 0x36, 0x0D, 0x3D, 0x05, 0x05, 0x82, 0x96, 0xF2, 0x2E, 0x76, 0x47,
+    0x7B, 0x42, 0x8A, 0x28, 0xB1, 0x84, 0xA8, 0x71, 0xE1, 0x48, 0x26, 0xF2, 0xDD, 0x32, 0xB3, 0xBE,
+    0x2F, 0x20, 0x8A, 0x84, 0x84, 0xC0, 0xB2, 0x7D, 0xEB, 0xDD, 0x79, 0xEF, 0xCD, 0xCC, 0x5B, 0xFB,
+    0x00, 0x5C, 0xCD, 0x00, 0x53, 0x03, 0x38, 0xE1, 0xD5, 0xE3, 0x43, 0x30, 0xE1, 0xE0, 0x3D, 0x56,
+    0x87, 0x97, 0x4F, 0x01, 0x6B, 0x5B, 0x24, 0xE7, 0x79, 0x16, 0x56, 0xB8, 0x86, 0x56, 0xD0, 0x82,
+    0x2B, 0xCD, 0x62, 0xA0, 0x99, 0x48, 0x59, 0x92, 0x92, 0x37, 0xCB, 0x14, 0xBE, 0x55, 0xAE, 0x19,
+    0x9F, 0x42, 0x37, 0x9F, 0xCD, 0x51, 0x4B, 0x78, 0x92, 0x6D, 0x21, 0xAC, 0x82, 0xAF, 0x07, 0x53,
+    0x0C, 0xAD, 0x4D, 0x7D, 0xAB, 0x80, 0x7D, 0x57, 0xD1, 0x7F, 0x0D, 0xC4, 0xC4, 0x11, 0x16, 0x75,
+    0x3F, 0x41, 0xB6, 0xA4, 0x13, 0xDB, 0x34, 0x20, 0x36, 0x79, 0x39, 0xF2, 0x59, 0x3E, 0xE4, 0x7A,
+    0x9C, 0x02, 0x43, 0x95, 0xCD, 0xBA, 0xD2, 0x39, 0x39, 0xC4, 0x93, 0x2E, 0x45, 0x82, 0x2E, 0xBE,
+    0xBA, 0x8F, 0x3C, 0xB5, 0xB6, 0xF1, 0x58, 0x0A, 0x1B, 0xA9, 0xAB, 0x72, 0xAC, 0x18, 0x0E, 0x63,
+    0x02, 0xC2, 0x4F, 0x13, 0xF8, 0x55, 0x0F, 0x78, 0xB2, 0xAE, 0xFD, 0xDF, 0x4B, 0x7F, 0xC4, 0x48,
+    0xA6, 0x1E, 0xD6, 0x08, 0xBE, 0x54, 0x18, 0x98, 0xD2, 0x4C, 0x4C, 0xF1, 0xD7, 0xA5, 0xEB, 0xD8,
+    0x26, 0x3E, 0xB2, 0xB6, 0x30, 0xF6, 0x5D, 0x83, 0x1C, 0x5E, 0x1A, 0x2D, 0xE8, 0xF5, 0xD6, 0x09,
+    0x3B, 0x87, 0x8C, 0xC4, 0x44, 0x53, 0x51, 0x90, 0xEE, 0xA1, 0x94, 0xE6, 0x9A, 0xFF, 0xC9, 0x05,
+    0x0D, 0x4C, 0xE3, 0x71, 0x09, 0x83, 0xFD, 0x7C, 0x42, 0xAA, 0x35, 0x29, 0x13, 0xB2, 0x29, 0xFC,
+    0x3D, 0x88, 0x0B, 0xBA, 0x96, 0xE2, 0xE9, 0x7C, 0x40, 0xA1, 0x4E, 0x70, 0xD7, 0x77, 0x5B, 0x93,
+    0x64, 0x49, 0x7D, 0x21, 0x23, 0x46, 0x94, 0x38, 0x71, 0xF2, 0x54, 0x5E, 0xD5, 0x55, 0x5C, 0xEA,
+    0x72, 0x4E, 0x55, 0x4E, 0x60, 0x50, 0xD5, 0xFE, 0x94, 0x2A, 0xB2, 0x21, 0xD5, 0x84, 0x64, 0xC4,
+    0xE9, 0x98, 0xF4, 0x07, 0x4C, 0xC6, 0x14, 0x7D, 0x78, 0xB6, 0x40, 0xAC, 0xF2, 0xDE, 0xB1, 0x77,
+    0x8C, 0x28, 0x65, 0xD2, 0x11, 0xE3, 0x0C, 0xA7, 0xD1, 0x13, 0x9B, 0xE9, 0xFF, 0xDC, 0xE9, 0x37,
+    0x71, 0x03, 0x77, 0x99, 0x3B, 0x7A, 0x51, 0x22, 0xE0, 0xAC, 0x84, 0x7A, 0x0D, 0xD6, 0xF7, 0xBA,
+    0x0C, 0x31, 0xDF, 0x0F, 0x0A, 0x39, 0xA2, 0x8E, 0xCB, 0x12, 0xD9, 0xE8, 0x5A, 0xA2, 0xF2, 0x32,
+    0xC5, 0x97, 0x8A, 0x1C, 0x5D, 0xCF, 0x75, 0x0D, 0x41, 0x5F, 0x28, 0xA5, 0x81, 0x8C, 0xC1, 0x1E,
+    0xD9, 0x58, 0x6B, 0x3F, 0xF2, 0x9A, 0x26, 0xBC, 0x15, 0x6E, 0xE3, 0xC8, 0x43, 0x87, 0x76, 0x83,
+    0x01, 0xBA, 0xE4, 0x4E, 0x73, 0xB4, 0xD0, 0x2C, 0x33, 0xFD, 0xFA, 0x52, 0x1C, 0x16, 0x7B, 0x66,
+    0x89, 0xF3, 0x7E, 0xEF, 0xF7, 0x68, 0xD1, 0xEF, 0x6A, 0xD1, 0xEF, 0x1D, 0x07, 0x19, 0x29, 0x7C,
+    0xDB, 0xB6, 0x43, 0xDB, 0x5E, 0x3F, 0xDB, 0x63, 0x01, 0x9E, 0x41, 0xA9, 0x02, 0x44, 0xF3, 0x64,
+    0xDE, 0x5E, 0x2A, 0xB6, 0x09, 0x16, 0xE7, 0x03, 0xDA, 0x82, 0xD0, 0xC2, 0xB8, 0x8E, 0x47, 0x7A,
+    0x6F, 0x81, 0x5A, 0x77, 0x5B, 0x62, 0x96, 0xCA, 0xD5, 0x5B, 0x88, 0xB2, 0x23, 0x78, 0xF5, 0x98,
+    0x02, 0x68, 0x8D, 0x91, 0x3D, 0xE3, 0x95, 0xAD, 0xEC, 0x82, 0x7D, 0xCC, 0xEB, 0x33, 0xAF, 0xCA,
+    0x59, 0x21, 0x6A, 0x4E, 0x5D, 0x3B, 0x57, 0xB8, 0x3E, 0xE9, 0x8C, 0x38, 0xB9, 0x68, 0x72, 0x3C,
+    0x17, 0x7C, 0xE1, 0x24, 0x1F, 0x89, 0x3F, 0x72, 0xAB, 0x5E, 0x8D, 0x9D, 0x3E, 0xCC, 0x87, 0x4C,
+    0x82, 0xF9, 0x4C, 0xC5, 0x7C, 0x3D, 0x0A, 0x4A, 0x16, 0x54, 0xA1, 0x83, 0xCE, 0xD5, 0xEE, 0x93,
+    0xA7, 0x3C, 0x94, 0x2D, 0x43, 0x93, 0xE5, 0x5E, 0x37, 0xF5, 0x96, 0x94, 0x23, 0xE7, 0xE3, 0xEE,
+    0xE5, 0x0D, 0x0D, 0x7E, 0x6D, 0xD4, 0xC6, 0xE1, 0x69, 0x6A, 0x88, 0x45, 0x22, 0xAC, 0xF9, 0xD3,
+    0x86, 0x22, 0x48, 0xC1, 0xCF, 0x90, 0x8C, 0x6E, 0xB1, 0x69, 0xAD, 0xB8, 0x1F, 0x9E, 0xEE, 0x2A,
+    0xBC, 0x51, 0x02, 0x3F, 0x7F, 0xCB, 0xCD, 0x56, 0xDC, 0x3E, 0x7F, 0x25, 0xE6, 0x47, 0xCE, 0x29,
+    0x66, 0x32, 0x0E, 0xAF, 0x8E, 0x85, 0xAC, 0x4A, 0xDE, 0x32, 0x04, 0x1B, 0xB8, 0xC2, 0x3A, 0x4D,
+    0xC4, 0x9B, 0xFD, 0x96, 0x21, 0x78, 0xCE, 0x35, 0xAF, 0x08, 0xB3, 0xB5, 0x17, 0x51, 0x81, 0x7D,
+    0x85, 0xF6, 0x32, 0xE7, 0x0B, 0xD3, 0xF9, 0x95, 0xFB, 0x2B, 0x70, 0x5E, 0x38, 0x7B, 0x96, 0x2B,
+    0x66, 0xB5, 0xD2, 0xEF, 0x56, 0xC6, 0x6E, 0x05, 0xEB, 0x2B, 0x03, 0xAD, 0xC4, 0xE9, 0x40, 0x0A,
+    0x29, 0x2D, 0xA8, 0xB4, 0xD5, 0x6A, 0xCC, 0x60, 0x5A, 0xF4, 0xCE, 0x0E, 0x5A, 0xBE, 0xC5, 0x56,
+    0xF5, 0x6C, 0xED, 0x18, 0xEA, 0xD8, 0x45, 0xC6, 0x97, 0xFC, 0x8E, 0x58, 0x16, 0xA8, 0xB8, 0x71,
+    0x77, 0xF0, 0x66, 0x45, 0x91, 0xED, 0x19, 0x31, 0x47, 0x54, 0x24, 0x5D, 0x05, 0xF1, 0xF1, 0x6A,
+    0xFA, 0x18, 0x93, 0xB7, 0x2B, 0x2C, 0x9A, 0x41, 0x49, 0xDC, 0x98, 0x3E, 0x0A, 0xE7, 0x09, 0x97,
+    0x64, 0x09, 0xBF, 0x13, 0xA6, 0xF2, 0x6D, 0x9A, 0x3C, 0x3B, 0xAF, 0x3C, 0x3B, 0x8B, 0xE9, 0xCE,
+    0xC3, 0x72, 0x5E, 0xF4, 0xDF, 0x1E, 0x3F, 0x00, 0xB5, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE,
+    0x3C, 0x23, 0xCE, 0x12, 0x96, 0xE2, 0x86, 0x16, 0xA6, 0xA1, 0xA2, 0xC0, 0xED, 0x15, 0x39, 0xDB,
+    0xD2, 0xFD, 0x00, 0x68, 0xA0, 0xA1, 0xA1, 0x0C, 0x15, 0x0D, 0x45, 0x8A, 0x3B, 0xEF, 0x44, 0x14,
+    0x14, 0x34, 0xF7, 0x37, 0x48, 0x43, 0x1B, 0x89, 0x3D, 0xCE, 0x11, 0x05, 0x05, 0x45, 0x1C, 0x45,
+    0xF4, 0x16, 0xA2, 0xC7, 0x12, 0x8E, 0x62, 0x2E, 0xDE, 0x9D, 0x7C, 0xEF, 0xCD, 0xAE, 0xEC, 0x4B,
+    0x45, 0x13, 0x4B, 0xEB, 0xDD, 0xF5, 0x37, 0x33, 0xEF, 0x7B, 0xDF, 0xFB, 0xDE, 0x33, 0xF0, 0xC9,
+    0xE3, 0x2B, 0xC0, 0x85, 0x09, 0x48, 0xC3, 0x0E, 0xAB, 0xAB, 0x02, 0x6C, 0x9F, 0xB7, 0x48, 0xA6,
+    0xB4, 0x07, 0xAE, 0xCD, 0x08, 0x14, 0x98, 0x81, 0xBC, 0x15, 0x64, 0x70, 0x7E, 0x8D, 0x54, 0x0B,
+    0xD2, 0x2B, 0x92, 0x75, 0x82, 0x0C, 0x6B, 0x24, 0x15, 0xC4, 0x8C, 0xB2, 0x67, 0x4E, 0x18, 0x6F,
+    0x23, 0x21, 0xAA, 0x3A, 0xEF, 0x51, 0xB5, 0x49, 0xF8, 0xE2, 0xA6, 0x45, 0x11, 0x02, 0xE3, 0x85,
+    0x50, 0x33, 0xFC, 0xE7, 0xC2, 0xC1, 0x3C, 0xFE, 0x89, 0xEB, 0x42, 0x7F, 0x97, 0x9B, 0xAB, 0xB1,
+    0xB5, 0x43, 0x3C, 0x74, 0xE6, 0x0F, 0xE7, 0x1B, 0x24, 0x23, 0x23, 0x0A, 0x3F, 0x3B, 0x90, 0x73,
+    0xC5, 0xF3, 0x19, 0xAE, 0x56, 0x72, 0xB2, 0x2E, 0x91, 0x75, 0x95, 0xAF, 0x90, 0x8D, 0x76, 0x30,
+    0xA1, 0xAE, 0x1E, 0xDD, 0x0E, 0x49, 0xD8, 0x17, 0xC8, 0xC2, 0x79, 0x8F, 0xF7, 0xF4, 0xD8, 0x8F,
+    0xF1, 0x35, 0xCF, 0xC6, 0x05, 0x73, 0xB8, 0x95, 0x68, 0x9B, 0xBD, 0x30, 0xF8, 0x6F, 0xAD, 0x09,
+    0x0F, 0x41, 0x29, 0x09, 0x49, 0x48, 0x64, 0x5D, 0x51, 0xC3, 0x48, 0x3C, 0xA5, 0xA1, 0x51, 0x57,
+    0x88, 0x5D, 0x90, 0x32, 0x22, 0xD7, 0x8A, 0x60, 0x8D, 0x34, 0x82, 0x14, 0x75, 0x23, 0x1A, 0x51,
+    0x9E, 0x74, 0xE0, 0x43, 0x3B, 0x62, 0x0F, 0x3B, 0xC3, 0xBD, 0xFC, 0x6A, 0x86, 0x09, 0x41, 0xE2,
+    0x05, 0x8A, 0x1C, 0x79, 0x9A, 0xFA, 0x04, 0xB8, 0x0F, 0x2E, 0xBB, 0xDD, 0x0B, 0xE0, 0xB9, 0xFF,
+    0xEA, 0x9D, 0x8B, 0x13, 0x2F, 0xAD, 0xCC, 0xAD, 0x50, 0xF9, 0xEE, 0x1E, 0x6F, 0x1F, 0x5A, 0xA6,
+    0x91, 0x3E, 0xEA, 0x05, 0x61, 0x2E, 0x38, 0xE9, 0xD7, 0x62, 0x49, 0x8E, 0xD3, 0x2A, 0x47, 0xC9,
+    0x3E, 0x7A, 0x47, 0xB3, 0x17, 0x1F, 0x2C, 0x48, 0xBE, 0x20, 0xEA, 0xAA, 0x46, 0xFD, 0x56, 0x6F,
+    0xD7, 0xC8, 0xC1, 0x6F, 0xB2, 0xA7, 0x02, 0x15, 0x73, 0x2D, 0x1F, 0xE6, 0x9D, 0x9D, 0x90, 0x0F,
+    0xD8, 0xFC, 0xF9, 0xED, 0x40, 0xC2, 0xC2, 0x63, 0x13, 0x68, 0x3E, 0x7C, 0xB0, 0x54, 0x6D, 0x77,
+    0x60, 0xFD, 0x11, 0xF9, 0x26, 0xDD, 0x7D, 0x9E, 0x99, 0x52, 0xB5, 0x1B, 0x2E, 0x4D, 0x9E, 0x2C,
+    0x7C, 0x93, 0x31, 0xF2, 0x9B, 0x0F, 0xF2, 0x69, 0x38, 0x47, 0x72, 0x5A, 0xE2, 0x4A, 0xE5, 0x63,
+    0x89, 0x1A, 0x59, 0x27, 0xF5, 0x55, 0x75, 0xB9, 0xCE, 0x4A, 0x92, 0x37, 0x75, 0x85, 0x62, 0xB4,
+    0x93, 0xFB, 0x99, 0x25, 0xF9, 0x8B, 0xFF, 0xC7, 0xF2, 0xE0, 0x61, 0xE0, 0x9B, 0x13, 0x46, 0xCB,
+    0x9F, 0x92, 0xB6, 0x19, 0x78, 0x3E, 0x2E, 0x24, 0x4B, 0x67, 0x98, 0x8B, 0xF5, 0x0F, 0xD7, 0x8A,
+    0x69, 0xAB, 0x78, 0xCD, 0x34, 0x0A, 0xA3, 0xFE, 0x52, 0x6B, 0x69, 0x3B, 0x0E, 0xAA, 0x0C, 0xD4,
+    0x60, 0xD2, 0x60, 0x73, 0xEC, 0x2D, 0x15, 0x2D, 0x3A, 0x4C, 0x36, 0x8C, 0x66, 0xD9, 0xA0, 0xF2,
+    0xC7, 0x0D, 0xDA, 0x77, 0x51, 0xB6, 0xE8, 0xB1, 0xCA, 0x23, 0x20, 0x36, 0x5E, 0xD4, 0x2D, 0x9A,
+    0x2C, 0xA9, 0x95, 0x8A, 0xB9, 0x7A, 0x20, 0xA4, 0x19, 0xA0, 0x38, 0x27, 0x76, 0x99, 0x31, 0xC8,
+    0x48, 0xEF, 0x1A, 0x7F, 0x8A, 0xB7, 0x34, 0x53, 0xBD, 0x8E, 0x37, 0xE7, 0x55, 0x35, 0x35, 0x9C,
+    0xCA, 0xA6, 0x37, 0xD1, 0x4D, 0xAC, 0x79, 0x0D, 0x11, 0x0E, 0xE2, 0x39, 0x88, 0x72, 0x10, 0xD3,
+    0x41, 0xA4, 0x83, 0xB8, 0x2E, 0x6A, 0xA7, 0xB6, 0x8B, 0xE2, 0xA9, 0x20, 0xCB, 0xEC, 0x90, 0xA4,
+    0xB7, 0x76, 0x99, 0x2A, 0xCD, 0x1D, 0x64, 0x5E, 0x10, 0xAF, 0x88, 0xAA, 0x91, 0xB5, 0x6B, 0xE4,
+    0xD0, 0x9E, 0xDC, 0xA3, 0x6A, 0x26, 0x2A, 0xE1, 0x2E, 0x6A, 0x91, 0xEE, 0xBE, 0x0C, 0xB4, 0x45,
+    0x08, 0xC7, 0x59, 0x28, 0x92, 0xC1, 0x8A, 0x99, 0x8C, 0x3A, 0x5B, 0x3C, 0x2E, 0xF3, 0x81, 0x01,
+    0xFE, 0x96, 0x87, 0xFB, 0x77, 0x68, 0x9D, 0xCC, 0xCB, 0x2C, 0xE5, 0xD9, 0xE2, 0xD0, 0xFC, 0x18,
+    0x5D, 0xE3, 0x6E, 0xFC, 0x31, 0xEE, 0xFB, 0xF1, 0x57, 0x36, 0xC6, 0xAF, 0x10, 0xBF, 0x5E, 0x28,
+    0xD9, 0xAC, 0x53, 0xA6, 0xA9, 0x4F, 0x3D, 0xDE, 0xBA, 0x2E, 0x75, 0xBA, 0x17, 0x64, 0x54, 0xB4,
+    0x70, 0xBF, 0xF7, 0xD2, 0x3F, 0xD9, 0xF3, 0x09, 0x99, 0xF0, 0x6C, 0x60, 0xFF, 0xA1, 0x6C, 0xB9,
+    0x37, 0xAF, 0x3A, 0x12, 0xED, 0x31, 0x8D, 0xAC, 0xDD, 0x84, 0x8B, 0x33, 0x35, 0x55, 0x95, 0xD7,
+    0x8E, 0x16, 0x75, 0xE7, 0x9D, 0x94, 0x3B, 0x6F, 0x39, 0x32, 0xD8, 0xCB, 0x5D, 0xC9, 0x7E, 0xAD,
+    0xF8, 0xDF, 0xCF, 0x90, 0x67, 0xFD, 0x25, 0x4F, 0xDA, 0x62, 0x12, 0x4D, 0x4A, 0x94, 0xAC, 0x7C,
+    0x45, 0x3B, 0xFC, 0x41, 0xA7, 0x3D, 0xF3, 0xE6, 0xDF, 0x1E, 0xE6, 0x55, 0x8B, 0x6B, 0x26, 0x74,
+    0xD3, 0xA3, 0x10, 0xA7, 0x0F, 0x12, 0x5B, 0x3E, 0x86, 0x39, 0x18, 0x6A, 0xBF, 0xA9, 0xE5, 0x05,
+    0x41, 0x91, 0x94, 0xF0, 0x03, 0xBD, 0xC7, 0xBC, 0x37, 0x5A, 0x85, 0xA6, 0xD2, 0x44, 0xB4, 0x38,
+    0xA7, 0x38, 0xBD, 0x9B, 0x5F, 0xC9, 0x39, 0x4A, 0xA2, 0xAD, 0xE1, 0x0C, 0xFD, 0x7E, 0x60, 0x65,
+    0xF3, 0x6E, 0xC6, 0x2F, 0x9D, 0x65, 0xF7, 0x9D, 0x8D, 0x4C, 0xAD, 0x2D, 0xCE, 0xA4, 0x04, 0xF9,
+    0x67, 0xAC, 0xD0, 0x9C, 0xFD, 0xD6, 0x31, 0x2B, 0xDB, 0x4F, 0x34, 0xED, 0xD3, 0xA1, 0xE4, 0xAE,
+    0x61, 0xCA, 0x7F, 0xE8, 0xB1, 0xBD, 0xB0, 0x2C, 0x46, 0x51, 0xE2, 0x09, 0x85, 0x79, 0x86, 0x4F,
+    0xB7, 0x30, 0xAF, 0x7D, 0xF6, 0x2B, 0x09, 0x74, 0x9C, 0x91, 0x70, 0x2C, 0x54, 0x8B, 0x74, 0x84,
+    0xEB, 0x8E, 0x0C, 0x5D, 0x2F, 0xC6, 0xA1, 0x1B, 0xA6, 0x39, 0x52, 0xCB, 0x71, 0x6F, 0x21, 0xC5,
+    0x51, 0xE6, 0x7E, 0xEC, 0x54, 0x60, 0xEC, 0x8E, 0xF5, 0x1F, 0x28, 0xDB, 0x8E, 0xA6, 0x64, 0x29,
+    0xA2, 0x77, 0x98, 0xFA, 0x56, 0xDE, 0x03, 0x2F, 0xE4, 0xAD, 0xC1, 0xB9, 0x68, 0x64, 0xBE, 0x3B,
+    0x49, 0x79, 0x77, 0x18, 0xA9, 0xD2, 0xE8, 0xD2, 0x45, 0xFA, 0x32, 0x92, 0x3A, 0x46, 0x9B, 0x34,
+    0x5A, 0xF2, 0xD8, 0x32, 0xFF, 0xFF, 0x7A, 0x03, 0xCD, 0x55, 0x31, 0x6F, 0xE4, 0x44, 0x14, 0x7E,
+    0x33, 0x73, 0xBB, 0x96, 0x18, 0x89, 0xA1, 0xC8, 0x4A, 0x70, 0x12, 0x71, 0x83, 0x10, 0x17, 0xE9,
+    0x98, 0x86, 0x22, 0xC5, 0xC6, 0x76, 0x2E, 0x12, 0xB4, 0x29, 0xB2, 0x50, 0xD0, 0x44, 0xE8, 0x0A,
+    0x02, 0xC5, 0x51, 0xA4, 0xD8, 0x62, 0xB3, 0xB6, 0xA0, 0xA0, 0xE5, 0x1F, 0xB0, 0xA7, 0xBB, 0x02,
+    0x6D, 0x8A, 0x5C, 0x71, 0x05, 0xC5, 0x6E, 0xD6, 0xB9, 0x2D, 0x68, 0xDD, 0xD1, 0x3A, 0x08, 0x89,
+    0x00, 0xCD, 0x10, 0xF9, 0x84, 0x75, 0xD8, 0x19, 0xDE, 0x1B, 0xEF, 0xE6, 0x12, 0xEE, 0x28, 0x91,
+    0xB0, 0xE4, 0xCF, 0x1E, 0xCF, 0x9B, 0xF7, 0xBE, 0xF7, 0xBD, 0x37, 0x63, 0x00, 0xB8, 0x05, 0x78,
+    0x29, 0x83, 0x20, 0x6C, 0x82, 0x58, 0x0D, 0x10, 0x42, 0x8E, 0x1F, 0x64, 0x24, 0x23, 0xB8, 0x72,
+    0xF9, 0x09, 0xA8, 0x14, 0x4A, 0xE0, 0x05, 0x3D, 0x43, 0x34, 0x05, 0x95, 0xE1, 0x2B, 0xAB, 0x00,
+    0x26, 0x34, 0xF6, 0x32, 0x2F, 0x07, 0x18, 0xE2, 0x77, 0x10, 0x39, 0x5A, 0x43, 0x28, 0xD0, 0x8D,
+    0x30, 0x43, 0x5C, 0xAC, 0x71, 0x09, 0xF0, 0x3F, 0x0A, 0xF2, 0x83, 0xA6, 0xC0, 0xFE, 0xCC, 0x28,
+    0x6E, 0x45, 0x8E, 0x2D, 0x85, 0x51, 0x39, 0xBD, 0x56, 0x8B, 0x40, 0xB4, 0x8C, 0x5E, 0x8F, 0xDD,
+    0x98, 0x96, 0x7E, 0x4C, 0xE3, 0xB0, 0xA6, 0x99, 0x0B, 0x47, 0xE7, 0x06, 0x44, 0xC0, 0x8D, 0x6E,
+    0xA2, 0xF0, 0xEC, 0x36, 0x5C, 0xBB, 0x64, 0x0A, 0xAC, 0x9C, 0xE2, 0x24, 0x52, 0x52, 0x59, 0x08,
+    0xAC, 0x42, 0xAB, 0x10, 0x74, 0xA4, 0x32, 0x56, 0xB2, 0x12, 0x69, 0x53, 0x02, 0xC8, 0x5F, 0x9E,
+    0x94, 0x00, 0x07, 0x38, 0x10, 0xBF, 0x23, 0x23, 0x8D, 0x03, 0x66, 0x89, 0x4E, 0xB6, 0x60, 0x43,
+    0x64, 0x38, 0xD1, 0x0E, 0x97, 0xA4, 0x02, 0xBC, 0x29, 0x51, 0x98, 0x92, 0x5D, 0xDA, 0xC4, 0x63,
+    0x0F, 0x09, 0xEB, 0x4B, 0xA0, 0x39, 0x38, 0x20, 0x58, 0xBF, 0xC6, 0x4B, 0x59, 0x6B, 0x51, 0x69,
+    0x6B, 0x53, 0x86, 0x40, 0x5E, 0x24, 0xF9, 0xF4, 0x5C, 0x01, 0x28, 0x8C, 0x40, 0x06, 0xC0, 0x09,
+    0x48, 0xD7, 0x06, 0x1A, 0x97, 0x2E, 0xED, 0x19, 0x41, 0x0C, 0x0B, 0x3E, 0x10, 0x92, 0x74, 0x21,
+    0xE9, 0xA5, 0xD3, 0x85, 0x52, 0x0D, 0x75, 0x07, 0xF2, 0xD9, 0x78, 0x9C, 0x50, 0x30, 0x03, 0x08,
+    0xE4, 0x13, 0xD6, 0x16, 0xF6, 0x3A, 0x69, 0x52, 0x53, 0x09, 0x15, 0xFA, 0x39, 0xBF, 0xD8, 0xD6,
+    0xE0, 0x5B, 0x1B, 0xB1, 0xDE, 0xBD, 0xB4, 0xF1, 0x22, 0xF3, 0xE6, 0xF6, 0x4C, 0x93, 0x3F, 0xB1,
+    0xA4, 0x9B, 0x38, 0x12, 0x3B, 0xC7, 0xB0, 0x5A, 0x90, 0xA4, 0x7A, 0x85, 0xD6, 0x26, 0xE8, 0x82,
+    0x08, 0xC0, 0x0A, 0x01, 0xC5, 0x6A, 0xEA, 0xCB, 0x0D, 0xBC, 0x70, 0xA1, 0x79, 0xD5, 0xC8, 0xE2,
+    0x21, 0xBC, 0x2C, 0x15, 0xA7, 0x52, 0xBE, 0x54, 0xE9, 0x9F, 0x52, 0x3D, 0x57, 0xE9, 0xDF, 0xA5,
+    0x8A, 0x96, 0xA0, 0x7F, 0x1B, 0x8F, 0x5D, 0xB0, 0x54, 0x2C, 0xE4, 0x6F, 0x2F, 0x62, 0x51, 0x50,
+    0xFF, 0x5A, 0xBF, 0x3B, 0x2D, 0xE8, 0xEE, 0x7C, 0x58, 0x35, 0x11, 0x89, 0x04, 0x25, 0x13, 0x37,
+    0xC1, 0xE8, 0x13, 0x31, 0x5C, 0x7C, 0x22, 0x12, 0x24, 0xD0, 0xF2, 0x13, 0xE9, 0x10, 0x5B, 0x6A,
+    0xEE, 0xD7, 0xE1, 0x0D, 0xE4, 0x4D, 0x1D, 0x07, 0x93, 0xD8, 0x35, 0x01, 0x11, 0xB7, 0x97, 0x55,
+    0xFC, 0x9F, 0x74, 0x07, 0x8F, 0x78, 0x04, 0x05, 0xEE, 0x1C, 0x1F, 0xBB, 0x5A, 0x58, 0xB4, 0x8E,
+    0xF1, 0x96, 0xD9, 0x7F, 0xD6, 0x1D, 0xAD, 0x6D, 0xF2, 0x49, 0x56, 0x76, 0x21, 0x67, 0xB3, 0xB1,
+    0x64, 0xBA, 0xDC, 0x59, 0x0E, 0xDC, 0x79, 0xA0, 0xA3, 0xCB, 0xAC, 0x08, 0x86, 0x97, 0x30, 0xBD,
+    0x2C, 0xBD, 0x53, 0xC4, 0x09, 0x54, 0x2C, 0xC1, 0x6D, 0x58, 0x07, 0x8D, 0xE3, 0xEC, 0x9A, 0xE3,
+    0x97, 0x79, 0x27, 0x8E, 0x6F, 0x93, 0xA7, 0xD0, 0x6D, 0x7A, 0x5A, 0xF0, 0xA9, 0x97, 0x87, 0x50,
+    0x7A, 0xE9, 0x9B, 0xB0, 0x47, 0xC7, 0x88, 0x4A, 0x35, 0xF4, 0xE9, 0xE0, 0x14, 0x15, 0x84, 0x25,
+    0x7F, 0x5A, 0x84, 0xFC, 0x3C, 0xE7, 0x19, 0x8B, 0xDA, 0xDE, 0x85, 0x98, 0xDB, 0xBF, 0x4E, 0xF3,
+    0x99, 0x79, 0xC4, 0x73, 0xB8, 0x39, 0x1E, 0x59, 0x3B, 0xB7, 0xAE, 0x30, 0xD8, 0xDA, 0xD5, 0xCC,
+    0xDA, 0x93, 0x5E, 0x6F, 0x67, 0x17, 0x0E, 0x93, 0x77, 0xE3, 0xA3, 0x27, 0xB6, 0x68, 0x9F, 0xC1,
+    0xCA, 0xF0, 0x78, 0x80, 0x27, 0xD9, 0x07, 0xD9, 0xC1, 0x54, 0xFE, 0x98, 0xF6, 0x3B, 0xCC, 0xBE,
+    0x7F, 0x0F, 0x36, 0xB8, 0x99, 0x6D, 0x65, 0xAB, 0xF0, 0x1A, 0x51, 0x2C, 0x82, 0x69, 0x5F, 0xED,
+    0xAB, 0xEE, 0xAA, 0xAE, 0xDA, 0x39, 0x3C, 0xBC, 0x09, 0x95, 0x9F, 0x4E, 0x55, 0x7A, 0xA0, 0xD2,
+    0x81, 0x4C, 0xDE, 0x11, 0x09, 0xDC, 0x85, 0xBB, 0x85, 0x7C, 0x62, 0x2A, 0x2C, 0x98, 0xE7, 0x4E,
+    0x64, 0x16, 0x4D, 0x64, 0x5A, 0xAA, 0xCD, 0x42, 0x0B, 0x13, 0xB0, 0xA8, 0xC5, 0x36, 0xCD, 0x81,
+    0x96, 0x73, 0x33, 0x09, 0xD4, 0xD7, 0x19, 0x25, 0x75, 0xAB, 0xFD, 0x4D, 0xE8, 0x19, 0xFF, 0x4B,
+    0x83, 0x66, 0x22, 0xDF, 0x00, 0xB3, 0xDA, 0x6C, 0x4D, 0x77, 0xAA, 0xEF, 0xEE, 0xDE, 0xCF, 0xBD,
+    0xF9, 0xB3, 0x5A, 0xDA, 0x0C, 0xF9, 0xC1, 0x1E, 0xD6, 0x7B, 0xD3, 0x5A, 0x15, 0x75, 0xD7, 0xE1,
+    0x0B, 0x78, 0xEC, 0xA5, 0x01, 0x47, 0x01, 0xA6, 0x9E, 0xD1, 0xC9, 0x0E, 0x4A, 0xAC, 0xD2, 0xA1,
+    0x30, 0x7E, 0x32, 0x11, 0x99, 0x86, 0x6D, 0x08, 0xD4, 0xDC, 0x54, 0xA1, 0x3C, 0x31, 0x83, 0xD6,
+    0x0B, 0x73, 0x6B, 0x58, 0xA8, 0x8A, 0x15, 0xDC, 0xF0, 0x0C, 0xBE, 0x13, 0xA5, 0xC4, 0x1F, 0x44,
+    0x00, 0x8F, 0x49, 0x9B, 0x01, 0xF4, 0xE3, 0x72, 0x56, 0x80, 0x61, 0x06, 0x8F, 0x74, 0x50, 0x91,
+    0x02, 0xBF, 0xD6, 0xF5, 0x6D, 0xE8, 0xE2, 0xF1, 0xD1, 0xE9, 0x7D, 0x64, 0xED, 0x67, 0x87, 0x39,
+    0x6C, 0x80, 0x48, 0xD1, 0x54, 0x26, 0x80, 0xBF, 0x1F, 0x80, 0x11, 0x74, 0xB0, 0x54, 0x35, 0xD6,
+    0xA3, 0xD0, 0x59, 0x40, 0x52, 0xF1, 0xF3, 0xC2, 0xEC, 0xAF, 0x8A, 0xFC, 0x2D, 0xD8, 0x66, 0x86,
+    0x61, 0x41, 0xE2, 0x8B, 0xB8, 0xEE, 0xEC, 0xCC, 0xEA, 0xA3, 0x33, 0x19, 0x91, 0x53, 0xBC, 0xBA,
+    0xE0, 0xC3, 0xD1, 0x59, 0x68, 0x5B, 0x4F, 0xF1, 0xF5, 0x15, 0xD7, 0xD0, 0xB3, 0x0B, 0xF4, 0x14,
+    0xE0, 0x51, 0x3D, 0xC1, 0xFE, 0xA9, 0x58, 0xF9, 0xB9, 0x89, 0xF3, 0x38, 0x6A, 0x45, 0x01, 0xC3,
+    0x9D, 0x10, 0x42, 0x25, 0x72, 0xF5, 0xAB, 0x2E, 0x74, 0xDA, 0xAD, 0xEB, 0xFE, 0x0D, 0xD8, 0x32,
+    0x61, 0x28, 0xCE, 0xE9, 0x67, 0x23, 0xCB, 0xE0, 0x78, 0x5D, 0xF5, 0x55, 0xD7, 0xD7, 0x75, 0x3B,
+    0xF7, 0xF2, 0x89, 0xBA, 0x93, 0x0F, 0x18, 0xFE, 0x88, 0x14, 0xF2, 0x1A, 0xC2, 0x44, 0xFC, 0x62,
+    0xFD, 0x5C, 0x9C, 0x98, 0xAE, 0x4C, 0xBE, 0x97, 0x55, 0x98, 0x42, 0x6B, 0x2B, 0x2F, 0x06, 0x5A,
+    0xCD, 0x4F, 0x8B, 0x41, 0x07, 0x5A, 0xBD, 0xDE, 0xB6, 0xB5, 0x17, 0xFE, 0xF8, 0xF0, 0x27, 0x4C,
+    0x0D, 0x73, 0x9B, 0x63, 0x72, 0x2B, 0xC0, 0x60, 0xFF, 0x55, 0xFE, 0xC3, 0x1D, 0x33, 0xC0, 0x5D,
+    0xC2, 0x6A, 0x9D, 0x8C, 0xE0, 0x13, 0xA3, 0xBE, 0x3A, 0x2D, 0x3D, 0x9B, 0xA8, 0xD2, 0x75, 0xEA,
+    0x5E, 0xD3, 0x75, 0xE2, 0xDC, 0x04, 0xC8, 0x83, 0xA7, 0x23, 0xF8, 0x36, 0xDA, 0x38, 0x3E, 0x9A,
+    0x5B, 0xD3, 0xFE, 0x99, 0x66, 0xB5, 0x65, 0xAE, 0x5A, 0xEF, 0xC1, 0x23, 0x16, 0x71, 0x71, 0xA5,
+    0x21, 0x47, 0xB0, 0x36, 0x7E, 0x60, 0x6D, 0x6C, 0xAF, 0xEC, 0xE7, 0xBF, 0x01, 0xAD, 0x55, 0x3D,
+    0x6C, 0x1C, 0x45, 0x14, 0x7E, 0xB3, 0x93, 0xCB, 0x3A, 0x1E, 0xDF, 0x4D, 0x0A, 0x47, 0x0A, 0x60,
+    0x67, 0x5D, 0x50, 0xD8, 0xC8, 0xF6, 0x5E, 0x71, 0x82, 0x43, 0xD8, 0x77, 0x6B, 0xA7, 0x88, 0x04,
+    0x12, 0x3A, 0x89, 0xB8, 0xA3, 0x88, 0x80, 0x02, 0x22, 0x44, 0xAE, 0x48, 0x91, 0x22, 0xCE, 0x6D,
+    0xE2, 0x22, 0x45, 0x24, 0x70, 0x0D, 0x14, 0x57, 0x24, 0x52, 0xB4, 0x91, 0xE0, 0x40, 0x29, 0x2C,
+    0xE4, 0xF8, 0x16, 0x5B, 0x11, 0xA2, 0xCA, 0x3A, 0x14, 0x91, 0x68, 0x58, 0x62, 0xA2, 0x48, 0x04,
+    0x25, 0xA3, 0xB0, 0x0A, 0x8B, 0xB3, 0xB7, 0xC3, 0x7B, 0x7B, 0x6B, 0x99, 0x10, 0xF1, 0x53, 0xB0,
+    0xD2, 0x8D, 0x66, 0x6F, 0xBE, 0xF7, 0xE6, 0x7B, 0xEF, 0x7D, 0xEF, 0x6D, 0x4B, 0xEB, 0x87, 0x5A,
+    0x6B, 0x1F, 0xF2, 0xA7, 0xAB, 0xF5, 0x16, 0xBE, 0x3B, 0xFD, 0x37, 0xE6, 0x79, 0xDE, 0x05, 0xAD,
+    0x7B, 0x07, 0x16, 0x16, 0x1A, 0xD0, 0x60, 0x4E, 0x37, 0xA8, 0x4A, 0xFD, 0x60, 0x3E, 0xE8, 0x86,
+    0x55, 0x76, 0x91, 0x00, 0x5C, 0xEB, 0xB4, 0xA5, 0xF5, 0xE6, 0xC2, 0xC2, 0xD1, 0x17, 0x10, 0xEB,
+    0x5D, 0xAE, 0xA3, 0xB1, 0x4E, 0xFA, 0x7B, 0x02, 0x4C, 0x82, 0x15, 0x8A, 0x58, 0x24, 0x66, 0x0F,
+    0xCE, 0x80, 0xD1, 0xF7, 0x3A, 0x4C, 0x4B, 0x4C, 0xEE, 0x15, 0xB9, 0x08, 0x71, 0x11, 0x44, 0x40,
+    0xD2, 0xAD, 0x75, 0x3A, 0x5C, 0xFC, 0x1F, 0x10, 0xA7, 0xFF, 0x09, 0x61, 0x67, 0x44, 0xC4, 0x9C,
+    0x9A, 0x12, 0x47, 0x6E, 0xDC, 0x74, 0x0A, 0x00, 0x0D, 0x05, 0x87, 0x2C, 0x30, 0x6E, 0x87, 0x30,
+    0x5B, 0xF7, 0xAE, 0x6C, 0x60, 0x10, 0x18, 0x74, 0x86, 0xC2, 0x10, 0xA5, 0x77, 0x25, 0x08, 0x61,
+    0x66, 0x14, 0xF8, 0x7A, 0x00, 0xA7, 0x30, 0xC6, 0x79, 0xCF, 0x6B, 0x9B, 0xD1, 0x9A, 0x78, 0xF0,
+    0xF8, 0xEE, 0x59, 0x55, 0xF3, 0x2B, 0xA5, 0x81, 0x01, 0xBB, 0x26, 0x63, 0xA1, 0x2C, 0xB5, 0x98,
+    0x8C, 0x8D, 0xC1, 0xFB, 0x46, 0x62, 0xFA, 0xC2, 0x35, 0x7D, 0x1E, 0x1A, 0x8A, 0x87, 0xB6, 0x3F,
+    0xF1, 0xF7, 0xD9, 0x4D, 0x29, 0xBB, 0x13, 0x90, 0xB0, 0x98, 0xA0, 0xDC, 0x87, 0xCB, 0x3C, 0x16,
+    0xA1, 0xE5, 0xD6, 0xE0, 0x2A, 0xB0, 0x86, 0x71, 0x58, 0xCF, 0xDF, 0xD4, 0xA9, 0x52, 0xAD, 0xA8,
+    0x82, 0x39, 0x5F, 0xAB, 0x87, 0xF1, 0xB4, 0xB5, 0x17, 0xC3, 0x08, 0x98, 0xF8, 0xD1, 0xFC, 0xEE,
+    0xD7, 0x87, 0x8F, 0xA2, 0xE4, 0x54, 0x34, 0x0B, 0xA7, 0x30, 0xAF, 0x3C, 0x5C, 0x14, 0x41, 0x77,
+    0x3D, 0x2E, 0x60, 0x39, 0x2C, 0x8C, 0xC0, 0xF6, 0xBC, 0xD5, 0x59, 0xCC, 0xC4, 0x0C, 0xC0, 0x0A,
+    0xFE, 0xA2, 0xFD, 0x18, 0x26, 0x5D, 0x9C, 0x9D, 0x69, 0x1D, 0xEF, 0x14, 0x1D, 0xCB, 0xD5, 0xC6,
+    0x2A, 0x2A, 0x22, 0x52, 0x60, 0x8D, 0xB8, 0x66, 0x1D, 0xDE, 0x54, 0x8B, 0xB6, 0xD8, 0x50, 0x09,
+    0x65, 0x33, 0xA9, 0x27, 0x98, 0xCD, 0x15, 0x88, 0x40, 0x01, 0x73, 0xA0, 0x30, 0x33, 0x6C, 0xEA,
+    0x25, 0x57, 0xA7, 0xD1, 0x94, 0x9D, 0xF2, 0xF3, 0x1F, 0x3B, 0x50, 0xEE, 0xBB, 0x11, 0x0E, 0x98,
+    0x21, 0xB0, 0x98, 0x2A, 0x2C, 0x22, 0x21, 0xF4, 0x27, 0x1B, 0xB7, 0xF4, 0xCD, 0xC0, 0x0A, 0xE0,
+    0xF9, 0xAC, 0x26, 0xD2, 0x07, 0xE6, 0x22, 0x05, 0x36, 0xAF, 0xCF, 0x6D, 0x3E, 0xD6, 0x0A, 0x93,
+    0x45, 0x59, 0xB8, 0xC8, 0x97, 0xF4, 0xAD, 0xCD, 0x3B, 0x3A, 0xEC, 0xEC, 0x0D, 0xF0, 0xDD, 0x81,
+    0xCE, 0x14, 0xD3, 0x3A, 0x40, 0x7E, 0xF2, 0x6C, 0x04, 0xCB, 0xC7, 0xFA, 0xCE, 0x4D, 0x58, 0x13,
+    0x3D, 0xD3, 0x9F, 0x86, 0x88, 0xFB, 0x5D, 0xDF, 0x8E, 0x79, 0xAA, 0x03, 0x3B, 0x36, 0x35, 0xB9,
+    0x00, 0xB9, 0xB3, 0xBE, 0x71, 0x1D, 0x64, 0x03, 0xBE, 0xFC, 0x10, 0x0A, 0x50, 0x02, 0xE8, 0x00,
+    0xEC, 0x03, 0x40, 0x07, 0x63, 0xB4, 0x69, 0x34, 0x01, 0x4A, 0x85, 0x1C, 0xB9, 0x8C, 0x92, 0x90,
+    0x0A, 0xEF, 0x33, 0x73, 0xDB, 0x36, 0x9D, 0x0E, 0x02, 0xAE, 0xC5, 0x1D, 0xAB, 0xBE, 0x07, 0xF8,
+    0xE2, 0x75, 0xC0, 0xC0, 0xDF, 0xFE, 0x76, 0xF7, 0x16, 0x5A, 0x35, 0x71, 0xD0, 0x7D, 0x0E, 0xA8,
+    0xA9, 0xAE, 0xB3, 0x26, 0xEE, 0xC5, 0x11, 0x29, 0x6D, 0xEB, 0x76, 0xD0, 0x99, 0xE2, 0x01, 0xF1,
+    0x3E, 0xA1, 0x2C, 0xBD, 0x71, 0xE7, 0xCC, 0x0A, 0xDC, 0x11, 0x05, 0x23, 0x06, 0xDB, 0x65, 0x21,
+    0x0C, 0x8C, 0xD5, 0x12, 0x19, 0x49, 0x55, 0x8F, 0x47, 0xAB, 0x08, 0x69, 0x9C, 0x69, 0x7D, 0xE4,
+    0xA3, 0x35, 0xB4, 0xC7, 0x20, 0x66, 0x29, 0x5C, 0x13, 0x51, 0x8F, 0x3B, 0x98, 0x05, 0xA8, 0x39,
+    0x75, 0xDE, 0x93, 0xBE, 0x75, 0x61, 0xC5, 0xDA, 0xBA, 0x61, 0x9F, 0xBD, 0xFD, 0x3D, 0x74, 0xAA,
+    0x7B, 0xB8, 0xBF, 0x22, 0xF9, 0xFA, 0x96, 0x5A, 0x1E, 0x5E, 0x4B, 0x4F, 0x03, 0x5B, 0x86, 0x93,
+    0xC6, 0xFD, 0xB0, 0x1B, 0x9B, 0x11, 0xFF, 0x01, 0xDE, 0x22, 0x5D, 0x99, 0x71, 0xF7, 0xC8, 0xBD,
+    0xF4, 0x11, 0xC2, 0xD4, 0x28, 0xFF, 0x45, 0xB8, 0xBF, 0x3D, 0x48, 0xA3, 0xD6, 0x05, 0x24, 0x16,
+    0x9A, 0x8E, 0x9D, 0x68, 0xC5, 0xDD, 0x51, 0x80, 0x77, 0x28, 0x84, 0x89, 0xAC, 0x87, 0x56, 0xEB,
+    0x68, 0x65, 0x2A, 0x89, 0x88, 0x96, 0xCF, 0xF5, 0x76, 0x37, 0xC5, 0x8D, 0xD6, 0xD8, 0x2E, 0xEC,
+    0x38, 0xB6, 0x78, 0xD6, 0xE5, 0x13, 0xAB, 0xB4, 0x26, 0xD4, 0x56, 0xA6, 0xB2, 0x7E, 0x42, 0x1D,
+    0xFB, 0xA6, 0xDE, 0xD6, 0xBB, 0x48, 0xEF, 0x62, 0x26, 0x22, 0xEF, 0x3C, 0x35, 0x3F, 0xFE, 0xA7,
+    0xDD, 0xE3, 0xF8, 0x76, 0x02, 0x37, 0xF7, 0xF0, 0x17, 0xC1, 0x01, 0x94, 0x1D, 0x73, 0x6D, 0xFD,
+    0x3B, 0xC0, 0x8C, 0xDC, 0xD6, 0xFA, 0xD2, 0xE7, 0xF3, 0x0A, 0x9E, 0xC3, 0xEC, 0x8D, 0x93, 0x31,
+    0xD6, 0x02, 0x0A, 0x97, 0xC8, 0xB9, 0x26, 0x44, 0x66, 0xCF, 0x53, 0x07, 0x2C, 0x25, 0xC9, 0x79,
+    0xD2, 0x6F, 0xF8, 0x77, 0x69, 0x7D, 0x36, 0xD3, 0x42, 0xBF, 0x7F, 0x46, 0x4D, 0x9A, 0x35, 0x59,
+    0x43, 0xE1, 0x88, 0xCA, 0xFE, 0xCA, 0x78, 0xC2, 0xC1, 0x5C, 0xD6, 0xC6, 0x43, 0xBE, 0xB4, 0xEE,
+    0x86, 0x41, 0xA5, 0x3C, 0x32, 0x24, 0xF9, 0x7D, 0x77, 0x18, 0xE5, 0xD9, 0xD9, 0xE2, 0x1F, 0x44,
+    0x6D, 0xC3, 0xE7, 0x1E, 0x6B, 0x30, 0x08, 0xE0, 0x60, 0x91, 0x33, 0xBF, 0x53, 0x2D, 0x32, 0x30,
+    0xA2, 0x52, 0xB1, 0x3A, 0x58, 0x19, 0x2C, 0x17, 0x2B, 0x23, 0xD3, 0x57, 0x99, 0x33, 0xC4, 0x4D,
+    0xB6, 0xEE, 0xB7, 0xC3, 0x4A, 0x85, 0xAC, 0x3F, 0x43, 0x6B, 0x23, 0x3A, 0xC9, 0xDD, 0x21, 0x68,
+    0x32, 0x9F, 0xFF, 0xCC, 0x1A, 0xA4, 0xE5, 0x36, 0x54, 0xC4, 0xA7, 0x45, 0x59, 0xE2, 0x4B, 0xB0,
+    0xE9, 0x37, 0x9B, 0x33, 0xF2, 0x2B, 0x6C, 0x30, 0x13, 0x04, 0x4A, 0xA7, 0xB8, 0x6A, 0xBD, 0x3A,
+    0x32, 0x38, 0x5E, 0xAC, 0x0C, 0x95, 0x47, 0x9A, 0x93, 0xB0, 0x7F, 0x20, 0x5E, 0x3C, 0x54, 0x7A,
+    0x6D, 0xB2, 0x64, 0x56, 0x46, 0x06, 0xCB, 0x93, 0xC5, 0x66, 0x75, 0xA8, 0x5D, 0x19, 0x71, 0xF6,
+    0xEF, 0xD9, 0xB7, 0x32, 0x0B, 0x81, 0x09, 0xE3, 0x10, 0x70, 0xD8, 0x83, 0xA4, 0x83, 0xD6, 0xD7,
+    0xFE, 0x38, 0x77, 0xCA, 0x26, 0xBC, 0xCC, 0x1A, 0xC7, 0x86, 0x9A, 0xE3, 0xE5, 0x66, 0x39, 0x78,
+    0xD1, 0x7F, 0xC9, 0x99, 0xC6, 0xE3, 0x7D, 0x7B, 0x8D, 0x6F, 0xE0, 0x15, 0xF4, 0x6F, 0x06, 0xFC,
+    0x4D, 0x7E, 0x78, 0x8E, 0x12, 0xF1, 0x1E, 0x69, 0x8E, 0x34, 0x69, 0xB9, 0x79, 0x06, 0x38, 0xB5,
+    0x51, 0x09, 0x76, 0x1F, 0xEC, 0x75, 0x2C, 0xAD, 0x4E, 0x28, 0xB5, 0xAE, 0x08, 0x72, 0x98, 0xA4,
+    0x69, 0x98, 0xE4, 0x86, 0x46, 0x94, 0xCF, 0x4D, 0xBE, 0x8D, 0xC5, 0xC4, 0x09, 0x47, 0xC5, 0x50,
+    0x70, 0xED, 0xAF, 0x38, 0x16, 0xE5, 0xD3, 0x33, 0xBB, 0x32, 0x53, 0x04, 0x19, 0xE0, 0x60, 0x73,
+    0x25, 0x55, 0x3A, 0x9F, 0x04, 0x2E, 0x9E, 0x26, 0xB6, 0x03, 0xF2, 0x1C, 0x6E, 0xDA, 0xCF, 0xEC,
+    0x52, 0x31, 0x88, 0x06, 0xBA, 0x47, 0x01, 0xE1, 0xFC, 0xB9, 0xB6, 0x33, 0x94, 0x93, 0xFC, 0x1E,
+    0x1A, 0x1E, 0x80, 0x76, 0xB9, 0x7B, 0xCF, 0x73, 0x38, 0xD1, 0x40, 0xDE, 0x90, 0xF1, 0x7E, 0x02,
+    0x67, 0x21, 0xCE, 0xD8, 0xA1, 0x91, 0x19, 0xB4, 0xD0, 0x40, 0x90, 0xE3, 0x6C, 0xC8, 0xE2, 0x35,
+    0x29, 0x69, 0x24, 0xEC, 0x92, 0x3E, 0x76, 0x23, 0x24, 0x64, 0x8D, 0x98, 0xD3, 0x37, 0x21, 0x8B,
+    0xF0, 0xFA, 0x51, 0x1A, 0xF3, 0x31, 0x0D, 0xC6, 0x90, 0xF5, 0x58, 0xD7, 0xB1, 0x1D, 0x23, 0x41,
+    0x9C, 0xF4, 0xD1, 0xA0, 0x87, 0x38, 0x19, 0x20, 0x2E, 0xC1, 0x9B, 0xA5, 0x9F, 0x80, 0x11, 0xE3,
+    0xA6, 0x35, 0x17, 0x1F, 0x38, 0x11, 0xDA, 0x73, 0x1A, 0x71, 0x56, 0x6F, 0xE7, 0xAB, 0x06, 0x83,
+    0x98, 0x23, 0x1E, 0xE5, 0x7E, 0x89, 0x60, 0x56, 0x8C, 0xAB, 0x4F, 0x16, 0xC3, 0xE5, 0x74, 0x19,
+    0x06, 0xE5, 0xFC, 0x5B, 0x31, 0x9E, 0xA6, 0xFA, 0x74, 0x31, 0x9C, 0x3F, 0x17, 0xE3, 0x09, 0xDC,
+    0x7F, 0x78, 0xFE, 0x00, 0x7D, 0x55, 0x3B, 0x8E, 0xD4, 0x40, 0x10, 0x2D, 0xDB, 0x80, 0x03, 0x07,
+    0x1D, 0x11, 0x11, 0x38, 0x22, 0x41, 0x48, 0xBE, 0x00, 0xA2, 0xBD, 0x37, 0x20, 0x60, 0x41, 0x82,
+    0x94, 0x14, 0x71, 0x81, 0x5D, 0x8F, 0x45, 0x4A, 0x00, 0x09, 0xC4, 0x04, 0x1B, 0xA0, 0x21, 0xE0,
+    0x02, 0x3B, 0x33, 0x26, 0x22, 0xC4, 0x37, 0xC0, 0x09, 0x42, 0x22, 0x72, 0x60, 0x84, 0x59, 0xF5,
+    0xB8, 0x79, 0xAF, 0xDA, 0x5E, 0x0D, 0x48, 0xD0, 0x6B, 0xB7, 0xBD, 0xD3, 0xF5, 0x79, 0xF5, 0xEA,
+    0x63, 0x11, 0x5D, 0x37, 0xFC, 0x20, 0x91, 0xF7, 0x93, 0x64, 0xD3, 0x1B, 0x27, 0x45, 0x27, 0x57,
+    0x64, 0x57, 0xE2, 0xF7, 0x3D, 0xEE, 0x64, 0xC4, 0x96, 0xF6, 0xD8, 0xB2, 0x0E, 0x9B, 0x69, 0xB8,
+    0x7D, 0x5F, 0xBF, 0x93, 0xDC, 0x7B, 0xC8, 0xEA, 0x46, 0x59, 0x7B, 0xB9, 0xE9, 0xBF, 0x45, 0x8D,
+    0x2D, 0x57, 0x61, 0xAA, 0xA5, 0xB4, 0x12, 0xFB, 0xD7, 0x4F, 0x45, 0x76, 0x1E, 0x66, 0x73, 0xCF,
+    0x1F, 0xAE, 0xCB, 0xBC, 0x72, 0xDF, 0x89, 0xF1, 0xBE, 0x49, 0xA6, 0x47, 0xA3, 0x78, 0x89, 0xD4,
+    0x4D, 0xE4, 0x66, 0x3B, 0xD1, 0xB8, 0xD8, 0xF2, 0x30, 0x9D, 0x4C, 0x34, 0x4A, 0x68, 0x05, 0x7F,
+    0x5F, 0xD1, 0xFC, 0x6E, 0x01, 0xAA, 0x52, 0x6E, 0x7E, 0x49, 0xC6, 0x88, 0x47, 0xD5, 0xF1, 0xAE,
+    0x4B, 0x3D, 0x42, 0x2C, 0xE8, 0xF4, 0xEA, 0x3D, 0x6A, 0xC2, 0x41, 0xDA, 0xC5, 0x83, 0x6C, 0xC4,
+    0x2E, 0xAF, 0xEE, 0xCF, 0xD7, 0xBC, 0xCE, 0xDA, 0x83, 0xD7, 0xA4, 0x57, 0xA0, 0x27, 0x27, 0xE2,
+    0x1C, 0xAF, 0x27, 0x4F, 0x66, 0xE8, 0x05, 0xA2, 0x16, 0xA9, 0x04, 0xA6, 0x78, 0x39, 0x5E, 0x00,
+    0x0C, 0x55, 0xA8, 0x84, 0x2B, 0xED, 0x24, 0x6B, 0x19, 0x12, 0xAE, 0xBC, 0x26, 0x3F, 0xB8, 0xEC,
+    0x81, 0x9E, 0x53, 0x4B, 0x9B, 0x19, 0xBA, 0x0B, 0x11, 0x47, 0x83, 0xD0, 0x0A, 0x0D, 0xE8, 0x0D,
+    0x2B, 0x34, 0xA3, 0xD4, 0x2C, 0x37, 0xAC, 0x29, 0xDD, 0x56, 0xC2, 0x7D, 0x57, 0xD4, 0xE4, 0xDF,
+    0xA6, 0xD4, 0xCC, 0x6C, 0x0A, 0xE9, 0xB8, 0xB9, 0x6B, 0xC4, 0x82, 0x4A, 0x4B, 0x3A, 0xD4, 0x75,
+    0xCC, 0xE4, 0x93, 0xC3, 0xF9, 0x09, 0xBA, 0x48, 0xB0, 0x64, 0x4D, 0xC0, 0x66, 0x96, 0x67, 0xAD,
+    0xB9, 0x80, 0xCF, 0xF0, 0xB4, 0x6A, 0x9A, 0xCF, 0xC0, 0x4F, 0x25, 0xC9, 0x05, 0xF9, 0x3D, 0xA7,
+    0x85, 0x92, 0xFE, 0x33, 0x8F, 0xD4, 0xCA, 0x08, 0xE4, 0x37, 0x06, 0x86, 0x64, 0x9A, 0xD8, 0x49,
+    0xDC, 0x07, 0x8B, 0x50, 0x42, 0x04, 0x8E, 0xA1, 0x21, 0x0A, 0xC7, 0xF0, 0x2C, 0x95, 0x70, 0x68,
+    0x09, 0x1C, 0x87, 0x96, 0xC0, 0x95, 0xA8, 0xBC, 0xBF, 0x05, 0x6C, 0xDB, 0xB5, 0x6F, 0x2C, 0xB0,
+    0x10, 0xA8, 0xED, 0xF8, 0xEC, 0xE4, 0x72, 0x21, 0x17, 0x79, 0xA9, 0x68, 0x49, 0x14, 0xAC, 0x12,
+    0x15, 0x11, 0x3A, 0xC5, 0xA4, 0xD4, 0xD8, 0xFF, 0xC9, 0xEC, 0x67, 0x19, 0x8F, 0x35, 0xB2, 0x22,
+    0xB1, 0x9A, 0xF4, 0xEB, 0xF1, 0xC3, 0x1F, 0xCF, 0x5C, 0x90, 0x59, 0xD5, 0x8E, 0x32, 0x69, 0x6F,
+    0x95, 0x79, 0x07, 0x88, 0x44, 0x9B, 0xB6, 0x1A, 0xCC, 0x73, 0x95, 0xC9, 0xDA, 0x43, 0x99, 0x74,
+    0xA4, 0xCC, 0xF7, 0x0F, 0x23, 0xFC, 0x81, 0xDF, 0x11, 0x72, 0xE8, 0xB5, 0x57, 0x74, 0x32, 0x81,
+    0x25, 0xDF, 0xED, 0x48, 0xB6, 0xF2, 0xC8, 0x14, 0x2A, 0x91, 0xCC, 0x23, 0xF3, 0xAD, 0x89, 0x34,
+    0x1F, 0xEF, 0x33, 0x4E, 0xC7, 0x8E, 0xEB, 0xA3, 0x7D, 0xB9, 0x6A, 0xE8, 0x18, 0x72, 0xA6, 0x85,
+    0xC2, 0x06, 0x72, 0xA6, 0x61, 0x11, 0xB1, 0xC0, 0x6A, 0x16, 0x1F, 0x5E, 0x8A, 0xA3, 0x11, 0x96,
+    0x58, 0x66, 0xA1, 0xFE, 0x50, 0x07, 0x67, 0x32, 0x17, 0x45, 0xD8, 0xCE, 0xB5, 0x9C, 0xB9, 0xDD,
+    0x91, 0xC3, 0xA5, 0xF5, 0xCC, 0x90, 0x4A, 0xA8, 0xD9, 0x12, 0xB8, 0x6C, 0x0D, 0xE1, 0x82, 0xA9,
+    0x28, 0x58, 0xC2, 0xE8, 0xAC, 0xB4, 0xC3, 0x16, 0x0F, 0xA6, 0xA5, 0xD7, 0x96, 0x7C, 0xB1, 0x2E,
+    0x99, 0x89, 0x14, 0x30, 0x71, 0xC2, 0x39, 0xE0, 0xE8, 0xD6, 0xD2, 0x59, 0x5E, 0x43, 0x5B, 0x5B,
+    0x08, 0x89, 0xD7, 0x72, 0xCF, 0x9B, 0x50, 0x32, 0x60, 0xA6, 0x0A, 0xBD, 0xC1, 0x43, 0x52, 0x10,
+    0xBF, 0xD5, 0xBA, 0x6B, 0x65, 0x99, 0x35, 0x62, 0x4A, 0x9D, 0x10, 0x0A, 0xEE, 0xB6, 0xFC, 0x8D,
+    0x35, 0xEB, 0xE9, 0x61, 0xD5, 0x30, 0x91, 0x93, 0xF6, 0x15, 0x9B, 0x3A, 0xF6, 0x34, 0x98, 0xEF,
+    0xB4, 0xCC, 0x46, 0xF8, 0x30, 0x9F, 0xB4, 0xDB, 0x8B, 0x92, 0x1D, 0xCE, 0x9E, 0xBE, 0x8B, 0x73,
+    0x70, 0x98, 0xD7, 0x69, 0x57, 0x40, 0xA1, 0x38, 0x1A, 0x80, 0xCD, 0x99, 0x9A, 0x48, 0xB4, 0xE7,
+    0x5F, 0x34, 0x28, 0xC0, 0xCD, 0x29, 0xA0, 0xC4, 0x3F, 0x3B, 0x52, 0xE2, 0x09, 0xDC, 0x92, 0xCD,
+    0x08, 0xA5, 0x8D, 0x99, 0x30, 0x32, 0x3D, 0xB6, 0x09, 0x19, 0x3B, 0xC3, 0x1F, 0xBC, 0x01, 0x91,
+    0x6C, 0x1F, 0x77, 0xEC, 0x24, 0x36, 0xC8, 0xB5, 0x5F, 0x7F, 0xE0, 0x65, 0xE1, 0x39, 0x76, 0x4E,
+    0x01, 0x3F, 0x1C, 0xAA, 0x8E, 0x25, 0x87, 0x60, 0xC1, 0x47, 0x35, 0x0F, 0x8B, 0x6D, 0x98, 0x4E,
+    0xE8, 0x15, 0xF2, 0x61, 0x6A, 0xD6, 0x84, 0x92, 0x9C, 0x7D, 0xA4, 0xC5, 0x53, 0xAD, 0x91, 0x6F,
+    0xE4, 0x87, 0x6D, 0x80, 0x48, 0x49, 0x4F, 0xAE, 0x19, 0xD6, 0xBC, 0x5A, 0x0E, 0xDE, 0x8C, 0x90,
+    0x62, 0xFE, 0xFF, 0x80, 0xE7, 0x86, 0xF9, 0x11, 0xED, 0x94, 0xA8, 0xBC, 0x64, 0x8E, 0x14, 0x01,
+    0x41, 0x25, 0x3A, 0xE0, 0xD8, 0x6F, 0x1B, 0xD6, 0xAB, 0xD1, 0x88, 0x9C, 0xE8, 0xE0, 0x13, 0x9D,
+    0x87, 0x3A, 0x26, 0x2F, 0x15, 0xAC, 0xE8, 0x9C, 0xFC, 0x87, 0x42, 0xD2, 0x73, 0x70, 0x55, 0x4C,
+    0x45, 0x98, 0x9A, 0x8B, 0xC2, 0xC5, 0x7A, 0x3D, 0x62, 0xF8, 0x63, 0x2E, 0xB0, 0xAF, 0x20, 0x93,
+    0x6A, 0x92, 0x4F, 0xE7, 0x39, 0xB3, 0xD4, 0xA5, 0x21, 0x7E, 0xB9, 0x17, 0x08, 0x63, 0xB0, 0xE1,
+    0x53, 0xA4, 0x93, 0xDF, 0xE3, 0x2C, 0xFD, 0x82, 0xCD, 0x7C, 0xE6, 0xF0, 0x7B, 0x89, 0xCD, 0x52,
+    0xB5, 0xE2, 0xE6, 0x10, 0x43, 0x3C, 0x68, 0x23, 0xEA, 0xC0, 0x4D, 0xBA, 0x50, 0x56, 0xF8, 0x44,
+    0xF5, 0xB2, 0xE2, 0x36, 0xAD, 0xDF, 0xF7, 0x20, 0x29, 0x1E, 0xB4, 0xD8, 0x34, 0x02, 0x12, 0x3D,
+    0xF2, 0x1B, 0xE3, 0x94, 0xE7, 0xAD, 0xA2, 0x80, 0x46, 0x97, 0xB0, 0x29, 0xA1, 0xD5, 0x68, 0x29,
+    0x9E, 0x2F, 0xD5, 0xA8, 0x9F, 0x96, 0x5A, 0xE6, 0x76, 0x3D, 0xD6, 0x89, 0x59, 0xB3, 0x95, 0x41,
+    0xD4, 0x63, 0x07, 0x3E, 0xF2, 0x16, 0x72, 0x5B, 0x9D, 0x69, 0x2C, 0x6E, 0x70, 0x91, 0xB5, 0x20,
+    0x9B, 0xED, 0x5A, 0x34, 0x56, 0xB2, 0x21, 0xBD, 0xF8, 0x30, 0x91, 0x06, 0xB0, 0x30, 0x21, 0xA6,
+    0x62, 0x7A, 0xC5, 0xE6, 0x1E, 0x39, 0x30, 0xF9, 0x25, 0x45, 0x55, 0x61, 0x78, 0xF6, 0xEC, 0xEE,
+    0x46, 0xC7, 0x60, 0x05, 0x80, 0xF0, 0x66, 0x68, 0x17, 0x23, 0x6F, 0xBD, 0xEB, 0x84, 0xEC, 0xA5,
+    0x1C, 0x7C, 0x18, 0x2E, 0x24, 0x3E, 0x88, 0xB7, 0xFA, 0x69, 0x01, 0x9D, 0xFB, 0x98, 0x85, 0xC4,
+    0x21, 0x00, 0x87, 0xF1, 0x3E, 0x9A, 0xA0, 0x93, 0x31, 0x1C, 0xAB, 0x1E, 0x0F, 0xD7, 0x6F, 0x9D,
+    0x55, 0xBD, 0xAE, 0xDC, 0x44, 0x14, 0x3E, 0xF6, 0x08, 0x8D, 0x84, 0x8B, 0xE9, 0x69, 0xDC, 0xD3,
+    0xCC, 0x13, 0xB0, 0x33, 0xA9, 0x69, 0x11, 0x6D, 0x1E, 0x81, 0x17, 0x60, 0x77, 0xDD, 0x51, 0xA4,
+    0x49, 0x93, 0x1A, 0x0A, 0x1A, 0xB6, 0xE1, 0x05, 0xD6, 0xD7, 0x46, 0x14, 0x94, 0xB1, 0xC2, 0x0B,
+    0x58, 0x48, 0xB7, 0x81, 0x02, 0x47, 0x58, 0xC2, 0x44, 0xB3, 0x3B, 0x7C, 0xDF, 0x99, 0xBD, 0xC9,
+    0x55, 0x14, 0x51, 0xE0, 0xBD, 0xBB, 0xBE, 0x3E, 0x73, 0x7E, 0xBE, 0xF3, 0x9D, 0x1F, 0x8B, 0xCF,
+    0xB9, 0x73, 0x39, 0xCF, 0x36, 0xE7, 0xB5, 0x5E, 0x45, 0xE4, 0x8C, 0x6F, 0xC0, 0xD7, 0x8D, 0x22,
+    0x76, 0x16, 0x51, 0x61, 0x7A, 0x10, 0x76, 0x1F, 0x10, 0xB6, 0x14, 0x4E, 0x1F, 0x10, 0x36, 0x10,
+    0x9A, 0x45, 0xF4, 0x3A, 0x22, 0x06, 0x24, 0x39, 0x5F, 0xF0, 0x90, 0x73, 0x9E, 0xD4, 0x59, 0x52,
+    0x2B, 0x86, 0x0A, 0x52, 0x6D, 0xAA, 0xED, 0xA3, 0xC8, 0x41, 0xCD, 0x60, 0x1E, 0xD4, 0x23, 0x1F,
+    0xA0, 0x7C, 0x10, 0xA9, 0x56, 0x75, 0xEA, 0x35, 0x0E, 0xC4, 0xB4, 0x84, 0x78, 0x53, 0xB8, 0x08,
+    0x09, 0x1F, 0x44, 0x11, 0xF4, 0xAF, 0x99, 0xA9, 0x52, 0x25, 0x55, 0x09, 0x91, 0x96, 0x3F, 0xBE,
+    0x39, 0x9D, 0xF2, 0x77, 0x6D, 0xE6, 0x55, 0xEB, 0xEF, 0xC2, 0x10, 0xB2, 0x53, 0x98, 0x76, 0xDA,
+    0xF1, 0xA1, 0x67, 0x32, 0x70, 0x48, 0x26, 0x24, 0x55, 0xC0, 0x23, 0x1F, 0x21, 0x66, 0xCE, 0xA3,
+    0xC9, 0x39, 0x31, 0x93, 0x8E, 0x20, 0x94, 0x29, 0x02, 0xD0, 0x9C, 0x99, 0xAF, 0x12, 0x40, 0x7F,
+    0xE6, 0xCD, 0xE9, 0x7B, 0x09, 0x39, 0x0B, 0x58, 0x5D, 0xA4, 0x7F, 0x5F, 0xAF, 0xA2, 0x9E, 0x97,
+    0x1B, 0x39, 0x34, 0xB0, 0x34, 0x18, 0x4A, 0x29, 0x70, 0x68, 0x26, 0x1E, 0x5F, 0x78, 0x1E, 0xC4,
+    0x6C, 0x34, 0x08, 0x4C, 0x07, 0x1E, 0x0E, 0xE2, 0x47, 0x86, 0xEE, 0xE5, 0x48, 0xDC, 0xC0, 0x97,
+    0xD4, 0x59, 0x32, 0xAB, 0x7A, 0xDF, 0x9C, 0x82, 0xFF, 0x69, 0x0B, 0x1D, 0xFD, 0xBE, 0x5A, 0xEF,
+    0x98, 0x85, 0x02, 0x2F, 0x77, 0xAD, 0x87, 0xBB, 0xDD, 0xC3, 0x37, 0xAF, 0x68, 0x26, 0x43, 0x33,
+    0xF2, 0xBC, 0x4E, 0x4E, 0xEF, 0x76, 0x71, 0xE3, 0x81, 0x6A, 0x53, 0xDB, 0x11, 0x5E, 0x88, 0x3E,
+    0xB2, 0x2E, 0x57, 0x04, 0x42, 0x26, 0x75, 0x02, 0x1C, 0xDC, 0x9B, 0x05, 0x00, 0xD0, 0x0E, 0xED,
+    0x58, 0x2A, 0x76, 0x8C, 0x80, 0xA5, 0x24, 0xF0, 0xFA, 0x0A, 0x35, 0xD6, 0x78, 0xEE, 0x7E, 0x60,
+    0xB0, 0x96, 0xC0, 0x3C, 0x51, 0xD1, 0x35, 0xAB, 0xAD, 0xB5, 0x2C, 0xF9, 0x2F, 0x52, 0x9F, 0x32,
+    0x74, 0xF2, 0x73, 0x80, 0xC9, 0x54, 0x62, 0x9A, 0xCA, 0x96, 0x2A, 0x28, 0x77, 0x4A, 0x57, 0x4B,
+    0xF9, 0x95, 0xC6, 0x8B, 0xBD, 0xFF, 0x32, 0xC7, 0x96, 0x8C, 0xF9, 0x4C, 0xC9, 0x17, 0x52, 0x78,
+    0x05, 0x2E, 0xA8, 0x1F, 0x47, 0x40, 0x33, 0x57, 0x36, 0x54, 0x58, 0x09, 0x0C, 0xF5, 0x5B, 0xA4,
+    0x1D, 0x88, 0x3C, 0x6D, 0x00, 0xE1, 0x7E, 0x99, 0x01, 0xB6, 0xF7, 0xD1, 0x41, 0x93, 0x29, 0xB1,
+    0x0B, 0x92, 0x59, 0xDA, 0xCE, 0xCE, 0x1E, 0x06, 0xFE, 0xC9, 0x5A, 0x43, 0xE0, 0x3A, 0x07, 0x43,
+    0x9E, 0xB7, 0xCF, 0x46, 0xC0, 0xEE, 0xF7, 0xC0, 0x5D, 0xFF, 0x3D, 0x93, 0x83, 0x4C, 0x60, 0x61,
+    0x01, 0x09, 0x55, 0x8E, 0x40, 0xDB, 0x20, 0xAB, 0x5E, 0xC2, 0x58, 0xA0, 0x7E, 0x22, 0x9F, 0x6A,
+    0x9B, 0x40, 0x58, 0xFD, 0xF3, 0x14, 0xB8, 0x6B, 0xAD, 0x42, 0x75, 0x17, 0xE5, 0xF1, 0xD5, 0xDC,
+    0x18, 0x95, 0x76, 0x21, 0x2B, 0xDA, 0x5D, 0xEE, 0x42, 0xDC, 0x03, 0x13, 0xB1, 0x7F, 0x12, 0x77,
+    0xD8, 0xC1, 0xBD, 0x79, 0xBD, 0x11, 0xD7, 0xE7, 0x93, 0x81, 0x26, 0x4B, 0xE0, 0x3A, 0x1A, 0x26,
+    0x84, 0xDF, 0x9A, 0xD1, 0xC7, 0x66, 0xDA, 0x23, 0x5C, 0x30, 0x33, 0x13, 0xE1, 0xB9, 0xFD, 0x6D,
+    0x61, 0xC7, 0x3C, 0x8D, 0x4C, 0x74, 0x83, 0xC0, 0xE4, 0x91, 0xB8, 0x13, 0xF9, 0x3F, 0x4E, 0xC0,
+    0x5D, 0x83, 0x38, 0x30, 0xB0, 0x14, 0x86, 0xBD, 0x94, 0xCA, 0x86, 0x08, 0xEE, 0x02, 0xAD, 0xD0,
+    0x46, 0x67, 0x56, 0x2D, 0xB0, 0x20, 0x6E, 0x04, 0xFB, 0x76, 0xC6, 0x4F, 0xBD, 0xB2, 0xCF, 0x12,
+    0x7F, 0x82, 0xCE, 0x32, 0xA7, 0xDB, 0x66, 0x9D, 0x67, 0x8C, 0x1A, 0x21, 0xD1, 0x55, 0x62, 0x09,
+    0x61, 0xDD, 0x00, 0xB1, 0xD4, 0x3A, 0x0A, 0x89, 0x15, 0x0C, 0x24, 0xA8, 0xE5, 0x48, 0x33, 0x57,
+    0xE6, 0xA7, 0x6D, 0xC3, 0x91, 0x8C, 0x0F, 0xEB, 0xE1, 0xA8, 0x3D, 0x5A, 0x46, 0xDD, 0xB1, 0xC3,
+    0xC4, 0xCC, 0x24, 0xE5, 0xB6, 0x30, 0xCA, 0x5A, 0x08, 0x52, 0x62, 0xF0, 0x18, 0x3C, 0xE2, 0xF8,
+    0xB6, 0x15, 0x36, 0x3D, 0xDE, 0x6B, 0x9F, 0x79, 0xFE, 0x43, 0x29, 0x8E, 0x81, 0x8B, 0x1D, 0xBC,
+    0xEA, 0xB1, 0xD2, 0x40, 0xD3, 0xFE, 0xB6, 0x33, 0x3E, 0x1E, 0xBA, 0x1B, 0x49, 0x38, 0xCE, 0x5D,
+    0xE9, 0xD2, 0x72, 0x79, 0x40, 0x42, 0x79, 0xD9, 0x9B, 0xC7, 0xD9, 0x5E, 0x39, 0x4B, 0x9D, 0x67,
+    0xEC, 0x8B, 0xDC, 0xC1, 0xD5, 0x75, 0x31, 0x7F, 0x60, 0x22, 0x5E, 0x8E, 0xEE, 0x5B, 0x8C, 0xE5,
+    0x4E, 0xF6, 0x5F, 0x4B, 0xFD, 0x1A, 0xFD, 0x03, 0xB0, 0xCF, 0x26, 0xF7, 0xF3, 0x24, 0xE7, 0x20,
+    0xC1, 0x75, 0x66, 0x4A, 0xB2, 0xED, 0x24, 0xD8, 0xD9, 0x4E, 0xE7, 0x6A, 0x6D, 0xA3, 0xAF, 0x17,
+    0x6E, 0x9A, 0x64, 0xC7, 0xBD, 0x59, 0xCC, 0xDC, 0x9A, 0x19, 0x24, 0x77, 0x9F, 0xB5, 0x40, 0xB5,
+    0x97, 0x75, 0xAB, 0xE1, 0x02, 0x8E, 0x1D, 0x3F, 0x57, 0xB6, 0xA8, 0x78, 0x94, 0x16, 0xFB, 0x60,
+    0x40, 0x85, 0x9A, 0x09, 0xC3, 0xEF, 0x63, 0xE0, 0xF6, 0x4D, 0x9A, 0xA6, 0x25, 0xCF, 0xC8, 0xE6,
+    0xC0, 0x74, 0x39, 0x5D, 0x89, 0x5B, 0xAA, 0x45, 0x07, 0x33, 0x15, 0xEA, 0x44, 0x70, 0x65, 0x96,
+    0xB2, 0x24, 0x03, 0x97, 0x39, 0x76, 0xD5, 0xE9, 0xC2, 0x65, 0x95, 0x47, 0x6C, 0x2B, 0x54, 0xB0,
+    0xA7, 0xED, 0xFB, 0x06, 0x95, 0x1A, 0x28, 0xBD, 0x8C, 0x70, 0xD0, 0xFD, 0x3A, 0x59, 0x5D, 0x49,
+    0x8F, 0x0C, 0x1E, 0xB8, 0x22, 0x4B, 0x03, 0x57, 0x7D, 0xBE, 0x1F, 0x26, 0xC9, 0xD1, 0x24, 0x19,
+    0xB8, 0x46, 0x8E, 0x1C, 0x75, 0xED, 0x0F, 0x8E, 0x71, 0xE0, 0x4A, 0x73, 0xBF, 0xC2, 0x9F, 0x59,
+    0xD9, 0x7D, 0x17, 0x2E, 0x86, 0xC0, 0x15, 0xE1, 0x5E, 0x02, 0xBB, 0xFD, 0x0B, 0x41, 0xEB, 0x8D,
+    0x2F, 0x8C, 0x44, 0x9B, 0x23, 0xD5, 0xC3, 0x13, 0x72, 0x3E, 0xE2, 0xB9, 0x9D, 0x9A, 0x55, 0xDA,
+    0x59, 0xF2, 0x8B, 0x61, 0xE6, 0x42, 0xD3, 0x96, 0xE9, 0xDE, 0xAE, 0x81, 0x5C, 0xF6, 0x75, 0x59,
+    0xD8, 0x99, 0x64, 0x00, 0xDF, 0x59, 0x9B, 0x5D, 0xAB, 0x9B, 0x98, 0xD0, 0x5B, 0x32, 0x6E, 0x09,
+    0x95, 0xA6, 0xD8, 0x31, 0x21, 0xE6, 0xC6, 0x69, 0x2B, 0xEC, 0x41, 0xE7, 0x9D, 0x41, 0xA5, 0x06,
+    0x3E, 0xDE, 0x0C, 0x7A, 0xDA, 0x16, 0x83, 0xF4, 0xD8, 0x40, 0xFC, 0xF5, 0x39, 0x37, 0xE0, 0x48,
+    0x04, 0x64, 0x8B, 0xC5, 0x70, 0x13, 0x0E, 0x7B, 0x28, 0x36, 0xD8, 0xAD, 0xD2, 0x6B, 0x33, 0xE3,
+    0xDD, 0x97, 0x38, 0xE2, 0x11, 0x33, 0xBE, 0x58, 0x42, 0x1E, 0xB0, 0xCF, 0xDC, 0xEF, 0x3F, 0xFC,
+    0xE7, 0x2B, 0x63, 0x16, 0x79, 0xF7, 0x6A, 0xF9, 0xBF, 0xD7, 0xBF, 0x7D, 0x55, 0x3D, 0xAE, 0xD4,
+    0x48, 0x10, 0xAE, 0xB6, 0x05, 0x2D, 0xE1, 0xC0, 0x1B, 0x90, 0x11, 0xF8, 0x08, 0xBE, 0xC1, 0x6B,
+    0xEF, 0xA6, 0x24, 0x1B, 0xEC, 0x8B, 0x38, 0x04, 0xF9, 0x4A, 0x6F, 0xC6, 0x12, 0x77, 0x20, 0x21,
+    0x80, 0x64, 0x93, 0x21, 0x78, 0x17, 0x18, 0x3F, 0x8F, 0x38, 0x81, 0x25, 0x2E, 0x30, 0x01, 0x44,
+    0x24, 0x1D, 0x58, 0x2B, 0x6B, 0xD4, 0x9E, 0xE6, 0xFB, 0xAA, 0xED, 0x07, 0x23, 0x0D, 0x58, 0x72,
+    0x8F, 0xA7, 0xAB, 0xAB, 0xEA, 0xAB, 0xAF, 0x7E, 0x5A, 0x84, 0x8F, 0xE9, 0x63, 0x23, 0xDB, 0x18,
+    0xDB, 0xE2, 0xFC, 0x36, 0x48, 0xDF, 0xCA, 0x1F, 0xC5, 0x88, 0x6D, 0xD7, 0x88, 0xE4, 0x13, 0x3E,
+    0xAA, 0x03, 0x96, 0x07, 0xBC, 0xB9, 0xC7, 0x52, 0xF2, 0xDF, 0x06, 0x6F, 0x46, 0x59, 0x31, 0x2C,
+    0x27, 0x65, 0xE6, 0x16, 0xF5, 0x8A, 0xE3, 0xAA, 0xE3, 0x5A, 0x2C, 0x5B, 0x2E, 0xFD, 0xD7, 0x57,
+    0x8D, 0xF4, 0x11, 0x67, 0xB6, 0x11, 0x62, 0xF3, 0x37, 0x84, 0x31, 0xC6, 0xF7, 0x78, 0xBF, 0xE1,
+    0x1D, 0xA5, 0x6A, 0x93, 0xAD, 0x9C, 0x16, 0x02, 0x75, 0x69, 0x64, 0xDD, 0xF4, 0xBF, 0xDB, 0x24,
+    0x96, 0xFA, 0xEA, 0x26, 0x60, 0x99, 0x91, 0x88, 0xA1, 0x03, 0xB4, 0xD8, 0xDF, 0x12, 0x7E, 0x39,
+    0x48, 0x27, 0x26, 0x88, 0x3D, 0xD2, 0xA0, 0x23, 0xE0, 0xCC, 0x53, 0x5A, 0x35, 0x54, 0x99, 0x68,
+    0xA4, 0x3C, 0x30, 0x9E, 0x3D, 0x9D, 0xD9, 0xCF, 0x34, 0x7A, 0x73, 0x47, 0x02, 0x22, 0xC3, 0xAA,
+    0x89, 0xD1, 0x9C, 0x65, 0x0D, 0x53, 0x49, 0x92, 0x9E, 0x4B, 0x8D, 0xFF, 0x4F, 0x5E, 0x53, 0xCE,
+    0x58, 0xA5, 0xD4, 0x43, 0xCF, 0xE5, 0xE2, 0x51, 0x8C, 0x62, 0x54, 0x09, 0x40, 0xF0, 0xBC, 0x8E,
+    0x38, 0x97, 0x81, 0x87, 0x49, 0x6C, 0x7C, 0xF7, 0x7F, 0x6C, 0xED, 0x94, 0x8D, 0x76, 0x84, 0xDD,
+    0x4E, 0xB6, 0x00, 0xEE, 0x00, 0x27, 0xE0, 0xCD, 0xC6, 0x0D, 0x41, 0x77, 0x75, 0x03, 0xA2, 0xEB,
+    0x97, 0x03, 0x30, 0x97, 0x9F, 0x3C, 0xC4, 0xB9, 0xEF, 0xC0, 0x4B, 0x36, 0xD5, 0x2D, 0xC4, 0x21,
+    0xF7, 0x10, 0x9F, 0x01, 0x28, 0x98, 0x28, 0xE5, 0xBC, 0x7D, 0x15, 0x01, 0x27, 0x12, 0xD0, 0xD3,
+    0x18, 0xBF, 0xC8, 0x42, 0x72, 0xE2, 0x29, 0x71, 0x0A, 0xD0, 0xBA, 0x96, 0xAD, 0xE4, 0x89, 0x94,
+    0x06, 0x0C, 0x32, 0x9B, 0x81, 0xD4, 0x66, 0x23, 0xD8, 0x82, 0x67, 0xA6, 0x3E, 0x11, 0x43, 0xE7,
+    0xE0, 0x84, 0x2C, 0x4B, 0x64, 0x3C, 0xF0, 0xF4, 0x68, 0xD8, 0xB1, 0x00, 0x32, 0xA5, 0xAA, 0x7A,
+    0xCF, 0xD2, 0x08, 0x37, 0x5A, 0x37, 0xF4, 0xD7, 0x31, 0x21, 0xF6, 0x48, 0x0E, 0x34, 0x17, 0xF8,
+    0x00, 0xC7, 0x70, 0xE7, 0xB4, 0x9E, 0x66, 0x32, 0x4A, 0x6A, 0x6A, 0xE4, 0xF3, 0xC0, 0x53, 0x81,
+    0xA9, 0x2C, 0x5B, 0x24, 0xD7, 0x90, 0x0E, 0x24, 0x35, 0x69, 0x05, 0x22, 0x87, 0xAA, 0x3D, 0x12,
+    0x66, 0x47, 0xD0, 0xC5, 0x90, 0x14, 0x1C, 0x9D, 0x81, 0x88, 0xEB, 0x0A, 0xCA, 0x0E, 0x8C, 0x22,
+    0xD5, 0x97, 0x0A, 0xA7, 0xDD, 0xEE, 0xFC, 0xA1, 0x07, 0x51, 0xE7, 0x12, 0x0B, 0xCB, 0x74, 0x49,
+    0x8F, 0x56, 0x7C, 0x62, 0xAB, 0x64, 0x31, 0x9B, 0x31, 0x31, 0x66, 0x07, 0xB0, 0x85, 0xED, 0x0D,
+    0x0E, 0x14, 0x03, 0x40, 0x07, 0x98, 0x2F, 0x3F, 0x91, 0x35, 0x58, 0xAC, 0xDE, 0x78, 0x10, 0x87,
+    0xC8, 0x9D, 0xF5, 0x70, 0x8A, 0x9D, 0x1B, 0x24, 0xB4, 0x38, 0x56, 0xA7, 0xFB, 0x19, 0xAD, 0x00,
+    0x7A, 0xFA, 0x53, 0x58, 0xEA, 0x59, 0xFB, 0xC6, 0xAD, 0xB5, 0xC1, 0x0F, 0x7B, 0x5C, 0xBC, 0xAB,
+    0xF3, 0xA0, 0x84, 0xA0, 0x02, 0x59, 0xC4, 0xA8, 0x55, 0x7B, 0x84, 0x1C, 0x92, 0x9A, 0x05, 0xEB,
+    0x28, 0xDF, 0x33, 0xDA, 0xDC, 0x43, 0x1F, 0x4C, 0x95, 0x2D, 0x64, 0x8E, 0x41, 0x6E, 0x28, 0xCB,
+    0x46, 0xD8, 0xCF, 0xA9, 0x80, 0x6D, 0xB2, 0x4D, 0x59, 0x47, 0x05, 0xAA, 0x40, 0xE1, 0x27, 0x63,
+    0xAA, 0x10, 0x18, 0xE2, 0x6A, 0xAC, 0x6A, 0x55, 0x05, 0x0A, 0x77, 0x94, 0x81, 0x3E, 0xFA, 0x4F,
+    0xC6, 0xD4, 0xBB, 0xFA, 0x37, 0x93, 0x39, 0xEF, 0x3E, 0x9E, 0x76, 0xF7, 0x43, 0x11, 0xF5, 0xD1,
+    0xFE, 0x8E, 0xF1, 0x12, 0xF9, 0x78, 0x05, 0x79, 0x77, 0x81, 0xFC, 0x70, 0x05, 0xB9, 0xBF, 0x82,
+    0x9C, 0x40, 0x2E, 0x8D, 0xAD, 0xC8, 0xA7, 0x5F, 0x21, 0xCF, 0xBC, 0xFA, 0xBF, 0x44, 0xBE, 0xFF,
+    0x81, 0xFC, 0xF4, 0x32, 0x21, 0x9F, 0x13, 0x72, 0x2D, 0xEB, 0xC7, 0xEC, 0xAF, 0x7D, 0xB2, 0xF6,
+    0x6D, 0x1A, 0x7C, 0xA2, 0xD1, 0x49, 0x6A, 0x72, 0x87, 0x94, 0x56, 0xD0, 0x2A, 0xE2, 0xB4, 0xE4,
+    0xCE, 0x2D, 0xEA, 0xCC, 0xAA, 0x79, 0xDC, 0xFC, 0xAF, 0x91, 0x12, 0x0D, 0x6F, 0xE1, 0xC1, 0x4C,
+    0x4F, 0xCF, 0xD8, 0xAC, 0x0E, 0x68, 0xE1, 0x11, 0x27, 0x3B, 0xC0, 0xAB, 0xFF, 0x1A, 0xA1, 0xB4,
+    0xD7, 0x92, 0xC9, 0x27, 0x34, 0x7D, 0xB0, 0xA8, 0x98, 0x8C, 0x54, 0x6A, 0xF7, 0xD2, 0xA1, 0xD5,
+    0xC2, 0x85, 0xE6, 0x46, 0x3D, 0x28, 0x16, 0xD6, 0x00, 0xAB, 0x89, 0x0E, 0x11, 0x68, 0x50, 0x6C,
+    0x2C, 0xAE, 0x54, 0xF0, 0x0C, 0x17, 0x9E, 0xD1, 0x7A, 0x18, 0xF4, 0xEC, 0x17, 0xA4, 0x88, 0x5D,
+    0xF2, 0x62, 0xD2, 0x1C, 0x54, 0x07, 0xA5, 0x65, 0x56, 0x6A, 0x8B, 0xA1, 0x6E, 0xA0, 0x39, 0xE7,
+    0xDE, 0x10, 0x8B, 0x03, 0x5B, 0x26, 0x68, 0xD3, 0xBA, 0xE6, 0x8E, 0xD3, 0xC8, 0xA3, 0x66, 0x4E,
+    0xF7, 0xA4, 0xBB, 0x57, 0x33, 0x8C, 0x67, 0xE9, 0x5A, 0x0D, 0x7A, 0xB3, 0xC4, 0xBA, 0x5F, 0xFA,
+    0x26, 0xA4, 0xF8, 0x89, 0x23, 0x3F, 0xFD, 0x23, 0x84, 0x80, 0xD7, 0xDB, 0x63, 0x31, 0x15, 0x83,
+    0x09, 0x74, 0x8C, 0xF7, 0x01, 0x3E, 0xBB, 0xAA, 0x91, 0x19, 0xC9, 0x09, 0x9C, 0x07, 0x18, 0xCD,
+    0x7E, 0xBB, 0x8B, 0x03, 0x9D, 0xA4, 0xC9, 0x95, 0xA6, 0xE5, 0x17, 0xCE, 0x33, 0x8C, 0xCC, 0xF3,
+    0xDB, 0xC8, 0x7E, 0xAC, 0x18, 0xBE, 0xF5, 0xEB, 0xFC, 0xD1, 0x68, 0x95, 0xEE, 0x75, 0x79, 0xB6,
+    0xFB, 0x38, 0x21, 0x35, 0xB8, 0x66, 0x6A, 0x2E, 0x4B, 0x9B, 0xA9, 0x86, 0x5E, 0x56, 0x9A, 0xE2,
+    0xFA, 0xB0, 0xDE, 0x64, 0x1C, 0xDA, 0x36, 0xC8, 0xBF, 0xB7, 0xBD, 0xD7, 0x6B, 0x11, 0x5C, 0xD1,
+    0xD0, 0xED, 0x4F, 0x33, 0x1C, 0x3D, 0x60, 0xB8, 0xE9, 0xF0, 0x13, 0xB5, 0xAA, 0xFA, 0xAF, 0x3D,
+    0xAF, 0x95, 0x0A, 0x5F, 0x9C, 0x5C, 0x23, 0x6F, 0x85, 0x40, 0x53, 0x64, 0x96, 0xD7, 0x44, 0x30,
+    0x13, 0xE1, 0x91, 0x5B, 0x52, 0xD4, 0xE5, 0x9E, 0xBE, 0x8B, 0xC1, 0xED, 0x66, 0xFD, 0xCB, 0x89,
+    0x80, 0xAB, 0x69, 0x1B, 0x95, 0xB0, 0x62, 0xA0, 0x4E, 0x75, 0x08, 0x9C, 0xBC, 0xD9, 0x94, 0x4C,
+    0xB8, 0x3F, 0x27, 0xFE, 0xCD, 0x7D, 0xC5, 0x99, 0x26, 0x0F, 0x88, 0x74, 0x16, 0xAD, 0x9E, 0x02,
+    0x23, 0x66, 0x64, 0x7E, 0x5A, 0xDC, 0x4B, 0x1B, 0x80, 0xBA, 0x8D, 0xAC, 0x0A, 0xCB, 0x31, 0x06,
+    0x8D, 0x22, 0x4D, 0x33, 0x31, 0xCD, 0xE5, 0x55, 0xF4, 0x1D, 0x8D, 0x55, 0x3D, 0x8F, 0xDD, 0x44,
+    0x14, 0x3D, 0xB6, 0xB5, 0x71, 0x31, 0xC5, 0x50, 0x24, 0x0D, 0x29, 0xE6, 0x27, 0xF8, 0x0F, 0xA0,
+    0x37, 0x43, 0x28, 0x69, 0x68, 0x92, 0x20, 0x51, 0xEC, 0x0F, 0xA0, 0xC8, 0x1F, 0xD8, 0xF7, 0x6C,
+    0x44, 0xB9, 0x05, 0xDB, 0x51, 0x50, 0x50, 0x53, 0x6D, 0x9B, 0xE2, 0xBD, 0xB5, 0x53, 0xA5, 0xA0,
+    0x19, 0x22, 0x41, 0x6D, 0x01, 0x15, 0x4D, 0x1C, 0xC9, 0x4F, 0x78, 0xD1, 0xD8, 0xC3, 0xB9, 0xE3,
+    0xB7, 0x9B, 0x88, 0x0A, 0x3F, 0x59, 0xCF, 0x9E, 0xB9, 0x73, 0x3F, 0xCE, 0x3D, 0xE7, 0x1A, 0xC8,
+    0xAE, 0x63, 0x87, 0x3C, 0xC6, 0x00, 0xC4, 0xC8, 0x47, 0xEB, 0xB3, 0x09, 0xE5, 0x80, 0xCA, 0xE1,
+    0x80, 0x7C, 0x80, 0xE6, 0x12, 0x10, 0x50, 0xA4, 0xC7, 0x1D, 0x30, 0x43, 0x79, 0x94, 0x23, 0x97,
+    0x50, 0x1D, 0xCF, 0x3B, 0xA0, 0x8D, 0x13, 0x50, 0xC4, 0xD8, 0x00, 0x4B, 0x3E, 0x72, 0xB5, 0xE3,
+    0x81, 0x72, 0xE0, 0x01, 0xDA, 0xF2, 0x80, 0x6D, 0x4A, 0x0F, 0x3D, 0x88, 0xBB, 0x20, 0x3E, 0x6A,
+    0xC7, 0xB3, 0xBA, 0x87, 0x69, 0x8A, 0x09, 0x72, 0x20, 0x5D, 0x6D, 0x7F, 0x81, 0x3A, 0x5E, 0x76,
+    0xE6, 0xB8, 0x9D, 0x8A, 0x11, 0xD1, 0xDD, 0x40, 0x0D, 0x62, 0x9D, 0x33, 0x9D, 0x9E, 0x1E, 0x77,
+    0x74, 0xA8, 0x3C, 0xFD, 0x05, 0xC6, 0xD7, 0x1D, 0xBD, 0x4D, 0x7C, 0xB0, 0xB4, 0xD3, 0x63, 0x39,
+    0xE4, 0x11, 0xF6, 0x9B, 0x7F, 0x86, 0x2C, 0x2E, 0x1B, 0xA8, 0xF8, 0x99, 0xC7, 0xD9, 0xC9, 0xAF,
+    0x03, 0xBE, 0x5E, 0x40, 0xD7, 0x3D, 0xEC, 0x72, 0x05, 0xC3, 0x78, 0x85, 0xC4, 0x9C, 0x79, 0x1B,
+    0xA6, 0x2C, 0x69, 0x62, 0x67, 0x66, 0xE8, 0x9F, 0x59, 0xC7, 0x72, 0xAC, 0x3D, 0x4D, 0xDA, 0x7C,
+    0xE6, 0x86, 0x65, 0xE9, 0xB4, 0xE5, 0x03, 0x8B, 0xA0, 0x5D, 0x31, 0x6C, 0x24, 0x8D, 0x9E, 0x69,
+    0xF0, 0x21, 0x70, 0xA5, 0x6A, 0x2A, 0x57, 0x0E, 0xD9, 0x4C, 0x73, 0x15, 0xA3, 0x83, 0x11, 0x10,
+    0xEE, 0x22, 0x73, 0xA9, 0x61, 0xDC, 0x21, 0x5B, 0x9E, 0x07, 0xBA, 0x09, 0xDA, 0x23, 0x30, 0x62,
+    0xA8, 0x5C, 0x3E, 0x59, 0x98, 0xBE, 0x8E, 0x8B, 0xE3, 0x8D, 0x9B, 0xA7, 0x2F, 0xFC, 0x81, 0x80,
+    0x1D, 0x18, 0x60, 0x97, 0xA2, 0x95, 0x43, 0xE5, 0x2B, 0xAF, 0xE9, 0x31, 0x17, 0x6C, 0xCF, 0x5C,
+    0x72, 0x97, 0xB5, 0xB7, 0xA8, 0xE2, 0x8C, 0xCD, 0xB3, 0xB0, 0xD6, 0xC0, 0xF2, 0xA5, 0x37, 0xE5,
+    0x84, 0x8C, 0x91, 0xDA, 0x11, 0xD5, 0x2D, 0x0A, 0xD6, 0x5A, 0x35, 0xD2, 0xB0, 0x54, 0x19, 0x01,
+    0x64, 0x47, 0x0D, 0xD3, 0x08, 0xB0, 0xF1, 0x2A, 0xB9, 0x7A, 0xF0, 0x13, 0x2B, 0x8F, 0xE3, 0xDA,
+    0x32, 0x57, 0x0A, 0x18, 0x35, 0x56, 0xD3, 0xD4, 0x8D, 0x5D, 0x7A, 0x79, 0x10, 0xBF, 0x1D, 0x54,
+    0x0C, 0x41, 0x4D, 0x66, 0x51, 0x03, 0xF8, 0x06, 0xF3, 0xFB, 0xC4, 0xB8, 0xF4, 0x1C, 0x04, 0x10,
+    0x96, 0x62, 0x2E, 0x3D, 0xD4, 0x1B, 0x41, 0x48, 0xBA, 0x21, 0xB5, 0x31, 0xE6, 0x82, 0xF6, 0xD3,
+    0x05, 0x9A, 0x85, 0xA1, 0x15, 0x90, 0xBF, 0x38, 0xA1, 0x51, 0xCD, 0x28, 0xB9, 0x58, 0xFF, 0x36,
+    0x17, 0x63, 0x3E, 0x56, 0x24, 0x45, 0x40, 0xF5, 0xB9, 0xCF, 0x83, 0xCD, 0xDA, 0x8E, 0xFC, 0x93,
+    0xCD, 0xEA, 0x0A, 0xA4, 0x09, 0x32, 0xA6, 0x51, 0xF6, 0x6B, 0x4A, 0x95, 0x7F, 0xEC, 0x2C, 0xAB,
+    0xAE, 0x98, 0x7D, 0xE6, 0xEE, 0xA0, 0x95, 0x3A, 0xD9, 0x88, 0xDA, 0x6B, 0x86, 0x6A, 0x74, 0x74,
+    0x8F, 0x66, 0x6C, 0x11, 0xBF, 0x44, 0x16, 0xF2, 0x41, 0xF5, 0x52, 0xBC, 0x16, 0x1A, 0x42, 0x75,
+    0x36, 0x97, 0x0E, 0x57, 0x98, 0xC4, 0x1B, 0x0E, 0xA5, 0x50, 0x48, 0x6A, 0x8F, 0x52, 0xAB, 0x4E,
+    0x9C, 0x07, 0x36, 0xCF, 0x8F, 0x82, 0x41, 0x3E, 0x9A, 0x26, 0xA4, 0xF2, 0xB7, 0x2B, 0x2F, 0x72,
+    0xA1, 0x60, 0x72, 0x46, 0x3D, 0x7C, 0x54, 0xBB, 0x8D, 0xB0, 0x37, 0x8E, 0x4C, 0xB0, 0x1D, 0xCB,
+    0xE8, 0x54, 0x87, 0xD6, 0xAF, 0x59, 0x3D, 0x4C, 0x69, 0x3D, 0x8E, 0xBE, 0x24, 0xAC, 0x9B, 0x67,
+    0xAC, 0x5C, 0xD2, 0x60, 0x2C, 0x92, 0x9F, 0xDD, 0x78, 0xD4, 0x3A, 0xA1, 0x83, 0xC8, 0x8C, 0x68,
+    0x8A, 0xBA, 0x28, 0x33, 0x18, 0x47, 0xDF, 0x7F, 0x66, 0x0B, 0xD3, 0xE8, 0xEA, 0xE8, 0xA5, 0x3D,
+    0xCC, 0x56, 0x49, 0xE6, 0x02, 0xA5, 0x6E, 0x76, 0xC4, 0x82, 0x6D, 0xAE, 0xDC, 0x3E, 0x25, 0xC1,
+    0x76, 0x07, 0x22, 0x43, 0xA4, 0xB7, 0x6C, 0xD5, 0xBD, 0x9D, 0xE9, 0x36, 0x28, 0x26, 0x22, 0xD6,
+    0x3A, 0x8B, 0x6A, 0x28, 0x26, 0x73, 0x4D, 0xBC, 0xFE, 0xE0, 0xFB, 0xB8, 0x39, 0x35, 0x40, 0x35,
+    0x9A, 0xB2, 0x13, 0xE7, 0xFE, 0x86, 0xCD, 0x13, 0x9E, 0xBE, 0xB8, 0xBA, 0x47, 0x93, 0xF0, 0x60,
+    0x9F, 0x14, 0x4E, 0x8F, 0xE2, 0xC8, 0x38, 0x76, 0x74, 0x54, 0x6B, 0xC0, 0x14, 0x79, 0x27, 0x63,
+    0xC1, 0x33, 0xEF, 0x3B, 0xBB, 0x2C, 0xB0, 0x01, 0x96, 0x19, 0xAA, 0xB1, 0xB8, 0x93, 0x5F, 0x7E,
+    0x92, 0x5F, 0xBF, 0x8A, 0x60, 0x4B, 0x0C, 0x54, 0x47, 0x01, 0x07, 0x32, 0x4C, 0x77, 0xA6, 0xCB,
+    0x26, 0x11, 0x8D, 0x13, 0x97, 0xD6, 0xC1, 0x9E, 0x7B, 0x36, 0x62, 0x12, 0x71, 0x36, 0xCC, 0x2B,
+    0xDC, 0x49, 0x9B, 0xBE, 0x27, 0x96, 0x67, 0x9C, 0xEE, 0xF8, 0x37, 0xC3, 0xAE, 0xD3, 0x84, 0x27,
+    0x68, 0x19, 0x99, 0xAC, 0xF4, 0x4C, 0xFF, 0x75, 0xDD, 0x93, 0x02, 0x34, 0xC8, 0xD2, 0x2C, 0x0A,
+    0x22, 0x05, 0x4B, 0xC8, 0xA8, 0xEA, 0x52, 0x24, 0x9A, 0x0B, 0x2F, 0x65, 0x67, 0x92, 0x9D, 0xAD,
+    0x88, 0xBD, 0x42, 0xF2, 0x9F, 0x50, 0xE0, 0xCE, 0x39, 0x7D, 0xA2, 0x26, 0x7C, 0x8D, 0x49, 0x2B,
+    0xEB, 0xC5, 0x06, 0xB3, 0x9A, 0x8A, 0xCD, 0x8B, 0x8D, 0x96, 0xA9, 0xD8, 0x17, 0x6F, 0xD9, 0xC8,
+    0x31, 0xFB, 0x9B, 0xD3, 0x66, 0x8F, 0x3D, 0x65, 0x66, 0x61, 0x37, 0xD0, 0xDF, 0x35, 0xFA, 0xB2,
+    0xD3, 0xAF, 0x7D, 0xF1, 0xCB, 0x50, 0xBE, 0x21, 0x25, 0x3E, 0x29, 0x06, 0x6E, 0xEB, 0x27, 0x14,
+    0xB0, 0x2D, 0xFA, 0x89, 0xB4, 0x6C, 0x5E, 0x86, 0xD2, 0x97, 0xDE, 0x6C, 0xF3, 0x21, 0x1B, 0xCA,
+    0xC8, 0x90, 0x7B, 0x10, 0x28, 0xF9, 0x35, 0xB2, 0xAD, 0x3B, 0x21, 0xC7, 0x96, 0x3D, 0x4F, 0x83,
+    0x36, 0xF5, 0x57, 0x8A, 0x27, 0xD4, 0xCA, 0xCB, 0x70, 0x5B, 0x47, 0xEF, 0xFC, 0xF4, 0xAB, 0x5E,
+    0x08, 0xDB, 0x98, 0x48, 0x21, 0xC8, 0x98, 0x28, 0x4E, 0xE6, 0x3B, 0xFE, 0x72, 0x61, 0xA3, 0xEA,
+    0xDE, 0x9B, 0x87, 0xA4, 0x1D, 0xB9, 0x72, 0x0E, 0x3D, 0xD2, 0x11, 0xE5, 0xED, 0xF9, 0xC0, 0x81,
+    0x71, 0xC3, 0x5B, 0xBF, 0x0A, 0x49, 0xAE, 0xAB, 0x86, 0xE9, 0x42, 0xBF, 0x26, 0x8C, 0xEF, 0x88,
+    0xE2, 0xB4, 0xA5, 0x3A, 0x08, 0x92, 0x4D, 0x73, 0x6D, 0x26, 0xA9, 0x8C, 0xAF, 0x3A, 0x7E, 0x19,
+    0xFC, 0x3A, 0xD6, 0x1E, 0x9E, 0xF0, 0x29, 0x5F, 0x71, 0x65, 0xDF, 0x46, 0xE8, 0xEB, 0x1F, 0x26,
+    0x44, 0x76, 0x95, 0xE8, 0x85, 0x34, 0xDA, 0xED, 0x3A, 0x01, 0x4C, 0x63, 0x99, 0x15, 0x93, 0xB0,
+    0x29, 0xD9, 0x0F, 0x69, 0x7B, 0x60, 0xAE, 0xD4, 0x12, 0x3E, 0xB0, 0x3B, 0xB9, 0xBD, 0x50, 0x33,
+    0xF2, 0x77, 0xAC, 0x4F, 0xFF, 0xF8, 0x3D, 0x7B, 0xC9, 0x7C, 0xB3, 0x28, 0xF4, 0x19, 0xC5, 0xAC,
+    0x61, 0x9D, 0x33, 0x12, 0x7B, 0x94, 0x37, 0x1D, 0x29, 0x74, 0x23, 0x2E, 0xE4, 0x43, 0xA5, 0xE5,
+    0x1B, 0x50, 0x37, 0x59, 0xA0, 0xB9, 0xF1, 0xEA, 0xED, 0x93, 0x05, 0xD6, 0xB2, 0xEE, 0x20, 0xF3,
+    0xA6, 0x3F, 0x4B, 0x52, 0x23, 0xB9, 0x71, 0x9A, 0xF4, 0xE4, 0xC7, 0x3A, 0xE1, 0x52, 0xE0, 0x34,
+    0x12, 0x4E, 0x0A, 0x88, 0x8D, 0x40, 0x55, 0xFF, 0xFA, 0x52, 0x46, 0x2B, 0xB9, 0x96, 0x85, 0xFB,
+    0x09, 0x2B, 0x2C, 0x12, 0x4C, 0xC5, 0xD5, 0x61, 0x3D, 0xFA, 0x7E, 0x3C, 0x7D, 0x4C, 0x35, 0x4D,
+    0xFF, 0x1D, 0x4F, 0x17, 0x66, 0xE2, 0x64, 0xC0, 0xBE, 0x8E, 0x25, 0xE7, 0xCC, 0xED, 0xB1, 0x3E,
+    0x67, 0x51, 0x6C, 0xE0, 0x1E, 0x29, 0xCF, 0x15, 0x30, 0xE3, 0x53, 0x0D, 0xAC, 0x27, 0x7D, 0x4B,
+    0x5C, 0xAA, 0x8F, 0xFD, 0x5F, 0xA1, 0xCB, 0x45, 0xF8, 0xBB, 0x15, 0xBF, 0x13, 0x8C, 0xFB, 0x15,
+    0xC4, 0x20, 0x20, 0xA4, 0x8F, 0x28, 0x91, 0x24, 0x57, 0x44, 0x31, 0xF9, 0x98, 0xFE, 0x12, 0xAA,
+    0xF8, 0xFF, 0xD7, 0xBF, 0xBD, 0x55, 0x3D, 0x8F, 0xE4, 0x44, 0x10, 0x2D, 0xB7, 0xD9, 0x75, 0xE0,
+    0xA0, 0x93, 0x83, 0x00, 0x82, 0xCE, 0x11, 0xC2, 0x31, 0xC1, 0x6D, 0xB7, 0x48, 0x09, 0xB8, 0xE0,
+    0x56, 0x04, 0x1B, 0x10, 0x13, 0xCD, 0x1F, 0xE0, 0x6C, 0x23, 0x42, 0x92, 0x0B, 0xE0, 0x3F, 0x20,
+    0x08, 0x2E, 0x25, 0xD8, 0x59, 0x1B, 0xF8, 0x03, 0x16, 0x9F, 0xA9, 0x41, 0x4B, 0x74, 0x49, 0x07,
+    0x7D, 0xE0, 0x11, 0x3D, 0xD3, 0xBC, 0xD7, 0x9E, 0x1D, 0xF6, 0x24, 0x62, 0x46, 0x1A, 0xDB, 0x9A,
+    0xAE, 0xA9, 0x7A, 0xEF, 0xD5, 0xAB, 0xB2, 0x58, 0x11, 0x2B, 0x7A, 0x14, 0xD3, 0x2B, 0xCF, 0xFB,
+    0x56, 0xAA, 0x59, 0x8C, 0x2B, 0x3D, 0xEE, 0x6A, 0x11, 0x59, 0x24, 0x32, 0x62, 0x2B, 0x38, 0x44,
+    0xAC, 0xF2, 0x8D, 0x13, 0xB9, 0x46, 0xA0, 0x98, 0xF7, 0x26, 0x91, 0xEA, 0xC7, 0x59, 0x44, 0xFE,
+    0xF4, 0xB8, 0x3C, 0x44, 0xB4, 0x68, 0x44, 0x8B, 0x3A, 0xE0, 0x22, 0x03, 0x2F, 0x8C, 0x66, 0x5A,
+    0x91, 0x1A, 0xD1, 0x52, 0xF9, 0xE3, 0x45, 0x3D, 0x0B, 0x78, 0x4A, 0xFC, 0x4B, 0xC3, 0x0C, 0xFC,
+    0x3C, 0xE6, 0xC5, 0xF2, 0xA2, 0x7B, 0x86, 0xF1, 0x77, 0xC5, 0x30, 0x42, 0x38, 0x9E, 0x18, 0x9C,
+    0xA8, 0xB4, 0x43, 0xBA, 0x94, 0x80, 0x77, 0x77, 0x48, 0xA2, 0x67, 0xAB, 0xBD, 0x9E, 0x4D, 0xBF,
+    0xAF, 0x7C, 0x3D, 0x99, 0x4F, 0xBD, 0xF2, 0xA5, 0x8F, 0xF8, 0x4F, 0x6C, 0xE5, 0x42, 0x6C, 0xE3,
+    0x8C, 0xD3, 0x9F, 0x4D, 0xF5, 0x54, 0xFD, 0x1E, 0x4A, 0x9C, 0xB4, 0x12, 0x8B, 0xA8, 0xC7, 0x0B,
+    0xD9, 0xAB, 0x68, 0xDC, 0x41, 0xEC, 0xF3, 0x5F, 0x0E, 0x52, 0xA6, 0xB4, 0x47, 0xF2, 0xC4, 0x6A,
+    0xED, 0x09, 0x77, 0x4D, 0xDC, 0xA5, 0x3F, 0x21, 0x68, 0x5F, 0x66, 0x24, 0xD7, 0x38, 0x2C, 0x16,
+    0xB1, 0x50, 0xAB, 0x5C, 0xA4, 0x9A, 0x9A, 0x5E, 0xF4, 0xB7, 0x88, 0x34, 0xEF, 0xE3, 0xD8, 0xF2,
+    0x2F, 0x03, 0x49, 0xEF, 0x99, 0x8A, 0x99, 0x3B, 0xA4, 0xAA, 0xFE, 0xE6, 0x19, 0x08, 0x96, 0x81,
+    0xD2, 0xBB, 0x56, 0x14, 0x25, 0x36, 0x63, 0x11, 0x8A, 0xC8, 0x62, 0x68, 0x43, 0x4D, 0xA5, 0x23,
+    0x9E, 0x75, 0xDF, 0x4A, 0x11, 0xA0, 0x5C, 0xE3, 0x58, 0x0B, 0x55, 0x2D, 0x62, 0x2B, 0x70, 0x95,
+    0x27, 0x50, 0x46, 0xDF, 0xC5, 0x35, 0x78, 0x28, 0x17, 0x08, 0x36, 0x38, 0x2B, 0x4D, 0x28, 0x17,
+    0xF3, 0xAC, 0x6F, 0xD2, 0x6F, 0xA9, 0x1F, 0x82, 0x0E, 0xF2, 0x28, 0x63, 0xCE, 0x3C, 0xA8, 0x61,
+    0x49, 0x5D, 0x3F, 0xA2, 0xC6, 0x2D, 0xF2, 0x6C, 0x71, 0x76, 0xCD, 0x34, 0x56, 0x0A, 0x7C, 0xD5,
+    0xD2, 0x4A, 0x15, 0x5A, 0xD1, 0xBE, 0x03, 0x5C, 0xFB, 0xFC, 0xAF, 0xD9, 0xA4, 0x5F, 0x67, 0xB5,
+    0x63, 0xF7, 0x48, 0x3A, 0x37, 0xBE, 0x5F, 0x55, 0xE0, 0xD7, 0x12, 0x2F, 0x52, 0x11, 0x85, 0x71,
+    0x2B, 0x18, 0x57, 0x10, 0x0A, 0x4E, 0x88, 0x1C, 0xC0, 0x3C, 0x74, 0x6C, 0x57, 0xF8, 0x5B, 0x54,
+    0xC7, 0xED, 0xC8, 0x21, 0xC2, 0x14, 0x48, 0x12, 0x33, 0x11, 0xC8, 0xC0, 0x5B, 0x19, 0xA4, 0xE9,
+    0x2D, 0x3D, 0x62, 0xDD, 0x05, 0x60, 0x48, 0x02, 0x25, 0x1B, 0x54, 0x12, 0xFB, 0xC9, 0x8B, 0x68,
+    0x3A, 0x69, 0xD2, 0x94, 0x0E, 0x17, 0xE8, 0xBF, 0xEB, 0xC2, 0x43, 0x01, 0xB9, 0x33, 0xDA, 0xE4,
+    0x7F, 0x05, 0xB1, 0x71, 0x19, 0x44, 0xB3, 0x64, 0x10, 0x59, 0xE1, 0xB3, 0xA3, 0x4F, 0x4E, 0xB7,
+    0xD5, 0xD4, 0xD5, 0x7A, 0x3B, 0x47, 0x37, 0x46, 0x98, 0x0C, 0x96, 0x78, 0x73, 0x80, 0x7A, 0x05,
+    0xDD, 0xD0, 0xDC, 0x45, 0xDB, 0x02, 0x81, 0x29, 0xF5, 0x32, 0xA4, 0x24, 0xF5, 0x4F, 0xD5, 0x92,
+    0xC1, 0x64, 0x84, 0xF7, 0x1E, 0x9A, 0xBE, 0x0E, 0x35, 0x00, 0xD1, 0xA8, 0x03, 0x07, 0xEC, 0xC1,
+    0x9A, 0x07, 0xFE, 0x18, 0x39, 0x5D, 0x36, 0xB7, 0x97, 0xA6, 0x8B, 0xAC, 0x5A, 0xCE, 0x6C, 0x8F,
+    0x71, 0x11, 0x61, 0x5B, 0xD8, 0xBB, 0x07, 0xF5, 0x94, 0x90, 0xAC, 0x75, 0x5D, 0xDF, 0xC2, 0x3C,
+    0x36, 0xFF, 0x31, 0xD2, 0x6B, 0xA5, 0xB7, 0xF0, 0xB2, 0x1E, 0x23, 0xE8, 0xDF, 0x54, 0x73, 0x89,
+    0x3A, 0x8D, 0xC3, 0x80, 0xC1, 0x74, 0x55, 0x9A, 0x89, 0xF1, 0x91, 0xAC, 0x22, 0xE7, 0xFE, 0xA3,
+    0x12, 0x5C, 0x0F, 0xBF, 0xAF, 0x1C, 0xE2, 0x2B, 0x1C, 0x9F, 0xDE, 0x20, 0xFB, 0x8D, 0xEB, 0xBE,
+    0x07, 0x44, 0x6A, 0x4C, 0xE5, 0x81, 0xFE, 0xBB, 0x20, 0x5D, 0x15, 0x80, 0x1C, 0xD9, 0xEA, 0x34,
+    0x1F, 0x33, 0x41, 0x11, 0x3C, 0x77, 0x18, 0xB7, 0xDD, 0x86, 0x49, 0xE7, 0x53, 0x62, 0x10, 0xB8,
+    0xFC, 0xC0, 0x43, 0x8D, 0xB1, 0x81, 0x18, 0x79, 0xEE, 0xC8, 0x86, 0x5C, 0xF0, 0xA8, 0xA7, 0x77,
+    0xCE, 0x0F, 0x92, 0xD2, 0xAC, 0xA8, 0xC2, 0x03, 0xB9, 0xFB, 0xA0, 0xE9, 0xC3, 0x2D, 0x34, 0x50,
+    0xA8, 0x52, 0x7A, 0x75, 0xB8, 0x0A, 0x1C, 0x72, 0xE9, 0x30, 0xFF, 0x54, 0xD0, 0x60, 0x8C, 0xE8,
+    0x03, 0x64, 0xD9, 0x96, 0xBB, 0x0F, 0x47, 0xA4, 0x43, 0x0E, 0xC4, 0x77, 0x58, 0x40, 0xA5, 0x37,
+    0x0E, 0xDB, 0x0D, 0x42, 0xE0, 0xB8, 0x2D, 0x3D, 0x68, 0x59, 0x17, 0x41, 0xD0, 0x8C, 0x2D, 0x57,
+    0x23, 0xFE, 0x55, 0x07, 0x33, 0x43, 0xAB, 0x94, 0xB5, 0xA8, 0x13, 0x67, 0x3A, 0xBB, 0x4E, 0x36,
+    0xD8, 0x41, 0xE4, 0xAD, 0xD2, 0x57, 0x37, 0x88, 0x44, 0x3B, 0x5A, 0xA2, 0x80, 0x04, 0xDC, 0x1D,
+    0x98, 0xEA, 0x1E, 0x3E, 0xB0, 0x7F, 0x6C, 0x1C, 0xDA, 0xC6, 0x35, 0x8A, 0x70, 0xB5, 0x70, 0xD9,
+    0x22, 0x75, 0x11, 0x39, 0xC1, 0x13, 0xE2, 0xF6, 0x2C, 0x33, 0x23, 0x7C, 0xC8, 0x5C, 0xD5, 0xD3,
+    0xE3, 0xA8, 0xC1, 0x28, 0x06, 0x45, 0xDE, 0xC6, 0xF7, 0xAD, 0x13, 0x55, 0x58, 0xAE, 0xA0, 0xDA,
+    0x2F, 0x06, 0xB7, 0x97, 0x6D, 0x3D, 0x17, 0x58, 0x23, 0xF5, 0x0F, 0x41, 0x06, 0x3D, 0x6E, 0xBC,
+    0x4D, 0x89, 0x87, 0xF5, 0xED, 0xAA, 0xD8, 0x93, 0xB5, 0x51, 0x6C, 0x60, 0x1D, 0xCE, 0x27, 0x9D,
+    0x7B, 0x70, 0x7B, 0xEA, 0x01, 0x30, 0xD2, 0xEE, 0x50, 0xA8, 0x5F, 0xE4, 0xFE, 0x07, 0x35, 0xD0,
+    0x9C, 0xB9, 0x48, 0x57, 0xA1, 0x0C, 0x10, 0x0E, 0x45, 0xF4, 0xA8, 0x02, 0x84, 0xF0, 0xB6, 0x18,
+    0x46, 0x54, 0xE1, 0xB1, 0xDC, 0xA0, 0x04, 0x94, 0x63, 0x99, 0xBC, 0x1A, 0xD9, 0xBE, 0x66, 0x7A,
+    0xC3, 0xB1, 0x4E, 0xDE, 0xD1, 0xD4, 0xA8, 0x70, 0xC7, 0xED, 0x49, 0x4A, 0xAF, 0xED, 0x2F, 0xE9,
+    0x15, 0xBA, 0xF8, 0x70, 0x5C, 0x46, 0x1C, 0x80, 0xB6, 0xF8, 0x1C, 0x1C, 0xF0, 0x73, 0x04, 0x78,
+    0x9D, 0xDE, 0x8D, 0x82, 0xDB, 0x68, 0x20, 0x89, 0xCA, 0x63, 0xB9, 0x8E, 0xB4, 0xA6, 0x68, 0x4B,
+    0xF5, 0x5F, 0xCB, 0x90, 0x7E, 0x46, 0x7B, 0x8F, 0x4B, 0x73, 0x5C, 0x69, 0xBF, 0xBC, 0xF5, 0x6A,
+    0x28, 0xFB, 0x75, 0x5C, 0xB9, 0x49, 0xC7, 0x16, 0x16, 0x5F, 0x0A, 0x07, 0x1D, 0x3D, 0x58, 0x43,
+    0x3F, 0xC6, 0x6F, 0xFE, 0x5F, 0x11, 0x36, 0x07, 0x90, 0x40, 0xAF, 0x77, 0x57, 0x7E, 0x8D, 0xE3,
+    0xAB, 0x88, 0xE9, 0x80, 0xAB, 0xC0, 0xB0, 0x36, 0x7B, 0xBC, 0x88, 0x9E, 0x8A, 0x46, 0x25, 0xEC,
+    0x7D, 0xB1, 0x72, 0xEF, 0x3B, 0x19, 0xDA, 0x02, 0x54, 0x21, 0xC2, 0xAB, 0xC7, 0x7C, 0x4D, 0xEA,
+    0x2B, 0x0A, 0xF7, 0xF3, 0x37, 0x4C, 0x06, 0x4E, 0x45, 0x5C, 0x5F, 0x8A, 0xF6, 0xF2, 0x31, 0xAC,
+    0x15, 0xB2, 0xE7, 0x57, 0x45, 0x59, 0xA9, 0x3A, 0xCE, 0x44, 0x33, 0xBD, 0x0E, 0xB5, 0x16, 0xAE,
+    0xBD, 0x55, 0x4B, 0xBE, 0xFF, 0x6E, 0xD1, 0xE5, 0xD9, 0x7E, 0x71, 0x0D, 0x52, 0xD0, 0x22, 0x67,
+    0xE9, 0x00, 0x0E, 0x9A, 0x6A, 0xCC, 0x45, 0xB3, 0x10, 0x42, 0x7E, 0x01, 0x13, 0xAF, 0xE5, 0x1B,
+    0x37, 0xA8, 0x3D, 0xDA, 0xD2, 0x77, 0xC8, 0x72, 0xE6, 0xEE, 0xB5, 0xFA, 0x1F, 0xB5, 0x55, 0x3D,
+    0x8F, 0xE4, 0x44, 0x10, 0x2D, 0xB7, 0xA5, 0x6D, 0xE9, 0x1C, 0x98, 0xE4, 0x20, 0xF4, 0x4F, 0xF0,
+    0x1F, 0x38, 0x8D, 0x9D, 0x13, 0x30, 0x01, 0x1B, 0x11, 0xDC, 0x85, 0x88, 0x88, 0x80, 0xF0, 0xD6,
+    0x36, 0xA4, 0xFC, 0x08, 0x92, 0x0B, 0x60, 0x08, 0x2E, 0x25, 0xD8, 0x19, 0x37, 0x9C, 0x10, 0x01,
+    0x89, 0x13, 0x20, 0x20, 0xC0, 0x68, 0xB9, 0xE4, 0x92, 0x6B, 0x09, 0x0B, 0xBC, 0x87, 0x3D, 0xCD,
+    0x7B, 0xD5, 0xB3, 0xDC, 0x90, 0x22, 0x31, 0x1A, 0xDB, 0xEA, 0xAF, 0xAA, 0x7A, 0xEF, 0x55, 0x55,
+    0xCB, 0x85, 0xC8, 0x22, 0x85, 0x93, 0x49, 0x4E, 0x3F, 0x3B, 0xC8, 0x5E, 0x72, 0x87, 0xD9, 0xBC,
+    0x4B, 0x66, 0x29, 0xEB, 0xD4, 0x4B, 0x25, 0x76, 0x94, 0x2B, 0xC9, 0x06, 0xCE, 0x3A, 0x9D, 0x35,
+    0x9C, 0x15, 0x79, 0xF4, 0x28, 0xBD, 0x19, 0x8B, 0xCF, 0xEA, 0x07, 0x8F, 0xEF, 0xCE, 0x4B, 0x51,
+    0xCB, 0xB5, 0xE0, 0x10, 0x6C, 0x34, 0x62, 0x26, 0x7E, 0xB1, 0x73, 0xA6, 0x89, 0xB2, 0x86, 0x01,
+    0x2C, 0x15, 0x1D, 0xAC, 0x19, 0x7F, 0x5A, 0x12, 0x49, 0x3A, 0x91, 0x56, 0x24, 0xF3, 0x82, 0xF9,
+    0xB3, 0x5F, 0x82, 0xA8, 0x4A, 0xE1, 0x09, 0xEE, 0x83, 0x01, 0x84, 0xC6, 0x43, 0xB0, 0x82, 0xE8,
+    0xE2, 0x72, 0x7D, 0xBE, 0x8C, 0xD3, 0xD9, 0x69, 0xD9, 0x09, 0xE2, 0x3C, 0x5B, 0xCE, 0x46, 0xF9,
+    0x60, 0x11, 0x1B, 0x6A, 0xA9, 0x06, 0xDA, 0x6E, 0xC3, 0x91, 0x9F, 0x3E, 0xAC, 0xFC, 0x1C, 0x77,
+    0xFA, 0x99, 0x79, 0x94, 0x76, 0xF9, 0x49, 0x3D, 0x2D, 0xE0, 0x63, 0xA6, 0x37, 0x68, 0xDE, 0x84,
+    0xD0, 0x81, 0x83, 0x34, 0x04, 0x82, 0x4A, 0x27, 0x4B, 0x8A, 0xE0, 0x75, 0x05, 0x64, 0x65, 0xAD,
+    0x24, 0x43, 0x7B, 0x38, 0x53, 0xA2, 0xF6, 0x62, 0x7D, 0xB2, 0xBC, 0x05, 0xC0, 0xB3, 0x9D, 0x5A,
+    0x2F, 0x49, 0x08, 0x63, 0xEB, 0xE8, 0xB8, 0x56, 0x6C, 0x5B, 0x86, 0x8B, 0x73, 0x8C, 0x18, 0xB0,
+    0x94, 0x5A, 0x89, 0xCC, 0x33, 0x74, 0x70, 0x84, 0xE8, 0x09, 0x11, 0x00, 0x40, 0x82, 0x54, 0x21,
+    0x84, 0x57, 0x02, 0xEF, 0x01, 0x91, 0xB7, 0xBB, 0x2F, 0x5F, 0x3D, 0x9D, 0xD4, 0x5D, 0xE9, 0x16,
+    0x75, 0x88, 0x93, 0xD7, 0x92, 0x7F, 0x3D, 0xEB, 0x00, 0x22, 0x1C, 0xA4, 0xFC, 0x64, 0x82, 0xF3,
+    0xCC, 0x03, 0x7D, 0x19, 0x56, 0xF2, 0xD0, 0x2A, 0x66, 0xB9, 0x4F, 0xFF, 0xB5, 0xFA, 0x8C, 0x7C,
+    0xBE, 0xB9, 0x5E, 0xD2, 0x32, 0x34, 0x25, 0x2B, 0xD4, 0x24, 0x05, 0x9B, 0x72, 0x65, 0x6F, 0x25,
+    0x7B, 0x06, 0xB8, 0xCB, 0xB1, 0x77, 0xF9, 0x8A, 0xED, 0x01, 0xD6, 0x0B, 0x78, 0x35, 0x8C, 0xB6,
+    0x82, 0x9C, 0x2A, 0x74, 0x83, 0x80, 0x81, 0xA4, 0xAC, 0x29, 0xBC, 0x8A, 0x0A, 0xD4, 0x23, 0x55,
+    0x86, 0xFE, 0xD9, 0x80, 0xE8, 0xE3, 0x3E, 0x98, 0xBC, 0x07, 0x58, 0x86, 0xB4, 0x36, 0x4C, 0x95,
+    0xEE, 0xE4, 0xE8, 0xA3, 0x33, 0xD1, 0x91, 0x67, 0x63, 0xE6, 0x0C, 0xA5, 0x68, 0x71, 0xA6, 0x40,
+    0xBE, 0x91, 0x81, 0x9A, 0x99, 0x03, 0x8F, 0xD5, 0xC3, 0x01, 0xA1, 0xCE, 0xE4, 0x91, 0x6A, 0x00,
+    0xC1, 0x02, 0xC0, 0x08, 0x06, 0x31, 0xC0, 0x5B, 0x51, 0xE7, 0x0E, 0x9F, 0x95, 0x39, 0xEB, 0x99,
+    0xBA, 0xB5, 0x24, 0x4F, 0x4E, 0x28, 0x65, 0x43, 0xDC, 0xA0, 0x41, 0x32, 0x38, 0x96, 0x07, 0xAF,
+    0x7D, 0x22, 0x17, 0x33, 0x58, 0x88, 0x61, 0x76, 0x80, 0x43, 0x6A, 0xFF, 0x05, 0xC7, 0xFE, 0x03,
+    0xE7, 0x6E, 0x5F, 0xE1, 0x36, 0x94, 0x76, 0x94, 0xBE, 0xAE, 0xA4, 0xF4, 0xE9, 0x5C, 0x3C, 0x05,
+    0xCD, 0x37, 0x18, 0x4F, 0xF0, 0xB3, 0x55, 0xBB, 0x8F, 0xE5, 0x2B, 0x16, 0xC4, 0x86, 0x22, 0xB6,
+    0x9A, 0x6D, 0x78, 0x5D, 0xDC, 0x9E, 0xE7, 0x38, 0x35, 0x58, 0x48, 0x79, 0xC3, 0x44, 0xA8, 0x58,
+    0x31, 0x5A, 0x1E, 0xF0, 0x5B, 0x74, 0x48, 0xDA, 0x74, 0xA4, 0x70, 0x0B, 0xA6, 0x35, 0x0E, 0x6C,
+    0xDA, 0x33, 0x5E, 0x6A, 0x74, 0x85, 0xEC, 0x96, 0xE2, 0x1D, 0x92, 0xF8, 0x33, 0xE1, 0xFD, 0x49,
+    0x2A, 0x2B, 0xC5, 0x47, 0x86, 0x0D, 0xD5, 0xD5, 0xD4, 0x8A, 0x55, 0xC6, 0xDD, 0x2C, 0xF5, 0xF8,
+    0xBA, 0xD7, 0x23, 0xF5, 0xD2, 0xC0, 0x23, 0x7D, 0xF7, 0x3F, 0x72, 0xF0, 0xA1, 0x9C, 0x25, 0x14,
+    0x45, 0xCF, 0x58, 0x7E, 0x9F, 0xC7, 0x59, 0xA4, 0x69, 0x7A, 0xE3, 0x89, 0x59, 0x1A, 0xF0, 0x03,
+    0xB1, 0xB2, 0x9F, 0x46, 0xAD, 0xD8, 0xE5, 0x10, 0x37, 0x7C, 0xAF, 0x43, 0x33, 0xC5, 0x61, 0x05,
+    0x42, 0xAC, 0xC7, 0x1F, 0x43, 0x50, 0xB9, 0xC7, 0xB0, 0x64, 0x62, 0x1D, 0x80, 0x04, 0xFA, 0x63,
+    0xD8, 0xB3, 0x2F, 0x35, 0x52, 0xB4, 0xB5, 0xF5, 0x48, 0x80, 0xDF, 0x27, 0x2D, 0x48, 0x30, 0x85,
+    0x8A, 0xF5, 0xF9, 0xC7, 0x4C, 0x91, 0xCA, 0xF8, 0x02, 0x29, 0x9B, 0x22, 0x44, 0x16, 0x4D, 0xF9,
+    0xA9, 0x63, 0xD5, 0x24, 0x33, 0xB6, 0xC2, 0x45, 0xFE, 0x52, 0xEC, 0x4B, 0xF0, 0x13, 0x06, 0xA9,
+    0xC0, 0x62, 0xB6, 0xD0, 0x74, 0x8C, 0xC5, 0xBD, 0x16, 0xAD, 0xD1, 0x0E, 0xF7, 0xDD, 0xA0, 0xAD,
+    0x6D, 0xAF, 0xBD, 0xED, 0xED, 0x41, 0x67, 0xF7, 0xAC, 0xE9, 0x0D, 0xA4, 0x64, 0xBF, 0xBC, 0xD6,
+    0x62, 0xC4, 0xC3, 0x1E, 0x81, 0x52, 0x85, 0x96, 0xD9, 0x60, 0x8F, 0x58, 0x6B, 0xE4, 0xAF, 0x11,
+    0x21, 0x8D, 0x55, 0x85, 0x12, 0xAF, 0xEC, 0x37, 0x1E, 0x44, 0xFA, 0xA9, 0x64, 0x3C, 0x4D, 0xF2,
+    0xC7, 0x84, 0x6E, 0xE1, 0x72, 0x94, 0x62, 0x3E, 0x49, 0x0F, 0xB7, 0x07, 0xA2, 0x56, 0xBA, 0x94,
+    0x4B, 0x3C, 0xF7, 0xFB, 0xCB, 0x6D, 0x8B, 0x8A, 0xED, 0xD1, 0x55, 0x64, 0x3D, 0x95, 0xF2, 0xAC,
+    0x9D, 0x43, 0xCC, 0xF1, 0x0B, 0x56, 0xF3, 0x88, 0x07, 0xDA, 0x18, 0xFA, 0x3F, 0x22, 0xA0, 0x26,
+    0x3F, 0x3D, 0x50, 0x71, 0x45, 0x6B, 0x59, 0xD0, 0xA8, 0xA6, 0x6A, 0x17, 0x46, 0x74, 0x96, 0xBA,
+    0x0D, 0xBF, 0x11, 0x17, 0x25, 0xB3, 0x4E, 0xB3, 0xE2, 0x9A, 0x05, 0x26, 0xF9, 0x2F, 0x3F, 0xD2,
+    0x72, 0x18, 0x72, 0xC8, 0x56, 0x78, 0xA6, 0x93, 0x59, 0x55, 0xC3, 0x4A, 0x3B, 0x55, 0x8A, 0x5E,
+    0xF8, 0xED, 0x16, 0x11, 0xA1, 0xBD, 0x81, 0x70, 0xA8, 0x1F, 0xA0, 0x06, 0x58, 0x3E, 0xE6, 0x83,
+    0xDE, 0x1B, 0xDA, 0xF0, 0x37, 0x9A, 0x41, 0xF6, 0xD7, 0x99, 0x03, 0xF8, 0x96, 0x72, 0x68, 0x9F,
+    0x41, 0x74, 0x9C, 0x01, 0x16, 0xC3, 0x72, 0x96, 0xBB, 0x9A, 0x39, 0xE5, 0xA2, 0x14, 0x88, 0x42,
+    0x3B, 0x57, 0x70, 0xE4, 0xFA, 0xB8, 0x9B, 0xC9, 0xEF, 0x2A, 0x09, 0xBD, 0x53, 0x12, 0xB4, 0xBB,
+    0xD2, 0x69, 0x69, 0x33, 0x61, 0xC8, 0xC0, 0x41, 0xEF, 0x9F, 0x4E, 0x6B, 0xDD, 0x4C, 0xDA, 0x66,
+    0xA4, 0x7A, 0xD1, 0xBF, 0xD8, 0x3D, 0x89, 0x7D, 0x33, 0xC4, 0x2E, 0x8A, 0x3E, 0x67, 0x47, 0x25,
+    0x14, 0x70, 0x58, 0x96, 0x30, 0xC1, 0xDB, 0x43, 0xB4, 0xE5, 0xA8, 0x09, 0xB5, 0x48, 0x65, 0x6A,
+    0x2D, 0x1C, 0x13, 0xEF, 0x03, 0xC9, 0x7D, 0x64, 0xBF, 0x7F, 0xFE, 0x1E, 0x4F, 0xE0, 0x46, 0x60,
+    0x9F, 0x97, 0x8B, 0x10, 0x7B, 0xBA, 0xBC, 0x7B, 0xD6, 0xC5, 0x88, 0x0A, 0x37, 0x29, 0x76, 0xC0,
+    0xEA, 0x0F, 0xEF, 0xE3, 0xCD, 0xE6, 0x3B, 0x1B, 0x15, 0x89, 0xF6, 0xCD, 0x84, 0x7C, 0x95, 0xF4,
+    0xF6, 0xE1, 0xF3, 0xCB, 0x18, 0x5E, 0x6D, 0x35, 0x46, 0x3B, 0xB0, 0x2F, 0x66, 0x8E, 0xEF, 0xFC,
+    0xEE, 0xED, 0x14, 0xD8, 0xC0, 0x60, 0xB2, 0xF9, 0xC2, 0x95, 0xF4, 0xCD, 0x2A, 0x8C, 0xB7, 0x49,
+    0xB2, 0x95, 0xFF, 0xF6, 0xFB, 0x1B, 0x85, 0x55, 0xBB, 0x92, 0xDC, 0x44, 0x14, 0xBD, 0x2D, 0xB9,
+    0x50, 0xD0, 0x41, 0x27, 0x50, 0x04, 0x04, 0xFD, 0x09, 0xFD, 0x05, 0xAC, 0x04, 0x0E, 0x09, 0x20,
+    0x99, 0x72, 0xE0, 0x80, 0x94, 0x6C, 0xBF, 0x60, 0x66, 0x64, 0x3B, 0x20, 0xC4, 0x09, 0x7F, 0x40,
+    0x34, 0x04, 0xFC, 0x80, 0xB4, 0x12, 0xB5, 0xC1, 0x06, 0x04, 0xA8, 0x96, 0x22, 0x72, 0x60, 0x05,
+    0x50, 0x94, 0x97, 0x60, 0xDB, 0x45, 0x17, 0x6E, 0xAF, 0xF5, 0xE0, 0x9C, 0x9E, 0xDD, 0xA5, 0x88,
+    0x98, 0xAD, 0xED, 0x92, 0xA6, 0xBB, 0xEF, 0x3D, 0xF7, 0x9C, 0x73, 0xEF, 0x88, 0x88, 0xA9, 0x45,
+    0x44, 0x7B, 0x2C, 0xC5, 0x84, 0x25, 0x5F, 0xB1, 0xA8, 0x77, 0x03, 0xD6, 0x29, 0x62, 0x69, 0x4F,
+    0xB0, 0xEC, 0x4C, 0x2F, 0x52, 0x66, 0x38, 0x64, 0xEB, 0x06, 0x57, 0x6E, 0xBA, 0x4A, 0xF4, 0xBA,
+    0x8E, 0x38, 0xBD, 0x46, 0xC9, 0x43, 0x53, 0x8A, 0x8A, 0x25, 0x0E, 0x4D, 0xE6, 0xA9, 0x97, 0xB3,
+    0x62, 0xD8, 0xF2, 0xB4, 0xAD, 0x5D, 0xD5, 0xE4, 0xA3, 0xED, 0x4B, 0x7C, 0xDF, 0x9B, 0xBA, 0x2C,
+    0xC6, 0x62, 0xD0, 0xE7, 0x3E, 0xF3, 0xD9, 0xDF, 0x41, 0x26, 0xD9, 0x21, 0x25, 0x53, 0xAC, 0x08,
+    0x6E, 0x91, 0x3B, 0xFF, 0x03, 0x0F, 0xCD, 0x16, 0xF1, 0x9F, 0x21, 0xB2, 0x47, 0xE2, 0xDD, 0x23,
+    0x2F, 0x66, 0x5D, 0x25, 0x5B, 0x57, 0x2F, 0xA5, 0xB3, 0x95, 0x3E, 0x7F, 0x1D, 0x55, 0x3C, 0x61,
+    0xAC, 0x61, 0x2A, 0x86, 0xC6, 0xF4, 0x93, 0xEE, 0x1B, 0x57, 0xC5, 0xE2, 0x17, 0x6F, 0xEA, 0x9D,
+    0x38, 0x44, 0xE1, 0x5D, 0x91, 0x0E, 0x80, 0x11, 0xD6, 0x4B, 0x31, 0xA6, 0x9A, 0x5A, 0x91, 0xB3,
+    0x20, 0xBA, 0x17, 0xF3, 0x73, 0x8D, 0xDC, 0x59, 0x88, 0x02, 0xBC, 0x7B, 0xD3, 0x2B, 0x3E, 0x34,
+    0xE2, 0x2A, 0x15, 0x75, 0x9F, 0x2F, 0x87, 0xEE, 0x6A, 0x96, 0x72, 0xC5, 0x67, 0xCC, 0xB9, 0x2E,
+    0x80, 0xE9, 0x3E, 0x3B, 0xF7, 0x7A, 0x28, 0xC6, 0x09, 0x85, 0xA4, 0x12, 0x4D, 0x6F, 0x9F, 0x04,
+    0xFB, 0x49, 0xCC, 0xBD, 0x55, 0xD1, 0x56, 0x6D, 0xE6, 0xCD, 0xD3, 0x90, 0xEA, 0x2C, 0x73, 0x9F,
+    0x8F, 0xE6, 0xDC, 0xEF, 0x64, 0x2B, 0x0D, 0x68, 0xD3, 0xBD, 0x7E, 0x71, 0x19, 0x53, 0xB1, 0x5B,
+    0xC9, 0x98, 0x57, 0x6C, 0x60, 0x66, 0x90, 0x57, 0x4A, 0xF1, 0xB2, 0x96, 0x88, 0xC2, 0x00, 0x32,
+    0xF3, 0xC4, 0x60, 0x9E, 0x04, 0x59, 0x36, 0xF3, 0xE3, 0x21, 0xE5, 0xAE, 0x2D, 0x57, 0xD9, 0x02,
+    0xEC, 0x84, 0x14, 0x17, 0x97, 0x48, 0x3C, 0x59, 0x3D, 0x80, 0xC8, 0x06, 0xD9, 0x91, 0xEB, 0x44,
+    0x5F, 0x06, 0x53, 0x4F, 0xCE, 0xF4, 0xDB, 0xDC, 0x4F, 0xC4, 0xD1, 0x8B, 0x4A, 0x57, 0xC5, 0xAD,
+    0xD4, 0x26, 0xE3, 0x4B, 0xC5, 0x84, 0x66, 0x24, 0x09, 0x19, 0x08, 0x07, 0x3D, 0x67, 0xA0, 0xDD,
+    0x55, 0x8E, 0xD2, 0x4F, 0x7A, 0xA4, 0x01, 0x2E, 0xA9, 0x84, 0x94, 0x7B, 0xAE, 0x1F, 0xAE, 0xBF,
+    0x61, 0xB5, 0x24, 0x5D, 0x8A, 0x65, 0xE9, 0x70, 0x6C, 0x46, 0x66, 0x6C, 0x57, 0x93, 0x1E, 0xA4,
+    0x80, 0xB2, 0xD0, 0x6E, 0xCE, 0x02, 0xB8, 0x65, 0xD5, 0x3B, 0x94, 0xC5, 0xBA, 0x51, 0x11, 0xFF,
+    0x48, 0x15, 0x72, 0x4C, 0x48, 0x57, 0xB2, 0xA6, 0x1E, 0x7B, 0x7C, 0x85, 0x1E, 0x10, 0x13, 0x6A,
+    0x63, 0x99, 0x44, 0x5F, 0x1D, 0xE0, 0xA2, 0x13, 0x31, 0x83, 0xA8, 0x40, 0xC5, 0x52, 0x06, 0xF9,
+    0xB8, 0xA4, 0x13, 0x57, 0xF8, 0x0F, 0x06, 0x1B, 0x24, 0x47, 0x7A, 0x28, 0x67, 0x7E, 0x8C, 0xB0,
+    0x5E, 0x64, 0x28, 0x53, 0x81, 0x4C, 0xE5, 0x75, 0x6F, 0x7A, 0x27, 0xAD, 0x82, 0x06, 0xC5, 0x50,
+    0x22, 0xCE, 0x4E, 0xC3, 0x5D, 0xC0, 0xE0, 0x92, 0x7A, 0xCC, 0xC7, 0xD2, 0x71, 0xA1, 0x48, 0x24,
+    0xDA, 0x1A, 0x1C, 0xC0, 0xE6, 0x2D, 0x9E, 0x64, 0x2F, 0xF0, 0x32, 0xE8, 0xF7, 0x24, 0x66, 0x87,
+    0x57, 0x62, 0x9B, 0x01, 0x02, 0x66, 0x50, 0x50, 0x19, 0x25, 0x48, 0xF6, 0x06, 0x98, 0xCA, 0xAB,
+    0xC3, 0x0F, 0xEB, 0x73, 0x49, 0xA1, 0xD6, 0x40, 0xBB, 0xAF, 0xDD, 0xB5, 0x47, 0x08, 0x3D, 0xB6,
+    0x20, 0xB4, 0x95, 0x1D, 0x2C, 0x50, 0xB3, 0x3E, 0x03, 0x1E, 0x60, 0x8B, 0xBA, 0x4C, 0x5A, 0x4F,
+    0xC4, 0xA5, 0xC0, 0x8F, 0x1E, 0xE0, 0x81, 0xE1, 0xC8, 0x4B, 0xA9, 0x68, 0x84, 0x06, 0x0E, 0x02,
+    0x41, 0x24, 0x6F, 0x2F, 0x70, 0xF4, 0xE0, 0x1E, 0x06, 0x04, 0x72, 0x95, 0x6C, 0x19, 0xDE, 0x67,
+    0x21, 0x91, 0x84, 0x78, 0x87, 0x03, 0x9C, 0x48, 0x86, 0x7A, 0x98, 0x04, 0xD7, 0x68, 0x65, 0x34,
+    0x12, 0xAD, 0x1A, 0x40, 0xD5, 0xB2, 0x79, 0x44, 0x82, 0x8E, 0xC8, 0x20, 0xD6, 0xF5, 0x9F, 0x9E,
+    0x56, 0x29, 0xF5, 0xC8, 0xD6, 0x03, 0x57, 0x20, 0x94, 0xD4, 0xC0, 0x2D, 0x4E, 0x1A, 0xF4, 0xA7,
+    0x34, 0x99, 0x87, 0xCE, 0x24, 0xCC, 0xB1, 0x1F, 0x6D, 0x3D, 0xB5, 0x70, 0x25, 0x1B, 0xFC, 0x81,
+    0xBC, 0x0F, 0xC1, 0x65, 0x46, 0xE5, 0xE7, 0x6F, 0xE1, 0x90, 0x6B, 0x74, 0xA2, 0xE2, 0x24, 0x38,
+    0x85, 0x93, 0x0A, 0xD2, 0x69, 0xDE, 0x3E, 0x06, 0x80, 0x4A, 0xCD, 0x34, 0x48, 0xFB, 0xDF, 0x85,
+    0xBA, 0xD1, 0x58, 0x02, 0x2B, 0x65, 0x07, 0xD8, 0xAD, 0x00, 0x22, 0xE8, 0xB7, 0x70, 0x73, 0x8F,
+    0x50, 0x14, 0x59, 0x48, 0x77, 0x32, 0xDF, 0xED, 0x92, 0x5E, 0xE9, 0x4A, 0x29, 0x71, 0xE4, 0x23,
+    0x5C, 0x3B, 0x5D, 0x67, 0xAA, 0xFE, 0x5C, 0xDC, 0xCD, 0x17, 0x34, 0x9B, 0x24, 0x5D, 0xF8, 0xB4,
+    0xA9, 0xE8, 0xE7, 0x48, 0xFF, 0x20, 0xCF, 0x66, 0xF3, 0x95, 0x1C, 0x3F, 0x01, 0x41, 0x2C, 0xE6,
+    0x56, 0xF6, 0x06, 0x09, 0xCA, 0x51, 0x54, 0x37, 0x93, 0x91, 0x01, 0x93, 0x63, 0xBA, 0xBD, 0x8D,
+    0x96, 0x4F, 0xF9, 0x00, 0x30, 0xFB, 0x1E, 0x97, 0xD1, 0x78, 0xB2, 0x5F, 0x8E, 0x60, 0x8F, 0xD0,
+    0x79, 0x8A, 0x03, 0x8E, 0x5F, 0x9C, 0x7A, 0x20, 0x19, 0xA5, 0x43, 0xD9, 0xD4, 0x7D, 0xCB, 0x3E,
+    0x21, 0xD6, 0x9B, 0xC3, 0x77, 0x34, 0x01, 0xB9, 0xE8, 0x53, 0x66, 0x84, 0x64, 0xC3, 0xD2, 0xD5,
+    0xA6, 0xDF, 0x09, 0x9D, 0xE9, 0xAA, 0x62, 0x54, 0x10, 0x17, 0x3D, 0xBE, 0x4B, 0x86, 0xFF, 0x77,
+    0xDB, 0xDE, 0x6D, 0xC7, 0xB4, 0xDD, 0xDE, 0xF6, 0x03, 0xF5, 0x85, 0x65, 0x2A, 0x9A, 0x53, 0x63,
+    0xC4, 0x80, 0xA6, 0xF5, 0x61, 0xB0, 0x23, 0xE5, 0x44, 0x11, 0x2A, 0x35, 0xB2, 0xBC, 0xD7, 0xBD,
+    0x62, 0x46, 0x3D, 0xC8, 0x1D, 0x75, 0x47, 0xDC, 0xB7, 0xEC, 0xD0, 0xD0, 0xF7, 0xDB, 0x42, 0x21,
+    0x85, 0x4E, 0xB9, 0x13, 0x47, 0xF7, 0xF7, 0xE7, 0xD3, 0xA8, 0x57, 0x41, 0x52, 0xF3, 0xA7, 0xAE,
+    0xA3, 0x6B, 0xE1, 0xD8, 0x34, 0xB4, 0xF0, 0xB8, 0x95, 0x09, 0x96, 0x85, 0x71, 0xDA, 0x34, 0xE8,
+    0xFA, 0xE4, 0x21, 0xB8, 0x36, 0x72, 0x94, 0x63, 0xE4, 0x61, 0x72, 0x07, 0x57, 0xE1, 0x0A, 0x2F,
+    0x14, 0x23, 0x3B, 0x7F, 0xCA, 0x02, 0x2C, 0x5C, 0x3B, 0x0C, 0x62, 0x2F, 0xEB, 0xE7, 0x2F, 0x26,
+    0x52, 0xB4, 0xDC, 0xA9, 0x9F, 0x85, 0x7B, 0x98, 0x47, 0xE0, 0x27, 0x09, 0x5D, 0x82, 0xDA, 0xC8,
+    0x2D, 0xEF, 0x22, 0x51, 0xEE, 0x3F, 0x96, 0xB4, 0xEF, 0x79, 0xB9, 0x7B, 0xD5, 0x79, 0xE9, 0x6A,
+    0xB5, 0xC8, 0xBE, 0xE2, 0x98, 0xA9, 0xF0, 0x43, 0xC3, 0x89, 0x75, 0xC6, 0x3B, 0xF6, 0x27, 0x54,
+    0x98, 0xFF, 0xC5, 0xF0, 0xD3, 0xB2, 0xD9, 0x6C, 0xBA, 0x3D, 0xFB, 0xE0, 0x25, 0x97, 0x77, 0xD8,
+    0xC9, 0x6E, 0x18, 0x72, 0xE6, 0x98, 0xDB, 0xF3, 0x8E, 0xBB, 0xE0, 0x80, 0x19, 0xC0, 0x82, 0xF1,
+    0x25, 0xE7, 0x00, 0x7E, 0x78, 0x4C, 0x90, 0xEE, 0xF7, 0xD3, 0x48, 0xC7, 0x21, 0x8C, 0xE3, 0xC8,
+    0x91, 0x0F, 0xEE, 0x60, 0x28, 0x98, 0x00, 0x85, 0x54, 0xC5, 0xFC, 0xA5, 0xCF, 0xA3, 0x9C, 0x65,
+    0x31, 0xCD, 0xA7, 0xDC, 0x23, 0x64, 0x5B, 0x7E, 0xBB, 0xD9, 0xB3, 0x49, 0x2F, 0xF0, 0xFF, 0x1A,
+    0x13, 0x23, 0x62, 0x1A, 0xB6, 0x50, 0x01, 0xB4, 0x88, 0xAB, 0x67, 0x80, 0xB5, 0xE3, 0x69, 0xAF,
+    0x28, 0xA1, 0xA5, 0x80, 0x0F, 0x52, 0xB1, 0xD9, 0xCC, 0xF4, 0x0B, 0x9E, 0xDC, 0xAF, 0x2D, 0x49,
+    0x81, 0xB9, 0x66, 0x30, 0xA8, 0x38, 0x30, 0xF2, 0x00, 0x6A, 0x72, 0x9F, 0xA6, 0x67, 0xF2, 0x4C,
+    0x1A, 0x9D, 0x1C, 0x66, 0x34, 0x60, 0x2B, 0xC9, 0x4B, 0x62, 0x3F, 0x05, 0x52, 0xFB, 0x8C, 0xB5,
+    0x7C, 0x0D, 0xB8, 0xE6, 0x1B, 0x30, 0x61, 0xF0, 0x1B, 0x22, 0xE6, 0x9A, 0x5C, 0x26, 0x57, 0x53,
+    0x69, 0x1D, 0xEF, 0xFA, 0xEB, 0x7F, 0x3E, 0xFF, 0x00, 0xAD, 0x55, 0x21, 0x90, 0x1C, 0x45, 0x14,
+    0xFD, 0x33, 0x93, 0xBA, 0x81, 0x74, 0x15, 0xAD, 0x30, 0x67, 0x1A, 0x89, 0x1B, 0x8B, 0xDA, 0xDE,
+    0x80, 0x40, 0x20, 0x88, 0xA0, 0x62, 0x10, 0x41, 0x82, 0x5A, 0x83, 0x88, 0xE0, 0x66, 0x26, 0x20,
+    0x10, 0x08, 0x0C, 0xA0, 0x23, 0xA9, 0xD3, 0x08, 0xC4, 0xED, 0xCC, 0xE4, 0x4C, 0xC4, 0x89, 0x4C,
+    0x15, 0x95, 0x42, 0x20, 0x32, 0x10, 0xAA, 0x90, 0x99, 0xAA, 0x0C, 0xD4, 0x5C, 0xD2, 0xBB, 0xCD,
+    0x7B, 0xDD, 0xBB, 0x70, 0x1B, 0x83, 0x61, 0xEE, 0xAE, 0xE7, 0x4F, 0xDF, 0xEF, 0xEE, 0xFF, 0xDE,
+    0x7F, 0xFF, 0xF7, 0x89, 0x48, 0x71, 0xBB, 0x96, 0xEA, 0xA7, 0x51, 0xEC, 0xD2, 0x49, 0x51, 0x5B,
+    0xD1, 0x9D, 0xEE, 0xF2, 0x3E, 0x1D, 0xB3, 0x51, 0xD6, 0xC9, 0x2C, 0x06, 0xD3, 0x79, 0x5F, 0x8A,
+    0xCC, 0x56, 0x64, 0xA1, 0x6B, 0xD1, 0x17, 0x9D, 0x64, 0xCF, 0x06, 0x91, 0x66, 0xC4, 0xE2, 0x59,
+    0x44, 0x39, 0x91, 0xC4, 0x8B, 0xC8, 0xF1, 0x8D, 0x7B, 0x22, 0xFA, 0x9C, 0x53, 0x3D, 0xE6, 0xB2,
+    0x71, 0x81, 0xC9, 0xC9, 0x60, 0xB8, 0xA3, 0x96, 0xF2, 0xEF, 0x73, 0x26, 0x92, 0x6E, 0xE0, 0xA0,
+    0xB7, 0xB0, 0x8A, 0x47, 0x6B, 0x11, 0x2B, 0x27, 0x22, 0x1B, 0x29, 0x25, 0x71, 0x18, 0xB2, 0x49,
+    0x16, 0x58, 0x8D, 0x59, 0xD5, 0x0B, 0x03, 0xC2, 0x50, 0x2C, 0xA5, 0xC0, 0x0B, 0x03, 0xDC, 0x0B,
+    0xC4, 0x24, 0xE6, 0xED, 0x09, 0xC3, 0x17, 0x08, 0x42, 0x7F, 0xD9, 0x63, 0xF8, 0xBA, 0xC3, 0xF0,
+    0xB8, 0xC6, 0xF0, 0x54, 0xB8, 0xB7, 0xC4, 0xC8, 0x44, 0x21, 0x1E, 0xC9, 0xE1, 0x26, 0x9F, 0x1C,
+    0xD5, 0x21, 0xBC, 0x74, 0xC2, 0x46, 0x36, 0x1B, 0x24, 0xEB, 0x3F, 0x3B, 0x8C, 0xED, 0xE4, 0xFF,
+    0xA4, 0xE3, 0xEA, 0x53, 0x6D, 0x77, 0x87, 0xE4, 0xDE, 0x0F, 0xD1, 0x2A, 0x9E, 0xAF, 0x5C, 0xB4,
+    0xDA, 0x3A, 0xD9, 0x06, 0x23, 0xD9, 0xC0, 0x33, 0x58, 0xA0, 0x00, 0x11, 0xD0, 0x52, 0x70, 0x2F,
+    0xEE, 0x62, 0x5F, 0x07, 0x1E, 0xC4, 0x74, 0x0C, 0xBF, 0x20, 0xCA, 0xCE, 0x81, 0x23, 0xFA, 0xD0,
+    0x52, 0xBD, 0x25, 0xE8, 0xEE, 0x0C, 0x1E, 0xDC, 0xC1, 0x74, 0x6B, 0xAC, 0x2F, 0x83, 0x75, 0x02,
+    0x4A, 0x1B, 0x1E, 0x58, 0x97, 0xE2, 0x82, 0x65, 0x97, 0x0B, 0x40, 0xA1, 0x55, 0x81, 0x87, 0x31,
+    0x58, 0xAD, 0xD8, 0x7C, 0x08, 0xA7, 0x6F, 0xA4, 0x08, 0x94, 0x4B, 0x06, 0x06, 0xCC, 0x52, 0x6C,
+    0x27, 0x6A, 0x14, 0x83, 0x09, 0x33, 0x88, 0xED, 0x45, 0x83, 0x25, 0xB5, 0xBD, 0xE5, 0x81, 0x1D,
+    0x00, 0x52, 0xEF, 0x11, 0xB5, 0x9E, 0x78, 0x80, 0x67, 0x1E, 0xC8, 0xB4, 0x7C, 0x10, 0xA2, 0xD9,
+    0xA3, 0x37, 0xF5, 0xDE, 0xB2, 0xFF, 0x30, 0xD2, 0xEC, 0x8D, 0x64, 0xC7, 0x82, 0xA4, 0x1F, 0x4E,
+    0x3B, 0x2B, 0xE3, 0x46, 0xD1, 0xDA, 0x1E, 0xF2, 0x68, 0xB6, 0x60, 0x5F, 0xF2, 0x01, 0x34, 0x0A,
+    0x43, 0x93, 0xEA, 0x91, 0xA7, 0x6C, 0xE6, 0x8C, 0x78, 0x66, 0x9C, 0x09, 0x6E, 0x5C, 0x80, 0x44,
+    0x7A, 0x74, 0x97, 0x8D, 0xD0, 0x10, 0x66, 0xA1, 0x19, 0x26, 0x1D, 0xEA, 0x71, 0xF8, 0x11, 0x97,
+    0x4C, 0xAA, 0x07, 0xDE, 0x6C, 0xCC, 0x06, 0xCB, 0xF8, 0x4C, 0xAD, 0x3F, 0x9F, 0xB0, 0x13, 0x1C,
+    0x16, 0xBA, 0x03, 0x3B, 0xD8, 0xC3, 0x9D, 0x71, 0x2C, 0xEA, 0x14, 0xE9, 0xD5, 0x3D, 0xE2, 0x54,
+    0x50, 0x96, 0xF9, 0x7D, 0xD5, 0x8B, 0x99, 0x89, 0x16, 0xB8, 0x2D, 0x73, 0x02, 0x26, 0x40, 0x1A,
+    0x9E, 0x25, 0x45, 0xBF, 0x8B, 0xB4, 0xD8, 0xAB, 0x6A, 0x0F, 0x4F, 0xF7, 0x87, 0xC8, 0xD3, 0xDB,
+    0x3B, 0x57, 0xB3, 0x17, 0x4B, 0xB5, 0x53, 0x86, 0xFC, 0x18, 0xA8, 0xA2, 0xFF, 0xCA, 0x63, 0x9B,
+    0xCA, 0x63, 0x2C, 0xC8, 0xB3, 0x9A, 0xED, 0xFB, 0x23, 0x55, 0x62, 0x6B, 0x64, 0x3E, 0x71, 0x14,
+    0x87, 0x66, 0xAD, 0x49, 0x43, 0x4D, 0xA8, 0x27, 0x64, 0xB0, 0x21, 0xC9, 0xEA, 0x0F, 0xEE, 0xDE,
+    0x50, 0x01, 0xFA, 0x17, 0xEE, 0xBB, 0xE1, 0xB1, 0xFA, 0x02, 0x66, 0xEA, 0x38, 0x6B, 0xDF, 0x1D,
+    0x59, 0x16, 0x14, 0xD0, 0x26, 0x75, 0x44, 0xA2, 0x07, 0x67, 0x46, 0x1E, 0xE6, 0xA0, 0x5F, 0xBF,
+    0x65, 0x6A, 0xA9, 0xDA, 0xDC, 0x1D, 0xC0, 0xC1, 0xF3, 0xA6, 0x44, 0xE0, 0xD5, 0x25, 0x1D, 0x87,
+    0xE0, 0xBC, 0x3D, 0xD6, 0x5D, 0x23, 0x29, 0xAB, 0xA2, 0x84, 0xAF, 0x7E, 0xC8, 0xAA, 0x18, 0x25,
+    0xB9, 0x04, 0x53, 0x65, 0x19, 0xCB, 0x4A, 0x3F, 0x18, 0x90, 0x3A, 0xE4, 0x65, 0xB2, 0x37, 0xDE,
+    0x99, 0xF3, 0x17, 0x38, 0xA8, 0xF5, 0xB3, 0x1C, 0x79, 0x16, 0x32, 0xD0, 0xA6, 0x3B, 0xFC, 0x37,
+    0x23, 0x3F, 0x51, 0x04, 0xD0, 0xD7, 0x37, 0x7C, 0x4F, 0x2A, 0x48, 0xE1, 0xE3, 0x3B, 0xC7, 0x51,
+    0x48, 0x51, 0x52, 0xFB, 0x25, 0x3F, 0x1C, 0xBC, 0x3E, 0xBA, 0xA2, 0x98, 0x23, 0x5F, 0xE7, 0x48,
+    0x90, 0xF2, 0x0E, 0xBF, 0x68, 0x0B, 0x4D, 0xF2, 0xBC, 0xED, 0xD4, 0x94, 0xC8, 0x1B, 0xF9, 0x14,
+    0xBA, 0x82, 0x34, 0x59, 0xD0, 0x9D, 0x39, 0x0F, 0x40, 0xB3, 0x71, 0x13, 0xD3, 0x16, 0x0B, 0xD1,
+    0x16, 0xE1, 0x20, 0xF3, 0x30, 0x04, 0x93, 0x3F, 0x09, 0x2B, 0xD2, 0xCB, 0x98, 0xD4, 0x0D, 0x80,
+    0x2D, 0xA2, 0x0F, 0x25, 0x04, 0x72, 0x21, 0x36, 0xF5, 0x5B, 0x10, 0x4F, 0x36, 0x36, 0xCC, 0x7D,
+    0x3A, 0x9B, 0x0E, 0x55, 0x95, 0xB8, 0xA0, 0x24, 0xD9, 0x0A, 0x74, 0x3B, 0x72, 0xF8, 0x73, 0xE5,
+    0xBF, 0xF3, 0x44, 0xF7, 0x18, 0x52, 0xA6, 0x86, 0x5A, 0x9E, 0xFB, 0xFA, 0x1E, 0xFD, 0xB5, 0xA8,
+    0x88, 0x39, 0xC4, 0xE0, 0x2F, 0x99, 0x81, 0xA4, 0x05, 0xE7, 0xD7, 0x15, 0x9B, 0xEC, 0x5E, 0x66,
+    0x27, 0x51, 0x59, 0x51, 0x46, 0x61, 0x7C, 0xF5, 0xA5, 0xC6, 0x03, 0xE0, 0xCB, 0x76, 0xC0, 0xFE,
+    0x7D, 0xC5, 0x43, 0xEF, 0xBD, 0xB6, 0xEA, 0x29, 0xC4, 0x28, 0x9D, 0x50, 0xFC, 0xBB, 0x96, 0x8D,
+    0x2D, 0x03, 0x28, 0x17, 0x4A, 0xD4, 0x1A, 0xD6, 0x80, 0x41, 0xC2, 0xD6, 0xA2, 0x7E, 0x9D, 0xD1,
+    0x76, 0xB3, 0xA9, 0x44, 0x1D, 0x25, 0x8E, 0x25, 0x25, 0x9B, 0x6C, 0xC2, 0xBF, 0x5B, 0x69, 0x6F,
+    0xF9, 0x6F, 0xBD, 0x68, 0xEF, 0xA9, 0xD0, 0x76, 0xAE, 0x90, 0xA2, 0xE4, 0x66, 0x44, 0x70, 0xFD,
+    0xF4, 0xF4, 0x7B, 0xBE, 0xF1, 0x2F, 0xF6, 0x01, 0x95, 0x76, 0x9F, 0x86, 0xDC, 0x5E, 0x4B, 0x5E,
+    0x8E, 0x90, 0x4D, 0x01, 0xB5, 0x9C, 0x81, 0xDB, 0x14, 0x99, 0x28, 0xAB, 0xD0, 0xFA, 0xD4, 0xCF,
+    0x43, 0x40, 0xE9, 0x9A, 0xE8, 0x70, 0x11, 0x3E, 0xD3, 0x29, 0x7E, 0x5A, 0x84, 0x8F, 0xEC, 0xE5,
+    0x24, 0x19, 0xF4, 0xAD, 0xF1, 0x59, 0x8C, 0x42, 0x09, 0x66, 0x1E, 0xDD, 0x00, 0x9F, 0x2D, 0xEF,
+    0x8F, 0x52, 0x4C, 0xB5, 0xCC, 0xC7, 0x7C, 0xCC, 0x9E, 0x4D, 0x40, 0x82, 0x6B, 0xA6, 0x58, 0x12,
+    0x80, 0xBE, 0x3B, 0xE3, 0x28, 0x9B, 0x8E, 0xA6, 0xE3, 0x75, 0xB3, 0x08, 0xCD, 0xB5, 0xF8, 0xAA,
+    0xD3, 0xF7, 0x67, 0xAC, 0x86, 0xAB, 0x0D, 0xD7, 0x48, 0xFE, 0x14, 0xA1, 0x43, 0x86, 0x36, 0xB6,
+    0xF5, 0xCC, 0xEF, 0x82, 0xED, 0xAE, 0x04, 0x9F, 0x9C, 0x9E, 0x9E, 0xD6, 0x4C, 0xA0, 0x27, 0x89,
+    0xFD, 0x5B, 0x4C, 0xC6, 0x2B, 0x89, 0x2C, 0x0F, 0x21, 0x96, 0x0C, 0x5E, 0x3F, 0xE0, 0x75, 0x26,
+    0xF3, 0x1A, 0x55, 0x20, 0xC5, 0x7B, 0x7D, 0x98, 0x5D, 0xB3, 0xA1, 0x2D, 0x54, 0x87, 0x5C, 0xAA,
+    0xFE, 0x8C, 0x02, 0x72, 0xF8, 0xDB, 0x80, 0x91, 0xB5, 0x14, 0x03, 0xDB, 0x57, 0xBE, 0x15, 0xB6,
+    0xF0, 0x17, 0x03, 0x22, 0x1F, 0xAC, 0x4D, 0x10, 0x78, 0x7E, 0x3E, 0xF2, 0x86, 0x9C, 0xD8, 0xA8,
+    0x8B, 0x32, 0xF9, 0x6B, 0x42, 0x21, 0x76, 0xBC, 0xF2, 0xD0, 0x87, 0xA9, 0x92, 0x26, 0x5E, 0x78,
+    0xFF, 0xFD, 0xFC, 0x0D, 0xC5, 0x55, 0xBD, 0x8E, 0xDD, 0x44, 0x14, 0x3E, 0x63, 0x6F, 0xD6, 0x28,
+    0x53, 0x38, 0x45, 0xA2, 0xA0, 0x80, 0x32, 0x29, 0x43, 0xB1, 0xB8, 0xA1, 0xA0, 0xD8, 0x64, 0x1C,
+    0xE5, 0x01, 0xD8, 0x82, 0xA5, 0x49, 0x01, 0x05, 0x05, 0x15, 0xF0, 0x00, 0x77, 0xEF, 0x35, 0xE2,
+    0x05, 0xB6, 0x40, 0xA2, 0x4D, 0x81, 0x90, 0x12, 0x0A, 0x52, 0xD0, 0x20, 0xDD, 0x1B, 0x1B, 0xA5,
+    0xA0, 0x64, 0xDE, 0x20, 0x56, 0x14, 0x2A, 0x84, 0xE2, 0x45, 0x83, 0xE2, 0xAC, 0xC6, 0x1E, 0xBE,
+    0x33, 0x63, 0x5F, 0x12, 0x85, 0x02, 0xD2, 0x30, 0x92, 0xCF, 0x3D, 0xD7, 0x73, 0x7E, 0xBE, 0xF9,
+    0xCE, 0x99, 0x63, 0xA2, 0xB0, 0x0A, 0x6F, 0x28, 0xF1, 0xDE, 0x91, 0x1A, 0xBF, 0xB3, 0xB4, 0x32,
+    0x74, 0x8E, 0x46, 0xBC, 0x4E, 0x7B, 0x88, 0xAC, 0x83, 0xC8, 0x0D, 0x84, 0x6A, 0xD8, 0xB4, 0x82,
+    0xD0, 0x34, 0x8B, 0x15, 0x8B, 0xFB, 0xFF, 0x20, 0x56, 0x5B, 0x13, 0xCD, 0x6E, 0xAA, 0x85, 0x90,
+    0xE3, 0x07, 0x84, 0x3C, 0x1C, 0x7A, 0x35, 0xF0, 0x96, 0x9B, 0x85, 0xE8, 0x67, 0x91, 0x58, 0x4E,
+    0xDC, 0xCD, 0x22, 0x6B, 0x23, 0x42, 0x52, 0xBE, 0x4A, 0xBD, 0x27, 0xFD, 0xEB, 0x27, 0x8C, 0xAA,
+    0x68, 0x82, 0x9F, 0x6C, 0x63, 0x0E, 0x17, 0xAD, 0x15, 0xB0, 0x2D, 0x63, 0x1C, 0xFE, 0xCB, 0xA0,
+    0x8B, 0xC7, 0x1F, 0x87, 0xD3, 0x29, 0x8F, 0xF7, 0x6C, 0xD6, 0x46, 0xB3, 0xCD, 0x64, 0xD2, 0x44,
+    0x0F, 0x1B, 0x72, 0xBC, 0x1E, 0xB3, 0xEE, 0xD0, 0x11, 0x91, 0xC5, 0x96, 0xFA, 0x03, 0x26, 0x3A,
+    0xC0, 0x85, 0x9B, 0x40, 0x18, 0xD2, 0x75, 0x45, 0x99, 0x19, 0x5E, 0xA3, 0x5E, 0x3C, 0xB0, 0x05,
+    0x62, 0x3D, 0xC5, 0x4E, 0xC1, 0x47, 0xD0, 0x50, 0x52, 0x36, 0xD9, 0xD4, 0x0D, 0xE5, 0xD5, 0x9A,
+    0x92, 0x4E, 0x94, 0x74, 0x9D, 0xCF, 0xD5, 0xD0, 0xBC, 0xD2, 0xEA, 0xC2, 0xE1, 0xA0, 0xBD, 0x7F,
+    0xF0, 0xE7, 0xE1, 0xC1, 0x5E, 0x78, 0x73, 0x8E, 0x44, 0xDD, 0x5D, 0xC2, 0x1B, 0x5F, 0xED, 0xBF,
+    0x45, 0x49, 0xB5, 0x37, 0xF6, 0xF7, 0xDE, 0xDE, 0xDD, 0x53, 0x3F, 0xD9, 0xFD, 0xC5, 0x79, 0xA2,
+    0x03, 0xA2, 0xBA, 0x07, 0xFA, 0xF1, 0xA6, 0x51, 0xEE, 0x2A, 0xED, 0x56, 0xF4, 0xFC, 0x92, 0xFD,
+    0xA4, 0x24, 0xBE, 0x9B, 0xB4, 0x77, 0xB3, 0xC9, 0x24, 0xA5, 0xAB, 0x2F, 0xD8, 0xD2, 0x99, 0x92,
+    0xE5, 0x21, 0x38, 0xF5, 0xAC, 0x69, 0x80, 0x3E, 0x5D, 0x73, 0x90, 0xDF, 0x5A, 0x7A, 0x93, 0x98,
+    0xE7, 0x56, 0x12, 0x95, 0x3B, 0x50, 0x76, 0x00, 0xEB, 0x3F, 0xAE, 0x37, 0x22, 0x85, 0x62, 0x0C,
+    0x1C, 0x60, 0xD5, 0xEE, 0x07, 0x15, 0x94, 0xFC, 0xC6, 0xEF, 0xF4, 0x79, 0xD0, 0x8C, 0xA4, 0x57,
+    0x5E, 0xBA, 0x0B, 0xC7, 0xAC, 0x28, 0xF7, 0x4C, 0xE7, 0x6A, 0x24, 0x61, 0x2E, 0x73, 0x74, 0xEA,
+    0x50, 0xB7, 0x63, 0x68, 0xC7, 0xC9, 0x8B, 0x1E, 0xBB, 0x8F, 0x27, 0x45, 0x6C, 0xC9, 0xB9, 0x76,
+    0x6B, 0x26, 0xA7, 0xDC, 0x7F, 0x29, 0x83, 0x28, 0x67, 0x6D, 0xBB, 0x97, 0x6D, 0xE9, 0x9E, 0x89,
+    0x26, 0x15, 0xAD, 0xAE, 0xA0, 0xBC, 0xB1, 0x04, 0x55, 0xEC, 0x72, 0xA2, 0x05, 0x25, 0xC7, 0x24,
+    0xD6, 0x53, 0xE3, 0x0A, 0x40, 0x8D, 0xC6, 0x01, 0x2F, 0x77, 0x08, 0x77, 0x6B, 0x0C, 0x79, 0x85,
+    0x66, 0xF1, 0x6F, 0x57, 0xF6, 0x4D, 0xFC, 0xFD, 0x71, 0xBA, 0x39, 0xB8, 0x4B, 0x54, 0xC7, 0xBB,
+    0x81, 0x17, 0x9F, 0xC6, 0xCD, 0x4B, 0xE6, 0xD5, 0xB8, 0x65, 0x48, 0x82, 0xC5, 0xB5, 0x50, 0xB8,
+    0xF9, 0xEE, 0x71, 0xD3, 0x87, 0x23, 0x14, 0x2D, 0x37, 0xDE, 0x74, 0x7B, 0x1C, 0xA5, 0x31, 0x4D,
+    0x5E, 0xD1, 0xE5, 0x48, 0x9C, 0x8D, 0x21, 0x60, 0x38, 0x47, 0x4C, 0xDA, 0x97, 0xB8, 0x9C, 0xE9,
+    0x5D, 0xB0, 0x23, 0x5C, 0x8E, 0x38, 0x0B, 0x0F, 0x17, 0x89, 0x6B, 0xCD, 0x32, 0xB8, 0x6C, 0x6B,
+    0x20, 0xC1, 0xDA, 0xC0, 0xD4, 0xE6, 0x96, 0xC9, 0xAF, 0x1B, 0x4C, 0x82, 0xCC, 0x53, 0x51, 0xD2,
+    0xAA, 0x67, 0x0C, 0x4F, 0x0D, 0x30, 0xEA, 0x02, 0xC1, 0x12, 0xEB, 0x10, 0x4C, 0x7D, 0xD9, 0xA1,
+    0x22, 0x2E, 0xAF, 0xF2, 0x26, 0x6F, 0x8E, 0xE0, 0xB8, 0xC1, 0xDF, 0x3E, 0x6B, 0xF3, 0x26, 0x33,
+    0x1A, 0xD7, 0xB0, 0x48, 0x3B, 0xCC, 0x05, 0x57, 0x94, 0xD2, 0xA4, 0x8F, 0x7A, 0x20, 0x55, 0x1F,
+    0x36, 0x88, 0xB3, 0x41, 0xA8, 0x36, 0x41, 0x89, 0x54, 0x99, 0x83, 0xD8, 0x35, 0x5F, 0xE3, 0xF4,
+    0xF4, 0x0B, 0x20, 0xCA, 0x47, 0xD9, 0x4D, 0x6D, 0xC7, 0x88, 0x89, 0x37, 0x29, 0x52, 0x30, 0x0D,
+    0xB6, 0x30, 0xAF, 0xE2, 0x68, 0xA4, 0x0B, 0x7C, 0xC1, 0x70, 0x46, 0xD1, 0x31, 0x96, 0x12, 0xC3,
+    0x63, 0xBC, 0x65, 0x01, 0x18, 0x31, 0xCF, 0x3E, 0x7B, 0xAE, 0xC7, 0x2C, 0x0E, 0x06, 0x67, 0x07,
+    0xF0, 0x39, 0x14, 0x01, 0x84, 0x30, 0xDF, 0xA0, 0x9B, 0xE0, 0xA2, 0xF9, 0x60, 0x1D, 0xC6, 0xD3,
+    0x92, 0xED, 0x0C, 0xCE, 0xCA, 0x76, 0x0A, 0x76, 0x69, 0x0F, 0xA5, 0x2E, 0x35, 0x15, 0x36, 0xED,
+    0xD5, 0xF7, 0x5F, 0x29, 0xFF, 0xC8, 0x97, 0xB5, 0x05, 0xBA, 0x83, 0x30, 0x62, 0xB2, 0x66, 0xEA,
+    0x51, 0x2E, 0x57, 0x28, 0xDE, 0xD1, 0x94, 0xB1, 0x98, 0xD0, 0xEA, 0x40, 0x74, 0x99, 0xE3, 0x39,
+    0xEB, 0xEF, 0xC6, 0x86, 0x74, 0xF1, 0x0C, 0x3C, 0x72, 0xD3, 0xF1, 0x0E, 0xA6, 0x97, 0x37, 0x78,
+    0x6C, 0xD6, 0x66, 0x4E, 0x1A, 0x1A, 0x80, 0xE8, 0x3E, 0x9E, 0x25, 0x00, 0x6D, 0x10, 0x77, 0x28,
+    0xCA, 0xC4, 0x69, 0x92, 0x56, 0xDF, 0xF5, 0x66, 0x85, 0x38, 0xB5, 0xBF, 0x4D, 0xF4, 0x7E, 0x18,
+    0xA2, 0x1C, 0x06, 0x26, 0x17, 0x9F, 0x1D, 0x64, 0xD8, 0x58, 0xE1, 0xC2, 0x61, 0xAA, 0x22, 0x06,
+    0xA7, 0xE0, 0x19, 0xDB, 0x87, 0xA9, 0xCB, 0x89, 0x80, 0x23, 0x3D, 0x39, 0x24, 0xED, 0x47, 0x58,
+    0xF6, 0x1B, 0x52, 0xBF, 0x34, 0x5C, 0x04, 0xF9, 0xB0, 0xA1, 0xF5, 0x40, 0xEA, 0x67, 0x8B, 0xF8,
+    0x60, 0xAD, 0xC6, 0xD4, 0x3D, 0x1F, 0xBE, 0x4C, 0xB7, 0x19, 0x57, 0x0B, 0x07, 0x8F, 0x16, 0x10,
+    0x03, 0x0E, 0x26, 0x5B, 0x44, 0x8E, 0x5C, 0x31, 0x69, 0xC8, 0x9D, 0xB5, 0xC5, 0x8D, 0x6E, 0x00,
+    0x87, 0x9F, 0x81, 0x2B, 0x6F, 0xE1, 0x30, 0x10, 0x10, 0x92, 0x3C, 0xFD, 0xD6, 0xC2, 0x8E, 0x5B,
+    0x82, 0x3E, 0x8A, 0xFC, 0x54, 0xD3, 0x27, 0x46, 0xCF, 0x5D, 0xBE, 0x64, 0xFA, 0xFE, 0xBE, 0x38,
+    0x0B, 0x39, 0x50, 0x72, 0x02, 0xFF, 0xFC, 0xE1, 0xD7, 0x0E, 0xE5, 0x4F, 0x2D, 0x79, 0xC4, 0xCF,
+    0x2C, 0x5C, 0xF1, 0xD5, 0x59, 0xA2, 0x29, 0x05, 0x17, 0x43, 0x1A, 0x34, 0x85, 0x2E, 0x41, 0xB3,
+    0x43, 0xBC, 0xAC, 0xCB, 0xCD, 0x3B, 0xBA, 0xD4, 0x37, 0x4F, 0x9C, 0xF0, 0xE9, 0x13, 0x23, 0x9F,
+    0xBC, 0x37, 0x52, 0xA1, 0x81, 0xDB, 0x15, 0x1E, 0x79, 0xCE, 0x5C, 0xE7, 0xCC, 0x0B, 0xFE, 0xEC,
+    0xB4, 0x21, 0x2B, 0x93, 0x12, 0x3F, 0x0E, 0x0C, 0x46, 0x1A, 0xFA, 0x7F, 0xD6, 0x5F, 0xAD, 0x54,
+    0x3D, 0x8F, 0xDD, 0x54, 0x10, 0x1D, 0xDB, 0x4A, 0x2C, 0xB0, 0xC4, 0xAD, 0xA8, 0x28, 0xFC, 0x0F,
+    0xF0, 0x0F, 0x40, 0xBC, 0x6B, 0x96, 0x22, 0x65, 0xB6, 0x48, 0xF2, 0x37, 0xF2, 0x07, 0x78, 0x6B,
+    0x4B, 0x29, 0x69, 0x52, 0x51, 0x50, 0x51, 0x50, 0x6D, 0x4D, 0x99, 0xB7, 0x76, 0x92, 0x22, 0xE5,
+    0x5A, 0x4A, 0x41, 0xEB, 0x82, 0x95, 0x50, 0x28, 0x70, 0x14, 0x4B, 0x31, 0xD2, 0xB5, 0x2F, 0xE7,
+    0x8C, 0x3F, 0xF6, 0xBD, 0x45, 0xE9, 0xB0, 0xE4, 0xEB, 0x8F, 0x3B, 0x77, 0xE6, 0xCC, 0x99, 0x39,
+    0x23, 0x22, 0xC1, 0x2F, 0x22, 0x92, 0xD4, 0x58, 0x2C, 0x6E, 0x19, 0x70, 0xC7, 0x8D, 0x54, 0xDE,
+    0xE7, 0x91, 0xF7, 0x4E, 0x8C, 0xF7, 0x9D, 0x5C, 0xE0, 0x67, 0xD8, 0x9F, 0xD8, 0x39, 0xDA, 0xB5,
+    0x58, 0xB2, 0x7C, 0xF9, 0x8A, 0x3A, 0x2C, 0x86, 0x06, 0x9B, 0xB9, 0x59, 0xCD, 0x83, 0xC5, 0xED,
+    0x5D, 0xF3, 0xB4, 0xC4, 0x72, 0x90, 0xDB, 0xEB, 0xC5, 0xB2, 0xEB, 0xE6, 0x33, 0xF0, 0x52, 0x20,
+    0x7E, 0x85, 0x7B, 0x7C, 0x7C, 0xAE, 0x3B, 0xC3, 0xB6, 0xA3, 0x2E, 0x78, 0x13, 0x07, 0x9D, 0x13,
+    0x9D, 0x59, 0x6E, 0x7A, 0x66, 0xAC, 0x6C, 0x05, 0x9C, 0x79, 0x5F, 0x6B, 0x46, 0x16, 0x2F, 0x8A,
+    0xFC, 0xB0, 0x26, 0xE4, 0x16, 0xA8, 0x8A, 0x92, 0x87, 0xD4, 0x29, 0xCC, 0x10, 0xD8, 0xC9, 0xFD,
+    0xAB, 0xCB, 0x5C, 0x92, 0xE6, 0xAE, 0x5D, 0x9A, 0x2F, 0x49, 0xDA, 0x35, 0x19, 0xA6, 0xAD, 0x76,
+    0xC4, 0x1C, 0xE2, 0xB8, 0x79, 0x77, 0xA9, 0xBB, 0xC3, 0x0C, 0x91, 0x9E, 0xDD, 0xB6, 0x29, 0x57,
+    0x38, 0xDF, 0xCD, 0x0E, 0xED, 0xEC, 0x93, 0x87, 0xB3, 0x25, 0x0E, 0xF1, 0x36, 0xA7, 0x78, 0xF7,
+    0xAB, 0xFF, 0xFF, 0xE0, 0xA5, 0x1F, 0xD8, 0xB5, 0x82, 0x03, 0xAD, 0x14, 0x3F, 0xFB, 0x32, 0x69,
+    0xC2, 0x11, 0x76, 0xA6, 0x83, 0x9D, 0x05, 0x80, 0xA8, 0x07, 0x21, 0xD9, 0x59, 0x2F, 0xE1, 0x80,
+    0x60, 0xD9, 0xB3, 0x0E, 0xD8, 0x81, 0xD7, 0x3E, 0x68, 0x66, 0xEC, 0x05, 0x5D, 0x22, 0x48, 0x40,
+    0xDF, 0x16, 0xDC, 0xA5, 0x5D, 0x70, 0xF3, 0xD4, 0x49, 0xEA, 0x27, 0x09, 0xFC, 0x84, 0x18, 0x8F,
+    0xE6, 0xC4, 0xFA, 0x4F, 0x24, 0x36, 0x9E, 0x23, 0xF8, 0x08, 0xFB, 0x51, 0x2E, 0xEE, 0xBB, 0xB0,
+    0x0B, 0x07, 0x53, 0x47, 0x9D, 0x15, 0xF3, 0x72, 0x10, 0x0B, 0xD4, 0x63, 0x86, 0x40, 0x6E, 0xCD,
+    0x36, 0xC4, 0x49, 0x83, 0x54, 0x2A, 0x64, 0xD4, 0x47, 0x3F, 0xF9, 0xD2, 0xF8, 0x41, 0xD2, 0x69,
+    0x69, 0x02, 0x53, 0xCA, 0x8E, 0x26, 0xB0, 0xD8, 0x4B, 0xD2, 0x49, 0xDC, 0xA1, 0x56, 0x69, 0x4D,
+    0xBA, 0x9D, 0x22, 0x75, 0xE2, 0x82, 0x51, 0x2B, 0x38, 0x44, 0x5A, 0x82, 0xA0, 0x37, 0xDA, 0x5C,
+    0x67, 0x1D, 0xB1, 0x8B, 0x79, 0xDD, 0xA9, 0xAF, 0xE4, 0xED, 0x07, 0x52, 0x24, 0xD1, 0xC7, 0xBF,
+    0x3A, 0x7D, 0x92, 0x77, 0xFE, 0xF7, 0x7F, 0xB3, 0x0D, 0x25, 0xBD, 0xBE, 0xD6, 0xEF, 0xE2, 0xE1,
+    0x8F, 0x5A, 0xB7, 0x31, 0x7D, 0x46, 0xBB, 0x68, 0xC8, 0xCE, 0x06, 0x25, 0xC4, 0xCA, 0xCC, 0x87,
+    0x65, 0xB5, 0x80, 0x76, 0xA7, 0xE0, 0x1D, 0x60, 0x65, 0xE5, 0x0C, 0xCB, 0xBC, 0x93, 0xB4, 0x81,
+    0x55, 0x32, 0x49, 0x91, 0xE3, 0x19, 0xAD, 0x49, 0xAC, 0x5D, 0xED, 0xEE, 0x3C, 0x87, 0xF9, 0x11,
+    0xF4, 0xF3, 0x53, 0x4B, 0xC7, 0xEB, 0x7C, 0xD3, 0x00, 0x5C, 0xC5, 0x4D, 0xE0, 0xEB, 0xCC, 0xA3,
+    0x1B, 0xAC, 0x97, 0xC7, 0x93, 0xB8, 0x68, 0x7C, 0x84, 0xDA, 0x44, 0xAD, 0xAD, 0xD9, 0x6C, 0xE6,
+    0x3B, 0xA7, 0xBD, 0xB0, 0xDF, 0xB2, 0xD6, 0x88, 0xE6, 0x15, 0x9D, 0xA3, 0x40, 0x9E, 0xBF, 0xA1,
+    0x5C, 0xCF, 0xDF, 0x36, 0x6E, 0x9C, 0x4A, 0x30, 0x9B, 0x15, 0xDA, 0x38, 0x95, 0x65, 0x01, 0x67,
+    0x20, 0x21, 0xEE, 0xD2, 0x5C, 0x73, 0xCB, 0x7F, 0x10, 0x40, 0x47, 0x7D, 0xD1, 0x9D, 0x7D, 0x3C,
+    0xA1, 0x08, 0x80, 0x70, 0x4F, 0x69, 0xB2, 0xA7, 0xD0, 0x55, 0xC7, 0x32, 0xB7, 0xEA, 0x51, 0x66,
+    0x51, 0x27, 0xA7, 0xD7, 0x53, 0xC0, 0x88, 0x38, 0x3E, 0xCC, 0x4D, 0xA5, 0x62, 0x57, 0xB0, 0xE5,
+    0xA2, 0x14, 0x6D, 0x5E, 0x6D, 0x67, 0xBA, 0x07, 0x97, 0xE1, 0x25, 0xE0, 0xA6, 0xFE, 0x39, 0xB0,
+    0x78, 0x1A, 0x65, 0xF5, 0x3A, 0x20, 0xB6, 0x81, 0x33, 0xCF, 0x0C, 0xFE, 0x27, 0xCB, 0x49, 0x17,
+    0xDF, 0x3C, 0xF1, 0x79, 0xEA, 0x7D, 0x0F, 0xB5, 0x4C, 0x8B, 0x42, 0xE4, 0x37, 0x72, 0xD0, 0xAE,
+    0xDA, 0xDE, 0xE1, 0xFE, 0x86, 0x5C, 0xFB, 0xFC, 0x08, 0xDA, 0x57, 0xBE, 0x81, 0xBE, 0xCB, 0xDD,
+    0x13, 0x74, 0x51, 0xD2, 0x2A, 0x20, 0x66, 0xE5, 0xE4, 0xCB, 0x2A, 0x4F, 0x10, 0x1D, 0xB2, 0x63,
+    0xE3, 0xB1, 0xB3, 0x89, 0x13, 0x5A, 0x8F, 0xBA, 0x3F, 0x82, 0x09, 0x94, 0xD6, 0x05, 0xB2, 0x8A,
+    0xE1, 0xF9, 0xDB, 0x39, 0x0A, 0x48, 0x88, 0x5A, 0xF9, 0xC2, 0xDD, 0x06, 0xC0, 0x19, 0x9B, 0x53,
+    0x76, 0x25, 0xE0, 0xDA, 0x12, 0xE7, 0xD1, 0x93, 0x17, 0x5C, 0xB2, 0x1C, 0x8B, 0xA9, 0xB1, 0x44,
+    0xEC, 0xD3, 0x60, 0x60, 0xB3, 0x1E, 0xB8, 0x64, 0x45, 0xC9, 0x82, 0x95, 0x6C, 0x51, 0xE0, 0x08,
+    0xFE, 0x61, 0xB6, 0x07, 0x72, 0x65, 0x23, 0x9D, 0x11, 0x95, 0x96, 0xBD, 0xC1, 0x19, 0x2A, 0xF4,
+    0x40, 0x1A, 0x2D, 0x44, 0x4D, 0x3D, 0x15, 0xBF, 0x42, 0x83, 0x66, 0x24, 0x4E, 0xAD, 0xB7, 0x56,
+    0x37, 0x6A, 0xB7, 0x1E, 0x3B, 0x6C, 0x25, 0xD4, 0x1D, 0x51, 0x9E, 0xD2, 0x3A, 0x69, 0xC0, 0xB9,
+    0x0B, 0x28, 0x49, 0x6C, 0x42, 0xAD, 0x92, 0x7E, 0x8F, 0x22, 0x40, 0xA3, 0x62, 0x2D, 0x71, 0xC0,
+    0xF8, 0x02, 0x1F, 0xF1, 0xEF, 0x70, 0xF5, 0x02, 0x49, 0x99, 0x1A, 0x5F, 0x0E, 0xB1, 0xD2, 0xD2,
+    0xE6, 0x90, 0xE2, 0x78, 0x9E, 0x41, 0x48, 0xCC, 0x71, 0x1B, 0x4E, 0xC7, 0xC3, 0x54, 0xD6, 0x21,
+    0x79, 0xC2, 0x49, 0x4E, 0xFB, 0x7C, 0xE6, 0x64, 0xFF, 0x39, 0x39, 0x79, 0x80, 0xAC, 0xCD, 0x4B,
+    0x4F, 0x4E, 0xAA, 0x3B, 0x9C, 0x70, 0x94, 0x63, 0x9E, 0x01, 0x4B, 0x4F, 0x4E, 0x54, 0xF1, 0xDC,
+    0xB1, 0x31, 0x39, 0x79, 0x35, 0x31, 0x4D, 0x4F, 0x4E, 0x76, 0xE4, 0xE4, 0xDE, 0x11, 0x27, 0x15,
+    0xE7, 0x92, 0x69, 0x41, 0x00, 0xE9, 0xC2, 0x10, 0x69, 0xC2, 0xFE, 0xF9, 0x95, 0x98, 0x37, 0xD7,
+    0xAD, 0xD8, 0xAF, 0xE1, 0x68, 0x60, 0x15, 0xDF, 0xE2, 0x25, 0x7B, 0xC8, 0xBA, 0x3B, 0x06, 0x41,
+    0xA4, 0xB4, 0x02, 0xE0, 0x3D, 0xBA, 0x21, 0x7C, 0x8F, 0x3D, 0xF3, 0x86, 0x64, 0x64, 0x03, 0x22,
+    0x7C, 0xEC, 0x31, 0x4C, 0x5E, 0x03, 0xFB, 0x67, 0x68, 0x17, 0xA7, 0xB3, 0x0B, 0x95, 0x3F, 0xCE,
+    0x29, 0xF3, 0xD0, 0x93, 0xF1, 0x3D, 0xB8, 0xA9, 0xFE, 0xFC, 0x54, 0x9D, 0xAD, 0xBD, 0xAD, 0x73,
+    0xBD, 0xD5, 0x99, 0x3A, 0x5C, 0xEA, 0x7C, 0xC5, 0x89, 0xCA, 0x3A, 0xF7, 0xC7, 0x75, 0xEE, 0x6E,
+    0x73, 0x42, 0x22, 0xF3, 0x90, 0xFE, 0x5F, 0xAE, 0x7F, 0x01, 0xAD, 0x55, 0x3D, 0x8F, 0xDD, 0x44,
+    0x14, 0xBD, 0xCF, 0x16, 0xB8, 0x70, 0x61, 0x9A, 0xD0, 0xA4, 0x98, 0x9F, 0xE0, 0x3F, 0x80, 0x76,
+    0x1C, 0x51, 0xD2, 0xBC, 0x82, 0xAD, 0xD2, 0xA4, 0x44, 0x34, 0x5B, 0x53, 0xEC, 0xB3, 0x95, 0x26,
+    0x45, 0x1A, 0x2A, 0xEA, 0xD4, 0x9B, 0x82, 0x96, 0x22, 0xEF, 0xD9, 0x82, 0x22, 0xAD, 0x05, 0xC5,
+    0x96, 0xB1, 0x14, 0x16, 0x09, 0x28, 0x30, 0x92, 0x0B, 0x6F, 0x32, 0x7E, 0xC3, 0x39, 0xF7, 0x7A,
+    0x9F, 0x56, 0x90, 0x12, 0x4B, 0x3B, 0xDE, 0x19, 0xDF, 0x8F, 0x73, 0xCF, 0x3D, 0x77, 0x9E, 0x6C,
+    0x2A, 0x11, 0x09, 0xF8, 0x2B, 0x3A, 0x91, 0x4F, 0x97, 0x2F, 0x25, 0x8D, 0xB1, 0x11, 0x1F, 0x27,
+    0x11, 0x8F, 0xD3, 0x74, 0xC0, 0xB2, 0x13, 0xD7, 0xE7, 0x7D, 0x36, 0xC1, 0x6E, 0x81, 0x9D, 0xAF,
+    0x64, 0x2E, 0x7A, 0x71, 0x9F, 0x4F, 0x92, 0x8C, 0x0B, 0xEC, 0x70, 0x90, 0xC6, 0x1E, 0x76, 0xD8,
+    0x64, 0xD7, 0xA3, 0xC8, 0xAB, 0xB2, 0x81, 0x1D, 0x76, 0x21, 0x1B, 0xC5, 0x35, 0xBE, 0x49, 0xE8,
+    0x5B, 0x4A, 0x3E, 0xA6, 0xA3, 0xF8, 0xA6, 0x46, 0x86, 0xF2, 0x79, 0x9C, 0xB1, 0x8F, 0xB1, 0x4A,
+    0x82, 0xE0, 0xB4, 0x65, 0xBE, 0xB2, 0x93, 0x6C, 0xC8, 0x11, 0xE0, 0x12, 0x87, 0x92, 0xF7, 0x35,
+    0xB1, 0x39, 0x00, 0x2B, 0x5E, 0xE3, 0x70, 0x73, 0x4B, 0x9C, 0x65, 0xC4, 0x92, 0xBC, 0x27, 0x2E,
+    0x26, 0x96, 0xF4, 0x6F, 0x9E, 0xEE, 0xF2, 0x81, 0x0E, 0x84, 0x1C, 0x36, 0x81, 0xD5, 0x00, 0xA1,
+    0xCC, 0x82, 0x08, 0xAE, 0x49, 0x66, 0x01, 0x00, 0x1C, 0xE0, 0x73, 0xCD, 0x64, 0x29, 0x3E, 0xC4,
+    0x2E, 0x99, 0xB1, 0xE4, 0xE3, 0xD7, 0xDF, 0x77, 0x48, 0xE1, 0x1A, 0x9A, 0x3E, 0x82, 0x6B, 0x09,
+    0xCC, 0xE2, 0x99, 0xD5, 0x33, 0x7F, 0xCD, 0xF0, 0x07, 0x2E, 0x61, 0xCF, 0x85, 0x29, 0x66, 0x7C,
+    0xDD, 0xCC, 0x79, 0x8F, 0xB0, 0x8C, 0x36, 0x6E, 0xB4, 0x84, 0x85, 0x6C, 0xE1, 0x73, 0x09, 0x3A,
+    0x06, 0xEC, 0xC1, 0x9B, 0x27, 0xA8, 0x6C, 0x20, 0xC3, 0x97, 0x04, 0x05, 0x97, 0xCD, 0x4C, 0xBA,
+    0x5D, 0x05, 0xBE, 0x93, 0x09, 0x1B, 0x96, 0x0D, 0x87, 0x31, 0x39, 0x5E, 0x5D, 0x1D, 0x41, 0x7C,
+    0x8C, 0x3D, 0x5A, 0x10, 0x03, 0xBC, 0xCD, 0x01, 0xE6, 0x74, 0x68, 0xD4, 0x41, 0xD4, 0xC1, 0x35,
+    0x74, 0x40, 0x8B, 0xCE, 0x98, 0x21, 0xD3, 0x64, 0xED, 0x0B, 0x3A, 0xC4, 0x0C, 0x0E, 0x91, 0xE4,
+    0x30, 0x21, 0xB2, 0x77, 0xB2, 0xF6, 0x57, 0x1B, 0x4C, 0x4A, 0x84, 0xD9, 0xB9, 0x6E, 0xD5, 0x26,
+    0xC8, 0x9E, 0xA7, 0xC1, 0x80, 0x69, 0x06, 0x14, 0x34, 0x5B, 0x02, 0x84, 0xBE, 0x3D, 0x7F, 0xAC,
+    0x80, 0xFA, 0x0C, 0x4B, 0x87, 0xF0, 0x00, 0xD5, 0x19, 0x9C, 0x92, 0x45, 0x28, 0x1A, 0xAD, 0xC1,
+    0x6F, 0x4B, 0xD0, 0x35, 0x02, 0x51, 0x0B, 0x3C, 0xC2, 0xB2, 0x85, 0xF8, 0x2D, 0xB3, 0x2D, 0x0D,
+    0xB3, 0x73, 0x61, 0x27, 0xD1, 0x3C, 0xD4, 0xC9, 0x0A, 0xEC, 0x95, 0x43, 0x12, 0x3B, 0xB3, 0xDC,
+    0xDB, 0xEB, 0x95, 0x59, 0x07, 0x25, 0x55, 0x5F, 0x22, 0xC6, 0x19, 0x91, 0xF2, 0x95, 0x2A, 0x6D,
+    0x54, 0x6D, 0x5C, 0xEC, 0x15, 0x2C, 0x75, 0xB0, 0xE4, 0xAA, 0x05, 0xF5, 0x31, 0xFE, 0x8C, 0x3B,
+    0xA5, 0x80, 0x2F, 0x84, 0xA5, 0x31, 0x31, 0xF4, 0x62, 0xED, 0x92, 0x7F, 0x61, 0x20, 0x49, 0x98,
+    0x09, 0x16, 0x18, 0x7B, 0x1C, 0xB8, 0x3F, 0x5E, 0xC0, 0x33, 0x57, 0x79, 0x59, 0x97, 0x57, 0x7C,
+    0x74, 0xBB, 0x39, 0xBF, 0xA8, 0x14, 0x05, 0x1A, 0x8D, 0x75, 0x5C, 0x29, 0x26, 0x6E, 0x8B, 0xAA,
+    0xBD, 0x5E, 0x21, 0xD1, 0x7B, 0xFF, 0x9F, 0xCF, 0x94, 0x38, 0xFD, 0xEF, 0x8A, 0x51, 0x4D, 0x74,
+    0x5A, 0x14, 0xCB, 0x60, 0x40, 0x8C, 0x97, 0xA8, 0xFA, 0xAC, 0xB7, 0xDE, 0xE8, 0x65, 0x38, 0x5A,
+    0xEC, 0x44, 0xE1, 0x10, 0x61, 0x32, 0x5A, 0xF3, 0x3D, 0xA5, 0x61, 0x09, 0xA3, 0x91, 0xEC, 0x7E,
+    0x6B, 0x07, 0x0B, 0xD1, 0x56, 0x1A, 0x22, 0x0D, 0x16, 0xA2, 0xE8, 0x66, 0x4E, 0x89, 0x2C, 0x20,
+    0x0A, 0x29, 0xF3, 0x9F, 0x27, 0x05, 0x79, 0xF0, 0x9A, 0x23, 0x7F, 0x6B, 0x11, 0xF7, 0x3B, 0x65,
+    0xB2, 0xB8, 0x36, 0x14, 0xC1, 0x3A, 0xEA, 0x54, 0x62, 0x1C, 0x2F, 0x7D, 0xEA, 0xF5, 0x54, 0xE5,
+    0x28, 0x99, 0x1A, 0x7D, 0xF3, 0x38, 0xEA, 0x86, 0xB7, 0x0C, 0x4D, 0xE2, 0xB7, 0xFA, 0xF1, 0x81,
+    0x6D, 0x78, 0xED, 0xE4, 0x28, 0x17, 0x9B, 0xE3, 0xD5, 0xCB, 0x51, 0x53, 0x9E, 0xA9, 0x6A, 0xD9,
+    0x1E, 0xF4, 0x6C, 0xAF, 0x8D, 0x67, 0x5B, 0x80, 0x27, 0x6C, 0x09, 0xD8, 0x81, 0xE5, 0x9D, 0x24,
+    0x54, 0x68, 0x2F, 0xE5, 0xA3, 0x08, 0xD1, 0xA4, 0x63, 0x3A, 0x9B, 0x34, 0xBB, 0xC0, 0x22, 0x02,
+    0xA0, 0xEE, 0xA5, 0xF8, 0x51, 0x3D, 0x43, 0x49, 0xBC, 0xC5, 0x4F, 0x23, 0xD5, 0x68, 0xC0, 0x4D,
+    0x91, 0x4A, 0xA7, 0xB1, 0x09, 0x14, 0x0A, 0x9A, 0xD7, 0x90, 0xA4, 0xDF, 0xC5, 0x4A, 0xDB, 0x40,
+    0x2D, 0x27, 0x36, 0x5C, 0xF7, 0x9E, 0x87, 0xAC, 0xA4, 0x66, 0xAB, 0xDB, 0xDF, 0xA1, 0xD7, 0x96,
+    0xB1, 0xEA, 0x4A, 0x3E, 0x11, 0x5F, 0x25, 0x90, 0x4D, 0x03, 0x8D, 0x17, 0x5D, 0xB2, 0xD4, 0x5F,
+    0x0C, 0x9B, 0x90, 0xBF, 0x9D, 0x64, 0xD9, 0x04, 0xAA, 0xBD, 0xAE, 0xD1, 0x46, 0xF7, 0xA6, 0x29,
+    0xFA, 0xEC, 0x4F, 0x0C, 0x70, 0xF2, 0x8E, 0xE3, 0xB7, 0x1C, 0xF0, 0xC5, 0x97, 0x18, 0xAE, 0xF2,
+    0x19, 0xEE, 0xCA, 0xA2, 0x5F, 0x24, 0x14, 0xA3, 0xEF, 0xCA, 0xE7, 0x63, 0x36, 0x67, 0xEF, 0xD1,
+    0xAC, 0x1B, 0x50, 0x04, 0x86, 0x6E, 0x9F, 0xC8, 0x85, 0xAA, 0xE3, 0x41, 0x1E, 0x4F, 0xFC, 0xE1,
+    0x69, 0x27, 0x62, 0xA9, 0xA4, 0xBC, 0xD9, 0x4A, 0xC6, 0x7A, 0x16, 0xA9, 0x07, 0xD7, 0xB8, 0xF8,
+    0x74, 0x4A, 0x6F, 0x71, 0x77, 0x2D, 0xF9, 0x2F, 0x63, 0xD1, 0x5D, 0xEE, 0x70, 0x7B, 0x5D, 0x0F,
+    0x65, 0x13, 0x76, 0xC9, 0x54, 0xBC, 0x1E, 0xCA, 0xA7, 0x93, 0xDF, 0xCC, 0x35, 0x48, 0xFB, 0xAB,
+    0x73, 0x03, 0x62, 0xB4, 0xF1, 0xF8, 0x84, 0xFA, 0xAD, 0x64, 0xEB, 0xC6, 0x35, 0x74, 0x89, 0xFA,
+    0x13, 0xE6, 0x74, 0xC7, 0x97, 0x93, 0xD4, 0x3D, 0x2A, 0x3C, 0xDE, 0x35, 0x9B, 0x57, 0x26, 0x2F,
+    0xD8, 0x55, 0x02, 0xD4, 0xA7, 0xF1, 0xE8, 0x4F, 0x3A, 0x38, 0x7C, 0x60, 0xA9, 0x4F, 0x26, 0xBE,
+    0xBB, 0x13, 0x4A, 0x7E, 0x3C, 0xFF, 0x81, 0x79, 0xA8, 0xC2, 0xF8, 0xEB, 0x5D, 0x57, 0x14, 0xC4,
+    0x74, 0xB7, 0x6C, 0xB8, 0x5C, 0xF0, 0xAC, 0xED, 0xEE, 0xB7, 0xC2, 0x45, 0xB0, 0x1D, 0xC5, 0xDF,
+    0x7C, 0x45, 0x54, 0xF8, 0x35, 0xD1, 0x5B, 0xC0, 0xE6, 0x9B, 0xFF, 0x12, 0x26, 0x7B, 0xBD, 0xB3,
+    0x41, 0xE1, 0x38, 0x10, 0xB4, 0x1B, 0x1E, 0xA2, 0x3A, 0x14, 0x86, 0x0A, 0x73, 0xE8, 0xD1, 0xC1,
+    0xFA, 0x33, 0x4B, 0x8A, 0xAB, 0xEE, 0x63, 0x54, 0x59, 0xAE, 0x4D, 0x87, 0x42, 0x23, 0x78, 0x8F,
+    0x6F, 0x74, 0xB6, 0x39, 0xAC, 0x94, 0x22, 0xE3, 0xA8, 0x92, 0xD6, 0xC9, 0x3B, 0x1D, 0xEA, 0xBC,
+    0x1E, 0x3E, 0x74, 0xB8, 0x97, 0xD3, 0xD8, 0xDA, 0xE1, 0xB1, 0xB1, 0x6B, 0xD3, 0x33, 0xCE, 0xD9,
+    0x7A, 0x47, 0xE7, 0xF7, 0x83, 0xF3, 0xF0, 0x23, 0xF9, 0x9F, 0x9F, 0x7F, 0x00, 0xC5, 0x55, 0xA1,
+    0x8E, 0xDD, 0x46, 0x14, 0xBD, 0xB6, 0x95, 0x1A, 0x18, 0x0C, 0x69, 0xA4, 0x16, 0xF9, 0x03, 0x0A,
+    0xE6, 0x07, 0x9A, 0x1D, 0x57, 0x01, 0x05, 0x05, 0x29, 0x29, 0x2E, 0x0F, 0x29, 0x0D, 0xC8, 0xFA,
+    0x3D, 0x29, 0x30, 0x20, 0x05, 0x51, 0x69, 0x48, 0x50, 0x42, 0x03, 0x02, 0x76, 0xB2, 0x23, 0x15,
+    0x14, 0xD6, 0x52, 0xD5, 0x16, 0xD6, 0x20, 0x52, 0xA4, 0x84, 0x3C, 0x60, 0x29, 0x4E, 0x35, 0x6F,
+    0x27, 0xE7, 0xDC, 0x19, 0xA7, 0xBB, 0x55, 0x54, 0xDA, 0x27, 0xF9, 0xCE, 0xB3, 0x3D, 0xF7, 0x9E,
+    0x73, 0xEE, 0x9C, 0x19, 0x8B, 0xE4, 0xDF, 0xDD, 0x2E, 0xCA, 0xF9, 0x2C, 0x67, 0xBB, 0xD4, 0xA4,
+    0x55, 0x8E, 0xEF, 0x76, 0xB7, 0x7E, 0x8A, 0x92, 0x82, 0xF1, 0x82, 0x41, 0xCC, 0x22, 0xBE, 0x3A,
+    0x8A, 0xC1, 0x84, 0x3A, 0x4A, 0x1F, 0x24, 0x36, 0x8B, 0xF4, 0x7B, 0x0C, 0x07, 0xB1, 0x43, 0xB5,
+    0xB6, 0xB3, 0x38, 0xA9, 0x97, 0x76, 0xE2, 0x70, 0xE8, 0x82, 0x8C, 0xD2, 0x1C, 0x4C, 0x10, 0x9F,
+    0x87, 0x28, 0xED, 0xCC, 0xD9, 0xD2, 0x4D, 0x76, 0xE0, 0x30, 0x5B, 0xA9, 0x56, 0x69, 0x13, 0x93,
+    0xA4, 0xBE, 0xC8, 0x14, 0x7C, 0x1E, 0xCE, 0xF2, 0x10, 0xF3, 0xB0, 0x6A, 0xAC, 0xF2, 0x80, 0xC9,
+    0x1F, 0xE6, 0xF4, 0xF7, 0x27, 0x14, 0x1F, 0x45, 0x8E, 0xE0, 0xD0, 0x07, 0x87, 0x1B, 0xBC, 0x3E,
+    0x82, 0x55, 0xE1, 0x65, 0xC2, 0x11, 0x13, 0x71, 0xD3, 0xFE, 0x76, 0x10, 0x39, 0x41, 0xF5, 0x3A,
+    0xED, 0x91, 0x87, 0x1B, 0x4C, 0x13, 0xBC, 0x2F, 0x75, 0x41, 0x09, 0xC9, 0xF8, 0xE3, 0x70, 0x35,
+    0x33, 0x02, 0xAA, 0x82, 0x6A, 0x21, 0x81, 0x1B, 0x67, 0xF6, 0x62, 0x6F, 0x12, 0x26, 0x22, 0xCD,
+    0x41, 0x4D, 0x17, 0x08, 0x57, 0xAF, 0x72, 0x8A, 0x39, 0xFD, 0x1E, 0x3A, 0x67, 0x64, 0x47, 0x37,
+    0x88, 0x03, 0xA2, 0xF9, 0x35, 0x48, 0xFD, 0x16, 0x95, 0x76, 0x28, 0xDB, 0x83, 0x74, 0x13, 0x0B,
+    0x28, 0x21, 0x30, 0x41, 0xAB, 0xD7, 0x87, 0x82, 0x70, 0xF9, 0xA1, 0xA0, 0x79, 0xD5, 0xDA, 0x51,
+    0x1B, 0x9A, 0x6A, 0x26, 0x15, 0x87, 0xA0, 0x9D, 0x3A, 0xE2, 0x15, 0x29, 0x53, 0x9E, 0x44, 0x33,
+    0x65, 0x7D, 0x72, 0xCA, 0x02, 0x14, 0x28, 0x96, 0x7A, 0x54, 0x21, 0x5F, 0x5E, 0xFB, 0xFE, 0x77,
+    0xF0, 0x49, 0x29, 0xE4, 0x70, 0x7D, 0xF7, 0xDD, 0x90, 0xC1, 0x54, 0x60, 0x0E, 0x7E, 0xEB, 0x35,
+    0xD0, 0xB0, 0x56, 0xD0, 0x39, 0x38, 0xA9, 0xA2, 0x50, 0x28, 0x50, 0x46, 0xA1, 0x52, 0x3C, 0xB4,
+    0x7B, 0x95, 0x9A, 0xA9, 0x51, 0xAB, 0xF9, 0x19, 0x30, 0x14, 0x2B, 0x11, 0xE9, 0xAA, 0xB6, 0x4B,
+    0x92, 0xE5, 0x8A, 0x0B, 0x59, 0x6F, 0x93, 0x12, 0xF8, 0x13, 0x5C, 0x5E, 0x48, 0x51, 0xCC, 0xBE,
+    0x2B, 0x0B, 0x6D, 0xBE, 0x6A, 0x16, 0xE0, 0x36, 0xB4, 0x90, 0xA0, 0x81, 0xA3, 0x2E, 0x73, 0x14,
+    0x20, 0xD6, 0x0B, 0x98, 0x80, 0x19, 0x53, 0x74, 0x39, 0xC5, 0x7E, 0xC3, 0xF9, 0x27, 0x4A, 0x3D,
+    0xB1, 0x5A, 0x45, 0x4C, 0x69, 0xD4, 0x18, 0x8E, 0x6B, 0x57, 0x13, 0x4C, 0xFA, 0x47, 0x03, 0x75,
+    0x9D, 0x28, 0x1E, 0xE5, 0xF9, 0x6A, 0x61, 0x25, 0x36, 0x6E, 0x47, 0x0A, 0xEC, 0xEB, 0x9E, 0x70,
+    0xEE, 0x31, 0x56, 0x51, 0xD2, 0x04, 0x53, 0xE7, 0x5A, 0xD9, 0x79, 0xEA, 0x03, 0x5D, 0x95, 0xD2,
+    0x23, 0xE5, 0x9E, 0xC9, 0xCB, 0xA7, 0xDA, 0x3D, 0xD0, 0x24, 0xCB, 0x8A, 0x24, 0xD5, 0xE6, 0xDD,
+    0x84, 0x54, 0xF3, 0x00, 0x0C, 0xAD, 0xDF, 0xE8, 0xB0, 0x64, 0x4B, 0xA1, 0x0E, 0xF9, 0x0D, 0xBB,
+    0x64, 0x6F, 0xC1, 0x1C, 0x6B, 0x3F, 0xA8, 0x69, 0x91, 0xFA, 0xE2, 0x5B, 0xA4, 0x26, 0xA8, 0xD3,
+    0x7D, 0x40, 0x9A, 0xF4, 0x40, 0x59, 0xA8, 0xB2, 0x32, 0xD9, 0xA4, 0xF8, 0xED, 0x52, 0x4A, 0x43,
+    0x3C, 0xD7, 0x88, 0x90, 0xD0, 0x43, 0x74, 0x10, 0x4C, 0xB2, 0xA4, 0x0F, 0x11, 0x39, 0x74, 0xFE,
+    0xCC, 0xBC, 0x8E, 0xBB, 0x92, 0x0F, 0x73, 0x1C, 0x55, 0x96, 0xD7, 0x92, 0x5E, 0x3B, 0x1E, 0x15,
+    0x4C, 0x23, 0xD7, 0x24, 0x2F, 0x80, 0xD7, 0x3D, 0x11, 0xAF, 0xC4, 0xF6, 0xEF, 0x27, 0x4F, 0x2F,
+    0xF6, 0x1D, 0x81, 0x83, 0xD1, 0x58, 0x16, 0x8F, 0xAD, 0x52, 0x82, 0x99, 0xA6, 0x52, 0x2F, 0x71,
+    0x2C, 0x5B, 0x16, 0x16, 0x9C, 0x4F, 0x40, 0x7F, 0x1E, 0x6F, 0x9F, 0xBF, 0xFE, 0xD1, 0x67, 0xC4,
+    0x12, 0x80, 0x3A, 0x52, 0xB9, 0x67, 0x97, 0x15, 0x8C, 0x81, 0xDA, 0x66, 0x3C, 0x35, 0x13, 0xF8,
+    0xD8, 0x80, 0x57, 0xBB, 0x00, 0x47, 0xA4, 0x50, 0x1D, 0xBB, 0xBF, 0xD0, 0xB2, 0x64, 0x90, 0xBB,
+    0xB6, 0x30, 0xA5, 0x4A, 0xC8, 0x7E, 0xD2, 0x23, 0x42, 0x77, 0xB3, 0x06, 0xED, 0x9D, 0xFE, 0xAF,
+    0x16, 0x5D, 0x21, 0xEE, 0x66, 0xF5, 0x97, 0x36, 0x09, 0xF8, 0xF6, 0x2B, 0xE4, 0x9E, 0xA9, 0xFB,
+    0x41, 0x5E, 0xCD, 0x32, 0x62, 0x7A, 0xCD, 0xE9, 0xD8, 0xEB, 0xFB, 0x4F, 0x92, 0xA0, 0xDD, 0x38,
+    0x1C, 0xD3, 0x9B, 0x59, 0x6E, 0x3F, 0x56, 0x81, 0x71, 0x2B, 0xAF, 0xFE, 0xF0, 0x1B, 0xAC, 0x79,
+    0x4D, 0x9D, 0x2B, 0x4D, 0x49, 0x97, 0xDA, 0x6D, 0x01, 0xD5, 0x4B, 0xDA, 0x1F, 0xBF, 0x25, 0xE6,
+    0xB6, 0x9D, 0x72, 0x21, 0x78, 0x22, 0xEA, 0xD9, 0x01, 0x01, 0x38, 0x36, 0x71, 0xB5, 0xCB, 0x28,
+    0xE6, 0xB0, 0xC3, 0xE9, 0xE1, 0xDE, 0xBC, 0x9D, 0xFB, 0xF4, 0xCB, 0x54, 0xBF, 0xEB, 0x42, 0x36,
+    0x1F, 0x2F, 0xA2, 0xDA, 0x87, 0x19, 0xCA, 0x2D, 0xB9, 0xE2, 0x76, 0x51, 0x30, 0xF7, 0x54, 0x36,
+    0xEA, 0x7F, 0xEA, 0x5E, 0x55, 0xF7, 0x67, 0xD4, 0x0D, 0xF7, 0xC6, 0x36, 0x40, 0xB7, 0xA5, 0xEE,
+    0xE7, 0xD0, 0x7D, 0xEF, 0x8F, 0xCB, 0xBA, 0xBF, 0x58, 0xD8, 0x9B, 0x01, 0x62, 0x6E, 0x10, 0xE4,
+    0x40, 0x6F, 0x05, 0x88, 0xF9, 0x3C, 0xEB, 0xBE, 0xB4, 0xA3, 0x3F, 0xAA, 0xAA, 0xBB, 0xB7, 0x8E,
+    0xE6, 0xEB, 0x65, 0x34, 0x50, 0x65, 0xDC, 0xC1, 0xA5, 0xA2, 0xEA, 0x02, 0xAA, 0xBE, 0x44, 0xF6,
+    0x5D, 0x5C, 0x77, 0x90, 0xF5, 0xCC, 0x96, 0x03, 0xCA, 0x15, 0x27, 0xFD, 0xD3, 0xE8, 0x50, 0xAC,
+    0xF4, 0x6F, 0xC0, 0x6B, 0x0F, 0xA5, 0x7B, 0x95, 0x8E, 0x62, 0x13, 0x42, 0x7A, 0xD9, 0xF2, 0x68,
+    0x6C, 0xC8, 0xCF, 0x90, 0x9F, 0x63, 0x03, 0x56, 0x6D, 0xC0, 0x26, 0x39, 0xEA, 0xD9, 0xEA, 0xD8,
+    0x45, 0x54, 0xF7, 0xBA, 0xF0, 0x3A, 0x9D, 0x36, 0xCA, 0x88, 0x57, 0xBE, 0x0C, 0xF5, 0xD5, 0x2F,
+    0x43, 0x77, 0x21, 0xDD, 0x9F, 0xFA, 0x85, 0xFC, 0x21, 0xC0, 0x7F, 0x1E, 0x1B, 0xBC, 0x9B, 0xFA,
+    0x49, 0x7C, 0xAD, 0x9F, 0x86, 0xA1, 0x7C, 0x7A, 0x60, 0xE7, 0x15, 0x5F, 0x43, 0x3B, 0x9C, 0xE5,
+    0xA3, 0xC1, 0x6D, 0xDF, 0xC0, 0x53, 0x08, 0xC0, 0x57, 0x50, 0xCA, 0x3C, 0xF9, 0xBF, 0x7F, 0xEF,
+    0x01, 0xCD, 0x55, 0xB1, 0x8E, 0xD4, 0x48, 0x10, 0x2D, 0xBB, 0xB5, 0x72, 0xE0, 0xA0, 0x13, 0xD0,
+    0x85, 0xFE, 0x00, 0x24, 0x3A, 0x26, 0xD9, 0xEE, 0xD3, 0xFD, 0x00, 0xC1, 0x01, 0x01, 0x01, 0x9F,
+    0x30, 0x3F, 0xC0, 0x8C, 0x4D, 0x44, 0x4A, 0x42, 0x4E, 0x4C, 0x42, 0x7E, 0x62, 0x76, 0x7C, 0x97,
+    0x92, 0x58, 0x7C, 0x81, 0x83, 0x85, 0xD8, 0x81, 0x91, 0xBC, 0xA8, 0x3D, 0xCD, 0x7B, 0xD5, 0xB3,
+    0xCB, 0x22, 0x44, 0x88, 0x74, 0xD6, 0x6E, 0x79, 0x77, 0xBA, 0xBB, 0xEA, 0xBD, 0xD7, 0xAF, 0x6A,
+    0x44, 0x4E, 0x4F, 0x7B, 0x0C, 0x22, 0x55, 0x4A, 0xA3, 0x88, 0xFB, 0xFA, 0x6E, 0x11, 0x49, 0x5D,
+    0x19, 0x05, 0x3F, 0xB2, 0x4A, 0x35, 0x31, 0xDA, 0x41, 0x24, 0x3E, 0x77, 0x9D, 0x14, 0x31, 0x7A,
+    0xEC, 0x5D, 0x62, 0x2B, 0xB2, 0x99, 0xD6, 0x8B, 0x47, 0xEF, 0x52, 0x7F, 0x48, 0x29, 0xAD, 0xE2,
+    0x52, 0x62, 0x9A, 0xA8, 0x19, 0x7F, 0x15, 0x8F, 0xB9, 0x9E, 0x46, 0xDF, 0xCB, 0x99, 0x48, 0x73,
+    0xF5, 0xF8, 0xA8, 0xC5, 0x57, 0x7C, 0x74, 0x48, 0x97, 0x88, 0xC5, 0x43, 0xB9, 0x41, 0x86, 0x4F,
+    0x6B, 0x2E, 0xA5, 0x27, 0x51, 0xEA, 0xC9, 0x4C, 0x0F, 0xBD, 0xD8, 0x0F, 0xFF, 0xCD, 0xE2, 0x9D,
+    0xED, 0xCD, 0xBC, 0x5E, 0x9C, 0xA5, 0x17, 0xA8, 0x3E, 0x97, 0x29, 0x5D, 0x21, 0x63, 0x38, 0x15,
+    0x32, 0x00, 0xAD, 0x98, 0xC5, 0xF5, 0xAC, 0x34, 0x38, 0xA4, 0x4A, 0x58, 0xF1, 0xA9, 0x13, 0x39,
+    0x0B, 0x22, 0xFF, 0x53, 0xEA, 0xF5, 0xC8, 0x65, 0xDB, 0xDF, 0x8A, 0x1D, 0x63, 0xA3, 0xD1, 0xDD,
+    0x02, 0xFE, 0xFB, 0xE4, 0x71, 0x3F, 0x6C, 0xD3, 0xCA, 0x7B, 0xFC, 0x96, 0xD3, 0x75, 0x55, 0x97,
+    0x06, 0x83, 0xA2, 0xE5, 0x95, 0xEE, 0xE5, 0x2E, 0xEA, 0x02, 0xE4, 0x5B, 0xA0, 0xE9, 0xF5, 0x2C,
+    0xB0, 0x17, 0xCB, 0xED, 0x65, 0xBE, 0x76, 0x58, 0x1E, 0xAE, 0x97, 0x85, 0xCB, 0x1D, 0xCA, 0x76,
+    0x75, 0x52, 0x81, 0xCA, 0x57, 0xA5, 0x92, 0x34, 0x63, 0xAD, 0xC4, 0xCD, 0x97, 0x4D, 0xA6, 0x9B,
+    0xB2, 0x72, 0x72, 0xEF, 0x8D, 0xFC, 0xFC, 0x98, 0x41, 0x1C, 0x6F, 0x09, 0xF9, 0xBD, 0x98, 0x45,
+    0x0A, 0x70, 0x57, 0x15, 0x23, 0xCA, 0x91, 0xDD, 0x7B, 0x80, 0xA7, 0xE8, 0xE7, 0x12, 0x0B, 0xD6,
+    0x71, 0x12, 0xCD, 0xAC, 0xBC, 0x16, 0x55, 0xC0, 0xFE, 0xBB, 0x78, 0xD6, 0xAD, 0x3E, 0xCE, 0x17,
+    0x9A, 0x30, 0x65, 0x38, 0x78, 0x2B, 0x61, 0x7B, 0x7A, 0xFB, 0x97, 0x1F, 0x79, 0x4C, 0x0E, 0x75,
+    0xCF, 0xF5, 0x32, 0x5A, 0x7D, 0x57, 0x93, 0xED, 0x77, 0xAA, 0x66, 0xD3, 0x79, 0x6E, 0x0B, 0x2E,
+    0x50, 0xC0, 0x23, 0x0A, 0x81, 0x25, 0x8C, 0xE4, 0xF9, 0xAE, 0x27, 0x00, 0x80, 0x44, 0x4D, 0x0F,
+    0x58, 0xC0, 0xDA, 0x06, 0xC0, 0x2A, 0x35, 0x61, 0x23, 0xF7, 0x95, 0xC9, 0x73, 0x2A, 0x42, 0xE5,
+    0x1B, 0xA5, 0x5F, 0x66, 0x18, 0x52, 0x5C, 0x84, 0x9F, 0x59, 0xFB, 0x91, 0xE9, 0x56, 0x81, 0x6D,
+    0x17, 0x49, 0x73, 0xF1, 0x6C, 0xA8, 0x06, 0xFB, 0xA5, 0x43, 0x7A, 0x27, 0x64, 0xE1, 0x41, 0x92,
+    0xA8, 0xDF, 0x9B, 0xC9, 0xE9, 0xD5, 0xD9, 0x8E, 0xD9, 0xEA, 0x61, 0xCB, 0x6B, 0xC2, 0x35, 0xA7,
+    0xC4, 0xAC, 0x29, 0x73, 0x35, 0x9F, 0xDA, 0x27, 0xDC, 0xED, 0xFE, 0x5C, 0xD4, 0x73, 0xB1, 0x1A,
+    0x48, 0xA5, 0x1A, 0x9D, 0xDA, 0x00, 0xC9, 0x80, 0xB4, 0xA8, 0x66, 0x33, 0x56, 0x33, 0xF4, 0x08,
+    0x4D, 0xA8, 0x53, 0x68, 0x67, 0x48, 0x5B, 0xAF, 0x72, 0x47, 0x41, 0x06, 0xBD, 0x6B, 0x1F, 0x70,
+    0xDE, 0x07, 0xDE, 0x45, 0xC0, 0xF5, 0xC3, 0x6F, 0x5B, 0x06, 0x17, 0x10, 0x6C, 0xEF, 0x69, 0x06,
+    0x84, 0x62, 0xA1, 0x11, 0xF7, 0x54, 0xDD, 0xB5, 0x1D, 0x15, 0xBE, 0x54, 0xB9, 0x47, 0x29, 0x00,
+    0x48, 0x40, 0xA0, 0xE1, 0x65, 0x42, 0x42, 0x64, 0x6B, 0x7A, 0x33, 0xE2, 0x18, 0xCD, 0xB4, 0xD2,
+    0x86, 0xC8, 0x45, 0x1E, 0x58, 0x31, 0x33, 0xB9, 0xAC, 0xB8, 0x70, 0x6E, 0x16, 0x51, 0xD9, 0xEC,
+    0xA8, 0x77, 0xC2, 0x40, 0x35, 0x2B, 0xB4, 0xF2, 0xEB, 0x4D, 0x64, 0x77, 0xE1, 0xDF, 0x46, 0x5B,
+    0xEC, 0xAE, 0x2A, 0xB8, 0xC5, 0xFE, 0x7A, 0xC0, 0x4E, 0xBA, 0x02, 0xD8, 0xE0, 0x47, 0x56, 0xFB,
+    0x6B, 0x82, 0x58, 0x6C, 0x04, 0x5A, 0x96, 0x3D, 0xD3, 0xE2, 0x60, 0x75, 0xB9, 0x99, 0x40, 0x96,
+    0xEC, 0xB0, 0x99, 0xDB, 0xD1, 0x14, 0xD4, 0xC4, 0x42, 0x6E, 0x55, 0x9A, 0xB2, 0x65, 0x77, 0x75,
+    0xA7, 0xB6, 0x39, 0xE4, 0xE6, 0x7A, 0xB0, 0x99, 0x85, 0xBD, 0x22, 0xEE, 0xF8, 0xFD, 0xF6, 0x12,
+    0x1D, 0x5D, 0x68, 0x2C, 0xB5, 0xF9, 0x71, 0x22, 0xD2, 0xF8, 0x8C, 0xD5, 0x40, 0xAE, 0xB6, 0xA7,
+    0x39, 0xD0, 0xC3, 0x13, 0x9D, 0xCA, 0xE8, 0x42, 0xEE, 0x24, 0x92, 0xF6, 0xDA, 0x47, 0x3B, 0x2D,
+    0x1B, 0xBF, 0x47, 0x1C, 0x04, 0x30, 0xB8, 0x3B, 0xB7, 0x9D, 0xD7, 0x71, 0xE2, 0xB5, 0xDB, 0x76,
+    0x0A, 0x6D, 0x2F, 0x77, 0xA1, 0xEF, 0xE1, 0x8D, 0xE7, 0xC4, 0x18, 0x3D, 0x2A, 0xA4, 0xE1, 0x4C,
+    0x72, 0xD3, 0xA2, 0x8E, 0x1A, 0x4D, 0xB5, 0xD4, 0x86, 0x3F, 0x0D, 0x2E, 0xB3, 0xFC, 0xE8, 0xBD,
+    0xE2, 0x40, 0x7C, 0x3A, 0x2D, 0x3E, 0xE3, 0xAF, 0x96, 0x17, 0x10, 0x31, 0x1C, 0x8A, 0xC5, 0x50,
+    0x3C, 0x04, 0x33, 0x01, 0x64, 0x35, 0x00, 0xA3, 0xED, 0x51, 0xDB, 0x76, 0x08, 0x2E, 0x60, 0x90,
+    0x79, 0xE2, 0xDB, 0x11, 0x1E, 0xDB, 0xE2, 0x0F, 0x38, 0xE4, 0xEF, 0x16, 0xBD, 0x30, 0xC1, 0x05,
+    0x87, 0x29, 0x37, 0xF3, 0x09, 0x8C, 0x0D, 0xDA, 0xAA, 0xDA, 0xB7, 0xF4, 0xF1, 0xF5, 0xE4, 0x01,
+    0xB1, 0x31, 0x8F, 0x12, 0xB5, 0x41, 0xA5, 0x8D, 0xBE, 0x25, 0x45, 0x54, 0x03, 0xFF, 0x48, 0x1A,
+    0xEC, 0xBB, 0x99, 0x2A, 0xFA, 0xAC, 0x44, 0x79, 0x7C, 0xFB, 0xF6, 0xA8, 0xA6, 0xC7, 0xDC, 0xA2,
+    0xE5, 0x77, 0xA7, 0x03, 0x12, 0xF5, 0x40, 0xA7, 0x07, 0x44, 0x0F, 0x50, 0xC0, 0x89, 0xDA, 0x9F,
+    0xE7, 0xA1, 0xC6, 0x62, 0xFB, 0x7C, 0xA0, 0x1A, 0x4E, 0x8A, 0xE8, 0x48, 0xD4, 0x21, 0x92, 0xC7,
+    0xB9, 0xCE, 0x11, 0xFA, 0xED, 0x9F, 0xA7, 0x89, 0xF3, 0x98, 0x43, 0xB4, 0x4D, 0xAF, 0x6E, 0x79,
+    0x0D, 0xE7, 0xF6, 0x9C, 0x78, 0x31, 0x63, 0xD4, 0x62, 0x6A, 0x6A, 0xAD, 0x85, 0x2A, 0x57, 0x8F,
+    0x9E, 0x2A, 0xB6, 0x01, 0xDF, 0x06, 0x89, 0x95, 0x80, 0xAF, 0xCF, 0xC8, 0x9C, 0x36, 0x15, 0x8B,
+    0x2A, 0x1D, 0x4F, 0x59, 0x94, 0xFE, 0xFE, 0xE6, 0x8A, 0x74, 0x20, 0x2D, 0x37, 0x83, 0x1D, 0xA2,
+    0x7C, 0x3A, 0xF4, 0xF4, 0x19, 0x8D, 0xB8, 0xC8, 0xAF, 0x9E, 0x6F, 0xB5, 0x55, 0xB1, 0x8E, 0xE4,
+    0x44, 0x10, 0xAD, 0x76, 0xC3, 0x5A, 0x3A, 0x07, 0x1D, 0x11, 0x11, 0xF8, 0x0B, 0x90, 0x7F, 0xE0,
+    0x66, 0x6C, 0x2E, 0x25, 0x80, 0x84, 0xE8, 0x02, 0x72, 0x24, 0x74, 0x3F, 0xB0, 0x63, 0x5B, 0x97,
+    0x10, 0xB2, 0x01, 0x1F, 0xB0, 0x01, 0xD1, 0x5C, 0x70, 0x7C, 0xC0, 0xEC, 0x4E, 0x5F, 0x44, 0x40,
+    0xB0, 0x06, 0x84, 0x08, 0xD7, 0xD2, 0x11, 0x71, 0x49, 0x0B, 0x7C, 0x5A, 0xEF, 0xD1, 0x33, 0xCD,
+    0x7B, 0xDD, 0x33, 0xBB, 0xBA, 0x23, 0x22, 0xA0, 0x25, 0xB7, 0xA7, 0xC7, 0x5D, 0x55, 0xAF, 0x5E,
+    0xD7, 0xAB, 0x96, 0xAA, 0x11, 0x3D, 0x6A, 0x27, 0xD2, 0x4A, 0x2D, 0x52, 0x0C, 0xF9, 0x28, 0xE2,
+    0x65, 0x25, 0x62, 0x6C, 0x31, 0x88, 0x9A, 0xB1, 0x90, 0xB2, 0x31, 0x56, 0xB2, 0x09, 0x0B, 0xEC,
+    0xA1, 0x81, 0xCB, 0xF6, 0xEB, 0xF5, 0x5E, 0xEA, 0x10, 0xC2, 0xA0, 0x31, 0x79, 0x58, 0x27, 0x03,
+    0x6C, 0xA7, 0x41, 0x1F, 0x0D, 0x24, 0x1A, 0x94, 0x3D, 0x0D, 0x26, 0x91, 0x25, 0x23, 0xE4, 0x31,
+    0xD8, 0xF6, 0x9C, 0x06, 0x21, 0x87, 0x41, 0xC0, 0x23, 0xB2, 0xE1, 0x64, 0x1A, 0x4C, 0xFC, 0x4C,
+    0x34, 0x5C, 0x5B, 0x4C, 0xD9, 0xCC, 0x9F, 0x1F, 0xE0, 0x59, 0xD1, 0xFB, 0x85, 0x08, 0x31, 0x45,
+    0x60, 0x31, 0x82, 0x76, 0x6A, 0x4E, 0x01, 0xE0, 0xFA, 0xF6, 0xF3, 0xC7, 0x11, 0xD0, 0x90, 0x63,
+    0xB2, 0x70, 0x0F, 0x50, 0x36, 0xC1, 0xA9, 0x98, 0x44, 0x44, 0x13, 0x73, 0xA8, 0x3F, 0xAB, 0x44,
+    0x3A, 0x07, 0x44, 0xDB, 0x91, 0x51, 0x89, 0xA2, 0xB0, 0x47, 0x10, 0x15, 0x63, 0x2E, 0x39, 0x79,
+    0x89, 0x03, 0xA8, 0xD4, 0x04, 0x07, 0xC5, 0x00, 0x64, 0x35, 0xB3, 0xF1, 0x58, 0xE5, 0x23, 0xEC,
+    0xAB, 0x8F, 0x81, 0xD0, 0x83, 0x37, 0xED, 0xE0, 0xD7, 0x58, 0x58, 0xB4, 0xD8, 0x9E, 0x71, 0xBB,
+    0xB1, 0x75, 0x7F, 0x12, 0x64, 0x4B, 0x8A, 0xB6, 0xE1, 0xD5, 0x28, 0x5F, 0x7E, 0x57, 0x35, 0x07,
+    0xAF, 0x31, 0x51, 0xC0, 0x11, 0xE6, 0xC4, 0x5C, 0x44, 0x3D, 0xB7, 0x64, 0x05, 0xAB, 0x1A, 0x2E,
+    0x49, 0xB7, 0x90, 0xA1, 0x84, 0x26, 0x9A, 0x10, 0x6A, 0xD9, 0x24, 0x48, 0xFC, 0xB1, 0x41, 0x7C,
+    0x9F, 0x1E, 0x35, 0xB7, 0x70, 0x72, 0x01, 0xB7, 0x1B, 0x29, 0xDC, 0x4E, 0x4A, 0x77, 0x89, 0xD4,
+    0xBA, 0x57, 0x7F, 0x0F, 0x55, 0xB8, 0xB2, 0x27, 0xB7, 0x24, 0x93, 0xD1, 0xF8, 0x00, 0x83, 0xEA,
+    0x90, 0x2F, 0x42, 0x99, 0x7D, 0xE2, 0xF9, 0xF8, 0x99, 0xF0, 0x6A, 0x49, 0x0F, 0x47, 0x05, 0x00,
+    0x85, 0x97, 0x1A, 0x91, 0x0D, 0x5E, 0xC0, 0x5C, 0xCD, 0xE0, 0x0D, 0x1B, 0x26, 0xB9, 0xC4, 0x6B,
+    0xEF, 0x64, 0x07, 0x6E, 0x6E, 0x9C, 0xF8, 0x49, 0xF4, 0x5F, 0x4E, 0x66, 0x1C, 0xC4, 0x6F, 0xA3,
+    0x9A, 0x66, 0x31, 0x3F, 0x0E, 0x99, 0x9B, 0xA5, 0x2C, 0xAC, 0x76, 0x5E, 0x96, 0xC6, 0x12, 0xDA,
+    0x06, 0xAF, 0x71, 0x23, 0x73, 0xD9, 0xE7, 0xC3, 0x69, 0x06, 0xC6, 0x0A, 0xBB, 0xD2, 0x43, 0x8D,
+    0xF8, 0x0B, 0x90, 0x25, 0xA6, 0x5F, 0x94, 0xCD, 0x12, 0x48, 0x96, 0x35, 0x6A, 0xA0, 0x6A, 0x96,
+    0x2B, 0xB0, 0x53, 0x31, 0xA6, 0xE7, 0xB9, 0x21, 0x0A, 0x8E, 0xA5, 0x1C, 0xD5, 0xFE, 0x6C, 0x25,
+    0xA5, 0x55, 0xC1, 0x6E, 0x60, 0x92, 0x85, 0xFE, 0x48, 0x88, 0xDC, 0x43, 0xBF, 0x48, 0xAF, 0x74,
+    0x80, 0x7A, 0x8A, 0xAF, 0xDC, 0xC9, 0x71, 0x74, 0x38, 0xAB, 0x29, 0x43, 0xF6, 0x9D, 0x45, 0x62,
+    0x3A, 0xC8, 0xD2, 0x31, 0xCC, 0x8D, 0x95, 0x9B, 0x21, 0xBF, 0x92, 0xE2, 0xBA, 0xA9, 0x16, 0xB2,
+    0x00, 0xD2, 0x49, 0xBF, 0x74, 0xFA, 0xE7, 0xB1, 0x34, 0xBD, 0xF9, 0xC4, 0xCE, 0x0B, 0x39, 0x2D,
+    0xF3, 0x17, 0x2E, 0x73, 0xA7, 0xCB, 0xC2, 0x9A, 0xFE, 0x4F, 0x54, 0xD0, 0x42, 0x5F, 0x37, 0xB3,
+    0x72, 0xC6, 0xE7, 0x43, 0x61, 0xAB, 0xA1, 0xFC, 0xB6, 0x12, 0x50, 0x3F, 0xE0, 0x2F, 0x1D, 0x62,
+    0xA8, 0x58, 0xC1, 0xB9, 0xBD, 0xAB, 0x29, 0xE5, 0xEE, 0xAA, 0xFB, 0x88, 0x12, 0xB4, 0x52, 0x4A,
+    0x3B, 0xC9, 0x6E, 0x25, 0x49, 0x4C, 0x92, 0x5A, 0x62, 0xD9, 0xB3, 0x30, 0x7D, 0xB4, 0x60, 0x51,
+    0xDC, 0x7F, 0x4E, 0xBA, 0x95, 0xA4, 0xBB, 0xE8, 0x90, 0x9F, 0x7B, 0xE9, 0x42, 0x5F, 0x04, 0x26,
+    0xFE, 0xA0, 0x7F, 0xD0, 0x48, 0xE6, 0x58, 0x45, 0xED, 0x63, 0xC7, 0xE2, 0x62, 0xE8, 0x27, 0x67,
+    0xF2, 0xD6, 0x88, 0x14, 0x6D, 0x49, 0x5E, 0x3D, 0x1C, 0x8A, 0x4F, 0x4A, 0x2A, 0xD0, 0x5C, 0xC1,
+    0x65, 0xFE, 0xD2, 0x49, 0xAC, 0x2A, 0x04, 0x67, 0x25, 0x7A, 0x86, 0xBB, 0x50, 0x13, 0x11, 0xB4,
+    0x44, 0x63, 0x7A, 0xE1, 0xD9, 0xA2, 0x9C, 0x10, 0x93, 0xC2, 0x13, 0xFD, 0x66, 0xFD, 0xDC, 0xAA,
+    0x28, 0x50, 0xCF, 0x14, 0x5B, 0xD6, 0x56, 0x4C, 0x07, 0xE0, 0xA2, 0x72, 0xA4, 0x2E, 0xC6, 0x88,
+    0x38, 0xB7, 0x45, 0x2F, 0xA7, 0x51, 0xC7, 0x1D, 0x49, 0xB0, 0xEF, 0xC0, 0xDB, 0x8E, 0x0F, 0xD1,
+    0x67, 0x7E, 0xB0, 0xE6, 0x75, 0xEB, 0xF5, 0x2C, 0xA1, 0xDF, 0x4A, 0x4E, 0x65, 0xD5, 0x51, 0xF5,
+    0x35, 0x84, 0x8C, 0xC8, 0x51, 0x87, 0x17, 0x20, 0xCB, 0xD8, 0x56, 0x14, 0xB5, 0x58, 0xF7, 0xAD,
+    0x14, 0x13, 0xDA, 0x42, 0x68, 0xEA, 0x17, 0x7B, 0xA7, 0xC2, 0xBE, 0x02, 0xB4, 0x47, 0xA3, 0xA8,
+    0xE4, 0xB6, 0x79, 0x8F, 0x39, 0xD5, 0x87, 0x29, 0x1B, 0x3E, 0x92, 0x7F, 0x8D, 0xFA, 0x8E, 0x95,
+    0x80, 0x49, 0xB3, 0xC6, 0xF2, 0xEB, 0xFE, 0x40, 0x4A, 0xF9, 0x4D, 0xCC, 0x01, 0x53, 0x1B, 0x0F,
+    0x07, 0x9C, 0x64, 0x13, 0x68, 0xD6, 0x0E, 0xC1, 0x8B, 0x41, 0x8F, 0x89, 0x92, 0x2A, 0x80, 0xF0,
+    0x8E, 0xD3, 0x7E, 0xFD, 0xCC, 0x45, 0x46, 0x62, 0x6B, 0xC0, 0x26, 0x35, 0xC7, 0xE3, 0x8C, 0x84,
+    0x30, 0x94, 0xBF, 0x4C, 0x27, 0x41, 0x64, 0x4B, 0xD8, 0xE7, 0x23, 0x58, 0x7B, 0xA8, 0xED, 0x3B,
+    0xA8, 0xFE, 0x27, 0x3E, 0x32, 0x1C, 0xDB, 0x1C, 0xAB, 0x30, 0x04, 0x36, 0x19, 0xBC, 0x98, 0xB5,
+    0xF9, 0x25, 0x09, 0xA6, 0x4D, 0xC5, 0xAA, 0x5D, 0x9B, 0x6A, 0xF5, 0x51, 0x94, 0x93, 0xF2, 0xE9,
+    0x6F, 0x0A, 0x97, 0xE3, 0x52, 0xA5, 0x4A, 0x77, 0xC5, 0x9B, 0xF5, 0x39, 0xE8, 0x69, 0xE0, 0xCD,
+    0xB2, 0x81, 0x87, 0x10, 0xBB, 0x4C, 0x6A, 0xED, 0xF0, 0x4C, 0xB9, 0xA2, 0x50, 0x76, 0x91, 0xE6,
+    0xF5, 0x33, 0x3A, 0x43, 0x2E, 0xD1, 0x59, 0x69, 0x13, 0xF1, 0xBB, 0xD4, 0xFF, 0x8A, 0x31, 0x56,
+    0xB7, 0x74, 0xDC, 0xB8, 0xEE, 0x29, 0x63, 0x16, 0x58, 0x65, 0x71, 0x20, 0xC1, 0xDF, 0xB3, 0x32,
+    0x7C, 0x8F, 0x36, 0xDE, 0x85, 0x4F, 0xBB, 0x40, 0x66, 0xC2, 0xAF, 0x3B, 0x3D, 0xAB, 0x30, 0xE6,
+    0xE3, 0x56, 0xCC, 0x1C, 0xD1, 0x07, 0x29, 0x7E, 0x42, 0x88, 0x41, 0x79, 0x70, 0xE4, 0x4F, 0x02,
+    0xB0, 0x18, 0xA0, 0x43, 0xDF, 0x0C, 0xE1, 0x0C, 0x04, 0x55, 0x67, 0x94, 0x12, 0xFD, 0x63, 0xB1,
+    0xED, 0xB9, 0x28, 0x3D, 0x33, 0xCE, 0x79, 0x41, 0xD5, 0x4F, 0x6F, 0x42, 0xFF, 0x95, 0x0A, 0xBE,
+    0xE5, 0xDD, 0xB2, 0xCF, 0xBF, 0x0E, 0x93, 0xBC, 0x0F, 0x02, 0x40, 0x91, 0x3A, 0xCF, 0xCE, 0xA5,
+    0x84, 0xB0, 0xD5, 0xEE, 0x0B, 0xDC, 0x0F, 0x14, 0xD8, 0x87, 0xBF, 0xDF, 0x9F, 0x57, 0xC6, 0x34,
+    0x71, 0x51, 0x5A, 0x7D, 0xB8, 0x26, 0x53, 0x3E, 0x9B, 0x63, 0x03, 0xF0, 0x87, 0x4B, 0x80, 0xFD,
+    0x5F, 0xEA, 0x3F, 0xD6, 0x0D, 0xF6, 0x4D, 0x34, 0x68, 0xA8, 0xFD, 0xD8, 0x1E, 0xDE, 0xDA, 0x47,
+    0xDD, 0xC5, 0x26, 0x1D, 0xC9, 0x24, 0x27, 0x79, 0xBA, 0x5C, 0x0E, 0x3D, 0xF0, 0x3F, 0x8E, 0x7F,
+    0x00, 0xC5, 0x55, 0xB1, 0x8E, 0xE4, 0x44, 0x10, 0xAD, 0x76, 0xDF, 0xD1, 0x12, 0x2D, 0xD1, 0x17,
+    0x40, 0xC2, 0x49, 0x74, 0x8E, 0x84, 0xFC, 0x03, 0xA7, 0x6D, 0x23, 0x42, 0x12, 0x12, 0xB4, 0xC1,
+    0x05, 0xFB, 0x01, 0x04, 0x9B, 0x12, 0x70, 0x63, 0xC3, 0x05, 0xA4, 0x24, 0x97, 0x93, 0x20, 0xC1,
+    0x06, 0x6C, 0x42, 0x38, 0x73, 0x63, 0xC4, 0x0F, 0x58, 0x27, 0x11, 0x63, 0x21, 0x36, 0xC6, 0x08,
+    0xAF, 0xE4, 0x45, 0x3D, 0x6E, 0xDE, 0x6B, 0x7B, 0x16, 0xDD, 0x8A, 0xCB, 0x90, 0xF0, 0xC8, 0xDD,
+    0xB6, 0xBB, 0xAB, 0xFA, 0xD5, 0xAB, 0x57, 0x35, 0xE2, 0x1A, 0x5F, 0xE9, 0xDE, 0xB6, 0xB2, 0xB3,
+    0x9D, 0xB8, 0xD4, 0x8B, 0x7C, 0xDF, 0xC8, 0xED, 0x55, 0xCE, 0x22, 0x21, 0x0D, 0x12, 0x7E, 0x3E,
+    0x48, 0x68, 0x7C, 0x53, 0x36, 0xA6, 0x77, 0x6D, 0x31, 0x9A, 0x5E, 0x45, 0x3D, 0x3E, 0x3C, 0x48,
+    0x4A, 0x11, 0x1B, 0x7E, 0x13, 0xFF, 0x95, 0x88, 0x81, 0xB1, 0x9A, 0x60, 0x15, 0x70, 0xBB, 0x0E,
+    0x2F, 0xB3, 0xFA, 0x41, 0xCA, 0x74, 0x10, 0x85, 0x5B, 0x54, 0x75, 0xF4, 0x6A, 0xD3, 0x8D, 0xC8,
+    0x3E, 0xA5, 0x46, 0xD2, 0x37, 0xFB, 0x41, 0xBE, 0x16, 0x4B, 0xAB, 0x22, 0x72, 0xED, 0xC0, 0xE1,
+    0x39, 0x87, 0x5A, 0x56, 0x57, 0xCB, 0x50, 0x8B, 0xBA, 0x4C, 0xB3, 0xD4, 0x29, 0xCD, 0x3A, 0xCD,
+    0x17, 0x07, 0x07, 0x1F, 0x31, 0xB4, 0x52, 0x4C, 0xD8, 0xA8, 0x47, 0x98, 0xD8, 0x01, 0x83, 0x6F,
+    0x31, 0xD4, 0x4D, 0x2D, 0xC5, 0x2C, 0xE1, 0xEA, 0x7C, 0x12, 0x9F, 0x52, 0x27, 0x05, 0x01, 0xC8,
+    0xFD, 0x15, 0x81, 0x4A, 0x13, 0x40, 0x47, 0xB9, 0x39, 0x8D, 0x0A, 0xA6, 0x0B, 0x72, 0xD7, 0xE6,
+    0x83, 0x54, 0x94, 0xF3, 0xD4, 0xC3, 0xE8, 0x8B, 0xF4, 0xEC, 0xE0, 0x3B, 0x3D, 0x44, 0xF1, 0x4F,
+    0x7B, 0x89, 0xAE, 0x75, 0x5D, 0xF8, 0x9C, 0xE7, 0xF7, 0x52, 0xC3, 0xD9, 0x7D, 0x3A, 0xBA, 0x27,
+    0xF0, 0x78, 0xA2, 0x61, 0xBD, 0xA1, 0x8B, 0x47, 0xBA, 0x95, 0x3B, 0xD7, 0xFF, 0x1A, 0xAA, 0x92,
+    0x07, 0x62, 0xDB, 0x2D, 0x42, 0x8B, 0x62, 0x9A, 0x4F, 0x5F, 0x02, 0x56, 0xCF, 0xA2, 0x53, 0x6A,
+    0xF5, 0xD5, 0xD9, 0xB0, 0x70, 0x90, 0x33, 0x17, 0x97, 0x1B, 0x24, 0x3C, 0x4C, 0x93, 0x4A, 0x69,
+    0xB2, 0xF3, 0xE9, 0x48, 0x16, 0x02, 0x38, 0x3A, 0x81, 0xA3, 0x20, 0xA1, 0x22, 0x0D, 0x1E, 0x14,
+    0x1A, 0x9C, 0x26, 0x6F, 0x2E, 0xEE, 0xAA, 0x7B, 0x79, 0x2A, 0x86, 0x32, 0xCF, 0x34, 0xC8, 0xEF,
+    0xDD, 0x7B, 0xF2, 0xEA, 0x4B, 0x77, 0x52, 0x92, 0x06, 0x0D, 0x81, 0x89, 0x9E, 0x44, 0x8D, 0x98,
+    0x6D, 0x4F, 0x08, 0x1B, 0x29, 0xC1, 0xE5, 0x56, 0x76, 0x99, 0x9B, 0x13, 0x89, 0x8A, 0xD0, 0x4A,
+    0x89, 0x84, 0x2A, 0xBE, 0x99, 0xA8, 0x2F, 0x71, 0x3F, 0x4E, 0x81, 0x6A, 0x35, 0x2F, 0xC6, 0xCC,
+    0xA3, 0xA6, 0x1C, 0x97, 0x79, 0xE0, 0xEC, 0xD6, 0x39, 0x7C, 0xF9, 0x82, 0x66, 0xB2, 0xB7, 0x6D,
+    0xCC, 0xF4, 0xBB, 0x3C, 0x9B, 0xC1, 0xB5, 0x9B, 0xAC, 0x55, 0xDF, 0x10, 0x6F, 0xA8, 0x4A, 0xFC,
+    0x44, 0x66, 0x1C, 0x04, 0x39, 0x20, 0x4B, 0x81, 0xB3, 0x1D, 0x00, 0x00, 0xF9, 0xF5, 0x2D, 0x60,
+    0x01, 0x6B, 0x5D, 0x01, 0x56, 0x91, 0x1D, 0x92, 0x61, 0x5E, 0x59, 0x03, 0xE4, 0xD0, 0xE7, 0xE2,
+    0xD1, 0xED, 0xA3, 0x57, 0x47, 0x1D, 0x7A, 0xBA, 0x43, 0xE9, 0xF4, 0x32, 0x49, 0x1A, 0xD5, 0x59,
+    0x67, 0x3A, 0x77, 0xDD, 0xC0, 0x7D, 0x99, 0xD5, 0x10, 0x10, 0x24, 0x51, 0x6F, 0x75, 0x26, 0xB3,
+    0x18, 0x5C, 0x43, 0xB0, 0xB6, 0x7B, 0x42, 0x8D, 0x41, 0xB8, 0x29, 0x31, 0xB9, 0x69, 0x89, 0x55,
+    0x5F, 0xD5, 0xA7, 0xDC, 0x5D, 0xBE, 0x3F, 0x51, 0xC1, 0x12, 0x4D, 0xC7, 0x50, 0x4C, 0x5F, 0xE6,
+    0x64, 0xC2, 0x19, 0x90, 0x2A, 0x33, 0xEA, 0xDE, 0x8C, 0xE0, 0xA3, 0xF2, 0x95, 0x4D, 0x55, 0x3D,
+    0x82, 0x5A, 0x7B, 0x58, 0x92, 0x97, 0xEB, 0x32, 0x2B, 0x79, 0x74, 0x15, 0xE8, 0x07, 0x06, 0x27,
+    0xC3, 0x1D, 0xD0, 0xAF, 0x51, 0x55, 0x38, 0x1A, 0xE4, 0x3C, 0x4E, 0x34, 0xA2, 0xC8, 0x8A, 0x49,
+    0x96, 0xDA, 0x91, 0x1C, 0xF6, 0x2E, 0x27, 0x7E, 0x91, 0xF3, 0xBB, 0x97, 0x03, 0xCA, 0xEC, 0x86,
+    0x05, 0x70, 0x2B, 0xF8, 0xAC, 0xB0, 0xBC, 0x21, 0x23, 0x25, 0xCC, 0x9C, 0x55, 0x47, 0x0F, 0x7B,
+    0xD9, 0x7C, 0x7C, 0x3E, 0x2A, 0x06, 0x57, 0x24, 0xB6, 0xA1, 0x63, 0xB1, 0xCA, 0x67, 0x06, 0x0D,
+    0xA7, 0xAC, 0xEE, 0x08, 0xF8, 0x3C, 0x55, 0x06, 0x65, 0xE5, 0x9E, 0xED, 0xAB, 0x5C, 0x44, 0x74,
+    0x6E, 0x3A, 0x7A, 0x55, 0x8F, 0xC7, 0xDC, 0xB7, 0x48, 0x0F, 0xCF, 0x2D, 0xD6, 0x02, 0xF7, 0xD8,
+    0x18, 0xDF, 0xA8, 0x7C, 0xCF, 0x30, 0x6A, 0x68, 0x57, 0x7D, 0xB4, 0xD0, 0x39, 0x90, 0xCB, 0x16,
+    0xDE, 0xE6, 0x23, 0x98, 0xDB, 0x87, 0xC3, 0xDA, 0xC9, 0xFE, 0x79, 0xE0, 0x92, 0x21, 0xBE, 0x32,
+    0x4B, 0xCB, 0x0F, 0xC7, 0x85, 0xB2, 0x59, 0xAB, 0x39, 0xB3, 0x92, 0x3F, 0xD5, 0x20, 0x15, 0xCC,
+    0x5F, 0x2B, 0xE0, 0x44, 0x2D, 0x81, 0x0B, 0x5A, 0xBF, 0x75, 0x54, 0xA6, 0xE2, 0x89, 0x6F, 0x5F,
+    0x5C, 0x76, 0x92, 0x0B, 0x30, 0xF3, 0x47, 0xF9, 0xA1, 0x11, 0x2F, 0xF2, 0x7A, 0xBE, 0xBA, 0xB5,
+    0x7C, 0x49, 0x18, 0x5E, 0xE7, 0xC1, 0xD4, 0xDF, 0x4A, 0x5C, 0xB7, 0x5A, 0xD9, 0xE3, 0xC3, 0x22,
+    0x81, 0x2C, 0xE5, 0x07, 0xE2, 0x06, 0x7D, 0xF3, 0x09, 0xDB, 0x33, 0x4E, 0xDD, 0xCF, 0x39, 0x8B,
+    0x17, 0xDF, 0xCA, 0xD2, 0xD0, 0xA9, 0x9F, 0xE6, 0xA5, 0x0C, 0x6F, 0x71, 0x56, 0xAB, 0x99, 0x35,
+    0x66, 0xD3, 0x4D, 0xF4, 0x97, 0x3A, 0xE0, 0xB0, 0x89, 0x6E, 0x37, 0x2C, 0x06, 0xFD, 0x67, 0x0F,
+    0x9E, 0x83, 0x6F, 0x2C, 0x16, 0x76, 0xF8, 0xE0, 0x9F, 0x0E, 0x38, 0x0E, 0xCA, 0xD3, 0xB9, 0x94,
+    0x7C, 0xB3, 0x85, 0xC1, 0xCE, 0x74, 0x16, 0x1F, 0x4E, 0x58, 0x3D, 0x3F, 0x71, 0x7D, 0x53, 0x22,
+    0x01, 0xC5, 0x35, 0xD2, 0x52, 0xD9, 0x5F, 0x1A, 0x7C, 0x08, 0x91, 0x3A, 0x48, 0x2D, 0x0C, 0x50,
+    0x08, 0x2C, 0xF6, 0x9E, 0x11, 0xA7, 0x25, 0x80, 0xE2, 0xE2, 0x3B, 0xC9, 0x7D, 0xD6, 0xE4, 0x56,
+    0xB6, 0x5E, 0x48, 0x1F, 0x2A, 0x22, 0xB7, 0xA0, 0x5C, 0x20, 0xBE, 0xD9, 0xA0, 0x61, 0x58, 0xB6,
+    0x10, 0x7A, 0x83, 0x61, 0x00, 0x36, 0xD3, 0x63, 0xDF, 0x0E, 0xBE, 0xB8, 0x4F, 0x71, 0x5F, 0x40,
+    0x69, 0xDB, 0x51, 0x0F, 0x45, 0x42, 0xE3, 0xFA, 0x0B, 0xA4, 0xCF, 0x25, 0x42, 0xFA, 0xA0, 0x5F,
+    0x3A, 0xF8, 0x5A, 0xC1, 0x65, 0x41, 0x4A, 0x22, 0x4F, 0x57, 0xFD, 0x3B, 0xFF, 0x52, 0xB4, 0x76,
+    0x6D, 0x07, 0x48, 0x38, 0x95, 0x96, 0x1A, 0xFE, 0x5B, 0x1E, 0x98, 0xAE, 0x3D, 0x23, 0x34, 0xBF,
+    0x93, 0xBA, 0x70, 0x02, 0x54, 0xFA, 0x0F, 0x52, 0x57, 0x7E, 0x88, 0xA6, 0xA9, 0x26, 0xF6, 0x0F,
+    0x96, 0x2F, 0xCA, 0x10, 0x7F, 0x99, 0x93, 0x6D, 0xC1, 0x40, 0xF7, 0x04, 0x5C, 0x07, 0xDD, 0xC3,
+    0x20, 0x72, 0xDD, 0xFC, 0x3A, 0x90, 0x81, 0xB3, 0x8A, 0xD4, 0x4D, 0xF8, 0xA0, 0x41, 0x0C, 0x16,
+    0x22, 0x35, 0x5D, 0x77, 0xA4, 0x6E, 0xA6, 0x30, 0xDC, 0xB0, 0xA4, 0xF6, 0x3F, 0xBD, 0xFE, 0x06,
+    0xCD, 0x55, 0x31, 0x8F, 0xD4, 0x46, 0x18, 0x7D, 0x63, 0xDF, 0x61, 0x09, 0x17, 0x93, 0x22, 0x34,
+    0x29, 0x70, 0x45, 0x41, 0xA4, 0x8B, 0xDB, 0x14, 0x09, 0xB6, 0x88, 0x94, 0x9A, 0xC6, 0x50, 0xA4,
+    0xE0, 0x27, 0x6C, 0x1F, 0x69, 0xCF, 0x4E, 0x95, 0xF6, 0x9A, 0xD0, 0xA4, 0x49, 0x7D, 0x29, 0xF2,
+    0x07, 0xB8, 0x5B, 0x23, 0x0A, 0x0A, 0x0A, 0x36, 0x42, 0x54, 0x14, 0xB8, 0x00, 0xA1, 0x74, 0x06,
+    0x2C, 0x61, 0xC8, 0xD8, 0x93, 0xF7, 0x66, 0x0F, 0x91, 0xE5, 0x8E, 0x8E, 0x02, 0x4B, 0x6B, 0xD9,
+    0x9E, 0x6F, 0xDE, 0xF7, 0xBE, 0xF7, 0xE6, 0xFB, 0x16, 0x28, 0x77, 0x80, 0x22, 0xEE, 0x11, 0xF7,
+    0x05, 0xB0, 0x17, 0xAD, 0xB1, 0x75, 0x65, 0x25, 0x6E, 0x73, 0xD1, 0xB6, 0x5C, 0x74, 0x7C, 0xC8,
+    0x9A, 0x7D, 0x98, 0x21, 0x5D, 0x23, 0x87, 0xE3, 0x16, 0xDB, 0xA2, 0x30, 0x23, 0x92, 0x8E, 0x71,
+    0x47, 0xD1, 0x10, 0xE2, 0x8C, 0xE2, 0x8A, 0xA6, 0x40, 0x3A, 0xC4, 0x7D, 0xE4, 0xCB, 0xE2, 0x97,
+    0xB7, 0xBD, 0xF1, 0x73, 0x8E, 0xD4, 0xFF, 0xD0, 0x61, 0x37, 0xC0, 0x1A, 0x7C, 0x01, 0xC4, 0xDD,
+    0xF7, 0x7C, 0x1A, 0xB3, 0x06, 0xF8, 0x2E, 0x6E, 0xF1, 0xE1, 0x65, 0xFC, 0x1B, 0x20, 0xF1, 0xBE,
+    0x43, 0x3A, 0xFF, 0xEE, 0x91, 0x8E, 0xC8, 0xBA, 0x64, 0x10, 0xFC, 0x40, 0xC6, 0x57, 0x47, 0x20,
+    0xED, 0x1C, 0xC3, 0xDC, 0x31, 0x83, 0x8B, 0xA2, 0x04, 0xEC, 0x03, 0xA2, 0xC4, 0xAF, 0x7B, 0x7E,
+    0x9C, 0xB8, 0x8C, 0x5A, 0x2B, 0xF9, 0x5F, 0xC4, 0xB7, 0x8F, 0x3B, 0x62, 0xBD, 0xE4, 0xC7, 0xC8,
+    0xD5, 0xFC, 0x38, 0x91, 0x38, 0x7C, 0xCC, 0xED, 0x2B, 0xD4, 0x0D, 0x7C, 0x99, 0xCE, 0xD7, 0x7D,
+    0x83, 0x95, 0xF7, 0x25, 0x22, 0x3F, 0x29, 0xFB, 0xB5, 0x13, 0x9A, 0x51, 0x9F, 0xB3, 0x74, 0xC6,
+    0x7F, 0x73, 0x4A, 0x9B, 0x99, 0x29, 0x7C, 0x8F, 0xFA, 0x91, 0x67, 0xBD, 0x69, 0x97, 0x37, 0x21,
+    0xAE, 0xA0, 0x3A, 0xF6, 0xAE, 0x04, 0x25, 0xBC, 0xDB, 0x27, 0x37, 0x56, 0x98, 0xFD, 0xCA, 0x32,
+    0xFE, 0x1E, 0x83, 0xCA, 0xD1, 0x68, 0xD7, 0xC6, 0x99, 0xF9, 0xC7, 0x09, 0x39, 0x73, 0x19, 0x2F,
+    0xAE, 0xE5, 0x7B, 0x58, 0x7F, 0x20, 0x5C, 0x82, 0xAF, 0xFE, 0x59, 0xF5, 0x58, 0x35, 0x66, 0x46,
+    0x5D, 0x22, 0x6B, 0x59, 0x62, 0x3C, 0x30, 0x09, 0x8E, 0xC5, 0x3E, 0xBB, 0xCF, 0x92, 0xE2, 0x57,
+    0xD4, 0x02, 0x6E, 0xAE, 0xAA, 0x6A, 0x55, 0x7B, 0x5E, 0x4F, 0x74, 0xFB, 0x97, 0x2B, 0xD1, 0x5B,
+    0xA1, 0x4E, 0x52, 0xA0, 0xD6, 0x9E, 0xFC, 0x1E, 0x65, 0xB1, 0x6B, 0x52, 0xB2, 0x7D, 0xD1, 0x22,
+    0xED, 0x93, 0x11, 0x76, 0xC0, 0xEA, 0xD9, 0x62, 0xA4, 0x31, 0x9E, 0x30, 0xB9, 0x57, 0x7D, 0x17,
+    0xDE, 0xCB, 0xDF, 0x49, 0xFD, 0x32, 0x99, 0x6E, 0xF6, 0xF1, 0x88, 0xE3, 0x88, 0xF1, 0xAD, 0x3C,
+    0x27, 0xE4, 0x51, 0xF1, 0x5B, 0x55, 0x5B, 0x66, 0xBA, 0xC7, 0xDF, 0x8B, 0x91, 0x26, 0xB2, 0xCC,
+    0x23, 0x96, 0xA9, 0x83, 0x94, 0x37, 0x13, 0xC9, 0x66, 0xDD, 0xA2, 0x35, 0x9E, 0x90, 0x19, 0x75,
+    0xC5, 0x8E, 0x10, 0x77, 0x54, 0xA4, 0x6D, 0xC8, 0x2B, 0xE9, 0x18, 0x8F, 0xDE, 0xE2, 0x93, 0x98,
+    0xFE, 0xAC, 0xAA, 0x7E, 0x7A, 0xAD, 0xBA, 0x27, 0xDD, 0xFC, 0xA7, 0x30, 0x3D, 0x34, 0x83, 0xCC,
+    0xDC, 0x3B, 0xDB, 0xF4, 0xE1, 0xB4, 0xE9, 0x64, 0xFC, 0xF0, 0x4D, 0x75, 0xA3, 0x27, 0x03, 0x27,
+    0x2B, 0x3E, 0x62, 0xFA, 0x39, 0x47, 0x45, 0xB6, 0x4C, 0x57, 0x03, 0x86, 0x43, 0x16, 0x92, 0x9A,
+    0xEE, 0xE2, 0x29, 0x51, 0x16, 0xFE, 0x29, 0x89, 0xEB, 0x44, 0xCC, 0xB7, 0xA4, 0x26, 0x32, 0x91,
+    0x4A, 0x68, 0x28, 0x24, 0x0B, 0x22, 0xDD, 0xCC, 0xF8, 0xBF, 0xDB, 0xF9, 0xC3, 0x3F, 0xA9, 0x9C,
+    0x6C, 0xCD, 0x83, 0xB7, 0xC4, 0x7E, 0xB7, 0x83, 0x44, 0x29, 0x8D, 0xDA, 0x2D, 0xD7, 0x4D, 0x12,
+    0x62, 0xD6, 0xA2, 0xC3, 0xCF, 0x15, 0xCF, 0x1B, 0xB9, 0xD3, 0xC7, 0x40, 0xAF, 0x7A, 0xE7, 0xDA,
+    0x68, 0x1B, 0x59, 0x66, 0xD1, 0x6F, 0xD1, 0x9A, 0xC3, 0x01, 0xB1, 0xB7, 0xFC, 0x09, 0x84, 0xDB,
+    0xE4, 0xB1, 0xED, 0x6E, 0x55, 0x13, 0xC7, 0x45, 0xDE, 0xF7, 0x9B, 0x5C, 0xFB, 0x1B, 0x92, 0x7A,
+    0x9C, 0xE2, 0x83, 0x45, 0x67, 0x59, 0x8C, 0xCE, 0x9B, 0x09, 0x0A, 0x7C, 0x7D, 0x78, 0x20, 0xD3,
+    0x05, 0x51, 0xFB, 0xF5, 0x07, 0xE3, 0x07, 0x4E, 0x45, 0xE5, 0x0D, 0xF7, 0x92, 0x3F, 0x53, 0x4C,
+    0x60, 0x83, 0x65, 0x2D, 0x31, 0xC3, 0xD4, 0x02, 0xFD, 0xCE, 0x85, 0x6C, 0x86, 0x90, 0x82, 0x83,
+    0x47, 0xD6, 0x11, 0x26, 0xBD, 0xA3, 0x22, 0x96, 0x7A, 0x8F, 0x9F, 0x0B, 0xB6, 0x70, 0x12, 0xCB,
+    0x2B, 0x67, 0x26, 0x15, 0x8C, 0xDE, 0xE9, 0xA2, 0x54, 0x51, 0x65, 0x91, 0xDE, 0xAF, 0x6B, 0xDD,
+    0x06, 0x1A, 0x3E, 0x04, 0x9D, 0x74, 0xE6, 0x57, 0x87, 0x7F, 0x10, 0xC7, 0xAB, 0xD6, 0xC2, 0x6F,
+    0xE9, 0x20, 0x7E, 0x8E, 0x89, 0x91, 0x97, 0x61, 0x28, 0x8A, 0xCC, 0xA4, 0x4F, 0x24, 0x99, 0xB6,
+    0x52, 0x64, 0x29, 0x01, 0x92, 0x4E, 0xE5, 0x5F, 0x51, 0x74, 0x70, 0x1A, 0x45, 0xA2, 0x3E, 0xD5,
+    0x94, 0x40, 0xAE, 0x42, 0xCD, 0x2B, 0xC1, 0x66, 0x4B, 0x61, 0x7A, 0x79, 0x63, 0xE5, 0x5C, 0x50,
+    0x76, 0x63, 0x58, 0x70, 0x17, 0xDA, 0xBA, 0x71, 0x31, 0xF0, 0xBF, 0xB4, 0x52, 0x7D, 0x81, 0x6F,
+    0xD1, 0x6D, 0x08, 0x85, 0x46, 0x3B, 0xC9, 0xA1, 0xF4, 0xD1, 0x7A, 0xEF, 0x74, 0xA7, 0x7D, 0x46,
+    0xD2, 0x86, 0x7F, 0x03, 0x33, 0x88, 0x51, 0x7E, 0x75, 0x38, 0xBB, 0x07, 0x3E, 0x3F, 0x95, 0x71,
+    0xF9, 0x9C, 0x86, 0xCC, 0x1D, 0xA7, 0xB3, 0xAD, 0xF0, 0xA5, 0xB6, 0xDB, 0x48, 0xE9, 0x9A, 0x6F,
+    0xB7, 0xA8, 0x87, 0xA3, 0xCF, 0x81, 0xC0, 0x19, 0xCA, 0xE8, 0x5A, 0x79, 0xA8, 0xE2, 0x91, 0xA0,
+    0xC9, 0xAE, 0x50, 0x36, 0xA6, 0x8A, 0x82, 0x07, 0x59, 0xC9, 0x02, 0x31, 0x6E, 0x1A, 0x49, 0x43,
+    0xE9, 0xB6, 0xFE, 0x20, 0x93, 0x87, 0x62, 0x7D, 0x65, 0x19, 0x58, 0x84, 0xE6, 0x0D, 0x3D, 0x1F,
+    0x58, 0x67, 0x7A, 0x8F, 0x03, 0x6B, 0xB1, 0x0C, 0x7D, 0xBD, 0xBB, 0xD0, 0x7A, 0x18, 0x6A, 0x36,
+    0x04, 0x7D, 0x89, 0x33, 0xAF, 0xFF, 0x00, 0x95, 0x55, 0x3D, 0x8F, 0xE4, 0x44, 0x10, 0x2D, 0x77,
+    0xDF, 0xC8, 0xD2, 0xF9, 0x84, 0x09, 0x20, 0x80, 0x00, 0xA7, 0x17, 0x1C, 0xF2, 0x1F, 0x38, 0x4D,
+    0x5B, 0x10, 0x92, 0x5C, 0xB0, 0x13, 0xF1, 0x0F, 0xE0, 0x0F, 0x10, 0x30, 0x33, 0x26, 0x20, 0x22,
+    0xD9, 0x7F, 0xC0, 0x04, 0x04, 0x68, 0x13, 0xF8, 0x01, 0xEB, 0x1D, 0x1F, 0x84, 0x24, 0x96, 0x2E,
+    0x20, 0xB5, 0x74, 0x22, 0x39, 0x12, 0x23, 0x19, 0xAD, 0x59, 0xF5, 0x6E, 0xF3, 0x5E, 0xB5, 0xE7,
+    0x98, 0x95, 0xF6, 0x3E, 0x68, 0xA9, 0x35, 0xDD, 0xEB, 0xAA, 0x57, 0xAF, 0x5E, 0x55, 0xD7, 0x8A,
+    0xC8, 0x87, 0xE6, 0x54, 0x24, 0xED, 0xAF, 0x45, 0xC4, 0x17, 0x95, 0xC8, 0xD2, 0x76, 0x22, 0x59,
+    0x3D, 0x8A, 0x24, 0xDD, 0x23, 0x39, 0x5E, 0x45, 0x2D, 0x79, 0x2B, 0x93, 0x98, 0x91, 0xBF, 0x0E,
+    0xF6, 0x92, 0x77, 0x38, 0x26, 0x5E, 0xE4, 0x9C, 0xF7, 0xB4, 0x4B, 0x7B, 0x91, 0x0D, 0xFE, 0x2E,
+    0xB6, 0x87, 0xB5, 0x38, 0x3B, 0xE0, 0x38, 0x6C, 0xE0, 0x5C, 0xC2, 0x45, 0xCC, 0x5F, 0x23, 0x71,
+    0x60, 0x2A, 0xC9, 0x25, 0xC2, 0x48, 0xEE, 0x09, 0x1C, 0x2A, 0x1E, 0x7B, 0x1E, 0xFD, 0x1C, 0x88,
+    0x6E, 0x3C, 0x5E, 0xE8, 0x9D, 0xAE, 0x9F, 0xF3, 0xEE, 0x48, 0xD3, 0xDE, 0x44, 0x3E, 0xD5, 0x3D,
+    0xC0, 0x9A, 0x01, 0x96, 0x00, 0xFC, 0x28, 0xE9, 0x6F, 0x91, 0x95, 0x35, 0x52, 0x41, 0xCC, 0xB4,
+    0x07, 0x64, 0x93, 0x83, 0xFA, 0xD3, 0x09, 0xF0, 0x65, 0x25, 0xF9, 0xAF, 0x83, 0x24, 0x13, 0x5C,
+    0xCA, 0x4F, 0x7B, 0xF8, 0x6E, 0x23, 0x4D, 0xDB, 0xBB, 0x5A, 0x2E, 0x92, 0x70, 0x16, 0xBA, 0x2C,
+    0x04, 0x2F, 0x59, 0xF8, 0x09, 0x51, 0x93, 0x89, 0xD4, 0xAB, 0x99, 0x8D, 0x3B, 0xD0, 0x62, 0x42,
+    0x59, 0x37, 0xD3, 0x65, 0x62, 0xF7, 0xA4, 0x52, 0x14, 0xEE, 0x8F, 0x4D, 0x77, 0xCC, 0x03, 0xA1,
+    0x37, 0x48, 0xA8, 0x01, 0xCA, 0x39, 0x35, 0x73, 0x92, 0x60, 0x9B, 0x69, 0x23, 0xE9, 0xB8, 0x91,
+    0x1C, 0xF1, 0xB7, 0x83, 0xFB, 0xF3, 0xB2, 0x2F, 0xC2, 0xEF, 0xBD, 0xF9, 0x87, 0xA8, 0x04, 0xE4,
+    0xA6, 0x0C, 0x8C, 0xCD, 0x4D, 0xBA, 0x21, 0x74, 0x96, 0xD4, 0x5C, 0x08, 0x2D, 0x85, 0x66, 0x8A,
+    0xB7, 0x69, 0xBC, 0xA4, 0x6B, 0x5E, 0x4F, 0x57, 0xA6, 0x59, 0x65, 0x33, 0x1E, 0xEC, 0xAE, 0xE0,
+    0xB5, 0xC5, 0x2D, 0x0D, 0x72, 0x94, 0xAD, 0x86, 0x69, 0xE8, 0xDE, 0xCE, 0xEE, 0x0B, 0x4D, 0x6A,
+    0x1B, 0x06, 0x03, 0x16, 0xF9, 0x8B, 0x33, 0x35, 0x9B, 0xA2, 0x25, 0x23, 0xFB, 0xE8, 0x4D, 0xF0,
+    0x75, 0xC4, 0x67, 0x40, 0x17, 0xB9, 0x65, 0x7F, 0xC0, 0x08, 0xBF, 0xA1, 0x8B, 0xF0, 0x47, 0xC6,
+    0xCD, 0xA1, 0xE2, 0xBA, 0xDE, 0x4D, 0x54, 0xBA, 0x56, 0xDB, 0xC1, 0x2B, 0xE5, 0xBC, 0x1A, 0xE5,
+    0xAE, 0xA5, 0xA9, 0xAE, 0x15, 0x2E, 0xD3, 0xFE, 0x03, 0x6A, 0xA3, 0xCE, 0x59, 0x54, 0xC4, 0xAB,
+    0x26, 0xDA, 0x7E, 0x83, 0x0A, 0xE4, 0xE6, 0x8A, 0xDA, 0xAB, 0x13, 0x6A, 0xE3, 0xC2, 0x04, 0x4F,
+    0x28, 0x3B, 0xC0, 0x74, 0x93, 0xEC, 0x6B, 0x78, 0x76, 0xE8, 0x69, 0xAF, 0xFD, 0x5D, 0xE0, 0x2A,
+    0x8D, 0x19, 0xE1, 0x99, 0x77, 0x4E, 0xF0, 0x42, 0xBC, 0x1D, 0x90, 0x56, 0xD1, 0xC2, 0x53, 0xEC,
+    0x98, 0x76, 0xA0, 0x1D, 0x10, 0x71, 0x7B, 0x06, 0x3D, 0xDA, 0x2C, 0xC2, 0x84, 0xD0, 0xC7, 0x2E,
+    0x8E, 0xEB, 0xEB, 0x94, 0xD1, 0x47, 0x86, 0x4D, 0xEB, 0xAF, 0xEE, 0x48, 0x82, 0x95, 0x5C, 0x33,
+    0x13, 0x33, 0xC6, 0xEA, 0x33, 0x1D, 0xA7, 0x6C, 0x27, 0x56, 0x2E, 0xED, 0xDC, 0x82, 0x59, 0x10,
+    0xD7, 0x93, 0xAA, 0x1D, 0x8A, 0xD3, 0x02, 0x6F, 0xAC, 0x81, 0x2D, 0x1D, 0x9D, 0x19, 0xE0, 0x08,
+    0xA5, 0x4A, 0x7D, 0x0E, 0x17, 0x52, 0x7E, 0x33, 0xC9, 0xB5, 0xF1, 0x59, 0x87, 0x3A, 0x75, 0xA5,
+    0x24, 0x41, 0x85, 0x78, 0x4F, 0xA3, 0x29, 0x49, 0x76, 0x11, 0x78, 0x86, 0x58, 0x63, 0x52, 0xC3,
+    0x23, 0x9E, 0x8B, 0xA0, 0x82, 0xB3, 0x6B, 0xB4, 0x3F, 0x78, 0x4B, 0x69, 0x8D, 0x0E, 0x14, 0xF9,
+    0xF2, 0xC5, 0x0F, 0xB3, 0xB9, 0x3F, 0x98, 0x6B, 0xA6, 0xEB, 0x63, 0x73, 0x71, 0x3B, 0x68, 0x0F,
+    0x17, 0xC4, 0x92, 0xB9, 0xDF, 0x2C, 0xE3, 0x14, 0x07, 0xC7, 0x3D, 0x6E, 0x86, 0xDF, 0x92, 0xD3,
+    0x38, 0x5C, 0xD0, 0xD8, 0x25, 0x9B, 0xFB, 0xEC, 0x47, 0xAD, 0xE5, 0x72, 0x66, 0xD0, 0x44, 0xFB,
+    0xC3, 0x67, 0x33, 0xC5, 0x8A, 0xDB, 0x79, 0x93, 0x3C, 0xBB, 0x2A, 0xC3, 0x4C, 0xC8, 0xAF, 0x67,
+    0x1A, 0xE7, 0x71, 0x53, 0x3E, 0x07, 0x1B, 0x07, 0x01, 0x3F, 0x98, 0x9F, 0x22, 0x48, 0x00, 0xDD,
+    0x55, 0xC0, 0x26, 0x59, 0x80, 0xD6, 0x38, 0x70, 0x82, 0xA5, 0x7D, 0x54, 0x9E, 0x20, 0xE5, 0x67,
+    0x7C, 0x2D, 0xCB, 0x8D, 0x0E, 0x27, 0x66, 0x98, 0x68, 0x16, 0x56, 0x3B, 0xD0, 0x31, 0x0F, 0xC3,
+    0xDC, 0xA4, 0xF8, 0x5E, 0xD3, 0x59, 0xBE, 0xEC, 0xD5, 0x26, 0xE1, 0x13, 0xEA, 0xC9, 0x6C, 0x4B,
+    0x21, 0x70, 0x80, 0x38, 0x08, 0xE7, 0x76, 0x64, 0x1E, 0x5A, 0x8C, 0xB2, 0x88, 0xA5, 0x92, 0x88,
+    0xD5, 0x51, 0xA1, 0xA2, 0xC4, 0xD1, 0xB7, 0x8F, 0xE0, 0x72, 0x10, 0x66, 0xC9, 0x8C, 0x3D, 0xBA,
+    0x2D, 0x99, 0x40, 0xD2, 0xB2, 0xC8, 0x69, 0x07, 0x8A, 0xF9, 0x6F, 0xF0, 0x2C, 0x39, 0x1D, 0x99,
+    0xA1, 0xEC, 0x89, 0x45, 0x00, 0x87, 0xF8, 0xF6, 0x92, 0x6F, 0xF1, 0x3B, 0x44, 0x9A, 0x10, 0xBC,
+    0x68, 0x75, 0x52, 0x6F, 0x9E, 0x60, 0x56, 0x87, 0xF6, 0x46, 0x8C, 0x4E, 0x4F, 0x66, 0x92, 0x32,
+    0x78, 0x79, 0x08, 0xCD, 0x37, 0xA9, 0x93, 0x75, 0xF1, 0xE4, 0x7F, 0x29, 0xD5, 0xDF, 0x52, 0x0A,
+    0xBD, 0x19, 0x10, 0x33, 0x04, 0x7C, 0xFC, 0x22, 0x5C, 0xED, 0x5E, 0xAF, 0x54, 0x76, 0x97, 0x52,
+    0x5A, 0xE3, 0x6B, 0x0E, 0x7D, 0x16, 0xF0, 0x8D, 0x02, 0xBC, 0xBF, 0xFD, 0xBB, 0x62, 0x1F, 0xD7,
+    0xA9, 0x06, 0x7D, 0xB5, 0x00, 0xFC, 0x67, 0xE5, 0xE5, 0x46, 0xB3, 0x69, 0xE5, 0xB1, 0xD8, 0x5F,
+    0x82, 0xFF, 0xF9, 0xF1, 0xC3, 0x47, 0xF7, 0x1F, 0x98, 0x5A, 0x76, 0xF2, 0x50, 0xEE, 0xCB, 0xDB,
+    0x1C, 0x92, 0x8A, 0xEE, 0xBD, 0xE0, 0xD5, 0xDF, 0xBC, 0x63, 0xEB, 0x7E, 0xF7, 0xE0, 0x6D, 0x3D,
+    0xE7, 0xC3, 0x62, 0xB1, 0xFA, 0x24, 0x78, 0x17, 0x9E, 0xAE, 0x4E, 0xFE, 0x3B, 0xCD, 0xCF, 0x32,
+    0x3C, 0xC3, 0x1E, 0x56, 0x2B, 0x7E, 0x5A, 0x9D, 0xEC, 0x43, 0x78, 0x8E, 0xFB, 0xB7, 0xF1, 0xCA,
+    0xC5, 0x3F, 0x71, 0x3D, 0x8F, 0x3F, 0xFC, 0xB4, 0x5A, 0xBD, 0xF9, 0xB3, 0xBC, 0x6A, 0xFD, 0x0B,
+    0xAD, 0x55, 0xBF, 0x6F, 0x14, 0x47, 0x18, 0x7D, 0xBB, 0x83, 0x19, 0xC4, 0x0A, 0x0D, 0x05, 0x34,
+    0x89, 0xC2, 0xB4, 0x51, 0x14, 0xBC, 0x6D, 0x8A, 0xBB, 0x9D, 0x01, 0x0A, 0x4A, 0x5C, 0xE0, 0x2A,
+    0x45, 0xDA, 0xFC, 0x01, 0x14, 0x14, 0xE7, 0xF3, 0x06, 0x97, 0x29, 0x42, 0x91, 0x3A, 0xA1, 0xA0,
+    0xA2, 0x21, 0x85, 0x0B, 0xA2, 0x9C, 0xED, 0x31, 0x2E, 0x5C, 0xD0, 0xAC, 0xE4, 0x22, 0x45, 0x9A,
+    0x01, 0x94, 0x2A, 0x45, 0xC6, 0xCA, 0x26, 0x59, 0x25, 0x7B, 0x9E, 0xBC, 0xD9, 0x3B, 0xF3, 0xA3,
+    0x03, 0x29, 0xBB, 0x9A, 0xD3, 0xCE, 0xCC, 0xF7, 0xF3, 0x7D, 0xEF, 0xFB, 0x6E, 0x0D, 0xB7, 0xEC,
+    0x6A, 0x9B, 0xFF, 0xFE, 0xBF, 0xFE, 0x60, 0xF1, 0xA8, 0x18, 0x7B, 0xCD, 0xB5, 0xDC, 0xE2, 0x93,
+    0x47, 0x8F, 0x1E, 0x98, 0x18, 0xC3, 0xE5, 0xF5, 0xF5, 0x35, 0x6C, 0x4B, 0x57, 0xE5, 0x41, 0xB9,
+    0xB9, 0x0C, 0xA6, 0xBE, 0x8D, 0xBC, 0x55, 0x6E, 0x57, 0x04, 0x5D, 0xF7, 0xA2, 0x29, 0xB1, 0x86,
+    0xAC, 0x57, 0xDE, 0xA4, 0xC3, 0x0D, 0xE1, 0x35, 0x2E, 0xA2, 0x52, 0x07, 0xA1, 0x37, 0xC5, 0x7E,
+    0x18, 0xAD, 0x00, 0xDB, 0x85, 0x9D, 0x50, 0x5D, 0x84, 0x32, 0x49, 0xF4, 0xAA, 0xD9, 0xA5, 0x11,
+    0xD1, 0x95, 0xF5, 0xED, 0x15, 0x4B, 0x4B, 0x65, 0x7D, 0x7A, 0xD4, 0xEA, 0xBA, 0x53, 0x6E, 0x26,
+    0x1A, 0xBA, 0xD2, 0x58, 0xA3, 0x6A, 0xD6, 0x6B, 0x67, 0xEE, 0x75, 0x22, 0x18, 0xEC, 0x14, 0x9E,
+    0xCA, 0x59, 0xAB, 0x2D, 0x2D, 0x49, 0x37, 0xC2, 0xC5, 0x0C, 0x98, 0xCA, 0x9F, 0xFD, 0x8E, 0x91,
+    0x2F, 0xC3, 0xD4, 0x88, 0x17, 0xA1, 0xD2, 0xB9, 0x0F, 0x7A, 0x25, 0xC5, 0xB3, 0x86, 0xBC, 0x03,
+    0x76, 0x00, 0xC3, 0xC4, 0x6A, 0x88, 0x06, 0x08, 0x38, 0xD9, 0xDD, 0x63, 0x42, 0xDF, 0x7D, 0xFF,
+    0xA8, 0x11, 0x2E, 0xED, 0x71, 0x17, 0x60, 0xF6, 0xCA, 0x82, 0xFB, 0x8C, 0xFB, 0x19, 0x50, 0x0D,
+    0xF2, 0xB2, 0x61, 0x60, 0x00, 0xB1, 0xD8, 0x04, 0x4A, 0x07, 0xE5, 0x13, 0x22, 0x97, 0x31, 0xEC,
+    0x93, 0xD9, 0x24, 0x8A, 0x27, 0x5C, 0x2D, 0xF2, 0x6F, 0xFF, 0xFC, 0x52, 0x10, 0x37, 0x19, 0x63,
+    0x87, 0x9C, 0x8E, 0x92, 0x33, 0x1A, 0x40, 0xC1, 0xA5, 0xDC, 0x72, 0x59, 0x2E, 0x5A, 0xB8, 0xB2,
+    0x62, 0xF7, 0x62, 0xAC, 0xB9, 0xAC, 0x1D, 0x31, 0x81, 0xD1, 0xD2, 0x54, 0x9F, 0x72, 0xC5, 0x10,
+    0x74, 0x66, 0xCB, 0x76, 0xB3, 0xDF, 0x9B, 0xC7, 0x93, 0xBD, 0x93, 0xBD, 0xB9, 0xE9, 0x8B, 0xE4,
+    0xFB, 0x02, 0x73, 0x45, 0x1E, 0x59, 0x24, 0x6B, 0x62, 0x1D, 0xE3, 0xCD, 0xD8, 0x94, 0x9E, 0xCE,
+    0x87, 0x47, 0x1E, 0xCD, 0xA3, 0xB9, 0x96, 0xBE, 0xB2, 0x16, 0x9D, 0x71, 0xE5, 0x61, 0x2F, 0x7A,
+    0x63, 0x4D, 0x6D, 0x09, 0xC5, 0xF2, 0x78, 0x86, 0x29, 0x2F, 0x1A, 0xF5, 0x77, 0x9F, 0xCF, 0x11,
+    0x8D, 0x2D, 0x9D, 0x6A, 0xD2, 0xF5, 0x25, 0x14, 0x87, 0x7F, 0xCD, 0xF7, 0x88, 0x35, 0xCA, 0xF8,
+    0x0C, 0x79, 0x8D, 0x07, 0xF8, 0x18, 0xE7, 0xDF, 0xFD, 0xE3, 0xD2, 0x82, 0x3B, 0x1E, 0x9F, 0xBD,
+    0x8F, 0xD6, 0xF2, 0x63, 0x2D, 0xBE, 0xF5, 0xE4, 0xF5, 0xBB, 0xBD, 0x99, 0x8D, 0xF1, 0xD7, 0xF5,
+    0x06, 0xE9, 0xF5, 0x78, 0x3F, 0xBD, 0xF5, 0xCF, 0x21, 0x87, 0xB7, 0x78, 0x1F, 0xBD, 0xD3, 0xA6,
+    0x40, 0x16, 0x2D, 0x8A, 0x7A, 0x40, 0x6B, 0x51, 0xB9, 0xAC, 0xAB, 0x86, 0x6A, 0x93, 0x36, 0xB3,
+    0xC4, 0x1E, 0x60, 0x92, 0x87, 0x9C, 0x64, 0x42, 0xEE, 0x0B, 0xA7, 0x07, 0x74, 0xD8, 0x63, 0x43,
+    0xA9, 0xC6, 0xE8, 0x54, 0xD2, 0xCD, 0x82, 0x68, 0x66, 0x43, 0xE5, 0x9C, 0x96, 0xFB, 0x0F, 0x71,
+    0xF6, 0xBE, 0x46, 0x37, 0x36, 0x3D, 0x62, 0x18, 0xCB, 0x83, 0x97, 0xFF, 0x74, 0xEA, 0x37, 0x3F,
+    0xDF, 0x2D, 0xF5, 0xF5, 0x30, 0x2B, 0xF6, 0xE3, 0xF3, 0xD0, 0xC9, 0x03, 0xAF, 0xB3, 0x1F, 0xD5,
+    0x4D, 0xA7, 0x35, 0x26, 0x40, 0x57, 0x62, 0x32, 0x23, 0x61, 0x0B, 0xD7, 0xE5, 0x7F, 0xD0, 0x0B,
+    0x26, 0xA2, 0x29, 0xBE, 0xB1, 0x15, 0xA9, 0xA7, 0xEC, 0x78, 0x4C, 0x67, 0x15, 0xC6, 0x59, 0x60,
+    0x9B, 0x30, 0x90, 0x56, 0x6D, 0x35, 0x15, 0x34, 0x44, 0x98, 0xA9, 0x7B, 0xDC, 0x42, 0x92, 0x3B,
+    0xD1, 0x32, 0x90, 0x62, 0x8E, 0x72, 0x88, 0x8B, 0xF9, 0x9D, 0xC1, 0x5B, 0x8F, 0x6E, 0x17, 0xF4,
+    0x7E, 0x23, 0xD1, 0x74, 0xBA, 0xE5, 0xB1, 0xB1, 0x9C, 0x16, 0xA7, 0xD9, 0xA6, 0x24, 0x4A, 0x94,
+    0x8B, 0xCF, 0x57, 0x29, 0xA7, 0xCE, 0xC8, 0xBD, 0x5A, 0xE2, 0x76, 0x9A, 0x77, 0x32, 0x81, 0x31,
+    0xE3, 0xC5, 0x5B, 0xC9, 0xE3, 0x83, 0x6B, 0x41, 0x6D, 0x1D, 0x45, 0xA7, 0x22, 0x4C, 0xFF, 0x0A,
+    0x01, 0xF3, 0xF8, 0xD6, 0x2F, 0x2F, 0x8E, 0xDB, 0xB2, 0x70, 0xB3, 0x52, 0x1C, 0x2F, 0x60, 0x68,
+    0xB4, 0xB2, 0xB3, 0x0F, 0xEF, 0xB7, 0x93, 0xEC, 0x38, 0xC8, 0x67, 0xC9, 0xD7, 0x02, 0x8B, 0x01,
+    0x85, 0x99, 0xAA, 0xCB, 0x0A, 0x33, 0x3A, 0x3E, 0x05, 0x24, 0x41, 0xC1, 0x25, 0x8E, 0x1A, 0xF5,
+    0x05, 0x7B, 0x6D, 0x89, 0xCA, 0xE1, 0x10, 0xB0, 0xB2, 0xDD, 0x58, 0x3C, 0x0F, 0xCA, 0x9E, 0x42,
+    0x53, 0x15, 0x8E, 0x01, 0x6F, 0xCE, 0xF3, 0xD8, 0x16, 0xB1, 0x79, 0x85, 0x4F, 0x4C, 0xC5, 0x4D,
+    0x34, 0xB7, 0xC8, 0x86, 0xE6, 0xEF, 0xF3, 0x20, 0x7C, 0x92, 0x5D, 0xA5, 0xC9, 0x3B, 0x3C, 0x51,
+    0x4E, 0x3D, 0x6D, 0x73, 0xCE, 0x28, 0x5A, 0x60, 0x49, 0xD0, 0x6A, 0xAC, 0x0A, 0x27, 0xDC, 0x5D,
+    0xDC, 0x39, 0x9F, 0x34, 0xD4, 0x3E, 0x27, 0x18, 0xA5, 0x4A, 0x11, 0x36, 0x18, 0xAF, 0x08, 0x14,
+    0x22, 0x0E, 0x92, 0xD5, 0xF3, 0x23, 0xE9, 0x54, 0xE6, 0x47, 0x49, 0x92, 0xD8, 0xAA, 0x2D, 0x3F,
+    0xD3, 0xA2, 0xD9, 0xBE, 0x22, 0xEA, 0x0D, 0x6D, 0xBB, 0x4A, 0xF8, 0x9E, 0x43, 0x54, 0x0B, 0x37,
+    0x56, 0x76, 0x7B, 0x35, 0xF3, 0x13, 0x51, 0x87, 0x0D, 0x7D, 0xC3, 0x57, 0x6A, 0x2B, 0x54, 0xEA,
+    0x69, 0x28, 0xE5, 0x70, 0xDB, 0xAA, 0x1B, 0xCD, 0x93, 0xE2, 0xBA, 0xBF, 0x2B, 0xBF, 0x0A, 0x23,
+    0x8A, 0x7C, 0x8A, 0xAC, 0x4E, 0xA3, 0x09, 0x27, 0xC0, 0x4F, 0x64, 0xC7, 0x0F, 0x18, 0x7D, 0x84,
+    0xAB, 0xC2, 0x5D, 0x41, 0x50, 0xB8, 0xAA, 0xAC, 0xF8, 0xBA, 0xE6, 0xF8, 0x3B, 0xC3, 0x0A, 0x48,
+    0xCF, 0x37, 0xA4, 0x37, 0xEB, 0x38, 0x2B, 0x49, 0xE4, 0x1E, 0xDA, 0x8A, 0xC0, 0x6E, 0x4E, 0xB4,
+    0x20, 0xC7, 0x2A, 0xB2, 0x0C, 0x1D, 0xF1, 0x12, 0x9E, 0x77, 0x27, 0x98, 0x13, 0x81, 0x1D, 0xB2,
+    0xE0, 0xC2, 0x1B, 0x6C, 0xB1, 0x28, 0x2D, 0x2E, 0x52, 0xA4, 0x83, 0xBA, 0xD6, 0xC3, 0xD4, 0x22,
+    0x19, 0x4C, 0xF2, 0xDA, 0x0D, 0x23, 0x78, 0x73, 0x98, 0x82, 0x9C, 0x70, 0xB4, 0x0C, 0x19, 0xD2,
+    0xB8, 0xE3, 0x95, 0x49, 0xBA, 0x9B, 0xE9, 0xE2, 0x7E, 0x16, 0x03, 0x1E, 0xD2, 0x3F, 0x35, 0x0E,
+    0x5B, 0x18, 0x97, 0xF5, 0x86, 0x43, 0x25, 0x29, 0x89, 0xE3, 0xE1, 0x1F, 0xA9, 0x97, 0xA9, 0xA5,
+    0xCC, 0x60, 0x90, 0xA7, 0x53, 0x24, 0x53, 0x8C, 0x39, 0x99, 0x92, 0x9E, 0x17, 0x2B, 0xD0, 0xB5,
+    0x72, 0xA2, 0xC5, 0x94, 0x9C, 0x37, 0x75, 0xD6, 0x9E, 0x03, 0x37, 0x67, 0xA9, 0xB4, 0x32, 0xF0,
+    0xCE, 0x95, 0x75, 0x11, 0x94, 0x17, 0x1D, 0x4F, 0xE7, 0xD4, 0x32, 0x0C, 0x6A, 0x38, 0xF4, 0xAA,
+    0xC9, 0x5B, 0x91, 0x62, 0x4A, 0x87, 0x53, 0x32, 0x5B, 0x5B, 0xD9, 0x14, 0x6C, 0x9D, 0xE1, 0xB0,
+    0x4B, 0xAC, 0x41, 0x62, 0x89, 0x64, 0x71, 0x39, 0x31, 0x5F, 0xCF, 0x02, 0x6D, 0xC9, 0xA2, 0xA0,
+    0xBD, 0xEC, 0x8B, 0x0E, 0x73, 0x66, 0x77, 0x66, 0x31, 0x0D, 0x79, 0x13, 0x6D, 0x19, 0x63, 0x16,
+    0xFF, 0xED, 0xCE, 0x4D, 0xB5, 0x2B, 0x1A, 0xDA, 0x26, 0x49, 0x1C, 0xAD, 0xE9, 0x5A, 0xDF, 0x68,
+    0xB3, 0x70, 0x82, 0x72, 0xB3, 0x16, 0xA4, 0x96, 0x69, 0x21, 0x16, 0x7F, 0x33, 0xD2, 0x0D, 0x7D,
+    0x96, 0xBD, 0x1E, 0x35, 0x2C, 0xA0, 0xE1, 0x7F, 0x51, 0x37, 0x5C, 0x0F, 0x33, 0xE8, 0x3F, 0xBD,
+    0x55, 0x31, 0x8F, 0xD5, 0x46, 0x10, 0x1E, 0xFB, 0xE5, 0x30, 0x92, 0xA5, 0x98, 0x02, 0x10, 0x02,
+    0x89, 0x47, 0x91, 0x8A, 0x70, 0x72, 0x4A, 0x8A, 0xBB, 0x67, 0xC3, 0x2F, 0xA0, 0xE0, 0x89, 0x82,
+    0x82, 0x96, 0xEE, 0x9A, 0x14, 0x14, 0xDC, 0x3D, 0x53, 0xA5, 0xBD, 0x26, 0x4A, 0x87, 0x14, 0x89,
+    0x02, 0x1E, 0x8A, 0x2E, 0xC5, 0x95, 0xEF, 0xB0, 0x01, 0x41, 0x6D, 0x74, 0x82, 0x02, 0x1A, 0x23,
+    0x44, 0x03, 0x42, 0x59, 0xC2, 0x2B, 0x2C, 0x62, 0xDF, 0xE4, 0xFB, 0x76, 0xED, 0xE3, 0x38, 0x84,
+    0x44, 0xC5, 0x4A, 0xB3, 0x1E, 0xEF, 0xCE, 0xCE, 0x7C, 0xFB, 0xCD, 0xEE, 0xCE, 0xE9, 0xE9, 0xF4,
+    0x4F, 0x55, 0x7D, 0x3C, 0x9D, 0xDE, 0x91, 0x5F, 0x44, 0xBC, 0xDF, 0x52, 0x91, 0xB3, 0x4B, 0x22,
+    0x91, 0x5F, 0x49, 0x50, 0x44, 0x99, 0x3F, 0x97, 0x44, 0x6B, 0x91, 0x15, 0x88, 0xC8, 0x18, 0x92,
+    0xEF, 0x40, 0xC6, 0xAD, 0xC4, 0xE2, 0x99, 0x30, 0x93, 0xC1, 0x8D, 0x52, 0xE4, 0xCC, 0x59, 0x4C,
+    0x3C, 0x81, 0xFC, 0x00, 0x59, 0x80, 0x2C, 0x42, 0xAE, 0x41, 0x0C, 0x5C, 0x62, 0x7E, 0x50, 0x88,
+    0x84, 0xF0, 0x7C, 0x12, 0x43, 0x70, 0x2E, 0x9B, 0x6E, 0xCA, 0xC7, 0x70, 0x00, 0x89, 0x20, 0x31,
+    0x64, 0x19, 0xA6, 0xA6, 0x12, 0xAF, 0x32, 0x58, 0x61, 0xB0, 0xE2, 0x6F, 0xF9, 0x11, 0xB6, 0x4B,
+    0xD6, 0x15, 0x3C, 0x49, 0xD7, 0x06, 0xA6, 0x57, 0xAA, 0x5E, 0x29, 0xDD, 0x77, 0x9D, 0x91, 0xD8,
+    0xDA, 0x20, 0x73, 0x8A, 0xBE, 0x4D, 0x9D, 0x12, 0xEA, 0x46, 0xE3, 0xB4, 0x44, 0x3B, 0x25, 0xBF,
+    0x71, 0xD5, 0x7E, 0xFD, 0x0F, 0xDD, 0xAA, 0xE8, 0x41, 0xE7, 0x30, 0x39, 0xD7, 0x85, 0x18, 0x49,
+    0xED, 0x94, 0x83, 0x62, 0x17, 0x79, 0x73, 0x91, 0x5B, 0xE0, 0xC6, 0x2A, 0xE2, 0x1B, 0x27, 0xEC,
+    0x0E, 0x71, 0xF4, 0x10, 0x80, 0xAC, 0xFA, 0x00, 0xB3, 0x05, 0x20, 0xF9, 0x36, 0xDC, 0x2A, 0xBA,
+    0x13, 0xFA, 0xF4, 0x0E, 0xBA, 0xDF, 0x6F, 0xCB, 0x8A, 0xB6, 0xE0, 0x12, 0xF1, 0xE3, 0x67, 0x5B,
+    0x88, 0xF2, 0xBC, 0x91, 0x7B, 0x8C, 0xF8, 0xB1, 0xC4, 0x9E, 0xE0, 0x67, 0xF0, 0xDE, 0x48, 0x54,
+    0xD6, 0x64, 0x64, 0x2E, 0x71, 0x36, 0x03, 0x2D, 0x69, 0x23, 0xA1, 0xAC, 0x0A, 0x88, 0xC0, 0x9F,
+    0x2C, 0x13, 0xC3, 0xAA, 0xEC, 0x69, 0xA1, 0xBE, 0xD2, 0xF9, 0xF8, 0x22, 0x55, 0xB2, 0x2B, 0x43,
+    0x6E, 0x37, 0xE2, 0xE6, 0xC9, 0xAA, 0x84, 0xEC, 0x82, 0xB2, 0xE7, 0xCA, 0x82, 0xF5, 0xEC, 0xDE,
+    0x88, 0xDF, 0x6D, 0x8E, 0x8E, 0xE5, 0xBA, 0xF4, 0xEE, 0x47, 0xEC, 0x62, 0xEB, 0xCB, 0x72, 0xB2,
+    0xEB, 0xD0, 0xF9, 0x2A, 0x7A, 0xBA, 0x3F, 0x39, 0x84, 0xAE, 0x85, 0x4C, 0x80, 0xF4, 0x4D, 0x46,
+    0x9A, 0x68, 0x5D, 0x5B, 0x28, 0x9C, 0x4E, 0x9C, 0xE9, 0xAA, 0x73, 0x80, 0x60, 0xD1, 0x53, 0xD0,
+    0x32, 0x97, 0xA1, 0xEE, 0x4E, 0x1B, 0x1B, 0x95, 0x30, 0x67, 0x0E, 0x37, 0x57, 0x67, 0x96, 0xE3,
+    0x98, 0xCE, 0x2B, 0x49, 0x5A, 0xF1, 0xC6, 0x40, 0x12, 0x20, 0x50, 0xDE, 0xC8, 0x81, 0x0D, 0xCC,
+    0x7E, 0x2D, 0x44, 0xD3, 0xFB, 0x58, 0x58, 0x49, 0x3D, 0x35, 0x0C, 0x64, 0xA7, 0xD7, 0xBE, 0x08,
+    0xE1, 0x56, 0xC7, 0x0E, 0xC1, 0x1A, 0x02, 0x95, 0xDC, 0x85, 0x0D, 0xE4, 0x9A, 0x07, 0x9C, 0x27,
+    0x34, 0x8B, 0x55, 0x45, 0x75, 0x3E, 0x7C, 0x9D, 0x67, 0x3B, 0x97, 0x9B, 0x83, 0x32, 0x2C, 0x2E,
+    0x48, 0xEB, 0xDC, 0x6C, 0xED, 0xFF, 0x00, 0x37, 0x11, 0x00, 0x92, 0x8F, 0x10, 0xB8, 0x2C, 0xA1,
+    0x91, 0x00, 0x5A, 0x52, 0x48, 0x8C, 0xB3, 0x0D, 0x2C, 0x79, 0xCA, 0x01, 0x8F, 0x30, 0x4B, 0x1B,
+    0x39, 0x76, 0xB4, 0x8E, 0x1C, 0xFC, 0xEB, 0xEE, 0xA4, 0x1F, 0x96, 0x7D, 0x8D, 0x99, 0xA5, 0x1F,
+    0xDC, 0x39, 0x2C, 0x9D, 0x74, 0x1F, 0x60, 0xAF, 0x9D, 0xF1, 0x85, 0x5D, 0x43, 0x4D, 0xA5, 0x25,
+    0xE4, 0xE1, 0xFD, 0x9D, 0xCB, 0xB5, 0x67, 0xF1, 0xC6, 0x44, 0x35, 0x98, 0x13, 0x25, 0x90, 0x41,
+    0x35, 0x44, 0xBA, 0xC6, 0x9D, 0x87, 0x25, 0x61, 0xCE, 0xE8, 0x32, 0xB2, 0x18, 0x6B, 0x09, 0x91,
+    0x9D, 0x14, 0x00, 0x71, 0x52, 0x12, 0xC2, 0x03, 0x3A, 0x10, 0x38, 0xE3, 0x01, 0x01, 0x34, 0x2F,
+    0xDD, 0x83, 0x8A, 0x39, 0xAA, 0x09, 0x2A, 0x29, 0xB0, 0x29, 0x40, 0x9A, 0x10, 0x22, 0x4D, 0x3E,
+    0xE1, 0x29, 0x42, 0x10, 0x1B, 0x17, 0xAA, 0x34, 0xCC, 0xFF, 0x68, 0x25, 0x49, 0x4F, 0xC9, 0x3D,
+    0xBA, 0x86, 0xF5, 0x84, 0xD7, 0x0D, 0x7F, 0x4C, 0x00, 0xE8, 0x83, 0x60, 0x5B, 0x88, 0x8D, 0x3E,
+    0x30, 0xDC, 0x70, 0x5C, 0x32, 0x46, 0x9E, 0x22, 0x55, 0x70, 0x0F, 0xE0, 0x61, 0x45, 0x34, 0x38,
+    0x64, 0x38, 0x86, 0x8E, 0xBA, 0x91, 0x05, 0x75, 0xF8, 0x0B, 0xBE, 0x66, 0xA4, 0xDD, 0x43, 0xA6,
+    0x26, 0x85, 0x8F, 0x3E, 0x49, 0xFD, 0xC6, 0xBE, 0x51, 0x80, 0x96, 0xE3, 0xD5, 0x4B, 0x20, 0x8F,
+    0xC6, 0xE3, 0x4B, 0xDD, 0x2D, 0xE6, 0x81, 0xB2, 0xB7, 0x7C, 0xCB, 0x42, 0x72, 0x97, 0x80, 0xE9,
+    0x64, 0x66, 0xC9, 0x52, 0x60, 0xDC, 0x49, 0xF9, 0xCC, 0x90, 0xF8, 0x8F, 0xE0, 0x02, 0x82, 0xF0,
+    0x3A, 0x84, 0xC3, 0x07, 0xAF, 0x27, 0x5A, 0x6F, 0x46, 0xAA, 0x8B, 0x03, 0xC5, 0xE3, 0xA3, 0xBA,
+    0x53, 0x22, 0x0E, 0x07, 0xDE, 0x61, 0xE0, 0xBF, 0xBD, 0x03, 0x7F, 0x61, 0xE0, 0x05, 0x06, 0xFE,
+    0xC5, 0x80, 0xC1, 0x40, 0xB5, 0x88, 0x57, 0x23, 0x4C, 0x8D, 0xF8, 0x25, 0x5E, 0xC9, 0xCD, 0x08,
+    0xEF, 0xE8, 0x37, 0x0D, 0xB8, 0xF6, 0xB3, 0x6A, 0x09, 0x10, 0x2D, 0x40, 0x5C, 0x7A, 0xA2, 0x6A,
+    0x16, 0xF1, 0xE3, 0x6F, 0x53, 0x49, 0xBE, 0xAE, 0xD0, 0xA6, 0xA4, 0x82, 0x55, 0x77, 0xED, 0x72,
+    0x39, 0x3E, 0x9D, 0xAE, 0x63, 0x7E, 0x1D, 0xE0, 0xB4, 0x58, 0xBE, 0xA2, 0x3A, 0x28, 0x72, 0xAD,
+    0x97, 0x60, 0xF0, 0x10, 0x4A, 0x43, 0x65, 0x1B, 0x4A, 0x4B, 0xE5, 0x55, 0xAF, 0x6C, 0xF7, 0x53,
+    0xB4, 0xA9, 0x47, 0x1B, 0x58, 0xC5, 0xE5, 0xA7, 0xA7, 0xD3, 0xEE, 0x1D, 0xB6, 0x64, 0x92, 0x48,
+    0xA4, 0xEE, 0x18, 0x1E, 0x9F, 0xA8, 0x5A, 0xC2, 0x7D, 0xBB, 0x29, 0x72, 0x40, 0xFF, 0xC1, 0xC3,
+    0x81, 0xD3, 0x1A, 0x34, 0x47, 0xB3, 0xE0, 0x45, 0x2A, 0xE1, 0x4B, 0xA4, 0xD8, 0x2C, 0x23, 0x25,
+    0x30, 0xFF, 0xC9, 0xE7, 0x3B, 0xF5, 0xAB, 0x48, 0x1A, 0x95, 0xF9, 0xF9, 0x36, 0xA8, 0xF6, 0xDF,
+    0x0A, 0x24, 0x0A, 0x87, 0x39, 0x2A, 0x62, 0x99, 0x79, 0x66, 0x50, 0x2C, 0xF4, 0x65, 0xCA, 0xD6,
+    0x29, 0x5B, 0xA8, 0x6C, 0xA5, 0x12, 0x96, 0xAA, 0x8C, 0xB5, 0xE8, 0x8C, 0xB0, 0x58, 0x95, 0x5E,
+    0x57, 0xAD, 0xBE, 0x63, 0x63, 0x7D, 0xCD, 0x02, 0x16, 0x58, 0x16, 0xC1, 0x48, 0x6C, 0x89, 0x15,
+    0x5B, 0x63, 0x5D, 0x91, 0xED, 0xAA, 0xEC, 0xF7, 0x6C, 0xFF, 0x03, 0x9D, 0x55, 0xBD, 0x6F, 0x1C,
+    0x45, 0x14, 0x7F, 0xB3, 0x63, 0x7B, 0x85, 0x57, 0x78, 0x5D, 0x00, 0x12, 0x1F, 0xF2, 0xD6, 0x48,
+    0xC1, 0xDB, 0xBA, 0xB8, 0xF3, 0xAE, 0xED, 0x3F, 0x00, 0x17, 0x9C, 0x5C, 0x50, 0xD0, 0x50, 0x20,
+    0x1A, 0x1A, 0x17, 0x2E, 0x2E, 0xBE, 0x15, 0xF9, 0x03, 0x72, 0x88, 0x0E, 0x0A, 0x28, 0x68, 0x62,
+    0x0A, 0x52, 0x50, 0x5C, 0xE1, 0x64, 0x27, 0xA4, 0xA0, 0x70, 0xC1, 0x2A, 0x28, 0xA2, 0x70, 0xB3,
+    0x89, 0x81, 0x22, 0x29, 0x98, 0x84, 0x51, 0xB4, 0x4E, 0xE6, 0x76, 0xF8, 0xBD, 0xB9, 0x53, 0xE2,
+    0x44, 0x41, 0x3E, 0x98, 0xBD, 0x7D, 0x37, 0x3B, 0xEF, 0xE3, 0xF7, 0xDE, 0x9B, 0x37, 0x6F, 0x88,
+    0x04, 0x61, 0xC4, 0x0A, 0x64, 0x1D, 0xAF, 0xD0, 0x44, 0xC3, 0x50, 0x91, 0x34, 0x2B, 0x44, 0xC9,
+    0xF8, 0x2A, 0xD1, 0x82, 0xBB, 0xDF, 0x12, 0x65, 0xAE, 0xA1, 0xA0, 0x9D, 0x1F, 0x52, 0xD6, 0x21,
+    0x92, 0xDA, 0x60, 0x65, 0x13, 0xA2, 0x4D, 0x58, 0x11, 0x15, 0x5E, 0xFB, 0x5D, 0x3A, 0x33, 0xD2,
+    0x1C, 0xE4, 0x10, 0x6F, 0xA0, 0x99, 0x9F, 0x53, 0x54, 0x43, 0x2F, 0x6D, 0x34, 0xDB, 0xFB, 0x6B,
+    0x4C, 0x34, 0x70, 0x86, 0x42, 0xFB, 0x46, 0x41, 0x17, 0x47, 0x44, 0xE1, 0x1D, 0xAC, 0x0F, 0x64,
+    0x0D, 0xF4, 0x48, 0x91, 0xC8, 0x13, 0xD6, 0x5E, 0xF3, 0x86, 0x92, 0x22, 0x3C, 0xD2, 0xF2, 0xAE,
+    0x15, 0xA6, 0xCB, 0xF6, 0xBA, 0x58, 0x81, 0xB7, 0x05, 0x01, 0x97, 0x4D, 0x37, 0x44, 0x7D, 0xEF,
+    0x38, 0x43, 0xC0, 0xEB, 0xDA, 0x07, 0x60, 0xBD, 0x60, 0x3A, 0x11, 0x54, 0x8B, 0x5B, 0x3A, 0xD2,
+    0x26, 0xB0, 0x87, 0x34, 0x20, 0x8E, 0xF6, 0x75, 0xB6, 0x2E, 0xA8, 0x74, 0xBF, 0xC3, 0xBD, 0xCA,
+    0x39, 0xFC, 0x0B, 0xDD, 0xD0, 0xDB, 0xEE, 0xF1, 0x8E, 0xD9, 0x83, 0x33, 0xCE, 0x99, 0x77, 0x20,
+    0x31, 0x5F, 0x0E, 0x41, 0x97, 0x21, 0xEA, 0xE0, 0xAF, 0xFB, 0xAA, 0x01, 0x8C, 0xAC, 0x81, 0x13,
+    0x4B, 0x84, 0xBB, 0xB6, 0x0B, 0xE5, 0x1B, 0x13, 0x01, 0x4C, 0x29, 0x2A, 0x48, 0x14, 0xA3, 0x57,
+    0x69, 0x3D, 0xBA, 0xA4, 0xA9, 0x19, 0x59, 0x92, 0xF7, 0x4B, 0xE0, 0x3B, 0x25, 0x7A, 0xE5, 0x69,
+    0x2F, 0x03, 0xCA, 0xC3, 0x03, 0xF7, 0xF8, 0x80, 0x57, 0x48, 0x3E, 0x01, 0xCB, 0x42, 0x26, 0x83,
+    0x70, 0xA0, 0x46, 0x4B, 0x5E, 0x9D, 0x68, 0x74, 0x36, 0x83, 0x9C, 0xD3, 0x01, 0x3C, 0x05, 0xB6,
+    0x18, 0xD2, 0x4B, 0x47, 0x08, 0xA5, 0x0C, 0x6F, 0xCB, 0x3B, 0x42, 0xFF, 0x3E, 0x04, 0xCC, 0x64,
+    0x39, 0x09, 0x98, 0x92, 0xD8, 0xB8, 0x85, 0x9C, 0xAE, 0xC5, 0x37, 0x4C, 0x0A, 0xF8, 0xCA, 0x26,
+    0x45, 0x2A, 0xF5, 0xC5, 0x58, 0xC5, 0x9F, 0xEB, 0xF5, 0xB0, 0x8A, 0x54, 0x93, 0xC8, 0x5A, 0x56,
+    0xFD, 0x78, 0x43, 0x07, 0x75, 0x27, 0x54, 0x86, 0xF4, 0x8A, 0x54, 0x7D, 0xDA, 0x5D, 0x14, 0xD5,
+    0x85, 0x33, 0x26, 0xAD, 0xA7, 0xEC, 0x1F, 0x36, 0xA4, 0xF2, 0x20, 0x43, 0x9A, 0x71, 0xEC, 0x79,
+    0x92, 0xB1, 0x6E, 0x76, 0xB9, 0xE6, 0x50, 0x4F, 0xD8, 0x7B, 0x76, 0x6D, 0xB6, 0xB1, 0xEC, 0x69,
+    0x46, 0xCF, 0xC0, 0xA7, 0xE1, 0x7F, 0xFC, 0x2C, 0x7B, 0xBC, 0x1C, 0x9D, 0x34, 0xCC, 0xB3, 0x63,
+    0x5E, 0x69, 0xDF, 0x62, 0xBA, 0x38, 0x2B, 0x86, 0x2F, 0x69, 0x0A, 0xBD, 0x4F, 0xC2, 0x1B, 0xA0,
+    0xD5, 0x59, 0x75, 0x85, 0x2F, 0xB0, 0x2D, 0xE3, 0x83, 0x6A, 0x79, 0xDE, 0x4E, 0xA2, 0xDD, 0x64,
+    0x1A, 0xA0, 0x82, 0x6E, 0x36, 0x6D, 0xFA, 0x32, 0xCD, 0x85, 0x4B, 0xA6, 0xCD, 0x36, 0xA6, 0x47,
+    0x87, 0xF7, 0x75, 0x4A, 0xAE, 0x9D, 0x07, 0x39, 0xC7, 0x69, 0xE1, 0x3D, 0x6E, 0x50, 0x10, 0xD2,
+    0x62, 0x16, 0x58, 0x1C, 0x60, 0xFA, 0xF1, 0x3C, 0xC5, 0x4F, 0x9E, 0x07, 0x1A, 0x3F, 0xCD, 0xAF,
+    0xD8, 0xF6, 0xFC, 0xC6, 0xD3, 0x75, 0xEF, 0x77, 0x5C, 0xBC, 0x42, 0xB2, 0xC1, 0x19, 0xA8, 0x20,
+    0xDC, 0xC8, 0x06, 0x45, 0xB5, 0x0E, 0x0D, 0x01, 0xC6, 0x3C, 0xC7, 0x5A, 0xBF, 0xA0, 0xE1, 0xCF,
+    0x1F, 0xCE, 0x19, 0x8F, 0xCF, 0x3C, 0xBD, 0xDD, 0xEB, 0xED, 0xF7, 0x7A, 0xDB, 0x13, 0xC6, 0x73,
+    0x1A, 0x73, 0xD0, 0x58, 0xC6, 0xB6, 0xC5, 0x45, 0xE6, 0x31, 0x12, 0x8F, 0x11, 0x6A, 0x5A, 0x01,
+    0x63, 0x44, 0x2F, 0x68, 0x7C, 0xE7, 0x8D, 0x1F, 0x3D, 0x1A, 0x67, 0xD3, 0x8C, 0x7F, 0x31, 0x2E,
+    0xBF, 0xB9, 0x35, 0xE1, 0x51, 0x96, 0x1E, 0x9F, 0x5A, 0x24, 0x24, 0xB9, 0xFC, 0xB7, 0x2D, 0xE1,
+    0xD8, 0x76, 0x99, 0xFD, 0xF2, 0x00, 0x18, 0xC1, 0x97, 0xD6, 0x65, 0x3F, 0x0D, 0x9F, 0x32, 0x9C,
+    0xDB, 0xB9, 0x1D, 0x14, 0xFC, 0x48, 0xE5, 0xDC, 0x64, 0x76, 0xFE, 0x23, 0x72, 0xE7, 0xFE, 0xF8,
+    0xB0, 0x0A, 0xF9, 0xA9, 0xA3, 0xFF, 0xA2, 0x57, 0xB6, 0x99, 0x4D, 0x9B, 0x58, 0x47, 0xB5, 0x54,
+    0xB3, 0x6A, 0xB1, 0x1E, 0x17, 0x94, 0x54, 0x61, 0x15, 0xEB, 0xC4, 0x64, 0xB6, 0x6C, 0x67, 0xD7,
+    0x0C, 0x8A, 0xA8, 0xBE, 0xB0, 0x76, 0x75, 0xA9, 0xD3, 0x89, 0xF5, 0xEC, 0x98, 0x88, 0xB0, 0xD8,
+    0x29, 0xFE, 0x4F, 0x66, 0xE8, 0x4D, 0x74, 0xCF, 0x7C, 0xBF, 0x94, 0x75, 0x37, 0x25, 0x63, 0xE4,
+    0x89, 0x8A, 0x3F, 0xA2, 0xEE, 0x21, 0x3D, 0xAC, 0xC3, 0xA3, 0x62, 0x15, 0x4B, 0xFD, 0x48, 0xB5,
+    0x56, 0xA0, 0x05, 0x7E, 0xC0, 0xFB, 0x47, 0xE8, 0xD6, 0x79, 0x47, 0x16, 0xBB, 0x11, 0xE9, 0x25,
+    0x51, 0xBF, 0x27, 0x55, 0xC7, 0x1F, 0x1D, 0x6E, 0x2F, 0x41, 0x43, 0x91, 0xA1, 0x15, 0x43, 0x7D,
+    0x4D, 0x0F, 0xB4, 0xBC, 0x55, 0x47, 0x5B, 0xD5, 0xAA, 0x54, 0x99, 0xB3, 0x03, 0x67, 0xB9, 0x5D,
+    0x72, 0x23, 0x9E, 0xD6, 0x70, 0xE4, 0xAA, 0xCC, 0xE5, 0x9A, 0x57, 0xD1, 0xF6, 0x9F, 0x0C, 0x43,
+    0x57, 0xCF, 0xE1, 0x32, 0x80, 0x04, 0x3E, 0x4D, 0x1E, 0xDD, 0xBC, 0x37, 0x86, 0x08, 0x17, 0xB4,
+    0xD8, 0x16, 0xAE, 0x4E, 0xEE, 0x6D, 0x18, 0x66, 0xEE, 0x91, 0x3C, 0x36, 0xB1, 0x33, 0xFB, 0xF2,
+    0x8E, 0x0E, 0x7F, 0x56, 0x2B, 0x09, 0x8D, 0xFA, 0xA1, 0x6A, 0xAF, 0x93, 0xAB, 0xBD, 0x7F, 0xB0,
+    0x6B, 0xF1, 0x83, 0x09, 0xBE, 0x6A, 0x70, 0x27, 0xA2, 0x04, 0x53, 0x7F, 0xB3, 0x58, 0xBE, 0x65,
+    0x50, 0x8A, 0x00, 0xC1, 0x55, 0x35, 0xAD, 0xC1, 0xF9, 0x9C, 0x4A, 0x13, 0x9C, 0x1E, 0xCA, 0xAA,
+    0x2B, 0x55, 0x17, 0x3D, 0x54, 0x3C, 0x32, 0xE4, 0x8A, 0xD0, 0x55, 0xC9, 0xA6, 0xEE, 0x92, 0xE9,
+    0x90, 0xE9, 0x0A, 0x9D, 0x7E, 0x8D, 0xA2, 0xC9, 0xD9, 0xFE, 0x6B, 0xB0, 0x4F, 0xD7, 0xCB, 0xB0,
+    0xEA, 0xAC, 0x72, 0xAE, 0x7E, 0xAD, 0xE2, 0xF7, 0x0B, 0x9B, 0x38, 0x9D, 0x1C, 0x73, 0x18, 0x40,
+    0x4C, 0x83, 0xEF, 0x4D, 0xDC, 0xB2, 0x5D, 0xFA, 0x96, 0x63, 0xD5, 0x20, 0x03, 0xF7, 0xE7, 0x0F,
+    0x57, 0xFC, 0x0C, 0x84, 0x0F, 0x5D, 0xE8, 0xDA, 0x4F, 0x0F, 0x86, 0x03, 0xF7, 0x9B, 0x9B, 0x34,
+    0xA9, 0x81, 0xBB, 0x7B, 0x70, 0x05, 0x87, 0x26, 0x41, 0x84, 0x51, 0x11, 0x2A, 0x78, 0xA9, 0x71,
+    0x45, 0xAE, 0xE2, 0x53, 0x56, 0x98, 0x76, 0x26, 0x93, 0x11, 0x2C, 0x04, 0xDC, 0xE2, 0xFE, 0x01,
+    0x6D, 0x55, 0x3D, 0x8C, 0xDC, 0x44, 0x14, 0xFE, 0xC6, 0x93, 0xC4, 0x28, 0x96, 0x32, 0x29, 0x12,
+    0xA1, 0x80, 0x38, 0x37, 0x54, 0x49, 0x76, 0xDD, 0x5E, 0xE1, 0x3D, 0x5B, 0xA1, 0x4C, 0xC1, 0x15,
+    0x09, 0x6D, 0x52, 0x50, 0x40, 0x24, 0x94, 0x26, 0xC5, 0x49, 0x6C, 0xB2, 0x16, 0x91, 0x68, 0x28,
+    0x72, 0x15, 0x0D, 0x05, 0x57, 0x20, 0x74, 0x59, 0x90, 0x8E, 0x62, 0x05, 0x2B, 0x74, 0x77, 0x3B,
+    0x97, 0x2B, 0xAE, 0x35, 0xA1, 0xA0, 0xA0, 0xC8, 0x28, 0x01, 0x05, 0x1D, 0xA0, 0x4C, 0xC0, 0x88,
+    0x4D, 0xE2, 0xDD, 0xE1, 0x1B, 0xFB, 0x12, 0xA5, 0xC0, 0x3F, 0x63, 0x7B, 0xE7, 0xCD, 0x9B, 0xF7,
+    0x7D, 0xEF, 0xBD, 0x6F, 0x61, 0x31, 0x42, 0x1F, 0x29, 0xCF, 0x5E, 0x73, 0xA6, 0xFC, 0xDA, 0x44,
+    0x25, 0x6C, 0x60, 0x42, 0xAD, 0xF2, 0x2E, 0xC6, 0x10, 0x62, 0x35, 0xBC, 0x3A, 0x8D, 0xAA, 0xBE,
+    0xD2, 0xA9, 0xCA, 0xD3, 0x18, 0xFD, 0x0E, 0xC6, 0x29, 0x46, 0x29, 0x6C, 0x1F, 0x76, 0x45, 0x98,
+    0x65, 0x91, 0xE3, 0x14, 0x42, 0x97, 0x0F, 0x26, 0xD2, 0xF4, 0x62, 0x8C, 0xA7, 0xC1, 0x83, 0x32,
+    0xBA, 0x85, 0xA5, 0x3E, 0xFE, 0xB1, 0x72, 0x4F, 0x27, 0x31, 0xA6, 0xBD, 0x48, 0xCF, 0x67, 0x70,
+    0x25, 0x2E, 0x00, 0x90, 0x76, 0xF2, 0xF9, 0x6C, 0x6C, 0x43, 0x9D, 0x60, 0x2A, 0x4B, 0x3A, 0x0C,
+    0x8C, 0xCA, 0x7B, 0xC2, 0x72, 0xEA, 0x70, 0x0E, 0x57, 0xC9, 0xA7, 0xB5, 0xC8, 0x7B, 0x60, 0x38,
+    0x8C, 0x06, 0x53, 0x04, 0x16, 0x91, 0x46, 0x02, 0xD4, 0x90, 0x06, 0x71, 0x8E, 0xCC, 0xD9, 0x81,
+    0xF3, 0xE6, 0xB4, 0x17, 0xB4, 0xDF, 0xAF, 0x1B, 0xE3, 0xC6, 0xFE, 0x48, 0x05, 0x57, 0x60, 0xA3,
+    0x84, 0xF7, 0x57, 0xF1, 0x3A, 0x1E, 0xD8, 0xA5, 0x8D, 0x32, 0x73, 0xB9, 0x58, 0x46, 0x73, 0x6C,
+    0x41, 0xD0, 0x51, 0x0D, 0x35, 0x46, 0xAF, 0xC2, 0x88, 0x50, 0x6D, 0xB8, 0x63, 0x55, 0x60, 0x32,
+    0x37, 0xCB, 0x5C, 0x8D, 0x50, 0x23, 0x2A, 0xFC, 0xD5, 0x1C, 0x91, 0xE3, 0x5A, 0xFA, 0xE2, 0x77,
+    0x0A, 0x3C, 0x5B, 0x0D, 0x9D, 0x39, 0xC4, 0x68, 0x54, 0xEE, 0xB7, 0xB3, 0x79, 0xB4, 0xBB, 0x5F,
+    0x47, 0x4E, 0x7B, 0xDF, 0xBC, 0x27, 0x36, 0xDE, 0xCF, 0x2B, 0xA8, 0x82, 0x81, 0x04, 0x0F, 0x2B,
+    0xE5, 0xAA, 0x2C, 0xB0, 0x55, 0xB8, 0xA7, 0x63, 0xD2, 0xD2, 0x93, 0xE5, 0xF6, 0x36, 0x9C, 0xC1,
+    0x89, 0xD6, 0xEF, 0x2C, 0xE2, 0x66, 0x2D, 0x3C, 0x59, 0xFA, 0x35, 0x31, 0xB0, 0x04, 0xD2, 0x2F,
+    0x2A, 0x8F, 0x93, 0x61, 0xF0, 0xB7, 0xA4, 0x8D, 0xE2, 0x24, 0xF9, 0x2D, 0x6E, 0x5C, 0x7D, 0xCB,
+    0x74, 0x55, 0x3E, 0xEE, 0xCA, 0x72, 0x69, 0x0B, 0x13, 0xAD, 0x1E, 0x15, 0xD3, 0xF8, 0x7C, 0xB1,
+    0xD4, 0xC3, 0x78, 0x2C, 0x7F, 0x98, 0x4D, 0x04, 0x7D, 0x93, 0xDF, 0x13, 0xB4, 0xC5, 0xF6, 0x44,
+    0x96, 0xBD, 0x04, 0xA3, 0x71, 0xF0, 0xA3, 0x51, 0xE7, 0xF5, 0x96, 0x72, 0x36, 0x7E, 0xA8, 0x19,
+    0x33, 0xA1, 0xC4, 0xE7, 0xBE, 0xAA, 0xA2, 0xB9, 0xE7, 0x1A, 0x97, 0x11, 0x01, 0xDF, 0x70, 0xC8,
+    0xDC, 0xFD, 0x8D, 0x61, 0xF3, 0xC6, 0x41, 0xF8, 0x24, 0x39, 0x77, 0x7A, 0xB8, 0x96, 0xB9, 0x07,
+    0x6E, 0xDE, 0x44, 0x40, 0x83, 0xE1, 0x6D, 0x52, 0x50, 0x49, 0x13, 0xB1, 0x32, 0x12, 0xBA, 0xF2,
+    0xA5, 0x32, 0x26, 0xC7, 0xED, 0x39, 0x6E, 0x0A, 0xA9, 0xE3, 0xD7, 0xAF, 0xBC, 0xA8, 0xA8, 0xCE,
+    0x8B, 0xAA, 0xA2, 0x61, 0x60, 0xA5, 0x56, 0x45, 0xE2, 0x93, 0xFA, 0xFE, 0x2B, 0xD2, 0x7D, 0xAD,
+    0xF2, 0x69, 0x07, 0x15, 0x5D, 0xAE, 0xC0, 0x8E, 0x78, 0x05, 0x66, 0x14, 0x96, 0xFD, 0x44, 0x27,
+    0x7F, 0x69, 0x1F, 0xDB, 0x15, 0x64, 0xB5, 0x0A, 0xEE, 0x96, 0x9D, 0x34, 0xDA, 0x73, 0xE6, 0xFB,
+    0xE5, 0x28, 0x67, 0xB1, 0xCA, 0xF2, 0x72, 0xEC, 0x48, 0x07, 0x67, 0x63, 0x97, 0x57, 0x4A, 0xE5,
+    0x9D, 0x14, 0xDF, 0x96, 0xC1, 0xCF, 0xB9, 0xEA, 0x20, 0x1D, 0x05, 0x65, 0xD5, 0x6D, 0x69, 0x10,
+    0xC5, 0x51, 0x8C, 0x54, 0xAE, 0xA2, 0x3C, 0xF8, 0xA9, 0x40, 0x56, 0xF8, 0x12, 0x0A, 0xC9, 0xF4,
+    0x9F, 0x90, 0xBB, 0x5A, 0xEA, 0x91, 0x2C, 0x95, 0x87, 0x25, 0x6E, 0xC3, 0xD5, 0x87, 0x02, 0x03,
+    0x7E, 0xD9, 0xD7, 0x9C, 0xDA, 0x7F, 0x50, 0x76, 0x16, 0xC3, 0xDD, 0x1D, 0x9B, 0xD4, 0x24, 0x52,
+    0x94, 0x9E, 0x10, 0xE6, 0xDD, 0x22, 0xFC, 0x78, 0xB5, 0xE3, 0xCC, 0x5C, 0xEE, 0x1A, 0x15, 0x63,
+    0xF1, 0x9A, 0xB8, 0xAF, 0xA3, 0xB7, 0x91, 0x2E, 0xE2, 0x71, 0x19, 0x7E, 0x92, 0x77, 0xBC, 0xA7,
+    0x97, 0x6C, 0x8B, 0x77, 0x3B, 0xA1, 0xB6, 0x2B, 0x72, 0xAF, 0x58, 0x18, 0x63, 0xA0, 0x83, 0x67,
+    0x85, 0x52, 0x58, 0x5C, 0x10, 0x65, 0x1A, 0xE5, 0x2B, 0xDE, 0xD6, 0x74, 0xA4, 0x4E, 0xC3, 0x62,
+    0xA4, 0x60, 0x8F, 0x89, 0xF2, 0x6C, 0xFB, 0x01, 0x04, 0x47, 0x8A, 0xD3, 0xF8, 0xCE, 0xC5, 0xB5,
+    0x2A, 0x3F, 0x3C, 0x57, 0x56, 0xA1, 0xEE, 0x28, 0xAC, 0x04, 0x3B, 0x26, 0x42, 0x7A, 0x16, 0x56,
+    0xDE, 0xD4, 0xC7, 0x70, 0x2D, 0x15, 0x26, 0x0A, 0x8B, 0x0E, 0xF9, 0x22, 0x9B, 0x4D, 0x6A, 0xC4,
+    0x47, 0xBF, 0xC8, 0x7B, 0x33, 0x59, 0x75, 0xC3, 0x72, 0x21, 0x2A, 0xB8, 0xA4, 0xA7, 0x90, 0x2E,
+    0x1C, 0xF4, 0x29, 0xF9, 0x6D, 0x3A, 0x65, 0x79, 0x1D, 0x3D, 0xA7, 0x55, 0x39, 0x0E, 0xF5, 0xB1,
+    0xC0, 0xC8, 0xC2, 0x0A, 0xC3, 0x26, 0x8E, 0x91, 0x86, 0xBA, 0x1B, 0x4C, 0x13, 0xFC, 0xED, 0xB0,
+    0x78, 0x02, 0x6F, 0xC0, 0x83, 0x90, 0xDA, 0xA3, 0x20, 0x37, 0xD2, 0x3D, 0x36, 0xB8, 0xC6, 0x62,
+    0x67, 0xC7, 0x44, 0x25, 0x13, 0xA7, 0xDE, 0x8C, 0x6E, 0xB9, 0xE2, 0x24, 0x82, 0x42, 0xE6, 0xF1,
+    0xFA, 0xA4, 0x56, 0x58, 0x60, 0x8E, 0x7D, 0xB6, 0x57, 0x68, 0xB7, 0x82, 0x4C, 0x1F, 0x6E, 0x0B,
+    0x36, 0x74, 0xAB, 0x50, 0x6E, 0x0A, 0x55, 0x9D, 0x42, 0x64, 0x7C, 0xCF, 0x13, 0x1D, 0xDB, 0x91,
+    0x3D, 0x0C, 0xDC, 0xC0, 0x95, 0xE1, 0xA5, 0x22, 0x73, 0xBF, 0x97, 0x6A, 0xFF, 0xCB, 0x2A, 0x2C,
+    0xB1, 0xC5, 0x1E, 0x88, 0x0B, 0x76, 0x65, 0x95, 0x01, 0x13, 0xB7, 0xBF, 0x16, 0x3A, 0xF6, 0xC6,
+    0xAB, 0x4F, 0x2E, 0xB6, 0xF6, 0xEC, 0x0A, 0xDF, 0x70, 0xA0, 0x65, 0xEB, 0xC4, 0xB1, 0xC5, 0x33,
+    0xAA, 0x89, 0xC7, 0x75, 0x9C, 0x21, 0xDF, 0x64, 0xC0, 0x54, 0x26, 0x88, 0xA7, 0x95, 0x5F, 0x5F,
+    0xB1, 0x36, 0x5C, 0x19, 0x38, 0xF3, 0x0C, 0xC9, 0xBD, 0x50, 0x8B, 0x9A, 0x54, 0xA8, 0x3B, 0xA5,
+    0xC5, 0xB6, 0x0A, 0x0B, 0x69, 0xC7, 0x3D, 0xC4, 0x37, 0x77, 0x2C, 0xB6, 0xE2, 0x28, 0x97, 0x96,
+    0x42, 0xA6, 0x76, 0x77, 0x0C, 0xB2, 0x2E, 0xD9, 0xAC, 0xA9, 0x69, 0xF2, 0xDF, 0x3B, 0x6C, 0xC7,
+    0x19, 0xBF, 0x62, 0xCB, 0x64, 0x65, 0xBB, 0x74, 0x3E, 0x78, 0xB4, 0x41, 0xA5, 0x71, 0x33, 0x44,
+    0x97, 0x08, 0x2C, 0xED, 0x32, 0x0E, 0x43, 0x44, 0x8A, 0x4D, 0x8A, 0xE7, 0x3A, 0x61, 0x78, 0x3B,
+    0x2D, 0xDD, 0xB0, 0x06, 0xC5, 0x86, 0x54, 0xC0, 0x17, 0x1C, 0x30, 0xE3, 0x1D, 0x53, 0x4D, 0xA4,
+    0x8F, 0x3C, 0xC3, 0xDA, 0x07, 0xA1, 0x51, 0x99, 0xD9, 0x12, 0xEE, 0x0F, 0xA5, 0x13, 0x83, 0x5A,
+    0x92, 0x25, 0x4D, 0xDC, 0x75, 0xC8, 0x2A, 0xD4, 0xD7, 0xB9, 0x80, 0xA5, 0x1A, 0x19, 0x02, 0x1F,
+    0x50, 0x00, 0xE4, 0x8C, 0xCB, 0x62, 0xF7, 0x99, 0xC6, 0xC0, 0xCB, 0xC5, 0x84, 0xC8, 0x1B, 0x11,
+    0x6D, 0xA2, 0x09, 0x3C, 0x4D, 0xB2, 0x19, 0xFC, 0x4E, 0x74, 0x00, 0x9F, 0x27, 0xF8, 0x62, 0x67,
+    0x74, 0xCD, 0xE0, 0x75, 0x8C, 0x9A, 0x09, 0x24, 0x7E, 0xC8, 0x86, 0x43, 0xAF, 0x9F, 0x0E, 0xED,
+    0x70, 0xDD, 0x87, 0xBE, 0x89, 0x83, 0xBC, 0x9C, 0x9C, 0x5D, 0xF0, 0xBF, 0xF3, 0xF5, 0xCC, 0x7C,
+    0x1D, 0x5E, 0x98, 0xDA, 0xC4, 0x79, 0x39, 0x3A, 0xF0, 0xFE, 0xFC, 0x98, 0xCC, 0x9A, 0x34, 0x70,
+    0xD2, 0xBD, 0x33, 0x05, 0xB6, 0x71, 0xC8, 0x63, 0x3B, 0x40, 0xDA, 0xC6, 0xD0, 0x2C, 0x6F, 0xFC,
+    0x1E, 0x9E, 0x5C, 0x5C, 0xF6, 0xE4, 0x54, 0x6D, 0xC0, 0xAD, 0xCF, 0x66, 0xE6, 0xE8, 0x64, 0xB8,
+    0xDA, 0xCE, 0x88, 0x8D, 0xFD, 0xF5, 0x83, 0x19, 0x31, 0x7D, 0x3E, 0x4D, 0xAD, 0xA6, 0x1F, 0x37,
+    0x1C, 0x7E, 0xC1, 0xBD, 0x28, 0x44, 0x03, 0x8E, 0x39, 0x5E, 0x3E, 0xC6, 0x6D, 0x07, 0x34, 0x0E,
+    0xBD, 0x8C, 0xE2, 0x00, 0x7C, 0x3F, 0xAA, 0x15, 0x33, 0xB2, 0x39, 0x70, 0x19, 0xAB, 0x70, 0xF6,
+    0x64, 0xE0, 0x3E, 0x65, 0x5A, 0xB4, 0x9A, 0x31, 0x1D, 0x8E, 0x55, 0x89, 0x2D, 0x31, 0x83, 0xA2,
+    0x41, 0x50, 0x23, 0xD6, 0x4C, 0x42, 0x85, 0xA4, 0xE0, 0xC3, 0x62, 0x90, 0x8B, 0x29, 0xA1, 0x3A,
+    0x56, 0x5A, 0xC8, 0x1A, 0x22, 0x8C, 0x48, 0xCB, 0x39, 0x23, 0x53, 0x7E, 0xB5, 0x7F, 0x50, 0x1A,
+    0x42, 0x13, 0x17, 0xA9, 0xEF, 0x89, 0x24, 0x9F, 0xF2, 0x9F, 0x44, 0x27, 0xE2, 0x71, 0x93, 0x45,
+    0x79, 0xB7, 0x51, 0xFF, 0x83, 0x3F, 0x8F, 0xB8, 0x8D, 0xB1, 0xD7, 0x3E, 0xDE, 0x6B, 0x1F, 0xAA,
+    0xA4, 0x58, 0x72, 0x67, 0x16, 0xA9, 0x65, 0xDC, 0x89, 0x25, 0x4F, 0x99, 0xE5, 0xC6, 0x4B, 0x96,
+    0x34, 0xF7, 0x7C, 0x3B, 0xF4, 0xA7, 0xA1, 0x3E, 0x3A, 0x9F, 0x6F, 0xFC, 0xA6, 0x88, 0xB7, 0x6E,
+    0xDE, 0x44, 0xD5, 0x8F, 0x73, 0x61, 0xFB, 0x09, 0xCE, 0x3C, 0x75, 0x93, 0x35, 0x4F, 0x84, 0x7D,
+    0xFD, 0xD7, 0xC1, 0xF6, 0x72, 0x58, 0x76, 0xFB, 0x44, 0x9C, 0x6C, 0x72, 0x88, 0x37, 0xB9, 0x79,
+    0xCC, 0x40, 0x72, 0x02, 0x8C, 0xA1, 0xE8, 0xDD, 0x0F, 0x99, 0xDF, 0xEE, 0x7F, 0x8F, 0xFF, 0x00,
+    0x6D, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x40, 0x2C, 0xE4, 0x62, 0x52, 0x80, 0x28,
+    0x9D, 0x1E, 0x25, 0xD3, 0x50, 0xB2, 0xCF, 0x5E, 0xBE, 0x60, 0x0B, 0x56, 0x14, 0x7C, 0x42, 0x8A,
+    0x6D, 0xB7, 0xC8, 0x7B, 0xB6, 0xD2, 0x52, 0xB0, 0x4D, 0xC4, 0x17, 0x50, 0xB0, 0x69, 0x28, 0x28,
+    0x56, 0xC2, 0x8F, 0x37, 0xD2, 0x96, 0x14, 0x38, 0x42, 0x0B, 0x65, 0x5C, 0xA4, 0x40, 0x41, 0x22,
+    0x03, 0x78, 0x15, 0xB3, 0xF1, 0x9B, 0xE1, 0x9C, 0xF1, 0xDB, 0x55, 0x56, 0x62, 0x8B, 0x3B, 0x7E,
+    0x3B, 0x9E, 0x3B, 0xF7, 0x9C, 0x7B, 0xCE, 0xB5, 0x68, 0x5F, 0x89, 0x48, 0x11, 0x06, 0x44, 0x13,
+    0xB6, 0x8C, 0x12, 0x10, 0x4B, 0x29, 0xB1, 0xB1, 0x10, 0x83, 0xB8, 0x8A, 0x71, 0x2D, 0xE6, 0xD3,
+    0x4E, 0x26, 0x29, 0x33, 0x8B, 0x58, 0x6B, 0x2B, 0xA3, 0xF8, 0xDA, 0x27, 0x43, 0x16, 0x82, 0x4F,
+    0x43, 0xF8, 0xAB, 0x7E, 0xA2, 0x42, 0xA8, 0x4A, 0x51, 0x57, 0x27, 0x38, 0x9E, 0xF5, 0x3C, 0x9E,
+    0x77, 0x22, 0x4B, 0xC9, 0xAD, 0x48, 0x2B, 0x38, 0x81, 0x83, 0xBA, 0x11, 0x1C, 0x2C, 0x62, 0x64,
+    0xDA, 0xE9, 0x6E, 0x89, 0xEB, 0x82, 0x63, 0xAC, 0x1D, 0x82, 0xBC, 0x2B, 0xA2, 0x7D, 0xC3, 0xA7,
+    0x3A, 0x20, 0x89, 0x20, 0x37, 0xB2, 0xE0, 0xB8, 0xB1, 0x73, 0x61, 0xDC, 0x1A, 0x85, 0xB5, 0x66,
+    0x5D, 0x3A, 0x18, 0x8F, 0x3C, 0xFA, 0x1C, 0xB5, 0xA3, 0x36, 0x73, 0xF1, 0x9D, 0x72, 0xE9, 0x38,
+    0x01, 0x52, 0x53, 0x9C, 0x23, 0xDD, 0xEA, 0xF3, 0x2D, 0xEE, 0x65, 0x0A, 0xE0, 0xD1, 0x61, 0x94,
+    0xBA, 0x02, 0x82, 0x5E, 0x36, 0x4D, 0x32, 0x62, 0x63, 0xD3, 0xE4, 0x1D, 0xF2, 0xD5, 0x28, 0x7B,
+    0x8D, 0x45, 0xA6, 0x04, 0x44, 0x4C, 0xAA, 0xC7, 0x1B, 0xCA, 0x15, 0x0D, 0xDE, 0x28, 0xEC, 0x5A,
+    0xCA, 0xFB, 0xC9, 0x56, 0x39, 0xD9, 0x6E, 0x42, 0xAF, 0x6D, 0x3A, 0x6C, 0x78, 0x75, 0xAC, 0x33,
+    0x71, 0xB8, 0x74, 0x2F, 0x71, 0xC9, 0x24, 0x6D, 0xEA, 0xD2, 0x49, 0xC6, 0xD4, 0x29, 0xE4, 0x48,
+    0x5D, 0xC6, 0xDF, 0x4E, 0x3F, 0x52, 0x7D, 0xEA, 0x8A, 0xE3, 0xCC, 0x2A, 0xF7, 0xE0, 0x38, 0xB7,
+    0xAA, 0xFF, 0xE4, 0x58, 0x57, 0xAA, 0x7F, 0x74, 0x56, 0x88, 0xEA, 0xC7, 0x33, 0x80, 0x09, 0x81,
+    0xB5, 0x31, 0x5A, 0xF5, 0x4B, 0x37, 0x8C, 0xA2, 0x7E, 0xB3, 0xC3, 0x20, 0xEA, 0xA7, 0xE6, 0xD2,
+    0x89, 0xFA, 0xB9, 0xFA, 0xBB, 0x97, 0xEC, 0xB9, 0xFC, 0x63, 0x25, 0xFB, 0x53, 0x5E, 0x23, 0x4E,
+    0xF2, 0xA6, 0x62, 0x44, 0x93, 0xB2, 0x41, 0xBC, 0x48, 0xEE, 0x48, 0x45, 0xDE, 0xA3, 0x12, 0x90,
+    0x14, 0xFE, 0x25, 0xD5, 0x05, 0x29, 0x9B, 0xA4, 0x38, 0x7D, 0x3A, 0x90, 0x66, 0x49, 0x88, 0x0B,
+    0x38, 0x51, 0x14, 0x9A, 0x22, 0x4B, 0x2C, 0xCB, 0xF4, 0x64, 0x09, 0x4C, 0x6D, 0x66, 0x51, 0xA3,
+    0x4C, 0xB9, 0x6D, 0xB3, 0x4E, 0x40, 0x09, 0x9E, 0xB0, 0x34, 0x78, 0x4A, 0x86, 0x62, 0x7F, 0xD0,
+    0x4D, 0xEA, 0x4C, 0xE2, 0x50, 0xB4, 0x2B, 0x81, 0x04, 0xB5, 0x2F, 0x94, 0x33, 0x20, 0x7E, 0xA1,
+    0x7A, 0x34, 0xD9, 0x2E, 0xF1, 0x84, 0xFE, 0xB6, 0xB9, 0x5D, 0xA2, 0x43, 0x53, 0xEC, 0x73, 0x33,
+    0x4A, 0x82, 0x16, 0xEF, 0x0F, 0x92, 0x39, 0x31, 0xC9, 0xE5, 0x61, 0xDD, 0x89, 0x41, 0x0B, 0x42,
+    0x25, 0x0B, 0x48, 0xE4, 0x45, 0x64, 0x4F, 0x3E, 0x60, 0x50, 0x6C, 0x30, 0x04, 0x86, 0x9F, 0x5F,
+    0xBC, 0x60, 0xF9, 0xEC, 0x78, 0x88, 0x3A, 0x44, 0x0A, 0x2A, 0xB3, 0x42, 0xF3, 0x1E, 0x3B, 0x49,
+    0x42, 0x60, 0x9F, 0x2E, 0x7E, 0x70, 0xA2, 0xFB, 0xD4, 0x0B, 0xB8, 0x2E, 0x3A, 0x42, 0x9A, 0xA8,
+    0x34, 0xF4, 0x69, 0x1B, 0xC5, 0x65, 0xA9, 0xAC, 0x49, 0xD2, 0x81, 0x6B, 0xC9, 0x1C, 0x28, 0x01,
+    0x8F, 0x9E, 0x8F, 0xA6, 0xC3, 0x0B, 0x39, 0x5E, 0x0C, 0xD9, 0x1F, 0x60, 0x32, 0x8C, 0x2D, 0xF2,
+    0x6F, 0x29, 0xC8, 0x77, 0xE4, 0xD6, 0x1F, 0x14, 0x0D, 0x7A, 0x37, 0x2C, 0x26, 0x39, 0x3C, 0xFC,
+    0xEC, 0xE6, 0xFF, 0x77, 0x28, 0x44, 0x13, 0x80, 0x32, 0x9C, 0xA2, 0x51, 0xA3, 0xDC, 0x43, 0x31,
+    0x2C, 0x72, 0x16, 0xE6, 0x0E, 0x49, 0x54, 0xA6, 0xE1, 0xE1, 0x92, 0x21, 0xA5, 0xB5, 0x14, 0x95,
+    0xFD, 0xE1, 0xE5, 0x21, 0xB3, 0xFA, 0x1D, 0x42, 0x3A, 0x64, 0xDE, 0x98, 0x03, 0xDF, 0x4B, 0xD8,
+    0x44, 0x09, 0x4F, 0xCE, 0x90, 0x0F, 0x62, 0x95, 0x3C, 0x1A, 0xF3, 0xFD, 0x68, 0x4B, 0xDC, 0x00,
+    0x7C, 0x25, 0x3A, 0x81, 0x00, 0x38, 0x10, 0xF4, 0x9A, 0xC1, 0x30, 0x68, 0x8B, 0x80, 0x1E, 0x55,
+    0x00, 0x5A, 0x02, 0xD1, 0x1A, 0x21, 0xA9, 0xEB, 0x8B, 0x03, 0xF2, 0xBE, 0x15, 0xEA, 0x4B, 0x12,
+    0x4F, 0xDB, 0xAD, 0x79, 0x5B, 0x94, 0xBB, 0xB6, 0x28, 0x3C, 0xEB, 0x71, 0x31, 0xD4, 0xB1, 0xA2,
+    0xC3, 0x99, 0x5F, 0xD2, 0x91, 0x6B, 0x1D, 0x79, 0x85, 0xBF, 0x58, 0x13, 0x09, 0x19, 0x0C, 0x95,
+    0x1A, 0x13, 0x45, 0xE3, 0x46, 0xBD, 0xC5, 0xCA, 0xF5, 0x39, 0xF0, 0xAF, 0x36, 0x74, 0x2A, 0x20,
+    0x69, 0xF6, 0x0D, 0x2E, 0x8B, 0x0F, 0x69, 0x78, 0x06, 0x1A, 0x8E, 0xEA, 0x46, 0x7A, 0x22, 0x51,
+    0x9E, 0x48, 0xF0, 0x76, 0xB6, 0x8D, 0xA6, 0x07, 0x75, 0xCF, 0xF1, 0xEB, 0xE3, 0xF2, 0xBA, 0xDF,
+    0x9C, 0x17, 0x33, 0x93, 0x37, 0x94, 0xC7, 0x01, 0x45, 0x2A, 0xE3, 0x70, 0x30, 0xDF, 0x1C, 0x45,
+    0xF7, 0xA1, 0x63, 0x9B, 0x6A, 0x76, 0x61, 0x1C, 0x0B, 0x28, 0x29, 0x8F, 0x5A, 0x2A, 0xE7, 0x9A,
+    0xB8, 0x92, 0x3A, 0xC8, 0x3D, 0x36, 0x00, 0x53, 0x68, 0x16, 0xD4, 0x7A, 0xB7, 0x4E, 0x37, 0xEB,
+    0xBC, 0x8F, 0x7E, 0x0E, 0x69, 0x68, 0xC0, 0x04, 0x8C, 0x1F, 0xE0, 0x5D, 0xE0, 0x2F, 0xBF, 0x1E,
+    0x91, 0x4C, 0x77, 0x6B, 0x8C, 0x04, 0x28, 0x19, 0xF2, 0x9E, 0x40, 0x4A, 0xBD, 0x3F, 0xC2, 0x2F,
+    0x5D, 0xE2, 0x71, 0x10, 0x6E, 0x29, 0x46, 0x4E, 0x1C, 0xFD, 0x32, 0x74, 0x6A, 0xCC, 0x9D, 0x46,
+    0x7B, 0xA1, 0xF1, 0xAE, 0x08, 0x27, 0x92, 0xBD, 0xF2, 0x11, 0x43, 0x6E, 0x0F, 0xE2, 0xAA, 0xAD,
+    0xDC, 0x5E, 0x9B, 0x79, 0x2D, 0xAA, 0x79, 0x35, 0x3B, 0xCC, 0xD7, 0xF8, 0x17, 0x6F, 0xF1, 0x10,
+    0x99, 0x53, 0xE4, 0x57, 0x0D, 0x90, 0x2D, 0xBC, 0x89, 0x43, 0xAD, 0x02, 0x5D, 0x25, 0x86, 0x10,
+    0x52, 0xB5, 0x34, 0x13, 0x4F, 0x8C, 0x4C, 0xB3, 0x60, 0x6E, 0xFD, 0x25, 0x2E, 0x4A, 0x5F, 0x93,
+    0xD2, 0x4D, 0x94, 0xE9, 0x8D, 0xD6, 0x08, 0x5D, 0x71, 0x84, 0xA8, 0x2E, 0x58, 0x34, 0x78, 0x8D,
+    0x7F, 0x86, 0xE5, 0x9E, 0xC8, 0x95, 0xC7, 0xC1, 0xB6, 0x86, 0x2D, 0x97, 0x1A, 0xD4, 0x2C, 0xD2,
+    0xCA, 0xCC, 0x08, 0x38, 0x87, 0x9D, 0xEC, 0xBA, 0x3E, 0x57, 0x46, 0x11, 0xBC, 0x77, 0x64, 0x59,
+    0x56, 0xBC, 0x82, 0x68, 0x8C, 0x3F, 0x61, 0xAF, 0xF0, 0x52, 0xFD, 0xD4, 0x93, 0xF4, 0x9A, 0x8C,
+    0x17, 0x0D, 0xB5, 0x33, 0x7D, 0xE4, 0x4F, 0x37, 0xBF, 0x73, 0x32, 0x34, 0x60, 0xCE, 0x54, 0xB0,
+    0x43, 0x7D, 0x00, 0x93, 0x05, 0xF7, 0xF0, 0xEA, 0xD4, 0x9F, 0x64, 0x3D, 0x3C, 0x9D, 0x3F, 0x3B,
+    0x72, 0x9C, 0x02, 0x76, 0x9E, 0x64, 0x91, 0xA1, 0x48, 0x4F, 0x54, 0x5C, 0x29, 0xB7, 0x7C, 0xB6,
+    0x64, 0x68, 0x77, 0x04, 0xDD, 0x65, 0x78, 0x10, 0x3F, 0x17, 0x50, 0x4C, 0x8E, 0xEB, 0x30, 0x05,
+    0xAF, 0xBC, 0x14, 0xC3, 0xF1, 0x1D, 0xD1, 0xEE, 0x3E, 0x92, 0x39, 0x0D, 0xE1, 0x39, 0x65, 0x41,
+    0x21, 0x38, 0x83, 0xAC, 0xE1, 0xB2, 0x1F, 0x65, 0x2F, 0x1A, 0x8B, 0x5D, 0x51, 0x2F, 0xBF, 0xCD,
+    0x1C, 0x06, 0xCD, 0xE3, 0x11, 0x2E, 0xED, 0xB0, 0x83, 0x49, 0xD7, 0x80, 0x86, 0xBC, 0xCF, 0x6C,
+    0x89, 0x11, 0xDA, 0x17, 0x4D, 0x29, 0xDF, 0xE7, 0x9D, 0x76, 0xD8, 0x49, 0x3C, 0x09, 0x32, 0x6F,
+    0x7E, 0xF5, 0x32, 0x8F, 0xB6, 0x3C, 0x2A, 0x75, 0x8F, 0x75, 0x6A, 0xD6, 0x92, 0x36, 0x6F, 0x75,
+    0x33, 0x8F, 0x1A, 0x0B, 0x11, 0x04, 0x65, 0x97, 0xBD, 0xE2, 0xEE, 0x44, 0x32, 0x8B, 0xAF, 0x48,
+    0xA1, 0x23, 0x8E, 0x15, 0x78, 0xC6, 0xE8, 0x8E, 0x9F, 0x53, 0x8E, 0x8E, 0xBA, 0x5A, 0xD1, 0x12,
+    0x1C, 0x92, 0xF8, 0xB6, 0x11, 0x14, 0x98, 0x61, 0xE0, 0xD7, 0x8F, 0x33, 0xCE, 0x82, 0x97, 0xD9,
+    0xBE, 0x35, 0xBF, 0x78, 0x14, 0xD6, 0x08, 0xFB, 0x72, 0x1A, 0x30, 0x3D, 0x1D, 0x71, 0x2D, 0xB6,
+    0xFF, 0xFF, 0xFB, 0x0F, 0x75, 0x55, 0xBF, 0x8F, 0xDC, 0x54, 0x10, 0x1E, 0xFB, 0xE9, 0xCE, 0xE2,
+    0x9E, 0x90, 0xAF, 0xA0, 0x02, 0x5D, 0xDC, 0x23, 0xE5, 0xDC, 0x50, 0x6E, 0x78, 0x4E, 0x9A, 0x14,
+    0x34, 0x5B, 0x64, 0x53, 0x90, 0xE2, 0x28, 0x29, 0x11, 0x8A, 0xD0, 0x15, 0xC9, 0xAD, 0x11, 0x12,
+    0x0D, 0x05, 0xF7, 0x27, 0x50, 0x50, 0x44, 0xBE, 0xE2, 0x28, 0x53, 0xE4, 0xCE, 0xEF, 0x12, 0x51,
+    0x63, 0x8A, 0x13, 0xAD, 0x05, 0x49, 0x45, 0x11, 0x4B, 0x38, 0x92, 0xEF, 0x58, 0x7B, 0xF8, 0x66,
+    0xEC, 0x3D, 0x2E, 0x12, 0xAC, 0xE4, 0x79, 0xBB, 0xF3, 0xC6, 0xF3, 0xE3, 0x9B, 0x6F, 0x66, 0x89,
+    0xE4, 0x13, 0x94, 0x3D, 0x51, 0xCC, 0x9C, 0x53, 0x74, 0x59, 0xD6, 0x14, 0x52, 0xD4, 0x40, 0x6B,
+    0x5A, 0x88, 0xF0, 0x4A, 0x98, 0x66, 0xB3, 0x28, 0x8E, 0x3B, 0x98, 0xF1, 0x6A, 0xAB, 0x38, 0xE6,
+    0x27, 0x14, 0x70, 0x47, 0x94, 0xE0, 0xAD, 0x0F, 0x79, 0x28, 0x7E, 0x70, 0xB8, 0x68, 0x92, 0x37,
+    0x8B, 0xC5, 0x3C, 0xF6, 0x30, 0x4F, 0x54, 0xE4, 0xEB, 0x6F, 0x71, 0x05, 0x61, 0x2F, 0xEE, 0x77,
+    0x64, 0x58, 0x5E, 0x5B, 0x72, 0x8D, 0xB8, 0x73, 0x0D, 0xBF, 0x2D, 0xE2, 0x29, 0x9E, 0x94, 0x0F,
+    0x29, 0x84, 0x7B, 0x38, 0xFD, 0xBB, 0xA5, 0xE5, 0xAF, 0xF5, 0x36, 0x0D, 0x61, 0x45, 0xA6, 0x33,
+    0x15, 0x52, 0x32, 0x1E, 0x5E, 0x22, 0x0F, 0x7F, 0x36, 0xA7, 0x34, 0xB7, 0x19, 0x39, 0x8A, 0x69,
+    0x14, 0x4B, 0x4A, 0x88, 0x4E, 0x69, 0x57, 0xC4, 0x2D, 0x11, 0xB3, 0x49, 0x2C, 0x69, 0x5F, 0x4C,
+    0xE0, 0xDD, 0x79, 0x54, 0x91, 0xD4, 0xA8, 0xCC, 0x0E, 0x6F, 0x9E, 0x4A, 0x1C, 0x4D, 0xE3, 0x25,
+    0x2A, 0x93, 0xDC, 0x8C, 0x64, 0x19, 0x4A, 0xBE, 0x51, 0x06, 0xD7, 0xC6, 0x43, 0x11, 0x36, 0x21,
+    0xCC, 0x57, 0xD4, 0xD1, 0x26, 0x8A, 0xE3, 0x48, 0x44, 0xBE, 0x77, 0xBE, 0x77, 0x9E, 0x99, 0xC6,
+    0xC8, 0x4D, 0x00, 0x17, 0x07, 0x74, 0x82, 0xCC, 0xB3, 0x14, 0x35, 0x7A, 0x54, 0xAE, 0x37, 0x41,
+    0x27, 0x37, 0x8F, 0xC7, 0x1B, 0xF7, 0xF6, 0x0D, 0xFC, 0x41, 0xEF, 0x6E, 0x53, 0x0A, 0xC8, 0x45,
+    0x5F, 0x0A, 0xD8, 0x41, 0x46, 0x57, 0x9F, 0x0F, 0x04, 0x1B, 0x2A, 0x81, 0x03, 0xC0, 0x3A, 0x82,
+    0xB4, 0x2D, 0xBD, 0x37, 0x41, 0x38, 0xA2, 0xF9, 0x96, 0x1C, 0xF5, 0xB1, 0xF4, 0x88, 0xCC, 0xA0,
+    0x1E, 0x58, 0x55, 0x69, 0xA7, 0x2A, 0x56, 0x55, 0xA9, 0x01, 0x52, 0xBF, 0x75, 0x27, 0xFF, 0x31,
+    0xF1, 0xEE, 0x97, 0xBF, 0x56, 0xB1, 0xFF, 0xB2, 0x39, 0xD9, 0x49, 0xFC, 0x57, 0xD5, 0xFE, 0x4E,
+    0x9A, 0x3B, 0xFF, 0xD3, 0x0E, 0x50, 0xAC, 0x9A, 0xDD, 0x9E, 0x2C, 0x5F, 0x96, 0x2D, 0x45, 0xC7,
+    0x3C, 0x64, 0x64, 0x83, 0xF3, 0x87, 0xF0, 0x1E, 0xFA, 0x2F, 0x88, 0xDE, 0x09, 0xF3, 0xCF, 0xA4,
+    0xE3, 0xCC, 0xDF, 0xE1, 0xF9, 0x1D, 0x4F, 0xBB, 0xCE, 0xF9, 0xFD, 0xA2, 0x28, 0x3E, 0x81, 0xE2,
+    0x0F, 0x55, 0x0A, 0x03, 0x04, 0x20, 0x41, 0x41, 0x40, 0x40, 0x07, 0xE8, 0xFF, 0x95, 0x51, 0xFD,
+    0x5F, 0x4A, 0x38, 0x42, 0x8F, 0xD8, 0xDF, 0xE7, 0xC5, 0x9C, 0xAC, 0x20, 0xB2, 0x92, 0xEB, 0x4C,
+    0x95, 0x78, 0xEA, 0x51, 0x71, 0x2A, 0xB5, 0x51, 0xF0, 0x29, 0xAA, 0x64, 0x14, 0xEF, 0x0E, 0x47,
+    0x7F, 0x7A, 0x27, 0xF4, 0x93, 0x88, 0x6A, 0x24, 0x4E, 0x95, 0xC8, 0xCB, 0x09, 0xB3, 0x40, 0x4C,
+    0x22, 0x41, 0x2A, 0xCD, 0xA6, 0x17, 0xC0, 0x71, 0xF0, 0xEB, 0xDB, 0x41, 0xD0, 0x3F, 0x44, 0x0A,
+    0x87, 0x40, 0x0F, 0x06, 0x49, 0x49, 0xCF, 0xE8, 0xF6, 0x05, 0x46, 0xC3, 0xA2, 0xB8, 0xA0, 0x04,
+    0x67, 0x96, 0x30, 0x0F, 0xFF, 0x6C, 0x68, 0x2B, 0x47, 0x10, 0x87, 0xCC, 0x83, 0x0E, 0x91, 0xB4,
+    0xCF, 0x4B, 0x50, 0xC2, 0xB4, 0x08, 0xE5, 0x72, 0x5B, 0xD9, 0x15, 0xB9, 0x23, 0x8C, 0x88, 0xA0,
+    0x12, 0xF1, 0x05, 0x62, 0xCC, 0xAF, 0xFA, 0x9C, 0x4A, 0xEC, 0x98, 0x11, 0x3C, 0xAC, 0xA5, 0xFC,
+    0x59, 0x24, 0x08, 0xF9, 0x47, 0xF8, 0x7A, 0xCB, 0x4A, 0xEA, 0xC3, 0x50, 0x14, 0x32, 0x97, 0x28,
+    0x2C, 0x55, 0x5C, 0x41, 0x32, 0xEB, 0x43, 0x94, 0x37, 0x13, 0x96, 0x87, 0x95, 0x39, 0xF3, 0xF9,
+    0x4D, 0x7A, 0xF4, 0xF8, 0xE3, 0xD0, 0xDB, 0xD7, 0xDC, 0xCE, 0xA8, 0xFC, 0xFE, 0xB7, 0xD7, 0x99,
+    0xAD, 0x1E, 0x26, 0x75, 0xD8, 0xC9, 0x60, 0x95, 0xC2, 0x90, 0xDD, 0x67, 0x12, 0xED, 0xAE, 0xA0,
+    0x42, 0xEE, 0xFC, 0x73, 0xE1, 0x07, 0x0B, 0x18, 0x63, 0xF7, 0xC6, 0x7C, 0x8C, 0xDE, 0x46, 0xD7,
+    0xA4, 0x1D, 0x69, 0xE5, 0xFF, 0x95, 0x3A, 0xCD, 0x1B, 0x52, 0x7D, 0x20, 0x3D, 0xD0, 0xCC, 0x50,
+    0x65, 0xED, 0xA2, 0x15, 0x31, 0x8A, 0xEE, 0x81, 0xE8, 0x09, 0x1D, 0x60, 0x6F, 0xA0, 0x68, 0xA0,
+    0x01, 0x09, 0x57, 0x90, 0xB6, 0x42, 0x7B, 0x0F, 0xE2, 0x0A, 0x98, 0x9C, 0xC4, 0x1E, 0x53, 0xDF,
+    0x2B, 0x73, 0x57, 0xEA, 0x70, 0x25, 0xE8, 0x07, 0x9D, 0xD3, 0x3D, 0xE3, 0xB4, 0x09, 0x48, 0x6D,
+    0x38, 0x94, 0x2C, 0xD1, 0x54, 0xA0, 0xD7, 0x20, 0x72, 0x38, 0x48, 0x42, 0xA9, 0x87, 0x0B, 0xF5,
+    0x2C, 0x6E, 0x75, 0xEC, 0x75, 0x15, 0x54, 0xC8, 0x10, 0xEA, 0x04, 0xD1, 0x36, 0xCA, 0x5A, 0xF2,
+    0xAA, 0x84, 0x3F, 0x19, 0xED, 0xBD, 0x9A, 0x4F, 0x14, 0xD0, 0xFE, 0x6E, 0x71, 0x91, 0x0B, 0xB3,
+    0x30, 0x87, 0x7B, 0xAF, 0xEE, 0x5D, 0xBF, 0x41, 0xFA, 0x6B, 0x22, 0xAC, 0x3F, 0x61, 0x25, 0xB7,
+    0xB3, 0x58, 0x52, 0x3A, 0x13, 0x48, 0x96, 0x18, 0x07, 0x10, 0x83, 0x65, 0x6D, 0x80, 0x7E, 0x09,
+    0x9B, 0x9F, 0x29, 0xEA, 0x1A, 0x2C, 0x98, 0xFE, 0x86, 0x6C, 0xA3, 0xAF, 0xB1, 0x5C, 0xA2, 0xE6,
+    0x26, 0x5E, 0x38, 0x35, 0x5E, 0xC8, 0x30, 0xBB, 0x31, 0x39, 0xD7, 0x42, 0x95, 0xE2, 0x63, 0x88,
+    0xA0, 0xBD, 0xD2, 0x8E, 0x06, 0xE3, 0x0C, 0x2F, 0x35, 0xAC, 0x9A, 0x61, 0xE4, 0x29, 0x28, 0xCA,
+    0xA1, 0x20, 0xDD, 0xAB, 0x86, 0x15, 0x8C, 0xB1, 0x55, 0x2F, 0x00, 0xDE, 0x3E, 0x76, 0x9B, 0xBD,
+    0x8B, 0xE2, 0x59, 0x37, 0x6A, 0x2D, 0x66, 0x59, 0x54, 0x1B, 0xE9, 0x40, 0xEC, 0x01, 0x48, 0x0F,
+    0xC7, 0x4A, 0x47, 0x59, 0x52, 0x69, 0x9E, 0x66, 0xB6, 0x31, 0xC3, 0x31, 0x50, 0x5B, 0xBF, 0x70,
+    0x00, 0x34, 0x27, 0x3B, 0x5B, 0x0B, 0x6D, 0x61, 0x17, 0xD5, 0x49, 0x46, 0xA7, 0xA1, 0x0C, 0xB0,
+    0x43, 0x69, 0xE6, 0xF2, 0x88, 0xA5, 0xD6, 0xDC, 0xCA, 0x7F, 0x83, 0x79, 0x8E, 0x24, 0x67, 0x88,
+    0x1B, 0x7D, 0x83, 0x04, 0xB6, 0xB1, 0xB5, 0x37, 0x16, 0x77, 0x78, 0xE5, 0xF8, 0x6C, 0x71, 0xEF,
+    0x1A, 0x6C, 0xEF, 0x4E, 0x67, 0x3F, 0x1E, 0xF1, 0x74, 0xF2, 0x78, 0xC6, 0xD3, 0xC9, 0xE3, 0x19,
+    0xBF, 0xDC, 0xD4, 0xB3, 0x1B, 0xED, 0xE3, 0x7A, 0x3C, 0xF9, 0xEC, 0x89, 0xD1, 0xBF, 0xA4, 0xB2,
+    0xB5, 0xBD, 0x12, 0xA1, 0x4E, 0x7B, 0xE5, 0x9B, 0xF8, 0x11, 0x40, 0x22, 0xEE, 0xF5, 0xE7, 0x92,
+    0x7B, 0xA7, 0x3F, 0xB9, 0xC5, 0x99, 0xA3, 0x3B, 0x99, 0xE3, 0xDE, 0x28, 0x31, 0xB9, 0x4D, 0x84,
+    0x03, 0x02, 0xA0, 0x50, 0x5D, 0xCF, 0x4C, 0xCE, 0x07, 0xCA, 0x7C, 0xD7, 0xE8, 0xEC, 0xE1, 0x8F,
+    0x21, 0xD5, 0x76, 0x38, 0xD2, 0x9F, 0xE4, 0x1E, 0x8C, 0x5B, 0xCD, 0x8D, 0x3F, 0xC9, 0x4D, 0x4B,
+    0xCE, 0x4D, 0xE4, 0xF8, 0xE8, 0x5A, 0xB1, 0xFF, 0x00,
+};
+
+static const uint32_t notosans_16_italicBlockOffsets[44] = {
+    0, 1120, 2132, 3161, 4169, 5306, 6377, 7202,
+    7934, 8799, 9680, 10370, 11215, 12106, 12934, 13773,
+    14797, 15592, 16520, 17581, 18836, 19839, 20859, 21834,
+    22996, 24077, 25126, 26313, 27396, 28366, 29338, 30349,
+    31297, 32219, 33281, 34288, 35159, 36080, 37199, 38155,
+    39152, 40496, 41668, 42697,
+};
+
+static const uint16_t notosans_16_italicDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_16_italicGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_16_italicPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 876, 0, 0,
 };
 
 static const EpdGlyph notosans_16_italicGlyphs[] = {
@@ -5400,855 +2859,855 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 17, 26, 18, 2, 25, 111, 1710 }, // 6
     { 17, 24, 18, 2, 24, 102, 1821 }, // 7
     { 18, 26, 18, 1, 25, 117, 1923 }, // 8
-    { 17, 26, 18, 1, 25, 111, 2040 }, // 9
-    { 8, 20, 9, 0, 19, 40, 2151 }, // :
-    { 10, 24, 9, -2, 19, 60, 2191 }, // ;
-    { 17, 18, 19, 2, 21, 77, 2251 }, // <
-    { 16, 10, 19, 2, 17, 40, 2328 }, // =
-    { 17, 18, 19, 2, 21, 77, 2368 }, // >
-    { 14, 26, 14, 2, 25, 91, 2445 }, // ?
-    { 27, 28, 28, 1, 24, 189, 2536 }, // @
-    { 20, 24, 19, -2, 24, 120, 2725 }, // A
-    { 19, 24, 20, 1, 24, 114, 2845 }, // B
-    { 20, 26, 20, 2, 25, 130, 2959 }, // C
-    { 21, 24, 22, 1, 24, 126, 3089 }, // D
-    { 18, 24, 17, 1, 24, 108, 3215 }, // E
-    { 18, 24, 16, 1, 24, 108, 3323 }, // F
-    { 21, 26, 23, 2, 25, 137, 3431 }, // G
-    { 22, 24, 23, 1, 24, 132, 3568 }, // H
-    { 14, 24, 11, -1, 24, 84, 3700 }, // I
-    { 16, 31, 9, -6, 24, 124, 3784 }, // J
-    { 21, 24, 19, 1, 24, 126, 3908 }, // K
-    { 13, 24, 16, 1, 24, 78, 4034 }, // L
-    { 28, 24, 28, 1, 24, 168, 4112 }, // M
-    { 23, 24, 24, 1, 24, 138, 4280 }, // N
-    { 21, 26, 24, 2, 25, 137, 4418 }, // O
-    { 18, 24, 19, 1, 24, 108, 4555 }, // P
-    { 21, 31, 24, 2, 25, 163, 4663 }, // Q
-    { 18, 24, 19, 1, 24, 108, 4826 }, // R
-    { 18, 26, 17, 0, 25, 117, 4934 }, // S
-    { 17, 24, 17, 3, 24, 102, 5051 }, // T
-    { 21, 25, 23, 2, 24, 132, 5153 }, // U
-    { 19, 24, 18, 3, 24, 114, 5285 }, // V
-    { 29, 24, 29, 3, 24, 174, 5399 }, // W
-    { 23, 24, 18, -2, 24, 138, 5573 }, // X
-    { 18, 24, 17, 3, 24, 108, 5711 }, // Y
-    { 21, 24, 18, -1, 24, 126, 5819 }, // Z
-    { 14, 30, 10, -1, 24, 105, 5945 }, // [
-    { 7, 24, 12, 3, 24, 42, 6050 }, // <backslash>
-    { 14, 30, 10, -3, 24, 105, 6092 }, // ]
-    { 17, 16, 19, 1, 24, 68, 6197 }, // ^
-    { 15, 3, 13, -4, -3, 12, 6265 }, // _
-    { 7, 6, 9, 4, 26, 11, 6277 }, // `
-    { 18, 20, 19, 1, 19, 90, 6288 }, // a
-    { 18, 27, 19, 0, 26, 122, 6378 }, // b
-    { 15, 20, 15, 1, 19, 75, 6500 }, // c
-    { 19, 27, 19, 1, 26, 129, 6575 }, // d
-    { 15, 20, 17, 1, 19, 75, 6704 }, // e
-    { 19, 34, 11, -4, 26, 162, 6779 }, // f
-    { 19, 27, 19, 0, 19, 129, 6941 }, // g
-    { 18, 26, 19, 0, 26, 117, 7070 }, // h
-    { 9, 25, 9, 0, 25, 57, 7187 }, // i
-    { 14, 33, 9, -5, 25, 116, 7244 }, // j
-    { 18, 26, 17, 0, 26, 117, 7360 }, // k
-    { 10, 26, 9, 0, 26, 65, 7477 }, // l
-    { 28, 19, 29, 0, 19, 133, 7542 }, // m
-    { 18, 19, 19, 0, 19, 86, 7675 }, // n
-    { 17, 20, 19, 1, 19, 85, 7761 }, // o
-    { 19, 27, 19, -1, 19, 129, 7846 }, // p
-    { 18, 27, 19, 1, 19, 122, 7975 }, // q
-    { 15, 19, 13, 0, 19, 72, 8097 }, // r
-    { 14, 20, 14, 0, 19, 70, 8169 }, // s
-    { 12, 23, 11, 1, 22, 69, 8239 }, // t
-    { 18, 19, 19, 1, 18, 86, 8308 }, // u
-    { 17, 18, 16, 1, 18, 77, 8394 }, // v
-    { 25, 18, 24, 1, 18, 113, 8471 }, // w
-    { 19, 18, 16, -2, 18, 86, 8584 }, // x
-    { 22, 26, 16, -4, 18, 143, 8670 }, // y
-    { 16, 18, 15, -1, 18, 72, 8813 }, // z
-    { 14, 30, 12, 0, 24, 105, 8885 }, // {
-    { 4, 35, 18, 8, 26, 35, 8990 }, // |
-    { 14, 30, 12, -2, 24, 105, 9025 }, // }
-    { 17, 5, 19, 2, 14, 22, 9130 }, // ~
-    { 0, 0, 9, 0, 0, 0, 9152 }, //  
-    { 10, 26, 9, -1, 19, 65, 9152 }, // ¡
-    { 15, 26, 18, 3, 25, 98, 9217 }, // ¢
-    { 21, 25, 18, -1, 25, 132, 9315 }, // £
-    { 15, 15, 18, 2, 19, 57, 9447 }, // ¤
-    { 19, 24, 18, 2, 24, 114, 9504 }, // ¥
-    { 4, 35, 18, 8, 26, 35, 9618 }, // ¦
-    { 17, 27, 16, 0, 26, 115, 9653 }, // §
-    { 10, 4, 18, 7, 25, 10, 9768 }, // ¨
-    { 26, 26, 28, 1, 25, 169, 9778 }, // ©
-    { 11, 13, 11, 2, 25, 36, 9947 }, // ª
-    { 15, 15, 16, 1, 16, 57, 9983 }, // «
-    { 16, 9, 19, 2, 13, 36, 10040 }, // ¬
-    { 10, 4, 10, 0, 11, 10, 10076 }, // ­
-    { 26, 26, 28, 1, 25, 169, 10086 }, // ®
-    { 15, 3, 13, 3, 28, 12, 10255 }, // ¯
-    { 12, 12, 14, 1, 25, 36, 10267 }, // °
-    { 17, 20, 19, 2, 20, 85, 10303 }, // ±
-    { 12, 16, 12, 2, 29, 48, 10388 }, // ²
-    { 12, 16, 12, 2, 29, 48, 10436 }, // ³
-    { 8, 6, 9, 3, 26, 12, 10484 }, // ´
-    { 20, 26, 20, -1, 18, 130, 10496 }, // µ
-    { 17, 31, 22, 3, 26, 132, 10626 }, // ¶
-    { 5, 6, 9, 2, 15, 8, 10758 }, // ·
-    { 7, 8, 7, -3, 0, 14, 10766 }, // ¸
-    { 8, 16, 12, 4, 29, 32, 10780 }, // ¹
-    { 11, 13, 11, 2, 25, 36, 10812 }, // º
-    { 15, 15, 16, 0, 16, 57, 10848 }, // »
-    { 22, 26, 24, 2, 25, 143, 10905 }, // ¼
-    { 24, 26, 27, 2, 25, 156, 11048 }, // ½
-    { 25, 26, 26, 1, 25, 163, 11204 }, // ¾
-    { 13, 26, 14, -1, 19, 85, 11367 }, // ¿
-    { 20, 32, 19, -2, 32, 160, 11452 }, // À
-    { 21, 32, 19, -2, 32, 168, 11612 }, // Á
-    { 20, 32, 19, -2, 32, 160, 11780 }, // Â
-    { 22, 31, 19, -2, 31, 171, 11940 }, // Ã
-    { 20, 31, 19, -2, 31, 155, 12111 }, // Ä
-    { 20, 34, 19, -2, 34, 170, 12266 }, // Å
-    { 31, 24, 27, -2, 24, 186, 12436 }, // Æ
-    { 20, 33, 20, 2, 25, 165, 12622 }, // Ç
-    { 18, 32, 17, 1, 32, 144, 12787 }, // È
-    { 18, 32, 17, 1, 32, 144, 12931 }, // É
-    { 18, 32, 17, 1, 32, 144, 13075 }, // Ê
-    { 18, 31, 17, 1, 31, 140, 13219 }, // Ë
-    { 14, 32, 11, -1, 32, 112, 13359 }, // Ì
-    { 16, 32, 11, -1, 32, 128, 13471 }, // Í
-    { 15, 32, 11, -1, 32, 120, 13599 }, // Î
-    { 15, 31, 11, -1, 31, 117, 13719 }, // Ï
-    { 21, 24, 22, 1, 24, 126, 13836 }, // Ð
-    { 23, 31, 24, 1, 31, 179, 13962 }, // Ñ
-    { 21, 33, 24, 2, 32, 174, 14141 }, // Ò
-    { 21, 33, 24, 2, 32, 174, 14315 }, // Ó
-    { 21, 33, 24, 2, 32, 174, 14489 }, // Ô
-    { 21, 32, 24, 2, 31, 168, 14663 }, // Õ
-    { 21, 32, 24, 2, 31, 168, 14831 }, // Ö
-    { 16, 16, 19, 2, 20, 64, 14999 }, // ×
-    { 23, 28, 24, 1, 26, 161, 15063 }, // Ø
-    { 21, 33, 23, 2, 32, 174, 15224 }, // Ù
-    { 21, 33, 23, 2, 32, 174, 15398 }, // Ú
-    { 21, 33, 23, 2, 32, 174, 15572 }, // Û
-    { 21, 32, 23, 2, 31, 168, 15746 }, // Ü
-    { 18, 32, 17, 3, 32, 144, 15914 }, // Ý
-    { 18, 24, 19, 1, 24, 108, 16058 }, // Þ
-    { 24, 34, 19, -5, 26, 204, 16166 }, // ß
-    { 18, 27, 19, 1, 26, 122, 16370 }, // à
-    { 18, 27, 19, 1, 26, 122, 16492 }, // á
-    { 18, 27, 19, 1, 26, 122, 16614 }, // â
-    { 18, 26, 19, 1, 25, 117, 16736 }, // ã
-    { 18, 26, 19, 1, 25, 117, 16853 }, // ä
-    { 18, 29, 19, 1, 28, 131, 16970 }, // å
-    { 26, 20, 27, 1, 19, 130, 17101 }, // æ
-    { 15, 27, 15, 1, 19, 102, 17231 }, // ç
-    { 15, 27, 17, 1, 26, 102, 17333 }, // è
-    { 16, 27, 17, 1, 26, 108, 17435 }, // é
-    { 15, 27, 17, 1, 26, 102, 17543 }, // ê
-    { 15, 26, 17, 1, 25, 98, 17645 }, // ë
-    { 9, 26, 9, 0, 26, 59, 17743 }, // ì
-    { 12, 26, 9, 0, 26, 78, 17802 }, // í
-    { 12, 26, 9, 0, 26, 78, 17880 }, // î
-    { 12, 25, 9, 0, 25, 75, 17958 }, // ï
-    { 18, 27, 19, 1, 26, 122, 18033 }, // ð
-    { 19, 25, 19, 0, 25, 119, 18155 }, // ñ
-    { 17, 27, 19, 1, 26, 115, 18274 }, // ò
-    { 17, 27, 19, 1, 26, 115, 18389 }, // ó
-    { 17, 27, 19, 1, 26, 115, 18504 }, // ô
-    { 17, 26, 19, 1, 25, 111, 18619 }, // õ
-    { 17, 26, 19, 1, 25, 111, 18730 }, // ö
-    { 17, 16, 19, 2, 20, 68, 18841 }, // ÷
-    { 18, 22, 19, 0, 20, 99, 18909 }, // ø
-    { 18, 27, 19, 1, 26, 122, 19008 }, // ù
-    { 18, 27, 19, 1, 26, 122, 19130 }, // ú
-    { 18, 27, 19, 1, 26, 122, 19252 }, // û
-    { 18, 26, 19, 1, 25, 117, 19374 }, // ü
-    { 22, 34, 16, -4, 26, 187, 19491 }, // ý
-    { 19, 34, 19, -1, 26, 162, 19678 }, // þ
-    { 22, 33, 16, -4, 25, 182, 19840 }, // ÿ
-    { 20, 29, 19, -2, 29, 145, 20022 }, // Ā
-    { 18, 24, 19, 1, 23, 108, 20167 }, // ā
-    { 21, 31, 19, -2, 31, 163, 20275 }, // Ă
-    { 18, 26, 19, 1, 25, 117, 20438 }, // ă
-    { 20, 32, 19, -2, 24, 160, 20555 }, // Ą
-    { 18, 27, 19, 1, 19, 122, 20715 }, // ą
-    { 20, 33, 20, 2, 32, 165, 20837 }, // Ć
-    { 15, 27, 15, 1, 26, 102, 21002 }, // ć
-    { 20, 33, 20, 2, 32, 165, 21104 }, // Ĉ
-    { 15, 27, 15, 1, 26, 102, 21269 }, // ĉ
-    { 20, 32, 20, 2, 31, 160, 21371 }, // Ċ
-    { 15, 26, 15, 1, 25, 98, 21531 }, // ċ
-    { 20, 33, 20, 2, 32, 165, 21629 }, // Č
-    { 16, 27, 15, 1, 26, 108, 21794 }, // č
-    { 21, 32, 22, 1, 32, 168, 21902 }, // Ď
-    { 25, 27, 20, 1, 26, 169, 22070 }, // ď
-    { 21, 24, 22, 1, 24, 126, 22239 }, // Đ
-    { 21, 27, 19, 1, 26, 142, 22365 }, // đ
-    { 18, 29, 17, 1, 29, 131, 22507 }, // Ē
-    { 15, 24, 17, 1, 23, 90, 22638 }, // ē
-    { 18, 31, 17, 1, 31, 140, 22728 }, // Ĕ
-    { 16, 26, 17, 1, 25, 104, 22868 }, // ĕ
-    { 18, 31, 17, 1, 31, 140, 22972 }, // Ė
-    { 15, 26, 17, 1, 25, 98, 23112 }, // ė
-    { 18, 32, 17, 1, 24, 144, 23210 }, // Ę
-    { 15, 27, 17, 1, 19, 102, 23354 }, // ę
-    { 18, 32, 17, 1, 32, 144, 23456 }, // Ě
-    { 16, 27, 17, 1, 26, 108, 23600 }, // ě
-    { 21, 33, 23, 2, 32, 174, 23708 }, // Ĝ
-    { 19, 34, 19, 0, 26, 162, 23882 }, // ĝ
-    { 21, 32, 23, 2, 31, 168, 24044 }, // Ğ
-    { 19, 33, 19, 0, 25, 157, 24212 }, // ğ
-    { 21, 32, 23, 2, 31, 168, 24369 }, // Ġ
-    { 19, 33, 19, 0, 25, 157, 24537 }, // ġ
-    { 21, 33, 23, 2, 25, 174, 24694 }, // Ģ
-    { 19, 34, 19, 0, 26, 162, 24868 }, // ģ
-    { 22, 32, 23, 1, 32, 176, 25030 }, // Ĥ
-    { 18, 33, 19, 0, 33, 149, 25206 }, // ĥ
-    { 25, 24, 23, 1, 24, 150, 25355 }, // Ħ
-    { 18, 26, 19, 0, 26, 117, 25505 }, // ħ
-    { 17, 31, 11, -1, 31, 132, 25622 }, // Ĩ
-    { 14, 25, 9, 0, 25, 88, 25754 }, // ĩ
-    { 15, 29, 11, -1, 29, 109, 25842 }, // Ī
-    { 12, 23, 9, 0, 23, 69, 25951 }, // ī
-    { 16, 31, 11, -1, 31, 124, 26020 }, // Ĭ
-    { 13, 25, 9, 0, 25, 82, 26144 }, // ĭ
-    { 14, 32, 11, -1, 24, 112, 26226 }, // Į
-    { 11, 33, 9, -2, 25, 91, 26338 }, // į
-    { 14, 31, 11, -1, 31, 109, 26429 }, // İ
-    { 8, 18, 9, 0, 18, 36, 26538 }, // ı
-    { 22, 31, 20, -1, 24, 171, 26574 }, // Ĳ
-    { 18, 33, 17, 0, 25, 149, 26745 }, // ĳ
-    { 20, 39, 9, -6, 32, 195, 26894 }, // Ĵ
-    { 17, 34, 9, -5, 26, 145, 27089 }, // ĵ
-    { 21, 32, 19, 1, 24, 168, 27234 }, // Ķ
-    { 18, 34, 17, 0, 26, 153, 27402 }, // ķ
-    { 18, 18, 17, 0, 18, 81, 27555 }, // ĸ
-    { 14, 32, 16, 1, 32, 112, 27636 }, // Ĺ
-    { 14, 33, 9, 0, 33, 116, 27748 }, // ĺ
-    { 13, 32, 16, 1, 24, 104, 27864 }, // Ļ
-    { 12, 34, 9, -2, 26, 102, 27968 }, // ļ
-    { 17, 24, 16, 1, 24, 102, 28070 }, // Ľ
-    { 15, 26, 10, 0, 26, 98, 28172 }, // ľ
-    { 14, 24, 16, 1, 24, 84, 28270 }, // Ŀ
-    { 12, 26, 10, 0, 26, 78, 28354 }, // ŀ
-    { 14, 24, 16, 0, 24, 84, 28432 }, // Ł
-    { 10, 26, 9, 0, 26, 65, 28516 }, // ł
-    { 23, 32, 24, 1, 32, 184, 28581 }, // Ń
-    { 18, 26, 19, 0, 26, 117, 28765 }, // ń
-    { 23, 32, 24, 1, 24, 184, 28882 }, // Ņ
-    { 18, 27, 19, 0, 19, 122, 29066 }, // ņ
-    { 23, 32, 24, 1, 32, 184, 29188 }, // Ň
-    { 19, 26, 19, 0, 26, 124, 29372 }, // ň
-    { 20, 24, 22, 1, 24, 120, 29496 }, // ŉ
-    { 23, 31, 24, 1, 24, 179, 29616 }, // Ŋ
-    { 18, 27, 19, 0, 19, 122, 29795 }, // ŋ
-    { 21, 30, 24, 2, 29, 158, 29917 }, // Ō
-    { 17, 24, 19, 1, 23, 102, 30075 }, // ō
-    { 21, 32, 24, 2, 31, 168, 30177 }, // Ŏ
-    { 17, 26, 19, 1, 25, 111, 30345 }, // ŏ
-    { 23, 33, 24, 2, 32, 190, 30456 }, // Ő
-    { 19, 27, 19, 1, 26, 129, 30646 }, // ő
-    { 28, 26, 29, 2, 25, 182, 30775 }, // Œ
-    { 27, 20, 29, 1, 19, 135, 30957 }, // œ
-    { 18, 32, 19, 1, 32, 144, 31092 }, // Ŕ
-    { 16, 26, 13, 0, 26, 104, 31236 }, // ŕ
-    { 18, 32, 19, 1, 24, 144, 31340 }, // Ŗ
-    { 17, 27, 13, -2, 19, 115, 31484 }, // ŗ
-    { 19, 32, 19, 1, 32, 152, 31599 }, // Ř
-    { 17, 26, 13, 0, 26, 111, 31751 }, // ř
-    { 18, 33, 17, 0, 32, 149, 31862 }, // Ś
-    { 15, 27, 14, 0, 26, 102, 32011 }, // ś
-    { 18, 33, 17, 0, 32, 149, 32113 }, // Ŝ
-    { 15, 27, 14, 0, 26, 102, 32262 }, // ŝ
-    { 18, 33, 17, 0, 25, 149, 32364 }, // Ş
-    { 14, 27, 14, 0, 19, 95, 32513 }, // ş
-    { 18, 33, 17, 0, 32, 149, 32608 }, // Š
-    { 16, 27, 14, 0, 26, 108, 32757 }, // š
-    { 18, 32, 17, 2, 24, 144, 32865 }, // Ţ
-    { 12, 30, 11, 1, 22, 90, 33009 }, // ţ
-    { 17, 32, 17, 3, 32, 136, 33099 }, // Ť
-    { 14, 27, 11, 1, 26, 95, 33235 }, // ť
-    { 18, 24, 17, 2, 24, 108, 33330 }, // Ŧ
-    { 13, 23, 11, 0, 22, 75, 33438 }, // ŧ
-    { 21, 32, 23, 2, 31, 168, 33513 }, // Ũ
-    { 18, 26, 19, 1, 25, 117, 33681 }, // ũ
-    { 21, 30, 23, 2, 29, 158, 33798 }, // Ū
-    { 18, 24, 19, 1, 23, 108, 33956 }, // ū
-    { 21, 32, 23, 2, 31, 168, 34064 }, // Ŭ
-    { 18, 26, 19, 1, 25, 117, 34232 }, // ŭ
-    { 21, 35, 23, 2, 34, 184, 34349 }, // Ů
-    { 18, 29, 19, 1, 28, 131, 34533 }, // ů
-    { 22, 33, 23, 2, 32, 182, 34664 }, // Ű
-    { 20, 27, 19, 1, 26, 135, 34846 }, // ű
-    { 21, 32, 23, 2, 24, 168, 34981 }, // Ų
-    { 18, 26, 19, 1, 18, 117, 35149 }, // ų
-    { 29, 32, 29, 3, 32, 232, 35266 }, // Ŵ
-    { 25, 26, 24, 1, 26, 163, 35498 }, // ŵ
-    { 18, 32, 17, 3, 32, 144, 35661 }, // Ŷ
-    { 22, 34, 16, -4, 26, 187, 35805 }, // ŷ
-    { 18, 31, 17, 3, 31, 140, 35992 }, // Ÿ
-    { 21, 32, 18, -1, 32, 168, 36132 }, // Ź
-    { 17, 26, 15, -1, 26, 111, 36300 }, // ź
-    { 21, 31, 18, -1, 31, 163, 36411 }, // Ż
-    { 16, 25, 15, -1, 25, 100, 36574 }, // ż
-    { 21, 32, 18, -1, 32, 168, 36674 }, // Ž
-    { 17, 26, 15, -1, 26, 111, 36842 }, // ž
-    { 20, 34, 9, -5, 26, 170, 36953 }, // ſ
-    { 6, 6, 0, -13, 26, 9, 37123 }, // ̀
-    { 8, 6, 0, -8, 26, 12, 37132 }, // ́
-    { 11, 6, 0, -3, 26, 17, 37144 }, // ̂
-    { 13, 5, 0, -14, 25, 17, 37161 }, // ̃
-    { 11, 3, 0, -3, 23, 9, 37178 }, // ̄
-    { 14, 4, 0, -3, 29, 14, 37187 }, // ̅
-    { 10, 5, 0, -2, 25, 13, 37201 }, // ̆
-    { 4, 5, 0, 1, 25, 5, 37214 }, // ̇
-    { 10, 4, 0, -2, 25, 10, 37219 }, // ̈
-    { 7, 9, 0, -10, 28, 16, 37229 }, // ̉
-    { 8, 8, 0, -1, 28, 16, 37245 }, // ̊
-    { 13, 6, 0, -2, 26, 20, 37261 }, // ̋
-    { 11, 6, 0, -2, 26, 17, 37281 }, // ̌
-    { 6, 10, 0, 0, 26, 15, 37298 }, // ̍
-    { 10, 7, 0, -2, 26, 18, 37313 }, // ̎
-    { 12, 6, 0, -17, 26, 18, 37331 }, // ̏
-    { 11, 9, 0, -2, 29, 25, 37349 }, // ̐
-    { 11, 5, 0, -3, 25, 14, 37374 }, // ̑
-    { 7, 9, 0, -1, 24, 16, 37388 }, // ̒
-    { 7, 9, 0, -1, 24, 16, 37404 }, // ̓
-    { 5, 9, 0, 0, 24, 12, 37420 }, // ̔
-    { 7, 9, 0, -1, 24, 16, 37432 }, // ̕
-    { 7, 6, 0, -7, -1, 11, 37448 }, // ̖
-    { 8, 6, 0, -5, -1, 12, 37459 }, // ̗
-    { 8, 8, 0, -6, 0, 16, 37471 }, // ̘
-    { 8, 8, 0, -7, 0, 16, 37487 }, // ̙
-    { 10, 10, 11, 3, 26, 25, 37503 }, // ̚
-    { 8, 8, 0, -2, 26, 16, 37528 }, // ̛
-    { 5, 8, 0, -2, 0, 10, 37544 }, // ̜
-    { 8, 6, 0, -7, -1, 12, 37554 }, // ̝
-    { 8, 6, 0, -6, -1, 12, 37566 }, // ̞
-    { 9, 8, 0, -7, 0, 18, 37578 }, // ̟
-    { 8, 3, 0, -7, -2, 6, 37596 }, // ̠
-    { 8, 10, 0, -7, 2, 20, 37602 }, // ̡
-    { 7, 10, 0, -4, 2, 18, 37622 }, // ̢
-    { 4, 4, 0, -14, -2, 4, 37640 }, // ̣
-    { 10, 4, 0, -8, -2, 10, 37644 }, // ̤
-    { 8, 8, 0, -7, 0, 16, 37654 }, // ̥
-    { 6, 6, 0, 2, -2, 9, 37670 }, // ̦
-    { 7, 8, 0, -6, 0, 14, 37679 }, // ̧
-    { 6, 8, 0, -5, 0, 12, 37693 }, // ̨
-    { 5, 10, 0, -5, -1, 13, 37705 }, // ̩
-    { 14, 7, 0, -10, -1, 25, 37718 }, // ̪
-    { 14, 4, 0, -9, -2, 14, 37743 }, // ̫
-    { 11, 6, 0, -7, -1, 17, 37757 }, // ̬
-    { 11, 6, 0, -8, -1, 17, 37774 }, // ̭
-    { 10, 5, 0, -7, -1, 13, 37791 }, // ̮
-    { 11, 5, 0, -8, -1, 14, 37804 }, // ̯
-    { 13, 5, 0, -9, -1, 17, 37818 }, // ̰
-    { 10, 3, 0, -8, -2, 8, 37835 }, // ̱
-    { 15, 3, 0, -10, -3, 12, 37843 }, // ̲
-    { 15, 8, 0, -10, 0, 30, 37855 }, // ̳
-    { 14, 5, 0, -7, 12, 18, 37885 }, // ̴
-    { 14, 4, 0, -7, 12, 14, 37903 }, // ̵
-    { 24, 3, 0, -12, 11, 18, 37917 }, // ̶
-    { 10, 8, 0, -5, 14, 20, 37935 }, // ̷
-    { 20, 28, 0, -10, 26, 140, 37955 }, // ̸
-    { 5, 8, 0, -2, 0, 10, 38095 }, // ̹
-    { 14, 7, 0, -10, -1, 25, 38105 }, // ̺
-    { 14, 8, 0, -10, 0, 28, 38130 }, // ̻
-    { 13, 4, 0, -9, -2, 13, 38158 }, // ̼
-    { 8, 7, 0, -1, 26, 14, 38171 }, // ̽
-    { 8, 10, 0, -1, 29, 20, 38185 }, // ̾
-    { 15, 8, 0, -3, 33, 30, 38205 }, // ̿
-    { 7, 6, 0, -2, 26, 11, 38235 }, // ̀
-    { 8, 6, 0, 1, 26, 12, 38246 }, // ́
-    { 13, 5, 0, 5, 25, 17, 38258 }, // ͂
-    { 5, 6, 0, 1, 26, 8, 38275 }, // ̓
-    { 13, 6, 0, -3, 26, 20, 38283 }, // ̈́
-    { 6, 6, 0, -4, -2, 9, 38303 }, // ͅ
-    { 16, 7, 0, -5, 26, 28, 38312 }, // ͆
-    { 16, 8, 0, -10, 0, 32, 38340 }, // ͇
-    { 10, 7, 0, -8, -1, 18, 38372 }, // ͈
-    { 8, 6, 0, -6, -2, 12, 38390 }, // ͉
-    { 14, 8, 0, -4, 26, 28, 38402 }, // ͊
-    { 13, 12, 0, -3, 31, 39, 38430 }, // ͋
-    { 13, 9, 0, -3, 29, 30, 38469 }, // ͌
-    { 13, 7, 0, -9, -1, 23, 38499 }, // ͍
-    { 7, 8, 0, -6, 0, 14, 38522 }, // ͎
-    { 24, 24, 0, -12, 24, 144, 38536 }, // ͏
-    { 6, 8, 0, 0, 27, 12, 38680 }, // ͐
-    { 5, 8, 0, 4, 28, 10, 38692 }, // ͑
-    { 10, 9, 0, -2, 29, 23, 38702 }, // ͒
-    { 8, 7, 0, -6, -1, 14, 38725 }, // ͓
-    { 6, 7, 0, -5, -1, 11, 38739 }, // ͔
-    { 7, 7, 0, -5, -1, 13, 38750 }, // ͕
-    { 13, 7, 0, -8, -1, 23, 38763 }, // ͖
-    { 5, 8, 0, 3, 28, 10, 38786 }, // ͗
-    { 4, 5, 0, 1, 25, 5, 38796 }, // ͘
-    { 9, 7, 0, -7, -1, 16, 38801 }, // ͙
-    { 13, 8, 0, -9, 0, 26, 38817 }, // ͚
-    { 7, 8, 0, 0, 27, 14, 38843 }, // ͛
-    { 24, 7, 0, -14, -1, 42, 38857 }, // ͜
-    { 24, 7, 0, -9, 26, 42, 38899 }, // ͝
-    { 18, 3, 0, -6, 23, 14, 38941 }, // ͞
-    { 17, 3, 0, -11, -2, 13, 38955 }, // ͟
-    { 26, 5, 0, -10, 25, 33, 38968 }, // ͠
-    { 24, 7, 0, -9, 29, 42, 39001 }, // ͡
-    { 25, 7, 0, -16, -1, 44, 39043 }, // ͢
-    { 9, 8, 0, -1, 28, 18, 39087 }, // ͣ
-    { 7, 8, 0, 0, 28, 14, 39105 }, // ͤ
-    { 5, 11, 0, 1, 31, 14, 39119 }, // ͥ
-    { 8, 8, 0, -1, 28, 16, 39133 }, // ͦ
-    { 9, 8, 0, -1, 28, 18, 39149 }, // ͧ
-    { 7, 8, 0, 0, 28, 14, 39167 }, // ͨ
-    { 9, 11, 0, -1, 31, 25, 39181 }, // ͩ
-    { 8, 11, 0, -1, 31, 22, 39206 }, // ͪ
-    { 12, 8, 0, -3, 28, 24, 39228 }, // ͫ
-    { 7, 8, 0, 0, 28, 14, 39252 }, // ͬ
-    { 6, 10, 0, 1, 30, 15, 39266 }, // ͭ
-    { 8, 8, 0, 0, 28, 16, 39281 }, // ͮ
-    { 9, 8, 0, -1, 28, 18, 39297 }, // ͯ
-    { 18, 32, 17, 1, 32, 144, 39315 }, // Ѐ
-    { 18, 31, 17, 1, 31, 140, 39459 }, // Ё
-    { 18, 25, 22, 3, 24, 113, 39599 }, // Ђ
-    { 18, 32, 16, 1, 32, 144, 39712 }, // Ѓ
-    { 20, 26, 19, 1, 25, 130, 39856 }, // Є
-    { 18, 26, 17, 0, 25, 117, 39986 }, // Ѕ
-    { 9, 24, 9, 1, 24, 54, 40103 }, // І
-    { 12, 31, 9, 1, 31, 93, 40157 }, // Ї
-    { 16, 31, 9, -6, 24, 124, 40250 }, // Ј
-    { 32, 25, 31, -2, 24, 200, 40374 }, // Љ
-    { 29, 24, 31, 1, 24, 174, 40574 }, // Њ
-    { 18, 24, 23, 3, 24, 108, 40748 }, // Ћ
-    { 21, 32, 19, 1, 32, 168, 40856 }, // Ќ
-    { 23, 32, 23, 1, 32, 184, 41024 }, // Ѝ
-    { 22, 32, 19, 0, 31, 176, 41208 }, // Ў
-    { 22, 30, 22, 1, 24, 165, 41384 }, // Џ
-    { 20, 24, 19, -2, 24, 120, 41549 }, // А
-    { 18, 24, 18, 1, 24, 108, 41669 }, // Б
-    { 19, 24, 20, 1, 24, 114, 41777 }, // В
-    { 17, 24, 16, 1, 24, 102, 41891 }, // Г
-    { 26, 30, 23, -3, 24, 195, 41993 }, // Д
-    { 18, 24, 17, 1, 24, 108, 42188 }, // Е
-    { 32, 24, 27, -2, 24, 192, 42296 }, // Ж
-    { 19, 26, 17, -1, 25, 124, 42488 }, // З
-    { 23, 24, 23, 1, 24, 138, 42612 }, // И
-    { 23, 31, 23, 1, 31, 179, 42750 }, // Й
-    { 21, 24, 19, 1, 24, 126, 42929 }, // К
-    { 25, 25, 22, -2, 24, 157, 43055 }, // Л
-    { 27, 24, 28, 1, 24, 162, 43212 }, // М
-    { 22, 24, 23, 1, 24, 132, 43374 }, // Н
-    { 21, 26, 23, 2, 25, 137, 43506 }, // О
-    { 22, 24, 22, 1, 24, 132, 43643 }, // П
-    { 18, 24, 18, 1, 24, 108, 43775 }, // Р
-    { 19, 26, 19, 2, 25, 124, 43883 }, // С
-    { 17, 24, 17, 3, 24, 102, 44007 }, // Т
-    { 22, 25, 19, 0, 24, 138, 44109 }, // У
-    { 25, 26, 26, 1, 25, 163, 44247 }, // Ф
-    { 23, 24, 18, -2, 24, 138, 44410 }, // Х
-    { 22, 30, 23, 1, 24, 165, 44548 }, // Ц
-    { 18, 24, 21, 3, 24, 108, 44713 }, // Ч
-    { 31, 24, 32, 1, 24, 186, 44821 }, // Ш
-    { 31, 30, 32, 1, 24, 233, 45007 }, // Щ
-    { 17, 24, 21, 3, 24, 102, 45240 }, // Ъ
-    { 26, 24, 26, 1, 24, 156, 45342 }, // Ы
-    { 16, 24, 18, 1, 24, 96, 45498 }, // Ь
-    { 20, 26, 20, 0, 25, 130, 45594 }, // Э
-    { 30, 26, 31, 1, 25, 195, 45724 }, // Ю
-    { 22, 24, 19, -2, 24, 132, 45919 }, // Я
-    { 18, 20, 19, 1, 19, 90, 46051 }, // а
-    { 18, 27, 18, 1, 26, 122, 46141 }, // б
-    { 16, 20, 17, 1, 19, 80, 46263 }, // в
-    { 15, 20, 15, 0, 19, 75, 46343 }, // г
-    { 17, 27, 19, 1, 26, 115, 46418 }, // д
-    { 15, 20, 16, 1, 19, 75, 46533 }, // е
-    { 31, 20, 29, -1, 19, 155, 46608 }, // ж
-    { 14, 20, 15, 0, 19, 70, 46763 }, // з
-    { 18, 19, 19, 1, 18, 86, 46833 }, // и
-    { 18, 26, 19, 1, 25, 117, 46919 }, // й
-    { 18, 18, 17, 0, 18, 81, 47036 }, // к
-    { 21, 19, 19, -2, 18, 100, 47117 }, // л
-    { 25, 18, 25, 0, 18, 113, 47217 }, // м
-    { 19, 18, 19, 0, 18, 86, 47330 }, // н
-    { 17, 20, 19, 1, 19, 85, 47416 }, // о
-    { 18, 19, 19, 0, 19, 86, 47501 }, // п
-    { 19, 27, 19, -1, 19, 129, 47587 }, // р
-    { 15, 20, 15, 1, 19, 75, 47716 }, // с
-    { 28, 19, 29, 0, 19, 133, 47791 }, // т
-    { 21, 26, 16, -3, 18, 137, 47924 }, // у
-    { 21, 34, 22, 1, 26, 179, 48061 }, // ф
-    { 19, 18, 15, -2, 18, 86, 48240 }, // х
-    { 18, 23, 20, 1, 18, 104, 48326 }, // ц
-    { 16, 18, 19, 2, 18, 72, 48430 }, // ч
-    { 28, 19, 29, 1, 18, 133, 48502 }, // ш
-    { 28, 23, 30, 1, 18, 161, 48635 }, // щ
-    { 18, 19, 20, 1, 18, 86, 48796 }, // ъ
-    { 23, 19, 24, 1, 18, 110, 48882 }, // ы
-    { 15, 19, 17, 1, 18, 72, 48992 }, // ь
-    { 15, 20, 16, 0, 19, 75, 49064 }, // э
-    { 25, 20, 26, 0, 19, 125, 49139 }, // ю
-    { 19, 18, 17, -2, 18, 86, 49264 }, // я
-    { 15, 27, 16, 1, 26, 102, 49350 }, // ѐ
-    { 16, 26, 16, 1, 25, 104, 49452 }, // ё
-    { 18, 34, 19, 0, 26, 153, 49556 }, // ђ
-    { 16, 27, 15, 0, 26, 108, 49709 }, // ѓ
-    { 15, 20, 15, 1, 19, 75, 49817 }, // є
-    { 14, 20, 14, 0, 19, 70, 49892 }, // ѕ
-    { 10, 25, 9, 0, 25, 63, 49962 }, // і
-    { 11, 25, 8, 0, 25, 69, 50025 }, // ї
-    { 14, 33, 8, -5, 25, 116, 50094 }, // ј
-    { 28, 19, 27, -2, 18, 133, 50210 }, // љ
-    { 26, 19, 27, 0, 18, 124, 50343 }, // њ
-    { 18, 26, 19, 0, 26, 117, 50467 }, // ћ
-    { 18, 26, 17, 0, 26, 117, 50584 }, // ќ
-    { 18, 27, 19, 1, 26, 122, 50701 }, // ѝ
-    { 21, 33, 16, -3, 25, 174, 50823 }, // ў
-    { 18, 25, 19, 1, 18, 113, 50997 }, // џ
-    { 30, 25, 31, 3, 24, 188, 51110 }, // Ѡ
-    { 26, 18, 26, 2, 18, 117, 51298 }, // ѡ
-    { 16, 24, 20, 2, 24, 96, 51415 }, // Ѣ
-    { 26, 20, 28, 0, 19, 130, 51511 }, // ѣ
-    { 30, 26, 29, 1, 25, 195, 51641 }, // Ѥ
-    { 24, 20, 23, 0, 19, 120, 51836 }, // ѥ
-    { 21, 24, 20, -2, 24, 126, 51956 }, // Ѧ
-    { 18, 18, 18, -2, 18, 81, 52082 }, // ѧ
-    { 26, 24, 28, 1, 24, 156, 52163 }, // Ѩ
-    { 23, 18, 24, 0, 18, 104, 52319 }, // ѩ
-    { 26, 24, 22, -2, 24, 156, 52423 }, // Ѫ
-    { 22, 18, 20, -2, 18, 99, 52579 }, // ѫ
-    { 31, 24, 31, 1, 24, 186, 52678 }, // Ѭ
-    { 27, 18, 27, 0, 18, 122, 52864 }, // ѭ
-    { 20, 36, 18, -2, 29, 180, 52986 }, // Ѯ
-    { 17, 30, 15, -2, 23, 128, 53166 }, // ѯ
-    { 25, 24, 25, 3, 24, 150, 53294 }, // Ѱ
-    { 22, 34, 24, 1, 26, 187, 53444 }, // ѱ
-    { 21, 26, 24, 2, 25, 137, 53631 }, // Ѳ
-    { 17, 20, 19, 1, 19, 85, 53768 }, // ѳ
-    { 20, 24, 19, 3, 24, 120, 53853 }, // Ѵ
-    { 17, 18, 15, 1, 18, 77, 53973 }, // ѵ
-    { 20, 32, 19, 3, 32, 160, 54050 }, // Ѷ
-    { 17, 26, 15, 1, 26, 111, 54210 }, // ѷ
-    { 40, 33, 40, 2, 25, 330, 54321 }, // Ѹ
-    { 35, 27, 34, 1, 19, 237, 54651 }, // ѹ
-    { 22, 29, 25, 2, 26, 160, 54888 }, // Ѻ
-    { 17, 22, 19, 1, 20, 94, 55048 }, // ѻ
-    { 29, 36, 32, 2, 35, 261, 55142 }, // Ѽ
-    { 25, 31, 27, 1, 30, 194, 55403 }, // ѽ
-    { 30, 31, 31, 3, 30, 233, 55597 }, // Ѿ
-    { 26, 24, 26, 2, 24, 156, 55830 }, // ѿ
-    { 20, 33, 20, 2, 25, 165, 55986 }, // Ҁ
-    { 15, 27, 15, 1, 19, 102, 56151 }, // ҁ
-    { 18, 22, 20, 1, 21, 99, 56253 }, // ҂
-    { 14, 5, 0, -14, 24, 18, 56352 }, // ҃
-    { 14, 5, 0, -14, 25, 18, 56370 }, // ҄
-    { 4, 6, 0, -9, 26, 6, 56388 }, // ҅
-    { 5, 6, 0, -9, 26, 8, 56394 }, // ҆
-    { 14, 5, 0, -3, 30, 18, 56402 }, // ҇
-    { 38, 36, 0, -19, 27, 342, 56420 }, // ҈
-    { 38, 38, 0, -19, 28, 361, 56762 }, // ҉
-    { 23, 38, 24, 1, 31, 219, 57123 }, // Ҋ
-    { 18, 33, 19, 1, 26, 149, 57342 }, // ҋ
-    { 16, 24, 18, 1, 24, 96, 57491 }, // Ҍ
-    { 14, 27, 17, 2, 26, 95, 57587 }, // ҍ
-    { 18, 24, 19, 1, 24, 108, 57682 }, // Ҏ
-    { 19, 27, 19, -1, 19, 129, 57790 }, // ҏ
-    { 19, 29, 16, 1, 29, 138, 57919 }, // Ґ
-    { 16, 24, 13, 0, 24, 96, 58057 }, // ґ
-    { 18, 24, 16, 1, 24, 108, 58153 }, // Ғ
-    { 15, 18, 13, 0, 18, 68, 58261 }, // ғ
-    { 18, 33, 20, 1, 24, 149, 58329 }, // Ҕ
-    { 15, 27, 17, 0, 18, 102, 58478 }, // ҕ
-    { 32, 31, 28, -2, 24, 248, 58580 }, // Җ
-    { 31, 26, 28, -1, 19, 202, 58828 }, // җ
-    { 19, 33, 17, -1, 25, 157, 59030 }, // Ҙ
-    { 14, 27, 15, 0, 19, 95, 59187 }, // ҙ
-    { 21, 31, 20, 1, 24, 163, 59282 }, // Қ
-    { 18, 25, 18, 0, 18, 113, 59445 }, // қ
-    { 21, 24, 19, 1, 24, 126, 59558 }, // Ҝ
-    { 19, 18, 16, 0, 18, 86, 59684 }, // ҝ
-    { 21, 24, 19, 1, 24, 126, 59770 }, // Ҟ
-    { 18, 26, 16, 0, 26, 117, 59896 }, // ҟ
-    { 22, 24, 21, 3, 24, 132, 60013 }, // Ҡ
-    { 20, 18, 19, 1, 18, 90, 60145 }, // ҡ
-    { 22, 31, 23, 1, 24, 171, 60235 }, // Ң
-    { 20, 25, 20, 0, 18, 125, 60406 }, // ң
-    { 28, 24, 25, 1, 24, 168, 60531 }, // Ҥ
-    { 25, 18, 23, 0, 18, 113, 60699 }, // ҥ
-    { 30, 33, 33, 1, 24, 248, 60812 }, // Ҧ
-    { 26, 27, 27, 0, 18, 176, 61060 }, // ҧ
-    { 21, 27, 24, 2, 25, 142, 61236 }, // Ҩ
-    { 18, 20, 20, 1, 19, 90, 61378 }, // ҩ
-    { 20, 33, 20, 2, 25, 165, 61468 }, // Ҫ
-    { 15, 27, 15, 1, 19, 102, 61633 }, // ҫ
-    { 17, 31, 17, 3, 24, 132, 61735 }, // Ҭ
-    { 28, 26, 30, 0, 19, 182, 61867 }, // ҭ
-    { 18, 24, 17, 3, 24, 108, 62049 }, // Ү
-    { 17, 26, 16, 1, 18, 111, 62157 }, // ү
-    { 20, 24, 17, 1, 24, 120, 62268 }, // Ұ
-    { 19, 26, 16, -1, 18, 124, 62388 }, // ұ
-    { 23, 31, 19, -2, 24, 179, 62512 }, // Ҳ
-    { 19, 25, 18, -1, 18, 119, 62691 }, // ҳ
-    { 24, 31, 26, 3, 24, 186, 62810 }, // Ҵ
-    { 20, 25, 22, 1, 18, 125, 62996 }, // ҵ
-    { 19, 31, 22, 3, 24, 148, 63121 }, // Ҷ
-    { 16, 25, 18, 2, 18, 100, 63269 }, // ҷ
-    { 19, 24, 21, 3, 24, 114, 63369 }, // Ҹ
-    { 16, 18, 19, 2, 18, 72, 63483 }, // ҹ
-    { 19, 24, 21, 1, 24, 114, 63555 }, // Һ
-    { 18, 26, 19, 0, 26, 117, 63669 }, // һ
-    { 24, 26, 26, 2, 25, 156, 63786 }, // Ҽ
-    { 19, 20, 20, 1, 19, 95, 63942 }, // ҽ
-    { 24, 32, 26, 2, 25, 192, 64037 }, // Ҿ
-    { 19, 26, 20, 1, 19, 124, 64229 }, // ҿ
-    { 14, 24, 11, -1, 24, 84, 64353 }, // Ӏ
-    { 32, 31, 27, -2, 31, 248, 64437 }, // Ӂ
-    { 31, 26, 29, -1, 25, 202, 64685 }, // ӂ
-    { 21, 33, 21, 1, 24, 174, 64887 }, // Ӄ
-    { 18, 27, 17, 0, 18, 122, 65061 }, // ӄ
-    { 24, 31, 22, -2, 24, 186, 65183 }, // Ӆ
-    { 20, 26, 18, -2, 19, 130, 65369 }, // ӆ
-    { 22, 33, 23, 1, 24, 182, 65499 }, // Ӈ
-    { 20, 27, 20, 0, 18, 135, 65681 }, // ӈ
-    { 22, 31, 23, 1, 24, 171, 65816 }, // Ӊ
-    { 20, 25, 20, 0, 18, 125, 65987 }, // ӊ
-    { 19, 31, 21, 3, 24, 148, 66112 }, // Ӌ
-    { 16, 25, 19, 3, 18, 100, 66260 }, // ӌ
-    { 28, 31, 28, 1, 24, 217, 66360 }, // Ӎ
-    { 23, 25, 23, 0, 18, 144, 66577 }, // ӎ
-    { 14, 24, 11, -1, 24, 84, 66721 }, // ӏ
-    { 21, 31, 19, -2, 31, 163, 66805 }, // Ӑ
-    { 18, 26, 19, 1, 25, 117, 66968 }, // ӑ
-    { 20, 31, 19, -2, 31, 155, 67085 }, // Ӓ
-    { 18, 26, 19, 1, 25, 117, 67240 }, // ӓ
-    { 31, 24, 27, -2, 24, 186, 67357 }, // Ӕ
-    { 26, 20, 27, 1, 19, 130, 67543 }, // ӕ
-    { 18, 31, 17, 1, 31, 140, 67673 }, // Ӗ
-    { 17, 26, 17, 1, 25, 111, 67813 }, // ӗ
-    { 20, 26, 22, 1, 25, 130, 67924 }, // Ә
-    { 15, 20, 16, 0, 19, 75, 68054 }, // ә
-    { 20, 32, 22, 1, 31, 160, 68129 }, // Ӛ
-    { 16, 26, 16, 0, 25, 104, 68289 }, // ӛ
-    { 32, 31, 27, -2, 31, 248, 68393 }, // Ӝ
-    { 31, 26, 29, -1, 25, 202, 68641 }, // ӝ
-    { 19, 32, 17, -1, 31, 152, 68843 }, // Ӟ
-    { 15, 26, 15, 0, 25, 98, 68995 }, // ӟ
-    { 19, 25, 18, 0, 24, 119, 69093 }, // Ӡ
-    { 18, 26, 15, -3, 18, 117, 69212 }, // ӡ
-    { 23, 29, 23, 1, 29, 167, 69329 }, // Ӣ
-    { 18, 24, 19, 1, 23, 108, 69496 }, // ӣ
-    { 23, 31, 23, 1, 31, 179, 69604 }, // Ӥ
-    { 18, 26, 19, 1, 25, 117, 69783 }, // ӥ
-    { 21, 32, 24, 2, 31, 168, 69900 }, // Ӧ
-    { 17, 26, 19, 1, 25, 111, 70068 }, // ӧ
-    { 21, 26, 24, 2, 25, 137, 70179 }, // Ө
-    { 17, 20, 19, 1, 19, 85, 70316 }, // ө
-    { 21, 32, 24, 2, 31, 168, 70401 }, // Ӫ
-    { 17, 26, 19, 1, 25, 111, 70569 }, // ӫ
-    { 20, 32, 20, 0, 31, 160, 70680 }, // Ӭ
-    { 15, 26, 16, 0, 25, 98, 70840 }, // ӭ
-    { 22, 30, 19, 0, 29, 165, 70938 }, // Ӯ
-    { 22, 31, 16, -4, 23, 171, 71103 }, // ӯ
-    { 22, 32, 19, 0, 31, 176, 71274 }, // Ӱ
-    { 22, 33, 16, -4, 25, 182, 71450 }, // ӱ
-    { 22, 33, 19, 0, 32, 182, 71632 }, // Ӳ
-    { 22, 34, 16, -4, 26, 187, 71814 }, // ӳ
-    { 18, 31, 21, 3, 31, 140, 72001 }, // Ӵ
-    { 16, 25, 19, 2, 25, 100, 72141 }, // ӵ
-    { 18, 31, 16, 1, 24, 140, 72241 }, // Ӷ
-    { 15, 25, 13, 0, 18, 94, 72381 }, // ӷ
-    { 26, 31, 26, 1, 31, 202, 72475 }, // Ӹ
-    { 23, 26, 24, 1, 25, 150, 72677 }, // ӹ
-    { 19, 31, 16, 0, 24, 148, 72827 }, // Ӻ
-    { 16, 25, 13, -1, 18, 100, 72975 }, // ӻ
-    { 23, 31, 18, -2, 24, 179, 73075 }, // Ӽ
-    { 19, 25, 16, -2, 18, 119, 73254 }, // ӽ
-    { 23, 24, 18, -2, 24, 138, 73373 }, // Ӿ
-    { 19, 18, 16, -2, 18, 86, 73511 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 73597 }, //  
-    { 0, 0, 33, 0, 0, 0, 73597 }, //  
-    { 0, 0, 17, 0, 0, 0, 73597 }, //  
-    { 0, 0, 33, 0, 0, 0, 73597 }, //  
-    { 0, 0, 11, 0, 0, 0, 73597 }, //  
-    { 0, 0, 8, 0, 0, 0, 73597 }, //  
-    { 0, 0, 6, 0, 0, 0, 73597 }, //  
-    { 0, 0, 18, 0, 0, 0, 73597 }, //  
-    { 0, 0, 9, 0, 0, 0, 73597 }, //  
-    { 0, 0, 6, 0, 0, 0, 73597 }, //  
-    { 0, 0, 3, 0, 0, 0, 73597 }, //  
-    { 0, 0, 0, 0, 0, 0, 73597 }, // ​
-    { 0, 0, 0, 0, 0, 0, 73597 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 73597 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 73597 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 73660 }, // ‏
-    { 10, 4, 10, 0, 11, 10, 73723 }, // ‐
-    { 10, 4, 10, 0, 11, 10, 73733 }, // ‑
-    { 17, 4, 18, 1, 14, 17, 73743 }, // ‒
-    { 15, 4, 16, 0, 11, 15, 73760 }, // –
-    { 31, 4, 32, 0, 11, 31, 73775 }, // —
-    { 31, 4, 32, 0, 11, 31, 73806 }, // ―
-    { 10, 35, 18, 5, 26, 88, 73837 }, // ‖
-    { 16, 8, 13, -4, 0, 32, 73925 }, // ‗
-    { 7, 9, 6, 2, 24, 16, 73957 }, // ‘
-    { 7, 9, 6, 2, 24, 16, 73973 }, // ’
-    { 7, 9, 8, -2, 4, 16, 73989 }, // ‚
-    { 5, 9, 6, 3, 24, 12, 74005 }, // ‛
-    { 13, 9, 12, 2, 24, 30, 74017 }, // “
-    { 13, 9, 12, 2, 24, 30, 74047 }, // ”
-    { 14, 9, 14, -2, 4, 32, 74077 }, // „
-    { 10, 9, 12, 3, 24, 23, 74109 }, // ‟
-    { 13, 26, 16, 3, 26, 85, 74132 }, // †
-    { 16, 26, 16, 1, 26, 104, 74217 }, // ‡
-    { 8, 9, 13, 3, 17, 18, 74321 }, // •
-    { 11, 11, 12, 1, 18, 31, 74339 }, // ‣
-    { 5, 6, 17, 4, 5, 8, 74370 }, // ․
-    { 14, 6, 17, 0, 5, 21, 74378 }, // ‥
-    { 22, 6, 26, 0, 5, 33, 74399 }, // …
-    { 5, 6, 9, 2, 12, 8, 74432 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 74440 }, //  
-    { 0, 0, 20, 0, 0, 0, 74440 }, //  
-    { 9, 26, 0, -1, 21, 59, 74440 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 74499 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 74558 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 74614 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 74670 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 74726 }, //  
-    { 35, 26, 38, 2, 25, 228, 74726 }, // ‰
-    { 45, 26, 48, 2, 25, 293, 74954 }, // ‱
-    { 8, 9, 7, 2, 24, 18, 75247 }, // ′
-    { 14, 9, 13, 2, 24, 32, 75265 }, // ″
-    { 19, 9, 19, 2, 24, 43, 75297 }, // ‴
-    { 5, 9, 9, 4, 24, 12, 75340 }, // ‵
-    { 11, 9, 14, 4, 24, 25, 75352 }, // ‶
-    { 16, 9, 19, 4, 24, 36, 75377 }, // ‷
-    { 13, 11, 13, -3, 3, 36, 75413 }, // ‸
-    { 9, 15, 10, 1, 16, 34, 75449 }, // ‹
-    { 9, 15, 10, 0, 16, 34, 75483 }, // ›
-    { 26, 26, 28, 1, 25, 169, 75517 }, // ※
-    { 17, 25, 16, 0, 24, 107, 75686 }, // ‼
-    { 14, 26, 14, 2, 25, 91, 75793 }, // ‽
-    { 15, 3, 13, 3, 28, 12, 75884 }, // ‾
-    { 18, 7, 18, -2, -1, 32, 75896 }, // ‿
-    { 18, 8, 18, 2, 27, 36, 75928 }, // ⁀
-    { 16, 22, 11, -4, 14, 88, 75964 }, // ⁁
-    { 36, 31, 37, 0, 26, 279, 76052 }, // ⁂
-    { 9, 4, 10, 0, 11, 9, 76331 }, // ⁃
-    { 21, 24, 4, -8, 24, 126, 76340 }, // ⁄
-    { 14, 30, 10, -1, 24, 105, 76466 }, // ⁅
-    { 14, 30, 10, -3, 24, 105, 76571 }, // ⁆
-    { 28, 26, 29, 2, 25, 182, 76676 }, // ⁇
-    { 22, 26, 23, 2, 25, 143, 76858 }, // ⁈
-    { 24, 26, 23, 0, 25, 156, 77001 }, // ⁉
-    { 17, 18, 17, 2, 18, 77, 77157 }, // ⁊
-    { 17, 31, 20, 3, 26, 132, 77234 }, // ⁋
-    { 18, 17, 21, 1, 18, 77, 77366 }, // ⁌
-    { 18, 17, 21, 2, 18, 77, 77443 }, // ⁍
-    { 17, 16, 18, -1, 9, 68, 77520 }, // ⁎
-    { 7, 24, 9, 1, 19, 42, 77588 }, // ⁏
-    { 22, 35, 18, -2, 27, 193, 77630 }, // ⁐
-    { 19, 33, 18, 0, 26, 157, 77823 }, // ⁑
-    { 13, 26, 12, 0, 25, 85, 77980 }, // ⁒
-    { 29, 6, 33, 3, 13, 44, 78065 }, // ⁓
-    { 18, 8, 18, -3, 0, 36, 78109 }, // ⁔
-    { 18, 18, 19, 0, 17, 81, 78145 }, // ⁕
-    { 15, 26, 17, 1, 25, 98, 78226 }, // ⁖
-    { 25, 9, 24, 2, 24, 57, 78324 }, // ⁗
-    { 25, 26, 27, 1, 25, 163, 78381 }, // ⁘
-    { 25, 26, 28, 1, 25, 163, 78544 }, // ⁙
-    { 5, 26, 7, 1, 25, 33, 78707 }, // ⁚
-    { 20, 26, 22, 1, 25, 130, 78740 }, // ⁛
-    { 25, 26, 27, 1, 25, 163, 78870 }, // ⁜
-    { 5, 25, 9, 2, 24, 32, 79033 }, // ⁝
-    { 5, 26, 9, 3, 25, 33, 79065 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 79098 }, //  
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁤
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁦
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁧
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁨
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 79098 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 79154 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 79210 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 79266 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 79324 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 79380 }, // ⁯
-    { 11, 16, 12, 3, 29, 44, 79436 }, // ⁰
-    { 6, 16, 7, 2, 25, 24, 79480 }, // ⁱ
-    { 12, 16, 12, 2, 29, 48, 79504 }, // ⁴
-    { 11, 16, 12, 3, 29, 44, 79552 }, // ⁵
-    { 11, 16, 12, 3, 29, 44, 79596 }, // ⁶
-    { 12, 16, 12, 3, 29, 48, 79640 }, // ⁷
-    { 12, 16, 12, 2, 29, 48, 79688 }, // ⁸
-    { 11, 16, 12, 3, 29, 44, 79736 }, // ⁹
-    { 10, 10, 11, 3, 25, 25, 79780 }, // ⁺
-    { 10, 3, 11, 3, 22, 8, 79805 }, // ⁻
-    { 10, 6, 11, 3, 23, 15, 79813 }, // ⁼
-    { 9, 18, 6, 3, 30, 41, 79828 }, // ⁽
-    { 8, 18, 6, 0, 30, 36, 79869 }, // ⁾
-    { 12, 12, 13, 2, 21, 36, 79905 }, // ⁿ
-    { 11, 16, 12, -1, 11, 44, 79941 }, // ₀
-    { 7, 16, 12, 1, 11, 28, 79985 }, // ₁
-    { 12, 16, 12, -2, 11, 48, 80013 }, // ₂
-    { 12, 16, 12, -2, 11, 48, 80061 }, // ₃
-    { 12, 16, 12, -2, 11, 48, 80109 }, // ₄
-    { 11, 16, 12, -1, 11, 44, 80157 }, // ₅
-    { 11, 16, 12, -1, 11, 44, 80201 }, // ₆
-    { 12, 16, 12, -1, 11, 48, 80245 }, // ₇
-    { 11, 16, 12, -1, 11, 44, 80293 }, // ₈
-    { 11, 16, 12, -1, 11, 44, 80337 }, // ₉
-    { 10, 10, 11, -1, 7, 25, 80381 }, // ₊
-    { 10, 3, 11, -1, 4, 8, 80406 }, // ₋
-    { 10, 6, 11, -1, 5, 15, 80414 }, // ₌
-    { 8, 18, 6, 0, 12, 36, 80429 }, // ₍
-    { 8, 18, 6, -4, 12, 36, 80465 }, // ₎
-    { 12, 12, 12, -1, 8, 36, 80501 }, // ₐ
-    { 10, 12, 11, -1, 8, 30, 80537 }, // ₑ
-    { 11, 12, 12, -1, 8, 33, 80567 }, // ₒ
-    { 13, 12, 10, -3, 8, 39, 80600 }, // ₓ
-    { 10, 12, 11, -2, 8, 30, 80639 }, // ₔ
-    { 11, 16, 15, 0, 12, 44, 80669 }, // ₕ
-    { 11, 16, 12, 0, 12, 44, 80713 }, // ₖ
-    { 6, 16, 8, 0, 12, 24, 80757 }, // ₗ
-    { 18, 12, 21, 0, 8, 54, 80781 }, // ₘ
-    { 12, 12, 13, -2, 8, 36, 80835 }, // ₙ
-    { 13, 16, 13, -3, 8, 52, 80871 }, // ₚ
-    { 9, 12, 10, -1, 8, 27, 80923 }, // ₛ
-    { 8, 14, 7, -1, 10, 28, 80950 }, // ₜ
-    { 17, 25, 18, 2, 25, 107, 80978 }, // ₠
-    { 19, 28, 18, 1, 26, 133, 81085 }, // ₡
-    { 18, 26, 18, 2, 25, 117, 81218 }, // ₢
-    { 20, 24, 18, 0, 24, 120, 81335 }, // ₣
-    { 21, 25, 18, -1, 25, 132, 81455 }, // ₤
-    { 28, 27, 29, 0, 23, 189, 81587 }, // ₥
-    { 20, 24, 18, 0, 24, 120, 81776 }, // ₦
-    { 24, 25, 25, 0, 24, 150, 81896 }, // ₧
-    { 27, 25, 27, 0, 24, 169, 82046 }, // ₨
-    { 24, 24, 21, 0, 24, 144, 82215 }, // ₩
-    { 28, 24, 27, 0, 24, 168, 82359 }, // ₪
-    { 22, 32, 19, 0, 26, 176, 82527 }, // ₫
-    { 20, 26, 18, 1, 25, 130, 82703 }, // €
-    { 21, 24, 19, 1, 24, 126, 82833 }, // ₭
-    { 19, 24, 17, 1, 24, 114, 82959 }, // ₮
-    { 32, 33, 32, 0, 25, 264, 83073 }, // ₯
-    { 21, 33, 18, -2, 25, 174, 83337 }, // ₰
-    { 20, 24, 18, 1, 24, 120, 83511 }, // ₱
-    { 21, 29, 23, 2, 26, 153, 83631 }, // ₲
-    { 22, 24, 19, -2, 24, 132, 83784 }, // ₳
-    { 20, 26, 17, -1, 25, 130, 83916 }, // ₴
-    { 20, 29, 20, 2, 26, 145, 84046 }, // ₵
-    { 21, 23, 19, 0, 22, 121, 84191 }, // ₶
-    { 24, 28, 22, -1, 25, 168, 84312 }, // ₷
-    { 17, 24, 16, 2, 24, 102, 84480 }, // ₸
-    { 17, 24, 18, 3, 24, 102, 84582 }, // ₹
-    { 19, 25, 18, 0, 24, 119, 84684 }, // ₺
-    { 22, 26, 22, 1, 25, 143, 84803 }, // ₻
-    { 24, 24, 25, -1, 24, 144, 84946 }, // ₼
-    { 21, 24, 19, -1, 24, 126, 85090 }, // ₽
-    { 22, 28, 20, -1, 28, 154, 85216 }, // ₾
-    { 18, 32, 18, 1, 28, 144, 85370 }, // ₿
-    { 10, 4, 10, 0, 11, 10, 85514 }, // −
-    { 31, 32, 33, 1, 26, 248, 85524 }, // �
+    { 17, 26, 18, 1, 25, 111, 2048 }, // 9
+    { 8, 20, 9, 0, 19, 40, 2159 }, // :
+    { 10, 24, 9, -2, 19, 60, 2199 }, // ;
+    { 17, 18, 19, 2, 21, 77, 2259 }, // <
+    { 16, 10, 19, 2, 17, 40, 2336 }, // =
+    { 17, 18, 19, 2, 21, 77, 2376 }, // >
+    { 14, 26, 14, 2, 25, 91, 2453 }, // ?
+    { 27, 28, 28, 1, 24, 189, 2544 }, // @
+    { 20, 24, 19, -2, 24, 120, 2733 }, // A
+    { 19, 24, 20, 1, 24, 114, 2853 }, // B
+    { 20, 26, 20, 2, 25, 130, 2967 }, // C
+    { 21, 24, 22, 1, 24, 126, 3097 }, // D
+    { 18, 24, 17, 1, 24, 108, 3223 }, // E
+    { 18, 24, 16, 1, 24, 108, 3331 }, // F
+    { 21, 26, 23, 2, 25, 137, 3439 }, // G
+    { 22, 24, 23, 1, 24, 132, 3576 }, // H
+    { 14, 24, 11, -1, 24, 84, 3708 }, // I
+    { 16, 31, 9, -6, 24, 124, 3792 }, // J
+    { 21, 24, 19, 1, 24, 126, 3916 }, // K
+    { 13, 24, 16, 1, 24, 78, 4096 }, // L
+    { 28, 24, 28, 1, 24, 168, 4174 }, // M
+    { 23, 24, 24, 1, 24, 138, 4342 }, // N
+    { 21, 26, 24, 2, 25, 137, 4480 }, // O
+    { 18, 24, 19, 1, 24, 108, 4617 }, // P
+    { 21, 31, 24, 2, 25, 163, 4725 }, // Q
+    { 18, 24, 19, 1, 24, 108, 4888 }, // R
+    { 18, 26, 17, 0, 25, 117, 4996 }, // S
+    { 17, 24, 17, 3, 24, 102, 5113 }, // T
+    { 21, 25, 23, 2, 24, 132, 5215 }, // U
+    { 19, 24, 18, 3, 24, 114, 5347 }, // V
+    { 29, 24, 29, 3, 24, 174, 5461 }, // W
+    { 23, 24, 18, -2, 24, 138, 5635 }, // X
+    { 18, 24, 17, 3, 24, 108, 5773 }, // Y
+    { 21, 24, 18, -1, 24, 126, 5881 }, // Z
+    { 14, 30, 10, -1, 24, 105, 6007 }, // [
+    { 7, 24, 12, 3, 24, 42, 6144 }, // <backslash>
+    { 14, 30, 10, -3, 24, 105, 6186 }, // ]
+    { 17, 16, 19, 1, 24, 68, 6291 }, // ^
+    { 15, 3, 13, -4, -3, 12, 6359 }, // _
+    { 7, 6, 9, 4, 26, 11, 6371 }, // `
+    { 18, 20, 19, 1, 19, 90, 6382 }, // a
+    { 18, 27, 19, 0, 26, 122, 6472 }, // b
+    { 15, 20, 15, 1, 19, 75, 6594 }, // c
+    { 19, 27, 19, 1, 26, 129, 6669 }, // d
+    { 15, 20, 17, 1, 19, 75, 6798 }, // e
+    { 19, 34, 11, -4, 26, 162, 6873 }, // f
+    { 19, 27, 19, 0, 19, 129, 7035 }, // g
+    { 18, 26, 19, 0, 26, 117, 7164 }, // h
+    { 9, 25, 9, 0, 25, 57, 7281 }, // i
+    { 14, 33, 9, -5, 25, 116, 7338 }, // j
+    { 18, 26, 17, 0, 26, 117, 7454 }, // k
+    { 10, 26, 9, 0, 26, 65, 7571 }, // l
+    { 28, 19, 29, 0, 19, 133, 7636 }, // m
+    { 18, 19, 19, 0, 19, 86, 7769 }, // n
+    { 17, 20, 19, 1, 19, 85, 7855 }, // o
+    { 19, 27, 19, -1, 19, 129, 7940 }, // p
+    { 18, 27, 19, 1, 19, 122, 8069 }, // q
+    { 15, 19, 13, 0, 19, 72, 8192 }, // r
+    { 14, 20, 14, 0, 19, 70, 8264 }, // s
+    { 12, 23, 11, 1, 22, 69, 8334 }, // t
+    { 18, 19, 19, 1, 18, 86, 8403 }, // u
+    { 17, 18, 16, 1, 18, 77, 8489 }, // v
+    { 25, 18, 24, 1, 18, 113, 8566 }, // w
+    { 19, 18, 16, -2, 18, 86, 8679 }, // x
+    { 22, 26, 16, -4, 18, 143, 8765 }, // y
+    { 16, 18, 15, -1, 18, 72, 8908 }, // z
+    { 14, 30, 12, 0, 24, 105, 8980 }, // {
+    { 4, 35, 18, 8, 26, 35, 9085 }, // |
+    { 14, 30, 12, -2, 24, 105, 9120 }, // }
+    { 17, 5, 19, 2, 14, 22, 9225 }, // ~
+    { 0, 0, 9, 0, 0, 0, 9247 }, //  
+    { 10, 26, 9, -1, 19, 65, 9247 }, // ¡
+    { 15, 26, 18, 3, 25, 98, 9312 }, // ¢
+    { 21, 25, 18, -1, 25, 132, 9410 }, // £
+    { 15, 15, 18, 2, 19, 57, 9542 }, // ¤
+    { 19, 24, 18, 2, 24, 114, 9599 }, // ¥
+    { 4, 35, 18, 8, 26, 35, 9713 }, // ¦
+    { 17, 27, 16, 0, 26, 115, 9748 }, // §
+    { 10, 4, 18, 7, 25, 10, 9863 }, // ¨
+    { 26, 26, 28, 1, 25, 169, 9873 }, // ©
+    { 11, 13, 11, 2, 25, 36, 10042 }, // ª
+    { 15, 15, 16, 1, 16, 57, 10078 }, // «
+    { 16, 9, 19, 2, 13, 36, 10135 }, // ¬
+    { 10, 4, 10, 0, 11, 10, 10171 }, // ­
+    { 26, 26, 28, 1, 25, 169, 10240 }, // ®
+    { 15, 3, 13, 3, 28, 12, 10409 }, // ¯
+    { 12, 12, 14, 1, 25, 36, 10421 }, // °
+    { 17, 20, 19, 2, 20, 85, 10457 }, // ±
+    { 12, 16, 12, 2, 29, 48, 10542 }, // ²
+    { 12, 16, 12, 2, 29, 48, 10590 }, // ³
+    { 8, 6, 9, 3, 26, 12, 10638 }, // ´
+    { 20, 26, 20, -1, 18, 130, 10650 }, // µ
+    { 17, 31, 22, 3, 26, 132, 10780 }, // ¶
+    { 5, 6, 9, 2, 15, 8, 10912 }, // ·
+    { 7, 8, 7, -3, 0, 14, 10920 }, // ¸
+    { 8, 16, 12, 4, 29, 32, 10934 }, // ¹
+    { 11, 13, 11, 2, 25, 36, 10966 }, // º
+    { 15, 15, 16, 0, 16, 57, 11002 }, // »
+    { 22, 26, 24, 2, 25, 143, 11059 }, // ¼
+    { 24, 26, 27, 2, 25, 156, 11202 }, // ½
+    { 25, 26, 26, 1, 25, 163, 11358 }, // ¾
+    { 13, 26, 14, -1, 19, 85, 11521 }, // ¿
+    { 20, 32, 19, -2, 32, 160, 11606 }, // À
+    { 21, 32, 19, -2, 32, 168, 11766 }, // Á
+    { 20, 32, 19, -2, 32, 160, 11934 }, // Â
+    { 22, 31, 19, -2, 31, 171, 12094 }, // Ã
+    { 20, 31, 19, -2, 31, 155, 12288 }, // Ä
+    { 20, 34, 19, -2, 34, 170, 12443 }, // Å
+    { 31, 24, 27, -2, 24, 186, 12613 }, // Æ
+    { 20, 33, 20, 2, 25, 165, 12799 }, // Ç
+    { 18, 32, 17, 1, 32, 144, 12964 }, // È
+    { 18, 32, 17, 1, 32, 144, 13108 }, // É
+    { 18, 32, 17, 1, 32, 144, 13252 }, // Ê
+    { 18, 31, 17, 1, 31, 140, 13396 }, // Ë
+    { 14, 32, 11, -1, 32, 112, 13536 }, // Ì
+    { 16, 32, 11, -1, 32, 128, 13648 }, // Í
+    { 15, 32, 11, -1, 32, 120, 13776 }, // Î
+    { 15, 31, 11, -1, 31, 117, 13896 }, // Ï
+    { 21, 24, 22, 1, 24, 126, 14013 }, // Ð
+    { 23, 31, 24, 1, 31, 179, 14139 }, // Ñ
+    { 21, 33, 24, 2, 32, 174, 14336 }, // Ò
+    { 21, 33, 24, 2, 32, 174, 14510 }, // Ó
+    { 21, 33, 24, 2, 32, 174, 14684 }, // Ô
+    { 21, 32, 24, 2, 31, 168, 14858 }, // Õ
+    { 21, 32, 24, 2, 31, 168, 15026 }, // Ö
+    { 16, 16, 19, 2, 20, 64, 15194 }, // ×
+    { 23, 28, 24, 1, 26, 161, 15258 }, // Ø
+    { 21, 33, 23, 2, 32, 174, 15419 }, // Ù
+    { 21, 33, 23, 2, 32, 174, 15593 }, // Ú
+    { 21, 33, 23, 2, 32, 174, 15767 }, // Û
+    { 21, 32, 23, 2, 31, 168, 15941 }, // Ü
+    { 18, 32, 17, 3, 32, 144, 16109 }, // Ý
+    { 18, 24, 19, 1, 24, 108, 16253 }, // Þ
+    { 24, 34, 19, -5, 26, 204, 16384 }, // ß
+    { 18, 27, 19, 1, 26, 122, 16588 }, // à
+    { 18, 27, 19, 1, 26, 122, 16710 }, // á
+    { 18, 27, 19, 1, 26, 122, 16832 }, // â
+    { 18, 26, 19, 1, 25, 117, 16954 }, // ã
+    { 18, 26, 19, 1, 25, 117, 17071 }, // ä
+    { 18, 29, 19, 1, 28, 131, 17188 }, // å
+    { 26, 20, 27, 1, 19, 130, 17319 }, // æ
+    { 15, 27, 15, 1, 19, 102, 17449 }, // ç
+    { 15, 27, 17, 1, 26, 102, 17551 }, // è
+    { 16, 27, 17, 1, 26, 108, 17653 }, // é
+    { 15, 27, 17, 1, 26, 102, 17761 }, // ê
+    { 15, 26, 17, 1, 25, 98, 17863 }, // ë
+    { 9, 26, 9, 0, 26, 59, 17961 }, // ì
+    { 12, 26, 9, 0, 26, 78, 18020 }, // í
+    { 12, 26, 9, 0, 26, 78, 18098 }, // î
+    { 12, 25, 9, 0, 25, 75, 18176 }, // ï
+    { 18, 27, 19, 1, 26, 122, 18251 }, // ð
+    { 19, 25, 19, 0, 25, 119, 18432 }, // ñ
+    { 17, 27, 19, 1, 26, 115, 18551 }, // ò
+    { 17, 27, 19, 1, 26, 115, 18666 }, // ó
+    { 17, 27, 19, 1, 26, 115, 18781 }, // ô
+    { 17, 26, 19, 1, 25, 111, 18896 }, // õ
+    { 17, 26, 19, 1, 25, 111, 19007 }, // ö
+    { 17, 16, 19, 2, 20, 68, 19118 }, // ÷
+    { 18, 22, 19, 0, 20, 99, 19186 }, // ø
+    { 18, 27, 19, 1, 26, 122, 19285 }, // ù
+    { 18, 27, 19, 1, 26, 122, 19407 }, // ú
+    { 18, 27, 19, 1, 26, 122, 19529 }, // û
+    { 18, 26, 19, 1, 25, 117, 19651 }, // ü
+    { 22, 34, 16, -4, 26, 187, 19768 }, // ý
+    { 19, 34, 19, -1, 26, 162, 19955 }, // þ
+    { 22, 33, 16, -4, 25, 182, 20117 }, // ÿ
+    { 20, 29, 19, -2, 29, 145, 20299 }, // Ā
+    { 18, 24, 19, 1, 23, 108, 20480 }, // ā
+    { 21, 31, 19, -2, 31, 163, 20588 }, // Ă
+    { 18, 26, 19, 1, 25, 117, 20751 }, // ă
+    { 20, 32, 19, -2, 24, 160, 20868 }, // Ą
+    { 18, 27, 19, 1, 19, 122, 21028 }, // ą
+    { 20, 33, 20, 2, 32, 165, 21150 }, // Ć
+    { 15, 27, 15, 1, 26, 102, 21315 }, // ć
+    { 20, 33, 20, 2, 32, 165, 21417 }, // Ĉ
+    { 15, 27, 15, 1, 26, 102, 21582 }, // ĉ
+    { 20, 32, 20, 2, 31, 160, 21684 }, // Ċ
+    { 15, 26, 15, 1, 25, 98, 21844 }, // ċ
+    { 20, 33, 20, 2, 32, 165, 21942 }, // Č
+    { 16, 27, 15, 1, 26, 108, 22107 }, // č
+    { 21, 32, 22, 1, 32, 168, 22215 }, // Ď
+    { 25, 27, 20, 1, 26, 169, 22528 }, // ď
+    { 21, 24, 22, 1, 24, 126, 22697 }, // Đ
+    { 21, 27, 19, 1, 26, 142, 22823 }, // đ
+    { 18, 29, 17, 1, 29, 131, 22965 }, // Ē
+    { 15, 24, 17, 1, 23, 90, 23096 }, // ē
+    { 18, 31, 17, 1, 31, 140, 23186 }, // Ĕ
+    { 16, 26, 17, 1, 25, 104, 23326 }, // ĕ
+    { 18, 31, 17, 1, 31, 140, 23430 }, // Ė
+    { 15, 26, 17, 1, 25, 98, 23570 }, // ė
+    { 18, 32, 17, 1, 24, 144, 23668 }, // Ę
+    { 15, 27, 17, 1, 19, 102, 23812 }, // ę
+    { 18, 32, 17, 1, 32, 144, 23914 }, // Ě
+    { 16, 27, 17, 1, 26, 108, 24058 }, // ě
+    { 21, 33, 23, 2, 32, 174, 24166 }, // Ĝ
+    { 19, 34, 19, 0, 26, 162, 24340 }, // ĝ
+    { 21, 32, 23, 2, 31, 168, 24576 }, // Ğ
+    { 19, 33, 19, 0, 25, 157, 24744 }, // ğ
+    { 21, 32, 23, 2, 31, 168, 24901 }, // Ġ
+    { 19, 33, 19, 0, 25, 157, 25069 }, // ġ
+    { 21, 33, 23, 2, 25, 174, 25226 }, // Ģ
+    { 19, 34, 19, 0, 26, 162, 25400 }, // ģ
+    { 22, 32, 23, 1, 32, 176, 25562 }, // Ĥ
+    { 18, 33, 19, 0, 33, 149, 25738 }, // ĥ
+    { 25, 24, 23, 1, 24, 150, 25887 }, // Ħ
+    { 18, 26, 19, 0, 26, 117, 26037 }, // ħ
+    { 17, 31, 11, -1, 31, 132, 26154 }, // Ĩ
+    { 14, 25, 9, 0, 25, 88, 26286 }, // ĩ
+    { 15, 29, 11, -1, 29, 109, 26374 }, // Ī
+    { 12, 23, 9, 0, 23, 69, 26483 }, // ī
+    { 16, 31, 11, -1, 31, 124, 26624 }, // Ĭ
+    { 13, 25, 9, 0, 25, 82, 26748 }, // ĭ
+    { 14, 32, 11, -1, 24, 112, 26830 }, // Į
+    { 11, 33, 9, -2, 25, 91, 26942 }, // į
+    { 14, 31, 11, -1, 31, 109, 27033 }, // İ
+    { 8, 18, 9, 0, 18, 36, 27142 }, // ı
+    { 22, 31, 20, -1, 24, 171, 27178 }, // Ĳ
+    { 18, 33, 17, 0, 25, 149, 27349 }, // ĳ
+    { 20, 39, 9, -6, 32, 195, 27498 }, // Ĵ
+    { 17, 34, 9, -5, 26, 145, 27693 }, // ĵ
+    { 21, 32, 19, 1, 24, 168, 27838 }, // Ķ
+    { 18, 34, 17, 0, 26, 153, 28006 }, // ķ
+    { 18, 18, 17, 0, 18, 81, 28159 }, // ĸ
+    { 14, 32, 16, 1, 32, 112, 28240 }, // Ĺ
+    { 14, 33, 9, 0, 33, 116, 28352 }, // ĺ
+    { 13, 32, 16, 1, 24, 104, 28468 }, // Ļ
+    { 12, 34, 9, -2, 26, 102, 28672 }, // ļ
+    { 17, 24, 16, 1, 24, 102, 28774 }, // Ľ
+    { 15, 26, 10, 0, 26, 98, 28876 }, // ľ
+    { 14, 24, 16, 1, 24, 84, 28974 }, // Ŀ
+    { 12, 26, 10, 0, 26, 78, 29058 }, // ŀ
+    { 14, 24, 16, 0, 24, 84, 29136 }, // Ł
+    { 10, 26, 9, 0, 26, 65, 29220 }, // ł
+    { 23, 32, 24, 1, 32, 184, 29285 }, // Ń
+    { 18, 26, 19, 0, 26, 117, 29469 }, // ń
+    { 23, 32, 24, 1, 24, 184, 29586 }, // Ņ
+    { 18, 27, 19, 0, 19, 122, 29770 }, // ņ
+    { 23, 32, 24, 1, 32, 184, 29892 }, // Ň
+    { 19, 26, 19, 0, 26, 124, 30076 }, // ň
+    { 20, 24, 22, 1, 24, 120, 30200 }, // ŉ
+    { 23, 31, 24, 1, 24, 179, 30320 }, // Ŋ
+    { 18, 27, 19, 0, 19, 122, 30499 }, // ŋ
+    { 21, 30, 24, 2, 29, 158, 30720 }, // Ō
+    { 17, 24, 19, 1, 23, 102, 30878 }, // ō
+    { 21, 32, 24, 2, 31, 168, 30980 }, // Ŏ
+    { 17, 26, 19, 1, 25, 111, 31148 }, // ŏ
+    { 23, 33, 24, 2, 32, 190, 31259 }, // Ő
+    { 19, 27, 19, 1, 26, 129, 31449 }, // ő
+    { 28, 26, 29, 2, 25, 182, 31578 }, // Œ
+    { 27, 20, 29, 1, 19, 135, 31760 }, // œ
+    { 18, 32, 19, 1, 32, 144, 31895 }, // Ŕ
+    { 16, 26, 13, 0, 26, 104, 32039 }, // ŕ
+    { 18, 32, 19, 1, 24, 144, 32143 }, // Ŗ
+    { 17, 27, 13, -2, 19, 115, 32287 }, // ŗ
+    { 19, 32, 19, 1, 32, 152, 32402 }, // Ř
+    { 17, 26, 13, 0, 26, 111, 32554 }, // ř
+    { 18, 33, 17, 0, 32, 149, 32768 }, // Ś
+    { 15, 27, 14, 0, 26, 102, 32917 }, // ś
+    { 18, 33, 17, 0, 32, 149, 33019 }, // Ŝ
+    { 15, 27, 14, 0, 26, 102, 33168 }, // ŝ
+    { 18, 33, 17, 0, 25, 149, 33270 }, // Ş
+    { 14, 27, 14, 0, 19, 95, 33419 }, // ş
+    { 18, 33, 17, 0, 32, 149, 33514 }, // Š
+    { 16, 27, 14, 0, 26, 108, 33663 }, // š
+    { 18, 32, 17, 2, 24, 144, 33771 }, // Ţ
+    { 12, 30, 11, 1, 22, 90, 33915 }, // ţ
+    { 17, 32, 17, 3, 32, 136, 34005 }, // Ť
+    { 14, 27, 11, 1, 26, 95, 34141 }, // ť
+    { 18, 24, 17, 2, 24, 108, 34236 }, // Ŧ
+    { 13, 23, 11, 0, 22, 75, 34344 }, // ŧ
+    { 21, 32, 23, 2, 31, 168, 34419 }, // Ũ
+    { 18, 26, 19, 1, 25, 117, 34587 }, // ũ
+    { 21, 30, 23, 2, 29, 158, 34816 }, // Ū
+    { 18, 24, 19, 1, 23, 108, 34974 }, // ū
+    { 21, 32, 23, 2, 31, 168, 35082 }, // Ŭ
+    { 18, 26, 19, 1, 25, 117, 35250 }, // ŭ
+    { 21, 35, 23, 2, 34, 184, 35367 }, // Ů
+    { 18, 29, 19, 1, 28, 131, 35551 }, // ů
+    { 22, 33, 23, 2, 32, 182, 35682 }, // Ű
+    { 20, 27, 19, 1, 26, 135, 35864 }, // ű
+    { 21, 32, 23, 2, 24, 168, 35999 }, // Ų
+    { 18, 26, 19, 1, 18, 117, 36167 }, // ų
+    { 29, 32, 29, 3, 32, 232, 36284 }, // Ŵ
+    { 25, 26, 24, 1, 26, 163, 36516 }, // ŵ
+    { 18, 32, 17, 3, 32, 144, 36679 }, // Ŷ
+    { 22, 34, 16, -4, 26, 187, 36864 }, // ŷ
+    { 18, 31, 17, 3, 31, 140, 37051 }, // Ÿ
+    { 21, 32, 18, -1, 32, 168, 37191 }, // Ź
+    { 17, 26, 15, -1, 26, 111, 37359 }, // ź
+    { 21, 31, 18, -1, 31, 163, 37470 }, // Ż
+    { 16, 25, 15, -1, 25, 100, 37633 }, // ż
+    { 21, 32, 18, -1, 32, 168, 37733 }, // Ž
+    { 17, 26, 15, -1, 26, 111, 37901 }, // ž
+    { 20, 34, 9, -5, 26, 170, 38012 }, // ſ
+    { 6, 6, 0, -13, 26, 9, 38182 }, // ̀
+    { 8, 6, 0, -8, 26, 12, 38191 }, // ́
+    { 11, 6, 0, -3, 26, 17, 38203 }, // ̂
+    { 13, 5, 0, -14, 25, 17, 38220 }, // ̃
+    { 11, 3, 0, -3, 23, 9, 38237 }, // ̄
+    { 14, 4, 0, -3, 29, 14, 38246 }, // ̅
+    { 10, 5, 0, -2, 25, 13, 38260 }, // ̆
+    { 4, 5, 0, 1, 25, 5, 38273 }, // ̇
+    { 10, 4, 0, -2, 25, 10, 38278 }, // ̈
+    { 7, 9, 0, -10, 28, 16, 38288 }, // ̉
+    { 8, 8, 0, -1, 28, 16, 38304 }, // ̊
+    { 13, 6, 0, -2, 26, 20, 38320 }, // ̋
+    { 11, 6, 0, -2, 26, 17, 38340 }, // ̌
+    { 6, 10, 0, 0, 26, 15, 38357 }, // ̍
+    { 10, 7, 0, -2, 26, 18, 38372 }, // ̎
+    { 12, 6, 0, -17, 26, 18, 38390 }, // ̏
+    { 11, 9, 0, -2, 29, 25, 38408 }, // ̐
+    { 11, 5, 0, -3, 25, 14, 38433 }, // ̑
+    { 7, 9, 0, -1, 24, 16, 38447 }, // ̒
+    { 7, 9, 0, -1, 24, 16, 38463 }, // ̓
+    { 5, 9, 0, 0, 24, 12, 38479 }, // ̔
+    { 7, 9, 0, -1, 24, 16, 38491 }, // ̕
+    { 7, 6, 0, -7, -1, 11, 38507 }, // ̖
+    { 8, 6, 0, -5, -1, 12, 38518 }, // ̗
+    { 8, 8, 0, -6, 0, 16, 38530 }, // ̘
+    { 8, 8, 0, -7, 0, 16, 38546 }, // ̙
+    { 10, 10, 11, 3, 26, 25, 38562 }, // ̚
+    { 8, 8, 0, -2, 26, 16, 38587 }, // ̛
+    { 5, 8, 0, -2, 0, 10, 38603 }, // ̜
+    { 8, 6, 0, -7, -1, 12, 38613 }, // ̝
+    { 8, 6, 0, -6, -1, 12, 38625 }, // ̞
+    { 9, 8, 0, -7, 0, 18, 38637 }, // ̟
+    { 8, 3, 0, -7, -2, 6, 38655 }, // ̠
+    { 8, 10, 0, -7, 2, 20, 38661 }, // ̡
+    { 7, 10, 0, -4, 2, 18, 38681 }, // ̢
+    { 4, 4, 0, -14, -2, 4, 38699 }, // ̣
+    { 10, 4, 0, -8, -2, 10, 38703 }, // ̤
+    { 8, 8, 0, -7, 0, 16, 38713 }, // ̥
+    { 6, 6, 0, 2, -2, 9, 38729 }, // ̦
+    { 7, 8, 0, -6, 0, 14, 38738 }, // ̧
+    { 6, 8, 0, -5, 0, 12, 38752 }, // ̨
+    { 5, 10, 0, -5, -1, 13, 38764 }, // ̩
+    { 14, 7, 0, -10, -1, 25, 38777 }, // ̪
+    { 14, 4, 0, -9, -2, 14, 38802 }, // ̫
+    { 11, 6, 0, -7, -1, 17, 38816 }, // ̬
+    { 11, 6, 0, -8, -1, 17, 38833 }, // ̭
+    { 10, 5, 0, -7, -1, 13, 38850 }, // ̮
+    { 11, 5, 0, -8, -1, 14, 38863 }, // ̯
+    { 13, 5, 0, -9, -1, 17, 38877 }, // ̰
+    { 10, 3, 0, -8, -2, 8, 38894 }, // ̱
+    { 15, 3, 0, -10, -3, 12, 38912 }, // ̲
+    { 15, 8, 0, -10, 0, 30, 38924 }, // ̳
+    { 14, 5, 0, -7, 12, 18, 38954 }, // ̴
+    { 14, 4, 0, -7, 12, 14, 38972 }, // ̵
+    { 24, 3, 0, -12, 11, 18, 38986 }, // ̶
+    { 10, 8, 0, -5, 14, 20, 39004 }, // ̷
+    { 20, 28, 0, -10, 26, 140, 39024 }, // ̸
+    { 5, 8, 0, -2, 0, 10, 39164 }, // ̹
+    { 14, 7, 0, -10, -1, 25, 39174 }, // ̺
+    { 14, 8, 0, -10, 0, 28, 39199 }, // ̻
+    { 13, 4, 0, -9, -2, 13, 39227 }, // ̼
+    { 8, 7, 0, -1, 26, 14, 39240 }, // ̽
+    { 8, 10, 0, -1, 29, 20, 39254 }, // ̾
+    { 15, 8, 0, -3, 33, 30, 39274 }, // ̿
+    { 7, 6, 0, -2, 26, 11, 39304 }, // ̀
+    { 8, 6, 0, 1, 26, 12, 39315 }, // ́
+    { 13, 5, 0, 5, 25, 17, 39327 }, // ͂
+    { 5, 6, 0, 1, 26, 8, 39344 }, // ̓
+    { 13, 6, 0, -3, 26, 20, 39352 }, // ̈́
+    { 6, 6, 0, -4, -2, 9, 39372 }, // ͅ
+    { 16, 7, 0, -5, 26, 28, 39381 }, // ͆
+    { 16, 8, 0, -10, 0, 32, 39409 }, // ͇
+    { 10, 7, 0, -8, -1, 18, 39441 }, // ͈
+    { 8, 6, 0, -6, -2, 12, 39459 }, // ͉
+    { 14, 8, 0, -4, 26, 28, 39471 }, // ͊
+    { 13, 12, 0, -3, 31, 39, 39499 }, // ͋
+    { 13, 9, 0, -3, 29, 30, 39538 }, // ͌
+    { 13, 7, 0, -9, -1, 23, 39568 }, // ͍
+    { 7, 8, 0, -6, 0, 14, 39591 }, // ͎
+    { 24, 24, 0, -12, 24, 144, 39605 }, // ͏
+    { 6, 8, 0, 0, 27, 12, 39749 }, // ͐
+    { 5, 8, 0, 4, 28, 10, 39761 }, // ͑
+    { 10, 9, 0, -2, 29, 23, 39771 }, // ͒
+    { 8, 7, 0, -6, -1, 14, 39794 }, // ͓
+    { 6, 7, 0, -5, -1, 11, 39808 }, // ͔
+    { 7, 7, 0, -5, -1, 13, 39819 }, // ͕
+    { 13, 7, 0, -8, -1, 23, 39832 }, // ͖
+    { 5, 8, 0, 3, 28, 10, 39855 }, // ͗
+    { 4, 5, 0, 1, 25, 5, 39865 }, // ͘
+    { 9, 7, 0, -7, -1, 16, 39870 }, // ͙
+    { 13, 8, 0, -9, 0, 26, 39886 }, // ͚
+    { 7, 8, 0, 0, 27, 14, 39912 }, // ͛
+    { 24, 7, 0, -14, -1, 42, 39926 }, // ͜
+    { 24, 7, 0, -9, 26, 42, 39968 }, // ͝
+    { 18, 3, 0, -6, 23, 14, 40010 }, // ͞
+    { 17, 3, 0, -11, -2, 13, 40024 }, // ͟
+    { 26, 5, 0, -10, 25, 33, 40037 }, // ͠
+    { 24, 7, 0, -9, 29, 42, 40070 }, // ͡
+    { 25, 7, 0, -16, -1, 44, 40112 }, // ͢
+    { 9, 8, 0, -1, 28, 18, 40156 }, // ͣ
+    { 7, 8, 0, 0, 28, 14, 40174 }, // ͤ
+    { 5, 11, 0, 1, 31, 14, 40188 }, // ͥ
+    { 8, 8, 0, -1, 28, 16, 40202 }, // ͦ
+    { 9, 8, 0, -1, 28, 18, 40218 }, // ͧ
+    { 7, 8, 0, 0, 28, 14, 40236 }, // ͨ
+    { 9, 11, 0, -1, 31, 25, 40250 }, // ͩ
+    { 8, 11, 0, -1, 31, 22, 40275 }, // ͪ
+    { 12, 8, 0, -3, 28, 24, 40297 }, // ͫ
+    { 7, 8, 0, 0, 28, 14, 40321 }, // ͬ
+    { 6, 10, 0, 1, 30, 15, 40335 }, // ͭ
+    { 8, 8, 0, 0, 28, 16, 40350 }, // ͮ
+    { 9, 8, 0, -1, 28, 18, 40366 }, // ͯ
+    { 18, 32, 17, 1, 32, 144, 40384 }, // Ѐ
+    { 18, 31, 17, 1, 31, 140, 40528 }, // Ё
+    { 18, 25, 22, 3, 24, 113, 40668 }, // Ђ
+    { 18, 32, 16, 1, 32, 144, 40781 }, // Ѓ
+    { 20, 26, 19, 1, 25, 130, 40960 }, // Є
+    { 18, 26, 17, 0, 25, 117, 41090 }, // Ѕ
+    { 9, 24, 9, 1, 24, 54, 41207 }, // І
+    { 12, 31, 9, 1, 31, 93, 41261 }, // Ї
+    { 16, 31, 9, -6, 24, 124, 41354 }, // Ј
+    { 32, 25, 31, -2, 24, 200, 41478 }, // Љ
+    { 29, 24, 31, 1, 24, 174, 41678 }, // Њ
+    { 18, 24, 23, 3, 24, 108, 41852 }, // Ћ
+    { 21, 32, 19, 1, 32, 168, 41960 }, // Ќ
+    { 23, 32, 23, 1, 32, 184, 42128 }, // Ѝ
+    { 22, 32, 19, 0, 31, 176, 42312 }, // Ў
+    { 22, 30, 22, 1, 24, 165, 42488 }, // Џ
+    { 20, 24, 19, -2, 24, 120, 42653 }, // А
+    { 18, 24, 18, 1, 24, 108, 42773 }, // Б
+    { 19, 24, 20, 1, 24, 114, 42881 }, // В
+    { 17, 24, 16, 1, 24, 102, 43008 }, // Г
+    { 26, 30, 23, -3, 24, 195, 43110 }, // Д
+    { 18, 24, 17, 1, 24, 108, 43305 }, // Е
+    { 32, 24, 27, -2, 24, 192, 43413 }, // Ж
+    { 19, 26, 17, -1, 25, 124, 43605 }, // З
+    { 23, 24, 23, 1, 24, 138, 43729 }, // И
+    { 23, 31, 23, 1, 31, 179, 43867 }, // Й
+    { 21, 24, 19, 1, 24, 126, 44046 }, // К
+    { 25, 25, 22, -2, 24, 157, 44172 }, // Л
+    { 27, 24, 28, 1, 24, 162, 44329 }, // М
+    { 22, 24, 23, 1, 24, 132, 44491 }, // Н
+    { 21, 26, 23, 2, 25, 137, 44623 }, // О
+    { 22, 24, 22, 1, 24, 132, 44760 }, // П
+    { 18, 24, 18, 1, 24, 108, 44892 }, // Р
+    { 19, 26, 19, 2, 25, 124, 45056 }, // С
+    { 17, 24, 17, 3, 24, 102, 45180 }, // Т
+    { 22, 25, 19, 0, 24, 138, 45282 }, // У
+    { 25, 26, 26, 1, 25, 163, 45420 }, // Ф
+    { 23, 24, 18, -2, 24, 138, 45583 }, // Х
+    { 22, 30, 23, 1, 24, 165, 45721 }, // Ц
+    { 18, 24, 21, 3, 24, 108, 45886 }, // Ч
+    { 31, 24, 32, 1, 24, 186, 45994 }, // Ш
+    { 31, 30, 32, 1, 24, 233, 46180 }, // Щ
+    { 17, 24, 21, 3, 24, 102, 46413 }, // Ъ
+    { 26, 24, 26, 1, 24, 156, 46515 }, // Ы
+    { 16, 24, 18, 1, 24, 96, 46671 }, // Ь
+    { 20, 26, 20, 0, 25, 130, 46767 }, // Э
+    { 30, 26, 31, 1, 25, 195, 46897 }, // Ю
+    { 22, 24, 19, -2, 24, 132, 47104 }, // Я
+    { 18, 20, 19, 1, 19, 90, 47236 }, // а
+    { 18, 27, 18, 1, 26, 122, 47326 }, // б
+    { 16, 20, 17, 1, 19, 80, 47448 }, // в
+    { 15, 20, 15, 0, 19, 75, 47528 }, // г
+    { 17, 27, 19, 1, 26, 115, 47603 }, // д
+    { 15, 20, 16, 1, 19, 75, 47718 }, // е
+    { 31, 20, 29, -1, 19, 155, 47793 }, // ж
+    { 14, 20, 15, 0, 19, 70, 47948 }, // з
+    { 18, 19, 19, 1, 18, 86, 48018 }, // и
+    { 18, 26, 19, 1, 25, 117, 48104 }, // й
+    { 18, 18, 17, 0, 18, 81, 48221 }, // к
+    { 21, 19, 19, -2, 18, 100, 48302 }, // л
+    { 25, 18, 25, 0, 18, 113, 48402 }, // м
+    { 19, 18, 19, 0, 18, 86, 48515 }, // н
+    { 17, 20, 19, 1, 19, 85, 48601 }, // о
+    { 18, 19, 19, 0, 19, 86, 48686 }, // п
+    { 19, 27, 19, -1, 19, 129, 48772 }, // р
+    { 15, 20, 15, 1, 19, 75, 48901 }, // с
+    { 28, 19, 29, 0, 19, 133, 48976 }, // т
+    { 21, 26, 16, -3, 18, 137, 49152 }, // у
+    { 21, 34, 22, 1, 26, 179, 49289 }, // ф
+    { 19, 18, 15, -2, 18, 86, 49468 }, // х
+    { 18, 23, 20, 1, 18, 104, 49554 }, // ц
+    { 16, 18, 19, 2, 18, 72, 49658 }, // ч
+    { 28, 19, 29, 1, 18, 133, 49730 }, // ш
+    { 28, 23, 30, 1, 18, 161, 49863 }, // щ
+    { 18, 19, 20, 1, 18, 86, 50024 }, // ъ
+    { 23, 19, 24, 1, 18, 110, 50110 }, // ы
+    { 15, 19, 17, 1, 18, 72, 50220 }, // ь
+    { 15, 20, 16, 0, 19, 75, 50292 }, // э
+    { 25, 20, 26, 0, 19, 125, 50367 }, // ю
+    { 19, 18, 17, -2, 18, 86, 50492 }, // я
+    { 15, 27, 16, 1, 26, 102, 50578 }, // ѐ
+    { 16, 26, 16, 1, 25, 104, 50680 }, // ё
+    { 18, 34, 19, 0, 26, 153, 50784 }, // ђ
+    { 16, 27, 15, 0, 26, 108, 50937 }, // ѓ
+    { 15, 20, 15, 1, 19, 75, 51045 }, // є
+    { 14, 20, 14, 0, 19, 70, 51120 }, // ѕ
+    { 10, 25, 9, 0, 25, 63, 51200 }, // і
+    { 11, 25, 8, 0, 25, 69, 51263 }, // ї
+    { 14, 33, 8, -5, 25, 116, 51332 }, // ј
+    { 28, 19, 27, -2, 18, 133, 51448 }, // љ
+    { 26, 19, 27, 0, 18, 124, 51581 }, // њ
+    { 18, 26, 19, 0, 26, 117, 51705 }, // ћ
+    { 18, 26, 17, 0, 26, 117, 51822 }, // ќ
+    { 18, 27, 19, 1, 26, 122, 51939 }, // ѝ
+    { 21, 33, 16, -3, 25, 174, 52061 }, // ў
+    { 18, 25, 19, 1, 18, 113, 52235 }, // џ
+    { 30, 25, 31, 3, 24, 188, 52348 }, // Ѡ
+    { 26, 18, 26, 2, 18, 117, 52536 }, // ѡ
+    { 16, 24, 20, 2, 24, 96, 52653 }, // Ѣ
+    { 26, 20, 28, 0, 19, 130, 52749 }, // ѣ
+    { 30, 26, 29, 1, 25, 195, 52879 }, // Ѥ
+    { 24, 20, 23, 0, 19, 120, 53074 }, // ѥ
+    { 21, 24, 20, -2, 24, 126, 53248 }, // Ѧ
+    { 18, 18, 18, -2, 18, 81, 53374 }, // ѧ
+    { 26, 24, 28, 1, 24, 156, 53455 }, // Ѩ
+    { 23, 18, 24, 0, 18, 104, 53611 }, // ѩ
+    { 26, 24, 22, -2, 24, 156, 53715 }, // Ѫ
+    { 22, 18, 20, -2, 18, 99, 53871 }, // ѫ
+    { 31, 24, 31, 1, 24, 186, 53970 }, // Ѭ
+    { 27, 18, 27, 0, 18, 122, 54156 }, // ѭ
+    { 20, 36, 18, -2, 29, 180, 54278 }, // Ѯ
+    { 17, 30, 15, -2, 23, 128, 54458 }, // ѯ
+    { 25, 24, 25, 3, 24, 150, 54586 }, // Ѱ
+    { 22, 34, 24, 1, 26, 187, 54736 }, // ѱ
+    { 21, 26, 24, 2, 25, 137, 54923 }, // Ѳ
+    { 17, 20, 19, 1, 19, 85, 55060 }, // ѳ
+    { 20, 24, 19, 3, 24, 120, 55145 }, // Ѵ
+    { 17, 18, 15, 1, 18, 77, 55296 }, // ѵ
+    { 20, 32, 19, 3, 32, 160, 55373 }, // Ѷ
+    { 17, 26, 15, 1, 26, 111, 55533 }, // ѷ
+    { 40, 33, 40, 2, 25, 330, 55644 }, // Ѹ
+    { 35, 27, 34, 1, 19, 237, 55974 }, // ѹ
+    { 22, 29, 25, 2, 26, 160, 56211 }, // Ѻ
+    { 17, 22, 19, 1, 20, 94, 56371 }, // ѻ
+    { 29, 36, 32, 2, 35, 261, 56465 }, // Ѽ
+    { 25, 31, 27, 1, 30, 194, 56726 }, // ѽ
+    { 30, 31, 31, 3, 30, 233, 56920 }, // Ѿ
+    { 26, 24, 26, 2, 24, 156, 57153 }, // ѿ
+    { 20, 33, 20, 2, 25, 165, 57344 }, // Ҁ
+    { 15, 27, 15, 1, 19, 102, 57509 }, // ҁ
+    { 18, 22, 20, 1, 21, 99, 57611 }, // ҂
+    { 14, 5, 0, -14, 24, 18, 57710 }, // ҃
+    { 14, 5, 0, -14, 25, 18, 57728 }, // ҄
+    { 4, 6, 0, -9, 26, 6, 57746 }, // ҅
+    { 5, 6, 0, -9, 26, 8, 57752 }, // ҆
+    { 14, 5, 0, -3, 30, 18, 57760 }, // ҇
+    { 38, 36, 0, -19, 27, 342, 57778 }, // ҈
+    { 38, 38, 0, -19, 28, 361, 58120 }, // ҉
+    { 23, 38, 24, 1, 31, 219, 58481 }, // Ҋ
+    { 18, 33, 19, 1, 26, 149, 58700 }, // ҋ
+    { 16, 24, 18, 1, 24, 96, 58849 }, // Ҍ
+    { 14, 27, 17, 2, 26, 95, 58945 }, // ҍ
+    { 18, 24, 19, 1, 24, 108, 59040 }, // Ҏ
+    { 19, 27, 19, -1, 19, 129, 59148 }, // ҏ
+    { 19, 29, 16, 1, 29, 138, 59392 }, // Ґ
+    { 16, 24, 13, 0, 24, 96, 59530 }, // ґ
+    { 18, 24, 16, 1, 24, 108, 59626 }, // Ғ
+    { 15, 18, 13, 0, 18, 68, 59734 }, // ғ
+    { 18, 33, 20, 1, 24, 149, 59802 }, // Ҕ
+    { 15, 27, 17, 0, 18, 102, 59951 }, // ҕ
+    { 32, 31, 28, -2, 24, 248, 60053 }, // Җ
+    { 31, 26, 28, -1, 19, 202, 60301 }, // җ
+    { 19, 33, 17, -1, 25, 157, 60503 }, // Ҙ
+    { 14, 27, 15, 0, 19, 95, 60660 }, // ҙ
+    { 21, 31, 20, 1, 24, 163, 60755 }, // Қ
+    { 18, 25, 18, 0, 18, 113, 60918 }, // қ
+    { 21, 24, 19, 1, 24, 126, 61031 }, // Ҝ
+    { 19, 18, 16, 0, 18, 86, 61157 }, // ҝ
+    { 21, 24, 19, 1, 24, 126, 61243 }, // Ҟ
+    { 18, 26, 16, 0, 26, 117, 61440 }, // ҟ
+    { 22, 24, 21, 3, 24, 132, 61557 }, // Ҡ
+    { 20, 18, 19, 1, 18, 90, 61689 }, // ҡ
+    { 22, 31, 23, 1, 24, 171, 61779 }, // Ң
+    { 20, 25, 20, 0, 18, 125, 61950 }, // ң
+    { 28, 24, 25, 1, 24, 168, 62075 }, // Ҥ
+    { 25, 18, 23, 0, 18, 113, 62243 }, // ҥ
+    { 30, 33, 33, 1, 24, 248, 62356 }, // Ҧ
+    { 26, 27, 27, 0, 18, 176, 62604 }, // ҧ
+    { 21, 27, 24, 2, 25, 142, 62780 }, // Ҩ
+    { 18, 20, 20, 1, 19, 90, 62922 }, // ҩ
+    { 20, 33, 20, 2, 25, 165, 63012 }, // Ҫ
+    { 15, 27, 15, 1, 19, 102, 63177 }, // ҫ
+    { 17, 31, 17, 3, 24, 132, 63279 }, // Ҭ
+    { 28, 26, 30, 0, 19, 182, 63488 }, // ҭ
+    { 18, 24, 17, 3, 24, 108, 63670 }, // Ү
+    { 17, 26, 16, 1, 18, 111, 63778 }, // ү
+    { 20, 24, 17, 1, 24, 120, 63889 }, // Ұ
+    { 19, 26, 16, -1, 18, 124, 64009 }, // ұ
+    { 23, 31, 19, -2, 24, 179, 64133 }, // Ҳ
+    { 19, 25, 18, -1, 18, 119, 64312 }, // ҳ
+    { 24, 31, 26, 3, 24, 186, 64431 }, // Ҵ
+    { 20, 25, 22, 1, 18, 125, 64617 }, // ҵ
+    { 19, 31, 22, 3, 24, 148, 64742 }, // Ҷ
+    { 16, 25, 18, 2, 18, 100, 64890 }, // ҷ
+    { 19, 24, 21, 3, 24, 114, 64990 }, // Ҹ
+    { 16, 18, 19, 2, 18, 72, 65104 }, // ҹ
+    { 19, 24, 21, 1, 24, 114, 65176 }, // Һ
+    { 18, 26, 19, 0, 26, 117, 65290 }, // һ
+    { 24, 26, 26, 2, 25, 156, 65536 }, // Ҽ
+    { 19, 20, 20, 1, 19, 95, 65692 }, // ҽ
+    { 24, 32, 26, 2, 25, 192, 65787 }, // Ҿ
+    { 19, 26, 20, 1, 19, 124, 65979 }, // ҿ
+    { 14, 24, 11, -1, 24, 84, 66103 }, // Ӏ
+    { 32, 31, 27, -2, 31, 248, 66187 }, // Ӂ
+    { 31, 26, 29, -1, 25, 202, 66435 }, // ӂ
+    { 21, 33, 21, 1, 24, 174, 66637 }, // Ӄ
+    { 18, 27, 17, 0, 18, 122, 66811 }, // ӄ
+    { 24, 31, 22, -2, 24, 186, 66933 }, // Ӆ
+    { 20, 26, 18, -2, 19, 130, 67119 }, // ӆ
+    { 22, 33, 23, 1, 24, 182, 67249 }, // Ӈ
+    { 20, 27, 20, 0, 18, 135, 67431 }, // ӈ
+    { 22, 31, 23, 1, 24, 171, 67584 }, // Ӊ
+    { 20, 25, 20, 0, 18, 125, 67755 }, // ӊ
+    { 19, 31, 21, 3, 24, 148, 67880 }, // Ӌ
+    { 16, 25, 19, 3, 18, 100, 68028 }, // ӌ
+    { 28, 31, 28, 1, 24, 217, 68128 }, // Ӎ
+    { 23, 25, 23, 0, 18, 144, 68345 }, // ӎ
+    { 14, 24, 11, -1, 24, 84, 68489 }, // ӏ
+    { 21, 31, 19, -2, 31, 163, 68573 }, // Ӑ
+    { 18, 26, 19, 1, 25, 117, 68736 }, // ӑ
+    { 20, 31, 19, -2, 31, 155, 68853 }, // Ӓ
+    { 18, 26, 19, 1, 25, 117, 69008 }, // ӓ
+    { 31, 24, 27, -2, 24, 186, 69125 }, // Ӕ
+    { 26, 20, 27, 1, 19, 130, 69311 }, // ӕ
+    { 18, 31, 17, 1, 31, 140, 69441 }, // Ӗ
+    { 17, 26, 17, 1, 25, 111, 69632 }, // ӗ
+    { 20, 26, 22, 1, 25, 130, 69743 }, // Ә
+    { 15, 20, 16, 0, 19, 75, 69873 }, // ә
+    { 20, 32, 22, 1, 31, 160, 69948 }, // Ӛ
+    { 16, 26, 16, 0, 25, 104, 70108 }, // ӛ
+    { 32, 31, 27, -2, 31, 248, 70212 }, // Ӝ
+    { 31, 26, 29, -1, 25, 202, 70460 }, // ӝ
+    { 19, 32, 17, -1, 31, 152, 70662 }, // Ӟ
+    { 15, 26, 15, 0, 25, 98, 70814 }, // ӟ
+    { 19, 25, 18, 0, 24, 119, 70912 }, // Ӡ
+    { 18, 26, 15, -3, 18, 117, 71031 }, // ӡ
+    { 23, 29, 23, 1, 29, 167, 71148 }, // Ӣ
+    { 18, 24, 19, 1, 23, 108, 71315 }, // ӣ
+    { 23, 31, 23, 1, 31, 179, 71423 }, // Ӥ
+    { 18, 26, 19, 1, 25, 117, 71680 }, // ӥ
+    { 21, 32, 24, 2, 31, 168, 71797 }, // Ӧ
+    { 17, 26, 19, 1, 25, 111, 71965 }, // ӧ
+    { 21, 26, 24, 2, 25, 137, 72076 }, // Ө
+    { 17, 20, 19, 1, 19, 85, 72213 }, // ө
+    { 21, 32, 24, 2, 31, 168, 72298 }, // Ӫ
+    { 17, 26, 19, 1, 25, 111, 72466 }, // ӫ
+    { 20, 32, 20, 0, 31, 160, 72577 }, // Ӭ
+    { 15, 26, 16, 0, 25, 98, 72737 }, // ӭ
+    { 22, 30, 19, 0, 29, 165, 72835 }, // Ӯ
+    { 22, 31, 16, -4, 23, 171, 73000 }, // ӯ
+    { 22, 32, 19, 0, 31, 176, 73171 }, // Ӱ
+    { 22, 33, 16, -4, 25, 182, 73347 }, // ӱ
+    { 22, 33, 19, 0, 32, 182, 73529 }, // Ӳ
+    { 22, 34, 16, -4, 26, 187, 73728 }, // ӳ
+    { 18, 31, 21, 3, 31, 140, 73915 }, // Ӵ
+    { 16, 25, 19, 2, 25, 100, 74055 }, // ӵ
+    { 18, 31, 16, 1, 24, 140, 74155 }, // Ӷ
+    { 15, 25, 13, 0, 18, 94, 74295 }, // ӷ
+    { 26, 31, 26, 1, 31, 202, 74389 }, // Ӹ
+    { 23, 26, 24, 1, 25, 150, 74591 }, // ӹ
+    { 19, 31, 16, 0, 24, 148, 74741 }, // Ӻ
+    { 16, 25, 13, -1, 18, 100, 74889 }, // ӻ
+    { 23, 31, 18, -2, 24, 179, 74989 }, // Ӽ
+    { 19, 25, 16, -2, 18, 119, 75168 }, // ӽ
+    { 23, 24, 18, -2, 24, 138, 75287 }, // Ӿ
+    { 19, 18, 16, -2, 18, 86, 75425 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 75511 }, //  
+    { 0, 0, 33, 0, 0, 0, 75511 }, //  
+    { 0, 0, 17, 0, 0, 0, 75511 }, //  
+    { 0, 0, 33, 0, 0, 0, 75511 }, //  
+    { 0, 0, 11, 0, 0, 0, 75511 }, //  
+    { 0, 0, 8, 0, 0, 0, 75511 }, //  
+    { 0, 0, 6, 0, 0, 0, 75511 }, //  
+    { 0, 0, 18, 0, 0, 0, 75511 }, //  
+    { 0, 0, 9, 0, 0, 0, 75511 }, //  
+    { 0, 0, 6, 0, 0, 0, 75511 }, //  
+    { 0, 0, 3, 0, 0, 0, 75511 }, //  
+    { 0, 0, 0, 0, 0, 0, 75511 }, // ​
+    { 0, 0, 0, 0, 0, 0, 75511 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 75511 }, // ‍
+    { 9, 28, 0, -1, 23, 63, 75511 }, // ‎
+    { 9, 28, 0, -8, 23, 63, 75574 }, // ‏
+    { 10, 4, 10, 0, 11, 10, 75637 }, // ‐
+    { 10, 4, 10, 0, 11, 10, 75647 }, // ‑
+    { 17, 4, 18, 1, 14, 17, 75657 }, // ‒
+    { 15, 4, 16, 0, 11, 15, 75674 }, // –
+    { 31, 4, 32, 0, 11, 31, 75689 }, // —
+    { 31, 4, 32, 0, 11, 31, 75720 }, // ―
+    { 10, 35, 18, 5, 26, 88, 75776 }, // ‖
+    { 16, 8, 13, -4, 0, 32, 75864 }, // ‗
+    { 7, 9, 6, 2, 24, 16, 75896 }, // ‘
+    { 7, 9, 6, 2, 24, 16, 75912 }, // ’
+    { 7, 9, 8, -2, 4, 16, 75928 }, // ‚
+    { 5, 9, 6, 3, 24, 12, 75944 }, // ‛
+    { 13, 9, 12, 2, 24, 30, 75956 }, // “
+    { 13, 9, 12, 2, 24, 30, 75986 }, // ”
+    { 14, 9, 14, -2, 4, 32, 76016 }, // „
+    { 10, 9, 12, 3, 24, 23, 76048 }, // ‟
+    { 13, 26, 16, 3, 26, 85, 76071 }, // †
+    { 16, 26, 16, 1, 26, 104, 76156 }, // ‡
+    { 8, 9, 13, 3, 17, 18, 76260 }, // •
+    { 11, 11, 12, 1, 18, 31, 76278 }, // ‣
+    { 5, 6, 17, 4, 5, 8, 76309 }, // ․
+    { 14, 6, 17, 0, 5, 21, 76317 }, // ‥
+    { 22, 6, 26, 0, 5, 33, 76338 }, // …
+    { 5, 6, 9, 2, 12, 8, 76371 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 76379 }, //  
+    { 0, 0, 20, 0, 0, 0, 76379 }, //  
+    { 9, 26, 0, -1, 21, 59, 76379 }, // ‪
+    { 9, 26, 0, -8, 21, 59, 76438 }, // ‫
+    { 8, 28, 0, -4, 23, 56, 76497 }, // ‬
+    { 8, 28, 0, -4, 23, 56, 76553 }, // ‭
+    { 8, 28, 0, -4, 23, 56, 76609 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 76665 }, //  
+    { 35, 26, 38, 2, 25, 228, 76665 }, // ‰
+    { 45, 26, 48, 2, 25, 293, 76893 }, // ‱
+    { 8, 9, 7, 2, 24, 18, 77186 }, // ′
+    { 14, 9, 13, 2, 24, 32, 77204 }, // ″
+    { 19, 9, 19, 2, 24, 43, 77236 }, // ‴
+    { 5, 9, 9, 4, 24, 12, 77279 }, // ‵
+    { 11, 9, 14, 4, 24, 25, 77291 }, // ‶
+    { 16, 9, 19, 4, 24, 36, 77316 }, // ‷
+    { 13, 11, 13, -3, 3, 36, 77352 }, // ‸
+    { 9, 15, 10, 1, 16, 34, 77388 }, // ‹
+    { 9, 15, 10, 0, 16, 34, 77422 }, // ›
+    { 26, 26, 28, 1, 25, 169, 77456 }, // ※
+    { 17, 25, 16, 0, 24, 107, 77625 }, // ‼
+    { 14, 26, 14, 2, 25, 91, 77732 }, // ‽
+    { 15, 3, 13, 3, 28, 12, 77824 }, // ‾
+    { 18, 7, 18, -2, -1, 32, 77836 }, // ‿
+    { 18, 8, 18, 2, 27, 36, 77868 }, // ⁀
+    { 16, 22, 11, -4, 14, 88, 77904 }, // ⁁
+    { 36, 31, 37, 0, 26, 279, 77992 }, // ⁂
+    { 9, 4, 10, 0, 11, 9, 78271 }, // ⁃
+    { 21, 24, 4, -8, 24, 126, 78280 }, // ⁄
+    { 14, 30, 10, -1, 24, 105, 78406 }, // ⁅
+    { 14, 30, 10, -3, 24, 105, 78511 }, // ⁆
+    { 28, 26, 29, 2, 25, 182, 78616 }, // ⁇
+    { 22, 26, 23, 2, 25, 143, 78798 }, // ⁈
+    { 24, 26, 23, 0, 25, 156, 78941 }, // ⁉
+    { 17, 18, 17, 2, 18, 77, 79097 }, // ⁊
+    { 17, 31, 20, 3, 26, 132, 79174 }, // ⁋
+    { 18, 17, 21, 1, 18, 77, 79306 }, // ⁌
+    { 18, 17, 21, 2, 18, 77, 79383 }, // ⁍
+    { 17, 16, 18, -1, 9, 68, 79460 }, // ⁎
+    { 7, 24, 9, 1, 19, 42, 79528 }, // ⁏
+    { 22, 35, 18, -2, 27, 193, 79570 }, // ⁐
+    { 19, 33, 18, 0, 26, 157, 79872 }, // ⁑
+    { 13, 26, 12, 0, 25, 85, 80029 }, // ⁒
+    { 29, 6, 33, 3, 13, 44, 80114 }, // ⁓
+    { 18, 8, 18, -3, 0, 36, 80158 }, // ⁔
+    { 18, 18, 19, 0, 17, 81, 80194 }, // ⁕
+    { 15, 26, 17, 1, 25, 98, 80275 }, // ⁖
+    { 25, 9, 24, 2, 24, 57, 80373 }, // ⁗
+    { 25, 26, 27, 1, 25, 163, 80430 }, // ⁘
+    { 25, 26, 28, 1, 25, 163, 80593 }, // ⁙
+    { 5, 26, 7, 1, 25, 33, 80756 }, // ⁚
+    { 20, 26, 22, 1, 25, 130, 80789 }, // ⁛
+    { 25, 26, 27, 1, 25, 163, 80919 }, // ⁜
+    { 5, 25, 9, 2, 24, 32, 81082 }, // ⁝
+    { 5, 26, 9, 3, 25, 33, 81114 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 81147 }, //  
+    { 0, 0, 20, 0, 0, 0, 81147 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 81147 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 81147 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 81147 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 81147 }, // ⁤
+    { 0, 0, 20, 0, 0, 0, 81147 }, // ⁦
+    { 0, 0, 20, 0, 0, 0, 81147 }, // ⁧
+    { 0, 0, 20, 0, 0, 0, 81147 }, // ⁨
+    { 0, 0, 20, 0, 0, 0, 81147 }, // ⁩
+    { 8, 28, 0, -4, 23, 56, 81147 }, // ⁪
+    { 8, 28, 0, -4, 23, 56, 81203 }, // ⁫
+    { 8, 28, 0, -4, 23, 56, 81259 }, // ⁬
+    { 8, 29, 0, -4, 24, 58, 81315 }, // ⁭
+    { 8, 28, 0, -4, 23, 56, 81373 }, // ⁮
+    { 8, 28, 0, -4, 23, 56, 81429 }, // ⁯
+    { 11, 16, 12, 3, 29, 44, 81485 }, // ⁰
+    { 6, 16, 7, 2, 25, 24, 81529 }, // ⁱ
+    { 12, 16, 12, 2, 29, 48, 81553 }, // ⁴
+    { 11, 16, 12, 3, 29, 44, 81601 }, // ⁵
+    { 11, 16, 12, 3, 29, 44, 81645 }, // ⁶
+    { 12, 16, 12, 3, 29, 48, 81689 }, // ⁷
+    { 12, 16, 12, 2, 29, 48, 81737 }, // ⁸
+    { 11, 16, 12, 3, 29, 44, 81785 }, // ⁹
+    { 10, 10, 11, 3, 25, 25, 81829 }, // ⁺
+    { 10, 3, 11, 3, 22, 8, 81854 }, // ⁻
+    { 10, 6, 11, 3, 23, 15, 81862 }, // ⁼
+    { 9, 18, 6, 3, 30, 41, 81877 }, // ⁽
+    { 8, 18, 6, 0, 30, 36, 81920 }, // ⁾
+    { 12, 12, 13, 2, 21, 36, 81956 }, // ⁿ
+    { 11, 16, 12, -1, 11, 44, 81992 }, // ₀
+    { 7, 16, 12, 1, 11, 28, 82036 }, // ₁
+    { 12, 16, 12, -2, 11, 48, 82064 }, // ₂
+    { 12, 16, 12, -2, 11, 48, 82112 }, // ₃
+    { 12, 16, 12, -2, 11, 48, 82160 }, // ₄
+    { 11, 16, 12, -1, 11, 44, 82208 }, // ₅
+    { 11, 16, 12, -1, 11, 44, 82252 }, // ₆
+    { 12, 16, 12, -1, 11, 48, 82296 }, // ₇
+    { 11, 16, 12, -1, 11, 44, 82344 }, // ₈
+    { 11, 16, 12, -1, 11, 44, 82388 }, // ₉
+    { 10, 10, 11, -1, 7, 25, 82432 }, // ₊
+    { 10, 3, 11, -1, 4, 8, 82457 }, // ₋
+    { 10, 6, 11, -1, 5, 15, 82465 }, // ₌
+    { 8, 18, 6, 0, 12, 36, 82480 }, // ₍
+    { 8, 18, 6, -4, 12, 36, 82516 }, // ₎
+    { 12, 12, 12, -1, 8, 36, 82552 }, // ₐ
+    { 10, 12, 11, -1, 8, 30, 82588 }, // ₑ
+    { 11, 12, 12, -1, 8, 33, 82618 }, // ₒ
+    { 13, 12, 10, -3, 8, 39, 82651 }, // ₓ
+    { 10, 12, 11, -2, 8, 30, 82690 }, // ₔ
+    { 11, 16, 15, 0, 12, 44, 82720 }, // ₕ
+    { 11, 16, 12, 0, 12, 44, 82764 }, // ₖ
+    { 6, 16, 8, 0, 12, 24, 82808 }, // ₗ
+    { 18, 12, 21, 0, 8, 54, 82832 }, // ₘ
+    { 12, 12, 13, -2, 8, 36, 82886 }, // ₙ
+    { 13, 16, 13, -3, 8, 52, 82922 }, // ₚ
+    { 9, 12, 10, -1, 8, 27, 82974 }, // ₛ
+    { 8, 14, 7, -1, 10, 28, 83001 }, // ₜ
+    { 17, 25, 18, 2, 25, 107, 83029 }, // ₠
+    { 19, 28, 18, 1, 26, 133, 83136 }, // ₡
+    { 18, 26, 18, 2, 25, 117, 83269 }, // ₢
+    { 20, 24, 18, 0, 24, 120, 83386 }, // ₣
+    { 21, 25, 18, -1, 25, 132, 83506 }, // ₤
+    { 28, 27, 29, 0, 23, 189, 83638 }, // ₥
+    { 20, 24, 18, 0, 24, 120, 83827 }, // ₦
+    { 24, 25, 25, 0, 24, 150, 83968 }, // ₧
+    { 27, 25, 27, 0, 24, 169, 84118 }, // ₨
+    { 24, 24, 21, 0, 24, 144, 84287 }, // ₩
+    { 28, 24, 27, 0, 24, 168, 84431 }, // ₪
+    { 22, 32, 19, 0, 26, 176, 84599 }, // ₫
+    { 20, 26, 18, 1, 25, 130, 84775 }, // €
+    { 21, 24, 19, 1, 24, 126, 84905 }, // ₭
+    { 19, 24, 17, 1, 24, 114, 85031 }, // ₮
+    { 32, 33, 32, 0, 25, 264, 85145 }, // ₯
+    { 21, 33, 18, -2, 25, 174, 85409 }, // ₰
+    { 20, 24, 18, 1, 24, 120, 85583 }, // ₱
+    { 21, 29, 23, 2, 26, 153, 85703 }, // ₲
+    { 22, 24, 19, -2, 24, 132, 85856 }, // ₳
+    { 20, 26, 17, -1, 25, 130, 86016 }, // ₴
+    { 20, 29, 20, 2, 26, 145, 86146 }, // ₵
+    { 21, 23, 19, 0, 22, 121, 86291 }, // ₶
+    { 24, 28, 22, -1, 25, 168, 86412 }, // ₷
+    { 17, 24, 16, 2, 24, 102, 86580 }, // ₸
+    { 17, 24, 18, 3, 24, 102, 86682 }, // ₹
+    { 19, 25, 18, 0, 24, 119, 86784 }, // ₺
+    { 22, 26, 22, 1, 25, 143, 86903 }, // ₻
+    { 24, 24, 25, -1, 24, 144, 87046 }, // ₼
+    { 21, 24, 19, -1, 24, 126, 87190 }, // ₽
+    { 22, 28, 20, -1, 28, 154, 87316 }, // ₾
+    { 18, 32, 18, 1, 28, 144, 87470 }, // ₿
+    { 10, 4, 10, 0, 11, 10, 87614 }, // −
+    { 31, 32, 33, 1, 26, 248, 87624 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_italicIntervals[] = {
@@ -6278,4 +3737,9 @@ static const EpdFontData notosans_16_italic = {
     36,
     -10,
     true,
+    notosans_16_italicBlockOffsets,
+    notosans_16_italicDirectGlyphs,
+    notosans_16_italicGlyphPages,
+    256,
+    notosans_16_italicPageGlyphs,
 };
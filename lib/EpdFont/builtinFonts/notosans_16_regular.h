@@ -2,5025 +2,2460 @@
  * generated by fontconvert.py
  * name: notosans_16_regular
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py notosans_16_regular 16 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_16_regular 16 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_regularBitmaps[80180] = {
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xF8, 0x2E,
-    0x0B, 0x82, 0xE0, 0xB8, 0x2D, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xDB, 0xF9, 0xFC, 0x04, 0x00,
-    0xBC, 0x0B, 0xDB, 0xC0, 0xBD, 0xBC, 0x0B, 0xDB, 0xC0, 0x7C, 0xBC, 0x07, 0xC7, 0xC0, 0x7C, 0x7C,
-    0x03, 0xC7, 0xC0, 0x3C, 0x38, 0x03, 0x80, 0x00, 0x00, 0xB4, 0x01, 0xE0, 0x00, 0x00, 0x3D, 0x00,
-    0xF8, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0x07,
-    0xC0, 0x00, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x2A, 0xAF, 0xEA, 0xBF,
-    0xA9, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x56, 0xF5, 0x5B, 0xD5, 0x50, 0x00, 0xB8, 0x02, 0xF0,
-    0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x00,
-    0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00,
-    0x00, 0xBC, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00,
-    0x03, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x1B, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0x9B, 0x96,
-    0xF0, 0xBD, 0x0B, 0x80, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0xFD, 0x0B, 0x80,
-    0x00, 0x7F, 0x8B, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x0B, 0x87, 0xF8, 0x00, 0x0B, 0x80, 0xFC, 0x00, 0x0B, 0x80,
-    0xBC, 0x00, 0x0B, 0x80, 0xFC, 0x40, 0x0B, 0x81, 0xFC, 0xFE, 0x5B, 0xAF, 0xF4, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0xF4, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3E,
-    0x01, 0xF0, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0xF4, 0x03,
-    0xF0, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x07,
-    0xC0, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0xF4, 0x3E, 0x06, 0x90, 0x03, 0xD0, 0x1F, 0x0B,
-    0xC3, 0xFF, 0xC0, 0x2E, 0x02, 0xF0, 0xF4, 0xBE, 0xBF, 0x01, 0xF9, 0xBD, 0x2F, 0x0F, 0x40, 0xF4,
-    0x0B, 0xFF, 0x83, 0xD1, 0xF0, 0x0F, 0x80, 0x1B, 0x90, 0xFC, 0x2F, 0x00, 0xBC, 0x00, 0x00, 0x1F,
-    0x02, 0xE0, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x03, 0xE0, 0x07,
-    0xC0, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x3D,
-    0x00, 0x1F, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x01, 0xFE, 0x5B, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x03, 0xE0, 0x0B, 0xF4, 0x7F, 0x80, 0x07, 0xD0, 0x1F, 0xC0, 0x1F, 0xE0, 0x0F, 0xC0, 0x3F, 0x40,
-    0x07, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFE, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0xFE, 0x00, 0x0F, 0xF9, 0x57, 0xFF, 0x7F, 0x80, 0x07, 0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x00, 0xBF,
-    0xFF, 0x80, 0x03, 0xFC, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0x7C,
-    0x7C, 0x7C, 0x38, 0x00, 0x3E, 0x00, 0xBC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xD0, 0x0F, 0xC0, 0x1F,
-    0x80, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBD,
-    0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x2F,
-    0x80, 0x0F, 0xC0, 0x0F, 0xD0, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x04, 0xBC,
-    0x00, 0x3F, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x02, 0xF4, 0x01, 0xF8, 0x00,
-    0xFC, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00,
-    0x7E, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x07,
-    0xF0, 0x0B, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x7D, 0x00, 0x10, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x24,
-    0x03, 0xC0, 0x05, 0x7F, 0x93, 0xC6, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x1A, 0xBF, 0xFE, 0xA5, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x03,
-    0xF4, 0x0F, 0xD0, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x45, 0x55, 0xFD, 0x55, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x1F, 0xC2, 0xF4, 0x3F, 0x03, 0xE0, 0x3D, 0x07, 0xC0,
-    0x10, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xDB, 0xFF, 0xF5, 0x55, 0x54, 0x00, 0x0F, 0xCB, 0xF6, 0xFE,
-    0x7F, 0x01, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0,
-    0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0F, 0xF5,
-    0x7F, 0xC0, 0x0F, 0xE0, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0xFC,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0B, 0xC7, 0xE0, 0x00, 0x02, 0xF5,
-    0xF8, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x02,
-    0xF5, 0xF8, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0xBD, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x3F,
-    0x91, 0xBF, 0x40, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x01, 0xFF, 0x00, 0xBF, 0xF0, 0x3F, 0xFF, 0x0F, 0xE3, 0xF3, 0xF8, 0x3F, 0x0D,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xE5, 0xBF, 0xD0, 0x1F, 0x40, 0x02,
-    0xFC, 0x01, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x95, 0xBF, 0xD0, 0x2E, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xAA, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x14, 0x00, 0x00, 0x7F, 0x4B, 0xE4, 0x01, 0xBF, 0xC2, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE,
-    0x40, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0xFC, 0x00, 0x00, 0x03,
-    0xF3, 0xF0, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0xFC,
-    0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xAF, 0xEA,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x6A, 0x90, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x04, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x40, 0x00, 0x07, 0xF0, 0xF9, 0x41, 0x7F, 0xD0,
-    0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0x95, 0x50, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x6F, 0xE4, 0x00, 0xFC, 0xBF, 0xFF, 0xC0, 0x3F,
-    0xBE, 0x5B, 0xFC, 0x0F, 0xF8, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xBD,
-    0x3F, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x00,
-    0xBD, 0x0F, 0xC0, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x3F, 0xD0, 0x7F, 0xC0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x2F, 0xE5,
-    0x6F, 0xE0, 0x0F, 0xC0, 0x00, 0xFD, 0x07, 0xD0, 0x00, 0x1F, 0x82, 0xF4, 0x00, 0x07, 0xE0, 0xBD,
-    0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xBD, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0xD0, 0xBF, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0x81, 0xFF,
-    0x40, 0x7F, 0x00, 0x07, 0xF4, 0x3F, 0x00, 0x00, 0x7F, 0x0F, 0x80, 0x00, 0x0B, 0xC7, 0xE0, 0x00,
-    0x02, 0xF5, 0xF8, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x1F, 0xC1, 0xFE,
-    0x00, 0x6F, 0xD0, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x2F, 0xE5, 0xBF,
-    0xC0, 0x1F, 0xC0, 0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0xF8, 0x00,
-    0x00, 0xFC, 0x7E, 0x00, 0x00, 0x2F, 0x1F, 0x80, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x03, 0xF4, 0xFC,
-    0x00, 0x01, 0xFD, 0x2F, 0x80, 0x01, 0xFF, 0x43, 0xFD, 0x06, 0xFF, 0xC0, 0x3F, 0xFF, 0xF2, 0xF0,
-    0x02, 0xFF, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x40, 0x1B,
-    0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x04,
-    0x0F, 0xCB, 0xF6, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0xBF, 0x6F, 0xE7, 0xF0, 0x10, 0x01, 0x01, 0xFC, 0x2F, 0xD2, 0xFD, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x1F, 0xC2, 0xF8, 0x3F, 0x03, 0xF0, 0x7D, 0x0B, 0xC0, 0xF8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x03, 0xFA, 0x5B, 0xF8, 0x24,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0xAF,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x6F, 0xF8,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x05, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x02,
-    0xFF, 0xFD, 0x00, 0xF4, 0x0F, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0xF8, 0x1F, 0x00, 0x3F, 0x40, 0x3E,
-    0x00, 0xBC, 0x2F, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x7C, 0x3E, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x7C,
-    0x3D, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x7C, 0x3D, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x7C, 0x3D, 0x01,
-    0xF0, 0x00, 0x3D, 0x00, 0xBC, 0x3D, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0xF8, 0x3D, 0x00, 0xF8, 0x00,
-    0xFD, 0x00, 0xF0, 0x3E, 0x00, 0xBD, 0x02, 0xFF, 0x03, 0xE0, 0x2F, 0x00, 0x3F, 0xEF, 0xCF, 0xEF,
-    0xC0, 0x1F, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x00, 0x0F, 0x80, 0x00, 0x50, 0x00, 0x50, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x2F, 0xF9, 0x45, 0xAF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00,
-    0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xFF, 0xE9,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x00, 0x0B, 0xF8, 0xFC, 0x00,
-    0x00, 0xBF, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x7F, 0x0F, 0xFA, 0xAB, 0xFE, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0x00, 0x00, 0x7F, 0x8F, 0xC0, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00,
-    0xBE, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0xFE, 0xFC, 0x00, 0x00, 0xFF, 0x3F, 0xAA, 0xAB, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFA, 0xAB, 0xF4, 0x03, 0xFD, 0x00, 0x01, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x55, 0xBC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0xBF,
-    0xFF, 0xE9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFC, 0x00,
-    0x02, 0xFF, 0x40, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xFC,
-    0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0xFE, 0xAA, 0xBF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xEA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFA, 0xAB, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x24, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAA, 0xA9,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBE,
-    0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x2F, 0xC0,
-    0x00, 0x00, 0x3F, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFF, 0xE5,
-    0x56, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0xBC, 0x00, 0x00, 0x01, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F,
-    0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00,
-    0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B,
-    0xDF, 0xFA, 0xAA, 0xAA, 0xBF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0,
-    0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00,
-    0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD,
-    0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00,
-    0x00, 0x00, 0xBD, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x7F, 0x90, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFD, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x85, 0x5B, 0xF0, 0xBF,
-    0xFE, 0x0B, 0xFF, 0x40, 0x05, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xF0,
-    0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x0F,
-    0xC2, 0xFC, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xF8, 0xBF, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0xFC,
-    0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x7F,
-    0x40, 0xFC, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x8F, 0xC0,
-    0x00, 0x01, 0xFD, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0xF4, 0x00, 0x00, 0x0F, 0xBF, 0xFC, 0xF8, 0x00, 0x00, 0x1F, 0x3F, 0xFC, 0xFC, 0x00, 0x00, 0x3F,
-    0x3F, 0xFC, 0x7D, 0x00, 0x00, 0x3D, 0x3F, 0xFC, 0x3F, 0x00, 0x00, 0xBC, 0x3F, 0xFC, 0x2F, 0x00,
-    0x00, 0xF8, 0x3F, 0xFC, 0x1F, 0x80, 0x01, 0xF4, 0x3F, 0xFC, 0x0F, 0xC0, 0x02, 0xF0, 0x3F, 0xFC,
-    0x0B, 0xD0, 0x03, 0xE0, 0x3F, 0xFC, 0x03, 0xE0, 0x0B, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
-    0x3F, 0xFC, 0x01, 0xF4, 0x1F, 0x40, 0x3F, 0xFC, 0x00, 0xFC, 0x2F, 0x00, 0x3F, 0xFC, 0x00, 0xBC,
-    0x3E, 0x00, 0x3F, 0xFC, 0x00, 0x7E, 0x7D, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x80, 0x00, 0x00,
-    0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00, 0x00, 0xBC, 0xFF, 0xF4, 0x00, 0x00, 0xBC,
-    0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00, 0xBC, 0xFC, 0x3F, 0x40, 0x00, 0xBC, 0xFC,
-    0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xE0, 0x00, 0xBC, 0xFC, 0x03, 0xF4, 0x00, 0xBC, 0xFC, 0x01,
-    0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE, 0x00, 0xBC, 0xFC, 0x00, 0x3F, 0x40, 0xBC, 0xFC, 0x00, 0x2F,
-    0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0, 0xBC, 0xFC, 0x00, 0x03, 0xF0, 0xBC, 0xFC, 0x00, 0x02, 0xFC,
-    0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0xFC, 0x00, 0x00, 0x2F, 0xFC,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0,
-    0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00,
-    0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xFF,
-    0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x0B, 0xF8, 0xFC, 0x00,
-    0x02, 0xFC, 0xFC, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0xFD, 0xFC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x02, 0xFC, 0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xAA, 0x90, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB,
-    0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xD0, 0x00, 0x00,
-    0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0xBF, 0xFF, 0xA4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0xBF, 0x80, 0xFC, 0x00, 0x01, 0xFC, 0x0F,
-    0xC0, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00,
-    0xFD, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xE5, 0x56, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x07, 0xF0,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x0F, 0xC0,
-    0x00, 0x3F, 0x40, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x3F,
-    0x4F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFE, 0xAB, 0xF8, 0x1F, 0xC0, 0x00, 0x14, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95, 0x5F,
-    0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x3F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0xBE,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x82, 0xF8, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x00, 0x07, 0xD7, 0xD0, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0x7E, 0xF0, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x7E, 0x2F, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x02, 0xF0,
-    0x7D, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x0F, 0xC0, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x3E, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0xBD, 0x01, 0xF4, 0x0B, 0xD0, 0x1F, 0x80, 0x01, 0xF8, 0x0F, 0xC0, 0x0F,
-    0x80, 0xBD, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0xBC,
-    0x0F, 0xC0, 0x00, 0x2F, 0x4B, 0xC0, 0x01, 0xF8, 0x7D, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xF2,
-    0xF0, 0x00, 0x00, 0xFC, 0xF8, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x03, 0xF7, 0xD0, 0x00, 0x1F, 0x7E,
-    0x00, 0x00, 0x07, 0xEF, 0x00, 0x00, 0x3E, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x2F, 0xC0, 0x00,
-    0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x02, 0xF8, 0x00, 0x3F,
-    0x00, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00,
-    0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xCF, 0xD0, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0xBD, 0x00,
-    0xFD, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x00, 0x01, 0xFC,
-    0xBD, 0x00, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBE, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00,
-    0x01, 0xF8, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0xAA, 0xAB,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x1F, 0xFF, 0xC7, 0xFA, 0xA1, 0xF8,
-    0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0,
-    0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80,
-    0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00,
-    0x1F, 0x80, 0x07, 0xE0, 0x01, 0xFF, 0xFC, 0x7F, 0xFF, 0x05, 0x55, 0x40, 0x7D, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0x0F, 0xFF, 0xD2, 0xAB,
-    0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B,
-    0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F,
-    0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD,
-    0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0xFF, 0xFD, 0x3F, 0xFF, 0x45, 0x55, 0x40, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0x00,
-    0x3E, 0x3D, 0x00, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x03, 0xD0, 0x2F, 0x00,
-    0x02, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x02,
-    0xF0, 0x2F, 0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00,
-    0x3F, 0x40, 0x1F, 0xC0, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xF9, 0x46, 0xFD, 0x01, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xAB, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xA5, 0x5F, 0xCF, 0xE0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x03, 0xF7, 0xE0,
-    0x00, 0x1F, 0xDF, 0xC0, 0x00, 0xFF, 0x3F, 0x80, 0x2F, 0xFC, 0x7F, 0xFF, 0xF5, 0xF0, 0x7F, 0xFE,
-    0x07, 0xC0, 0x05, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0xFF, 0x40, 0x0F, 0x9F, 0xFF, 0xFC, 0x03,
-    0xFF, 0x95, 0xBF, 0xC0, 0xFF, 0x40, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F,
-    0xD3, 0xF0, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00,
-    0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x3F, 0x4F, 0xE0,
-    0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x0F, 0xE0, 0xFF, 0xE0, 0x1F, 0xF0, 0x3D, 0xBF, 0xFF, 0xF0, 0x0F,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x01,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xE5, 0xAD, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x07, 0xFD, 0x05, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x2F, 0xFD, 0x0F, 0x80, 0xBF, 0xFF, 0xF3, 0xE0, 0x7F, 0x95, 0x7F, 0xF8, 0x3F, 0x80, 0x02,
-    0xFE, 0x1F, 0xC0, 0x00, 0x3F, 0x8F, 0xD0, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x0F, 0xE0, 0xFD, 0x00, 0x0B, 0xF8,
-    0x2F, 0xE0, 0x1B, 0xFE, 0x02, 0xFF, 0xFF, 0xCF, 0x80, 0x1F, 0xFF, 0x83, 0xE0, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0xE4,
-    0x6F, 0xE0, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x03, 0xF0, 0xFC,
-    0x00, 0x00, 0xFC, 0x3F, 0xAA, 0xAA, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0xAA, 0xAA, 0xA0,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x41, 0x6D, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0x55, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF4,
-    0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00,
-    0x1B, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x01, 0x6F, 0x95, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x42, 0xE0, 0x1F, 0xFF, 0xFC, 0xF8, 0x1F, 0xF5, 0x6F, 0xFE, 0x0F, 0xE0, 0x00, 0xFF,
-    0x87, 0xF0, 0x00, 0x0F, 0xE2, 0xF4, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x1F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x3F, 0x00,
-    0x00, 0x1F, 0x8F, 0xD0, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x01, 0xFE, 0x0B,
-    0xF8, 0x06, 0xFF, 0x80, 0xBF, 0xFF, 0xF7, 0xE0, 0x07, 0xFF, 0xE0, 0xF8, 0x00, 0x05, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x14, 0x00, 0x03,
-    0xFC, 0x0F, 0xE9, 0x5B, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0B,
-    0xFF, 0x80, 0x3E, 0x7F, 0xFF, 0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFD, 0x3F, 0x80,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x18, 0x1F, 0xC7, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F,
-    0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x00, 0x00, 0x18, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x8A, 0x6F, 0xC3, 0xFF, 0xE0, 0xBF, 0xD0,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x02, 0xF8, 0x3E, 0x00, 0x0B, 0xE0, 0x3E, 0x00, 0x2F, 0x80, 0x3E, 0x00, 0xBF,
-    0x00, 0x3E, 0x02, 0xFC, 0x00, 0x3E, 0x0B, 0xF0, 0x00, 0x3E, 0x1F, 0xC0, 0x00, 0x3E, 0x7F, 0x00,
-    0x00, 0x3E, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x3F, 0x03, 0xF8,
-    0x00, 0x3E, 0x00, 0xFD, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x2F, 0xC0, 0x3E, 0x00, 0x0F,
-    0xE0, 0x3E, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x01, 0xFC, 0x15, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
-    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
-    0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2F, 0xFD, 0x00, 0xBF, 0xF8,
-    0x03, 0xD7, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x0F, 0xFE, 0x56, 0xFE, 0xF9, 0x5B, 0xF8, 0x3F, 0xC0,
-    0x02, 0xFF, 0x40, 0x03, 0xF0, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x4F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xD3, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0x80, 0x3D, 0x7F, 0xFF, 0xF4,
-    0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5,
-    0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00,
-    0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F,
-    0xC0, 0x00, 0x2F, 0x80, 0xFE, 0x00, 0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x42,
-    0xFF, 0xE0, 0x03, 0xD7, 0xFF, 0xFF, 0x00, 0xFF, 0xE5, 0x6F, 0xF0, 0x3F, 0xD0, 0x00, 0xFE, 0x0F,
-    0xE0, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x1F,
-    0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x2F, 0x4F, 0xC0, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x03, 0xF8, 0x3F, 0xF8,
-    0x07, 0xFC, 0x0F, 0xAF, 0xFF, 0xFC, 0x03, 0xE1, 0xFF, 0xF8, 0x00, 0xFC, 0x01, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x42, 0xE0, 0x1F, 0xFF, 0xFC, 0xF8, 0x1F, 0xE5, 0x5F, 0xFE, 0x0F, 0xE0,
-    0x00, 0xBF, 0x87, 0xF0, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x7E, 0x3F,
-    0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x7E,
-    0x3F, 0x00, 0x00, 0x1F, 0x8F, 0xD0, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x02,
-    0xFE, 0x0B, 0xF8, 0x06, 0xFF, 0x80, 0xBF, 0xFF, 0xF7, 0xE0, 0x07, 0xFF, 0xE1, 0xF8, 0x00, 0x05,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFC, 0x3D, 0x3F, 0xFC, 0x3D, 0xBE, 0x98, 0x3F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xC3, 0xFD, 0x05, 0xF4, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0xBD, 0x7D, 0x00, 0x6F, 0xC7, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFC, 0x17, 0xF5, 0x54, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFD, 0x00, 0x01, 0x40, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF,
-    0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x01,
-    0xF8, 0x1F, 0x80, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02,
-    0xF0, 0x7E, 0x00, 0x00, 0x7E, 0x2F, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x02, 0xF7, 0xD0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0x02,
-    0xFC, 0x00, 0x07, 0xE7, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBD, 0x3F, 0x00, 0x03, 0xFD, 0x00, 0x0F,
-    0xC2, 0xF4, 0x00, 0xBF, 0xF0, 0x00, 0xFC, 0x1F, 0x80, 0x0F, 0xAF, 0x00, 0x1F, 0x80, 0xFC, 0x00,
-    0xF5, 0xF4, 0x02, 0xF4, 0x0F, 0xC0, 0x1F, 0x0F, 0x80, 0x3F, 0x00, 0xBD, 0x03, 0xF0, 0xFC, 0x03,
-    0xF0, 0x07, 0xE0, 0x3E, 0x07, 0xD0, 0x7D, 0x00, 0x3F, 0x07, 0xD0, 0x3E, 0x0B, 0xC0, 0x03, 0xF0,
-    0xBC, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0x4F, 0x80, 0x2F, 0x0F, 0x80, 0x00, 0xF9, 0xF4, 0x00, 0xF5,
-    0xF4, 0x00, 0x0F, 0xEF, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0xBE, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x07,
-    0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x02,
-    0xFC, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xFC, 0x00,
-    0x2F, 0x80, 0x3F, 0x40, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x2F, 0xBF,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x03, 0xF6, 0xF4, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x7F,
-    0x00, 0x03, 0xF4, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0x7F, 0x03, 0xF4,
-    0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0,
-    0xBD, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x1F,
-    0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x0F, 0xC0,
-    0xFC, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00,
-    0xFB, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0x5B, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x6F, 0xC0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF5, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x69, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF9, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x2B, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xF4,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x1F, 0xE4, 0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x00, 0xA8, 0x00,
-    0x03, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x7F, 0x80, 0x07, 0xFE, 0x00, 0xBF, 0x40, 0x03, 0xF0, 0x00,
-    0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00,
-    0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF9, 0x00, 0x00, 0x4F, 0xFF, 0xF9, 0x02, 0xD7, 0xE6, 0xFF, 0xFF, 0xF5, 0x80, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x0F, 0xCB, 0xF6, 0xFD, 0x3F, 0x01, 0x00, 0x00,
-    0x00, 0x2D, 0x0B, 0x42, 0xE0, 0xB8, 0x3E, 0x0F, 0x83, 0xE0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC,
-    0x3F, 0x0F, 0xC3, 0xF1, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x40, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x1F, 0xF4, 0x06,
-    0x43, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x40, 0xFF, 0xA6, 0xBC, 0x07, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFE, 0x56, 0xF4, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x05, 0x7F,
-    0x95, 0x54, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0B, 0xFE, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x10, 0x07, 0x42, 0xF6, 0xFF, 0xE7, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xF4, 0x07, 0xF0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0xF0,
-    0x0F, 0x40, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x0B,
-    0xC0, 0x07, 0xFE, 0x6F, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x42, 0xF0, 0x6A, 0x43, 0xE0, 0x10, 0x00,
-    0x00, 0x10, 0x7E, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0xBD,
-    0x03, 0xF4, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFB, 0xD0, 0x00, 0x01, 0x57, 0xFF, 0x55, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x05, 0x57, 0xF5, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xAA, 0xBF, 0xAA,
-    0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x14, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x00, 0x00, 0x15, 0x54, 0x00, 0x2F, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xD1, 0xF8, 0x00, 0x18, 0x2F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0x80, 0x7F, 0xC2, 0xF0, 0x00,
-    0xBE, 0x2F, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x2F, 0x1F, 0x80, 0x03, 0xF0, 0xFF, 0x40, 0x7D, 0x03,
-    0xFF, 0xAF, 0x80, 0x07, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE3, 0xE4, 0x01, 0xFD, 0x3F, 0xFF, 0xFF, 0x41, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0xFC, 0x0B, 0xC3, 0xF0, 0x2F, 0x4B, 0x80,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0xAF, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x3E, 0x00, 0x05, 0x40, 0x0F, 0x80, 0x0B, 0x80, 0x0B, 0xFF, 0xC0, 0x3D, 0x00, 0xF0,
-    0x07, 0xFF, 0xFC, 0x01, 0xF0, 0x2D, 0x00, 0xFD, 0x00, 0x40, 0x0F, 0x43, 0xC0, 0x2F, 0x40, 0x00,
-    0x00, 0x78, 0x3C, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x78,
-    0x03, 0xD0, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x78, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xC3, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x02, 0xF0, 0x00, 0x00, 0x07, 0x82,
-    0xD0, 0x0F, 0x80, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0xBF, 0xAB, 0xC0, 0x0F, 0x00, 0xB8, 0x01, 0xFF,
-    0xFC, 0x03, 0xD0, 0x03, 0xD0, 0x01, 0xA5, 0x00, 0xBC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xA5, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x3F,
-    0xBF, 0x81, 0x00, 0x3C, 0x00, 0x03, 0xD0, 0x1A, 0xBD, 0x2F, 0xFF, 0xDB, 0xC0, 0x3D, 0xF4, 0x03,
-    0xDF, 0x40, 0x7D, 0xBE, 0x6F, 0xD2, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00,
-    0xF8, 0x07, 0xD0, 0x0F, 0xC0, 0x7F, 0x00, 0xBD, 0x03, 0xF0, 0x0B, 0xE0, 0x3F, 0x00, 0x7E, 0x03,
-    0xF4, 0x07, 0xF0, 0x2F, 0x80, 0x2F, 0x80, 0xFD, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x3F, 0x41, 0xFC,
-    0x00, 0x3F, 0x01, 0xF8, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0xB0, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x55,
-    0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xDB,
-    0xFF, 0xF5, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0xBF, 0xFE, 0x00,
-    0x3D, 0x00, 0xF0, 0x0B, 0xFF, 0xFC, 0x01, 0xF0, 0x2D, 0x00, 0xBC, 0x07, 0xE0, 0x0F, 0x43, 0xC0,
-    0x0B, 0xC0, 0x3F, 0x00, 0x78, 0x3C, 0x00, 0xBC, 0x03, 0xF0, 0x03, 0xC7, 0x80, 0x0B, 0xC0, 0x3E,
-    0x00, 0x3C, 0x78, 0x00, 0xBD, 0x6F, 0xC0, 0x03, 0xC7, 0x80, 0x0B, 0xFF, 0xF0, 0x00, 0x3C, 0x78,
-    0x00, 0xBE, 0xBE, 0x00, 0x03, 0xC3, 0xC0, 0x0B, 0xC2, 0xF0, 0x00, 0x3C, 0x3C, 0x00, 0xBC, 0x0F,
-    0xC0, 0x07, 0x82, 0xD0, 0x0B, 0xC0, 0x7D, 0x00, 0xB4, 0x0F, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0x00,
-    0xB8, 0x0B, 0xC0, 0x1F, 0x83, 0xD0, 0x03, 0xD0, 0x54, 0x00, 0x54, 0xBC, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xA5, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA,
-    0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0x00, 0xBC, 0x3D, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x3D,
-    0x3D, 0x00, 0x3C, 0x2F, 0x00, 0xBC, 0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x45, 0x55, 0xFD, 0x55, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x47, 0xFF, 0xFF, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x54, 0x00, 0x2F, 0xFE, 0x03, 0xFA, 0xBE, 0x02, 0x00, 0x7C, 0x00,
-    0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x7F, 0xFF, 0x03, 0xF9, 0xBF, 0x05, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x07,
-    0xC0, 0x00, 0xBD, 0x01, 0xFF, 0xD0, 0x02, 0xAF, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x00,
-    0x3E, 0x00, 0x01, 0xF5, 0xFA, 0xAF, 0xC7, 0xFF, 0xF8, 0x00, 0x55, 0x00, 0x01, 0xA8, 0x03, 0xF8,
-    0x0B, 0xE0, 0x1F, 0x80, 0x3E, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7F, 0x3F, 0x00, 0x00, 0xBF,
-    0x3F, 0x80, 0x01, 0xFF, 0x3F, 0xE0, 0x1B, 0xFF, 0x3F, 0xFF, 0xFF, 0x2F, 0x3E, 0x7F, 0xF8, 0x2F,
-    0x3E, 0x01, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x55, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xAB, 0xD0, 0xFF, 0xFF,
-    0xF0, 0x2D, 0x1F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3,
-    0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF,
-    0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD1, 0xFF, 0xFF, 0xF0, 0x2D, 0x0F,
-    0xFF, 0xFF, 0x02, 0xD0, 0x3F, 0xFF, 0xF0, 0x2D, 0x00, 0xBF, 0xFF, 0x02, 0xD0, 0x00, 0x00, 0xF0,
-    0x2D, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00,
-    0x00, 0xF0, 0x2D, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0x0F, 0x02,
-    0xD0, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00,
-    0x0F, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xF6,
-    0xFE, 0x7F, 0x01, 0x00, 0x03, 0xC0, 0x0B, 0x40, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0xBC,
-    0xBF, 0xF4, 0x7F, 0x90, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0xDF, 0xEF, 0x7C, 0x7C, 0x41, 0xF0, 0x07,
-    0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xFE, 0xFC, 0x1F, 0x00, 0xBC, 0xB4, 0x00, 0xF3, 0xD0, 0x02,
-    0xDF, 0x00, 0x0B, 0x7C, 0x00, 0x2D, 0xB4, 0x00, 0xF5, 0xF0, 0x07, 0xC2, 0xFA, 0xBD, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x01, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x1F, 0xC0, 0x03,
-    0xF0, 0x1F, 0x80, 0x07, 0xF0, 0x2F, 0x80, 0x07, 0xE0, 0x3F, 0x40, 0x0B, 0xE0, 0x3F, 0x00, 0x1F,
-    0xC0, 0xBD, 0x00, 0xFC, 0x07, 0xE0, 0x0F, 0xD0, 0x7F, 0x00, 0xBD, 0x03, 0xF0, 0x0B, 0xE0, 0x3F,
-    0x00, 0x7E, 0x02, 0xF4, 0x00, 0xB0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x1E, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0xBD,
-    0x7C, 0x00, 0x01, 0xF0, 0x00, 0x20, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0x40, 0x00, 0x7C, 0x02, 0xF0, 0x0B, 0xE0, 0x00,
-    0x7C, 0x03, 0xD0, 0x0F, 0xE0, 0x00, 0x7C, 0x0F, 0x80, 0x3F, 0xE0, 0x00, 0x7C, 0x1F, 0x00, 0xB7,
-    0xE0, 0x00, 0x14, 0x3E, 0x01, 0xF3, 0xE0, 0x00, 0x00, 0xBC, 0x03, 0xC3, 0xE0, 0x00, 0x00, 0xF4,
-    0x0B, 0x43, 0xE0, 0x00, 0x03, 0xE0, 0x1E, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x3D, 0x03, 0xE0, 0x00,
-    0x0F, 0x40, 0xBF, 0xFF, 0xFE, 0x00, 0x2F, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x7C, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0x40, 0x01, 0xFF, 0xE0, 0x00, 0x0B, 0xC0, 0x00,
-    0xF8, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x14, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3E, 0x01, 0xA4, 0x00, 0x03, 0xE0, 0x2F, 0x0F,
-    0xFF, 0xC0, 0x00, 0xF8, 0x0F, 0x4F, 0xE6, 0xFC, 0x00, 0x3E, 0x0F, 0x80, 0x80, 0x1F, 0x00, 0x0F,
-    0x87, 0xC0, 0x00, 0x03, 0xD0, 0x01, 0x43, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x07, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0x40,
-    0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x02, 0x80, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x6F,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x15, 0x00, 0x00, 0x0F, 0x80, 0xF4, 0x07,
-    0xE0, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0xFE, 0x0B, 0x90, 0x7F, 0x07, 0xC0, 0x2F, 0xE0, 0x7F, 0xFF,
-    0xD0, 0xF8, 0x07, 0xAE, 0x00, 0x6A, 0x90, 0x2F, 0x00, 0xF3, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x3D,
-    0x3E, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x83, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0xF0, 0x3E, 0x00, 0x00,
-    0x03, 0xE0, 0x3D, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0x40, 0x3F,
-    0xFF, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x04, 0x2F, 0xE4, 0x1B, 0xD0, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x02, 0xD0, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x78, 0x00, 0x00, 0x3F, 0xFF, 0xAF,
-    0x00, 0x00, 0x03, 0xC1, 0xFF, 0xE0, 0x00, 0x00, 0x74, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0x7E, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B,
-    0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x47, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xB8, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x03,
-    0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF, 0x40,
-    0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBE,
-    0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x01,
-    0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x02, 0xE6, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0xB4, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0x00,
-    0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00,
-    0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xC0, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x81, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xAB, 0xF4, 0x03, 0xFD, 0x00,
-    0x01, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xF9, 0x55, 0xBC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1A, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x2F, 0x4F, 0xC0, 0x0B, 0xD0, 0x3F, 0x01, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x7D, 0x03, 0xE0, 0x07, 0xE0,
-    0x3F, 0x00, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x9F, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x6A, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x01, 0xF4, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x7F, 0x90, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x0A, 0x90, 0x02,
-    0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x01, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x8B, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0xBF, 0xFF, 0xCB, 0xFF, 0xFC, 0x00, 0xA8, 0x00, 0x02,
-    0xFF, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xCB, 0xD0, 0x3E, 0x02, 0xF4, 0xB4, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF0, 0x01, 0xFE, 0x40, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0x10, 0x01, 0x0F, 0xC0,
-    0xBC, 0xFC, 0x0B, 0xDB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xC0, 0x7F, 0x90, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF4, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0, 0x07, 0xFF, 0xFE, 0x90, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBD, 0x00, 0x02, 0xFF, 0x40,
-    0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x3F,
-    0x40, 0xBD, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x00,
-    0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xCF, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0xFF, 0xFF, 0xFD, 0x00,
-    0x0F, 0xDA, 0xFF, 0xAA, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00,
-    0x01, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xAA,
-    0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x05, 0x00, 0x00, 0x3F, 0xF0, 0x0E, 0x00, 0x00, 0xFF, 0xFE, 0xBD, 0x00, 0x00, 0xF0, 0x7F,
-    0xF8, 0x00, 0x01, 0xD0, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC,
-    0xFF, 0xF0, 0x00, 0x00, 0xBC, 0xFF, 0xF4, 0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC,
-    0xBF, 0x00, 0x00, 0xBC, 0xFC, 0x3F, 0x40, 0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B,
-    0xE0, 0x00, 0xBC, 0xFC, 0x03, 0xF4, 0x00, 0xBC, 0xFC, 0x01, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE,
-    0x00, 0xBC, 0xFC, 0x00, 0x3F, 0x40, 0xBC, 0xFC, 0x00, 0x2F, 0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0,
-    0xBC, 0xFC, 0x00, 0x03, 0xF0, 0xBC, 0xFC, 0x00, 0x02, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC,
-    0xFC, 0x00, 0x00, 0x7F, 0xBC, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC,
-    0x00, 0x00, 0x07, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xE5, 0xBF, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x7F,
-    0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x81, 0xFD, 0x00,
-    0x00, 0x07, 0xF0, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xF9, 0x56, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xE5, 0xBF, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x2F,
-    0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80,
-    0x00, 0x00, 0x2F, 0x81, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x2F,
-    0xF9, 0x56, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xE5, 0xBF,
-    0xF8, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x00,
-    0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00,
-    0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x81, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x0B,
-    0xF8, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xF9, 0x56, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x01, 0x80,
-    0x00, 0x00, 0xBF, 0xD0, 0x3C, 0x00, 0x00, 0x1F, 0xFF, 0xEF, 0x80, 0x00, 0x03, 0xC0, 0xBF, 0xF0,
-    0x00, 0x00, 0x38, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B,
-    0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00,
-    0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B,
-    0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00,
-    0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x01, 0xCB, 0xD0, 0x00, 0x1F, 0x8F, 0xD0, 0x01, 0xFC, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD1,
-    0xFC, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x1F, 0xCF, 0xD0, 0x01, 0xFC, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD1, 0xFC, 0x00, 0x0F, 0xD7,
-    0xC0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x6F, 0xFF,
-    0x91, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0x03, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0x83, 0xF0, 0x00,
-    0x02, 0xF4, 0xFC, 0x7F, 0x00, 0x00, 0x7E, 0x0F, 0xDB, 0xE0, 0x00, 0x0F, 0xC0, 0xBE, 0xFD, 0x00,
-    0x02, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x7D, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xC0,
-    0x03, 0xF0, 0x00, 0x3F, 0xFD, 0x00, 0xBD, 0x00, 0x03, 0xFF, 0xD0, 0x1F, 0x80, 0x00, 0x7F, 0xBE,
-    0x03, 0xF0, 0x00, 0x0B, 0xE7, 0xF0, 0xBD, 0x00, 0x00, 0xFD, 0x3F, 0x1F, 0x80, 0x00, 0x0F, 0xC3,
-    0xFF, 0xF0, 0x00, 0x02, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0,
-    0x07, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0x4B, 0xFF, 0xFE, 0x00,
-    0x00, 0xA0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02,
-    0xF8, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x3F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x07, 0x80,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x3F, 0xC0, 0x00, 0x2F, 0xC0,
-    0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x3F,
-    0x00, 0x00, 0x0F, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x0F, 0xC7, 0xF0,
-    0x00, 0x00, 0xBE, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x0F, 0xF9, 0x56, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBE, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80,
-    0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFE, 0xAA, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0xFC,
-    0x00, 0x1F, 0xF4, 0xFC, 0x00, 0x02, 0xFC, 0xFC, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x02, 0xFC, 0xFC,
-    0x00, 0x0B, 0xF4, 0xFF, 0xAB, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x90, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x02, 0xFD, 0x00, 0x6F, 0xC0, 0x3F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x3F, 0x00,
-    0x00, 0xBD, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x02, 0xFC, 0x00,
-    0x3F, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F,
-    0xD0, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0x03, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0x00, 0x07, 0xFD, 0x03,
-    0xF0, 0x00, 0x0B, 0xF4, 0x3F, 0x00, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00,
-    0x07, 0xE3, 0xF0, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0xB8, 0x02, 0xFC, 0x3F,
-    0x0B, 0xFF, 0xFF, 0x43, 0xF0, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0x80, 0x3E, 0x51, 0xBF, 0x40, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xAA, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x3F, 0xE9, 0x57,
-    0xF3, 0xF8, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x07, 0xF7,
-    0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x0B, 0xFF, 0x1F, 0xFF, 0xFD, 0x7C, 0x1F, 0xFF, 0x81, 0xF0, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x80, 0x3E, 0x51, 0xBF, 0x40, 0x40, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xAA, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xE9, 0x57, 0xF3, 0xF8, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0x7E, 0x00,
-    0x00, 0xFD, 0xF8, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x0B, 0xFF, 0x1F, 0xFF, 0xFD,
-    0x7C, 0x1F, 0xFF, 0x81, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0x8F, 0xC0, 0x01, 0xF4, 0x0F, 0xC0, 0x0F, 0x40, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x80, 0x3E,
-    0x51, 0xBF, 0x40, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x01, 0xAA, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x3F, 0xE9, 0x57, 0xF3, 0xF8, 0x00, 0x0F,
-    0xDF, 0xC0, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x3F, 0xCF,
-    0xE0, 0x0B, 0xFF, 0x1F, 0xFF, 0xFD, 0x7C, 0x1F, 0xFF, 0x81, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x20, 0x07, 0xFE, 0x02, 0xD0, 0x3F, 0xFF, 0xAF, 0x01, 0xE0, 0x7F, 0xF4, 0x0B, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xFF,
-    0xE0, 0x0F, 0x94, 0x6F, 0xD0, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x6A, 0xBF, 0xC0, 0xBF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0xFC, 0xFE,
-    0x00, 0x03, 0xF7, 0xF0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3F, 0x7E, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-    0x0F, 0xF3, 0xF8, 0x02, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x10, 0x01, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x2D, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0xE0, 0x0F, 0x94, 0x6F, 0xD0, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x6A, 0xBF, 0xC0, 0xBF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55,
-    0xFC, 0xFE, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3F, 0x7E, 0x00, 0x01, 0xFD,
-    0xFC, 0x00, 0x0F, 0xF3, 0xF8, 0x02, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0x07, 0xFF, 0xE0, 0x7C, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xE7, 0xE0, 0x00, 0x0E,
-    0x03, 0xC0, 0x00, 0x74, 0x0F, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x01, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF8,
-    0x03, 0xE5, 0x1B, 0xF4, 0x04, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1A, 0xAF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC3, 0xFE, 0x95, 0x7F, 0x3F, 0x80,
-    0x00, 0xFD, 0xFC, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x7F, 0x7F, 0x00, 0x03,
-    0xFC, 0xFE, 0x00, 0xBF, 0xF1, 0xFF, 0xFF, 0xD7, 0xC1, 0xFF, 0xF8, 0x1F, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xE0, 0x02, 0xF9, 0x17, 0xFB, 0xF4, 0x1F, 0xE0, 0x01, 0x00, 0x03, 0xFF, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x16, 0xAB, 0xFE, 0xAA, 0xAB, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xA5, 0x6F, 0xEA, 0xAA, 0xAA, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x5F,
-    0xE4, 0x16, 0xD0, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x05, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x01, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xE5, 0xAD, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07,
-    0xFD, 0x05, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x3F, 0x91, 0xBF, 0x80, 0x3F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xBE, 0x0B, 0xD0, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xEA,
-    0xAA, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x05, 0xB4, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x91, 0xBF, 0x80, 0x3F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xBE,
-    0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xEA, 0xAA, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x05, 0xB4, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x01, 0xF8, 0xFD, 0x00, 0x01, 0xF8, 0x0B,
-    0xD0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x91, 0xBF, 0x80, 0x3F, 0x40, 0x03, 0xF0, 0x1F,
-    0x80, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0xAA, 0xAA, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xEA, 0xAA, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF5,
-    0x05, 0xB4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x10, 0x01, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xD0, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0x46, 0xFE, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x7E, 0x00,
-    0x02, 0xF8, 0x2F, 0x40, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3, 0xFA, 0xAA, 0xAB, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAA, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD4, 0x16,
-    0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x2A, 0x40,
-    0x2F, 0xC0, 0x0B, 0xE0, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0xA8, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x29, 0x00, 0x00, 0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x0B,
-    0xE3, 0xF0, 0x1F, 0x40, 0xFC, 0x3C, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x43, 0xE0, 0x3F, 0x7E, 0x03, 0xF3, 0xD0, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x07, 0xC0, 0x00, 0x2F, 0xE6, 0xFC,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x7F,
-    0x87, 0xF0, 0x00, 0x03, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x0A, 0xE9, 0x2F, 0x40, 0x0F, 0xFF, 0xFD, 0xF8, 0x03, 0xFF, 0xAF, 0xFF, 0xC0, 0xFE, 0x00,
-    0x0B, 0xFC, 0x1F, 0xC0, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3,
-    0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x0F, 0xC2, 0xF8, 0x00, 0x01, 0xF8, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x20, 0x01, 0xFF, 0x80, 0xB0, 0x03, 0xFF, 0xFA, 0xF0, 0x0B, 0x41, 0xFF, 0xD0, 0x0B, 0x00, 0x2A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0x80, 0x3D, 0x7F, 0xFF,
-    0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD,
-    0x57, 0xFD, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00,
-    0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1,
-    0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF,
-    0xF4, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD, 0x57, 0xFD, 0x00, 0xFE, 0x00, 0x07,
-    0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0F,
-    0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xE0,
-    0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x1E, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x03, 0xFD, 0x57, 0xFD, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82,
-    0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00,
-    0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F,
-    0x40, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F,
-    0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x18, 0x00, 0x0B, 0xFD, 0x03, 0xC0, 0x01, 0xFF, 0xFE, 0xF8, 0x00, 0x2D, 0x0B, 0xFF,
-    0x00, 0x02, 0x80, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x7F,
-    0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xFD,
-    0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0xFE, 0x00,
-    0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0xBE, 0x07,
-    0xF0, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F,
-    0xD0, 0x0F, 0xE0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B,
-    0xD3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x2F, 0x80, 0xFE, 0x00, 0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x45,
-    0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x02, 0xFF, 0xF4, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0x7F, 0xD0, 0x0F,
-    0xE0, 0x01, 0xFF, 0x01, 0xFC, 0x00, 0x3F, 0xF4, 0x2F, 0x40, 0x0B, 0xDF, 0xC3, 0xF0, 0x01, 0xF4,
-    0xFC, 0x3F, 0x00, 0x3E, 0x0F, 0xD3, 0xF0, 0x0F, 0xC0, 0xBD, 0x3F, 0x02, 0xF4, 0x0B, 0xD3, 0xF0,
-    0x7E, 0x00, 0xFD, 0x3F, 0x0F, 0xC0, 0x0F, 0xC2, 0xF6, 0xF0, 0x00, 0xFC, 0x1F, 0xFD, 0x00, 0x2F,
-    0x80, 0xFF, 0x80, 0x07, 0xF0, 0x07, 0xFD, 0x06, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x1F, 0xAF,
-    0xFF, 0x80, 0x00, 0x70, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF,
-    0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F,
-    0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF,
-    0x3F, 0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0xBE, 0x3F, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x03, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF,
-    0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x10, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xF4, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF,
-    0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F,
-    0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x9F, 0x80,
-    0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x03, 0xF0,
-    0x00, 0x3E, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x3F, 0x2F,
-    0x40, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0x5B, 0xF8, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFF, 0x80, 0x0F,
-    0x9F, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xBF, 0xC0, 0xFF, 0x40, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x3F,
-    0x0F, 0xC0, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00,
-    0x00, 0x3F, 0x4F, 0xE0, 0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x0F, 0xE0, 0xFF, 0xE0, 0x1F, 0xF0, 0x3E,
-    0xBF, 0xFF, 0xF0, 0x0F, 0x87, 0xFF, 0xE0, 0x03, 0xF0, 0x05, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x3F,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x2F,
-    0x4F, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00,
-    0xFC, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0xF8,
-    0x0B, 0xD0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x2F, 0x3F, 0x00, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x05, 0x6F, 0xE0, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA9, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x03,
-    0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF, 0x40,
-    0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBE,
-    0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x01,
-    0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xAA, 0xAA, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0xF9, 0x46, 0xFD, 0x01, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xAB, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0xFF, 0xA5, 0x5F, 0xCF,
-    0xE0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x1F, 0xDF, 0xC0,
-    0x00, 0xFF, 0x3F, 0x80, 0x2F, 0xFC, 0x7F, 0xFF, 0xF5, 0xF0, 0x7F, 0xFE, 0x07, 0xC0, 0x05, 0x40,
-    0x00, 0x00, 0x18, 0x00, 0x09, 0x00, 0x00, 0x01, 0xE0, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0xEA, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xAE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0x7E, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B,
-    0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x47, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0x80, 0x00, 0x90,
-    0x0B, 0x40, 0x0F, 0x40, 0x1F, 0xEA, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0B, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0x94,
-    0x6F, 0xD0, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x6A, 0xBF, 0xC0, 0xBF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0xFC, 0xFE, 0x00, 0x03, 0xF7,
-    0xF0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3F, 0x7E, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x0F, 0xF3, 0xF8,
-    0x02, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00,
-    0x03, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00,
-    0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00,
-    0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x80, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xE5, 0x1B, 0xF4, 0x01, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x06,
-    0xAB, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x0F, 0xFA, 0x55, 0xFC, 0x3F, 0x80, 0x00, 0xFC, 0x7F, 0x00,
-    0x00, 0xFC, 0x7E, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x3F, 0x80,
-    0x2F, 0xFC, 0x1F, 0xFF, 0xFD, 0x7C, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x15, 0x00, 0xB8, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x07, 0xFA, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0xAA, 0xFD, 0x00, 0xFF,
-    0x40, 0x00, 0x60, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0x6F, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x1F, 0xFF, 0xFE, 0x03, 0xFE, 0x5A, 0xD0, 0xFE, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x5E, 0x01, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0xB4,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0xAA, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x60, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x55, 0x6F, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x1F,
-    0x8F, 0xD0, 0x01, 0xF8, 0x0B, 0xC0, 0x0F, 0x40, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0xE5, 0xAD, 0x03, 0xF8, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x41, 0x78, 0x01, 0xFF, 0xFF,
-    0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xAA, 0xBF, 0x40, 0x3F, 0xD0, 0x00, 0x18, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x95, 0x5B, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x01, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xE5, 0xAD, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xFD,
-    0x05, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0xAA, 0xFD,
-    0x00, 0xFF, 0x40, 0x00, 0x60, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0x6F, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x0B, 0xD0, 0x1F,
-    0x80, 0x0B, 0xD2, 0xF8, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0x80, 0x3F,
-    0xE5, 0xAD, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0x41, 0x78, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x64, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0xFC, 0x00, 0x00, 0x2F, 0xD0,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x03,
-    0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x01, 0xFF, 0x40,
-    0xFE, 0xAA, 0xBF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x01, 0x50, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x87, 0xD0,
-    0x00, 0x00, 0x01, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0x40, 0x00, 0x00, 0x01, 0xF8, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x0F, 0x80,
-    0x00, 0x2F, 0xFF, 0xFC, 0xF8, 0x00, 0x07, 0xF9, 0x57, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x0B, 0xF8,
-    0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00,
-    0x2F, 0x80, 0x02, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80,
-    0x6F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBD, 0x00, 0x02, 0xFF, 0x40, 0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x00,
-    0xBD, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0xBD, 0x00, 0x00, 0x02, 0xF8,
-    0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xCF, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xDA, 0xFF, 0xAA, 0x80, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xD0, 0x00, 0x00,
-    0x2F, 0x80, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0xBD, 0x00, 0x00,
-    0x2F, 0xC0, 0x0B, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xAA, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x55, 0x6F, 0xD4, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x2F, 0xFD, 0x1F, 0x80, 0x01, 0xFF, 0xFF, 0x8F, 0x80, 0x07, 0xFD, 0x5B, 0xFF, 0x80, 0x0F,
-    0xE0, 0x00, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x3F, 0x00,
-    0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00,
-    0x0F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x2F,
-    0x80, 0x2F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x06, 0xFF, 0x80,
-    0x02, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x7F, 0xFE, 0x0F, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x06,
-    0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x9F, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xAA, 0xAA, 0x80, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x0F, 0xE4, 0x6F, 0xE0, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x2F, 0x82,
-    0xF4, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0xAA, 0xAA, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFA, 0xAA, 0xAA, 0xA0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x41, 0x6D, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x0A, 0x00, 0x06, 0x00, 0xF0,
-    0x00, 0xF0, 0x07, 0xEA, 0xBE, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA,
-    0x9F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x80, 0x00, 0x90, 0x00, 0xB8, 0x00, 0xB4,
-    0x00, 0x0F, 0xEA, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFE,
-    0x46, 0xFE, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC3, 0xFA, 0xAA, 0xAB, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAA,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD4, 0x16, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x9F, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0x46, 0xFE, 0x00, 0xFD,
-    0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3,
-    0xFA, 0xAA, 0xAB, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAA, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xD4, 0x16, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xE9, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x0F, 0xE4, 0x6F, 0xE0, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x03,
-    0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0xAA, 0xAA, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0xAA,
-    0xAA, 0xA0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x41, 0x6D, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0x5B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0xE8, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x09, 0x00, 0x06, 0x40, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0xBD,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x02, 0x80, 0x00, 0xA0, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x0B,
-    0xD1, 0xF8, 0x00, 0x00, 0xBE, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x3F, 0x91, 0xBF, 0x80, 0x3F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xBE, 0x0B, 0xD0, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xEA,
-    0xAA, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x05, 0xB4, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00, 0x07, 0xE0,
-    0x2F, 0x40, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAB, 0xFC,
-    0x03, 0xFE, 0x00, 0x00, 0x24, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAA, 0xA9, 0xFC, 0x00, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00, 0x3F,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFF, 0xE5, 0x56, 0xFF, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00,
-    0xFC, 0x07, 0xE0, 0x00, 0x78, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x0B, 0x80, 0x7F, 0xFF, 0xF3, 0xE0, 0x7F, 0xD5, 0xBF, 0xF8, 0x3F, 0x80, 0x03,
-    0xFE, 0x1F, 0xC0, 0x00, 0x3F, 0x8B, 0xD0, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xFC,
-    0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x0F, 0xE0, 0xFD, 0x00, 0x07, 0xF8,
-    0x2F, 0xE0, 0x1B, 0xFE, 0x02, 0xFF, 0xFF, 0xDF, 0x80, 0x1F, 0xFF, 0x83, 0xE0, 0x00, 0x14, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x50, 0x00,
-    0x0F, 0xF0, 0x3F, 0xA5, 0x6F, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00,
-    0x06, 0x00, 0x02, 0x40, 0x00, 0x0B, 0x80, 0x0B, 0x40, 0x00, 0x03, 0xFA, 0xBF, 0x00, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAB,
-    0xFC, 0x03, 0xFE, 0x00, 0x00, 0x24, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAA, 0xA9, 0xFC, 0x00,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00,
-    0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFF, 0xE5, 0x56, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x90, 0x00, 0xA0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0B, 0xEA, 0xFD, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x2E, 0x01, 0xFF, 0xFF, 0xCF, 0x81, 0xFF, 0x56, 0xFF, 0xE0, 0xFE, 0x00, 0x0F, 0xF8, 0x7F, 0x00,
-    0x00, 0xFE, 0x2F, 0x40, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x01, 0xF8,
-    0xFD, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x1F, 0xE0, 0xBF, 0x80, 0x6F,
-    0xF8, 0x0B, 0xFF, 0xFF, 0x7E, 0x00, 0x7F, 0xFE, 0x0F, 0x80, 0x00, 0x50, 0x03, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x01, 0x40, 0x00, 0x3F, 0xC0, 0xFE,
-    0x95, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAB, 0xFC, 0x03, 0xFE,
-    0x00, 0x00, 0x24, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAA, 0xA9, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFF, 0xE5, 0x56, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x2E, 0x01, 0xFF,
-    0xFF, 0xCF, 0x81, 0xFF, 0x56, 0xFF, 0xE0, 0xFE, 0x00, 0x0F, 0xF8, 0x7F, 0x00, 0x00, 0xFE, 0x2F,
-    0x40, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x3E,
-    0x3F, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00,
-    0x7E, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x1F, 0xE0, 0xBF, 0x80, 0x6F, 0xF8, 0x0B, 0xFF,
-    0xFF, 0x7E, 0x00, 0x7F, 0xFE, 0x0F, 0x80, 0x00, 0x50, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x01, 0x40, 0x00, 0x3F, 0xC0, 0xFE, 0x95, 0xBF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAB, 0xFC, 0x03, 0xFE, 0x00,
-    0x00, 0x24, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAA, 0xA9, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0xE0, 0x00,
-    0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFF, 0xE5, 0x56, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x0B, 0x80, 0x7F, 0xFF, 0xF3, 0xE0, 0x7F, 0xD5, 0xBF, 0xF8, 0x3F, 0x80, 0x03,
-    0xFE, 0x1F, 0xC0, 0x00, 0x3F, 0x8B, 0xD0, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xFC,
-    0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x0F, 0xE0, 0xFD, 0x00, 0x07, 0xF8,
-    0x2F, 0xE0, 0x1B, 0xFE, 0x02, 0xFF, 0xFF, 0xDF, 0x80, 0x1F, 0xFF, 0x83, 0xE0, 0x00, 0x14, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x50, 0x00,
-    0x0F, 0xF0, 0x3F, 0xA5, 0x6F, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0xE3,
-    0xF0, 0x00, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xFA, 0xAA, 0xAA, 0xBF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00,
-    0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F,
-    0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00,
-    0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00,
-    0x3C, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFF, 0x80, 0x00, 0x3E, 0x7F, 0xFF, 0xF4, 0x00, 0x3F, 0xF9, 0x57,
-    0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xEA, 0xBF, 0xAA, 0xAA, 0xAA, 0xFF, 0xA4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0xEA, 0xAA, 0xAA, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0x7F, 0x55, 0x54, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x16, 0x50, 0x00, 0x3E, 0x1F, 0xFF, 0xE0, 0x03,
-    0xEB, 0xFF, 0xFF, 0x80, 0x3F, 0xF4, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0x40, 0x01, 0x43, 0xFF, 0x00, 0xE3, 0xFF, 0xFA,
-    0xF4, 0xF0, 0x7F, 0xF8, 0x74, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFC, 0x00, 0x1F, 0xE4, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xC0, 0x01, 0x40, 0x02, 0x07,
-    0xFE, 0x02, 0xC3, 0xFF, 0xFA, 0xF2, 0xD0, 0x7F, 0xF4, 0xB0, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2A, 0xAA,
-    0xA5, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x82, 0xFF,
-    0xFF, 0x00, 0x7F, 0x90, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x0B, 0xFF, 0xFC, 0x2F, 0xFF, 0xF0, 0x6A, 0xAA,
-    0xA2, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00,
-    0x29, 0xE0, 0x01, 0xE3, 0xFA, 0xBF, 0x03, 0xFF, 0xF4, 0x02, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF8, 0x2F, 0xFF, 0xF0, 0x07, 0xF9, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0xBF, 0xFF,
-    0xC2, 0xFF, 0xFF, 0x00, 0xA0, 0x00, 0x66, 0xD0, 0x03, 0xC7, 0xEA, 0xBF, 0x0B, 0xFF, 0xF0, 0x06,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x7F, 0x90,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0x00,
-    0x2E, 0x00, 0x2E, 0x00, 0x0F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x7F, 0xA0, 0x0B, 0xFC, 0x00,
-    0x14, 0x01, 0x80, 0x1F, 0xC0, 0x7F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-    0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F,
-    0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x1F, 0x00, 0xF0,
-    0x0B, 0x80, 0x3D, 0x00, 0xF4, 0x03, 0xFA, 0x47, 0xFD, 0x01, 0x40, 0x00, 0x90, 0x00, 0xFD, 0x00,
-    0x3F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0xBF, 0xFF, 0xC1,
-    0xFE, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x2F, 0xFF, 0xFB, 0xFF,
-    0xFC, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
-    0x3F, 0x3F, 0x3F, 0xBF, 0xFF, 0x80, 0x2F, 0x6F, 0xFF, 0xF0, 0x0B, 0xD0, 0x7F, 0x90, 0x02, 0xF4,
-    0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x02,
-    0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0x00,
-    0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xD0, 0x3F,
-    0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xD0,
-    0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFD, 0x00, 0x0B,
-    0xDB, 0xFF, 0xFC, 0x02, 0xF6, 0xFF, 0xFF, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x01, 0x5B, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x18, 0x00, 0x05, 0x1F, 0xC0, 0x0B, 0xD7, 0xF0, 0x03,
-    0xF8, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x7D, 0x3F, 0x00, 0x2F, 0x4F, 0xC0, 0x0B, 0xD3, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00,
-    0x2F, 0x4F, 0xC0, 0x0B, 0xD3, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x2F, 0x4F, 0xC0,
-    0x0B, 0xD3, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x2F, 0x4F, 0xC0, 0x0B, 0xD3, 0xF0,
-    0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x02, 0x6F, 0xF0, 0x00, 0xFF, 0xF0, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0x8B,
-    0xD0, 0x03, 0xE0, 0x2F, 0x40, 0xB4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x05, 0x5B, 0xF0,
-    0x00, 0xBF, 0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x0B, 0xE3, 0xF0, 0x1F, 0x40, 0xFC, 0x3C, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBE, 0x00, 0xA6, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xBF,
-    0xD0, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x01, 0xFC, 0x0F,
-    0xC0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0xFE,
-    0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xF8, 0xBF, 0x00,
-    0x00, 0xFE, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xC0,
-    0x02, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x02, 0xFC,
-    0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0x3E, 0x00, 0x0B, 0xE0, 0x3E, 0x00, 0x2F, 0x80, 0x3E, 0x00,
-    0xBF, 0x00, 0x3E, 0x02, 0xFC, 0x00, 0x3E, 0x0B, 0xF0, 0x00, 0x3E, 0x1F, 0xC0, 0x00, 0x3E, 0x7F,
-    0x00, 0x00, 0x3E, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x3F, 0x03,
-    0xF8, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x2F, 0xC0, 0x3E, 0x00,
-    0x0F, 0xE0, 0x3E, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x3F, 0x00,
-    0x0B, 0xF0, 0x3F, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x7F, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x3F, 0x03,
-    0xF4, 0x00, 0x3F, 0x0F, 0xE0, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xD7, 0xF0, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x3F, 0x00,
-    0x7F, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x01, 0xFC, 0x00, 0xA9, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF,
-    0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x00, 0xA8, 0x03, 0xF8, 0x07, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x00, 0x78, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x0F, 0xC3, 0xF0,
-    0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC,
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x4B, 0xC3, 0xE1, 0xF0, 0xB4, 0x14, 0x00, 0xBC, 0x00, 0x07, 0xDF, 0xC0, 0x00, 0x7D, 0xFC, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0xF4, 0xFC, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x80, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xFA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x15, 0x01, 0x43, 0xF0, 0xFC,
-    0x3F, 0x0F, 0x83, 0xF0, 0xF0, 0x3F, 0x1E, 0x03, 0xF2, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x24, 0x0F, 0xC0, 0x0F, 0xD0, 0xFC, 0x00, 0xFD, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
-    0x15, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x24, 0x3F, 0x3F, 0x4F, 0xCF, 0xD3,
-    0xF2, 0xF0, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x0B, 0x40, 0x00, 0x3F, 0x5F, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x13,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x50, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80,
-    0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x40, 0x1F, 0xBD, 0x01,
-    0xFF, 0xE0, 0x1F, 0xF4, 0x0B, 0xF8, 0x03, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8,
-    0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0xFF,
-    0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00, 0x00, 0xBC, 0xFF, 0xF4,
-    0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00, 0xBC, 0xFC, 0x3F, 0x40,
-    0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xE0, 0x00, 0xBC, 0xFC, 0x03, 0xF4, 0x00,
-    0xBC, 0xFC, 0x01, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE, 0x00, 0xBC, 0xFC, 0x00, 0x3F, 0x40, 0xBC,
-    0xFC, 0x00, 0x2F, 0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0, 0xBC, 0xFC, 0x00, 0x03, 0xF0, 0xBC, 0xFC,
-    0x00, 0x02, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0xFC, 0x00,
-    0x00, 0x2F, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFC, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x0B, 0xFF, 0x80, 0x3D, 0x7F, 0xFF, 0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0,
-    0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0xFF,
-    0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00, 0x00, 0xBC, 0xFF, 0xF4,
-    0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00, 0xBC, 0xFC, 0x3F, 0x40,
-    0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xE0, 0x00, 0xBC, 0xFC, 0x03, 0xF4, 0x00,
-    0xBC, 0xFC, 0x01, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE, 0x00, 0xBC, 0xFC, 0x00, 0x3F, 0x40, 0xBC,
-    0xFC, 0x00, 0x2F, 0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0, 0xBC, 0xFC, 0x00, 0x03, 0xF0, 0xBC, 0xFC,
-    0x00, 0x02, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0xFC, 0x00,
-    0x00, 0x2F, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFC, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B,
-    0xFF, 0x80, 0x3D, 0x7F, 0xFF, 0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFE, 0x3F, 0x80,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00,
-    0x00, 0x1F, 0x87, 0xE0, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0xBC, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00,
-    0x00, 0xBC, 0xFF, 0xF4, 0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00,
-    0xBC, 0xFC, 0x3F, 0x40, 0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xE0, 0x00, 0xBC,
-    0xFC, 0x03, 0xF4, 0x00, 0xBC, 0xFC, 0x01, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE, 0x00, 0xBC, 0xFC,
-    0x00, 0x3F, 0x40, 0xBC, 0xFC, 0x00, 0x2F, 0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0, 0xBC, 0xFC, 0x00,
-    0x03, 0xF0, 0xBC, 0xFC, 0x00, 0x02, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC, 0xFC, 0x00, 0x00,
-    0x7F, 0xBC, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x02, 0x40, 0x01, 0x90, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0xFC,
-    0x2F, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0x80, 0x3D, 0x7F, 0xFF, 0xF4, 0x3F, 0xF9,
-    0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0xE0,
-    0x7F, 0xFD, 0x02, 0xE0, 0xFC, 0xFF, 0xFF, 0xE0, 0x50, 0x3F, 0xFD, 0x56, 0xFD, 0x00, 0x0F, 0xF8,
-    0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40,
-    0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00,
-    0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00,
-    0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0xBE, 0x00, 0x00, 0x00,
-    0xBC, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00, 0x00, 0xBC,
-    0xFF, 0xF8, 0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00, 0xBC, 0xFC,
-    0x3F, 0x80, 0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xF0, 0x00, 0xBC, 0xFC, 0x03,
-    0xF8, 0x00, 0xBC, 0xFC, 0x00, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xBF, 0x00, 0xBC, 0xFC, 0x00, 0x3F,
-    0x80, 0xBC, 0xFC, 0x00, 0x0F, 0xC0, 0xBC, 0xFC, 0x00, 0x07, 0xF0, 0xBC, 0xFC, 0x00, 0x03, 0xF8,
-    0xBC, 0xFC, 0x00, 0x00, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x05, 0x5B, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0x90, 0x3D,
-    0x7F, 0xFF, 0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7F, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x26, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x0A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07,
-    0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00,
-    0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x7F,
-    0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xFD,
-    0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0xFE, 0x00,
-    0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00,
-    0x0B, 0xEA, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD,
-    0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00,
-    0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00,
-    0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF,
-    0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x60, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xBE, 0xAB,
-    0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F,
-    0xD0, 0x0F, 0xE0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B,
-    0xD3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x2F, 0x80, 0xFE, 0x00, 0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x0A, 0x80, 0x00, 0x00,
-    0x2F, 0x82, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xE5, 0xBF, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x7F,
-    0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x81, 0xFD, 0x00,
-    0x00, 0x07, 0xF0, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xF9, 0x56, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0xA8, 0x00, 0x02, 0xF8, 0x2F, 0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0xFC,
-    0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x2C, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD, 0x57, 0xFD,
-    0x00, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD,
-    0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1, 0xFC, 0x00,
-    0x02, 0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xF9,
-    0x6B, 0xFF, 0xFF, 0xFF, 0x0B, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xFE, 0xAA, 0xA8, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF7, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0xF9,
-    0x56, 0xFF, 0xAA, 0xAA, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x40, 0x0F,
-    0xE5, 0x6F, 0xE3, 0xF9, 0x1B, 0xF0, 0x0F, 0xD0, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0x07, 0xE0, 0x00,
-    0x0F, 0xF8, 0x00, 0x0F, 0xD2, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xCF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF3, 0xF0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xA8, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xF9, 0x06,
-    0xFC, 0xFF, 0x40, 0x6F, 0x00, 0x7F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0xBF, 0x80,
-    0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00,
-    0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F,
-    0xE5, 0x56, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0xFD,
-    0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0xFC,
-    0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B,
-    0xE0, 0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xA4, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x0B, 0xFC, 0x3D, 0x3F, 0xFC, 0x3D, 0xBE, 0x98, 0x3F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0xBF, 0x80, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0,
-    0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xFD,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xE5, 0x56, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x40, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x3F, 0x4F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFC, 0x3D, 0x3F,
-    0xFC, 0x3D, 0xBE, 0x98, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xBC, 0x01,
-    0xF4, 0x00, 0x02, 0xF4, 0xBD, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xA4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0xBF, 0x80, 0xFC,
-    0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x0B,
-    0xD0, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xE5,
-    0x56, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0xFD, 0x00,
-    0x0F, 0xC0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0xFC, 0x00,
-    0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xE0,
-    0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x02, 0xFC, 0x64, 0x00, 0x19, 0x3E, 0x00, 0xBC, 0x0F,
-    0xC3, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x0B, 0xFC, 0x3D, 0x3F, 0xFC, 0x3D, 0xBE, 0x98, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFE, 0xAB, 0xF8, 0x1F, 0xC0, 0x00, 0x14, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95, 0x5F, 0xF4, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xD0,
-    0x5F, 0x43, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD7, 0xD0, 0x06, 0xFC, 0x7F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x01, 0xF8, 0x0B, 0xD0, 0x03, 0xD0,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFE, 0xAB, 0xF8, 0x1F, 0xC0, 0x00, 0x14, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95,
-    0x5F, 0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x1A,
-    0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0x5F, 0xC0, 0x0B, 0xC0, 0x7E, 0x01,
-    0xE0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xD0, 0x5F, 0x43, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD7, 0xD0,
-    0x06, 0xFC, 0x7F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0xAB, 0xF8, 0x1F, 0xC0, 0x00,
-    0x14, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF9,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0xBD, 0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95, 0x5F, 0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC3, 0xFD, 0x05, 0xF4, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x7D, 0x00, 0x6F, 0xC7, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x2F, 0xBE, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0xAB, 0xF8, 0x1F, 0xC0, 0x00, 0x14,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF9, 0x00,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD,
-    0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95, 0x5F, 0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x19, 0x00, 0x06, 0x40, 0xF8, 0x02, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xD0, 0x5F, 0x43, 0xF0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0B, 0xD7, 0xD0, 0x06, 0xFC, 0x7F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x15, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x17, 0xF5, 0x54,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0x40,
-    0x00, 0x0F, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x90, 0x00, 0x64, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x03,
-    0xF0, 0xBD, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF0, 0x00,
-    0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x17, 0xF5, 0x54, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x15, 0x5F, 0xD5, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x17, 0xF5, 0x54,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x2B, 0xFA, 0xA4, 0x3F, 0xFF, 0xFC, 0x2B,
-    0xFA, 0xA8, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xFD, 0x00, 0x01, 0x40,
-    0x00, 0x05, 0x00, 0x08, 0x00, 0x02, 0xFF, 0x80, 0xB0, 0x00, 0x1F, 0xFF, 0xEB, 0xC0, 0x00, 0xB4,
-    0x2F, 0xFD, 0x00, 0x02, 0x80, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0xBE,
-    0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x0F, 0xF9, 0x56, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x01, 0xFF, 0x80, 0xB0,
-    0x03, 0xFF, 0xFA, 0xF0, 0x0B, 0x41, 0xFF, 0xD0, 0x0B, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF,
-    0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0xA0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00,
-    0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x95, 0x6F, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01,
-    0xAA, 0xAA, 0x80, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F,
-    0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x60, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x07, 0xEA, 0xBE, 0x00, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00,
-    0xBD, 0xFC, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0xBE, 0x0F,
-    0xF0, 0x00, 0x0B, 0xF0, 0x0F, 0xF9, 0x56, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x02, 0x80, 0x01, 0x90, 0x02, 0xD0, 0x03, 0xC0, 0x01,
-    0xFA, 0xAF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F,
-    0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x07, 0x40,
-    0xF0, 0x00, 0x00, 0x1D, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00,
-    0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F,
-    0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x2F, 0x83, 0xFC, 0x00,
-    0x02, 0xFC, 0x03, 0xFE, 0x55, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3E,
-    0x7E, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x74, 0x0F, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00,
-    0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00,
-    0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00,
-    0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF,
-    0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0A, 0x80, 0xA8, 0x00, 0x00,
-    0x7F, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x1F,
-    0x00, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00,
-    0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00,
-    0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x3F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1A, 0x02, 0xA0, 0x00, 0x7F, 0x07, 0xF0, 0x00,
-    0xFC, 0x0F, 0xC0, 0x01, 0xF4, 0x2F, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F,
-    0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00,
-    0x05, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00,
-    0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00,
-    0x02, 0xF8, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x56, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x1F,
-    0x80, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x3F,
-    0x1F, 0x80, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00,
-    0x3F, 0x1F, 0x80, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x01, 0xFC, 0x7E, 0x00,
-    0x00, 0xBF, 0x0F, 0xC0, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x2F, 0xF0, 0xBF, 0x80, 0x6F, 0xFC, 0x0F,
-    0xFF, 0xFF, 0x3F, 0x00, 0xBF, 0xFE, 0x0F, 0xC0, 0x00, 0x50, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F,
-    0xE8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF5,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0x0B,
-    0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x7E, 0xF0, 0x00, 0x0B, 0xD0, 0x3F,
-    0x00, 0x02, 0xF7, 0xE0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0xFC, 0x02, 0xF4,
-    0x00, 0x7E, 0x2F, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x02, 0xF0, 0x7D, 0x00, 0x2F, 0x40, 0x0F, 0xC0,
-    0x0F, 0xC0, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x3E, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xBD, 0x01,
-    0xF4, 0x0B, 0xD0, 0x1F, 0x80, 0x01, 0xF8, 0x0F, 0xC0, 0x0F, 0x80, 0xBD, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x2F, 0x4B, 0xC0,
-    0x01, 0xF8, 0x7D, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0xFC, 0xF8, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0x03, 0xF7, 0xD0, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x07, 0xEF, 0x00, 0x00,
-    0x3E, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xE7, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0xBD, 0x3F, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0xBF, 0xF0, 0x00, 0xFC,
-    0x1F, 0x80, 0x0F, 0xAF, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0xF5, 0xF4, 0x02, 0xF4, 0x0F, 0xC0, 0x1F,
-    0x0F, 0x80, 0x3F, 0x00, 0xBD, 0x03, 0xF0, 0xFC, 0x03, 0xF0, 0x07, 0xE0, 0x3E, 0x07, 0xD0, 0x7D,
-    0x00, 0x3F, 0x07, 0xD0, 0x3E, 0x0B, 0xC0, 0x03, 0xF0, 0xBC, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0x4F,
-    0x80, 0x2F, 0x0F, 0x80, 0x00, 0xF9, 0xF4, 0x00, 0xF5, 0xF4, 0x00, 0x0F, 0xEF, 0x00, 0x0F, 0xAF,
-    0x00, 0x00, 0xBE, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x07, 0xE3, 0xF4, 0x00, 0x00, 0x7E,
-    0x02, 0xF0, 0x00, 0x03, 0xD0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBE, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80,
-    0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x01, 0xF8, 0xFD, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E,
-    0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x0B, 0xCF, 0xC0,
-    0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0x5B, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x0B, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0xFD,
-    0x00, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x0B, 0xE0, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xFD, 0x00,
-    0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x69, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x6F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x07, 0xF5, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x09, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC1, 0x55,
-    0x56, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x4B,
-    0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x7D, 0x00, 0xF8, 0x00,
-    0x07, 0xE1, 0xF8, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x2F, 0xEA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x19,
-    0x00, 0x06, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFC, 0x15, 0x55, 0x6F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07,
-    0xF5, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0x00, 0x15, 0x40, 0x0F, 0xFF, 0xC0,
-    0xFF, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2A, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3C, 0x01, 0xA4,
-    0x0F, 0xD0, 0xFD, 0x0B, 0xE0, 0x3E, 0x02, 0xD0, 0x00, 0x00, 0x69, 0x00, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0xC0, 0x0F, 0xD7, 0xF0, 0x2F, 0x00, 0xFC, 0x78, 0x00, 0x2D, 0x01, 0x40, 0x01, 0x43, 0xFF,
-    0x00, 0xE2, 0xFF, 0xFE, 0xF4, 0xF0, 0x7F, 0xFC, 0x34, 0x01, 0xA8, 0x00, 0xAA, 0xAA, 0xAF, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55,
-    0x55, 0x55, 0x24, 0x00, 0x18, 0x3C, 0x00, 0x3C, 0x2F, 0xAA, 0xF8, 0x0F, 0xFF, 0xE0, 0x01, 0xBE,
-    0x40, 0x14, 0xBE, 0xBE, 0x7D, 0x00, 0x10, 0x00, 0x4B, 0xC0, 0x7D, 0xBD, 0x07, 0xE7, 0xC0, 0x3C,
-    0x15, 0x01, 0xFF, 0x81, 0x6F, 0x40, 0x2E, 0x00, 0xF4, 0x2F, 0xC0, 0xF4, 0x03, 0xC0, 0x05, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x3E, 0x7D, 0xB4, 0x1E, 0xB0, 0x0E, 0x78, 0x2E, 0x3F, 0xFC, 0x0B, 0xE0,
-    0x00, 0xA4, 0x1A, 0x40, 0xFD, 0x0F, 0xD0, 0x7E, 0x0B, 0xE0, 0x3F, 0x03, 0xE0, 0x2F, 0x02, 0xE0,
-    0x0E, 0x00, 0xE0, 0x00, 0x64, 0x00, 0x19, 0x3E, 0x00, 0xBC, 0x0F, 0xC3, 0xF0, 0x07, 0xFF, 0xC0,
-    0x01, 0xFF, 0x40, 0x00, 0xBE, 0x00, 0x14, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x00, 0x50, 0x05, 0xF8,
-    0x2F, 0xF8, 0x2F, 0xF8, 0x2F, 0xF8, 0x2F, 0xF8, 0x2F, 0x00, 0x00, 0x2A, 0x02, 0xA0, 0x0F, 0xD0,
-    0xFD, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0x81, 0xF4, 0x01, 0xF0, 0x1F, 0x00, 0x0E, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x24, 0x28, 0x18, 0x3C, 0x00,
-    0x3C, 0x2F, 0xAA, 0xF8, 0x0F, 0xFF, 0xE0, 0x01, 0xBE, 0x40, 0x00, 0x6A, 0x00, 0x0B, 0xFF, 0xE0,
-    0x1F, 0xEB, 0xF8, 0x3D, 0x00, 0x3C, 0x38, 0x00, 0x2C, 0x02, 0xC0, 0x7C, 0x0B, 0xC0, 0xF8, 0x2F,
-    0x43, 0xF0, 0x3F, 0x07, 0xF0, 0x15, 0x00, 0x0F, 0xD0, 0xFC, 0x1F, 0xC1, 0xF8, 0x2F, 0x03, 0xF0,
-    0x3D, 0x07, 0xC0, 0x14, 0x00, 0x7E, 0x07, 0xF0, 0x3F, 0x02, 0xF4, 0x1F, 0x80, 0xFC, 0x0B, 0xC0,
-    0x3C, 0x01, 0x40, 0x0B, 0xD0, 0xFD, 0x0F, 0xC1, 0xF8, 0x2F, 0x43, 0xF0, 0x3E, 0x03, 0xC0, 0x14,
-    0x00, 0x2A, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x2C, 0x00, 0xA8, 0x02,
-    0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0x2F, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1F, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x1F, 0x01, 0xF0, 0x05, 0x00, 0x0F, 0x40, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0xF4, 0x05,
-    0x00, 0x15, 0x55, 0x4B, 0xFF, 0xFC, 0x6A, 0xAB, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
-    0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x02, 0x80, 0x00, 0x14, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC,
-    0x07, 0xF4, 0x7F, 0xD0, 0x7F, 0x00, 0x10, 0x00, 0x05, 0x3F, 0x78, 0xB0, 0xB0, 0x78, 0x2F, 0x05,
-    0x01, 0x40, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xBF, 0xFE, 0x7F, 0xFD, 0x15, 0x54, 0xBF, 0xFE,
-    0x6B, 0xE9, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x6F, 0xF9,
-    0xBF, 0xFE, 0x17, 0xD4, 0x03, 0xC0, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x50,
-    0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x03, 0xFA, 0xFE, 0xFF, 0xCB, 0xE4, 0x54, 0x0F, 0x80,
-    0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xFC, 0x0B, 0xFA, 0x7F, 0xF1, 0xBE, 0x3C, 0xBE, 0xBE, 0x3C,
-    0x10, 0x00, 0x4B, 0xC0, 0x7D, 0xBD, 0x07, 0xE7, 0xC0, 0x3C, 0x00, 0x00, 0x1F, 0xF4, 0x3E, 0x7D,
-    0xB4, 0x1E, 0xB0, 0x0E, 0x78, 0x2E, 0x3F, 0xFC, 0x0B, 0xE0, 0x0F, 0xC0, 0xF8, 0x1F, 0x42, 0xE0,
-    0x3C, 0x01, 0x00, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x7C, 0x7F,
-    0xF8, 0x3F, 0xD0, 0x01, 0x00, 0xF4, 0x2E, 0x07, 0xC0, 0xB8, 0x0B, 0xC0, 0xBF, 0xA3, 0xFF, 0x01,
-    0x40, 0x14, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x00, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA,
-    0xAF, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0x50, 0x00, 0x05, 0x78, 0x0F, 0x01,
-    0xD3, 0xC0, 0xF0, 0x3C, 0x2F, 0xFF, 0xFF, 0x80, 0x7E, 0x0B, 0xD0, 0x64, 0x00, 0x19, 0x3E, 0x00,
-    0xBC, 0x0F, 0xC3, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xD7, 0xF0, 0x2F, 0x01, 0xF8, 0x78, 0x00, 0x2D, 0x24,
-    0x00, 0x18, 0x3C, 0x00, 0x3C, 0x2F, 0xAA, 0xF4, 0x0F, 0xFF, 0xE0, 0x01, 0xBE, 0x40, 0x00, 0x6A,
-    0x00, 0x0B, 0xFF, 0xE0, 0x1F, 0xEB, 0xF8, 0x3D, 0x00, 0x3C, 0x38, 0x00, 0x2C, 0x01, 0x50, 0x01,
-    0x80, 0xBF, 0xD0, 0x3C, 0x2F, 0xFF, 0xEF, 0x83, 0xC0, 0xBF, 0xF0, 0x38, 0x00, 0xB8, 0x00, 0xAA,
-    0xAA, 0xAF, 0xFF, 0xFF, 0xBF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x01,
-    0x40, 0x02, 0x0B, 0xFD, 0x02, 0xC7, 0xFF, 0xFA, 0xF2, 0xD0, 0xBF, 0xF0, 0xA0, 0x02, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x1F, 0xE0, 0x0B, 0xF8, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x7E,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x50, 0xFC, 0x2E, 0x0F, 0x0F, 0x2E, 0xFC, 0x50, 0x50, 0x00,
-    0x05, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xFE, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA, 0xAB, 0xD7, 0x80, 0x00,
-    0x2D, 0x78, 0x00, 0x02, 0xD7, 0x80, 0x00, 0x2D, 0x7F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA8, 0x0B,
-    0xF5, 0xFE, 0x02, 0xFB, 0xFE, 0xF8, 0x3C, 0x0F, 0x03, 0xC7, 0x40, 0xB0, 0x1D, 0x14, 0x14, 0x3D,
-    0x7C, 0x2F, 0xF4, 0x0B, 0xE0, 0x1F, 0xF4, 0x3D, 0xBC, 0x14, 0x24, 0x06, 0xC2, 0xFC, 0x3D, 0x03,
-    0xD0, 0x2F, 0x00, 0xF8, 0x07, 0xC0, 0xBC, 0x3F, 0x43, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xFF,
-    0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x2A, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0xF8,
-    0x00, 0x2C, 0x00, 0xA8, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0x2F, 0x00, 0x38, 0x00, 0x01, 0x50,
-    0x01, 0x80, 0xBF, 0xD0, 0x3C, 0x2F, 0xFF, 0xEF, 0x83, 0xC0, 0xBF, 0xF0, 0x38, 0x00, 0xB8, 0x00,
-    0x7F, 0x07, 0xFC, 0x07, 0xC0, 0x7C, 0x0F, 0x40, 0x90, 0x00, 0x0F, 0xD0, 0x01, 0x07, 0xF0, 0x03,
-    0xF2, 0xF5, 0xF4, 0xFC, 0xFC, 0x7E, 0x2E, 0x3D, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x14, 0x03, 0xD0,
-    0x3D, 0x03, 0xE0, 0x3F, 0xE0, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA,
-    0xAA, 0xBD, 0x7C, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x3D, 0x14, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x50, 0x05,
-    0xF8, 0x2F, 0xF8, 0x2F, 0xF8, 0x2F, 0xF8, 0x2F, 0xF8, 0x2F, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC,
-    0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x01, 0x40, 0x00, 0x15, 0x3C, 0x18, 0x0B,
-    0xFF, 0x83, 0xC2, 0xFF, 0xFE, 0xF8, 0x3C, 0x2F, 0xFF, 0x03, 0x87, 0xCA, 0x80, 0x00, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x50, 0x00, 0x07, 0xF8, 0x03, 0xC1, 0xFF, 0xF9, 0xB8, 0x3D, 0x1F, 0xFF, 0x43, 0xC0, 0x2F, 0xD0,
-    0x00, 0x05, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xA0, 0x00, 0x06, 0x80,
-    0x09, 0x2F, 0xF8, 0x2D, 0x3E, 0xBF, 0xFC, 0x74, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1E,
-    0x3F, 0xFE, 0x7D, 0x78, 0x7F, 0xFC, 0x70, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x41, 0xD0, 0x2F,
-    0xFF, 0xF8, 0x7F, 0xFF, 0xFD, 0x0F, 0x41, 0xF0, 0x02, 0x41, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x0B, 0xE0, 0x2F, 0xF8, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xBF, 0xC0,
-    0x2F, 0xF8, 0x03, 0xFE, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x53, 0xC5, 0x00, 0x0F, 0x50, 0x00, 0xB2, 0x8E,
-    0x00, 0x05, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x09, 0x00, 0x50, 0x70, 0x00, 0x00, 0x0E, 0x05, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x90, 0x00, 0x00, 0x03, 0x0F, 0xF0, 0xD0, 0x00, 0x00, 0x07, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xA0, 0x70, 0x00, 0x00, 0x0E, 0x0A, 0x00, 0x70, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB1, 0x4E, 0x00, 0x00,
-    0xF0, 0x00, 0x63, 0xC9, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0x00, 0x0F,
-    0x40, 0x7F, 0x80, 0xBE, 0x0B, 0xE7, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xE1, 0xD0, 0xB4,
-    0x1E, 0x03, 0xF0, 0x2C, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0x96, 0xF8, 0x3C, 0x00, 0x3C,
-    0x14, 0x3C, 0x14, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x28, 0x00, 0x08, 0x20, 0x3E, 0xFC,
-    0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xF8, 0x1D, 0x38, 0x00, 0x00, 0x00, 0x50, 0x7E, 0x7F, 0x8F, 0xC0,
-    0xBF, 0x40, 0xBE, 0x00, 0xA0, 0x40, 0x0F, 0x90, 0x3F, 0xD0, 0x7E, 0x1F, 0xEB, 0xE0, 0xA0, 0x00,
-    0x20, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x1F, 0xE0, 0xBF, 0x00, 0x2F, 0x4F, 0xF0, 0x0B, 0xF5,
-    0xE7, 0x83, 0xF4, 0x2C, 0x3C, 0x34, 0x03, 0x81, 0xD0, 0x00, 0x2E, 0x07, 0xE0, 0x3C, 0x0B, 0x03,
-    0xC7, 0xD1, 0x90, 0x14, 0x7E, 0xBF, 0x7D, 0x00, 0x02, 0x80, 0x13, 0xC4, 0x3F, 0xFC, 0x7F, 0xFD,
-    0x0B, 0xE0, 0x2E, 0xB8, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x5F, 0xE0, 0x3F, 0xBF, 0xEF,
-    0xC7, 0x80, 0xF0, 0x2C, 0x74, 0x0F, 0x01, 0xD7, 0x80, 0xF0, 0x2C, 0x3F, 0xBF, 0xEF, 0xC0, 0xBF,
-    0x0F, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x38, 0x00, 0x70,
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x93, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xBF, 0x90, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xAF,
-    0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x93, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0xBF, 0x90, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xAF, 0xFF, 0xF4,
-    0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x50, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x1E, 0x3F, 0xFB, 0xFF, 0xFF, 0xEA, 0xAF, 0xC7,
-    0x80, 0x00, 0x1B, 0xFF, 0xFF, 0xF4, 0xA0, 0x00, 0x00, 0x01, 0x6A, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xF9, 0x40, 0x16, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x04, 0x1C, 0x00, 0x0D, 0x0B, 0xFD, 0x38, 0x0D, 0x30, 0x0D, 0x3D, 0xBD, 0x05,
-    0x40, 0x07, 0xF4, 0x1C, 0x1D, 0x34, 0x0A, 0x3F, 0xFF, 0x34, 0x00, 0x28, 0x00, 0x0F, 0xA9, 0x01,
-    0x54, 0x11, 0xC0, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC1, 0x00, 0x0B, 0xF4, 0x0B, 0x07, 0x43, 0x00,
-    0xB1, 0xC0, 0x1C, 0x70, 0x07, 0x0D, 0x02, 0x81, 0xEB, 0xC0, 0x05, 0x40, 0x30, 0x0A, 0x30, 0x0A,
-    0x30, 0x0A, 0x30, 0x0A, 0x30, 0x0A, 0x34, 0x0E, 0x2E, 0xBE, 0x05, 0x40, 0x0B, 0xF0, 0xF0, 0x47,
-    0x00, 0x1C, 0x00, 0x70, 0x00, 0xD0, 0x01, 0xEA, 0x40, 0x54, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x0B, 0xEA, 0x38, 0x1E, 0x70, 0x0E, 0x70, 0x0A, 0x70, 0x0A, 0x34, 0x0E, 0x2E, 0xBE, 0x01, 0x40,
-    0x30, 0x00, 0x34, 0x00, 0x34, 0x00, 0x36, 0xF8, 0x3C, 0x0E, 0x34, 0x0B, 0x34, 0x0B, 0x34, 0x0B,
-    0x34, 0x0B, 0x34, 0x0B, 0x10, 0x01, 0x67, 0xF1, 0xFD, 0x1E, 0x0B, 0x82, 0xC7, 0x01, 0xC0, 0x31,
-    0xC0, 0x70, 0x0C, 0x70, 0x1C, 0x03, 0x1C, 0x07, 0x00, 0xC7, 0x01, 0xC0, 0x30, 0x40, 0x10, 0x04,
-    0x67, 0xCB, 0xD0, 0xB0, 0x0B, 0x00, 0xB0, 0x0B, 0x00, 0xB0, 0x01, 0x00, 0x00, 0x00, 0xD0, 0x2F,
-    0xE0, 0xD0, 0x0D, 0x00, 0xD0, 0x0D, 0x00, 0xD0, 0x0B, 0x90, 0x15, 0x30, 0x07, 0x0D, 0x03, 0x81,
-    0xC0, 0xC0, 0x34, 0xB0, 0x0A, 0x34, 0x00, 0xDC, 0x00, 0x3D, 0x00, 0x01, 0x00, 0x24, 0x09, 0x03,
-    0x4B, 0x00, 0x77, 0x00, 0x0B, 0x40, 0x03, 0xE0, 0x03, 0x8E, 0x02, 0xC0, 0xD0, 0x40, 0x04, 0x02,
-    0xA4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA,
-    0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x01,
-    0x80, 0x14, 0x00, 0x3F, 0x07, 0xD0, 0x03, 0xF0, 0xBE, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFE, 0xAA, 0xAA, 0x9F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x05, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF5, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x01, 0x55, 0xFF, 0x00, 0x00, 0xFC, 0x0F, 0xFF, 0xF0,
-    0x00, 0x03, 0xF0, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFE, 0xAA, 0xFD, 0x07, 0xFD,
-    0x00, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xEA, 0xAA,
-    0xAA, 0x40, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0x95, 0x5B, 0xD0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0xAB,
-    0xF8, 0x1F, 0xC0, 0x00, 0x14, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95, 0x5F, 0xF4, 0x7F, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0xBC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
-    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
-    0xFC, 0x00, 0x00, 0x0B, 0x87, 0xC3, 0xF2, 0xF4, 0xFC, 0xBD, 0x19, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x85, 0x5B, 0xF0, 0xBF, 0xFE, 0x0B,
-    0xFF, 0x40, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x7F, 0xAA, 0x50, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x1B, 0xFC, 0x00, 0x3F, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0xBC, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFC, 0xAB, 0xF8, 0x00,
-    0x00, 0x7F, 0xAA, 0xBF, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFE, 0x55, 0x55, 0x5F, 0xE5, 0x5A, 0xFF, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xCF, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x8F, 0xC0, 0x00, 0x00, 0xFE, 0xAA,
-    0xBF, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x15, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF5, 0x00, 0x7F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00,
-    0x07, 0xF0, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x07, 0xF0, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x0B, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x0F, 0xC0,
-    0x00, 0x3F, 0x80, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x00, 0x3F,
-    0x8F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x02, 0xF7, 0xFF, 0xC0, 0x00, 0x1F, 0x8F, 0xFF, 0x00, 0x00, 0xFC,
-    0x3F, 0xFC, 0x00, 0x0B, 0xD0, 0xFF, 0xF0, 0x00, 0x3E, 0x03, 0xFF, 0xC0, 0x03, 0xF0, 0x0F, 0xFF,
-    0x00, 0x1F, 0x40, 0x3F, 0xFC, 0x00, 0xFC, 0x00, 0xFF, 0xF0, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0x7E,
-    0x00, 0x0F, 0xFF, 0x03, 0xF0, 0x00, 0x3F, 0xFC, 0x2F, 0x00, 0x00, 0xFF, 0xF1, 0xF8, 0x00, 0x03,
-    0xFF, 0xCF, 0xC0, 0x00, 0x0F, 0xFF, 0xBD, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x00,
-    0x2F, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0xBE, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x7F,
-    0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0,
-    0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x02, 0xAF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00,
-    0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3,
-    0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00,
-    0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xFA, 0xAA, 0xAA, 0xAF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00,
-    0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00,
-    0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xFF, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x55, 0x40, 0x00,
-    0xFF, 0xFF, 0xFE, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x5F, 0xF8, 0xFD, 0x00, 0x02, 0xFC,
-    0xFD, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x7E, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x7F,
-    0xBD, 0x00, 0x00, 0xBE, 0xBD, 0x00, 0x00, 0xFD, 0xBD, 0x00, 0x07, 0xFC, 0xBE, 0xAA, 0xBF, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE9, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x00, 0x0B, 0xF8, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00,
-    0x0F, 0xCF, 0xC0, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0x7F, 0x0F, 0xFA, 0xAB, 0xFE, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F,
-    0x00, 0x00, 0x7F, 0x8F, 0xC0, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00,
-    0xFF, 0x3F, 0xAA, 0xAB, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF9, 0x00, 0xBF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBD,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0x6B, 0xFA, 0xAA, 0xAA, 0xAF, 0xEA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xEA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x07,
-    0xF0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x02, 0xF8,
-    0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xE0, 0x07, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x7E, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xF0, 0x07, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x03, 0xF8,
-    0x00, 0x7E, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00,
-    0x07, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x07,
-    0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFE,
-    0x00, 0xFE, 0x96, 0xBF, 0xE0, 0x14, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x06, 0xAB, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00,
-    0x7F, 0x8B, 0xE5, 0x56, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0x80, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x02, 0xF7, 0xFF,
-    0xC0, 0x00, 0x1F, 0x8F, 0xFF, 0x00, 0x00, 0xFC, 0x3F, 0xFC, 0x00, 0x0B, 0xD0, 0xFF, 0xF0, 0x00,
-    0x3E, 0x03, 0xFF, 0xC0, 0x03, 0xF0, 0x0F, 0xFF, 0x00, 0x1F, 0x40, 0x3F, 0xFC, 0x00, 0xFC, 0x00,
-    0xFF, 0xF0, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0x7E, 0x00, 0x0F, 0xFF, 0x03, 0xF0, 0x00, 0x3F, 0xFC,
-    0x2F, 0x00, 0x00, 0xFF, 0xF1, 0xF8, 0x00, 0x03, 0xFF, 0xCF, 0xC0, 0x00, 0x0F, 0xFF, 0xBD, 0x00,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x2F, 0x40, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0xBD, 0xFF, 0xF0, 0x00, 0x07, 0xE3, 0xFF, 0xC0, 0x00, 0x3F, 0x0F, 0xFF, 0x00, 0x02, 0xF4,
-    0x3F, 0xFC, 0x00, 0x0F, 0x80, 0xFF, 0xF0, 0x00, 0xFC, 0x03, 0xFF, 0xC0, 0x07, 0xD0, 0x0F, 0xFF,
-    0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x03, 0xF0, 0x00, 0xFF, 0xF0, 0x1F, 0x80, 0x03, 0xFF, 0xC0, 0xFC,
-    0x00, 0x0F, 0xFF, 0x0B, 0xC0, 0x00, 0x3F, 0xFC, 0x7E, 0x00, 0x00, 0xFF, 0xF3, 0xF0, 0x00, 0x03,
-    0xFF, 0xEF, 0x40, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00,
-    0x07, 0xF0, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x07, 0xF0, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x0B, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x0F, 0xC0,
-    0x00, 0x3F, 0x80, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x00, 0x3F,
-    0x8F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00,
-    0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00,
-    0x2F, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x2A, 0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xFF, 0x00, 0x00, 0x03, 0xF3, 0xFF, 0x40,
-    0x00, 0x00, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFE, 0xF4, 0x00, 0x00, 0x0F, 0xBF, 0xFC, 0xF8, 0x00, 0x00, 0x1F, 0x3F, 0xFC, 0xFC, 0x00,
-    0x00, 0x3F, 0x3F, 0xFC, 0x7D, 0x00, 0x00, 0x3D, 0x3F, 0xFC, 0x3F, 0x00, 0x00, 0xBC, 0x3F, 0xFC,
-    0x2F, 0x00, 0x00, 0xF8, 0x3F, 0xFC, 0x1F, 0x80, 0x01, 0xF4, 0x3F, 0xFC, 0x0F, 0xC0, 0x02, 0xF0,
-    0x3F, 0xFC, 0x0B, 0xD0, 0x03, 0xE0, 0x3F, 0xFC, 0x03, 0xE0, 0x0B, 0xC0, 0x3F, 0xFC, 0x03, 0xF0,
-    0x0F, 0xC0, 0x3F, 0xFC, 0x01, 0xF4, 0x1F, 0x40, 0x3F, 0xFC, 0x00, 0xFC, 0x2F, 0x00, 0x3F, 0xFC,
-    0x00, 0xBC, 0x3E, 0x00, 0x3F, 0xFC, 0x00, 0x7E, 0x7D, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
-    0x3F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x01, 0xF7, 0xF0, 0x00,
-    0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x01,
-    0xFB, 0xF0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x7E, 0xFC,
-    0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x07, 0xEF, 0xFA, 0xAA, 0xAA, 0xBF, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x1F,
-    0xBF, 0x00, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x07, 0xEF, 0xC0,
-    0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00,
-    0x07, 0xEF, 0xC0, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFA, 0x5B, 0xFF,
-    0x00, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0x80, 0x00, 0x00,
-    0x7F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0xD0, 0x00,
-    0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x00,
-    0x00, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0xBF,
-    0x40, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x95, 0x6F, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00,
-    0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF,
-    0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00,
-    0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xFF, 0xA4, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x0B, 0xF8, 0xFC, 0x00, 0x02, 0xFC,
-    0xFC, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xFD,
-    0xFC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x02, 0xFC, 0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xAA, 0x90, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFE, 0xAA, 0xFD, 0x07, 0xFD,
-    0x00, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0x95, 0x5B, 0xD0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x54,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0x0F, 0xC2, 0xF8, 0x00,
-    0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00,
-    0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x02,
-    0xF4, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0xAB, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xF9, 0x7F,
-    0x5B, 0xFF, 0x00, 0x2F, 0xD0, 0x0F, 0xC0, 0x1F, 0xF0, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFE, 0x0B,
-    0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xBD, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x5F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xD3, 0xF0,
-    0x00, 0x3F, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x2F, 0x80, 0x03, 0xF0, 0x00,
-    0x7F, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0xBF, 0x40, 0x3F, 0x00, 0x7F, 0xC0, 0x0B, 0xFE,
-    0x5F, 0xD6, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x1F,
-    0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x02, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x83,
-    0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00,
-    0xBD, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0B, 0xE0,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x00,
-    0x01, 0xFC, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xEA, 0xAA, 0xAA, 0xBF, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7D, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC,
-    0xBD, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00,
-    0x00, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0xC7,
-    0xE0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x01, 0xFC, 0x1F, 0xFE, 0xAB,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x0F, 0xDF, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFD,
-    0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xDF, 0xC0,
-    0x00, 0x07, 0xE0, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x07, 0xE0,
-    0x00, 0x03, 0xF7, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF7,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x7F, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x7F, 0xEA, 0xAA, 0xBF, 0xEA,
-    0xAA, 0xAF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF8,
-    0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x80,
-    0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x0F,
-    0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x80, 0xFC,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x0F, 0xC0,
-    0x00, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x80, 0xFC, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00,
-    0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x0B,
-    0xD0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x7E, 0x03, 0xFA, 0xAA, 0xAB, 0xFE, 0xAA, 0xAB, 0xFE, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xA9, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x06,
-    0xFF, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0xFE,
-    0xAA, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF3, 0xFA, 0xA9, 0x40, 0x00, 0x0F, 0xCF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFC, 0xFD, 0x00, 0x1F, 0xF4, 0x03, 0xF3, 0xF0, 0x00, 0x0B, 0xF0, 0x0F, 0xCF, 0xC0,
-    0x00, 0x0F, 0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0xFC, 0x00, 0x00, 0xBD, 0x03, 0xF3,
-    0xF0, 0x00, 0x02, 0xF4, 0x0F, 0xCF, 0xC0, 0x00, 0x0F, 0xD0, 0x3F, 0x3F, 0x00, 0x00, 0x7F, 0x00,
-    0xFC, 0xFC, 0x00, 0x07, 0xF8, 0x03, 0xF3, 0xFA, 0xAA, 0xFF, 0xC0, 0x0F, 0xCF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0x50, 0x00,
-    0xBF, 0xFF, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xE0, 0xBD, 0x00, 0x1F, 0xF4, 0xBD, 0x00, 0x02, 0xFC,
-    0xBD, 0x00, 0x00, 0xFD, 0xBD, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0xBE, 0xBD, 0x00, 0x00, 0xBD,
-    0xBD, 0x00, 0x00, 0xFD, 0xBD, 0x00, 0x01, 0xFC, 0xBD, 0x00, 0x07, 0xF8, 0xBE, 0xAA, 0xBF, 0xF0,
-    0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8,
-    0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF9, 0x6B, 0xFF, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2A, 0xAA, 0xAA,
-    0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFC,
-    0x07, 0xE5, 0x56, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xF0, 0x00, 0x1F, 0xFE, 0x6B, 0xFF,
-    0x00, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x0F,
-    0xC0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x1F, 0x80,
-    0x00, 0x00, 0x03, 0xF3, 0xFE, 0xAF, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x03,
-    0xF3, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xE3, 0xF0, 0x01,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x07, 0xF8,
-    0x00, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x7F, 0xE5, 0x5B, 0xFC, 0x03, 0xF0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xBF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-    0x40, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F,
-    0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xF0,
-    0x00, 0x0F, 0xC0, 0x3F, 0xE5, 0x55, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0F, 0xE5, 0x5F, 0xC0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xE0,
-    0x00, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x0F, 0xC1,
-    0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFD, 0x02, 0xF9, 0x57, 0xFC, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x1A, 0xBF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xE5, 0x5F, 0xCF, 0xE0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFD, 0xF8, 0x00,
-    0x07, 0xF7, 0xE0, 0x00, 0x2F, 0xDF, 0xC0, 0x01, 0xFF, 0x3F, 0x80, 0x2F, 0xFC, 0x7F, 0xFF, 0xF2,
-    0xF0, 0x7F, 0xFE, 0x07, 0xC0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xA5, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x55, 0x00,
-    0x02, 0xF1, 0xFF, 0xFE, 0x00, 0x3F, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0x40, 0x1F, 0xF0, 0x3F, 0xC0,
-    0x00, 0x3F, 0x43, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x00, 0xFC, 0x2F, 0x40, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x7F, 0x00,
-    0x3F, 0xD0, 0x6F, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xAA, 0xAF, 0xF0, 0x3F, 0x00,
-    0x03, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x03, 0xF4, 0x3F, 0xAA,
-    0xAF, 0xD0, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0x00, 0x07, 0xF8, 0x3F, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0x3F, 0x55,
-    0x6F, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0x3F, 0xAA, 0xAA, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xAA, 0xAF, 0xC0, 0x00,
-    0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x3D,
-    0x00, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x0B,
-    0xC0, 0x02, 0xF4, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x5F, 0xE5, 0x55, 0x5F, 0xE5,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0xBC,
-    0x00, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x68, 0x00,
-    0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x07,
-    0xF9, 0x1B, 0xF4, 0x0F, 0xD0, 0x01, 0xFC, 0x2F, 0x80, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x7E, 0x3F,
-    0x00, 0x00, 0x7F, 0x7F, 0xAA, 0xAA, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xAA, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x07, 0xFD, 0x01, 0xBC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00,
-    0x00, 0x54, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0,
-    0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x03,
-    0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x2F, 0x40,
-    0x00, 0x01, 0xF9, 0x7F, 0x5B, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x02, 0xF8,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x03, 0xF0, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x03, 0xF0, 0x00,
-    0x7F, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x7F,
-    0xFF, 0xFF, 0x03, 0xE5, 0x1B, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x02, 0xF8, 0x02, 0xAA, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFD,
-    0xF9, 0x00, 0x7F, 0xCF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x3E, 0x00,
-    0x00, 0xFE, 0x3E, 0x00, 0x02, 0xFF, 0x3E, 0x00, 0x03, 0xFF, 0x3E, 0x00, 0x0B, 0xFF, 0x3E, 0x00,
-    0x1F, 0x7F, 0x3E, 0x00, 0x3F, 0x3F, 0x3E, 0x00, 0x7C, 0x3F, 0x3E, 0x00, 0xF8, 0x3F, 0x3E, 0x02,
-    0xF0, 0x3F, 0x3E, 0x07, 0xD0, 0x3F, 0x3E, 0x0F, 0xC0, 0x3F, 0x3E, 0x1F, 0x40, 0x3F, 0x3E, 0x3E,
-    0x00, 0x3F, 0x3E, 0xBC, 0x00, 0x3F, 0x3F, 0xF8, 0x00, 0x3F, 0x3F, 0xF0, 0x00, 0x3F, 0x3F, 0xD0,
-    0x00, 0x3F, 0x3F, 0xC0, 0x00, 0x3F, 0x01, 0xA0, 0x02, 0x90, 0x02, 0xF0, 0x07, 0xD0, 0x00, 0xFD,
-    0x1F, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0xFE, 0x3E, 0x00, 0x02, 0xFF, 0x3E, 0x00, 0x03, 0xFF, 0x3E, 0x00,
-    0x0B, 0xFF, 0x3E, 0x00, 0x1F, 0x7F, 0x3E, 0x00, 0x3F, 0x3F, 0x3E, 0x00, 0x7C, 0x3F, 0x3E, 0x00,
-    0xF8, 0x3F, 0x3E, 0x02, 0xF0, 0x3F, 0x3E, 0x07, 0xD0, 0x3F, 0x3E, 0x0F, 0xC0, 0x3F, 0x3E, 0x1F,
-    0x40, 0x3F, 0x3E, 0x3E, 0x00, 0x3F, 0x3E, 0xBC, 0x00, 0x3F, 0x3F, 0xF8, 0x00, 0x3F, 0x3F, 0xF0,
-    0x00, 0x3F, 0x3F, 0xD0, 0x00, 0x3F, 0x3F, 0xC0, 0x00, 0x3F, 0x3E, 0x00, 0x01, 0xF8, 0x3F, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0xFD, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x3F, 0x57, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x3F, 0x00,
-    0x3F, 0x40, 0x3F, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x01, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x07, 0xEA, 0xAA, 0xF8, 0x02,
-    0xF0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0xF8,
-    0x03, 0xF0, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00,
-    0xF8, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x03, 0xE0, 0x3F, 0x00,
-    0x00, 0xFA, 0x6F, 0xC0, 0x00, 0x3E, 0xFF, 0xD0, 0x00, 0x0F, 0xBF, 0xD0, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x8F, 0xF4, 0x00, 0x00, 0x2F, 0xF3, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x3E, 0xF8, 0x00, 0x03, 0xEF, 0xCF, 0xAF, 0x00,
-    0x01, 0xF7, 0xF3, 0xE7, 0xD0, 0x00, 0xFC, 0xFC, 0xF8, 0xFC, 0x00, 0x7D, 0x3F, 0x3E, 0x1F, 0x40,
-    0x2F, 0x0F, 0xCF, 0x83, 0xE0, 0x0F, 0x83, 0xF3, 0xE0, 0xBC, 0x0B, 0xC0, 0xFC, 0xF8, 0x0F, 0x83,
-    0xE0, 0x3F, 0x3E, 0x03, 0xF1, 0xF4, 0x0F, 0xCF, 0x80, 0x7D, 0xFC, 0x03, 0xF3, 0xE0, 0x0F, 0xFD,
-    0x00, 0xFC, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x80, 0x0F, 0xCF, 0x80, 0x0B, 0xC0,
-    0x03, 0xF0, 0x3E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x55,
-    0x55, 0xBE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x95, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0xBF,
-    0x02, 0xF8, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0xFC, 0x7F, 0x00,
-    0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0xFD, 0x00,
-    0x0B, 0xF0, 0x07, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xAA, 0xAA, 0xFD,
-    0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD,
-    0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD,
-    0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD,
-    0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x42, 0xFF, 0xE0, 0x03, 0xD7, 0xFF, 0xFF, 0x00, 0xFF, 0xE5, 0x6F, 0xF0, 0x3F, 0xD0, 0x00,
-    0xFE, 0x0F, 0xE0, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00,
-    0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x7E, 0x3F,
-    0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x03, 0xF8,
-    0x3F, 0xF8, 0x07, 0xFC, 0x0F, 0xAF, 0xFF, 0xFC, 0x03, 0xE1, 0xFF, 0xF8, 0x00, 0xFC, 0x01, 0x40,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0x55, 0xB4, 0x0F, 0xE0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0x01, 0xA0, 0x0B,
-    0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xF6, 0xAA, 0xFE, 0xAA, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x1F,
-    0xC0, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x02, 0xF4, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x01, 0xF4, 0x7E,
-    0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x01,
-    0xAF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0x5F, 0xDB, 0xFD, 0x00, 0xBF, 0x40, 0xF8, 0x0B, 0xF4, 0x1F,
-    0xC0, 0x0F, 0x80, 0x2F, 0xC3, 0xF4, 0x00, 0xF8, 0x00, 0xFD, 0x3F, 0x00, 0x0F, 0x80, 0x0B, 0xE7,
-    0xF0, 0x00, 0xF8, 0x00, 0x7F, 0x7E, 0x00, 0x0F, 0x80, 0x03, 0xF7, 0xE0, 0x00, 0xF8, 0x00, 0x3F,
-    0x7F, 0x00, 0x0F, 0x80, 0x03, 0xF3, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x3F, 0x40, 0x0F, 0x80, 0x0F,
-    0xD2, 0xFC, 0x00, 0xF8, 0x01, 0xFC, 0x0F, 0xE0, 0x0F, 0x80, 0x7F, 0x80, 0x3F, 0xD0, 0xF8, 0x6F,
-    0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x6F, 0xD4,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x3F,
-    0x40, 0xBE, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x2F, 0x8B,
-    0xE0, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00,
-    0xBE, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0xBE,
-    0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0,
-    0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x02,
-    0xF4, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0xBD, 0x00,
-    0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x3F, 0x00,
-    0x00, 0xBD, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x0F, 0xD5, 0x55, 0x7F,
-    0x94, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0xFC, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x3F, 0xBF, 0x00, 0x01, 0xFC, 0xFF, 0xAA, 0xBF, 0xF1, 0xFF, 0xFF, 0xFF, 0xC0, 0x6F, 0xF9, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0F, 0xC7, 0xE0, 0x00,
-    0x2F, 0x40, 0x00, 0xFC, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x2F, 0x40, 0x00,
-    0xFC, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x7E, 0x00,
-    0x02, 0xF4, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x7E, 0x00, 0x02, 0xF4, 0x00,
-    0x0F, 0xC7, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC7, 0xE0,
-    0x00, 0x2F, 0x40, 0x00, 0xFC, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x2F, 0x40,
-    0x00, 0xFC, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC7, 0xF5, 0x55, 0x7F, 0x95, 0x55, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x02, 0xF4,
-    0x00, 0x0F, 0x80, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02,
-    0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x55, 0x57, 0xF9, 0x55, 0x6F, 0xD4, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x6A, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x1B, 0xF8, 0x00,
-    0x2F, 0x40, 0x01, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0xFD, 0x00, 0x2F,
-    0x40, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x02, 0xFC, 0x00, 0x2F, 0x95, 0x6F, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x00,
-    0x07, 0xD3, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00,
-    0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x07, 0xD3, 0xF5, 0x54, 0x00, 0x01, 0xF4, 0xFF, 0xFF, 0xF8, 0x00,
-    0x7D, 0x3F, 0xFF, 0xFF, 0xD0, 0x1F, 0x4F, 0xC0, 0x07, 0xFC, 0x07, 0xD3, 0xF0, 0x00, 0x3F, 0x41,
-    0xF4, 0xFC, 0x00, 0x0B, 0xE0, 0x7D, 0x3F, 0x00, 0x01, 0xF8, 0x1F, 0x4F, 0xC0, 0x00, 0xBD, 0x07,
-    0xD3, 0xF0, 0x00, 0x7F, 0x01, 0xF4, 0xFD, 0x56, 0xFF, 0x80, 0x7D, 0x3F, 0xFF, 0xFF, 0x80, 0x1F,
-    0x4F, 0xFF, 0xFE, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF5, 0x50, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xD0, 0xFC, 0x00, 0x7F, 0xC3, 0xF0, 0x00, 0x3F, 0x4F,
-    0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x3F, 0x0F, 0xD5,
-    0x6B, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xF8, 0x03, 0x95, 0x6F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x05, 0x55, 0x5B, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF8, 0xA5, 0x06, 0xFF, 0x0B, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x3F, 0x00, 0x3F, 0xD5, 0x7F, 0xC0, 0x3F, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x3F, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0xFC,
-    0x3F, 0x57, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0xFC, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x01,
-    0xF8, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0xBE, 0x00, 0x07, 0xF0,
-    0x3F, 0x00, 0x3F, 0xD0, 0x6F, 0xC0, 0x3F, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFD,
-    0x0F, 0xFA, 0xAA, 0xFD, 0x2F, 0xC0, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD,
-    0x3F, 0x00, 0x00, 0xBD, 0x2F, 0x80, 0x00, 0xBD, 0x0F, 0xF9, 0x55, 0xBD, 0x07, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x7F, 0x00, 0xBD, 0x00, 0xFD, 0x00, 0xBD, 0x02, 0xF8, 0x00, 0xBD,
-    0x07, 0xF0, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0xBD, 0x7F, 0x00, 0x00, 0xBD,
-    0x00, 0x69, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x07, 0xF9, 0x1B, 0xF4, 0x0F, 0xD0, 0x01, 0xFC,
-    0x2F, 0x80, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7F, 0x7F, 0xAA, 0xAA, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xAA, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x01, 0xBC,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x0B, 0xC0, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x07, 0xF9, 0x1B, 0xF4, 0x0F, 0xD0, 0x01, 0xFC, 0x2F, 0x80, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x7E,
-    0x3F, 0x00, 0x00, 0x7F, 0x7F, 0xAA, 0xAA, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xAA,
-    0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x01, 0xBC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4,
-    0x00, 0x00, 0x54, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x06, 0xBF, 0xAA, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x16, 0x50, 0x00, 0x3F, 0x1F, 0xFF,
-    0xD0, 0x03, 0xFB, 0xFF, 0xFF, 0x80, 0x3F, 0xF4, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xE0, 0x3F,
-    0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x01, 0xAB, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0xA8,
-    0x00, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xAA, 0xAA, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0x55, 0xB4, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x01, 0xFF, 0xFF, 0xFD,
-    0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0x01, 0xA0, 0x0B, 0xFF, 0xFF, 0x80, 0x06,
-    0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0x83, 0xF9, 0x56, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0xB9, 0x00,
-    0x7F, 0x8B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00, 0x18, 0x1F, 0xC7, 0xF0,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC,
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x00, 0x18, 0x18, 0x3E, 0x3E,
-    0x3F, 0x3F, 0x3D, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x18,
-    0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00,
-    0x2F, 0x8A, 0x6F, 0xC3, 0xFF, 0xE0, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x95, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x1B, 0xF8, 0x00,
-    0xF8, 0x00, 0x2F, 0x40, 0x01, 0xFC, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0xF4, 0x00,
-    0x2F, 0x40, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0x40,
-    0x02, 0xF8, 0x9B, 0xF0, 0x00, 0x2F, 0x95, 0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFE, 0xAA, 0xAB, 0xFA, 0xAA,
-    0xFF, 0x43, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0xBF, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x0B,
-    0xD0, 0x00, 0xBF, 0x0F, 0xC0, 0x00, 0x2F, 0x95, 0x6F, 0xF4, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x40, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x06, 0xBF, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x16, 0x50,
-    0x00, 0x3F, 0x1F, 0xFF, 0xE0, 0x03, 0xFB, 0xFF, 0xFF, 0x80, 0x3F, 0xF4, 0x02, 0xFD, 0x03, 0xFC,
-    0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1A,
-    0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x01,
-    0xF8, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0xFD, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x3F, 0x57, 0xF0, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0xBE,
-    0x00, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x03,
-    0xF4, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFE, 0x3E, 0x00, 0x02, 0xFF, 0x3E, 0x00, 0x03,
-    0xFF, 0x3E, 0x00, 0x0B, 0xFF, 0x3E, 0x00, 0x1F, 0x7F, 0x3E, 0x00, 0x3F, 0x3F, 0x3E, 0x00, 0x7C,
-    0x3F, 0x3E, 0x00, 0xF8, 0x3F, 0x3E, 0x02, 0xF0, 0x3F, 0x3E, 0x07, 0xD0, 0x3F, 0x3E, 0x0F, 0xC0,
-    0x3F, 0x3E, 0x1F, 0x40, 0x3F, 0x3E, 0x3E, 0x00, 0x3F, 0x3E, 0xBC, 0x00, 0x3F, 0x3F, 0xF8, 0x00,
-    0x3F, 0x3F, 0xF0, 0x00, 0x3F, 0x3F, 0xD0, 0x00, 0x3F, 0x3F, 0xC0, 0x00, 0x3F, 0x01, 0xA0, 0x02,
-    0x90, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x06,
-    0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x7E,
-    0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x03, 0xF4,
-    0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x0F,
-    0xC0, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xD1, 0xF8, 0x00, 0x00, 0xFC,
-    0xBD, 0x00, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x06, 0xBF, 0xE0, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x3F, 0x00,
-    0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00,
-    0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00,
-    0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x00,
-    0x00, 0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x3F, 0x55, 0x55, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x02, 0x90, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xE3, 0xF0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x7F, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD1, 0xFC, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0xFC, 0x0B, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0x0B, 0xFF, 0x40, 0x02, 0xF4,
-    0x03, 0xF0, 0x00, 0xFD, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x1F, 0x8F, 0xC0, 0x03, 0xF0, 0x01,
-    0xFC, 0x02, 0xF0, 0xFD, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x3F, 0x07, 0xE0, 0x0B, 0xD0, 0x00, 0xBD,
-    0x07, 0xD0, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0xBC, 0x02, 0xF4, 0x1F, 0x80, 0x00, 0x3F, 0x0F,
-    0xC0, 0x0F, 0xC2, 0xF0, 0x00, 0x01, 0xF9, 0xF4, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0F, 0xEF, 0x00,
-    0x07, 0xFB, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xD7, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x3E,
-    0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x3F, 0x00, 0x01, 0xF8,
-    0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x1F, 0x80,
-    0xF8, 0x00, 0x1F, 0xC0, 0x02, 0xF4, 0x0F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x7F,
-    0xE0, 0x03, 0xE0, 0x07, 0xE0, 0x0F, 0xFF, 0x00, 0xBD, 0x00, 0x3F, 0x01, 0xF5, 0xF4, 0x0F, 0xC0,
-    0x01, 0xF4, 0x2F, 0x0F, 0xC1, 0xF8, 0x00, 0x0F, 0xC3, 0xD0, 0xBC, 0x3F, 0x00, 0x00, 0xBD, 0xBC,
-    0x03, 0xE7, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0x55, 0xFE, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xAA, 0x90,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xBF,
-    0xC0, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0x40, 0x00, 0x1F,
-    0x80, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0xFD,
-    0x00, 0x2F, 0x40, 0x00, 0xFF, 0x00, 0x0B, 0xEA, 0xAB, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x00, 0x6A, 0xFE, 0xAA, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0x54,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x55, 0x5F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0xFD,
-    0x0F, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x2F, 0xFE, 0xAB, 0xFC, 0xFC, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x63, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xBF,
-    0xEA, 0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0x6F, 0x3F, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x06, 0xFF, 0xF8, 0x3F, 0x00,
-    0x02, 0xFF, 0xFF, 0xD3, 0xF0, 0x00, 0xBF, 0x95, 0xBC, 0x3F, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0x55, 0xFE, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
-    0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xF9, 0x06,
-    0xD3, 0xF0, 0x00, 0x3F, 0xFF, 0xFD, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xE3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00,
-    0x0B, 0xD0, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xFE, 0xAA, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xF4, 0x3E, 0x0B,
-    0xD0, 0x00, 0x0F, 0xC0, 0xF8, 0x1F, 0xC0, 0x00, 0x7E, 0x03, 0xE0, 0x3F, 0x00, 0x03, 0xF0, 0x0F,
-    0x80, 0x7E, 0x00, 0x1F, 0xC0, 0x3E, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0xF8, 0x02, 0xF4, 0x03, 0xF0,
-    0x03, 0xE0, 0x07, 0xF0, 0x2F, 0x80, 0x0F, 0x80, 0x0F, 0xD0, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x87,
-    0xE0, 0x00, 0xF8, 0x00, 0x3F, 0x3F, 0x40, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0xF4, 0x00, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0x0F,
-    0x8B, 0xC0, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0xBD,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0x4F, 0xC7, 0xE0, 0x00,
-    0xFC, 0x3F, 0x0F, 0xC0, 0x0B, 0xD0, 0xFC, 0x1F, 0x80, 0x3F, 0x03, 0xF0, 0x3F, 0x01, 0xF8, 0x0F,
-    0xC0, 0xBD, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x02, 0xF6, 0xF4, 0x03, 0xF0, 0x07,
-    0xE0, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x1F,
-    0x80, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x00,
-    0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0xFF, 0xAA, 0xAB, 0xFA, 0xAB, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x83,
-    0xF0, 0xBE, 0x00, 0xFC, 0x00, 0x3F, 0x43, 0xF0, 0x3F, 0x00, 0xFC, 0x00, 0x7F, 0x03, 0xF0, 0x2F,
-    0x40, 0xFC, 0x00, 0xBD, 0x03, 0xF0, 0x1F, 0xC0, 0xFC, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xD0, 0xFC,
-    0x02, 0xF8, 0x03, 0xF0, 0x0B, 0xE0, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0xFC, 0x07, 0xF0,
-    0x03, 0xF0, 0x02, 0xF8, 0xFC, 0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xFC, 0xFC, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFD, 0xFC, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0xBF, 0x3E, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3E,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x3E, 0x00, 0x03, 0xF3, 0xE0,
-    0x00, 0x3E, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x3E, 0x00, 0x0B, 0xC1, 0xF8, 0x00, 0x3E, 0x00, 0x0F,
-    0x80, 0xFC, 0x00, 0x3F, 0x55, 0x6F, 0x95, 0xBD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3E, 0x00, 0xFC, 0x3E, 0x1F, 0x80, 0x3E, 0x00, 0xF8, 0x3E, 0x0F,
-    0xC0, 0x3E, 0x02, 0xF4, 0x3E, 0x07, 0xD0, 0x3E, 0x03, 0xF0, 0x3E, 0x03, 0xF0, 0x3E, 0x07, 0xD0,
-    0x3E, 0x02, 0xF4, 0x3E, 0x0F, 0xC0, 0x3E, 0x00, 0xF8, 0x3E, 0x1F, 0x80, 0x3E, 0x00, 0xFC, 0x3E,
-    0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBD, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x7E, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xFB, 0xFE, 0x00, 0x00, 0xFD, 0x07, 0xE0, 0x3F, 0x40, 0x02, 0xF8, 0x07, 0xE0, 0x1F, 0xC0, 0x03,
-    0xF0, 0x07, 0xE0, 0x0F, 0xD0, 0x07, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x0B, 0xD0, 0x07, 0xE0, 0x03,
-    0xF0, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF4, 0x1F, 0xC0, 0x07, 0xE0, 0x02, 0xF8, 0x2F, 0x80, 0x07,
-    0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xBD, 0x7E,
-    0x00, 0x07, 0xE0, 0x00, 0x7E, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40,
-    0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFB, 0xFB, 0xFD, 0x00, 0x03, 0xF4, 0x2F, 0x03,
-    0xF0, 0x00, 0x7E, 0x02, 0xF0, 0x1F, 0x80, 0x0B, 0xD0, 0x2F, 0x00, 0xFC, 0x00, 0xFC, 0x02, 0xF0,
-    0x0B, 0xD0, 0x1F, 0x40, 0x2F, 0x00, 0x3E, 0x03, 0xF0, 0x02, 0xF0, 0x03, 0xF0, 0x3E, 0x00, 0x2F,
-    0x00, 0x1F, 0x4B, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0xBC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xC0,
-    0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0B,
-    0xE0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x83, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD,
-    0xBD, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xAF, 0xFF, 0xD4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xC0, 0x01, 0xFD, 0x0B, 0xD0, 0x7F,
-    0x00, 0xFC, 0x00, 0x3F, 0x40, 0xBD, 0x01, 0xF8, 0x0F, 0xC0, 0x07, 0xF0, 0x0B, 0xD0, 0x0F, 0xC0,
-    0xFC, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBD, 0x0F, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x07, 0xE0, 0xFC,
-    0x00, 0xFC, 0x00, 0xBD, 0x00, 0x3F, 0x0F, 0xC0, 0x2F, 0x80, 0x0B, 0xD0, 0x02, 0xF4, 0xFC, 0x03,
-    0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x8F, 0xC0, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0xFC, 0x07, 0xE0,
-    0x00, 0xBD, 0x00, 0x0F, 0xCF, 0xC0, 0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x7D, 0x3E, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xE0, 0x0F, 0xEA, 0xAA, 0xAF, 0xD0,
-    0x0F, 0x80, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0xF8, 0x00,
-    0x0F, 0xC0, 0xBE, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x0F, 0xD5, 0x55, 0x6F, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xBF, 0xBF, 0xD0, 0x03,
-    0xE0, 0x0B, 0xD0, 0xBC, 0x0F, 0xC0, 0x0F, 0x80, 0x3F, 0x02, 0xF0, 0x1F, 0x80, 0x3E, 0x02, 0xF4,
-    0x0B, 0xC0, 0x3F, 0x00, 0xF8, 0x0F, 0xC0, 0x2F, 0x00, 0xBD, 0x03, 0xE0, 0x7E, 0x00, 0xBC, 0x00,
-    0xFC, 0x0F, 0x83, 0xF0, 0x02, 0xF0, 0x03, 0xF0, 0x3E, 0x0F, 0x80, 0x0B, 0xC0, 0x07, 0xE0, 0xF8,
-    0xBD, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x01, 0x40, 0x00, 0x50, 0x00, 0xF8, 0x01, 0xFE, 0x00, 0x0F,
-    0xC1, 0xFE, 0x40, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x01,
-    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x95, 0x6F, 0xF0, 0x3D, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x0A, 0xAA, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x15, 0xBF, 0xD0, 0x1B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFE,
-    0x40, 0x2F, 0xE5, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x40,
-    0x05, 0x50, 0x1F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0x55, 0x55, 0x6C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0xC0, 0x2F, 0x02, 0xFF, 0x00,
-    0x3F, 0x6F, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x1B, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x03, 0xE5,
-    0x1B, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x6A, 0xBF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x5F, 0xF0, 0x1B, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xE0, 0x1F, 0xE5, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xA9, 0x0B, 0xFF, 0xFF, 0xFE, 0x06, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x0B, 0xDF, 0xC0, 0x03, 0xF0, 0x00, 0xBD,
-    0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xDF, 0xC0, 0x03, 0xF0, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0x00, 0x0B,
-    0xDF, 0xC0, 0x03, 0xF0, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xDF, 0xC0, 0x03, 0xF0, 0x00,
-    0xBD, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xDF, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0xFD, 0x00, 0x3F, 0x00,
-    0x0F, 0xCB, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x00, 0x2F, 0x83, 0xF8, 0x03, 0xF0,
-    0x07, 0xF0, 0x0F, 0xF4, 0x3F, 0x02, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x6B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x3E, 0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xC7, 0xE0, 0x03,
-    0xF0, 0x03, 0xF1, 0xF8, 0x00, 0xFC, 0x00, 0xBD, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x5F, 0x80, 0x0F,
-    0xC0, 0x07, 0xE7, 0xE0, 0x03, 0xF0, 0x01, 0xF9, 0xF8, 0x00, 0xFC, 0x00, 0x3E, 0x7E, 0x00, 0x3F,
-    0x00, 0x0F, 0x9F, 0x80, 0x0F, 0xC0, 0x03, 0xE7, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0xF8, 0x00, 0xFC,
-    0x00, 0xBD, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F, 0xC1, 0xFC, 0x03, 0xF0,
-    0x1F, 0xD0, 0x2F, 0xE4, 0xFD, 0x7F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B,
-    0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00,
-    0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x6F, 0xD0, 0x0F, 0xE0, 0x00,
-    0x7F, 0x01, 0xF8, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x3F,
-    0x55, 0x55, 0x5F, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xF0, 0x00, 0x00,
-    0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x2F, 0x80, 0xFD,
-    0x00, 0x07, 0xF0, 0x03, 0xF9, 0x02, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0xC3, 0xF0, 0x00, 0x00, 0x0F, 0xF6, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00, 0x03,
-    0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0xC0, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x7E, 0x00,
-    0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBF, 0xBE, 0x00, 0x00, 0x2F, 0xF3, 0xF0, 0x00, 0x03,
-    0xF5, 0x3F, 0x40, 0x00, 0xBC, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0xBD,
-    0x00, 0x2F, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x0B, 0xC0,
-    0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x07, 0xD2, 0xF4, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xA0, 0x2A, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xBE, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xF0,
-    0x00, 0x00, 0x0F, 0xF6, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF4, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x02,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC,
-    0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x00, 0x00,
-    0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1A, 0x41, 0xA0,
-    0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0xBD, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00,
-    0xB8, 0x0F, 0x80, 0x00, 0x02, 0xC0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xFB, 0xE0, 0x00, 0x02, 0xFF, 0x3F, 0x00, 0x00, 0x3F, 0x53, 0xF4,
-    0x00, 0x0B, 0xC0, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x0B, 0xD0, 0x02, 0xF0,
-    0x00, 0x7E, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0xFC,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x03, 0xF3, 0xF0, 0x00,
-    0x00, 0x2F, 0x3E, 0x00, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xE9, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xE0, 0x00, 0x00, 0xBD,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x1F,
-    0x80, 0x00, 0x1F, 0x8F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x1F,
-    0x43, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x07, 0xE0, 0x03, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0x40, 0xBD, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3E, 0x03,
-    0xE0, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x00, 0x01, 0xF4, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x3F,
-    0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xEF, 0x00, 0x00, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x01, 0xFF, 0xFF, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03,
-    0xFD, 0x57, 0xFD, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0xBD, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x7E,
-    0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x0F,
-    0xD0, 0x2F, 0x40, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x2F, 0x40, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xE0, 0x7E, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0xBC, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x02, 0xF4,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0xF9, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00,
-    0x00, 0xBE, 0xF0, 0x00, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x5F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFD, 0x0F, 0xD0, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xFC, 0x0B, 0xD0, 0xBF,
-    0x80, 0x01, 0xFF, 0xFF, 0xFB, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x03, 0xFE, 0xFF, 0xBF, 0xC0, 0x0B, 0xE0, 0x69, 0x0F, 0xE0, 0x1F, 0xC0, 0x00,
-    0x03, 0xF0, 0x2F, 0x40, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x01, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x0B,
-    0xE0, 0x14, 0x0B, 0xF0, 0x03, 0xFD, 0xFF, 0x7F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1E,
-    0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF4, 0x00, 0x0F, 0xF9, 0x6F, 0x00, 0xB9, 0x6F, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x40, 0x0B,
-    0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF3, 0xF4,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x1F, 0x80,
-    0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xD0, 0xFD, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF8, 0x03, 0xFD, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x56, 0xFF, 0xF9, 0x5B, 0xFD, 0x00, 0x03, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFD, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xA0, 0x78, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xF9, 0x6C, 0x00, 0x39, 0x6F, 0xD0, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x7E,
-    0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x07,
-    0xF0, 0x07, 0xFD, 0x07, 0xFF, 0xE0, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x80, 0x00,
-    0x7F, 0xFF, 0x40, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0B,
-    0x81, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x07, 0xE3, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07,
-    0xE3, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE2,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD1, 0xFC,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xC0, 0xFD, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0x0B,
-    0xFF, 0x40, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0xFD, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x1F, 0x8F,
-    0xC0, 0x03, 0xF0, 0x01, 0xFC, 0x02, 0xF0, 0xFD, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x3F, 0x07, 0xE0,
-    0x0B, 0xD0, 0x00, 0xBD, 0x07, 0xD0, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0xBC, 0x02, 0xF4, 0x1F,
-    0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0xC2, 0xF0, 0x00, 0x01, 0xF9, 0xF4, 0x00, 0xBD, 0x3F, 0x00,
-    0x00, 0x0F, 0xEF, 0x00, 0x07, 0xFB, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0x80, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x20, 0x05, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xD7, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x02, 0xF4, 0x00, 0x0B,
-    0xD3, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC2, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x1F, 0xC0, 0x02,
-    0xF4, 0x0F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x7F, 0xE0, 0x03, 0xE0, 0x07, 0xE0,
-    0x0F, 0xFF, 0x00, 0xBD, 0x00, 0x3F, 0x01, 0xF5, 0xF4, 0x0F, 0xC0, 0x01, 0xF4, 0x2F, 0x0F, 0xC1,
-    0xF8, 0x00, 0x0F, 0xC3, 0xD0, 0xBC, 0x3F, 0x00, 0x00, 0xBD, 0xBC, 0x03, 0xE7, 0xE0, 0x00, 0x03,
-    0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0x3F, 0xFE, 0xAB, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x90, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x56, 0x40, 0x00,
-    0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x95, 0xB8, 0x0F, 0xE0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x06, 0x40, 0x07,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x04,
-    0x00, 0xBC, 0x00, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x2F, 0xE2, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x3E, 0xBF, 0x80, 0x00, 0x0B,
-    0xC1, 0xFD, 0x14, 0x00, 0xF8, 0x01, 0x83, 0xF4, 0x2F, 0x00, 0x00, 0x2F, 0xE7, 0xD0, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xBF,
-    0x80, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x03, 0xF0, 0x01, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x41, 0x55, 0x5B, 0xE3, 0xFF,
-    0xFF, 0xF9, 0xFD, 0x55, 0x54, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x0B, 0xFF, 0xC2,
-    0xBF, 0xFF, 0xF8, 0xFF, 0x90, 0x1F, 0x25, 0x00, 0x02, 0x80, 0x2E, 0x1F, 0xC7, 0xD0, 0xF0, 0x1F,
-    0x00, 0x90, 0x2E, 0x0F, 0xD0, 0xF4, 0x2C, 0x2D, 0x18, 0x00, 0x01, 0x50, 0x00, 0x03, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xE4, 0xF4, 0x0B, 0xFF, 0x28, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFA, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xEB, 0xE0,
-    0x00, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0xB4, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x41, 0xED,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x18,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x5B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x02, 0x90, 0x00, 0x01, 0xBC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x06, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0x0F, 0xEF, 0x40, 0xFC,
-    0x00, 0x00, 0x7F, 0x7D, 0x03, 0xF0, 0x00, 0x03, 0xF1, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x87, 0xD0,
-    0x3F, 0x00, 0x01, 0xFC, 0x1F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7D, 0x03, 0xF0, 0x00, 0xFE, 0x01,
-    0xF4, 0x0F, 0xC0, 0x07, 0xF0, 0x07, 0xD0, 0x3F, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0xFC, 0x03, 0xF8,
-    0x00, 0x7D, 0x03, 0xF0, 0x1F, 0xC0, 0x01, 0xF4, 0x0F, 0xC0, 0xFC, 0x00, 0x07, 0xD0, 0x3F, 0x0F,
-    0xE0, 0x00, 0x1F, 0x40, 0xFC, 0x7F, 0x00, 0x00, 0x7D, 0x03, 0xF3, 0xF0, 0x00, 0x01, 0xF4, 0x0F,
-    0xFF, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xA7, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xDF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0x40, 0x00, 0x14, 0x00, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x01, 0xFD, 0x57, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x0A,
-    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x7F, 0x40, 0x3E, 0x00, 0x00, 0xFF, 0x80, 0x3E, 0x00, 0x02, 0xFF, 0x80, 0x3E, 0x00, 0x03, 0xEF,
-    0x80, 0x3E, 0x00, 0x0F, 0xCF, 0x80, 0x3E, 0x00, 0x1F, 0x4F, 0x80, 0x3E, 0x00, 0x3F, 0x0F, 0x80,
-    0x3E, 0x00, 0xBC, 0x0F, 0x80, 0x3E, 0x01, 0xF4, 0x0F, 0x80, 0x3E, 0x03, 0xF0, 0x0F, 0x80, 0x3E,
-    0x0B, 0xC0, 0x0F, 0x80, 0x3E, 0x1F, 0x80, 0x0F, 0x80, 0x3E, 0x3F, 0x00, 0x0F, 0x80, 0x3E, 0xBD,
-    0x00, 0x0F, 0x80, 0x3E, 0xF8, 0x00, 0x0F, 0x80, 0x3F, 0xF0, 0x00, 0x0F, 0xD5, 0x3F, 0xD0, 0x00,
-    0x0F, 0xFD, 0x3F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xA9, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0xBF, 0xC0, 0x3F, 0x00, 0x00,
-    0x3F, 0x40, 0xFC, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x07, 0xF0,
-    0x3F, 0x00, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0xEA,
-    0xAB, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x57,
-    0xF5, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0x94, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0xFD, 0x55, 0x6F, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x0B, 0xFC, 0xFC, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x00, 0xBE,
-    0xFC, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x40, 0xBE, 0xFC, 0x03, 0xD0, 0xFD,
-    0xFC, 0x03, 0xF2, 0xFC, 0xFC, 0x00, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xAA, 0x9F, 0xC0, 0xFC, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x01, 0xD0, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x42, 0xFF, 0xE0,
-    0x03, 0xD7, 0xFF, 0xFF, 0x00, 0xFF, 0xE5, 0x6F, 0xF0, 0x3F, 0xD0, 0x00, 0xFE, 0x0F, 0xE0, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x1F, 0x8F, 0xC0,
-    0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x2F, 0x4F,
-    0xC0, 0x0A, 0x0F, 0xD3, 0xF8, 0x07, 0xD3, 0xF0, 0xFF, 0x00, 0xBF, 0xF8, 0x3F, 0xF8, 0x0F, 0xFC,
-    0x0F, 0xAF, 0xFF, 0xFC, 0x03, 0xE1, 0xFF, 0xFF, 0x00, 0xFC, 0x01, 0x43, 0xF0, 0x3F, 0x00, 0x00,
-    0x3D, 0x0F, 0xC0, 0x00, 0x04, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0x55, 0x55, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x0A, 0xFE, 0xAA, 0xA0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x03, 0xFA, 0xAA, 0x90, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFA, 0xAF, 0xFF, 0x40, 0xFC, 0x00, 0x07,
-    0xFD, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x01, 0xFC, 0xFC,
-    0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00,
-    0xBD, 0xFC, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x0E, 0x55, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFA, 0xAA, 0xA0, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD5, 0x40,
-    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xF4, 0x1B, 0xFC, 0x0F, 0xC0, 0x03, 0xF8,
-    0x3F, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x7E, 0x3F,
-    0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x79, 0x6F, 0xF0, 0x01, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E,
-    0x02, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xF4, 0x00,
-    0x3F, 0x40, 0x03, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x80, 0x00, 0x07,
-    0xF0, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0x03, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x3E, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC3,
-    0xE2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x3E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xE3, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x3E, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xE0, 0xBF, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x3E, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xE0, 0x0F, 0xD0, 0x00,
-    0x00, 0xBE, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xE0, 0x02, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0xA9, 0x3F, 0x80,
-    0x00, 0x3E, 0x00, 0x00, 0xFF, 0xEB, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07,
-    0xF0, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0xBE, 0x03, 0xF0,
-    0x2F, 0x80, 0x00, 0x03, 0xF4, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC3, 0xF1, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xBF,
-    0xBE, 0x00, 0x00, 0x00, 0x07, 0xE3, 0xF3, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x03,
-    0xF0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x2F, 0x95, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0xBF,
-    0xFB, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFE, 0x96, 0xBF, 0xE0, 0x14, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x06, 0xAB, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00,
-    0x00, 0x7F, 0x8B, 0xE5, 0x56, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0x80, 0x6F, 0xFF, 0xFE, 0x40, 0x00,
-    0x06, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x03, 0xE5, 0x1B, 0xF8,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x02, 0xAA,
-    0xFE, 0x00, 0x7F, 0xFF, 0x40, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFD, 0xF9, 0x00, 0x7F, 0xCF, 0xFF, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x3F,
-    0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x0F,
-    0xE0, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00,
-    0x0F, 0xCB, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x03, 0xF1,
-    0xFD, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x02, 0xFC,
-    0x00, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00,
-    0xFC, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x07, 0xFA, 0xAF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF4, 0x03, 0xF0, 0x02,
-    0xF8, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x03, 0xF0,
-    0xFC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x03,
-    0xF3, 0xF8, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x40,
-    0x03, 0xF0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x54, 0x3F, 0x00, 0x0B, 0xFF, 0x0F, 0xC0, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00,
-    0x7F, 0x00, 0xFC, 0x2D, 0x0F, 0xD0, 0x0F, 0xC2, 0xD3, 0xF4, 0x00, 0xFC, 0x2D, 0xFE, 0x00, 0x0F,
-    0xC2, 0xFF, 0x80, 0x00, 0xFC, 0x2F, 0xE0, 0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x00, 0xFC, 0xBF, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x0F, 0xC7, 0xF4, 0x00, 0x00, 0xFC,
-    0x3F, 0xC0, 0x00, 0x0F, 0xC2, 0xFF, 0x00, 0x00, 0xFC, 0x2F, 0xFC, 0x00, 0x0F, 0xC2, 0xDF, 0xF0,
-    0x00, 0xFC, 0x2D, 0x3F, 0x80, 0x0F, 0xC0, 0x40, 0xFE, 0x00, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xC0,
-    0x00, 0x1F, 0xD0, 0xFC, 0x00, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0x01, 0xFC, 0x3E, 0x00, 0x03, 0xF0,
-    0x3F, 0x09, 0x0F, 0xD0, 0x3F, 0x1F, 0x2F, 0x80, 0x3F, 0x1F, 0xBE, 0x00, 0x3F, 0x1F, 0xF8, 0x00,
-    0x3F, 0x1F, 0xF0, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x3F, 0xBF, 0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x3F, 0x1F, 0xD0, 0x00, 0x3F, 0x1F, 0xF4, 0x00,
-    0x3F, 0x1F, 0xFD, 0x00, 0x3F, 0x1F, 0x7F, 0x00, 0x3F, 0x1F, 0x1F, 0xC0, 0x3F, 0x09, 0x0B, 0xF0,
-    0x3F, 0x00, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x42, 0xFF, 0xFF, 0x40, 0x2F, 0x80, 0xBF, 0xFF, 0xD0, 0x1F, 0xC0, 0x1A, 0xFF,
-    0xA0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00,
-    0x01, 0xFC, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0x7F, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x03,
-    0xF0, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x07, 0xF0,
-    0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xBE, 0x00, 0x00, 0x03, 0xF3, 0xF8, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0x40,
-    0x00, 0x3F, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x03, 0xF0,
-    0x00, 0xBF, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0xBF, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0x80,
-    0x00, 0x0F, 0xD0, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x00,
-    0x1F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0xC0,
-    0x00, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x87,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0x80,
-    0x1F, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x02, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x0F,
-    0xE0, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF8, 0x7F, 0xFF, 0xC0, 0x00, 0x7E, 0x1F, 0xFF, 0xF0, 0x00,
-    0x7F, 0x02, 0xAA, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x3F,
-    0x00, 0x00, 0x02, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x2F, 0x40,
-    0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x7F, 0x00,
-    0x00, 0x00, 0x2F, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0xBE, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xE0,
-    0x00, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0xFD,
-    0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02,
-    0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFF, 0xAA, 0xAA,
-    0xAB, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00,
-    0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xE8, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40,
-    0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F,
-    0x00, 0x00, 0x2F, 0x40, 0x3F, 0x55, 0x55, 0x6F, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00,
-    0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F,
-    0x94, 0x3F, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFF, 0xAA, 0xAA, 0xAB, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3E, 0x00,
-    0x00, 0x1F, 0xFF, 0xF0, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xC3, 0xF0, 0x00, 0x02, 0xFA, 0xAA, 0x0F,
-    0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00,
-    0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD5, 0x55, 0x5B, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00,
-    0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xF0,
-    0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xEA,
-    0xBF, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xFC, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x03, 0xF8, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x0F, 0xDF, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x79, 0x5B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD5, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x03, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xBE, 0x46, 0xFF, 0x03, 0xF0, 0x00,
-    0x0B, 0xD0, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x0B, 0xD0, 0x00,
-    0xBD, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0xBD, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2E,
-    0x5F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE9, 0xA4, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x05, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xC0,
-    0x00, 0xBF, 0xFF, 0xC0, 0x7F, 0x00, 0x03, 0xF8, 0x7F, 0x82, 0xF8, 0x00, 0x2F, 0x80, 0x3F, 0x0F,
-    0xD0, 0x00, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0xFC, 0x00, 0x1F, 0xC0, 0x07,
-    0xF3, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xCF, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x3F, 0x40, 0x07, 0xF0,
-    0x01, 0xFC, 0xBD, 0x00, 0x0F, 0xC0, 0x07, 0xE1, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0x43, 0xF0, 0x00,
-    0xBE, 0x00, 0xFC, 0x0F, 0xE0, 0x01, 0xFC, 0x0B, 0xE0, 0x1F, 0xD0, 0x03, 0xF8, 0x7F, 0x00, 0x2F,
-    0xE0, 0x07, 0xFB, 0xF4, 0x00, 0x2F, 0xF9, 0x5F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x55,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x54, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xF9, 0x54, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x02, 0xFF, 0x40,
-    0x2F, 0x40, 0x1F, 0xFF, 0xD0, 0x3F, 0x00, 0x3F, 0x87, 0xF0, 0x3F, 0x00, 0x7F, 0x02, 0xF4, 0x3F,
-    0x00, 0xBD, 0x01, 0xF8, 0x3F, 0x00, 0xBD, 0x00, 0xF8, 0x3F, 0x00, 0xBD, 0x01, 0xF8, 0x3F, 0x00,
-    0x7E, 0x01, 0xF4, 0x2F, 0x40, 0x3F, 0x03, 0xF0, 0x1F, 0x80, 0x3F, 0x47, 0xF0, 0x0F, 0xD0, 0x1F,
-    0xDF, 0xC0, 0x03, 0xF9, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x98, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x50, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xAB, 0xF4, 0x03, 0xFD, 0x00, 0x01, 0x80, 0x3F, 0xC0,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0xF9, 0x55, 0xBC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xF5,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x01, 0xFF, 0xFF, 0xE0, 0x3F, 0xE5,
-    0xAD, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xFD, 0x05, 0xE0, 0x1F,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01,
-    0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFA, 0x40, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x2A, 0xAF,
-    0xEA, 0xA8, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x0B, 0xE5, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xF9, 0xFC,
-    0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00,
-    0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00, 0x03,
-    0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F,
-    0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF4,
-    0x07, 0xE0, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00,
-    0x3E, 0x2F, 0x00, 0x00, 0x0F, 0xCF, 0x80, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xF9,
-    0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xE0,
-    0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00,
-    0x03, 0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x55, 0x7F, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x15, 0x5F, 0xD5, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x1F, 0x80,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x0F, 0xC0, 0x02,
-    0xF0, 0x07, 0xE0, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xF4, 0x7E, 0x00,
-    0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0xCF, 0x80, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01,
-    0xF4, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
-    0x00, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x40, 0x00, 0x07, 0xF0, 0x1F, 0x80,
-    0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x02, 0xFE, 0x93,
-    0xF0, 0x00, 0x00, 0x3F, 0xFA, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x2F,
-    0x40, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x3F,
-    0x40, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x03, 0xF6, 0xF4, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x03, 0xF4,
-    0x02, 0xF8, 0x00, 0xBE, 0x00, 0x0F, 0xE5, 0x1F, 0xC0, 0x00, 0x7F, 0xF3, 0xF4, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFA, 0xAA, 0xAA, 0xAF, 0xEA, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7F, 0xFF, 0xFF, 0xF4, 0x0F, 0x80, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xC0, 0x2A, 0xAF, 0xEA, 0xA4, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD5, 0x55, 0x6F, 0xD4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x01, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xE0,
-    0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x80,
-    0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xD0,
-    0x01, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x01, 0xAA,
-    0xA4, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x7D, 0x00, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x07, 0xE0,
-    0x2F, 0x40, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x0B, 0xD0,
-    0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x55, 0xBF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xE7, 0xE0, 0x00, 0xBF, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD4, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x00,
-    0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x03,
-    0xF1, 0xF8, 0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x18, 0x00, 0xFC, 0x7E,
-    0x00, 0xF4, 0x03, 0xF1, 0xF8, 0x03, 0xD0, 0x0F, 0xC7, 0xF0, 0x0F, 0x40, 0x3F, 0x0F, 0xC0, 0x3D,
-    0x00, 0xFC, 0x3F, 0xD0, 0xF4, 0x6F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x7F,
-    0x00, 0x06, 0xBE, 0x40, 0xFC, 0x00, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00,
-    0x0F, 0x40, 0x3F, 0x00, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0x60, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBD, 0xBD,
-    0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0xBD, 0xBD,
-    0x07, 0x80, 0xBD, 0xBD, 0x07, 0x80, 0xBD, 0x7D, 0x07, 0x80, 0xBD, 0x7F, 0x07, 0x82, 0xFD, 0x3F,
-    0xDB, 0xEF, 0xFD, 0x1F, 0xFF, 0xFE, 0xBD, 0x02, 0xFF, 0xE0, 0xBD, 0x00, 0x0B, 0x80, 0xBD, 0x00,
-    0x07, 0x80, 0xBD, 0x00, 0x07, 0x80, 0xBD, 0x00, 0x07, 0x40, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xBD, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x59, 0x40, 0x0F, 0xD6, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0x90, 0x07, 0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00,
-    0x00, 0xBE, 0xFC, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x07, 0xEF,
-    0xC0, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00,
-    0x07, 0xEF, 0xC0, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x7E, 0x15,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x0B, 0xFF, 0x80, 0x3E, 0x7F, 0xFF, 0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFD, 0x3F,
-    0x80, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0xAA,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x2E, 0x07, 0xE0,
-    0x00, 0x00, 0x03, 0xF0, 0xF8, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC3, 0xE0, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x0F, 0xE7, 0xF5, 0x55, 0x55, 0x55, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xFF, 0x95,
-    0x5A, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF5, 0x5F, 0xF0, 0x00, 0x0B, 0xE0, 0x00,
-    0xFE, 0x0F, 0x43, 0xF0, 0x00, 0x0F, 0xC3, 0xD1, 0xF8, 0x00, 0x03, 0xF0, 0xF4, 0xBD, 0x00, 0x00,
-    0xBD, 0x3F, 0xBF, 0xEA, 0xAA, 0xBF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1B, 0xFA, 0xAA, 0xAA,
-    0xA4, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x41, 0x6E,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0xBF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x2E, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0xF8, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xC3, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xE7, 0xF5, 0x55, 0x55, 0x55,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x5A, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF5, 0x5F, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0xFE, 0x0F, 0x43, 0xF0, 0x00, 0x0F, 0xC3, 0xD1, 0xF8, 0x00, 0x03, 0xF0, 0xF4, 0xBD, 0x00,
-    0x00, 0xBD, 0x3F, 0xBF, 0xEA, 0xAA, 0xBF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1B, 0xFA, 0xAA,
-    0xAA, 0xA4, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x41,
-    0x6E, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x7F, 0x90, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFD, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x07, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00,
-    0x7E, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x07,
-    0xE0, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x7E,
-    0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x01, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xE0,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x7E, 0x01, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x01, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x1F, 0x80, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xE0,
-    0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x0B,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xA0, 0x02, 0x90, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0x7E, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x02, 0xF4, 0x00,
-    0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3F,
-    0x02, 0xF4, 0x00, 0x00, 0x1F, 0x97, 0xF5, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x03,
-    0xF0, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x02, 0xF8, 0x00,
-    0x3F, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0xBC, 0x00, 0x00, 0x2F, 0x83,
-    0xF0, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0xFD, 0x00,
-    0x00, 0xFC, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F,
-    0xBF, 0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x00,
-    0x7F, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x2F,
-    0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0,
-    0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xE5, 0x5F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF4, 0x3E, 0x00, 0x0B, 0xD0,
-    0x3E, 0x00, 0x2F, 0x80, 0x3E, 0x00, 0xBE, 0x00, 0x3E, 0x02, 0xF8, 0x00, 0x3E, 0x07, 0xE0, 0x00,
-    0x3E, 0x1F, 0x80, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x3F, 0xA5, 0xBF, 0xE0, 0x3E, 0x00, 0x0B, 0xF4, 0x3E, 0x00, 0x02, 0xFC, 0x3E, 0x00, 0x00, 0xFC,
-    0x3E, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x7E, 0x3E, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0xB9, 0x6F, 0xE0, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0x00,
-    0x2F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x0B,
-    0xC0, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x80, 0x00,
-    0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x40, 0x47, 0xF4, 0x00, 0x00, 0x2F, 0xE9, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xAA, 0xBF, 0x40, 0x00, 0x2F, 0x00,
-    0x2F, 0x40, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x2F,
-    0x40, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x00, 0x7D, 0x00, 0x2F, 0x40,
-    0x00, 0xBC, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01,
-    0xF4, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x0F, 0xE0, 0x00, 0x2F, 0x94, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFC, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF7,
-    0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00,
-    0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xFA, 0xAA, 0xAA, 0xBF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00,
-    0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B,
-    0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0,
-    0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xE5, 0x5B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x0B,
-    0xD3, 0xF0, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00,
-    0x0B, 0xD3, 0xF0, 0x00, 0x02, 0xF4, 0xFD, 0x55, 0x55, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xF0, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x2F, 0x4F,
-    0xC0, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x2F,
-    0x4F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x39, 0x6F, 0xF0, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF4,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02,
-    0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0xFF, 0xAA, 0xAA, 0xAB, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00,
-    0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0xE9, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40,
-    0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F,
-    0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x55, 0x55, 0x6F, 0x40, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00,
-    0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x2F,
-    0x40, 0x3F, 0x00, 0x00, 0x2F, 0x94, 0x3F, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00,
-    0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0x0F, 0xC7,
-    0xE0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x00,
-    0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x3F, 0xD0, 0x01, 0xBF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x1A, 0xAA, 0x40, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xAF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x7E, 0xBD,
-    0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x7E, 0xBD,
-    0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x02, 0xFE, 0x3F, 0xD5, 0x6F, 0xFE, 0x0F,
-    0xFF, 0xFE, 0x7E, 0x02, 0xFF, 0xE0, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x05, 0xBE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0xFE, 0xF4, 0x00, 0x00, 0x0F, 0xBF, 0x00, 0xFC, 0xF8,
-    0x00, 0x00, 0x1F, 0x3F, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0xFC, 0x7D, 0x00, 0x00,
-    0x3D, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xF8, 0x3F,
-    0x00, 0xFC, 0x1F, 0x80, 0x01, 0xF4, 0x3F, 0x00, 0xFC, 0x0F, 0xC0, 0x02, 0xF0, 0x3F, 0x00, 0xFC,
-    0x0B, 0xD0, 0x03, 0xE0, 0x3F, 0x00, 0xFC, 0x03, 0xE0, 0x07, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x01, 0xF4, 0x0F, 0x40, 0x3F, 0x00, 0xFC, 0x00, 0xFC, 0x2F, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0xBC, 0x3E, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x7E, 0x7D, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0x00, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xA8, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFC, 0xFC, 0x00, 0x07, 0xD0,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00,
-    0x3F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3E, 0xF4, 0x00, 0x0B,
-    0xEF, 0x00, 0x3D, 0xFC, 0x00, 0x0F, 0xAF, 0x00, 0x3D, 0x7C, 0x00, 0x1F, 0x6F, 0x00, 0x3D, 0x3E,
-    0x00, 0x3F, 0x2F, 0x00, 0x3D, 0x2F, 0x00, 0x3D, 0x2F, 0x00, 0x3D, 0x0F, 0x40, 0xBC, 0x2F, 0x00,
-    0x3D, 0x0F, 0xC0, 0xF8, 0x2F, 0x00, 0x3D, 0x07, 0xC1, 0xF0, 0x2F, 0x00, 0x3D, 0x03, 0xE3, 0xF0,
-    0x2F, 0x00, 0x3D, 0x02, 0xF7, 0xD0, 0x2F, 0x00, 0x3D, 0x01, 0xFF, 0xC0, 0x2F, 0x00, 0x3D, 0x00,
-    0xFF, 0x80, 0x2F, 0x54, 0x3D, 0x00, 0x7F, 0x00, 0x2F, 0xFC, 0x3D, 0x00, 0x3F, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x7F,
-    0x90, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E,
-    0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47,
-    0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xA0, 0x02, 0x90, 0x07,
-    0xD0, 0x0F, 0x40, 0x0F, 0xD1, 0xFC, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x06, 0xE8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0x94, 0x6F,
-    0xD0, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x6A, 0xBF, 0xC0, 0xBF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0xFC, 0xFE, 0x00, 0x03, 0xF7, 0xF0,
-    0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3F, 0x7E, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x0F, 0xF3, 0xF8, 0x02,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xB8,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00,
-    0x03, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF,
-    0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00,
-    0xBE, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x03, 0xE0, 0x3F, 0x00,
-    0x1F, 0xC0, 0xFC, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0x94, 0x6F, 0xD0, 0x10, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x6A, 0xBF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0xFC, 0xFE, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x0F, 0xDF,
-    0x80, 0x00, 0x3F, 0x7E, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x0F, 0xF3, 0xF8, 0x02, 0xFF, 0xC7, 0xFF,
-    0xFF, 0x5F, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x81, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF4, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xE0, 0x02, 0xF9, 0x17, 0xFB,
-    0xF4, 0x1F, 0xE0, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x16,
-    0xAB, 0xFE, 0xAA, 0xAB, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xA5, 0x6F, 0xEA,
-    0xAA, 0xAA, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x5F, 0xE4, 0x16, 0xD0, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x0B, 0xD0, 0x3F, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFE, 0xAA, 0xAA, 0x9F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xA0, 0x02, 0xA0,
-    0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0B, 0xD1, 0xFC, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFE, 0x46, 0xFE, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x02, 0xF8, 0x2F,
-    0x40, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3, 0xFA, 0xAA, 0xAB, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xAA, 0xAA, 0xAA, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD4, 0x16, 0xD0, 0x07, 0xFF,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xE9, 0x6B, 0xFF,
-    0x00, 0x06, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xAA, 0xAA, 0xAA, 0xAF, 0xE3, 0xF0, 0x00,
-    0x00, 0x00, 0xBD, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x80,
-    0x00, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x2F, 0x95, 0x6F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x2A, 0xAA,
-    0xAA, 0xBF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x3E, 0x3F, 0x00,
-    0x00, 0x7E, 0x3F, 0x40, 0x00, 0xFC, 0x1F, 0xC0, 0x02, 0xF8, 0x0F, 0xF4, 0x1B, 0xF0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xB8, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xE9, 0x6B, 0xFF,
-    0x00, 0x06, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xAA, 0xAA, 0xAA, 0xAF, 0xE3, 0xF0, 0x00,
-    0x00, 0x00, 0xBD, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x80,
-    0x00, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xF4,
-    0x0F, 0x80, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x2F, 0x95,
-    0x6F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x2A, 0xAA, 0xAA, 0xBF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0xFC, 0x1F, 0xC0,
-    0x02, 0xF8, 0x0F, 0xF4, 0x1B, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0,
-    0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00,
-    0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0xBE, 0x00, 0x00,
-    0xFD, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x01,
-    0xF8, 0x01, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x1F, 0x80, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x7E, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x01,
-    0xF8, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F,
-    0x80, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xF8,
-    0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x1F, 0x80,
-    0x00, 0x3F, 0x40, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0xBD, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x7E,
-    0x00, 0x00, 0xBD, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0x1F,
-    0x97, 0xF5, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x02, 0xF8, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0x2F, 0x80, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x00,
-    0x2F, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x7F,
-    0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x40, 0x04, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x0B, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x0F, 0xE9, 0x6B, 0xFE,
-    0x01, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x6A,
-    0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x07, 0xF8, 0xBE, 0x55, 0x6F,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0x00,
-    0x10, 0x00, 0xBC, 0x07, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x03, 0xE5, 0x1B,
-    0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x02,
-    0xAA, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFD, 0xF9, 0x00, 0x7F, 0xCF, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x40, 0x00,
-    0x00, 0xFF, 0x3F, 0x90, 0x06, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x2A, 0xAA, 0xAB, 0xF4,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x50, 0x00, 0x0B, 0xF0,
-    0xBF, 0x95, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x2A, 0xAA, 0xA4,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xDF,
-    0xFF, 0x00, 0x00, 0x7E, 0x3F, 0xFC, 0x00, 0x03, 0xF0, 0xFF, 0xF0, 0x00, 0x2F, 0x43, 0xFF, 0xC0,
-    0x00, 0xF8, 0x0F, 0xFF, 0x00, 0x0F, 0xC0, 0x3F, 0xFC, 0x00, 0x7D, 0x00, 0xFF, 0xF0, 0x03, 0xF0,
-    0x03, 0xFF, 0xC0, 0x3F, 0x00, 0x0F, 0xFF, 0x01, 0xF8, 0x00, 0x3F, 0xFC, 0x0F, 0xC0, 0x00, 0xFF,
-    0xF0, 0xBC, 0x00, 0x03, 0xFF, 0xC7, 0xE0, 0x00, 0x0F, 0xFF, 0x3F, 0x00, 0x00, 0x3F, 0xFE, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xAA, 0xAA, 0x80, 0x02, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFE, 0x3E, 0x00,
-    0x02, 0xFF, 0x3E, 0x00, 0x03, 0xFF, 0x3E, 0x00, 0x0B, 0xFF, 0x3E, 0x00, 0x1F, 0x7F, 0x3E, 0x00,
-    0x3F, 0x3F, 0x3E, 0x00, 0x7C, 0x3F, 0x3E, 0x00, 0xF8, 0x3F, 0x3E, 0x02, 0xF0, 0x3F, 0x3E, 0x07,
-    0xD0, 0x3F, 0x3E, 0x0F, 0xC0, 0x3F, 0x3E, 0x1F, 0x40, 0x3F, 0x3E, 0x3E, 0x00, 0x3F, 0x3E, 0xBC,
-    0x00, 0x3F, 0x3F, 0xF8, 0x00, 0x3F, 0x3F, 0xF0, 0x00, 0x3F, 0x3F, 0xD0, 0x00, 0x3F, 0x3F, 0xC0,
-    0x00, 0x3F, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x40,
-    0x00, 0x0B, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xBD, 0xFF,
-    0xF0, 0x00, 0x07, 0xE3, 0xFF, 0xC0, 0x00, 0x3F, 0x0F, 0xFF, 0x00, 0x02, 0xF4, 0x3F, 0xFC, 0x00,
-    0x0F, 0x80, 0xFF, 0xF0, 0x00, 0xFC, 0x03, 0xFF, 0xC0, 0x07, 0xD0, 0x0F, 0xFF, 0x00, 0x3F, 0x00,
-    0x3F, 0xFC, 0x03, 0xF0, 0x00, 0xFF, 0xF0, 0x1F, 0x80, 0x03, 0xFF, 0xC0, 0xFC, 0x00, 0x0F, 0xFF,
-    0x0B, 0xC0, 0x00, 0x3F, 0xFC, 0x7E, 0x00, 0x00, 0xFF, 0xF3, 0xF0, 0x00, 0x03, 0xFF, 0xEF, 0x40,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xFC,
-    0x0F, 0xC0, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0xFE, 0x3E, 0x00, 0x02, 0xFF, 0x3E, 0x00, 0x03, 0xFF, 0x3E, 0x00,
-    0x0B, 0xFF, 0x3E, 0x00, 0x1F, 0x7F, 0x3E, 0x00, 0x3F, 0x3F, 0x3E, 0x00, 0x7C, 0x3F, 0x3E, 0x00,
-    0xF8, 0x3F, 0x3E, 0x02, 0xF0, 0x3F, 0x3E, 0x07, 0xD0, 0x3F, 0x3E, 0x0F, 0xC0, 0x3F, 0x3E, 0x1F,
-    0x40, 0x3F, 0x3E, 0x3E, 0x00, 0x3F, 0x3E, 0xBC, 0x00, 0x3F, 0x3F, 0xF8, 0x00, 0x3F, 0x3F, 0xF0,
-    0x00, 0x3F, 0x3F, 0xD0, 0x00, 0x3F, 0x3F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x7D, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B, 0xFF,
-    0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00,
-    0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00,
-    0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0xBF,
-    0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07,
-    0xD0, 0x3E, 0x00, 0x00, 0xBE, 0x07, 0xE0, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x02, 0xF8,
-    0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00,
-    0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2,
-    0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0xFE, 0x00, 0x07, 0xF0, 0x03, 0xF9, 0x06,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0,
-    0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE5, 0x55, 0x55, 0x55,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00,
-    0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x6F, 0xD0,
-    0x0F, 0xE0, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x00, 0xFC, 0x3F, 0x55, 0x55, 0x5F, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,
-    0x2F, 0x80, 0xFD, 0x00, 0x07, 0xF0, 0x03, 0xF9, 0x02, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7D,
-    0x03, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07,
-    0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00,
-    0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07, 0xD0, 0x3E,
-    0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xD5, 0x6F, 0xD0, 0x0F, 0xE0, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x02, 0xF8, 0x2F, 0x40,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x55, 0x55, 0x5F, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00,
-    0x00, 0xFC, 0x1F, 0x80, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x07, 0xF0, 0x03, 0xF9, 0x02, 0xFD, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x04,
-    0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0xB8, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0x96, 0xBF, 0xF0, 0x01, 0x40, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xAA,
-    0xAA, 0xAF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x7E, 0x55, 0x6F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0xF4, 0x0F, 0x80, 0x2F, 0x81, 0xFC, 0x00,
-    0xF0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xF8, 0x03, 0x95, 0x6F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x05, 0x55, 0x5B, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF8, 0xA5, 0x06, 0xFF, 0x0B, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x1A, 0xAA, 0xA8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xD3,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x02,
-    0xF8, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x80, 0x00,
-    0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00,
-    0xBE, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2A, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA,
-    0xAA, 0x80, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xE7, 0xE0, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0xFC,
-    0x2F, 0x40, 0x00, 0x7E, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x07,
-    0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x7D, 0x1F, 0x80, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00,
-    0x3E, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x6B, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x0F,
-    0xC0, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x0B,
-    0xE0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFD,
-    0x00, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x00,
-    0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xAF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x3E,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x2F,
-    0x4F, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00,
-    0xFC, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0xF8,
-    0x0B, 0xD0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xD1, 0xF8, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x2F, 0x3F, 0x00, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x06, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x41, 0xA4, 0x00, 0x00, 0x0F, 0xD0,
-    0xFC, 0x00, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x3E,
-    0x00, 0x00, 0x00, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x00, 0x0B,
-    0xE0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x2F, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x1F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00,
-    0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0xAB, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x2A, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0xFD,
-    0x0F, 0xC0, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x1D, 0x02, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3,
-    0xF0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x3E, 0x02,
-    0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x0B,
-    0xCF, 0xC0, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0x5B, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7D, 0x00, 0x00,
-    0xFD, 0x0B, 0xE0, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x0F, 0xCB, 0xD0,
-    0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x0F,
-    0xCB, 0xD0, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0xC0, 0x00, 0x1F, 0xC1, 0xFF, 0xEA, 0xBF, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xE4, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x40, 0x04, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xB4, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E,
-    0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x7F, 0x3F, 0xEA,
-    0xAF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x1B, 0xFE, 0x4F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFE, 0x3F, 0xAA, 0xA9, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x3F, 0xF4, 0x00,
-    0x3F, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0x02,
-    0xF4, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0xFE, 0xAA, 0x50, 0x00, 0x03, 0xF3, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xCF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x3F, 0x40, 0x07, 0xFD, 0x00, 0xFC, 0xFC, 0x00, 0x02, 0xFC, 0x03,
-    0xF3, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xCF, 0xC0, 0x00, 0x0B, 0xD0, 0x3F, 0x3F, 0x00, 0x00, 0x2F,
-    0x40, 0xFC, 0xFC, 0x00, 0x00, 0xBD, 0x03, 0xF3, 0xF0, 0x00, 0x03, 0xF4, 0x0F, 0xCF, 0xC0, 0x00,
-    0x1F, 0xC0, 0x3F, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0xFC, 0xFE, 0xAA, 0xBF, 0xF0, 0x03, 0xF3, 0xFF,
-    0xFF, 0xFE, 0x00, 0x0F, 0xCF, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00,
-    0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x2E, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x07, 0xD3,
-    0xF0, 0x00, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x4F,
-    0xD5, 0x50, 0x00, 0x07, 0xD3, 0xFF, 0xFF, 0xE0, 0x01, 0xF4, 0xFF, 0xFF, 0xFF, 0x40, 0x7D, 0x3F,
-    0x00, 0x1F, 0xF0, 0x1F, 0x4F, 0xC0, 0x00, 0xFD, 0x07, 0xD3, 0xF0, 0x00, 0x2F, 0x81, 0xF4, 0xFC,
-    0x00, 0x07, 0xE0, 0x7D, 0x3F, 0x00, 0x02, 0xF4, 0x1F, 0x4F, 0xC0, 0x01, 0xFC, 0x07, 0xD3, 0xF5,
-    0x5B, 0xFE, 0x01, 0xF4, 0xFF, 0xFF, 0xFE, 0x00, 0x7D, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0x40, 0x02,
-    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0A, 0xFE, 0xAA, 0xA0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1A,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x03, 0xFA, 0xAA, 0x90, 0x3E, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBF,
-    0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0x90, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4,
-    0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00,
-    0x02, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x40, 0x00, 0x07, 0xF0, 0x1F, 0x80, 0x00,
-    0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x40, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x02, 0xFE, 0x83, 0xF0,
-    0x00, 0x00, 0x3F, 0xF6, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x29, 0x00, 0x2F, 0x40,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x3F, 0x40,
-    0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x03, 0xF6, 0xF4, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x03, 0xF4, 0x02,
-    0xF8, 0x00, 0xBE, 0x00, 0x0F, 0xD4, 0x1F, 0xC0, 0x00, 0x7F, 0xF3, 0xF4, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x69, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF4, 0x2F, 0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x03, 0xF0,
-    0x00, 0x1F, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x01,
-    0xF8, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0A, 0xAB, 0xFF, 0xEA, 0x90,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00,
-    0x3F, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x00,
-    0x03, 0xF4, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xE0,
-    0x07, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x07, 0xF0,
-    0xFC, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x55, 0xFF, 0xE5, 0x50, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xF6, 0xF4, 0x00, 0x00, 0x7E, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x03, 0xF4, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x1F,
-    0xC0, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC2, 0xFF,
-    0xFC, 0xB0, 0x3C, 0x28, 0x2C, 0x0A, 0x0C, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x01, 0x40, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFF, 0xFE,
-    0x0E, 0x03, 0x80, 0xE0, 0xA0, 0x0C, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80,
-    0x00, 0xA0, 0x00, 0x28, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0xDB, 0xFF, 0xF5, 0x55, 0x54, 0x00,
-    0x00, 0x2F, 0xFF, 0xDB, 0xFF, 0xF5, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xFF, 0xF8, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x52, 0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00,
-    0x7C, 0xB8, 0x01, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2, 0xE0,
-    0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E,
-    0x00, 0x7C, 0xB8, 0x01, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2,
-    0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x1F,
-    0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01,
-    0xF2, 0xE0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA3, 0xFF, 0xFF,
-    0xFF, 0xC5, 0x55, 0x55, 0x55, 0x02, 0xD0, 0x7C, 0x0B, 0xC0, 0xF8, 0x1F, 0x43, 0xF4, 0x3F, 0x07,
-    0xF0, 0x15, 0x00, 0x0F, 0xD0, 0xFC, 0x1F, 0xC2, 0xF8, 0x2F, 0x03, 0xF0, 0x3D, 0x07, 0xC0, 0x10,
-    0x00, 0x1F, 0xC2, 0xFC, 0x2F, 0x43, 0xF0, 0x3F, 0x07, 0xD0, 0xBC, 0x0B, 0x80, 0x50, 0x00, 0x7E,
-    0x07, 0xF0, 0x3F, 0x02, 0xF4, 0x1F, 0x80, 0xFC, 0x0B, 0xC0, 0x3D, 0x01, 0x40, 0x02, 0xC0, 0x2D,
-    0x07, 0xC0, 0x3D, 0x0B, 0xC0, 0xBC, 0x0F, 0x80, 0xFC, 0x1F, 0x41, 0xF8, 0x3F, 0x02, 0xF4, 0x3F,
-    0x03, 0xF0, 0x7F, 0x07, 0xF0, 0x15, 0x01, 0x50, 0x0F, 0xD0, 0xBD, 0x0F, 0xC0, 0xFD, 0x1F, 0xC0,
-    0xFC, 0x2F, 0x41, 0xF8, 0x2F, 0x02, 0xF4, 0x3E, 0x03, 0xF0, 0x3D, 0x03, 0xE0, 0x7C, 0x07, 0xC0,
-    0x10, 0x01, 0x40, 0x1F, 0xC0, 0xFC, 0x2F, 0xC1, 0xFC, 0x2F, 0x42, 0xF8, 0x3F, 0x03, 0xF4, 0x3F,
-    0x03, 0xF0, 0x7D, 0x03, 0xE0, 0xBC, 0x07, 0xC0, 0xB8, 0x0B, 0x80, 0x50, 0x05, 0x00, 0x7E, 0x07,
-    0xF0, 0x7F, 0x03, 0xF0, 0x3F, 0x03, 0xF4, 0x2F, 0x42, 0xF4, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0xFC,
-    0x0B, 0xC0, 0x7C, 0x03, 0xC0, 0x3D, 0x01, 0x40, 0x14, 0x00, 0x15, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x03,
-    0xFA, 0xFA, 0xBF, 0xFF, 0xFF, 0xFF, 0xEE, 0x9B, 0x9A, 0xF0, 0x02, 0xD0, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x95, 0x2E, 0x15, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xD0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x05, 0x42, 0xD0, 0x54, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xFC, 0x40, 0x1D, 0x00, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x40, 0x1F, 0xF8, 0x3F, 0xFD, 0x7F,
-    0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x3F, 0xFE, 0x3F, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x28, 0x00, 0x0B,
-    0xD0, 0x02, 0xFF, 0x40, 0xBF, 0xFC, 0x2F, 0xFF, 0xDB, 0xFF, 0xD2, 0xFF, 0x80, 0xBE, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x8B, 0xF6, 0xFD, 0x7F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xF8, 0xBF, 0x40, 0x2F, 0xDB, 0xF8, 0x02, 0xFD, 0x7F, 0x00, 0x1F, 0xC0, 0x40, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xBD, 0xBF, 0x40, 0x3F, 0xC0,
-    0x0F, 0xFB, 0xF8, 0x03, 0xFC, 0x00, 0xFF, 0x7F, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x40, 0x00, 0x50,
-    0x00, 0x14, 0x00, 0x0F, 0xCB, 0xF6, 0xFE, 0x7F, 0x01, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xCB, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x50,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x55, 0xD0, 0x00, 0xD0, 0x00,
-    0xD0, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40,
-    0xFF, 0xFF, 0x55, 0x5B, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0B, 0xFF, 0xFF, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xF0,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x3C, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3D, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x43, 0xE0, 0x69, 0x00, 0x00, 0x68, 0x00, 0xF4, 0x07,
-    0xC2, 0xF0, 0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x2E, 0x02, 0xF0, 0xF4, 0xBE, 0xBF, 0x00, 0xFE, 0xBD,
-    0x07, 0xE6, 0xF4, 0xBC, 0x3D, 0x03, 0xD0, 0xBC, 0x0B, 0xC0, 0xBF, 0xF8, 0x3D, 0x1F, 0x00, 0xF8,
-    0x3E, 0x00, 0xF0, 0x06, 0xE4, 0x3F, 0x0B, 0xC0, 0x2F, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x1F, 0x02,
-    0xE0, 0x07, 0xC3, 0xC0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0xF8, 0x01, 0xF1, 0xF0, 0x03, 0xE0, 0x00,
-    0x07, 0xC0, 0x3E, 0x00, 0x7C, 0x7C, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x0B, 0x80, 0x1F, 0x0F, 0x00,
-    0x3E, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x0B, 0xC3, 0xD0, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x7C, 0x03,
-    0xE0, 0xF8, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x81, 0xF4, 0x1F, 0x03, 0xF0, 0x00, 0x3D, 0x00,
-    0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1F,
-    0x80, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x03, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x43, 0xE0, 0x19, 0x00, 0x00, 0x69, 0x00, 0x00, 0x69, 0x00,
-    0xF4, 0x07, 0xD1, 0xF0, 0xBF, 0xF8, 0x00, 0xFF, 0xF4, 0x01, 0xFF, 0xF0, 0x3F, 0x02, 0xF0, 0xF8,
-    0x7F, 0xBF, 0x40, 0xBF, 0xBF, 0x00, 0xFE, 0xFE, 0x07, 0xE6, 0xF8, 0x7C, 0x3F, 0x03, 0xF0, 0x3E,
-    0x07, 0xE0, 0xBD, 0x0B, 0xC0, 0xBF, 0xFC, 0x3E, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xBC, 0x3F, 0x00,
-    0xF8, 0x06, 0xE4, 0x2F, 0x07, 0xC0, 0x0F, 0x4B, 0xC0, 0x1F, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0x0F,
-    0x41, 0xF0, 0x03, 0xE3, 0xF0, 0x07, 0xC3, 0xD0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0xF8,
-    0xF8, 0x01, 0xF4, 0xF4, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x3E, 0x3E, 0x00, 0x7D, 0x3D,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x0F, 0x8B, 0xC0, 0x1F, 0x0F, 0x40, 0x2F, 0x00, 0x01,
-    0xF0, 0x01, 0xF4, 0x03, 0xD2, 0xF0, 0x0B, 0xC3, 0xE0, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x3E, 0x01,
-    0xF0, 0x7C, 0x03, 0xF0, 0xBC, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0xFC, 0x0F, 0x81, 0xF4,
-    0x1F, 0x42, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0xFD, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xF8, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7D, 0x00, 0xFC, 0x02, 0xF0, 0x03, 0xE0,
-    0x0B, 0xC0, 0x0F, 0x40, 0x2E, 0x00, 0x3C, 0x00, 0x74, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x0F, 0xC0,
-    0xF8, 0x02, 0xF0, 0x2F, 0x00, 0x3E, 0x03, 0xD0, 0x0B, 0xC0, 0xBC, 0x00, 0xF4, 0x0F, 0x00, 0x2E,
-    0x02, 0xE0, 0x03, 0xC0, 0x3C, 0x00, 0x74, 0x0B, 0x40, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0xBC, 0x00,
-    0xFC, 0x0F, 0x81, 0xF8, 0x02, 0xF0, 0x2F, 0x03, 0xF0, 0x03, 0xE0, 0x3D, 0x07, 0xD0, 0x0B, 0xC0,
-    0xBC, 0x0F, 0x80, 0x0F, 0x40, 0xF0, 0x1F, 0x00, 0x2E, 0x02, 0xE0, 0x3D, 0x00, 0x3C, 0x03, 0xC0,
-    0x7C, 0x00, 0x74, 0x0B, 0x40, 0xB0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x03,
-    0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2C, 0x7D, 0x0F, 0x80, 0x0F, 0xC2, 0xF0, 0x01,
-    0xF4, 0x3E, 0x00, 0x3F, 0x07, 0xC0, 0x03, 0xD0, 0xB8, 0x00, 0xBC, 0x0F, 0x00, 0x0F, 0x42, 0xE0,
-    0x01, 0xF0, 0x3C, 0x00, 0x2C, 0x07, 0x80, 0x7D, 0x0F, 0x82, 0xF0, 0x00, 0xFC, 0x2F, 0x03, 0xE0,
-    0x01, 0xF4, 0x3E, 0x0B, 0xC0, 0x03, 0xF0, 0x7C, 0x0F, 0x80, 0x03, 0xD0, 0xB8, 0x1F, 0x00, 0x0B,
-    0xC0, 0xF0, 0x2E, 0x00, 0x0F, 0x42, 0xE0, 0x3C, 0x00, 0x1F, 0x03, 0xC0, 0x78, 0x00, 0x2C, 0x07,
-    0x80, 0xB0, 0x00, 0x09, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xDF, 0x00, 0x00,
-    0xF2, 0xD0, 0x00, 0xB4, 0x3C, 0x00, 0x3C, 0x0B, 0x40, 0x2D, 0x00, 0xF0, 0x0F, 0x00, 0x2D, 0x0B,
-    0x40, 0x03, 0xC3, 0xC0, 0x00, 0xB4, 0x00, 0x04, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x0B, 0xD0, 0x0B,
-    0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x07,
-    0xF0, 0x00, 0x7E, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x07, 0xF0, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0xFC, 0x03, 0xF4, 0x0B, 0xD0, 0x2F, 0x80,
-    0x7E, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F,
-    0x40, 0x00, 0x10, 0x2F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x41, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0,
-    0x07, 0xF0, 0x01, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x01, 0x90, 0x01,
-    0xFF, 0xF0, 0x00, 0xA4, 0x3F, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xC7, 0xF4, 0x00, 0x3F, 0xC0, 0x01,
-    0xFC, 0x3F, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F,
-    0x00, 0x05, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x7E, 0x02, 0xF0, 0x00, 0x3F, 0x80,
-    0x01, 0xF4, 0x08, 0x00, 0x03, 0xF4, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x7E, 0x0F, 0xC0, 0x2F, 0xC3, 0xF0, 0x0B, 0xF0, 0xFC, 0x01, 0xFC, 0x3F, 0x00, 0x7E, 0x0F,
-    0xC0, 0x1F, 0x83, 0xF0, 0x07, 0xE0, 0xFC, 0x01, 0xF8, 0x3F, 0x00, 0x3E, 0x0F, 0xC0, 0x0F, 0x43,
-    0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF4, 0x2E, 0x00, 0x3D, 0x0B, 0x80, 0x0F, 0x42, 0xE0, 0x03, 0xC0,
-    0xB8, 0x00, 0xF0, 0x2D, 0x00, 0x3C, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x7E, 0x2F, 0xD0, 0x3F, 0xCB, 0xF8, 0x0F, 0xF1, 0xFC, 0x02, 0xFC, 0x04, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x03, 0xEF, 0xC2, 0xFC, 0x00,
-    0xBC, 0x07, 0xD0, 0x0B, 0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xF0, 0x0B, 0xC0, 0x3E, 0x00, 0xBC, 0x03,
-    0xE0, 0x07, 0xC0, 0xBC, 0x00, 0x7C, 0x1F, 0x80, 0x07, 0xCB, 0xE0, 0x00, 0x7E, 0xF8, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2A, 0xAA, 0xAA, 0xAA,
-    0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0xA0, 0x24, 0x00, 0x00, 0x00, 0x0C, 0x3C,
-    0x00, 0x00, 0x00, 0x2C, 0x0F, 0x00, 0x00, 0x00, 0xB4, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x01, 0xF8,
-    0x00, 0x1F, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x95, 0xBF, 0x00, 0x03, 0xE0, 0x00, 0x07,
-    0xC0, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x1D, 0x00, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x00, 0x1D,
-    0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80,
-    0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFF, 0x00, 0x02, 0xDB, 0x40, 0x03, 0xC3, 0xC0, 0x0B, 0x82, 0xC0, 0x0F, 0x01, 0xE0, 0x1E, 0x00,
-    0xF0, 0x3D, 0x00, 0x78, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0B, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE5, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x6A, 0xFF, 0xEA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x04, 0x00, 0x40, 0x01, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x24, 0x03, 0xD0, 0x05, 0x00, 0x14, 0x01, 0xF0, 0x02, 0x0F, 0xE4, 0xF5, 0xBF, 0xC0, 0x0B, 0xF9,
-    0x3C, 0x6F, 0xD7, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0xFF, 0xFA, 0x94,
-    0x00, 0x5A, 0xBF, 0xFE, 0xA5, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B,
-    0xEF, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0x02, 0xF1, 0xF8,
-    0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x00,
-    0xFC, 0x07, 0xF0, 0x00, 0xBC, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xDB, 0xFF, 0xF5, 0x55, 0x54, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xFF, 0x7E,
-    0xA9, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D,
-    0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7E, 0x55, 0x7F, 0xFF, 0x7F, 0xFF, 0x7D, 0x00, 0x7D, 0x00, 0x7D,
-    0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D,
-    0x00, 0x7F, 0xFF, 0x7F, 0xFF, 0x15, 0x55, 0x3F, 0xFF, 0x4F, 0xFF, 0xD2, 0xAB, 0xF4, 0x00, 0xBD,
-    0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4,
-    0x00, 0xBD, 0x00, 0x2F, 0x45, 0x5F, 0xD3, 0xFF, 0xF4, 0xFF, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xD0,
-    0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40,
-    0x0B, 0xD0, 0x02, 0xF4, 0xFF, 0xFD, 0x3F, 0xFF, 0x45, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xA5, 0xBF, 0x83, 0xFA, 0x5B, 0xFC, 0x24, 0x00, 0x0F, 0xC2, 0x40, 0x00, 0xFD, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x1F, 0x87, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xF0, 0xFE, 0x96, 0xFE, 0x02, 0xFC, 0x24, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x1F,
-    0x80, 0x00, 0x00, 0x3E, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x7E,
-    0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x03, 0xF4, 0x03, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0xF4,
-    0x00, 0x07, 0xF4, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xD0,
-    0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x1F, 0x80, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0xFE, 0x00, 0x00, 0xBF, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x6F, 0xFF, 0x80, 0x3F, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0x03, 0xFE, 0x5B, 0xFC, 0x3F, 0x01,
-    0x40, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x03,
-    0xF8, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x3E, 0x00, 0x00, 0x3F, 0x80, 0x2E, 0x00, 0x00, 0xFD, 0x00,
-    0x2E, 0x00, 0x02, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xE0, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x2D,
-    0x00, 0x03, 0xD0, 0x00, 0x04, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0xBF, 0x80, 0x0F,
-    0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0x04, 0x00, 0x01, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x57, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xAB, 0xFF, 0xFF, 0x83, 0xC0, 0xBF, 0xFF, 0xF4, 0xF0, 0x2F, 0xFF, 0xFF, 0x3C, 0x0B,
-    0xFF, 0xFF, 0xCF, 0x02, 0xFF, 0xFF, 0xF7, 0xC0, 0xBF, 0xFF, 0xFE, 0xF0, 0x2F, 0xFF, 0xFF, 0xBC,
-    0x0B, 0xFF, 0xFF, 0xEF, 0x02, 0xFF, 0xFF, 0xFB, 0xC0, 0xBF, 0xFF, 0xFD, 0xF0, 0x2F, 0xFF, 0xFF,
-    0x3C, 0x0B, 0xFF, 0xFF, 0xCF, 0x02, 0xFF, 0xFF, 0xD3, 0xC0, 0xBF, 0xFF, 0xE0, 0xF0, 0x2F, 0xFF,
-    0xD0, 0x3C, 0x0B, 0x40, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0xB4, 0x00, 0x00, 0xF0, 0x2D,
-    0x00, 0x00, 0x3C, 0x0B, 0x40, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0xB4, 0x00, 0x00, 0xF0,
-    0x2D, 0x00, 0x00, 0x3C, 0x0B, 0x40, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0xB4, 0x00, 0x00,
-    0xF0, 0x2D, 0x00, 0x00, 0x3C, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0x57, 0xD1, 0xFF, 0xFF, 0xF0, 0x2D, 0x2F,
-    0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0,
-    0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF,
-    0xFF, 0xF0, 0x2D, 0x2F, 0xFF, 0xFF, 0x02, 0xD0, 0xFF, 0xFF, 0xF0, 0x2D, 0x0B, 0xFF, 0xFF, 0xAB,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x1A, 0xAA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0x90, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3D, 0x5F, 0xFF, 0xFF, 0x03, 0xC0, 0xBF, 0xFF, 0xF8, 0x3C, 0x0B, 0xFF, 0xFF,
-    0xC3, 0xC0, 0xBF, 0xFF, 0xFC, 0x3C, 0x0B, 0xFF, 0xFF, 0xD3, 0xC0, 0xBF, 0xFF, 0xFD, 0x3C, 0x0B,
-    0xFF, 0xFF, 0xE3, 0xC0, 0xBF, 0xFF, 0xFD, 0x3C, 0x0B, 0xFF, 0xFF, 0xD3, 0xC0, 0xBF, 0xFF, 0xFC,
-    0x3C, 0x0B, 0xFF, 0xFF, 0xC3, 0xC0, 0xBF, 0xFF, 0xF8, 0x3E, 0xAF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x2A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x24, 0x03, 0xC0, 0x05, 0x7F,
-    0x93, 0xC6, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x1A, 0xBF, 0xFE, 0xA5, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xBC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x03, 0xF4, 0x0F, 0xD0, 0x02,
-    0xF0, 0x0B, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x04, 0x03, 0xF4, 0x7F, 0x87, 0xF8, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0x42, 0xF8, 0x0F, 0xC0, 0xFC, 0x07, 0xC0, 0x3D, 0x02, 0xE0, 0x05, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x95, 0xBF, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0B,
-    0x40, 0x00, 0x00, 0xF0, 0x1D, 0x00, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x00, 0x1D, 0x10, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0C, 0x3C, 0x00, 0x00, 0x00,
-    0x2C, 0x0F, 0x00, 0x00, 0x00, 0xB4, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x01, 0xF8, 0x00, 0x1F, 0x80,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x24, 0x03,
-    0xC0, 0x05, 0x7F, 0x93, 0xC6, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x1A, 0xBF, 0xFE, 0xA5, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x03, 0xF4,
-    0x0F, 0xD0, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x24, 0x03, 0xC0, 0x05, 0x7F, 0x93, 0xC6, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x1A, 0xBF,
-    0xFE, 0xA5, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x01, 0xFC,
-    0x2F, 0x80, 0x03, 0xF4, 0x0F, 0xD0, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x07, 0xCB, 0xF0, 0x03, 0xE2, 0xFC, 0x01, 0xF4, 0x3D, 0x00, 0xBC, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x07, 0xC0, 0x0A, 0x43, 0xF0, 0x0B, 0xF0, 0xF4, 0x02, 0xFC, 0xBC, 0x00, 0x7F, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00,
-    0x01, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0xBD, 0x00, 0x1B, 0xFF, 0xFE, 0x56, 0xF8,
-    0x3C, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x0D, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x96, 0xBF, 0x00, 0x02, 0xE0,
-    0x00, 0x0B, 0xC0, 0x0B, 0x40, 0x00, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00,
-    0x00, 0x2D, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x01, 0x80, 0xB8, 0x0D, 0x00, 0x3E, 0x0B, 0x83, 0xF0, 0x00, 0xF8, 0xB8, 0xFC, 0x00, 0x03, 0xEB,
-    0xBF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0x55, 0xBF, 0xF9, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xAA, 0xFF, 0xFA, 0xAA, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFB, 0xBF, 0x00, 0x00, 0xFC, 0xB8,
-    0xFC, 0x00, 0x3F, 0x0B, 0x83, 0xF0, 0x02, 0xC0, 0xB8, 0x0E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x06, 0x40, 0x00, 0x7D, 0x0B, 0xC0, 0xF8, 0x1F,
-    0x40, 0x3F, 0x07, 0xD0, 0xBC, 0x0F, 0xC0, 0x2F, 0x03, 0xF0, 0x3D, 0x0B, 0xC0, 0x0F, 0x81, 0xF0,
-    0x2F, 0x03, 0xE0, 0x0B, 0xC0, 0xF8, 0x0F, 0x02, 0xF0, 0x03, 0xD0, 0x7C, 0x0B, 0x80, 0xF4, 0x02,
-    0xE0, 0x3D, 0x03, 0xC0, 0xB8, 0x00, 0xF0, 0x1E, 0x02, 0xD0, 0x3C, 0x00, 0x74, 0x0B, 0x00, 0xE0,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1A,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x43,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x42, 0x40, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x0F, 0xC3, 0xF8, 0xFE, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x83, 0xF4, 0xFE, 0x3F, 0x41, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x10, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x02, 0xFC,
-    0x1E, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x0F, 0x80, 0x09, 0x00, 0x03, 0xF8, 0x03, 0xE0, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0xF8, 0x03,
-    0xF8, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0xFD, 0x00, 0x01, 0x40, 0x0F, 0x80, 0x05, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD5, 0x55, 0x55, 0x7E, 0x55, 0x55, 0x50, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3E,
-    0x00, 0x10, 0x00, 0x0F, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xE0, 0x1F, 0xD0, 0x00,
-    0xFE, 0x00, 0xF8, 0x07, 0xF0, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xCB, 0xF6, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91, 0xFD, 0xBF, 0x9F,
-    0xD2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xDB, 0xF9, 0xFC, 0x04, 0x00, 0x00,
-    0x0F, 0xCB, 0xF6, 0xFD, 0x3F, 0x01, 0x00, 0x00, 0x10, 0x7F, 0x2F, 0xEB, 0xF4, 0xFC, 0x00, 0x00,
-    0x02, 0xA1, 0xFD, 0xBF, 0x9F, 0xD2, 0x90, 0x00, 0x00, 0x0F, 0xCB, 0xF6, 0xFE, 0x7F, 0x01, 0x00,
-    0xFF, 0xFF, 0x57, 0xD5, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x5B, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xE0, 0x0B, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40,
-    0xBF, 0xFE, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0,
-    0x0F, 0xF0, 0x1F, 0xF4, 0x3F, 0xFC, 0xBF, 0xFE, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x01, 0x40, 0x02, 0x80, 0x0B, 0xE0, 0x2C, 0x38, 0xB0, 0x0E, 0x3C, 0x3C, 0x0F, 0xF0, 0x03, 0xC0,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0x80, 0x57, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x01, 0x40, 0x00, 0x14, 0x00, 0x1F, 0xFE, 0x00, 0xFE, 0xFE, 0x0B, 0xC0, 0x7C, 0x3E, 0x00, 0xF8,
-    0xF4, 0x02, 0xF7, 0xC0, 0x07, 0xDF, 0x00, 0x1F, 0x7C, 0x00, 0x7D, 0xF0, 0x01, 0xF3, 0xD0, 0x0B,
-    0xCF, 0x80, 0x3E, 0x2F, 0x01, 0xF4, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x05, 0x00, 0x00, 0xF3,
-    0x80, 0x10, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0xB7, 0xD0, 0x01, 0xE3, 0xD0, 0x03, 0xC3, 0xD0, 0x0F,
-    0x43, 0xD0, 0x1E, 0x03, 0xD0, 0x3C, 0x03, 0xD0, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x03,
-    0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x7E,
-    0xAA, 0x87, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0xBF, 0xF8, 0x0B, 0xFF, 0xF4, 0x10, 0x1F,
-    0xC0, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0x3E, 0x40, 0x07, 0xDF, 0xAA, 0xFC, 0xFF, 0xFE, 0x00,
-    0x55, 0x00, 0x00, 0x05, 0x40, 0x00, 0xFF, 0xF0, 0x07, 0xFA, 0xA0, 0x0F, 0x80, 0x00, 0x2E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3C, 0xBF, 0x80, 0x7F, 0xFF, 0xF0, 0x7F, 0x00, 0xF8, 0x7C, 0x00, 0x7C,
-    0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x7C, 0x2F, 0x00, 0xF8, 0x0F, 0xEB, 0xF0, 0x03, 0xFF, 0xD0, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0,
-    0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xC0,
-    0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x1F, 0xFF, 0x00, 0xF9, 0xBF, 0x0B, 0xC0, 0x3D, 0x2E, 0x00, 0xF4, 0xBC, 0x07, 0xC0, 0xFE,
-    0xBD, 0x00, 0xFF, 0xD0, 0x0B, 0xEF, 0xD0, 0xBC, 0x0B, 0xD3, 0xD0, 0x0B, 0x8F, 0x00, 0x1F, 0x3D,
-    0x00, 0xF8, 0xBE, 0x6F, 0xC0, 0xBF, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x2F, 0xFE, 0x02,
-    0xF9, 0xBE, 0x0F, 0x40, 0x3D, 0x7C, 0x00, 0xB9, 0xF0, 0x01, 0xF7, 0xC0, 0x0B, 0xCF, 0x80, 0x7F,
-    0x1F, 0xFF, 0xBC, 0x1F, 0xF5, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x2A, 0xBF,
-    0x00, 0xFF, 0xE0, 0x01, 0x54, 0x00, 0x00, 0x40, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00,
-    0xAB, 0xFA, 0x8F, 0xFF, 0xFC, 0x01, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x09, 0x00, 0xAA,
-    0xAA, 0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x78, 0x0F, 0x02, 0xE0, 0x3C, 0x07, 0xC0, 0xB4,
-    0x0F, 0x40, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x40, 0xB4, 0x07, 0x80, 0x3C, 0x03, 0xD0, 0x1F, 0x00,
-    0xB4, 0x02, 0x80, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x03, 0xC0, 0x3D, 0x02,
-    0xD0, 0x2D, 0x02, 0xD0, 0x2D, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xF4, 0x1F, 0x03, 0xD0, 0x64, 0x00,
-    0x10, 0x15, 0x00, 0xEB, 0xFF, 0x83, 0xF4, 0x1F, 0x4F, 0x00, 0x1E, 0x3C, 0x00, 0x38, 0xF0, 0x00,
-    0xE3, 0x80, 0x03, 0x8E, 0x00, 0x0E, 0x38, 0x00, 0x38, 0xE0, 0x00, 0xE3, 0x80, 0x03, 0x85, 0x00,
-    0x05, 0x00, 0x14, 0x00, 0x1F, 0xFE, 0x00, 0xFE, 0xFE, 0x0B, 0xC0, 0x7C, 0x3E, 0x00, 0xF8, 0xF4,
-    0x02, 0xF7, 0xC0, 0x07, 0xDF, 0x00, 0x1F, 0x7C, 0x00, 0x7D, 0xF0, 0x01, 0xF3, 0xD0, 0x0B, 0xCF,
-    0x80, 0x3E, 0x2F, 0x01, 0xF4, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0xBF, 0xDF, 0xEF, 0x7C, 0x7C, 0x41, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07,
-    0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x54, 0x00, 0x2F, 0xFE, 0x03, 0xFA,
-    0xBE, 0x02, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x7F, 0xFF, 0x03, 0xF9, 0xBF, 0x05, 0x00, 0x7C,
-    0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0xBD, 0x01, 0xFF, 0xD0, 0x02, 0xAF, 0xE0, 0x00, 0x07,
-    0xD0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF5, 0xFA, 0xAF, 0xC7, 0xFF, 0xF8, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0xB7, 0xD0,
-    0x01, 0xE3, 0xD0, 0x03, 0xC3, 0xD0, 0x0F, 0x43, 0xD0, 0x1E, 0x03, 0xD0, 0x3C, 0x03, 0xD0, 0xBF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x7E, 0xAA, 0x87, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00,
-    0xBF, 0xF8, 0x0B, 0xFF, 0xF4, 0x10, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0x3E, 0x40,
-    0x07, 0xDF, 0xAA, 0xFC, 0xFF, 0xFE, 0x00, 0x55, 0x00, 0x00, 0x05, 0x40, 0x00, 0xFF, 0xF0, 0x07,
-    0xFA, 0xA0, 0x0F, 0x80, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0xBF, 0x80, 0x7F, 0xFF,
-    0xF0, 0x7F, 0x00, 0xF8, 0x7C, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x7C, 0x2F, 0x00, 0xF8,
-    0x0F, 0xEB, 0xF0, 0x03, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00,
-    0x1F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1F, 0xFF, 0x00, 0xF9, 0xBF, 0x0B, 0xC0, 0x3D,
-    0x2E, 0x00, 0xF4, 0xBC, 0x07, 0xC0, 0xFE, 0xBD, 0x00, 0xFF, 0xD0, 0x0B, 0xEF, 0xD0, 0xBC, 0x0B,
-    0xD3, 0xD0, 0x0B, 0x8F, 0x00, 0x1F, 0x3D, 0x00, 0xF8, 0xBE, 0x6F, 0xC0, 0xBF, 0xFC, 0x00, 0x15,
-    0x00, 0x00, 0x54, 0x00, 0x2F, 0xFE, 0x02, 0xF9, 0xBE, 0x0F, 0x40, 0x3D, 0x7C, 0x00, 0xB9, 0xF0,
-    0x01, 0xF7, 0xC0, 0x0B, 0xCF, 0x80, 0x7F, 0x1F, 0xFF, 0xBC, 0x1F, 0xF5, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x3C, 0x00, 0x03, 0xE0, 0x2A, 0xBF, 0x00, 0xFF, 0xE0, 0x01, 0x54, 0x00, 0x00, 0x40, 0x00,
-    0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0xAB, 0xFA, 0x8F, 0xFF, 0xFC, 0x01, 0xE0, 0x00, 0x0E,
-    0x00, 0x00, 0xE0, 0x00, 0x09, 0x00, 0xAA, 0xAA, 0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0xAA,
-    0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x78,
-    0x0F, 0x02, 0xE0, 0x3C, 0x07, 0xC0, 0xB4, 0x0F, 0x40, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x40, 0xB4,
-    0x07, 0x80, 0x3C, 0x03, 0xD0, 0x1F, 0x00, 0xB4, 0x02, 0x80, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0xF0,
-    0x0B, 0x80, 0x3C, 0x03, 0xC0, 0x3D, 0x02, 0xD0, 0x2D, 0x02, 0xD0, 0x2D, 0x03, 0xC0, 0x3C, 0x07,
-    0x80, 0xF4, 0x1F, 0x03, 0xD0, 0x64, 0x00, 0x06, 0xA9, 0x02, 0xFF, 0xF8, 0x04, 0x03, 0xC0, 0x00,
-    0x2D, 0x00, 0x02, 0xD1, 0xFF, 0xFD, 0x7D, 0x02, 0xDF, 0x00, 0x2D, 0xF0, 0x03, 0xDF, 0x81, 0xFD,
-    0x3F, 0xF8, 0xD0, 0x54, 0x00, 0x01, 0xA9, 0x00, 0x3F, 0xFE, 0x03, 0xD0, 0x2D, 0x1E, 0x00, 0x3C,
-    0xB4, 0x00, 0xF3, 0xFF, 0xFF, 0xCF, 0x40, 0x00, 0x2D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x01,
-    0x40, 0xBF, 0xFD, 0x00, 0x15, 0x40, 0x01, 0xA9, 0x00, 0x3F, 0xFF, 0x03, 0xD0, 0x1F, 0x1E, 0x00,
-    0x1E, 0xB4, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xED, 0x00, 0x1E, 0x7C, 0x00, 0xB4, 0xB8,
-    0x0B, 0xC0, 0xBF, 0xF8, 0x00, 0x15, 0x00, 0x24, 0x00, 0x64, 0x2E, 0x00, 0xF0, 0x0F, 0x43, 0xD0,
-    0x03, 0xCB, 0x80, 0x01, 0xFF, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xDF, 0x00, 0x0B,
-    0x83, 0xC0, 0x1F, 0x01, 0xE0, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF1, 0xAA, 0xAB, 0xCF, 0xFF, 0xFF, 0x3C, 0x00,
-    0x3C, 0xB4, 0x01, 0xE0, 0xF4, 0x1F, 0x00, 0xFF, 0xE0, 0x00, 0x14, 0x00, 0x38, 0x00, 0x00, 0xE0,
-    0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x6A, 0x40, 0xEF, 0xFF, 0xC3, 0xE0, 0x0F, 0x4F,
-    0x00, 0x1E, 0x3C, 0x00, 0x38, 0xE0, 0x00, 0xE3, 0x80, 0x03, 0x8E, 0x00, 0x0E, 0x38, 0x00, 0x38,
-    0xE0, 0x00, 0xE3, 0x80, 0x03, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00,
-    0x0E, 0x00, 0x00, 0x38, 0x00, 0x90, 0xE0, 0x1F, 0x03, 0x81, 0xF0, 0x0E, 0x1F, 0x00, 0x39, 0xF0,
-    0x00, 0xFF, 0x80, 0x03, 0xEB, 0x80, 0x0F, 0x0F, 0x40, 0x38, 0x0F, 0x00, 0xE0, 0x1F, 0x03, 0x80,
-    0x2F, 0x00, 0x00, 0x00, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x80,
-    0x20, 0x6A, 0x01, 0xA9, 0x03, 0xBF, 0xFD, 0xBF, 0xF8, 0x3E, 0x01, 0xFC, 0x03, 0xD3, 0xC0, 0x0F,
-    0x40, 0x1D, 0x3C, 0x00, 0xF0, 0x01, 0xE3, 0x80, 0x0F, 0x00, 0x1E, 0x38, 0x00, 0xF0, 0x01, 0xE3,
-    0x80, 0x0F, 0x00, 0x1E, 0x38, 0x00, 0xF0, 0x01, 0xE3, 0x80, 0x0F, 0x00, 0x1E, 0x38, 0x00, 0xF0,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x6A, 0x40, 0xEF, 0xFF, 0xC3, 0xE0, 0x0F, 0x4F, 0x00,
-    0x1E, 0x3C, 0x00, 0x38, 0xE0, 0x00, 0xE3, 0x80, 0x03, 0x8E, 0x00, 0x0E, 0x38, 0x00, 0x38, 0xE0,
-    0x00, 0xE3, 0x80, 0x03, 0x80, 0x00, 0x00, 0x20, 0x6A, 0x40, 0x3B, 0xFF, 0xE0, 0x3E, 0x00, 0xF4,
-    0x3C, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x38, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3D,
-    0x00, 0x78, 0x3F, 0x41, 0xF0, 0x3A, 0xFF, 0xD0, 0x38, 0x15, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x06, 0xA8, 0x1F, 0xFF, 0xCF, 0x00, 0x03, 0xC0, 0x00,
-    0x7D, 0x00, 0x07, 0xF9, 0x00, 0x1B, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0x64, 0x07, 0xCF, 0xFF, 0xD0,
-    0x15, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x1F, 0xA8, 0xBF, 0xFC, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00,
-    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0xFD, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0xB0, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0xAA, 0xAA, 0x7F, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0xF4, 0x03, 0xF0,
-    0x00, 0x7E, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFA, 0xA9, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0x7F, 0x55, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x03,
-    0xC1, 0xE0, 0x00, 0x00, 0x78, 0x2E, 0x00, 0x00, 0x0B, 0xE7, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF0, 0x7F, 0x80, 0x7F, 0x5E, 0x0B, 0x80, 0x0F, 0xD2, 0xD0,
-    0xF4, 0x01, 0xFC, 0x3D, 0x0F, 0x00, 0x3F, 0x43, 0xC0, 0xF0, 0x03, 0xF0, 0x3C, 0x1E, 0x00, 0x3F,
-    0x07, 0x82, 0xE0, 0x07, 0xE0, 0xB4, 0x3D, 0x00, 0x7E, 0x0F, 0x43, 0xC0, 0x03, 0xE0, 0xF0, 0x3C,
-    0x00, 0x3F, 0x1F, 0x07, 0x80, 0x03, 0xF1, 0xE0, 0xB4, 0x00, 0x2F, 0x6D, 0x0F, 0x40, 0x01, 0xFF,
-    0xC0, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0x00, 0x00, 0x3F, 0xD1, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xAF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xF6, 0xFF, 0xF9, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x01, 0xF0,
-    0x78, 0x00, 0x00, 0x1E, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40,
-    0x02, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x56, 0xFD, 0x03, 0xFD, 0x00, 0x01, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x06, 0x42, 0xE4, 0xFC, 0x03, 0xE7, 0xFD, 0x3F, 0x00, 0xFF, 0xFB, 0x4F, 0xC0,
-    0x3F, 0xD0, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x0B,
-    0xD0, 0x3F, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0xFC, 0x00,
-    0x00, 0xFE, 0x3F, 0x00, 0x00, 0x1F, 0xFF, 0xC5, 0xB0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1A, 0xFE,
-    0xAA, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xAF, 0xFA, 0xA0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x56, 0xF8, 0x00, 0xFD, 0x00,
-    0x04, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x06, 0xBF, 0xAA, 0xA8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x6B,
-    0xFE, 0xAA, 0x80, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x15, 0xFE, 0x55, 0x50, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x2F, 0xFD, 0x0F, 0xFF, 0xF8, 0x03,
-    0xD7, 0xFF, 0xFE, 0x7F, 0xFF, 0xFC, 0x0F, 0xFE, 0x56, 0xFF, 0xF9, 0x5B, 0xF8, 0x3F, 0xC0, 0x02,
-    0xFF, 0x40, 0x03, 0xF0, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x4F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0x4F, 0xC0, 0x01, 0xFF,
-    0x00, 0x00, 0x7D, 0x3F, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x07,
-    0xD3, 0xF0, 0x03, 0xDF, 0xC0, 0x00, 0x1F, 0x4F, 0xC0, 0x1F, 0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x00,
-    0xF8, 0xFC, 0x00, 0x01, 0xF4, 0xFC, 0x07, 0xC3, 0xF0, 0x00, 0x07, 0xD3, 0xF0, 0x2E, 0x0F, 0xC0,
-    0x00, 0x1F, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x1F, 0x00, 0x0F, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0xD0, 0x02, 0xF0, 0x00, 0xFF, 0x80, 0x0B,
-    0xC0, 0x03, 0xFF, 0x00, 0x2F, 0x00, 0x0F, 0xBD, 0x00, 0xBC, 0x00, 0x3D, 0xFC, 0x02, 0xF0, 0x00,
-    0xF5, 0xF0, 0x0B, 0xC0, 0x6B, 0xFB, 0xFA, 0xBF, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xBF, 0xAF,
-    0xAB, 0xFA, 0x40, 0xF4, 0x3E, 0x07, 0xC0, 0x03, 0xE0, 0xBC, 0x1F, 0x01, 0xAF, 0xEB, 0xFE, 0xFE,
-    0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xF9, 0x5B, 0xEB, 0xE5, 0x03, 0xE0, 0x0F, 0x9F, 0x00, 0x0F,
-    0x80, 0x3F, 0x7C, 0x00, 0x3E, 0x00, 0x7E, 0xF0, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xE0, 0x02,
-    0xFF, 0x00, 0x0F, 0x80, 0x07, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0xF8, 0x00, 0x2F, 0xC0,
-    0x7F, 0xFA, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x1F, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x1E, 0x00, 0x7D, 0x00,
-    0x0B, 0xD0, 0xB8, 0x01, 0xF4, 0x00, 0x3F, 0x03, 0xE0, 0x07, 0xD0, 0x02, 0xFC, 0x7F, 0xFF, 0x1F,
-    0x40, 0x6F, 0xCB, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0x16, 0xFD, 0x51, 0xFF, 0xFF, 0xD0, 0x03, 0xE0,
-    0x07, 0xFA, 0x90, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0xF8, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x00,
-    0x00, 0x3E, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0x9F, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x3F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F,
-    0x80, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x07, 0xFF, 0xD0, 0xF8, 0x00, 0x3F, 0x07,
-    0xFF, 0xFC, 0x3E, 0x00, 0x1F, 0x83, 0xF8, 0x5E, 0x0F, 0x80, 0x0B, 0xD1, 0xF8, 0x00, 0x03, 0xE0,
-    0x03, 0xF0, 0x7D, 0x00, 0x00, 0xF9, 0x5B, 0xF8, 0x1F, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x03, 0xF8,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xD0, 0x03, 0xE0, 0x7F, 0x00, 0x0B, 0xFE, 0x00, 0xF8, 0x0F,
-    0xC0, 0x00, 0x7F, 0xF0, 0x3E, 0x01, 0xF8, 0x00, 0x01, 0xFF, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x0F,
-    0xC3, 0xE0, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x2F,
-    0x40, 0x00, 0x2F, 0x4F, 0x80, 0x07, 0xF2, 0xD0, 0x1F, 0xC3, 0xE0, 0x00, 0xFD, 0xBF, 0xFF, 0xD0,
-    0xF8, 0x00, 0x1F, 0x9F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7D, 0x00, 0x1F,
-    0x80, 0x03, 0xE3, 0xD0, 0x02, 0xFC, 0x00, 0x3E, 0x3E, 0x00, 0x2F, 0xC0, 0x07, 0xD3, 0xF0, 0x03,
-    0xFD, 0x00, 0x7C, 0x2F, 0x00, 0x3E, 0xE0, 0x0B, 0xC1, 0xF0, 0x07, 0xDE, 0x00, 0xBC, 0x1F, 0x40,
-    0x79, 0xF0, 0x0F, 0x80, 0xF4, 0x0B, 0x8F, 0x00, 0xF8, 0x0F, 0x80, 0xF4, 0xF4, 0x0F, 0x40, 0xFC,
-    0x0F, 0x4F, 0x41, 0xF0, 0x0B, 0xC1, 0xF4, 0xB8, 0x2F, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3D, 0x2E, 0x03, 0xC3, 0xE0, 0x03, 0xE3, 0xD0, 0x3D, 0x3D, 0x00,
-    0x3E, 0x3D, 0x02, 0xD3, 0xC0, 0x02, 0xF3, 0xC0, 0x2E, 0x7C, 0x00, 0x1F, 0x7C, 0x01, 0xF7, 0xC0,
-    0x00, 0xF7, 0x80, 0x0F, 0xB8, 0x00, 0x0F, 0xF8, 0x00, 0xFB, 0x80, 0x00, 0xFF, 0x40, 0x0F, 0xF4,
-    0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x7F,
-    0x00, 0x3F, 0xFF, 0xE9, 0x00, 0x02, 0xE3, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x3F, 0xAA, 0xAF, 0xF0,
-    0x03, 0xF3, 0xE0, 0x00, 0x2F, 0x80, 0x3F, 0x3E, 0x00, 0x00, 0xFC, 0x03, 0xF3, 0xE0, 0x00, 0x07,
-    0xD0, 0x3F, 0x3E, 0x02, 0x90, 0x3E, 0x03, 0xF3, 0xE0, 0x3E, 0x03, 0xE0, 0x3F, 0x3E, 0x03, 0xE0,
-    0x3E, 0x03, 0xF3, 0xE0, 0x3E, 0x03, 0xE0, 0x3F, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xF3, 0xE0, 0x3E,
-    0x03, 0xE0, 0x3F, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xF3, 0xE0, 0x3E, 0x03, 0xE0, 0x3F, 0x3E, 0x03,
-    0xE0, 0x3E, 0x03, 0xF3, 0xE0, 0x3E, 0x03, 0xE0, 0x3F, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xF3, 0xE0,
-    0x3E, 0x03, 0xE0, 0x3F, 0x3E, 0x03, 0xE0, 0x00, 0x03, 0xE3, 0xE0, 0x3E, 0x00, 0x00, 0x7D, 0x3E,
-    0x03, 0xE0, 0x00, 0x1F, 0xC3, 0xE0, 0x3E, 0x55, 0x5B, 0xF4, 0x3E, 0x03, 0xFF, 0xFF, 0xFD, 0x03,
-    0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x55, 0x6F, 0xD4, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xFD,
-    0x1F, 0x80, 0x01, 0xFF, 0xFF, 0x8F, 0x80, 0x07, 0xFD, 0x5B, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0xFF,
-    0x80, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x2F, 0x80,
-    0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x06, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xCF, 0x80, 0x00, 0x7F, 0xFE, 0x0F, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0x9A, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x50, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0x7F, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x95, 0x6F, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x01, 0xF0, 0x00, 0x02, 0xF4, 0x02, 0xF0, 0x00, 0x0B, 0xE0, 0x02, 0xF0, 0x00, 0x1F, 0xC0,
-    0x02, 0xF0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x02,
-    0xF0, 0x0B, 0xE0, 0x00, 0x02, 0xF0, 0x1F, 0xC0, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0xFC, 0x00, 0x00, 0x16, 0xF7, 0xF9, 0x55, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFE, 0x7E, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x02, 0xF0, 0x0F, 0xC0,
-    0x00, 0x02, 0xF0, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x02, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00,
-    0x02, 0xF0, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x80, 0x02, 0xF0, 0x00, 0x0F, 0xD0, 0x02,
-    0xF0, 0x00, 0x07, 0xF0, 0x02, 0xF0, 0x00, 0x02, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xE0, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xFC, 0x1E, 0x00, 0x0F, 0xE3, 0xF3, 0xFC, 0x00, 0x1D, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x01, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xA5, 0x6F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF4,
-    0x02, 0xFF, 0x80, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x1F, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x07, 0xE0,
-    0x3F, 0x97, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0xBD, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0xC0,
-    0xFC, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x7F, 0x41, 0xF8, 0x00, 0xFC, 0x0B, 0xD0, 0x01, 0xFE, 0x02,
-    0xF4, 0x00, 0xFC, 0x0B, 0xC0, 0x1F, 0xF8, 0x03, 0xF0, 0x02, 0xF8, 0x0F, 0xEA, 0xFF, 0xD0, 0x03,
-    0xF8, 0x0B, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0x90, 0x00, 0x07,
-    0xEF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00,
-    0xF8, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0xF8,
-    0x00, 0x00, 0x7D, 0x1F, 0x00, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x10, 0x0B, 0xE0, 0x00,
-    0x0B, 0x00, 0xFF, 0x00, 0x00, 0xF4, 0x2F, 0xF8, 0x00, 0x2F, 0xC7, 0xDF, 0xC0, 0x03, 0xFE, 0xFC,
-    0xBD, 0x00, 0xBD, 0xFF, 0x03, 0xE0, 0x0F, 0x4F, 0xE0, 0x3F, 0x03, 0xF0, 0x3C, 0x01, 0xF4, 0x7D,
-    0x02, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x09, 0x6F, 0x80, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x3F, 0xAB, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x03, 0xF0, 0x00, 0x7F, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xBF, 0xAA, 0xAB, 0xFE, 0x80, 0xFC, 0x00, 0x07, 0xE0, 0x03, 0xF0,
-    0x00, 0x1F, 0x80, 0x5F, 0xD5, 0x55, 0xBE, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xFE, 0xAA, 0xAF,
-    0xE9, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC1, 0x6F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0x90, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xEB, 0xFC, 0x03, 0xFE, 0x0B, 0x80, 0x24, 0x0F, 0xF4, 0x0B, 0x80, 0x00, 0x1F, 0xC0, 0x0B,
-    0x80, 0x00, 0x3F, 0x80, 0x0B, 0x80, 0x00, 0x7F, 0x00, 0x0B, 0x80, 0x00, 0xBE, 0x00, 0x0B, 0x80,
-    0x00, 0xFD, 0x00, 0x0B, 0x80, 0x00, 0xFD, 0x00, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xEA, 0xA9,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0x80, 0x7F, 0xBE,
-    0x00, 0x0B, 0x80, 0x3F, 0x7F, 0x00, 0x0B, 0x80, 0x3F, 0x3F, 0x40, 0x0B, 0x80, 0x3F, 0x2F, 0xC0,
-    0x0B, 0x80, 0x3F, 0x0F, 0xE0, 0x0B, 0x80, 0x3F, 0x07, 0xFC, 0x0B, 0x80, 0x3F, 0x02, 0xFF, 0xEB,
-    0x96, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x0B, 0x90,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00,
-    0x7F, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07,
-    0xF0, 0x00, 0x0B, 0xE0, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x7E,
-    0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x47, 0xE0,
-    0x00, 0x00, 0x07, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xEA, 0xBF, 0xF0, 0x02, 0x40, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0x80, 0x00,
-    0x06, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x56, 0xFF, 0x95, 0x55, 0x5B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xEA, 0xAA, 0xAA, 0xA1, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x14, 0x07, 0xFE, 0x55, 0xAF,
-    0x80, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xEF, 0xAF, 0xD0, 0x0F, 0xF4, 0x3C, 0x06, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0x0B,
-    0xF0, 0x03, 0xC0, 0x00, 0x3F, 0x40, 0x0F, 0x00, 0x01, 0xFC, 0x00, 0x3C, 0x00, 0x0B, 0xE0, 0x00,
-    0xF0, 0x00, 0x3F, 0x40, 0x03, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x00, 0x3C, 0x00,
-    0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0x00, 0x02, 0xF8,
-    0x00, 0x3C, 0x00, 0x07, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0xD0, 0x03, 0xC0, 0x00, 0x3F, 0xC0, 0x0F,
-    0x00, 0x00, 0x7F, 0x80, 0x3C, 0x00, 0x00, 0xBF, 0x80, 0xF0, 0x00, 0x00, 0xBF, 0xEB, 0xD6, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-    0xF0, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x17, 0xF9, 0x6B, 0xF5, 0x54, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x01, 0xFD, 0x05, 0x03, 0xF0, 0x00, 0xFF,
-    0xFE, 0x03, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF9,
-    0x5B, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x28, 0x0A, 0x80,
-    0xA4, 0x07, 0xE3, 0xFD, 0xFF, 0xDF, 0xFC, 0x0F, 0x8C, 0x7D, 0x0F, 0xD0, 0xF0, 0x3E, 0x35, 0xF0,
-    0x1E, 0x02, 0xD1, 0xF4, 0xBB, 0x80, 0x74, 0x0B, 0x4F, 0xC0, 0xBF, 0x41, 0xD0, 0x2E, 0xFD, 0x00,
-    0xBF, 0xFF, 0xEA, 0xFF, 0xD0, 0x00, 0xEB, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0x80, 0x79, 0x5B, 0x40,
-    0x00, 0x0E, 0x01, 0xD0, 0x2D, 0x00, 0x00, 0x24, 0x02, 0x40, 0x60, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xAA, 0xAA, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xD1,
-    0x6F, 0xF9, 0x55, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xFF,
-    0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD,
-    0x00, 0x06, 0xBF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x6C, 0x00, 0x00, 0xFC, 0x6F, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x7E, 0xFC, 0x02, 0xF0, 0x00, 0x43, 0xF1, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x02, 0xA1,
-    0xE7, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xD0, 0x00, 0xFC, 0x01, 0xFE, 0x00, 0x03, 0xF5, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0xAA, 0xAA, 0xA4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x3D,
-    0x0A, 0x02, 0x40, 0x2D, 0x00, 0x03, 0xD3, 0xF4, 0xBD, 0x02, 0xD0, 0x00, 0x3E, 0xFF, 0xFF, 0xF4,
-    0x3C, 0x00, 0x03, 0xFE, 0x2F, 0xD7, 0xEF, 0xC0, 0x00, 0x3F, 0x80, 0xB0, 0x0F, 0xF0, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE5, 0x56, 0x40, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFA,
-    0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFE,
-    0x03, 0xF0, 0x7F, 0xE0, 0x0B, 0xF0, 0x03, 0xF0, 0x0B, 0xF0, 0x0F, 0xD0, 0x03, 0xF0, 0x02, 0xF8,
-    0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xBD, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x7E, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x3F, 0x00,
-    0x02, 0x90, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x02, 0xFF, 0xFE, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xEA, 0xFF, 0xF8,
-    0x00, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x2F, 0x80, 0x3F, 0x00, 0x01, 0xFD, 0x00, 0xFD, 0x41, 0xBF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFE, 0x02,
-    0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0x95, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x01, 0xAF, 0xFA, 0xA8, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0xFE, 0x55, 0x40,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x64, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x40, 0x00, 0x00,
-    0x02, 0xF5, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFE, 0x0B, 0xFF, 0x80, 0x0B, 0xF2, 0xE0, 0xB4, 0xFD, 0x01, 0xFC, 0x2E, 0x0B, 0x43, 0xF0,
-    0x3F, 0x42, 0xE0, 0xB4, 0x2F, 0x83, 0xF0, 0x2E, 0x0B, 0x40, 0xFC, 0x7E, 0x02, 0xE0, 0xB4, 0x0F,
-    0xDB, 0xD0, 0x2E, 0x0B, 0x40, 0xBD, 0xFD, 0x02, 0xE0, 0xB4, 0x0B, 0xEF, 0xD0, 0x2E, 0x0B, 0x40,
-    0x7E, 0xFD, 0x00, 0x40, 0x50, 0x01, 0x5B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x17, 0xFF, 0xAA, 0xAA, 0xA0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x2D, 0x0F, 0x00, 0x00, 0xB4,
-    0x3C, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0x00, 0x07,
-    0xF8, 0xFC, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0xFC,
-    0xFC, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x7F, 0x0F, 0xFA, 0xAF, 0xF4, 0x3F, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0x83, 0xF0, 0x00, 0x7F, 0xCF, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xBE, 0xFC, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x0B,
-    0xF3, 0xFA, 0xAA, 0xFF, 0x8F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xD0, 0xF0, 0x00,
-    0x0B, 0x43, 0xC0, 0x00, 0x2D, 0x0F, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xE5, 0xBC, 0x0F, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x0B, 0xF9, 0x06, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xA8, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x5B, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00,
+static const uint8_t notosans_16_regularBitmaps[36729] = {
+    0x8D, 0x55, 0xBF, 0x6F, 0xE4, 0x44, 0x14, 0x7E, 0xB6, 0x73, 0xE7, 0xC2, 0x42, 0x93, 0x02, 0x1A,
+    0x52, 0x4C, 0x43, 0x85, 0x44, 0xDC, 0x5E, 0x71, 0xD9, 0xF1, 0x09, 0x51, 0x51, 0x90, 0xE2, 0x02,
+    0x45, 0x0A, 0x7A, 0x9A, 0xFC, 0x03, 0x7B, 0xB1, 0x73, 0x57, 0x50, 0xD0, 0x04, 0xA1, 0xA3, 0xA1,
+    0xA2, 0xA0, 0x20, 0x4D, 0x9A, 0x2B, 0x52, 0xEC, 0x9E, 0x87, 0x8B, 0x44, 0x0A, 0x1A, 0x03, 0x42,
+    0x57, 0xA4, 0xB1, 0x44, 0xD2, 0x5C, 0x65, 0x71, 0x0E, 0x72, 0xA4, 0xF1, 0x0E, 0xDF, 0xE7, 0xDD,
+    0x4D, 0x72, 0x11, 0x12, 0xD8, 0x7A, 0x63, 0xFB, 0xCD, 0xBC, 0xDF, 0xDF, 0x7B, 0x36, 0xEA, 0xB8,
+    0x71, 0x66, 0xB9, 0x74, 0xEB, 0xC9, 0xE3, 0xFA, 0xE8, 0x83, 0x40, 0x44, 0x4C, 0x7A, 0x7A, 0xE9,
+    0x56, 0x64, 0x92, 0x9C, 0xDA, 0x29, 0x97, 0xF1, 0x24, 0x3E, 0xB1, 0xE3, 0x71, 0x74, 0x62, 0xEF,
+    0xDF, 0x8B, 0x0A, 0x91, 0x67, 0x41, 0x2D, 0xB2, 0x21, 0x9D, 0x88, 0xC2, 0x43, 0x62, 0xAB, 0x44,
+    0xC2, 0x26, 0xB6, 0x22, 0x47, 0x61, 0xC3, 0x9D, 0x23, 0x79, 0xFF, 0xF0, 0x55, 0xF9, 0xA3, 0xF2,
+    0xB8, 0xF6, 0x3E, 0xBD, 0xD8, 0xFE, 0x63, 0x73, 0xB9, 0x43, 0x99, 0xEC, 0x0D, 0x19, 0x9E, 0xE9,
+    0x0C, 0x96, 0xD9, 0x7C, 0x27, 0xE2, 0x4E, 0x30, 0x68, 0x9B, 0x50, 0x66, 0x04, 0x6D, 0x57, 0x3B,
+    0x19, 0xB6, 0xE0, 0x60, 0x52, 0xCC, 0x69, 0x6D, 0x5F, 0x62, 0xEF, 0x2B, 0xED, 0x7D, 0x93, 0x7F,
+    0xF7, 0x6D, 0x33, 0x05, 0xCF, 0x2D, 0xA8, 0x07, 0xE5, 0x5F, 0x15, 0x92, 0xFA, 0x02, 0x67, 0x60,
+    0x36, 0xC7, 0x4B, 0xE2, 0x1B, 0x49, 0xBE, 0xEC, 0x20, 0xEB, 0x40, 0x13, 0x3E, 0xB3, 0x64, 0xCF,
+    0xCD, 0xB6, 0x0F, 0x5B, 0x38, 0x50, 0xE5, 0xF0, 0x41, 0xD6, 0x8A, 0x6B, 0xFD, 0xA4, 0xF9, 0x95,
+    0x22, 0xE2, 0x56, 0x94, 0xB7, 0x92, 0x4A, 0xD8, 0x8E, 0x24, 0xAA, 0x64, 0x14, 0x34, 0x32, 0xC1,
+    0x8B, 0x82, 0x77, 0x32, 0x96, 0x36, 0x6A, 0x18, 0x55, 0x36, 0x16, 0x7E, 0xA8, 0x82, 0x1F, 0x0F,
+    0xE0, 0xFF, 0x7D, 0x69, 0x47, 0x77, 0xF7, 0xA3, 0x4A, 0x27, 0xC7, 0xDE, 0xAE, 0x87, 0x4D, 0xFB,
+    0xBC, 0x0C, 0x2E, 0xA7, 0xA9, 0xCA, 0xDA, 0xC4, 0x3F, 0xF9, 0xB5, 0x51, 0xC5, 0xDA, 0xBE, 0x4B,
+    0xA1, 0x48, 0x74, 0x58, 0x23, 0xE8, 0xA8, 0x1E, 0x09, 0x55, 0x44, 0xFC, 0x50, 0xC5, 0x3A, 0x3E,
+    0xC2, 0x26, 0x6C, 0x12, 0x8B, 0xE4, 0x69, 0xA4, 0x0F, 0x2F, 0x9D, 0xCE, 0xE0, 0x4B, 0xEC, 0x6B,
+    0x31, 0x90, 0xEA, 0x06, 0xFF, 0xDE, 0x5E, 0x3A, 0xAA, 0x3D, 0x72, 0x24, 0x25, 0x36, 0x25, 0x98,
+    0x6D, 0xB7, 0xC8, 0x5A, 0x1B, 0xE0, 0x08, 0x9C, 0x73, 0xD7, 0x2B, 0x39, 0x41, 0x17, 0x61, 0x57,
+    0x7A, 0x5D, 0xB3, 0xE2, 0x25, 0x23, 0xD5, 0x3D, 0x35, 0xE4, 0x64, 0x87, 0xBE, 0x87, 0x2B, 0x49,
+    0x9B, 0x17, 0x71, 0xA5, 0xAD, 0xAE, 0x95, 0x35, 0x59, 0xDC, 0x61, 0x85, 0x56, 0x93, 0x19, 0xA6,
+    0x73, 0xB0, 0xEE, 0xB8, 0x26, 0x4E, 0x52, 0x2B, 0x06, 0x05, 0xBC, 0xFC, 0xCC, 0x43, 0x02, 0x05,
+    0x55, 0x35, 0x7C, 0x28, 0x22, 0x27, 0xC1, 0x26, 0xB4, 0x4D, 0x78, 0x8D, 0xC7, 0xE3, 0x7B, 0xA8,
+    0xE6, 0x04, 0x86, 0x9B, 0xB8, 0x52, 0x56, 0x17, 0x29, 0x14, 0x19, 0xD9, 0xC5, 0x3D, 0xBD, 0x71,
+    0xF3, 0x9B, 0xFC, 0xB4, 0x50, 0x56, 0x55, 0x71, 0x1D, 0xD2, 0xE9, 0x47, 0xB2, 0x32, 0x01, 0x4F,
+    0x67, 0xCA, 0xC6, 0x75, 0xD4, 0x84, 0x0C, 0xCA, 0xE1, 0x5E, 0x0A, 0x2C, 0xEF, 0xA9, 0xF4, 0xE4,
+    0x87, 0xB4, 0xD1, 0x24, 0x95, 0x2A, 0x0C, 0x44, 0x57, 0x11, 0x2D, 0xB2, 0x12, 0xD7, 0x73, 0x42,
+    0xED, 0x48, 0xEF, 0x45, 0xF6, 0x4E, 0xFE, 0xCD, 0xCF, 0xB3, 0x12, 0xA5, 0x7F, 0xB7, 0x9C, 0xFD,
+    0x20, 0x0A, 0x81, 0x1B, 0x14, 0x62, 0x8A, 0x20, 0x5D, 0x5A, 0x44, 0xAD, 0xAA, 0x86, 0xC4, 0xAF,
+    0x02, 0x72, 0x21, 0xB3, 0x04, 0x20, 0xCA, 0xFA, 0x02, 0x7E, 0x37, 0x18, 0x01, 0x14, 0xF4, 0x39,
+    0x96, 0x8F, 0xB6, 0xFA, 0xAD, 0xEC, 0xDF, 0x4E, 0x2C, 0x90, 0x04, 0x1F, 0x54, 0xE5, 0xF4, 0x8B,
+    0xD6, 0x44, 0xF5, 0x46, 0x6C, 0x57, 0x89, 0x2B, 0x7F, 0xEA, 0x2F, 0xB6, 0x1E, 0x8A, 0xFA, 0xE5,
+    0xEF, 0x59, 0x1E, 0xCC, 0x0F, 0xEB, 0x82, 0x55, 0x46, 0xAD, 0x02, 0x38, 0xE4, 0xD8, 0x01, 0x92,
+    0x66, 0xA2, 0x2C, 0x9D, 0x67, 0x47, 0x80, 0xF5, 0x48, 0x98, 0x77, 0x80, 0x2C, 0xA9, 0x86, 0x83,
+    0xA8, 0xE7, 0x74, 0x60, 0xBD, 0x21, 0x3B, 0x5C, 0x09, 0x70, 0xAF, 0xBD, 0x13, 0x75, 0x91, 0x5B,
+    0x55, 0x33, 0x31, 0x62, 0x42, 0xC0, 0xA7, 0x86, 0x1A, 0x07, 0x09, 0x03, 0xC5, 0xC9, 0x09, 0x34,
+    0x5F, 0x50, 0xC9, 0x2E, 0x6C, 0x7D, 0x0E, 0x1D, 0x2F, 0x97, 0x0C, 0x1A, 0xFF, 0x04, 0x48, 0x3C,
+    0x6E, 0xA0, 0x75, 0x0A, 0x4B, 0x30, 0x3A, 0x05, 0x72, 0x72, 0x31, 0x5F, 0x97, 0x19, 0x4A, 0x9D,
+    0x21, 0x06, 0x04, 0xF6, 0x90, 0xA0, 0xA9, 0x03, 0x2F, 0x65, 0x63, 0xBC, 0xFA, 0xF3, 0x75, 0x67,
+    0xDE, 0xA2, 0x25, 0xF9, 0xBF, 0xCB, 0x1C, 0xBB, 0x05, 0x50, 0xD3, 0x8B, 0x3F, 0x2F, 0x2B, 0x9D,
+    0x85, 0x2E, 0x18, 0x42, 0x62, 0x8C, 0xE8, 0x39, 0x19, 0x42, 0x1C, 0x18, 0x08, 0x92, 0xE9, 0x90,
+    0x04, 0x19, 0x4E, 0x90, 0x90, 0xF8, 0xBF, 0x68, 0x76, 0x70, 0xF0, 0xFD, 0xB2, 0x48, 0xD9, 0x60,
+    0x6A, 0xC7, 0x17, 0x01, 0x47, 0x8E, 0x7F, 0x5A, 0x56, 0xEB, 0x12, 0x3A, 0x6A, 0xCE, 0x6E, 0x98,
+    0x22, 0x23, 0x67, 0x23, 0x49, 0x70, 0xE0, 0x45, 0xE0, 0x94, 0x18, 0x4E, 0x91, 0xA0, 0x84, 0xDD,
+    0xA8, 0x5B, 0xEC, 0xD2, 0x09, 0x78, 0xBF, 0x38, 0x8E, 0x1E, 0xCC, 0x3F, 0x3E, 0x0B, 0xCA, 0x17,
+    0xB0, 0x52, 0x68, 0x3F, 0xCB, 0xE4, 0x0E, 0xC1, 0x0F, 0x30, 0xF1, 0x28, 0x8F, 0x79, 0x3A, 0x0D,
+    0x75, 0xB2, 0xC1, 0x36, 0x7C, 0x0D, 0x56, 0x0A, 0x15, 0x41, 0xC7, 0x5A, 0x5A, 0xB0, 0x26, 0x9C,
+    0x21, 0x68, 0x0D, 0x94, 0xDC, 0xCC, 0x9B, 0x55, 0x67, 0x78, 0x74, 0xD8, 0x05, 0xD3, 0x08, 0xFD,
+    0xBF, 0xE0, 0xC0, 0xFC, 0xED, 0xE0, 0xE0, 0xF0, 0xD5, 0x22, 0x1B, 0x83, 0xF1, 0xC1, 0x0B, 0xBA,
+    0xC3, 0x26, 0xC1, 0x28, 0x4B, 0xBD, 0xAF, 0x53, 0x3E, 0x17, 0x87, 0x96, 0x34, 0x5A, 0xD2, 0x17,
+    0xFB, 0xC2, 0x71, 0x87, 0xC1, 0x5B, 0xAD, 0x88, 0x6E, 0xE6, 0x41, 0x0D, 0x9E, 0xDE, 0xA2, 0xB0,
+    0xCB, 0x90, 0xC4, 0xCB, 0x07, 0x79, 0xC5, 0xE4, 0xA5, 0x4C, 0xC2, 0x3B, 0xCB, 0x61, 0x93, 0xCF,
+    0x08, 0xFE, 0x22, 0xF4, 0x4F, 0x37, 0xC3, 0x7E, 0x21, 0x72, 0x55, 0x24, 0xA6, 0x73, 0xC8, 0xCF,
+    0xCE, 0x99, 0xB8, 0xD2, 0x5B, 0xF3, 0x7C, 0xDB, 0xA9, 0x4E, 0xCC, 0x93, 0x0E, 0x3C, 0x37, 0xB4,
+    0x99, 0x68, 0x40, 0x2B, 0xFE, 0x9D, 0x68, 0x85, 0xD8, 0x94, 0x31, 0x86, 0x1D, 0x1A, 0xDF, 0x54,
+    0xB9, 0x8D, 0x3C, 0x87, 0x2D, 0x10, 0xC1, 0xD9, 0xC6, 0xC0, 0x77, 0x40, 0x2F, 0x41, 0xCB, 0xF2,
+    0xEC, 0xDE, 0x42, 0xC3, 0xD0, 0xDA, 0xED, 0x2D, 0x2F, 0xD2, 0xEC, 0x1A, 0x2A, 0xCC, 0x11, 0x3B,
+    0xE5, 0xAA, 0xB8, 0xAC, 0xB8, 0xB6, 0x6C, 0xCA, 0x45, 0x02, 0x79, 0xAD, 0xF9, 0x7D, 0x98, 0x9D,
+    0x49, 0x7A, 0xBE, 0x83, 0xA9, 0x27, 0x7D, 0x5C, 0x89, 0x7E, 0xCC, 0x7E, 0x21, 0xF8, 0x35, 0xC1,
+    0xDF, 0x71, 0x40, 0x55, 0xA5, 0x44, 0xFC, 0x5D, 0x18, 0x12, 0x7E, 0x2B, 0xF9, 0x9E, 0xCF, 0x72,
+    0x89, 0x5B, 0x8E, 0x46, 0xF6, 0xE5, 0x55, 0x47, 0x0D, 0x2D, 0x06, 0x1D, 0x3F, 0xCD, 0x64, 0x87,
+    0x7F, 0xAA, 0x8A, 0x83, 0x71, 0xDE, 0x2F, 0x73, 0x73, 0x6C, 0x20, 0x0C, 0xD0, 0xF3, 0xD2, 0x6A,
+    0x1B, 0x76, 0x38, 0x6A, 0xE0, 0x4B, 0x54, 0x43, 0xD6, 0xB1, 0x1B, 0xD9, 0xD1, 0xC7, 0x35, 0x22,
+    0xC3, 0x2C, 0xED, 0x53, 0xA0, 0xF6, 0xC3, 0xFE, 0x2E, 0x92, 0xE9, 0xFF, 0x6A, 0x42, 0x5F, 0xBB,
+    0x45, 0x98, 0xAA, 0x98, 0x63, 0x97, 0x51, 0x10, 0xBF, 0x00, 0x74, 0xB6, 0x06, 0xA5, 0xA8, 0x56,
+    0xE2, 0xCF, 0x6E, 0x54, 0xEC, 0xE6, 0xF5, 0x0F, 0xA5, 0x55, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x1D,
+    0x92, 0x51, 0x58, 0xB0, 0xD8, 0x14, 0x69, 0x03, 0x36, 0xEE, 0x52, 0xEC, 0x17, 0xE8, 0xF6, 0x80,
+    0x20, 0x75, 0xDC, 0x38, 0x8D, 0x3F, 0x42, 0x4D, 0x4A, 0x4B, 0xC7, 0x26, 0xB5, 0xDD, 0xF8, 0x0F,
+    0x5C, 0xD8, 0xBC, 0x42, 0x3F, 0xB0, 0x27, 0x12, 0x4E, 0x99, 0x42, 0x42, 0x7E, 0xC0, 0x0C, 0xE0,
+    0x20, 0x48, 0x1A, 0x11, 0x08, 0x11, 0xF3, 0x0E, 0xCB, 0x9B, 0xBC, 0xB7, 0xA7, 0x3B, 0x29, 0x09,
+    0x04, 0x39, 0x08, 0xA5, 0x9B, 0x3D, 0xCE, 0xCC, 0xBE, 0x9D, 0x79, 0x33, 0xB3, 0xF7, 0x89, 0xF9,
+    0xF1, 0xCF, 0xC9, 0xC9, 0xDD, 0x27, 0x34, 0x27, 0xBF, 0xF6, 0x9F, 0x25, 0x49, 0xB0, 0x3F, 0x4D,
+    0xA6, 0xFD, 0x9B, 0x49, 0x92, 0x50, 0xBE, 0x1D, 0x5D, 0xD6, 0x9F, 0x16, 0xED, 0x78, 0x74, 0x50,
+    0x5E, 0x89, 0xE4, 0x83, 0x48, 0x19, 0x44, 0x16, 0x9D, 0x24, 0x5A, 0x49, 0xBE, 0xC5, 0xEB, 0x28,
+    0xE2, 0x60, 0x2A, 0xF1, 0x49, 0xA1, 0x93, 0x5C, 0xE7, 0x78, 0x83, 0x45, 0xEC, 0x1A, 0xA2, 0xE9,
+    0xB1, 0x75, 0xC2, 0x97, 0x7C, 0xBE, 0x47, 0x32, 0xAA, 0xFA, 0x03, 0x3E, 0xBD, 0xFC, 0xF3, 0xA9,
+    0xEB, 0xFA, 0xB5, 0x83, 0x85, 0x1E, 0x31, 0xA6, 0x2F, 0x64, 0x77, 0xA8, 0x34, 0x11, 0x1E, 0x10,
+    0x05, 0xB1, 0xEC, 0x5E, 0x95, 0xA8, 0xEC, 0x8E, 0x6E, 0x3A, 0xF9, 0x14, 0xE6, 0x12, 0xD6, 0xE6,
+    0xBD, 0x64, 0x08, 0x24, 0x1E, 0xFA, 0xDD, 0x5D, 0xF4, 0x13, 0x9D, 0x2F, 0x54, 0xB3, 0xCD, 0xD3,
+    0xF1, 0x91, 0x30, 0xE5, 0x53, 0x91, 0xAC, 0x13, 0x39, 0x03, 0x28, 0x10, 0x90, 0x96, 0x9B, 0x13,
+    0x8B, 0xE7, 0xF1, 0x05, 0x56, 0xA8, 0x9F, 0x21, 0x00, 0xF8, 0x7E, 0x7E, 0x40, 0xC9, 0xA1, 0xC4,
+    0xA9, 0x06, 0xD1, 0x23, 0xC9, 0x84, 0x59, 0x25, 0xE7, 0xAF, 0x68, 0x01, 0x38, 0xF2, 0xCF, 0xF4,
+    0xE5, 0x09, 0x38, 0x29, 0x41, 0x11, 0xEC, 0x0B, 0x46, 0x5B, 0x25, 0x50, 0xE0, 0x90, 0xAC, 0x97,
+    0x23, 0xC9, 0xFA, 0xBC, 0x4D, 0x75, 0x92, 0xC1, 0x54, 0x46, 0xB7, 0x32, 0x96, 0x38, 0x76, 0x26,
+    0xDE, 0x8A, 0x97, 0x99, 0x3C, 0x9B, 0xC9, 0xC8, 0xE5, 0x38, 0x19, 0x76, 0x4B, 0x2F, 0xC7, 0xFB,
+    0xC5, 0x53, 0x79, 0x2A, 0xE3, 0x31, 0x5C, 0x26, 0xE9, 0x67, 0xB2, 0x4A, 0x35, 0xEB, 0xAC, 0xB8,
+    0xEB, 0xCB, 0xEB, 0xB6, 0x14, 0xB3, 0xCD, 0x54, 0x4C, 0x25, 0x8F, 0xF1, 0xC7, 0x18, 0xF1, 0x64,
+    0xC3, 0x2E, 0xE4, 0x9B, 0x38, 0xED, 0xFA, 0xEB, 0xF3, 0x58, 0x20, 0x25, 0x91, 0xF2, 0xA5, 0xC6,
+    0xA8, 0x63, 0x5B, 0x64, 0x0C, 0x50, 0x1A, 0x72, 0x6E, 0xC8, 0x5B, 0xF2, 0xA1, 0xA3, 0xC9, 0xD2,
+    0xF4, 0x33, 0x51, 0x56, 0x24, 0xCC, 0xB4, 0x2B, 0x98, 0xC6, 0x1C, 0x36, 0x1B, 0xF9, 0xE9, 0x53,
+    0xD8, 0x56, 0x24, 0x13, 0xFF, 0x01, 0xD5, 0x50, 0xED, 0xC4, 0x42, 0x4A, 0xB6, 0xA9, 0x97, 0x03,
+    0xA9, 0x2D, 0x2B, 0xEE, 0x0C, 0x09, 0x18, 0x2D, 0x3A, 0x8B, 0x73, 0xD1, 0x57, 0x8C, 0xEC, 0x8C,
+    0x85, 0x7B, 0xDE, 0xC6, 0x4E, 0xD4, 0xDF, 0x04, 0x55, 0x1F, 0x63, 0x5F, 0xF4, 0x52, 0x8C, 0xF0,
+    0x6D, 0x00, 0x6F, 0x2E, 0x5B, 0xC9, 0xFE, 0x80, 0x77, 0x80, 0xE2, 0x02, 0x8A, 0x85, 0xD9, 0x2C,
+    0x91, 0x25, 0xC8, 0x83, 0xE7, 0x40, 0x05, 0x00, 0xB2, 0x0F, 0xF0, 0xB8, 0x80, 0x47, 0xA9, 0xCC,
+    0xAD, 0x45, 0x9B, 0xB0, 0x34, 0x50, 0xA8, 0xAB, 0x97, 0xFA, 0x0D, 0x5C, 0xBF, 0x52, 0x5D, 0xDF,
+    0x54, 0xAF, 0xC0, 0xB7, 0x94, 0x01, 0x2E, 0x36, 0xCB, 0x21, 0x9B, 0x24, 0xA9, 0x1C, 0x62, 0x48,
+    0x03, 0x13, 0x27, 0x69, 0xAC, 0x57, 0x3A, 0xEE, 0xDF, 0x1C, 0x79, 0xA2, 0x8D, 0x31, 0xDF, 0x51,
+    0x5D, 0xC4, 0x21, 0xD9, 0x33, 0xCC, 0x56, 0x60, 0xBD, 0xC1, 0x4A, 0x14, 0xEB, 0x27, 0x9E, 0x24,
+    0x20, 0x93, 0xD8, 0x10, 0x4F, 0x90, 0x0D, 0x32, 0x94, 0x48, 0x8E, 0x32, 0xFA, 0xC0, 0x56, 0xC6,
+    0x76, 0x7B, 0x45, 0x56, 0xFA, 0x40, 0x9C, 0xC0, 0x73, 0x03, 0x61, 0x89, 0x7B, 0x2B, 0xA6, 0x83,
+    0x38, 0xE8, 0xA2, 0x4B, 0x74, 0x8E, 0xDB, 0x0C, 0x01, 0x6C, 0x4B, 0xFA, 0xE7, 0xDB, 0xBA, 0x99,
+    0xF6, 0x07, 0xAD, 0x79, 0xAE, 0xBE, 0x53, 0xDD, 0x42, 0xF1, 0xAE, 0x8D, 0x89, 0x98, 0x7F, 0x2D,
+    0x5A, 0xD7, 0xCF, 0x55, 0x03, 0x5C, 0x2E, 0xEF, 0x73, 0xE1, 0xF2, 0x7B, 0xFD, 0x06, 0x2E, 0xD7,
+    0x00, 0xFB, 0x08, 0x4C, 0x2E, 0x9B, 0xFA, 0x35, 0x31, 0x01, 0x7D, 0xAF, 0xCB, 0xED, 0x72, 0x73,
+    0xC3, 0x34, 0xFA, 0x02, 0x55, 0x64, 0x79, 0x37, 0xCB, 0x90, 0xA1, 0x6B, 0x1F, 0x19, 0xF2, 0x5B,
+    0xD2, 0xC3, 0x55, 0x37, 0xD5, 0x89, 0xE4, 0xCB, 0x74, 0x10, 0x80, 0xA8, 0xDF, 0xC4, 0xDE, 0x8B,
+    0x82, 0xBA, 0x05, 0x5D, 0x1C, 0x9D, 0x1D, 0xCB, 0xE5, 0x2C, 0x00, 0x9C, 0x41, 0x6D, 0x5C, 0xCE,
+    0xC1, 0x4E, 0xF5, 0x97, 0x6F, 0x95, 0xD3, 0xAA, 0x9C, 0x85, 0xF7, 0x22, 0x47, 0x8F, 0x31, 0x7C,
+    0xE8, 0x79, 0xD4, 0xB1, 0x60, 0x52, 0x96, 0x5B, 0x57, 0x24, 0xF9, 0x5E, 0xD5, 0xA6, 0xAE, 0x1B,
+    0x22, 0x4C, 0xF8, 0xE8, 0x7F, 0xD9, 0x78, 0x50, 0x35, 0x7A, 0xAE, 0xFD, 0xE2, 0x85, 0x69, 0xD1,
+    0x5B, 0x01, 0xD3, 0xF4, 0xD0, 0x97, 0xA9, 0x20, 0xE9, 0x52, 0x70, 0xD0, 0xCC, 0xFF, 0x10, 0xF6,
+    0xFB, 0xA7, 0x7D, 0xB3, 0x2D, 0x74, 0x8E, 0x9B, 0xDD, 0xEF, 0x66, 0x30, 0x47, 0x07, 0x25, 0x01,
+    0x56, 0x87, 0xAE, 0x34, 0x57, 0x38, 0x6E, 0x80, 0xE3, 0x16, 0xFE, 0xB6, 0x92, 0x50, 0x74, 0x62,
+    0xDE, 0x22, 0x81, 0x80, 0xB0, 0xCD, 0xF5, 0xC8, 0x46, 0xBE, 0x12, 0x33, 0x36, 0x18, 0x32, 0x5C,
+    0x1B, 0xA6, 0xC5, 0x58, 0x04, 0x54, 0xC6, 0xB4, 0x98, 0x22, 0x6C, 0xEF, 0x80, 0xB3, 0x00, 0x4E,
+    0x4A, 0xC0, 0xD8, 0x9B, 0x0E, 0x47, 0x24, 0x93, 0x7F, 0xB8, 0x0D, 0x3E, 0x72, 0xD9, 0xDC, 0xF6,
+    0x62, 0xC5, 0x9F, 0x00, 0xFE, 0x54, 0x64, 0xEC, 0x79, 0x96, 0x93, 0x24, 0xEB, 0x16, 0x6D, 0x63,
+    0x9A, 0xC0, 0x6B, 0xD8, 0xB1, 0xFF, 0x9C, 0x0B, 0xB8, 0xEC, 0x8F, 0x5D, 0xC0, 0x9D, 0xE1, 0x5D,
+    0xC0, 0xB5, 0x36, 0xBA, 0x50, 0x56, 0xC9, 0xE0, 0x10, 0x64, 0xDA, 0xBB, 0x80, 0xBB, 0xB9, 0x73,
+    0x21, 0xEB, 0x8A, 0x16, 0xB2, 0x37, 0x90, 0xC9, 0x50, 0xCE, 0x1D, 0x12, 0xC2, 0x45, 0x17, 0xC4,
+    0xCF, 0x28, 0xCF, 0x4E, 0x29, 0x77, 0xFF, 0x76, 0xA4, 0xC4, 0xE4, 0x1F, 0x24, 0xEE, 0x5C, 0xC7,
+    0xBE, 0xF3, 0x9C, 0x79, 0xCF, 0x98, 0x3C, 0x83, 0xF1, 0x8A, 0x58, 0x3C, 0x07, 0xD8, 0x87, 0x86,
+    0x02, 0x1D, 0xE9, 0x03, 0x5A, 0xDA, 0x93, 0x58, 0x1F, 0x40, 0xB5, 0xE7, 0xED, 0xE8, 0x49, 0x38,
+    0x84, 0x9B, 0x43, 0xD8, 0xD6, 0x93, 0x49, 0x88, 0xAC, 0xF7, 0xA4, 0x12, 0x42, 0x26, 0x8A, 0x05,
+    0x85, 0x8D, 0x33, 0x45, 0x91, 0xC7, 0xAB, 0x20, 0xC8, 0x03, 0xCF, 0x5F, 0xBD, 0x55, 0x3D, 0x8F,
+    0xDD, 0x44, 0x14, 0x3D, 0xF6, 0x68, 0x71, 0xE1, 0x62, 0x28, 0x48, 0xED, 0x9F, 0xE0, 0x5F, 0xB0,
+    0x6F, 0xDC, 0x40, 0x43, 0x01, 0x05, 0xA1, 0x49, 0xB1, 0x3D, 0x4D, 0x5A, 0x9A, 0x5D, 0x5B, 0xC9,
+    0x0F, 0x20, 0xCD, 0xD6, 0x08, 0x09, 0x9A, 0xDD, 0xBF, 0x90, 0xF7, 0xDE, 0xA0, 0x14, 0x29, 0xB6,
+    0x58, 0x0B, 0x8A, 0x14, 0x14, 0x58, 0x8A, 0x22, 0x24, 0x28, 0xB0, 0x22, 0x47, 0x99, 0x85, 0xF1,
+    0xBB, 0x9C, 0x3B, 0x36, 0x08, 0x24, 0x04, 0x5A, 0x40, 0xF8, 0x69, 0x46, 0xD7, 0xE3, 0xB9, 0xF7,
+    0x9E, 0x7B, 0xEE, 0xC7, 0x03, 0xD2, 0x73, 0x5F, 0x1E, 0x01, 0xAD, 0x48, 0x8F, 0xFA, 0x70, 0x4F,
+    0xBA, 0x22, 0x20, 0x9F, 0x71, 0x00, 0x8A, 0xB1, 0xF6, 0x40, 0xFD, 0x70, 0xE4, 0x9D, 0xD8, 0x72,
+    0xB3, 0xDF, 0x0C, 0xDC, 0x77, 0x33, 0xB7, 0x82, 0xB7, 0x01, 0x17, 0xB9, 0x19, 0xF1, 0x2A, 0xCE,
+    0x49, 0xD4, 0xD3, 0x76, 0xC7, 0xAD, 0xFC, 0x4E, 0xD5, 0x66, 0xA7, 0x6A, 0x4F, 0x02, 0x90, 0x87,
+    0x8A, 0xDF, 0x5A, 0xEC, 0x3B, 0x54, 0x43, 0x2E, 0xE7, 0xF7, 0x03, 0x4A, 0x11, 0x7A, 0x29, 0x75,
+    0x03, 0xDE, 0x07, 0xF6, 0xF2, 0x39, 0x44, 0xA4, 0xE3, 0x1A, 0x23, 0xCA, 0x10, 0x91, 0x47, 0x3A,
+    0x98, 0xB9, 0xB6, 0xEB, 0x52, 0x39, 0x2E, 0xE7, 0xD5, 0xC8, 0x7B, 0xBD, 0x9A, 0x90, 0x8B, 0x47,
+    0x50, 0x20, 0x7F, 0xB7, 0xF0, 0x7F, 0x86, 0x1B, 0xFF, 0x3A, 0xDC, 0x13, 0xBD, 0x0E, 0xD7, 0x71,
+    0xCB, 0xD2, 0x01, 0x61, 0xF0, 0xA9, 0xD5, 0x23, 0x2E, 0x1A, 0xA5, 0xC2, 0x8A, 0x04, 0xE5, 0x63,
+    0xB4, 0x9E, 0x66, 0x22, 0xB2, 0x48, 0xC1, 0xF6, 0xCA, 0x04, 0x85, 0x52, 0x85, 0x59, 0x4F, 0x7C,
+    0x84, 0x09, 0xF6, 0xC5, 0x87, 0x07, 0xBD, 0xDC, 0x50, 0xCB, 0x63, 0xE6, 0xCF, 0xFA, 0x62, 0x64,
+    0xD8, 0x75, 0x67, 0xF5, 0x3D, 0x32, 0x3C, 0x0A, 0xAE, 0x59, 0xED, 0x94, 0x03, 0xD5, 0xDD, 0x7B,
+    0x9E, 0x40, 0x7F, 0x25, 0xC5, 0x88, 0x44, 0x7B, 0xB8, 0x0C, 0x95, 0xC7, 0x5B, 0xAE, 0xE1, 0x57,
+    0xAC, 0x8B, 0xB2, 0x32, 0x63, 0x27, 0xE5, 0x81, 0x88, 0xE5, 0x06, 0xA8, 0x54, 0xD8, 0x33, 0x88,
+    0x42, 0xF5, 0x95, 0x0C, 0x65, 0xE1, 0x6C, 0x5D, 0xDB, 0x37, 0xE9, 0xA5, 0x3D, 0x3F, 0x99, 0x94,
+    0xE6, 0x5A, 0x23, 0xBE, 0xD3, 0x30, 0xBD, 0x22, 0x2F, 0xB9, 0xE4, 0x4A, 0xB7, 0xC5, 0x76, 0xCA,
+    0x8B, 0x51, 0x2E, 0xAC, 0xC7, 0x7F, 0x7E, 0xC4, 0x83, 0xFC, 0x35, 0x0F, 0xCA, 0x6F, 0x35, 0xB1,
+    0x9A, 0xD2, 0xED, 0xBF, 0x3E, 0xB2, 0x57, 0x4C, 0x91, 0x23, 0x47, 0x79, 0x70, 0x9E, 0xBC, 0xB8,
+    0x17, 0xF7, 0x66, 0x38, 0xAD, 0xA6, 0x4A, 0x34, 0x85, 0x1F, 0x00, 0x8F, 0x95, 0x05, 0xA5, 0x63,
+    0xA7, 0xB0, 0x22, 0xF9, 0xCB, 0x62, 0xD5, 0x21, 0x9F, 0x88, 0xCB, 0x8C, 0xB6, 0x67, 0x2A, 0x8A,
+    0x81, 0x09, 0x24, 0x56, 0xEB, 0xF3, 0x09, 0x55, 0x97, 0x45, 0x65, 0x39, 0x2A, 0xE6, 0xAD, 0x12,
+    0xD8, 0x2A, 0xA3, 0x4E, 0xF1, 0xD7, 0x0F, 0x82, 0x56, 0xD4, 0xB8, 0x6E, 0xC5, 0x33, 0x56, 0x95,
+    0xF9, 0xC1, 0xAF, 0x65, 0x98, 0x09, 0x73, 0x03, 0xC1, 0x42, 0xFF, 0x59, 0x8A, 0x3C, 0x7F, 0x45,
+    0xB5, 0x7D, 0x93, 0xEE, 0x1B, 0x32, 0xEF, 0xCA, 0x1E, 0x96, 0x59, 0x0F, 0x84, 0x70, 0x36, 0xD2,
+    0xAD, 0x63, 0x20, 0x43, 0xB2, 0x6E, 0xAF, 0x3D, 0x22, 0x01, 0x9C, 0xD5, 0x28, 0x86, 0x62, 0xC8,
+    0xC7, 0x53, 0xD4, 0x8D, 0xF5, 0xD6, 0x87, 0x84, 0x65, 0x63, 0x46, 0x42, 0xDC, 0x66, 0x53, 0xD9,
+    0x13, 0x62, 0xE0, 0x87, 0x6E, 0xCB, 0x00, 0x1C, 0x9C, 0x22, 0xFF, 0x72, 0xC2, 0x63, 0xBA, 0xAB,
+    0xDF, 0xF5, 0x59, 0x38, 0xA5, 0x73, 0x07, 0xF3, 0x92, 0x08, 0x23, 0x0B, 0x9D, 0x66, 0xCD, 0x6B,
+    0x12, 0x42, 0x40, 0xC5, 0x8F, 0xC0, 0x86, 0x85, 0x43, 0x04, 0x50, 0xC4, 0xAE, 0x47, 0xAE, 0x78,
+    0xF7, 0x8C, 0x80, 0x91, 0x31, 0x70, 0x96, 0xB4, 0xC6, 0x9D, 0x4D, 0xF5, 0xCA, 0x8E, 0x55, 0x62,
+    0xAA, 0x2E, 0x0F, 0x7A, 0x3C, 0x93, 0x10, 0xB4, 0x59, 0x58, 0x1B, 0xD3, 0x5E, 0xF5, 0x5A, 0x84,
+    0x34, 0x94, 0xAC, 0x68, 0xDB, 0x2E, 0x92, 0xD1, 0x7A, 0xB4, 0xD7, 0xFC, 0x5A, 0xE9, 0x3D, 0x47,
+    0x6D, 0x6A, 0xCE, 0x0C, 0x9B, 0x64, 0xD2, 0x5E, 0xDD, 0x29, 0x0D, 0x9E, 0x79, 0x2B, 0x19, 0x00,
+    0xCC, 0xB4, 0x53, 0xE7, 0xB4, 0x9D, 0xDD, 0x28, 0x84, 0x27, 0x84, 0xB8, 0xE3, 0x35, 0x33, 0x96,
+    0xC3, 0xD2, 0x32, 0x71, 0x51, 0x71, 0x0A, 0x62, 0x67, 0xF8, 0x39, 0x52, 0x37, 0x0B, 0xCC, 0x8B,
+    0xF9, 0x79, 0x50, 0x0C, 0x5A, 0x67, 0x9A, 0xF0, 0xEA, 0x56, 0x25, 0xC9, 0x86, 0x90, 0x13, 0xAE,
+    0x67, 0x5C, 0x93, 0x4E, 0xC5, 0x85, 0x83, 0xD4, 0x41, 0x7B, 0x1D, 0x26, 0xBF, 0x6B, 0x38, 0xB5,
+    0x4C, 0x3E, 0x88, 0x58, 0x87, 0x93, 0x82, 0x46, 0x6A, 0xD7, 0x3F, 0x57, 0xF8, 0xFE, 0xE2, 0xE2,
+    0x92, 0x46, 0x0F, 0xDA, 0x5C, 0xAD, 0x54, 0xF2, 0xF4, 0xA7, 0xCF, 0x02, 0x4B, 0xA2, 0xEA, 0x8A,
+    0x21, 0xBB, 0x95, 0x20, 0xB1, 0x95, 0xA3, 0xBB, 0x0D, 0x73, 0x6A, 0xBB, 0x04, 0xFE, 0x74, 0xA9,
+    0xAB, 0xF1, 0xB7, 0x0A, 0x23, 0x8E, 0x4D, 0x92, 0xB2, 0x29, 0x05, 0x55, 0x2A, 0x33, 0x8B, 0x44,
+    0xB8, 0x8B, 0x54, 0xF4, 0x29, 0xFA, 0x9A, 0xD2, 0xA0, 0x4D, 0x20, 0x56, 0xBE, 0xBA, 0x9C, 0x98,
+    0x93, 0xBA, 0x29, 0xFB, 0xFC, 0x76, 0x82, 0xCC, 0x4E, 0xDE, 0xBE, 0xDB, 0xC0, 0xF8, 0x35, 0x78,
+    0x2D, 0x7B, 0xD6, 0x32, 0x36, 0xC7, 0x84, 0x41, 0xEF, 0x65, 0x37, 0xC1, 0xF4, 0x35, 0x31, 0x9A,
+    0x1E, 0xAC, 0x4B, 0xFE, 0x6C, 0x73, 0xCC, 0x57, 0xBA, 0x3F, 0x66, 0x14, 0xE5, 0x53, 0x6A, 0x4E,
+    0x69, 0xE2, 0x92, 0x1D, 0x97, 0xC6, 0x0F, 0xF0, 0x11, 0x89, 0xAB, 0x3C, 0x23, 0x9E, 0xF0, 0xB1,
+    0xBE, 0x67, 0x32, 0x33, 0x3F, 0x07, 0xDC, 0xBC, 0x33, 0x67, 0x29, 0x33, 0x1A, 0xBC, 0x26, 0xCE,
+    0xE1, 0x8D, 0xCB, 0xC8, 0xF1, 0x3D, 0xCA, 0x17, 0x27, 0xD7, 0x6C, 0x1D, 0x72, 0x3E, 0x07, 0x96,
+    0xF8, 0x80, 0x8A, 0x03, 0x42, 0x5C, 0x57, 0x93, 0xB2, 0x57, 0x63, 0x7B, 0x28, 0xFC, 0x51, 0x83,
+    0x3B, 0x6B, 0xBA, 0x53, 0xDE, 0xE3, 0x5A, 0x09, 0x7F, 0x38, 0xD8, 0x94, 0x9C, 0xD3, 0x9F, 0x4A,
+    0x34, 0x72, 0xBE, 0xF7, 0xD2, 0x98, 0xC0, 0xFF, 0x81, 0x56, 0x47, 0xF9, 0xD7, 0x23, 0xC9, 0x8D,
+    0xA9, 0x99, 0x50, 0x7D, 0xE2, 0x51, 0x3C, 0x1F, 0xC9, 0xAC, 0x4E, 0x7C, 0xA7, 0xD3, 0x7A, 0x60,
+    0xA1, 0xB2, 0x6B, 0x07, 0x19, 0xAA, 0xF1, 0x78, 0xCF, 0x3F, 0x86, 0x42, 0xC8, 0xED, 0x11, 0xFE,
+    0xE9, 0xF3, 0x0B, 0x9D, 0x55, 0xBB, 0x8E, 0xDD, 0x54, 0x14, 0x5D, 0xB6, 0x35, 0x71, 0xE1, 0xE2,
+    0x34, 0x89, 0x88, 0x94, 0xC2, 0x9F, 0x70, 0x7E, 0x20, 0xE3, 0x63, 0xF2, 0x03, 0xA1, 0xE0, 0x51,
+    0x4C, 0xC1, 0x17, 0xA0, 0xFB, 0x05, 0x73, 0x6D, 0x85, 0x02, 0x89, 0x14, 0xA1, 0x89, 0x44, 0x07,
+    0xF5, 0x48, 0x28, 0x3F, 0xC0, 0x9D, 0x6B, 0x31, 0x45, 0xCA, 0x58, 0x8A, 0x50, 0x5A, 0xE7, 0x31,
+    0x42, 0x54, 0x58, 0x8A, 0x87, 0xF8, 0xC2, 0xB1, 0x37, 0x6B, 0xFB, 0x3A, 0x99, 0xE4, 0x42, 0x1E,
+    0x8C, 0xE5, 0x73, 0xAF, 0x7D, 0x1E, 0xFB, 0xB1, 0xF6, 0x5A, 0xDB, 0x00, 0x10, 0xC8, 0x26, 0x10,
+    0x69, 0xDC, 0xE9, 0x4F, 0xA6, 0x41, 0xE0, 0x01, 0x9B, 0x23, 0x6A, 0x01, 0x87, 0xDD, 0xBF, 0x0E,
+    0x48, 0x2B, 0x60, 0x04, 0xE2, 0x61, 0xAF, 0x49, 0x65, 0x84, 0x95, 0x1A, 0x7B, 0xB4, 0x31, 0xFD,
+    0xC4, 0x0D, 0x8D, 0xF5, 0x7C, 0x58, 0x72, 0xA4, 0xE5, 0x1B, 0x13, 0x76, 0x30, 0xE5, 0x5A, 0x9E,
+    0x37, 0xC5, 0xDD, 0xA2, 0x77, 0x65, 0x38, 0xD2, 0x8E, 0xBB, 0x53, 0x23, 0x79, 0xDA, 0x72, 0x07,
+    0x7D, 0x2E, 0x69, 0x3F, 0xBD, 0x53, 0x21, 0x3A, 0x9F, 0xC8, 0x61, 0x6F, 0x37, 0x30, 0xCD, 0x80,
+    0xA4, 0xB7, 0xCD, 0xB5, 0x31, 0x14, 0x79, 0x50, 0xA6, 0xF2, 0x75, 0x83, 0xCB, 0xD8, 0x5E, 0x89,
+    0x7C, 0x07, 0xC3, 0x28, 0xCC, 0xB3, 0x45, 0x63, 0x6A, 0x78, 0xFA, 0xB3, 0xB7, 0x3A, 0x86, 0xCB,
+    0xF3, 0xDE, 0x1D, 0x1D, 0xAD, 0x8D, 0x88, 0x9C, 0xFC, 0x75, 0x74, 0xF4, 0x23, 0x27, 0x34, 0x03,
+    0x70, 0xD7, 0x94, 0x22, 0x9C, 0x86, 0x37, 0x7C, 0xFC, 0x15, 0x0A, 0x91, 0x9C, 0x96, 0x73, 0x04,
+    0x9F, 0x70, 0xE9, 0x33, 0xC4, 0xD2, 0x44, 0xD2, 0x45, 0x8C, 0xDA, 0x4F, 0x89, 0x30, 0x0F, 0x9A,
+    0xBD, 0x26, 0xDE, 0x8A, 0x04, 0x8B, 0xBB, 0x39, 0x5F, 0x34, 0xA5, 0x57, 0x2B, 0xEF, 0x7D, 0x99,
+    0x23, 0xBD, 0x41, 0xBC, 0x7C, 0x9F, 0x9E, 0x2D, 0x46, 0xA2, 0x2C, 0xDF, 0xB4, 0x30, 0x4F, 0x3A,
+    0x84, 0xBB, 0xA9, 0x43, 0x27, 0xB2, 0x69, 0xA2, 0x46, 0xFC, 0xA4, 0x47, 0xD4, 0xBB, 0x3C, 0x18,
+    0x93, 0xFE, 0x92, 0x10, 0xBE, 0x17, 0x0D, 0xA3, 0xEB, 0x89, 0x75, 0x36, 0x03, 0x9C, 0xD4, 0x5A,
+    0x9C, 0xCB, 0x88, 0xBC, 0xF9, 0xFD, 0xC0, 0x33, 0x0D, 0xCF, 0x48, 0x9F, 0xE1, 0xCA, 0x9C, 0xED,
+    0x5B, 0x47, 0x22, 0x65, 0x56, 0x48, 0xE7, 0x36, 0x5F, 0x78, 0x57, 0x63, 0x20, 0x18, 0x1A, 0x84,
+    0xFB, 0xBF, 0xE3, 0x6A, 0x7A, 0xBF, 0xD5, 0xF2, 0xA2, 0x77, 0xE6, 0xA4, 0xF5, 0xBB, 0x3F, 0xC0,
+    0x55, 0xF2, 0x25, 0x6E, 0xD1, 0xCF, 0x28, 0xF0, 0xC1, 0xC1, 0x54, 0xA4, 0x93, 0xFF, 0xA0, 0x87,
+    0x0C, 0xF6, 0xDB, 0xC5, 0x89, 0x34, 0xEB, 0x7A, 0x2A, 0x79, 0xF6, 0xCE, 0x11, 0xF6, 0x19, 0x92,
+    0x86, 0x47, 0xCA, 0x0C, 0x6B, 0x64, 0x21, 0x8F, 0x27, 0x2D, 0x32, 0x12, 0x2D, 0x2B, 0xB8, 0xCE,
+    0x0A, 0x3B, 0x21, 0xE9, 0x6E, 0xB7, 0x70, 0xAC, 0x6E, 0x86, 0x81, 0xA3, 0x50, 0x17, 0x55, 0x46,
+    0x92, 0x65, 0x64, 0x77, 0x46, 0x6A, 0x5C, 0x71, 0x6F, 0xBB, 0xE6, 0x14, 0x5A, 0x3B, 0x60, 0xDD,
+    0x47, 0x8F, 0x64, 0x64, 0x3D, 0xCD, 0xF8, 0xF9, 0xB8, 0x39, 0xE8, 0x5D, 0x15, 0x4A, 0x1E, 0xB5,
+    0x23, 0xEB, 0x80, 0xE4, 0x61, 0xAB, 0x2C, 0xB3, 0x37, 0x2B, 0x85, 0xFA, 0xD0, 0x29, 0x8F, 0x82,
+    0xCE, 0xAB, 0x86, 0x62, 0x5D, 0xAA, 0x90, 0x5E, 0x6C, 0x29, 0x57, 0xEF, 0xD7, 0x59, 0xB9, 0xFD,
+    0xF3, 0xCA, 0x8D, 0x17, 0xAD, 0xDC, 0x94, 0x4A, 0x28, 0x3D, 0xC5, 0x2F, 0x1D, 0xDC, 0xAF, 0x45,
+    0x4D, 0x56, 0x16, 0x54, 0x46, 0xD8, 0x53, 0xFD, 0xAC, 0x9E, 0x0A, 0x88, 0x72, 0xA1, 0x6F, 0xAC,
+    0xF8, 0xA0, 0x59, 0x91, 0x27, 0x9C, 0xF9, 0x85, 0x4D, 0xC0, 0x13, 0x54, 0x5B, 0x8E, 0x88, 0xDB,
+    0x68, 0x73, 0x69, 0x40, 0xAA, 0xF2, 0xB1, 0x52, 0x6E, 0xBB, 0x80, 0xAA, 0xEC, 0x06, 0x45, 0xF4,
+    0x48, 0x04, 0x72, 0xBA, 0x68, 0x35, 0x4C, 0x1A, 0x4F, 0x69, 0x33, 0x62, 0x46, 0x93, 0x39, 0xA5,
+    0x7B, 0xFC, 0xBA, 0xF4, 0x15, 0x2E, 0xF3, 0xB0, 0xA7, 0x45, 0x51, 0xCA, 0xF7, 0xB1, 0x37, 0xF7,
+    0xC4, 0x47, 0x8F, 0x19, 0xA1, 0x0F, 0xF2, 0xAD, 0x74, 0xAB, 0x6D, 0x23, 0xC2, 0x2B, 0x2D, 0xBF,
+    0x9C, 0x78, 0x53, 0x61, 0xA7, 0x5F, 0xAA, 0xBB, 0xB5, 0x2A, 0xEC, 0xE9, 0x8E, 0xC2, 0xE2, 0x97,
+    0x0A, 0x5B, 0xCE, 0x0A, 0x4B, 0x66, 0x85, 0x85, 0xAF, 0x2B, 0xEC, 0xB1, 0x2A, 0xEC, 0x3F, 0x5A,
+    0xD8, 0xCE, 0xC4, 0xF5, 0xC4, 0xEF, 0x3B, 0xBF, 0x7F, 0xFC, 0xBD, 0x23, 0xA3, 0x58, 0xB6, 0x29,
+    0xCA, 0xF7, 0xDE, 0x7A, 0xA5, 0xD2, 0xB0, 0x31, 0x9D, 0x0C, 0x7B, 0x9D, 0xDB, 0xDA, 0xD3, 0xDE,
+    0x3A, 0x30, 0x21, 0x0E, 0x3B, 0x6E, 0x47, 0xDA, 0x6F, 0x7B, 0xED, 0x8A, 0x3B, 0x28, 0xF2, 0xD5,
+    0x21, 0x16, 0xF7, 0x45, 0x5A, 0xAB, 0x25, 0x63, 0xA3, 0x6A, 0xF5, 0x0E, 0x5A, 0xCD, 0x9F, 0x49,
+    0x17, 0xE2, 0x3F, 0x3A, 0xFB, 0x34, 0x9A, 0x5E, 0xDF, 0x75, 0x13, 0x0E, 0xBA, 0x90, 0x81, 0xDD,
+    0x18, 0x41, 0xCE, 0x8C, 0x32, 0x0E, 0xF7, 0x81, 0xA3, 0xE0, 0x58, 0x33, 0x52, 0x21, 0x5C, 0xC2,
+    0x7E, 0x2C, 0xCC, 0xC1, 0x91, 0x42, 0x56, 0xAB, 0xCE, 0x30, 0xD3, 0x1F, 0xCA, 0x89, 0x26, 0x51,
+    0xBB, 0x22, 0x40, 0x84, 0x6A, 0xA0, 0x4B, 0xC7, 0x95, 0xB4, 0x34, 0x95, 0x0A, 0x9A, 0xAF, 0xCB,
+    0xB0, 0x63, 0xD9, 0xC8, 0xB2, 0x96, 0xC6, 0x96, 0x96, 0x29, 0x3F, 0xA8, 0x10, 0xBE, 0x60, 0x82,
+    0x04, 0x11, 0x86, 0x39, 0x07, 0x0C, 0xF0, 0x10, 0x14, 0x6F, 0xFC, 0xDB, 0x04, 0x2B, 0xD9, 0x42,
+    0x68, 0x94, 0x75, 0x6B, 0x76, 0x04, 0x9A, 0xBA, 0x47, 0x7B, 0x1E, 0x67, 0x5D, 0xD8, 0x99, 0x2A,
+    0x35, 0x25, 0x1D, 0xB0, 0xDD, 0x47, 0x6D, 0xDC, 0x64, 0x71, 0x7D, 0x08, 0x17, 0xD7, 0x59, 0x42,
+    0x5F, 0x3F, 0xEB, 0x37, 0xC0, 0xDE, 0x2C, 0xAD, 0x29, 0xB1, 0xE9, 0xB8, 0x1D, 0xE6, 0x0F, 0xF0,
+    0x2C, 0x8E, 0x1B, 0x35, 0x14, 0x0F, 0x88, 0x09, 0xB2, 0x96, 0xAD, 0x26, 0x01, 0xD4, 0x1F, 0x69,
+    0x6F, 0x73, 0xCA, 0xB7, 0x89, 0xB5, 0xF3, 0xD8, 0x92, 0xF5, 0xF4, 0x49, 0x43, 0x42, 0xEA, 0x07,
+    0x71, 0xCD, 0xAA, 0x09, 0x0B, 0x15, 0x29, 0xF7, 0x0A, 0x96, 0xC5, 0xF0, 0x74, 0xF4, 0x27, 0xA5,
+    0x70, 0x4C, 0x16, 0x9A, 0xAA, 0x20, 0xB6, 0x61, 0x8F, 0x63, 0x2A, 0x9F, 0x45, 0x2B, 0x14, 0xE8,
+    0xFE, 0x5F, 0x90, 0x70, 0xE7, 0x6A, 0x82, 0x64, 0x39, 0x43, 0x12, 0x76, 0x7C, 0xCD, 0x66, 0x48,
+    0x02, 0xB6, 0x1F, 0x38, 0x46, 0x91, 0x10, 0x12, 0xFC, 0xDD, 0x6C, 0x21, 0x89, 0xD5, 0xE1, 0x30,
+    0x13, 0xFE, 0xBC, 0xE3, 0x4F, 0xDF, 0xE2, 0xE0, 0x80, 0x78, 0xAD, 0x35, 0xBC, 0x0E, 0x17, 0xBD,
+    0xFE, 0x01, 0xBD, 0x54, 0x31, 0x6F, 0xE4, 0x54, 0x10, 0xFE, 0x9E, 0x7D, 0x89, 0x25, 0x5C, 0x38,
+    0xC5, 0x45, 0x42, 0x50, 0xB8, 0x06, 0x14, 0xFC, 0x07, 0x76, 0x63, 0xE7, 0xA2, 0x13, 0x05, 0x05,
+    0x14, 0xBB, 0x5C, 0x85, 0xA8, 0xA1, 0x49, 0x9B, 0x22, 0x89, 0x0D, 0xF7, 0x07, 0x4E, 0x42, 0xF4,
+    0x34, 0x87, 0x4E, 0x9B, 0x22, 0x57, 0xA4, 0x48, 0xB1, 0xBB, 0x36, 0x97, 0xE2, 0x0A, 0x1A, 0x07,
+    0x0A, 0x8A, 0x2B, 0x62, 0x89, 0x13, 0x94, 0x18, 0xD8, 0x3D, 0x39, 0xC1, 0xEB, 0xE1, 0x1B, 0xEF,
+    0x26, 0x21, 0xE2, 0x8E, 0x03, 0x0A, 0x9E, 0xF6, 0x79, 0xE7, 0xCD, 0x9B, 0x79, 0x6F, 0xDE, 0x37,
+    0xDF, 0x4C, 0x28, 0x72, 0x2C, 0x52, 0xAF, 0xF6, 0xB7, 0x32, 0xD8, 0x13, 0x60, 0x0C, 0xF8, 0x94,
+    0x4A, 0x60, 0x74, 0x29, 0xCD, 0x28, 0x25, 0x17, 0x52, 0x90, 0xC0, 0x99, 0xF6, 0x7B, 0xA9, 0xC8,
+    0x13, 0x11, 0xAE, 0x3F, 0x86, 0xDD, 0xC0, 0x3B, 0x53, 0x7D, 0x88, 0xE7, 0xFF, 0x46, 0x78, 0xAB,
+    0x42, 0xC8, 0xFD, 0x09, 0x0C, 0x3D, 0xF6, 0x5E, 0x60, 0x16, 0x46, 0xF0, 0x9F, 0xC2, 0x6D, 0x60,
+    0x1A, 0x00, 0x37, 0xBB, 0x2F, 0x1B, 0x78, 0xA0, 0x57, 0xBB, 0xA2, 0x61, 0x99, 0x0A, 0x76, 0x01,
+    0x2F, 0xC1, 0x3A, 0x70, 0x21, 0x86, 0x6D, 0xBC, 0x72, 0x0F, 0x71, 0xE2, 0x34, 0x48, 0x23, 0x3E,
+    0xE0, 0xBA, 0xC1, 0xBA, 0xBA, 0xB9, 0xB9, 0x11, 0x8D, 0x4C, 0xEF, 0x04, 0x9C, 0x33, 0xE0, 0x3D,
+    0x39, 0xB3, 0xBE, 0xFF, 0x51, 0x64, 0x9A, 0x58, 0x42, 0x44, 0xCC, 0xFB, 0x80, 0xF7, 0xCD, 0xB3,
+    0x59, 0x68, 0xB8, 0xBF, 0xE6, 0xDE, 0x2A, 0x8E, 0xD6, 0xBD, 0xBB, 0x45, 0x1D, 0x7A, 0xC7, 0xA5,
+    0x7E, 0x7E, 0xA9, 0x63, 0xCC, 0xC7, 0x10, 0x70, 0x33, 0xBE, 0x36, 0x32, 0x22, 0x59, 0x2C, 0xB5,
+    0x3F, 0x59, 0xDE, 0xAC, 0x00, 0x6E, 0xBB, 0x39, 0x50, 0xF3, 0x94, 0xEC, 0xDA, 0x5F, 0xDE, 0xA2,
+    0xED, 0x10, 0xD6, 0x30, 0x43, 0x24, 0x5F, 0x0D, 0x1D, 0xFA, 0x39, 0x52, 0xB4, 0xA7, 0x1C, 0xD1,
+    0x2B, 0x01, 0x56, 0xE6, 0x47, 0x9B, 0xF4, 0x0C, 0x96, 0x48, 0x69, 0x35, 0x1F, 0x4C, 0xE8, 0x7B,
+    0x43, 0x31, 0x44, 0x10, 0xCD, 0x4F, 0xB6, 0x18, 0xA4, 0x66, 0xEB, 0x52, 0xC1, 0xDC, 0x64, 0x21,
+    0xAD, 0x97, 0xE2, 0x2F, 0x7A, 0x7F, 0xB5, 0xD0, 0xEB, 0x35, 0x97, 0x3A, 0xDD, 0x66, 0x30, 0xD8,
+    0x97, 0xC5, 0xC8, 0x5A, 0x00, 0xA2, 0x15, 0xE7, 0xD6, 0x33, 0xF9, 0xA9, 0xD0, 0x03, 0xEC, 0x89,
+    0x53, 0x9A, 0x12, 0x5D, 0x46, 0xE3, 0x66, 0x5D, 0xA0, 0xF4, 0x22, 0x74, 0xEC, 0x1C, 0x3E, 0xDF,
+    0xEA, 0x25, 0x5E, 0xE2, 0x66, 0x4E, 0xB3, 0x35, 0x61, 0xD8, 0x72, 0xAB, 0xFC, 0x64, 0xB3, 0x60,
+    0xB0, 0x2B, 0x7B, 0x7A, 0x9B, 0xBE, 0xEE, 0x6B, 0x3E, 0x7D, 0x44, 0x46, 0xD9, 0x25, 0x5F, 0x18,
+    0x28, 0xCC, 0x15, 0xAF, 0xE6, 0xE5, 0x41, 0xA4, 0x04, 0x68, 0x19, 0x46, 0x56, 0xA1, 0xA6, 0xB1,
+    0xF5, 0x7B, 0x0E, 0x73, 0x47, 0xFA, 0xF0, 0x48, 0x45, 0xE8, 0xCD, 0x2D, 0x21, 0x5A, 0x98, 0x96,
+    0xEE, 0x4C, 0x7B, 0x73, 0xD5, 0x20, 0x1D, 0x24, 0xAD, 0xAA, 0x0D, 0xBD, 0x7D, 0x87, 0x5A, 0x5D,
+    0x23, 0xCA, 0xCD, 0x45, 0x2E, 0xDE, 0xB8, 0x46, 0x14, 0xAC, 0xF6, 0x10, 0xC8, 0x8C, 0xA7, 0x9F,
+    0x54, 0x78, 0x35, 0x98, 0x03, 0xE2, 0x2B, 0x52, 0x39, 0x61, 0x2D, 0x10, 0x4B, 0xE1, 0x25, 0xF1,
+    0xA3, 0x12, 0xE3, 0x00, 0xF6, 0xAF, 0x0C, 0xD7, 0x4F, 0xEC, 0x52, 0xA2, 0x5D, 0x5B, 0x0E, 0x12,
+    0x87, 0x37, 0x5B, 0x92, 0xB4, 0xCC, 0x75, 0xE6, 0x71, 0x39, 0x3F, 0x3C, 0x35, 0x33, 0x86, 0xB4,
+    0x91, 0x52, 0xCF, 0x71, 0x03, 0x51, 0xED, 0x1E, 0x97, 0xC1, 0xBB, 0xC9, 0xCE, 0xE2, 0x7A, 0x2C,
+    0x0B, 0x89, 0x44, 0x78, 0x0F, 0xE8, 0x65, 0x57, 0x58, 0xAE, 0x94, 0x75, 0x70, 0x0A, 0x72, 0x6E,
+    0x29, 0x22, 0x70, 0x89, 0x2B, 0x04, 0xB4, 0x74, 0xA4, 0x36, 0xE5, 0x1A, 0x69, 0x1A, 0x79, 0x9B,
+    0x99, 0x26, 0x67, 0xBB, 0xD3, 0xA6, 0xE6, 0x71, 0x42, 0x9A, 0xA2, 0xB3, 0x4D, 0xAC, 0x75, 0xD1,
+    0xBD, 0x5A, 0x1C, 0x67, 0xED, 0x4E, 0xC7, 0xA2, 0x99, 0xF3, 0x59, 0x4E, 0x16, 0xE3, 0xD0, 0x43,
+    0xBA, 0x9F, 0x79, 0x38, 0x32, 0x52, 0xDB, 0xB9, 0x9D, 0x9B, 0xFB, 0x4C, 0x8F, 0x42, 0xCB, 0x50,
+    0xE3, 0x08, 0x01, 0x71, 0x4A, 0xEF, 0xA7, 0x05, 0x94, 0x18, 0xFA, 0xC5, 0xEA, 0x82, 0x53, 0x45,
+    0x98, 0x7E, 0x8A, 0x0E, 0xEC, 0xFC, 0xB5, 0x51, 0x20, 0x4F, 0xB2, 0xEE, 0xC4, 0x3E, 0x8D, 0x76,
+    0xC7, 0x5B, 0xDF, 0xCA, 0x87, 0x8B, 0x57, 0xA1, 0x72, 0x72, 0x2F, 0x8B, 0x99, 0xC7, 0xD2, 0x2D,
+    0x42, 0xEC, 0x29, 0x1F, 0x82, 0x24, 0x48, 0x66, 0xAC, 0x55, 0xE6, 0x69, 0x83, 0x93, 0x59, 0x8D,
+    0xAD, 0x4A, 0xB7, 0xF0, 0xD0, 0x6E, 0xD1, 0x88, 0x49, 0x87, 0x8F, 0x38, 0x4F, 0xFA, 0xFD, 0xBE,
+    0xF2, 0x4E, 0x83, 0x27, 0x6F, 0xA0, 0xE1, 0xE3, 0x42, 0xF1, 0x8A, 0x92, 0x91, 0x1D, 0x84, 0x9D,
+    0xE4, 0x1F, 0x40, 0xC6, 0x03, 0x08, 0x59, 0xDA, 0xD0, 0xB5, 0x74, 0xE7, 0x90, 0x0D, 0x9D, 0x82,
+    0x90, 0xB9, 0x59, 0x48, 0xC8, 0x30, 0xB4, 0x4B, 0xA2, 0xE4, 0x12, 0x9A, 0xCE, 0x36, 0x46, 0x5B,
+    0x99, 0x2E, 0x98, 0x36, 0x2E, 0xC6, 0x63, 0x85, 0xCC, 0x65, 0x6A, 0x3B, 0x34, 0xF3, 0x32, 0x42,
+    0xE6, 0x66, 0xBB, 0x0A, 0x19, 0x7D, 0x08, 0x99, 0x9B, 0xF9, 0x77, 0x09, 0x59, 0x0F, 0xBD, 0x97,
+    0x43, 0xF6, 0xE6, 0x60, 0x30, 0xF8, 0x5C, 0x0B, 0x45, 0x85, 0x2F, 0xA9, 0x20, 0x2D, 0x3C, 0x29,
+    0x03, 0x0C, 0xBB, 0x7A, 0x7A, 0x97, 0x3F, 0x0A, 0x5C, 0x52, 0x69, 0xCD, 0x99, 0x61, 0xA9, 0x33,
+    0x4B, 0x19, 0x6F, 0x63, 0x5E, 0xCF, 0x7F, 0x52, 0xB0, 0x4B, 0xC8, 0x4C, 0xC1, 0xBA, 0xDD, 0x9F,
+    0xF5, 0xA3, 0xE7, 0x59, 0xCC, 0x15, 0x1C, 0x4B, 0x84, 0xF2, 0x1D, 0x5A, 0x4E, 0xD5, 0x05, 0xE4,
+    0x72, 0x63, 0x9F, 0x8F, 0x2D, 0x90, 0x6D, 0x25, 0x1C, 0x56, 0x14, 0x58, 0xA4, 0x7E, 0x64, 0x26,
+    0x17, 0x1F, 0xB4, 0x4D, 0x5D, 0x3D, 0x7B, 0x4C, 0x87, 0x7D, 0x96, 0x2E, 0x5D, 0xDA, 0x8E, 0x8C,
+    0xE4, 0xD6, 0x41, 0x01, 0x27, 0x5F, 0x74, 0xC0, 0xE9, 0xF9, 0xC1, 0x63, 0xA9, 0xD0, 0x87, 0x79,
+    0x60, 0x57, 0x6E, 0xE1, 0x93, 0x79, 0xDB, 0x0A, 0x79, 0x18, 0xFE, 0xBB, 0x19, 0x73, 0xA6, 0x61,
+    0x62, 0x24, 0x2C, 0x5E, 0x17, 0x16, 0x47, 0xB0, 0x1E, 0x57, 0xC1, 0xBA, 0x89, 0xDA, 0x42, 0x7E,
+    0xD1, 0x84, 0xE9, 0xF7, 0x23, 0x97, 0x8F, 0xB2, 0x45, 0xF6, 0x73, 0x16, 0xF9, 0x9A, 0x2F, 0x62,
+    0x7D, 0xA7, 0x42, 0xF8, 0xF7, 0xC2, 0x89, 0x0A, 0x2C, 0x68, 0x2B, 0x0F, 0x29, 0x30, 0x4D, 0x16,
+    0xE9, 0x45, 0x01, 0xDE, 0x7F, 0x12, 0x74, 0xB0, 0xC9, 0x37, 0xB1, 0x81, 0x9D, 0xB9, 0x91, 0x57,
+    0x9A, 0x9A, 0x90, 0x0D, 0xD3, 0x49, 0x7C, 0x4F, 0xCB, 0x3E, 0x3D, 0xFD, 0x79, 0x67, 0x67, 0xA3,
+    0x74, 0x32, 0x1F, 0x3B, 0xE6, 0xEA, 0x4F, 0xBD, 0xFC, 0xCA, 0x6A, 0x6A, 0x36, 0xC4, 0x43, 0xFC,
+    0x96, 0x5B, 0xA7, 0x70, 0x77, 0xB0, 0x76, 0x88, 0x69, 0xE9, 0x3C, 0x3A, 0x1F, 0x59, 0x6D, 0x4B,
+    0x65, 0x1D, 0x99, 0x89, 0x97, 0xD9, 0xA5, 0xAF, 0x33, 0xD1, 0x0A, 0x72, 0x8A, 0x30, 0xD2, 0x82,
+    0xF2, 0xB3, 0x11, 0x6A, 0x12, 0x39, 0xBF, 0x2A, 0x31, 0x76, 0xA6, 0x87, 0x4E, 0x82, 0xFF, 0x6D,
+    0xFC, 0x01, 0xCD, 0x54, 0xBB, 0x6E, 0xD4, 0x40, 0x14, 0xBD, 0xF6, 0x44, 0xB8, 0x70, 0x31, 0x14,
+    0x50, 0x21, 0x65, 0xA9, 0x91, 0xC0, 0x3F, 0xC0, 0xDA, 0x2B, 0x51, 0x50, 0x52, 0xE5, 0x27, 0x68,
+    0x68, 0x28, 0x28, 0x36, 0xD9, 0x41, 0x29, 0x28, 0x93, 0x4F, 0xA0, 0x48, 0x13, 0x47, 0x82, 0x06,
+    0x89, 0x20, 0xED, 0x66, 0x8D, 0xF8, 0x00, 0xFC, 0x07, 0x31, 0x12, 0x4A, 0x91, 0x06, 0x0B, 0x2C,
+    0xE1, 0x44, 0xDE, 0x1D, 0xCE, 0xB9, 0xCE, 0x82, 0xC2, 0xA3, 0x26, 0xA3, 0xD5, 0xF5, 0x8E, 0xEF,
+    0xE3, 0x9C, 0x7B, 0xE6, 0x7A, 0xE4, 0x50, 0x64, 0x5D, 0xA2, 0x4E, 0x64, 0x28, 0x09, 0xEC, 0x54,
+    0x66, 0x63, 0x09, 0x6A, 0xB9, 0x3D, 0x16, 0x53, 0x89, 0x8C, 0x25, 0x2E, 0x68, 0xED, 0x88, 0x36,
+    0x11, 0xDA, 0xB1, 0xDA, 0x36, 0x18, 0xC9, 0x38, 0xAC, 0xE3, 0x4A, 0xC6, 0xA6, 0xB4, 0xB0, 0xD6,
+    0x65, 0xB0, 0x03, 0x79, 0x5B, 0xC9, 0x8D, 0x34, 0xF8, 0x86, 0xE4, 0xA9, 0xF9, 0x00, 0xDB, 0xC4,
+    0x0F, 0x2A, 0xD4, 0x5A, 0x47, 0xB9, 0xA8, 0x18, 0xC2, 0xDA, 0xD1, 0xDC, 0x2F, 0x51, 0x6B, 0xE2,
+    0x17, 0xAC, 0x85, 0x37, 0x2D, 0x2D, 0x40, 0xF9, 0x7F, 0x93, 0x7C, 0x64, 0xEE, 0x10, 0x16, 0xF8,
+    0x8A, 0xF0, 0x6D, 0x8B, 0x44, 0xD4, 0x54, 0x42, 0xD6, 0x85, 0x7D, 0x5C, 0x03, 0x16, 0x2D, 0xE8,
+    0x8A, 0xA4, 0xCA, 0xC8, 0xBA, 0x34, 0xD8, 0x83, 0x23, 0xB1, 0x1E, 0x29, 0xF6, 0xD1, 0x49, 0x27,
+    0xA9, 0x75, 0x6E, 0x20, 0xF6, 0x45, 0x21, 0xA6, 0x0C, 0x40, 0x02, 0x08, 0x4C, 0x46, 0xC7, 0x0D,
+    0x3B, 0x20, 0xEC, 0xA6, 0xFE, 0xD9, 0x64, 0xF7, 0xB4, 0x89, 0xDA, 0x81, 0x5A, 0xEB, 0x24, 0xF3,
+    0x35, 0x90, 0xAD, 0x87, 0x2E, 0xBA, 0xE6, 0xC8, 0xB3, 0xA3, 0x0C, 0xB4, 0xC2, 0x3A, 0x74, 0x89,
+    0x66, 0x49, 0xCD, 0x48, 0xE4, 0x5C, 0xF0, 0xC7, 0xAB, 0x49, 0x4B, 0xDA, 0x91, 0x77, 0x01, 0x49,
+    0x3E, 0x01, 0x41, 0x72, 0x8D, 0x8A, 0x9B, 0x2C, 0xDA, 0x44, 0xD4, 0x24, 0x91, 0x65, 0xBC, 0x3B,
+    0x89, 0x8A, 0xA4, 0x9A, 0xF8, 0xB2, 0x8D, 0x5E, 0xC9, 0xE3, 0xDD, 0x44, 0xA8, 0x99, 0x29, 0x87,
+    0x0C, 0x3F, 0x8C, 0xB7, 0x2B, 0x16, 0xAD, 0x53, 0x16, 0x1D, 0x1A, 0xD4, 0x9E, 0x46, 0xDE, 0x57,
+    0x0A, 0xBF, 0x54, 0x25, 0x52, 0xB9, 0x50, 0x8F, 0x67, 0x93, 0xF6, 0x04, 0x33, 0x91, 0x18, 0x98,
+    0xF3, 0x91, 0x30, 0x63, 0x4D, 0x56, 0x2B, 0x44, 0xFC, 0x3D, 0x0D, 0x96, 0x19, 0xCA, 0x16, 0x12,
+    0x43, 0x0A, 0x74, 0x35, 0xD7, 0x0D, 0x63, 0x53, 0x59, 0x15, 0xC5, 0x6E, 0x2D, 0xF9, 0x7C, 0xAB,
+    0x9C, 0x7B, 0x1F, 0x7A, 0x3F, 0x92, 0x0D, 0x91, 0x6B, 0xBB, 0x5A, 0x1C, 0x38, 0x12, 0xA8, 0x16,
+    0xEC, 0x01, 0xA9, 0x7C, 0x21, 0xCF, 0xE4, 0xF2, 0xCA, 0x68, 0x4C, 0xAB, 0x7A, 0x15, 0x3C, 0x98,
+    0x05, 0xD3, 0xBE, 0x33, 0x23, 0xE3, 0x00, 0x99, 0x4F, 0x54, 0x65, 0x66, 0xE1, 0xB3, 0x05, 0xD8,
+    0x04, 0x2D, 0xAB, 0x25, 0xCC, 0x33, 0x75, 0xD8, 0x90, 0x21, 0x7C, 0xF8, 0x75, 0x12, 0x78, 0xB6,
+    0x9C, 0xC0, 0x8A, 0x39, 0xCF, 0x0F, 0x1A, 0xD9, 0x02, 0xA8, 0x63, 0x66, 0x47, 0x1E, 0x71, 0x95,
+    0x80, 0x41, 0x46, 0xFA, 0xA6, 0xD9, 0x22, 0xA1, 0x1D, 0x02, 0x92, 0xE1, 0x3E, 0xE1, 0x13, 0xEE,
+    0xE8, 0x15, 0x59, 0xE8, 0x9E, 0x7C, 0x4D, 0x71, 0x05, 0xF9, 0xDE, 0x21, 0x7A, 0x4C, 0x0E, 0x9C,
+    0x79, 0x91, 0x2D, 0x06, 0x5A, 0x07, 0xB4, 0xB0, 0x0C, 0xEA, 0x2B, 0xC7, 0x37, 0x18, 0xE1, 0xE3,
+    0x17, 0xEF, 0x70, 0xF4, 0x99, 0x7F, 0x0D, 0xEF, 0x7B, 0xB2, 0x7E, 0x8A, 0xEF, 0xEF, 0xD2, 0xEA,
+    0xA5, 0xCF, 0x1C, 0x7B, 0xD3, 0xB1, 0xF1, 0x25, 0x8B, 0xB0, 0x92, 0xF9, 0x4A, 0x5F, 0xCA, 0x09,
+    0x8A, 0x4B, 0xFA, 0xBA, 0xB8, 0x24, 0x36, 0x7C, 0x61, 0xCD, 0xBC, 0x8C, 0xA7, 0x85, 0x77, 0x1D,
+    0xF1, 0xC0, 0x68, 0xE0, 0x31, 0xF6, 0x98, 0x47, 0x5F, 0x4B, 0x96, 0xE7, 0xF3, 0x11, 0x7A, 0x0A,
+    0x5A, 0x7A, 0x6D, 0x81, 0x09, 0x96, 0x23, 0x36, 0x66, 0x6A, 0x6A, 0x93, 0x3D, 0xAC, 0xD8, 0x34,
+    0x8B, 0x22, 0x2F, 0x90, 0xEB, 0x5A, 0x5D, 0xD5, 0xA0, 0x52, 0x87, 0x91, 0x93, 0x3F, 0xD7, 0x55,
+    0xA0, 0xDA, 0x2F, 0x85, 0x0F, 0x4F, 0x88, 0x79, 0x3F, 0x26, 0xBC, 0x7B, 0xC3, 0xBF, 0xF6, 0xE7,
+    0x6C, 0x44, 0xFF, 0xF9, 0xD3, 0xC2, 0xBD, 0x80, 0x5B, 0x01, 0xB7, 0xB7, 0xA7, 0x46, 0x19, 0x1E,
+    0x28, 0x3C, 0xD8, 0x56, 0x01, 0x6D, 0xD9, 0x5F, 0x0F, 0xDA, 0x9D, 0x84, 0x4D, 0xDF, 0x55, 0xD7,
+    0xAB, 0x3B, 0xD3, 0x74, 0x90, 0xC9, 0xFA, 0x8F, 0xD1, 0x9E, 0xE6, 0x2F, 0x41, 0xC6, 0x78, 0xDF,
+    0x52, 0x3E, 0xAA, 0x86, 0x40, 0x3A, 0x29, 0x1E, 0x33, 0x55, 0x43, 0x40, 0xE5, 0x79, 0xD7, 0x0F,
+    0x3E, 0x9D, 0x03, 0x27, 0x7D, 0x83, 0x7A, 0x68, 0x51, 0xAD, 0xAC, 0x0C, 0x38, 0x40, 0xEC, 0xE7,
+    0x54, 0x19, 0x84, 0xA0, 0x0B, 0xCA, 0x2E, 0x2E, 0x14, 0xF5, 0x67, 0x5A, 0x51, 0x26, 0xE7, 0x07,
+    0x8D, 0x59, 0x48, 0xE0, 0x32, 0xE4, 0x87, 0xAA, 0x3A, 0x4F, 0x79, 0x42, 0xC4, 0x76, 0xB5, 0xD3,
+    0x5B, 0xAE, 0x5B, 0x8D, 0xC4, 0xAF, 0x57, 0x47, 0xAB, 0xCB, 0x8F, 0x50, 0x62, 0xE9, 0x1C, 0x50,
+    0xF8, 0x44, 0xCD, 0xD9, 0xC6, 0x94, 0x62, 0xD6, 0x00, 0xF3, 0x18, 0xA2, 0x77, 0xAB, 0x8B, 0x46,
+    0x43, 0xF4, 0xB6, 0x8C, 0x9D, 0xF4, 0xD7, 0x34, 0x5B, 0x32, 0x4B, 0x40, 0xEE, 0xF5, 0x37, 0xD4,
+    0xA2, 0x87, 0x62, 0x4F, 0x77, 0x57, 0xE3, 0x08, 0x8D, 0x8F, 0xA1, 0x07, 0x48, 0x1F, 0x17, 0xD2,
+    0x8F, 0xCE, 0xEF, 0x0F, 0x9F, 0xE7, 0x3B, 0xDE, 0x77, 0x08, 0xF9, 0xF8, 0xAF, 0x10, 0x3E, 0x4E,
+    0xF3, 0x7D, 0x84, 0x7C, 0xA1, 0xB8, 0x7F, 0x5D, 0x3F, 0x00, 0xCD, 0x55, 0x3D, 0x6F, 0xD4, 0x40,
+    0x10, 0x7D, 0xB6, 0x43, 0x2C, 0x61, 0x09, 0x53, 0x53, 0xE0, 0x5F, 0x80, 0xDC, 0x52, 0x84, 0xD8,
+    0xFF, 0x80, 0x54, 0x34, 0x14, 0xF4, 0x69, 0xF8, 0x03, 0x01, 0x1B, 0x51, 0x52, 0xE4, 0x1A, 0x6A,
+    0x28, 0x83, 0x1B, 0x9A, 0x14, 0x14, 0x97, 0xD8, 0x12, 0x05, 0x45, 0x8A, 0x18, 0x51, 0x20, 0x91,
+    0x02, 0x37, 0x08, 0x89, 0xE6, 0x5C, 0xB8, 0x70, 0x60, 0xED, 0xE1, 0xCD, 0xDE, 0x71, 0xE1, 0x43,
+    0x11, 0x1F, 0x12, 0xD2, 0xED, 0xD9, 0xCF, 0xA3, 0xDD, 0xD9, 0x99, 0x37, 0xB3, 0xB3, 0x73, 0xC0,
+    0x36, 0x10, 0x36, 0x70, 0x7B, 0x20, 0xA3, 0x54, 0xC1, 0x69, 0xB0, 0x18, 0xA5, 0xC8, 0x7B, 0x91,
+    0x51, 0xF8, 0xA9, 0x00, 0x63, 0x57, 0x7F, 0xFA, 0x48, 0x51, 0xEC, 0x8A, 0x18, 0xAA, 0x1C, 0x9F,
+    0xA7, 0xA2, 0x9F, 0x4F, 0xC5, 0x33, 0xAA, 0xCC, 0x68, 0x0C, 0x57, 0x52, 0x78, 0x03, 0x37, 0xB6,
+    0x88, 0x6F, 0x56, 0x41, 0x9D, 0xD0, 0xDD, 0x8B, 0xFF, 0xE9, 0x0F, 0x6B, 0xB8, 0xE7, 0x35, 0x7E,
+    0x93, 0x60, 0xC3, 0xAD, 0xB1, 0x1C, 0x81, 0xC8, 0x30, 0x57, 0x19, 0xCE, 0xB5, 0xF2, 0xB9, 0xD8,
+    0x53, 0x47, 0xF4, 0x77, 0xAE, 0x0A, 0x3F, 0x63, 0x51, 0x3C, 0x99, 0xB3, 0x6E, 0xB6, 0x11, 0xD6,
+    0x8E, 0x41, 0x94, 0x3B, 0x1D, 0xAE, 0x2E, 0x42, 0x7A, 0x2E, 0x6D, 0x36, 0x09, 0x2B, 0xAF, 0xA5,
+    0x7E, 0x82, 0xDF, 0x09, 0x43, 0xA0, 0x96, 0x70, 0x71, 0xE2, 0x72, 0x2A, 0xA5, 0xB5, 0x0E, 0x37,
+    0xBE, 0x25, 0xE7, 0x91, 0x18, 0xFF, 0x94, 0x8A, 0x54, 0xFB, 0x63, 0x48, 0x4B, 0x39, 0x12, 0x83,
+    0x3D, 0xB8, 0x02, 0x5F, 0xF2, 0xF0, 0xA8, 0xDE, 0x74, 0xBB, 0x7D, 0xEC, 0xCC, 0x6D, 0xC6, 0xD2,
+    0xC4, 0xD2, 0x3A, 0x63, 0xAA, 0xB1, 0xFC, 0xC3, 0x33, 0xD0, 0x42, 0xCB, 0xE7, 0xB2, 0x13, 0x56,
+    0x53, 0x13, 0x9C, 0xE4, 0x3B, 0xCB, 0xEC, 0xF6, 0xA5, 0x54, 0xD9, 0xE4, 0x6F, 0xA8, 0xC2, 0xEB,
+    0x02, 0x31, 0xDC, 0xE6, 0xCB, 0x38, 0xB1, 0xC5, 0xD0, 0xE8, 0x29, 0x49, 0x8D, 0x03, 0xB2, 0x4F,
+    0x83, 0x1A, 0xCC, 0xC9, 0x01, 0x73, 0xDE, 0x52, 0x64, 0x64, 0x14, 0xDD, 0x5E, 0xC5, 0xA8, 0xA2,
+    0x08, 0x13, 0xB0, 0x6E, 0xC3, 0x63, 0xD5, 0xE7, 0xC1, 0x0E, 0x08, 0xDF, 0x49, 0x91, 0x73, 0xB6,
+    0xD6, 0x53, 0xA2, 0x82, 0x63, 0xC5, 0x38, 0xA7, 0x48, 0x47, 0x14, 0x45, 0x8D, 0xC5, 0x2C, 0x41,
+    0x44, 0x1D, 0xCA, 0xA2, 0x1C, 0xD4, 0xDB, 0xA8, 0x8E, 0x4F, 0x69, 0xEE, 0x02, 0x7F, 0x48, 0xDA,
+    0x4B, 0xD4, 0x1B, 0xA9, 0xD7, 0x66, 0x3D, 0x9C, 0x7A, 0x7D, 0x72, 0x56, 0x40, 0x38, 0xE4, 0x3B,
+    0x95, 0x5C, 0xA1, 0x52, 0x68, 0x15, 0x3A, 0x82, 0x16, 0xD4, 0xD4, 0x94, 0x0A, 0x49, 0x4A, 0x88,
+    0x2A, 0x02, 0xD9, 0x4D, 0x8D, 0xD7, 0x11, 0x58, 0x20, 0x53, 0x83, 0x51, 0x21, 0x49, 0x09, 0x31,
+    0x53, 0xC7, 0x1B, 0x48, 0xF0, 0x5A, 0x82, 0x6B, 0xA6, 0x9A, 0x59, 0x85, 0x4C, 0x21, 0xB6, 0xC5,
+    0xA7, 0xE0, 0x2B, 0x30, 0x07, 0xEE, 0x53, 0x75, 0x9F, 0x54, 0x8A, 0x83, 0x02, 0xB3, 0xC7, 0x11,
+    0xE6, 0x8A, 0xD7, 0xF0, 0xC3, 0x58, 0xD7, 0x60, 0x7C, 0xCD, 0x87, 0x2B, 0x1F, 0xCA, 0x1E, 0x59,
+    0x8E, 0xB8, 0xE6, 0x75, 0x47, 0xE6, 0xAA, 0xB1, 0x3E, 0xD1, 0x8D, 0xAF, 0x74, 0xFF, 0xA0, 0xF1,
+    0x04, 0x33, 0xBD, 0x22, 0x99, 0x5A, 0xF5, 0x34, 0x2A, 0x24, 0xC6, 0x8A, 0x3A, 0x9B, 0xE8, 0xAC,
+    0xFF, 0x45, 0xBB, 0xC3, 0x61, 0xA6, 0xDB, 0xDE, 0xE8, 0x36, 0x93, 0xD0, 0x6D, 0xFC, 0x80, 0x6B,
+    0x7E, 0x1B, 0x30, 0x47, 0x23, 0xE2, 0xD3, 0x5B, 0xCC, 0x8A, 0x3D, 0x3E, 0x62, 0x63, 0x73, 0x69,
+    0xC7, 0xB6, 0x65, 0xA9, 0xA6, 0xB4, 0xD9, 0x00, 0xF7, 0x97, 0xAC, 0xDD, 0x66, 0x65, 0x59, 0xB3,
+    0x5D, 0xD1, 0x94, 0xDA, 0xD3, 0x96, 0x45, 0x7B, 0x77, 0xE8, 0x20, 0xA8, 0x36, 0xA1, 0x7D, 0x72,
+    0x7F, 0x45, 0x59, 0x3B, 0x5B, 0x0E, 0x35, 0xCB, 0x7A, 0x83, 0x97, 0x43, 0x66, 0x39, 0xBC, 0xAA,
+    0xE4, 0xFE, 0xEB, 0xCB, 0x46, 0xBB, 0x18, 0x77, 0x85, 0xF5, 0x9C, 0xE9, 0x8D, 0x89, 0xC7, 0xDB,
+    0x92, 0xFB, 0x3D, 0xDC, 0x81, 0x85, 0x49, 0xEB, 0x31, 0xF9, 0xC4, 0x0F, 0xAD, 0x4F, 0xEB, 0xFE,
+    0xC4, 0x32, 0xB1, 0xA4, 0xE6, 0xFC, 0xCC, 0x19, 0xEB, 0x61, 0xC9, 0x3A, 0xB3, 0x61, 0x7D, 0xB4,
+    0x11, 0xDA, 0x60, 0x5F, 0xF6, 0x1A, 0x77, 0x54, 0xEB, 0x5F, 0x4B, 0x99, 0x23, 0x6A, 0x5C, 0x79,
+    0x7C, 0xB7, 0x5F, 0xDC, 0xB3, 0x40, 0x01, 0xD8, 0xB2, 0x54, 0xD6, 0xF8, 0xB2, 0x4D, 0x73, 0xB6,
+    0xD6, 0xB2, 0xD8, 0xF0, 0x6A, 0xFC, 0x3A, 0x56, 0x88, 0x2F, 0x26, 0x70, 0x8E, 0xD8, 0x39, 0x76,
+    0xD9, 0xEF, 0xC3, 0x3A, 0xAA, 0xC2, 0xD7, 0xBC, 0xC3, 0xB3, 0x8A, 0x17, 0x95, 0x44, 0x1A, 0x38,
+    0xB4, 0x1F, 0x1D, 0x7F, 0xBF, 0xF6, 0x96, 0x6B, 0xE9, 0x3C, 0xCE, 0x95, 0x1A, 0x5F, 0x01, 0xCD,
+    0x55, 0x3D, 0x8F, 0xD5, 0x46, 0x14, 0x3D, 0xB6, 0x59, 0x26, 0x8A, 0xA5, 0x0C, 0x05, 0x10, 0x09,
+    0x24, 0x9C, 0x3A, 0x52, 0xE2, 0x7F, 0xC0, 0x58, 0xA2, 0xA4, 0x01, 0x29, 0x81, 0x82, 0x82, 0x9E,
+    0xE6, 0x35, 0x94, 0xBB, 0x6B, 0x47, 0xF9, 0x01, 0x21, 0x12, 0xF4, 0x14, 0x49, 0xC1, 0x5B, 0x21,
+    0x1A, 0x0A, 0x0A, 0x76, 0xDF, 0x44, 0x5B, 0x50, 0xA4, 0xC0, 0x52, 0x0A, 0x8A, 0x14, 0x8C, 0x04,
+    0x2B, 0x04, 0x95, 0x13, 0x2C, 0xE1, 0x0D, 0x63, 0xDF, 0x9C, 0xB1, 0xF7, 0xC1, 0x2E, 0xA2, 0x63,
+    0xA5, 0x64, 0xA4, 0x19, 0x8F, 0xEF, 0xCC, 0xDC, 0x73, 0x3F, 0xCE, 0x9D, 0x01, 0x80, 0xCF, 0x80,
+    0x99, 0xFC, 0xDC, 0xA2, 0x14, 0x11, 0xE4, 0xC3, 0x15, 0xB1, 0xAA, 0x43, 0xD2, 0x63, 0x00, 0x4C,
+    0x93, 0x5B, 0x68, 0xF9, 0xB1, 0x41, 0xDC, 0xFA, 0x12, 0x58, 0xD7, 0x7F, 0x3A, 0x68, 0xBB, 0xD5,
+    0x23, 0x6E, 0x94, 0xD4, 0x58, 0x83, 0xF1, 0xFC, 0x4F, 0xC4, 0x26, 0x0D, 0x4C, 0x8F, 0x4D, 0x24,
+    0x52, 0x67, 0x15, 0xCA, 0x2D, 0xFE, 0xA7, 0x2F, 0x9A, 0x4D, 0xA0, 0x37, 0xFC, 0xD7, 0xDB, 0x42,
+    0x15, 0x5D, 0xE6, 0x81, 0x12, 0x8B, 0x0A, 0x99, 0x53, 0x72, 0x6B, 0xD6, 0x81, 0x88, 0x03, 0xF2,
+    0xF3, 0x1C, 0x70, 0x1B, 0x17, 0xB0, 0x6C, 0x5F, 0x17, 0x1C, 0x16, 0x61, 0x36, 0x84, 0xC1, 0xBF,
+    0x1B, 0xEE, 0xE3, 0x7D, 0xA3, 0x20, 0x7E, 0xD3, 0x00, 0xE9, 0x53, 0x0B, 0xE4, 0x34, 0x0E, 0x9B,
+    0x9F, 0x2C, 0xD2, 0xBF, 0x3B, 0x3A, 0x9D, 0x59, 0xDA, 0x6A, 0x2C, 0x72, 0x6B, 0x76, 0xAE, 0xF4,
+    0x30, 0x42, 0x4F, 0x33, 0xE9, 0xB8, 0xF1, 0xBB, 0x00, 0x7C, 0xF4, 0x36, 0x07, 0x53, 0xF1, 0x48,
+    0x10, 0x69, 0xBB, 0x67, 0x9C, 0xAA, 0xFE, 0x07, 0xC6, 0x45, 0xBF, 0x04, 0x93, 0x5A, 0x0E, 0x12,
+    0x94, 0xFC, 0xC1, 0x61, 0x93, 0xA9, 0x50, 0x55, 0xEC, 0xFE, 0x7B, 0xE3, 0x8E, 0xA0, 0x40, 0xD4,
+    0xEA, 0x0A, 0xCA, 0x19, 0x9E, 0x38, 0x90, 0xCD, 0xD0, 0xCC, 0xA1, 0x58, 0x72, 0x50, 0x94, 0xFC,
+    0x4D, 0x74, 0xFD, 0x88, 0xF2, 0x2D, 0x4D, 0x4A, 0x36, 0x7A, 0xF7, 0x92, 0x14, 0x5A, 0xA4, 0x85,
+    0x0A, 0xAC, 0xC3, 0x89, 0x00, 0x1C, 0x87, 0x8C, 0x92, 0xE9, 0x88, 0xFC, 0x32, 0xA3, 0x0F, 0xD9,
+    0x93, 0xFD, 0x19, 0x25, 0x95, 0xA3, 0x5D, 0x2E, 0xEB, 0x6D, 0x46, 0x37, 0xD0, 0x3B, 0x69, 0x52,
+    0x87, 0xBC, 0xE2, 0x6E, 0xCF, 0x4F, 0x5A, 0xD3, 0x7C, 0x13, 0x56, 0xB8, 0xEC, 0x19, 0x87, 0xA8,
+    0xEB, 0xA9, 0xE1, 0x2D, 0xA3, 0xA2, 0x24, 0x28, 0x0D, 0x41, 0xC8, 0xEC, 0x9E, 0x97, 0x23, 0x61,
+    0xA8, 0x63, 0x0F, 0xEC, 0xE3, 0xA2, 0x87, 0x7B, 0xC2, 0x65, 0x1F, 0xE6, 0x37, 0x42, 0xC1, 0x14,
+    0xEC, 0xCE, 0x23, 0x6B, 0x3D, 0x62, 0x4F, 0x79, 0xEF, 0x27, 0x4F, 0x97, 0xDD, 0x4F, 0xF2, 0xB4,
+    0x95, 0x0D, 0xA9, 0xA7, 0xFD, 0x37, 0x0E, 0xE8, 0x59, 0x76, 0xAC, 0x30, 0x29, 0x21, 0x3B, 0x29,
+    0xC3, 0x11, 0xF7, 0x98, 0x59, 0x53, 0xA0, 0x0F, 0x85, 0x5B, 0x9B, 0x89, 0x36, 0x99, 0x35, 0x50,
+    0x4D, 0xD2, 0xC4, 0x9E, 0xF6, 0x2C, 0x68, 0x1D, 0x4D, 0x33, 0x3C, 0xCB, 0x49, 0x70, 0xB7, 0xAC,
+    0xB8, 0x24, 0x9C, 0xA8, 0xF1, 0x54, 0xCB, 0x53, 0xF9, 0x76, 0x60, 0x1C, 0x27, 0xEA, 0x19, 0x27,
+    0x6B, 0x66, 0xE4, 0xE0, 0x83, 0xD8, 0x1B, 0x62, 0x9C, 0x6B, 0x72, 0xD2, 0x01, 0x2B, 0x2C, 0xEE,
+    0x3B, 0x53, 0xA8, 0x43, 0x01, 0xC5, 0x8C, 0x57, 0xCC, 0xBD, 0xFB, 0x08, 0x5A, 0x4A, 0x91, 0x89,
+    0x54, 0x67, 0x2F, 0x2E, 0x8A, 0x02, 0x5B, 0x93, 0xB5, 0x21, 0x32, 0xDA, 0x46, 0x73, 0x89, 0x45,
+    0xBC, 0x79, 0x79, 0xF9, 0x75, 0x07, 0xCD, 0x44, 0x9B, 0x75, 0x06, 0xA0, 0x83, 0x62, 0xE2, 0xCD,
+    0x63, 0x97, 0x4A, 0x26, 0xFD, 0x6A, 0x26, 0x3F, 0x34, 0xD1, 0x78, 0x99, 0x7C, 0xCE, 0x04, 0x32,
+    0xF8, 0xAA, 0x19, 0xE3, 0x19, 0x50, 0xCE, 0xE0, 0xD0, 0x51, 0x02, 0x79, 0x8C, 0x43, 0x4C, 0xDF,
+    0xF2, 0x9F, 0x2C, 0xF9, 0x6D, 0x75, 0x91, 0x56, 0x87, 0x8D, 0x72, 0x1C, 0x5F, 0xA9, 0x21, 0xAE,
+    0x8D, 0xDC, 0x8B, 0x5C, 0xD9, 0xA6, 0x38, 0x55, 0x2C, 0x11, 0x32, 0xA9, 0x15, 0x19, 0xA1, 0x6F,
+    0xCE, 0xEA, 0x63, 0x24, 0xE2, 0xC4, 0xA6, 0x09, 0xE5, 0xDA, 0xC2, 0x2E, 0x44, 0xF4, 0x3F, 0xDF,
+    0xFB, 0x01, 0x09, 0xD5, 0xEA, 0xA7, 0x55, 0x40, 0x89, 0x48, 0x19, 0xFD, 0xBA, 0x8B, 0xE5, 0x91,
+    0xC8, 0x55, 0x25, 0x6E, 0x75, 0xAC, 0xCE, 0x63, 0x11, 0x12, 0xD6, 0x65, 0x66, 0x3D, 0xBE, 0xD9,
+    0x7F, 0x5B, 0x1C, 0x1E, 0xC2, 0x58, 0xE3, 0x0E, 0xC9, 0x0B, 0x87, 0x2F, 0x12, 0x8B, 0xEB, 0x1A,
+    0x68, 0x56, 0xC7, 0xC0, 0x45, 0x0F, 0xDE, 0x81, 0x29, 0x69, 0x23, 0x91, 0x2E, 0xD9, 0x39, 0xDD,
+    0x1E, 0x01, 0x2B, 0x6C, 0x2C, 0x87, 0x09, 0xF0, 0xD4, 0x3D, 0x32, 0x48, 0xB6, 0x87, 0x5B, 0x25,
+    0x6F, 0x5F, 0x22, 0x24, 0x6F, 0xDC, 0x08, 0x58, 0x96, 0x48, 0x88, 0xBF, 0xF8, 0x4B, 0xE4, 0xC9,
+    0x6F, 0xD2, 0x65, 0x53, 0x51, 0x8F, 0xED, 0x28, 0x99, 0x4D, 0xFD, 0x8C, 0x73, 0x29, 0x2E, 0xDE,
+    0xFD, 0xF2, 0x6D, 0x9B, 0x39, 0xFA, 0x29, 0xA3, 0xD6, 0xB4, 0x05, 0xDF, 0xA6, 0x50, 0x95, 0x41,
+    0x7F, 0x19, 0x20, 0x4E, 0x6E, 0x0C, 0xF3, 0x8D, 0x86, 0x64, 0x65, 0xB3, 0xF2, 0xEB, 0xEC, 0xD5,
+    0x7C, 0xAE, 0x1D, 0xD6, 0xC7, 0xE5, 0xC0, 0xD8, 0x88, 0xD5, 0xC2, 0xEC, 0x29, 0x17, 0x1C, 0xE1,
+    0xC9, 0xA0, 0x9C, 0x6F, 0x41, 0x79, 0xF5, 0xF9, 0xC9, 0xBA, 0x94, 0x96, 0xA9, 0x2E, 0xCA, 0x81,
+    0x01, 0x6B, 0x03, 0xCD, 0x27, 0x12, 0x22, 0x92, 0x5D, 0x7A, 0xE4, 0xCC, 0xCE, 0x5D, 0xAA, 0x0A,
+    0x4A, 0xF2, 0x62, 0xA4, 0x80, 0xC1, 0x87, 0x9F, 0x76, 0xBA, 0x22, 0x78, 0x2F, 0xA9, 0x7E, 0xC5,
+    0x65, 0xE1, 0x6D, 0xA4, 0xFE, 0x6F, 0xB9, 0x42, 0x69, 0x49, 0x53, 0xD7, 0xA6, 0x3A, 0x39, 0x4B,
+    0x0F, 0xEC, 0x68, 0xC1, 0xA7, 0xB6, 0x7F, 0x01, 0xB5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x7D,
+    0xB6, 0xB9, 0x58, 0x8A, 0x8B, 0xA5, 0x20, 0x08, 0x09, 0x29, 0x47, 0x4B, 0xA4, 0xE0, 0x3F, 0x90,
+    0x64, 0x8D, 0x10, 0xD4, 0x34, 0x51, 0x7E, 0x03, 0x15, 0x94, 0x14, 0xE8, 0x6C, 0x41, 0x41, 0x1B,
+    0xFE, 0x41, 0x0A, 0x0A, 0x30, 0x45, 0x28, 0x52, 0x72, 0x89, 0x49, 0xFE, 0x80, 0x25, 0xA0, 0xC6,
+    0x12, 0x12, 0x12, 0x54, 0x2B, 0xE1, 0x20, 0x27, 0xB2, 0x3D, 0xBC, 0xF5, 0xF9, 0xF2, 0x41, 0x93,
+    0xA4, 0x38, 0xFB, 0xC6, 0x5A, 0xDF, 0xEE, 0xCE, 0xBC, 0xF7, 0x66, 0x76, 0x8C, 0x27, 0x00, 0x86,
+    0x19, 0xE0, 0xD6, 0x1C, 0x84, 0x11, 0x07, 0x86, 0x83, 0x45, 0x9C, 0x5E, 0x61, 0x1B, 0x41, 0x4B,
+    0x05, 0xFD, 0x66, 0x2F, 0xD1, 0x91, 0x67, 0x86, 0x09, 0x76, 0x83, 0x1C, 0xEA, 0xC0, 0xC0, 0x33,
+    0x6D, 0x9A, 0xD6, 0x5A, 0x44, 0xD4, 0xEF, 0x34, 0x7D, 0x65, 0x77, 0x5A, 0x37, 0x9A, 0x6E, 0x7C,
+    0xFB, 0xD2, 0x5A, 0xE7, 0x87, 0x83, 0x1D, 0x47, 0xA4, 0x41, 0x40, 0xC3, 0x80, 0x53, 0x98, 0x4F,
+    0x80, 0xC0, 0x4C, 0xD6, 0x78, 0xA6, 0x0F, 0x69, 0x66, 0x19, 0xD2, 0xDD, 0xA2, 0x71, 0xCA, 0x95,
+    0x1C, 0x4E, 0xD5, 0xD0, 0xE8, 0xAE, 0xC4, 0x8B, 0x19, 0x86, 0xBC, 0xEE, 0x70, 0x09, 0x99, 0xA9,
+    0xAC, 0x86, 0x9B, 0x9F, 0x15, 0xD4, 0x5E, 0x7B, 0x47, 0x80, 0x48, 0x81, 0xF6, 0x51, 0x8B, 0x86,
+    0x6B, 0x46, 0x70, 0x2B, 0xAA, 0xAF, 0x55, 0xC6, 0x90, 0xC7, 0xE9, 0x07, 0xC3, 0x68, 0xB5, 0x4E,
+    0xD3, 0x94, 0x7F, 0x74, 0x1A, 0x71, 0xD5, 0x24, 0x51, 0x5E, 0xC5, 0x41, 0xFC, 0xF5, 0x66, 0xEE,
+    0x8B, 0x94, 0x08, 0x69, 0x58, 0x00, 0x96, 0xA2, 0x30, 0x0B, 0x0A, 0xB7, 0xC4, 0x27, 0x2C, 0x77,
+    0x01, 0x2A, 0x62, 0xBC, 0xE8, 0x7E, 0xE7, 0x55, 0xBE, 0x51, 0x99, 0xC6, 0xF3, 0x6E, 0xCB, 0x1A,
+    0xF4, 0x85, 0x37, 0xEE, 0x12, 0x77, 0x44, 0x19, 0x83, 0x1F, 0x66, 0x18, 0xD5, 0x2B, 0xB8, 0xD7,
+    0x13, 0x5A, 0x83, 0x9D, 0xBD, 0xE2, 0xEF, 0x1A, 0x1E, 0x14, 0x7A, 0xE4, 0xFD, 0xC9, 0xA7, 0x5E,
+    0xA0, 0x12, 0xE2, 0x22, 0xE7, 0x4B, 0x3D, 0xB8, 0x1F, 0x70, 0x4A, 0x3F, 0x43, 0xF8, 0x93, 0x6F,
+    0x71, 0x97, 0xE0, 0x04, 0x8E, 0x4D, 0x41, 0xFC, 0x9A, 0x89, 0x4B, 0xAC, 0x60, 0x18, 0xA3, 0x93,
+    0x70, 0xFE, 0x57, 0x18, 0x29, 0x69, 0x2A, 0x4F, 0xB6, 0x25, 0x6B, 0x11, 0xD4, 0x9C, 0x0C, 0x0F,
+    0x28, 0x5F, 0x43, 0x2C, 0xC1, 0x17, 0x6A, 0x3C, 0x9E, 0x0E, 0x6A, 0x0E, 0xD4, 0x7E, 0xC5, 0x32,
+    0x51, 0x39, 0x61, 0xC6, 0xC9, 0xB0, 0x60, 0x72, 0x2B, 0x7A, 0x67, 0xDA, 0xF0, 0x98, 0x76, 0x03,
+    0x77, 0x1C, 0x49, 0x3E, 0x7A, 0x72, 0x6C, 0x82, 0xFB, 0x54, 0x83, 0x09, 0x98, 0x52, 0x58, 0x09,
+    0x24, 0x59, 0x8D, 0xA5, 0xD4, 0x47, 0x1B, 0xB5, 0xCE, 0xD1, 0xEA, 0x04, 0x23, 0xCB, 0xF6, 0xAA,
+    0x86, 0x25, 0xF4, 0xC7, 0x92, 0x20, 0x3A, 0xC1, 0x26, 0x75, 0xE7, 0xE6, 0x67, 0x4F, 0x0A, 0xF9,
+    0x0E, 0x45, 0x22, 0xAF, 0xD9, 0x68, 0x58, 0x88, 0xBE, 0xB1, 0xA4, 0x5E, 0x96, 0x3D, 0x05, 0x16,
+    0xEF, 0x79, 0x76, 0xAA, 0x63, 0xC7, 0x42, 0x53, 0x9F, 0x59, 0x95, 0x95, 0x2A, 0x10, 0x43, 0x6F,
+    0x3E, 0xCD, 0x1D, 0x5B, 0x4B, 0xAE, 0x54, 0x3D, 0x3B, 0xCC, 0x6D, 0xF5, 0x75, 0x1D, 0xF2, 0xA8,
+    0xFA, 0x45, 0x57, 0x4F, 0xE7, 0xBB, 0xC2, 0x8C, 0x22, 0x3B, 0x6F, 0x2D, 0x55, 0x32, 0x54, 0x42,
+    0xA6, 0x87, 0xE4, 0x3B, 0x66, 0xEA, 0x16, 0x11, 0x44, 0xB3, 0x8E, 0xBC, 0x80, 0x5B, 0x08, 0x1A,
+    0x2F, 0x73, 0xA4, 0xAD, 0xB0, 0x1C, 0x08, 0xDC, 0x24, 0x48, 0x4E, 0x83, 0xDA, 0x85, 0xDD, 0x0E,
+    0xFD, 0x2D, 0xCE, 0xAD, 0x0F, 0xA7, 0x9E, 0x1C, 0xD9, 0x2E, 0x60, 0x3D, 0x8D, 0x73, 0x52, 0x42,
+    0x4D, 0x57, 0x42, 0x16, 0x94, 0x45, 0x97, 0x58, 0x98, 0xDE, 0xD1, 0x5C, 0xD3, 0x01, 0xEF, 0x18,
+    0x60, 0xD0, 0xF9, 0x8D, 0xE0, 0xE7, 0x3C, 0x3B, 0xBB, 0xEC, 0x24, 0x5E, 0xB6, 0xFA, 0x5F, 0x97,
+    0x98, 0x51, 0xD0, 0xA8, 0xAF, 0xA4, 0x98, 0x03, 0xDB, 0x5F, 0x9C, 0xCD, 0x93, 0x88, 0x8C, 0x26,
+    0x4D, 0xCC, 0xC7, 0xC3, 0xF5, 0xF5, 0xF5, 0x53, 0xCD, 0x6D, 0x07, 0x72, 0x9A, 0x7E, 0xCB, 0x44,
+    0x96, 0x01, 0xD1, 0x95, 0x15, 0x9B, 0x98, 0xF4, 0xE8, 0x1C, 0x21, 0x3A, 0x5D, 0x86, 0x51, 0xF0,
+    0xFD, 0xC0, 0x38, 0x25, 0xD1, 0xAD, 0x11, 0x9D, 0xCA, 0xC6, 0xDA, 0x2D, 0x89, 0x6E, 0x44, 0x74,
+    0x2A, 0x53, 0xFB, 0x7F, 0x0D, 0xD1, 0x35, 0x44, 0x27, 0x89, 0x6F, 0xFC, 0x86, 0xE8, 0xF6, 0x88,
+    0x6E, 0xB8, 0x4D, 0x74, 0xCF, 0x06, 0xD3, 0x78, 0xEF, 0x6D, 0x8B, 0xEC, 0xCB, 0x8F, 0x5D, 0x78,
+    0xF2, 0x85, 0xD8, 0x39, 0x81, 0x33, 0x62, 0xBF, 0xA1, 0xE9, 0x4B, 0x5A, 0x4C, 0xDB, 0xA3, 0x34,
+    0xA2, 0xD9, 0xB9, 0xC2, 0xE2, 0xB6, 0x28, 0x11, 0x4D, 0x6D, 0xC3, 0x89, 0x1C, 0xF6, 0x73, 0xC4,
+    0x43, 0xCA, 0xB2, 0xE8, 0x64, 0xB1, 0x5C, 0xFD, 0x64, 0x36, 0xB1, 0x5C, 0x2A, 0xAD, 0x98, 0x9F,
+    0x90, 0x5A, 0xEE, 0x6A, 0xF6, 0x2E, 0x95, 0x79, 0x99, 0x5B, 0xCC, 0x86, 0xD7, 0x65, 0xAE, 0x7F,
+    0xCD, 0x55, 0xBF, 0xAF, 0xDC, 0x44, 0x10, 0xFE, 0x6C, 0xEB, 0xB0, 0x82, 0x8B, 0x4D, 0xC1, 0x93,
+    0x22, 0x45, 0x62, 0x7B, 0x1A, 0xB7, 0x54, 0xB7, 0xA6, 0x81, 0x32, 0x29, 0x48, 0x43, 0x24, 0x42,
+    0x9D, 0xE6, 0xB5, 0x14, 0x4F, 0xEF, 0xDC, 0x51, 0xF2, 0x0A, 0x52, 0x87, 0x86, 0x22, 0x17, 0x41,
+    0x45, 0x41, 0x73, 0xB1, 0x05, 0x05, 0x65, 0x2C, 0xF1, 0x07, 0xC4, 0x08, 0x22, 0x45, 0x34, 0x58,
+    0xC4, 0x11, 0xE6, 0xB1, 0xE7, 0xE1, 0x9B, 0xDD, 0xBB, 0x97, 0x7B, 0x91, 0x90, 0xA0, 0x02, 0x9F,
+    0x66, 0xEF, 0xBC, 0x3F, 0x66, 0xBE, 0xF9, 0xE6, 0xDB, 0x39, 0x5C, 0x4D, 0x80, 0xC9, 0xB4, 0x09,
+    0x0D, 0x63, 0x51, 0xE3, 0xE0, 0x39, 0x05, 0x96, 0x34, 0xF7, 0x0F, 0x6D, 0x45, 0x6B, 0x1C, 0x20,
+    0xAE, 0x4A, 0xA5, 0xEC, 0xAF, 0x8B, 0x11, 0x71, 0xA9, 0x4C, 0x25, 0x16, 0xEA, 0xED, 0x75, 0xFA,
+    0x2E, 0x06, 0x20, 0xA7, 0x65, 0xB4, 0x94, 0x86, 0xE1, 0x65, 0xB4, 0x0D, 0x60, 0xEF, 0xD7, 0x28,
+    0x7E, 0x18, 0xB8, 0xBC, 0x41, 0x00, 0xB4, 0xE1, 0x46, 0x47, 0x1C, 0xB6, 0x36, 0xAD, 0x69, 0xD3,
+    0x91, 0xAF, 0xCB, 0x74, 0x84, 0x69, 0x3D, 0x92, 0x71, 0xC9, 0xB0, 0x65, 0x85, 0xE2, 0x71, 0x0B,
+    0xFC, 0xD9, 0xF3, 0x45, 0x9D, 0x7B, 0x7A, 0xDA, 0xD2, 0x88, 0x83, 0xA7, 0x18, 0xB1, 0x8B, 0xD1,
+    0xB2, 0x11, 0xC9, 0xED, 0x89, 0x00, 0xB9, 0xA1, 0x1C, 0xB9, 0x78, 0x44, 0x63, 0x84, 0xB0, 0x08,
+    0xBF, 0x3B, 0x71, 0x79, 0xA2, 0x90, 0xDA, 0xDC, 0x17, 0x9F, 0xC9, 0xBD, 0xA6, 0x95, 0x2A, 0x9B,
+    0x5C, 0x0D, 0xC7, 0x1D, 0x86, 0x08, 0xD3, 0x91, 0x3B, 0x4E, 0x79, 0xC4, 0x7E, 0xDA, 0x22, 0xFF,
+    0x69, 0x20, 0x5C, 0x4E, 0x6C, 0x38, 0xE1, 0x6E, 0xF4, 0x30, 0xDF, 0x79, 0x98, 0x5E, 0x7A, 0x3B,
+    0x2C, 0x1B, 0x19, 0xCC, 0x27, 0xD2, 0x67, 0xC3, 0xE2, 0xEF, 0xA2, 0xEC, 0x26, 0x00, 0xAD, 0x84,
+    0x23, 0x2B, 0x9A, 0x5D, 0xDA, 0xBD, 0x79, 0x58, 0x09, 0xC6, 0x63, 0x38, 0xF2, 0x5B, 0xDE, 0x60,
+    0xFC, 0x6F, 0x47, 0xE4, 0xBD, 0xE3, 0x1C, 0xCF, 0xF9, 0x64, 0x22, 0x3F, 0x8E, 0x9F, 0xA2, 0xE3,
+    0xEB, 0xC4, 0x7C, 0x1D, 0x7D, 0xE7, 0x1D, 0x73, 0xF5, 0xA4, 0xB4, 0xA4, 0xFF, 0xEC, 0x57, 0x12,
+    0x21, 0x8C, 0x61, 0x23, 0x11, 0x31, 0x30, 0xBD, 0x81, 0xF4, 0x85, 0xE0, 0xA6, 0xC3, 0xE2, 0xB8,
+    0x47, 0x2A, 0xDC, 0xD0, 0x74, 0xA1, 0x5A, 0xEB, 0x07, 0x40, 0x22, 0x42, 0x5E, 0xAD, 0x6C, 0x2F,
+    0x61, 0x89, 0xD8, 0xE1, 0x54, 0x2B, 0x85, 0x7A, 0x82, 0xE8, 0x11, 0xAB, 0x0E, 0xB3, 0xDF, 0x74,
+    0x6D, 0x69, 0x2B, 0x65, 0x5E, 0xD7, 0xBC, 0x16, 0xC0, 0xD6, 0xA7, 0x5A, 0x6F, 0x3D, 0xE7, 0x34,
+    0x26, 0xE7, 0xBC, 0x82, 0x60, 0x68, 0x2B, 0x32, 0x33, 0xAE, 0x30, 0xB2, 0x5B, 0xAF, 0x9B, 0x2A,
+    0xEF, 0x49, 0xA5, 0xAE, 0x9A, 0xD6, 0x12, 0xD8, 0x23, 0x4D, 0x3C, 0x1B, 0x94, 0x24, 0xF7, 0x1E,
+    0xB1, 0x04, 0x9A, 0xB9, 0x96, 0xAC, 0xD7, 0x75, 0x21, 0x52, 0x59, 0xF1, 0x7B, 0x54, 0x09, 0x61,
+    0xAE, 0xE8, 0xEC, 0x8F, 0x77, 0xB7, 0x09, 0xD2, 0x29, 0xC2, 0xD4, 0xE4, 0x1C, 0x5E, 0x7B, 0xE8,
+    0xB9, 0x79, 0x90, 0x2F, 0xEE, 0x3C, 0xEE, 0xE1, 0x56, 0x54, 0xC8, 0x84, 0xEC, 0xF7, 0x1E, 0xF6,
+    0x49, 0x4B, 0xB5, 0xD6, 0xA5, 0x5F, 0xC9, 0x8B, 0x61, 0x35, 0xE7, 0xED, 0x82, 0xB8, 0xAF, 0xE1,
+    0x0A, 0x9D, 0xF5, 0x29, 0xA3, 0x99, 0x5F, 0xD4, 0xFB, 0x4A, 0x38, 0x8B, 0xAF, 0xEA, 0xFF, 0x1D,
+    0x09, 0x69, 0x8D, 0xB3, 0xA2, 0x32, 0x95, 0x25, 0xCC, 0x92, 0xF5, 0x2D, 0x7E, 0xBE, 0x40, 0x67,
+    0xA5, 0xCB, 0x59, 0x3C, 0xF3, 0xD9, 0x71, 0x77, 0x15, 0x65, 0x1D, 0x65, 0xE6, 0x03, 0xEA, 0xBB,
+    0x4D, 0xDB, 0x88, 0x98, 0xF3, 0x5B, 0x7E, 0x26, 0x09, 0x94, 0xDB, 0x93, 0x5A, 0xAF, 0x6F, 0xB2,
+    0x25, 0x94, 0xE7, 0x53, 0x2A, 0xDF, 0x8B, 0xDC, 0xC9, 0xA5, 0x3F, 0xC1, 0xFB, 0xD8, 0xC9, 0x13,
+    0xD9, 0xA4, 0x63, 0xA3, 0x2A, 0x35, 0xAA, 0x85, 0x84, 0xDC, 0xE9, 0xE5, 0xD3, 0xA5, 0x1F, 0x55,
+    0x4F, 0x9B, 0x20, 0xA2, 0x76, 0xA3, 0xD8, 0x08, 0x1E, 0xA5, 0x9E, 0xCB, 0x06, 0xC5, 0xBD, 0xD1,
+    0x04, 0x55, 0xA8, 0xAA, 0x26, 0xCA, 0xA9, 0xE4, 0x88, 0xEC, 0x7C, 0xFD, 0x70, 0x54, 0x05, 0xEA,
+    0xC5, 0x26, 0xB0, 0x84, 0xD0, 0x8A, 0x5E, 0xD5, 0xE8, 0xE2, 0x65, 0x55, 0x1A, 0xF5, 0x6A, 0x45,
+    0xA9, 0xC2, 0x06, 0x14, 0xE1, 0x96, 0x68, 0x38, 0x18, 0xBC, 0xFC, 0xF9, 0x4C, 0xC7, 0x55, 0x10,
+    0xED, 0xCD, 0x30, 0xCD, 0x7A, 0x69, 0xEE, 0xD9, 0xD3, 0xEB, 0x63, 0x14, 0x42, 0xF0, 0x11, 0x8D,
+    0x4A, 0x20, 0xCF, 0x5E, 0xB3, 0x67, 0xE9, 0x3C, 0xA5, 0xE0, 0x4F, 0x83, 0x25, 0xFC, 0x9D, 0x79,
+    0xD5, 0x02, 0xE5, 0x7E, 0x12, 0xF2, 0x3F, 0xC2, 0x37, 0x2C, 0x18, 0xB3, 0xC9, 0x19, 0xB8, 0xD8,
+    0x59, 0x7E, 0xCE, 0x39, 0xA1, 0xAF, 0x37, 0x68, 0x0F, 0x10, 0x5B, 0x1A, 0x5C, 0xB5, 0xBB, 0x58,
+    0x5A, 0xF3, 0x88, 0xEB, 0xE2, 0xE6, 0xCA, 0x5C, 0x81, 0x84, 0xB7, 0x76, 0x5E, 0x6F, 0x41, 0x29,
+    0x7D, 0x64, 0xF4, 0x44, 0x83, 0xFD, 0x09, 0xCD, 0xEA, 0xD1, 0xFE, 0xCD, 0x74, 0x7B, 0xCE, 0xFD,
+    0xA5, 0x29, 0x2D, 0x21, 0x56, 0xD8, 0x35, 0xB7, 0x4C, 0x17, 0x73, 0xCD, 0xAC, 0x08, 0xC3, 0x7C,
+    0xEB, 0x18, 0x14, 0xB8, 0x57, 0x0D, 0x11, 0xEF, 0x51, 0x15, 0xDB, 0x6D, 0xEA, 0xC3, 0x19, 0x32,
+    0xAC, 0xBD, 0xF6, 0xED, 0x03, 0x71, 0x9C, 0x59, 0x99, 0xB3, 0xF9, 0x83, 0x6E, 0x0E, 0xF1, 0xB5,
+    0x4C, 0x2E, 0x2A, 0xFA, 0x95, 0xAF, 0x0A, 0x5A, 0x19, 0xD3, 0x2B, 0xC1, 0x1F, 0x6A, 0x37, 0x48,
+    0xB5, 0x17, 0x28, 0xCD, 0x6F, 0x61, 0xC7, 0x83, 0x9D, 0x11, 0x3B, 0x8D, 0xA9, 0x39, 0x7C, 0x8D,
+    0x93, 0xFF, 0x3E, 0xF7, 0xF4, 0x73, 0xFA, 0xD1, 0x6E, 0xD6, 0x51, 0x43, 0x5D, 0x32, 0x15, 0xAD,
+    0xA9, 0xF2, 0xFA, 0x20, 0x7B, 0xCA, 0xA3, 0x76, 0x4F, 0xBF, 0x54, 0x59, 0x2B, 0x84, 0xCD, 0x61,
+    0xAF, 0xD8, 0x5F, 0x93, 0xF8, 0x5A, 0xC5, 0xC8, 0xB3, 0xB6, 0x97, 0x77, 0x3E, 0x0E, 0xFD, 0xB0,
+    0x61, 0x1E, 0xE1, 0x0F, 0xED, 0xCA, 0x25, 0xA8, 0x45, 0x8B, 0x57, 0x9F, 0x46, 0xCE, 0x54, 0xEE,
+    0x43, 0x2E, 0xBC, 0xD3, 0xAE, 0xC3, 0xB5, 0x80, 0xBD, 0x6C, 0x77, 0x99, 0xE8, 0x1F, 0x61, 0x4C,
+    0x6E, 0x7B, 0x91, 0x6F, 0xBB, 0xA7, 0xE0, 0x62, 0xAA, 0xE8, 0xF7, 0x44, 0x29, 0x18, 0x28, 0xE5,
+    0x89, 0x52, 0x9E, 0x86, 0x41, 0xEE, 0xDD, 0x6E, 0xB5, 0x71, 0x68, 0x30, 0x66, 0xB3, 0xB8, 0x89,
+    0x7F, 0xF9, 0xFC, 0x05, 0xB5, 0x55, 0xBF, 0x6F, 0xD3, 0x40, 0x14, 0xFE, 0x9C, 0x28, 0xB1, 0xA8,
+    0x87, 0x9B, 0x60, 0xF5, 0xCA, 0xE6, 0x3F, 0x21, 0xC7, 0xC2, 0xCC, 0x52, 0x31, 0x74, 0x61, 0x60,
+    0x45, 0x59, 0x19, 0x80, 0x9C, 0x60, 0x60, 0x60, 0x20, 0xFC, 0x05, 0x74, 0x84, 0x43, 0x6C, 0x1D,
+    0x58, 0x92, 0x58, 0xEA, 0x1F, 0x40, 0x40, 0x4C, 0x2C, 0x78, 0x00, 0x09, 0xBA, 0xD4, 0x83, 0x91,
+    0xDC, 0xEA, 0xEC, 0xE3, 0x7B, 0x67, 0x87, 0xA6, 0xA0, 0x6E, 0xED, 0x29, 0xB9, 0x7B, 0x3E, 0xBF,
+    0x7B, 0xEF, 0xBE, 0xEF, 0xFD, 0x30, 0x22, 0x03, 0x4C, 0x80, 0x61, 0x19, 0x96, 0xB3, 0x11, 0xF9,
+    0x93, 0xC8, 0xFB, 0x62, 0xF2, 0xE3, 0xBD, 0x2A, 0x10, 0x39, 0x20, 0xD3, 0x1B, 0xA5, 0x7F, 0x96,
+    0x0A, 0x48, 0x73, 0xA0, 0x05, 0xE2, 0x66, 0x54, 0xA4, 0xBE, 0x45, 0xE6, 0xD7, 0x18, 0x01, 0x37,
+    0xB1, 0x03, 0x3C, 0x46, 0x0D, 0x3C, 0x49, 0xE9, 0x65, 0x49, 0x23, 0x58, 0x51, 0x13, 0xCD, 0xB6,
+    0xA3, 0x81, 0x6F, 0x35, 0x56, 0xDE, 0xE7, 0x69, 0x6B, 0x1B, 0x78, 0x8D, 0x7B, 0xAA, 0x14, 0x45,
+    0x74, 0xA6, 0x83, 0x6D, 0x2C, 0x37, 0x4F, 0x6A, 0x8D, 0xFE, 0xA2, 0xEE, 0xDC, 0x56, 0x46, 0x07,
+    0x98, 0xA1, 0x37, 0x3E, 0x94, 0x97, 0x31, 0x1D, 0x23, 0x09, 0x53, 0xBB, 0x3B, 0x45, 0xE2, 0xBD,
+    0xA3, 0x33, 0x5F, 0x00, 0xD7, 0x35, 0x06, 0x06, 0xFB, 0xC9, 0x3A, 0x35, 0xC9, 0xE7, 0x1A, 0xEA,
+    0xD8, 0x40, 0xB9, 0xDE, 0x53, 0x37, 0x52, 0x3F, 0x8F, 0xBD, 0x37, 0x44, 0x3F, 0xAC, 0xBB, 0x17,
+    0x8B, 0x0E, 0xB0, 0xCA, 0x3B, 0xF7, 0x6E, 0xEB, 0x51, 0x77, 0x9E, 0x5B, 0x21, 0xED, 0xD6, 0x43,
+    0x61, 0x8D, 0x78, 0xB4, 0x30, 0x10, 0xCD, 0x71, 0x1F, 0xA8, 0x07, 0xC2, 0x94, 0xA8, 0xA6, 0x5E,
+    0xEE, 0x25, 0x37, 0x1C, 0xD4, 0xDB, 0x1C, 0xAC, 0xFC, 0x2F, 0xC0, 0xCB, 0x41, 0x4E, 0x0D, 0xE4,
+    0x9E, 0x5A, 0x28, 0x5F, 0x73, 0x4A, 0x4A, 0xF1, 0x55, 0x39, 0x39, 0xC3, 0x29, 0x72, 0x82, 0xED,
+    0x6C, 0x6A, 0xFE, 0x4E, 0x7F, 0xF7, 0x82, 0x4A, 0x50, 0x0E, 0xC7, 0x94, 0x18, 0xC8, 0x72, 0xC7,
+    0xDB, 0xE9, 0xD6, 0xAE, 0x9A, 0x8D, 0xA3, 0x93, 0xE0, 0x7A, 0x14, 0xDD, 0xE1, 0x89, 0x5A, 0x30,
+    0xA5, 0xCF, 0xD7, 0x22, 0x3E, 0x12, 0xF1, 0x85, 0x16, 0x51, 0x02, 0x21, 0xA1, 0xA3, 0x48, 0x13,
+    0x8D, 0x32, 0x0C, 0xAD, 0xAB, 0x11, 0x9F, 0xDC, 0xF5, 0x86, 0x78, 0x49, 0x2E, 0xA9, 0x99, 0x18,
+    0x86, 0x81, 0x78, 0x26, 0xA2, 0x4B, 0x52, 0xA2, 0x33, 0x11, 0xE7, 0x77, 0x35, 0xC3, 0x44, 0x45,
+    0x52, 0xCA, 0x98, 0xAD, 0x0C, 0x7F, 0xD3, 0x5A, 0x42, 0xF2, 0xD1, 0x20, 0xF6, 0x05, 0x5D, 0x44,
+    0x5A, 0xF8, 0xF1, 0xED, 0x5C, 0x28, 0xE1, 0x25, 0x19, 0x33, 0xA6, 0xD2, 0x42, 0xE8, 0x48, 0xD6,
+    0x18, 0x38, 0x89, 0x82, 0x2A, 0x29, 0xD2, 0xD6, 0x42, 0x30, 0x8A, 0x98, 0xE6, 0x0B, 0x01, 0x9E,
+    0x30, 0xB0, 0xEA, 0xA3, 0xE8, 0x37, 0xC2, 0xA1, 0xFA, 0xEA, 0xAD, 0xE1, 0xEE, 0x5A, 0x82, 0xB4,
+    0x10, 0x52, 0x44, 0xCC, 0x8C, 0xC4, 0xB1, 0x12, 0xD1, 0x8B, 0xB1, 0x2C, 0xA7, 0x98, 0x56, 0x58,
+    0x09, 0x2F, 0xF4, 0xD6, 0x8A, 0xE3, 0x9E, 0x18, 0x6C, 0xC0, 0x73, 0x8A, 0x76, 0xA7, 0x5F, 0x78,
+    0x31, 0x66, 0x50, 0x98, 0xCE, 0x5E, 0x64, 0x4D, 0x6A, 0x18, 0xF1, 0x97, 0x26, 0x6E, 0xF6, 0xBC,
+    0x61, 0xA9, 0x78, 0x13, 0x28, 0x09, 0x58, 0x03, 0xF6, 0x73, 0x93, 0xDA, 0x7E, 0x14, 0x15, 0xE6,
+    0xED, 0xC4, 0x04, 0x36, 0x92, 0x7A, 0xEC, 0x4D, 0x47, 0xC6, 0xAC, 0x25, 0xD3, 0xC2, 0xC5, 0xD8,
+    0x5A, 0x06, 0xAA, 0xE4, 0xC5, 0xFA, 0x44, 0xA1, 0x44, 0x74, 0xFE, 0x98, 0x8B, 0xEB, 0xB2, 0xEF,
+    0xFF, 0xE5, 0xD4, 0xBE, 0xA1, 0x0A, 0x99, 0x70, 0x17, 0xAA, 0x48, 0xB9, 0x5A, 0xFB, 0x9A, 0x78,
+    0x25, 0x17, 0x22, 0x4B, 0xA6, 0x66, 0xBE, 0x62, 0x7A, 0x6E, 0x55, 0x66, 0xE2, 0xE7, 0x50, 0x24,
+    0x44, 0x7D, 0x9F, 0x16, 0xBC, 0xA0, 0x8B, 0x0B, 0x64, 0x4F, 0x2B, 0x66, 0x3D, 0x0D, 0xB8, 0x89,
+    0xB5, 0x2B, 0xC5, 0xB3, 0x87, 0xA7, 0xD6, 0xEE, 0xBB, 0xBE, 0x24, 0xA5, 0x10, 0xA3, 0xF0, 0x60,
+    0x24, 0xCB, 0x6F, 0x3D, 0xA0, 0x51, 0xAF, 0x09, 0x49, 0x83, 0x49, 0xB6, 0x83, 0x31, 0x4A, 0x94,
+    0xF1, 0xD1, 0x92, 0x49, 0x94, 0x63, 0x3A, 0xBF, 0x52, 0x48, 0x06, 0x73, 0x7C, 0xC0, 0x01, 0xD4,
+    0x91, 0xE4, 0x3D, 0x15, 0x76, 0xBE, 0x6F, 0xD7, 0xDB, 0x89, 0x94, 0x5B, 0x81, 0xF6, 0x76, 0xCB,
+    0x7E, 0xA1, 0xF2, 0x27, 0x4C, 0x25, 0xF6, 0x37, 0xA9, 0x51, 0x45, 0x48, 0xEF, 0x4A, 0xDA, 0x10,
+    0x8C, 0x56, 0xCC, 0x4A, 0x1E, 0x87, 0xAE, 0x22, 0x6D, 0x40, 0xDA, 0x01, 0x66, 0x5F, 0x6E, 0xAC,
+    0x99, 0x07, 0x15, 0x81, 0xB0, 0x01, 0x5D, 0xE7, 0xCE, 0xB8, 0x2F, 0x11, 0x6A, 0x54, 0xD8, 0xE6,
+    0xF0, 0x0A, 0xB0, 0x01, 0xA6, 0x6F, 0x7F, 0x81, 0xF4, 0x1C, 0xE7, 0xC7, 0x65, 0x63, 0x63, 0x21,
+    0x7E, 0xEB, 0x3C, 0x7F, 0xBB, 0xE8, 0x72, 0xDE, 0xDA, 0x97, 0x34, 0x2A, 0x30, 0x2E, 0x52, 0x91,
+    0xE5, 0xC8, 0xBE, 0xED, 0xC8, 0x60, 0x95, 0xA5, 0x74, 0xC7, 0xED, 0x0F, 0xDC, 0xD6, 0x81, 0x33,
+    0xC5, 0x0E, 0x38, 0x63, 0x02, 0xDD, 0xB9, 0xEC, 0xE4, 0xCB, 0x11, 0xED, 0xC9, 0x96, 0x00, 0x14,
+    0x1D, 0x41, 0x2C, 0x2D, 0x4E, 0xFD, 0x94, 0x6F, 0x4F, 0x28, 0xF4, 0x6B, 0x18, 0x6B, 0x37, 0xA8,
+    0x86, 0xE5, 0x82, 0x4E, 0x35, 0x66, 0x45, 0x08, 0xE6, 0xA6, 0x35, 0x5F, 0x3E, 0x7C, 0xF9, 0xF8,
+    0x60, 0x41, 0x1F, 0xC9, 0x27, 0xFA, 0x59, 0xF2, 0xAF, 0x5C, 0x1F, 0xD2, 0xCD, 0xC8, 0xF8, 0x51,
+    0x9C, 0x78, 0xF6, 0xCC, 0x57, 0x2B, 0x36, 0x8A, 0x61, 0xC9, 0x56, 0xB3, 0x64, 0xAB, 0x52, 0x87,
+    0x25, 0x49, 0x60, 0x32, 0xB8, 0x09, 0x6D, 0xD1, 0xA4, 0x7D, 0x56, 0x6E, 0x92, 0x81, 0x3C, 0xC6,
+    0x65, 0xF7, 0x1D, 0x42, 0xFA, 0x7B, 0x74, 0x10, 0x49, 0x1B, 0x4C, 0xA4, 0xA4, 0x47, 0x1A, 0x17,
+    0x8D, 0x3F, 0xCD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0xB6, 0x45, 0x2C, 0xE1, 0xC2, 0x4D,
+    0x40, 0x48, 0x14, 0x6E, 0x68, 0x10, 0x22, 0xFE, 0x81, 0xE8, 0x76, 0x25, 0x7E, 0xC0, 0x05, 0x84,
+    0xCF, 0x48, 0x43, 0x41, 0x01, 0x67, 0xA3, 0x94, 0x29, 0x48, 0x43, 0x4F, 0x11, 0x24, 0x30, 0x0D,
+    0x1F, 0x40, 0xB0, 0x25, 0x3E, 0x00, 0x37, 0xD4, 0x59, 0x29, 0xA1, 0x09, 0x8D, 0x05, 0x96, 0x30,
+    0x27, 0xDB, 0xC3, 0xCC, 0xDE, 0x5D, 0x2E, 0x41, 0x20, 0xE5, 0x88, 0x94, 0xB0, 0x92, 0x47, 0x77,
+    0xB3, 0xB3, 0xEF, 0xBD, 0x7D, 0x3B, 0x6B, 0x03, 0x57, 0x33, 0x00, 0xB1, 0xE1, 0x50, 0x34, 0x80,
+    0xD3, 0xF6, 0x80, 0x6F, 0x62, 0x8D, 0x50, 0xFB, 0x25, 0x16, 0xC3, 0x29, 0x68, 0x07, 0x11, 0x51,
+    0x0F, 0x9A, 0xBC, 0xED, 0xBC, 0x01, 0xB8, 0x15, 0x72, 0x3D, 0x22, 0x29, 0x52, 0x82, 0x91, 0x4A,
+    0xD9, 0x07, 0x09, 0xFD, 0x71, 0xE8, 0x80, 0xFC, 0x4D, 0x07, 0x87, 0xC8, 0x06, 0xC9, 0xA5, 0x52,
+    0xA2, 0xA4, 0x58, 0x29, 0xCD, 0x21, 0x66, 0x00, 0x15, 0x32, 0xBF, 0xF2, 0xB9, 0x5A, 0xB9, 0xF4,
+    0x65, 0x83, 0x90, 0x12, 0x11, 0x7C, 0xA2, 0x43, 0xE0, 0x4A, 0xC2, 0xE4, 0xBB, 0xFC, 0x10, 0x2F,
+    0xA1, 0x9A, 0x31, 0xC7, 0xFC, 0xF8, 0x06, 0x8F, 0x71, 0x77, 0x21, 0x2F, 0xEE, 0x83, 0x2C, 0xA5,
+    0xEF, 0x26, 0xFD, 0x5C, 0xB4, 0x2A, 0xF3, 0x06, 0x96, 0xA5, 0xB6, 0x2B, 0x04, 0x07, 0x35, 0x6F,
+    0x89, 0x71, 0xC7, 0x0A, 0x08, 0x9F, 0x97, 0xF0, 0x38, 0x81, 0x69, 0x42, 0x23, 0xDA, 0x36, 0x08,
+    0x4D, 0x0F, 0xBF, 0x8D, 0xCD, 0xCD, 0xC1, 0x25, 0xDA, 0xCF, 0x22, 0xDA, 0x32, 0x58, 0x45, 0xCB,
+    0x90, 0x63, 0x81, 0x65, 0x85, 0x61, 0x99, 0x20, 0xAC, 0xD5, 0xAB, 0xCD, 0x3A, 0x20, 0xE6, 0xDF,
+    0x64, 0x1F, 0xB0, 0x02, 0x57, 0x23, 0xC8, 0x02, 0x0D, 0x6F, 0x52, 0x88, 0x36, 0x46, 0xC4, 0x9D,
+    0x1D, 0xFC, 0x2F, 0x86, 0xED, 0xE0, 0x25, 0xD6, 0xF1, 0x04, 0xC1, 0x11, 0x23, 0x10, 0x73, 0xAF,
+    0xB4, 0x27, 0xA4, 0x15, 0xCD, 0x1A, 0x63, 0x7F, 0x7A, 0x46, 0x1B, 0x64, 0x06, 0x84, 0x2D, 0x63,
+    0x0F, 0xBC, 0xD3, 0x98, 0xFD, 0xF1, 0xE7, 0x86, 0x8D, 0x4E, 0x18, 0x66, 0x9B, 0x62, 0x1C, 0x67,
+    0x50, 0x5B, 0x0D, 0x22, 0x53, 0x64, 0x9B, 0x2D, 0x5B, 0x31, 0x46, 0x3A, 0x84, 0x19, 0x12, 0xCF,
+    0x48, 0xDB, 0x30, 0xEC, 0x9E, 0x48, 0x74, 0x34, 0x54, 0x39, 0xBC, 0x28, 0xCA, 0x98, 0xA8, 0x74,
+    0x8A, 0x81, 0x15, 0xC3, 0x15, 0xD2, 0xB0, 0x3C, 0x15, 0x4E, 0x8F, 0x4B, 0x35, 0x0B, 0xC9, 0x5C,
+    0x3C, 0x13, 0xF9, 0xD5, 0x6F, 0xD2, 0x2E, 0xDA, 0xAC, 0xCB, 0xB7, 0xC3, 0x0E, 0xEB, 0x43, 0x60,
+    0x8F, 0x4B, 0xF8, 0x42, 0xC9, 0xD9, 0xFB, 0xB6, 0x2A, 0xE1, 0x86, 0x88, 0x91, 0x34, 0x83, 0xCA,
+    0x6B, 0xC2, 0xE3, 0x5B, 0x85, 0x93, 0x2D, 0x76, 0xC1, 0xF7, 0x11, 0xAF, 0x45, 0x4C, 0x3B, 0x7B,
+    0x89, 0x09, 0x0B, 0x9E, 0xB2, 0x26, 0xAF, 0x72, 0xCD, 0x42, 0xD3, 0x7B, 0x36, 0xF6, 0x07, 0xCF,
+    0x04, 0xFB, 0xAC, 0x38, 0x16, 0x53, 0xF6, 0x98, 0xD8, 0xFD, 0x6B, 0x6A, 0x92, 0xE7, 0x85, 0x78,
+    0xD3, 0xF3, 0x43, 0xCB, 0x2C, 0x3C, 0x4E, 0xE1, 0xB6, 0xF0, 0x12, 0x8B, 0x76, 0xA9, 0x9A, 0xE9,
+    0x8A, 0x34, 0x17, 0xAE, 0x63, 0x6D, 0xAE, 0xEA, 0x9A, 0x04, 0x75, 0x86, 0x10, 0x50, 0x86, 0x51,
+    0x4A, 0x0D, 0xD4, 0xCF, 0x87, 0x1D, 0x54, 0xC5, 0x87, 0xCE, 0xAD, 0x30, 0x96, 0x59, 0x75, 0x9E,
+    0xE0, 0xD6, 0xF6, 0xB4, 0x45, 0x7E, 0x63, 0xA9, 0xF6, 0xEC, 0x0D, 0x8D, 0x35, 0xD9, 0x51, 0xD8,
+    0x78, 0x54, 0xE4, 0x79, 0x4E, 0xBB, 0xD3, 0x09, 0x39, 0xED, 0xE0, 0x78, 0xC5, 0x51, 0x9E, 0xF7,
+    0x08, 0xA5, 0x48, 0x7B, 0x12, 0xFF, 0x04, 0x75, 0x7A, 0xC5, 0x59, 0x26, 0x9C, 0x64, 0xB6, 0x71,
+    0xA9, 0x70, 0xD2, 0x07, 0xF7, 0xC1, 0x42, 0x4A, 0x3E, 0xF1, 0x76, 0xDA, 0x6C, 0xD3, 0xA9, 0xEB,
+    0x09, 0x46, 0x11, 0x19, 0xEF, 0x2B, 0x51, 0xA6, 0x1A, 0xB7, 0xF3, 0x3A, 0x04, 0x86, 0x3B, 0x49,
+    0xC9, 0xE1, 0xD7, 0xB2, 0xBB, 0xA5, 0x7E, 0x38, 0xDA, 0xB9, 0x47, 0x38, 0xA0, 0x49, 0x53, 0xA7,
+    0xED, 0x23, 0xF9, 0xEA, 0x4C, 0x9B, 0x99, 0x4C, 0xC0, 0x77, 0x2A, 0x3A, 0xB4, 0xD4, 0x9D, 0x25,
+    0x67, 0x95, 0x4B, 0xFE, 0xD1, 0xDC, 0xD0, 0xBC, 0x89, 0xD2, 0xD1, 0xAE, 0x3F, 0xB8, 0x1F, 0x69,
+    0xF2, 0xAD, 0x4A, 0x9B, 0x77, 0xEE, 0x9C, 0x44, 0x7A, 0xFC, 0x9F, 0x70, 0x71, 0x9E, 0xF1, 0x0B,
+    0xAD, 0x54, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0xB6, 0x15, 0x4E, 0x62, 0x8B, 0xA5, 0x08, 0x12,
+    0x15, 0xD7, 0xD0, 0x40, 0x81, 0x7F, 0x20, 0x78, 0x2D, 0x28, 0x28, 0x28, 0xF8, 0x00, 0x1A, 0x2A,
+    0x0A, 0x9A, 0xB4, 0x14, 0x44, 0xB6, 0xA0, 0x4C, 0x91, 0x93, 0xF8, 0x81, 0x08, 0x09, 0x04, 0xD7,
+    0xD0, 0x50, 0x20, 0x44, 0xF0, 0x42, 0x0A, 0x0A, 0x8A, 0x58, 0xA2, 0x48, 0x41, 0x81, 0x11, 0x05,
+    0x12, 0x4D, 0x56, 0xC8, 0x42, 0x26, 0xEC, 0xDD, 0xF0, 0xF6, 0x0E, 0x02, 0x42, 0x3A, 0x71, 0xA7,
+    0x64, 0xED, 0xB5, 0x77, 0x77, 0x66, 0x67, 0xDE, 0xBC, 0x99, 0xDD, 0x73, 0xC3, 0x07, 0x22, 0x9F,
+    0x45, 0x72, 0x84, 0x56, 0xC9, 0x1D, 0x11, 0x14, 0x03, 0x78, 0x24, 0x0E, 0xDA, 0xC2, 0x60, 0xDE,
+    0x61, 0xAD, 0xC4, 0xA7, 0xE2, 0x6E, 0x0E, 0xEF, 0x8B, 0xBC, 0xA5, 0x91, 0x49, 0x4B, 0x9A, 0xC5,
+    0x8C, 0x58, 0x5C, 0xC7, 0xD9, 0x26, 0xFA, 0xB4, 0x5F, 0x25, 0xD2, 0xC6, 0xCF, 0xA7, 0x46, 0x94,
+    0x74, 0x34, 0xDC, 0xFB, 0xBE, 0xA8, 0x29, 0x0E, 0x47, 0x8C, 0xE8, 0x35, 0xC1, 0x6C, 0xE2, 0x46,
+    0x9D, 0xBC, 0xF9, 0x52, 0x29, 0x71, 0xC7, 0xBE, 0x4F, 0xAD, 0x22, 0xC3, 0x82, 0x51, 0x56, 0xF2,
+    0x44, 0x5C, 0x31, 0xD0, 0x96, 0x6B, 0x9E, 0x4B, 0xFF, 0x1B, 0x8C, 0x94, 0x8C, 0xE9, 0xFB, 0x3C,
+    0x1F, 0x0D, 0x65, 0x63, 0x87, 0x62, 0x53, 0x79, 0x2C, 0x47, 0x65, 0xDF, 0x16, 0xE8, 0xA6, 0x28,
+    0xBA, 0xC4, 0x69, 0x6B, 0xE0, 0x67, 0xFC, 0xFA, 0x70, 0xAA, 0xBC, 0x80, 0x36, 0xD9, 0xBF, 0x3C,
+    0x8A, 0x72, 0x0C, 0x18, 0x91, 0xC9, 0x95, 0x9D, 0xEE, 0x8D, 0x65, 0x5C, 0xC9, 0xAB, 0x71, 0xFE,
+    0x7F, 0x28, 0xBF, 0x06, 0x6D, 0x2A, 0x3F, 0xC4, 0x67, 0xE6, 0xDF, 0x56, 0x49, 0x99, 0xAE, 0x8A,
+    0x53, 0x75, 0x31, 0x88, 0x5B, 0x86, 0xBB, 0xC5, 0x2D, 0x69, 0xEE, 0xA1, 0x6A, 0x83, 0xC3, 0x2D,
+    0x8C, 0xA0, 0xDE, 0x8B, 0x8F, 0xBF, 0x91, 0x87, 0x2D, 0x22, 0x4E, 0x59, 0x66, 0x94, 0xA1, 0xE7,
+    0x10, 0x5D, 0xEB, 0x10, 0x89, 0x07, 0x0A, 0x32, 0xC1, 0xD0, 0x4E, 0x61, 0xA9, 0x6F, 0xD5, 0xAE,
+    0x4B, 0xBA, 0x0E, 0x6B, 0x38, 0x68, 0x9C, 0x18, 0xA4, 0x57, 0xAD, 0x7A, 0xE7, 0xE2, 0xD6, 0x63,
+    0x6B, 0xFE, 0x49, 0x4E, 0x2C, 0x84, 0x82, 0xE0, 0x98, 0x13, 0x6D, 0xE3, 0x55, 0x07, 0x71, 0x30,
+    0x0D, 0x70, 0xBC, 0x44, 0x3C, 0xA6, 0xEB, 0x16, 0xFD, 0xF5, 0x3A, 0x69, 0xD2, 0xFC, 0x29, 0x6E,
+    0xFF, 0xF6, 0x18, 0xD8, 0xF5, 0x53, 0x98, 0x47, 0xFD, 0x4B, 0xCB, 0xA5, 0x6B, 0x0E, 0xD5, 0x98,
+    0x25, 0x9D, 0x63, 0x29, 0x38, 0x3B, 0x0B, 0x48, 0x1E, 0x4B, 0xAD, 0x3E, 0xB9, 0x7E, 0xEE, 0x57,
+    0x58, 0x2A, 0x07, 0xC5, 0x69, 0x0E, 0xF1, 0x72, 0xFB, 0x4B, 0x3C, 0xF4, 0x90, 0x0E, 0x55, 0x8D,
+    0x17, 0x40, 0x7F, 0xC3, 0x92, 0x74, 0x8F, 0xC8, 0x87, 0x6A, 0x66, 0x9E, 0x74, 0x1D, 0xEA, 0x81,
+    0xA0, 0xC6, 0x04, 0x97, 0x96, 0xF0, 0x8A, 0x47, 0xF5, 0x35, 0x31, 0xFA, 0x82, 0x70, 0xF7, 0x98,
+    0x13, 0x91, 0x1A, 0xBA, 0xAB, 0x80, 0x71, 0xD2, 0x51, 0x47, 0xD7, 0x54, 0x2E, 0x02, 0x8D, 0x9E,
+    0x03, 0xDD, 0xD0, 0x4E, 0x41, 0x3B, 0x71, 0x30, 0xA8, 0x69, 0x19, 0x86, 0x2E, 0xA2, 0xD1, 0x9F,
+    0xCC, 0x31, 0xFF, 0x13, 0x20, 0xE8, 0xD5, 0xFC, 0x3C, 0x63, 0xD7, 0x61, 0x99, 0x15, 0xB0, 0xFC,
+    0x4B, 0x30, 0xBB, 0xC7, 0x5D, 0x06, 0xD5, 0x64, 0x24, 0x2C, 0x43, 0x85, 0x8C, 0x2E, 0x33, 0xE5,
+    0x90, 0xF5, 0x2D, 0x32, 0xC2, 0xCB, 0xC8, 0x9E, 0x11, 0xC6, 0xB1, 0xCE, 0x6C, 0x12, 0x5C, 0xC6,
+    0x53, 0x91, 0x11, 0x1B, 0xF5, 0x6D, 0x46, 0x68, 0x19, 0x92, 0x36, 0x63, 0xA8, 0x07, 0x50, 0x02,
+    0xFD, 0xBA, 0x24, 0x0B, 0x1C, 0x07, 0x86, 0x57, 0xD8, 0x4F, 0x04, 0xA2, 0xE2, 0xCE, 0x40, 0x39,
+    0x16, 0x0B, 0x4F, 0x5B, 0x01, 0x43, 0xF8, 0x86, 0xA4, 0x18, 0xDD, 0xC0, 0x98, 0x12, 0xA6, 0x62,
+    0x27, 0x0B, 0x66, 0x97, 0x7E, 0x2E, 0x76, 0xD4, 0xA7, 0x3C, 0xE8, 0x4D, 0xF4, 0x75, 0x63, 0xE8,
+    0xC7, 0x04, 0x3F, 0x8F, 0x59, 0x35, 0x8C, 0xD6, 0xE4, 0x5C, 0xA0, 0x17, 0x86, 0xD8, 0xFE, 0xE1,
+    0x21, 0xC5, 0x24, 0xF7, 0x81, 0x8E, 0x80, 0xC3, 0x1C, 0x72, 0x2A, 0xC3, 0xE1, 0x3D, 0x11, 0xD9,
+    0x10, 0x19, 0xE3, 0x51, 0xD2, 0xF5, 0x26, 0x37, 0xC5, 0x2D, 0x0A, 0x4E, 0x52, 0xBC, 0xE8, 0xF3,
+    0xE2, 0xC8, 0x0A, 0x7C, 0x7F, 0xF8, 0x98, 0xA8, 0xF6, 0x02, 0xAA, 0xBF, 0x48, 0xEF, 0x26, 0x6C,
+    0xC4, 0xCD, 0x84, 0xF2, 0x88, 0x18, 0xF5, 0xB6, 0xF3, 0x66, 0xF6, 0x87, 0x5B, 0xD2, 0x2B, 0xDB,
+    0x1F, 0xDD, 0xD3, 0x65, 0x42, 0xEB, 0x7D, 0xB0, 0x58, 0xE3, 0x8D, 0xB2, 0x63, 0xC1, 0x23, 0xAD,
+    0x29, 0x2C, 0x0F, 0x09, 0xED, 0x64, 0x74, 0x29, 0x78, 0xB9, 0xEB, 0x9C, 0x39, 0x9D, 0x7C, 0x25,
+    0x6F, 0x24, 0x76, 0xA1, 0xCF, 0x5C, 0x7C, 0x9D, 0x09, 0x87, 0xC5, 0x63, 0xA4, 0xAD, 0xB2, 0xF3,
+    0x80, 0x9A, 0x79, 0x69, 0x9F, 0x31, 0xE6, 0xEA, 0xCE, 0xBB, 0xAF, 0x6E, 0xD6, 0x7D, 0x8E, 0x23,
+    0x68, 0x3F, 0x01, 0xCD, 0x94, 0xBF, 0x8E, 0xD3, 0x40, 0x10, 0xC6, 0xC7, 0x6B, 0x5D, 0x2C, 0x6E,
+    0x8B, 0x2D, 0x78, 0x00, 0x77, 0x88, 0xCE, 0x2F, 0x00, 0xD8, 0x8F, 0x90, 0x0A, 0x8A, 0x2B, 0xA0,
+    0xA6, 0xC9, 0x13, 0x70, 0xB6, 0x44, 0x41, 0x9B, 0x86, 0x3E, 0x05, 0x55, 0x78, 0x05, 0x5F, 0x62,
+    0xDD, 0xBD, 0x80, 0x25, 0x44, 0x45, 0xB3, 0x1D, 0x12, 0x0D, 0x2E, 0x52, 0xF8, 0x24, 0xDB, 0x73,
+    0xDF, 0x67, 0x2E, 0x39, 0x88, 0x82, 0x04, 0xE8, 0xD0, 0xDD, 0x46, 0xF3, 0x65, 0xB5, 0x7F, 0xBC,
+    0x33, 0xBF, 0x9D, 0x1D, 0xD3, 0x88, 0x48, 0x07, 0x4B, 0x61, 0xAE, 0x12, 0x09, 0x0F, 0x0F, 0xD8,
+    0x4C, 0xD2, 0x97, 0x8D, 0x38, 0xF5, 0x12, 0x6A, 0x21, 0x46, 0x33, 0xFC, 0x63, 0x42, 0xB1, 0xE2,
+    0xE1, 0xC1, 0x2D, 0xBA, 0x5C, 0xCE, 0x53, 0xD5, 0xD6, 0xA9, 0x0E, 0x32, 0x95, 0xB8, 0x08, 0xDA,
+    0x43, 0x92, 0xC5, 0x67, 0x81, 0xFA, 0x78, 0x63, 0x5B, 0x7C, 0x37, 0x69, 0x7F, 0xB3, 0x4E, 0xC4,
+    0x7C, 0xC0, 0x37, 0x2D, 0x3F, 0xEC, 0x6A, 0x1E, 0x95, 0x41, 0xDE, 0xC0, 0x64, 0x23, 0x3F, 0xB5,
+    0x15, 0xAC, 0x84, 0x7F, 0x90, 0x8A, 0xD2, 0x50, 0xB0, 0xA2, 0xEC, 0xE1, 0x5F, 0xD9, 0xAD, 0x29,
+    0xD8, 0x5A, 0x76, 0x71, 0x05, 0xB1, 0x1E, 0x12, 0x6E, 0x20, 0x41, 0x07, 0x91, 0x81, 0x92, 0x66,
+    0x90, 0xA4, 0x82, 0x38, 0x0F, 0x09, 0x1B, 0x88, 0xE9, 0x20, 0xD2, 0x53, 0x72, 0x4A, 0xD2, 0x41,
+    0x1C, 0x25, 0xA2, 0x18, 0xD8, 0x31, 0x0E, 0x4D, 0x61, 0xF9, 0x0F, 0x16, 0x44, 0x10, 0x15, 0x3B,
+    0xBF, 0x9E, 0x58, 0x2D, 0x9E, 0xE6, 0xBA, 0x49, 0x2F, 0x5F, 0x74, 0x69, 0x2D, 0x03, 0x56, 0x9E,
+    0x82, 0x56, 0xFA, 0xB7, 0x76, 0x77, 0xF1, 0xDD, 0xB4, 0x67, 0xB2, 0x45, 0x5F, 0x6E, 0xF9, 0x07,
+    0xBC, 0x17, 0xC9, 0x6E, 0x37, 0xD6, 0xDD, 0x81, 0x06, 0x47, 0x18, 0x9C, 0x10, 0x7A, 0xF8, 0x83,
+    0xB0, 0x91, 0x8B, 0x72, 0x84, 0xF1, 0x85, 0x3C, 0xA6, 0x23, 0xAD, 0x48, 0xFC, 0x0E, 0x53, 0xF6,
+    0x3B, 0xE6, 0x0C, 0x93, 0x52, 0xFA, 0xFB, 0x90, 0x13, 0x26, 0x0B, 0xE6, 0xA6, 0xB1, 0xB5, 0x74,
+    0x09, 0x1E, 0x0F, 0x5C, 0x72, 0xF0, 0x34, 0xF2, 0xB7, 0x9E, 0x13, 0x70, 0xFB, 0xFA, 0x65, 0x98,
+    0xF1, 0x2D, 0x8C, 0x97, 0x35, 0xD2, 0x8B, 0x79, 0x23, 0xF6, 0xDC, 0xE7, 0xBD, 0xF1, 0x9D, 0xAA,
+    0x9F, 0xA6, 0xFD, 0xF3, 0x9E, 0x6E, 0x24, 0x55, 0xC8, 0x28, 0x10, 0x9C, 0x30, 0x38, 0x49, 0xF8,
+    0x6C, 0x6D, 0x85, 0x11, 0x70, 0x26, 0x15, 0xEE, 0xFF, 0xB3, 0xC1, 0x83, 0x74, 0xDB, 0x3D, 0xBA,
+    0xC5, 0x8E, 0x6E, 0x43, 0xBA, 0x2D, 0x99, 0x8E, 0x74, 0xD7, 0x23, 0xDD, 0x82, 0x60, 0x49, 0x37,
+    0x22, 0xD8, 0xB0, 0x25, 0xCE, 0x6E, 0x07, 0x36, 0xDD, 0x07, 0xDB, 0x6D, 0x83, 0x2C, 0xB7, 0xE1,
+    0xA2, 0x46, 0xC8, 0xD1, 0x09, 0xA2, 0xB7, 0xCA, 0x44, 0x50, 0xC6, 0x3D, 0xDD, 0x42, 0x9E, 0xEF,
+    0x41, 0xCE, 0xFF, 0x31, 0x19, 0xF7, 0xED, 0x54, 0xE4, 0x51, 0x4F, 0xF7, 0x60, 0x5E, 0x8E, 0x97,
+    0x4B, 0x16, 0x3D, 0xC6, 0x6F, 0x55, 0xE5, 0x97, 0x36, 0xD3, 0x39, 0x62, 0x51, 0xAD, 0x25, 0x19,
+    0x4E, 0xB4, 0x88, 0x5A, 0x31, 0x3D, 0xD9, 0x47, 0x4D, 0x02, 0x66, 0xC9, 0xDB, 0xB1, 0x7E, 0xB2,
+    0x70, 0xB8, 0x2F, 0x4C, 0x8F, 0x15, 0xD3, 0x37, 0xD2, 0xB1, 0xCC, 0x31, 0xBA, 0x90, 0x64, 0xC7,
+    0x0C, 0x42, 0x97, 0xA3, 0x39, 0xA1, 0xDB, 0xAF, 0xDC, 0xD6, 0x8F, 0x35, 0xF7, 0x02, 0xF1, 0x9B,
+    0x36, 0xAE, 0x59, 0x7E, 0xD6, 0x85, 0xC4, 0xDE, 0xE8, 0xFB, 0x59, 0x4B, 0x47, 0x06, 0xBA, 0x33,
+    0xC8, 0x35, 0x8F, 0xD7, 0xCB, 0x05, 0x4A, 0x38, 0xBC, 0x5B, 0x6B, 0x73, 0xE3, 0x9E, 0xC1, 0x7D,
+    0x05, 0x8A, 0x27, 0x91, 0x7E, 0xCE, 0x6B, 0xE7, 0x25, 0x47, 0xE6, 0x9B, 0x16, 0x49, 0xEB, 0x2E,
+    0xB0, 0xAA, 0xC3, 0x09, 0xEE, 0x13, 0x3A, 0x67, 0xE8, 0x58, 0x76, 0x78, 0xA6, 0x3B, 0x07, 0x6D,
+    0xDE, 0x69, 0x52, 0x0C, 0x88, 0x23, 0xBC, 0x9C, 0xF4, 0x12, 0x2B, 0xC0, 0x27, 0xCC, 0x05, 0xBE,
+    0xCE, 0x07, 0x32, 0x81, 0x36, 0x42, 0x20, 0xDF, 0xE8, 0x70, 0xCA, 0x19, 0x99, 0xCD, 0xEF, 0x29,
+    0x9B, 0x85, 0xBC, 0x12, 0x87, 0x9F, 0xAC, 0x3E, 0xFA, 0x11, 0x89, 0x4C, 0x2E, 0xE5, 0x7F, 0x43,
+    0xBA, 0xF3, 0x76, 0x05, 0xC5, 0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0xFE, 0x6C, 0x2B, 0x67, 0xE9,
+    0x5C, 0x2C, 0x05, 0x29, 0x20, 0x12, 0xEE, 0x23, 0x24, 0xB7, 0x14, 0x5C, 0x6C, 0x89, 0x1F, 0x00,
+    0x05, 0x84, 0xF2, 0x1A, 0x1A, 0x94, 0xE2, 0xFD, 0x01, 0x72, 0x36, 0xFC, 0x82, 0x6B, 0x90, 0x28,
+    0x29, 0x52, 0x9C, 0x1E, 0x6D, 0x0A, 0x8A, 0xDC, 0xD9, 0xE8, 0x8A, 0x94, 0x58, 0x50, 0x50, 0x62,
+    0x09, 0x5D, 0x43, 0x13, 0x4B, 0x79, 0x52, 0xFC, 0xC4, 0xDA, 0xC3, 0xF7, 0xED, 0x7B, 0x24, 0x47,
+    0x45, 0x91, 0xE8, 0xF0, 0xDD, 0xAE, 0xF7, 0xED, 0xCE, 0x7C, 0xF3, 0xCD, 0xCC, 0xCE, 0x18, 0x38,
+    0x3B, 0x6C, 0x80, 0xE2, 0x9B, 0x09, 0x48, 0xC6, 0x1A, 0xC0, 0x13, 0xD7, 0x01, 0x79, 0x34, 0x02,
+    0x71, 0xF7, 0x01, 0xFE, 0xF5, 0x1C, 0xD8, 0x16, 0x48, 0xCD, 0x66, 0xC4, 0x76, 0xD5, 0x4E, 0xA8,
+    0x1B, 0x14, 0xBD, 0x1B, 0x80, 0x3A, 0xF6, 0x14, 0x9F, 0x4A, 0xCA, 0xB8, 0xA7, 0xD4, 0xC4, 0x7C,
+    0xC1, 0x29, 0x7B, 0xD6, 0x73, 0xAE, 0x67, 0x4E, 0x89, 0x11, 0x14, 0xA5, 0x0F, 0x4B, 0xED, 0x96,
+    0xDA, 0x4D, 0xFF, 0xA2, 0x2E, 0x2E, 0x64, 0xD5, 0xFD, 0x2A, 0x35, 0x5F, 0x8A, 0xCB, 0xD7, 0x3C,
+    0x4B, 0xC7, 0x6C, 0x42, 0xB4, 0xA0, 0xD8, 0xDE, 0xB7, 0x06, 0xAD, 0x19, 0x25, 0x5B, 0x4D, 0xB8,
+    0x25, 0x26, 0x87, 0xCD, 0x19, 0xED, 0x15, 0x0D, 0xCA, 0x64, 0x44, 0xD6, 0x79, 0x44, 0x63, 0x0E,
+    0xBC, 0x9F, 0x34, 0xD7, 0xD8, 0x16, 0x54, 0xCC, 0xCD, 0xAA, 0x64, 0xFE, 0x7C, 0xC6, 0x42, 0xC4,
+    0xBC, 0xA3, 0x9F, 0x1B, 0x59, 0xA1, 0xBD, 0x4B, 0xDA, 0x9B, 0xB9, 0xC8, 0x64, 0xF8, 0xBC, 0xDC,
+    0x33, 0xF0, 0x45, 0x05, 0xF7, 0x93, 0x27, 0x36, 0xDD, 0xAA, 0x51, 0x9E, 0xAE, 0xFA, 0xC8, 0x6C,
+    0x43, 0x7F, 0x19, 0x1F, 0x7C, 0xF2, 0x0A, 0x9C, 0xC0, 0xE4, 0x94, 0x6A, 0xB6, 0xAE, 0xDD, 0x3E,
+    0xE0, 0x8B, 0x84, 0x33, 0xBA, 0x46, 0x17, 0x08, 0xA2, 0x80, 0x9C, 0x13, 0xB4, 0x43, 0x4C, 0x8B,
+    0xF4, 0x90, 0x47, 0x31, 0x31, 0x84, 0xDF, 0x87, 0x23, 0x9A, 0x8C, 0x97, 0xF5, 0x19, 0xE5, 0x32,
+    0xB3, 0x17, 0xA3, 0xF8, 0xDA, 0xEF, 0xDD, 0xEE, 0xA8, 0x0A, 0x5A, 0x17, 0x41, 0x2B, 0xF2, 0x41,
+    0x2B, 0x19, 0x77, 0x80, 0x43, 0x38, 0xCA, 0xFB, 0x60, 0xAB, 0x18, 0x74, 0x14, 0x82, 0xB4, 0x5E,
+    0x37, 0x45, 0x60, 0x23, 0x38, 0x33, 0x2A, 0x7D, 0x76, 0x3D, 0x75, 0x99, 0xF5, 0x31, 0xC3, 0x97,
+    0xDB, 0x92, 0x30, 0x24, 0xEE, 0x6A, 0xF5, 0xC7, 0xF6, 0xCE, 0x48, 0x26, 0xED, 0x06, 0x75, 0x3A,
+    0xC0, 0x4D, 0x70, 0xBF, 0xD0, 0xCD, 0x19, 0xD1, 0xE4, 0x03, 0xDF, 0x13, 0x85, 0xE4, 0xCF, 0x75,
+    0xFB, 0x73, 0xC7, 0x8C, 0x99, 0x3D, 0xA7, 0xF9, 0x65, 0x1D, 0xE8, 0x2A, 0xCB, 0x1C, 0x8C, 0xA6,
+    0x5C, 0xC9, 0xC8, 0x26, 0x9A, 0x28, 0xA3, 0xDD, 0x4A, 0x36, 0x90, 0x6C, 0x0F, 0xBC, 0x55, 0x2B,
+    0xD4, 0xE6, 0x1D, 0xA3, 0xA3, 0xD8, 0xD5, 0x76, 0x8A, 0x88, 0x4C, 0x3F, 0xA5, 0xD4, 0x5D, 0xA5,
+    0x9B, 0x70, 0x72, 0x2C, 0x80, 0x65, 0x44, 0x8A, 0x86, 0x6B, 0x64, 0x5B, 0x7B, 0x04, 0x6A, 0x4E,
+    0xA0, 0xE1, 0x91, 0x21, 0x6C, 0x1B, 0x26, 0xD8, 0x73, 0xE1, 0x7A, 0x85, 0x95, 0x8B, 0x4C, 0x8B,
+    0x59, 0x3B, 0xCC, 0x7D, 0x32, 0xB9, 0xAB, 0xFB, 0x8B, 0x84, 0x2B, 0xD9, 0xC3, 0xCC, 0x3F, 0xD7,
+    0xA5, 0x23, 0x3C, 0x8A, 0xC6, 0xE9, 0xB7, 0x67, 0xF6, 0xB9, 0x28, 0xAB, 0x3D, 0x4E, 0x36, 0xC8,
+    0x8F, 0x8F, 0x3B, 0xA5, 0x29, 0x7A, 0x84, 0x64, 0xA3, 0xB8, 0xE6, 0x0D, 0xEE, 0x01, 0x3F, 0xEE,
+    0x39, 0x7C, 0x98, 0xF9, 0xA3, 0xD2, 0x1F, 0x5D, 0x7C, 0x57, 0x8E, 0x28, 0xA5, 0x2A, 0xAA, 0xFF,
+    0xF9, 0x7F, 0xA3, 0xCC, 0x5F, 0x3E, 0xBA, 0x1B, 0xE2, 0x8E, 0x54, 0x55, 0x26, 0x0F, 0x9C, 0xB6,
+    0xAB, 0xD7, 0x70, 0x64, 0x5F, 0x42, 0x41, 0xF8, 0x08, 0xF8, 0x0A, 0x78, 0x1C, 0xEE, 0xFF, 0x21,
+    0xE2, 0x06, 0x4F, 0x22, 0x5E, 0x95, 0x8D, 0x6E, 0xE3, 0x33, 0x16, 0x5C, 0x39, 0xEC, 0x73, 0xF9,
+    0x7F, 0xA4, 0xEF, 0x0B, 0xBC, 0x73, 0x8F, 0x2D, 0xEB, 0x72, 0x4C, 0xAD, 0x8B, 0xAC, 0x52, 0xCD,
+    0xBC, 0x96, 0xD7, 0xA1, 0x19, 0x76, 0xA1, 0x02, 0xA0, 0x9E, 0xC6, 0xC8, 0x26, 0xDD, 0x2B, 0xD7,
+    0x56, 0x76, 0xCA, 0x6A, 0xF0, 0x6E, 0xF9, 0x61, 0xE2, 0xFD, 0x7F, 0x9B, 0xB0, 0xFF, 0x94, 0x83,
+    0x4C, 0x04, 0x4D, 0xB7, 0x51, 0x8F, 0x24, 0x8C, 0x9A, 0x65, 0xAE, 0x45, 0x4B, 0x90, 0x54, 0x01,
+    0x52, 0xCF, 0x13, 0xC1, 0x93, 0xFD, 0x38, 0x7F, 0x8B, 0xFE, 0xD4, 0xDF, 0x1E, 0x6F, 0x6A, 0xB3,
+    0xBE, 0xB0, 0x05, 0xB8, 0xAD, 0x9C, 0x7D, 0x19, 0x0A, 0x2B, 0x99, 0x82, 0x90, 0x6B, 0x10, 0xBF,
+    0xAC, 0x8D, 0xC8, 0x14, 0x27, 0x5F, 0xF6, 0xC7, 0x1F, 0x8D, 0xE1, 0x54, 0x99, 0x2F, 0xD9, 0x08,
+    0xD8, 0x53, 0x55, 0x7A, 0x1A, 0x11, 0x4D, 0x2A, 0x1D, 0xEA, 0x0F, 0x0F, 0xF9, 0xFA, 0xAD, 0x3F,
+    0xF0, 0xC4, 0x8F, 0x8D, 0xFB, 0xB7, 0x89, 0x11, 0x7F, 0xCF, 0x4D, 0x75, 0xA2, 0x59, 0x45, 0x5E,
+    0x45, 0x53, 0xD6, 0x27, 0xBD, 0xDA, 0xFD, 0x0D, 0xBA, 0xF8, 0x2E, 0xFB, 0x19, 0xA5, 0x8D, 0xB9,
+    0x39, 0xEE, 0xB2, 0xEE, 0x84, 0xD5, 0xFF, 0xF8, 0x0D, 0xBA, 0x78, 0x13, 0x6E, 0xDC, 0x69, 0x76,
+    0x55, 0x96, 0x0F, 0xA1, 0xFF, 0xF1, 0xBB, 0xC9, 0xC1, 0x37, 0x1B, 0x2A, 0x2F, 0xFC, 0xFE, 0x1B,
+    0x31, 0xF0, 0x42, 0x5F, 0xCE, 0xB7, 0x36, 0xB4, 0xCA, 0x26, 0x2B, 0xE3, 0x09, 0x91, 0x1D, 0x47,
+    0xB1, 0xEC, 0x46, 0x3E, 0xED, 0x3A, 0x29, 0x8B, 0x29, 0xD5, 0x77, 0xE1, 0x21, 0x56, 0x4F, 0x59,
+    0x35, 0x05, 0xAB, 0x47, 0x39, 0x79, 0x6F, 0xA7, 0xA1, 0x6B, 0xE8, 0x2A, 0xED, 0xE4, 0x0B, 0x74,
+    0xCD, 0xDF, 0xD8, 0xF3, 0x37, 0xC5, 0x55, 0xB1, 0x8E, 0xD3, 0x40, 0x10, 0x7D, 0xBB, 0xAB, 0x4B,
+    0x90, 0x5C, 0x98, 0xE2, 0x22, 0x84, 0x4E, 0x60, 0x6A, 0xAE, 0xF0, 0x0F, 0xA0, 0xB3, 0x11, 0x3F,
+    0x40, 0x01, 0xB4, 0xA1, 0xA0, 0xA2, 0xE0, 0x1A, 0x8A, 0x6B, 0x20, 0x96, 0xF8, 0x81, 0x34, 0xD7,
+    0xA7, 0xA0, 0x40, 0xA1, 0xE0, 0x8A, 0x2B, 0xC9, 0xC5, 0x1D, 0x05, 0x8D, 0x1B, 0x44, 0x89, 0x0B,
+    0x2A, 0x68, 0x96, 0x93, 0x11, 0x4E, 0xE4, 0x64, 0x78, 0x6B, 0x27, 0x04, 0x01, 0x8A, 0x4E, 0xE2,
+    0xA2, 0xDB, 0xF8, 0x25, 0xF1, 0x68, 0x3D, 0x33, 0xEF, 0xCD, 0xEC, 0x58, 0x27, 0x18, 0xE8, 0xA2,
+    0x9D, 0x63, 0x14, 0x24, 0x08, 0x4F, 0x00, 0xBF, 0x02, 0x8C, 0xC5, 0xAF, 0xB5, 0x2F, 0x7D, 0x23,
+    0x52, 0xF9, 0xF3, 0xD7, 0x65, 0x90, 0x62, 0x3B, 0x8A, 0x81, 0x08, 0x0B, 0xF0, 0x7F, 0x98, 0xF2,
+    0x91, 0x02, 0x68, 0x4B, 0x02, 0xC8, 0x04, 0x08, 0xDC, 0x9F, 0x31, 0x1D, 0xB4, 0xE9, 0x08, 0x33,
+    0x82, 0x4E, 0xF1, 0x7C, 0x81, 0xD1, 0x65, 0xA8, 0xAA, 0x77, 0xD8, 0x2D, 0x7A, 0x22, 0x59, 0x28,
+    0x73, 0xA0, 0x13, 0xE3, 0x2A, 0x5A, 0x71, 0xA9, 0xAD, 0xB1, 0x15, 0x9F, 0x06, 0x7A, 0x19, 0x74,
+    0xB9, 0x0C, 0xAF, 0xB8, 0x87, 0xE1, 0xA3, 0xAC, 0x7B, 0xC7, 0xD6, 0x2E, 0x5C, 0x6E, 0x51, 0xC6,
+    0x58, 0xDC, 0x25, 0x79, 0x0D, 0xC5, 0x90, 0x8A, 0xD1, 0x3C, 0x9A, 0x9F, 0xF1, 0xE7, 0x63, 0xD6,
+    0xAA, 0xE8, 0x5F, 0x0B, 0xED, 0x1D, 0x26, 0x23, 0x22, 0xA7, 0x84, 0xBC, 0x77, 0x5F, 0x4D, 0xEA,
+    0x70, 0xC9, 0xD5, 0x34, 0xFD, 0x14, 0x1B, 0x30, 0x1D, 0x3B, 0x93, 0xBB, 0x0B, 0x73, 0x34, 0x89,
+    0xC1, 0xA7, 0x2E, 0xD8, 0x23, 0x84, 0x5B, 0x0D, 0x99, 0xC3, 0xBA, 0x4B, 0x59, 0xF7, 0x6C, 0x20,
+    0xCC, 0xB8, 0xBA, 0xF2, 0xFD, 0x9E, 0xA9, 0x6F, 0xD7, 0x5D, 0x05, 0x34, 0x55, 0x95, 0x19, 0xC2,
+    0x19, 0xBC, 0x18, 0x3E, 0x63, 0x50, 0x0A, 0x96, 0xA0, 0xBE, 0xE8, 0x9C, 0xAC, 0xFB, 0x78, 0xC4,
+    0xBD, 0x0C, 0x6B, 0xEC, 0x88, 0xC1, 0xA8, 0x55, 0x13, 0xB1, 0x9D, 0xAF, 0x0A, 0x7B, 0x21, 0xBA,
+    0x60, 0x7B, 0xD1, 0x08, 0x6F, 0x89, 0x92, 0xF4, 0xF9, 0x51, 0xB9, 0xB2, 0xCD, 0x46, 0xAA, 0x00,
+    0xCA, 0x00, 0xEA, 0x50, 0xDF, 0x9F, 0x19, 0xA4, 0xEE, 0x44, 0x71, 0xAA, 0x38, 0x59, 0xA0, 0xE2,
+    0xBF, 0xD8, 0xB9, 0xA0, 0xAA, 0x5C, 0x6A, 0x10, 0x24, 0xF8, 0xC3, 0xD4, 0xE9, 0x7E, 0x88, 0xD9,
+    0x69, 0x92, 0xB0, 0xDB, 0x29, 0x55, 0xDB, 0xFE, 0x73, 0xD7, 0x5A, 0xD3, 0xDA, 0x7A, 0xEE, 0x4E,
+    0x5F, 0x46, 0x52, 0xED, 0x4E, 0x5F, 0xAD, 0xAB, 0x27, 0xF3, 0xDE, 0xC2, 0x25, 0x36, 0x75, 0x72,
+    0x44, 0x17, 0x5F, 0x53, 0x1C, 0xD3, 0xA8, 0x13, 0x2F, 0x59, 0x55, 0xCD, 0xC9, 0x38, 0xA2, 0xB2,
+    0xFA, 0x07, 0xC3, 0x79, 0x9F, 0xA8, 0x6C, 0xD8, 0xFB, 0x5F, 0x93, 0x39, 0x25, 0x19, 0xFF, 0x1D,
+    0xED, 0x27, 0xBE, 0x85, 0x67, 0xFD, 0xC9, 0x03, 0x89, 0x7D, 0x91, 0x82, 0xC7, 0xDA, 0xB5, 0x4D,
+    0xA7, 0x2E, 0xDC, 0x0D, 0x9E, 0xB3, 0x23, 0x23, 0x53, 0xEB, 0xDD, 0x96, 0xCC, 0xC3, 0xCD, 0x78,
+    0x99, 0x12, 0xB9, 0xEF, 0x11, 0xD1, 0x19, 0xD1, 0x23, 0xC6, 0xA4, 0x21, 0x51, 0xAC, 0x25, 0xCC,
+    0x77, 0x84, 0x91, 0x22, 0x2D, 0x65, 0x48, 0xEE, 0xC0, 0xE3, 0xE1, 0x80, 0x0D, 0x2B, 0x29, 0x3C,
+    0x57, 0xB5, 0xE5, 0x32, 0xE7, 0x47, 0x76, 0x65, 0x8A, 0x42, 0xEA, 0x5A, 0xD1, 0xEE, 0xE5, 0x0C,
+    0x35, 0x86, 0x1C, 0xEE, 0x17, 0xAE, 0x05, 0x62, 0x36, 0x21, 0x0B, 0xAB, 0xEE, 0x12, 0xC3, 0x61,
+    0xC2, 0x39, 0x92, 0x3A, 0x6C, 0x84, 0xEE, 0x00, 0x0F, 0x39, 0x28, 0x38, 0x2A, 0xDA, 0x5F, 0x38,
+    0x27, 0x3D, 0x37, 0x1B, 0x5A, 0x13, 0x5C, 0x78, 0xB9, 0x75, 0xA2, 0xFA, 0x3A, 0x33, 0xA9, 0x9A,
+    0xBE, 0x49, 0x79, 0x94, 0x80, 0x9D, 0xCF, 0xD8, 0x08, 0xFF, 0x7A, 0x05, 0xEE, 0x2C, 0x4D, 0xDC,
+    0x5B, 0x24, 0x66, 0x52, 0xD7, 0xDC, 0xE0, 0x3C, 0xB8, 0xBE, 0x98, 0x94, 0x78, 0xF2, 0x9B, 0x1A,
+    0xFE, 0x39, 0x77, 0x40, 0x6D, 0xAA, 0x28, 0xBC, 0xF9, 0x46, 0x7B, 0xF8, 0xA2, 0x82, 0xAE, 0xCC,
+    0xFC, 0xFE, 0x38, 0x63, 0x07, 0xF2, 0x34, 0xBA, 0x17, 0x08, 0xB6, 0x96, 0x7D, 0xEE, 0x97, 0x0D,
+    0xF1, 0x03, 0x8E, 0xDC, 0xA7, 0xC4, 0xAD, 0xA0, 0x19, 0x36, 0xAD, 0x7C, 0x83, 0xD2, 0x6C, 0x7A,
+    0xFD, 0x04, 0xBD, 0x54, 0x3D, 0x8F, 0x14, 0x47, 0x10, 0x7D, 0xD3, 0x0D, 0x6A, 0x71, 0x13, 0x74,
+    0x44, 0x62, 0x4B, 0x9E, 0x9F, 0xD0, 0xBF, 0x80, 0xED, 0xCD, 0x09, 0x20, 0x60, 0x49, 0x08, 0x1C,
+    0x13, 0x91, 0x3A, 0xE0, 0x76, 0xFB, 0x27, 0xF0, 0x0F, 0x4C, 0xE0, 0x00, 0x2D, 0x01, 0x0E, 0x1D,
+    0xB0, 0x37, 0x03, 0x17, 0x38, 0x20, 0x60, 0x24, 0x02, 0x02, 0x02, 0x8F, 0x05, 0x08, 0x44, 0xC2,
+    0xD8, 0x9A, 0x13, 0x83, 0x98, 0xDD, 0xE6, 0x55, 0xCF, 0x2E, 0xA7, 0xC3, 0x16, 0x9C, 0x64, 0x8B,
+    0x91, 0x6A, 0x3E, 0xAA, 0xBA, 0xAB, 0xDE, 0xAB, 0x7A, 0x3D, 0xD8, 0x0B, 0x77, 0x80, 0x45, 0xDE,
+    0x40, 0xB7, 0x1E, 0x70, 0xAA, 0x05, 0xBA, 0x02, 0xC8, 0xA7, 0xBF, 0xE2, 0xF8, 0x1A, 0x00, 0xF5,
+    0x8E, 0x91, 0xFC, 0x8F, 0x8A, 0x6B, 0x16, 0xF4, 0xAC, 0xFE, 0xB3, 0xCB, 0x3E, 0x6A, 0x00, 0x5F,
+    0x54, 0x50, 0xBD, 0xAF, 0xE0, 0x2A, 0xFF, 0xF2, 0xDA, 0x1A, 0x3E, 0xC6, 0x1A, 0x45, 0xEC, 0xB9,
+    0xF0, 0x0A, 0xED, 0x3B, 0x75, 0x1B, 0x0B, 0xD3, 0x62, 0xB0, 0x55, 0xD6, 0x39, 0xE8, 0xFA, 0xC2,
+    0x09, 0x60, 0x73, 0x60, 0x42, 0xF3, 0xA7, 0xB4, 0x05, 0xAD, 0x24, 0xC9, 0xE8, 0xA7, 0x2A, 0xBA,
+    0xE6, 0xFB, 0x68, 0x63, 0xF4, 0x2A, 0xF6, 0x0E, 0x67, 0xBF, 0x3D, 0xC5, 0x35, 0x17, 0x5E, 0x65,
+    0x18, 0x56, 0x98, 0xFC, 0x46, 0xD3, 0xE9, 0x2B, 0xF0, 0xE6, 0x5E, 0xF0, 0xE6, 0xE5, 0xF3, 0x6C,
+    0xE2, 0x58, 0x04, 0xD8, 0xDF, 0x39, 0xA1, 0xBF, 0xD8, 0x97, 0x41, 0xC8, 0x7C, 0xC9, 0x91, 0x89,
+    0xA3, 0xB4, 0x15, 0xFC, 0x61, 0x07, 0xD7, 0x96, 0xE1, 0xC6, 0x20, 0x3C, 0x51, 0x6E, 0xE8, 0xBB,
+    0x9C, 0x33, 0xBF, 0x21, 0x50, 0x4D, 0xCB, 0x08, 0x11, 0x37, 0xA5, 0xE8, 0x6B, 0x02, 0x8E, 0xA9,
+    0x1C, 0xAF, 0xBD, 0x30, 0x76, 0xB7, 0x1C, 0x9F, 0x79, 0x9C, 0x8E, 0xCD, 0xF6, 0xE9, 0x69, 0x1A,
+    0x97, 0x9E, 0x17, 0x50, 0xE0, 0x1F, 0x17, 0x2B, 0xB3, 0x88, 0x3A, 0x62, 0x03, 0xCA, 0x29, 0xEC,
+    0x61, 0x0B, 0xBD, 0x21, 0xBA, 0xBC, 0x86, 0x1D, 0x90, 0xF5, 0x44, 0x39, 0x6F, 0x91, 0xD7, 0x9E,
+    0xED, 0x69, 0xE0, 0xD9, 0x73, 0xFB, 0xB8, 0xC2, 0xA0, 0x3A, 0xCC, 0x1D, 0x13, 0x9B, 0x46, 0xB5,
+    0xFB, 0x70, 0x53, 0x5B, 0xD9, 0xAA, 0x67, 0xD0, 0x63, 0xA2, 0x5B, 0xDD, 0x62, 0x95, 0x75, 0x79,
+    0x5D, 0x84, 0xAC, 0x67, 0x20, 0xAC, 0x92, 0x50, 0x3D, 0xDD, 0xF6, 0x41, 0x87, 0xFB, 0x2C, 0xE7,
+    0x2E, 0x56, 0x59, 0xBF, 0x2F, 0x00, 0xA1, 0xFF, 0x26, 0xA5, 0xA1, 0x47, 0xCE, 0xB4, 0xFA, 0x1D,
+    0xDB, 0x4C, 0x40, 0xE6, 0x2D, 0x3B, 0xD8, 0x41, 0x10, 0x20, 0x92, 0xB5, 0xAF, 0x47, 0xAE, 0x25,
+    0x9B, 0xC0, 0xF6, 0x65, 0x74, 0xDB, 0x9A, 0xDF, 0xD9, 0x2F, 0x89, 0x02, 0x07, 0x25, 0x1D, 0x91,
+    0x15, 0xD0, 0x42, 0x84, 0xF3, 0xD4, 0xD2, 0xA8, 0x1F, 0x28, 0xBD, 0x93, 0x6C, 0xF7, 0xA1, 0x06,
+    0x98, 0x57, 0xAD, 0xEC, 0x59, 0xB1, 0xF8, 0x1A, 0xF6, 0x61, 0x87, 0x92, 0x72, 0x2D, 0x82, 0xBD,
+    0x87, 0x22, 0x0C, 0x38, 0xEA, 0x54, 0x67, 0xAB, 0xC2, 0x06, 0x2F, 0x59, 0x06, 0xDD, 0x9A, 0x66,
+    0x62, 0xEA, 0x7D, 0x78, 0x53, 0x4F, 0xF2, 0x4A, 0xB7, 0xF7, 0xE9, 0x84, 0xBB, 0x14, 0x1C, 0xE7,
+    0xFE, 0xBE, 0xE3, 0x72, 0xD8, 0xB7, 0xE0, 0x5E, 0x1C, 0x34, 0x92, 0xC8, 0xAC, 0x61, 0x36, 0x09,
+    0x13, 0x51, 0x13, 0xAD, 0x12, 0x3C, 0x77, 0x04, 0x9F, 0x9C, 0x90, 0x92, 0xAC, 0xCC, 0x73, 0xDE,
+    0xE6, 0x3C, 0xB5, 0xBA, 0xCE, 0x9A, 0x63, 0x68, 0x2B, 0xF2, 0x79, 0x2F, 0xCC, 0xA8, 0x01, 0x1C,
+    0x10, 0xBF, 0x6E, 0x79, 0xC4, 0x5D, 0x60, 0xBB, 0x58, 0x2F, 0x70, 0x20, 0xEC, 0xA1, 0x44, 0x18,
+    0x1E, 0x28, 0xD0, 0xAC, 0xA7, 0x1E, 0xF5, 0x07, 0x66, 0x30, 0x71, 0x97, 0xBE, 0x90, 0x4E, 0xF8,
+    0xED, 0xF1, 0x47, 0xEA, 0x81, 0xFD, 0x82, 0x8B, 0x47, 0x15, 0x6A, 0x23, 0x42, 0xAA, 0x53, 0xBA,
+    0xAC, 0x67, 0x95, 0x2E, 0xE9, 0xEB, 0x13, 0xA6, 0xE2, 0xE7, 0x80, 0xFC, 0x89, 0xA0, 0x59, 0x41,
+    0xC6, 0x99, 0x5A, 0xEB, 0x29, 0x1B, 0x36, 0x8C, 0x43, 0x57, 0x1D, 0x3F, 0x27, 0x94, 0x83, 0xAD,
+    0x28, 0x97, 0x6E, 0xC2, 0xC4, 0x14, 0x9B, 0x0C, 0x13, 0x02, 0xCD, 0xB3, 0x9E, 0x91, 0xC2, 0xEB,
+    0x6D, 0x49, 0xEA, 0x89, 0x6A, 0x1A, 0x81, 0x90, 0x49, 0x76, 0x8D, 0xB0, 0x4B, 0x2E, 0x70, 0x9D,
+    0xD4, 0x3B, 0x03, 0xCE, 0x4B, 0x8A, 0xA4, 0x3F, 0x5B, 0x3E, 0xFD, 0xE9, 0x33, 0xB1, 0x8A, 0x8E,
+    0xE7, 0x0B, 0xD9, 0xCD, 0x7C, 0x8E, 0xC3, 0xA2, 0x12, 0x29, 0x9D, 0x26, 0x41, 0xCA, 0x9B, 0x04,
+    0x43, 0xE4, 0x15, 0x18, 0xF6, 0xFC, 0x09, 0x8D, 0x27, 0x60, 0x23, 0x9A, 0x11, 0x1D, 0x89, 0xB2,
+    0x61, 0xBE, 0xD6, 0x95, 0xCF, 0x5C, 0xD8, 0xBB, 0x45, 0x28, 0x23, 0xDC, 0x64, 0x99, 0x40, 0xED,
+    0x8E, 0x41, 0x2D, 0x62, 0x8C, 0x3F, 0xD2, 0x9E, 0xD2, 0xE8, 0x56, 0x5B, 0x85, 0x26, 0xCA, 0xA5,
+    0xC4, 0x25, 0x2F, 0x61, 0xB8, 0x6A, 0x1C, 0x90, 0x48, 0x57, 0xF2, 0x99, 0x6D, 0x4E, 0x51, 0xC8,
+    0xBF, 0x6F, 0x78, 0xB3, 0x5C, 0xDE, 0x65, 0xD2, 0x0D, 0x8D, 0x23, 0xBE, 0xCE, 0xED, 0x75, 0xDA,
+    0x21, 0x63, 0x99, 0x42, 0xD5, 0x3B, 0x04, 0xFC, 0x3F, 0x1D, 0xC6, 0x38, 0x9C, 0x9F, 0xDD, 0xA8,
+    0x52, 0xFC, 0x20, 0x15, 0x12, 0x0A, 0xAB, 0x4F, 0x6F, 0xEB, 0xD4, 0xFB, 0xED, 0x9B, 0x0B, 0x30,
+    0x47, 0xB3, 0x2B, 0x65, 0x8C, 0xCF, 0xA2, 0xFC, 0xD6, 0x6E, 0x6D, 0x59, 0x4B, 0xD5, 0xBC, 0x3A,
+    0xD1, 0xF2, 0x8C, 0xB5, 0xD7, 0x3B, 0x8A, 0x82, 0xBC, 0x39, 0x0D, 0xF2, 0x53, 0x51, 0x5D, 0x2E,
+    0x97, 0xF7, 0x98, 0xF4, 0x03, 0x6D, 0xC0, 0x39, 0x46, 0xB9, 0xC2, 0x87, 0xF1, 0x1F, 0xB7, 0xBB,
+    0x34, 0x63, 0xA4, 0xF7, 0x60, 0x76, 0x75, 0x48, 0xA9, 0x59, 0x5E, 0x12, 0xF8, 0xA4, 0xA2, 0xED,
+    0x9B, 0x15, 0xF5, 0xEE, 0xDE, 0xA4, 0xFD, 0x8B, 0xD9, 0xEC, 0x22, 0x51, 0x93, 0x5E, 0xAD, 0x02,
+    0x6E, 0xF3, 0xD4, 0xF7, 0x30, 0x7F, 0x32, 0x70, 0xC0, 0x0D, 0xF9, 0xAE, 0xFE, 0x37, 0x1E, 0xDF,
+    0xFF, 0x76, 0x7D, 0x04, 0x95, 0x55, 0x3D, 0x6C, 0xDB, 0x46, 0x14, 0xFE, 0x8E, 0x84, 0xCC, 0x24,
+    0x44, 0x7D, 0x05, 0x2A, 0xB5, 0x49, 0xDA, 0x58, 0x19, 0x32, 0x04, 0x85, 0x23, 0x76, 0xC8, 0xE0,
+    0x81, 0x12, 0x99, 0x7A, 0x0C, 0xD0, 0x0A, 0xA8, 0x35, 0xB7, 0x40, 0xB3, 0x34, 0x1D, 0x9C, 0x21,
+    0x83, 0x06, 0x4B, 0x64, 0x90, 0xA1, 0x5B, 0x6B, 0xA0, 0x40, 0x67, 0x01, 0xCD, 0x10, 0x28, 0x83,
+    0xDD, 0x22, 0x83, 0x07, 0x47, 0xBC, 0x24, 0x2D, 0x8C, 0xB6, 0x0B, 0xFB, 0x03, 0x64, 0xE8, 0xC2,
+    0x16, 0x01, 0x82, 0x36, 0x43, 0xAE, 0x01, 0x0D, 0xD0, 0x0E, 0xA5, 0xEB, 0x3B, 0x4A, 0x72, 0x60,
+    0xA7, 0x09, 0x9A, 0x23, 0x79, 0x7C, 0xF7, 0x78, 0x3F, 0xEF, 0x7D, 0xEF, 0x7B, 0x8F, 0xC7, 0x30,
+    0xC3, 0x32, 0x53, 0x5A, 0x49, 0x8E, 0xAA, 0x02, 0x22, 0x01, 0x23, 0xC5, 0xA4, 0x79, 0x4A, 0xDD,
+    0x55, 0x2A, 0xAF, 0xB4, 0x96, 0x05, 0x4C, 0xD2, 0x0E, 0x80, 0x2A, 0x49, 0x12, 0xB8, 0xB5, 0x27,
+    0x0D, 0x49, 0x0A, 0xA7, 0x92, 0x13, 0xC2, 0xDA, 0x6E, 0x2D, 0x45, 0x4A, 0xFD, 0xAE, 0xD4, 0x10,
+    0x15, 0x9F, 0x2B, 0xA1, 0x46, 0xB6, 0x84, 0x07, 0xE4, 0x7A, 0x12, 0x17, 0x2F, 0x2F, 0xE2, 0x6D,
+    0x78, 0x21, 0x17, 0xA4, 0xC9, 0xE0, 0xB2, 0x6B, 0x3C, 0x1E, 0xDA, 0x49, 0xC3, 0x88, 0x81, 0x4F,
+    0x00, 0x05, 0x53, 0x09, 0x7E, 0x4F, 0x3A, 0xC8, 0xDB, 0x38, 0xC3, 0x7C, 0xB6, 0xA8, 0xF0, 0xA7,
+    0x1A, 0xA5, 0x32, 0xC8, 0xCF, 0xB2, 0xEB, 0xE8, 0xF7, 0xD7, 0x94, 0x8A, 0x14, 0x19, 0x07, 0xAE,
+    0x8A, 0xB6, 0xDD, 0x6A, 0xB5, 0x4E, 0xE1, 0xA8, 0x0B, 0xD7, 0xE9, 0x67, 0x5C, 0x25, 0x6C, 0xE0,
+    0x97, 0x07, 0x83, 0x0E, 0x5E, 0xC5, 0x79, 0xD1, 0xB9, 0x65, 0x3D, 0x10, 0x6E, 0x85, 0xA9, 0x2B,
+    0xCB, 0x7E, 0x0D, 0xA9, 0x23, 0x52, 0x53, 0x94, 0x68, 0x69, 0x35, 0x6D, 0x74, 0x6E, 0xCE, 0xAD,
+    0xCF, 0xB6, 0x6B, 0x5E, 0x6E, 0x27, 0xB8, 0x76, 0xDC, 0x1F, 0xF2, 0xB8, 0x6B, 0x27, 0x9E, 0x99,
+    0x38, 0x46, 0x32, 0x8B, 0x04, 0x17, 0x70, 0xAC, 0x81, 0x4D, 0x7E, 0x57, 0x5A, 0x4A, 0x30, 0xE5,
+    0x13, 0x50, 0xE5, 0x8E, 0x6E, 0x68, 0x96, 0x32, 0x67, 0x7A, 0x91, 0x23, 0x46, 0x8F, 0xAC, 0x47,
+    0xCE, 0x05, 0xBF, 0x92, 0x32, 0x59, 0xC5, 0x2C, 0x4B, 0x34, 0xCE, 0x9D, 0x02, 0xDA, 0x01, 0x4E,
+    0x9D, 0xDE, 0x67, 0x18, 0x2E, 0xC2, 0x56, 0x49, 0xF5, 0x61, 0x56, 0x87, 0xBB, 0x80, 0x79, 0x43,
+    0xAC, 0xD8, 0x22, 0x73, 0x16, 0xA5, 0x67, 0xC9, 0x0A, 0x78, 0x9C, 0x57, 0x6F, 0x67, 0x8E, 0x29,
+    0xEB, 0x96, 0x28, 0xA3, 0x6B, 0x49, 0xCF, 0x48, 0xAB, 0x61, 0x6E, 0x0B, 0x97, 0xF9, 0x76, 0x3C,
+    0xE4, 0xB7, 0xF5, 0xCC, 0x86, 0x49, 0xDF, 0x0A, 0xF8, 0xE2, 0x02, 0xBE, 0x79, 0x5C, 0x37, 0x72,
+    0x4B, 0x72, 0xE1, 0x60, 0x41, 0x3B, 0xC6, 0x08, 0x11, 0x59, 0x65, 0xB2, 0x04, 0xEE, 0xA7, 0x1A,
+    0x21, 0x3F, 0x2D, 0xA1, 0xD2, 0x3A, 0xAF, 0xF2, 0x8B, 0x37, 0x04, 0x5C, 0x98, 0x7B, 0x9D, 0x11,
+    0xA2, 0x4C, 0x11, 0xCE, 0x59, 0x6E, 0xA5, 0x41, 0x1C, 0x10, 0x5E, 0x25, 0xAF, 0xBD, 0xBE, 0xDE,
+    0x76, 0x4A, 0xCC, 0x37, 0x85, 0xBE, 0xA2, 0x51, 0x30, 0xAC, 0x2C, 0x45, 0xA3, 0x4F, 0xFF, 0x1A,
+    0x8F, 0x01, 0xDD, 0x2F, 0xEF, 0x44, 0xA3, 0x37, 0x7E, 0x33, 0x05, 0xAD, 0x87, 0xC6, 0x9F, 0x35,
+    0x1D, 0x43, 0xEA, 0xDB, 0xDC, 0x1D, 0xA9, 0x9F, 0xEE, 0x2F, 0xF1, 0x30, 0x2B, 0xEE, 0xDC, 0xDE,
+    0x0D, 0xFE, 0x19, 0xB8, 0x83, 0x81, 0xFB, 0x34, 0x12, 0x07, 0x91, 0xE7, 0x22, 0xAB, 0xBE, 0x9B,
+    0xB8, 0x8C, 0x36, 0xB6, 0x42, 0x9E, 0x62, 0x13, 0x75, 0xAC, 0x04, 0x99, 0x17, 0x33, 0xA4, 0x35,
+    0x4B, 0x6C, 0xD8, 0x22, 0xFA, 0x5A, 0x31, 0x7F, 0x02, 0x3D, 0x05, 0x9A, 0xCE, 0xDB, 0xED, 0xAF,
+    0xA5, 0xB4, 0x4D, 0x71, 0x37, 0x51, 0x6A, 0x73, 0xF6, 0xAB, 0x90, 0xAE, 0xA3, 0x54, 0xD8, 0xB5,
+    0xE3, 0x67, 0xC3, 0xB6, 0x8F, 0x53, 0x2C, 0x23, 0x4E, 0x4D, 0xC9, 0x92, 0xFE, 0x67, 0x4C, 0x58,
+    0x93, 0x85, 0x51, 0x4C, 0xFB, 0x3D, 0xBA, 0x2A, 0x22, 0xB9, 0x80, 0x8D, 0x3D, 0xCA, 0x05, 0x94,
+    0x00, 0xFA, 0x99, 0xA4, 0xD2, 0x84, 0x7E, 0x72, 0x3C, 0x3A, 0xD2, 0xEF, 0xF7, 0x27, 0x64, 0x64,
+    0xBE, 0x61, 0x0F, 0x8D, 0x2D, 0xB5, 0xFB, 0x38, 0x8E, 0x64, 0xCF, 0xE8, 0x61, 0x3F, 0x57, 0xFB,
+    0x45, 0x1B, 0x8F, 0xC7, 0xB2, 0x9E, 0x30, 0x8F, 0x6A, 0x62, 0x67, 0x76, 0x6E, 0x0D, 0xD1, 0x85,
+    0xA1, 0x35, 0xCC, 0x07, 0xA1, 0x01, 0x9B, 0x60, 0xCF, 0x08, 0x37, 0x02, 0x3F, 0x39, 0xA8, 0x90,
+    0x07, 0x14, 0xC6, 0x73, 0x14, 0xD6, 0x58, 0xC1, 0xFD, 0x42, 0xD1, 0x18, 0x2B, 0x9A, 0x79, 0x8D,
+    0xF3, 0x5A, 0xDE, 0x24, 0x0C, 0xF7, 0xF0, 0x1C, 0xF5, 0x29, 0xD1, 0x15, 0x19, 0x49, 0xE7, 0x5B,
+    0xE4, 0x6A, 0xB7, 0x7F, 0xE3, 0x5E, 0x88, 0x33, 0x6D, 0x18, 0xFA, 0x45, 0xCE, 0xFF, 0xD2, 0xEF,
+    0x5F, 0xB7, 0xB7, 0x47, 0xC6, 0x93, 0x51, 0xE6, 0x72, 0x73, 0xCB, 0x5F, 0x3F, 0x51, 0x2E, 0xD7,
+    0x57, 0x9C, 0xD4, 0x4E, 0xAA, 0x69, 0x7D, 0xB3, 0x7C, 0x6A, 0xE6, 0x4E, 0x5E, 0x37, 0x63, 0x07,
+    0x99, 0x25, 0x36, 0xBD, 0xC5, 0xF0, 0x45, 0x30, 0x3D, 0x8F, 0xC4, 0xCF, 0x06, 0x20, 0xB0, 0x72,
+    0x4B, 0xAC, 0x70, 0x7F, 0x95, 0x52, 0x84, 0x59, 0xD2, 0x7C, 0xBC, 0x9D, 0xE6, 0x79, 0xB7, 0x56,
+    0xE7, 0x98, 0x05, 0xCA, 0x66, 0x5C, 0x37, 0x13, 0x2F, 0x19, 0x56, 0x5A, 0xAD, 0xA5, 0xA0, 0xB0,
+    0xB9, 0x7F, 0x6B, 0x85, 0xDC, 0x9E, 0x3E, 0x65, 0x9A, 0xF3, 0x22, 0x3B, 0xF6, 0x27, 0xB4, 0x97,
+    0x7B, 0x39, 0x25, 0xC7, 0xF8, 0xA2, 0x10, 0x54, 0xDC, 0xA3, 0xB6, 0xBA, 0x7A, 0x47, 0x91, 0xBF,
+    0x8E, 0x32, 0x3F, 0xFB, 0x31, 0xC4, 0x3B, 0x93, 0x1D, 0x28, 0x42, 0x1A, 0x64, 0x8A, 0x52, 0x13,
+    0x56, 0x66, 0xDE, 0x56, 0x3B, 0x1B, 0xF5, 0xAA, 0x5A, 0x14, 0x4E, 0x0C, 0x2A, 0x31, 0x2C, 0x2D,
+    0x6A, 0x27, 0x7A, 0x98, 0x09, 0x0F, 0x3B, 0xD9, 0x99, 0x46, 0x94, 0x5F, 0xB6, 0x75, 0x19, 0xE6,
+    0xC9, 0x9C, 0x37, 0xEA, 0xB4, 0x83, 0xFC, 0xD2, 0x8C, 0xAE, 0x14, 0xD6, 0xB9, 0xD8, 0x51, 0x59,
+    0xA0, 0x86, 0xFC, 0x9C, 0x34, 0xCE, 0x85, 0xC5, 0xD6, 0x46, 0x68, 0x27, 0x4E, 0x36, 0xCE, 0x39,
+    0xCA, 0x42, 0x41, 0xF2, 0x48, 0xC5, 0x4E, 0x66, 0x8D, 0xAD, 0xE7, 0xD3, 0xFE, 0x83, 0xEF, 0xC1,
+    0x9B, 0xF8, 0xF6, 0x73, 0x3A, 0x8F, 0x80, 0x58, 0x07, 0x0E, 0x03, 0x1F, 0x01, 0x27, 0xB5, 0xD0,
+    0xBC, 0x04, 0xCC, 0x96, 0x26, 0x33, 0x57, 0x89, 0x2B, 0x5C, 0x52, 0x7D, 0xB5, 0x26, 0x6B, 0x7B,
+    0xFA, 0xEB, 0x11, 0x50, 0xFF, 0xCA, 0x74, 0xD5, 0x78, 0x07, 0x7C, 0xF3, 0x1E, 0x20, 0xF1, 0xF1,
+    0x0F, 0x4F, 0x4F, 0x29, 0xB0, 0xD3, 0x36, 0xA8, 0xB1, 0x0D, 0x44, 0xA3, 0x20, 0x1C, 0xD8, 0x0F,
+    0x32, 0xED, 0x8D, 0x75, 0xF7, 0x8F, 0xF8, 0xE6, 0x9C, 0x29, 0xE7, 0x0D, 0x15, 0x72, 0x25, 0x9D,
+    0xAF, 0x32, 0xC2, 0xAD, 0xEC, 0x96, 0xC7, 0xD5, 0x0F, 0xA7, 0x71, 0xE8, 0x64, 0x23, 0xE7, 0x29,
+    0x97, 0x5E, 0x76, 0x42, 0xD7, 0xA7, 0x66, 0x37, 0xF8, 0x42, 0x44, 0xFE, 0x00, 0x3D, 0x9F, 0xAF,
+    0x7A, 0x71, 0xB7, 0xFA, 0x30, 0xE9, 0x69, 0x83, 0xCD, 0xC4, 0x4C, 0xAA, 0x49, 0x04, 0xE7, 0x7D,
+    0x69, 0x6F, 0x3F, 0xB8, 0x9A, 0xCE, 0xBB, 0x67, 0xCD, 0x2B, 0x31, 0x6A, 0x56, 0xE2, 0xDA, 0xE6,
+    0xD6, 0xCF, 0xAB, 0xE5, 0x6E, 0xD4, 0x21, 0x5C, 0x5E, 0xFB, 0xCE, 0xCB, 0x03, 0xFA, 0x59, 0xD4,
+    0x36, 0x0E, 0x9D, 0xD4, 0x86, 0x45, 0x1F, 0x26, 0x5E, 0xF4, 0x68, 0x2B, 0x94, 0xF3, 0x97, 0x39,
+    0xBB, 0x47, 0x2F, 0x1A, 0x89, 0x88, 0x27, 0xDA, 0x9D, 0xB7, 0xC6, 0xB1, 0x5C, 0xD0, 0x5E, 0x5E,
+    0x28, 0x12, 0xEA, 0xCB, 0x58, 0xBF, 0x56, 0x74, 0x58, 0xE0, 0xF8, 0x11, 0xA1, 0xB2, 0x1C, 0x53,
+    0xBD, 0x5C, 0x53, 0x29, 0x18, 0xF1, 0xFE, 0x3E, 0xA9, 0x8F, 0xF7, 0xFD, 0x97, 0x9D, 0xFD, 0x34,
+    0x9D, 0x8B, 0xE0, 0x1D, 0x18, 0xA2, 0xE5, 0x6B, 0xB7, 0x23, 0xB5, 0x03, 0xCC, 0x79, 0x4F, 0x94,
+    0xFA, 0x7B, 0x6D, 0x2B, 0xC4, 0x9B, 0x4A, 0xA5, 0x54, 0x17, 0xD8, 0xC5, 0x6B, 0xD3, 0x1F, 0x33,
+    0x96, 0x95, 0xA2, 0x23, 0x88, 0xC0, 0x2A, 0x86, 0xB7, 0xE3, 0xBF, 0x4E, 0x05, 0x4B, 0xF3, 0x23,
+    0x32, 0x8B, 0x08, 0xE4, 0x9B, 0xBA, 0x37, 0x13, 0xFC, 0x8F, 0xF6, 0x2F, 0xBD, 0x55, 0xBF, 0x6F,
+    0xD3, 0x40, 0x14, 0x7E, 0x8E, 0x13, 0x59, 0xE4, 0x48, 0x5D, 0xA4, 0x76, 0x00, 0x42, 0xB3, 0x74,
+    0x60, 0x81, 0x04, 0x29, 0x42, 0x0C, 0x50, 0x5B, 0x62, 0x60, 0x60, 0x80, 0xA1, 0x5D, 0xE8, 0xD0,
+    0xB1, 0x62, 0x22, 0x4C, 0x4C, 0x34, 0x2E, 0x12, 0x62, 0xA3, 0x5D, 0x3A, 0xB3, 0x30, 0x80, 0x59,
+    0x40, 0x62, 0x6C, 0x92, 0x43, 0x0C, 0x0C, 0x0C, 0xF8, 0x0F, 0x40, 0x22, 0x03, 0x2C, 0x65, 0xA8,
+    0x8B, 0x8C, 0x48, 0x91, 0x9D, 0xE3, 0x7B, 0x77, 0x4E, 0xA1, 0x40, 0xA4, 0x96, 0x81, 0x73, 0xE2,
+    0x77, 0x77, 0xF9, 0xEE, 0xBD, 0x77, 0xDF, 0xFB, 0x11, 0x22, 0x8C, 0x22, 0xE9, 0x71, 0xC6, 0x56,
+    0x3C, 0x86, 0xAE, 0x16, 0xA9, 0xDE, 0x13, 0x81, 0x16, 0xB3, 0x94, 0x0F, 0x91, 0x14, 0xAB, 0x54,
+    0x11, 0xD9, 0x85, 0x4A, 0xA3, 0x72, 0xA9, 0x53, 0xF2, 0x9D, 0xA4, 0x7A, 0xAA, 0x59, 0xF6, 0x54,
+    0x93, 0x4E, 0x93, 0xFB, 0xD4, 0x9A, 0x3F, 0x26, 0xAB, 0xB7, 0xDF, 0x54, 0x6F, 0xBF, 0x02, 0x50,
+    0x38, 0x97, 0xE9, 0x85, 0xAC, 0xB6, 0x9C, 0x4A, 0x61, 0xF5, 0xB3, 0x2C, 0xF9, 0x8D, 0xF2, 0xE8,
+    0x69, 0x4E, 0x9C, 0xED, 0x96, 0x7C, 0x11, 0xC7, 0x57, 0xA8, 0x4A, 0x2D, 0x8A, 0xAC, 0x2D, 0x7F,
+    0x9E, 0xCA, 0xFC, 0x88, 0xAD, 0x0B, 0x33, 0xAD, 0x89, 0x56, 0xB9, 0xA5, 0x31, 0x96, 0xDF, 0xA0,
+    0x26, 0x9E, 0xF3, 0x83, 0x8B, 0x13, 0x4D, 0x31, 0x7A, 0x26, 0xAD, 0xE5, 0x9D, 0x6C, 0x46, 0xDC,
+    0x7B, 0x63, 0xC9, 0x73, 0xB2, 0x75, 0xB4, 0x55, 0xB5, 0xAB, 0x0E, 0x61, 0xD1, 0xF0, 0x27, 0x8B,
+    0xCB, 0x6F, 0xA3, 0xE7, 0x82, 0xF8, 0x63, 0xC1, 0xD9, 0xA8, 0xDE, 0x8F, 0x2A, 0xC4, 0x1F, 0xB1,
+    0x3E, 0xDD, 0x70, 0x2A, 0xF6, 0xAA, 0x94, 0xCD, 0xE7, 0xE5, 0x26, 0xBD, 0xA7, 0x4B, 0x64, 0xD1,
+    0xEC, 0x11, 0xFB, 0x2A, 0xDD, 0x21, 0xE1, 0xDB, 0x7D, 0xFB, 0x61, 0x41, 0x46, 0x7E, 0xB1, 0xF0,
+    0x98, 0xA8, 0x2E, 0x89, 0xBA, 0x44, 0x85, 0x04, 0x97, 0xC5, 0xF4, 0xCC, 0xE8, 0xE6, 0x3D, 0xA5,
+    0x3E, 0x80, 0x1C, 0x30, 0xF3, 0x01, 0xDB, 0x60, 0xC7, 0xFD, 0x43, 0xA8, 0x30, 0x5C, 0x03, 0x71,
+    0x80, 0xBC, 0x1B, 0x07, 0x61, 0xB1, 0x15, 0x3E, 0x05, 0x64, 0x1B, 0xCA, 0xAC, 0x60, 0x8A, 0x3C,
+    0x27, 0xB2, 0xE3, 0x2E, 0xCD, 0x39, 0x11, 0xED, 0x0D, 0xA1, 0x54, 0x66, 0x20, 0xD9, 0x58, 0x2D,
+    0xDF, 0xC3, 0x27, 0x6C, 0x08, 0xF6, 0xC6, 0x42, 0x20, 0x86, 0x61, 0xF8, 0xC8, 0x78, 0xDD, 0xC7,
+    0x05, 0x94, 0x2C, 0x70, 0x68, 0x7D, 0x61, 0xE2, 0x6B, 0xC7, 0x6C, 0x8C, 0x61, 0x44, 0x9E, 0x36,
+    0xAC, 0x83, 0xBE, 0x6F, 0xBB, 0xB4, 0x80, 0x37, 0xE0, 0x01, 0x71, 0x76, 0x48, 0x72, 0xBF, 0x52,
+    0x4F, 0x32, 0xDA, 0x0B, 0x18, 0xDD, 0xD6, 0xE8, 0x94, 0xD1, 0x98, 0x78, 0xFA, 0x58, 0xCA, 0xDA,
+    0xB0, 0xB2, 0xF4, 0xB6, 0x1B, 0x91, 0x67, 0x2D, 0x28, 0x80, 0x5C, 0x15, 0x63, 0xDB, 0x1B, 0xB2,
+    0xDE, 0x69, 0x1F, 0xAF, 0x9B, 0x44, 0x35, 0x9C, 0x03, 0xD3, 0x1D, 0xCC, 0x7C, 0x2A, 0x44, 0xBF,
+    0x90, 0xFD, 0xEE, 0x00, 0x4C, 0x1E, 0x4A, 0x98, 0x71, 0x4B, 0x7D, 0x24, 0x4F, 0xA9, 0xB8, 0x36,
+    0x0C, 0x33, 0x27, 0x23, 0x2B, 0x80, 0x67, 0x3A, 0xE6, 0xEC, 0x06, 0xAE, 0x03, 0xF2, 0xFB, 0x78,
+    0x65, 0xA4, 0x03, 0x15, 0xFA, 0xCC, 0x14, 0x17, 0x84, 0xD4, 0x3B, 0xEC, 0x60, 0x97, 0x31, 0x71,
+    0x4E, 0x99, 0xCD, 0x8C, 0xD5, 0xF8, 0x44, 0x0F, 0x95, 0x62, 0xAB, 0x8D, 0xC5, 0x88, 0x83, 0xC7,
+    0x11, 0xC4, 0x7A, 0x7E, 0x64, 0x73, 0xDD, 0x66, 0x35, 0xC3, 0x67, 0x03, 0xDC, 0x77, 0xCA, 0xF3,
+    0xCD, 0x59, 0xFD, 0xF5, 0x8D, 0x75, 0x17, 0xD6, 0x1D, 0x3E, 0xA2, 0x76, 0xA1, 0x8F, 0x27, 0x3D,
+    0x98, 0x70, 0xD2, 0xDC, 0x15, 0xB6, 0xB9, 0x92, 0x7F, 0x3B, 0x93, 0x60, 0xB6, 0xBD, 0xB1, 0x94,
+    0xB4, 0x95, 0x8A, 0x6A, 0x6A, 0xA8, 0xC9, 0xDC, 0x4C, 0xFF, 0x3E, 0xE0, 0xEA, 0x83, 0xD7, 0x5F,
+    0x92, 0xB4, 0x73, 0xBC, 0x6C, 0x32, 0x4B, 0x22, 0x30, 0x29, 0x4C, 0xBB, 0x87, 0x99, 0x70, 0x25,
+    0xA4, 0x26, 0xB4, 0xFF, 0xF8, 0xAA, 0xDF, 0x5F, 0x8C, 0x7B, 0x43, 0xA1, 0xFC, 0x12, 0xD3, 0xA8,
+    0x94, 0x4E, 0x82, 0xDA, 0xEF, 0xD2, 0xD7, 0x17, 0x1C, 0x2B, 0xEB, 0x23, 0x49, 0x7B, 0xB2, 0x1D,
+    0x5E, 0x37, 0x12, 0x59, 0xCD, 0x8E, 0x42, 0xEA, 0x34, 0x5C, 0xA1, 0x93, 0xA9, 0x91, 0xE0, 0xCF,
+    0xC8, 0x6E, 0x2E, 0xDB, 0x34, 0xA7, 0xA5, 0xB7, 0x27, 0xEF, 0xE6, 0xFB, 0x9B, 0x39, 0x3E, 0x65,
+    0x69, 0xA7, 0xCF, 0x06, 0xAC, 0xBF, 0x97, 0x40, 0x23, 0xEB, 0x95, 0x2A, 0x62, 0xB9, 0x4B, 0x53,
+    0x79, 0x2A, 0x6D, 0x9A, 0x0E, 0x91, 0xA7, 0xD8, 0x28, 0xCD, 0x0E, 0xB7, 0x8C, 0x4C, 0x7C, 0x75,
+    0xC7, 0x55, 0xEB, 0xA6, 0xF3, 0x2A, 0x39, 0x5C, 0x58, 0x58, 0xFA, 0x74, 0x43, 0x19, 0xB0, 0x9D,
+    0x17, 0xB8, 0x9B, 0x97, 0x42, 0xC7, 0x2C, 0xC5, 0xF6, 0xBE, 0xA5, 0x6B, 0xBA, 0x92, 0x95, 0x83,
+    0xDB, 0x6B, 0xBA, 0xF8, 0x7B, 0x71, 0xAA, 0xE9, 0x1E, 0xE8, 0xF6, 0x84, 0xD4, 0xD7, 0x4D, 0x80,
+    0xCB, 0x3F, 0x33, 0xD3, 0xBC, 0xE4, 0x4D, 0x7D, 0x8C, 0x99, 0x4E, 0xCF, 0x6B, 0x1D, 0xA9, 0x76,
+    0x33, 0xE1, 0x0E, 0xD0, 0xD6, 0x45, 0x9E, 0x31, 0xC0, 0x89, 0x4D, 0xBD, 0x9B, 0x06, 0x70, 0xB0,
+    0x29, 0x9D, 0x40, 0xD6, 0x3B, 0x49, 0x9E, 0xDB, 0x88, 0x2A, 0xD9, 0x5C, 0x58, 0x2F, 0x7F, 0x36,
+    0x40, 0xE6, 0xB6, 0x7E, 0x8D, 0xB5, 0xB3, 0x1D, 0x1C, 0xAD, 0x07, 0x29, 0x16, 0x3A, 0x95, 0x90,
+    0x4C, 0x81, 0x2B, 0xB5, 0x5D, 0x4E, 0x2E, 0x54, 0x10, 0xC7, 0xDC, 0xC5, 0x8D, 0xCC, 0x44, 0xEA,
+    0xCE, 0xC4, 0xCE, 0x09, 0x9D, 0xBD, 0x00, 0x5B, 0x0C, 0x15, 0x7C, 0xDC, 0x0B, 0x98, 0x23, 0xA6,
+    0x8F, 0x35, 0x7B, 0x60, 0x09, 0xBF, 0x9D, 0xE0, 0x3F, 0x39, 0x2F, 0xC8, 0xCB, 0xD1, 0xB4, 0xC2,
+    0x39, 0x7E, 0x5D, 0xDC, 0xEF, 0x91, 0xC5, 0x99, 0xE0, 0x32, 0x69, 0x3D, 0xC5, 0xE5, 0xCA, 0x1A,
+    0xB0, 0x55, 0xF8, 0x86, 0xAD, 0xDA, 0x1A, 0xB7, 0x38, 0x0F, 0x66, 0x22, 0x6C, 0xCD, 0xD9, 0x0A,
+    0xB5, 0xE3, 0x2A, 0xA4, 0xAE, 0xC7, 0xB6, 0x15, 0x6C, 0x63, 0x6B, 0x05, 0xA7, 0xB9, 0x4D, 0xA6,
+    0xC8, 0x58, 0xB5, 0x33, 0x40, 0xBF, 0x40, 0x4C, 0x5D, 0xD5, 0x61, 0x3D, 0x7D, 0x76, 0x9F, 0x5B,
+    0x48, 0x92, 0xDB, 0xF0, 0xE8, 0x3F, 0x8C, 0x1F, 0xAD, 0x95, 0xBF, 0x8E, 0xE4, 0x44, 0x10, 0xC6,
+    0xCB, 0x6B, 0x1D, 0x0E, 0x1C, 0x34, 0xC1, 0xE5, 0xCE, 0x49, 0xFC, 0x04, 0x6C, 0x8F, 0xC4, 0x03,
+    0x5C, 0x04, 0x29, 0x0F, 0x40, 0xC0, 0x13, 0xDC, 0x8C, 0x25, 0x42, 0x82, 0xCD, 0x78, 0x07, 0x66,
+    0x83, 0x7B, 0x81, 0x9D, 0xB1, 0x05, 0x0F, 0x70, 0xFB, 0x06, 0x67, 0x84, 0x08, 0xB8, 0x64, 0x8D,
+    0x6E, 0xA4, 0x1D, 0xF6, 0x7A, 0x5C, 0xFC, 0xBE, 0x9E, 0xE1, 0x26, 0xB9, 0x91, 0x40, 0x30, 0x72,
+    0xD7, 0x6E, 0x57, 0x57, 0x57, 0x7D, 0xFE, 0xEA, 0x8F, 0xCD, 0xF4, 0xAB, 0xEE, 0xC3, 0x60, 0x96,
+    0xAA, 0xD1, 0xAC, 0xF1, 0xC9, 0xAC, 0xF0, 0xD1, 0xCE, 0xBF, 0xAB, 0x3D, 0x62, 0x13, 0x11, 0xB1,
+    0x46, 0xDF, 0x76, 0xC9, 0x2C, 0x0C, 0x6D, 0x67, 0xF5, 0x58, 0x4E, 0xC6, 0xB3, 0xB5, 0x62, 0x8F,
+    0xC6, 0x0E, 0x32, 0x5D, 0x61, 0x66, 0xED, 0x82, 0xC3, 0xEC, 0xB3, 0xBE, 0xE7, 0xC6, 0x77, 0xF8,
+    0x2C, 0xFF, 0x90, 0x9B, 0x2D, 0x77, 0x2D, 0xCC, 0xF2, 0xEA, 0x0B, 0x79, 0x1C, 0xB4, 0xC7, 0xC6,
+    0xEA, 0x49, 0x40, 0x76, 0x1C, 0xBC, 0xDA, 0x0B, 0x81, 0xAC, 0x57, 0x6C, 0xAD, 0x90, 0xDD, 0x1D,
+    0xFA, 0x77, 0x58, 0x84, 0xD7, 0x5C, 0x88, 0xC2, 0x92, 0xF0, 0x54, 0xFE, 0xAF, 0xAA, 0xA7, 0xF5,
+    0xFA, 0xD5, 0x6B, 0xE7, 0x17, 0x59, 0x49, 0xEF, 0x04, 0x20, 0x11, 0xD1, 0x74, 0x88, 0xA5, 0xA0,
+    0xEC, 0xFF, 0xC6, 0x63, 0xBA, 0x66, 0xA5, 0xF6, 0xD6, 0xE7, 0x77, 0x38, 0xE8, 0xE8, 0x51, 0xE6,
+    0xB1, 0xD5, 0xD1, 0x2F, 0xC2, 0xBE, 0x11, 0x07, 0x61, 0xD8, 0xE8, 0xAA, 0x5C, 0xB5, 0xBA, 0x57,
+    0x4E, 0x57, 0x9C, 0x6D, 0xC4, 0x18, 0x0F, 0x81, 0x08, 0x37, 0x5A, 0x8B, 0xB4, 0xF2, 0x69, 0x7D,
+    0xBB, 0x53, 0xA8, 0xA6, 0xCB, 0xEC, 0x15, 0x00, 0xAB, 0x47, 0xD8, 0xB4, 0x58, 0x8A, 0xC3, 0x9D,
+    0x50, 0x34, 0x37, 0x0A, 0x98, 0x7A, 0xF7, 0x9D, 0x9F, 0x96, 0x58, 0xFD, 0xD8, 0x9A, 0xBF, 0x5C,
+    0x98, 0xFB, 0xBC, 0x50, 0x84, 0x83, 0x7D, 0xBD, 0x27, 0x43, 0x09, 0xA0, 0x33, 0x6B, 0xC9, 0x5A,
+    0x69, 0x01, 0x6E, 0xCB, 0x3A, 0x6C, 0xAC, 0x4A, 0xDB, 0x75, 0x3F, 0xE1, 0x77, 0xE8, 0xA1, 0xBF,
+    0xF7, 0xDF, 0x0D, 0x26, 0xF6, 0x81, 0xCB, 0x3F, 0x4F, 0x56, 0xEF, 0x71, 0xD8, 0xC7, 0x23, 0x6D,
+    0x99, 0x3F, 0xB1, 0xB6, 0x45, 0xB1, 0x0A, 0x4F, 0xB7, 0x73, 0xE9, 0x7E, 0x30, 0x41, 0x91, 0x02,
+    0x80, 0xE5, 0xE3, 0x74, 0xCC, 0x76, 0xE3, 0xB0, 0xE8, 0x03, 0xF9, 0x46, 0x31, 0xA3, 0xF0, 0xB8,
+    0xBE, 0xF5, 0x17, 0x98, 0x7E, 0xE1, 0xFE, 0x27, 0x51, 0x1C, 0xCE, 0x13, 0x5B, 0x65, 0x23, 0x57,
+    0xD6, 0x7F, 0xFE, 0x43, 0x3C, 0xF7, 0x2E, 0xCB, 0xC1, 0xEA, 0xA3, 0xCC, 0x5C, 0x5F, 0x92, 0x17,
+    0x9F, 0xEE, 0x2C, 0x9B, 0x85, 0x64, 0x9B, 0x65, 0xB4, 0xB3, 0xDC, 0xD8, 0x31, 0x8B, 0x48, 0x95,
+    0x43, 0x18, 0xBE, 0x51, 0x1D, 0xBD, 0xED, 0x55, 0x48, 0x7E, 0x94, 0x77, 0xB9, 0x60, 0x2E, 0xC9,
+    0xE7, 0x92, 0xCF, 0xB0, 0x7C, 0x43, 0xA6, 0xB0, 0x7E, 0x73, 0xE9, 0xB5, 0x7C, 0xBD, 0xBE, 0xF9,
+    0x07, 0x54, 0xBD, 0x5D, 0xFF, 0x88, 0xC9, 0x03, 0xCE, 0x00, 0x98, 0x51, 0x2F, 0x73, 0xF5, 0x6E,
+    0xE9, 0x4F, 0x0A, 0xB8, 0x9A, 0xB0, 0xA2, 0x16, 0xA3, 0x36, 0x4D, 0x47, 0xC7, 0x96, 0xAA, 0xB8,
+    0x86, 0x94, 0x4D, 0x68, 0x92, 0x6A, 0xBE, 0x1A, 0xD5, 0xE8, 0xE1, 0xBE, 0xE9, 0x56, 0x2A, 0xED,
+    0x61, 0xA9, 0xE2, 0x23, 0x93, 0x62, 0xD5, 0x54, 0x14, 0x29, 0x37, 0xB0, 0xE7, 0x26, 0xD5, 0xB1,
+    0x6A, 0xFD, 0x40, 0x89, 0x4F, 0xEA, 0xE3, 0x6A, 0x0C, 0xA3, 0x1A, 0x24, 0xD7, 0x30, 0x9C, 0x2C,
+    0xAD, 0x85, 0xBE, 0x01, 0xE7, 0xB1, 0x03, 0x43, 0x8E, 0x8D, 0x7F, 0xBA, 0xAA, 0xD7, 0xB4, 0x00,
+    0xDA, 0x01, 0x07, 0x1C, 0x17, 0x09, 0x43, 0x8E, 0xF3, 0xC0, 0x91, 0xFF, 0x8E, 0x14, 0xCE, 0x36,
+    0xFF, 0xD0, 0x8F, 0xCF, 0xAD, 0x54, 0xCC, 0xB8, 0x50, 0x3F, 0x70, 0x96, 0x03, 0x6A, 0x42, 0xE4,
+    0xF5, 0xC9, 0xAD, 0x63, 0xCE, 0xBE, 0x3F, 0x8E, 0x8D, 0xE1, 0xD4, 0x9A, 0xF1, 0x34, 0x5C, 0x32,
+    0x3E, 0xDD, 0x5F, 0x7D, 0xCA, 0xFA, 0xFE, 0xB7, 0xAF, 0xFC, 0x27, 0xBD, 0xCB, 0xB7, 0x74, 0x86,
+    0x3D, 0x5B, 0xE4, 0xE9, 0x52, 0xA8, 0x3C, 0x03, 0x95, 0x82, 0x0F, 0x15, 0x50, 0xD2, 0x7B, 0x4E,
+    0x76, 0xF5, 0x88, 0xAA, 0xB9, 0x41, 0x95, 0x62, 0xB2, 0xFA, 0x1E, 0xD5, 0x75, 0xE9, 0x43, 0x39,
+    0x05, 0x87, 0x5B, 0x54, 0xC9, 0x7C, 0x22, 0xF3, 0x0E, 0xC9, 0xC1, 0xA1, 0x29, 0x26, 0xBA, 0xDF,
+    0x99, 0x75, 0xA5, 0xB2, 0x14, 0x7C, 0x23, 0x3F, 0x20, 0xA6, 0xB9, 0x51, 0xED, 0x4E, 0x31, 0xF2,
+    0xF4, 0xB0, 0x62, 0x97, 0xE7, 0xA7, 0x86, 0xA5, 0xE2, 0x55, 0x99, 0xDD, 0xD3, 0x4F, 0x33, 0x64,
+    0xA5, 0xB1, 0x24, 0x5C, 0x2D, 0x77, 0x0A, 0x79, 0x08, 0xB2, 0xDB, 0xA0, 0xAA, 0x7E, 0x45, 0x15,
+    0x01, 0x71, 0xB5, 0x03, 0x44, 0xE8, 0x50, 0x25, 0x40, 0x30, 0xC8, 0x1D, 0xE7, 0x31, 0xE1, 0xD8,
+    0xA7, 0xA6, 0x43, 0xC5, 0xA9, 0x53, 0xE5, 0x31, 0xC1, 0xB3, 0xD3, 0xB6, 0xA5, 0x3F, 0x50, 0x13,
+    0xE2, 0x29, 0x0A, 0x89, 0x58, 0xCB, 0x31, 0xC2, 0x00, 0x0B, 0xED, 0x0B, 0x12, 0x30, 0x11, 0xE3,
+    0xA0, 0x5A, 0x67, 0xD0, 0x57, 0x53, 0x2E, 0xEE, 0xC4, 0x26, 0x0C, 0xB9, 0x74, 0xF0, 0x37, 0x44,
+    0x4D, 0x95, 0x09, 0x2F, 0x07, 0x3B, 0xFE, 0x33, 0x90, 0xD9, 0x44, 0x42, 0xC2, 0x50, 0xCB, 0x26,
+    0x62, 0x5C, 0xC8, 0xB4, 0xD6, 0xF5, 0x88, 0x9F, 0x22, 0xA9, 0xD9, 0xE4, 0x39, 0x32, 0x1C, 0x0A,
+    0x81, 0xE2, 0x7D, 0x72, 0x87, 0x6A, 0xFC, 0x4D, 0xF6, 0x52, 0x09, 0xA2, 0x5A, 0x23, 0x1F, 0x23,
+    0xDC, 0x14, 0x3B, 0x7D, 0x58, 0x36, 0x52, 0xB6, 0xA2, 0x2B, 0xF7, 0xE9, 0x55, 0xFE, 0xDA, 0x24,
+    0x29, 0xA3, 0x94, 0xB9, 0x49, 0xCB, 0xB3, 0xF2, 0x3A, 0x2B, 0xD5, 0xAD, 0xF8, 0x60, 0xCA, 0x6A,
+    0x46, 0xE9, 0x24, 0x7E, 0x36, 0x6B, 0x6C, 0x29, 0x03, 0xEF, 0xF4, 0xD5, 0x49, 0xB9, 0xE5, 0xAC,
+    0xEF, 0x94, 0x76, 0x91, 0x50, 0x6A, 0x00, 0x0B, 0x8D, 0xEA, 0xD7, 0x67, 0x65, 0xA9, 0x4F, 0x30,
+    0xD4, 0x44, 0xCD, 0xB8, 0x18, 0x13, 0xE8, 0x3E, 0x8F, 0x89, 0xA0, 0x77, 0x39, 0xBF, 0xFB, 0x98,
+    0x9A, 0xAE, 0x80, 0x79, 0x61, 0x8A, 0x7C, 0xE3, 0xCA, 0x11, 0xCA, 0xC7, 0x7A, 0x10, 0xF1, 0x90,
+    0x91, 0x8A, 0xDD, 0xB1, 0x38, 0x98, 0xF7, 0xC9, 0xEE, 0xAE, 0x25, 0x97, 0x2F, 0x25, 0x8F, 0x4F,
+    0xBB, 0x97, 0x0C, 0xD3, 0x59, 0x02, 0x58, 0xE3, 0xA0, 0xD0, 0xD4, 0xAC, 0x1E, 0x80, 0xD4, 0xF4,
+    0xFA, 0xE6, 0x10, 0xBD, 0x78, 0x7F, 0x49, 0xC5, 0x9C, 0xE9, 0x35, 0x60, 0x34, 0x34, 0xFC, 0xFD,
+    0xBF, 0xB8, 0xF8, 0x41, 0x65, 0xF6, 0x17, 0xC5, 0x55, 0x3D, 0x4E, 0xDD, 0x40, 0x10, 0x1E, 0xDB,
+    0x12, 0x2E, 0x5C, 0xB8, 0x49, 0xBF, 0x47, 0xF0, 0x0D, 0xB2, 0xEF, 0x06, 0x50, 0xA4, 0xA3, 0xE0,
+    0x08, 0x39, 0x41, 0x9E, 0x2D, 0x71, 0x81, 0x34, 0xDC, 0x20, 0x45, 0x62, 0x0A, 0x2E, 0x80, 0x9F,
+    0x57, 0xA1, 0x48, 0x41, 0x81, 0xA5, 0x48, 0x69, 0x79, 0x05, 0x15, 0x95, 0x15, 0x2C, 0x61, 0x90,
+    0xED, 0xC9, 0xF7, 0xAD, 0x1F, 0x88, 0x24, 0x40, 0x1A, 0x14, 0x56, 0x6F, 0xF7, 0xCD, 0xCE, 0xDF,
+    0xCE, 0x7C, 0xBB, 0x33, 0x16, 0xF1, 0x23, 0xD7, 0x82, 0x0B, 0xD6, 0xEC, 0x76, 0x57, 0x25, 0xEE,
+    0x25, 0x1E, 0x64, 0x14, 0x49, 0xD7, 0x19, 0x05, 0x51, 0x2B, 0x12, 0xF5, 0x39, 0x14, 0xCD, 0xE9,
+    0x1A, 0xEB, 0x00, 0x91, 0xA4, 0x67, 0x0E, 0xEB, 0x38, 0x90, 0x3C, 0x7F, 0x40, 0x36, 0x54, 0x58,
+    0x91, 0xFC, 0x06, 0xB3, 0x60, 0xB0, 0x20, 0xB3, 0xFD, 0x1E, 0x1E, 0xDA, 0x14, 0xB2, 0x49, 0xEA,
+    0x85, 0x58, 0x17, 0xEA, 0xC1, 0xFB, 0x56, 0x12, 0x55, 0x18, 0x25, 0x7A, 0x03, 0x9D, 0x60, 0x47,
+    0xA4, 0x56, 0xD5, 0x2B, 0x4C, 0x3D, 0xE3, 0x42, 0xCB, 0x01, 0xF2, 0xE8, 0xAA, 0xDD, 0x1C, 0x67,
+    0x5F, 0x9C, 0x55, 0xEB, 0x27, 0xC1, 0x51, 0x05, 0x66, 0x3B, 0x48, 0xD2, 0x0F, 0x12, 0x52, 0x8D,
+    0xB9, 0x54, 0x9B, 0x49, 0x7A, 0x98, 0xF9, 0xA6, 0x85, 0x5E, 0xA3, 0x3A, 0x89, 0x96, 0x1F, 0x85,
+    0xF9, 0xFE, 0x6B, 0xCE, 0x23, 0xD3, 0x0B, 0xB1, 0x38, 0xC1, 0x4C, 0xE5, 0x18, 0x8F, 0x12, 0x14,
+    0x4A, 0x26, 0x82, 0x88, 0x3A, 0xA2, 0x8F, 0x99, 0x10, 0x57, 0x0F, 0x6B, 0xB3, 0xB1, 0x4C, 0xDD,
+    0x1D, 0x41, 0x0E, 0x01, 0x4D, 0x10, 0xBA, 0x30, 0xEA, 0x88, 0x6C, 0x43, 0x8B, 0x1A, 0xD7, 0x13,
+    0xE9, 0xC1, 0x6E, 0x03, 0x24, 0x47, 0xC2, 0x89, 0xFD, 0x3B, 0x0F, 0xE3, 0x4F, 0x22, 0x78, 0xCA,
+    0x65, 0xB6, 0xF1, 0xAE, 0x78, 0x91, 0xB3, 0xE3, 0x17, 0x66, 0x31, 0xBC, 0x6C, 0x1B, 0x9B, 0xF4,
+    0x6B, 0xCF, 0x64, 0x2C, 0xE5, 0xC8, 0x29, 0xEC, 0xA9, 0x3B, 0x08, 0x9E, 0xD1, 0x92, 0x16, 0x76,
+    0x01, 0x55, 0xE3, 0x60, 0x97, 0x34, 0x10, 0xD2, 0x87, 0x0D, 0x3B, 0x5A, 0x78, 0xC0, 0x96, 0x74,
+    0x53, 0xD3, 0x39, 0x13, 0x91, 0x9A, 0x99, 0xA7, 0x3C, 0xC7, 0xE3, 0x14, 0x52, 0x27, 0x20, 0x48,
+    0x87, 0x13, 0x61, 0xE3, 0x62, 0xB8, 0x95, 0x1D, 0x79, 0x38, 0x66, 0xDC, 0x7D, 0xA0, 0x73, 0x80,
+    0x5B, 0xAA, 0x88, 0xCA, 0x00, 0x8B, 0xB5, 0x64, 0x37, 0x39, 0x5E, 0x78, 0xD6, 0xA4, 0xCE, 0xB4,
+    0xC6, 0x21, 0x80, 0x09, 0x61, 0xE2, 0x66, 0x4F, 0x10, 0x1C, 0x22, 0x1C, 0x68, 0x51, 0xE5, 0x8C,
+    0x35, 0xDB, 0x73, 0x10, 0x24, 0xDF, 0x29, 0x08, 0x3B, 0x2F, 0x18, 0xB2, 0x02, 0x82, 0x3C, 0xEE,
+    0x20, 0xB0, 0x45, 0xBD, 0xB0, 0x92, 0xBB, 0x64, 0xDA, 0xFB, 0xA1, 0x8E, 0xD5, 0x83, 0x98, 0x83,
+    0x5A, 0xA7, 0x3F, 0x0E, 0x9F, 0x81, 0xE2, 0xB5, 0x78, 0x76, 0xD0, 0x21, 0x7D, 0x5F, 0x0A, 0x49,
+    0x03, 0x89, 0x29, 0x00, 0x91, 0xE5, 0xD5, 0x57, 0xC8, 0x28, 0x18, 0x58, 0x2B, 0x7C, 0xA1, 0xA7,
+    0x48, 0x3D, 0x86, 0x5B, 0x09, 0xF9, 0x54, 0x84, 0x4E, 0x3D, 0xE5, 0x81, 0xF1, 0x52, 0xB3, 0xEF,
+    0xC1, 0x43, 0x62, 0x15, 0xAC, 0x83, 0x5E, 0xE6, 0xA0, 0x0B, 0xA4, 0x93, 0x3A, 0x9C, 0x1C, 0xB7,
+    0x00, 0x3B, 0xEA, 0x56, 0xAC, 0xC1, 0x63, 0x58, 0xB7, 0x8C, 0xC6, 0x12, 0x9C, 0xE8, 0xBF, 0x90,
+    0x97, 0x65, 0x59, 0x7F, 0xE6, 0xFB, 0xD3, 0x73, 0x2E, 0xFE, 0x9E, 0x12, 0x5E, 0x28, 0x33, 0x7D,
+    0x84, 0x7C, 0xF3, 0x01, 0x14, 0x13, 0x1B, 0xAA, 0x4D, 0x86, 0x8F, 0x10, 0x4B, 0xB6, 0x15, 0x3C,
+    0x7C, 0x76, 0x95, 0xF4, 0x64, 0x40, 0x6A, 0x66, 0x3A, 0x54, 0x97, 0xB3, 0x8F, 0xD4, 0xD3, 0xB6,
+    0xFB, 0xAB, 0x76, 0x9E, 0x20, 0x00, 0xC8, 0x5B, 0x40, 0x0D, 0x2F, 0xA6, 0xF0, 0xED, 0x2B, 0x5E,
+    0x4B, 0x74, 0xDD, 0x12, 0x46, 0x5F, 0xEF, 0x38, 0xC7, 0xE6, 0xAF, 0x21, 0xBC, 0x2C, 0xEB, 0xCB,
+    0xF2, 0xC8, 0x23, 0xA6, 0x7A, 0x3D, 0xFF, 0x8D, 0x88, 0x16, 0xE0, 0x2C, 0x71, 0xBD, 0xA8, 0x95,
+    0xA0, 0x47, 0x0A, 0x80, 0x2C, 0x66, 0x91, 0x65, 0x0B, 0x38, 0x1B, 0x3C, 0x8E, 0xAF, 0x2B, 0xBE,
+    0x2D, 0x0F, 0x27, 0xFC, 0x8E, 0xF4, 0xF7, 0xF1, 0x5B, 0x45, 0xDE, 0x55, 0xC2, 0xA6, 0x2E, 0xEE,
+    0xAA, 0xE4, 0x5E, 0x1C, 0x2C, 0x6A, 0xBE, 0xEE, 0x84, 0xDF, 0x04, 0xF4, 0x30, 0x77, 0x2F, 0x4A,
+    0x9F, 0x21, 0xA7, 0x2F, 0x0B, 0x90, 0xAC, 0x6C, 0xF6, 0x71, 0x76, 0x96, 0x2D, 0xA5, 0x42, 0xD4,
+    0x53, 0xC1, 0xB8, 0xB9, 0xFF, 0xA4, 0xCE, 0x97, 0xEF, 0x43, 0x32, 0xF4, 0x0A, 0x68, 0x36, 0x53,
+    0xA9, 0x0D, 0x3D, 0x74, 0xF4, 0x70, 0x21, 0xC7, 0x2C, 0xB5, 0xAB, 0xF6, 0xFE, 0x0B, 0x67, 0xE7,
+    0x8E, 0xE7, 0x5B, 0xDE, 0x53, 0xEC, 0x5B, 0x04, 0x91, 0x9E, 0x31, 0x08, 0x6B, 0xE9, 0x08, 0x1F,
+    0x48, 0xD3, 0x51, 0x3B, 0x69, 0xA9, 0x9D, 0x3A, 0xEB, 0xF1, 0xA2, 0x76, 0x45, 0x76, 0xD8, 0x79,
+    0x76, 0x43, 0x76, 0x4E, 0x27, 0x71, 0x0F, 0x27, 0xA5, 0x3A, 0x3A, 0xE9, 0xE9, 0xE4, 0x66, 0x7E,
+    0xA4, 0xBE, 0x40, 0x9E, 0x9B, 0xAB, 0x72, 0x07, 0x50, 0x4D, 0x40, 0x4E, 0xD7, 0x15, 0x0E, 0xAD,
+    0xD0, 0x25, 0xC1, 0x1F, 0x31, 0x2B, 0xCC, 0xD5, 0xE6, 0x1F, 0xFB, 0x00, 0xFC, 0xB8, 0x5F, 0x95,
+    0x75, 0x0B, 0xDD, 0xA2, 0x46, 0xA6, 0x18, 0xBF, 0x00, 0xAD, 0x95, 0xBF, 0x8F, 0xDC, 0x44, 0x14,
+    0xC7, 0x9F, 0x6D, 0xE5, 0x2C, 0xB1, 0xC5, 0x34, 0xA9, 0x48, 0xE1, 0x3E, 0x8D, 0xFF, 0x02, 0x3C,
+    0x06, 0xFE, 0x00, 0x52, 0xB0, 0x44, 0x22, 0xC5, 0xB5, 0x48, 0x14, 0xF7, 0x0F, 0xE4, 0xCE, 0x96,
+    0xEE, 0x0F, 0x08, 0x0D, 0x7D, 0x1A, 0x1A, 0x37, 0xD7, 0x50, 0x5E, 0x6E, 0x4D, 0x52, 0x50, 0x50,
+    0xAC, 0xA5, 0x14, 0x94, 0x31, 0x4A, 0x56, 0x48, 0x34, 0x38, 0xDC, 0x8A, 0x78, 0xD1, 0xD8, 0xC3,
+    0xE7, 0xCD, 0x6E, 0x0E, 0x09, 0x21, 0x14, 0x21, 0x2C, 0xCF, 0xF3, 0xF8, 0xCD, 0x9B, 0x79, 0xBF,
+    0xBE, 0xEF, 0x8D, 0x08, 0xCF, 0x1D, 0x3F, 0x4A, 0xEA, 0xFD, 0x2C, 0x66, 0xF7, 0xA5, 0x97, 0xDB,
+    0x12, 0x7B, 0x98, 0xD1, 0xAC, 0x64, 0x82, 0xC4, 0x23, 0x24, 0x1D, 0x20, 0xA6, 0x83, 0xD8, 0xF2,
+    0x6E, 0xD3, 0xCC, 0x91, 0xF7, 0x7E, 0x64, 0x93, 0xEF, 0x61, 0xE5, 0x25, 0xE4, 0x09, 0x23, 0x09,
+    0x52, 0x2D, 0xE4, 0xEA, 0xED, 0x9F, 0xAD, 0xD9, 0xEC, 0xD2, 0xCD, 0x67, 0xBE, 0xCD, 0xD8, 0x22,
+    0xB9, 0x9F, 0x91, 0x5E, 0xCA, 0xCD, 0x93, 0x8B, 0x1C, 0xF9, 0x9D, 0xEE, 0x32, 0x9C, 0xC6, 0x9E,
+    0x6C, 0xC6, 0x0A, 0x27, 0x86, 0xD9, 0x60, 0xC5, 0xA0, 0x60, 0x36, 0xAD, 0xEA, 0xCF, 0x9E, 0x0D,
+    0xF1, 0x96, 0x63, 0xB7, 0x8E, 0x65, 0x91, 0xCA, 0x4A, 0xA5, 0xEA, 0xD6, 0x6D, 0x86, 0x8E, 0xE4,
+    0x7A, 0xBE, 0x50, 0x5B, 0x9C, 0x2A, 0x41, 0x6D, 0xE5, 0xD5, 0x01, 0xF3, 0xA2, 0xCD, 0xC3, 0xE2,
+    0x90, 0x86, 0x45, 0x17, 0xE9, 0x4E, 0x6B, 0xC5, 0xF2, 0xC9, 0xD6, 0xAD, 0x7A, 0x64, 0x5E, 0x0E,
+    0xCA, 0x4D, 0x07, 0xA7, 0xC6, 0x26, 0xA3, 0x95, 0x74, 0x94, 0xC4, 0x61, 0x50, 0xB5, 0x79, 0xE0,
+    0x30, 0x08, 0x37, 0x83, 0xC6, 0xDC, 0x6F, 0x83, 0xC5, 0xB7, 0x94, 0x1C, 0xAD, 0x7C, 0xBB, 0x60,
+    0x21, 0x21, 0x06, 0xAD, 0x2F, 0xC5, 0x65, 0x38, 0xF0, 0x14, 0xD5, 0x8E, 0x68, 0x98, 0xA7, 0x5B,
+    0x9D, 0xD4, 0x62, 0xBE, 0x63, 0x9F, 0xC3, 0x15, 0xD3, 0xDA, 0xCD, 0xD2, 0x89, 0x0A, 0x47, 0x7A,
+    0x9C, 0xD9, 0x1C, 0xB7, 0xB1, 0x9E, 0x8A, 0x87, 0x2D, 0x3E, 0xAA, 0x61, 0xC8, 0x70, 0xCE, 0xA2,
+    0x3F, 0xEC, 0xE2, 0xC7, 0xFC, 0x80, 0xD5, 0x6A, 0x31, 0x36, 0x8C, 0x6C, 0x9E, 0xE2, 0xDD, 0x7D,
+    0xB7, 0xCF, 0x88, 0xFA, 0xA3, 0x91, 0xB6, 0xF2, 0xFE, 0xCA, 0x61, 0xC8, 0xE0, 0x37, 0xC7, 0xEB,
+    0x1E, 0xBF, 0x45, 0x26, 0xD2, 0xF9, 0xA6, 0x97, 0xFC, 0x05, 0xAA, 0x6C, 0x9D, 0xBB, 0xCA, 0xFF,
+    0x36, 0x54, 0x73, 0xDA, 0x06, 0xBB, 0xE5, 0x73, 0x91, 0x85, 0x27, 0xB6, 0xDE, 0xF3, 0xFD, 0x66,
+    0x9F, 0x67, 0x8D, 0xC6, 0x42, 0xD3, 0xA6, 0xA1, 0xCB, 0xC8, 0x4E, 0xFC, 0x9A, 0xF0, 0xD9, 0x95,
+    0xBA, 0x57, 0x92, 0x85, 0x56, 0xEC, 0xC7, 0xA3, 0x44, 0x0E, 0x39, 0xF3, 0x6C, 0x50, 0xDB, 0x98,
+    0x3C, 0x67, 0x32, 0xDD, 0x70, 0xF0, 0x3A, 0x6B, 0x1D, 0xC9, 0xC1, 0xFE, 0x4A, 0x6C, 0x77, 0xD2,
+    0x61, 0xEF, 0x16, 0x2C, 0xE9, 0x91, 0xF7, 0x50, 0x41, 0x8E, 0xAD, 0xF7, 0x9D, 0x6D, 0x2E, 0xC8,
+    0xAA, 0x46, 0x39, 0x3A, 0x8C, 0x64, 0x0B, 0xAF, 0xB3, 0xAA, 0x10, 0x00, 0x68, 0xF4, 0xED, 0x5E,
+    0xC3, 0xB4, 0xFF, 0xA2, 0x76, 0x79, 0x32, 0x86, 0xB5, 0xBD, 0x8C, 0xBE, 0x4D, 0x63, 0x83, 0xD9,
+    0xEF, 0xF8, 0xEA, 0xB6, 0xF6, 0x40, 0x9A, 0x8B, 0x56, 0x0A, 0x75, 0xF7, 0x2F, 0xF2, 0xC1, 0x0D,
+    0x39, 0x55, 0xF2, 0x50, 0xC9, 0xA5, 0x12, 0xA7, 0x64, 0x84, 0x00, 0xBC, 0x45, 0x0B, 0x16, 0x16,
+    0xED, 0xF1, 0x66, 0x79, 0xBC, 0x59, 0x91, 0x48, 0x1F, 0xC8, 0xA5, 0x1E, 0xFE, 0x37, 0xF2, 0x05,
+    0xE4, 0xEE, 0x1E, 0xDC, 0xB3, 0x90, 0xEE, 0x2E, 0xDD, 0xDD, 0xD9, 0x9A, 0x2E, 0x52, 0x44, 0xA8,
+    0x53, 0x67, 0x8C, 0xAA, 0x6A, 0x1A, 0x5F, 0x71, 0x00, 0xDF, 0xE6, 0xEC, 0x90, 0x03, 0x1D, 0x8A,
+    0x57, 0x05, 0x7D, 0x3A, 0x45, 0x97, 0x01, 0x2A, 0xB9, 0x7F, 0x25, 0xF2, 0x29, 0x6B, 0xF1, 0x20,
+    0xF9, 0x87, 0x23, 0x93, 0xB4, 0x5F, 0x74, 0xD8, 0xA2, 0xE0, 0xB1, 0x14, 0x5F, 0x34, 0x26, 0x0A,
+    0xEF, 0x45, 0x67, 0x15, 0x2B, 0x36, 0x19, 0xC8, 0x45, 0xB4, 0xAB, 0x1E, 0xF4, 0x9A, 0x69, 0xAF,
+    0xF0, 0x41, 0x0D, 0x40, 0xCF, 0xCF, 0x87, 0x4A, 0x71, 0x6E, 0x15, 0x3F, 0x00, 0x1B, 0xF0, 0xE7,
+    0xB5, 0x1E, 0x91, 0x0E, 0xC9, 0x00, 0x2F, 0x80, 0xB1, 0xCB, 0x6B, 0x8E, 0xAE, 0xA8, 0x37, 0xBB,
+    0xAF, 0xFC, 0x68, 0xE5, 0x4B, 0xEC, 0x4C, 0x36, 0x77, 0xF8, 0x03, 0xE4, 0xAA, 0x03, 0xE0, 0xC5,
+    0x63, 0xDC, 0xCC, 0x52, 0xF9, 0x32, 0xD1, 0x42, 0x03, 0xCA, 0xE8, 0xC7, 0xB3, 0x3D, 0x30, 0xA7,
+    0x9D, 0x54, 0x6B, 0xD2, 0x5F, 0x91, 0xFD, 0x5B, 0xF7, 0x88, 0xB1, 0xCC, 0x05, 0x50, 0x28, 0x24,
+    0x61, 0x2C, 0x18, 0x59, 0x55, 0x50, 0x85, 0x85, 0x3C, 0x64, 0x8C, 0xB6, 0x88, 0x07, 0x5B, 0xA4,
+    0x9D, 0x2D, 0xA8, 0x80, 0x22, 0x2B, 0x6D, 0xC1, 0x62, 0x71, 0x89, 0x00, 0xCE, 0x5A, 0x0C, 0xB1,
+    0x1D, 0x83, 0xCC, 0x45, 0x8F, 0xE3, 0xAF, 0xE2, 0x21, 0xED, 0x64, 0xC2, 0x8E, 0x8A, 0x2E, 0xF5,
+    0xDE, 0xAB, 0x9B, 0x36, 0xF2, 0x7F, 0xE9, 0x28, 0xF6, 0x98, 0x04, 0xA3, 0x1A, 0xCF, 0x2C, 0xC4,
+    0xC7, 0xCA, 0x84, 0x72, 0x04, 0xEF, 0x23, 0x48, 0x24, 0x2D, 0x5D, 0xCF, 0x26, 0x5B, 0x78, 0x1A,
+    0xB2, 0x2B, 0x95, 0x28, 0x91, 0x6D, 0xD9, 0xD3, 0x07, 0x3C, 0x83, 0x59, 0xEC, 0xF3, 0x35, 0x45,
+    0xD6, 0xA7, 0xBF, 0x34, 0x23, 0x99, 0x2B, 0x00, 0x94, 0xA9, 0x73, 0x49, 0x7A, 0x45, 0x54, 0xA2,
+    0x0C, 0x2A, 0x9E, 0xE3, 0x93, 0xDE, 0xD4, 0x30, 0x7A, 0x18, 0x5B, 0x18, 0xA7, 0x30, 0x80, 0xC1,
+    0x1F, 0x27, 0x40, 0x13, 0x55, 0x66, 0xD5, 0xC1, 0x50, 0x07, 0x31, 0x4E, 0xAA, 0x47, 0xF4, 0x95,
+    0xFC, 0x1A, 0xCF, 0x8D, 0x03, 0xCA, 0x78, 0x49, 0xA7, 0xFA, 0x75, 0x7D, 0x21, 0xD1, 0x9B, 0xEB,
+    0x9F, 0x3B, 0xDA, 0xDB, 0xE8, 0xE4, 0x54, 0xDD, 0xCB, 0xCD, 0xFA, 0xBC, 0x37, 0xE7, 0xD7, 0xFD,
+    0xE5, 0xA2, 0x75, 0xA3, 0x39, 0xEF, 0x6D, 0x91, 0xBC, 0xDE, 0x9A, 0x75, 0x7D, 0xEA, 0x92, 0xEB,
+    0xDE, 0x4C, 0xE2, 0x46, 0xBA, 0x3C, 0xCE, 0xDA, 0x1A, 0xA6, 0x22, 0xBB, 0xD8, 0xC3, 0xF2, 0x9F,
+    0xC7, 0x72, 0x79, 0x45, 0xED, 0xCC, 0x61, 0xFC, 0x9B, 0x5C, 0x00, 0x80, 0x5E, 0x19, 0x54, 0x3E,
+    0xD8, 0x05, 0x47, 0x5F, 0x57, 0xDA, 0x63, 0x57, 0x20, 0x49, 0xC3, 0x22, 0xD9, 0xB9, 0xF6, 0x0A,
+    0x50, 0x68, 0xBE, 0xD7, 0xCE, 0x76, 0xA6, 0x93, 0xB7, 0xFD, 0x84, 0x36, 0x12, 0x2A, 0xC4, 0x96,
+    0x93, 0x2C, 0x86, 0x74, 0x77, 0x34, 0x69, 0x93, 0x2A, 0xC1, 0x7F, 0x1D, 0x7A, 0x2E, 0xDA, 0xA7,
+    0x30, 0x9A, 0x46, 0x8B, 0xE8, 0xC9, 0x7F, 0x1D, 0x6A, 0xA0, 0xF9, 0x88, 0xAB, 0xE6, 0x47, 0x5A,
+    0xA0, 0xDF, 0x9C, 0x0C, 0xA4, 0x7E, 0xA6, 0xE2, 0xB8, 0x5E, 0xC2, 0xDD, 0x12, 0xA4, 0xB2, 0x47,
+    0xAD, 0xA4, 0x2F, 0xB1, 0x88, 0x88, 0x06, 0xC7, 0xF2, 0x4F, 0xE8, 0xEF, 0xCF, 0xE9, 0xAC, 0x83,
+    0xD7, 0xEE, 0x35, 0xA6, 0xCE, 0x5C, 0xD0, 0x1E, 0x7F, 0x02, 0xE1, 0x2E, 0x2A, 0x43, 0xE5, 0x6A,
+    0x3B, 0x0E, 0x77, 0x9E, 0x3B, 0x94, 0xF2, 0x0D, 0x23, 0x3C, 0xAB, 0xB9, 0xC4, 0x9F, 0xC8, 0x2F,
+    0xBF, 0xD5, 0xF2, 0x5E, 0xED, 0x97, 0x54, 0x84, 0x28, 0x44, 0x87, 0x8E, 0xAE, 0x37, 0x99, 0xDD,
+    0x9F, 0xA0, 0xC5, 0x07, 0xC6, 0x64, 0xB1, 0x8B, 0x1E, 0x53, 0xC6, 0xF5, 0x91, 0xE7, 0x32, 0xBE,
+    0xAD, 0xB0, 0x9A, 0x29, 0xE7, 0xDF, 0x9B, 0xB9, 0xA9, 0x81, 0x55, 0x68, 0xDB, 0x5C, 0xA1, 0xA0,
+    0x4B, 0xDE, 0xFD, 0xF7, 0xE6, 0xF9, 0x13, 0xB5, 0x55, 0x31, 0x8F, 0xDC, 0x54, 0x10, 0x1E, 0xDB,
+    0xBA, 0xDB, 0xC2, 0xC5, 0x6B, 0x10, 0x3A, 0x91, 0xC2, 0x35, 0x95, 0xFF, 0x40, 0xB2, 0xCF, 0xFC,
+    0x82, 0x5C, 0x11, 0x27, 0x05, 0x05, 0x35, 0xA4, 0x70, 0x4B, 0x73, 0xFB, 0x2C, 0xA5, 0x4C, 0x43,
+    0xC1, 0xD5, 0xA4, 0x41, 0x42, 0x4B, 0x41, 0x43, 0x83, 0x14, 0xEF, 0x5A, 0xBA, 0xE2, 0x4A, 0x2C,
+    0xC8, 0x55, 0x34, 0x96, 0x82, 0x44, 0x6B, 0x14, 0x9F, 0xF0, 0x72, 0xF6, 0x4D, 0xBE, 0xEF, 0xED,
+    0x6E, 0x02, 0x11, 0x90, 0x44, 0x22, 0xDE, 0x7D, 0xE3, 0xF7, 0xC6, 0xE3, 0xEF, 0xCD, 0xCC, 0xFB,
+    0x66, 0x5C, 0x89, 0x24, 0x5F, 0x95, 0x12, 0xFF, 0xDC, 0x49, 0xD4, 0x55, 0x12, 0x0C, 0x49, 0x2D,
+    0x53, 0xD4, 0x89, 0x95, 0x85, 0x24, 0xA5, 0xA9, 0x4D, 0x1D, 0xF6, 0x58, 0xCE, 0xC3, 0x5E, 0x4C,
+    0x3D, 0x4A, 0xD0, 0x2F, 0x44, 0x6C, 0x9A, 0x49, 0xFC, 0x63, 0x2D, 0x72, 0xD5, 0x62, 0xD1, 0x89,
+    0xCC, 0x46, 0x11, 0x99, 0x30, 0x2C, 0x46, 0x52, 0x0A, 0x4C, 0xA1, 0xE4, 0x83, 0x5E, 0x82, 0xEF,
+    0x06, 0x91, 0x35, 0x0C, 0x92, 0x5E, 0x78, 0x1D, 0x78, 0x39, 0x50, 0x98, 0xF2, 0x5F, 0xA7, 0x01,
+    0x11, 0x63, 0xBD, 0xC6, 0x46, 0xAA, 0x9A, 0x45, 0xFA, 0xC9, 0x2F, 0x93, 0xAC, 0xB3, 0x21, 0xEE,
+    0x93, 0xDA, 0x94, 0xE9, 0x59, 0x0F, 0xDB, 0xC9, 0xC2, 0x36, 0xFE, 0xAD, 0xC3, 0xD4, 0x2D, 0x30,
+    0x8D, 0xFE, 0x68, 0x31, 0xB5, 0x8E, 0xD3, 0x67, 0xD4, 0x2E, 0x6C, 0x66, 0x4A, 0xF3, 0xD3, 0x28,
+    0x43, 0x30, 0x9A, 0xD6, 0x94, 0xAE, 0xB4, 0xCD, 0x50, 0xB4, 0x02, 0xC4, 0x41, 0x02, 0xD5, 0x0D,
+    0xF6, 0x28, 0x9E, 0xBC, 0x89, 0x3B, 0x9C, 0x22, 0x36, 0x8B, 0x98, 0x6C, 0xB6, 0x92, 0xD4, 0x27,
+    0x06, 0xA0, 0x8D, 0xA4, 0x0F, 0x5B, 0x89, 0xAE, 0xBA, 0x6D, 0x1E, 0x62, 0x98, 0x85, 0xD7, 0xF0,
+    0x5E, 0x1B, 0xE4, 0x03, 0x21, 0x4C, 0xC8, 0xE6, 0x2A, 0x84, 0x53, 0x78, 0xCD, 0x66, 0xB3, 0x2E,
+    0x2D, 0x65, 0x05, 0x95, 0x69, 0xE6, 0x22, 0x27, 0x32, 0x8A, 0xCF, 0x6D, 0xDC, 0x20, 0x5D, 0x69,
+    0x06, 0xFC, 0xEA, 0xAD, 0x55, 0x17, 0xB9, 0xFB, 0xD2, 0x22, 0x9E, 0x0E, 0x43, 0x91, 0x74, 0x49,
+    0xE9, 0xED, 0x63, 0x8C, 0xB0, 0x63, 0x06, 0xA9, 0xFA, 0x00, 0xF6, 0x02, 0x17, 0x23, 0x18, 0x18,
+    0x85, 0xA7, 0x58, 0xEA, 0x5F, 0x96, 0x6B, 0x64, 0x5B, 0x97, 0xEB, 0xDF, 0x89, 0x50, 0x6C, 0x78,
+    0x84, 0x30, 0x00, 0xBC, 0x3F, 0xC5, 0x17, 0xCB, 0x39, 0xCE, 0x5E, 0xCC, 0x79, 0x0B, 0x1F, 0x64,
+    0x5C, 0x48, 0xF8, 0xFF, 0x2F, 0x2E, 0x73, 0x77, 0x9A, 0x8F, 0x8E, 0x91, 0xE8, 0xB9, 0x97, 0xE3,
+    0xDC, 0x3F, 0x29, 0xAD, 0xBF, 0xD5, 0xEF, 0xF2, 0x96, 0xDF, 0xDB, 0xE4, 0xC5, 0x13, 0xEB, 0xB7,
+    0xBD, 0xDE, 0xDD, 0x3C, 0x53, 0x65, 0xFE, 0x1F, 0xB7, 0x0F, 0x9D, 0x66, 0x60, 0x37, 0xC5, 0x67,
+    0xEB, 0x8C, 0xE9, 0x7F, 0x45, 0x9C, 0x42, 0xA6, 0x20, 0x30, 0x45, 0x07, 0xDD, 0x8D, 0x01, 0x02,
+    0xE4, 0x66, 0xD8, 0x14, 0xD3, 0x7E, 0x16, 0x42, 0x9C, 0x16, 0x3D, 0xED, 0x40, 0x2A, 0x9D, 0xFC,
+    0x0E, 0xC9, 0x6D, 0xD6, 0x11, 0x4A, 0x13, 0xB9, 0x67, 0x41, 0x9C, 0xD8, 0x97, 0xCA, 0xCB, 0x3B,
+    0x50, 0x92, 0xC8, 0x27, 0xF0, 0xB6, 0x81, 0x72, 0x36, 0xD2, 0xD2, 0x7E, 0x04, 0xCB, 0xB8, 0x85,
+    0x25, 0x4A, 0x19, 0x96, 0x15, 0x95, 0x2E, 0xE8, 0xA7, 0xBB, 0x5A, 0xD2, 0xB2, 0x4C, 0x6E, 0x23,
+    0xB0, 0x19, 0x09, 0xF8, 0x4F, 0xC7, 0x7C, 0x79, 0x0C, 0x4E, 0x68, 0x49, 0xC8, 0x51, 0xDC, 0x19,
+    0xF0, 0x80, 0xB1, 0x20, 0x18, 0x50, 0x9F, 0x62, 0x69, 0x2E, 0xEE, 0x0F, 0x84, 0x51, 0xFD, 0x95,
+    0x09, 0x08, 0xE1, 0xA9, 0xD3, 0x21, 0x3A, 0x2D, 0x58, 0x02, 0xA5, 0x07, 0x89, 0x41, 0xFE, 0xC5,
+    0x41, 0xFE, 0x31, 0x39, 0x69, 0x18, 0x36, 0xD1, 0x67, 0x2D, 0x89, 0xCB, 0xBD, 0xA2, 0xE1, 0xEB,
+    0x43, 0x45, 0x55, 0xD7, 0x0E, 0x91, 0x1E, 0x64, 0xB2, 0x4F, 0x68, 0xA0, 0xAC, 0x13, 0xBC, 0xC0,
+    0x6A, 0xB9, 0x70, 0x38, 0x99, 0x15, 0x02, 0xB1, 0x40, 0x8C, 0x3A, 0x1B, 0xA0, 0x60, 0x07, 0x8B,
+    0xA3, 0x92, 0xD1, 0xDE, 0xF3, 0x92, 0xB8, 0x7B, 0x19, 0x79, 0xCD, 0xF6, 0xE9, 0xD6, 0x92, 0x6F,
+    0xF5, 0x44, 0x98, 0x75, 0x40, 0x6B, 0x8A, 0xDA, 0x23, 0xA3, 0x7A, 0x42, 0x1D, 0xF6, 0x5D, 0xA8,
+    0xD0, 0x69, 0xA6, 0x3A, 0x99, 0x3F, 0x97, 0x53, 0x8A, 0x44, 0xB1, 0xB2, 0xF6, 0x03, 0x75, 0x5A,
+    0x99, 0x4D, 0x5E, 0xF1, 0x39, 0x8E, 0x17, 0x31, 0xC2, 0xF9, 0x49, 0x2A, 0x94, 0x72, 0x85, 0x1E,
+    0x50, 0x19, 0xDA, 0xC3, 0xC6, 0x31, 0xA8, 0x4F, 0xD9, 0xF8, 0xB2, 0x5D, 0xD3, 0x6B, 0x79, 0x56,
+    0x50, 0x7C, 0x2E, 0x2F, 0xAE, 0xF4, 0x9A, 0xCD, 0xA6, 0x99, 0x6D, 0x6E, 0xF4, 0xA6, 0x09, 0x46,
+    0x60, 0xA3, 0x73, 0x31, 0xA9, 0xE2, 0xDC, 0x72, 0xA9, 0x24, 0x3C, 0xEE, 0xCB, 0xC5, 0xAE, 0x7F,
+    0x72, 0xA4, 0xEC, 0xA1, 0x80, 0x9A, 0x4D, 0xC1, 0x63, 0xBC, 0x0B, 0x6E, 0x30, 0xDD, 0x77, 0xB6,
+    0x78, 0x23, 0xAA, 0x7A, 0xC4, 0x66, 0xA3, 0xAF, 0xEE, 0x77, 0xB2, 0x4F, 0x70, 0xBC, 0x33, 0x20,
+    0x3F, 0x0E, 0xD7, 0xCB, 0x47, 0xEC, 0x99, 0x6C, 0xC5, 0x9D, 0xD7, 0xEC, 0x1E, 0xBD, 0x7F, 0x2C,
+    0x36, 0xD1, 0x26, 0xBA, 0x22, 0x63, 0xFA, 0x70, 0x8C, 0xC8, 0x3C, 0xA4, 0xC5, 0x46, 0x34, 0x63,
+    0xBF, 0x7C, 0xAB, 0xC9, 0x6E, 0xBB, 0xBF, 0x4F, 0xE2, 0x56, 0x82, 0x6F, 0xF9, 0xF5, 0x50, 0xB8,
+    0xAA, 0x5F, 0x88, 0x7C, 0x23, 0x28, 0x15, 0x9C, 0x01, 0xBB, 0xA1, 0xC8, 0xCD, 0x5D, 0xEC, 0xA0,
+    0x24, 0xFF, 0xCB, 0xE5, 0x16, 0xE8, 0x0D, 0xFF, 0xFE, 0x42, 0xF5, 0x26, 0xAA, 0x81, 0xE6, 0xDF,
+    0x33, 0x13, 0xAB, 0x97, 0x35, 0xE1, 0xF2, 0x1C, 0x39, 0x21, 0x47, 0x7A, 0x7E, 0xD3, 0x76, 0x25,
+    0x02, 0x0A, 0x08, 0xF9, 0x16, 0x6F, 0x82, 0x47, 0x48, 0x48, 0x79, 0x08, 0x76, 0xC8, 0x7B, 0xDB,
+    0x03, 0x40, 0x1D, 0xAA, 0x3E, 0xD8, 0xDC, 0xC5, 0x87, 0xD4, 0xB7, 0x5E, 0x82, 0xC1, 0x3C, 0xC1,
+    0x87, 0xC6, 0xC1, 0xAA, 0xC0, 0x48, 0xF1, 0x2A, 0xD8, 0xE6, 0xEB, 0x84, 0xB7, 0x1F, 0xC4, 0x3D,
+    0x44, 0x5A, 0x53, 0xED, 0xE5, 0xE0, 0x58, 0x8E, 0x92, 0xF3, 0xCE, 0xF3, 0x73, 0xB0, 0xE6, 0xAC,
+    0x1B, 0x5F, 0x15, 0x72, 0x74, 0x34, 0x9F, 0x5B, 0x7B, 0xEB, 0xD6, 0xD6, 0xF3, 0xA8, 0x7D, 0xFD,
+    0x4F, 0x5E, 0x73, 0x3D, 0x07, 0xBD, 0x55, 0xB1, 0x92, 0xDC, 0x44, 0x10, 0x6D, 0x49, 0x55, 0xA7,
+    0x40, 0xC1, 0x44, 0x50, 0x94, 0x09, 0xF4, 0x09, 0xFA, 0x02, 0x34, 0xAA, 0x22, 0x24, 0xF0, 0x05,
+    0x6C, 0x39, 0x74, 0x40, 0x46, 0x72, 0x3F, 0x80, 0x77, 0x95, 0x51, 0x05, 0x01, 0x4E, 0x2E, 0x72,
+    0xE2, 0x80, 0x04, 0x5D, 0x4A, 0xB8, 0x7B, 0x2B, 0xFB, 0x02, 0x52, 0xB9, 0x1C, 0x90, 0xAA, 0x70,
+    0x00, 0x75, 0x89, 0xA7, 0x0A, 0xD9, 0xA5, 0xC3, 0x23, 0x0D, 0xEF, 0xB5, 0xF6, 0xEE, 0x0C, 0x76,
+    0x00, 0x04, 0xEC, 0xD6, 0xCC, 0x48, 0x33, 0x3D, 0xDD, 0xAF, 0xFB, 0x75, 0xB7, 0xE4, 0x23, 0xC9,
+    0xDB, 0xD4, 0xC9, 0x28, 0x87, 0xDF, 0x28, 0x56, 0x4C, 0x9B, 0x38, 0xF1, 0xFF, 0xE8, 0xA1, 0x94,
+    0xE2, 0x9B, 0x93, 0x8B, 0xD0, 0xEF, 0x3B, 0x91, 0x4D, 0x08, 0x95, 0xDC, 0x2C, 0xEB, 0x66, 0xCF,
+    0x65, 0x2B, 0xC5, 0x7B, 0x97, 0x53, 0xAC, 0x5E, 0x0A, 0xCA, 0xEA, 0xD2, 0x73, 0xA9, 0x3E, 0x1E,
+    0x01, 0xA0, 0xA8, 0x22, 0xAF, 0x0B, 0xB6, 0x06, 0x5D, 0xA2, 0x65, 0x81, 0xC5, 0xA2, 0x8A, 0xC7,
+    0x47, 0x58, 0x4E, 0x4F, 0x5C, 0xE8, 0x78, 0xAF, 0x83, 0x82, 0x22, 0x5C, 0x5D, 0xC3, 0x2F, 0x45,
+    0x1E, 0x08, 0x35, 0xC7, 0x83, 0x08, 0xE4, 0x33, 0xE0, 0x32, 0xAD, 0x5A, 0xB5, 0x22, 0xBB, 0x77,
+    0x8E, 0x02, 0x7E, 0x57, 0x62, 0xB9, 0x84, 0x6A, 0x6E, 0xCE, 0xFE, 0x68, 0xC2, 0xA7, 0x7A, 0xB4,
+    0x5F, 0x6E, 0x79, 0xBD, 0x95, 0x38, 0xBD, 0x65, 0x2E, 0x6E, 0x8F, 0x4E, 0x4F, 0x06, 0x1C, 0xED,
+    0x71, 0x0B, 0x47, 0x80, 0x21, 0xD1, 0xB1, 0xA8, 0x0D, 0xAA, 0x96, 0xA3, 0x7D, 0xF3, 0xBD, 0x40,
+    0x65, 0x9D, 0x85, 0x30, 0xEA, 0xCE, 0xE1, 0xE8, 0xC3, 0x63, 0xB1, 0x79, 0xE8, 0x93, 0x37, 0x38,
+    0xB3, 0x43, 0x3C, 0x25, 0x5E, 0xB2, 0xDE, 0xD6, 0x62, 0x21, 0x93, 0x38, 0xC8, 0xFC, 0xBB, 0x07,
+    0x91, 0x3B, 0x35, 0x16, 0x78, 0x37, 0x89, 0x44, 0xF4, 0x0B, 0x4E, 0x65, 0x95, 0xDC, 0x86, 0x23,
+    0x1A, 0xAD, 0xCA, 0x66, 0x9D, 0x95, 0xBC, 0xB6, 0xC2, 0xFF, 0x24, 0x36, 0x02, 0xCF, 0xF7, 0x1C,
+    0x1C, 0xEF, 0x30, 0x7A, 0x68, 0x1C, 0xB0, 0x47, 0x5E, 0xCF, 0x29, 0x51, 0x41, 0xB6, 0xB5, 0x44,
+    0x26, 0x09, 0xDC, 0xC4, 0xC1, 0x0F, 0x24, 0x16, 0x23, 0x6F, 0x45, 0x52, 0xD8, 0x88, 0xE9, 0xD2,
+    0x8F, 0x6F, 0xD9, 0x91, 0xB9, 0x44, 0x1C, 0x4A, 0x49, 0x30, 0x32, 0x8C, 0x7C, 0x53, 0x8A, 0xB5,
+    0xA5, 0x7C, 0x85, 0x31, 0xDA, 0x32, 0x76, 0xB6, 0x4C, 0x3B, 0x5B, 0x9A, 0xD6, 0x96, 0x79, 0x65,
+    0x4B, 0x1C, 0x96, 0x5B, 0x08, 0x00, 0x86, 0x05, 0x0C, 0x0B, 0x18, 0xB6, 0x05, 0x84, 0xC7, 0xF1,
+    0x43, 0xF9, 0x04, 0xE4, 0x9B, 0x67, 0x5E, 0x24, 0xC0, 0xA9, 0xA3, 0xDF, 0x6E, 0x8C, 0x90, 0xB7,
+    0xF5, 0x5A, 0xA4, 0xB8, 0xDB, 0x8A, 0x79, 0x3A, 0x48, 0xDA, 0x6F, 0x00, 0x0F, 0x64, 0x78, 0x78,
+    0xB3, 0x56, 0xCF, 0xB2, 0x0E, 0xAF, 0x23, 0x38, 0x62, 0x88, 0xD2, 0x67, 0xC8, 0x6A, 0x0F, 0xCE,
+    0x0B, 0xC4, 0x29, 0x79, 0x89, 0x40, 0x05, 0xA0, 0xCF, 0x81, 0x1C, 0xDE, 0x32, 0x11, 0xA0, 0xEE,
+    0x40, 0x0C, 0xDD, 0xCA, 0x3B, 0xD0, 0xD6, 0xC3, 0x09, 0x08, 0x6C, 0xBA, 0x43, 0x2E, 0x91, 0xFE,
+    0xFF, 0x34, 0x56, 0xAB, 0x09, 0x59, 0xA5, 0x03, 0x40, 0xE5, 0x2F, 0x03, 0x3E, 0x42, 0x06, 0xD9,
+    0x95, 0xBE, 0x70, 0x12, 0x03, 0xE4, 0x86, 0xAF, 0xB5, 0xBE, 0xC2, 0x15, 0x59, 0x83, 0x50, 0x20,
+    0xCA, 0x7E, 0x19, 0x15, 0xE5, 0x2E, 0xAF, 0x99, 0xC3, 0x19, 0x43, 0x82, 0x88, 0x78, 0x3C, 0xE7,
+    0x3D, 0x76, 0x26, 0x04, 0x1B, 0xAF, 0x19, 0xE8, 0x73, 0xE0, 0x76, 0x83, 0xB8, 0x57, 0xF1, 0x00,
+    0xC7, 0x27, 0x16, 0x71, 0x51, 0xE5, 0xDF, 0xA1, 0x46, 0x23, 0x1F, 0xBB, 0x09, 0x7E, 0x22, 0xF0,
+    0x69, 0x8F, 0xC0, 0xEC, 0xC0, 0x02, 0x94, 0xA6, 0x6E, 0x1B, 0x0F, 0xD0, 0x6B, 0x4D, 0x6B, 0x9E,
+    0xC2, 0xEA, 0xD5, 0xA0, 0xB8, 0xCD, 0x4B, 0x49, 0xDF, 0xB0, 0x94, 0xA1, 0x13, 0xD6, 0x92, 0x49,
+    0x22, 0x16, 0x33, 0xC1, 0xB8, 0x1B, 0x1E, 0x1E, 0x30, 0xA1, 0xD3, 0x9F, 0x7B, 0xAD, 0xA8, 0x92,
+    0xB4, 0x64, 0xCF, 0x59, 0x99, 0xB2, 0xB5, 0x84, 0x4F, 0x7D, 0xD0, 0xEC, 0x73, 0xD6, 0x6F, 0x5E,
+    0x8F, 0xB8, 0x1D, 0x83, 0x25, 0xE8, 0xB2, 0x28, 0xA5, 0x4D, 0x9F, 0xF4, 0x69, 0x6F, 0x02, 0x1E,
+    0x6D, 0xF4, 0x0A, 0xFB, 0xD1, 0x50, 0x98, 0x27, 0xB8, 0x75, 0xD1, 0x6D, 0xA9, 0x6F, 0x9B, 0xFC,
+    0xDA, 0xC3, 0xAF, 0xAA, 0xF0, 0x4A, 0x55, 0xD0, 0xD4, 0x86, 0x8B, 0x92, 0x33, 0xAB, 0x59, 0xB3,
+    0x9A, 0x07, 0xD1, 0x6A, 0x5E, 0x1D, 0xB3, 0xFC, 0xB4, 0x79, 0x20, 0x0C, 0xB1, 0x76, 0x30, 0x16,
+    0xF8, 0xD2, 0x62, 0x16, 0xC9, 0xB9, 0x79, 0xA8, 0x45, 0x5A, 0x53, 0xCA, 0x6B, 0xF1, 0x02, 0x0C,
+    0xF9, 0x87, 0xE4, 0x39, 0x25, 0xF3, 0x1A, 0x9B, 0x69, 0x8F, 0x4D, 0x68, 0xD8, 0xD1, 0x18, 0x36,
+    0x83, 0x64, 0x97, 0x67, 0x08, 0x26, 0x9B, 0x02, 0xAE, 0xA3, 0xBB, 0x7C, 0x2E, 0x87, 0x8C, 0xB9,
+    0x9D, 0x54, 0xAD, 0x4E, 0x5F, 0xCE, 0x4D, 0xF5, 0xF7, 0xD3, 0x65, 0x9A, 0x1B, 0x5C, 0x0C, 0x6C,
+    0x0F, 0x98, 0x06, 0xF6, 0x1E, 0x2F, 0xCA, 0x22, 0x69, 0xBD, 0x9E, 0x50, 0x5E, 0xD3, 0xEA, 0xFE,
+    0x48, 0x91, 0x1E, 0xD3, 0x7C, 0x9D, 0xEE, 0xEC, 0x23, 0x61, 0x02, 0xDB, 0x11, 0x4E, 0xF6, 0xF0,
+    0x6B, 0x3E, 0xF3, 0xD0, 0x80, 0xF3, 0x2F, 0x1C, 0x33, 0x80, 0x49, 0x31, 0x6B, 0x02, 0xA7, 0x4E,
+    0x0D, 0x22, 0x85, 0x48, 0x0D, 0x72, 0x64, 0x69, 0xCF, 0x38, 0xBA, 0xDC, 0x5F, 0x36, 0x8D, 0x68,
+    0x7B, 0xF3, 0x89, 0x2E, 0xCE, 0xB4, 0xE9, 0xD2, 0x8F, 0x70, 0x5D, 0xB4, 0x97, 0xBF, 0x75, 0x2B,
+    0xF6, 0x7A, 0x74, 0x28, 0x90, 0x6C, 0xE9, 0x94, 0x66, 0x50, 0x5B, 0x66, 0x5E, 0x9D, 0x58, 0xED,
+    0x99, 0x80, 0x01, 0x68, 0x81, 0x21, 0x96, 0x0F, 0x0E, 0xDD, 0x26, 0xE9, 0xB1, 0x85, 0x66, 0x83,
+    0xA0, 0x21, 0x1B, 0xF6, 0xA7, 0x5B, 0xF6, 0x10, 0xDC, 0xA6, 0x2A, 0x96, 0x26, 0x1E, 0x99, 0xFB,
+    0x16, 0xC4, 0xAD, 0x14, 0x89, 0xD3, 0xAE, 0x9B, 0x38, 0x32, 0xC5, 0xBE, 0x43, 0x01, 0x77, 0x23,
+    0x4B, 0x20, 0x80, 0x78, 0x75, 0xF4, 0x9C, 0x5D, 0x6A, 0xB2, 0xFC, 0xAE, 0xD4, 0x34, 0xA7, 0x30,
+    0x69, 0x50, 0x3F, 0x2F, 0xAC, 0x00, 0xE4, 0xC6, 0x12, 0x71, 0xA6, 0x00, 0x6B, 0x08, 0xA1, 0xFA,
+    0x8C, 0xD8, 0x58, 0x29, 0xE0, 0x7C, 0x69, 0xFE, 0x28, 0xF5, 0x68, 0x6E, 0xBC, 0xE2, 0x87, 0x20,
+    0x8C, 0xA3, 0xF6, 0x86, 0x12, 0xD6, 0x4D, 0x3B, 0x02, 0xE9, 0x3A, 0x61, 0xB7, 0x73, 0xA6, 0x5E,
+    0x03, 0x77, 0x09, 0xE7, 0x77, 0x32, 0xB2, 0x9A, 0x90, 0xAE, 0xAE, 0xA8, 0x4D, 0x6D, 0x3A, 0x7E,
+    0xED, 0xF2, 0xAF, 0x7B, 0x7E, 0x22, 0x6D, 0x05, 0x77, 0xCF, 0x25, 0xD2, 0xA0, 0x69, 0x23, 0x81,
+    0x97, 0xF1, 0xEF, 0xE4, 0xE4, 0x5B, 0xD8, 0xDC, 0x9A, 0x7A, 0x69, 0xD0, 0x79, 0xBD, 0x23, 0xFF,
+    0xA8, 0x37, 0xD2, 0x5F, 0xDC, 0xFD, 0x09, 0x9F, 0x39, 0x94, 0x5C, 0xD6, 0x79, 0xF4, 0x62, 0x48,
+    0x44, 0xA3, 0x69, 0x77, 0x28, 0x4D, 0x7E, 0x67, 0x7C, 0xFC, 0x7A, 0x58, 0x62, 0xF4, 0x3F, 0xFE,
+    0xFE, 0x04, 0xCD, 0x55, 0xB1, 0x92, 0xDC, 0x44, 0x10, 0x6D, 0x8D, 0xCA, 0xA8, 0x0A, 0x05, 0x13,
+    0x39, 0xBA, 0x60, 0x72, 0x92, 0xF9, 0x02, 0x34, 0x2A, 0x08, 0x09, 0x70, 0xB2, 0x11, 0xC1, 0xE5,
+    0x40, 0xD5, 0x7E, 0xC1, 0xED, 0xAA, 0xEA, 0x02, 0x42, 0x48, 0x2E, 0x86, 0x94, 0x75, 0xE0, 0x1F,
+    0xD8, 0x3D, 0xE9, 0x70, 0x40, 0x40, 0xC0, 0x14, 0xC6, 0x11, 0x81, 0x05, 0xC5, 0x95, 0xAB, 0x88,
+    0x04, 0x16, 0x94, 0x7C, 0x37, 0xDA, 0xE1, 0xBD, 0xD9, 0xB5, 0x39, 0x02, 0x20, 0x45, 0xBB, 0xEA,
+    0x19, 0xB5, 0x66, 0xA6, 0xBB, 0x5F, 0xBF, 0x6E, 0x6D, 0x45, 0xF2, 0x41, 0x24, 0x88, 0x14, 0x53,
+    0x1A, 0x74, 0x48, 0x83, 0x99, 0xD3, 0x60, 0x5D, 0x1A, 0x9C, 0xAD, 0x39, 0x9C, 0x99, 0x86, 0x43,
+    0xD0, 0x1D, 0x86, 0x6C, 0x2A, 0x7B, 0x0C, 0x6A, 0xC4, 0xFE, 0xB8, 0x79, 0x78, 0xF3, 0x70, 0x94,
+    0xC8, 0x2B, 0xBC, 0x1A, 0x82, 0x98, 0xF3, 0xE1, 0x12, 0x83, 0x7B, 0x77, 0x70, 0x18, 0xD6, 0xF9,
+    0x60, 0xEB, 0x20, 0xBB, 0x7C, 0x30, 0x1D, 0xDE, 0xE6, 0x83, 0xF6, 0x41, 0x4D, 0xF9, 0x50, 0xF6,
+    0x98, 0xF3, 0x17, 0x0A, 0x08, 0x35, 0x05, 0xED, 0xF3, 0x21, 0x0B, 0xB0, 0x82, 0x93, 0xE7, 0x60,
+    0x1B, 0x0C, 0x6D, 0x25, 0xB2, 0xAE, 0x05, 0x32, 0x76, 0x90, 0xD9, 0x2D, 0x65, 0xFE, 0xA2, 0xA7,
+    0xFC, 0x69, 0x80, 0x2C, 0xAF, 0x26, 0x48, 0xDD, 0xC0, 0xDA, 0x62, 0x79, 0xB1, 0x13, 0x47, 0x1F,
+    0x8E, 0xB2, 0x92, 0x50, 0x99, 0xA6, 0x92, 0xA9, 0xD2, 0x5D, 0xA5, 0xC6, 0xAA, 0xF0, 0x55, 0x3E,
+    0xF0, 0x8F, 0x09, 0x1E, 0xA1, 0xC4, 0x2B, 0x2E, 0x08, 0x95, 0xC3, 0xE2, 0x55, 0xC1, 0x5D, 0xFD,
+    0x5D, 0xA9, 0x80, 0x8D, 0xE9, 0x64, 0x07, 0x27, 0x00, 0x46, 0xC2, 0x02, 0xDE, 0x8D, 0xC4, 0xAE,
+    0xF4, 0x22, 0x19, 0x9C, 0x14, 0x91, 0xCB, 0x15, 0x44, 0xD6, 0xEE, 0x6B, 0x2C, 0x8E, 0x11, 0x5B,
+    0xDA, 0x78, 0xBB, 0x17, 0x99, 0x8B, 0xDE, 0xD5, 0x6A, 0x2A, 0x7A, 0x83, 0x80, 0x8A, 0x5E, 0xFB,
+    0x02, 0xB2, 0xE8, 0x4B, 0x5F, 0xF4, 0xC0, 0xA0, 0x83, 0x1C, 0x0D, 0xA4, 0x9A, 0x6C, 0x53, 0x00,
+    0x51, 0x57, 0x27, 0x29, 0x90, 0xBB, 0x15, 0xE5, 0xAA, 0x4C, 0x70, 0xB6, 0x90, 0x5D, 0x7E, 0xB3,
+    0x01, 0xCE, 0x3A, 0xB9, 0xE2, 0x04, 0x59, 0xC9, 0x70, 0x2E, 0x72, 0xF7, 0x23, 0xAC, 0x89, 0x6D,
+    0x61, 0x19, 0x21, 0xD7, 0xA2, 0x6F, 0x6F, 0x67, 0xC9, 0x47, 0x0B, 0xE4, 0x56, 0x6A, 0x30, 0x4D,
+    0xE9, 0x2D, 0x7C, 0x0E, 0x0A, 0xDE, 0x9A, 0xDA, 0x0A, 0x62, 0x57, 0x80, 0xBA, 0x12, 0x2B, 0xE6,
+    0x3D, 0xAF, 0x06, 0x09, 0xDB, 0x74, 0xFC, 0xAC, 0x3B, 0xDA, 0x8A, 0x3E, 0xBC, 0x7A, 0x64, 0x8C,
+    0x16, 0xA0, 0xC2, 0x62, 0xD9, 0x43, 0x38, 0xC4, 0xCA, 0xDC, 0x03, 0xE6, 0xD7, 0x3A, 0xD2, 0xE4,
+    0x3C, 0x39, 0x25, 0x33, 0xDC, 0x8A, 0x9B, 0xCD, 0xA3, 0xF8, 0xBD, 0xE8, 0xC4, 0x82, 0x23, 0x27,
+    0xA2, 0xD7, 0x5D, 0x36, 0x97, 0x7E, 0x4D, 0x36, 0xD4, 0xBB, 0x6C, 0x42, 0xD8, 0xF0, 0x45, 0x83,
+    0x07, 0x3B, 0xFE, 0x74, 0x07, 0xCB, 0xC0, 0x83, 0x67, 0x23, 0x77, 0xBA, 0xB3, 0x70, 0x59, 0x8D,
+    0xE0, 0x05, 0x1E, 0xCD, 0xA7, 0x9D, 0x13, 0xC0, 0x1C, 0x02, 0x21, 0x11, 0xFD, 0x6D, 0x37, 0xF3,
+    0xF1, 0xAC, 0x52, 0x29, 0xBB, 0x53, 0x82, 0x27, 0xEF, 0xF5, 0x2F, 0x9B, 0x47, 0x5E, 0x37, 0x09,
+    0x1B, 0x30, 0x01, 0xE7, 0xC9, 0x84, 0xE1, 0x52, 0xF2, 0x5E, 0xCC, 0x27, 0xBD, 0xE8, 0xA7, 0x8B,
+    0x65, 0x94, 0x03, 0x25, 0x3C, 0xDD, 0x6A, 0x5B, 0x9F, 0x23, 0x0B, 0x5B, 0x18, 0x6F, 0x1C, 0x51,
+    0x02, 0x19, 0x4A, 0x98, 0x82, 0x73, 0x16, 0x2C, 0xED, 0x57, 0xB2, 0x05, 0xD5, 0xCF, 0x0F, 0x50,
+    0xE9, 0xA6, 0x44, 0x8E, 0xA6, 0x1D, 0x20, 0x43, 0x28, 0xB5, 0x3C, 0x90, 0x29, 0xDB, 0x8B, 0xBE,
+    0xDA, 0xD7, 0xD9, 0x4C, 0x72, 0xE0, 0x5E, 0xC6, 0xCF, 0x32, 0x1C, 0x9B, 0xC5, 0x8B, 0xE5, 0xF0,
+    0xB6, 0x08, 0x32, 0x9F, 0x30, 0x61, 0x79, 0x11, 0x23, 0x20, 0x86, 0x1B, 0x3C, 0x59, 0x37, 0x6F,
+    0x6E, 0x62, 0x9D, 0x47, 0x54, 0x58, 0x62, 0x89, 0xB4, 0x58, 0xA5, 0xD2, 0x0A, 0xE4, 0x8F, 0xE9,
+    0xCC, 0xA8, 0xBD, 0x3C, 0x2A, 0x5C, 0x27, 0xF7, 0x5B, 0x7F, 0x02, 0xA7, 0x5D, 0xDC, 0xD7, 0xF6,
+    0x1A, 0xA7, 0xFA, 0xE3, 0xA9, 0xFB, 0xFA, 0xDE, 0x03, 0x30, 0x2D, 0x5E, 0xE1, 0x1E, 0xB2, 0xC5,
+    0xE2, 0x63, 0x79, 0x75, 0x21, 0xB1, 0x9D, 0x55, 0x28, 0x80, 0x65, 0x23, 0x6E, 0x94, 0x93, 0x38,
+    0x66, 0x04, 0xE9, 0xFA, 0x64, 0x3A, 0x6C, 0x2D, 0x3B, 0xAE, 0xA1, 0xA1, 0x0F, 0xDB, 0x46, 0x21,
+    0x4D, 0x25, 0x3D, 0xA1, 0x13, 0xD9, 0x71, 0x05, 0x5D, 0x87, 0x0B, 0xA7, 0x03, 0x2C, 0xBF, 0x83,
+    0x12, 0x30, 0x30, 0xBC, 0xC5, 0x12, 0xBC, 0x2A, 0x6E, 0x36, 0x5F, 0x02, 0xF4, 0xFD, 0x1B, 0x07,
+    0xF7, 0x11, 0x9C, 0x95, 0xF2, 0x19, 0xAB, 0x75, 0x47, 0x5E, 0xFC, 0xE7, 0x54, 0xA7, 0x69, 0x98,
+    0x39, 0xFD, 0xA6, 0xE7, 0xD4, 0x91, 0xCC, 0xE7, 0xE8, 0x05, 0xC5, 0xA0, 0x47, 0xA7, 0xF6, 0xB2,
+    0x46, 0x44, 0x0D, 0x49, 0x88, 0x50, 0x3F, 0x62, 0x41, 0x25, 0xF4, 0x0E, 0x51, 0xFF, 0xC3, 0xF4,
+    0xBE, 0x1C, 0x01, 0x3F, 0x3E, 0x87, 0xD7, 0xEF, 0xFF, 0xAE, 0x3C, 0x83, 0x12, 0xD5, 0x8E, 0xAC,
+    0x7F, 0x0D, 0xDB, 0xF9, 0xAF, 0x13, 0x39, 0xB7, 0x82, 0xD2, 0x9C, 0x42, 0x59, 0x3C, 0x87, 0x32,
+    0x7B, 0x49, 0x65, 0x45, 0xA5, 0xFE, 0x1C, 0xCA, 0x3C, 0x29, 0xA7, 0xB4, 0x92, 0xAE, 0x3A, 0x0D,
+    0xEA, 0x9A, 0x2B, 0xD0, 0xD3, 0x78, 0xFB, 0xF3, 0xBC, 0xEE, 0x55, 0xE2, 0xD4, 0x09, 0x7D, 0x96,
+    0xE2, 0x5F, 0xAD, 0xDF, 0x55, 0x1E, 0x2E, 0xD0, 0x46, 0x18, 0xAF, 0x17, 0xBB, 0xFF, 0x20, 0x36,
+    0x68, 0xC3, 0x6A, 0x26, 0x79, 0xCA, 0xC1, 0x32, 0x49, 0xE7, 0x89, 0x3E, 0x6B, 0xEE, 0xF9, 0xA1,
+    0x27, 0x2D, 0x40, 0x1B, 0x29, 0xE2, 0xF5, 0x62, 0xB1, 0x68, 0xE3, 0x5F, 0xD7, 0x41, 0x0B, 0xB4,
+    0x64, 0x4D, 0xE2, 0x94, 0xCF, 0xB9, 0x6D, 0xA6, 0x2D, 0xFD, 0x98, 0x99, 0x9D, 0x8C, 0x67, 0xF3,
+    0x6A, 0x1B, 0x31, 0xF0, 0xF6, 0x62, 0x39, 0x09, 0x33, 0x88, 0x85, 0x14, 0x02, 0x3A, 0x1F, 0x2E,
+    0xC5, 0x8C, 0xB2, 0x6C, 0xDD, 0xD3, 0xA5, 0xD7, 0xBD, 0xAC, 0x41, 0x07, 0x34, 0x26, 0x74, 0x94,
+    0xC7, 0xFC, 0x4A, 0xB8, 0xC5, 0xE2, 0xF4, 0x09, 0xAD, 0xB1, 0x8A, 0x9E, 0x0C, 0x07, 0x0B, 0xFA,
+    0x2B, 0x34, 0x89, 0x80, 0x4F, 0x83, 0x6D, 0x66, 0x44, 0x9F, 0xBF, 0x84, 0xFF, 0x86, 0x5D, 0xC8,
+    0x12, 0x8E, 0x7B, 0x89, 0x36, 0x62, 0x7E, 0xC3, 0xC1, 0x59, 0xE4, 0x29, 0xFA, 0x0F, 0x9D, 0x7C,
+    0xC1, 0x0E, 0xB4, 0x17, 0x27, 0xC7, 0x76, 0xB6, 0x22, 0xF5, 0x80, 0x13, 0xFE, 0xEC, 0x2C, 0x1E,
+    0x0A, 0x90, 0x58, 0x8D, 0x72, 0x68, 0x35, 0x20, 0x23, 0xDB, 0x6B, 0x50, 0xA9, 0xEB, 0x52, 0x51,
+    0xF4, 0x54, 0x24, 0xEB, 0xE2, 0xDE, 0x27, 0xA0, 0xAB, 0x8A, 0x31, 0xCC, 0x63, 0x0A, 0xA4, 0x4B,
+    0x88, 0x24, 0xB0, 0xC7, 0x54, 0x12, 0x47, 0xC8, 0x49, 0xFD, 0x16, 0x18, 0xD9, 0x17, 0xB0, 0xF5,
+    0x3B, 0x2A, 0x6C, 0x9B, 0xB1, 0x4F, 0xA0, 0xAA, 0x47, 0x61, 0x79, 0xB3, 0x2B, 0xC3, 0xE4, 0x4A,
+    0xD8, 0x0D, 0x84, 0x2D, 0x0A, 0x5D, 0xA0, 0x91, 0xE2, 0x3B, 0x7A, 0x02, 0x6F, 0x15, 0xBE, 0x3A,
+    0x62, 0xE0, 0x30, 0x3F, 0x45, 0x52, 0x12, 0xDC, 0x2F, 0xDE, 0xE2, 0xB9, 0xFD, 0x65, 0x4A, 0x6C,
+    0x48, 0x92, 0x85, 0xA1, 0x6B, 0x1A, 0x2E, 0xA5, 0x97, 0xBB, 0xD7, 0xFF, 0x0B, 0x8D, 0x3F, 0x01,
+    0x95, 0x55, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0x7B, 0x75, 0xCF, 0xC5, 0x22, 0xB9, 0x49, 0x9A,
+    0x44, 0x60, 0xCA, 0x14, 0x80, 0x69, 0x91, 0xD0, 0xAD, 0xA3, 0x94, 0x34, 0x27, 0x45, 0x09, 0x05,
+    0x05, 0x75, 0x24, 0xA4, 0x6B, 0x69, 0x62, 0x9B, 0xBF, 0x20, 0x57, 0x51, 0xA7, 0x25, 0xFC, 0x03,
+    0x87, 0xF4, 0x7C, 0xCF, 0x81, 0x92, 0x02, 0x47, 0x14, 0x69, 0x57, 0x44, 0x08, 0x10, 0x45, 0x2C,
+    0x62, 0xA4, 0xF7, 0x74, 0xBB, 0x6F, 0xF9, 0x66, 0xD6, 0xEF, 0x78, 0xE4, 0x41, 0x81, 0xEF, 0xDE,
+    0xEE, 0xEC, 0xAF, 0x99, 0xF9, 0x66, 0x66, 0xBF, 0xBD, 0x71, 0xFB, 0x31, 0x25, 0xAE, 0xE8, 0x49,
+    0x0F, 0x1D, 0x51, 0xA9, 0x46, 0xA2, 0xF3, 0xBC, 0xA5, 0xB4, 0x7F, 0x87, 0xAE, 0xBE, 0x25, 0x91,
+    0xBE, 0xB4, 0x94, 0x06, 0x43, 0x64, 0xEE, 0x4E, 0xA4, 0xFB, 0xA2, 0x25, 0x87, 0xBF, 0xA2, 0xD2,
+    0x43, 0x3A, 0x52, 0x4D, 0x86, 0xD4, 0x98, 0x59, 0x2A, 0x2B, 0x6C, 0x75, 0x79, 0x4F, 0x79, 0xBF,
+    0x26, 0x7A, 0x58, 0x56, 0xA4, 0x5E, 0x41, 0x61, 0x79, 0x4C, 0x94, 0x5C, 0x0E, 0x44, 0xB9, 0x83,
+    0xB6, 0x55, 0x4B, 0x7B, 0x5F, 0x19, 0xCE, 0xA2, 0xA0, 0x43, 0x18, 0xA3, 0x14, 0x7E, 0x5B, 0x45,
+    0x49, 0x4F, 0x94, 0x47, 0xA9, 0xA9, 0x28, 0xB7, 0x2C, 0x28, 0xE8, 0x85, 0x7E, 0x8A, 0xAD, 0xB9,
+    0x83, 0xC9, 0xAE, 0xE1, 0x0D, 0x18, 0xAA, 0x3F, 0xB0, 0x48, 0x0E, 0xBE, 0x15, 0x8F, 0x60, 0x4C,
+    0x8D, 0x70, 0xD7, 0x19, 0xD9, 0xDA, 0x61, 0xC4, 0xB6, 0xCD, 0x6D, 0x38, 0x7D, 0x87, 0x75, 0x7A,
+    0x20, 0x65, 0x4F, 0xC5, 0x71, 0x65, 0x4D, 0xC5, 0xDB, 0xF2, 0xBE, 0xAC, 0x3A, 0xDE, 0x06, 0x24,
+    0x2E, 0x81, 0xB6, 0xC4, 0xD1, 0xB1, 0xB2, 0x1C, 0x14, 0x6D, 0xC9, 0x95, 0x94, 0x0F, 0xBC, 0x98,
+    0x4C, 0xD0, 0xD2, 0xB3, 0x2F, 0xEA, 0xC5, 0x40, 0x66, 0xA0, 0x12, 0xE1, 0x7B, 0x89, 0x95, 0x9F,
+    0x3F, 0xF1, 0x50, 0x83, 0x73, 0x26, 0x04, 0xDE, 0x89, 0x5F, 0x11, 0x26, 0x76, 0x8F, 0x3D, 0x3E,
+    0xC1, 0x8F, 0x95, 0xC6, 0x2F, 0xA2, 0x20, 0xB1, 0x36, 0x7F, 0xE9, 0xB4, 0x93, 0x8A, 0xDD, 0xE2,
+    0x97, 0x7E, 0x16, 0x14, 0x2B, 0x8C, 0x07, 0xD7, 0xF4, 0xCF, 0x00, 0xB6, 0x19, 0x47, 0x21, 0x09,
+    0x61, 0x62, 0x47, 0x9D, 0xF2, 0x1F, 0xFB, 0x74, 0x4D, 0xE9, 0x1A, 0x11, 0x6B, 0x90, 0x24, 0x35,
+    0x42, 0x5B, 0xD9, 0x72, 0x08, 0x90, 0x90, 0xBC, 0xAF, 0x91, 0x6A, 0xC3, 0xF6, 0x8D, 0xFC, 0x80,
+    0xA9, 0xAC, 0x8A, 0x16, 0x82, 0x1E, 0x18, 0xBF, 0x08, 0x1A, 0x0B, 0xB2, 0x94, 0xD9, 0x5A, 0x84,
+    0x5E, 0x8D, 0x4B, 0x92, 0xE3, 0x69, 0x04, 0x5F, 0xB6, 0xB4, 0x99, 0x48, 0x4C, 0xD0, 0xC5, 0x48,
+    0x6A, 0xB3, 0x80, 0xA7, 0x8D, 0x25, 0x76, 0x23, 0x22, 0x87, 0x63, 0x33, 0x10, 0x06, 0x5E, 0xB4,
+    0xAF, 0xA3, 0xBD, 0x12, 0xBA, 0xB9, 0x4F, 0xDC, 0x1C, 0x86, 0x4F, 0xC7, 0xD7, 0x30, 0xAB, 0xAD,
+    0x74, 0x0B, 0xD1, 0x51, 0xF0, 0x6A, 0x1A, 0xB6, 0x15, 0x9B, 0x80, 0x31, 0x58, 0x0C, 0x9E, 0x94,
+    0xCF, 0x87, 0x55, 0xC5, 0xE5, 0x52, 0xF4, 0x48, 0x07, 0xE9, 0x91, 0x53, 0xAA, 0x26, 0x8E, 0x7C,
+    0xBA, 0xBE, 0x10, 0xF5, 0x12, 0xCB, 0xD8, 0x7A, 0x77, 0xD0, 0xC6, 0xD5, 0x0B, 0x69, 0xE3, 0xA9,
+    0xA8, 0x21, 0x6A, 0xE3, 0xF2, 0x2B, 0x86, 0xCC, 0xE9, 0x61, 0xD5, 0xC2, 0xE2, 0x25, 0x3C, 0x6A,
+    0x04, 0xEA, 0x22, 0x84, 0x8A, 0xD3, 0x20, 0x3E, 0x6B, 0x71, 0xF8, 0x96, 0x54, 0x31, 0x7E, 0x37,
+    0x03, 0x4E, 0xAD, 0xC2, 0x16, 0x00, 0xC2, 0xAA, 0xD7, 0xF6, 0x41, 0x6E, 0xB9, 0x6E, 0x38, 0x0F,
+    0xC9, 0x9A, 0xF1, 0xBB, 0xFF, 0x6C, 0x64, 0x0B, 0x6F, 0x9E, 0xB4, 0xBD, 0xA6, 0x47, 0xE5, 0x43,
+    0xD3, 0x13, 0x90, 0xEE, 0x2A, 0x8A, 0xD5, 0xD3, 0x03, 0xDA, 0xD5, 0x15, 0x7B, 0x10, 0x83, 0x04,
+    0xE7, 0x7E, 0x15, 0x57, 0xDA, 0x53, 0x29, 0xA7, 0x5B, 0x6F, 0x1D, 0xC5, 0xD0, 0x6F, 0xE7, 0x30,
+    0xCF, 0xE5, 0x93, 0xCC, 0xB1, 0x7D, 0x6F, 0x1E, 0x9E, 0xED, 0x17, 0x55, 0x16, 0xDA, 0x94, 0x7D,
+    0x0F, 0xA1, 0x37, 0x30, 0x97, 0x6F, 0x4E, 0xE9, 0x1B, 0xA8, 0x63, 0x15, 0x95, 0x1E, 0xB3, 0x88,
+    0x55, 0x2E, 0x0D, 0x6A, 0xE3, 0x69, 0xCC, 0x5B, 0xF9, 0x91, 0xDC, 0x50, 0xAA, 0x4B, 0x99, 0x26,
+    0x17, 0xA7, 0x85, 0x01, 0x78, 0xDB, 0x0F, 0xB1, 0xA6, 0xCD, 0x9C, 0x77, 0x5E, 0x46, 0x51, 0xA8,
+    0x57, 0xF0, 0xB2, 0xC6, 0xF2, 0xF7, 0x83, 0x5C, 0x0E, 0x83, 0x39, 0xD4, 0xB3, 0x84, 0x07, 0x62,
+    0x3E, 0x78, 0x59, 0x6E, 0x50, 0x1C, 0x58, 0x56, 0x6B, 0xE5, 0x99, 0x13, 0x4C, 0xAF, 0xC2, 0xFD,
+    0xB0, 0xC1, 0x75, 0x53, 0x21, 0xFC, 0xCE, 0x97, 0x2D, 0x0D, 0x7E, 0x11, 0x18, 0xDA, 0x75, 0xA2,
+    0x6B, 0x02, 0xA8, 0xDA, 0x8F, 0x4A, 0x13, 0x36, 0xDC, 0x9D, 0x67, 0x92, 0xAC, 0xC7, 0x9F, 0xDF,
+    0xD8, 0x0F, 0x49, 0x1D, 0xBB, 0x37, 0x63, 0x77, 0xFE, 0x2F, 0xF1, 0x88, 0x5F, 0xE3, 0xF9, 0x3F,
+    0x41, 0x3E, 0x1B, 0x5C, 0xBA, 0xCD, 0x67, 0xF4, 0xC1, 0xE9, 0xC0, 0x8C, 0x40, 0xD9, 0x28, 0x75,
+    0x9E, 0x4E, 0x02, 0x3D, 0x71, 0x11, 0xE2, 0x61, 0x57, 0x1F, 0x74, 0x38, 0x50, 0x47, 0xFE, 0xAD,
+    0x01, 0x0E, 0x45, 0x16, 0xA0, 0x2C, 0xF3, 0x59, 0xB0, 0xA7, 0x03, 0x32, 0xF9, 0x3C, 0xE0, 0x12,
+    0x35, 0xA1, 0x5A, 0x21, 0x0A, 0xC9, 0x09, 0x1D, 0xB1, 0xFA, 0xEB, 0xF7, 0xEE, 0x9D, 0xC8, 0xE5,
+    0x08, 0x52, 0x03, 0xEF, 0xEA, 0x2F, 0x24, 0xEE, 0xED, 0xFB, 0x6F, 0x1C, 0x38, 0x0C, 0x23, 0x30,
+    0x90, 0xBD, 0x18, 0x51, 0xCC, 0x70, 0x9F, 0x87, 0xAD, 0x0C, 0x39, 0xD2, 0x35, 0xD2, 0xC7, 0xBC,
+    0xFF, 0x13, 0x64, 0xE4, 0xA2, 0xE3, 0x68, 0x63, 0xF8, 0x0C, 0xB2, 0x8F, 0x2C, 0x5E, 0x58, 0xCC,
+    0x70, 0x88, 0x31, 0x04, 0xFF, 0x99, 0x11, 0x19, 0x69, 0x40, 0xD4, 0x55, 0xCA, 0x4C, 0xE3, 0xD7,
+    0xC2, 0x93, 0xC5, 0x23, 0x70, 0x43, 0xE2, 0xD2, 0xD1, 0x03, 0x02, 0x08, 0x25, 0xB3, 0xB8, 0x04,
+    0x5D, 0x06, 0x8A, 0x71, 0x80, 0xB2, 0x4C, 0x27, 0xE8, 0x35, 0xA0, 0xD6, 0x6F, 0x61, 0x15, 0x8C,
+    0xD1, 0x31, 0x9B, 0xBC, 0xA4, 0x8C, 0x9F, 0x03, 0xD0, 0x85, 0x81, 0x35, 0xC5, 0x31, 0xAD, 0x84,
+    0x2B, 0xF4, 0xF8, 0xB7, 0xF3, 0x8B, 0x27, 0x4F, 0xBE, 0xE2, 0xE7, 0x42, 0xA8, 0x54, 0xB5, 0xE3,
+    0x87, 0x18, 0xBC, 0x7D, 0x34, 0xA7, 0xF5, 0xEA, 0x7B, 0x88, 0xEB, 0x44, 0xD9, 0x73, 0xCB, 0x58,
+    0xBB, 0x63, 0xA6, 0x50, 0xFD, 0xE3, 0xC8, 0xA8, 0x97, 0x86, 0x51, 0xB2, 0x59, 0x7E, 0xAC, 0x8A,
+    0x8A, 0x9F, 0xAB, 0x76, 0x0D, 0x23, 0xE9, 0x04, 0x36, 0xF3, 0xD8, 0xDF, 0xC1, 0x01, 0x65, 0x33,
+    0x9B, 0x07, 0x88, 0x26, 0xF9, 0x13, 0xF3, 0xC9, 0x54, 0xE6, 0x4F, 0x71, 0xEA, 0xBB, 0x61, 0xC9,
+    0xFA, 0x96, 0xEA, 0x17, 0x0B, 0xF8, 0x55, 0xE9, 0x84, 0x76, 0xD8, 0x49, 0xCF, 0x2F, 0xC1, 0xEE,
+    0x92, 0x6C, 0x50, 0x76, 0xB8, 0xFE, 0x66, 0xFB, 0xB5, 0x63, 0x8A, 0x3A, 0x33, 0xFD, 0xCC, 0x62,
+    0x52, 0x15, 0x91, 0x44, 0x76, 0x23, 0xB9, 0x2C, 0xBC, 0xC6, 0x24, 0xBD, 0x37, 0x75, 0xB1, 0x63,
+    0xBE, 0x38, 0xCF, 0x4D, 0xC1, 0x16, 0x4A, 0x69, 0xB6, 0xF7, 0x2B, 0xB0, 0xDC, 0x96, 0x9F, 0x47,
+    0xD6, 0x74, 0xD3, 0xEE, 0xA8, 0xB4, 0xDE, 0x3D, 0x26, 0xD9, 0xE1, 0xD4, 0xFF, 0xF9, 0xFE, 0x02,
+    0xAD, 0x55, 0xBF, 0xAF, 0xDC, 0x44, 0x10, 0xFE, 0xF6, 0xF6, 0xF1, 0x2C, 0xC5, 0xC5, 0x52, 0xA4,
+    0x88, 0x08, 0x8A, 0xD3, 0x20, 0xA5, 0x80, 0x5C, 0x4B, 0xC1, 0x3B, 0x3B, 0xF0, 0x07, 0x24, 0xC5,
+    0x3B, 0xA5, 0xC8, 0xFF, 0x40, 0xF8, 0x03, 0x78, 0x9C, 0x25, 0x0A, 0x4A, 0xAE, 0x80, 0x1A, 0x8A,
+    0x48, 0x11, 0xA1, 0xA0, 0x49, 0x01, 0xD2, 0xE5, 0x9D, 0x81, 0x82, 0x12, 0x4B, 0x11, 0xA2, 0xC4,
+    0x90, 0x20, 0xA4, 0x20, 0x14, 0x03, 0x46, 0x32, 0x61, 0x7D, 0xC3, 0x37, 0x6B, 0xFB, 0xFD, 0x48,
+    0xA2, 0x08, 0x02, 0xAB, 0xF3, 0x78, 0xF7, 0xDB, 0xF1, 0xEC, 0xCC, 0x37, 0xB3, 0x73, 0x00, 0xC7,
+    0x42, 0x72, 0x27, 0x02, 0x79, 0xFF, 0x53, 0x57, 0x71, 0x05, 0x4C, 0x1A, 0xC0, 0x15, 0x40, 0xCA,
+    0x4D, 0x0F, 0xD8, 0xFA, 0x70, 0xD9, 0x71, 0xB7, 0x25, 0x44, 0x8D, 0xA8, 0xDB, 0xCE, 0x22, 0xE9,
+    0x30, 0x11, 0x2E, 0x4E, 0x97, 0x40, 0x92, 0x01, 0x7B, 0x80, 0xD1, 0xBD, 0xE3, 0x4B, 0xE0, 0x14,
+    0x1F, 0x5B, 0x61, 0x0B, 0x2B, 0x98, 0xDA, 0xE5, 0x98, 0xFE, 0x40, 0xA3, 0x69, 0xA7, 0xA7, 0x53,
+    0xD5, 0x48, 0x0E, 0xCC, 0xD6, 0x39, 0xE2, 0xCF, 0xBB, 0x93, 0x68, 0xCD, 0xDB, 0xCD, 0x14, 0x98,
+    0xFE, 0xC4, 0x9D, 0xA9, 0x1F, 0x54, 0xAC, 0xD0, 0x83, 0x15, 0x55, 0x5C, 0xD6, 0xD2, 0x23, 0x13,
+    0x6C, 0x63, 0x92, 0x63, 0x1C, 0xF1, 0x85, 0xF9, 0x95, 0x3B, 0x22, 0x7F, 0x76, 0xF3, 0xDD, 0x9D,
+    0x00, 0xEC, 0x22, 0x96, 0x2F, 0xD6, 0xD2, 0xCA, 0x32, 0x79, 0x81, 0x8A, 0xE7, 0x93, 0xAF, 0xCA,
+    0x3A, 0xC1, 0xF2, 0xBC, 0x2B, 0x9B, 0x17, 0x5F, 0x3A, 0x05, 0x73, 0x89, 0x36, 0x4B, 0x2B, 0x72,
+    0xB7, 0x89, 0xE5, 0x1C, 0xB6, 0x0F, 0x2D, 0x05, 0x6B, 0xED, 0x30, 0x99, 0x48, 0x3D, 0xCC, 0x5E,
+    0x8E, 0x06, 0x15, 0x8B, 0x73, 0xC7, 0x74, 0xF1, 0x4C, 0xA6, 0x72, 0xCE, 0xB0, 0x45, 0x67, 0x29,
+    0x7D, 0x7E, 0xB0, 0x52, 0x23, 0x3F, 0x57, 0x78, 0x1E, 0xE4, 0x14, 0x55, 0x0C, 0x64, 0x5B, 0x9C,
+    0x6C, 0xE1, 0x59, 0xFC, 0xCB, 0x71, 0x3A, 0x10, 0x08, 0xB3, 0xA1, 0xBB, 0x61, 0xB6, 0xF6, 0x37,
+    0x93, 0x30, 0x71, 0x17, 0x7E, 0xC1, 0x1B, 0x61, 0x56, 0xC6, 0x78, 0xEA, 0x91, 0xD6, 0x21, 0x4C,
+    0x32, 0xAB, 0x14, 0x63, 0xB1, 0x81, 0x29, 0xCF, 0xA8, 0x75, 0xD4, 0x4C, 0xDB, 0x92, 0xB3, 0xE5,
+    0xE4, 0xF8, 0x17, 0xDB, 0x77, 0x87, 0x89, 0x39, 0x20, 0x67, 0xE7, 0xCA, 0x48, 0x4E, 0xF6, 0xCA,
+    0x23, 0x27, 0x98, 0x6C, 0x9C, 0x1D, 0xEC, 0x45, 0x07, 0x74, 0x8F, 0x44, 0x87, 0x7A, 0xE1, 0x38,
+    0x8B, 0x49, 0x6F, 0x34, 0xCE, 0x43, 0xC5, 0x71, 0xBC, 0x89, 0xC9, 0x12, 0x66, 0xD5, 0x57, 0x62,
+    0x5F, 0x2C, 0x41, 0x39, 0xF8, 0xAB, 0x05, 0x12, 0x57, 0xA3, 0xC9, 0xB3, 0x18, 0xC5, 0x3F, 0x1D,
+    0xD1, 0xB5, 0xFE, 0xFD, 0x19, 0x16, 0x5D, 0x7F, 0xEE, 0x06, 0xEB, 0x2A, 0xCC, 0x08, 0xBC, 0xDE,
+    0x6F, 0x3E, 0x57, 0x3E, 0x1D, 0xB7, 0xEA, 0x92, 0x51, 0x11, 0x4A, 0x72, 0x8D, 0x21, 0x84, 0x45,
+    0x35, 0xC4, 0x3B, 0xAD, 0xB4, 0xF0, 0x7C, 0xB8, 0x1B, 0x7C, 0xD9, 0xFE, 0x18, 0xDE, 0x8F, 0x33,
+    0x3D, 0x71, 0x4D, 0x6F, 0x82, 0x8A, 0xA3, 0xC5, 0x49, 0xF5, 0x08, 0x97, 0x03, 0xBD, 0x8D, 0x2A,
+    0xD1, 0x0E, 0xAD, 0xB9, 0x52, 0x19, 0x49, 0x78, 0xA9, 0x55, 0x86, 0x2F, 0x2E, 0x8D, 0xDA, 0x6A,
+    0x29, 0xCD, 0xF4, 0xC8, 0x4E, 0x7D, 0x49, 0x1A, 0xBD, 0xDA, 0x52, 0x92, 0x6A, 0x77, 0x5F, 0xE1,
+    0xC5, 0x1E, 0x61, 0xFB, 0xAB, 0xC2, 0xE9, 0x3B, 0x84, 0x8D, 0x4F, 0x08, 0xBB, 0x42, 0xE1, 0x8D,
+    0x21, 0x1C, 0xD5, 0x11, 0xE1, 0x94, 0xFE, 0x7B, 0xDB, 0x82, 0x70, 0x52, 0x28, 0xEC, 0x79, 0xE9,
+    0x53, 0x36, 0x10, 0xC2, 0x6C, 0x21, 0x7B, 0xF6, 0xF7, 0x9A, 0xEE, 0x3B, 0xE6, 0x8A, 0xB0, 0xD7,
+    0x68, 0x35, 0x5B, 0x8B, 0xEB, 0x1B, 0x4D, 0xE0, 0x77, 0xB5, 0xDE, 0x95, 0xE0, 0x8E, 0x0F, 0x39,
+    0x28, 0x0F, 0x63, 0x0C, 0x40, 0x48, 0x28, 0xDD, 0xEC, 0xEF, 0x31, 0x03, 0x3C, 0xA9, 0x91, 0xAD,
+    0x94, 0x3D, 0x0F, 0xD3, 0x5D, 0x26, 0x2F, 0x6B, 0x8D, 0xEB, 0xC4, 0x83, 0xA3, 0x6C, 0xCF, 0x78,
+    0x40, 0x46, 0x21, 0xF9, 0x4C, 0x0B, 0x7A, 0x06, 0x7B, 0x9F, 0xC2, 0x7D, 0x4D, 0x91, 0x5C, 0xA4,
+    0x48, 0x1D, 0xC5, 0x8A, 0x82, 0x8E, 0xE5, 0x33, 0xCB, 0x3E, 0x34, 0x8B, 0x0B, 0x8A, 0x24, 0xA7,
+    0x48, 0x49, 0xFB, 0xEC, 0x96, 0x8A, 0x96, 0x82, 0x97, 0xC2, 0x7D, 0x93, 0x96, 0x70, 0x5D, 0x5A,
+    0xC0, 0x05, 0x9F, 0x56, 0x63, 0xB5, 0x86, 0x8E, 0x16, 0x8A, 0x34, 0x24, 0xD3, 0xF6, 0x19, 0x09,
+    0x80, 0x72, 0x19, 0xAA, 0x96, 0x0D, 0x95, 0xE5, 0x2B, 0x8C, 0x56, 0xA4, 0xED, 0xA1, 0x10, 0x99,
+    0x3D, 0xD4, 0xBA, 0xF7, 0x91, 0x6E, 0x4A, 0xCE, 0x16, 0x24, 0x05, 0xA1, 0x75, 0x91, 0x0E, 0x99,
+    0xD9, 0xA7, 0x96, 0xF1, 0x84, 0xA2, 0x9A, 0xD0, 0x34, 0x27, 0xA4, 0xB9, 0x72, 0xB5, 0xBB, 0xF7,
+    0xB1, 0x64, 0xA9, 0xB0, 0xE1, 0xB2, 0xD1, 0x69, 0x07, 0x3B, 0x72, 0x62, 0x30, 0x7F, 0xF9, 0x8F,
+    0x5D, 0x46, 0x4E, 0x66, 0x62, 0x3D, 0xFF, 0xE1, 0x13, 0x1F, 0xE3, 0x84, 0x42, 0x9B, 0x1B, 0xEF,
+    0xB1, 0x15, 0xD2, 0x57, 0x3A, 0x2D, 0x84, 0xCC, 0x46, 0xB5, 0xBC, 0x96, 0x41, 0x4D, 0x2D, 0xA7,
+    0x7E, 0xED, 0xA3, 0x9B, 0x5F, 0xAD, 0xD5, 0xD5, 0x8C, 0x5A, 0x4B, 0xB2, 0x7F, 0x2D, 0x38, 0xCF,
+    0xA7, 0xF6, 0x88, 0x3D, 0xB3, 0xE2, 0xD5, 0x73, 0x3E, 0x6F, 0xF5, 0x4F, 0xB6, 0xEF, 0x6D, 0xD9,
+    0x79, 0xFB, 0x1B, 0x71, 0x69, 0xA8, 0x57, 0xE9, 0xC7, 0x72, 0xE3, 0x03, 0x56, 0x8A, 0xAD, 0xA8,
+    0x5F, 0xFA, 0xC1, 0x9D, 0xC7, 0x3D, 0xE1, 0x1A, 0xBC, 0x2A, 0x95, 0xFD, 0x56, 0xFF, 0x99, 0x7E,
+    0xBC, 0x5A, 0x33, 0x17, 0x1B, 0x56, 0x97, 0xFB, 0x92, 0x5E, 0x35, 0xD4, 0xB8, 0x45, 0xA7, 0x92,
+    0x77, 0x49, 0xD1, 0x1D, 0x72, 0xD5, 0xEA, 0x91, 0x4A, 0xD5, 0xC5, 0xE2, 0x84, 0xBB, 0xDD, 0x46,
+    0xB7, 0x6B, 0xC1, 0xBA, 0x4D, 0x5B, 0xE7, 0xDD, 0x27, 0xE2, 0xED, 0xF7, 0xB4, 0xE1, 0xCD, 0x6B,
+    0x4A, 0xE6, 0x0E, 0x03, 0xDA, 0x0A, 0xF1, 0xFB, 0x31, 0x53, 0xC5, 0x40, 0x08, 0x53, 0xF8, 0x61,
+    0x80, 0x74, 0xA5, 0xAF, 0xBF, 0xE4, 0x60, 0xF8, 0x5E, 0xEF, 0xBF, 0xBF, 0x86, 0x96, 0x7B, 0xF4,
+    0xC7, 0x7C, 0xEA, 0x6F, 0x3E, 0x4F, 0x1F, 0xDA, 0x78, 0xE2, 0xEF, 0xFF, 0x19, 0x7F, 0x03, 0xAD,
+    0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x28, 0x79, 0x0A, 0x96, 0x18, 0x8A, 0x54, 0xA4,
+    0x98, 0x5F, 0x10, 0xFC, 0x0B, 0x78, 0xD7, 0xE2, 0x0F, 0x90, 0x82, 0xF0, 0x37, 0x52, 0x23, 0xA1,
+    0xB5, 0x51, 0x0A, 0x0A, 0x8A, 0xA4, 0x81, 0x3A, 0x2D, 0x4B, 0x91, 0x96, 0x62, 0xF3, 0x6C, 0x36,
+    0x05, 0x05, 0x45, 0x2C, 0x45, 0xA9, 0x63, 0xB1, 0x4A, 0x45, 0xC1, 0x44, 0x79, 0x85, 0xD9, 0x8C,
+    0x3D, 0x9C, 0x73, 0xDF, 0xAE, 0x48, 0x10, 0x84, 0x86, 0x95, 0x66, 0xDE, 0x78, 0x3E, 0xEE, 0xC7,
+    0xB9, 0xE7, 0xDC, 0x2D, 0x73, 0xCE, 0x1D, 0x46, 0xD4, 0x9C, 0x93, 0x1F, 0x44, 0x5C, 0x14, 0x91,
+    0x84, 0xA1, 0x18, 0x6F, 0x6F, 0x34, 0x22, 0xB8, 0x29, 0xB8, 0x39, 0xBC, 0xB7, 0x1E, 0x3F, 0xF8,
+    0x87, 0x1B, 0xFF, 0xBA, 0x91, 0xF3, 0x84, 0x67, 0xEE, 0xFC, 0xF8, 0xFE, 0x16, 0x5F, 0x93, 0xC8,
+    0x5F, 0x3F, 0x7D, 0x5E, 0xAA, 0x9C, 0xC7, 0x4D, 0x7C, 0x73, 0xF3, 0xEF, 0x57, 0x72, 0xF4, 0x74,
+    0xCD, 0x40, 0x69, 0xCF, 0x8C, 0xBF, 0x6B, 0x91, 0xF3, 0x7D, 0x5E, 0x1E, 0xFD, 0xF9, 0xC3, 0xDC,
+    0x24, 0xD9, 0x2C, 0x38, 0xF2, 0x11, 0x47, 0x7A, 0x6F, 0x90, 0x22, 0x61, 0xE1, 0x9F, 0xE0, 0xF2,
+    0x82, 0x45, 0xF5, 0x1C, 0x8B, 0x47, 0x97, 0x8B, 0x85, 0xAF, 0xC7, 0x0B, 0x33, 0x35, 0x43, 0xDF,
+    0x63, 0x91, 0xE5, 0xFD, 0xDB, 0xFD, 0x00, 0x8B, 0x51, 0xAA, 0x3C, 0x8B, 0x14, 0xB7, 0x84, 0x30,
+    0x60, 0x23, 0x21, 0xA7, 0x07, 0xF4, 0xAB, 0x87, 0x37, 0x4C, 0xDD, 0x3F, 0x6B, 0x70, 0x3A, 0xDB,
+    0xE9, 0xFE, 0x06, 0x50, 0x75, 0xB3, 0xE2, 0x20, 0x49, 0xF5, 0x34, 0x4A, 0x40, 0x00, 0x47, 0x6A,
+    0x31, 0x30, 0xE5, 0xD0, 0x89, 0x1C, 0x89, 0x94, 0xFB, 0x43, 0xF4, 0x3B, 0xF9, 0xE2, 0x4E, 0x2C,
+    0x72, 0x6E, 0xCA, 0x8C, 0xD4, 0xC5, 0xCE, 0x00, 0xC0, 0x51, 0x39, 0x13, 0x8B, 0x30, 0xF8, 0x09,
+    0x9F, 0x08, 0x49, 0x1B, 0x7C, 0x2E, 0xF4, 0xB8, 0x95, 0xBA, 0x83, 0x25, 0x37, 0xD1, 0x5A, 0xDD,
+    0x6D, 0x2D, 0xF0, 0xC5, 0x4D, 0xAC, 0x96, 0xDB, 0x6F, 0x2D, 0x17, 0xFF, 0xF8, 0xD7, 0x99, 0xC6,
+    0xDA, 0x6D, 0xCB, 0x9F, 0x12, 0x05, 0xE4, 0xAF, 0xEE, 0x98, 0xAD, 0x54, 0x67, 0x67, 0xAC, 0x57,
+    0x99, 0xB6, 0x81, 0xDB, 0xAD, 0x9B, 0x7A, 0x03, 0x61, 0xEB, 0x66, 0x9A, 0x70, 0x13, 0x6D, 0xEC,
+    0xE0, 0x08, 0x8F, 0xC3, 0xE0, 0xA6, 0xD2, 0x22, 0xDF, 0x4A, 0xC5, 0x08, 0x10, 0x86, 0x7E, 0xAF,
+    0x1D, 0x83, 0xCC, 0xBF, 0x45, 0x7E, 0x6E, 0x56, 0x0B, 0x5C, 0x36, 0x87, 0x04, 0x98, 0xC1, 0x7F,
+    0x7F, 0x16, 0x8D, 0xF2, 0x2D, 0xA3, 0x57, 0x00, 0x81, 0x7C, 0x22, 0xB2, 0x0C, 0x9D, 0xCA, 0x23,
+    0xF8, 0x76, 0x11, 0x39, 0xBA, 0xBD, 0xF2, 0x91, 0x7F, 0xFC, 0xD2, 0x98, 0xA5, 0x04, 0xBC, 0x38,
+    0x64, 0x52, 0xF7, 0x3B, 0x9A, 0x3C, 0x7B, 0x05, 0x14, 0x8B, 0xA4, 0x56, 0x0E, 0x17, 0x95, 0x90,
+    0x6A, 0x91, 0x98, 0x43, 0x44, 0xC4, 0x0B, 0x4C, 0xD7, 0xDF, 0xD6, 0x1D, 0x4A, 0xD4, 0xBF, 0x8E,
+    0xF8, 0x70, 0xD9, 0x7C, 0x1B, 0x5B, 0x0F, 0x05, 0x7C, 0xD7, 0xC7, 0xE1, 0x0F, 0xD8, 0x75, 0x9B,
+    0x9C, 0x57, 0x59, 0xBF, 0xEB, 0xA7, 0xEB, 0xE2, 0x2E, 0x85, 0x01, 0x30, 0xAC, 0x88, 0x46, 0xA0,
+    0xD6, 0xC6, 0xD5, 0x1F, 0x32, 0xAE, 0x2F, 0xA4, 0x2F, 0xD1, 0x6F, 0x49, 0xA6, 0xF9, 0x52, 0x14,
+    0xE3, 0x05, 0xB3, 0xF8, 0xBE, 0xFD, 0x00, 0xE3, 0x9B, 0x17, 0x9F, 0xE7, 0x53, 0x8A, 0xF1, 0x4E,
+    0x5E, 0x1B, 0xB9, 0x4A, 0xCF, 0x1F, 0x31, 0x04, 0xD6, 0xEF, 0x47, 0x31, 0x16, 0x14, 0x3D, 0x1C,
+    0xF5, 0x20, 0xCC, 0x95, 0x0B, 0xD0, 0xFA, 0xDC, 0xB4, 0x50, 0xD5, 0x8B, 0x1B, 0x33, 0x2B, 0x63,
+    0xC6, 0x90, 0x7B, 0x39, 0x97, 0xC7, 0xAB, 0xB4, 0xB9, 0x71, 0x08, 0x13, 0x65, 0x45, 0x70, 0xA3,
+    0x01, 0x4D, 0xF8, 0x96, 0x3F, 0xA4, 0x7D, 0x92, 0xF3, 0xBE, 0x45, 0x4C, 0x06, 0x27, 0x4C, 0x7E,
+    0x79, 0x70, 0xF3, 0xB1, 0xC8, 0x43, 0xA8, 0x04, 0x51, 0x5D, 0x17, 0x39, 0x01, 0xAA, 0x77, 0x23,
+    0xD0, 0x84, 0xC1, 0x30, 0x90, 0xAF, 0xB0, 0xEE, 0x47, 0x47, 0x18, 0x3D, 0x69, 0xA8, 0x02, 0xE3,
+    0x09, 0x0B, 0x17, 0x41, 0x17, 0xFF, 0x4B, 0xA4, 0x22, 0x10, 0xD4, 0x8A, 0x84, 0xDD, 0x4B, 0x4C,
+    0xFE, 0x27, 0xCA, 0x8D, 0xEE, 0x13, 0x26, 0xD4, 0x13, 0xEF, 0xA1, 0x04, 0xE2, 0x3E, 0xC3, 0x96,
+    0x9B, 0x61, 0x6B, 0x73, 0x0E, 0x8F, 0x80, 0x13, 0xB1, 0x59, 0x2D, 0xD2, 0x25, 0xE8, 0xA6, 0x64,
+    0x7D, 0x6B, 0xEB, 0x0A, 0x99, 0x0F, 0xF5, 0xB3, 0x9A, 0x90, 0x43, 0xC2, 0xD0, 0x62, 0x36, 0x37,
+    0xD4, 0x96, 0x50, 0xD4, 0x4A, 0x04, 0x7E, 0x07, 0x57, 0x5E, 0x01, 0x91, 0x84, 0xBA, 0x28, 0x40,
+    0x06, 0x09, 0x1A, 0x23, 0x40, 0x92, 0xF6, 0x33, 0x85, 0x80, 0x61, 0x1C, 0x62, 0x96, 0x92, 0x56,
+    0x4F, 0x48, 0x1F, 0x8A, 0xE0, 0xCD, 0x8D, 0x43, 0xFA, 0x10, 0xEA, 0x06, 0x86, 0x0D, 0x82, 0x56,
+    0xD2, 0x4D, 0x3F, 0xFA, 0xD3, 0xA7, 0x7B, 0x2C, 0x56, 0xF1, 0xA7, 0xB9, 0x93, 0x54, 0x4F, 0x60,
+    0x23, 0x3D, 0x13, 0x80, 0x0C, 0x04, 0x57, 0x40, 0xE2, 0x7F, 0xDE, 0xD3, 0xF5, 0xC0, 0x3B, 0x58,
+    0xD4, 0xC8, 0xFA, 0xF4, 0x39, 0x7C, 0xDF, 0xD4, 0xCE, 0x0F, 0xCD, 0x6A, 0x99, 0x13, 0xD3, 0x11,
+    0x0F, 0xDB, 0x4F, 0xD9, 0x8C, 0x98, 0x96, 0x5E, 0xF3, 0xA3, 0x86, 0xBA, 0xD3, 0xB0, 0x13, 0x0D,
+    0xC8, 0x2C, 0x80, 0xA0, 0x28, 0x29, 0x59, 0x4E, 0x58, 0xB5, 0x27, 0xE5, 0x3B, 0xEC, 0x8D, 0x18,
+    0xD0, 0x7F, 0x00, 0x9B, 0x43, 0x8B, 0x81, 0xE2, 0x5C, 0xAB, 0xC0, 0xF5, 0x32, 0x31, 0xFC, 0x47,
+    0xC4, 0xAB, 0x25, 0x72, 0xFA, 0x09, 0xBA, 0x48, 0xDD, 0xF5, 0x79, 0x0C, 0xC3, 0x87, 0x99, 0x2D,
+    0x4A, 0x49, 0x52, 0x6A, 0x8B, 0xC5, 0xC0, 0xDD, 0x44, 0x02, 0x6A, 0x26, 0x64, 0x64, 0xA9, 0x33,
+    0x2D, 0x25, 0x52, 0x54, 0x49, 0x69, 0x3F, 0x54, 0xBC, 0x69, 0x65, 0x26, 0xBB, 0xE8, 0x82, 0x75,
+    0x51, 0x0A, 0xC8, 0xD0, 0x94, 0x9E, 0x8E, 0xFC, 0xE4, 0x99, 0x05, 0x5B, 0xA2, 0x55, 0x8C, 0xA6,
+    0x8B, 0xF6, 0xF6, 0x2D, 0x76, 0x6D, 0x80, 0x9D, 0xA7, 0x43, 0xF9, 0x2E, 0x8E, 0x94, 0xFA, 0x1E,
+    0xAD, 0x82, 0x8A, 0xA6, 0xE2, 0x22, 0x1A, 0xA0, 0x5A, 0x48, 0x2C, 0x9F, 0x32, 0x0C, 0xAA, 0x17,
+    0x7A, 0xB6, 0x1A, 0x2A, 0x84, 0x02, 0x74, 0x50, 0x48, 0xF6, 0x1A, 0x16, 0x51, 0xD9, 0x83, 0xA2,
+    0xB9, 0x2E, 0x53, 0x8F, 0x32, 0xB8, 0x08, 0xD1, 0xC0, 0x26, 0xD7, 0x40, 0x08, 0xF6, 0x56, 0xB6,
+    0xD5, 0x92, 0x9A, 0xE8, 0x2A, 0x6B, 0xB1, 0xEC, 0xE3, 0xA1, 0xA3, 0x2A, 0xC3, 0x57, 0xE4, 0x53,
+    0xF8, 0x9A, 0xD2, 0x0B, 0xF7, 0xA8, 0xAD, 0x80, 0x67, 0x98, 0x49, 0x08, 0xEC, 0x30, 0xD2, 0x70,
+    0x97, 0x2A, 0x0D, 0xDD, 0x6A, 0x73, 0xDB, 0x70, 0x06, 0xEC, 0x98, 0x0F, 0x0D, 0x9B, 0x94, 0x86,
+    0x97, 0xDE, 0x66, 0x98, 0xC6, 0x0C, 0x19, 0x60, 0x76, 0x73, 0x8B, 0xE0, 0x8F, 0x02, 0xFE, 0x4B,
+    0xB4, 0xE5, 0x71, 0x62, 0x1B, 0xA8, 0x99, 0x77, 0x05, 0xFD, 0x80, 0x5C, 0x6C, 0x13, 0x27, 0x9C,
+    0xEA, 0x9A, 0x0D, 0x03, 0x34, 0x95, 0xF2, 0xB5, 0x51, 0x8E, 0x91, 0xD5, 0x0C, 0xB5, 0x1A, 0x76,
+    0xBC, 0xC9, 0x66, 0x72, 0xC2, 0x4E, 0x52, 0xB3, 0x51, 0x80, 0x9A, 0x0B, 0xB9, 0x69, 0x9A, 0xF8,
+    0xBF, 0xFF, 0xFE, 0x04, 0xB5, 0x55, 0x3D, 0x6F, 0xD3, 0x60, 0x10, 0x3E, 0xDB, 0x42, 0x96, 0x9A,
+    0xE1, 0x65, 0x60, 0xF7, 0xCE, 0x80, 0x7F, 0x01, 0xD8, 0x12, 0x12, 0xAC, 0x0C, 0x64, 0xEA, 0xC0,
+    0x4F, 0x60, 0x66, 0x89, 0x2D, 0x16, 0xFE, 0x00, 0x03, 0x1B, 0x0B, 0x03, 0x0A, 0x42, 0xFC, 0x81,
+    0xA6, 0xB1, 0xD4, 0x91, 0x81, 0x48, 0xA8, 0x73, 0x83, 0x10, 0x12, 0x74, 0xB2, 0xA8, 0x91, 0x9C,
+    0xD6, 0xC9, 0xF1, 0x3C, 0xF7, 0x3A, 0x2A, 0x94, 0xA6, 0xB4, 0x12, 0x58, 0xF2, 0xF9, 0xBD, 0xEF,
+    0xF7, 0x9E, 0xBB, 0x4B, 0x76, 0x44, 0x82, 0xC6, 0x55, 0x22, 0x69, 0xDE, 0x89, 0x84, 0x97, 0x3D,
+    0xEA, 0x78, 0xFC, 0xA6, 0x71, 0x8A, 0x27, 0x27, 0xB9, 0x7A, 0x84, 0xAF, 0x3C, 0xEA, 0x01, 0x8F,
+    0x4B, 0xC1, 0x33, 0x98, 0x91, 0x4E, 0x36, 0x1F, 0x83, 0xFC, 0x8E, 0x48, 0x92, 0x67, 0x0C, 0xB3,
+    0x99, 0x0C, 0x87, 0x8F, 0xF3, 0x8C, 0xB7, 0xF2, 0xE4, 0x22, 0xE3, 0xE7, 0x24, 0x9D, 0x11, 0xC6,
+    0xBF, 0x98, 0xC8, 0x0E, 0x6E, 0xA0, 0x2B, 0xBB, 0xB4, 0x9E, 0xD2, 0x46, 0x2E, 0x43, 0x0D, 0x2C,
+    0x31, 0x9C, 0x7A, 0x7A, 0x79, 0xDF, 0x4D, 0x94, 0x60, 0x68, 0x8D, 0xF3, 0x54, 0xF7, 0x6A, 0x09,
+    0x8F, 0xC7, 0x40, 0x15, 0x68, 0x59, 0x75, 0x34, 0x99, 0x48, 0x54, 0xD3, 0xCE, 0xED, 0x0F, 0xB7,
+    0x21, 0x26, 0x1A, 0xCC, 0xBD, 0x5C, 0x8B, 0x37, 0x58, 0x9F, 0x15, 0x23, 0xBC, 0x2A, 0x9A, 0x14,
+    0x59, 0xAB, 0x45, 0x9C, 0xC5, 0x10, 0x9A, 0xC0, 0xDC, 0xC0, 0x61, 0x8F, 0xE0, 0x4D, 0x17, 0xFA,
+    0x5B, 0xB7, 0x2E, 0xA1, 0x56, 0x9D, 0x99, 0x5A, 0xB5, 0x35, 0xF5, 0xE1, 0xB4, 0xF3, 0xEA, 0xB8,
+    0xF3, 0xDE, 0x51, 0xEB, 0xBD, 0xE3, 0x23, 0xEF, 0xED, 0x0E, 0xBC, 0x77, 0x3A, 0xF5, 0xC1, 0x8B,
+    0x3E, 0xB8, 0x7A, 0x75, 0xA4, 0x5E, 0xED, 0xB4, 0x57, 0x5B, 0xDB, 0x24, 0xF0, 0xED, 0x93, 0xC1,
+    0xDC, 0x7F, 0xB3, 0xDC, 0x3E, 0x61, 0x2F, 0x4E, 0x6D, 0xC0, 0x9E, 0x6C, 0xAF, 0xCC, 0x56, 0xD5,
+    0xAC, 0x62, 0x5D, 0x78, 0xED, 0x0D, 0x21, 0x72, 0x4B, 0x5F, 0x3E, 0x2C, 0xB3, 0xF1, 0x78, 0x69,
+    0xD5, 0x30, 0x6F, 0x66, 0xE9, 0xFE, 0x60, 0xF6, 0x73, 0x32, 0x53, 0x9D, 0x93, 0x01, 0x76, 0x60,
+    0x76, 0xEF, 0xA9, 0x99, 0x45, 0xAD, 0x99, 0xB9, 0x3D, 0xF3, 0x99, 0x18, 0x13, 0x7F, 0x36, 0x66,
+    0x64, 0x4C, 0x74, 0x54, 0xF7, 0xF8, 0xF3, 0x16, 0xFE, 0xC6, 0x23, 0x39, 0x5D, 0x84, 0x7E, 0x16,
+    0x53, 0x54, 0x2A, 0xB7, 0x1E, 0x11, 0xE0, 0x50, 0xFD, 0xF6, 0xAC, 0xE4, 0xF7, 0x27, 0x25, 0x1A,
+    0x03, 0xA5, 0x58, 0xBF, 0xBD, 0xC2, 0xB1, 0xA5, 0xB4, 0xC8, 0xE5, 0x1A, 0x70, 0x45, 0x81, 0x25,
+    0xB0, 0x9E, 0x6A, 0x55, 0x80, 0x2B, 0x9E, 0xB6, 0x92, 0x96, 0x99, 0x63, 0x3B, 0x70, 0xA7, 0xA8,
+    0x0E, 0x00, 0x7C, 0x52, 0x11, 0xF6, 0x91, 0xB8, 0x0F, 0x55, 0xD0, 0x4A, 0x96, 0xE5, 0x71, 0x1D,
+    0x74, 0xB8, 0x7A, 0x15, 0x7F, 0x02, 0x2B, 0xE9, 0xDD, 0x5A, 0x76, 0xA5, 0x73, 0xF3, 0xA0, 0x1B,
+    0xCC, 0x13, 0x14, 0x56, 0x48, 0x3A, 0x8F, 0x4F, 0x1A, 0x49, 0x17, 0x8F, 0xB4, 0x44, 0x76, 0x5D,
+    0x0D, 0x59, 0xBD, 0x22, 0xED, 0xC3, 0xD0, 0xA3, 0x7A, 0x63, 0x7D, 0xB5, 0x25, 0x91, 0x46, 0x25,
+    0xF1, 0xE2, 0x21, 0xDA, 0xC5, 0xC2, 0x92, 0x32, 0xD4, 0x3C, 0xCD, 0x13, 0x9D, 0x65, 0x92, 0x3D,
+    0xAB, 0x33, 0x29, 0xC2, 0x26, 0x93, 0x49, 0x00, 0xBC, 0x26, 0xD2, 0xF6, 0xA7, 0x51, 0xD0, 0x60,
+    0x71, 0xA3, 0x3A, 0x29, 0xB3, 0xFB, 0xB5, 0x9B, 0x25, 0x07, 0x55, 0xB4, 0x70, 0x9A, 0xA3, 0x69,
+    0xFA, 0x82, 0x19, 0x11, 0xF1, 0xC1, 0x60, 0xDD, 0x6D, 0x74, 0x10, 0x13, 0xA6, 0x52, 0x1C, 0xBF,
+    0x69, 0xA2, 0xA5, 0x04, 0x65, 0x56, 0xF5, 0x4D, 0xB7, 0x84, 0x1C, 0x8E, 0xB0, 0x5D, 0x73, 0x36,
+    0x13, 0xD4, 0x71, 0x10, 0x7F, 0x11, 0xED, 0xAE, 0xE7, 0x27, 0x22, 0xD4, 0x8E, 0xCA, 0x84, 0xA5,
+    0xA4, 0x46, 0x16, 0xC3, 0x1D, 0xA6, 0xB5, 0x2E, 0x97, 0x12, 0xFC, 0xA0, 0x31, 0x4D, 0x22, 0x6A,
+    0x63, 0xB6, 0x28, 0xC5, 0xBB, 0xC5, 0x2C, 0x05, 0xB9, 0xEB, 0xFD, 0x40, 0xEA, 0x82, 0x73, 0x96,
+    0x7D, 0x79, 0xEB, 0xE6, 0x16, 0x9D, 0xB3, 0x5B, 0xDB, 0x04, 0x9D, 0xF9, 0x20, 0x69, 0x02, 0x47,
+    0xF4, 0x30, 0x5E, 0x5E, 0x9B, 0x27, 0x68, 0x66, 0x8A, 0x21, 0xC4, 0xE2, 0x4B, 0xE3, 0x13, 0xDC,
+    0x86, 0xD1, 0x4C, 0xB6, 0x10, 0x03, 0xAB, 0x19, 0xE4, 0xB6, 0xAB, 0xDF, 0xB9, 0xA8, 0xEF, 0x49,
+    0xFC, 0xE8, 0x04, 0xED, 0x7A, 0x94, 0x92, 0x52, 0xFE, 0x89, 0xE8, 0x18, 0xD0, 0x24, 0x1C, 0xAC,
+    0xE2, 0xAF, 0x4E, 0x68, 0x79, 0x81, 0xC6, 0xF0, 0xBD, 0xF9, 0xEE, 0xF0, 0xB5, 0x4D, 0xF1, 0x95,
+    0xDE, 0x2F, 0x6C, 0xA5, 0x7F, 0x6D, 0x2B, 0xCE, 0x7B, 0x6D, 0xF3, 0x82, 0x05, 0x50, 0x70, 0x7B,
+    0x00, 0x66, 0x17, 0xF0, 0x45, 0x35, 0xD6, 0x3D, 0xE5, 0x8C, 0x77, 0xF8, 0xD8, 0x46, 0x71, 0x0D,
+    0x89, 0x68, 0x07, 0x48, 0x83, 0x96, 0x5B, 0x7C, 0x32, 0xE7, 0xA6, 0xB3, 0xB1, 0xBC, 0x34, 0x91,
+    0xF6, 0xE1, 0x4E, 0x07, 0x61, 0xB3, 0x08, 0xFF, 0x06, 0xC9, 0xCB, 0x52, 0x06, 0x1F, 0x99, 0x6B,
+    0x82, 0x80, 0x28, 0xB7, 0x83, 0x05, 0xE7, 0x35, 0xCD, 0x5D, 0xE5, 0xAA, 0xB0, 0x01, 0x0C, 0x23,
+    0xFB, 0x49, 0xED, 0xF0, 0x7B, 0x04, 0x70, 0xEE, 0x60, 0x1C, 0xDC, 0x07, 0x4C, 0xCA, 0x09, 0x7F,
+    0x2F, 0xEA, 0x7E, 0x27, 0xBB, 0x3E, 0x07, 0x23, 0x5B, 0x8A, 0x73, 0x05, 0xFF, 0xEF, 0xF9, 0x09,
+    0xC5, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0xB6, 0x15, 0x5C, 0xB8, 0xD8, 0x86, 0x48, 0x48,
+    0x14, 0xD7, 0x53, 0xC4, 0x5F, 0x90, 0xAC, 0x11, 0x05, 0x25, 0x29, 0x38, 0x21, 0x68, 0xC2, 0x17,
+    0x90, 0x2F, 0xC8, 0xD9, 0xE2, 0x0B, 0x90, 0x10, 0x35, 0x14, 0xA9, 0xAE, 0xC9, 0x0F, 0xE4, 0xCE,
+    0x96, 0x52, 0xA4, 0xA0, 0xC0, 0x88, 0x40, 0x43, 0x81, 0x1B, 0x14, 0x29, 0x4D, 0x8C, 0x70, 0x90,
+    0x93, 0xF8, 0xBC, 0xBC, 0x59, 0xDF, 0x45, 0xB9, 0x28, 0x90, 0x20, 0x21, 0xF0, 0x69, 0x77, 0x7D,
+    0xB3, 0x33, 0x6F, 0x66, 0x67, 0xDF, 0x8C, 0x47, 0x80, 0x73, 0xDC, 0x00, 0x6A, 0xA7, 0x02, 0xC6,
+    0x5E, 0x09, 0xAF, 0x0C, 0x0A, 0x84, 0x89, 0xCA, 0xD0, 0x70, 0x09, 0x72, 0x68, 0xFE, 0xB8, 0xC3,
+    0xED, 0xA6, 0x97, 0xC1, 0xA9, 0x27, 0x80, 0x77, 0x5A, 0x00, 0xBE, 0x01, 0xCD, 0x6A, 0x4E, 0x14,
+    0xA3, 0x1F, 0xF7, 0xE1, 0x19, 0x63, 0xA0, 0x8C, 0x69, 0xB0, 0xB8, 0xF6, 0x71, 0x15, 0x62, 0x47,
+    0x23, 0x0E, 0xC2, 0x52, 0x95, 0x5A, 0x22, 0xDA, 0xA6, 0xC1, 0xEB, 0x04, 0xC1, 0x07, 0xF1, 0x35,
+    0x22, 0x60, 0x2F, 0x41, 0x43, 0x0D, 0x8D, 0x11, 0xC2, 0x48, 0x65, 0x2A, 0x73, 0x4B, 0xBF, 0xC0,
+    0xC0, 0xAD, 0x68, 0xD2, 0xC0, 0xAD, 0x06, 0xC0, 0x4A, 0x48, 0xFB, 0x77, 0x09, 0x9C, 0xD3, 0x9C,
+    0x18, 0x44, 0x0B, 0xEA, 0x0E, 0x3A, 0x35, 0x26, 0x0A, 0x8D, 0xC9, 0x3B, 0x17, 0x4D, 0xE7, 0xC1,
+    0xBA, 0x9A, 0x09, 0xF8, 0xDF, 0xA9, 0x82, 0x52, 0xDE, 0x19, 0xF9, 0x44, 0xF6, 0x06, 0x70, 0x6B,
+    0x91, 0xEB, 0x28, 0x8C, 0xE0, 0x97, 0xF4, 0x8F, 0xB1, 0x98, 0xA8, 0xB7, 0x44, 0x77, 0x8C, 0x18,
+    0x86, 0x32, 0x79, 0xE2, 0xC4, 0x95, 0x63, 0xC2, 0x14, 0x82, 0x46, 0x00, 0x0C, 0x44, 0x53, 0x13,
+    0x80, 0xC1, 0x12, 0xA3, 0x97, 0xF8, 0xA5, 0x60, 0x8E, 0xC1, 0x54, 0xA9, 0x8C, 0x7F, 0xDC, 0xF6,
+    0x25, 0x8D, 0xF5, 0x09, 0x35, 0xFC, 0x56, 0x6C, 0x05, 0x1F, 0xBE, 0x00, 0x38, 0x02, 0x48, 0xF7,
+    0x73, 0x42, 0xAC, 0x32, 0x8A, 0x30, 0x6A, 0x10, 0x14, 0xB4, 0x96, 0xA4, 0xEB, 0x08, 0x0D, 0x2F,
+    0xC1, 0x2F, 0x19, 0x7E, 0x98, 0x4E, 0xBD, 0x7B, 0x72, 0xB8, 0x58, 0xA2, 0x24, 0xA8, 0xF7, 0xA3,
+    0xEA, 0x62, 0x56, 0x59, 0x0C, 0xAF, 0x62, 0x34, 0x63, 0xA8, 0xAF, 0xBC, 0x87, 0xF8, 0x7B, 0xD5,
+    0x45, 0x6C, 0x8F, 0xAF, 0x2F, 0x7D, 0xB1, 0x59, 0x33, 0x85, 0xCA, 0xE6, 0x17, 0xAB, 0xF0, 0x1F,
+    0x97, 0x93, 0xE1, 0x70, 0xEB, 0xC0, 0x72, 0x88, 0x2C, 0x9A, 0x2E, 0xF6, 0xD1, 0xD7, 0x5E, 0x16,
+    0x62, 0x63, 0x2A, 0x95, 0xD8, 0x39, 0xBB, 0xB3, 0x75, 0xB0, 0x29, 0x19, 0x4A, 0xF0, 0x77, 0xE6,
+    0x8F, 0xFD, 0xF5, 0x3D, 0x61, 0xB7, 0x69, 0xA7, 0xF3, 0xD9, 0x5D, 0x5E, 0x31, 0xCB, 0xE2, 0x59,
+    0x96, 0x35, 0x72, 0xE1, 0x5A, 0x58, 0xA0, 0xB2, 0xAB, 0x84, 0xC2, 0x21, 0xE1, 0xAF, 0xCA, 0x74,
+    0xEE, 0xA4, 0xA5, 0x24, 0xA4, 0x81, 0x36, 0x6D, 0x0C, 0x67, 0xB8, 0x69, 0x6B, 0xC9, 0x5E, 0xA8,
+    0xE5, 0x7C, 0x77, 0xFE, 0x73, 0xC2, 0xF6, 0x8D, 0x08, 0x65, 0x4B, 0x99, 0x0B, 0x5B, 0x97, 0xEA,
+    0xAF, 0x6E, 0xC0, 0x16, 0x9C, 0x53, 0x93, 0xC5, 0x7E, 0x41, 0x42, 0xF6, 0x92, 0xD1, 0x9C, 0x88,
+    0x41, 0xF5, 0x92, 0x98, 0xE4, 0x86, 0xE9, 0xA7, 0x35, 0x8C, 0xD9, 0x2F, 0x90, 0xD6, 0x96, 0xC5,
+    0x83, 0x19, 0xB3, 0x2D, 0x9D, 0x7B, 0x7B, 0xC2, 0xD3, 0x52, 0x0A, 0x49, 0xF0, 0x43, 0x81, 0xDF,
+    0x96, 0x3A, 0x12, 0x47, 0xC1, 0x9C, 0xA8, 0xCB, 0xCC, 0x37, 0x39, 0xF9, 0xAE, 0xE4, 0xC0, 0x1E,
+    0xFC, 0xA2, 0xE8, 0x96, 0x88, 0x2A, 0x8A, 0xBC, 0x5C, 0xED, 0x96, 0x2A, 0xD2, 0x2A, 0x5B, 0x46,
+    0xA3, 0xF3, 0x6A, 0xBD, 0xD4, 0xCC, 0x49, 0xC6, 0x29, 0xC6, 0x8D, 0x31, 0xEB, 0x87, 0x5A, 0x6C,
+    0x29, 0xB9, 0xDC, 0x95, 0x54, 0xE6, 0xB2, 0x1C, 0xF5, 0xE9, 0x5C, 0xEB, 0x21, 0x3C, 0x0F, 0x3A,
+    0x1A, 0x5D, 0x1C, 0x7E, 0x62, 0xC7, 0x06, 0x47, 0xEC, 0x3F, 0x9F, 0xE8, 0xCF, 0x87, 0x93, 0x9E,
+    0x69, 0x47, 0xAE, 0x29, 0x46, 0x08, 0x98, 0x08, 0x7F, 0x36, 0x22, 0xAA, 0xC3, 0x8E, 0xED, 0x19,
+    0x6C, 0xF3, 0xBB, 0x97, 0xC7, 0x91, 0xFA, 0xC4, 0x18, 0x85, 0xCB, 0x0F, 0xCC, 0x0B, 0xBF, 0x21,
+    0x69, 0xD4, 0x17, 0x6E, 0x8D, 0xA9, 0xE3, 0x1F, 0xF2, 0x65, 0x70, 0x9D, 0x97, 0xC5, 0x69, 0xF4,
+    0xBF, 0x1C, 0x81, 0x49, 0x56, 0x62, 0x53, 0xE9, 0xE3, 0x47, 0x4C, 0x0C, 0x26, 0x3A, 0xC1, 0x40,
+    0xDA, 0xDB, 0x9F, 0x0E, 0xCC, 0x1E, 0xB7, 0x63, 0x37, 0xEB, 0x28, 0xE2, 0x9D, 0xB5, 0x43, 0x59,
+    0xD2, 0x04, 0x69, 0x04, 0xF9, 0x0C, 0xB0, 0x23, 0x85, 0x89, 0xB4, 0x52, 0x39, 0xA9, 0x5B, 0x2F,
+    0xC9, 0xB5, 0x7B, 0x65, 0x4D, 0xD2, 0xF0, 0x2B, 0x52, 0xD8, 0x1E, 0xAC, 0xF6, 0x8F, 0xFA, 0xFD,
+    0x3E, 0x93, 0x28, 0x4F, 0xD5, 0x2D, 0xB9, 0x33, 0xB1, 0xE0, 0x1D, 0xE3, 0xA0, 0x72, 0xBB, 0x08,
+    0x92, 0xB8, 0xEA, 0x1C, 0x77, 0x45, 0x35, 0x55, 0x24, 0xD7, 0xE0, 0x50, 0xDF, 0xBC, 0x7A, 0x22,
+    0x8E, 0x08, 0x51, 0xDA, 0xDE, 0x65, 0x95, 0x16, 0x56, 0xCF, 0xA2, 0xF5, 0xD9, 0xFE, 0xA5, 0x24,
+    0x39, 0x1D, 0xAD, 0x95, 0x6C, 0xA3, 0x68, 0xD5, 0x3D, 0x36, 0xE5, 0x9D, 0xF7, 0x35, 0x9D, 0x55,
+    0x72, 0xC3, 0x3A, 0x3D, 0x18, 0xA6, 0xF7, 0x6D, 0x14, 0xB7, 0xD9, 0x67, 0x36, 0x61, 0x3D, 0x48,
+    0xC4, 0xD3, 0x1E, 0x6C, 0xAB, 0x22, 0xB4, 0x05, 0xD1, 0xDE, 0x7D, 0xC6, 0x13, 0x18, 0xC3, 0xAF,
+    0x8D, 0x4C, 0x70, 0x1E, 0xE2, 0x62, 0x62, 0xD2, 0xB3, 0xC4, 0x24, 0xB3, 0xC4, 0xF8, 0x5D, 0x62,
+    0xF4, 0x59, 0x62, 0x9C, 0x7A, 0x29, 0xE8, 0x12, 0xA3, 0xFF, 0x55, 0x62, 0x8E, 0xCF, 0x99, 0x4F,
+    0x2F, 0xB3, 0x99, 0x43, 0xCE, 0xCE, 0x6F, 0xDD, 0xB4, 0xF3, 0x4F, 0xA5, 0x55, 0x3D, 0x6F, 0xD4,
+    0x40, 0x10, 0x1D, 0xDB, 0x0A, 0x57, 0xB8, 0x70, 0x43, 0x05, 0x85, 0x7F, 0xC2, 0xD6, 0x34, 0x5E,
+    0x23, 0x8A, 0x94, 0x69, 0x72, 0x15, 0x05, 0xFF, 0x80, 0xFC, 0x82, 0xD8, 0x96, 0xF8, 0x03, 0x14,
+    0x48, 0xB4, 0x14, 0x50, 0x70, 0x14, 0xA9, 0x91, 0x72, 0xB1, 0x25, 0x0A, 0x0A, 0x0A, 0x0E, 0x21,
+    0x6A, 0xDC, 0x20, 0x01, 0xD5, 0x22, 0x39, 0xC2, 0x42, 0xB6, 0x97, 0xF7, 0xD6, 0xBE, 0x0F, 0x85,
+    0x10, 0x40, 0x58, 0xB7, 0xEF, 0x7C, 0xB3, 0xBB, 0x33, 0x6F, 0xDE, 0xCC, 0xEE, 0x89, 0xB8, 0x67,
+    0x66, 0x57, 0x22, 0xA1, 0xB5, 0x22, 0xD1, 0xF9, 0x3D, 0x23, 0x61, 0x2D, 0x43, 0x74, 0xC7, 0x48,
+    0xF4, 0xEA, 0x5D, 0x2B, 0x81, 0x69, 0x96, 0x22, 0x4B, 0x5D, 0x7E, 0x5D, 0x94, 0xFB, 0x16, 0xCF,
+    0xEA, 0xE6, 0x8F, 0xC5, 0xE2, 0xA9, 0xF4, 0xDC, 0xA8, 0x52, 0xEE, 0xAE, 0xF9, 0xDA, 0xB9, 0xDF,
+    0x15, 0x20, 0x18, 0x6E, 0xDF, 0x17, 0xD1, 0xD6, 0x16, 0xE2, 0x11, 0x64, 0x66, 0x38, 0xD7, 0x12,
+    0x12, 0x42, 0x54, 0x70, 0x55, 0xBD, 0x31, 0xE2, 0x29, 0xED, 0x89, 0x35, 0xF9, 0xC3, 0xA8, 0x0A,
+    0x0C, 0x3C, 0x69, 0xF9, 0xD3, 0x4B, 0x1F, 0xDA, 0x81, 0x7C, 0xD7, 0x4F, 0x22, 0xA7, 0xEE, 0xBB,
+    0x0F, 0x5C, 0x2C, 0xB1, 0x36, 0x1D, 0xBF, 0x1B, 0xF9, 0xE5, 0x89, 0x2A, 0x99, 0xAD, 0x90, 0x57,
+    0x5C, 0x08, 0x3E, 0xAA, 0xD0, 0xA9, 0x64, 0xE2, 0xD1, 0xB5, 0xD7, 0x72, 0x32, 0x63, 0x46, 0x67,
+    0xF0, 0x85, 0x69, 0x52, 0xEF, 0x60, 0xD1, 0x82, 0x49, 0xAF, 0xF5, 0xC1, 0x37, 0x68, 0x66, 0x75,
+    0x8C, 0x3C, 0xE9, 0xA0, 0x73, 0xE2, 0x59, 0xCB, 0x5C, 0x22, 0x3B, 0x12, 0x2A, 0xAD, 0x1D, 0x64,
+    0x9C, 0xA6, 0x46, 0x3A, 0xCD, 0xE0, 0x5B, 0xFC, 0xCE, 0x6B, 0x83, 0x96, 0xC1, 0x67, 0x35, 0x39,
+    0x0E, 0x70, 0x1E, 0x1A, 0x4A, 0x93, 0x49, 0x54, 0x63, 0x95, 0x8B, 0x0D, 0xFF, 0x88, 0xAD, 0x2A,
+    0xF8, 0x07, 0x35, 0x9D, 0xC2, 0x41, 0x26, 0x92, 0x63, 0x21, 0xA6, 0xC9, 0xC9, 0x7B, 0xE2, 0x3F,
+    0x64, 0xAC, 0xD4, 0x09, 0xD9, 0xC7, 0x4E, 0xEF, 0x31, 0xC9, 0x6B, 0x9F, 0x2F, 0xE4, 0x89, 0x30,
+    0x4A, 0xFC, 0x26, 0x2E, 0x02, 0x06, 0x59, 0x4E, 0xD2, 0x05, 0xC6, 0x6F, 0xE0, 0x5C, 0xD3, 0xF1,
+    0x32, 0x30, 0xC8, 0x37, 0x30, 0x1A, 0x26, 0x89, 0x1F, 0x9F, 0x9F, 0x8D, 0xF4, 0x2B, 0x97, 0x0C,
+    0x62, 0xFB, 0xAD, 0xA6, 0x00, 0x79, 0x60, 0x54, 0x81, 0xCD, 0x1A, 0x92, 0xF8, 0x2D, 0x5D, 0x48,
+    0x0E, 0x6F, 0xAA, 0x18, 0x4B, 0x01, 0xD2, 0x1A, 0x89, 0xE4, 0x2E, 0x60, 0x81, 0x3A, 0xA8, 0x07,
+    0x06, 0xF9, 0xC2, 0x73, 0x8C, 0x2D, 0x48, 0xBE, 0xC3, 0x0B, 0x17, 0xC2, 0x45, 0xB4, 0x12, 0x7A,
+    0x91, 0x0E, 0x39, 0x07, 0x06, 0xF1, 0xA2, 0x37, 0xD0, 0x4E, 0x97, 0xCF, 0x59, 0x32, 0xBB, 0x0A,
+    0x00, 0x06, 0x6B, 0x72, 0x03, 0xC1, 0x63, 0x03, 0xDD, 0xA2, 0xF7, 0x20, 0xA0, 0xDE, 0x82, 0x92,
+    0xD6, 0xCC, 0x98, 0x52, 0x7E, 0x87, 0x29, 0xFC, 0x08, 0x93, 0xCA, 0x61, 0x5A, 0x8E, 0xA9, 0xBA,
+    0xBA, 0x3A, 0x8D, 0x50, 0x21, 0x40, 0x5E, 0xC9, 0xA7, 0x7B, 0x1D, 0xC4, 0x41, 0x3A, 0x91, 0x53,
+    0xE8, 0x90, 0x6D, 0xE2, 0x37, 0x89, 0x84, 0xAB, 0x04, 0x44, 0x13, 0xAC, 0x4D, 0xC0, 0x3D, 0x81,
+    0xE2, 0x09, 0xD4, 0x4E, 0x32, 0x36, 0x6D, 0xC3, 0xC6, 0x4D, 0xF5, 0xB3, 0xB2, 0xC6, 0x3A, 0xAC,
+    0xF5, 0x3B, 0x28, 0xCD, 0xB1, 0xC4, 0x38, 0xC6, 0xC8, 0x12, 0x57, 0x13, 0x39, 0x9E, 0x42, 0x83,
+    0x10, 0xEB, 0x8B, 0x98, 0x2F, 0x8F, 0x6A, 0xA8, 0x57, 0x89, 0xEA, 0x47, 0xFD, 0x7D, 0xCB, 0x2E,
+    0x0C, 0x76, 0xB1, 0xE6, 0x89, 0x19, 0x11, 0x2D, 0xB8, 0xC1, 0xB0, 0x22, 0x46, 0xBF, 0x62, 0x41,
+    0x8C, 0x1D, 0x4E, 0x1F, 0x77, 0xE6, 0xF4, 0x0E, 0x66, 0x0E, 0x97, 0x0E, 0xBB, 0x2D, 0xEE, 0x23,
+    0x63, 0xF5, 0xC5, 0x52, 0xBC, 0x9E, 0x05, 0x55, 0xDD, 0xF5, 0xCD, 0x79, 0xF3, 0x5C, 0xBF, 0xF8,
+    0x46, 0xD6, 0xCA, 0xF1, 0xC4, 0x53, 0xC0, 0x15, 0x71, 0x0F, 0x11, 0x49, 0xD6, 0x81, 0x5A, 0x94,
+    0x0C, 0xAA, 0x26, 0xD0, 0x1B, 0x48, 0xC6, 0xD8, 0x80, 0x63, 0xC2, 0xE9, 0x18, 0x78, 0x02, 0x04,
+    0x50, 0x29, 0xBB, 0x21, 0x45, 0x99, 0xD5, 0x23, 0x6A, 0xD2, 0x59, 0x72, 0xD8, 0x50, 0x20, 0x03,
+    0xCF, 0xAC, 0xE3, 0xBB, 0xBB, 0x60, 0xBC, 0x46, 0x78, 0x8E, 0xBD, 0x0B, 0x05, 0xBE, 0xA4, 0xE6,
+    0x5B, 0x13, 0x2E, 0xA3, 0x32, 0x87, 0xBA, 0x3D, 0xEF, 0xA6, 0x7F, 0xD9, 0x78, 0x79, 0xFF, 0xE4,
+    0xEB, 0xFE, 0xD1, 0xE8, 0x9F, 0xBB, 0x53, 0xFF, 0x84, 0xB6, 0x5D, 0xF7, 0x8F, 0xC4, 0x07, 0xF8,
+    0x8D, 0xA6, 0xF4, 0x9B, 0x8E, 0xD7, 0x22, 0x9C, 0x6C, 0x0C, 0xFD, 0x7C, 0xDE, 0xA3, 0x7B, 0xEC,
+    0x01, 0xC6, 0xE5, 0x2B, 0x76, 0x0D, 0x10, 0x9B, 0xC7, 0xCE, 0xC5, 0x67, 0x6B, 0xF3, 0x2C, 0xA3,
+    0x02, 0xB7, 0x8E, 0x70, 0xF1, 0xA2, 0x6E, 0x9E, 0xDD, 0xEA, 0xD1, 0x90, 0x9A, 0x4A, 0xC9, 0xFD,
+    0x6F, 0x5F, 0xED, 0x62, 0xF1, 0xA2, 0xE1, 0x95, 0x64, 0x53, 0xC2, 0xBF, 0x7B, 0xF8, 0xC2, 0x57,
+    0xEB, 0x54, 0xEA, 0x64, 0xAD, 0xCE, 0x58, 0x3C, 0x77, 0xEB, 0x8F, 0x8D, 0x93, 0x6D, 0xFB, 0xE6,
+    0xD0, 0xA9, 0x93, 0xBA, 0xAE, 0xFC, 0x3D, 0xCC, 0xE7, 0x47, 0x29, 0x35, 0x9A, 0xE0, 0xAA, 0xC5,
+    0x8F, 0x08, 0x9D, 0xFE, 0xCB, 0xBE, 0x01, 0x93, 0xE0, 0x1B, 0x2F, 0xD8, 0xD7, 0xBC, 0x50, 0x70,
+    0x66, 0xA4, 0xBB, 0xD2, 0x84, 0xFD, 0x9A, 0x39, 0x75, 0x7A, 0xE5, 0x95, 0x86, 0x6C, 0x2A, 0x6D,
+    0x87, 0x5C, 0x6E, 0x2C, 0x28, 0xC2, 0x4E, 0x47, 0xE8, 0xF5, 0xBF, 0x1B, 0x4D, 0xDE, 0x49, 0xC5,
+    0x7F, 0x4A, 0x99, 0x48, 0x9D, 0xAE, 0xCF, 0x51, 0xC8, 0x95, 0x4A, 0x76, 0x4D, 0x1E, 0x8F, 0x86,
+    0x64, 0xCB, 0xDF, 0x0C, 0x30, 0xC9, 0x72, 0xF1, 0x07, 0xFD, 0xE1, 0x68, 0x88, 0xEC, 0x90, 0xF9,
+    0xB6, 0xCE, 0x26, 0x41, 0xA7, 0xB1, 0xC7, 0xEB, 0x71, 0x98, 0x46, 0x75, 0xF9, 0xF8, 0xCF, 0xE7,
+    0x27, 0xCD, 0x55, 0x3D, 0x8F, 0xDC, 0x54, 0x14, 0xBD, 0xF6, 0x28, 0xEB, 0xC2, 0xC5, 0xDB, 0x86,
+    0xA5, 0xA0, 0x70, 0x4F, 0xE3, 0x5F, 0x30, 0xF3, 0x5C, 0x41, 0x4B, 0x11, 0xEA, 0xF4, 0x50, 0xCC,
+    0x1F, 0x48, 0xC6, 0x8E, 0xF8, 0x03, 0x29, 0x48, 0xCD, 0x36, 0x48, 0x91, 0x53, 0x6C, 0x4B, 0xB1,
+    0x1B, 0x1B, 0x51, 0x50, 0x62, 0x10, 0x3D, 0x96, 0x36, 0x05, 0xA4, 0x89, 0x45, 0x2C, 0xC5, 0xBB,
+    0xBC, 0xF1, 0xE5, 0x9C, 0xEB, 0x51, 0x36, 0x10, 0x45, 0x48, 0x28, 0x45, 0xAC, 0xF5, 0x3B, 0xD6,
+    0xDE, 0xF7, 0xEE, 0x3D, 0xE7, 0x7E, 0xBC, 0x69, 0x2A, 0x91, 0x48, 0x45, 0x5B, 0x91, 0x15, 0xA0,
+    0x17, 0x49, 0x00, 0x83, 0x48, 0xAA, 0x32, 0x8F, 0x22, 0xAE, 0x91, 0x30, 0x89, 0x64, 0x5E, 0x42,
+    0x10, 0xF1, 0x80, 0x7B, 0x22, 0x6B, 0x80, 0x17, 0x39, 0x07, 0xE4, 0x22, 0x13, 0x20, 0xAB, 0xA2,
+    0x11, 0xE0, 0xDA, 0x78, 0x00, 0xA4, 0xDD, 0xAA, 0x07, 0xAC, 0xFA, 0xA4, 0x25, 0x0C, 0x8E, 0x10,
+    0x8D, 0xAE, 0x00, 0xF0, 0x08, 0xE1, 0x7C, 0x63, 0xB0, 0xBB, 0x67, 0xE0, 0x83, 0x41, 0x3E, 0x19,
+    0xB8, 0x41, 0xFC, 0xA3, 0x05, 0x10, 0x35, 0xE9, 0xC4, 0x83, 0x02, 0x9F, 0xD1, 0xD6, 0x78, 0x30,
+    0x58, 0x2D, 0x90, 0xF4, 0x06, 0xAE, 0x33, 0xC8, 0x5A, 0x83, 0x5B, 0xE2, 0xF1, 0xA1, 0xE2, 0x3B,
+    0xAA, 0xF3, 0x3D, 0xC5, 0xF9, 0x81, 0xEB, 0x66, 0x94, 0xF4, 0xB9, 0xAC, 0xE1, 0xFD, 0x4C, 0xD6,
+    0x77, 0x25, 0xDB, 0xCA, 0x1A, 0x4C, 0x72, 0x59, 0x2F, 0x7F, 0xAE, 0x38, 0xE7, 0xDA, 0x4E, 0x58,
+    0x93, 0xEF, 0x07, 0xAC, 0xAB, 0x4B, 0xAE, 0xF1, 0xCB, 0x0E, 0x6B, 0xA4, 0x2D, 0x56, 0xD1, 0x2A,
+    0xBF, 0xBD, 0x96, 0x52, 0xF2, 0xB0, 0x06, 0xDF, 0x7C, 0xBA, 0xE1, 0xB6, 0x50, 0x5B, 0x98, 0xAD,
+    0x8C, 0x58, 0x6A, 0xBC, 0xDC, 0x42, 0x4B, 0x1A, 0x3D, 0xD3, 0xA1, 0x7C, 0xE0, 0x5A, 0x6C, 0xA1,
+    0xE4, 0xFF, 0xFA, 0xD8, 0xA7, 0x3A, 0xAB, 0xCA, 0x41, 0x36, 0x3D, 0x66, 0xD5, 0x85, 0xF9, 0x69,
+    0x59, 0xB7, 0x45, 0xFA, 0xAB, 0x67, 0x89, 0xEB, 0x2B, 0x86, 0x0D, 0xFC, 0x54, 0x06, 0xCF, 0x76,
+    0x34, 0xFD, 0x49, 0xDB, 0x26, 0x2B, 0xC8, 0x88, 0xB6, 0x40, 0x62, 0x59, 0xB5, 0x33, 0xBF, 0xB0,
+    0x41, 0x47, 0x41, 0xB2, 0xB0, 0x05, 0xD2, 0xCD, 0x54, 0x67, 0x89, 0x55, 0xD1, 0x0B, 0xBE, 0xAE,
+    0x9B, 0x02, 0x69, 0x8E, 0x26, 0x5A, 0x5D, 0xCB, 0x1C, 0x3F, 0x89, 0x47, 0xC6, 0xF3, 0x8C, 0xF7,
+    0x29, 0x68, 0x44, 0x53, 0x30, 0x99, 0xD1, 0x69, 0xFC, 0x20, 0xE9, 0x5C, 0xE1, 0x7E, 0x86, 0x17,
+    0x84, 0x3F, 0xFA, 0xFD, 0x15, 0xBB, 0x4C, 0xBB, 0x44, 0xB5, 0x77, 0x5F, 0x6F, 0xBB, 0x63, 0xC9,
+    0x2B, 0x86, 0x64, 0x2C, 0xB2, 0xFE, 0xA2, 0x69, 0x1B, 0x55, 0x77, 0xFD, 0x79, 0x98, 0x65, 0xF5,
+    0x72, 0x10, 0xF7, 0x5B, 0x25, 0x7E, 0x27, 0xD1, 0x1E, 0x4E, 0x5E, 0x4C, 0xB1, 0xFE, 0xA8, 0x7A,
+    0x27, 0xD1, 0xFE, 0xAE, 0xDC, 0xC6, 0x91, 0x48, 0x8E, 0x8D, 0x7F, 0xCB, 0x78, 0x8C, 0xFA, 0x5D,
+    0x52, 0xC9, 0x9B, 0xCF, 0x7B, 0x90, 0x0C, 0x39, 0x8E, 0x84, 0x93, 0x90, 0x81, 0xE6, 0x3A, 0xFE,
+    0x47, 0xB1, 0xDE, 0x55, 0x32, 0xD8, 0x0A, 0xAA, 0x10, 0x52, 0x02, 0x20, 0xC2, 0x03, 0x40, 0x26,
+    0xFB, 0x6A, 0x58, 0x86, 0xC2, 0x94, 0x27, 0x46, 0x4D, 0xE2, 0x71, 0x69, 0xC3, 0xB0, 0xA4, 0xE6,
+    0x42, 0xCC, 0xE8, 0x2D, 0x34, 0x04, 0xBB, 0x67, 0xF5, 0x29, 0xBB, 0x4E, 0x75, 0xA2, 0x76, 0x4A,
+    0xC6, 0x46, 0x1A, 0xA9, 0x9C, 0x27, 0x2D, 0x01, 0x08, 0x55, 0xD7, 0xC1, 0x0E, 0x9A, 0x31, 0xAB,
+    0xAC, 0xBB, 0xF1, 0xD2, 0x6D, 0x32, 0x2C, 0x32, 0xC0, 0x01, 0x99, 0xBA, 0xCF, 0x14, 0x81, 0xD0,
+    0x9E, 0xB7, 0x8B, 0xEE, 0x0F, 0xDA, 0x8F, 0x74, 0x8C, 0x95, 0x01, 0x42, 0xA9, 0x7D, 0x7C, 0xF5,
+    0xE1, 0x5F, 0x63, 0xD6, 0x47, 0x9C, 0x4D, 0xFA, 0x49, 0x47, 0x7A, 0xE4, 0x1C, 0xD3, 0x79, 0x49,
+    0x6F, 0x27, 0x8F, 0xE7, 0xFA, 0xF1, 0x90, 0x2A, 0x9F, 0x56, 0xBF, 0xDD, 0x3E, 0xAB, 0x6B, 0xD7,
+    0xCB, 0xCE, 0xCC, 0x51, 0x60, 0xBA, 0x25, 0x1D, 0xEC, 0x22, 0xF0, 0x1C, 0x90, 0x36, 0xB6, 0x44,
+    0x54, 0xE5, 0x9D, 0xA7, 0x27, 0x5D, 0xA9, 0x23, 0x8A, 0x57, 0x94, 0x33, 0x32, 0x3E, 0xCA, 0xAD,
+    0x42, 0xA2, 0xCF, 0x8C, 0x03, 0xAE, 0xA3, 0xB4, 0x83, 0x74, 0x6C, 0x6D, 0xC6, 0x03, 0x2F, 0x44,
+    0xD8, 0x23, 0xC4, 0x73, 0x40, 0x58, 0x46, 0xF6, 0x4D, 0xB8, 0xAE, 0x1F, 0x61, 0xCB, 0x4F, 0xE0,
+    0xFE, 0xD6, 0x2D, 0x80, 0xB9, 0xAE, 0xBF, 0x51, 0x4E, 0x2E, 0x26, 0xF4, 0x34, 0x3E, 0x95, 0x8D,
+    0x80, 0x22, 0x26, 0x42, 0x98, 0x83, 0xA3, 0xE9, 0xB5, 0x3E, 0x68, 0xAE, 0x98, 0xD6, 0x5E, 0xE6,
+    0x4F, 0x66, 0xD9, 0xE3, 0xEC, 0x4E, 0xE2, 0x09, 0xBD, 0xE7, 0xE1, 0xC5, 0xFD, 0x70, 0x0D, 0xD9,
+    0xF0, 0x11, 0x90, 0xC9, 0x9A, 0x6E, 0xAD, 0x6E, 0xFB, 0xC3, 0x2D, 0xB7, 0xA2, 0x9B, 0xF2, 0xD7,
+    0x13, 0xF6, 0xD1, 0x28, 0x39, 0xAB, 0xFE, 0x81, 0xDC, 0x28, 0x29, 0xB8, 0x68, 0x25, 0xCD, 0x1F,
+    0x5F, 0xAA, 0x1C, 0x21, 0x3B, 0x56, 0x6C, 0x67, 0x4D, 0x58, 0x5A, 0x37, 0x4C, 0x37, 0xF7, 0x65,
+    0xB8, 0xB9, 0x41, 0x2F, 0xD8, 0x41, 0x7A, 0xC9, 0x65, 0x66, 0xDC, 0xB3, 0xCB, 0xC1, 0xFE, 0x8B,
+    0x16, 0x73, 0xBF, 0x30, 0x53, 0x81, 0xE5, 0xC9, 0x2B, 0x2B, 0x72, 0xDA, 0xDB, 0x25, 0x8B, 0xFE,
+    0x6C, 0x23, 0x7D, 0xB8, 0x1D, 0xF1, 0xE3, 0x41, 0x85, 0xA9, 0x95, 0xFA, 0x90, 0x69, 0x94, 0xFB,
+    0x0A, 0xF4, 0x70, 0x73, 0x3E, 0xDC, 0x0E, 0x07, 0xDA, 0x8C, 0xF7, 0xE4, 0x40, 0xC4, 0x7F, 0x8C,
+    0x89, 0x62, 0xF7, 0xF2, 0x45, 0xCD, 0x37, 0x78, 0x77, 0x08, 0x17, 0x50, 0xC8, 0xC9, 0x8D, 0x1F,
+    0x0D, 0x2B, 0x36, 0x5F, 0x33, 0xC3, 0x61, 0xF1, 0xAF, 0xE1, 0xDF, 0xBF, 0x6D, 0xF8, 0xDF, 0x23,
+    0xFD, 0x91, 0xE0, 0x87, 0xAF, 0x8A, 0x27, 0x04, 0x1A, 0x5C, 0xF1, 0x3A, 0xC9, 0x77, 0x9A, 0x97,
+    0xFF, 0xFB, 0xFC, 0x0D, 0xC5, 0x95, 0xB1, 0x8E, 0xDD, 0x54, 0x10, 0x86, 0xC7, 0xC7, 0xC9, 0xBA,
+    0x70, 0xE1, 0x34, 0x54, 0x14, 0xEE, 0xD3, 0xF8, 0x05, 0x88, 0x8F, 0x25, 0x5E, 0x60, 0x0B, 0x6E,
+    0x45, 0x41, 0x0F, 0xC5, 0xB6, 0x29, 0x92, 0x6B, 0x4B, 0x79, 0x81, 0x34, 0x11, 0x2F, 0x40, 0x75,
+    0x29, 0x78, 0x81, 0xBD, 0x7B, 0x2D, 0x52, 0x50, 0x62, 0x29, 0xA2, 0xA2, 0xE0, 0x4A, 0x10, 0x21,
+    0x2A, 0x8C, 0x30, 0xD2, 0x59, 0xC9, 0xF7, 0x4E, 0xBE, 0x39, 0xDE, 0xB0, 0x64, 0xB3, 0x40, 0x11,
+    0x24, 0x8E, 0xF6, 0xEC, 0xF1, 0xCE, 0xB1, 0xFF, 0x99, 0x7F, 0xE6, 0x9F, 0x59, 0x11, 0x91, 0x3B,
+    0x62, 0xAB, 0x6C, 0x42, 0x3C, 0xB7, 0xD9, 0x3E, 0x9E, 0x63, 0xD1, 0xC8, 0xDF, 0xAD, 0xA2, 0x97,
+    0x6C, 0x90, 0x74, 0x2C, 0x3B, 0xE1, 0xA7, 0xEA, 0x7C, 0x23, 0x6B, 0x49, 0x66, 0xF1, 0x92, 0x04,
+    0xBB, 0x5C, 0x0B, 0x20, 0x17, 0x22, 0x07, 0xAE, 0xB3, 0x51, 0x64, 0xC6, 0xE2, 0x85, 0xCB, 0x24,
+    0x38, 0xBC, 0xA4, 0x53, 0xB6, 0x2F, 0x7B, 0x89, 0x00, 0x33, 0x70, 0x99, 0xAA, 0x9A, 0xD3, 0x82,
+    0xD3, 0xE0, 0x77, 0xAA, 0x47, 0x59, 0xAE, 0x0F, 0x9C, 0xBE, 0x59, 0x83, 0x2D, 0x6E, 0x4E, 0x42,
+    0x1A, 0xCC, 0x79, 0xB6, 0x4F, 0x01, 0x3D, 0x02, 0x9E, 0x8F, 0x02, 0xFE, 0x5A, 0x8A, 0x3D, 0x6F,
+    0x45, 0xDF, 0xE0, 0xE3, 0xBB, 0xEA, 0xC1, 0x27, 0x34, 0xDF, 0x00, 0xB0, 0x16, 0x69, 0x79, 0x91,
+    0x6B, 0x8B, 0x49, 0xEE, 0x25, 0x0B, 0x85, 0x73, 0x3B, 0xE6, 0x7C, 0xE0, 0x77, 0xDE, 0x3D, 0xBA,
+    0x95, 0x27, 0x6E, 0x2A, 0x71, 0x53, 0xD9, 0xA5, 0xE6, 0x64, 0x0B, 0x87, 0xA2, 0x4F, 0xC7, 0x74,
+    0x74, 0x13, 0xE0, 0xDE, 0x80, 0xB7, 0xE9, 0x08, 0xDF, 0x74, 0xF4, 0x98, 0xA4, 0xFC, 0xFC, 0x8F,
+    0x8B, 0x25, 0xFC, 0x3E, 0x92, 0xC1, 0xB7, 0x0B, 0xDE, 0x12, 0xD0, 0xA6, 0x63, 0xD5, 0xF1, 0xB1,
+    0x27, 0x25, 0x2E, 0x18, 0x84, 0xB4, 0xA0, 0x55, 0x9D, 0xE1, 0xC9, 0x81, 0xA0, 0x3D, 0x44, 0xDA,
+    0xE8, 0xB0, 0x93, 0xE6, 0x8E, 0x05, 0xD6, 0x8B, 0xE7, 0xCF, 0xBC, 0x7B, 0xF8, 0x66, 0x4C, 0x95,
+    0x06, 0x69, 0xC9, 0x57, 0xF1, 0xCB, 0x67, 0xC7, 0xA4, 0x11, 0x6F, 0x79, 0xC4, 0x77, 0xA4, 0x56,
+    0x51, 0xB2, 0x02, 0x42, 0xE6, 0x92, 0xFD, 0xE9, 0x0E, 0x38, 0x1D, 0x24, 0x57, 0xED, 0x30, 0x58,
+    0xAA, 0x7D, 0x17, 0x59, 0x59, 0x69, 0x2C, 0xB1, 0xB1, 0x94, 0x92, 0xFD, 0xC6, 0x0E, 0x17, 0xAB,
+    0xB3, 0xB9, 0x52, 0x0D, 0x27, 0xAA, 0x3F, 0x89, 0x7C, 0x44, 0xB9, 0xE4, 0x9E, 0x9C, 0x67, 0x43,
+    0xD1, 0x6F, 0xE5, 0x61, 0xDA, 0x5F, 0x47, 0x90, 0xEC, 0xB4, 0x21, 0x82, 0xF4, 0xE5, 0xFB, 0x64,
+    0xD4, 0xEA, 0x38, 0x47, 0x18, 0x17, 0xDC, 0xE6, 0x48, 0x68, 0x4D, 0x6A, 0xD5, 0x73, 0x18, 0x2D,
+    0xB7, 0xE4, 0xC8, 0x04, 0x75, 0xB8, 0x94, 0xF6, 0x5B, 0xD5, 0xA9, 0x25, 0xFA, 0xBB, 0xA7, 0xE2,
+    0xA9, 0xB0, 0x55, 0xFB, 0xC9, 0x52, 0xF9, 0xE2, 0xB6, 0x3D, 0x5C, 0xED, 0x4B, 0x22, 0x36, 0x44,
+    0x42, 0xC3, 0xB7, 0x12, 0x73, 0xFE, 0x9A, 0x00, 0xB9, 0x92, 0x7C, 0x6F, 0x59, 0xB6, 0x52, 0x72,
+    0xA3, 0xFE, 0xE9, 0x89, 0x46, 0x19, 0xED, 0x94, 0xEF, 0xDE, 0xC3, 0x84, 0xAB, 0x89, 0x1D, 0xEE,
+    0x6F, 0xBE, 0x9C, 0x96, 0x90, 0xEC, 0xAB, 0xB5, 0x44, 0x3D, 0x58, 0xA2, 0x2C, 0x03, 0x88, 0x53,
+    0x0C, 0xD9, 0xFC, 0x7C, 0x65, 0xD5, 0x2B, 0xC7, 0xD7, 0xA8, 0xD6, 0x12, 0x57, 0xFB, 0xF1, 0xD5,
+    0x69, 0x62, 0x0C, 0xA7, 0x84, 0xB1, 0x7B, 0xB6, 0x1B, 0xA8, 0x36, 0x09, 0x26, 0x63, 0xF7, 0x37,
+    0x5F, 0x10, 0x1E, 0x74, 0x90, 0xF3, 0x75, 0xEB, 0x38, 0x2B, 0x85, 0x21, 0x7A, 0xA4, 0xED, 0x94,
+    0x4F, 0x4B, 0x1D, 0x8D, 0x4C, 0x2F, 0xF9, 0x0F, 0x98, 0xD6, 0x7E, 0xA6, 0x20, 0x98, 0xAA, 0x0F,
+    0x31, 0x85, 0x42, 0x4D, 0x25, 0x33, 0xAE, 0x14, 0x91, 0xA4, 0x8A, 0x62, 0x0A, 0x25, 0x52, 0x3F,
+    0x13, 0xA6, 0x8E, 0xE7, 0xA4, 0xE2, 0x9B, 0x3D, 0x26, 0x02, 0xF6, 0xC7, 0xC9, 0x70, 0x3A, 0x4C,
+    0x56, 0x00, 0xEA, 0x1C, 0x7D, 0xC8, 0x9C, 0x6C, 0x36, 0x9D, 0x53, 0x1D, 0x92, 0xA8, 0xC3, 0x65,
+    0xD5, 0xF4, 0x4B, 0x8D, 0xFF, 0x9A, 0xB7, 0x6B, 0xE2, 0xAD, 0xA5, 0x6C, 0x6B, 0xF1, 0xBE, 0x96,
+    0x47, 0xEC, 0xE0, 0x6B, 0x37, 0xFA, 0x3A, 0x1B, 0x7C, 0x8D, 0xF7, 0xBA, 0x6C, 0x7C, 0xCD, 0x65,
+    0x7D, 0xCE, 0x0B, 0xB8, 0xF6, 0x23, 0x7B, 0x60, 0xA3, 0x48, 0x86, 0x45, 0xB3, 0x88, 0x13, 0xCD,
+    0x37, 0x6F, 0xAB, 0x93, 0x7E, 0x41, 0xED, 0xB3, 0x95, 0x6C, 0x34, 0xAD, 0xF6, 0x96, 0x12, 0x8B,
+    0x0E, 0xD3, 0x16, 0x53, 0xF6, 0x23, 0x26, 0x0F, 0x4B, 0x37, 0xC1, 0xB2, 0xE8, 0x30, 0xCD, 0xB0,
+    0x44, 0x65, 0x0A, 0xB8, 0x9F, 0xD1, 0xA6, 0xD2, 0xF6, 0x98, 0xB8, 0x55, 0xEB, 0x81, 0x99, 0x52,
+    0xE9, 0xEF, 0x23, 0x80, 0xBF, 0x36, 0x98, 0x82, 0xB1, 0x84, 0x96, 0x35, 0x57, 0xF4, 0x41, 0x5E,
+    0xAC, 0xA3, 0x43, 0xD1, 0x27, 0x96, 0xA3, 0x29, 0xEF, 0xFE, 0x1A, 0xCE, 0x7F, 0xC6, 0x3B, 0x89,
+    0x63, 0xF2, 0x71, 0x3A, 0x98, 0x86, 0x08, 0x49, 0x3E, 0xB0, 0xC7, 0xB7, 0xD6, 0x99, 0x3E, 0x15,
+    0x6B, 0xCF, 0x41, 0xAA, 0xE3, 0xC7, 0xDA, 0x65, 0x41, 0xDC, 0x81, 0x49, 0x85, 0xD0, 0x2A, 0x82,
+    0xAE, 0x9E, 0x98, 0x72, 0xE7, 0xD6, 0xE6, 0xCF, 0xF7, 0x36, 0xF1, 0x2E, 0x0E, 0x71, 0xFC, 0x19,
+    0x92, 0x37, 0xA5, 0xA5, 0xB1, 0x62, 0xFE, 0x10, 0x1F, 0xCD, 0xDA, 0x5A, 0x5B, 0xE7, 0x3F, 0x47,
+    0xC1, 0x9B, 0x48, 0x8B, 0xE7, 0xC1, 0xC4, 0x57, 0x72, 0xD7, 0xCA, 0x8E, 0xF1, 0xBB, 0x77, 0xFA,
+    0xEC, 0x2C, 0x58, 0x8B, 0xE3, 0x25, 0x8F, 0x73, 0x53, 0x4E, 0x63, 0x28, 0x0D, 0x33, 0x1A, 0xFA,
+    0x17, 0xB4, 0x5F, 0xDA, 0x3F, 0xB8, 0x11, 0xA7, 0x23, 0x91, 0x54, 0x66, 0x12, 0xFF, 0x5D, 0x3B,
+    0xD0, 0x6E, 0x2D, 0x13, 0xD6, 0x05, 0xE6, 0x47, 0xF1, 0xDC, 0xE6, 0x35, 0xAE, 0x8A, 0x17, 0x3C,
+    0x6C, 0x79, 0xC8, 0xED, 0xC1, 0x9C, 0x17, 0x5F, 0x23, 0xB8, 0x99, 0x86, 0xAF, 0xBA, 0x23, 0x84,
+    0xD2, 0xCB, 0x13, 0xE6, 0xBB, 0x69, 0xBD, 0xB2, 0xF1, 0x72, 0xF7, 0x5F, 0x73, 0x90, 0xFF, 0x63,
+    0x0E, 0x5E, 0xAE, 0x56, 0x2B, 0x7A, 0xE9, 0xCF, 0x75, 0x9D, 0x99, 0x77, 0xC8, 0xC1, 0x42, 0x54,
+    0x16, 0xA2, 0x67, 0x0B, 0xD1, 0xF0, 0x06, 0xD1, 0xD5, 0xEA, 0x93, 0x17, 0xE6, 0x8D, 0x11, 0xA1,
+    0x37, 0x88, 0xDA, 0x7F, 0xB6, 0x43, 0x24, 0xEA, 0x6E, 0x12, 0x7D, 0x47, 0x35, 0xFC, 0x2F, 0x99,
+    0xB8, 0x75, 0xBD, 0x02, 0x9D, 0x55, 0xBB, 0x92, 0xDC, 0x44, 0x14, 0xBD, 0x92, 0xBC, 0x56, 0xA0,
+    0xA0, 0x1D, 0x10, 0x99, 0x02, 0xE5, 0x0E, 0xD0, 0x0F, 0x78, 0xB7, 0xC5, 0x17, 0x30, 0xC9, 0x46,
+    0x1B, 0xF0, 0x01, 0x04, 0xFB, 0x05, 0x3B, 0x92, 0xCB, 0xDF, 0x00, 0x29, 0x04, 0xA6, 0x0A, 0x86,
+    0x60, 0x13, 0x02, 0x82, 0xD5, 0xA8, 0x81, 0x80, 0x80, 0xC0, 0x72, 0x6D, 0x39, 0x57, 0xE0, 0x2A,
+    0xAA, 0x9C, 0x6C, 0x53, 0x88, 0x2A, 0x19, 0x5A, 0x6A, 0xCE, 0x69, 0xCD, 0xC2, 0x8E, 0xD7, 0x86,
+    0x2A, 0x54, 0x9A, 0x9E, 0x51, 0xEB, 0x3E, 0xCE, 0x3D, 0xF7, 0xF4, 0x1D, 0x11, 0x29, 0x25, 0xED,
+    0x8E, 0x44, 0x9A, 0xB4, 0x97, 0xC4, 0x1C, 0xCA, 0xFE, 0x15, 0xFB, 0x51, 0xC4, 0xFB, 0x41, 0xF4,
+    0xF3, 0xD3, 0x4E, 0xF5, 0x52, 0x45, 0xA3, 0xC4, 0x63, 0x51, 0x8A, 0xFA, 0xD1, 0x8A, 0x38, 0x7D,
+    0x7C, 0xFC, 0xF1, 0xA5, 0xF7, 0x7E, 0xD2, 0x58, 0x2E, 0xB1, 0x33, 0x69, 0x11, 0xF5, 0xC3, 0x80,
+    0x57, 0x79, 0x2D, 0x45, 0x3D, 0x49, 0x6A, 0x93, 0x57, 0xF1, 0x24, 0xB9, 0xF7, 0xA5, 0x14, 0xBE,
+    0x16, 0x39, 0x40, 0xD4, 0xF2, 0x0E, 0xAC, 0xCC, 0x85, 0x88, 0x4E, 0xE0, 0xF3, 0x5D, 0x5A, 0xBF,
+    0x96, 0x35, 0x6A, 0x61, 0x59, 0x79, 0xDF, 0x8B, 0xFF, 0xAC, 0xB5, 0x11, 0x3C, 0x61, 0x26, 0x79,
+    0xCF, 0xA5, 0xC3, 0x52, 0xD0, 0xA1, 0xA2, 0xE5, 0x84, 0x4F, 0x32, 0xC4, 0x9B, 0xCD, 0x79, 0x8F,
+    0x14, 0xBE, 0x86, 0xD3, 0x4C, 0xD8, 0x40, 0x20, 0x19, 0x4D, 0x35, 0xAD, 0x1C, 0x9F, 0xFA, 0xDD,
+    0x53, 0x32, 0xD2, 0xD9, 0xAC, 0x8F, 0x4F, 0x5D, 0x44, 0x97, 0xD8, 0xFB, 0x17, 0x80, 0xB5, 0xA2,
+    0xE1, 0xBD, 0x68, 0x50, 0x75, 0xF1, 0xC8, 0x89, 0x55, 0xE5, 0x4D, 0x12, 0x26, 0xA0, 0x19, 0x93,
+    0x4F, 0x4F, 0x01, 0x43, 0xD7, 0x21, 0x1E, 0x83, 0xAF, 0x0F, 0x8E, 0x4F, 0x2C, 0x42, 0x28, 0xEF,
+    0x6D, 0x88, 0x0D, 0x0A, 0xA5, 0x61, 0x69, 0x48, 0xF2, 0xE5, 0x5D, 0x9F, 0x79, 0x6F, 0x2A, 0xDF,
+    0xC9, 0x01, 0x62, 0xDD, 0xDF, 0x7C, 0x05, 0x27, 0xB2, 0x80, 0xA4, 0xE6, 0x46, 0xAD, 0xAC, 0x25,
+    0x23, 0x75, 0x89, 0xDD, 0x22, 0xD5, 0x08, 0x67, 0x71, 0x31, 0x30, 0x6E, 0x19, 0x51, 0x13, 0x37,
+    0xA8, 0x74, 0xA2, 0x3A, 0x98, 0xA6, 0x16, 0x66, 0x2C, 0x6E, 0x4B, 0x0C, 0xCA, 0x34, 0xF4, 0x60,
+    0x51, 0x3A, 0x67, 0x98, 0x2B, 0x06, 0xF6, 0x2C, 0xB4, 0x20, 0x01, 0x89, 0xBB, 0xA6, 0x48, 0x5A,
+    0x2E, 0x15, 0x70, 0x3C, 0x60, 0x0F, 0x72, 0x2E, 0xA9, 0x67, 0x89, 0xEF, 0x04, 0xBE, 0x37, 0x1B,
+    0xF2, 0x3D, 0xE0, 0xC5, 0xF4, 0x0F, 0x30, 0x08, 0xE3, 0x97, 0x1E, 0x54, 0x22, 0x8A, 0xC3, 0xC3,
+    0x1A, 0xC9, 0x75, 0x09, 0x20, 0x26, 0xAF, 0xD3, 0x3E, 0xB1, 0x68, 0x5D, 0x43, 0x5C, 0x75, 0x03,
+    0x4C, 0xC0, 0x70, 0x06, 0x08, 0xEA, 0xE7, 0x4E, 0xE2, 0xDF, 0x50, 0xCC, 0x11, 0x0A, 0x50, 0x70,
+    0x8C, 0x3C, 0xC1, 0x95, 0x81, 0x93, 0x40, 0x0F, 0x1B, 0x1E, 0xF1, 0x05, 0x12, 0x7D, 0x82, 0x56,
+    0x15, 0x30, 0x48, 0x43, 0xD2, 0x48, 0xEE, 0xE1, 0x75, 0xAF, 0xF9, 0x9E, 0xD6, 0x87, 0x71, 0x2F,
+    0xAF, 0xAB, 0x91, 0xAD, 0x6B, 0x42, 0xBD, 0x6C, 0x67, 0x51, 0x07, 0x12, 0xC0, 0x60, 0x06, 0x3C,
+    0x0C, 0xBD, 0x15, 0xE8, 0x13, 0xCE, 0x13, 0x4D, 0x2B, 0xD2, 0x07, 0xE0, 0x59, 0x1F, 0x38, 0x65,
+    0xC7, 0x8A, 0xC7, 0x24, 0xFA, 0x57, 0x86, 0xD9, 0x92, 0x1C, 0x15, 0xC4, 0x12, 0x88, 0xD0, 0xE4,
+    0x4E, 0x51, 0x32, 0x19, 0xC5, 0x96, 0x82, 0xC0, 0xF8, 0x7C, 0x64, 0x05, 0x41, 0x2F, 0xE4, 0x33,
+    0x2A, 0x17, 0x8D, 0xA0, 0x3C, 0xE4, 0x52, 0xC6, 0x49, 0xDC, 0xBD, 0xBF, 0x0F, 0x10, 0x66, 0xEB,
+    0x35, 0xF2, 0x7C, 0x64, 0xC2, 0x31, 0x48, 0xFB, 0x0A, 0xF2, 0x44, 0x7A, 0x07, 0x5C, 0x6B, 0xC0,
+    0x41, 0x3F, 0x3B, 0x3C, 0x8E, 0x00, 0x43, 0xED, 0xA7, 0xCF, 0x10, 0xDC, 0xA1, 0x8B, 0x05, 0x8A,
+    0x4A, 0xAE, 0xD0, 0x15, 0x6A, 0x23, 0x27, 0xC8, 0x61, 0xA7, 0xDB, 0xF5, 0x4E, 0xB6, 0xB9, 0x09,
+    0xE2, 0xBF, 0xDB, 0xA2, 0x25, 0x94, 0x5B, 0xD5, 0x85, 0x8C, 0xF7, 0x3F, 0x7C, 0x42, 0xD8, 0x8E,
+    0xEC, 0x36, 0xE4, 0x0F, 0x47, 0x39, 0xB6, 0x58, 0xA4, 0xDF, 0x83, 0xB6, 0x95, 0x05, 0x15, 0x60,
+    0x8D, 0x3C, 0x0C, 0xCC, 0x67, 0x41, 0x22, 0x78, 0x62, 0x7F, 0x29, 0xC3, 0x35, 0x19, 0x44, 0xAF,
+    0xB6, 0xCC, 0xA5, 0x0C, 0x20, 0xC6, 0x23, 0xDB, 0xA5, 0x59, 0x55, 0xD6, 0x13, 0x8C, 0x23, 0x9A,
+    0x82, 0x62, 0x4A, 0x28, 0x21, 0x69, 0x09, 0x42, 0x59, 0xD9, 0xE1, 0x8D, 0x69, 0xC3, 0xCE, 0xCA,
+    0x37, 0x24, 0xB6, 0xE2, 0x92, 0x87, 0xE6, 0xAE, 0x96, 0x73, 0xFD, 0xC5, 0x03, 0x34, 0x17, 0xD1,
+    0x27, 0x70, 0x70, 0x86, 0x04, 0x87, 0x49, 0x27, 0xEF, 0xC5, 0xDD, 0xDF, 0x28, 0x51, 0x41, 0xFE,
+    0x79, 0x1D, 0xCE, 0x43, 0x62, 0x1B, 0x34, 0x13, 0x76, 0x0D, 0x51, 0x01, 0x5C, 0x5E, 0x2B, 0xA3,
+    0x4C, 0x3C, 0xE0, 0xF1, 0x08, 0x88, 0x48, 0x7F, 0x34, 0xA0, 0x50, 0xCD, 0x16, 0x3F, 0x45, 0x65,
+    0x7F, 0x42, 0x12, 0x1A, 0x58, 0x52, 0xB7, 0x53, 0x7D, 0xA0, 0xAD, 0x5E, 0xCE, 0x6A, 0xB2, 0x70,
+    0x1A, 0x9D, 0xA0, 0xFA, 0xD6, 0xED, 0x0E, 0x08, 0x15, 0x27, 0x99, 0x39, 0x83, 0x39, 0xA8, 0x48,
+    0xEB, 0x87, 0xFB, 0x72, 0x4B, 0xE1, 0x77, 0xC1, 0xF3, 0x0C, 0x55, 0x87, 0x2E, 0xBD, 0xE1, 0xC7,
+    0x4F, 0xFD, 0xC2, 0xCA, 0x6E, 0x1E, 0x1A, 0xC9, 0xBF, 0xF7, 0x2F, 0x5B, 0x97, 0x62, 0x2C, 0x98,
+    0xCC, 0xBF, 0x08, 0x22, 0x33, 0xBB, 0x56, 0xFE, 0xFB, 0x0F, 0x0C, 0x45, 0x05, 0x41, 0x53, 0x16,
+    0xDF, 0x66, 0x37, 0x27, 0x22, 0xCA, 0x38, 0x82, 0x0D, 0x9A, 0x9E, 0x40, 0x1D, 0x0A, 0x07, 0x46,
+    0xDF, 0x78, 0xC4, 0x99, 0xAF, 0xF4, 0xCB, 0x73, 0x87, 0xC9, 0x67, 0xDF, 0x9D, 0xD9, 0x61, 0xBD,
+    0xC4, 0x64, 0xC5, 0xEA, 0xFA, 0xB1, 0xF5, 0xFE, 0xCA, 0x2F, 0x97, 0x91, 0x65, 0x76, 0xFC, 0xCF,
+    0xAF, 0x3F, 0x42, 0x6A, 0xA2, 0x48, 0x96, 0xA1, 0xB7, 0xFF, 0xC5, 0x4E, 0x6B, 0x3F, 0xF3, 0xDE,
+    0x7C, 0x1D, 0x06, 0xD8, 0x7F, 0xDD, 0x2B, 0xD1, 0x03, 0xEF, 0xF8, 0xD6, 0xBD, 0x5C, 0x77, 0xD8,
+    0xC5, 0x32, 0x1C, 0x59, 0xE6, 0x10, 0x9B, 0x95, 0x72, 0xEB, 0x2A, 0xB8, 0x5C, 0x90, 0xC9, 0x84,
+    0xE3, 0x47, 0x14, 0x05, 0x21, 0x7A, 0x99, 0xFE, 0x6F, 0xD9, 0x9E, 0x37, 0x2B, 0x6C, 0x7B, 0x9C,
+    0x6F, 0xF5, 0x14, 0x7F, 0x61, 0xD8, 0x2E, 0x31, 0x89, 0x60, 0x1D, 0x3B, 0x5A, 0x27, 0x96, 0xD6,
+    0x59, 0x47, 0xEB, 0xA2, 0x64, 0x90, 0x26, 0x6C, 0x0F, 0xDC, 0xCE, 0x0D, 0xB6, 0xA3, 0x99, 0x41,
+    0x5A, 0xCB, 0x20, 0x33, 0x83, 0xCC, 0x25, 0x2B, 0x5A, 0x06, 0x99, 0x25, 0xA4, 0x30, 0x74, 0x3E,
+    0x88, 0xEC, 0x2D, 0xBC, 0x2C, 0xE7, 0x2C, 0xE8, 0x93, 0x1D, 0x4B, 0x39, 0xFF, 0x23, 0x0E, 0xDA,
+    0xEB, 0xCD, 0xE7, 0x2B, 0x6C, 0xE2, 0x0F, 0x30, 0x1A, 0xD0, 0xB1, 0x12, 0x9B, 0xB9, 0xA5, 0xE5,
+    0x44, 0xCB, 0xE2, 0x11, 0x2C, 0xD3, 0x1E, 0x9B, 0xF1, 0x80, 0xCD, 0xC8, 0xA5, 0x97, 0xBF, 0x9F,
+    0xCC, 0xB4, 0x9C, 0xE1, 0x8E, 0x72, 0xF2, 0x37, 0x10, 0xF4, 0x96, 0xEB, 0x2F, 0xAD, 0x55, 0x3F,
+    0x6F, 0x1C, 0x45, 0x14, 0x7F, 0x3B, 0x23, 0xB3, 0x92, 0x37, 0x62, 0x52, 0xD8, 0x0D, 0x52, 0x34,
+    0xAD, 0x91, 0x92, 0xDB, 0x96, 0xC2, 0x77, 0xBB, 0xB1, 0xBF, 0xC0, 0x09, 0xE5, 0x2A, 0xBE, 0x00,
+    0xF9, 0x0E, 0x87, 0x77, 0x11, 0x25, 0x05, 0x6E, 0x68, 0xA0, 0xB1, 0x44, 0x77, 0x34, 0x14, 0x14,
+    0x29, 0xEE, 0xCF, 0xE0, 0x88, 0xCA, 0x45, 0x56, 0x11, 0x54, 0x6E, 0xB6, 0x20, 0x14, 0x20, 0xA1,
+    0x81, 0x2C, 0xD6, 0xC8, 0xD9, 0xBB, 0xE1, 0xF7, 0x66, 0xEF, 0x88, 0x1D, 0x21, 0xC5, 0x96, 0x98,
+    0xDD, 0xD9, 0x79, 0xF3, 0xE6, 0xCD, 0x7B, 0xBF, 0xF7, 0xE6, 0xCD, 0x5B, 0xE1, 0xBD, 0x2F, 0xD1,
+    0x6D, 0xE6, 0x7D, 0xAB, 0x0C, 0x91, 0xB4, 0x44, 0xD4, 0xA2, 0x67, 0xE8, 0xD7, 0x19, 0x39, 0x11,
+    0x24, 0x09, 0x92, 0x66, 0x7B, 0x35, 0x39, 0xF9, 0x0F, 0x89, 0xAB, 0x0C, 0x7F, 0x02, 0x06, 0xB8,
+    0xCA, 0xBF, 0x29, 0x36, 0x00, 0xED, 0x59, 0x19, 0x98, 0xEF, 0xE5, 0x3C, 0xF1, 0x35, 0x94, 0xCA,
+    0xCB, 0xC9, 0x31, 0x2F, 0xD5, 0x9D, 0x44, 0x37, 0x2C, 0xFC, 0x32, 0xF1, 0xBE, 0x8A, 0xED, 0x55,
+    0x26, 0x0F, 0xD9, 0x30, 0x28, 0xC9, 0x1A, 0x22, 0x9D, 0x53, 0xD4, 0x0D, 0xC2, 0x52, 0x02, 0x73,
+    0x8B, 0x8A, 0xC4, 0x71, 0x80, 0x13, 0x35, 0x89, 0x65, 0xA3, 0x4B, 0xC2, 0x0B, 0x10, 0x47, 0x24,
+    0x1C, 0xF3, 0xB3, 0x3C, 0xCD, 0x29, 0xB6, 0xBA, 0x24, 0x9A, 0x33, 0x36, 0x75, 0x56, 0x41, 0xD8,
+    0x33, 0xC2, 0x94, 0x3F, 0xD2, 0xE1, 0x23, 0x18, 0x39, 0xF9, 0x9A, 0x61, 0x43, 0x01, 0x1D, 0xB1,
+    0x64, 0x06, 0x05, 0x94, 0xE6, 0x08, 0x86, 0x2E, 0x81, 0x0A, 0xAC, 0x39, 0x25, 0x15, 0x46, 0x4C,
+    0xC4, 0xEA, 0x33, 0x6C, 0xCE, 0x2E, 0x20, 0x11, 0xF3, 0x06, 0x86, 0x04, 0x12, 0xAA, 0x03, 0x40,
+    0xA2, 0x29, 0x3A, 0x03, 0x84, 0x6A, 0x5E, 0x79, 0x1F, 0x8A, 0xF0, 0xB6, 0x94, 0xD4, 0xD8, 0xDD,
+    0x52, 0x5A, 0x42, 0x6D, 0x9B, 0xD4, 0x40, 0x86, 0x38, 0xA5, 0x8B, 0xB5, 0x75, 0xC9, 0x41, 0x2B,
+    0x18, 0xE5, 0x0A, 0x93, 0x8B, 0xA6, 0xC3, 0xAC, 0x4C, 0x41, 0xB2, 0x01, 0x9A, 0x39, 0xA9, 0x9F,
+    0xB4, 0xA1, 0xE2, 0x65, 0xD3, 0x21, 0x0E, 0x71, 0xCE, 0x36, 0xC4, 0x80, 0x95, 0x00, 0x81, 0x62,
+    0x25, 0x8F, 0x99, 0x2F, 0x9A, 0xD4, 0x60, 0x4D, 0x01, 0x74, 0x05, 0x11, 0x5D, 0x76, 0x21, 0x59,
+    0xD2, 0x0C, 0x56, 0x22, 0xF6, 0x8E, 0xBD, 0x08, 0x11, 0x89, 0x71, 0x44, 0x0A, 0x67, 0x5E, 0xF1,
+    0xA7, 0xDE, 0xFE, 0xD6, 0xFF, 0x76, 0x8C, 0xA8, 0x23, 0x68, 0xEA, 0x19, 0x56, 0x75, 0xF0, 0x96,
+    0xE3, 0xB1, 0xC4, 0x83, 0x9D, 0x05, 0x9B, 0x4C, 0xCB, 0x10, 0x0E, 0x20, 0x4A, 0x2C, 0xD4, 0xCA,
+    0x66, 0x0E, 0xEF, 0xDB, 0xB7, 0x39, 0x3A, 0xF2, 0x2F, 0x86, 0x6C, 0x84, 0x33, 0xAC, 0x7E, 0xED,
+    0xE8, 0xD1, 0x1B, 0x8E, 0x56, 0xEC, 0xA8, 0x6C, 0xF8, 0x14, 0x0D, 0xED, 0x93, 0x3C, 0xF5, 0xED,
+    0x77, 0xFB, 0x7B, 0xF7, 0xB7, 0xEF, 0x88, 0x92, 0x4E, 0x68, 0x8F, 0xB6, 0xE9, 0x26, 0x44, 0x84,
+    0xE0, 0x1B, 0xAA, 0xC9, 0x92, 0x5F, 0xBD, 0x2B, 0xCB, 0xFA, 0xE4, 0xCE, 0x4D, 0x77, 0xAE, 0x89,
+    0x2D, 0x80, 0xF6, 0xE7, 0xFE, 0xEF, 0xD1, 0xA3, 0x2B, 0x04, 0x93, 0xDE, 0xFF, 0x8E, 0xEE, 0x46,
+    0xA3, 0xC0, 0x10, 0xA0, 0xCF, 0xD1, 0xD7, 0x53, 0x5A, 0xB3, 0xB8, 0xBD, 0x5A, 0x8F, 0x3F, 0x8F,
+    0xBA, 0xF6, 0x96, 0xE5, 0xBB, 0xF4, 0x61, 0x1D, 0x9F, 0x95, 0xBA, 0x47, 0xE3, 0x27, 0xD1, 0x5F,
+    0xFF, 0x33, 0x69, 0xD6, 0xC6, 0x61, 0xEF, 0x25, 0xFA, 0x66, 0x3A, 0x99, 0x4C, 0xBE, 0xC1, 0xF4,
+    0x47, 0x98, 0x17, 0xD5, 0x38, 0x31, 0x4E, 0x1F, 0x36, 0x59, 0x6C, 0x77, 0x71, 0x0A, 0xAD, 0x3E,
+    0x75, 0xA9, 0xB4, 0xFD, 0xD8, 0xDC, 0x25, 0x7D, 0xDA, 0xA6, 0x87, 0x36, 0x8B, 0xAB, 0x69, 0x52,
+    0x0E, 0xE9, 0x28, 0xB6, 0x99, 0x68, 0x74, 0xD9, 0x26, 0xA6, 0x1F, 0xE5, 0xC2, 0x3C, 0x88, 0x4D,
+    0x3F, 0x31, 0x53, 0x55, 0xB6, 0xFA, 0xA1, 0xC3, 0x4A, 0x26, 0x6D, 0x01, 0x1D, 0xD1, 0x50, 0x55,
+    0x33, 0x65, 0x96, 0xDA, 0xB4, 0xE9, 0x43, 0x97, 0x8A, 0x66, 0x00, 0x6D, 0xB2, 0x1E, 0x43, 0x61,
+    0x94, 0x33, 0xF3, 0x87, 0x36, 0x3D, 0x70, 0x99, 0x64, 0xF9, 0x4F, 0x64, 0x3D, 0x8D, 0xCD, 0x13,
+    0x68, 0xDF, 0x62, 0xF5, 0x85, 0xB4, 0xE0, 0xA7, 0x07, 0x30, 0xE2, 0x14, 0xDB, 0x19, 0x4B, 0x36,
+    0xB5, 0x43, 0xBB, 0xA1, 0xCC, 0x70, 0xD2, 0xBB, 0x90, 0xF6, 0x09, 0xEA, 0x41, 0x25, 0x2F, 0x2F,
+    0x17, 0x70, 0xE2, 0x8F, 0xAF, 0xBF, 0xB2, 0x02, 0x29, 0xFB, 0x3D, 0xD1, 0x83, 0xF5, 0xCA, 0x46,
+    0x4C, 0x95, 0xA1, 0x9E, 0xB8, 0x70, 0x67, 0xD6, 0x0A, 0xDA, 0xCD, 0x84, 0x95, 0x32, 0x23, 0xEB,
+    0x86, 0x1E, 0x4E, 0xA8, 0xA6, 0x2F, 0x7B, 0xBB, 0x5F, 0xA0, 0x5A, 0x72, 0xA8, 0x58, 0x4D, 0xEF,
+    0x9A, 0x48, 0xD6, 0x95, 0xA7, 0x1E, 0x6D, 0x1D, 0x54, 0x8F, 0x20, 0xF2, 0x0C, 0x92, 0xF9, 0x3D,
+    0xCA, 0xC5, 0xBA, 0x74, 0xBD, 0x96, 0xCC, 0xB5, 0xCB, 0x96, 0x85, 0xE7, 0x27, 0x5B, 0x65, 0xCB,
+    0x04, 0xE9, 0xBE, 0x87, 0x52, 0x82, 0xD2, 0xB0, 0x68, 0x39, 0xA9, 0x9E, 0xFB, 0x72, 0x4E, 0xF7,
+    0xC3, 0x51, 0xA8, 0xCF, 0x2F, 0x96, 0xC5, 0x16, 0x75, 0x77, 0xDA, 0x2D, 0xF2, 0xF4, 0xDC, 0x89,
+    0x65, 0x41, 0xDA, 0xE4, 0x34, 0xA4, 0x8E, 0x8D, 0xEB, 0x37, 0x5B, 0xE4, 0x99, 0x51, 0xAF, 0x1C,
+    0xEA, 0x85, 0x2F, 0x28, 0x35, 0xAA, 0xE6, 0xE5, 0x1D, 0x5C, 0xE5, 0x8B, 0x55, 0x11, 0x85, 0xFC,
+    0x3C, 0xA3, 0x5B, 0x5D, 0x94, 0x40, 0xEC, 0x04, 0x04, 0xB8, 0x95, 0x1F, 0xDC, 0xEE, 0x92, 0x04,
+    0x62, 0xE8, 0xAF, 0x35, 0x51, 0xDE, 0xEC, 0x89, 0x72, 0xEF, 0x5F, 0x8C, 0x2A, 0xE2, 0xA7, 0xA6,
+    0xDB, 0xED, 0x1B, 0x7D, 0x44, 0x71, 0x78, 0x92, 0xDB, 0xEC, 0xA3, 0x7F, 0xDB, 0x02, 0x09, 0x51,
+    0x85, 0xFB, 0xD0, 0xF2, 0x0F, 0x05, 0x6D, 0x86, 0x1C, 0x09, 0xF5, 0x7B, 0x10, 0xD9, 0x50, 0xC3,
+    0x49, 0xE5, 0xFB, 0xD4, 0x67, 0x22, 0x36, 0x2A, 0xE7, 0x5A, 0x4B, 0x91, 0x95, 0x95, 0x0E, 0xFB,
+    0xC7, 0xD4, 0x40, 0x9E, 0xAB, 0x3F, 0xF5, 0xBB, 0xBB, 0x25, 0x8D, 0x3A, 0xAC, 0x1F, 0x13, 0x7D,
+    0x4C, 0x4D, 0x7C, 0x6A, 0xBD, 0x8D, 0x7C, 0xDD, 0x13, 0xB6, 0x99, 0x2F, 0x68, 0x35, 0x8B, 0x7F,
+    0x6D, 0xA6, 0x7D, 0x89, 0xCB, 0x63, 0x16, 0xAE, 0xAF, 0xC9, 0x0D, 0xC8, 0xBE, 0xF3, 0x4B, 0x96,
+    0x98, 0x54, 0xE5, 0x30, 0xA0, 0x45, 0x1D, 0x3F, 0x35, 0x50, 0xA7, 0x4A, 0x17, 0xFD, 0x69, 0x91,
+    0x59, 0xB1, 0x19, 0xD0, 0x78, 0x8C, 0x74, 0x95, 0x75, 0x52, 0x6A, 0x85, 0x9C, 0x12, 0x56, 0xD8,
+    0xE4, 0x69, 0xA5, 0x72, 0x60, 0x1C, 0xCB, 0xDA, 0xC1, 0xE6, 0x94, 0xD4, 0xA7, 0x8D, 0x46, 0xAE,
+    0xF4, 0xF1, 0x53, 0x73, 0xD2, 0x37, 0x9C, 0x73, 0xDA, 0x85, 0xBF, 0x25, 0x1A, 0x72, 0x66, 0xE3,
+    0xEF, 0x3F, 0xB5, 0x55, 0x3D, 0x90, 0x14, 0x45, 0x14, 0xFE, 0x66, 0xFA, 0xEE, 0x5A, 0x6B, 0xAC,
+    0xEA, 0x0B, 0xA0, 0x4A, 0x03, 0x98, 0x84, 0xC8, 0x3A, 0x6E, 0x52, 0x83, 0xDD, 0x99, 0x11, 0x8B,
+    0xC8, 0x40, 0x02, 0x2F, 0xD1, 0xC0, 0x58, 0x12, 0x12, 0x03, 0x82, 0xDD, 0xBD, 0x01, 0x02, 0x03,
+    0x13, 0xAA, 0xFC, 0x89, 0x0D, 0x24, 0x10, 0x13, 0x02, 0x02, 0x82, 0x85, 0xED, 0xE2, 0x02, 0x03,
+    0x92, 0x11, 0x02, 0x03, 0x02, 0xC7, 0x12, 0x0D, 0x4C, 0x68, 0xAC, 0xA1, 0x6A, 0xA4, 0xE6, 0xAE,
+    0xFD, 0x5E, 0xCF, 0x6C, 0x01, 0x4A, 0xEA, 0xEC, 0xD6, 0xF4, 0xEB, 0xEE, 0xF7, 0xF7, 0xBD, 0xBF,
+    0x01, 0x5E, 0x78, 0x56, 0x15, 0xE2, 0x66, 0xA4, 0x7D, 0x8F, 0xC8, 0x8D, 0xF4, 0xED, 0xB4, 0x42,
+    0x37, 0xD2, 0x79, 0xEC, 0x30, 0x1B, 0xE9, 0xB4, 0x9C, 0x22, 0x1F, 0x69, 0x6D, 0x4D, 0x95, 0x8D,
+    0x74, 0xE4, 0x54, 0x63, 0xCA, 0x71, 0x33, 0x43, 0x97, 0xD8, 0xB5, 0x00, 0x72, 0x55, 0x3F, 0x17,
+    0x78, 0xAF, 0x79, 0x0B, 0xF8, 0x54, 0xFE, 0xAD, 0xFE, 0xC9, 0xAD, 0x3A, 0xF8, 0x36, 0xF2, 0xAE,
+    0x88, 0x5D, 0xB7, 0xBF, 0x2A, 0x57, 0x2B, 0x1C, 0x1D, 0xE9, 0x3F, 0xBA, 0x59, 0xA1, 0x5C, 0xAE,
+    0x9B, 0xDB, 0x89, 0x5D, 0xF5, 0xB9, 0x29, 0x67, 0x29, 0x96, 0x05, 0xBA, 0xAD, 0x47, 0x19, 0x15,
+    0xBC, 0x6F, 0x53, 0x53, 0xD1, 0x03, 0xF3, 0xAE, 0x53, 0xBF, 0x39, 0x7D, 0x50, 0xD3, 0x52, 0x62,
+    0x69, 0xB1, 0x8B, 0xDA, 0x96, 0x8E, 0xAA, 0x9A, 0x16, 0x73, 0xCC, 0xA7, 0x58, 0x42, 0x39, 0x0A,
+    0x7C, 0x41, 0x81, 0x32, 0xA3, 0x83, 0x51, 0xAB, 0xEE, 0xBB, 0xE4, 0xA0, 0x31, 0x82, 0x2C, 0x8F,
+    0xDC, 0x4C, 0xB9, 0x25, 0x5D, 0x9B, 0x51, 0xBC, 0x37, 0x97, 0xDA, 0xF4, 0x8C, 0x13, 0x64, 0xFE,
+    0x30, 0xF2, 0xBD, 0xF2, 0x1D, 0x88, 0xCC, 0x1C, 0x22, 0xED, 0x91, 0x0D, 0x71, 0xD8, 0x06, 0xCE,
+    0x85, 0xFF, 0x1C, 0x7D, 0x4C, 0xB4, 0x89, 0x35, 0xE5, 0x2E, 0x26, 0xF8, 0x8C, 0x27, 0xA4, 0x6D,
+    0x17, 0xBB, 0x4C, 0xB0, 0x26, 0x76, 0x89, 0xD6, 0x60, 0x37, 0x6E, 0x94, 0xE5, 0x6D, 0x52, 0x86,
+    0xFB, 0x25, 0x68, 0x43, 0x58, 0x14, 0x45, 0xA7, 0x5A, 0xB8, 0x4C, 0x65, 0x4A, 0x97, 0x0A, 0xE3,
+    0x14, 0x13, 0x45, 0x08, 0xE4, 0xBD, 0x41, 0xED, 0x05, 0x83, 0x6C, 0xAC, 0xAA, 0x09, 0xA6, 0xA5,
+    0x77, 0x3B, 0x73, 0x32, 0xDE, 0xA5, 0xF7, 0x39, 0x0A, 0xCD, 0xE3, 0x5B, 0x58, 0x1A, 0x98, 0x33,
+    0x4D, 0xE4, 0x26, 0xD8, 0xD1, 0xD5, 0xDC, 0x5C, 0x76, 0xE8, 0x33, 0xD5, 0x90, 0x21, 0xB1, 0xCA,
+    0xCD, 0x4C, 0x45, 0x9E, 0x94, 0xA0, 0xDC, 0xAE, 0xB0, 0x4D, 0x90, 0x2A, 0x7B, 0x51, 0x38, 0x6F,
+    0xE0, 0x75, 0xF0, 0x18, 0xAA, 0x45, 0xFC, 0x0B, 0xF0, 0x57, 0x8D, 0x9B, 0x13, 0x4C, 0x92, 0xF2,
+    0x34, 0x9C, 0xC1, 0xE9, 0xA4, 0x54, 0x07, 0x16, 0x37, 0xB1, 0x01, 0x9A, 0xB3, 0x49, 0x9D, 0x34,
+    0xBA, 0xD1, 0x2E, 0xEE, 0x50, 0x94, 0x14, 0x28, 0xA0, 0x1D, 0x16, 0x48, 0x18, 0x87, 0x8D, 0xE0,
+    0xA2, 0xB1, 0xDA, 0x45, 0x1D, 0xEE, 0x60, 0x1F, 0xBD, 0x6A, 0x93, 0x3A, 0xAB, 0x16, 0xD8, 0x79,
+    0x5E, 0x56, 0x25, 0xB2, 0x12, 0xDB, 0x19, 0x54, 0xC7, 0x44, 0xF5, 0x28, 0x2A, 0xA6, 0xC2, 0x45,
+    0x0D, 0x7A, 0xA4, 0x2C, 0x8C, 0x02, 0x14, 0xA3, 0x0A, 0x44, 0x3D, 0x73, 0x04, 0xD1, 0xDD, 0x4B,
+    0xA9, 0xD8, 0x42, 0x64, 0xF7, 0xE5, 0xE2, 0x2A, 0xAB, 0x02, 0xDF, 0xD1, 0x2C, 0x25, 0x7E, 0xA4,
+    0x7D, 0x1B, 0xF5, 0x34, 0xEA, 0x45, 0x48, 0x3D, 0x11, 0x66, 0xF4, 0x5A, 0x6A, 0xB5, 0x08, 0x0A,
+    0x79, 0xBA, 0x80, 0xA8, 0xA2, 0x4B, 0xA2, 0x4A, 0x37, 0xBC, 0xD8, 0x44, 0x4A, 0x24, 0x74, 0x7E,
+    0xC1, 0x48, 0x16, 0x55, 0xD4, 0xBE, 0x26, 0xD0, 0xB7, 0x28, 0xB4, 0x19, 0x04, 0x17, 0xC6, 0x66,
+    0x07, 0x2E, 0x71, 0xBD, 0xA8, 0xE6, 0x26, 0xBD, 0xE2, 0x74, 0xD3, 0x47, 0x5D, 0x81, 0xDC, 0xB0,
+    0x50, 0x9D, 0xAA, 0x3B, 0xB4, 0xBB, 0x98, 0x26, 0x15, 0xC3, 0xA8, 0xEC, 0x2D, 0xB8, 0xD3, 0x98,
+    0x44, 0x88, 0x46, 0x88, 0x94, 0xC9, 0xEA, 0xE2, 0x5E, 0x67, 0x9E, 0xF4, 0x71, 0xBF, 0x81, 0x63,
+    0xE1, 0xF0, 0x82, 0x2F, 0x0B, 0xEF, 0xD5, 0xE3, 0xBB, 0x3D, 0x96, 0x92, 0xE4, 0x1C, 0x4B, 0xE5,
+    0x86, 0xA5, 0xD1, 0x2C, 0x82, 0x59, 0x5A, 0xE9, 0x7B, 0x0D, 0x16, 0x1D, 0xF4, 0x21, 0x91, 0x96,
+    0x50, 0x6C, 0xBE, 0x29, 0x5D, 0xAF, 0x5F, 0x6C, 0xCA, 0xB8, 0x62, 0x63, 0x12, 0x15, 0x01, 0x12,
+    0x56, 0x54, 0xE2, 0xED, 0xEB, 0xD7, 0xAF, 0x7F, 0xE9, 0xF9, 0x08, 0xF1, 0xED, 0x29, 0xB2, 0xBC,
+    0x31, 0xE1, 0x6B, 0xC7, 0xF0, 0x75, 0x53, 0x5B, 0xB6, 0x30, 0x81, 0xB3, 0x63, 0x0B, 0x4F, 0xAD,
+    0x5B, 0xFE, 0x2A, 0x8F, 0xF7, 0x24, 0xA0, 0xBE, 0xA5, 0xA2, 0xAF, 0x57, 0x62, 0x45, 0x5B, 0xA9,
+    0x44, 0x77, 0x82, 0xC7, 0xEF, 0x88, 0xEC, 0x89, 0xED, 0x90, 0x4B, 0x89, 0xC5, 0x2E, 0x58, 0xC6,
+    0xB8, 0x08, 0x96, 0x1B, 0xFB, 0x3F, 0xAE, 0xA1, 0xD8, 0x52, 0x15, 0xA8, 0xFC, 0x64, 0xB8, 0x61,
+    0xEF, 0x53, 0xAD, 0x47, 0xFC, 0x50, 0x6A, 0x24, 0xB9, 0x6C, 0x4D, 0xD4, 0x9C, 0x84, 0x9B, 0xE2,
+    0xE2, 0x4C, 0xAE, 0x81, 0xE3, 0x6B, 0xC7, 0xCD, 0xBA, 0xEB, 0xD5, 0x7A, 0x8E, 0xB0, 0x0B, 0xC7,
+    0x67, 0x3D, 0x29, 0xCE, 0x25, 0xD5, 0x9B, 0x43, 0x00, 0x7F, 0xFF, 0xD5, 0x0F, 0x52, 0x04, 0x16,
+    0xF0, 0x47, 0xE7, 0xFD, 0x9F, 0x57, 0x47, 0xEE, 0xB5, 0x82, 0x74, 0xB1, 0xD6, 0x7D, 0x6F, 0x8C,
+    0x91, 0xA9, 0xFB, 0x81, 0x48, 0x5C, 0x36, 0xD8, 0x8B, 0x3A, 0x15, 0x66, 0xD8, 0x66, 0xB9, 0x81,
+    0x92, 0xE1, 0x42, 0x28, 0x8D, 0x98, 0xE0, 0x87, 0x19, 0x76, 0x5B, 0x86, 0xD8, 0x30, 0x8C, 0x28,
+    0x5E, 0x86, 0x49, 0x84, 0x53, 0xAA, 0xDE, 0xC4, 0xB1, 0xC8, 0xC5, 0xE6, 0xD1, 0xD3, 0x95, 0x4D,
+    0xFE, 0x9E, 0x5C, 0xF8, 0x99, 0x7E, 0xB8, 0x98, 0xAF, 0xEE, 0xBC, 0x7F, 0xF6, 0x15, 0x3E, 0x5A,
+    0x1D, 0x5D, 0x83, 0x11, 0x25, 0x2C, 0x42, 0x24, 0x8F, 0x05, 0xD6, 0x63, 0x0B, 0xFD, 0x80, 0xCA,
+    0xE3, 0x27, 0x1D, 0x31, 0xDE, 0x11, 0xD3, 0xEC, 0x8F, 0xCE, 0xD4, 0x43, 0x3D, 0x2E, 0xC5, 0x26,
+    0x47, 0x15, 0x8B, 0x64, 0x5B, 0x12, 0x27, 0x31, 0xCE, 0xFC, 0x43, 0xFF, 0x74, 0xEF, 0x43, 0x8C,
+    0x49, 0x5E, 0x8E, 0x2E, 0x04, 0x8F, 0x67, 0xE3, 0x26, 0x76, 0xEB, 0x4D, 0x35, 0x6E, 0xA6, 0x08,
+    0xBD, 0x3A, 0x0C, 0xE4, 0x7C, 0xDC, 0xA0, 0x1D, 0x37, 0xDA, 0x8E, 0xD0, 0xB2, 0xB5, 0xDA, 0x6E,
+    0x44, 0x17, 0x36, 0xFB, 0x7E, 0xDF, 0x2F, 0xBE, 0x9F, 0xE3, 0xBF, 0xBF, 0xC5, 0x9E, 0xDC, 0xBD,
+    0xEA, 0x66, 0x1E, 0xA4, 0x8E, 0xEF, 0x15, 0xFE, 0x03, 0x7F, 0xFF, 0x87, 0x96, 0x31, 0xCB, 0xCA,
+    0xA4, 0x8E, 0x5F, 0x26, 0xCE, 0x7E, 0xF2, 0xC0, 0xB7, 0xAC, 0xB1, 0x57, 0x5C, 0x05, 0xC2, 0x1F,
+    0x16, 0xFE, 0xEC, 0xDE, 0xFA, 0x33, 0xB0, 0xC5, 0xF2, 0x63, 0x43, 0xEC, 0x7B, 0xAF, 0x19, 0xD8,
+    0xE2, 0xDA, 0xEA, 0xCA, 0xB3, 0x8F, 0xFB, 0x53, 0x30, 0x77, 0x4B, 0xA9, 0x27, 0x5D, 0x87, 0xEA,
+    0x96, 0x38, 0xE4, 0xA1, 0x63, 0x65, 0x49, 0xEA, 0x90, 0x2D, 0xA9, 0x23, 0xC6, 0xBC, 0x28, 0xA5,
+    0x63, 0x23, 0x32, 0xA7, 0x35, 0x74, 0x1B, 0x1A, 0x46, 0xAE, 0x0E, 0xC3, 0x08, 0x91, 0x1A, 0x1B,
+    0x5B, 0x67, 0x36, 0x84, 0x64, 0x5C, 0x8E, 0x85, 0x9E, 0xF9, 0xD7, 0x33, 0x1F, 0x2C, 0xFA, 0xA1,
+    0xAD, 0xC6, 0xE5, 0x88, 0x4B, 0xF3, 0x92, 0x40, 0xB4, 0xE2, 0xCC, 0xFF, 0x9C, 0xEE, 0x26, 0xEE,
+    0xE8, 0x9B, 0xA3, 0x58, 0xDC, 0xB5, 0x9C, 0x55, 0x51, 0xCB, 0xEE, 0x42, 0x2E, 0x5E, 0xA6, 0x97,
+    0x3A, 0xF1, 0x33, 0xCC, 0x1B, 0xA6, 0x4B, 0xB5, 0x2A, 0xF8, 0xD6, 0xCA, 0x6B, 0x2A, 0x4E, 0x99,
+    0x52, 0xC9, 0x67, 0x48, 0x92, 0x15, 0xBE, 0x9B, 0x13, 0x49, 0x8C, 0x09, 0x16, 0x5E, 0xF4, 0x2A,
+    0x2D, 0x65, 0x3E, 0x91, 0xDD, 0x29, 0x4E, 0xC1, 0x5E, 0x7C, 0x59, 0x49, 0x37, 0x6E, 0xE2, 0x7F,
+    0x7E, 0xFE, 0x01, 0xBD, 0x55, 0xBD, 0x6F, 0xD3, 0x40, 0x14, 0x7F, 0xF6, 0xA5, 0xB5, 0xC0, 0x80,
+    0x33, 0xC0, 0x52, 0xD4, 0x66, 0x61, 0x02, 0x4A, 0x56, 0x86, 0x24, 0x17, 0xE0, 0x1F, 0xE8, 0x80,
+    0x61, 0x60, 0x60, 0x61, 0x60, 0x63, 0x61, 0x60, 0x00, 0x62, 0xD4, 0x81, 0x91, 0x20, 0x04, 0x2B,
+    0x42, 0x82, 0x25, 0x1D, 0x58, 0x3A, 0x64, 0x48, 0xE5, 0x93, 0x10, 0x2C, 0x0C, 0x18, 0x2A, 0x26,
+    0x16, 0x8B, 0xB2, 0x31, 0x70, 0x42, 0x16, 0x18, 0xB0, 0x7D, 0xFC, 0xDE, 0x25, 0xD0, 0x0F, 0xF1,
+    0x11, 0x09, 0x89, 0x93, 0xEE, 0xE5, 0xE5, 0x7D, 0xDF, 0xFB, 0x32, 0x11, 0x8E, 0xA4, 0x4B, 0x26,
+    0x92, 0xC2, 0x18, 0x2D, 0x45, 0x75, 0xAE, 0x90, 0x4E, 0x97, 0x4A, 0xC9, 0xF4, 0xED, 0xE0, 0x3A,
+    0x83, 0x02, 0x40, 0xE4, 0x00, 0x41, 0xDA, 0x01, 0x3D, 0x3A, 0x46, 0x54, 0xD2, 0x31, 0x72, 0x33,
+    0x00, 0x91, 0x32, 0x48, 0x68, 0x91, 0x41, 0x8D, 0x60, 0x66, 0xF3, 0x48, 0xF2, 0x52, 0x8A, 0xBB,
+    0x81, 0xA6, 0x38, 0x02, 0xE8, 0x91, 0xAF, 0xC7, 0x22, 0xB1, 0x31, 0x46, 0xE2, 0x3E, 0x0D, 0xC3,
+    0xB3, 0x9A, 0xC8, 0xC5, 0x75, 0x72, 0x76, 0x84, 0xBB, 0x66, 0x15, 0x89, 0x9A, 0xB8, 0x8D, 0x08,
+    0x3E, 0x15, 0x91, 0x9F, 0x10, 0x79, 0x10, 0x12, 0x3B, 0x05, 0x7B, 0xB8, 0x61, 0x78, 0x9A, 0x60,
+    0x2C, 0x0B, 0x56, 0x8C, 0x59, 0x56, 0xB1, 0xC9, 0x74, 0xD3, 0x98, 0x96, 0x6F, 0xCC, 0x0B, 0xD7,
+    0x98, 0xCF, 0x20, 0x54, 0x4C, 0x18, 0x81, 0xF0, 0x01, 0x84, 0x6F, 0x20, 0x94, 0x5B, 0x25, 0xD6,
+    0x41, 0x48, 0x41, 0x48, 0x5A, 0x7E, 0x97, 0x02, 0x37, 0x21, 0xA1, 0x56, 0x89, 0xF4, 0x22, 0xD1,
+    0x74, 0x84, 0xF1, 0x39, 0x62, 0x4C, 0x02, 0xA3, 0x25, 0x8C, 0x9E, 0x7D, 0x89, 0xA4, 0x2E, 0xE2,
+    0x8F, 0xBB, 0xCE, 0x88, 0xFC, 0x3D, 0xC2, 0x32, 0x09, 0x23, 0xD0, 0x5A, 0xB1, 0xEA, 0x34, 0x37,
+    0x18, 0xF4, 0xC1, 0xEF, 0xA3, 0x30, 0x46, 0xB5, 0xCF, 0x1B, 0x23, 0x10, 0x5E, 0xCE, 0xB1, 0x3E,
+    0x01, 0x52, 0x30, 0xC2, 0x01, 0x97, 0x8C, 0x6C, 0xFC, 0x40, 0xD6, 0x7F, 0xB0, 0x58, 0x26, 0xEF,
+    0x3C, 0x86, 0x16, 0xAB, 0x1F, 0x1E, 0x0C, 0x90, 0x3F, 0xAE, 0x08, 0xCA, 0x60, 0x2F, 0x4A, 0xC4,
+    0xF7, 0x90, 0x50, 0x33, 0xBD, 0x3B, 0xCF, 0x2A, 0x2E, 0xC3, 0x5C, 0x5C, 0x3D, 0xA2, 0x20, 0x43,
+    0xCE, 0x47, 0x48, 0xA9, 0x24, 0xA7, 0x68, 0x46, 0x22, 0x0B, 0x12, 0x57, 0xFB, 0x8A, 0xEA, 0x0E,
+    0xD5, 0x44, 0xD6, 0xBB, 0xC9, 0xB5, 0xDF, 0x76, 0x84, 0x96, 0x27, 0xF3, 0x40, 0x15, 0x9E, 0x6A,
+    0xBB, 0xE9, 0x0C, 0x6A, 0xC0, 0xC5, 0x32, 0xB0, 0x12, 0xDF, 0x8D, 0xB9, 0x25, 0x3C, 0xC5, 0x99,
+    0xD1, 0xF3, 0x20, 0x1F, 0x6F, 0x01, 0xCC, 0xD7, 0x01, 0x6A, 0xF4, 0x1F, 0xCE, 0x21, 0xDC, 0x3D,
+    0xEC, 0xF2, 0x68, 0x00, 0xB0, 0xEA, 0x29, 0x72, 0x53, 0xB4, 0x0C, 0x3A, 0x49, 0x22, 0xBD, 0x34,
+    0x6B, 0xFA, 0xFF, 0x9C, 0x12, 0x7B, 0xFE, 0xDD, 0x46, 0x23, 0xF2, 0x9E, 0x6B, 0xF1, 0xB6, 0x70,
+    0xB2, 0x36, 0x41, 0xA8, 0x0D, 0x0A, 0xBA, 0x3D, 0x22, 0x2F, 0xB1, 0x03, 0x81, 0x36, 0xBF, 0x4A,
+    0x84, 0x79, 0x0B, 0xBA, 0x04, 0x1D, 0x24, 0xD5, 0xD1, 0xB6, 0xF1, 0xDB, 0x76, 0x36, 0x58, 0x50,
+    0xED, 0x3E, 0xA5, 0x7D, 0x9D, 0xB9, 0xC5, 0x88, 0x07, 0x01, 0x46, 0x0F, 0x2C, 0x71, 0x64, 0x18,
+    0xAF, 0x77, 0xF8, 0x49, 0x11, 0x06, 0x8C, 0x64, 0x6B, 0x74, 0xD0, 0x54, 0x67, 0xF2, 0x16, 0x3F,
+    0xDE, 0xE4, 0x7B, 0x59, 0x22, 0x46, 0xD0, 0xB4, 0x1F, 0xD7, 0xB7, 0x35, 0xBB, 0x17, 0x23, 0x49,
+    0x70, 0x82, 0x9A, 0x39, 0x7A, 0x01, 0xE4, 0x2B, 0x9C, 0xC0, 0xC5, 0x49, 0xCD, 0x2E, 0xB3, 0x5C,
+    0x44, 0x4E, 0x34, 0xDC, 0x4B, 0x1D, 0x7F, 0x59, 0x53, 0x3E, 0x2C, 0x48, 0xBC, 0x8F, 0x11, 0x83,
+    0x51, 0x4E, 0x18, 0x7F, 0x09, 0x79, 0x94, 0x3F, 0x0E, 0xCC, 0xD7, 0x01, 0x53, 0x48, 0x7C, 0x03,
+    0xAB, 0x80, 0x8C, 0x84, 0xB0, 0xAB, 0x86, 0xFB, 0xAC, 0x3A, 0xD1, 0x70, 0x6B, 0x99, 0x78, 0xAA,
+    0x7B, 0x5D, 0xDE, 0x23, 0xE4, 0xF4, 0x7F, 0x5D, 0x49, 0x2F, 0xE2, 0x5D, 0x43, 0x54, 0x8D, 0xE7,
+    0xFE, 0xB7, 0x87, 0x2B, 0x21, 0x11, 0x39, 0x4C, 0x09, 0xBC, 0x66, 0xB6, 0x4B, 0xD7, 0x7C, 0x95,
+    0x37, 0xBA, 0xD2, 0x4B, 0x46, 0x81, 0x6A, 0x0A, 0xDD, 0xF6, 0x55, 0x70, 0x43, 0x37, 0x45, 0x0A,
+    0x72, 0xE0, 0x6A, 0x91, 0x5C, 0xF5, 0xA3, 0xCC, 0x4D, 0xDB, 0x42, 0x0D, 0x49, 0x2F, 0xB8, 0x49,
+    0x8B, 0x2E, 0xFB, 0x94, 0xCE, 0x6F, 0x31, 0x59, 0x58, 0xD8, 0xB3, 0xC3, 0xDD, 0x48, 0xAC, 0x93,
+    0xFE, 0xB4, 0x0D, 0x78, 0xC5, 0x02, 0xC9, 0xBA, 0xF2, 0x16, 0xE7, 0x39, 0xD8, 0xE0, 0xE8, 0x39,
+    0xB4, 0xE9, 0x4E, 0x7D, 0xB2, 0x3B, 0x37, 0x9D, 0x4F, 0x9E, 0x7F, 0x61, 0x33, 0x7B, 0x4C, 0xF6,
+    0x37, 0x78, 0x13, 0x8A, 0xA2, 0x64, 0x4A, 0x35, 0xC7, 0x70, 0xF7, 0xB4, 0x3E, 0x38, 0xFD, 0xC8,
+    0xB0, 0x8D, 0xC9, 0xB1, 0x06, 0xB0, 0xC5, 0xA7, 0x3C, 0x76, 0xC5, 0x3B, 0xA7, 0x32, 0xFB, 0xA8,
+    0x8A, 0xF1, 0x6A, 0xFC, 0xDA, 0x93, 0x0C, 0x5D, 0xAC, 0xC8, 0x27, 0x79, 0xD5, 0xFC, 0x95, 0xE6,
+    0xEC, 0x72, 0x56, 0xC9, 0x13, 0x40, 0x46, 0x36, 0xE4, 0x9F, 0x60, 0xED, 0x6F, 0x2E, 0x79, 0x73,
+    0xD4, 0xB9, 0xC6, 0x39, 0x1A, 0x42, 0x14, 0xC0, 0xDC, 0x82, 0xFB, 0x74, 0xF5, 0x6F, 0x8A, 0x17,
+    0xB7, 0x3B, 0x2A, 0x7F, 0xE6, 0xD7, 0x59, 0xB2, 0xFC, 0xDC, 0xC2, 0x8E, 0x8D, 0x3B, 0x88, 0x76,
+    0xE1, 0x2B, 0x27, 0x52, 0x24, 0xB7, 0xA2, 0x5C, 0xE4, 0x68, 0xAA, 0x0E, 0x34, 0x1C, 0x30, 0x66,
+    0xF8, 0xAD, 0xE9, 0x0E, 0x0D, 0x3B, 0x83, 0xF6, 0x53, 0x66, 0xCC, 0x25, 0x0B, 0x5F, 0x87, 0xE1,
+    0xF5, 0x30, 0x5C, 0x1A, 0x33, 0xB6, 0x69, 0xD4, 0xA0, 0x51, 0x47, 0xD9, 0x82, 0x48, 0x5A, 0x1F,
+    0x0D, 0xEB, 0x03, 0x9F, 0xB4, 0x05, 0x30, 0x86, 0xB4, 0x43, 0xE3, 0xA1, 0x35, 0xFE, 0xFC, 0x53,
+    0x39, 0x59, 0xBB, 0xCE, 0xED, 0x32, 0xBE, 0xFF, 0x2A, 0x9D, 0x7C, 0x54, 0x9B, 0x6F, 0xBE, 0x14,
+    0xB5, 0x09, 0x1F, 0x33, 0x5F, 0xEF, 0x35, 0xDF, 0x67, 0x68, 0x58, 0xF7, 0x01, 0x0B, 0xF5, 0x2D,
+    0xA3, 0xEA, 0x39, 0x7F, 0x48, 0xCA, 0x77, 0xED, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66,
+    0x07, 0x67, 0x85, 0x56, 0xF2, 0xB8, 0xC0, 0x0D, 0x88, 0xDB, 0x14, 0x54, 0x08, 0xFB, 0xDA, 0x03,
+    0xF6, 0x6E, 0x37, 0xF2, 0x0F, 0xA0, 0x71, 0x94, 0x02, 0x89, 0xCA, 0x95, 0x25, 0x44, 0xEB, 0xE2,
+    0xEC, 0x9B, 0x10, 0x45, 0x74, 0x09, 0x3F, 0x81, 0x22, 0x45, 0x7C, 0x29, 0x9C, 0xE2, 0x24, 0x82,
+    0x64, 0x7B, 0x07, 0xB9, 0xA0, 0xA0, 0xF0, 0x84, 0x88, 0xDA, 0x23, 0x59, 0x08, 0x09, 0x0B, 0x79,
+    0x22, 0x6F, 0xC8, 0xDA, 0xDA, 0xBB, 0xC7, 0x9B, 0x9C, 0x09, 0x0A, 0x02, 0xC5, 0xA1, 0xA1, 0x61,
+    0xE6, 0xDD, 0xEE, 0xCC, 0xDC, 0x7B, 0xF3, 0xE6, 0x7D, 0xEF, 0x7B, 0xB3, 0x44, 0xD7, 0x7E, 0x8C,
+    0x74, 0xE8, 0xD2, 0x10, 0x4D, 0x47, 0x2F, 0xEF, 0xA2, 0x20, 0xFA, 0xE9, 0x63, 0x1B, 0x87, 0xEE,
+    0x92, 0x57, 0xB1, 0x2B, 0x27, 0x79, 0xD3, 0xAE, 0x95, 0x4F, 0x9C, 0x34, 0x17, 0xB5, 0x0A, 0x76,
+    0x80, 0x28, 0xA4, 0x89, 0xAD, 0xF2, 0x69, 0x95, 0x37, 0xE5, 0xE4, 0xE2, 0x96, 0x91, 0x4E, 0xDC,
+    0x7B, 0x9D, 0xFB, 0xB3, 0x59, 0xA6, 0xFC, 0xC5, 0x7D, 0x72, 0x84, 0xFA, 0x9A, 0xFE, 0x37, 0xC8,
+    0xE0, 0x0D, 0xA4, 0x13, 0x4C, 0x26, 0x89, 0xE9, 0xF7, 0x50, 0x57, 0xD1, 0x53, 0x13, 0x1F, 0x20,
+    0xED, 0x63, 0xDD, 0x8B, 0x13, 0x9B, 0xEC, 0xEB, 0x5E, 0x5B, 0x54, 0x79, 0xA9, 0xF3, 0x1A, 0x33,
+    0xC0, 0x89, 0x9E, 0x3B, 0xBC, 0xD5, 0x09, 0x72, 0x13, 0xDC, 0x12, 0x8B, 0xD4, 0x22, 0xB7, 0xF8,
+    0xDA, 0x8A, 0x43, 0x2B, 0xF7, 0xAC, 0x5A, 0xB2, 0x2D, 0x69, 0x33, 0x69, 0x4B, 0x1A, 0xB3, 0x40,
+    0xDA, 0x73, 0x09, 0x4D, 0x52, 0xB3, 0x31, 0xFC, 0x42, 0x63, 0x0D, 0xB1, 0x46, 0x59, 0x27, 0x54,
+    0xCD, 0xA5, 0x06, 0x3D, 0x44, 0x0E, 0xBD, 0x22, 0x3E, 0x18, 0x36, 0x34, 0xC1, 0x55, 0x60, 0xA6,
+    0x00, 0xF9, 0xF8, 0xEC, 0x2B, 0xA5, 0xB1, 0x08, 0x74, 0x81, 0xAC, 0xD4, 0x03, 0xF2, 0x03, 0xD4,
+    0x7D, 0xF4, 0x33, 0x64, 0x19, 0xFA, 0x6D, 0xD4, 0xEA, 0xC8, 0x4B, 0xB2, 0x7C, 0x78, 0x6E, 0x44,
+    0x27, 0x44, 0x9A, 0x55, 0x85, 0x87, 0x2A, 0xD0, 0x87, 0x74, 0x48, 0x81, 0x1A, 0xD2, 0x84, 0x2D,
+    0x2A, 0x24, 0x26, 0xEC, 0xC3, 0x8D, 0x63, 0x25, 0x9C, 0x96, 0x89, 0xE9, 0x2E, 0xA2, 0xDA, 0x8E,
+    0xCD, 0x64, 0x07, 0x64, 0x93, 0x63, 0xBB, 0x9D, 0x3C, 0xB2, 0xC9, 0x6D, 0xA4, 0x5D, 0xD4, 0xBB,
+    0x9F, 0x99, 0xB2, 0xC1, 0x3C, 0xB0, 0x8C, 0xF6, 0x24, 0x3A, 0xDD, 0x55, 0x45, 0xB7, 0x8F, 0x6F,
+    0xBC, 0x78, 0x6A, 0x18, 0x8C, 0x41, 0x4A, 0xDB, 0xE9, 0x13, 0x87, 0x44, 0x23, 0x63, 0x2F, 0xEF,
+    0x96, 0x20, 0x27, 0x96, 0x81, 0x02, 0xB3, 0x80, 0xE3, 0xC7, 0xBD, 0xB3, 0xDB, 0xD4, 0x08, 0x37,
+    0x9D, 0xBE, 0x8E, 0xE1, 0x90, 0xA7, 0xEC, 0x77, 0xF5, 0xFC, 0x0D, 0x94, 0xB4, 0x1F, 0x46, 0x6B,
+    0x2A, 0x72, 0x59, 0x6C, 0x46, 0xAA, 0xF0, 0x0A, 0x5E, 0x15, 0xA3, 0x58, 0x33, 0x6A, 0x29, 0x46,
+    0x91, 0xE6, 0x53, 0x2F, 0xC2, 0x27, 0x3C, 0x37, 0xDD, 0xC8, 0x2E, 0xB0, 0x48, 0x93, 0xC5, 0xBA,
+    0x4A, 0xA5, 0x5D, 0xC1, 0xDC, 0x3C, 0x8E, 0xE8, 0x46, 0x95, 0x7E, 0x84, 0x56, 0x86, 0x8E, 0xC7,
+    0xA1, 0x96, 0xB7, 0x30, 0xDB, 0x41, 0xC7, 0x85, 0xE1, 0x4D, 0xCE, 0xD1, 0xAB, 0xA4, 0x13, 0xB1,
+    0x2F, 0x0F, 0x8E, 0xFB, 0xFD, 0x2B, 0x3E, 0x36, 0x29, 0xFA, 0xE2, 0xCF, 0xD7, 0x34, 0x7C, 0x79,
+    0xB6, 0x1B, 0x31, 0x9C, 0xF0, 0xE0, 0x95, 0x76, 0x80, 0x37, 0x2D, 0x44, 0xF5, 0xC7, 0x83, 0x71,
+    0xDF, 0x23, 0x0A, 0x41, 0x2D, 0x63, 0x40, 0xF2, 0xB4, 0x9C, 0x79, 0xAE, 0xBB, 0x23, 0xC8, 0x46,
+    0x5B, 0x0E, 0xB1, 0x05, 0xA7, 0xB1, 0x07, 0xF1, 0xE4, 0x6C, 0xEB, 0x3B, 0xAA, 0x43, 0x7A, 0xFF,
+    0xA7, 0xCD, 0x7F, 0x40, 0x9B, 0x4B, 0x9B, 0x11, 0xD5, 0xAF, 0x71, 0x5C, 0x0B, 0x88, 0x1E, 0xD2,
+    0x78, 0x3D, 0x3A, 0xC0, 0x82, 0x97, 0x07, 0xD7, 0xC7, 0x79, 0x6D, 0x97, 0x21, 0x36, 0x91, 0x4F,
+    0xA4, 0x5D, 0x68, 0x21, 0x1B, 0x81, 0x31, 0xD9, 0x2F, 0x58, 0x2F, 0xE4, 0x72, 0x87, 0x2F, 0xC0,
+    0x31, 0xE6, 0x8B, 0xA0, 0x40, 0xEC, 0xA7, 0x85, 0xD6, 0x08, 0xB9, 0x01, 0x41, 0xFE, 0x8A, 0x56,
+    0x1F, 0xA3, 0x07, 0x89, 0x29, 0x6B, 0x8E, 0xFA, 0x1D, 0xAC, 0xB0, 0x73, 0x4E, 0xA3, 0xFC, 0x5E,
+    0x0B, 0xA6, 0xC4, 0x36, 0x30, 0x06, 0x3B, 0x49, 0x6E, 0x98, 0x54, 0xB8, 0x0C, 0x0F, 0x38, 0x84,
+    0x37, 0xEF, 0x08, 0x4E, 0x6D, 0xD8, 0x76, 0x0D, 0x78, 0x3C, 0xBC, 0xB7, 0x4F, 0xC4, 0x69, 0x19,
+    0x09, 0x57, 0xA5, 0x0C, 0x07, 0x63, 0xDC, 0x09, 0xC1, 0x4B, 0x1D, 0x40, 0xE8, 0xAC, 0x16, 0xC7,
+    0xB4, 0xE7, 0xD4, 0x94, 0xE6, 0xEE, 0x2F, 0x34, 0xD7, 0x78, 0x41, 0x17, 0x5F, 0xBA, 0x54, 0x5E,
+    0xF7, 0xB3, 0x29, 0xDE, 0xF7, 0x20, 0x2D, 0x8F, 0xB4, 0x52, 0x45, 0x47, 0x81, 0x57, 0x75, 0x9B,
+    0x1D, 0x77, 0xCE, 0xAF, 0x2C, 0x16, 0x7D, 0x79, 0x55, 0x6C, 0xCA, 0x72, 0x5C, 0xD6, 0x3D, 0xD1,
+    0xC8, 0x47, 0x46, 0x15, 0x6F, 0x67, 0xF0, 0xE2, 0x50, 0x2B, 0xB4, 0x3A, 0x7F, 0x3B, 0x70, 0x01,
+    0xFD, 0xCB, 0x2F, 0x3B, 0x0E, 0x2B, 0x7C, 0x48, 0xAE, 0x87, 0x2A, 0x7B, 0xC6, 0xB5, 0x4E, 0xA0,
+    0x5B, 0x90, 0x2E, 0xD6, 0xF2, 0x2B, 0xFE, 0x03, 0xB2, 0x9D, 0xF9, 0x70, 0xE4, 0xE7, 0x72, 0xE9,
+    0x6E, 0x4A, 0xFB, 0x81, 0x67, 0xEB, 0x88, 0x4F, 0xF1, 0x96, 0x63, 0x9E, 0xC5, 0x2B, 0xF1, 0x3E,
+    0xD9, 0x79, 0xC4, 0x48, 0x90, 0xDE, 0x2D, 0x1B, 0x85, 0x17, 0xBA, 0x8E, 0xC7, 0x4C, 0xAD, 0xD0,
+    0xDA, 0x93, 0x82, 0xCB, 0xCD, 0x21, 0xD7, 0xF7, 0x91, 0xF3, 0x87, 0x46, 0x71, 0xB1, 0x72, 0x9D,
+    0x21, 0xF2, 0xFC, 0x67, 0xC3, 0xDC, 0x19, 0x70, 0xB2, 0xC8, 0xA8, 0x5F, 0x86, 0x95, 0xF4, 0xD8,
+    0xE0, 0x25, 0x65, 0x72, 0x44, 0x0D, 0xEB, 0xE5, 0x74, 0xC6, 0x44, 0x20, 0x2A, 0xC4, 0xE0, 0x6A,
+    0xF1, 0xCC, 0x50, 0x4E, 0x8D, 0x80, 0x1C, 0xD3, 0x9D, 0x64, 0xA8, 0x68, 0x36, 0x67, 0xD2, 0xF3,
+    0x05, 0x21, 0xBF, 0xE5, 0xF8, 0xD7, 0xB8, 0x18, 0x92, 0x9F, 0x2D, 0xF8, 0xC3, 0xA9, 0xF9, 0xD7,
+    0x44, 0x5C, 0x55, 0x7A, 0xF0, 0x49, 0xA2, 0xD5, 0x0F, 0xB6, 0x12, 0x4D, 0x57, 0x21, 0x5F, 0x32,
+    0x5E, 0xFA, 0xAC, 0x85, 0x3C, 0xFE, 0xDC, 0xC5, 0x6E, 0xD4, 0xC5, 0x86, 0x5A, 0x32, 0xD2, 0xF9,
+    0x0C, 0x79, 0x1A, 0x6B, 0xF9, 0xD8, 0x8D, 0xD0, 0xFE, 0x54, 0x15, 0x82, 0x0C, 0x97, 0x1A, 0x87,
+    0x86, 0xFC, 0xA1, 0x83, 0x20, 0xDA, 0x0A, 0x1B, 0xD6, 0xF8, 0x8D, 0x4E, 0xA1, 0x18, 0x0D, 0xE1,
+    0x99, 0x1A, 0xAD, 0xA4, 0xC0, 0x3F, 0xB6, 0xDF, 0x01, 0xB5, 0x55, 0xBD, 0x6E, 0xDD, 0x36, 0x14,
+    0x3E, 0x22, 0x1B, 0x6B, 0xD0, 0xC0, 0x29, 0x19, 0x0A, 0x34, 0x7C, 0x03, 0xEB, 0x05, 0x7A, 0x45,
+    0xA5, 0x2F, 0x60, 0x17, 0xA8, 0xBD, 0x18, 0xE8, 0x0B, 0x64, 0xF0, 0x5C, 0xC0, 0x8E, 0x08, 0xF4,
+    0x01, 0xE2, 0x25, 0x28, 0xD0, 0xC5, 0x59, 0x5A, 0x14, 0x37, 0x83, 0x3B, 0x7A, 0xB0, 0x21, 0x19,
+    0x46, 0xA7, 0x0E, 0x55, 0x91, 0x02, 0xD9, 0x12, 0x01, 0xEE, 0x0F, 0xDA, 0x0C, 0x25, 0x6A, 0x05,
+    0x96, 0xAF, 0x25, 0xB1, 0xDF, 0xA1, 0x6E, 0x92, 0x5B, 0xA4, 0x53, 0x81, 0x0A, 0xE2, 0xA1, 0x74,
+    0xCE, 0x21, 0x0F, 0xCF, 0xDF, 0x47, 0x22, 0x3C, 0x51, 0x39, 0xE6, 0xC2, 0xFB, 0x4E, 0xFA, 0xED,
+    0x41, 0x0E, 0x14, 0x45, 0x3D, 0x98, 0x03, 0x46, 0x81, 0x91, 0xE6, 0x44, 0xAA, 0x22, 0x92, 0x6E,
+    0xED, 0xA3, 0x9F, 0x7B, 0xF9, 0xDB, 0x60, 0xC8, 0xDF, 0x6C, 0x54, 0xA6, 0x96, 0x4E, 0xD5, 0xD4,
+    0x4B, 0x47, 0x86, 0x7A, 0x4A, 0x6A, 0x43, 0x51, 0x07, 0x3D, 0x03, 0x46, 0xE2, 0xB0, 0xC1, 0x68,
+    0x88, 0xB4, 0xFF, 0xEE, 0xDB, 0xC8, 0x7B, 0x88, 0xFD, 0x48, 0x74, 0x2B, 0x27, 0x58, 0xF1, 0x54,
+    0x7A, 0x5F, 0xA5, 0xDE, 0xBB, 0x04, 0xBB, 0x0A, 0x07, 0x13, 0x27, 0x6C, 0x06, 0xE3, 0x5D, 0x86,
+    0xF7, 0x2D, 0x96, 0x8C, 0xBC, 0x24, 0x5F, 0xD5, 0x78, 0x7F, 0x9C, 0xB3, 0xB0, 0x8E, 0x8E, 0x16,
+    0x8F, 0xDF, 0xDD, 0x83, 0x26, 0xA7, 0xAE, 0xD9, 0x9C, 0x8B, 0xC6, 0xED, 0x0E, 0xCE, 0xBC, 0x47,
+    0x0F, 0xC0, 0xD4, 0x70, 0x26, 0xA9, 0xB1, 0x47, 0x8B, 0x9F, 0x53, 0xA2, 0xB5, 0x72, 0xFE, 0x8D,
+    0xE4, 0x33, 0xDD, 0x1F, 0xE7, 0x96, 0x19, 0xEC, 0x6E, 0x38, 0x24, 0x46, 0x75, 0x7B, 0xDC, 0xDA,
+    0x5C, 0xF1, 0x7F, 0x1A, 0xC9, 0x38, 0x9F, 0x3F, 0xF1, 0xCB, 0xE7, 0xB5, 0x31, 0x7E, 0xDA, 0x40,
+    0xE3, 0x89, 0x35, 0x9B, 0xCE, 0x00, 0x7D, 0x97, 0x0E, 0x0A, 0xA1, 0x7D, 0xE6, 0xC7, 0xC2, 0xF7,
+    0x6A, 0xDC, 0xF6, 0xD7, 0x3B, 0x9D, 0xA9, 0x84, 0xCF, 0xA5, 0x1B, 0x49, 0x22, 0x34, 0x4F, 0x1D,
+    0x21, 0x90, 0xE9, 0x06, 0x62, 0x47, 0xB4, 0x8F, 0xD1, 0x53, 0xD4, 0x82, 0xEF, 0x28, 0x86, 0xC8,
+    0x54, 0xA4, 0x37, 0xAA, 0xC8, 0x07, 0x91, 0x9A, 0x44, 0x45, 0x10, 0xC9, 0x17, 0x41, 0xA4, 0xA7,
+    0x55, 0x5D, 0x10, 0xC5, 0xE7, 0x41, 0xB4, 0x8E, 0x03, 0xC3, 0x55, 0x17, 0x0E, 0x91, 0xD8, 0x30,
+    0x7D, 0x38, 0x9D, 0xE8, 0x71, 0x98, 0x64, 0x4B, 0x9A, 0x94, 0x43, 0xD4, 0x4C, 0x8D, 0xF0, 0x79,
+    0x9B, 0x54, 0xD2, 0x23, 0x7E, 0xEA, 0x14, 0xAC, 0x59, 0x0F, 0xD6, 0x2B, 0xA4, 0xE7, 0xFE, 0xCD,
+    0xA2, 0xFC, 0x9A, 0xDD, 0xFC, 0xB5, 0x3C, 0x7A, 0xB2, 0xC8, 0xDB, 0x2C, 0xAE, 0x64, 0x73, 0xA2,
+    0xA3, 0xA3, 0x97, 0xE3, 0x18, 0x42, 0xF0, 0xE8, 0x7A, 0xE7, 0xE5, 0x2F, 0xB2, 0x51, 0x87, 0xA4,
+    0xAC, 0xD9, 0xA3, 0x8C, 0x1E, 0x38, 0xEA, 0xC8, 0x43, 0x4B, 0x78, 0xB0, 0xE2, 0x1E, 0x2C, 0xC5,
+    0xAC, 0xB4, 0x2A, 0x16, 0x88, 0x23, 0x6A, 0xA1, 0x41, 0x88, 0x90, 0x15, 0x4E, 0x45, 0x8A, 0xEF,
+    0x7D, 0xD2, 0x15, 0x0E, 0xCE, 0xAE, 0xC7, 0x35, 0x27, 0x40, 0xE7, 0xA2, 0xBD, 0x0B, 0x76, 0x52,
+    0x1F, 0x33, 0x5B, 0x36, 0x71, 0x2D, 0xFA, 0xC2, 0xEB, 0x7C, 0xF7, 0x7B, 0x3F, 0x14, 0x7E, 0xB8,
+    0x33, 0x7C, 0x8C, 0xBC, 0x83, 0xBD, 0x38, 0x80, 0x05, 0xCE, 0x67, 0x06, 0x6D, 0xA2, 0x0E, 0xDA,
+    0xC4, 0xDA, 0xF4, 0x2F, 0xEC, 0x96, 0xD9, 0x89, 0x3F, 0xE4, 0xEC, 0x8F, 0x21, 0x0C, 0xB9, 0x19,
+    0xF1, 0x43, 0x8A, 0xEB, 0x92, 0xE4, 0x82, 0x8F, 0x05, 0x5D, 0xAE, 0xFB, 0x6C, 0xCA, 0xB8, 0x8D,
+    0x1B, 0xDE, 0x8F, 0xFA, 0xD8, 0xD7, 0x1D, 0x99, 0xD8, 0xF7, 0x19, 0xE9, 0xCF, 0xBB, 0x4F, 0x95,
+    0x4D, 0x7E, 0xEC, 0x20, 0x90, 0x0E, 0xDB, 0x23, 0x95, 0xDA, 0x92, 0x41, 0x7A, 0x3B, 0x6C, 0xD5,
+    0x52, 0x89, 0x83, 0x15, 0x6C, 0x82, 0x3B, 0xA1, 0x70, 0x59, 0xD4, 0xC1, 0x65, 0x84, 0x06, 0xFB,
+    0x9D, 0x37, 0x49, 0x83, 0xB2, 0xEB, 0x90, 0x5D, 0xDA, 0x0F, 0x36, 0xD2, 0x0D, 0x1B, 0xFF, 0x55,
+    0xEB, 0xF3, 0x86, 0x86, 0x92, 0x6D, 0xE8, 0x43, 0x5F, 0xF3, 0xD9, 0x6E, 0x87, 0xA8, 0x58, 0x79,
+    0x01, 0xC7, 0x29, 0x83, 0x6A, 0xC5, 0xC9, 0x1E, 0x68, 0x2F, 0xA5, 0xAC, 0x49, 0xCE, 0x5C, 0xFC,
+    0x9C, 0x4E, 0x74, 0xFE, 0x99, 0x53, 0xB6, 0x4D, 0x1E, 0xC2, 0x92, 0x6D, 0x5B, 0x95, 0xF7, 0x6A,
+    0xE3, 0x9E, 0x4B, 0xCE, 0xDA, 0xE3, 0x34, 0x09, 0x85, 0x59, 0x32, 0x71, 0xB3, 0x75, 0x79, 0xDE,
+    0x60, 0xA3, 0xD9, 0x8C, 0xB2, 0x99, 0x78, 0x5A, 0x89, 0xCB, 0x6A, 0x7D, 0x8F, 0xF4, 0x5E, 0x74,
+    0x55, 0xD1, 0x95, 0x55, 0xC7, 0xA4, 0x3A, 0xBA, 0xB1, 0xE4, 0x73, 0xD5, 0x72, 0xBD, 0x95, 0x84,
+    0x37, 0x76, 0xFC, 0x16, 0xF0, 0xEA, 0x77, 0x12, 0x17, 0xDC, 0xBC, 0xC6, 0xCC, 0x8F, 0x9C, 0xBC,
+    0x6C, 0x28, 0xB5, 0x26, 0x43, 0x79, 0xF2, 0x67, 0x5C, 0x9B, 0x4C, 0x1C, 0x64, 0xF8, 0xCC, 0x64,
+    0x63, 0x30, 0xFE, 0xE3, 0x27, 0xC9, 0x8B, 0x26, 0xE3, 0x88, 0xE0, 0x13, 0xA1, 0xC8, 0xB6, 0x76,
+    0xDA, 0x0C, 0x0D, 0x39, 0x40, 0x1A, 0x52, 0x43, 0xB7, 0x98, 0x68, 0x3B, 0x91, 0x68, 0x6B, 0xF7,
+    0x27, 0x2E, 0x9F, 0x7E, 0x22, 0x6F, 0x05, 0xE9, 0xA0, 0x2D, 0x8A, 0xEB, 0xA1, 0x8D, 0x87, 0x1D,
+    0x6F, 0x55, 0x83, 0x8A, 0x46, 0x5D, 0x19, 0x6B, 0x72, 0x3E, 0x34, 0xAB, 0xFC, 0x83, 0xA8, 0xD5,
+    0x5F, 0x56, 0x49, 0x91, 0x45, 0x8B, 0x2E, 0x2C, 0x6D, 0xD2, 0xAD, 0x79, 0x0B, 0x04, 0xF8, 0xC1,
+    0x52, 0x31, 0x2A, 0x98, 0xCC, 0x57, 0x5A, 0x9C, 0x18, 0x2B, 0x5C, 0x20, 0xAB, 0xDC, 0x12, 0x27,
+    0x05, 0xA0, 0x01, 0x43, 0xBF, 0xEC, 0x29, 0xAD, 0x69, 0x93, 0x93, 0x4C, 0x09, 0xD7, 0x94, 0xE1,
+    0x62, 0xEB, 0x96, 0x7F, 0xBC, 0xD0, 0x2A, 0xC6, 0x33, 0x06, 0x92, 0x80, 0x2A, 0x51, 0xB1, 0xF5,
+    0x09, 0x4A, 0xC7, 0xA3, 0xC4, 0x50, 0xD6, 0xC4, 0x45, 0x17, 0xF8, 0x64, 0xF2, 0x25, 0xFE, 0x92,
+    0x0F, 0xE4, 0xD1, 0x2E, 0x08, 0xFB, 0x5C, 0x70, 0x95, 0x00, 0x4A, 0x81, 0x2D, 0xA2, 0x45, 0xA3,
+    0x26, 0x0D, 0x88, 0xAE, 0x04, 0xE3, 0x30, 0x48, 0x0F, 0x82, 0xEE, 0x16, 0x8E, 0xCB, 0xCD, 0x21,
+    0x08, 0xC2, 0x19, 0xC6, 0x4C, 0xAC, 0xBC, 0x73, 0x75, 0xBD, 0x95, 0x73, 0x61, 0x54, 0x05, 0x13,
+    0x31, 0x02, 0x11, 0x45, 0x07, 0x43, 0xC2, 0x29, 0xD6, 0x8B, 0x79, 0x85, 0x68, 0x5F, 0xEF, 0x02,
+    0xEB, 0x20, 0xA9, 0x15, 0x8C, 0x4F, 0x82, 0xAB, 0x02, 0x44, 0x74, 0xBC, 0xF6, 0x15, 0x57, 0xD7,
+    0x33, 0x26, 0x79, 0xF0, 0x30, 0xF8, 0x3B, 0xF9, 0x74, 0x06, 0x0F, 0x4C, 0x0A, 0x0F, 0xE0, 0x12,
+    0x1C, 0x66, 0x44, 0x0D, 0x2D, 0xCF, 0x61, 0xEA, 0xEF, 0x92, 0xBA, 0xB8, 0xEC, 0xE9, 0x03, 0x85,
+    0x75, 0x64, 0xA0, 0x2F, 0x38, 0xC7, 0x05, 0xA3, 0x2A, 0x43, 0x29, 0x5F, 0x19, 0x51, 0xFD, 0x76,
+    0xAF, 0x6A, 0x19, 0xC0, 0xE5, 0xB3, 0xE6, 0x43, 0xCF, 0x72, 0xA4, 0x42, 0xF8, 0xD3, 0xAF, 0x76,
+    0xF9, 0x92, 0x02, 0xB4, 0x53, 0x99, 0x4F, 0xB5, 0x92, 0x06, 0xF4, 0x4D, 0xF3, 0x10, 0x7B, 0xAC,
+    0x0D, 0xFB, 0xF0, 0x1C, 0xC0, 0x39, 0x9B, 0x70, 0x1F, 0xED, 0x15, 0x52, 0x02, 0xB8, 0x99, 0xE6,
+    0xFE, 0xCD, 0x3C, 0xC9, 0xD1, 0xDF, 0xB8, 0x76, 0x2C, 0xA0, 0x43, 0x3A, 0xED, 0xD9, 0xED, 0xB8,
+    0x31, 0x5F, 0x74, 0x92, 0x03, 0x71, 0x1A, 0xAE, 0xBC, 0xB4, 0xEA, 0x81, 0x0C, 0x0D, 0x15, 0xF7,
+    0xD0, 0xD0, 0x49, 0x1D, 0x8D, 0x58, 0xD8, 0x27, 0x95, 0x86, 0x8E, 0xE8, 0xD4, 0x1F, 0x00, 0xA8,
+    0x2E, 0x71, 0x0C, 0x2E, 0x48, 0x79, 0xAD, 0xFD, 0x01, 0xC5, 0x7F, 0x8E, 0x13, 0x18, 0x57, 0x9B,
+    0x61, 0x56, 0xCB, 0x9B, 0xE3, 0xCD, 0x3C, 0x81, 0x74, 0xB8, 0xA0, 0x68, 0x79, 0x95, 0xD1, 0x8A,
+    0xFB, 0x19, 0xFD, 0x3F, 0xCF, 0xDF, 0xB5, 0x55, 0x31, 0x6C, 0xDD, 0x54, 0x14, 0xBD, 0xB6, 0x95,
+    0x58, 0xC4, 0x12, 0x8F, 0xA1, 0xA8, 0x03, 0x12, 0x7F, 0xE9, 0xC0, 0xD2, 0x78, 0x62, 0xFB, 0xE9,
+    0x73, 0xE9, 0xC0, 0xC0, 0x50, 0x06, 0xD2, 0x25, 0x43, 0x19, 0xD8, 0x8A, 0x94, 0x85, 0x01, 0xA4,
+    0x26, 0x7E, 0x88, 0x95, 0x21, 0x4B, 0x19, 0x98, 0xA8, 0xD4, 0x81, 0xBA, 0x43, 0x3A, 0x64, 0x23,
+    0xA9, 0xCD, 0xC4, 0xC0, 0xE2, 0x0A, 0x01, 0x03, 0x43, 0x0D, 0x05, 0x2A, 0x92, 0x21, 0x8F, 0xCA,
+    0x91, 0x7E, 0x8A, 0xED, 0xC7, 0x39, 0xCF, 0xE1, 0x53, 0x50, 0x51, 0xA5, 0x4A, 0x58, 0xF2, 0xFD,
+    0xEF, 0xDF, 0x77, 0xDF, 0xBD, 0xE7, 0xDD, 0x73, 0xEF, 0xB5, 0x88, 0x7F, 0xCA, 0x5A, 0x44, 0x3B,
+    0x91, 0xE4, 0xC7, 0x4E, 0xA4, 0x53, 0x95, 0x28, 0xB3, 0x2B, 0x32, 0x4B, 0xB0, 0xA8, 0x76, 0x47,
+    0x4D, 0x52, 0xCD, 0x44, 0x36, 0x26, 0x22, 0xD1, 0x4F, 0x16, 0xC6, 0x2B, 0x22, 0x81, 0xAB, 0x44,
+    0x54, 0xCB, 0xE3, 0x22, 0x2F, 0x24, 0x8D, 0x24, 0x02, 0x17, 0x6D, 0x3A, 0x93, 0xF4, 0xAB, 0x7B,
+    0x55, 0x34, 0x74, 0x7B, 0xB2, 0xE7, 0xA2, 0x46, 0x5D, 0x6C, 0x74, 0x64, 0xA7, 0x41, 0xBB, 0x11,
+    0x66, 0xCA, 0xC0, 0x1A, 0x21, 0xE0, 0x0D, 0x62, 0xF7, 0xAF, 0x05, 0x34, 0xCF, 0xAD, 0x1B, 0x38,
+    0x84, 0x67, 0x35, 0x93, 0xD0, 0x1D, 0xE3, 0xD7, 0x39, 0x23, 0xFA, 0x16, 0x62, 0x74, 0x92, 0x9B,
+    0xC8, 0x4A, 0x1E, 0x3A, 0x3C, 0xBF, 0x96, 0xC5, 0xAD, 0xC1, 0x74, 0x12, 0x37, 0x50, 0x4D, 0xCC,
+    0xE5, 0x6F, 0x57, 0xEF, 0xBC, 0x41, 0xFD, 0xA7, 0x43, 0xB1, 0xFD, 0x1B, 0x54, 0x83, 0xA8, 0x2F,
+    0xD7, 0x2D, 0x2E, 0x33, 0x88, 0x38, 0xB7, 0x25, 0x50, 0xC1, 0x17, 0x83, 0x68, 0x39, 0x89, 0xFD,
+    0x04, 0x15, 0x2E, 0x43, 0x91, 0x00, 0x5E, 0x50, 0xE2, 0xD4, 0xC4, 0xB9, 0x1E, 0xC7, 0x0F, 0xBA,
+    0x68, 0x48, 0xCC, 0x19, 0xD5, 0x62, 0x63, 0x52, 0x41, 0x68, 0x03, 0x91, 0xD3, 0xEE, 0x0E, 0x45,
+    0x3F, 0x17, 0x9D, 0x24, 0xFB, 0x37, 0x21, 0x9C, 0xF3, 0x82, 0xBA, 0x9C, 0x26, 0x9A, 0xC6, 0x5A,
+    0x67, 0x10, 0x29, 0x1C, 0x68, 0xD5, 0x40, 0xC4, 0x1D, 0x44, 0xE8, 0x0E, 0x3E, 0x71, 0x92, 0x03,
+    0xBA, 0xC4, 0xCE, 0xFD, 0x8C, 0xE0, 0x5B, 0x27, 0x08, 0x64, 0x31, 0x83, 0xD8, 0x24, 0x20, 0x4D,
+    0x94, 0x13, 0xA6, 0x38, 0x71, 0x44, 0xFE, 0x07, 0xFE, 0x07, 0xC7, 0x33, 0xE6, 0x8E, 0xD8, 0x75,
+    0x02, 0xDE, 0x26, 0x1F, 0x22, 0xE1, 0x4C, 0xC1, 0xD7, 0x14, 0x36, 0x9C, 0x05, 0xE4, 0x90, 0x77,
+    0x43, 0xEC, 0x3A, 0xA1, 0xF2, 0x21, 0x45, 0x17, 0x5B, 0x49, 0x9A, 0xB0, 0xE5, 0x26, 0x2C, 0x74,
+    0x86, 0x08, 0x49, 0xA3, 0xB3, 0x91, 0x5E, 0xD1, 0xAF, 0x37, 0x22, 0xF1, 0xFD, 0x76, 0x9E, 0x91,
+    0x45, 0xB0, 0x10, 0xF1, 0x3E, 0x7A, 0xBF, 0xB4, 0x61, 0x26, 0x39, 0x2C, 0x43, 0x86, 0x9E, 0x30,
+    0x4B, 0x5C, 0xA4, 0x3E, 0xF3, 0x25, 0xA3, 0xC2, 0xDA, 0xF8, 0x37, 0xC6, 0x7B, 0xC9, 0x5D, 0x5B,
+    0x5D, 0xE3, 0x56, 0xBE, 0x5F, 0x14, 0xD7, 0xFF, 0x71, 0x64, 0xC2, 0x0B, 0x81, 0x9A, 0x53, 0xF1,
+    0xB0, 0xBA, 0x6D, 0x00, 0x7B, 0x26, 0xEB, 0x64, 0x7B, 0x81, 0x57, 0x5E, 0x60, 0xD8, 0x29, 0x1D,
+    0x23, 0x1F, 0x4C, 0x65, 0xE0, 0x0E, 0xB7, 0x6B, 0xD5, 0x4E, 0x17, 0x51, 0x58, 0x00, 0x6F, 0xA3,
+    0x0A, 0xB0, 0x95, 0xE0, 0x82, 0x53, 0x40, 0x87, 0x4A, 0x67, 0x50, 0xF5, 0xA2, 0xC8, 0xE9, 0x94,
+    0x9C, 0x3E, 0xA6, 0x02, 0xD6, 0xA9, 0xE0, 0xCE, 0x56, 0x54, 0xCD, 0x83, 0x95, 0x42, 0x46, 0x0C,
+    0xDC, 0x97, 0x06, 0x05, 0x50, 0x1E, 0x7C, 0x67, 0x05, 0xD0, 0x2B, 0x04, 0x03, 0x9E, 0x80, 0xF7,
+    0x8E, 0x08, 0x6E, 0x09, 0xEF, 0x6D, 0x1C, 0x12, 0xEB, 0x45, 0x60, 0x25, 0xB0, 0xA1, 0x25, 0x1C,
+    0xD7, 0x91, 0xAD, 0xEE, 0xF4, 0xF1, 0x95, 0xA3, 0xB7, 0x22, 0x8B, 0x88, 0xCF, 0x22, 0x90, 0xFF,
+    0xC8, 0x06, 0xFD, 0x02, 0xFE, 0xB8, 0x01, 0x42, 0x0F, 0x2C, 0xBE, 0x4C, 0x4E, 0x1E, 0x26, 0x5D,
+    0x88, 0x0B, 0x15, 0x7A, 0xBC, 0x36, 0x23, 0x87, 0x92, 0x49, 0x44, 0x74, 0x63, 0xC9, 0x8E, 0x35,
+    0x3B, 0x52, 0x14, 0x7A, 0x19, 0xF5, 0x94, 0xB1, 0xCB, 0xBC, 0x6C, 0xE8, 0xCE, 0x31, 0xD5, 0x92,
+    0xFA, 0xED, 0x64, 0x34, 0x6A, 0x5F, 0x59, 0x32, 0x37, 0xE2, 0xFB, 0xBD, 0xBB, 0xD7, 0xA9, 0x8F,
+    0x37, 0x54, 0x6D, 0xCF, 0xBD, 0x6A, 0x5F, 0x0E, 0xEF, 0xB6, 0x5F, 0x98, 0xF7, 0x92, 0x8B, 0x55,
+    0x79, 0xBE, 0x5E, 0xEE, 0x11, 0x76, 0xDF, 0xD5, 0x72, 0xE0, 0x1C, 0x30, 0x9A, 0x0F, 0xD6, 0x32,
+    0x79, 0x3E, 0xA8, 0xCF, 0x8A, 0x9C, 0x09, 0xB3, 0xB7, 0x7D, 0xA1, 0x3E, 0xC0, 0x3B, 0x70, 0xD1,
+    0xCC, 0xE1, 0x16, 0x45, 0x71, 0x73, 0xBE, 0x75, 0x42, 0xF1, 0x9C, 0xEB, 0x67, 0x5D, 0xC0, 0xE1,
+    0x11, 0xFC, 0xDD, 0x5D, 0x3F, 0x5E, 0x25, 0x81, 0xE8, 0x75, 0x5E, 0x1E, 0x5D, 0xE2, 0x2E, 0xB3,
+    0xB5, 0xD8, 0xBF, 0xA8, 0xA3, 0xA0, 0x97, 0xC5, 0xB2, 0x91, 0x1C, 0xD7, 0xEF, 0xC7, 0xCA, 0xE4,
+    0x06, 0xED, 0x55, 0x3D, 0x26, 0x2B, 0x35, 0x63, 0xBA, 0x90, 0x43, 0x9A, 0xB0, 0x2F, 0x76, 0xFF,
+    0xD5, 0xFF, 0xEF, 0x22, 0x95, 0x18, 0x17, 0x11, 0x6B, 0x20, 0x1D, 0x38, 0x75, 0x90, 0xC6, 0xCD,
+    0x0E, 0x84, 0x5F, 0xF8, 0x1D, 0xB5, 0xA1, 0x50, 0x88, 0x01, 0x9B, 0x33, 0xEF, 0x24, 0xBC, 0xFE,
+    0x00, 0xA5, 0x54, 0xE1, 0xA0, 0xA6, 0x57, 0x36, 0x91, 0x1F, 0x42, 0x1A, 0xCA, 0x80, 0xFD, 0x86,
+    0xB0, 0x5D, 0x30, 0x48, 0x74, 0x04, 0x54, 0x0A, 0x38, 0x31, 0x84, 0xE6, 0xBC, 0xFA, 0x27, 0x37,
+    0x9E, 0x16, 0xE7, 0x09, 0xA9, 0x3C, 0x47, 0xEF, 0xC7, 0x95, 0x1F, 0x82, 0x2B, 0xFC, 0xB3, 0x11,
+    0xD5, 0xDC, 0x19, 0xCA, 0xA2, 0xB8, 0xC1, 0xF9, 0xC7, 0xEE, 0x78, 0xC9, 0x37, 0xB5, 0x70, 0x07,
+    0x99, 0xA1, 0xD9, 0x55, 0xFF, 0x07, 0xEF, 0xCA, 0x52, 0x98, 0x9D, 0x95, 0xE8, 0x9B, 0x76, 0x2F,
+    0xAC, 0xE5, 0x1C, 0x58, 0x9B, 0xE2, 0x6C, 0xFA, 0xFD, 0x21, 0x00, 0x9A, 0xDB, 0x8A, 0xFD, 0xE2,
+    0x8B, 0x64, 0x04, 0x71, 0x75, 0xAC, 0x98, 0x78, 0xA4, 0x2E, 0xFD, 0xE5, 0x52, 0xE6, 0xEB, 0x8C,
+    0x85, 0x85, 0x89, 0xE7, 0x4D, 0x4E, 0x79, 0x5C, 0xDE, 0xC0, 0xA7, 0xE8, 0x29, 0xF2, 0xCA, 0x23,
+    0x9C, 0x9A, 0x10, 0xA3, 0x10, 0xA3, 0x89, 0x50, 0xCE, 0x79, 0x83, 0x26, 0xB5, 0x89, 0x45, 0xC7,
+    0x61, 0x10, 0x4D, 0x2A, 0x58, 0x76, 0x69, 0x06, 0xB9, 0xA7, 0x79, 0x6A, 0xF3, 0x31, 0xA9, 0xB5,
+    0x84, 0x5B, 0x94, 0xE4, 0xE1, 0xBF, 0x64, 0xE8, 0x86, 0x2D, 0x66, 0xA2, 0xC5, 0x10, 0x42, 0xA0,
+    0x4E, 0x14, 0xBB, 0x48, 0x35, 0x20, 0x61, 0x52, 0x69, 0x12, 0xC8, 0x59, 0xE7, 0x1B, 0x0B, 0xAA,
+    0xD4, 0x68, 0x56, 0x45, 0x7F, 0xBE, 0x6C, 0xD0, 0x41, 0x03, 0xBF, 0x17, 0x26, 0xC8, 0xAF, 0x65,
+    0x7F, 0x8F, 0xFD, 0x60, 0xFB, 0xD1, 0xE7, 0x6C, 0xE5, 0x46, 0x5E, 0x1C, 0x56, 0xB3, 0x27, 0x7E,
+    0x09, 0x82, 0xAD, 0x77, 0x20, 0x97, 0x13, 0x4E, 0xBB, 0x23, 0xFF, 0x71, 0x63, 0xB9, 0xC3, 0x5F,
+    0x8D, 0x5E, 0x4D, 0x9C, 0x49, 0x1E, 0x36, 0x3B, 0x7D, 0xD0, 0x2D, 0x27, 0x17, 0xAC, 0x7E, 0xAD,
+    0xD9, 0x49, 0x3F, 0xB2, 0xB0, 0xED, 0x36, 0xC3, 0x66, 0x47, 0xFD, 0x50, 0x63, 0xB9, 0xD7, 0x63,
+    0x99, 0x1C, 0x72, 0xB9, 0xD9, 0x4B, 0xF6, 0x66, 0xB0, 0x46, 0x52, 0xF1, 0xBD, 0x90, 0xB1, 0x38,
+    0x4F, 0x62, 0xF9, 0x49, 0xEA, 0x2B, 0x95, 0xA3, 0x58, 0xC6, 0xA9, 0x28, 0x72, 0xDA, 0x15, 0xC5,
+    0x67, 0x9E, 0x7A, 0x19, 0x89, 0xFF, 0x9F, 0x9F, 0x3F, 0x01, 0x4D, 0x90, 0x41, 0x4A, 0xC4, 0x30,
+    0x14, 0x86, 0xFF, 0xB6, 0x38, 0x5D, 0x14, 0xC9, 0xDC, 0xC0, 0x13, 0x48, 0x37, 0x2E, 0x85, 0x14,
+    0xBC, 0x80, 0x0B, 0xBB, 0x9A, 0x85, 0x37, 0x31, 0x05, 0x0F, 0xE0, 0x35, 0xC4, 0x8D, 0x1B, 0x97,
+    0x62, 0xEB, 0x09, 0xAC, 0x37, 0x28, 0x8C, 0xEE, 0x03, 0xD3, 0x45, 0x1D, 0x9A, 0xF9, 0x7D, 0x49,
+    0xCA, 0x68, 0x20, 0x7C, 0x7C, 0xC9, 0xCF, 0xCB, 0x7B, 0x01, 0x80, 0xE2, 0xAA, 0xC3, 0xB9, 0x02,
+    0x5E, 0x2E, 0xD1, 0xD2, 0x66, 0xE4, 0xAC, 0x64, 0x6B, 0xE4, 0xD3, 0x8C, 0x7C, 0x67, 0xA1, 0x3E,
+    0x3A, 0x68, 0x0D, 0xCC, 0xA2, 0x5B, 0x0B, 0xA3, 0xF6, 0xCF, 0xA3, 0xE6, 0x01, 0x24, 0xEF, 0x45,
+    0xFD, 0xAD, 0x01, 0xDE, 0x66, 0x24, 0xB4, 0xC8, 0xD9, 0xA1, 0x24, 0x70, 0x98, 0x51, 0xEC, 0xF6,
+    0x4F, 0x7C, 0x20, 0x43, 0x38, 0xED, 0xED, 0xF1, 0xA1, 0xF5, 0x1A, 0x7E, 0xA5, 0x9C, 0x12, 0xB2,
+    0x37, 0xDF, 0xAF, 0x6A, 0x40, 0x3A, 0x01, 0xF2, 0x46, 0x66, 0x81, 0x3B, 0x20, 0x1F, 0x8E, 0x58,
+    0x0E, 0xCB, 0x06, 0x89, 0x93, 0x5E, 0x7F, 0x56, 0x7D, 0x49, 0x07, 0xC3, 0x06, 0x27, 0xBE, 0x48,
+    0x52, 0xD7, 0x37, 0x9A, 0xDC, 0x92, 0xCE, 0x48, 0x43, 0xB7, 0xB2, 0x3F, 0xEB, 0xBA, 0xBE, 0xC6,
+    0xDF, 0x3A, 0x5D, 0xE8, 0x22, 0xD4, 0x42, 0x46, 0xAA, 0x85, 0x8C, 0x54, 0x5F, 0xAB, 0xC0, 0x29,
+    0xE6, 0xA5, 0xB3, 0x40, 0xBE, 0x3F, 0x66, 0xCE, 0x87, 0xDB, 0xB1, 0x70, 0x3E, 0xCC, 0xA1, 0x74,
+    0xA2, 0xA4, 0xAF, 0x23, 0xB0, 0x39, 0x5D, 0x50, 0x43, 0xA7, 0x83, 0xFA, 0xB9, 0xD9, 0xB4, 0x64,
+    0xA5, 0xE9, 0xE4, 0x57, 0x47, 0x68, 0x8E, 0x67, 0xA2, 0x42, 0x7A, 0x8D, 0xAC, 0x3C, 0x37, 0x5E,
+    0xA1, 0xAD, 0xF2, 0x0A, 0xDD, 0x95, 0x5E, 0x65, 0xF4, 0xA0, 0xD0, 0x9B, 0xA0, 0x92, 0xAB, 0x22,
+    0xA3, 0x42, 0x47, 0xC5, 0xC5, 0xBF, 0x61, 0x7F, 0x01,
+};
+
+static const uint32_t notosans_16_regularBlockOffsets[42] = {
+    0, 1128, 2092, 3027, 3986, 5026, 5834, 6527,
+    7368, 8096, 9028, 9874, 10512, 11235, 11844, 12661,
+    13282, 14148, 15340, 16248, 17207, 17977, 19063, 19973,
+    20994, 22064, 23104, 24015, 25060, 25840, 26667, 27521,
+    28372, 29300, 30317, 31298, 32435, 33319, 34265, 35382,
+    36458, 36729,
+};
+
+static const uint16_t notosans_16_regularDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_16_regularGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_16_regularPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 0,
 };
 
 static const EpdGlyph notosans_16_regularGlyphs[] = {
@@ -5052,855 +2487,855 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 17, 24, 19, 1, 24, 102, 1707 }, // 7
     { 17, 26, 19, 1, 25, 111, 1809 }, // 8
     { 17, 26, 19, 1, 25, 111, 1920 }, // 9
-    { 5, 20, 9, 2, 19, 25, 2031 }, // :
-    { 6, 24, 9, 1, 19, 36, 2056 }, // ;
-    { 17, 18, 19, 1, 21, 77, 2092 }, // <
-    { 17, 10, 19, 1, 17, 43, 2169 }, // =
-    { 17, 18, 19, 1, 21, 77, 2212 }, // >
-    { 14, 26, 14, 0, 25, 91, 2289 }, // ?
-    { 28, 27, 30, 1, 24, 189, 2380 }, // @
-    { 22, 24, 21, 0, 24, 132, 2569 }, // A
-    { 17, 24, 22, 3, 24, 102, 2701 }, // B
-    { 19, 26, 21, 2, 25, 124, 2803 }, // C
-    { 20, 24, 24, 3, 24, 120, 2927 }, // D
-    { 14, 24, 19, 3, 24, 84, 3047 }, // E
-    { 14, 24, 17, 3, 24, 84, 3131 }, // F
-    { 20, 26, 24, 2, 25, 130, 3215 }, // G
-    { 19, 24, 25, 3, 24, 114, 3345 }, // H
-    { 9, 24, 11, 1, 24, 54, 3459 }, // I
-    { 10, 31, 9, -3, 24, 78, 3513 }, // J
-    { 18, 24, 21, 3, 24, 108, 3591 }, // K
-    { 14, 24, 17, 3, 24, 84, 3699 }, // L
-    { 24, 24, 30, 3, 24, 144, 3783 }, // M
-    { 20, 24, 25, 3, 24, 120, 3927 }, // N
-    { 22, 26, 26, 2, 25, 143, 4047 }, // O
-    { 16, 24, 20, 3, 24, 96, 4190 }, // P
-    { 22, 31, 26, 2, 25, 171, 4286 }, // Q
-    { 18, 24, 21, 3, 24, 108, 4457 }, // R
-    { 16, 26, 18, 1, 25, 104, 4565 }, // S
-    { 19, 24, 19, 0, 24, 114, 4669 }, // T
-    { 19, 25, 24, 3, 24, 119, 4783 }, // U
-    { 20, 24, 20, 0, 24, 120, 4902 }, // V
-    { 31, 24, 31, 0, 24, 186, 5022 }, // W
-    { 20, 24, 20, 0, 24, 120, 5208 }, // X
-    { 19, 24, 19, 0, 24, 114, 5328 }, // Y
-    { 17, 24, 19, 1, 24, 102, 5442 }, // Z
-    { 9, 30, 11, 2, 24, 68, 5544 }, // [
-    { 13, 24, 12, 0, 24, 78, 5612 }, // <backslash>
-    { 9, 30, 11, 0, 24, 68, 5690 }, // ]
-    { 17, 16, 19, 1, 24, 68, 5758 }, // ^
-    { 16, 3, 15, -1, -3, 12, 5826 }, // _
-    { 8, 6, 9, 1, 26, 12, 5838 }, // `
-    { 15, 20, 19, 1, 19, 75, 5850 }, // a
-    { 17, 27, 21, 2, 26, 115, 5925 }, // b
-    { 14, 20, 16, 1, 19, 70, 6040 }, // c
-    { 17, 27, 21, 1, 26, 115, 6110 }, // d
-    { 17, 20, 19, 1, 19, 85, 6225 }, // e
-    { 13, 26, 11, 0, 26, 85, 6310 }, // f
-    { 17, 27, 21, 1, 19, 115, 6395 }, // g
-    { 16, 26, 21, 2, 26, 104, 6510 }, // h
-    { 5, 25, 9, 2, 25, 32, 6614 }, // i
-    { 9, 33, 9, -2, 25, 75, 6646 }, // j
-    { 16, 26, 18, 2, 26, 104, 6721 }, // k
-    { 4, 26, 9, 2, 26, 26, 6825 }, // l
-    { 27, 19, 31, 2, 19, 129, 6851 }, // m
-    { 16, 19, 21, 2, 19, 76, 6980 }, // n
-    { 18, 20, 20, 1, 19, 90, 7056 }, // o
-    { 17, 27, 21, 2, 19, 115, 7146 }, // p
-    { 17, 27, 21, 1, 19, 115, 7261 }, // q
-    { 12, 19, 14, 2, 19, 57, 7376 }, // r
-    { 14, 20, 16, 1, 19, 70, 7433 }, // s
-    { 12, 23, 12, 0, 22, 69, 7503 }, // t
-    { 16, 19, 21, 2, 18, 76, 7572 }, // u
-    { 17, 18, 17, 0, 18, 77, 7648 }, // v
-    { 26, 18, 26, 0, 18, 117, 7725 }, // w
-    { 18, 18, 18, 0, 18, 81, 7842 }, // x
-    { 17, 26, 17, 0, 18, 111, 7923 }, // y
-    { 14, 18, 16, 1, 18, 63, 8034 }, // z
-    { 12, 30, 13, 0, 24, 90, 8097 }, // {
-    { 4, 35, 18, 7, 26, 35, 8187 }, // |
-    { 11, 30, 13, 1, 24, 83, 8222 }, // }
-    { 17, 5, 19, 1, 14, 22, 8305 }, // ~
-    { 0, 0, 9, 0, 0, 0, 8327 }, //  
-    { 5, 26, 9, 2, 19, 33, 8327 }, // ¡
-    { 14, 26, 19, 3, 25, 91, 8360 }, // ¢
-    { 17, 25, 19, 1, 25, 107, 8451 }, // £
-    { 17, 16, 19, 1, 20, 68, 8558 }, // ¤
-    { 19, 24, 19, 0, 24, 114, 8626 }, // ¥
-    { 4, 35, 18, 7, 26, 35, 8740 }, // ¦
-    { 14, 27, 17, 1, 26, 95, 8775 }, // §
-    { 11, 4, 19, 4, 25, 11, 8870 }, // ¨
-    { 26, 26, 28, 1, 25, 169, 8881 }, // ©
-    { 10, 13, 12, 1, 25, 33, 9050 }, // ª
-    { 15, 15, 17, 1, 16, 57, 9083 }, // «
-    { 17, 9, 19, 1, 13, 39, 9140 }, // ¬
-    { 9, 4, 11, 1, 11, 9, 9179 }, // ­
-    { 26, 26, 28, 1, 25, 169, 9188 }, // ®
-    { 18, 3, 17, -1, 28, 14, 9357 }, // ¯
-    { 12, 12, 14, 1, 25, 36, 9371 }, // °
-    { 17, 20, 19, 1, 20, 85, 9407 }, // ±
-    { 11, 16, 12, 0, 29, 44, 9492 }, // ²
-    { 11, 16, 12, 0, 29, 44, 9536 }, // ³
-    { 8, 6, 9, 1, 26, 12, 9580 }, // ´
-    { 16, 26, 21, 2, 18, 104, 9592 }, // µ
-    { 18, 31, 22, 1, 26, 140, 9696 }, // ¶
-    { 5, 6, 9, 2, 15, 8, 9836 }, // ·
-    { 8, 8, 8, 0, 0, 16, 9844 }, // ¸
-    { 7, 16, 12, 1, 29, 28, 9860 }, // ¹
-    { 11, 13, 13, 1, 25, 36, 9888 }, // º
-    { 15, 15, 17, 1, 16, 57, 9924 }, // »
-    { 24, 24, 25, 1, 24, 144, 9981 }, // ¼
-    { 25, 24, 26, 0, 24, 150, 10125 }, // ½
-    { 26, 25, 26, 0, 25, 163, 10275 }, // ¾
-    { 14, 26, 14, 0, 19, 91, 10438 }, // ¿
-    { 22, 32, 21, 0, 32, 176, 10529 }, // À
-    { 22, 32, 21, 0, 32, 176, 10705 }, // Á
-    { 22, 32, 21, 0, 32, 176, 10881 }, // Â
-    { 22, 31, 21, 0, 31, 171, 11057 }, // Ã
-    { 22, 31, 21, 0, 31, 171, 11228 }, // Ä
-    { 22, 30, 21, 0, 30, 165, 11399 }, // Å
-    { 29, 24, 29, -1, 24, 174, 11564 }, // Æ
-    { 19, 33, 21, 2, 25, 157, 11738 }, // Ç
-    { 14, 32, 19, 3, 32, 112, 11895 }, // È
-    { 14, 32, 19, 3, 32, 112, 12007 }, // É
-    { 14, 32, 19, 3, 32, 112, 12119 }, // Ê
-    { 14, 31, 19, 3, 31, 109, 12231 }, // Ë
-    { 9, 32, 11, 1, 32, 72, 12340 }, // Ì
-    { 10, 32, 11, 1, 32, 80, 12412 }, // Í
-    { 12, 32, 11, 0, 32, 96, 12492 }, // Î
-    { 10, 31, 11, 1, 31, 78, 12588 }, // Ï
-    { 22, 24, 24, 1, 24, 132, 12666 }, // Ð
-    { 20, 31, 25, 3, 31, 155, 12798 }, // Ñ
-    { 22, 33, 26, 2, 32, 182, 12953 }, // Ò
-    { 22, 33, 26, 2, 32, 182, 13135 }, // Ó
-    { 22, 33, 26, 2, 32, 182, 13317 }, // Ô
-    { 22, 32, 26, 2, 31, 176, 13499 }, // Õ
-    { 22, 32, 26, 2, 31, 176, 13675 }, // Ö
-    { 15, 16, 19, 2, 20, 60, 13851 }, // ×
-    { 22, 27, 26, 2, 25, 149, 13911 }, // Ø
-    { 19, 33, 24, 3, 32, 157, 14060 }, // Ù
-    { 19, 33, 24, 3, 32, 157, 14217 }, // Ú
-    { 19, 33, 24, 3, 32, 157, 14374 }, // Û
-    { 19, 32, 24, 3, 31, 152, 14531 }, // Ü
-    { 19, 32, 19, 0, 32, 152, 14683 }, // Ý
-    { 16, 24, 20, 3, 24, 96, 14835 }, // Þ
-    { 18, 27, 21, 2, 26, 122, 14931 }, // ß
-    { 15, 27, 19, 1, 26, 102, 15053 }, // à
-    { 15, 27, 19, 1, 26, 102, 15155 }, // á
-    { 15, 27, 19, 1, 26, 102, 15257 }, // â
-    { 15, 26, 19, 1, 25, 98, 15359 }, // ã
-    { 15, 26, 19, 1, 25, 98, 15457 }, // ä
-    { 15, 29, 19, 1, 28, 109, 15555 }, // å
-    { 27, 20, 29, 1, 19, 135, 15664 }, // æ
-    { 14, 27, 16, 1, 19, 95, 15799 }, // ç
-    { 17, 27, 19, 1, 26, 115, 15894 }, // è
-    { 17, 27, 19, 1, 26, 115, 16009 }, // é
-    { 17, 27, 19, 1, 26, 115, 16124 }, // ê
-    { 17, 26, 19, 1, 25, 111, 16239 }, // ë
-    { 8, 26, 9, -1, 26, 52, 16350 }, // ì
-    { 8, 26, 9, 2, 26, 52, 16402 }, // í
-    { 12, 26, 9, -2, 26, 78, 16454 }, // î
-    { 10, 25, 9, -1, 25, 63, 16532 }, // ï
-    { 18, 27, 20, 1, 26, 122, 16595 }, // ð
-    { 16, 25, 21, 2, 25, 100, 16717 }, // ñ
-    { 18, 27, 20, 1, 26, 122, 16817 }, // ò
-    { 18, 27, 20, 1, 26, 122, 16939 }, // ó
-    { 18, 27, 20, 1, 26, 122, 17061 }, // ô
-    { 18, 26, 20, 1, 25, 117, 17183 }, // õ
-    { 18, 26, 20, 1, 25, 117, 17300 }, // ö
-    { 17, 16, 19, 1, 20, 68, 17417 }, // ÷
-    { 18, 21, 20, 1, 19, 95, 17485 }, // ø
-    { 16, 27, 21, 2, 26, 108, 17580 }, // ù
-    { 16, 27, 21, 2, 26, 108, 17688 }, // ú
-    { 16, 27, 21, 2, 26, 108, 17796 }, // û
-    { 16, 26, 21, 2, 25, 104, 17904 }, // ü
-    { 17, 34, 17, 0, 26, 145, 18008 }, // ý
-    { 17, 34, 21, 2, 26, 145, 18153 }, // þ
-    { 17, 33, 17, 0, 25, 141, 18298 }, // ÿ
-    { 22, 29, 21, 0, 29, 160, 18439 }, // Ā
-    { 15, 24, 19, 1, 23, 90, 18599 }, // ā
-    { 22, 31, 21, 0, 31, 171, 18689 }, // Ă
-    { 15, 26, 19, 1, 25, 98, 18860 }, // ă
-    { 22, 32, 21, 0, 24, 176, 18958 }, // Ą
-    { 16, 27, 19, 1, 19, 108, 19134 }, // ą
-    { 19, 33, 21, 2, 32, 157, 19242 }, // Ć
-    { 14, 27, 16, 1, 26, 95, 19399 }, // ć
-    { 19, 33, 21, 2, 32, 157, 19494 }, // Ĉ
-    { 15, 27, 16, 1, 26, 102, 19651 }, // ĉ
-    { 19, 32, 21, 2, 31, 152, 19753 }, // Ċ
-    { 14, 26, 16, 1, 25, 91, 19905 }, // ċ
-    { 19, 33, 21, 2, 32, 157, 19996 }, // Č
-    { 15, 27, 16, 1, 26, 102, 20153 }, // č
-    { 20, 32, 24, 3, 32, 160, 20255 }, // Ď
-    { 22, 27, 21, 1, 26, 149, 20415 }, // ď
-    { 22, 24, 24, 1, 24, 132, 20564 }, // Đ
-    { 20, 27, 21, 1, 26, 135, 20696 }, // đ
-    { 14, 29, 19, 3, 29, 102, 20831 }, // Ē
-    { 17, 24, 19, 1, 23, 102, 20933 }, // ē
-    { 14, 31, 19, 3, 31, 109, 21035 }, // Ĕ
-    { 17, 26, 19, 1, 25, 111, 21144 }, // ĕ
-    { 14, 31, 19, 3, 31, 109, 21255 }, // Ė
-    { 17, 26, 19, 1, 25, 111, 21364 }, // ė
-    { 14, 32, 19, 3, 24, 112, 21475 }, // Ę
-    { 17, 27, 19, 1, 19, 115, 21587 }, // ę
-    { 14, 32, 19, 3, 32, 112, 21702 }, // Ě
-    { 17, 27, 19, 1, 26, 115, 21814 }, // ě
-    { 20, 33, 24, 2, 32, 165, 21929 }, // Ĝ
-    { 17, 34, 21, 1, 26, 145, 22094 }, // ĝ
-    { 20, 32, 24, 2, 31, 160, 22239 }, // Ğ
-    { 17, 33, 21, 1, 25, 141, 22399 }, // ğ
-    { 20, 32, 24, 2, 31, 160, 22540 }, // Ġ
-    { 17, 33, 21, 1, 25, 141, 22700 }, // ġ
-    { 20, 33, 24, 2, 25, 165, 22841 }, // Ģ
-    { 17, 34, 21, 1, 26, 145, 23006 }, // ģ
-    { 19, 32, 25, 3, 32, 152, 23151 }, // Ĥ
-    { 20, 33, 21, -2, 33, 165, 23303 }, // ĥ
-    { 25, 24, 25, 0, 24, 150, 23468 }, // Ħ
-    { 18, 26, 21, 0, 26, 117, 23618 }, // ħ
-    { 13, 31, 11, -1, 31, 101, 23735 }, // Ĩ
-    { 13, 25, 9, -2, 25, 82, 23836 }, // ĩ
-    { 11, 29, 11, 0, 29, 80, 23918 }, // Ī
-    { 11, 23, 9, -1, 23, 64, 23998 }, // ī
-    { 11, 31, 11, 0, 31, 86, 24062 }, // Ĭ
-    { 11, 25, 9, -1, 25, 69, 24148 }, // ĭ
-    { 9, 32, 11, 1, 24, 72, 24217 }, // Į
-    { 7, 33, 9, 0, 25, 58, 24289 }, // į
-    { 9, 31, 11, 1, 31, 70, 24347 }, // İ
-    { 4, 18, 9, 2, 18, 18, 24417 }, // ı
-    { 17, 31, 20, 1, 24, 132, 24435 }, // Ĳ
-    { 13, 33, 17, 2, 25, 108, 24567 }, // ĳ
-    { 14, 39, 9, -3, 32, 137, 24675 }, // Ĵ
-    { 12, 34, 9, -2, 26, 102, 24812 }, // ĵ
-    { 18, 32, 21, 3, 24, 144, 24914 }, // Ķ
-    { 16, 34, 18, 2, 26, 136, 25058 }, // ķ
-    { 16, 18, 18, 2, 18, 72, 25194 }, // ĸ
-    { 15, 32, 17, 2, 32, 120, 25266 }, // Ĺ
-    { 8, 33, 9, 2, 33, 66, 25386 }, // ĺ
-    { 14, 32, 17, 3, 24, 112, 25452 }, // Ļ
-    { 5, 34, 9, 2, 26, 43, 25564 }, // ļ
-    { 14, 24, 17, 3, 24, 84, 25607 }, // Ľ
-    { 10, 26, 9, 2, 26, 65, 25691 }, // ľ
-    { 14, 24, 17, 3, 24, 84, 25756 }, // Ŀ
-    { 9, 26, 9, 2, 26, 59, 25840 }, // ŀ
-    { 17, 24, 17, 0, 24, 102, 25899 }, // Ł
-    { 10, 26, 9, -1, 26, 65, 26001 }, // ł
-    { 20, 32, 25, 3, 32, 160, 26066 }, // Ń
-    { 16, 26, 21, 2, 26, 104, 26226 }, // ń
-    { 20, 32, 25, 3, 24, 160, 26330 }, // Ņ
-    { 16, 27, 21, 2, 19, 108, 26490 }, // ņ
-    { 20, 32, 25, 3, 32, 160, 26598 }, // Ň
-    { 16, 26, 21, 2, 26, 104, 26758 }, // ň
-    { 21, 24, 23, 0, 24, 126, 26862 }, // ŉ
-    { 20, 31, 25, 3, 24, 155, 26988 }, // Ŋ
-    { 16, 27, 21, 2, 19, 108, 27143 }, // ŋ
-    { 22, 30, 26, 2, 29, 165, 27251 }, // Ō
-    { 18, 24, 20, 1, 23, 108, 27416 }, // ō
-    { 22, 32, 26, 2, 31, 176, 27524 }, // Ŏ
-    { 18, 26, 20, 1, 25, 117, 27700 }, // ŏ
-    { 22, 33, 26, 2, 32, 182, 27817 }, // Ő
-    { 18, 27, 20, 1, 26, 122, 27999 }, // ő
-    { 27, 26, 31, 2, 25, 176, 28121 }, // Œ
-    { 29, 20, 32, 1, 19, 145, 28297 }, // œ
-    { 18, 32, 21, 3, 32, 144, 28442 }, // Ŕ
-    { 12, 26, 14, 2, 26, 78, 28586 }, // ŕ
-    { 18, 32, 21, 3, 24, 144, 28664 }, // Ŗ
-    { 12, 27, 14, 2, 19, 81, 28808 }, // ŗ
-    { 18, 32, 21, 3, 32, 144, 28889 }, // Ř
-    { 12, 26, 14, 2, 26, 78, 29033 }, // ř
-    { 16, 33, 18, 1, 32, 132, 29111 }, // Ś
-    { 14, 27, 16, 1, 26, 95, 29243 }, // ś
-    { 16, 33, 18, 1, 32, 132, 29338 }, // Ŝ
-    { 14, 27, 16, 1, 26, 95, 29470 }, // ŝ
-    { 16, 33, 18, 1, 25, 132, 29565 }, // Ş
-    { 14, 27, 16, 1, 19, 95, 29697 }, // ş
-    { 16, 33, 18, 1, 32, 132, 29792 }, // Š
-    { 14, 27, 16, 1, 26, 95, 29924 }, // š
-    { 19, 32, 19, 0, 24, 152, 30019 }, // Ţ
-    { 12, 30, 12, 0, 22, 90, 30171 }, // ţ
-    { 19, 32, 19, 0, 32, 152, 30261 }, // Ť
-    { 16, 27, 12, 0, 26, 108, 30413 }, // ť
-    { 19, 24, 19, 0, 24, 114, 30521 }, // Ŧ
-    { 12, 23, 12, 0, 22, 69, 30635 }, // ŧ
-    { 19, 32, 24, 3, 31, 152, 30704 }, // Ũ
-    { 16, 26, 21, 2, 25, 104, 30856 }, // ũ
-    { 19, 30, 24, 3, 29, 143, 30960 }, // Ū
-    { 16, 24, 21, 2, 23, 96, 31103 }, // ū
-    { 19, 32, 24, 3, 31, 152, 31199 }, // Ŭ
-    { 16, 26, 21, 2, 25, 104, 31351 }, // ŭ
-    { 19, 35, 24, 3, 34, 167, 31455 }, // Ů
-    { 16, 29, 21, 2, 28, 116, 31622 }, // ů
-    { 19, 33, 24, 3, 32, 157, 31738 }, // Ű
-    { 16, 27, 21, 2, 26, 108, 31895 }, // ű
-    { 19, 32, 24, 3, 24, 152, 32003 }, // Ų
-    { 17, 26, 21, 2, 18, 111, 32155 }, // ų
-    { 31, 32, 31, 0, 32, 248, 32266 }, // Ŵ
-    { 26, 26, 26, 0, 26, 169, 32514 }, // ŵ
-    { 19, 32, 19, 0, 32, 152, 32683 }, // Ŷ
-    { 17, 34, 17, 0, 26, 145, 32835 }, // ŷ
-    { 19, 31, 19, 0, 31, 148, 32980 }, // Ÿ
-    { 17, 32, 19, 1, 32, 136, 33128 }, // Ź
-    { 14, 26, 16, 1, 26, 91, 33264 }, // ź
-    { 17, 31, 19, 1, 31, 132, 33355 }, // Ż
-    { 14, 25, 16, 1, 25, 88, 33487 }, // ż
-    { 17, 32, 19, 1, 32, 136, 33575 }, // Ž
-    { 14, 26, 16, 1, 26, 91, 33711 }, // ž
-    { 11, 26, 11, 2, 26, 72, 33802 }, // ſ
-    { 8, 6, 0, -17, 26, 12, 33874 }, // ̀
-    { 7, 6, 0, -11, 26, 11, 33886 }, // ́
-    { 12, 6, 0, -6, 26, 18, 33897 }, // ̂
-    { 13, 5, 0, -17, 25, 17, 33915 }, // ̃
-    { 10, 3, 0, -5, 23, 8, 33932 }, // ̄
-    { 14, 4, 0, -7, 29, 14, 33940 }, // ̅
-    { 12, 5, 0, -6, 25, 15, 33954 }, // ̆
-    { 4, 5, 0, -2, 25, 5, 33969 }, // ̇
-    { 10, 4, 0, -5, 25, 10, 33974 }, // ̈
-    { 7, 9, 0, -13, 28, 16, 33984 }, // ̉
-    { 8, 8, 0, -4, 28, 16, 34000 }, // ̊
-    { 13, 6, 0, -5, 26, 20, 34016 }, // ̋
-    { 12, 6, 0, -6, 26, 18, 34036 }, // ̌
-    { 4, 7, 0, -2, 26, 7, 34054 }, // ̍
-    { 8, 7, 0, -4, 26, 14, 34061 }, // ̎
-    { 13, 6, 0, -18, 26, 20, 34075 }, // ̏
-    { 12, 9, 0, -6, 29, 27, 34095 }, // ̐
-    { 12, 5, 0, -6, 25, 15, 34122 }, // ̑
-    { 6, 9, 0, -3, 24, 14, 34137 }, // ̒
-    { 6, 9, 0, -3, 24, 14, 34151 }, // ̓
-    { 6, 9, 0, -3, 24, 14, 34165 }, // ̔
-    { 6, 9, 0, -3, 24, 14, 34179 }, // ̕
-    { 8, 6, 0, -4, -1, 12, 34193 }, // ̖
-    { 8, 6, 0, -4, -1, 12, 34205 }, // ̗
-    { 6, 8, 0, -3, 0, 12, 34217 }, // ̘
-    { 6, 8, 0, -3, 0, 12, 34229 }, // ̙
-    { 10, 9, 10, 0, 26, 23, 34241 }, // ̚
-    { 8, 8, 0, -4, 26, 16, 34264 }, // ̛
-    { 4, 8, 0, -2, 0, 8, 34280 }, // ̜
-    { 8, 6, 0, -4, -1, 12, 34288 }, // ̝
-    { 8, 6, 0, -4, -1, 12, 34300 }, // ̞
-    { 8, 8, 0, -4, 0, 16, 34312 }, // ̟
-    { 8, 3, 0, -4, -2, 6, 34328 }, // ̠
-    { 6, 10, 0, -6, 2, 15, 34334 }, // ̡
-    { 6, 10, 0, 0, 2, 15, 34349 }, // ̢
-    { 4, 4, 0, -12, -2, 4, 34364 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 34368 }, // ̤
-    { 8, 8, 0, -4, 0, 16, 34378 }, // ̥
-    { 6, 6, 0, -3, -2, 9, 34394 }, // ̦
-    { 8, 8, 0, -4, 0, 16, 34403 }, // ̧
-    { 6, 9, 0, -3, 1, 14, 34419 }, // ̨
-    { 4, 7, 0, -2, -1, 7, 34433 }, // ̩
-    { 12, 7, 0, -6, -1, 21, 34440 }, // ̪
-    { 14, 4, 0, -7, -2, 14, 34461 }, // ̫
-    { 12, 6, 0, -6, -1, 18, 34475 }, // ̬
-    { 12, 6, 0, -6, -1, 18, 34493 }, // ̭
-    { 12, 5, 0, -6, -1, 15, 34511 }, // ̮
-    { 12, 5, 0, -6, -1, 15, 34526 }, // ̯
-    { 14, 5, 0, -7, -1, 18, 34541 }, // ̰
-    { 10, 3, 0, -5, -2, 8, 34559 }, // ̱
-    { 16, 3, 0, -8, -3, 12, 34567 }, // ̲
-    { 14, 8, 0, -7, 0, 28, 34579 }, // ̳
-    { 13, 5, 0, -6, 12, 17, 34607 }, // ̴
-    { 14, 4, 0, -7, 12, 14, 34624 }, // ̵
-    { 24, 3, 0, -12, 11, 18, 34638 }, // ̶
-    { 10, 8, 0, -5, 14, 20, 34656 }, // ̷
-    { 14, 28, 0, -7, 26, 98, 34676 }, // ̸
-    { 4, 8, 0, -2, 0, 8, 34774 }, // ̹
-    { 12, 7, 0, -6, -1, 21, 34782 }, // ̺
-    { 14, 8, 0, -7, 0, 28, 34803 }, // ̻
-    { 14, 4, 0, -7, -2, 14, 34831 }, // ̼
-    { 8, 7, 0, -4, 26, 14, 34845 }, // ̽
-    { 6, 10, 0, -3, 29, 15, 34859 }, // ̾
-    { 14, 8, 0, -7, 33, 28, 34874 }, // ̿
-    { 8, 6, 0, -6, 26, 12, 34902 }, // ̀
-    { 8, 6, 0, -2, 26, 12, 34914 }, // ́
-    { 14, 5, 0, -7, 25, 18, 34926 }, // ͂
-    { 6, 6, 0, -3, 26, 9, 34944 }, // ̓
-    { 13, 6, 0, -6, 26, 20, 34953 }, // ̈́
-    { 6, 6, 0, -2, -2, 9, 34973 }, // ͅ
-    { 16, 7, 0, -8, 26, 28, 34982 }, // ͆
-    { 14, 8, 0, -7, 0, 28, 35010 }, // ͇
-    { 8, 7, 0, -4, -1, 14, 35038 }, // ͈
-    { 8, 6, 0, -4, -2, 12, 35052 }, // ͉
-    { 14, 8, 0, -7, 26, 28, 35064 }, // ͊
-    { 14, 12, 0, -7, 31, 42, 35092 }, // ͋
-    { 12, 9, 0, -6, 29, 27, 35134 }, // ͌
-    { 12, 7, 0, -6, -1, 21, 35161 }, // ͍
-    { 8, 8, 0, -4, 0, 16, 35182 }, // ͎
-    { 24, 24, 0, -12, 24, 144, 35198 }, // ͏
-    { 6, 8, 0, -3, 27, 12, 35342 }, // ͐
-    { 5, 8, 0, -2, 28, 10, 35354 }, // ͑
-    { 12, 8, 0, -6, 28, 24, 35364 }, // ͒
-    { 8, 7, 0, -4, -1, 14, 35388 }, // ͓
-    { 6, 7, 0, -3, -1, 11, 35402 }, // ͔
-    { 6, 7, 0, -3, -1, 11, 35413 }, // ͕
-    { 14, 7, 0, -7, -1, 25, 35424 }, // ͖
-    { 5, 8, 0, -2, 28, 10, 35449 }, // ͗
-    { 4, 5, 0, 4, 25, 5, 35459 }, // ͘
-    { 8, 7, 0, -4, -1, 14, 35464 }, // ͙
-    { 14, 8, 0, -7, 0, 28, 35478 }, // ͚
-    { 8, 8, 0, -4, 27, 16, 35506 }, // ͛
-    { 26, 7, 0, -13, -1, 46, 35522 }, // ͜
-    { 26, 7, 0, -13, 26, 46, 35568 }, // ͝
-    { 20, 3, 0, -10, 23, 15, 35614 }, // ͞
-    { 20, 3, 0, -10, -2, 15, 35629 }, // ͟
-    { 26, 5, 0, -13, 25, 33, 35644 }, // ͠
-    { 26, 8, 0, -13, 29, 52, 35677 }, // ͡
-    { 27, 7, 0, -13, -1, 48, 35729 }, // ͢
-    { 8, 8, 0, -4, 28, 16, 35777 }, // ͣ
-    { 8, 8, 0, -4, 28, 16, 35793 }, // ͤ
-    { 3, 11, 0, -1, 31, 9, 35809 }, // ͥ
-    { 9, 8, 0, -4, 28, 18, 35818 }, // ͦ
-    { 8, 8, 0, -4, 28, 16, 35836 }, // ͧ
-    { 7, 8, 0, -3, 28, 14, 35852 }, // ͨ
-    { 8, 11, 0, -4, 31, 22, 35866 }, // ͩ
-    { 8, 11, 0, -4, 31, 22, 35888 }, // ͪ
-    { 13, 8, 0, -6, 28, 26, 35910 }, // ͫ
-    { 6, 8, 0, -2, 28, 12, 35936 }, // ͬ
-    { 6, 10, 0, -3, 30, 15, 35948 }, // ͭ
-    { 9, 8, 0, -4, 28, 18, 35963 }, // ͮ
-    { 9, 8, 0, -4, 28, 18, 35981 }, // ͯ
-    { 14, 32, 19, 3, 32, 112, 35999 }, // Ѐ
-    { 14, 31, 19, 3, 31, 109, 36111 }, // Ё
-    { 23, 25, 24, 0, 24, 144, 36220 }, // Ђ
-    { 14, 32, 17, 3, 32, 112, 36364 }, // Ѓ
-    { 18, 26, 21, 2, 25, 117, 36476 }, // Є
-    { 16, 26, 18, 1, 25, 104, 36593 }, // Ѕ
-    { 4, 24, 9, 3, 24, 24, 36697 }, // І
-    { 9, 31, 9, 0, 31, 70, 36721 }, // Ї
-    { 10, 31, 9, -3, 24, 78, 36791 }, // Ј
-    { 32, 25, 34, 0, 24, 200, 36869 }, // Љ
-    { 30, 24, 34, 3, 24, 180, 37069 }, // Њ
-    { 22, 24, 24, 0, 24, 132, 37249 }, // Ћ
-    { 18, 32, 21, 3, 32, 144, 37381 }, // Ќ
-    { 19, 32, 25, 3, 32, 152, 37525 }, // Ѝ
-    { 21, 32, 21, 0, 31, 168, 37677 }, // Ў
-    { 19, 30, 24, 3, 24, 143, 37845 }, // Џ
-    { 22, 24, 21, 0, 24, 132, 37988 }, // А
-    { 16, 24, 20, 3, 24, 96, 38120 }, // Б
-    { 17, 24, 22, 3, 24, 102, 38216 }, // В
-    { 14, 24, 17, 3, 24, 84, 38318 }, // Г
-    { 24, 30, 24, 0, 24, 180, 38402 }, // Д
-    { 14, 24, 19, 3, 24, 84, 38582 }, // Е
-    { 31, 24, 30, 0, 24, 186, 38666 }, // Ж
-    { 17, 26, 19, 1, 25, 111, 38852 }, // З
-    { 19, 24, 25, 3, 24, 114, 38963 }, // И
-    { 19, 31, 25, 3, 31, 148, 39077 }, // Й
-    { 18, 24, 21, 3, 24, 108, 39225 }, // К
-    { 21, 25, 23, 0, 24, 132, 39333 }, // Л
-    { 24, 24, 30, 3, 24, 144, 39465 }, // М
-    { 19, 24, 25, 3, 24, 114, 39609 }, // Н
-    { 22, 26, 25, 2, 25, 143, 39723 }, // О
-    { 19, 24, 24, 3, 24, 114, 39866 }, // П
-    { 16, 24, 20, 3, 24, 96, 39980 }, // Р
-    { 18, 26, 21, 2, 25, 117, 40076 }, // С
-    { 19, 24, 19, 0, 24, 114, 40193 }, // Т
-    { 21, 25, 21, 0, 24, 132, 40307 }, // У
-    { 25, 26, 27, 1, 25, 163, 40439 }, // Ф
-    { 20, 24, 20, 0, 24, 120, 40602 }, // Х
-    { 22, 30, 25, 3, 24, 165, 40722 }, // Ц
-    { 18, 24, 22, 2, 24, 108, 40887 }, // Ч
-    { 29, 24, 35, 3, 24, 174, 40995 }, // Ш
-    { 31, 30, 34, 3, 24, 233, 41169 }, // Щ
-    { 22, 24, 23, 0, 24, 132, 41402 }, // Ъ
-    { 23, 24, 28, 3, 24, 138, 41534 }, // Ы
-    { 16, 24, 20, 3, 24, 96, 41672 }, // Ь
-    { 19, 26, 22, 1, 25, 124, 41768 }, // Э
-    { 29, 26, 33, 3, 25, 189, 41892 }, // Ю
-    { 18, 24, 21, 1, 24, 108, 42081 }, // Я
-    { 15, 20, 19, 1, 19, 75, 42189 }, // а
-    { 18, 27, 20, 1, 26, 122, 42264 }, // б
-    { 16, 18, 19, 2, 18, 72, 42386 }, // в
-    { 12, 18, 15, 2, 18, 54, 42458 }, // г
-    { 20, 23, 20, 0, 18, 115, 42512 }, // д
-    { 16, 20, 18, 1, 19, 80, 42627 }, // е
-    { 26, 18, 25, 0, 18, 117, 42707 }, // ж
-    { 14, 20, 16, 1, 19, 70, 42824 }, // з
-    { 16, 18, 21, 2, 18, 72, 42894 }, // и
-    { 16, 25, 21, 2, 25, 100, 42966 }, // й
-    { 16, 18, 18, 2, 18, 72, 43066 }, // к
-    { 17, 19, 20, 0, 18, 81, 43138 }, // л
-    { 21, 18, 26, 2, 18, 95, 43219 }, // м
-    { 16, 18, 20, 2, 18, 72, 43314 }, // н
-    { 18, 20, 20, 1, 19, 90, 43386 }, // о
-    { 16, 18, 20, 2, 18, 72, 43476 }, // п
-    { 17, 27, 20, 2, 19, 115, 43548 }, // р
-    { 15, 20, 16, 1, 19, 75, 43663 }, // с
-    { 15, 18, 16, 0, 18, 68, 43738 }, // т
-    { 17, 26, 17, 0, 18, 111, 43806 }, // у
-    { 22, 34, 25, 1, 26, 187, 43917 }, // ф
-    { 17, 18, 17, 0, 18, 77, 44104 }, // х
-    { 19, 23, 20, 2, 18, 110, 44181 }, // ц
-    { 15, 18, 20, 2, 18, 68, 44291 }, // ч
-    { 26, 18, 30, 2, 18, 117, 44359 }, // ш
-    { 28, 23, 30, 2, 18, 161, 44476 }, // щ
-    { 20, 18, 21, 0, 18, 90, 44637 }, // ъ
-    { 21, 18, 25, 2, 18, 95, 44727 }, // ы
-    { 15, 18, 18, 2, 18, 68, 44822 }, // ь
-    { 14, 20, 16, 1, 19, 70, 44890 }, // э
-    { 24, 20, 27, 2, 19, 120, 44960 }, // ю
-    { 16, 18, 19, 1, 18, 72, 45080 }, // я
-    { 16, 27, 18, 1, 26, 108, 45152 }, // ѐ
-    { 16, 26, 18, 1, 25, 104, 45260 }, // ё
-    { 18, 34, 21, 0, 26, 153, 45364 }, // ђ
-    { 12, 26, 15, 2, 26, 78, 45517 }, // ѓ
-    { 15, 20, 16, 1, 19, 75, 45595 }, // є
-    { 14, 20, 16, 1, 19, 70, 45670 }, // ѕ
-    { 5, 25, 9, 2, 25, 32, 45740 }, // і
-    { 8, 25, 9, 0, 25, 50, 45772 }, // ї
-    { 9, 33, 9, -2, 25, 75, 45822 }, // ј
-    { 28, 19, 29, 0, 18, 133, 45897 }, // љ
-    { 27, 18, 30, 2, 18, 122, 46030 }, // њ
-    { 18, 26, 21, 0, 26, 117, 46152 }, // ћ
-    { 16, 26, 18, 2, 26, 104, 46269 }, // ќ
-    { 16, 26, 21, 2, 26, 104, 46373 }, // ѝ
-    { 17, 33, 17, 0, 25, 141, 46477 }, // ў
-    { 16, 23, 20, 2, 18, 92, 46618 }, // џ
-    { 30, 25, 31, 0, 24, 188, 46710 }, // Ѡ
-    { 26, 18, 26, 0, 18, 117, 46898 }, // ѡ
-    { 21, 24, 23, 0, 24, 126, 47015 }, // Ѣ
-    { 20, 22, 21, 0, 22, 110, 47141 }, // ѣ
-    { 27, 26, 31, 3, 25, 176, 47251 }, // Ѥ
-    { 22, 20, 25, 2, 19, 110, 47427 }, // ѥ
-    { 23, 24, 23, 0, 24, 138, 47537 }, // Ѧ
-    { 19, 18, 19, 0, 18, 86, 47675 }, // ѧ
-    { 28, 24, 31, 3, 24, 168, 47761 }, // Ѩ
-    { 24, 18, 26, 2, 18, 108, 47929 }, // ѩ
-    { 24, 24, 24, 0, 24, 144, 48037 }, // Ѫ
-    { 22, 18, 21, 0, 18, 99, 48181 }, // ѫ
-    { 30, 24, 33, 3, 24, 180, 48280 }, // Ѭ
-    { 27, 18, 28, 2, 18, 122, 48460 }, // ѭ
-    { 17, 37, 20, 1, 29, 158, 48582 }, // Ѯ
-    { 15, 30, 16, 0, 23, 113, 48740 }, // ѯ
-    { 22, 24, 27, 3, 24, 132, 48853 }, // Ѱ
-    { 21, 34, 25, 2, 26, 179, 48985 }, // ѱ
-    { 22, 26, 26, 2, 25, 143, 49164 }, // Ѳ
-    { 18, 20, 20, 1, 19, 90, 49307 }, // ѳ
-    { 23, 24, 21, 0, 24, 138, 49397 }, // Ѵ
-    { 18, 19, 17, 0, 19, 86, 49535 }, // ѵ
-    { 23, 32, 21, 0, 32, 184, 49621 }, // Ѷ
-    { 18, 26, 17, 0, 26, 117, 49805 }, // ѷ
-    { 39, 33, 41, 2, 25, 322, 49922 }, // Ѹ
-    { 36, 27, 37, 1, 19, 243, 50244 }, // ѹ
-    { 24, 28, 27, 2, 26, 168, 50487 }, // Ѻ
-    { 20, 22, 22, 1, 20, 110, 50655 }, // ѻ
-    { 31, 36, 34, 2, 35, 279, 50765 }, // Ѽ
-    { 28, 31, 30, 1, 30, 217, 51044 }, // ѽ
-    { 30, 31, 31, 0, 30, 233, 51261 }, // Ѿ
-    { 26, 24, 26, 0, 24, 156, 51494 }, // ѿ
-    { 19, 33, 21, 2, 25, 157, 51650 }, // Ҁ
-    { 15, 27, 16, 1, 19, 102, 51807 }, // ҁ
-    { 18, 22, 20, 1, 21, 99, 51909 }, // ҂
-    { 13, 5, 0, -16, 24, 17, 52008 }, // ҃
-    { 13, 5, 0, -16, 25, 17, 52025 }, // ҄
-    { 5, 6, 0, -12, 26, 8, 52042 }, // ҅
-    { 5, 6, 0, -12, 26, 8, 52050 }, // ҆
-    { 13, 5, 0, -7, 30, 17, 52058 }, // ҇
-    { 38, 36, 0, -19, 27, 342, 52075 }, // ҈
-    { 38, 38, 0, -19, 28, 361, 52417 }, // ҉
-    { 23, 38, 26, 3, 31, 219, 52778 }, // Ҋ
-    { 20, 33, 22, 2, 26, 165, 52997 }, // ҋ
-    { 19, 24, 21, 0, 24, 114, 53162 }, // Ҍ
-    { 19, 26, 20, 0, 26, 124, 53276 }, // ҍ
-    { 16, 24, 20, 3, 24, 96, 53400 }, // Ҏ
-    { 17, 27, 21, 2, 19, 115, 53496 }, // ҏ
-    { 14, 29, 18, 3, 29, 102, 53611 }, // Ґ
-    { 12, 24, 15, 2, 24, 72, 53713 }, // ґ
-    { 17, 24, 18, 0, 24, 102, 53785 }, // Ғ
-    { 14, 18, 14, 0, 18, 63, 53887 }, // ғ
-    { 18, 33, 22, 3, 24, 149, 53950 }, // Ҕ
-    { 15, 27, 18, 2, 18, 102, 54099 }, // ҕ
-    { 30, 31, 30, 0, 24, 233, 54201 }, // Җ
-    { 26, 25, 27, 0, 18, 163, 54434 }, // җ
-    { 17, 33, 19, 1, 25, 141, 54597 }, // Ҙ
-    { 14, 27, 16, 1, 19, 95, 54738 }, // ҙ
-    { 19, 31, 22, 3, 24, 148, 54833 }, // Қ
-    { 17, 25, 19, 2, 18, 107, 54981 }, // қ
-    { 18, 24, 21, 3, 24, 108, 55088 }, // Ҝ
-    { 16, 18, 18, 2, 18, 72, 55196 }, // ҝ
-    { 21, 24, 21, 0, 24, 126, 55268 }, // Ҟ
-    { 18, 26, 18, 0, 26, 117, 55394 }, // ҟ
-    { 24, 24, 23, 0, 24, 144, 55511 }, // Ҡ
-    { 21, 18, 21, 0, 18, 95, 55655 }, // ҡ
-    { 22, 31, 25, 3, 24, 171, 55750 }, // Ң
-    { 20, 25, 22, 2, 18, 125, 55921 }, // ң
-    { 24, 24, 27, 3, 24, 144, 56046 }, // Ҥ
-    { 23, 18, 25, 2, 18, 104, 56190 }, // ҥ
-    { 31, 33, 35, 3, 24, 256, 56294 }, // Ҧ
-    { 26, 27, 29, 2, 18, 176, 56550 }, // ҧ
-    { 23, 27, 26, 2, 25, 156, 56726 }, // Ҩ
-    { 20, 20, 21, 1, 19, 100, 56882 }, // ҩ
-    { 19, 33, 21, 2, 25, 157, 56982 }, // Ҫ
-    { 14, 27, 16, 1, 19, 95, 57139 }, // ҫ
-    { 19, 31, 19, 0, 24, 148, 57234 }, // Ҭ
-    { 16, 25, 16, 0, 18, 100, 57382 }, // ҭ
-    { 19, 24, 19, 0, 24, 114, 57482 }, // Ү
-    { 17, 26, 17, 0, 18, 111, 57596 }, // ү
-    { 19, 24, 19, 0, 24, 114, 57707 }, // Ұ
-    { 17, 26, 17, 0, 18, 111, 57821 }, // ұ
-    { 21, 31, 21, 0, 24, 163, 57932 }, // Ҳ
-    { 18, 25, 18, 0, 18, 113, 58095 }, // ҳ
-    { 28, 31, 29, 0, 24, 217, 58208 }, // Ҵ
-    { 24, 25, 24, 0, 18, 150, 58425 }, // ҵ
-    { 21, 31, 23, 2, 24, 163, 58575 }, // Ҷ
-    { 19, 25, 21, 2, 18, 119, 58738 }, // ҷ
-    { 19, 24, 23, 2, 24, 114, 58857 }, // Ҹ
-    { 16, 18, 20, 2, 18, 72, 58971 }, // ҹ
-    { 18, 24, 23, 3, 24, 108, 59043 }, // Һ
-    { 16, 26, 21, 2, 26, 104, 59151 }, // һ
-    { 27, 26, 28, 0, 25, 176, 59255 }, // Ҽ
-    { 21, 20, 22, 0, 19, 105, 59431 }, // ҽ
-    { 27, 32, 28, 0, 25, 216, 59536 }, // Ҿ
-    { 21, 26, 22, 0, 19, 137, 59752 }, // ҿ
-    { 9, 24, 11, 1, 24, 54, 59889 }, // Ӏ
-    { 31, 31, 30, 0, 31, 241, 59943 }, // Ӂ
-    { 26, 25, 25, 0, 25, 163, 60184 }, // ӂ
-    { 19, 33, 23, 3, 24, 157, 60347 }, // Ӄ
-    { 16, 27, 19, 2, 18, 108, 60504 }, // ӄ
-    { 24, 31, 24, 0, 24, 186, 60612 }, // Ӆ
-    { 20, 25, 20, 0, 18, 125, 60798 }, // ӆ
-    { 19, 33, 24, 3, 24, 157, 60923 }, // Ӈ
-    { 17, 27, 21, 2, 18, 115, 61080 }, // ӈ
-    { 22, 31, 25, 3, 24, 171, 61195 }, // Ӊ
-    { 20, 25, 22, 2, 18, 125, 61366 }, // ӊ
-    { 19, 31, 23, 2, 24, 148, 61491 }, // Ӌ
-    { 16, 25, 20, 2, 18, 100, 61639 }, // ӌ
-    { 28, 31, 31, 3, 24, 217, 61739 }, // Ӎ
-    { 24, 25, 25, 2, 18, 150, 61956 }, // ӎ
-    { 9, 24, 11, 1, 24, 54, 62106 }, // ӏ
-    { 22, 31, 21, 0, 31, 171, 62160 }, // Ӑ
-    { 15, 26, 19, 1, 25, 98, 62331 }, // ӑ
-    { 22, 31, 21, 0, 31, 171, 62429 }, // Ӓ
-    { 15, 26, 19, 1, 25, 98, 62600 }, // ӓ
-    { 29, 24, 29, -1, 24, 174, 62698 }, // Ӕ
-    { 27, 20, 29, 1, 19, 135, 62872 }, // ӕ
-    { 14, 31, 19, 3, 31, 109, 63007 }, // Ӗ
-    { 17, 26, 19, 1, 25, 111, 63116 }, // ӗ
-    { 22, 26, 25, 1, 25, 143, 63227 }, // Ә
-    { 16, 20, 19, 1, 19, 80, 63370 }, // ә
-    { 22, 32, 25, 1, 31, 176, 63450 }, // Ӛ
-    { 16, 26, 19, 1, 25, 104, 63626 }, // ӛ
-    { 31, 31, 30, 0, 31, 241, 63730 }, // Ӝ
-    { 26, 25, 25, 0, 25, 163, 63971 }, // ӝ
-    { 17, 32, 19, 1, 31, 136, 64134 }, // Ӟ
-    { 14, 26, 16, 1, 25, 91, 64270 }, // ӟ
-    { 17, 25, 19, 1, 24, 107, 64361 }, // Ӡ
-    { 16, 26, 17, 0, 18, 104, 64468 }, // ӡ
-    { 19, 29, 25, 3, 29, 138, 64572 }, // Ӣ
-    { 16, 23, 21, 2, 23, 92, 64710 }, // ӣ
-    { 19, 31, 25, 3, 31, 148, 64802 }, // Ӥ
-    { 16, 25, 21, 2, 25, 100, 64950 }, // ӥ
-    { 22, 32, 26, 2, 31, 176, 65050 }, // Ӧ
-    { 18, 26, 20, 1, 25, 117, 65226 }, // ӧ
-    { 22, 26, 26, 2, 25, 143, 65343 }, // Ө
-    { 18, 20, 20, 1, 19, 90, 65486 }, // ө
-    { 22, 32, 26, 2, 31, 176, 65576 }, // Ӫ
-    { 18, 26, 20, 1, 25, 117, 65752 }, // ӫ
-    { 19, 32, 22, 1, 31, 152, 65869 }, // Ӭ
-    { 14, 26, 16, 1, 25, 91, 66021 }, // ӭ
-    { 21, 30, 21, 0, 29, 158, 66112 }, // Ӯ
-    { 17, 31, 17, 0, 23, 132, 66270 }, // ӯ
-    { 21, 32, 21, 0, 31, 168, 66402 }, // Ӱ
-    { 17, 33, 17, 0, 25, 141, 66570 }, // ӱ
-    { 21, 33, 21, 0, 32, 174, 66711 }, // Ӳ
-    { 17, 34, 17, 0, 26, 145, 66885 }, // ӳ
-    { 18, 31, 22, 2, 31, 140, 67030 }, // Ӵ
-    { 15, 25, 20, 2, 25, 94, 67170 }, // ӵ
-    { 14, 31, 18, 3, 24, 109, 67264 }, // Ӷ
-    { 12, 25, 14, 2, 18, 75, 67373 }, // ӷ
-    { 23, 31, 28, 3, 31, 179, 67448 }, // Ӹ
-    { 21, 25, 25, 2, 25, 132, 67627 }, // ӹ
-    { 17, 31, 18, 0, 24, 132, 67759 }, // Ӻ
-    { 14, 25, 14, 0, 18, 88, 67891 }, // ӻ
-    { 21, 31, 21, 0, 24, 163, 67979 }, // Ӽ
-    { 18, 25, 18, 0, 18, 113, 68142 }, // ӽ
-    { 20, 24, 20, 0, 24, 120, 68255 }, // Ӿ
-    { 18, 18, 18, 0, 18, 81, 68375 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 68456 }, //  
-    { 0, 0, 33, 0, 0, 0, 68456 }, //  
-    { 0, 0, 17, 0, 0, 0, 68456 }, //  
-    { 0, 0, 33, 0, 0, 0, 68456 }, //  
-    { 0, 0, 11, 0, 0, 0, 68456 }, //  
-    { 0, 0, 8, 0, 0, 0, 68456 }, //  
-    { 0, 0, 6, 0, 0, 0, 68456 }, //  
-    { 0, 0, 19, 0, 0, 0, 68456 }, //  
-    { 0, 0, 9, 0, 0, 0, 68456 }, //  
-    { 0, 0, 6, 0, 0, 0, 68456 }, //  
-    { 0, 0, 3, 0, 0, 0, 68456 }, //  
-    { 0, 0, 0, 0, 0, 0, 68456 }, // ​
-    { 0, 0, 0, 0, 0, 0, 68456 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 68456 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 68456 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 68519 }, // ‏
-    { 9, 4, 11, 1, 11, 9, 68582 }, // ‐
-    { 9, 4, 11, 1, 11, 9, 68591 }, // ‑
-    { 17, 4, 19, 1, 14, 17, 68600 }, // ‒
-    { 15, 4, 17, 1, 11, 15, 68617 }, // –
-    { 31, 4, 33, 1, 11, 31, 68632 }, // —
-    { 31, 4, 33, 1, 11, 31, 68663 }, // ―
-    { 11, 35, 18, 4, 26, 97, 68694 }, // ‖
-    { 15, 8, 14, -1, 0, 30, 68791 }, // ‗
-    { 6, 9, 6, 0, 24, 14, 68821 }, // ‘
-    { 6, 9, 6, 0, 24, 14, 68835 }, // ’
-    { 6, 9, 8, 1, 4, 14, 68849 }, // ‚
-    { 6, 9, 6, 0, 24, 14, 68863 }, // ‛
-    { 12, 9, 12, 0, 24, 27, 68877 }, // “
-    { 12, 9, 12, 0, 24, 27, 68904 }, // ”
-    { 12, 9, 14, 1, 4, 27, 68931 }, // „
-    { 12, 9, 12, 0, 24, 27, 68958 }, // ‟
-    { 13, 26, 17, 2, 26, 85, 68985 }, // †
-    { 14, 26, 17, 2, 26, 91, 69070 }, // ‡
-    { 8, 9, 13, 2, 17, 18, 69161 }, // •
-    { 9, 11, 12, 2, 18, 25, 69179 }, // ‣
-    { 5, 6, 17, 6, 5, 8, 69204 }, // ․
-    { 14, 6, 18, 2, 5, 21, 69212 }, // ‥
-    { 22, 6, 26, 2, 5, 33, 69233 }, // …
-    { 5, 6, 9, 2, 11, 8, 69266 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 69274 }, //  
-    { 0, 0, 20, 0, 0, 0, 69274 }, //  
-    { 9, 26, 0, -1, 21, 59, 69274 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 69333 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 69392 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 69448 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 69504 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 69560 }, //  
-    { 37, 26, 39, 1, 25, 241, 69560 }, // ‰
-    { 49, 26, 51, 1, 25, 319, 69801 }, // ‱
-    { 8, 9, 8, 1, 24, 18, 70120 }, // ′
-    { 14, 9, 14, 1, 24, 32, 70138 }, // ″
-    { 20, 9, 19, 1, 24, 45, 70170 }, // ‴
-    { 8, 9, 8, -1, 24, 18, 70215 }, // ‵
-    { 13, 9, 15, -1, 24, 30, 70233 }, // ‶
-    { 19, 9, 20, -1, 24, 43, 70263 }, // ‷
-    { 13, 11, 13, 0, 3, 36, 70306 }, // ‸
-    { 9, 15, 10, 1, 16, 34, 70342 }, // ‹
-    { 8, 15, 10, 1, 16, 30, 70376 }, // ›
-    { 26, 26, 28, 1, 25, 169, 70406 }, // ※
-    { 13, 25, 17, 2, 24, 82, 70575 }, // ‼
-    { 14, 26, 15, 0, 25, 91, 70657 }, // ‽
-    { 18, 3, 17, -1, 28, 14, 70748 }, // ‾
-    { 20, 7, 20, 0, -1, 35, 70762 }, // ‿
-    { 20, 8, 20, 0, 27, 40, 70797 }, // ⁀
-    { 12, 22, 12, 0, 14, 66, 70837 }, // ⁁
-    { 37, 31, 37, 0, 26, 287, 70903 }, // ⁂
-    { 9, 4, 11, 1, 11, 9, 71190 }, // ⁃
-    { 18, 24, 4, -7, 24, 108, 71199 }, // ⁄
-    { 8, 30, 11, 2, 24, 60, 71307 }, // ⁅
-    { 9, 30, 11, 0, 24, 68, 71367 }, // ⁆
-    { 28, 26, 29, 0, 25, 182, 71435 }, // ⁇
-    { 21, 26, 23, 0, 25, 137, 71617 }, // ⁈
-    { 20, 26, 23, 2, 25, 130, 71754 }, // ⁉
-    { 17, 18, 19, 1, 18, 77, 71884 }, // ⁊
-    { 17, 31, 22, 3, 26, 132, 71961 }, // ⁋
-    { 18, 17, 21, 1, 18, 77, 72093 }, // ⁌
-    { 18, 17, 21, 2, 18, 77, 72170 }, // ⁍
-    { 16, 16, 18, 1, 9, 64, 72247 }, // ⁎
-    { 6, 24, 8, 1, 19, 36, 72311 }, // ⁏
-    { 20, 35, 20, 0, 27, 175, 72347 }, // ⁐
-    { 16, 33, 18, 1, 26, 132, 72522 }, // ⁑
-    { 13, 26, 12, 0, 25, 85, 72654 }, // ⁒
-    { 29, 6, 33, 2, 13, 44, 72739 }, // ⁓
-    { 20, 8, 20, 0, 0, 40, 72783 }, // ⁔
-    { 18, 18, 19, 0, 17, 81, 72823 }, // ⁕
-    { 15, 26, 17, 1, 25, 98, 72904 }, // ⁖
-    { 25, 9, 25, 1, 24, 57, 73002 }, // ⁗
-    { 25, 26, 27, 1, 25, 163, 73059 }, // ⁘
-    { 25, 26, 28, 1, 25, 163, 73222 }, // ⁙
-    { 5, 26, 7, 1, 25, 33, 73385 }, // ⁚
-    { 20, 26, 22, 1, 25, 130, 73418 }, // ⁛
-    { 25, 26, 27, 1, 25, 163, 73548 }, // ⁜
-    { 5, 25, 9, 2, 24, 32, 73711 }, // ⁝
-    { 5, 26, 9, 2, 25, 33, 73743 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 73776 }, //  
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 73776 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 73832 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 73888 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 73944 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 74002 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 74058 }, // ⁯
-    { 11, 16, 12, 0, 29, 44, 74114 }, // ⁰
-    { 3, 16, 6, 1, 25, 12, 74158 }, // ⁱ
-    { 12, 16, 12, 0, 29, 48, 74170 }, // ⁴
-    { 10, 16, 12, 1, 29, 40, 74218 }, // ⁵
-    { 12, 16, 12, 0, 29, 48, 74258 }, // ⁶
-    { 11, 16, 12, 0, 29, 44, 74306 }, // ⁷
-    { 11, 16, 12, 0, 29, 44, 74350 }, // ⁸
-    { 11, 16, 12, 0, 29, 44, 74394 }, // ⁹
-    { 10, 10, 11, 1, 25, 25, 74438 }, // ⁺
-    { 10, 3, 11, 1, 21, 8, 74463 }, // ⁻
-    { 10, 6, 11, 1, 23, 15, 74471 }, // ⁼
-    { 6, 19, 8, 2, 31, 29, 74486 }, // ⁽
-    { 6, 19, 8, 0, 31, 29, 74515 }, // ⁾
-    { 11, 12, 13, 1, 21, 33, 74544 }, // ⁿ
-    { 11, 16, 12, 0, 11, 44, 74577 }, // ₀
-    { 7, 16, 12, 1, 11, 28, 74621 }, // ₁
-    { 11, 16, 12, 0, 11, 44, 74649 }, // ₂
-    { 11, 16, 12, 0, 11, 44, 74693 }, // ₃
-    { 12, 16, 12, 0, 11, 48, 74737 }, // ₄
-    { 10, 16, 12, 1, 11, 40, 74785 }, // ₅
-    { 12, 16, 12, 0, 11, 48, 74825 }, // ₆
-    { 11, 16, 12, 0, 11, 44, 74873 }, // ₇
-    { 11, 16, 12, 0, 11, 44, 74917 }, // ₈
-    { 11, 16, 12, 0, 11, 44, 74961 }, // ₉
-    { 10, 10, 11, 1, 7, 25, 75005 }, // ₊
-    { 10, 3, 11, 1, 3, 8, 75030 }, // ₋
-    { 10, 6, 11, 1, 5, 15, 75038 }, // ₌
-    { 6, 19, 8, 2, 13, 29, 75053 }, // ₍
-    { 6, 19, 8, 0, 13, 29, 75082 }, // ₎
-    { 10, 12, 12, 1, 8, 30, 75111 }, // ₐ
-    { 11, 12, 12, 1, 8, 33, 75141 }, // ₑ
-    { 11, 12, 13, 1, 8, 33, 75174 }, // ₒ
-    { 12, 12, 11, 0, 8, 36, 75207 }, // ₓ
-    { 11, 12, 12, 1, 8, 33, 75243 }, // ₔ
-    { 11, 16, 13, 1, 12, 44, 75276 }, // ₕ
-    { 11, 16, 12, 1, 12, 44, 75320 }, // ₖ
-    { 3, 16, 6, 1, 12, 12, 75364 }, // ₗ
-    { 18, 12, 20, 1, 8, 54, 75376 }, // ₘ
-    { 11, 12, 13, 1, 8, 33, 75430 }, // ₙ
-    { 12, 16, 13, 1, 8, 48, 75463 }, // ₚ
-    { 9, 12, 10, 1, 8, 27, 75511 }, // ₛ
-    { 8, 14, 8, 0, 10, 28, 75538 }, // ₜ
-    { 17, 25, 19, 1, 25, 107, 75566 }, // ₠
-    { 18, 28, 19, 1, 26, 126, 75673 }, // ₡
-    { 17, 26, 19, 1, 25, 111, 75799 }, // ₢
-    { 17, 24, 19, 1, 24, 102, 75910 }, // ₣
-    { 17, 25, 19, 1, 25, 107, 76012 }, // ₤
-    { 27, 27, 31, 2, 23, 183, 76119 }, // ₥
-    { 19, 24, 19, 0, 24, 114, 76302 }, // ₦
-    { 23, 25, 26, 2, 24, 144, 76416 }, // ₧
-    { 25, 25, 28, 2, 24, 157, 76560 }, // ₨
-    { 22, 24, 22, 0, 24, 132, 76717 }, // ₩
-    { 22, 24, 27, 2, 24, 132, 76849 }, // ₪
-    { 20, 32, 21, 1, 26, 160, 76981 }, // ₫
-    { 19, 26, 19, 0, 25, 124, 77141 }, // €
-    { 20, 24, 19, 0, 24, 120, 77265 }, // ₭
-    { 19, 24, 19, 0, 24, 114, 77385 }, // ₮
-    { 32, 33, 32, 0, 25, 264, 77499 }, // ₯
-    { 18, 33, 19, 0, 25, 149, 77763 }, // ₰
-    { 19, 24, 19, 0, 24, 114, 77912 }, // ₱
-    { 20, 29, 24, 2, 26, 145, 78026 }, // ₲
-    { 21, 24, 20, 0, 24, 126, 78171 }, // ₳
-    { 18, 26, 18, 0, 25, 117, 78297 }, // ₴
-    { 19, 29, 21, 2, 26, 138, 78414 }, // ₵
-    { 20, 23, 21, 0, 22, 115, 78552 }, // ₶
-    { 23, 28, 24, 0, 25, 161, 78667 }, // ₷
-    { 18, 24, 18, 0, 24, 108, 78828 }, // ₸
-    { 15, 24, 19, 2, 24, 90, 78936 }, // ₹
-    { 19, 25, 19, 0, 24, 119, 79026 }, // ₺
-    { 26, 26, 26, 0, 25, 169, 79145 }, // ₻
-    { 24, 24, 27, 1, 24, 144, 79314 }, // ₼
-    { 19, 24, 19, 0, 24, 114, 79458 }, // ₽
-    { 22, 26, 26, 2, 26, 143, 79572 }, // ₾
-    { 15, 32, 19, 3, 28, 120, 79715 }, // ₿
-    { 14, 24, 16, 1, 19, 84, 79835 }, // ⃀
-    { 17, 3, 19, 1, 13, 13, 79919 }, // −
-    { 31, 32, 33, 1, 26, 248, 79932 }, // �
+    { 5, 20, 9, 2, 19, 25, 2048 }, // :
+    { 6, 24, 9, 1, 19, 36, 2073 }, // ;
+    { 17, 18, 19, 1, 21, 77, 2109 }, // <
+    { 17, 10, 19, 1, 17, 43, 2186 }, // =
+    { 17, 18, 19, 1, 21, 77, 2229 }, // >
+    { 14, 26, 14, 0, 25, 91, 2306 }, // ?
+    { 28, 27, 30, 1, 24, 189, 2397 }, // @
+    { 22, 24, 21, 0, 24, 132, 2586 }, // A
+    { 17, 24, 22, 3, 24, 102, 2718 }, // B
+    { 19, 26, 21, 2, 25, 124, 2820 }, // C
+    { 20, 24, 24, 3, 24, 120, 2944 }, // D
+    { 14, 24, 19, 3, 24, 84, 3064 }, // E
+    { 14, 24, 17, 3, 24, 84, 3148 }, // F
+    { 20, 26, 24, 2, 25, 130, 3232 }, // G
+    { 19, 24, 25, 3, 24, 114, 3362 }, // H
+    { 9, 24, 11, 1, 24, 54, 3476 }, // I
+    { 10, 31, 9, -3, 24, 78, 3530 }, // J
+    { 18, 24, 21, 3, 24, 108, 3608 }, // K
+    { 14, 24, 17, 3, 24, 84, 3716 }, // L
+    { 24, 24, 30, 3, 24, 144, 3800 }, // M
+    { 20, 24, 25, 3, 24, 120, 3944 }, // N
+    { 22, 26, 26, 2, 25, 143, 4096 }, // O
+    { 16, 24, 20, 3, 24, 96, 4239 }, // P
+    { 22, 31, 26, 2, 25, 171, 4335 }, // Q
+    { 18, 24, 21, 3, 24, 108, 4506 }, // R
+    { 16, 26, 18, 1, 25, 104, 4614 }, // S
+    { 19, 24, 19, 0, 24, 114, 4718 }, // T
+    { 19, 25, 24, 3, 24, 119, 4832 }, // U
+    { 20, 24, 20, 0, 24, 120, 4951 }, // V
+    { 31, 24, 31, 0, 24, 186, 5071 }, // W
+    { 20, 24, 20, 0, 24, 120, 5257 }, // X
+    { 19, 24, 19, 0, 24, 114, 5377 }, // Y
+    { 17, 24, 19, 1, 24, 102, 5491 }, // Z
+    { 9, 30, 11, 2, 24, 68, 5593 }, // [
+    { 13, 24, 12, 0, 24, 78, 5661 }, // <backslash>
+    { 9, 30, 11, 0, 24, 68, 5739 }, // ]
+    { 17, 16, 19, 1, 24, 68, 5807 }, // ^
+    { 16, 3, 15, -1, -3, 12, 5875 }, // _
+    { 8, 6, 9, 1, 26, 12, 5887 }, // `
+    { 15, 20, 19, 1, 19, 75, 5899 }, // a
+    { 17, 27, 21, 2, 26, 115, 5974 }, // b
+    { 14, 20, 16, 1, 19, 70, 6144 }, // c
+    { 17, 27, 21, 1, 26, 115, 6214 }, // d
+    { 17, 20, 19, 1, 19, 85, 6329 }, // e
+    { 13, 26, 11, 0, 26, 85, 6414 }, // f
+    { 17, 27, 21, 1, 19, 115, 6499 }, // g
+    { 16, 26, 21, 2, 26, 104, 6614 }, // h
+    { 5, 25, 9, 2, 25, 32, 6718 }, // i
+    { 9, 33, 9, -2, 25, 75, 6750 }, // j
+    { 16, 26, 18, 2, 26, 104, 6825 }, // k
+    { 4, 26, 9, 2, 26, 26, 6929 }, // l
+    { 27, 19, 31, 2, 19, 129, 6955 }, // m
+    { 16, 19, 21, 2, 19, 76, 7084 }, // n
+    { 18, 20, 20, 1, 19, 90, 7160 }, // o
+    { 17, 27, 21, 2, 19, 115, 7250 }, // p
+    { 17, 27, 21, 1, 19, 115, 7365 }, // q
+    { 12, 19, 14, 2, 19, 57, 7480 }, // r
+    { 14, 20, 16, 1, 19, 70, 7537 }, // s
+    { 12, 23, 12, 0, 22, 69, 7607 }, // t
+    { 16, 19, 21, 2, 18, 76, 7676 }, // u
+    { 17, 18, 17, 0, 18, 77, 7752 }, // v
+    { 26, 18, 26, 0, 18, 117, 7829 }, // w
+    { 18, 18, 18, 0, 18, 81, 7946 }, // x
+    { 17, 26, 17, 0, 18, 111, 8027 }, // y
+    { 14, 18, 16, 1, 18, 63, 8192 }, // z
+    { 12, 30, 13, 0, 24, 90, 8255 }, // {
+    { 4, 35, 18, 7, 26, 35, 8345 }, // |
+    { 11, 30, 13, 1, 24, 83, 8380 }, // }
+    { 17, 5, 19, 1, 14, 22, 8463 }, // ~
+    { 0, 0, 9, 0, 0, 0, 8485 }, //  
+    { 5, 26, 9, 2, 19, 33, 8485 }, // ¡
+    { 14, 26, 19, 3, 25, 91, 8518 }, // ¢
+    { 17, 25, 19, 1, 25, 107, 8609 }, // £
+    { 17, 16, 19, 1, 20, 68, 8716 }, // ¤
+    { 19, 24, 19, 0, 24, 114, 8784 }, // ¥
+    { 4, 35, 18, 7, 26, 35, 8898 }, // ¦
+    { 14, 27, 17, 1, 26, 95, 8933 }, // §
+    { 11, 4, 19, 4, 25, 11, 9028 }, // ¨
+    { 26, 26, 28, 1, 25, 169, 9039 }, // ©
+    { 10, 13, 12, 1, 25, 33, 9208 }, // ª
+    { 15, 15, 17, 1, 16, 57, 9241 }, // «
+    { 17, 9, 19, 1, 13, 39, 9298 }, // ¬
+    { 9, 4, 11, 1, 11, 9, 9337 }, // ­
+    { 26, 26, 28, 1, 25, 169, 9346 }, // ®
+    { 18, 3, 17, -1, 28, 14, 9515 }, // ¯
+    { 12, 12, 14, 1, 25, 36, 9529 }, // °
+    { 17, 20, 19, 1, 20, 85, 9565 }, // ±
+    { 11, 16, 12, 0, 29, 44, 9650 }, // ²
+    { 11, 16, 12, 0, 29, 44, 9694 }, // ³
+    { 8, 6, 9, 1, 26, 12, 9738 }, // ´
+    { 16, 26, 21, 2, 18, 104, 9750 }, // µ
+    { 18, 31, 22, 1, 26, 140, 9854 }, // ¶
+    { 5, 6, 9, 2, 15, 8, 9994 }, // ·
+    { 8, 8, 8, 0, 0, 16, 10002 }, // ¸
+    { 7, 16, 12, 1, 29, 28, 10018 }, // ¹
+    { 11, 13, 13, 1, 25, 36, 10046 }, // º
+    { 15, 15, 17, 1, 16, 57, 10082 }, // »
+    { 24, 24, 25, 1, 24, 144, 10240 }, // ¼
+    { 25, 24, 26, 0, 24, 150, 10384 }, // ½
+    { 26, 25, 26, 0, 25, 163, 10534 }, // ¾
+    { 14, 26, 14, 0, 19, 91, 10697 }, // ¿
+    { 22, 32, 21, 0, 32, 176, 10788 }, // À
+    { 22, 32, 21, 0, 32, 176, 10964 }, // Á
+    { 22, 32, 21, 0, 32, 176, 11140 }, // Â
+    { 22, 31, 21, 0, 31, 171, 11316 }, // Ã
+    { 22, 31, 21, 0, 31, 171, 11487 }, // Ä
+    { 22, 30, 21, 0, 30, 165, 11658 }, // Å
+    { 29, 24, 29, -1, 24, 174, 11823 }, // Æ
+    { 19, 33, 21, 2, 25, 157, 11997 }, // Ç
+    { 14, 32, 19, 3, 32, 112, 12154 }, // È
+    { 14, 32, 19, 3, 32, 112, 12288 }, // É
+    { 14, 32, 19, 3, 32, 112, 12400 }, // Ê
+    { 14, 31, 19, 3, 31, 109, 12512 }, // Ë
+    { 9, 32, 11, 1, 32, 72, 12621 }, // Ì
+    { 10, 32, 11, 1, 32, 80, 12693 }, // Í
+    { 12, 32, 11, 0, 32, 96, 12773 }, // Î
+    { 10, 31, 11, 1, 31, 78, 12869 }, // Ï
+    { 22, 24, 24, 1, 24, 132, 12947 }, // Ð
+    { 20, 31, 25, 3, 31, 155, 13079 }, // Ñ
+    { 22, 33, 26, 2, 32, 182, 13234 }, // Ò
+    { 22, 33, 26, 2, 32, 182, 13416 }, // Ó
+    { 22, 33, 26, 2, 32, 182, 13598 }, // Ô
+    { 22, 32, 26, 2, 31, 176, 13780 }, // Õ
+    { 22, 32, 26, 2, 31, 176, 13956 }, // Ö
+    { 15, 16, 19, 2, 20, 60, 14132 }, // ×
+    { 22, 27, 26, 2, 25, 149, 14336 }, // Ø
+    { 19, 33, 24, 3, 32, 157, 14485 }, // Ù
+    { 19, 33, 24, 3, 32, 157, 14642 }, // Ú
+    { 19, 33, 24, 3, 32, 157, 14799 }, // Û
+    { 19, 32, 24, 3, 31, 152, 14956 }, // Ü
+    { 19, 32, 19, 0, 32, 152, 15108 }, // Ý
+    { 16, 24, 20, 3, 24, 96, 15260 }, // Þ
+    { 18, 27, 21, 2, 26, 122, 15356 }, // ß
+    { 15, 27, 19, 1, 26, 102, 15478 }, // à
+    { 15, 27, 19, 1, 26, 102, 15580 }, // á
+    { 15, 27, 19, 1, 26, 102, 15682 }, // â
+    { 15, 26, 19, 1, 25, 98, 15784 }, // ã
+    { 15, 26, 19, 1, 25, 98, 15882 }, // ä
+    { 15, 29, 19, 1, 28, 109, 15980 }, // å
+    { 27, 20, 29, 1, 19, 135, 16089 }, // æ
+    { 14, 27, 16, 1, 19, 95, 16224 }, // ç
+    { 17, 27, 19, 1, 26, 115, 16384 }, // è
+    { 17, 27, 19, 1, 26, 115, 16499 }, // é
+    { 17, 27, 19, 1, 26, 115, 16614 }, // ê
+    { 17, 26, 19, 1, 25, 111, 16729 }, // ë
+    { 8, 26, 9, -1, 26, 52, 16840 }, // ì
+    { 8, 26, 9, 2, 26, 52, 16892 }, // í
+    { 12, 26, 9, -2, 26, 78, 16944 }, // î
+    { 10, 25, 9, -1, 25, 63, 17022 }, // ï
+    { 18, 27, 20, 1, 26, 122, 17085 }, // ð
+    { 16, 25, 21, 2, 25, 100, 17207 }, // ñ
+    { 18, 27, 20, 1, 26, 122, 17307 }, // ò
+    { 18, 27, 20, 1, 26, 122, 17429 }, // ó
+    { 18, 27, 20, 1, 26, 122, 17551 }, // ô
+    { 18, 26, 20, 1, 25, 117, 17673 }, // õ
+    { 18, 26, 20, 1, 25, 117, 17790 }, // ö
+    { 17, 16, 19, 1, 20, 68, 17907 }, // ÷
+    { 18, 21, 20, 1, 19, 95, 17975 }, // ø
+    { 16, 27, 21, 2, 26, 108, 18070 }, // ù
+    { 16, 27, 21, 2, 26, 108, 18178 }, // ú
+    { 16, 27, 21, 2, 26, 108, 18286 }, // û
+    { 16, 26, 21, 2, 25, 104, 18432 }, // ü
+    { 17, 34, 17, 0, 26, 145, 18536 }, // ý
+    { 17, 34, 21, 2, 26, 145, 18681 }, // þ
+    { 17, 33, 17, 0, 25, 141, 18826 }, // ÿ
+    { 22, 29, 21, 0, 29, 160, 18967 }, // Ā
+    { 15, 24, 19, 1, 23, 90, 19127 }, // ā
+    { 22, 31, 21, 0, 31, 171, 19217 }, // Ă
+    { 15, 26, 19, 1, 25, 98, 19388 }, // ă
+    { 22, 32, 21, 0, 24, 176, 19486 }, // Ą
+    { 16, 27, 19, 1, 19, 108, 19662 }, // ą
+    { 19, 33, 21, 2, 32, 157, 19770 }, // Ć
+    { 14, 27, 16, 1, 26, 95, 19927 }, // ć
+    { 19, 33, 21, 2, 32, 157, 20022 }, // Ĉ
+    { 15, 27, 16, 1, 26, 102, 20179 }, // ĉ
+    { 19, 32, 21, 2, 31, 152, 20281 }, // Ċ
+    { 14, 26, 16, 1, 25, 91, 20480 }, // ċ
+    { 19, 33, 21, 2, 32, 157, 20571 }, // Č
+    { 15, 27, 16, 1, 26, 102, 20728 }, // č
+    { 20, 32, 24, 3, 32, 160, 20830 }, // Ď
+    { 22, 27, 21, 1, 26, 149, 20990 }, // ď
+    { 22, 24, 24, 1, 24, 132, 21139 }, // Đ
+    { 20, 27, 21, 1, 26, 135, 21271 }, // đ
+    { 14, 29, 19, 3, 29, 102, 21406 }, // Ē
+    { 17, 24, 19, 1, 23, 102, 21508 }, // ē
+    { 14, 31, 19, 3, 31, 109, 21610 }, // Ĕ
+    { 17, 26, 19, 1, 25, 111, 21719 }, // ĕ
+    { 14, 31, 19, 3, 31, 109, 21830 }, // Ė
+    { 17, 26, 19, 1, 25, 111, 21939 }, // ė
+    { 14, 32, 19, 3, 24, 112, 22050 }, // Ę
+    { 17, 27, 19, 1, 19, 115, 22162 }, // ę
+    { 14, 32, 19, 3, 32, 112, 22277 }, // Ě
+    { 17, 27, 19, 1, 26, 115, 22389 }, // ě
+    { 20, 33, 24, 2, 32, 165, 22528 }, // Ĝ
+    { 17, 34, 21, 1, 26, 145, 22693 }, // ĝ
+    { 20, 32, 24, 2, 31, 160, 22838 }, // Ğ
+    { 17, 33, 21, 1, 25, 141, 22998 }, // ğ
+    { 20, 32, 24, 2, 31, 160, 23139 }, // Ġ
+    { 17, 33, 21, 1, 25, 141, 23299 }, // ġ
+    { 20, 33, 24, 2, 25, 165, 23440 }, // Ģ
+    { 17, 34, 21, 1, 26, 145, 23605 }, // ģ
+    { 19, 32, 25, 3, 32, 152, 23750 }, // Ĥ
+    { 20, 33, 21, -2, 33, 165, 23902 }, // ĥ
+    { 25, 24, 25, 0, 24, 150, 24067 }, // Ħ
+    { 18, 26, 21, 0, 26, 117, 24217 }, // ħ
+    { 13, 31, 11, -1, 31, 101, 24334 }, // Ĩ
+    { 13, 25, 9, -2, 25, 82, 24435 }, // ĩ
+    { 11, 29, 11, 0, 29, 80, 24576 }, // Ī
+    { 11, 23, 9, -1, 23, 64, 24656 }, // ī
+    { 11, 31, 11, 0, 31, 86, 24720 }, // Ĭ
+    { 11, 25, 9, -1, 25, 69, 24806 }, // ĭ
+    { 9, 32, 11, 1, 24, 72, 24875 }, // Į
+    { 7, 33, 9, 0, 25, 58, 24947 }, // į
+    { 9, 31, 11, 1, 31, 70, 25005 }, // İ
+    { 4, 18, 9, 2, 18, 18, 25075 }, // ı
+    { 17, 31, 20, 1, 24, 132, 25093 }, // Ĳ
+    { 13, 33, 17, 2, 25, 108, 25225 }, // ĳ
+    { 14, 39, 9, -3, 32, 137, 25333 }, // Ĵ
+    { 12, 34, 9, -2, 26, 102, 25470 }, // ĵ
+    { 18, 32, 21, 3, 24, 144, 25572 }, // Ķ
+    { 16, 34, 18, 2, 26, 136, 25716 }, // ķ
+    { 16, 18, 18, 2, 18, 72, 25852 }, // ĸ
+    { 15, 32, 17, 2, 32, 120, 25924 }, // Ĺ
+    { 8, 33, 9, 2, 33, 66, 26044 }, // ĺ
+    { 14, 32, 17, 3, 24, 112, 26110 }, // Ļ
+    { 5, 34, 9, 2, 26, 43, 26222 }, // ļ
+    { 14, 24, 17, 3, 24, 84, 26265 }, // Ľ
+    { 10, 26, 9, 2, 26, 65, 26349 }, // ľ
+    { 14, 24, 17, 3, 24, 84, 26414 }, // Ŀ
+    { 9, 26, 9, 2, 26, 59, 26498 }, // ŀ
+    { 17, 24, 17, 0, 24, 102, 26624 }, // Ł
+    { 10, 26, 9, -1, 26, 65, 26726 }, // ł
+    { 20, 32, 25, 3, 32, 160, 26791 }, // Ń
+    { 16, 26, 21, 2, 26, 104, 26951 }, // ń
+    { 20, 32, 25, 3, 24, 160, 27055 }, // Ņ
+    { 16, 27, 21, 2, 19, 108, 27215 }, // ņ
+    { 20, 32, 25, 3, 32, 160, 27323 }, // Ň
+    { 16, 26, 21, 2, 26, 104, 27483 }, // ň
+    { 21, 24, 23, 0, 24, 126, 27587 }, // ŉ
+    { 20, 31, 25, 3, 24, 155, 27713 }, // Ŋ
+    { 16, 27, 21, 2, 19, 108, 27868 }, // ŋ
+    { 22, 30, 26, 2, 29, 165, 27976 }, // Ō
+    { 18, 24, 20, 1, 23, 108, 28141 }, // ō
+    { 22, 32, 26, 2, 31, 176, 28249 }, // Ŏ
+    { 18, 26, 20, 1, 25, 117, 28425 }, // ŏ
+    { 22, 33, 26, 2, 32, 182, 28672 }, // Ő
+    { 18, 27, 20, 1, 26, 122, 28854 }, // ő
+    { 27, 26, 31, 2, 25, 176, 28976 }, // Œ
+    { 29, 20, 32, 1, 19, 145, 29152 }, // œ
+    { 18, 32, 21, 3, 32, 144, 29297 }, // Ŕ
+    { 12, 26, 14, 2, 26, 78, 29441 }, // ŕ
+    { 18, 32, 21, 3, 24, 144, 29519 }, // Ŗ
+    { 12, 27, 14, 2, 19, 81, 29663 }, // ŗ
+    { 18, 32, 21, 3, 32, 144, 29744 }, // Ř
+    { 12, 26, 14, 2, 26, 78, 29888 }, // ř
+    { 16, 33, 18, 1, 32, 132, 29966 }, // Ś
+    { 14, 27, 16, 1, 26, 95, 30098 }, // ś
+    { 16, 33, 18, 1, 32, 132, 30193 }, // Ŝ
+    { 14, 27, 16, 1, 26, 95, 30325 }, // ŝ
+    { 16, 33, 18, 1, 25, 132, 30420 }, // Ş
+    { 14, 27, 16, 1, 19, 95, 30552 }, // ş
+    { 16, 33, 18, 1, 32, 132, 30720 }, // Š
+    { 14, 27, 16, 1, 26, 95, 30852 }, // š
+    { 19, 32, 19, 0, 24, 152, 30947 }, // Ţ
+    { 12, 30, 12, 0, 22, 90, 31099 }, // ţ
+    { 19, 32, 19, 0, 32, 152, 31189 }, // Ť
+    { 16, 27, 12, 0, 26, 108, 31341 }, // ť
+    { 19, 24, 19, 0, 24, 114, 31449 }, // Ŧ
+    { 12, 23, 12, 0, 22, 69, 31563 }, // ŧ
+    { 19, 32, 24, 3, 31, 152, 31632 }, // Ũ
+    { 16, 26, 21, 2, 25, 104, 31784 }, // ũ
+    { 19, 30, 24, 3, 29, 143, 31888 }, // Ū
+    { 16, 24, 21, 2, 23, 96, 32031 }, // ū
+    { 19, 32, 24, 3, 31, 152, 32127 }, // Ŭ
+    { 16, 26, 21, 2, 25, 104, 32279 }, // ŭ
+    { 19, 35, 24, 3, 34, 167, 32383 }, // Ů
+    { 16, 29, 21, 2, 28, 116, 32550 }, // ů
+    { 19, 33, 24, 3, 32, 157, 32768 }, // Ű
+    { 16, 27, 21, 2, 26, 108, 32925 }, // ű
+    { 19, 32, 24, 3, 24, 152, 33033 }, // Ų
+    { 17, 26, 21, 2, 18, 111, 33185 }, // ų
+    { 31, 32, 31, 0, 32, 248, 33296 }, // Ŵ
+    { 26, 26, 26, 0, 26, 169, 33544 }, // ŵ
+    { 19, 32, 19, 0, 32, 152, 33713 }, // Ŷ
+    { 17, 34, 17, 0, 26, 145, 33865 }, // ŷ
+    { 19, 31, 19, 0, 31, 148, 34010 }, // Ÿ
+    { 17, 32, 19, 1, 32, 136, 34158 }, // Ź
+    { 14, 26, 16, 1, 26, 91, 34294 }, // ź
+    { 17, 31, 19, 1, 31, 132, 34385 }, // Ż
+    { 14, 25, 16, 1, 25, 88, 34517 }, // ż
+    { 17, 32, 19, 1, 32, 136, 34605 }, // Ž
+    { 14, 26, 16, 1, 26, 91, 34816 }, // ž
+    { 11, 26, 11, 2, 26, 72, 34907 }, // ſ
+    { 8, 6, 0, -17, 26, 12, 34979 }, // ̀
+    { 7, 6, 0, -11, 26, 11, 34991 }, // ́
+    { 12, 6, 0, -6, 26, 18, 35002 }, // ̂
+    { 13, 5, 0, -17, 25, 17, 35020 }, // ̃
+    { 10, 3, 0, -5, 23, 8, 35037 }, // ̄
+    { 14, 4, 0, -7, 29, 14, 35045 }, // ̅
+    { 12, 5, 0, -6, 25, 15, 35059 }, // ̆
+    { 4, 5, 0, -2, 25, 5, 35074 }, // ̇
+    { 10, 4, 0, -5, 25, 10, 35079 }, // ̈
+    { 7, 9, 0, -13, 28, 16, 35089 }, // ̉
+    { 8, 8, 0, -4, 28, 16, 35105 }, // ̊
+    { 13, 6, 0, -5, 26, 20, 35121 }, // ̋
+    { 12, 6, 0, -6, 26, 18, 35141 }, // ̌
+    { 4, 7, 0, -2, 26, 7, 35159 }, // ̍
+    { 8, 7, 0, -4, 26, 14, 35166 }, // ̎
+    { 13, 6, 0, -18, 26, 20, 35180 }, // ̏
+    { 12, 9, 0, -6, 29, 27, 35200 }, // ̐
+    { 12, 5, 0, -6, 25, 15, 35227 }, // ̑
+    { 6, 9, 0, -3, 24, 14, 35242 }, // ̒
+    { 6, 9, 0, -3, 24, 14, 35256 }, // ̓
+    { 6, 9, 0, -3, 24, 14, 35270 }, // ̔
+    { 6, 9, 0, -3, 24, 14, 35284 }, // ̕
+    { 8, 6, 0, -4, -1, 12, 35298 }, // ̖
+    { 8, 6, 0, -4, -1, 12, 35310 }, // ̗
+    { 6, 8, 0, -3, 0, 12, 35322 }, // ̘
+    { 6, 8, 0, -3, 0, 12, 35334 }, // ̙
+    { 10, 9, 10, 0, 26, 23, 35346 }, // ̚
+    { 8, 8, 0, -4, 26, 16, 35369 }, // ̛
+    { 4, 8, 0, -2, 0, 8, 35385 }, // ̜
+    { 8, 6, 0, -4, -1, 12, 35393 }, // ̝
+    { 8, 6, 0, -4, -1, 12, 35405 }, // ̞
+    { 8, 8, 0, -4, 0, 16, 35417 }, // ̟
+    { 8, 3, 0, -4, -2, 6, 35433 }, // ̠
+    { 6, 10, 0, -6, 2, 15, 35439 }, // ̡
+    { 6, 10, 0, 0, 2, 15, 35454 }, // ̢
+    { 4, 4, 0, -12, -2, 4, 35469 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 35473 }, // ̤
+    { 8, 8, 0, -4, 0, 16, 35483 }, // ̥
+    { 6, 6, 0, -3, -2, 9, 35499 }, // ̦
+    { 8, 8, 0, -4, 0, 16, 35508 }, // ̧
+    { 6, 9, 0, -3, 1, 14, 35524 }, // ̨
+    { 4, 7, 0, -2, -1, 7, 35538 }, // ̩
+    { 12, 7, 0, -6, -1, 21, 35545 }, // ̪
+    { 14, 4, 0, -7, -2, 14, 35566 }, // ̫
+    { 12, 6, 0, -6, -1, 18, 35580 }, // ̬
+    { 12, 6, 0, -6, -1, 18, 35598 }, // ̭
+    { 12, 5, 0, -6, -1, 15, 35616 }, // ̮
+    { 12, 5, 0, -6, -1, 15, 35631 }, // ̯
+    { 14, 5, 0, -7, -1, 18, 35646 }, // ̰
+    { 10, 3, 0, -5, -2, 8, 35664 }, // ̱
+    { 16, 3, 0, -8, -3, 12, 35672 }, // ̲
+    { 14, 8, 0, -7, 0, 28, 35684 }, // ̳
+    { 13, 5, 0, -6, 12, 17, 35712 }, // ̴
+    { 14, 4, 0, -7, 12, 14, 35729 }, // ̵
+    { 24, 3, 0, -12, 11, 18, 35743 }, // ̶
+    { 10, 8, 0, -5, 14, 20, 35761 }, // ̷
+    { 14, 28, 0, -7, 26, 98, 35781 }, // ̸
+    { 4, 8, 0, -2, 0, 8, 35879 }, // ̹
+    { 12, 7, 0, -6, -1, 21, 35887 }, // ̺
+    { 14, 8, 0, -7, 0, 28, 35908 }, // ̻
+    { 14, 4, 0, -7, -2, 14, 35936 }, // ̼
+    { 8, 7, 0, -4, 26, 14, 35950 }, // ̽
+    { 6, 10, 0, -3, 29, 15, 35964 }, // ̾
+    { 14, 8, 0, -7, 33, 28, 35979 }, // ̿
+    { 8, 6, 0, -6, 26, 12, 36007 }, // ̀
+    { 8, 6, 0, -2, 26, 12, 36019 }, // ́
+    { 14, 5, 0, -7, 25, 18, 36031 }, // ͂
+    { 6, 6, 0, -3, 26, 9, 36049 }, // ̓
+    { 13, 6, 0, -6, 26, 20, 36058 }, // ̈́
+    { 6, 6, 0, -2, -2, 9, 36078 }, // ͅ
+    { 16, 7, 0, -8, 26, 28, 36087 }, // ͆
+    { 14, 8, 0, -7, 0, 28, 36115 }, // ͇
+    { 8, 7, 0, -4, -1, 14, 36143 }, // ͈
+    { 8, 6, 0, -4, -2, 12, 36157 }, // ͉
+    { 14, 8, 0, -7, 26, 28, 36169 }, // ͊
+    { 14, 12, 0, -7, 31, 42, 36197 }, // ͋
+    { 12, 9, 0, -6, 29, 27, 36239 }, // ͌
+    { 12, 7, 0, -6, -1, 21, 36266 }, // ͍
+    { 8, 8, 0, -4, 0, 16, 36287 }, // ͎
+    { 24, 24, 0, -12, 24, 144, 36303 }, // ͏
+    { 6, 8, 0, -3, 27, 12, 36447 }, // ͐
+    { 5, 8, 0, -2, 28, 10, 36459 }, // ͑
+    { 12, 8, 0, -6, 28, 24, 36469 }, // ͒
+    { 8, 7, 0, -4, -1, 14, 36493 }, // ͓
+    { 6, 7, 0, -3, -1, 11, 36507 }, // ͔
+    { 6, 7, 0, -3, -1, 11, 36518 }, // ͕
+    { 14, 7, 0, -7, -1, 25, 36529 }, // ͖
+    { 5, 8, 0, -2, 28, 10, 36554 }, // ͗
+    { 4, 5, 0, 4, 25, 5, 36564 }, // ͘
+    { 8, 7, 0, -4, -1, 14, 36569 }, // ͙
+    { 14, 8, 0, -7, 0, 28, 36583 }, // ͚
+    { 8, 8, 0, -4, 27, 16, 36611 }, // ͛
+    { 26, 7, 0, -13, -1, 46, 36627 }, // ͜
+    { 26, 7, 0, -13, 26, 46, 36673 }, // ͝
+    { 20, 3, 0, -10, 23, 15, 36719 }, // ͞
+    { 20, 3, 0, -10, -2, 15, 36734 }, // ͟
+    { 26, 5, 0, -13, 25, 33, 36749 }, // ͠
+    { 26, 8, 0, -13, 29, 52, 36782 }, // ͡
+    { 27, 7, 0, -13, -1, 48, 36864 }, // ͢
+    { 8, 8, 0, -4, 28, 16, 36912 }, // ͣ
+    { 8, 8, 0, -4, 28, 16, 36928 }, // ͤ
+    { 3, 11, 0, -1, 31, 9, 36944 }, // ͥ
+    { 9, 8, 0, -4, 28, 18, 36953 }, // ͦ
+    { 8, 8, 0, -4, 28, 16, 36971 }, // ͧ
+    { 7, 8, 0, -3, 28, 14, 36987 }, // ͨ
+    { 8, 11, 0, -4, 31, 22, 37001 }, // ͩ
+    { 8, 11, 0, -4, 31, 22, 37023 }, // ͪ
+    { 13, 8, 0, -6, 28, 26, 37045 }, // ͫ
+    { 6, 8, 0, -2, 28, 12, 37071 }, // ͬ
+    { 6, 10, 0, -3, 30, 15, 37083 }, // ͭ
+    { 9, 8, 0, -4, 28, 18, 37098 }, // ͮ
+    { 9, 8, 0, -4, 28, 18, 37116 }, // ͯ
+    { 14, 32, 19, 3, 32, 112, 37134 }, // Ѐ
+    { 14, 31, 19, 3, 31, 109, 37246 }, // Ё
+    { 23, 25, 24, 0, 24, 144, 37355 }, // Ђ
+    { 14, 32, 17, 3, 32, 112, 37499 }, // Ѓ
+    { 18, 26, 21, 2, 25, 117, 37611 }, // Є
+    { 16, 26, 18, 1, 25, 104, 37728 }, // Ѕ
+    { 4, 24, 9, 3, 24, 24, 37832 }, // І
+    { 9, 31, 9, 0, 31, 70, 37856 }, // Ї
+    { 10, 31, 9, -3, 24, 78, 37926 }, // Ј
+    { 32, 25, 34, 0, 24, 200, 38004 }, // Љ
+    { 30, 24, 34, 3, 24, 180, 38204 }, // Њ
+    { 22, 24, 24, 0, 24, 132, 38384 }, // Ћ
+    { 18, 32, 21, 3, 32, 144, 38516 }, // Ќ
+    { 19, 32, 25, 3, 32, 152, 38660 }, // Ѝ
+    { 21, 32, 21, 0, 31, 168, 38912 }, // Ў
+    { 19, 30, 24, 3, 24, 143, 39080 }, // Џ
+    { 22, 24, 21, 0, 24, 132, 39223 }, // А
+    { 16, 24, 20, 3, 24, 96, 39355 }, // Б
+    { 17, 24, 22, 3, 24, 102, 39451 }, // В
+    { 14, 24, 17, 3, 24, 84, 39553 }, // Г
+    { 24, 30, 24, 0, 24, 180, 39637 }, // Д
+    { 14, 24, 19, 3, 24, 84, 39817 }, // Е
+    { 31, 24, 30, 0, 24, 186, 39901 }, // Ж
+    { 17, 26, 19, 1, 25, 111, 40087 }, // З
+    { 19, 24, 25, 3, 24, 114, 40198 }, // И
+    { 19, 31, 25, 3, 31, 148, 40312 }, // Й
+    { 18, 24, 21, 3, 24, 108, 40460 }, // К
+    { 21, 25, 23, 0, 24, 132, 40568 }, // Л
+    { 24, 24, 30, 3, 24, 144, 40700 }, // М
+    { 19, 24, 25, 3, 24, 114, 40844 }, // Н
+    { 22, 26, 25, 2, 25, 143, 40960 }, // О
+    { 19, 24, 24, 3, 24, 114, 41103 }, // П
+    { 16, 24, 20, 3, 24, 96, 41217 }, // Р
+    { 18, 26, 21, 2, 25, 117, 41313 }, // С
+    { 19, 24, 19, 0, 24, 114, 41430 }, // Т
+    { 21, 25, 21, 0, 24, 132, 41544 }, // У
+    { 25, 26, 27, 1, 25, 163, 41676 }, // Ф
+    { 20, 24, 20, 0, 24, 120, 41839 }, // Х
+    { 22, 30, 25, 3, 24, 165, 41959 }, // Ц
+    { 18, 24, 22, 2, 24, 108, 42124 }, // Ч
+    { 29, 24, 35, 3, 24, 174, 42232 }, // Ш
+    { 31, 30, 34, 3, 24, 233, 42406 }, // Щ
+    { 22, 24, 23, 0, 24, 132, 42639 }, // Ъ
+    { 23, 24, 28, 3, 24, 138, 42771 }, // Ы
+    { 16, 24, 20, 3, 24, 96, 42909 }, // Ь
+    { 19, 26, 22, 1, 25, 124, 43008 }, // Э
+    { 29, 26, 33, 3, 25, 189, 43132 }, // Ю
+    { 18, 24, 21, 1, 24, 108, 43321 }, // Я
+    { 15, 20, 19, 1, 19, 75, 43429 }, // а
+    { 18, 27, 20, 1, 26, 122, 43504 }, // б
+    { 16, 18, 19, 2, 18, 72, 43626 }, // в
+    { 12, 18, 15, 2, 18, 54, 43698 }, // г
+    { 20, 23, 20, 0, 18, 115, 43752 }, // д
+    { 16, 20, 18, 1, 19, 80, 43867 }, // е
+    { 26, 18, 25, 0, 18, 117, 43947 }, // ж
+    { 14, 20, 16, 1, 19, 70, 44064 }, // з
+    { 16, 18, 21, 2, 18, 72, 44134 }, // и
+    { 16, 25, 21, 2, 25, 100, 44206 }, // й
+    { 16, 18, 18, 2, 18, 72, 44306 }, // к
+    { 17, 19, 20, 0, 18, 81, 44378 }, // л
+    { 21, 18, 26, 2, 18, 95, 44459 }, // м
+    { 16, 18, 20, 2, 18, 72, 44554 }, // н
+    { 18, 20, 20, 1, 19, 90, 44626 }, // о
+    { 16, 18, 20, 2, 18, 72, 44716 }, // п
+    { 17, 27, 20, 2, 19, 115, 44788 }, // р
+    { 15, 20, 16, 1, 19, 75, 44903 }, // с
+    { 15, 18, 16, 0, 18, 68, 44978 }, // т
+    { 17, 26, 17, 0, 18, 111, 45056 }, // у
+    { 22, 34, 25, 1, 26, 187, 45167 }, // ф
+    { 17, 18, 17, 0, 18, 77, 45354 }, // х
+    { 19, 23, 20, 2, 18, 110, 45431 }, // ц
+    { 15, 18, 20, 2, 18, 68, 45541 }, // ч
+    { 26, 18, 30, 2, 18, 117, 45609 }, // ш
+    { 28, 23, 30, 2, 18, 161, 45726 }, // щ
+    { 20, 18, 21, 0, 18, 90, 45887 }, // ъ
+    { 21, 18, 25, 2, 18, 95, 45977 }, // ы
+    { 15, 18, 18, 2, 18, 68, 46072 }, // ь
+    { 14, 20, 16, 1, 19, 70, 46140 }, // э
+    { 24, 20, 27, 2, 19, 120, 46210 }, // ю
+    { 16, 18, 19, 1, 18, 72, 46330 }, // я
+    { 16, 27, 18, 1, 26, 108, 46402 }, // ѐ
+    { 16, 26, 18, 1, 25, 104, 46510 }, // ё
+    { 18, 34, 21, 0, 26, 153, 46614 }, // ђ
+    { 12, 26, 15, 2, 26, 78, 46767 }, // ѓ
+    { 15, 20, 16, 1, 19, 75, 46845 }, // є
+    { 14, 20, 16, 1, 19, 70, 46920 }, // ѕ
+    { 5, 25, 9, 2, 25, 32, 46990 }, // і
+    { 8, 25, 9, 0, 25, 50, 47022 }, // ї
+    { 9, 33, 9, -2, 25, 75, 47104 }, // ј
+    { 28, 19, 29, 0, 18, 133, 47179 }, // љ
+    { 27, 18, 30, 2, 18, 122, 47312 }, // њ
+    { 18, 26, 21, 0, 26, 117, 47434 }, // ћ
+    { 16, 26, 18, 2, 26, 104, 47551 }, // ќ
+    { 16, 26, 21, 2, 26, 104, 47655 }, // ѝ
+    { 17, 33, 17, 0, 25, 141, 47759 }, // ў
+    { 16, 23, 20, 2, 18, 92, 47900 }, // џ
+    { 30, 25, 31, 0, 24, 188, 47992 }, // Ѡ
+    { 26, 18, 26, 0, 18, 117, 48180 }, // ѡ
+    { 21, 24, 23, 0, 24, 126, 48297 }, // Ѣ
+    { 20, 22, 21, 0, 22, 110, 48423 }, // ѣ
+    { 27, 26, 31, 3, 25, 176, 48533 }, // Ѥ
+    { 22, 20, 25, 2, 19, 110, 48709 }, // ѥ
+    { 23, 24, 23, 0, 24, 138, 48819 }, // Ѧ
+    { 19, 18, 19, 0, 18, 86, 48957 }, // ѧ
+    { 28, 24, 31, 3, 24, 168, 49152 }, // Ѩ
+    { 24, 18, 26, 2, 18, 108, 49320 }, // ѩ
+    { 24, 24, 24, 0, 24, 144, 49428 }, // Ѫ
+    { 22, 18, 21, 0, 18, 99, 49572 }, // ѫ
+    { 30, 24, 33, 3, 24, 180, 49671 }, // Ѭ
+    { 27, 18, 28, 2, 18, 122, 49851 }, // ѭ
+    { 17, 37, 20, 1, 29, 158, 49973 }, // Ѯ
+    { 15, 30, 16, 0, 23, 113, 50131 }, // ѯ
+    { 22, 24, 27, 3, 24, 132, 50244 }, // Ѱ
+    { 21, 34, 25, 2, 26, 179, 50376 }, // ѱ
+    { 22, 26, 26, 2, 25, 143, 50555 }, // Ѳ
+    { 18, 20, 20, 1, 19, 90, 50698 }, // ѳ
+    { 23, 24, 21, 0, 24, 138, 50788 }, // Ѵ
+    { 18, 19, 17, 0, 19, 86, 50926 }, // ѵ
+    { 23, 32, 21, 0, 32, 184, 51012 }, // Ѷ
+    { 18, 26, 17, 0, 26, 117, 51200 }, // ѷ
+    { 39, 33, 41, 2, 25, 322, 51317 }, // Ѹ
+    { 36, 27, 37, 1, 19, 243, 51639 }, // ѹ
+    { 24, 28, 27, 2, 26, 168, 51882 }, // Ѻ
+    { 20, 22, 22, 1, 20, 110, 52050 }, // ѻ
+    { 31, 36, 34, 2, 35, 279, 52160 }, // Ѽ
+    { 28, 31, 30, 1, 30, 217, 52439 }, // ѽ
+    { 30, 31, 31, 0, 30, 233, 52656 }, // Ѿ
+    { 26, 24, 26, 0, 24, 156, 52889 }, // ѿ
+    { 19, 33, 21, 2, 25, 157, 53045 }, // Ҁ
+    { 15, 27, 16, 1, 19, 102, 53248 }, // ҁ
+    { 18, 22, 20, 1, 21, 99, 53350 }, // ҂
+    { 13, 5, 0, -16, 24, 17, 53449 }, // ҃
+    { 13, 5, 0, -16, 25, 17, 53466 }, // ҄
+    { 5, 6, 0, -12, 26, 8, 53483 }, // ҅
+    { 5, 6, 0, -12, 26, 8, 53491 }, // ҆
+    { 13, 5, 0, -7, 30, 17, 53499 }, // ҇
+    { 38, 36, 0, -19, 27, 342, 53516 }, // ҈
+    { 38, 38, 0, -19, 28, 361, 53858 }, // ҉
+    { 23, 38, 26, 3, 31, 219, 54219 }, // Ҋ
+    { 20, 33, 22, 2, 26, 165, 54438 }, // ҋ
+    { 19, 24, 21, 0, 24, 114, 54603 }, // Ҍ
+    { 19, 26, 20, 0, 26, 124, 54717 }, // ҍ
+    { 16, 24, 20, 3, 24, 96, 54841 }, // Ҏ
+    { 17, 27, 21, 2, 19, 115, 54937 }, // ҏ
+    { 14, 29, 18, 3, 29, 102, 55052 }, // Ґ
+    { 12, 24, 15, 2, 24, 72, 55154 }, // ґ
+    { 17, 24, 18, 0, 24, 102, 55296 }, // Ғ
+    { 14, 18, 14, 0, 18, 63, 55398 }, // ғ
+    { 18, 33, 22, 3, 24, 149, 55461 }, // Ҕ
+    { 15, 27, 18, 2, 18, 102, 55610 }, // ҕ
+    { 30, 31, 30, 0, 24, 233, 55712 }, // Җ
+    { 26, 25, 27, 0, 18, 163, 55945 }, // җ
+    { 17, 33, 19, 1, 25, 141, 56108 }, // Ҙ
+    { 14, 27, 16, 1, 19, 95, 56249 }, // ҙ
+    { 19, 31, 22, 3, 24, 148, 56344 }, // Қ
+    { 17, 25, 19, 2, 18, 107, 56492 }, // қ
+    { 18, 24, 21, 3, 24, 108, 56599 }, // Ҝ
+    { 16, 18, 18, 2, 18, 72, 56707 }, // ҝ
+    { 21, 24, 21, 0, 24, 126, 56779 }, // Ҟ
+    { 18, 26, 18, 0, 26, 117, 56905 }, // ҟ
+    { 24, 24, 23, 0, 24, 144, 57022 }, // Ҡ
+    { 21, 18, 21, 0, 18, 95, 57166 }, // ҡ
+    { 22, 31, 25, 3, 24, 171, 57344 }, // Ң
+    { 20, 25, 22, 2, 18, 125, 57515 }, // ң
+    { 24, 24, 27, 3, 24, 144, 57640 }, // Ҥ
+    { 23, 18, 25, 2, 18, 104, 57784 }, // ҥ
+    { 31, 33, 35, 3, 24, 256, 57888 }, // Ҧ
+    { 26, 27, 29, 2, 18, 176, 58144 }, // ҧ
+    { 23, 27, 26, 2, 25, 156, 58320 }, // Ҩ
+    { 20, 20, 21, 1, 19, 100, 58476 }, // ҩ
+    { 19, 33, 21, 2, 25, 157, 58576 }, // Ҫ
+    { 14, 27, 16, 1, 19, 95, 58733 }, // ҫ
+    { 19, 31, 19, 0, 24, 148, 58828 }, // Ҭ
+    { 16, 25, 16, 0, 18, 100, 58976 }, // ҭ
+    { 19, 24, 19, 0, 24, 114, 59076 }, // Ү
+    { 17, 26, 17, 0, 18, 111, 59190 }, // ү
+    { 19, 24, 19, 0, 24, 114, 59392 }, // Ұ
+    { 17, 26, 17, 0, 18, 111, 59506 }, // ұ
+    { 21, 31, 21, 0, 24, 163, 59617 }, // Ҳ
+    { 18, 25, 18, 0, 18, 113, 59780 }, // ҳ
+    { 28, 31, 29, 0, 24, 217, 59893 }, // Ҵ
+    { 24, 25, 24, 0, 18, 150, 60110 }, // ҵ
+    { 21, 31, 23, 2, 24, 163, 60260 }, // Ҷ
+    { 19, 25, 21, 2, 18, 119, 60423 }, // ҷ
+    { 19, 24, 23, 2, 24, 114, 60542 }, // Ҹ
+    { 16, 18, 20, 2, 18, 72, 60656 }, // ҹ
+    { 18, 24, 23, 3, 24, 108, 60728 }, // Һ
+    { 16, 26, 21, 2, 26, 104, 60836 }, // һ
+    { 27, 26, 28, 0, 25, 176, 60940 }, // Ҽ
+    { 21, 20, 22, 0, 19, 105, 61116 }, // ҽ
+    { 27, 32, 28, 0, 25, 216, 61221 }, // Ҿ
+    { 21, 26, 22, 0, 19, 137, 61440 }, // ҿ
+    { 9, 24, 11, 1, 24, 54, 61577 }, // Ӏ
+    { 31, 31, 30, 0, 31, 241, 61631 }, // Ӂ
+    { 26, 25, 25, 0, 25, 163, 61872 }, // ӂ
+    { 19, 33, 23, 3, 24, 157, 62035 }, // Ӄ
+    { 16, 27, 19, 2, 18, 108, 62192 }, // ӄ
+    { 24, 31, 24, 0, 24, 186, 62300 }, // Ӆ
+    { 20, 25, 20, 0, 18, 125, 62486 }, // ӆ
+    { 19, 33, 24, 3, 24, 157, 62611 }, // Ӈ
+    { 17, 27, 21, 2, 18, 115, 62768 }, // ӈ
+    { 22, 31, 25, 3, 24, 171, 62883 }, // Ӊ
+    { 20, 25, 22, 2, 18, 125, 63054 }, // ӊ
+    { 19, 31, 23, 2, 24, 148, 63179 }, // Ӌ
+    { 16, 25, 20, 2, 18, 100, 63327 }, // ӌ
+    { 28, 31, 31, 3, 24, 217, 63488 }, // Ӎ
+    { 24, 25, 25, 2, 18, 150, 63705 }, // ӎ
+    { 9, 24, 11, 1, 24, 54, 63855 }, // ӏ
+    { 22, 31, 21, 0, 31, 171, 63909 }, // Ӑ
+    { 15, 26, 19, 1, 25, 98, 64080 }, // ӑ
+    { 22, 31, 21, 0, 31, 171, 64178 }, // Ӓ
+    { 15, 26, 19, 1, 25, 98, 64349 }, // ӓ
+    { 29, 24, 29, -1, 24, 174, 64447 }, // Ӕ
+    { 27, 20, 29, 1, 19, 135, 64621 }, // ӕ
+    { 14, 31, 19, 3, 31, 109, 64756 }, // Ӗ
+    { 17, 26, 19, 1, 25, 111, 64865 }, // ӗ
+    { 22, 26, 25, 1, 25, 143, 64976 }, // Ә
+    { 16, 20, 19, 1, 19, 80, 65119 }, // ә
+    { 22, 32, 25, 1, 31, 176, 65199 }, // Ӛ
+    { 16, 26, 19, 1, 25, 104, 65375 }, // ӛ
+    { 31, 31, 30, 0, 31, 241, 65536 }, // Ӝ
+    { 26, 25, 25, 0, 25, 163, 65777 }, // ӝ
+    { 17, 32, 19, 1, 31, 136, 65940 }, // Ӟ
+    { 14, 26, 16, 1, 25, 91, 66076 }, // ӟ
+    { 17, 25, 19, 1, 24, 107, 66167 }, // Ӡ
+    { 16, 26, 17, 0, 18, 104, 66274 }, // ӡ
+    { 19, 29, 25, 3, 29, 138, 66378 }, // Ӣ
+    { 16, 23, 21, 2, 23, 92, 66516 }, // ӣ
+    { 19, 31, 25, 3, 31, 148, 66608 }, // Ӥ
+    { 16, 25, 21, 2, 25, 100, 66756 }, // ӥ
+    { 22, 32, 26, 2, 31, 176, 66856 }, // Ӧ
+    { 18, 26, 20, 1, 25, 117, 67032 }, // ӧ
+    { 22, 26, 26, 2, 25, 143, 67149 }, // Ө
+    { 18, 20, 20, 1, 19, 90, 67292 }, // ө
+    { 22, 32, 26, 2, 31, 176, 67382 }, // Ӫ
+    { 18, 26, 20, 1, 25, 117, 67584 }, // ӫ
+    { 19, 32, 22, 1, 31, 152, 67701 }, // Ӭ
+    { 14, 26, 16, 1, 25, 91, 67853 }, // ӭ
+    { 21, 30, 21, 0, 29, 158, 67944 }, // Ӯ
+    { 17, 31, 17, 0, 23, 132, 68102 }, // ӯ
+    { 21, 32, 21, 0, 31, 168, 68234 }, // Ӱ
+    { 17, 33, 17, 0, 25, 141, 68402 }, // ӱ
+    { 21, 33, 21, 0, 32, 174, 68543 }, // Ӳ
+    { 17, 34, 17, 0, 26, 145, 68717 }, // ӳ
+    { 18, 31, 22, 2, 31, 140, 68862 }, // Ӵ
+    { 15, 25, 20, 2, 25, 94, 69002 }, // ӵ
+    { 14, 31, 18, 3, 24, 109, 69096 }, // Ӷ
+    { 12, 25, 14, 2, 18, 75, 69205 }, // ӷ
+    { 23, 31, 28, 3, 31, 179, 69280 }, // Ӹ
+    { 21, 25, 25, 2, 25, 132, 69459 }, // ӹ
+    { 17, 31, 18, 0, 24, 132, 69632 }, // Ӻ
+    { 14, 25, 14, 0, 18, 88, 69764 }, // ӻ
+    { 21, 31, 21, 0, 24, 163, 69852 }, // Ӽ
+    { 18, 25, 18, 0, 18, 113, 70015 }, // ӽ
+    { 20, 24, 20, 0, 24, 120, 70128 }, // Ӿ
+    { 18, 18, 18, 0, 18, 81, 70248 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 70329 }, //  
+    { 0, 0, 33, 0, 0, 0, 70329 }, //  
+    { 0, 0, 17, 0, 0, 0, 70329 }, //  
+    { 0, 0, 33, 0, 0, 0, 70329 }, //  
+    { 0, 0, 11, 0, 0, 0, 70329 }, //  
+    { 0, 0, 8, 0, 0, 0, 70329 }, //  
+    { 0, 0, 6, 0, 0, 0, 70329 }, //  
+    { 0, 0, 19, 0, 0, 0, 70329 }, //  
+    { 0, 0, 9, 0, 0, 0, 70329 }, //  
+    { 0, 0, 6, 0, 0, 0, 70329 }, //  
+    { 0, 0, 3, 0, 0, 0, 70329 }, //  
+    { 0, 0, 0, 0, 0, 0, 70329 }, // ​
+    { 0, 0, 0, 0, 0, 0, 70329 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 70329 }, // ‍
+    { 9, 28, 0, -1, 23, 63, 70329 }, // ‎
+    { 9, 28, 0, -8, 23, 63, 70392 }, // ‏
+    { 9, 4, 11, 1, 11, 9, 70455 }, // ‐
+    { 9, 4, 11, 1, 11, 9, 70464 }, // ‑
+    { 17, 4, 19, 1, 14, 17, 70473 }, // ‒
+    { 15, 4, 17, 1, 11, 15, 70490 }, // –
+    { 31, 4, 33, 1, 11, 31, 70505 }, // —
+    { 31, 4, 33, 1, 11, 31, 70536 }, // ―
+    { 11, 35, 18, 4, 26, 97, 70567 }, // ‖
+    { 15, 8, 14, -1, 0, 30, 70664 }, // ‗
+    { 6, 9, 6, 0, 24, 14, 70694 }, // ‘
+    { 6, 9, 6, 0, 24, 14, 70708 }, // ’
+    { 6, 9, 8, 1, 4, 14, 70722 }, // ‚
+    { 6, 9, 6, 0, 24, 14, 70736 }, // ‛
+    { 12, 9, 12, 0, 24, 27, 70750 }, // “
+    { 12, 9, 12, 0, 24, 27, 70777 }, // ”
+    { 12, 9, 14, 1, 4, 27, 70804 }, // „
+    { 12, 9, 12, 0, 24, 27, 70831 }, // ‟
+    { 13, 26, 17, 2, 26, 85, 70858 }, // †
+    { 14, 26, 17, 2, 26, 91, 70943 }, // ‡
+    { 8, 9, 13, 2, 17, 18, 71034 }, // •
+    { 9, 11, 12, 2, 18, 25, 71052 }, // ‣
+    { 5, 6, 17, 6, 5, 8, 71077 }, // ․
+    { 14, 6, 18, 2, 5, 21, 71085 }, // ‥
+    { 22, 6, 26, 2, 5, 33, 71106 }, // …
+    { 5, 6, 9, 2, 11, 8, 71139 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 71147 }, //  
+    { 0, 0, 20, 0, 0, 0, 71147 }, //  
+    { 9, 26, 0, -1, 21, 59, 71147 }, // ‪
+    { 9, 26, 0, -8, 21, 59, 71206 }, // ‫
+    { 8, 28, 0, -4, 23, 56, 71265 }, // ‬
+    { 8, 28, 0, -4, 23, 56, 71321 }, // ‭
+    { 8, 28, 0, -4, 23, 56, 71377 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 71433 }, //  
+    { 37, 26, 39, 1, 25, 241, 71433 }, // ‰
+    { 49, 26, 51, 1, 25, 319, 71680 }, // ‱
+    { 8, 9, 8, 1, 24, 18, 71999 }, // ′
+    { 14, 9, 14, 1, 24, 32, 72017 }, // ″
+    { 20, 9, 19, 1, 24, 45, 72049 }, // ‴
+    { 8, 9, 8, -1, 24, 18, 72094 }, // ‵
+    { 13, 9, 15, -1, 24, 30, 72112 }, // ‶
+    { 19, 9, 20, -1, 24, 43, 72142 }, // ‷
+    { 13, 11, 13, 0, 3, 36, 72185 }, // ‸
+    { 9, 15, 10, 1, 16, 34, 72221 }, // ‹
+    { 8, 15, 10, 1, 16, 30, 72255 }, // ›
+    { 26, 26, 28, 1, 25, 169, 72285 }, // ※
+    { 13, 25, 17, 2, 24, 82, 72454 }, // ‼
+    { 14, 26, 15, 0, 25, 91, 72536 }, // ‽
+    { 18, 3, 17, -1, 28, 14, 72627 }, // ‾
+    { 20, 7, 20, 0, -1, 35, 72641 }, // ‿
+    { 20, 8, 20, 0, 27, 40, 72676 }, // ⁀
+    { 12, 22, 12, 0, 14, 66, 72716 }, // ⁁
+    { 37, 31, 37, 0, 26, 287, 72782 }, // ⁂
+    { 9, 4, 11, 1, 11, 9, 73069 }, // ⁃
+    { 18, 24, 4, -7, 24, 108, 73078 }, // ⁄
+    { 8, 30, 11, 2, 24, 60, 73186 }, // ⁅
+    { 9, 30, 11, 0, 24, 68, 73246 }, // ⁆
+    { 28, 26, 29, 0, 25, 182, 73314 }, // ⁇
+    { 21, 26, 23, 0, 25, 137, 73496 }, // ⁈
+    { 20, 26, 23, 2, 25, 130, 73728 }, // ⁉
+    { 17, 18, 19, 1, 18, 77, 73858 }, // ⁊
+    { 17, 31, 22, 3, 26, 132, 73935 }, // ⁋
+    { 18, 17, 21, 1, 18, 77, 74067 }, // ⁌
+    { 18, 17, 21, 2, 18, 77, 74144 }, // ⁍
+    { 16, 16, 18, 1, 9, 64, 74221 }, // ⁎
+    { 6, 24, 8, 1, 19, 36, 74285 }, // ⁏
+    { 20, 35, 20, 0, 27, 175, 74321 }, // ⁐
+    { 16, 33, 18, 1, 26, 132, 74496 }, // ⁑
+    { 13, 26, 12, 0, 25, 85, 74628 }, // ⁒
+    { 29, 6, 33, 2, 13, 44, 74713 }, // ⁓
+    { 20, 8, 20, 0, 0, 40, 74757 }, // ⁔
+    { 18, 18, 19, 0, 17, 81, 74797 }, // ⁕
+    { 15, 26, 17, 1, 25, 98, 74878 }, // ⁖
+    { 25, 9, 25, 1, 24, 57, 74976 }, // ⁗
+    { 25, 26, 27, 1, 25, 163, 75033 }, // ⁘
+    { 25, 26, 28, 1, 25, 163, 75196 }, // ⁙
+    { 5, 26, 7, 1, 25, 33, 75359 }, // ⁚
+    { 20, 26, 22, 1, 25, 130, 75392 }, // ⁛
+    { 25, 26, 27, 1, 25, 163, 75522 }, // ⁜
+    { 5, 25, 9, 2, 24, 32, 75685 }, // ⁝
+    { 5, 26, 9, 2, 25, 33, 75717 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 75750 }, //  
+    { 0, 0, 20, 0, 0, 0, 75750 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 75750 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 75750 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 75750 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 75750 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 75750 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 75750 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 75750 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 75750 }, // ⁩
+    { 8, 28, 0, -4, 23, 56, 75776 }, // ⁪
+    { 8, 28, 0, -4, 23, 56, 75832 }, // ⁫
+    { 8, 28, 0, -4, 23, 56, 75888 }, // ⁬
+    { 8, 29, 0, -4, 24, 58, 75944 }, // ⁭
+    { 8, 28, 0, -4, 23, 56, 76002 }, // ⁮
+    { 8, 28, 0, -4, 23, 56, 76058 }, // ⁯
+    { 11, 16, 12, 0, 29, 44, 76114 }, // ⁰
+    { 3, 16, 6, 1, 25, 12, 76158 }, // ⁱ
+    { 12, 16, 12, 0, 29, 48, 76170 }, // ⁴
+    { 10, 16, 12, 1, 29, 40, 76218 }, // ⁵
+    { 12, 16, 12, 0, 29, 48, 76258 }, // ⁶
+    { 11, 16, 12, 0, 29, 44, 76306 }, // ⁷
+    { 11, 16, 12, 0, 29, 44, 76350 }, // ⁸
+    { 11, 16, 12, 0, 29, 44, 76394 }, // ⁹
+    { 10, 10, 11, 1, 25, 25, 76438 }, // ⁺
+    { 10, 3, 11, 1, 21, 8, 76463 }, // ⁻
+    { 10, 6, 11, 1, 23, 15, 76471 }, // ⁼
+    { 6, 19, 8, 2, 31, 29, 76486 }, // ⁽
+    { 6, 19, 8, 0, 31, 29, 76515 }, // ⁾
+    { 11, 12, 13, 1, 21, 33, 76544 }, // ⁿ
+    { 11, 16, 12, 0, 11, 44, 76577 }, // ₀
+    { 7, 16, 12, 1, 11, 28, 76621 }, // ₁
+    { 11, 16, 12, 0, 11, 44, 76649 }, // ₂
+    { 11, 16, 12, 0, 11, 44, 76693 }, // ₃
+    { 12, 16, 12, 0, 11, 48, 76737 }, // ₄
+    { 10, 16, 12, 1, 11, 40, 76785 }, // ₅
+    { 12, 16, 12, 0, 11, 48, 76825 }, // ₆
+    { 11, 16, 12, 0, 11, 44, 76873 }, // ₇
+    { 11, 16, 12, 0, 11, 44, 76917 }, // ₈
+    { 11, 16, 12, 0, 11, 44, 76961 }, // ₉
+    { 10, 10, 11, 1, 7, 25, 77005 }, // ₊
+    { 10, 3, 11, 1, 3, 8, 77030 }, // ₋
+    { 10, 6, 11, 1, 5, 15, 77038 }, // ₌
+    { 6, 19, 8, 2, 13, 29, 77053 }, // ₍
+    { 6, 19, 8, 0, 13, 29, 77082 }, // ₎
+    { 10, 12, 12, 1, 8, 30, 77111 }, // ₐ
+    { 11, 12, 12, 1, 8, 33, 77141 }, // ₑ
+    { 11, 12, 13, 1, 8, 33, 77174 }, // ₒ
+    { 12, 12, 11, 0, 8, 36, 77207 }, // ₓ
+    { 11, 12, 12, 1, 8, 33, 77243 }, // ₔ
+    { 11, 16, 13, 1, 12, 44, 77276 }, // ₕ
+    { 11, 16, 12, 1, 12, 44, 77320 }, // ₖ
+    { 3, 16, 6, 1, 12, 12, 77364 }, // ₗ
+    { 18, 12, 20, 1, 8, 54, 77376 }, // ₘ
+    { 11, 12, 13, 1, 8, 33, 77430 }, // ₙ
+    { 12, 16, 13, 1, 8, 48, 77463 }, // ₚ
+    { 9, 12, 10, 1, 8, 27, 77511 }, // ₛ
+    { 8, 14, 8, 0, 10, 28, 77538 }, // ₜ
+    { 17, 25, 19, 1, 25, 107, 77566 }, // ₠
+    { 18, 28, 19, 1, 26, 126, 77673 }, // ₡
+    { 17, 26, 19, 1, 25, 111, 77824 }, // ₢
+    { 17, 24, 19, 1, 24, 102, 77935 }, // ₣
+    { 17, 25, 19, 1, 25, 107, 78037 }, // ₤
+    { 27, 27, 31, 2, 23, 183, 78144 }, // ₥
+    { 19, 24, 19, 0, 24, 114, 78327 }, // ₦
+    { 23, 25, 26, 2, 24, 144, 78441 }, // ₧
+    { 25, 25, 28, 2, 24, 157, 78585 }, // ₨
+    { 22, 24, 22, 0, 24, 132, 78742 }, // ₩
+    { 22, 24, 27, 2, 24, 132, 78874 }, // ₪
+    { 20, 32, 21, 1, 26, 160, 79006 }, // ₫
+    { 19, 26, 19, 0, 25, 124, 79166 }, // €
+    { 20, 24, 19, 0, 24, 120, 79290 }, // ₭
+    { 19, 24, 19, 0, 24, 114, 79410 }, // ₮
+    { 32, 33, 32, 0, 25, 264, 79524 }, // ₯
+    { 18, 33, 19, 0, 25, 149, 79872 }, // ₰
+    { 19, 24, 19, 0, 24, 114, 80021 }, // ₱
+    { 20, 29, 24, 2, 26, 145, 80135 }, // ₲
+    { 21, 24, 20, 0, 24, 126, 80280 }, // ₳
+    { 18, 26, 18, 0, 25, 117, 80406 }, // ₴
+    { 19, 29, 21, 2, 26, 138, 80523 }, // ₵
+    { 20, 23, 21, 0, 22, 115, 80661 }, // ₶
+    { 23, 28, 24, 0, 25, 161, 80776 }, // ₷
+    { 18, 24, 18, 0, 24, 108, 80937 }, // ₸
+    { 15, 24, 19, 2, 24, 90, 81045 }, // ₹
+    { 19, 25, 19, 0, 24, 119, 81135 }, // ₺
+    { 26, 26, 26, 0, 25, 169, 81254 }, // ₻
+    { 24, 24, 27, 1, 24, 144, 81423 }, // ₼
+    { 19, 24, 19, 0, 24, 114, 81567 }, // ₽
+    { 22, 26, 26, 2, 26, 143, 81681 }, // ₾
+    { 15, 32, 19, 3, 28, 120, 81920 }, // ₿
+    { 14, 24, 16, 1, 19, 84, 82040 }, // ⃀
+    { 17, 3, 19, 1, 13, 13, 82124 }, // −
+    { 31, 32, 33, 1, 26, 248, 82137 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_regularIntervals[] = {
@@ -5930,4 +3365,9 @@ static const EpdFontData notosans_16_regular = {
     36,
     -10,
     true,
+    notosans_16_regularBlockOffsets,
+    notosans_16_regularDirectGlyphs,
+    notosans_16_regularGlyphPages,
+    256,
+    notosans_16_regularPageGlyphs,
 };
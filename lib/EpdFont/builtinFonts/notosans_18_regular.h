@@ -2,6302 +2,2865 @@
  * generated by fontconvert.py
  * name: notosans_18_regular
  * size: 18
- * mode: 2-bit
- * Command used: fontconvert.py notosans_18_regular 18 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py notosans_18_regular 18 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_18_regularBitmaps[100620] = {
-    0x2F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC2, 0xFC, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x1F,
-    0x81, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x40, 0xF4, 0x0F, 0x40, 0xF0, 0x0F, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x05, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x7F, 0x02, 0xF9, 0xFC, 0x0B, 0xF7,
-    0xF0, 0x2F, 0x9F, 0x80, 0x7E, 0x3E, 0x01, 0xF8, 0xF8, 0x07, 0xD3, 0xE0, 0x0F, 0x4F, 0x40, 0x3D,
-    0x3D, 0x00, 0xF0, 0xF4, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x06, 0xAB, 0xFA, 0xAB, 0xFA, 0xA8, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x15, 0x5F, 0xD5, 0x5F, 0xD5, 0x50, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x1F, 0x40, 0x00, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFB, 0xFF, 0x03, 0xF8, 0x2F, 0x01, 0xA0, 0xBF, 0x02, 0xF0, 0x00,
-    0x0B, 0xE0, 0x2F, 0x00, 0x00, 0xBE, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0x00, 0x00, 0x3F, 0xD2,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xBF, 0xF4, 0x00, 0x02, 0xF0, 0x7F, 0xC0, 0x00, 0x2F,
-    0x00, 0xFC, 0x00, 0x02, 0xF0, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x02, 0xF0, 0x1F, 0xCB,
-    0x40, 0x2F, 0x0B, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x1B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x4B,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x80,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x03, 0xE0, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x0F, 0x80, 0x54, 0x00, 0x3F,
-    0x00, 0x3E, 0x0B, 0xC1, 0xFF, 0xE0, 0x0B, 0xC0, 0x1F, 0x43, 0xE1, 0xFF, 0xFE, 0x00, 0xF8, 0x0F,
-    0xC3, 0xF0, 0xFD, 0x0F, 0xD0, 0x2F, 0xEF, 0xE1, 0xF8, 0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xE0, 0xFC,
-    0x1F, 0x40, 0x3F, 0x00, 0x1A, 0x80, 0x7D, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x02, 0xF0,
-    0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x02, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xF4, 0x3F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xFA, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x01, 0x54,
-    0x00, 0xBF, 0xDF, 0xF8, 0x00, 0x0F, 0xD0, 0x0B, 0xFC, 0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x3F, 0x80,
-    0x0F, 0xF8, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x0F, 0xF8, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x0F, 0xF8,
-    0x7F, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0xAB, 0xFF, 0xCB, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFC, 0x00, 0x1B, 0xFF, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x7F, 0x7F, 0x7E, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0xBE,
-    0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x02,
-    0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00,
-    0x3F, 0x40, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x03,
-    0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0xFE,
-    0x00, 0x2F, 0xC0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xF8, 0x00, 0xBE,
-    0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x03, 0xF0,
-    0x01, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x0F, 0xE0, 0x03, 0xF0, 0x02, 0xF8, 0x01,
-    0xFC, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xE4, 0x0F, 0x40, 0x7E, 0x0F, 0xFF, 0x7E, 0xBF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x15, 0xAF, 0xFA, 0x55, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00,
-    0x00, 0x2F, 0x4F, 0xD0, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0xBF, 0x40, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x2A, 0xAA, 0xFE, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0x50, 0x2F, 0xC0, 0xFF, 0x03, 0xF4, 0x1F,
-    0xC0, 0x7F, 0x02, 0xF4, 0x0F, 0xC0, 0x3E, 0x01, 0xF0, 0x00, 0x6A, 0xAA, 0x9B, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xE1, 0x55, 0x54, 0x05, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0xFF, 0x80, 0x03,
-    0xFC, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00,
-    0x02, 0xF8, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0x3F,
-    0x4F, 0xD0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x0B, 0xE3, 0xF0,
-    0x00, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00,
-    0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x03, 0xF0,
-    0x7F, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x03, 0xF8,
-    0x00, 0x7F, 0x80, 0x07, 0xFE, 0x6B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0xD0, 0x07, 0xFF, 0x40, 0xBF,
-    0xFD, 0x0F, 0xF7, 0xF5, 0xFF, 0x4F, 0xD3, 0xF0, 0x3F, 0x46, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xEB, 0xFF, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x28, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xEA, 0xFF, 0xC0, 0x2F, 0x90, 0x00, 0xBF, 0xC0, 0x24, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x5B, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x0A, 0xAB,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x74, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xA5, 0x6F,
-    0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xE7, 0xF0, 0x00,
-    0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x00,
-    0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x40, 0x01, 0xFC, 0x00, 0x1F,
-    0x80, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x45, 0x50, 0x00, 0x03,
-    0xFF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xE9, 0x56, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x4A, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0xA5, 0xAF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xAA, 0xA0, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x1B,
-    0xA4, 0x00, 0xBE, 0x2F, 0xFF, 0xF4, 0x0F, 0xDB, 0xFF, 0xFF, 0xE0, 0xFF, 0xF4, 0x00, 0xFF, 0x4F,
-    0xFC, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xE0, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00,
-    0x0B, 0xEB, 0xD0, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0xFE, 0x3F,
-    0x40, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x7F, 0xE5, 0xBF,
-    0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xEA, 0xFF, 0xD0, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x3F, 0x40, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x00,
-    0xBE, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x3F, 0x40,
-    0x7F, 0x40, 0x03, 0xF8, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x00, 0xBF, 0xEF, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xEB, 0xFF, 0x40, 0x07, 0xFC, 0x01, 0xFF,
-    0x80, 0x3F, 0x80, 0x00, 0xBF, 0x42, 0xFC, 0x00, 0x00, 0xBF, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x00, 0x3F, 0x4F, 0xE0, 0x00,
-    0x01, 0xFC, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x3F, 0xF9, 0x56, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x1B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xEA, 0xFF, 0x80, 0x0B, 0xF4, 0x00,
-    0xBF, 0x40, 0x7F, 0x40, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x01, 0xFC,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x3F, 0x4F, 0xD0,
-    0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0xBF, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x07,
-    0xFF, 0x41, 0xFF, 0xEA, 0xFD, 0xFD, 0x01, 0xFF, 0xFF, 0xD3, 0xF4, 0x00, 0x7F, 0xF8, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x09, 0x56, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x0A, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFC, 0x7F,
-    0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x02, 0x80, 0x3F, 0xC1, 0xFF, 0x47, 0xFC, 0x0F, 0xF0, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x3F, 0x80, 0xFD, 0x07, 0xF0, 0x2F, 0xC0, 0xFD, 0x03, 0xF0, 0x1F, 0x80, 0xBC,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x55,
-    0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x55, 0x55, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFE, 0xFF, 0xF0, 0x2E, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6B, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0xBE, 0x00, 0x01, 0x55, 0x40, 0x02, 0xF4, 0x0F, 0xC0, 0x01, 0xFF, 0xFF,
-    0xC0, 0x0F, 0x82, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBC, 0x3F, 0x00, 0x2F, 0xD0, 0x0B, 0xD0,
-    0x07, 0xC3, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0x3D, 0x7D, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x03,
-    0xDB, 0xC0, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E, 0xBC, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x03, 0xEF,
-    0xC0, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x3D, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x07, 0xCF, 0xC0,
-    0x0F, 0x80, 0x00, 0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x0F, 0x8B, 0xC0, 0x0B,
-    0xE0, 0x07, 0xFD, 0x02, 0xF0, 0x7D, 0x00, 0x3F, 0xD6, 0xF6, 0xF9, 0xFE, 0x03, 0xE0, 0x01, 0xFF,
-    0xFD, 0x0F, 0xFF, 0x80, 0x3F, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0x90, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x05, 0xBF, 0x40,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0xFF, 0xFA, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0x01, 0xBF, 0xE0, 0x7F, 0x00,
-    0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00,
-    0x03, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x1F,
-    0xD0, 0x7F, 0x55, 0x56, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x7F, 0x55, 0x56, 0xFF, 0xD0, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x00,
-    0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0x00, 0x00,
-    0x2F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xD0, 0x00, 0x6E, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x05, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x40, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xC0, 0x01, 0x6F, 0xFD,
-    0x00, 0x7F, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xF0, 0x00, 0x00,
-    0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xD1, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x00, 0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x87, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x81, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC0,
-    0x00, 0x6F, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55,
-    0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xAA,
-    0xAA, 0xA8, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE4, 0x00, 0x07, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x02, 0xFF, 0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0xBF, 0x00, 0x00, 0x2F, 0xFF, 0xFA,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x00,
-    0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0x81, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x02, 0xFF, 0x80, 0x00, 0x03, 0xF8, 0x02, 0xFF,
-    0xFA, 0xAA, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F,
-    0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00,
-    0x1F, 0xC7, 0xF5, 0x55, 0x55, 0x56, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC1,
-    0xBF, 0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x06, 0xFE, 0x41, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00,
-    0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0,
-    0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00,
-    0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xE0, 0x00, 0xFD,
-    0x00, 0x3F, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x01, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0xBF,
-    0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xC0, 0x7F, 0x40,
-    0x00, 0x07, 0xF0, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x3F, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xC0, 0x0F, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x00,
-    0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x07, 0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x0B, 0xF4,
-    0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x7E, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0xBD,
-    0xFD, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0xFD, 0x7E, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0xFD, 0x7E,
-    0x2F, 0x80, 0x00, 0x03, 0xF4, 0xFD, 0x7E, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xFD, 0x7E, 0x0F, 0xD0,
-    0x00, 0x0B, 0xE0, 0xFD, 0x7F, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x7F, 0x03, 0xF4, 0x00, 0x1F,
-    0xC0, 0xFD, 0x7F, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0xFD, 0x7F, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xFD,
-    0x7F, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0xFD, 0x7F, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFD, 0x7F, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0xFD, 0x7F, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0xFD, 0x7F, 0x00, 0x1F, 0xC3,
-    0xF0, 0x00, 0xFD, 0x7F, 0x00, 0x0F, 0xD7, 0xE0, 0x00, 0xFD, 0x7F, 0x00, 0x0B, 0xEB, 0xD0, 0x00,
-    0xFD, 0x7F, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFD, 0x7F, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFD, 0x7F,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xE7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F,
-    0xF0, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xF7,
-    0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x7E, 0x7F, 0x80, 0x00, 0x07, 0xF7, 0xE2, 0xFC, 0x00, 0x00, 0x7F,
-    0x7E, 0x0F, 0xF0, 0x00, 0x07, 0xF7, 0xE0, 0x7F, 0x80, 0x00, 0x7F, 0x7E, 0x02, 0xFC, 0x00, 0x07,
-    0xF7, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x40, 0x07, 0xF7, 0xF0, 0x03, 0xFC, 0x00,
-    0x7F, 0x7F, 0x00, 0x0F, 0xE0, 0x07, 0xF7, 0xF0, 0x00, 0x7F, 0x40, 0x7F, 0x7F, 0x00, 0x03, 0xFC,
-    0x07, 0xF7, 0xF0, 0x00, 0x0F, 0xE0, 0x3F, 0x7F, 0x00, 0x00, 0xBF, 0x43, 0xF7, 0xF0, 0x00, 0x03,
-    0xFC, 0x3F, 0x7F, 0x00, 0x00, 0x1F, 0xE3, 0xF7, 0xF0, 0x00, 0x00, 0xBF, 0x7F, 0x7F, 0x00, 0x00,
-    0x03, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02,
-    0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xE9, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xF0, 0x01, 0x7F,
-    0xF4, 0x7F, 0x00, 0x00, 0x7F, 0xC7, 0xF0, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x0F, 0xE7, 0xF0,
-    0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x0F,
-    0xD7, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0xBF, 0x87, 0xF5, 0x56, 0xBF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xAA, 0x94, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02,
-    0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x5F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x7F, 0xFF, 0xE9, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x06, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00,
-    0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x0B,
-    0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x3F, 0xC0,
-    0x7F, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00,
-    0x03, 0xF8, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x40, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B,
-    0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00,
-    0x1B, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01,
-    0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07,
-    0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFD,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x1F, 0xD2,
-    0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xEA, 0xBF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x03, 0xF6, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0xFE,
-    0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x00, 0x00,
-    0xFE, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00,
-    0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xEF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x1F, 0xC0,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x00,
-    0xFE, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x02, 0xF8, 0x02, 0xFC, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x0F,
-    0xD0, 0x07, 0xF0, 0x00, 0x3F, 0x4B, 0xE0, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xBF, 0x00, 0x2F, 0x40,
-    0xFD, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0xFC, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x07,
-    0xF0, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x2F, 0x80, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x2F,
-    0xC0, 0xFD, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00,
-    0x00, 0xFD, 0x1F, 0x80, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x02, 0xF8, 0xFE,
-    0x00, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x81, 0xFD, 0x00,
-    0x00, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x02, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40,
-    0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x40, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x00, 0x00,
-    0xBF, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xBE, 0x00, 0x00,
-    0x00, 0x1F, 0x87, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00,
-    0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF8, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00,
-    0x07, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x7F, 0xFF, 0xDF, 0xFF, 0xF7, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xFF, 0xF7, 0xFF, 0xFD, 0xFF, 0xFF, 0x40, 0x7E, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0xFF, 0xD3,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x3F, 0xFF, 0xD3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x2F,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
-    0xBC, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x0F,
-    0x80, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x02, 0xF4,
-    0x7E, 0x00, 0x00, 0x00, 0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x6A, 0x40, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0x50, 0x00, 0x00, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F, 0x2F, 0xE0, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2,
-    0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF, 0xFE, 0x2F, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x55, 0x00, 0x0F, 0xD1, 0xFF, 0xFE, 0x00, 0xFD, 0xBF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xD5, 0x7F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF4, 0x00, 0x02, 0xFC,
-    0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0xFD, 0xFF, 0x80, 0x00,
-    0x2F, 0xCF, 0xFD, 0x00, 0x0B, 0xF8, 0xFE, 0xFE, 0x5B, 0xFF, 0x0F, 0xCB, 0xFF, 0xFF, 0xC0, 0xF8,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0x95, 0xBC, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40,
-    0xBF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x05, 0x50, 0x07, 0xF0, 0x0B, 0xFF, 0xF4, 0x7F, 0x03, 0xFF, 0xFF, 0xE7, 0xF0, 0xFF, 0xD5, 0x6F,
-    0xFF, 0x2F, 0xE0, 0x00, 0x7F, 0xF3, 0xF8, 0x00, 0x02, 0xFF, 0x7F, 0x00, 0x00, 0x0F, 0xFB, 0xF0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xBF, 0x00,
-    0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x1F, 0xF2, 0xFE, 0x00, 0x07, 0xFF,
-    0x0F, 0xFE, 0x5B, 0xFB, 0xF0, 0x3F, 0xFF, 0xFD, 0x3F, 0x00, 0x7F, 0xFF, 0x43, 0xF0, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00,
-    0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF9,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0x00, 0x0F, 0xF0, 0x14, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF4, 0x05, 0x7F,
-    0x95, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x3F, 0x03, 0xFF, 0xFF, 0xE3, 0xF0,
-    0xFF, 0xD5, 0x7F, 0xBF, 0x1F, 0xE0, 0x00, 0x7F, 0xF3, 0xF8, 0x00, 0x02, 0xFF, 0x7F, 0x00, 0x00,
-    0x0F, 0xFB, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xBF, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x1F, 0xF1, 0xFE,
-    0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x57, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x7F, 0xFF, 0x47,
-    0xF0, 0x00, 0x15, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x1E, 0x40, 0x00, 0xBF, 0x81, 0xFF, 0xFB, 0xFF, 0xF0,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x55,
-    0x00, 0x0F, 0xD1, 0xFF, 0xFF, 0x40, 0xFD, 0xBF, 0xFF, 0xFD, 0x0F, 0xEF, 0xE5, 0x6F, 0xF0, 0xFF,
-    0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x00,
-    0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F,
-    0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x0A, 0x0F, 0xE3, 0xFC,
-    0xFE, 0x09, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD,
-    0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x00,
-    0x02, 0x80, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x02, 0xFC, 0x3F, 0xFF, 0x83, 0xFF, 0xF0, 0x2F, 0xF8, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x8F, 0xD0, 0x00, 0x7F, 0x83, 0xF4, 0x00, 0x3F, 0x80, 0xFD,
-    0x00, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x80, 0x0F, 0xD0, 0x3F, 0xC0, 0x03, 0xF4, 0x3F, 0xC0, 0x00,
-    0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0x8B, 0xF4, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x03, 0xF4, 0x01,
-    0xFE, 0x00, 0xFD, 0x00, 0x2F, 0xD0, 0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x3F, 0xC3, 0xF4,
-    0x00, 0x07, 0xF8, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x68, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0x00, 0x55, 0x00, 0x00, 0x55, 0x00, 0x0F, 0xC1, 0xFF, 0xFE,
-    0x00, 0xBF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x0F, 0xEF, 0x95, 0xBF, 0xDF,
-    0xE5, 0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0x8F, 0xF4, 0x00, 0x07, 0xFC, 0x00,
-    0x02, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xFD,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x55, 0x00, 0x0F, 0xC1, 0xFF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF, 0xFD,
-    0x0F, 0xEF, 0xD5, 0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00,
-    0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0,
-    0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00,
-    0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA,
-    0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0,
-    0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F, 0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x0F,
-    0xC1, 0xFF, 0xFE, 0x00, 0xFC, 0xBF, 0xFF, 0xFC, 0x0F, 0xEF, 0xD5, 0x7F, 0xF0, 0xFF, 0xD0, 0x00,
-    0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x00, 0xFE, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xEF, 0xF0,
-    0x00, 0x01, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCF, 0xFE, 0x00, 0x0B, 0xF8, 0xFF, 0xFE, 0x5B, 0xFF,
-    0x0F, 0xDB, 0xFF, 0xFF, 0xC0, 0xFD, 0x1F, 0xFF, 0xE0, 0x0F, 0xD0, 0x05, 0x40, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x3F, 0x03, 0xFF, 0xFF, 0xE3, 0xF0,
-    0xFF, 0xD5, 0x7F, 0xBF, 0x2F, 0xE0, 0x00, 0x7F, 0xF3, 0xF8, 0x00, 0x02, 0xFF, 0x7F, 0x00, 0x00,
-    0x0F, 0xFB, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x1F, 0xF2, 0xFE,
-    0x00, 0x07, 0xFF, 0x0F, 0xFE, 0x5B, 0xFB, 0xF0, 0x3F, 0xFF, 0xFD, 0x7F, 0x00, 0x7F, 0xFF, 0x47,
-    0xF0, 0x00, 0x15, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x55, 0xFC, 0x0B, 0xFF, 0xFC,
-    0x3F, 0xFE, 0xFC, 0xFF, 0xA9, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x01, 0xFF, 0xFF, 0xE4,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xE5, 0x16, 0xF0, 0x3F, 0x40, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x20, 0x00, 0x02, 0xFC,
-    0x3F, 0x95, 0x5F, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x5F, 0xF5, 0x55, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF9, 0x54, 0x01, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40,
-    0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F,
-    0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00,
-    0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3,
-    0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE, 0x3F, 0x00,
-    0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0F,
-    0xE0, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0x3F, 0x80,
-    0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x47, 0xF0, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x0B, 0xEF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFC,
-    0x3F, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF4, 0x2F,
-    0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x1F, 0x7F, 0x00, 0x0B, 0xF0, 0x0F, 0xD0,
-    0x03, 0xF2, 0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x3F, 0x1F, 0x80, 0x0F, 0xC0, 0x0B, 0xF0, 0x07,
-    0xE0, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0xBD, 0x0F, 0xC0, 0x2F, 0x80, 0x03, 0xF4, 0x0F, 0xC0,
-    0xBE, 0x03, 0xF4, 0x00, 0x2F, 0x81, 0xF8, 0x07, 0xF0, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x40, 0x3F,
-    0x07, 0xF0, 0x00, 0x0F, 0xC3, 0xF0, 0x02, 0xF4, 0xBE, 0x00, 0x00, 0xFD, 0x3E, 0x00, 0x1F, 0x8F,
-    0xD0, 0x00, 0x0B, 0xE7, 0xD0, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0x00, 0x0F, 0xDF, 0x80,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x03, 0xF8,
-    0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x82,
-    0xFC, 0x00, 0x00, 0x1F, 0xD7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x1F, 0xD0,
-    0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80,
-    0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00,
-    0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F,
-    0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBB,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x57, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xA8, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x2B, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x2F, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x6F, 0x00, 0x29, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x00, 0xA9, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xC0,
-    0x03, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x00, 0xB9, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xE3, 0xFF, 0xFF, 0xFA, 0x6F, 0x8F,
-    0x40, 0x7F, 0xFF, 0xFD, 0x20, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03,
-    0xFC, 0x3F, 0xD7, 0xFD, 0x3F, 0xC0, 0xA0, 0x00, 0x00, 0x00, 0x05, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
-    0x1F, 0x41, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x42, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x3F,
-    0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFF, 0xEF, 0xF8, 0x0F, 0xF8, 0x00, 0x10, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x01, 0x7C,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFA, 0xBF, 0xE0,
-    0x00, 0x7F, 0x80, 0x01, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x56, 0xFE, 0x55,
-    0x54, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x04, 0x00, 0x00, 0x01, 0x03, 0xD0, 0x5A, 0x40,
-    0xF8, 0x7F, 0x7F, 0xFF, 0xBF, 0x81, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xF4, 0x02, 0xFC, 0x00, 0xFC,
-    0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x1F,
-    0x02, 0xF0, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x0B, 0xE0,
-    0x01, 0xFC, 0x00, 0xFF, 0xE5, 0xBF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x47, 0xE1, 0xBF, 0xE1, 0xFC,
-    0x28, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x4F, 0xE0,
-    0x00, 0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x03, 0xF0,
-    0x00, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8,
-    0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0xFD,
-    0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x1A, 0xAF, 0xFF, 0xAA, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xAA, 0xBF,
-    0xEA, 0xA0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x29, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x00, 0x00, 0x5A,
-    0xA9, 0x00, 0x1F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0x00, 0x78, 0x7F, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xBF, 0xF4, 0x0F, 0xD0, 0x1F, 0xF8, 0x3E, 0x00, 0x0B, 0xF5, 0xF4,
-    0x00, 0x0B, 0xE7, 0xD0, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x3E, 0x3F, 0xC0, 0x01, 0xF4, 0x7F, 0xE0,
-    0x0F, 0xC0, 0x3F, 0xFE, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFA, 0x40, 0x00, 0x0F, 0xDF,
-    0xE9, 0x56, 0xFF, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x10, 0x3F, 0x00, 0xFC, 0x7F, 0x01, 0xFC, 0x3F, 0x00, 0xFC, 0x04, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x06, 0xA9, 0x00, 0x3F,
-    0x00, 0x1F, 0x00, 0x0F, 0xFF, 0xF8, 0x03, 0xD0, 0x0F, 0x40, 0x0F, 0xFE, 0xFD, 0x00, 0x7C, 0x07,
-    0xC0, 0x0F, 0xE0, 0x01, 0x00, 0x0F, 0x42, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0xF4, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xD3, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF4, 0xF0, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x3D, 0x3C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xC2, 0xE0, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xF8, 0x0F,
-    0x40, 0x2F, 0xE5, 0xAD, 0x00, 0x7C, 0x01, 0xF0, 0x02, 0xFF, 0xFF, 0x40, 0x3E, 0x00, 0x3F, 0x00,
-    0x0B, 0xFE, 0x40, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF9, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFE, 0xAF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x03, 0xFF, 0xFF, 0x06, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xE0, 0x6F, 0xFF, 0x8F, 0xFA, 0xBE, 0xBD, 0x00, 0xFB, 0xE0, 0x03, 0xEF, 0x80, 0x1F, 0xAF,
-    0x96, 0xFE, 0x3F, 0xFE, 0x78, 0x1A, 0x40, 0x40, 0x00, 0x05, 0x00, 0x04, 0x00, 0x03, 0xE0, 0x0B,
-    0xD0, 0x03, 0xF4, 0x0B, 0xF0, 0x03, 0xF8, 0x07, 0xF0, 0x02, 0xFC, 0x03, 0xF4, 0x02, 0xFC, 0x03,
-    0xF8, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x0B, 0xF0,
-    0x0F, 0xE0, 0x00, 0xBF, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0xFE, 0x02, 0xFC, 0x00,
-    0x0F, 0xD0, 0x2F, 0xC0, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x24, 0x00, 0x20, 0x2A, 0xAA, 0xAA, 0xAA,
-    0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0x9B, 0xFF, 0xFE, 0xBF, 0xFF, 0xE1, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x01, 0xAA, 0xA4, 0x00, 0x3F, 0x00, 0x1F, 0x00,
-    0xBF, 0xFF, 0xE0, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0xFF, 0xFD, 0x00, 0x7C, 0x07, 0xC0, 0x0B, 0xD0,
-    0x1F, 0xC0, 0x0F, 0x42, 0xE0, 0x02, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0xF4, 0x00, 0xBD, 0x00, 0xBC,
-    0x00, 0x3C, 0x3C, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x0F, 0x0F, 0x00, 0x0B, 0xD0, 0x3F, 0x80, 0x03,
-    0xD3, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3D, 0x3C,
-    0x00, 0x2F, 0x97, 0xF0, 0x00, 0x0F, 0x0F, 0x40, 0x0B, 0xD0, 0xBD, 0x00, 0x03, 0xC2, 0xE0, 0x02,
-    0xF4, 0x0F, 0xC0, 0x01, 0xF0, 0x7C, 0x00, 0xBD, 0x02, 0xF8, 0x00, 0xF8, 0x0F, 0x40, 0x2F, 0x40,
-    0x3F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xD0, 0x07, 0xF0, 0x3E, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0xBD,
-    0x2F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF9, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFE, 0xAF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x1F, 0xFF, 0xF4, 0x3F, 0x41, 0xFC, 0xBC, 0x00, 0x3E, 0xF8, 0x00, 0x2F, 0xF8,
-    0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xBC, 0x00, 0x3E, 0x3E, 0x00, 0xBD, 0x2F, 0xFF, 0xF8, 0x07, 0xFF,
-    0xD0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2A, 0xAA, 0xFE, 0xAA, 0xA4, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x01, 0xFF, 0x90, 0x1F, 0xFF, 0xF4, 0x2F, 0x91, 0xFC, 0x08, 0x00, 0x7D, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFD, 0x15, 0x55, 0x54, 0x02, 0xFF, 0x90, 0x0B, 0xFF, 0xFD, 0x03, 0xF4, 0x1F, 0xC0, 0x10,
-    0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x0F, 0xFF, 0x80, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x04,
-    0x00, 0x1F, 0x87, 0xE9, 0x6F, 0xC1, 0xFF, 0xFF, 0xD0, 0x06, 0xAA, 0x40, 0x00, 0x00, 0xAA, 0x00,
-    0xBF, 0x40, 0x3F, 0x80, 0x3F, 0x80, 0x2F, 0x80, 0x1F, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD,
-    0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00,
-    0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x00, 0x1F,
-    0xCF, 0xE0, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x0F, 0xFC, 0xFF, 0xF9,
-    0x5B, 0xEF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFD, 0x7F, 0xFD, 0x0B, 0xCF, 0xD0, 0x54, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6A, 0xAA, 0xA4, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF,
-    0xFE, 0xAF, 0x87, 0xFF, 0xFF, 0xE0, 0x2E, 0x3F, 0xFF, 0xFF, 0x80, 0xB9, 0xFF, 0xFF, 0xFE, 0x02,
-    0xEB, 0xFF, 0xFF, 0xF8, 0x0B, 0xBF, 0xFF, 0xFF, 0xE0, 0x2E, 0xFF, 0xFF, 0xFF, 0x80, 0xBB, 0xFF,
-    0xFF, 0xFE, 0x02, 0xEF, 0xFF, 0xFF, 0xF8, 0x0B, 0xBF, 0xFF, 0xFF, 0xE0, 0x2E, 0xFF, 0xFF, 0xFF,
-    0x80, 0xBA, 0xFF, 0xFF, 0xFE, 0x02, 0xE7, 0xFF, 0xFF, 0xF8, 0x0B, 0x8F, 0xFF, 0xFF, 0xE0, 0x2E,
-    0x1F, 0xFF, 0xFF, 0x80, 0xB8, 0x1F, 0xFF, 0xFE, 0x02, 0xE0, 0x0B, 0xFF, 0xF8, 0x0B, 0x80, 0x00,
-    0x02, 0xE0, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0xB8,
-    0x0B, 0x80, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x2E, 0x02, 0xE0,
-    0x00, 0x00, 0xB8, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00,
-    0x2E, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x0B, 0x80,
-    0xB8, 0x00, 0x00, 0x1D, 0x01, 0xD0, 0x05, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x03,
-    0xD0, 0x07, 0xC0, 0x0F, 0xF4, 0x06, 0xFD, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7E, 0x7F, 0xFC, 0x7F,
-    0xE0, 0x00, 0x2A, 0x01, 0xFF, 0x0B, 0xFF, 0x3F, 0xAF, 0x3D, 0x2F, 0x10, 0x2F, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x3F, 0x00, 0xBC, 0x7C,
-    0x00, 0x3D, 0xB8, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xB8, 0x00, 0x2F, 0xBC, 0x00,
-    0x3E, 0x3D, 0x00, 0x7D, 0x2F, 0x96, 0xF8, 0x0B, 0xFF, 0xE0, 0x00, 0x69, 0x00, 0x04, 0x00, 0x04,
-    0x00, 0x0F, 0x80, 0x2F, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x03, 0xF4,
-    0x0F, 0xE0, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0xFF, 0x01, 0xFD, 0x00,
-    0x2F, 0xC0, 0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x80, 0x1F, 0xD0, 0x3F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC0,
-    0x0F, 0xE0, 0x1F, 0xC0, 0x0B, 0xF0, 0x1F, 0xD0, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x20, 0x00, 0x60,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xDB, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x3C, 0x2F, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0xBF, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xFD, 0x00,
-    0x03, 0xF0, 0x2F, 0x00, 0x3E, 0xF4, 0x00, 0x0F, 0xC1, 0xF8, 0x02, 0xE7, 0xD0, 0x00, 0x05, 0x0F,
-    0xC0, 0x1F, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0xF4, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0x82,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x03, 0xD0, 0x2F, 0x40, 0x00,
-    0x0F, 0xC0, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xBD, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xE0, 0x01,
-    0x55, 0x5B, 0xE4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0xCF, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x1F, 0x40, 0x15, 0x00, 0x00, 0x0F, 0x40, 0x3F, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0x40, 0xBD,
-    0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0x40, 0xF8, 0x2E, 0x00, 0xFC, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00,
-    0x7D, 0x00, 0x0F, 0x47, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x05, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x95, 0x54, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xB9, 0x07, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0xF8, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0xFE, 0x05, 0x00, 0x0B, 0xE0, 0x7D, 0x00,
-    0xFF, 0x81, 0xFE, 0xAF, 0xF0, 0x3F, 0x00, 0xBB, 0xE0, 0x7F, 0xFF, 0xF0, 0x2F, 0x00, 0x7C, 0xF8,
-    0x00, 0x6A, 0x40, 0x0F, 0x80, 0x3D, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x2E, 0x0F, 0x80, 0x00,
-    0x00, 0x07, 0xD0, 0x1F, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0xF8, 0x00, 0x00, 0x02,
-    0xF0, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7D, 0x00, 0x15, 0x56, 0xFD, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x7C, 0x0F, 0xFF, 0xAF, 0xFD, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00,
-    0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00,
-    0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE,
-    0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00,
-    0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x64, 0x00,
-    0x24, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x78, 0x00, 0x00, 0x0F, 0xFF, 0xF6, 0xF4, 0x00, 0x00, 0x2F,
-    0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4,
-    0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0,
-    0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00,
-    0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x40, 0x01, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03,
-    0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF,
-    0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x0F, 0xE5, 0x55, 0x54, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE5, 0x55, 0x54, 0x00, 0x0B,
-    0xF5, 0x55, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xD0, 0x00, 0x6E, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x05, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55,
-    0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55,
-    0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFE, 0x3F,
-    0x80, 0x02, 0xF8, 0x0F, 0xD0, 0x0B, 0xD0, 0x02, 0xF4, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55,
-    0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x50, 0x01, 0x40, 0x02, 0xF4, 0x0B, 0xD0, 0x03, 0xF8, 0x0B, 0xE0, 0x02, 0xF4, 0x07,
-    0xD0, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55,
-    0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x6A, 0x40, 0x00,
-    0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x06, 0xFF, 0xE4, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x1B, 0xF9, 0x07, 0xFF, 0xFF, 0x2F, 0xFF, 0xFC,
-    0x00, 0x02, 0xA8, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x07, 0xD0,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x06, 0xFF,
-    0xE4, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x1B, 0xF9, 0x07, 0xFF, 0xFF,
-    0x2F, 0xFF, 0xFC, 0x00, 0x6A, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0x8F, 0xD0,
-    0x2F, 0x80, 0xFD, 0x2F, 0x40, 0x0B, 0xD5, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x6F,
-    0xE4, 0x01, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x14, 0x00, 0x52, 0xF4, 0x0B, 0xDF, 0xE0, 0x3F,
-    0xAF, 0x40, 0xBD, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xC1, 0xBF, 0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x06, 0xFE, 0x41, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xD0, 0x01, 0x6F,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xD0,
-    0x00, 0x00, 0x02, 0xFC, 0xAB, 0xFE, 0xAA, 0x80, 0x00, 0x7F, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xD0,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xFD, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x6F, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x90,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x60, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x00, 0x00, 0x3F, 0xFF,
-    0xE7, 0xE0, 0x00, 0x03, 0xD1, 0xFF, 0xFC, 0x00, 0x00, 0x78, 0x01, 0xFF, 0x40, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x03, 0xE7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xF7, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xF7, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x7E,
-    0x7F, 0x80, 0x00, 0x07, 0xF7, 0xE2, 0xFC, 0x00, 0x00, 0x7F, 0x7E, 0x0F, 0xF0, 0x00, 0x07, 0xF7,
-    0xE0, 0x7F, 0x80, 0x00, 0x7F, 0x7E, 0x02, 0xFC, 0x00, 0x07, 0xF7, 0xE0, 0x0F, 0xF0, 0x00, 0x7F,
-    0x7F, 0x00, 0x7F, 0x40, 0x07, 0xF7, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x7F, 0x00, 0x0F, 0xE0, 0x07,
-    0xF7, 0xF0, 0x00, 0x7F, 0x40, 0x7F, 0x7F, 0x00, 0x03, 0xFC, 0x07, 0xF7, 0xF0, 0x00, 0x0F, 0xE0,
-    0x3F, 0x7F, 0x00, 0x00, 0xBF, 0x43, 0xF7, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0x7F, 0x00, 0x00, 0x1F,
-    0xE3, 0xF7, 0xF0, 0x00, 0x00, 0xBF, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xF7, 0xF0, 0x00, 0x00,
-    0x1F, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x7F,
-    0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0B,
-    0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x7F,
-    0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x09,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0B, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x9B, 0xC0, 0x00, 0x00, 0x3E,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFE,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFD, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFD,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x03, 0xC7, 0xF4, 0x00, 0x03, 0xF8, 0xBF, 0x40, 0x03, 0xFC, 0x0B, 0xF4,
-    0x03, 0xFC, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x40,
-    0x03, 0xFC, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x0B, 0xF4, 0xFC, 0x00, 0x00,
-    0xBE, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x3F, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0x03, 0xF7, 0xF8, 0x3F, 0xC0, 0x00, 0x03,
-    0xF4, 0xBF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x1F, 0xD7, 0xF4, 0x00, 0x01, 0xFC, 0x03, 0xFA, 0xFC,
-    0x00, 0x00, 0xFD, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x7F, 0x00,
-    0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFE, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xBF, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0xEF, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0xF7, 0xF0, 0x0F, 0xD0, 0x00, 0x03,
-    0xF8, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x3F, 0xC7, 0xF0, 0x00, 0x00, 0xBF, 0x07, 0xF7, 0xF4,
-    0x00, 0x00, 0x3F, 0x80, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xE0,
-    0x02, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0x40, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0,
-    0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x0F, 0xF8,
-    0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFA, 0xAF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00,
-    0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00,
-    0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00,
-    0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00,
-    0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00,
-    0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0xBF, 0x40, 0x00, 0x03,
-    0xFC, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFA, 0xAF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xCB, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07,
-    0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F,
-    0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0xBF,
-    0x40, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFA, 0xAF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x04, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x00,
-    0x7E, 0x00, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0,
-    0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00,
-    0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00,
-    0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x1F, 0xD2, 0xFD, 0x00, 0x00,
-    0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xEA, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x01, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xD0,
-    0x00, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x80, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0x00, 0x01, 0xFF, 0x87, 0xF0, 0x00, 0x03, 0xFC, 0x7F,
-    0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00,
-    0xFE, 0x7F, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x3F, 0xC7, 0xF0,
-    0x00, 0x1F, 0xF4, 0x7F, 0xAA, 0xBF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x40,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF9, 0x01, 0xBF, 0xC0, 0x7F,
-    0x40, 0x00, 0x7F, 0x42, 0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00,
-    0x0F, 0xD0, 0xFD, 0x00, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x0F, 0xD0, 0x01, 0xFF, 0x00,
-    0x3F, 0x40, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x1F, 0xE0, 0x00, 0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xF4, 0x00, 0x3F,
-    0xF4, 0x0F, 0xD0, 0x00, 0x2F, 0xF8, 0x3F, 0x40, 0x00, 0x0F, 0xF8, 0xFD, 0x00, 0x00, 0x0B, 0xF7,
-    0xF4, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x14, 0x00, 0x0F, 0xEF, 0xD0, 0x7E, 0x55, 0xFF, 0x3F, 0x41, 0xFF, 0xFF,
-    0xF4, 0xFD, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F,
-    0x2F, 0xE0, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00,
-    0xBF, 0x3F, 0x40, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x2F, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F,
-    0x2F, 0xE0, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00,
-    0xBF, 0x3F, 0x40, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x2F, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x80, 0x00, 0xBE, 0x02, 0xF8,
-    0x00, 0x7E, 0x00, 0x2F, 0x80, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F,
-    0x2F, 0xE0, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00,
-    0xBF, 0x3F, 0x40, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x2F, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x19, 0x00, 0x06, 0x00,
-    0x2F, 0xF8, 0x03, 0xC0, 0x2F, 0xFF, 0xE6, 0xF0, 0x0F, 0x86, 0xFF, 0xF4, 0x03, 0xC0, 0x1F, 0xF8,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0x94, 0x6F, 0xF0, 0x02, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x1A, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xE9, 0x51, 0xFC, 0xBF, 0x80, 0x00, 0x7F,
-    0x3F, 0x80, 0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x00,
-    0xFF, 0x3F, 0xC0, 0x01, 0xFF, 0xCB, 0xFD, 0x57, 0xFB, 0xF0, 0xFF, 0xFF, 0xF8, 0xBC, 0x0B, 0xFF,
-    0xF4, 0x2F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x1F, 0x80, 0x7E, 0x00,
-    0x0B, 0xF0, 0x2F, 0xC0, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x2F, 0x94, 0x6F, 0xF0, 0x02, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1A, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xE9, 0x51, 0xFC, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x1F,
-    0xCF, 0xD0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x01,
-    0xFF, 0xCB, 0xFD, 0x57, 0xFB, 0xF0, 0xFF, 0xFF, 0xF8, 0xBC, 0x0B, 0xFF, 0xF4, 0x2F, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xF4, 0x7D, 0x00,
-    0x00, 0xB8, 0x0B, 0x80, 0x00, 0x2D, 0x01, 0xE0, 0x00, 0x07, 0x80, 0xF4, 0x00, 0x00, 0xFE, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xBE, 0x51, 0xBF, 0xC0, 0x08,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x6B, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xA5, 0x47,
-    0xF2, 0xFE, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x1F, 0xDF, 0xC0, 0x00,
-    0x0B, 0xF3, 0xF4, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x07, 0xFF, 0x2F, 0xF5, 0x5F, 0xEF, 0xC3, 0xFF,
-    0xFF, 0xE2, 0xF0, 0x2F, 0xFF, 0xD0, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-    0xFC, 0x00, 0x3F, 0x91, 0x7F, 0xEF, 0xE4, 0x6F, 0xE0, 0x01, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xD0, 0x01,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xE5,
-    0x43, 0xFE, 0xAA, 0xAA, 0xA9, 0x2F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xBF, 0xC0,
-    0x00, 0x14, 0x2F, 0xF5, 0x6F, 0xE1, 0xFF, 0xA5, 0xBF, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0x95, 0xBC, 0x1F,
-    0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40, 0xBF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0x90,
-    0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8,
-    0x7F, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0,
-    0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC,
-    0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA,
-    0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96,
-    0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x02, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xF2, 0xFC,
-    0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x7F, 0x00,
-    0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x02,
-    0xFC, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x17, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x3F,
-    0x87, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2A, 0x80, 0x07, 0xF8, 0x00, 0xBF, 0x00,
-    0x0B, 0xF0, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00,
-    0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00,
-    0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xAA, 0x00, 0x7F, 0x80,
-    0x3F, 0xC0, 0x2F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F,
-    0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD,
-    0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2A, 0x80,
-    0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x7F, 0x2F, 0xC0, 0x1F, 0xC0, 0xBF, 0x03, 0xE0,
-    0x01, 0xFC, 0x14, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x04, 0x00, 0x10, 0x3F, 0x00, 0xFC, 0x7F, 0x01, 0xFC, 0x3F, 0x00, 0xFC, 0x04,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xBC,
-    0x00, 0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0xBF, 0x80, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x34, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xAA, 0x43, 0xF4,
-    0x00, 0xFF, 0xFF, 0xE7, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x40, 0x0B, 0xFF, 0x4F, 0xF0,
-    0x00, 0x07, 0xFD, 0x7F, 0x00, 0x00, 0x07, 0xFA, 0xFC, 0x00, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x00,
-    0x3F, 0xBF, 0x40, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xDB,
-    0xE0, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0xBF, 0x40,
-    0x00, 0xBF, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x64, 0x00, 0x18, 0x00, 0x2F, 0xF8, 0x03, 0xD0, 0x07,
-    0xFF, 0xF9, 0xBC, 0x00, 0xF8, 0x2F, 0xFF, 0x40, 0x0F, 0x00, 0x2F, 0xE0, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0xFC, 0x1F, 0xFF, 0xF4, 0x0F, 0xCB,
-    0xFF, 0xFF, 0xD0, 0xFE, 0xFD, 0x56, 0xFF, 0x0F, 0xFD, 0x00, 0x07, 0xF8, 0xFF, 0x80, 0x00, 0x2F,
-    0xCF, 0xF0, 0x00, 0x01, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFE, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00,
-    0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD,
-    0xFE, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40,
-    0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00,
-    0x3F, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00,
-    0x7F, 0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F,
-    0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE,
-    0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00,
-    0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x3F,
-    0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F,
-    0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x14,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0,
-    0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE, 0x00,
-    0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00,
-    0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x3F, 0x0F,
-    0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F, 0xE5,
-    0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x06, 0x00, 0x03, 0xFF, 0x80, 0x3C, 0x00, 0x2F, 0xFF, 0xE7, 0xF0, 0x00,
-    0xF4, 0x7F, 0xFF, 0x40, 0x07, 0x80, 0x1F, 0xF4, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC,
-    0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00,
-    0x03, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0xFE,
-    0xBE, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBF, 0x0B, 0xF0,
-    0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x1F, 0xF9, 0x5B, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00,
-    0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x10,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x07,
-    0xF8, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00,
-    0x00, 0x3F, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0x0F,
-    0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0x03, 0xF5, 0xFC,
-    0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00,
-    0x3F, 0xC0, 0x1F, 0xF9, 0x5B, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xA9, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x0B, 0x00, 0x07, 0xFF, 0xFE, 0x7E, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFE,
-    0x56, 0xFF, 0x40, 0x7F, 0x80, 0x02, 0xFF, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x1F, 0xC0, 0x00, 0xFE,
-    0xFC, 0xBF, 0x00, 0x0B, 0xE3, 0xF3, 0xF8, 0x00, 0x7F, 0x0F, 0xDF, 0xE0, 0x03, 0xF0, 0x3F, 0xBF,
-    0x40, 0x3F, 0x40, 0xFE, 0xFD, 0x02, 0xF8, 0x03, 0xFB, 0xF8, 0x1F, 0xC0, 0x0F, 0xEB, 0xE0, 0xFC,
-    0x00, 0x3F, 0x6F, 0xCB, 0xE0, 0x00, 0xFD, 0x3F, 0xBF, 0x00, 0x0B, 0xF0, 0xFF, 0xF0, 0x00, 0x3F,
-    0x80, 0xFF, 0x40, 0x03, 0xFC, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFD,
-    0xBF, 0xFF, 0x80, 0x01, 0xD0, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40,
-    0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F,
-    0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00,
-    0x07, 0xFF, 0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40,
-    0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF,
-    0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF,
-    0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFC, 0xFE, 0x00, 0x00, 0x7E, 0x02,
-    0xF8, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40,
-    0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF,
-    0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0xBF, 0x02, 0xFC, 0x00,
-    0x07, 0xE0, 0x1F, 0x80, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F,
-    0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x01, 0xFF, 0x2F, 0xD0,
-    0x00, 0x7F, 0xF0, 0xFF, 0xD5, 0xBF, 0xBF, 0x07, 0xFF, 0xFF, 0xE3, 0xF0, 0x0B, 0xFF, 0xF4, 0x3F,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x07,
-    0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x1F, 0xC0,
-    0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00,
-    0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xBB, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x55, 0x00, 0x0F, 0xD1, 0xFF, 0xFE, 0x00,
-    0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xD5, 0x7F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00,
-    0x02, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0xFD, 0xFF,
-    0x80, 0x00, 0x2F, 0xCF, 0xFD, 0x00, 0x0B, 0xF8, 0xFF, 0xFE, 0x5B, 0xFF, 0x0F, 0xDB, 0xFF, 0xFF,
-    0xC0, 0xFD, 0x1F, 0xFF, 0xE0, 0x0F, 0xD0, 0x05, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x50, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x00, 0x7E, 0x01,
-    0xF8, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B,
-    0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0,
-    0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBB, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x55, 0x55,
-    0x54, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF8, 0x02,
-    0xF9, 0x46, 0xFF, 0x00, 0x20, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xAF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0x0B, 0xFE, 0x95, 0x1F, 0xCB, 0xF8, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x01, 0xFC, 0xFD, 0x00,
-    0x00, 0x7F, 0x7F, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x1F, 0xFC, 0xBF,
-    0xD5, 0x7F, 0xBF, 0x0F, 0xFF, 0xFF, 0x8B, 0xC0, 0xBF, 0xFF, 0x42, 0xF0, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE5, 0x6F,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F,
-    0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA,
-    0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0,
-    0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0xE0, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x0B, 0xE5, 0x6F, 0x80, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0x94, 0x6F,
-    0xF0, 0x02, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1A, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xE9, 0x51, 0xFC, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x07, 0xF7,
-    0xF0, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x01, 0xFF, 0xCB, 0xFD, 0x57, 0xFB,
-    0xF0, 0xFF, 0xFF, 0xF8, 0xBC, 0x0B, 0xFF, 0xF4, 0x2F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0x94, 0x6F, 0xF0, 0x00, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x01,
-    0xAF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xE9, 0x51, 0xFC, 0x2F, 0xE0, 0x00, 0x1F,
-    0xC3, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x02, 0xFC, 0x3F, 0x40,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x1F, 0xFC, 0x2F, 0xF5, 0x5F, 0xEF, 0xC0, 0xFF, 0xFF, 0xF8, 0xBC,
-    0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x00, 0x54, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xD0, 0x00,
-    0x6E, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0x95, 0xBC, 0x1F, 0xE0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40, 0xBF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0xFD,
-    0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xD0, 0x00, 0x6E, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x2F,
-    0xFF, 0xAA, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x2F, 0xCB, 0xE0, 0x01, 0xFC, 0x0B, 0xE0, 0x1F, 0x80, 0x07, 0xE0, 0x10, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0x95,
-    0xBC, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40, 0xBF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF,
-    0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0x40, 0x01, 0xB8, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x14, 0x00, 0xBF, 0xFE,
-    0xAB, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15,
-    0x50, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x7F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0xBF, 0xE5, 0x6F, 0x07, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x10,
-    0x2F, 0xFA, 0x6B, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x0A, 0x40, 0x00, 0xA4, 0x00, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00,
-    0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xD0, 0x00, 0x6E, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x2F, 0xFF, 0xAA,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0xA8, 0x0F, 0xD0, 0x0F, 0xD0, 0x0F, 0xD0, 0xFD, 0x00, 0x0F, 0xEF,
-    0xD0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0x95, 0xBC, 0x1F,
-    0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40, 0xBF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xE0, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0xA8, 0x00, 0x0A, 0x80, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0x00, 0x05, 0xBF, 0xF4, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x7F,
-    0x00, 0x00, 0x00, 0x2F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0,
-    0x00, 0x00, 0x07, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0x00, 0x01, 0xBF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x69, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xF2, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF1, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x05, 0x50, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x47, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xE7, 0xF0, 0x00, 0x0F, 0xFD, 0x56, 0xFF, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xF0, 0x00,
-    0x3F, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFE,
-    0x5B, 0xFB, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xD3, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x43, 0xF0, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xD0, 0x01, 0x6F, 0xFD, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x7F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0x02,
-    0xFC, 0xAB, 0xFE, 0xAA, 0x80, 0x00, 0x7F, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xCF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x0F, 0xD0, 0x00,
-    0x00, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x6F, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x15, 0x55, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0x50, 0x07, 0xF0, 0x00, 0x1F,
-    0xFF, 0xD1, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x3F, 0xF9, 0x6F, 0xEF, 0xC0, 0x2F, 0xE0,
-    0x00, 0x7F, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00,
-    0x00, 0x7F, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00,
-    0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x00,
-    0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xE5, 0xBF, 0xBF, 0x00, 0x0F, 0xFF, 0xFF,
-    0x4F, 0xC0, 0x00, 0x7F, 0xFF, 0x43, 0xF0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x50, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55,
-    0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x01, 0x55, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x15,
-    0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x17, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80,
-    0x00, 0x3F, 0x87, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07, 0x80, 0x00, 0xB0, 0x03,
-    0xC0, 0x01, 0xF0, 0x03, 0xF9, 0x5B, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0x00, 0x74, 0x00, 0x3D, 0x00, 0x0F, 0x40,
-    0x02, 0xF9, 0x5B, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x17, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00,
-    0x3F, 0x87, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x17, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x3F,
-    0x87, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03,
-    0xF8, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00,
-    0x1F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x5F, 0x80, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0x00, 0xA8, 0x07, 0xF0, 0x07, 0xF0, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x06, 0x80, 0x00, 0xA8, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x03, 0xFB,
-    0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x7F,
-    0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD7, 0xF4, 0x00, 0x00, 0x00,
-    0xFD, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE4, 0x00,
-    0x07, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFE, 0xBF, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x40,
-    0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x81, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x02,
-    0xFF, 0x80, 0x00, 0x03, 0xF8, 0x02, 0xFF, 0xFA, 0xAA, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x6F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x03, 0xF5, 0xFD, 0x00, 0x00, 0xFD,
-    0x07, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x3F, 0x03, 0xFF, 0xFF, 0xE3, 0xF0, 0xFF, 0xD5,
-    0x7F, 0xBF, 0x1F, 0xE0, 0x00, 0x7F, 0xF3, 0xF8, 0x00, 0x02, 0xFF, 0x7F, 0x00, 0x00, 0x0F, 0xFB,
-    0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07,
-    0xFF, 0x0F, 0xFD, 0x57, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x7F, 0xFF, 0x47, 0xF0, 0x00,
-    0x15, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x02, 0xFC, 0x1E, 0x40, 0x00, 0xBF, 0x81, 0xFF, 0xFB, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x38, 0x00, 0x00, 0x07, 0xC0,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0xE5, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF9, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xEB, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFE, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xD0,
-    0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0xFE, 0x00,
-    0xBF, 0xFE, 0xAA, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x38, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x00,
-    0xFE, 0x5B, 0xF4, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x3F,
-    0xFF, 0xFE, 0x3F, 0x0F, 0xFD, 0x57, 0xFB, 0xF1, 0xFE, 0x00, 0x07, 0xFF, 0x3F, 0x80, 0x00, 0x2F,
-    0xF7, 0xF0, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00,
-    0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xF0, 0xFF, 0xD5, 0x7F, 0xFF, 0x03, 0xFF, 0xFF, 0xE7, 0xF0,
-    0x07, 0xFF, 0xF4, 0x7F, 0x00, 0x01, 0x50, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xE4, 0x00, 0x0B, 0xF8, 0x1F,
-    0xFF, 0xBF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF9, 0x00,
-    0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xEB, 0xF0, 0x00, 0x02, 0xFF,
-    0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xD0,
-    0x00, 0x00, 0x03, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0x80,
-    0xBF, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0xFE, 0xAA, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x3F, 0xFF, 0xFE, 0x3F, 0x0F, 0xFD, 0x57, 0xFB, 0xF1, 0xFE, 0x00,
-    0x07, 0xFF, 0x3F, 0x80, 0x00, 0x2F, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0xBF, 0x7F,
-    0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xF0, 0xFF, 0xD5, 0x7F,
-    0xFF, 0x03, 0xFF, 0xFF, 0xE7, 0xF0, 0x07, 0xFF, 0xF4, 0x7F, 0x00, 0x01, 0x50, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xC1, 0xE4, 0x00, 0x0B, 0xF8, 0x1F, 0xFF, 0xBF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE4, 0x00, 0x07, 0xC0,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0xBF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x8F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x40, 0x00, 0x00,
-    0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x81, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x02, 0xFF, 0x80,
-    0x00, 0x03, 0xF8, 0x02, 0xFF, 0xFA, 0xAA, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x6F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x0B, 0xFF, 0xF4, 0x3F, 0x03, 0xFF, 0xFF, 0xE3, 0xF0, 0xFF, 0xD5, 0x7F, 0xBF, 0x1F, 0xE0,
-    0x00, 0x7F, 0xF3, 0xF8, 0x00, 0x02, 0xFF, 0x7F, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x0B, 0xF7,
-    0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x57,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x7F, 0xFF, 0x47, 0xF0, 0x00, 0x15, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02,
-    0xFC, 0x1E, 0x40, 0x00, 0xBF, 0x81, 0xFF, 0xFB, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x1B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x03,
-    0xF0, 0x01, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F,
-    0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x7F, 0x55, 0x55, 0x55, 0x6F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x15, 0x40, 0x00, 0x00, 0xFD, 0x1F, 0xFF, 0xF4,
-    0x00, 0x03, 0xF6, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xEF, 0xE5, 0x6F, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x1F, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x56, 0xFD, 0x55, 0x55, 0x55, 0x7F,
-    0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x56,
-    0xFD, 0x55, 0x55, 0x55, 0xBF, 0x55, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFD, 0x55, 0x55, 0x55,
-    0xBF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x01, 0xFE, 0xAA, 0xAA, 0xAA, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0x7F, 0x95, 0x55, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xAA, 0x40, 0x00,
-    0x3F, 0x4B, 0xFF, 0xFE, 0x00, 0x0F, 0xDF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xE4, 0x07, 0xFD, 0x00,
-    0xFF, 0xC0, 0x00, 0x3F, 0x80, 0x3F, 0xD0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0xFC, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x03, 0xF0, 0x0F,
-    0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x40, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0xFD,
-    0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x01, 0x90, 0x00, 0x60, 0x3F, 0xF8, 0x03, 0xC2, 0xFF, 0xFE, 0x7F, 0x0F,
-    0x47, 0xFF, 0xF4, 0x78, 0x01, 0xFF, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x6F, 0xE4, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x54, 0x00, 0x24, 0x1F, 0xFD, 0x02, 0xE0,
-    0xFF, 0xFE, 0x6F, 0x0B, 0x82, 0xFF, 0xF8, 0x3C, 0x00, 0xBF, 0x80, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x06, 0xFF, 0xE4, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xBF, 0x90, 0x1F, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFC, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x74, 0x00, 0x0B, 0x1F, 0x00, 0x07, 0xC3, 0xF9, 0x5B, 0xE0, 0x7F, 0xFF, 0xF0, 0x07,
-    0xFF, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0x00, 0x6F, 0xFE, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xBF, 0x90, 0x07, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xC0, 0x2C, 0x00, 0x07, 0x4F, 0x40, 0x03, 0xD1, 0xF9, 0x5B, 0xF0, 0x3F, 0xFF,
-    0xF4, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x7F,
-    0xFF, 0xF2, 0xFF, 0xFF, 0xC1, 0xBF, 0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x06, 0xFE, 0x41, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x01,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x3F, 0x80, 0xFF, 0x03, 0xF8, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x3F, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xD0,
-    0x3F, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x40,
-    0xFD, 0x03, 0xF4, 0x0B, 0x80, 0xBC, 0x07, 0xC0, 0x3F, 0x00, 0xF8, 0x03, 0xF0, 0x0B, 0xFF, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x64, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC1, 0xBF,
-    0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x06, 0xFE, 0x41, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x7F, 0xFF, 0xF0, 0x02, 0xF6, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xE1, 0xBF, 0xF9, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03,
-    0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x7F, 0x00,
-    0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x3F,
-    0x80, 0x7F, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x1F,
-    0xC0, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00,
-    0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFE, 0x06, 0xFE, 0x40, 0x03, 0xF9,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xEB, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x01, 0x90, 0xFE, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFC, 0x09,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x03, 0xF0, 0xFD, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x40, 0x03,
-    0xF0, 0xFD, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x40, 0x03, 0xF0,
-    0xFD, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x40, 0x03, 0xF0, 0xFD,
-    0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x40, 0x03, 0xF0, 0xFD, 0x00,
-    0x0F, 0xC3, 0xF4, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0x5F, 0xD0, 0x03, 0xF4, 0x1F, 0xC0, 0x3F, 0x00,
-    0x0F, 0xC0, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xA0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x7F, 0x2F, 0xC0, 0x07,
-    0xF0, 0x2F, 0xC0, 0x3E, 0x00, 0x1F, 0xC0, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x01, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x01, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF0,
-    0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xC0,
-    0x7F, 0x40, 0x00, 0x07, 0xF0, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x3F,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x47,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xC0, 0x0F, 0xF4, 0x00, 0x07, 0xF0, 0x00,
-    0xFF, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00,
-    0x0B, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x8F, 0xD0, 0x00, 0x7F, 0x83, 0xF4, 0x00, 0x3F, 0x80, 0xFD,
-    0x00, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x80, 0x0F, 0xD0, 0x3F, 0xC0, 0x03, 0xF4, 0x3F, 0xC0, 0x00,
-    0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0x8B, 0xF4, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x03, 0xF4, 0x01,
-    0xFE, 0x00, 0xFD, 0x00, 0x2F, 0xD0, 0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x3F, 0xC3, 0xF4,
-    0x00, 0x07, 0xF8, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x8F, 0xE0, 0x00, 0x7F, 0x83, 0xF8, 0x00, 0x3F, 0xC0, 0xFE,
-    0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x0F, 0xE0, 0x2F, 0xD0, 0x03, 0xF8, 0x1F, 0xD0, 0x00,
-    0xFE, 0x1F, 0xE0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x0F, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xD7, 0xF4, 0x00, 0x3F, 0xD0, 0xBF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x03, 0xF8, 0x01,
-    0xFE, 0x00, 0xFE, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xE0, 0x00, 0x3F, 0xC3, 0xF8,
-    0x00, 0x07, 0xF8, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x01, 0xAA, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xAA, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x0F, 0xD0, 0x03, 0xF4,
-    0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00,
-    0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1A, 0x03, 0xF4, 0x3F,
-    0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43,
-    0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4,
-    0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xA8, 0x0F, 0xC1, 0xF8, 0x2F,
-    0x03, 0xD0, 0x7C, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00,
-    0xFC, 0x7F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x01, 0xF0, 0x7F, 0x00, 0x02, 0xD0, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x68, 0x06, 0x9F, 0xD0, 0xFD, 0xFD, 0x0F, 0xCF, 0xD0, 0xF8, 0xFD, 0x1F, 0x0F, 0xD2, 0xE0,
-    0xFD, 0x14, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x06, 0x40, 0x7F, 0x00, 0x1F, 0xC0, 0x7F, 0x00,
-    0x2F, 0xC0, 0x7F, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x06, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x68, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD,
-    0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4,
-    0x00, 0xFD, 0x0A, 0x3F, 0x4F, 0xEF, 0xD3, 0xFB, 0xF4, 0xFE, 0xFD, 0x09, 0x3F, 0x40, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x78, 0x00, 0x00, 0x7F, 0x0F, 0xF0,
-    0x00, 0x01, 0xFE, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x5F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xA8, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x10, 0x00, 0xFD, 0xF4,
-    0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x2E,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0xD0, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0x7F, 0xF8, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x7E, 0xFF, 0x00,
-    0x00, 0x07, 0xF7, 0xE7, 0xF8, 0x00, 0x00, 0x7F, 0x7E, 0x2F, 0xC0, 0x00, 0x07, 0xF7, 0xE0, 0xFF,
-    0x00, 0x00, 0x7F, 0x7E, 0x07, 0xF8, 0x00, 0x07, 0xF7, 0xE0, 0x2F, 0xC0, 0x00, 0x7F, 0x7E, 0x00,
-    0xFF, 0x00, 0x07, 0xF7, 0xF0, 0x07, 0xF4, 0x00, 0x7F, 0x7F, 0x00, 0x3F, 0xC0, 0x07, 0xF7, 0xF0,
-    0x00, 0xFE, 0x00, 0x7F, 0x7F, 0x00, 0x07, 0xF4, 0x07, 0xF7, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x7F,
-    0x00, 0x00, 0xFE, 0x03, 0xF7, 0xF0, 0x00, 0x0B, 0xF4, 0x3F, 0x7F, 0x00, 0x00, 0x3F, 0xC3, 0xF7,
-    0xF0, 0x00, 0x01, 0xFE, 0x3F, 0x7F, 0x00, 0x00, 0x0B, 0xF7, 0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0x7F, 0x00, 0x00, 0x01, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x0F, 0xC1,
-    0xFF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF, 0xFD, 0x0F, 0xEF, 0xD5, 0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F,
-    0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x00, 0xFC, 0xFE, 0x00,
-    0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xE7, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x7F,
-    0xFD, 0x00, 0x00, 0x07, 0xF7, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x7E, 0x7F, 0x80, 0x00, 0x07, 0xF7,
-    0xE2, 0xFC, 0x00, 0x00, 0x7F, 0x7E, 0x0F, 0xF0, 0x00, 0x07, 0xF7, 0xE0, 0x7F, 0x80, 0x00, 0x7F,
-    0x7E, 0x02, 0xFC, 0x00, 0x07, 0xF7, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x40, 0x07,
-    0xF7, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x7F, 0x00, 0x0F, 0xE0, 0x07, 0xF7, 0xF0, 0x00, 0x7F, 0x40,
-    0x7F, 0x7F, 0x00, 0x03, 0xFC, 0x07, 0xF7, 0xF0, 0x00, 0x0F, 0xE0, 0x3F, 0x7F, 0x00, 0x00, 0xBF,
-    0x43, 0xF7, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0x7F, 0x00, 0x00, 0x1F, 0xE3, 0xF7, 0xF0, 0x00, 0x00,
-    0xBF, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x7F, 0x00, 0x00,
-    0x00, 0xBF, 0xF7, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x0F, 0xC1, 0xFF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF, 0xFD, 0x0F, 0xEF, 0xD5, 0x6F,
-    0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF0,
-    0x00, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F,
-    0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x29, 0x00, 0x02, 0x90, 0x00, 0x01, 0xF8, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0xD0, 0x00,
-    0x00, 0x07, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF8, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0xD0,
-    0x00, 0x00, 0x7F, 0x7E, 0xFF, 0x00, 0x00, 0x07, 0xF7, 0xE7, 0xF8, 0x00, 0x00, 0x7F, 0x7E, 0x2F,
-    0xC0, 0x00, 0x07, 0xF7, 0xE0, 0xFF, 0x00, 0x00, 0x7F, 0x7E, 0x07, 0xF8, 0x00, 0x07, 0xF7, 0xE0,
-    0x2F, 0xC0, 0x00, 0x7F, 0x7E, 0x00, 0xFF, 0x00, 0x07, 0xF7, 0xF0, 0x07, 0xF4, 0x00, 0x7F, 0x7F,
-    0x00, 0x3F, 0xC0, 0x07, 0xF7, 0xF0, 0x00, 0xFE, 0x00, 0x7F, 0x7F, 0x00, 0x07, 0xF4, 0x07, 0xF7,
-    0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x7F, 0x00, 0x00, 0xFE, 0x03, 0xF7, 0xF0, 0x00, 0x0B, 0xF4, 0x3F,
-    0x7F, 0x00, 0x00, 0x3F, 0xC3, 0xF7, 0xF0, 0x00, 0x01, 0xFE, 0x3F, 0x7F, 0x00, 0x00, 0x0B, 0xF7,
-    0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x7F, 0x00, 0x00, 0x01, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x0A, 0x80, 0x00, 0xA8,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x1F, 0xD0, 0x00, 0x07, 0xFB, 0xF4, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x0F, 0xC1, 0xFF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF, 0xFD, 0x0F, 0xEF, 0xD5,
-    0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xCF,
-    0xF0, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00,
-    0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD,
-    0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00,
-    0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x55, 0x00, 0x1F, 0x43, 0xE0, 0xBF, 0xFF, 0x80, 0xBC, 0x0F, 0xCF,
-    0xFF, 0xFF, 0xC1, 0x40, 0x3F, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x03,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF0,
-    0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00,
-    0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x03,
-    0xE7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xF7, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x7E, 0x3F, 0x80, 0x00,
-    0x07, 0xF7, 0xE2, 0xFD, 0x00, 0x00, 0x7F, 0x7E, 0x0F, 0xF0, 0x00, 0x07, 0xF7, 0xE0, 0x3F, 0x80,
-    0x00, 0x7F, 0x7E, 0x02, 0xFD, 0x00, 0x07, 0xF7, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0x7F, 0x00, 0x3F,
-    0x80, 0x07, 0xF7, 0xF0, 0x01, 0xFD, 0x00, 0x7F, 0x7F, 0x00, 0x0F, 0xF0, 0x07, 0xF7, 0xF0, 0x00,
-    0x3F, 0x80, 0x7F, 0x7F, 0x00, 0x01, 0xFD, 0x07, 0xF7, 0xF0, 0x00, 0x0B, 0xF0, 0x3F, 0x7F, 0x00,
-    0x00, 0x3F, 0x83, 0xF7, 0xF0, 0x00, 0x01, 0xFD, 0x3F, 0x7F, 0x00, 0x00, 0x0B, 0xF3, 0xF7, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0x7F, 0x00, 0x00, 0x01, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x0F, 0xC1, 0xFF, 0xFF, 0x40, 0xFC, 0x7F, 0xFF, 0xFE, 0x0F, 0xEF, 0xE5, 0x6F, 0xF4, 0xFF, 0xD0,
-    0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x00, 0xFC,
-    0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00,
-    0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x1F,
-    0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xF5, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x4F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF4, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x0B,
-    0xFF, 0xEA, 0xBF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0B, 0xFE,
-    0x56, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0xBF, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xDF, 0xE0, 0x00, 0x00, 0x3F, 0xBF,
-    0x40, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0x0F, 0xEB, 0xE0, 0x00,
-    0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x3F,
-    0x80, 0xFE, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0x95, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0x95, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFE,
-    0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFD, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x2C, 0x00, 0x07,
-    0xC0, 0x01, 0xF0, 0x00, 0x0F, 0xE5, 0x6F, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x07, 0xF8,
-    0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x00,
-    0x3F, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xEF,
-    0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00,
-    0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF9, 0x5B, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x81, 0xA8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00,
-    0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0xAA,
-    0x00, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x02,
-    0xF4, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0,
-    0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00,
-    0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA,
-    0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0,
-    0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F, 0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0x90, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x55, 0x55, 0x52,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xCB, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0xD5, 0x55, 0x54, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFA,
-    0xAF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0x80, 0x0B, 0xFD, 0x57, 0xFE, 0x2F, 0xE5, 0x6F, 0xE0, 0x1F, 0xD0, 0x00, 0x7F,
-    0xBF, 0x00, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xAA, 0xA9, 0xFE, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xBF, 0x80, 0x00, 0x14, 0x0B, 0xFE, 0x57, 0xFE,
-    0x2F, 0xF9, 0x5B, 0xF8, 0x01, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xA0,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE9, 0x40, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x06, 0xFF, 0x80, 0x7F, 0x00, 0x00,
-    0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B,
-    0xF0, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xD0,
-    0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00,
-    0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x0F,
-    0xE0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x01, 0xA9, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFC, 0x0B, 0xFF, 0xFC, 0x3F,
-    0xFE, 0xFC, 0xFF, 0xA9, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xE9, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x06, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0x3F, 0xC0,
-    0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F,
-    0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00,
-    0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x0B, 0xF0,
-    0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0x40, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F,
-    0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x4F, 0xC0,
-    0xBF, 0xF3, 0xF0, 0xFF, 0xF8, 0xFC, 0xFF, 0xA9, 0x3F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0xA8, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE9, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x06, 0xFF, 0x80, 0x7F, 0x00,
-    0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00,
-    0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F,
-    0xD0, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x00, 0x7F,
-    0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00,
-    0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00,
-    0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x01,
-    0xFD, 0x29, 0x00, 0x06, 0x82, 0xF8, 0x02, 0xF8, 0x0B, 0xE0, 0xBE, 0x00, 0x3F, 0xBF, 0x80, 0x00,
-    0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x43, 0xF0, 0x2F, 0xFC, 0x3F, 0x0F, 0xFF, 0x83, 0xF3, 0xFE, 0xA4, 0x3F, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00,
-    0x1B, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x90, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xE5, 0x16, 0xF0, 0x3F, 0x40,
-    0x00, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFC, 0x20, 0x00, 0x02, 0xFC, 0x3F, 0x95, 0x5F, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF,
-    0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0xC0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x1F, 0x80, 0x07,
-    0xE0, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00, 0x1B,
-    0x41, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xA0,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x03, 0xF4, 0x1F,
-    0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xE5, 0x16, 0xF0, 0x3F, 0x40, 0x00,
-    0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0xFC, 0x20, 0x00, 0x02, 0xFC, 0x3F, 0x95, 0x5F, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF, 0xFE,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00, 0x1B, 0x41, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01,
-    0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x01, 0xFF, 0xFF, 0xE4, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xE5, 0x16, 0xF0, 0x3F, 0x40, 0x00, 0x10,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC,
-    0x20, 0x00, 0x02, 0xFC, 0x3F, 0x95, 0x5F, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF, 0xFE, 0x00,
-    0x00, 0x17, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x06, 0xFC, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x01, 0xA0, 0x00, 0x2A, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x3F, 0x43,
-    0xF4, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00, 0x1B, 0x41, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x90, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x01, 0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0A, 0x40, 0x01, 0xA0, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x02, 0xF8, 0x2F, 0x80, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x01,
-    0xFF, 0xFF, 0xE4, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xE5, 0x16, 0xF0, 0x3F, 0x40, 0x00, 0x10, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x20,
-    0x00, 0x02, 0xFC, 0x3F, 0x95, 0x5F, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF, 0xFE, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x5F, 0xF5, 0x55, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF9, 0x54, 0x01, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0xF5, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x06, 0xFD, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0xA8, 0x00, 0x0A, 0x80, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x00,
-    0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x28,
-    0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x02, 0xE0, 0x00, 0xFC, 0x00, 0x14, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xD5,
-    0x54, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0x95, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x5F, 0xF5, 0x55, 0x02, 0xFC, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC2, 0xBF,
-    0xEA, 0xA0, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF9, 0x54, 0x01, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x01, 0x40, 0x00, 0x90, 0x00, 0x0B, 0xFF, 0x00, 0xB4,
-    0x00, 0x07, 0xFF, 0xF9, 0xBC, 0x00, 0x03, 0xE0, 0xBF, 0xFE, 0x00, 0x00, 0xF0, 0x02, 0xFE, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0,
-    0x00, 0x00, 0x1F, 0xD2, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF,
-    0xEA, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x19, 0x00, 0x06, 0x00, 0x0B, 0xFE, 0x00, 0xF4, 0x01, 0xFF, 0xFE, 0x6F,
-    0x00, 0x3E, 0x0B, 0xFF, 0xD0, 0x03, 0xC0, 0x0B, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F,
-    0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00,
-    0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3,
-    0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00,
-    0x07, 0xF3, 0xF4, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x01, 0xFF, 0x2F,
-    0xD0, 0x00, 0x7F, 0xF0, 0xFF, 0xD5, 0xBF, 0xBF, 0x07, 0xFF, 0xFF, 0xE3, 0xF0, 0x0B, 0xFF, 0xF4,
-    0x3F, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x0B, 0xF7, 0xF0,
-    0x00, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x03, 0xFE,
-    0x00, 0x01, 0xFF, 0x40, 0x3F, 0xFE, 0xAB, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00,
-    0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F,
-    0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x01, 0xFF, 0x2F, 0xD0, 0x00, 0x7F,
-    0xF0, 0xFF, 0xD5, 0xBF, 0xBF, 0x07, 0xFF, 0xFF, 0xE3, 0xF0, 0x0B, 0xFF, 0xF4, 0x3F, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x02, 0xF9,
-    0x5B, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00,
-    0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00,
-    0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01,
-    0xFD, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x1F,
-    0xD2, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xEA, 0xBF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xBE, 0x56, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00,
-    0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F,
-    0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x01, 0xFF, 0x2F, 0xD0, 0x00, 0x7F,
-    0xF0, 0xFF, 0xD5, 0xBF, 0xBF, 0x07, 0xFF, 0xFF, 0xE3, 0xF0, 0x0B, 0xFF, 0xF4, 0x3F, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3E,
-    0x1F, 0x40, 0x00, 0x00, 0x1E, 0x01, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x00, 0x01, 0xF0,
-    0x2E, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00,
-    0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00,
-    0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01,
-    0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07,
-    0xF7, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x7F,
-    0x4B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x0F, 0xFF, 0xAA, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0x47, 0xD0, 0x00, 0x01, 0xE0,
-    0x2E, 0x00, 0x00, 0x2D, 0x01, 0xE0, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x0F, 0xEF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F,
-    0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x0B,
-    0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFD,
-    0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x02, 0xA8, 0x0A, 0x90, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00,
-    0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x00,
-    0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0,
-    0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00,
-    0x00, 0x07, 0xF4, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFA,
-    0xAF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x6A, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x3F, 0x41, 0xFC,
-    0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F,
-    0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00,
-    0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3,
-    0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00,
-    0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F,
-    0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE,
-    0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0,
-    0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x1F, 0xD2, 0xFD, 0x00,
-    0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xEA, 0xBF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F,
-    0xC3, 0xF4, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0xFD,
-    0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00,
-    0x07, 0xF0, 0xFD, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x01, 0xFC,
-    0x3F, 0x40, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0xBF, 0x0F, 0xD0,
-    0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0xBF, 0x40, 0x01, 0xFF, 0xC0, 0xFF, 0xD5, 0xBF,
-    0xBF, 0x01, 0xFF, 0xFF, 0xF8, 0xFC, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x05, 0x40, 0x2F, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x2F,
-    0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0xFD, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x07, 0xF3, 0xF0, 0x00,
-    0x0B, 0xE0, 0x0B, 0xF0, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0xFD, 0x2F,
-    0x80, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F,
-    0x80, 0xFC, 0x00, 0x2F, 0x80, 0x02, 0xFC, 0x00, 0xBD, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x07, 0xF0,
-    0x03, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x00,
-    0x3F, 0x80, 0xBE, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0xBE, 0x03, 0xF4,
-    0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x03, 0xF0,
-    0xBF, 0x00, 0x00, 0x0B, 0xE2, 0xF4, 0x00, 0x0B, 0xE3, 0xF8, 0x00, 0x00, 0x1F, 0xCF, 0xC0, 0x00,
-    0x1F, 0xCF, 0xD0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0xF8,
-    0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0xBF,
-    0xC0, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0xFF, 0xE0,
-    0x00, 0x7F, 0x01, 0xFC, 0x00, 0x1F, 0x7F, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x03, 0xF2, 0xF4, 0x00,
-    0xFD, 0x00, 0xFE, 0x00, 0x3F, 0x1F, 0x80, 0x0F, 0xC0, 0x0B, 0xF0, 0x07, 0xE0, 0xFC, 0x01, 0xFC,
-    0x00, 0x3F, 0x00, 0xBD, 0x0F, 0xC0, 0x2F, 0x80, 0x03, 0xF4, 0x0F, 0xC0, 0xBE, 0x03, 0xF4, 0x00,
-    0x2F, 0x81, 0xF8, 0x07, 0xF0, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x40, 0x3F, 0x07, 0xF0, 0x00, 0x0F,
-    0xC3, 0xF0, 0x02, 0xF4, 0xBE, 0x00, 0x00, 0xFD, 0x3E, 0x00, 0x1F, 0x8F, 0xD0, 0x00, 0x0B, 0xE7,
-    0xD0, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00,
-    0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0,
-    0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xCF, 0xE0, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x00,
-    0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F,
-    0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00,
-    0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00,
-    0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07,
-    0xEF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBB, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x00,
-    0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F,
-    0x87, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00, 0x0F,
-    0xD0, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF3,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2A, 0x80, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x57, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xA8, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x55,
-    0x57, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xA8, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x01, 0xA0, 0x00, 0x1A, 0x00, 0x02, 0xF4, 0x02, 0xF4, 0x00,
-    0x03, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1A, 0x00, 0x01, 0xA0, 0x0F, 0xD0, 0x0F, 0xD0, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0xFE, 0xFE,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x57,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xA8, 0xBF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0x90, 0x1F, 0xFF, 0xD1, 0xFF, 0xFF, 0x0F, 0xF4, 0x14,
-    0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0x6A, 0x40, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0x50, 0x00, 0xAA, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x01, 0x40, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x3F, 0x5F, 0xC0, 0x0F, 0xD0, 0x7F, 0x03, 0xF0, 0x00, 0xFC, 0x14, 0x00, 0x01, 0x40, 0x01, 0x90,
-    0x00, 0x60, 0x3F, 0xF8, 0x03, 0xC2, 0xFF, 0xFE, 0x6F, 0x0F, 0x47, 0xFF, 0xF4, 0x7C, 0x01, 0xFF,
-    0x40, 0x40, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x15, 0x55,
-    0x54, 0x6A, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x0E, 0xB8, 0x00, 0x2E, 0x3F, 0x56, 0xFC, 0x2F, 0xFF, 0xF4, 0x07, 0xFF, 0xD0,
-    0x00, 0x14, 0x00, 0x28, 0xBF, 0xFF, 0xBE, 0x14, 0x04, 0x00, 0x10, 0x3F, 0x00, 0xFC, 0x7F, 0x00,
-    0xFC, 0x3F, 0x00, 0xFC, 0x04, 0x00, 0x10, 0xBE, 0x43, 0xFF, 0xC5, 0x6F, 0x80, 0x3F, 0x00, 0xF8,
-    0x6F, 0xC2, 0xF8, 0x0B, 0x80, 0x1E, 0x00, 0x01, 0xA4, 0x00, 0xFF, 0xF0, 0x2F, 0x5B, 0xC3, 0xC0,
-    0x3C, 0x3C, 0x03, 0xC3, 0xD0, 0x3C, 0x1F, 0xAF, 0x80, 0xBF, 0xE0, 0x00, 0x10, 0x00, 0x01, 0xA8,
-    0x0A, 0xA0, 0x3F, 0x81, 0xFC, 0x0B, 0xF0, 0x3F, 0x40, 0xFC, 0x0B, 0xE0, 0x3F, 0x00, 0xF8, 0x07,
-    0xC0, 0x3E, 0x00, 0x10, 0x01, 0x40, 0x00, 0x29, 0x00, 0x06, 0x82, 0xF8, 0x02, 0xF8, 0x0B, 0xE0,
-    0xBE, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x69, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x69, 0x69, 0x06, 0x9B, 0xE0, 0xBE, 0xBE, 0x0B, 0xEB, 0xE0,
-    0xBE, 0xBE, 0x0B, 0xEB, 0xE0, 0xBE, 0x69, 0x06, 0x90, 0x6A, 0x42, 0xA8, 0x00, 0xFF, 0x07, 0xF4,
-    0x00, 0xFD, 0x07, 0xF0, 0x01, 0xFC, 0x0B, 0xE0, 0x01, 0xF8, 0x0B, 0xC0, 0x01, 0xF0, 0x0B, 0xC0,
-    0x00, 0x40, 0x05, 0x00, 0x00, 0x28, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00,
-    0xB0, 0x14, 0x0E, 0xB8, 0x00, 0x2E, 0x7E, 0x96, 0xFC, 0x2F, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x00,
-    0x14, 0x00, 0x01, 0xAA, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7D, 0x00, 0x7D, 0xB4, 0x00,
-    0x1E, 0x10, 0x00, 0x04, 0x02, 0xD0, 0x7D, 0x0B, 0xC0, 0xFC, 0x2F, 0x83, 0xF8, 0x3F, 0x4B, 0xF0,
-    0xFF, 0x05, 0x50, 0x0F, 0xE0, 0xFE, 0x1F, 0xD2, 0xFC, 0x2F, 0x83, 0xF0, 0x3F, 0x07, 0xD0, 0xBC,
-    0x05, 0x40, 0xBE, 0x0B, 0xF0, 0x7F, 0x03, 0xF4, 0x2F, 0x81, 0xFC, 0x0F, 0xC0, 0xBD, 0x03, 0xE0,
-    0x15, 0x0B, 0xE0, 0xFE, 0x1F, 0xD1, 0xFC, 0x2F, 0x83, 0xF4, 0x3F, 0x07, 0xD0, 0xBC, 0x05, 0x40,
-    0x6A, 0x40, 0x3F, 0xC0, 0x1F, 0xD0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x04, 0x01, 0xAA,
-    0x03, 0xFC, 0x07, 0xF4, 0x0F, 0xD0, 0x3F, 0x40, 0x7D, 0x00, 0x10, 0x00, 0x00, 0x3D, 0x00, 0x3D,
-    0x2A, 0xBD, 0x7F, 0xFD, 0x2A, 0xFD, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7E, 0xA8, 0x7F, 0xFD, 0x7F, 0xA8, 0x7C, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA1, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x02, 0x80, 0x00, 0x69, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07,
-    0xF4, 0x03, 0xFC, 0x0B, 0xFC, 0x0F, 0xFC, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0xCB,
-    0xE3, 0xC0, 0xF0, 0x3C, 0x0B, 0xE0, 0xBC, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03,
-    0xC0, 0x5B, 0xE5, 0xFF, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD0, 0x03,
-    0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x57, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
-    0xC0, 0x03, 0xC0, 0x02, 0x80, 0x15, 0x55, 0x47, 0xFF, 0xFD, 0x3F, 0xFF, 0xC0, 0x00, 0xA8, 0x03,
-    0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x7F, 0xBF, 0xFA, 0xFF, 0xC7, 0xF8,
-    0x00, 0xA8, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x40, 0xBF,
-    0xF8, 0xFF, 0xE0, 0xBF, 0x40, 0x09, 0x0F, 0xE3, 0xF8, 0xFE, 0x09, 0x00, 0x04, 0x00, 0x10, 0x3F,
-    0x00, 0xFC, 0x7F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x04, 0x00, 0x10, 0x01, 0xA4, 0x00, 0xFF, 0xF0,
-    0x2F, 0x5B, 0xC3, 0xC0, 0x3C, 0x3C, 0x03, 0xC3, 0xD0, 0x3C, 0x1F, 0xAF, 0x80, 0xBF, 0xE0, 0x00,
-    0x10, 0x00, 0x0A, 0x90, 0xFC, 0x1F, 0x82, 0xF0, 0x3E, 0x07, 0xC0, 0x10, 0x00, 0x03, 0xC0, 0x07,
-    0x80, 0x0F, 0xE0, 0x06, 0xFC, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0xBE, 0xBF, 0xFC, 0xBF, 0xD0, 0x00,
-    0x40, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x2F, 0xFC, 0x0F,
-    0xFC, 0x00, 0x00, 0x69, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x69, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFF, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x02, 0x80, 0x28, 0x3C, 0x03, 0xC0, 0x3C, 0x2F, 0x5F,
-    0xF5, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x01, 0xA4, 0x1A, 0x40, 0x29, 0x00, 0x06, 0x82, 0xF8, 0x02,
-    0xF8, 0x0B, 0xE0, 0xBE, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0x5F,
-    0xC0, 0x0F, 0xD0, 0x7F, 0x03, 0xF0, 0x00, 0xFC, 0x14, 0x00, 0x01, 0x40, 0xB0, 0x00, 0x0E, 0xB8,
-    0x00, 0x2E, 0x7E, 0x56, 0xFC, 0x2F, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x01, 0xAA,
-    0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7D, 0x00, 0x7D, 0xB4, 0x00, 0x1E, 0x10, 0x00, 0x04,
-    0x01, 0x90, 0x00, 0x91, 0xFF, 0xD0, 0x1E, 0x3F, 0xFF, 0xD7, 0xDB, 0xC1, 0xFF, 0xFC, 0xF4, 0x02,
-    0xFF, 0x05, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x15, 0x55,
-    0x54, 0x6A, 0xAA, 0xAA, 0xAA, 0x97, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
-    0x55, 0x55, 0x55, 0x01, 0x90, 0x00, 0x60, 0x3F, 0xF4, 0x03, 0xC3, 0xFF, 0xFD, 0x7E, 0x1F, 0x47,
-    0xFF, 0xF0, 0xB4, 0x01, 0xFF, 0x40, 0x40, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00,
-    0x00, 0x14, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x2F, 0xF4,
-    0x00, 0x3F, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3F, 0x07, 0xE0, 0x3C, 0x0F,
-    0x03, 0xCB, 0xE3, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3C, 0x00, 0x00, 0x3C, 0x3C, 0x00,
-    0x00, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x3D, 0x55, 0x55, 0x7C, 0x3F, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA,
-    0xAA, 0xA8, 0x01, 0xA4, 0x1A, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0x0B, 0xF0, 0xB8, 0x3C, 0x03,
-    0xC0, 0x3C, 0x28, 0x02, 0x80, 0x28, 0x00, 0x00, 0x24, 0x18, 0xBD, 0x7E, 0x3F, 0xFC, 0x0F, 0xF0,
-    0x1F, 0xF4, 0x7F, 0xFD, 0x7C, 0x3D, 0x10, 0x04, 0x00, 0x41, 0xFD, 0x3F, 0x87, 0xD0, 0x3D, 0x02,
-    0xF0, 0x0F, 0xC0, 0x7C, 0x07, 0xD2, 0xFC, 0x7F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x00,
-    0x7F, 0x80, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xF8, 0x00, 0xBD, 0x00, 0x04, 0x00, 0xAA, 0x00, 0xBF,
-    0x40, 0x3F, 0x80, 0x3F, 0x80, 0x2F, 0x80, 0x1F, 0x80, 0x01, 0x00, 0x00, 0x01, 0x90, 0x00, 0x91,
-    0xFF, 0xD0, 0x1E, 0x3F, 0xFF, 0xD7, 0xDB, 0xC1, 0xFF, 0xFC, 0xF4, 0x02, 0xFF, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xD0, 0xBD, 0x07, 0xD0, 0xBC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x14, 0x1F, 0xD1, 0x07, 0xE2, 0xFC, 0xFC, 0xBF, 0x3F, 0x4F, 0xD7, 0xE3,
-    0xE0, 0xFC, 0x04, 0x7C, 0x01, 0x00, 0x01, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xF5, 0x3F,
-    0xF0, 0xFE, 0x2A, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAF, 0xC3,
-    0xD0, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55,
-    0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x69, 0x06, 0x9B, 0xE0, 0xBE, 0xBE, 0x0B, 0xEB, 0xE0, 0xBE,
-    0xBE, 0x0B, 0xEB, 0xE0, 0xBE, 0x69, 0x06, 0x90, 0x7F, 0xFD, 0x7F, 0xFD, 0x2A, 0xBD, 0x00, 0x3D,
-    0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x01, 0x80, 0x00, 0x19, 0x3D, 0x09, 0x1F, 0xFF, 0xC1,
-    0xE3, 0xFF, 0xFD, 0x7D, 0xBC, 0x3F, 0xFF, 0xCF, 0x47, 0xEF, 0xF0, 0x50, 0xF4, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xF4, 0x00,
-    0x01, 0x90, 0x00, 0x91, 0xFF, 0xD0, 0x1E, 0x3F, 0xFF, 0xD7, 0xDB, 0xC1, 0xFF, 0xFC, 0xF4, 0x02,
-    0xFF, 0x01, 0x00, 0x50, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0xBF, 0x80, 0x3C, 0x2F, 0xFF, 0x9B, 0xC3, 0xD1, 0xFF,
-    0xF4, 0x3C, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xC1, 0xFF, 0xF4, 0x7C, 0x3E,
-    0x6F, 0xFF, 0x83, 0xC0, 0x2F, 0xF0, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x03,
-    0x40, 0x0B, 0xD5, 0x7E, 0x03, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0x7C, 0x03, 0xD0, 0x00,
-    0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x07, 0xE0, 0x1F, 0xF8, 0x1B, 0xE8,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x7F, 0xF4, 0x03, 0xFF, 0xC0, 0x1F, 0xFD, 0x7F,
-    0xF4, 0x03, 0xFF, 0xC0, 0x1F, 0xFD, 0x79, 0x50, 0x00, 0x55, 0x00, 0x05, 0x6D, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x78, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2D, 0x78, 0x00, 0x0E, 0x3C, 0xB0,
-    0x00, 0x2D, 0x00, 0x00, 0x0E, 0x14, 0xB0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x02, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x10, 0x1D,
-    0x00, 0x00, 0x00, 0x78, 0x04, 0x78, 0x04, 0x00, 0x00, 0x00, 0x10, 0x2D, 0x78, 0x10, 0x00, 0x00,
-    0x00, 0x04, 0x2D, 0x78, 0x3C, 0x00, 0x00, 0x00, 0x2D, 0x2D, 0x78, 0x24, 0x00, 0x00, 0x00, 0x18,
-    0x2D, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x24, 0x1D, 0x00, 0x00, 0x00, 0x78, 0x18, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0x4D, 0x00, 0x71, 0x40, 0x00, 0x78, 0x00, 0x0E, 0x3C, 0xB0,
-    0x00, 0x2D, 0x78, 0x00, 0x00, 0x28, 0x00, 0x00, 0x2D, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x7F, 0xF4, 0x03, 0xFF, 0xC0, 0x1F, 0xFD, 0x7F, 0xF4,
-    0x03, 0xFF, 0xC0, 0x1F, 0xFD, 0x10, 0x00, 0xF8, 0x02, 0xFE, 0x40, 0xBF, 0x01, 0xFC, 0x7F, 0xE3,
-    0xF4, 0x09, 0x00, 0x01, 0x07, 0xD7, 0xE2, 0xE0, 0xB4, 0x2E, 0x07, 0xE0, 0x7D, 0x01, 0x00, 0x00,
-    0x55, 0x00, 0x0B, 0xFF, 0xE0, 0x2F, 0xFF, 0xFC, 0x7E, 0x41, 0xBD, 0xB8, 0x00, 0x1E, 0x60, 0x7D,
-    0x09, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x3D,
-    0x7C, 0x3F, 0xFC, 0x0F, 0xF0, 0x1F, 0xF4, 0x7F, 0xFD, 0x2C, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x01,
-    0xF1, 0xBF, 0x8F, 0xF4, 0x3F, 0x40, 0xBF, 0xC0, 0x2F, 0xC0, 0x07, 0x10, 0x00, 0xF4, 0x03, 0xFE,
-    0x01, 0xFF, 0x01, 0xFC, 0x7F, 0xE3, 0xF4, 0x0D, 0x00, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xFC,
-    0x0B, 0xF8, 0x03, 0xF4, 0x02, 0xFD, 0x2F, 0xE0, 0x07, 0xF4, 0xF7, 0xC0, 0xBF, 0xC7, 0xCF, 0x4F,
-    0xE0, 0x3D, 0x1F, 0x38, 0x00, 0xF0, 0x3C, 0x50, 0x2F, 0x07, 0xF0, 0x3D, 0x0B, 0x43, 0xD7, 0xF2,
-    0xF0, 0x50, 0x00, 0x0A, 0x0F, 0xE3, 0xF8, 0xFE, 0x09, 0x00, 0x02, 0x80, 0x03, 0xC0, 0x77, 0xDD,
-    0xBF, 0xFE, 0x5F, 0xF5, 0x1F, 0xF4, 0x3E, 0xBC, 0x08, 0x20, 0x06, 0xF8, 0x2F, 0x90, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x3D, 0x0B, 0xE0, 0x7C, 0x3C, 0x03, 0xC0, 0x3C, 0x3C, 0x03, 0xC0, 0x3C, 0x3D, 0x0B,
-    0xE0, 0x7C, 0x1F, 0xFF, 0xFF, 0xF4, 0x07, 0xF8, 0x2F, 0xD0, 0x04, 0x00, 0x2D, 0x00, 0x3C, 0x00,
-    0x3F, 0xFD, 0x7F, 0xFC, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x60, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xE5, 0x00, 0x05, 0xBF, 0xF4, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xAA, 0x50, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xE5, 0x00, 0x05, 0xBF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x50,
-    0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x2A, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xA8, 0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x1A, 0x94, 0x00, 0x00, 0x00, 0x01, 0x80, 0x7F, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x3C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFA, 0x55, 0x6F, 0x83, 0xF4, 0x00, 0x1A,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x40, 0x00, 0x16, 0xFF,
-    0x40, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x15, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x1E, 0xBC, 0x00,
-    0x0E, 0x00, 0x0E, 0x1F, 0xFF, 0x74, 0x0B, 0xB0, 0x0F, 0x74, 0x6F, 0x1F, 0xD6, 0x01, 0x50, 0x03,
-    0xEF, 0x03, 0x80, 0xB1, 0xD0, 0x1C, 0x7F, 0xFF, 0x5C, 0x00, 0x03, 0x40, 0x00, 0xB9, 0x18, 0x06,
-    0xFD, 0x00, 0x11, 0xC1, 0x04, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x01, 0x50, 0x07, 0xEF, 0x47,
-    0x40, 0xB2, 0xC0, 0x0D, 0xF0, 0x03, 0xAC, 0x00, 0xE7, 0x00, 0x74, 0xF4, 0x78, 0x0B, 0xF4, 0x00,
-    0x10, 0x01, 0x1C, 0x01, 0xC7, 0x00, 0x71, 0xC0, 0x1C, 0x70, 0x07, 0x1C, 0x01, 0xC7, 0x00, 0xB0,
-    0xE0, 0xBC, 0x1B, 0xE3, 0x00, 0x01, 0x50, 0x7E, 0xE7, 0x40, 0x2C, 0x00, 0xB0, 0x02, 0xC0, 0x07,
-    0x00, 0x0F, 0x45, 0x0B, 0xF4, 0x00, 0x02, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x05, 0x1C, 0x2E, 0xBB,
-    0x1D, 0x03, 0xCB, 0x00, 0x73, 0x80, 0x1C, 0xE0, 0x07, 0x2C, 0x02, 0xC3, 0xD1, 0xF0, 0x2F, 0x8C,
-    0x60, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC1, 0x40, 0x7B, 0xBE, 0x1E, 0x02, 0xC7, 0x00, 0x31,
-    0xC0, 0x0C, 0x70, 0x03, 0x1C, 0x00, 0xC7, 0x00, 0x31, 0xC0, 0x0C, 0x10, 0x50, 0x05, 0x03, 0xBB,
-    0xEB, 0xBD, 0x3C, 0x0B, 0x80, 0xF3, 0x80, 0x70, 0x0B, 0x34, 0x07, 0x00, 0xB3, 0x40, 0x70, 0x0B,
-    0x34, 0x07, 0x00, 0xB3, 0x40, 0x70, 0x0B, 0x34, 0x03, 0x00, 0x60, 0x00, 0x4A, 0xBD, 0xB8, 0x0B,
-    0x00, 0xB0, 0x0B, 0x00, 0xB0, 0x0B, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x24, 0x01, 0xE5, 0x1F, 0xE8,
-    0x0D, 0x00, 0x34, 0x00, 0xD0, 0x03, 0x40, 0x0D, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x2C,
-    0x00, 0xD3, 0x40, 0xB0, 0xB0, 0x34, 0x1C, 0x1C, 0x03, 0x8E, 0x00, 0x77, 0x00, 0x0F, 0xC0, 0x01,
-    0xD0, 0x00, 0x10, 0x01, 0x0E, 0x03, 0x80, 0xD2, 0xC0, 0x1E, 0xC0, 0x02, 0xD0, 0x00, 0xFC, 0x00,
-    0xE3, 0x80, 0xF0, 0x38, 0x60, 0x06, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x60, 0x06, 0x40, 0x01, 0xFC, 0x0F, 0xD0, 0x02,
-    0xFC, 0x0F, 0xD0, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x60, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xFA, 0xAF, 0xFF, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x02, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x0F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF0, 0x0A, 0xAF, 0xFD, 0x00, 0x00, 0xFC, 0x07, 0xFF,
-    0xFD, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x1A, 0x90, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xD0, 0x00, 0x6D, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFE, 0xAA, 0xAA,
-    0xAA, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x06, 0x00, 0x3F, 0xFF, 0xAA, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00, 0x1B, 0x41, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x90,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x01, 0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F,
-    0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F,
-    0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF0, 0x38, 0x1E, 0x3F, 0x8F,
-    0xDF, 0xE3, 0xFA, 0xF4, 0xBD, 0x14, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0,
-    0x01, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0,
-    0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00,
-    0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00,
-    0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0,
-    0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00,
-    0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00,
-    0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x3F, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0B, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF5, 0x55, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFA, 0xAA, 0xFF, 0xF4, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0x80, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xF8, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xE4, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0x47, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xD7, 0xF0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE7, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD7,
-    0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC7, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xFF, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFA, 0xAF, 0xFF, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x2F,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFC,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xA8,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E,
-    0x07, 0xF0, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x2F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x7F, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0x01,
-    0xFC, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x55, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFD, 0x57, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-    0xC0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x7F,
-    0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x07, 0xF4, 0x01, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x07, 0xF0,
-    0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x7F, 0x00, 0x00, 0x00, 0x2F, 0xE7, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xFF,
-    0xE7, 0xF0, 0x00, 0x00, 0x2F, 0xFE, 0x7F, 0x00, 0x00, 0x07, 0xF7, 0xE7, 0xF0, 0x00, 0x00, 0xFD,
-    0x7E, 0x7F, 0x00, 0x00, 0x2F, 0x8B, 0xE7, 0xF0, 0x00, 0x03, 0xF0, 0xBE, 0x7F, 0x00, 0x00, 0xFD,
-    0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xC0, 0xBE, 0x7F, 0x00, 0x03, 0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0xFE,
-    0x00, 0xBE, 0x7F, 0x00, 0x1F, 0xC0, 0x0B, 0xE7, 0xF0, 0x03, 0xF0, 0x00, 0xBE, 0x7F, 0x00, 0xBE,
-    0x00, 0x0B, 0xE7, 0xF0, 0x1F, 0xC0, 0x00, 0xBE, 0x7F, 0x03, 0xF4, 0x00, 0x0B, 0xE7, 0xF0, 0xBE,
-    0x00, 0x00, 0xBE, 0x7F, 0x1F, 0xC0, 0x00, 0x0B, 0xE7, 0xF3, 0xF4, 0x00, 0x00, 0xBE, 0x7F, 0xBE,
-    0x00, 0x00, 0x0B, 0xE7, 0xFF, 0xC0, 0x00, 0x00, 0xBE, 0x7F, 0xF4, 0x00, 0x00, 0x0B, 0xE7, 0xFF,
-    0x00, 0x00, 0x00, 0xBE, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF9, 0x6F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x9F, 0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x02,
-    0xF9, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x00, 0x0B,
-    0xE7, 0xF0, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x2F,
-    0x9F, 0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0xBE,
-    0x7F, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x02, 0xF9,
-    0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x00, 0x0B, 0xE7,
-    0xF0, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x9F,
-    0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80,
-    0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF,
-    0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00,
-    0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x01, 0xFE,
-    0xAA, 0xFF, 0xFD, 0x07, 0xF0, 0x00, 0x0B, 0xFC, 0x1F, 0xC0, 0x00, 0x07, 0xF8, 0x7F, 0x00, 0x00,
-    0x0F, 0xF1, 0xFC, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x01, 0xFC,
-    0x7F, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x02, 0xFD, 0x1F, 0xC0,
-    0x00, 0x7F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xE4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x7F, 0x00, 0x01, 0xBF, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x07, 0xF4,
-    0x7F, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x7F,
-    0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0x55, 0x56, 0xFF, 0x40, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0x55, 0x56, 0xFF, 0xD0, 0x7F, 0x00, 0x00,
-    0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x01,
-    0xFD, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x81, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07,
-    0xF0, 0x0B, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x80, 0x00,
-    0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x80,
-    0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x2F,
-    0x80, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x2F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B,
-    0xF5, 0x7F, 0xD5, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x57, 0xFD, 0x5F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xF8, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x02, 0xF8, 0x00, 0x7F,
-    0x40, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x02, 0xF8,
-    0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xE0, 0x1F, 0xD0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xAF, 0xFF, 0xC0, 0x1E, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x55, 0x5B, 0xFD, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x15, 0x6A,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x64, 0x00, 0x00, 0x7F, 0xD2, 0xFF, 0xAA, 0xBF,
-    0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0xE7, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0xE7, 0xF0, 0x00, 0x00, 0x7F,
-    0x7E, 0x7F, 0x00, 0x00, 0x0F, 0xD7, 0xE7, 0xF0, 0x00, 0x02, 0xF8, 0xBE, 0x7F, 0x00, 0x00, 0x3F,
-    0x0B, 0xE7, 0xF0, 0x00, 0x0F, 0xD0, 0xBE, 0x7F, 0x00, 0x01, 0xFC, 0x0B, 0xE7, 0xF0, 0x00, 0x3F,
-    0x00, 0xBE, 0x7F, 0x00, 0x0F, 0xE0, 0x0B, 0xE7, 0xF0, 0x01, 0xFC, 0x00, 0xBE, 0x7F, 0x00, 0x3F,
-    0x00, 0x0B, 0xE7, 0xF0, 0x0B, 0xE0, 0x00, 0xBE, 0x7F, 0x01, 0xFC, 0x00, 0x0B, 0xE7, 0xF0, 0x3F,
-    0x40, 0x00, 0xBE, 0x7F, 0x0B, 0xE0, 0x00, 0x0B, 0xE7, 0xF1, 0xFC, 0x00, 0x00, 0xBE, 0x7F, 0x3F,
-    0x40, 0x00, 0x0B, 0xE7, 0xFB, 0xE0, 0x00, 0x00, 0xBE, 0x7F, 0xFC, 0x00, 0x00, 0x0B, 0xE7, 0xFF,
-    0x40, 0x00, 0x00, 0xBE, 0x7F, 0xF0, 0x00, 0x00, 0x0B, 0xE7, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F,
-    0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00,
-    0x00, 0x0F, 0xF5, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xE7, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0x00, 0x00, 0x00,
-    0xFF, 0xE7, 0xF0, 0x00, 0x00, 0x2F, 0xFE, 0x7F, 0x00, 0x00, 0x07, 0xF7, 0xE7, 0xF0, 0x00, 0x00,
-    0xFD, 0x7E, 0x7F, 0x00, 0x00, 0x2F, 0x8B, 0xE7, 0xF0, 0x00, 0x03, 0xF0, 0xBE, 0x7F, 0x00, 0x00,
-    0xFD, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xC0, 0xBE, 0x7F, 0x00, 0x03, 0xF0, 0x0B, 0xE7, 0xF0, 0x00,
-    0xFE, 0x00, 0xBE, 0x7F, 0x00, 0x1F, 0xC0, 0x0B, 0xE7, 0xF0, 0x03, 0xF0, 0x00, 0xBE, 0x7F, 0x00,
-    0xBE, 0x00, 0x0B, 0xE7, 0xF0, 0x1F, 0xC0, 0x00, 0xBE, 0x7F, 0x03, 0xF4, 0x00, 0x0B, 0xE7, 0xF0,
-    0xBE, 0x00, 0x00, 0xBE, 0x7F, 0x1F, 0xC0, 0x00, 0x0B, 0xE7, 0xF3, 0xF4, 0x00, 0x00, 0xBE, 0x7F,
-    0xBE, 0x00, 0x00, 0x0B, 0xE7, 0xFF, 0xC0, 0x00, 0x00, 0xBE, 0x7F, 0xF4, 0x00, 0x00, 0x0B, 0xE7,
-    0xFF, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF8, 0x00, 0x00, 0x00, 0xBE,
-    0x7F, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x07,
-    0xF0, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x1F,
-    0xC0, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x57, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xF5, 0x5F, 0xF0, 0x00, 0x01, 0xFC,
-    0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x03, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0x40, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xC0,
-    0x00, 0x1F, 0xD0, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00,
-    0x00, 0x07, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x02, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xE0, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8,
-    0x00, 0x7E, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x00, 0x00,
-    0xFE, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0xE0,
-    0x00, 0x00, 0x0F, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x85, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x7E, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0xBD, 0xFD, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0xFD,
-    0x7E, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0xFD, 0x7E, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0xFD, 0x7E, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0xFD, 0x7E, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0xFD, 0x7F, 0x07, 0xF0, 0x00,
-    0x0F, 0xC0, 0xFD, 0x7F, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0xFD, 0x7F, 0x02, 0xF8, 0x00, 0x2F, 0x40,
-    0xFD, 0x7F, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xFD, 0x7F, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0xFD, 0x7F,
-    0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFD, 0x7F, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xFD, 0x7F, 0x00, 0x2F,
-    0x82, 0xF4, 0x00, 0xFD, 0x7F, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0xFD, 0x7F, 0x00, 0x0F, 0xD7, 0xE0,
-    0x00, 0xFD, 0x7F, 0x00, 0x0B, 0xEB, 0xD0, 0x00, 0xFD, 0x7F, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFD,
-    0x7F, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFD, 0x7F, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFD, 0x7F, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x00,
-    0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF5, 0x55, 0x55, 0x56, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F,
-    0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x01, 0xBF, 0xC0,
-    0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x40, 0x00,
-    0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x87,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xDB, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF6, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xFD, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFE,
-    0xAB, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00,
-    0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0x01,
-    0xFD, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x07,
-    0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x1F,
-    0xDF, 0xC0, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFD,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xF7,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0xFF, 0xE9, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x07, 0xF0, 0x01, 0x7F, 0xF4, 0x7F, 0x00, 0x00, 0x7F, 0xC7, 0xF0, 0x00, 0x01, 0xFD,
-    0x7F, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00,
-    0x00, 0xFE, 0x7F, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0xBF, 0x87,
-    0xF5, 0x56, 0xBF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xAA, 0x94,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xD0, 0x00, 0x6E, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x06, 0x00, 0x3F, 0xFF, 0xAA, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE4, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xE9, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0x90, 0x7F, 0x05, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x7F, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x7F, 0x00,
-    0x00, 0xFD, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xFE,
-    0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x3F, 0x80,
-    0x00, 0x7F, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x1F, 0xD0, 0x00, 0x7F,
-    0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF8, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x1F,
-    0xF0, 0x02, 0xFF, 0xD0, 0x7F, 0x06, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x81, 0xFD,
-    0x00, 0x00, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x01,
-    0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00,
-    0x02, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0x40, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00,
-    0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00,
-    0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00,
-    0x02, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F,
-    0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0,
-    0x00, 0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00,
-    0x00, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00,
-    0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE,
-    0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F,
-    0x40, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x2F, 0xD0, 0x00, 0x00, 0xFE, 0x0F, 0xF8,
-    0x00, 0x1B, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1B, 0xFF,
-    0x90, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x1F, 0xC0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF1, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x1F,
-    0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF1,
-    0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F,
-    0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03,
-    0xF1, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xF1, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00,
-    0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD,
-    0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00,
-    0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0xFD, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x55, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFA, 0xAA, 0xFF, 0xF0,
-    0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFD,
-    0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F,
-    0x55, 0x50, 0x00, 0x00, 0x0F, 0xC7, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0F, 0xC7, 0xFA, 0xAA, 0xFF, 0xF0, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xBF, 0xC0, 0x0F, 0xC7,
-    0xF0, 0x00, 0x02, 0xFD, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xC7, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xC7, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0xFC, 0x7F, 0x00, 0x00,
-    0x3F, 0xC0, 0x0F, 0xC7, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F,
-    0xC7, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFC, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xC0, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x50, 0x00, 0x07,
-    0xFF, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xFA, 0xAA, 0xFF, 0xF0, 0x7F, 0x00, 0x00,
-    0xBF, 0xC7, 0xF0, 0x00, 0x02, 0xFD, 0x7F, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0xFF, 0x7F,
-    0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00,
-    0xFD, 0x7F, 0x00, 0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x1F, 0xF4, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x40,
-    0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xAA, 0xAA, 0xAB, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x24, 0x00, 0x00, 0xBF,
-    0xF0, 0x03, 0xFE, 0xAA, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xBF,
-    0xC0, 0x1F, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x07, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x7F, 0x81, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x01, 0xFD, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xF1, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x55, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xF1, 0xFE, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x1F, 0xC0, 0x00, 0x1F, 0xFE, 0xAB, 0xFF, 0xD0, 0x07, 0xF0,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAB, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x50, 0x00, 0xFD, 0x0B, 0xF8, 0x00, 0x00,
-    0xFD, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0xFD,
-    0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x0B,
-    0xF4, 0x00, 0x00, 0xFD, 0x03, 0xFE, 0x40, 0x00, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x0F, 0xF0,
-    0x00, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00,
-    0xFD, 0x01, 0xFD, 0x00, 0x00, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0xFD,
-    0x1F, 0xE0, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0xFD, 0xBF, 0x40, 0x00, 0x00, 0xFD, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xE5, 0x5B, 0xFC,
-    0x02, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x06, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFE,
-    0x55, 0xBF, 0x2F, 0xE0, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x02, 0xFD, 0xFC,
-    0x00, 0x00, 0xFF, 0x3F, 0x40, 0x00, 0x7F, 0xCF, 0xE0, 0x00, 0x7F, 0xF2, 0xFF, 0x55, 0xFD, 0xFC,
-    0x3F, 0xFF, 0xFD, 0x3F, 0x02, 0xFF, 0xF8, 0x0B, 0xC0, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x16, 0xB0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xE9,
-    0x40, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x6A, 0x90, 0x00, 0x1F,
-    0x8B, 0xFF, 0xFE, 0x00, 0x2F, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x7F, 0xF0, 0x3F, 0xF4,
-    0x00, 0x0B, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x3F, 0xC0, 0x00,
-    0x00, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x2F, 0x80, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x01, 0xFC,
-    0x0F, 0xD0, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x01,
-    0xFF, 0x95, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0x43,
-    0xFE, 0xAA, 0xBF, 0xF0, 0xFD, 0x00, 0x01, 0xFE, 0x3F, 0x40, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x0B,
-    0xF3, 0xF4, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x02, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0x40, 0x00, 0x1F, 0xCF, 0xD0,
-    0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0x7F, 0x7F, 0x40, 0x00, 0x7F, 0xCF,
-    0xFA, 0xAB, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFE, 0xAA, 0xA9, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFA, 0xAA, 0xBF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x00,
-    0x7E, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x40,
-    0x00, 0x2F, 0x40, 0x00, 0xFD, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x01, 0xFC,
-    0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xDB, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00,
-    0x03, 0xF6, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD1, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xE4, 0x6F, 0xF0,
-    0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x0F, 0xE3, 0xF8, 0x00,
-    0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFA, 0xAA, 0xAA, 0xAA, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x08, 0x02,
-    0xFF, 0xA5, 0xAF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40,
-    0xFD, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF8,
-    0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x07,
-    0xF0, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x03,
-    0xF8, 0x00, 0x00, 0x01, 0xFE, 0xBF, 0xEA, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x07, 0xF8, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x07, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xF8,
-    0x01, 0xFC, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x1F,
-    0xC0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x01, 0xFC, 0x00,
-    0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x55, 0x50, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x3F, 0x95, 0x6F, 0xF4, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x40, 0x00,
-    0x03, 0xFC, 0xBE, 0x95, 0x6F, 0xF8, 0xBF, 0xFF, 0xFF, 0xE0, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xFC, 0xFD, 0x00, 0x00, 0xFF, 0xCF,
-    0xD0, 0x00, 0x2F, 0xFC, 0xFD, 0x00, 0x03, 0xFF, 0xCF, 0xD0, 0x00, 0xBD, 0xFC, 0xFD, 0x00, 0x1F,
-    0xCF, 0xCF, 0xD0, 0x03, 0xF0, 0xFC, 0xFD, 0x00, 0x7E, 0x0F, 0xCF, 0xD0, 0x0F, 0xC0, 0xFC, 0xFD,
-    0x02, 0xF4, 0x0F, 0xCF, 0xD0, 0x3F, 0x00, 0xFC, 0xFD, 0x0F, 0xD0, 0x0F, 0xCF, 0xD1, 0xF8, 0x00,
-    0xFC, 0xFD, 0x3F, 0x00, 0x0F, 0xCF, 0xDB, 0xE0, 0x00, 0xFC, 0xFD, 0xFC, 0x00, 0x0F, 0xCF, 0xFF,
-    0x40, 0x00, 0xFC, 0xFF, 0xE0, 0x00, 0x0F, 0xCF, 0xFC, 0x00, 0x00, 0xFC, 0xFF, 0x80, 0x00, 0x0F,
-    0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0xCF, 0xD0, 0x00, 0x0F, 0xFC, 0xFD, 0x00,
-    0x02, 0xFF, 0xCF, 0xD0, 0x00, 0x3F, 0xFC, 0xFD, 0x00, 0x0B, 0xDF, 0xCF, 0xD0, 0x01, 0xFC, 0xFC,
-    0xFD, 0x00, 0x3F, 0x0F, 0xCF, 0xD0, 0x07, 0xE0, 0xFC, 0xFD, 0x00, 0xFC, 0x0F, 0xCF, 0xD0, 0x2F,
-    0x40, 0xFC, 0xFD, 0x03, 0xF0, 0x0F, 0xCF, 0xD0, 0xFD, 0x00, 0xFC, 0xFD, 0x1F, 0x80, 0x0F, 0xCF,
-    0xD3, 0xF0, 0x00, 0xFC, 0xFD, 0xBE, 0x00, 0x0F, 0xCF, 0xDF, 0xC0, 0x00, 0xFC, 0xFF, 0xF4, 0x00,
-    0x0F, 0xCF, 0xFE, 0x00, 0x00, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xCF, 0xF8, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x0F, 0xD0,
-    0xFD, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x0B, 0xF0, 0x0F, 0xD0, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF8,
-    0x00, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0xEA, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x80, 0x0F, 0xD0, 0x0B, 0xF0, 0x03, 0xF4,
-    0x00, 0xFF, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0x3F, 0xC3,
-    0xF4, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0xFF, 0x00, 0x3F, 0x00, 0x01,
-    0xFC, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x7F, 0x00,
-    0x3F, 0x00, 0x01, 0xFC, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x1F, 0x80,
-    0x00, 0x7F, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x02, 0xF4, 0x00, 0x07, 0xF0, 0x0B, 0xD0, 0x00, 0x1F,
-    0xC0, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x07, 0xFF, 0xFF,
-    0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFB, 0xFB,
-    0xE0, 0x00, 0x03, 0xFB, 0xEF, 0xDF, 0xC0, 0x00, 0x0F, 0xDF, 0xBF, 0x6F, 0x40, 0x00, 0xBD, 0x7E,
-    0xFD, 0x3F, 0x00, 0x03, 0xF1, 0xFB, 0xF4, 0xFD, 0x00, 0x1F, 0x87, 0xEF, 0xD1, 0xF8, 0x00, 0xFC,
-    0x1F, 0xBF, 0x43, 0xF0, 0x07, 0xE0, 0x7E, 0xFD, 0x0B, 0xD0, 0x2F, 0x41, 0xFB, 0xF4, 0x0F, 0xC0,
-    0xFC, 0x07, 0xEF, 0xD0, 0x3F, 0x4B, 0xD0, 0x1F, 0xBF, 0x40, 0x7E, 0x3F, 0x00, 0x7E, 0xFD, 0x00,
-    0xFE, 0xF8, 0x01, 0xFB, 0xF4, 0x02, 0xFF, 0xC0, 0x07, 0xEF, 0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xBF,
-    0x40, 0x0B, 0xF4, 0x00, 0x7E, 0xFD, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x1F, 0xFF, 0xEA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x55, 0xBF, 0xC0, 0x0B, 0xF4, 0x00, 0x1F, 0xF0, 0x0F, 0xE0,
-    0x00, 0x07, 0xF4, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00,
-    0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00,
-    0xFD, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x01, 0xFC,
-    0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0x1F, 0xF0, 0x02,
-    0xFF, 0x95, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xFE, 0xAA, 0xAA, 0xFE, 0xFD, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x03,
-    0xFB, 0xF4, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x0F, 0xEF, 0xD0, 0x00,
-    0x03, 0xFB, 0xF4, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x0F, 0xEF, 0xD0,
-    0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x0F, 0xEF,
-    0xD0, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x55,
-    0x00, 0x0F, 0xC1, 0xFF, 0xFE, 0x00, 0xFC, 0xBF, 0xFF, 0xFC, 0x0F, 0xEF, 0xD5, 0x7F, 0xF0, 0xFF,
-    0xD0, 0x00, 0xBF, 0x8F, 0xF4, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xE0, 0x00, 0x00,
-    0xFE, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F,
-    0xEF, 0xF0, 0x00, 0x01, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCF, 0xFE, 0x00, 0x0B, 0xF8, 0xFF, 0xFE,
-    0x5B, 0xFF, 0x0F, 0xDB, 0xFF, 0xFF, 0xC0, 0xFD, 0x1F, 0xFF, 0xE0, 0x0F, 0xD0, 0x05, 0x40, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFE,
-    0x02, 0xFF, 0x95, 0x7D, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x95, 0xAD,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xAA, 0xAF, 0xFA, 0xAA, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F,
-    0xD0, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4,
-    0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0,
-    0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x17, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x07, 0xFF, 0x9F, 0xE6, 0xFF, 0xC0, 0x03, 0xFD, 0x02, 0xF4, 0x0B, 0xFC, 0x03, 0xFC, 0x00,
-    0xBD, 0x00, 0xBF, 0x41, 0xFD, 0x00, 0x2F, 0x40, 0x0F, 0xF0, 0xBF, 0x00, 0x0B, 0xD0, 0x01, 0xFD,
-    0x3F, 0x80, 0x02, 0xF4, 0x00, 0x3F, 0x8F, 0xD0, 0x00, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x2F,
-    0x40, 0x02, 0xFC, 0xFD, 0x00, 0x0B, 0xD0, 0x00, 0xBF, 0x3F, 0x40, 0x02, 0xF4, 0x00, 0x3F, 0xCF,
-    0xE0, 0x00, 0xBD, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xF4, 0x7F, 0x40, 0x0B, 0xD0,
-    0x02, 0xFC, 0x0F, 0xF0, 0x02, 0xF4, 0x01, 0xFE, 0x01, 0xFF, 0x40, 0xBD, 0x02, 0xFF, 0x00, 0x1F,
-    0xFD, 0x7F, 0x9B, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x05, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00,
-    0xBF, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x7F, 0x80, 0x00, 0x03, 0xF8, 0x7F,
-    0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x01, 0xFD, 0x00,
-    0xFF, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
-    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F,
-    0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80,
-    0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
-    0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x01, 0xFE, 0xF8, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x07, 0xF3,
-    0xFC, 0x00, 0x02, 0xFC, 0xBF, 0xFA, 0xAF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x6F, 0xFF, 0x97,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03,
-    0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0,
-    0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x0F,
-    0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x0F, 0xD0,
-    0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0x06, 0xAA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFA, 0xAA, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFD, 0x00, 0x1B, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0xFD, 0x00, 0x00,
-    0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFA, 0xAF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xA4, 0x00, 0x03, 0xF7, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0F, 0xDF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x7F, 0x40, 0x01, 0xFF, 0x00, 0xFD, 0xFD, 0x00, 0x01,
-    0xFD, 0x03, 0xF7, 0xF4, 0x00, 0x03, 0xF8, 0x0F, 0xDF, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x7F, 0x40,
-    0x00, 0x3F, 0x80, 0xFD, 0xFD, 0x00, 0x01, 0xFD, 0x03, 0xF7, 0xF4, 0x00, 0x1F, 0xF0, 0x0F, 0xDF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0xFD, 0xFF, 0xFF, 0xF9, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF4, 0xFE, 0x00, 0x0B,
-    0xFC, 0xFD, 0x00, 0x01, 0xFD, 0xFD, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00,
-    0xFE, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x07, 0xFC, 0xFF, 0xAA, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x55, 0x40, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x3E, 0x55, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x06, 0xAA, 0xAA, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x7E, 0x56, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xD0, 0x02, 0xFF, 0x55, 0xBF, 0xC0, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x0F, 0xD0, 0x0B,
-    0xF0, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x8F, 0xD0, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xCF, 0xFA, 0xBF, 0xC0, 0x00, 0x01, 0xFC, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFC, 0xFE, 0x02, 0xFC, 0x00, 0x00,
-    0x1F, 0xCF, 0xD0, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xCF, 0xD0,
-    0x0F, 0xD0, 0x00, 0x03, 0xF4, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x03, 0xF8, 0x00,
-    0x1F, 0xE0, 0xFD, 0x00, 0x1F, 0xF9, 0x5F, 0xFC, 0x0F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFA, 0xAA, 0xFD, 0x0F, 0xE0,
-    0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0xFD,
-    0x2F, 0xC0, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0xFD, 0x0B, 0xFE, 0x95, 0x5F, 0xD0, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xD0, 0x01, 0xFD, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x0F, 0xD0,
-    0x0F, 0xF0, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x7F, 0x40, 0x00, 0xFD, 0x0F, 0xF0, 0x00,
-    0x0F, 0xD2, 0xFC, 0x00, 0x00, 0xFD, 0x7F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x2A, 0x80, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xE4, 0x6F,
-    0xF0, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x0F, 0xE3, 0xF8,
-    0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF3, 0xFA, 0xAA, 0xAA, 0xAA, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x08,
-    0x02, 0xFF, 0xA5, 0xAF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x7F, 0x02, 0xFC, 0x00,
-    0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x19, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFE, 0x46, 0xFF, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x1F, 0xD2, 0xFC, 0x00, 0x00,
-    0xFE, 0x3F, 0x80, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xBF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xAA, 0xAA, 0xAA, 0xA3, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x80, 0x2F, 0xFA, 0x5A, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xE4,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x01, 0x5F, 0xE5, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x7F, 0x95, 0x54, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01, 0xAA, 0x40, 0x00, 0x2F, 0x8B, 0xFF, 0xFE, 0x00, 0x0B,
-    0xEB, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xE4, 0x07, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0x80, 0x2F,
-    0xE0, 0x00, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBE,
-    0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x0B, 0xE0,
-    0x00, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x80,
-    0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xAA,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0x80,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFB, 0xFE, 0xAA, 0xA9, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFE, 0x03, 0xFF, 0x95, 0x6C, 0x0B, 0xF8, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x3F, 0xEA, 0xAA, 0xA0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x95, 0xAD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xF9, 0x56, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x06, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFD, 0x80, 0x00, 0x0F, 0xEB, 0xF9, 0x56, 0xFF, 0x2F, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x55, 0x00, 0x00, 0x0A, 0x0F, 0xE3, 0xFC, 0xFE, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD,
-    0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x19, 0x0A, 0x0F, 0xC7, 0xE3, 0xF6,
-    0xFC, 0xFC, 0x7E, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFD,
-    0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4,
-    0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x00, 0x02, 0x80, 0x00, 0xFE, 0x00, 0x0F,
-    0xF0, 0x00, 0xFE, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x3F, 0xFF,
-    0x83, 0xFF, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xEA,
-    0xAA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xFA, 0x90, 0x00, 0x01, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD,
-    0x00, 0x0B, 0xFC, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF4, 0x02, 0xF4, 0x00, 0x0F, 0xD0,
-    0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF4, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x7F, 0xCF, 0xFF, 0x40, 0x00, 0x3F, 0xEA, 0xBF, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFE, 0xAA, 0xAA, 0xFF, 0xAA, 0xAF, 0xFC, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x7F,
-    0x80, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFB, 0xF8, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0x0F,
-    0xE0, 0x00, 0x7F, 0xCF, 0xE0, 0x00, 0x03, 0xFE, 0xAB, 0xFF, 0xD3, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0x5F, 0xE5, 0x55, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x05, 0x7F, 0x95, 0x55, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01, 0xAA, 0x40, 0x00, 0x2F,
-    0x87, 0xFF, 0xFE, 0x00, 0x0B, 0xEB, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xE4, 0x07, 0xFD, 0x00, 0xBF,
-    0xD0, 0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x00, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x0B, 0xE0,
-    0x00, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x2F, 0x80,
-    0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0xBE, 0x00,
-    0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x02, 0xF8, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x8F, 0xD0, 0x00,
-    0x1F, 0xC3, 0xF4, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x0B, 0xF0, 0x0F, 0xD0,
-    0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0xEA, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x80,
-    0x0F, 0xD0, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x02,
-    0xFC, 0x0F, 0xD0, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0xAA, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xFC, 0xFD, 0x00, 0x00, 0xFF,
-    0xCF, 0xD0, 0x00, 0x2F, 0xFC, 0xFD, 0x00, 0x03, 0xFF, 0xCF, 0xD0, 0x00, 0xBD, 0xFC, 0xFD, 0x00,
-    0x1F, 0xCF, 0xCF, 0xD0, 0x03, 0xF0, 0xFC, 0xFD, 0x00, 0x7E, 0x0F, 0xCF, 0xD0, 0x0F, 0xC0, 0xFC,
-    0xFD, 0x02, 0xF4, 0x0F, 0xCF, 0xD0, 0x3F, 0x00, 0xFC, 0xFD, 0x0F, 0xD0, 0x0F, 0xCF, 0xD1, 0xF8,
-    0x00, 0xFC, 0xFD, 0x3F, 0x00, 0x0F, 0xCF, 0xDB, 0xE0, 0x00, 0xFC, 0xFD, 0xFC, 0x00, 0x0F, 0xCF,
-    0xFF, 0x40, 0x00, 0xFC, 0xFF, 0xE0, 0x00, 0x0F, 0xCF, 0xFC, 0x00, 0x00, 0xFC, 0xFF, 0x80, 0x00,
-    0x0F, 0xC0, 0x00, 0xB8, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x00, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0xD0,
-    0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00,
-    0x3F, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFE, 0x01, 0xFC,
-    0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00,
-    0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x3F,
-    0xBF, 0x40, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00,
-    0x3F, 0xBF, 0x40, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0xFE, 0xFD, 0x00,
-    0x00, 0x3F, 0xBF, 0x40, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0xFE, 0xFD,
-    0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x0F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD,
-    0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01,
-    0xFC, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x02, 0xF8, 0x0B, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00,
-    0xFE, 0xFC, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xD0,
-    0x03, 0xF4, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0x7F, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x0B,
-    0xF0, 0x0B, 0xE0, 0x7F, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0xFC, 0x03, 0xF8, 0x03, 0xF4, 0x00,
-    0x03, 0xF8, 0x1F, 0xC0, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x1F, 0xC2, 0xF4, 0x00, 0xFD, 0x0B, 0xE0,
-    0x00, 0x00, 0xFE, 0x3F, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x3F, 0x6F,
-    0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-    0x02, 0xF8, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x4F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x7F,
-    0x00, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0xBE, 0x03, 0xF4, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x03, 0xFF,
-    0x80, 0x0B, 0xE0, 0x03, 0xF4, 0x01, 0xFB, 0xF0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0xFC, 0xFD, 0x01,
-    0xFC, 0x00, 0x0F, 0xC0, 0x7D, 0x1F, 0xC0, 0xBD, 0x00, 0x02, 0xF8, 0x3F, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x3F, 0x1F, 0x40, 0xBE, 0x2F, 0x80, 0x00, 0x0B, 0xDF, 0xC0, 0x0F, 0xDF, 0xC0, 0x00, 0x00,
-    0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE5, 0x55, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF9, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFA, 0xAA, 0xFF, 0xF0, 0x00,
-    0x0F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x01,
-    0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xAB, 0xFA,
-    0xAA, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0,
-    0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x02, 0xFC,
-    0x00, 0x7F, 0xAA, 0xAB, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF9,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x06, 0xE1, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x55,
-    0x5F, 0xF5, 0x55, 0x55, 0x50, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xEA, 0xAB, 0xFD, 0x55, 0x55, 0x54, 0x00, 0x7F, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x51, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xAA, 0xFF, 0x47, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0xFD, 0x00, 0x03, 0xFF, 0x95, 0xBC, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xFF, 0xAA, 0xAA, 0x90, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x04, 0xFD, 0x00,
-    0x03, 0xFF, 0x96, 0xBD, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0x55, 0x6F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xEB, 0xFE, 0xBF, 0x40, 0x00, 0x03, 0xF4, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0xBF,
-    0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0xFE, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x07,
-    0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x40, 0x07, 0xF0, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0xBF,
-    0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x3F, 0x40,
-    0x07, 0xF0, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0xFE,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B,
-    0xE0, 0x00, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0x03, 0xFA, 0xAB, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFC, 0x3F, 0x4B, 0xE0, 0x00, 0x2F, 0x83,
-    0xF0, 0x7F, 0x00, 0x03, 0xF0, 0x3F, 0x03, 0xF8, 0x00, 0xBF, 0x03, 0xF0, 0x1F, 0xC0, 0x0F, 0xD0,
-    0x3F, 0x00, 0xFD, 0x01, 0xFC, 0x03, 0xF0, 0x0B, 0xF0, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x03, 0xF0,
-    0x03, 0xF0, 0x02, 0xF8, 0xBE, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFA, 0xF4,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0xFD,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x7F,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x2F,
-    0xC0, 0x00, 0x7F, 0x55, 0x55, 0xBF, 0x95, 0x6F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xAA, 0xAB, 0xFE, 0xBF, 0xEB,
-    0xF8, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x1F, 0x82, 0xFC, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x1F, 0x80,
-    0xFD, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x1F, 0x80, 0xBF, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x1F, 0x80,
-    0x7F, 0x40, 0x7F, 0x00, 0x2F, 0xC0, 0x1F, 0x80, 0x3F, 0x80, 0x7F, 0x00, 0x3F, 0x40, 0x1F, 0x80,
-    0x1F, 0xC0, 0x7F, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x7F, 0x00, 0xFE, 0x00, 0x1F, 0x80,
-    0x0B, 0xF0, 0x7F, 0x01, 0xFD, 0x00, 0x1F, 0x80, 0x07, 0xF4, 0x7F, 0x02, 0xFC, 0x00, 0x1F, 0x80,
-    0x03, 0xFC, 0x7F, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x7F, 0x0B, 0xF0, 0x00, 0x1F, 0x80,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xE2, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x03, 0xF0,
-    0x00, 0x3F, 0x40, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x03, 0xFE,
-    0xAA, 0xBF, 0xAA, 0xBF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFD, 0x00, 0xBF, 0x0F, 0xC3, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x3F, 0x07, 0xF0,
-    0x0F, 0xD0, 0x1F, 0xC0, 0xFC, 0x0F, 0xD0, 0x3F, 0x40, 0xFE, 0x03, 0xF0, 0x2F, 0x80, 0xFD, 0x03,
-    0xF0, 0x0F, 0xC0, 0x3F, 0x03, 0xF4, 0x2F, 0x80, 0x3F, 0x00, 0xFE, 0x0F, 0xD0, 0xFD, 0x00, 0xFC,
-    0x01, 0xFC, 0x3F, 0x47, 0xF0, 0x03, 0xF0, 0x03, 0xF4, 0xFD, 0x3F, 0x40, 0x0F, 0xC0, 0x0B, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0x55, 0x55, 0x55, 0x7F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07,
-    0xFE, 0x5F, 0xE5, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x3F, 0x40, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0xFD,
-    0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x03, 0xF4,
-    0x01, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0x80,
-    0x03, 0xF4, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x40,
-    0x02, 0xFC, 0x3F, 0xC0, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD7,
-    0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x00,
-    0xFE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xEF, 0xFB, 0xFE, 0x00, 0x01,
-    0xFD, 0x0B, 0xE0, 0x7F, 0x40, 0x03, 0xF8, 0x0B, 0xE0, 0x2F, 0xC0, 0x07, 0xF0, 0x0B, 0xE0, 0x0F,
-    0xC0, 0x0B, 0xE0, 0x0B, 0xE0, 0x0B, 0xE0, 0x0F, 0xD0, 0x0B, 0xE0, 0x07, 0xF0, 0x1F, 0xC0, 0x0B,
-    0xE0, 0x03, 0xF4, 0x3F, 0x40, 0x0B, 0xE0, 0x02, 0xF8, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0xBE,
-    0x00, 0x0B, 0xE0, 0x00, 0xFE, 0x7F, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xF0,
-    0x00, 0xBF, 0x55, 0x55, 0x55, 0x7F, 0x80, 0x7F, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x07,
-    0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00,
-    0x07, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xF4,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x3F,
-    0x80, 0x00, 0x07, 0xF5, 0x55, 0x55, 0x5B, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xAA, 0xAA, 0xFF,
-    0x9B, 0xF5, 0xBF, 0xD0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x07,
-    0xF0, 0x07, 0xF0, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x7F, 0x00,
-    0x0F, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x7F,
-    0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xBE, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-    0x7F, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x47, 0xF0, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x02,
-    0xF8, 0x7F, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC7, 0xF0, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x00, 0xFD, 0x7F, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x03, 0xF4, 0x03, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x3F,
-    0x40, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x03, 0xF4, 0x00,
-    0x03, 0xF4, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0x3F, 0xEA, 0xAA, 0xAF,
-    0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFB,
-    0xFE, 0x00, 0xFD, 0x00, 0x7F, 0x42, 0xF4, 0x1F, 0xC0, 0x3F, 0x40, 0x3F, 0x40, 0xBD, 0x02, 0xF8,
-    0x0F, 0xD0, 0x1F, 0xC0, 0x2F, 0x40, 0x3F, 0x03, 0xF4, 0x0F, 0xE0, 0x0B, 0xD0, 0x0F, 0xE0, 0xFD,
-    0x03, 0xF0, 0x02, 0xF4, 0x01, 0xFC, 0x3F, 0x42, 0xFC, 0x00, 0xBD, 0x00, 0x3F, 0x4F, 0xD0, 0xFD,
-    0x00, 0x2F, 0x40, 0x0B, 0xE3, 0xF4, 0x7F, 0x00, 0x0B, 0xD0, 0x01, 0xFC, 0xFD, 0x2F, 0x80, 0x02,
-    0xF4, 0x00, 0x3F, 0x40, 0x03, 0xE0, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x0B, 0xFE, 0x00, 0x07, 0xF4,
-    0x7F, 0x40, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xEA, 0xFF, 0xF0, 0x3F, 0x90, 0x00, 0x3F, 0xE0, 0x20,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x55, 0x5B, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x00, 0x6A,
-    0xAB, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x56,
-    0xAF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xE5, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0xEA, 0xAF, 0xFF, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x50,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x90, 0x00, 0xBE, 0x00, 0xBD, 0x00, 0xFF, 0xC0,
-    0x0F, 0xE0, 0xFE, 0x50, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0x95, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x56, 0xBF, 0xE0, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF,
-    0x80, 0x0F, 0xF5, 0x50, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF4, 0x06, 0xAA, 0xA9, 0x6D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0x0F,
-    0xDB, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF6, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0xBF, 0x00, 0x07,
-    0xF0, 0x00, 0x3F, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF6,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x6F, 0xC0, 0x01, 0xFC,
-    0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x3F,
-    0x40, 0x07, 0xF0, 0x00, 0xBF, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x7F, 0x00,
-    0x1F, 0xD0, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F, 0xF0, 0x07, 0xFD, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x03, 0xF4, 0x3F, 0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x3F,
-    0x00, 0x0B, 0xE0, 0x01, 0xFC, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x3F, 0x00, 0x0B, 0xE0, 0x00,
-    0xFC, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x3F, 0x00, 0x0B,
-    0xE0, 0x00, 0xFD, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x3F,
-    0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0xFD, 0x3F, 0x40, 0x0B, 0xE0, 0x00,
-    0xFC, 0x3F, 0x80, 0x0B, 0xE0, 0x01, 0xFC, 0x2F, 0xC0, 0x0B, 0xE0, 0x03, 0xF8, 0x0F, 0xE0, 0x0B,
-    0xE0, 0x0B, 0xF0, 0x0B, 0xF8, 0x0B, 0xE0, 0x2F, 0xE0, 0x03, 0xFF, 0xAF, 0xFB, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0,
-    0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00,
-    0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFE,
-    0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0xFE,
-    0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00,
-    0x03, 0xF7, 0xFE, 0xAA, 0xAA, 0xAF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x00, 0x3F, 0x4F, 0xC0,
-    0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F, 0xE5, 0x6F,
-    0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x02,
-    0xF8, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3F, 0x80,
-    0x00, 0x00, 0x7F, 0xC7, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0xFD, 0x00, 0x00, 0x2F, 0xD4, 0x2F, 0x80,
-    0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0xC0,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0xC0,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0xC0,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x3F,
-    0x82, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1A, 0x80, 0xAA, 0x00, 0x00, 0x03, 0xF8,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0xBD,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xC7, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0xFD, 0x00, 0x00, 0x2F, 0xD4, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x07,
-    0xF0, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x7F,
-    0x00, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x03, 0xF7, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x01, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x0B,
-    0xF0, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xFC, 0x00,
-    0x2F, 0x80, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0x00, 0xBE, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0xFC, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x0F, 0xD2, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x03, 0xFB, 0xD0, 0x00, 0x00, 0xFF, 0xFA, 0xAF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFD, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xFE, 0x56, 0xFF, 0x40, 0x3F, 0x40, 0x00, 0x07,
-    0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xBF,
-    0x00, 0x00, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF4,
-    0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFC,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x3F, 0x43, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x3F,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x07, 0xFE, 0x56,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x4F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xE0,
-    0x0A, 0x40, 0x2F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF6, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF6, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD7, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0xFD, 0x00, 0x50, 0x01, 0xFF, 0x00, 0x07, 0xFE,
-    0x0F, 0xF8, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0x07, 0xE0,
-    0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00,
-    0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x00,
-    0xFD, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0x3F, 0xC1, 0xFC, 0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x06,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xA0, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0xBF, 0xC0,
-    0x1F, 0xEB, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x09, 0x00, 0x34, 0x00, 0xBF, 0x80, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xCB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF1, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE,
-    0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xFA, 0xFF,
-    0xFF, 0xFA, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xFF, 0x90, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE5, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x43, 0xF0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x59, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xF9, 0x5E, 0x00, 0x0E, 0x56, 0xFE, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xE0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0xBE, 0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xEF, 0xE0, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0xFE, 0xBF, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0xFD, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8,
-    0x1F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x00, 0xBF, 0xE5, 0xBF, 0xFF, 0xE5, 0xBF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x34, 0x07, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFC, 0x0F, 0xE0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0x80, 0xBF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF8, 0x07,
-    0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xF0,
-    0x03, 0xF8, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x02, 0xF9, 0xFC, 0x00, 0x0F,
-    0xE0, 0x00, 0xFD, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0xBF, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0x00, 0xBE, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x3F,
-    0x80, 0x3F, 0x40, 0x00, 0x3F, 0x81, 0xFC, 0x02, 0xFC, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x2F, 0x40,
-    0x0F, 0xD0, 0xBE, 0x00, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0xBF, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x7F,
-    0x00, 0x03, 0xF6, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x57, 0xE5, 0x7D, 0x00, 0x00, 0x00, 0x03, 0x40, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x2F, 0x8F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x07, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00,
-    0xFF, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x7F, 0xD0, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0xF8,
-    0x00, 0xBE, 0x00, 0x3F, 0x40, 0x1F, 0xBF, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x0F, 0xCF, 0xD0, 0x1F,
-    0xC0, 0x00, 0xFC, 0x07, 0xD1, 0xFC, 0x0B, 0xD0, 0x00, 0x2F, 0x83, 0xF0, 0x3F, 0x03, 0xF0, 0x00,
-    0x03, 0xF1, 0xF4, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFA, 0xB8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x0B, 0xFE, 0x56, 0xF8,
-    0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x96, 0xC0, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x02, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x2F,
-    0x40, 0x00, 0x0B, 0xFD, 0x3F, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC7, 0xFE, 0x00,
-    0x00, 0x2F, 0x40, 0x7D, 0x0D, 0x00, 0x3F, 0x00, 0x04, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x1F, 0xF9,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xBF, 0xE0, 0x00, 0x00, 0x7E, 0x0B, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0xB0,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0xD3, 0xFF, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x2F, 0xFF, 0x41, 0x6F, 0xFF, 0xFF, 0x0F, 0xFF, 0x80, 0x7D, 0x3F, 0x90, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xF3, 0xF4, 0xB8, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0x0F, 0xC7,
-    0xF4, 0x7E, 0x0F, 0x4B, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x3F, 0xFF,
-    0xE4, 0x0B, 0xE6, 0xFF, 0xFE, 0xF8, 0x00, 0xBF, 0xF6, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x74, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x3D, 0x57, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x95, 0xB8, 0x00, 0x00, 0x74, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x3C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x3C, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x7C, 0x74, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x74, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x40, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x6F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00,
-    0x01, 0xA4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x02, 0xFD, 0x46, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFF,
-    0xF0, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xAF, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF3, 0xF0, 0x07, 0xF0,
-    0x00, 0x01, 0xFD, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x83, 0xF0, 0x07, 0xF0, 0x00, 0x0F, 0xF0,
-    0x3F, 0x00, 0x7F, 0x00, 0x01, 0xFD, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x7F,
-    0x00, 0x0B, 0xF0, 0x03, 0xF0, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x3F, 0x80,
-    0x03, 0xF0, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x03, 0xF0, 0x07,
-    0xE0, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0x7E, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x07, 0xE1, 0xFD, 0x00,
-    0x00, 0x3F, 0x00, 0x7E, 0x3F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xEB, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0xE7, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x15, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xD0, 0x00, 0x3F,
-    0x7F, 0x00, 0xFD, 0x00, 0x0B, 0xD3, 0xF0, 0x0F, 0xD0, 0x01, 0xFC, 0x3F, 0x00, 0xFD, 0x00, 0x3F,
-    0x03, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x3F, 0x00, 0xFD, 0x01, 0xFC, 0x03, 0xF0, 0x0F, 0xD0, 0x3F,
-    0x40, 0x3F, 0x00, 0xFD, 0x0B, 0xE0, 0x03, 0xF0, 0x0F, 0xD0, 0xFC, 0x00, 0x3F, 0x00, 0xFD, 0x3F,
-    0x40, 0x03, 0xF0, 0x0F, 0xC7, 0xE0, 0x00, 0x3F, 0x00, 0xFD, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xFF,
-    0x40, 0x00, 0x3F, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xD5, 0x54, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2A, 0xFE, 0xAA, 0x80,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD5, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFE, 0xAA, 0xAF, 0xFE, 0x00, 0x1F, 0xC0,
-    0x00, 0x1F, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x01, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x1F,
-    0xC0, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xC0, 0x00, 0x7F, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
-    0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0x5F, 0xE5, 0x54, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x90, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFD,
-    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF4,
-    0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xEA, 0xAB, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xE9, 0x40, 0x01, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xC0, 0x01, 0xBF, 0xE0, 0x7F, 0x00, 0x00, 0x3F,
-    0xD1, 0xFC, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x7F,
-    0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x07, 0x80, 0xFE, 0x1F, 0xC0, 0x3F,
-    0x87, 0xF4, 0x7F, 0x00, 0x3F, 0xBF, 0xC1, 0xFD, 0x55, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xAA, 0x94, 0xFC, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x07, 0xF0,
-    0x00, 0x02, 0xE0, 0x1F, 0xC0, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x0F, 0xC1,
-    0xFF, 0xFE, 0x00, 0xFC, 0x7F, 0xFF, 0xFC, 0x0F, 0xEF, 0xD5, 0x7F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F,
-    0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x00, 0xFE, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x08, 0x0F, 0xEF, 0xF0, 0x03,
-    0xE0, 0xFD, 0xFF, 0x80, 0x2F, 0xAF, 0xCF, 0xFE, 0x00, 0xFF, 0xF8, 0xFF, 0xFE, 0x5B, 0xFF, 0x0F,
-    0xDB, 0xFF, 0xFF, 0xC0, 0xFD, 0x1F, 0xFF, 0xFD, 0x0F, 0xD0, 0x05, 0x43, 0xF0, 0xFD, 0x00, 0x00,
-    0x1F, 0x8F, 0xD0, 0x00, 0x00, 0xA0, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x0B, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFE, 0x55, 0x55, 0x3F, 0x40, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2B,
-    0xFE, 0xAA, 0xA8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFD, 0x03, 0xFE, 0xAA, 0xA9, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x17, 0xF9,
-    0x55, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xC0, 0x17, 0xF9, 0x55, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x6A, 0xA9,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFD, 0x41, 0x6F,
-    0xFF, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xC0, 0x00, 0x03, 0xFD, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0xC1, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00,
-    0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x10, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xEA, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xAA, 0xAA,
-    0x40, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0x50, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFE, 0x41, 0xBF, 0xF0, 0xFD, 0x00, 0x0B, 0xF8, 0xFD, 0x00, 0x03, 0xFC, 0xFD, 0x00, 0x00,
-    0xFD, 0xFD, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x01, 0x40, 0x0B, 0xF4, 0x02, 0xFE, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x07, 0xD0, 0x00, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0xFE, 0x00, 0x0B, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xBE, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBE, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x0B, 0xE0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBE, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x4B, 0xE1, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0xBE, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xEB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0xBE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0xBE, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xE0, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xE0, 0x03, 0xFC, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x40,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F,
-    0xFF, 0xC3, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0xBF, 0x40, 0x00, 0x0B, 0xE0, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80,
-    0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF0, 0x0B,
-    0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0xBE, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xE0,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xBE, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xE7, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xEF, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0xBE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xE0, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0xBE, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x1F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0xBE, 0x00, 0x0F, 0xFA, 0x82, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0xFD, 0xBF, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xAF, 0xFF, 0xC0, 0x1E, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x55, 0x5B, 0xFD, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x40,
-    0x00, 0x15, 0x6A, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x64, 0x00, 0x00, 0x7F, 0xD2,
-    0xFF, 0xAA, 0xBF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x16,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x3F, 0x95, 0x6F, 0xF4, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x40, 0x00, 0x03,
-    0xFC, 0xBE, 0x95, 0x6F, 0xF8, 0xBF, 0xFF, 0xFF, 0xE0, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x1F,
-    0xE0, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0xBF,
-    0x40, 0x00, 0x07, 0xF0, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF1, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x1F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F,
-    0x00, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x07,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0xE7, 0xF0, 0x00, 0x00, 0x3F, 0xFE,
-    0x7F, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x07, 0xF4, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0xFD, 0x03, 0xF8,
-    0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x0F, 0xD0, 0xFE, 0x00,
-    0x00, 0xFD, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x1F, 0xE0, 0x00, 0xFD, 0x00, 0x7F, 0x40, 0x0F, 0xD0,
-    0x02, 0xFD, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xDF, 0xD0, 0x00, 0x2F, 0xFD, 0xFD, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD,
-    0x7F, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x01, 0xFE, 0x07, 0xF0, 0x00, 0x01, 0xFE, 0x01,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x06, 0x40, 0xFF, 0x00, 0x1F, 0xC2, 0xE0, 0xFF, 0x00, 0x07,
-    0xF0, 0xB8, 0xFF, 0x00, 0x01, 0xFC, 0x2E, 0xFF, 0x00, 0x00, 0x7F, 0x0B, 0xFF, 0x40, 0x00, 0x1F,
-    0xC2, 0xFF, 0x40, 0x00, 0x07, 0xF0, 0xFF, 0x40, 0x00, 0x01, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x7F,
-    0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF3, 0xFC, 0x00, 0x00, 0x01, 0xFC,
-    0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0xC0, 0x00, 0x07, 0xF0,
-    0xBF, 0xF8, 0x00, 0x01, 0xFC, 0x2E, 0xBF, 0x80, 0x00, 0x7F, 0x0B, 0x8B, 0xF4, 0x00, 0x1F, 0xC2,
-    0xD0, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00,
-    0x00, 0x0F, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x0F, 0xD0, 0xA0, 0x7F, 0x43, 0xF4, 0x7C, 0x3F, 0x40, 0xFD,
-    0x1F, 0x3F, 0x40, 0x3F, 0x47, 0xFF, 0x80, 0x0F, 0xD1, 0xFF, 0x80, 0x03, 0xF4, 0x7F, 0xC0, 0x00,
-    0xFD, 0x2F, 0xC0, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFB, 0xFC, 0x00,
-    0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0x47, 0xF8, 0x00, 0x0F, 0xD1, 0xFF, 0x80, 0x03, 0xF4, 0x7F,
-    0xF4, 0x00, 0xFD, 0x1F, 0x7F, 0x40, 0x3F, 0x47, 0xCB, 0xF4, 0x0F, 0xD1, 0xF0, 0xBF, 0x03, 0xF4,
-    0x14, 0x0B, 0xF0, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x6B, 0xFE, 0xA4, 0x00, 0xBF, 0x00,
-    0xBF, 0xFF, 0xF8, 0x01, 0xFD, 0x00, 0xBF, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x16, 0xFD, 0x50, 0x0B,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC,
-    0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xFD, 0x57, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x57, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x01, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x17, 0xF9, 0x55, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x1F,
-    0xD0, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00,
-    0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0xBF, 0x00, 0x00, 0x03,
-    0xF6, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0xFF, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x1F, 0xE0, 0x00, 0x03, 0xF4, 0x07,
-    0xF4, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x40, 0x03, 0xF4, 0x00, 0x2F,
-    0xC0, 0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0x8B, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xF0, 0x7F, 0xFF, 0xF4, 0x00, 0x1F, 0xC0, 0x2A, 0xAB, 0xF4,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x00,
-    0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xF6, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF7,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x40, 0x00, 0x00,
-    0x03, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFD, 0x55,
-    0x55, 0x55, 0xBF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFA, 0xAA, 0xAA, 0xAA, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x5F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD7, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x0F, 0xD0,
-    0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x40,
-    0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0xFD, 0x00,
-    0x00, 0x0B, 0xE0, 0x3F, 0xEA, 0xAA, 0xAB, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x00,
-    0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00,
-    0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0xFB, 0xF4, 0x00, 0x00, 0x2F, 0xFE, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x7F, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x55, 0x55, 0x55, 0x6F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xAA, 0xAA, 0xAA, 0xAF, 0xC0, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFF, 0xFF,
-    0xCF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF3, 0xF4, 0x00, 0x00, 0x2F, 0xEA, 0xA8, 0xFD, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0xEA, 0xAA, 0xAB,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFE,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40,
-    0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x55, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xAA, 0xA4, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xBF, 0x55, 0x5B, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0xC0, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xAA, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xEA, 0xA4, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0xFD, 0x00, 0x00, 0x3F,
-    0x91, 0x6F, 0xF0, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x01, 0xFF, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00,
-    0x1F, 0xD3, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF3, 0xF4,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x01, 0xBA, 0x40, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0xFC,
-    0x03, 0xF4, 0x00, 0x0B, 0xF8, 0x2F, 0xE0, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x0B, 0xF0, 0x00,
-    0x1F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x3F, 0x80, 0x02,
-    0xF8, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0xBF, 0x00,
-    0x03, 0xF8, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x7F, 0x00, 0x02, 0xFC, 0x00,
-    0x3F, 0x83, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0xFD, 0x00, 0xBF, 0x02, 0xFD,
-    0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x7F, 0xC0, 0x03, 0xFC,
-    0xBF, 0x80, 0x02, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xEA, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xE5, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x50,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xE5, 0x50, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0x7F, 0xFF, 0x42, 0xFC, 0x00,
-    0x7F, 0xEF, 0xF0, 0xBE, 0x00, 0x3F, 0x80, 0xFE, 0x3F, 0x80, 0x0F, 0xC0, 0x1F, 0xCF, 0xD0, 0x07,
-    0xF0, 0x03, 0xF3, 0xF4, 0x01, 0xFC, 0x00, 0xFC, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x2F, 0x80, 0x1F,
-    0xC0, 0x1F, 0xCB, 0xF0, 0x03, 0xF4, 0x0B, 0xE0, 0xFC, 0x00, 0xBE, 0x03, 0xF4, 0x3F, 0xC0, 0x1F,
-    0xD3, 0xFC, 0x03, 0xF8, 0x02, 0xFF, 0xFC, 0x00, 0x7F, 0xE5, 0xBF, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xAA, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x15, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xD0, 0x00, 0x6E, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF,
-    0x42, 0xFF, 0x95, 0xBC, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40, 0xBF, 0xFF, 0xFD,
-    0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0xFD, 0x55, 0x54, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA, 0xBF, 0xEA, 0xA8,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xFE, 0x90, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x1F, 0x87, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00,
-    0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x07,
-    0xF3, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF4,
-    0x3F, 0x40, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x0F,
-    0xE0, 0x00, 0x2F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x02, 0xF8,
-    0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x87, 0xE0, 0x00, 0x00, 0x1F, 0xCF, 0xD0,
-    0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x87, 0xF4, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00,
-    0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0,
-    0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x05, 0x57, 0xF9, 0x55, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xAA, 0xBF, 0xAA, 0xA0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0x07, 0xF0,
-    0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x07,
-    0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x01, 0xFC,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x00, 0x0F, 0xCF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xAA, 0xFE, 0xAA, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0xFF,
-    0x00, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x2F,
-    0xC0, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x5F, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x3F, 0x80, 0x00, 0x01, 0xFC, 0x07, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xF0, 0x7F, 0x40, 0x00, 0x2F, 0xFC, 0x3F, 0x80, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x15,
-    0x55, 0xFE, 0x55, 0x55, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xF4, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xD0, 0x0A, 0xAB, 0xFE, 0xAA, 0x80, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFA, 0x40,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xFD, 0x00, 0x00, 0x00,
-    0xBD, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00,
-    0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x3F,
-    0x80, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xFD, 0x00, 0x00, 0x1B, 0xF8, 0x03, 0xFE, 0x55, 0x6F,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x6A,
-    0xA4, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC,
-    0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x00, 0x0B, 0xF0,
-    0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x07, 0xFF, 0x00,
-    0x7F, 0xE5, 0x6F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xEB, 0xF0, 0x00, 0x7F, 0xFF, 0x82, 0xFC, 0x00,
-    0x00, 0x54, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0xFD, 0x00,
-    0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00,
-    0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00,
-    0xFE, 0xFD, 0x00, 0x64, 0x00, 0xFE, 0xFD, 0x00, 0x7C, 0x00, 0xFE, 0xFD, 0x00, 0x7C, 0x00, 0xFE,
-    0xFD, 0x00, 0x7C, 0x00, 0xFE, 0xFF, 0x00, 0x7C, 0x00, 0xFE, 0xBF, 0x40, 0x7C, 0x02, 0xFE, 0x3F,
-    0xF5, 0xBE, 0xBF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF9, 0xFE, 0x00, 0x1A,
-    0xFD, 0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0xFE, 0x00, 0x00, 0x7C,
-    0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x0F, 0xE3, 0xF0, 0x00,
-    0x00, 0xFE, 0x3F, 0x00, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x00, 0xFE, 0x3F, 0x01, 0xA0, 0x0F, 0xE3,
-    0xF0, 0x1F, 0x00, 0xFE, 0x3F, 0x01, 0xF0, 0x0F, 0xE3, 0xF4, 0x1F, 0x00, 0xFE, 0x3F, 0x81, 0xF0,
-    0xBF, 0xE2, 0xFF, 0x6F, 0xBF, 0xFE, 0x0F, 0xFF, 0xFF, 0xDF, 0xE0, 0x2F, 0xFF, 0xE0, 0xFE, 0x00,
-    0x16, 0xF0, 0x0F, 0xE0, 0x00, 0x1F, 0x00, 0xFE, 0x00, 0x01, 0xF0, 0x0F, 0xE0, 0x00, 0x1F, 0x00,
-    0xFE, 0x00, 0x00, 0xA0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x01, 0x55, 0x00, 0x07, 0xF1, 0xBF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xE9, 0xAF, 0xFC, 0x1F, 0xF9, 0x00, 0x00, 0x7F, 0x87, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00,
-    0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x68, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x55, 0x00, 0x0F, 0xD1, 0xFF, 0xFF, 0x40, 0xFD, 0xBF, 0xFF, 0xFD, 0x0F, 0xEF,
-    0xE5, 0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F,
-    0xCF, 0xF0, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xE4, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x2F, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF7,
-    0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xAF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE4, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x07, 0xFF, 0xEA, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x95, 0xBF, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x0F,
-    0xF0, 0x2E, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x3E, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x3E, 0x0F, 0xE0,
-    0x00, 0x02, 0xFC, 0x3F, 0x4F, 0xD0, 0x00, 0x01, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6F, 0xEA, 0xAA, 0xAA, 0xA8, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0xBF, 0xE9, 0x6B, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xCF,
-    0xC0, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x07, 0xFF,
-    0xEA, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x95, 0xBF, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x2E, 0x03, 0xF4, 0x00, 0x03, 0xF4,
-    0x3E, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x3E, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x3F, 0x4F, 0xD0, 0x00,
-    0x01, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6F,
-    0xEA, 0xAA, 0xAA, 0xA8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x20, 0x00, 0x00, 0xFF, 0xE9, 0x6B, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC1, 0xBF, 0xF9, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x06, 0xFE, 0x41, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x5B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x2F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8,
-    0x00, 0x2F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xF8, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x57, 0xFD, 0x5F, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xF5, 0x7F, 0xD5, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xF8, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xF8,
-    0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x2F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x02,
-    0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00,
-    0x02, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0xC0, 0x0B, 0xF0,
-    0x00, 0x02, 0xF8, 0x00, 0x01, 0xFE, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xF0, 0x3F,
-    0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x7D, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00,
-    0xFD, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00,
-    0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-    0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x41,
-    0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFA, 0xFF, 0xAB, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x1F, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x1F, 0xC0, 0x3F, 0xC0, 0x00,
-    0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x07, 0xF4,
-    0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x02, 0xFD,
-    0x07, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xF0, 0x00, 0x07, 0xF8,
-    0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x0F, 0xF0,
-    0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0,
-    0x00, 0x00, 0x7F, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x80,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xAA,
-    0xBF, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x6F, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0x00,
-    0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F,
-    0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x04, 0x00, 0x0B, 0xFC,
-    0x00, 0x01, 0xFE, 0xAF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x4F,
-    0xD0, 0x00, 0x7F, 0x43, 0xF4, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x80,
-    0x0F, 0xD0, 0x3F, 0x80, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x3F, 0x6F, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xAA, 0xBF, 0xF4, 0x3F, 0x40,
-    0x01, 0xFF, 0x0F, 0xD0, 0x00, 0x0F, 0xF3, 0xF4, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x00, 0x3F, 0x7F,
-    0x40, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x04, 0x00, 0x3F, 0xC0, 0x03, 0xFA, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x97, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xF7, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0xAA, 0xBF, 0x40, 0x00, 0x0F,
-    0xC0, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0x80, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x00,
-    0x2F, 0x40, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40,
-    0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x5F, 0xF0, 0x00, 0x03, 0xFF,
-    0xEB, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF5,
-    0x55, 0x55, 0x56, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x04, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFE, 0xAF, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0xBE,
-    0xFD, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00,
-    0x00, 0xBE, 0xFD, 0x00, 0x00, 0x0B, 0xEF, 0xFA, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00,
-    0x0B, 0xEF, 0xD0, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0xBE, 0xFD,
-    0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x08, 0x00, 0xBF, 0x40, 0x00, 0xFE, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFD,
-    0x55, 0x55, 0x55, 0xBF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFA, 0xAA, 0xAA, 0xAA, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x9F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD7, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00,
-    0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0,
-    0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0xBE,
-    0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xFA, 0xAA, 0xAA, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xD0, 0x00, 0x00,
-    0xBE, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x00,
-    0x0B, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xCF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFC, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD,
-    0x00, 0x00, 0x00, 0xBD, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00,
-    0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00,
-    0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00,
-    0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xFE,
-    0xBF, 0x40, 0x00, 0x06, 0xFE, 0x3F, 0xE5, 0x56, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x1A, 0xA9, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0x0B, 0xF3, 0xF0, 0x00, 0x00, 0xBF,
-    0x3F, 0x00, 0x00, 0x0B, 0xF3, 0xF0, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0x0B, 0xF3, 0xF0, 0x00,
-    0x00, 0xBF, 0x3F, 0x00, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xBF, 0x3F, 0xC0, 0x00, 0x7F, 0xF1,
-    0xFF, 0x95, 0xBF, 0xFF, 0x0B, 0xFF, 0xFF, 0xEB, 0xF0, 0x1F, 0xFF, 0xE0, 0xBF, 0x00, 0x05, 0x40,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x7E, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0xBD, 0xFD, 0x00, 0x7E, 0x7F, 0x00, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0xFD, 0x00, 0x7E, 0x2F, 0xC0, 0x00,
-    0x02, 0xF4, 0xFD, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x7F, 0x0F, 0xE0, 0x00,
-    0x0B, 0xE0, 0xFD, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x7F, 0x03, 0xF4, 0x00,
-    0x1F, 0xC0, 0xFD, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0xFD, 0x00, 0x7F, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x7F, 0x00,
-    0xFC, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x2F, 0x82,
-    0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x0F, 0xD7,
-    0xE0, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x0B, 0xEB, 0xD0, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0xFF, 0xFC, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x7F, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xEF, 0x40, 0x00, 0x1F, 0xBF, 0x00, 0xFD, 0xFC, 0x00, 0x03, 0xF7,
-    0xF0, 0x0F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0xFC, 0x7E, 0x00, 0x0B, 0xD3, 0xF0, 0x0F, 0xC3,
-    0xF0, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x2F, 0x40, 0x1F, 0x83, 0xF0, 0x0F, 0xC0, 0xF8, 0x03, 0xF0,
-    0x3F, 0x00, 0xFC, 0x0F, 0xC0, 0x7F, 0x03, 0xF0, 0x0F, 0xC0, 0x7E, 0x0B, 0xD0, 0x3F, 0x00, 0xFC,
-    0x03, 0xF0, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x2F, 0x5F, 0x80, 0x3F, 0x00, 0xFC, 0x00, 0xFB, 0xF0,
-    0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0xCF,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xFC, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC1,
-    0xBF, 0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x06, 0xFE, 0x41, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF9, 0x6F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80,
-    0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF,
-    0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00,
-    0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0xB8, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0x94, 0x6F, 0xF0,
-    0x02, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1A, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xE9,
-    0x51, 0xFC, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x07, 0xF7, 0xF0,
-    0x00, 0x02, 0xFC, 0xFD, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x01, 0xFF, 0xCB, 0xFD, 0x57, 0xFB, 0xF0,
-    0xFF, 0xFF, 0xF8, 0xBC, 0x0B, 0xFF, 0xF4, 0x2F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x01, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00,
-    0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B,
-    0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x14, 0x00, 0x50, 0x00, 0x2F, 0x80, 0x7E, 0x00, 0x0B, 0xE0, 0x2F, 0xC0, 0x01, 0xF4, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0x94, 0x6F, 0xF0, 0x02, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x1A, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xE9, 0x51, 0xFC,
-    0xBF, 0x80, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x02,
-    0xFC, 0xFD, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x01, 0xFF, 0xCB, 0xFD, 0x57, 0xFB, 0xF0, 0xFF, 0xFF,
-    0xF8, 0xBC, 0x0B, 0xFF, 0xF4, 0x2F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xE5, 0x55, 0x54, 0x00, 0x00, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xE5, 0x55, 0x54, 0x00, 0x0B, 0xF5, 0x55, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x54, 0x00, 0x00, 0x55, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x00, 0x3F, 0x91, 0x7F, 0xEF, 0xE4, 0x6F,
-    0xE0, 0x01, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xD0, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xE5, 0x43, 0xFE, 0xAA, 0xAA, 0xA9, 0x2F, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xBF, 0xC0, 0x00, 0x14, 0x2F, 0xF5, 0x6F, 0xE1, 0xFF, 0xA5,
-    0xBF, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0x54, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xF0,
-    0x02, 0xFD, 0x5F, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x02, 0xF0, 0x00, 0xF4, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x17,
-    0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x02, 0xFC, 0xBF,
-    0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01,
-    0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x90, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xBF, 0x55, 0x55, 0x55, 0x55, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0xBF,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF8, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0xC0, 0x07, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xEA, 0xBF, 0xFD, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
-    0xF9, 0x56, 0xFF, 0x80, 0x04, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC2, 0xAA, 0xAA, 0xAA, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFD,
-    0x00, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x00, 0xBE, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x3F, 0xE5, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x90, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0x55, 0x55, 0x55, 0x55, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xEA, 0xBF, 0xFD, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x03, 0xF4, 0x0B, 0xD0, 0x00, 0x0F, 0xD0, 0x3F, 0x80,
-    0x00, 0x2F, 0x00, 0xBD, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFF,
-    0xE0, 0x00, 0xFE, 0x55, 0xBF, 0xE0, 0x01, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0xAA, 0xAA, 0xAA, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0x2F, 0x82, 0xFC, 0x00, 0x00, 0xFD, 0x07,
-    0xF0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x0F, 0xF9, 0x5F, 0xF8, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x81, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07,
-    0xF0, 0x0B, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x80, 0x00,
-    0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x80,
-    0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x2F,
-    0x80, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x2F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B,
-    0xF5, 0x7F, 0xD5, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x57, 0xFD, 0x5F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xF8, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x02, 0xF8, 0x00, 0x7F,
-    0x40, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x02, 0xF8,
-    0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xE0, 0x1F, 0xD0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x7F,
-    0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00,
-    0x7F, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x07, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFA, 0xFF, 0xAB, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0x81, 0xFC, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x01,
-    0xFC, 0x00, 0xBF, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x1F, 0xC0,
-    0x00, 0xFD, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x50, 0x00, 0x40, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x00,
-    0x7E, 0x01, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xEB, 0xFF, 0xF0, 0x07, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x15, 0x56, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0x05, 0x5A, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0x19, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xEA, 0xAF, 0xFF, 0x82, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00,
-    0x07, 0xF0, 0x0F, 0xC0, 0x07, 0xF0, 0x1F, 0xC0, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x3F, 0x95, 0x6F, 0xF4, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x40, 0x00, 0x03, 0xFC,
-    0xBE, 0x95, 0x6F, 0xF8, 0xBF, 0xFF, 0xFF, 0xE0, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x15, 0x40, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0x5A, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x29, 0x00, 0x00,
-    0x0F, 0xF8, 0xBF, 0xE5, 0x5B, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xBF, 0xFF, 0xFE, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x42, 0xAA, 0xAA, 0xAF, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x79, 0x00, 0x07, 0xFE, 0x07, 0xFF,
-    0xEF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x05, 0x55, 0x55,
-    0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x55, 0x55,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xE7, 0xF0, 0x00,
-    0x00, 0x0F, 0xFE, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0xE7, 0xF0, 0x00, 0x00, 0x7F, 0x7E, 0x7F, 0x00,
-    0x00, 0x0F, 0xD7, 0xE7, 0xF0, 0x00, 0x02, 0xF8, 0xBE, 0x7F, 0x00, 0x00, 0x3F, 0x0B, 0xE7, 0xF0,
-    0x00, 0x0F, 0xD0, 0xBE, 0x7F, 0x00, 0x01, 0xFC, 0x0B, 0xE7, 0xF0, 0x00, 0x3F, 0x00, 0xBE, 0x7F,
-    0x00, 0x0F, 0xE0, 0x0B, 0xE7, 0xF0, 0x01, 0xFC, 0x00, 0xBE, 0x7F, 0x00, 0x3F, 0x00, 0x0B, 0xE7,
-    0xF0, 0x0B, 0xE0, 0x00, 0xBE, 0x7F, 0x01, 0xFC, 0x00, 0x0B, 0xE7, 0xF0, 0x3F, 0x40, 0x00, 0xBE,
-    0x7F, 0x0B, 0xE0, 0x00, 0x0B, 0xE7, 0xF1, 0xFC, 0x00, 0x00, 0xBE, 0x7F, 0x3F, 0x40, 0x00, 0x0B,
-    0xE7, 0xFB, 0xE0, 0x00, 0x00, 0xBE, 0x7F, 0xFC, 0x00, 0x00, 0x0B, 0xE7, 0xFF, 0x40, 0x00, 0x00,
-    0xBE, 0x7F, 0xF0, 0x00, 0x00, 0x0B, 0xE7, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x80, 0x00, 0x00,
-    0x0B, 0xE0, 0x01, 0x55, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x15, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x7F, 0xCF, 0xD0, 0x00, 0x0F, 0xFC, 0xFD, 0x00, 0x02, 0xFF, 0xCF, 0xD0, 0x00, 0x3F, 0xFC, 0xFD,
-    0x00, 0x0B, 0xDF, 0xCF, 0xD0, 0x01, 0xFC, 0xFC, 0xFD, 0x00, 0x3F, 0x0F, 0xCF, 0xD0, 0x07, 0xE0,
-    0xFC, 0xFD, 0x00, 0xFC, 0x0F, 0xCF, 0xD0, 0x2F, 0x40, 0xFC, 0xFD, 0x03, 0xF0, 0x0F, 0xCF, 0xD0,
-    0xFD, 0x00, 0xFC, 0xFD, 0x1F, 0x80, 0x0F, 0xCF, 0xD3, 0xF0, 0x00, 0xFC, 0xFD, 0xBE, 0x00, 0x0F,
-    0xCF, 0xDF, 0xC0, 0x00, 0xFC, 0xFF, 0xF4, 0x00, 0x0F, 0xCF, 0xFE, 0x00, 0x00, 0xFC, 0xFF, 0xC0,
-    0x00, 0x0F, 0xCF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0xE7, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0xE7, 0xF0,
-    0x00, 0x00, 0x7F, 0x7E, 0x7F, 0x00, 0x00, 0x0F, 0xD7, 0xE7, 0xF0, 0x00, 0x02, 0xF8, 0xBE, 0x7F,
-    0x00, 0x00, 0x3F, 0x0B, 0xE7, 0xF0, 0x00, 0x0F, 0xD0, 0xBE, 0x7F, 0x00, 0x01, 0xFC, 0x0B, 0xE7,
-    0xF0, 0x00, 0x3F, 0x00, 0xBE, 0x7F, 0x00, 0x0F, 0xE0, 0x0B, 0xE7, 0xF0, 0x01, 0xFC, 0x00, 0xBE,
-    0x7F, 0x00, 0x3F, 0x00, 0x0B, 0xE7, 0xF0, 0x0B, 0xE0, 0x00, 0xBE, 0x7F, 0x01, 0xFC, 0x00, 0x0B,
-    0xE7, 0xF0, 0x3F, 0x40, 0x00, 0xBE, 0x7F, 0x0B, 0xE0, 0x00, 0x0B, 0xE7, 0xF1, 0xFC, 0x00, 0x00,
-    0xBE, 0x7F, 0x3F, 0x40, 0x00, 0x0B, 0xE7, 0xFB, 0xE0, 0x00, 0x00, 0xBE, 0x7F, 0xFC, 0x00, 0x00,
-    0x0B, 0xE7, 0xFF, 0x40, 0x00, 0x00, 0xBE, 0x7F, 0xF0, 0x00, 0x00, 0x0B, 0xE7, 0xFC, 0x00, 0x00,
-    0x00, 0xBE, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x10, 0x00, 0x40, 0x00, 0x1F, 0x80, 0x7E,
-    0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F,
-    0xCF, 0xD0, 0x00, 0x0F, 0xFC, 0xFD, 0x00, 0x02, 0xFF, 0xCF, 0xD0, 0x00, 0x3F, 0xFC, 0xFD, 0x00,
-    0x0B, 0xDF, 0xCF, 0xD0, 0x01, 0xFC, 0xFC, 0xFD, 0x00, 0x3F, 0x0F, 0xCF, 0xD0, 0x07, 0xE0, 0xFC,
-    0xFD, 0x00, 0xFC, 0x0F, 0xCF, 0xD0, 0x2F, 0x40, 0xFC, 0xFD, 0x03, 0xF0, 0x0F, 0xCF, 0xD0, 0xFD,
-    0x00, 0xFC, 0xFD, 0x1F, 0x80, 0x0F, 0xCF, 0xD3, 0xF0, 0x00, 0xFC, 0xFD, 0xBE, 0x00, 0x0F, 0xCF,
-    0xDF, 0xC0, 0x00, 0xFC, 0xFF, 0xF4, 0x00, 0x0F, 0xCF, 0xFE, 0x00, 0x00, 0xFC, 0xFF, 0xC0, 0x00,
-    0x0F, 0xCF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF,
-    0xC0, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xFF,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x02, 0xF4, 0x0B, 0xD0,
-    0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x07, 0xF8, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x00, 0x3F, 0x7F, 0x80,
-    0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00,
-    0x3F, 0xBF, 0x80, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x0F, 0xC3,
-    0xF4, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x1F, 0xF9,
-    0x5B, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0,
-    0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00,
-    0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFE,
-    0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0xFE,
-    0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00,
-    0x03, 0xF7, 0xFE, 0xAA, 0xAA, 0xAF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x00, 0x3F, 0x4F, 0xC0,
-    0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F, 0xE5, 0x6F,
-    0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0xBF, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F,
-    0xF8, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x0F,
-    0xF0, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0xEA, 0xAF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00,
-    0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x10,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x07,
-    0xF8, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00,
-    0x00, 0x3F, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0xFF, 0xAA, 0xAA, 0xAB, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0x03, 0xF6, 0xFC,
-    0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00,
-    0x3F, 0xC0, 0x1F, 0xF9, 0x5B, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00,
-    0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x01, 0xE4, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A,
-    0xAA, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x02,
-    0x40, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xEA, 0xAF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x3E, 0x55, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x06, 0xAA, 0xAA, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x7E,
-    0x56, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x2F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xE0,
-    0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFE,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00,
-    0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00,
-    0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F,
-    0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00,
-    0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00,
-    0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x07,
-    0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0xBF, 0x02, 0xFC,
-    0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x00, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0xD0,
-    0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00,
-    0x3F, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFE, 0x01, 0xFC,
-    0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00,
-    0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x2A,
-    0x80, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x3F,
-    0x41, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00,
-    0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x00,
-    0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x06, 0xA0, 0x00, 0x01,
-    0xFC, 0x0F, 0xF0, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x0F, 0x80,
-    0xBD, 0x00, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B,
-    0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0,
-    0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBB, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x3F, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00,
-    0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00,
-    0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00,
-    0xFE, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x2F, 0xD0, 0x00, 0x00, 0xFE,
-    0x0F, 0xF8, 0x00, 0x1B, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x1B, 0xFF, 0x90, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x50, 0x01, 0x40, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x2F,
-    0xC0, 0xBF, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x07, 0xFB, 0xE0, 0x00, 0x01, 0xFE, 0xF8, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x1F, 0xCF, 0xF0,
-    0x00, 0x0B, 0xF2, 0xFF, 0xEA, 0xBF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x01, 0xBF, 0xFE, 0x5F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFE, 0xAA, 0xA9, 0xFD,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xFA, 0x40, 0x03,
-    0xFF, 0xD0, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x7F, 0x55, 0x50, 0x00, 0x00, 0x0F, 0xC7, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xC7, 0xFA, 0xAA, 0xFF, 0xF0, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xBF,
-    0xC0, 0x0F, 0xC7, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xC7,
-    0xF0, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xC7, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xC7, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xC7, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xC7, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFC, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xDF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x03, 0xF7, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xDF, 0xD0, 0x00, 0x7F, 0xC0, 0x3F, 0x7F, 0x40,
-    0x00, 0x7F, 0x40, 0xFD, 0xFD, 0x00, 0x00, 0xFE, 0x03, 0xF7, 0xF4, 0x00, 0x03, 0xF8, 0x0F, 0xDF,
-    0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0xFD, 0xFD, 0x00, 0x07, 0xFC, 0x03,
-    0xF7, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xDF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x7F, 0xFF, 0xFE, 0x40,
-    0x00, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2B, 0xFE,
-    0xAA, 0xA8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x5F, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFD, 0x03, 0xFE, 0xAA,
-    0xA9, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x17, 0xF9, 0x55, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x17, 0xF9, 0x55, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x80, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0x6F, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0x40, 0x00, 0x00, 0xFD,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xD3, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x1F,
-    0xD0, 0x00, 0x00, 0xBF, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x25, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x0F,
-    0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x03,
-    0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x5F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFC,
-    0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00,
-    0x01, 0xFE, 0xA0, 0x7F, 0x40, 0x00, 0x2F, 0xFC, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x05, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x81, 0xFD, 0x00,
-    0x00, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x02, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xAF, 0xFF, 0xAA, 0x90, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x55, 0xFF, 0xF5, 0x54, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40,
-    0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x40, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x00, 0x00,
-    0xBF, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x2F,
-    0xC0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00,
-    0x00, 0x1F, 0xD7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0A, 0xAB, 0xFF, 0xEA, 0x90, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xEB, 0xF0, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00,
-    0xBF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x1F, 0xD0, 0x00, 0x0B,
-    0xF0, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x50, 0x00, 0x2D, 0x00, 0x02, 0xD1, 0xAA, 0xBD, 0xFF,
-    0xFF, 0xBC, 0x07, 0x8F, 0x07, 0x83, 0xC2, 0x80, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
-    0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-    0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x40, 0x01, 0xE0,
-    0x01, 0xE0, 0x01, 0xFA, 0xA9, 0xBF, 0xFF, 0xCB, 0x40, 0xF0, 0xB4, 0x3C, 0x0A, 0x0F, 0x00, 0x03,
-    0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
-    0x00, 0x38, 0x6A, 0xAA, 0x9B, 0xFF, 0xFE, 0xBF, 0xFF, 0xE1, 0x55, 0x54, 0x6A, 0xAA, 0x9B, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xE1, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x6A, 0xAA, 0xAA, 0xAA, 0x2F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x55, 0x55, 0x55, 0x54, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x29, 0x00, 0x19, 0x3E,
-    0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00,
-    0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F,
-    0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E,
-    0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00,
-    0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F,
-    0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E,
-    0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x55, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x7E, 0x02, 0xF4, 0x0F,
-    0xC0, 0x7F, 0x03, 0xF8, 0x0F, 0xE0, 0x7F, 0x40, 0x54, 0x00, 0x0B, 0xF0, 0x3F, 0xC0, 0xFE, 0x03,
-    0xF0, 0x1F, 0xC0, 0xBE, 0x03, 0xF0, 0x0F, 0x80, 0x7D, 0x00, 0x50, 0x00, 0x0F, 0xE0, 0xFE, 0x1F,
-    0xD2, 0xFC, 0x2F, 0x83, 0xF0, 0x3F, 0x07, 0xD0, 0xBC, 0x05, 0x40, 0x7F, 0x41, 0xFD, 0x03, 0xF8,
-    0x0B, 0xF0, 0x1F, 0xC0, 0x3F, 0x40, 0xBD, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0x40, 0x01, 0xF0, 0x07,
-    0x80, 0x3F, 0x00, 0xF8, 0x07, 0xE0, 0x1F, 0x40, 0xBD, 0x03, 0xF4, 0x0F, 0xC0, 0x3F, 0x01, 0xFC,
-    0x0B, 0xF0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x1F, 0xD0, 0x7F, 0x42, 0xFD, 0x01, 0x50, 0x05, 0x40,
-    0x0B, 0xF0, 0x2F, 0x80, 0xFF, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0x41, 0xFC, 0x07, 0xF0, 0x1F, 0xC0,
-    0xBF, 0x02, 0xF4, 0x0F, 0xD0, 0x3F, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0x80, 0x7C, 0x01, 0xF0, 0x01,
-    0x40, 0x15, 0x00, 0x0F, 0xE0, 0x3F, 0x83, 0xF8, 0x1F, 0xD1, 0xFD, 0x07, 0xF0, 0xBF, 0x02, 0xFC,
-    0x3F, 0x80, 0xFE, 0x0F, 0xC0, 0x3F, 0x03, 0xF0, 0x1F, 0x81, 0xF4, 0x07, 0xD0, 0xBC, 0x02, 0xF0,
-    0x15, 0x00, 0x50, 0x00, 0x7F, 0x01, 0xFC, 0x07, 0xF4, 0x1F, 0xD0, 0x3F, 0x80, 0xFE, 0x02, 0xFC,
-    0x0F, 0xE0, 0x1F, 0xC0, 0x7F, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xD0, 0x2F, 0x40, 0x3E, 0x01, 0xF8,
-    0x02, 0xF0, 0x0F, 0xC0, 0x05, 0x00, 0x14, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x04, 0x02, 0xD0, 0x05, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF6, 0xA5, 0xB9, 0x6A,
-    0x80, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x3F, 0xEB,
-    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xAF, 0xF0, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x15, 0x42, 0xE0, 0x56, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x50, 0xB8, 0x15, 0x80, 0x02, 0xE0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x50, 0x00, 0xBF, 0xE0, 0x1F, 0xFF, 0x83, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x1F, 0xFF, 0x40, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFF, 0x47, 0xFF, 0xFD, 0x1F, 0xFF, 0x80,
-    0x7F, 0xE0, 0x01, 0xFD, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2F, 0xDF, 0xFB, 0xFE,
-    0xBF, 0x46, 0x00, 0x05, 0x00, 0x00, 0x50, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0xD0, 0x03, 0xFD, 0x3F,
-    0xD0, 0x03, 0xFD, 0x3F, 0xC0, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x50, 0x00,
-    0x19, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE7, 0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0xFF, 0x40,
-    0x1F, 0xF0, 0x02, 0xFF, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0x81, 0x40, 0x00, 0x14, 0x00, 0x06,
-    0x40, 0x05, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x6A, 0xAA, 0xBF, 0xFF, 0xFF, 0x00,
-    0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
-    0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
-    0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x02, 0xC0, 0x00, 0xAA, 0xAA, 0x7F, 0xFF, 0xF0, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
-    0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-    0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0E, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x7F, 0xFF, 0xD7, 0xAA, 0xA8, 0x70, 0x00, 0x07, 0x00, 0x00,
-    0x70, 0x00, 0x07, 0x00, 0x00, 0x75, 0x55, 0x47, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x7F, 0xFF, 0xD2, 0xAA, 0xAD, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00,
-    0xD0, 0x00, 0x0D, 0x15, 0x55, 0xD7, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x3E, 0x01, 0x50, 0x00, 0x00, 0x54, 0x00,
-    0x3F, 0x00, 0x3E, 0x0B, 0xC1, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x02, 0xF0, 0x07, 0xD0, 0xF8, 0x7F,
-    0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x0F, 0x80, 0xFC, 0x3F, 0x0F, 0xD0, 0xFD, 0x03, 0xF4, 0x3F, 0x40,
-    0xBF, 0xBF, 0x87, 0xE0, 0xF8, 0x03, 0xE0, 0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xE0, 0xFC, 0x1F, 0x40,
-    0x3F, 0x07, 0xD0, 0x0F, 0xC0, 0x06, 0xA0, 0x1F, 0x42, 0xF0, 0x02, 0xF0, 0xBC, 0x00, 0xBC, 0x00,
-    0x00, 0x03, 0xF0, 0x2F, 0x00, 0x1F, 0x4B, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x01,
-    0xF4, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x4F, 0xC0, 0x07, 0xD0, 0x00,
-    0x02, 0xF0, 0x02, 0xF0, 0x01, 0xF4, 0xBC, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x2F,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x03, 0xF0, 0x7D, 0x00, 0xFC, 0x00, 0x01,
-    0xF8, 0x00, 0x0F, 0x80, 0x3E, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x0F, 0xD0,
-    0x2F, 0x43, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE6, 0xFC,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x3F, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F,
-    0x03, 0xF0, 0x05, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x54, 0x00, 0x3F, 0x00, 0x3F, 0x07, 0xD0,
-    0xBF, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0x00, 0x7E, 0x0F, 0xC3, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x1F, 0xC0, 0xFC, 0x2F, 0x47, 0xF0, 0xBF, 0x01, 0xFD,
-    0x1F, 0xC0, 0x3F, 0x47, 0xF0, 0x0F, 0xFF, 0xF8, 0x3E, 0x0F, 0xC0, 0x2F, 0x42, 0xF4, 0x0B, 0xD0,
-    0xBD, 0x01, 0xF8, 0x03, 0xFF, 0xE0, 0xBC, 0x0F, 0xC0, 0x1F, 0x83, 0xF0, 0x03, 0xE0, 0xFC, 0x00,
-    0xFC, 0x00, 0x6A, 0x40, 0xF8, 0x1F, 0x80, 0x0F, 0xC3, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x1F, 0x80, 0x0F, 0xC7, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xD0, 0x1F, 0x40, 0x0F, 0xC7, 0xE0, 0x03, 0xF0, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0x40, 0x0F, 0xC7, 0xE0, 0x03, 0xF0, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0x0F,
-    0xC3, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x0F, 0xC3, 0xE0,
-    0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x1F, 0x83, 0xF0, 0x03, 0xE0,
-    0xFC, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x42, 0xF4, 0x0B, 0xD0, 0xBD, 0x01,
-    0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0xFD, 0x1F, 0xC0, 0x3F, 0x47, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0xC0, 0x0F, 0xD0,
-    0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0xF8, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0xFD, 0x07, 0xF0, 0x01, 0xF8, 0x0F, 0xC0,
-    0x03, 0xF0, 0x1F, 0x80, 0x07, 0xD0, 0x2F, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x1F, 0x00, 0xB8, 0x00,
-    0x3E, 0x00, 0xF0, 0x00, 0x7C, 0x02, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0xF8, 0x0B, 0xD0, 0x07, 0xF0,
-    0x2F, 0x40, 0xFC, 0x00, 0xFD, 0x03, 0xF0, 0x2F, 0x40, 0x1F, 0x80, 0xBC, 0x03, 0xF0, 0x03, 0xF0,
-    0x0F, 0x80, 0xBC, 0x00, 0x7D, 0x02, 0xF0, 0x0F, 0x80, 0x0F, 0xC0, 0x3D, 0x02, 0xF0, 0x01, 0xF0,
-    0x0B, 0x80, 0x3D, 0x00, 0x3E, 0x00, 0xF0, 0x0B, 0x80, 0x07, 0xC0, 0x2D, 0x00, 0xF0, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x01,
-    0xF0, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0xBD, 0x07, 0xE0, 0x00, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F,
-    0x80, 0x03, 0xF0, 0x3F, 0x00, 0x07, 0xE0, 0x3E, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0x80, 0xF8,
-    0x00, 0x1F, 0x01, 0xF0, 0x00, 0x3E, 0x02, 0xE0, 0x00, 0x3C, 0x03, 0xC0, 0xBD, 0x07, 0xE0, 0x7E,
-    0x00, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x03, 0xF0, 0x2F,
-    0x00, 0x07, 0xE0, 0x3E, 0x03, 0xE0, 0x00, 0xBC, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0x80, 0xF8, 0x0F,
-    0x80, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x00, 0x3E, 0x02, 0xE0, 0x2E, 0x00, 0x03, 0xC0, 0x3C, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x3D, 0xF0, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0xB8, 0x0B, 0x40, 0x03,
-    0xC0, 0x0F, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0xF0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0xF4, 0x3D, 0x00,
-    0x01, 0xF0, 0x00, 0x05, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0xBF,
-    0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80,
-    0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x90, 0x04, 0x00, 0x03, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x2F,
-    0xC0, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0x00, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xD0, 0x3F, 0x40, 0x01, 0xFE, 0x00, 0x03, 0xF8, 0x03,
-    0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x01, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x07, 0xF7, 0xF8, 0x00, 0x04,
-    0x0F, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0xFF,
-    0x00, 0x03, 0xFF, 0x40, 0x01, 0xFD, 0x1F, 0x40, 0x03, 0xFB, 0xF4, 0x00, 0x2E, 0x00, 0x00, 0x03,
-    0xF8, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x03, 0xF8, 0x00, 0x2E, 0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x01, 0xF8,
-    0x00, 0x07, 0xF8, 0x00, 0x07, 0xE0, 0x18, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xE3, 0xFC, 0x01, 0xFE, 0x3F, 0xC0, 0x0F, 0xE3,
-    0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0x0F, 0xD2, 0xFC, 0x00, 0xFD, 0x2F, 0x80, 0x0F, 0xD2, 0xF8, 0x00,
-    0xFD, 0x2F, 0x80, 0x0F, 0xD2, 0xF8, 0x00, 0xFC, 0x1F, 0x80, 0x0F, 0xC1, 0xF4, 0x00, 0xFC, 0x1F,
-    0x40, 0x0B, 0xC1, 0xF4, 0x00, 0xBC, 0x1F, 0x40, 0x0B, 0xC0, 0xF4, 0x00, 0xBC, 0x0F, 0x40, 0x0B,
-    0xC0, 0xF0, 0x00, 0xBC, 0x0F, 0x00, 0x07, 0xC0, 0x50, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x06, 0x43, 0xFC, 0x01, 0xFE, 0x7F, 0xD0, 0x2F, 0xF3, 0xFD, 0x02, 0xFF,
-    0x3F, 0xC0, 0x1F, 0xE0, 0x50, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0x5F, 0xF4, 0x04, 0x3F, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0xFD, 0x00,
-    0x3F, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0xBC, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x3F, 0x0F, 0xE0, 0x00, 0x3F, 0x7F, 0x40, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0xA9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x93,
-    0xC0, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0xF4,
-    0x02, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0x7F, 0x95, 0x5B, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x07, 0xD0, 0x00, 0x00,
-    0x1F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x2D, 0x00, 0x00, 0x00, 0x02, 0xE2, 0xC0, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0F, 0x3D, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0x3D, 0x0F, 0x00, 0x07, 0xC0,
-    0xB8, 0x00, 0xF4, 0x03, 0xC0, 0x1F, 0x00, 0x2D, 0x03, 0xE0, 0x01, 0xF0, 0x3C, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x41, 0xF0, 0x1B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xAF, 0x6F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x56, 0xBF, 0xE9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xE4, 0x0F, 0x41, 0xBE, 0x00, 0x0F, 0xE0, 0x2E, 0x01, 0xFC, 0x3F, 0xFE, 0xFA, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFB, 0xFB, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0x5B, 0xFE, 0x54, 0x00, 0x00, 0x05, 0x6F, 0xFE, 0x54, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00,
-    0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00,
-    0x02, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF8, 0x00, 0x07, 0x80, 0x0E, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0xAA, 0x9B, 0xFF, 0xFE, 0xBF, 0xFF, 0xE1, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xFA, 0xA8, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xAA, 0x83, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD3, 0xFF,
-    0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x3F,
-    0xFF, 0xD3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFE, 0xFF, 0xF0, 0x7F, 0xFE, 0xFF, 0xF0, 0x2E, 0x00, 0x07, 0xF8, 0x3D, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0xD3, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0x4F, 0xFF, 0xBF, 0xFC, 0x01, 0xFD, 0x2E, 0x00, 0x07, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0,
-    0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xB8, 0x00, 0x15, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x64, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF4, 0x02,
-    0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xE0, 0x00, 0x02, 0xFD,
-    0x00, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1B, 0xFF,
-    0xE0, 0x03, 0xFC, 0x0B, 0xFF, 0xFF, 0xF4, 0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xC0, 0x79,
-    0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x8B, 0xE0,
-    0x00, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD2,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0x40, 0x00, 0x00, 0xBF,
-    0x40, 0x7D, 0x00, 0x00, 0x0B, 0xF4, 0x01, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x07, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x00,
-    0x07, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0x55, 0x55, 0x56, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xA9, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7E, 0xAF, 0xFF, 0xFF, 0x80,
-    0x78, 0x07, 0xFF, 0xFF, 0xE0, 0x78, 0x07, 0xFF, 0xFF, 0xF0, 0x78, 0x07, 0xFF, 0xFF, 0xF4, 0x78,
-    0x07, 0xFF, 0xFF, 0xF8, 0x78, 0x07, 0xFF, 0xFF, 0xFC, 0x78, 0x07, 0xFF, 0xFF, 0xFC, 0x78, 0x07,
-    0xFF, 0xFF, 0xFC, 0x78, 0x07, 0xFF, 0xFF, 0xFC, 0x78, 0x07, 0xFF, 0xFF, 0xFC, 0x78, 0x07, 0xFF,
-    0xFF, 0xFC, 0x78, 0x07, 0xFF, 0xFF, 0xF8, 0x78, 0x07, 0xFF, 0xFF, 0xF4, 0x78, 0x07, 0xFF, 0xFF,
-    0xF0, 0x78, 0x07, 0xFF, 0xFF, 0xD0, 0x78, 0x07, 0xFF, 0xFF, 0x40, 0x78, 0x07, 0xFF, 0xF8, 0x00,
-    0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78,
-    0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07,
-    0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80,
-    0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00,
-    0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF5, 0x7E, 0x3F, 0xFF,
-    0xFF, 0x80, 0xB9, 0xFF, 0xFF, 0xFE, 0x02, 0xEB, 0xFF, 0xFF, 0xF8, 0x0B, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x2E, 0xFF, 0xFF, 0xFF, 0x80, 0xBB, 0xFF, 0xFF, 0xFE, 0x02, 0xEF, 0xFF, 0xFF, 0xF8, 0x0B, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x2E, 0xFF, 0xFF, 0xFF, 0x80, 0xBA, 0xFF, 0xFF, 0xFE, 0x02, 0xE7, 0xFF, 0xFF,
-    0xF8, 0x0B, 0x8F, 0xFF, 0xFF, 0xE0, 0x2E, 0x2F, 0xFF, 0xFF, 0x80, 0xB8, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x05, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x2E, 0x57, 0xFF, 0xFF, 0xF0, 0xB8, 0x0B, 0xFF,
-    0xFF, 0xF2, 0xE0, 0x2F, 0xFF, 0xFF, 0xCB, 0x80, 0xBF, 0xFF, 0xFF, 0xAE, 0x02, 0xFF, 0xFF, 0xFE,
-    0xB8, 0x0B, 0xFF, 0xFF, 0xFE, 0xE0, 0x2F, 0xFF, 0xFF, 0xFB, 0x80, 0xBF, 0xFF, 0xFF, 0xEE, 0x02,
-    0xFF, 0xFF, 0xFF, 0xB8, 0x0B, 0xFF, 0xFF, 0xFE, 0xE0, 0x2F, 0xFF, 0xFF, 0xEB, 0x80, 0xBF, 0xFF,
-    0xFF, 0x6E, 0x02, 0xFF, 0xFF, 0xFC, 0xB8, 0x0B, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x1A, 0xAA, 0xAA, 0x94, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE4, 0x0F, 0x40, 0x7E, 0x0F, 0xFF, 0x7E, 0xBF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x15, 0xAF, 0xFA, 0x55, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xF7,
-    0xE0, 0x00, 0x00, 0x2F, 0x4F, 0xD0, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0,
-    0x00, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0xFF, 0x07, 0xFD, 0x1F, 0xF0, 0x3F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0xFF, 0x02, 0xFC,
-    0x03, 0xF4, 0x0F, 0xE0, 0x2F, 0x80, 0x3F, 0x00, 0xBC, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x00, 0x6A,
-    0xA4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x95, 0x5B, 0xF0, 0x00, 0x1F, 0x80,
-    0x00, 0x0B, 0xD0, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x2D, 0x00,
-    0x00, 0x00, 0x02, 0xE2, 0xC0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x09, 0x3C, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x2F, 0x40,
-    0x00, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xE4, 0x0F, 0x40, 0x7E, 0x0F, 0xFF, 0x7E, 0xBF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x15,
-    0xAF, 0xFA, 0x55, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x00, 0x2F, 0x4F,
-    0xD0, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xBF, 0x40,
-    0x00, 0x78, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF9, 0x03, 0xD0, 0x1F, 0x83,
-    0xFF, 0xDF, 0xAF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x05, 0x6B, 0xFE, 0x95, 0x40, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x00, 0x7F, 0x07, 0xF0,
-    0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0xBF, 0x80, 0x0B, 0xCB, 0xF8,
-    0x00, 0xFC, 0x7F, 0x40, 0x1F, 0x41, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC3, 0xF0, 0x02, 0xFE, 0x3E,
-    0x00, 0x2F, 0xEB, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0xFE, 0x90, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0xBF, 0xAA, 0xFF, 0xFF, 0xE4,
-    0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x6F, 0xFF, 0xFA, 0xAF, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xFF, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00,
-    0x2F, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x1E, 0x00, 0x00,
-    0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0x00, 0xBC, 0x02, 0x00, 0x0B, 0xC0, 0xBC,
-    0x0F, 0xC0, 0x03, 0xF0, 0xBC, 0x3F, 0x40, 0x00, 0xFC, 0xBC, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xAA, 0xAF, 0xFF, 0xEA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00,
-    0xFD, 0xBC, 0xFD, 0x00, 0x03, 0xF4, 0xBC, 0x3F, 0x00, 0x0B, 0xD0, 0xBC, 0x0F, 0xC0, 0x03, 0x40,
-    0xBC, 0x03, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x2F,
-    0x41, 0xF8, 0x0F, 0xC0, 0xBD, 0x00, 0x7F, 0x03, 0xF4, 0x2F, 0x80, 0xFC, 0x00, 0xFD, 0x07, 0xE0,
-    0x3F, 0x02, 0xF4, 0x01, 0xF8, 0x0F, 0xC0, 0xBD, 0x03, 0xE0, 0x03, 0xF0, 0x1F, 0x40, 0xF8, 0x0B,
-    0xC0, 0x07, 0xD0, 0x3F, 0x02, 0xF0, 0x0F, 0x80, 0x0F, 0xC0, 0x7C, 0x03, 0xE0, 0x2F, 0x00, 0x1F,
-    0x00, 0xF8, 0x0B, 0xC0, 0x3D, 0x00, 0x3E, 0x01, 0xF0, 0x0F, 0x40, 0xB8, 0x00, 0x7C, 0x03, 0xD0,
-    0x2E, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xC3, 0xFD, 0x2F, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x3F, 0xD2, 0xFC, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x2F,
-    0xD3, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x60, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xBD, 0x00, 0x04, 0x00, 0x01,
-    0xFD, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x02, 0xFE, 0x00, 0xBD, 0x00, 0xFF, 0x40, 0x02, 0xFE, 0x00,
-    0xBD, 0x00, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x00, 0xBD, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0xBE, 0x00, 0x02, 0xFE, 0x00,
-    0xBD, 0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0xBD, 0x00,
-    0xFF, 0x00, 0x00, 0x64, 0x00, 0xBD, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x3F, 0xC7, 0xFD, 0x3F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC3, 0xFD, 0x7F, 0xD3, 0xFC, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x00, 0x02, 0xF8, 0x3F, 0xC7, 0xFD, 0x3F, 0xC1,
-    0xF4, 0x00, 0x00, 0x00, 0x0A, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x00,
-    0x2F, 0x83, 0xFC, 0x7F, 0xD3, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x3F, 0xC7, 0xFD, 0x3F,
-    0xD3, 0xFC, 0x05, 0x00, 0x7F, 0xFF, 0xD2, 0xAF, 0xA8, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x15, 0xF5, 0x47, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x7F, 0xFF, 0xD7, 0xAA, 0xAD, 0x70, 0x00, 0xD7, 0x00, 0x0D, 0x70, 0x00, 0xD7, 0x00,
-    0x0D, 0x75, 0x55, 0xD7, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC2, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0xBF, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0x80, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0xC0, 0x07, 0xFD, 0x00, 0xFF, 0xF0, 0x2F, 0xFF, 0x83,
-    0xFF, 0xFC, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x2F,
-    0x80, 0x0B, 0xAE, 0x02, 0xD0, 0x78, 0x3C, 0x03, 0xC0, 0xF5, 0xF0, 0x03, 0xFC, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x7F, 0xE0, 0x02, 0xAF, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x15, 0xF5, 0x47, 0xFF, 0xFD, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xFD, 0x00, 0xFE,
-    0x6F, 0xC0, 0xBD, 0x01, 0xF8, 0x3F, 0x00, 0x3F, 0x0F, 0x80, 0x0B, 0xC3, 0xE0, 0x01, 0xF5, 0xF4,
-    0x00, 0x7D, 0x7D, 0x00, 0x1F, 0x4F, 0x40, 0x07, 0xD3, 0xE0, 0x01, 0xF4, 0xF8, 0x00, 0xBC, 0x3F,
-    0x00, 0x3F, 0x07, 0xE0, 0x2F, 0x80, 0xFF, 0xBF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x6A, 0x40, 0x00,
-    0x04, 0x3D, 0x3D, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00,
-    0x3D, 0xF8, 0x00, 0x3D, 0x7E, 0x00, 0x2F, 0x1F, 0x80, 0x1F, 0x07, 0xE0, 0x0F, 0x41, 0xF8, 0x0B,
-    0x80, 0x7E, 0x07, 0xE5, 0x6F, 0x96, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x2A, 0xAA, 0xA0, 0xFF, 0xFF, 0xC3,
-    0xE5, 0x55, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xEA, 0x90, 0x1F, 0xFF, 0xF4,
-    0x3A, 0x6F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFD, 0x00, 0x07,
-    0xEF, 0xE6, 0xBF, 0x3F, 0xFF, 0xF0, 0x1A, 0xA9, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x7F, 0xFF, 0x00,
-    0x7F, 0x90, 0x40, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD2, 0xFE, 0x00,
-    0xFB, 0xFF, 0xF0, 0x3F, 0xD0, 0x7F, 0x0F, 0xC0, 0x07, 0xD3, 0xD0, 0x00, 0xF4, 0xF4, 0x00, 0x3D,
-    0x3E, 0x00, 0x1F, 0x47, 0xD0, 0x0F, 0xC0, 0xFE, 0x6F, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0x6A, 0x40,
-    0x00, 0xAA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x90, 0x01, 0xFF, 0xFE, 0x00, 0xFD, 0x0B, 0xD0, 0xBC, 0x00,
-    0xF8, 0x2F, 0x00, 0x3E, 0x07, 0xE0, 0x1F, 0x40, 0xFE, 0x2F, 0x80, 0x0F, 0xFF, 0x80, 0x03, 0xFF,
-    0xF0, 0x03, 0xF4, 0xBF, 0x42, 0xF0, 0x03, 0xF0, 0xF8, 0x00, 0xBC, 0x3E, 0x00, 0x1F, 0x0F, 0xC0,
-    0x0F, 0xC1, 0xFE, 0x6F, 0xD0, 0x2F, 0xFF, 0xE0, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0xBE, 0x07, 0xF0, 0x3E, 0x00, 0x3E, 0x1F, 0x40, 0x07, 0xC7,
-    0xC0, 0x01, 0xF1, 0xF4, 0x00, 0x7D, 0x3F, 0x00, 0x3F, 0x4B, 0xF9, 0xBF, 0xD0, 0xBF, 0xFD, 0xF0,
-    0x02, 0xA4, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x25, 0xAF, 0xC0,
-    0x0F, 0xFF, 0xC0, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00,
-    0x2D, 0x00, 0x15, 0xB9, 0x52, 0xFF, 0xFF, 0xD6, 0xAF, 0xEA, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00,
-    0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x15, 0x55, 0x52, 0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0x00, 0x15,
-    0x55, 0x52, 0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xDB,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x03, 0xD0, 0x1F,
-    0x00, 0xBC, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xF0, 0x07, 0xC0, 0x0F, 0x40, 0x3E,
-    0x00, 0x7C, 0x00, 0xF4, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x03,
-    0xD0, 0x0B, 0xC0, 0x0F, 0x40, 0x3E, 0x00, 0xBC, 0x01, 0xF0, 0x07, 0xC0, 0x0F, 0x00, 0x3C, 0x01,
-    0xF0, 0x07, 0xC0, 0x2F, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0xF4, 0x0B, 0xC0, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xD0, 0xFB, 0xEB, 0xF4, 0xFD, 0x00, 0xBC, 0xF8, 0x00, 0x3C,
-    0xF4, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0,
-    0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFF,
-    0xFD, 0x00, 0xFE, 0x6F, 0xC0, 0xBD, 0x01, 0xF8, 0x3F, 0x00, 0x3F, 0x0F, 0x80, 0x0B, 0xC3, 0xE0,
-    0x01, 0xF5, 0xF4, 0x00, 0x7D, 0x7D, 0x00, 0x1F, 0x4F, 0x40, 0x07, 0xD3, 0xE0, 0x01, 0xF4, 0xF8,
-    0x00, 0xBC, 0x3F, 0x00, 0x3F, 0x07, 0xE0, 0x2F, 0x80, 0xFF, 0xBF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00,
-    0x6A, 0x40, 0x00, 0x00, 0x2A, 0x01, 0xFF, 0x0B, 0xFF, 0x3F, 0xAF, 0x3D, 0x2F, 0x10, 0x2F, 0x00,
-    0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x2F, 0x00, 0x15, 0x01, 0xFF, 0x90, 0x1F, 0xFF, 0xF4, 0x2F, 0x91, 0xFC, 0x08, 0x00,
-    0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x15, 0x55, 0x54, 0x02, 0xFF, 0x90, 0x0B, 0xFF, 0xFD, 0x03, 0xF4,
-    0x1F, 0xC0, 0x10, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x0F,
-    0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3F, 0x04, 0x00, 0x1F, 0x87, 0xE9, 0x6F, 0xC1, 0xFF, 0xFF, 0xD0, 0x06, 0xAA, 0x40, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x3D, 0xF8,
-    0x00, 0x3D, 0x7E, 0x00, 0x2F, 0x1F, 0x80, 0x1F, 0x07, 0xE0, 0x0F, 0x41, 0xF8, 0x0B, 0x80, 0x7E,
-    0x07, 0xE5, 0x6F, 0x96, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x2A, 0xAA, 0xA0, 0xFF, 0xFF, 0xC3, 0xE5, 0x55,
-    0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xEA, 0x90, 0x1F, 0xFF, 0xF4, 0x3A, 0x6F,
-    0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xEF, 0xE6,
-    0xBF, 0x3F, 0xFF, 0xF0, 0x1A, 0xA9, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0x90,
-    0x40, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD2, 0xFE, 0x00, 0xFB, 0xFF,
-    0xF0, 0x3F, 0xD0, 0x7F, 0x0F, 0xC0, 0x07, 0xD3, 0xD0, 0x00, 0xF4, 0xF4, 0x00, 0x3D, 0x3E, 0x00,
-    0x1F, 0x47, 0xD0, 0x0F, 0xC0, 0xFE, 0x6F, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0x6A, 0x40, 0x00, 0xAA,
-    0xAA, 0xA8, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03,
-    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0xBF, 0x90, 0x01, 0xFF, 0xFE, 0x00, 0xFD, 0x0B, 0xD0, 0xBC, 0x00, 0xF8, 0x2F,
-    0x00, 0x3E, 0x07, 0xE0, 0x1F, 0x40, 0xFE, 0x2F, 0x80, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x03,
-    0xF4, 0xBF, 0x42, 0xF0, 0x03, 0xF0, 0xF8, 0x00, 0xBC, 0x3E, 0x00, 0x1F, 0x0F, 0xC0, 0x0F, 0xC1,
-    0xFE, 0x6F, 0xD0, 0x2F, 0xFF, 0xE0, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0xBF, 0xFF, 0x40, 0xBE, 0x07, 0xF0, 0x3E, 0x00, 0x3E, 0x1F, 0x40, 0x07, 0xC7, 0xC0, 0x01,
-    0xF1, 0xF4, 0x00, 0x7D, 0x3F, 0x00, 0x3F, 0x4B, 0xF9, 0xBF, 0xD0, 0xBF, 0xFD, 0xF0, 0x02, 0xA4,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x25, 0xAF, 0xC0, 0x0F, 0xFF,
-    0xC0, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x2D, 0x00,
-    0x15, 0xB9, 0x52, 0xFF, 0xFF, 0xD6, 0xAF, 0xEA, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0,
-    0x00, 0x0B, 0x40, 0x00, 0x15, 0x55, 0x52, 0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0x00, 0x15, 0x55, 0x52,
-    0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0xBC,
-    0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xF0, 0x07, 0xC0, 0x0F, 0x40, 0x3E, 0x00, 0x7C,
-    0x00, 0xF4, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x03, 0xD0, 0x0B,
-    0xC0, 0x0F, 0x40, 0x3E, 0x00, 0xBC, 0x01, 0xF0, 0x07, 0xC0, 0x0F, 0x00, 0x3C, 0x01, 0xF0, 0x07,
-    0xC0, 0x2F, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0xF4, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0x40, 0x3F, 0xFF, 0x80, 0x90, 0x1F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x78, 0x05, 0xAB, 0xE1,
-    0xFF, 0xFF, 0x9F, 0x40, 0x1E, 0xF8, 0x00, 0xBB, 0xD0, 0x03, 0xEB, 0xC0, 0x2F, 0x8F, 0xFF, 0xDE,
-    0x0B, 0xE4, 0x24, 0x00, 0x6A, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0x40, 0xF8, 0x3C, 0x00, 0x3C, 0x7C,
-    0x00, 0x3D, 0xBE, 0xAA, 0xBD, 0xBF, 0xFF, 0xFD, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x2F, 0x40, 0x04, 0x0B, 0xFF, 0xFC, 0x00, 0xAF, 0xA0, 0x00, 0x6A, 0x40, 0x02, 0xFF, 0xFD,
-    0x01, 0xF4, 0x0B, 0xC0, 0xF4, 0x00, 0xBC, 0x7C, 0x00, 0x0F, 0x2E, 0x00, 0x03, 0xDB, 0x80, 0x00,
-    0xF6, 0xE0, 0x00, 0x3D, 0x7C, 0x00, 0x0F, 0x0F, 0x00, 0x07, 0xC2, 0xF0, 0x07, 0xD0, 0x2F, 0xFF,
-    0xD0, 0x00, 0xBE, 0x80, 0x00, 0x14, 0x00, 0x05, 0x0B, 0xC0, 0x0F, 0x40, 0xF8, 0x0B, 0x80, 0x0F,
-    0x47, 0xC0, 0x01, 0xF7, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x01,
-    0xF3, 0xD0, 0x00, 0xF0, 0x7C, 0x00, 0xF4, 0x0B, 0xC0, 0xB8, 0x00, 0xF8, 0x28, 0x00, 0x0A, 0x00,
-    0x06, 0xA9, 0x00, 0x3F, 0xFF, 0xC0, 0x24, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3D, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x3E, 0x01,
-    0xF4, 0x0F, 0xFF, 0xD0, 0x01, 0xBE, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x6A, 0x40, 0xF7, 0xFF, 0xF0, 0xFE, 0x01, 0xF8, 0xFC,
-    0x00, 0x7C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00,
-    0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xA0, 0x00, 0x28, 0x60, 0x00, 0x03,
-    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x01, 0x4F, 0x00, 0x3D,
-    0x3C, 0x03, 0xD0, 0xF0, 0x3D, 0x03, 0xC3, 0xD0, 0x0F, 0x7D, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0xF8,
-    0x03, 0xC0, 0xF4, 0x0F, 0x01, 0xF4, 0x3C, 0x01, 0xF0, 0xF0, 0x02, 0xF2, 0x80, 0x02, 0x90, 0x63,
-    0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF2, 0x80, 0x50, 0x6A, 0x00,
-    0x6A, 0x43, 0xDF, 0xFF, 0x8F, 0xFF, 0xCF, 0xE0, 0x2F, 0xF0, 0x1F, 0x7F, 0x00, 0x3F, 0x00, 0x2E,
-    0xF4, 0x00, 0xB8, 0x00, 0x7F, 0xC0, 0x02, 0xE0, 0x01, 0xFF, 0x00, 0x0B, 0x40, 0x07, 0xFC, 0x00,
-    0x2D, 0x00, 0x1F, 0xF0, 0x00, 0xB4, 0x00, 0x7F, 0xC0, 0x02, 0xD0, 0x01, 0xFF, 0x00, 0x0B, 0x40,
-    0x07, 0xFC, 0x00, 0x2D, 0x00, 0x1F, 0xA0, 0x00, 0x64, 0x00, 0x24, 0x50, 0x6A, 0x40, 0xF3, 0xFF,
-    0xF0, 0xFE, 0x01, 0xF8, 0xFC, 0x00, 0x7C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF0, 0x00, 0x3C,
-    0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xA0,
-    0x00, 0x28, 0x50, 0x6A, 0x40, 0xF3, 0xFF, 0xE0, 0xFE, 0x01, 0xF8, 0xFC, 0x00, 0x7C, 0xF4, 0x00,
-    0x3D, 0xF0, 0x00, 0x2E, 0xF0, 0x00, 0x2E, 0xF0, 0x00, 0x2E, 0xF4, 0x00, 0x3D, 0xFC, 0x00, 0x3C,
-    0xFE, 0x00, 0xF8, 0xFB, 0xFF, 0xF0, 0xF0, 0xBE, 0x40, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x06, 0xA9, 0x03, 0xFF, 0xFC, 0xB8, 0x01, 0x4F,
-    0x40, 0x00, 0xBC, 0x00, 0x03, 0xF9, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xD0, 0x00,
-    0x2E, 0x50, 0x03, 0xDB, 0xFF, 0xF8, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x74, 0x00,
-    0x7E, 0x54, 0xBF, 0xFF, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00,
-    0xF4, 0x00, 0x3D, 0x00, 0x0B, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x5B, 0x80,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x2A, 0xAA, 0xA8, 0xBE,
-    0x00, 0x3F, 0xFF, 0xFC, 0xBE, 0x00, 0x3F, 0xFF, 0xFC, 0xBF, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x00, 0x0F, 0xF4, 0x3F,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0xBF, 0xAA,
-    0xA4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xA8, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00,
-    0x0F, 0x42, 0xF0, 0x00, 0x00, 0x0F, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x57, 0xD0, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFE, 0x5F, 0xFC, 0x01, 0xFF, 0xBC, 0x0F,
-    0x98, 0x03, 0xFC, 0x7C, 0x0F, 0x40, 0x0B, 0xF0, 0xBC, 0x0F, 0x00, 0x0F, 0xD0, 0xF8, 0x1F, 0x00,
-    0x2F, 0xC0, 0xF4, 0x2F, 0x00, 0x3F, 0x80, 0xF0, 0x3E, 0x00, 0x3F, 0x41, 0xF0, 0x3D, 0x00, 0x3F,
-    0x42, 0xE0, 0x3C, 0x00, 0x3F, 0x03, 0xE0, 0x7C, 0x00, 0x3F, 0x03, 0xD0, 0xBC, 0x00, 0x3F, 0x47,
-    0xC0, 0xF8, 0x00, 0x3F, 0x47, 0xC0, 0xF4, 0x00, 0x2F, 0x8B, 0x80, 0xF0, 0x00, 0x1F, 0xCF, 0x81,
-    0xF0, 0x00, 0x0F, 0xEF, 0x42, 0xF0, 0x00, 0x0B, 0xFF, 0x03, 0xE0, 0x00, 0x03, 0xFF, 0x03, 0xD0,
-    0x00, 0x01, 0xFF, 0xD7, 0xC0, 0x68, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7C, 0x6F, 0xFE, 0x40, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x00, 0xB8, 0x0F, 0x00, 0x00, 0x00,
-    0xF4, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0xAF, 0xF8, 0x03, 0xFE, 0x00, 0x02,
-    0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x05,
-    0x02, 0xA4, 0xFE, 0x00, 0xBC, 0xBF, 0xE3, 0xF4, 0x02, 0xFB, 0xFF, 0x8F, 0xD0, 0x0B, 0xFE, 0x44,
-    0x3F, 0x40, 0x2F, 0xE0, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x02, 0xF8, 0x00, 0x0B, 0xF0,
-    0x0B, 0xD0, 0x00, 0x1F, 0xC0, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0xBD, 0x00, 0x00, 0xFF, 0x02, 0xF4,
-    0x00, 0x01, 0xFD, 0x0B, 0xD0, 0x00, 0x03, 0xFC, 0x2F, 0x40, 0x00, 0x07, 0xFD, 0xBD, 0x00, 0x40,
-    0x0B, 0xFF, 0xFA, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x55,
-    0x50, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xAA, 0xAA, 0xA4, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x05, 0x7F, 0x55,
-    0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0xBF, 0xE0, 0x00, 0x3F, 0x80, 0x01, 0x90, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x55, 0xFE, 0x55, 0x54, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x55, 0xFE, 0x55, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x7D, 0x55, 0x00, 0x0F, 0xC1, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xFE, 0x0F, 0xEF, 0x95, 0xBF, 0xFF, 0xE5, 0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0xFF,
-    0xF0, 0x00, 0x7F, 0x8F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xCF, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xCF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xCF, 0xD0,
-    0x01, 0xF7, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x03,
-    0xD3, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x0F, 0x43,
-    0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0x00, 0x03,
-    0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xBC, 0x00,
-    0x3F, 0x00, 0x02, 0xF7, 0xE0, 0x03, 0xF0, 0x00, 0x2F, 0x3F, 0x00, 0x3F, 0x00, 0x02, 0xF2, 0xF4,
-    0x03, 0xF0, 0x06, 0xBF, 0xAF, 0xEA, 0xBF, 0xA8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x00, 0x2F, 0x03, 0xF0, 0x3F, 0x00, 0x02, 0xF0,
-    0x1F, 0x83, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x7F,
-    0x95, 0xBF, 0x7F, 0x54, 0x02, 0xF0, 0x03, 0xF3, 0xF0, 0x00, 0x2F, 0x00, 0x2F, 0x6F, 0x00, 0x02,
-    0xF0, 0x00, 0xFE, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0xF0, 0x00,
-    0x2F, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xFF, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x14, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x03, 0xC0,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x0B, 0xC0, 0x03, 0xF0, 0x00,
-    0x3F, 0x82, 0xFE, 0x54, 0x3F, 0x00, 0x0F, 0xF6, 0xFF, 0xFF, 0xD3, 0xF5, 0x6B, 0xFE, 0x3F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0xFC, 0x00, 0x3F, 0xA9,
-    0x40, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x53, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0xBF, 0xFA, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0x05, 0x50, 0x3F, 0x40, 0x02, 0xF8, 0x03,
-    0xFF, 0xF8, 0xFD, 0x00, 0x0B, 0xE0, 0x3F, 0xFF, 0xF7, 0xF4, 0x00, 0x3F, 0x83, 0xFD, 0x1B, 0xCF,
-    0xD0, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0xBF,
-    0x41, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0x03, 0xF4,
-    0x0B, 0xF0, 0x00, 0x0B, 0xFF, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x02, 0xFF, 0x3F, 0x40, 0x3F, 0x80,
-    0x00, 0x02, 0xFD, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x07,
-    0xEF, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xBF, 0x40, 0x03, 0xF4, 0x50, 0x00, 0xFD, 0xFD, 0x00,
-    0x0B, 0xF2, 0xF9, 0x5F, 0xF3, 0xF4, 0x00, 0x0F, 0xDB, 0xFF, 0xFF, 0x4F, 0xD0, 0x00, 0x3F, 0x8B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x3E, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x4F,
-    0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xF0,
-    0x00, 0xFC, 0x2F, 0x40, 0x0F, 0xFC, 0x00, 0x3E, 0x07, 0xE0, 0x03, 0xDF, 0x40, 0x1F, 0x80, 0xF8,
-    0x01, 0xF3, 0xE0, 0x07, 0xD0, 0x3F, 0x00, 0x7C, 0xF8, 0x02, 0xF0, 0x0F, 0xC0, 0x2F, 0x2F, 0x00,
-    0xFC, 0x02, 0xF0, 0x0F, 0x87, 0xC0, 0x3F, 0x00, 0xBD, 0x03, 0xE1, 0xF4, 0x0F, 0xC0, 0x1F, 0x40,
-    0xF4, 0x3D, 0x03, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF6, 0xBF, 0xAF, 0xEA, 0xFE, 0xBF, 0xA4, 0x0B, 0xC3, 0xE0, 0x1F, 0x0F, 0xC0, 0x02, 0xF0, 0xF8,
-    0x03, 0xD3, 0xE0, 0x00, 0x7D, 0x3D, 0x00, 0xF4, 0xF8, 0x00, 0x0F, 0x5F, 0x00, 0x3E, 0x3D, 0x00,
-    0x03, 0xE7, 0xC0, 0x0B, 0x9F, 0x40, 0x00, 0xFA, 0xF0, 0x02, 0xF7, 0xC0, 0x00, 0x2F, 0xB8, 0x00,
-    0x7E, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xFC, 0x03, 0xF0, 0x0F,
-    0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03,
-    0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F,
-    0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F,
-    0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03,
-    0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x7E,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0xFC, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0xFC, 0x03, 0xF0, 0x00,
-    0x07, 0xF8, 0xFC, 0x03, 0xFA, 0xAA, 0xBF, 0xF0, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x03,
-    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x55, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01,
-    0x50, 0x07, 0xF0, 0x00, 0x1F, 0xFF, 0xD1, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x3F, 0xF9,
-    0x6F, 0xEF, 0xC0, 0x2F, 0xE0, 0x00, 0x7F, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x07, 0xF4, 0x00,
-    0x00, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00,
-    0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00,
-    0x07, 0xF0, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xE5, 0xBF,
-    0xBF, 0x00, 0x0F, 0xFF, 0xFF, 0x4F, 0xC0, 0x00, 0x7F, 0xFF, 0x43, 0xF0, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xAA, 0xAA,
-    0xA8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x05, 0xBF, 0x55, 0x55, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2B, 0xFE, 0xAA, 0xA8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0x00,
-    0x00, 0xFF, 0xFA, 0xAF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xE0,
-    0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0,
-    0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80,
-    0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x16, 0xFF, 0xFF, 0xD5, 0x54, 0x00, 0x0F, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0,
-    0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFC,
-    0x00, 0x07, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x04, 0x00, 0x00,
-    0x00, 0xFD, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x5F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x30, 0x00, 0x0B, 0xFB, 0xF4, 0x7F, 0x00, 0x07, 0xF4, 0xFE, 0xBF, 0x40, 0x00, 0xE0,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xCF, 0xD0, 0x00, 0x00, 0x0F, 0x83,
-    0xF4, 0x00, 0x00, 0x01, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x2F, 0x80, 0x01, 0x54, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xFF,
-    0x80, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x01,
-    0xFE, 0x47, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x03, 0xF4, 0x02, 0xFC, 0x02, 0xF8, 0x00, 0x02,
-    0xFC, 0x07, 0xF0, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x07, 0xF8, 0x0F, 0xD0, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x1F, 0xF0, 0x0F, 0xC0, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x03, 0xF8,
-    0x0B, 0xE0, 0x1B, 0xFF, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xF5,
-    0x6F, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xE4, 0x00, 0x00,
-    0x3F, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x00, 0x2F, 0x81, 0xF8, 0x00, 0x00, 0x1F, 0xC2,
-    0xF4, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0xD7, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x10, 0x00, 0xFD, 0x00, 0x00, 0x38, 0x03, 0xFF, 0x00, 0x00, 0x7C, 0x07, 0xFF, 0x40, 0x00, 0xFE,
-    0x0F, 0xEF, 0x80, 0x02, 0xFF, 0x6F, 0x4F, 0xC0, 0x03, 0xFF, 0xFF, 0x0B, 0xD0, 0x0B, 0xD7, 0xFC,
-    0x07, 0xF0, 0x0F, 0xC3, 0xF8, 0x03, 0xF0, 0x2F, 0x41, 0xF0, 0x02, 0xF8, 0x7F, 0x00, 0xA0, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xAB, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x01, 0xFF,
-    0xFA, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xC0, 0x0B, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x05, 0x6F, 0xD5, 0x55, 0xBF, 0x94, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xAF, 0xEA, 0xAA, 0xBF, 0xE8, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0x1F, 0xEA, 0xBF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0x93, 0xD0, 0x1F, 0x00, 0x3F, 0xF0, 0x0F, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x0F,
-    0x40, 0x00, 0x1F, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xFC, 0x00,
-    0x03, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xFF, 0xFE, 0xBF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFA, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xEB, 0xF0, 0x00, 0x0F, 0x40, 0x3F,
-    0x9F, 0xD0, 0x00, 0x3D, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0xF4, 0x03, 0xF8, 0xFF, 0x00, 0x03, 0xD0,
-    0x0F, 0xE1, 0xFD, 0x00, 0x0F, 0x40, 0x3F, 0x83, 0xFD, 0x00, 0x3D, 0x00, 0xFE, 0x07, 0xFD, 0x00,
-    0xF4, 0x03, 0xF8, 0x0B, 0xFE, 0x03, 0xD0, 0x0F, 0xE0, 0x0B, 0xFF, 0xEF, 0xAB, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x8F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x6A, 0xBF, 0xEA, 0xAF, 0xFA, 0xA4, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0x40, 0x05, 0x7F, 0x95, 0x55, 0xFE, 0x54, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xCF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xF4, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0x5B, 0xFF, 0xD5, 0x00, 0x00, 0x1B, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x6B, 0xFF, 0xEA, 0xAA, 0xAA,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xFF, 0xAA, 0xAA, 0xAA, 0xA0, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x78, 0x00, 0xFF, 0xFA, 0xAB, 0xFE, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xF4, 0xBC, 0x1B, 0x80,
-    0x3F, 0xE0, 0x2F, 0x00, 0x00, 0x2F, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0xF0, 0x02, 0xF0, 0x00, 0x0B,
-    0xF0, 0x00, 0xBC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xC0, 0x00, 0x7F,
-    0x00, 0x02, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xFC,
-    0x00, 0x0B, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xF0,
-    0x00, 0x2F, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0xBC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xC0, 0x00, 0x07, 0xFC,
-    0x02, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0xBC, 0x01, 0x40, 0x0B, 0xFF, 0xFF, 0xAF, 0xD0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x7F, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x05, 0xBF, 0x5A, 0xAF, 0xD5, 0x54, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-    0x7F, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x7F,
-    0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xFE, 0x56, 0x00, 0x7F, 0x00, 0x07,
-    0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x1B, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x64, 0x0A, 0x80, 0x69, 0x00, 0xFD,
-    0x3F, 0xE7, 0xFF, 0x2F, 0xF8, 0x0B, 0xD3, 0x8F, 0xD0, 0xFF, 0x47, 0xC0, 0xBD, 0x38, 0xF8, 0x07,
-    0xD0, 0x2D, 0x0F, 0xD3, 0xCF, 0x40, 0x3C, 0x02, 0xD0, 0xFC, 0x1F, 0xF4, 0x03, 0xC0, 0x2D, 0x3F,
-    0x80, 0x7F, 0xE4, 0x3C, 0x02, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xAF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0x07, 0xD5, 0x6D, 0x00, 0x00, 0x0F, 0x40, 0x3C, 0x02, 0xD0,
-    0x00, 0x00, 0xB4, 0x03, 0xC0, 0x2D, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xD2, 0xAF, 0xFF, 0xAA, 0xA4, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0x55, 0x5F, 0xE5, 0x50, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x14, 0x00, 0x00, 0x3F, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xDB, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xEF, 0xC0, 0x1B, 0x80, 0x02, 0x03, 0xF1, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03,
-    0xF5, 0xE0, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFC, 0x02, 0xFF, 0x00,
-    0x00, 0x3F, 0xAF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x40, 0x00,
-    0x00, 0xF4, 0x00, 0x03, 0xE0, 0xB8, 0x0B, 0x00, 0x2E, 0x00, 0x00, 0xF8, 0xFF, 0x8F, 0xF0, 0x0F,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x0F, 0xFC, 0x2F, 0xD3, 0xFF, 0xF0, 0x00,
-    0x03, 0xFC, 0x03, 0xD0, 0x2F, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xEA, 0xAF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFE,
-    0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xF9, 0x2F, 0x86, 0xFF, 0xC0, 0x0F, 0xF8, 0x02, 0xF8, 0x02, 0xFF, 0x01, 0xFD, 0x00, 0x2F,
-    0x80, 0x07, 0xF4, 0x3F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x2F, 0x80, 0x01, 0xFC,
-    0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0xBE, 0x00, 0x02,
-    0xF8, 0x00, 0x0B, 0xFB, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x7F, 0xF0, 0x01, 0xFC, 0x00,
-    0x02, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00,
-    0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x01, 0xFC, 0x00, 0x0B, 0xFC, 0x1A, 0xFF, 0xFA, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xAB, 0xFA, 0xAA, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xD5, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x57, 0xFF, 0xE0, 0x00, 0x2F, 0xE7, 0xC0, 0xFA,
-    0xFE, 0x00, 0x1F, 0xE1, 0xF0, 0x3E, 0x1F, 0xD0, 0x0F, 0xE0, 0x7C, 0x0F, 0x82, 0xFC, 0x0B, 0xF0,
-    0x1F, 0x03, 0xE0, 0x3F, 0x83, 0xF8, 0x07, 0xC0, 0xF8, 0x0B, 0xF0, 0xFD, 0x01, 0xF0, 0x3E, 0x01,
-    0xFC, 0x7F, 0x00, 0x7C, 0x0F, 0x80, 0x3F, 0x5F, 0xC0, 0x1F, 0x03, 0xE0, 0x0F, 0xEB, 0xF0, 0x07,
-    0xC0, 0xF8, 0x03, 0xFA, 0xFC, 0x01, 0xF0, 0x3D, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xA4, 0x29, 0x00,
-    0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x7F, 0xFF,
-    0xBE, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x01, 0xBF, 0xE0,
-    0x7F, 0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0x47, 0xF0, 0x00,
-    0x03, 0xF4, 0x7F, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x01, 0xFD, 0x07,
-    0xF5, 0x56, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0x55, 0x6F,
-    0xFD, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x02, 0xFC, 0x7F,
-    0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x03,
-    0xFC, 0x7F, 0x00, 0x00, 0xBF, 0x87, 0xF0, 0x00, 0x2F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00, 0xF4, 0x3E, 0x00,
-    0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00, 0xA4, 0x29, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x96, 0xBC, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x04, 0x03, 0xFF, 0x96, 0xBC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x2A, 0xAA, 0xAA, 0xA8, 0x2A, 0xAA, 0xAA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x6A, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xEA, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x6F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t notosans_18_regularBitmaps[43196] = {
+    0x95, 0x55, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xDB, 0x4A, 0x2C, 0xE1, 0x62, 0x1B, 0xD2, 0x90,
+    0xC2, 0x0D, 0x05, 0xA2, 0x60, 0xFF, 0x82, 0x7B, 0x36, 0x42, 0x50, 0x40, 0x71, 0xAF, 0x78, 0xA1,
+    0xA1, 0x48, 0x0F, 0x05, 0x0D, 0x05, 0x05, 0x77, 0x36, 0xFC, 0x03, 0xA1, 0xA7, 0x80, 0x82, 0x48,
+    0xD1, 0x5D, 0x91, 0x7F, 0xE0, 0xF4, 0xBC, 0xE1, 0xCA, 0x34, 0x16, 0xA7, 0xD4, 0xF1, 0x29, 0x48,
+    0x08, 0x28, 0x30, 0x92, 0xD1, 0x6D, 0xEE, 0x6C, 0x2F, 0xDF, 0x37, 0xEF, 0xEE, 0x11, 0x0E, 0x90,
+    0xC0, 0x7E, 0xDE, 0x37, 0x9E, 0x9D, 0x9F, 0xDF, 0xCC, 0xAC, 0xED, 0xF1, 0x58, 0xE0, 0xF7, 0xDD,
+    0x68, 0xBF, 0xF0, 0xF8, 0xE5, 0x9F, 0x0F, 0xF9, 0x9B, 0x43, 0x5E, 0x0E, 0xA6, 0xEC, 0x8D, 0x2C,
+    0x45, 0xE4, 0x46, 0x32, 0x56, 0x27, 0x53, 0xE1, 0x96, 0x55, 0xFC, 0x7C, 0xCC, 0xCE, 0x7A, 0xFB,
+    0x75, 0xBD, 0xBF, 0x88, 0xBC, 0x4F, 0x4F, 0x3A, 0xB3, 0x5B, 0xEE, 0xEC, 0x48, 0x3F, 0x24, 0x4E,
+    0xE4, 0x0D, 0xDC, 0x22, 0x85, 0x2C, 0xB0, 0x2E, 0x74, 0xDD, 0x93, 0x1D, 0xAC, 0x47, 0xF2, 0x99,
+    0xAE, 0x47, 0x58, 0x47, 0xDC, 0x22, 0x1E, 0x77, 0x16, 0x70, 0x8D, 0xBA, 0x4E, 0x37, 0x0F, 0xCF,
+    0x0F, 0xCF, 0x1F, 0x48, 0xD2, 0x27, 0xBD, 0x48, 0xD2, 0x25, 0x1D, 0xD6, 0x36, 0x69, 0x45, 0x52,
+    0x97, 0x62, 0xCD, 0x5C, 0xE6, 0xE4, 0xD6, 0xDD, 0x27, 0x77, 0x9F, 0x2C, 0x0B, 0xCA, 0xF7, 0x9B,
+    0x55, 0x6C, 0x99, 0x97, 0x22, 0x16, 0x37, 0xDD, 0x16, 0x5B, 0xB7, 0x0B, 0x75, 0xBB, 0x87, 0x5B,
+    0xE0, 0xFA, 0x68, 0xEB, 0x5C, 0x93, 0xA1, 0x70, 0xDC, 0x5F, 0x12, 0x4D, 0xF0, 0x78, 0xC2, 0x60,
+    0xC3, 0x45, 0x48, 0xBC, 0x8D, 0xBE, 0x69, 0xB0, 0x95, 0x75, 0xD8, 0x5A, 0x83, 0x48, 0x7B, 0x10,
+    0xC5, 0xF7, 0xBD, 0xC4, 0x21, 0x20, 0x8A, 0xF0, 0x9C, 0xCB, 0x8C, 0xA8, 0xC2, 0x04, 0xF5, 0x66,
+    0x80, 0x9D, 0xCA, 0xC1, 0xCE, 0x08, 0xC2, 0xB4, 0x20, 0x26, 0x10, 0xF9, 0xE3, 0xD2, 0x66, 0x1E,
+    0x46, 0x03, 0x73, 0xAB, 0x6F, 0xE3, 0xB9, 0xE6, 0x54, 0x89, 0x17, 0xAE, 0xAA, 0x53, 0x7E, 0x05,
+    0x1F, 0xA6, 0x96, 0xE2, 0x3D, 0x44, 0xE0, 0x24, 0x2F, 0x8F, 0x24, 0xED, 0xC4, 0x38, 0x53, 0x03,
+    0x14, 0x20, 0xD3, 0x45, 0x9E, 0xC0, 0x29, 0x80, 0x0B, 0x24, 0xBB, 0x47, 0x69, 0xE3, 0x0A, 0x05,
+    0xAC, 0xB7, 0xA5, 0x6E, 0x9A, 0x7A, 0xC5, 0x02, 0x64, 0x8F, 0x42, 0x97, 0xB9, 0xFC, 0xAD, 0x53,
+    0x44, 0xEB, 0xCD, 0x71, 0x3F, 0x99, 0xD6, 0xFE, 0x7A, 0xEA, 0x17, 0xE2, 0x93, 0xD0, 0x8D, 0x79,
+    0x59, 0xC8, 0x2B, 0xF5, 0x9E, 0xA2, 0x2A, 0x45, 0xDC, 0x47, 0x03, 0xFC, 0x97, 0xA3, 0x5A, 0x84,
+    0x3D, 0x60, 0xCA, 0x2D, 0x00, 0x9F, 0x74, 0x71, 0x1F, 0xD3, 0x39, 0xB6, 0x46, 0x81, 0x7F, 0x53,
+    0x2F, 0x58, 0xC2, 0x78, 0x28, 0x4A, 0x4A, 0x17, 0x48, 0x8D, 0xFE, 0x99, 0x21, 0xDB, 0xE4, 0xCF,
+    0x94, 0x72, 0x65, 0x01, 0xB6, 0x96, 0x39, 0x9F, 0x37, 0x70, 0x24, 0xB3, 0x14, 0x60, 0xA6, 0xBD,
+    0x34, 0x14, 0xA8, 0x23, 0x36, 0x42, 0xC5, 0x77, 0x9A, 0xE4, 0x56, 0xE2, 0x63, 0xF2, 0xD2, 0xC1,
+    0x52, 0x2B, 0xBB, 0x98, 0x68, 0xC9, 0xA8, 0x09, 0xB1, 0xDC, 0x01, 0xF0, 0x83, 0x44, 0x2B, 0x69,
+    0x9E, 0x22, 0x94, 0x36, 0x1B, 0x8D, 0x67, 0xD9, 0x6B, 0x03, 0x3D, 0x68, 0x1A, 0x6F, 0x5A, 0x03,
+    0xC4, 0x7C, 0x25, 0x08, 0xCF, 0x5C, 0x0C, 0x28, 0x07, 0xEA, 0xE5, 0x12, 0xE0, 0x66, 0x46, 0xC9,
+    0xE0, 0xA8, 0xF2, 0x92, 0x0F, 0x08, 0xCE, 0x8B, 0x9D, 0x0F, 0xC3, 0xE3, 0x51, 0x2C, 0x6A, 0x9F,
+    0x8D, 0x72, 0x1B, 0x05, 0xC5, 0x9F, 0xAC, 0xB4, 0x1C, 0x55, 0xB5, 0xBF, 0x58, 0x2C, 0x76, 0xD0,
+    0xD7, 0x8A, 0xFD, 0x5A, 0x72, 0xDA, 0xA8, 0xD0, 0x17, 0xB0, 0x98, 0xBB, 0x98, 0xD1, 0x26, 0x03,
+    0x5C, 0x23, 0xF6, 0xEA, 0xFA, 0xC2, 0x8D, 0x32, 0x86, 0x1F, 0x07, 0x61, 0x84, 0xA3, 0x1C, 0xBC,
+    0xCC, 0x84, 0x31, 0xAF, 0xF7, 0x00, 0x71, 0x44, 0x03, 0x10, 0x9E, 0x69, 0x78, 0xC0, 0x9F, 0x75,
+    0x78, 0x9B, 0xA0, 0x67, 0x3A, 0x68, 0xAE, 0xC5, 0xD6, 0xD9, 0x86, 0x40, 0x6E, 0x6D, 0xD2, 0x43,
+    0x1E, 0x64, 0x99, 0x3B, 0x83, 0x42, 0xC7, 0x1E, 0xAF, 0x93, 0xEC, 0x23, 0xD0, 0xE8, 0x81, 0xC8,
+    0x06, 0xBF, 0xDC, 0x29, 0x96, 0x3A, 0x59, 0xEC, 0x07, 0x49, 0x7E, 0x30, 0xE5, 0xBE, 0x09, 0xFB,
+    0xCD, 0x58, 0x71, 0x52, 0x6E, 0x3D, 0x3C, 0xBF, 0x03, 0x01, 0x0E, 0xD7, 0x19, 0x9B, 0x6D, 0xB7,
+    0x95, 0x68, 0x84, 0x92, 0xE9, 0x0A, 0x27, 0x41, 0x9A, 0x52, 0x3E, 0x95, 0x6D, 0x53, 0xBE, 0x7C,
+    0xD5, 0xA2, 0x6C, 0x0F, 0x6D, 0x58, 0x1D, 0x9E, 0xBF, 0xB0, 0x5E, 0x3F, 0x98, 0x0F, 0xBE, 0xE5,
+    0x10, 0x3E, 0xE3, 0x52, 0xFF, 0x8B, 0xD4, 0x35, 0x56, 0xB4, 0xB4, 0x2E, 0x24, 0x43, 0xEE, 0xAA,
+    0x78, 0x30, 0x6E, 0x11, 0xF5, 0xF2, 0xE1, 0xC1, 0x57, 0x61, 0x6E, 0xC2, 0xE9, 0x9D, 0xD5, 0xF6,
+    0x88, 0x81, 0x68, 0xCB, 0x86, 0x00, 0x08, 0x44, 0x8E, 0x59, 0x01, 0x77, 0x32, 0x10, 0x6F, 0x3C,
+    0x70, 0xD0, 0x35, 0xE7, 0x89, 0xCD, 0x2A, 0x40, 0x89, 0xC5, 0x26, 0x63, 0xAD, 0x0C, 0x76, 0x15,
+    0x18, 0xC9, 0x25, 0xA3, 0x55, 0x06, 0x4D, 0xF5, 0x97, 0x00, 0xE9, 0x65, 0x67, 0xE8, 0x30, 0xEE,
+    0xEA, 0x3C, 0xD4, 0xC9, 0x28, 0x55, 0x69, 0x1D, 0xDA, 0x12, 0x36, 0x27, 0x98, 0x8A, 0x3D, 0x14,
+    0xD2, 0x9E, 0x1E, 0x8E, 0xE9, 0x10, 0x68, 0xC9, 0xC4, 0x3E, 0xF7, 0xB0, 0x95, 0x3D, 0x83, 0x25,
+    0x7B, 0x0F, 0xE9, 0xAC, 0xAF, 0x58, 0xE6, 0x64, 0x2B, 0xA5, 0x9E, 0x2A, 0xC6, 0x0A, 0xED, 0x19,
+    0x9D, 0x92, 0xF6, 0x6C, 0x9D, 0x3A, 0x9D, 0x3F, 0x1A, 0x79, 0xE2, 0x39, 0xB8, 0x65, 0x89, 0x56,
+    0x1B, 0x5C, 0x8A, 0x36, 0x0D, 0x65, 0x33, 0x99, 0xB3, 0xDF, 0xC3, 0xEE, 0x49, 0x5F, 0xBC, 0x83,
+    0x08, 0x90, 0x33, 0xA2, 0x46, 0x0A, 0xFF, 0x87, 0xD4, 0xAB, 0x41, 0x52, 0xE8, 0x67, 0x97, 0x86,
+    0x5F, 0x82, 0xB3, 0x9D, 0x34, 0xF5, 0x6B, 0xA2, 0xB3, 0xC6, 0xBC, 0x14, 0x4B, 0x4A, 0x2B, 0x3C,
+    0x8A, 0x8A, 0xE2, 0xAA, 0xA7, 0x26, 0x27, 0x04, 0x4D, 0x88, 0x90, 0xC8, 0xE6, 0xF4, 0xC5, 0xD3,
+    0x8B, 0x44, 0x0E, 0x22, 0xFA, 0x1B, 0x21, 0xDB, 0xFA, 0xDF, 0xC3, 0x33, 0x6B, 0x0C, 0x51, 0x13,
+    0x4A, 0x1C, 0x64, 0xC1, 0x99, 0xF0, 0x33, 0x82, 0xF8, 0x52, 0x1A, 0xF7, 0xEA, 0x3F, 0x07, 0xC1,
+    0xB7, 0xF1, 0xD2, 0xED, 0x07, 0x13, 0x8D, 0xA1, 0x6A, 0x01, 0x29, 0xBC, 0x74, 0x18, 0xD8, 0x3E,
+    0x7A, 0x64, 0xF0, 0x54, 0xD8, 0x94, 0x6D, 0xAB, 0xAD, 0xAD, 0xDE, 0x68, 0xD0, 0x9F, 0x60, 0xEF,
+    0x51, 0xB8, 0xFF, 0xF1, 0x84, 0x52, 0x86, 0xF6, 0x66, 0x20, 0xB2, 0x37, 0x96, 0x1A, 0x87, 0x2A,
+    0x5A, 0x1D, 0x8D, 0x51, 0x0F, 0x11, 0xA6, 0xFB, 0x14, 0xAA, 0xE9, 0x8F, 0x1C, 0x82, 0xDF, 0x46,
+    0x5A, 0x83, 0xE1, 0xD8, 0xD3, 0xDE, 0xA8, 0x0D, 0x45, 0x4C, 0xD6, 0xF4, 0x56, 0xD1, 0x89, 0x4E,
+    0xB7, 0x2D, 0xC1, 0xCC, 0xD1, 0x26, 0x6C, 0x2D, 0xCC, 0x5F, 0xCB, 0x7A, 0x32, 0x63, 0xCF, 0x65,
+    0x2E, 0x36, 0xCD, 0xBF, 0x99, 0x41, 0x85, 0x74, 0x13, 0xAC, 0xC6, 0x78, 0xC5, 0x34, 0xF8, 0xBE,
+    0x11, 0xAA, 0x96, 0x84, 0x0A, 0xC1, 0x20, 0x0F, 0xD3, 0x0D, 0xC1, 0x96, 0x16, 0x9E, 0xDE, 0x4A,
+    0x14, 0x6F, 0x2F, 0x81, 0x02, 0x3E, 0x34, 0x05, 0xB3, 0xF9, 0xE9, 0xFD, 0xC0, 0x12, 0x01, 0x99,
+    0x0D, 0x56, 0x6A, 0x77, 0xBA, 0x82, 0x70, 0xBA, 0xE4, 0x68, 0xD1, 0xAA, 0x77, 0xF1, 0xD2, 0x37,
+    0xF7, 0x1F, 0xEA, 0x17, 0x15, 0x47, 0x1C, 0x94, 0xA2, 0x95, 0xFC, 0xA7, 0xEB, 0x0F, 0x8D, 0x55,
+    0xBF, 0x8E, 0xDC, 0x64, 0x10, 0x1F, 0xDB, 0x5A, 0x59, 0x87, 0x8B, 0x8F, 0x82, 0x54, 0x57, 0xF8,
+    0x0D, 0xF0, 0x13, 0x24, 0x76, 0x68, 0x28, 0x8F, 0x22, 0x7B, 0x2F, 0x81, 0xC4, 0x3D, 0x41, 0xB0,
+    0xA1, 0xA1, 0xA0, 0xB9, 0x47, 0xA0, 0xA0, 0x40, 0xFB, 0x0C, 0x9B, 0xB5, 0x11, 0x05, 0x65, 0x0C,
+    0x27, 0x68, 0x52, 0x60, 0x29, 0x41, 0x11, 0x49, 0x11, 0x47, 0x32, 0xC8, 0x87, 0x6C, 0x0F, 0xBF,
+    0xDF, 0xD8, 0xBB, 0xBA, 0xBD, 0x13, 0x10, 0x4B, 0xDF, 0xA7, 0x9D, 0xF9, 0xE6, 0xFF, 0xFC, 0x66,
+    0x56, 0x84, 0xDF, 0xA9, 0x36, 0x12, 0xEB, 0x24, 0x91, 0x6E, 0xBE, 0xF1, 0x15, 0x8C, 0xBC, 0x10,
+    0x71, 0x8D, 0x88, 0x37, 0x80, 0x48, 0x33, 0x91, 0xA0, 0x25, 0x17, 0x27, 0x6A, 0x4E, 0xBF, 0x95,
+    0x5D, 0xA2, 0x9D, 0x7B, 0xA6, 0xDA, 0x68, 0x27, 0x7A, 0x36, 0x88, 0x3F, 0x40, 0xC9, 0xFD, 0x06,
+    0x85, 0x69, 0x84, 0xC8, 0xEB, 0x5A, 0x64, 0xB7, 0xC3, 0x8F, 0x97, 0xD0, 0x9A, 0xA0, 0xEE, 0x7E,
+    0xA6, 0x8C, 0x6B, 0xA5, 0xCC, 0xF2, 0xDF, 0xCB, 0xC6, 0x53, 0xED, 0xC5, 0x57, 0x88, 0xCA, 0x23,
+    0x58, 0x55, 0xD5, 0x3F, 0x71, 0xF4, 0x25, 0x2F, 0x38, 0xF6, 0xF8, 0x10, 0xB5, 0x8B, 0x67, 0x0B,
+    0xC1, 0xD5, 0x8B, 0xFB, 0xA0, 0xC7, 0x15, 0x57, 0xB8, 0x76, 0xB2, 0x44, 0x95, 0x90, 0x3A, 0x52,
+    0xF1, 0x4D, 0xA5, 0xB9, 0xA3, 0xC2, 0xCC, 0xC2, 0x8E, 0x42, 0x47, 0x2A, 0xF3, 0x77, 0x01, 0xD7,
+    0x4E, 0xB5, 0x16, 0x7D, 0xA5, 0x75, 0xD4, 0x41, 0x06, 0xA6, 0xD2, 0x87, 0x30, 0xB5, 0x0B, 0x5B,
+    0xF1, 0x7B, 0x57, 0x21, 0x77, 0xB2, 0xB2, 0x3C, 0x83, 0xC9, 0xB2, 0xC8, 0x2B, 0x29, 0xDF, 0xF4,
+    0x8C, 0x3F, 0x43, 0x32, 0x13, 0xAC, 0xBE, 0xD6, 0x2C, 0x1C, 0x3C, 0x2D, 0xD2, 0x42, 0xCA, 0x8F,
+    0xA0, 0x58, 0x32, 0xEC, 0x31, 0x45, 0x40, 0x3D, 0xA8, 0xE8, 0x39, 0x9C, 0xA5, 0x67, 0x0D, 0x32,
+    0x8A, 0x51, 0xEE, 0x36, 0xBD, 0x3E, 0x57, 0x49, 0x54, 0x5B, 0x94, 0x9F, 0xB1, 0xAC, 0x0F, 0x91,
+    0xC0, 0x96, 0x63, 0x25, 0x10, 0x49, 0x81, 0x48, 0x50, 0xB4, 0x4C, 0x4A, 0x26, 0x35, 0xC2, 0xA0,
+    0x37, 0xA4, 0x4C, 0x1C, 0x94, 0xBB, 0x32, 0x83, 0xE6, 0xA3, 0x40, 0x62, 0x25, 0xA8, 0x5A, 0x25,
+    0xD4, 0x87, 0xFA, 0x6A, 0x1C, 0x51, 0xE4, 0xAB, 0x4E, 0x72, 0xC6, 0x3D, 0xD7, 0xC1, 0xEB, 0xEF,
+    0x14, 0x92, 0xA5, 0x0B, 0x46, 0x39, 0x39, 0x47, 0xDA, 0x29, 0x83, 0x50, 0xE4, 0x62, 0x81, 0xBC,
+    0x17, 0x0C, 0xF9, 0xD5, 0x98, 0x56, 0x9F, 0xC8, 0xF1, 0xB7, 0xDA, 0xF3, 0xFD, 0x22, 0xFD, 0x5E,
+    0x3F, 0x46, 0x4F, 0x57, 0x72, 0xE7, 0x5B, 0x65, 0x69, 0x31, 0x86, 0x6D, 0x52, 0x8D, 0x41, 0x1B,
+    0x17, 0x5B, 0xBF, 0x31, 0xEE, 0x07, 0xAC, 0x3E, 0x31, 0xC5, 0x1E, 0xE7, 0x70, 0x1F, 0x23, 0xCF,
+    0x10, 0x84, 0x07, 0xEF, 0x92, 0xA3, 0x2F, 0x31, 0xCB, 0xC0, 0x08, 0x82, 0x89, 0x5D, 0x54, 0x8B,
+    0xD5, 0xBA, 0xA7, 0x46, 0xD3, 0x4E, 0x69, 0x74, 0xBF, 0xD8, 0x12, 0xC9, 0xEE, 0xAD, 0xD7, 0xEB,
+    0x33, 0x00, 0x67, 0x24, 0x7A, 0x7E, 0x01, 0xF1, 0xE8, 0x6E, 0x40, 0x25, 0x9E, 0x9E, 0xEE, 0x65,
+    0xAA, 0xF7, 0xC9, 0x22, 0x0C, 0x02, 0xFA, 0x0B, 0x69, 0xDB, 0xBB, 0xE1, 0x0B, 0x51, 0xC1, 0x57,
+    0x41, 0x35, 0x7A, 0x48, 0x9A, 0x99, 0xF4, 0xCA, 0x6E, 0x96, 0x48, 0xA6, 0x39, 0xA0, 0x48, 0x2F,
+    0x51, 0x70, 0x8A, 0x50, 0xCD, 0x3B, 0x38, 0x23, 0x16, 0x52, 0x00, 0x29, 0x9D, 0xB4, 0xFD, 0x50,
+    0xC2, 0x7E, 0x81, 0xF0, 0xB0, 0x40, 0x6E, 0x98, 0x69, 0xD6, 0xDF, 0xB5, 0x33, 0x14, 0x81, 0xCB,
+    0x60, 0x98, 0x49, 0xE2, 0x34, 0x41, 0x40, 0x09, 0x51, 0x8A, 0x73, 0xEF, 0x46, 0x16, 0x27, 0xCB,
+    0x60, 0x96, 0xD5, 0x7C, 0xF8, 0xFB, 0xC4, 0x5E, 0x3E, 0xFD, 0x63, 0x76, 0xAC, 0x73, 0x9D, 0xA6,
+    0x92, 0x48, 0x47, 0x78, 0xE1, 0x38, 0x4B, 0x01, 0xF4, 0xD6, 0xF8, 0xB8, 0x0A, 0x98, 0x37, 0x00,
+    0xB0, 0x13, 0x6F, 0x9D, 0xF9, 0x9D, 0xAB, 0x00, 0x93, 0xCA, 0x7D, 0x09, 0x90, 0xA1, 0xFD, 0xDB,
+    0x54, 0x92, 0x3A, 0xAA, 0xC3, 0x1F, 0x1A, 0x20, 0x7E, 0x2B, 0xF7, 0x1F, 0xCB, 0x13, 0x89, 0xAA,
+    0xE0, 0x59, 0x05, 0x0C, 0x6D, 0xE5, 0xC1, 0x16, 0x89, 0xBA, 0x2A, 0x78, 0x53, 0xC5, 0x05, 0xB2,
+    0xB8, 0x3F, 0x78, 0x24, 0xC3, 0xA7, 0x95, 0x23, 0xB9, 0xDD, 0xE2, 0x4A, 0x2A, 0xF7, 0x75, 0x15,
+    0x35, 0xE1, 0xE8, 0xB7, 0x8F, 0x25, 0xFD, 0xF5, 0xAF, 0xEB, 0x29, 0xC0, 0xB0, 0x8F, 0x0E, 0x23,
+    0x21, 0xFE, 0x24, 0xC9, 0xA5, 0x61, 0x70, 0x0F, 0xC3, 0x65, 0x5A, 0x59, 0x3C, 0xC6, 0x8B, 0xB6,
+    0x04, 0x7A, 0xB9, 0x2A, 0xC1, 0x8A, 0x90, 0x49, 0x67, 0xBD, 0xD1, 0x17, 0x26, 0xB0, 0xCC, 0x46,
+    0x64, 0x2D, 0x77, 0x36, 0xB4, 0xB1, 0x65, 0x92, 0xB2, 0xAC, 0xF2, 0xC0, 0xEE, 0x27, 0x9F, 0xF3,
+    0xE6, 0x78, 0x70, 0x48, 0x08, 0xA3, 0x8E, 0xE5, 0x0C, 0x5A, 0x8E, 0x40, 0xD4, 0x50, 0xD9, 0xD5,
+    0x61, 0xBB, 0x2F, 0x43, 0x52, 0xF8, 0x3D, 0x8B, 0xCC, 0x6E, 0x94, 0xEB, 0xB5, 0xA1, 0x5F, 0x15,
+    0xB1, 0xF0, 0xF6, 0xA7, 0xCD, 0xA6, 0x2C, 0x28, 0x16, 0x57, 0x54, 0x71, 0x35, 0xF7, 0x49, 0xD4,
+    0xD2, 0x20, 0x91, 0xCD, 0x06, 0xCE, 0xAB, 0x86, 0xC3, 0x24, 0x23, 0x41, 0x23, 0x53, 0xAE, 0x7F,
+    0x67, 0xDC, 0x67, 0xA3, 0x2D, 0xB5, 0x2A, 0x07, 0x68, 0x9A, 0x9C, 0x01, 0xE7, 0xEC, 0x41, 0xCE,
+    0x88, 0x8E, 0xAE, 0x88, 0x0F, 0x71, 0x9D, 0xAF, 0xCF, 0x35, 0xCB, 0x99, 0xF2, 0xAC, 0x0B, 0xB2,
+    0xDE, 0xAB, 0x05, 0x74, 0x60, 0x5E, 0xBC, 0xF1, 0xE8, 0xB2, 0x87, 0x90, 0x57, 0xD2, 0xD2, 0x5B,
+    0xCD, 0x8B, 0x56, 0x5E, 0xEC, 0xF1, 0x72, 0xAA, 0xD7, 0x06, 0xFD, 0x8E, 0x89, 0x0D, 0x84, 0xF8,
+    0x67, 0x32, 0xE3, 0x9A, 0x57, 0x5A, 0xEC, 0x77, 0xA7, 0x6D, 0x4A, 0xDB, 0x8B, 0x06, 0x54, 0x29,
+    0x65, 0xFF, 0x62, 0xEB, 0xD1, 0xBF, 0xC5, 0x34, 0x49, 0xB1, 0x84, 0x6D, 0x8F, 0x46, 0x46, 0xEB,
+    0xA1, 0x27, 0x1C, 0x96, 0x15, 0x16, 0xDB, 0x46, 0x33, 0x22, 0xB2, 0x66, 0x37, 0xE1, 0x61, 0x65,
+    0xAB, 0x1E, 0xF5, 0xF1, 0xAC, 0xB9, 0x21, 0xC7, 0x11, 0xC5, 0xF5, 0x2E, 0x46, 0xEE, 0xA3, 0x68,
+    0xA4, 0xEF, 0x70, 0x60, 0xAD, 0xC3, 0x9E, 0x55, 0xB6, 0xDA, 0x48, 0xFC, 0x93, 0xFD, 0x03, 0x7D,
+    0xC5, 0x40, 0x4A, 0xB2, 0xE7, 0x82, 0x87, 0x6F, 0xC9, 0x8E, 0x7F, 0xBC, 0xC5, 0x8E, 0xDE, 0x1E,
+    0xA4, 0xBD, 0x91, 0x6C, 0x2B, 0xA1, 0xE4, 0x5F, 0x1C, 0x6C, 0x97, 0x35, 0xD8, 0x17, 0x73, 0x7F,
+    0x6A, 0x46, 0xD2, 0x33, 0x12, 0x8E, 0x0F, 0x4B, 0x8F, 0x33, 0xD9, 0x59, 0x96, 0xE4, 0xBF, 0x1E,
+    0x6C, 0x19, 0xC8, 0x0D, 0x76, 0xF8, 0xFB, 0xFF, 0xE4, 0x67, 0xFB, 0xD3, 0x8D, 0xF3, 0xEE, 0xBE,
+    0x6E, 0xFB, 0xDB, 0x6C, 0xBE, 0x7B, 0x27, 0x9D, 0xE5, 0xFC, 0xF7, 0xF7, 0x0F, 0xD5, 0x55, 0xBD,
+    0x6E, 0xD4, 0x40, 0x10, 0x1E, 0xDB, 0x82, 0x2B, 0x5C, 0x6C, 0x45, 0x45, 0xE1, 0x47, 0x70, 0x4B,
+    0x67, 0x47, 0x14, 0xB4, 0x14, 0x24, 0x2D, 0x8F, 0x90, 0x37, 0xF0, 0x1E, 0x34, 0x94, 0x50, 0xF0,
+    0x14, 0xD7, 0xE4, 0x09, 0x82, 0x8D, 0x52, 0xA4, 0xA0, 0xC0, 0x5D, 0x0A, 0x1A, 0x0B, 0x90, 0xA2,
+    0x88, 0x22, 0x2B, 0xE4, 0xE8, 0x4C, 0xF0, 0x7A, 0xF8, 0xBE, 0xB5, 0x13, 0xA0, 0x23, 0x20, 0x90,
+    0x38, 0xE9, 0x66, 0x66, 0xC7, 0xB3, 0xF3, 0x3F, 0xB3, 0x22, 0xE1, 0x17, 0xD5, 0xFA, 0x51, 0xC4,
+    0xAA, 0xAA, 0xA4, 0x00, 0x83, 0xE0, 0xB8, 0x6A, 0xCC, 0xC8, 0x6F, 0xF5, 0x1A, 0x20, 0x09, 0x64,
+    0xDE, 0x10, 0x4E, 0x04, 0xAB, 0x9E, 0x30, 0x0B, 0x8C, 0x9A, 0x20, 0x0E, 0x12, 0xA9, 0x93, 0x58,
+    0xF5, 0xA0, 0x81, 0x9A, 0x09, 0xEC, 0x5C, 0x2F, 0xC9, 0x36, 0xA7, 0x94, 0x2E, 0x9E, 0x77, 0xBC,
+    0x5D, 0xE0, 0x4E, 0x32, 0xD8, 0x12, 0xEC, 0x4E, 0x01, 0x8B, 0x27, 0x84, 0x53, 0xAC, 0x6B, 0xB0,
+    0x63, 0xBD, 0xDC, 0x68, 0x17, 0xC1, 0x07, 0x1C, 0xF7, 0x95, 0x5E, 0x45, 0xBB, 0xF0, 0x8C, 0x4A,
+    0x8E, 0x1D, 0x0E, 0x23, 0xC9, 0xEC, 0x46, 0xE4, 0xC5, 0xEE, 0xEE, 0xDE, 0xC8, 0xD8, 0xF4, 0x98,
+    0x60, 0xB4, 0x9B, 0xCD, 0xE6, 0xE0, 0x77, 0x95, 0x7D, 0x27, 0x1B, 0xAB, 0x9F, 0x55, 0x5F, 0xD7,
+    0x5F, 0xE0, 0x5D, 0x34, 0xCA, 0xCA, 0x31, 0x1B, 0x37, 0x23, 0x6F, 0x4F, 0x3B, 0xAA, 0x6F, 0x90,
+    0x74, 0x59, 0x75, 0xC8, 0x22, 0x92, 0xF7, 0x87, 0xA0, 0x13, 0x2F, 0xC5, 0x5B, 0x1D, 0x74, 0x4A,
+    0x27, 0x24, 0x95, 0x79, 0x8B, 0x3C, 0x4C, 0x45, 0x13, 0x4C, 0xCA, 0x04, 0xD3, 0xA2, 0x64, 0x2A,
+    0xED, 0x2B, 0xFD, 0xA8, 0xE9, 0x4F, 0x4D, 0xC9, 0xBA, 0x64, 0x4C, 0x25, 0x98, 0x00, 0x88, 0x11,
+    0x65, 0xB7, 0x05, 0x2A, 0x96, 0xA9, 0x87, 0x7F, 0x5A, 0x43, 0x8B, 0x3E, 0x18, 0x83, 0xE4, 0x1A,
+    0x92, 0xA6, 0xE7, 0x75, 0xE5, 0xF5, 0xAC, 0x03, 0x33, 0xF6, 0xD4, 0x59, 0x34, 0x60, 0x26, 0x23,
+    0x0D, 0xD9, 0x35, 0x0C, 0xA5, 0x3D, 0x5B, 0x44, 0x69, 0xDD, 0x38, 0x3B, 0x7B, 0xF4, 0xF7, 0xFE,
+    0xAA, 0xD3, 0xF5, 0x9F, 0xBD, 0x96, 0x7A, 0xEB, 0xD8, 0x39, 0xDE, 0xB2, 0xFF, 0x32, 0x6F, 0xD9,
+    0x8C, 0x85, 0xAF, 0x16, 0xF4, 0x0A, 0xE8, 0xD0, 0x57, 0xBC, 0x3A, 0xFA, 0xAA, 0x40, 0xD4, 0x83,
+    0xAF, 0x72, 0xB4, 0x61, 0xEF, 0x2B, 0xD3, 0x48, 0xE2, 0x80, 0x5A, 0x24, 0xD5, 0x5B, 0xF8, 0x6F,
+    0x1A, 0x6F, 0x93, 0x1E, 0x31, 0x7A, 0x1B, 0x0F, 0x92, 0x97, 0xDE, 0xCA, 0x28, 0x85, 0x00, 0x79,
+    0xA9, 0x88, 0x78, 0x06, 0x2A, 0x66, 0x94, 0x3F, 0xED, 0x89, 0xB2, 0x23, 0x47, 0x64, 0x4E, 0x3A,
+    0xA2, 0xF4, 0x53, 0x4B, 0x94, 0x68, 0x33, 0xA3, 0x35, 0x51, 0x84, 0xF2, 0xFB, 0x50, 0x93, 0x80,
+    0x0E, 0x89, 0x90, 0xFB, 0xE4, 0xD4, 0x33, 0x24, 0x06, 0xB0, 0xDA, 0x2A, 0x8B, 0x61, 0x59, 0x87,
+    0xED, 0x39, 0x18, 0xB6, 0x82, 0xC4, 0x6A, 0xFB, 0x9E, 0x59, 0xAE, 0x8C, 0x03, 0xD9, 0x81, 0x61,
+    0x2B, 0xCC, 0x20, 0x48, 0x30, 0x2C, 0xDC, 0x29, 0x57, 0x5B, 0x87, 0xB1, 0x05, 0x69, 0x3A, 0x90,
+    0x60, 0x80, 0x4C, 0x46, 0x92, 0xA6, 0x2B, 0x60, 0xA9, 0xBE, 0xBF, 0x65, 0xAD, 0x48, 0x66, 0x1F,
+    0x40, 0x4A, 0x0D, 0x01, 0x78, 0x45, 0x32, 0x53, 0x66, 0xA5, 0x26, 0x99, 0x04, 0x32, 0x73, 0xB2,
+    0xFC, 0xF6, 0xC3, 0x50, 0x62, 0x90, 0x5A, 0x8E, 0xBA, 0x4E, 0xC2, 0xC9, 0xB5, 0x8E, 0x61, 0xC4,
+    0x13, 0xA3, 0x40, 0x13, 0x70, 0xBA, 0x93, 0x81, 0x93, 0x2E, 0xB5, 0x61, 0x25, 0xB2, 0x13, 0x56,
+    0x20, 0x09, 0xDB, 0x40, 0x34, 0x2C, 0x8C, 0xFC, 0x9C, 0x9F, 0xD3, 0xAF, 0x54, 0x1C, 0x4F, 0xF3,
+    0xAA, 0xF9, 0xE1, 0x83, 0xA1, 0x6D, 0x28, 0x61, 0x16, 0xC4, 0xCF, 0xAA, 0xD2, 0xB0, 0x46, 0xD6,
+    0xB4, 0x91, 0xB7, 0xF4, 0x28, 0xEF, 0x62, 0x2C, 0x0F, 0xE4, 0x28, 0xD7, 0x8D, 0xBA, 0xE0, 0x55,
+    0xC7, 0x66, 0x65, 0xBE, 0x24, 0x7A, 0x14, 0x7A, 0xE2, 0x8C, 0x67, 0x2D, 0xD9, 0x14, 0x2B, 0x17,
+    0xD9, 0x1E, 0xD1, 0x58, 0x8C, 0x71, 0xC4, 0x64, 0x9B, 0x53, 0x28, 0x61, 0x7C, 0x29, 0xAD, 0x4D,
+    0xE4, 0x9C, 0x60, 0x83, 0x71, 0xC0, 0xEB, 0x67, 0x17, 0x7B, 0xB5, 0xC3, 0xAD, 0x01, 0xD7, 0xBD,
+    0xD8, 0xCD, 0x4B, 0xF6, 0xFB, 0xDC, 0x68, 0xBF, 0x42, 0xC8, 0xFF, 0x97, 0xAF, 0xC7, 0xA1, 0xC6,
+    0x74, 0x8C, 0x17, 0xC2, 0x21, 0x9E, 0x0F, 0x45, 0x38, 0x24, 0x61, 0xF3, 0xCB, 0x1D, 0xE4, 0xF2,
+    0xAC, 0xE4, 0xB4, 0xF5, 0xF3, 0x93, 0x81, 0x45, 0xA6, 0x1C, 0x76, 0xC4, 0xC1, 0xA5, 0x7E, 0x05,
+    0x52, 0x0E, 0x7C, 0x7A, 0x7D, 0x34, 0xED, 0x22, 0x12, 0x85, 0x62, 0x78, 0xDE, 0xED, 0x08, 0x90,
+    0x0D, 0xC9, 0x5A, 0x00, 0xEC, 0x30, 0x74, 0xE8, 0xC0, 0x65, 0x32, 0xCE, 0x5B, 0x8A, 0xB5, 0x2A,
+    0x7F, 0xD2, 0x1C, 0x94, 0x26, 0x63, 0x58, 0x6C, 0x57, 0x4F, 0xD7, 0x0B, 0x81, 0x17, 0x58, 0xC7,
+    0x3A, 0x9A, 0x41, 0xEE, 0xEE, 0xF8, 0xE5, 0xA5, 0xC2, 0x98, 0x82, 0x58, 0x2F, 0x4F, 0x53, 0xC6,
+    0xB4, 0x2A, 0xDF, 0x1E, 0xC8, 0x8B, 0xD1, 0xB0, 0xD9, 0x02, 0x68, 0xA1, 0x95, 0x4F, 0x50, 0x1A,
+    0xC4, 0xDA, 0xE5, 0x85, 0x4B, 0xDD, 0xF2, 0xB2, 0xB1, 0x1E, 0x91, 0xBF, 0x07, 0x4F, 0x8E, 0x74,
+    0x53, 0xBB, 0x02, 0x66, 0x60, 0x13, 0x46, 0x6E, 0x3D, 0x9C, 0x9F, 0x4C, 0xDD, 0x27, 0x78, 0x47,
+    0xD0, 0x2F, 0x5E, 0xD9, 0xEB, 0xC7, 0x31, 0xF4, 0x43, 0x34, 0xFE, 0x23, 0xE6, 0x8D, 0x7F, 0xDF,
+    0x00, 0xAD, 0x55, 0xBD, 0x8E, 0xD6, 0x46, 0x14, 0xBD, 0xF6, 0x68, 0xE3, 0xC2, 0xC5, 0x34, 0x50,
+    0x51, 0x4C, 0x9F, 0xC6, 0x6F, 0xC0, 0x58, 0x49, 0x49, 0x01, 0x05, 0x5B, 0xF1, 0x02, 0x11, 0xCD,
+    0xBE, 0xC1, 0x8E, 0x53, 0xA5, 0x04, 0x09, 0x91, 0x67, 0x88, 0xBE, 0x26, 0x2F, 0x40, 0xD6, 0x96,
+    0x28, 0x29, 0x3E, 0x43, 0x44, 0x8D, 0x25, 0x14, 0x45, 0x49, 0xB3, 0x0E, 0x6B, 0x05, 0xC3, 0x7A,
+    0x7C, 0x73, 0xCE, 0x78, 0x45, 0x48, 0x84, 0x90, 0x58, 0xF8, 0x3E, 0xF9, 0xEF, 0x78, 0xE6, 0xDE,
+    0x73, 0xCF, 0x3D, 0x33, 0x3E, 0x16, 0x11, 0x77, 0xDA, 0x89, 0x14, 0xE7, 0xA3, 0x48, 0xB6, 0x2E,
+    0x78, 0x0E, 0xED, 0x17, 0x05, 0x23, 0xC1, 0x36, 0xE0, 0xE4, 0xEF, 0x0D, 0x78, 0xF3, 0x2C, 0x8A,
+    0xD8, 0xD1, 0x0F, 0xE2, 0x26, 0xA3, 0x7F, 0xB6, 0x93, 0x78, 0xD5, 0x49, 0x32, 0x55, 0xBC, 0x94,
+    0x43, 0x91, 0x13, 0x5C, 0xCC, 0xDF, 0x9C, 0x54, 0x3D, 0x9E, 0x70, 0x5E, 0x2D, 0x5E, 0x98, 0xC9,
+    0x21, 0x60, 0xD5, 0xF9, 0x1A, 0x00, 0xFE, 0x52, 0x4C, 0xD9, 0x42, 0xC0, 0x4C, 0x04, 0xCA, 0x51,
+    0x8A, 0x51, 0x30, 0xA4, 0xEA, 0x04, 0x43, 0x90, 0xA1, 0x25, 0x80, 0x21, 0x00, 0xCC, 0x4C, 0xA0,
+    0x1C, 0x01, 0x88, 0xED, 0x7C, 0x03, 0x22, 0x4D, 0x24, 0x51, 0x02, 0x12, 0x09, 0x98, 0x99, 0x40,
+    0xF1, 0x9A, 0x80, 0x3D, 0x6D, 0x98, 0x9B, 0x04, 0x24, 0x10, 0x10, 0x45, 0x52, 0xC9, 0x53, 0x6D,
+    0xC2, 0x98, 0x62, 0x46, 0xD6, 0x80, 0xCC, 0xEE, 0xF1, 0x8C, 0x68, 0xE0, 0xD7, 0x82, 0x41, 0xA6,
+    0xCC, 0x05, 0x12, 0x25, 0x26, 0xD8, 0x1E, 0x3C, 0xFC, 0x31, 0xA7, 0xAC, 0x98, 0xB3, 0x48, 0x3E,
+    0x23, 0x42, 0xF9, 0x72, 0xC4, 0x1B, 0xE4, 0xF5, 0x37, 0x06, 0xF1, 0xB8, 0x95, 0xC5, 0x75, 0x88,
+    0xE8, 0x9B, 0x62, 0xF0, 0x52, 0x0E, 0xA0, 0x5D, 0xD5, 0x11, 0x25, 0x00, 0x5B, 0x32, 0xFC, 0x51,
+    0x78, 0x31, 0x9A, 0x11, 0xD1, 0xED, 0x50, 0x35, 0x08, 0xDA, 0xA0, 0xA2, 0x28, 0x15, 0x0B, 0xF0,
+    0x66, 0xDC, 0x6A, 0x88, 0xAE, 0x91, 0x05, 0x85, 0xE6, 0xF3, 0x2F, 0x38, 0x28, 0xCE, 0x19, 0xF4,
+    0x38, 0x03, 0x3F, 0xBB, 0xEF, 0xD2, 0x21, 0xFE, 0x64, 0x3B, 0x04, 0x7A, 0x4B, 0xC0, 0x41, 0xB2,
+    0xC2, 0xC3, 0x60, 0xBC, 0x51, 0xD9, 0xEA, 0x29, 0x67, 0x96, 0x0E, 0xD4, 0xF5, 0xB8, 0x42, 0x07,
+    0xF7, 0x7D, 0xA4, 0xF8, 0x76, 0xA4, 0xCA, 0x48, 0xEE, 0xBA, 0x9C, 0x9C, 0xD0, 0x40, 0x50, 0x05,
+    0x4F, 0x54, 0x9B, 0x2F, 0xEC, 0x81, 0x1D, 0xD8, 0xF6, 0x70, 0x13, 0x73, 0x73, 0x65, 0x14, 0xAB,
+    0x49, 0xC0, 0x8E, 0xBA, 0xC6, 0xA4, 0x22, 0xB5, 0xAC, 0x94, 0x6A, 0xFF, 0xB5, 0xA4, 0xBE, 0x02,
+    0x70, 0xEC, 0xA8, 0x99, 0x28, 0xEE, 0x09, 0x62, 0xB0, 0x85, 0xA1, 0x46, 0xC3, 0x00, 0xB4, 0x0C,
+    0x4A, 0x1E, 0x2D, 0x9E, 0xC5, 0x2C, 0xC9, 0x56, 0x03, 0x6B, 0x70, 0x3F, 0x4C, 0x6C, 0x99, 0xEF,
+    0xD8, 0x66, 0x76, 0xA2, 0x87, 0x3E, 0x98, 0x41, 0xC5, 0x6B, 0xAA, 0x4C, 0xB5, 0xB2, 0x64, 0x02,
+    0x50, 0x36, 0x73, 0x91, 0x12, 0xAD, 0xCC, 0x49, 0x17, 0x15, 0x67, 0xE4, 0xE7, 0xC9, 0x2F, 0xD3,
+    0x9E, 0x54, 0x53, 0xAF, 0x69, 0x2D, 0x96, 0x76, 0x89, 0x5B, 0x38, 0x58, 0x27, 0x1C, 0xFA, 0x92,
+    0x27, 0x56, 0xC8, 0x88, 0xE4, 0x2E, 0xCC, 0x52, 0xB2, 0xF2, 0x50, 0x5F, 0xC0, 0x94, 0x97, 0xE4,
+    0xA8, 0x21, 0x29, 0xD2, 0xCB, 0x8C, 0xD3, 0x5D, 0x78, 0xCC, 0x0D, 0xFF, 0x99, 0xD6, 0xBC, 0x3F,
+    0x6D, 0x7D, 0x37, 0x0D, 0x79, 0x56, 0x26, 0x3B, 0xE7, 0xA9, 0x53, 0x0D, 0xFA, 0x42, 0x61, 0xDF,
+    0x85, 0xAE, 0xEA, 0xCC, 0x65, 0x6E, 0xF4, 0xB5, 0x46, 0xD5, 0xFA, 0x98, 0xF6, 0x4E, 0x65, 0xD1,
+    0xE9, 0xB6, 0x4B, 0x0B, 0xB2, 0xD8, 0x90, 0x7C, 0xDE, 0x90, 0x78, 0x81, 0x48, 0x42, 0xDC, 0x86,
+    0xC0, 0xBD, 0x44, 0xA8, 0x0A, 0x91, 0x65, 0x43, 0xC2, 0x86, 0xD0, 0x4B, 0x0C, 0xD7, 0x7B, 0xFD,
+    0x55, 0xA3, 0x87, 0xEC, 0x91, 0xEE, 0xFF, 0xAC, 0xD3, 0xBB, 0x50, 0x42, 0xFD, 0xC8, 0x36, 0x99,
+    0x59, 0x8A, 0x24, 0xDE, 0x1E, 0x19, 0xED, 0x0D, 0x6E, 0x1A, 0x06, 0x34, 0xAE, 0xE7, 0xE0, 0xFB,
+    0x48, 0xC0, 0x76, 0xC6, 0x05, 0x0F, 0xD7, 0x59, 0x65, 0x25, 0x45, 0x2F, 0xB6, 0x41, 0x49, 0x65,
+    0xE7, 0xE0, 0xC3, 0x81, 0x15, 0x4D, 0x50, 0x40, 0x96, 0xAF, 0x77, 0xBB, 0xDD, 0x03, 0x8A, 0xCC,
+    0xDE, 0x0E, 0x77, 0x6B, 0xA8, 0xBE, 0xA6, 0xF5, 0x4A, 0x01, 0x6E, 0xA5, 0x8D, 0xCA, 0x69, 0x64,
+    0xE7, 0x87, 0xF2, 0xB7, 0x6B, 0x8B, 0x34, 0xB4, 0x5A, 0x6A, 0x59, 0x22, 0xE2, 0xD9, 0xC8, 0xEE,
+    0xAB, 0x56, 0x47, 0xA7, 0xBA, 0x54, 0x6F, 0x6F, 0x87, 0x0A, 0xE6, 0xDE, 0x0F, 0x69, 0x59, 0xA6,
+    0x2D, 0xB1, 0xA5, 0x5B, 0xF7, 0x58, 0xC1, 0xAF, 0xF4, 0x70, 0x5D, 0xBC, 0xAE, 0x55, 0xAE, 0xB1,
+    0xEC, 0x32, 0xC4, 0xFE, 0x8E, 0x5D, 0xA6, 0x79, 0xE2, 0xC7, 0x6E, 0x0E, 0xC5, 0x3E, 0xD5, 0x55,
+    0x62, 0xAB, 0x8B, 0xD5, 0xE7, 0x61, 0x84, 0x10, 0xE1, 0xDE, 0x04, 0x0F, 0xA1, 0x7C, 0xFB, 0x82,
+    0x0B, 0x16, 0x62, 0x94, 0xDC, 0x55, 0x03, 0xFB, 0x45, 0x9D, 0x02, 0xF7, 0x06, 0x22, 0x2D, 0xC7,
+    0x9C, 0x72, 0xEB, 0x80, 0x5B, 0xAB, 0x7D, 0xC4, 0xC2, 0x5F, 0xD7, 0x3B, 0x6A, 0x9F, 0xC0, 0x4B,
+    0xB3, 0xE3, 0x88, 0x03, 0xD8, 0x35, 0x3B, 0xE4, 0xB6, 0xDC, 0x57, 0xAA, 0xDF, 0xE8, 0xC3, 0x47,
+    0xF4, 0xA5, 0x6E, 0x66, 0xA5, 0x17, 0xB9, 0x6D, 0xCC, 0x1B, 0x99, 0x6D, 0x53, 0x4E, 0x8F, 0x14,
+    0x80, 0xBE, 0xA7, 0x9B, 0xB1, 0xF6, 0xEB, 0xF6, 0x8F, 0x9F, 0xEB, 0x16, 0x3A, 0x1D, 0x21, 0x26,
+    0x4B, 0x83, 0xBE, 0xF7, 0xB7, 0x7D, 0x34, 0x39, 0xE8, 0x83, 0x37, 0x07, 0xB7, 0x8A, 0xB1, 0xD4,
+    0x29, 0x18, 0xD5, 0xDF, 0x47, 0x7D, 0x7E, 0xA4, 0x90, 0x2E, 0x60, 0xCD, 0xE6, 0x8A, 0x41, 0x96,
+    0xDF, 0x14, 0xFD, 0x48, 0x65, 0x58, 0x50, 0x25, 0xF7, 0x71, 0xE5, 0x6E, 0xF5, 0x6A, 0x05, 0x6A,
+    0xD7, 0x3B, 0xE7, 0xA3, 0x87, 0x55, 0x24, 0xE8, 0xB7, 0xA3, 0x5C, 0xA5, 0x59, 0x6E, 0x73, 0x78,
+    0x44, 0x48, 0x7C, 0x7A, 0xDA, 0xA7, 0xA1, 0x07, 0x67, 0x6E, 0x33, 0x66, 0x46, 0x8A, 0xEA, 0x09,
+    0xBF, 0x1C, 0x70, 0xBD, 0xDB, 0xA3, 0xF7, 0x0B, 0x17, 0xD8, 0xFE, 0xED, 0x6E, 0xF7, 0x53, 0x5A,
+    0x7C, 0xC3, 0xFF, 0xD7, 0x6C, 0x06, 0x4D, 0xAE, 0x14, 0xFA, 0x63, 0x5B, 0x3B, 0x06, 0xAB, 0xF4,
+    0x0D, 0xC4, 0x63, 0xA5, 0x77, 0xEF, 0xE3, 0xA1, 0x47, 0x06, 0xAC, 0xD8, 0x2B, 0x9C, 0x93, 0xBF,
+    0x27, 0x17, 0x78, 0x1F, 0x69, 0x2C, 0x30, 0xE3, 0x20, 0x3C, 0x4C, 0x1F, 0xAC, 0xB4, 0x89, 0xFE,
+    0xFB, 0xF6, 0x93, 0x1E, 0x2F, 0xFF, 0xFB, 0x07, 0xAD, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0xBD,
+    0xB6, 0xB5, 0xB2, 0xC0, 0xC5, 0xD0, 0x2C, 0x4D, 0x24, 0x4C, 0x49, 0xE7, 0x37, 0xE0, 0x5A, 0x4A,
+    0x41, 0x49, 0x8A, 0xAC, 0x28, 0x52, 0xA4, 0x4D, 0x97, 0x47, 0x18, 0x87, 0x2D, 0x28, 0x52, 0xA4,
+    0xDA, 0x87, 0xE0, 0x19, 0x80, 0x1D, 0xA3, 0x2D, 0x29, 0xD6, 0x08, 0x45, 0x14, 0x14, 0x6B, 0x29,
+    0x44, 0x29, 0x52, 0x7C, 0xC3, 0xC6, 0x28, 0x86, 0x9D, 0xF1, 0xE5, 0xDC, 0xB1, 0x17, 0x11, 0xB2,
+    0x59, 0x44, 0x14, 0xEB, 0xB3, 0x35, 0x9E, 0xB9, 0xBE, 0xF7, 0x9C, 0x73, 0x7F, 0x3E, 0xDA, 0xBB,
+    0x45, 0x54, 0xC9, 0xC4, 0x85, 0xC8, 0x13, 0x2F, 0x8F, 0xAD, 0xAB, 0x47, 0xB2, 0x2F, 0x66, 0xCA,
+    0xC5, 0x12, 0x99, 0x0B, 0x4F, 0xE4, 0x16, 0xB5, 0x18, 0x89, 0x6C, 0x24, 0x2A, 0x65, 0xC0, 0x62,
+    0xD1, 0x85, 0xEE, 0x38, 0x1C, 0xBD, 0x84, 0x8D, 0x70, 0x47, 0xF5, 0x6F, 0x0B, 0x76, 0x4D, 0xFC,
+    0x42, 0x3C, 0xCB, 0x62, 0xC9, 0xCA, 0x67, 0x9E, 0xF6, 0x09, 0x6E, 0xA8, 0x84, 0x09, 0x1D, 0xE3,
+    0x36, 0xF8, 0x3A, 0x0F, 0x1F, 0xB5, 0xE4, 0x1E, 0xC8, 0x85, 0xF8, 0x5A, 0x64, 0xA6, 0x1B, 0xB8,
+    0xEF, 0x6D, 0x67, 0x14, 0xAF, 0x5B, 0x1C, 0x90, 0xF9, 0x51, 0xA4, 0x8D, 0x4E, 0xA2, 0xD9, 0x3D,
+    0xBD, 0xEF, 0x81, 0xC5, 0x3E, 0x02, 0xD4, 0x20, 0x44, 0xF5, 0x29, 0x62, 0x04, 0x00, 0x33, 0xA7,
+    0x00, 0x16, 0xA2, 0x2E, 0x86, 0xFF, 0xB1, 0xE8, 0xDF, 0x37, 0x4F, 0xC2, 0xF2, 0x1E, 0xE2, 0x10,
+    0x7F, 0xFE, 0xD3, 0x14, 0xAF, 0x7A, 0x50, 0xDE, 0xD1, 0x42, 0xC6, 0xE3, 0x91, 0xB7, 0xB4, 0x5D,
+    0xC0, 0x16, 0xDF, 0xFE, 0x91, 0x07, 0x96, 0x43, 0xF1, 0xCD, 0x2A, 0x01, 0xB7, 0x2B, 0xD7, 0x62,
+    0xDA, 0x88, 0x5F, 0xB5, 0x61, 0x1F, 0x81, 0xF6, 0xE1, 0x44, 0xDC, 0x45, 0xDC, 0xDC, 0x72, 0x67,
+    0x06, 0xEE, 0x8B, 0x89, 0x7B, 0x8A, 0xB8, 0xF9, 0x7E, 0x4F, 0x66, 0x37, 0x13, 0x12, 0xDA, 0x91,
+    0x3C, 0x54, 0x3B, 0x81, 0x0F, 0xE3, 0x8B, 0x29, 0x5B, 0xE0, 0xA3, 0x19, 0xB8, 0x2D, 0x02, 0x9C,
+    0xF2, 0xC9, 0x44, 0xE5, 0x0C, 0xA7, 0xAE, 0xBD, 0x17, 0xAF, 0xB9, 0x08, 0xBA, 0xAB, 0xF4, 0xDF,
+    0xCB, 0x42, 0x4E, 0xDA, 0xE0, 0x64, 0x46, 0x7E, 0xCD, 0xEE, 0xC8, 0x9D, 0xAD, 0x39, 0x10, 0x0F,
+    0x4C, 0xF0, 0x15, 0xD6, 0x4C, 0x68, 0x29, 0x20, 0x19, 0x80, 0x9C, 0x69, 0x3E, 0x80, 0x58, 0x53,
+    0x52, 0xF8, 0x55, 0x68, 0x5E, 0x45, 0x7F, 0x57, 0xAF, 0xFD, 0x06, 0x2D, 0xE1, 0x42, 0x55, 0x3C,
+    0x7E, 0xC7, 0x55, 0x41, 0x19, 0xC8, 0x67, 0x2A, 0x65, 0x23, 0x32, 0xE4, 0x72, 0xE4, 0x06, 0x34,
+    0x08, 0xF7, 0xCA, 0xF3, 0x2B, 0x6D, 0x8E, 0x06, 0x08, 0x22, 0x02, 0x14, 0x2F, 0x67, 0xD8, 0xEF,
+    0xF0, 0x21, 0x3B, 0x24, 0x6D, 0xD1, 0xAD, 0x3F, 0x75, 0xEB, 0x67, 0x58, 0x31, 0xE4, 0xCE, 0x03,
+    0x4C, 0xCD, 0x08, 0x75, 0x84, 0x2C, 0x84, 0x43, 0x7F, 0x48, 0x0B, 0xAF, 0xC0, 0x95, 0xDD, 0xD2,
+    0x42, 0xDA, 0x24, 0x06, 0x8F, 0x00, 0x1E, 0xF6, 0x15, 0x1E, 0xE6, 0xCC, 0xAF, 0x3E, 0xFF, 0xD1,
+    0x88, 0xE3, 0xDA, 0x88, 0x69, 0xC7, 0xA9, 0xCD, 0xCE, 0x53, 0x16, 0x81, 0x94, 0x4F, 0x17, 0xAA,
+    0x66, 0x59, 0xEE, 0x88, 0xF9, 0x45, 0xA4, 0x8F, 0xB5, 0x8C, 0x66, 0xD8, 0x6B, 0xAF, 0xEF, 0xAD,
+    0x6D, 0x41, 0xAF, 0xCD, 0x83, 0xE6, 0xDF, 0xF3, 0x40, 0xDE, 0x3C, 0x0F, 0xDC, 0x2B, 0xF3, 0xE0,
+    0x3C, 0xCD, 0x83, 0xE5, 0xCE, 0x05, 0xE6, 0x41, 0x7C, 0x7D, 0x1E, 0x5C, 0xBF, 0x38, 0x08, 0x95,
+    0x04, 0x5E, 0x82, 0x7C, 0x2D, 0x13, 0x49, 0x4F, 0xD0, 0x0A, 0x1C, 0x97, 0xF4, 0x8B, 0xFF, 0xF5,
+    0xA3, 0xBD, 0xDB, 0x9A, 0xB4, 0x5F, 0x2B, 0xCC, 0x97, 0xE6, 0xE9, 0x87, 0x1E, 0x35, 0xF8, 0x01,
+    0x53, 0xAA, 0x18, 0xE4, 0x0E, 0x65, 0x31, 0x6F, 0xC8, 0xD7, 0xD9, 0xA6, 0x14, 0xD0, 0x60, 0x28,
+    0x60, 0x94, 0xEC, 0xA6, 0x46, 0xF8, 0x18, 0xCA, 0xF3, 0xD1, 0xDD, 0x89, 0x45, 0xC6, 0x1B, 0xCA,
+    0x79, 0x1F, 0x69, 0xFD, 0x84, 0xA8, 0x49, 0x65, 0x81, 0x1A, 0xCC, 0x03, 0x3E, 0x95, 0x67, 0x08,
+    0x71, 0xF7, 0xF7, 0x03, 0xBC, 0x10, 0xC8, 0x23, 0xC5, 0x55, 0x3A, 0x79, 0xC3, 0x8B, 0xBA, 0xB7,
+    0x68, 0x88, 0x3F, 0x6E, 0x67, 0x70, 0x59, 0x23, 0x59, 0xFB, 0x69, 0x88, 0x68, 0x7F, 0x5B, 0xA0,
+    0x2C, 0x5F, 0xBC, 0xCD, 0xA2, 0xD2, 0x85, 0x80, 0x58, 0x7D, 0x1E, 0xD3, 0x08, 0x86, 0xE4, 0x56,
+    0x16, 0x46, 0x59, 0xDC, 0xF4, 0x5B, 0x84, 0x24, 0x5C, 0x1E, 0xAC, 0xC6, 0xD2, 0x6F, 0x7D, 0xAA,
+    0xC6, 0xBA, 0xD7, 0xD1, 0x30, 0x52, 0xDD, 0x03, 0x1C, 0x77, 0x80, 0xC1, 0x54, 0xCC, 0xC0, 0x0B,
+    0xA0, 0x2A, 0xA5, 0xE2, 0x3D, 0xCE, 0xA1, 0x16, 0x2B, 0x42, 0x46, 0x02, 0xA9, 0x7E, 0x38, 0x6A,
+    0x87, 0x40, 0xC5, 0x6A, 0xD7, 0xA9, 0x8C, 0x90, 0xA5, 0x40, 0x6A, 0x28, 0x5F, 0x2E, 0x47, 0xA2,
+    0x26, 0xB1, 0x08, 0xF0, 0x81, 0x40, 0xAE, 0xA7, 0xE6, 0x70, 0x26, 0x13, 0x11, 0x17, 0x21, 0x51,
+    0x25, 0x16, 0x4E, 0x6B, 0x0B, 0x35, 0xCC, 0x50, 0x9C, 0x4F, 0x08, 0xB3, 0x10, 0xD7, 0x9D, 0x01,
+    0x82, 0x72, 0x0C, 0x38, 0x63, 0xFA, 0xCE, 0xF4, 0x0D, 0xB0, 0x98, 0xFE, 0x18, 0x51, 0x9B, 0x07,
+    0x73, 0xE9, 0x19, 0xCE, 0x9A, 0x96, 0xE1, 0xD7, 0x9C, 0xF8, 0x7C, 0xC2, 0x5F, 0x49, 0xFC, 0x94,
+    0x6A, 0x0C, 0xC2, 0xEA, 0xD9, 0x40, 0x41, 0x45, 0xFD, 0x16, 0x3D, 0xD2, 0x01, 0x48, 0x9F, 0x52,
+    0xC9, 0x53, 0xC2, 0x94, 0x69, 0x9B, 0x02, 0x33, 0x46, 0xF6, 0xDF, 0xE8, 0x00, 0xA2, 0x9C, 0xB0,
+    0x61, 0x46, 0x10, 0x6D, 0x7A, 0x04, 0x44, 0x42, 0x9C, 0xAA, 0xC3, 0x5F, 0xC2, 0x51, 0xAD, 0xFD,
+    0x9A, 0x4A, 0xA2, 0x40, 0x76, 0x92, 0x07, 0xD4, 0x7E, 0xAB, 0x44, 0x41, 0xD9, 0x3C, 0xC7, 0x69,
+    0x73, 0x02, 0x41, 0x6C, 0x96, 0x4A, 0xCD, 0x29, 0x51, 0xEE, 0xA0, 0x5E, 0x3D, 0xD4, 0x80, 0xE3,
+    0x51, 0xF8, 0x45, 0x48, 0x81, 0xDC, 0xA5, 0xDE, 0x33, 0xF6, 0x92, 0xDE, 0x4A, 0x19, 0x7A, 0x57,
+    0xAA, 0x77, 0x79, 0xA9, 0x77, 0x8B, 0x02, 0x81, 0x69, 0x50, 0x04, 0xC7, 0xA4, 0x54, 0x92, 0xDE,
+    0x37, 0xC1, 0xA2, 0xD1, 0x09, 0x63, 0x7E, 0x80, 0xDE, 0xD5, 0x19, 0x82, 0x97, 0xBB, 0x5E, 0x51,
+    0xB5, 0x1B, 0x2A, 0x4A, 0x8C, 0xB4, 0x56, 0x53, 0xD1, 0x82, 0xCD, 0xD6, 0x3D, 0xC8, 0x67, 0xA2,
+    0x49, 0xDF, 0xA8, 0xAD, 0x53, 0x0B, 0x3B, 0xD2, 0xD5, 0xD7, 0x5F, 0xBD, 0x55, 0x3D, 0x8F, 0xDD,
+    0x44, 0x14, 0x3D, 0xF6, 0x2C, 0xFB, 0x90, 0x5C, 0xCC, 0x16, 0xD9, 0x26, 0x14, 0x93, 0x82, 0x02,
+    0x42, 0x31, 0x7F, 0x20, 0x3C, 0x3B, 0x69, 0x28, 0xA1, 0xC8, 0x06, 0x29, 0x3F, 0x81, 0x66, 0xDB,
+    0x14, 0x1B, 0x6C, 0x68, 0x28, 0x13, 0x1A, 0x28, 0x68, 0x52, 0xA4, 0x60, 0x2D, 0xA1, 0xD4, 0x91,
+    0x76, 0xD7, 0x13, 0x28, 0x68, 0x2D, 0x51, 0x50, 0xC6, 0xAB, 0x10, 0xA1, 0xD0, 0xC4, 0x85, 0x11,
+    0xCE, 0xE2, 0xE7, 0xCB, 0xB9, 0x7E, 0x6F, 0xB3, 0xEC, 0x13, 0x41, 0xA4, 0xC1, 0xF2, 0x8C, 0xC6,
+    0x77, 0xEE, 0xE7, 0xB9, 0x67, 0xC6, 0x00, 0x90, 0x8A, 0x0C, 0x3A, 0xB6, 0x77, 0x3E, 0x1E, 0x80,
+    0x59, 0x0B, 0xD8, 0x9A, 0xD2, 0x02, 0xA8, 0x80, 0x68, 0x01, 0x98, 0x1E, 0x48, 0x28, 0x76, 0x81,
+    0xE2, 0x0C, 0x18, 0x29, 0xA6, 0xA6, 0xE9, 0xA8, 0xD9, 0x00, 0x9E, 0xE2, 0xBC, 0x2C, 0xBF, 0xAD,
+    0xE8, 0x43, 0x07, 0xF0, 0x1E, 0x20, 0x01, 0xD2, 0x42, 0x0A, 0x35, 0xA0, 0x1D, 0xBD, 0xAA, 0x49,
+    0x8E, 0xF3, 0x1F, 0x0C, 0xE2, 0x83, 0x91, 0x1A, 0x92, 0x21, 0x55, 0x51, 0x98, 0x82, 0xAD, 0xAB,
+    0x9D, 0x7D, 0xD0, 0x9B, 0xED, 0x10, 0xD1, 0xB5, 0xE3, 0xD7, 0x2E, 0xDE, 0x9D, 0xFF, 0x97, 0x07,
+    0xFB, 0xB4, 0xEC, 0x90, 0x30, 0x8A, 0x63, 0x1D, 0x2C, 0xC9, 0x17, 0x48, 0x1A, 0xC4, 0x8C, 0x75,
+    0xB4, 0xF6, 0xC1, 0x58, 0x86, 0x0A, 0xCC, 0x26, 0x12, 0xC4, 0x12, 0xF8, 0xA1, 0x81, 0x8F, 0x5E,
+    0x69, 0x43, 0x65, 0xA1, 0xEB, 0xC2, 0xD0, 0xFB, 0x43, 0xC2, 0x19, 0x31, 0x18, 0x72, 0xD6, 0xF4,
+    0x44, 0xE4, 0x64, 0xF7, 0x4E, 0x96, 0xCB, 0xE2, 0x92, 0xEE, 0x43, 0x9F, 0x37, 0xCC, 0x90, 0xFE,
+    0xBC, 0x48, 0xC3, 0x3D, 0x5D, 0xA3, 0xB5, 0x68, 0xDD, 0xD5, 0x4E, 0xDF, 0x6B, 0xBD, 0xFF, 0x5C,
+    0xDF, 0xF4, 0x87, 0x61, 0xF9, 0x4E, 0xEA, 0x51, 0xBB, 0x1A, 0x84, 0xFA, 0x2D, 0xF9, 0x05, 0x44,
+    0x77, 0x26, 0xCF, 0x7B, 0xDB, 0x63, 0xCB, 0xAF, 0x7A, 0xA4, 0x0D, 0x21, 0x44, 0xDA, 0xAB, 0x73,
+    0x23, 0x5F, 0x0D, 0xDD, 0x4F, 0xD9, 0x21, 0xC7, 0x4E, 0xD9, 0x45, 0xB4, 0x67, 0xB4, 0x43, 0x95,
+    0xF4, 0xD8, 0x1C, 0xB3, 0x33, 0xFF, 0x1C, 0xF8, 0x08, 0xAB, 0xA7, 0xE2, 0x4E, 0x22, 0xC4, 0xD8,
+    0x9F, 0x54, 0x0D, 0xF2, 0x22, 0x0A, 0x93, 0x47, 0xAD, 0x74, 0x35, 0x0D, 0xAF, 0x98, 0x6E, 0x8C,
+    0x3B, 0xD7, 0x51, 0x2D, 0x23, 0x28, 0x11, 0x86, 0x7F, 0x53, 0x8E, 0x75, 0x52, 0x12, 0xC1, 0xD5,
+    0x1A, 0x55, 0x68, 0x22, 0x2F, 0xA7, 0x0D, 0x66, 0x65, 0xEA, 0x9B, 0x59, 0x9F, 0xE7, 0x52, 0x7D,
+    0x46, 0x49, 0x9B, 0x74, 0xB4, 0x18, 0x90, 0xD4, 0x36, 0xC3, 0x3C, 0x6E, 0x11, 0xB7, 0x9E, 0xA6,
+    0x5C, 0x44, 0xAD, 0x63, 0x43, 0xD0, 0x63, 0xD6, 0x24, 0x0D, 0x9B, 0x25, 0x4F, 0xAB, 0x9A, 0x84,
+    0x96, 0x0F, 0x8E, 0xAB, 0xE3, 0xE1, 0x1D, 0x52, 0x7A, 0xAA, 0x2A, 0xE5, 0xF0, 0x1F, 0x12, 0x05,
+    0xF7, 0x68, 0x50, 0xE2, 0xB2, 0x83, 0xB3, 0xD6, 0xB4, 0x4A, 0xB8, 0x23, 0x6D, 0xB1, 0x0D, 0xAC,
+    0x8D, 0x0D, 0x55, 0x5A, 0x2A, 0x6A, 0x49, 0xA3, 0x7C, 0x5F, 0xE8, 0x59, 0x70, 0x3F, 0x12, 0x1F,
+    0xF3, 0x87, 0xA6, 0x9A, 0xB3, 0xE3, 0x17, 0x1F, 0x48, 0xA9, 0x00, 0x49, 0x88, 0xCA, 0xEA, 0xB7,
+    0x7B, 0xCB, 0xF3, 0xB2, 0xAC, 0x44, 0xE1, 0x89, 0x35, 0xD9, 0x15, 0x00, 0x2F, 0x85, 0xCB, 0x46,
+    0x9C, 0x69, 0xAE, 0x11, 0xF7, 0x14, 0xFA, 0x0B, 0xEB, 0xE2, 0x9B, 0xFB, 0x70, 0x22, 0x5A, 0x3F,
+    0x8F, 0xDA, 0xAD, 0xFC, 0xEC, 0xE4, 0x25, 0x4C, 0xC4, 0x92, 0x72, 0x56, 0x1A, 0x48, 0xD5, 0xD9,
+    0xDA, 0xF5, 0x73, 0x24, 0xBF, 0x93, 0xE5, 0xBF, 0xD6, 0xB0, 0x8F, 0x03, 0xE6, 0x69, 0x88, 0xBA,
+    0xBC, 0xB1, 0x21, 0x1D, 0x17, 0xF4, 0x51, 0x33, 0x2F, 0x06, 0xAF, 0xC2, 0x92, 0x36, 0xA4, 0x70,
+    0x7C, 0x42, 0xEB, 0xC7, 0xCF, 0x6E, 0x08, 0xB1, 0x6A, 0x9D, 0xBC, 0x98, 0x12, 0xD8, 0xC0, 0x56,
+    0x8A, 0x21, 0x8F, 0x06, 0xCE, 0x5C, 0x9F, 0xE6, 0x85, 0x4D, 0x19, 0x35, 0x7F, 0xE6, 0xA2, 0xC5,
+    0xF8, 0x66, 0xE2, 0xD3, 0x8A, 0x7B, 0x8A, 0x2C, 0x81, 0xF4, 0xD8, 0xDC, 0xE7, 0xDA, 0x31, 0xA5,
+    0xDE, 0xB0, 0x49, 0x96, 0x71, 0xF7, 0x66, 0xC1, 0x36, 0x11, 0xEC, 0xB5, 0x66, 0x36, 0xD1, 0xAC,
+    0x33, 0xCA, 0xB4, 0x2B, 0x57, 0x26, 0x02, 0x58, 0xBB, 0x34, 0xFD, 0x29, 0x58, 0x3D, 0x1D, 0x5D,
+    0x6B, 0xE8, 0x13, 0xEF, 0x9F, 0x6E, 0x66, 0xD3, 0xE6, 0xF7, 0x4D, 0x52, 0xAB, 0xE5, 0xDE, 0x84,
+    0x62, 0x6F, 0x33, 0xFF, 0xF4, 0x3B, 0xEC, 0x45, 0x2D, 0x51, 0xCE, 0xE6, 0xB4, 0x4F, 0xC6, 0xCC,
+    0x63, 0xF2, 0xEA, 0x33, 0xE4, 0xD9, 0x94, 0x94, 0x79, 0x81, 0xA8, 0xE2, 0xD2, 0x8F, 0x0F, 0xC6,
+    0x89, 0xD0, 0xA4, 0xBB, 0x3E, 0xDB, 0xD9, 0xB2, 0x18, 0x3F, 0xF2, 0x14, 0x6C, 0xE2, 0x36, 0xFD,
+    0xC1, 0x34, 0xBB, 0x72, 0xE7, 0xE4, 0xE8, 0x10, 0x7F, 0x36, 0xE6, 0x79, 0xE1, 0x1E, 0x7C, 0x35,
+    0xA6, 0xE3, 0xAD, 0x8B, 0x59, 0xC6, 0xE3, 0xB9, 0xC1, 0xCD, 0xA4, 0x36, 0x5D, 0xD2, 0x9A, 0x7E,
+    0xD6, 0xC6, 0x83, 0x21, 0x01, 0x4D, 0x1F, 0x71, 0x60, 0x41, 0x2A, 0xE6, 0xD9, 0xC8, 0x6B, 0x91,
+    0x6D, 0xA9, 0x78, 0x49, 0x5A, 0x65, 0xCB, 0x48, 0xA9, 0xAD, 0x7D, 0xA0, 0x4A, 0x87, 0xB7, 0x71,
+    0xE9, 0x72, 0x59, 0x96, 0xF7, 0x95, 0xCD, 0x4F, 0x74, 0xD2, 0x1A, 0x3F, 0xD5, 0xF0, 0x9A, 0xCC,
+    0x54, 0xEA, 0x54, 0xF6, 0xFC, 0x9C, 0x08, 0xF8, 0xA4, 0xFC, 0x46, 0xC6, 0x4A, 0x8E, 0x79, 0x92,
+    0x5E, 0x07, 0xFC, 0xA8, 0xBC, 0x3F, 0x81, 0x5F, 0x49, 0xA3, 0xE0, 0x7B, 0x99, 0xC0, 0x4F, 0x6A,
+    0x17, 0x08, 0x7E, 0x4C, 0xDC, 0x09, 0x3E, 0x0E, 0x71, 0xA0, 0xE0, 0x7B, 0x42, 0x4B, 0xF0, 0x93,
+    0x3A, 0x2D, 0x08, 0x3E, 0x91, 0x0C, 0x04, 0x9F, 0x96, 0x85, 0x82, 0xEF, 0xBF, 0x6E, 0x15, 0xFC,
+    0xA4, 0x3E, 0x54, 0xF0, 0xE3, 0xCE, 0x06, 0x05, 0xFF, 0x90, 0x27, 0x43, 0xC1, 0xA7, 0x25, 0xC1,
+    0x4F, 0xEA, 0x59, 0x4B, 0xF0, 0x79, 0x2D, 0x1D, 0xBE, 0x1E, 0xF8, 0x7A, 0x2C, 0x65, 0x9A, 0x14,
+    0x1B, 0xBD, 0x29, 0x63, 0x29, 0x9C, 0x74, 0xE9, 0xD5, 0xE1, 0x00, 0xF3, 0x1E, 0xBE, 0x87, 0xE3,
+    0xCC, 0xF5, 0x9C, 0xAE, 0xA5, 0x9F, 0x91, 0xB3, 0x17, 0xA8, 0xA5, 0x58, 0xC4, 0x1A, 0x27, 0x09,
+    0x1A, 0x4C, 0xFD, 0x1D, 0xAC, 0x8B, 0x2E, 0x97, 0xE3, 0x39, 0xB4, 0xFF, 0x59, 0xEB, 0x6F, 0xA2,
+    0xCD, 0xE5, 0x9D, 0x8C, 0xB5, 0x36, 0x45, 0x72, 0x97, 0x19, 0xF9, 0x2F, 0x87, 0x37, 0x95, 0x21,
+    0x6C, 0xCF, 0x6D, 0xB5, 0x89, 0x7A, 0x2D, 0x94, 0x97, 0x44, 0xAA, 0xB7, 0x97, 0x2E, 0xF9, 0x6F,
+    0x93, 0x05, 0xDF, 0xED, 0x9D, 0xEB, 0xB1, 0xDC, 0x4D, 0x64, 0x61, 0x3A, 0x17, 0xB6, 0xF4, 0xAA,
+    0xA6, 0x8D, 0xD3, 0xDF, 0x9E, 0xD5, 0xBF, 0x02, 0x5B, 0x45, 0x64, 0x14, 0x24, 0x06, 0x4E, 0x37,
+    0xE0, 0xBE, 0x78, 0xB6, 0xFB, 0x48, 0xA4, 0xDE, 0x2C, 0x09, 0x48, 0x89, 0x2A, 0x4B, 0x8B, 0xB4,
+    0xF0, 0x85, 0x2B, 0x22, 0xFC, 0xFF, 0xCF, 0x5F, 0xD5, 0x54, 0x2D, 0x8F, 0xDC, 0x56, 0x14, 0x3D,
+    0xB6, 0x3B, 0xB5, 0x14, 0x83, 0x17, 0xD0, 0x25, 0x95, 0xAA, 0x17, 0x50, 0x14, 0x30, 0xFE, 0x03,
+    0xD9, 0xB1, 0xA5, 0x82, 0xD2, 0x80, 0x6C, 0x49, 0x48, 0x40, 0x48, 0xF2, 0x0B, 0x0A, 0x76, 0xD6,
+    0x6E, 0x48, 0x60, 0x4B, 0x5A, 0x5C, 0x50, 0x50, 0x2D, 0x59, 0xBA, 0x69, 0x76, 0x34, 0xEE, 0x2F,
+    0x18, 0x4B, 0x85, 0x21, 0x06, 0x91, 0x02, 0x02, 0x62, 0x30, 0xAA, 0x5C, 0xC9, 0x9E, 0x97, 0x73,
+    0xAE, 0x23, 0x45, 0xAD, 0xA2, 0x48, 0x29, 0xDB, 0x67, 0x3F, 0x5F, 0xFB, 0xBE, 0xFB, 0x71, 0xCE,
+    0xBD, 0xEF, 0x19, 0x00, 0x5C, 0x0B, 0x8C, 0x13, 0xE5, 0xEE, 0x13, 0x5F, 0xA2, 0xF1, 0x00, 0xF8,
+    0x5D, 0x87, 0x64, 0x0C, 0x40, 0xB5, 0x1B, 0xE0, 0xC6, 0xF0, 0xCF, 0xFD, 0x37, 0xBB, 0x10, 0xC6,
+    0x71, 0xAA, 0xA6, 0x6C, 0xD7, 0xDE, 0x03, 0xA6, 0x77, 0x29, 0x3E, 0xF6, 0x82, 0xC5, 0xE3, 0xF3,
+    0xDF, 0xD2, 0x10, 0x42, 0xB7, 0x0D, 0x87, 0x8B, 0xA7, 0x94, 0xCB, 0x22, 0x84, 0xFA, 0x59, 0x08,
+    0x87, 0xF8, 0x75, 0x08, 0x43, 0xB6, 0x95, 0x8A, 0xEB, 0xF5, 0x73, 0xA9, 0xDE, 0xFC, 0x4B, 0xF5,
+    0x87, 0x54, 0xAF, 0xA4, 0xFA, 0x51, 0x2A, 0x4F, 0xD5, 0xA5, 0xA7, 0xAA, 0xCB, 0xA8, 0xAA, 0x11,
+    0x77, 0x4B, 0x20, 0xAB, 0x2F, 0x81, 0x65, 0xDC, 0x01, 0x97, 0xFF, 0x43, 0xF5, 0x55, 0xD4, 0x2E,
+    0x92, 0xB1, 0xFA, 0x6B, 0x2A, 0x9A, 0xBB, 0x49, 0x9B, 0x36, 0x6E, 0xFF, 0xF9, 0x84, 0x82, 0xD7,
+    0x59, 0x35, 0x56, 0x1D, 0x6E, 0x47, 0x21, 0x0B, 0xC5, 0xC5, 0x71, 0x7E, 0x33, 0xC7, 0x87, 0xAE,
+    0x23, 0x12, 0x8C, 0x43, 0xED, 0xC2, 0xBE, 0xC0, 0xD5, 0x29, 0x8E, 0x2F, 0x91, 0x0F, 0xBA, 0x3D,
+    0x5F, 0xAE, 0xB0, 0x3A, 0xC6, 0x3A, 0xFF, 0x65, 0xC8, 0x42, 0x87, 0x47, 0xF8, 0x8C, 0x97, 0xAB,
+    0x73, 0x24, 0x43, 0xDA, 0xA3, 0x28, 0xB7, 0x48, 0xF6, 0xAE, 0x43, 0x85, 0x03, 0xB2, 0x9E, 0x95,
+    0x0A, 0xD1, 0x84, 0xBC, 0x29, 0x4A, 0xDF, 0x14, 0xB5, 0x6F, 0x8B, 0xC6, 0xB5, 0x79, 0xE3, 0x3A,
+    0xDF, 0x64, 0xBD, 0x6F, 0x53, 0x19, 0xDC, 0xC2, 0x03, 0xE0, 0x8C, 0xF9, 0x06, 0x64, 0x23, 0xD1,
+    0x37, 0x08, 0xBD, 0x14, 0xFE, 0x45, 0x83, 0xA4, 0xC7, 0x9D, 0x1C, 0xC8, 0x4B, 0x76, 0x50, 0x06,
+    0x52, 0xB8, 0x06, 0x9A, 0x6B, 0x7A, 0x14, 0xFA, 0xD6, 0x12, 0x6D, 0xF4, 0x3A, 0xA8, 0x39, 0x0D,
+    0xAF, 0x96, 0x4B, 0x6B, 0x6C, 0x4B, 0x8C, 0x49, 0x9F, 0x4E, 0x5C, 0xCA, 0xB1, 0xDA, 0xC3, 0xFD,
+    0x39, 0xC4, 0xAF, 0x5A, 0x2C, 0x5C, 0xE3, 0x3D, 0x23, 0xAE, 0xB1, 0xDF, 0xD0, 0xAD, 0xCB, 0x9E,
+    0xEC, 0x99, 0x02, 0xA7, 0x19, 0xB7, 0xC7, 0x90, 0xB4, 0x4C, 0xE6, 0x9A, 0x9C, 0x6D, 0xC1, 0x06,
+    0xEA, 0x55, 0xD2, 0x45, 0x27, 0xF7, 0x5F, 0x5A, 0x8A, 0xBC, 0x8C, 0x68, 0x4A, 0xBD, 0x30, 0xC4,
+    0xFB, 0x19, 0x18, 0x45, 0x28, 0x95, 0x3D, 0xA3, 0x48, 0x99, 0x79, 0xA7, 0x00, 0x58, 0xBA, 0xD2,
+    0x7C, 0x28, 0xCE, 0x66, 0x31, 0x9A, 0x90, 0x1B, 0x45, 0xD2, 0x99, 0x20, 0x5B, 0x09, 0x5F, 0x1E,
+    0x49, 0x14, 0x29, 0xB3, 0xBA, 0x72, 0x53, 0x04, 0xEE, 0xCB, 0x72, 0x58, 0xD2, 0xC5, 0x7D, 0xD3,
+    0x0B, 0xA9, 0xFB, 0xB6, 0x95, 0x58, 0x28, 0xF1, 0x15, 0x2C, 0x30, 0xC9, 0xAE, 0x8C, 0xB5, 0x02,
+    0x0B, 0xFB, 0x8C, 0x47, 0x8A, 0x8D, 0x95, 0x51, 0x99, 0x7C, 0x6D, 0x58, 0x0B, 0xDE, 0x3F, 0xDF,
+    0x53, 0xCD, 0xAA, 0x30, 0xC9, 0x53, 0x62, 0x1E, 0x51, 0xA0, 0x59, 0xD4, 0x27, 0x64, 0xAA, 0x98,
+    0xCF, 0xD8, 0x44, 0x65, 0x90, 0xAD, 0x70, 0xB3, 0x50, 0x74, 0x56, 0x38, 0x71, 0xCD, 0x08, 0xAF,
+    0x46, 0x12, 0x5A, 0x29, 0xC0, 0x18, 0xA9, 0x8E, 0x82, 0x6F, 0xAD, 0x0D, 0x18, 0x8D, 0x1B, 0xED,
+    0x87, 0x78, 0x50, 0x23, 0x46, 0x1C, 0x16, 0x74, 0x59, 0x23, 0xFC, 0x70, 0xB8, 0xE8, 0x0B, 0x3C,
+    0xEF, 0xAA, 0xC0, 0x4E, 0x9C, 0x0E, 0x78, 0x5C, 0xBA, 0xFA, 0x78, 0x65, 0xDD, 0x5A, 0x32, 0x20,
+    0xC3, 0x78, 0x15, 0x24, 0xE9, 0xC9, 0x9A, 0x95, 0xED, 0x5D, 0xCD, 0xC5, 0x68, 0xE0, 0xF1, 0x22,
+    0xB7, 0x31, 0x62, 0x1B, 0x04, 0xE8, 0xE8, 0xBB, 0xA9, 0x14, 0x67, 0x4D, 0x2B, 0x6D, 0x2D, 0x78,
+    0x90, 0xE7, 0x17, 0x34, 0x9F, 0xB4, 0x65, 0xF9, 0xC9, 0x19, 0xF1, 0x94, 0xE3, 0x21, 0xDE, 0x0F,
+    0x1E, 0x6A, 0x63, 0x35, 0xCE, 0x53, 0xF8, 0x32, 0x62, 0xCE, 0xDB, 0xB9, 0x79, 0xFA, 0x3B, 0xF0,
+    0xD3, 0xAB, 0x54, 0xA5, 0x95, 0xEB, 0xFD, 0xAC, 0xCD, 0xEC, 0xD4, 0x85, 0x8B, 0x89, 0x45, 0x9A,
+    0x58, 0xBA, 0x9F, 0x2C, 0x64, 0xFC, 0xBB, 0x95, 0xEF, 0x60, 0x1F, 0x55, 0xA9, 0x67, 0xAE, 0x6E,
+    0xAA, 0x48, 0x98, 0xB7, 0x07, 0xC7, 0x4D, 0xFC, 0x67, 0xCC, 0xAB, 0xCE, 0x0A, 0xE6, 0xE7, 0x7A,
+    0x09, 0x14, 0x56, 0xF6, 0xDC, 0x9C, 0x59, 0x21, 0x95, 0x38, 0x1A, 0x05, 0x25, 0xD9, 0x0B, 0x14,
+    0x0B, 0xD3, 0xC8, 0x55, 0xCE, 0xAE, 0x4D, 0x0D, 0x6A, 0xA2, 0x7E, 0xD7, 0x62, 0x52, 0xD0, 0x16,
+    0xD8, 0x9E, 0x9C, 0x90, 0x46, 0x50, 0xAD, 0x22, 0x7B, 0xC6, 0x87, 0xF3, 0xF3, 0x6D, 0x2D, 0x33,
+    0xDF, 0xC8, 0xC5, 0xB5, 0x3C, 0x97, 0xA4, 0xAD, 0x80, 0x69, 0x2F, 0xAC, 0xC9, 0xA0, 0x14, 0xF1,
+    0x58, 0x29, 0xE9, 0x64, 0x4C, 0xF4, 0xF8, 0xD2, 0x08, 0x16, 0x46, 0x26, 0x18, 0x49, 0xC3, 0x36,
+    0x37, 0xD9, 0x99, 0x7A, 0x81, 0xEB, 0xC7, 0xEB, 0xC6, 0xAF, 0xD6, 0x23, 0xC3, 0x56, 0x09, 0x55,
+    0x34, 0x6D, 0x8D, 0x96, 0xB7, 0x3F, 0x8A, 0x42, 0x91, 0xD6, 0xDD, 0x6B, 0xC7, 0xEB, 0x21, 0xBE,
+    0xA6, 0x41, 0x28, 0xBF, 0xA7, 0x4B, 0xF8, 0x5B, 0x59, 0x32, 0xFD, 0x41, 0xEF, 0x60, 0xDB, 0xD8,
+    0xC1, 0xB8, 0x86, 0x3B, 0xF0, 0x63, 0xE3, 0x2D, 0xCD, 0x55, 0x3D, 0x6E, 0xD4, 0x50, 0x10, 0x1E,
+    0x7B, 0xC9, 0x5A, 0xE2, 0x15, 0x4E, 0x91, 0x6E, 0x0B, 0x1F, 0xC1, 0x37, 0x88, 0xCD, 0x0D, 0x22,
+    0x14, 0xD7, 0xF4, 0x29, 0xC8, 0x0D, 0x58, 0xDF, 0x80, 0x3D, 0x02, 0x05, 0x05, 0x2C, 0x05, 0x27,
+    0x08, 0x36, 0x35, 0x05, 0x2E, 0xA0, 0x66, 0x8B, 0xD0, 0x50, 0x59, 0xC8, 0x48, 0xBB, 0x92, 0xED,
+    0xE1, 0xFB, 0xE6, 0x6D, 0x76, 0xA3, 0x08, 0x84, 0x82, 0xA2, 0x80, 0xB5, 0x6F, 0xC6, 0xFB, 0xDE,
+    0xFC, 0x7C, 0xF3, 0xE6, 0xC7, 0x22, 0x79, 0x20, 0x22, 0x93, 0x36, 0xAE, 0x45, 0x22, 0xA3, 0xFE,
+    0xDD, 0xEF, 0xFF, 0xE2, 0x71, 0x2B, 0xD2, 0xB8, 0x25, 0x4D, 0x3A, 0xD2, 0xAC, 0x27, 0x3D, 0x36,
+    0x7A, 0xF1, 0x8C, 0xB4, 0xCF, 0x40, 0x82, 0x3E, 0xCB, 0x61, 0xAD, 0x4B, 0x76, 0x36, 0xDD, 0x8A,
+    0xCA, 0x71, 0x13, 0x41, 0x39, 0xA9, 0x27, 0x50, 0x4E, 0xCB, 0x70, 0x0D, 0x03, 0x90, 0x15, 0xA9,
+    0x8A, 0x62, 0x10, 0x51, 0x3C, 0x12, 0x18, 0x0D, 0xC7, 0xE5, 0xB2, 0x2A, 0x29, 0x96, 0xD4, 0x54,
+    0x89, 0x9B, 0x18, 0xEA, 0xAE, 0x4D, 0x0C, 0x6A, 0x4A, 0xB3, 0x6B, 0xBA, 0x08, 0xFB, 0x39, 0x9D,
+    0x0E, 0x23, 0x29, 0xC8, 0x74, 0xB1, 0x47, 0xB5, 0x31, 0x3C, 0x6D, 0x7C, 0x8D, 0x26, 0xA4, 0xD5,
+    0x40, 0x9A, 0xAE, 0xFF, 0xDF, 0x28, 0x24, 0x81, 0x36, 0x79, 0x66, 0x66, 0x44, 0xE6, 0x5B, 0x3E,
+    0x26, 0x8D, 0x18, 0x30, 0x4B, 0x13, 0xB4, 0x3D, 0xF7, 0xC9, 0x83, 0xFD, 0x95, 0xE7, 0x49, 0xED,
+    0x79, 0x5A, 0x7A, 0x9E, 0x89, 0xE7, 0x95, 0xC4, 0x5F, 0x8B, 0x53, 0x38, 0x92, 0x58, 0xB5, 0x87,
+    0x5B, 0xCF, 0x01, 0xD0, 0xF6, 0xDD, 0x8F, 0xE2, 0x09, 0xE5, 0xB0, 0xA9, 0xE4, 0xE9, 0x96, 0x67,
+    0xDF, 0x96, 0x15, 0x39, 0x40, 0x9A, 0x9D, 0xD1, 0x73, 0x86, 0x6C, 0x45, 0xB3, 0xF6, 0xDC, 0x22,
+    0xAC, 0x89, 0xC2, 0x9B, 0x60, 0x94, 0xE4, 0x59, 0xE9, 0xF9, 0xB6, 0x88, 0x66, 0xBA, 0x01, 0x12,
+    0xD5, 0x8E, 0x37, 0xD5, 0x07, 0xDA, 0xC8, 0x53, 0xD1, 0x92, 0xE8, 0x48, 0x28, 0x2C, 0xA9, 0xA1,
+    0x60, 0xB1, 0x45, 0x9D, 0x78, 0x47, 0x04, 0x7F, 0x75, 0xE2, 0x58, 0x80, 0xE1, 0x8D, 0x4D, 0x93,
+    0xB4, 0xCB, 0x93, 0xCC, 0x84, 0xEC, 0xBF, 0xEE, 0x92, 0x1C, 0xC2, 0xC7, 0x01, 0x42, 0x5A, 0x6A,
+    0x1E, 0xC2, 0x71, 0x23, 0x4E, 0x15, 0x1E, 0xA2, 0x4F, 0x74, 0xB0, 0xDA, 0xE9, 0xCE, 0xAC, 0xB8,
+    0x8F, 0xED, 0x36, 0xCB, 0x6D, 0xC9, 0x87, 0xCA, 0xCD, 0x0A, 0x57, 0x1F, 0xBC, 0xDE, 0xDA, 0xA4,
+    0x8B, 0xB8, 0x61, 0x59, 0xB0, 0x58, 0xB0, 0x8E, 0x76, 0x4D, 0x82, 0x5C, 0x0D, 0x58, 0xA3, 0x2D,
+    0x7F, 0x6B, 0xBF, 0x5F, 0x45, 0x71, 0x0A, 0xB9, 0xDE, 0x16, 0xDF, 0xFF, 0x24, 0xEF, 0xED, 0x8F,
+    0x57, 0x4B, 0xE4, 0xE1, 0x0B, 0xC4, 0x0F, 0x20, 0xF3, 0xD2, 0x02, 0x60, 0x31, 0x46, 0x80, 0x7C,
+    0xAD, 0x81, 0xEF, 0x15, 0xCF, 0x14, 0x70, 0x62, 0xDC, 0x47, 0x06, 0x2C, 0x63, 0x86, 0xDE, 0x88,
+    0x1B, 0xD7, 0x84, 0xDD, 0x81, 0xC8, 0xE1, 0x3F, 0xC1, 0x73, 0x12, 0xE4, 0x61, 0xE7, 0x9A, 0xC9,
+    0xDA, 0xAD, 0xC2, 0x2E, 0x6A, 0x6E, 0x4E, 0xB6, 0xFB, 0xC4, 0x72, 0x96, 0xB3, 0x72, 0x46, 0x76,
+    0x1F, 0x2B, 0x06, 0xBF, 0x13, 0xC3, 0x80, 0x51, 0xF1, 0x41, 0x75, 0xAA, 0x97, 0x28, 0x73, 0xB4,
+    0x10, 0xBA, 0x66, 0x2E, 0xB7, 0x7C, 0x9D, 0x6D, 0x22, 0xD5, 0x94, 0x1D, 0xFD, 0x0A, 0xC5, 0x10,
+    0x0C, 0xEC, 0x9D, 0x77, 0x82, 0x70, 0x1F, 0xC8, 0x9D, 0xBB, 0x38, 0x43, 0x72, 0x5B, 0xE6, 0x37,
+    0x7B, 0xDE, 0xA4, 0xE5, 0x90, 0xE6, 0xEE, 0xF3, 0x2E, 0xB9, 0x10, 0x41, 0x6F, 0xD5, 0x33, 0x5D,
+    0x30, 0x7A, 0xA8, 0xC2, 0x00, 0x9B, 0xF7, 0x2F, 0xFF, 0x9C, 0x5F, 0x02, 0x78, 0x5D, 0x69, 0x7B,
+    0x24, 0x8F, 0x3B, 0xF7, 0x65, 0x95, 0xBD, 0xCD, 0x2F, 0x0E, 0x25, 0xDF, 0x27, 0xEF, 0xBB, 0xEA,
+    0xFB, 0x6A, 0x73, 0xFB, 0x60, 0xAE, 0x5E, 0xA7, 0xE3, 0x23, 0xBB, 0x19, 0x99, 0xA8, 0xBE, 0x14,
+    0x1B, 0xDD, 0x9D, 0x1F, 0xBA, 0x0D, 0xBA, 0x3B, 0x38, 0x1F, 0x38, 0x1A, 0xD9, 0xF8, 0x48, 0x59,
+    0xD4, 0x0B, 0x47, 0xF5, 0xBC, 0x64, 0xDB, 0xBB, 0x96, 0x07, 0xB8, 0xE8, 0xC1, 0x46, 0x16, 0x0F,
+    0x5C, 0xCB, 0x83, 0xB0, 0x7F, 0x33, 0x2E, 0x4B, 0x99, 0xC3, 0x06, 0x7C, 0x7C, 0xE4, 0x74, 0xC5,
+    0xB8, 0xB7, 0x03, 0x6A, 0x60, 0x5E, 0xED, 0x35, 0x92, 0x86, 0x1A, 0xB1, 0x99, 0x8A, 0xD6, 0x7B,
+    0x1F, 0x6E, 0xE0, 0x68, 0xA1, 0x73, 0x00, 0xF1, 0x1F, 0x14, 0x7E, 0x62, 0x74, 0x5C, 0xC8, 0x9D,
+    0x3E, 0x3F, 0x01, 0xD5, 0x55, 0x3B, 0x8E, 0xD4, 0x40, 0x10, 0xAD, 0x76, 0x03, 0x16, 0x18, 0xA9,
+    0x09, 0x20, 0x36, 0x37, 0xF0, 0x0D, 0xB0, 0xA5, 0xBD, 0x00, 0xC1, 0xE6, 0x70, 0x03, 0x52, 0xA2,
+    0x69, 0x1F, 0x61, 0x73, 0x12, 0x82, 0x8D, 0x86, 0x80, 0x1B, 0x6C, 0x3B, 0xDB, 0x74, 0x88, 0x08,
+    0xB1, 0x18, 0xA4, 0x0D, 0x08, 0xD6, 0x81, 0x25, 0x5B, 0x4B, 0xDB, 0x45, 0xBD, 0xB2, 0x76, 0xF6,
+    0x33, 0x44, 0x88, 0x80, 0x99, 0xA0, 0xF4, 0xA6, 0x3F, 0x55, 0xF5, 0xAA, 0x5E, 0xB5, 0xC9, 0x9C,
+    0xD0, 0x5B, 0x22, 0x6E, 0x1D, 0x51, 0xC9, 0x17, 0x2D, 0xD9, 0x2F, 0x1C, 0x89, 0xDE, 0x1B, 0xAE,
+    0xC8, 0xD0, 0xDD, 0x9F, 0xAF, 0x89, 0xEC, 0xC5, 0x04, 0xE4, 0x3B, 0xA2, 0x74, 0xE0, 0x1A, 0x70,
+    0x02, 0xBC, 0x94, 0x05, 0xBF, 0x92, 0x13, 0xE9, 0xF0, 0x3D, 0x02, 0xBA, 0x4E, 0x60, 0x2B, 0x0B,
+    0x7E, 0x95, 0x44, 0x40, 0x59, 0xF0, 0x9E, 0x7C, 0x95, 0x0E, 0x9D, 0x8D, 0x80, 0xAE, 0x15, 0x28,
+    0x0B, 0x02, 0x6D, 0x04, 0x74, 0x6D, 0xE9, 0x89, 0xC2, 0x91, 0x40, 0x1B, 0x01, 0xF3, 0xAD, 0x40,
+    0x0A, 0x72, 0x80, 0x2C, 0x03, 0xE6, 0x2C, 0x90, 0x02, 0xA0, 0x55, 0x98, 0x0B, 0x5A, 0x6B, 0x72,
+    0xC5, 0x06, 0x56, 0x42, 0xE1, 0x57, 0xD6, 0xB0, 0xB6, 0x5F, 0x76, 0xD4, 0x9A, 0xEA, 0x1E, 0x1B,
+    0x7A, 0xC7, 0x3F, 0x64, 0x99, 0x99, 0x37, 0x94, 0x88, 0x9D, 0xC5, 0x4A, 0xB6, 0x9D, 0x61, 0x71,
+    0x33, 0x13, 0xC3, 0x4D, 0xE3, 0xE5, 0x96, 0x1D, 0xCB, 0x06, 0x51, 0x5D, 0x8B, 0x80, 0x5F, 0xE1,
+    0xD4, 0x5E, 0x69, 0x1C, 0x0E, 0xEA, 0xFF, 0x12, 0xDB, 0xD9, 0xAF, 0x0E, 0xF1, 0x67, 0xDD, 0x08,
+    0xB7, 0x36, 0x1C, 0xB2, 0x15, 0x27, 0xA8, 0x1B, 0x4D, 0x8B, 0xAB, 0xAC, 0xD7, 0x24, 0x59, 0xF3,
+    0x06, 0x87, 0xA2, 0x4D, 0xA4, 0xE0, 0x52, 0xD5, 0x82, 0xD7, 0xDC, 0x69, 0x56, 0x12, 0x2D, 0x65,
+    0x54, 0x98, 0xCC, 0xF1, 0x92, 0xF0, 0x93, 0x8F, 0xB0, 0xE9, 0xA8, 0xDC, 0xC6, 0x1B, 0xBA, 0x66,
+    0x21, 0xAD, 0x2B, 0xF4, 0x9C, 0x0E, 0x9D, 0x67, 0x72, 0xAA, 0x04, 0x59, 0x31, 0x6B, 0xB4, 0x18,
+    0x94, 0x66, 0x26, 0x67, 0xCD, 0x48, 0x2B, 0xF9, 0xF3, 0x6C, 0xBF, 0xA1, 0x87, 0xC6, 0xF3, 0x98,
+    0x1E, 0xE3, 0x6E, 0x9B, 0x49, 0x4E, 0x9E, 0x3F, 0x88, 0xA3, 0x57, 0x19, 0x4E, 0x39, 0xB9, 0x4D,
+    0x7B, 0xC3, 0x87, 0x7B, 0x81, 0x4F, 0xD4, 0x89, 0xB8, 0xCE, 0xC4, 0x8E, 0x94, 0xCD, 0xE2, 0xBA,
+    0x49, 0x25, 0xC7, 0x6C, 0xB4, 0xC8, 0x94, 0x0D, 0xD2, 0x72, 0x2D, 0x6B, 0xD5, 0x74, 0x0C, 0xFC,
+    0x1B, 0x4C, 0x86, 0xFB, 0xA9, 0x59, 0xEF, 0xD3, 0xF9, 0x03, 0xCF, 0xF2, 0x9B, 0xF2, 0xDC, 0x6A,
+    0x65, 0xFA, 0xC5, 0x95, 0x8E, 0xD7, 0xAC, 0x31, 0x42, 0xE5, 0x65, 0x3F, 0xD4, 0xD9, 0x84, 0xE0,
+    0x14, 0xE6, 0x4F, 0x62, 0x91, 0x55, 0x8D, 0x01, 0x9D, 0xE1, 0xE1, 0xE1, 0x6B, 0xD2, 0x1E, 0xA1,
+    0x45, 0x2B, 0x03, 0x61, 0x16, 0x0D, 0x5C, 0xA7, 0x6D, 0x5E, 0xEF, 0x36, 0x0E, 0x9D, 0xE0, 0x03,
+    0x38, 0xAF, 0xC8, 0x9E, 0xF7, 0xA2, 0x86, 0x50, 0xD9, 0x98, 0xF5, 0x72, 0x3D, 0x1C, 0x45, 0xCA,
+    0x06, 0x3C, 0x81, 0x48, 0x3A, 0x42, 0xC8, 0x72, 0x86, 0xE5, 0x4C, 0xBC, 0x7B, 0xA6, 0x97, 0xBD,
+    0xB3, 0xA7, 0x44, 0x8F, 0x6E, 0xF8, 0xBF, 0x54, 0x11, 0x97, 0x2A, 0x17, 0xAE, 0x21, 0x62, 0x6E,
+    0x20, 0xE2, 0xD0, 0x42, 0xC4, 0x92, 0x0E, 0xA3, 0x3A, 0x10, 0xB1, 0x1D, 0x20, 0x62, 0xDB, 0x43,
+    0xC4, 0x49, 0x84, 0x88, 0x4D, 0x54, 0x11, 0x4F, 0x2A, 0xE2, 0x33, 0xE5, 0xEE, 0x95, 0x7B, 0x59,
+    0x81, 0xBB, 0x54, 0x4A, 0xB8, 0xE7, 0x0D, 0x36, 0x5C, 0x03, 0x11, 0xBB, 0x0D, 0x44, 0x8C, 0x91,
+    0x9A, 0xCA, 0x73, 0x3C, 0xB3, 0xE9, 0xD0, 0xAB, 0x88, 0x47, 0x15, 0x71, 0xBC, 0x25, 0x62, 0x56,
+    0x11, 0x07, 0x15, 0x71, 0xA9, 0x22, 0xB6, 0xD5, 0xF5, 0xA3, 0xB4, 0x7B, 0x98, 0x12, 0x1D, 0x88,
+    0xA2, 0xD9, 0x3D, 0x4E, 0x05, 0x9A, 0x9C, 0x74, 0x7B, 0x8F, 0x12, 0x24, 0x90, 0xA2, 0x29, 0x46,
+    0x7B, 0xE2, 0xD1, 0x92, 0x1C, 0xAD, 0xFA, 0x87, 0x8B, 0xF8, 0x36, 0x14, 0xE8, 0xB2, 0xDB, 0x4A,
+    0x2E, 0x69, 0x1F, 0xA4, 0x64, 0xD1, 0x8D, 0x94, 0x4A, 0x7D, 0xAE, 0x3E, 0x4F, 0xE4, 0x98, 0x27,
+    0x4C, 0x1D, 0x12, 0x7D, 0xB1, 0x88, 0x71, 0x7D, 0xFD, 0x89, 0x23, 0x9D, 0x69, 0x25, 0x92, 0xAB,
+    0x4E, 0x9A, 0xBD, 0xCF, 0xC7, 0x7F, 0x4A, 0xE1, 0x2F, 0x7E, 0xBF, 0x01, 0xBD, 0x55, 0xB1, 0x8E,
+    0xDD, 0x44, 0x14, 0xBD, 0xF3, 0x9C, 0x8D, 0x91, 0x5C, 0x98, 0x62, 0x53, 0x10, 0x0A, 0xF7, 0x91,
+    0xD0, 0x7C, 0x01, 0x8C, 0x09, 0x05, 0xED, 0x46, 0xDA, 0x27, 0x4A, 0x3E, 0x80, 0x62, 0xBF, 0x80,
+    0xB5, 0x25, 0x24, 0x28, 0x01, 0x09, 0xF8, 0x83, 0x48, 0xD9, 0xD7, 0xA4, 0xA5, 0x58, 0xED, 0x8C,
+    0xA0, 0xA0, 0x48, 0xF1, 0x1C, 0x7E, 0x80, 0x17, 0x20, 0xA0, 0xD0, 0xAC, 0x15, 0x1C, 0xE1, 0x6C,
+    0x6C, 0x5F, 0xCE, 0x19, 0xBF, 0xA7, 0xC0, 0x2A, 0x15, 0x22, 0xB1, 0x9E, 0xFD, 0x66, 0xEE, 0x8C,
+    0xEF, 0x3D, 0xF7, 0xDC, 0x3B, 0xC7, 0x22, 0x37, 0x4A, 0x11, 0x71, 0x2D, 0x1E, 0x56, 0xF1, 0x28,
+    0xEE, 0x61, 0x58, 0x84, 0x33, 0x3C, 0xEA, 0x74, 0x23, 0x46, 0x64, 0x5F, 0x9E, 0x5F, 0x45, 0x2D,
+    0x92, 0x3E, 0xC3, 0x0E, 0x33, 0x0D, 0x98, 0x56, 0x9E, 0xB6, 0xF3, 0xF0, 0xBF, 0x1A, 0x2B, 0x42,
+    0xF9, 0x09, 0xC6, 0xFC, 0x97, 0x1E, 0x2B, 0x9D, 0x2F, 0x25, 0x19, 0xF2, 0x5E, 0xD2, 0x51, 0xF4,
+    0xE2, 0xEE, 0x28, 0xB9, 0xEA, 0x88, 0x6D, 0x8A, 0x45, 0xB9, 0x46, 0xF0, 0x46, 0xAE, 0x60, 0x5F,
+    0x5B, 0x04, 0x31, 0x43, 0x0A, 0x3F, 0xC7, 0xD2, 0x6F, 0x8D, 0x97, 0xAE, 0xE3, 0x97, 0x80, 0xF6,
+    0x92, 0x71, 0xA4, 0xD1, 0x33, 0x05, 0xF7, 0xF9, 0x06, 0x2B, 0x3F, 0x02, 0x6A, 0xDE, 0xBA, 0x8D,
+    0x14, 0x5D, 0xA2, 0x7F, 0xF8, 0x4E, 0x9C, 0x6A, 0x27, 0x46, 0x15, 0x8B, 0xB2, 0x8C, 0xA8, 0x56,
+    0x91, 0x58, 0xCE, 0x13, 0xA6, 0x24, 0x67, 0x3B, 0xA2, 0x25, 0xA1, 0xF1, 0x5F, 0xFC, 0x8B, 0x64,
+    0xB0, 0x99, 0xBE, 0x42, 0xDE, 0xEE, 0x13, 0xC4, 0xCA, 0xDA, 0xBC, 0x11, 0x19, 0x05, 0x30, 0x6C,
+    0x48, 0x3A, 0xC1, 0xCF, 0x06, 0xCE, 0x26, 0x29, 0x1A, 0xAC, 0xD2, 0xA5, 0xAB, 0x81, 0xC7, 0x0C,
+    0x39, 0xDE, 0xCC, 0x1F, 0x44, 0xD0, 0x0E, 0xDE, 0x13, 0x65, 0xCD, 0x8B, 0x91, 0x4E, 0x35, 0x30,
+    0x5A, 0xC7, 0xA1, 0x2B, 0xFF, 0xC3, 0x90, 0xF9, 0x92, 0xF9, 0x4B, 0x03, 0x45, 0x8D, 0x2A, 0x3C,
+    0x30, 0xD0, 0xB6, 0x42, 0xD6, 0x9F, 0xB5, 0x28, 0x25, 0x96, 0xF2, 0xDF, 0xB1, 0x67, 0xC2, 0x20,
+    0xFB, 0x6B, 0x3B, 0xA0, 0xC5, 0x8C, 0x18, 0xB8, 0x1F, 0x5A, 0x70, 0x55, 0xAD, 0xFC, 0xC4, 0xB7,
+    0xCA, 0x4A, 0xA7, 0xF2, 0x05, 0x9E, 0x77, 0x03, 0x91, 0xEB, 0x27, 0xF0, 0xA2, 0x5A, 0x0B, 0x76,
+    0x37, 0xF9, 0x53, 0xE3, 0x03, 0xB8, 0xA9, 0x6E, 0x22, 0xED, 0x09, 0x09, 0x27, 0x3D, 0x30, 0xE6,
+    0x0D, 0x92, 0x54, 0xE0, 0xCC, 0x41, 0x96, 0x51, 0xC0, 0xC6, 0xCA, 0x08, 0x9E, 0x93, 0x8E, 0xC6,
+    0x06, 0x33, 0x57, 0x16, 0x34, 0xB9, 0x16, 0x06, 0xD7, 0x81, 0x52, 0x1B, 0x5F, 0xEC, 0x47, 0x42,
+    0x44, 0x82, 0xF9, 0x39, 0x58, 0x2E, 0x14, 0xF9, 0x56, 0x30, 0x19, 0xED, 0xF6, 0x69, 0x3A, 0x5E,
+    0xAA, 0x7B, 0x17, 0xF5, 0x1C, 0x17, 0xCA, 0x25, 0x36, 0xE3, 0x0D, 0x30, 0x9B, 0x91, 0x1C, 0x9E,
+    0x25, 0x32, 0x2E, 0x24, 0x3C, 0x27, 0xBF, 0x07, 0xDB, 0x0A, 0x2E, 0xE9, 0x69, 0x64, 0x23, 0x6C,
+    0xB2, 0x87, 0x6F, 0x0E, 0x52, 0x0B, 0xCB, 0x91, 0xB1, 0x7B, 0xB8, 0xD7, 0xB1, 0x2A, 0xE1, 0xAA,
+    0xD7, 0xB6, 0x50, 0x1D, 0xEC, 0xC5, 0x61, 0x65, 0xD1, 0x3D, 0xEB, 0x8D, 0xA4, 0x7F, 0x76, 0x73,
+    0x7F, 0x79, 0x40, 0x73, 0xEB, 0x56, 0xAA, 0xC7, 0xBA, 0x9C, 0x06, 0xA7, 0x93, 0x5D, 0xE8, 0x98,
+    0x05, 0x13, 0x03, 0x2C, 0xEE, 0xE0, 0x66, 0x51, 0xA7, 0xED, 0xCD, 0xA6, 0x7F, 0x07, 0xF7, 0x9E,
+    0xBC, 0x8A, 0xF8, 0xE6, 0x64, 0xDB, 0x4E, 0x1A, 0x37, 0xD6, 0x72, 0xB6, 0xE8, 0x01, 0xC1, 0xD6,
+    0x38, 0x8D, 0xE5, 0x2B, 0x88, 0xFF, 0x86, 0x5C, 0x45, 0xED, 0x92, 0x60, 0xF5, 0xB7, 0x36, 0xFF,
+    0x54, 0xBB, 0x24, 0x14, 0xFD, 0x2E, 0x30, 0x02, 0x1C, 0x52, 0x38, 0x3A, 0xF6, 0x4A, 0x6D, 0xBF,
+    0x3A, 0x6A, 0x17, 0x33, 0x45, 0x36, 0x6C, 0x5B, 0x2A, 0x1E, 0x0E, 0xB9, 0xAE, 0x1A, 0xD0, 0xB6,
+    0xAD, 0x7F, 0x74, 0x6B, 0xF0, 0x75, 0x3C, 0x2D, 0xC5, 0xBA, 0x91, 0x14, 0xBD, 0xBA, 0x18, 0xD8,
+    0x4A, 0x2E, 0x18, 0xBD, 0x37, 0x7E, 0xF0, 0xAC, 0x45, 0x6F, 0x9F, 0x66, 0xDA, 0x59, 0xD9, 0x2B,
+    0xE3, 0x41, 0x3D, 0xC0, 0xB9, 0x3D, 0x46, 0x2A, 0x36, 0x98, 0x1E, 0xE2, 0x79, 0x45, 0x5E, 0x7F,
+    0x7E, 0x70, 0x5F, 0x6E, 0x6C, 0x61, 0xD9, 0x29, 0x2A, 0xDD, 0xC7, 0x22, 0xDF, 0x66, 0xB5, 0xBC,
+    0x65, 0xC0, 0x58, 0x8D, 0x4E, 0xA4, 0x4C, 0xE5, 0x74, 0xBE, 0xC3, 0xB2, 0x77, 0x40, 0xFD, 0x69,
+    0x12, 0xD5, 0x49, 0xCE, 0x6E, 0xF9, 0xF0, 0xDA, 0xAC, 0x3B, 0x51, 0xC8, 0x00, 0x26, 0x99, 0x0B,
+    0xF1, 0x91, 0x2A, 0x76, 0xE9, 0x77, 0x7A, 0xFB, 0xFD, 0xC7, 0x13, 0x0C, 0x13, 0x65, 0xA3, 0x94,
+    0x02, 0xC2, 0x9C, 0xA1, 0x10, 0xC9, 0xA0, 0x38, 0xDF, 0xF6, 0xC9, 0x87, 0xE7, 0xDF, 0xAB, 0xFE,
+    0xDC, 0x5A, 0x6D, 0x4E, 0xE5, 0xDA, 0x36, 0xCB, 0x25, 0x4F, 0xE4, 0x68, 0xE0, 0x9E, 0x0A, 0x50,
+    0xA1, 0x13, 0xDC, 0x97, 0xD5, 0xF9, 0xAF, 0x47, 0x1B, 0x53, 0x0A, 0x14, 0x90, 0xDA, 0x95, 0x4C,
+    0x48, 0x87, 0xC5, 0x0E, 0x73, 0xCC, 0x81, 0x1A, 0x16, 0xA7, 0x38, 0xA1, 0x1E, 0x71, 0x95, 0x67,
+    0x8A, 0x57, 0xA3, 0x0F, 0xDF, 0x9B, 0x56, 0xAB, 0x13, 0x34, 0x41, 0x54, 0xAD, 0x3E, 0x6E, 0xA6,
+    0xF4, 0xB8, 0x99, 0xB9, 0x74, 0x9C, 0xA7, 0x94, 0x33, 0xAC, 0x5A, 0x1F, 0x64, 0xDF, 0x3E, 0x39,
+    0x7A, 0xA0, 0xB7, 0x7D, 0x3D, 0x6B, 0x4F, 0x8F, 0xF6, 0x00, 0x22, 0x64, 0x70, 0x38, 0x03, 0x34,
+    0xCB, 0xC8, 0x80, 0x55, 0xBD, 0xA9, 0x5F, 0x9F, 0x52, 0x7A, 0x95, 0x1F, 0x9A, 0xB9, 0x18, 0xD3,
+    0xAC, 0xC3, 0x94, 0x55, 0xEA, 0xDB, 0x76, 0xCA, 0xF6, 0x2C, 0x9A, 0x88, 0x50, 0xAA, 0x20, 0xA5,
+    0x7F, 0x74, 0xB7, 0xF4, 0x70, 0x7B, 0x04, 0xCE, 0x33, 0xD8, 0xDF, 0xE6, 0x07, 0x81, 0xCA, 0x00,
+    0x30, 0xA7, 0xF8, 0xEF, 0x22, 0x99, 0x8E, 0x15, 0xFB, 0x62, 0x96, 0xF8, 0xA8, 0x0A, 0x0C, 0x10,
+    0xCB, 0x1E, 0x05, 0x34, 0x0B, 0xFF, 0x90, 0x77, 0x02, 0x4B, 0xE1, 0x71, 0xC1, 0x0F, 0x84, 0xBF,
+    0x5F, 0x35, 0x08, 0xE7, 0x99, 0x6E, 0x0F, 0xA1, 0xB3, 0xF8, 0x2A, 0x9B, 0x81, 0x1F, 0xE5, 0x35,
+    0x38, 0x19, 0x48, 0xCC, 0xFA, 0x62, 0xB5, 0xBA, 0x33, 0xED, 0x54, 0x86, 0xD5, 0x63, 0x06, 0x11,
+    0x20, 0x51, 0xEC, 0xA7, 0xFA, 0x8D, 0x2F, 0x0B, 0x3A, 0xB3, 0xFA, 0x34, 0x56, 0xFD, 0x45, 0xD7,
+    0xDF, 0xBD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0xB6, 0x2F, 0x58, 0x8A, 0x8B, 0x4D, 0x91,
+    0x08, 0xA8, 0xDC, 0xD3, 0xB8, 0xA1, 0x44, 0xD8, 0x52, 0x3E, 0x80, 0x2B, 0x48, 0x9A, 0x14, 0x34,
+    0x54, 0x50, 0xE4, 0x0F, 0x62, 0x77, 0x94, 0xD0, 0x40, 0x4D, 0x41, 0x11, 0xEE, 0x0B, 0x28, 0x92,
+    0xB3, 0x25, 0xCA, 0x14, 0x31, 0x15, 0x05, 0x05, 0x46, 0x51, 0x94, 0x82, 0x02, 0x2B, 0x31, 0xC2,
+    0x49, 0x6C, 0x0F, 0x6F, 0x7C, 0x77, 0x39, 0x40, 0x14, 0x84, 0x48, 0xD9, 0x8B, 0x9D, 0xDD, 0xBD,
+    0x9D, 0xD9, 0x37, 0x33, 0x6F, 0xDE, 0x01, 0x8B, 0xAF, 0x01, 0xAB, 0x03, 0x10, 0x26, 0x80, 0x57,
+    0x72, 0xD1, 0x70, 0x71, 0x9F, 0x8F, 0x15, 0x61, 0x32, 0xAC, 0x87, 0x80, 0x2B, 0x2D, 0x6C, 0x91,
+    0x0A, 0xE9, 0x87, 0x38, 0xF7, 0x73, 0xA4, 0x4E, 0x0D, 0xA7, 0x8E, 0x81, 0x60, 0xAF, 0xA4, 0xC9,
+    0x18, 0xF0, 0xF7, 0x45, 0xA4, 0xE1, 0x23, 0xFB, 0x67, 0xA3, 0xD1, 0xB6, 0xBA, 0x34, 0x05, 0x5F,
+    0x29, 0x1F, 0xB7, 0xD2, 0x0B, 0x32, 0xBA, 0x12, 0x60, 0xD9, 0x95, 0x57, 0x69, 0xE4, 0xAB, 0xB3,
+    0x40, 0x4E, 0x81, 0x85, 0x21, 0x60, 0xBF, 0xE1, 0x01, 0xE1, 0x81, 0x80, 0x07, 0xBC, 0xE3, 0x86,
+    0x2E, 0xBD, 0x02, 0x5B, 0xF0, 0x13, 0x8B, 0x06, 0xD7, 0x06, 0x63, 0x09, 0x11, 0xAF, 0xDC, 0x82,
+    0xDD, 0xB8, 0x65, 0x3F, 0xE9, 0x77, 0xE6, 0x63, 0x85, 0x8B, 0x58, 0x72, 0x1A, 0x48, 0xE4, 0xB5,
+    0x37, 0x5B, 0xAB, 0x65, 0xCA, 0x98, 0xB8, 0xF0, 0x59, 0x49, 0x1B, 0x5E, 0xE1, 0xEF, 0x15, 0x84,
+    0xD1, 0xDF, 0xDE, 0xC3, 0x18, 0x8D, 0x46, 0xCF, 0xF5, 0x76, 0x85, 0xA1, 0xC9, 0x45, 0x4C, 0x0F,
+    0x8E, 0x66, 0xD8, 0x27, 0xDE, 0x28, 0x3E, 0x7D, 0x5A, 0x59, 0x3C, 0x18, 0x31, 0xA6, 0x17, 0xC0,
+    0x1A, 0x70, 0x27, 0x71, 0x6B, 0x62, 0xE5, 0xD9, 0x31, 0xBC, 0x9C, 0xD7, 0xEB, 0x08, 0x23, 0x93,
+    0x3B, 0x15, 0xDA, 0x7F, 0x9A, 0x60, 0x84, 0x38, 0x09, 0xB3, 0x20, 0x33, 0xFC, 0x4C, 0x6B, 0x78,
+    0x09, 0xF3, 0x30, 0x52, 0x10, 0xF0, 0x34, 0xCF, 0x25, 0xE2, 0x20, 0xF3, 0xB3, 0xD4, 0x29, 0xAC,
+    0x66, 0x79, 0xCE, 0x07, 0x9E, 0xD3, 0x63, 0x57, 0xFC, 0x37, 0xC0, 0x52, 0x88, 0x26, 0xB6, 0x1A,
+    0xBE, 0x07, 0xD3, 0x40, 0xFB, 0xD1, 0x5E, 0xE1, 0x6F, 0xA0, 0x0E, 0x76, 0xB1, 0x03, 0x47, 0xFC,
+    0x8A, 0x11, 0x74, 0x5A, 0xEB, 0x5C, 0x69, 0x95, 0xC0, 0xED, 0xD2, 0x04, 0x41, 0xC6, 0x0A, 0xDC,
+    0xED, 0xD9, 0xA0, 0xE7, 0x95, 0xED, 0xD6, 0x68, 0xB5, 0x82, 0xC8, 0x51, 0x41, 0x2E, 0x48, 0xC6,
+    0xC2, 0xCA, 0x83, 0x12, 0x6E, 0x4B, 0x52, 0xB9, 0x67, 0xAC, 0x94, 0xF9, 0xC6, 0x02, 0x86, 0x29,
+    0x83, 0x1F, 0xD3, 0xC0, 0x3E, 0x27, 0x7A, 0xF3, 0x49, 0xB7, 0x1E, 0x65, 0xB4, 0x66, 0xF1, 0x4D,
+    0xC1, 0x2F, 0x53, 0xA4, 0x87, 0x9B, 0xA4, 0x25, 0x6B, 0x89, 0x4D, 0xE1, 0xD7, 0x16, 0xE9, 0x84,
+    0xC7, 0xB8, 0x85, 0xA0, 0x76, 0x72, 0x57, 0x4E, 0x77, 0x50, 0x07, 0x12, 0x19, 0x04, 0xC5, 0x2F,
+    0x8C, 0x22, 0xE7, 0x1A, 0x5F, 0x2A, 0xB3, 0x27, 0x92, 0x77, 0xED, 0xBA, 0x98, 0x16, 0x6E, 0x4D,
+    0xA8, 0xC1, 0xBE, 0xB2, 0x99, 0x24, 0x35, 0xFB, 0x74, 0xD5, 0x74, 0x3A, 0x61, 0x14, 0x4D, 0x7B,
+    0x99, 0x09, 0x9E, 0xE8, 0x45, 0x82, 0x29, 0xFD, 0xFA, 0x70, 0xD1, 0x5C, 0xBC, 0x86, 0xB3, 0xEE,
+    0x5E, 0xD3, 0x1C, 0xE9, 0xA5, 0x04, 0x61, 0xCB, 0xCB, 0x34, 0xF7, 0x0B, 0x36, 0x09, 0xED, 0x94,
+    0xD5, 0x48, 0x03, 0xF6, 0x4B, 0x4B, 0x07, 0xCE, 0x8F, 0x5A, 0x93, 0x91, 0x4F, 0x93, 0xD1, 0xE9,
+    0xD6, 0x99, 0x6E, 0x7D, 0xE4, 0xA9, 0xD0, 0xE4, 0x6C, 0x00, 0x1E, 0x35, 0x05, 0x33, 0x22, 0x88,
+    0x0F, 0x37, 0x49, 0x1E, 0x4D, 0x46, 0x70, 0x91, 0x0C, 0xD8, 0xDB, 0x7C, 0x05, 0x74, 0x60, 0xB5,
+    0xB3, 0xAE, 0x1C, 0x6B, 0x57, 0x72, 0x67, 0x52, 0xB8, 0x6B, 0x85, 0x63, 0x29, 0x1A, 0xA3, 0xA9,
+    0x10, 0x35, 0x3B, 0x60, 0x5D, 0xC7, 0xA4, 0xA6, 0x97, 0xDB, 0x95, 0x2A, 0x4E, 0x74, 0xCD, 0x70,
+    0x6E, 0xE3, 0x06, 0x49, 0x9B, 0xDC, 0xE3, 0xD6, 0x51, 0x89, 0x2A, 0x96, 0xC8, 0x4D, 0x48, 0xE1,
+    0xC1, 0xBC, 0x2F, 0xD6, 0x7A, 0xF1, 0x29, 0xE0, 0xF5, 0xFA, 0x47, 0xB6, 0x51, 0x29, 0x4C, 0x49,
+    0x39, 0x33, 0x5F, 0x9A, 0x89, 0x00, 0x22, 0x8C, 0x93, 0x29, 0x9C, 0x9E, 0xA6, 0x13, 0x38, 0xDC,
+    0xEA, 0x98, 0x67, 0xE7, 0xBB, 0x92, 0xF9, 0x3D, 0xF7, 0x53, 0xAA, 0x8B, 0x53, 0x1B, 0x8D, 0xC3,
+    0x3F, 0xDD, 0x68, 0x40, 0xDE, 0xE7, 0xF4, 0x4A, 0xB4, 0xA0, 0xC4, 0x32, 0xF8, 0x21, 0xEC, 0x8A,
+    0xE2, 0xD3, 0xA3, 0x0D, 0xA2, 0xDD, 0x3F, 0x55, 0xF0, 0xDA, 0x90, 0xE0, 0x9D, 0xD2, 0x43, 0x57,
+    0x7E, 0x31, 0xFD, 0x85, 0x62, 0x4B, 0xCD, 0xC7, 0x22, 0xE5, 0xF5, 0x6D, 0xC8, 0xAE, 0xAD, 0x55,
+    0x71, 0x0B, 0xFC, 0x3E, 0xEC, 0x72, 0x66, 0xA8, 0x58, 0x26, 0xF4, 0x1F, 0xCE, 0x3B, 0xCF, 0xE3,
+    0x8F, 0x49, 0xB7, 0xA5, 0x1D, 0x5B, 0x7A, 0xDD, 0xBA, 0x44, 0x71, 0x62, 0x0B, 0x95, 0xD9, 0xEF,
+    0xFC, 0x0C, 0x1D, 0xB5, 0xDC, 0x3B, 0x38, 0xA9, 0x11, 0x9B, 0xCF, 0x85, 0x53, 0xB2, 0xA4, 0x61,
+    0xD4, 0xB5, 0x76, 0xED, 0x9C, 0xD7, 0x7E, 0x66, 0xBE, 0x16, 0x0D, 0xC2, 0x4D, 0x2A, 0x7D, 0x1B,
+    0xAA, 0x52, 0x53, 0x26, 0xC3, 0x44, 0x22, 0xA7, 0x99, 0xD0, 0x43, 0xF8, 0x13, 0xD5, 0xA6, 0x92,
+    0x58, 0xF9, 0xC2, 0x2C, 0x69, 0xD4, 0x53, 0xD8, 0x3D, 0xE7, 0xCB, 0x59, 0x18, 0xBA, 0x72, 0x74,
+    0xB5, 0x30, 0x07, 0xAC, 0xC2, 0x18, 0x53, 0x19, 0xDD, 0x93, 0xFF, 0x99, 0x78, 0x3A, 0x11, 0x16,
+    0xC1, 0x3F, 0xA6, 0x8A, 0x50, 0x4A, 0x36, 0xCE, 0xCB, 0x58, 0xBA, 0x90, 0x11, 0xAE, 0x96, 0x58,
+    0xC1, 0x5F, 0xC7, 0x4F, 0xD5, 0x55, 0xBB, 0x6E, 0xD4, 0x40, 0x14, 0x3D, 0xB6, 0x59, 0xB9, 0x70,
+    0x31, 0x14, 0xA4, 0xA1, 0x31, 0x1F, 0x80, 0xE4, 0x1F, 0x40, 0xB1, 0x45, 0x24, 0x6A, 0x90, 0x62,
+    0x51, 0xA4, 0xA0, 0xA5, 0xCB, 0x1F, 0xC4, 0xEE, 0x28, 0x28, 0x68, 0xE0, 0x1F, 0x80, 0x86, 0x0F,
+    0xE0, 0x31, 0x96, 0x52, 0x50, 0xA4, 0xC8, 0x52, 0xA4, 0xA2, 0xC8, 0x4A, 0x28, 0x05, 0x55, 0x46,
+    0x64, 0x11, 0x46, 0xB1, 0x7D, 0x39, 0x77, 0xEC, 0x45, 0x04, 0x04, 0x45, 0x8A, 0x28, 0x8C, 0x94,
+    0xD9, 0x9B, 0xD9, 0xFB, 0x38, 0xF7, 0x9C, 0x3B, 0xB3, 0x40, 0xF8, 0x1C, 0x80, 0xAD, 0x01, 0xB3,
+    0x00, 0xA2, 0x96, 0xFF, 0xEC, 0xF0, 0xCF, 0xF0, 0x00, 0x77, 0xF1, 0x73, 0x45, 0x4B, 0xA0, 0xCA,
+    0x0B, 0xC4, 0x27, 0xE7, 0x31, 0x12, 0x35, 0x24, 0x6F, 0x90, 0x7E, 0xE9, 0x11, 0x8B, 0xE9, 0xB7,
+    0x4E, 0x5D, 0x25, 0x43, 0x0E, 0x2B, 0x1B, 0x0E, 0x6B, 0xCC, 0x1F, 0xBC, 0xE0, 0x96, 0x3B, 0x16,
+    0x96, 0x06, 0x61, 0x37, 0x10, 0x45, 0xD8, 0x22, 0xAD, 0x93, 0x05, 0x0A, 0xCC, 0x2E, 0x0C, 0xC6,
+    0x35, 0x5C, 0x45, 0xBC, 0x48, 0x6B, 0xD8, 0xB0, 0x1B, 0x8D, 0x2B, 0x3C, 0x39, 0xB3, 0xCE, 0x5D,
+    0xDD, 0x1B, 0x96, 0x86, 0x39, 0xE9, 0x10, 0x48, 0x36, 0x47, 0xE5, 0xE4, 0xC0, 0xDA, 0x58, 0xE4,
+    0x93, 0x4B, 0x64, 0x99, 0x23, 0xF0, 0x84, 0x7B, 0x41, 0x92, 0x25, 0x46, 0x45, 0x90, 0xD7, 0x93,
+    0x24, 0x50, 0x6D, 0x7E, 0xD5, 0x84, 0xD9, 0xE8, 0xDD, 0x55, 0x2A, 0x1B, 0xBD, 0x62, 0x97, 0x35,
+    0x48, 0x9C, 0x99, 0xC3, 0xCC, 0x49, 0x5B, 0xDA, 0xC4, 0x8E, 0xC1, 0x64, 0x2C, 0x2F, 0xD8, 0x0C,
+    0x5D, 0x3B, 0x90, 0xD6, 0x77, 0xFC, 0x40, 0x45, 0x6E, 0x91, 0x6F, 0xB0, 0x46, 0xF6, 0x48, 0x39,
+    0xDF, 0x63, 0xA1, 0xE4, 0xB0, 0x01, 0xE2, 0x63, 0x6E, 0x91, 0x14, 0x14, 0x44, 0xB4, 0xC0, 0xA0,
+    0x5B, 0xAF, 0xFA, 0x74, 0x98, 0xA6, 0x83, 0x59, 0x27, 0x64, 0x2C, 0x87, 0xD7, 0xEA, 0x6B, 0xD5,
+    0xA3, 0xD2, 0xA3, 0x87, 0xFA, 0xDD, 0x7C, 0x8A, 0xF9, 0xAB, 0x51, 0xC2, 0x7C, 0x90, 0x01, 0xBD,
+    0x95, 0xCE, 0xC8, 0x01, 0x59, 0x20, 0x15, 0x4F, 0x5A, 0xB6, 0xC2, 0x9A, 0xE6, 0x90, 0xF9, 0x07,
+    0xD6, 0x4D, 0x84, 0x09, 0x2B, 0x46, 0xC5, 0xFC, 0x1A, 0xD5, 0xA0, 0x06, 0x4F, 0xAC, 0xFA, 0x1C,
+    0xD3, 0xA7, 0x97, 0x1A, 0xD9, 0x7E, 0x8F, 0xA4, 0x95, 0x61, 0x4B, 0xCC, 0x47, 0x91, 0xA6, 0x4F,
+    0x65, 0x61, 0xE6, 0xB3, 0xE2, 0xDF, 0xD5, 0x27, 0x83, 0x5A, 0x93, 0xCB, 0x9D, 0x80, 0x3D, 0xA9,
+    0xD8, 0xA3, 0xF5, 0x87, 0xDA, 0x97, 0x90, 0x63, 0xCC, 0xCA, 0xB2, 0x50, 0x7E, 0x94, 0x97, 0x71,
+    0x0F, 0xFC, 0xC9, 0x99, 0x95, 0x78, 0x57, 0xA3, 0x89, 0x90, 0x2E, 0xFD, 0xE0, 0x6A, 0x7A, 0xAC,
+    0xFB, 0xFD, 0xAD, 0x1F, 0xA8, 0x2E, 0xF7, 0x55, 0x39, 0x92, 0xBC, 0x58, 0xA9, 0xA2, 0x72, 0xA6,
+    0xD1, 0x50, 0x0D, 0x36, 0x73, 0x45, 0x91, 0x36, 0x7A, 0xE5, 0xB2, 0xDA, 0x37, 0xE3, 0x11, 0xDA,
+    0xB2, 0x24, 0x14, 0xE1, 0x22, 0x7E, 0xDD, 0xC3, 0xE1, 0xE5, 0x4B, 0xAB, 0x1C, 0x8C, 0x74, 0x30,
+    0x50, 0x91, 0x27, 0x4E, 0x13, 0x7A, 0xBE, 0x94, 0xBA, 0x62, 0x62, 0x91, 0x9D, 0x0E, 0x63, 0xD3,
+    0x65, 0xB9, 0x89, 0x9C, 0xE1, 0x86, 0xC2, 0x11, 0xFF, 0x34, 0xD7, 0x6B, 0xBC, 0x27, 0x22, 0x05,
+    0x0F, 0xDB, 0xF0, 0xFB, 0x1D, 0xC1, 0x0D, 0x4F, 0x83, 0xEA, 0x03, 0x8D, 0x36, 0x3E, 0x67, 0xF0,
+    0x4A, 0x3A, 0x7A, 0x49, 0x32, 0x3C, 0x4B, 0xF7, 0x5A, 0x5E, 0xAC, 0x96, 0xC8, 0x08, 0xAA, 0xA2,
+    0x4B, 0xB6, 0x3F, 0xF7, 0x17, 0x2C, 0xED, 0xEC, 0x41, 0x65, 0x99, 0xE7, 0x71, 0x63, 0xE5, 0xB6,
+    0xC3, 0xA6, 0x72, 0x82, 0x40, 0x91, 0xD5, 0x11, 0xF7, 0xF8, 0x68, 0x9B, 0xB9, 0x42, 0x51, 0x6E,
+    0x47, 0x72, 0x11, 0xFC, 0x2E, 0xFD, 0xE5, 0x27, 0x71, 0x81, 0x9B, 0xB8, 0x05, 0x83, 0xE4, 0x68,
+    0xBB, 0x66, 0x3A, 0xCE, 0x26, 0x6F, 0x05, 0xA7, 0x78, 0x5C, 0x01, 0x9B, 0xAE, 0x64, 0xA9, 0x75,
+    0xEA, 0xEC, 0xE9, 0xB6, 0x0B, 0xC7, 0x61, 0xCB, 0x9A, 0x69, 0xC2, 0x46, 0x56, 0xAF, 0x33, 0xAE,
+    0x12, 0x71, 0xF6, 0xF3, 0xBD, 0x8E, 0xBF, 0x03, 0x15, 0xC7, 0x3C, 0x25, 0x89, 0xF1, 0x37, 0xC7,
+    0x6A, 0xBD, 0x7F, 0x30, 0x03, 0xD9, 0xEB, 0xEF, 0x9F, 0x3A, 0x8A, 0xF2, 0x86, 0x0F, 0x55, 0x86,
+    0x59, 0xF1, 0x5F, 0xB0, 0xA3, 0xCB, 0xE3, 0x8A, 0x3C, 0xD2, 0xA4, 0xC1, 0xEA, 0x97, 0x0D, 0xC6,
+    0x77, 0x60, 0xC6, 0x13, 0x7F, 0x0D, 0x23, 0x59, 0xA9, 0x5E, 0xC2, 0xCF, 0x60, 0x24, 0x7C, 0xA3,
+    0x94, 0x36, 0xD4, 0xFE, 0x11, 0xF6, 0x43, 0xA8, 0x15, 0x31, 0x1A, 0x3A, 0x85, 0x0A, 0xAF, 0x51,
+    0xE2, 0x32, 0x3E, 0x06, 0xBB, 0xED, 0xD8, 0x69, 0xFA, 0x5E, 0x99, 0xA3, 0x91, 0xEF, 0xEA, 0x1C,
+    0x66, 0x5F, 0x1F, 0x1C, 0x37, 0x4A, 0x5D, 0x28, 0x3D, 0x21, 0x6C, 0xFA, 0x77, 0x7C, 0x7D, 0x85,
+    0xA7, 0x5D, 0x81, 0xE9, 0x56, 0x48, 0x72, 0x87, 0x8B, 0x5B, 0x3F, 0x00, 0xCD, 0x55, 0xBD, 0x6E,
+    0xD4, 0x40, 0x10, 0x9E, 0xB5, 0x75, 0x58, 0x8A, 0x0B, 0xA7, 0x20, 0x0D, 0x29, 0xF6, 0x11, 0xFC,
+    0x08, 0x67, 0x41, 0x41, 0xC9, 0x15, 0x09, 0x0D, 0x4F, 0x80, 0x90, 0xB8, 0x47, 0x58, 0x3F, 0xC2,
+    0x35, 0xF4, 0x14, 0x29, 0xA2, 0xA4, 0xA0, 0xA5, 0x40, 0xEC, 0x41, 0x93, 0x82, 0x02, 0x23, 0x5E,
+    0xC0, 0x05, 0x11, 0x4A, 0x15, 0x07, 0x5D, 0x71, 0x01, 0x7B, 0x87, 0xF9, 0xE6, 0x6C, 0xE7, 0x47,
+    0xB4, 0x41, 0x71, 0xA4, 0x91, 0xBD, 0x3B, 0x33, 0xDF, 0xB7, 0xDF, 0x7E, 0x73, 0x21, 0xA2, 0x47,
+    0x6F, 0x89, 0x28, 0x6B, 0x24, 0x24, 0x2B, 0x09, 0xF1, 0x18, 0x0C, 0x02, 0x6D, 0xD3, 0x8D, 0x67,
+    0x97, 0x2F, 0x89, 0x3C, 0xF3, 0x8A, 0x98, 0xB9, 0x35, 0x5C, 0xD1, 0x6B, 0xE2, 0x52, 0x36, 0x3C,
+    0xC2, 0x14, 0x21, 0x5F, 0xA2, 0x61, 0x3D, 0x34, 0x34, 0x2D, 0xEA, 0x3C, 0x0D, 0x3B, 0x29, 0xA0,
+    0xA2, 0x5B, 0x8B, 0x9A, 0x49, 0x01, 0x61, 0xAA, 0x49, 0xFA, 0xCD, 0x08, 0x16, 0xAF, 0x91, 0x60,
+    0x4C, 0x28, 0xE7, 0x23, 0x2E, 0x22, 0x01, 0xAE, 0x28, 0x65, 0x16, 0x84, 0xC9, 0x1E, 0x32, 0xB6,
+    0xE4, 0x04, 0xAE, 0xA4, 0x78, 0xAD, 0xCD, 0x80, 0x97, 0x09, 0x8F, 0x87, 0x1B, 0xC2, 0x66, 0x9F,
+    0x8C, 0x14, 0xE4, 0xCC, 0x8F, 0xF9, 0xCD, 0x07, 0x5B, 0x6B, 0x57, 0xC0, 0x01, 0x57, 0x00, 0x51,
+    0x95, 0x55, 0x02, 0x5B, 0x8C, 0x9F, 0x60, 0x68, 0xAB, 0x0D, 0x13, 0xB7, 0xA4, 0xC2, 0x9F, 0xBD,
+    0x2B, 0x3C, 0x77, 0x34, 0x17, 0x48, 0x33, 0xEB, 0x01, 0x29, 0x01, 0xDB, 0x18, 0x2C, 0xE2, 0xCB,
+    0x0E, 0x92, 0x49, 0x97, 0x68, 0x45, 0xF2, 0x3A, 0x13, 0xAA, 0xF7, 0x5C, 0xB3, 0xE8, 0x40, 0x8A,
+    0x1A, 0x49, 0x69, 0x28, 0xFF, 0x52, 0x9B, 0x36, 0xAD, 0x6D, 0x99, 0xD4, 0xDB, 0x64, 0x8A, 0xBB,
+    0xD2, 0xCC, 0x94, 0x37, 0xCF, 0x65, 0x97, 0xC3, 0xE2, 0xED, 0x67, 0xCE, 0x3F, 0x48, 0x09, 0xC7,
+    0x12, 0x9A, 0x84, 0x0B, 0xF3, 0x3E, 0xC6, 0x29, 0xA3, 0x30, 0x9E, 0x57, 0x3B, 0xA8, 0x70, 0xC0,
+    0xA4, 0xE4, 0x5F, 0xF2, 0xDC, 0xD6, 0x4C, 0x33, 0x41, 0xB5, 0xD7, 0x28, 0xD7, 0x6F, 0xDD, 0x77,
+    0x78, 0x4D, 0x03, 0x3C, 0xE3, 0xC3, 0x71, 0x07, 0xA1, 0xB8, 0x10, 0xE5, 0x70, 0x49, 0x3B, 0x42,
+    0xDE, 0x2C, 0xFA, 0xF3, 0xCA, 0xB7, 0xDC, 0x2F, 0x2D, 0xAE, 0xC8, 0xEE, 0x17, 0xE4, 0x78, 0x25,
+    0x05, 0x95, 0x3F, 0x9D, 0x27, 0x6B, 0x15, 0xC0, 0x74, 0x1B, 0x74, 0xA4, 0x87, 0xCD, 0x30, 0x0D,
+    0xD5, 0x61, 0x43, 0x09, 0x5A, 0x62, 0xE4, 0x6C, 0x43, 0xDB, 0xF9, 0xEF, 0x57, 0x50, 0xBA, 0xD8,
+    0x65, 0xA9, 0x96, 0xBB, 0xD9, 0x2A, 0xE8, 0x80, 0xCC, 0x1A, 0x52, 0xD9, 0xCF, 0x2D, 0x8E, 0x0D,
+    0x8E, 0x39, 0x42, 0x0C, 0x70, 0xDA, 0xB9, 0xEF, 0x13, 0xF9, 0xA0, 0xA4, 0xC3, 0xAC, 0xC2, 0x5F,
+    0x47, 0xD9, 0x79, 0x45, 0x56, 0xBA, 0xE4, 0xCD, 0x48, 0xFC, 0x0E, 0xDC, 0x75, 0x48, 0x5B, 0x72,
+    0xCE, 0x96, 0x70, 0x86, 0x0E, 0xCE, 0x32, 0x01, 0x52, 0x41, 0x8C, 0xC1, 0x37, 0x6A, 0xC2, 0xAB,
+    0x47, 0x18, 0x9C, 0x09, 0xAA, 0x32, 0xB7, 0x0C, 0xF5, 0x1C, 0x4D, 0xFC, 0x0A, 0xD2, 0xE4, 0xAB,
+    0x44, 0xAF, 0x06, 0x7D, 0x6C, 0xED, 0x20, 0xC8, 0x27, 0x34, 0x76, 0x4F, 0xA1, 0x53, 0xC0, 0x72,
+    0xD4, 0x62, 0x39, 0xBD, 0xC0, 0xB2, 0x3D, 0xC1, 0xB2, 0xBB, 0xBD, 0x9C, 0x9F, 0x8C, 0xD9, 0xC9,
+    0x0A, 0xCB, 0x53, 0x34, 0x31, 0x61, 0xEC, 0x1D, 0x71, 0xE1, 0xC8, 0x08, 0x24, 0xC3, 0x6D, 0x60,
+    0x52, 0x83, 0xC9, 0x81, 0xD2, 0x8B, 0x16, 0x2F, 0xD5, 0xD7, 0x1F, 0x35, 0xB6, 0x57, 0xF1, 0x02,
+    0xDA, 0x27, 0xBF, 0xF4, 0x2E, 0x2F, 0xCA, 0xDE, 0xFB, 0x93, 0x19, 0xA2, 0x67, 0x21, 0x28, 0x33,
+    0xF3, 0xB3, 0xA1, 0xAC, 0x7B, 0x8E, 0xC9, 0xAE, 0xC9, 0x35, 0x70, 0x80, 0x88, 0xEF, 0xD4, 0x70,
+    0x5E, 0x63, 0x50, 0x41, 0x83, 0xD6, 0x76, 0xD7, 0x62, 0x18, 0x62, 0xAA, 0x99, 0xE9, 0x50, 0x25,
+    0x1D, 0xEC, 0xD0, 0x2D, 0x0B, 0x2F, 0xFE, 0x28, 0xCA, 0x77, 0x41, 0x74, 0xFC, 0xA4, 0xE9, 0x95,
+    0x8D, 0x37, 0xCC, 0x55, 0x49, 0x9A, 0xAA, 0xAC, 0x59, 0x65, 0xE6, 0x9D, 0xBA, 0xDF, 0x57, 0x8A,
+    0xD0, 0xEA, 0x95, 0xBA, 0x12, 0x97, 0x9B, 0x36, 0xD8, 0x90, 0x49, 0xE9, 0xD4, 0xA4, 0xD8, 0x48,
+    0x1B, 0x6C, 0x44, 0xED, 0x71, 0x38, 0x2A, 0xC9, 0x49, 0x8F, 0x86, 0xEC, 0x57, 0xB1, 0xB4, 0x6C,
+    0x58, 0xDD, 0xD0, 0xFF, 0x4A, 0xFE, 0x5A, 0x85, 0xAD, 0x50, 0x91, 0x69, 0x2B, 0x99, 0xBD, 0x11,
+    0x23, 0xED, 0x60, 0x20, 0x80, 0x0B, 0x91, 0x4E, 0x59, 0x61, 0x32, 0x39, 0x2C, 0x7A, 0x71, 0xC7,
+    0x21, 0x70, 0xBD, 0xDF, 0x21, 0x7F, 0x69, 0xF4, 0x0E, 0x76, 0xF6, 0xFD, 0x6C, 0xF3, 0xFB, 0x64,
+    0x20, 0xAB, 0xE5, 0x6F, 0x2D, 0x4A, 0x1D, 0x4D, 0x2F, 0xE7, 0xE7, 0x4B, 0x55, 0x41, 0x34, 0x49,
+    0x5B, 0x38, 0x96, 0x31, 0x35, 0xD3, 0xA5, 0x4A, 0x26, 0x2A, 0x99, 0x16, 0x43, 0xE6, 0xE0, 0x58,
+    0xBB, 0x54, 0x35, 0x65, 0x31, 0x6A, 0xE1, 0x5E, 0x6F, 0x34, 0x53, 0xA5, 0x4C, 0xD7, 0x64, 0x5B,
+    0xE2, 0x53, 0xEF, 0x29, 0x63, 0x7E, 0xB6, 0xEC, 0x75, 0xDC, 0xA3, 0xFF, 0xFF, 0xFC, 0x05, 0xC5,
+    0x55, 0xB1, 0x6E, 0xD5, 0x30, 0x14, 0xBD, 0x4E, 0x80, 0x48, 0xBC, 0xC1, 0x4B, 0x2B, 0x06, 0x24,
+    0xF2, 0x09, 0x59, 0x59, 0x90, 0xB3, 0xB1, 0x76, 0x68, 0xC4, 0xC0, 0xC0, 0x07, 0x30, 0xB0, 0x30,
+    0x22, 0xE5, 0x75, 0x62, 0x2C, 0x13, 0xDF, 0x50, 0x65, 0x81, 0x2F, 0xA8, 0xB3, 0x77, 0x20, 0x0C,
+    0x88, 0x35, 0x52, 0x41, 0x0C, 0x2C, 0x41, 0x3C, 0xC4, 0x4B, 0x9B, 0xE4, 0x72, 0x8E, 0xF3, 0x8A,
+    0xDA, 0x0E, 0x30, 0xB5, 0x8D, 0x74, 0x5D, 0xDB, 0xBD, 0xB6, 0xCF, 0x39, 0xF7, 0xD8, 0xCF, 0x14,
+    0xC5, 0x4E, 0xAC, 0xDA, 0x31, 0x0C, 0xFA, 0xB2, 0xF9, 0x4A, 0xD5, 0x11, 0x31, 0x85, 0xE0, 0xF8,
+    0x5F, 0x51, 0x14, 0xBB, 0xC8, 0x1B, 0x42, 0xB0, 0xFF, 0xBF, 0xFC, 0x79, 0xFF, 0xE9, 0x2C, 0xC2,
+    0xB9, 0x4E, 0x55, 0x08, 0x42, 0xB6, 0x8B, 0x62, 0x83, 0x61, 0x3B, 0x67, 0x5E, 0x23, 0x99, 0x6A,
+    0xBE, 0x18, 0xEF, 0x8D, 0x66, 0x94, 0x45, 0xE7, 0x96, 0xE2, 0x5E, 0x77, 0x12, 0x0D, 0x5E, 0x24,
+    0x3D, 0x6A, 0xC5, 0x0C, 0x8A, 0xEF, 0x03, 0x62, 0xD0, 0xAA, 0xAA, 0xF6, 0x5B, 0x2C, 0x9C, 0x10,
+    0x8B, 0x8E, 0xA7, 0x60, 0x87, 0x78, 0x40, 0x27, 0xED, 0xC4, 0xE4, 0x65, 0xFF, 0x7C, 0x65, 0x90,
+    0x98, 0x47, 0xAA, 0x6F, 0x44, 0x70, 0x4C, 0xB2, 0x94, 0xF7, 0x71, 0x6D, 0xBA, 0xB8, 0x7F, 0xDA,
+    0x8A, 0x6A, 0x2D, 0x8E, 0x4B, 0x73, 0xB9, 0x09, 0x15, 0xE2, 0xA5, 0xBC, 0x94, 0x47, 0x62, 0xF3,
+    0xA8, 0x7F, 0xDA, 0x89, 0x55, 0xC0, 0xCE, 0x88, 0xE6, 0x96, 0x5C, 0x9B, 0x1C, 0x62, 0xF0, 0x37,
+    0x41, 0x66, 0xB2, 0x42, 0x62, 0x37, 0x8F, 0xCF, 0x7D, 0xD7, 0x29, 0x87, 0x08, 0xCF, 0x76, 0x44,
+    0xBC, 0xDE, 0x74, 0xE4, 0x02, 0x9A, 0xAB, 0x97, 0xE3, 0x7A, 0xE9, 0x46, 0xD4, 0xBD, 0x16, 0x18,
+    0x00, 0x85, 0x27, 0x63, 0x44, 0x86, 0x7E, 0x3A, 0x02, 0xEE, 0x18, 0x28, 0x9B, 0x5D, 0xA4, 0xE8,
+    0x28, 0x40, 0xB8, 0x12, 0xFF, 0xB1, 0x6C, 0xD2, 0x46, 0x3C, 0xE4, 0x89, 0xD7, 0xD8, 0x2E, 0x3B,
+    0x02, 0x8B, 0xE1, 0x10, 0x0B, 0x66, 0xBA, 0xE4, 0x7D, 0x52, 0x55, 0x07, 0xA4, 0x6B, 0xC9, 0x1B,
+    0x92, 0x84, 0xC2, 0x8A, 0xC3, 0x29, 0x46, 0x45, 0xB6, 0x12, 0x7D, 0xEB, 0xF3, 0x94, 0x9B, 0x65,
+    0x44, 0x70, 0xFB, 0xD9, 0x12, 0x82, 0x30, 0xF5, 0x15, 0xD7, 0x60, 0x20, 0x94, 0xDE, 0xD6, 0x5C,
+    0x0C, 0x74, 0xB1, 0x06, 0x14, 0x77, 0x97, 0x72, 0x90, 0x74, 0x49, 0x67, 0x86, 0xB4, 0x96, 0x12,
+    0xBB, 0x66, 0x40, 0x67, 0x91, 0x69, 0x76, 0x6E, 0xC4, 0x29, 0x77, 0x80, 0x07, 0xFE, 0x80, 0x43,
+    0x46, 0xDB, 0x48, 0x7C, 0x0A, 0x8A, 0x29, 0x49, 0xFB, 0xFA, 0x1C, 0xA4, 0xAB, 0x94, 0xAE, 0x87,
+    0x74, 0x3C, 0x27, 0x3A, 0xE0, 0x49, 0x29, 0x35, 0x13, 0x65, 0xB6, 0xFD, 0xCC, 0x76, 0xE4, 0x4D,
+    0xB2, 0x0D, 0xDB, 0x2D, 0xF8, 0xEC, 0xC2, 0x8D, 0x32, 0x5E, 0xBF, 0x04, 0x36, 0x2A, 0x0B, 0x34,
+    0x6B, 0xC1, 0x30, 0xA9, 0x2D, 0x4D, 0x29, 0x9E, 0x05, 0x08, 0xFE, 0x94, 0x8C, 0x25, 0x08, 0xC6,
+    0x9D, 0x61, 0x48, 0x1A, 0x26, 0x08, 0x0B, 0x5E, 0x97, 0xD9, 0xD0, 0xA0, 0xF6, 0xAE, 0xC6, 0x36,
+    0x13, 0x4B, 0xA2, 0x27, 0x9C, 0xB6, 0xDF, 0x02, 0xE8, 0xD9, 0xF6, 0xC4, 0x0E, 0xBA, 0x39, 0x39,
+    0x29, 0x5A, 0xB7, 0xC7, 0x76, 0x8A, 0x74, 0x89, 0xE9, 0x48, 0x4F, 0x2A, 0x6D, 0xE9, 0x7F, 0x0C,
+    0x5F, 0x28, 0x51, 0x99, 0xE2, 0x8C, 0x53, 0x89, 0xF5, 0x16, 0xC9, 0xF1, 0x2F, 0x54, 0x7A, 0xC4,
+    0x03, 0xE1, 0x60, 0x0A, 0x30, 0xD9, 0x9A, 0x49, 0x90, 0xFC, 0x42, 0x57, 0x0E, 0xCF, 0xF7, 0x71,
+    0xA7, 0x9F, 0x4A, 0x9F, 0xB6, 0x52, 0xFE, 0x5C, 0x03, 0x10, 0xB4, 0xB5, 0xA7, 0xE0, 0xED, 0x27,
+    0x66, 0x60, 0x97, 0x72, 0x64, 0x19, 0x1A, 0x74, 0x26, 0x76, 0x38, 0x03, 0xB4, 0x8B, 0xDF, 0xC8,
+    0x51, 0xDC, 0xDD, 0xF4, 0xC7, 0x84, 0x59, 0x3B, 0x3E, 0xD1, 0xCE, 0xD1, 0x38, 0xA5, 0x3E, 0xC6,
+    0x0F, 0x42, 0xA8, 0x38, 0x9F, 0x25, 0x39, 0x24, 0xA7, 0x86, 0x9C, 0x1F, 0xE4, 0xE2, 0xF7, 0xF4,
+    0x54, 0xBB, 0x94, 0xAA, 0xDD, 0x57, 0xDA, 0xAF, 0x91, 0x87, 0xBC, 0x42, 0xBC, 0x48, 0xF6, 0xAB,
+    0xE7, 0xD5, 0xE1, 0x34, 0x5A, 0x6A, 0x7E, 0x49, 0x78, 0x01, 0xC9, 0x9E, 0xFF, 0xC3, 0xAB, 0x0F,
+    0xE1, 0x60, 0x7F, 0xD7, 0x0B, 0x7E, 0x08, 0x82, 0xC5, 0xB3, 0x36, 0x94, 0x50, 0xCE, 0x1E, 0x0A,
+    0x71, 0x2C, 0x85, 0x09, 0x97, 0x30, 0xE0, 0xD8, 0x14, 0xE4, 0xAF, 0xFE, 0x5E, 0xBF, 0x5F, 0xD4,
+    0x5F, 0xE2, 0x9E, 0xD9, 0xF6, 0x38, 0xBC, 0x5D, 0xFB, 0x5C, 0x33, 0xC1, 0x71, 0x10, 0xDA, 0x35,
+    0xD4, 0xBF, 0x6C, 0xB8, 0xA9, 0x6F, 0x59, 0x54, 0x3F, 0x55, 0x7E, 0x1D, 0x3C, 0xD0, 0x82, 0x08,
+    0x51, 0x49, 0x71, 0x19, 0xEC, 0x95, 0x7D, 0x7F, 0x00, 0xCD, 0x94, 0x31, 0x6F, 0xD3, 0x50, 0x10,
+    0xC7, 0xEF, 0xD9, 0x2A, 0x96, 0xF0, 0xE0, 0xA5, 0x1D, 0xA0, 0x12, 0x5E, 0x98, 0x18, 0xC8, 0xCA,
+    0x80, 0x70, 0x24, 0x86, 0x0E, 0x2C, 0x19, 0x6A, 0x18, 0x58, 0xFA, 0x0D, 0xB2, 0xB2, 0x39, 0xE5,
+    0x0B, 0x90, 0x85, 0x9D, 0x39, 0x0B, 0x5F, 0x00, 0xE1, 0xC0, 0xD2, 0x35, 0x0B, 0x33, 0x91, 0x5A,
+    0xD4, 0x81, 0x01, 0x23, 0x2C, 0x70, 0x5B, 0xDB, 0xC7, 0xFF, 0x7F, 0x31, 0x6D, 0x0A, 0x45, 0x55,
+    0xC9, 0xC2, 0x53, 0x72, 0x7E, 0x3E, 0xBF, 0xBB, 0x77, 0xF7, 0xBB, 0x7B, 0xCF, 0x9B, 0xC9, 0x3D,
+    0xB9, 0x2B, 0xE1, 0x48, 0xDA, 0xA7, 0xA5, 0x84, 0xDA, 0x8A, 0xC4, 0xDA, 0x17, 0x59, 0x93, 0x6E,
+    0xA4, 0xF8, 0xE7, 0xFA, 0xB0, 0x48, 0xB4, 0x4D, 0xA2, 0xE6, 0xC9, 0xC9, 0xD7, 0x56, 0x02, 0x4D,
+    0x46, 0xD2, 0xFB, 0x51, 0x88, 0x68, 0x2E, 0xB0, 0x99, 0x63, 0x05, 0xEC, 0x02, 0x9D, 0x89, 0x64,
+    0x0D, 0x27, 0xD0, 0x64, 0xD4, 0x9C, 0x60, 0x4D, 0x9E, 0x89, 0x44, 0xDF, 0x2A, 0x71, 0x1A, 0xCF,
+    0x25, 0x2B, 0xF4, 0x43, 0xA6, 0xBE, 0xEA, 0x61, 0x11, 0x68, 0x99, 0x89, 0x1B, 0x04, 0x58, 0x22,
+    0x58, 0x22, 0x21, 0x8C, 0x04, 0xD6, 0xD2, 0x7B, 0x77, 0x20, 0x61, 0x15, 0x6B, 0xAE, 0x4E, 0x55,
+    0x47, 0x2E, 0xD7, 0x11, 0x03, 0xD9, 0xA1, 0x08, 0xB9, 0x5A, 0x7A, 0x53, 0xE9, 0x8C, 0x3A, 0xF5,
+    0x1F, 0x63, 0xA8, 0x47, 0x4C, 0x44, 0x75, 0xEA, 0x41, 0xB4, 0x92, 0x1C, 0x89, 0x2B, 0x7C, 0x35,
+    0x63, 0xEE, 0x23, 0x7A, 0xE6, 0x2D, 0xA1, 0x7B, 0xC7, 0x9D, 0x25, 0x58, 0x72, 0x9F, 0x53, 0x78,
+    0x35, 0xB3, 0xFF, 0x5C, 0x08, 0xDC, 0xBC, 0x9E, 0x92, 0x0F, 0xD5, 0xFE, 0x11, 0x57, 0x47, 0xFB,
+    0x15, 0xAD, 0x5F, 0xD0, 0xA6, 0x8D, 0x91, 0xBB, 0x5F, 0x25, 0x90, 0xD1, 0x3C, 0x9B, 0xD1, 0x69,
+    0x8E, 0x7D, 0x5A, 0x80, 0x99, 0xE4, 0x95, 0x64, 0x08, 0x62, 0x2E, 0x9B, 0xCA, 0xA8, 0x24, 0x05,
+    0x5E, 0x79, 0xD5, 0xED, 0xE3, 0xD7, 0xBF, 0x36, 0x3C, 0x97, 0xC8, 0x7F, 0x43, 0x9D, 0x03, 0xF3,
+    0x03, 0xB1, 0x1C, 0xB0, 0xAD, 0x6A, 0x25, 0x78, 0x0D, 0xA6, 0x51, 0x6D, 0x94, 0xB8, 0xCA, 0x92,
+    0xE8, 0xB0, 0xB5, 0xC6, 0xB1, 0xA4, 0x8C, 0xCF, 0x73, 0x34, 0xDE, 0xCB, 0x1C, 0x7B, 0x7A, 0x4C,
+    0x75, 0x74, 0x58, 0x1A, 0x47, 0x46, 0xD2, 0x26, 0x64, 0x52, 0x65, 0x7D, 0x72, 0x64, 0x1F, 0x26,
+    0xBB, 0x94, 0xAD, 0x87, 0x68, 0xFC, 0xCA, 0xD3, 0xE3, 0x89, 0xCE, 0x19, 0x1F, 0x5E, 0x87, 0xCA,
+    0xA8, 0x5C, 0x7A, 0x06, 0xED, 0xFA, 0xD8, 0xCA, 0x69, 0x73, 0xDB, 0x2F, 0x98, 0x51, 0x3E, 0x30,
+    0x85, 0x55, 0xD6, 0xD9, 0xF4, 0x06, 0x43, 0xE6, 0xA7, 0x37, 0xDC, 0x1D, 0x09, 0x78, 0x65, 0x67,
+    0xE7, 0x06, 0x9D, 0xAB, 0xB5, 0x01, 0x11, 0x97, 0x09, 0x98, 0xED, 0x13, 0x5E, 0x4E, 0x8A, 0xC0,
+    0xE9, 0x29, 0xB9, 0x1A, 0xE0, 0xB6, 0x2B, 0xC2, 0x82, 0xFD, 0xAC, 0x63, 0x6F, 0x1A, 0xD6, 0xC7,
+    0x0A, 0x85, 0x8A, 0xC5, 0x56, 0x3A, 0xD4, 0x50, 0x59, 0xCC, 0x0C, 0x18, 0xB7, 0x0A, 0xD9, 0x30,
+    0xF6, 0x56, 0x84, 0xB7, 0x8C, 0x61, 0x46, 0x42, 0xB7, 0xFA, 0x92, 0xEF, 0xEA, 0x89, 0x16, 0x31,
+    0x19, 0x6F, 0x2A, 0xBB, 0xEB, 0x0E, 0xF1, 0x86, 0xAC, 0x8F, 0x53, 0x2B, 0xD9, 0x10, 0x7C, 0xA2,
+    0x29, 0xAC, 0xFD, 0xC2, 0x21, 0xC7, 0x75, 0x71, 0xFD, 0xA5, 0xB6, 0x31, 0x8F, 0x35, 0x7D, 0xC7,
+    0x7B, 0x98, 0xBA, 0xAB, 0x4D, 0xD3, 0x34, 0x1D, 0xEE, 0x11, 0x6E, 0xCD, 0x5A, 0xEB, 0xDE, 0xF1,
+    0x64, 0x32, 0xF9, 0x67, 0x67, 0x67, 0xD3, 0x45, 0x12, 0x1E, 0xEB, 0x88, 0x23, 0xC9, 0x54, 0x6A,
+    0xF6, 0x84, 0x65, 0x81, 0x3A, 0x41, 0x22, 0x87, 0xF5, 0xD3, 0x1C, 0x6E, 0x9A, 0xB4, 0xE3, 0xE8,
+    0x5B, 0x1B, 0x45, 0x56, 0xC5, 0xA4, 0xFF, 0x17, 0xF5, 0x06, 0x3E, 0x34, 0xB1, 0x96, 0xE2, 0x7F,
+    0x57, 0xC8, 0xE8, 0xCB, 0xA7, 0x61, 0x21, 0x49, 0x29, 0xA8, 0x18, 0xBA, 0xA4, 0x37, 0x65, 0x73,
+    0x66, 0x12, 0x15, 0xDC, 0x0B, 0xF5, 0xF0, 0x0B, 0xB6, 0x68, 0x34, 0xA5, 0x93, 0xC4, 0x9C, 0xD4,
+    0xF4, 0x0D, 0x75, 0x73, 0x15, 0x35, 0xE1, 0x43, 0x63, 0x8F, 0xEC, 0xB7, 0xC7, 0xE3, 0x06, 0x24,
+    0xB3, 0x6D, 0x3D, 0x37, 0x4C, 0x99, 0xA7, 0x17, 0x1A, 0x38, 0xFB, 0x26, 0xD6, 0xD8, 0x7A, 0xFA,
+    0x68, 0x81, 0x3F, 0xBF, 0x78, 0x87, 0x55, 0x1F, 0xAF, 0x4E, 0x59, 0x1A, 0xD6, 0x68, 0x6E, 0xD7,
+    0x0D, 0xE8, 0xF5, 0x54, 0x1B, 0x71, 0xD9, 0xCB, 0xB4, 0xE3, 0xBB, 0x40, 0xDD, 0xB8, 0x49, 0x5F,
+    0x92, 0x47, 0xB8, 0x47, 0xA3, 0x8F, 0xB8, 0xC8, 0x7C, 0x3D, 0x08, 0x1A, 0xD1, 0x29, 0x70, 0xE2,
+    0xC2, 0x0B, 0x0B, 0x63, 0xEB, 0x57, 0xE4, 0x61, 0x68, 0x8D, 0xB2, 0xB1, 0x5A, 0x60, 0x33, 0x82,
+    0x46, 0xED, 0x32, 0xA5, 0x1B, 0xCB, 0x4E, 0x52, 0xF9, 0xEF, 0x71, 0x50, 0xA2, 0x2D, 0x2D, 0x9F,
+    0x39, 0xED, 0x2F, 0xB5, 0x77, 0x00, 0x2A, 0x3D, 0xAD, 0x71, 0x34, 0xC6, 0xD6, 0xE9, 0xBC, 0x5F,
+    0x32, 0xEB, 0xB0, 0x95, 0x5F, 0x87, 0x07, 0x68, 0xCD, 0x1A, 0x0C, 0x30, 0xDF, 0x96, 0xDB, 0x71,
+    0xE3, 0xCD, 0xB5, 0x1D, 0x86, 0xCF, 0xB5, 0xBA, 0x8F, 0x2B, 0x6E, 0xB0, 0x74, 0xC4, 0x18, 0x2D,
+    0xA1, 0x35, 0x0B, 0x38, 0x2B, 0xBC, 0x6E, 0xA4, 0x69, 0xA2, 0x8A, 0x1F, 0x26, 0x0B, 0xDF, 0x08,
+    0x01, 0xF9, 0x5D, 0xC3, 0xBD, 0x96, 0xC9, 0x2A, 0x3F, 0x97, 0x8F, 0x17, 0xAE, 0xE4, 0xD2, 0xF1,
+    0x13, 0xBD, 0x54, 0x3D, 0x8F, 0xD4, 0x30, 0x10, 0x1D, 0xC7, 0x70, 0x11, 0x97, 0xC2, 0x34, 0x34,
+    0xD7, 0x6C, 0x8F, 0x90, 0xF2, 0x07, 0xE0, 0x6C, 0x2A, 0xCA, 0xA3, 0xB8, 0xAD, 0xAE, 0x80, 0x82,
+    0x82, 0xEE, 0x1A, 0x5A, 0x14, 0x4B, 0x57, 0x52, 0x70, 0x3F, 0x81, 0x82, 0xEA, 0x7E, 0xC3, 0x49,
+    0x31, 0xDA, 0x92, 0x26, 0x88, 0x82, 0x36, 0xD4, 0x14, 0x17, 0xA1, 0x08, 0x65, 0xA5, 0xC4, 0xC3,
+    0x9B, 0xEC, 0xC7, 0x6D, 0x01, 0x48, 0x2C, 0x7B, 0x78, 0x63, 0xEF, 0x7A, 0xD6, 0xF6, 0x7B, 0xF3,
+    0xE6, 0x39, 0xD3, 0xE9, 0x31, 0xF3, 0x80, 0xE7, 0xDE, 0xF4, 0x98, 0x16, 0x6D, 0xD8, 0xFE, 0x79,
+    0x45, 0xD9, 0x84, 0xD2, 0xD9, 0xFC, 0xA4, 0x2E, 0xB8, 0x49, 0xB9, 0x26, 0xB5, 0x3C, 0x93, 0x26,
+    0xDC, 0x67, 0xCC, 0x74, 0x1A, 0x9D, 0xEA, 0x89, 0x0A, 0x04, 0x02, 0xA5, 0x0D, 0x6D, 0x39, 0x51,
+    0xE5, 0x79, 0xCA, 0x9C, 0x30, 0x87, 0x07, 0x94, 0x1E, 0x39, 0xFD, 0x69, 0x7E, 0xD2, 0x58, 0x6E,
+    0x13, 0x6E, 0xAE, 0x11, 0xC9, 0x3A, 0x32, 0x15, 0xE9, 0x76, 0xE4, 0xB6, 0xC5, 0xA4, 0xE0, 0xEF,
+    0xCC, 0x1F, 0xCA, 0x39, 0x90, 0x01, 0x09, 0x60, 0xC0, 0xFF, 0xDD, 0xCF, 0xBD, 0xF8, 0x98, 0xF9,
+    0x23, 0xD2, 0xD6, 0x35, 0xE5, 0xA4, 0x1A, 0x32, 0x81, 0x0E, 0x89, 0x7A, 0x4A, 0x38, 0x24, 0x0C,
+    0x8A, 0x89, 0xB7, 0x9E, 0x75, 0x97, 0xB8, 0x91, 0xB0, 0xA9, 0xAC, 0x1B, 0x74, 0xFB, 0xA7, 0xAF,
+    0xCC, 0x5F, 0xA6, 0xC1, 0x52, 0xA7, 0x9B, 0x8C, 0x33, 0x88, 0x42, 0x2F, 0x04, 0x2C, 0xAF, 0x44,
+    0x9D, 0xE7, 0xEB, 0xCC, 0x77, 0xC8, 0x9C, 0x86, 0x5F, 0x34, 0x14, 0x37, 0xF9, 0x01, 0xF1, 0xCD,
+    0x57, 0x60, 0x58, 0x0F, 0xEC, 0x88, 0xBD, 0xBA, 0xC3, 0x6E, 0x53, 0x63, 0xFF, 0xEE, 0x43, 0x7B,
+    0xD1, 0xE9, 0xB9, 0x20, 0x7E, 0x03, 0x27, 0xEB, 0x91, 0x63, 0x44, 0x97, 0x3A, 0x09, 0x5F, 0x52,
+    0x20, 0x6A, 0x18, 0x33, 0xCB, 0x90, 0x12, 0xBE, 0x1B, 0xDB, 0x3E, 0xA9, 0xF3, 0x48, 0xE6, 0x73,
+    0x4F, 0xC5, 0x51, 0x4D, 0xFD, 0x1D, 0x4C, 0x89, 0x36, 0xEC, 0xA1, 0x9B, 0x81, 0xCC, 0xAC, 0x25,
+    0x8B, 0x92, 0xF7, 0xFF, 0x32, 0x05, 0x93, 0x86, 0xA4, 0xB8, 0x64, 0x49, 0xCA, 0x2B, 0x32, 0x92,
+    0x0D, 0x8A, 0x07, 0x92, 0x4B, 0x60, 0x60, 0xAC, 0xFD, 0x77, 0x28, 0x4B, 0x4D, 0x9A, 0x2B, 0xB2,
+    0xCF, 0x2A, 0xDD, 0x4E, 0x50, 0x45, 0x13, 0x9E, 0xD2, 0xED, 0x35, 0x9F, 0x09, 0xB2, 0x2A, 0x61,
+    0x09, 0x6C, 0xCF, 0xB0, 0x3D, 0x0F, 0x37, 0x36, 0xF5, 0xA3, 0xD5, 0x4D, 0x43, 0xCC, 0x5E, 0x73,
+    0x47, 0x59, 0x74, 0x4B, 0xC1, 0x40, 0xB2, 0xAC, 0x28, 0x63, 0x58, 0x20, 0x0F, 0x69, 0x93, 0x87,
+    0x43, 0xC8, 0xBB, 0x49, 0x12, 0xF7, 0x43, 0xF6, 0x8A, 0xF0, 0x48, 0x7C, 0xC7, 0x53, 0x10, 0x34,
+    0x90, 0xCB, 0xA2, 0x98, 0x65, 0x3D, 0x5E, 0x78, 0x35, 0xA0, 0xBA, 0x2A, 0x8A, 0x9C, 0xE2, 0x0A,
+    0x62, 0x09, 0xB2, 0x94, 0x9C, 0x45, 0xE3, 0x52, 0x2C, 0x5B, 0xCA, 0xCA, 0xD2, 0x21, 0x58, 0x38,
+    0x04, 0x31, 0xA8, 0xBE, 0x40, 0x8A, 0x85, 0xAD, 0xE5, 0xB5, 0x03, 0x88, 0x94, 0x4B, 0x9C, 0xC2,
+    0x4F, 0xC6, 0x97, 0x48, 0xE9, 0xB1, 0xD2, 0xB4, 0xB2, 0x9D, 0x65, 0xFB, 0xA4, 0x46, 0x30, 0x19,
+    0xE4, 0x4C, 0x8B, 0x94, 0x49, 0xF7, 0xE3, 0xCB, 0x46, 0x5C, 0x97, 0xB5, 0xE2, 0x2D, 0x16, 0x74,
+    0x88, 0xB5, 0xD1, 0x0E, 0xC4, 0x80, 0x99, 0xB8, 0x4C, 0x8F, 0xF1, 0x4E, 0x86, 0x4B, 0x19, 0x1E,
+    0xC9, 0x20, 0x72, 0xBD, 0x5C, 0x8A, 0x25, 0xA9, 0x8D, 0x36, 0x1D, 0x7E, 0x13, 0x28, 0xDE, 0xE2,
+    0xF2, 0x9E, 0xC1, 0x48, 0x7E, 0x40, 0xB7, 0xCE, 0x7A, 0x5C, 0xF5, 0xA0, 0x5B, 0x1B, 0x68, 0x40,
+    0xB7, 0xA7, 0x81, 0xCC, 0x55, 0x07, 0xE3, 0xB0, 0x27, 0x7E, 0x23, 0xEB, 0x18, 0x67, 0x98, 0x46,
+    0xB7, 0x2A, 0xE2, 0x8C, 0x1C, 0xEF, 0x05, 0xDD, 0xE3, 0x50, 0x0B, 0x33, 0xA6, 0x1D, 0x0E, 0x2D,
+    0xDD, 0x9A, 0xE7, 0x7D, 0xB7, 0x70, 0x65, 0x0A, 0xAA, 0x49, 0xB3, 0x24, 0xFA, 0x10, 0xFD, 0xD6,
+    0xAA, 0x9C, 0x1E, 0xF8, 0x10, 0xE0, 0xAC, 0x43, 0xF2, 0x11, 0x1D, 0x0C, 0x82, 0xA9, 0xF3, 0x4A,
+    0x77, 0x93, 0x8A, 0x22, 0xB4, 0xB1, 0xF8, 0xDB, 0x5C, 0xF5, 0x4B, 0xFC, 0x2F, 0xC0, 0xAF, 0x4A,
+    0x5C, 0x4C, 0xE0, 0x77, 0xC0, 0x8F, 0x82, 0xEF, 0x81, 0x8F, 0x85, 0xB3, 0x0E, 0xF8, 0x51, 0xF0,
+    0xD5, 0x05, 0x52, 0x94, 0x5B, 0xB0, 0x51, 0xE9, 0xD7, 0x40, 0xBB, 0xBB, 0x21, 0x61, 0x71, 0xD3,
+    0x9D, 0x39, 0xAE, 0x3A, 0x5D, 0xA0, 0x9E, 0x36, 0xE4, 0xC1, 0xE0, 0xA3, 0x44, 0x9E, 0x03, 0xF0,
+    0x42, 0x11, 0xA0, 0xB8, 0xDB, 0xEE, 0xC7, 0xFF, 0xE5, 0xBF, 0x6A, 0xEA, 0xFD, 0xC2, 0x3B, 0xE2,
+    0xBA, 0x14, 0xC2, 0x66, 0xA8, 0xAD, 0x71, 0xD7, 0xE5, 0xDC, 0xA2, 0xFD, 0x04, 0xCD, 0x94, 0xBF,
+    0x8E, 0xD3, 0x40, 0x10, 0xC6, 0xC7, 0x36, 0xC4, 0x22, 0x29, 0xF6, 0x0A, 0x2A, 0x1A, 0xD7, 0x34,
+    0xE4, 0x09, 0x60, 0x2D, 0xE5, 0x01, 0xA0, 0xB9, 0x9A, 0x16, 0x68, 0xAE, 0xA5, 0x38, 0x65, 0x2D,
+    0xF1, 0x00, 0xF0, 0x06, 0x50, 0xDE, 0x43, 0x20, 0xD9, 0x11, 0x0F, 0x10, 0x0B, 0x44, 0x6F, 0x41,
+    0x71, 0x65, 0x2C, 0x61, 0x29, 0x96, 0x6E, 0xD7, 0xCB, 0xF7, 0x6D, 0x2E, 0x77, 0x9C, 0x10, 0x17,
+    0x82, 0x0E, 0x84, 0xE3, 0xDD, 0xFC, 0x3C, 0xDE, 0x3F, 0xB3, 0xDF, 0xCC, 0xF8, 0x5E, 0xD2, 0xE9,
+    0xD9, 0xEF, 0xDD, 0xB9, 0x88, 0x9C, 0xA8, 0x45, 0x3F, 0x4D, 0xEA, 0xE3, 0x48, 0x8C, 0xC8, 0x1C,
+    0xCD, 0xA1, 0x59, 0xB4, 0xDE, 0x48, 0xD4, 0x1A, 0x89, 0x6B, 0xB0, 0xDC, 0x48, 0xF3, 0x7E, 0xD8,
+    0xB6, 0x67, 0xA3, 0xB7, 0xB5, 0x73, 0x6A, 0x59, 0xF7, 0x2E, 0x53, 0x1F, 0x1B, 0x77, 0x57, 0xD5,
+    0xE2, 0x64, 0xFF, 0x6E, 0x4F, 0x27, 0x46, 0xB9, 0x91, 0xAC, 0x32, 0x32, 0xAD, 0x36, 0xFF, 0xA3,
+    0xFD, 0x9C, 0x16, 0x9D, 0xAB, 0x3A, 0xE9, 0xB0, 0xEF, 0x4F, 0x30, 0xD6, 0x8F, 0x57, 0x9F, 0xCE,
+    0xBA, 0xC1, 0xDD, 0xF9, 0xF5, 0x18, 0x91, 0xC8, 0x62, 0xC9, 0xB4, 0x45, 0x97, 0x55, 0xE7, 0x1B,
+    0xEC, 0x30, 0xBD, 0x84, 0x49, 0xB5, 0x12, 0x0D, 0xBE, 0x90, 0xD4, 0x37, 0x30, 0x61, 0x99, 0xD8,
+    0x23, 0x72, 0x86, 0xA3, 0x3C, 0x46, 0x45, 0x4F, 0xAF, 0x5B, 0xCB, 0x7B, 0xDF, 0xA7, 0xE8, 0x9A,
+    0x0C, 0x5D, 0x21, 0x27, 0x08, 0xEE, 0xF5, 0xF7, 0x81, 0xB8, 0x4E, 0xBC, 0x15, 0xDF, 0x60, 0x1B,
+    0x65, 0x45, 0x5B, 0x79, 0x60, 0x77, 0xCD, 0x12, 0x79, 0x51, 0xA0, 0x53, 0xDC, 0x3B, 0x72, 0x7C,
+    0x0E, 0xC9, 0x85, 0x18, 0xE1, 0xB9, 0xE3, 0xF3, 0x2D, 0xF9, 0xF1, 0x4A, 0x7B, 0x74, 0x8F, 0x0C,
+    0x5E, 0xA7, 0x6B, 0x4F, 0x57, 0x4D, 0x1F, 0x10, 0x06, 0x33, 0xF7, 0xC4, 0xD3, 0x9E, 0x38, 0xAD,
+    0x80, 0x8D, 0x27, 0x62, 0x0A, 0x10, 0x06, 0x33, 0x17, 0x0F, 0x6C, 0xD3, 0x0E, 0xD3, 0x44, 0x57,
+    0x40, 0x19, 0x88, 0x69, 0x47, 0xD4, 0x15, 0x50, 0x86, 0x04, 0x38, 0xE9, 0x34, 0x50, 0x7F, 0x58,
+    0x53, 0x40, 0xE2, 0x64, 0x0D, 0x14, 0xED, 0x0D, 0x85, 0x21, 0x4E, 0x88, 0xA2, 0x89, 0x11, 0x76,
+    0x19, 0xBF, 0x83, 0xB8, 0x03, 0x2D, 0x38, 0x8D, 0x82, 0xDA, 0x51, 0xF0, 0x93, 0x87, 0xC8, 0xB7,
+    0xAE, 0x1F, 0x8A, 0x5A, 0x78, 0x9F, 0xDB, 0xD2, 0x3B, 0xB5, 0xFA, 0x7C, 0xD4, 0xC2, 0x67, 0xF3,
+    0xBA, 0x97, 0xD8, 0x62, 0x7E, 0xB6, 0xC4, 0x42, 0x16, 0x0B, 0xA8, 0x25, 0x26, 0x5B, 0x47, 0xA8,
+    0xF7, 0x80, 0xCA, 0x60, 0xDF, 0xE4, 0xD4, 0x05, 0x45, 0xDA, 0xA0, 0x48, 0x41, 0x74, 0xC4, 0x55,
+    0x4B, 0x19, 0x30, 0x22, 0x5D, 0x7F, 0xB1, 0x44, 0xA8, 0x0D, 0x45, 0x60, 0x30, 0xF3, 0xD8, 0x12,
+    0x61, 0xC0, 0xD9, 0x4D, 0x0E, 0x19, 0x12, 0x4B, 0x54, 0x0D, 0x15, 0x31, 0x39, 0x30, 0xB1, 0x44,
+    0xD5, 0x50, 0x86, 0x72, 0x06, 0x4C, 0x2C, 0x31, 0xFB, 0xCA, 0xB3, 0x97, 0x94, 0x2C, 0x09, 0x8A,
+    0x64, 0x41, 0x91, 0x92, 0x98, 0x04, 0xCC, 0xDA, 0x2B, 0x91, 0x7B, 0x2E, 0xDB, 0xB8, 0x6E, 0xE2,
+    0x9E, 0x51, 0x98, 0x38, 0x8C, 0x79, 0xC8, 0x2E, 0xFA, 0xFB, 0x22, 0x5D, 0x3A, 0x33, 0x2E, 0xCE,
+    0x43, 0x34, 0x85, 0x17, 0x09, 0x9D, 0x38, 0x46, 0x9B, 0x30, 0x15, 0x0F, 0xD0, 0xEE, 0x4B, 0xFC,
+    0x06, 0xEF, 0x59, 0x16, 0x69, 0x5B, 0x72, 0xD8, 0x8A, 0x93, 0x4B, 0x0E, 0x4C, 0x42, 0x96, 0xDE,
+    0xCE, 0xFF, 0xFB, 0xAC, 0x1C, 0xB3, 0x68, 0x35, 0x7E, 0xE2, 0xB2, 0x5A, 0xD2, 0xB3, 0x6E, 0xF3,
+    0x0D, 0x90, 0x92, 0x67, 0x7F, 0xF2, 0x4F, 0xB2, 0x72, 0x13, 0x6E, 0x93, 0x6F, 0x3F, 0x31, 0x32,
+    0x69, 0x2F, 0x4A, 0x7C, 0x93, 0x05, 0x69, 0x43, 0x17, 0xB2, 0x59, 0x53, 0xFA, 0xE2, 0xBD, 0x5A,
+    0x7A, 0xBF, 0xC8, 0xF5, 0x70, 0xE8, 0x2B, 0xC1, 0x5D, 0xE6, 0x48, 0x46, 0x68, 0x81, 0x7A, 0x8A,
+    0x7B, 0x4E, 0xC2, 0x6C, 0x18, 0xA6, 0x15, 0x03, 0x56, 0x32, 0x9E, 0xC8, 0x5E, 0x2D, 0x7F, 0x68,
+    0xDE, 0x5D, 0x31, 0x3A, 0x54, 0x8C, 0xBB, 0xAC, 0x18, 0x1D, 0x2A, 0xC6, 0x5D, 0x56, 0x8C, 0x2E,
+    0x10, 0x22, 0x7C, 0xB6, 0x58, 0x31, 0x6D, 0x88, 0x56, 0x01, 0x8C, 0x1C, 0x71, 0xD2, 0x86, 0x68,
+    0xBD, 0x62, 0xB4, 0x5C, 0x88, 0xD6, 0xB7, 0xEB, 0xA2, 0x65, 0x2E, 0xD4, 0x31, 0x5B, 0x5D, 0x78,
+    0x76, 0xE6, 0x1E, 0x52, 0x4F, 0x79, 0x66, 0x98, 0xE7, 0xB3, 0x1A, 0xAE, 0xA4, 0xDE, 0xCD, 0x5D,
+    0xDF, 0x01, 0xD5, 0x54, 0xB1, 0x8E, 0xE4, 0x44, 0x10, 0x2D, 0xDB, 0x5A, 0x46, 0x3A, 0x07, 0x4D,
+    0x00, 0x11, 0x81, 0x73, 0x84, 0xE4, 0x1F, 0x38, 0xC9, 0xE6, 0x0B, 0x58, 0xA1, 0x31, 0x04, 0x17,
+    0xDC, 0x27, 0xCC, 0x27, 0xB4, 0x89, 0x08, 0xEF, 0x92, 0xCB, 0x09, 0xD9, 0x25, 0x20, 0x21, 0x44,
+    0xB4, 0xE1, 0x42, 0x82, 0x73, 0x82, 0x2E, 0x3C, 0x23, 0xD8, 0x00, 0x2E, 0x58, 0x07, 0x73, 0x3A,
+    0xEF, 0x9E, 0xDD, 0xC5, 0x7B, 0xE5, 0xD9, 0xD3, 0xCE, 0x4A, 0x80, 0x08, 0x19, 0xAD, 0xBA, 0x7B,
+    0xBB, 0xDC, 0x55, 0xAF, 0x5E, 0xBD, 0x2A, 0x91, 0x46, 0xDC, 0x8F, 0xAA, 0xF5, 0xEC, 0x35, 0xBA,
+    0xCB, 0x8B, 0xDD, 0x5E, 0x7B, 0xF1, 0x8F, 0x26, 0x49, 0x67, 0x15, 0x29, 0x9E, 0x8D, 0x22, 0x73,
+    0x14, 0x71, 0xCF, 0x06, 0x1C, 0x16, 0x1E, 0xFA, 0xFF, 0x70, 0xE8, 0x04, 0x07, 0xB9, 0x73, 0x48,
+    0x78, 0xA8, 0x3A, 0xC9, 0x74, 0x8F, 0x1D, 0xCE, 0x53, 0xAD, 0x25, 0x69, 0x9A, 0x53, 0x5C, 0xAB,
+    0x9A, 0x51, 0x11, 0x5B, 0x4E, 0x9A, 0xA6, 0x96, 0xE3, 0xDF, 0x07, 0x7A, 0x85, 0xD5, 0x2B, 0x5F,
+    0x06, 0x55, 0x6D, 0x25, 0x0C, 0x52, 0xCC, 0xE2, 0xE1, 0x36, 0xB4, 0xF0, 0x29, 0x6E, 0x2C, 0x10,
+    0x5C, 0xA2, 0x03, 0x70, 0x29, 0x9F, 0x4E, 0x58, 0x37, 0xAF, 0x16, 0xBE, 0x8D, 0x81, 0x6B, 0x75,
+    0x49, 0x28, 0xF9, 0x1B, 0x9A, 0xD3, 0xC8, 0x60, 0x12, 0xCC, 0x50, 0xDE, 0x32, 0x64, 0x8B, 0x19,
+    0x62, 0xC5, 0xF8, 0xD5, 0x27, 0xE6, 0xEA, 0x27, 0x3A, 0x71, 0x03, 0x63, 0xE4, 0xFB, 0x0D, 0xEC,
+    0xF9, 0x24, 0xA1, 0x67, 0xF0, 0x5C, 0xFF, 0x0C, 0xB3, 0xA1, 0x42, 0xB4, 0x44, 0x75, 0xE0, 0xDB,
+    0xC6, 0x96, 0x66, 0x8B, 0x2C, 0x75, 0x14, 0xA7, 0xDA, 0xC9, 0xFB, 0x4D, 0x73, 0x48, 0xE3, 0x64,
+    0x0B, 0x54, 0x1A, 0x2D, 0x87, 0x3A, 0x8F, 0x9F, 0x69, 0xED, 0x5B, 0xD1, 0x0C, 0x4E, 0x62, 0xD1,
+    0x81, 0x79, 0x00, 0xCA, 0x5E, 0xC3, 0x99, 0x7B, 0x01, 0x5F, 0x55, 0x00, 0x8A, 0x88, 0xE8, 0xD9,
+    0x1B, 0x5E, 0xBD, 0xE4, 0xD5, 0x43, 0xA0, 0x98, 0x81, 0x2E, 0x1F, 0xF1, 0x69, 0xD5, 0x46, 0xC9,
+    0xE6, 0x44, 0x9F, 0x84, 0x0E, 0xD1, 0x17, 0x7A, 0x6D, 0x11, 0x83, 0xD8, 0xB3, 0x56, 0xBE, 0xC3,
+    0xB6, 0x97, 0xFB, 0x4C, 0xE1, 0x09, 0x13, 0xCD, 0x8C, 0x5B, 0x29, 0xA3, 0x21, 0x79, 0xF7, 0x0E,
+    0xC1, 0x92, 0x04, 0x7D, 0x4C, 0x70, 0x00, 0x86, 0xC4, 0x98, 0x52, 0x1E, 0x91, 0x54, 0xB7, 0x66,
+    0x4C, 0x88, 0xA2, 0xC9, 0x4A, 0x05, 0xFD, 0xA4, 0x73, 0xD5, 0xB2, 0x22, 0x0F, 0x49, 0xBA, 0x7B,
+    0x69, 0xE4, 0xFD, 0x1D, 0xAB, 0x47, 0x74, 0x57, 0x2F, 0x68, 0x70, 0xBF, 0xED, 0xF9, 0x62, 0xBF,
+    0xBA, 0x2A, 0xAD, 0x72, 0x16, 0x23, 0xD4, 0x6B, 0x49, 0xF3, 0x85, 0xC1, 0x25, 0xC4, 0x6F, 0xB0,
+    0x6E, 0xAC, 0xE2, 0x52, 0xA8, 0x61, 0x3F, 0x81, 0x5E, 0x92, 0x5E, 0x3E, 0x92, 0x4D, 0x97, 0x80,
+    0xE1, 0x8B, 0x5D, 0x0B, 0xCB, 0x4C, 0x33, 0x11, 0xBD, 0x55, 0x0E, 0x35, 0xE4, 0x51, 0x93, 0x9C,
+    0xA2, 0x09, 0xD0, 0xF7, 0x66, 0x82, 0x48, 0x50, 0x46, 0xF7, 0x2B, 0x3E, 0x2E, 0x7F, 0x06, 0xB2,
+    0x0A, 0xEC, 0xCB, 0x12, 0xC9, 0x30, 0xE0, 0xB8, 0xCB, 0x9E, 0xA4, 0xE3, 0x2A, 0xFE, 0x80, 0xAB,
+    0x57, 0xF8, 0xCA, 0x3D, 0xA5, 0xDE, 0xF2, 0x51, 0xB2, 0xC9, 0x0D, 0x90, 0x6E, 0x71, 0xF5, 0x60,
+    0x46, 0x1C, 0x74, 0x4A, 0xCE, 0x9A, 0xCB, 0x96, 0x81, 0x3E, 0xFC, 0xE2, 0x6B, 0xAC, 0x45, 0xC7,
+    0x5C, 0x5C, 0xEF, 0x99, 0xF6, 0x50, 0x31, 0xBB, 0xA1, 0xAC, 0xB9, 0x16, 0x84, 0x74, 0x9A, 0xDC,
+    0x25, 0x5C, 0x76, 0xFA, 0xBB, 0xC9, 0x06, 0xDE, 0x52, 0xAC, 0x11, 0x6B, 0x2B, 0x7E, 0x4C, 0x94,
+    0x8C, 0x89, 0x5A, 0xAF, 0x78, 0x7A, 0x98, 0xA8, 0x3D, 0x09, 0x8E, 0xFA, 0x2A, 0x9E, 0x1B, 0x71,
+    0xD7, 0xC6, 0xA8, 0xFE, 0x33, 0xD5, 0xAB, 0xC1, 0xBD, 0xB6, 0xE2, 0x4C, 0xD6, 0x0B, 0xCB, 0xEA,
+    0x2A, 0xA7, 0x93, 0xAA, 0x65, 0x8C, 0xB2, 0x2F, 0x60, 0x2F, 0x07, 0xF6, 0xA2, 0x1F, 0xA5, 0xD4,
+    0x73, 0xC8, 0x96, 0xA8, 0x06, 0x53, 0x03, 0x29, 0x4D, 0x2C, 0xCD, 0x7B, 0x8F, 0xCF, 0x11, 0x31,
+    0xDB, 0xCB, 0x66, 0x2C, 0x5B, 0xA9, 0x3E, 0x9E, 0x25, 0xDD, 0xA3, 0xAB, 0x5D, 0xFD, 0x3D, 0xD5,
+    0x74, 0x43, 0x7B, 0xD2, 0x58, 0x4E, 0x2D, 0x1C, 0x69, 0x9F, 0x42, 0x9A, 0x7D, 0x41, 0xE2, 0x10,
+    0xA9, 0xFA, 0x12, 0x71, 0x42, 0xD9, 0x1D, 0x18, 0x37, 0x99, 0xAF, 0x8C, 0x53, 0xE6, 0xBC, 0xBA,
+    0xE6, 0xD5, 0x73, 0xD6, 0xC5, 0xF5, 0x54, 0x45, 0xC7, 0xB6, 0x43, 0x7F, 0x88, 0xBF, 0xD8, 0x8D,
+    0x6C, 0xB3, 0x1A, 0x5E, 0x01, 0x2B, 0x39, 0xBD, 0xC5, 0xE2, 0x3B, 0xCA, 0x5F, 0x9F, 0xD8, 0xA6,
+    0x6D, 0x69, 0x5B, 0x4C, 0x21, 0x66, 0x72, 0x80, 0xDC, 0x52, 0x93, 0x2E, 0x08, 0x82, 0xE3, 0x0D,
+    0xF2, 0x26, 0x02, 0xB2, 0x40, 0x33, 0x67, 0xD0, 0xBC, 0x5E, 0xD3, 0x4C, 0x53, 0x79, 0x30, 0x85,
+    0xA6, 0xF9, 0x74, 0x16, 0xAB, 0x0C, 0xA5, 0xC2, 0x96, 0x30, 0xF3, 0x2F, 0xCD, 0xD6, 0xCC, 0xEB,
+    0x4B, 0x7B, 0x3D, 0xAE, 0xAF, 0x01, 0xFA, 0xC8, 0x39, 0x6A, 0x77, 0x3B, 0x36, 0xEB, 0x4A, 0x33,
+    0x89, 0xA6, 0x39, 0xD5, 0xEB, 0x6F, 0x49, 0xF3, 0x0D, 0x72, 0x9B, 0x6B, 0x54, 0xF8, 0x4A, 0xB7,
+    0x6D, 0x27, 0xA6, 0x61, 0x24, 0xB7, 0x10, 0xC8, 0x84, 0x69, 0x82, 0xC6, 0xF8, 0x3C, 0x96, 0x17,
+    0xBB, 0x01, 0xD3, 0xCE, 0x07, 0x20, 0x07, 0x41, 0x18, 0x45, 0xE9, 0x0C, 0xDD, 0xB9, 0x19, 0x23,
+    0x36, 0x70, 0x4C, 0xAD, 0x1C, 0x6F, 0x6E, 0x76, 0xFA, 0x5D, 0x6E, 0xED, 0xD7, 0xE7, 0xE7, 0x67,
+    0x71, 0x05, 0x2E, 0x87, 0xEF, 0x08, 0x29, 0xA7, 0xA4, 0x2B, 0xF3, 0x43, 0x75, 0x48, 0xC1, 0x76,
+    0x43, 0xF9, 0x3C, 0x7A, 0xE2, 0xBD, 0x3C, 0x22, 0xEE, 0xD5, 0x83, 0x09, 0x70, 0xA7, 0x9C, 0xE3,
+    0xA1, 0x84, 0x6E, 0x03, 0xCB, 0xB1, 0x3D, 0x54, 0xE4, 0xDE, 0x57, 0xEB, 0xE7, 0xF6, 0x76, 0xA5,
+    0xC0, 0x26, 0x7E, 0xC6, 0xAB, 0xE4, 0x68, 0xA2, 0x7B, 0xFD, 0xA3, 0x5E, 0xA7, 0x39, 0x16, 0xD4,
+    0x17, 0x55, 0x6C, 0xBD, 0xE9, 0x9D, 0xF3, 0xE5, 0x66, 0xC9, 0x47, 0x2E, 0x6F, 0xFF, 0xB5, 0xDE,
+    0xE2, 0x27, 0x09, 0xC6, 0x26, 0xE7, 0x9D, 0xA7, 0x48, 0x3D, 0xA9, 0xF3, 0x42, 0x3A, 0x48, 0xB3,
+    0x87, 0xD2, 0xB1, 0x80, 0x78, 0x4F, 0xE6, 0x3D, 0xCB, 0x70, 0xE4, 0xD9, 0x9C, 0x66, 0xA4, 0x0B,
+    0xD3, 0x2C, 0x39, 0xC3, 0x91, 0xCF, 0x30, 0x7D, 0x91, 0x38, 0x94, 0x7C, 0x90, 0x56, 0x33, 0xE7,
+    0x3A, 0x57, 0x71, 0xD6, 0x33, 0x60, 0xC4, 0x04, 0x42, 0xCD, 0xD4, 0xB8, 0xC2, 0xDF, 0xF2, 0x6F,
+    0x7F, 0xFF, 0x8B, 0xDF, 0x5F, 0xCD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x9D, 0x3D, 0x73, 0x3E,
+    0x29, 0x5B, 0x2C, 0xCD, 0x81, 0x44, 0x8A, 0xA5, 0x04, 0x1A, 0xB7, 0x14, 0xC0, 0x1A, 0xE5, 0x03,
+    0xA0, 0x38, 0xEA, 0xD4, 0x54, 0xFC, 0x00, 0x92, 0x2D, 0xF8, 0x81, 0x34, 0xF4, 0x57, 0x50, 0x24,
+    0x7C, 0x01, 0x0D, 0xD8, 0x12, 0x3F, 0xE0, 0x9E, 0xC6, 0x45, 0x10, 0xA2, 0xB3, 0x14, 0x47, 0x32,
+    0x92, 0x7D, 0xCB, 0x7B, 0x7B, 0xCE, 0x71, 0x14, 0x11, 0x34, 0x47, 0x62, 0x69, 0xC7, 0xDE, 0xDD,
+    0x99, 0x37, 0x33, 0x6F, 0x76, 0xC7, 0x99, 0xFF, 0x91, 0x4A, 0xE6, 0x7D, 0x4B, 0xE1, 0x25, 0x93,
+    0xD8, 0xE7, 0x99, 0x88, 0x2B, 0x21, 0x4C, 0x7D, 0x21, 0x74, 0x43, 0xB1, 0x99, 0x9A, 0x6A, 0x54,
+    0x51, 0x3E, 0x85, 0xD9, 0x40, 0xDB, 0x9A, 0x22, 0x07, 0x80, 0xAD, 0x20, 0x74, 0x03, 0x11, 0x75,
+    0x10, 0x93, 0x1E, 0x42, 0x88, 0x2C, 0x59, 0xFA, 0x07, 0x72, 0x00, 0x8D, 0x7A, 0x08, 0x35, 0xC8,
+    0xD6, 0xF3, 0x92, 0x22, 0xAC, 0xF4, 0x18, 0xAA, 0x85, 0x98, 0x34, 0x10, 0x51, 0xC5, 0x69, 0x50,
+    0x99, 0x3F, 0x2B, 0x8B, 0xB3, 0xC6, 0x77, 0xBD, 0x3F, 0x71, 0x83, 0x98, 0x5E, 0xA2, 0x81, 0x3E,
+    0xC4, 0xE5, 0x80, 0x96, 0xA8, 0x0D, 0xF6, 0x2E, 0x45, 0xA0, 0x97, 0x4D, 0xC6, 0xE7, 0x81, 0x88,
+    0x2D, 0x45, 0x63, 0x07, 0x1E, 0xB0, 0xF9, 0x51, 0xE4, 0x06, 0x96, 0xE3, 0x5C, 0x8E, 0xA1, 0x1C,
+    0xD4, 0x61, 0x26, 0xAE, 0x80, 0x85, 0x5D, 0x61, 0x47, 0x87, 0x98, 0x9E, 0x6F, 0xC7, 0x9B, 0x5D,
+    0x0F, 0x0A, 0xEF, 0x4B, 0xFC, 0xA6, 0x9B, 0x74, 0xBA, 0xFE, 0x8C, 0x70, 0x73, 0xF1, 0x0D, 0x36,
+    0x44, 0xA6, 0x63, 0x90, 0xF3, 0x83, 0x26, 0xE9, 0x9D, 0xF1, 0x6F, 0xCF, 0x56, 0xEF, 0x41, 0x59,
+    0x44, 0xB2, 0xAA, 0xA0, 0x01, 0xCE, 0xE0, 0x85, 0x9C, 0x30, 0xDD, 0xBF, 0xBC, 0x58, 0x8B, 0x63,
+    0xE6, 0x9C, 0x33, 0x02, 0x61, 0x68, 0xC2, 0xB8, 0xC4, 0x60, 0x41, 0xB6, 0x69, 0x51, 0x85, 0x3F,
+    0x12, 0xF0, 0x51, 0x22, 0xA7, 0xDE, 0x74, 0xB2, 0xFF, 0x94, 0x25, 0x4D, 0x4A, 0xD8, 0x74, 0xFC,
+    0xC8, 0x47, 0x63, 0x0B, 0x14, 0xF1, 0x58, 0x8E, 0xA0, 0x2F, 0x06, 0x24, 0x88, 0x5D, 0x0B, 0xF0,
+    0xAE, 0x7D, 0x3A, 0x52, 0x6E, 0x59, 0xFC, 0x50, 0x00, 0x1E, 0x85, 0x42, 0xD6, 0xEE, 0xD5, 0xF0,
+    0x10, 0xEE, 0xBF, 0xF8, 0x0F, 0x45, 0xE3, 0xE0, 0x06, 0x3E, 0xE1, 0x64, 0x1A, 0xC2, 0xB8, 0x73,
+    0x44, 0xA2, 0x82, 0xAA, 0x02, 0x00, 0xEB, 0xAB, 0xCB, 0xDF, 0x7C, 0x4C, 0x17, 0x60, 0xDE, 0x9F,
+    0x6A, 0xEF, 0xBB, 0xE4, 0xDB, 0xAD, 0x06, 0xA9, 0xDD, 0x74, 0x58, 0x0E, 0x03, 0x6A, 0x16, 0x31,
+    0xCE, 0x18, 0x41, 0xB1, 0x62, 0x14, 0xF8, 0xC8, 0x40, 0xC0, 0xAC, 0x5F, 0x83, 0x85, 0xD3, 0xD9,
+    0xDF, 0x45, 0x02, 0xEE, 0xDD, 0x61, 0x0B, 0xCF, 0xF5, 0xBE, 0x87, 0xDE, 0x9C, 0xFC, 0x9C, 0x10,
+    0x81, 0xCE, 0x90, 0xD3, 0xA4, 0x87, 0xF7, 0x0C, 0xF9, 0xDA, 0x7C, 0x56, 0x4B, 0xBA, 0x71, 0x7E,
+    0xF5, 0xF4, 0xEC, 0x2D, 0xE1, 0x03, 0x19, 0x65, 0x58, 0x18, 0x70, 0xCC, 0x5A, 0x5B, 0x9A, 0x32,
+    0x6A, 0xA6, 0x17, 0x35, 0xDC, 0x19, 0x3D, 0x57, 0x9A, 0x7A, 0x4C, 0x8D, 0xC7, 0x18, 0x33, 0x3A,
+    0xB2, 0x9C, 0x25, 0xE9, 0xD8, 0x62, 0x78, 0x91, 0x88, 0xEE, 0x4E, 0x77, 0x94, 0xFE, 0x6D, 0x46,
+    0x3D, 0x5E, 0x9B, 0x98, 0x6A, 0x4F, 0xC6, 0xF1, 0x09, 0x38, 0x98, 0x17, 0x95, 0xA8, 0x25, 0x1A,
+    0x92, 0xA9, 0xD0, 0x71, 0xDC, 0x01, 0x00, 0x57, 0x03, 0xDD, 0xC0, 0x24, 0x61, 0xA4, 0x8B, 0x6B,
+    0x73, 0xB9, 0xF6, 0x52, 0xB5, 0xD4, 0xB5, 0xAE, 0x27, 0x1D, 0x1C, 0xAD, 0x60, 0xE7, 0x00, 0x62,
+    0x60, 0xAA, 0xD2, 0x9D, 0x5E, 0x2E, 0xB6, 0x57, 0xFF, 0x8A, 0xE2, 0x2B, 0x45, 0x3B, 0xFE, 0x37,
+    0xD8, 0x7E, 0xD8, 0xC5, 0x01, 0xC1, 0xF0, 0x03, 0xC6, 0xFF, 0x58, 0xE4, 0xCF, 0x42, 0xE4, 0x11,
+    0x45, 0x12, 0x7E, 0x4D, 0x64, 0x30, 0x34, 0x19, 0x51, 0x1B, 0x23, 0xC7, 0x10, 0x0D, 0x8B, 0x72,
+    0x0F, 0x6A, 0xF8, 0x2C, 0xD9, 0x8A, 0x50, 0x1C, 0x90, 0xF3, 0x1D, 0xFC, 0x1C, 0x9E, 0xBF, 0x60,
+    0xA5, 0x8A, 0x50, 0x3D, 0x1D, 0x76, 0x2E, 0x99, 0x10, 0x2E, 0xC3, 0x5F, 0xEC, 0xE7, 0x42, 0x81,
+    0x0F, 0x8B, 0x73, 0x71, 0x2E, 0xF2, 0x3A, 0xF4, 0xEF, 0x78, 0x08, 0x0D, 0x98, 0xC0, 0x1D, 0xCF,
+    0x12, 0x6F, 0xF6, 0x3F, 0x3E, 0xBF, 0x00, 0xCD, 0x55, 0x3D, 0x6F, 0xD3, 0x50, 0x14, 0x3D, 0xB6,
+    0x49, 0x2D, 0xD5, 0xC3, 0x63, 0xA0, 0x03, 0x0B, 0x5E, 0x2B, 0xA4, 0x92, 0x95, 0x01, 0xE5, 0x59,
+    0x62, 0x60, 0x60, 0x61, 0x88, 0x59, 0x3A, 0xF0, 0x13, 0xFA, 0x0F, 0x70, 0xFE, 0x01, 0x59, 0xD8,
+    0x19, 0x23, 0x18, 0x58, 0x18, 0x51, 0x6D, 0xF1, 0x0B, 0x2C, 0xA4, 0x4E, 0x0C, 0x58, 0xEA, 0x80,
+    0xD4, 0xA5, 0x16, 0x35, 0xE0, 0x50, 0xDB, 0x97, 0x73, 0x9D, 0x08, 0x92, 0x0D, 0x0A, 0x89, 0xB0,
+    0x94, 0xAB, 0x97, 0xFB, 0x9E, 0xEF, 0x3B, 0xE7, 0xDC, 0x0F, 0x63, 0x86, 0xDD, 0x09, 0xC2, 0x2C,
+    0xCC, 0xE0, 0x34, 0x34, 0x08, 0xCF, 0x69, 0x5C, 0xC9, 0x01, 0xD8, 0x82, 0xC6, 0x79, 0x84, 0x95,
+    0x27, 0x14, 0x3E, 0x1F, 0xD4, 0x7C, 0x55, 0xD3, 0x02, 0x49, 0xA4, 0x6E, 0xBE, 0x03, 0xBF, 0xD4,
+    0xE3, 0x8D, 0x1E, 0x4B, 0xB0, 0x25, 0x27, 0x76, 0xA6, 0x34, 0x84, 0x01, 0xA3, 0x3B, 0x35, 0xF6,
+    0x11, 0x22, 0xC8, 0xDC, 0x02, 0x0D, 0x6E, 0xF4, 0x3E, 0xB7, 0x51, 0x3A, 0x52, 0x23, 0x11, 0x99,
+    0x38, 0xC9, 0xC9, 0xB8, 0xF7, 0x60, 0xB8, 0xDC, 0xFA, 0xED, 0x45, 0x7F, 0x5F, 0xA8, 0xB2, 0xC8,
+    0xF3, 0x08, 0x3E, 0x03, 0x52, 0x8C, 0x09, 0x30, 0x88, 0x34, 0xB2, 0xC8, 0xD1, 0x4F, 0x65, 0x2A,
+    0x38, 0xED, 0x9F, 0xB0, 0xF0, 0xF8, 0x4E, 0x01, 0x51, 0x8C, 0x43, 0x91, 0xEE, 0xAF, 0x95, 0xD9,
+    0x27, 0xE0, 0x5E, 0x0F, 0xAF, 0x54, 0xF8, 0x81, 0xC8, 0x27, 0xC6, 0x7E, 0xF2, 0x25, 0x56, 0x2E,
+    0x69, 0xCF, 0x26, 0x28, 0x61, 0x45, 0x8C, 0xC8, 0xBB, 0xF4, 0xEC, 0x45, 0xD0, 0x1F, 0xFB, 0xB5,
+    0xA3, 0x41, 0x99, 0x55, 0x33, 0x1F, 0x3B, 0x44, 0xA3, 0x24, 0xF7, 0x78, 0x53, 0x84, 0x29, 0x43,
+    0xE1, 0x0D, 0xA9, 0xCF, 0xDF, 0xC2, 0x2B, 0x52, 0x02, 0x2D, 0x5D, 0x9A, 0xEB, 0x58, 0x7B, 0x9E,
+    0x62, 0x59, 0x43, 0xFE, 0x25, 0xC1, 0x38, 0x9D, 0x22, 0x4C, 0xD2, 0x7F, 0xEA, 0x6C, 0xD5, 0x99,
+    0x2A, 0x6B, 0xFB, 0x8C, 0x25, 0x1A, 0xBE, 0xA7, 0xDC, 0xA6, 0x64, 0xB5, 0x86, 0x95, 0x27, 0x67,
+    0x69, 0xA5, 0xDC, 0x98, 0x04, 0x55, 0x15, 0x88, 0xF9, 0xBB, 0x89, 0x1D, 0x04, 0x1D, 0x2A, 0xF2,
+    0x39, 0xC2, 0x28, 0x90, 0xDC, 0xCB, 0x82, 0x7A, 0x1D, 0xB8, 0x65, 0x4E, 0x2F, 0x2A, 0xDE, 0x75,
+    0xA5, 0x45, 0xCA, 0x85, 0xB9, 0x68, 0x78, 0xE7, 0x30, 0x47, 0x52, 0xCA, 0x49, 0x9A, 0xFA, 0x22,
+    0xA7, 0x65, 0x20, 0x95, 0x5D, 0x74, 0xD0, 0x5E, 0x4C, 0x20, 0x14, 0x3C, 0xD7, 0x74, 0x57, 0xFA,
+    0x7F, 0xBC, 0x72, 0xBB, 0x5F, 0x6C, 0x48, 0xAA, 0x15, 0xE7, 0x47, 0x3A, 0x83, 0x6F, 0x74, 0x7A,
+    0xB5, 0xD6, 0x58, 0x4B, 0xA4, 0x10, 0xAF, 0x23, 0xE6, 0xC8, 0x76, 0xAF, 0x24, 0xD2, 0x32, 0x8C,
+    0x98, 0x6E, 0x6E, 0x62, 0xA0, 0x90, 0x63, 0x42, 0x24, 0xE2, 0x8C, 0xA5, 0xD9, 0x60, 0x10, 0xC7,
+    0xD1, 0xD6, 0xC4, 0xBA, 0x0B, 0x9F, 0x47, 0x22, 0x2F, 0x87, 0x3B, 0x3F, 0x24, 0x62, 0x2B, 0xA5,
+    0x36, 0x71, 0x3F, 0x8E, 0xFE, 0xFB, 0x62, 0x2B, 0x70, 0x00, 0x03, 0x2F, 0xC3, 0xF1, 0xE3, 0x46,
+    0x93, 0x4D, 0xD5, 0x75, 0x4E, 0x38, 0x5B, 0x2C, 0x36, 0xDC, 0xD6, 0x5C, 0x25, 0x1C, 0x51, 0x18,
+    0x85, 0x5C, 0xDE, 0x72, 0xC8, 0xC4, 0x9F, 0xDC, 0x23, 0x8A, 0xF2, 0x8E, 0xDE, 0x9F, 0x46, 0x3A,
+    0x76, 0xF4, 0xD0, 0xB5, 0x55, 0x39, 0x9D, 0x7A, 0xA3, 0x15, 0xD8, 0x3B, 0xB5, 0x02, 0xDD, 0x5E,
+    0xD4, 0xCE, 0x52, 0x96, 0xE4, 0x21, 0x19, 0xD9, 0x8C, 0x0A, 0x25, 0xB9, 0x91, 0x97, 0xEC, 0x0F,
+    0xD1, 0x26, 0x21, 0x21, 0xD5, 0xAC, 0xEF, 0x91, 0xD9, 0x92, 0x8B, 0x79, 0x90, 0xC3, 0x29, 0x88,
+    0xFF, 0xC0, 0x29, 0x16, 0x44, 0x8C, 0x46, 0xB4, 0x0C, 0xB0, 0xDA, 0xCB, 0xDE, 0x95, 0x85, 0xD5,
+    0x45, 0xA0, 0x0B, 0xB1, 0x19, 0xC2, 0xCF, 0x2D, 0x51, 0x98, 0xF6, 0xF0, 0xB2, 0x4C, 0xA4, 0xB3,
+    0x48, 0xE5, 0x7E, 0xA9, 0x83, 0x10, 0xEE, 0x6C, 0x77, 0xCA, 0xB2, 0x30, 0xE4, 0xD1, 0xEA, 0xBC,
+    0x3D, 0xD6, 0x0B, 0x47, 0xAE, 0x1A, 0xD0, 0x0C, 0xD6, 0xE7, 0x4A, 0x38, 0xD9, 0x64, 0x71, 0x2E,
+    0x9C, 0x5A, 0x9C, 0x43, 0x6D, 0x6F, 0x73, 0x4A, 0x99, 0xFC, 0x8A, 0xD9, 0xF5, 0x1A, 0x53, 0xC3,
+    0x6F, 0x21, 0xDF, 0x5F, 0xB7, 0xDA, 0xC4, 0xFA, 0xA1, 0xD6, 0x4F, 0x16, 0xF6, 0xA2, 0xF5, 0x71,
+    0xFD, 0x03, 0xAD, 0x54, 0x3D, 0x8E, 0xDE, 0x36, 0x10, 0x1D, 0x89, 0x31, 0x04, 0x44, 0x05, 0x53,
+    0xC4, 0x35, 0xDB, 0xC0, 0x8D, 0x6E, 0xB0, 0x54, 0xE0, 0x33, 0x18, 0x29, 0x72, 0x83, 0x9C, 0x21,
+    0xB0, 0x14, 0xB8, 0x70, 0xB9, 0x39, 0x86, 0xE3, 0x2B, 0xC4, 0xFE, 0x44, 0xC0, 0x65, 0x8A, 0x15,
+    0x12, 0xA4, 0xB6, 0x12, 0x17, 0x01, 0xD2, 0x98, 0xB0, 0x55, 0x08, 0x58, 0x4A, 0xCC, 0x7B, 0xA4,
+    0xB4, 0xD9, 0xCF, 0x6E, 0x9C, 0x45, 0xF8, 0x81, 0xFC, 0x28, 0xFE, 0xCC, 0xBC, 0xF7, 0x66, 0x38,
+    0xF2, 0xF9, 0x8F, 0xDF, 0x49, 0x19, 0xF4, 0x24, 0xF6, 0xEB, 0x20, 0xF5, 0x64, 0xA5, 0x58, 0x6A,
+    0x27, 0x17, 0x85, 0x97, 0x42, 0x3E, 0x93, 0x9B, 0xA6, 0x66, 0x91, 0xCE, 0xB6, 0x52, 0xBD, 0xBF,
+    0xCB, 0xA4, 0xE6, 0x24, 0x5A, 0x27, 0xE6, 0xDD, 0x2A, 0x55, 0xD4, 0xEB, 0xB7, 0xD7, 0xBE, 0x8B,
+    0x9B, 0x95, 0x21, 0x3E, 0xF4, 0x72, 0x5F, 0xE4, 0x31, 0x5C, 0x98, 0xB7, 0x4E, 0xA4, 0xBA, 0xF6,
+    0x22, 0xC5, 0x16, 0xF0, 0xDD, 0x0D, 0xFF, 0xEB, 0xE2, 0xCA, 0xC5, 0xA1, 0xC3, 0x60, 0x2F, 0x27,
+    0xEC, 0xFC, 0xBA, 0x8A, 0x68, 0x6F, 0x27, 0x31, 0xB3, 0x8A, 0x7F, 0x0F, 0xB3, 0xD8, 0x18, 0x67,
+    0x29, 0x62, 0x5C, 0x70, 0xE4, 0xD1, 0x0B, 0x92, 0xFE, 0x9E, 0xC3, 0x05, 0x07, 0xDD, 0x53, 0x83,
+    0x89, 0x53, 0x9A, 0x11, 0xCB, 0x51, 0xC5, 0x7F, 0xF5, 0x11, 0x58, 0x33, 0xAF, 0x48, 0x57, 0x8F,
+    0x52, 0x04, 0x92, 0xF7, 0xFF, 0x6D, 0x69, 0xC0, 0x92, 0x0A, 0xD4, 0xC8, 0x0F, 0x6D, 0x11, 0x5D,
+    0xFC, 0x7D, 0x18, 0x88, 0x26, 0x64, 0x91, 0xEE, 0xB5, 0x0D, 0xBC, 0x94, 0x9E, 0xA4, 0x5A, 0x0C,
+    0x04, 0xA8, 0xF8, 0x85, 0x6B, 0x22, 0xCD, 0xCA, 0x61, 0x3E, 0xC0, 0x14, 0xCF, 0xF6, 0x89, 0x0E,
+    0xFB, 0x24, 0xB1, 0xE2, 0xC2, 0x9B, 0x7D, 0x72, 0x52, 0xF9, 0x74, 0x3D, 0x96, 0x79, 0xF2, 0xA5,
+    0x48, 0x2B, 0x1F, 0xB7, 0x02, 0x16, 0x2A, 0xF8, 0xD1, 0xC4, 0x68, 0x47, 0x42, 0x87, 0x0C, 0xB1,
+    0x47, 0xD2, 0x34, 0x0E, 0xB1, 0xC4, 0xCE, 0xD4, 0x65, 0x00, 0xB6, 0xC5, 0xB0, 0x2E, 0xB8, 0xA2,
+    0x16, 0xC4, 0xDE, 0x23, 0x9D, 0x6A, 0x2F, 0xCD, 0xA5, 0xC3, 0x8E, 0x71, 0xB2, 0x36, 0x3D, 0xC4,
+    0xB3, 0xAD, 0xF2, 0x1D, 0x2D, 0x6E, 0x62, 0xFA, 0x20, 0x4D, 0x5F, 0x06, 0x79, 0x09, 0x2C, 0xC8,
+    0x0B, 0xAF, 0x7C, 0x85, 0x1F, 0x18, 0x19, 0xA7, 0x1D, 0xAC, 0xDB, 0xFE, 0x84, 0xF3, 0x1B, 0xB4,
+    0xC1, 0x81, 0x04, 0x38, 0x68, 0x57, 0x04, 0xD8, 0x52, 0xF3, 0x63, 0xB0, 0x47, 0x84, 0xEB, 0x3F,
+    0x67, 0xA9, 0xC9, 0xC9, 0x5C, 0x41, 0xB9, 0x2B, 0xE0, 0xB3, 0x36, 0x77, 0xD9, 0x96, 0xDC, 0xCB,
+    0x08, 0xAD, 0xD1, 0x13, 0xD8, 0x14, 0x33, 0xBD, 0xEC, 0xCA, 0x90, 0x4F, 0xC3, 0xA8, 0x32, 0x57,
+    0xBA, 0x44, 0xFF, 0x41, 0x7B, 0x5B, 0xB8, 0x32, 0xFA, 0xF4, 0xDF, 0x01, 0x0D, 0x95, 0x77, 0x27,
+    0xFE, 0x55, 0x53, 0x91, 0x54, 0xFC, 0x42, 0x8A, 0x8F, 0x24, 0x03, 0x7E, 0x15, 0x72, 0x6C, 0x07,
+    0x27, 0xCD, 0x93, 0x45, 0xF4, 0x0A, 0xB8, 0xB8, 0x1F, 0x27, 0xE9, 0xA0, 0xA6, 0xE9, 0xA4, 0xF6,
+    0x7A, 0x54, 0xEF, 0xC8, 0x79, 0x13, 0x6B, 0x7A, 0xED, 0x6A, 0x5F, 0x4D, 0x01, 0x7B, 0x56, 0x5E,
+    0x82, 0x78, 0xAF, 0x66, 0xED, 0x48, 0xB7, 0xF9, 0x61, 0xA9, 0x3C, 0x5E, 0x64, 0x68, 0x5A, 0x4B,
+    0x5D, 0x5E, 0xF9, 0x72, 0x06, 0x80, 0xF5, 0x42, 0xCC, 0xE5, 0x28, 0xF5, 0x5F, 0xA3, 0x04, 0xC0,
+    0xEC, 0x5E, 0x88, 0x7E, 0xDD, 0x83, 0x99, 0x93, 0x8E, 0x31, 0x9A, 0x13, 0xC9, 0x02, 0xDD, 0x32,
+    0x6E, 0x5E, 0xCA, 0xED, 0x86, 0x58, 0xA2, 0x95, 0x49, 0x0D, 0xB6, 0xDF, 0x09, 0x65, 0x3A, 0x1F,
+    0x90, 0xA9, 0x21, 0x4B, 0xB1, 0x50, 0x13, 0xFB, 0x04, 0x97, 0x08, 0x99, 0x49, 0x0E, 0xA1, 0x1A,
+    0x07, 0x68, 0x44, 0xE7, 0xF8, 0x85, 0x30, 0x02, 0x8A, 0x47, 0xC4, 0x11, 0xAE, 0x8E, 0xF9, 0xC2,
+    0xFC, 0xD0, 0x7F, 0xA4, 0x27, 0x48, 0x17, 0x2A, 0x79, 0x33, 0x6B, 0xCA, 0x42, 0xB7, 0x97, 0x12,
+    0x26, 0xCB, 0x5D, 0xA6, 0xC5, 0x4F, 0xC7, 0xBB, 0xD3, 0xB4, 0xD5, 0x5C, 0xC1, 0xD7, 0xA9, 0x44,
+    0xCA, 0x2D, 0x72, 0x62, 0xFE, 0xDE, 0xBB, 0xC5, 0x00, 0xE0, 0xCA, 0x00, 0x44, 0x6A, 0x01, 0x8C,
+    0xCA, 0x03, 0x6E, 0x22, 0xA1, 0x47, 0x50, 0x33, 0x0E, 0x7A, 0x5A, 0x08, 0x0D, 0xDB, 0x48, 0xC0,
+    0x81, 0xCF, 0x1A, 0x2A, 0x9D, 0xF8, 0xBA, 0xBB, 0x92, 0x5C, 0x1E, 0xC2, 0x5D, 0xF3, 0x94, 0x02,
+    0xFE, 0x02, 0x1F, 0xF5, 0x6B, 0xD6, 0x11, 0x16, 0x13, 0x15, 0xDB, 0x2C, 0x2E, 0xA9, 0xE7, 0x77,
+    0x9F, 0xDE, 0x88, 0x50, 0x81, 0xF4, 0x52, 0x84, 0x02, 0x50, 0x1D, 0xF9, 0x99, 0x67, 0x07, 0x9E,
+    0xE8, 0x52, 0xE9, 0x48, 0x15, 0xB5, 0x58, 0xAA, 0x89, 0xDB, 0xC3, 0x31, 0x3D, 0xAB, 0xB3, 0x47,
+    0x63, 0x9E, 0x99, 0xA7, 0x73, 0x42, 0xEF, 0xC8, 0x85, 0xD5, 0x6A, 0xC4, 0x73, 0x2A, 0xF9, 0x84,
+    0x32, 0x6A, 0x7C, 0xE9, 0xA9, 0x58, 0xB9, 0x0B, 0x86, 0x6A, 0xA1, 0x73, 0xE3, 0x88, 0x6A, 0x33,
+    0x84, 0xFB, 0x9E, 0x88, 0x2C, 0xA1, 0xA6, 0xF4, 0xDF, 0x73, 0xFA, 0x6E, 0xC2, 0xE7, 0xA9, 0x94,
+    0xD4, 0x5F, 0x93, 0x64, 0x3C, 0xD8, 0xDA, 0xA3, 0x10, 0xDD, 0xD6, 0x5E, 0x22, 0xDA, 0x6F, 0x1C,
+    0x2E, 0xD1, 0xB7, 0xE3, 0x12, 0xD3, 0x49, 0x85, 0x5D, 0x1D, 0x22, 0xCF, 0xCB, 0x7C, 0x7D, 0x15,
+    0xBD, 0x90, 0x6A, 0xC9, 0x7D, 0x33, 0xEE, 0x2E, 0xEA, 0x74, 0xAD, 0xBF, 0x7D, 0x6D, 0x3B, 0xBB,
+    0xB6, 0x1C, 0xD7, 0xE8, 0xEC, 0x9A, 0xC3, 0x5B, 0x0E, 0xC8, 0xF7, 0x3E, 0x5F, 0x8C, 0xD9, 0x24,
+    0x21, 0x6A, 0x77, 0x86, 0x12, 0x05, 0x3F, 0xB0, 0xDF, 0x7F, 0xF4, 0xCD, 0x51, 0xE4, 0x58, 0x3F,
+    0xFA, 0x64, 0x99, 0xE8, 0x18, 0xD2, 0x3A, 0x89, 0x9A, 0xF9, 0x6F, 0x39, 0xD4, 0x14, 0x44, 0x4F,
+    0x19, 0x4D, 0xF7, 0xFC, 0xF9, 0xB3, 0x01, 0x36, 0xD8, 0x45, 0xBE, 0x3A, 0xF2, 0x20, 0xE1, 0xA3,
+    0x25, 0x96, 0xD5, 0xF3, 0x06, 0x8F, 0x71, 0x26, 0xC4, 0x37, 0x1C, 0x0E, 0x66, 0x1F, 0x10, 0xFE,
+    0x64, 0x9D, 0xA6, 0x4F, 0xD1, 0x89, 0x21, 0xB8, 0x91, 0xC7, 0x9D, 0xA1, 0xF9, 0x07, 0xAD, 0x54,
+    0xBD, 0x6F, 0x1C, 0x45, 0x14, 0xFF, 0xCD, 0xAD, 0xED, 0x95, 0xB3, 0x12, 0x73, 0xC5, 0x59, 0x02,
+    0x0B, 0x79, 0x1B, 0x0A, 0xE3, 0x82, 0xFD, 0x07, 0xEE, 0x3C, 0x0B, 0x14, 0x2E, 0x28, 0x70, 0xC1,
+    0x25, 0x45, 0x8A, 0xD0, 0xDA, 0x8D, 0xFF, 0x81, 0xF3, 0xED, 0x26, 0x29, 0x28, 0x31, 0x0D, 0x29,
+    0x68, 0x8C, 0x94, 0xE2, 0xD8, 0x26, 0x29, 0x52, 0xA4, 0xF0, 0xDD, 0x6E, 0x62, 0xA1, 0x14, 0x29,
+    0x58, 0x07, 0xA1, 0x14, 0x34, 0x2B, 0x0C, 0x95, 0x8B, 0x6C, 0xB1, 0x91, 0x56, 0x64, 0x76, 0x87,
+    0xF7, 0xEE, 0x03, 0x9F, 0x93, 0x80, 0x8C, 0xC4, 0xCC, 0xBD, 0xB9, 0xB7, 0x6F, 0xDE, 0x7B, 0xF3,
+    0xBE, 0xD1, 0x08, 0x01, 0x99, 0x9D, 0x43, 0xC3, 0xC7, 0xFC, 0x52, 0xC6, 0x68, 0x86, 0x95, 0xEE,
+    0x35, 0x0D, 0xD8, 0x39, 0x31, 0xA5, 0x44, 0x25, 0xA1, 0x18, 0x10, 0x15, 0x60, 0x95, 0x80, 0x43,
+    0x64, 0x37, 0x21, 0x32, 0xC9, 0xD6, 0x44, 0x26, 0x4E, 0xAB, 0x98, 0xA8, 0xF3, 0x88, 0x1C, 0x44,
+    0xD1, 0x20, 0x26, 0x1D, 0x0C, 0xE2, 0x10, 0xAB, 0x68, 0x14, 0x8D, 0x82, 0x04, 0x49, 0x8B, 0xF5,
+    0x8A, 0xC4, 0x2D, 0x43, 0xEA, 0x6C, 0x12, 0xC2, 0xE2, 0xFC, 0xE3, 0x86, 0xD6, 0xCF, 0x7C, 0x7C,
+    0x4D, 0x40, 0x6A, 0x21, 0xE9, 0x19, 0x04, 0xC4, 0x62, 0x31, 0x2F, 0x6B, 0x66, 0x03, 0x26, 0x64,
+    0xB2, 0x06, 0x76, 0xC1, 0x06, 0x13, 0xB9, 0xC1, 0xF7, 0x6E, 0xCA, 0x3A, 0x30, 0xB1, 0x0E, 0x41,
+    0x38, 0x2F, 0x56, 0x5F, 0x10, 0x2B, 0x67, 0x62, 0xFC, 0xD8, 0x2B, 0x3E, 0x5E, 0xF0, 0xB1, 0x0A,
+    0x71, 0x28, 0x53, 0x99, 0x5A, 0x05, 0xF9, 0x55, 0x93, 0x88, 0x22, 0x46, 0x37, 0xBF, 0x60, 0xE5,
+    0xFF, 0x1D, 0x1E, 0xEC, 0x1E, 0xB8, 0xE6, 0xC4, 0x18, 0x59, 0xB4, 0x02, 0x34, 0x4A, 0xE6, 0x21,
+    0xA9, 0x8A, 0xF9, 0x49, 0xF1, 0x7F, 0x46, 0xB1, 0xEB, 0x93, 0x9B, 0x35, 0x7F, 0x6B, 0xC8, 0x04,
+    0xDB, 0x88, 0x28, 0x12, 0x2A, 0xF1, 0x12, 0x49, 0x5B, 0x90, 0x3D, 0x1B, 0x21, 0xEC, 0x1A, 0xC2,
+    0x14, 0x50, 0x37, 0x12, 0x99, 0x06, 0x56, 0x0E, 0xDD, 0x82, 0xF0, 0xC5, 0x01, 0xBE, 0x54, 0xA5,
+    0xF5, 0xD8, 0xD4, 0x7B, 0x72, 0xCB, 0x14, 0x3D, 0x61, 0x7C, 0xF6, 0x7A, 0xA5, 0xFB, 0x45, 0x6C,
+    0x6A, 0xFA, 0x11, 0xB2, 0x1B, 0x45, 0x3F, 0x98, 0xE9, 0xE2, 0x58, 0xDC, 0xC7, 0x3B, 0x0F, 0xF1,
+    0x91, 0xBA, 0xAA, 0x3D, 0x53, 0xD8, 0x26, 0x45, 0x0B, 0xEB, 0xB1, 0x19, 0xB5, 0x16, 0xD0, 0x54,
+    0xD0, 0x01, 0x34, 0x9D, 0x84, 0x8F, 0x3E, 0x35, 0x3F, 0xEE, 0x85, 0x0A, 0xE5, 0xDE, 0xE3, 0xD2,
+    0x09, 0xD7, 0x20, 0xEE, 0xC2, 0xE4, 0xDE, 0xF5, 0xE3, 0xA4, 0xDD, 0xB6, 0x8E, 0xD3, 0xB6, 0x7B,
+    0x2F, 0x8C, 0x33, 0x34, 0x21, 0x06, 0x57, 0x0E, 0xD5, 0x4D, 0xED, 0xE4, 0xCA, 0xD7, 0x4E, 0x46,
+    0xEC, 0x76, 0xB2, 0x89, 0x26, 0x59, 0xFC, 0x21, 0x96, 0x6E, 0x95, 0x8D, 0xD2, 0xC9, 0x46, 0x50,
+    0x71, 0x48, 0xB2, 0xE3, 0xB4, 0x2E, 0x02, 0x3B, 0x23, 0x5E, 0x3B, 0x3B, 0x4B, 0xDF, 0x65, 0xA3,
+    0x91, 0x73, 0x36, 0x3D, 0x76, 0x96, 0x0E, 0x76, 0x3F, 0x19, 0xC0, 0x50, 0x6D, 0x54, 0x76, 0x2E,
+    0x48, 0x97, 0x28, 0x9D, 0x44, 0xE4, 0x4E, 0x02, 0x9F, 0x84, 0xD6, 0xC7, 0x89, 0x22, 0xF3, 0x47,
+    0xB8, 0xDF, 0x62, 0xF3, 0xFB, 0xDF, 0x9E, 0x9B, 0x2F, 0x22, 0x5F, 0x9A, 0x5C, 0x19, 0xBD, 0x8F,
+    0xFD, 0x07, 0x58, 0x6B, 0x62, 0xA1, 0x91, 0xEE, 0x3B, 0x89, 0xF6, 0x6E, 0x97, 0xEA, 0xB3, 0xDC,
+    0x2C, 0x6E, 0xCB, 0xAC, 0x76, 0x9F, 0xD1, 0x67, 0xAE, 0xEC, 0xF4, 0x68, 0xD1, 0x1F, 0x39, 0x79,
+    0x60, 0x15, 0xDE, 0x4D, 0x2D, 0x93, 0xA1, 0x95, 0xAD, 0x38, 0x74, 0x7B, 0x42, 0xB7, 0xC5, 0xE4,
+    0x76, 0xD7, 0x57, 0x89, 0x9B, 0xB2, 0x0D, 0xE8, 0x63, 0x41, 0x44, 0x96, 0xB6, 0x0B, 0x99, 0x2A,
+    0x7F, 0x9F, 0xBC, 0x45, 0x07, 0x9D, 0x8D, 0x61, 0x50, 0x6D, 0x54, 0x8C, 0x01, 0x3D, 0xDA, 0xFD,
+    0x41, 0x50, 0x05, 0x03, 0xC6, 0x28, 0x4B, 0xD1, 0xF7, 0xC6, 0x3C, 0xE1, 0x30, 0xF7, 0x20, 0x72,
+    0xD8, 0x09, 0xDC, 0x29, 0x4A, 0xED, 0xBB, 0x43, 0xC5, 0x2B, 0x33, 0xBB, 0xB0, 0xB4, 0xA3, 0xA5,
+    0xB6, 0x7E, 0xE7, 0x5C, 0x08, 0xE7, 0xE9, 0x69, 0x92, 0xB7, 0x9D, 0xEC, 0x48, 0xD0, 0x97, 0x95,
+    0xF0, 0xBE, 0xFE, 0x87, 0x31, 0x71, 0x3D, 0xE9, 0x2B, 0x3B, 0x9D, 0xD0, 0x78, 0x5F, 0xFB, 0x85,
+    0x29, 0x8C, 0x35, 0xC2, 0x95, 0xEE, 0x96, 0xA9, 0x94, 0x49, 0x30, 0xB0, 0x72, 0x99, 0x50, 0xC6,
+    0xF8, 0x2F, 0x88, 0xFF, 0x34, 0x4F, 0xCA, 0x0B, 0x24, 0xE5, 0xC7, 0xA5, 0xC9, 0x62, 0x7F, 0x59,
+    0x9E, 0x96, 0xF5, 0x32, 0x5E, 0xCB, 0xF1, 0x3F, 0xE4, 0xF4, 0xCA, 0x81, 0x76, 0x6F, 0xE5, 0x9B,
+    0x76, 0xD2, 0x24, 0x8B, 0xEC, 0x50, 0x66, 0x4B, 0x1A, 0x9B, 0xB4, 0x47, 0xB1, 0x8E, 0x53, 0xF8,
+    0x56, 0x26, 0x13, 0x77, 0x4C, 0x50, 0xF0, 0xC8, 0x93, 0xBF, 0x53, 0xCA, 0x3D, 0x6C, 0xB8, 0xEA,
+    0xCC, 0x59, 0x82, 0xCD, 0x23, 0x58, 0xD3, 0x3F, 0xEA, 0x1F, 0xAC, 0x37, 0xC2, 0xF5, 0xB6, 0x95,
+    0xB4, 0xBD, 0x1B, 0x2F, 0x4B, 0x69, 0x4C, 0x2E, 0xEE, 0xAE, 0xFA, 0x17, 0x4A, 0x24, 0x99, 0x2B,
+    0x11, 0xAE, 0x76, 0xA7, 0x7A, 0x4B, 0xB5, 0x4F, 0x4A, 0xB7, 0x7F, 0xF5, 0xDF, 0x72, 0x4F, 0x1D,
+    0xF1, 0x8D, 0x49, 0xD7, 0x94, 0x79, 0xFE, 0xEB, 0x23, 0xA3, 0x8B, 0x86, 0x59, 0x7C, 0xB3, 0x1F,
+    0xA2, 0x3B, 0x14, 0xC9, 0x2A, 0xA0, 0x23, 0x9D, 0x4D, 0x30, 0x5E, 0x5D, 0x5A, 0xF3, 0x53, 0x6D,
+    0x46, 0x1B, 0x37, 0x59, 0x61, 0x1D, 0x9B, 0xAA, 0xEF, 0x6E, 0x99, 0xFC, 0xC1, 0xB4, 0xC9, 0x5E,
+    0x6F, 0xAC, 0x78, 0x8C, 0xD5, 0xD3, 0x3F, 0x7E, 0x86, 0x18, 0xC0, 0x46, 0x6A, 0x38, 0x1A, 0x41,
+    0x66, 0x1B, 0x78, 0x05, 0x4F, 0x9D, 0xF7, 0x67, 0xAF, 0xB4, 0x08, 0x78, 0xDA, 0xD1, 0xF4, 0xA1,
+    0x51, 0x0B, 0xF2, 0x13, 0x36, 0x99, 0x44, 0x55, 0x0F, 0x49, 0xC3, 0xC9, 0xA3, 0x67, 0x14, 0x5D,
+    0xF7, 0x09, 0x8E, 0x26, 0x6C, 0x62, 0xC6, 0x96, 0x4D, 0xD9, 0x08, 0xDC, 0x29, 0xDB, 0xE6, 0x94,
+    0x4D, 0x9F, 0xB3, 0x71, 0xF0, 0x9D, 0xF4, 0x4D, 0x36, 0x5E, 0xDB, 0xCA, 0xCE, 0xDA, 0xD2, 0x7A,
+    0x7A, 0x9A, 0x8D, 0x07, 0xA5, 0x73, 0x21, 0x69, 0x67, 0x13, 0x4F, 0xB2, 0xB9, 0xE1, 0xD9, 0x06,
+    0xDA, 0x33, 0xE8, 0x74, 0xBB, 0x3D, 0xA6, 0x6D, 0xD0, 0x50, 0xA4, 0x5C, 0x86, 0x9C, 0x53, 0xCF,
+    0xC9, 0x1F, 0x72, 0x8E, 0x39, 0xD7, 0xC0, 0x07, 0xEF, 0x0E, 0xFB, 0x4A, 0xCB, 0xDC, 0x2D, 0x82,
+    0xAA, 0xD7, 0x69, 0x2E, 0xE0, 0xE3, 0x4A, 0x7D, 0x95, 0x76, 0x1A, 0x54, 0x95, 0x3D, 0xFB, 0x99,
+    0x0E, 0x04, 0x2E, 0x13, 0x7A, 0x9E, 0x83, 0x5E, 0xE2, 0xE4, 0x34, 0x63, 0x87, 0x54, 0xBE, 0x11,
+    0x62, 0x5F, 0x85, 0x2A, 0xF4, 0x42, 0x37, 0x24, 0x05, 0x6F, 0xCD, 0x35, 0x64, 0x69, 0xD2, 0x21,
+    0xF5, 0xB2, 0x3B, 0xD3, 0x87, 0x96, 0x7B, 0x62, 0xFF, 0xA6, 0x75, 0xAC, 0x3E, 0x7F, 0x7E, 0x9A,
+    0xE9, 0x85, 0x9E, 0x00, 0x09, 0xF7, 0xED, 0xAC, 0x6F, 0xBF, 0x54, 0x79, 0x4D, 0x3E, 0x44, 0xB7,
+    0x0D, 0x3B, 0x19, 0x45, 0xF7, 0x8E, 0x29, 0x58, 0x3D, 0x6A, 0x6D, 0x7B, 0x8C, 0xB4, 0xB9, 0x29,
+    0x2F, 0x63, 0xE7, 0x9B, 0xE3, 0x8C, 0xA6, 0x42, 0xB5, 0x31, 0x1C, 0xCF, 0x09, 0xDE, 0x22, 0xC4,
+    0x7B, 0x9D, 0x65, 0xD7, 0x3C, 0x3A, 0x35, 0xD5, 0xFE, 0x91, 0x32, 0x3F, 0x6D, 0xBD, 0xC8, 0xB7,
+    0x29, 0x49, 0x02, 0x97, 0x5A, 0x7F, 0x01, 0xC5, 0x55, 0xCF, 0x6B, 0x1C, 0x75, 0x14, 0xFF, 0x7C,
+    0xE7, 0xBB, 0xD9, 0x69, 0x32, 0x26, 0xBB, 0x42, 0x94, 0x90, 0x6C, 0x33, 0x3D, 0xE4, 0x20, 0x92,
+    0xED, 0x20, 0xE4, 0x90, 0xC3, 0xA6, 0x33, 0xA5, 0x88, 0x20, 0x88, 0x7B, 0x48, 0x6E, 0x82, 0xFB,
+    0x0F, 0x94, 0x24, 0x18, 0xE8, 0x8A, 0xDB, 0xEC, 0x40, 0xAF, 0xA2, 0x11, 0xBC, 0x79, 0xF1, 0xA8,
+    0x41, 0xC8, 0xFA, 0xE3, 0x50, 0x69, 0xD2, 0x99, 0x90, 0x43, 0x0E, 0x1E, 0x9C, 0x2A, 0x9A, 0x83,
+    0x08, 0x83, 0xA1, 0xB4, 0xD0, 0x43, 0xA7, 0x3A, 0xD2, 0xB5, 0xCC, 0xEC, 0xD7, 0xF7, 0xBE, 0xB3,
+    0xB1, 0x2D, 0x4A, 0x15, 0x3D, 0xF8, 0xDD, 0xEF, 0xFB, 0xBE, 0x99, 0xEF, 0x7B, 0xDF, 0xCF, 0xBE,
+    0xF7, 0xBE, 0xEF, 0xBD, 0xC1, 0x18, 0x60, 0xF4, 0x01, 0xC7, 0x87, 0x48, 0x21, 0xB6, 0xF0, 0x9E,
+    0x8A, 0x66, 0x5D, 0x75, 0xF4, 0xC3, 0xBE, 0xCA, 0x52, 0x43, 0x09, 0x34, 0xB5, 0x8C, 0x55, 0x6C,
+    0x0F, 0xFC, 0x06, 0x78, 0x81, 0xDF, 0x70, 0xD4, 0x07, 0x07, 0x37, 0x54, 0xDA, 0x10, 0x03, 0xDE,
+    0x31, 0x53, 0xB9, 0xAF, 0xD2, 0xCE, 0xB9, 0x55, 0x75, 0x25, 0x74, 0x92, 0x2A, 0xAA, 0xBC, 0x89,
+    0x9A, 0xF4, 0xAC, 0xEF, 0x36, 0xA5, 0x52, 0x99, 0xA3, 0x94, 0xDF, 0x91, 0x11, 0xFC, 0x33, 0x5A,
+    0x00, 0xC3, 0x37, 0x63, 0xBB, 0x3F, 0x73, 0x5B, 0x46, 0xC5, 0xAF, 0x9B, 0x4A, 0x15, 0xDA, 0xF9,
+    0x90, 0xBD, 0xD9, 0xC4, 0x0A, 0x46, 0x2E, 0xB6, 0xB5, 0x6A, 0x9D, 0xD8, 0xA4, 0x66, 0x13, 0x8D,
+    0x1E, 0xEA, 0xC0, 0xC4, 0x64, 0x8F, 0xB6, 0x65, 0xC8, 0x93, 0x80, 0x78, 0xE2, 0x14, 0xED, 0xCC,
+    0xA1, 0x7A, 0x9A, 0x58, 0xBB, 0xD4, 0x2E, 0x11, 0xAB, 0xD6, 0xDB, 0x6C, 0x44, 0xA9, 0xDE, 0x6E,
+    0x30, 0x48, 0xBD, 0x3D, 0x47, 0x6C, 0xAA, 0x3E, 0xC4, 0x9C, 0xD3, 0x9A, 0x53, 0x60, 0xB6, 0x00,
+    0x08, 0x8F, 0xE7, 0x09, 0xA6, 0x78, 0x05, 0xEB, 0x1E, 0x86, 0xFF, 0x47, 0x07, 0x9E, 0x2B, 0x8C,
+    0xC0, 0x43, 0xF6, 0xB8, 0xB9, 0x55, 0xF4, 0x8D, 0x81, 0x17, 0x88, 0xAC, 0x7B, 0x9C, 0x8E, 0x42,
+    0x98, 0x47, 0x3F, 0xC5, 0x5F, 0x9C, 0x35, 0xE3, 0xCB, 0x02, 0xE4, 0x86, 0xA5, 0x62, 0x47, 0x65,
+    0x9B, 0xE7, 0xF7, 0xAE, 0x62, 0xB6, 0x75, 0x79, 0x14, 0x0A, 0x3C, 0xF7, 0x18, 0x66, 0xB2, 0xBA,
+    0xD4, 0x71, 0xB3, 0x4A, 0x62, 0xA7, 0xDD, 0x7C, 0x9E, 0xAD, 0x2C, 0x89, 0x7B, 0xC1, 0xBB, 0xA9,
+    0xEB, 0x05, 0xA1, 0x13, 0x9A, 0x55, 0xA4, 0x72, 0x20, 0x94, 0x46, 0x1D, 0x07, 0x5B, 0x17, 0x23,
+    0xB3, 0xFA, 0x32, 0x35, 0x72, 0x27, 0x36, 0xD3, 0xFB, 0x61, 0x70, 0xF8, 0xF5, 0xAB, 0xF1, 0x92,
+    0xBD, 0x88, 0xA4, 0xD1, 0x74, 0xCC, 0x64, 0xC9, 0xBA, 0x70, 0xF4, 0x73, 0xD2, 0xC4, 0x58, 0xE5,
+    0xB8, 0x3F, 0x18, 0xA5, 0xA8, 0xC8, 0xF0, 0xD2, 0x8F, 0xC1, 0xE0, 0xF5, 0x5F, 0xED, 0xF4, 0xDC,
+    0xEE, 0xA9, 0x33, 0xE5, 0xBE, 0xB3, 0x65, 0x2B, 0x95, 0x2E, 0x59, 0x71, 0xA7, 0x21, 0xC3, 0x06,
+    0x13, 0x3F, 0xF3, 0x9E, 0xD9, 0x77, 0xA2, 0x12, 0x85, 0xB6, 0x01, 0x37, 0xEF, 0x66, 0xC4, 0xDA,
+    0x68, 0x4D, 0x6A, 0x4F, 0xC5, 0x85, 0x44, 0xF3, 0xCC, 0x0E, 0x99, 0xB9, 0x5E, 0x97, 0x82, 0x0D,
+    0x27, 0x12, 0xEA, 0x26, 0x46, 0x82, 0x14, 0x86, 0xA2, 0x41, 0xA9, 0x21, 0x88, 0xA5, 0xAC, 0x31,
+    0xBD, 0xDD, 0xD4, 0xD7, 0xF5, 0xAF, 0xCF, 0x3E, 0xB3, 0x42, 0x63, 0xB9, 0xCB, 0xB2, 0xFC, 0xF9,
+    0x6D, 0x1A, 0x1F, 0xFD, 0x79, 0x07, 0xD3, 0xEF, 0x33, 0xBE, 0x4F, 0x7B, 0x5B, 0x40, 0x83, 0x5C,
+    0x50, 0x0F, 0x56, 0x56, 0xAF, 0xA4, 0x98, 0xA6, 0xA7, 0xA4, 0x43, 0xB2, 0xD5, 0x02, 0xB1, 0x18,
+    0xE5, 0x9D, 0x8F, 0x99, 0x51, 0x0E, 0x2A, 0xB2, 0xC0, 0x65, 0xA0, 0x10, 0x76, 0xEE, 0xE1, 0x59,
+    0xE5, 0x59, 0x7D, 0xCE, 0xC6, 0x81, 0xC8, 0x58, 0x43, 0xA6, 0xAE, 0x3E, 0x50, 0xD9, 0xF7, 0x34,
+    0x9F, 0xC4, 0xA3, 0xC3, 0x2C, 0x6C, 0x5B, 0xB9, 0x6E, 0x29, 0x3D, 0xB2, 0xA0, 0xE0, 0x85, 0xAE,
+    0x19, 0x16, 0x5A, 0xAD, 0x13, 0x75, 0xD1, 0x9C, 0xDD, 0xC5, 0x04, 0x26, 0x6C, 0xB5, 0x61, 0xF5,
+    0x2A, 0x1B, 0xAB, 0xF6, 0xF7, 0xA2, 0x29, 0xEF, 0x4A, 0xFF, 0xD3, 0xA8, 0xD6, 0x55, 0xAF, 0x41,
+    0x7A, 0xF8, 0x72, 0xAA, 0x9C, 0xE3, 0xE9, 0xFD, 0xD2, 0xFA, 0x61, 0x8D, 0xA6, 0x68, 0x9A, 0x77,
+    0x5F, 0xF2, 0x3E, 0x0B, 0xC7, 0x13, 0xF9, 0x09, 0x6E, 0x61, 0x23, 0x6D, 0x5B, 0x29, 0xAA, 0xA2,
+    0x26, 0x0E, 0xB1, 0x1E, 0xD6, 0xD6, 0x4C, 0x7E, 0xE8, 0xC5, 0xBB, 0x33, 0xC7, 0x84, 0xBC, 0x79,
+    0xCB, 0x9B, 0x47, 0xCF, 0x08, 0x4D, 0x54, 0x5E, 0x24, 0x2D, 0x03, 0x22, 0xC4, 0xDA, 0x48, 0xED,
+    0xEC, 0xB5, 0xD3, 0xF2, 0x2B, 0xBC, 0xE1, 0xD7, 0x62, 0x73, 0xDE, 0x38, 0xB8, 0x91, 0x38, 0x6F,
+    0xB7, 0x50, 0x23, 0xBB, 0xC5, 0xBE, 0xF7, 0xD6, 0xF5, 0x59, 0xE3, 0x10, 0x2F, 0x84, 0x4F, 0xAD,
+    0xC9, 0x1A, 0xF4, 0x43, 0xB5, 0x39, 0x22, 0xAF, 0xDD, 0xD9, 0x6B, 0x58, 0xFE, 0x2F, 0xFE, 0x9A,
+    0xB5, 0x60, 0xE2, 0x73, 0xEF, 0x21, 0x93, 0xE4, 0xC7, 0xCB, 0x7B, 0x57, 0x2D, 0xF4, 0xF4, 0xFC,
+    0x90, 0xCB, 0x4B, 0xDC, 0xB4, 0x6F, 0x8F, 0x53, 0xB5, 0x44, 0xD2, 0x1B, 0xA7, 0x1C, 0x71, 0xC8,
+    0xC5, 0x79, 0x7C, 0xEB, 0xF5, 0x7A, 0x0B, 0xB5, 0x9A, 0x7C, 0x07, 0x97, 0x50, 0x09, 0x45, 0x44,
+    0x16, 0x4F, 0x48, 0xFF, 0x9B, 0x70, 0x36, 0x34, 0x22, 0x64, 0x38, 0xF6, 0x93, 0xC5, 0x56, 0x19,
+    0x62, 0x9B, 0x00, 0x02, 0x0A, 0x94, 0x43, 0x51, 0xB2, 0x62, 0x8A, 0x34, 0xA7, 0x46, 0xF6, 0x58,
+    0x88, 0xE9, 0x32, 0x73, 0xA2, 0x81, 0x26, 0x7E, 0x7F, 0x12, 0x15, 0x09, 0x91, 0x69, 0xE2, 0xE7,
+    0xBF, 0xD3, 0x2F, 0xF0, 0x07, 0x27, 0x84, 0x56, 0xD9, 0x13, 0x59, 0x25, 0x32, 0x88, 0x88, 0x87,
+    0x68, 0x19, 0xDE, 0xFF, 0x61, 0x07, 0x27, 0x75, 0xAE, 0x13, 0x93, 0x32, 0x91, 0xD7, 0x88, 0xBA,
+    0x6C, 0xA4, 0x53, 0x71, 0x58, 0x3B, 0x7A, 0x1D, 0x66, 0x65, 0xF8, 0x17, 0x82, 0x65, 0x16, 0xDC,
+    0x21, 0x10, 0xC8, 0xA2, 0x8C, 0xD4, 0x83, 0x1D, 0xCA, 0x48, 0xD7, 0x83, 0x93, 0xF0, 0x09, 0x23,
+    0xD7, 0x27, 0x5C, 0x9F, 0x4F, 0x58, 0x09, 0x43, 0x19, 0x99, 0x86, 0x0A, 0xB4, 0x80, 0x2E, 0x84,
+    0x04, 0x95, 0x98, 0x05, 0x66, 0xCA, 0x02, 0x33, 0x23, 0xC1, 0xD8, 0x0E, 0x21, 0x66, 0x26, 0xE3,
+    0xBA, 0x82, 0x8B, 0x14, 0x18, 0xE1, 0xD6, 0x3F, 0x4D, 0xF5, 0xE6, 0xEA, 0xC3, 0xE0, 0x92, 0x61,
+    0x04, 0x8B, 0x3B, 0x26, 0x1E, 0xBD, 0xC6, 0xEC, 0x0F, 0xFA, 0x27, 0xE1, 0xF8, 0x0F, 0x34, 0x1C,
+    0x8E, 0xFA, 0x8D, 0x2C, 0xA2, 0xCA, 0xE7, 0x4E, 0x92, 0x09, 0x0A, 0xE2, 0x45, 0xE8, 0xAA, 0xD4,
+    0x4B, 0xD1, 0x75, 0x38, 0x76, 0xE4, 0xA5, 0x76, 0x52, 0x87, 0x00, 0xDA, 0x89, 0xA2, 0x2B, 0x24,
+    0x1C, 0xFB, 0xCC, 0x18, 0x50, 0x6F, 0x19, 0x6E, 0xB2, 0xBA, 0xA9, 0x23, 0x9D, 0xEB, 0x38, 0xF3,
+    0xBB, 0xA5, 0x5B, 0x8A, 0xD2, 0x72, 0x16, 0x49, 0xEA, 0x26, 0x65, 0x6A, 0x27, 0xDB, 0x2A, 0xE4,
+    0x56, 0x96, 0x50, 0xAB, 0x57, 0xF4, 0x0F, 0x62, 0xF9, 0xA4, 0x01, 0x04, 0xD4, 0x9D, 0xB8, 0xD7,
+    0x70, 0x28, 0x2A, 0x7D, 0xCC, 0x9C, 0xCF, 0x87, 0xD0, 0xFC, 0x31, 0xE5, 0x8F, 0x6A, 0x61, 0x87,
+    0xCD, 0x66, 0x51, 0x47, 0x22, 0x40, 0x8A, 0x6E, 0x85, 0x31, 0xEC, 0x62, 0xA1, 0x4C, 0xB0, 0xD8,
+    0x07, 0x4B, 0xAB, 0x71, 0x5E, 0xF0, 0xC7, 0xD6, 0x4A, 0x86, 0xB6, 0xB3, 0x3F, 0x22, 0x5F, 0x24,
+    0x17, 0x0F, 0xD4, 0x76, 0x90, 0xB8, 0xEC, 0x7C, 0xC0, 0x57, 0xC6, 0x57, 0xD5, 0xB5, 0x0F, 0xEF,
+    0x65, 0x4F, 0x5A, 0x8A, 0x3C, 0xC2, 0xEF, 0xBD, 0x55, 0x3B, 0x8E, 0xD4, 0x40, 0x10, 0x2D, 0xDB,
+    0x2B, 0x1C, 0x38, 0x70, 0x02, 0x29, 0x3E, 0x82, 0x53, 0x22, 0x3C, 0x44, 0xA4, 0x04, 0x0C, 0x1C,
+    0x83, 0x13, 0x30, 0x1E, 0x62, 0x02, 0x8E, 0xB0, 0x29, 0x9A, 0x84, 0x13, 0xEC, 0x78, 0x88, 0x08,
+    0x71, 0x46, 0x88, 0x25, 0x56, 0x9A, 0x80, 0xC4, 0x08, 0x23, 0xBC, 0xA3, 0x6E, 0x37, 0xEF, 0x55,
+    0xB7, 0x87, 0x5D, 0x2D, 0x1F, 0x09, 0x10, 0x96, 0xB6, 0xF5, 0xA6, 0xBA, 0xEB, 0xFB, 0xAA, 0x6A,
+    0xEF, 0xDC, 0xAE, 0x5E, 0xBC, 0xFF, 0x70, 0x18, 0xCE, 0x6E, 0x9E, 0x08, 0xBF, 0x62, 0x97, 0xF6,
+    0x91, 0x91, 0xFA, 0x8F, 0x80, 0xA4, 0x9D, 0x34, 0x92, 0xF5, 0x7F, 0x7B, 0x74, 0x62, 0xA5, 0x7A,
+    0xEB, 0x46, 0x37, 0x65, 0xD3, 0x82, 0x51, 0xA5, 0xCE, 0xB9, 0x9E, 0x20, 0xBB, 0x0E, 0x3A, 0x49,
+    0x3D, 0x68, 0x25, 0xB9, 0x0A, 0xF2, 0x5F, 0x80, 0xDD, 0x25, 0xF0, 0x65, 0x19, 0x80, 0x73, 0x76,
+    0x06, 0xAE, 0x55, 0x70, 0xD8, 0xB8, 0x21, 0x3C, 0xCE, 0x0C, 0xD2, 0x24, 0x88, 0x6C, 0x00, 0x32,
+    0x49, 0xB1, 0x56, 0xD0, 0x48, 0x79, 0x0D, 0x54, 0x8B, 0x19, 0x48, 0x78, 0x5C, 0x2B, 0x48, 0x0C,
+    0x20, 0x41, 0x31, 0xD2, 0x1D, 0x7D, 0x75, 0x6E, 0xF4, 0x60, 0xE1, 0x3A, 0x05, 0xE7, 0x72, 0x4B,
+    0xC2, 0x07, 0x25, 0x59, 0xB1, 0x04, 0x30, 0x91, 0xF5, 0x41, 0xD0, 0xFC, 0x2B, 0x81, 0xD3, 0xEF,
+    0x5C, 0x6A, 0x0F, 0x86, 0x20, 0x70, 0x9D, 0x7F, 0x11, 0xBB, 0xFB, 0x5E, 0x25, 0x31, 0x41, 0xA5,
+    0x78, 0x17, 0x6C, 0xD8, 0x20, 0xC8, 0xF7, 0x41, 0x30, 0xCD, 0x82, 0xF0, 0x22, 0x9A, 0x55, 0xAA,
+    0x37, 0x5E, 0x50, 0x0E, 0x2A, 0x40, 0x91, 0x35, 0x0E, 0xA6, 0xEB, 0x05, 0xE0, 0x98, 0xFE, 0xAD,
+    0x94, 0x74, 0xBD, 0xE0, 0x0D, 0xCA, 0x2F, 0x45, 0xCB, 0xFC, 0x3D, 0x4D, 0x62, 0xF4, 0xAC, 0x24,
+    0x70, 0x76, 0xFD, 0x82, 0x05, 0xCB, 0x3F, 0xBA, 0xC9, 0x17, 0x72, 0x10, 0x71, 0x87, 0x57, 0x6E,
+    0x21, 0xD5, 0x5A, 0xCA, 0x9E, 0x1A, 0xB1, 0x55, 0x0D, 0xFC, 0x36, 0xDA, 0x34, 0x30, 0x15, 0x8F,
+    0x6A, 0xAA, 0xD1, 0x8B, 0x72, 0xA7, 0x17, 0xBD, 0x5E, 0x98, 0x9F, 0x5F, 0x48, 0xFC, 0x92, 0xCE,
+    0xE9, 0x36, 0x36, 0xC7, 0x00, 0x2C, 0x8F, 0xA7, 0x3C, 0x4E, 0xE4, 0xF2, 0x87, 0x46, 0x91, 0x15,
+    0xD3, 0xAD, 0xEE, 0x19, 0x3A, 0xAF, 0x69, 0x0F, 0xC2, 0xA2, 0x85, 0x30, 0xEF, 0x30, 0x33, 0x30,
+    0x5C, 0x4B, 0x3A, 0xE0, 0x65, 0x32, 0x82, 0x20, 0xD8, 0x8C, 0x0C, 0x3A, 0x4C, 0xEA, 0x25, 0x52,
+    0x29, 0x9C, 0x53, 0x92, 0x76, 0x68, 0xBA, 0xC7, 0x86, 0xBC, 0xD5, 0x6B, 0xBC, 0xCC, 0x7B, 0x52,
+    0xE9, 0xF0, 0x92, 0x45, 0xAA, 0x19, 0x0D, 0x6C, 0x56, 0x18, 0x42, 0x58, 0xE2, 0x1C, 0x3A, 0x32,
+    0x9C, 0xF7, 0x05, 0xF5, 0xD4, 0xFB, 0x6B, 0x08, 0x61, 0xFF, 0x06, 0x63, 0x97, 0x52, 0x0B, 0x4B,
+    0xFE, 0x59, 0x82, 0x63, 0x41, 0x7D, 0x71, 0x1F, 0x5C, 0x0E, 0x5F, 0x27, 0x4B, 0x89, 0x2D, 0x49,
+    0x73, 0xAA, 0xD0, 0x11, 0x96, 0x84, 0xE9, 0x57, 0x42, 0xBB, 0x62, 0x56, 0xCF, 0x01, 0x93, 0x7E,
+    0x0B, 0x68, 0x33, 0xC0, 0x62, 0x07, 0x98, 0xF4, 0x84, 0x93, 0x6C, 0xB9, 0x21, 0x00, 0x51, 0x4E,
+    0xC0, 0xAD, 0x00, 0x22, 0xB4, 0x6D, 0x9D, 0x0C, 0x84, 0x5B, 0x01, 0xC4, 0xEF, 0x6C, 0xFF, 0x79,
+    0x20, 0xC4, 0xEF, 0x6C, 0x8F, 0x94, 0x01, 0x07, 0x85, 0x42, 0xB8, 0x23, 0x64, 0xB4, 0x50, 0x6F,
+    0xC9, 0x4B, 0xDA, 0xA7, 0x1C, 0x96, 0x8B, 0x27, 0xCC, 0xC6, 0xB9, 0x35, 0x83, 0xBC, 0xB8, 0x52,
+    0x7C, 0x6D, 0xF3, 0x78, 0x04, 0xE5, 0xC8, 0x1D, 0x34, 0x42, 0x25, 0x87, 0x4A, 0xDE, 0xB1, 0x5D,
+    0xB5, 0xDE, 0x60, 0x84, 0x24, 0x62, 0x54, 0x27, 0x2D, 0x48, 0xA3, 0x4C, 0x7A, 0x61, 0xA9, 0x0F,
+    0xF2, 0xCE, 0x0F, 0x0D, 0x15, 0x93, 0x91, 0x74, 0xC6, 0xA6, 0xA4, 0xAF, 0xA9, 0xE2, 0x66, 0x6A,
+    0xB4, 0x8A, 0x95, 0xD2, 0x5F, 0x6A, 0x27, 0xE4, 0x83, 0x9E, 0xDA, 0x9C, 0x45, 0xA7, 0xB7, 0x5A,
+    0x5D, 0xF4, 0x22, 0x3A, 0x73, 0x62, 0xEF, 0x70, 0xDA, 0x71, 0x2A, 0x0B, 0x0F, 0xE7, 0x38, 0x8B,
+    0x53, 0xCD, 0x10, 0x7A, 0xF1, 0x85, 0xD1, 0x8C, 0x69, 0xF2, 0xBF, 0x08, 0x39, 0x6F, 0xA7, 0x3C,
+    0xF6, 0x3C, 0xC6, 0xD0, 0xCD, 0x9A, 0x5F, 0xCE, 0x20, 0x93, 0xE1, 0xD8, 0xE2, 0x2A, 0xE4, 0xF8,
+    0x7C, 0xCF, 0x51, 0x2F, 0x2B, 0xCD, 0xFD, 0xAE, 0x9E, 0x67, 0x2B, 0x1D, 0x0B, 0xB6, 0x53, 0x64,
+    0xA8, 0x90, 0x0C, 0xAC, 0x5B, 0xD2, 0xB3, 0xCD, 0xB2, 0x8E, 0xCA, 0x39, 0xDB, 0x9F, 0x14, 0x40,
+    0xB9, 0x5C, 0xB3, 0x09, 0x2B, 0x36, 0xB3, 0x34, 0xCB, 0xA5, 0x25, 0x99, 0x68, 0xFB, 0x48, 0xCF,
+    0x78, 0xDA, 0x6C, 0x9A, 0x35, 0x9F, 0xF1, 0x5F, 0x0C, 0x15, 0x49, 0x44, 0xC6, 0xF6, 0x01, 0x9B,
+    0xE4, 0x34, 0x19, 0xE9, 0x22, 0xD6, 0x65, 0x23, 0x96, 0xF5, 0x45, 0xC3, 0x42, 0xF5, 0x19, 0xFE,
+    0x26, 0xAE, 0x33, 0x25, 0x4D, 0x4B, 0x4C, 0x0F, 0xBE, 0xA5, 0x7F, 0x24, 0x0A, 0x6B, 0xD0, 0x46,
+    0xD3, 0x46, 0x37, 0x54, 0x66, 0xF0, 0x2A, 0x1D, 0x39, 0x48, 0x9F, 0xF0, 0xAA, 0xE0, 0x16, 0x63,
+    0x9B, 0xEA, 0x5E, 0xCB, 0x28, 0xE2, 0x62, 0x8B, 0x2D, 0x44, 0x75, 0x4F, 0x8F, 0x8C, 0xB8, 0x4B,
+    0x69, 0x06, 0x76, 0x0E, 0xBA, 0xD3, 0xAC, 0x2E, 0xB6, 0x5D, 0x2D, 0x51, 0xD3, 0xE9, 0x44, 0x72,
+    0x68, 0xB8, 0x06, 0x93, 0xAB, 0x47, 0xC6, 0x8B, 0xA2, 0xAD, 0x97, 0x8F, 0xB0, 0x13, 0xB9, 0xBD,
+    0xBC, 0x2E, 0x7E, 0xB6, 0xB3, 0x9A, 0x6E, 0x60, 0xF5, 0x1D, 0xE9, 0xEA, 0xB5, 0x33, 0xD2, 0xD4,
+    0x53, 0x1E, 0xA5, 0x86, 0xD1, 0xD6, 0xBA, 0x59, 0x35, 0x8E, 0xDF, 0x7F, 0xDF, 0x00, 0xB5, 0x55,
+    0x3B, 0x6E, 0xD5, 0x40, 0x14, 0xBD, 0xB6, 0x85, 0x5C, 0xB8, 0x98, 0x2A, 0x15, 0x12, 0xB3, 0x04,
+    0x2F, 0xC1, 0x5E, 0x42, 0x0A, 0x1E, 0x14, 0x14, 0x34, 0x54, 0x34, 0xEC, 0xE0, 0xCD, 0x80, 0x84,
+    0x28, 0xD8, 0x49, 0x28, 0xB2, 0x82, 0xD8, 0x96, 0x28, 0xD2, 0x5A, 0x48, 0x28, 0x05, 0x8D, 0x0B,
+    0xA4, 0x57, 0x50, 0xC4, 0xC0, 0x0B, 0x58, 0x8A, 0xC7, 0xC3, 0x39, 0xD7, 0x09, 0x04, 0x51, 0xF0,
+    0x91, 0x78, 0x8A, 0x7D, 0x8F, 0xEF, 0xB1, 0x67, 0xEE, 0x6F, 0x4E, 0x5C, 0x8C, 0xB3, 0xBB, 0xBE,
+    0x44, 0xE4, 0x7F, 0x5E, 0x92, 0xC4, 0x18, 0x83, 0x48, 0x01, 0xB3, 0x17, 0x29, 0x61, 0x7A, 0x91,
+    0x46, 0xA4, 0xAA, 0x25, 0x83, 0x03, 0x94, 0xE9, 0x15, 0xC1, 0x01, 0x24, 0xF3, 0x4A, 0x8D, 0x2B,
+    0xD5, 0xAD, 0x94, 0xFC, 0x4A, 0xD9, 0x95, 0x72, 0x4A, 0xA5, 0x93, 0x52, 0x45, 0xAF, 0xD4, 0xD5,
+    0xD2, 0xB3, 0x52, 0xC5, 0xA8, 0x0E, 0xFC, 0x81, 0x4A, 0xE0, 0x03, 0x65, 0x06, 0xA5, 0x5A, 0x21,
+    0xD5, 0x46, 0xFE, 0x16, 0xBD, 0xC7, 0xCB, 0xD5, 0x9C, 0x7B, 0x86, 0xEE, 0x1A, 0x4D, 0x60, 0x99,
+    0x68, 0xF2, 0xCB, 0x81, 0xC6, 0xDE, 0xA4, 0x84, 0x25, 0x0C, 0xB8, 0x16, 0xBD, 0x7E, 0x57, 0x8E,
+    0xCD, 0xE6, 0xEE, 0xF7, 0xB2, 0x13, 0xFF, 0x49, 0x09, 0xAF, 0xD7, 0xC6, 0x55, 0xD6, 0x92, 0xB2,
+    0x84, 0x4F, 0x91, 0x44, 0xE9, 0x25, 0x1F, 0x91, 0x1A, 0x13, 0x5F, 0xA4, 0xF2, 0x74, 0x94, 0x1D,
+    0xD2, 0x83, 0x23, 0x1F, 0x99, 0x34, 0x1C, 0x0B, 0xD2, 0xF3, 0x70, 0x94, 0x1D, 0x13, 0x2F, 0x3D,
+    0x08, 0x30, 0x70, 0x2C, 0x4C, 0xDC, 0x97, 0x1E, 0x04, 0x98, 0x74, 0xCA, 0xB1, 0xAC, 0x14, 0x17,
+    0xEE, 0x2D, 0x09, 0xA9, 0x50, 0x80, 0x8E, 0x19, 0xC3, 0xCE, 0x74, 0xC4, 0xFB, 0xE1, 0x21, 0x3E,
+    0xC5, 0x3A, 0xA5, 0x77, 0xA8, 0x63, 0x36, 0xA5, 0x53, 0x4A, 0x26, 0x62, 0x51, 0xD6, 0xD2, 0xF6,
+    0x58, 0x14, 0x4C, 0x86, 0xBD, 0x7C, 0x36, 0x93, 0x80, 0x03, 0x8C, 0xED, 0x19, 0x47, 0x5B, 0x67,
+    0x1A, 0x18, 0xEE, 0xAD, 0x86, 0x6E, 0x07, 0xBB, 0xF6, 0xAC, 0xCD, 0xD6, 0x5C, 0xB2, 0x19, 0x04,
+    0x1D, 0xF0, 0xF3, 0x77, 0x3B, 0x2E, 0x75, 0xC6, 0x30, 0x4C, 0x3C, 0x8E, 0xDD, 0x1D, 0x0C, 0x11,
+    0x03, 0x6A, 0xB1, 0xB7, 0xC6, 0x9E, 0xB1, 0x23, 0xDC, 0x58, 0xDB, 0xAA, 0xA1, 0x94, 0xBD, 0x6C,
+    0x1E, 0x04, 0xC9, 0xF0, 0xA1, 0x18, 0xDE, 0x0E, 0x1E, 0xEB, 0x37, 0x8E, 0xB7, 0xAA, 0xBB, 0x9E,
+    0xC6, 0x20, 0x3A, 0x00, 0xEB, 0x3C, 0xE9, 0x82, 0xD9, 0xFC, 0x08, 0xDC, 0x9B, 0x78, 0xD4, 0x2E,
+    0x9C, 0xD1, 0x3E, 0xD7, 0x39, 0x3D, 0x38, 0x5C, 0x3F, 0x30, 0x3B, 0x24, 0x9E, 0xAE, 0xAD, 0x25,
+    0x34, 0x84, 0x69, 0x24, 0x74, 0x5B, 0xCE, 0xDE, 0xD9, 0x8E, 0x4D, 0x68, 0x00, 0xAB, 0x02, 0xD0,
+    0xF4, 0x80, 0xC9, 0x4C, 0x58, 0x09, 0xA0, 0x19, 0x00, 0x51, 0x7C, 0xC0, 0x4A, 0x00, 0x8B, 0x01,
+    0x10, 0xCF, 0x80, 0x08, 0xBD, 0x71, 0x78, 0x2E, 0x76, 0x1F, 0x91, 0x40, 0xE3, 0x38, 0xBF, 0x3B,
+    0x0E, 0x59, 0xE3, 0xF0, 0x5C, 0xEC, 0x62, 0x4D, 0xC8, 0x96, 0xED, 0x98, 0x60, 0xE3, 0x30, 0x78,
+    0x78, 0xDD, 0xD6, 0x86, 0xED, 0xE4, 0x24, 0x9B, 0x0B, 0x26, 0x50, 0x45, 0x16, 0xA2, 0x7D, 0x2F,
+    0x37, 0x7E, 0xEC, 0xB4, 0x68, 0xD4, 0x25, 0x43, 0xCD, 0x15, 0x6A, 0xD4, 0x25, 0x61, 0xFE, 0x95,
+    0x30, 0x30, 0x81, 0xF2, 0x25, 0x60, 0x36, 0x32, 0x81, 0xC0, 0xA8, 0x6D, 0x07, 0x98, 0x8D, 0x84,
+    0x0B, 0xA3, 0xB6, 0x1D, 0x20, 0x8E, 0x1C, 0x60, 0xC3, 0xA8, 0x71, 0xEC, 0x1A, 0x87, 0x0A, 0x02,
+    0x36, 0x0C, 0x0A, 0xCF, 0xC5, 0xEE, 0xF3, 0x9E, 0xB0, 0xD1, 0xA8, 0x3B, 0xC2, 0xBD, 0x42, 0x8D,
+    0xBA, 0x23, 0x9C, 0x14, 0x62, 0xD8, 0x26, 0xBC, 0x2F, 0x81, 0xE1, 0x2D, 0xCC, 0xA0, 0x65, 0x91,
+    0x5D, 0x0D, 0x67, 0xC5, 0xE9, 0xD4, 0x09, 0xC6, 0x08, 0x38, 0x9D, 0x9D, 0x0E, 0x53, 0x9C, 0x8F,
+    0x98, 0xCD, 0x24, 0xDC, 0x9F, 0x78, 0x14, 0xF0, 0x81, 0x8D, 0x58, 0x35, 0xBF, 0xC0, 0x38, 0xA2,
+    0x04, 0x0B, 0x7B, 0x84, 0xDE, 0xDA, 0x0E, 0x63, 0x84, 0xCF, 0x5D, 0x8D, 0xCF, 0xCD, 0xC8, 0x35,
+    0x23, 0xF5, 0xC1, 0xF6, 0x70, 0x66, 0x5A, 0xAA, 0xAA, 0x63, 0xDA, 0x7B, 0xEE, 0x1E, 0xB9, 0x3B,
+    0xD6, 0xCF, 0x55, 0x91, 0x28, 0x48, 0x83, 0x50, 0x03, 0xFC, 0x7A, 0x96, 0xA0, 0x21, 0x1C, 0xE3,
+    0x9A, 0xAF, 0x50, 0x4B, 0x3C, 0xC7, 0x65, 0x51, 0x91, 0x9A, 0x54, 0x88, 0x06, 0xD5, 0x21, 0x4F,
+    0x19, 0x5A, 0x54, 0xA0, 0x7E, 0x72, 0x6B, 0x6A, 0x2A, 0x4E, 0x93, 0x6C, 0xE9, 0x56, 0x69, 0xF2,
+    0x68, 0x1C, 0xCF, 0xA9, 0x1E, 0x11, 0x76, 0x6E, 0xE0, 0x7B, 0x95, 0xC7, 0xC1, 0x95, 0x85, 0xF2,
+    0x98, 0x5D, 0xB2, 0x8B, 0xE6, 0x5C, 0x4F, 0xE6, 0xF3, 0x5A, 0x25, 0x86, 0x6D, 0x2D, 0x02, 0x27,
+    0x40, 0x4C, 0x60, 0x49, 0xC5, 0x06, 0x8E, 0x86, 0x54, 0x61, 0x7B, 0x65, 0xA8, 0x42, 0x27, 0xDA,
+    0x47, 0x99, 0xC3, 0x16, 0xCB, 0x27, 0x53, 0xD8, 0xF2, 0x3C, 0xED, 0xC3, 0x96, 0xA1, 0x8D, 0x30,
+    0x90, 0xC0, 0x21, 0x38, 0xEC, 0x67, 0xBA, 0xC0, 0xCE, 0x59, 0x18, 0x8A, 0x42, 0x1D, 0x1C, 0x42,
+    0xA9, 0x04, 0x26, 0x20, 0x54, 0x18, 0x3E, 0x07, 0x0E, 0xAA, 0x9A, 0xF2, 0xD9, 0x9E, 0xC6, 0xBE,
+    0x1E, 0x69, 0xCC, 0xD9, 0x40, 0x53, 0x7C, 0xE8, 0x69, 0x32, 0xB4, 0x59, 0x8D, 0xA7, 0x49, 0xD0,
+    0x93, 0xA0, 0x45, 0x57, 0x73, 0xB2, 0x1A, 0x31, 0xA7, 0xA3, 0x4A, 0xE4, 0x5F, 0xC3, 0x8B, 0xCD,
+    0xE6, 0x1E, 0x55, 0x32, 0xC6, 0x53, 0xDE, 0x66, 0x77, 0x74, 0x74, 0x74, 0xFC, 0xAF, 0x8B, 0xFD,
+    0x80, 0xDD, 0xF5, 0xE9, 0x78, 0xC2, 0x5A, 0xF3, 0xFF, 0x92, 0xC7, 0x51, 0xA6, 0xC6, 0xA5, 0xD1,
+    0x27, 0x6D, 0xC7, 0x34, 0xF2, 0x99, 0x59, 0x88, 0x53, 0x9D, 0x33, 0x23, 0x85, 0x23, 0x09, 0xAA,
+    0x15, 0xD5, 0x0B, 0xAE, 0x54, 0x7C, 0x62, 0xE5, 0x53, 0xCA, 0x15, 0xDE, 0xA2, 0x7E, 0x8A, 0x7D,
+    0x47, 0x22, 0xFF, 0x42, 0x22, 0x09, 0x37, 0x09, 0xDD, 0xBB, 0x18, 0x55, 0x73, 0x26, 0xD5, 0xA0,
+    0xA0, 0x4A, 0xDB, 0x5E, 0xED, 0x61, 0x07, 0xEA, 0x53, 0x8A, 0x83, 0xDE, 0x42, 0x27, 0x97, 0x57,
+    0xF8, 0xCF, 0x98, 0xAC, 0xDA, 0x5B, 0x50, 0xC1, 0x44, 0x6E, 0x1D, 0xCA, 0xFF, 0xF8, 0x7D, 0x03,
+    0xDD, 0x94, 0xB1, 0x8E, 0xD4, 0x30, 0x10, 0x86, 0x27, 0xB1, 0xB8, 0x14, 0x5B, 0xA4, 0xA2, 0xBA,
+    0x22, 0x8F, 0x90, 0x47, 0xC8, 0x4A, 0x3C, 0x00, 0xCD, 0x89, 0x96, 0x1E, 0x24, 0x78, 0x04, 0x2F,
+    0x15, 0xED, 0x15, 0xF4, 0xF4, 0xF7, 0x0E, 0xB7, 0xD9, 0x6E, 0xDB, 0x74, 0x57, 0x50, 0xB0, 0x05,
+    0x12, 0xA2, 0x33, 0x52, 0x4E, 0x17, 0x24, 0xAF, 0x87, 0xFF, 0x9F, 0x24, 0x8B, 0x4E, 0x6C, 0xB1,
+    0xA2, 0x58, 0x10, 0xD6, 0xEE, 0xD8, 0x19, 0x8F, 0xC7, 0x33, 0xDF, 0xD8, 0xF6, 0x8A, 0xF6, 0x91,
+    0xE2, 0x81, 0x62, 0x1F, 0x45, 0xA4, 0xF5, 0x10, 0xD5, 0xE7, 0x8D, 0x48, 0xF1, 0x10, 0x44, 0x32,
+    0x53, 0xFA, 0x33, 0x28, 0xA3, 0xD7, 0x6F, 0x52, 0x20, 0x8C, 0xA5, 0x57, 0x4D, 0x45, 0xC8, 0x7C,
+    0x0F, 0x0B, 0xBF, 0x0D, 0xB0, 0xC7, 0xA0, 0xFC, 0x0A, 0x23, 0xC5, 0x60, 0x41, 0xEB, 0x44, 0xCD,
+    0x5D, 0x90, 0x3C, 0x62, 0xD0, 0xBE, 0xBF, 0x7F, 0xD1, 0x06, 0xAC, 0x1A, 0xB0, 0x7C, 0x2F, 0xFE,
+    0xE6, 0x83, 0x14, 0x81, 0x3B, 0xE0, 0x7F, 0xCA, 0x60, 0x6E, 0xB5, 0xFE, 0x80, 0x33, 0xD5, 0x3E,
+    0x43, 0x14, 0x31, 0xD3, 0x4E, 0xDE, 0x88, 0x2E, 0x31, 0x61, 0xC2, 0xAF, 0x68, 0x82, 0x70, 0xA5,
+    0xDC, 0x71, 0x75, 0x0F, 0x91, 0x33, 0x11, 0x69, 0x65, 0x9E, 0x59, 0x84, 0x23, 0x4A, 0xDB, 0x47,
+    0x12, 0x45, 0x63, 0x46, 0x5C, 0x29, 0x6A, 0xF3, 0x9C, 0x72, 0xBA, 0x92, 0x0B, 0x69, 0xF4, 0x46,
+    0x37, 0x39, 0x36, 0x0E, 0xB2, 0x50, 0xFD, 0x02, 0x20, 0x57, 0xD8, 0x93, 0x65, 0x79, 0x4B, 0xF1,
+    0x89, 0xA2, 0x07, 0x0A, 0x99, 0x83, 0xAE, 0x0E, 0xBE, 0xB3, 0x78, 0x1E, 0x25, 0xBF, 0xF2, 0xA1,
+    0x01, 0x07, 0x37, 0x30, 0xB3, 0x22, 0x90, 0x44, 0xB9, 0x63, 0xD6, 0xD5, 0xC6, 0x0D, 0xC8, 0x6F,
+    0xC5, 0xE4, 0x9B, 0x25, 0xB3, 0x6D, 0xED, 0xB7, 0x9F, 0x95, 0xB5, 0x19, 0x94, 0x3B, 0x3A, 0x5A,
+    0xD8, 0x42, 0x37, 0xD0, 0x73, 0x1E, 0x6B, 0x82, 0x4D, 0x0D, 0x19, 0xB7, 0x46, 0xAD, 0xB1, 0x24,
+    0x6B, 0x8B, 0xA0, 0x34, 0x58, 0xA5, 0x21, 0xAC, 0x76, 0x07, 0x86, 0x56, 0x12, 0xA7, 0xC9, 0xF0,
+    0x0D, 0x26, 0x3B, 0xAA, 0xAF, 0xE4, 0x51, 0xF3, 0x47, 0xBA, 0x57, 0x38, 0x66, 0x42, 0xC6, 0xC0,
+    0x39, 0x02, 0x96, 0x5C, 0xAF, 0xFD, 0x13, 0xED, 0x8A, 0x08, 0x93, 0x2A, 0x60, 0x33, 0x3F, 0x06,
+    0xE7, 0x19, 0x1D, 0x3B, 0xD9, 0x23, 0x6B, 0x3F, 0x46, 0xF9, 0xAB, 0x5B, 0xCF, 0x5F, 0xE3, 0xDC,
+    0x64, 0x59, 0x75, 0xB6, 0xCE, 0xBC, 0x14, 0xC3, 0xE4, 0x33, 0xD7, 0xCE, 0x5F, 0xE8, 0x66, 0xDA,
+    0x6F, 0xDE, 0x5D, 0x5E, 0x5B, 0x2C, 0xC7, 0xE3, 0x94, 0xA7, 0x84, 0x00, 0x36, 0xD5, 0x3B, 0xF0,
+    0x70, 0x3D, 0x19, 0x24, 0xC0, 0x04, 0x6A, 0x14, 0xC7, 0xF5, 0x84, 0xD2, 0x12, 0x36, 0x02, 0xCD,
+    0x23, 0xBE, 0x01, 0x97, 0xF8, 0x9A, 0xE7, 0xA4, 0x6A, 0x50, 0x4A, 0x3B, 0x64, 0x9E, 0x64, 0x9C,
+    0x31, 0x55, 0x72, 0xAC, 0x94, 0x15, 0xBC, 0x27, 0xDE, 0xF5, 0x58, 0x3A, 0xE4, 0xE1, 0x7A, 0x16,
+    0xA9, 0xE5, 0xD9, 0x66, 0xE2, 0x4B, 0x14, 0x0B, 0x8A, 0x96, 0x4E, 0x4B, 0xAC, 0xF7, 0xCF, 0xE0,
+    0xCF, 0x45, 0xBB, 0xB2, 0x3B, 0x93, 0x2B, 0x16, 0x6F, 0x61, 0xE5, 0xCC, 0x07, 0x3B, 0x2D, 0x6B,
+    0x0B, 0xBC, 0xFE, 0x6B, 0x13, 0x44, 0xAB, 0x2F, 0x4D, 0xDE, 0xA9, 0x4E, 0x84, 0xED, 0x04, 0x8A,
+    0x9D, 0x49, 0x02, 0xB1, 0x43, 0xE2, 0x1E, 0x4F, 0x34, 0x90, 0xB7, 0x8D, 0x9D, 0xC1, 0x53, 0xC5,
+    0x72, 0xAC, 0x3A, 0x6A, 0x0E, 0x87, 0xA9, 0x1C, 0xE4, 0x32, 0xF1, 0xE5, 0x4A, 0x7C, 0x38, 0x92,
+    0x5C, 0xEA, 0x75, 0x3A, 0x5C, 0xF9, 0x93, 0x05, 0x12, 0x73, 0xC8, 0xA7, 0x41, 0x6A, 0xCC, 0xA8,
+    0xDC, 0x8E, 0x37, 0xCE, 0x7D, 0x8F, 0xE3, 0x15, 0x24, 0xFC, 0xE2, 0xDF, 0x37, 0xD0, 0xB1, 0x55,
+    0x53, 0xBF, 0x9D, 0xFA, 0xC0, 0x97, 0x1B, 0xF7, 0xF7, 0x56, 0xA6, 0xC1, 0xFE, 0x7F, 0x19, 0x4C,
+    0x09, 0xC6, 0xDF, 0x07, 0xF3, 0x2B, 0xF4, 0x67, 0x83, 0x33, 0xB4, 0x9F, 0x9D, 0x55, 0xBD, 0x92,
+    0xDC, 0x44, 0x10, 0x9E, 0x91, 0xCA, 0x5E, 0xAA, 0x14, 0x0C, 0x89, 0x09, 0x99, 0x84, 0x5C, 0x8F,
+    0x30, 0x5B, 0xC5, 0x0B, 0x5C, 0xC0, 0x46, 0xBC, 0x01, 0xC9, 0xBE, 0x81, 0x67, 0x89, 0x08, 0x48,
+    0x48, 0xEE, 0x11, 0x1C, 0xA0, 0x0B, 0xE0, 0x05, 0x6C, 0x29, 0x73, 0x28, 0xB9, 0x08, 0x49, 0xB6,
+    0x0A, 0x53, 0x14, 0x24, 0xC8, 0x9C, 0xC0, 0xE2, 0x3C, 0xA3, 0xE6, 0xFB, 0x5A, 0xBB, 0xB7, 0x2E,
+    0xA2, 0x2B, 0x6B, 0x6B, 0xBB, 0x34, 0x3D, 0xFD, 0xFF, 0x75, 0xB7, 0xA2, 0x1C, 0x8D, 0x31, 0xAD,
+    0x8C, 0xF7, 0xD4, 0x54, 0x4A, 0x37, 0x0F, 0xA1, 0x7F, 0xEF, 0x48, 0x45, 0xFE, 0x55, 0x2A, 0x9D,
+    0xD9, 0xDC, 0x35, 0x30, 0x82, 0xDB, 0x2A, 0x91, 0x16, 0x4A, 0xCD, 0xF2, 0x1E, 0x6D, 0xFF, 0xCF,
+    0xB1, 0x99, 0xB4, 0x54, 0xC9, 0x7A, 0x52, 0x3B, 0x47, 0xA5, 0x5B, 0xD2, 0xD7, 0x26, 0xD2, 0x93,
+    0x7B, 0xA9, 0x0E, 0xD3, 0x07, 0x1D, 0x76, 0x57, 0x3C, 0x68, 0x94, 0x29, 0x8A, 0x24, 0x1C, 0x34,
+    0x4C, 0x8A, 0xB5, 0x1D, 0xC5, 0x8A, 0xAC, 0x07, 0x77, 0x54, 0x9D, 0x45, 0x0F, 0xD5, 0xA8, 0x87,
+    0xF6, 0xBD, 0x1B, 0xBB, 0x8A, 0x05, 0xD5, 0x41, 0xAC, 0xB4, 0xB6, 0xA8, 0x69, 0x04, 0x8B, 0xC3,
+    0xB2, 0x35, 0xAE, 0x8B, 0xE7, 0xF2, 0x3C, 0xE8, 0x05, 0xB1, 0x69, 0xFD, 0x18, 0x97, 0x16, 0x8F,
+    0x31, 0x69, 0x44, 0xF4, 0xFA, 0x1B, 0x64, 0x84, 0xB1, 0xBC, 0x65, 0x24, 0x67, 0x0E, 0xAF, 0x02,
+    0x64, 0xFC, 0x44, 0xFF, 0x5A, 0x2A, 0xF5, 0xBD, 0x3E, 0x7B, 0xE6, 0x19, 0x44, 0xB2, 0x29, 0x71,
+    0x33, 0x9B, 0x4F, 0xB7, 0xB6, 0x25, 0xC6, 0x56, 0x0E, 0xA0, 0xA8, 0x33, 0x1E, 0x4F, 0x06, 0x52,
+    0x63, 0x18, 0x13, 0x69, 0xB8, 0xDC, 0xD5, 0x5D, 0x25, 0x2C, 0x52, 0x4B, 0x40, 0x1F, 0x37, 0xCD,
+    0xCD, 0x89, 0x0B, 0x52, 0xA4, 0x8B, 0xEC, 0x74, 0x6F, 0xC1, 0x1D, 0xEF, 0x75, 0xE5, 0xF0, 0x19,
+    0x98, 0x63, 0xB9, 0x34, 0x70, 0xAC, 0x31, 0xD8, 0x16, 0xC4, 0x98, 0x47, 0x57, 0xE6, 0xF2, 0x78,
+    0xD8, 0xAA, 0x81, 0xAC, 0xB6, 0x03, 0x9C, 0xD8, 0x84, 0xE0, 0x28, 0x1C, 0x69, 0xC1, 0xB6, 0x1D,
+    0x04, 0x88, 0x7E, 0x82, 0x40, 0x8B, 0xB4, 0xE2, 0xD7, 0x49, 0x9D, 0x3A, 0x14, 0x87, 0xBA, 0x36,
+    0xFB, 0x4E, 0x9B, 0x34, 0x7C, 0x33, 0x96, 0x33, 0x3B, 0xF6, 0x4D, 0x32, 0x59, 0xE3, 0x8B, 0x3B,
+    0x2A, 0x98, 0xE8, 0x45, 0x06, 0x7A, 0x02, 0x34, 0x14, 0xDC, 0xBC, 0x59, 0x1A, 0x06, 0x68, 0x01,
+    0x5F, 0x58, 0x05, 0x3A, 0x47, 0x81, 0xFA, 0xE5, 0xC5, 0x02, 0x93, 0x29, 0xE7, 0x8B, 0x0B, 0xBD,
+    0x68, 0x19, 0x83, 0x59, 0x63, 0x70, 0x30, 0x15, 0x81, 0xAF, 0x45, 0x70, 0xED, 0x00, 0x31, 0xBF,
+    0xDC, 0xC8, 0xC0, 0x16, 0x46, 0xF4, 0x03, 0xB2, 0x20, 0x94, 0x2B, 0x0C, 0x56, 0xF3, 0xB5, 0x37,
+    0xA8, 0x63, 0xCD, 0xCC, 0x98, 0x5E, 0x29, 0x57, 0x26, 0x57, 0x30, 0x9A, 0x59, 0xB1, 0xEC, 0x07,
+    0x92, 0xEE, 0x4C, 0x18, 0xCE, 0x7A, 0x51, 0xA1, 0xB4, 0xB9, 0x04, 0x9E, 0xAB, 0xDA, 0x6A, 0xA0,
+    0x54, 0x32, 0x83, 0x87, 0x28, 0xB2, 0x81, 0x72, 0x66, 0x4D, 0x32, 0x83, 0xCB, 0xE8, 0x4B, 0x68,
+    0x24, 0xEA, 0xB2, 0x3D, 0x88, 0x6E, 0x0E, 0x34, 0xCA, 0x62, 0x00, 0x03, 0x4C, 0x69, 0x04, 0x20,
+    0xAC, 0xB5, 0xFF, 0xF5, 0xCB, 0x54, 0xE0, 0xB8, 0x5D, 0x71, 0x53, 0x44, 0xA3, 0xE2, 0xFB, 0x18,
+    0xA5, 0x82, 0xAB, 0x54, 0x2F, 0xBB, 0xB6, 0x3E, 0x1A, 0xDF, 0x63, 0x0A, 0x6F, 0xD9, 0x88, 0x10,
+    0x11, 0x14, 0x2D, 0x82, 0x11, 0xFF, 0x92, 0x5D, 0x4E, 0x41, 0x72, 0x28, 0x64, 0xAE, 0xBA, 0x13,
+    0xAA, 0x9F, 0xFC, 0x48, 0x3C, 0x47, 0x66, 0x8F, 0xB1, 0x90, 0xDF, 0x51, 0x1D, 0x98, 0xB6, 0xCB,
+    0xB9, 0x4D, 0x2A, 0x36, 0x88, 0xEB, 0x94, 0x7C, 0xF5, 0x9D, 0xF1, 0xDF, 0x62, 0x68, 0x6A, 0xB4,
+    0x6E, 0x17, 0x16, 0x13, 0xC7, 0x30, 0x99, 0x6A, 0x0A, 0x03, 0x3A, 0x08, 0x21, 0xDB, 0xA4, 0x71,
+    0x13, 0xED, 0xE5, 0x42, 0x6A, 0x25, 0xA7, 0x52, 0xD9, 0xE4, 0x28, 0x8C, 0x4C, 0x37, 0x13, 0x72,
+    0xF6, 0xA3, 0x95, 0x6B, 0x6C, 0x1E, 0xD8, 0x83, 0x27, 0xA1, 0xBF, 0x27, 0x6B, 0x9B, 0xA1, 0xFF,
+    0x06, 0x87, 0x0A, 0x7E, 0xBE, 0x34, 0xED, 0x88, 0x2A, 0x2C, 0x48, 0xA2, 0xEE, 0x07, 0x53, 0xDD,
+    0x4E, 0xA8, 0x64, 0x46, 0xEE, 0x90, 0x98, 0x21, 0x31, 0x73, 0x50, 0x8E, 0x60, 0x50, 0xC2, 0x43,
+    0xA2, 0x7C, 0x4B, 0x08, 0x50, 0xD4, 0x18, 0x99, 0xF7, 0xDD, 0x8D, 0xFC, 0x44, 0x84, 0xE5, 0x34,
+    0x64, 0x50, 0xFB, 0x53, 0xE4, 0xDD, 0xD2, 0x7C, 0x0F, 0x11, 0xA8, 0x30, 0x1E, 0x2A, 0x3C, 0xF8,
+    0x70, 0x7E, 0x60, 0x68, 0x5A, 0x9B, 0x87, 0x8B, 0x13, 0x60, 0x79, 0x22, 0x6A, 0x9E, 0x52, 0xCE,
+    0xCE, 0x54, 0xA8, 0x06, 0x6A, 0xD6, 0xEC, 0x05, 0xF3, 0x9C, 0xEC, 0x72, 0x24, 0x1B, 0xC5, 0x04,
+    0x3B, 0x28, 0xB8, 0x89, 0x6C, 0x94, 0xD8, 0xA9, 0x68, 0xD8, 0xB2, 0x0F, 0xF3, 0xEA, 0x8C, 0xAB,
+    0x41, 0x64, 0x4F, 0x92, 0x39, 0xCE, 0xF2, 0x0F, 0x5B, 0xDA, 0xFD, 0x4C, 0x3C, 0xC2, 0x9E, 0x63,
+    0x9C, 0x5F, 0x10, 0xA4, 0x95, 0xFD, 0x8A, 0xC9, 0x3D, 0xC2, 0x7F, 0xC7, 0x65, 0x01, 0xF4, 0xD8,
+    0x72, 0xE1, 0xF5, 0x7E, 0x44, 0x43, 0x86, 0x0E, 0x9E, 0x32, 0x20, 0x70, 0xBF, 0x40, 0xB6, 0x85,
+    0xA3, 0xEA, 0x96, 0x06, 0x91, 0x81, 0xDC, 0xDE, 0x35, 0x4D, 0xC3, 0xA9, 0x52, 0xB0, 0x09, 0x98,
+    0x76, 0x95, 0xD3, 0x4F, 0xCA, 0xC1, 0x7C, 0x54, 0xC8, 0xB3, 0x1F, 0xB8, 0x53, 0x12, 0xE0, 0x41,
+    0x01, 0xED, 0x17, 0xE7, 0xF4, 0xD1, 0x80, 0x9E, 0x89, 0xE8, 0x07, 0x20, 0x1C, 0x3C, 0x17, 0x41,
+    0xCD, 0xB1, 0x8B, 0x6B, 0x82, 0x98, 0x51, 0xF4, 0xE0, 0xC8, 0x1F, 0xF0, 0xB7, 0x09, 0xB9, 0x23,
+    0xAF, 0xC8, 0xB9, 0xB4, 0x4B, 0xFB, 0x47, 0x32, 0xA7, 0x3D, 0x87, 0x39, 0xD7, 0x8F, 0x0F, 0x0C,
+    0xC6, 0xCD, 0xCC, 0xCD, 0xED, 0xB9, 0x85, 0x37, 0xD3, 0x66, 0x44, 0x10, 0xE5, 0x0C, 0xB3, 0x0B,
+    0x63, 0x8A, 0xB0, 0x8E, 0x51, 0xC1, 0x64, 0xA7, 0xF5, 0xD3, 0x13, 0xB6, 0x2D, 0xEB, 0x57, 0x8D,
+    0x84, 0x19, 0xF9, 0x22, 0xF5, 0x2B, 0x8E, 0x1B, 0xD6, 0xA9, 0x1C, 0xC3, 0xF5, 0x7E, 0xFA, 0x98,
+    0x23, 0xA7, 0xE9, 0xF0, 0x5F, 0xAA, 0xED, 0x42, 0xE4, 0x50, 0xC2, 0x6B, 0xA1, 0x2B, 0x86, 0xF3,
+    0xCC, 0x8A, 0x2B, 0xAC, 0xEC, 0xF8, 0xBC, 0x45, 0x73, 0xBE, 0xB8, 0xDE, 0xCF, 0x28, 0xF8, 0x71,
+    0xCF, 0x84, 0x9F, 0xAC, 0x2B, 0x01, 0x88, 0x6C, 0x12, 0xA4, 0x04, 0x0D, 0x56, 0x27, 0x4E, 0x34,
+    0x5E, 0x9E, 0xE3, 0xC5, 0xF7, 0xFD, 0x50, 0x8E, 0x78, 0x79, 0xEA, 0xFA, 0xC1, 0x75, 0x29, 0x17,
+    0x13, 0x5E, 0x82, 0x49, 0xD8, 0x09, 0xAE, 0x7F, 0x35, 0xE3, 0x25, 0x18, 0xD7, 0x03, 0xB5, 0x84,
+    0x59, 0x74, 0x3D, 0xBF, 0x35, 0xF8, 0x44, 0xBA, 0x1E, 0x6E, 0x13, 0x96, 0xBA, 0x4E, 0xD6, 0x87,
+    0x3E, 0xFF, 0x01, 0xCD, 0x54, 0xBD, 0x8E, 0xD4, 0x48, 0x10, 0x2E, 0xBB, 0x41, 0x0E, 0x1C, 0x74,
+    0x72, 0x88, 0xD0, 0x8F, 0xE0, 0x47, 0x68, 0x23, 0x42, 0x12, 0x12, 0xA2, 0x7B, 0x08, 0x9E, 0xE0,
+    0xC6, 0x93, 0x11, 0x12, 0x21, 0x02, 0x02, 0x88, 0x47, 0x42, 0xFB, 0x04, 0xBB, 0x6E, 0x74, 0xE1,
+    0x05, 0x63, 0x84, 0x2E, 0x22, 0x58, 0x0B, 0x24, 0x24, 0x36, 0x71, 0xDF, 0xD1, 0x12, 0x86, 0xE9,
+    0xEE, 0xE2, 0x2B, 0xDB, 0xB3, 0xA7, 0x5B, 0x40, 0x3A, 0xA1, 0xD3, 0xE9, 0xEC, 0xB1, 0xA7, 0xFC,
+    0x75, 0x75, 0xFD, 0x7C, 0x5D, 0x55, 0x6A, 0xC8, 0x3C, 0x19, 0xDC, 0x59, 0x28, 0x1D, 0x95, 0x1C,
+    0x88, 0xEA, 0x44, 0x44, 0xD7, 0xE8, 0xAF, 0x2B, 0x12, 0xB5, 0xFB, 0x9E, 0x74, 0x88, 0x94, 0x33,
+    0x04, 0x03, 0xA1, 0x3C, 0xDF, 0xF7, 0x59, 0x80, 0x60, 0xF4, 0xBE, 0x2F, 0x06, 0x08, 0x01, 0x42,
+    0xDD, 0x84, 0xA8, 0x1C, 0x04, 0x7C, 0xC6, 0x6A, 0xAB, 0xF7, 0xAF, 0x1C, 0x84, 0x33, 0xD2, 0xFB,
+    0x73, 0x4B, 0x81, 0x3D, 0x04, 0x18, 0x0F, 0x6C, 0x21, 0x4C, 0x10, 0xC4, 0xBA, 0x69, 0xA8, 0x7E,
+    0xD8, 0x53, 0xF5, 0x2B, 0x56, 0xB1, 0x4F, 0x0F, 0xA6, 0x29, 0x9D, 0xEE, 0x95, 0xC7, 0x3D, 0x51,
+    0xCC, 0x03, 0x99, 0x8B, 0x40, 0x9A, 0x13, 0x29, 0xC6, 0xC6, 0xA4, 0x00, 0x34, 0x66, 0xAB, 0xFB,
+    0xD2, 0x29, 0x4F, 0x4C, 0xCB, 0x96, 0x3C, 0x68, 0x04, 0x06, 0x1B, 0x6A, 0x92, 0x70, 0x9B, 0x25,
+    0x72, 0x66, 0x76, 0xD8, 0xC5, 0x56, 0x5F, 0xEC, 0x78, 0x4E, 0x12, 0x3E, 0x0B, 0xA7, 0x1C, 0x55,
+    0x56, 0x5B, 0x6A, 0x67, 0x28, 0x9B, 0x00, 0x15, 0x03, 0xA0, 0x6A, 0x0B, 0x68, 0x03, 0x28, 0xF7,
+    0x80, 0x4A, 0x04, 0x65, 0x0D, 0x8C, 0x61, 0xCF, 0xCC, 0x4E, 0xC1, 0xDC, 0x50, 0x25, 0x14, 0xB5,
+    0xBC, 0x15, 0x5B, 0x97, 0x97, 0x62, 0x49, 0x64, 0x84, 0xE7, 0x8C, 0x3B, 0xE0, 0x3A, 0xB1, 0x83,
+    0xD6, 0xE1, 0x30, 0x90, 0x3A, 0x8C, 0xC8, 0x5D, 0x9F, 0x77, 0xF7, 0x1B, 0x3A, 0xDD, 0x44, 0x43,
+    0xEA, 0x8F, 0x83, 0x8F, 0x54, 0x3D, 0x18, 0x5F, 0x4E, 0x14, 0xAA, 0xEE, 0x36, 0x5C, 0x6F, 0x62,
+    0xD9, 0xD7, 0xB7, 0x0E, 0x5E, 0xDB, 0x50, 0x8C, 0xBD, 0xB9, 0xD3, 0x57, 0x5D, 0xB3, 0x31, 0xB4,
+    0x89, 0x94, 0xA6, 0xEC, 0xE0, 0x73, 0xB6, 0x80, 0x55, 0x22, 0xC0, 0xA5, 0x17, 0xB8, 0xB2, 0x08,
+    0x7A, 0xE1, 0xAE, 0xE0, 0x1E, 0x4E, 0x3D, 0xBC, 0xC1, 0x7B, 0xC5, 0x5F, 0x01, 0x17, 0xBB, 0x13,
+    0x3E, 0x5E, 0xE9, 0x9B, 0x1A, 0x57, 0x01, 0x4B, 0x74, 0x8F, 0x64, 0x61, 0x9A, 0x09, 0x44, 0x72,
+    0xF7, 0x3A, 0x0B, 0xBF, 0x95, 0xD3, 0x03, 0x15, 0xBE, 0xB6, 0xA4, 0x82, 0x91, 0xFC, 0xE1, 0x9D,
+    0xE2, 0x37, 0x5F, 0x5B, 0x79, 0x59, 0xA8, 0x54, 0xA2, 0x3C, 0x6F, 0x2B, 0x26, 0x18, 0xC8, 0xF9,
+    0x11, 0x8E, 0xB0, 0x83, 0x51, 0x94, 0x1A, 0xFC, 0xD1, 0x8D, 0x85, 0x3F, 0x03, 0x3F, 0x23, 0x9E,
+    0x43, 0xDA, 0xED, 0x12, 0x62, 0x30, 0x5D, 0x43, 0x7A, 0xEC, 0x41, 0x1E, 0x94, 0x7E, 0x14, 0xD8,
+    0x4A, 0x1E, 0xFA, 0x05, 0xB2, 0x0E, 0x1D, 0x07, 0x3D, 0xFE, 0xDE, 0x3A, 0xE4, 0xD9, 0x3D, 0xF4,
+    0x94, 0x07, 0x04, 0xA0, 0xCF, 0x07, 0x28, 0x26, 0x89, 0x04, 0x42, 0x87, 0x1D, 0x85, 0x08, 0xED,
+    0x25, 0x22, 0x3A, 0xA3, 0xA3, 0x2C, 0xE2, 0xB0, 0x0D, 0xEA, 0xB6, 0x9C, 0x38, 0xFD, 0xCC, 0xFA,
+    0x35, 0xCA, 0x29, 0x56, 0x3C, 0xE8, 0xFE, 0x7A, 0x23, 0xAD, 0x81, 0xAA, 0x5D, 0x7A, 0xE4, 0x7B,
+    0x02, 0xC2, 0x90, 0xB2, 0x89, 0xB0, 0x98, 0x40, 0xC0, 0x2F, 0x60, 0x02, 0x25, 0xBB, 0x10, 0x2D,
+    0x41, 0x0A, 0x65, 0xF3, 0x43, 0xEB, 0x73, 0xFC, 0xC6, 0x1A, 0xC8, 0x9E, 0x75, 0xCB, 0x49, 0x8A,
+    0xEC, 0xD1, 0x73, 0xD8, 0x88, 0xB3, 0xAD, 0x95, 0xB9, 0x0A, 0xA4, 0x7D, 0xC4, 0x13, 0x77, 0x27,
+    0x9F, 0x77, 0xA4, 0xFC, 0xEA, 0x57, 0xB6, 0x8B, 0xEF, 0x1F, 0x05, 0xE6, 0xDE, 0x21, 0xF0, 0xD4,
+    0x0A, 0x80, 0x40, 0x0A, 0x87, 0x48, 0x34, 0x72, 0x86, 0x8E, 0x96, 0x56, 0x29, 0x1C, 0xE2, 0x53,
+    0x32, 0x3A, 0xD0, 0xA0, 0x9D, 0xB4, 0x32, 0x8C, 0x24, 0xE9, 0x89, 0x36, 0x47, 0xAC, 0xE6, 0x36,
+    0xCC, 0xD4, 0x0F, 0xD0, 0x04, 0xFA, 0xB7, 0x41, 0xB8, 0x46, 0x1E, 0xC5, 0x68, 0x25, 0x09, 0xF8,
+    0xC9, 0xA5, 0x5D, 0x28, 0xAD, 0xB3, 0x65, 0xE9, 0x24, 0x25, 0x05, 0x0D, 0xAB, 0x4B, 0xBE, 0xD4,
+    0x5A, 0x39, 0x81, 0x66, 0x39, 0x18, 0x6A, 0x87, 0x39, 0xA4, 0xEC, 0xD9, 0x71, 0x1E, 0xAD, 0x01,
+    0x1F, 0x19, 0x5E, 0x83, 0xFE, 0x7A, 0xE1, 0xE6, 0x27, 0xD9, 0x36, 0x57, 0xBE, 0xCC, 0x01, 0x74,
+    0x3A, 0x3F, 0x7D, 0xC7, 0x56, 0xC5, 0xDC, 0x97, 0x01, 0x93, 0xE4, 0x94, 0xBA, 0x5B, 0x91, 0xEA,
+    0x46, 0xBB, 0x8E, 0xCA, 0x3E, 0x43, 0xE5, 0xA2, 0xF5, 0x0D, 0xC6, 0xD1, 0x29, 0xE9, 0xB7, 0x1E,
+    0x0B, 0xB9, 0xCC, 0x3A, 0x54, 0x0D, 0x26, 0x0C, 0x16, 0xF6, 0x83, 0x2C, 0xBC, 0x09, 0x58, 0x50,
+    0xBE, 0x6D, 0xCA, 0x1E, 0x63, 0xC7, 0xE5, 0x3E, 0x4B, 0x19, 0x37, 0xA7, 0xC8, 0xAA, 0x8A, 0xED,
+    0x13, 0x16, 0x7F, 0x52, 0xE1, 0x18, 0x17, 0x12, 0xD0, 0xF5, 0x74, 0xF7, 0x1F, 0x87, 0xFB, 0xB7,
+    0x85, 0xE5, 0x0C, 0x6A, 0x9B, 0x50, 0x82, 0x20, 0x59, 0x0F, 0x4A, 0x98, 0x56, 0x13, 0x48, 0x2A,
+    0xE4, 0x4C, 0xCA, 0x3F, 0x65, 0xD2, 0xA0, 0x9F, 0xE0, 0x16, 0xBA, 0xB5, 0x70, 0x24, 0x5F, 0xA5,
+    0xBC, 0xDA, 0x76, 0x0B, 0x55, 0x1C, 0x9F, 0xB1, 0x9D, 0x10, 0x9C, 0xE0, 0x21, 0x8B, 0x30, 0x98,
+    0xCB, 0x24, 0x53, 0x01, 0x13, 0xB2, 0x58, 0x9C, 0x25, 0xA9, 0xB4, 0x7F, 0xFB, 0x25, 0x0C, 0xBC,
+    0x9F, 0x47, 0xCE, 0x3A, 0x77, 0x88, 0xCE, 0xBE, 0xF7, 0xFA, 0x69, 0x66, 0x61, 0x3B, 0xB7, 0x5F,
+    0x26, 0x43, 0xA7, 0x9D, 0xE7, 0xD4, 0x0A, 0x24, 0x01, 0xA0, 0x57, 0xA1, 0x7A, 0x8A, 0x0F, 0x01,
+    0xF1, 0x77, 0x9F, 0x4F, 0xB8, 0x94, 0xA1, 0x7E, 0x9F, 0x1F, 0xBB, 0xB5, 0x7A, 0x5A, 0x5A, 0xFA,
+    0xA9, 0xB8, 0x0A, 0x1C, 0xF9, 0x94, 0xDF, 0x7F, 0xFD, 0xB7, 0x0C, 0xDD, 0x2B, 0x7F, 0xF4, 0xFF,
+    0xBA, 0xBE, 0x00, 0xBD, 0x55, 0xBB, 0x6E, 0xDD, 0x46, 0x10, 0x1D, 0x92, 0x90, 0x68, 0x9B, 0xC5,
+    0x56, 0x29, 0x0C, 0x17, 0xEC, 0xDD, 0xF0, 0x0F, 0x42, 0x56, 0x69, 0x93, 0xC2, 0x57, 0x80, 0xDD,
+    0xE8, 0x07, 0x0C, 0xE8, 0x0F, 0x74, 0x09, 0xA4, 0x4C, 0x61, 0x37, 0xEA, 0x05, 0x44, 0x29, 0x42,
+    0x20, 0xF0, 0x1F, 0x98, 0xEC, 0x5C, 0x8A, 0x88, 0x3F, 0xC0, 0x17, 0x90, 0xDC, 0xC8, 0x85, 0x09,
+    0x88, 0xB0, 0xAF, 0xAE, 0x77, 0x39, 0x3E, 0x67, 0x97, 0x57, 0x52, 0xE0, 0xC0, 0x70, 0x52, 0x78,
+    0xC1, 0xE5, 0x63, 0x77, 0x76, 0x1E, 0x67, 0xCE, 0x0C, 0x45, 0xFC, 0x48, 0x46, 0x7F, 0x0D, 0xA6,
+    0x17, 0x5E, 0x5D, 0x59, 0x09, 0x2F, 0x71, 0xC2, 0xCB, 0x7E, 0x9F, 0x6D, 0xF5, 0x63, 0x53, 0x86,
+    0xA7, 0x0B, 0x0F, 0x1D, 0x83, 0x87, 0x38, 0xE9, 0x07, 0x4E, 0xFA, 0xE1, 0xAE, 0x1D, 0xFF, 0xC7,
+    0xF6, 0x4E, 0x78, 0xA4, 0xCA, 0xFD, 0xA5, 0x62, 0x75, 0xB7, 0x71, 0x37, 0x02, 0x5F, 0xBC, 0x6E,
+    0x1A, 0xE8, 0x83, 0x95, 0x5A, 0x68, 0xBE, 0xC2, 0xEA, 0x03, 0x4B, 0x81, 0xBC, 0xA7, 0xC0, 0xC4,
+    0xD7, 0x6C, 0x75, 0xFD, 0x6A, 0xB8, 0x9A, 0x42, 0x60, 0xF3, 0x02, 0xB2, 0x38, 0xD0, 0xF3, 0xD8,
+    0xF3, 0x5B, 0xAE, 0x98, 0x37, 0x54, 0x5E, 0x2E, 0xE9, 0xA5, 0xA3, 0x89, 0xE4, 0xE3, 0x17, 0xCB,
+    0xAA, 0x27, 0x58, 0xA6, 0x39, 0xF3, 0x86, 0x77, 0x2C, 0x47, 0x4A, 0xE9, 0xC8, 0x51, 0x3A, 0x59,
+    0x53, 0xDA, 0xAC, 0x28, 0x5D, 0xD6, 0xD7, 0xCB, 0xF9, 0xB0, 0x95, 0x26, 0x26, 0x50, 0x72, 0x35,
+    0x07, 0xEF, 0xBE, 0x32, 0xB5, 0x39, 0xA1, 0x9B, 0x1D, 0x71, 0x9C, 0x24, 0xB3, 0x54, 0xC6, 0x60,
+    0x30, 0x5F, 0xCE, 0x4F, 0xC7, 0x88, 0xB4, 0xD1, 0x91, 0xE1, 0x50, 0xAB, 0x2C, 0x2A, 0x29, 0x74,
+    0x2D, 0xC8, 0x43, 0xF5, 0xE3, 0xA2, 0x85, 0xE3, 0x66, 0x40, 0x1C, 0x6B, 0x91, 0xC8, 0xCE, 0x6A,
+    0xA7, 0xDD, 0xA6, 0x99, 0x52, 0x55, 0x3F, 0xF1, 0xFD, 0x92, 0x6B, 0x61, 0x8F, 0x32, 0x94, 0xCD,
+    0x87, 0xC3, 0x3D, 0xED, 0xE1, 0x6B, 0x45, 0x5D, 0xB2, 0x08, 0xD9, 0xF9, 0xC5, 0x63, 0x4B, 0xFF,
+    0x25, 0x53, 0x05, 0x23, 0x62, 0x5D, 0xB4, 0x9D, 0x43, 0x9C, 0x32, 0x99, 0x3E, 0x1B, 0x24, 0x1D,
+    0x1C, 0xB5, 0x94, 0xCF, 0xFA, 0xBC, 0x93, 0xD8, 0xBA, 0x18, 0xEA, 0xF2, 0xD3, 0x4D, 0xDB, 0x41,
+    0xB1, 0x52, 0x51, 0x7E, 0xCA, 0x64, 0x45, 0x76, 0x0A, 0x3B, 0x14, 0x8B, 0xAC, 0xA3, 0xD5, 0xE2,
+    0xB4, 0x87, 0xF2, 0x64, 0x74, 0xD2, 0x22, 0xF5, 0xA6, 0x87, 0x17, 0xF9, 0xCA, 0x49, 0x7E, 0xB5,
+    0x6F, 0xB1, 0x0E, 0x4F, 0xA8, 0xB8, 0x55, 0xCF, 0x9F, 0x1F, 0x42, 0xCA, 0x64, 0x17, 0x3C, 0x8B,
+    0x19, 0x78, 0xBB, 0x69, 0x9C, 0x59, 0x89, 0xF9, 0x1B, 0x8A, 0x5C, 0xD1, 0xDD, 0x7A, 0xE9, 0x11,
+    0x98, 0xCB, 0xA6, 0xA3, 0xFD, 0xBE, 0x80, 0xB0, 0x1C, 0x40, 0x38, 0xA2, 0x8F, 0x65, 0x6D, 0x7A,
+    0x00, 0x43, 0x0F, 0x4D, 0x8F, 0x54, 0x39, 0x7C, 0x84, 0x53, 0xF8, 0x80, 0xC1, 0x87, 0x35, 0xC0,
+    0x20, 0x28, 0x29, 0xB3, 0x04, 0x37, 0x45, 0x0E, 0x31, 0xE3, 0xE1, 0x86, 0xA5, 0x1E, 0x96, 0x88,
+    0x08, 0x52, 0x73, 0x79, 0x7E, 0x30, 0x64, 0xA3, 0x94, 0x1D, 0x93, 0x44, 0xCB, 0x67, 0x08, 0xB7,
+    0x05, 0xDF, 0xB3, 0x4B, 0xD6, 0x01, 0xCB, 0xE2, 0x72, 0xD3, 0x34, 0x0D, 0x2B, 0xC0, 0x67, 0x1E,
+    0xA0, 0x09, 0x51, 0xF0, 0xF9, 0x91, 0xB6, 0x96, 0x3B, 0xB1, 0xFE, 0xF1, 0xA2, 0x03, 0xB0, 0x16,
+    0xE8, 0x4E, 0x95, 0x44, 0x8F, 0x66, 0x66, 0x0E, 0xA6, 0x96, 0x25, 0x44, 0xD3, 0x01, 0x7E, 0xDC,
+    0x97, 0x63, 0xB9, 0x19, 0x48, 0x09, 0x12, 0xB2, 0x22, 0x8F, 0xFB, 0x64, 0xFA, 0x49, 0xA5, 0xAD,
+    0x12, 0xE2, 0x95, 0x33, 0x94, 0x09, 0x26, 0xB2, 0xCB, 0x91, 0x6E, 0xD0, 0xBA, 0x77, 0x03, 0x1E,
+    0xFC, 0x3E, 0xCE, 0x85, 0xC8, 0x44, 0x4B, 0xC1, 0xD0, 0x14, 0x33, 0xC3, 0x57, 0x5D, 0x6C, 0x9E,
+    0x58, 0xA0, 0xAC, 0x1D, 0x6E, 0xE7, 0x00, 0x1A, 0x5E, 0x9C, 0xC8, 0x4C, 0x11, 0x29, 0x88, 0xC9,
+    0xFE, 0xDB, 0x85, 0x2F, 0xB9, 0x15, 0x19, 0xB6, 0x96, 0x9D, 0xE5, 0x11, 0xDC, 0x44, 0x91, 0x21,
+    0x98, 0xB5, 0x97, 0x8C, 0x50, 0x93, 0xC5, 0x6F, 0x80, 0x25, 0x7B, 0x07, 0xA9, 0x58, 0xCF, 0x53,
+    0xA4, 0xB4, 0x47, 0xB8, 0xC5, 0x0A, 0x11, 0x80, 0x24, 0x62, 0x19, 0x76, 0x49, 0x9D, 0xA6, 0x83,
+    0xCE, 0x64, 0xE0, 0x71, 0xCB, 0xE3, 0xFF, 0x65, 0x91, 0xC8, 0x75, 0x1E, 0x1E, 0xBE, 0x5A, 0xDF,
+    0x5D, 0x64, 0x9B, 0xAB, 0x1C, 0x72, 0x46, 0x49, 0x7C, 0xDF, 0x81, 0x94, 0xFE, 0x35, 0x00, 0x22,
+    0xF4, 0xAE, 0x8A, 0xA1, 0x00, 0xD4, 0x68, 0xEE, 0x46, 0x0C, 0xE5, 0xBD, 0xEA, 0xA7, 0xA9, 0xF9,
+    0xD3, 0x79, 0x68, 0x3C, 0x13, 0x7D, 0x41, 0x7C, 0xE3, 0x07, 0xC6, 0xE3, 0x0A, 0x99, 0x40, 0xA8,
+    0x3A, 0x25, 0x7A, 0xF4, 0x94, 0x68, 0x82, 0x91, 0xDE, 0x1B, 0x66, 0x9A, 0x78, 0x97, 0x17, 0xCD,
+    0x31, 0x2C, 0x0D, 0x7E, 0xCE, 0x39, 0xE0, 0x1E, 0x53, 0x40, 0x59, 0x9E, 0xC1, 0xD9, 0xBF, 0xA0,
+    0xC3, 0x79, 0x5D, 0x24, 0xFA, 0xCE, 0x23, 0xD6, 0x5A, 0x0D, 0xC4, 0xCD, 0xD5, 0x9E, 0x5D, 0x22,
+    0x03, 0x90, 0x4A, 0x87, 0x70, 0xA2, 0x80, 0xF5, 0x62, 0x22, 0x05, 0x7A, 0x14, 0x03, 0x16, 0x5B,
+    0xCC, 0x62, 0x15, 0x54, 0x52, 0xD6, 0x21, 0xCE, 0x77, 0x57, 0x7B, 0x0A, 0xF2, 0x8F, 0x39, 0xA9,
+    0x8A, 0xE4, 0xDD, 0x33, 0x67, 0x76, 0xBA, 0xEB, 0xC3, 0xFE, 0xF9, 0xF5, 0xE8, 0xFE, 0xED, 0x76,
+    0xFF, 0x9E, 0x79, 0x75, 0xF6, 0xC1, 0xDA, 0xC3, 0xBB, 0x5B, 0xAE, 0x27, 0x2C, 0xFA, 0xB2, 0x42,
+    0x5D, 0x7E, 0xC3, 0x8B, 0xC4, 0x35, 0x3B, 0xEE, 0x80, 0x5B, 0xBC, 0x85, 0x38, 0x74, 0xDF, 0xFF,
+    0x7D, 0x8B, 0x6D, 0xA9, 0xBF, 0xEA, 0x50, 0xAC, 0x6F, 0xB8, 0xEF, 0x1B, 0x38, 0x11, 0x53, 0xDF,
+    0x15, 0xCC, 0x45, 0xF8, 0x55, 0x94, 0x73, 0x63, 0xB5, 0xE1, 0x4F, 0x01, 0x7A, 0xF8, 0x9F, 0x0E,
+    0xB8, 0xB2, 0xDD, 0xD6, 0xCD, 0x73, 0xA2, 0x68, 0x58, 0x69, 0xA9, 0xE7, 0xB1, 0x95, 0xBC, 0x66,
+    0x53, 0xB3, 0x28, 0x72, 0x9C, 0x4E, 0xC7, 0x78, 0x0C, 0x3F, 0x8C, 0xAC, 0xF7, 0x84, 0xA9, 0x4B,
+    0x09, 0xFF, 0x3B, 0x1B, 0xB6, 0xC1, 0x62, 0x36, 0xA5, 0x53, 0x18, 0x2E, 0x2F, 0x5A, 0x5B, 0x5A,
+    0x09, 0x7D, 0xBA, 0xA6, 0x37, 0xE7, 0xF2, 0xDD, 0xC6, 0x67, 0xCD, 0x55, 0x3D, 0x93, 0xDC, 0x44,
+    0x10, 0x6D, 0x69, 0xC0, 0xAA, 0x42, 0xC1, 0x10, 0x38, 0xD7, 0x4F, 0xD0, 0x4F, 0x18, 0x55, 0x11,
+    0x10, 0x02, 0x55, 0x28, 0xF6, 0x4F, 0xE0, 0x17, 0x18, 0x6D, 0xE6, 0x10, 0x12, 0x93, 0xDA, 0x01,
+    0x91, 0x2E, 0x20, 0x25, 0xE0, 0x76, 0x55, 0x76, 0x48, 0xB0, 0x02, 0x42, 0x02, 0x8B, 0xE2, 0x1C,
+    0x60, 0x82, 0x53, 0x20, 0x0A, 0xD9, 0x37, 0xA3, 0xE1, 0xBD, 0x9E, 0xB3, 0x97, 0x2D, 0x07, 0x50,
+    0x44, 0xE8, 0x4E, 0xBD, 0xB3, 0xD3, 0xDD, 0x6F, 0xFA, 0xE3, 0xF5, 0xAC, 0x88, 0x3E, 0x6E, 0x27,
+    0x76, 0x12, 0xBE, 0x66, 0x15, 0x7D, 0x37, 0xD1, 0x17, 0x8A, 0x7F, 0x50, 0x46, 0x3E, 0x57, 0x56,
+    0x3F, 0xE2, 0xD3, 0xAD, 0xEF, 0x63, 0xFF, 0x8D, 0x4F, 0xCA, 0x43, 0xA7, 0x9E, 0xF6, 0x5A, 0x3D,
+    0xF3, 0x9B, 0xE4, 0xB9, 0x25, 0xA5, 0x4B, 0xCA, 0xEE, 0x08, 0xE5, 0x76, 0x11, 0x7F, 0x82, 0x12,
+    0x00, 0x23, 0x95, 0x71, 0x6B, 0x24, 0xFB, 0x9A, 0x71, 0xED, 0x29, 0x6A, 0x1C, 0x93, 0xDD, 0x7B,
+    0xDE, 0x36, 0x34, 0x58, 0x78, 0x62, 0x90, 0x77, 0xBB, 0x87, 0xAD, 0x48, 0x89, 0xB0, 0x24, 0x5F,
+    0xD5, 0x32, 0xEB, 0x1B, 0xA9, 0x1F, 0xC4, 0x4D, 0xCA, 0xDF, 0x63, 0x9C, 0xF3, 0x78, 0x55, 0x04,
+    0x39, 0x8C, 0xE2, 0x86, 0x7A, 0x92, 0x62, 0x2E, 0x67, 0x11, 0x9F, 0x7B, 0x80, 0x13, 0xD3, 0x8E,
+    0xC0, 0x34, 0x0B, 0xDD, 0x03, 0xDD, 0x5D, 0xF3, 0xEF, 0x37, 0x45, 0xDE, 0x7B, 0x8C, 0x7D, 0xE0,
+    0x11, 0xD3, 0xDC, 0xBE, 0xD9, 0x82, 0x18, 0xDE, 0x97, 0x37, 0x0F, 0xEC, 0xEA, 0x2F, 0x46, 0xA9,
+    0x9E, 0x2E, 0x80, 0x08, 0x48, 0xD4, 0x35, 0xE5, 0x6C, 0x47, 0xB3, 0xE0, 0x6F, 0x05, 0x94, 0x17,
+    0xF7, 0xC2, 0x8B, 0x45, 0xB8, 0x26, 0xC6, 0x41, 0x36, 0x83, 0x8D, 0xC6, 0xED, 0xEC, 0x58, 0xCE,
+    0x66, 0x91, 0x28, 0xC9, 0x25, 0xF7, 0x16, 0x19, 0x00, 0xC3, 0xAC, 0x41, 0xA4, 0x6B, 0xA4, 0x07,
+    0x74, 0xC1, 0xA3, 0xEA, 0x01, 0xE2, 0xC0, 0xEC, 0xF9, 0xAD, 0xE4, 0xB7, 0xBB, 0xA7, 0xD3, 0xE1,
+    0x55, 0x78, 0x78, 0xC4, 0xE3, 0x28, 0x35, 0x16, 0x86, 0x8B, 0x4B, 0x2C, 0xAA, 0xE3, 0x71, 0x34,
+    0x33, 0x16, 0x9F, 0xDB, 0xE3, 0x68, 0x07, 0x1F, 0xF2, 0x05, 0x0B, 0x27, 0x3E, 0xD8, 0xD1, 0x1E,
+    0x7F, 0x58, 0xB1, 0x70, 0x62, 0x8F, 0x3F, 0x4F, 0x58, 0x20, 0xBC, 0x63, 0x6C, 0xC4, 0x47, 0x74,
+    0xF0, 0x88, 0xCA, 0xF9, 0x88, 0x86, 0x0D, 0xF2, 0xAD, 0xDC, 0x47, 0x2D, 0x84, 0xF1, 0xB0, 0x9E,
+    0x75, 0x44, 0xF6, 0x45, 0x1C, 0xCE, 0xD3, 0xC7, 0xD1, 0x08, 0xCD, 0x77, 0x28, 0xCE, 0x82, 0x5E,
+    0x17, 0x33, 0xE2, 0xB5, 0x13, 0xC2, 0xC2, 0x31, 0x93, 0x54, 0x43, 0x31, 0x83, 0x02, 0x48, 0xD4,
+    0xC1, 0x88, 0x69, 0x78, 0xE2, 0x6D, 0x99, 0x27, 0x28, 0xAB, 0xFC, 0x01, 0xB2, 0xAA, 0x1F, 0x00,
+    0xD9, 0x7E, 0x4F, 0xE6, 0x3D, 0x03, 0x7C, 0x71, 0x0D, 0x61, 0x10, 0x90, 0xE4, 0x51, 0x12, 0xFF,
+    0x18, 0x07, 0x4A, 0x0F, 0x2F, 0x65, 0x25, 0x8E, 0x11, 0xA5, 0x29, 0x50, 0x60, 0x7B, 0xA0, 0xED,
+    0x81, 0x16, 0xDD, 0x74, 0xEA, 0x8A, 0xBD, 0x1E, 0xC5, 0xDC, 0x00, 0x7E, 0x83, 0xC6, 0x1D, 0xFE,
+    0xE3, 0x06, 0x88, 0x78, 0x83, 0x77, 0x23, 0xE7, 0x77, 0xC2, 0x00, 0x1C, 0x8F, 0x1E, 0x12, 0x19,
+    0x74, 0xE3, 0xAE, 0x1E, 0x87, 0x1C, 0xC5, 0x92, 0xDB, 0x9C, 0x95, 0x00, 0xC1, 0x40, 0x4F, 0x1B,
+    0x28, 0x0B, 0x8B, 0x68, 0x7F, 0xF4, 0xDA, 0xD2, 0xCC, 0x57, 0x83, 0xE6, 0x53, 0x0D, 0x41, 0xBB,
+    0x98, 0x79, 0xA4, 0x93, 0x6D, 0x54, 0x52, 0xCC, 0x20, 0x3B, 0x58, 0x67, 0x22, 0xDD, 0x51, 0xDC,
+    0x0E, 0xCC, 0x00, 0xA3, 0xC0, 0xA3, 0x9D, 0x74, 0x44, 0xDC, 0x3C, 0x58, 0x09, 0xC4, 0xFA, 0x11,
+    0x38, 0x25, 0xE4, 0x5B, 0x20, 0xCC, 0x26, 0x5D, 0x39, 0x67, 0xD4, 0x95, 0x53, 0xC7, 0x79, 0x72,
+    0x8D, 0x37, 0xAB, 0x21, 0xAF, 0xAA, 0xA1, 0x1E, 0x80, 0x54, 0x3D, 0x59, 0x24, 0x90, 0xE5, 0x9B,
+    0x83, 0x15, 0x22, 0x28, 0xFE, 0x44, 0x8B, 0x3E, 0x43, 0x42, 0x2E, 0xA0, 0xE0, 0x0B, 0xAB, 0x8E,
+    0x16, 0xB2, 0xF2, 0x16, 0xC1, 0x63, 0xB0, 0x94, 0x8F, 0x5A, 0xF6, 0xF3, 0x07, 0x19, 0xE0, 0xBF,
+    0xFC, 0x75, 0x66, 0x3B, 0xF2, 0xD5, 0x6B, 0x3E, 0x01, 0xA5, 0x40, 0x85, 0xDC, 0x47, 0x64, 0x80,
+    0xD8, 0x27, 0x2B, 0x0B, 0x53, 0xCC, 0x1D, 0x27, 0x1C, 0x39, 0x0E, 0x4C, 0x7E, 0xCF, 0x44, 0x66,
+    0x1D, 0x3B, 0x8C, 0x6E, 0x35, 0x54, 0x83, 0x89, 0xBB, 0x72, 0x32, 0x4B, 0x76, 0xC3, 0x99, 0xD8,
+    0x83, 0x92, 0x80, 0xB2, 0xC3, 0xFD, 0x6A, 0xB8, 0x04, 0xB0, 0x33, 0x33, 0x11, 0xAB, 0x66, 0x8F,
+    0x7C, 0xCA, 0x67, 0x83, 0x92, 0x24, 0x8E, 0x79, 0x1C, 0xB5, 0x50, 0x8E, 0x83, 0xB9, 0xE8, 0x8C,
+    0x4A, 0x39, 0xDE, 0x0E, 0xC5, 0xB9, 0x3C, 0x44, 0x8E, 0xDE, 0xDF, 0xE5, 0xDB, 0x36, 0xAF, 0xE5,
+    0xF3, 0x96, 0x32, 0xC6, 0x97, 0x2A, 0x39, 0x09, 0xAF, 0x7A, 0x30, 0x9F, 0xC9, 0xAC, 0x94, 0x98,
+    0x5F, 0x6D, 0x97, 0xDA, 0x87, 0x93, 0xCC, 0x54, 0xE6, 0xBA, 0x5F, 0xA8, 0x25, 0x62, 0x23, 0xC2,
+    0xA8, 0xB2, 0xA1, 0xBC, 0xBA, 0xAD, 0x9C, 0xD2, 0x17, 0x7D, 0x3C, 0x5B, 0x96, 0x6A, 0x75, 0xE0,
+    0xC5, 0x77, 0xE7, 0xE2, 0x55, 0xFF, 0xB6, 0xC1, 0xD9, 0x32, 0xC6, 0xDF, 0xB0, 0x04, 0x31, 0xB9,
+    0x8C, 0x2B, 0x77, 0xBB, 0x91, 0x06, 0x1B, 0x97, 0xE5, 0xCC, 0xE5, 0x9E, 0x4B, 0x3B, 0xB1, 0x3B,
+    0x5E, 0xBA, 0xFE, 0x22, 0xEE, 0x68, 0x3B, 0xD1, 0xED, 0xF5, 0x9C, 0xA4, 0x99, 0xAA, 0xE2, 0x4B,
+    0xDA, 0x33, 0x02, 0xD2, 0x12, 0x1F, 0x1C, 0xE8, 0x2A, 0xC8, 0x9D, 0x5F, 0xA0, 0xE6, 0x74, 0x41,
+    0x6D, 0x97, 0xD4, 0x73, 0xDC, 0xE6, 0x0C, 0xC2, 0xF8, 0xE4, 0xAD, 0x53, 0x08, 0x75, 0x97, 0x28,
+    0x41, 0x92, 0x43, 0xDD, 0xDE, 0xFB, 0xA3, 0x6D, 0x3F, 0xCE, 0xD2, 0x6F, 0xC5, 0x58, 0xA4, 0xCF,
+    0xA6, 0x7A, 0x71, 0x11, 0xDA, 0xF6, 0x53, 0xD8, 0xF2, 0x56, 0xA5, 0xB7, 0xDE, 0x6E, 0xF0, 0x3E,
+    0x24, 0xEF, 0x2C, 0xC8, 0x19, 0x78, 0xB9, 0x24, 0xB5, 0x9A, 0xE3, 0xEC, 0x7A, 0x4E, 0x05, 0x70,
+    0x60, 0xE3, 0x27, 0xBC, 0xE3, 0x63, 0x1F, 0x3F, 0x9C, 0x79, 0x37, 0xC5, 0x00, 0x35, 0x33, 0x48,
+    0x99, 0xE1, 0x27, 0x24, 0x7D, 0x04, 0x2A, 0xF5, 0x86, 0x8C, 0x7A, 0x3D, 0x3E, 0xFC, 0x2E, 0x68,
+    0x26, 0xE0, 0x9D, 0x76, 0x4E, 0x87, 0x53, 0x2F, 0xFB, 0xA0, 0x93, 0x0D, 0xC0, 0xBE, 0xFF, 0x52,
+    0xC3, 0x9D, 0x92, 0xD4, 0x82, 0xDE, 0x6A, 0xDF, 0x58, 0xEE, 0x4E, 0x08, 0x40, 0x7B, 0x87, 0xC8,
+    0x5F, 0x5D, 0xEA, 0x29, 0x21, 0xB0, 0x9E, 0x3A, 0x2D, 0xAD, 0xFC, 0x8F, 0x9E, 0xBF, 0x00, 0xDD,
+    0x55, 0x31, 0x8E, 0xE5, 0x44, 0x10, 0xAD, 0xEF, 0x96, 0xB0, 0x84, 0x83, 0x4E, 0xC9, 0xCC, 0x0D,
+    0x7C, 0x84, 0xB6, 0x36, 0x21, 0x20, 0x60, 0x92, 0xBF, 0xC9, 0x06, 0xE4, 0x48, 0x68, 0x6E, 0x40,
+    0xB7, 0xD8, 0x80, 0x74, 0x92, 0x8D, 0x38, 0x01, 0x7F, 0x82, 0x3D, 0xC1, 0x8C, 0x2D, 0x11, 0x90,
+    0x3A, 0x23, 0x20, 0x69, 0x01, 0x9B, 0xCC, 0x06, 0xB4, 0xC0, 0x83, 0xAC, 0xDD, 0x76, 0x9B, 0xF7,
+    0xAA, 0x47, 0x90, 0x10, 0x10, 0xE3, 0xAF, 0xE9, 0xB2, 0x5D, 0xE5, 0xEA, 0xD7, 0xAF, 0x5E, 0xD5,
+    0x88, 0x34, 0xAB, 0xF0, 0xF2, 0x33, 0x57, 0xBB, 0xEB, 0xC3, 0x91, 0xB8, 0x0E, 0x13, 0x57, 0xF3,
+    0xFB, 0xA6, 0xFE, 0x9E, 0x01, 0x76, 0x61, 0xC0, 0x29, 0xB7, 0x0C, 0x18, 0x82, 0x1B, 0xE1, 0x5F,
+    0x1B, 0x06, 0x4C, 0xE7, 0x6B, 0x04, 0xD8, 0xE3, 0x28, 0xF0, 0x1F, 0x07, 0x33, 0xB8, 0xB7, 0x65,
+    0x1A, 0xE1, 0x77, 0xCF, 0x32, 0xFC, 0x66, 0x45, 0x06, 0xBB, 0xB8, 0xB1, 0xE0, 0x7B, 0xB3, 0x22,
+    0x83, 0xC3, 0xF7, 0x6E, 0x6C, 0x13, 0x32, 0x64, 0x99, 0xC4, 0x8D, 0x76, 0xB1, 0x8B, 0x59, 0xA5,
+    0xE0, 0x91, 0xEF, 0x5D, 0xC0, 0x83, 0xFB, 0x06, 0x81, 0x63, 0x93, 0x0B, 0x12, 0xE1, 0x73, 0xA9,
+    0x57, 0x97, 0x15, 0x26, 0x1F, 0x7B, 0xA2, 0x34, 0x7F, 0x24, 0xC5, 0x18, 0xE0, 0x5A, 0xE8, 0xCB,
+    0x5D, 0x54, 0x80, 0x70, 0xBD, 0xBB, 0xC5, 0x09, 0xFD, 0x71, 0xCC, 0x44, 0x97, 0xB1, 0xB9, 0xFB,
+    0x34, 0xCA, 0xF0, 0x32, 0x79, 0x31, 0xC9, 0x99, 0x0D, 0xC8, 0x52, 0x3F, 0x03, 0x98, 0xEC, 0xC0,
+    0x95, 0x3A, 0x6C, 0xEB, 0xC4, 0x99, 0x64, 0x52, 0xB3, 0xDD, 0x8B, 0x93, 0x7E, 0xF6, 0x7A, 0x56,
+    0xE4, 0x80, 0x75, 0x73, 0xB5, 0x53, 0xAC, 0x96, 0xE7, 0x84, 0x3D, 0xBD, 0x5B, 0xD5, 0x9A, 0xC7,
+    0x5C, 0x6D, 0xDA, 0xD5, 0x76, 0xF1, 0x5E, 0xAD, 0x5D, 0xBC, 0xDA, 0x7E, 0x76, 0x81, 0xD6, 0x85,
+    0x61, 0x16, 0x7F, 0x3E, 0x4F, 0xAF, 0xAE, 0x17, 0x62, 0x53, 0xC2, 0xFE, 0xB6, 0x97, 0xDB, 0x32,
+    0xBD, 0xDD, 0x10, 0x67, 0xB6, 0xFE, 0xEB, 0x0C, 0xDB, 0xA6, 0x3E, 0xEC, 0xB0, 0x36, 0xF6, 0x61,
+    0xA2, 0x5D, 0xFA, 0xE0, 0x47, 0x2F, 0xC3, 0xDC, 0x07, 0x17, 0x3C, 0x08, 0xEA, 0x03, 0x71, 0x7A,
+    0xE9, 0x83, 0x8D, 0x5E, 0x0A, 0x6C, 0x97, 0xFC, 0x69, 0x87, 0x6D, 0x57, 0x0F, 0x3E, 0xFB, 0x60,
+    0xB2, 0x07, 0x83, 0x7D, 0x38, 0x65, 0xDF, 0x25, 0x58, 0x04, 0xE9, 0x85, 0x97, 0x42, 0x6E, 0x16,
+    0x31, 0x07, 0x80, 0x8D, 0x32, 0x00, 0x32, 0xD0, 0xE7, 0x4C, 0x57, 0xFB, 0xB3, 0xB2, 0x0E, 0x3E,
+    0xE0, 0x3A, 0x65, 0xDC, 0xEE, 0xBA, 0xBB, 0x29, 0x97, 0xE9, 0x32, 0x91, 0x51, 0x56, 0xDC, 0xD1,
+    0x64, 0xB8, 0x26, 0xFB, 0xFD, 0x6A, 0xF0, 0x73, 0x6D, 0x42, 0xD4, 0x9C, 0xB5, 0xDE, 0x26, 0x0D,
+    0x61, 0x37, 0xC9, 0xCE, 0xCE, 0xAC, 0x2C, 0x49, 0xA1, 0x8A, 0x32, 0xEA, 0xF0, 0x09, 0x48, 0x36,
+    0xEB, 0x8E, 0xC2, 0xCF, 0x5D, 0x32, 0x7A, 0xFA, 0x51, 0x33, 0xEE, 0x35, 0xE3, 0x4A, 0x8A, 0xCE,
+    0x50, 0x26, 0x4A, 0x8C, 0x33, 0x08, 0xF0, 0x81, 0x36, 0xA1, 0x80, 0x44, 0x14, 0x08, 0x98, 0xDF,
+    0xF5, 0x20, 0x80, 0x86, 0x8A, 0x20, 0xAA, 0x6A, 0xF6, 0xA0, 0xA8, 0x1B, 0xE6, 0xD3, 0xD2, 0x1F,
+    0x41, 0xDA, 0xF2, 0xF9, 0x1B, 0x18, 0x37, 0xBB, 0x71, 0xE2, 0x47, 0xFC, 0x0C, 0x9B, 0xAE, 0x48,
+    0xE5, 0x02, 0x65, 0xC7, 0x9B, 0xD1, 0x46, 0x70, 0xB3, 0x63, 0x97, 0xAA, 0xBD, 0xBA, 0x47, 0xE9,
+    0xAA, 0x04, 0x51, 0xFB, 0x1D, 0xA5, 0xD8, 0x55, 0x89, 0x3F, 0x26, 0xBA, 0x28, 0x0B, 0x5E, 0x2D,
+    0xE1, 0x2E, 0x75, 0x6D, 0xCA, 0xE5, 0x32, 0x29, 0xBD, 0xF7, 0x2C, 0x34, 0xBB, 0xC3, 0x2E, 0x48,
+    0x21, 0xDA, 0x01, 0xC0, 0xED, 0x2B, 0x36, 0x40, 0x1B, 0x8E, 0x03, 0xDE, 0xE9, 0xB7, 0xF7, 0x38,
+    0xD2, 0xDE, 0x45, 0x3F, 0x9A, 0xAD, 0x8B, 0xC3, 0xDC, 0xA6, 0x2E, 0x82, 0x92, 0xC8, 0x1F, 0x3E,
+    0x8D, 0x28, 0x3F, 0x9E, 0xC0, 0xEA, 0xD8, 0xC5, 0x66, 0x73, 0x50, 0x95, 0xE4, 0x7B, 0xAE, 0x05,
+    0x05, 0x57, 0xEA, 0xDB, 0x74, 0x52, 0xFA, 0xE6, 0x7F, 0x5E, 0xA0, 0x23, 0xC1, 0x1D, 0xC4, 0x61,
+    0x40, 0x96, 0x45, 0x0E, 0x2C, 0x64, 0xD1, 0x6B, 0x91, 0x27, 0x1C, 0x84, 0x34, 0x00, 0x11, 0x65,
+    0x9A, 0x58, 0xEA, 0x44, 0x7A, 0x4B, 0xD5, 0x75, 0x81, 0x4E, 0xDB, 0xC7, 0xF3, 0xF9, 0x85, 0x0A,
+    0x5C, 0x73, 0x6F, 0xF5, 0x94, 0x5A, 0x96, 0xCB, 0xE5, 0xF8, 0xF6, 0x71, 0x5A, 0xB4, 0x89, 0xBD,
+    0x4C, 0x2A, 0x51, 0x36, 0x32, 0x5E, 0x14, 0xA1, 0x2E, 0xA9, 0x51, 0x3C, 0x10, 0x58, 0x56, 0xC1,
+    0x42, 0xA4, 0x01, 0x2F, 0xEE, 0x19, 0xA5, 0xE1, 0x5E, 0x57, 0x81, 0x08, 0xC0, 0x8D, 0x97, 0x66,
+    0xF3, 0xCA, 0xAE, 0xF4, 0x3F, 0xA4, 0x0A, 0x6A, 0xA7, 0x6E, 0x2B, 0xEC, 0x7A, 0xB9, 0x91, 0x40,
+    0xA0, 0x29, 0x3D, 0x22, 0x64, 0xA6, 0x44, 0x43, 0x2B, 0x41, 0x47, 0x09, 0xF2, 0x0E, 0x81, 0x5A,
+    0x1D, 0x87, 0x19, 0xF7, 0xD0, 0x1A, 0xEB, 0x25, 0x0E, 0x73, 0xC9, 0x3D, 0x5C, 0x5E, 0x1F, 0xBF,
+    0x56, 0xB5, 0x1E, 0x91, 0x4A, 0x23, 0xE5, 0xE8, 0xA8, 0x67, 0x28, 0x09, 0x87, 0xD0, 0x5D, 0xB3,
+    0x51, 0xAF, 0xC3, 0x08, 0x89, 0x42, 0x03, 0x8B, 0x8D, 0x10, 0x6C, 0x03, 0x4D, 0x70, 0x76, 0xDD,
+    0x89, 0xFB, 0x0C, 0x8A, 0x1D, 0xC6, 0xEE, 0x97, 0xD5, 0x63, 0xBE, 0x9C, 0xF2, 0x3E, 0x04, 0x8C,
+    0x4D, 0x6C, 0x19, 0x05, 0x35, 0x4B, 0x5D, 0x11, 0x74, 0xD9, 0x28, 0xED, 0xFB, 0x44, 0x29, 0x40,
+    0x8D, 0x13, 0xA4, 0x36, 0x61, 0x2B, 0x7B, 0x3C, 0x1C, 0xC9, 0xDD, 0x88, 0x8B, 0x1F, 0xD7, 0xD9,
+    0x81, 0x78, 0x95, 0x6E, 0xED, 0x3B, 0x51, 0x41, 0x50, 0xBF, 0x7D, 0x92, 0xF3, 0x0B, 0x28, 0x92,
+    0x52, 0x1D, 0x8E, 0x32, 0xCA, 0x17, 0xB7, 0x3A, 0xDD, 0x3C, 0x17, 0x8A, 0x9E, 0xA7, 0x14, 0x36,
+    0x82, 0x76, 0x82, 0x50, 0x4F, 0xFA, 0xAA, 0x61, 0xAE, 0x21, 0xC9, 0xF3, 0xD7, 0x07, 0xEB, 0x14,
+    0x3B, 0x16, 0xCA, 0xBF, 0x19, 0xB5, 0xEC, 0x95, 0xBB, 0xBA, 0xEF, 0xC3, 0xEB, 0xE3, 0xA6, 0x4A,
+    0x04, 0x8B, 0x9C, 0xAE, 0xE4, 0xA3, 0xAA, 0xDC, 0x1B, 0xC8, 0xF4, 0x0E, 0x13, 0xC0, 0xC6, 0x72,
+    0x25, 0x05, 0xD9, 0xFA, 0xC2, 0x01, 0xBE, 0x52, 0x50, 0xC1, 0xBD, 0xBA, 0x5E, 0x9F, 0xB6, 0xB5,
+    0x33, 0xC7, 0x1A, 0x36, 0xDC, 0x14, 0x82, 0xC5, 0x36, 0x86, 0xEA, 0xC5, 0x9E, 0x38, 0x70, 0xD1,
+    0x7F, 0x0E, 0xD5, 0x4B, 0xDD, 0x2B, 0x36, 0xE0, 0x7E, 0x3E, 0x45, 0x54, 0x8B, 0x7F, 0xC1, 0x3E,
+    0x5E, 0x49, 0x1B, 0x9F, 0x42, 0x48, 0x03, 0xCB, 0x31, 0x53, 0x4F, 0x1F, 0x5C, 0xBE, 0xFB, 0x52,
+    0xC1, 0x7C, 0xC5, 0x1D, 0x50, 0x30, 0x68, 0xC6, 0xFE, 0x44, 0x55, 0x98, 0x3F, 0x33, 0x39, 0xDA,
+    0x55, 0xAE, 0xFF, 0xCD, 0xF1, 0x48, 0x07, 0x0A, 0x37, 0xB2, 0x05, 0x6C, 0x64, 0x5B, 0xEB, 0x0C,
+    0xED, 0x17, 0x37, 0x63, 0xCE, 0xA7, 0x76, 0x6F, 0xD3, 0x50, 0x87, 0x2D, 0x44, 0x72, 0x28, 0xFC,
+    0x0F, 0xC9, 0xB8, 0x68, 0x07, 0x48, 0x1D, 0x2E, 0xB5, 0x0B, 0x9E, 0x0A, 0xF4, 0x6F, 0x8E, 0xFF,
+    0xC9, 0xF5, 0x17, 0xD5, 0x54, 0xB1, 0x8E, 0xD4, 0x30, 0x10, 0x9D, 0xC4, 0x40, 0x24, 0x52, 0x98,
+    0x1A, 0x8A, 0xFD, 0x04, 0xF7, 0x14, 0x38, 0x12, 0x1F, 0xC0, 0x15, 0x07, 0xBF, 0xC1, 0x27, 0x38,
+    0xA2, 0xA1, 0xA5, 0xA1, 0xA7, 0x44, 0xD7, 0xDC, 0x07, 0xC0, 0x6D, 0x42, 0x45, 0x41, 0x71, 0x01,
+    0x21, 0x51, 0xD0, 0x44, 0x02, 0x2A, 0x0A, 0x22, 0x11, 0xE9, 0xA2, 0xBB, 0x24, 0xE6, 0xBD, 0xC9,
+    0x66, 0xEF, 0x10, 0x15, 0x0D, 0x12, 0xD6, 0x6A, 0x76, 0x3C, 0xB1, 0x67, 0xDE, 0xBC, 0x19, 0x8F,
+    0xC8, 0x8D, 0x67, 0x82, 0x95, 0xB7, 0x7F, 0x23, 0x3D, 0xA4, 0xE9, 0x29, 0xD3, 0x81, 0x32, 0x19,
+    0x29, 0xE5, 0xAA, 0x9C, 0xFE, 0x90, 0x27, 0x57, 0xE4, 0xE4, 0x8B, 0xBD, 0x1C, 0x7D, 0x49, 0x0F,
+    0xAE, 0x86, 0xCF, 0xC1, 0xB6, 0x79, 0x9B, 0x77, 0xF9, 0x90, 0xB7, 0xAE, 0x35, 0xF1, 0xF8, 0x22,
+    0x96, 0x12, 0x63, 0x9C, 0x45, 0xEE, 0xC4, 0xC8, 0xF0, 0x9B, 0xF6, 0xEF, 0xD1, 0xAE, 0xEB, 0x71,
+    0xFC, 0x2A, 0x92, 0xC0, 0x5D, 0x23, 0xA9, 0x3A, 0x4D, 0xE1, 0x3D, 0x74, 0x49, 0x14, 0x49, 0x67,
+    0x81, 0x14, 0x5F, 0x87, 0x42, 0xC4, 0x0C, 0xBE, 0xC6, 0xA6, 0xB2, 0x1A, 0xF0, 0x53, 0x0F, 0x69,
+    0xCE, 0x47, 0x7A, 0x88, 0x15, 0xA5, 0xFB, 0x11, 0xB9, 0x2E, 0x54, 0xCE, 0x2A, 0xD7, 0x0F, 0xBC,
+    0x67, 0xCF, 0x3A, 0xDE, 0x18, 0x26, 0x9A, 0xA6, 0xC5, 0x55, 0x4E, 0x27, 0xBE, 0x64, 0x0C, 0xD7,
+    0x6C, 0xF0, 0xDD, 0xB5, 0x69, 0x2C, 0xC4, 0x77, 0xE2, 0xE6, 0xA3, 0xD8, 0x29, 0x2A, 0x44, 0xCB,
+    0x22, 0x10, 0x01, 0xE3, 0x21, 0xAF, 0x26, 0x0F, 0x15, 0x6D, 0x29, 0x0E, 0x88, 0xD3, 0xF8, 0xBC,
+    0x6A, 0x90, 0xBC, 0xAF, 0xC1, 0x85, 0x7F, 0x0A, 0x0F, 0xC1, 0xC1, 0xF3, 0x84, 0x9D, 0x39, 0x9B,
+    0x8F, 0x8E, 0x8E, 0x15, 0x53, 0x45, 0x40, 0x34, 0x9D, 0x0F, 0xC0, 0xF1, 0x19, 0xA7, 0xFC, 0x83,
+    0x5A, 0xD2, 0x11, 0x20, 0x6C, 0xEB, 0x41, 0xA5, 0x84, 0x6F, 0x8F, 0x7B, 0x09, 0x11, 0xB1, 0x1D,
+    0x03, 0x26, 0x07, 0x22, 0x5B, 0x06, 0xAB, 0x8E, 0x89, 0x33, 0xFE, 0x24, 0xCE, 0x38, 0xC2, 0x85,
+    0x84, 0x62, 0x03, 0x93, 0xAB, 0x0D, 0x4C, 0xB6, 0x11, 0x24, 0x98, 0x75, 0x02, 0x53, 0x3A, 0x08,
+    0x4D, 0xC8, 0x0E, 0xA6, 0x20, 0x34, 0xB9, 0x12, 0xE9, 0xF2, 0x10, 0x4C, 0x38, 0x04, 0x2D, 0x1D,
+    0xC9, 0x00, 0x0F, 0xC1, 0xE4, 0x49, 0x4A, 0x43, 0xB8, 0xAC, 0x2F, 0x5D, 0x1B, 0x32, 0x64, 0xDF,
+    0x93, 0xD3, 0x74, 0xD0, 0xF8, 0x81, 0x87, 0xC4, 0x2A, 0x81, 0xA9, 0x56, 0x5A, 0x42, 0xAF, 0x26,
+    0x25, 0x3E, 0x9D, 0x77, 0x35, 0xBC, 0x86, 0x2C, 0x24, 0xBC, 0x65, 0x66, 0x1D, 0xBC, 0xBB, 0x8F,
+    0x88, 0x6D, 0x6B, 0x04, 0xC5, 0x6F, 0x92, 0xB4, 0x07, 0x60, 0x19, 0x05, 0xFE, 0x81, 0x6C, 0x16,
+    0x57, 0x00, 0x9E, 0xAD, 0xB1, 0x27, 0xAC, 0x2D, 0xA0, 0x63, 0x4F, 0x68, 0x3D, 0x3E, 0xCB, 0x16,
+    0x77, 0xC5, 0x9E, 0x36, 0xA4, 0x90, 0x80, 0xC2, 0xC0, 0x78, 0x93, 0x22, 0x20, 0xFF, 0x2F, 0x6F,
+    0xBE, 0x60, 0xD5, 0x9E, 0x10, 0x41, 0xD6, 0x31, 0xB0, 0x6C, 0x99, 0xBA, 0xE4, 0x8D, 0xA2, 0x7D,
+    0x6D, 0x88, 0x33, 0x91, 0x5B, 0xF2, 0xDB, 0xA2, 0x57, 0x71, 0xDF, 0xE9, 0xD1, 0x8F, 0xF4, 0xE6,
+    0x23, 0xEF, 0x6E, 0x1A, 0x62, 0xC8, 0x09, 0x93, 0x04, 0x02, 0x67, 0x32, 0x2A, 0x5B, 0x5B, 0x25,
+    0xD3, 0x17, 0x34, 0x81, 0x4C, 0x98, 0xD8, 0xB4, 0xB3, 0xB2, 0xEC, 0xEA, 0x44, 0xE1, 0x92, 0x6B,
+    0x98, 0x70, 0x08, 0x26, 0x4B, 0x26, 0xFB, 0x9C, 0x01, 0x66, 0x43, 0xCC, 0x9A, 0xD3, 0x2E, 0xA9,
+    0x25, 0x2B, 0xD9, 0x9C, 0x92, 0x49, 0x73, 0xD1, 0x69, 0x71, 0x79, 0x48, 0x36, 0xDA, 0x90, 0x26,
+    0x2A, 0xC8, 0x0A, 0x87, 0x6E, 0x97, 0x47, 0x2C, 0x09, 0x0B, 0x13, 0x48, 0x4D, 0xD6, 0xD2, 0xFF,
+    0x09, 0x8B, 0x93, 0xD7, 0xF7, 0x70, 0xE8, 0x56, 0x72, 0x25, 0xAD, 0x7F, 0xC8, 0xFC, 0xD5, 0x95,
+    0xC6, 0xB9, 0x58, 0x89, 0x8D, 0xB1, 0xDB, 0xA9, 0xE8, 0xF3, 0x69, 0xD1, 0x4C, 0x2C, 0xD6, 0x3B,
+    0x39, 0xBC, 0x84, 0x5A, 0x55, 0xDB, 0x91, 0xF0, 0xE5, 0x56, 0xBD, 0x6C, 0xF5, 0x79, 0x6B, 0x21,
+    0x0B, 0x3E, 0xCB, 0xE5, 0x9D, 0x97, 0x28, 0x42, 0xD0, 0xD7, 0x0A, 0xE6, 0xCD, 0x40, 0x96, 0xD3,
+    0x11, 0x8D, 0x6C, 0xBA, 0x45, 0x05, 0xC9, 0xF9, 0x4E, 0x45, 0x66, 0xB6, 0xA1, 0x9A, 0x8C, 0x6C,
+    0xF6, 0x7A, 0xB1, 0xA2, 0x3C, 0xAE, 0x5C, 0x54, 0xB0, 0xE0, 0x8B, 0x9D, 0x5A, 0x81, 0x05, 0xF5,
+    0x3B, 0xA2, 0xFB, 0xB7, 0xB2, 0x44, 0xC3, 0x00, 0xC0, 0x16, 0x99, 0x67, 0xBD, 0x6C, 0xDE, 0x8C,
+    0x8A, 0x0C, 0x01, 0xEC, 0x87, 0x5E, 0xF8, 0x2C, 0x80, 0x37, 0xFF, 0xD2, 0x69, 0x16, 0x00, 0x6A,
+    0xCE, 0x5A, 0x31, 0x33, 0x06, 0x40, 0x81, 0x2A, 0x22, 0x93, 0x78, 0x7E, 0x3C, 0x71, 0x1E, 0xD4,
+    0xEC, 0xA7, 0xA8, 0xCF, 0x14, 0x9E, 0x6E, 0xF0, 0x25, 0xEB, 0x4B, 0x14, 0xB9, 0x7E, 0x20, 0xAB,
+    0xBA, 0xAC, 0x69, 0xAF, 0x25, 0xE3, 0x25, 0x9F, 0xC3, 0x5E, 0xCD, 0xBA, 0xBD, 0xBA, 0xD9, 0x8F,
+    0xC9, 0xBB, 0xB1, 0x5E, 0x55, 0x7F, 0x59, 0x0B, 0xDF, 0xAF, 0x13, 0x69, 0x59, 0x01, 0x4F, 0x74,
+    0x66, 0xA6, 0x29, 0x0B, 0x11, 0xB4, 0x1F, 0xE7, 0x47, 0xB1, 0x40, 0xA2, 0x59, 0xA7, 0x63, 0xCA,
+    0xE9, 0xC8, 0xA1, 0x00, 0x9D, 0xB6, 0x09, 0x4C, 0x15, 0x59, 0x3A, 0xF2, 0x66, 0x7A, 0x84, 0xF6,
+    0x25, 0x07, 0x55, 0x8F, 0xDE, 0xF6, 0x74, 0x65, 0x06, 0xA5, 0x6D, 0x52, 0xA2, 0xC8, 0xE5, 0xA2,
+    0xCD, 0x80, 0xAE, 0x5F, 0xB5, 0x45, 0xB7, 0xFA, 0x16, 0xFC, 0xFD, 0x5E, 0x43, 0x62, 0x78, 0x62,
+    0x10, 0x22, 0x24, 0x49, 0x7C, 0x47, 0xDF, 0xE4, 0xD1, 0x9E, 0xEA, 0x1F, 0x42, 0x67, 0x98, 0x26,
+    0x19, 0x50, 0x69, 0x93, 0x70, 0x94, 0x4E, 0xBB, 0xFE, 0xD2, 0xD1, 0x27, 0x3A, 0x52, 0x0E, 0x7F,
+    0x23, 0xEA, 0x92, 0x27, 0x33, 0xFC, 0xC9, 0x92, 0xDD, 0x93, 0xE4, 0x57, 0x8E, 0x5E, 0xC5, 0xB5,
+    0x39, 0xAB, 0xBD, 0x93, 0xAA, 0x95, 0xFF, 0x67, 0xFD, 0x02, 0x9D, 0x55, 0x3D, 0x73, 0xDE, 0x44,
+    0x10, 0xDE, 0x93, 0x82, 0x35, 0xA0, 0x81, 0xAB, 0x52, 0x8B, 0x7F, 0x70, 0x14, 0xE9, 0x4F, 0x4C,
+    0x4A, 0x0A, 0xBB, 0xC0, 0x61, 0x68, 0x08, 0x05, 0x15, 0x14, 0xFE, 0x05, 0x8E, 0xDE, 0x0C, 0x3F,
+    0x20, 0xAE, 0xA8, 0xF3, 0x13, 0x28, 0x28, 0x5C, 0x80, 0x4F, 0x26, 0x45, 0x8A, 0x14, 0x11, 0xA4,
+    0xA0, 0xA0, 0x11, 0x1F, 0x86, 0x82, 0x22, 0x0A, 0x68, 0x82, 0xEC, 0x39, 0xE9, 0x78, 0x9E, 0x3B,
+    0xD9, 0xB1, 0x81, 0x01, 0x86, 0x9B, 0xF7, 0xD5, 0xE9, 0xEE, 0xF6, 0x76, 0x9F, 0xDD, 0x7D, 0x76,
+    0x25, 0xA2, 0xBC, 0x70, 0xE8, 0x38, 0x6D, 0x85, 0xA5, 0x16, 0xC9, 0x42, 0x08, 0x9D, 0x88, 0xC5,
+    0xD4, 0x4B, 0x11, 0xB6, 0x7D, 0x33, 0x88, 0xED, 0x5F, 0xA9, 0xCD, 0x90, 0xCD, 0x10, 0x32, 0x5D,
+    0xD5, 0x63, 0xB2, 0xAD, 0xE3, 0x95, 0xE6, 0xE6, 0xC4, 0x29, 0x54, 0xB8, 0x21, 0x99, 0x6F, 0xB8,
+    0x28, 0x9E, 0x47, 0x6D, 0xFA, 0xDB, 0x81, 0x93, 0xDD, 0x6B, 0x39, 0xCD, 0x51, 0x3C, 0x5F, 0x8F,
+    0xBE, 0x89, 0x47, 0xCD, 0xED, 0x74, 0xCB, 0x6E, 0xB8, 0x37, 0x44, 0x09, 0x7B, 0x77, 0x89, 0x7B,
+    0x39, 0x6D, 0x55, 0x3D, 0xA6, 0x1D, 0x15, 0xA4, 0x58, 0xF4, 0x04, 0x18, 0x05, 0x30, 0x05, 0x68,
+    0x89, 0xD0, 0x44, 0xB9, 0x30, 0xBD, 0x00, 0x0F, 0x60, 0xF2, 0xA7, 0x51, 0xD1, 0xB2, 0xA6, 0x8C,
+    0x0B, 0xA3, 0x28, 0xDC, 0x6A, 0x55, 0x70, 0xC1, 0x4B, 0x28, 0xFA, 0xA6, 0xA5, 0xA2, 0xD1, 0xC2,
+    0x61, 0x67, 0x20, 0xA7, 0x1F, 0x41, 0x63, 0xFE, 0x3B, 0x85, 0x17, 0x9A, 0xB6, 0x0E, 0x27, 0xFA,
+    0x29, 0x37, 0xCF, 0xB8, 0x39, 0xD3, 0xB5, 0x46, 0xC3, 0x86, 0xF9, 0x12, 0xF6, 0xAA, 0xCE, 0x1E,
+    0xFB, 0x6A, 0x20, 0x92, 0x81, 0xA1, 0xEA, 0xA9, 0xFE, 0x00, 0xC2, 0x4B, 0x74, 0x2C, 0xD9, 0xFF,
+    0x70, 0x93, 0xE6, 0x02, 0xD6, 0xE3, 0x80, 0xE0, 0x7D, 0xCE, 0x6A, 0xDC, 0x0A, 0x11, 0x6D, 0x71,
+    0x7C, 0xFF, 0xA3, 0x74, 0xA4, 0xFB, 0x15, 0xB4, 0x69, 0xCF, 0xD1, 0x9F, 0xBB, 0xF1, 0xD9, 0xF9,
+    0x46, 0xBD, 0xBE, 0xBC, 0x7F, 0xD5, 0xCD, 0x02, 0xBA, 0x0C, 0xED, 0x02, 0x4B, 0x19, 0xC2, 0x46,
+    0xAA, 0xC5, 0xB5, 0xD5, 0x2F, 0x78, 0x09, 0xF5, 0xCB, 0x72, 0x43, 0xDC, 0xA6, 0x8C, 0xE1, 0x16,
+    0x27, 0x4D, 0x52, 0xB1, 0x64, 0x29, 0x64, 0xCA, 0xAF, 0x66, 0x53, 0x20, 0x08, 0xE3, 0x3B, 0xBF,
+    0xC2, 0x78, 0x94, 0xEE, 0x48, 0xB3, 0x02, 0x52, 0xDE, 0xA5, 0x8D, 0xFC, 0xD7, 0x69, 0x85, 0x4C,
+    0x91, 0x97, 0xEA, 0x55, 0xA4, 0x59, 0x45, 0xC8, 0xA8, 0xE2, 0x19, 0x1F, 0x38, 0x35, 0x0F, 0xC6,
+    0x94, 0x86, 0x85, 0x86, 0x1A, 0x1A, 0x82, 0x2C, 0x45, 0x4C, 0x8B, 0xAC, 0x43, 0x44, 0x2D, 0xC0,
+    0x47, 0xA7, 0xF5, 0x20, 0x61, 0x93, 0x85, 0x4E, 0x85, 0x8D, 0x0A, 0x67, 0x21, 0x9C, 0xB9, 0x89,
+    0x31, 0x5D, 0x1A, 0x7A, 0x84, 0x04, 0x1E, 0x18, 0xE6, 0x9C, 0xF6, 0xD4, 0xCE, 0x65, 0xEF, 0x5D,
+    0xB7, 0x86, 0xF6, 0xC7, 0x18, 0x8B, 0x13, 0x17, 0x38, 0x7F, 0x2E, 0x0D, 0xF1, 0x6F, 0xDD, 0x1C,
+    0xAE, 0x27, 0x2F, 0x52, 0x2A, 0xD4, 0x0A, 0xBD, 0x5C, 0x97, 0xAB, 0x8F, 0x87, 0x69, 0xBA, 0x76,
+    0x25, 0xAC, 0xEF, 0xE2, 0xFA, 0x0E, 0x2D, 0x4B, 0x05, 0xCB, 0x36, 0x0C, 0x40, 0xD3, 0xEA, 0xD3,
+    0xF7, 0xE4, 0xB5, 0x5B, 0x8B, 0x9A, 0xA3, 0xB1, 0x31, 0x32, 0x57, 0xCC, 0xC3, 0xE1, 0x72, 0x84,
+    0x56, 0xE2, 0xCB, 0xB2, 0x24, 0x5B, 0x24, 0x11, 0x14, 0x1D, 0x61, 0x69, 0x36, 0x71, 0x99, 0x01,
+    0xC6, 0xE2, 0xE2, 0x52, 0xFF, 0x3C, 0xC4, 0xE5, 0x8C, 0x04, 0x60, 0x69, 0x1E, 0x78, 0xC9, 0x27,
+    0xFC, 0xAA, 0x41, 0x5C, 0x2F, 0x41, 0x1C, 0x1C, 0x3A, 0x71, 0x3D, 0x8A, 0x72, 0x08, 0xA0, 0x7B,
+    0x11, 0xA6, 0x2C, 0xC0, 0x38, 0x63, 0xF0, 0xF6, 0x15, 0xB8, 0x60, 0x62, 0x4C, 0x1D, 0x18, 0x10,
+    0x22, 0xAA, 0x1B, 0x85, 0x7C, 0xCA, 0x39, 0x93, 0xD7, 0x95, 0xFC, 0x75, 0xE4, 0xC8, 0x0C, 0x93,
+    0x3E, 0xC3, 0x07, 0x58, 0x14, 0xFD, 0x04, 0x0F, 0xFA, 0x73, 0xB1, 0xF1, 0xB5, 0x4F, 0x6C, 0x9C,
+    0xF1, 0x20, 0x61, 0xAA, 0x63, 0x1F, 0x93, 0x09, 0xD6, 0x20, 0xE6, 0x33, 0xDF, 0x17, 0xD6, 0x28,
+    0x0E, 0x91, 0xDD, 0x2C, 0xD0, 0x1F, 0x38, 0x65, 0x07, 0x5C, 0x2F, 0x58, 0xAC, 0x35, 0x0C, 0xC0,
+    0x04, 0x61, 0x0F, 0xD0, 0xA8, 0x9F, 0xB6, 0xA0, 0xA0, 0x69, 0xB3, 0x53, 0x4F, 0xBA, 0xCF, 0x62,
+    0xB7, 0x3B, 0x3C, 0x75, 0x5F, 0xA0, 0xF4, 0x2B, 0x9E, 0x1D, 0x15, 0x03, 0x62, 0x91, 0x8F, 0x1A,
+    0xE4, 0xC0, 0x45, 0x7B, 0xD7, 0x67, 0x9E, 0x1C, 0xF1, 0xA6, 0xD6, 0xDD, 0x11, 0x20, 0xFD, 0x80,
+    0xA8, 0x68, 0x92, 0xAD, 0x49, 0xAD, 0x24, 0x27, 0xF5, 0x61, 0x47, 0x0C, 0x16, 0x81, 0x61, 0x87,
+    0xEF, 0xE5, 0x1C, 0x73, 0x93, 0xBC, 0xB9, 0x18, 0x6A, 0x77, 0x77, 0x77, 0xE7, 0x45, 0x9C, 0xAA,
+    0x77, 0x4E, 0xF6, 0x19, 0x85, 0xFA, 0x8D, 0x42, 0xFE, 0x7E, 0x80, 0xA5, 0x24, 0xEA, 0x91, 0x8D,
+    0xC4, 0x35, 0xF7, 0x5A, 0x62, 0xD4, 0x4F, 0x46, 0xC9, 0xE1, 0xE0, 0x38, 0xC7, 0x08, 0x78, 0xA4,
+    0x0C, 0x40, 0x1B, 0x80, 0x2C, 0x7B, 0x9C, 0x7B, 0x06, 0xAA, 0xEC, 0xE9, 0x34, 0x64, 0xB0, 0xD5,
+    0x74, 0xCA, 0x43, 0x8B, 0x9D, 0xE4, 0x08, 0x82, 0x95, 0xC3, 0xA3, 0xEC, 0xF5, 0xE3, 0x0E, 0xAA,
+    0x7C, 0xF1, 0x95, 0x2F, 0x01, 0xFF, 0xE3, 0xC1, 0x52, 0xE3, 0xB3, 0xB1, 0xFC, 0x1E, 0x51, 0xFF,
+    0xC2, 0xCB, 0x0C, 0xAB, 0x7A, 0x16, 0x33, 0xB3, 0x17, 0xC3, 0x45, 0x89, 0x89, 0x72, 0x17, 0xC0,
+    0x62, 0x9B, 0x66, 0x2B, 0xDC, 0xB0, 0xFD, 0x4C, 0x02, 0x76, 0x56, 0xE8, 0xD0, 0xCC, 0x7D, 0x6A,
+    0xC6, 0x17, 0x6D, 0x24, 0x8F, 0xEB, 0x58, 0xF4, 0xC5, 0x90, 0x3A, 0x00, 0xA5, 0xFE, 0xE1, 0x35,
+    0xCA, 0xA6, 0x6B, 0x96, 0x1A, 0x62, 0xCB, 0x67, 0x6D, 0xF2, 0x2C, 0x76, 0xEB, 0x48, 0xAE, 0x32,
+    0x9C, 0xA1, 0x66, 0xAA, 0xC8, 0xB4, 0x2A, 0x76, 0x61, 0x15, 0x2B, 0x6C, 0xBD, 0xF9, 0x5F, 0x5E,
+    0xD5, 0xAE, 0xC8, 0x1E, 0xD9, 0x1C, 0x7C, 0xB9, 0xDC, 0x9A, 0xF8, 0x51, 0xA1, 0x45, 0x02, 0x20,
+    0x9E, 0x65, 0xFD, 0xCF, 0xEB, 0xFF, 0x7C, 0xED, 0xD6, 0xF6, 0x4A, 0x59, 0xDE, 0x29, 0x97, 0x4F,
+    0x5A, 0xE8, 0x68, 0xA1, 0x0B, 0x3B, 0xB7, 0xD9, 0xC9, 0xFF, 0xE5, 0xBF, 0xD2, 0x9F, 0xF1, 0x2A,
+    0x40, 0x5B, 0xEE, 0x95, 0x9D, 0xA9, 0x41, 0x1B, 0x64, 0x5A, 0x25, 0x72, 0xF0, 0x91, 0x93, 0x57,
+    0x05, 0x49, 0xA5, 0x1F, 0xB2, 0x74, 0xEB, 0xFD, 0x57, 0xC5, 0xCA, 0x35, 0xDB, 0xB2, 0x0A, 0x4E,
+    0x27, 0xCA, 0x32, 0x2C, 0x86, 0xBD, 0x5D, 0x33, 0xE6, 0x06, 0x05, 0x2B, 0x77, 0x98, 0x03, 0x8F,
+    0xCA, 0x8B, 0xAD, 0x26, 0x8F, 0x81, 0xBB, 0xF4, 0x61, 0x52, 0x3D, 0x2B, 0x0D, 0x69, 0xDB, 0x46,
+    0xE6, 0x60, 0x4F, 0x3E, 0x88, 0xDB, 0x68, 0x52, 0x26, 0xBC, 0xB9, 0x17, 0x82, 0x0E, 0x9B, 0x7D,
+    0x7B, 0x20, 0xA9, 0x4D, 0x55, 0x8F, 0x7F, 0x1B, 0x0F, 0x75, 0x7D, 0x48, 0x04, 0xE3, 0x1D, 0xFD,
+    0xD6, 0xBD, 0xD8, 0xA3, 0x15, 0xBE, 0x33, 0xE8, 0x76, 0xE5, 0x4F, 0x61, 0x99, 0xC4, 0x3D, 0xAF,
+    0xE5, 0xBA, 0xFC, 0xDF, 0xF1, 0x07, 0xC5, 0x54, 0x2D, 0x6C, 0x15, 0x41, 0x10, 0xDE, 0x7D, 0xD7,
+    0xE6, 0x20, 0x97, 0xB0, 0x08, 0x50, 0x84, 0x9C, 0x41, 0x11, 0xE0, 0x19, 0x64, 0x61, 0x2F, 0x21,
+    0x41, 0x23, 0xDA, 0x20, 0x10, 0x68, 0x54, 0x4D, 0x65, 0xD3, 0xBB, 0x04, 0x51, 0xD9, 0x0A, 0xF0,
+    0x15, 0xA8, 0x22, 0x6A, 0x10, 0x08, 0xC2, 0x5D, 0x55, 0x65, 0x1F, 0x21, 0x55, 0x08, 0x0E, 0x41,
+    0x08, 0x20, 0x7A, 0x84, 0x27, 0x1E, 0xC9, 0xDD, 0x2D, 0xDF, 0x37, 0x7B, 0xF7, 0xFA, 0x97, 0x22,
+    0x9A, 0x26, 0x6C, 0x93, 0xDE, 0x37, 0xFB, 0x66, 0x67, 0xE6, 0xFB, 0x66, 0x76, 0x95, 0xC2, 0xBA,
+    0xAC, 0xFA, 0x15, 0xBA, 0xAC, 0x87, 0xC6, 0x95, 0x3D, 0xBC, 0xA3, 0xAB, 0x1E, 0xCE, 0xA9, 0x25,
+    0x75, 0xFA, 0x0A, 0x5B, 0xF9, 0xE4, 0x08, 0x32, 0x74, 0x05, 0x50, 0xE0, 0x70, 0xF2, 0xDE, 0xE3,
+    0x11, 0x60, 0xF4, 0xF2, 0xAD, 0xC2, 0x61, 0x06, 0xBD, 0x84, 0x30, 0x5D, 0xD2, 0x19, 0xFC, 0x9D,
+    0x75, 0x3D, 0xEA, 0xBE, 0xB3, 0x2A, 0x72, 0x1E, 0x69, 0x57, 0xFA, 0xBC, 0xCC, 0x3C, 0x99, 0x1B,
+    0x78, 0x06, 0x51, 0xB2, 0xBC, 0xA4, 0x3C, 0x03, 0xA3, 0xAE, 0xAB, 0x73, 0x58, 0x3E, 0xF3, 0x55,
+    0xC6, 0x96, 0xCC, 0x03, 0x37, 0xEA, 0x19, 0x87, 0x6E, 0x0C, 0x95, 0x24, 0xB3, 0x49, 0x96, 0x0F,
+    0x18, 0xDF, 0xFA, 0x47, 0xB8, 0xC0, 0x25, 0x67, 0x52, 0xFD, 0xF6, 0x41, 0x84, 0x62, 0x0A, 0xDF,
+    0x4D, 0x91, 0x99, 0xF6, 0x52, 0x8F, 0xFD, 0xF7, 0x0A, 0xAA, 0x4C, 0xFA, 0x03, 0x41, 0x17, 0xFE,
+    0xBE, 0x52, 0x29, 0x3E, 0x6F, 0x40, 0xC3, 0xBB, 0xE5, 0x08, 0x66, 0x24, 0x60, 0xCE, 0x62, 0xDE,
+    0x13, 0xA5, 0x74, 0x96, 0x13, 0x83, 0x89, 0x14, 0xC7, 0x7F, 0x17, 0xC5, 0x3D, 0x39, 0x73, 0xE3,
+    0x66, 0x54, 0xF4, 0xA7, 0x83, 0x8D, 0x4A, 0xBB, 0x1E, 0x9A, 0x36, 0x49, 0xBB, 0xCA, 0x5C, 0xAB,
+    0x16, 0xBB, 0xDF, 0xAF, 0x95, 0xEA, 0x5C, 0xD6, 0x5D, 0x19, 0x08, 0xC9, 0x23, 0xF3, 0x59, 0xFB,
+    0xE4, 0x6C, 0x21, 0xED, 0xA8, 0xE2, 0x10, 0x71, 0x5C, 0x95, 0x05, 0x2F, 0x3B, 0x92, 0x1F, 0xC9,
+    0x38, 0x93, 0x13, 0x91, 0xD7, 0x59, 0x4F, 0xD8, 0x13, 0x59, 0xC3, 0x29, 0xFD, 0xC1, 0xB4, 0x5D,
+    0x94, 0xF4, 0x64, 0x63, 0x6E, 0xF8, 0xCF, 0x33, 0xA5, 0x5F, 0x61, 0x4C, 0x4A, 0x9F, 0x40, 0x85,
+    0x38, 0x35, 0x68, 0x1E, 0xB6, 0xD2, 0x7B, 0xB9, 0x7D, 0xB1, 0x5B, 0x3F, 0x56, 0xF4, 0x8A, 0x54,
+    0x16, 0x4A, 0x6D, 0xD2, 0x2B, 0x2B, 0x86, 0x11, 0x43, 0x3B, 0x31, 0xEC, 0x16, 0x0D, 0xF3, 0x9B,
+    0x86, 0x6E, 0x2C, 0x0D, 0xFB, 0x9C, 0x86, 0xA9, 0x68, 0xE8, 0x26, 0xA0, 0x61, 0x33, 0x1A, 0x51,
+    0x45, 0x43, 0x37, 0x8A, 0x86, 0xCD, 0x68, 0x80, 0x38, 0x0C, 0x6C, 0xC1, 0x28, 0x6D, 0x06, 0x63,
+    0x05, 0x5B, 0x30, 0xBE, 0x34, 0xAC, 0x72, 0x05, 0x5B, 0x30, 0x7E, 0x32, 0x91, 0x4A, 0x1B, 0x8E,
+    0x82, 0x3C, 0x15, 0x56, 0x06, 0x23, 0x70, 0xDF, 0x28, 0xA1, 0x6D, 0xD2, 0x8C, 0x86, 0xA7, 0x2C,
+    0xCA, 0xAA, 0x58, 0x66, 0x30, 0xF0, 0x83, 0x95, 0xFA, 0xEB, 0xE8, 0x75, 0xF2, 0x4F, 0xC5, 0xB0,
+    0xD7, 0x47, 0x27, 0xBC, 0x4F, 0x2B, 0x74, 0xC5, 0x98, 0xB1, 0xFA, 0x51, 0x8C, 0x9E, 0x3B, 0x57,
+    0xB3, 0x37, 0xCD, 0xE1, 0xB1, 0xE9, 0xE6, 0x64, 0x84, 0x7D, 0x76, 0xC7, 0x56, 0x80, 0x86, 0x10,
+    0x52, 0x00, 0xDA, 0x14, 0x30, 0xFA, 0x08, 0xA8, 0x6B, 0x0B, 0x68, 0x03, 0xC0, 0xA8, 0x04, 0xD4,
+    0x35, 0xA1, 0x4D, 0x00, 0xA3, 0x92, 0xB0, 0x06, 0x81, 0xC6, 0x26, 0x80, 0x3B, 0x25, 0x61, 0x8D,
+    0xDC, 0x06, 0x97, 0xD1, 0x2A, 0xBC, 0x5B, 0x81, 0xDB, 0x45, 0x6E, 0x5B, 0x83, 0xA7, 0xE7, 0xA4,
+    0x27, 0xD3, 0x86, 0xFB, 0xBB, 0x23, 0x7C, 0xA2, 0xB2, 0x1F, 0x21, 0x0C, 0x88, 0x16, 0xD6, 0xB1,
+    0x78, 0x13, 0xEA, 0xC5, 0xBD, 0x79, 0xC4, 0x70, 0x38, 0x1F, 0x08, 0x95, 0x9B, 0xED, 0x66, 0x76,
+    0xD8, 0xE1, 0x08, 0xDC, 0x5B, 0x60, 0x3B, 0x39, 0x05, 0x31, 0xFF, 0xEB, 0x76, 0x73, 0xAB, 0xA5,
+    0x43, 0x3C, 0xA6, 0x83, 0xCD, 0x00, 0x07, 0x35, 0x61, 0x5C, 0x00, 0x6A, 0x81, 0x43, 0xC2, 0x40,
+    0x60, 0x4E, 0x87, 0xB4, 0x62, 0x84, 0x9A, 0x11, 0x5A, 0x06, 0xC3, 0x05, 0xD3, 0x1B, 0xD3, 0x0A,
+    0x39, 0x73, 0x54, 0x0E, 0x0C, 0x48, 0x66, 0xC8, 0xC2, 0x22, 0x07, 0xB2, 0xFA, 0xE9, 0xD7, 0xF9,
+    0xBE, 0x4F, 0xC7, 0x3D, 0x4F, 0xDF, 0x44, 0x8E, 0x75, 0xB2, 0x73, 0x09, 0x66, 0xD7, 0x55, 0xD8,
+    0xF4, 0x2D, 0x89, 0x0B, 0x78, 0x06, 0x63, 0x7A, 0xD6, 0xF4, 0x64, 0x47, 0x54, 0x9A, 0xD9, 0x1F,
+    0xAF, 0x5D, 0x41, 0xCF, 0x02, 0x62, 0xB4, 0x09, 0xAE, 0xFC, 0xF7, 0x84, 0xD5, 0x8E, 0x42, 0x9E,
+    0x8E, 0x0B, 0x9D, 0x97, 0x6C, 0xFC, 0x07, 0x92, 0x5D, 0x85, 0xC2, 0xB9, 0x10, 0xC6, 0x56, 0xF8,
+    0x8B, 0x4C, 0x77, 0xAA, 0x30, 0x6B, 0x11, 0x7A, 0x75, 0x8C, 0xA9, 0xCD, 0xB7, 0x9B, 0x85, 0xBC,
+    0xE6, 0xC1, 0x02, 0x54, 0xF1, 0x7C, 0x6C, 0xBE, 0xA0, 0x08, 0xBA, 0xC6, 0x94, 0x0F, 0x4A, 0xCA,
+    0x23, 0xED, 0x11, 0x65, 0x79, 0x3F, 0xBC, 0xD0, 0x47, 0xB7, 0xB0, 0x16, 0x94, 0xD9, 0x86, 0x50,
+    0x75, 0xEA, 0x6A, 0xB3, 0xBF, 0x97, 0x56, 0xB8, 0xFB, 0xE9, 0xDA, 0x04, 0x59, 0xF1, 0x1A, 0x99,
+    0xCF, 0x70, 0x6A, 0x5B, 0x3E, 0xF2, 0xE8, 0x31, 0xA7, 0x3E, 0x14, 0xD0, 0x76, 0x20, 0x77, 0xEA,
+    0x82, 0xD9, 0xAF, 0x82, 0xB2, 0x71, 0xD9, 0x70, 0x6B, 0xB7, 0x55, 0x6E, 0xE2, 0xDA, 0x27, 0xCE,
+    0x7C, 0x42, 0x4D, 0x4D, 0xEC, 0x1A, 0x33, 0x9A, 0x7D, 0x50, 0x51, 0x8D, 0x35, 0xE8, 0xB0, 0xD1,
+    0xF4, 0xD2, 0x9D, 0x04, 0xFF, 0x71, 0xFD, 0x05, 0xB5, 0x55, 0x3D, 0x8F, 0xDC, 0x36, 0x10, 0x1D,
+    0xAD, 0x80, 0xA8, 0x50, 0x41, 0x37, 0x4E, 0x8A, 0x00, 0xD1, 0x0F, 0x08, 0x60, 0xFD, 0x04, 0xC9,
+    0x75, 0x1A, 0x37, 0x5B, 0xA5, 0x4D, 0xE5, 0xE6, 0x7E, 0x02, 0x17, 0x69, 0x53, 0xFB, 0x3F, 0xD8,
+    0xDB, 0xB8, 0x4D, 0xB5, 0x52, 0x9C, 0xC2, 0xAD, 0x90, 0x36, 0x45, 0x98, 0x2A, 0x40, 0xAE, 0x38,
+    0x1D, 0xB2, 0x85, 0x92, 0x5B, 0x72, 0xFC, 0xDE, 0x50, 0x7B, 0x39, 0x9C, 0x0D, 0xE3, 0x5C, 0x58,
+    0xC6, 0xD0, 0xB3, 0xC3, 0xE1, 0x7C, 0x3C, 0x3E, 0xCE, 0x89, 0xC8, 0x63, 0x11, 0x71, 0xA3, 0x48,
+    0x39, 0x43, 0x39, 0x41, 0x3A, 0x1A, 0xDE, 0xAA, 0xEA, 0x35, 0xE4, 0xE4, 0xB1, 0x34, 0xD8, 0xAE,
+    0xB0, 0x5D, 0x70, 0xDB, 0x43, 0x3E, 0x8B, 0x01, 0x5F, 0xBB, 0x93, 0x3A, 0xC8, 0x66, 0x11, 0x39,
+    0xE4, 0x1F, 0x57, 0xAA, 0x37, 0xAA, 0x29, 0x6D, 0xB7, 0x5D, 0x2F, 0x6E, 0x92, 0xF2, 0x28, 0x12,
+    0x51, 0xE2, 0x83, 0x7F, 0x48, 0xC1, 0x26, 0xEE, 0x2C, 0xCC, 0xF6, 0xD0, 0xE5, 0xDB, 0xB4, 0x7F,
+    0x29, 0x9D, 0xEA, 0x92, 0x97, 0xCD, 0xA7, 0x9C, 0xBD, 0xB7, 0xF0, 0x2B, 0x55, 0xA3, 0x49, 0xDA,
+    0xBF, 0x62, 0x85, 0xF7, 0xE5, 0xAB, 0x7F, 0xB7, 0x32, 0xA8, 0x8E, 0x14, 0xEA, 0x1F, 0xF2, 0xB9,
+    0x2B, 0xBC, 0x1A, 0x69, 0xB0, 0x8C, 0x15, 0x96, 0x39, 0xE7, 0x31, 0x24, 0x89, 0xAD, 0x81, 0x2B,
+    0x1F, 0x33, 0x3E, 0x7F, 0x25, 0x3C, 0x1E, 0x85, 0xC7, 0x43, 0x11, 0x9F, 0x5E, 0x28, 0x3D, 0xFD,
+    0x0C, 0xCF, 0x32, 0xD2, 0xB3, 0xFB, 0x05, 0x9E, 0xD5, 0x91, 0xC7, 0x13, 0x8F, 0xB7, 0x6F, 0x61,
+    0xAC, 0xAF, 0x4F, 0x0C, 0x41, 0xA3, 0xFF, 0xDF, 0xC8, 0xB8, 0xA5, 0xC5, 0x4D, 0x16, 0xBC, 0x27,
+    0x93, 0x98, 0xB1, 0x0D, 0xF2, 0x48, 0xDA, 0x59, 0xDC, 0xDF, 0x3A, 0x13, 0x02, 0x38, 0x0E, 0x3A,
+    0x61, 0x63, 0xBB, 0xC2, 0x82, 0xE4, 0x3B, 0x93, 0xFD, 0xBE, 0xC7, 0xA5, 0xC9, 0x7D, 0x49, 0xFB,
+    0x67, 0xF0, 0x49, 0xF4, 0x1B, 0xD3, 0xD3, 0x61, 0x8E, 0x52, 0x2F, 0x11, 0xB9, 0xB0, 0x17, 0x21,
+    0x09, 0x32, 0xDC, 0x15, 0xC9, 0x72, 0xC8, 0xA5, 0x14, 0x91, 0x75, 0x15, 0x7D, 0x7D, 0xDC, 0x24,
+    0x9D, 0x37, 0xC8, 0x63, 0x5E, 0x62, 0xEC, 0xA8, 0x26, 0x34, 0xC2, 0x6B, 0x85, 0x73, 0xB7, 0x73,
+    0x33, 0xD9, 0x87, 0xB5, 0xDB, 0xC1, 0x40, 0x73, 0xA2, 0x61, 0x20, 0x04, 0x30, 0x34, 0x28, 0xBA,
+    0x1D, 0xEB, 0x50, 0x2E, 0x2C, 0x1A, 0x06, 0x65, 0xCB, 0x4B, 0x1D, 0x5A, 0xB6, 0xE9, 0xA6, 0x83,
+    0x61, 0x2B, 0xFE, 0xBB, 0x3F, 0x2D, 0xFE, 0xE6, 0x74, 0x40, 0x1C, 0xEE, 0xDC, 0x5C, 0xD9, 0x06,
+    0xEE, 0x2B, 0x27, 0x76, 0x97, 0x97, 0x66, 0x28, 0xE1, 0xC1, 0xA3, 0x32, 0xD4, 0x41, 0x8D, 0xFE,
+    0xD3, 0xC1, 0x82, 0x57, 0xC7, 0x3A, 0x30, 0x1B, 0xF2, 0x1F, 0xAC, 0x97, 0x8E, 0x69, 0x4F, 0x86,
+    0xF2, 0x41, 0x5C, 0x60, 0x53, 0x28, 0x0C, 0x18, 0xE7, 0x4A, 0xA3, 0xAC, 0xA5, 0xEB, 0xAF, 0x6B,
+    0x2F, 0xA7, 0xA1, 0xA7, 0xA1, 0xD0, 0x71, 0x05, 0xF9, 0xCC, 0x41, 0xF7, 0xE9, 0x86, 0xDB, 0x0F,
+    0x88, 0x20, 0x66, 0x3B, 0xA2, 0x80, 0x03, 0x4B, 0xE9, 0x76, 0x75, 0x20, 0x95, 0x22, 0x7E, 0xA2,
+    0x96, 0x6A, 0xAE, 0x83, 0x33, 0x8C, 0x72, 0x17, 0xE8, 0x2A, 0x19, 0x42, 0x87, 0x0C, 0xD0, 0xE5,
+    0x5F, 0xD6, 0x75, 0x97, 0x51, 0xA8, 0x6F, 0xAE, 0xC2, 0x1D, 0x94, 0x7C, 0x1D, 0x68, 0x6E, 0x80,
+    0xA2, 0xB1, 0x1B, 0x00, 0x8C, 0xB7, 0xFD, 0x33, 0x11, 0x92, 0x3B, 0xEB, 0xFE, 0xBF, 0x1F, 0xAD,
+    0x8C, 0x2E, 0x0E, 0xD6, 0xAA, 0x51, 0x69, 0x65, 0x8A, 0x5D, 0xC3, 0x43, 0x7E, 0xE6, 0xD6, 0xBE,
+    0xD6, 0xD4, 0x97, 0x64, 0x95, 0xD3, 0xD7, 0x3A, 0x7E, 0xB3, 0xA2, 0x35, 0xF4, 0x2B, 0x87, 0xAD,
+    0x09, 0x17, 0x32, 0x53, 0xF2, 0xE3, 0x6F, 0x27, 0xD9, 0x7E, 0x0F, 0xEE, 0xE1, 0x20, 0xC0, 0xC6,
+    0xF2, 0xF8, 0xB9, 0x9D, 0xF1, 0xE3, 0x99, 0xED, 0xFE, 0x9C, 0x8D, 0x0F, 0x34, 0xE7, 0x63, 0xC0,
+    0xF2, 0xF4, 0x03, 0xF6, 0x7E, 0xD3, 0xFD, 0x90, 0x6A, 0x64, 0x9C, 0xF0, 0xE2, 0xB0, 0xFF, 0x25,
+    0x7D, 0x36, 0xF6, 0x72, 0x98, 0xA6, 0xB6, 0xE7, 0x72, 0xAE, 0x4F, 0x03, 0x27, 0xC6, 0x19, 0xFB,
+    0xED, 0x33, 0x69, 0x55, 0x7B, 0x3C, 0xF9, 0xD0, 0xBD, 0xB8, 0x38, 0x3E, 0xB2, 0xEA, 0x58, 0x13,
+    0x85, 0x7A, 0x6D, 0xDC, 0x2E, 0x01, 0x2E, 0xFE, 0x47, 0xDA, 0x7A, 0x59, 0xDF, 0x79, 0x5C, 0xDB,
+    0x89, 0x3D, 0x09, 0xF7, 0xE2, 0x62, 0xC1, 0x78, 0x09, 0x17, 0x2C, 0xBE, 0x01, 0xF0, 0x78, 0x01,
+    0xB9, 0x82, 0x25, 0x4B, 0xB1, 0x70, 0x00, 0x40, 0x32, 0x52, 0x9E, 0x41, 0xC8, 0x6B, 0xBF, 0x83,
+    0xDA, 0x04, 0xA8, 0x48, 0xE6, 0xC9, 0x7F, 0xA8, 0xE8, 0xD8, 0xF3, 0x56, 0xAA, 0x99, 0xE4, 0xF4,
+    0xEC, 0xB4, 0x9A, 0x81, 0x11, 0x6E, 0x13, 0x9D, 0x55, 0xD7, 0x4C, 0xEB, 0x3D, 0xB3, 0xB0, 0x5B,
+    0xF1, 0x9D, 0x8D, 0x7C, 0xF6, 0xE4, 0x2B, 0x0E, 0x96, 0xB9, 0x61, 0x64, 0xC4, 0x86, 0xBA, 0x49,
+    0x54, 0x71, 0x8E, 0x71, 0xA7, 0xDB, 0x14, 0x08, 0x0C, 0xD5, 0x29, 0xB9, 0xD3, 0x25, 0x96, 0x43,
+    0x5C, 0xF2, 0xEB, 0x26, 0x0D, 0x3E, 0xAE, 0xDE, 0xDE, 0x7A, 0x33, 0x62, 0xCA, 0x1D, 0xA1, 0x44,
+    0xFC, 0xEB, 0x7A, 0x37, 0xE1, 0x5E, 0x23, 0x3A, 0x71, 0x13, 0x58, 0x14, 0xC1, 0x4F, 0xF7, 0x3B,
+    0x12, 0x90, 0x99, 0x8E, 0x8F, 0x35, 0xA2, 0x52, 0x37, 0xA1, 0xA2, 0x58, 0xD1, 0xA7, 0x81, 0x33,
+    0x18, 0xEE, 0xA6, 0x0D, 0x8F, 0xD7, 0xFA, 0xC7, 0x24, 0x2D, 0x47, 0x8F, 0x71, 0x2F, 0x9E, 0xEF,
+    0xF9, 0x03, 0x8A, 0xC1, 0x07, 0x22, 0x17, 0x09, 0xAD, 0x14, 0xA9, 0xB0, 0x91, 0xE2, 0xBF, 0xE8,
+    0x31, 0xB6, 0xDF, 0x04, 0xF6, 0xF7, 0xB3, 0xC2, 0xE1, 0x89, 0x12, 0x31, 0xC5, 0x85, 0xBC, 0x51,
+    0x22, 0x88, 0x05, 0xE3, 0x75, 0x47, 0xEC, 0x46, 0x4E, 0x68, 0xF4, 0x53, 0xFD, 0x63, 0x33, 0x97,
+    0x00, 0xFA, 0x1A, 0x2A, 0x3C, 0x47, 0x78, 0x0E, 0x0B, 0x8F, 0x0F, 0x3B, 0x18, 0x7F, 0x3A, 0xC2,
+    0x38, 0x69, 0x8F, 0x44, 0xCE, 0xFE, 0x14, 0xD8, 0x2C, 0x77, 0x9C, 0xE5, 0xA2, 0xBC, 0xC1, 0x26,
+    0xC8, 0xFB, 0xDF, 0x3B, 0xBD, 0x54, 0xBD, 0x6E, 0xD4, 0x40, 0x10, 0x1E, 0xDF, 0x0A, 0x5D, 0xE1,
+    0xC2, 0x0D, 0x82, 0xD2, 0x3D, 0x8D, 0x1F, 0xC1, 0x96, 0x28, 0xD2, 0x52, 0x70, 0x4A, 0x41, 0xC1,
+    0x03, 0x50, 0xE4, 0x05, 0x90, 0x7C, 0x3D, 0x15, 0x6F, 0x90, 0x22, 0x05, 0xBA, 0x14, 0x79, 0x83,
+    0xD8, 0x3D, 0x45, 0x1C, 0x51, 0xD0, 0x5E, 0x9D, 0xCA, 0x52, 0x56, 0xC4, 0x80, 0xED, 0xE1, 0xFB,
+    0x76, 0x7C, 0x3F, 0xA0, 0x44, 0x21, 0x11, 0xC2, 0x92, 0xBF, 0x9D, 0xD9, 0xD9, 0x99, 0x9D, 0xF9,
+    0x76, 0x67, 0x45, 0x44, 0xF2, 0x42, 0xCA, 0xA4, 0x39, 0x2E, 0x5F, 0xFA, 0xF7, 0x79, 0x31, 0xA4,
+    0x79, 0x91, 0x1F, 0xE8, 0x32, 0xB9, 0xD4, 0xA5, 0xF3, 0x65, 0x2D, 0x43, 0x56, 0x4B, 0x7E, 0x54,
+    0x4B, 0xA2, 0xAD, 0xB8, 0x9F, 0xBD, 0xC8, 0x90, 0x63, 0xE2, 0xA0, 0x93, 0x69, 0x85, 0x97, 0x21,
+    0x2D, 0xE1, 0xF2, 0xD9, 0x27, 0x97, 0x6D, 0xE5, 0xFC, 0xD3, 0xB8, 0x1D, 0x44, 0x54, 0x22, 0x2C,
+    0x9D, 0xAF, 0x89, 0x49, 0x43, 0xCC, 0x97, 0xEF, 0xC6, 0x13, 0xA9, 0xA4, 0xD2, 0x2E, 0x1A, 0x88,
+    0xAE, 0x93, 0x67, 0xC3, 0xAB, 0xB8, 0xE5, 0xCA, 0xB4, 0x21, 0xE6, 0x4B, 0x62, 0x25, 0x40, 0x2C,
+    0x91, 0x68, 0x38, 0xEC, 0x80, 0x8A, 0x8D, 0x37, 0x38, 0x1C, 0xF6, 0xC1, 0x3A, 0x12, 0xB1, 0x49,
+    0xF0, 0xAA, 0x77, 0x11, 0x92, 0x10, 0xCD, 0xF5, 0x44, 0x84, 0xE0, 0xBE, 0x96, 0x49, 0x5E, 0x13,
+    0xD3, 0x90, 0x49, 0xD2, 0x12, 0x5D, 0x17, 0x1D, 0xA3, 0x78, 0xE7, 0xB7, 0x80, 0xCD, 0x90, 0x97,
+    0x36, 0x06, 0xCF, 0xBF, 0x2F, 0x8A, 0x7D, 0xAB, 0x97, 0x79, 0x0B, 0x48, 0x1B, 0x40, 0x5E, 0x00,
+    0x06, 0xCC, 0xC1, 0xC7, 0xF9, 0x64, 0x0D, 0x00, 0x4B, 0xCE, 0x23, 0x75, 0xF7, 0x8D, 0xB1, 0x15,
+    0x2E, 0x81, 0x2C, 0xE7, 0x95, 0x80, 0xCA, 0x9C, 0x4F, 0xB9, 0x6E, 0xEE, 0x01, 0x11, 0x7D, 0xA5,
+    0x62, 0x94, 0xAC, 0x06, 0xC4, 0x8C, 0xEC, 0xFA, 0x4A, 0xD7, 0x22, 0xD9, 0x07, 0x85, 0x4B, 0xEC,
+    0x2B, 0x14, 0x4C, 0x16, 0x10, 0xB3, 0x2C, 0xB0, 0x42, 0xE0, 0x0E, 0x85, 0x59, 0x42, 0x51, 0xE6,
+    0xCA, 0xD2, 0xA1, 0xA0, 0x68, 0x28, 0x28, 0x9A, 0x4A, 0x55, 0x50, 0xC9, 0x1A, 0x2A, 0x3F, 0x99,
+    0x38, 0xAA, 0x21, 0xC6, 0x37, 0x7D, 0x50, 0xD2, 0x36, 0x2C, 0x2B, 0x97, 0x54, 0x66, 0x63, 0x50,
+    0x62, 0x6F, 0xD1, 0x9A, 0xBD, 0xD0, 0x0C, 0x07, 0x85, 0xB1, 0x99, 0x41, 0x4D, 0x85, 0xB4, 0x43,
+    0x99, 0x77, 0x54, 0x24, 0x5B, 0x4B, 0xF8, 0x4A, 0x65, 0x01, 0xC4, 0xB4, 0x7E, 0x71, 0xEA, 0xA5,
+    0x14, 0xAB, 0x90, 0xF4, 0x90, 0x06, 0xF2, 0x63, 0x14, 0x00, 0xB9, 0x61, 0xA0, 0x08, 0x1C, 0x31,
+    0x13, 0x77, 0xD3, 0xC9, 0x76, 0xDE, 0xA3, 0x50, 0xF2, 0xD4, 0x88, 0x11, 0x05, 0x9C, 0x05, 0x0E,
+    0xB9, 0x2B, 0x69, 0x27, 0xC7, 0x4C, 0x89, 0x6C, 0x75, 0xD8, 0x47, 0x92, 0x3A, 0x05, 0x05, 0xAE,
+    0x9D, 0x33, 0x56, 0xCF, 0x63, 0x95, 0x5C, 0x1E, 0x62, 0x18, 0x16, 0x8B, 0x45, 0x85, 0x12, 0xF0,
+    0xD5, 0x29, 0xB1, 0x9D, 0xFF, 0x58, 0xAD, 0x56, 0x8F, 0x09, 0xB5, 0x67, 0xD0, 0xB7, 0x34, 0xE8,
+    0x57, 0x1A, 0x34, 0x1C, 0x02, 0x6E, 0x8B, 0x58, 0xAB, 0xD1, 0xCE, 0xD3, 0xB1, 0x6B, 0x75, 0x9B,
+    0x61, 0xFA, 0x30, 0x35, 0xEB, 0x38, 0x73, 0xCE, 0x95, 0xD9, 0x12, 0x0B, 0xE3, 0xF5, 0xED, 0x93,
+    0x57, 0xAB, 0xD3, 0x2E, 0x41, 0xF2, 0xA3, 0x63, 0x09, 0xCB, 0xF1, 0xEE, 0x95, 0x9B, 0xC9, 0x8A,
+    0x77, 0x23, 0x1B, 0x39, 0xA9, 0xBC, 0x0A, 0x31, 0x0F, 0x73, 0xC6, 0xB3, 0x90, 0x73, 0x42, 0xF6,
+    0xE7, 0xA4, 0xD5, 0xD5, 0x73, 0x48, 0x75, 0xD8, 0x1F, 0x9A, 0x50, 0x33, 0xA8, 0x78, 0xC0, 0x00,
+    0xD6, 0xF1, 0xA4, 0x18, 0xED, 0xDB, 0x01, 0xBC, 0x9F, 0xD5, 0x8F, 0x08, 0x76, 0xFF, 0xB0, 0x23,
+    0x54, 0xF5, 0x82, 0xD5, 0xEB, 0x35, 0xCB, 0xBF, 0xFA, 0x14, 0x48, 0x31, 0xA6, 0x03, 0xF9, 0xE7,
+    0x62, 0x64, 0xC9, 0x64, 0x20, 0xB1, 0x12, 0x98, 0x15, 0xA3, 0x56, 0xC6, 0x7B, 0x3C, 0xEE, 0x32,
+    0x84, 0x2A, 0x47, 0xEB, 0x17, 0x55, 0xFD, 0x5D, 0x08, 0x97, 0x90, 0x42, 0x68, 0xBD, 0x7F, 0x24,
+    0xAC, 0x4E, 0x26, 0x81, 0xAF, 0xD9, 0x24, 0xF4, 0x26, 0x2C, 0xDE, 0xE8, 0x66, 0x71, 0x55, 0x4F,
+    0x42, 0xB6, 0x9E, 0x04, 0xF4, 0xB2, 0x09, 0xD6, 0x62, 0x14, 0xFA, 0x49, 0x98, 0x6D, 0x84, 0xE8,
+    0xAF, 0x84, 0x89, 0xF7, 0xD9, 0x46, 0x70, 0x5B, 0xA1, 0x9B, 0x04, 0xBE, 0x23, 0xE1, 0x4B, 0xED,
+    0x31, 0x29, 0x90, 0x4F, 0x10, 0xC6, 0x33, 0x0D, 0x1D, 0x21, 0xAA, 0xD6, 0x20, 0x12, 0x1E, 0x47,
+    0x7E, 0xD1, 0xEB, 0x5D, 0x8B, 0x28, 0x6B, 0x0B, 0x07, 0xC4, 0xD7, 0x62, 0x5C, 0xAD, 0x06, 0xEB,
+    0x28, 0xB6, 0x13, 0x7E, 0x9E, 0x03, 0x7E, 0x7B, 0x86, 0xAC, 0xD5, 0xF6, 0x8C, 0x57, 0x27, 0xC1,
+    0xA8, 0xBA, 0xA6, 0x11, 0x31, 0x0A, 0x1A, 0x3F, 0x1E, 0xB5, 0xC1, 0x33, 0x52, 0xF3, 0x4C, 0xBF,
+    0x04, 0x4F, 0xD7, 0x99, 0x67, 0x69, 0x61, 0xD3, 0x8B, 0x60, 0x74, 0xD7, 0x16, 0x76, 0x30, 0xA3,
+    0x75, 0x31, 0x1E, 0x86, 0x30, 0xCC, 0xAD, 0xB8, 0x0D, 0x0F, 0xA3, 0xEC, 0x3A, 0xFD, 0x49, 0x78,
+    0xBA, 0xF1, 0xA0, 0x6A, 0x63, 0x37, 0x21, 0x0C, 0xD6, 0x8A, 0xFF, 0xF5, 0xFB, 0x05, 0xCD, 0x55,
+    0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0xDB, 0x3A, 0x5D, 0xE1, 0x62, 0x2B, 0x2A, 0x0A, 0xFF, 0x04,
+    0xFF, 0x03, 0x6C, 0xE5, 0x17, 0xA4, 0xC8, 0x89, 0x92, 0x7F, 0x40, 0x7E, 0x82, 0x4F, 0xA2, 0x48,
+    0x41, 0x93, 0x02, 0x7A, 0x4A, 0x74, 0x0D, 0x3D, 0x82, 0x5B, 0x8B, 0x36, 0x45, 0x4E, 0x82, 0x8E,
+    0xC6, 0x4D, 0x0A, 0xD2, 0x60, 0x14, 0x17, 0x0E, 0x5A, 0x7B, 0x78, 0x6F, 0x7C, 0xB9, 0x04, 0x29,
+    0x52, 0x02, 0x22, 0x12, 0xAB, 0x68, 0x6E, 0x3F, 0xC6, 0xF3, 0xDE, 0xBE, 0x99, 0xD9, 0x88, 0x4C,
+    0x23, 0xD3, 0x06, 0x36, 0x57, 0x85, 0x75, 0xAA, 0x1B, 0x91, 0x44, 0x4B, 0x1E, 0xF8, 0x9A, 0xD6,
+    0xB5, 0x12, 0xBD, 0x2F, 0xE3, 0x41, 0x04, 0x1E, 0x45, 0x2D, 0x85, 0x86, 0xA4, 0x93, 0xB4, 0xCF,
+    0x9B, 0x4A, 0x64, 0x14, 0x9F, 0xB6, 0x92, 0xD5, 0x49, 0xE7, 0x25, 0x0E, 0x52, 0xBC, 0x6C, 0xA5,
+    0x58, 0xC6, 0xBD, 0x97, 0xA4, 0x97, 0xFC, 0xC4, 0x16, 0xE1, 0xE6, 0xA2, 0xAF, 0xCC, 0xED, 0x45,
+    0x67, 0xDF, 0x20, 0xDA, 0x20, 0x1E, 0xA1, 0x5D, 0xEB, 0x1A, 0xE0, 0x54, 0x7B, 0x41, 0xAA, 0x3A,
+    0x09, 0x7E, 0x19, 0x6B, 0x99, 0x69, 0x2B, 0xA9, 0x9E, 0x6B, 0x20, 0x43, 0xD5, 0xB3, 0x63, 0x52,
+    0xD4, 0x51, 0x64, 0xB6, 0x9F, 0x1A, 0x63, 0x99, 0xBD, 0x92, 0xE8, 0xC0, 0x2E, 0x00, 0xA2, 0x05,
+    0xF7, 0xF2, 0xB3, 0x7D, 0x2C, 0x37, 0x64, 0xDD, 0x48, 0xDE, 0xCC, 0x11, 0x52, 0x19, 0xF3, 0x7B,
+    0xBB, 0x06, 0xFA, 0x58, 0x2C, 0x5D, 0x9D, 0x9D, 0x6E, 0xE6, 0x6D, 0x72, 0xD1, 0x45, 0x41, 0xC2,
+    0x28, 0x95, 0x14, 0xF9, 0x32, 0xAB, 0xB3, 0x93, 0x36, 0xE9, 0xD2, 0x26, 0xC8, 0x9A, 0xA4, 0xB2,
+    0xCF, 0x21, 0xE9, 0x63, 0x00, 0x57, 0x67, 0x3E, 0xC8, 0x1C, 0xA8, 0x2B, 0xC3, 0x5E, 0xCA, 0xA3,
+    0xC8, 0x37, 0x72, 0x63, 0x3C, 0xD6, 0x4B, 0xC8, 0xA4, 0xDA, 0x41, 0x1B, 0x0D, 0x11, 0xB4, 0x7B,
+    0x2E, 0x70, 0xC3, 0x1E, 0x4D, 0x41, 0x93, 0xD7, 0x13, 0x1B, 0x91, 0x79, 0x07, 0x03, 0x58, 0x1E,
+    0xCB, 0xD5, 0x09, 0xD4, 0x13, 0x4A, 0xF2, 0xDB, 0xA6, 0x79, 0x42, 0x5B, 0xC6, 0x30, 0x27, 0x5B,
+    0xAB, 0x25, 0x8B, 0xD3, 0x18, 0x18, 0x33, 0x50, 0x5A, 0x69, 0x19, 0x2B, 0x33, 0x96, 0x2A, 0x6F,
+    0xEF, 0xBE, 0xD0, 0xA3, 0x37, 0x37, 0x26, 0x30, 0x31, 0xAE, 0x16, 0xBB, 0x92, 0xAB, 0xAC, 0x1A,
+    0x3D, 0x1B, 0xD1, 0x42, 0x22, 0x7C, 0x8C, 0x9B, 0xED, 0xE9, 0xEB, 0x0F, 0x59, 0x63, 0x08, 0x84,
+    0x26, 0x07, 0x80, 0x23, 0x6B, 0xE2, 0xA0, 0x65, 0x51, 0xEE, 0x96, 0x64, 0x4B, 0x79, 0xC9, 0xAA,
+    0xAA, 0xA5, 0xF4, 0xDF, 0xDE, 0x95, 0x5E, 0x07, 0x39, 0x04, 0x3C, 0x5D, 0xDD, 0x72, 0x82, 0x7E,
+    0x32, 0xE1, 0x42, 0x7F, 0x82, 0x3A, 0xA3, 0x44, 0x9D, 0x54, 0x0F, 0x69, 0xBE, 0xD2, 0x74, 0x8B,
+    0xC5, 0xB0, 0x38, 0x98, 0xA8, 0xA1, 0x1A, 0xC4, 0xDC, 0xAF, 0x04, 0x7A, 0x90, 0xCD, 0xC1, 0x6A,
+    0x05, 0xF4, 0xE6, 0x2C, 0x72, 0x49, 0x4C, 0xD5, 0xC1, 0x54, 0xA6, 0x32, 0xEE, 0xB6, 0xCD, 0xED,
+    0x60, 0x11, 0x84, 0x0A, 0xE6, 0xD3, 0xCA, 0x9F, 0xBF, 0x35, 0x2D, 0x2C, 0xBD, 0x7F, 0x39, 0x19,
+    0x8F, 0x31, 0x19, 0x98, 0x92, 0xCD, 0x16, 0xCD, 0xDD, 0x3E, 0xF9, 0x28, 0x6B, 0x92, 0x3E, 0xEA,
+    0xF8, 0x35, 0x55, 0xF7, 0x3C, 0x73, 0x1B, 0x24, 0x82, 0x7D, 0x54, 0xE2, 0x0F, 0xBF, 0x58, 0xB9,
+    0x26, 0x1A, 0x78, 0x8A, 0xF0, 0x49, 0xCF, 0x4B, 0x67, 0x35, 0xEB, 0x67, 0xA4, 0x08, 0xF3, 0x0B,
+    0x03, 0x66, 0xFD, 0x44, 0x06, 0xE8, 0xC2, 0xEE, 0x7E, 0xD3, 0x7D, 0xFF, 0x78, 0xBA, 0xAD, 0xCF,
+    0x38, 0x54, 0xDC, 0xC6, 0xD6, 0xBC, 0x45, 0xD5, 0xA0, 0x89, 0x61, 0x36, 0xEC, 0xBD, 0x1A, 0x1C,
+    0x8A, 0x12, 0x5F, 0xA0, 0xE1, 0x7B, 0x5C, 0x02, 0x29, 0x00, 0xBF, 0x91, 0x99, 0xA8, 0xA8, 0x43,
+    0x91, 0x80, 0x63, 0x7E, 0x84, 0xA2, 0x43, 0x43, 0x82, 0xD1, 0x29, 0x78, 0xA6, 0xAC, 0xCD, 0x44,
+    0xAD, 0xC0, 0xC9, 0x75, 0xD8, 0x95, 0xEF, 0xFD, 0xCC, 0xC3, 0x4A, 0x35, 0x7B, 0x7A, 0xB9, 0x10,
+    0xB6, 0x5B, 0x6B, 0x8F, 0x81, 0x44, 0x2B, 0xBF, 0x7A, 0xF3, 0x0F, 0xA4, 0xCA, 0x76, 0x52, 0x15,
+    0x37, 0xA5, 0x1A, 0x4C, 0xAA, 0xF8, 0x5A, 0xAA, 0xF6, 0x0E, 0xA9, 0x58, 0xA2, 0x93, 0x89, 0x57,
+    0xE3, 0xEA, 0x0E, 0xA9, 0x72, 0x36, 0xEA, 0xD2, 0x5A, 0xB9, 0xC4, 0xC3, 0x0B, 0x82, 0x48, 0x0A,
+    0x10, 0xA1, 0x10, 0xA9, 0xAB, 0x75, 0x7A, 0x51, 0x52, 0x92, 0xBC, 0xE6, 0x35, 0x5C, 0xE3, 0xED,
+    0x61, 0x0A, 0x06, 0x69, 0x0D, 0xAD, 0xAD, 0x75, 0x55, 0x7D, 0x6D, 0x6D, 0x67, 0x3A, 0x4D, 0x7E,
+    0x04, 0x7B, 0xF7, 0xD4, 0x1A, 0x91, 0x11, 0x8A, 0x92, 0xEF, 0xCA, 0x9A, 0x6F, 0x21, 0x80, 0xF0,
+    0xCE, 0x00, 0x71, 0x4A, 0x08, 0xD0, 0xC9, 0xC4, 0x07, 0xF6, 0x46, 0x11, 0x08, 0x94, 0x19, 0x51,
+    0xB9, 0xBF, 0x9D, 0x06, 0x82, 0x41, 0x0A, 0x65, 0x44, 0xC0, 0x78, 0x02, 0x55, 0x25, 0x6F, 0xC0,
+    0x54, 0x13, 0xBE, 0x7A, 0x66, 0xE2, 0x31, 0xB3, 0xF6, 0x3F, 0x24, 0x23, 0xE3, 0x74, 0xB0, 0x0E,
+    0xC7, 0x49, 0xF2, 0x33, 0x30, 0x53, 0x70, 0x8F, 0x02, 0x5F, 0xC2, 0x81, 0x8F, 0xB2, 0x6E, 0x63,
+    0x69, 0xCB, 0x58, 0x3C, 0x34, 0xE1, 0xC5, 0xF1, 0xCE, 0x49, 0xBB, 0xE3, 0x50, 0xDC, 0xB6, 0xF9,
+    0x1F, 0x8F, 0x5F, 0xCD, 0x54, 0xBD, 0x6E, 0xD4, 0x40, 0x10, 0x1E, 0x7B, 0x85, 0x4E, 0xE2, 0x8A,
+    0xAD, 0x42, 0x41, 0x0A, 0xF3, 0x04, 0xF8, 0x0D, 0xE2, 0x7B, 0x03, 0x28, 0xF0, 0x1B, 0x50, 0x20,
+    0x40, 0xF2, 0x0B, 0x44, 0xF8, 0xA0, 0xA1, 0x84, 0x86, 0x3E, 0x05, 0x05, 0x3A, 0x8A, 0x7B, 0x82,
+    0x63, 0xDD, 0x51, 0x9E, 0x79, 0x02, 0x2C, 0x2E, 0x29, 0x12, 0x8A, 0x6C, 0x24, 0x23, 0x7C, 0xC8,
+    0xDE, 0x61, 0x66, 0x6C, 0xDF, 0x11, 0xEE, 0x08, 0x01, 0x21, 0x91, 0x95, 0x3C, 0x33, 0xFE, 0x66,
+    0xEC, 0xF9, 0xDB, 0x19, 0x83, 0x88, 0x0E, 0x22, 0x30, 0xC4, 0x11, 0xD2, 0x15, 0xDF, 0x89, 0x5D,
+    0x1C, 0x13, 0x07, 0x68, 0xE8, 0xB9, 0xCA, 0x9C, 0x03, 0xC6, 0x66, 0x93, 0xCB, 0x99, 0xFD, 0x25,
+    0xEF, 0x8E, 0xC7, 0xBF, 0x52, 0xE5, 0x80, 0x58, 0xA9, 0xF3, 0xEB, 0x6F, 0xDD, 0x64, 0x1C, 0x8D,
+    0x60, 0x60, 0xC5, 0x7B, 0x90, 0x81, 0x2A, 0x25, 0x06, 0x9D, 0x83, 0x57, 0x03, 0xFC, 0x2B, 0x15,
+    0x79, 0xFB, 0x36, 0xF2, 0xDA, 0x34, 0xD8, 0x35, 0x96, 0x12, 0x0C, 0xD9, 0xF3, 0x21, 0x7B, 0xE8,
+    0xD2, 0x07, 0xB1, 0xDF, 0x50, 0xCD, 0x58, 0x37, 0x63, 0x95, 0xAA, 0x58, 0xA3, 0x0B, 0x56, 0x44,
+    0x63, 0x86, 0xDD, 0xA5, 0x61, 0xC7, 0xB0, 0x4F, 0xCA, 0xDD, 0x4A, 0xB9, 0x38, 0xC1, 0x42, 0x42,
+    0x19, 0x13, 0xAD, 0x48, 0xF5, 0xF0, 0xB5, 0xAA, 0xC4, 0x73, 0x21, 0x8E, 0xC7, 0x4C, 0x9D, 0x44,
+    0xB4, 0x01, 0x63, 0xCD, 0x30, 0x5A, 0x86, 0x31, 0x83, 0xAE, 0x6D, 0x92, 0x3B, 0x48, 0xEA, 0x92,
+    0xF9, 0x36, 0xB8, 0x3B, 0x3A, 0x03, 0xBF, 0x56, 0x84, 0x18, 0x20, 0x65, 0x98, 0x45, 0x00, 0x43,
+    0xBB, 0x1D, 0xCC, 0x19, 0xAC, 0xA9, 0x6A, 0x90, 0x1E, 0x25, 0x98, 0x0D, 0x11, 0x3F, 0x5B, 0x2A,
+    0xE8, 0x33, 0x32, 0xB9, 0x47, 0x96, 0xC0, 0x96, 0xC0, 0x96, 0x44, 0x7C, 0xF1, 0x64, 0x38, 0xDE,
+    0x10, 0x19, 0xC4, 0x9F, 0x55, 0xDB, 0xEC, 0x9F, 0x34, 0x7D, 0x85, 0xDD, 0xEF, 0xC8, 0x7D, 0x26,
+    0xFB, 0x3F, 0x12, 0x64, 0x62, 0x46, 0xFB, 0xBE, 0x8B, 0xBE, 0xBC, 0x33, 0x2E, 0xE0, 0xE1, 0x53,
+    0x88, 0x4B, 0x07, 0x37, 0x1B, 0x2E, 0xDF, 0xFE, 0xAF, 0x08, 0x6C, 0x25, 0x9C, 0xBE, 0xA3, 0xC4,
+    0xF5, 0xE2, 0xBC, 0xE0, 0x1D, 0x90, 0x10, 0xB0, 0x60, 0xF5, 0xA2, 0x64, 0xE1, 0xA9, 0x35, 0x9F,
+    0x30, 0x31, 0x4E, 0x23, 0x7E, 0x2C, 0x42, 0x2C, 0x1C, 0xDC, 0xB0, 0xD4, 0x23, 0x52, 0x81, 0xD7,
+    0x0B, 0x70, 0x20, 0x5D, 0x73, 0xD2, 0xBE, 0x74, 0xD5, 0x16, 0x69, 0x45, 0xDB, 0x95, 0x8B, 0x40,
+    0x2F, 0x86, 0xC1, 0x99, 0xC1, 0x4A, 0xEE, 0x6D, 0x9E, 0xE2, 0xF1, 0xB4, 0x0E, 0x96, 0xA4, 0x7D,
+    0x4E, 0x96, 0xC3, 0xB3, 0x9A, 0xAD, 0xD9, 0x32, 0xE2, 0xCF, 0xF5, 0x7B, 0x02, 0x15, 0x83, 0x70,
+    0x29, 0xD0, 0x3E, 0xE8, 0xEF, 0x78, 0x73, 0x91, 0x10, 0x83, 0xFE, 0x80, 0x38, 0x6A, 0x0C, 0x36,
+    0xFA, 0xF4, 0x28, 0xB1, 0x98, 0x43, 0xFA, 0xA2, 0xA2, 0xBE, 0x51, 0x77, 0x83, 0x39, 0xFD, 0xA8,
+    0xA6, 0xDC, 0xF4, 0x9C, 0x92, 0xAC, 0x1B, 0x16, 0xF2, 0x3F, 0x10, 0xB2, 0xF5, 0x75, 0x1C, 0xE2,
+    0x52, 0x2E, 0x06, 0xCA, 0x95, 0x8E, 0x78, 0x5F, 0x12, 0x3B, 0x84, 0x84, 0x5E, 0x23, 0x9A, 0x69,
+    0x72, 0x12, 0xE4, 0x72, 0x71, 0xB8, 0x9E, 0x34, 0x0F, 0x52, 0x2C, 0x13, 0xCA, 0xFD, 0x09, 0xE6,
+    0x19, 0x17, 0x58, 0x7D, 0xB5, 0x32, 0xAC, 0x8D, 0x63, 0x53, 0x88, 0xA6, 0xB2, 0xB5, 0x70, 0xD1,
+    0xB2, 0x6A, 0x57, 0x98, 0xEB, 0xE6, 0xA2, 0x9F, 0xF2, 0xB6, 0xE9, 0x64, 0xDD, 0xA2, 0x43, 0x7B,
+    0x0E, 0x0D, 0xDB, 0x1D, 0xA0, 0xBA, 0xD5, 0x97, 0x1E, 0x02, 0x3C, 0xA6, 0x46, 0xE1, 0xC9, 0x14,
+    0xBB, 0x30, 0xE9, 0x33, 0xCF, 0xA0, 0x93, 0x25, 0x11, 0xB7, 0xAB, 0x62, 0x87, 0xD9, 0x00, 0xAB,
+    0xD6, 0x82, 0x5E, 0xF0, 0x95, 0xE1, 0xC1, 0x02, 0x6D, 0x6F, 0x93, 0x57, 0x55, 0xEE, 0x91, 0x17,
+    0x55, 0xED, 0x51, 0x26, 0x7E, 0x1D, 0xDD, 0xE1, 0x8D, 0x15, 0x72, 0x68, 0xB5, 0x16, 0x0A, 0xC9,
+    0xC9, 0x64, 0xF2, 0xA6, 0x5B, 0x3F, 0x1D, 0x2D, 0xD6, 0xF3, 0xDB, 0xEE, 0x02, 0x9F, 0x02, 0xBC,
+    0x45, 0x05, 0x38, 0x7E, 0x64, 0xFB, 0xAA, 0xF9, 0x88, 0x2F, 0x49, 0x73, 0xED, 0x2E, 0x6C, 0x94,
+    0x35, 0x6A, 0xCB, 0x9A, 0xAE, 0xCA, 0x1A, 0xAE, 0xCB, 0x1A, 0x5E, 0xF9, 0xB2, 0x76, 0x56, 0xDD,
+    0x22, 0xEE, 0xD6, 0x72, 0xEF, 0x67, 0xAB, 0xF2, 0x3F, 0x9F, 0xEF, 0x9D, 0x55, 0xBD, 0x92, 0x95,
+    0x58, 0x10, 0x6E, 0x38, 0x2A, 0x56, 0x11, 0x10, 0x6D, 0xCC, 0x3E, 0x81, 0xBC, 0x81, 0x07, 0xCB,
+    0x07, 0x30, 0xBA, 0x1A, 0x18, 0xF8, 0x00, 0x1B, 0xCC, 0x13, 0x58, 0x07, 0x23, 0x53, 0x13, 0xCB,
+    0xD0, 0xD4, 0xC2, 0xC0, 0x17, 0xB0, 0x2E, 0x18, 0x19, 0x18, 0x78, 0x93, 0x2D, 0x53, 0x52, 0x77,
+    0x83, 0x41, 0xC5, 0xDA, 0xBB, 0x23, 0xD0, 0x7E, 0x5F, 0xC3, 0x1D, 0x7F, 0x6B, 0xAC, 0x91, 0x29,
+    0x0E, 0x7D, 0xFB, 0x83, 0x3E, 0xDD, 0xDF, 0xD7, 0xA7, 0x47, 0x44, 0xFE, 0x28, 0x45, 0x24, 0xD1,
+    0x3D, 0x56, 0xAF, 0x8A, 0x1F, 0xFA, 0xB0, 0x69, 0x25, 0x1E, 0x25, 0xEB, 0xAF, 0xB8, 0x41, 0xDC,
+    0x70, 0x35, 0xE9, 0xC5, 0xED, 0xAF, 0x66, 0x1D, 0x9C, 0xFE, 0xC6, 0x4E, 0xA2, 0xB1, 0x50, 0x5C,
+    0x63, 0x66, 0xAB, 0x1C, 0xFD, 0x53, 0xD7, 0x4F, 0x24, 0xDB, 0xE1, 0xFB, 0xC3, 0xDA, 0x71, 0x4D,
+    0x7B, 0xAE, 0x8E, 0x71, 0x25, 0x9E, 0x45, 0xFE, 0x44, 0xE4, 0xB7, 0x7F, 0xC1, 0x89, 0xAF, 0xB1,
+    0x5E, 0x52, 0x7D, 0xC0, 0x2D, 0x2B, 0xE2, 0xC5, 0xD9, 0x6B, 0x29, 0x41, 0xDF, 0xAB, 0xBE, 0x68,
+    0xFE, 0x97, 0x80, 0xED, 0x05, 0x09, 0xE5, 0xED, 0x39, 0xCD, 0x4B, 0xF3, 0x35, 0xD5, 0x57, 0xAA,
+    0xCC, 0xA6, 0x8F, 0x2C, 0x2B, 0x84, 0x5F, 0x36, 0x90, 0xF9, 0xB6, 0x25, 0x0B, 0x1A, 0x26, 0x7B,
+    0x4A, 0x3A, 0xCB, 0x4F, 0xAE, 0x78, 0xB0, 0x64, 0xE2, 0x3D, 0x22, 0xC6, 0x08, 0x11, 0xA4, 0xB1,
+    0x1C, 0xB3, 0x0E, 0x65, 0xC2, 0x01, 0xD2, 0x80, 0xC0, 0x11, 0x04, 0x08, 0x1C, 0x60, 0x02, 0x48,
+    0x51, 0x01, 0x00, 0x02, 0x07, 0x00, 0x20, 0x45, 0x45, 0x8A, 0xDC, 0x3E, 0xDE, 0x13, 0x00, 0x52,
+    0x54, 0x81, 0x2A, 0x34, 0xB7, 0xA6, 0x3B, 0xE4, 0xCE, 0x19, 0xB1, 0xB8, 0x02, 0x8C, 0x96, 0x8C,
+    0x7E, 0x0C, 0x7F, 0x5B, 0xE6, 0x63, 0xBC, 0x4F, 0x06, 0xA3, 0x0D, 0xB9, 0x03, 0xC9, 0x7A, 0x04,
+    0x45, 0xAE, 0xD1, 0x84, 0xA0, 0x44, 0x7C, 0x05, 0x87, 0x6F, 0x01, 0x30, 0x8F, 0x99, 0x00, 0x1C,
+    0xE9, 0x40, 0x1F, 0x1C, 0xBE, 0x85, 0x2C, 0x70, 0x44, 0x33, 0x00, 0x3A, 0xD2, 0xDE, 0x2F, 0xB5,
+    0xF8, 0x57, 0xBD, 0x39, 0xE8, 0xBF, 0x2B, 0x57, 0xC4, 0xF2, 0xCA, 0x5B, 0x93, 0x70, 0x91, 0xD5,
+    0xAB, 0xE9, 0xEA, 0x96, 0x87, 0x44, 0x3F, 0xF2, 0xE3, 0xAD, 0xF2, 0x09, 0x5D, 0x83, 0x0F, 0x67,
+    0xD8, 0x20, 0xBF, 0x01, 0x09, 0x90, 0xC1, 0xC3, 0x0F, 0x07, 0xDE, 0x60, 0x54, 0xC0, 0x6E, 0x9F,
+    0xF4, 0x19, 0xC2, 0xFB, 0x6B, 0x23, 0xC9, 0x48, 0x4E, 0xF4, 0x29, 0x35, 0x40, 0xC1, 0xC3, 0x5A,
+    0x38, 0x03, 0xDE, 0x1B, 0x73, 0x80, 0x45, 0x1B, 0x22, 0x32, 0xB8, 0xCB, 0x5B, 0x96, 0xD6, 0x25,
+    0x3D, 0x58, 0x4D, 0x7B, 0xF8, 0x1A, 0x41, 0xD1, 0x01, 0xD5, 0xC2, 0x81, 0xA0, 0x53, 0x6C, 0x82,
+    0x17, 0x2F, 0x26, 0x4A, 0xEF, 0x46, 0x64, 0x13, 0x4F, 0x70, 0x48, 0xA8, 0x60, 0xE6, 0xF8, 0x50,
+    0x12, 0x13, 0x61, 0xE6, 0x6B, 0xBE, 0xB5, 0x4F, 0x61, 0xBA, 0x71, 0x15, 0x33, 0xE9, 0xC9, 0x6A,
+    0x00, 0x5F, 0x92, 0xBC, 0x63, 0x2F, 0x84, 0x50, 0xB1, 0x2D, 0x74, 0x2E, 0x2D, 0xA7, 0x32, 0xD1,
+    0xBA, 0x61, 0x65, 0x72, 0xB4, 0xB7, 0xB8, 0x3B, 0x2A, 0xAA, 0x34, 0x93, 0x81, 0xA6, 0xBF, 0xDF,
+    0x53, 0x26, 0x9A, 0xF9, 0x4B, 0x98, 0xD1, 0x0F, 0x66, 0x6B, 0x3A, 0xCA, 0xA1, 0xF7, 0x1D, 0xCB,
+    0x15, 0xB5, 0x76, 0xEC, 0xE4, 0x82, 0xA4, 0x23, 0xC4, 0x79, 0x86, 0xDF, 0xB9, 0x49, 0xDF, 0x28,
+    0xB9, 0xB7, 0x33, 0xCA, 0x2F, 0x90, 0x05, 0x4E, 0x60, 0xB8, 0x0E, 0x3D, 0xCB, 0x09, 0x37, 0xFE,
+    0xAA, 0x6C, 0xE7, 0x2B, 0x37, 0x20, 0xD8, 0x84, 0xDB, 0x1F, 0x81, 0x20, 0xD5, 0x8E, 0x2D, 0x54,
+    0x22, 0xD7, 0xC1, 0x97, 0x91, 0x42, 0xBF, 0xEC, 0xC3, 0x80, 0x04, 0x50, 0x91, 0x47, 0xA7, 0x65,
+    0xC7, 0x3B, 0x89, 0x3F, 0x61, 0xE3, 0xED, 0xD2, 0x04, 0x92, 0x76, 0xEB, 0x49, 0xB5, 0x92, 0x2D,
+    0xB5, 0x0B, 0xA0, 0xC7, 0x9D, 0x60, 0x77, 0xC5, 0x9D, 0x6A, 0xB5, 0x4A, 0xDC, 0x28, 0x27, 0x05,
+    0xA3, 0xA3, 0xA2, 0x6C, 0x69, 0x4F, 0xCF, 0x9E, 0x26, 0xE1, 0x14, 0x89, 0x14, 0x2F, 0x9D, 0xC4,
+    0x4A, 0xB7, 0x16, 0xCE, 0x0D, 0x06, 0x41, 0x6E, 0x42, 0xDE, 0x48, 0x88, 0x8C, 0x72, 0x3A, 0x68,
+    0xE1, 0x75, 0x42, 0x5B, 0x83, 0x48, 0x49, 0xB0, 0xD7, 0x09, 0xF9, 0xD3, 0x97, 0x00, 0x31, 0xD1,
+    0x60, 0x3C, 0xD0, 0xF1, 0x65, 0x3B, 0x40, 0x64, 0x33, 0xC8, 0x23, 0xF8, 0x22, 0xFD, 0x8F, 0x3D,
+    0x9A, 0xE8, 0x6B, 0x9E, 0xE2, 0x5C, 0x2F, 0x92, 0xBD, 0xF5, 0xC8, 0xA7, 0xBB, 0x85, 0xC8, 0xE5,
+    0x3C, 0x9B, 0x0C, 0xEB, 0xBC, 0x12, 0x3B, 0x82, 0xE2, 0xC6, 0xEF, 0x9A, 0xBA, 0xE1, 0x50, 0xCC,
+    0xAC, 0x2D, 0xE7, 0xBA, 0x81, 0xD9, 0x32, 0xBF, 0x91, 0x39, 0x98, 0x19, 0x99, 0x99, 0x43, 0x02,
+    0x9E, 0x23, 0x98, 0x45, 0x69, 0x63, 0x93, 0xA6, 0xE7, 0x93, 0x9D, 0x56, 0xA2, 0x34, 0x98, 0x10,
+    0x02, 0x7A, 0x8C, 0x86, 0x42, 0xAB, 0xF2, 0x0E, 0x26, 0xAB, 0xFE, 0x8B, 0x2C, 0xFD, 0x8C, 0xC8,
+    0xCE, 0xB4, 0x96, 0xE7, 0x96, 0x53, 0x7B, 0x9A, 0x73, 0xC1, 0xBC, 0x9C, 0x0D, 0xA8, 0x60, 0x25,
+    0x74, 0x7C, 0x64, 0x6C, 0x29, 0x19, 0xCF, 0x6F, 0x7E, 0xDC, 0x6C, 0x6E, 0x8E, 0xEC, 0x65, 0x7D,
+    0x69, 0x03, 0x3C, 0xD4, 0x75, 0xFD, 0xEC, 0x77, 0x83, 0x7D, 0xDB, 0xD6, 0xD1, 0x78, 0x3A, 0xB4,
+    0x97, 0xB6, 0x6E, 0x6C, 0x8C, 0xAC, 0x6D, 0x2D, 0x68, 0x6B, 0x63, 0x72, 0x47, 0x52, 0xBB, 0xAF,
+    0xDA, 0x9A, 0xF3, 0x85, 0xAD, 0x98, 0x1E, 0x9F, 0x61, 0x9C, 0xD4, 0xF5, 0xCC, 0x84, 0x8F, 0x71,
+    0xCF, 0xF3, 0x2F, 0x5E, 0x3E, 0x18, 0xDC, 0x65, 0x7B, 0x90, 0x78, 0x5A, 0x79, 0x85, 0xEC, 0x97,
+    0x05, 0x7C, 0xCF, 0x4D, 0x8F, 0x74, 0xD8, 0x87, 0xEB, 0xD4, 0xB7, 0x9A, 0x6C, 0xE8, 0xB9, 0x3E,
+    0xB1, 0x2A, 0xAD, 0x22, 0x7F, 0x2E, 0x60, 0xDA, 0x6C, 0x36, 0x8D, 0x0D, 0x0B, 0x6D, 0x73, 0xAE,
+    0x7D, 0x82, 0xD4, 0xEB, 0xDF, 0x09, 0xF5, 0x15, 0xA0, 0x8F, 0x09, 0xE8, 0x1B, 0x9B, 0x91, 0xCB,
+    0x3F, 0xAB, 0xA5, 0x51, 0xB7, 0x87, 0xC1, 0x70, 0x10, 0x61, 0x6D, 0xE7, 0x45, 0x80, 0x78, 0x94,
+    0x33, 0xAF, 0xCF, 0xCD, 0x55, 0x31, 0x8E, 0xDC, 0x46, 0x10, 0x6C, 0x2E, 0x6D, 0x31, 0x60, 0x30,
+    0x0E, 0x14, 0x29, 0xE1, 0x13, 0xE6, 0x07, 0x26, 0x0D, 0x7F, 0xC0, 0x06, 0xB4, 0x76, 0xA8, 0x27,
+    0xDC, 0x0B, 0xB4, 0x24, 0xEC, 0x17, 0x08, 0x90, 0x9E, 0xE0, 0x40, 0xFB, 0x02, 0x07, 0x3E, 0xCD,
+    0x18, 0x0E, 0x15, 0x1C, 0x01, 0x05, 0x4A, 0x69, 0xC0, 0x17, 0x48, 0x0A, 0x34, 0x92, 0x79, 0xD0,
+    0x4A, 0x22, 0xD9, 0xAE, 0x9A, 0xE1, 0xE2, 0x0E, 0xC2, 0x41, 0xB2, 0x02, 0x03, 0x1E, 0x60, 0xBB,
+    0x7A, 0xB8, 0x9C, 0xE9, 0xEA, 0xEA, 0x9E, 0xA1, 0x08, 0x86, 0xE9, 0x45, 0x1E, 0xC9, 0x2C, 0x52,
+    0x0E, 0x9F, 0x76, 0xDF, 0xED, 0xF7, 0x8B, 0x28, 0xC6, 0x60, 0x60, 0x16, 0x59, 0xFE, 0xCD, 0x32,
+    0x3D, 0x83, 0xEB, 0xA6, 0xE8, 0x76, 0x88, 0x98, 0x8D, 0x8C, 0x5B, 0xD3, 0xE4, 0x81, 0x76, 0x77,
+    0xE4, 0x21, 0x32, 0xD1, 0x54, 0x1E, 0xEF, 0xCA, 0x29, 0xCD, 0xF2, 0xF9, 0x66, 0xA1, 0x71, 0x8D,
+    0xDC, 0x58, 0xEA, 0xF3, 0x1F, 0x74, 0xA9, 0x48, 0xB4, 0x50, 0x3D, 0x2C, 0x72, 0xEB, 0x21, 0x09,
+    0xCB, 0xC7, 0x4D, 0xFD, 0x81, 0x69, 0x3E, 0x69, 0xD2, 0x60, 0x2A, 0x0E, 0x49, 0x95, 0x7F, 0x7F,
+    0xC4, 0x19, 0xE9, 0x78, 0x69, 0x5F, 0xE9, 0x03, 0xA7, 0xA5, 0xEA, 0x8B, 0x50, 0xE9, 0xE0, 0xE4,
+    0xCB, 0xA6, 0xA4, 0x10, 0x0E, 0xBF, 0xA3, 0x93, 0x29, 0x9C, 0x4A, 0x8F, 0x8E, 0x87, 0x33, 0xC9,
+    0xF5, 0x4E, 0x3B, 0x70, 0xDD, 0x2C, 0x2D, 0x97, 0x1A, 0x20, 0xF5, 0xAD, 0x80, 0xFC, 0xBB, 0x9E,
+    0x65, 0x77, 0xC4, 0x47, 0x49, 0xD5, 0x5D, 0x4B, 0xA1, 0x81, 0x60, 0x9F, 0x1D, 0x80, 0xD6, 0xCB,
+    0x66, 0x04, 0x1A, 0x8F, 0x2C, 0xB0, 0xCE, 0x0C, 0xA8, 0x1F, 0xB0, 0x08, 0x62, 0x50, 0x8A, 0x36,
+    0x1F, 0x63, 0x49, 0xDA, 0xCD, 0x41, 0x6C, 0x03, 0x44, 0x95, 0x6A, 0x21, 0x62, 0x4D, 0x44, 0x3E,
+    0x21, 0xD6, 0x2B, 0xDA, 0x9F, 0xC6, 0x88, 0xD5, 0x1F, 0x21, 0xA2, 0x79, 0x3A, 0x44, 0x2C, 0x5F,
+    0xF4, 0x11, 0x73, 0xF5, 0x2B, 0x76, 0x11, 0x33, 0xE4, 0xA9, 0x13, 0x68, 0x11, 0x0F, 0xC0, 0x53,
+    0xE0, 0x78, 0xA9, 0x2B, 0x47, 0xB1, 0x62, 0x39, 0x24, 0x4C, 0xFD, 0x22, 0x02, 0xF2, 0x71, 0xD4,
+    0x5D, 0xC2, 0xF6, 0xB2, 0x24, 0xE9, 0x3D, 0x64, 0x9F, 0xAB, 0x20, 0x22, 0x04, 0x32, 0x6C, 0x58,
+    0x4C, 0xB0, 0x97, 0x06, 0xF3, 0xB2, 0x91, 0xCA, 0xC9, 0x3C, 0x49, 0xFE, 0x26, 0x98, 0x33, 0x94,
+    0x05, 0xFC, 0x77, 0x52, 0x3E, 0x09, 0x06, 0xBC, 0x27, 0x4C, 0x6C, 0x53, 0xFD, 0x1C, 0x8C, 0x3F,
+    0xE4, 0x01, 0x13, 0xE3, 0xDB, 0x1C, 0x93, 0x5D, 0xD9, 0x63, 0x92, 0x87, 0x89, 0x13, 0x7B, 0xA7,
+    0x63, 0xCE, 0xEF, 0x03, 0x27, 0xD8, 0x9C, 0x93, 0xB6, 0xCF, 0xF5, 0xCC, 0xE7, 0xD0, 0x68, 0x9A,
+    0xC4, 0x76, 0x79, 0xEC, 0xF9, 0xB5, 0xE9, 0x53, 0xD7, 0x1F, 0x73, 0xDA, 0x5D, 0x4D, 0x24, 0x76,
+    0x3E, 0xAB, 0xA9, 0xAF, 0x55, 0x7F, 0x77, 0x6F, 0x29, 0xCB, 0xC4, 0xAC, 0x51, 0xE9, 0xCF, 0x73,
+    0x6F, 0x2C, 0xDF, 0xA8, 0x3E, 0x56, 0x68, 0x69, 0x7C, 0x31, 0x1C, 0xCF, 0x62, 0xFE, 0xF6, 0x84,
+    0x2D, 0xA3, 0x4A, 0x7D, 0xEC, 0x41, 0x3E, 0x18, 0x49, 0x56, 0x13, 0x89, 0x55, 0xE9, 0x80, 0x46,
+    0x46, 0x5F, 0x47, 0x7B, 0x1A, 0xA9, 0x4E, 0x64, 0x9F, 0x4D, 0x6C, 0xFA, 0x7C, 0x64, 0x03, 0x32,
+    0x6B, 0x2E, 0xE5, 0x62, 0xD3, 0x17, 0xB1, 0x51, 0xD1, 0x2C, 0xC8, 0x1A, 0xAD, 0x82, 0x5C, 0xD9,
+    0xA0, 0x6E, 0xBB, 0xC5, 0xB1, 0xE4, 0x9D, 0xC1, 0xE0, 0xB0, 0x9B, 0x65, 0xBF, 0x77, 0x1D, 0x5F,
+    0xAB, 0x3C, 0x97, 0x98, 0xDE, 0x90, 0x64, 0xE0, 0x86, 0x45, 0x60, 0x39, 0xF3, 0x03, 0x43, 0x6C,
+    0xD8, 0x10, 0x22, 0xF3, 0x7A, 0x32, 0x7F, 0x95, 0xBB, 0xE8, 0x3E, 0xDB, 0x14, 0x7C, 0xD1, 0x69,
+    0x2F, 0x05, 0x4B, 0xFA, 0xC5, 0x4A, 0x3F, 0xBB, 0x8D, 0xF2, 0xA2, 0x65, 0x10, 0xA0, 0xB3, 0xF7,
+    0x4F, 0xC2, 0x26, 0x1D, 0x66, 0xEB, 0xD7, 0xC6, 0x61, 0x16, 0xAD, 0xDC, 0x52, 0x85, 0xBE, 0x1A,
+    0xDC, 0xB3, 0xEF, 0x27, 0xD7, 0xA1, 0xDE, 0x9D, 0x54, 0xB8, 0x9C, 0x8A, 0x37, 0x01, 0xD1, 0xC8,
+    0xB2, 0xF6, 0x99, 0x3E, 0x9E, 0x7F, 0x7C, 0x1F, 0x70, 0x5F, 0xFC, 0x56, 0xEA, 0x68, 0x71, 0x34,
+    0xB9, 0x7D, 0x93, 0xC9, 0x31, 0xDB, 0x18, 0x7F, 0xF5, 0xD3, 0xF3, 0x6B, 0xC6, 0xFF, 0x5E, 0xCD,
+    0x9B, 0xF2, 0x1D, 0xF6, 0x45, 0xB3, 0x0F, 0xD6, 0x67, 0x23, 0xBB, 0x44, 0xBE, 0xBA, 0xA4, 0xFF,
+    0x1F, 0xAB, 0x29, 0xF1, 0x4E, 0xA6, 0x28, 0x31, 0x05, 0xC6, 0x4A, 0xB8, 0x54, 0xF1, 0x2C, 0x64,
+    0x53, 0x14, 0x17, 0xCC, 0x13, 0x16, 0x49, 0x6C, 0x31, 0x43, 0xC2, 0xCA, 0x27, 0xB4, 0x5D, 0xC2,
+    0x5A, 0x12, 0x3A, 0x31, 0xE7, 0x5B, 0x50, 0x9F, 0x05, 0x5F, 0xA7, 0x09, 0x24, 0x12, 0x42, 0x9C,
+    0xF8, 0xBC, 0xBC, 0xD8, 0xDE, 0xE1, 0x7B, 0xFC, 0x74, 0x11, 0xED, 0x8A, 0xF5, 0xF3, 0xBD, 0xF3,
+    0x31, 0xA3, 0xB4, 0xCF, 0x92, 0x90, 0x72, 0x9B, 0xA8, 0x5F, 0xC2, 0xA8, 0xAE, 0x27, 0x8B, 0xB4,
+    0x05, 0x15, 0x26, 0xF2, 0xE2, 0x31, 0xB1, 0x20, 0x08, 0xBD, 0xE5, 0xFD, 0x32, 0x67, 0xC8, 0x8E,
+    0x9F, 0x9C, 0x16, 0xD1, 0xEB, 0x7B, 0xED, 0xCB, 0xBF, 0x4E, 0x86, 0xAC, 0x11, 0x37, 0xC6, 0xCB,
+    0x29, 0x5F, 0xC8, 0x0C, 0x61, 0x7D, 0xBC, 0xC4, 0x71, 0x51, 0xF0, 0x2B, 0xC9, 0xA9, 0xE9, 0x33,
+    0x47, 0x25, 0xE6, 0x8D, 0xC6, 0xD1, 0xEB, 0xF9, 0xB7, 0x28, 0xEF, 0x43, 0x3B, 0xC4, 0xDB, 0x0D,
+    0x44, 0xF2, 0x29, 0x7D, 0x74, 0xEA, 0xC4, 0xA7, 0x98, 0xD3, 0x94, 0xF7, 0x19, 0xFE, 0xB5, 0x48,
+    0xE3, 0xA6, 0xBD, 0x38, 0xF9, 0x53, 0x7F, 0x71, 0x1D, 0xC2, 0x93, 0xC2, 0x46, 0x67, 0x30, 0x42,
+    0x4A, 0xB7, 0x53, 0x59, 0xAF, 0x8E, 0x7F, 0x00, 0xD5, 0x55, 0xB1, 0x92, 0xDC, 0x44, 0x10, 0x6D,
+    0x49, 0x3E, 0x14, 0x28, 0xD8, 0x4B, 0xAE, 0x28, 0x22, 0xC5, 0x44, 0xF3, 0x09, 0x12, 0x7C, 0xC1,
+    0x05, 0xB7, 0xA6, 0xCA, 0x04, 0xF7, 0x01, 0x04, 0x17, 0x93, 0x20, 0xD9, 0x0E, 0x08, 0xB9, 0xC4,
+    0x3F, 0xB1, 0x04, 0xFE, 0x02, 0x3C, 0xC2, 0x0E, 0x09, 0x50, 0x42, 0xAE, 0xC4, 0x89, 0x09, 0x98,
+    0x40, 0xAE, 0xD2, 0x51, 0x1A, 0xB5, 0xDF, 0x6B, 0x49, 0x47, 0x81, 0x0D, 0x44, 0x04, 0xCC, 0xEE,
+    0x4C, 0xCD, 0x4E, 0x4B, 0xD3, 0xAF, 0x5F, 0xBF, 0xEE, 0xCD, 0x86, 0x34, 0x64, 0xF8, 0xA4, 0xF1,
+    0x7A, 0x10, 0xD5, 0x4E, 0xCA, 0x28, 0xFB, 0x68, 0x54, 0x23, 0xE6, 0x62, 0x93, 0xBF, 0xFF, 0x69,
+    0x1E, 0x8F, 0x57, 0x78, 0x6E, 0xB6, 0xC9, 0xFD, 0xBF, 0x3D, 0xBF, 0xDE, 0xBF, 0xEC, 0x33, 0x0D,
+    0x32, 0x8A, 0xAB, 0x5D, 0x2D, 0x31, 0x0F, 0x92, 0x2B, 0x50, 0x94, 0x5A, 0x8B, 0x9C, 0xED, 0x60,
+    0x2E, 0x6A, 0xBE, 0xD0, 0x8B, 0x53, 0xAD, 0x8B, 0xF8, 0x71, 0x4C, 0xA2, 0x14, 0xA1, 0x6A, 0xA5,
+    0xFA, 0x36, 0x48, 0x3A, 0x7B, 0x3C, 0xFE, 0xD3, 0x20, 0xC9, 0xAC, 0x18, 0x3F, 0x63, 0xCE, 0x7A,
+    0x3A, 0x9D, 0xBE, 0x1B, 0xF0, 0xE2, 0x82, 0x59, 0x04, 0xBA, 0xC3, 0x0D, 0xD9, 0x8C, 0x4D, 0x19,
+    0x24, 0xA9, 0x9B, 0xBB, 0xAF, 0xC6, 0x04, 0x0F, 0xD6, 0xA9, 0xEA, 0xAD, 0xC8, 0x71, 0xF7, 0x93,
+    0x78, 0xBD, 0x13, 0x39, 0xC0, 0x32, 0xD8, 0x3A, 0xCB, 0xE1, 0x16, 0x78, 0xCC, 0xE6, 0x3B, 0xAE,
+    0xAE, 0xE7, 0x7A, 0xE0, 0x95, 0x92, 0x8F, 0x5C, 0xB3, 0x89, 0x6B, 0x3A, 0xDB, 0xFB, 0xEB, 0x1A,
+    0x4F, 0x1C, 0x91, 0x70, 0x74, 0x5B, 0xFD, 0x11, 0x23, 0x7A, 0x7B, 0x66, 0x5D, 0x1B, 0x7B, 0xAB,
+    0x22, 0xAE, 0x09, 0xA1, 0x00, 0x66, 0x09, 0x0F, 0xE5, 0xC0, 0xBB, 0x9B, 0x2E, 0x8F, 0x92, 0x6A,
+    0x9D, 0xE8, 0x1B, 0x1F, 0x8D, 0x2B, 0xB8, 0x2A, 0x94, 0x9C, 0x18, 0x17, 0x72, 0x71, 0x45, 0x8A,
+    0x96, 0x1A, 0x59, 0xD3, 0x36, 0xBB, 0x7B, 0xA8, 0xED, 0x03, 0x20, 0xA4, 0xC5, 0xC0, 0xC6, 0x1D,
+    0x97, 0xC5, 0x5E, 0xBE, 0x04, 0x1A, 0xB5, 0x78, 0x2A, 0x2C, 0x81, 0xF4, 0xBE, 0x82, 0xF5, 0x05,
+    0xAC, 0xD9, 0x08, 0xAF, 0xAE, 0xAB, 0x3A, 0x50, 0x5A, 0xBD, 0x6E, 0x06, 0xF8, 0x02, 0x67, 0x0E,
+    0x5C, 0x4B, 0x72, 0x49, 0x9C, 0xF2, 0x80, 0xF1, 0x76, 0x15, 0xD7, 0x9E, 0x68, 0xD7, 0xFD, 0x7A,
+    0xFE, 0xDE, 0xF8, 0xDF, 0x10, 0x78, 0x2E, 0x35, 0x62, 0x2F, 0x7A, 0x06, 0xD5, 0x8A, 0x93, 0x1F,
+    0xD6, 0xA3, 0x3F, 0xC6, 0x19, 0x44, 0x91, 0x53, 0x1D, 0x15, 0x63, 0x59, 0x8E, 0x7E, 0x48, 0x36,
+    0xF0, 0x15, 0xE3, 0xA0, 0x5B, 0x53, 0x97, 0xE1, 0xCE, 0x03, 0xE0, 0xFA, 0x57, 0x04, 0xBA, 0xD2,
+    0x5C, 0xE3, 0x88, 0x3C, 0x3E, 0x81, 0x95, 0x9A, 0x2E, 0x02, 0x50, 0x35, 0xF5, 0xE1, 0xEE, 0x7A,
+    0x42, 0xDE, 0xB4, 0x05, 0x16, 0xC6, 0x7E, 0x65, 0xAE, 0x76, 0xC7, 0x2B, 0xB3, 0x0C, 0x2D, 0x0F,
+    0x7F, 0x3A, 0xF8, 0x0B, 0xB4, 0xF7, 0x06, 0x0A, 0x27, 0xC5, 0x75, 0xEE, 0x31, 0xBC, 0xB9, 0x16,
+    0xAE, 0x91, 0xD8, 0x74, 0x22, 0x3E, 0xC6, 0x86, 0x6F, 0x07, 0x5E, 0x71, 0x60, 0x40, 0x78, 0x00,
+    0x68, 0x55, 0x8B, 0x03, 0xD7, 0x91, 0x71, 0xD7, 0xD2, 0x5F, 0x11, 0x70, 0xC0, 0x88, 0xAA, 0xD6,
+    0xB5, 0x30, 0xC0, 0x92, 0x4E, 0x96, 0xA1, 0xE2, 0x6D, 0xF3, 0x0B, 0x0D, 0xA4, 0x42, 0x19, 0x7C,
+    0x6E, 0x99, 0xA5, 0xD8, 0xBE, 0x88, 0xD7, 0x84, 0xEA, 0x3A, 0xD7, 0x5A, 0x85, 0x4D, 0xE9, 0x64,
+    0x84, 0x28, 0x2E, 0x3D, 0xA0, 0x00, 0xCB, 0x1E, 0x97, 0xC2, 0x82, 0x1C, 0xBB, 0x96, 0xF5, 0xA7,
+    0xC4, 0x01, 0x4B, 0xD9, 0x13, 0x87, 0xAF, 0x33, 0x03, 0x86, 0xD5, 0x1B, 0xF4, 0x72, 0x80, 0x81,
+    0xD0, 0x7D, 0xB6, 0xC6, 0x92, 0x31, 0xD9, 0x3C, 0xC0, 0x39, 0x24, 0x77, 0x2E, 0xF7, 0x3A, 0x44,
+    0xFA, 0x0E, 0xA6, 0xA5, 0x39, 0x35, 0xB6, 0x36, 0xE3, 0x87, 0x06, 0x58, 0x80, 0x58, 0x62, 0x36,
+    0x0A, 0x14, 0xB2, 0x60, 0x8F, 0x78, 0x3D, 0x50, 0x20, 0xF6, 0x8A, 0xC5, 0xD2, 0xF0, 0x89, 0xB2,
+    0xE3, 0x07, 0x48, 0xF3, 0x70, 0x40, 0x90, 0xD5, 0x67, 0x33, 0x03, 0xC8, 0x7F, 0xD7, 0xEF, 0x79,
+    0xBD, 0x9A, 0x82, 0x28, 0x24, 0x8A, 0xB9, 0x7A, 0x3C, 0x97, 0x03, 0xC3, 0x6E, 0x28, 0xD8, 0xB2,
+    0x2F, 0x51, 0x40, 0xB8, 0x2F, 0x0F, 0x88, 0xB3, 0x08, 0x09, 0xA3, 0x01, 0x73, 0x0D, 0x64, 0x8E,
+    0x03, 0x5C, 0x1A, 0x41, 0x0A, 0x7C, 0xBA, 0x1F, 0x23, 0xF9, 0x46, 0x68, 0x97, 0x48, 0x68, 0x3E,
+    0x94, 0x4C, 0x0D, 0xE2, 0xFB, 0x26, 0x99, 0x3E, 0x94, 0xE3, 0x8F, 0x28, 0x3F, 0x16, 0x6C, 0xA6,
+    0xBF, 0x6A, 0xC8, 0x11, 0x44, 0xD8, 0x0B, 0x88, 0x7A, 0xB7, 0x64, 0x59, 0xF1, 0x18, 0x0F, 0x2C,
+    0x8A, 0x62, 0x94, 0x8B, 0x87, 0xCA, 0xAE, 0x70, 0x2B, 0x19, 0x97, 0xB3, 0x47, 0x3E, 0xAC, 0x4D,
+    0x6F, 0xAB, 0xB9, 0xF2, 0x5E, 0xBC, 0xD6, 0x23, 0xC6, 0xFD, 0x42, 0xFD, 0x04, 0xB6, 0xD1, 0xBF,
+    0x79, 0xAE, 0x4F, 0x18, 0x2A, 0x9A, 0x23, 0xEC, 0x67, 0xD4, 0x67, 0x9D, 0x08, 0x19, 0xC9, 0x51,
+    0x5D, 0xD9, 0x00, 0x66, 0xF0, 0xFB, 0x7E, 0x1C, 0x2F, 0xAD, 0x25, 0x83, 0x95, 0xA1, 0x7A, 0x76,
+    0x33, 0x9E, 0x1B, 0x1C, 0x0A, 0x80, 0x93, 0x7B, 0x88, 0x8A, 0x0D, 0x4A, 0x59, 0x8C, 0xEC, 0x29,
+    0xC5, 0xB4, 0xD5, 0x78, 0xDC, 0xF0, 0x47, 0x68, 0x63, 0x7E, 0xF1, 0xEC, 0x66, 0xF2, 0xB8, 0xE3,
+    0x86, 0x1D, 0x0D, 0xE5, 0xE9, 0xD8, 0x3F, 0x58, 0x4C, 0x4F, 0x31, 0x97, 0x1D, 0xBF, 0xEE, 0x31,
+    0xFC, 0xCD, 0x66, 0xCD, 0x4F, 0x2F, 0xC0, 0x3E, 0x49, 0xF2, 0xC8, 0x5B, 0xB7, 0x9F, 0x57, 0x56,
+    0x84, 0x9A, 0xDB, 0x4A, 0x97, 0x44, 0xD9, 0x5F, 0x81, 0x1D, 0xF9, 0x4F, 0xB1, 0x99, 0xFC, 0xEB,
+    0x2F, 0xF5, 0x25, 0x9C, 0x4D, 0x68, 0x60, 0xCB, 0x16, 0x38, 0x1F, 0x23, 0x17, 0x54, 0xFD, 0xE7,
+    0xA7, 0xD3, 0xF3, 0xC0, 0xC6, 0xB4, 0xB1, 0xC7, 0x57, 0x8D, 0xFA, 0xC5, 0xD4, 0xBF, 0x36, 0x5A,
+    0x53, 0x7E, 0x73, 0xCB, 0x46, 0x43, 0x05, 0x53, 0x30, 0x89, 0xEF, 0x37, 0x78, 0xEB, 0x9F, 0x4F,
+    0xB7, 0x85, 0x6E, 0x19, 0xDB, 0x37, 0x46, 0x08, 0xA1, 0x15, 0xE3, 0xD7, 0x92, 0x2F, 0xB9, 0xFE,
+    0xA6, 0x6D, 0x43, 0xBA, 0x6E, 0xF8, 0xE7, 0xF4, 0x1F, 0x8E, 0x77, 0xCD, 0x54, 0xBD, 0xAE, 0xD4,
+    0x46, 0x18, 0xFD, 0xC6, 0x86, 0xBB, 0x85, 0x8B, 0x49, 0x43, 0x45, 0xE1, 0x47, 0xF0, 0x1B, 0x64,
+    0xFC, 0x06, 0xB9, 0x45, 0x9C, 0x86, 0x82, 0x3E, 0x0D, 0x6F, 0x70, 0x6D, 0x89, 0x22, 0x25, 0x69,
+    0x78, 0x09, 0x53, 0xDC, 0x27, 0xC8, 0xB5, 0x25, 0xCA, 0x14, 0x6B, 0x89, 0x82, 0x82, 0xE2, 0x3A,
+    0x0A, 0xD1, 0x95, 0xA0, 0xC0, 0x48, 0x4B, 0x30, 0xEC, 0xD8, 0xC3, 0x39, 0x9F, 0xAD, 0xBD, 0x0B,
+    0xA4, 0x41, 0x11, 0x88, 0x91, 0x3C, 0x7B, 0xE6, 0x67, 0xBF, 0xEF, 0x7C, 0x67, 0xCE, 0x8C, 0xDC,
+    0x2C, 0x8A, 0x5C, 0x4C, 0x08, 0x5E, 0x24, 0x0D, 0xA1, 0x15, 0x29, 0x8A, 0x53, 0x39, 0x6A, 0x25,
+    0x3E, 0x7B, 0x35, 0x88, 0x44, 0x33, 0x61, 0x49, 0x68, 0x09, 0xA3, 0x40, 0x58, 0x9E, 0x01, 0xDA,
+    0xA7, 0x80, 0xD1, 0x78, 0x01, 0xE8, 0x12, 0x40, 0xDB, 0x01, 0x1A, 0x4F, 0xE8, 0x04, 0xD0, 0xF6,
+    0x80, 0xC6, 0x13, 0x3A, 0x01, 0x4C, 0x7A, 0x40, 0x8C, 0x01, 0x5D, 0x0E, 0x88, 0x71, 0x72, 0xF5,
+    0x1A, 0x0C, 0x2E, 0x4A, 0x8C, 0x93, 0xAB, 0x7D, 0x4F, 0x88, 0x71, 0x72, 0x15, 0x72, 0xC2, 0x81,
+    0x10, 0x63, 0xC0, 0x0A, 0xB0, 0x37, 0x24, 0xE9, 0x42, 0x90, 0x38, 0x84, 0x41, 0x6E, 0x15, 0xC5,
+    0x35, 0xDF, 0x09, 0x9C, 0xB6, 0x9D, 0x58, 0x3F, 0x81, 0x21, 0x80, 0x03, 0x48, 0x2E, 0xB7, 0x9D,
+    0xF1, 0x00, 0xCE, 0x6E, 0xBB, 0x4D, 0x0F, 0xE0, 0x01, 0xB2, 0xDC, 0x4F, 0xF1, 0x00, 0x80, 0xE1,
+    0x94, 0x56, 0x76, 0xFB, 0x64, 0x00, 0xB8, 0x10, 0xBB, 0xBD, 0x6C, 0xC5, 0x87, 0x1D, 0xC0, 0x2C,
+    0x00, 0x2D, 0xC0, 0x08, 0x20, 0x46, 0x6E, 0x20, 0x81, 0x8F, 0xA9, 0x40, 0x07, 0xA2, 0xE2, 0x23,
+    0xC0, 0x65, 0xF6, 0x93, 0xF6, 0x5D, 0xAA, 0x26, 0x3F, 0x48, 0x2E, 0x69, 0x75, 0x26, 0x91, 0x4F,
+    0x06, 0x05, 0x3A, 0xF3, 0x51, 0xFB, 0x8A, 0xF2, 0xAD, 0xC9, 0xCE, 0x0C, 0x46, 0x92, 0xB5, 0x0D,
+    0xFA, 0x4D, 0x9F, 0x82, 0xD9, 0xE7, 0x2C, 0xD6, 0x66, 0x9A, 0xF0, 0x3B, 0x36, 0x85, 0x80, 0x7A,
+    0x12, 0xF4, 0xA3, 0x24, 0x33, 0xBC, 0xDA, 0x6E, 0x58, 0xE4, 0x18, 0xB3, 0xB4, 0x60, 0x26, 0x4A,
+    0xDD, 0x07, 0xF4, 0x91, 0x77, 0x8C, 0x56, 0xDE, 0xED, 0x38, 0xF5, 0x12, 0xE5, 0x4B, 0x3C, 0x73,
+    0x93, 0x34, 0x4C, 0x26, 0xD9, 0x2B, 0xD8, 0x5B, 0x92, 0x3D, 0x17, 0xA2, 0xE3, 0x05, 0x77, 0xC9,
+    0x05, 0xFB, 0xF7, 0x8E, 0xFF, 0xD8, 0x2D, 0xA1, 0x32, 0x06, 0x99, 0x35, 0x47, 0x93, 0x97, 0x58,
+    0x6F, 0xAA, 0x64, 0x62, 0x72, 0x69, 0xE6, 0x47, 0xE8, 0xC9, 0xAA, 0xE2, 0x9D, 0x99, 0x19, 0xE1,
+    0xE6, 0xE9, 0x5A, 0x46, 0xB4, 0x4B, 0xA0, 0x5E, 0x0F, 0x22, 0x59, 0xFE, 0xC7, 0x67, 0x95, 0xE1,
+    0xAA, 0x49, 0x19, 0x7A, 0x16, 0xB3, 0x93, 0xE6, 0x9F, 0x7B, 0xBB, 0xCD, 0x28, 0x76, 0x70, 0x90,
+    0xE8, 0x2F, 0x24, 0xCA, 0xFE, 0x04, 0x33, 0xC7, 0xB3, 0x9A, 0x10, 0x34, 0xDE, 0x83, 0x8E, 0x7D,
+    0x05, 0x1A, 0xAE, 0xC1, 0xD4, 0x7C, 0x81, 0xA9, 0x37, 0xD8, 0x65, 0x1F, 0x63, 0xBE, 0xC1, 0x01,
+    0xC6, 0xA3, 0xED, 0xC5, 0xB5, 0xE9, 0xBB, 0x3B, 0x9E, 0x57, 0xB7, 0x43, 0x54, 0x2A, 0xFB, 0xF3,
+    0x75, 0xBA, 0x7B, 0xE1, 0xB9, 0xF0, 0x6E, 0x63, 0x2D, 0x42, 0x3F, 0xA3, 0xAF, 0xA4, 0x1C, 0x4C,
+    0x60, 0xFD, 0xC2, 0x3A, 0x5D, 0x5B, 0x82, 0x52, 0x3C, 0x3A, 0x0A, 0xD0, 0x20, 0x1E, 0x2A, 0x7A,
+    0xAA, 0x32, 0xBC, 0x57, 0x7D, 0xC2, 0x2A, 0x5C, 0x60, 0xDB, 0x6B, 0x3F, 0x6B, 0x1F, 0x8E, 0x14,
+    0xB5, 0x6F, 0x55, 0xEA, 0x71, 0x52, 0x03, 0x2D, 0xA1, 0x12, 0x06, 0x71, 0x15, 0x73, 0x64, 0x5D,
+    0x8A, 0xF5, 0xAC, 0x8F, 0x70, 0x8A, 0x6E, 0x90, 0x6C, 0xAE, 0x71, 0x67, 0xC9, 0xAA, 0xD7, 0xB3,
+    0xE5, 0x91, 0x19, 0x25, 0x6D, 0x0A, 0x65, 0x0B, 0xE9, 0xC0, 0x38, 0x0A, 0x0F, 0x9B, 0x2E, 0x65,
+    0x81, 0xD0, 0xC2, 0xFD, 0xC6, 0x4B, 0x93, 0xB5, 0xAB, 0x32, 0x6F, 0xE7, 0xBA, 0x3E, 0x57, 0x4E,
+    0x0D, 0x09, 0x71, 0xEA, 0x3D, 0x4A, 0xB7, 0xCF, 0xA8, 0xDF, 0x4F, 0x2D, 0x8D, 0xD0, 0x2E, 0x87,
+    0x10, 0xA4, 0x84, 0xCA, 0xD0, 0x1C, 0xB9, 0x33, 0x26, 0x34, 0xFA, 0xB8, 0x7D, 0x81, 0x13, 0x4F,
+    0xC2, 0x9C, 0xEB, 0xD3, 0x88, 0xEA, 0x32, 0x25, 0x9D, 0x8D, 0xA0, 0x2D, 0x4B, 0x4D, 0x16, 0x7D,
+    0xEC, 0x37, 0x5A, 0xEC, 0x7D, 0x2A, 0x96, 0x0C, 0xF4, 0x83, 0x99, 0x28, 0xAB, 0xB8, 0x73, 0x95,
+    0x67, 0x35, 0xDC, 0xAA, 0x9B, 0xF6, 0xAB, 0xA0, 0x47, 0x4E, 0x0C, 0xA5, 0x3A, 0xF1, 0x81, 0x7A,
+    0xF7, 0xC9, 0x12, 0xAA, 0xD1, 0xB3, 0x61, 0x8E, 0x68, 0x5A, 0x0F, 0x2D, 0xDB, 0xE1, 0xCD, 0xC3,
+    0x39, 0xBE, 0x38, 0x0F, 0xCA, 0x8A, 0xD9, 0x4A, 0x3D, 0x77, 0xB9, 0x95, 0xFF, 0x1F, 0x0F, 0x56,
+    0x8B, 0x07, 0xD3, 0x6B, 0x0F, 0x86, 0xBA, 0x7E, 0xB4, 0x3F, 0x90, 0x3D, 0x78, 0xF0, 0x5F, 0x7A,
+    0x10, 0x77, 0x1D, 0x76, 0x39, 0xF6, 0xE0, 0xF4, 0xA9, 0x07, 0x4F, 0x99, 0x56, 0x1F, 0x19, 0x7D,
+    0x6E, 0x16, 0xF8, 0xDF, 0x57, 0xFD, 0x24, 0xE0, 0x9E, 0xC7, 0xEA, 0x53, 0xC7, 0x6B, 0x65, 0x9E,
+    0xCB, 0x6D, 0xBD, 0x56, 0xA9, 0x16, 0xA6, 0x8E, 0x32, 0x3A, 0xC1, 0x40, 0xA0, 0x9F, 0xAB, 0xDF,
+    0x0E, 0x6B, 0x91, 0x17, 0xCA, 0xDA, 0xF2, 0x8D, 0xF0, 0xF2, 0x6B, 0x5D, 0x37, 0xEB, 0xAC, 0x1E,
+    0xEF, 0xF5, 0xDE, 0xFC, 0x10, 0x61, 0x3E, 0xFC, 0xD7, 0x8E, 0x11, 0x1F, 0x17, 0x71, 0x50, 0xB4,
+    0x5A, 0x38, 0xDC, 0x66, 0x07, 0xA1, 0x64, 0x79, 0xDC, 0x6D, 0xEB, 0xF8, 0xE5, 0xFC, 0xFD, 0xE8,
+    0xB1, 0x2F, 0xE8, 0xA9, 0x91, 0x94, 0xF3, 0x1F, 0x8B, 0x06, 0x7F, 0x51, 0x37, 0x20, 0x95, 0xF1,
+    0xCB, 0x4B, 0x2A, 0xF3, 0x49, 0x5D, 0xCF, 0xF0, 0xB8, 0x7E, 0x7C, 0x88, 0xD7, 0xD4, 0xD3, 0xB2,
+    0x87, 0x7B, 0xD3, 0xE1, 0xEC, 0x97, 0xD0, 0xD1, 0xA0, 0x8C, 0x25, 0x85, 0x7C, 0xDB, 0xF6, 0x01,
+    0xD5, 0x55, 0xB1, 0x72, 0xD3, 0x40, 0x10, 0x5D, 0x49, 0x10, 0x17, 0x2A, 0x2E, 0x05, 0x5D, 0x0A,
+    0xF5, 0x34, 0xFA, 0x03, 0x4E, 0x0C, 0x3F, 0xE0, 0x02, 0xD7, 0xFC, 0x09, 0x52, 0x47, 0xCB, 0x27,
+    0x50, 0xA4, 0xC1, 0xBF, 0x00, 0xC9, 0xA9, 0x4B, 0x41, 0x81, 0xFF, 0x20, 0xAA, 0x69, 0x10, 0x8C,
+    0x66, 0x10, 0x41, 0xBE, 0xE3, 0xBD, 0x95, 0x95, 0xB1, 0x1D, 0x67, 0x92, 0x61, 0x60, 0x86, 0xDC,
+    0x58, 0x6B, 0xED, 0xEA, 0xED, 0xED, 0xEE, 0xDB, 0x3D, 0x49, 0x1E, 0x2F, 0x16, 0x85, 0x88, 0x09,
+    0xA1, 0x9E, 0xE4, 0x68, 0xD9, 0x5A, 0x25, 0xAE, 0xB8, 0xB7, 0x95, 0x48, 0xD2, 0xE7, 0x00, 0xCC,
+    0x5A, 0xD3, 0x00, 0xDC, 0xA4, 0xAD, 0x48, 0x56, 0x27, 0xBD, 0x88, 0xAD, 0xE2, 0x01, 0xB2, 0x10,
+    0x2F, 0xE2, 0xF4, 0xB7, 0x9E, 0x8C, 0xB9, 0x02, 0x4C, 0x33, 0x03, 0x38, 0x55, 0xC7, 0xA4, 0xCF,
+    0xB0, 0x49, 0x3C, 0xE4, 0xD8, 0x50, 0xBC, 0x65, 0x2C, 0xE7, 0x18, 0xC7, 0xAE, 0x29, 0xF3, 0x81,
+    0xD2, 0x74, 0x2A, 0x5B, 0xCA, 0xAC, 0xD1, 0xA7, 0x35, 0x65, 0x00, 0x3C, 0x09, 0x08, 0x03, 0xD9,
+    0xAB, 0x5C, 0xD1, 0xFC, 0x52, 0x13, 0x5D, 0x2C, 0xF0, 0x1F, 0xC2, 0xB0, 0x11, 0xAA, 0x5E, 0xAF,
+    0xC0, 0x98, 0x28, 0x25, 0xE9, 0x50, 0xC9, 0xAC, 0x45, 0x21, 0xA6, 0x31, 0x2B, 0x31, 0x2B, 0xE4,
+    0x94, 0xD5, 0x48, 0xCF, 0x56, 0x49, 0x27, 0x16, 0x20, 0xE6, 0x3F, 0xB0, 0x02, 0x1F, 0x61, 0x97,
+    0x32, 0x66, 0x81, 0x2F, 0x90, 0x4F, 0xFE, 0x06, 0xE9, 0x98, 0x4F, 0xAC, 0xFD, 0x92, 0x34, 0x7C,
+    0xAD, 0x19, 0x1F, 0x09, 0xC5, 0x81, 0x01, 0x98, 0x14, 0xBD, 0x84, 0x5E, 0xC2, 0xAA, 0x85, 0x45,
+    0x0B, 0x6B, 0x96, 0x12, 0x58, 0x47, 0xAC, 0x23, 0xA2, 0xD4, 0x8A, 0xA4, 0x88, 0x88, 0x69, 0xB2,
+    0x8A, 0xD4, 0x28, 0xB3, 0x7A, 0x3F, 0xDA, 0x6F, 0xAC, 0x07, 0xD3, 0x86, 0x27, 0x32, 0x17, 0x79,
+    0x1D, 0xC1, 0xEE, 0x18, 0x5A, 0xEF, 0x1E, 0xC9, 0xF1, 0x7E, 0x3D, 0xFF, 0x61, 0x43, 0x8E, 0x4E,
+    0x9F, 0x56, 0x2C, 0x97, 0x6C, 0x64, 0xF5, 0x39, 0xCB, 0x7D, 0x4E, 0xDF, 0xB3, 0x84, 0x7E, 0x5D,
+    0x5A, 0x1F, 0x68, 0xCE, 0x83, 0x69, 0x8B, 0x2C, 0x8F, 0xDE, 0x81, 0x0A, 0x78, 0x25, 0x1D, 0x62,
+    0xA4, 0x8D, 0xC5, 0x16, 0xD5, 0x99, 0xC8, 0xB3, 0xA8, 0x63, 0xD3, 0xB6, 0x0F, 0xBD, 0x9B, 0x7A,
+    0xD3, 0x4F, 0xBD, 0x41, 0x76, 0xEC, 0x4D, 0xBA, 0xD3, 0x9B, 0x62, 0xEA, 0x0D, 0x42, 0x9E, 0xCB,
+    0x2D, 0xBD, 0x49, 0x77, 0x7B, 0x13, 0xDD, 0xDD, 0x1B, 0xD2, 0xF8, 0x61, 0xAF, 0x37, 0x3A, 0x40,
+    0x56, 0x94, 0x48, 0xD2, 0x27, 0x1F, 0x0F, 0x0E, 0x95, 0x65, 0xB7, 0xAC, 0x52, 0x77, 0x5F, 0x51,
+    0x50, 0x80, 0x6D, 0x9F, 0x83, 0x2C, 0x6F, 0x7A, 0x39, 0xF1, 0xB3, 0x10, 0x82, 0x8F, 0x28, 0xE4,
+    0x24, 0xBC, 0xF5, 0xD7, 0x09, 0xDF, 0x5F, 0xCC, 0xA3, 0x42, 0x07, 0x3F, 0xAF, 0xDD, 0x78, 0xAA,
+    0x8F, 0x65, 0xF7, 0xA5, 0x0A, 0x5C, 0x16, 0xC0, 0x6D, 0x68, 0xC0, 0x08, 0xCA, 0x2F, 0x27, 0xC3,
+    0x2F, 0x18, 0x3C, 0x0D, 0x20, 0x36, 0xFB, 0xDC, 0x4A, 0xFA, 0x3D, 0x7C, 0x71, 0x43, 0x8E, 0x64,
+    0x22, 0xE7, 0x5F, 0xD5, 0x23, 0x4F, 0xCA, 0x1A, 0x27, 0x2F, 0xDB, 0x31, 0x94, 0x40, 0x65, 0xB8,
+    0x2E, 0x70, 0x7D, 0x3B, 0x0C, 0xF9, 0x1B, 0x86, 0x81, 0xA9, 0xC2, 0xC0, 0xAF, 0x85, 0x9E, 0x8C,
+    0x61, 0xC3, 0xBC, 0xD9, 0x37, 0x4C, 0x5D, 0x09, 0xE1, 0x32, 0x84, 0x1F, 0x7E, 0xF9, 0x7E, 0xAD,
+    0x07, 0x01, 0xA3, 0x84, 0xF1, 0x91, 0x3B, 0x95, 0xAB, 0x82, 0x13, 0x1C, 0x6E, 0x85, 0xCA, 0x86,
+    0x56, 0x53, 0x5B, 0x1D, 0xA5, 0x71, 0x84, 0x54, 0xB9, 0x41, 0xF8, 0xF6, 0x79, 0x15, 0x73, 0xA1,
+    0x67, 0x67, 0xF8, 0x23, 0x65, 0x31, 0xA7, 0x12, 0xC2, 0x4F, 0x2A, 0xFC, 0xD2, 0x98, 0x8B, 0xAB,
+    0x65, 0x68, 0x15, 0xE6, 0x6A, 0xC2, 0xE2, 0xB5, 0x2A, 0x78, 0x9F, 0xD1, 0xC7, 0xAB, 0x82, 0x03,
+    0x44, 0xC5, 0x6D, 0x3D, 0x89, 0x46, 0x98, 0x55, 0x9F, 0xBC, 0xD3, 0xDD, 0xBC, 0x6E, 0x8D, 0xE1,
+    0x87, 0xE2, 0x0B, 0x65, 0xF4, 0x5F, 0xAE, 0xDF, 0xBD, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0x7E,
+    0xF6, 0x64, 0xB1, 0x74, 0x2E, 0xDC, 0xB0, 0x42, 0x57, 0x4D, 0x45, 0x81, 0x10, 0xB8, 0xA5, 0x88,
+    0xCE, 0x4E, 0x0A, 0x28, 0xB3, 0xC5, 0x6D, 0xDA, 0xF4, 0xD7, 0xF0, 0x0F, 0x00, 0xE3, 0x63, 0xFF,
+    0x00, 0xD2, 0xD3, 0xD0, 0x20, 0x91, 0xA5, 0x48, 0x43, 0x71, 0x48, 0xB9, 0x78, 0x44, 0x44, 0x45,
+    0xE3, 0xE4, 0x0A, 0x0A, 0x8A, 0x98, 0x0A, 0x41, 0x9A, 0x41, 0xDA, 0x10, 0x73, 0x67, 0xCF, 0xE3,
+    0x7B, 0x63, 0x5F, 0xB2, 0xDC, 0x51, 0x5C, 0x1A, 0x7C, 0x37, 0xA3, 0x99, 0x37, 0x6F, 0xBE, 0x37,
+    0xEF, 0x7B, 0x3F, 0x96, 0x22, 0xBA, 0x46, 0x44, 0x45, 0x39, 0x60, 0x1E, 0xD4, 0x86, 0x48, 0xB9,
+    0xD4, 0x12, 0x8D, 0xE2, 0x8B, 0x9F, 0x28, 0xA9, 0x17, 0x50, 0xA2, 0xEC, 0x69, 0x23, 0xD7, 0x4C,
+    0x29, 0xD2, 0xCB, 0x62, 0xFE, 0x1D, 0x62, 0x66, 0x6E, 0xD4, 0x0B, 0x99, 0x45, 0x6C, 0xAC, 0x68,
+    0x9B, 0x52, 0xB4, 0xBD, 0x68, 0xAB, 0x4E, 0xC4, 0x59, 0xFB, 0x52, 0x9C, 0xF4, 0xE7, 0xDA, 0xCC,
+    0x83, 0x80, 0xF8, 0x92, 0x86, 0x08, 0x92, 0x7E, 0x6B, 0xEA, 0x81, 0x7F, 0xD5, 0xE9, 0x5D, 0xBF,
+    0xFE, 0x86, 0x0A, 0xE6, 0x6E, 0x9C, 0xE2, 0xD7, 0xB9, 0x1B, 0xB1, 0xDB, 0x9E, 0x40, 0xCB, 0xA5,
+    0x29, 0xBA, 0xD3, 0x12, 0xC5, 0xDC, 0xC8, 0x24, 0x3C, 0xEC, 0x4F, 0x2C, 0x29, 0x3C, 0x3F, 0x0C,
+    0xBF, 0xBE, 0x17, 0x18, 0xBD, 0x30, 0xDE, 0xFA, 0x7B, 0x49, 0x35, 0xB3, 0x95, 0x21, 0xEB, 0xFF,
+    0xD2, 0x51, 0xBE, 0x02, 0x4E, 0x13, 0x06, 0xA5, 0x5B, 0x23, 0x6B, 0x28, 0xFE, 0xD8, 0x52, 0xC2,
+    0x15, 0x06, 0x8C, 0x2D, 0x88, 0xF2, 0x8A, 0x48, 0x57, 0x12, 0x8A, 0x81, 0x20, 0xCA, 0x5A, 0xF2,
+    0x44, 0x46, 0xDC, 0x05, 0x92, 0xEA, 0x29, 0xB7, 0x58, 0x88, 0x53, 0xA9, 0xCB, 0x04, 0xA1, 0xAD,
+    0x71, 0x4F, 0x9F, 0x88, 0x1B, 0x39, 0x60, 0x10, 0x2F, 0x71, 0x18, 0x01, 0x0A, 0x6E, 0xCB, 0x32,
+    0x0B, 0x73, 0xED, 0xC5, 0x99, 0x3F, 0xE5, 0xB0, 0x58, 0xF5, 0xC2, 0x8B, 0xBC, 0x2C, 0x6B, 0x52,
+    0xDC, 0x7C, 0x28, 0x66, 0x12, 0x47, 0xBA, 0xA1, 0xA2, 0x82, 0x05, 0xE1, 0xB6, 0xA8, 0xB0, 0xA3,
+    0xBA, 0x97, 0x6B, 0x7C, 0x16, 0x98, 0x13, 0x48, 0x2A, 0x02, 0x2B, 0xC1, 0x46, 0xE0, 0x8E, 0xB4,
+    0x88, 0xDF, 0x16, 0x35, 0x1A, 0xB9, 0x0D, 0xF4, 0x45, 0x8B, 0x91, 0x3E, 0xC0, 0x47, 0xC1, 0x11,
+    0x2F, 0x36, 0x6A, 0x09, 0x07, 0x7C, 0xCB, 0x2D, 0xEC, 0xA8, 0x0E, 0xBE, 0x90, 0xB9, 0x83, 0x29,
+    0x15, 0x62, 0x88, 0x5B, 0x81, 0x13, 0x8C, 0x54, 0x92, 0x30, 0x11, 0x83, 0xEA, 0x14, 0xA6, 0xE2,
+    0x1E, 0xEA, 0x51, 0x8F, 0x17, 0x82, 0x14, 0xF8, 0xCB, 0x13, 0x96, 0xFF, 0x4A, 0xB0, 0xE4, 0x50,
+    0x8D, 0x9E, 0xDA, 0x97, 0xAF, 0xEA, 0xCF, 0xDF, 0x3A, 0x13, 0x26, 0x42, 0x5C, 0xA9, 0x16, 0xFC,
+    0x59, 0x19, 0x28, 0xCE, 0x0F, 0x07, 0x89, 0x4D, 0xE6, 0xE4, 0x65, 0x00, 0xD0, 0x76, 0x64, 0x38,
+    0x00, 0xA3, 0x82, 0xE0, 0x55, 0x3C, 0x32, 0x14, 0x08, 0x36, 0xB7, 0x02, 0x4A, 0x47, 0x74, 0x70,
+    0x9F, 0xD7, 0x77, 0x53, 0x64, 0xAF, 0x97, 0xB0, 0x73, 0x1B, 0x2D, 0xF9, 0xF9, 0xFE, 0xC4, 0xFD,
+    0x48, 0xAF, 0x17, 0x50, 0x6D, 0x8B, 0x12, 0x78, 0xC2, 0x64, 0xF0, 0x1C, 0x78, 0xA6, 0x54, 0x21,
+    0x6D, 0x6B, 0x01, 0x0D, 0xE4, 0x62, 0x8F, 0x90, 0x86, 0x00, 0xB6, 0x81, 0x2D, 0x10, 0x92, 0xC8,
+    0x9B, 0xB2, 0x16, 0x47, 0xB9, 0x15, 0xB2, 0xA0, 0x26, 0x19, 0x50, 0x7C, 0x0E, 0x24, 0xFD, 0xB3,
+    0x1B, 0xB9, 0xDA, 0xF9, 0x96, 0xFF, 0xB8, 0x9B, 0xC1, 0xBC, 0x93, 0xA9, 0x1D, 0xA9, 0xCA, 0x9E,
+    0xE1, 0x34, 0x7F, 0x04, 0x4C, 0x23, 0xF9, 0x21, 0x4C, 0x21, 0x5F, 0x8A, 0x2A, 0x95, 0xC0, 0xC2,
+    0x5E, 0xEA, 0x84, 0xA8, 0x1E, 0x49, 0xF6, 0x1E, 0xC5, 0x8F, 0xD7, 0xC7, 0xCC, 0x0F, 0x92, 0x2F,
+    0x92, 0xD5, 0x0F, 0x95, 0xA3, 0xEB, 0x94, 0x91, 0xB2, 0x74, 0xD5, 0xC5, 0x0E, 0xE2, 0x5B, 0x46,
+    0x2D, 0xFE, 0x4E, 0xEF, 0xD5, 0xFC, 0x53, 0xE9, 0xBE, 0xBB, 0xBE, 0xF3, 0x5A, 0x00, 0xD3, 0xE2,
+    0x83, 0x83, 0xF5, 0x97, 0xEC, 0x6B, 0xFE, 0x75, 0xB9, 0xFF, 0x6A, 0x65, 0xE0, 0xD1, 0x29, 0x06,
+    0x4B, 0xFB, 0x60, 0x7B, 0xB0, 0x5E, 0xAF, 0x73, 0x2C, 0x7E, 0xC1, 0xD8, 0x2C, 0x97, 0xA2, 0x39,
+    0x7D, 0x3C, 0x7D, 0x67, 0xE7, 0x8B, 0x1F, 0x97, 0xD3, 0x77, 0x05, 0x95, 0x77, 0x68, 0x77, 0x8F,
+    0x8A, 0xFF, 0xF3, 0x7F, 0xEA, 0x27, 0x12, 0xB0, 0x93, 0x73, 0x5F, 0xE8, 0x55, 0x93, 0xE1, 0x0D,
+    0xC6, 0x30, 0x87, 0x94, 0x22, 0x97, 0xD9, 0xCF, 0xE2, 0x4D, 0x66, 0x0D, 0xBA, 0x6A, 0x6B, 0xCA,
+    0x7D, 0x09, 0x9D, 0xF5, 0xCA, 0x69, 0xFB, 0x50, 0xB9, 0xAC, 0xFA, 0x14, 0x21, 0xCC, 0x5A, 0xAF,
+    0x9F, 0xF4, 0xF9, 0xCA, 0x15, 0x49, 0xF3, 0x60, 0x56, 0x9A, 0x1B, 0x83, 0xEA, 0x52, 0x27, 0x59,
+    0x77, 0x4C, 0x5D, 0xEC, 0x10, 0x1E, 0x97, 0x54, 0x05, 0x75, 0x49, 0xAB, 0xCB, 0x63, 0xE4, 0xB9,
+    0x2D, 0xA2, 0x5E, 0x12, 0xC0, 0xAB, 0x4E, 0x37, 0xE6, 0xE6, 0x10, 0x2D, 0x66, 0x65, 0xEA, 0xF2,
+    0x8A, 0x55, 0x8F, 0xA6, 0x7D, 0x03, 0xB5, 0xA5, 0x6D, 0x0D, 0x9B, 0x4D, 0x41, 0xBD, 0x6A, 0xB3,
+    0xEA, 0x93, 0x08, 0x18, 0x73, 0x69, 0xE8, 0xAB, 0x4E, 0x3F, 0x1E, 0x12, 0x57, 0x4B, 0x11, 0x7A,
+    0xE0, 0xE0, 0x19, 0x87, 0x1B, 0x18, 0x8D, 0xDD, 0x1C, 0xEF, 0x40, 0xAA, 0x25, 0x1B, 0xDD, 0xE0,
+    0x28, 0x06, 0x90, 0xB6, 0x06, 0xD7, 0x5D, 0xDA, 0xE4, 0xE5, 0x5E, 0x84, 0x67, 0x64, 0x76, 0x46,
+    0x6F, 0xD2, 0x4E, 0x25, 0x1D, 0x2C, 0xD4, 0xA4, 0x14, 0xA7, 0x54, 0xE9, 0x1E, 0xB6, 0x47, 0x74,
+    0x2D, 0x6E, 0x66, 0x28, 0x22, 0x0F, 0xCF, 0xFF, 0xFA, 0xFA, 0xFB, 0x83, 0x2A, 0x96, 0xB6, 0x08,
+    0xE5, 0xF7, 0xC3, 0x29, 0x29, 0x14, 0x45, 0x56, 0x8D, 0x65, 0xBC, 0x75, 0xF7, 0xC2, 0xD6, 0x8C,
+    0x3D, 0x3E, 0x41, 0xAD, 0x4A, 0x51, 0x89, 0x31, 0x94, 0xDE, 0xB6, 0x46, 0x1E, 0xE0, 0x8A, 0x67,
+    0x21, 0xAB, 0x90, 0x65, 0xF7, 0x5D, 0x40, 0xDF, 0x82, 0x1B, 0xFE, 0xBD, 0x3D, 0xA2, 0xF9, 0xCD,
+    0xF6, 0xF6, 0x94, 0x32, 0xCF, 0x17, 0x47, 0xF3, 0x2A, 0x6E, 0x2F, 0xD9, 0x16, 0x63, 0x0B, 0xF4,
+    0x14, 0xCD, 0x2B, 0xEE, 0x0B, 0x7E, 0x34, 0x4D, 0x9A, 0xCB, 0x1C, 0x27, 0x51, 0x13, 0x1A, 0x6A,
+    0x47, 0xC6, 0xE3, 0xA7, 0xEE, 0x23, 0x1E, 0x34, 0x57, 0xA6, 0x45, 0x2B, 0x4C, 0xA4, 0x3B, 0xD2,
+    0x6E, 0xFE, 0xF4, 0xCC, 0xD7, 0x1F, 0xD2, 0x0C, 0x18, 0x85, 0x55, 0xBD, 0x69, 0xD4, 0x50, 0xC8,
+    0xC0, 0x5A, 0x64, 0x32, 0x68, 0x17, 0x9D, 0x80, 0x49, 0xFF, 0x36, 0xA0, 0x9B, 0xA7, 0x3D, 0x97,
+    0xDA, 0xC5, 0x2C, 0x0A, 0x64, 0x0E, 0x4B, 0xD0, 0xFA, 0x46, 0x39, 0xC3, 0xC5, 0x13, 0xDC, 0x99,
+    0x7A, 0x2D, 0xFD, 0x03, 0xB5, 0x55, 0x3D, 0x6F, 0xE4, 0x44, 0x18, 0x7E, 0xEC, 0x49, 0x6E, 0x0A,
+    0x8B, 0x9B, 0x06, 0xA4, 0x43, 0x48, 0x4C, 0x43, 0x85, 0x74, 0xF1, 0x1F, 0x48, 0xD6, 0xD6, 0xA5,
+    0x48, 0x41, 0x41, 0x0A, 0xAE, 0xA2, 0x80, 0x3A, 0x15, 0x0D, 0x5D, 0x12, 0x1B, 0x51, 0xD0, 0x9E,
+    0x84, 0xE8, 0x29, 0x28, 0x60, 0x25, 0xFA, 0x2B, 0xBC, 0xDA, 0x39, 0xA5, 0xA0, 0xB5, 0xD2, 0xD0,
+    0x5A, 0x77, 0x12, 0xF5, 0x48, 0x58, 0x62, 0x24, 0xBC, 0x19, 0x9E, 0x77, 0x9C, 0x4D, 0x96, 0xEB,
+    0xB8, 0x13, 0x96, 0x66, 0xDE, 0x79, 0xBF, 0x3F, 0x67, 0x7C, 0xB6, 0x5C, 0xC7, 0x08, 0xE5, 0xE0,
+    0x71, 0x08, 0xF3, 0xDF, 0x0E, 0xB9, 0xC3, 0x72, 0xD9, 0xC4, 0x37, 0xD0, 0xBC, 0x3D, 0x3C, 0x6C,
+    0xE2, 0xEF, 0x71, 0xF3, 0xDA, 0x46, 0x8E, 0xC1, 0x1B, 0x6D, 0x54, 0x5F, 0xFE, 0xFC, 0x15, 0x34,
+    0x90, 0xB6, 0xAF, 0x9F, 0x9E, 0xBC, 0x9D, 0xB5, 0xEB, 0xE5, 0xAF, 0x40, 0x8F, 0x77, 0xD2, 0xF6,
+    0xDE, 0xD3, 0xB7, 0x8A, 0x6D, 0xE7, 0xB3, 0x01, 0x28, 0x9C, 0x9C, 0x34, 0x6B, 0x87, 0x90, 0x88,
+    0x9B, 0xD2, 0xA1, 0x9C, 0xD9, 0x75, 0x07, 0x3D, 0xC8, 0x49, 0x79, 0x35, 0x60, 0x4A, 0xC4, 0x0A,
+    0x0B, 0xD8, 0x36, 0x11, 0x07, 0x92, 0x67, 0x7B, 0x0B, 0x92, 0x2F, 0xB0, 0x25, 0x1A, 0xB7, 0x25,
+    0xE6, 0xE3, 0x1D, 0x71, 0x91, 0x9D, 0x02, 0x9F, 0x89, 0x7A, 0xF1, 0x22, 0x0E, 0x68, 0x42, 0xEE,
+    0x75, 0x1F, 0x9A, 0xD8, 0xDA, 0x38, 0x98, 0x76, 0xAA, 0x4C, 0xBF, 0x51, 0x63, 0x55, 0xAF, 0xD7,
+    0xDF, 0x0D, 0x41, 0x0D, 0x0B, 0x04, 0x15, 0x87, 0xC9, 0xD6, 0x95, 0xEE, 0x8D, 0x7B, 0xF0, 0xA3,
+    0x7D, 0xE2, 0x73, 0xDF, 0xA1, 0x93, 0x50, 0x4A, 0xD8, 0x4F, 0x9C, 0xA6, 0x8F, 0x95, 0xF2, 0xD9,
+    0x38, 0x89, 0x63, 0xE3, 0x2A, 0xD8, 0x4F, 0x9D, 0xEE, 0x91, 0x53, 0x2E, 0x1B, 0x3B, 0x9C, 0x8B,
+    0xFF, 0x12, 0x65, 0xE1, 0x98, 0xA0, 0x71, 0xD9, 0xA8, 0xFC, 0x05, 0x33, 0xC8, 0x02, 0x4C, 0xBB,
+    0x50, 0xF4, 0xC8, 0x48, 0xB0, 0x32, 0x7D, 0x79, 0x3C, 0x82, 0x6A, 0x2A, 0x06, 0xC4, 0x1B, 0x48,
+    0x8E, 0xE6, 0x86, 0x58, 0x4A, 0x10, 0xFB, 0x40, 0x56, 0xE3, 0xDF, 0x5F, 0x26, 0xBC, 0x8B, 0x2D,
+    0x56, 0x48, 0xDD, 0xA6, 0x2D, 0x66, 0xFE, 0xA0, 0x87, 0x71, 0x8B, 0x95, 0xF5, 0x0A, 0xEA, 0xAE,
+    0xDE, 0x52, 0xB7, 0xA2, 0xBF, 0xC7, 0x2A, 0x06, 0xB2, 0xC5, 0xA4, 0x7C, 0xE5, 0x9D, 0x87, 0xCB,
+    0x24, 0xBB, 0x8B, 0x4D, 0xBB, 0xD8, 0xBD, 0x03, 0xD1, 0x53, 0x7E, 0xBF, 0xC6, 0xB6, 0xB4, 0x2C,
+    0xD6, 0x7A, 0x44, 0xB9, 0x61, 0x58, 0x75, 0x89, 0x4B, 0x73, 0xC5, 0x39, 0x59, 0xF3, 0x18, 0x7B,
+    0xEB, 0xA6, 0xF2, 0xC4, 0xAF, 0xB3, 0x8D, 0x75, 0xD5, 0x89, 0x37, 0x31, 0x2C, 0x8C, 0x2B, 0x9F,
+    0x8C, 0x45, 0xBF, 0xCA, 0xA4, 0xD0, 0x9D, 0x71, 0xF6, 0x5B, 0xF6, 0x78, 0xA2, 0xAB, 0xB3, 0x3A,
+    0xD8, 0xD6, 0x5C, 0xB1, 0x65, 0x82, 0x31, 0x03, 0x62, 0xBF, 0x6D, 0x31, 0xDD, 0xDB, 0x3A, 0x61,
+    0x41, 0x7A, 0x41, 0xAD, 0x1D, 0xCC, 0xD6, 0xBB, 0x7A, 0x92, 0xDF, 0x3D, 0xB6, 0xC2, 0x8E, 0x07,
+    0x0E, 0xDA, 0xBD, 0x77, 0x76, 0x0C, 0xDA, 0xAF, 0x31, 0x47, 0xC6, 0x51, 0x41, 0x3E, 0x47, 0xCD,
+    0xB9, 0x80, 0x4C, 0xD2, 0x9C, 0x91, 0x8E, 0xF5, 0x5D, 0x4B, 0x52, 0xB6, 0x2C, 0xAF, 0x75, 0xA6,
+    0xD7, 0x83, 0x0C, 0x01, 0x8D, 0x9E, 0xCB, 0x5C, 0xA6, 0xAA, 0x07, 0x34, 0x6A, 0xC4, 0x46, 0xFB,
+    0x2C, 0x18, 0x27, 0xE1, 0xEB, 0xBE, 0xA4, 0xA5, 0x23, 0xB2, 0x9F, 0x53, 0xC8, 0xE3, 0x3C, 0xEF,
+    0x93, 0x5C, 0xD1, 0x6B, 0x5F, 0xD6, 0x13, 0x36, 0x9C, 0x29, 0xC6, 0xDE, 0xC9, 0x38, 0x9B, 0xB6,
+    0xC3, 0x45, 0x4E, 0x40, 0x05, 0x4E, 0x92, 0x2F, 0xDA, 0x23, 0xD1, 0x29, 0x5A, 0xED, 0x1E, 0x53,
+    0x55, 0xF2, 0xC8, 0x03, 0x93, 0xE3, 0xBD, 0xE8, 0x98, 0x61, 0xE6, 0xC9, 0x55, 0x6E, 0x45, 0x74,
+    0x12, 0x8E, 0x6D, 0x95, 0x17, 0x26, 0x7B, 0xED, 0x84, 0x1F, 0x60, 0x45, 0x24, 0x1F, 0x70, 0x98,
+    0xA4, 0x2E, 0xA9, 0x3F, 0x0B, 0x7E, 0x13, 0xA4, 0x79, 0xA5, 0xC8, 0x32, 0xE7, 0xEE, 0x56, 0x5C,
+    0x2C, 0xDE, 0x6A, 0x1C, 0xD0, 0x2E, 0x95, 0x52, 0xD6, 0x07, 0x48, 0x53, 0x56, 0xF0, 0x86, 0x1E,
+    0x79, 0xE4, 0x2F, 0x59, 0x19, 0x72, 0x9E, 0x17, 0xB5, 0x72, 0x86, 0x4C, 0x89, 0xEC, 0xB0, 0x68,
+    0x31, 0x1E, 0x81, 0xBA, 0xFB, 0x52, 0xE0, 0xAA, 0x36, 0x43, 0x3E, 0x61, 0x0D, 0xEB, 0x58, 0x8C,
+    0xA6, 0xE6, 0xB9, 0xF0, 0xA8, 0x5A, 0x70, 0xBA, 0x47, 0x12, 0xF1, 0x6C, 0x4F, 0x6A, 0x4D, 0xC2,
+    0xE6, 0x96, 0xB0, 0x86, 0x9A, 0x50, 0x3A, 0x96, 0x6D, 0xB3, 0xD5, 0x6E, 0x80, 0xBB, 0x19, 0x45,
+    0x2D, 0xDD, 0xC8, 0xC0, 0xEB, 0x12, 0xA0, 0xFA, 0xAA, 0xCE, 0x68, 0x29, 0x50, 0xB5, 0x22, 0xA0,
+    0x42, 0x26, 0x80, 0xA8, 0x00, 0xA2, 0x09, 0x10, 0x15, 0x40, 0xF7, 0x09, 0xE8, 0x31, 0x01, 0x34,
+    0xC7, 0x41, 0x1A, 0xA9, 0xFF, 0x0A, 0xD8, 0x33, 0xF2, 0x14, 0xC0, 0x5E, 0x4D, 0x62, 0xB6, 0x18,
+    0xF9, 0x03, 0x88, 0x35, 0xA7, 0xB4, 0x56, 0x7F, 0x8F, 0x92, 0xB5, 0x0A, 0x8D, 0xF4, 0x5D, 0x05,
+    0x3D, 0x26, 0x20, 0x21, 0x09, 0xD0, 0x7E, 0x76, 0xD4, 0xCC, 0x80, 0xE8, 0xEC, 0x48, 0xC0, 0x01,
+    0x51, 0x02, 0xDB, 0xA3, 0xE1, 0x78, 0xD1, 0xAC, 0x1E, 0x1E, 0xF1, 0x59, 0x03, 0xBE, 0xA4, 0xC4,
+    0xFB, 0xE9, 0x66, 0x3A, 0xFB, 0x6A, 0xCA, 0x6E, 0x2A, 0x67, 0x5E, 0x4D, 0x10, 0x70, 0xCD, 0x21,
+    0x28, 0x5B, 0x73, 0x1D, 0xB6, 0x60, 0xE2, 0x28, 0xBF, 0xE0, 0x58, 0xD9, 0xBA, 0x20, 0xE8, 0x08,
+    0x1C, 0x81, 0x21, 0xF0, 0x04, 0xD0, 0xEE, 0x14, 0xEF, 0xDE, 0xD6, 0x65, 0x1F, 0x0F, 0x8E, 0x69,
+    0xAC, 0xE9, 0xCB, 0x3F, 0x37, 0x79, 0xAC, 0x9C, 0x1D, 0x4E, 0xF1, 0xD1, 0xFC, 0x52, 0xDC, 0xA0,
+    0x8C, 0xB1, 0xAF, 0xE2, 0x17, 0xE3, 0x5E, 0xC5, 0x72, 0x56, 0x0C, 0x42, 0xDE, 0xC9, 0x79, 0xAD,
+    0xB8, 0xBA, 0x74, 0xB9, 0x2B, 0xA9, 0x22, 0x0B, 0x51, 0x31, 0x57, 0x8E, 0x3A, 0x4A, 0x2F, 0x21,
+    0x72, 0xB5, 0x32, 0xA6, 0xF3, 0xDA, 0x7F, 0xED, 0x19, 0x12, 0x5A, 0x45, 0x99, 0x86, 0x8B, 0x4D,
+    0x14, 0x7E, 0x15, 0xF9, 0xA5, 0xED, 0xE3, 0xE5, 0x72, 0xF9, 0xCB, 0x23, 0x11, 0xFB, 0x5E, 0xE6,
+    0xE7, 0x43, 0x23, 0x45, 0xE3, 0x80, 0x01, 0xA3, 0xBC, 0xC8, 0x97, 0x2C, 0x34, 0x9A, 0x16, 0x96,
+    0xC1, 0x01, 0x1F, 0xC4, 0x67, 0x64, 0x9C, 0xFD, 0xC4, 0x6D, 0x1D, 0xA5, 0xA4, 0x3F, 0x7C, 0xEE,
+    0xE5, 0x85, 0xE7, 0xED, 0x20, 0xD7, 0xA6, 0x3F, 0xC6, 0xF9, 0x63, 0x6E, 0xF9, 0x4B, 0x31, 0xF6,
+    0x10, 0xFF, 0xD3, 0xF7, 0x0F, 0xC5, 0x55, 0xBF, 0x6F, 0xD5, 0x56, 0x14, 0x3E, 0xB6, 0x15, 0xAC,
+    0x62, 0x89, 0xDB, 0x81, 0x0C, 0xC0, 0xE0, 0x1D, 0xA9, 0xEF, 0xFD, 0x03, 0xBC, 0x5C, 0x67, 0xE8,
+    0x0C, 0x03, 0xA1, 0x03, 0x2B, 0x13, 0x03, 0xAC, 0x41, 0x6A, 0x9F, 0x2D, 0x31, 0x32, 0xB4, 0x03,
+    0x1B, 0x6B, 0x07, 0x78, 0x43, 0xB3, 0x74, 0x48, 0x5B, 0x88, 0x2D, 0x75, 0x60, 0x60, 0x79, 0x6A,
+    0x46, 0x06, 0x4C, 0x84, 0x84, 0x10, 0x12, 0xDC, 0x56, 0xAE, 0xB0, 0x12, 0xDB, 0x87, 0xF3, 0x5D,
+    0xFB, 0x3A, 0x09, 0x2D, 0x99, 0x2A, 0xD5, 0xD2, 0x3D, 0xB9, 0xEF, 0xBB, 0xE7, 0x9E, 0xFB, 0x9D,
+    0x9F, 0x21, 0xC2, 0x77, 0x89, 0x28, 0x2A, 0x88, 0x2A, 0xA2, 0x98, 0x28, 0x58, 0x12, 0x7D, 0x2B,
+    0x40, 0x46, 0x64, 0x88, 0x26, 0x23, 0xA0, 0x12, 0xF2, 0x04, 0xD0, 0x02, 0x88, 0x62, 0x5E, 0x90,
+    0x9A, 0x91, 0xFF, 0xA7, 0xA1, 0x99, 0xA2, 0xB0, 0xD8, 0xA6, 0x2A, 0x28, 0x62, 0xFA, 0x2A, 0x28,
+    0x3D, 0x73, 0x09, 0xAA, 0xF2, 0x79, 0x3F, 0x92, 0xFB, 0x74, 0xE6, 0x76, 0x7E, 0x3D, 0x82, 0xD3,
+    0xC4, 0xED, 0xBC, 0x6A, 0x04, 0x63, 0xB7, 0x99, 0xAF, 0x9B, 0x0B, 0x4B, 0xBB, 0x8B, 0x78, 0xEB,
+    0x76, 0xDB, 0x83, 0x39, 0x33, 0x97, 0xFD, 0xF6, 0x5A, 0xFE, 0xE6, 0xCA, 0xA0, 0x1A, 0xB5, 0xA3,
+    0xA1, 0x03, 0x33, 0x3E, 0x19, 0x17, 0xC3, 0x4E, 0x95, 0x9D, 0x7B, 0xBC, 0x0D, 0xDD, 0x4B, 0xBA,
+    0xD0, 0xEE, 0xFC, 0x67, 0xAF, 0x37, 0x79, 0xDE, 0x92, 0xBC, 0x08, 0x33, 0x0D, 0x76, 0x01, 0x6C,
+    0xF5, 0x56, 0x34, 0xC4, 0x21, 0xA8, 0xB2, 0x01, 0xFC, 0x92, 0xEA, 0x01, 0x0C, 0x5E, 0xA9, 0xF5,
+    0x1D, 0x79, 0x6A, 0xE2, 0x35, 0xBA, 0xDB, 0x67, 0x43, 0x7C, 0x70, 0xC0, 0x4F, 0x85, 0x2E, 0x93,
+    0x12, 0xD1, 0x78, 0xD7, 0xBB, 0xAB, 0x44, 0x2B, 0xB7, 0x21, 0x53, 0x4B, 0x92, 0xC5, 0xB2, 0x7A,
+    0x01, 0x4B, 0x3A, 0x15, 0x6A, 0x15, 0x9C, 0x88, 0xF6, 0xC4, 0x5E, 0x1A, 0x1A, 0x50, 0x50, 0x4B,
+    0x31, 0x07, 0x92, 0xBA, 0xC8, 0xC9, 0x6F, 0x3C, 0x39, 0x0F, 0xAB, 0xA0, 0xA6, 0x30, 0x3B, 0x03,
+    0x4D, 0x9A, 0xD1, 0x91, 0xEF, 0xE6, 0xE2, 0x01, 0x77, 0x39, 0xBF, 0xDC, 0xB8, 0x8A, 0x5F, 0x6B,
+    0x10, 0x8F, 0x21, 0x6A, 0x47, 0x39, 0x44, 0x2C, 0x15, 0x9C, 0x99, 0xDA, 0xE8, 0x3A, 0x87, 0x6C,
+    0xE8, 0x03, 0x04, 0x00, 0x15, 0x40, 0x71, 0xE6, 0xBC, 0x7D, 0xE2, 0xAE, 0xFB, 0xFF, 0x72, 0x7D,
+    0xED, 0xF8, 0x75, 0xE3, 0xAE, 0xAB, 0xF1, 0xBA, 0xE6, 0xDF, 0xB9, 0x11, 0x61, 0xE4, 0x67, 0xF0,
+    0x59, 0xB1, 0xFF, 0xB0, 0xD7, 0x3B, 0x41, 0x45, 0xC4, 0xE2, 0x2E, 0x4C, 0x15, 0x9A, 0x77, 0xB9,
+    0xD5, 0xBC, 0xA4, 0x96, 0xD4, 0x67, 0x85, 0x55, 0x11, 0x71, 0x82, 0x8A, 0x88, 0xD1, 0x94, 0x2B,
+    0x0C, 0xEE, 0xE8, 0x94, 0x5C, 0xD2, 0xCC, 0xCB, 0x94, 0xE5, 0xA9, 0x8E, 0x4D, 0x2A, 0x6B, 0x42,
+    0x61, 0x3D, 0xA3, 0xA8, 0xEA, 0x4B, 0xC2, 0x6F, 0x06, 0xAF, 0xB1, 0xDA, 0x23, 0xFB, 0xA6, 0x3F,
+    0xC7, 0x92, 0x04, 0xD9, 0xFE, 0x50, 0xA6, 0x5F, 0x7D, 0x02, 0x25, 0xDB, 0x72, 0x2C, 0x2B, 0x10,
+    0x95, 0xB0, 0x1E, 0x8E, 0xCB, 0xBE, 0xBC, 0xA6, 0x59, 0xDF, 0x0B, 0x7A, 0x88, 0xAE, 0x1E, 0x16,
+    0x82, 0xBC, 0x3A, 0xAC, 0x4F, 0xBF, 0x2F, 0x64, 0x9D, 0x93, 0x95, 0xCA, 0xDD, 0x34, 0xB1, 0xED,
+    0x48, 0x9C, 0x1D, 0xFE, 0x75, 0xB8, 0xD3, 0x1B, 0x1A, 0xA9, 0xA6, 0x78, 0x97, 0xC5, 0xCF, 0xFC,
+    0x32, 0xE7, 0x52, 0x51, 0x70, 0x0F, 0x1D, 0x11, 0x1A, 0xF0, 0x50, 0x45, 0x8A, 0x97, 0xD7, 0xAD,
+    0x47, 0xC8, 0x69, 0x68, 0x90, 0x71, 0x9D, 0x69, 0xCB, 0xBB, 0x81, 0x23, 0xA8, 0xF4, 0x06, 0x85,
+    0x20, 0x3E, 0x69, 0xEB, 0x4D, 0x0D, 0x1F, 0xA4, 0x80, 0x9E, 0x20, 0xFB, 0xA8, 0x95, 0x35, 0x5B,
+    0x27, 0xDB, 0xA0, 0xED, 0x25, 0x47, 0x39, 0xFB, 0xF2, 0xEB, 0x06, 0x98, 0x45, 0x95, 0x2F, 0xA1,
+    0xD0, 0x65, 0xD4, 0x80, 0x6C, 0x5C, 0x4A, 0x5F, 0x82, 0xA8, 0xF7, 0xC3, 0xD0, 0xE4, 0x74, 0x81,
+    0xCB, 0xA0, 0x89, 0x98, 0x2B, 0x65, 0x24, 0x23, 0x95, 0x2E, 0xEE, 0x48, 0xC0, 0x18, 0xF5, 0xF5,
+    0x07, 0xC8, 0x4D, 0xEF, 0xA1, 0x5E, 0x77, 0x10, 0x37, 0xBF, 0xDE, 0xB1, 0x30, 0x0A, 0x35, 0x0F,
+    0x05, 0x8E, 0xAA, 0x18, 0xE1, 0x48, 0xBE, 0xC3, 0x16, 0xD5, 0x99, 0x27, 0x52, 0xBB, 0xD2, 0x51,
+    0x32, 0x93, 0xC4, 0x8F, 0x19, 0x79, 0x35, 0xE6, 0x9A, 0x60, 0x41, 0x81, 0x61, 0xB3, 0x42, 0x74,
+    0xF6, 0x58, 0x64, 0x85, 0xF3, 0x8A, 0x4D, 0x19, 0x4B, 0xC2, 0x92, 0xB0, 0xA5, 0xA0, 0xA5, 0xD8,
+    0x20, 0x61, 0x82, 0x1D, 0x6A, 0xFB, 0x68, 0xED, 0xE7, 0x10, 0x5F, 0x6F, 0x6C, 0x5C, 0x03, 0x2B,
+    0x85, 0x6A, 0x4A, 0x5D, 0x3B, 0x80, 0x9C, 0x37, 0xC2, 0xB9, 0x83, 0xF5, 0x31, 0x18, 0xDC, 0x43,
+    0x07, 0xFB, 0x23, 0x8C, 0x71, 0x75, 0x71, 0xF1, 0x28, 0xA1, 0x14, 0xB9, 0x9A, 0x6F, 0x31, 0x67,
+    0x9B, 0xA1, 0x0C, 0x3E, 0x08, 0x03, 0x51, 0x41, 0xD4, 0x10, 0xCD, 0x89, 0xA2, 0x1E, 0x95, 0xED,
+    0xB5, 0x25, 0x44, 0x22, 0xA2, 0xA6, 0xCD, 0x50, 0x5E, 0xFC, 0x6F, 0x44, 0x1F, 0x35, 0x0C, 0x66,
+    0xA1, 0xCB, 0x77, 0x99, 0xFF, 0x9E, 0x4B, 0xD2, 0xB2, 0x5F, 0x98, 0x3B, 0xFF, 0xAD, 0x70, 0x88,
+    0x64, 0x68, 0x97, 0x13, 0x39, 0xCA, 0x7E, 0x03, 0xF4, 0xFE, 0x18, 0xF4, 0x2B, 0xA0, 0xD7, 0x80,
+    0xBE, 0x07, 0x34, 0x15, 0x68, 0x5B, 0xC3, 0xD6, 0x14, 0xA7, 0x2B, 0x8B, 0xC5, 0x23, 0x17, 0xEC,
+    0xA5, 0xD4, 0x03, 0x57, 0x93, 0x6F, 0xC4, 0x97, 0x6D, 0xD9, 0xFE, 0x05, 0x8D, 0x67, 0x99, 0x18,
+    0xFA, 0x49, 0x4E, 0x3B, 0x40, 0x1D, 0xA0, 0x03, 0x40, 0xEF, 0x70, 0x61, 0x84, 0xDE, 0x02, 0xBA,
+    0x25, 0x50, 0x03, 0x68, 0x0F, 0x39, 0x83, 0xAD, 0xF2, 0xFC, 0x62, 0x71, 0x5F, 0x98, 0x3F, 0x74,
+    0x49, 0xB0, 0xA3, 0x3E, 0x1D, 0xA7, 0x66, 0x89, 0x99, 0x9E, 0xCC, 0x15, 0xCF, 0xF3, 0x06, 0x9E,
+    0x99, 0xD5, 0xAD, 0xFD, 0x8D, 0x7E, 0x78, 0x07, 0x1F, 0xA4, 0xD2, 0xA6, 0x97, 0x97, 0x92, 0x4A,
+    0xB9, 0x64, 0xA7, 0x34, 0x4B, 0xA1, 0xD1, 0x26, 0x0D, 0xFF, 0x7E, 0x4E, 0x13, 0x87, 0x6D, 0x6C,
+    0x74, 0x71, 0xF6, 0x9F, 0xAD, 0xBB, 0x9A, 0xB0, 0xDF, 0x04, 0x95, 0x2A, 0xA7, 0xD2, 0x58, 0x8F,
+    0xBD, 0x2A, 0x28, 0xE9, 0xFF, 0xFB, 0x3E, 0x02, 0xC5, 0x55, 0x31, 0x6F, 0xD3, 0x40, 0x14, 0x7E,
+    0xF1, 0x25, 0x8A, 0xA8, 0x05, 0xD7, 0x81, 0x4A, 0xD0, 0xA1, 0x5E, 0x58, 0x18, 0xE8, 0xFD, 0x81,
+    0xD2, 0xBB, 0x4E, 0x8C, 0xB0, 0x74, 0x62, 0xE9, 0xC0, 0x80, 0xCA, 0x00, 0x0B, 0x12, 0x43, 0x1B,
+    0x5B, 0xEA, 0x1F, 0xE8, 0xD2, 0x9D, 0x81, 0xA1, 0xAA, 0x84, 0xB2, 0x66, 0x48, 0x6B, 0x43, 0x06,
+    0x06, 0x16, 0xAB, 0x19, 0x32, 0x62, 0xA1, 0x4E, 0xB0, 0x78, 0x08, 0xC2, 0xAD, 0xCE, 0x3E, 0xDE,
+    0x3B, 0x3B, 0x51, 0x12, 0x44, 0x15, 0xC2, 0xC0, 0x93, 0xF2, 0xDE, 0xF9, 0xEE, 0x7B, 0xEF, 0xBE,
+    0xF7, 0xDE, 0xDD, 0x05, 0x60, 0xF7, 0x1D, 0x00, 0x84, 0x26, 0x03, 0xF0, 0x8F, 0x9E, 0xA6, 0xE0,
+    0x05, 0xE0, 0xC6, 0xCD, 0x18, 0xC0, 0x83, 0x14, 0x17, 0xF6, 0x1E, 0xA0, 0x72, 0xBE, 0x46, 0xA8,
+    0x6F, 0xC1, 0x7F, 0x95, 0x5A, 0x80, 0xEA, 0xC6, 0x06, 0x8D, 0x12, 0x62, 0xB6, 0xE1, 0x22, 0x29,
+    0xAE, 0x84, 0x82, 0x66, 0x02, 0xA1, 0x6A, 0x66, 0x50, 0x33, 0x26, 0xC7, 0xD5, 0xF0, 0x92, 0x30,
+    0xC7, 0xA8, 0x9A, 0x84, 0xF3, 0x88, 0xBB, 0x4F, 0x11, 0x30, 0x45, 0x60, 0x09, 0xB0, 0x0B, 0xAE,
+    0x5A, 0xDC, 0xB4, 0x42, 0xED, 0x1B, 0x63, 0xD2, 0x95, 0xF6, 0xD5, 0x36, 0x02, 0x10, 0xCA, 0x7E,
+    0x26, 0x00, 0xE2, 0x71, 0x0C, 0x35, 0x8D, 0x4E, 0x3C, 0x91, 0x11, 0x18, 0x8C, 0x0C, 0x6F, 0x6C,
+    0x25, 0xC6, 0xB2, 0x4B, 0xE1, 0xF5, 0x54, 0xF8, 0xCD, 0x2A, 0xFC, 0x25, 0x8B, 0xBD, 0x03, 0xF3,
+    0xA5, 0x6D, 0x3C, 0x8C, 0xAC, 0x1B, 0x2F, 0x8A, 0x23, 0x05, 0x1E, 0x41, 0x73, 0x5C, 0x74, 0xFB,
+    0x43, 0xDC, 0x07, 0x9D, 0x58, 0xC6, 0x53, 0x90, 0x91, 0x88, 0x61, 0x0D, 0x36, 0xC6, 0x61, 0x59,
+    0x0A, 0xFB, 0x61, 0xE0, 0x7E, 0xCE, 0x40, 0xFB, 0xCA, 0xDB, 0x52, 0xF8, 0x0D, 0x2D, 0xF4, 0xC2,
+    0xF8, 0x18, 0xC1, 0x53, 0x04, 0xA0, 0x8D, 0xDC, 0x78, 0xDE, 0x89, 0x80, 0xF7, 0x52, 0xA7, 0xD8,
+    0x04, 0xF1, 0x3D, 0xAE, 0x51, 0x61, 0x30, 0xB9, 0xE2, 0x90, 0x78, 0xAB, 0xD0, 0x18, 0xC4, 0xB0,
+    0x38, 0x3C, 0x31, 0xE6, 0x02, 0xDD, 0x70, 0x9F, 0x97, 0xE6, 0xAA, 0x9D, 0xAE, 0x03, 0x0D, 0xCC,
+    0x90, 0x13, 0xA1, 0x55, 0x73, 0x38, 0xE2, 0x26, 0x0C, 0x55, 0xA6, 0x40, 0xCD, 0x13, 0x10, 0x11,
+    0x16, 0x11, 0x24, 0x74, 0x70, 0xA1, 0xB3, 0x46, 0xCC, 0x7B, 0x54, 0x03, 0x5E, 0x27, 0xA4, 0x02,
+    0xE8, 0x92, 0x45, 0xE5, 0x40, 0xD7, 0x41, 0xFA, 0x5D, 0x1E, 0xB1, 0xB4, 0x2B, 0x15, 0xE8, 0x2E,
+    0x92, 0x90, 0x06, 0x8B, 0xC0, 0x71, 0xF7, 0x93, 0xB6, 0xF9, 0x76, 0x6C, 0xA8, 0x4C, 0x21, 0x29,
+    0x3B, 0x57, 0xAE, 0xE6, 0x88, 0x63, 0xC3, 0xAE, 0xC4, 0x3C, 0xC8, 0x57, 0x75, 0xD9, 0x44, 0xD0,
+    0x91, 0xD4, 0xAB, 0xD2, 0x73, 0x74, 0x60, 0xF9, 0xA8, 0xC3, 0x7F, 0x96, 0x06, 0xFE, 0xDC, 0xB4,
+    0xC2, 0x1A, 0x72, 0x0E, 0xE6, 0x38, 0x73, 0xD4, 0x57, 0x19, 0x97, 0xBB, 0x38, 0xD4, 0xC7, 0xBB,
+    0x58, 0x86, 0xAD, 0x8C, 0x47, 0xA7, 0xE0, 0xB3, 0xA1, 0x08, 0x34, 0xE4, 0xCD, 0x44, 0x3A, 0xC3,
+    0x1A, 0x4D, 0xB1, 0x84, 0xA5, 0x9E, 0xCA, 0xDC, 0xA8, 0x19, 0x4B, 0x27, 0xE5, 0x01, 0x8F, 0xF6,
+    0x58, 0x22, 0xF0, 0x1E, 0xE1, 0xD4, 0x43, 0xD8, 0xAC, 0xA5, 0x5C, 0x75, 0x60, 0x8F, 0xC5, 0xEB,
+    0xE5, 0x71, 0xAA, 0x97, 0x5B, 0x84, 0xA5, 0x31, 0x6A, 0xD2, 0xF8, 0x8B, 0x5C, 0x90, 0x86, 0xD5,
+    0xF7, 0x24, 0x35, 0x03, 0x0A, 0x6B, 0x6A, 0xA6, 0x34, 0x85, 0xA7, 0x66, 0xEA, 0x37, 0xBF, 0xB4,
+    0x2A, 0x82, 0x53, 0x3C, 0x2B, 0xD6, 0x77, 0xC0, 0x1E, 0x2B, 0x94, 0x65, 0xD7, 0x26, 0x25, 0x0F,
+    0xA8, 0xBE, 0xC0, 0x53, 0x0B, 0x67, 0xBA, 0xAC, 0xF2, 0xD9, 0x62, 0x37, 0x7E, 0xBD, 0x3A, 0x7C,
+    0xB1, 0x35, 0xD4, 0x03, 0xA8, 0xDA, 0x80, 0x72, 0x7F, 0xB1, 0x98, 0x65, 0x21, 0x3A, 0xDC, 0xB2,
+    0xF5, 0x4B, 0xB6, 0x22, 0xB1, 0x6C, 0x9B, 0xD9, 0x92, 0x85, 0x3C, 0xC3, 0x9C, 0x32, 0xD9, 0xCB,
+    0x45, 0xF4, 0xE4, 0x9A, 0x40, 0xA2, 0xA7, 0xE5, 0xB9, 0x6E, 0x8C, 0x5F, 0xA7, 0xCC, 0xA6, 0x1F,
+    0xD9, 0xAC, 0xC7, 0x43, 0xD8, 0x99, 0xFB, 0x75, 0x23, 0x7F, 0x4D, 0x4E, 0xA2, 0x8F, 0xA4, 0x58,
+    0x21, 0x68, 0x18, 0xEF, 0x94, 0x7C, 0xE6, 0x13, 0x47, 0xCF, 0x70, 0x10, 0x96, 0x43, 0x99, 0xC5,
+    0xF3, 0x12, 0x73, 0x3A, 0x61, 0x96, 0xD1, 0xD4, 0x01, 0x9F, 0x06, 0x3C, 0xCD, 0xE0, 0x14, 0x68,
+    0x8C, 0xAA, 0x0C, 0x94, 0x93, 0x15, 0x64, 0xC6, 0x6F, 0xCA, 0xD0, 0x1B, 0x8A, 0xEF, 0x6E, 0x38,
+    0x65, 0xAE, 0x73, 0x18, 0x19, 0x8D, 0xE6, 0xAC, 0xDA, 0x76, 0x64, 0x2C, 0x17, 0x43, 0x29, 0x9F,
+    0xC2, 0xED, 0xDF, 0xFD, 0xF6, 0x6D, 0x96, 0x99, 0xFC, 0x94, 0xCB, 0x0F, 0xC3, 0x71, 0xDA, 0xD8,
+    0x2A, 0xBF, 0xAF, 0x57, 0xD5, 0xE8, 0x1A, 0x30, 0xED, 0xF7, 0x73, 0x89, 0xCD, 0x9B, 0x40, 0x2E,
+    0x8D, 0x27, 0xB1, 0x2A, 0x07, 0x38, 0xD6, 0xF6, 0x20, 0xBC, 0x25, 0x40, 0x1F, 0xBB, 0xE8, 0x9B,
+    0xF3, 0xF6, 0x31, 0xDE, 0x4B, 0x7C, 0xF8, 0x48, 0xAD, 0xFC, 0x78, 0x84, 0x49, 0x8C, 0x3F, 0xFF,
+    0x56, 0xF9, 0x66, 0x70, 0xF2, 0xFE, 0x15, 0x0C, 0xE0, 0xA6, 0x55, 0xAF, 0xB7, 0x07, 0xFF, 0x12,
+    0x4D, 0x9A, 0x8F, 0x26, 0xE3, 0xF8, 0x4F, 0x94, 0x60, 0x57, 0x45, 0xB0, 0x78, 0x20, 0xAB, 0x66,
+    0xE4, 0x17, 0xED, 0x54, 0x3D, 0x6C, 0x1C, 0x45, 0x18, 0x7D, 0xB3, 0x63, 0x7B, 0x11, 0x5B, 0x6C,
+    0x0A, 0xAE, 0x21, 0x12, 0xDB, 0x18, 0x29, 0x8A, 0xC4, 0x6D, 0x8F, 0x76, 0x6F, 0x07, 0x28, 0x5C,
+    0x50, 0xD8, 0x42, 0x71, 0x1F, 0x09, 0xAA, 0x6B, 0xAE, 0xA1, 0x48, 0x71, 0xF6, 0xAD, 0x44, 0x41,
+    0x99, 0xA3, 0xA1, 0xC5, 0x05, 0x05, 0x5E, 0x24, 0xAE, 0xA1, 0x30, 0xE2, 0xE2, 0x9D, 0xE0, 0x82,
+    0x32, 0x23, 0x22, 0xD1, 0x58, 0x82, 0x8D, 0x44, 0x90, 0x48, 0x0A, 0x86, 0x78, 0x4D, 0xD6, 0xCA,
+    0xDE, 0x7D, 0x7C, 0x73, 0x76, 0x14, 0x23, 0x05, 0x81, 0x4C, 0x87, 0x98, 0x1D, 0xED, 0xCE, 0x7E,
+    0x33, 0xDF, 0xCF, 0xBC, 0xF7, 0x66, 0x00, 0x84, 0x10, 0x35, 0x32, 0xED, 0xCF, 0x40, 0x36, 0xA6,
+    0x0F, 0xA8, 0x85, 0x65, 0xDB, 0x85, 0x5E, 0xD8, 0x40, 0x9C, 0x07, 0x5F, 0x78, 0xE6, 0x46, 0x22,
+    0xF5, 0xB1, 0x95, 0xED, 0x45, 0x03, 0x2D, 0x5E, 0xA3, 0xCA, 0x9B, 0x9C, 0xB3, 0x74, 0x8E, 0xD7,
+    0x68, 0xF6, 0x2F, 0x6A, 0x2B, 0x73, 0xC1, 0xFE, 0xF3, 0x81, 0xBE, 0x25, 0x9A, 0x0C, 0x59, 0x98,
+    0x07, 0x07, 0x95, 0x38, 0xAE, 0xB1, 0xB5, 0x85, 0x68, 0x5D, 0xF9, 0x77, 0x2B, 0x51, 0x37, 0x98,
+    0xF2, 0x8C, 0x5F, 0xC5, 0x39, 0x95, 0x3A, 0x24, 0x8D, 0xBE, 0xC2, 0x52, 0x9A, 0x02, 0xC9, 0xB9,
+    0x06, 0x87, 0x17, 0xE6, 0x00, 0xE5, 0x28, 0x2B, 0xA4, 0x0D, 0xD2, 0x6D, 0xC4, 0x51, 0x1E, 0xF9,
+    0x55, 0xF8, 0x46, 0x13, 0xE4, 0xDB, 0xFE, 0xFD, 0xC1, 0xC7, 0x44, 0x54, 0x12, 0x2F, 0xD8, 0x06,
+    0xA2, 0x1C, 0x7E, 0xE5, 0xA0, 0xB9, 0x5A, 0xEC, 0x10, 0x1D, 0xDC, 0xDF, 0xE4, 0x72, 0x12, 0x08,
+    0x0B, 0xFF, 0xC1, 0x38, 0xA2, 0xFA, 0xF5, 0x81, 0x75, 0xF3, 0xA1, 0x46, 0x0C, 0xCC, 0xE0, 0xFF,
+    0xFA, 0x73, 0x99, 0x91, 0x7D, 0x79, 0x17, 0xB8, 0xDC, 0x62, 0x44, 0x18, 0x8D, 0x55, 0xC6, 0x41,
+    0x98, 0xA7, 0x1C, 0xF2, 0xBB, 0x39, 0x9E, 0x90, 0xCD, 0xCC, 0x28, 0xD4, 0xFE, 0x5D, 0x83, 0xBA,
+    0x46, 0xDA, 0x43, 0xB4, 0x66, 0x42, 0x3D, 0x1F, 0x98, 0x80, 0x2A, 0x57, 0x70, 0x51, 0x7C, 0x46,
+    0xD4, 0x16, 0x45, 0x0B, 0x34, 0xF0, 0x2C, 0x64, 0x05, 0x5F, 0x3B, 0xEF, 0x48, 0x81, 0x23, 0x6D,
+    0x01, 0x3C, 0x53, 0x9F, 0xCD, 0x04, 0x1A, 0xCB, 0x8A, 0xB1, 0x19, 0x0B, 0x9A, 0x63, 0x16, 0x98,
+    0x29, 0x9A, 0x18, 0x3D, 0xBF, 0x8A, 0xD4, 0x3C, 0xCE, 0x43, 0xCA, 0x25, 0x59, 0x59, 0x97, 0x6F,
+    0x5A, 0x69, 0x19, 0x1B, 0x4E, 0x15, 0xEA, 0xF0, 0x36, 0xA7, 0x8A, 0x4F, 0x53, 0xB9, 0x36, 0xAA,
+    0x50, 0x92, 0xDA, 0xF7, 0x6D, 0x0F, 0xBD, 0x48, 0xF9, 0xDF, 0x6A, 0xF1, 0x1B, 0x63, 0xCA, 0x30,
+    0xBE, 0x7D, 0x52, 0x9A, 0x72, 0x66, 0xBD, 0x4F, 0x87, 0x70, 0x5B, 0x0B, 0x15, 0xEF, 0xF1, 0xD5,
+    0x89, 0x83, 0xD5, 0x2B, 0xE0, 0xF0, 0xF0, 0x0C, 0x02, 0x85, 0xD7, 0xD0, 0xF9, 0xEA, 0x1D, 0xA2,
+    0xEF, 0x27, 0x0F, 0x78, 0x88, 0x2F, 0xCF, 0xAC, 0x9D, 0x4D, 0x67, 0x2B, 0x8A, 0x67, 0x03, 0xD7,
+    0x3C, 0xA2, 0x43, 0x22, 0xCE, 0x1B, 0xE8, 0xA1, 0xAC, 0x22, 0x34, 0xD2, 0x44, 0x98, 0x7A, 0x55,
+    0x90, 0x77, 0xB1, 0xE7, 0x59, 0x5F, 0x87, 0xAA, 0x87, 0x21, 0x6A, 0x61, 0x79, 0x77, 0xCC, 0x13,
+    0x7F, 0xA4, 0x09, 0x16, 0xD6, 0xA9, 0x70, 0xD3, 0x48, 0xDC, 0x27, 0x3E, 0x75, 0xAC, 0x39, 0xCA,
+    0x22, 0x2C, 0xEE, 0x91, 0x79, 0xF2, 0xB0, 0x9E, 0x61, 0xDA, 0x20, 0xA9, 0x91, 0xD8, 0xE7, 0x75,
+    0xB7, 0xEE, 0x82, 0x12, 0xC2, 0x55, 0x41, 0x01, 0x65, 0x93, 0x34, 0xBE, 0x14, 0xE3, 0x79, 0x4F,
+    0x47, 0x90, 0x93, 0x42, 0xFC, 0x51, 0xFB, 0x82, 0xE3, 0xA7, 0xB7, 0x60, 0x69, 0x0A, 0xD1, 0x40,
+    0x5A, 0xA7, 0x8C, 0xCC, 0x71, 0xE6, 0x86, 0x39, 0x32, 0x9A, 0x71, 0xEF, 0x6C, 0x5E, 0xF3, 0x68,
+    0x1C, 0xD0, 0x4C, 0xD6, 0x91, 0xBE, 0xE4, 0xF4, 0xC8, 0x3E, 0xCC, 0x6F, 0xA4, 0x17, 0x9C, 0xB1,
+    0xDC, 0x46, 0xCA, 0x39, 0x70, 0x10, 0x64, 0x4B, 0x88, 0x3E, 0xFC, 0x65, 0x70, 0x9B, 0xC8, 0xAC,
+    0x14, 0xEA, 0x7F, 0xF5, 0xFE, 0xB7, 0xD4, 0x2B, 0x0A, 0x95, 0x51, 0x3E, 0x66, 0x74, 0xBA, 0xC0,
+    0x8D, 0xE5, 0xCF, 0xEF, 0x11, 0x7D, 0xA2, 0x5E, 0x69, 0xF0, 0xB5, 0x91, 0x0F, 0x75, 0x7C, 0x93,
+    0x7E, 0x08, 0x7E, 0x5A, 0x45, 0x1F, 0x3E, 0x31, 0x28, 0x4D, 0x82, 0x64, 0x88, 0x74, 0xBF, 0xB8,
+    0x55, 0xD2, 0x6C, 0x0F, 0x9C, 0x0B, 0x7C, 0xB7, 0xC5, 0x6A, 0x29, 0xE0, 0x4B, 0x7F, 0xB2, 0xC3,
+    0x98, 0x78, 0x34, 0x13, 0x1C, 0xB8, 0xC6, 0x74, 0x88, 0xB0, 0x0B, 0x79, 0x98, 0xE3, 0x77, 0x16,
+    0x09, 0xFF, 0x84, 0xF0, 0xBF, 0xB1, 0x3E, 0x43, 0x67, 0xB0, 0x9F, 0xE3, 0x25, 0x2C, 0xBB, 0xC2,
+    0x58, 0x2F, 0xE1, 0x9A, 0x16, 0x8F, 0x99, 0x7D, 0xE3, 0xE4, 0xE6, 0xCD, 0x21, 0x8E, 0x0C, 0xEC,
+    0xD0, 0x55, 0xB7, 0x87, 0xE6, 0x0A, 0x5E, 0xC4, 0xCA, 0x2E, 0x6B, 0x56, 0xAF, 0x7A, 0xA7, 0x62,
+    0xE4, 0x63, 0x94, 0x72, 0x72, 0x72, 0xF9, 0xB9, 0x96, 0x61, 0x4F, 0xD4, 0x21, 0x19, 0xB1, 0x8F,
+    0xEB, 0x8B, 0x3B, 0xFA, 0x59, 0xEF, 0xAB, 0xC7, 0x64, 0xE7, 0xA2, 0x69, 0x31, 0xAC, 0xFF, 0xE2,
+    0x50, 0xEE, 0xE0, 0xCA, 0x75, 0x48, 0x8D, 0x85, 0x22, 0xD9, 0x49, 0x6A, 0xB1, 0x8E, 0x34, 0x91,
+    0xC6, 0xA6, 0xF2, 0xC0, 0x84, 0x5B, 0xC8, 0x5A, 0xB4, 0x8D, 0xD4, 0x75, 0x28, 0x6A, 0x46, 0xCE,
+    0x7A, 0x8F, 0x72, 0x6F, 0xFC, 0xEE, 0x9D, 0xE4, 0xE8, 0x69, 0x7F, 0x94, 0x6F, 0xF4, 0xD1, 0x7F,
+    0xEB, 0x47, 0xBA, 0x49, 0x77, 0xAA, 0xD8, 0x46, 0x23, 0x56, 0x58, 0xB7, 0xC6, 0x1E, 0x46, 0xDA,
+    0xAB, 0x04, 0x31, 0x93, 0x7E, 0xCB, 0xB4, 0x46, 0x96, 0x89, 0x65, 0x93, 0x39, 0x67, 0xDA, 0xC1,
+    0x7B, 0x58, 0xDD, 0xE8, 0xAB, 0xA3, 0x7F, 0x50, 0xE4, 0x62, 0x59, 0xF5, 0x74, 0x59, 0x6A, 0xD1,
+    0x3D, 0xED, 0x3C, 0x6E, 0x91, 0xCC, 0xD1, 0xF0, 0xA1, 0xB0, 0xFB, 0xCA, 0xFE, 0x19, 0x81, 0x95,
+    0x5D, 0x49, 0xED, 0x9E, 0x58, 0x57, 0x0C, 0x9B, 0x3C, 0x81, 0x3F, 0x87, 0xC7, 0x77, 0x80, 0x41,
+    0x77, 0x43, 0x1E, 0x52, 0x73, 0xF9, 0xC4, 0x29, 0xCA, 0xE0, 0x7D, 0x6C, 0x5F, 0x2B, 0x89, 0xCD,
+    0x1C, 0x8C, 0x45, 0x7A, 0x36, 0x08, 0x14, 0xC3, 0x9D, 0xD5, 0x5E, 0x83, 0xBF, 0x6B, 0x7F, 0x00,
+    0xAD, 0x55, 0xBF, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBB, 0x95, 0x73, 0xC5, 0x15, 0xDB, 0x90, 0x8A,
+    0xE2, 0x7A, 0x9A, 0xFB, 0x07, 0xB0, 0xF7, 0x12, 0x90, 0x28, 0xFD, 0x24, 0xFC, 0x44, 0x41, 0xE1,
+    0x16, 0x29, 0x85, 0xFF, 0x01, 0x27, 0xEF, 0x41, 0x0A, 0x8A, 0x14, 0x71, 0x13, 0x89, 0x8E, 0xC6,
+    0x85, 0x79, 0x8D, 0xDB, 0x14, 0xCF, 0xDE, 0x8D, 0x52, 0x52, 0xF8, 0x90, 0x0B, 0x8A, 0x14, 0x1C,
+    0x42, 0x11, 0x12, 0x8D, 0x57, 0xF1, 0x25, 0x3E, 0x3B, 0x7B, 0x37, 0x7C, 0xB3, 0xF7, 0x02, 0x38,
+    0x04, 0xD1, 0xE4, 0x8A, 0xEF, 0x76, 0xF6, 0xD7, 0xCC, 0x7C, 0xF3, 0x63, 0x89, 0xE4, 0xDB, 0x19,
+    0x2A, 0x4A, 0x99, 0x1D, 0xE5, 0xFD, 0x97, 0x73, 0x2A, 0x1A, 0x4C, 0x99, 0xB9, 0x80, 0x2C, 0xCE,
+    0x04, 0x8E, 0x47, 0xF8, 0x68, 0x71, 0x70, 0x4C, 0x86, 0x43, 0x04, 0x4B, 0xA6, 0xC2, 0x2A, 0xC0,
+    0x54, 0x80, 0xD2, 0x01, 0x74, 0x0B, 0xC8, 0x98, 0xB9, 0x23, 0x2B, 0xB0, 0x66, 0x17, 0xFB, 0x24,
+    0x5B, 0xFE, 0x03, 0x16, 0x07, 0x24, 0x57, 0xAD, 0x60, 0xAD, 0x9A, 0x10, 0xE9, 0xDB, 0x1E, 0xA0,
+    0x60, 0x44, 0xF1, 0x45, 0x4D, 0x09, 0x73, 0x4B, 0x05, 0xF3, 0x40, 0x76, 0xD8, 0x0E, 0x09, 0x2F,
+    0xF5, 0x77, 0x2A, 0xEC, 0xEA, 0x2A, 0xF7, 0x4B, 0x4D, 0xBA, 0xEE, 0x0A, 0xE8, 0x6D, 0x4B, 0x98,
+    0xEB, 0x37, 0xC8, 0xDC, 0xF2, 0xEB, 0x64, 0x6E, 0x37, 0x1F, 0x93, 0x51, 0xCD, 0x2E, 0xA0, 0x5E,
+    0x92, 0xF9, 0xCC, 0x75, 0x02, 0x2D, 0x95, 0x0F, 0xE6, 0x9E, 0x8A, 0x93, 0xAF, 0x3D, 0xE9, 0x33,
+    0xA8, 0xC8, 0x19, 0x2A, 0x14, 0x2B, 0x51, 0xF1, 0xB3, 0xFB, 0x8A, 0x66, 0x62, 0xAE, 0x11, 0xD8,
+    0x15, 0x3A, 0xA0, 0x82, 0xE8, 0xB1, 0x86, 0x8D, 0x6D, 0x41, 0xFF, 0xFC, 0x72, 0xBE, 0x14, 0xAE,
+    0x98, 0xCC, 0x70, 0xD8, 0xA9, 0x81, 0x52, 0x57, 0x0A, 0x5F, 0x83, 0x2C, 0xF9, 0x95, 0x5F, 0x49,
+    0x78, 0x23, 0x95, 0xF3, 0xB5, 0x74, 0x7F, 0xA0, 0xA5, 0xFD, 0xAD, 0x4D, 0x5F, 0xF3, 0xC3, 0x3A,
+    0x1F, 0x3E, 0x35, 0x15, 0x0E, 0xF4, 0x64, 0x29, 0xED, 0xD2, 0x0E, 0xBB, 0xF2, 0x9A, 0x0A, 0x57,
+    0x0A, 0x89, 0x47, 0x44, 0x9C, 0xB6, 0x94, 0xF4, 0x98, 0x52, 0x01, 0x53, 0x59, 0x7F, 0x44, 0x55,
+    0xCE, 0x57, 0x56, 0x28, 0x0D, 0xA2, 0x16, 0xAA, 0x6E, 0x42, 0x01, 0xF4, 0xB7, 0x0A, 0x50, 0x6B,
+    0x40, 0x15, 0xA9, 0x14, 0x95, 0x4A, 0x54, 0x6A, 0xF7, 0x26, 0x72, 0xEF, 0x98, 0xEA, 0xA7, 0xD3,
+    0x89, 0x1C, 0x9C, 0x6B, 0xA1, 0xD4, 0x2C, 0x10, 0x9D, 0x6B, 0xBB, 0xD6, 0x66, 0xD3, 0x89, 0x50,
+    0xE1, 0x12, 0x71, 0x11, 0x04, 0xBF, 0xFB, 0xAE, 0xF1, 0x4B, 0x2C, 0x88, 0xCA, 0x99, 0x3D, 0x95,
+    0x83, 0x6D, 0x10, 0x83, 0x64, 0x0F, 0x6E, 0xAD, 0xC8, 0x80, 0x8B, 0xFF, 0x82, 0xE9, 0x30, 0xDD,
+    0x92, 0xBC, 0x08, 0x23, 0xBC, 0xB5, 0xFA, 0xF7, 0x42, 0xDC, 0x17, 0x55, 0x46, 0x48, 0xA3, 0xF2,
+    0x96, 0x56, 0xF6, 0x60, 0x0B, 0x07, 0xFE, 0x0B, 0x64, 0x57, 0xB6, 0x32, 0xAA, 0x1B, 0x7F, 0x45,
+    0x15, 0x7F, 0xD1, 0x5E, 0x9A, 0xD2, 0xDD, 0x29, 0xE9, 0x27, 0x3C, 0xC0, 0xE5, 0x2A, 0x58, 0xEE,
+    0xE0, 0xB9, 0x3E, 0x7B, 0x64, 0xF9, 0xF9, 0x8E, 0xE7, 0x9A, 0x60, 0xFD, 0xEC, 0x61, 0x4B, 0x19,
+    0xE8, 0x0D, 0x1C, 0xF3, 0xBE, 0x38, 0xF1, 0xA2, 0x2D, 0x09, 0x43, 0x8C, 0xA6, 0x3E, 0x69, 0x28,
+    0xC3, 0x4D, 0x01, 0x36, 0x0A, 0x25, 0x27, 0x88, 0xD7, 0x28, 0xAA, 0x95, 0x38, 0x1B, 0x45, 0x3D,
+    0x8A, 0xC9, 0xC5, 0x28, 0x96, 0x26, 0x8A, 0xEA, 0x74, 0x14, 0x97, 0xA3, 0xA8, 0x3F, 0x89, 0x62,
+    0xEA, 0x4D, 0xA4, 0x72, 0x63, 0x95, 0x54, 0x6F, 0xD9, 0x7F, 0x2D, 0xE3, 0xD2, 0x9E, 0x52, 0x50,
+    0x0C, 0x82, 0x91, 0x01, 0xE2, 0x54, 0xD9, 0xC6, 0xA1, 0x93, 0xE1, 0x52, 0x86, 0x17, 0x8D, 0x0C,
+    0x8D, 0x0C, 0x5F, 0xB4, 0xCA, 0xDF, 0xB0, 0x87, 0x7F, 0xD8, 0x03, 0xA1, 0x89, 0x7F, 0x8C, 0x14,
+    0x41, 0x9B, 0x6C, 0x50, 0x50, 0x9A, 0xFA, 0xE2, 0xBE, 0xCF, 0xE3, 0x6C, 0xDC, 0xF0, 0x64, 0xF6,
+    0xC8, 0xCE, 0xB6, 0x52, 0xAF, 0xCE, 0xB1, 0x81, 0xCA, 0x1D, 0x51, 0x35, 0xC8, 0x10, 0xDE, 0x60,
+    0x38, 0x93, 0xA1, 0x8A, 0xC3, 0x52, 0x86, 0x49, 0x1C, 0x6A, 0x8F, 0xEC, 0xDF, 0x13, 0x86, 0x25,
+    0xF8, 0x52, 0xBC, 0x20, 0x12, 0x96, 0x65, 0x1C, 0xD3, 0x25, 0xEB, 0x22, 0xF7, 0xA5, 0x13, 0x41,
+    0x6A, 0x01, 0x82, 0xAE, 0x3F, 0x90, 0x44, 0xEA, 0x95, 0x58, 0xAD, 0xDD, 0x6E, 0x5C, 0xC9, 0x45,
+    0x30, 0xDF, 0x0C, 0x5B, 0x86, 0xF4, 0x2B, 0xE6, 0xD3, 0x97, 0x77, 0x06, 0xC3, 0xBD, 0x91, 0xF4,
+    0x74, 0xB8, 0x7A, 0x0F, 0xD1, 0x37, 0x3F, 0x20, 0x02, 0x2E, 0x46, 0x32, 0xC4, 0x4C, 0xFC, 0x5F,
+    0xA1, 0x8F, 0x42, 0xFE, 0xF2, 0xF3, 0xD1, 0x32, 0x11, 0x12, 0xA9, 0x1B, 0xFC, 0x26, 0xF6, 0xAA,
+    0x1A, 0xAD, 0x16, 0x59, 0xAF, 0x8C, 0xAF, 0x76, 0x9A, 0x78, 0x4C, 0xEC, 0x45, 0xDC, 0xA5, 0x9A,
+    0x90, 0x67, 0x03, 0xAD, 0x4D, 0x4C, 0x95, 0x76, 0x8A, 0xBB, 0x9E, 0xF2, 0xC6, 0xF0, 0x05, 0x96,
+    0xEE, 0xF7, 0x1F, 0x22, 0xDE, 0x3D, 0x02, 0x67, 0xD0, 0x81, 0x66, 0x72, 0xCA, 0xDE, 0x0A, 0x72,
+    0x61, 0xA7, 0x3A, 0xB9, 0x70, 0xAE, 0xBB, 0xD8, 0xCA, 0x74, 0x0F, 0x57, 0x5B, 0xCC, 0xA8, 0x36,
+    0x97, 0x5E, 0xA3, 0x6B, 0x9C, 0x49, 0x19, 0x8D, 0x72, 0x8E, 0x78, 0xF6, 0xD2, 0x54, 0xD3, 0xD7,
+    0xAD, 0x14, 0x4A, 0x76, 0x56, 0x4B, 0x7E, 0x97, 0xB6, 0x52, 0xED, 0x84, 0xB0, 0x94, 0xBF, 0xB8,
+    0xDC, 0x3E, 0xC7, 0xD1, 0x67, 0xCC, 0x9B, 0x35, 0x99, 0x07, 0xDC, 0xC6, 0x2C, 0xD8, 0x42, 0xAE,
+    0xE0, 0xC6, 0x62, 0xD3, 0x25, 0x03, 0xE5, 0x4F, 0x3D, 0x59, 0xB8, 0x1B, 0x24, 0x2A, 0xE8, 0x14,
+    0x3A, 0xD0, 0x46, 0xD6, 0xA8, 0x5F, 0xAA, 0x62, 0xDE, 0x25, 0xE7, 0x4D, 0x56, 0x1B, 0xDA, 0xED,
+    0x52, 0xAF, 0x5D, 0x59, 0x12, 0xA2, 0xAF, 0xBF, 0x75, 0x86, 0x8E, 0xD4, 0xAF, 0xAD, 0x76, 0x45,
+    0xD5, 0xAE, 0xAB, 0x26, 0x86, 0x9E, 0x0F, 0x23, 0xBE, 0x42, 0xB6, 0x0C, 0x76, 0x3F, 0x7F, 0xDA,
+    0x14, 0xDA, 0xA5, 0xBE, 0x53, 0xA7, 0x0D, 0xDD, 0x5D, 0xA7, 0x16, 0xFE, 0x6C, 0xD3, 0xC6, 0x3A,
+    0xA9, 0xDF, 0x5D, 0xFE, 0x7D, 0x45, 0x57, 0x3E, 0xBD, 0x70, 0x54, 0x3E, 0xA6, 0x7B, 0x9E, 0xB2,
+    0x81, 0xA0, 0x31, 0xE1, 0x4A, 0x49, 0x89, 0x38, 0xE2, 0x4A, 0x52, 0xA2, 0xAC, 0xA5, 0x52, 0x51,
+    0x2A, 0x16, 0x2D, 0x92, 0x36, 0x58, 0x58, 0x36, 0xB1, 0x42, 0x0D, 0x8A, 0x6B, 0x10, 0x94, 0xE7,
+    0x42, 0x9A, 0x7D, 0x25, 0x58, 0xCC, 0x4D, 0x50, 0xB0, 0xF1, 0x7D, 0x22, 0xD1, 0xBD, 0x88, 0xC7,
+    0x82, 0x49, 0x10, 0xCC, 0xBA, 0xA0, 0xAE, 0x16, 0xD6, 0x07, 0xE9, 0x7B, 0x4E, 0xF0, 0x32, 0x56,
+    0x95, 0xE4, 0x6F, 0x6C, 0xD4, 0xE3, 0x0B, 0x87, 0xE8, 0xCB, 0xBB, 0x35, 0x4F, 0xA2, 0xDD, 0x37,
+    0xA7, 0x76, 0x22, 0x85, 0xE8, 0x90, 0x34, 0xF0, 0xA8, 0xE0, 0x9F, 0xE0, 0x05, 0x0F, 0x30, 0xFF,
+    0x72, 0xE7, 0x4C, 0x3A, 0xFE, 0xCC, 0xC3, 0xE3, 0x3C, 0x64, 0xAD, 0xF4, 0x6C, 0x71, 0xC9, 0x0D,
+    0xD2, 0xF2, 0x11, 0xDE, 0x24, 0x68, 0xE4, 0xD3, 0x0C, 0xF9, 0x80, 0xE3, 0x12, 0x60, 0x99, 0x4C,
+    0x83, 0x3C, 0x07, 0x36, 0x89, 0x3B, 0xA5, 0xC7, 0xF8, 0xBC, 0xA3, 0x22, 0x10, 0x3F, 0xB7, 0x56,
+    0xF2, 0x66, 0xD3, 0xA1, 0xEB, 0x4A, 0x6B, 0xD8, 0xBA, 0x56, 0xFA, 0x37, 0x16, 0x8B, 0xC5, 0x81,
+    0xBC, 0x36, 0x1C, 0xBB, 0x9E, 0xA3, 0xF7, 0xFD, 0xFD, 0x09, 0xC5, 0x55, 0xBF, 0x8F, 0xDC, 0x54,
+    0x10, 0x1E, 0xDB, 0x2C, 0x2E, 0x2C, 0x78, 0x34, 0xD0, 0x5C, 0xE1, 0x3F, 0x20, 0x85, 0x29, 0xD3,
+    0x44, 0x36, 0x15, 0x25, 0x14, 0xBB, 0x14, 0x50, 0xD0, 0x43, 0x71, 0x2D, 0x45, 0x84, 0x8D, 0xEE,
+    0x0F, 0x20, 0x12, 0x50, 0x27, 0x05, 0x05, 0xDA, 0x2B, 0xF6, 0x1F, 0x58, 0xCE, 0x16, 0x91, 0x68,
+    0x28, 0xE2, 0xE6, 0x48, 0x6B, 0xA4, 0x48, 0x44, 0x47, 0x11, 0x27, 0x18, 0xB0, 0x0E, 0xBF, 0xF7,
+    0xF8, 0xBE, 0xF1, 0x7A, 0x4F, 0xD0, 0x20, 0xD1, 0x60, 0xE9, 0xE6, 0x66, 0x3F, 0xCF, 0x9B, 0x37,
+    0xF3, 0xCD, 0x0F, 0x8B, 0xE8, 0x13, 0x78, 0x2B, 0x12, 0x7B, 0x3F, 0x4A, 0xE2, 0xBD, 0x93, 0xC4,
+    0x4A, 0x2A, 0xF1, 0x88, 0x17, 0xD1, 0xC4, 0xB7, 0x96, 0x36, 0x35, 0x45, 0x5E, 0x41, 0x98, 0x16,
+    0xC2, 0x7B, 0x9C, 0xC9, 0x21, 0x8B, 0x55, 0xBD, 0xD9, 0x14, 0x92, 0x36, 0x00, 0xE3, 0x1E, 0xE2,
+    0x96, 0xDB, 0x7E, 0x23, 0x06, 0x6F, 0x24, 0x82, 0x68, 0x24, 0x1A, 0x78, 0xF2, 0x82, 0x42, 0x8D,
+    0x22, 0x3A, 0x96, 0x52, 0x3D, 0x8D, 0x12, 0xC2, 0xD5, 0xF5, 0xAE, 0xE1, 0x01, 0x1C, 0x2E, 0xFD,
+    0x13, 0xC0, 0x1B, 0xFC, 0xE1, 0xE2, 0xAC, 0x32, 0x8D, 0x24, 0x3D, 0xD4, 0x60, 0x12, 0xA8, 0x65,
+    0x01, 0xD5, 0x74, 0x50, 0xE9, 0x62, 0x62, 0x44, 0xA6, 0xA1, 0xCB, 0x89, 0x57, 0x98, 0xC6, 0xF1,
+    0x18, 0x23, 0x34, 0x3F, 0xA8, 0x2B, 0xEF, 0x27, 0xE4, 0x84, 0x10, 0xDE, 0xF0, 0xFE, 0x72, 0x2D,
+    0xA6, 0x67, 0x1E, 0x16, 0x0E, 0x61, 0x4B, 0xB3, 0x49, 0x2C, 0x55, 0x06, 0x3D, 0x49, 0xDE, 0xF0,
+    0x0A, 0x47, 0x35, 0x1E, 0xA8, 0x66, 0x0D, 0x63, 0x70, 0x54, 0x01, 0x30, 0x9C, 0x86, 0xE9, 0xFA,
+    0xFB, 0x14, 0x7F, 0x50, 0xE8, 0x6B, 0x92, 0x52, 0x2C, 0xA4, 0x44, 0xC3, 0x4B, 0xBC, 0xC2, 0xC0,
+    0x79, 0xFE, 0x61, 0x07, 0xD0, 0x03, 0x8D, 0xC0, 0x01, 0x18, 0x06, 0x16, 0xFA, 0x82, 0x34, 0xB7,
+    0x6F, 0x4A, 0xF2, 0xE7, 0x50, 0xC2, 0xAD, 0xAB, 0x0B, 0xE9, 0x72, 0xCF, 0xE3, 0xF4, 0x94, 0x90,
+    0xED, 0x94, 0x51, 0x66, 0xB4, 0xCC, 0x1F, 0xE1, 0xB4, 0x39, 0x43, 0x6E, 0x41, 0x61, 0xFF, 0x79,
+    0x91, 0xDC, 0x3C, 0x2F, 0x7B, 0x7F, 0x4F, 0x95, 0x9C, 0xC5, 0xE3, 0x93, 0xB9, 0x1D, 0x2F, 0x15,
+    0x79, 0x05, 0x3C, 0xF4, 0x07, 0x33, 0xF5, 0x0E, 0xEB, 0x7B, 0xC1, 0x6C, 0x04, 0x47, 0xF5, 0xAC,
+    0x34, 0xB3, 0x67, 0x96, 0x47, 0x0B, 0x0C, 0xE6, 0x99, 0xFE, 0x7C, 0x63, 0x3A, 0x2B, 0x72, 0xA3,
+    0xCC, 0xAF, 0xCA, 0x45, 0xB9, 0xA0, 0x7D, 0xB0, 0x16, 0xB2, 0x99, 0x57, 0x29, 0x12, 0xC5, 0x45,
+    0x65, 0x51, 0xFB, 0x1E, 0x65, 0x93, 0x3A, 0x70, 0x6F, 0x8F, 0x54, 0x5C, 0x34, 0x84, 0x53, 0x88,
+    0x82, 0x4F, 0x31, 0x5E, 0x20, 0x81, 0x78, 0x44, 0x04, 0x53, 0xD4, 0x4B, 0xDA, 0x9B, 0x26, 0x00,
+    0x2A, 0x75, 0xC3, 0xD2, 0x26, 0xDD, 0x89, 0xC7, 0x65, 0x49, 0x6F, 0xD8, 0x90, 0xD9, 0x6F, 0xA7,
+    0x1D, 0x94, 0x8A, 0xC9, 0x55, 0x86, 0xED, 0x91, 0x97, 0x76, 0x4E, 0xA8, 0x5C, 0x15, 0xB3, 0xF2,
+    0xE9, 0xC2, 0xC4, 0xC5, 0xA2, 0xD8, 0x45, 0x99, 0x0E, 0xFF, 0x83, 0x45, 0x09, 0xC7, 0x83, 0x72,
+    0xA4, 0x30, 0xEA, 0x6F, 0xA8, 0xD4, 0x32, 0x25, 0xEC, 0xC4, 0xF4, 0x67, 0x18, 0x66, 0xC5, 0xC4,
+    0x8C, 0x55, 0xD8, 0xA3, 0x46, 0xC1, 0x17, 0xD9, 0x67, 0x30, 0x49, 0xBF, 0x63, 0xEF, 0x3D, 0x64,
+    0x53, 0x3D, 0x6E, 0x59, 0xDD, 0x86, 0x15, 0xD7, 0x62, 0x1F, 0x02, 0x79, 0x8D, 0xE2, 0x76, 0x84,
+    0x9F, 0x77, 0x63, 0x94, 0xD5, 0x99, 0x67, 0x55, 0xE8, 0x4F, 0xDF, 0x69, 0x30, 0x1D, 0x49, 0x9B,
+    0x3C, 0x46, 0xE2, 0xE6, 0xE1, 0x18, 0xF5, 0xD9, 0x5B, 0x7D, 0x38, 0x96, 0xF2, 0x60, 0x8E, 0xF4,
+    0x46, 0x7C, 0x7B, 0x14, 0xD3, 0x21, 0x8F, 0xE8, 0x7C, 0xE4, 0x1D, 0x1D, 0x45, 0x11, 0xF8, 0x6B,
+    0x5C, 0x96, 0x7A, 0x74, 0x5A, 0xC0, 0x69, 0x24, 0x73, 0x56, 0x07, 0xA6, 0x5F, 0x9D, 0x5E, 0x6E,
+    0xEA, 0x2F, 0x6B, 0xB6, 0xEA, 0xF7, 0xBB, 0xAB, 0x6D, 0xFD, 0x14, 0x28, 0xD2, 0x47, 0x1D, 0x51,
+    0x2F, 0xAA, 0x89, 0x76, 0xB1, 0x1A, 0x70, 0x8E, 0x3C, 0x8F, 0x61, 0x0E, 0xD2, 0xAB, 0x7A, 0xA0,
+    0x33, 0x4B, 0xBF, 0x96, 0xF3, 0x5F, 0x2C, 0xB3, 0x3B, 0x07, 0xF7, 0xAF, 0x2A, 0x9E, 0x77, 0x95,
+    0xDA, 0x76, 0x69, 0xCF, 0x40, 0xE7, 0x25, 0x83, 0xEC, 0x22, 0xFF, 0x45, 0x9B, 0x4A, 0xDE, 0x9B,
+    0x42, 0x42, 0x27, 0x77, 0x40, 0x5C, 0x2F, 0x03, 0xF7, 0x0B, 0xAC, 0x31, 0xD8, 0x80, 0xD3, 0x96,
+    0x30, 0x1A, 0x6C, 0x40, 0xB7, 0x10, 0xC6, 0xCC, 0x02, 0x46, 0xBB, 0xE5, 0xDE, 0xD5, 0xDC, 0x3D,
+    0xD7, 0x13, 0x97, 0xCB, 0x2F, 0x84, 0xF3, 0xFB, 0xB4, 0x76, 0x68, 0xDC, 0x21, 0x1A, 0xB1, 0x73,
+    0x5A, 0xF3, 0x93, 0x25, 0x7C, 0x66, 0x09, 0xC7, 0x96, 0x70, 0xE2, 0x00, 0x77, 0x89, 0x7F, 0x76,
+    0xEE, 0x2B, 0xAE, 0x04, 0x27, 0x41, 0xAD, 0x43, 0x13, 0x3F, 0xD1, 0x01, 0xD0, 0x3E, 0xBA, 0x73,
+    0x4C, 0x42, 0x58, 0x3F, 0x89, 0xB4, 0x80, 0x99, 0xB6, 0x92, 0x63, 0xD7, 0xC4, 0xBF, 0xB2, 0x53,
+    0xB2, 0xCF, 0x99, 0x94, 0xC5, 0x88, 0x60, 0xDD, 0x95, 0x3A, 0x2C, 0x56, 0x74, 0xCF, 0xF8, 0x53,
+    0x0A, 0xFB, 0x51, 0x7D, 0xB5, 0xBB, 0xFE, 0x1A, 0x45, 0xCF, 0x74, 0x7B, 0xE5, 0xC5, 0xAA, 0xFC,
+    0x6A, 0xE3, 0xD6, 0x4A, 0xF3, 0xEF, 0x6A, 0xD7, 0x22, 0x58, 0xA3, 0xD3, 0xC1, 0x36, 0x67, 0x37,
+    0x71, 0xFE, 0x6A, 0x02, 0xC1, 0x44, 0x20, 0x1A, 0x09, 0x24, 0xCF, 0x75, 0x1F, 0x3C, 0xEA, 0x96,
+    0xC5, 0xAB, 0x64, 0x3A, 0x6E, 0x87, 0x79, 0x53, 0xFB, 0x2A, 0x18, 0x30, 0x3D, 0xA4, 0xDD, 0x1D,
+    0xB7, 0x73, 0xD2, 0x1D, 0x77, 0xAC, 0xD5, 0x02, 0xBF, 0xD0, 0xA8, 0x36, 0x9B, 0x0F, 0xFC, 0xA5,
+    0xC8, 0x09, 0x17, 0x0B, 0x07, 0x28, 0x60, 0xFF, 0x7C, 0xEC, 0xAF, 0xB6, 0x5B, 0x16, 0xC5, 0xFF,
+    0xE8, 0xB7, 0xDB, 0xED, 0x83, 0x79, 0xC1, 0x34, 0xC7, 0xA1, 0x98, 0xB7, 0x4E, 0x73, 0x58, 0x1E,
+    0x9F, 0x60, 0x53, 0x9F, 0x3B, 0x5D, 0xED, 0x15, 0xD6, 0xAB, 0x83, 0xF1, 0xEB, 0xCA, 0x5C, 0xA0,
+    0xC5, 0xDE, 0xCF, 0xE1, 0x15, 0x0C, 0x6F, 0xFE, 0x34, 0x48, 0x3E, 0xEC, 0x4F, 0xAA, 0xBC, 0xCB,
+    0x10, 0x72, 0x97, 0x60, 0xC1, 0xF6, 0x61, 0x4F, 0x4A, 0xF6, 0x8C, 0x2F, 0xE3, 0x77, 0x05, 0x60,
+    0x29, 0x00, 0x41, 0xD5, 0x9E, 0x6F, 0x32, 0x16, 0x1C, 0x60, 0xFD, 0x77, 0x70, 0xB6, 0xCC, 0x2B,
+    0x80, 0x86, 0xC7, 0x43, 0x90, 0xCB, 0xC0, 0x00, 0xC6, 0x13, 0x40, 0xA9, 0xBB, 0x7D, 0x50, 0x20,
+    0xDB, 0x5D, 0xCB, 0xBD, 0x8F, 0xB6, 0x21, 0x43, 0x87, 0xB1, 0xC9, 0x74, 0xF9, 0x21, 0x89, 0xDB,
+    0xF2, 0x2A, 0x62, 0xED, 0xE5, 0x2E, 0x7F, 0xF2, 0x54, 0xAE, 0xB9, 0x4E, 0xEC, 0x34, 0x2D, 0xDD,
+    0x19, 0x85, 0x5B, 0xD5, 0xEF, 0xEF, 0x2E, 0xD7, 0x81, 0xC2, 0xF1, 0xA1, 0x4A, 0xFC, 0x46, 0x94,
+    0x6C, 0x8E, 0xFF, 0x06, 0x93, 0xC8, 0xB4, 0x89, 0xDC, 0x7B, 0xF8, 0x19, 0xFB, 0x09, 0x70, 0xEC,
+    0x95, 0xE0, 0xB5, 0xFC, 0xBF, 0xCF, 0x5F, 0xAD, 0x55, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xAF,
+    0x11, 0x96, 0x70, 0xB1, 0x0D, 0x34, 0x5C, 0xE1, 0x1A, 0xA4, 0xE0, 0x96, 0x22, 0xDC, 0x5A, 0xA2,
+    0x48, 0x49, 0x9A, 0x83, 0x32, 0x0D, 0x0D, 0x41, 0xD1, 0xFD, 0x03, 0x87, 0x6C, 0x81, 0x04, 0x65,
+    0x52, 0xF1, 0x17, 0x5C, 0x81, 0x1E, 0xC5, 0x35, 0x29, 0x28, 0xE0, 0x3D, 0x4B, 0x29, 0x28, 0xB1,
+    0x38, 0xA5, 0x4A, 0x81, 0xF9, 0x11, 0x45, 0x0A, 0x45, 0x36, 0x92, 0x23, 0xF9, 0x5E, 0x6C, 0x0F,
+    0xF3, 0xCD, 0xEE, 0xE3, 0xDE, 0x21, 0x21, 0x51, 0x60, 0xC9, 0xEB, 0xD9, 0xF9, 0xB5, 0xB3, 0xDF,
+    0x7C, 0xBB, 0x26, 0x8A, 0x4F, 0xC2, 0x4B, 0x85, 0x91, 0xB9, 0x21, 0xAA, 0x17, 0x1E, 0x89, 0xEC,
+    0x40, 0x07, 0x44, 0x66, 0x52, 0xBB, 0xAB, 0x30, 0xA6, 0xC3, 0xFE, 0x64, 0xD4, 0x49, 0xD9, 0xE9,
+    0x07, 0x71, 0x44, 0x79, 0xF8, 0x14, 0x7C, 0x4F, 0x4D, 0xDC, 0x85, 0x8F, 0x2A, 0x0F, 0x58, 0x1D,
+    0x6D, 0x0C, 0x6B, 0x3F, 0x7E, 0xAD, 0xF9, 0x84, 0x66, 0xF7, 0x84, 0xCB, 0x31, 0x3F, 0xBF, 0xDB,
+    0xF1, 0x8D, 0xF6, 0x87, 0x77, 0xC7, 0xAC, 0xBB, 0x66, 0xCF, 0x7F, 0xAA, 0xAE, 0x9B, 0x6E, 0x2A,
+    0x86, 0xB4, 0xBD, 0xE6, 0x9A, 0xFA, 0x8F, 0xEB, 0x86, 0x7B, 0x92, 0xCA, 0xA4, 0x28, 0x7B, 0x86,
+    0x91, 0x86, 0xEC, 0xE1, 0x1D, 0xC9, 0x04, 0x37, 0xA2, 0xFB, 0xE2, 0x26, 0x35, 0x8B, 0x7D, 0xC1,
+    0xC0, 0x3A, 0xD0, 0xD5, 0xE7, 0xD2, 0x10, 0xAD, 0xB5, 0x6A, 0xFF, 0xFF, 0xC1, 0x49, 0xF6, 0x0F,
+    0xE4, 0xFD, 0xF9, 0x8C, 0x57, 0xA7, 0xE4, 0xBA, 0x08, 0xA0, 0xAB, 0x92, 0xA3, 0x5B, 0x8F, 0x6F,
+    0x8A, 0x61, 0x86, 0x47, 0x45, 0x4E, 0x20, 0xB1, 0x62, 0xB5, 0x9E, 0xE8, 0x78, 0x20, 0xCB, 0x03,
+    0xA5, 0x40, 0x6B, 0x03, 0x84, 0x7A, 0xE9, 0x84, 0x46, 0x35, 0x11, 0xF2, 0x9D, 0xD6, 0xEC, 0xB4,
+    0x19, 0xB4, 0x1C, 0xB5, 0x4E, 0x61, 0x6D, 0xD1, 0x12, 0x0F, 0x71, 0xA2, 0xD7, 0x45, 0x99, 0xAC,
+    0x45, 0xF9, 0x48, 0xA0, 0x4F, 0xF9, 0x02, 0xE0, 0x77, 0x28, 0x0E, 0xBD, 0x79, 0xD6, 0x1E, 0x34,
+    0x26, 0x7D, 0xBE, 0x91, 0x48, 0xD6, 0x25, 0x67, 0xF4, 0x4D, 0x66, 0x19, 0x7B, 0x4A, 0x5F, 0xF4,
+    0xB2, 0xC6, 0x8C, 0x9C, 0x0E, 0x39, 0x8B, 0x56, 0x72, 0xE6, 0x5E, 0x72, 0x4A, 0x21, 0x0E, 0x65,
+    0x89, 0x72, 0xC1, 0x42, 0x92, 0x6B, 0x32, 0x32, 0xB8, 0x33, 0xD9, 0x8E, 0xE5, 0x45, 0x56, 0xE7,
+    0xF1, 0x1F, 0xB0, 0x6F, 0x9A, 0xC0, 0xAD, 0xC0, 0xA1, 0xA9, 0xD4, 0xE9, 0x89, 0xD1, 0x2A, 0x0B,
+    0xFA, 0x0C, 0x9F, 0xAC, 0x2D, 0x94, 0x4D, 0x53, 0xDA, 0x07, 0xAE, 0xC8, 0xB3, 0x95, 0x54, 0xA1,
+    0xDF, 0x07, 0xFA, 0x6D, 0x09, 0xC6, 0x57, 0x25, 0x3B, 0x16, 0x28, 0x89, 0x0E, 0xB1, 0xD7, 0x8E,
+    0x6C, 0x23, 0xA1, 0x02, 0x5C, 0xFF, 0x5D, 0x4E, 0xEF, 0x88, 0x91, 0xEF, 0x7A, 0x5B, 0x69, 0x0B,
+    0xD2, 0x96, 0xEC, 0x54, 0x9E, 0x63, 0x43, 0x53, 0xDA, 0x95, 0x3E, 0x20, 0x77, 0x93, 0x0C, 0x07,
+    0xEA, 0xBE, 0xD4, 0x12, 0xE8, 0xFE, 0x3A, 0xD4, 0x69, 0xFB, 0x78, 0x08, 0x9E, 0x9E, 0x05, 0xFA,
+    0x72, 0xAB, 0xE5, 0x73, 0xD0, 0xBF, 0x11, 0xAC, 0x91, 0xB8, 0xBA, 0x09, 0xF3, 0xDF, 0x26, 0x9F,
+    0x2E, 0xF7, 0xC2, 0xA9, 0x1A, 0x48, 0x19, 0xEC, 0xC9, 0x5D, 0x94, 0x5F, 0x72, 0x6B, 0x47, 0x33,
+    0x1A, 0x4E, 0x66, 0x71, 0xCB, 0x06, 0xD7, 0x4A, 0x8C, 0x7B, 0x30, 0xC8, 0x24, 0x99, 0x6A, 0x24,
+    0xB0, 0x8F, 0x3C, 0x12, 0xAC, 0xD7, 0x98, 0xE4, 0x2F, 0x7B, 0x4C, 0xEA, 0x05, 0x15, 0x64, 0xA1,
+    0x24, 0x99, 0x00, 0xBB, 0x7F, 0x9F, 0x78, 0x59, 0xF4, 0x54, 0x79, 0xDF, 0x63, 0x3B, 0x5C, 0x65,
+    0x9E, 0x6A, 0x2F, 0xED, 0x33, 0x0B, 0x68, 0x5A, 0xB6, 0x45, 0x2B, 0x4E, 0xA2, 0xA4, 0x19, 0x54,
+    0x73, 0x95, 0x28, 0x0B, 0x28, 0x73, 0x28, 0xB3, 0x51, 0x94, 0xF9, 0xF4, 0x26, 0x6F, 0x79, 0xCE,
+    0x25, 0x5A, 0x1A, 0x8D, 0x44, 0x52, 0xEF, 0x8E, 0xEA, 0xE2, 0x49, 0xC9, 0xB7, 0xDB, 0x15, 0x40,
+    0x12, 0xB0, 0x4A, 0x6C, 0x4D, 0x95, 0x84, 0x9C, 0x81, 0xBE, 0x97, 0x9E, 0xE8, 0xBA, 0x05, 0xF2,
+    0x85, 0x76, 0x39, 0x7B, 0x38, 0x6A, 0xC1, 0xB8, 0x17, 0xA4, 0xB8, 0x19, 0x6D, 0xFF, 0x48, 0xF2,
+    0x97, 0x4F, 0xDA, 0xED, 0x42, 0xC5, 0xAF, 0xFE, 0xB0, 0xE8, 0x6C, 0x7F, 0x62, 0x3F, 0x9F, 0x72,
+    0x2F, 0x11, 0xEE, 0x8B, 0x31, 0x6B, 0xC7, 0xDC, 0xCF, 0x89, 0x3F, 0x04, 0x40, 0x27, 0xB6, 0x71,
+    0xB7, 0x5A, 0x31, 0xD8, 0x3F, 0xBD, 0x18, 0xD2, 0xED, 0x94, 0xF8, 0xF7, 0x68, 0xD9, 0xD0, 0xE5,
+    0x72, 0xE1, 0x20, 0xD0, 0x1C, 0xAF, 0x9A, 0xBD, 0xBB, 0x6B, 0xB3, 0xDF, 0xF0, 0xFD, 0x1B, 0xE9,
+    0xB6, 0x32, 0xCD, 0x69, 0x97, 0x2C, 0x46, 0xD9, 0xC2, 0xE9, 0x5B, 0x62, 0x7D, 0x5F, 0x7C, 0x87,
+    0xC3, 0x20, 0xD4, 0xBC, 0x46, 0xDD, 0x0B, 0x80, 0x9D, 0x04, 0xE4, 0x4D, 0x2F, 0x7B, 0x64, 0x20,
+    0xE6, 0x71, 0xF8, 0x6F, 0x08, 0xDF, 0x06, 0x11, 0xEA, 0x0C, 0x87, 0xA6, 0x16, 0xC0, 0xB2, 0x17,
+    0x1F, 0x72, 0x25, 0xCE, 0x4D, 0x88, 0x3A, 0x3A, 0x9E, 0xC5, 0x64, 0xD5, 0xF9, 0x2B, 0xB0, 0x12,
+    0xBD, 0xF8, 0x71, 0x4F, 0x48, 0x21, 0x6C, 0xC4, 0x54, 0x7A, 0x89, 0x9A, 0x33, 0xB4, 0xAE, 0xC6,
+    0x85, 0x71, 0xA5, 0x0C, 0x2D, 0x8C, 0xE8, 0xA8, 0x12, 0xF8, 0x26, 0x21, 0xD6, 0x94, 0xF2, 0xD7,
+    0xDF, 0xE7, 0x63, 0xD8, 0x17, 0xB6, 0x8B, 0x3B, 0x02, 0xB7, 0xB4, 0xBE, 0x14, 0xDF, 0xDD, 0xBC,
+    0x09, 0x3E, 0xF0, 0x95, 0x98, 0x57, 0x10, 0x8B, 0x1C, 0x92, 0x4B, 0x32, 0x1C, 0xFD, 0x7D, 0x78,
+    0x5D, 0xB8, 0xAC, 0xE6, 0xB7, 0x57, 0xAB, 0x6F, 0xE4, 0x5D, 0x9D, 0x02, 0x94, 0xDF, 0x39, 0xFC,
+    0x22, 0xAE, 0x3E, 0x49, 0x1F, 0x85, 0xA2, 0xDF, 0xFD, 0x4E, 0xA2, 0x50, 0xF0, 0xEE, 0x68, 0x45,
+    0xA1, 0x88, 0x42, 0x22, 0xDC, 0xEA, 0x63, 0x48, 0xD9, 0x47, 0xCA, 0x68, 0x5B, 0x0A, 0x1F, 0xF2,
+    0x24, 0xDC, 0xDD, 0x26, 0xD7, 0x23, 0xE4, 0x97, 0x85, 0x40, 0x3F, 0xD6, 0x9D, 0x06, 0x42, 0xF7,
+    0x96, 0xFB, 0x44, 0xEF, 0xF2, 0x9A, 0x7B, 0x55, 0xC8, 0x9D, 0xD1, 0xE3, 0x27, 0x80, 0xC2, 0x7F,
+    0x43, 0x17, 0x01, 0x9E, 0x89, 0x00, 0x7A, 0xA3, 0xB1, 0xE2, 0x6E, 0x42, 0x7F, 0x3D, 0x84, 0xA7,
+    0x1B, 0xFC, 0x0B, 0x0C, 0x87, 0xA3, 0x19, 0x05, 0x9C, 0x61, 0x1E, 0x2C, 0x14, 0x22, 0x34, 0x85,
+    0x92, 0x04, 0xC7, 0x46, 0x39, 0x65, 0xF4, 0xD2, 0x83, 0x70, 0x71, 0x1C, 0x48, 0x66, 0x76, 0x7F,
+    0x1B, 0xC3, 0x7E, 0x27, 0x44, 0x38, 0x8C, 0xDF, 0x09, 0x3A, 0xFE, 0x05,
+};
+
+static const uint32_t notosans_18_regularBlockOffsets[52] = {
+    0, 1086, 2061, 2849, 3800, 4715, 5720, 6536,
+    7187, 7820, 8737, 9556, 10268, 11007, 11689, 12465,
+    13149, 13794, 14741, 15367, 15986, 16862, 17927, 19015,
+    19822, 20720, 21292, 22275, 23139, 24042, 24991, 26003,
+    26858, 27878, 28680, 29556, 30302, 31059, 31691, 32579,
+    33400, 34299, 35136, 35720, 36692, 37637, 38536, 39298,
+    40192, 41258, 42263, 43196,
+};
+
+static const uint16_t notosans_18_regularDirectGlyphs[592] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t notosans_18_regularGlyphPages[256] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+};
+
+static const uint16_t notosans_18_regularPageGlyphs[1280] = {
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+    354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+    386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+    578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+    594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+    626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+    642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+    706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+    722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+    754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+    770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+    786, 787, 788, 789, 790, 0, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+    801, 802, 0, 0, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 0,
+    830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 0, 0, 0,
+    843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858,
+    859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+    875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 0,
 };
 
 static const EpdGlyph notosans_18_regularGlyphs[] = {
@@ -6325,859 +2888,859 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 19, 29, 21, 1, 28, 138, 1606 }, // 3
     { 21, 27, 21, 0, 27, 142, 1744 }, // 4
     { 18, 28, 21, 2, 27, 126, 1886 }, // 5
-    { 18, 29, 21, 2, 28, 131, 2012 }, // 6
-    { 19, 27, 21, 1, 27, 129, 2143 }, // 7
-    { 19, 29, 21, 1, 28, 138, 2272 }, // 8
-    { 19, 29, 21, 1, 28, 138, 2410 }, // 9
-    { 6, 22, 10, 2, 21, 33, 2548 }, // :
-    { 7, 26, 10, 1, 21, 46, 2581 }, // ;
-    { 19, 19, 21, 1, 23, 91, 2627 }, // <
-    { 18, 11, 21, 2, 19, 50, 2718 }, // =
-    { 19, 19, 21, 1, 23, 91, 2768 }, // >
-    { 16, 29, 16, 0, 28, 116, 2859 }, // ?
-    { 30, 31, 34, 2, 27, 233, 2975 }, // @
-    { 24, 27, 24, 0, 27, 162, 3208 }, // A
-    { 20, 27, 24, 3, 27, 135, 3370 }, // B
-    { 21, 29, 24, 2, 28, 153, 3505 }, // C
-    { 23, 27, 27, 3, 27, 156, 3658 }, // D
-    { 16, 27, 21, 3, 27, 108, 3814 }, // E
-    { 16, 27, 19, 3, 27, 108, 3922 }, // F
-    { 23, 29, 27, 2, 28, 167, 4030 }, // G
-    { 22, 27, 28, 3, 27, 149, 4197 }, // H
-    { 11, 27, 13, 1, 27, 75, 4346 }, // I
-    { 10, 35, 10, -3, 27, 88, 4421 }, // J
-    { 21, 27, 23, 3, 27, 142, 4509 }, // K
-    { 16, 27, 20, 3, 27, 108, 4651 }, // L
-    { 28, 27, 34, 3, 27, 189, 4759 }, // M
-    { 22, 27, 29, 3, 27, 149, 4948 }, // N
-    { 25, 29, 29, 2, 28, 182, 5097 }, // O
-    { 18, 27, 23, 3, 27, 122, 5279 }, // P
-    { 25, 35, 29, 2, 28, 219, 5401 }, // Q
-    { 20, 27, 23, 3, 27, 135, 5620 }, // R
-    { 18, 29, 21, 1, 28, 131, 5755 }, // S
-    { 21, 27, 21, 0, 27, 142, 5886 }, // T
-    { 21, 28, 27, 3, 27, 147, 6028 }, // U
-    { 23, 27, 23, 0, 27, 156, 6175 }, // V
-    { 35, 27, 35, 0, 27, 237, 6331 }, // W
-    { 22, 27, 22, 0, 27, 149, 6568 }, // X
-    { 22, 27, 21, 0, 27, 149, 6717 }, // Y
-    { 19, 27, 21, 1, 27, 129, 6866 }, // Z
-    { 9, 33, 12, 3, 27, 75, 6995 }, // [
-    { 14, 27, 14, 0, 27, 95, 7070 }, // <backslash>
-    { 10, 33, 12, 0, 27, 83, 7165 }, // ]
-    { 20, 17, 21, 1, 27, 85, 7248 }, // ^
-    { 18, 3, 17, -1, -3, 14, 7333 }, // _
-    { 9, 7, 11, 1, 29, 16, 7347 }, // `
-    { 17, 22, 21, 1, 21, 94, 7363 }, // a
-    { 18, 30, 23, 3, 29, 135, 7457 }, // b
-    { 15, 22, 18, 2, 21, 83, 7592 }, // c
-    { 18, 30, 23, 2, 29, 135, 7675 }, // d
-    { 18, 22, 21, 2, 21, 99, 7810 }, // e
-    { 15, 29, 13, 0, 29, 109, 7909 }, // f
-    { 18, 30, 23, 2, 21, 135, 8018 }, // g
-    { 18, 29, 23, 3, 29, 131, 8153 }, // h
-    { 5, 28, 10, 2, 28, 35, 8284 }, // i
-    { 10, 37, 10, -3, 28, 93, 8319 }, // j
-    { 17, 29, 20, 3, 29, 124, 8412 }, // k
-    { 4, 29, 10, 3, 29, 29, 8536 }, // l
-    { 30, 21, 35, 3, 21, 158, 8565 }, // m
-    { 18, 21, 23, 3, 21, 95, 8723 }, // n
-    { 19, 22, 23, 2, 21, 105, 8818 }, // o
-    { 18, 30, 23, 3, 21, 135, 8923 }, // p
-    { 18, 30, 23, 2, 21, 135, 9058 }, // q
-    { 12, 21, 15, 3, 21, 63, 9193 }, // r
-    { 16, 22, 18, 1, 21, 88, 9256 }, // s
-    { 13, 26, 14, 0, 25, 85, 9344 }, // t
-    { 18, 22, 23, 2, 21, 99, 9429 }, // u
-    { 20, 21, 19, 0, 21, 105, 9528 }, // v
-    { 30, 21, 29, 0, 21, 158, 9633 }, // w
-    { 20, 21, 20, 0, 21, 105, 9791 }, // x
-    { 20, 30, 19, 0, 21, 150, 9896 }, // y
-    { 16, 21, 18, 1, 21, 84, 10046 }, // z
-    { 13, 33, 14, 1, 27, 108, 10130 }, // {
-    { 4, 39, 21, 8, 29, 39, 10238 }, // |
-    { 13, 33, 14, 1, 27, 108, 10277 }, // }
-    { 19, 6, 21, 1, 16, 29, 10385 }, // ~
-    { 0, 0, 10, 0, 0, 0, 10414 }, //  
-    { 6, 28, 10, 2, 21, 42, 10414 }, // ¡
-    { 16, 29, 21, 3, 28, 116, 10456 }, // ¢
-    { 20, 28, 21, 1, 28, 140, 10572 }, // £
-    { 18, 18, 21, 2, 22, 81, 10712 }, // ¤
-    { 21, 27, 21, 0, 27, 142, 10793 }, // ¥
-    { 4, 39, 21, 8, 29, 39, 10935 }, // ¦
-    { 15, 30, 19, 2, 29, 113, 10974 }, // §
-    { 12, 5, 22, 5, 28, 15, 11087 }, // ¨
-    { 29, 29, 31, 1, 28, 211, 11102 }, // ©
-    { 11, 14, 13, 1, 28, 39, 11313 }, // ª
-    { 17, 16, 19, 1, 18, 68, 11352 }, // «
-    { 19, 11, 21, 1, 15, 53, 11420 }, // ¬
-    { 10, 4, 12, 1, 12, 10, 11473 }, // ­
-    { 29, 29, 31, 1, 28, 211, 11483 }, // ®
-    { 20, 3, 19, -1, 31, 15, 11694 }, // ¯
-    { 12, 13, 16, 2, 28, 39, 11709 }, // °
-    { 19, 23, 21, 1, 23, 110, 11748 }, // ±
-    { 12, 17, 13, 0, 32, 51, 11858 }, // ²
-    { 13, 17, 13, 0, 32, 56, 11909 }, // ³
-    { 9, 7, 11, 1, 29, 16, 11965 }, // ´
-    { 18, 30, 23, 3, 21, 135, 11981 }, // µ
-    { 19, 34, 25, 2, 29, 162, 12116 }, // ¶
-    { 6, 6, 10, 2, 16, 9, 12278 }, // ·
-    { 8, 9, 8, 0, 0, 18, 12287 }, // ¸
-    { 8, 17, 13, 1, 32, 34, 12305 }, // ¹
-    { 12, 14, 14, 1, 28, 42, 12339 }, // º
-    { 17, 16, 19, 1, 18, 68, 12381 }, // »
-    { 27, 27, 28, 1, 27, 183, 12449 }, // ¼
-    { 28, 27, 29, 0, 27, 189, 12632 }, // ½
-    { 29, 28, 29, 0, 28, 203, 12821 }, // ¾
-    { 16, 29, 16, 0, 21, 116, 13024 }, // ¿
-    { 24, 36, 24, 0, 36, 216, 13140 }, // À
-    { 24, 36, 24, 0, 36, 216, 13356 }, // Á
-    { 24, 36, 24, 0, 36, 216, 13572 }, // Â
-    { 24, 35, 24, 0, 35, 210, 13788 }, // Ã
-    { 24, 35, 24, 0, 35, 210, 13998 }, // Ä
-    { 24, 33, 24, 0, 33, 198, 14208 }, // Å
-    { 32, 27, 33, -1, 27, 216, 14406 }, // Æ
-    { 21, 37, 24, 2, 28, 195, 14622 }, // Ç
-    { 16, 36, 21, 3, 36, 144, 14817 }, // È
-    { 16, 36, 21, 3, 36, 144, 14961 }, // É
-    { 16, 36, 21, 3, 36, 144, 15105 }, // Ê
-    { 16, 35, 21, 3, 35, 140, 15249 }, // Ë
-    { 11, 36, 13, 1, 36, 99, 15389 }, // Ì
-    { 11, 36, 13, 1, 36, 99, 15488 }, // Í
-    { 13, 36, 13, 0, 36, 117, 15587 }, // Î
-    { 11, 35, 13, 1, 35, 97, 15704 }, // Ï
-    { 25, 27, 27, 1, 27, 169, 15801 }, // Ð
-    { 22, 35, 29, 3, 35, 193, 15970 }, // Ñ
-    { 25, 37, 29, 2, 36, 232, 16163 }, // Ò
-    { 25, 37, 29, 2, 36, 232, 16395 }, // Ó
-    { 25, 37, 29, 2, 36, 232, 16627 }, // Ô
-    { 25, 36, 29, 2, 35, 225, 16859 }, // Õ
-    { 25, 36, 29, 2, 35, 225, 17084 }, // Ö
-    { 17, 18, 21, 2, 22, 77, 17309 }, // ×
-    { 25, 30, 29, 2, 28, 188, 17386 }, // Ø
-    { 21, 37, 27, 3, 36, 195, 17574 }, // Ù
-    { 21, 37, 27, 3, 36, 195, 17769 }, // Ú
-    { 21, 37, 27, 3, 36, 195, 17964 }, // Û
-    { 21, 36, 27, 3, 35, 189, 18159 }, // Ü
-    { 22, 36, 21, 0, 36, 198, 18348 }, // Ý
-    { 18, 27, 23, 3, 27, 122, 18546 }, // Þ
-    { 19, 30, 24, 3, 29, 143, 18668 }, // ß
-    { 17, 30, 21, 1, 29, 128, 18811 }, // à
-    { 17, 30, 21, 1, 29, 128, 18939 }, // á
-    { 17, 30, 21, 1, 29, 128, 19067 }, // â
-    { 17, 29, 21, 1, 28, 124, 19195 }, // ã
-    { 17, 29, 21, 1, 28, 124, 19319 }, // ä
-    { 17, 32, 21, 1, 31, 136, 19443 }, // å
-    { 30, 22, 32, 1, 21, 165, 19579 }, // æ
-    { 15, 30, 18, 2, 21, 113, 19744 }, // ç
-    { 18, 30, 21, 2, 29, 135, 19857 }, // è
-    { 18, 30, 21, 2, 29, 135, 19992 }, // é
-    { 18, 30, 21, 2, 29, 135, 20127 }, // ê
-    { 18, 29, 21, 2, 28, 131, 20262 }, // ë
-    { 9, 29, 10, -1, 29, 66, 20393 }, // ì
-    { 9, 29, 10, 2, 29, 66, 20459 }, // í
-    { 14, 29, 10, -2, 29, 102, 20525 }, // î
-    { 12, 28, 10, -1, 28, 84, 20627 }, // ï
-    { 19, 30, 23, 2, 29, 143, 20711 }, // ð
-    { 18, 28, 23, 3, 28, 126, 20854 }, // ñ
-    { 19, 30, 23, 2, 29, 143, 20980 }, // ò
-    { 19, 30, 23, 2, 29, 143, 21123 }, // ó
-    { 19, 30, 23, 2, 29, 143, 21266 }, // ô
-    { 19, 29, 23, 2, 28, 138, 21409 }, // õ
-    { 19, 29, 23, 2, 28, 138, 21547 }, // ö
-    { 19, 18, 21, 1, 22, 86, 21685 }, // ÷
-    { 19, 24, 23, 2, 22, 114, 21771 }, // ø
-    { 18, 30, 23, 2, 29, 135, 21885 }, // ù
-    { 18, 30, 23, 2, 29, 135, 22020 }, // ú
-    { 18, 30, 23, 2, 29, 135, 22155 }, // û
-    { 18, 29, 23, 2, 28, 131, 22290 }, // ü
-    { 20, 38, 19, 0, 29, 190, 22421 }, // ý
-    { 18, 38, 23, 3, 29, 171, 22611 }, // þ
-    { 20, 37, 19, 0, 28, 185, 22782 }, // ÿ
-    { 24, 33, 24, 0, 33, 198, 22967 }, // Ā
-    { 17, 27, 21, 1, 26, 115, 23165 }, // ā
-    { 24, 35, 24, 0, 35, 210, 23280 }, // Ă
-    { 17, 29, 21, 1, 28, 124, 23490 }, // ă
-    { 24, 36, 24, 0, 27, 216, 23614 }, // Ą
-    { 18, 30, 21, 1, 21, 135, 23830 }, // ą
-    { 21, 37, 24, 2, 36, 195, 23965 }, // Ć
-    { 15, 30, 18, 2, 29, 113, 24160 }, // ć
-    { 21, 37, 24, 2, 36, 195, 24273 }, // Ĉ
-    { 15, 30, 18, 2, 29, 113, 24468 }, // ĉ
-    { 21, 36, 24, 2, 35, 189, 24581 }, // Ċ
-    { 15, 29, 18, 2, 28, 109, 24770 }, // ċ
-    { 21, 37, 24, 2, 36, 195, 24879 }, // Č
-    { 15, 30, 18, 2, 29, 113, 25074 }, // č
-    { 23, 36, 27, 3, 36, 207, 25187 }, // Ď
-    { 24, 30, 23, 2, 29, 180, 25394 }, // ď
-    { 25, 27, 27, 1, 27, 169, 25574 }, // Đ
-    { 21, 30, 23, 2, 29, 158, 25743 }, // đ
-    { 16, 33, 21, 3, 33, 132, 25901 }, // Ē
-    { 18, 27, 21, 2, 26, 122, 26033 }, // ē
-    { 16, 35, 21, 3, 35, 140, 26155 }, // Ĕ
-    { 18, 29, 21, 2, 28, 131, 26295 }, // ĕ
-    { 16, 35, 21, 3, 35, 140, 26426 }, // Ė
-    { 18, 29, 21, 2, 28, 131, 26566 }, // ė
-    { 16, 36, 21, 3, 27, 144, 26697 }, // Ę
-    { 18, 30, 21, 2, 21, 135, 26841 }, // ę
-    { 16, 36, 21, 3, 36, 144, 26976 }, // Ě
-    { 18, 30, 21, 2, 29, 135, 27120 }, // ě
-    { 23, 37, 27, 2, 36, 213, 27255 }, // Ĝ
-    { 18, 38, 23, 2, 29, 171, 27468 }, // ĝ
-    { 23, 36, 27, 2, 35, 207, 27639 }, // Ğ
-    { 18, 37, 23, 2, 28, 167, 27846 }, // ğ
-    { 23, 36, 27, 2, 35, 207, 28013 }, // Ġ
-    { 18, 37, 23, 2, 28, 167, 28220 }, // ġ
-    { 23, 37, 27, 2, 28, 213, 28387 }, // Ģ
-    { 18, 38, 23, 2, 29, 171, 28600 }, // ģ
-    { 22, 36, 28, 3, 36, 198, 28771 }, // Ĥ
-    { 23, 37, 23, -2, 37, 213, 28969 }, // ĥ
-    { 28, 27, 28, 0, 27, 189, 29182 }, // Ħ
-    { 21, 29, 23, 0, 29, 153, 29371 }, // ħ
-    { 15, 35, 13, -1, 35, 132, 29524 }, // Ĩ
-    { 15, 28, 10, -3, 28, 105, 29656 }, // ĩ
-    { 12, 33, 13, 0, 33, 99, 29761 }, // Ī
-    { 12, 26, 10, -1, 26, 78, 29860 }, // ī
-    { 13, 35, 13, 0, 35, 114, 29938 }, // Ĭ
-    { 13, 28, 10, -2, 28, 91, 30052 }, // ĭ
-    { 11, 36, 13, 1, 27, 99, 30143 }, // Į
-    { 7, 37, 10, 1, 28, 65, 30242 }, // į
-    { 11, 35, 13, 1, 35, 97, 30307 }, // İ
-    { 4, 21, 10, 3, 21, 21, 30404 }, // ı
-    { 19, 35, 23, 1, 27, 167, 30425 }, // Ĳ
-    { 15, 37, 19, 2, 28, 139, 30592 }, // ĳ
-    { 15, 44, 10, -3, 36, 165, 30731 }, // Ĵ
-    { 15, 38, 10, -3, 29, 143, 30896 }, // ĵ
-    { 21, 36, 23, 3, 27, 189, 31039 }, // Ķ
-    { 17, 38, 20, 3, 29, 162, 31228 }, // ķ
-    { 17, 21, 20, 3, 21, 90, 31390 }, // ĸ
-    { 16, 36, 20, 3, 36, 144, 31480 }, // Ĺ
-    { 9, 37, 10, 2, 37, 84, 31624 }, // ĺ
-    { 16, 36, 20, 3, 27, 144, 31708 }, // Ļ
-    { 6, 38, 10, 2, 29, 57, 31852 }, // ļ
-    { 16, 27, 20, 3, 27, 108, 31909 }, // Ľ
-    { 10, 29, 10, 3, 29, 73, 32017 }, // ľ
-    { 16, 27, 20, 3, 27, 108, 32090 }, // Ŀ
-    { 9, 29, 10, 3, 29, 66, 32198 }, // ŀ
-    { 19, 27, 20, 0, 27, 129, 32264 }, // Ł
-    { 12, 29, 10, -1, 29, 87, 32393 }, // ł
-    { 22, 36, 29, 3, 36, 198, 32480 }, // Ń
-    { 18, 29, 23, 3, 29, 131, 32678 }, // ń
-    { 22, 36, 29, 3, 27, 198, 32809 }, // Ņ
-    { 18, 30, 23, 3, 21, 135, 33007 }, // ņ
-    { 22, 36, 29, 3, 36, 198, 33142 }, // Ň
-    { 18, 29, 23, 3, 29, 131, 33340 }, // ň
-    { 23, 27, 26, 0, 27, 156, 33471 }, // ŉ
-    { 22, 35, 29, 3, 27, 193, 33627 }, // Ŋ
-    { 18, 30, 23, 3, 21, 135, 33820 }, // ŋ
-    { 25, 34, 29, 2, 33, 213, 33955 }, // Ō
-    { 19, 27, 23, 2, 26, 129, 34168 }, // ō
-    { 25, 36, 29, 2, 35, 225, 34297 }, // Ŏ
-    { 19, 29, 23, 2, 28, 138, 34522 }, // ŏ
-    { 25, 37, 29, 2, 36, 232, 34660 }, // Ő
-    { 19, 30, 23, 2, 29, 143, 34892 }, // ő
-    { 31, 29, 35, 2, 28, 225, 35035 }, // Œ
-    { 32, 22, 35, 2, 21, 176, 35260 }, // œ
-    { 20, 36, 23, 3, 36, 180, 35436 }, // Ŕ
-    { 12, 29, 15, 3, 29, 87, 35616 }, // ŕ
-    { 20, 36, 23, 3, 27, 180, 35703 }, // Ŗ
-    { 13, 30, 15, 2, 21, 98, 35883 }, // ŗ
-    { 20, 36, 23, 3, 36, 180, 35981 }, // Ř
-    { 14, 29, 15, 2, 29, 102, 36161 }, // ř
-    { 18, 37, 21, 1, 36, 167, 36263 }, // Ś
-    { 16, 30, 18, 1, 29, 120, 36430 }, // ś
-    { 18, 37, 21, 1, 36, 167, 36550 }, // Ŝ
-    { 16, 30, 18, 1, 29, 120, 36717 }, // ŝ
-    { 18, 37, 21, 1, 28, 167, 36837 }, // Ş
-    { 16, 30, 18, 1, 21, 120, 37004 }, // ş
-    { 18, 37, 21, 1, 36, 167, 37124 }, // Š
-    { 16, 30, 18, 1, 29, 120, 37291 }, // š
-    { 21, 36, 21, 0, 27, 189, 37411 }, // Ţ
-    { 13, 34, 14, 0, 25, 111, 37600 }, // ţ
-    { 21, 36, 21, 0, 36, 189, 37711 }, // Ť
-    { 18, 30, 14, 0, 29, 135, 37900 }, // ť
-    { 21, 27, 21, 0, 27, 142, 38035 }, // Ŧ
-    { 13, 26, 14, 0, 25, 85, 38177 }, // ŧ
-    { 21, 36, 27, 3, 35, 189, 38262 }, // Ũ
-    { 18, 29, 23, 2, 28, 131, 38451 }, // ũ
-    { 21, 34, 27, 3, 33, 179, 38582 }, // Ū
-    { 18, 27, 23, 2, 26, 122, 38761 }, // ū
-    { 21, 36, 27, 3, 35, 189, 38883 }, // Ŭ
-    { 18, 29, 23, 2, 28, 131, 39072 }, // ŭ
-    { 21, 39, 27, 3, 38, 205, 39203 }, // Ů
-    { 18, 32, 23, 2, 31, 144, 39408 }, // ů
-    { 21, 37, 27, 3, 36, 195, 39552 }, // Ű
-    { 18, 30, 23, 2, 29, 135, 39747 }, // ű
-    { 21, 36, 27, 3, 27, 189, 39882 }, // Ų
-    { 19, 30, 23, 2, 21, 143, 40071 }, // ų
-    { 35, 36, 35, 0, 36, 315, 40214 }, // Ŵ
-    { 30, 29, 29, 0, 29, 218, 40529 }, // ŵ
-    { 22, 36, 21, 0, 36, 198, 40747 }, // Ŷ
-    { 20, 38, 19, 0, 29, 190, 40945 }, // ŷ
-    { 22, 35, 21, 0, 35, 193, 41135 }, // Ÿ
-    { 19, 36, 21, 1, 36, 171, 41328 }, // Ź
-    { 16, 29, 18, 1, 29, 116, 41499 }, // ź
-    { 19, 35, 21, 1, 35, 167, 41615 }, // Ż
-    { 16, 28, 18, 1, 28, 112, 41782 }, // ż
-    { 19, 36, 21, 1, 36, 171, 41894 }, // Ž
-    { 16, 29, 18, 1, 29, 116, 42065 }, // ž
-    { 11, 29, 12, 3, 29, 80, 42181 }, // ſ
-    { 9, 7, 0, -19, 29, 16, 42261 }, // ̀
-    { 9, 7, 0, -13, 29, 16, 42277 }, // ́
-    { 14, 7, 0, -7, 29, 25, 42293 }, // ̂
-    { 15, 6, 0, -19, 28, 23, 42318 }, // ̃
-    { 12, 4, 0, -6, 26, 12, 42341 }, // ̄
-    { 16, 4, 0, -8, 32, 16, 42353 }, // ̅
-    { 12, 6, 0, -6, 28, 18, 42369 }, // ̆
-    { 4, 5, 0, -2, 28, 5, 42387 }, // ̇
-    { 12, 5, 0, -6, 28, 15, 42392 }, // ̈
-    { 7, 9, 0, -14, 31, 16, 42407 }, // ̉
-    { 10, 9, 0, -5, 31, 23, 42423 }, // ̊
-    { 14, 7, 0, -5, 29, 25, 42446 }, // ̋
-    { 14, 7, 0, -7, 29, 25, 42471 }, // ̌
-    { 4, 7, 0, -2, 29, 7, 42496 }, // ̍
-    { 10, 7, 0, -5, 29, 18, 42503 }, // ̎
-    { 15, 7, 0, -20, 29, 27, 42521 }, // ̏
-    { 12, 10, 0, -6, 32, 30, 42548 }, // ̐
-    { 12, 6, 0, -6, 28, 18, 42578 }, // ̑
-    { 6, 10, 0, -3, 27, 15, 42596 }, // ̒
-    { 6, 10, 0, -3, 27, 15, 42611 }, // ̓
-    { 6, 10, 0, -3, 27, 15, 42626 }, // ̔
-    { 6, 10, 0, -3, 27, 15, 42641 }, // ̕
-    { 8, 7, 0, -4, -1, 14, 42656 }, // ̖
-    { 8, 7, 0, -4, -1, 14, 42670 }, // ̗
-    { 8, 8, 0, -4, -1, 16, 42684 }, // ̘
-    { 8, 8, 0, -4, -1, 16, 42700 }, // ̙
-    { 11, 10, 12, 0, 29, 28, 42716 }, // ̚
-    { 9, 9, 0, -4, 29, 21, 42744 }, // ̛
-    { 5, 9, 0, -2, 0, 12, 42765 }, // ̜
-    { 8, 7, 0, -4, -1, 14, 42777 }, // ̝
-    { 8, 7, 0, -4, -1, 14, 42791 }, // ̞
-    { 8, 8, 0, -4, -1, 16, 42805 }, // ̟
-    { 10, 3, 0, -5, -3, 8, 42821 }, // ̠
-    { 7, 11, 0, -7, 2, 20, 42829 }, // ̡
-    { 7, 11, 0, 0, 2, 20, 42849 }, // ̢
-    { 5, 5, 0, -14, -2, 7, 42869 }, // ̣
-    { 12, 5, 0, -6, -2, 15, 42876 }, // ̤
-    { 10, 9, 0, -5, 0, 23, 42891 }, // ̥
-    { 6, 7, 0, -3, -2, 11, 42914 }, // ̦
-    { 8, 9, 0, -4, 0, 18, 42925 }, // ̧
-    { 8, 10, 0, -4, 1, 20, 42943 }, // ̨
-    { 4, 7, 0, -2, -1, 7, 42963 }, // ̩
-    { 14, 8, 0, -7, -1, 28, 42970 }, // ̪
-    { 16, 5, 0, -8, -2, 20, 42998 }, // ̫
-    { 14, 7, 0, -7, -1, 25, 43018 }, // ̬
-    { 14, 7, 0, -7, -1, 25, 43043 }, // ̭
-    { 12, 6, 0, -6, -2, 18, 43068 }, // ̮
-    { 12, 6, 0, -6, -2, 18, 43086 }, // ̯
-    { 14, 6, 0, -7, -2, 21, 43104 }, // ̰
-    { 12, 4, 0, -6, -2, 12, 43125 }, // ̱
-    { 18, 3, 0, -9, -3, 14, 43137 }, // ̲
-    { 16, 9, 0, -8, 0, 36, 43151 }, // ̳
-    { 15, 6, 0, -7, 13, 23, 43187 }, // ̴
-    { 16, 4, 0, -8, 13, 16, 43210 }, // ̵
-    { 28, 3, 0, -14, 12, 21, 43226 }, // ̶
-    { 12, 9, 0, -6, 15, 27, 43247 }, // ̷
-    { 16, 32, 0, -8, 29, 128, 43274 }, // ̸
-    { 5, 9, 0, -2, 0, 12, 43402 }, // ̹
-    { 14, 8, 0, -7, -1, 28, 43414 }, // ̺
-    { 16, 8, 0, -8, -1, 32, 43442 }, // ̻
-    { 16, 5, 0, -8, -2, 20, 43474 }, // ̼
-    { 8, 9, 0, -4, 30, 18, 43494 }, // ̽
-    { 6, 12, 0, -3, 33, 18, 43512 }, // ̾
-    { 16, 9, 0, -8, 37, 36, 43530 }, // ̿
-    { 8, 7, 0, -6, 29, 14, 43566 }, // ̀
-    { 9, 7, 0, -2, 29, 16, 43580 }, // ́
-    { 14, 6, 0, -7, 28, 21, 43596 }, // ͂
-    { 6, 8, 0, -3, 30, 12, 43617 }, // ̓
-    { 14, 8, 0, -6, 30, 28, 43629 }, // ̈́
-    { 6, 6, 0, -2, -3, 9, 43657 }, // ͅ
-    { 18, 7, 0, -9, 29, 32, 43666 }, // ͆
-    { 16, 9, 0, -8, 0, 36, 43698 }, // ͇
-    { 10, 7, 0, -5, -1, 18, 43734 }, // ͈
-    { 8, 7, 0, -4, -2, 14, 43752 }, // ͉
-    { 14, 8, 0, -7, 29, 28, 43766 }, // ͊
-    { 14, 14, 0, -7, 35, 49, 43794 }, // ͋
-    { 14, 11, 0, -7, 33, 39, 43843 }, // ͌
-    { 14, 8, 0, -7, -1, 28, 43882 }, // ͍
-    { 8, 9, 0, -4, 0, 18, 43910 }, // ͎
-    { 28, 27, 0, -14, 27, 189, 43928 }, // ͏
-    { 7, 8, 0, -4, 30, 14, 44117 }, // ͐
-    { 5, 9, 0, -2, 31, 12, 44131 }, // ͑
-    { 12, 10, 0, -6, 32, 30, 44143 }, // ͒
-    { 8, 8, 0, -4, -1, 16, 44173 }, // ͓
-    { 7, 8, 0, -4, -1, 14, 44189 }, // ͔
-    { 7, 8, 0, -4, -1, 14, 44203 }, // ͕
-    { 15, 8, 0, -7, -1, 30, 44217 }, // ͖
-    { 5, 9, 0, -2, 31, 12, 44247 }, // ͗
-    { 5, 5, 0, 4, 28, 7, 44259 }, // ͘
-    { 8, 8, 0, -4, -1, 16, 44266 }, // ͙
-    { 16, 8, 0, -8, -1, 32, 44282 }, // ͚
-    { 8, 8, 0, -4, 30, 16, 44314 }, // ͛
-    { 30, 8, 0, -15, -1, 60, 44330 }, // ͜
-    { 30, 8, 0, -15, 30, 60, 44390 }, // ͝
-    { 24, 3, 0, -12, 26, 18, 44450 }, // ͞
-    { 24, 3, 0, -12, -2, 18, 44468 }, // ͟
-    { 30, 6, 0, -15, 28, 45, 44486 }, // ͠
-    { 30, 8, 0, -15, 32, 60, 44531 }, // ͡
-    { 30, 8, 0, -14, -1, 60, 44591 }, // ͢
-    { 8, 9, 0, -4, 32, 18, 44651 }, // ͣ
-    { 9, 9, 0, -4, 32, 21, 44669 }, // ͤ
-    { 3, 12, 0, -1, 35, 9, 44690 }, // ͥ
-    { 9, 9, 0, -4, 32, 21, 44699 }, // ͦ
-    { 9, 9, 0, -4, 32, 21, 44720 }, // ͧ
-    { 7, 9, 0, -3, 32, 16, 44741 }, // ͨ
-    { 9, 12, 0, -4, 35, 27, 44757 }, // ͩ
-    { 9, 12, 0, -4, 35, 27, 44784 }, // ͪ
-    { 14, 9, 0, -7, 32, 32, 44811 }, // ͫ
-    { 6, 9, 0, -2, 32, 14, 44843 }, // ͬ
-    { 7, 11, 0, -3, 34, 20, 44857 }, // ͭ
-    { 9, 9, 0, -4, 32, 21, 44877 }, // ͮ
-    { 9, 9, 0, -4, 32, 21, 44898 }, // ͯ
-    { 16, 36, 21, 3, 36, 144, 44919 }, // Ѐ
-    { 16, 34, 21, 3, 34, 136, 45063 }, // Ё
-    { 25, 28, 27, 0, 27, 175, 45199 }, // Ђ
-    { 16, 36, 19, 3, 36, 144, 45374 }, // Ѓ
-    { 21, 29, 24, 2, 28, 153, 45518 }, // Є
-    { 18, 29, 21, 1, 28, 131, 45671 }, // Ѕ
-    { 5, 27, 11, 3, 27, 34, 45802 }, // І
-    { 9, 34, 11, 1, 34, 77, 45836 }, // Ї
-    { 10, 35, 10, -3, 27, 88, 45913 }, // Ј
-    { 36, 28, 38, 0, 27, 252, 46001 }, // Љ
-    { 34, 27, 39, 3, 27, 230, 46253 }, // Њ
-    { 25, 27, 27, 0, 27, 169, 46483 }, // Ћ
-    { 21, 36, 23, 3, 36, 189, 46652 }, // Ќ
-    { 22, 36, 28, 3, 36, 198, 46841 }, // Ѝ
-    { 24, 35, 23, 0, 34, 210, 47039 }, // Ў
-    { 21, 33, 27, 3, 27, 174, 47249 }, // Џ
-    { 24, 27, 24, 0, 27, 162, 47423 }, // А
-    { 19, 27, 23, 3, 27, 129, 47585 }, // Б
-    { 20, 27, 24, 3, 27, 135, 47714 }, // В
-    { 16, 27, 19, 3, 27, 108, 47849 }, // Г
-    { 27, 33, 27, 0, 27, 223, 47957 }, // Д
-    { 16, 27, 21, 3, 27, 108, 48180 }, // Е
-    { 34, 27, 34, 0, 27, 230, 48288 }, // Ж
-    { 19, 29, 22, 1, 28, 138, 48518 }, // З
-    { 22, 27, 28, 3, 27, 149, 48656 }, // И
-    { 22, 34, 28, 3, 34, 187, 48805 }, // Й
-    { 21, 27, 23, 3, 27, 142, 48992 }, // К
-    { 23, 28, 26, 0, 27, 161, 49134 }, // Л
-    { 28, 27, 34, 3, 27, 189, 49295 }, // М
-    { 22, 27, 28, 3, 27, 149, 49484 }, // Н
-    { 25, 29, 29, 2, 28, 182, 49633 }, // О
-    { 21, 27, 27, 3, 27, 142, 49815 }, // П
-    { 18, 27, 23, 3, 27, 122, 49957 }, // Р
-    { 21, 29, 24, 2, 28, 153, 50079 }, // С
-    { 21, 27, 21, 0, 27, 142, 50232 }, // Т
-    { 24, 28, 23, 0, 27, 168, 50374 }, // У
-    { 28, 29, 31, 1, 28, 203, 50542 }, // Ф
-    { 22, 27, 22, 0, 27, 149, 50745 }, // Х
-    { 25, 33, 28, 3, 27, 207, 50894 }, // Ц
-    { 20, 27, 25, 2, 27, 135, 51101 }, // Ч
-    { 33, 27, 39, 3, 27, 223, 51236 }, // Ш
-    { 36, 33, 38, 3, 27, 297, 51459 }, // Щ
-    { 24, 27, 26, 0, 27, 162, 51756 }, // Ъ
-    { 26, 27, 32, 3, 27, 176, 51918 }, // Ы
-    { 18, 27, 23, 3, 27, 122, 52094 }, // Ь
-    { 22, 29, 24, 1, 28, 160, 52216 }, // Э
-    { 33, 29, 37, 3, 28, 240, 52376 }, // Ю
-    { 20, 27, 24, 1, 27, 135, 52616 }, // Я
-    { 17, 22, 21, 1, 21, 94, 52751 }, // а
-    { 20, 30, 22, 1, 29, 150, 52845 }, // б
-    { 17, 21, 21, 3, 21, 90, 52995 }, // в
-    { 13, 21, 16, 3, 21, 69, 53085 }, // г
-    { 23, 27, 23, 0, 21, 156, 53154 }, // д
-    { 18, 22, 21, 1, 21, 99, 53310 }, // е
-    { 29, 21, 28, 0, 21, 153, 53409 }, // ж
-    { 16, 22, 18, 1, 21, 88, 53562 }, // з
-    { 18, 21, 23, 3, 21, 95, 53650 }, // и
-    { 18, 28, 23, 3, 28, 126, 53745 }, // й
-    { 17, 21, 20, 3, 21, 90, 53871 }, // к
-    { 19, 22, 22, 0, 21, 105, 53961 }, // л
-    { 23, 21, 29, 3, 21, 121, 54066 }, // м
-    { 17, 21, 23, 3, 21, 90, 54187 }, // н
-    { 20, 22, 22, 1, 21, 110, 54277 }, // о
-    { 17, 21, 23, 3, 21, 90, 54387 }, // п
-    { 18, 30, 23, 3, 21, 135, 54477 }, // р
-    { 16, 22, 18, 1, 21, 88, 54612 }, // с
-    { 17, 21, 17, 0, 21, 90, 54700 }, // т
-    { 20, 30, 19, 0, 21, 150, 54790 }, // у
-    { 25, 38, 28, 1, 29, 238, 54940 }, // ф
-    { 19, 21, 19, 0, 21, 100, 55178 }, // х
-    { 20, 27, 23, 3, 21, 135, 55278 }, // ц
-    { 17, 21, 22, 2, 21, 90, 55413 }, // ч
-    { 28, 21, 34, 3, 21, 147, 55503 }, // ш
-    { 31, 27, 34, 3, 21, 210, 55650 }, // щ
-    { 22, 21, 23, 0, 21, 116, 55860 }, // ъ
-    { 23, 21, 28, 3, 21, 121, 55976 }, // ы
-    { 16, 21, 20, 3, 21, 84, 56097 }, // ь
-    { 16, 22, 19, 1, 21, 88, 56181 }, // э
-    { 26, 22, 30, 3, 21, 143, 56269 }, // ю
-    { 18, 21, 22, 1, 21, 95, 56412 }, // я
-    { 18, 30, 21, 1, 29, 135, 56507 }, // ѐ
-    { 18, 29, 21, 1, 28, 131, 56642 }, // ё
-    { 21, 38, 23, 0, 29, 200, 56773 }, // ђ
-    { 13, 29, 16, 3, 29, 95, 56973 }, // ѓ
-    { 16, 22, 18, 1, 21, 88, 57068 }, // є
-    { 15, 22, 18, 1, 21, 83, 57156 }, // ѕ
-    { 5, 28, 10, 2, 28, 35, 57239 }, // і
-    { 9, 28, 10, 0, 28, 63, 57274 }, // ї
-    { 10, 37, 10, -3, 28, 93, 57337 }, // ј
-    { 31, 22, 32, 0, 21, 171, 57430 }, // љ
-    { 29, 21, 33, 3, 21, 153, 57601 }, // њ
-    { 21, 29, 23, 0, 29, 153, 57754 }, // ћ
-    { 17, 29, 20, 3, 29, 124, 57907 }, // ќ
-    { 18, 29, 23, 3, 29, 131, 58031 }, // ѝ
-    { 20, 37, 19, 0, 28, 185, 58162 }, // ў
-    { 17, 27, 23, 3, 21, 115, 58347 }, // џ
-    { 34, 28, 34, 0, 27, 238, 58462 }, // Ѡ
-    { 29, 21, 30, 0, 21, 153, 58700 }, // ѡ
-    { 24, 27, 25, 0, 27, 162, 58853 }, // Ѣ
-    { 22, 25, 24, 0, 25, 138, 59015 }, // ѣ
-    { 31, 29, 35, 3, 28, 225, 59153 }, // Ѥ
-    { 24, 22, 28, 3, 21, 132, 59378 }, // ѥ
-    { 26, 27, 26, 0, 27, 176, 59510 }, // Ѧ
-    { 22, 21, 21, 0, 21, 116, 59686 }, // ѧ
-    { 32, 27, 35, 3, 27, 216, 59802 }, // Ѩ
-    { 27, 21, 29, 3, 21, 142, 60018 }, // ѩ
-    { 27, 27, 27, 0, 27, 183, 60160 }, // Ѫ
-    { 24, 21, 24, 0, 21, 126, 60343 }, // ѫ
-    { 34, 27, 37, 3, 27, 230, 60469 }, // Ѭ
-    { 29, 21, 32, 3, 21, 153, 60699 }, // ѭ
-    { 19, 41, 22, 1, 32, 195, 60852 }, // Ѯ
-    { 17, 33, 18, 0, 25, 141, 61047 }, // ѯ
-    { 25, 27, 30, 3, 27, 169, 61188 }, // Ѱ
-    { 24, 38, 29, 2, 29, 228, 61357 }, // ѱ
-    { 25, 29, 29, 2, 28, 182, 61585 }, // Ѳ
-    { 19, 22, 23, 2, 21, 105, 61767 }, // ѳ
-    { 25, 27, 24, 0, 27, 169, 61872 }, // Ѵ
-    { 21, 21, 19, 0, 21, 111, 62041 }, // ѵ
-    { 25, 36, 24, 0, 36, 225, 62152 }, // Ѷ
-    { 21, 29, 19, 0, 29, 153, 62377 }, // ѷ
-    { 44, 37, 46, 2, 28, 407, 62530 }, // Ѹ
-    { 40, 30, 41, 2, 21, 300, 62937 }, // ѹ
-    { 27, 32, 31, 2, 29, 216, 63237 }, // Ѻ
-    { 21, 25, 25, 2, 23, 132, 63453 }, // ѻ
-    { 35, 40, 38, 2, 39, 350, 63585 }, // Ѽ
-    { 30, 35, 34, 2, 34, 263, 63935 }, // ѽ
-    { 34, 35, 34, 0, 34, 298, 64198 }, // Ѿ
-    { 29, 27, 30, 0, 27, 196, 64496 }, // ѿ
-    { 22, 37, 24, 2, 28, 204, 64692 }, // Ҁ
-    { 16, 30, 18, 2, 21, 120, 64896 }, // ҁ
-    { 20, 25, 23, 1, 24, 125, 65016 }, // ҂
-    { 15, 6, 0, -18, 27, 23, 65141 }, // ҃
-    { 15, 6, 0, -18, 28, 23, 65164 }, // ҄
-    { 5, 8, 0, -13, 30, 10, 65187 }, // ҅
-    { 5, 8, 0, -13, 30, 10, 65197 }, // ҆
-    { 14, 6, 0, -7, 34, 21, 65207 }, // ҇
-    { 44, 40, 0, -22, 30, 440, 65228 }, // ҈
-    { 42, 42, 0, -21, 31, 441, 65668 }, // ҉
-    { 26, 43, 29, 3, 35, 280, 66109 }, // Ҋ
-    { 22, 36, 25, 3, 29, 198, 66389 }, // ҋ
-    { 22, 27, 23, 0, 27, 149, 66587 }, // Ҍ
-    { 21, 29, 22, 0, 29, 153, 66736 }, // ҍ
-    { 19, 27, 23, 3, 27, 129, 66889 }, // Ҏ
-    { 18, 30, 23, 3, 21, 135, 67018 }, // ҏ
-    { 17, 33, 20, 3, 33, 141, 67153 }, // Ґ
-    { 13, 26, 16, 3, 26, 85, 67294 }, // ґ
-    { 20, 27, 20, 0, 27, 135, 67379 }, // Ғ
-    { 16, 21, 16, 0, 21, 84, 67514 }, // ғ
-    { 21, 37, 24, 3, 27, 195, 67598 }, // Ҕ
-    { 16, 31, 20, 3, 21, 124, 67793 }, // ҕ
-    { 34, 35, 34, 0, 27, 298, 67917 }, // Җ
-    { 30, 28, 30, 0, 21, 210, 68215 }, // җ
-    { 19, 37, 22, 1, 28, 176, 68425 }, // Ҙ
-    { 16, 30, 18, 1, 21, 120, 68601 }, // ҙ
-    { 22, 35, 25, 3, 27, 193, 68721 }, // Қ
-    { 18, 28, 21, 3, 21, 126, 68914 }, // қ
-    { 21, 27, 23, 3, 27, 142, 69040 }, // Ҝ
-    { 17, 21, 20, 3, 21, 90, 69182 }, // ҝ
-    { 24, 27, 23, 0, 27, 162, 69272 }, // Ҟ
-    { 20, 29, 20, 0, 29, 145, 69434 }, // ҟ
-    { 26, 27, 26, 0, 27, 176, 69579 }, // Ҡ
-    { 24, 21, 23, 0, 21, 126, 69755 }, // ҡ
-    { 25, 35, 28, 3, 27, 219, 69881 }, // Ң
-    { 21, 28, 25, 3, 21, 147, 70100 }, // ң
-    { 28, 27, 31, 3, 27, 189, 70247 }, // Ҥ
-    { 25, 21, 28, 3, 21, 132, 70436 }, // ҥ
-    { 36, 37, 40, 3, 27, 333, 70568 }, // Ҧ
-    { 29, 31, 32, 3, 21, 225, 70901 }, // ҧ
-    { 26, 30, 29, 2, 28, 195, 71126 }, // Ҩ
-    { 21, 23, 24, 2, 21, 121, 71321 }, // ҩ
-    { 21, 37, 24, 2, 28, 195, 71442 }, // Ҫ
-    { 15, 30, 18, 2, 21, 113, 71637 }, // ҫ
-    { 21, 35, 21, 0, 27, 184, 71750 }, // Ҭ
-    { 18, 28, 18, 0, 21, 126, 71934 }, // ҭ
-    { 22, 27, 21, 0, 27, 149, 72060 }, // Ү
-    { 20, 30, 19, 0, 21, 150, 72209 }, // ү
-    { 22, 27, 21, 0, 27, 149, 72359 }, // Ұ
-    { 20, 30, 19, 0, 21, 150, 72508 }, // ұ
-    { 24, 35, 24, 0, 27, 210, 72658 }, // Ҳ
-    { 21, 28, 21, 0, 21, 147, 72868 }, // ҳ
-    { 32, 35, 32, 0, 27, 280, 73015 }, // Ҵ
-    { 27, 28, 27, 0, 21, 189, 73295 }, // ҵ
-    { 23, 35, 26, 3, 27, 202, 73484 }, // Ҷ
-    { 21, 28, 23, 2, 21, 147, 73686 }, // ҷ
-    { 20, 27, 26, 3, 27, 135, 73833 }, // Ҹ
-    { 18, 21, 23, 2, 21, 95, 73968 }, // ҹ
-    { 21, 27, 26, 3, 27, 142, 74063 }, // Һ
-    { 18, 29, 23, 3, 29, 131, 74205 }, // һ
-    { 29, 29, 32, 1, 28, 211, 74336 }, // Ҽ
-    { 24, 22, 25, 0, 21, 132, 74547 }, // ҽ
-    { 29, 36, 32, 1, 28, 261, 74679 }, // Ҿ
-    { 24, 28, 25, 0, 21, 168, 74940 }, // ҿ
-    { 11, 27, 13, 1, 27, 75, 75108 }, // Ӏ
-    { 34, 34, 34, 0, 34, 289, 75183 }, // Ӂ
-    { 29, 28, 28, 0, 28, 203, 75472 }, // ӂ
-    { 22, 37, 26, 3, 27, 204, 75675 }, // Ӄ
-    { 17, 31, 21, 3, 21, 132, 75879 }, // ӄ
-    { 27, 35, 27, 0, 27, 237, 76011 }, // Ӆ
-    { 22, 28, 22, 0, 21, 154, 76248 }, // ӆ
-    { 22, 37, 27, 3, 27, 204, 76402 }, // Ӈ
-    { 18, 31, 23, 3, 21, 140, 76606 }, // ӈ
-    { 25, 35, 28, 3, 27, 219, 76746 }, // Ӊ
-    { 22, 28, 25, 3, 21, 154, 76965 }, // ӊ
-    { 20, 35, 26, 3, 27, 175, 77119 }, // Ӌ
-    { 18, 28, 23, 2, 21, 126, 77294 }, // ӌ
-    { 32, 35, 34, 3, 27, 280, 77420 }, // Ӎ
-    { 26, 28, 28, 3, 21, 182, 77700 }, // ӎ
-    { 11, 27, 13, 1, 27, 75, 77882 }, // ӏ
-    { 24, 34, 24, 0, 34, 204, 77957 }, // Ӑ
-    { 17, 29, 21, 1, 28, 124, 78161 }, // ӑ
-    { 24, 35, 24, 0, 35, 210, 78285 }, // Ӓ
-    { 17, 29, 21, 1, 28, 124, 78495 }, // ӓ
-    { 32, 27, 33, -1, 27, 216, 78619 }, // Ӕ
-    { 30, 22, 32, 1, 21, 165, 78835 }, // ӕ
-    { 16, 34, 21, 3, 34, 136, 79000 }, // Ӗ
-    { 18, 29, 21, 2, 28, 131, 79136 }, // ӗ
-    { 24, 29, 28, 2, 28, 174, 79267 }, // Ә
-    { 19, 22, 21, 1, 21, 105, 79441 }, // ә
-    { 24, 36, 28, 2, 35, 216, 79546 }, // Ӛ
-    { 19, 29, 21, 1, 28, 138, 79762 }, // ӛ
-    { 34, 35, 34, 0, 35, 298, 79900 }, // Ӝ
-    { 29, 28, 28, 0, 28, 203, 80198 }, // ӝ
-    { 19, 36, 22, 1, 35, 171, 80401 }, // Ӟ
-    { 16, 29, 18, 1, 28, 116, 80572 }, // ӟ
-    { 19, 28, 22, 1, 27, 133, 80688 }, // Ӡ
-    { 18, 30, 19, 0, 21, 135, 80821 }, // ӡ
-    { 22, 33, 28, 3, 33, 182, 80956 }, // Ӣ
-    { 18, 26, 23, 3, 26, 117, 81138 }, // ӣ
-    { 22, 35, 28, 3, 35, 193, 81255 }, // Ӥ
-    { 18, 28, 23, 3, 28, 126, 81448 }, // ӥ
-    { 25, 36, 29, 2, 35, 225, 81574 }, // Ӧ
-    { 19, 29, 23, 2, 28, 138, 81799 }, // ӧ
-    { 25, 29, 29, 2, 28, 182, 81937 }, // Ө
-    { 19, 22, 23, 2, 21, 105, 82119 }, // ө
-    { 25, 35, 29, 2, 34, 219, 82224 }, // Ӫ
-    { 19, 29, 23, 2, 28, 138, 82443 }, // ӫ
-    { 22, 36, 24, 1, 35, 198, 82581 }, // Ӭ
-    { 16, 29, 19, 1, 28, 116, 82779 }, // ӭ
-    { 24, 34, 23, 0, 33, 204, 82895 }, // Ӯ
-    { 20, 35, 19, 0, 26, 175, 83099 }, // ӯ
-    { 24, 36, 23, 0, 35, 216, 83274 }, // Ӱ
-    { 20, 37, 19, 0, 28, 185, 83490 }, // ӱ
-    { 24, 37, 23, 0, 36, 222, 83675 }, // Ӳ
-    { 20, 38, 19, 0, 29, 190, 83897 }, // ӳ
-    { 20, 35, 25, 2, 35, 175, 84087 }, // Ӵ
-    { 17, 28, 22, 2, 28, 119, 84262 }, // ӵ
-    { 17, 35, 20, 3, 27, 149, 84381 }, // Ӷ
-    { 13, 28, 16, 3, 21, 91, 84530 }, // ӷ
-    { 26, 35, 32, 3, 35, 228, 84621 }, // Ӹ
-    { 23, 28, 28, 3, 28, 161, 84849 }, // ӹ
-    { 20, 35, 20, 0, 27, 175, 85010 }, // Ӻ
-    { 16, 29, 16, 0, 21, 116, 85185 }, // ӻ
-    { 23, 35, 24, 0, 27, 202, 85301 }, // Ӽ
-    { 21, 29, 21, 0, 21, 153, 85503 }, // ӽ
-    { 22, 27, 22, 0, 27, 149, 85656 }, // Ӿ
-    { 20, 21, 20, 0, 21, 105, 85805 }, // ӿ
-    { 0, 0, 19, 0, 0, 0, 85910 }, //  
-    { 0, 0, 38, 0, 0, 0, 85910 }, //  
-    { 0, 0, 19, 0, 0, 0, 85910 }, //  
-    { 0, 0, 38, 0, 0, 0, 85910 }, //  
-    { 0, 0, 12, 0, 0, 0, 85910 }, //  
-    { 0, 0, 9, 0, 0, 0, 85910 }, //  
-    { 0, 0, 6, 0, 0, 0, 85910 }, //  
-    { 0, 0, 21, 0, 0, 0, 85910 }, //  
-    { 0, 0, 10, 0, 0, 0, 85910 }, //  
-    { 0, 0, 6, 0, 0, 0, 85910 }, //  
-    { 0, 0, 4, 0, 0, 0, 85910 }, //  
-    { 0, 0, 0, 0, 0, 0, 85910 }, // ​
-    { 0, 0, 0, 0, 0, 0, 85910 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 85910 }, // ‍
-    { 9, 31, 0, -1, 26, 70, 85910 }, // ‎
-    { 9, 31, 0, -8, 26, 70, 85980 }, // ‏
-    { 10, 4, 12, 1, 12, 10, 86050 }, // ‐
-    { 10, 4, 12, 1, 12, 10, 86060 }, // ‑
-    { 19, 3, 21, 1, 15, 15, 86070 }, // ‒
-    { 17, 4, 19, 1, 12, 17, 86085 }, // –
-    { 35, 4, 38, 1, 12, 35, 86102 }, // —
-    { 35, 4, 38, 1, 12, 35, 86137 }, // ―
-    { 12, 39, 21, 4, 29, 117, 86172 }, // ‖
-    { 17, 9, 15, -1, 0, 39, 86289 }, // ‗
-    { 7, 10, 7, 0, 27, 18, 86328 }, // ‘
-    { 7, 10, 7, 0, 27, 18, 86346 }, // ’
-    { 6, 10, 9, 1, 5, 15, 86364 }, // ‚
-    { 7, 10, 7, 0, 27, 18, 86379 }, // ‛
-    { 14, 10, 13, 0, 27, 35, 86397 }, // “
-    { 14, 10, 13, 0, 27, 35, 86432 }, // ”
-    { 13, 10, 16, 1, 5, 33, 86467 }, // „
-    { 14, 10, 13, 0, 27, 35, 86500 }, // ‟
-    { 15, 29, 19, 2, 29, 109, 86535 }, // †
-    { 15, 29, 19, 2, 29, 109, 86644 }, // ‡
-    { 10, 10, 14, 2, 19, 25, 86753 }, // •
-    { 11, 12, 14, 2, 20, 33, 86778 }, // ‣
-    { 5, 6, 19, 7, 5, 8, 86811 }, // ․
-    { 16, 6, 20, 2, 5, 24, 86819 }, // ‥
-    { 25, 6, 30, 2, 5, 38, 86843 }, // …
-    { 6, 6, 10, 2, 12, 9, 86881 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 86890 }, //  
-    { 0, 0, 23, 0, 0, 0, 86890 }, //  
-    { 9, 28, 0, -1, 23, 63, 86890 }, // ‪
-    { 9, 28, 0, -8, 23, 63, 86953 }, // ‫
-    { 10, 31, 0, -5, 26, 78, 87016 }, // ‬
-    { 10, 31, 0, -5, 26, 78, 87094 }, // ‭
-    { 10, 31, 0, -5, 26, 78, 87172 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 87250 }, //  
-    { 42, 29, 44, 1, 28, 305, 87250 }, // ‰
-    { 56, 29, 58, 1, 28, 406, 87555 }, // ‱
-    { 9, 10, 9, 1, 27, 23, 87961 }, // ′
-    { 16, 10, 15, 1, 27, 40, 87984 }, // ″
-    { 22, 10, 22, 1, 27, 55, 88024 }, // ‴
-    { 9, 10, 9, -1, 27, 23, 88079 }, // ‵
-    { 15, 10, 17, -1, 27, 38, 88102 }, // ‶
-    { 21, 10, 23, -1, 27, 53, 88140 }, // ‷
-    { 15, 13, 15, 0, 4, 49, 88193 }, // ‸
-    { 10, 16, 12, 1, 18, 40, 88242 }, // ‹
-    { 10, 16, 12, 1, 18, 40, 88282 }, // ›
-    { 29, 29, 31, 1, 28, 211, 88322 }, // ※
-    { 14, 28, 19, 2, 27, 98, 88533 }, // ‼
-    { 16, 29, 17, 0, 28, 116, 88631 }, // ‽
-    { 20, 3, 19, -1, 31, 15, 88747 }, // ‾
-    { 22, 8, 23, 0, -1, 44, 88762 }, // ‿
-    { 22, 9, 23, 0, 30, 50, 88806 }, // ⁀
-    { 14, 25, 14, 0, 16, 88, 88856 }, // ⁁
-    { 42, 35, 42, 0, 29, 368, 88944 }, // ⁂
-    { 10, 4, 12, 1, 12, 10, 89312 }, // ⁃
-    { 20, 27, 5, -8, 27, 135, 89322 }, // ⁄
-    { 10, 33, 12, 2, 27, 83, 89457 }, // ⁅
-    { 10, 33, 12, 0, 27, 83, 89540 }, // ⁆
-    { 32, 29, 32, 0, 28, 232, 89623 }, // ⁇
-    { 23, 29, 25, 0, 28, 167, 89855 }, // ⁈
-    { 23, 29, 26, 2, 28, 167, 90022 }, // ⁉
-    { 19, 21, 21, 1, 21, 100, 90189 }, // ⁊
-    { 20, 34, 25, 3, 29, 170, 90289 }, // ⁋
-    { 19, 20, 24, 2, 21, 95, 90459 }, // ⁌
-    { 19, 20, 24, 3, 21, 95, 90554 }, // ⁍
-    { 19, 18, 21, 1, 10, 86, 90649 }, // ⁎
-    { 7, 26, 9, 1, 21, 46, 90735 }, // ⁏
-    { 22, 39, 23, 0, 30, 215, 90781 }, // ⁐
-    { 19, 37, 21, 1, 29, 176, 90996 }, // ⁑
-    { 14, 29, 14, 0, 28, 102, 91172 }, // ⁒
-    { 33, 6, 38, 2, 14, 50, 91274 }, // ⁓
-    { 22, 9, 23, 0, 0, 50, 91324 }, // ⁔
-    { 20, 20, 21, 1, 19, 100, 91374 }, // ⁕
-    { 17, 29, 19, 1, 28, 124, 91474 }, // ⁖
-    { 28, 10, 28, 1, 27, 70, 91598 }, // ⁗
-    { 28, 29, 31, 1, 28, 203, 91668 }, // ⁘
-    { 29, 29, 31, 1, 28, 211, 91871 }, // ⁙
-    { 6, 29, 8, 1, 28, 44, 92082 }, // ⁚
-    { 22, 30, 25, 1, 29, 165, 92126 }, // ⁛
-    { 28, 29, 30, 1, 28, 203, 92291 }, // ⁜
-    { 6, 28, 10, 2, 27, 42, 92494 }, // ⁝
-    { 6, 29, 10, 2, 28, 44, 92536 }, // ⁞
-    { 0, 0, 8, 0, 0, 0, 92580 }, //  
-    { 0, 0, 23, 0, 0, 0, 92580 }, // ⁠
-    { 0, 0, 23, 0, 0, 0, 92580 }, // ⁡
-    { 0, 0, 23, 0, 0, 0, 92580 }, // ⁢
-    { 0, 0, 23, 0, 0, 0, 92580 }, // ⁣
-    { 0, 0, 23, 0, 0, 0, 92580 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 92580 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 92580 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 92580 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 92580 }, // ⁩
-    { 10, 31, 0, -5, 26, 78, 92580 }, // ⁪
-    { 10, 31, 0, -5, 26, 78, 92658 }, // ⁫
-    { 10, 31, 0, -5, 26, 78, 92736 }, // ⁬
-    { 10, 31, 0, -5, 26, 78, 92814 }, // ⁭
-    { 10, 31, 0, -5, 26, 78, 92892 }, // ⁮
-    { 10, 31, 0, -5, 26, 78, 92970 }, // ⁯
-    { 13, 17, 13, 0, 32, 56, 93048 }, // ⁰
-    { 4, 18, 6, 1, 28, 18, 93104 }, // ⁱ
-    { 13, 17, 13, 0, 32, 56, 93122 }, // ⁴
-    { 11, 17, 13, 1, 32, 47, 93178 }, // ⁵
-    { 13, 17, 13, 0, 32, 56, 93225 }, // ⁶
-    { 12, 17, 13, 1, 32, 51, 93281 }, // ⁷
-    { 13, 17, 13, 0, 32, 56, 93332 }, // ⁸
-    { 13, 18, 13, 0, 33, 59, 93388 }, // ⁹
-    { 11, 11, 13, 1, 28, 31, 93447 }, // ⁺
-    { 11, 3, 13, 1, 24, 9, 93478 }, // ⁻
-    { 11, 7, 13, 1, 26, 20, 93487 }, // ⁼
-    { 7, 22, 8, 2, 35, 39, 93507 }, // ⁽
-    { 7, 22, 8, 0, 35, 39, 93546 }, // ⁾
-    { 12, 14, 15, 2, 24, 42, 93585 }, // ⁿ
-    { 13, 17, 13, 0, 12, 56, 93627 }, // ₀
-    { 8, 17, 13, 1, 12, 34, 93683 }, // ₁
-    { 12, 17, 13, 0, 12, 51, 93717 }, // ₂
-    { 13, 17, 13, 0, 12, 56, 93768 }, // ₃
-    { 13, 17, 13, 0, 12, 56, 93824 }, // ₄
-    { 11, 17, 13, 1, 12, 47, 93880 }, // ₅
-    { 13, 17, 13, 0, 12, 56, 93927 }, // ₆
-    { 12, 17, 13, 1, 12, 51, 93983 }, // ₇
-    { 13, 17, 13, 0, 12, 56, 94034 }, // ₈
-    { 13, 18, 13, 0, 13, 59, 94090 }, // ₉
-    { 11, 11, 13, 1, 8, 31, 94149 }, // ₊
-    { 11, 3, 13, 1, 4, 9, 94180 }, // ₋
-    { 11, 7, 13, 1, 6, 20, 94189 }, // ₌
-    { 7, 22, 8, 2, 14, 39, 94209 }, // ₍
-    { 7, 22, 8, 0, 14, 39, 94248 }, // ₎
-    { 11, 13, 14, 1, 9, 36, 94287 }, // ₐ
-    { 12, 13, 14, 1, 9, 39, 94323 }, // ₑ
-    { 13, 13, 15, 1, 9, 43, 94362 }, // ₒ
-    { 13, 13, 13, 0, 9, 43, 94405 }, // ₓ
-    { 12, 13, 14, 1, 9, 39, 94448 }, // ₔ
-    { 12, 18, 15, 2, 14, 54, 94487 }, // ₕ
-    { 11, 18, 13, 2, 14, 50, 94541 }, // ₖ
-    { 3, 18, 6, 2, 14, 14, 94591 }, // ₗ
-    { 19, 13, 23, 2, 9, 62, 94605 }, // ₘ
-    { 12, 13, 15, 2, 9, 39, 94667 }, // ₙ
-    { 12, 18, 15, 2, 9, 54, 94706 }, // ₚ
-    { 10, 13, 12, 1, 9, 33, 94760 }, // ₛ
-    { 9, 16, 9, 0, 12, 36, 94793 }, // ₜ
-    { 20, 28, 21, 1, 28, 140, 94829 }, // ₠
-    { 20, 32, 21, 1, 29, 160, 94969 }, // ₡
-    { 19, 29, 21, 2, 28, 138, 95129 }, // ₢
-    { 19, 27, 21, 1, 27, 129, 95267 }, // ₣
-    { 20, 28, 21, 1, 28, 140, 95396 }, // ₤
-    { 30, 30, 35, 3, 25, 225, 95536 }, // ₥
-    { 22, 27, 21, 0, 27, 149, 95761 }, // ₦
-    { 26, 28, 29, 2, 27, 182, 95910 }, // ₧
-    { 27, 28, 31, 3, 27, 189, 96092 }, // ₨
-    { 25, 27, 25, 0, 27, 169, 96281 }, // ₩
-    { 24, 27, 30, 3, 27, 162, 96450 }, // ₪
-    { 21, 35, 23, 2, 29, 184, 96612 }, // ₫
-    { 21, 29, 21, 0, 28, 153, 96796 }, // €
-    { 22, 27, 21, 0, 27, 149, 96949 }, // ₭
-    { 21, 27, 21, 0, 27, 142, 97098 }, // ₮
-    { 36, 37, 36, 0, 28, 333, 97240 }, // ₯
-    { 20, 37, 21, 0, 28, 185, 97573 }, // ₰
-    { 22, 27, 21, 0, 27, 149, 97758 }, // ₱
-    { 23, 32, 27, 2, 29, 184, 97907 }, // ₲
-    { 23, 27, 23, 0, 27, 156, 98091 }, // ₳
-    { 21, 29, 21, 0, 28, 153, 98247 }, // ₴
-    { 21, 32, 24, 2, 29, 168, 98400 }, // ₵
-    { 23, 26, 23, 0, 25, 150, 98568 }, // ₶
-    { 26, 31, 27, 0, 28, 202, 98718 }, // ₷
-    { 20, 27, 20, 0, 27, 135, 98920 }, // ₸
-    { 17, 27, 21, 2, 27, 115, 99055 }, // ₹
-    { 21, 28, 21, 0, 27, 147, 99170 }, // ₺
-    { 29, 29, 29, 0, 28, 211, 99317 }, // ₻
-    { 26, 27, 30, 2, 27, 176, 99528 }, // ₼
-    { 21, 27, 22, 0, 27, 142, 99704 }, // ₽
-    { 25, 29, 29, 2, 29, 182, 99846 }, // ₾
-    { 18, 35, 21, 3, 31, 158, 100028 }, // ₿
-    { 16, 27, 18, 1, 21, 108, 100186 }, // ⃀
-    { 19, 4, 21, 1, 15, 19, 100294 }, // −
-    { 35, 35, 38, 1, 29, 307, 100313 }, // �
+    { 18, 29, 21, 2, 28, 131, 2048 }, // 6
+    { 19, 27, 21, 1, 27, 129, 2179 }, // 7
+    { 19, 29, 21, 1, 28, 138, 2308 }, // 8
+    { 19, 29, 21, 1, 28, 138, 2446 }, // 9
+    { 6, 22, 10, 2, 21, 33, 2584 }, // :
+    { 7, 26, 10, 1, 21, 46, 2617 }, // ;
+    { 19, 19, 21, 1, 23, 91, 2663 }, // <
+    { 18, 11, 21, 2, 19, 50, 2754 }, // =
+    { 19, 19, 21, 1, 23, 91, 2804 }, // >
+    { 16, 29, 16, 0, 28, 116, 2895 }, // ?
+    { 30, 31, 34, 2, 27, 233, 3011 }, // @
+    { 24, 27, 24, 0, 27, 162, 3244 }, // A
+    { 20, 27, 24, 3, 27, 135, 3406 }, // B
+    { 21, 29, 24, 2, 28, 153, 3541 }, // C
+    { 23, 27, 27, 3, 27, 156, 3694 }, // D
+    { 16, 27, 21, 3, 27, 108, 3850 }, // E
+    { 16, 27, 19, 3, 27, 108, 3958 }, // F
+    { 23, 29, 27, 2, 28, 167, 4096 }, // G
+    { 22, 27, 28, 3, 27, 149, 4263 }, // H
+    { 11, 27, 13, 1, 27, 75, 4412 }, // I
+    { 10, 35, 10, -3, 27, 88, 4487 }, // J
+    { 21, 27, 23, 3, 27, 142, 4575 }, // K
+    { 16, 27, 20, 3, 27, 108, 4717 }, // L
+    { 28, 27, 34, 3, 27, 189, 4825 }, // M
+    { 22, 27, 29, 3, 27, 149, 5014 }, // N
+    { 25, 29, 29, 2, 28, 182, 5163 }, // O
+    { 18, 27, 23, 3, 27, 122, 5345 }, // P
+    { 25, 35, 29, 2, 28, 219, 5467 }, // Q
+    { 20, 27, 23, 3, 27, 135, 5686 }, // R
+    { 18, 29, 21, 1, 28, 131, 5821 }, // S
+    { 21, 27, 21, 0, 27, 142, 5952 }, // T
+    { 21, 28, 27, 3, 27, 147, 6144 }, // U
+    { 23, 27, 23, 0, 27, 156, 6291 }, // V
+    { 35, 27, 35, 0, 27, 237, 6447 }, // W
+    { 22, 27, 22, 0, 27, 149, 6684 }, // X
+    { 22, 27, 21, 0, 27, 149, 6833 }, // Y
+    { 19, 27, 21, 1, 27, 129, 6982 }, // Z
+    { 9, 33, 12, 3, 27, 75, 7111 }, // [
+    { 14, 27, 14, 0, 27, 95, 7186 }, // <backslash>
+    { 10, 33, 12, 0, 27, 83, 7281 }, // ]
+    { 20, 17, 21, 1, 27, 85, 7364 }, // ^
+    { 18, 3, 17, -1, -3, 14, 7449 }, // _
+    { 9, 7, 11, 1, 29, 16, 7463 }, // `
+    { 17, 22, 21, 1, 21, 94, 7479 }, // a
+    { 18, 30, 23, 3, 29, 135, 7573 }, // b
+    { 15, 22, 18, 2, 21, 83, 7708 }, // c
+    { 18, 30, 23, 2, 29, 135, 7791 }, // d
+    { 18, 22, 21, 2, 21, 99, 7926 }, // e
+    { 15, 29, 13, 0, 29, 109, 8025 }, // f
+    { 18, 30, 23, 2, 21, 135, 8192 }, // g
+    { 18, 29, 23, 3, 29, 131, 8327 }, // h
+    { 5, 28, 10, 2, 28, 35, 8458 }, // i
+    { 10, 37, 10, -3, 28, 93, 8493 }, // j
+    { 17, 29, 20, 3, 29, 124, 8586 }, // k
+    { 4, 29, 10, 3, 29, 29, 8710 }, // l
+    { 30, 21, 35, 3, 21, 158, 8739 }, // m
+    { 18, 21, 23, 3, 21, 95, 8897 }, // n
+    { 19, 22, 23, 2, 21, 105, 8992 }, // o
+    { 18, 30, 23, 3, 21, 135, 9097 }, // p
+    { 18, 30, 23, 2, 21, 135, 9232 }, // q
+    { 12, 21, 15, 3, 21, 63, 9367 }, // r
+    { 16, 22, 18, 1, 21, 88, 9430 }, // s
+    { 13, 26, 14, 0, 25, 85, 9518 }, // t
+    { 18, 22, 23, 2, 21, 99, 9603 }, // u
+    { 20, 21, 19, 0, 21, 105, 9702 }, // v
+    { 30, 21, 29, 0, 21, 158, 9807 }, // w
+    { 20, 21, 20, 0, 21, 105, 9965 }, // x
+    { 20, 30, 19, 0, 21, 150, 10070 }, // y
+    { 16, 21, 18, 1, 21, 84, 10240 }, // z
+    { 13, 33, 14, 1, 27, 108, 10324 }, // {
+    { 4, 39, 21, 8, 29, 39, 10432 }, // |
+    { 13, 33, 14, 1, 27, 108, 10471 }, // }
+    { 19, 6, 21, 1, 16, 29, 10579 }, // ~
+    { 0, 0, 10, 0, 0, 0, 10608 }, //  
+    { 6, 28, 10, 2, 21, 42, 10608 }, // ¡
+    { 16, 29, 21, 3, 28, 116, 10650 }, // ¢
+    { 20, 28, 21, 1, 28, 140, 10766 }, // £
+    { 18, 18, 21, 2, 22, 81, 10906 }, // ¤
+    { 21, 27, 21, 0, 27, 142, 10987 }, // ¥
+    { 4, 39, 21, 8, 29, 39, 11129 }, // ¦
+    { 15, 30, 19, 2, 29, 113, 11168 }, // §
+    { 12, 5, 22, 5, 28, 15, 11281 }, // ¨
+    { 29, 29, 31, 1, 28, 211, 11296 }, // ©
+    { 11, 14, 13, 1, 28, 39, 11507 }, // ª
+    { 17, 16, 19, 1, 18, 68, 11546 }, // «
+    { 19, 11, 21, 1, 15, 53, 11614 }, // ¬
+    { 10, 4, 12, 1, 12, 10, 11667 }, // ­
+    { 29, 29, 31, 1, 28, 211, 11677 }, // ®
+    { 20, 3, 19, -1, 31, 15, 11888 }, // ¯
+    { 12, 13, 16, 2, 28, 39, 11903 }, // °
+    { 19, 23, 21, 1, 23, 110, 11942 }, // ±
+    { 12, 17, 13, 0, 32, 51, 12052 }, // ²
+    { 13, 17, 13, 0, 32, 56, 12103 }, // ³
+    { 9, 7, 11, 1, 29, 16, 12159 }, // ´
+    { 18, 30, 23, 3, 21, 135, 12288 }, // µ
+    { 19, 34, 25, 2, 29, 162, 12423 }, // ¶
+    { 6, 6, 10, 2, 16, 9, 12585 }, // ·
+    { 8, 9, 8, 0, 0, 18, 12594 }, // ¸
+    { 8, 17, 13, 1, 32, 34, 12612 }, // ¹
+    { 12, 14, 14, 1, 28, 42, 12646 }, // º
+    { 17, 16, 19, 1, 18, 68, 12688 }, // »
+    { 27, 27, 28, 1, 27, 183, 12756 }, // ¼
+    { 28, 27, 29, 0, 27, 189, 12939 }, // ½
+    { 29, 28, 29, 0, 28, 203, 13128 }, // ¾
+    { 16, 29, 16, 0, 21, 116, 13331 }, // ¿
+    { 24, 36, 24, 0, 36, 216, 13447 }, // À
+    { 24, 36, 24, 0, 36, 216, 13663 }, // Á
+    { 24, 36, 24, 0, 36, 216, 13879 }, // Â
+    { 24, 35, 24, 0, 35, 210, 14095 }, // Ã
+    { 24, 35, 24, 0, 35, 210, 14336 }, // Ä
+    { 24, 33, 24, 0, 33, 198, 14546 }, // Å
+    { 32, 27, 33, -1, 27, 216, 14744 }, // Æ
+    { 21, 37, 24, 2, 28, 195, 14960 }, // Ç
+    { 16, 36, 21, 3, 36, 144, 15155 }, // È
+    { 16, 36, 21, 3, 36, 144, 15299 }, // É
+    { 16, 36, 21, 3, 36, 144, 15443 }, // Ê
+    { 16, 35, 21, 3, 35, 140, 15587 }, // Ë
+    { 11, 36, 13, 1, 36, 99, 15727 }, // Ì
+    { 11, 36, 13, 1, 36, 99, 15826 }, // Í
+    { 13, 36, 13, 0, 36, 117, 15925 }, // Î
+    { 11, 35, 13, 1, 35, 97, 16042 }, // Ï
+    { 25, 27, 27, 1, 27, 169, 16139 }, // Ð
+    { 22, 35, 29, 3, 35, 193, 16384 }, // Ñ
+    { 25, 37, 29, 2, 36, 232, 16577 }, // Ò
+    { 25, 37, 29, 2, 36, 232, 16809 }, // Ó
+    { 25, 37, 29, 2, 36, 232, 17041 }, // Ô
+    { 25, 36, 29, 2, 35, 225, 17273 }, // Õ
+    { 25, 36, 29, 2, 35, 225, 17498 }, // Ö
+    { 17, 18, 21, 2, 22, 77, 17723 }, // ×
+    { 25, 30, 29, 2, 28, 188, 17800 }, // Ø
+    { 21, 37, 27, 3, 36, 195, 17988 }, // Ù
+    { 21, 37, 27, 3, 36, 195, 18183 }, // Ú
+    { 21, 37, 27, 3, 36, 195, 18432 }, // Û
+    { 21, 36, 27, 3, 35, 189, 18627 }, // Ü
+    { 22, 36, 21, 0, 36, 198, 18816 }, // Ý
+    { 18, 27, 23, 3, 27, 122, 19014 }, // Þ
+    { 19, 30, 24, 3, 29, 143, 19136 }, // ß
+    { 17, 30, 21, 1, 29, 128, 19279 }, // à
+    { 17, 30, 21, 1, 29, 128, 19407 }, // á
+    { 17, 30, 21, 1, 29, 128, 19535 }, // â
+    { 17, 29, 21, 1, 28, 124, 19663 }, // ã
+    { 17, 29, 21, 1, 28, 124, 19787 }, // ä
+    { 17, 32, 21, 1, 31, 136, 19911 }, // å
+    { 30, 22, 32, 1, 21, 165, 20047 }, // æ
+    { 15, 30, 18, 2, 21, 113, 20212 }, // ç
+    { 18, 30, 21, 2, 29, 135, 20325 }, // è
+    { 18, 30, 21, 2, 29, 135, 20480 }, // é
+    { 18, 30, 21, 2, 29, 135, 20615 }, // ê
+    { 18, 29, 21, 2, 28, 131, 20750 }, // ë
+    { 9, 29, 10, -1, 29, 66, 20881 }, // ì
+    { 9, 29, 10, 2, 29, 66, 20947 }, // í
+    { 14, 29, 10, -2, 29, 102, 21013 }, // î
+    { 12, 28, 10, -1, 28, 84, 21115 }, // ï
+    { 19, 30, 23, 2, 29, 143, 21199 }, // ð
+    { 18, 28, 23, 3, 28, 126, 21342 }, // ñ
+    { 19, 30, 23, 2, 29, 143, 21468 }, // ò
+    { 19, 30, 23, 2, 29, 143, 21611 }, // ó
+    { 19, 30, 23, 2, 29, 143, 21754 }, // ô
+    { 19, 29, 23, 2, 28, 138, 21897 }, // õ
+    { 19, 29, 23, 2, 28, 138, 22035 }, // ö
+    { 19, 18, 21, 1, 22, 86, 22173 }, // ÷
+    { 19, 24, 23, 2, 22, 114, 22259 }, // ø
+    { 18, 30, 23, 2, 29, 135, 22373 }, // ù
+    { 18, 30, 23, 2, 29, 135, 22528 }, // ú
+    { 18, 30, 23, 2, 29, 135, 22663 }, // û
+    { 18, 29, 23, 2, 28, 131, 22798 }, // ü
+    { 20, 38, 19, 0, 29, 190, 22929 }, // ý
+    { 18, 38, 23, 3, 29, 171, 23119 }, // þ
+    { 20, 37, 19, 0, 28, 185, 23290 }, // ÿ
+    { 24, 33, 24, 0, 33, 198, 23475 }, // Ā
+    { 17, 27, 21, 1, 26, 115, 23673 }, // ā
+    { 24, 35, 24, 0, 35, 210, 23788 }, // Ă
+    { 17, 29, 21, 1, 28, 124, 23998 }, // ă
+    { 24, 36, 24, 0, 27, 216, 24122 }, // Ą
+    { 18, 30, 21, 1, 21, 135, 24338 }, // ą
+    { 21, 37, 24, 2, 36, 195, 24576 }, // Ć
+    { 15, 30, 18, 2, 29, 113, 24771 }, // ć
+    { 21, 37, 24, 2, 36, 195, 24884 }, // Ĉ
+    { 15, 30, 18, 2, 29, 113, 25079 }, // ĉ
+    { 21, 36, 24, 2, 35, 189, 25192 }, // Ċ
+    { 15, 29, 18, 2, 28, 109, 25381 }, // ċ
+    { 21, 37, 24, 2, 36, 195, 25490 }, // Č
+    { 15, 30, 18, 2, 29, 113, 25685 }, // č
+    { 23, 36, 27, 3, 36, 207, 25798 }, // Ď
+    { 24, 30, 23, 2, 29, 180, 26005 }, // ď
+    { 25, 27, 27, 1, 27, 169, 26185 }, // Đ
+    { 21, 30, 23, 2, 29, 158, 26354 }, // đ
+    { 16, 33, 21, 3, 33, 132, 26624 }, // Ē
+    { 18, 27, 21, 2, 26, 122, 26756 }, // ē
+    { 16, 35, 21, 3, 35, 140, 26878 }, // Ĕ
+    { 18, 29, 21, 2, 28, 131, 27018 }, // ĕ
+    { 16, 35, 21, 3, 35, 140, 27149 }, // Ė
+    { 18, 29, 21, 2, 28, 131, 27289 }, // ė
+    { 16, 36, 21, 3, 27, 144, 27420 }, // Ę
+    { 18, 30, 21, 2, 21, 135, 27564 }, // ę
+    { 16, 36, 21, 3, 36, 144, 27699 }, // Ě
+    { 18, 30, 21, 2, 29, 135, 27843 }, // ě
+    { 23, 37, 27, 2, 36, 213, 27978 }, // Ĝ
+    { 18, 38, 23, 2, 29, 171, 28191 }, // ĝ
+    { 23, 36, 27, 2, 35, 207, 28362 }, // Ğ
+    { 18, 37, 23, 2, 28, 167, 28672 }, // ğ
+    { 23, 36, 27, 2, 35, 207, 28839 }, // Ġ
+    { 18, 37, 23, 2, 28, 167, 29046 }, // ġ
+    { 23, 37, 27, 2, 28, 213, 29213 }, // Ģ
+    { 18, 38, 23, 2, 29, 171, 29426 }, // ģ
+    { 22, 36, 28, 3, 36, 198, 29597 }, // Ĥ
+    { 23, 37, 23, -2, 37, 213, 29795 }, // ĥ
+    { 28, 27, 28, 0, 27, 189, 30008 }, // Ħ
+    { 21, 29, 23, 0, 29, 153, 30197 }, // ħ
+    { 15, 35, 13, -1, 35, 132, 30350 }, // Ĩ
+    { 15, 28, 10, -3, 28, 105, 30482 }, // ĩ
+    { 12, 33, 13, 0, 33, 99, 30587 }, // Ī
+    { 12, 26, 10, -1, 26, 78, 30720 }, // ī
+    { 13, 35, 13, 0, 35, 114, 30798 }, // Ĭ
+    { 13, 28, 10, -2, 28, 91, 30912 }, // ĭ
+    { 11, 36, 13, 1, 27, 99, 31003 }, // Į
+    { 7, 37, 10, 1, 28, 65, 31102 }, // į
+    { 11, 35, 13, 1, 35, 97, 31167 }, // İ
+    { 4, 21, 10, 3, 21, 21, 31264 }, // ı
+    { 19, 35, 23, 1, 27, 167, 31285 }, // Ĳ
+    { 15, 37, 19, 2, 28, 139, 31452 }, // ĳ
+    { 15, 44, 10, -3, 36, 165, 31591 }, // Ĵ
+    { 15, 38, 10, -3, 29, 143, 31756 }, // ĵ
+    { 21, 36, 23, 3, 27, 189, 31899 }, // Ķ
+    { 17, 38, 20, 3, 29, 162, 32088 }, // ķ
+    { 17, 21, 20, 3, 21, 90, 32250 }, // ĸ
+    { 16, 36, 20, 3, 36, 144, 32340 }, // Ĺ
+    { 9, 37, 10, 2, 37, 84, 32484 }, // ĺ
+    { 16, 36, 20, 3, 27, 144, 32568 }, // Ļ
+    { 6, 38, 10, 2, 29, 57, 32768 }, // ļ
+    { 16, 27, 20, 3, 27, 108, 32825 }, // Ľ
+    { 10, 29, 10, 3, 29, 73, 32933 }, // ľ
+    { 16, 27, 20, 3, 27, 108, 33006 }, // Ŀ
+    { 9, 29, 10, 3, 29, 66, 33114 }, // ŀ
+    { 19, 27, 20, 0, 27, 129, 33180 }, // Ł
+    { 12, 29, 10, -1, 29, 87, 33309 }, // ł
+    { 22, 36, 29, 3, 36, 198, 33396 }, // Ń
+    { 18, 29, 23, 3, 29, 131, 33594 }, // ń
+    { 22, 36, 29, 3, 27, 198, 33725 }, // Ņ
+    { 18, 30, 23, 3, 21, 135, 33923 }, // ņ
+    { 22, 36, 29, 3, 36, 198, 34058 }, // Ň
+    { 18, 29, 23, 3, 29, 131, 34256 }, // ň
+    { 23, 27, 26, 0, 27, 156, 34387 }, // ŉ
+    { 22, 35, 29, 3, 27, 193, 34543 }, // Ŋ
+    { 18, 30, 23, 3, 21, 135, 34816 }, // ŋ
+    { 25, 34, 29, 2, 33, 213, 34951 }, // Ō
+    { 19, 27, 23, 2, 26, 129, 35164 }, // ō
+    { 25, 36, 29, 2, 35, 225, 35293 }, // Ŏ
+    { 19, 29, 23, 2, 28, 138, 35518 }, // ŏ
+    { 25, 37, 29, 2, 36, 232, 35656 }, // Ő
+    { 19, 30, 23, 2, 29, 143, 35888 }, // ő
+    { 31, 29, 35, 2, 28, 225, 36031 }, // Œ
+    { 32, 22, 35, 2, 21, 176, 36256 }, // œ
+    { 20, 36, 23, 3, 36, 180, 36432 }, // Ŕ
+    { 12, 29, 15, 3, 29, 87, 36612 }, // ŕ
+    { 20, 36, 23, 3, 27, 180, 36864 }, // Ŗ
+    { 13, 30, 15, 2, 21, 98, 37044 }, // ŗ
+    { 20, 36, 23, 3, 36, 180, 37142 }, // Ř
+    { 14, 29, 15, 2, 29, 102, 37322 }, // ř
+    { 18, 37, 21, 1, 36, 167, 37424 }, // Ś
+    { 16, 30, 18, 1, 29, 120, 37591 }, // ś
+    { 18, 37, 21, 1, 36, 167, 37711 }, // Ŝ
+    { 16, 30, 18, 1, 29, 120, 37878 }, // ŝ
+    { 18, 37, 21, 1, 28, 167, 37998 }, // Ş
+    { 16, 30, 18, 1, 21, 120, 38165 }, // ş
+    { 18, 37, 21, 1, 36, 167, 38285 }, // Š
+    { 16, 30, 18, 1, 29, 120, 38452 }, // š
+    { 21, 36, 21, 0, 27, 189, 38572 }, // Ţ
+    { 13, 34, 14, 0, 25, 111, 38761 }, // ţ
+    { 21, 36, 21, 0, 36, 189, 38912 }, // Ť
+    { 18, 30, 14, 0, 29, 135, 39101 }, // ť
+    { 21, 27, 21, 0, 27, 142, 39236 }, // Ŧ
+    { 13, 26, 14, 0, 25, 85, 39378 }, // ŧ
+    { 21, 36, 27, 3, 35, 189, 39463 }, // Ũ
+    { 18, 29, 23, 2, 28, 131, 39652 }, // ũ
+    { 21, 34, 27, 3, 33, 179, 39783 }, // Ū
+    { 18, 27, 23, 2, 26, 122, 39962 }, // ū
+    { 21, 36, 27, 3, 35, 189, 40084 }, // Ŭ
+    { 18, 29, 23, 2, 28, 131, 40273 }, // ŭ
+    { 21, 39, 27, 3, 38, 205, 40404 }, // Ů
+    { 18, 32, 23, 2, 31, 144, 40609 }, // ů
+    { 21, 37, 27, 3, 36, 195, 40753 }, // Ű
+    { 18, 30, 23, 2, 29, 135, 40960 }, // ű
+    { 21, 36, 27, 3, 27, 189, 41095 }, // Ų
+    { 19, 30, 23, 2, 21, 143, 41284 }, // ų
+    { 35, 36, 35, 0, 36, 315, 41427 }, // Ŵ
+    { 30, 29, 29, 0, 29, 218, 41742 }, // ŵ
+    { 22, 36, 21, 0, 36, 198, 41960 }, // Ŷ
+    { 20, 38, 19, 0, 29, 190, 42158 }, // ŷ
+    { 22, 35, 21, 0, 35, 193, 42348 }, // Ÿ
+    { 19, 36, 21, 1, 36, 171, 42541 }, // Ź
+    { 16, 29, 18, 1, 29, 116, 42712 }, // ź
+    { 19, 35, 21, 1, 35, 167, 42828 }, // Ż
+    { 16, 28, 18, 1, 28, 112, 43008 }, // ż
+    { 19, 36, 21, 1, 36, 171, 43120 }, // Ž
+    { 16, 29, 18, 1, 29, 116, 43291 }, // ž
+    { 11, 29, 12, 3, 29, 80, 43407 }, // ſ
+    { 9, 7, 0, -19, 29, 16, 43487 }, // ̀
+    { 9, 7, 0, -13, 29, 16, 43503 }, // ́
+    { 14, 7, 0, -7, 29, 25, 43519 }, // ̂
+    { 15, 6, 0, -19, 28, 23, 43544 }, // ̃
+    { 12, 4, 0, -6, 26, 12, 43567 }, // ̄
+    { 16, 4, 0, -8, 32, 16, 43579 }, // ̅
+    { 12, 6, 0, -6, 28, 18, 43595 }, // ̆
+    { 4, 5, 0, -2, 28, 5, 43613 }, // ̇
+    { 12, 5, 0, -6, 28, 15, 43618 }, // ̈
+    { 7, 9, 0, -14, 31, 16, 43633 }, // ̉
+    { 10, 9, 0, -5, 31, 23, 43649 }, // ̊
+    { 14, 7, 0, -5, 29, 25, 43672 }, // ̋
+    { 14, 7, 0, -7, 29, 25, 43697 }, // ̌
+    { 4, 7, 0, -2, 29, 7, 43722 }, // ̍
+    { 10, 7, 0, -5, 29, 18, 43729 }, // ̎
+    { 15, 7, 0, -20, 29, 27, 43747 }, // ̏
+    { 12, 10, 0, -6, 32, 30, 43774 }, // ̐
+    { 12, 6, 0, -6, 28, 18, 43804 }, // ̑
+    { 6, 10, 0, -3, 27, 15, 43822 }, // ̒
+    { 6, 10, 0, -3, 27, 15, 43837 }, // ̓
+    { 6, 10, 0, -3, 27, 15, 43852 }, // ̔
+    { 6, 10, 0, -3, 27, 15, 43867 }, // ̕
+    { 8, 7, 0, -4, -1, 14, 43882 }, // ̖
+    { 8, 7, 0, -4, -1, 14, 43896 }, // ̗
+    { 8, 8, 0, -4, -1, 16, 43910 }, // ̘
+    { 8, 8, 0, -4, -1, 16, 43926 }, // ̙
+    { 11, 10, 12, 0, 29, 28, 43942 }, // ̚
+    { 9, 9, 0, -4, 29, 21, 43970 }, // ̛
+    { 5, 9, 0, -2, 0, 12, 43991 }, // ̜
+    { 8, 7, 0, -4, -1, 14, 44003 }, // ̝
+    { 8, 7, 0, -4, -1, 14, 44017 }, // ̞
+    { 8, 8, 0, -4, -1, 16, 44031 }, // ̟
+    { 10, 3, 0, -5, -3, 8, 44047 }, // ̠
+    { 7, 11, 0, -7, 2, 20, 44055 }, // ̡
+    { 7, 11, 0, 0, 2, 20, 44075 }, // ̢
+    { 5, 5, 0, -14, -2, 7, 44095 }, // ̣
+    { 12, 5, 0, -6, -2, 15, 44102 }, // ̤
+    { 10, 9, 0, -5, 0, 23, 44117 }, // ̥
+    { 6, 7, 0, -3, -2, 11, 44140 }, // ̦
+    { 8, 9, 0, -4, 0, 18, 44151 }, // ̧
+    { 8, 10, 0, -4, 1, 20, 44169 }, // ̨
+    { 4, 7, 0, -2, -1, 7, 44189 }, // ̩
+    { 14, 8, 0, -7, -1, 28, 44196 }, // ̪
+    { 16, 5, 0, -8, -2, 20, 44224 }, // ̫
+    { 14, 7, 0, -7, -1, 25, 44244 }, // ̬
+    { 14, 7, 0, -7, -1, 25, 44269 }, // ̭
+    { 12, 6, 0, -6, -2, 18, 44294 }, // ̮
+    { 12, 6, 0, -6, -2, 18, 44312 }, // ̯
+    { 14, 6, 0, -7, -2, 21, 44330 }, // ̰
+    { 12, 4, 0, -6, -2, 12, 44351 }, // ̱
+    { 18, 3, 0, -9, -3, 14, 44363 }, // ̲
+    { 16, 9, 0, -8, 0, 36, 44377 }, // ̳
+    { 15, 6, 0, -7, 13, 23, 44413 }, // ̴
+    { 16, 4, 0, -8, 13, 16, 44436 }, // ̵
+    { 28, 3, 0, -14, 12, 21, 44452 }, // ̶
+    { 12, 9, 0, -6, 15, 27, 44473 }, // ̷
+    { 16, 32, 0, -8, 29, 128, 44500 }, // ̸
+    { 5, 9, 0, -2, 0, 12, 44628 }, // ̹
+    { 14, 8, 0, -7, -1, 28, 44640 }, // ̺
+    { 16, 8, 0, -8, -1, 32, 44668 }, // ̻
+    { 16, 5, 0, -8, -2, 20, 44700 }, // ̼
+    { 8, 9, 0, -4, 30, 18, 44720 }, // ̽
+    { 6, 12, 0, -3, 33, 18, 44738 }, // ̾
+    { 16, 9, 0, -8, 37, 36, 44756 }, // ̿
+    { 8, 7, 0, -6, 29, 14, 44792 }, // ̀
+    { 9, 7, 0, -2, 29, 16, 44806 }, // ́
+    { 14, 6, 0, -7, 28, 21, 44822 }, // ͂
+    { 6, 8, 0, -3, 30, 12, 44843 }, // ̓
+    { 14, 8, 0, -6, 30, 28, 44855 }, // ̈́
+    { 6, 6, 0, -2, -3, 9, 44883 }, // ͅ
+    { 18, 7, 0, -9, 29, 32, 44892 }, // ͆
+    { 16, 9, 0, -8, 0, 36, 44924 }, // ͇
+    { 10, 7, 0, -5, -1, 18, 44960 }, // ͈
+    { 8, 7, 0, -4, -2, 14, 44978 }, // ͉
+    { 14, 8, 0, -7, 29, 28, 44992 }, // ͊
+    { 14, 14, 0, -7, 35, 49, 45056 }, // ͋
+    { 14, 11, 0, -7, 33, 39, 45105 }, // ͌
+    { 14, 8, 0, -7, -1, 28, 45144 }, // ͍
+    { 8, 9, 0, -4, 0, 18, 45172 }, // ͎
+    { 28, 27, 0, -14, 27, 189, 45190 }, // ͏
+    { 7, 8, 0, -4, 30, 14, 45379 }, // ͐
+    { 5, 9, 0, -2, 31, 12, 45393 }, // ͑
+    { 12, 10, 0, -6, 32, 30, 45405 }, // ͒
+    { 8, 8, 0, -4, -1, 16, 45435 }, // ͓
+    { 7, 8, 0, -4, -1, 14, 45451 }, // ͔
+    { 7, 8, 0, -4, -1, 14, 45465 }, // ͕
+    { 15, 8, 0, -7, -1, 30, 45479 }, // ͖
+    { 5, 9, 0, -2, 31, 12, 45509 }, // ͗
+    { 5, 5, 0, 4, 28, 7, 45521 }, // ͘
+    { 8, 8, 0, -4, -1, 16, 45528 }, // ͙
+    { 16, 8, 0, -8, -1, 32, 45544 }, // ͚
+    { 8, 8, 0, -4, 30, 16, 45576 }, // ͛
+    { 30, 8, 0, -15, -1, 60, 45592 }, // ͜
+    { 30, 8, 0, -15, 30, 60, 45652 }, // ͝
+    { 24, 3, 0, -12, 26, 18, 45712 }, // ͞
+    { 24, 3, 0, -12, -2, 18, 45730 }, // ͟
+    { 30, 6, 0, -15, 28, 45, 45748 }, // ͠
+    { 30, 8, 0, -15, 32, 60, 45793 }, // ͡
+    { 30, 8, 0, -14, -1, 60, 45853 }, // ͢
+    { 8, 9, 0, -4, 32, 18, 45913 }, // ͣ
+    { 9, 9, 0, -4, 32, 21, 45931 }, // ͤ
+    { 3, 12, 0, -1, 35, 9, 45952 }, // ͥ
+    { 9, 9, 0, -4, 32, 21, 45961 }, // ͦ
+    { 9, 9, 0, -4, 32, 21, 45982 }, // ͧ
+    { 7, 9, 0, -3, 32, 16, 46003 }, // ͨ
+    { 9, 12, 0, -4, 35, 27, 46019 }, // ͩ
+    { 9, 12, 0, -4, 35, 27, 46046 }, // ͪ
+    { 14, 9, 0, -7, 32, 32, 46073 }, // ͫ
+    { 6, 9, 0, -2, 32, 14, 46105 }, // ͬ
+    { 7, 11, 0, -3, 34, 20, 46119 }, // ͭ
+    { 9, 9, 0, -4, 32, 21, 46139 }, // ͮ
+    { 9, 9, 0, -4, 32, 21, 46160 }, // ͯ
+    { 16, 36, 21, 3, 36, 144, 46181 }, // Ѐ
+    { 16, 34, 21, 3, 34, 136, 46325 }, // Ё
+    { 25, 28, 27, 0, 27, 175, 46461 }, // Ђ
+    { 16, 36, 19, 3, 36, 144, 46636 }, // Ѓ
+    { 21, 29, 24, 2, 28, 153, 46780 }, // Є
+    { 18, 29, 21, 1, 28, 131, 46933 }, // Ѕ
+    { 5, 27, 11, 3, 27, 34, 47064 }, // І
+    { 9, 34, 11, 1, 34, 77, 47104 }, // Ї
+    { 10, 35, 10, -3, 27, 88, 47181 }, // Ј
+    { 36, 28, 38, 0, 27, 252, 47269 }, // Љ
+    { 34, 27, 39, 3, 27, 230, 47521 }, // Њ
+    { 25, 27, 27, 0, 27, 169, 47751 }, // Ћ
+    { 21, 36, 23, 3, 36, 189, 47920 }, // Ќ
+    { 22, 36, 28, 3, 36, 198, 48109 }, // Ѝ
+    { 24, 35, 23, 0, 34, 210, 48307 }, // Ў
+    { 21, 33, 27, 3, 27, 174, 48517 }, // Џ
+    { 24, 27, 24, 0, 27, 162, 48691 }, // А
+    { 19, 27, 23, 3, 27, 129, 48853 }, // Б
+    { 20, 27, 24, 3, 27, 135, 48982 }, // В
+    { 16, 27, 19, 3, 27, 108, 49152 }, // Г
+    { 27, 33, 27, 0, 27, 223, 49260 }, // Д
+    { 16, 27, 21, 3, 27, 108, 49483 }, // Е
+    { 34, 27, 34, 0, 27, 230, 49591 }, // Ж
+    { 19, 29, 22, 1, 28, 138, 49821 }, // З
+    { 22, 27, 28, 3, 27, 149, 49959 }, // И
+    { 22, 34, 28, 3, 34, 187, 50108 }, // Й
+    { 21, 27, 23, 3, 27, 142, 50295 }, // К
+    { 23, 28, 26, 0, 27, 161, 50437 }, // Л
+    { 28, 27, 34, 3, 27, 189, 50598 }, // М
+    { 22, 27, 28, 3, 27, 149, 50787 }, // Н
+    { 25, 29, 29, 2, 28, 182, 50936 }, // О
+    { 21, 27, 27, 3, 27, 142, 51200 }, // П
+    { 18, 27, 23, 3, 27, 122, 51342 }, // Р
+    { 21, 29, 24, 2, 28, 153, 51464 }, // С
+    { 21, 27, 21, 0, 27, 142, 51617 }, // Т
+    { 24, 28, 23, 0, 27, 168, 51759 }, // У
+    { 28, 29, 31, 1, 28, 203, 51927 }, // Ф
+    { 22, 27, 22, 0, 27, 149, 52130 }, // Х
+    { 25, 33, 28, 3, 27, 207, 52279 }, // Ц
+    { 20, 27, 25, 2, 27, 135, 52486 }, // Ч
+    { 33, 27, 39, 3, 27, 223, 52621 }, // Ш
+    { 36, 33, 38, 3, 27, 297, 52844 }, // Щ
+    { 24, 27, 26, 0, 27, 162, 53248 }, // Ъ
+    { 26, 27, 32, 3, 27, 176, 53410 }, // Ы
+    { 18, 27, 23, 3, 27, 122, 53586 }, // Ь
+    { 22, 29, 24, 1, 28, 160, 53708 }, // Э
+    { 33, 29, 37, 3, 28, 240, 53868 }, // Ю
+    { 20, 27, 24, 1, 27, 135, 54108 }, // Я
+    { 17, 22, 21, 1, 21, 94, 54243 }, // а
+    { 20, 30, 22, 1, 29, 150, 54337 }, // б
+    { 17, 21, 21, 3, 21, 90, 54487 }, // в
+    { 13, 21, 16, 3, 21, 69, 54577 }, // г
+    { 23, 27, 23, 0, 21, 156, 54646 }, // д
+    { 18, 22, 21, 1, 21, 99, 54802 }, // е
+    { 29, 21, 28, 0, 21, 153, 54901 }, // ж
+    { 16, 22, 18, 1, 21, 88, 55054 }, // з
+    { 18, 21, 23, 3, 21, 95, 55142 }, // и
+    { 18, 28, 23, 3, 28, 126, 55296 }, // й
+    { 17, 21, 20, 3, 21, 90, 55422 }, // к
+    { 19, 22, 22, 0, 21, 105, 55512 }, // л
+    { 23, 21, 29, 3, 21, 121, 55617 }, // м
+    { 17, 21, 23, 3, 21, 90, 55738 }, // н
+    { 20, 22, 22, 1, 21, 110, 55828 }, // о
+    { 17, 21, 23, 3, 21, 90, 55938 }, // п
+    { 18, 30, 23, 3, 21, 135, 56028 }, // р
+    { 16, 22, 18, 1, 21, 88, 56163 }, // с
+    { 17, 21, 17, 0, 21, 90, 56251 }, // т
+    { 20, 30, 19, 0, 21, 150, 56341 }, // у
+    { 25, 38, 28, 1, 29, 238, 56491 }, // ф
+    { 19, 21, 19, 0, 21, 100, 56729 }, // х
+    { 20, 27, 23, 3, 21, 135, 56829 }, // ц
+    { 17, 21, 22, 2, 21, 90, 56964 }, // ч
+    { 28, 21, 34, 3, 21, 147, 57054 }, // ш
+    { 31, 27, 34, 3, 21, 210, 57344 }, // щ
+    { 22, 21, 23, 0, 21, 116, 57554 }, // ъ
+    { 23, 21, 28, 3, 21, 121, 57670 }, // ы
+    { 16, 21, 20, 3, 21, 84, 57791 }, // ь
+    { 16, 22, 19, 1, 21, 88, 57875 }, // э
+    { 26, 22, 30, 3, 21, 143, 57963 }, // ю
+    { 18, 21, 22, 1, 21, 95, 58106 }, // я
+    { 18, 30, 21, 1, 29, 135, 58201 }, // ѐ
+    { 18, 29, 21, 1, 28, 131, 58336 }, // ё
+    { 21, 38, 23, 0, 29, 200, 58467 }, // ђ
+    { 13, 29, 16, 3, 29, 95, 58667 }, // ѓ
+    { 16, 22, 18, 1, 21, 88, 58762 }, // є
+    { 15, 22, 18, 1, 21, 83, 58850 }, // ѕ
+    { 5, 28, 10, 2, 28, 35, 58933 }, // і
+    { 9, 28, 10, 0, 28, 63, 58968 }, // ї
+    { 10, 37, 10, -3, 28, 93, 59031 }, // ј
+    { 31, 22, 32, 0, 21, 171, 59124 }, // љ
+    { 29, 21, 33, 3, 21, 153, 59392 }, // њ
+    { 21, 29, 23, 0, 29, 153, 59545 }, // ћ
+    { 17, 29, 20, 3, 29, 124, 59698 }, // ќ
+    { 18, 29, 23, 3, 29, 131, 59822 }, // ѝ
+    { 20, 37, 19, 0, 28, 185, 59953 }, // ў
+    { 17, 27, 23, 3, 21, 115, 60138 }, // џ
+    { 34, 28, 34, 0, 27, 238, 60253 }, // Ѡ
+    { 29, 21, 30, 0, 21, 153, 60491 }, // ѡ
+    { 24, 27, 25, 0, 27, 162, 60644 }, // Ѣ
+    { 22, 25, 24, 0, 25, 138, 60806 }, // ѣ
+    { 31, 29, 35, 3, 28, 225, 60944 }, // Ѥ
+    { 24, 22, 28, 3, 21, 132, 61169 }, // ѥ
+    { 26, 27, 26, 0, 27, 176, 61440 }, // Ѧ
+    { 22, 21, 21, 0, 21, 116, 61616 }, // ѧ
+    { 32, 27, 35, 3, 27, 216, 61732 }, // Ѩ
+    { 27, 21, 29, 3, 21, 142, 61948 }, // ѩ
+    { 27, 27, 27, 0, 27, 183, 62090 }, // Ѫ
+    { 24, 21, 24, 0, 21, 126, 62273 }, // ѫ
+    { 34, 27, 37, 3, 27, 230, 62399 }, // Ѭ
+    { 29, 21, 32, 3, 21, 153, 62629 }, // ѭ
+    { 19, 41, 22, 1, 32, 195, 62782 }, // Ѯ
+    { 17, 33, 18, 0, 25, 141, 62977 }, // ѯ
+    { 25, 27, 30, 3, 27, 169, 63118 }, // Ѱ
+    { 24, 38, 29, 2, 29, 228, 63488 }, // ѱ
+    { 25, 29, 29, 2, 28, 182, 63716 }, // Ѳ
+    { 19, 22, 23, 2, 21, 105, 63898 }, // ѳ
+    { 25, 27, 24, 0, 27, 169, 64003 }, // Ѵ
+    { 21, 21, 19, 0, 21, 111, 64172 }, // ѵ
+    { 25, 36, 24, 0, 36, 225, 64283 }, // Ѷ
+    { 21, 29, 19, 0, 29, 153, 64508 }, // ѷ
+    { 44, 37, 46, 2, 28, 407, 64661 }, // Ѹ
+    { 40, 30, 41, 2, 21, 300, 65068 }, // ѹ
+    { 27, 32, 31, 2, 29, 216, 65536 }, // Ѻ
+    { 21, 25, 25, 2, 23, 132, 65752 }, // ѻ
+    { 35, 40, 38, 2, 39, 350, 65884 }, // Ѽ
+    { 30, 35, 34, 2, 34, 263, 66234 }, // ѽ
+    { 34, 35, 34, 0, 34, 298, 66497 }, // Ѿ
+    { 29, 27, 30, 0, 27, 196, 66795 }, // ѿ
+    { 22, 37, 24, 2, 28, 204, 66991 }, // Ҁ
+    { 16, 30, 18, 2, 21, 120, 67195 }, // ҁ
+    { 20, 25, 23, 1, 24, 125, 67315 }, // ҂
+    { 15, 6, 0, -18, 27, 23, 67440 }, // ҃
+    { 15, 6, 0, -18, 28, 23, 67463 }, // ҄
+    { 5, 8, 0, -13, 30, 10, 67486 }, // ҅
+    { 5, 8, 0, -13, 30, 10, 67496 }, // ҆
+    { 14, 6, 0, -7, 34, 21, 67506 }, // ҇
+    { 44, 40, 0, -22, 30, 440, 67584 }, // ҈
+    { 42, 42, 0, -21, 31, 441, 68024 }, // ҉
+    { 26, 43, 29, 3, 35, 280, 68465 }, // Ҋ
+    { 22, 36, 25, 3, 29, 198, 68745 }, // ҋ
+    { 22, 27, 23, 0, 27, 149, 68943 }, // Ҍ
+    { 21, 29, 22, 0, 29, 153, 69092 }, // ҍ
+    { 19, 27, 23, 3, 27, 129, 69245 }, // Ҏ
+    { 18, 30, 23, 3, 21, 135, 69374 }, // ҏ
+    { 17, 33, 20, 3, 33, 141, 69632 }, // Ґ
+    { 13, 26, 16, 3, 26, 85, 69773 }, // ґ
+    { 20, 27, 20, 0, 27, 135, 69858 }, // Ғ
+    { 16, 21, 16, 0, 21, 84, 69993 }, // ғ
+    { 21, 37, 24, 3, 27, 195, 70077 }, // Ҕ
+    { 16, 31, 20, 3, 21, 124, 70272 }, // ҕ
+    { 34, 35, 34, 0, 27, 298, 70396 }, // Җ
+    { 30, 28, 30, 0, 21, 210, 70694 }, // җ
+    { 19, 37, 22, 1, 28, 176, 70904 }, // Ҙ
+    { 16, 30, 18, 1, 21, 120, 71080 }, // ҙ
+    { 22, 35, 25, 3, 27, 193, 71200 }, // Қ
+    { 18, 28, 21, 3, 21, 126, 71393 }, // қ
+    { 21, 27, 23, 3, 27, 142, 71519 }, // Ҝ
+    { 17, 21, 20, 3, 21, 90, 71680 }, // ҝ
+    { 24, 27, 23, 0, 27, 162, 71770 }, // Ҟ
+    { 20, 29, 20, 0, 29, 145, 71932 }, // ҟ
+    { 26, 27, 26, 0, 27, 176, 72077 }, // Ҡ
+    { 24, 21, 23, 0, 21, 126, 72253 }, // ҡ
+    { 25, 35, 28, 3, 27, 219, 72379 }, // Ң
+    { 21, 28, 25, 3, 21, 147, 72598 }, // ң
+    { 28, 27, 31, 3, 27, 189, 72745 }, // Ҥ
+    { 25, 21, 28, 3, 21, 132, 72934 }, // ҥ
+    { 36, 37, 40, 3, 27, 333, 73066 }, // Ҧ
+    { 29, 31, 32, 3, 21, 225, 73399 }, // ҧ
+    { 26, 30, 29, 2, 28, 195, 73728 }, // Ҩ
+    { 21, 23, 24, 2, 21, 121, 73923 }, // ҩ
+    { 21, 37, 24, 2, 28, 195, 74044 }, // Ҫ
+    { 15, 30, 18, 2, 21, 113, 74239 }, // ҫ
+    { 21, 35, 21, 0, 27, 184, 74352 }, // Ҭ
+    { 18, 28, 18, 0, 21, 126, 74536 }, // ҭ
+    { 22, 27, 21, 0, 27, 149, 74662 }, // Ү
+    { 20, 30, 19, 0, 21, 150, 74811 }, // ү
+    { 22, 27, 21, 0, 27, 149, 74961 }, // Ұ
+    { 20, 30, 19, 0, 21, 150, 75110 }, // ұ
+    { 24, 35, 24, 0, 27, 210, 75260 }, // Ҳ
+    { 21, 28, 21, 0, 21, 147, 75470 }, // ҳ
+    { 32, 35, 32, 0, 27, 280, 75776 }, // Ҵ
+    { 27, 28, 27, 0, 21, 189, 76056 }, // ҵ
+    { 23, 35, 26, 3, 27, 202, 76245 }, // Ҷ
+    { 21, 28, 23, 2, 21, 147, 76447 }, // ҷ
+    { 20, 27, 26, 3, 27, 135, 76594 }, // Ҹ
+    { 18, 21, 23, 2, 21, 95, 76729 }, // ҹ
+    { 21, 27, 26, 3, 27, 142, 76824 }, // Һ
+    { 18, 29, 23, 3, 29, 131, 76966 }, // һ
+    { 29, 29, 32, 1, 28, 211, 77097 }, // Ҽ
+    { 24, 22, 25, 0, 21, 132, 77308 }, // ҽ
+    { 29, 36, 32, 1, 28, 261, 77440 }, // Ҿ
+    { 24, 28, 25, 0, 21, 168, 77824 }, // ҿ
+    { 11, 27, 13, 1, 27, 75, 77992 }, // Ӏ
+    { 34, 34, 34, 0, 34, 289, 78067 }, // Ӂ
+    { 29, 28, 28, 0, 28, 203, 78356 }, // ӂ
+    { 22, 37, 26, 3, 27, 204, 78559 }, // Ӄ
+    { 17, 31, 21, 3, 21, 132, 78763 }, // ӄ
+    { 27, 35, 27, 0, 27, 237, 78895 }, // Ӆ
+    { 22, 28, 22, 0, 21, 154, 79132 }, // ӆ
+    { 22, 37, 27, 3, 27, 204, 79286 }, // Ӈ
+    { 18, 31, 23, 3, 21, 140, 79490 }, // ӈ
+    { 25, 35, 28, 3, 27, 219, 79630 }, // Ӊ
+    { 22, 28, 25, 3, 21, 154, 79872 }, // ӊ
+    { 20, 35, 26, 3, 27, 175, 80026 }, // Ӌ
+    { 18, 28, 23, 2, 21, 126, 80201 }, // ӌ
+    { 32, 35, 34, 3, 27, 280, 80327 }, // Ӎ
+    { 26, 28, 28, 3, 21, 182, 80607 }, // ӎ
+    { 11, 27, 13, 1, 27, 75, 80789 }, // ӏ
+    { 24, 34, 24, 0, 34, 204, 80864 }, // Ӑ
+    { 17, 29, 21, 1, 28, 124, 81068 }, // ӑ
+    { 24, 35, 24, 0, 35, 210, 81192 }, // Ӓ
+    { 17, 29, 21, 1, 28, 124, 81402 }, // ӓ
+    { 32, 27, 33, -1, 27, 216, 81526 }, // Ӕ
+    { 30, 22, 32, 1, 21, 165, 81742 }, // ӕ
+    { 16, 34, 21, 3, 34, 136, 81920 }, // Ӗ
+    { 18, 29, 21, 2, 28, 131, 82056 }, // ӗ
+    { 24, 29, 28, 2, 28, 174, 82187 }, // Ә
+    { 19, 22, 21, 1, 21, 105, 82361 }, // ә
+    { 24, 36, 28, 2, 35, 216, 82466 }, // Ӛ
+    { 19, 29, 21, 1, 28, 138, 82682 }, // ӛ
+    { 34, 35, 34, 0, 35, 298, 82820 }, // Ӝ
+    { 29, 28, 28, 0, 28, 203, 83118 }, // ӝ
+    { 19, 36, 22, 1, 35, 171, 83321 }, // Ӟ
+    { 16, 29, 18, 1, 28, 116, 83492 }, // ӟ
+    { 19, 28, 22, 1, 27, 133, 83608 }, // Ӡ
+    { 18, 30, 19, 0, 21, 135, 83741 }, // ӡ
+    { 22, 33, 28, 3, 33, 182, 83968 }, // Ӣ
+    { 18, 26, 23, 3, 26, 117, 84150 }, // ӣ
+    { 22, 35, 28, 3, 35, 193, 84267 }, // Ӥ
+    { 18, 28, 23, 3, 28, 126, 84460 }, // ӥ
+    { 25, 36, 29, 2, 35, 225, 84586 }, // Ӧ
+    { 19, 29, 23, 2, 28, 138, 84811 }, // ӧ
+    { 25, 29, 29, 2, 28, 182, 84949 }, // Ө
+    { 19, 22, 23, 2, 21, 105, 85131 }, // ө
+    { 25, 35, 29, 2, 34, 219, 85236 }, // Ӫ
+    { 19, 29, 23, 2, 28, 138, 85455 }, // ӫ
+    { 22, 36, 24, 1, 35, 198, 85593 }, // Ӭ
+    { 16, 29, 19, 1, 28, 116, 85791 }, // ӭ
+    { 24, 34, 23, 0, 33, 204, 86016 }, // Ӯ
+    { 20, 35, 19, 0, 26, 175, 86220 }, // ӯ
+    { 24, 36, 23, 0, 35, 216, 86395 }, // Ӱ
+    { 20, 37, 19, 0, 28, 185, 86611 }, // ӱ
+    { 24, 37, 23, 0, 36, 222, 86796 }, // Ӳ
+    { 20, 38, 19, 0, 29, 190, 87018 }, // ӳ
+    { 20, 35, 25, 2, 35, 175, 87208 }, // Ӵ
+    { 17, 28, 22, 2, 28, 119, 87383 }, // ӵ
+    { 17, 35, 20, 3, 27, 149, 87502 }, // Ӷ
+    { 13, 28, 16, 3, 21, 91, 87651 }, // ӷ
+    { 26, 35, 32, 3, 35, 228, 87742 }, // Ӹ
+    { 23, 28, 28, 3, 28, 161, 88064 }, // ӹ
+    { 20, 35, 20, 0, 27, 175, 88225 }, // Ӻ
+    { 16, 29, 16, 0, 21, 116, 88400 }, // ӻ
+    { 23, 35, 24, 0, 27, 202, 88516 }, // Ӽ
+    { 21, 29, 21, 0, 21, 153, 88718 }, // ӽ
+    { 22, 27, 22, 0, 27, 149, 88871 }, // Ӿ
+    { 20, 21, 20, 0, 21, 105, 89020 }, // ӿ
+    { 0, 0, 19, 0, 0, 0, 89125 }, //  
+    { 0, 0, 38, 0, 0, 0, 89125 }, //  
+    { 0, 0, 19, 0, 0, 0, 89125 }, //  
+    { 0, 0, 38, 0, 0, 0, 89125 }, //  
+    { 0, 0, 12, 0, 0, 0, 89125 }, //  
+    { 0, 0, 9, 0, 0, 0, 89125 }, //  
+    { 0, 0, 6, 0, 0, 0, 89125 }, //  
+    { 0, 0, 21, 0, 0, 0, 89125 }, //  
+    { 0, 0, 10, 0, 0, 0, 89125 }, //  
+    { 0, 0, 6, 0, 0, 0, 89125 }, //  
+    { 0, 0, 4, 0, 0, 0, 89125 }, //  
+    { 0, 0, 0, 0, 0, 0, 89125 }, // ​
+    { 0, 0, 0, 0, 0, 0, 89125 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 89125 }, // ‍
+    { 9, 31, 0, -1, 26, 70, 89125 }, // ‎
+    { 9, 31, 0, -8, 26, 70, 89195 }, // ‏
+    { 10, 4, 12, 1, 12, 10, 89265 }, // ‐
+    { 10, 4, 12, 1, 12, 10, 89275 }, // ‑
+    { 19, 3, 21, 1, 15, 15, 89285 }, // ‒
+    { 17, 4, 19, 1, 12, 17, 89300 }, // –
+    { 35, 4, 38, 1, 12, 35, 89317 }, // —
+    { 35, 4, 38, 1, 12, 35, 89352 }, // ―
+    { 12, 39, 21, 4, 29, 117, 89387 }, // ‖
+    { 17, 9, 15, -1, 0, 39, 89504 }, // ‗
+    { 7, 10, 7, 0, 27, 18, 89543 }, // ‘
+    { 7, 10, 7, 0, 27, 18, 89561 }, // ’
+    { 6, 10, 9, 1, 5, 15, 89579 }, // ‚
+    { 7, 10, 7, 0, 27, 18, 89594 }, // ‛
+    { 14, 10, 13, 0, 27, 35, 89612 }, // “
+    { 14, 10, 13, 0, 27, 35, 89647 }, // ”
+    { 13, 10, 16, 1, 5, 33, 89682 }, // „
+    { 14, 10, 13, 0, 27, 35, 89715 }, // ‟
+    { 15, 29, 19, 2, 29, 109, 89750 }, // †
+    { 15, 29, 19, 2, 29, 109, 89859 }, // ‡
+    { 10, 10, 14, 2, 19, 25, 89968 }, // •
+    { 11, 12, 14, 2, 20, 33, 89993 }, // ‣
+    { 5, 6, 19, 7, 5, 8, 90026 }, // ․
+    { 16, 6, 20, 2, 5, 24, 90034 }, // ‥
+    { 25, 6, 30, 2, 5, 38, 90058 }, // …
+    { 6, 6, 10, 2, 12, 9, 90096 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 90105 }, //  
+    { 0, 0, 23, 0, 0, 0, 90105 }, //  
+    { 9, 28, 0, -1, 23, 63, 90112 }, // ‪
+    { 9, 28, 0, -8, 23, 63, 90175 }, // ‫
+    { 10, 31, 0, -5, 26, 78, 90238 }, // ‬
+    { 10, 31, 0, -5, 26, 78, 90316 }, // ‭
+    { 10, 31, 0, -5, 26, 78, 90394 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 90472 }, //  
+    { 42, 29, 44, 1, 28, 305, 90472 }, // ‰
+    { 56, 29, 58, 1, 28, 406, 90777 }, // ‱
+    { 9, 10, 9, 1, 27, 23, 91183 }, // ′
+    { 16, 10, 15, 1, 27, 40, 91206 }, // ″
+    { 22, 10, 22, 1, 27, 55, 91246 }, // ‴
+    { 9, 10, 9, -1, 27, 23, 91301 }, // ‵
+    { 15, 10, 17, -1, 27, 38, 91324 }, // ‶
+    { 21, 10, 23, -1, 27, 53, 91362 }, // ‷
+    { 15, 13, 15, 0, 4, 49, 91415 }, // ‸
+    { 10, 16, 12, 1, 18, 40, 91464 }, // ‹
+    { 10, 16, 12, 1, 18, 40, 91504 }, // ›
+    { 29, 29, 31, 1, 28, 211, 91544 }, // ※
+    { 14, 28, 19, 2, 27, 98, 91755 }, // ‼
+    { 16, 29, 17, 0, 28, 116, 91853 }, // ‽
+    { 20, 3, 19, -1, 31, 15, 91969 }, // ‾
+    { 22, 8, 23, 0, -1, 44, 91984 }, // ‿
+    { 22, 9, 23, 0, 30, 50, 92028 }, // ⁀
+    { 14, 25, 14, 0, 16, 88, 92160 }, // ⁁
+    { 42, 35, 42, 0, 29, 368, 92248 }, // ⁂
+    { 10, 4, 12, 1, 12, 10, 92616 }, // ⁃
+    { 20, 27, 5, -8, 27, 135, 92626 }, // ⁄
+    { 10, 33, 12, 2, 27, 83, 92761 }, // ⁅
+    { 10, 33, 12, 0, 27, 83, 92844 }, // ⁆
+    { 32, 29, 32, 0, 28, 232, 92927 }, // ⁇
+    { 23, 29, 25, 0, 28, 167, 93159 }, // ⁈
+    { 23, 29, 26, 2, 28, 167, 93326 }, // ⁉
+    { 19, 21, 21, 1, 21, 100, 93493 }, // ⁊
+    { 20, 34, 25, 3, 29, 170, 93593 }, // ⁋
+    { 19, 20, 24, 2, 21, 95, 93763 }, // ⁌
+    { 19, 20, 24, 3, 21, 95, 93858 }, // ⁍
+    { 19, 18, 21, 1, 10, 86, 93953 }, // ⁎
+    { 7, 26, 9, 1, 21, 46, 94039 }, // ⁏
+    { 22, 39, 23, 0, 30, 215, 94208 }, // ⁐
+    { 19, 37, 21, 1, 29, 176, 94423 }, // ⁑
+    { 14, 29, 14, 0, 28, 102, 94599 }, // ⁒
+    { 33, 6, 38, 2, 14, 50, 94701 }, // ⁓
+    { 22, 9, 23, 0, 0, 50, 94751 }, // ⁔
+    { 20, 20, 21, 1, 19, 100, 94801 }, // ⁕
+    { 17, 29, 19, 1, 28, 124, 94901 }, // ⁖
+    { 28, 10, 28, 1, 27, 70, 95025 }, // ⁗
+    { 28, 29, 31, 1, 28, 203, 95095 }, // ⁘
+    { 29, 29, 31, 1, 28, 211, 95298 }, // ⁙
+    { 6, 29, 8, 1, 28, 44, 95509 }, // ⁚
+    { 22, 30, 25, 1, 29, 165, 95553 }, // ⁛
+    { 28, 29, 30, 1, 28, 203, 95718 }, // ⁜
+    { 6, 28, 10, 2, 27, 42, 95921 }, // ⁝
+    { 6, 29, 10, 2, 28, 44, 95963 }, // ⁞
+    { 0, 0, 8, 0, 0, 0, 96007 }, //  
+    { 0, 0, 23, 0, 0, 0, 96007 }, // ⁠
+    { 0, 0, 23, 0, 0, 0, 96007 }, // ⁡
+    { 0, 0, 23, 0, 0, 0, 96007 }, // ⁢
+    { 0, 0, 23, 0, 0, 0, 96007 }, // ⁣
+    { 0, 0, 23, 0, 0, 0, 96007 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 96007 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 96007 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 96007 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 96007 }, // ⁩
+    { 10, 31, 0, -5, 26, 78, 96007 }, // ⁪
+    { 10, 31, 0, -5, 26, 78, 96085 }, // ⁫
+    { 10, 31, 0, -5, 26, 78, 96163 }, // ⁬
+    { 10, 31, 0, -5, 26, 78, 96256 }, // ⁭
+    { 10, 31, 0, -5, 26, 78, 96334 }, // ⁮
+    { 10, 31, 0, -5, 26, 78, 96412 }, // ⁯
+    { 13, 17, 13, 0, 32, 56, 96490 }, // ⁰
+    { 4, 18, 6, 1, 28, 18, 96546 }, // ⁱ
+    { 13, 17, 13, 0, 32, 56, 96564 }, // ⁴
+    { 11, 17, 13, 1, 32, 47, 96620 }, // ⁵
+    { 13, 17, 13, 0, 32, 56, 96667 }, // ⁶
+    { 12, 17, 13, 1, 32, 51, 96723 }, // ⁷
+    { 13, 17, 13, 0, 32, 56, 96774 }, // ⁸
+    { 13, 18, 13, 0, 33, 59, 96830 }, // ⁹
+    { 11, 11, 13, 1, 28, 31, 96889 }, // ⁺
+    { 11, 3, 13, 1, 24, 9, 96920 }, // ⁻
+    { 11, 7, 13, 1, 26, 20, 96929 }, // ⁼
+    { 7, 22, 8, 2, 35, 39, 96949 }, // ⁽
+    { 7, 22, 8, 0, 35, 39, 96988 }, // ⁾
+    { 12, 14, 15, 2, 24, 42, 97027 }, // ⁿ
+    { 13, 17, 13, 0, 12, 56, 97069 }, // ₀
+    { 8, 17, 13, 1, 12, 34, 97125 }, // ₁
+    { 12, 17, 13, 0, 12, 51, 97159 }, // ₂
+    { 13, 17, 13, 0, 12, 56, 97210 }, // ₃
+    { 13, 17, 13, 0, 12, 56, 97266 }, // ₄
+    { 11, 17, 13, 1, 12, 47, 97322 }, // ₅
+    { 13, 17, 13, 0, 12, 56, 97369 }, // ₆
+    { 12, 17, 13, 1, 12, 51, 97425 }, // ₇
+    { 13, 17, 13, 0, 12, 56, 97476 }, // ₈
+    { 13, 18, 13, 0, 13, 59, 97532 }, // ₉
+    { 11, 11, 13, 1, 8, 31, 97591 }, // ₊
+    { 11, 3, 13, 1, 4, 9, 97622 }, // ₋
+    { 11, 7, 13, 1, 6, 20, 97631 }, // ₌
+    { 7, 22, 8, 2, 14, 39, 97651 }, // ₍
+    { 7, 22, 8, 0, 14, 39, 97690 }, // ₎
+    { 11, 13, 14, 1, 9, 36, 97729 }, // ₐ
+    { 12, 13, 14, 1, 9, 39, 97765 }, // ₑ
+    { 13, 13, 15, 1, 9, 43, 97804 }, // ₒ
+    { 13, 13, 13, 0, 9, 43, 97847 }, // ₓ
+    { 12, 13, 14, 1, 9, 39, 97890 }, // ₔ
+    { 12, 18, 15, 2, 14, 54, 97929 }, // ₕ
+    { 11, 18, 13, 2, 14, 50, 97983 }, // ₖ
+    { 3, 18, 6, 2, 14, 14, 98033 }, // ₗ
+    { 19, 13, 23, 2, 9, 62, 98047 }, // ₘ
+    { 12, 13, 15, 2, 9, 39, 98109 }, // ₙ
+    { 12, 18, 15, 2, 9, 54, 98148 }, // ₚ
+    { 10, 13, 12, 1, 9, 33, 98202 }, // ₛ
+    { 9, 16, 9, 0, 12, 36, 98235 }, // ₜ
+    { 20, 28, 21, 1, 28, 140, 98304 }, // ₠
+    { 20, 32, 21, 1, 29, 160, 98444 }, // ₡
+    { 19, 29, 21, 2, 28, 138, 98604 }, // ₢
+    { 19, 27, 21, 1, 27, 129, 98742 }, // ₣
+    { 20, 28, 21, 1, 28, 140, 98871 }, // ₤
+    { 30, 30, 35, 3, 25, 225, 99011 }, // ₥
+    { 22, 27, 21, 0, 27, 149, 99236 }, // ₦
+    { 26, 28, 29, 2, 27, 182, 99385 }, // ₧
+    { 27, 28, 31, 3, 27, 189, 99567 }, // ₨
+    { 25, 27, 25, 0, 27, 169, 99756 }, // ₩
+    { 24, 27, 30, 3, 27, 162, 99925 }, // ₪
+    { 21, 35, 23, 2, 29, 184, 100087 }, // ₫
+    { 21, 29, 21, 0, 28, 153, 100352 }, // €
+    { 22, 27, 21, 0, 27, 149, 100505 }, // ₭
+    { 21, 27, 21, 0, 27, 142, 100654 }, // ₮
+    { 36, 37, 36, 0, 28, 333, 100796 }, // ₯
+    { 20, 37, 21, 0, 28, 185, 101129 }, // ₰
+    { 22, 27, 21, 0, 27, 149, 101314 }, // ₱
+    { 23, 32, 27, 2, 29, 184, 101463 }, // ₲
+    { 23, 27, 23, 0, 27, 156, 101647 }, // ₳
+    { 21, 29, 21, 0, 28, 153, 101803 }, // ₴
+    { 21, 32, 24, 2, 29, 168, 101956 }, // ₵
+    { 23, 26, 23, 0, 25, 150, 102124 }, // ₶
+    { 26, 31, 27, 0, 28, 202, 102400 }, // ₷
+    { 20, 27, 20, 0, 27, 135, 102602 }, // ₸
+    { 17, 27, 21, 2, 27, 115, 102737 }, // ₹
+    { 21, 28, 21, 0, 27, 147, 102852 }, // ₺
+    { 29, 29, 29, 0, 28, 211, 102999 }, // ₻
+    { 26, 27, 30, 2, 27, 176, 103210 }, // ₼
+    { 21, 27, 22, 0, 27, 142, 103386 }, // ₽
+    { 25, 29, 29, 2, 29, 182, 103528 }, // ₾
+    { 18, 35, 21, 3, 31, 158, 103710 }, // ₿
+    { 16, 27, 18, 1, 21, 108, 103868 }, // ⃀
+    { 19, 4, 21, 1, 15, 19, 103976 }, // −
+    { 35, 35, 38, 1, 29, 307, 103995 }, // �
 };
 
 static const EpdUnicodeInterval notosans_18_regularIntervals[] = {
@@ -7207,4 +3770,9 @@ static const EpdFontData notosans_18_regular = {
     41,
     -11,
     true,
+    notosans_18_regularBlockOffsets,
+    notosans_18_regularDirectGlyphs,
+    notosans_18_regularGlyphPages,
+    256,
+    notosans_18_regularPageGlyphs,
 };
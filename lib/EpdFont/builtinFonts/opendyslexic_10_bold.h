@@ -2,2721 +2,1606 @@
  * generated by fontconvert.py
  * name: opendyslexic_10_bold
  * size: 10
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_bold 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_10_bold 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_boldBitmaps[43321] = {
-    0x00, 0x00, 0x14, 0x00, 0x74, 0x01, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0xC0,
-    0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0x7F, 0x00, 0xFC, 0x00, 0xB0, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x03, 0xFD, 0x0F, 0xF8, 0x3F, 0xE1, 0xFF, 0xCB, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xE3, 0xFD, 0x1F, 0xF4, 0xFF, 0x07, 0xFC, 0x3F, 0xC1, 0xFF,
-    0x0F, 0xF0, 0x7F, 0xC3, 0xFC, 0x1F, 0xF0, 0xFF, 0x07, 0xFC, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00,
-    0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xE0,
-    0x00, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x2F,
-    0xC1, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x07, 0xF4,
-    0x00, 0x00, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x1B, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xDF, 0x84,
-    0x00, 0x0B, 0xF0, 0xF8, 0x00, 0x00, 0xBF, 0x4F, 0x40, 0x00, 0x07, 0xFE, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0x4F, 0xFC, 0x02, 0x91, 0xF4, 0x3F, 0xD0, 0xBF, 0xFF, 0x5F, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x01, 0x50, 0x00, 0x3E, 0x00, 0xFF, 0x80, 0x0B, 0xC0,
-    0x2D, 0x2D, 0x01, 0xF8, 0x03, 0xC0, 0xE0, 0x3F, 0x00, 0x3C, 0x0F, 0x0B, 0xD0, 0x03, 0xD1, 0xE0,
-    0xFC, 0x00, 0x2F, 0xFD, 0x2F, 0x00, 0x00, 0xFF, 0x87, 0xE0, 0x00, 0x01, 0x50, 0xFC, 0x7F, 0x40,
-    0x00, 0x2F, 0x9F, 0xBD, 0x00, 0x03, 0xF2, 0xC0, 0xF0, 0x00, 0xFD, 0x3C, 0x0F, 0x00, 0x1F, 0xC3,
-    0xD1, 0xF0, 0x03, 0xF4, 0x2F, 0xFE, 0x00, 0xBE, 0x00, 0xFF, 0xC0, 0x1F, 0xC0, 0x01, 0x50, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x3D, 0x01, 0xF0, 0x00,
-    0x3C, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x1F, 0xEF, 0xE0, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0xF8, 0x3F, 0x4B, 0xE0, 0xFC,
-    0x7F, 0x01, 0xFE, 0xF8, 0x7F, 0x80, 0x7F, 0xF0, 0x7F, 0xFA, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFD, 0xF0, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xCF, 0xF4, 0xFF, 0x4F,
-    0xF4, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x03, 0xF4, 0x01,
-    0xFC, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F,
-    0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0xFD,
-    0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x01, 0xFF, 0x00, 0x3F,
-    0xD0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x07,
-    0xF0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x0F, 0xD0, 0x0B, 0xF0, 0x03, 0xFC, 0x02, 0xFD,
-    0x01, 0xFF, 0x00, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03,
-    0xE0, 0x50, 0x3C, 0xF8, 0xF8, 0x3F, 0xFF, 0xFE, 0x06, 0xFF, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF8, 0x2F, 0xFF, 0xBF, 0x03, 0xCB, 0xC7, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xEA, 0xBF, 0xAA, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0xBF, 0xD2, 0xFF, 0x07, 0xFC, 0x2F, 0xD0, 0xFF, 0x07, 0xFC, 0x3F, 0xE0, 0x15, 0x55,
-    0x56, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x1A, 0x0F, 0xE3, 0xF9, 0xFF, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0xFF, 0xFD, 0x00, 0xFD, 0x0F, 0xC0, 0x7E, 0x01, 0xF8, 0x2F, 0x44, 0x3F, 0x0F, 0xCB, 0xCF, 0xC3,
-    0xF3, 0xF2, 0xF0, 0xFC, 0xFC, 0xFD, 0x3F, 0x3F, 0x3F, 0x4F, 0xD7, 0x8F, 0xD3, 0xF8, 0x07, 0xF0,
-    0xFF, 0x47, 0xFC, 0x2F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0xAC, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x14,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x16, 0xFE, 0x54, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE,
-    0x06, 0xFF, 0x40, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0xF4, 0x07, 0xF4, 0x10, 0x00, 0xBE,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFD, 0x00, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xA9, 0x0B, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x00, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0xA4, 0x02,
-    0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x07, 0xFF, 0xE0, 0x02, 0xFF,
-    0xF4, 0x00, 0xAF, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x0E, 0x45, 0xFF, 0x07, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x3E, 0xF4, 0x00, 0x3E, 0x7E, 0x00,
-    0x2F, 0x1F, 0x80, 0x1F, 0x47, 0xE0, 0x0F, 0x82, 0xF8, 0x0F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA4, 0x2F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xE9, 0x40, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x10,
-    0x01, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x1E, 0x57, 0xFE, 0x2F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xF0, 0x0B, 0xFE, 0x40, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFF,
-    0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC6, 0x90, 0x03, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xD0, 0xFF, 0x0F, 0xE0, 0x0F, 0xC3, 0xF4, 0x03, 0xF4, 0xFE, 0x00, 0xFD, 0x3F, 0xD1,
-    0xFF, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xC0, 0x06, 0xFF, 0x40, 0x2A, 0xAA, 0xA5, 0x3F, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xFF,
-    0xFF, 0x00, 0xFD, 0x1F, 0xE0, 0x7E, 0x00, 0xFC, 0x1F, 0x80, 0x3F, 0x07, 0xF0, 0x2F, 0xC0, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x0B, 0xF4, 0x2F, 0xC3, 0xF4, 0x03, 0xF8, 0xFC,
-    0x00, 0xBE, 0x3F, 0xD0, 0xBF, 0x8F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x00,
-    0x59, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0xBD, 0x07, 0xF4,
-    0x3E, 0x00, 0x3E, 0x0F, 0x00, 0x0F, 0xC3, 0xC0, 0x02, 0xF0, 0xF4, 0x00, 0xFD, 0x3F, 0x40, 0xBF,
-    0x47, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF4, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x06, 0x50, 0x2F,
-    0xC2, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83,
-    0xFC, 0x3F, 0xC7, 0xFC, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC3, 0xFC,
-    0x7F, 0xCB, 0xFD, 0x0F, 0xE0, 0x3F, 0x81, 0xFF, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x51, 0xFF, 0x83, 0xFC, 0x0F, 0xF0, 0xBF, 0x83, 0xFD, 0x0F, 0xF0, 0x6A,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01,
-    0xBF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x06, 0xFF, 0xFF, 0xF0,
-    0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x90, 0x05, 0x6A, 0xA8,
-    0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x06, 0xFF, 0xF8, 0x06, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFE,
-    0x40, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x90, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x03, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xD0, 0x3F, 0xD0, 0xBF, 0x00, 0xD0,
-    0x02, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xC0,
-    0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0x3E, 0xD0, 0x78, 0x03,
-    0xE0, 0xF7, 0xE0, 0x3C, 0x03, 0xD0, 0xC0, 0xE0, 0x3C, 0x07, 0xD1, 0xC0, 0xE0, 0x3C, 0x07, 0xD1,
-    0xC1, 0xF0, 0xB4, 0x07, 0xF0, 0xFF, 0xF1, 0xF0, 0x03, 0xF4, 0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x00,
-    0x2E, 0x00, 0x01, 0xFF, 0x80, 0x06, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00,
-    0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE,
-    0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0xBF, 0xFF, 0x90, 0x0B,
-    0xFF, 0xFF, 0x80, 0xBF, 0xAB, 0xFD, 0x0B, 0xF0, 0x07, 0xF0, 0xBF, 0x00, 0x3F, 0x0B, 0xF0, 0x03,
-    0xF0, 0xBF, 0x00, 0xBF, 0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xF4, 0xBF,
-    0x00, 0x7F, 0xCB, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x1F, 0xEB, 0xFA, 0xAB, 0xFD, 0xBF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F,
-    0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0xBF, 0xFF, 0xE4, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xFF, 0xD0, 0xBF, 0xAA, 0xFF, 0xF0, 0xBF, 0x00, 0x0F, 0xF8, 0xBF, 0x00, 0x03, 0xFC, 0xBF,
-    0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF,
-    0x00, 0x00, 0xFD, 0xBF, 0x00, 0x02, 0xFD, 0xBF, 0x00, 0x6F, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF9, 0x00, 0x2A,
-    0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07,
-    0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xAA, 0xA0, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40,
-    0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFD, 0x00, 0x18, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xE9, 0x40, 0xBF, 0x80, 0x1F,
-    0xFF, 0xCB, 0xF8, 0x00, 0xFF, 0xFD, 0x7F, 0xC0, 0x05, 0xBF, 0xE3, 0xFE, 0x00, 0x03, 0xF4, 0x3F,
-    0xFE, 0x55, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40,
-    0x03, 0xFC, 0x3F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80,
-    0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFD, 0xBF, 0xEA,
-    0xAB, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0x7F, 0x5F,
-    0xD7, 0xF5, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x5F, 0xE7,
-    0xF9, 0xFE, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x09, 0x02, 0xFE, 0x03,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x7F, 0xC0, 0x0F, 0xE0, 0xFF, 0x40, 0x0F, 0xD1, 0xFF, 0x00, 0x0F, 0xD3, 0xFC, 0x00,
-    0x0F, 0xCB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0x9F, 0xFE, 0x00, 0x7F, 0x8B, 0xFF, 0x80,
-    0x7F, 0x83, 0xFF, 0xF0, 0xBF, 0x80, 0xFF, 0xFC, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xE0, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xF4, 0x00, 0xFF,
-    0xC3, 0xFF, 0x80, 0x1F, 0xFD, 0x3F, 0xFC, 0x03, 0xFF, 0xD3, 0xFF, 0xE0, 0x3F, 0xFD, 0x3F, 0xFF,
-    0x0B, 0xFF, 0xD7, 0xFF, 0xF4, 0xFF, 0xFD, 0x7F, 0xBF, 0x9F, 0xEF, 0xD7, 0xF7, 0xFF, 0xFD, 0xFE,
-    0x7F, 0x6F, 0xFF, 0xDF, 0xE7, 0xF5, 0xFF, 0xF9, 0xFE, 0x7F, 0x4F, 0xFF, 0x2F, 0xE7, 0xF8, 0xBF,
-    0xF2, 0xFE, 0xBF, 0x87, 0xFE, 0x3F, 0xEB, 0xF8, 0x3F, 0xD3, 0xFF, 0xBF, 0xC2, 0xFC, 0x3F, 0xFB,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC,
-    0x1F, 0xF8, 0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC,
-    0x3F, 0xFF, 0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8,
-    0x3F, 0xD3, 0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4,
-    0x7F, 0xD0, 0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x00, 0x1B, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0,
-    0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC,
-    0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00,
-    0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xA9, 0x40, 0x0B, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xD0, 0xFD, 0x01, 0xFC, 0x3F,
-    0x40, 0x2F, 0x4F, 0xD0, 0x0B, 0xE3, 0xF4, 0x07, 0xF8, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x01, 0xFF, 0x94, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07,
-    0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00,
-    0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x2F, 0xC0,
-    0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x03,
-    0xF8, 0x3F, 0xC0, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0xA0, 0x7F, 0x41, 0xFF, 0x03, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x0A, 0xAA, 0x80, 0x2F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0x55, 0xFC,
-    0x02, 0xF0, 0x03, 0xE0, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xF5,
-    0x5F, 0xE0, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x1F, 0xE0,
-    0x7F, 0xC0, 0xBF, 0x07, 0xFC, 0x0B, 0xF4, 0x7F, 0xC0, 0xBF, 0x87, 0xFC, 0x0B, 0xFC, 0xBF, 0xC0,
-    0xBF, 0xD7, 0xFC, 0x0B, 0xFE, 0x00, 0x2B, 0xFE, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x07, 0x90, 0x02, 0xFF, 0x0F, 0xFE, 0x9B,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07,
-    0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03,
-    0xF8, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0xC0,
-    0x00, 0x7F, 0x42, 0xFD, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x2F, 0xD0,
-    0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x2F, 0xE1,
-    0xFF, 0x00, 0x01, 0xFF, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x02, 0xA8, 0x7F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xF0, 0x0B, 0xD0, 0x0F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF0,
-    0x0F, 0xF4, 0x2F, 0xF4, 0x2F, 0xE0, 0x0F, 0xF4, 0x3F, 0xFC, 0x3F, 0xD0, 0x0B, 0xF8, 0xBF, 0xFD,
-    0x3F, 0xC0, 0x07, 0xFC, 0xFF, 0xFF, 0x7F, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xBF, 0x80, 0x03, 0xFF,
-    0xFE, 0xBF, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0x00,
-    0x01, 0xFF, 0xF4, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x0F,
-    0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x7F, 0x40, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x1F, 0xD0, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xDF, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x3F, 0xE1,
-    0xFF, 0x80, 0x3F, 0xF0, 0x3F, 0xF4, 0x2F, 0xF4, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0xBF, 0xE0, 0x7F,
-    0x40, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xD0,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x03, 0xFE, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xEA, 0xA9, 0x0B, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1A, 0xA9, 0x2F, 0xFE, 0x2F, 0xFE, 0x2F,
-    0x40, 0x2F, 0x40, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E,
-    0x00, 0xBE, 0x00, 0xBE, 0x00, 0xBE, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xFF, 0xA8, 0xFF,
-    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xF8,
-    0x00, 0xFC, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B,
-    0xE0, 0x07, 0xF0, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0xBD, 0x00,
-    0x3C, 0x00, 0x38, 0x00, 0x20, 0x00, 0x00, 0xAA, 0xA0, 0xFF, 0xF4, 0xFF, 0xF4, 0x02, 0xF4, 0x02,
-    0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x00,
-    0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0xFD, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBE, 0x2A, 0xFE, 0x3F, 0xFE, 0x3F,
-    0xFE, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF,
-    0xC0, 0x0F, 0xE7, 0xF0, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF8, 0x00,
-    0x3F, 0x80, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8,
-    0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0xA9, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xDB,
-    0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x0F, 0xF4, 0x1F, 0x03, 0xF8, 0x03, 0xE0, 0xFD,
-    0x00, 0xBC, 0x3F, 0x40, 0x2F, 0x0F, 0xE0, 0x1F, 0xC3, 0xFF, 0xAF, 0xF0, 0xBF, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0xFF,
-    0xFC, 0x0B, 0xFE, 0xF0, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xBE,
-    0x00, 0x01, 0xFD, 0x04, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x02, 0xBF, 0x80, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x1F, 0xE3, 0xF0, 0x2F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0x87, 0xC0, 0x1F,
-    0xE2, 0xF0, 0x03, 0xF8, 0xFC, 0x00, 0xFE, 0x2F, 0x40, 0xBF, 0x87, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFE, 0x00, 0xBF, 0x9F, 0xC0, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81,
-    0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x01, 0xFF, 0x01, 0xFF,
-    0xC0, 0xFF, 0xA0, 0x3F, 0x00, 0x0F, 0x80, 0x3F, 0xFF, 0xCF, 0xFF, 0xF3, 0xFF, 0xFC, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0x7F, 0x40,
-    0x1F, 0xD0, 0x00, 0x02, 0xFD, 0x7E, 0x0F, 0xFF, 0xFE, 0x3F, 0xAF, 0xFE, 0x7D, 0x03, 0xFE, 0xB8,
-    0x02, 0xFE, 0xB8, 0x01, 0xFD, 0xF4, 0x01, 0xFD, 0xB8, 0x01, 0xFD, 0xBD, 0x07, 0xFD, 0x7F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0xFC, 0x18, 0x07, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x2F, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF7, 0xFD, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFB, 0xFC, 0x0F, 0xE0, 0x1F, 0x47, 0xF0, 0x03, 0xE1,
-    0xFC, 0x00, 0xF8, 0x7F, 0x00, 0x3F, 0x2F, 0xC0, 0x0F, 0xCB, 0xF0, 0x07, 0xF2, 0xFC, 0x02, 0xFC,
-    0xBF, 0x40, 0xBF, 0x3F, 0xD0, 0x3F, 0xC0, 0x2F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x2A, 0x80, 0x00,
-    0x00, 0x01, 0xA0, 0x1F, 0x41, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F,
-    0x83, 0xF8, 0x3F, 0xC0, 0x00, 0x54, 0x00, 0xF8, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF4, 0x01, 0xF4,
-    0x01, 0xF4, 0x01, 0xF4, 0x01, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xF0, 0x07, 0xF0, 0x7F, 0xF0,
-    0x7F, 0xE0, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xBE, 0x00,
-    0x3E, 0xBF, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xF4, 0x00,
-    0x2F, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x02, 0xF9, 0xFF, 0x80, 0xBF, 0x2F, 0xFC, 0x3F, 0xC3, 0xFF,
-    0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x40, 0xBD,
-    0x02, 0xF4, 0x0B, 0xD0, 0x2F, 0x40, 0xBD, 0x02, 0xF4, 0x0F, 0xD0, 0x3F, 0xF8, 0xFF, 0xF3, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xAF, 0xD0, 0x7F, 0x40, 0x2F, 0xFF, 0xF9, 0xFF, 0xE0,
-    0x2F, 0xFA, 0xFF, 0xEB, 0xF4, 0x3F, 0xC0, 0x7F, 0x80, 0xFC, 0x3F, 0x80, 0x3F, 0x40, 0xFC, 0x3F,
-    0x40, 0x3F, 0x00, 0xFC, 0x3F, 0x40, 0x7F, 0x00, 0xFC, 0x7F, 0x40, 0xBF, 0x00, 0xFC, 0x7F, 0x00,
-    0xFE, 0x01, 0xFC, 0xBF, 0x00, 0xFE, 0x01, 0xFD, 0xBF, 0x00, 0xFD, 0x01, 0xFD, 0xFF, 0x01, 0xFD,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40,
-    0xBC, 0x7F, 0x00, 0x7D, 0x7E, 0x00, 0x7D, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE,
-    0xBF, 0x00, 0xFF, 0xBF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F,
-    0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41,
-    0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x01, 0x40,
-    0x01, 0xFA, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xC1, 0xF4, 0x0F, 0xF0, 0x07, 0xC0, 0xFF,
-    0x00, 0x3C, 0x0F, 0xF0, 0x03, 0xC0, 0xFF, 0x00, 0x3D, 0x0F, 0xF0, 0x07, 0xC0, 0xFF, 0xE6, 0xFC,
-    0x1F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0x03, 0xF8, 0x69, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x0B, 0xEB, 0xFF, 0x80, 0x7C,
-    0x03, 0xFD, 0x02, 0xF0, 0x07, 0xF4, 0x0B, 0x80, 0x1F, 0xD0, 0x3E, 0x00, 0x3F, 0x00, 0xB8, 0x01,
-    0xFC, 0x02, 0xF4, 0x0F, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFB, 0xF1, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x03, 0xE4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2F, 0xAF, 0x4B, 0xFF, 0xE3, 0xFF, 0xF8, 0xFF,
-    0x40, 0x3F, 0x80, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x1F, 0xE0, 0x0B, 0xFC,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40, 0x50, 0x0F,
-    0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0x95,
-    0xFE, 0x3F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
-    0x1A, 0xFE, 0xA8, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00,
-    0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE,
-    0x07, 0xFE, 0xFE, 0xBE, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0x82, 0xF8, 0x00, 0xFC, 0x03, 0xF0,
-    0x0B, 0xE0, 0x0F, 0xE0, 0x3F, 0x40, 0x1F, 0xD2, 0xFC, 0x00, 0x3F, 0xCF, 0xD0, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0xBE, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x0F, 0xE3, 0xF0, 0x05, 0x03, 0xF4, 0xFD, 0x0F, 0xC1,
-    0xFC, 0x2F, 0x8B, 0xF8, 0xBE, 0x07, 0xF3, 0xFF, 0x3F, 0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xEF, 0xFD, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x0F,
-    0xF4, 0x7F, 0xC0, 0x01, 0xA4, 0x06, 0x90, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F, 0xD0, 0xFD, 0x00,
-    0x2F, 0xCF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x2F, 0xE3, 0xFD, 0x02, 0xFF, 0x03,
-    0xFC, 0x1F, 0xF0, 0x0B, 0xFC, 0xBF, 0x00, 0x0F, 0xC3, 0xF4, 0x02, 0xF8, 0x2F, 0xC0, 0x3F, 0x40,
-    0xFD, 0x03, 0xF0, 0x0B, 0xF0, 0x7E, 0x00, 0x3F, 0x8F, 0xD0, 0x02, 0xFD, 0xFC, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x1A, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x6A, 0xBF, 0xE0, 0x00, 0x1F,
-    0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0,
-    0x00, 0x1F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x02, 0xFF,
-    0xD0, 0x0F, 0xFA, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x05, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xFE, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x7D,
-    0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3F, 0xE0, 0x00, 0xBF, 0xF0, 0x01, 0xAF, 0xE0,
-    0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F,
-    0xF8, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x3F, 0xFD, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x1D, 0x7F, 0x9E, 0xB7, 0xDE, 0xF1, 0xFC, 0x60, 0x64, 0x7F, 0xF0, 0xFF, 0xC3,
-    0xFF, 0x0B, 0xFC, 0x2F, 0xE0, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0xB0, 0x0B, 0xD0, 0x3F, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x2F, 0x40, 0xBD, 0x02, 0xF4, 0x07,
-    0xD0, 0x1F, 0x40, 0x7D, 0x00, 0xF4, 0x03, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xFF, 0x03, 0xFF, 0xEC, 0x1F,
-    0xCF, 0x00, 0xBE, 0x3C, 0x02, 0xF4, 0xE0, 0x0F, 0xD3, 0x80, 0x2F, 0x8E, 0x00, 0xBF, 0x79, 0x00,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xE4, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0x9B,
-    0xF0, 0x0B, 0xC0, 0x09, 0x00, 0xB8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFA, 0x03, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x34, 0x03, 0xD0, 0x0F, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x00, 0xBE, 0x0F, 0xD0, 0x0B, 0xD0, 0xBE, 0x00, 0xBF,
-    0x0F, 0xE0, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xC0, 0xF9, 0x96, 0xF0,
-    0x01, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x54, 0x2F, 0xC0, 0x03, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x03, 0xFC, 0x3F, 0xC0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0A, 0xAF, 0xFE, 0x80,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xC0,
-    0x0A, 0xAF, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0xF3, 0xDF, 0x7D, 0xF6, 0x40, 0x00, 0x03, 0xAE, 0xBA, 0xEB, 0xAD, 0xB6, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x07, 0xC0, 0xB4, 0x0B, 0xC0, 0x20, 0x07, 0xFE,
-    0x40, 0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x0F, 0x40, 0xFC, 0x1F, 0x95, 0xFC, 0x0F, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xF4, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x04, 0x00, 0xFC, 0x1F, 0xE6, 0xFC, 0x3F,
-    0xFF, 0xF4, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0xBF,
-    0x5F, 0xF2, 0xFE, 0x6A, 0x86, 0xA4, 0x02, 0xF8, 0x01, 0xFF, 0xF0, 0x3D, 0x07, 0xC7, 0x9F, 0x2D,
-    0x77, 0x41, 0xD7, 0x9F, 0x2D, 0x3D, 0x07, 0xC1, 0xFF, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2E,
-    0xC2, 0xDB, 0x4D, 0x0D, 0x30, 0x38, 0xFF, 0xE0, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0C,
-    0x00, 0xB4, 0x3C, 0x03, 0xF1, 0xFC, 0x1F, 0xDB, 0xF0, 0x7F, 0x2F, 0x80, 0xBE, 0x3F, 0x40, 0x7F,
-    0xAF, 0xD0, 0x1F, 0xEB, 0xF4, 0x07, 0xF2, 0xF8, 0x00, 0xE0, 0xB4, 0x00, 0x10, 0x10, 0xFE, 0xA5,
-    0x43, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x40, 0x01, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x40, 0x01, 0xA4, 0x00,
-    0xFF, 0xF0, 0x3F, 0xEB, 0xC7, 0xA1, 0x6D, 0x76, 0xF5, 0xD7, 0xAA, 0x5D, 0x3F, 0xAF, 0xC1, 0xFF,
-    0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0xBF, 0xE0, 0x2F, 0xFF, 0x83, 0xF0, 0xFC, 0x7E, 0x07, 0xD7, 0xF0, 0xFD, 0x3F, 0xFF, 0xC1,
-    0xFF, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x2F, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x15, 0x54, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0x83, 0x5D, 0x00, 0xE0, 0x0D, 0x07, 0xC1, 0xF4, 0x3F, 0xF2, 0xA9, 0x2F, 0xC0, 0x52,
-    0xC0, 0x0B, 0x03, 0xF4, 0x05, 0xF0, 0x42, 0xC3, 0xFF, 0x0B, 0xF4, 0x07, 0xC0, 0xF8, 0x1F, 0x43,
-    0xF0, 0x14, 0x00, 0x3F, 0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0xD7, 0xF0, 0x03, 0xF5, 0xFC, 0x00, 0xFD,
-    0x7F, 0x00, 0x3F, 0x5F, 0xD0, 0x0F, 0xD7, 0xF4, 0x03, 0xF5, 0xFF, 0x01, 0xFD, 0xBF, 0xF9, 0xFF,
-    0xAF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFA, 0xF7, 0xFE, 0xFE, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xF8, 0x3F, 0xF8, 0xFC, 0xBF, 0xF8, 0xFC, 0xFF, 0xF4, 0xFC,
-    0xFF, 0xF4, 0xFC, 0xBF, 0xF4, 0xFC, 0x3F, 0xF0, 0xFC, 0x0F, 0xF0, 0xFC, 0x0B, 0xF0, 0xFC, 0x0F,
-    0xF0, 0xFC, 0x0F, 0xF0, 0xFC, 0x0F, 0xF0, 0xBC, 0x1F, 0xF0, 0xBC, 0x2F, 0xE0, 0xBC, 0x3F, 0xE0,
-    0xBC, 0x3F, 0xE0, 0xBC, 0x3F, 0xE0, 0xBC, 0x7F, 0xD0, 0xBC, 0x3F, 0x4F, 0xE3, 0xF9, 0xFF, 0x6A,
-    0x80, 0x0A, 0x00, 0xE0, 0x2F, 0x83, 0xBE, 0x01, 0xE2, 0xFD, 0x3F, 0x80, 0x0B, 0x02, 0xF0, 0x0B,
-    0x00, 0xB0, 0x0B, 0x00, 0xF0, 0x3F, 0xE2, 0xA9, 0x0B, 0xE0, 0xB6, 0xE3, 0x83, 0xCF, 0x0F, 0x2F,
-    0xF8, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x30, 0x00, 0xB4, 0x3C, 0x00, 0xBE, 0x3F,
-    0x40, 0x2F, 0xCF, 0xD0, 0x07, 0xF2, 0xF8, 0x03, 0xF5, 0xFC, 0x0F, 0xFB, 0xF8, 0x3F, 0xEF, 0xE0,
-    0x7F, 0x2F, 0x80, 0x3C, 0x1D, 0x00, 0x20, 0x04, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x14, 0x03, 0xFC, 0x00, 0x01, 0xF4, 0x05, 0xF0, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0xBC,
-    0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x01, 0xF4, 0x00, 0x1B,
-    0xD4, 0x0F, 0xC1, 0x81, 0xFF, 0xF0, 0xBD, 0x0F, 0x47, 0xFF, 0xC7, 0xF0, 0xFD, 0x00, 0x00, 0x3F,
-    0x0B, 0xB4, 0x00, 0x01, 0xF8, 0x76, 0xD0, 0x00, 0x0F, 0xC3, 0xCB, 0x40, 0x00, 0xBE, 0x2E, 0xBF,
-    0x80, 0x07, 0xF0, 0xFF, 0xFF, 0x00, 0x3F, 0x41, 0x57, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x0F,
-    0xD0, 0x00, 0x3E, 0x00, 0x69, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x01, 0x40, 0x03, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x5F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00,
-    0xBC, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x1F,
-    0x40, 0x00, 0x1B, 0xD4, 0x0F, 0xC6, 0xF8, 0x1F, 0xFF, 0x0B, 0xD7, 0xFF, 0xC7, 0xFF, 0xC7, 0xE1,
-    0xD0, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0xFC, 0x00,
-    0x07, 0xD0, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x0F,
-    0xF9, 0x40, 0x2F, 0x80, 0x03, 0xFF, 0xF0, 0x0F, 0xC0, 0x01, 0xFF, 0xFC, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFB, 0xF4, 0x00, 0x29, 0x00, 0x00, 0xE0, 0x02, 0xF0, 0x00,
-    0x03, 0x80, 0x1F, 0x40, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0xF0, 0x0B, 0xD0, 0x00, 0x02, 0xF0,
-    0x3E, 0x00, 0x05, 0x07, 0xC3, 0xF0, 0x00, 0x3F, 0xFF, 0x1F, 0x83, 0xC0, 0xFF, 0xF4, 0xFC, 0x2F,
-    0x41, 0xBE, 0x4B, 0xD1, 0xFD, 0x00, 0x00, 0x7F, 0x0E, 0xB4, 0x00, 0x03, 0xF0, 0xF2, 0xD0, 0x00,
-    0x2F, 0x8B, 0x9F, 0x90, 0x00, 0xFC, 0x3F, 0xFF, 0xC0, 0x0F, 0xD0, 0x6A, 0xFE, 0x00, 0x7F, 0x00,
-    0x03, 0xE0, 0x03, 0xF4, 0x00, 0x0F, 0x80, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0x90, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x05,
-    0x0B, 0xF0, 0x07, 0xD0, 0xFF, 0xBF, 0xF8, 0x0F, 0xFF, 0xF4, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00,
-    0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF,
-    0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00,
-    0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xCB,
-    0xE0, 0x00, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07,
-    0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x38, 0x00, 0x00, 0x1F, 0xF3, 0xC0, 0x00, 0x02, 0xDB,
-    0xF8, 0x00, 0x00, 0x2D, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00,
-    0x7F, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F,
-    0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x3F,
-    0xD0, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x0B,
-    0xF8, 0xFF, 0x00, 0x00, 0x6A, 0x4A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x03, 0xF4, 0xFC, 0x00,
-    0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x1F, 0xC0,
-    0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00,
-    0x3F, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xEE, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x03, 0xF4, 0xFC,
-    0x00, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x1F,
-    0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xC0,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x06, 0x8A, 0xAF, 0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xBE, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0xFF, 0xD4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0xAA, 0xA4, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD3, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0x83, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00,
-    0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xE4, 0x00, 0x07, 0xF4, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x7F, 0xAA, 0xA9, 0x2F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAB, 0xFF, 0xF4, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0x90, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01,
-    0xFE, 0xAA, 0xA4, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xEB, 0xE0, 0x0F, 0xC0, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00,
-    0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x0F, 0xD0, 0xFC, 0x03, 0xF8, 0x7F, 0x00, 0xFE, 0x2F, 0xD0, 0x7F,
-    0xCB, 0xF8, 0x1A, 0xA1, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07,
-    0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x2A, 0x00, 0x07, 0xF4, 0x00, 0x7F,
-    0x80, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x7F,
-    0x40, 0x1F, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8,
-    0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x07, 0xC3, 0xD1, 0xF0, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x7F, 0x5F, 0xD7, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x4F,
-    0xD3, 0xF4, 0xFD, 0x7F, 0x9F, 0xE7, 0xFA, 0xFF, 0xBF, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0xFE, 0x00,
-    0x03, 0xFF, 0x80, 0x0F, 0xEB, 0xE0, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x01,
-    0xFE, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x1A, 0x02, 0xA0, 0xFD, 0x1F,
-    0xC3, 0xF8, 0x7F, 0x5F, 0xE2, 0xFD, 0xBF, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xAA, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF8, 0x00,
-    0xBF, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x3F, 0xFF,
-    0xFD, 0x00, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0xFD, 0x15, 0xFF, 0x94, 0x00, 0xFD, 0x00, 0xBF, 0x00,
-    0x03, 0xFD, 0x00, 0xBF, 0x00, 0x6F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0x00, 0x00, 0x3F, 0xDB, 0x00, 0x00, 0x3D, 0xFF, 0x00,
-    0x00, 0x3C, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC, 0x1F, 0xF8, 0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC,
-    0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC, 0x3F, 0xFF, 0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC,
-    0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8, 0x3F, 0xD3, 0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8,
-    0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4, 0x7F, 0xD0, 0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4,
-    0xBF, 0xE0, 0x2F, 0xF4, 0x00, 0x69, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F,
-    0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0,
-    0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F,
-    0xCB, 0xF8, 0x00, 0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x07, 0xFE, 0x02,
-    0xFD, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x87, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00,
-    0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF,
-    0x80, 0x00, 0x3F, 0xC7, 0xFF, 0x50, 0x6F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x43, 0xFC, 0x00,
-    0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB,
-    0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00, 0x03, 0xFC, 0x7F, 0xF5, 0x06,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x74, 0x00, 0x00, 0x2F, 0xE7, 0x40, 0x00, 0x03, 0xCF, 0xF4, 0x00, 0x00,
-    0x3C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x07, 0xFE, 0x02, 0xFD,
-    0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x87, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x2F,
-    0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x80,
-    0x00, 0x3F, 0xC7, 0xFF, 0x50, 0x6F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00,
-    0x0F, 0xF1, 0xFF, 0x00, 0x00, 0xAA, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xF8, 0x07, 0xFE, 0x02, 0xFD, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x87, 0xF4, 0x00, 0x03,
-    0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0,
-    0x00, 0x02, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xC7, 0xFF, 0x50, 0x6F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x6F,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF4, 0x03, 0xFE, 0xFC, 0x00, 0x3F, 0xFC,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xAF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x02,
-    0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xF8,
-    0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF1, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80,
-    0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80,
-    0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0,
-    0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0,
-    0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80,
-    0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80,
-    0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0,
-    0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80,
-    0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80,
-    0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA4, 0x1A, 0x00, 0x02, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x03, 0xFC,
-    0x7F, 0x80, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0,
-    0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80,
-    0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80,
-    0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x7F, 0x41, 0xFD, 0x00,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x2F,
-    0xD3, 0xFC, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x54, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0xE4, 0x00, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xF0, 0xFD, 0x7F, 0xCF, 0x80, 0xFD, 0xF8, 0x0B, 0xDF, 0x81, 0xFC, 0xFE, 0xFF, 0x8F, 0xFF, 0xE0,
-    0xFF, 0xF4, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x40,
-    0x03, 0xFF, 0xF8, 0x02, 0xF9, 0x6F, 0x00, 0xFC, 0x03, 0xE0, 0x3E, 0x02, 0xF8, 0x1F, 0x83, 0xFD,
-    0x07, 0xE2, 0xF0, 0x01, 0xF8, 0xB8, 0x00, 0x7E, 0x1F, 0x80, 0x2F, 0xC3, 0xFD, 0x0B, 0xF0, 0x3F,
-    0xD2, 0xFC, 0x02, 0xFC, 0xBF, 0x80, 0x3F, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0xE0, 0x00, 0x15, 0x40, 0x00, 0x1A, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4,
-    0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8,
-    0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x0F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F,
-    0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00,
-    0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E,
-    0x00, 0x2E, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xF7, 0xF0, 0x1F, 0x40, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF,
-    0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC,
-    0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x02, 0xE1, 0xD0, 0x07,
-    0xF9, 0xE0, 0x0B, 0x7F, 0xD0, 0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC,
-    0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x1F, 0xC2, 0xF8, 0x2F, 0xC3, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xD7,
-    0xFC, 0x2A, 0x82, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4,
-    0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4,
-    0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD,
-    0x7E, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xEB, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F,
-    0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01,
-    0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF9, 0xF4, 0xBF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xAF, 0xFF, 0xD1,
-    0xF8, 0x3D, 0x02, 0xFF, 0x55, 0xBD, 0xBC, 0x01, 0xFF, 0xFF, 0xFE, 0xB8, 0x00, 0xFF, 0xFF, 0xFE,
-    0xF4, 0x00, 0xFE, 0x00, 0x00, 0xB8, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFA, 0xAE, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x06, 0xFD, 0x7F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x06, 0xFE, 0x00, 0xFF, 0xFC, 0x0B, 0xFE, 0xF0, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x02, 0xFD, 0x04, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x02,
-    0xFF, 0x80, 0x01, 0xE4, 0x00, 0x0F, 0xF4, 0x00, 0x12, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xF8, 0x00,
-    0x1A, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF,
-    0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00,
-    0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0xC0,
-    0x07, 0xF7, 0xF4, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55,
-    0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD,
-    0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x0A, 0x81, 0xA4, 0x1F, 0xC2, 0xF8, 0x2F,
-    0xC3, 0xFC, 0x3F, 0xD3, 0xFC, 0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8,
-    0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F,
-    0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x69, 0x00, 0x0F, 0xE0, 0x00,
-    0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00,
-    0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x03,
-    0xF8, 0x00, 0xFF, 0x00, 0x0F, 0x0B, 0xC3, 0xE2, 0xF0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x07, 0xD1, 0xF4, 0x7D, 0x1F, 0x47, 0xD2, 0xF4, 0xBD, 0x2F, 0x4B, 0xE3, 0xF8, 0xFF, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xF7, 0xF0, 0x1F, 0x40, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7F, 0x1F, 0xCB,
-    0xF6, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x2F, 0x40, 0x02, 0xF4, 0x00, 0x2F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x05, 0x6F, 0xD5, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xBE, 0x4F, 0x80, 0x02, 0xFF, 0xFB, 0xD0, 0x02,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFD, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x1F, 0x80,
-    0x03, 0xF8, 0x0F, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x78, 0x02, 0xFE, 0x74, 0x03,
-    0xCF, 0xF4, 0x03, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7F,
-    0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F, 0x00, 0x7D, 0x7E, 0x00, 0x7D,
-    0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFF, 0xBF, 0x00, 0xFF, 0xFF,
-    0x00, 0xFF, 0x1A, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD,
-    0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F,
-    0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x0B, 0xE7, 0xF4, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00,
-    0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xE0, 0x0B, 0xF9, 0xE0, 0x0F,
-    0x7F, 0xD0, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF,
-    0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE,
-    0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x1F,
-    0xC2, 0xF8, 0x2F, 0xC3, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xD7, 0xFC, 0x2A, 0x82, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD,
-    0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x06, 0x90, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x6A, 0xAB, 0xF4, 0x0F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x90, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x6F,
-    0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xF4, 0x2F, 0x4F, 0xEF, 0x83,
-    0xF6, 0xF9, 0xF8, 0x3F, 0x7F, 0x5F, 0x82, 0xFF, 0xF7, 0xF8, 0x1F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xF9, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD,
-    0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC,
-    0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBF, 0x40,
-    0x02, 0xFF, 0xD0, 0x0B, 0xE7, 0xF4, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00,
-    0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE,
-    0x07, 0xFE, 0xFE, 0x0A, 0x41, 0xA4, 0x1F, 0xC3, 0xF8, 0x2F, 0xC3, 0xFC, 0x3F, 0xD3, 0xFC, 0x3F,
-    0xD7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00,
-    0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD,
-    0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC,
-    0x3F, 0x40, 0x2F, 0x82, 0xFC, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x00, 0xBF, 0x07, 0xE0, 0x03, 0xF8,
-    0xFD, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xAF, 0xF8,
-    0x00, 0x2F, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0xFD, 0xBF, 0x4F, 0xC1, 0xFC,
-    0xFC, 0x07, 0xDF, 0xC0, 0x3E, 0xBC, 0x07, 0xDB, 0xC0, 0xFC, 0xBC, 0x2F, 0xCB, 0xDB, 0xF0, 0xBF,
-    0xFD, 0x0B, 0xFF, 0x40, 0xBE, 0x40, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00,
-    0x06, 0x80, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x7F, 0x0F, 0xF0, 0x0B, 0xF4, 0xFF, 0x00, 0xFF, 0x4F,
-    0xF0, 0x0A, 0xA4, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC3, 0xF4, 0x02, 0xF8, 0x2F, 0xC0, 0x3F,
-    0x40, 0xFD, 0x03, 0xF0, 0x0B, 0xF0, 0x7E, 0x00, 0x3F, 0x8F, 0xD0, 0x02, 0xFD, 0xFC, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x1A, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xFD,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x56, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00,
-    0x03, 0xF4, 0xFC, 0x00, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x03,
-    0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x07,
-    0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x10, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFC, 0xBE,
-    0xAA, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9,
-    0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC,
-    0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06,
-    0xFD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8,
-    0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F,
-    0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0,
-    0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x2F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00,
-    0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD,
-    0x06, 0xFD, 0x7E, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F,
-    0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40,
-    0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3,
-    0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x7D, 0x00, 0xFF, 0xFF, 0x40, 0xFE, 0xBF, 0xE0, 0x3D, 0x02, 0xF8, 0x2F,
-    0x00, 0x7F, 0x0B, 0x80, 0x0F, 0xC3, 0xD0, 0x03, 0xF0, 0xB8, 0x01, 0xFC, 0x2F, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF4, 0x06, 0xFD, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xB4, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0xF0, 0x2F, 0xFB, 0xC1, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x2F,
-    0x40, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF4, 0x10, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
-    0x0A, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x3D, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xF7, 0xF0, 0x1F, 0x40, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x03, 0xFF, 0xF0, 0x0B, 0xFE, 0xF0, 0x1F, 0xC0, 0x00,
-    0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xD0, 0x40, 0x0F,
-    0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x00, 0xAF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x80, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x03,
-    0xFF, 0xF0, 0x2F, 0xFB, 0xC1, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFD, 0x00, 0x02,
-    0xF8, 0x00, 0x07, 0xF4, 0x10, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x0A, 0xFE, 0x00, 0x00, 0xA4,
-    0x01, 0xA0, 0x00, 0x7E, 0x0B, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x02, 0xF4,
-    0x1F, 0xDF, 0xD0, 0x07, 0xFF, 0x40, 0x01, 0xFD, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x80, 0x0F, 0xFF, 0xC0, 0x2F, 0xFB, 0xC0, 0x7F, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x41, 0x00, 0x3F, 0xFF, 0x80,
-    0x1F, 0xFF, 0xE0, 0x02, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x02, 0xF9,
-    0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xD0, 0xBF, 0xAA, 0xFF, 0xF0, 0xBF, 0x00, 0x0F, 0xF8, 0xBF, 0x00,
-    0x03, 0xFC, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00,
-    0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x02, 0xFD, 0xBF, 0x00, 0x6F, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC6, 0x80, 0x00, 0x03, 0xF2, 0xF0, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x1F, 0xE3, 0xF7, 0xF0,
-    0x2F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0xFF, 0x80, 0x07, 0xC0, 0x1F, 0xE0,
-    0x02, 0xF0, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0x40, 0xBF, 0x80, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x9F, 0xC0, 0x00, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xAA, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00,
-    0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0xFD, 0x3F, 0xFF, 0xFD, 0x00,
-    0xFD, 0x15, 0xFF, 0x94, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0x6F, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x2A, 0xBF, 0xA9, 0x00, 0x00, 0x3F,
-    0x00, 0x01, 0xFE, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0x03, 0xFE,
-    0x00, 0x7C, 0x01, 0xFE, 0x00, 0xBC, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xBD, 0x02, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x7F,
-    0x00, 0x00, 0x00, 0x54, 0x07, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xD0, 0xAA, 0x95, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4,
-    0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x2F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x6A,
-    0xAA, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC,
-    0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B,
-    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x41, 0xF8, 0x1F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF,
-    0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x6A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0,
-    0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0x50,
-    0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F,
-    0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0xFA, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x2F, 0x40, 0x7F, 0x7F, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAB, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0x90,
-    0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFE, 0xAA, 0xA4, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x0F, 0xEB,
-    0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B,
-    0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x2F, 0x9F, 0xD0, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFD, 0x00, 0x18, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xE9, 0x40, 0xBF, 0x80, 0x1F, 0xFF, 0xCB, 0xF8,
-    0x00, 0xFF, 0xFD, 0x7F, 0xC0, 0x05, 0xBF, 0xE3, 0xFE, 0x00, 0x03, 0xF4, 0x3F, 0xFE, 0x55, 0xFF,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x1B,
-    0xFF, 0x90, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xDF, 0xD0,
-    0x0F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x5F, 0x80, 0xFF, 0xFF, 0xE0, 0xFE, 0xBF, 0xF8, 0x7D, 0x03, 0xFE, 0x2E, 0x00, 0xBF,
-    0x8B, 0x80, 0x1F, 0xD3, 0xD0, 0x07, 0xF4, 0xB8, 0x01, 0xFD, 0x2F, 0x41, 0xFF, 0x47, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x60, 0x1F,
-    0xE0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xD0, 0x01, 0x80, 0x3F, 0xE0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x1E, 0x94, 0x0B, 0xF8, 0x01, 0xFF, 0xFC, 0xBF, 0x80, 0x0F, 0xFF, 0xD7, 0xFC, 0x00, 0x5B,
-    0xFE, 0x3F, 0xE0, 0x00, 0x3F, 0x43, 0xFF, 0xE5, 0x5F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x7E, 0x0B, 0xFF, 0xFD, 0x03, 0xFF, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x7E, 0x0F, 0xFF, 0xFE, 0x3F, 0xAF, 0xFE, 0x7D, 0x03, 0xFE,
-    0xB8, 0x02, 0xFE, 0xB8, 0x01, 0xFD, 0xF4, 0x01, 0xFD, 0xB8, 0x01, 0xFD, 0xBD, 0x07, 0xFD, 0x7F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0xFC, 0x18, 0x07,
-    0xF8, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xD0, 0x01, 0x80, 0x3F, 0xE0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x1E, 0x94, 0x0B, 0xF8, 0x01, 0xFF, 0xFC, 0xBF, 0x80, 0x0F, 0xFF, 0xD7, 0xFC, 0x00, 0x5B, 0xFE,
-    0x3F, 0xE0, 0x00, 0x3F, 0x43, 0xFF, 0xE5, 0x5F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x7E, 0x0F, 0xFF, 0xFE, 0x3F, 0xAF, 0xFE, 0x7D, 0x03, 0xFE, 0xB8,
-    0x02, 0xFE, 0xB8, 0x01, 0xFD, 0xF4, 0x01, 0xFD, 0xB8, 0x01, 0xFD, 0xBD, 0x07, 0xFD, 0x7F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0xFC, 0x18, 0x07, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFD, 0x00, 0x18, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xE9, 0x40, 0xBF,
-    0x80, 0x1F, 0xFF, 0xCB, 0xF8, 0x00, 0xFF, 0xFD, 0x7F, 0xC0, 0x05, 0xBF, 0xE3, 0xFE, 0x00, 0x03,
-    0xF4, 0x3F, 0xFE, 0x55, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x7F, 0xD0, 0x00, 0x7F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x7E, 0x0F, 0xFF, 0xFE, 0x3F, 0xAF, 0xFE, 0x7D, 0x03, 0xFE, 0xB8,
-    0x02, 0xFE, 0xB8, 0x01, 0xFD, 0xF4, 0x01, 0xFD, 0xB8, 0x01, 0xFD, 0xBD, 0x07, 0xFD, 0x7F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0xFC, 0x18, 0x07, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x03, 0xF0, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xFC,
-    0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC,
-    0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC,
-    0x7F, 0xC0, 0x03, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFF, 0xFD, 0xBF, 0xEA, 0xAB, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0xBF, 0xC0, 0x07, 0xFD,
-    0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xEF, 0xF0, 0x00, 0xFE, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0xF8,
-    0x01, 0xFC, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0xFC, 0x02, 0xFC, 0x01, 0xFC,
-    0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x03, 0xFD, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0xFF,
-    0x00, 0xFD, 0x00, 0x0F, 0xF0, 0x0F, 0xD0, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x1F, 0xE0,
-    0x00, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xE0, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFA, 0xAA, 0xFF, 0x42,
-    0xFF, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0x01, 0xFF, 0x42, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x16, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7E, 0xFD, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xEF,
-    0xF0, 0x00, 0xFE, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0xF8, 0x01, 0xFC, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFD, 0x02,
-    0xFC, 0x03, 0xFD, 0x03, 0xFC, 0x1F, 0x4F, 0x0F, 0xF6, 0xC3, 0xDF, 0xF1, 0xF1, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x7F, 0x40, 0x1F, 0xD0,
-    0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x02, 0xFF, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x3E, 0x1D, 0xBF, 0x9E, 0xF7, 0xFD, 0xB4, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x0B, 0xD0,
-    0x0B, 0xD0, 0x0B, 0xD0, 0x0B, 0xE0, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFD, 0x3E, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x55, 0xA0, 0x3F, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xFC, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFF, 0x00, 0x1F, 0xD1, 0xFD, 0x1F, 0xD1, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC,
-    0x0F, 0xC0, 0xFD, 0x0F, 0xD0, 0xFD, 0x0F, 0xD1, 0xFE, 0x1F, 0xE1, 0xFE, 0x2F, 0xF2, 0xFF, 0x3F,
-    0x07, 0xC0, 0xBF, 0xC3, 0xFC, 0x01, 0x40, 0x2F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x2A, 0x80, 0x00,
-    0x00, 0x01, 0xA0, 0x1F, 0x41, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F,
-    0x83, 0xF8, 0x3F, 0xC1, 0xF4, 0x3E, 0x0B, 0xC0, 0xFF, 0xD7, 0xFE, 0x06, 0xD0, 0x2A, 0x0F, 0xC7,
-    0xF6, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF5, 0xFD, 0x7F, 0x0F, 0xC3, 0xF0,
-    0xFC, 0x3F, 0x0F, 0xC3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD7, 0xF9, 0xFE, 0x7F, 0xAF, 0xFB, 0xFC, 0x69,
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0xBD, 0xBD, 0xBD, 0xBE, 0xFE, 0xFF, 0x3F, 0xC0, 0x00, 0x3F, 0x8F,
-    0xF0, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x07, 0xF8, 0xBF, 0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x7F,
-    0x4B, 0xF0, 0x00, 0x2F, 0xD2, 0xFC, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00,
-    0xFF, 0x0B, 0xF0, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x03, 0xF8, 0x2F, 0xC0,
-    0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x1F, 0xD0, 0xFF, 0x40, 0x07, 0xF4, 0x3F,
-    0xD0, 0x01, 0xFC, 0x0F, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x50, 0x1F, 0xF0,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x00, 0x2B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x2F, 0x0F, 0xE0, 0x0F,
-    0xC3, 0xFC, 0x03, 0xF4, 0xFF, 0x00, 0x54, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0xFC, 0x1F, 0x40, 0x3F, 0x07, 0xD0, 0x0F, 0xC1, 0xF4, 0x03, 0xF0, 0x7D, 0x00,
-    0xFC, 0x1F, 0x40, 0x3E, 0x0B, 0xD0, 0x0F, 0x82, 0xF4, 0x03, 0xE0, 0xBD, 0x00, 0xF8, 0x2F, 0x80,
-    0x3D, 0x0F, 0xE0, 0x1F, 0x43, 0xFC, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x07, 0xF7, 0xF0, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x02,
-    0x40, 0xBF, 0x80, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF,
-    0xC0, 0x0F, 0xE7, 0xF0, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x0F, 0xE0, 0xFF, 0x40, 0x0F, 0xD1, 0xFF, 0x00, 0x0F, 0xD3,
-    0xFC, 0x00, 0x0F, 0xCB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0x9F, 0xFE, 0x00, 0x7F, 0x8B,
-    0xFF, 0x80, 0x7F, 0x83, 0xFF, 0xF0, 0xBF, 0x80, 0xFF, 0xFC, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0xBE, 0x00, 0x3E, 0xBF, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0x80,
-    0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x02, 0xF9, 0xFF, 0x80, 0xBF, 0x2F,
-    0xFC, 0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0x40, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xF0, 0x3D, 0x7C,
-    0x03, 0xCF, 0x80, 0x3E, 0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0xE0, 0x0B,
-    0xFF, 0x80, 0xB8, 0xFF, 0x0F, 0x87, 0xFC, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xD0,
-    0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x03, 0xC0, 0x2F, 0x00, 0xF4, 0x0B, 0xC0, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3E, 0x01, 0xF8, 0x07, 0xE0, 0x1F,
-    0x80, 0x7D, 0x02, 0xF4, 0x0B, 0xD0, 0x2F, 0x40, 0xBD, 0x02, 0xF4, 0x0B, 0xD0, 0x3F, 0x40, 0xFF,
-    0xE3, 0xFF, 0xCF, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFD, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x40,
-    0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xFD, 0x00,
-    0x3F, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x01, 0xA0, 0x3F, 0x80, 0xBC,
-    0x0F, 0xE0, 0x3F, 0x03, 0xF8, 0x0F, 0xC0, 0xFE, 0x03, 0xF0, 0x3F, 0x80, 0xFC, 0x0F, 0xE0, 0x00,
-    0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFF, 0xFF,
-    0xF6, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0xBC,
-    0x00, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0x54, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x7E,
-    0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00,
-    0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xF0, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x06, 0x80, 0xFE, 0x03, 0xF8, 0x3F, 0x80, 0xFE,
-    0x0F, 0xE0, 0x7F, 0xC3, 0xF8, 0x1F, 0xF0, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
-    0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFF, 0xFF,
-    0xF6, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x1F, 0xC7, 0xE2, 0xFC, 0x7E, 0x3F, 0xC7, 0xD3, 0xFC, 0xBD,
-    0x2A, 0x8B, 0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xFE, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x02, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xEB, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFB, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xAF, 0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02,
-    0xFB, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0xF4,
-    0x01, 0xFF, 0x8B, 0xD0, 0x00, 0x10, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC, 0x1F, 0xF8, 0x01, 0xFC,
-    0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC, 0x3F, 0xFF, 0x82, 0xFC,
-    0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8, 0x3F, 0xD3, 0xF7, 0xF8,
-    0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4, 0x7F, 0xD0, 0x7F, 0xF4,
-    0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
-    0x40, 0x00, 0x3F, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F, 0x00, 0x7D, 0x7E,
-    0x00, 0x7D, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFF, 0xBF, 0x00,
-    0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC,
-    0x1F, 0xF8, 0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC,
-    0x3F, 0xFF, 0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8,
-    0x3F, 0xD3, 0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4,
-    0x7F, 0xD0, 0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F,
-    0x00, 0x7D, 0x7E, 0x00, 0x7D, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00,
-    0xFF, 0xBF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0xA0, 0x02, 0xA0, 0x00, 0xBE, 0x1F, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC, 0x1F,
-    0xF8, 0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC, 0x3F,
-    0xFF, 0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8, 0x3F,
-    0xD3, 0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4, 0x7F,
-    0xD0, 0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x0A, 0x40, 0x2A, 0x01, 0xF8,
-    0x7F, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF8, 0x00, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFB, 0xFC, 0x0F, 0xD0, 0x2F, 0x07, 0xF0, 0x07, 0xD1, 0xF8, 0x01, 0xF4, 0x7F,
-    0x00, 0xBE, 0x1F, 0xC0, 0x2F, 0x8B, 0xF0, 0x0F, 0xE2, 0xFC, 0x03, 0xFC, 0xBF, 0x00, 0xFF, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x01, 0xFE, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7F,
-    0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F, 0x00, 0x7D, 0x7E, 0x00, 0x7D,
-    0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFF, 0xBF, 0x00, 0xFF, 0xFF,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC, 0x1F, 0xF8,
-    0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC, 0x3F, 0xFF,
-    0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8, 0x3F, 0xD3,
-    0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4, 0x7F, 0xD0,
-    0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F, 0x00, 0x7D,
-    0x7E, 0x00, 0x7D, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFF, 0xBF,
-    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x2F, 0xFD, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xF8, 0x07, 0xFE, 0x02, 0xFD, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x87, 0xF4,
-    0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F,
-    0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xC7, 0xFF, 0x50, 0x6F, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA0, 0x3F, 0xFF, 0xF8, 0x7F,
-    0xFF, 0xFC, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE,
-    0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E,
-    0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01,
-    0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07,
-    0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0,
-    0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00, 0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x41, 0xF8, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD,
-    0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x02, 0xFC, 0x00,
-    0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x02, 0xA4, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x02, 0xFD, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x1F,
-    0xE0, 0x7F, 0x40, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x2F,
-    0xC0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x00, 0xFF, 0x07, 0xFF, 0x50,
-    0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x0F, 0xD0, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x02, 0xA4, 0x00, 0xAA,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x0B, 0xD0, 0x0B, 0xE0,
-    0x00, 0xFD, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x0B, 0xE0, 0x00, 0xBF, 0x41, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xAB, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xF0,
-    0x00, 0x0B, 0xFF, 0xFD, 0x02, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0xAA, 0x90, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40,
-    0x6F, 0x80, 0x03, 0xFF, 0xFD, 0xFF, 0xFD, 0x03, 0xFE, 0xBF, 0xFD, 0x0B, 0xC1, 0xFC, 0x03, 0xFE,
-    0x55, 0xF8, 0xBD, 0x00, 0xBF, 0xFF, 0xFF, 0x3F, 0x40, 0x1F, 0xFF, 0xFF, 0xCB, 0xD0, 0x0B, 0xF4,
-    0x00, 0x02, 0xFD, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFA, 0xAF, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFE, 0x7F, 0xFF, 0xF0, 0x06, 0xF9, 0x02, 0xBF, 0x90, 0x00, 0x05, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xF5, 0x5F, 0xC0, 0x2F,
-    0x00, 0x3E, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x55, 0xFE,
-    0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xD1, 0xFE, 0x07, 0xFC,
-    0x0B, 0xF0, 0x7F, 0xC0, 0xBF, 0x47, 0xFC, 0x0B, 0xF8, 0x7F, 0xC0, 0xBF, 0xCB, 0xFC, 0x0B, 0xFD,
-    0x7F, 0xC0, 0xBF, 0xE0, 0x00, 0x50, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x02, 0xFA, 0xF4, 0xBF, 0xFE, 0x3F, 0xFF, 0x8F, 0xF4, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x3F,
-    0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x01, 0xFE, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xF5, 0x5F, 0xC0, 0x2F, 0x00,
-    0x3E, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x55, 0xFE, 0x03,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xD1, 0xFE, 0x07, 0xFC, 0x0B,
-    0xF0, 0x7F, 0xC0, 0xBF, 0x47, 0xFC, 0x0B, 0xF8, 0x7F, 0xC0, 0xBF, 0xCB, 0xFC, 0x0B, 0xFD, 0x7F,
-    0xC0, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x02,
-    0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEB, 0xD0, 0xBF,
-    0xFE, 0x0F, 0xFF, 0xE0, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0xFD, 0x7F,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0x55, 0xFC,
-    0x02, 0xF0, 0x03, 0xE0, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xF5,
-    0x5F, 0xE0, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x1F, 0xE0,
-    0x7F, 0xC0, 0xBF, 0x07, 0xFC, 0x0B, 0xF4, 0x7F, 0xC0, 0xBF, 0x87, 0xFC, 0x0B, 0xFC, 0xBF, 0xC0,
-    0xBF, 0xD7, 0xFC, 0x0B, 0xFE, 0x7E, 0x00, 0xF8, 0x1F, 0xCB, 0xE0, 0x07, 0xFF, 0x80, 0x01, 0xFE,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xF4, 0x02, 0xFF, 0xF8,
-    0x03, 0xFF, 0xF8, 0x03, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03,
-    0xF4, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFE, 0x80, 0x01, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x07, 0x90,
-    0x02, 0xFF, 0x0F, 0xFE, 0x9B, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x06, 0xFF,
-    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40,
-    0x50, 0x0F, 0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE,
-    0x0F, 0x95, 0xFE, 0x3F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2B, 0xFE, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x02, 0xFE, 0x07, 0x90, 0x02, 0xFF, 0x0F, 0xFE, 0x9B, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBF,
-    0x00, 0x02, 0xFF, 0xC0, 0x0B, 0xEB, 0xF0, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40, 0x50, 0x0F, 0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0x95, 0xFE, 0x3F, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xF8, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFE, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x07, 0x90, 0x02, 0xFF, 0x0F,
-    0xFE, 0x9B, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFA, 0x00, 0x00,
-    0xB9, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x4B, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40, 0x50, 0x0F,
-    0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0x95,
-    0xFE, 0x2F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x03, 0x80, 0x00, 0x07, 0xE0, 0x00,
-    0x0A, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xC0,
-    0x00, 0xFD, 0x3F, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFE, 0x80,
-    0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFE,
-    0x07, 0x90, 0x02, 0xFF, 0x0F, 0xFE, 0x9B, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x06, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x07, 0xF7,
-    0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40, 0x50, 0x0F, 0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0x95, 0xFE, 0x3F, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xF8, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x04, 0xB8, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x2F, 0x40, 0x00,
-    0xBD, 0x00, 0x02, 0xF4, 0x00, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1A, 0xFE, 0xA8, 0x03, 0xF4, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFE,
-    0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x0F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xAF, 0x00, 0x03, 0xFC,
-    0x00, 0x1F, 0xD0, 0x00, 0x03, 0xE0, 0x0B, 0x80, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x78, 0x0F, 0xC0, 0x2F, 0x40,
-    0xFC, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x6B,
-    0xFA, 0xA0, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0x5F, 0xF5, 0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xFF, 0xF8,
-    0x1F, 0xFF, 0xFC, 0x1A, 0xFE, 0xA8, 0x00, 0xFD, 0x00, 0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x55,
-    0xFE, 0x54, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1C, 0x00, 0x00, 0xBF, 0x9D, 0x00, 0x00, 0xF3, 0xFD, 0x00,
-    0x00, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC,
-    0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8,
-    0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE1, 0xD0, 0x07, 0xF8, 0xE0, 0x0B, 0x7D, 0xE0, 0x0F, 0x6F, 0xD0,
-    0x0B, 0x4B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC,
-    0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00,
-    0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC,
-    0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x03, 0xF8,
-    0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x16, 0xAB, 0xF4, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00,
-    0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE,
-    0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F,
-    0x40, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07,
-    0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03,
-    0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x1F,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD,
-    0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3C, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07,
-    0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03,
-    0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x01, 0xFF, 0x00, 0x02,
-    0xDF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD,
-    0xBC, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x2A, 0x00, 0x0A, 0x90, 0x1F, 0xD0, 0x03,
-    0xF8, 0x0B, 0xF4, 0x01, 0xFE, 0x02, 0xFD, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC,
-    0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x7F, 0x80,
-    0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0,
-    0x7F, 0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x03, 0xF8, 0x07, 0xF8, 0x00,
-    0x7F, 0x80, 0x3F, 0xC0, 0x0B, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF4, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0x00, 0x06, 0x90, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFE, 0x02,
-    0xFD, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x0F, 0xD0, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x0B,
-    0xC0, 0x0F, 0xD0, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x07, 0xD0, 0x0F, 0xD0, 0x00, 0x7D, 0x00, 0xFD,
-    0x00, 0x07, 0xF0, 0x1F, 0xD0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC,
-    0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8,
-    0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x05, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD,
-    0xBD, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7E, 0x00, 0xFD, 0x7F, 0x02, 0xFD, 0x3F, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x0B,
-    0xD8, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xBF,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xF0, 0x0B, 0xE0, 0x0F, 0xF0, 0x1F, 0xF0,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF4, 0x2F, 0xF4, 0x2F, 0xE0, 0x0F, 0xF4, 0x3F, 0xFC, 0x3F, 0xD0,
-    0x0B, 0xF8, 0xBF, 0xFD, 0x3F, 0xC0, 0x07, 0xFC, 0xFF, 0xFF, 0x7F, 0xC0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFE, 0xBF, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x02, 0xFF,
-    0xFC, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF4, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFD, 0x00,
-    0x00, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07,
-    0xF7, 0xF0, 0x00, 0x03, 0xF8, 0xFC, 0x01, 0x40, 0xFD, 0x3F, 0x43, 0xF0, 0x7F, 0x0B, 0xE2, 0xFE,
-    0x2F, 0x81, 0xFC, 0xFF, 0xCF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFB, 0xFF, 0x40, 0x0F, 0xFC, 0xFF, 0xC0, 0x03, 0xFD, 0x1F, 0xF0, 0x00,
-    0x69, 0x01, 0xA4, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x01, 0xFD, 0xFC, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x07, 0xF4, 0x1F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00,
-    0xBF, 0x40, 0xFF, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xEF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x02, 0xF9, 0xFD, 0x00, 0xBD, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x3F, 0x40, 0x2F, 0x82, 0xFC, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x00,
-    0xBF, 0x07, 0xE0, 0x03, 0xF8, 0xFD, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x01, 0xAF, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x01, 0xFC, 0x2F, 0x80, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x0F, 0xF4,
-    0xFF, 0x00, 0x02, 0xA9, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xF0,
-    0xFF, 0x00, 0x07, 0xF4, 0x1F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0xFF,
-    0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0xAA, 0x90, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01,
-    0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x6A,
-    0xBF, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F,
-    0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFE, 0xAA, 0x90, 0xBF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1A, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x6A, 0xBF, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x0B,
-    0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x02, 0x90, 0x02, 0x80, 0x00, 0x7F, 0x0B, 0xE0, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xEA, 0xA9, 0x0B, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0x80, 0x7E, 0x01, 0xFC, 0xBE, 0x00, 0x1F, 0xFE, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x1A, 0xAF, 0xF8, 0x00, 0x07, 0xF8, 0x00,
-    0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0x00, 0x07, 0xF9, 0x1F, 0xFE, 0x3F, 0xFE,
-    0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00,
-    0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0xBF, 0x40, 0x3F, 0x40, 0x03, 0xF8,
-    0x00, 0x3F, 0x80, 0x01, 0xA8, 0x07, 0xC0, 0xF8, 0x1F, 0x43, 0xF0, 0x14, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xDB, 0xE0, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2E,
-    0x1D, 0x7F, 0x9E, 0xB7, 0xDE, 0xF1, 0xFC, 0x60, 0x64, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xFC, 0x1F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xA9, 0x00, 0x00, 0x55, 0x50, 0x7F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD3, 0xFF, 0xFF, 0x07, 0xFF, 0xF4, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xDB, 0xF6, 0xFE, 0x6A, 0x40, 0x3F, 0x0F, 0xC3, 0xF0,
-    0xFC, 0x7F, 0x1F, 0xCB, 0xF6, 0xFD, 0x10, 0x0F, 0xC0, 0x70, 0x78, 0x28, 0x00, 0x2E, 0x2F, 0xEF,
-    0x7E, 0xFE, 0x2E, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0xFE, 0x00, 0xBF, 0x40,
-    0x1F, 0xE0, 0x0A, 0xA4, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x0F, 0xDB, 0xE0,
-    0x03, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x01, 0xFD, 0x00,
-    0x3F, 0x80, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x06, 0xA0, 0x01, 0xA8, 0x00, 0x02, 0xFF, 0x07, 0xFC,
-    0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0x80, 0xFF, 0x03, 0xFD, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x0F,
-    0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x2F, 0xE0, 0x1F,
-    0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x0A, 0x03, 0xDF, 0xF7, 0xFD, 0x0F, 0x43,
-    0xD0, 0x60, 0x3D, 0x0F, 0xF7, 0xFD, 0xF8, 0x2D, 0x00, 0xFE, 0xA9, 0x4F, 0xFF, 0xFC, 0x6A, 0xAF,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x0E, 0x03, 0xD0, 0xF4, 0xFC, 0x7E, 0x09, 0x00,
-    0x00, 0x2C, 0xBC, 0xF4, 0xBC, 0x2C, 0x00, 0x1F, 0x01, 0xF0, 0xFF, 0xDF, 0xFD, 0x55, 0x40, 0xFF,
-    0xDF, 0xFD, 0x6F, 0x41, 0xF0, 0x00, 0x00, 0x08, 0x03, 0x4B, 0xFC, 0x34, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x3F, 0xFF, 0xA9, 0x1A, 0x43, 0xF8, 0x3F, 0x83, 0xFC,
-    0x7F, 0xC0, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7F, 0x1F, 0xCB, 0xF6, 0xFD, 0x2E, 0x2F, 0xEF, 0x7E,
-    0xFE, 0x2E, 0x00, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0x07, 0xFC, 0x2F, 0xD0, 0xFF, 0x07, 0xFC, 0x3F,
-    0xE0, 0x0A, 0x00, 0xE0, 0x2F, 0x83, 0xBE, 0x01, 0xE2, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0xBC, 0x2F,
-    0x87, 0xE0, 0xBC, 0x0B, 0xFE, 0x3F, 0xE0, 0x6D, 0x2F, 0x4B, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3,
-    0xF4, 0x7F, 0xFF, 0x9F, 0xFF, 0xE7, 0xFB, 0xF9, 0xF8, 0x7E, 0x7E, 0x1F, 0x80, 0x3F, 0x00, 0x2F,
-    0x43, 0xF8, 0x3F, 0x80, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFF, 0xD0, 0x0F, 0xE1,
-    0xFD, 0x0F, 0xD0, 0x0B, 0xD0, 0x2F, 0x47, 0x9F, 0xF1, 0xEB, 0xFF, 0xBA, 0xE3, 0xFD, 0x78, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x7F, 0xFF, 0xE5, 0x54, 0x00, 0x1A, 0xAF, 0xF0,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x47, 0x9F, 0xF1, 0xEB, 0xFF, 0xBA, 0xE3,
-    0xFD, 0x78, 0x3E, 0x00, 0x00, 0x00, 0x15, 0x55, 0x56, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0E, 0x03, 0xF0, 0x3C, 0x2F, 0x0F, 0xC3, 0xC0, 0x00, 0x50, 0x00, 0x0F, 0xD0, 0xFC, 0xFD, 0x0F,
-    0xCF, 0xFF, 0xFC, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x5F, 0xFF, 0xD7,
-    0xD5, 0xF5, 0xF0, 0x3D, 0x7D, 0x5F, 0x5F, 0xFF, 0xD7, 0xFF, 0xF4, 0x0B, 0xAD, 0x0B, 0xFF, 0xC3,
-    0xCF, 0xB4, 0xE3, 0x9D, 0x38, 0xE7, 0x00, 0x00, 0x00, 0x08, 0x20, 0x2F, 0x40, 0x3C, 0x02, 0xF4,
-    0x2C, 0xB0, 0x2E, 0x1D, 0x7F, 0x9E, 0xB7, 0xDE, 0xF1, 0xFC, 0x60, 0x64, 0x00, 0xB4, 0xFC, 0x7E,
-    0xBC, 0x50, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE1, 0xF8,
-    0x7E, 0x1F, 0x8B, 0xF2, 0xFC, 0xFF, 0x3F, 0xC0, 0x7F, 0xFF, 0x9F, 0xFF, 0xE7, 0xFB, 0xF9, 0xF8,
-    0x7E, 0x7D, 0x1F, 0x80, 0x06, 0xAB, 0xFC, 0x1F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x3E, 0xAA, 0xA5, 0x00, 0x00, 0x2F, 0x07,
-    0xDB, 0xC1, 0xF6, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC3, 0xF4, 0xFF, 0xEB, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x7F, 0x01, 0xFC, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x01, 0xF8, 0xFF, 0x0F,
-    0xFF, 0xBC, 0x7E, 0xFF, 0xF1, 0xF1, 0xFF, 0x87, 0xC7, 0xF8, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
-    0x07, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x05, 0x50, 0x1F, 0xFF, 0xE0, 0x1F, 0xF0, 0xFF, 0xFF,
-    0xF4, 0x7F, 0xCB, 0xFC, 0x3F, 0xFF, 0xFE, 0x3F, 0xF0, 0x2F, 0xFF, 0xF0, 0x2A, 0x8F, 0x86, 0xF9,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x39, 0x7F, 0xFC, 0x3E, 0xBD, 0x7E, 0x7E, 0xFD, 0x2F, 0xFD, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x39, 0x7F, 0xFC, 0x3E, 0xFD, 0x7F, 0xFD, 0xBD, 0x1F, 0xFC,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x1F, 0x8F, 0xC0, 0x08, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x0B, 0x80, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0xC3, 0xE0, 0x00, 0x00, 0x0F, 0x43, 0xF4, 0x00, 0x06, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x1A, 0xFE, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFE, 0x40, 0x02, 0xFE, 0x0F, 0x80, 0x00, 0x00, 0x7D, 0x18, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x55, 0x55,
-    0x55, 0x56, 0xF9, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFE, 0x81, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xF4, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x54, 0x2F, 0xFF,
-    0xFF, 0x4B, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0xFC, 0x03,
-    0xF8, 0x7F, 0x00, 0xFE, 0x2F, 0xD0, 0x7F, 0xCB, 0xF8, 0x1A, 0xA1, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0,
-    0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x82, 0xAA,
-    0xFF, 0xAA, 0xA4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0xFD, 0x00, 0x3F,
-    0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0xFF, 0xE0, 0x00, 0xFE,
-    0x0F, 0xFC, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xBE, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x6F, 0xE8, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xFE,
-    0xBF, 0xD0, 0x1F, 0xD0, 0x0B, 0xF0, 0x3F, 0x40, 0x03, 0xF8, 0x7F, 0x00, 0x01, 0xA8, 0xBF, 0x55,
-    0x54, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B,
-    0xFE, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x02, 0xFE, 0x07, 0x90, 0x02, 0xFF, 0x0F, 0xFE, 0x9B, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x06, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD7, 0xF5, 0xFC, 0x3F,
-    0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x5F, 0xE7, 0xF9, 0xFE, 0xBF, 0xEF,
-    0xF0, 0x1F, 0x47, 0xD2, 0xF8, 0xBE, 0x3F, 0x8F, 0xE3, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xC0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x09, 0x02, 0xFE, 0x03, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAF,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0x00,
-    0x00, 0x07, 0xD0, 0x0F, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x0F, 0x95, 0x00,
-    0x07, 0xD0, 0x0F, 0xFF, 0xF4, 0x07, 0xC0, 0x0F, 0xFF, 0xFC, 0x0B, 0xC0, 0x1F, 0x40, 0xFE, 0x0B,
-    0xC0, 0x1F, 0x40, 0x7F, 0x0B, 0xC0, 0x1F, 0x40, 0x3F, 0x0F, 0xC0, 0x1F, 0x40, 0xBF, 0x0F, 0xC0,
-    0x1F, 0xFF, 0xFE, 0x7F, 0xC0, 0x1F, 0xFF, 0xFC, 0xBF, 0x80, 0x1F, 0xFF, 0xD0, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x2E, 0x00,
-    0x00, 0x7D, 0x00, 0x2E, 0x00, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00,
-    0x7D, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0xAA, 0xBF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x7D, 0x00, 0x3F, 0x02, 0xFC, 0x7D, 0x00, 0x3F, 0x00, 0xFC, 0x7D, 0x00,
-    0x3F, 0x00, 0xFD, 0x7D, 0x00, 0x3F, 0x01, 0xFC, 0x7D, 0x00, 0x3F, 0xFF, 0xFC, 0x7D, 0x00, 0x3F,
-    0xFF, 0xF4, 0x7D, 0x00, 0x3F, 0xFF, 0x80, 0x69, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xF9, 0xA5, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0x41, 0xFC, 0x00, 0x0F, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xC0, 0x00,
-    0xFF, 0x00, 0x3F, 0x00, 0x03, 0xFC, 0x00, 0xFD, 0x00, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0x3F, 0xC0,
-    0x0F, 0xD0, 0x00, 0xFF, 0x40, 0x3F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x7F, 0xC0, 0x0F, 0xE0, 0xFF, 0x40, 0x0F, 0xD1, 0xFF, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x0F,
-    0xCB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0x9F, 0xFE, 0x00, 0x7F, 0x8B, 0xFF, 0x80, 0x7F,
-    0x83, 0xFF, 0xF0, 0xBF, 0x80, 0xFF, 0xFC, 0x06, 0x90, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x2F, 0xF0, 0x7F, 0x00, 0x3F, 0xF0, 0x7F, 0x00, 0xBF, 0xF0, 0x7F,
-    0x00, 0xFF, 0xF0, 0x7F, 0x02, 0xFF, 0xF4, 0x7F, 0x03, 0xFF, 0xF4, 0x3F, 0x4B, 0xFB, 0xF4, 0x3F,
-    0x4F, 0xEB, 0xF8, 0x3F, 0x5F, 0xCB, 0xF8, 0x3F, 0xBF, 0x8B, 0xF8, 0x3F, 0xFF, 0x4F, 0xF8, 0x3F,
-    0xFF, 0x0F, 0xFC, 0x3F, 0xFD, 0x0F, 0xFC, 0x3F, 0xFC, 0x0F, 0xFC, 0x3F, 0xF8, 0x0F, 0xFC, 0x2F,
-    0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xD0, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0xA8, 0x3F, 0x80, 0x0F, 0xC1, 0xFC, 0x01, 0xFC, 0x0F, 0xE0, 0x2F,
-    0x40, 0x7F, 0x43, 0xF0, 0x03, 0xFC, 0x7F, 0x00, 0x1F, 0xDB, 0xD0, 0x00, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x00, 0x1F, 0xE4,
-    0x00, 0x00, 0x68, 0x00, 0x1A, 0x7F, 0x40, 0x0B, 0xEF, 0xD0, 0x02, 0xFB, 0xF4, 0x00, 0xBE, 0xFD,
-    0x00, 0x2F, 0xBF, 0x40, 0x0B, 0xEF, 0xD0, 0x02, 0xFB, 0xF4, 0x00, 0xBE, 0xFD, 0x00, 0x2F, 0xBF,
-    0x40, 0x0B, 0xEF, 0xD0, 0x02, 0xFB, 0xF4, 0x00, 0xBE, 0xFD, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9,
-    0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00,
-    0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F,
-    0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD7, 0xFF, 0xFE,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFA, 0x80, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xF0, 0xFC, 0x07, 0xE3, 0xF0, 0x0B, 0xCF, 0xC0, 0x2F, 0x3F, 0x56, 0xFC, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xF0, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x7E, 0xAB, 0xF0,
-    0x7C, 0x00, 0xF8, 0x7C, 0x00, 0xBC, 0x7C, 0x00, 0xF8, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0x7F,
-    0xFF, 0xE0, 0x7C, 0x01, 0xFC, 0x7C, 0x00, 0x3D, 0x7C, 0x00, 0x3E, 0x7C, 0x01, 0xFE, 0x7F, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFE, 0xBE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x01, 0xF8, 0x0F, 0xD0, 0x00, 0x7E,
-    0x03, 0xF4, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x02, 0xF4, 0x0F, 0xE0, 0x00,
-    0xBD, 0x03, 0xF8, 0x00, 0x2F, 0x40, 0xFE, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x0B, 0xF0, 0x0F, 0xE0,
-    0x1B, 0xFD, 0x57, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xD0, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xA0, 0x7F, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x1F, 0xFF, 0xF4, 0x07, 0xFF,
-    0xFD, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xD5, 0x55, 0x0B, 0xFF, 0xFF, 0xD2, 0xFF,
-    0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFC, 0x0F, 0xFE, 0x07, 0xFC, 0x00,
-    0x1F, 0xF0, 0xBF, 0xE0, 0xFF, 0x40, 0x00, 0xFF, 0x4B, 0xFD, 0x1F, 0xE0, 0x00, 0x07, 0xFC, 0x7F,
-    0xD3, 0xFC, 0x00, 0x00, 0x2F, 0xD7, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x7F, 0xDF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFB, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFB, 0xFE, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x7F, 0xCB, 0xFF,
-    0x80, 0x0F, 0xFF, 0x87, 0xFD, 0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0xBF, 0xD0, 0xFF, 0xFC, 0x01, 0x64,
-    0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x05, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0xC0, 0x7F,
-    0xFD, 0x01, 0xFF, 0xD0, 0x01, 0x6F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x94, 0x00, 0xFE, 0x7F,
-    0xAF, 0xF5, 0xFF, 0xFF, 0xC7, 0xFF, 0xFD, 0x06, 0xFF, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x0F, 0xF0, 0xBF, 0x00, 0x2F, 0xF0, 0x7F, 0x00, 0x3F, 0xF0, 0x7F, 0x00, 0xBF, 0xF0, 0x7F, 0x00,
-    0xFF, 0xF0, 0x7F, 0x02, 0xFF, 0xF4, 0x7F, 0x03, 0xFF, 0xF4, 0x3F, 0x4B, 0xFB, 0xF4, 0x3F, 0x4F,
-    0xEB, 0xF8, 0x3F, 0x5F, 0xCB, 0xF8, 0x3F, 0xBF, 0x8B, 0xF8, 0x3F, 0xFF, 0x4F, 0xF8, 0x3F, 0xFF,
-    0x0F, 0xFC, 0x3F, 0xFD, 0x0F, 0xFC, 0x3F, 0xFC, 0x0F, 0xFC, 0x3F, 0xF8, 0x0F, 0xFC, 0x2F, 0xF0,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x0F, 0xF0, 0xBF, 0x00, 0x2F, 0xF0, 0x7F, 0x00, 0x3F, 0xF0, 0x7F, 0x00, 0xBF, 0xF0, 0x7F, 0x00,
-    0xFF, 0xF0, 0x7F, 0x02, 0xFF, 0xF4, 0x7F, 0x03, 0xFF, 0xF4, 0x3F, 0x4B, 0xFB, 0xF4, 0x3F, 0x4F,
-    0xEB, 0xF8, 0x3F, 0x5F, 0xCB, 0xF8, 0x3F, 0xBF, 0x8B, 0xF8, 0x3F, 0xFF, 0x4F, 0xF8, 0x3F, 0xFF,
-    0x0F, 0xFC, 0x3F, 0xFD, 0x0F, 0xFC, 0x3F, 0xFC, 0x0F, 0xFC, 0x3F, 0xF8, 0x0F, 0xFC, 0x2F, 0xF0,
-    0x0F, 0xFC, 0x0F, 0xE0, 0x7F, 0xC0, 0x0F, 0xE0, 0xFF, 0x40, 0x0F, 0xD1, 0xFF, 0x00, 0x0F, 0xD3,
-    0xFC, 0x00, 0x0F, 0xCB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0x9F, 0xFE, 0x00, 0x7F, 0x8B,
-    0xFF, 0x80, 0x7F, 0x83, 0xFF, 0xF0, 0xBF, 0x80, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xD0, 0xFD, 0x01, 0xFC, 0x0F, 0xD0, 0x1F, 0xC0, 0xFD, 0x02,
-    0xFC, 0x0F, 0xD0, 0x2F, 0xC0, 0xFD, 0x02, 0xFC, 0x0F, 0xD0, 0x2F, 0x80, 0xFD, 0x03, 0xF8, 0x0F,
-    0xD0, 0x3F, 0x80, 0xFD, 0x03, 0xF8, 0x1F, 0xD0, 0x3F, 0x41, 0xFD, 0x2F, 0xF4, 0x1F, 0xD3, 0xFF,
-    0x01, 0xFD, 0x3F, 0x80, 0x1A, 0x90, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0xBF, 0xC0, 0x03,
-    0xFC, 0xBF, 0xD0, 0x0B, 0xFD, 0xBF, 0xF0, 0x0F, 0xFD, 0xBF, 0xF4, 0x2F, 0xFD, 0xBF, 0xF8, 0x3F,
-    0xFD, 0xBF, 0xFC, 0x7F, 0xFD, 0xBE, 0xFE, 0xFE, 0xFD, 0xFE, 0xBF, 0xFD, 0xFD, 0xFE, 0x7F, 0xFC,
-    0xFD, 0xFE, 0x3F, 0xF8, 0xFD, 0xFE, 0x2F, 0xF4, 0xFD, 0xFE, 0x1F, 0xF0, 0xFD, 0xFF, 0x0F, 0xE0,
-    0xFD, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFE, 0x55, 0x00, 0x00, 0x54, 0x3F, 0x40, 0x03,
-    0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03,
-    0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03,
-    0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0xFD, 0xBF, 0xEA, 0xAB, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0xBF, 0xC0, 0x07,
-    0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8,
-    0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00,
-    0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00, 0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xF3, 0xF4, 0x01, 0xFC, 0xFE, 0x00, 0x7F, 0x3F, 0x80, 0x1F, 0xCF, 0xE0,
-    0x07, 0xF3, 0xF8, 0x01, 0xFC, 0xFE, 0x00, 0x7F, 0x3F, 0x80, 0x1F, 0xCF, 0xE0, 0x07, 0xF3, 0xF8,
-    0x01, 0xFC, 0xFE, 0x00, 0xBF, 0x3F, 0x80, 0x2F, 0xCF, 0xE0, 0x0B, 0xF3, 0xF8, 0x02, 0xFC, 0x55,
-    0x00, 0x15, 0x00, 0x1A, 0xA9, 0x40, 0x0B, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xD0, 0xFD, 0x01, 0xFC,
-    0x3F, 0x40, 0x2F, 0x4F, 0xD0, 0x0B, 0xE3, 0xF4, 0x07, 0xF8, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x01, 0xFF, 0x94, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00,
-    0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x2A, 0x00, 0x0A, 0x83, 0xF8, 0x00, 0xFC, 0x1F, 0xC0, 0x1F, 0xC0, 0xFE, 0x02, 0xF4,
-    0x07, 0xF4, 0x3F, 0x00, 0x3F, 0xC7, 0xF0, 0x01, 0xFD, 0xBD, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x01, 0xFC, 0x00, 0x0A, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x1F, 0xFF, 0xFF, 0xF4, 0x3D, 0x0F, 0xE0,
-    0x7C, 0x3C, 0x0F, 0xE0, 0x3D, 0x7C, 0x0F, 0xE0, 0x3D, 0x3F, 0x5F, 0xF5, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x7F, 0x40, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x1F, 0xD0, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xDF, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x3F, 0xE1, 0xFF,
-    0x80, 0x3F, 0xF0, 0x3F, 0xF4, 0x2F, 0xF4, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0xBF, 0xE0, 0xBC, 0x00,
-    0xBC, 0x2F, 0x40, 0x2F, 0x0B, 0xD0, 0x0B, 0xC2, 0xF4, 0x02, 0xF0, 0xFD, 0x00, 0xFC, 0x3F, 0x40,
-    0x3F, 0x0F, 0xD0, 0x0F, 0xC3, 0xF4, 0x03, 0xF0, 0xFD, 0x00, 0xFC, 0x3F, 0x40, 0x3F, 0x4F, 0xD0,
-    0x0F, 0xD3, 0xF4, 0x03, 0xF4, 0xFE, 0x00, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF,
-    0xFF, 0xFE, 0x55, 0x55, 0x7F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0xBC, 0x3D, 0x00, 0xBC, 0x3D, 0x00, 0xBC, 0x3C, 0x00, 0xBC, 0x3C, 0x00,
-    0xFC, 0x7C, 0x00, 0xFC, 0x7C, 0x01, 0xFC, 0x3F, 0x47, 0xFC, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xBD,
-    0x07, 0xF9, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0xBD,
-    0x05, 0x41, 0xFB, 0xF8, 0x3F, 0x47, 0xEF, 0xE0, 0xFD, 0x1F, 0xBF, 0x43, 0xF4, 0x7E, 0xFD, 0x0F,
-    0xD1, 0xFB, 0xF4, 0x3F, 0x47, 0xEF, 0xD0, 0xFD, 0x1F, 0xBF, 0x42, 0xF4, 0x7E, 0xFD, 0x0B, 0xD0,
-    0xFB, 0xF4, 0x2F, 0x43, 0xEF, 0xD0, 0xBD, 0x0F, 0xBF, 0x42, 0xF4, 0x3E, 0xFD, 0x0B, 0xD0, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x54, 0xA9,
-    0x00, 0x01, 0xA4, 0x3F, 0x83, 0xF4, 0x7E, 0x0F, 0xE0, 0xFD, 0x1F, 0x83, 0xF4, 0x3F, 0x47, 0xE0,
-    0xFD, 0x0F, 0xD1, 0xF8, 0x3F, 0x43, 0xF4, 0x7E, 0x0F, 0xD0, 0xFD, 0x1F, 0x83, 0xF4, 0x2F, 0x47,
-    0xE0, 0xFD, 0x0B, 0xD1, 0xF8, 0x3F, 0x42, 0xF4, 0x3E, 0x0F, 0xC0, 0xBD, 0x0F, 0x83, 0xF0, 0x2F,
-    0x43, 0xE0, 0xFC, 0x0B, 0xD0, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x02, 0xF8, 0x15, 0x6D, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x55, 0x00,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0xFD, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x50, 0x00,
-    0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00,
-    0x00, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xFD, 0x54, 0x00, 0x00,
-    0xFC, 0xFF, 0xFF, 0x80, 0x00, 0xFD, 0xFF, 0xFF, 0xE0, 0x00, 0xFD, 0xFC, 0x0B, 0xF0, 0x00, 0xFD,
-    0xFC, 0x03, 0xF0, 0x00, 0xFE, 0xFC, 0x03, 0xF4, 0x01, 0xFE, 0xFC, 0x07, 0xF0, 0x01, 0xFE, 0xFF,
-    0xFF, 0xF0, 0x01, 0xFE, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x50, 0x00,
-    0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xD5,
-    0x40, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE3, 0xF0, 0x2F, 0xCF, 0xC0, 0x3F, 0x3F, 0x00, 0xFD, 0xFC,
-    0x07, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFD, 0x3F, 0xFF, 0x80, 0x00, 0x6F, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x0F, 0xFE, 0xFF, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x6A, 0x00,
-    0x02, 0xFC, 0x00, 0x55, 0x56, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0xFF, 0xD0, 0x0B, 0xFC, 0xBF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x6F, 0x80, 0x1F, 0x41, 0xFF, 0xFD, 0x07, 0xC0, 0xFF, 0xFF, 0xC1, 0xF0,
-    0xBF, 0x42, 0xF8, 0x7C, 0x3F, 0x00, 0x3F, 0x1F, 0x1F, 0x80, 0x0B, 0xD7, 0xFF, 0xD0, 0x01, 0xF5,
-    0xFF, 0xF4, 0x00, 0x3D, 0x7F, 0xFD, 0x00, 0x0F, 0x4F, 0xFF, 0x40, 0x07, 0xD3, 0xDB, 0xF0, 0x02,
-    0xF4, 0xF0, 0xFF, 0x02, 0xFC, 0x3C, 0x3F, 0xFF, 0xFF, 0x0F, 0x0B, 0xFF, 0xFF, 0x43, 0xC0, 0xBF,
-    0xFF, 0x80, 0xF0, 0x06, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x03, 0xF5, 0x5F,
-    0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xC0, 0x0F, 0xC0, 0xFC, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0x7F,
-    0x55, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x7F, 0x47, 0xFD,
-    0x0F, 0xF0, 0x3F, 0xD1, 0xFE, 0x03, 0xFE, 0x2F, 0xF0, 0x3F, 0xE3, 0xFF, 0x03, 0xFE, 0x3F, 0xF0,
-    0x3F, 0xE7, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF,
-    0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC,
-    0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x01, 0xE0, 0x01, 0xBF, 0xF0, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFD, 0x03,
-    0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x90, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE3,
-    0xFF, 0x07, 0xFC, 0xFF, 0x00, 0xBF, 0x6F, 0xC0, 0x1F, 0xDB, 0xF0, 0x07, 0xF5, 0xFE, 0x07, 0xFC,
-    0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xB9, 0x00, 0x7F, 0xFD, 0x01,
-    0xFF, 0xFE, 0x07, 0xC0, 0x7C, 0x1F, 0x00, 0xF0, 0x7C, 0x0B, 0xC1, 0xFF, 0xFD, 0x07, 0xFF, 0xFD,
-    0x1F, 0x00, 0xFC, 0x7C, 0x02, 0xF5, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x1F, 0xFF, 0xE0, 0xBF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xAA,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x1F, 0x8B,
-    0xF0, 0x00, 0x7E, 0x1F, 0xC0, 0x02, 0xF4, 0x7F, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x7F, 0x07, 0xF0,
-    0x03, 0xF8, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xC0, 0x03, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF,
-    0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x07,
-    0xF8, 0x1F, 0xF4, 0x2F, 0xC0, 0x03, 0xFD, 0x1F, 0xF0, 0x7F, 0x80, 0x00, 0xFF, 0x0F, 0xF0, 0xFF,
-    0x00, 0x00, 0x7F, 0x8F, 0xF2, 0xFD, 0x00, 0x00, 0x2F, 0xCF, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xEF, 0xFB, 0xFF, 0x40, 0x0F, 0xFF, 0x6F,
-    0xF5, 0xFF, 0xE0, 0x3F, 0xFD, 0x2F, 0xF8, 0xBF, 0xFC, 0x2F, 0xD0, 0x7E, 0xF8, 0x00, 0x2C, 0x00,
-    0x3C, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x7C, 0x10, 0x3C, 0x7F, 0xFC, 0xBF, 0xF8, 0x6B, 0x90, 0xFC,
-    0x00, 0xFD, 0xFC, 0x02, 0xFE, 0xFC, 0x07, 0xFE, 0xFC, 0x0F, 0xFE, 0xFC, 0x2F, 0xFE, 0xFC, 0x7F,
-    0x7E, 0xFC, 0xFE, 0x7E, 0xFE, 0xFC, 0x7E, 0xFF, 0xF4, 0x7E, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0, 0xBF,
-    0xFF, 0x40, 0xBF, 0xAA, 0x00, 0x6A, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xC3, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xF0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x50, 0xB4,
-    0x0F, 0xC2, 0xE0, 0x7F, 0x0B, 0x83, 0xFD, 0x2E, 0x0F, 0xF4, 0xBC, 0xBF, 0xD1, 0xF3, 0xDF, 0x87,
-    0xEF, 0x3E, 0x1F, 0xF5, 0xF8, 0x7F, 0xC7, 0xF1, 0xFE, 0x1F, 0xC3, 0xF0, 0x7F, 0x0F, 0x83, 0xF0,
-    0x03, 0xE3, 0xF4, 0x01, 0xF5, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFE, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xEF, 0xF0, 0x03, 0xF2, 0xFF,
-    0x41, 0xFC, 0x2F, 0xF8, 0x07, 0xFF, 0xE0, 0x7F, 0xFE, 0x03, 0xD3, 0xE0, 0x7C, 0x3E, 0x07, 0xC3,
-    0xE0, 0x7C, 0x3E, 0x07, 0xC3, 0xE0, 0xBC, 0x3E, 0x0B, 0xC3, 0xE0, 0xB8, 0x3E, 0x3F, 0x83, 0xE3,
-    0xF0, 0x14, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x43, 0xF8, 0x03, 0xF8, 0x3F, 0xC0, 0x7F, 0x83,
-    0xFD, 0x0F, 0xF8, 0x7F, 0xE0, 0xFF, 0x87, 0xFF, 0x2F, 0xF8, 0x7E, 0xFB, 0xFF, 0xC7, 0xDF, 0xFD,
-    0xFC, 0x7D, 0xBF, 0xDF, 0xC7, 0xD7, 0xFC, 0xFC, 0x7E, 0x3F, 0x9F, 0xCB, 0xE2, 0xF5, 0xFC, 0xBE,
-    0x05, 0x1F, 0xC0, 0x3E, 0x00, 0x2F, 0x0F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC,
-    0x3F, 0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xD7, 0xF4, 0x07, 0xF9, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x80, 0x01, 0xBE,
-    0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E,
-    0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01,
-    0xBE, 0x40, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFE, 0x55, 0xFD, 0xFD, 0x00, 0xBD, 0xFD, 0x00,
-    0xBE, 0xFD, 0x00, 0xBE, 0xFD, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE,
-    0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xA9, 0x00, 0xA9, 0x00, 0x01, 0x40, 0x01, 0xFA, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xC1, 0xF4, 0x0F, 0xF0, 0x07, 0xC0, 0xFF, 0x00, 0x3C, 0x0F, 0xF0,
-    0x03, 0xC0, 0xFF, 0x00, 0x3D, 0x0F, 0xF0, 0x07, 0xC0, 0xFF, 0xE6, 0xFC, 0x1F, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0x03, 0xF8, 0x69, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFE, 0x00, 0xFF, 0xFC, 0x0B, 0xFE, 0xF0, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0x40, 0x00, 0xBE, 0x00, 0x01, 0xFD, 0x04, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x02, 0xBF, 0x80,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xCF, 0xAB, 0xFA, 0xB0, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x6A, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC3, 0xF4,
-    0x02, 0xF8, 0x2F, 0xC0, 0x3F, 0x40, 0xFD, 0x03, 0xF0, 0x0B, 0xF0, 0x7E, 0x00, 0x3F, 0x8F, 0xD0,
-    0x02, 0xFD, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x1A, 0xFF, 0x80, 0x02,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x01, 0xFC, 0x1F, 0x47, 0xF8, 0x3F, 0x01, 0xF4, 0x0F,
-    0xC3, 0xF0, 0x1F, 0x40, 0xFC, 0x3F, 0x01, 0xF4, 0x0F, 0xC3, 0xF0, 0x1F, 0x40, 0xFC, 0x2F, 0x81,
-    0xF4, 0x2F, 0xC1, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFE, 0x40,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x3F, 0x80, 0xBE, 0x00, 0x3F,
-    0x07, 0xF0, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0xFF, 0x4B, 0xF8,
-    0x0B, 0xF8, 0x0F, 0xF4, 0x2A, 0x80, 0x0A, 0xA0, 0xFD, 0x00, 0xFC, 0x3F, 0x40, 0x3F, 0x0F, 0xD0,
-    0x0F, 0xC3, 0xF4, 0x03, 0xF0, 0xBD, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0x0B, 0xD0, 0x0F, 0xC2, 0xF4,
-    0x03, 0xF0, 0xBD, 0x00, 0xFC, 0x2F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x10, 0x04, 0xB0, 0x2C, 0xB0, 0x2C, 0xE0,
-    0x2C, 0xE0, 0x3D, 0xF4, 0x7D, 0xBF, 0xFD, 0x3F, 0xED, 0x00, 0x1D, 0x00, 0x1D, 0x00, 0x2D, 0xFE,
-    0x06, 0x81, 0xFB, 0xF8, 0x3F, 0x47, 0xEF, 0xE0, 0xFD, 0x1F, 0xBF, 0x83, 0xF4, 0x7E, 0xFD, 0x0F,
-    0xD1, 0xFB, 0xF4, 0x2F, 0x47, 0xEF, 0xD0, 0xBD, 0x0F, 0xBF, 0x42, 0xF4, 0x3E, 0xFD, 0x0B, 0xD0,
-    0xFB, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x06, 0x81, 0xF8, 0x3F, 0x83, 0xF4, 0x7E, 0x0F, 0xE0, 0xFD, 0x1F, 0x83, 0xF8, 0x3F, 0x47,
-    0xE0, 0xFD, 0x0F, 0xD1, 0xF8, 0x3F, 0x42, 0xF4, 0x7E, 0x0F, 0xD0, 0xBD, 0x0F, 0x83, 0xF4, 0x2F,
-    0x43, 0xE0, 0xFD, 0x0B, 0xD0, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xA4, 0xBF, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xF0, 0x7D, 0x00, 0xF0, 0x3E, 0x00,
-    0xF1, 0xBD, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBC,
-    0x10, 0x00, 0x00, 0xBC, 0x38, 0x00, 0x00, 0x7C, 0x38, 0x00, 0x00, 0x7C, 0x38, 0x00, 0x00, 0x7C,
-    0x38, 0x00, 0x00, 0x7C, 0x3F, 0xF8, 0x00, 0x7C, 0x3F, 0xFF, 0x00, 0x7C, 0x3C, 0x1F, 0x40, 0x7D,
-    0x3C, 0x0F, 0x40, 0x7D, 0x3C, 0x2F, 0x40, 0xBD, 0x3F, 0xFF, 0x00, 0xBE, 0x3F, 0xF8, 0x00, 0xBE,
-    0x14, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0xF0,
-    0xF0, 0x7D, 0x3C, 0x0F, 0x8F, 0x1B, 0xE3, 0xFF, 0xF0, 0xFF, 0xE0, 0x01, 0x94, 0x00, 0xFF, 0xFD,
-    0x03, 0x40, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x0A, 0xAB, 0xE0, 0x3F, 0xFF, 0x80, 0x00,
-    0x7E, 0x10, 0x03, 0xF4, 0xFA, 0xBF, 0x87, 0xFF, 0xFC, 0x06, 0xFE, 0x40, 0xB4, 0x0B, 0xF4, 0x0B,
-    0x47, 0xFF, 0xE0, 0xB4, 0xFD, 0x6F, 0x4B, 0x4F, 0x00, 0xB8, 0xBA, 0xF0, 0x07, 0xCB, 0xFE, 0x00,
-    0x3C, 0xBF, 0xE0, 0x03, 0xCB, 0xAF, 0x00, 0x7C, 0xB1, 0xFD, 0x6F, 0x8B, 0x0F, 0xFF, 0xF4, 0xB0,
-    0x7F, 0xFE, 0x0B, 0x01, 0xBF, 0x40, 0x00, 0x7F, 0xFD, 0x00, 0xBF, 0xAF, 0x40, 0x7C, 0x03, 0xD0,
-    0x2F, 0x00, 0xF8, 0x0B, 0xC0, 0x3E, 0x01, 0xFE, 0x5F, 0x80, 0x2F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFC,
-    0x07, 0xF0, 0xFF, 0x03, 0xF4, 0x2F, 0xC0, 0xFD, 0x0B, 0xF0, 0xBF, 0x43, 0xFC, 0x3F, 0xE0, 0xFF,
-    0x00, 0x0A, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD,
-    0x01, 0xBF, 0xE0, 0x0F, 0xC3, 0xF0, 0x0F, 0xC3, 0xF0, 0x0F, 0xD3, 0xF4, 0x1F, 0xD7, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE,
-    0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD,
-    0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01,
-    0xBF, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x16, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x7E, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xEB, 0xF0, 0x00, 0xFE, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0xF8, 0x01, 0xFC,
-    0x00, 0xF8, 0x01, 0xFC, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x02, 0xFC,
-    0x02, 0xFD, 0x02, 0xFD, 0x07, 0xFF, 0x03, 0xFD, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0x40, 0x02, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xEA, 0xA8, 0xFE, 0x00, 0x03, 0xF8,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x0B, 0xFF, 0xE0, 0x1F, 0x41,
-    0xF8, 0x3E, 0x00, 0x68, 0x3F, 0xAA, 0x40, 0x3F, 0xFF, 0x80, 0x3D, 0x00, 0x00, 0x3F, 0x00, 0xA8,
-    0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40, 0x50, 0x0F, 0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0x95, 0xFE, 0x3F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8,
-    0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x2A, 0x80, 0x00, 0x00,
-    0x01, 0xA0, 0x1F, 0x41, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x83,
-    0xF8, 0x3F, 0xC0, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7F, 0x1F, 0xCB, 0xF6, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x02, 0xF4, 0x00, 0x2F, 0x40, 0x02, 0xF4, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0xC0,
-    0x00, 0x54, 0x00, 0xF8, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF4, 0x01, 0xF4, 0x01, 0xF4, 0x01, 0xF4,
-    0x01, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xF0, 0x07, 0xF0, 0x7F, 0xF0, 0x7F, 0xE0, 0xBF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x03, 0xC0, 0xF0,
-    0x00, 0x0F, 0x03, 0xEA, 0x00, 0x3C, 0x0F, 0xFF, 0x40, 0xF0, 0x3C, 0x2F, 0x03, 0xC0, 0xF0, 0x3C,
-    0x0F, 0x03, 0xC2, 0xF0, 0x3C, 0x0F, 0xFF, 0x87, 0xE0, 0x3F, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x20, 0x00, 0x78, 0x07, 0x00, 0x07, 0x80, 0x74,
-    0x00, 0x78, 0x07, 0x40, 0x07, 0xFF, 0xFD, 0x50, 0x7F, 0xFF, 0xFF, 0x87, 0x80, 0x74, 0x7D, 0x78,
-    0x07, 0x42, 0xE7, 0x80, 0x74, 0x3E, 0x78, 0x07, 0xFF, 0xC7, 0x80, 0x7F, 0xF4, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x16, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7E, 0xFD, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xEF,
-    0xF0, 0x00, 0xFE, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0xF8, 0x01, 0xFC, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFD, 0x02,
-    0xFC, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x3E, 0x3F, 0x40, 0x1F,
-    0x5F, 0xC0, 0x07, 0xDF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x0F,
-    0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFE, 0xFF, 0x00, 0x3F, 0x2F, 0xF4, 0x1F, 0xC2, 0xFF, 0x80,
-    0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0xFC, 0x02, 0xFE, 0xFC, 0x07, 0xFE, 0xFC, 0x0F,
-    0xFE, 0xFC, 0x2F, 0xFE, 0xFC, 0x7F, 0x7E, 0xFC, 0xFE, 0x7E, 0xFE, 0xFC, 0x7E, 0xFF, 0xF4, 0x7E,
-    0xFF, 0xE0, 0x7F, 0xFF, 0xC0, 0xBF, 0xFF, 0x40, 0xBF, 0xAA, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x07, 0xE0, 0x07, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x0F, 0xC3, 0xF4, 0x02, 0xF8, 0x2F, 0xC0, 0x3F, 0x40, 0xFD, 0x03, 0xF0, 0x0B, 0xF0, 0x7E,
-    0x00, 0x3F, 0x8F, 0xD0, 0x02, 0xFD, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0x1A, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x68, 0x01,
-    0x97, 0xC0, 0x2E, 0x7C, 0x02, 0xE7, 0xC0, 0x2E, 0x7C, 0x02, 0xE7, 0xC0, 0x2E, 0x7C, 0x02, 0xE7,
-    0xC0, 0x2E, 0x7C, 0x02, 0xE7, 0xD5, 0x7E, 0x7F, 0xFF, 0xE7, 0xFF, 0xFE, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0x00, 0x16, 0xFD, 0x54, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xF9, 0x5F, 0xC0, 0x1F, 0xC0, 0x2F, 0x00, 0x7F, 0x00,
-    0x7C, 0x00, 0xFE, 0x5B, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2A, 0xFE, 0xA4, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x7F, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0xD0,
-    0x3F, 0x00, 0x7F, 0x40, 0x7C, 0x00, 0xFE, 0x07, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x01, 0xFD,
-    0xBE, 0x7F, 0x00, 0x03, 0xF4, 0xBE, 0x2F, 0xC0, 0x07, 0xF0, 0xBE, 0x0F, 0xC0, 0x0B, 0xF0, 0xBE,
-    0x0F, 0xE0, 0x0F, 0xE0, 0xBE, 0x0B, 0xF0, 0x2F, 0xD0, 0xBE, 0x07, 0xF4, 0x3F, 0xC0, 0xFE, 0x03,
-    0xFC, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0x07, 0xF0, 0x01,
-    0xFC, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x3D, 0xFB, 0xE0, 0x0B, 0x8F, 0x4F,
-    0x00, 0xF4, 0xF4, 0xF8, 0x1F, 0x0F, 0x4B, 0xC3, 0xF0, 0xF4, 0x7D, 0x00, 0x00, 0x01, 0xA4, 0x02,
-    0xFE, 0x01, 0xFC, 0x0F, 0xFF, 0xC0, 0xFD, 0x1F, 0xFF, 0xF1, 0xFC, 0x2F, 0xCB, 0xFF, 0xFC, 0x3F,
-    0xC2, 0xFF, 0xF8, 0x3F, 0xC0, 0xFF, 0xE0, 0x0A, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xF0, 0x2F, 0xF0, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0x40, 0x07, 0xF8, 0xFF,
-    0x00, 0x03, 0xFC, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xBF,
-    0xE5, 0x6F, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFE, 0x0F, 0xC2, 0xFF, 0xF3,
-    0xF0, 0xFC, 0xBF, 0xF8, 0x3F, 0x0B, 0xFD, 0x0B, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0x00, 0xFF, 0xAF,
-    0xF0, 0x7F, 0x00, 0xFD, 0x2F, 0x40, 0x2F, 0x8F, 0xD0, 0x07, 0xE2, 0xF4, 0x02, 0xF8, 0xBF, 0x41,
-    0xFD, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x01, 0xBE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x7F, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00,
-    0x7F, 0x40, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x02, 0xFD,
-    0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x0F, 0xF8, 0x00,
-    0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xE7, 0xC0, 0x02, 0xF8, 0x3D, 0x00, 0x3E, 0x03, 0xF0,
-    0x0B, 0xD0, 0x2F, 0x40, 0xFC, 0x00, 0xF8, 0x1F, 0x80, 0x0F, 0xC3, 0xF4, 0x00, 0xBE, 0x7F, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x1A, 0x00, 0x0B, 0xC0, 0x03, 0xF2, 0xFF, 0xFC, 0xBF, 0xFF, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0x54, 0x00, 0x00, 0x69, 0x00, 0x00, 0x7E, 0x7F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xFE, 0xBE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0xA0,
-    0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x6F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF7, 0xFE, 0xAA, 0x8F, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x2A, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFD,
-    0x0B, 0xFF, 0xFF, 0xE0, 0xBE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x05, 0xFF, 0x55, 0x54, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0xFF, 0xFE, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0xBF,
-    0xFF, 0xC7, 0xFE, 0xA8, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x43, 0xFD, 0x55, 0x50, 0x2F,
-    0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xEF, 0xE4,
-    0x02, 0xFF, 0xFF, 0xE0, 0x2F, 0xFE, 0xFF, 0x42, 0xFD, 0x02, 0xFC, 0x2F, 0xC0, 0x0F, 0xC2, 0xF8,
-    0x00, 0xBC, 0x2F, 0x80, 0x0F, 0xC2, 0xF8, 0x01, 0xFC, 0x2F, 0x82, 0xFF, 0xC2, 0xFC, 0x2F, 0xF4,
-    0x2F, 0xC2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0xB4, 0x00, 0xB4, 0x00, 0xBA,
-    0x90, 0xFF, 0xFC, 0xF8, 0x3D, 0xF4, 0x1E, 0xF4, 0x1E, 0xF4, 0xFD, 0xF4, 0xF8, 0x00, 0x00, 0x03,
-    0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0x40, 0x07, 0xFC, 0x2F, 0xFF, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0xBF,
-    0xFC, 0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFF, 0xE2, 0xFD, 0x00, 0x00, 0x2F, 0xD7, 0xFF, 0x9F, 0xF0,
-    0x00, 0x00, 0x3F, 0xDF, 0xFD, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xBF, 0xFB, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0x6F, 0xF3, 0xFF, 0xC0, 0x00, 0xFF, 0xF4, 0xBF, 0xC7, 0xFF, 0xC0, 0x0F, 0xFF, 0x82, 0xFF, 0x0B,
-    0xFF, 0xC0, 0xFF, 0xFC, 0x0B, 0xFC, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x0B, 0xD2, 0xFF, 0x0F, 0xC0, 0x0F, 0xCB, 0xFC, 0xBD, 0x00, 0x1F, 0x9F,
-    0xF3, 0xE0, 0x00, 0x2F, 0x7F, 0xAF, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFB, 0xF7, 0xFC, 0x00, 0xBF, 0x8F, 0xD7, 0xFC, 0x0F, 0xFC, 0x3F, 0x4B, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x64, 0x00, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFE, 0x05, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0xC0, 0x7F, 0xFD, 0x01,
-    0xFF, 0xD0, 0x01, 0x6F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x98, 0x00, 0xFE, 0x7F, 0xBF, 0xF5,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFD, 0x06, 0xFF, 0x80, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0x2F, 0xD0, 0x7E, 0xF8, 0x00, 0x2C, 0x00, 0x3C, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x7C, 0x00,
-    0x3C, 0x3F, 0xFC, 0xBF, 0xFC, 0xBF, 0xE0, 0x1E, 0x00, 0x1F, 0x80, 0x3B, 0xE0, 0x01, 0xE0, 0x2F,
-    0xD0, 0x3F, 0x80, 0x0F, 0xE0, 0x7F, 0xC0, 0x03, 0xF8, 0x3F, 0xD0, 0x00, 0xFD, 0x1F, 0xF0, 0x00,
-    0x3F, 0x4F, 0xF0, 0x00, 0x0F, 0xDB, 0xF8, 0x00, 0x07, 0xF7, 0xFC, 0x00, 0x01, 0xFE, 0xFD, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xF9,
-    0xFF, 0xE0, 0x01, 0xFE, 0x2F, 0xFE, 0x00, 0x7F, 0x83, 0xFF, 0xF5, 0x2F, 0xE0, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x4F, 0xC0, 0x0F, 0x1F, 0x80, 0x1F, 0x3F, 0x00, 0x1F, 0x7D, 0x00, 0x2F, 0xF8, 0x00,
-    0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x3E, 0xFF, 0x40, 0x3E,
-    0x3F, 0xD0, 0x7E, 0x1F, 0xFE, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xD0, 0x0F, 0xC0, 0x00, 0x7F, 0x80, 0x0F, 0xC0, 0x00,
-    0xFF, 0x00, 0x0F, 0xC0, 0x02, 0xFE, 0x00, 0x1F, 0xCF, 0x47, 0xFC, 0x00, 0x1F, 0xCF, 0x4F, 0xF4,
-    0x00, 0x1F, 0xCF, 0x6F, 0xF0, 0x00, 0x2F, 0xCF, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00,
-    0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x9F, 0x7F, 0xF8, 0x00, 0x3F,
-    0x9F, 0x4F, 0xFE, 0x00, 0x3F, 0x85, 0x07, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0xFF, 0xE0, 0x3F, 0x80,
-    0x00, 0xBF, 0xF8, 0x2A, 0x40, 0x00, 0x2A, 0xA9, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xD0, 0x3C,
-    0x00, 0xFC, 0x03, 0xC0, 0x2F, 0x40, 0x3C, 0xD7, 0xE0, 0x07, 0xDE, 0xFC, 0x00, 0x7F, 0xFF, 0x40,
-    0x07, 0xFF, 0xF4, 0x00, 0xBD, 0xEF, 0xE0, 0x0B, 0xDD, 0x7F, 0x80, 0xBC, 0x01, 0xFE, 0x0F, 0xC0,
-    0x0B, 0xFC, 0x0F, 0xE0, 0x7F, 0xC0, 0x1F, 0xF4, 0xFF, 0x40, 0x7F, 0xFE, 0xFE, 0x00, 0x0F, 0xD3,
-    0xFC, 0x00, 0x0F, 0xCB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0x9F, 0xFE, 0x00, 0x7F, 0x8B,
-    0xFF, 0x80, 0x7F, 0x83, 0xFF, 0xF0, 0xBF, 0x80, 0xFF, 0xFC, 0x02, 0xF4, 0x00, 0x02, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x03, 0xEB, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0x80, 0x02, 0xF9, 0xFF, 0x80, 0x0B, 0xF2, 0xFF, 0xC0, 0x3F, 0xC3, 0xFF, 0xC0, 0xFF, 0xFF,
-    0x81, 0xFF, 0x03, 0xFF, 0xFE, 0x0F, 0xF4, 0x05, 0x5B, 0xF4, 0x7F, 0xC0, 0x00, 0x0F, 0xD3, 0xFC,
-    0x00, 0x00, 0x3F, 0x2F, 0xE0, 0x00, 0x01, 0xFD, 0xFF, 0x00, 0x00, 0x07, 0xFB, 0xF4, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xE7, 0xFF, 0x80, 0x00, 0x7F, 0x8B, 0xFF, 0x80, 0x01, 0xFE, 0x0F, 0xFF, 0xC0, 0x0B,
-    0xF8, 0x0F, 0xFF, 0xC0, 0xFF, 0xF0, 0xFC, 0x2A, 0xFC, 0xBC, 0x00, 0x2E, 0x7E, 0x00, 0x0F, 0xBF,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFF,
-    0x80, 0x01, 0xF7, 0xF8, 0x00, 0xBC, 0x7F, 0xC0, 0x2F, 0x0B, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x0F,
-    0xD0, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x03, 0xFC,
-    0x1F, 0xE0, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x03,
-    0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x4B, 0xFE, 0xAA, 0xBF, 0xD2, 0xFF, 0x00, 0x1F, 0xF4, 0xBF,
-    0xC0, 0x07, 0xFF, 0x6F, 0xF0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x0A, 0x40, 0x7C, 0x01, 0xF0, 0x7C, 0x01, 0xF4, 0x7C, 0x01, 0xF4, 0x7C, 0x01,
-    0xF4, 0xBC, 0x01, 0xF4, 0xBD, 0x01, 0xF4, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF, 0xF8, 0xBF, 0xFF, 0xF8,
-    0xBE, 0x02, 0xF8, 0xBD, 0x02, 0xFC, 0xBE, 0x02, 0xFD, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x3F,
-    0x40, 0x03, 0xFF, 0xFF, 0xF8, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE3, 0xF8, 0x00, 0x3F, 0xD5, 0x55,
-    0x4F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xF0,
-    0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x03,
-    0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xAF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00,
-    0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0xFE, 0x7C, 0x01, 0xFE, 0xA9, 0x7C,
-    0x01, 0xF4, 0x00, 0x7C, 0x01, 0xF4, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0xBD,
-    0x01, 0xF4, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBD,
-    0x02, 0xF8, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x00,
-    0x3F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x1F,
-    0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xFB, 0xF9, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xFD,
-    0x07, 0xF0, 0x03, 0xFF, 0xFB, 0xFC, 0x1F, 0xC0, 0x0F, 0xFC, 0x02, 0xFC, 0x7F, 0x00, 0x3F, 0xE0,
-    0x03, 0xF1, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xC7, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0x1F, 0xC0, 0x0F,
-    0xF8, 0x01, 0xFC, 0x7F, 0x00, 0x3F, 0xE0, 0xBF, 0xF1, 0xFC, 0x00, 0xFF, 0xC2, 0xFF, 0x47, 0xF0,
-    0x03, 0xFF, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x01,
-    0xFE, 0x00, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xFE, 0x01, 0xFE,
-    0x00, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x02, 0xFF, 0xFE,
-    0x40, 0xFE, 0x02, 0xFF, 0xFF, 0xE0, 0x55, 0x02, 0xFF, 0xEF, 0xF4, 0x00, 0x02, 0xFD, 0x02, 0xFC,
-    0x00, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0xBC, 0x00, 0x02, 0xF8, 0x00, 0xBC, 0x00,
-    0x02, 0xF8, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x1F, 0xFC, 0x00, 0x02, 0xFC, 0x1F, 0xF4, 0x00, 0x02,
-    0xFC, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x06, 0x90, 0x00, 0x0F, 0xFF, 0x1F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFD, 0x1F, 0xD0, 0xBE, 0x03, 0xFC, 0x0F, 0xC0, 0x0F, 0xC1, 0xFC, 0x03, 0xF0,
-    0x03, 0xE0, 0x7F, 0x01, 0xF8, 0x02, 0xF4, 0x2F, 0xC0, 0x7E, 0x01, 0xFC, 0x0B, 0xF0, 0x1F, 0xC1,
-    0xFE, 0x01, 0xFD, 0x07, 0xF9, 0xFF, 0xB0, 0x3F, 0xD0, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xBF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xF1, 0xFE, 0x00, 0x2F,
-    0xFB, 0xFF, 0xF0, 0x1F, 0xC2, 0xF4, 0x7D, 0x0B, 0xC0, 0xF4, 0x0F, 0x43, 0xF0, 0x7C, 0x03, 0xC0,
-    0xF8, 0x1F, 0x02, 0xF0, 0x3E, 0x07, 0xD2, 0xF8, 0x0F, 0xC1, 0xFE, 0xFF, 0x82, 0xFD, 0x3F, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0xFF, 0xFC, 0x0B, 0xFE,
-    0xB0, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x01, 0xFE,
-    0x08, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x1A, 0xFF, 0x80, 0x7F, 0xC0, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xAA,
-    0xAF, 0xEA, 0xA8, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x7F, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFC, 0x29, 0xBD, 0x68, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x7F, 0x40, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x7F, 0x41, 0xFD,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0xFF, 0x0B, 0xF4, 0x00,
-    0x2F, 0xD3, 0xFC, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF2, 0xFC, 0x03, 0xF4, 0x3F, 0x01, 0xFC,
-    0x0F, 0xE0, 0xBE, 0x01, 0xFC, 0x3F, 0x40, 0x3F, 0x5F, 0xC0, 0x0F, 0xEB, 0xE0, 0x01, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x0F,
-    0xF0, 0x00, 0x7F, 0x42, 0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0,
-    0x00, 0xFF, 0x07, 0xF8, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xD0, 0x05, 0x5F,
-    0xF9, 0x50, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x15, 0x00, 0x05, 0x43, 0xF8, 0x02, 0xF8, 0x1F,
-    0xC0, 0x3F, 0x40, 0xFD, 0x07, 0xF0, 0x0B, 0xE0, 0xFE, 0x00, 0x7F, 0x0F, 0xC0, 0x03, 0xF5, 0xFC,
-    0x00, 0x2F, 0xBF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC5, 0x5B, 0xFD, 0x54, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x2A, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x07, 0xF4, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x3F,
-    0x80, 0x0F, 0xF0, 0x3F, 0xC0, 0x02, 0xFD, 0x1F, 0xD0, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xDF, 0xF8, 0x00,
-    0x7F, 0xD2, 0xFF, 0x40, 0x3F, 0xE0, 0x3F, 0xF0, 0x3F, 0xF0, 0x0F, 0xFE, 0x2F, 0xF8, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00,
-    0xBC, 0x1F, 0x01, 0xF0, 0x0F, 0xC3, 0xE0, 0x07, 0xEF, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFE, 0x00,
-    0x00, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xFF, 0xC0, 0x0F, 0xCB, 0xE0, 0x3F, 0x83, 0xF4, 0xBF,
-    0x03, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0xFF, 0xFF, 0xFC, 0x3F, 0x03, 0xFF, 0xFF, 0xF0,
-    0xFC, 0x0A, 0xAF, 0xFA, 0x83, 0xF0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x3F, 0x00,
-    0x02, 0xF8, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xBE,
-    0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0F,
-    0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x54, 0x3F, 0xFF, 0xCB, 0x00, 0xFF, 0xFF, 0x3C, 0x00, 0x0F,
-    0x40, 0xF0, 0x00, 0x3D, 0x03, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x0F, 0x40,
-    0xF0, 0x00, 0x3D, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x0B, 0xF0, 0xBF, 0x00, 0x7F, 0x0B, 0xF0, 0x07, 0xF0, 0x7E, 0x00, 0x3F, 0x07, 0xE0, 0x03,
-    0xF0, 0x7E, 0x00, 0x3F, 0x03, 0xE0, 0x07, 0xF0, 0x3F, 0x41, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0x00, 0x1A, 0x9B, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0xB8, 0x0B, 0x8B, 0xC0, 0xF8, 0xB8, 0x0B, 0x8B, 0x80, 0xB8,
-    0x78, 0x0F, 0x87, 0xC1, 0xF8, 0x3F, 0xFF, 0x80, 0xBE, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00,
-    0x0B, 0x80, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0xBC, 0x3D, 0x00, 0xBC, 0x3D, 0x00, 0xBC, 0x3C, 0x00, 0xBC, 0x3C, 0xA0, 0xFC, 0x7C, 0xF4,
-    0xFC, 0x7C, 0xF5, 0xFC, 0x3F, 0xFB, 0xFC, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xBD, 0x07, 0xFD, 0x7D,
-    0x00, 0xF4, 0x7D, 0x00, 0xF4, 0x7D, 0x00, 0x50, 0x7D, 0x00, 0x00, 0x7D, 0x60, 0x04, 0xB0, 0x2C,
-    0xB0, 0x2C, 0xE6, 0x2D, 0xEB, 0x3D, 0xFF, 0x7D, 0xBF, 0xFD, 0x3F, 0xED, 0x0F, 0x1D, 0x0B, 0x1D,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xBF, 0xC3, 0xFC, 0x02, 0xF4, 0xFE, 0x00, 0x7D, 0x3F, 0x40, 0x1F, 0x8F,
-    0xD0, 0x07, 0xE3, 0xF8, 0x02, 0xF8, 0xFE, 0x00, 0xBF, 0x3F, 0x80, 0x2F, 0xCA, 0xA0, 0x0A, 0xA0,
-    0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF7, 0xFD, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFB, 0xFC, 0x0F, 0xE0, 0x1F,
-    0x47, 0xF0, 0x03, 0xE1, 0xFC, 0x00, 0xF8, 0x7F, 0x00, 0x3F, 0x2F, 0xC0, 0x0F, 0xCB, 0xF0, 0x07,
-    0xF2, 0xFC, 0x02, 0xFC, 0xBF, 0x40, 0xBF, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x16, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFD,
-    0x0B, 0xF0, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xE2, 0xFC, 0x00, 0xFE, 0x15, 0x6F, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x03, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x1C,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0x90, 0x00, 0x00, 0x3F, 0xFE, 0x01, 0x40, 0x3F, 0x07, 0xC2, 0xF0, 0x1F, 0x40, 0xB8, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x54, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0B, 0xF5, 0x07, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x16, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x0B, 0xF0, 0xBF, 0x00, 0x3F, 0xC0, 0x0B, 0xE1, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0x95, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x40, 0x2D, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x05, 0x40, 0x3F, 0x07, 0xC3,
-    0xF0, 0x2F, 0x00, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFA, 0x55,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x07, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x7F, 0x5F, 0xD7, 0xF5, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xD3,
-    0xF4, 0xFD, 0x3F, 0x5F, 0xE7, 0xF9, 0xFE, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xFE, 0x07,
-    0xFC, 0x00, 0x1F, 0xF0, 0xBF, 0xE0, 0xFF, 0x40, 0x00, 0xFF, 0x4B, 0xFD, 0x1F, 0xE0, 0x00, 0x07,
-    0xFC, 0x7F, 0xD3, 0xFC, 0x00, 0x00, 0x2F, 0xD7, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x7F, 0xDF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFB, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFB, 0xFE, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x7F,
-    0xCB, 0xFF, 0x80, 0x0F, 0xFF, 0x87, 0xFD, 0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0xBF, 0xD0, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x05, 0x50, 0x15, 0x40, 0x03, 0xFC, 0x1F, 0xF4,
-    0x7F, 0xC0, 0x01, 0xFF, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0xBF, 0x4F, 0xF2, 0xFD, 0x00, 0x00, 0x3F,
-    0xCF, 0xF3, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xEF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xEF, 0xFB, 0xFF, 0x40, 0x0F, 0xFF, 0x6F, 0xF6, 0xFF, 0xE0, 0x3F, 0xFD, 0x2F, 0xF8, 0xBF, 0xFC,
-    0x1F, 0x81, 0xFE, 0x07, 0xE0, 0xFF, 0x01, 0xF8, 0xBF, 0x40, 0xBE, 0x3F, 0x80, 0x2F, 0xAF, 0xC0,
-    0x0B, 0xEF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xF4, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0xFC,
-    0x03, 0xFA, 0xFF, 0xD1, 0xFD, 0x07, 0xFC, 0x7F, 0x40, 0x7F, 0x5F, 0xD0, 0x0F, 0xEB, 0xF0, 0x03,
-    0xFE, 0xFC, 0x00, 0xFE, 0x15, 0x00, 0x7F, 0x80, 0x02, 0xBF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x3F,
-    0xE0, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF4, 0x1F, 0x3F, 0x01,
-    0xF7, 0xC0, 0x1F, 0xF8, 0x02, 0xFF, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0xE0, 0x3E, 0x2F, 0x83, 0xE0,
-    0x7C, 0x3E, 0x03, 0xD3, 0xE0, 0x3D, 0x00, 0x1F, 0xC0, 0x07, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xD0, 0x01, 0xFD, 0x0F, 0xD0,
-    0x01, 0xFC, 0x0F, 0xD0, 0x01, 0xFC, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xD0,
-    0x02, 0xFC, 0x0F, 0xD0, 0x02, 0xF8, 0x0F, 0xD0, 0x03, 0xF8, 0x0F, 0xD0, 0x03, 0xF8, 0x0F, 0xD0,
-    0x03, 0xF8, 0x1F, 0xD0, 0x03, 0xF4, 0x1F, 0xF8, 0x2F, 0xF4, 0x1F, 0xFC, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x3F, 0x80, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x15, 0x40, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x3D, 0x3E, 0x01, 0xF0, 0xF8, 0x07,
-    0xC3, 0xE0, 0x1F, 0x0F, 0x80, 0x7C, 0x3E, 0x02, 0xF0, 0xF8, 0x0B, 0xC3, 0xE0, 0x2E, 0x0F, 0xE3,
-    0xF8, 0x3F, 0x4F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x03, 0xFC, 0x0F,
-    0xD0, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x03, 0xFC,
-    0x1F, 0xE0, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x03,
-    0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x4B, 0xFE, 0xAA, 0xBF, 0xD2, 0xFF, 0x00, 0x1F, 0xF8, 0xBF,
-    0xC0, 0x07, 0xFF, 0x6F, 0xF0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0xF4, 0x7C, 0x01, 0xF4, 0x7C, 0x01, 0xF4, 0x7C, 0x01, 0xF4, 0x7D, 0x01, 0xF4,
-    0x7D, 0x01, 0xF4, 0xBD, 0x01, 0xF8, 0xBF, 0xFF, 0xF8, 0xBF, 0xFF, 0xF8, 0xBF, 0xFF, 0xF8, 0xBD,
-    0x02, 0xFC, 0xBE, 0x02, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x01,
-    0x40, 0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0xFE, 0x00,
-    0x0F, 0xF0, 0x7F, 0x80, 0x03, 0xFC, 0x1F, 0xE0, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0x3F, 0xC1, 0xFE,
-    0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x4B, 0xFE, 0xAA, 0xBF,
-    0xD2, 0xFF, 0x00, 0x1F, 0xF4, 0xBF, 0xC0, 0x07, 0xFD, 0x2F, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x7C, 0x00, 0xF4, 0x7C,
-    0x00, 0xF4, 0x7C, 0x01, 0xF4, 0x7C, 0x01, 0xF4, 0x7D, 0x01, 0xF4, 0x7D, 0x01, 0xF8, 0xBD, 0x01,
-    0xF8, 0xBF, 0xFF, 0xF8, 0xBF, 0xFF, 0xF8, 0xBF, 0xFF, 0xF8, 0xBE, 0x02, 0xF8, 0xBE, 0x02, 0xFD,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0xBF, 0xFE, 0x00, 0xBF, 0xBE, 0x00, 0xBF, 0xBE, 0x00, 0x7F, 0xBD, 0x00,
-    0x7F, 0x7D, 0x00, 0x7F, 0x7E, 0x00, 0xBF, 0x3F, 0x01, 0xFF, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0x01, 0xA9, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7E, 0x00,
-    0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xF9, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x05,
-    0x0F, 0x03, 0xC3, 0x80, 0xF0, 0xD0, 0x3C, 0x34, 0x0F, 0x0E, 0x0B, 0xC3, 0xFF, 0xF0, 0x3F, 0xAC,
-    0x00, 0x1F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x3F, 0xE0,
-    0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x01,
-    0xFF, 0xD0, 0x3F, 0xFC, 0x03, 0xFF, 0xD0, 0x3F, 0xFE, 0x03, 0xFF, 0xD0, 0x3F, 0xFF, 0x0B, 0xFF,
-    0xD0, 0x7F, 0xFF, 0x4F, 0xFF, 0xD0, 0x7F, 0xBF, 0x9F, 0xEF, 0xD0, 0x7F, 0x7F, 0xFF, 0xDF, 0xE0,
-    0x7F, 0x6F, 0xFF, 0xDF, 0xE0, 0x7F, 0x5F, 0xFF, 0x9F, 0xE0, 0x7F, 0x4F, 0xFF, 0x2F, 0xE0, 0x7F,
-    0x8B, 0xFF, 0x2F, 0xE0, 0xBF, 0x87, 0xFE, 0x3F, 0xE0, 0xBF, 0x83, 0xFD, 0x3F, 0xF0, 0xBF, 0xC2,
-    0xFC, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x7E, 0x07, 0xF4, 0x0B, 0xF0, 0x7F, 0x80, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xE3,
-    0xFF, 0x07, 0xFF, 0x7F, 0xF0, 0xBE, 0xFF, 0xEF, 0x0B, 0xCF, 0xFA, 0xF0, 0xBC, 0xFF, 0x7F, 0x0B,
-    0xC7, 0xF3, 0xF0, 0xBD, 0x3E, 0x3F, 0x0B, 0xD1, 0x43, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xBE, 0x2F, 0x8B, 0xE2,
-    0xFC, 0xBF, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x0F, 0xC3, 0xF0, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00,
-    0x7F, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F,
-    0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x7F, 0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F,
-    0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01,
-    0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x2F, 0x0B,
-    0xC0, 0x00, 0x03, 0xF4, 0xFD, 0x00, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01,
-    0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0,
-    0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8,
-    0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x0A, 0x81, 0xA4, 0x07, 0xF0, 0xBE, 0x02,
-    0xFC, 0x3F, 0xC0, 0xFF, 0x4F, 0xF0, 0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x7D, 0x00, 0xFF, 0xFF, 0x40, 0xFE, 0xBF, 0xE0, 0x3D, 0x02, 0xF8,
-    0x2F, 0x00, 0x7F, 0x0B, 0x80, 0x0F, 0xC3, 0xD0, 0x03, 0xF0, 0xB8, 0x01, 0xFC, 0x2F, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF4, 0x06, 0xFD, 0x7E, 0x00, 0x00, 0x06, 0x8A, 0xAF, 0xFF,
-    0xD0, 0x00, 0x01, 0xFE, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF2, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xC0, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0xFF, 0xD4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFE, 0xAA, 0xA4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xD3, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0xBF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xAF, 0xFF, 0xD1, 0xF8, 0x3D, 0x02, 0xFF, 0x55, 0xBD, 0xBC,
-    0x01, 0xFF, 0xFF, 0xFE, 0xB8, 0x00, 0xFF, 0xFF, 0xFE, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0xB8, 0x01,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFA, 0xAE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x06, 0xFD, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7D, 0x02, 0xFF, 0xFF,
-    0x40, 0x3F, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xA0, 0x7F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xD5, 0x55, 0x0B, 0xFF,
-    0xFF, 0xD2, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0x41, 0xF8, 0x1F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0,
-    0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xE1, 0xF5, 0x5B, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFA,
-    0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x3F, 0x55, 0x5F, 0xF0, 0xBE,
-    0x00, 0xBF, 0x00, 0xFF, 0xAF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x6F, 0xFF, 0x80, 0xBF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF8, 0x90, 0x07,
-    0xFC, 0x00, 0x00, 0xBD, 0x01, 0x55, 0xBD, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x7D, 0x55, 0xFC,
-    0x3F, 0x47, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0xBD, 0x00,
-    0x0F, 0xD3, 0xF4, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
-    0xFF, 0x07, 0xFF, 0xFF, 0xFE, 0x1F, 0x55, 0xBF, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x3F, 0xAF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xF5, 0x55, 0xFF, 0x0B, 0xE0, 0x0B, 0xF0, 0x0F, 0xFA, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x06,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x6F, 0xFF, 0x80, 0xBF, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xF8, 0x90, 0x07, 0xFC, 0x00, 0x00, 0xBD, 0x01, 0x55, 0xBD, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFC, 0x7D, 0x55, 0xFC, 0x3F, 0x47, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x1F, 0x87, 0xE0,
-    0x1F, 0x87, 0xE0, 0x2F, 0xCB, 0xF0, 0x3F, 0xCF, 0xF0, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF3,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xD0, 0xBF, 0x80, 0x03, 0xFE, 0x0F, 0xFD, 0x0F, 0xF0,
-    0x00, 0x0F, 0xF0, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0xBF, 0x8F, 0xFC, 0x7F, 0xC0, 0x00, 0x03, 0xFC,
-    0xBF, 0xCF, 0xF4, 0x00, 0x00, 0x1F, 0xEB, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFF, 0xBF, 0xEF, 0xFD, 0x00, 0x03, 0xFF, 0xCB, 0xFC, 0xFF, 0xF4, 0x01, 0xFF, 0xF4, 0xFF, 0xC3,
-    0xFF, 0xE0, 0x7F, 0xFE, 0x0F, 0xFC, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x1A, 0xA0, 0x2A, 0x80, 0x03,
-    0xFC, 0x1F, 0xF0, 0x7F, 0x80, 0x00, 0xFF, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x7F, 0x8F, 0xF2, 0xFD,
-    0x00, 0x00, 0x3F, 0xCF, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x02, 0xFF, 0xEF, 0xFB, 0xFF, 0x40, 0x0F, 0xFF, 0x6F, 0xF6, 0xFF, 0xE0, 0x3F, 0xFD, 0x2F,
-    0xF8, 0xBF, 0xFC, 0x3F, 0x0F, 0xC0, 0xFC, 0x3F, 0x03, 0xF4, 0xFD, 0x1F, 0xD7, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x03, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xF8, 0x14, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x01, 0xFF, 0xF4, 0x07,
-    0xFF, 0x40, 0x05, 0xBF, 0x80, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x50, 0x03, 0xF9, 0xFE, 0xBF, 0xD7,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xF4, 0x1B, 0xFE, 0x00, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x4F, 0xD7,
-    0xF9, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xEF, 0x80, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x0F,
-    0xF4, 0x00, 0xFF, 0x40, 0x00, 0x7C, 0x01, 0x03, 0xC0, 0x7F, 0xFC, 0x0B, 0xFF, 0x80, 0x6B, 0x90,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x0B, 0xFF, 0xFD, 0x1A, 0xAB, 0xF4, 0x00, 0x2F, 0xC0, 0x02, 0xFC,
-    0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0x80, 0x05, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x0E, 0x0B, 0xF1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFD, 0x07, 0xFF, 0xE0, 0x01, 0xA5, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x0B, 0xFF, 0xFD, 0x1A, 0xAB, 0xF4, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00,
-    0x3F, 0xC0, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0x80, 0x05, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x0E, 0x0B, 0xF1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFD, 0x07, 0xFF, 0xE0, 0x01, 0xA4, 0x00, 0x05, 0x5A,
-    0xA8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x2F, 0xF0, 0x7F, 0x00,
-    0x3F, 0xF0, 0x7F, 0x00, 0xBF, 0xF0, 0x7F, 0x00, 0xFF, 0xF0, 0x7F, 0x02, 0xFF, 0xF4, 0x7F, 0x03,
-    0xFF, 0xF4, 0x3F, 0x4B, 0xFB, 0xF4, 0x3F, 0x4F, 0xEB, 0xF8, 0x3F, 0x5F, 0xCB, 0xF8, 0x3F, 0xBF,
-    0x8B, 0xF8, 0x3F, 0xFF, 0x4F, 0xF8, 0x3F, 0xFF, 0x0F, 0xFC, 0x3F, 0xFD, 0x0F, 0xFC, 0x3F, 0xFC,
-    0x0F, 0xFC, 0x3F, 0xF8, 0x0F, 0xFC, 0x2F, 0xF0, 0x0F, 0xFC, 0x00, 0x55, 0xA0, 0x3F, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFC, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFD, 0xFC, 0x02, 0xFE, 0xFC, 0x07, 0xFE, 0xFC, 0x0F, 0xFE, 0xFC, 0x2F, 0xFE, 0xFC, 0x7F,
-    0x7E, 0xFC, 0xFE, 0x7E, 0xFE, 0xFC, 0x7E, 0xFF, 0xF4, 0x7E, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0, 0xBF,
-    0xFF, 0x40, 0xBF, 0xAA, 0x00, 0x6A, 0x07, 0xD1, 0xF4, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x0F, 0xE3,
-    0xF8, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0xBF, 0x00,
-    0x2F, 0xF0, 0x7F, 0x00, 0x3F, 0xF0, 0x7F, 0x00, 0xBF, 0xF0, 0x7F, 0x00, 0xFF, 0xF0, 0x7F, 0x02,
-    0xFF, 0xF4, 0x7F, 0x03, 0xFF, 0xF4, 0x3F, 0x4B, 0xFB, 0xF4, 0x3F, 0x4F, 0xEB, 0xF8, 0x3F, 0x5F,
-    0xCB, 0xF8, 0x3F, 0xBF, 0x8B, 0xF8, 0x3F, 0xFF, 0x4F, 0xF8, 0x3F, 0xFF, 0x0F, 0xFC, 0x3F, 0xFD,
-    0x0F, 0xFC, 0x3F, 0xFC, 0x0F, 0xFC, 0x3F, 0xF8, 0x0F, 0xFC, 0x2F, 0xF0, 0x0F, 0xFC, 0x0F, 0xC3,
-    0xF0, 0x0F, 0xC3, 0xF0, 0x1F, 0xC7, 0xF0, 0x2F, 0xDB, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0xFD, 0xFC, 0x02, 0xFE, 0xFC, 0x07, 0xFE, 0xFC, 0x0F, 0xFE, 0xFC, 0x2F, 0xFE, 0xFC,
-    0x7F, 0x7E, 0xFC, 0xFE, 0x7E, 0xFE, 0xFC, 0x7E, 0xFF, 0xF4, 0x7E, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0,
-    0xBF, 0xFF, 0x40, 0xBF, 0xAA, 0x00, 0x6A, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x07, 0xF1, 0xFC, 0x00,
-    0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x00,
-    0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF,
-    0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00, 0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0xC7, 0xF0, 0x07, 0xF1,
-    0xFC, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xEB, 0xF8, 0x1F,
-    0xC0, 0x3F, 0x4B, 0xD0, 0x0B, 0xE3, 0xF4, 0x01, 0xF8, 0xBD, 0x00, 0xBE, 0x2F, 0xD0, 0x7F, 0x47,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x6F, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF5, 0x7F, 0xF0, 0x3F, 0xC0, 0x0F,
-    0xF4, 0x7F, 0x80, 0x07, 0xF8, 0xBF, 0x40, 0x07, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xEA, 0x9B, 0xFC, 0xBF, 0x80, 0x0B, 0xFC, 0x7F, 0xF9, 0x6F, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xF4,
-    0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x2F, 0xEB, 0xF8, 0x7F, 0x00, 0xFC, 0xBD, 0x00, 0xBD,
-    0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xBF, 0x41, 0xFE, 0x7F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x01, 0xF8, 0x7E, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x02, 0xFC, 0xBF,
-    0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF5, 0x7F, 0xF0, 0x3F, 0xC0, 0x0F,
-    0xF4, 0x7F, 0x80, 0x07, 0xF8, 0xBF, 0x40, 0x07, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xEA, 0x9B, 0xFC, 0xBF, 0x80, 0x0B, 0xFC, 0x7F, 0xF9, 0x6F, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xF4,
-    0x00, 0x0F, 0xC3, 0xF0, 0x0F, 0xC3, 0xF0, 0x1F, 0xC7, 0xF0, 0x2F, 0xDB, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x2F, 0xEB, 0xF8, 0x7F, 0x00, 0xFC, 0xBD,
-    0x00, 0xBD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xBF, 0x41, 0xFE, 0x7F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01,
-    0xFC, 0x7F, 0x00, 0x01, 0xFD, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFE, 0xFF, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x6A,
-    0x00, 0x02, 0xFC, 0x00, 0x55, 0x56, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0xFF, 0xD0, 0x0B, 0xFC, 0xBF, 0xFF, 0xFF, 0xF8, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC1, 0xFC, 0x7F, 0x07, 0xF1, 0xFC, 0x2F, 0xCB, 0xF0, 0x00, 0x00,
-    0x00, 0x06, 0x50, 0x03, 0xFF, 0xF4, 0x0D, 0x02, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x2A,
-    0xAF, 0x80, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x40, 0x0F, 0xD3, 0xEA, 0xFE, 0x1F, 0xFF, 0xF0, 0x1B,
-    0xF9, 0x00, 0x00, 0x00, 0x05, 0x00, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x40, 0xEA, 0xAA, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xA0, 0x00, 0xA8, 0x3F, 0x80, 0x0F, 0xC1, 0xFC, 0x01, 0xFC, 0x0F, 0xE0, 0x2F, 0x40,
-    0x7F, 0x43, 0xF0, 0x03, 0xFC, 0x7F, 0x00, 0x1F, 0xDB, 0xD0, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x00, 0x1F, 0xE4, 0x00,
-    0x00, 0x00, 0x55, 0xA9, 0x00, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC3, 0xF4, 0x02, 0xF8, 0x2F, 0xC0, 0x3F, 0x40, 0xFD,
-    0x03, 0xF0, 0x0B, 0xF0, 0x7E, 0x00, 0x3F, 0x8F, 0xD0, 0x02, 0xFD, 0xFC, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x1A, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x1F, 0x87, 0xE0, 0x02, 0xFC, 0xBF, 0x00, 0x3F, 0xCF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x0B, 0xD3, 0xF8, 0x00, 0xFC, 0x1F, 0xC0, 0x1F, 0x80, 0xFF, 0x02, 0xF4, 0x07, 0xF4, 0x3F,
-    0x00, 0x3F, 0xC7, 0xF0, 0x01, 0xFE, 0xBD, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00,
-    0x0A, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x03, 0xF0,
-    0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x03, 0xF4, 0xFD, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0xFC, 0x3F, 0x40, 0x2F, 0x82, 0xFC, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x00, 0xBF, 0x07, 0xE0, 0x03,
-    0xF8, 0xFD, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xAF,
-    0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0x00,
-    0x0A, 0x80, 0x1F, 0xC0, 0x03, 0xF4, 0x0B, 0xF0, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x00, 0x06, 0x80, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0xFE,
-    0x02, 0xF4, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x01, 0xFD, 0xBE, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x0A, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x1F, 0xD0,
-    0x0A, 0x90, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F,
-    0xC0, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x7E, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
-    0xAF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x0F, 0xC3, 0xF0, 0x1F, 0xC7, 0xF0, 0x2F, 0xDB, 0xF4, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x7C, 0x3D, 0x00, 0xBC, 0x3D, 0x00, 0xBC, 0x3C, 0x00, 0xBC, 0x3C, 0x00,
-    0xFC, 0x7C, 0x00, 0xFC, 0x7C, 0x01, 0xFC, 0x3F, 0x47, 0xFC, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xBC,
-    0x07, 0xF9, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x3E,
-    0x0F, 0x87, 0xF1, 0xFC, 0xBF, 0x2F, 0xCF, 0xF3, 0xFC, 0x00, 0x00, 0x02, 0xC0, 0xB0, 0x2C, 0x0B,
-    0x03, 0x80, 0xB0, 0x38, 0x0F, 0x43, 0xC1, 0xF4, 0x2F, 0xFF, 0x40, 0xFF, 0xB4, 0x00, 0x07, 0x40,
-    0x00, 0x74, 0x00, 0x0B, 0x40, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xBE, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0xFF,
-    0x8F, 0xFF, 0xE3, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF8, 0x00,
-    0x3E, 0x00, 0x0F, 0xC0, 0x07, 0xF4, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x00, 0x00, 0xBC, 0x2F, 0x00,
-    0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x50, 0x00, 0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00,
-    0x00, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x00,
-    0xFC, 0xFD, 0x54, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x80, 0x00, 0xFD, 0xFF, 0xFF, 0xE0, 0x00, 0xFD,
-    0xFC, 0x0B, 0xF0, 0x00, 0xFD, 0xFC, 0x03, 0xF0, 0x00, 0xFE, 0xFC, 0x03, 0xF4, 0x01, 0xFE, 0xFC,
-    0x07, 0xF0, 0x01, 0xFE, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0x01, 0xF4, 0xBD, 0x00, 0x02, 0xF8, 0xBE, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x03,
-    0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xBC, 0x24, 0x00, 0x00, 0xBC, 0x38,
-    0x00, 0x00, 0x7C, 0x38, 0x00, 0x00, 0x7C, 0x38, 0x00, 0x00, 0x7C, 0x38, 0x00, 0x00, 0x7C, 0x3F,
-    0xF8, 0x00, 0x7C, 0x3F, 0xFF, 0x00, 0x7C, 0x3C, 0x1F, 0x40, 0x7D, 0x3C, 0x0F, 0x40, 0x7D, 0x3C,
-    0x2F, 0x40, 0xBD, 0x3F, 0xFF, 0x00, 0xBE, 0x3F, 0xF8, 0x00, 0xBE, 0x2F, 0xC0, 0x00, 0x7F, 0x00,
-    0x3F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0xFF,
-    0x0F, 0xE0, 0x00, 0x02, 0xFD, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x3F, 0xE1,
-    0xFF, 0x84, 0x03, 0xFF, 0x02, 0xFF, 0xFC, 0x2F, 0xF4, 0x03, 0xFF, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF4, 0x0F,
-    0x40, 0x0B, 0xC3, 0xF0, 0x00, 0x3F, 0xBC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xFD, 0x7F, 0x00, 0x2F, 0xC3, 0xFF,
-    0x47, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x56, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xC0, 0x15, 0x55, 0x56, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x15, 0x55, 0x55,
-    0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E,
-    0x03, 0xE3, 0xD0, 0x3D, 0x3D, 0x03, 0xD3, 0xD0, 0x3D, 0x3D, 0x03, 0xD3, 0xD0, 0x3D, 0x7D, 0x03,
-    0xD7, 0xD0, 0x7D, 0x7D, 0x07, 0xD7, 0xC0, 0x7D, 0x7C, 0x07, 0xC7, 0xC0, 0x7C, 0x7C, 0x07, 0xC7,
-    0xC0, 0x7C, 0x7C, 0x07, 0xC0, 0x55, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x55, 0x54, 0x00, 0x02, 0xFF, 0x47, 0xFD, 0x0F, 0xF0,
-    0x2F, 0xD0, 0x7F, 0xC0, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0x47, 0xFC, 0x1F, 0xE0,
-    0xFF, 0x43, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0x07, 0xFC, 0x2F, 0xD0, 0xFF, 0x07,
-    0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x47, 0xFD, 0x0F, 0xF0, 0x2F, 0xD0, 0x7F, 0xC0, 0xFF, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x7F, 0xD1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x2F,
-    0xD0, 0xFF, 0x41, 0xFF, 0x0B, 0xF8, 0x0F, 0xF0, 0x7F, 0xC0, 0xFF, 0x83, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x8B, 0xFD, 0x1F, 0xF4, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xE0, 0xBF, 0x83, 0xFD,
-    0x0F, 0xF0, 0x3F, 0xC1, 0xFF, 0x0B, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0x07, 0xFC,
-    0x2F, 0xD0, 0xFF, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x2F, 0xF0, 0x7F, 0xD1,
-    0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x2F, 0xD0, 0xFF, 0x41, 0xFF, 0x0B, 0xF8, 0x0F, 0xF0, 0x7F, 0xC0,
-    0xFF, 0x83, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xFD,
-    0x07, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x0B,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0A, 0xBF, 0xBD, 0x07, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xA0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x42, 0xFF,
-    0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xE0, 0x0B, 0xF4, 0x2F, 0xFC, 0xBF,
-    0xF2, 0xFE, 0x07, 0x80, 0x00, 0x00, 0x0A, 0x81, 0xFC, 0x2F, 0xC3, 0xFD, 0x3F, 0xD0, 0x0A, 0x81,
-    0xFC, 0x2F, 0xC3, 0xFD, 0x3F, 0xD0, 0x1A, 0x00, 0x29, 0x01, 0xA4, 0x3F, 0x80, 0xBF, 0x02, 0xF8,
-    0x3F, 0x80, 0xFF, 0x03, 0xFC, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x7F, 0xC0, 0xFF, 0x47, 0xFC, 0x16,
-    0xFB, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0x80, 0x0B, 0xC0, 0x0D, 0x90,
-    0x0F, 0x40, 0x1B, 0xA0, 0x3F, 0x00, 0x1D, 0xA0, 0x7D, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x0B, 0x82,
-    0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xFC, 0x68, 0x68, 0x03, 0xF4, 0xDC, 0xD8, 0x07, 0xF0,
-    0xEC, 0xE8, 0x0F, 0xC0, 0xEC, 0xEC, 0x2F, 0x80, 0x78, 0x78, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x0F, 0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0xFF, 0x83, 0xFE, 0x03, 0xFD, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x7F, 0xC2, 0xFE, 0x02, 0xFE, 0x0F, 0xF4, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x2D, 0x07, 0x40, 0xBE, 0x0F, 0xC3, 0xF0, 0x3F, 0x0B, 0xD1, 0xF8, 0x2F, 0x43, 0xE0,
-    0xFC, 0x0F, 0x42, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x3F, 0x01, 0xF8,
-    0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC2, 0xD0, 0xBE, 0x3F, 0x03, 0xF2, 0xF4, 0x0F,
-    0x8F, 0xC0, 0x7C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0xD0, 0x28, 0x07,
-    0xF0, 0xFC, 0x2F, 0x40, 0xFD, 0x2F, 0x87, 0xF0, 0x0F, 0xC3, 0xF0, 0x7E, 0x01, 0xF4, 0x3D, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xEF,
-    0xE0, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x0B, 0x40, 0xFD, 0x0F, 0xD0, 0xFC, 0x0B, 0xE0,
-    0x1F, 0xE0, 0x0F, 0xF0, 0x0F, 0xC0, 0x0F, 0x00, 0x04, 0x00, 0x02, 0x00, 0x0B, 0x40, 0x2F, 0x80,
-    0x2F, 0x80, 0x1F, 0xC0, 0x3F, 0x43, 0xFC, 0x3F, 0xC1, 0xF8, 0x03, 0x80, 0x08, 0x00, 0x00, 0x00,
-    0x0A, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xD0, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x3F, 0xD0, 0x03,
-    0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0xBF, 0xC0, 0x00,
-    0x02, 0xFF, 0xAF, 0xF4, 0x00, 0x3F, 0x0F, 0xFF, 0xFE, 0x0F, 0xD7, 0xF4, 0x3F, 0xFF, 0xC0, 0xFE,
-    0x7F, 0x41, 0xFF, 0xF0, 0x1F, 0xEB, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0x6A, 0x43, 0xFF, 0xFC, 0x1A,
-    0x90, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x6F, 0xFE,
-    0x00, 0x02, 0xFF, 0xE0, 0xFF, 0xF4, 0x00, 0x7F, 0xFC, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x00, 0x1F,
-    0xFF, 0x07, 0xFF, 0xD0, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0x00, 0xBC, 0x0F, 0xC0,
-    0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x2F, 0xC2, 0xF8, 0x1F, 0x80, 0x38,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x3F, 0xC7, 0xFD, 0x7F, 0xDB, 0xFE, 0xFF,
-    0xE0, 0x00, 0x10, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xF0, 0x3D, 0x3F, 0xBE, 0x04, 0x0F,
-    0xCF, 0xC0, 0x07, 0xF3, 0xF0, 0x01, 0xFC, 0xFD, 0x00, 0x7E, 0x3F, 0x00, 0x2F, 0x9F, 0xC0, 0x0B,
-    0xFF, 0xE0, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x15, 0x55, 0x56,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x2E, 0x01, 0xF4, 0xFF, 0xFF, 0xC1, 0xFF, 0xFD, 0x01, 0xBF,
-    0x90, 0x00, 0x05, 0x00, 0x00, 0x01, 0x38, 0x80, 0x00, 0x2E, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0C, 0xF2, 0x10, 0x00, 0xB3, 0x83, 0x88, 0x22,
-    0xCB, 0xDF, 0xB5, 0xFF, 0xFB, 0xFF, 0x40, 0xFF, 0x47, 0xFE, 0x4B, 0xFF, 0xFF, 0xED, 0x3E, 0xDD,
-    0x8F, 0x00, 0x0B, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x01, 0xA4, 0x00, 0x0B, 0xFF, 0xE0, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0xE0, 0xBF, 0x41, 0xFD, 0x2F, 0xD0, 0x7F, 0x42, 0x80, 0x07, 0xF0, 0xE0, 0x01, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xFE,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xF8, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x40, 0x0B, 0xFF, 0xE0, 0x00, 0x0D, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xF4, 0xBF,
-    0x41, 0xFD, 0x00, 0x1F, 0x42, 0x80, 0x07, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x40,
-    0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xD0, 0x03, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0x00, 0x0B, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0xF0, 0x00, 0xFF, 0x40, 0x00, 0x02, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0xFE, 0x00,
-    0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xFC, 0x01, 0xAA, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0A, 0x90, 0x00, 0x38, 0x7F, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x90, 0xBF, 0x01, 0xFB, 0x40, 0x0F, 0xD0, 0x7D, 0x00, 0x01,
-    0xF8, 0x1F, 0x40, 0x00, 0x7F, 0x0B, 0xD0, 0x00, 0x1F, 0xC2, 0xF4, 0x00, 0x0B, 0xE0, 0xBD, 0x00,
-    0x03, 0xF4, 0x3F, 0x40, 0x07, 0xFC, 0x0F, 0xD0, 0x2F, 0xFC, 0x03, 0xF4, 0x0F, 0xFC, 0x00, 0xFD,
-    0x03, 0xFC, 0x00, 0x0B, 0x40, 0xFF, 0x00, 0x00, 0x90, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00,
-    0x01, 0xFE, 0x07, 0xF0, 0x00, 0xBF, 0xC1, 0xFC, 0x00, 0x3F, 0xF0, 0xBF, 0x40, 0x0F, 0xFC, 0x3F,
-    0xD0, 0x03, 0xFF, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x1A, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x3F, 0x81,
-    0xF8, 0x00, 0x7F, 0x82, 0xF4, 0x00, 0xBF, 0xC3, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0xFD,
-    0x03, 0xF8, 0x00, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x07, 0xFC, 0x03, 0xF8, 0x06, 0xA8, 0x03, 0xF4,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xB2, 0x83, 0x57, 0x0E, 0xDC, 0x3B, 0x70, 0xE2,
-    0xC3, 0xFF, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x07, 0x40, 0x3D, 0x03, 0x74, 0x2C, 0xE0, 0xFF,
-    0xD0, 0x1E, 0x00, 0x38, 0x01, 0x40, 0xFF, 0xC3, 0x80, 0x0E, 0x40, 0x3F, 0xE0, 0x02, 0xC2, 0x4F,
-    0x0F, 0xFC, 0x2F, 0x80, 0x01, 0x50, 0x3F, 0xC2, 0xC0, 0x0D, 0x40, 0x3F, 0xE0, 0xF1, 0xD3, 0xC7,
-    0x4B, 0xFC, 0x06, 0x40, 0x15, 0x50, 0xFF, 0xD0, 0x07, 0x40, 0x2C, 0x00, 0xF0, 0x03, 0xC0, 0x2E,
-    0x00, 0xF8, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x42, 0xC7, 0x0B, 0x1C, 0x0F, 0xE0, 0xB6, 0xC3, 0x83,
-    0x8F, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x43, 0x87, 0x0C, 0x0D, 0x34, 0x78, 0xBF, 0xE0, 0x67,
-    0x8A, 0xBC, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x3F,
-    0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F, 0x00, 0x7D, 0x7E, 0x00, 0x7D, 0x7F, 0x00, 0xBE, 0x7F, 0x00,
-    0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFF, 0xBF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x0B, 0x80, 0xB2,
-    0xC3, 0x93, 0x4E, 0xDD, 0x3B, 0x74, 0xF2, 0xD3, 0xFF, 0x03, 0xF8, 0x01, 0x00, 0x01, 0x00, 0x7D,
-    0x02, 0xB4, 0x01, 0xD0, 0x07, 0x40, 0x2D, 0x00, 0xB4, 0x0F, 0xFC, 0x3F, 0xF0, 0x1F, 0xD0, 0xEB,
-    0xC0, 0x07, 0x40, 0x1D, 0x00, 0xF0, 0x0F, 0x81, 0xFC, 0x0F, 0xFE, 0x3F, 0xF4, 0x1F, 0xD0, 0x96,
-    0xC0, 0x03, 0x40, 0x6C, 0x0F, 0xE0, 0x02, 0xD2, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x90, 0x07,
-    0x80, 0x3E, 0x03, 0x7C, 0x2C, 0xF0, 0xFF, 0xF0, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0x83, 0x40,
-    0x0F, 0xF0, 0x15, 0xF0, 0x43, 0xC3, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x79, 0x43, 0x80,
-    0x0F, 0xF4, 0x3E, 0xB4, 0xF0, 0xE3, 0xC7, 0x8B, 0xFC, 0x06, 0x80, 0x00, 0x00, 0xFF, 0xE1, 0x5B,
-    0x40, 0x2C, 0x00, 0xF0, 0x03, 0xC0, 0x1F, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0xB1,
-    0xD2, 0xC3, 0x47, 0xAC, 0x0F, 0xF0, 0xF1, 0xE3, 0xC3, 0xCF, 0xFE, 0x0A, 0x90, 0x0B, 0xD0, 0xE6,
-    0xC3, 0x03, 0x4C, 0x0E, 0x3E, 0xF8, 0x2F, 0xE0, 0x03, 0x4F, 0xFC, 0x1A, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x2F,
-    0x80, 0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x02, 0xF8,
-    0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x01, 0xFD,
-    0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x03,
-    0xF4, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x02,
-    0xF8, 0x00, 0xBE, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x3F,
-    0xC0, 0x0F, 0xD0, 0x0B, 0xF0, 0x03, 0xFC, 0x02, 0xFD, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x2D, 0x3C, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x7C,
-    0xB8, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xE3, 0xE0, 0x0B, 0xFF, 0xE3, 0xD0, 0x0F, 0xF7, 0xD3,
-    0xC0, 0x0F, 0xF3, 0xC7, 0xC0, 0x1F, 0xF7, 0xCB, 0x80, 0x2F, 0xF7, 0xCB, 0x80, 0x2F, 0xFB, 0x8F,
-    0x40, 0x2F, 0xFF, 0x4F, 0x00, 0x1F, 0xFF, 0x5F, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7C, 0xB8,
-    0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x00, 0xB4, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x3E, 0xB8, 0x2F, 0xF0, 0x3F, 0xF8, 0x2F, 0xF0, 0x3F, 0x44, 0x2F, 0xF4, 0x3E,
-    0x00, 0x1F, 0xFE, 0x7E, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xE0, 0x7F, 0x40, 0xBC, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xC0, 0x17, 0xF5, 0x54, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFA, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFE,
-    0x00, 0x7F, 0x00, 0x00, 0x2F, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xF8, 0x07, 0xF0, 0x00, 0x02,
-    0xFF, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0xBF, 0x00, 0x00, 0x3F, 0xEF, 0xC2, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xF4, 0xFD, 0xFE,
-    0x00, 0x00, 0x3F, 0xD3, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x0F,
-    0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x00, 0x02, 0xFF,
-    0x80, 0xBF, 0xD0, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xAB, 0xFE, 0xAB, 0xFE,
-    0x80, 0x0F, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xE5, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00,
-    0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00,
-    0x0B, 0xF8, 0x0F, 0xD6, 0xF8, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x03, 0x80, 0x40, 0xFF, 0xFE,
-    0x00, 0x0E, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0x90, 0x0F, 0xE1, 0xF8, 0x00, 0x3F, 0xE0, 0x3F,
-    0x43, 0xF0, 0x00, 0x1B, 0xE0, 0xFD, 0x0F, 0xC0, 0x00, 0x0B, 0xC3, 0xF4, 0x3F, 0x80, 0x3D, 0x7F,
-    0x0F, 0xD0, 0xFF, 0x03, 0xFF, 0xFC, 0x7F, 0x43, 0xFC, 0x0F, 0xFF, 0xD0, 0x55, 0x05, 0x50, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x2E, 0x00, 0xFC, 0x00, 0x03,
-    0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x7D,
-    0x0F, 0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0x17, 0xF7, 0xFD, 0xFD,
-    0x40, 0x3F, 0x3F, 0xCF, 0x80, 0x02, 0xFB, 0xFD, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xEF, 0xF0, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x0F, 0xF0, 0xFE, 0x00,
-    0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0xBD, 0x00, 0xA5, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x05, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0x97, 0xF4, 0x2F, 0xFC, 0x00, 0xFC, 0x2F, 0xF8, 0x00, 0x7C,
-    0x2F, 0xF8, 0xA4, 0x7C, 0x2F, 0xF8, 0xFC, 0x7C, 0x2F, 0xF8, 0xFC, 0x7C, 0x2F, 0xF8, 0xFC, 0x3C,
-    0x3F, 0xF8, 0xBC, 0x00, 0x3F, 0xF8, 0xBE, 0x00, 0x3F, 0xF8, 0x7F, 0x90, 0xBF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0x64, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x16, 0xBF, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xEB,
-    0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFD, 0xBF, 0x80, 0x00, 0xF0, 0x2F, 0x80, 0x01, 0xE0, 0x1F,
-    0x80, 0x01, 0xE0, 0x1F, 0x80, 0x01, 0xF4, 0x3F, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x1B, 0xEB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD,
-    0x00, 0x3F, 0xE5, 0x60, 0x01, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x40, 0x2A,
-    0xFF, 0xE9, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xFA, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0xAA, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9,
-    0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xE0, 0x40,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x02, 0x8F, 0xFB, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80,
-    0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x02, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x40, 0x2F, 0x40, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xF4, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0x94, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x80, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFA, 0xAC, 0x03, 0xFF, 0x0F, 0x40, 0x00,
-    0x3F, 0xD0, 0xF4, 0x00, 0x07, 0xFC, 0x0F, 0x40, 0x00, 0x7F, 0x80, 0xF4, 0x00, 0x0B, 0xF8, 0x0F,
-    0x94, 0x00, 0xBF, 0x81, 0xFF, 0xFF, 0xCB, 0xF8, 0x1F, 0xFF, 0xFD, 0x7F, 0xC1, 0xFA, 0xBF, 0xE3,
-    0xFE, 0x1F, 0x43, 0xF4, 0x3F, 0xFE, 0xF5, 0xBF, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x20, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xF0, 0x00, 0x60,
-    0x00, 0x02, 0xFE, 0x46, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0xC0, 0xFF, 0xFB, 0x07, 0xFB, 0xC0, 0x2F,
-    0x9F, 0x00, 0xBD, 0x7C, 0x03, 0xF5, 0xF0, 0x0B, 0xE7, 0xC0, 0x2F, 0xEF, 0x40, 0x3F, 0xFF, 0x80,
-    0x7F, 0xFF, 0x80, 0x2F, 0xF9, 0x00, 0x0F, 0x40, 0x00, 0x28, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC1,
-    0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x15, 0xBF, 0x54, 0x00, 0x2F, 0x00, 0x3F, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFD, 0x16, 0xFF, 0x94, 0x3F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x29,
-    0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x3F,
-    0xE0, 0x00, 0x2A, 0xA0, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBE, 0x7D, 0x00, 0x2F, 0xFF,
-    0x40, 0x1F, 0xFF, 0xD0, 0x3F, 0xFE, 0x50, 0x0F, 0xFE, 0xBD, 0x03, 0xAF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xD5, 0x3F, 0xFE, 0x0B, 0xCF, 0xFE, 0x07, 0xF3, 0x8F, 0x8B, 0xF4, 0x03, 0xFF, 0xF4, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xF4, 0x03, 0xFB, 0xEB, 0xE0, 0x0F, 0xCF, 0x8F, 0xC0, 0x3F, 0x3E, 0x3F, 0x00, 0xFC, 0xF8,
-    0xFC, 0x03, 0xF3, 0xE3, 0xF0, 0x0F, 0xCF, 0x8F, 0xC0, 0x3F, 0x3E, 0x3F, 0x00, 0xFC, 0xFC, 0xF8,
-    0x03, 0xF3, 0xF3, 0xE0, 0x0F, 0xDB, 0xDF, 0x80, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00,
-    0xFD, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x1F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x94, 0x00, 0x15, 0x6F,
-    0xF5, 0x50, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0x87,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x1F, 0xE7, 0xD7, 0xF8, 0x2F, 0x47, 0xD1, 0xF4, 0x09, 0x07,
-    0xD0, 0x10, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x0A, 0xAA, 0xAB, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x0E, 0x07, 0xD0, 0xA0, 0x3F, 0xC7, 0xD2, 0xF8, 0x0F, 0xFB, 0xEF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x3E, 0x00,
-    0x0F, 0x80, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x7D, 0x0F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x7E, 0x00, 0x01, 0xF8, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x7C, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00,
-    0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x0F, 0xCB, 0x9F, 0xC2, 0xC2, 0xE0, 0xD0, 0x00, 0xB8, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x42, 0xE0, 0x40, 0xF4, 0xB8, 0xB8, 0x2F, 0xAE, 0xBE,
-    0x02, 0xFF, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2B, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x3F, 0xFA, 0x90, 0x3F, 0xF4, 0x00, 0x3F, 0xFD, 0x00,
-    0x3D, 0xBF, 0x40, 0x7D, 0x2F, 0xD0, 0x7D, 0x0B, 0xF4, 0x7C, 0x02, 0xFD, 0x68, 0x00, 0xBD, 0x00,
-    0x00, 0x24, 0x04, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0xFF, 0xFF, 0xE0, 0x16, 0xAF, 0xF8, 0x00,
-    0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xF6, 0xF0, 0x0B, 0xF4, 0xBC, 0x0B, 0xF4, 0x2F, 0x0B,
-    0xF4, 0x0B, 0xC2, 0xF4, 0x01, 0xA0, 0x24, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xFC, 0x02, 0xF0, 0x3F, 0xC0, 0xBC, 0x03, 0xF8, 0x3F, 0x00, 0x3F, 0x8F, 0x80, 0x07, 0xF7, 0xE0,
-    0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x2A, 0xAA, 0xA0,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0xFC, 0xFC, 0x0B, 0xF0, 0xBC, 0x1F, 0xC0, 0x7C,
-    0x7F, 0x40, 0x7E, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xF8, 0x1A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x7F, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x75, 0xD0, 0x00, 0x00, 0x1F, 0x5F, 0x40, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x01, 0xFF,
-    0x5F, 0xF4, 0x00, 0x7F, 0xF5, 0xFF, 0xD0, 0x1F, 0xEF, 0x5F, 0x7F, 0x83, 0xF8, 0xF5, 0xF1, 0xFD,
-    0x3E, 0x0F, 0x5F, 0x07, 0xC0, 0x80, 0xF5, 0xF0, 0x10, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xF5,
-    0xF0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00,
-    0x00, 0xF5, 0xF0, 0x00, 0x00, 0x06, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0xFF, 0xFF,
-    0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00,
-    0xF5, 0xF0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0x5F, 0x00,
-    0x01, 0xC0, 0xF5, 0xF0, 0x24, 0x7F, 0x0F, 0x5F, 0x0B, 0xC3, 0xFC, 0xF5, 0xF2, 0xFC, 0x0F, 0xFF,
-    0x5F, 0xBF, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x03, 0xF5, 0xFC, 0x00,
-    0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0x35, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x80, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x7F, 0x00, 0x7F,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
-    0xE0, 0x00, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xC0,
-    0x1F, 0xE0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0x50, 0x01, 0x40,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xBF, 0xD0, 0x2F,
-    0xF3, 0xFF, 0xD7, 0xFF, 0x3E, 0xFF, 0x2E, 0xF3, 0xC3, 0xC0, 0x0F, 0x3C, 0x00, 0x00, 0xF3, 0xC0,
-    0x00, 0x0F, 0x3C, 0x00, 0x00, 0xF3, 0xC0, 0x02, 0xFF, 0x3C, 0x7D, 0x7F, 0xF3, 0xEF, 0xF2, 0xFF,
-    0x3F, 0xF8, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x06, 0xA4, 0xBC, 0x0F, 0xFF, 0xAF, 0x0F, 0xFF, 0xFF,
-    0xC7, 0xF4, 0x3F, 0xE2, 0xF8, 0x07, 0xF8, 0xFD, 0x00, 0xFD, 0x3F, 0x40, 0x3F, 0x0B, 0xF4, 0x2F,
-    0xC1, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x6F, 0xE8, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xE7, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0xBF, 0x40, 0x0B, 0xFC, 0x00, 0x3F, 0xC0,
-    0x0B, 0xFF, 0x80, 0x1F, 0xD0, 0x0B, 0xFF, 0xF0, 0x0B, 0xF0, 0x0B, 0xF2, 0xFC, 0x02, 0xFC, 0x0F,
-    0xF0, 0x7F, 0x00, 0xBF, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0xDF, 0xE0, 0x0B, 0xF0, 0x07, 0xFF, 0xE0,
-    0x03, 0xFC, 0x01, 0xFF, 0xF4, 0x1B, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xEF, 0xFF, 0xFF, 0xF0, 0x07, 0xD0, 0x6F, 0xFF,
-    0x90, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x01,
-    0xFD, 0x7F, 0x40, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F,
-    0xE0, 0x0F, 0xF0, 0x3F, 0xD0, 0x07, 0xF8, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0x80, 0x02, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xFD, 0xAF, 0xEA, 0xFF, 0x80, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0,
-    0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0,
-    0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00,
-    0xA8, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B,
-    0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F,
-    0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD,
-    0x00, 0xFC, 0x0B, 0xD0, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0x80, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFA, 0xAA, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0x00, 0x1F, 0xF0, 0x00,
-    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x0A, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFD, 0x3F, 0xFF, 0xA9, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x10, 0x2F, 0xC0,
-    0x00, 0x07, 0x83, 0xFC, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x41, 0xFD, 0x02, 0xFF, 0xFA, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFC, 0xBE, 0x02,
-    0xFD, 0x0F, 0xBF, 0x00, 0x3C, 0x02, 0xFF, 0xC0, 0x0B, 0x00, 0x7F, 0xF0, 0x03, 0xF5, 0x7F, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFA, 0xFF, 0xE0, 0x1B, 0xE4, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F,
-    0x46, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x64, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD1, 0xFD, 0x2F, 0xE3, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x1F, 0xD2, 0xFE, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x39, 0x7F, 0xFC, 0x3E,
-    0xBD, 0x7E, 0x7E, 0xFD, 0x2F, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x39, 0x7F,
-    0xFC, 0x3E, 0xFD, 0x7F, 0xFD, 0xBD, 0x1F, 0xFC, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x3F, 0x00, 0x0A, 0xAB, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xE8, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x6A,
-    0xFF, 0xFE, 0xA8, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0xF0, 0x00, 0x00, 0x06,
-    0xFF, 0x00, 0x65, 0x00, 0x00, 0xB0, 0x0B, 0xFF, 0xFA, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x56, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x1B, 0xFF,
-    0x80, 0x01, 0xBF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0xA4, 0x00, 0x01, 0x50, 0x00, 0x5A, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x2F, 0xFF, 0xEA, 0x50, 0x02, 0x50, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_10_boldBitmaps[23321] = {
+    0x65, 0x55, 0x31, 0x8C, 0xDD, 0x44, 0x10, 0x7D, 0xFE, 0x26, 0x67, 0x09, 0x4B, 0x6C, 0x8A, 0x84,
+    0x22, 0x11, 0xB8, 0xA1, 0x42, 0x0A, 0xDB, 0x50, 0x50, 0x5C, 0xFE, 0x1A, 0x09, 0x94, 0x22, 0xC5,
+    0x1D, 0x12, 0x01, 0x51, 0xD1, 0x50, 0xA0, 0x6B, 0x68, 0x28, 0xA8, 0xCE, 0x86, 0x43, 0xA2, 0x4C,
+    0x90, 0xE8, 0x69, 0x82, 0x44, 0x2E, 0x48, 0x50, 0x50, 0x26, 0xE7, 0x0D, 0x27, 0x91, 0xE2, 0x8A,
+    0xF8, 0xA0, 0xA0, 0xA0, 0xC0, 0x28, 0xD7, 0x00, 0x05, 0x4B, 0xB0, 0x84, 0x13, 0xD6, 0x1E, 0xDE,
+    0x38, 0x3F, 0x22, 0x51, 0x2C, 0x7B, 0x6D, 0x8F, 0xD7, 0x33, 0x6F, 0xDF, 0xBC, 0x99, 0x05, 0x4E,
+    0xE0, 0xFD, 0x24, 0xE4, 0xDE, 0xE2, 0x5A, 0x1A, 0x8C, 0x77, 0x88, 0x69, 0x28, 0x7C, 0x85, 0x88,
+    0x6F, 0x50, 0xE2, 0xFE, 0xB1, 0x95, 0x8E, 0x66, 0x70, 0xBF, 0xCA, 0x81, 0xE8, 0x9B, 0x89, 0xD5,
+    0xED, 0xB1, 0xE8, 0x25, 0x8B, 0xEE, 0x86, 0x98, 0x50, 0xED, 0xC7, 0x22, 0xF0, 0x05, 0x49, 0x6F,
+    0x6A, 0x20, 0x6F, 0xB7, 0x39, 0xC7, 0xBE, 0x3C, 0x70, 0x1C, 0xF3, 0x0E, 0x48, 0x83, 0x2D, 0xE1,
+    0x84, 0x47, 0xA7, 0x83, 0x9C, 0xD3, 0x21, 0x22, 0x0F, 0x4E, 0xE7, 0xDD, 0x88, 0x1C, 0xA7, 0x2C,
+    0x70, 0xDE, 0x60, 0x3D, 0x8C, 0x7E, 0x0C, 0x8D, 0x8E, 0x3B, 0x3A, 0x8C, 0x3A, 0x8F, 0x30, 0xAC,
+    0x1F, 0x39, 0x4F, 0xB2, 0x9E, 0xF3, 0x22, 0xE7, 0x3D, 0x7C, 0x68, 0x54, 0x0C, 0xAB, 0x87, 0xD3,
+    0x72, 0xA4, 0x4E, 0x90, 0x32, 0x1C, 0xAA, 0x5F, 0x3E, 0xE6, 0xFF, 0xFC, 0xD4, 0x6C, 0x94, 0xC8,
+    0x26, 0xFE, 0xEC, 0xF8, 0x19, 0x22, 0x3D, 0x92, 0x46, 0x02, 0x12, 0x91, 0x1A, 0xC5, 0x46, 0x5C,
+    0x7C, 0xDA, 0xBB, 0xB6, 0x91, 0xB7, 0x63, 0xB1, 0x8A, 0xDB, 0xAE, 0x35, 0x72, 0x09, 0x28, 0xE8,
+    0x34, 0x21, 0xB4, 0xF9, 0x01, 0x9B, 0x73, 0xB4, 0x63, 0xB3, 0x2D, 0xD9, 0xC4, 0x12, 0x52, 0xE7,
+    0xFE, 0xCC, 0x99, 0x64, 0x48, 0x7D, 0xE7, 0xB0, 0x6E, 0xF2, 0x36, 0x3D, 0xEC, 0x22, 0xEC, 0x68,
+    0x19, 0xE2, 0x93, 0x0E, 0xC9, 0x66, 0xAC, 0x4A, 0xD8, 0xCF, 0xAF, 0x23, 0xBD, 0xE3, 0x03, 0xC6,
+    0x75, 0x83, 0x62, 0xFF, 0x30, 0xA4, 0xBD, 0x9D, 0xB0, 0x07, 0xF1, 0x85, 0xA7, 0x17, 0x75, 0xBA,
+    0x98, 0x18, 0xE1, 0xCF, 0x16, 0x67, 0x19, 0x6B, 0x1D, 0x3D, 0xCE, 0xF2, 0x72, 0x8B, 0x40, 0x5B,
+    0x87, 0x4C, 0x4A, 0xE4, 0x5C, 0xBB, 0x95, 0x72, 0x70, 0xE7, 0xBB, 0x58, 0x25, 0xD3, 0x50, 0xD5,
+    0x55, 0xA8, 0xEE, 0x49, 0x47, 0x52, 0x07, 0x23, 0x63, 0x58, 0x28, 0x56, 0x13, 0xE5, 0x56, 0x2F,
+    0x1B, 0x7A, 0x2A, 0x15, 0x3E, 0x6F, 0x33, 0x86, 0x4A, 0x22, 0x46, 0x38, 0xD8, 0xDA, 0xB4, 0x69,
+    0xE0, 0x4B, 0xC5, 0xC7, 0xBC, 0x5B, 0x0C, 0x68, 0x50, 0x78, 0xB2, 0xCE, 0x8F, 0x75, 0x1E, 0x12,
+    0xDE, 0x3C, 0x6F, 0x02, 0xD7, 0x32, 0x91, 0x4D, 0xAD, 0x0E, 0x92, 0x01, 0xAE, 0x9C, 0xA7, 0x14,
+    0x3E, 0xED, 0x89, 0x98, 0x37, 0x7D, 0xB3, 0xE5, 0xEC, 0x60, 0x4F, 0x9D, 0x76, 0xFC, 0xA0, 0x4E,
+    0x9D, 0x37, 0x6D, 0x1E, 0xD2, 0xB8, 0x18, 0xE9, 0x43, 0xCA, 0xAA, 0x9E, 0xA9, 0xCA, 0x6B, 0xA4,
+    0xDD, 0xE6, 0xFA, 0x30, 0x38, 0x99, 0xD6, 0x98, 0xCA, 0x62, 0xE2, 0x32, 0x06, 0x2B, 0x4D, 0x7A,
+    0x70, 0x13, 0x5C, 0x1F, 0xDE, 0xD1, 0x59, 0x7C, 0xC8, 0x3D, 0xC8, 0xD9, 0xB5, 0x74, 0xD6, 0xC7,
+    0xEF, 0xCD, 0x2E, 0xAE, 0xAD, 0xAC, 0xA7, 0xF8, 0xBD, 0xF9, 0x81, 0xE2, 0xB2, 0xAD, 0xCA, 0xAD,
+    0x3B, 0x79, 0xE1, 0x0D, 0x91, 0x7F, 0x45, 0xFC, 0x29, 0x73, 0xFB, 0xAE, 0x54, 0x2B, 0x1D, 0x3C,
+    0x03, 0x9D, 0x4B, 0x20, 0xAA, 0x80, 0x44, 0xB3, 0xAC, 0xAA, 0x03, 0xB6, 0x55, 0x8D, 0xB3, 0xBD,
+    0xA8, 0xB1, 0x78, 0xC4, 0x6E, 0x56, 0x76, 0x0F, 0x2E, 0x85, 0xEB, 0x84, 0x2A, 0x70, 0xEF, 0x61,
+    0x7B, 0xFA, 0xBF, 0xBD, 0xA1, 0x9D, 0xE9, 0x8C, 0x2A, 0x43, 0xAE, 0x08, 0x78, 0x11, 0x78, 0x42,
+    0x03, 0x93, 0x28, 0x2E, 0x6B, 0x34, 0x7E, 0x3B, 0x19, 0xEC, 0x2B, 0xCE, 0x1C, 0xDC, 0xDA, 0xFF,
+    0xFB, 0x4E, 0x88, 0x71, 0x74, 0xCE, 0x6D, 0xFC, 0x74, 0xF1, 0xC7, 0x21, 0x0B, 0x72, 0x2E, 0x5A,
+    0x11, 0xAE, 0xAC, 0x26, 0x6A, 0x23, 0x2D, 0x94, 0x9B, 0xAF, 0x60, 0x49, 0xB6, 0xCF, 0x04, 0x27,
+    0xA2, 0x22, 0x32, 0x5E, 0xA1, 0xCD, 0x8F, 0x8C, 0x5C, 0xE1, 0xE9, 0xE9, 0x75, 0x91, 0xDB, 0x22,
+    0x17, 0x95, 0xB7, 0x32, 0x97, 0xC8, 0xFF, 0x7D, 0x9F, 0xF5, 0xC7, 0x15, 0xA2, 0xAD, 0x15, 0x65,
+    0x4E, 0x7E, 0x06, 0x26, 0x1D, 0x05, 0x33, 0x32, 0xA1, 0x90, 0x2B, 0xB9, 0xC8, 0x3E, 0x6B, 0x47,
+    0x6B, 0xEB, 0x02, 0xE5, 0x3F, 0xA8, 0xB8, 0x2F, 0xEB, 0xAA, 0x97, 0x33, 0x2F, 0xD4, 0x83, 0x74,
+    0x0B, 0x2A, 0xFF, 0x6B, 0x2A, 0xCA, 0x50, 0xFB, 0xF1, 0xA9, 0x57, 0x25, 0x13, 0xF9, 0x6E, 0xAE,
+    0xCB, 0x70, 0x5A, 0x35, 0xA4, 0xDC, 0x51, 0x6B, 0x4D, 0x89, 0xAA, 0xC5, 0xB2, 0xC7, 0x72, 0x1B,
+    0xB6, 0xA8, 0x8B, 0x73, 0x9D, 0xF9, 0x88, 0x42, 0x53, 0x44, 0x83, 0xC8, 0x84, 0x94, 0x73, 0xD8,
+    0x09, 0x9C, 0x57, 0x3F, 0x3C, 0x4E, 0xED, 0x5E, 0xB6, 0x12, 0xF5, 0x04, 0xEE, 0x9F, 0xEE, 0xB7,
+    0xD2, 0xA9, 0x3E, 0xE3, 0x71, 0x4A, 0x0B, 0x94, 0xB7, 0x3C, 0xFB, 0xE6, 0x64, 0x65, 0xA4, 0xC5,
+    0x49, 0xC8, 0x27, 0x96, 0xC5, 0x88, 0x46, 0xCA, 0x46, 0x5A, 0x2E, 0x9C, 0xFD, 0xC1, 0x7C, 0x7F,
+    0x89, 0x6B, 0x2C, 0x59, 0x99, 0xAE, 0x15, 0xD3, 0x99, 0xFD, 0x3E, 0xED, 0x27, 0x8C, 0xEE, 0x50,
+    0x21, 0xD6, 0x8D, 0x78, 0xF2, 0xF0, 0xFC, 0xEE, 0x17, 0x14, 0x92, 0x23, 0xE3, 0x0A, 0x32, 0x6A,
+    0x42, 0xD2, 0xA8, 0x79, 0xCA, 0x06, 0xE4, 0xBD, 0x62, 0xE1, 0x69, 0x03, 0x5C, 0xA7, 0x27, 0x57,
+    0xD0, 0xB4, 0x2C, 0x75, 0x8C, 0x45, 0xB7, 0x8D, 0x58, 0xD4, 0x2E, 0x0B, 0xD6, 0xB3, 0xB4, 0x33,
+    0x3D, 0xC7, 0xBC, 0xB7, 0x8C, 0x31, 0x44, 0xEC, 0xB1, 0xF2, 0x2F, 0x8A, 0x1C, 0x92, 0x83, 0x82,
+    0x2D, 0xE3, 0xAD, 0x72, 0x2E, 0xF1, 0x66, 0xE0, 0xAF, 0xF5, 0xF5, 0xAC, 0x5F, 0x62, 0x69, 0x60,
+    0xF6, 0xFD, 0x22, 0xF4, 0x84, 0x53, 0x36, 0xEC, 0x5E, 0xEC, 0x14, 0xFD, 0x1A, 0x59, 0x86, 0x5B,
+    0xDB, 0xB4, 0xA4, 0xAF, 0x25, 0x83, 0x96, 0x99, 0xE5, 0xE1, 0x76, 0xA2, 0xBB, 0x19, 0x9B, 0xF9,
+    0x99, 0xC8, 0xDC, 0x7E, 0xAC, 0x0E, 0x46, 0xD3, 0xB9, 0x0F, 0x25, 0x8F, 0x36, 0xAC, 0xFA, 0xD5,
+    0xC9, 0xD7, 0x64, 0x27, 0x9A, 0xD0, 0xEC, 0x8C, 0x26, 0x6C, 0xD5, 0x2B, 0x63, 0xC6, 0x07, 0x4B,
+    0x91, 0x31, 0x30, 0xF3, 0xC4, 0x3A, 0xA9, 0xD1, 0x90, 0x37, 0x47, 0x15, 0x1A, 0xF6, 0x2C, 0xB2,
+    0x70, 0x84, 0x35, 0x62, 0x84, 0x16, 0x12, 0x16, 0xCC, 0x21, 0x92, 0x4B, 0xC7, 0xB6, 0xBE, 0x2C,
+    0x94, 0xD1, 0xE9, 0xC4, 0xEC, 0xE3, 0x49, 0x4D, 0x02, 0x39, 0xBE, 0xA2, 0x2F, 0x2F, 0x29, 0x1C,
+    0x02, 0x71, 0x9C, 0xAE, 0x1E, 0x51, 0x91, 0xF5, 0x8C, 0xF9, 0x47, 0x35, 0xD0, 0xC9, 0x40, 0x67,
+    0xB1, 0x91, 0x89, 0x94, 0x97, 0xD0, 0xDC, 0x1F, 0xAD, 0x80, 0x24, 0x97, 0x29, 0x9E, 0x9E, 0xE2,
+    0x69, 0x49, 0x0C, 0x5A, 0x2D, 0x8F, 0x62, 0x55, 0x5C, 0x1E, 0xC9, 0xFD, 0xA2, 0x28, 0x82, 0xCA,
+    0x2E, 0xE5, 0x9F, 0xD4, 0x40, 0x1A, 0x67, 0x29, 0x68, 0xBD, 0x3C, 0xF7, 0x48, 0x5F, 0x66, 0x66,
+    0xB5, 0x5F, 0xB3, 0x07, 0x52, 0xA9, 0xD8, 0x7A, 0xB0, 0x99, 0xC0, 0x1E, 0xE9, 0x02, 0x44, 0x8B,
+    0x8A, 0x9E, 0x97, 0x58, 0x74, 0xEA, 0x3D, 0x24, 0x61, 0xD9, 0x7E, 0x90, 0x76, 0xFF, 0x74, 0xEB,
+    0x69, 0xEB, 0xBB, 0xF5, 0xEC, 0x70, 0x1E, 0x6E, 0x84, 0x6F, 0x59, 0x44, 0x7F, 0xB1, 0x95, 0x55,
+    0xD2, 0x32, 0xD4, 0x0B, 0x6C, 0xDA, 0xF5, 0x1A, 0x13, 0xA4, 0x0E, 0x0A, 0x05, 0xBF, 0xD0, 0x26,
+    0x8E, 0xB5, 0xCF, 0xE8, 0x54, 0xF7, 0x12, 0x42, 0x61, 0xAB, 0xD7, 0xE2, 0x0C, 0x4A, 0x5D, 0x89,
+    0xE4, 0xAE, 0x82, 0xDE, 0xF0, 0x2C, 0x65, 0x9A, 0x1B, 0x16, 0xB4, 0x69, 0x5D, 0x99, 0x44, 0x02,
+    0x66, 0x03, 0xF5, 0xA9, 0x6E, 0x32, 0xF4, 0x16, 0x74, 0xEB, 0x49, 0x26, 0x8A, 0x89, 0xAC, 0x71,
+    0x4F, 0xA3, 0xCA, 0xB9, 0x07, 0xE4, 0xAA, 0xBE, 0xAB, 0x63, 0x1E, 0xB2, 0xD0, 0xC0, 0xB1, 0xC5,
+    0xF1, 0xD6, 0xD0, 0xE8, 0x1B, 0x4A, 0x88, 0x6A, 0x6D, 0x50, 0x1D, 0xB0, 0x7D, 0xB2, 0x9B, 0xFE,
+    0x71, 0xEF, 0x2A, 0x7F, 0x90, 0x9F, 0x67, 0x5A, 0xE5, 0xFC, 0x0C, 0x4A, 0xE9, 0x64, 0x42, 0x99,
+    0x23, 0x46, 0x88, 0x04, 0x3A, 0x28, 0x67, 0xB9, 0x72, 0x49, 0x62, 0xC8, 0xE2, 0x7C, 0xD9, 0x07,
+    0x97, 0xDA, 0xA6, 0xF2, 0x5D, 0x02, 0x19, 0xE8, 0x5B, 0x8B, 0x3E, 0x26, 0x5A, 0xCE, 0x56, 0x5D,
+    0x1E, 0x29, 0x48, 0x16, 0x0C, 0xE5, 0xB7, 0xCB, 0x1D, 0x12, 0x66, 0x68, 0x48, 0x3D, 0x5B, 0xD3,
+    0xF8, 0xF8, 0xB5, 0xE0, 0xF5, 0x9E, 0xC2, 0xD0, 0x6B, 0x68, 0xEE, 0xEF, 0xA8, 0x84, 0x7C, 0x17,
+    0x8F, 0x1D, 0xFF, 0x01, 0x9D, 0x55, 0xBF, 0x97, 0xD0, 0x44, 0x10, 0x9E, 0x64, 0xE5, 0xF2, 0x34,
+    0x45, 0x5A, 0x1F, 0x14, 0xB1, 0xC6, 0x62, 0x5B, 0x0B, 0x71, 0x83, 0x94, 0x16, 0xD8, 0x50, 0xD3,
+    0xD3, 0xF0, 0x17, 0xC8, 0xE6, 0x69, 0x71, 0x85, 0x0D, 0x85, 0x9D, 0x05, 0x94, 0xDC, 0x59, 0x60,
+    0x49, 0x01, 0x6C, 0x1E, 0x57, 0x5E, 0x41, 0xF0, 0x8A, 0x2B, 0x2C, 0x08, 0x5E, 0x71, 0x4F, 0x2C,
+    0x6E, 0x1F, 0xEE, 0xC9, 0x9E, 0xEE, 0x66, 0xFC, 0x26, 0xB9, 0xE3, 0xF1, 0x90, 0xCA, 0x4C, 0x26,
+    0xC9, 0x66, 0x7F, 0xCD, 0x7C, 0xF3, 0xCD, 0xEC, 0x45, 0xC7, 0x57, 0x99, 0x77, 0x98, 0xA7, 0x4C,
+    0x64, 0x3A, 0x6A, 0x46, 0x52, 0x81, 0x0A, 0xE6, 0xC1, 0xB2, 0x6F, 0x39, 0x55, 0x27, 0x54, 0xA0,
+    0xC7, 0x76, 0xD4, 0xBE, 0xDC, 0xFE, 0x8A, 0xF9, 0x15, 0x73, 0x72, 0xCC, 0x37, 0x31, 0xE1, 0x3C,
+    0x67, 0xCD, 0xD9, 0x70, 0x32, 0xBD, 0xCC, 0x94, 0x9B, 0xFD, 0xE9, 0xBD, 0x7D, 0x17, 0x4D, 0xFB,
+    0xD6, 0xED, 0xFA, 0xD3, 0x9B, 0x8A, 0x6B, 0x44, 0x15, 0xD6, 0x57, 0x58, 0x89, 0x18, 0x1F, 0x3A,
+    0xD3, 0xC7, 0x6A, 0x26, 0x6C, 0x32, 0xA0, 0x27, 0xCA, 0x07, 0x86, 0xD5, 0xB1, 0xF8, 0xBD, 0x73,
+    0x7D, 0xCB, 0xBB, 0x91, 0x38, 0xDB, 0xE1, 0x9C, 0x3B, 0x98, 0x61, 0x9A, 0x99, 0xAF, 0x31, 0xAC,
+    0x63, 0x5F, 0xE3, 0xD1, 0x69, 0x98, 0x41, 0x17, 0xF8, 0x36, 0x36, 0x57, 0xE9, 0x8D, 0xF6, 0x2A,
+    0xD9, 0xF7, 0xE9, 0x00, 0xC5, 0xA6, 0xA7, 0x9A, 0x9D, 0xE8, 0xCB, 0x9F, 0xB2, 0x1B, 0xAA, 0x37,
+    0x6A, 0xAF, 0xEF, 0x1F, 0x27, 0xD3, 0xEC, 0x78, 0x3C, 0xF6, 0x42, 0x36, 0xD7, 0x0F, 0x4F, 0x66,
+    0x77, 0xE4, 0x57, 0x00, 0x46, 0xAA, 0x03, 0x95, 0x89, 0x88, 0x01, 0xD5, 0x40, 0x8D, 0x27, 0x05,
+    0x6B, 0x61, 0x39, 0x00, 0x40, 0x67, 0xB5, 0x76, 0x3A, 0x22, 0xBD, 0x76, 0xA6, 0x0F, 0xCB, 0x19,
+    0x5E, 0x76, 0x0B, 0x98, 0x63, 0xCB, 0x23, 0x5C, 0xA3, 0x66, 0xB2, 0x43, 0x33, 0x71, 0xD7, 0x3C,
+    0x63, 0x6A, 0xF6, 0x12, 0x35, 0xF0, 0xAF, 0x7D, 0xEE, 0xA9, 0x3D, 0x1A, 0x49, 0xF3, 0x00, 0xC5,
+    0x7C, 0x59, 0x53, 0xE2, 0xC1, 0x82, 0xE9, 0x08, 0x8D, 0x64, 0xEF, 0xCC, 0x64, 0xBF, 0xE7, 0xDE,
+    0x7E, 0xC7, 0xDE, 0xF5, 0x9C, 0x74, 0x4F, 0xF5, 0xF4, 0x96, 0x01, 0xCD, 0xBB, 0x8D, 0xF0, 0x26,
+    0x70, 0xA3, 0xE0, 0xFD, 0xD7, 0xEA, 0x31, 0x02, 0x37, 0x9A, 0x89, 0xCC, 0x0E, 0x53, 0x9D, 0x4C,
+    0x20, 0x84, 0xBE, 0x6F, 0xB3, 0x49, 0x8A, 0xF7, 0x78, 0x32, 0x88, 0x66, 0xCD, 0xFB, 0x1C, 0x00,
+    0xB8, 0xBB, 0x73, 0xB4, 0xFF, 0x9A, 0xF3, 0x6C, 0x6F, 0xF2, 0xF3, 0xC3, 0x63, 0x3E, 0x99, 0xED,
+    0x55, 0xD6, 0x87, 0xD1, 0xBD, 0x9A, 0xDD, 0xE6, 0x6C, 0xFE, 0x88, 0x66, 0x8F, 0xDD, 0x93, 0x64,
+    0xFE, 0x49, 0xA4, 0x60, 0x31, 0xA5, 0xD6, 0x43, 0x43, 0x91, 0xDA, 0x58, 0x24, 0x9D, 0xA0, 0x73,
+    0x99, 0x34, 0x97, 0xC9, 0xF0, 0xB7, 0xC9, 0x1C, 0x61, 0xE4, 0xD3, 0x83, 0x68, 0x76, 0xFF, 0xC4,
+    0xBC, 0xD7, 0xD1, 0xFC, 0xC2, 0xD1, 0x3E, 0xE3, 0x60, 0x47, 0x51, 0x1B, 0xDC, 0x68, 0x82, 0x9B,
+    0x74, 0xA0, 0x0B, 0x30, 0xBF, 0xE1, 0x59, 0xEC, 0x05, 0x37, 0x7A, 0x3B, 0xE9, 0x91, 0xF8, 0x4A,
+    0x02, 0x2B, 0xE0, 0x87, 0xD9, 0xF5, 0x00, 0x18, 0xF0, 0xB6, 0xF8, 0x28, 0xE4, 0x43, 0x03, 0x3B,
+    0xC4, 0xF4, 0x78, 0x43, 0x08, 0xCC, 0x51, 0xF3, 0x02, 0x36, 0xFB, 0x85, 0x5A, 0x1B, 0x7C, 0x42,
+    0xCB, 0x75, 0x7E, 0xAB, 0xAB, 0x39, 0x97, 0x70, 0x3C, 0x17, 0x20, 0x88, 0xBE, 0x3A, 0xD6, 0x07,
+    0xA1, 0x8A, 0x2C, 0xDC, 0xE5, 0x86, 0xF9, 0x0A, 0x83, 0x51, 0x3F, 0x08, 0xE9, 0xDA, 0x89, 0xAA,
+    0x04, 0xF2, 0x23, 0x88, 0x08, 0x84, 0xA7, 0xD3, 0xCB, 0x06, 0xEC, 0xC9, 0x59, 0xB2, 0x22, 0x53,
+    0x1B, 0x6A, 0x98, 0xD6, 0x55, 0x11, 0x4C, 0x6D, 0x3C, 0x22, 0xDD, 0x8E, 0x42, 0x07, 0x18, 0x49,
+    0xF3, 0xC2, 0x08, 0x61, 0xC6, 0xE8, 0xE8, 0xAE, 0xBD, 0xCC, 0x8A, 0x81, 0x2B, 0x28, 0x2A, 0x5C,
+    0x85, 0x5F, 0x88, 0x22, 0x1E, 0x23, 0x2C, 0x13, 0x2A, 0xD4, 0xEB, 0x03, 0x9C, 0xFF, 0x68, 0xBB,
+    0xD7, 0xDC, 0xC3, 0xC0, 0x5E, 0x5F, 0x4B, 0xA5, 0x57, 0x93, 0x21, 0xA3, 0xBC, 0xF2, 0xF2, 0x3A,
+    0xBE, 0x3E, 0x99, 0x65, 0x95, 0x4E, 0x5E, 0xB9, 0x05, 0x7B, 0x5C, 0x95, 0xEA, 0x80, 0xD7, 0x66,
+    0xAA, 0x93, 0x1B, 0xDC, 0x7E, 0xAA, 0x67, 0xFA, 0x74, 0xEE, 0x8B, 0x35, 0xA7, 0xBA, 0x3A, 0x6E,
+    0x48, 0xFC, 0x57, 0x0D, 0xB2, 0xC5, 0x6D, 0x92, 0xFF, 0xC8, 0x35, 0x8F, 0x06, 0xEC, 0x6C, 0x81,
+    0x72, 0x39, 0x57, 0xB7, 0x4B, 0x6E, 0xE6, 0x1F, 0x67, 0xB3, 0xA6, 0x83, 0xDF, 0xE0, 0xBF, 0x17,
+    0x6F, 0x6F, 0x6C, 0x6F, 0x6F, 0x81, 0x28, 0xF3, 0x99, 0x0A, 0x95, 0xFF, 0x8F, 0x22, 0x9D, 0xD2,
+    0xDB, 0x6A, 0xFB, 0x77, 0x75, 0x49, 0xCB, 0xB8, 0x6A, 0x05, 0xDC, 0xEA, 0x08, 0x5B, 0x82, 0x28,
+    0x22, 0xE9, 0x05, 0xAA, 0x52, 0xEC, 0x96, 0x08, 0x20, 0xD6, 0x3B, 0x71, 0x05, 0xD7, 0x7E, 0x99,
+    0xB1, 0x7C, 0x3B, 0x21, 0x4C, 0x4C, 0x7A, 0xAC, 0xA3, 0x4A, 0xA8, 0x1C, 0x6E, 0x50, 0x19, 0xDE,
+    0xEA, 0x17, 0x8C, 0x30, 0x19, 0xBF, 0xB0, 0x08, 0x1E, 0x0F, 0xA0, 0x52, 0x92, 0x44, 0xEA, 0x81,
+    0x01, 0xEC, 0x92, 0xEC, 0x22, 0xD4, 0x8C, 0x1B, 0x58, 0xB6, 0xBC, 0x27, 0x05, 0x07, 0xF5, 0x42,
+    0xCA, 0x4E, 0x32, 0x12, 0x8D, 0x68, 0x16, 0xD0, 0xB4, 0xAF, 0x47, 0x6C, 0xE1, 0x17, 0x0D, 0x3A,
+    0xE8, 0xA9, 0x09, 0x06, 0x23, 0xEA, 0xE8, 0xB2, 0x81, 0x2B, 0xCC, 0x76, 0x00, 0x45, 0xD9, 0xF5,
+    0x4A, 0x30, 0xEA, 0x10, 0x67, 0xC3, 0x54, 0x2E, 0xCF, 0x82, 0x83, 0xE0, 0x0B, 0xFB, 0xB3, 0xEC,
+    0xD4, 0x24, 0xA9, 0x06, 0x16, 0xA9, 0x69, 0x3A, 0xDB, 0x99, 0x01, 0x4B, 0x8E, 0x05, 0x23, 0x36,
+    0x1A, 0x39, 0xAF, 0x18, 0xF1, 0x71, 0xB0, 0x4F, 0xC6, 0x96, 0x30, 0xAD, 0x10, 0x1B, 0xCF, 0x2C,
+    0xB7, 0xCF, 0x13, 0x99, 0x17, 0xDC, 0x1B, 0x6F, 0x60, 0x83, 0xE2, 0x36, 0x91, 0x9B, 0x90, 0x07,
+    0x0C, 0x70, 0xED, 0xE5, 0x8C, 0x12, 0x64, 0x06, 0xF8, 0x1F, 0xD0, 0x64, 0x14, 0x26, 0x8D, 0x62,
+    0xA2, 0x66, 0xCC, 0x75, 0x2C, 0x74, 0x15, 0x87, 0xE1, 0x98, 0x3D, 0x65, 0x81, 0xCA, 0xE2, 0x38,
+    0xBC, 0x16, 0x3F, 0x5B, 0xFC, 0xA8, 0xB2, 0x8C, 0x62, 0x16, 0x82, 0x0E, 0x76, 0xC5, 0x1B, 0x96,
+    0xA0, 0x18, 0x2F, 0xE5, 0x47, 0xB4, 0xE5, 0x33, 0xED, 0x96, 0x05, 0x57, 0x05, 0xBD, 0xF9, 0xE5,
+    0x96, 0x50, 0xFA, 0x89, 0xE4, 0x9A, 0x54, 0x51, 0x49, 0xBC, 0xE1, 0xFC, 0x96, 0x9E, 0x21, 0x9D,
+    0xEE, 0x4C, 0x07, 0xE6, 0xBE, 0x23, 0x16, 0x72, 0x6B, 0x91, 0xC7, 0x8B, 0x3C, 0x5A, 0x84, 0xEF,
+    0x71, 0x12, 0x91, 0x18, 0x7F, 0x4D, 0x3F, 0x43, 0x22, 0x25, 0xFA, 0x86, 0xBE, 0xC0, 0x0C, 0xDD,
+    0xB5, 0x43, 0x33, 0xD4, 0x53, 0xE5, 0x55, 0x28, 0x51, 0x54, 0x28, 0xA3, 0xB8, 0x3D, 0xA2, 0xCF,
+    0xE9, 0x33, 0xFA, 0x84, 0x68, 0xFB, 0x2E, 0xAA, 0x54, 0x28, 0xA5, 0xE7, 0x4C, 0x50, 0x74, 0xE8,
+    0xBF, 0x92, 0x21, 0xEB, 0x66, 0x8F, 0x2F, 0xCE, 0x66, 0x91, 0x35, 0xAB, 0x2F, 0x49, 0xA9, 0x2E,
+    0x79, 0x68, 0x0E, 0x91, 0x68, 0x0F, 0xE5, 0x8F, 0x64, 0xC2, 0x99, 0x2E, 0xED, 0x4E, 0xC2, 0xD6,
+    0x17, 0xF7, 0xF0, 0x5D, 0x9E, 0x84, 0x06, 0xDC, 0xBC, 0x1F, 0x2F, 0x95, 0xF1, 0x61, 0x91, 0x1E,
+    0x50, 0x0A, 0x94, 0x1E, 0xA0, 0x0A, 0xC9, 0x70, 0x39, 0x07, 0x37, 0xF2, 0xAD, 0x2D, 0xC0, 0xD6,
+    0x51, 0x3D, 0x52, 0x09, 0x7C, 0x1F, 0x01, 0xB7, 0x8E, 0xAA, 0x5F, 0xE3, 0x7A, 0x96, 0xC6, 0x26,
+    0xB4, 0x2A, 0x2A, 0x9C, 0xB2, 0x0F, 0x51, 0x82, 0x9A, 0xA9, 0xDD, 0xE1, 0xFB, 0xC0, 0x2E, 0xE0,
+    0x88, 0x2D, 0xC1, 0x82, 0x73, 0x0B, 0xCD, 0x37, 0x66, 0x62, 0x64, 0xB3, 0xB7, 0x54, 0x46, 0x59,
+    0x07, 0x67, 0xE8, 0x63, 0x54, 0xF1, 0x0F, 0x14, 0xC7, 0x8A, 0x63, 0x29, 0xA7, 0xA7, 0x41, 0x38,
+    0x07, 0x52, 0xA0, 0x49, 0x3A, 0x6D, 0xB4, 0x07, 0x5E, 0xE3, 0x38, 0x40, 0x29, 0x1B, 0x78, 0x73,
+    0x68, 0x7F, 0xF3, 0x2A, 0x26, 0x42, 0x1C, 0xDC, 0x26, 0x2A, 0x0F, 0x6A, 0x8E, 0x64, 0x82, 0xBB,
+    0x33, 0xD0, 0xFB, 0xAF, 0x7F, 0x01, 0xA5, 0x55, 0xCF, 0x8F, 0x14, 0x45, 0x14, 0x7E, 0xDD, 0xCD,
+    0xD2, 0xBA, 0x2D, 0x29, 0x0E, 0x90, 0x18, 0x08, 0x69, 0x0E, 0x9E, 0x8C, 0x58, 0x1C, 0x3C, 0x70,
+    0xD8, 0xA5, 0x1A, 0x38, 0x78, 0x30, 0x46, 0xA2, 0x70, 0x24, 0x78, 0xF0, 0x22, 0x89, 0x57, 0x8D,
+    0x09, 0xB3, 0xDD, 0xB8, 0x89, 0x1E, 0x4C, 0x94, 0x0B, 0x5E, 0x4C, 0x04, 0x13, 0x4C, 0xC4, 0x04,
+    0xC7, 0x03, 0x41, 0x62, 0x66, 0xA7, 0x7B, 0xDD, 0x03, 0x07, 0x0F, 0xDB, 0xC1, 0xC3, 0x1E, 0x48,
+    0xA4, 0x65, 0x09, 0x26, 0xAE, 0x09, 0xC5, 0x6E, 0x23, 0xB5, 0x4B, 0x75, 0x3D, 0xBF, 0xEA, 0x5D,
+    0xF8, 0x07, 0xAC, 0x7E, 0x53, 0x33, 0x5D, 0x3F, 0x5E, 0xBD, 0xFA, 0xBE, 0xEF, 0xBD, 0x09, 0xC6,
+    0x59, 0xC2, 0x8D, 0x3C, 0x67, 0xD4, 0xC9, 0x51, 0xCE, 0x5D, 0xC9, 0x5D, 0x47, 0x34, 0x26, 0xCA,
+    0xFF, 0xBE, 0xAA, 0xB8, 0x13, 0xDC, 0x05, 0x65, 0x13, 0x70, 0xC0, 0x15, 0x5F, 0x52, 0x24, 0x0A,
+    0xC5, 0x8B, 0xBC, 0xC6, 0x56, 0x54, 0x91, 0x26, 0x4B, 0x39, 0xA5, 0x55, 0xDC, 0x06, 0x1D, 0xE5,
+    0x59, 0x5A, 0x53, 0xD8, 0xCD, 0x08, 0x76, 0x6A, 0xE8, 0x06, 0x91, 0xBB, 0x11, 0xBA, 0x1B, 0x41,
+    0x87, 0x29, 0xF4, 0x73, 0x71, 0x07, 0xCF, 0xBD, 0x37, 0x1B, 0x3A, 0x4B, 0x64, 0x5F, 0x8C, 0x8D,
+    0x62, 0xAD, 0xB8, 0xCE, 0xB9, 0xA0, 0x13, 0x24, 0x33, 0x4A, 0xB0, 0xBD, 0x25, 0xC2, 0xD9, 0x8A,
+    0x48, 0x54, 0x14, 0x3D, 0xEE, 0x88, 0xB9, 0x51, 0x4F, 0xAC, 0x68, 0xD2, 0xD7, 0x75, 0xF4, 0xA7,
+    0x25, 0x93, 0x93, 0x92, 0x95, 0xF8, 0x4D, 0xC7, 0xAB, 0x36, 0xB4, 0x65, 0x56, 0xAA, 0x5A, 0x55,
+    0x72, 0xD6, 0xA8, 0x05, 0xFB, 0x72, 0x41, 0x14, 0x5C, 0x4A, 0x8F, 0xB4, 0xDE, 0x8E, 0xB6, 0x12,
+    0x86, 0xF1, 0x0A, 0xAE, 0x0D, 0xD9, 0x00, 0x27, 0xF6, 0xCD, 0xBF, 0xE1, 0x09, 0x4C, 0xD0, 0x6E,
+    0x3D, 0x3A, 0xC4, 0x13, 0xE9, 0x58, 0xE7, 0x3A, 0x6F, 0xCA, 0x8A, 0xB6, 0x22, 0xC1, 0xDD, 0x70,
+    0xB9, 0xA7, 0x91, 0xF8, 0x97, 0x31, 0x1D, 0x2E, 0x29, 0x65, 0x8A, 0x39, 0x0B, 0x10, 0x72, 0xDE,
+    0x92, 0xE4, 0x22, 0x61, 0x13, 0xAE, 0x73, 0x51, 0x4A, 0xAB, 0x16, 0xB8, 0x52, 0x64, 0x23, 0x2D,
+    0x8A, 0x99, 0xC0, 0xC4, 0x4D, 0x9A, 0xCD, 0x85, 0x6D, 0x52, 0x4B, 0xFF, 0x25, 0x6A, 0x65, 0x00,
+    0x59, 0xD5, 0x87, 0x90, 0x0E, 0xEB, 0x3C, 0x93, 0xBC, 0x0E, 0xC4, 0x37, 0x78, 0xA5, 0x55, 0x55,
+    0x5E, 0x58, 0x55, 0xA8, 0xCC, 0xAA, 0x0C, 0xFB, 0x55, 0x96, 0x93, 0xCD, 0xB3, 0x12, 0x1D, 0xB9,
+    0xC0, 0x96, 0xE8, 0xBA, 0x92, 0xBA, 0xA0, 0xE3, 0xA0, 0x0B, 0x01, 0x0D, 0x1D, 0xCE, 0x41, 0x40,
+    0x0B, 0x50, 0x54, 0x36, 0xCA, 0x69, 0x30, 0x43, 0x83, 0x9C, 0xC6, 0x30, 0xAC, 0x2C, 0x89, 0x61,
+    0x4C, 0x1C, 0x8C, 0x33, 0x01, 0x6C, 0x57, 0x00, 0x57, 0x37, 0x47, 0xE3, 0x8E, 0x66, 0xD0, 0x97,
+    0x47, 0x40, 0x81, 0x95, 0x6C, 0x30, 0x85, 0x05, 0x14, 0x64, 0xC1, 0x06, 0x17, 0xA9, 0x5F, 0x3F,
+    0xDF, 0x0A, 0x1D, 0x57, 0x4C, 0x53, 0x42, 0x47, 0xF8, 0x9A, 0xEE, 0xDF, 0xEE, 0x5B, 0xCC, 0x9D,
+    0x63, 0xD6, 0x92, 0x6D, 0x64, 0xDE, 0x27, 0x55, 0x50, 0x04, 0x7A, 0x72, 0xA2, 0x44, 0xF7, 0xF2,
+    0xE8, 0x5B, 0xD2, 0x1A, 0x4F, 0x52, 0xB2, 0xC2, 0xC5, 0xD9, 0xA8, 0x0B, 0x75, 0xDC, 0x26, 0x45,
+    0x5A, 0x1F, 0x06, 0x70, 0x37, 0x02, 0x1B, 0x7A, 0xBF, 0xCC, 0x95, 0xC0, 0x21, 0x20, 0x9E, 0x92,
+    0x27, 0x0F, 0x2B, 0xFC, 0x00, 0xAC, 0x80, 0x96, 0x1B, 0x8A, 0xEE, 0x11, 0x6D, 0x03, 0xE2, 0xC3,
+    0x37, 0x78, 0x99, 0x0D, 0x67, 0xAA, 0x10, 0x35, 0xCE, 0xE8, 0x48, 0x65, 0x69, 0x93, 0xD8, 0x90,
+    0xFD, 0x09, 0x21, 0x37, 0x88, 0x58, 0x64, 0xC7, 0x05, 0x88, 0x59, 0xC7, 0xAB, 0xA6, 0xBD, 0xD8,
+    0xEE, 0xC4, 0x05, 0xA7, 0xBC, 0x58, 0xCD, 0x24, 0xD8, 0xE8, 0x5B, 0xD0, 0x78, 0xF2, 0xE6, 0xBC,
+    0x8A, 0x98, 0x3F, 0x63, 0xDE, 0xE3, 0xBE, 0x87, 0x37, 0xF0, 0xA7, 0x3C, 0x97, 0x20, 0x51, 0xD4,
+    0xA4, 0x1C, 0x41, 0x81, 0xF0, 0xE1, 0x87, 0xEC, 0x88, 0xBA, 0x67, 0x36, 0xE8, 0x2D, 0x0F, 0x3A,
+    0xF5, 0x17, 0x1C, 0xBB, 0x94, 0x5D, 0xEC, 0xDC, 0x18, 0xDB, 0x2C, 0xC9, 0x4F, 0x8C, 0x67, 0x36,
+    0x69, 0x44, 0x83, 0xC8, 0x6E, 0x59, 0x52, 0x8B, 0x35, 0xE5, 0x88, 0x8E, 0x0D, 0xE2, 0xA9, 0x20,
+    0x09, 0xC8, 0xC4, 0x7A, 0x4C, 0xD2, 0x3B, 0xB8, 0xE0, 0xB2, 0x9E, 0x88, 0xDA, 0x4E, 0xCC, 0x5B,
+    0xF9, 0xB9, 0x19, 0xC7, 0x6B, 0xAC, 0x32, 0x06, 0x08, 0x0A, 0x50, 0x26, 0xCC, 0x26, 0xE0, 0x07,
+    0xB8, 0xE0, 0x1A, 0x10, 0x69, 0xF3, 0x2A, 0xB8, 0xBC, 0xFD, 0x3C, 0xC2, 0x12, 0x55, 0x5A, 0x77,
+    0x24, 0x17, 0x1B, 0x52, 0x70, 0x05, 0x69, 0x51, 0x09, 0xB4, 0x3D, 0x50, 0x4C, 0x91, 0x73, 0x24,
+    0x97, 0xBB, 0x90, 0x23, 0x9B, 0xEA, 0x04, 0x8A, 0x10, 0x0B, 0x6D, 0x68, 0x64, 0xA5, 0xB2, 0x0E,
+    0x21, 0xE9, 0x19, 0x52, 0x5F, 0xD6, 0x61, 0x67, 0x81, 0x6B, 0x41, 0x65, 0xBB, 0xB9, 0x4B, 0x13,
+    0x12, 0x12, 0x89, 0x49, 0x91, 0xA5, 0x3D, 0x5C, 0xF8, 0xFB, 0xCA, 0x8E, 0x42, 0x87, 0x30, 0x99,
+    0x23, 0x04, 0x73, 0xA6, 0x6C, 0x28, 0x85, 0x69, 0x6F, 0xF2, 0xA9, 0x81, 0x70, 0x44, 0x78, 0x8B,
+    0x41, 0x55, 0x6A, 0x42, 0xAE, 0xC5, 0x06, 0x98, 0x40, 0xEE, 0xC4, 0xDA, 0xFB, 0x2A, 0x49, 0x81,
+    0xEB, 0x0A, 0x07, 0x4C, 0x38, 0x8A, 0x0C, 0x89, 0xC6, 0x6B, 0xC2, 0xF9, 0x33, 0x12, 0xCE, 0x52,
+    0x87, 0x3D, 0x5E, 0x9F, 0xBE, 0x4D, 0xFB, 0x36, 0x18, 0x0C, 0xCE, 0xF6, 0x4D, 0x35, 0x54, 0xEA,
+    0x60, 0x08, 0x76, 0xBC, 0x93, 0x67, 0xFE, 0xE0, 0x4D, 0xA1, 0xAE, 0x14, 0xA2, 0xC5, 0x29, 0x20,
+    0xDD, 0x73, 0x05, 0x97, 0x99, 0x42, 0xDA, 0xEB, 0xA8, 0xE7, 0xFE, 0xD5, 0x7D, 0xF9, 0x37, 0x3F,
+    0xFF, 0xF1, 0xD0, 0xBE, 0xFB, 0x5E, 0xAE, 0x79, 0x81, 0x13, 0x2B, 0x9B, 0x33, 0xD9, 0x96, 0xF2,
+    0xB6, 0xD1, 0x4F, 0x49, 0xED, 0x41, 0x40, 0x7A, 0xF5, 0x59, 0x16, 0xD7, 0x69, 0x36, 0xA0, 0x36,
+    0x2A, 0x9E, 0xF3, 0xD3, 0xBB, 0x88, 0x34, 0x45, 0x60, 0x83, 0x70, 0x84, 0xC2, 0xA5, 0xFF, 0x49,
+    0x17, 0x69, 0x3C, 0x15, 0xB6, 0x8D, 0xF8, 0xBD, 0x90, 0x5F, 0x50, 0xF9, 0x31, 0xB1, 0x0B, 0xD8,
+    0x51, 0x79, 0x8F, 0x0E, 0x11, 0x35, 0x14, 0x6F, 0xA9, 0x88, 0xB6, 0x3B, 0x90, 0xDA, 0x51, 0xF9,
+    0xB5, 0x4E, 0xAA, 0xE7, 0xE9, 0x06, 0x51, 0x8C, 0xC4, 0x9D, 0x26, 0x8A, 0x1A, 0x48, 0xD5, 0x53,
+    0xD2, 0x01, 0xC1, 0x9A, 0x46, 0x10, 0x7F, 0xE5, 0x6F, 0x83, 0xC2, 0x88, 0xC1, 0x0D, 0x0C, 0xA2,
+    0xA2, 0x61, 0x02, 0x91, 0xBD, 0x16, 0xD5, 0x00, 0x3A, 0x00, 0xE3, 0x31, 0x3C, 0x8D, 0x45, 0x9D,
+    0xD4, 0x63, 0x2A, 0x45, 0x93, 0xA0, 0x96, 0x32, 0xB2, 0x17, 0x0C, 0xAC, 0x7F, 0xA5, 0x03, 0xAC,
+    0xDC, 0x8D, 0x9A, 0x24, 0xAB, 0xC8, 0x08, 0x8D, 0xDC, 0xB3, 0xAA, 0xC2, 0x74, 0x46, 0xA5, 0xDB,
+    0x4C, 0x11, 0x81, 0x1B, 0xB0, 0xAF, 0x38, 0x5C, 0x4C, 0x0E, 0x5D, 0xE1, 0xE1, 0x21, 0x70, 0x82,
+    0xB1, 0xCC, 0xA7, 0xD5, 0x24, 0x20, 0xF5, 0x2C, 0xF6, 0x1F, 0xB4, 0x57, 0xD6, 0xEE, 0x0C, 0xFE,
+    0xCD, 0x28, 0xFA, 0xF1, 0x97, 0x95, 0xAB, 0xD7, 0xEB, 0x7E, 0xC8, 0xD3, 0xD5, 0xC6, 0xD5, 0xB5,
+    0xA4, 0xDA, 0x1F, 0xBB, 0x2C, 0x42, 0x1E, 0x21, 0xFF, 0x33, 0x9B, 0x5E, 0xB0, 0xC8, 0xC7, 0x84,
+    0xDB, 0x00, 0xCA, 0x88, 0xED, 0x36, 0xB2, 0xE9, 0x7D, 0x8B, 0xB2, 0xB2, 0xB7, 0x4F, 0x25, 0x75,
+    0x4C, 0xBB, 0x74, 0xC1, 0x94, 0xA7, 0x57, 0xDD, 0x99, 0x4F, 0x2F, 0x87, 0x50, 0xAC, 0x9E, 0x8E,
+    0x6F, 0x5E, 0x3C, 0xF0, 0xD1, 0x91, 0xA5, 0x8B, 0x07, 0xA6, 0xE3, 0x79, 0x86, 0xFE, 0x3C, 0x39,
+    0xBF, 0xDE, 0x7E, 0x73, 0xC7, 0xC1, 0x43, 0xDC, 0xB8, 0x1E, 0xB9, 0x97, 0x5E, 0xA0, 0x6B, 0x53,
+    0xD1, 0x43, 0x9B, 0xDE, 0xD6, 0xB9, 0x2C, 0xC6, 0x28, 0x64, 0xC3, 0x3A, 0x5D, 0x69, 0xE3, 0x55,
+    0x43, 0xCD, 0x35, 0xDA, 0xB9, 0xD3, 0x7D, 0x77, 0x8C, 0xF9, 0x0E, 0x42, 0x87, 0x34, 0x37, 0xD5,
+    0x23, 0xB1, 0xEF, 0xE4, 0xC9, 0x77, 0xB6, 0x46, 0x2F, 0x93, 0x2F, 0x59, 0x37, 0xBF, 0xFD, 0xE0,
+    0xC3, 0x47, 0x4B, 0x3F, 0x9C, 0x52, 0xC3, 0xA7, 0xC7, 0x90, 0x2F, 0x5A, 0xFE, 0x36, 0xC7, 0xA9,
+    0x6C, 0x24, 0xCF, 0x6A, 0x3B, 0x13, 0x2F, 0x69, 0xFC, 0x97, 0x60, 0x41, 0xEC, 0x2B, 0x22, 0x4D,
+    0xF4, 0xBC, 0xF4, 0x06, 0x64, 0x61, 0xBE, 0x0C, 0x6C, 0x8E, 0xEC, 0x21, 0xDA, 0x7D, 0x22, 0x65,
+    0xDC, 0xCD, 0xAF, 0x94, 0xB3, 0xA7, 0xA8, 0xD9, 0x11, 0xCF, 0xB7, 0x6A, 0xF5, 0x8A, 0xAC, 0xDE,
+    0xAE, 0x92, 0xA8, 0x9D, 0xD0, 0x47, 0xA1, 0x2B, 0x40, 0x64, 0xD2, 0x63, 0x7A, 0x17, 0x2A, 0x85,
+    0x12, 0x95, 0x58, 0xD2, 0xD1, 0x23, 0x8B, 0x5A, 0x40, 0xEA, 0x74, 0x2D, 0x96, 0xDA, 0xE8, 0x11,
+    0x8A, 0x6F, 0xB9, 0xCE, 0x43, 0xE6, 0x15, 0xE6, 0x8D, 0xC7, 0xCE, 0x8D, 0x7A, 0xE7, 0x81, 0xAF,
+    0x7F, 0xC6, 0x28, 0x63, 0x4B, 0x63, 0xB9, 0xF5, 0x56, 0xB6, 0x56, 0x69, 0x2B, 0xB4, 0x4D, 0xFA,
+    0xBE, 0xB7, 0x51, 0xAA, 0x47, 0xB2, 0x19, 0xA9, 0xA7, 0x96, 0xD7, 0x23, 0xF5, 0xD6, 0xF2, 0x3A,
+    0x9F, 0x29, 0x26, 0xA9, 0x91, 0xB3, 0xE3, 0xE0, 0x6E, 0xA7, 0x8A, 0x24, 0xD4, 0x09, 0x04, 0x4D,
+    0x5A, 0xDD, 0xBD, 0x92, 0x34, 0xD7, 0x97, 0x67, 0x17, 0x85, 0x34, 0x6A, 0x53, 0x92, 0xE7, 0x0F,
+    0x02, 0x59, 0x02, 0xA2, 0x72, 0xB1, 0x06, 0x9C, 0x88, 0x4D, 0x3C, 0x31, 0xEA, 0x41, 0x03, 0x98,
+    0xA7, 0xF6, 0xD1, 0xFE, 0x6D, 0xF4, 0x3F, 0xDB, 0x7F, 0xB5, 0x55, 0x3D, 0x68, 0x26, 0x45, 0x18,
+    0x7E, 0xE6, 0x1B, 0xE3, 0xC2, 0x2D, 0x38, 0x4D, 0x6C, 0x22, 0xB8, 0xB5, 0x07, 0xFA, 0xB5, 0x16,
+    0x72, 0xB3, 0x57, 0x09, 0x5E, 0x11, 0x3B, 0xCB, 0xB4, 0x9A, 0x26, 0x8D, 0x58, 0x1D, 0xEE, 0x4A,
+    0x3A, 0x6D, 0x52, 0xD8, 0xE7, 0x04, 0x9B, 0x8B, 0xC5, 0x35, 0x57, 0x9E, 0xD9, 0x3D, 0x3E, 0x30,
+    0x45, 0x0A, 0xE7, 0xB8, 0x83, 0x2B, 0x6C, 0x56, 0x39, 0x10, 0x14, 0x74, 0x88, 0x8B, 0x6C, 0x74,
+    0x77, 0x5F, 0x9F, 0x77, 0xBF, 0xFC, 0x7C, 0x22, 0x76, 0xC9, 0x30, 0xF3, 0x66, 0x76, 0xBE, 0x79,
+    0x9F, 0xE7, 0xFD, 0x9D, 0x98, 0x1C, 0x40, 0x05, 0xAC, 0xDB, 0x1E, 0xA6, 0x5D, 0x8B, 0x70, 0x65,
+    0x52, 0xE3, 0x11, 0x32, 0xD8, 0x06, 0x77, 0xE1, 0x61, 0xA2, 0x69, 0xF1, 0xDA, 0x33, 0xF7, 0xF8,
+    0x33, 0x89, 0xDF, 0xBA, 0x77, 0xE5, 0x28, 0x0E, 0x80, 0x4F, 0x1F, 0xC2, 0x74, 0x9F, 0x04, 0xB8,
+    0xC5, 0x71, 0x8E, 0xC3, 0xB7, 0xAA, 0x32, 0x89, 0x22, 0xF0, 0xB7, 0x3F, 0x68, 0x67, 0x3D, 0x21,
+    0x5C, 0xC0, 0x2D, 0x7C, 0x44, 0x64, 0xA3, 0xF0, 0x69, 0xE4, 0xDF, 0x09, 0x1F, 0x5B, 0x40, 0x87,
+    0x89, 0xC0, 0x44, 0x5E, 0x99, 0x18, 0xC8, 0x95, 0xE5, 0x4A, 0xF1, 0x5D, 0x97, 0x49, 0xFA, 0x5C,
+    0x8E, 0xE4, 0xE8, 0xC7, 0xD0, 0xC2, 0x46, 0xBC, 0x8E, 0x59, 0x87, 0xB4, 0x44, 0x8F, 0x24, 0x60,
+    0x50, 0x9C, 0x02, 0x2E, 0xC2, 0xE7, 0xEE, 0x34, 0x9F, 0x97, 0x56, 0xA2, 0xAB, 0x8D, 0xF4, 0xE6,
+    0x7D, 0x72, 0x64, 0x2D, 0xC5, 0xDF, 0x2D, 0xDE, 0x00, 0x9A, 0x59, 0x84, 0x2D, 0xB3, 0x3C, 0xE9,
+    0xA9, 0xE8, 0x63, 0x1A, 0x30, 0x8B, 0xB7, 0xB0, 0x96, 0x2C, 0xA8, 0x29, 0xD9, 0x6E, 0x2D, 0x6D,
+    0x3F, 0xBF, 0x7D, 0x78, 0xE7, 0x09, 0xFD, 0x28, 0x5E, 0x79, 0x48, 0x9E, 0x93, 0x80, 0xF9, 0x17,
+    0xFB, 0x7B, 0xE8, 0xBD, 0xD4, 0x2E, 0x6C, 0x8F, 0x64, 0xB1, 0x8D, 0x6D, 0xE9, 0xC7, 0x86, 0x9A,
+    0x0F, 0xDF, 0x20, 0x6D, 0x41, 0xC7, 0xF8, 0x03, 0x6E, 0x4C, 0x47, 0x67, 0x83, 0x9E, 0xD0, 0x1E,
+    0xDB, 0x01, 0x23, 0xA3, 0x58, 0x42, 0x02, 0x64, 0x4F, 0xC3, 0xE9, 0x73, 0xB8, 0x5A, 0x5D, 0xA0,
+    0x09, 0x74, 0x71, 0x2D, 0x8D, 0x49, 0x90, 0xAA, 0x73, 0xD2, 0x62, 0x27, 0x4C, 0xAA, 0xDB, 0x5C,
+    0x0A, 0xA9, 0xD0, 0x34, 0xBF, 0x59, 0x41, 0x9D, 0x8E, 0x7D, 0x4D, 0xF8, 0x51, 0x93, 0x43, 0x10,
+    0x27, 0x39, 0xCC, 0x29, 0x69, 0xFC, 0x66, 0x8D, 0x24, 0x2A, 0x59, 0xC2, 0x54, 0x05, 0x9F, 0x9B,
+    0x9E, 0xEC, 0x5E, 0xA4, 0xB6, 0x22, 0x03, 0x2A, 0x61, 0x4C, 0x44, 0xC4, 0x8C, 0x48, 0x3A, 0x1F,
+    0x50, 0x2C, 0x7A, 0x58, 0xFA, 0xF9, 0x12, 0x71, 0xAC, 0xF2, 0xDE, 0xE5, 0x72, 0x25, 0x34, 0x15,
+    0xFF, 0x37, 0xAE, 0x9E, 0x5D, 0x47, 0x4A, 0x40, 0xA3, 0x80, 0x05, 0x71, 0xB2, 0xE3, 0x86, 0x19,
+    0xCD, 0xCA, 0xEB, 0x26, 0x7D, 0xF4, 0x36, 0xB9, 0xFE, 0xA8, 0x31, 0xFB, 0x81, 0x38, 0x6F, 0xCE,
+    0x57, 0xBD, 0x9C, 0x93, 0xCB, 0x2A, 0x69, 0xC1, 0xC8, 0xA7, 0xC2, 0x0D, 0x53, 0x83, 0x6C, 0xBF,
+    0x84, 0x6D, 0x35, 0xD1, 0x8E, 0x39, 0x8F, 0x4C, 0xF7, 0xC0, 0x3A, 0xC8, 0x6A, 0xCF, 0x62, 0x93,
+    0x5E, 0x49, 0x43, 0x4A, 0x2E, 0x70, 0x45, 0xA6, 0xAC, 0xD8, 0x1D, 0x90, 0xF4, 0x34, 0x9B, 0xBC,
+    0x9E, 0xD6, 0x25, 0x91, 0xA9, 0xAF, 0x36, 0x23, 0xD2, 0x8E, 0x88, 0xDB, 0xEF, 0xDD, 0xBB, 0x4E,
+    0x42, 0xD3, 0x69, 0xC8, 0x98, 0x54, 0xFB, 0xDB, 0xD9, 0x66, 0x3A, 0xB9, 0x3E, 0x42, 0xBC, 0xFC,
+    0xF9, 0x03, 0x16, 0xB8, 0x19, 0xF5, 0xA2, 0xDE, 0x94, 0x12, 0x89, 0x4C, 0xA1, 0x66, 0x32, 0x94,
+    0xF1, 0x81, 0xD2, 0xD9, 0x93, 0xE9, 0xE3, 0x30, 0xD3, 0x43, 0x57, 0xEB, 0xE5, 0x19, 0x0B, 0x9F,
+    0x1F, 0x05, 0xE4, 0x99, 0x26, 0x56, 0xD5, 0x8D, 0x4C, 0x3A, 0x44, 0x19, 0x0F, 0xBE, 0x4E, 0x44,
+    0x47, 0x2D, 0x50, 0x1B, 0xE6, 0x8D, 0x9E, 0x3E, 0xED, 0xF5, 0x63, 0x5C, 0x75, 0xC8, 0x54, 0x1D,
+    0x32, 0xEA, 0x56, 0x6C, 0x79, 0x91, 0xCE, 0xB2, 0x40, 0x52, 0x22, 0x39, 0xF5, 0x2A, 0x2E, 0xD7,
+    0xFC, 0x7C, 0xE9, 0xD9, 0x98, 0x7F, 0x48, 0xAE, 0x8E, 0xEE, 0xF4, 0x8A, 0x6B, 0x94, 0x77, 0xAE,
+    0xDC, 0x1F, 0xAB, 0x79, 0x5C, 0xBF, 0xB3, 0x00, 0x09, 0x82, 0x25, 0xCB, 0x8D, 0x12, 0x66, 0x58,
+    0x76, 0xA2, 0xAC, 0xB0, 0x1E, 0xC8, 0x40, 0x73, 0x08, 0xB4, 0x4B, 0xCC, 0x61, 0xD9, 0xD9, 0x81,
+    0x7E, 0x0B, 0xF1, 0xEA, 0x82, 0x41, 0x7A, 0x81, 0xA4, 0x9D, 0x34, 0x8B, 0x83, 0xFB, 0x73, 0x91,
+    0x63, 0x91, 0x13, 0xD6, 0x65, 0x35, 0x45, 0xA7, 0xD6, 0xAE, 0x33, 0xCB, 0x57, 0x60, 0xFD, 0xBF,
+    0x9D, 0xF6, 0x8D, 0xB4, 0x34, 0xCA, 0xCB, 0x48, 0x44, 0x7B, 0x01, 0x4F, 0x1F, 0xCF, 0xE1, 0xF7,
+    0x90, 0x85, 0x09, 0x9E, 0x41, 0x22, 0xE2, 0x12, 0xFE, 0x4F, 0x8D, 0x8B, 0xA3, 0xE3, 0x0D, 0x1C,
+    0x37, 0xBF, 0x36, 0xAE, 0xFE, 0xF4, 0x12, 0xF4, 0x66, 0x25, 0x9B, 0x22, 0x0B, 0x91, 0xE6, 0xC2,
+    0x58, 0x42, 0x9F, 0x1B, 0x4B, 0xE8, 0xD3, 0xA5, 0xB1, 0xE4, 0xF9, 0xE5, 0xE0, 0xCE, 0x64, 0x6C,
+    0x4F, 0xE8, 0x1D, 0x2A, 0xB8, 0xC0, 0xCE, 0x2A, 0x30, 0xCE, 0x43, 0x71, 0xDC, 0x6D, 0x7C, 0x75,
+    0xFF, 0x4A, 0x40, 0x6F, 0xAA, 0xFD, 0x45, 0x99, 0x5C, 0xD6, 0x26, 0x6F, 0x16, 0x79, 0x16, 0xD8,
+    0x2F, 0xAC, 0x37, 0x56, 0x88, 0x9D, 0x36, 0xB9, 0x0B, 0x84, 0xE4, 0x4F, 0x65, 0xD6, 0x24, 0xDD,
+    0x4C, 0x50, 0xD5, 0xC9, 0xE2, 0x49, 0xEC, 0xD7, 0x2F, 0xB4, 0x8A, 0xAD, 0xE7, 0xB1, 0xF7, 0x6E,
+    0x41, 0xB1, 0xF9, 0xB4, 0x1D, 0x8A, 0xFD, 0x9F, 0xFF, 0x92, 0xAA, 0xC6, 0x3B, 0x9A, 0x40, 0x2B,
+    0x25, 0x03, 0xE1, 0xFF, 0xDD, 0x01, 0x24, 0x3A, 0x9B, 0xFD, 0x94, 0x81, 0xD5, 0x39, 0x5C, 0x4E,
+    0xBE, 0x1C, 0xCB, 0x49, 0x52, 0xCE, 0x8D, 0xD9, 0xBD, 0x21, 0x5B, 0x74, 0xC5, 0xD6, 0x4F, 0x43,
+    0xF5, 0xFD, 0x2A, 0x1E, 0xFD, 0x60, 0x36, 0x0A, 0xBE, 0x3F, 0xFA, 0xB0, 0xF3, 0x79, 0xF7, 0x8A,
+    0xA4, 0xDB, 0xA0, 0x31, 0x19, 0x34, 0x24, 0xDA, 0x32, 0x25, 0xA1, 0x58, 0x98, 0x5A, 0x87, 0x95,
+    0xBC, 0x50, 0xC1, 0x22, 0xA3, 0x08, 0xA8, 0x0E, 0x24, 0xF2, 0xBF, 0x43, 0xDA, 0x51, 0xF0, 0xC5,
+    0xAB, 0x94, 0x5D, 0x85, 0x67, 0x17, 0x2D, 0xC5, 0xAB, 0xF2, 0xE5, 0x74, 0x66, 0x55, 0xEC, 0x68,
+    0xAD, 0x4F, 0x05, 0x2F, 0xDD, 0xF4, 0xCE, 0xA9, 0xA8, 0x29, 0x4E, 0x71, 0x65, 0xE3, 0x1F, 0xB5,
+    0x54, 0x31, 0x6F, 0xD5, 0x40, 0x0C, 0x76, 0x72, 0xA2, 0x19, 0x32, 0xDC, 0xC4, 0x52, 0x86, 0xEC,
+    0x0C, 0xE4, 0x0F, 0xB4, 0xBD, 0x20, 0x46, 0x96, 0x0E, 0xFC, 0x00, 0x56, 0xA6, 0x2E, 0x8C, 0xD0,
+    0x3C, 0x1E, 0x03, 0x23, 0xFC, 0x03, 0x18, 0x3A, 0x20, 0x96, 0xAE, 0x1D, 0x2A, 0x12, 0xB5, 0x03,
+    0x43, 0x87, 0xA6, 0x74, 0x60, 0x60, 0x20, 0x40, 0x25, 0x46, 0x52, 0x71, 0xA8, 0x57, 0x71, 0x89,
+    0xF9, 0x9C, 0x04, 0xF1, 0x5A, 0x01, 0x6A, 0x25, 0x9E, 0x25, 0x5F, 0x72, 0x3E, 0x9F, 0xED, 0xCF,
+    0x67, 0x9B, 0x08, 0x94, 0xDC, 0x26, 0x32, 0xEF, 0x89, 0x96, 0x99, 0x68, 0x69, 0x9D, 0x66, 0xC8,
+    0x27, 0x0D, 0xD8, 0x06, 0x3E, 0x71, 0x81, 0x4F, 0x3D, 0xB8, 0x0B, 0x7D, 0xCA, 0xA1, 0x37, 0x3C,
+    0xF5, 0xE6, 0xEB, 0x8E, 0x37, 0xFB, 0x9F, 0x9D, 0xD9, 0xFB, 0xE6, 0xCC, 0xE1, 0x89, 0x33, 0x6F,
+    0xD9, 0xE5, 0x07, 0x6C, 0xF3, 0x4A, 0x38, 0xB7, 0x45, 0x65, 0x6C, 0x51, 0xA7, 0x96, 0xEE, 0xC1,
+    0x92, 0x72, 0x58, 0x74, 0x83, 0x25, 0xAD, 0x66, 0x1C, 0x5C, 0xEB, 0x20, 0xE5, 0x8E, 0x22, 0x66,
+    0x4F, 0x3C, 0xC9, 0x6B, 0x9C, 0xF2, 0x2D, 0x4F, 0x91, 0xCB, 0x33, 0x32, 0x7B, 0x0D, 0x85, 0xBE,
+    0x40, 0x80, 0xF8, 0x09, 0xE4, 0x27, 0xDD, 0x73, 0xA4, 0x7C, 0xFE, 0x7D, 0x81, 0x77, 0x99, 0xD9,
+    0xA5, 0x58, 0x32, 0x70, 0xA3, 0xE4, 0xFA, 0x02, 0x9F, 0xFE, 0x32, 0xBB, 0x04, 0x8E, 0x4B, 0x2C,
+    0x56, 0x1C, 0x82, 0x83, 0x55, 0xFA, 0x03, 0x05, 0x45, 0x4D, 0xC4, 0x5C, 0x53, 0xCE, 0x5C, 0x6A,
+    0x17, 0x75, 0x61, 0x4B, 0xDA, 0x9A, 0x92, 0xF2, 0x27, 0x16, 0x7E, 0x7A, 0x87, 0xA3, 0xE7, 0x64,
+    0x88, 0x65, 0x42, 0xE6, 0x0D, 0xAF, 0xAE, 0x01, 0x3F, 0xF3, 0x14, 0x6C, 0x35, 0x16, 0xC2, 0xAE,
+    0xA4, 0x35, 0x7E, 0x36, 0x63, 0x5A, 0x67, 0x04, 0x7D, 0xFC, 0x14, 0xC0, 0x9C, 0x3E, 0x2F, 0x11,
+    0x4E, 0x3A, 0x7F, 0xDC, 0x42, 0xEE, 0x3E, 0xF4, 0xBF, 0x64, 0xA4, 0xF6, 0x01, 0x7E, 0xC9, 0xCC,
+    0x1D, 0xEE, 0x6B, 0x5D, 0x51, 0xDC, 0x00, 0x0F, 0xEB, 0x9A, 0xF4, 0x31, 0x6A, 0xE8, 0xD5, 0xE2,
+    0x8B, 0x39, 0x3B, 0x4D, 0xA7, 0x56, 0x75, 0x9E, 0x8C, 0x27, 0xD5, 0x92, 0xE2, 0x4A, 0x71, 0x1B,
+    0xB5, 0xA6, 0x1E, 0x5D, 0x66, 0xFD, 0x1A, 0xB9, 0x61, 0xC7, 0xC3, 0x67, 0x2C, 0x3B, 0xE5, 0x47,
+    0xE9, 0xA0, 0x94, 0xD4, 0x67, 0xA4, 0xF0, 0xDD, 0x4B, 0x9B, 0x41, 0xDA, 0xCE, 0x48, 0x83, 0x62,
+    0xB3, 0x97, 0x32, 0x5E, 0x0D, 0x24, 0x68, 0xE4, 0x99, 0x9D, 0x96, 0x6D, 0xD8, 0x86, 0x2C, 0xA5,
+    0x66, 0xCA, 0x9C, 0xA1, 0x1C, 0x59, 0xFD, 0xA3, 0x7F, 0xFB, 0x90, 0x53, 0x68, 0xC5, 0x8D, 0x39,
+    0xE8, 0xB7, 0xDA, 0x25, 0xB2, 0x3D, 0xE6, 0xA1, 0x32, 0xB8, 0x42, 0x1A, 0x50, 0x02, 0x7E, 0x4D,
+    0xB6, 0x02, 0x17, 0x77, 0x43, 0x41, 0x2C, 0x96, 0x05, 0x74, 0xEF, 0xAF, 0x77, 0x84, 0x53, 0x81,
+    0x1E, 0x8D, 0x21, 0xF5, 0x32, 0x80, 0xB2, 0x43, 0xA0, 0xDD, 0x19, 0x69, 0x32, 0x20, 0x57, 0x23,
+    0xF2, 0x62, 0x40, 0xAE, 0x47, 0xDD, 0xA3, 0x41, 0x7A, 0x77, 0x4C, 0x56, 0x28, 0xCA, 0xC5, 0x98,
+    0xA0, 0x85, 0x8D, 0x33, 0xFD, 0x51, 0x94, 0x91, 0x9F, 0xE5, 0x7C, 0x72, 0x9E, 0x95, 0xB0, 0x1B,
+    0x38, 0x72, 0xA6, 0x8C, 0x1D, 0x02, 0xB5, 0xC2, 0xA8, 0xD1, 0x06, 0x18, 0x2A, 0xE0, 0x19, 0x52,
+    0x4D, 0x68, 0xC1, 0x00, 0x29, 0x54, 0x48, 0x79, 0x04, 0x5F, 0xBA, 0xA4, 0xBF, 0xD1, 0xFF, 0xF5,
+    0x2B, 0xA0, 0x2B, 0x79, 0x05, 0x60, 0x44, 0xA2, 0xBB, 0x9C, 0x54, 0x13, 0x97, 0xF3, 0xF2, 0x17,
+    0x6C, 0x2C, 0xA2, 0x88, 0x4D, 0xA6, 0xBC, 0x19, 0x6E, 0xC1, 0xE2, 0x7C, 0xF1, 0xC9, 0xBB, 0x3E,
+    0x00, 0xAF, 0xC8, 0xD3, 0x43, 0x76, 0x25, 0xA3, 0x7F, 0x13, 0x46, 0x0C, 0x63, 0x14, 0xE7, 0x37,
+    0x5B, 0x14, 0xAC, 0x29, 0xD3, 0x2A, 0xB6, 0xD8, 0x72, 0x6C, 0x29, 0x3D, 0x44, 0x47, 0x75, 0x9D,
+    0xD4, 0x26, 0x6C, 0xA1, 0x1C, 0x95, 0x94, 0x54, 0x5E, 0x0F, 0xD5, 0xD3, 0xF7, 0x83, 0x78, 0x35,
+    0x48, 0x67, 0x62, 0x87, 0x6A, 0xBC, 0x43, 0x7A, 0x42, 0x8E, 0xF4, 0x11, 0xB1, 0xD3, 0xDC, 0xB4,
+    0xF9, 0xFE, 0xA4, 0x75, 0xF1, 0x87, 0x47, 0xBE, 0xE3, 0xA7, 0x5C, 0xA3, 0x79, 0x2B, 0x39, 0x15,
+    0x15, 0x0A, 0xBB, 0x4C, 0xB1, 0x0B, 0x4F, 0xD7, 0xC8, 0xAB, 0x7A, 0x25, 0x74, 0xC9, 0xE3, 0x36,
+    0xFA, 0xD4, 0x04, 0x6E, 0x8B, 0xD6, 0x93, 0x49, 0xBA, 0xDB, 0xA2, 0x4F, 0xDE, 0x7A, 0x19, 0x00,
+    0x06, 0x40, 0xF7, 0x99, 0x0F, 0x65, 0x6C, 0x5C, 0xCD, 0x68, 0x31, 0x23, 0x8C, 0x16, 0xE9, 0xD1,
+    0xE2, 0x37, 0xB4, 0xF0, 0x14, 0x73, 0xC1, 0x9A, 0x4D, 0xB7, 0x1C, 0xBA, 0xED, 0xC0, 0x6F, 0x91,
+    0xB7, 0xE4, 0xB7, 0x30, 0x47, 0x18, 0x83, 0xA3, 0x4D, 0xB9, 0x5D, 0x68, 0xD7, 0x49, 0xF7, 0xD3,
+    0x1F, 0x89, 0x79, 0x28, 0x81, 0x9E, 0xA3, 0x0B, 0x59, 0xB8, 0x01, 0xF8, 0x14, 0x70, 0x19, 0x9D,
+    0x34, 0x49, 0xB6, 0x7D, 0xA9, 0xBB, 0xE1, 0xC7, 0x2A, 0x3A, 0xAD, 0xE3, 0xBC, 0xD2, 0x33, 0xA5,
+    0x7E, 0x91, 0x8B, 0xC9, 0x8E, 0x4B, 0x77, 0x9D, 0xD9, 0xF5, 0xE6, 0x9D, 0xBF, 0x3E, 0x7D, 0x79,
+    0xB9, 0x80, 0x2F, 0x47, 0x3F, 0x01, 0x9D, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x18, 0x7D, 0x63, 0x73,
+    0x67, 0xE9, 0x5C, 0x18, 0x21, 0xAA, 0x6B, 0xDC, 0x22, 0x0A, 0xE6, 0x2F, 0xC8, 0x8D, 0x53, 0x51,
+    0x50, 0x2C, 0x05, 0x47, 0x4B, 0x4D, 0x9A, 0x34, 0x14, 0x14, 0xEC, 0xD9, 0xB9, 0xFC, 0x01, 0xA4,
+    0xA0, 0x87, 0xE2, 0x0A, 0x14, 0x04, 0xD7, 0x5E, 0xB1, 0xBB, 0x76, 0xD8, 0x32, 0x05, 0x0E, 0x08,
+    0x51, 0xA4, 0x88, 0x81, 0x93, 0x22, 0x91, 0x02, 0x17, 0x56, 0xE2, 0x25, 0x33, 0xFE, 0x78, 0xE3,
+    0xCD, 0x9D, 0x12, 0x72, 0x09, 0x9B, 0x58, 0x73, 0xA3, 0xDB, 0xF1, 0x37, 0xDF, 0x8F, 0xF7, 0xBD,
+    0xEF, 0x19, 0x53, 0x40, 0xA0, 0x1E, 0x64, 0xDC, 0xC1, 0xFF, 0xCF, 0x9E, 0x60, 0xD5, 0x25, 0xD2,
+    0x99, 0xE3, 0xFE, 0x52, 0xD0, 0xCF, 0x94, 0x3D, 0x81, 0xED, 0x60, 0x4F, 0x94, 0x2D, 0xC5, 0x1A,
+    0x71, 0x5A, 0xDC, 0xB6, 0x3B, 0x38, 0x33, 0x2C, 0x8B, 0x44, 0x44, 0x5A, 0x73, 0x2C, 0x77, 0x68,
+    0x2E, 0xFB, 0xF3, 0x99, 0x12, 0x19, 0x4E, 0xC0, 0xAD, 0xC3, 0x00, 0x9C, 0x28, 0xFA, 0x2E, 0x45,
+    0xFE, 0xF9, 0xC1, 0xD0, 0x6E, 0xD0, 0x7E, 0xDB, 0x76, 0xB9, 0x9C, 0xF2, 0xFA, 0xF6, 0x00, 0xB1,
+    0xF1, 0xD0, 0xE6, 0x08, 0x7A, 0xC4, 0x35, 0x4C, 0x86, 0x05, 0x02, 0xF7, 0x46, 0x28, 0x7D, 0x24,
+    0x7D, 0x20, 0x85, 0x3A, 0x45, 0xD2, 0xE1, 0xAD, 0x06, 0x92, 0x85, 0x3D, 0x76, 0x33, 0xC4, 0x0D,
+    0x02, 0x4B, 0x7F, 0x19, 0x9E, 0x7D, 0xD4, 0x22, 0x8B, 0xA5, 0xD1, 0xD7, 0x7A, 0xB3, 0x3F, 0xCB,
+    0xC5, 0x95, 0xE2, 0x1C, 0xE8, 0x0B, 0xF9, 0x5F, 0xDF, 0x33, 0xE3, 0x44, 0x9C, 0x2A, 0x1B, 0x24,
+    0x19, 0x52, 0x60, 0x6F, 0x2C, 0xF5, 0x6D, 0x5C, 0xF8, 0x6C, 0xE4, 0xE7, 0x3D, 0xFE, 0xCE, 0x94,
+    0x54, 0xD1, 0xA3, 0x2E, 0x2D, 0xE6, 0xAF, 0xE1, 0x61, 0xE7, 0xDA, 0x51, 0xFA, 0x63, 0xAF, 0x97,
+    0xD6, 0xFC, 0x62, 0xCD, 0x6F, 0xF6, 0x35, 0x3C, 0x7C, 0x8A, 0x84, 0xA0, 0x20, 0xEE, 0xC6, 0x1B,
+    0xBB, 0x88, 0x6A, 0xD5, 0xB1, 0xAC, 0x34, 0x8B, 0xEA, 0xA0, 0xC3, 0x1C, 0x3A, 0x8B, 0x1B, 0x22,
+    0x26, 0x48, 0xE2, 0xE5, 0x1F, 0xED, 0x47, 0xA3, 0xD5, 0x4E, 0x74, 0xA7, 0x9B, 0xA6, 0xEF, 0xFF,
+    0xDC, 0xCD, 0xF5, 0x07, 0x7F, 0xF6, 0xEC, 0xCA, 0x25, 0xFA, 0xC4, 0x58, 0x47, 0x9B, 0x66, 0xB3,
+    0x27, 0xD1, 0xDF, 0x19, 0xE1, 0x79, 0x7A, 0xCD, 0xCF, 0x16, 0x73, 0x18, 0x3C, 0x61, 0x4C, 0xB2,
+    0x6C, 0x6D, 0x9E, 0xDE, 0x7E, 0xE8, 0xD6, 0xF9, 0x7E, 0xC3, 0xB8, 0x0C, 0xFF, 0x64, 0x63, 0x7C,
+    0x3D, 0x6E, 0x05, 0x13, 0x30, 0xD5, 0xDA, 0x2B, 0x41, 0x87, 0x6E, 0xC7, 0x8E, 0x63, 0xEB, 0xEA,
+    0xAF, 0x08, 0x45, 0x6A, 0x52, 0xA4, 0xF3, 0x6F, 0xD4, 0x62, 0x52, 0x04, 0xF2, 0xB8, 0x0E, 0x48,
+    0x23, 0xB8, 0xD0, 0xC2, 0xA0, 0x44, 0x5A, 0xA5, 0xBC, 0x9F, 0x78, 0xA3, 0x16, 0x29, 0x0D, 0x95,
+    0xF4, 0x2C, 0xE1, 0x74, 0xED, 0xAE, 0xFF, 0x3C, 0x18, 0x3E, 0x0B, 0x7F, 0xEA, 0xC2, 0x65, 0x73,
+    0x0E, 0xDB, 0x5E, 0x5E, 0x18, 0x92, 0xF6, 0xB1, 0x35, 0xD9, 0x2C, 0xC7, 0xF4, 0x00, 0xD3, 0x1C,
+    0x0B, 0xAE, 0x12, 0x43, 0x09, 0xE1, 0x12, 0x08, 0x19, 0x94, 0x3C, 0xCB, 0x20, 0x82, 0x9D, 0x90,
+    0xBD, 0x0F, 0xFA, 0x1C, 0x6E, 0x8E, 0x85, 0xC3, 0x01, 0xF7, 0xF2, 0x32, 0x09, 0x6A, 0xB5, 0xF4,
+    0x7C, 0x45, 0x03, 0x6C, 0x01, 0x09, 0xF3, 0x1F, 0xCB, 0x98, 0x5D, 0x40, 0x99, 0xFF, 0xF7, 0xB0,
+    0x86, 0xA0, 0xCC, 0x02, 0xA9, 0xE3, 0xFB, 0x9D, 0xCE, 0xE6, 0xAF, 0x74, 0x37, 0xFC, 0xBD, 0x89,
+    0x57, 0x4D, 0x92, 0xD7, 0xC9, 0xA4, 0xDA, 0xFC, 0xE2, 0x48, 0xB1, 0xDE, 0x2C, 0x3D, 0xC5, 0xDE,
+    0x3D, 0xFC, 0xF6, 0x15, 0x22, 0x6E, 0xDF, 0x80, 0xC7, 0x09, 0x49, 0xBB, 0xFE, 0x4B, 0xDB, 0xF1,
+    0xEE, 0xD6, 0x95, 0xEF, 0xA8, 0x0B, 0xDE, 0x50, 0xD6, 0x9D, 0xBF, 0xD8, 0xEE, 0x43, 0xE0, 0x0B,
+    0xFE, 0x66, 0xA6, 0xEC, 0x98, 0xCE, 0x10, 0xF2, 0xD4, 0x80, 0x14, 0x1D, 0xC1, 0xE3, 0xB9, 0x5A,
+    0x9F, 0x5F, 0x6D, 0x61, 0xA4, 0xA2, 0x43, 0x65, 0xA5, 0xD3, 0x93, 0xBF, 0xAF, 0x3F, 0x5C, 0xF5,
+    0x26, 0xFF, 0xE4, 0x50, 0x1E, 0xF5, 0xA9, 0x48, 0x26, 0xD2, 0x84, 0x62, 0x91, 0xAE, 0xBC, 0x38,
+    0x78, 0x69, 0x88, 0xE8, 0xA7, 0x5C, 0x07, 0x64, 0x03, 0x75, 0x05, 0xF2, 0xCB, 0xA3, 0x1A, 0x11,
+    0x22, 0x8F, 0x52, 0x5A, 0x21, 0x22, 0x4F, 0xC8, 0xB0, 0x2B, 0xC5, 0xBA, 0x58, 0x0B, 0x3B, 0x83,
+    0x3B, 0x5F, 0xD3, 0x71, 0xE5, 0xCA, 0x99, 0xFB, 0x83, 0x91, 0x21, 0x95, 0x21, 0x1A, 0x86, 0x97,
+    0x37, 0x77, 0x23, 0x0F, 0x2F, 0x68, 0xEE, 0x26, 0x77, 0x77, 0x2E, 0x1F, 0xA5, 0xCB, 0x0B, 0x94,
+    0x60, 0xB3, 0xB8, 0xD9, 0x38, 0xC3, 0xF1, 0x39, 0xD2, 0x2F, 0x79, 0xE2, 0x16, 0x1C, 0x0C, 0x7D,
+    0x68, 0xC3, 0x2E, 0xA9, 0x39, 0x60, 0x11, 0xE5, 0xC1, 0x41, 0xDF, 0xAB, 0xC0, 0xB9, 0x8A, 0x25,
+    0x83, 0x69, 0x39, 0x94, 0x04, 0xB1, 0x86, 0x62, 0x1A, 0xA6, 0x52, 0xC7, 0x3D, 0xB4, 0x80, 0x35,
+    0x41, 0x8F, 0x88, 0xB3, 0x71, 0xDC, 0x38, 0x90, 0xE4, 0x40, 0xE3, 0xCA, 0xC9, 0x2D, 0x6B, 0xA3,
+    0x7B, 0xD5, 0xDE, 0x2C, 0xBA, 0x5B, 0xD9, 0x99, 0xBE, 0x7D, 0xB7, 0x2D, 0x1D, 0xFD, 0x50, 0xBB,
+    0x6A, 0x6A, 0xC5, 0xB8, 0x6D, 0x17, 0xEC, 0xD9, 0x02, 0x79, 0xD2, 0xC6, 0x1D, 0x87, 0x6F, 0xD2,
+    0xEE, 0x1C, 0xDD, 0x7C, 0x3E, 0xB3, 0x12, 0xC9, 0xB2, 0x0B, 0x7A, 0x5D, 0x99, 0xCC, 0x85, 0x6D,
+    0xDC, 0x1E, 0xC0, 0x7C, 0x59, 0x07, 0x8E, 0xB1, 0xA4, 0x40, 0xD9, 0x8D, 0x59, 0x31, 0x39, 0xE5,
+    0xC6, 0x0E, 0x53, 0x1E, 0x76, 0x85, 0x72, 0xD1, 0x42, 0x3B, 0x04, 0x1E, 0x7B, 0xF5, 0xF1, 0x0D,
+    0x16, 0x40, 0x23, 0xAF, 0x14, 0x5B, 0xFB, 0xCF, 0xF9, 0x27, 0x51, 0xFC, 0x2D, 0x6A, 0x1D, 0xCB,
+    0x88, 0x69, 0x07, 0x2F, 0x3B, 0xE9, 0xD7, 0x05, 0xC2, 0x8E, 0xC7, 0x39, 0xF9, 0x14, 0xF3, 0x0B,
+    0x44, 0xE5, 0xA1, 0x7A, 0x55, 0xA6, 0xA0, 0x34, 0x51, 0x82, 0xA8, 0x4F, 0x74, 0xCA, 0xAC, 0xE9,
+    0x35, 0x6D, 0x90, 0x5F, 0x77, 0x88, 0x2C, 0xD5, 0xCC, 0x90, 0xC5, 0x6F, 0x6A, 0xE9, 0x38, 0x2F,
+    0x8B, 0x9B, 0x5F, 0x3D, 0x1D, 0x67, 0xE3, 0x8F, 0x66, 0x44, 0xFC, 0x91, 0x4B, 0x03, 0x4F, 0x6F,
+    0xC4, 0xC3, 0x7F, 0x13, 0xF6, 0xF2, 0x34, 0x0A, 0x67, 0xE4, 0x5F, 0x95, 0x7E, 0xB6, 0xD8, 0x1F,
+    0xB5, 0xF2, 0x53, 0xC0, 0xF9, 0x8F, 0x5A, 0x1E, 0x97, 0x1C, 0x06, 0xF6, 0x31, 0x53, 0xD6, 0x8B,
+    0xAC, 0x48, 0x15, 0xFA, 0x99, 0xE4, 0x67, 0xB6, 0xF5, 0x5F, 0x63, 0xCE, 0x40, 0xD4, 0x33, 0xD3,
+    0x7C, 0x69, 0x11, 0xBA, 0x17, 0x93, 0xE2, 0x5F, 0xB5, 0x95, 0xBF, 0x8E, 0xDD, 0x44, 0x14, 0xC6,
+    0xBF, 0xB1, 0xA5, 0x58, 0xC2, 0x12, 0xA6, 0xA1, 0x4A, 0xE1, 0x3E, 0x05, 0xF3, 0x02, 0x04, 0x3B,
+    0x35, 0x45, 0xB6, 0x08, 0xEF, 0x80, 0xD2, 0xDC, 0x17, 0x80, 0xB5, 0xF3, 0x06, 0x14, 0x50, 0x93,
+    0x22, 0x05, 0xB9, 0x08, 0xA5, 0xA1, 0xD8, 0xE2, 0x66, 0x67, 0xD0, 0x4A, 0x34, 0x14, 0xF8, 0x0D,
+    0xB0, 0x04, 0x55, 0x68, 0x46, 0x91, 0x95, 0xCC, 0x92, 0xB1, 0x0F, 0xDF, 0xB9, 0xD7, 0x1B, 0x58,
+    0x6D, 0x01, 0x84, 0x8D, 0x75, 0xCF, 0xC8, 0x77, 0xAE, 0xEF, 0x39, 0xBF, 0xF9, 0xCE, 0x1F, 0x03,
+    0xB0, 0x77, 0xA2, 0x95, 0xA9, 0x92, 0x31, 0x93, 0x16, 0x17, 0x57, 0x76, 0xCE, 0x9D, 0xA9, 0x79,
+    0x12, 0x6F, 0x67, 0x71, 0x67, 0xD2, 0x09, 0xD2, 0x84, 0x74, 0x62, 0x92, 0x93, 0xD4, 0xC8, 0x6C,
+    0x65, 0xBE, 0x31, 0x1F, 0x23, 0x4B, 0x7C, 0xB2, 0xF1, 0x40, 0xB1, 0xF0, 0xC6, 0x05, 0xA0, 0xA2,
+    0x0B, 0x73, 0x1E, 0xB9, 0x7B, 0xD7, 0xA3, 0x08, 0xDC, 0x76, 0x45, 0x40, 0x35, 0x34, 0xAD, 0x49,
+    0x79, 0x44, 0x23, 0xE2, 0x73, 0x91, 0x19, 0x4E, 0x24, 0x54, 0x22, 0x62, 0x16, 0x14, 0xB1, 0x19,
+    0xD0, 0x9D, 0x25, 0xE4, 0xB3, 0x7A, 0xA3, 0x95, 0xF4, 0x08, 0x19, 0x56, 0xB7, 0x37, 0x87, 0x0B,
+    0xA6, 0xD3, 0xCF, 0x21, 0xD2, 0x2E, 0x6E, 0x24, 0x93, 0x45, 0x57, 0xF6, 0xD5, 0xD9, 0x90, 0x07,
+    0x42, 0x59, 0x11, 0x7A, 0x1D, 0x9C, 0x4C, 0x37, 0xE6, 0x0E, 0xA8, 0x7B, 0x54, 0xBD, 0x7A, 0xC9,
+    0xA4, 0x47, 0x33, 0xC2, 0x7C, 0x0F, 0x7C, 0xC8, 0xFF, 0xEF, 0x68, 0x13, 0x8F, 0x46, 0x4E, 0x73,
+    0xF4, 0xFA, 0xA4, 0x30, 0x2E, 0xA2, 0x96, 0x44, 0xA6, 0x94, 0x89, 0xC4, 0x9C, 0x47, 0x28, 0x79,
+    0xB0, 0x8A, 0x8F, 0xD6, 0xE1, 0x60, 0xF6, 0xC2, 0x74, 0x6F, 0x69, 0x3F, 0x25, 0x7A, 0x2C, 0x45,
+    0x12, 0xA3, 0x26, 0x43, 0x83, 0xA5, 0x7D, 0x00, 0x04, 0x8D, 0xFA, 0x11, 0xB0, 0xF7, 0x5E, 0xD3,
+    0x55, 0xB0, 0xAF, 0x7E, 0x48, 0x28, 0x47, 0xD8, 0x16, 0x33, 0xB2, 0x88, 0x62, 0x7A, 0x8F, 0x4A,
+    0xD7, 0x32, 0xBE, 0xB3, 0xAC, 0xD1, 0xE9, 0x36, 0xD7, 0x70, 0xC2, 0xC3, 0x6F, 0x3C, 0x62, 0x1E,
+    0xF0, 0xF7, 0xEB, 0xBA, 0xE8, 0x6E, 0x03, 0x1D, 0x8C, 0xF8, 0xE2, 0x65, 0xA8, 0xDB, 0xDD, 0xEA,
+    0x7C, 0x33, 0x12, 0xB1, 0x5C, 0x42, 0xED, 0x61, 0x7B, 0x65, 0x6C, 0x5A, 0xBD, 0xA9, 0x87, 0x96,
+    0x90, 0x85, 0x44, 0x3C, 0xA1, 0x7A, 0x8C, 0xA6, 0x89, 0xCE, 0x57, 0xCB, 0xBE, 0xB9, 0x7E, 0x38,
+    0x26, 0x7F, 0x62, 0x54, 0xB8, 0xDE, 0x3C, 0x56, 0xBF, 0x37, 0xFF, 0x51, 0xBA, 0x47, 0xE6, 0x21,
+    0x8E, 0xF9, 0x63, 0xCD, 0x14, 0x17, 0x2C, 0x1C, 0xC3, 0x9A, 0xC3, 0x43, 0xBC, 0x15, 0xE9, 0x80,
+    0xE3, 0x6C, 0xAA, 0x7F, 0x19, 0x0A, 0x69, 0x0D, 0x43, 0x9D, 0xBC, 0x76, 0xDF, 0x57, 0xE2, 0xED,
+    0x2B, 0xCF, 0x92, 0x3B, 0x05, 0x9E, 0x82, 0x98, 0x7A, 0xD3, 0xDD, 0x61, 0x9D, 0xF7, 0xE4, 0xCC,
+    0x5C, 0xAF, 0xCF, 0x95, 0x83, 0x65, 0x3B, 0xA5, 0x43, 0x83, 0x58, 0xD6, 0x76, 0xD5, 0x5E, 0xC2,
+    0x74, 0xF2, 0x9B, 0xF6, 0x43, 0xEB, 0xB4, 0x84, 0xB7, 0x12, 0x1C, 0xAA, 0xE8, 0x28, 0xB5, 0xA3,
+    0xC3, 0xAB, 0x96, 0xD1, 0x36, 0x6C, 0x43, 0x51, 0x8B, 0xDA, 0x47, 0x34, 0xEF, 0xE4, 0x7C, 0x6D,
+    0x9E, 0xEA, 0xC7, 0x1E, 0xF9, 0x73, 0x46, 0x4A, 0x8C, 0xD8, 0x70, 0xA7, 0xFA, 0xD9, 0xD7, 0xBF,
+    0xBE, 0x0C, 0x76, 0x7F, 0x18, 0x41, 0xE5, 0xA5, 0x2F, 0x7C, 0x3D, 0x66, 0x81, 0xFD, 0x98, 0xB0,
+    0x50, 0x5E, 0xD7, 0x17, 0x22, 0x23, 0x7B, 0x2B, 0xB2, 0x0A, 0xB5, 0x65, 0xBF, 0xF6, 0x07, 0xAA,
+    0x3D, 0x96, 0x2E, 0xCC, 0x0C, 0xC1, 0xE0, 0x50, 0x46, 0x2E, 0xAC, 0x06, 0x65, 0xD9, 0x2F, 0x1C,
+    0x06, 0xEB, 0xF2, 0xBE, 0x7C, 0xB9, 0xDF, 0xCB, 0x75, 0xD9, 0xA8, 0xEA, 0x7B, 0xE9, 0xE9, 0x54,
+    0x21, 0x75, 0xF1, 0xF8, 0x0B, 0x93, 0xA6, 0xFF, 0x52, 0xBB, 0xE5, 0x1E, 0xEB, 0x77, 0xB3, 0x34,
+    0xA0, 0xF4, 0x7B, 0xC8, 0x26, 0x5F, 0xF0, 0x19, 0x67, 0xC3, 0x8E, 0x7C, 0xCA, 0xF8, 0x34, 0x5B,
+    0xD0, 0x11, 0xAD, 0xA1, 0x29, 0x62, 0xB6, 0x50, 0x73, 0xDC, 0x23, 0x36, 0x13, 0x3B, 0x6C, 0xBF,
+    0x3A, 0xBA, 0x24, 0xE8, 0x2D, 0x27, 0x77, 0x45, 0xCE, 0x78, 0x26, 0x26, 0x84, 0x15, 0x5D, 0x0D,
+    0x5A, 0x5E, 0x4C, 0xA7, 0xEF, 0x24, 0xB0, 0x20, 0x8A, 0x73, 0x68, 0x1E, 0xBB, 0x16, 0xF5, 0xB3,
+    0xED, 0xC7, 0x22, 0xCF, 0x0F, 0x62, 0x6E, 0x54, 0x04, 0x1C, 0x59, 0x89, 0x8D, 0xA4, 0xFB, 0xDB,
+    0x7B, 0xB8, 0x72, 0x99, 0xD3, 0xB6, 0x94, 0xD1, 0x3E, 0x88, 0xCD, 0x27, 0xBB, 0x4E, 0x66, 0x27,
+    0xF3, 0x9A, 0xF1, 0x67, 0xDF, 0xF1, 0x20, 0x95, 0xCC, 0xC6, 0xD1, 0x03, 0xF2, 0x60, 0x29, 0xA6,
+    0xAF, 0xC5, 0x9B, 0x43, 0x05, 0x5C, 0x03, 0x96, 0x4E, 0xE9, 0xFA, 0xCA, 0x94, 0xFE, 0x0F, 0x58,
+    0x14, 0x9C, 0x0D, 0x56, 0x4C, 0xD4, 0x0E, 0xB8, 0xDF, 0x5E, 0x0F, 0x16, 0x83, 0xB0, 0x08, 0x64,
+    0xFF, 0xD9, 0xBE, 0x89, 0x5A, 0xFF, 0x23, 0xB8, 0x8E, 0x78, 0x96, 0x3A, 0x23, 0x77, 0x5E, 0xE7,
+    0xF9, 0xBF, 0x4C, 0x0E, 0xDE, 0x85, 0x4E, 0x68, 0x8E, 0x8B, 0x3F, 0x5A, 0x70, 0x78, 0xD8, 0x35,
+    0x43, 0xC5, 0x68, 0xDB, 0xAE, 0x6B, 0xD9, 0xE3, 0x1A, 0xAD, 0xEC, 0x2F, 0x1D, 0x25, 0xFB, 0x56,
+    0x26, 0xD1, 0x37, 0xDF, 0x72, 0x00, 0xC4, 0x81, 0x56, 0x01, 0xF9, 0x0E, 0x53, 0xDA, 0x2F, 0x56,
+    0x75, 0xCD, 0xB2, 0x7D, 0x44, 0x40, 0x16, 0xF1, 0x4F, 0x22, 0x2F, 0x44, 0xDB, 0x89, 0xD2, 0xA7,
+    0xEA, 0xF7, 0x90, 0xB3, 0xFE, 0xE5, 0xF0, 0x22, 0x7A, 0xC3, 0xBA, 0x7A, 0x1B, 0xD7, 0x9F, 0xBD,
+    0x55, 0x31, 0x93, 0xDC, 0x34, 0x14, 0x7E, 0xB6, 0x86, 0xB8, 0xD8, 0x42, 0x0D, 0x30, 0x19, 0x98,
+    0x44, 0x7D, 0x98, 0xC1, 0xBF, 0x20, 0x2B, 0x27, 0x29, 0x28, 0x28, 0x92, 0xE2, 0xAE, 0xA2, 0x08,
+    0x25, 0xE1, 0x37, 0x70, 0x6B, 0x0F, 0x29, 0x29, 0xB8, 0x82, 0x1A, 0xD2, 0xD0, 0x84, 0x22, 0x0D,
+    0xC5, 0x15, 0xD9, 0x93, 0xC3, 0x16, 0x14, 0x69, 0x74, 0x50, 0x5C, 0x91, 0x22, 0x66, 0x32, 0x0C,
+    0x03, 0x0D, 0x0E, 0x23, 0x12, 0x07, 0x24, 0x3D, 0x3E, 0x79, 0x77, 0x2F, 0x7B, 0xC7, 0x65, 0x28,
+    0x08, 0xC8, 0xEF, 0xD9, 0x6F, 0x65, 0xF9, 0xE9, 0xFB, 0x9E, 0xDE, 0x7B, 0x4B, 0x94, 0xC6, 0xA4,
+    0x21, 0xCA, 0x02, 0x8C, 0xDA, 0x11, 0x95, 0x5F, 0x58, 0x9A, 0x58, 0x55, 0xD1, 0xDF, 0x47, 0xB6,
+    0x4D, 0x54, 0x30, 0xB7, 0x82, 0xD9, 0x13, 0xC3, 0x28, 0x03, 0x9D, 0x15, 0x31, 0x7D, 0xD8, 0xE2,
+    0xCD, 0x90, 0x0C, 0xB8, 0x9A, 0x0C, 0xD9, 0xCF, 0x95, 0x69, 0x14, 0xDF, 0x1F, 0x88, 0x43, 0xDD,
+    0xBE, 0x62, 0x1E, 0x45, 0x12, 0x4E, 0xC7, 0x6D, 0xCE, 0xF0, 0x55, 0x3F, 0xC1, 0xAD, 0x2A, 0x99,
+    0x3B, 0x7A, 0x93, 0x77, 0x89, 0x14, 0x91, 0xEC, 0x48, 0x06, 0x92, 0x0F, 0xAD, 0x6C, 0x66, 0xC7,
+    0xB7, 0x34, 0xD7, 0x1B, 0x2C, 0x8C, 0x66, 0xD8, 0x11, 0xF1, 0x6D, 0x32, 0x9F, 0x34, 0xEA, 0x7B,
+    0x5B, 0xB8, 0xBD, 0x2C, 0x94, 0x97, 0xF8, 0x1D, 0x66, 0xCB, 0xEC, 0x24, 0xC0, 0x18, 0x03, 0x27,
+    0xED, 0xFB, 0xAA, 0xD3, 0xDC, 0x4B, 0x76, 0x05, 0x0F, 0x94, 0x5D, 0x5B, 0x7A, 0x10, 0x7D, 0x59,
+    0x11, 0xA6, 0x29, 0xE3, 0x90, 0xE0, 0x9F, 0x46, 0x8C, 0x5E, 0xC3, 0xE2, 0x1A, 0x7E, 0x34, 0x48,
+    0x49, 0xB0, 0xCB, 0xD9, 0x66, 0x8D, 0xEE, 0xB0, 0xDE, 0xAF, 0x48, 0x8D, 0xEC, 0x4C, 0x73, 0xFE,
+    0x33, 0xB0, 0x63, 0x6F, 0x1A, 0xC9, 0x87, 0x9E, 0xDE, 0x8B, 0x58, 0xA3, 0xAF, 0xF0, 0x8F, 0xD7,
+    0x7B, 0x05, 0x52, 0x64, 0x00, 0x27, 0x67, 0x8E, 0x94, 0x99, 0x67, 0x63, 0x60, 0xED, 0x6C, 0xC2,
+    0x41, 0x00, 0x8D, 0xB1, 0x47, 0x7B, 0xE5, 0x61, 0x26, 0x39, 0xEA, 0x3B, 0x11, 0x94, 0xF6, 0xF2,
+    0x08, 0x2E, 0x2E, 0x0B, 0xB8, 0xCF, 0x8B, 0x50, 0x73, 0xD0, 0x1C, 0x40, 0x28, 0x8F, 0xD8, 0xD7,
+    0x9F, 0x2D, 0x06, 0x00, 0xD7, 0x6C, 0x6B, 0x6E, 0x68, 0x0B, 0x9F, 0x7E, 0x00, 0x95, 0xC9, 0x53,
+    0x8A, 0xB9, 0x02, 0xBC, 0x9C, 0xE9, 0x7F, 0xA3, 0x53, 0x36, 0xA4, 0x21, 0x6D, 0x92, 0x0B, 0xCD,
+    0x4B, 0xA0, 0x23, 0x12, 0xF8, 0x84, 0x4A, 0xA4, 0xDC, 0x83, 0x57, 0x64, 0x0E, 0x8C, 0x74, 0x42,
+    0xAA, 0xA7, 0x17, 0x8D, 0xFF, 0x26, 0x09, 0x3F, 0xDC, 0xA5, 0xDA, 0x26, 0x0F, 0x10, 0x53, 0x11,
+    0x23, 0x5B, 0xC6, 0x9D, 0xFE, 0x0D, 0xBF, 0xA2, 0x1D, 0x33, 0x9B, 0x34, 0x30, 0x85, 0x7D, 0x24,
+    0xA2, 0x6A, 0x36, 0x89, 0xE8, 0x4A, 0xF8, 0x23, 0x6D, 0x84, 0xAF, 0x4F, 0xD3, 0x16, 0x0A, 0xA2,
+    0x2B, 0x0D, 0x26, 0xE9, 0x2F, 0x5F, 0x05, 0xD3, 0x16, 0x47, 0x3A, 0x3A, 0xFB, 0x28, 0x05, 0x2E,
+    0x85, 0xB4, 0x25, 0xF9, 0xA0, 0xA7, 0x29, 0xF9, 0xE7, 0x1B, 0xCD, 0x37, 0x34, 0xAD, 0xF6, 0x2B,
+    0x0D, 0x88, 0x74, 0x0A, 0x00, 0xFF, 0xDA, 0x53, 0xCC, 0x5C, 0xE6, 0x69, 0x58, 0xA9, 0xCF, 0x47,
+    0xCD, 0xA0, 0xB8, 0x42, 0xEE, 0x45, 0x10, 0x1E, 0x89, 0xC7, 0xF8, 0x5E, 0xF6, 0xA3, 0x11, 0x61,
+    0x20, 0x03, 0x19, 0x47, 0x81, 0xF0, 0xE2, 0xF6, 0x00, 0xEA, 0xD3, 0x0C, 0x22, 0x27, 0xC7, 0xFC,
+    0x19, 0xE3, 0x9C, 0x8C, 0xCB, 0x50, 0x57, 0xFE, 0x71, 0x1B, 0x06, 0x29, 0x57, 0xF6, 0xD9, 0xD2,
+    0x58, 0x83, 0x7A, 0x1D, 0x18, 0x6A, 0xE8, 0x2C, 0xFC, 0x33, 0xB0, 0xEC, 0x14, 0x60, 0xEA, 0xAA,
+    0x7C, 0xB2, 0x78, 0xF8, 0xF8, 0xF1, 0xB0, 0x99, 0x25, 0x81, 0xEA, 0x4A, 0xD9, 0xA2, 0x87, 0x43,
+    0x8D, 0xD6, 0x20, 0x46, 0xA3, 0x92, 0x56, 0x38, 0x70, 0xA8, 0x1B, 0xD5, 0x15, 0x03, 0x8A, 0xC7,
+    0xE0, 0x88, 0xA6, 0xE7, 0xCC, 0xE7, 0x4F, 0xC3, 0xD7, 0x7B, 0xCB, 0x0F, 0xCF, 0xEC, 0x16, 0x76,
+    0x7D, 0x4D, 0x96, 0x57, 0x27, 0x3B, 0x99, 0xF2, 0x11, 0x07, 0x5D, 0x72, 0x98, 0xDE, 0xFE, 0xF2,
+    0x64, 0x4A, 0xD6, 0xD5, 0x5A, 0x70, 0xAA, 0x27, 0xA4, 0x7A, 0x2E, 0x48, 0xCB, 0xA5, 0x60, 0x57,
+    0xC8, 0xF6, 0x2D, 0xCD, 0x0E, 0x55, 0xBA, 0xBD, 0xB5, 0xE1, 0xEA, 0x06, 0xD1, 0xCE, 0x71, 0x99,
+    0xAF, 0x65, 0x7F, 0x2C, 0x7B, 0x04, 0xEE, 0x20, 0xA8, 0x03, 0x2F, 0xDB, 0xA5, 0x04, 0x69, 0x83,
+    0x3C, 0x88, 0xEA, 0x87, 0x58, 0xFE, 0xC6, 0xBA, 0x68, 0xCD, 0xC2, 0x67, 0x55, 0x79, 0x73, 0xD0,
+    0x0B, 0x9F, 0x8A, 0x34, 0xBB, 0xA5, 0x2E, 0xB9, 0x24, 0x97, 0x5D, 0x09, 0xC1, 0xFC, 0x3D, 0x37,
+    0x9D, 0xB4, 0x7C, 0x18, 0xCF, 0xD8, 0x0B, 0xF2, 0xDB, 0x27, 0x81, 0xC7, 0x9C, 0x54, 0x87, 0xBF,
+    0x87, 0x5A, 0x2E, 0x7A, 0xAF, 0xE5, 0xC2, 0x05, 0x7D, 0xF5, 0xF0, 0x59, 0xAC, 0xEF, 0xFC, 0xE9,
+    0x6F, 0xEC, 0xA4, 0x31, 0x9F, 0xCF, 0xF7, 0x23, 0xA7, 0xC2, 0xFF, 0xB4, 0x27, 0xF9, 0xC8, 0xA3,
+    0xC8, 0x0C, 0x02, 0x5C, 0xA2, 0x58, 0xDE, 0xED, 0xA9, 0xFC, 0xCE, 0xD3, 0xA4, 0x37, 0x94, 0x7B,
+    0x4C, 0xF0, 0xA4, 0x27, 0xFD, 0x8D, 0x47, 0x02, 0x18, 0x12, 0x03, 0x26, 0x62, 0x9A, 0xB8, 0xE9,
+    0x49, 0x59, 0xAE, 0x0A, 0xA7, 0x6D, 0xE6, 0xA5, 0x23, 0x34, 0x6B, 0xC2, 0xBB, 0x6B, 0xA8, 0xF2,
+    0x12, 0x45, 0x2C, 0xD1, 0x98, 0x51, 0xCD, 0xE0, 0x86, 0x73, 0x7F, 0x2B, 0x2E, 0x03, 0xF1, 0x46,
+    0x55, 0x22, 0xEC, 0x0B, 0x2F, 0x1C, 0xD3, 0x56, 0xAA, 0xEC, 0xE5, 0x78, 0x95, 0xBC, 0xAA, 0x74,
+    0x61, 0xE5, 0x3D, 0x27, 0xFA, 0x9D, 0xF4, 0x63, 0x3A, 0xB1, 0xF2, 0x63, 0x27, 0xBA, 0x39, 0x0D,
+    0x65, 0x73, 0x51, 0x76, 0xEA, 0x8A, 0x2F, 0x2C, 0x8A, 0x8D, 0xA4, 0x4F, 0x1D, 0x26, 0x5B, 0x36,
+    0x7C, 0x81, 0xAE, 0x89, 0x6D, 0x15, 0xC0, 0x3F, 0xED, 0x73, 0x27, 0xDB, 0x13, 0xE7, 0x57, 0xE0,
+    0x9F, 0x0F, 0x75, 0x0F, 0xB4, 0xA9, 0x8C, 0xE4, 0xEA, 0xD1, 0x8D, 0x21, 0xC7, 0x23, 0xFD, 0x3B,
+    0x2A, 0x0B, 0x8E, 0x23, 0xF0, 0xF4, 0x40, 0x38, 0x84, 0xCF, 0xD1, 0x61, 0x70, 0x88, 0x09, 0x7C,
+    0xCD, 0xB6, 0x60, 0x77, 0xE4, 0xF2, 0x62, 0xDA, 0x2E, 0x47, 0xF7, 0xFD, 0xA9, 0xD7, 0x74, 0x77,
+    0xA3, 0x33, 0x23, 0xDF, 0xD6, 0x32, 0x3B, 0x7E, 0xD0, 0x28, 0xE1, 0xBB, 0xA3, 0x78, 0x42, 0x96,
+    0x03, 0xA9, 0x1A, 0xA8, 0x7C, 0x71, 0x1F, 0x7C, 0x29, 0xE3, 0x2F, 0xBD, 0x55, 0xBD, 0x6E, 0xDD,
+    0x36, 0x14, 0xFE, 0x24, 0xA1, 0x16, 0x50, 0x0D, 0xCC, 0x50, 0x2F, 0xED, 0xA0, 0x3D, 0x8B, 0x9E,
+    0xA0, 0x97, 0x6A, 0xFB, 0x02, 0x1E, 0x9A, 0xBC, 0x86, 0x5F, 0xA0, 0xF7, 0x52, 0x48, 0x87, 0x0C,
+    0x5E, 0xF2, 0x06, 0xF5, 0xDC, 0xA5, 0x6B, 0x06, 0xFB, 0x4A, 0xA8, 0x07, 0x0F, 0x1E, 0x2C, 0xD7,
+    0x63, 0x87, 0x0A, 0xC9, 0xD0, 0x21, 0x43, 0x08, 0x54, 0x6D, 0x19, 0x98, 0xD2, 0xE9, 0x47, 0xCA,
+    0xF1, 0x1F, 0x50, 0x14, 0x01, 0x82, 0x12, 0xF7, 0xF0, 0x52, 0x22, 0x79, 0xCE, 0x77, 0xFE, 0x3E,
+    0x01, 0x1C, 0x7A, 0xA0, 0xF4, 0x94, 0x0E, 0x30, 0x94, 0xB6, 0x01, 0xA4, 0x46, 0x22, 0xB8, 0x37,
+    0xD4, 0x60, 0x3A, 0x35, 0x48, 0xAD, 0x2E, 0x04, 0xEA, 0xD2, 0x43, 0x9D, 0x39, 0x94, 0xBF, 0x59,
+    0x94, 0x6F, 0x7B, 0x54, 0xD2, 0x51, 0x80, 0x6A, 0xA6, 0x9A, 0x89, 0xC2, 0xFB, 0x5A, 0x7A, 0x8A,
+    0x83, 0xF9, 0x61, 0x86, 0x39, 0x90, 0xC6, 0x7C, 0x2F, 0xB6, 0x6D, 0xC4, 0x57, 0x35, 0x8A, 0x1E,
+    0x99, 0x05, 0x3C, 0x0F, 0x52, 0x6F, 0xB7, 0x3C, 0x6C, 0xB1, 0x6A, 0x51, 0x0A, 0x72, 0xA9, 0x13,
+    0x69, 0x60, 0x46, 0x6A, 0x6C, 0x0A, 0x71, 0xE9, 0x3B, 0x69, 0xDA, 0xCA, 0xEB, 0x13, 0xDA, 0xB8,
+    0x19, 0x3F, 0xD6, 0x30, 0x3D, 0x4A, 0x8B, 0xDC, 0x23, 0xA5, 0x51, 0x89, 0xD0, 0x3F, 0x7F, 0x11,
+    0xF6, 0xB2, 0x4B, 0xFB, 0xE5, 0x77, 0xD9, 0x79, 0xB3, 0xB2, 0xD9, 0xC4, 0xB7, 0xB9, 0x43, 0x3B,
+    0x14, 0xD2, 0xBC, 0x14, 0xF5, 0xDC, 0xE7, 0x34, 0x46, 0x77, 0x47, 0xE0, 0x08, 0xD8, 0x8D, 0xAA,
+    0x52, 0x07, 0x6C, 0x89, 0xA4, 0xA1, 0x87, 0xC8, 0xF8, 0x30, 0x3F, 0x7C, 0xA8, 0x51, 0xF6, 0xC8,
+    0x47, 0x24, 0xF4, 0xCC, 0x88, 0xEC, 0x8B, 0xFC, 0x2A, 0xF2, 0x97, 0xC8, 0x94, 0x75, 0x15, 0xC6,
+    0xA2, 0xDB, 0x7D, 0x8F, 0xCA, 0x67, 0x56, 0x75, 0xAB, 0xC4, 0xE5, 0x43, 0xD9, 0xAC, 0xD3, 0xB1,
+    0xE8, 0xAB, 0xFA, 0x38, 0xFC, 0xE9, 0x5A, 0x5E, 0xCB, 0xB9, 0xA0, 0x08, 0x1E, 0xD3, 0x57, 0xBA,
+    0x47, 0x68, 0x50, 0x36, 0x06, 0x3B, 0x2C, 0x3F, 0xD9, 0xBB, 0xF5, 0xAD, 0x6A, 0x22, 0xA0, 0x60,
+    0x5D, 0x0D, 0x11, 0x4B, 0x40, 0xF1, 0xF0, 0x91, 0x2E, 0x10, 0x15, 0x4C, 0x1D, 0x61, 0xE5, 0x22,
+    0x63, 0x25, 0xD2, 0xB7, 0x22, 0x5F, 0x07, 0x60, 0x96, 0xC1, 0xD5, 0x50, 0x4D, 0x3E, 0x24, 0x0E,
+    0x1B, 0x94, 0x75, 0xD1, 0xA7, 0x23, 0x8E, 0x51, 0x2D, 0x8B, 0x09, 0xDA, 0x29, 0xC9, 0xEE, 0x44,
+    0x54, 0x3A, 0x6D, 0xD5, 0x98, 0x79, 0x66, 0xBD, 0x6D, 0x58, 0x0D, 0x04, 0x51, 0x5C, 0x47, 0x20,
+    0x39, 0xD4, 0xCD, 0x91, 0x1A, 0x74, 0xE6, 0x54, 0x37, 0x67, 0x56, 0x37, 0x3E, 0xC4, 0xE6, 0x3A,
+    0x1C, 0x4B, 0x6C, 0x96, 0x70, 0xB4, 0x31, 0x36, 0x7D, 0x48, 0xEF, 0x11, 0xD4, 0x89, 0xF5, 0x9A,
+    0xD3, 0xB7, 0x2B, 0xE4, 0x03, 0x21, 0x70, 0x5A, 0x87, 0x9D, 0xE3, 0x3B, 0x93, 0xEA, 0x21, 0x83,
+    0x12, 0x88, 0xBD, 0xB1, 0xB7, 0xD3, 0xCC, 0x99, 0xD3, 0xCD, 0xCC, 0x6A, 0x3B, 0x71, 0xA5, 0xBD,
+    0xCD, 0xC5, 0xBF, 0xDB, 0xD3, 0xA1, 0x7E, 0x74, 0xC8, 0xEB, 0xA6, 0x3C, 0x7D, 0xE5, 0x37, 0xFA,
+    0xF4, 0xD2, 0x1F, 0x3F, 0x3E, 0xB8, 0x6B, 0x6A, 0x82, 0x9A, 0x69, 0x45, 0x5D, 0x97, 0xF4, 0xA3,
+    0x30, 0x95, 0xD1, 0x79, 0x1F, 0x26, 0x5A, 0x46, 0xAC, 0xC5, 0xA5, 0x1A, 0x96, 0xBD, 0xD4, 0x4D,
+    0x61, 0xEB, 0x8D, 0x0D, 0x5B, 0xF1, 0xA2, 0x84, 0xBD, 0x25, 0x68, 0x6A, 0x8A, 0x37, 0x6C, 0x7C,
+    0x5D, 0x63, 0x49, 0x0F, 0xEF, 0x0D, 0x37, 0x2F, 0x8A, 0x78, 0x82, 0x55, 0x1C, 0xAE, 0xF4, 0x61,
+    0x4F, 0x84, 0x1B, 0x9C, 0x26, 0x14, 0x57, 0x4C, 0x17, 0xCC, 0x4F, 0x04, 0x9F, 0x45, 0x00, 0x55,
+    0x1F, 0xEF, 0xC5, 0x36, 0x8B, 0x3A, 0x4D, 0xD4, 0xD9, 0xDF, 0xED, 0x3F, 0x1E, 0x0C, 0x7D, 0xC2,
+    0x76, 0xC1, 0x0A, 0x60, 0x5A, 0x43, 0x48, 0x51, 0xB2, 0x1C, 0x36, 0x04, 0x7B, 0x35, 0xA2, 0x08,
+    0x4D, 0xC0, 0xA6, 0x98, 0x18, 0x9F, 0x31, 0x11, 0x06, 0xE0, 0x11, 0x4B, 0x97, 0x11, 0x8E, 0x98,
+    0xA3, 0xEF, 0x2F, 0x11, 0x6B, 0x3F, 0xA5, 0x9E, 0xD0, 0x06, 0x49, 0x7D, 0xCF, 0x00, 0xDB, 0xC9,
+    0x97, 0x63, 0xE2, 0x4B, 0x97, 0xF8, 0xCA, 0x53, 0xE6, 0xD4, 0x57, 0x92, 0x7A, 0x2D, 0xCF, 0xBC,
+    0x7E, 0xFB, 0xB3, 0xD7, 0xE7, 0xAF, 0x9D, 0x3E, 0xFB, 0xC3, 0xE9, 0xCB, 0xBF, 0x9D, 0xFE, 0x45,
+    0x9C, 0xB9, 0x90, 0xD1, 0xF4, 0x41, 0xCC, 0xD8, 0xF6, 0x7A, 0x6C, 0x87, 0x6A, 0x04, 0x3B, 0x4C,
+    0x35, 0x2C, 0xB8, 0x10, 0xCE, 0xCF, 0x6E, 0x95, 0xAF, 0x4C, 0xA3, 0x65, 0xD4, 0x57, 0x5E, 0xD7,
+    0x47, 0x06, 0xEB, 0x0D, 0xD6, 0x06, 0x5B, 0xFE, 0x5A, 0xCC, 0x2D, 0x84, 0x3F, 0x89, 0xEE, 0x7F,
+    0x1C, 0x0C, 0x31, 0xA4, 0xA1, 0x41, 0xEC, 0x22, 0xD5, 0x35, 0xC3, 0xBD, 0x67, 0xB7, 0x0F, 0x82,
+    0xC4, 0xD6, 0x08, 0x19, 0x95, 0x40, 0x88, 0xA4, 0x1A, 0x76, 0x2B, 0x39, 0x27, 0x39, 0x4C, 0x0F,
+    0xB1, 0x2D, 0x17, 0xD6, 0x2B, 0xAE, 0x53, 0x83, 0x3D, 0x3C, 0x18, 0x1F, 0xC5, 0x9D, 0x4F, 0xEB,
+    0xC7, 0x89, 0x33, 0x81, 0x1A, 0x03, 0x25, 0x93, 0x3E, 0xEF, 0xA7, 0x0D, 0xD9, 0xEF, 0x0E, 0xA1,
+    0x0D, 0xAE, 0xBC, 0xEA, 0xAB, 0xDC, 0xE6, 0x17, 0x2E, 0x19, 0x4D, 0x00, 0x57, 0x1D, 0x58, 0xF5,
+    0xCA, 0x67, 0x9E, 0xAE, 0xE8, 0x8E, 0xEC, 0x9E, 0xDB, 0x50, 0xD8, 0xA6, 0x4E, 0x66, 0xE4, 0xEE,
+    0x9E, 0x8A, 0xFF, 0x37, 0x3B, 0xD4, 0x92, 0xB1, 0xE5, 0x73, 0x56, 0x26, 0x79, 0xF9, 0x83, 0x20,
+    0x48, 0xA8, 0xE3, 0x6A, 0x42, 0x15, 0xF1, 0x27, 0x4F, 0xC9, 0x0D, 0xEC, 0xA7, 0x54, 0xA8, 0x6E,
+    0xF7, 0xC9, 0xC3, 0xE8, 0x27, 0x2D, 0xF3, 0x2E, 0xB4, 0x42, 0xD2, 0xEE, 0x94, 0xCB, 0xE7, 0x94,
+    0x3C, 0x30, 0x32, 0x10, 0xE6, 0xF9, 0x88, 0x10, 0x16, 0x54, 0x67, 0x16, 0x49, 0x58, 0x94, 0x5C,
+    0xA4, 0x9E, 0xB5, 0xA1, 0x4F, 0x65, 0x6F, 0x9F, 0xFE, 0x88, 0x3C, 0xA3, 0x8C, 0x8A, 0x13, 0xBB,
+    0x9F, 0x25, 0xB0, 0x2F, 0x2F, 0x16, 0xA5, 0x4F, 0x0F, 0xF9, 0x55, 0x33, 0xE2, 0x9F, 0xDC, 0xC9,
+    0x76, 0xB2, 0xAD, 0x95, 0x58, 0xFD, 0x86, 0x69, 0x9A, 0x8E, 0xB1, 0x9D, 0xB0, 0xE1, 0xDC, 0x7E,
+    0x35, 0xF1, 0x58, 0x25, 0x64, 0x5A, 0xCB, 0x03, 0xCB, 0x47, 0xB4, 0x5B, 0xB3, 0x04, 0xA9, 0x2E,
+    0x0B, 0x64, 0x52, 0x4E, 0x0F, 0x21, 0x7F, 0x41, 0xC2, 0x53, 0x32, 0x07, 0x86, 0xF3, 0xFC, 0x4C,
+    0x98, 0x81, 0xCC, 0x20, 0xDF, 0x78, 0xE6, 0x8B, 0x8C, 0xA0, 0x17, 0x90, 0x0B, 0xDA, 0x64, 0xC1,
+    0xEF, 0xE8, 0x88, 0xF9, 0x73, 0x47, 0x4E, 0x08, 0xD4, 0x55, 0x81, 0x62, 0x28, 0x36, 0x0B, 0xD7,
+    0x77, 0xE4, 0x1D, 0xFE, 0x63, 0xFC, 0x03, 0xB5, 0x55, 0xA1, 0x72, 0xDD, 0x46, 0x14, 0x3D, 0xD2,
+    0xA6, 0x4F, 0x33, 0x59, 0x20, 0x5E, 0xCF, 0x54, 0x1F, 0xD0, 0xC9, 0xE8, 0x0B, 0x92, 0x55, 0x50,
+    0x41, 0x89, 0x41, 0x8D, 0xCD, 0x5B, 0x10, 0x5A, 0xD0, 0x58, 0x62, 0x81, 0x7D, 0xA4, 0xA8, 0xA4,
+    0x20, 0xA0, 0x71, 0x41, 0x68, 0x3A, 0x53, 0x5B, 0xDB, 0x50, 0x93, 0x57, 0x54, 0x2A, 0x10, 0x66,
+    0xB2, 0x40, 0x9E, 0x2A, 0x6F, 0x76, 0xF7, 0xF6, 0xAC, 0x64, 0x8D, 0x5D, 0xD2, 0x26, 0xA9, 0xA3,
+    0x59, 0xED, 0x7D, 0x4F, 0xDA, 0xBD, 0xF7, 0xDC, 0x73, 0xCF, 0x5E, 0x01, 0xA8, 0x1F, 0x4F, 0xB5,
+    0x8C, 0xA5, 0x0C, 0xB9, 0x34, 0x58, 0xAF, 0xEC, 0xBC, 0x29, 0xC5, 0x99, 0xCB, 0xA9, 0x45, 0x38,
+    0xC3, 0x79, 0xC0, 0x09, 0xE7, 0xFE, 0x71, 0x68, 0xC5, 0xD7, 0x32, 0xF1, 0x15, 0x17, 0xA0, 0xB2,
+    0x6A, 0xCC, 0x3D, 0xDA, 0xC6, 0x58, 0xED, 0xF2, 0xE7, 0x78, 0x81, 0x9B, 0x2B, 0xEB, 0x07, 0xC0,
+    0xC8, 0x84, 0x42, 0xC4, 0xC3, 0x0C, 0xD5, 0x94, 0x07, 0x94, 0x63, 0xE9, 0x50, 0x0D, 0x6D, 0x03,
+    0xF3, 0xDA, 0x03, 0xBD, 0x76, 0xC8, 0x7C, 0x6D, 0x51, 0xB8, 0x9E, 0x38, 0x5E, 0x47, 0x40, 0x0A,
+    0x39, 0x7C, 0xE2, 0x4B, 0x11, 0x19, 0x6A, 0x4E, 0x8D, 0x99, 0x77, 0x8B, 0x58, 0x1C, 0xC8, 0x9B,
+    0x6B, 0xD7, 0x2D, 0xCA, 0x5D, 0x6D, 0x0B, 0xFA, 0xCA, 0x03, 0xA3, 0x9E, 0xDE, 0xA0, 0xC6, 0x01,
+    0xD7, 0x10, 0x1C, 0x54, 0xEC, 0x3B, 0xAE, 0x0B, 0xD0, 0x3B, 0x3D, 0xD0, 0x9C, 0x2C, 0x3F, 0x98,
+    0x40, 0xC2, 0x63, 0xC1, 0x1C, 0x18, 0x4B, 0xE6, 0x3C, 0xD7, 0xBD, 0x1B, 0xF9, 0x85, 0xAF, 0x52,
+    0x68, 0x19, 0xAA, 0x34, 0x8F, 0xE5, 0xA4, 0xB8, 0x44, 0x8F, 0x30, 0x3B, 0x28, 0x0F, 0xED, 0x91,
+    0x05, 0xE4, 0x7C, 0x44, 0xB4, 0xBD, 0x10, 0x03, 0xFD, 0x8C, 0xCC, 0x41, 0x4B, 0x20, 0x0D, 0x89,
+    0x3E, 0x46, 0xA5, 0xF7, 0x2A, 0xA0, 0x25, 0x06, 0xBA, 0x88, 0xA7, 0xDB, 0x3E, 0xB9, 0x9A, 0x66,
+    0xB7, 0x82, 0x79, 0xB6, 0x9B, 0xD9, 0xFB, 0xCA, 0x53, 0xF3, 0xA4, 0x53, 0x12, 0x24, 0x10, 0x73,
+    0xD0, 0xBF, 0x7B, 0x15, 0x8F, 0xA6, 0x33, 0xBA, 0x17, 0xD3, 0x10, 0xC5, 0xC5, 0x8E, 0xE1, 0xF3,
+    0x50, 0x04, 0xA6, 0x2D, 0xB2, 0x7F, 0xA9, 0x67, 0x07, 0x12, 0x5B, 0x71, 0x9B, 0xB7, 0x79, 0xBF,
+    0xC5, 0x27, 0x74, 0xE1, 0x80, 0x47, 0x40, 0xB1, 0x03, 0xFC, 0x9A, 0x4C, 0xCE, 0x04, 0x99, 0x64,
+    0x7E, 0x75, 0x6C, 0x6B, 0x3C, 0x52, 0x4E, 0x39, 0x03, 0x33, 0x9B, 0xA3, 0x48, 0x60, 0xD6, 0xC8,
+    0x38, 0x9B, 0x3F, 0x62, 0xE1, 0xB5, 0x6B, 0x6D, 0xFF, 0x85, 0xD7, 0x13, 0xCD, 0x85, 0xD7, 0x81,
+    0x66, 0xC0, 0x21, 0x5E, 0xE1, 0x21, 0x6A, 0x94, 0x1D, 0x9D, 0xED, 0xC7, 0x3E, 0x1A, 0xF9, 0x7E,
+    0x54, 0x13, 0xB9, 0x34, 0x4D, 0xB9, 0x53, 0x63, 0x16, 0xD1, 0xDB, 0xDA, 0xCD, 0xC1, 0x68, 0x12,
+    0x2B, 0xF5, 0x00, 0x45, 0x9C, 0xC6, 0x42, 0x27, 0x76, 0x6F, 0x95, 0xE5, 0xFF, 0xC3, 0xA1, 0x3F,
+    0x5B, 0x4E, 0x74, 0xCA, 0xA2, 0x47, 0xD6, 0x43, 0x5D, 0x67, 0xAA, 0x2F, 0x77, 0x7D, 0xA4, 0x76,
+    0xF9, 0x22, 0xD5, 0xB9, 0xDC, 0xCD, 0x13, 0xC1, 0xD5, 0x8E, 0x90, 0x0C, 0x7E, 0x43, 0x68, 0x59,
+    0x09, 0x0B, 0x0A, 0x8F, 0xF9, 0xDC, 0xBA, 0x6A, 0xE9, 0x72, 0x91, 0xAE, 0x3E, 0xF2, 0xB9, 0x53,
+    0xC3, 0x0A, 0x87, 0xE6, 0xEA, 0x78, 0x30, 0xE2, 0xD5, 0x2C, 0x3E, 0xAF, 0x02, 0xE5, 0x6A, 0x7B,
+    0xA2, 0x1A, 0x69, 0x9E, 0x79, 0xED, 0x7B, 0xDB, 0xFF, 0xE9, 0x75, 0x3C, 0xC1, 0x54, 0x5D, 0x0C,
+    0x85, 0x74, 0x8C, 0x85, 0xEF, 0xD6, 0x34, 0xF7, 0x23, 0x33, 0x55, 0x1C, 0x01, 0xE4, 0x4A, 0x8D,
+    0x37, 0xA3, 0x98, 0x92, 0x7E, 0x74, 0x82, 0x7D, 0xB8, 0x94, 0x4C, 0x0D, 0x4B, 0xCD, 0x4A, 0x7B,
+    0x03, 0xEA, 0xF3, 0xD8, 0x65, 0xE4, 0x21, 0x05, 0xD7, 0xD3, 0x06, 0xCC, 0x69, 0xB9, 0x29, 0x16,
+    0x2D, 0xDB, 0x24, 0xA9, 0x86, 0x1A, 0x4A, 0x8A, 0xA3, 0xA3, 0x8A, 0x91, 0xF3, 0x58, 0x6C, 0x73,
+    0x29, 0xE3, 0x8F, 0x31, 0x9D, 0x14, 0x4A, 0xC4, 0x6D, 0x64, 0x7F, 0xAD, 0x2C, 0xEE, 0x6B, 0x58,
+    0xC1, 0xA4, 0x8D, 0xB3, 0xA5, 0x08, 0x03, 0xCF, 0x46, 0xD9, 0x1C, 0xF2, 0xB1, 0x7E, 0xCB, 0xBF,
+    0x0E, 0x07, 0x74, 0x13, 0xCB, 0x1F, 0xB8, 0x39, 0xF4, 0x32, 0xDD, 0x97, 0x2E, 0xAD, 0x53, 0x76,
+    0x89, 0x6A, 0x58, 0xC5, 0x78, 0x0E, 0xE5, 0xAA, 0xEE, 0x36, 0x71, 0x77, 0x0A, 0xF2, 0x61, 0x3A,
+    0x4C, 0xB9, 0x58, 0x7D, 0xE9, 0xEA, 0xC6, 0xAF, 0x62, 0x79, 0x37, 0x9C, 0x77, 0x80, 0x43, 0x27,
+    0x1C, 0xBF, 0x62, 0x51, 0xEB, 0x97, 0xDD, 0x62, 0xC3, 0x7F, 0xA1, 0xA8, 0x67, 0x14, 0x14, 0x90,
+    0xEA, 0x50, 0x0C, 0xB8, 0x3F, 0x25, 0xC1, 0xA7, 0xD0, 0xA9, 0xA8, 0xDA, 0x22, 0x18, 0x36, 0x38,
+    0xAE, 0x4D, 0x9A, 0x53, 0xAC, 0x70, 0xD6, 0x7C, 0x1C, 0xF2, 0xB8, 0xA0, 0xF3, 0xC5, 0x5F, 0x2E,
+    0xA3, 0xBE, 0x5B, 0xE0, 0x01, 0xDE, 0x8B, 0xBF, 0xAF, 0x4F, 0x4F, 0x5F, 0xB0, 0xCD, 0xC4, 0xF5,
+    0x9E, 0xE1, 0x7E, 0xC8, 0x4D, 0x16, 0x50, 0x6C, 0x97, 0x1C, 0xEE, 0xBD, 0x5A, 0xEC, 0xC2, 0x46,
+    0x36, 0xA0, 0x6E, 0x28, 0xBE, 0x7C, 0x64, 0x4E, 0xCF, 0x44, 0x3E, 0x8D, 0x3F, 0xF3, 0x28, 0x50,
+    0xF0, 0x26, 0xB5, 0x2A, 0xE5, 0xD2, 0x79, 0x35, 0x11, 0xE9, 0xB4, 0xB9, 0x92, 0x82, 0xEB, 0xF0,
+    0x32, 0x35, 0xDA, 0x6A, 0x97, 0x78, 0xEC, 0x32, 0xCF, 0xA4, 0xDA, 0x6B, 0x1E, 0x8B, 0x7F, 0xF2,
+    0x78, 0x67, 0xE0, 0x91, 0x13, 0xFD, 0x53, 0x92, 0x3F, 0x77, 0xCF, 0x6F, 0x4B, 0x4B, 0x19, 0x12,
+    0x6E, 0xC2, 0x6D, 0x84, 0xE7, 0x5B, 0xF0, 0xCD, 0xFE, 0x27, 0xF6, 0xBC, 0x84, 0x36, 0xC1, 0x5E,
+    0x0D, 0x97, 0x10, 0x39, 0x71, 0xB3, 0x91, 0xBC, 0x13, 0xA2, 0xEC, 0xF8, 0xAA, 0x49, 0xDF, 0x9E,
+    0xF9, 0xFB, 0xF3, 0xAF, 0x88, 0x80, 0xCF, 0xE6, 0x13, 0x3B, 0x8F, 0x52, 0xA6, 0x4A, 0x3C, 0x89,
+    0xA3, 0x2C, 0x7B, 0xF1, 0x1C, 0x47, 0xF1, 0xAB, 0xD4, 0xE7, 0xA9, 0x52, 0x36, 0x55, 0xAA, 0xA4,
+    0xF7, 0xF8, 0xF0, 0xEB, 0x6F, 0xBD, 0x54, 0xBD, 0x6E, 0xD4, 0x40, 0x10, 0x9E, 0xF5, 0x0A, 0x56,
+    0xCA, 0x16, 0xEE, 0x28, 0x10, 0x92, 0xFB, 0x34, 0x7E, 0x01, 0x94, 0x35, 0xA2, 0xE4, 0x45, 0x80,
+    0x86, 0x27, 0x08, 0x36, 0x3C, 0xC1, 0xBD, 0x00, 0x12, 0x05, 0x0D, 0xA4, 0xA0, 0xA5, 0x48, 0x62,
+    0x4B, 0x3C, 0x00, 0x56, 0x2A, 0xBA, 0x18, 0x84, 0x44, 0xC9, 0x4A, 0xAC, 0x84, 0x11, 0x6B, 0x0F,
+    0xDF, 0xEC, 0x85, 0xCB, 0xDF, 0x15, 0x89, 0x94, 0xC3, 0xDA, 0xCF, 0xDA, 0xDB, 0xD3, 0xCE, 0x7C,
+    0xF3, 0xCD, 0x37, 0xA6, 0x9D, 0x7B, 0x44, 0xED, 0x2B, 0xA2, 0x9F, 0x13, 0x91, 0x8F, 0xB4, 0xEE,
+    0x69, 0x3B, 0x13, 0xCF, 0xA2, 0x6E, 0x2E, 0x42, 0x0B, 0xC6, 0x25, 0xCC, 0xE8, 0x3A, 0x3B, 0x3A,
+    0xE6, 0x20, 0x28, 0x99, 0x7D, 0xCE, 0xDC, 0x67, 0xCC, 0x95, 0xC4, 0xCA, 0xBE, 0xF4, 0x66, 0x1C,
+    0xEC, 0xEE, 0x90, 0x3F, 0xEB, 0xED, 0xA3, 0x66, 0x95, 0x23, 0x52, 0xDC, 0xA7, 0x69, 0xB5, 0x76,
+    0xD3, 0xAA, 0xD5, 0xE4, 0xBE, 0xCF, 0x8E, 0xE7, 0x82, 0x67, 0x33, 0xCF, 0xE9, 0xFE, 0x1E, 0x93,
+    0x61, 0x6E, 0x2C, 0xCF, 0xCD, 0xA6, 0xB9, 0xDE, 0xD9, 0xC3, 0xF1, 0x58, 0xF3, 0x39, 0x55, 0xAE,
+    0x4A, 0x54, 0x87, 0xB2, 0x42, 0x20, 0x22, 0x86, 0xB0, 0xE5, 0xB7, 0x8D, 0x12, 0xC5, 0x53, 0x3E,
+    0x18, 0x0B, 0x0E, 0x39, 0x0F, 0xD9, 0xEA, 0xE8, 0x8A, 0x5C, 0x2D, 0x74, 0x2C, 0x07, 0xA2, 0xFB,
+    0x9E, 0xC8, 0x01, 0x79, 0xB7, 0x71, 0x13, 0xD0, 0x63, 0x52, 0x4C, 0xD9, 0x31, 0x65, 0xD0, 0x67,
+    0xA2, 0x6B, 0xCB, 0xBB, 0x4D, 0x5B, 0x8B, 0xA2, 0xD7, 0xA3, 0x0D, 0x6A, 0xCE, 0x26, 0x6A, 0x9B,
+    0xF5, 0x74, 0x6D, 0xA4, 0xBA, 0x5B, 0x6D, 0x84, 0xA4, 0x19, 0xCF, 0x6F, 0xB4, 0x6C, 0x5C, 0x23,
+    0x9C, 0xE5, 0xA4, 0x11, 0xD2, 0x9A, 0xC1, 0x52, 0x58, 0x83, 0x2D, 0x93, 0xD0, 0xA6, 0x92, 0xC3,
+    0x49, 0xD8, 0x6D, 0xBA, 0xBD, 0xC8, 0x87, 0x4C, 0xAE, 0x49, 0xE6, 0xFA, 0x42, 0x66, 0xB0, 0x27,
+    0xDB, 0xE5, 0x3D, 0x81, 0xFA, 0xE9, 0xC6, 0xF4, 0xD8, 0xEC, 0xCA, 0xC6, 0x17, 0x3D, 0xA1, 0x12,
+    0x42, 0x8E, 0x81, 0x50, 0x0C, 0x51, 0xFD, 0x63, 0xB8, 0x41, 0x69, 0xE1, 0x54, 0x85, 0x16, 0x42,
+    0x5C, 0xF8, 0x0E, 0xBF, 0x6F, 0x9D, 0xD3, 0xF3, 0x20, 0x89, 0xF9, 0x1C, 0x7A, 0x66, 0x13, 0xC4,
+    0x3C, 0xD5, 0x53, 0x05, 0x70, 0x24, 0xFB, 0x99, 0x4C, 0x24, 0xB5, 0x74, 0xBB, 0xEE, 0xE5, 0x6D,
+    0x7D, 0xF2, 0x56, 0x3A, 0x3A, 0x6C, 0x65, 0xFC, 0xC2, 0x5A, 0x7B, 0x88, 0x0E, 0x59, 0xAC, 0xF1,
+    0x97, 0x8E, 0x0E, 0x6F, 0x70, 0xC4, 0x7D, 0x1B, 0xC4, 0x57, 0x79, 0x28, 0xBD, 0x1D, 0x72, 0x5F,
+    0xF8, 0x84, 0x50, 0xE2, 0x34, 0x0F, 0x2E, 0xBA, 0xDE, 0x8E, 0xED, 0xE4, 0x50, 0x2F, 0x73, 0xDD,
+    0x61, 0xA6, 0x31, 0xD5, 0x9A, 0xE7, 0x96, 0x2B, 0xCD, 0xD1, 0xC1, 0x1E, 0xE9, 0xAD, 0x38, 0x14,
+    0x90, 0x09, 0x45, 0xC2, 0x27, 0x3C, 0xE4, 0x42, 0x45, 0x48, 0xC9, 0x8C, 0x41, 0x43, 0x9A, 0x0F,
+    0x51, 0xB5, 0x19, 0x2E, 0x31, 0x2A, 0x1B, 0x32, 0xBF, 0x3C, 0xE9, 0x31, 0xAA, 0x6A, 0x72, 0x0F,
+    0x7D, 0x6D, 0xBF, 0xCE, 0xE5, 0x8B, 0xC8, 0x9F, 0x7A, 0xB7, 0x54, 0x2C, 0x42, 0xB1, 0x99, 0xEA,
+    0x3F, 0x5C, 0xE5, 0x91, 0x3B, 0x3D, 0x15, 0x9E, 0x9E, 0xA8, 0x37, 0x28, 0x03, 0xB1, 0x44, 0x03,
+    0xC5, 0x1D, 0xA9, 0x09, 0x7A, 0x8C, 0xB6, 0x5F, 0x3B, 0x10, 0x26, 0x50, 0xEE, 0xF1, 0x31, 0x0A,
+    0x70, 0x62, 0xD4, 0x51, 0x7C, 0x58, 0xC1, 0x2F, 0xBE, 0xAD, 0xA0, 0x6E, 0x47, 0x0E, 0x8D, 0xB5,
+    0xEC, 0x11, 0x67, 0xC4, 0x5C, 0x21, 0xA0, 0x99, 0x4F, 0x9A, 0x22, 0xD2, 0xE4, 0x30, 0x94, 0x9E,
+    0x24, 0x0B, 0x0E, 0xEA, 0x93, 0x04, 0x1F, 0x88, 0xE0, 0x0F, 0xC3, 0x55, 0xF6, 0x7B, 0xA2, 0x03,
+    0x15, 0x2E, 0xA5, 0x44, 0x3B, 0xA2, 0xAB, 0xCA, 0x97, 0x51, 0x87, 0xBC, 0x77, 0xD4, 0x9A, 0x41,
+    0x8F, 0x13, 0x95, 0xC7, 0x1D, 0x21, 0x89, 0x45, 0x28, 0xCC, 0xAF, 0xE6, 0x14, 0x45, 0x4A, 0x70,
+    0x9D, 0x7A, 0x3F, 0xC2, 0xBC, 0x90, 0xB2, 0x4F, 0x23, 0xAE, 0x22, 0x64, 0x69, 0xF3, 0x81, 0xCA,
+    0x8F, 0x11, 0x14, 0xF0, 0xC7, 0xDB, 0xED, 0xE6, 0x7F, 0x14, 0x27, 0xA5, 0xEC, 0x03, 0x3B, 0x40,
+    0x21, 0xBE, 0x5C, 0x7E, 0x06, 0x14, 0x7A, 0xEE, 0xD1, 0x8F, 0x28, 0xDD, 0x27, 0xA0, 0x4B, 0x54,
+    0x33, 0x34, 0x56, 0xA0, 0x52, 0x06, 0x41, 0x48, 0x99, 0x96, 0x40, 0x36, 0x9E, 0xDF, 0x2D, 0x5A,
+    0x5C, 0x83, 0xF9, 0xD9, 0x02, 0x47, 0x00, 0x3A, 0x55, 0xA5, 0xE6, 0x85, 0x94, 0x6A, 0xE7, 0x4C,
+    0x31, 0xE8, 0x36, 0x06, 0xAE, 0x7B, 0xDA, 0x62, 0xE6, 0xB0, 0xBC, 0xAC, 0xF2, 0xDF, 0x2A, 0x52,
+    0x88, 0x23, 0x09, 0x60, 0xBC, 0xB8, 0x58, 0x3E, 0x1E, 0xB4, 0x2C, 0x64, 0xEB, 0xF5, 0x06, 0x68,
+    0xDE, 0x05, 0xA1, 0x1E, 0xC6, 0x24, 0x35, 0xCB, 0x67, 0xEA, 0xFA, 0x34, 0x6F, 0xF4, 0xF9, 0x0B,
+    0xAD, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0x47, 0xBC, 0x8E, 0x57, 0xCA, 0xA4, 0x00,
+    0x29, 0xB2, 0x84, 0x86, 0x12, 0x05, 0xC7, 0x4B, 0x41, 0x01, 0x52, 0xE2, 0x59, 0xE4, 0x22, 0x45,
+    0x8A, 0xB8, 0xC8, 0xA5, 0xB5, 0x0B, 0x1A, 0x2C, 0x21, 0x53, 0xA6, 0xC0, 0xB7, 0x0B, 0x41, 0xA4,
+    0xA0, 0x88, 0x1B, 0x2A, 0x04, 0x09, 0x52, 0x90, 0x62, 0x23, 0x64, 0x8A, 0x48, 0x20, 0x74, 0xF1,
+    0x2E, 0xB8, 0xA0, 0x70, 0x91, 0x55, 0x22, 0x94, 0x22, 0x12, 0xD9, 0x24, 0x42, 0x41, 0x49, 0x91,
+    0x71, 0xB4, 0x49, 0xD6, 0x64, 0x76, 0x1E, 0xDF, 0xEC, 0xF9, 0xEC, 0x18, 0x5A, 0xEE, 0x66, 0xBE,
+    0x9B, 0xDB, 0x99, 0xF7, 0xE6, 0xFD, 0x7C, 0xEF, 0xAD, 0xBF, 0xE4, 0xA7, 0x94, 0x84, 0x25, 0x05,
+    0x5C, 0x12, 0x29, 0xCC, 0x40, 0x13, 0xD1, 0x1C, 0xED, 0x7C, 0x24, 0x33, 0x77, 0x30, 0xF3, 0x84,
+    0x59, 0x0B, 0x66, 0x43, 0x14, 0x35, 0x98, 0x76, 0x30, 0x25, 0x0F, 0x67, 0x8C, 0x99, 0x6E, 0xCF,
+    0x9C, 0x04, 0x3F, 0x58, 0x0E, 0x21, 0xF6, 0x2B, 0xA6, 0xCE, 0x98, 0x9B, 0xC8, 0xE9, 0x90, 0x69,
+    0xCF, 0x33, 0x6B, 0x24, 0x2D, 0x79, 0x4E, 0x9E, 0xF6, 0x7C, 0x70, 0x4B, 0x8E, 0xC3, 0xE3, 0xAB,
+    0x35, 0x05, 0x18, 0xC6, 0x8D, 0x70, 0x38, 0x82, 0x56, 0x55, 0x05, 0x4D, 0x14, 0x6C, 0x49, 0xAB,
+    0xAC, 0x4A, 0x15, 0xB9, 0xEF, 0x14, 0x25, 0x7B, 0xBF, 0x71, 0x16, 0xAB, 0xB8, 0x53, 0x93, 0x4A,
+    0xBD, 0xCB, 0x41, 0x5E, 0xCB, 0x69, 0xFD, 0x32, 0xD1, 0x47, 0x44, 0x16, 0x17, 0xA4, 0xE2, 0x56,
+    0xA9, 0xBC, 0x1A, 0x97, 0x4D, 0xBE, 0x9A, 0x7C, 0xFD, 0xE3, 0x1F, 0x9B, 0x66, 0xEE, 0x3D, 0xFC,
+    0x19, 0xCB, 0x8C, 0xE4, 0x46, 0xF1, 0x32, 0x51, 0x77, 0x06, 0x7E, 0xAE, 0xC3, 0xD6, 0x4F, 0x07,
+    0x46, 0x99, 0xF0, 0x06, 0x73, 0xC0, 0x55, 0x00, 0xFF, 0x10, 0x20, 0x79, 0xEB, 0xA9, 0x9D, 0x8F,
+    0x95, 0x58, 0xD7, 0x26, 0x91, 0x1B, 0x4F, 0x9B, 0x83, 0x22, 0xFF, 0xF0, 0xCC, 0xEB, 0x34, 0x19,
+    0x3D, 0xEA, 0xD9, 0x49, 0xEC, 0xC7, 0x61, 0x19, 0x54, 0xB8, 0x2A, 0x8B, 0x65, 0x39, 0x76, 0xC9,
+    0x5B, 0x76, 0x2A, 0x70, 0x21, 0xAE, 0xC5, 0xE5, 0x78, 0x0E, 0x43, 0x12, 0x12, 0x85, 0xD7, 0xC0,
+    0x3C, 0xD8, 0xC8, 0x34, 0x72, 0xD1, 0xBB, 0x4C, 0x3E, 0x07, 0x46, 0x68, 0x55, 0x64, 0x29, 0x77,
+    0x1A, 0x61, 0x44, 0x2D, 0x2A, 0xA1, 0xA3, 0x52, 0x15, 0x2A, 0x87, 0xB8, 0x56, 0x65, 0x54, 0x4A,
+    0x2D, 0xB4, 0xA8, 0x11, 0x11, 0x1A, 0xEB, 0xDC, 0x7E, 0xD6, 0x88, 0xE9, 0x62, 0xEE, 0x98, 0x78,
+    0xD6, 0xD4, 0x47, 0xC8, 0x2E, 0x9F, 0x64, 0x33, 0xBF, 0x9A, 0x53, 0x9F, 0x42, 0xC0, 0x81, 0x4E,
+    0x51, 0x99, 0xDE, 0x7E, 0xA2, 0x89, 0x7E, 0xD5, 0x9F, 0x20, 0xE9, 0x69, 0xBE, 0xDD, 0x74, 0x63,
+    0xC0, 0xC2, 0xBB, 0x48, 0xED, 0x68, 0xE7, 0x84, 0x79, 0xEB, 0x25, 0x67, 0xD6, 0x18, 0x9B, 0xA8,
+    0x75, 0x7A, 0x7C, 0xBA, 0x56, 0x67, 0x4D, 0x92, 0xEF, 0x7A, 0x35, 0x74, 0x87, 0xB2, 0xEB, 0xB0,
+    0x2C, 0x2A, 0x00, 0xAA, 0x1C, 0xA3, 0x32, 0x3A, 0xBB, 0xE6, 0xDD, 0x6D, 0x54, 0x4A, 0xD4, 0x8F,
+    0xCE, 0x95, 0xFD, 0xD0, 0xAA, 0xF2, 0x83, 0xE8, 0xC4, 0x8D, 0xAA, 0x51, 0x27, 0x6F, 0x54, 0x09,
+    0x5F, 0xE0, 0xFB, 0xCF, 0xB7, 0xEA, 0x5E, 0x4F, 0x22, 0x35, 0x11, 0x94, 0xA6, 0x8A, 0x53, 0xE7,
+    0x36, 0x04, 0x02, 0x38, 0x22, 0x89, 0x44, 0x49, 0xA2, 0x01, 0x37, 0x0A, 0x71, 0xA7, 0x11, 0x45,
+    0x58, 0x44, 0xC7, 0x2F, 0x6C, 0x3E, 0xE4, 0x9F, 0xEF, 0x35, 0x67, 0xA6, 0xB6, 0x29, 0xD0, 0x24,
+    0xFC, 0xE7, 0x29, 0x1A, 0x5F, 0xD5, 0xCC, 0x37, 0xD9, 0xC5, 0x7C, 0xEF, 0x91, 0x57, 0xBA, 0xA7,
+    0x99, 0x9F, 0x83, 0x28, 0x74, 0xA0, 0xA3, 0x8F, 0x46, 0x62, 0x3D, 0xA7, 0x19, 0xC4, 0xD3, 0x34,
+    0xE2, 0x1A, 0x1B, 0xE6, 0x6B, 0x8E, 0x9E, 0x94, 0xF0, 0x2C, 0xDF, 0xFC, 0xFD, 0x89, 0x3E, 0xB6,
+    0x38, 0x8B, 0x05, 0x57, 0xE1, 0xF7, 0x21, 0xAF, 0x5F, 0xBB, 0x72, 0xEF, 0xAB, 0xB7, 0xEF, 0x63,
+    0x77, 0xF4, 0xB5, 0x28, 0x3E, 0xEA, 0x57, 0x13, 0x3F, 0xBC, 0x40, 0x81, 0x2B, 0xA6, 0xD7, 0x9F,
+    0xA1, 0xA3, 0x2E, 0x80, 0x15, 0x68, 0xE9, 0xCD, 0xEC, 0x65, 0x26, 0x05, 0x77, 0xEA, 0x9E, 0xFC,
+    0xFC, 0xB1, 0x61, 0x95, 0xEF, 0xB8, 0xB9, 0x28, 0xD3, 0x91, 0xEF, 0x06, 0xBC, 0x69, 0x06, 0xA7,
+    0x44, 0x1B, 0xD1, 0xA9, 0x95, 0x6F, 0x61, 0x75, 0x70, 0xEB, 0x97, 0xA7, 0xFA, 0xAA, 0x89, 0x92,
+    0xF0, 0xF6, 0x7A, 0xC5, 0x0F, 0xDB, 0x02, 0xF2, 0xCC, 0xC8, 0x45, 0x77, 0x6E, 0xC2, 0xAB, 0x59,
+    0x70, 0xBF, 0xC7, 0x9B, 0x9B, 0x7C, 0xEE, 0xB7, 0x1A, 0xF7, 0x92, 0xA6, 0x20, 0xA5, 0x23, 0xBB,
+    0xBF, 0xE5, 0x40, 0xE3, 0x4F, 0x2E, 0x26, 0xAE, 0x20, 0x45, 0xEE, 0xFC, 0x8A, 0xFF, 0x65, 0x16,
+    0xCD, 0xC7, 0xFB, 0x66, 0x24, 0x83, 0x1C, 0x28, 0x8D, 0x64, 0xC3, 0x28, 0xB6, 0x4A, 0x47, 0xAC,
+    0x0F, 0x9F, 0xFF, 0x6C, 0x0B, 0xC4, 0x69, 0xF9, 0x8B, 0xB9, 0xED, 0x4E, 0x54, 0xBE, 0x93, 0x98,
+    0xA9, 0xAB, 0xBD, 0x5E, 0x83, 0x02, 0x06, 0x4B, 0x87, 0x4F, 0x9A, 0xA4, 0xB9, 0x2A, 0xCD, 0xF0,
+    0x54, 0x9A, 0xCA, 0xF3, 0xF9, 0x68, 0xCB, 0x10, 0x1A, 0x0D, 0xD3, 0xFC, 0x60, 0xBB, 0x72, 0x7B,
+    0xEB, 0x30, 0x4A, 0x4C, 0x57, 0x34, 0x52, 0xFB, 0xEC, 0x52, 0xB3, 0xC0, 0x4B, 0x44, 0xE3, 0x76,
+    0x89, 0x50, 0xE7, 0x0D, 0xD9, 0xD8, 0xB7, 0x02, 0xCC, 0x58, 0x3C, 0x84, 0xA3, 0x6F, 0xEE, 0x35,
+    0xF3, 0x10, 0x75, 0xBB, 0xDD, 0xD3, 0x5B, 0xE8, 0x1E, 0xEC, 0xB2, 0xD4, 0x4A, 0x83, 0x0F, 0x0E,
+    0xBC, 0x18, 0xE9, 0x73, 0xC5, 0x49, 0x02, 0x7E, 0xCE, 0xEF, 0x95, 0x53, 0x8C, 0x38, 0xF1, 0x34,
+    0xDB, 0x8F, 0xE1, 0x46, 0x02, 0x89, 0xDC, 0xB5, 0x27, 0x0F, 0xE2, 0x09, 0x17, 0x12, 0x89, 0xD5,
+    0xE4, 0x63, 0x27, 0xEB, 0x9E, 0x42, 0x77, 0x39, 0xC1, 0x7C, 0x17, 0xEA, 0x5D, 0x87, 0x00, 0x21,
+    0x3A, 0x75, 0x42, 0x36, 0x2A, 0x92, 0x8D, 0x7A, 0xFC, 0x9B, 0xE5, 0x5D, 0x8D, 0x87, 0x33, 0x3E,
+    0xD9, 0xD6, 0x77, 0xD9, 0xB8, 0x6A, 0x75, 0x77, 0x77, 0x2A, 0xA7, 0x11, 0x79, 0xD5, 0x92, 0x4D,
+    0xB0, 0x45, 0xA8, 0x4D, 0x17, 0x69, 0xF9, 0x60, 0x05, 0x1A, 0x1F, 0x0F, 0x34, 0x2E, 0x30, 0x0F,
+    0x32, 0xE2, 0xBA, 0x99, 0xEB, 0x88, 0x9F, 0xAC, 0xF0, 0xCA, 0xA5, 0xD6, 0x72, 0x72, 0xC9, 0x17,
+    0x6E, 0xD7, 0xB6, 0x14, 0xA8, 0xDD, 0xA1, 0x0A, 0x8B, 0x2C, 0x47, 0x79, 0x5B, 0x9C, 0x09, 0x4A,
+    0x9C, 0x51, 0x58, 0x20, 0x93, 0x0D, 0x65, 0x58, 0x40, 0x99, 0x15, 0x06, 0x52, 0x76, 0x60, 0xD5,
+    0x3E, 0x08, 0xB6, 0xED, 0x10, 0x14, 0xEF, 0xEF, 0x1A, 0x9B, 0x70, 0x93, 0xB9, 0x61, 0xD7, 0xE0,
+    0xE3, 0x0B, 0x83, 0xFF, 0x3B, 0x62, 0x37, 0xBA, 0x90, 0x59, 0xF8, 0x0B, 0xDD, 0x84, 0x63, 0x61,
+    0xB3, 0x42, 0x16, 0xA1, 0x76, 0x9D, 0x30, 0x21, 0xEF, 0x32, 0x42, 0x44, 0xD0, 0x45, 0x2E, 0x53,
+    0x6B, 0xD4, 0x6A, 0xA1, 0xAC, 0x08, 0x0D, 0x9A, 0x1D, 0x58, 0xC3, 0x35, 0xE2, 0xA7, 0x91, 0xC6,
+    0x82, 0xB2, 0x6D, 0x93, 0xDE, 0xB0, 0xA9, 0x8B, 0x0A, 0x7A, 0x72, 0x1C, 0xD6, 0x23, 0xAD, 0x83,
+    0xED, 0x04, 0x6D, 0x42, 0xE4, 0xDD, 0x3D, 0x87, 0x32, 0x8D, 0x3F, 0x48, 0x00, 0xFA, 0x39, 0xF9,
+    0x36, 0x58, 0xF2, 0x59, 0xD8, 0x2F, 0x2D, 0xF4, 0x39, 0xBD, 0x7A, 0x84, 0xFF, 0x1E, 0xB8, 0x31,
+    0x7B, 0xF3, 0x89, 0x69, 0x9B, 0x8B, 0x12, 0xAE, 0x57, 0xCC, 0xDE, 0xDF, 0xB2, 0xD9, 0x23, 0x2D,
+    0x8F, 0x5F, 0xAF, 0xD7, 0xD4, 0xF9, 0x7B, 0x86, 0x77, 0x3D, 0x46, 0xEC, 0xA5, 0x6B, 0x8E, 0x48,
+    0xB4, 0x71, 0x9C, 0x1F, 0x42, 0x81, 0xC0, 0xB5, 0x20, 0x4B, 0xBC, 0x38, 0x64, 0xE9, 0x33, 0x45,
+    0x7A, 0x90, 0xA6, 0x82, 0xC2, 0xAA, 0x65, 0x01, 0xD4, 0xA0, 0x5D, 0x82, 0x45, 0xE8, 0xAB, 0x2E,
+    0x17, 0xE8, 0x3A, 0xD8, 0x0C, 0x06, 0x9B, 0xF0, 0x37, 0x1A, 0x6C, 0x9A, 0xFD, 0xBE, 0x75, 0xD6,
+    0xB7, 0x29, 0x07, 0x89, 0x5C, 0x0A, 0xC9, 0x5F, 0x59, 0x25, 0xF7, 0x8A, 0x19, 0x42, 0x21, 0x76,
+    0x21, 0x76, 0xF0, 0x85, 0x03, 0xBC, 0x05, 0x72, 0xD4, 0x78, 0x98, 0xCB, 0xD8, 0x3A, 0x48, 0x1C,
+    0x28, 0x01, 0xC8, 0x00, 0x6C, 0x13, 0x80, 0xC9, 0x52, 0xE8, 0xB4, 0x3B, 0x1E, 0x2D, 0x0E, 0x60,
+    0x72, 0x07, 0xA6, 0x5E, 0x84, 0x64, 0x25, 0x73, 0x69, 0x46, 0xE0, 0x1D, 0x54, 0x8B, 0xA4, 0x7C,
+    0x03, 0xA0, 0x16, 0x1A, 0x80, 0xE7, 0x56, 0xDC, 0x82, 0xDB, 0xE5, 0xF4, 0x7D, 0xFA, 0x5F, 0x3F,
+    0xFF, 0x00, 0xB5, 0x55, 0x3D, 0x6F, 0xDD, 0x36, 0x14, 0xBD, 0x7A, 0x82, 0x2D, 0x20, 0x1A, 0x38,
+    0x75, 0x71, 0x06, 0xED, 0x5D, 0xF8, 0x07, 0xEA, 0x52, 0x81, 0xC7, 0x0C, 0xEE, 0x50, 0xB7, 0x63,
+    0x96, 0x0E, 0x41, 0x97, 0xFC, 0x81, 0x87, 0x50, 0x40, 0x86, 0x0E, 0x59, 0x3C, 0x64, 0x6F, 0x96,
+    0x02, 0x4D, 0x32, 0xE4, 0x0F, 0x24, 0xA6, 0xDA, 0x0C, 0x19, 0x3C, 0x58, 0x69, 0x50, 0x64, 0xC8,
+    0x10, 0x15, 0xEE, 0xD4, 0x0E, 0x26, 0x60, 0x19, 0xA0, 0xFB, 0x48, 0xDE, 0x9E, 0x2B, 0xBF, 0x18,
+    0x28, 0x92, 0x0C, 0x2D, 0x52, 0x41, 0x87, 0x82, 0x28, 0xE9, 0x7E, 0x9C, 0x7B, 0xEE, 0x95, 0x63,
+    0xCE, 0x0B, 0x66, 0x0E, 0x35, 0x96, 0x51, 0x63, 0xE9, 0x48, 0x79, 0x22, 0x32, 0x3D, 0x16, 0x06,
+    0xCA, 0x84, 0x45, 0x9D, 0xFF, 0x80, 0x2D, 0xCE, 0xD8, 0xE2, 0x44, 0x25, 0x5F, 0x8B, 0xA4, 0xA6,
+    0xD2, 0xE3, 0x2D, 0xD5, 0xE3, 0x2D, 0x43, 0x65, 0xA4, 0x84, 0x0F, 0xCB, 0x49, 0xB6, 0x06, 0xE2,
+    0xD6, 0x74, 0x54, 0xC0, 0x4E, 0x39, 0x10, 0x55, 0x30, 0x85, 0xD7, 0x68, 0x83, 0xE6, 0x43, 0x8D,
+    0xB6, 0x57, 0x23, 0xB7, 0xEA, 0x05, 0x93, 0x7A, 0x09, 0x43, 0x87, 0x81, 0x9A, 0x37, 0x9E, 0x9A,
+    0x93, 0x81, 0x34, 0xF7, 0x00, 0x91, 0x86, 0x27, 0x93, 0xC4, 0x65, 0x0B, 0x0C, 0x40, 0x20, 0xFB,
+    0x7D, 0x26, 0x7B, 0x97, 0x3B, 0x7B, 0x87, 0xBD, 0xEB, 0x38, 0x6E, 0xEE, 0x13, 0x2D, 0x02, 0x0C,
+    0x3A, 0x40, 0x0F, 0xF4, 0xBE, 0xE3, 0x60, 0x7E, 0xAC, 0xBC, 0x23, 0xED, 0x2D, 0x19, 0xC0, 0x01,
+    0xEC, 0xED, 0x82, 0x27, 0x5B, 0xF2, 0x64, 0xAE, 0xAF, 0x26, 0xB3, 0xFB, 0x67, 0x30, 0x37, 0x0E,
+    0x83, 0x71, 0x77, 0x83, 0xE1, 0x5D, 0x40, 0x45, 0x93, 0x80, 0x08, 0x04, 0x15, 0xB5, 0x57, 0x51,
+    0x6C, 0x99, 0x85, 0x2F, 0x99, 0xA9, 0x41, 0x38, 0xB7, 0xC6, 0x7F, 0xBA, 0x59, 0xDC, 0xA7, 0x1F,
+    0x4D, 0xA7, 0x7E, 0x8A, 0x45, 0x54, 0xA3, 0x6E, 0xED, 0x8E, 0x2F, 0xA3, 0xA5, 0xE6, 0x35, 0x88,
+    0x88, 0x54, 0x21, 0x27, 0x13, 0xA8, 0x40, 0x5A, 0xC2, 0x2C, 0x32, 0x6B, 0x7A, 0x7A, 0x1C, 0x61,
+    0xA8, 0x2D, 0x78, 0xA4, 0xE6, 0x77, 0xA2, 0x9B, 0xB4, 0x65, 0xDB, 0xFA, 0x64, 0x58, 0xAC, 0x26,
+    0x3A, 0x48, 0xA4, 0xDD, 0x87, 0x6F, 0x98, 0x4F, 0x98, 0x57, 0xA8, 0x1A, 0x48, 0x17, 0x56, 0x51,
+    0x04, 0x8A, 0xEB, 0x28, 0xE2, 0xBA, 0x6E, 0x55, 0x96, 0xB4, 0xF1, 0x40, 0x81, 0xBE, 0xE2, 0x1C,
+    0x1C, 0x99, 0xDD, 0x9E, 0x2A, 0x8F, 0x6D, 0x57, 0x79, 0x52, 0x83, 0x69, 0x8B, 0x58, 0x06, 0xB0,
+    0xCA, 0x7D, 0x29, 0x05, 0x85, 0x55, 0xAF, 0x50, 0xFB, 0x22, 0x53, 0x15, 0xCC, 0x40, 0xF6, 0x59,
+    0x9C, 0xEB, 0x5E, 0x30, 0xBF, 0xE2, 0x0C, 0x2F, 0x46, 0x9C, 0x94, 0x7F, 0x75, 0x8A, 0xBD, 0x61,
+    0x1F, 0xAB, 0x63, 0x5F, 0x1F, 0xF5, 0xDA, 0x7C, 0x15, 0x99, 0x8F, 0x99, 0xB1, 0xBB, 0xF1, 0x85,
+    0x44, 0x60, 0xB9, 0xBD, 0xFD, 0xC8, 0x2F, 0x29, 0x2C, 0xE9, 0x09, 0x56, 0x0B, 0xA2, 0x51, 0x2F,
+    0x1E, 0x97, 0x45, 0x5C, 0xD2, 0xF6, 0x92, 0x3E, 0x5F, 0x16, 0xD9, 0x72, 0xB2, 0x1C, 0xB1, 0x39,
+    0xBF, 0x9F, 0x9C, 0x9C, 0xF9, 0x60, 0xAE, 0xE2, 0xE5, 0xC9, 0xEF, 0x9E, 0xAD, 0x9C, 0x7B, 0xF3,
+    0x37, 0x13, 0xA8, 0x4B, 0xA0, 0x15, 0xFC, 0x05, 0x68, 0xED, 0x36, 0x44, 0xA7, 0xBB, 0x44, 0x35,
+    0xD2, 0x5A, 0x4C, 0x6A, 0xA4, 0xA7, 0x48, 0x4D, 0xB7, 0x59, 0xF2, 0xEC, 0x6A, 0xAF, 0xC6, 0xAB,
+    0xE9, 0xEB, 0x24, 0xD9, 0xFD, 0x0C, 0x20, 0x20, 0x8E, 0xF8, 0x28, 0x8B, 0x52, 0xDB, 0x75, 0xF9,
+    0xF0, 0xF0, 0x19, 0xF3, 0xC0, 0x7C, 0xDF, 0xCE, 0xC5, 0x01, 0x47, 0x45, 0x14, 0x4F, 0x43, 0xC3,
+    0x53, 0xC5, 0x49, 0x88, 0x45, 0x54, 0xFA, 0xD7, 0x3D, 0x74, 0xC9, 0x2F, 0x68, 0x16, 0xF0, 0xA5,
+    0x85, 0xBB, 0xA8, 0x72, 0x85, 0x42, 0x7A, 0x37, 0x4A, 0x7C, 0xD7, 0x53, 0x33, 0x52, 0x15, 0x2D,
+    0x34, 0x4D, 0xFA, 0x55, 0x74, 0x1D, 0xC2, 0xB6, 0x10, 0x36, 0xD5, 0xAB, 0x2C, 0x4D, 0x24, 0x74,
+    0xCF, 0x9C, 0x4A, 0x7F, 0xD5, 0xD2, 0x4C, 0xB3, 0x0F, 0xAC, 0x0D, 0x72, 0x91, 0x2D, 0xA4, 0x45,
+    0x73, 0x37, 0xC2, 0xDF, 0x2A, 0x83, 0x22, 0x93, 0xED, 0x21, 0x83, 0xF5, 0xEF, 0x92, 0xE1, 0x12,
+    0xB2, 0x1F, 0x38, 0x16, 0xDF, 0x10, 0xE7, 0x92, 0xF3, 0x06, 0x2A, 0xB2, 0x40, 0xD7, 0xF4, 0x36,
+    0x15, 0x3C, 0x14, 0x90, 0x24, 0xD2, 0xD2, 0xF7, 0x28, 0xDB, 0xC7, 0x67, 0xCC, 0xCF, 0x39, 0x6D,
+    0x72, 0xF7, 0x31, 0xE5, 0xAF, 0xBA, 0x27, 0x20, 0x2A, 0x22, 0xCA, 0x09, 0x39, 0x74, 0xFF, 0x6B,
+    0xBB, 0x7D, 0xAC, 0x11, 0x01, 0xAE, 0x51, 0xC2, 0x34, 0x5F, 0x86, 0x84, 0xE6, 0x1C, 0x9A, 0x1E,
+    0xD5, 0x54, 0x83, 0x5E, 0x5F, 0xBA, 0x54, 0x06, 0x91, 0x09, 0x2E, 0xCD, 0x60, 0xAE, 0x25, 0x3D,
+    0x35, 0x2F, 0xB9, 0x48, 0xA6, 0xDB, 0xDA, 0x97, 0x54, 0xBA, 0x32, 0x3A, 0x54, 0xD9, 0x0D, 0x75,
+    0x72, 0x5E, 0x25, 0x37, 0xE9, 0xE4, 0x82, 0x49, 0x2E, 0xDA, 0x74, 0x90, 0x73, 0xCA, 0x2E, 0xA5,
+    0x6C, 0x63, 0xCA, 0x26, 0xA4, 0xAC, 0xA7, 0x94, 0x1B, 0x9F, 0x58, 0x8D, 0x09, 0xD1, 0x65, 0x01,
+    0xE4, 0xFA, 0xA5, 0x69, 0xCB, 0x78, 0x09, 0xD8, 0xB3, 0xEF, 0x03, 0x7C, 0x88, 0x2E, 0xD7, 0x40,
+    0x43, 0x00, 0x7F, 0x3C, 0x4A, 0xAE, 0xAF, 0x2E, 0x41, 0x57, 0xB3, 0x08, 0x35, 0x8B, 0xEE, 0x23,
+    0x21, 0xC5, 0x11, 0x23, 0x8F, 0x77, 0x30, 0x5E, 0x82, 0x05, 0x01, 0x87, 0x1E, 0xED, 0x0F, 0x8D,
+    0x36, 0x87, 0xA2, 0x5D, 0x11, 0x2B, 0x28, 0x83, 0xD5, 0xB3, 0x4D, 0x91, 0x36, 0x07, 0x99, 0xEC,
+    0xAD, 0xE8, 0xBF, 0x94, 0xCF, 0x37, 0xF9, 0xFC, 0xA2, 0x60, 0x98, 0x23, 0x50, 0xE5, 0x11, 0xF3,
+    0xE9, 0x54, 0x44, 0x70, 0x67, 0xBA, 0xE6, 0x68, 0xAC, 0x4E, 0xC3, 0x3B, 0x37, 0xCE, 0x74, 0xFA,
+    0x68, 0xAC, 0x4F, 0xC3, 0x22, 0xEE, 0xD1, 0x27, 0xB4, 0xF5, 0xA0, 0xAD, 0xD1, 0x17, 0xE0, 0x15,
+    0xAC, 0x9A, 0x56, 0xEF, 0x0E, 0xF5, 0xF1, 0x54, 0x05, 0xC4, 0x6D, 0x64, 0x1C, 0xF0, 0x0E, 0x66,
+    0x09, 0xDF, 0x23, 0xDB, 0xD1, 0xDC, 0x12, 0xF3, 0xF0, 0x73, 0xA8, 0x9B, 0x5F, 0x0B, 0xA5, 0x70,
+    0x28, 0x28, 0x02, 0x71, 0x1C, 0x61, 0x24, 0x94, 0xA8, 0x61, 0x0D, 0x95, 0xA9, 0x09, 0x19, 0xF8,
+    0x0B, 0xE8, 0xB7, 0x90, 0xBD, 0xDC, 0xDE, 0x54, 0x17, 0x3F, 0xA9, 0x28, 0x09, 0x14, 0x92, 0x84,
+    0xE6, 0xF8, 0xED, 0xC3, 0x87, 0x0F, 0x40, 0x56, 0x7E, 0x8B, 0x79, 0xC0, 0xFE, 0x07, 0x7C, 0x4A,
+    0x57, 0xEE, 0x04, 0x8A, 0x4D, 0xDF, 0xF4, 0x79, 0x31, 0x55, 0x93, 0x21, 0xF3, 0xDC, 0x17, 0xE9,
+    0x29, 0x08, 0xEF, 0xC9, 0x62, 0xF2, 0x41, 0xEF, 0x12, 0x93, 0x8C, 0xF0, 0x51, 0x66, 0xC3, 0x15,
+    0xEE, 0x0B, 0x99, 0x43, 0x99, 0x8A, 0x7C, 0x31, 0x45, 0x90, 0xC6, 0x3E, 0xDA, 0x78, 0xDA, 0x56,
+    0xE3, 0xF2, 0x33, 0x35, 0x6E, 0x2F, 0x01, 0x73, 0xE3, 0x4C, 0xF8, 0x88, 0x08, 0x7D, 0x42, 0xD8,
+    0xC3, 0x87, 0xDC, 0x6B, 0x38, 0x91, 0x71, 0xDC, 0xDA, 0x16, 0x7F, 0x4F, 0xDF, 0x0C, 0x05, 0x54,
+    0x44, 0x1A, 0x82, 0x47, 0xCF, 0x80, 0x38, 0x61, 0x66, 0x9E, 0x0C, 0x32, 0x3D, 0x24, 0x8C, 0xF9,
+    0x3F, 0x8C, 0x8F, 0xDE, 0x44, 0x32, 0xBF, 0x71, 0x67, 0xBC, 0x99, 0x34, 0x3C, 0x34, 0x20, 0x74,
+    0xA4, 0x7F, 0x75, 0xFC, 0x0D, 0x75, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0x9B, 0x78,
+    0xA5, 0xAC, 0xC4, 0xB8, 0x08, 0x0D, 0x11, 0xDA, 0x1E, 0x19, 0xB6, 0xA5, 0xB0, 0x3D, 0xEB, 0xB8,
+    0x70, 0x41, 0x11, 0x17, 0x39, 0x5A, 0x6A, 0x82, 0x90, 0xFF, 0x81, 0xF3, 0xED, 0x59, 0x2E, 0x52,
+    0x50, 0x24, 0x05, 0x3D, 0x14, 0x69, 0x70, 0x84, 0x48, 0x41, 0x11, 0x24, 0x9F, 0x77, 0x1D, 0x17,
+    0x2E, 0x28, 0xBC, 0x96, 0x85, 0x52, 0xA4, 0xF0, 0x0A, 0x4B, 0x20, 0x11, 0x21, 0x4F, 0x92, 0x39,
+    0x65, 0x6C, 0xCF, 0xCC, 0xE3, 0x9B, 0xB3, 0x9D, 0x10, 0x24, 0xEE, 0xE6, 0xCD, 0xCE, 0x9B, 0x9D,
+    0x99, 0x7D, 0x3F, 0xBE, 0xF9, 0xDE, 0x26, 0x6D, 0x16, 0x65, 0x91, 0xB5, 0xD9, 0x13, 0x1D, 0x2B,
+    0x47, 0x56, 0x96, 0x52, 0xB4, 0x62, 0x47, 0x27, 0x17, 0xCA, 0xAD, 0x56, 0x1C, 0xE8, 0x44, 0x7B,
+    0x72, 0x92, 0xC3, 0xEF, 0x8C, 0xD9, 0xF7, 0x7A, 0x55, 0x49, 0xA2, 0xA5, 0x44, 0x11, 0xDD, 0x26,
+    0xA2, 0x79, 0xDA, 0x9C, 0x9B, 0xB4, 0xD9, 0xD0, 0x6C, 0x1F, 0x2D, 0xB2, 0x72, 0xC9, 0x4A, 0xB6,
+    0x39, 0x8F, 0xD2, 0x93, 0x55, 0xA2, 0xB7, 0x6D, 0x74, 0x75, 0xE1, 0xCC, 0xC8, 0xA5, 0xE3, 0xCE,
+    0xE5, 0xF5, 0xA2, 0x1E, 0x38, 0xB1, 0x7F, 0xA6, 0xA1, 0xB6, 0x50, 0x6F, 0x42, 0xCD, 0xDA, 0x33,
+    0x5D, 0x2C, 0x1E, 0xB7, 0x23, 0x01, 0x75, 0x3E, 0xA8, 0xF8, 0xE8, 0x31, 0xA4, 0x86, 0xF4, 0x7A,
+    0xBD, 0xDB, 0x3F, 0x50, 0xF4, 0x40, 0xAE, 0xEB, 0x81, 0xC0, 0x01, 0xEB, 0xD8, 0xD9, 0xE1, 0x04,
+    0x23, 0x71, 0x92, 0x68, 0xC3, 0x44, 0x81, 0x89, 0x0C, 0x13, 0xD8, 0x2C, 0x9A, 0x91, 0x58, 0x57,
+    0xC5, 0x62, 0x67, 0xB3, 0xD6, 0x04, 0xEB, 0x0F, 0xCF, 0xED, 0x67, 0xB7, 0xB1, 0xB1, 0x51, 0x97,
+    0x44, 0x79, 0x43, 0x94, 0xC1, 0x87, 0xD8, 0xBC, 0xFF, 0x35, 0x51, 0xCD, 0xE7, 0x02, 0x77, 0xDE,
+    0x8A, 0xEC, 0x41, 0xB8, 0x83, 0x18, 0x92, 0xB1, 0x25, 0x49, 0x41, 0x1C, 0xC9, 0x08, 0x4F, 0x0E,
+    0xA2, 0x21, 0x43, 0xAC, 0x8C, 0xDC, 0xA4, 0x5B, 0x0E, 0x9D, 0xB9, 0xE8, 0xE8, 0x3F, 0x9D, 0x75,
+    0x08, 0x97, 0x65, 0xAC, 0x77, 0x8C, 0x43, 0x9D, 0xC5, 0xD7, 0x9D, 0x45, 0x18, 0xBD, 0x4D, 0x74,
+    0xE4, 0x6D, 0xAA, 0x22, 0xCF, 0x3C, 0xE9, 0xDA, 0x18, 0x81, 0xA6, 0x98, 0x97, 0x29, 0xE9, 0x48,
+    0x0C, 0x83, 0x31, 0x66, 0x32, 0xFC, 0xAD, 0x84, 0x3D, 0xCC, 0x47, 0xAA, 0xD8, 0x6B, 0x24, 0x4C,
+    0xB1, 0xE9, 0x2B, 0xE6, 0x3D, 0x76, 0xC1, 0x8A, 0x15, 0x4D, 0x09, 0x73, 0x29, 0x3C, 0x37, 0xB2,
+    0x11, 0x4A, 0x52, 0xA2, 0xEF, 0x10, 0xAC, 0xEE, 0x7D, 0x6E, 0x89, 0xF9, 0x5C, 0x08, 0x96, 0x63,
+    0x8E, 0xDB, 0xCC, 0x22, 0xA4, 0xA6, 0x62, 0xD6, 0x88, 0x8D, 0x12, 0xCC, 0x4D, 0x54, 0x9F, 0x50,
+    0xF8, 0x5D, 0xA7, 0x95, 0x61, 0xBE, 0xC0, 0x2E, 0x6D, 0x98, 0xB7, 0x55, 0x7D, 0xD3, 0xF4, 0x25,
+    0xC9, 0x3C, 0x1F, 0x66, 0x4F, 0xB9, 0x8D, 0xC6, 0xF0, 0x78, 0xAE, 0x72, 0x24, 0x6E, 0x71, 0x99,
+    0x1E, 0x3C, 0x53, 0xB1, 0x56, 0x1C, 0xDB, 0x59, 0x9C, 0x21, 0x32, 0xE6, 0xC5, 0xA6, 0xE6, 0xA1,
+    0x9A, 0xF2, 0x25, 0x15, 0x3C, 0xCC, 0xD9, 0x24, 0xE3, 0x2F, 0x9A, 0x11, 0xD9, 0xAC, 0x11, 0x8D,
+    0xC5, 0xA3, 0x15, 0x4D, 0xD5, 0xB3, 0xB0, 0xB1, 0x11, 0xEC, 0xF0, 0x68, 0xAB, 0x25, 0x07, 0x3B,
+    0xF7, 0x7D, 0xE2, 0x0B, 0x25, 0x8F, 0x38, 0xF1, 0x52, 0xC9, 0x3F, 0xA1, 0xC1, 0x8A, 0xF8, 0x44,
+    0x0B, 0xD8, 0xF6, 0x93, 0x99, 0x8B, 0xCD, 0x66, 0x64, 0x1F, 0x93, 0xD5, 0x64, 0x1F, 0x47, 0xB0,
+    0x1A, 0xC0, 0x72, 0x05, 0xBB, 0x29, 0x37, 0x98, 0x98, 0x4B, 0x43, 0x8A, 0xBA, 0xA8, 0x56, 0x29,
+    0xDB, 0x14, 0xA7, 0x9A, 0x89, 0x87, 0xBE, 0xBE, 0x2F, 0xD9, 0xC3, 0xAB, 0x23, 0x4E, 0x2D, 0x53,
+    0xBD, 0xD2, 0xE4, 0xCF, 0x54, 0x3A, 0xF6, 0x29, 0x36, 0x73, 0xCA, 0x4C, 0x15, 0x97, 0xF1, 0x2F,
+    0x54, 0xB9, 0x88, 0x7D, 0xDA, 0xF4, 0x73, 0x52, 0xFD, 0x6C, 0x1B, 0x2E, 0xB3, 0xCB, 0x01, 0xDF,
+    0x78, 0xCC, 0xBC, 0xCB, 0x9C, 0x73, 0x57, 0x73, 0x08, 0xEF, 0xE9, 0x86, 0x1C, 0x92, 0xA7, 0xC4,
+    0x92, 0x50, 0x24, 0x1B, 0xE2, 0xB7, 0xC3, 0x8D, 0x80, 0x12, 0xC6, 0x14, 0xE6, 0xCE, 0x2C, 0xE5,
+    0xDF, 0x28, 0x1A, 0xE4, 0x4D, 0xAC, 0x2B, 0x12, 0xFB, 0x96, 0xAA, 0x54, 0x25, 0x26, 0x47, 0x1C,
+    0xF9, 0x25, 0xE4, 0x2E, 0xB0, 0x27, 0x9A, 0x04, 0x89, 0x11, 0x4D, 0x30, 0x3C, 0xDA, 0x2A, 0x33,
+    0xEE, 0x8A, 0x35, 0x23, 0x7B, 0x9B, 0x15, 0xBB, 0x9A, 0x1D, 0x40, 0xB4, 0x45, 0x54, 0xFD, 0xF5,
+    0x23, 0x5C, 0x44, 0x88, 0xA2, 0xBA, 0x4B, 0x4D, 0xAE, 0x8B, 0x26, 0x71, 0xB9, 0xAA, 0x86, 0xC4,
+    0x42, 0x01, 0xA1, 0xD5, 0xBD, 0x97, 0x58, 0x57, 0xEC, 0xBD, 0x06, 0xA6, 0xE0, 0x21, 0x10, 0x0C,
+    0x87, 0x70, 0x60, 0xCC, 0x13, 0x24, 0x72, 0x00, 0xF1, 0xF9, 0xF8, 0xFC, 0x2D, 0x72, 0xEC, 0x30,
+    0x71, 0x7C, 0x06, 0x68, 0xF0, 0xCA, 0x98, 0x3B, 0xE9, 0x0A, 0x53, 0xDB, 0xA2, 0x1D, 0x18, 0x9A,
+    0xA1, 0x59, 0xA1, 0x85, 0xA6, 0xFE, 0xF4, 0x6C, 0x65, 0x6B, 0xF3, 0xD5, 0x7D, 0x0B, 0x48, 0xC5,
+    0x80, 0xA2, 0xB7, 0xC2, 0xDB, 0xC2, 0xDB, 0x6A, 0x60, 0xFD, 0xC0, 0xDB, 0x01, 0xEB, 0x01, 0x77,
+    0x15, 0x23, 0xBF, 0x65, 0xBD, 0x41, 0x77, 0x60, 0xBC, 0x11, 0x3B, 0xEC, 0x33, 0x56, 0xA9, 0xA7,
+    0xCB, 0xDF, 0x1C, 0x2D, 0xFF, 0x2C, 0x9E, 0x74, 0x55, 0xB6, 0xEE, 0x3E, 0x11, 0x7A, 0xB3, 0xDE,
+    0x7F, 0x75, 0x78, 0xF7, 0x78, 0x3E, 0x1F, 0x9B, 0x6A, 0xF7, 0x85, 0xCF, 0x77, 0x54, 0x85, 0x0B,
+    0x99, 0x1C, 0xE9, 0x68, 0x6C, 0x69, 0xD5, 0x52, 0xE1, 0x28, 0x0B, 0x18, 0x87, 0xC9, 0xB8, 0x61,
+    0x9E, 0xC4, 0xB1, 0x4A, 0x5E, 0xF2, 0x82, 0x2D, 0x4C, 0x8A, 0x4F, 0xF9, 0xE4, 0xA0, 0xEB, 0xCF,
+    0xA7, 0x3B, 0xE7, 0xDD, 0xE6, 0x7C, 0xB6, 0xD3, 0x3D, 0x9E, 0x97, 0xEB, 0x47, 0xEA, 0x7A, 0x88,
+    0x38, 0xE5, 0x8B, 0x26, 0x31, 0xB2, 0xA9, 0xD6, 0x9D, 0x30, 0x55, 0x87, 0xD0, 0x16, 0x66, 0x70,
+    0xC6, 0xBB, 0x87, 0xCE, 0xAE, 0xD6, 0x87, 0xBB, 0x4F, 0xAD, 0x1D, 0xC8, 0xEF, 0x7E, 0xFD, 0x7D,
+    0x6C, 0xB7, 0xAE, 0xE6, 0xCD, 0x3C, 0x15, 0xA2, 0x11, 0x3B, 0x2A, 0x51, 0x00, 0x21, 0xB0, 0x0C,
+    0xE5, 0x40, 0x25, 0x9A, 0xC3, 0xAD, 0xE1, 0x5B, 0xCC, 0x4F, 0x75, 0x7A, 0xE2, 0xC8, 0x57, 0xA5,
+    0x1C, 0x22, 0x25, 0x82, 0x95, 0x7C, 0x6E, 0x2A, 0x72, 0x23, 0xDA, 0x72, 0x34, 0x40, 0x5F, 0x2F,
+    0xB8, 0x8A, 0x6D, 0xC1, 0x06, 0xAF, 0xB0, 0x00, 0xFB, 0xD0, 0x7C, 0x0F, 0xD9, 0x1A, 0xB9, 0xB0,
+    0x06, 0xCD, 0xFB, 0x77, 0xDB, 0x0F, 0x04, 0xA2, 0x2A, 0xA3, 0xD3, 0x70, 0x0B, 0x98, 0x78, 0x5B,
+    0x0B, 0x85, 0xEB, 0x84, 0x60, 0xAB, 0x04, 0x8F, 0xB9, 0x89, 0xF6, 0x07, 0xE8, 0x91, 0xD7, 0x90,
+    0xA2, 0x82, 0x6D, 0x62, 0xBE, 0x24, 0x60, 0x2C, 0xD1, 0x48, 0xD7, 0x39, 0x2B, 0x6D, 0x9D, 0x87,
+    0x74, 0xCA, 0x13, 0xDB, 0xCC, 0xAB, 0x0A, 0x34, 0x45, 0x59, 0x4B, 0xB2, 0xC4, 0x9B, 0xC8, 0x5D,
+    0x49, 0x18, 0x51, 0x32, 0x71, 0x3D, 0x04, 0xAE, 0xE0, 0xC5, 0xDE, 0xC3, 0xD3, 0x47, 0x11, 0xF0,
+    0x80, 0x2B, 0x91, 0x0F, 0xC3, 0x7E, 0x5C, 0x7B, 0xAA, 0x81, 0x92, 0xE6, 0x52, 0xB9, 0x13, 0x74,
+    0x30, 0x7B, 0x6C, 0x8A, 0x46, 0x96, 0x2E, 0x51, 0x99, 0x1A, 0x90, 0xBC, 0xD7, 0xC6, 0x0E, 0x50,
+    0x06, 0x58, 0xEA, 0x40, 0x1E, 0x88, 0xAC, 0x9A, 0x50, 0x19, 0xB8, 0x11, 0x10, 0xFF, 0x80, 0x87,
+    0x31, 0x10, 0x84, 0x44, 0xC5, 0x93, 0x24, 0xC3, 0xAC, 0x1B, 0x20, 0x18, 0x5C, 0x74, 0x8E, 0x6C,
+    0xBE, 0x64, 0x64, 0xA4, 0x11, 0xD6, 0xBC, 0xB4, 0x6F, 0x06, 0xC5, 0x9A, 0x2E, 0xB6, 0xF1, 0x5A,
+    0x67, 0x81, 0xBF, 0x32, 0x06, 0x13, 0x44, 0xF0, 0x89, 0x72, 0xF0, 0x6D, 0x1C, 0x06, 0x05, 0x06,
+    0xB4, 0x1C, 0x3E, 0x20, 0x5A, 0x39, 0xDC, 0x22, 0x99, 0x2A, 0xAA, 0xE0, 0x54, 0xA0, 0x26, 0x80,
+    0x38, 0x7C, 0x27, 0x0F, 0x43, 0x18, 0xF5, 0x1A, 0x8C, 0xF5, 0x99, 0xC9, 0x8C, 0xD0, 0x1F, 0x0D,
+    0xAF, 0x7D, 0xFF, 0x4E, 0x71, 0x02, 0xA7, 0x14, 0xA5, 0x04, 0x9F, 0x3C, 0xB9, 0x50, 0x98, 0x9F,
+    0x33, 0x9F, 0x04, 0xA0, 0x87, 0x08, 0xE1, 0x7A, 0xA5, 0x6A, 0xFA, 0xCA, 0xA3, 0x99, 0x47, 0x33,
+    0xDD, 0x4C, 0x37, 0xA7, 0x57, 0x6B, 0x27, 0xFF, 0xA6, 0x0F, 0xF1, 0xFF, 0xD8, 0x4F, 0xAD, 0xBD,
+    0xA9, 0x3F, 0xEB, 0x17, 0xF5, 0xA7, 0x58, 0xFA, 0x9F, 0x82, 0x13, 0x7C, 0xC6, 0x06, 0xF3, 0xA6,
+    0xE0, 0x98, 0xCB, 0x82, 0x73, 0x33, 0x14, 0x1C, 0xD4, 0x17, 0x14, 0x2B, 0x14, 0x9C, 0xD6, 0x5E,
+    0xD6, 0x97, 0xD7, 0x3C, 0x21, 0xD9, 0x10, 0xFA, 0x10, 0xFB, 0x40, 0x12, 0x14, 0x3F, 0xA8, 0x15,
+    0xA1, 0x51, 0x37, 0x69, 0x6A, 0x82, 0x77, 0xAC, 0x52, 0xAB, 0xA4, 0xE6, 0xE9, 0xC5, 0x28, 0x8C,
+    0x31, 0x13, 0x88, 0x97, 0x68, 0x73, 0x1A, 0xF2, 0x29, 0x51, 0xFF, 0xDF, 0x22, 0x0D, 0x84, 0xA9,
+    0x3F, 0x9B, 0x97, 0xAB, 0xB3, 0x02, 0x52, 0x94, 0x23, 0xE8, 0x5B, 0x98, 0xDF, 0xBA, 0x4E, 0xEF,
+    0x51, 0x32, 0xC4, 0xA9, 0xB3, 0x24, 0x7C, 0xC2, 0x4A, 0x61, 0xC5, 0xBD, 0x1B, 0x47, 0xAC, 0xB8,
+    0x8B, 0xBE, 0x25, 0x10, 0x62, 0x39, 0xC2, 0x89, 0xC8, 0xC2, 0xB5, 0x87, 0x5D, 0x28, 0x12, 0x83,
+    0xE9, 0x44, 0x9F, 0xD6, 0x77, 0xD9, 0x06, 0x96, 0xA6, 0x7F, 0x00, 0x9D, 0x55, 0xBF, 0x6F, 0x17,
+    0x37, 0x14, 0x7F, 0x77, 0xA7, 0xCA, 0x52, 0x6E, 0xB8, 0xA9, 0x0C, 0x54, 0xEA, 0x75, 0x66, 0xC0,
+    0xFF, 0x40, 0x12, 0x1F, 0x30, 0x74, 0x60, 0x20, 0x43, 0x32, 0x75, 0x60, 0xA5, 0x5D, 0xB2, 0x30,
+    0x30, 0x84, 0xEF, 0xB9, 0x74, 0x60, 0xE8, 0x90, 0x0E, 0xAD, 0x3A, 0x96, 0x81, 0x21, 0x42, 0xAA,
+    0xA0, 0x52, 0x86, 0x0A, 0xC1, 0xF7, 0xAC, 0x64, 0x60, 0xC8, 0xD0, 0x93, 0xAA, 0x8A, 0x91, 0x13,
+    0x6A, 0x15, 0x09, 0x06, 0x5C, 0xB0, 0xDA, 0x43, 0xD8, 0x7E, 0xFD, 0xF8, 0xBE, 0x25, 0x69, 0x41,
+    0x6A, 0x25, 0x7C, 0xF6, 0xF3, 0xD9, 0x5F, 0xDF, 0xFB, 0xE1, 0xCF, 0xE7, 0xBD, 0xEF, 0x6E, 0xE9,
+    0xCA, 0x8F, 0x79, 0xD8, 0x0D, 0x9B, 0xE7, 0x2F, 0xD0, 0x8F, 0x77, 0xAD, 0x38, 0x88, 0xB4, 0xDC,
+    0x0D, 0xC5, 0xC1, 0x6D, 0xDA, 0xFA, 0x21, 0x6C, 0x7E, 0x59, 0xB1, 0xBB, 0xD3, 0xC6, 0x32, 0xEB,
+    0x1A, 0x6A, 0x03, 0x75, 0xB7, 0x9B, 0xAD, 0xA2, 0x97, 0x34, 0x96, 0x66, 0x35, 0x8B, 0x17, 0xB5,
+    0xE4, 0xA1, 0x64, 0x2F, 0x2C, 0x17, 0x4E, 0x9A, 0x50, 0xDA, 0xEE, 0x9C, 0x57, 0x03, 0xD3, 0x92,
+    0xA6, 0xC2, 0x11, 0x45, 0x22, 0x65, 0xE8, 0xAD, 0x96, 0xCD, 0x9B, 0x92, 0x07, 0xF9, 0xF9, 0xA8,
+    0x36, 0xEE, 0xB5, 0x1C, 0x3A, 0x0E, 0x81, 0x68, 0x4E, 0xD4, 0x3E, 0xF9, 0x5E, 0x71, 0xA8, 0x38,
+    0x64, 0xDD, 0x50, 0xED, 0xDB, 0xD4, 0x7F, 0x76, 0xF5, 0x43, 0xF7, 0x0E, 0x9F, 0xD3, 0x7D, 0x1C,
+    0xC4, 0x38, 0xC1, 0x03, 0xB5, 0x18, 0x33, 0x1C, 0x21, 0x8F, 0x11, 0xB8, 0x21, 0xC6, 0x06, 0x3F,
+    0xB5, 0x14, 0x33, 0x97, 0x79, 0x1A, 0xFF, 0x1E, 0x3E, 0x8D, 0x1C, 0x32, 0xF7, 0x79, 0xC8, 0x83,
+    0xE0, 0x22, 0x48, 0x04, 0x20, 0xF1, 0x95, 0x1C, 0x88, 0xDE, 0x27, 0xDA, 0xA2, 0x62, 0xA0, 0x3A,
+    0xE9, 0xC9, 0x9A, 0x9C, 0xF9, 0x27, 0x66, 0xF5, 0x64, 0x27, 0x52, 0x31, 0x52, 0x65, 0x53, 0xA0,
+    0x4C, 0x85, 0x3F, 0x7A, 0xCD, 0x77, 0xE0, 0x69, 0x97, 0x3C, 0xAD, 0xCF, 0x8C, 0xAB, 0x74, 0x49,
+    0xDD, 0x6A, 0x14, 0xEB, 0x15, 0xDC, 0x08, 0xED, 0x28, 0xF6, 0x35, 0x8F, 0x82, 0x2D, 0x6D, 0xA4,
+    0x80, 0x72, 0x1E, 0x2A, 0xB6, 0x55, 0xB3, 0x56, 0x35, 0x54, 0xBE, 0xC4, 0xD2, 0xD2, 0x07, 0xB0,
+    0x1A, 0xAB, 0x6F, 0xA2, 0x4A, 0xF1, 0x8D, 0x4B, 0xAC, 0x71, 0x4C, 0x7E, 0x31, 0xAA, 0x7D, 0x7F,
+    0x0A, 0xAF, 0xD9, 0x8D, 0xFA, 0x8C, 0x4B, 0xFD, 0xAC, 0x93, 0xE8, 0xD8, 0x37, 0x0A, 0xB7, 0xE5,
+    0xDB, 0xFA, 0xE0, 0x8F, 0xB0, 0xB8, 0xA3, 0x1B, 0x54, 0x37, 0x99, 0x7B, 0x2D, 0x72, 0x47, 0x72,
+    0x12, 0x1A, 0xCE, 0xC2, 0xBD, 0x75, 0x1A, 0xA7, 0x78, 0x17, 0x2D, 0xAD, 0xF0, 0x64, 0x23, 0xEE,
+    0x63, 0xF1, 0xD8, 0x1C, 0x4F, 0x61, 0x85, 0x6D, 0x6D, 0x3B, 0x74, 0x80, 0xB0, 0x64, 0x43, 0x8A,
+    0x89, 0xEC, 0x32, 0x15, 0xC6, 0x52, 0x55, 0x3C, 0xA1, 0xE5, 0x8A, 0x1B, 0xBB, 0x2C, 0xB1, 0x5C,
+    0xAE, 0x8A, 0x3D, 0x08, 0xBE, 0x3E, 0xA8, 0xB1, 0x3E, 0xC6, 0x49, 0xE8, 0x8F, 0xE8, 0x8A, 0xC0,
+    0x74, 0x19, 0x53, 0x23, 0x38, 0xAC, 0xB5, 0xCC, 0xD7, 0xF5, 0xE5, 0xAB, 0x57, 0xC4, 0xD9, 0x43,
+    0x7D, 0x79, 0xF5, 0x8A, 0xE0, 0x07, 0xBA, 0x75, 0xFF, 0x0F, 0xD5, 0xB3, 0xFF, 0x82, 0x2A, 0x81,
+    0xE5, 0x8B, 0x90, 0x6E, 0x1E, 0x6E, 0x9A, 0x04, 0x51, 0x6E, 0x53, 0x4C, 0xA9, 0x8D, 0x8A, 0x56,
+    0x55, 0x53, 0x5F, 0x34, 0xE2, 0x91, 0xC9, 0xB9, 0x27, 0x10, 0x43, 0xC2, 0x7B, 0x60, 0x06, 0xBD,
+    0x91, 0x49, 0x49, 0x57, 0xEF, 0xB1, 0xAE, 0xFA, 0x04, 0x22, 0x40, 0xA3, 0x93, 0xFA, 0xC8, 0x7D,
+    0x4F, 0xC1, 0xE7, 0xD1, 0x8B, 0xE8, 0xAB, 0xE8, 0x65, 0xF4, 0xED, 0xCC, 0xC7, 0x59, 0xF4, 0x33,
+    0x76, 0x33, 0x1E, 0x5A, 0x36, 0x1D, 0x37, 0xDD, 0x2D, 0xFA, 0x2C, 0x1D, 0xBD, 0x2F, 0x06, 0x84,
+    0x87, 0x0B, 0xD2, 0xD4, 0xF5, 0x6F, 0xF3, 0xBD, 0xA3, 0x6A, 0xDF, 0xE5, 0xA3, 0x34, 0xAA, 0x09,
+    0x85, 0x2D, 0xED, 0x8C, 0xD4, 0x76, 0x9F, 0x07, 0x78, 0x9C, 0x3E, 0x70, 0x70, 0x06, 0xAC, 0xB0,
+    0x94, 0x21, 0xF0, 0xDA, 0x24, 0x0E, 0x9D, 0x64, 0x9D, 0x48, 0x20, 0x03, 0xE5, 0x60, 0xE0, 0xA5,
+    0xEC, 0x5B, 0x73, 0x7A, 0x2B, 0x3F, 0x7C, 0x43, 0xFC, 0x32, 0x6B, 0xF9, 0x90, 0x23, 0xD9, 0x14,
+    0xF8, 0x22, 0x62, 0x61, 0x49, 0x30, 0x9B, 0x9A, 0x99, 0x4E, 0x84, 0x75, 0x12, 0xC3, 0xA4, 0x10,
+    0xB7, 0xAA, 0x33, 0x6C, 0x8B, 0x97, 0x17, 0x4D, 0x6D, 0x24, 0xB5, 0x20, 0x72, 0xFC, 0xC4, 0x16,
+    0xD8, 0xAA, 0x70, 0x12, 0x4C, 0xC4, 0x58, 0xC4, 0xBD, 0x36, 0xE9, 0xA0, 0x1A, 0xAB, 0x19, 0xD1,
+    0xA9, 0x78, 0x73, 0x02, 0x60, 0xD2, 0xF1, 0x35, 0x41, 0x87, 0x86, 0x7A, 0x5D, 0xF7, 0x8A, 0xDA,
+    0x06, 0x3A, 0xC4, 0x91, 0x0E, 0xF9, 0x0F, 0x1D, 0xA9, 0x95, 0xCC, 0x6C, 0x8F, 0x05, 0x02, 0x04,
+    0x7F, 0x78, 0x3F, 0xC5, 0xF9, 0x14, 0xD0, 0x82, 0xED, 0x30, 0xC2, 0x48, 0xEC, 0x0E, 0x01, 0x64,
+    0x61, 0xDE, 0xA2, 0x5C, 0xCC, 0xA5, 0x11, 0x76, 0x5E, 0x99, 0x12, 0x62, 0xA8, 0x86, 0x79, 0x69,
+    0x65, 0x3F, 0x17, 0x4E, 0x99, 0x58, 0xF8, 0x0C, 0x3A, 0x99, 0x3D, 0x4C, 0x99, 0x56, 0xD8, 0xCC,
+    0x7B, 0xC4, 0x09, 0x7F, 0x46, 0x5A, 0x79, 0x35, 0x94, 0xDB, 0x17, 0xC8, 0xB9, 0xB1, 0xAE, 0xCE,
+    0xEF, 0x5B, 0x77, 0x15, 0xD4, 0xBF, 0x99, 0xC7, 0x0C, 0x47, 0x4D, 0xA8, 0xF9, 0x77, 0x2F, 0x0F,
+    0xD8, 0xAB, 0x3D, 0x46, 0x86, 0xF0, 0xB0, 0x04, 0x63, 0x29, 0x00, 0xA8, 0xE9, 0x95, 0x95, 0xB6,
+    0x35, 0x95, 0xEB, 0x1A, 0x31, 0xA6, 0xBC, 0x3D, 0x1A, 0xBA, 0xF4, 0xDD, 0x6F, 0x9B, 0xA3, 0x82,
+    0xDB, 0x92, 0x53, 0x62, 0xB2, 0x41, 0x94, 0x44, 0x9B, 0x0E, 0x59, 0x4F, 0x45, 0xAC, 0xF6, 0xF8,
+    0x85, 0xF5, 0xDD, 0xA8, 0xCA, 0x50, 0xC2, 0x81, 0x0E, 0xA1, 0xDD, 0xB6, 0x2D, 0x05, 0xD9, 0xC8,
+    0xED, 0x5E, 0x3C, 0x06, 0xCE, 0xDD, 0x19, 0x58, 0x66, 0x14, 0x08, 0xAD, 0xD8, 0xA0, 0x58, 0x1D,
+    0x13, 0x21, 0x31, 0x5D, 0x24, 0x7A, 0x57, 0xBE, 0x45, 0x3E, 0x8F, 0x4A, 0x23, 0x19, 0x91, 0x8E,
+    0x6D, 0x23, 0x7B, 0xB0, 0xAF, 0x1E, 0x32, 0x46, 0xFD, 0xC8, 0x03, 0x95, 0x23, 0x58, 0x20, 0x7C,
+    0xE9, 0xA9, 0x08, 0xD5, 0x08, 0x16, 0xD4, 0xA0, 0x07, 0x83, 0x23, 0x13, 0x1E, 0x10, 0x13, 0xAA,
+    0x10, 0x89, 0x72, 0x10, 0xB0, 0x21, 0x39, 0xE9, 0x8D, 0xAF, 0x4D, 0x9D, 0xC6, 0xE2, 0xD0, 0xE4,
+    0xE3, 0x0A, 0xAD, 0x82, 0x72, 0xBD, 0x6C, 0x90, 0x39, 0xB5, 0x06, 0x0F, 0x29, 0x5D, 0x36, 0x94,
+    0x28, 0x90, 0x0B, 0x1A, 0xEA, 0xC4, 0x7B, 0x7C, 0x7E, 0x12, 0xB9, 0x53, 0x3C, 0x67, 0x8F, 0x78,
+    0x4A, 0x83, 0x04, 0x02, 0x9B, 0x3E, 0x05, 0x09, 0x5A, 0x8E, 0xDD, 0xD4, 0xE7, 0x89, 0xC6, 0xC7,
+    0x9D, 0xDF, 0xEE, 0x4D, 0xEA, 0x1B, 0x8B, 0xDA, 0x53, 0xF6, 0x24, 0x37, 0x39, 0x30, 0xFF, 0x19,
+    0x6F, 0x6D, 0xC3, 0x96, 0xFE, 0x77, 0x6D, 0x5C, 0xBC, 0xA2, 0x92, 0x01, 0x8D, 0x1E, 0xF5, 0x1B,
+    0x24, 0x19, 0x60, 0xA0, 0xB4, 0xF4, 0x1E, 0x6F, 0xAC, 0xF3, 0x54, 0x5A, 0x7D, 0x65, 0x27, 0xBD,
+    0x6F, 0x4C, 0x6E, 0xB2, 0xB4, 0x74, 0x23, 0x91, 0xA8, 0xE7, 0x08, 0xEA, 0x3B, 0x60, 0xF0, 0x20,
+    0xEE, 0xA0, 0x76, 0xA2, 0x0E, 0x6B, 0x88, 0x7A, 0xE2, 0x21, 0x40, 0x73, 0x00, 0xF1, 0x5C, 0xD8,
+    0x58, 0x93, 0x9A, 0xF2, 0x54, 0xC5, 0xCD, 0x62, 0x7A, 0xF6, 0x2B, 0xB0, 0x19, 0x64, 0xE4, 0xB3,
+    0xA8, 0x1C, 0xD2, 0x54, 0x7B, 0x23, 0xDD, 0x93, 0x1A, 0x53, 0xE6, 0xE5, 0x35, 0xDE, 0xF3, 0xD2,
+    0x49, 0x6C, 0x25, 0xC6, 0xF5, 0x6C, 0x76, 0x69, 0x97, 0xEE, 0x7E, 0xC5, 0x7E, 0x5C, 0x71, 0x1F,
+    0xE2, 0x09, 0x0E, 0xBF, 0x14, 0x89, 0x5D, 0xDC, 0x08, 0x2F, 0xB9, 0x84, 0x4D, 0xD7, 0x79, 0x44,
+    0x55, 0x3F, 0xE7, 0xC7, 0x80, 0x56, 0x3E, 0xE4, 0xEF, 0xE0, 0xAA, 0x7A, 0x94, 0xAA, 0x17, 0x75,
+    0xDD, 0xAB, 0x71, 0xA2, 0x6E, 0xC2, 0x0A, 0xF9, 0x13, 0xA7, 0x6A, 0x9F, 0xD8, 0x3F, 0x11, 0x91,
+    0x12, 0x8A, 0x69, 0x4A, 0x59, 0xA2, 0x53, 0x36, 0xA4, 0x83, 0x25, 0x6F, 0xBE, 0x48, 0xE9, 0xE2,
+    0xBA, 0x07, 0x29, 0xBB, 0xAE, 0x31, 0x8A, 0x2F, 0x83, 0x0B, 0x25, 0x4F, 0xB5, 0xA5, 0xB0, 0x13,
+    0xC0, 0xD5, 0xE2, 0x8F, 0x55, 0xBD, 0x2E, 0xE1, 0xEF, 0xDA, 0xFE, 0x02, 0x7D, 0x55, 0x31, 0x6F,
+    0x1D, 0x45, 0x10, 0x9E, 0xBD, 0x93, 0x7D, 0x88, 0x93, 0x58, 0x1A, 0x1A, 0x90, 0xD8, 0x1A, 0x0B,
+    0xB8, 0x1F, 0x80, 0xF1, 0x1E, 0xA4, 0x48, 0x91, 0xC2, 0x14, 0xA4, 0x4A, 0x91, 0x86, 0x22, 0x9D,
+    0xFF, 0x80, 0xED, 0x3B, 0x88, 0xA8, 0x28, 0x48, 0x49, 0x67, 0x4A, 0xE2, 0xC6, 0xF9, 0x01, 0x7E,
+    0xBE, 0x75, 0x2C, 0x94, 0x22, 0x45, 0x4E, 0x46, 0x28, 0x05, 0x02, 0x9F, 0x44, 0x24, 0x24, 0x52,
+    0xF8, 0x12, 0x2E, 0xCA, 0x59, 0xDE, 0xDB, 0xE1, 0x9B, 0x7D, 0x79, 0x4E, 0x90, 0x22, 0x9E, 0x76,
+    0xE7, 0xBD, 0x9B, 0xB7, 0x37, 0xFB, 0xED, 0x37, 0xDF, 0xCC, 0xE6, 0xC7, 0xAC, 0x9D, 0xBE, 0xEF,
+    0x67, 0x64, 0x76, 0xFE, 0xE9, 0xA8, 0xA8, 0xF6, 0x88, 0x2C, 0x0F, 0x44, 0x15, 0x3B, 0x22, 0x9E,
+    0x88, 0x32, 0x1E, 0xE5, 0xC9, 0x53, 0x7E, 0xFE, 0xDC, 0x53, 0xF3, 0xFD, 0x43, 0xAF, 0xBD, 0xBD,
+    0x82, 0x3F, 0x28, 0xAD, 0x61, 0xDE, 0xC2, 0xA4, 0xB7, 0x49, 0x7D, 0x45, 0x1C, 0x52, 0x0E, 0x4B,
+    0xE4, 0x29, 0xE9, 0xC9, 0xB8, 0x6A, 0x52, 0xDC, 0xAA, 0x8D, 0x8E, 0x74, 0x4B, 0xC5, 0x0F, 0x14,
+    0xAA, 0xE6, 0x19, 0xF3, 0x3D, 0x9E, 0x96, 0xB9, 0x56, 0x03, 0x65, 0x2D, 0x99, 0x92, 0x8A, 0x76,
+    0x7B, 0xA4, 0x0F, 0x69, 0x55, 0x0F, 0x7A, 0xA0, 0x4D, 0x5A, 0xB5, 0xBE, 0xF1, 0x4D, 0xF7, 0x3E,
+    0x99, 0xFA, 0x93, 0x4E, 0x75, 0x45, 0x6B, 0x6B, 0xDD, 0x55, 0x2E, 0x1D, 0x6D, 0x4B, 0x93, 0xE9,
+    0xC9, 0xAE, 0xF7, 0xA4, 0x7F, 0x1B, 0x29, 0x03, 0x0E, 0x15, 0x80, 0xA0, 0x61, 0xA2, 0x02, 0x33,
+    0xE7, 0x9A, 0x52, 0x6E, 0xE7, 0x78, 0x2D, 0x7E, 0x68, 0x0E, 0x94, 0x9E, 0x71, 0xA7, 0x42, 0x11,
+    0xA8, 0xBA, 0xC9, 0xCF, 0x8A, 0xCE, 0xCA, 0x79, 0x54, 0x0F, 0xB0, 0x9B, 0x98, 0x46, 0x50, 0x93,
+    0x5E, 0x77, 0xDA, 0xD4, 0xC6, 0x92, 0xD9, 0xA2, 0x62, 0xA4, 0x02, 0x5B, 0x74, 0x64, 0x61, 0x3D,
+    0xAD, 0x71, 0xB9, 0x66, 0xDB, 0x6D, 0x13, 0xE2, 0x09, 0xE3, 0x21, 0xE3, 0x1B, 0x8E, 0x6C, 0x0B,
+    0x53, 0xD5, 0x30, 0x8C, 0xC7, 0x24, 0x90, 0x79, 0x70, 0xD9, 0xC3, 0xAC, 0x0F, 0x30, 0x1B, 0x3D,
+    0x15, 0x0F, 0x1A, 0x9C, 0x98, 0x01, 0x29, 0x1A, 0xCB, 0xC0, 0x63, 0x77, 0xAA, 0x11, 0x66, 0x3D,
+    0x90, 0xFD, 0x36, 0xE3, 0xDA, 0xD6, 0x8A, 0x3B, 0x5B, 0x53, 0x33, 0xAE, 0x94, 0xB4, 0x72, 0x5B,
+    0xA8, 0x74, 0x59, 0xBB, 0x4A, 0x3E, 0x75, 0x45, 0xB9, 0xFA, 0xB0, 0xCB, 0xFE, 0xF0, 0x60, 0xBC,
+    0xCC, 0x90, 0x87, 0xD9, 0x69, 0x97, 0xFF, 0x5E, 0xD5, 0xFB, 0x2A, 0x68, 0x97, 0x7B, 0xA1, 0xC3,
+    0x0C, 0x5C, 0x56, 0x21, 0x90, 0xFE, 0xC5, 0x93, 0xBE, 0x3F, 0x92, 0x39, 0x01, 0xDD, 0xA7, 0xB2,
+    0xA5, 0x8B, 0x64, 0xE0, 0xC4, 0x64, 0x23, 0x0F, 0x65, 0xE4, 0xC2, 0x22, 0x7F, 0xD5, 0x0E, 0x68,
+    0xF8, 0x8E, 0x6B, 0x50, 0xD1, 0x37, 0x35, 0xFB, 0x64, 0xA0, 0x84, 0x19, 0xBC, 0x79, 0x42, 0xBE,
+    0x28, 0xED, 0xE3, 0xC9, 0xC8, 0x02, 0x89, 0x07, 0x73, 0x8F, 0x11, 0x11, 0x91, 0xAA, 0x81, 0x14,
+    0x4E, 0x90, 0x21, 0x50, 0x81, 0xEF, 0x86, 0xEB, 0xE4, 0x8C, 0xEB, 0xFC, 0x29, 0x3B, 0x7B, 0xC4,
+    0x8E, 0xF9, 0x6B, 0x46, 0xC2, 0xF5, 0xB0, 0x74, 0x6D, 0xA8, 0x5C, 0x84, 0x43, 0xB6, 0xE8, 0x48,
+    0x4D, 0x78, 0x35, 0x3B, 0x1F, 0x28, 0x22, 0xA2, 0x46, 0xE2, 0x73, 0x87, 0x0D, 0x10, 0x26, 0x82,
+    0x22, 0x86, 0x49, 0x85, 0x1B, 0xF3, 0x17, 0x8C, 0xE0, 0xC2, 0xE9, 0xD8, 0xE5, 0x23, 0x0C, 0xF7,
+    0x7E, 0xC5, 0xEF, 0xD3, 0xC7, 0xDB, 0xA4, 0x1B, 0x2C, 0x2A, 0x09, 0x31, 0x2C, 0xA2, 0x23, 0xEB,
+    0x58, 0xF6, 0x7C, 0xA4, 0xFD, 0xCA, 0x15, 0xB9, 0xB7, 0x65, 0xEA, 0x21, 0x2C, 0x4E, 0x41, 0xAB,
+    0x03, 0x17, 0xBD, 0xAD, 0x53, 0x6F, 0x3A, 0xE2, 0x0C, 0x8E, 0x43, 0x71, 0x54, 0xE2, 0xE8, 0xE1,
+    0x60, 0xE6, 0x43, 0xCC, 0xA1, 0x62, 0x9E, 0x0C, 0x7E, 0x5C, 0x09, 0xBB, 0xCD, 0x31, 0x93, 0x19,
+    0x1A, 0x97, 0xF1, 0x46, 0xAF, 0x44, 0x37, 0x50, 0x24, 0xD1, 0x16, 0xE6, 0x9B, 0xE5, 0xA6, 0xEA,
+    0x37, 0xD5, 0x30, 0x1F, 0xFB, 0x6A, 0x98, 0xA9, 0xA1, 0x61, 0x8C, 0x11, 0xE3, 0x20, 0x19, 0x67,
+    0x89, 0x3F, 0x48, 0x40, 0xEE, 0x47, 0x18, 0xC0, 0xC0, 0x3C, 0x4E, 0x38, 0x18, 0xFF, 0x89, 0x5D,
+    0x7F, 0xBD, 0xBA, 0x8E, 0xFD, 0xC1, 0x1A, 0x36, 0x86, 0x3C, 0x01, 0x81, 0x04, 0x8C, 0x23, 0xF3,
+    0x8A, 0x9B, 0x77, 0xF7, 0xE0, 0x06, 0x0A, 0xB8, 0x61, 0xA5, 0xB0, 0xA0, 0xD9, 0x44, 0xF0, 0x51,
+    0x8E, 0xA4, 0x23, 0x8D, 0x40, 0x54, 0x12, 0xB0, 0x89, 0x1B, 0x28, 0x45, 0xAF, 0x1C, 0x36, 0x55,
+    0xB8, 0x0D, 0x40, 0x24, 0x73, 0xEB, 0xC5, 0x04, 0x34, 0xE4, 0x64, 0xBC, 0x98, 0xB3, 0x64, 0x24,
+    0x40, 0x9C, 0x0B, 0x55, 0xB1, 0xB0, 0x8C, 0x9D, 0xA0, 0x06, 0xEC, 0x24, 0x25, 0x2C, 0xE2, 0x56,
+    0x9E, 0x24, 0xA3, 0x7D, 0x2A, 0x6E, 0xA7, 0x7D, 0x74, 0x9F, 0x9F, 0x89, 0x9B, 0x27, 0xB8, 0xF9,
+    0xDC, 0x8B, 0x3B, 0xF1, 0xB2, 0x3A, 0x7D, 0x22, 0xAB, 0xF5, 0x3D, 0x59, 0x6D, 0xE1, 0x1E, 0x55,
+    0x74, 0x37, 0xE2, 0xBE, 0xCB, 0x97, 0xB1, 0x3A, 0xEF, 0xE8, 0xE5, 0x27, 0xEE, 0x15, 0x4D, 0x48,
+    0xC4, 0xA8, 0xD7, 0x98, 0xE4, 0xA5, 0xE1, 0x50, 0xC2, 0x70, 0x77, 0x35, 0xE1, 0x53, 0xC8, 0x71,
+    0x4A, 0xD0, 0x38, 0xBC, 0x74, 0x0F, 0xE4, 0x78, 0x61, 0x94, 0xF8, 0x4C, 0x34, 0x83, 0x98, 0x5B,
+    0xAF, 0x6C, 0xA7, 0x7E, 0x84, 0xC9, 0xFD, 0xF2, 0x2D, 0x24, 0xC0, 0x70, 0xA9, 0x85, 0xC3, 0x7C,
+    0x32, 0xED, 0x01, 0x94, 0xE1, 0xF4, 0xA1, 0x4F, 0xFB, 0xB4, 0xAB, 0xD4, 0x98, 0x0C, 0x85, 0xDB,
+    0x56, 0x3E, 0xEF, 0xCD, 0x61, 0x50, 0x53, 0x76, 0xC6, 0x77, 0x6C, 0x8B, 0xB3, 0x6A, 0x6E, 0x58,
+    0x34, 0x8C, 0xEA, 0x34, 0x91, 0xAA, 0x8D, 0x47, 0x8B, 0xC0, 0x46, 0x2A, 0xE1, 0x49, 0xA0, 0xE2,
+    0x9C, 0x7B, 0x73, 0x77, 0xD8, 0xCA, 0xDD, 0xA0, 0x2F, 0xF5, 0x9B, 0xA9, 0x1B, 0x4D, 0xD2, 0xAF,
+    0x65, 0xC7, 0xA3, 0x3E, 0x0C, 0xFC, 0xCD, 0x64, 0xB9, 0x47, 0x6D, 0x7B, 0x50, 0xFC, 0x88, 0xDE,
+    0x5B, 0x00, 0x53, 0x0D, 0x0A, 0x12, 0x55, 0xD5, 0xA0, 0xC6, 0xC0, 0xBA, 0x08, 0x18, 0x69, 0x25,
+    0xB4, 0x37, 0x82, 0x18, 0xE3, 0x2C, 0x16, 0x13, 0x3E, 0x1D, 0xCA, 0x1B, 0x00, 0x3E, 0x22, 0x88,
+    0x87, 0x98, 0xE2, 0x7B, 0x28, 0x1B, 0xBC, 0xB1, 0x58, 0xEC, 0x24, 0xEA, 0x72, 0x20, 0xF6, 0x79,
+    0xB8, 0x53, 0x09, 0x2F, 0x39, 0x4A, 0x1A, 0xC5, 0x08, 0x89, 0xBD, 0x91, 0xCA, 0xF6, 0xE3, 0xBB,
+    0xA8, 0x6B, 0xA7, 0xA4, 0x21, 0x4B, 0xB3, 0x61, 0x21, 0xE2, 0x08, 0xB3, 0xDF, 0xDD, 0xFB, 0xFB,
+    0x27, 0xCA, 0xB0, 0x4B, 0xFC, 0xAF, 0x42, 0xE1, 0x19, 0x48, 0xFD, 0xBF, 0x0E, 0xE4, 0x2F, 0x87,
+    0x36, 0x24, 0x23, 0xD4, 0xA0, 0x9D, 0x17, 0xDD, 0xBC, 0x9B, 0x26, 0x52, 0xB1, 0x24, 0x5A, 0x5A,
+    0x8B, 0x55, 0x21, 0x17, 0x00, 0xC6, 0x07, 0xB3, 0x1B, 0xD2, 0x3E, 0x2F, 0xC6, 0x3E, 0xD1, 0x2C,
+    0x8E, 0x83, 0xF8, 0x7A, 0x2A, 0x03, 0x71, 0x19, 0xDA, 0xAF, 0x3E, 0x9B, 0x20, 0x7E, 0xEB, 0x8A,
+    0x36, 0x1F, 0xF0, 0xC8, 0xF9, 0x40, 0x05, 0x5A, 0x44, 0x8A, 0xCE, 0x15, 0xFB, 0xB6, 0x89, 0x3D,
+    0x1B, 0xC7, 0xAB, 0xBA, 0x39, 0x3F, 0xA9, 0x80, 0x8A, 0x3D, 0x02, 0x28, 0x45, 0xF7, 0xD9, 0x34,
+    0x6F, 0xB9, 0x6D, 0xFE, 0xD4, 0xA7, 0x83, 0x55, 0xE8, 0x7E, 0x07, 0x0A, 0x95, 0x6F, 0xAF, 0x3B,
+    0xFD, 0xB8, 0x53, 0xA8, 0x18, 0xF4, 0xE9, 0x3C, 0x40, 0xEA, 0x14, 0x5B, 0x44, 0x4F, 0xA8, 0x30,
+    0x9A, 0x3F, 0x2C, 0x40, 0x7C, 0x3E, 0x07, 0x61, 0x5E, 0x80, 0x40, 0x41, 0x5E, 0x80, 0xE0, 0x39,
+    0x88, 0x58, 0x28, 0xA8, 0xC2, 0x76, 0xE9, 0xFA, 0xD9, 0x17, 0xAF, 0x07, 0xF1, 0x0E, 0x2D, 0x5D,
+    0x1A, 0x93, 0xD1, 0x38, 0x5B, 0xA2, 0x46, 0xF2, 0x0E, 0xBD, 0x54, 0xBB, 0xF4, 0x19, 0x32, 0xD5,
+    0xE0, 0x75, 0xDC, 0x49, 0x88, 0xD4, 0xB4, 0x39, 0xF2, 0x07, 0x4D, 0xFD, 0x7C, 0x6D, 0xFA, 0x52,
+    0x10, 0x08, 0x96, 0x95, 0x5A, 0x7E, 0x35, 0xA0, 0xBC, 0x42, 0xC2, 0x70, 0x9B, 0xF5, 0xD6, 0x25,
+    0x90, 0x28, 0xD9, 0x13, 0xE9, 0x02, 0xC8, 0xAF, 0x14, 0xA6, 0x8E, 0x1D, 0x92, 0x22, 0xE7, 0x4A,
+    0x72, 0x2F, 0xDD, 0x81, 0x4F, 0xD0, 0xB5, 0x8F, 0xB9, 0xB4, 0x9D, 0xED, 0x6D, 0xAF, 0x43, 0x31,
+    0xC6, 0x0B, 0x6E, 0x91, 0x11, 0x5D, 0xD3, 0xA7, 0xB4, 0x6F, 0x54, 0xAF, 0x8F, 0xBA, 0xEC, 0xD4,
+    0x25, 0x80, 0x2C, 0x45, 0x85, 0x18, 0xB8, 0x35, 0x70, 0x9F, 0x77, 0xF6, 0xE6, 0xD0, 0x00, 0x42,
+    0xCC, 0x08, 0xFD, 0xCF, 0xE7, 0x5F, 0xAD, 0x55, 0x31, 0x6F, 0xDD, 0x36, 0x10, 0x3E, 0x49, 0x35,
+    0x04, 0x84, 0x40, 0xB9, 0xD4, 0x19, 0xDA, 0x06, 0xFC, 0x03, 0x49, 0xB5, 0x74, 0x8C, 0x1F, 0x55,
+    0x74, 0xC8, 0x90, 0xC1, 0x1E, 0xDC, 0xD9, 0xFD, 0x07, 0x5E, 0x3B, 0xBC, 0x67, 0xAA, 0xF0, 0x90,
+    0xC1, 0x43, 0xBD, 0x74, 0xEA, 0x90, 0x8C, 0x6D, 0x51, 0x20, 0x19, 0x33, 0xD8, 0x8F, 0x72, 0xDE,
+    0x60, 0xA0, 0x1E, 0xA2, 0x34, 0x43, 0xC6, 0x28, 0x49, 0xD1, 0x0E, 0x41, 0x61, 0x26, 0x51, 0x1A,
+    0xDA, 0xA6, 0x74, 0xBD, 0xE3, 0x73, 0x1C, 0x2F, 0x41, 0x97, 0x08, 0xD4, 0x27, 0x3D, 0x3D, 0xF2,
+    0xEE, 0xBB, 0xEF, 0x8E, 0x47, 0xC4, 0xA0, 0x33, 0x44, 0x17, 0x2E, 0xDC, 0x3E, 0xDE, 0x74, 0x50,
+    0x54, 0xB2, 0x86, 0x29, 0x68, 0x48, 0x3D, 0x04, 0x10, 0x6D, 0xF6, 0xFE, 0x4F, 0x16, 0xB1, 0x4B,
+    0x11, 0xB1, 0x11, 0x04, 0x65, 0x81, 0xD8, 0x03, 0x40, 0xD6, 0x11, 0xC8, 0x86, 0x40, 0x97, 0x04,
+    0xAB, 0x1A, 0x0F, 0x00, 0xF1, 0x2A, 0xC8, 0xD2, 0xC1, 0x52, 0x56, 0x43, 0x27, 0x21, 0x6B, 0xDE,
+    0xFD, 0x24, 0xC7, 0xE4, 0xBC, 0x96, 0x88, 0x34, 0x79, 0x0C, 0x90, 0x38, 0x80, 0xB4, 0xA2, 0x77,
+    0xE1, 0x84, 0xB3, 0x60, 0x84, 0xCB, 0xDD, 0x06, 0xE8, 0x9C, 0x9C, 0xD2, 0x23, 0x6B, 0x73, 0xA7,
+    0xBF, 0x42, 0x72, 0xEA, 0x78, 0xC5, 0xA7, 0x3F, 0xD1, 0x6C, 0x03, 0x90, 0xBF, 0x7B, 0x68, 0x07,
+    0x19, 0xC6, 0xC7, 0xFC, 0xCB, 0x5D, 0xB1, 0x55, 0x7B, 0x82, 0xEA, 0xEE, 0x77, 0xF2, 0xC6, 0x9E,
+    0xD7, 0x58, 0x4D, 0x3D, 0xC8, 0x0A, 0x3C, 0x88, 0x0A, 0x2C, 0x79, 0x01, 0x15, 0x7D, 0xC2, 0x08,
+    0x76, 0x96, 0xE2, 0xB8, 0x4A, 0xE3, 0x56, 0x18, 0x77, 0x61, 0xFC, 0x3A, 0xE8, 0x93, 0xA0, 0x31,
+    0x28, 0xDC, 0xCD, 0xFB, 0x09, 0x74, 0x71, 0xAC, 0x4C, 0x00, 0x26, 0xDF, 0x7E, 0x74, 0xE7, 0xF2,
+    0x9D, 0xCB, 0x7F, 0x5D, 0x79, 0xBE, 0x84, 0x13, 0xDB, 0xEB, 0x7F, 0xE4, 0x25, 0x71, 0x09, 0x2E,
+    0x91, 0x95, 0xA2, 0x04, 0xD1, 0x40, 0x4A, 0x1A, 0x4C, 0xE9, 0x47, 0x45, 0x62, 0xB1, 0x68, 0x14,
+    0x65, 0xA3, 0x71, 0x90, 0x68, 0x67, 0x21, 0xED, 0x06, 0x98, 0xE8, 0x52, 0xFD, 0xD0, 0xE4, 0xCF,
+    0x7C, 0xEA, 0x07, 0xB0, 0xBA, 0x2A, 0x7E, 0xBF, 0x75, 0xE1, 0xD6, 0xBB, 0xA5, 0x24, 0xA3, 0x26,
+    0x0D, 0x6B, 0xC8, 0xDE, 0xF4, 0xB4, 0xB4, 0x25, 0x16, 0xB2, 0x55, 0xD7, 0x5C, 0xF6, 0x24, 0x80,
+    0x37, 0xA0, 0x8B, 0x5A, 0x1E, 0xB8, 0xFC, 0x65, 0x48, 0x83, 0x2D, 0xAD, 0x6E, 0x74, 0x4D, 0x8E,
+    0x2F, 0xB2, 0xD8, 0x39, 0x72, 0x24, 0x06, 0xC9, 0x46, 0xD6, 0xB3, 0x7C, 0x45, 0x2D, 0x9E, 0x06,
+    0x18, 0x16, 0xD7, 0x0F, 0x90, 0x2F, 0xC9, 0xD0, 0x2B, 0xC6, 0x8E, 0x66, 0xAC, 0x70, 0xA6, 0x78,
+    0x05, 0x14, 0x47, 0xF0, 0x39, 0x39, 0x45, 0x5E, 0x4F, 0x59, 0xAD, 0x23, 0xF2, 0x77, 0x6C, 0x09,
+    0x13, 0xB6, 0x5D, 0x6C, 0xD3, 0x84, 0x21, 0x29, 0x75, 0x7E, 0xCF, 0xA9, 0xF2, 0xAE, 0x3D, 0x35,
+    0x57, 0x27, 0xC3, 0x6A, 0xA4, 0x0B, 0xE2, 0x75, 0x0E, 0x09, 0xAF, 0x55, 0xD1, 0x0A, 0x2F, 0xBC,
+    0xB8, 0x1D, 0x49, 0x71, 0x45, 0x58, 0xC6, 0x3C, 0x92, 0xD2, 0xB5, 0x78, 0x12, 0xE9, 0xEC, 0x47,
+    0xBC, 0x16, 0x49, 0x91, 0x46, 0x3F, 0x92, 0x9B, 0x34, 0x30, 0x1D, 0x11, 0x51, 0x0D, 0xE5, 0x95,
+    0x48, 0xAA, 0x8B, 0xD8, 0x44, 0xA4, 0x39, 0x9F, 0xE1, 0x9F, 0x6C, 0xB6, 0x89, 0x73, 0x18, 0xB8,
+    0x6E, 0xE8, 0xE2, 0x70, 0x48, 0x72, 0x30, 0xFD, 0x02, 0xB1, 0x9C, 0xB9, 0x02, 0x3C, 0xB3, 0x54,
+    0x91, 0xE5, 0xF1, 0x37, 0x9C, 0x62, 0x8A, 0xB7, 0xCB, 0x21, 0x65, 0x96, 0x05, 0xB1, 0x4C, 0x98,
+    0xA5, 0x60, 0xB7, 0x4D, 0x5C, 0x6F, 0xD6, 0x1E, 0x51, 0xCE, 0xE5, 0xCC, 0x11, 0x3C, 0xEC, 0x7A,
+    0xBD, 0xF6, 0xF7, 0xD1, 0x60, 0x0F, 0xA3, 0x42, 0x7C, 0xC9, 0x7A, 0x02, 0x31, 0x94, 0x3A, 0x86,
+    0xE5, 0x23, 0x81, 0x1E, 0xFE, 0xFF, 0xCA, 0x82, 0x1C, 0xF2, 0x00, 0xCA, 0xD9, 0x96, 0x02, 0xC0,
+    0xEB, 0xBD, 0x6A, 0x21, 0x0F, 0xE6, 0x21, 0x85, 0x59, 0x3C, 0x0A, 0x96, 0x38, 0xA3, 0x79, 0x4C,
+    0x6E, 0xC4, 0xC9, 0xC0, 0xE6, 0x74, 0xCC, 0x40, 0x12, 0xB3, 0x01, 0x02, 0x07, 0x88, 0x49, 0x65,
+    0x8A, 0x2A, 0x0A, 0x20, 0xA2, 0x5E, 0xBC, 0xF3, 0x88, 0x82, 0x3D, 0x19, 0x28, 0x49, 0x7A, 0x30,
+    0x07, 0x58, 0x49, 0xBC, 0xD1, 0x6B, 0xCC, 0xD0, 0xD9, 0x06, 0xC3, 0xA9, 0xEF, 0xB4, 0x53, 0x55,
+    0x34, 0xC6, 0x49, 0x9C, 0xDB, 0x2A, 0xBA, 0xF7, 0x53, 0x4D, 0x56, 0x17, 0x56, 0x16, 0xCB, 0x2C,
+    0xA8, 0xCE, 0xD4, 0x09, 0x2A, 0x47, 0x55, 0x60, 0x97, 0x5F, 0x72, 0x45, 0xDE, 0x7F, 0x45, 0xDE,
+    0xE4, 0x21, 0xCB, 0x91, 0xC7, 0x6C, 0xD0, 0xBE, 0xE5, 0x8D, 0x1A, 0x0B, 0x25, 0x8D, 0xEF, 0x54,
+    0x10, 0x2D, 0x53, 0x25, 0xE7, 0x29, 0x1E, 0x9E, 0x60, 0x29, 0x71, 0xFD, 0x5F, 0xAA, 0xDF, 0xBE,
+    0xF0, 0x36, 0xA8, 0xEF, 0x87, 0xBC, 0xC5, 0xC4, 0xDB, 0x72, 0x4A, 0x15, 0x7F, 0xBB, 0x16, 0x87,
+    0x2D, 0x31, 0x05, 0xCA, 0xAE, 0xEE, 0x69, 0x65, 0xC8, 0x8E, 0xF1, 0x41, 0x4F, 0xAA, 0x94, 0x66,
+    0xAD, 0x91, 0xCF, 0x5D, 0x36, 0x70, 0xE1, 0x82, 0xA9, 0x52, 0x4B, 0x5D, 0x82, 0x22, 0x6C, 0x41,
+    0x6E, 0x9F, 0x92, 0x7C, 0xD1, 0x29, 0x9D, 0xBC, 0xA9, 0x95, 0x4F, 0x11, 0x8A, 0x36, 0xC5, 0x76,
+    0x54, 0x6C, 0xB6, 0xE3, 0x51, 0xF6, 0xB0, 0x5D, 0x02, 0x55, 0xE7, 0x1E, 0x38, 0x4F, 0x14, 0x72,
+    0x73, 0x76, 0xF7, 0xB2, 0x49, 0xC2, 0xFC, 0x4E, 0xCF, 0xDF, 0x5E, 0x36, 0xD9, 0xD9, 0xAD, 0x9A,
+    0xAC, 0x53, 0xBE, 0xE8, 0x54, 0xD0, 0x4E, 0x79, 0x5D, 0xA9, 0x6E, 0xBE, 0x3F, 0x0A, 0x0A, 0x4A,
+    0x53, 0xC0, 0x8B, 0x65, 0x8E, 0xAD, 0xC2, 0x6A, 0x69, 0x94, 0x38, 0x9F, 0xCF, 0x5A, 0x25, 0xAB,
+    0xF1, 0x28, 0x75, 0x5E, 0xCC, 0xDA, 0x2F, 0xE4, 0x33, 0xAF, 0x97, 0xEB, 0x00, 0xB1, 0x37, 0x6A,
+    0x12, 0x90, 0x5A, 0x20, 0x52, 0x2F, 0xD4, 0xF5, 0x40, 0x36, 0x4C, 0x45, 0x8A, 0xB6, 0x80, 0x44,
+    0x4D, 0xEF, 0x9D, 0x7D, 0xA0, 0xE0, 0x49, 0x49, 0xDC, 0xA3, 0xDB, 0x91, 0x68, 0x3D, 0x75, 0x50,
+    0xBC, 0x3E, 0xFC, 0x6A, 0xFF, 0x40, 0x50, 0xDE, 0xD6, 0x39, 0xAE, 0xBB, 0x84, 0x85, 0x96, 0xC4,
+    0xC3, 0xF6, 0xBC, 0x1B, 0x59, 0xE2, 0x0A, 0xD2, 0xA1, 0x9C, 0x57, 0x7D, 0x37, 0x4E, 0x4E, 0xC7,
+    0x24, 0x8E, 0x5D, 0x52, 0x17, 0x4F, 0xC7, 0x6E, 0x1A, 0xA6, 0x69, 0xCF, 0xCD, 0x84, 0x2A, 0x4F,
+    0x78, 0xDA, 0xC4, 0x1F, 0x80, 0x55, 0x47, 0xAC, 0xFA, 0x82, 0x58, 0x91, 0x22, 0xD2, 0x73, 0x97,
+    0xE1, 0x02, 0xE0, 0xF2, 0xAC, 0xE7, 0x12, 0xB1, 0x5C, 0xC9, 0x6A, 0xA4, 0x06, 0xE7, 0xA9, 0xF9,
+    0xF3, 0xD4, 0xA6, 0xA9, 0x8F, 0xD4, 0xA8, 0x45, 0xEE, 0x00, 0x9D, 0x28, 0x09, 0xB1, 0x5B, 0x89,
+    0x86, 0x2C, 0xB5, 0xC3, 0x29, 0x0F, 0xB3, 0x0B, 0x66, 0x02, 0x66, 0x83, 0xBA, 0x63, 0x82, 0x3A,
+    0xB6, 0x9A, 0xE4, 0x17, 0xAE, 0xC5, 0xB7, 0x63, 0x03, 0x92, 0x21, 0x8E, 0xA3, 0x79, 0xFB, 0xFE,
+    0x64, 0x41, 0x66, 0xB3, 0xCA, 0x35, 0x57, 0xBF, 0x94, 0x1F, 0x8B, 0x19, 0x3A, 0xFD, 0x1B, 0xF5,
+    0x06, 0xAA, 0x05, 0x47, 0xFF, 0x8E, 0xE9, 0x95, 0xCA, 0x47, 0xD7, 0x74, 0x2A, 0xD8, 0x5A, 0x77,
+    0x80, 0xB5, 0xF6, 0xA4, 0xAC, 0x0E, 0x19, 0xC1, 0xC0, 0x80, 0x02, 0x1B, 0x83, 0xCB, 0x04, 0xF6,
+    0xE6, 0x61, 0x63, 0x0C, 0x3E, 0x6E, 0xCD, 0x3A, 0xC3, 0x1A, 0xDE, 0x6C, 0xCD, 0x32, 0x16, 0xAD,
+    0xD9, 0x22, 0xB0, 0x37, 0x06, 0xDD, 0xDA, 0xCD, 0x5E, 0x3B, 0x7B, 0x8F, 0x8A, 0x84, 0x2A, 0x93,
+    0x0F, 0x1A, 0xC8, 0x79, 0x5B, 0x45, 0x2D, 0x32, 0xDE, 0x76, 0x39, 0x83, 0xF0, 0x6F, 0xBB, 0xAB,
+    0x9A, 0x37, 0x10, 0x03, 0x1B, 0x79, 0x27, 0x48, 0x63, 0xCC, 0x49, 0x64, 0xF3, 0x8C, 0x54, 0x36,
+    0x6E, 0x8A, 0x87, 0xE2, 0xFE, 0xB1, 0xDB, 0x41, 0x23, 0xF6, 0x5F, 0xB9, 0xDD, 0x91, 0x16, 0x0F,
+    0xBE, 0x76, 0xF3, 0xF3, 0x33, 0xC4, 0x23, 0x80, 0xB4, 0xA1, 0x43, 0x65, 0x5A, 0x6C, 0x3D, 0x0D,
+    0x56, 0xED, 0xBF, 0x08, 0x26, 0x02, 0xB5, 0xA8, 0x9F, 0xE1, 0x03, 0x5D, 0xFF, 0x01, 0xAD, 0x55,
+    0x31, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xDB, 0xBA, 0x67, 0x09, 0x4B, 0x6C, 0x03, 0x4D, 0x52, 0xB8,
+    0x47, 0x48, 0xFE, 0x05, 0x68, 0x8D, 0x28, 0x52, 0xA4, 0xB8, 0x14, 0xBC, 0x06, 0x8A, 0xF4, 0x50,
+    0xDC, 0x1F, 0x20, 0x6F, 0x1D, 0x51, 0x20, 0x41, 0x71, 0xD7, 0x53, 0x70, 0xC5, 0x21, 0xA1, 0x20,
+    0xB8, 0xF6, 0x8A, 0xDC, 0x5B, 0x4B, 0x57, 0xA4, 0xB8, 0x22, 0x0E, 0x01, 0x5D, 0x41, 0x63, 0x48,
+    0xAA, 0x5C, 0x91, 0x4D, 0xF0, 0xC1, 0x5E, 0xB2, 0xDE, 0xE1, 0x1B, 0xBF, 0x20, 0x1E, 0x27, 0x22,
+    0x14, 0x89, 0xD5, 0x5B, 0xEB, 0x79, 0xBD, 0x3B, 0xF3, 0xCD, 0x37, 0xDF, 0xCC, 0x12, 0x61, 0xE4,
+    0xFD, 0x82, 0xC8, 0x70, 0x47, 0x19, 0x07, 0xA2, 0x62, 0xA4, 0xB5, 0x51, 0xB5, 0x44, 0x19, 0x56,
+    0xC9, 0xF4, 0xF8, 0xC4, 0xF8, 0xC3, 0x03, 0x51, 0xF9, 0x55, 0x43, 0xD9, 0x80, 0x65, 0xA3, 0x7A,
+    0x2A, 0x9C, 0x21, 0x1A, 0xB3, 0x81, 0xCA, 0x56, 0x37, 0x19, 0xC3, 0x86, 0x66, 0xEE, 0x0A, 0x66,
+    0x26, 0x4C, 0x57, 0xF6, 0x64, 0x3E, 0x1D, 0x29, 0x0F, 0xBA, 0x25, 0xDD, 0xC1, 0xC0, 0x61, 0xDE,
+    0xC3, 0x99, 0xE6, 0x76, 0xDD, 0x53, 0x7A, 0x3E, 0x28, 0x1E, 0xF4, 0xBE, 0x7F, 0x27, 0xF5, 0xB7,
+    0x93, 0x70, 0x40, 0x61, 0xA0, 0x70, 0x90, 0x04, 0xCB, 0x41, 0xF3, 0x58, 0xF1, 0x38, 0x1B, 0x17,
+    0x54, 0x15, 0x2D, 0xDC, 0xE2, 0x94, 0xDE, 0xEC, 0x28, 0x3F, 0x8F, 0x6B, 0x38, 0x53, 0xC1, 0x08,
+    0x0F, 0x94, 0xCB, 0xAA, 0x75, 0x44, 0x8A, 0x6B, 0x4A, 0xCE, 0xBD, 0x6C, 0x6E, 0x29, 0x77, 0x58,
+    0xB6, 0xB9, 0x23, 0xD5, 0xE9, 0x3A, 0x09, 0x99, 0x17, 0x8C, 0x2D, 0xC0, 0x8E, 0x64, 0x81, 0x51,
+    0x01, 0x68, 0x12, 0x29, 0xF7, 0x00, 0x68, 0x8E, 0x02, 0x65, 0xE3, 0x6B, 0x37, 0xF7, 0x72, 0xB7,
+    0x4C, 0x01, 0x9A, 0x37, 0x9D, 0x3E, 0x09, 0x6B, 0xAE, 0x96, 0x37, 0x10, 0x57, 0x1D, 0x6D, 0x0F,
+    0xA8, 0x15, 0x99, 0xA2, 0x51, 0x47, 0x5D, 0xE6, 0x80, 0xB5, 0x62, 0x86, 0xC5, 0xCE, 0xF2, 0x20,
+    0x60, 0x69, 0xF6, 0xF9, 0x3E, 0x38, 0x4D, 0xA2, 0x30, 0x22, 0xEE, 0xB8, 0xA1, 0x9C, 0xA7, 0x90,
+    0xE1, 0x5A, 0xA8, 0xDD, 0x17, 0xAB, 0xD9, 0xD3, 0xE9, 0x65, 0x59, 0xCA, 0xA2, 0x6A, 0x65, 0x73,
+    0xEA, 0x95, 0xBC, 0x18, 0xE2, 0x1F, 0x25, 0x0C, 0x39, 0x9E, 0xF0, 0x74, 0x06, 0x56, 0xE2, 0xAD,
+    0xBD, 0x9C, 0x65, 0xB4, 0x4C, 0x42, 0x76, 0xD5, 0xCB, 0xEA, 0xFD, 0x20, 0x2F, 0xEB, 0x84, 0x08,
+    0xA3, 0xB6, 0x91, 0xC0, 0x9C, 0xDE, 0xE7, 0x7B, 0xE0, 0x95, 0xE7, 0x87, 0xB7, 0x61, 0x27, 0x1E,
+    0xC0, 0x7F, 0x1C, 0x08, 0x9B, 0x0F, 0x12, 0x24, 0x14, 0xF1, 0x3F, 0xFB, 0x5E, 0xE0, 0xC5, 0x4A,
+    0x1E, 0xB3, 0xD1, 0xF0, 0x43, 0x1C, 0x2F, 0xDA, 0x1B, 0x29, 0xC2, 0xD4, 0xDC, 0xA4, 0x20, 0x72,
+    0x7D, 0xC0, 0xE6, 0x11, 0xC2, 0x64, 0xDE, 0x45, 0xDE, 0x4B, 0xE1, 0x96, 0x92, 0x30, 0x09, 0xA8,
+    0xE4, 0x01, 0x11, 0x4A, 0x2A, 0x2C, 0xC2, 0xFB, 0x69, 0x0E, 0x0D, 0xFC, 0xC0, 0xEC, 0xE1, 0xA1,
+    0x7A, 0x11, 0xF2, 0xBB, 0x1E, 0x7B, 0x14, 0xF7, 0x17, 0x6D, 0x22, 0xC2, 0x65, 0x5D, 0x70, 0x5F,
+    0xDD, 0xF4, 0x7A, 0x7E, 0xDB, 0xF0, 0x68, 0x79, 0x04, 0x55, 0x4B, 0x98, 0x7D, 0xF4, 0x1D, 0x04,
+    0xA0, 0x78, 0x4C, 0x6C, 0x2F, 0xFB, 0x2E, 0xC7, 0x1A, 0x91, 0xF6, 0xA0, 0xCB, 0x19, 0xE6, 0x5F,
+    0xCE, 0x3E, 0x84, 0xE1, 0x44, 0x52, 0x8D, 0x78, 0xB2, 0x67, 0x88, 0xE0, 0x14, 0xF3, 0x3A, 0x88,
+    0xD1, 0xF3, 0xEB, 0x6E, 0x09, 0x20, 0xBC, 0xEF, 0x49, 0xB8, 0xDF, 0xEA, 0x57, 0x8E, 0xAE, 0xD1,
+    0x16, 0x37, 0x96, 0x9D, 0x65, 0xBF, 0x93, 0x03, 0xEA, 0x61, 0x32, 0x3F, 0x64, 0x71, 0x18, 0x6E,
+    0xCC, 0x83, 0xBE, 0x02, 0x2D, 0x74, 0xE9, 0x44, 0x64, 0x3A, 0x1C, 0x92, 0xBA, 0x3F, 0x90, 0xDE,
+    0xEE, 0x29, 0xEA, 0x66, 0x1D, 0xAB, 0x7D, 0x08, 0xD2, 0xA3, 0x24, 0x05, 0xB9, 0x88, 0xE5, 0xDC,
+    0xC2, 0x4E, 0x29, 0x75, 0x01, 0x1F, 0x60, 0x9B, 0x23, 0x42, 0x3E, 0xC3, 0xD7, 0xA3, 0xB3, 0x39,
+    0x17, 0x7D, 0xE1, 0xD4, 0x33, 0x46, 0x2A, 0x3C, 0xCD, 0xE2, 0xAB, 0x60, 0x28, 0x3F, 0xEB, 0xF1,
+    0xAB, 0x8E, 0x9D, 0xBE, 0x0B, 0x3D, 0x2F, 0x4A, 0xA1, 0xAC, 0xF8, 0xD5, 0x4F, 0x0A, 0x12, 0xA9,
+    0x93, 0xFA, 0x2D, 0xD0, 0x7F, 0x0F, 0xD3, 0x42, 0x93, 0x4D, 0x16, 0xD5, 0xA8, 0xA0, 0x7F, 0xC7,
+    0x47, 0x20, 0xD6, 0x6E, 0x07, 0x83, 0x5A, 0x0A, 0xF6, 0xAE, 0xA0, 0x3E, 0x1D, 0x05, 0x17, 0x5B,
+    0xC9, 0x11, 0xC8, 0x1D, 0x24, 0x53, 0xCC, 0x2B, 0xA5, 0x76, 0x53, 0xC6, 0xC5, 0x0F, 0xE4, 0xE0,
+    0xA6, 0xA5, 0x17, 0x4A, 0x04, 0xE9, 0x8A, 0xED, 0xE3, 0x11, 0x47, 0x8E, 0x03, 0x0F, 0x09, 0x0F,
+    0xD0, 0x45, 0x6F, 0xA2, 0x0A, 0x25, 0xE8, 0xA6, 0xA0, 0xC5, 0xC0, 0xEA, 0x39, 0x6A, 0x60, 0x4F,
+    0x46, 0x53, 0xBF, 0x14, 0xE4, 0x6C, 0xEF, 0xD2, 0xEE, 0x5B, 0x4D, 0x16, 0x4A, 0x67, 0x1A, 0xE2,
+    0xD2, 0xC1, 0xBB, 0xD9, 0x7E, 0x2A, 0xA5, 0x7E, 0xF7, 0x0F, 0x3F, 0x69, 0x0E, 0xBE, 0xF3, 0xC9,
+    0x75, 0x2A, 0xD9, 0x14, 0x1C, 0xF4, 0xD7, 0xFF, 0xD5, 0x57, 0x23, 0xD5, 0x9C, 0xF2, 0xE3, 0xE7,
+    0x5C, 0x2B, 0xDE, 0xFA, 0x9D, 0x7B, 0x3D, 0x56, 0xDE, 0x06, 0xAD, 0xDA, 0xA0, 0xD1, 0x35, 0xCA,
+    0x93, 0xE1, 0x9F, 0x2E, 0x37, 0x76, 0x32, 0x46, 0xA5, 0xF9, 0x37, 0x32, 0x07, 0xB5, 0x93, 0x49,
+    0x44, 0xBD, 0xF5, 0x86, 0x6D, 0x08, 0x68, 0x97, 0xD7, 0xB2, 0xF3, 0x68, 0x4F, 0x98, 0xA1, 0xD7,
+    0xCB, 0x91, 0xB4, 0x3A, 0x72, 0x41, 0x6F, 0x9E, 0x4C, 0x3D, 0xA7, 0xEA, 0xF2, 0xC7, 0x0D, 0xBD,
+    0x4D, 0x59, 0xAB, 0x06, 0x02, 0x0B, 0x9F, 0x24, 0x59, 0x6B, 0x42, 0xC1, 0xCD, 0xC7, 0x3B, 0x13,
+    0xA2, 0x82, 0xC7, 0x4B, 0xDF, 0x0E, 0x68, 0x9D, 0xA8, 0x04, 0xDD, 0x42, 0x9C, 0x39, 0x37, 0x1B,
+    0x88, 0x1D, 0x54, 0x84, 0xD7, 0x8B, 0x27, 0xCC, 0x77, 0x78, 0xCC, 0xB9, 0x4F, 0xBE, 0xA6, 0x57,
+    0xDA, 0xBE, 0x47, 0x1B, 0x1F, 0x7C, 0x43, 0xE5, 0xD4, 0x5F, 0x47, 0x7A, 0xF3, 0x25, 0x44, 0x2E,
+    0xA5, 0xFD, 0x21, 0xCD, 0x96, 0x2A, 0xF4, 0x65, 0x8D, 0x69, 0x31, 0x51, 0x2C, 0x29, 0x0F, 0x26,
+    0x43, 0x8B, 0xBD, 0xFA, 0x7C, 0xD0, 0x9B, 0xA7, 0x5E, 0x5F, 0x3F, 0xF6, 0xDA, 0x7E, 0xE1, 0x35,
+    0x6F, 0x62, 0xAA, 0xA0, 0x47, 0xCC, 0x80, 0xE9, 0x55, 0xA8, 0x9C, 0x0A, 0x34, 0xDF, 0xD5, 0xEC,
+    0x0D, 0x87, 0xF9, 0xFB, 0x7F, 0x1B, 0x0F, 0x34, 0x86, 0x34, 0x86, 0x3C, 0x06, 0x15, 0x43, 0x15,
+    0x83, 0x59, 0x84, 0xB8, 0x88, 0x61, 0xC1, 0xC3, 0x02, 0x99, 0xE7, 0xD6, 0x72, 0x6D, 0x6F, 0xD1,
+    0x47, 0xF9, 0xBD, 0x61, 0x12, 0xAA, 0x7A, 0xE0, 0xFF, 0x55, 0xA3, 0xFF, 0x17, 0x46, 0x24, 0x05,
+    0xBF, 0xF2, 0x8E, 0xAB, 0x7E, 0x1E, 0x5E, 0x09, 0x20, 0xF2, 0x89, 0xBE, 0xF5, 0x44, 0xBA, 0x16,
+    0x1A, 0x58, 0xF1, 0x74, 0x1D, 0x22, 0xB2, 0x0D, 0x41, 0x45, 0x11, 0x5B, 0x20, 0x6E, 0x4C, 0x5F,
+    0x75, 0xC4, 0xEF, 0x05, 0x5C, 0x0E, 0x92, 0x93, 0x63, 0x87, 0xAB, 0x06, 0xDD, 0xAD, 0x3C, 0x96,
+    0xAE, 0x27, 0x6D, 0xEE, 0xD8, 0xA3, 0x8E, 0xCC, 0xD9, 0x4C, 0x9A, 0x22, 0x7B, 0xE9, 0xA1, 0xB5,
+    0x34, 0xDD, 0xE9, 0x22, 0x9C, 0xF1, 0xF9, 0xCA, 0x28, 0xFC, 0xA9, 0x3B, 0x0E, 0x1E, 0xA7, 0xC3,
+    0x17, 0xC7, 0x65, 0x69, 0x27, 0xAD, 0x3E, 0xF5, 0xB8, 0x41, 0xAF, 0x76, 0xC5, 0x83, 0x21, 0xF1,
+    0x87, 0xB4, 0xAC, 0x3A, 0x73, 0x85, 0x05, 0x72, 0xAF, 0x20, 0xEF, 0x2D, 0x68, 0x6B, 0x6B, 0x90,
+    0xF2, 0xAC, 0xE5, 0x76, 0xA8, 0xCE, 0x8C, 0xD3, 0xD0, 0x9F, 0x69, 0x72, 0x6F, 0xEB, 0x3C, 0xC0,
+    0xE5, 0x6A, 0x3E, 0xFA, 0x32, 0xD8, 0xA6, 0x08, 0xE6, 0x7C, 0x0B, 0x94, 0xF1, 0x50, 0xAD, 0x6E,
+    0x37, 0xB9, 0xEA, 0x6A, 0x39, 0x7F, 0x61, 0xFC, 0x09, 0xB5, 0x54, 0x3D, 0x6C, 0xDD, 0x54, 0x18,
+    0x3D, 0xF6, 0x15, 0xB5, 0x14, 0x0B, 0x79, 0x42, 0x42, 0x20, 0xE4, 0x85, 0x29, 0x02, 0x79, 0xED,
+    0x90, 0xE4, 0xBA, 0xCA, 0x90, 0xA1, 0x03, 0x1D, 0xFA, 0xBA, 0xB2, 0x22, 0x06, 0xBA, 0x30, 0xBE,
+    0x57, 0x5B, 0x14, 0xA9, 0x03, 0x43, 0xD9, 0x59, 0x18, 0x29, 0x4B, 0x3A, 0x30, 0x26, 0xCF, 0x8E,
+    0x22, 0x94, 0x81, 0xA1, 0x86, 0x0C, 0x1D, 0x3A, 0xF4, 0x55, 0x61, 0x0A, 0xCB, 0x8D, 0x30, 0x92,
+    0x23, 0xAE, 0xFD, 0x71, 0x3E, 0x27, 0x21, 0x4D, 0x93, 0x02, 0x0B, 0x57, 0xF7, 0x7E, 0xF2, 0xF5,
+    0xF5, 0x3D, 0x3E, 0xE7, 0xFB, 0x0B, 0xE6, 0x79, 0x22, 0x2E, 0xFB, 0xAD, 0x2B, 0xE0, 0xB7, 0xB1,
+    0x5D, 0xC9, 0x20, 0x32, 0x54, 0x37, 0x86, 0x42, 0x7A, 0x2B, 0x1D, 0x8F, 0x82, 0x79, 0x1E, 0x74,
+    0xF7, 0xA0, 0x2B, 0xF4, 0x15, 0x8C, 0x17, 0xFC, 0x3D, 0xEE, 0xB6, 0x30, 0x22, 0x04, 0x90, 0x3A,
+    0xFB, 0xA3, 0x70, 0xB6, 0x4E, 0xDA, 0xA2, 0x8C, 0xBA, 0x2A, 0x8F, 0xBC, 0x88, 0x9C, 0xAC, 0xC3,
+    0x6F, 0x7C, 0x55, 0xC6, 0xBE, 0x38, 0xBE, 0xDB, 0x59, 0x91, 0x36, 0x13, 0x71, 0xFA, 0xBD, 0xDE,
+    0xD3, 0xFB, 0xC9, 0xAE, 0xE3, 0x4C, 0xF7, 0x5C, 0xF6, 0xAC, 0x3D, 0x01, 0x0D, 0xFE, 0x03, 0x23,
+    0x78, 0x0B, 0x5D, 0x81, 0x2F, 0x10, 0xF4, 0x55, 0x8E, 0xAB, 0xC6, 0x19, 0xBB, 0x41, 0x6A, 0x32,
+    0x73, 0x16, 0xA6, 0xFD, 0x94, 0x1A, 0x30, 0xB9, 0xE3, 0x41, 0x66, 0xE3, 0x22, 0x02, 0xF8, 0x4E,
+    0x9A, 0xD8, 0x57, 0x22, 0x5D, 0x41, 0x86, 0xF6, 0x94, 0x61, 0x50, 0x1D, 0x8F, 0x30, 0x36, 0xD9,
+    0xF1, 0x45, 0x74, 0xE4, 0xB3, 0x9F, 0x1C, 0x77, 0xD7, 0x6E, 0x19, 0x69, 0xDF, 0x0C, 0x5B, 0x84,
+    0x0E, 0x51, 0xB3, 0xBC, 0x59, 0xCA, 0x40, 0xDF, 0xE4, 0xC9, 0xFE, 0xE1, 0x90, 0x8A, 0x7B, 0x57,
+    0xAF, 0xBC, 0x01, 0x2B, 0x2E, 0xE6, 0x9F, 0x0F, 0xBF, 0xBF, 0x7D, 0x89, 0x54, 0xF8, 0x2D, 0xBE,
+    0xB3, 0x25, 0x21, 0x03, 0x9F, 0x2C, 0xB2, 0xBC, 0x58, 0x77, 0x86, 0x1A, 0xD2, 0x67, 0x0D, 0xC8,
+    0x26, 0x92, 0x1A, 0xB6, 0x43, 0x40, 0x17, 0x27, 0xFC, 0xD9, 0x00, 0xA4, 0x35, 0x36, 0x3D, 0x52,
+    0xC9, 0x03, 0x59, 0x20, 0xFD, 0x95, 0x00, 0x93, 0x47, 0x24, 0xBE, 0x48, 0x45, 0x30, 0xC1, 0xD5,
+    0xA3, 0xA2, 0x53, 0xDB, 0xB0, 0xCB, 0x6A, 0x9B, 0xF7, 0xC6, 0xC5, 0xEE, 0x1E, 0xEC, 0xC3, 0x26,
+    0xEC, 0x3D, 0x12, 0x29, 0x51, 0xA9, 0x53, 0x28, 0xCA, 0xD1, 0x6F, 0x23, 0xBC, 0xF1, 0x78, 0x47,
+    0xCA, 0x50, 0x1C, 0xB2, 0x1E, 0x21, 0x7F, 0xA9, 0x91, 0x4E, 0x1F, 0x2C, 0x34, 0xD8, 0xF6, 0x89,
+    0xBB, 0x08, 0x6D, 0x11, 0xEF, 0x77, 0xF0, 0x69, 0x9D, 0x96, 0x12, 0xB6, 0x51, 0x6B, 0x61, 0xF7,
+    0x5C, 0x30, 0x6C, 0x13, 0xBA, 0x46, 0xE1, 0x09, 0x5D, 0x22, 0xE5, 0x1D, 0x15, 0xB0, 0x50, 0xDF,
+    0x2E, 0xD1, 0x8F, 0xD2, 0x22, 0xA5, 0x93, 0x86, 0x1C, 0xC6, 0x79, 0xBA, 0xB3, 0x36, 0x6D, 0x8F,
+    0xE2, 0xE3, 0xE6, 0x12, 0xF1, 0xD8, 0x31, 0xA6, 0x79, 0xF6, 0x85, 0x37, 0x6D, 0xD2, 0x58, 0x54,
+    0xD1, 0xC2, 0x74, 0x3D, 0xB2, 0xE7, 0x35, 0xA4, 0x43, 0xCC, 0x7C, 0x21, 0x6B, 0x25, 0x9F, 0x36,
+    0x63, 0xD8, 0x6C, 0x1D, 0x6C, 0x76, 0xC8, 0x04, 0xA1, 0x34, 0xC8, 0x16, 0x04, 0x58, 0xC6, 0x52,
+    0x99, 0x12, 0x3E, 0x76, 0x41, 0x4F, 0x5D, 0x57, 0xE5, 0xC5, 0x32, 0xAE, 0x95, 0xA6, 0x05, 0x7D,
+    0x5A, 0x53, 0xFC, 0xC0, 0x40, 0x46, 0xCC, 0x0C, 0x95, 0x41, 0x87, 0xCC, 0x31, 0x0A, 0x51, 0x25,
+    0xA3, 0x94, 0x51, 0x8B, 0x8A, 0x51, 0x35, 0xE3, 0x3F, 0xA9, 0x07, 0x2A, 0x48, 0x15, 0x8D, 0x92,
+    0x78, 0x35, 0x8F, 0x17, 0x51, 0x8B, 0x9E, 0x7E, 0x4F, 0x9B, 0xA5, 0xAF, 0x83, 0x47, 0xC0, 0xEB,
+    0x03, 0x53, 0xF3, 0xBB, 0x39, 0x13, 0x8E, 0x14, 0x28, 0xB2, 0x86, 0x46, 0x07, 0xC9, 0x01, 0x01,
+    0x55, 0x26, 0xEC, 0xA0, 0x9F, 0x69, 0x21, 0x28, 0x0D, 0xD5, 0x8A, 0x48, 0x77, 0xA4, 0x3A, 0xF2,
+    0x50, 0xC1, 0xF4, 0x04, 0x77, 0x0C, 0x16, 0xBF, 0x2C, 0x95, 0xDA, 0xC5, 0x0A, 0xFA, 0x10, 0xD3,
+    0x55, 0x6C, 0x71, 0xAE, 0xE8, 0xF4, 0x53, 0xCE, 0xC0, 0xDB, 0x0D, 0x6F, 0xC5, 0xA7, 0xB2, 0x15,
+    0x1D, 0xCF, 0x80, 0xF3, 0xB9, 0x96, 0x3C, 0x38, 0xF2, 0x55, 0xF6, 0xE4, 0x77, 0xAD, 0x82, 0xFA,
+    0xF1, 0x07, 0xB1, 0x29, 0x1F, 0x5F, 0x4F, 0xD6, 0x77, 0x58, 0xA6, 0xB9, 0xFC, 0x80, 0x28, 0xC7,
+    0xE7, 0x88, 0x73, 0x56, 0x5E, 0xA5, 0x73, 0x98, 0xAB, 0x86, 0xF3, 0x29, 0x97, 0x67, 0x0E, 0xC6,
+    0x82, 0xD3, 0x8C, 0xD3, 0xCA, 0x43, 0x39, 0x68, 0xD0, 0x62, 0x15, 0x49, 0xCE, 0x7D, 0x87, 0x35,
+    0xBA, 0x80, 0x8A, 0xDE, 0x53, 0x68, 0x6C, 0x65, 0xE4, 0xDB, 0x5B, 0x3E, 0x0D, 0xB6, 0x3C, 0x35,
+    0xFF, 0x30, 0x34, 0x61, 0x69, 0x6E, 0xA9, 0xE9, 0x4E, 0x0D, 0x5E, 0x31, 0xBE, 0x67, 0xC9, 0xB1,
+    0xF1, 0x94, 0xE8, 0x59, 0x25, 0xE8, 0x3D, 0x73, 0xAA, 0xF7, 0xC6, 0x61, 0xA0, 0xCB, 0x83, 0xC1,
+    0x47, 0xCC, 0x56, 0xD6, 0xB7, 0x9A, 0x26, 0x64, 0x5F, 0x61, 0xEE, 0x04, 0xED, 0x36, 0xC2, 0x6E,
+    0x0E, 0xD3, 0x0D, 0x17, 0xBB, 0xDB, 0xF9, 0xF8, 0x84, 0x6B, 0xEB, 0x7D, 0xAE, 0xEB, 0xC0, 0xF4,
+    0xE5, 0xC5, 0x62, 0x9D, 0x5A, 0xC1, 0x74, 0x25, 0xCD, 0x67, 0x2B, 0x09, 0x57, 0x96, 0x6F, 0x73,
+    0x3F, 0xE7, 0xFB, 0x79, 0xC6, 0x8A, 0x80, 0xD5, 0x64, 0x2B, 0x72, 0xCB, 0x14, 0x56, 0xFA, 0xC2,
+    0x3C, 0x0A, 0x7B, 0xD1, 0xD0, 0x32, 0x56, 0x5A, 0xEE, 0x48, 0x54, 0x55, 0xC6, 0x3C, 0x0B, 0x58,
+    0x82, 0x4C, 0x3F, 0x26, 0x1A, 0xB9, 0x21, 0xEA, 0xB5, 0x17, 0xBC, 0x90, 0x2F, 0x8D, 0x84, 0xE2,
+    0xB3, 0xD6, 0xC8, 0xB1, 0xD4, 0xB1, 0x9E, 0xC6, 0x27, 0x6D, 0x69, 0x0D, 0x53, 0xB4, 0x49, 0x1E,
+    0xEF, 0x3A, 0xD8, 0x2D, 0x5E, 0x2E, 0xC7, 0x96, 0xC1, 0xA8, 0xA4, 0x1D, 0xD1, 0x1B, 0xF4, 0x05,
+    0xB2, 0x5D, 0xD9, 0x70, 0x09, 0x43, 0xFB, 0x99, 0x5E, 0x78, 0x6B, 0x72, 0x47, 0xE4, 0x4F, 0x36,
+    0xB6, 0x97, 0x1E, 0x26, 0x93, 0x8F, 0xD8, 0xA4, 0x0F, 0xB8, 0xD4, 0x79, 0x74, 0x88, 0x3C, 0xE7,
+    0x62, 0x17, 0xEC, 0xCF, 0x8B, 0x92, 0x2F, 0xA4, 0x57, 0x33, 0x9E, 0x69, 0xCF, 0xFC, 0xB7, 0xB3,
+    0x35, 0x73, 0xB0, 0x58, 0x3B, 0x33, 0xCD, 0xEA, 0xAA, 0xD9, 0x3F, 0x35, 0x33, 0xF3, 0xB4, 0x99,
+    0xCD, 0xA2, 0xA7, 0xF5, 0x6C, 0x1A, 0xED, 0xD5, 0xD3, 0x53, 0x53, 0x93, 0xC6, 0xE4, 0xA6, 0x5E,
+    0x67, 0x0B, 0x56, 0x97, 0x9C, 0x83, 0x8F, 0x6F, 0x7E, 0xE4, 0xF1, 0x6D, 0x92, 0xDB, 0xE8, 0x13,
+    0x97, 0x35, 0x45, 0x2D, 0x86, 0x55, 0x52, 0xBC, 0x90, 0x0D, 0x9F, 0x2E, 0x64, 0xDD, 0xAB, 0xEF,
+    0xAA, 0x5F, 0x24, 0xF2, 0x59, 0x43, 0x63, 0x17, 0xAF, 0x7E, 0x89, 0xB8, 0xB7, 0xAE, 0xF8, 0x59,
+    0x8C, 0xD7, 0x97, 0x72, 0x43, 0xE2, 0x2E, 0x71, 0x3C, 0xBB, 0x3F, 0xA6, 0x93, 0x7C, 0xD5, 0xA7,
+    0x6D, 0xB1, 0xC3, 0x9B, 0xE9, 0xA2, 0xBA, 0xCF, 0x7B, 0x76, 0x47, 0x62, 0xAF, 0xDD, 0xE4, 0x02,
+    0xA6, 0xA2, 0x64, 0xAF, 0x41, 0x09, 0x78, 0xC8, 0x3E, 0x4A, 0x1A, 0xDA, 0x94, 0xA0, 0x45, 0x7E,
+    0xB6, 0xE9, 0x23, 0x91, 0x5D, 0x91, 0x23, 0xB9, 0x74, 0x72, 0xB2, 0x21, 0x70, 0xA7, 0xA1, 0x44,
+    0x5A, 0x22, 0x62, 0xC3, 0x3C, 0xD9, 0xC4, 0xAC, 0x03, 0x9E, 0xBC, 0x0D, 0x85, 0xFE, 0x9F, 0xC7,
+    0x5F, 0xB5, 0x55, 0xBD, 0x6F, 0x1D, 0x45, 0x10, 0x9F, 0xBB, 0x0B, 0x3E, 0xE4, 0x8D, 0xB3, 0x69,
+    0x42, 0x61, 0x08, 0x27, 0x21, 0x8A, 0x10, 0x25, 0x39, 0x0A, 0x0A, 0x4B, 0xC1, 0xDE, 0x8D, 0x5D,
+    0x44, 0x22, 0x88, 0xA4, 0x01, 0x0A, 0xFE, 0x00, 0xA2, 0x08, 0x09, 0x8A, 0x14, 0x41, 0x8A, 0x73,
+    0x67, 0x5C, 0x04, 0x41, 0x91, 0x27, 0x21, 0xD1, 0xE2, 0xC2, 0x45, 0x64, 0x21, 0x21, 0x20, 0x20,
+    0x0A, 0xC7, 0xB7, 0xF6, 0x2B, 0x5C, 0x50, 0x64, 0x49, 0x0A, 0x90, 0x48, 0xC4, 0x42, 0x24, 0x84,
+    0x94, 0x20, 0x36, 0xCE, 0x15, 0x27, 0x79, 0xEF, 0x86, 0x99, 0x7B, 0xF9, 0xE2, 0xAB, 0x64, 0xF5,
+    0xEE, 0x76, 0x77, 0xF6, 0x66, 0xF6, 0x37, 0x33, 0xBF, 0x99, 0x07, 0x93, 0x00, 0xA9, 0x85, 0xB8,
+    0x06, 0xB8, 0x0C, 0x90, 0x6B, 0x10, 0xA3, 0xCD, 0x2A, 0x08, 0xEC, 0x04, 0xE2, 0x10, 0xB1, 0xA6,
+    0x0D, 0x28, 0x00, 0x69, 0x20, 0xF1, 0x00, 0x01, 0xC6, 0xAB, 0xCB, 0x29, 0xE2, 0x22, 0xA2, 0xA7,
+    0xCD, 0x5F, 0x4E, 0x20, 0x03, 0x88, 0x0D, 0xC0, 0xF3, 0x00, 0x3B, 0x80, 0x47, 0xBC, 0xB2, 0xB2,
+    0x04, 0x88, 0x01, 0x14, 0xA2, 0xCE, 0x10, 0x2D, 0x29, 0x36, 0x31, 0x62, 0x47, 0x42, 0x34, 0x24,
+    0xF4, 0x92, 0x4E, 0x49, 0x88, 0xB3, 0xF4, 0x58, 0x7A, 0x1A, 0x12, 0x76, 0x24, 0xC4, 0x4D, 0x7A,
+    0xB6, 0x90, 0x75, 0x23, 0x27, 0xEA, 0x3C, 0x54, 0x5B, 0x5D, 0x5A, 0x02, 0x8C, 0x2F, 0x84, 0x7C,
+    0xD8, 0x2A, 0x7B, 0x7F, 0x9E, 0x84, 0xE7, 0xA2, 0x65, 0x55, 0x56, 0x71, 0xA3, 0x4A, 0x4C, 0x42,
+    0x61, 0x46, 0xAF, 0xA3, 0xE1, 0x89, 0x6D, 0x02, 0x02, 0x27, 0x00, 0x12, 0x27, 0x4A, 0x61, 0x26,
+    0x06, 0x52, 0x3F, 0xB9, 0xA4, 0x60, 0xEF, 0xD2, 0x3C, 0x48, 0x1B, 0x40, 0xBC, 0x47, 0x5E, 0xA6,
+    0xAE, 0x07, 0x0F, 0x59, 0xD9, 0xFB, 0xC1, 0x21, 0x88, 0xC2, 0xC9, 0x93, 0x49, 0x7D, 0xFD, 0x87,
+    0xD4, 0xDF, 0xFE, 0x4D, 0x9A, 0xDB, 0xB7, 0xF3, 0xF2, 0xCC, 0x99, 0xFD, 0xBD, 0x2F, 0x32, 0xC8,
+    0x46, 0xD6, 0xD2, 0x67, 0x3E, 0x77, 0xCA, 0xB2, 0x44, 0x79, 0x34, 0xB8, 0xD8, 0x25, 0x2D, 0x8B,
+    0x95, 0x29, 0x36, 0xBA, 0xB8, 0xA3, 0x65, 0x5D, 0x98, 0x5E, 0xC1, 0x1D, 0x4C, 0xF5, 0x9A, 0x1C,
+    0x7A, 0x25, 0xBE, 0x6B, 0xF2, 0x39, 0x17, 0xE4, 0xAC, 0x3F, 0xDB, 0x1F, 0x90, 0x47, 0x2A, 0x6A,
+    0x84, 0x99, 0xE9, 0x43, 0xB4, 0x61, 0xD7, 0x54, 0xB2, 0x55, 0xCB, 0x0B, 0xE6, 0xEC, 0xF4, 0xE8,
+    0x18, 0xD2, 0xD8, 0xEE, 0x4B, 0x7D, 0xC8, 0x75, 0x9B, 0x9F, 0xF7, 0x64, 0xE1, 0x5C, 0x54, 0x4F,
+    0x8B, 0x91, 0xD1, 0x7D, 0x00, 0x2D, 0x24, 0xA8, 0xE5, 0x1F, 0xAE, 0xD8, 0x0C, 0xEC, 0xA1, 0xD0,
+    0x2D, 0x39, 0x24, 0x5C, 0xE6, 0xA4, 0x97, 0x46, 0x52, 0xE4, 0x63, 0x10, 0x3A, 0x2F, 0xF3, 0x32,
+    0x33, 0x6A, 0x2E, 0xA8, 0xF5, 0x26, 0x29, 0x1F, 0xA7, 0x0F, 0xC7, 0x35, 0xDF, 0xCC, 0x2A, 0x90,
+    0xB3, 0xAD, 0x84, 0xF3, 0x55, 0x2B, 0x8B, 0xBA, 0x32, 0xA0, 0x6C, 0x82, 0x20, 0x1B, 0x72, 0x92,
+    0x66, 0x28, 0x1C, 0x89, 0x62, 0xFC, 0xAC, 0x06, 0x25, 0x29, 0x1B, 0xDF, 0xD7, 0x0A, 0x4D, 0x57,
+    0x1C, 0x41, 0x9F, 0xDD, 0x6A, 0x24, 0x46, 0x78, 0x6A, 0x0E, 0xC3, 0xE4, 0x00, 0x98, 0x01, 0x9C,
+    0xD9, 0x92, 0xC8, 0xF2, 0x76, 0x47, 0x0A, 0x8E, 0xC8, 0x52, 0x90, 0x05, 0x9B, 0x21, 0x64, 0x98,
+    0xA2, 0x85, 0x2A, 0xDC, 0x73, 0x69, 0x6C, 0xC0, 0xEF, 0xAA, 0x0F, 0xA4, 0xE7, 0x37, 0x3E, 0x5C,
+    0x6A, 0x01, 0xAB, 0xD2, 0x04, 0xFE, 0xAD, 0x87, 0x6C, 0x3D, 0xE4, 0x1B, 0x4D, 0x56, 0x4E, 0x81,
+    0x1E, 0x51, 0xE8, 0xA2, 0xDA, 0x6C, 0x8B, 0x1F, 0x3B, 0x74, 0xB0, 0x9B, 0x9C, 0x20, 0x81, 0x85,
+    0x7B, 0xBC, 0xAB, 0x5C, 0xD4, 0x13, 0xC7, 0x4F, 0xAB, 0xB5, 0x1D, 0xF2, 0x8A, 0x49, 0xEF, 0xFA,
+    0x28, 0xB4, 0x70, 0x4E, 0x41, 0xFE, 0x89, 0x11, 0xE8, 0x62, 0xC2, 0x57, 0x79, 0xC8, 0x1D, 0x88,
+    0x1A, 0xE2, 0x96, 0x14, 0x34, 0xDC, 0x0F, 0x71, 0x3F, 0xF6, 0x6B, 0x46, 0x40, 0x81, 0x88, 0x08,
+    0x4D, 0x65, 0x21, 0xAF, 0x41, 0x92, 0x1F, 0x2B, 0x1A, 0xF6, 0xBC, 0xFA, 0x1A, 0xE2, 0x36, 0x71,
+    0xF4, 0x50, 0x54, 0x23, 0xAE, 0x63, 0x1B, 0x55, 0x03, 0x78, 0x8C, 0xE2, 0x37, 0x55, 0xC2, 0x21,
+    0xD4, 0x50, 0x10, 0x7B, 0x0A, 0x0B, 0x29, 0xA1, 0xDA, 0xB9, 0xB5, 0x1B, 0xBE, 0x5C, 0x7C, 0xFF,
+    0x99, 0x6F, 0x7F, 0xFA, 0x8A, 0x34, 0x34, 0x1E, 0xED, 0x8E, 0x21, 0xFE, 0x3E, 0x73, 0xE3, 0x02,
+    0x08, 0x46, 0xDC, 0x8F, 0x64, 0x84, 0x39, 0xD3, 0xC4, 0x46, 0x2E, 0x2E, 0x66, 0x1C, 0x97, 0xCC,
+    0x7C, 0xCF, 0x3F, 0x2E, 0xB8, 0x62, 0xB4, 0x6A, 0x46, 0x05, 0xE5, 0xFA, 0x44, 0x29, 0x0D, 0x63,
+    0x4B, 0x0F, 0xC0, 0x52, 0x04, 0xA3, 0x65, 0xE8, 0xDD, 0xAA, 0xA9, 0x62, 0x16, 0x10, 0x5D, 0x75,
+    0xA4, 0xCD, 0x6D, 0x31, 0x5B, 0xA6, 0xDE, 0x45, 0xCD, 0xDF, 0x4A, 0xF1, 0xC1, 0x86, 0x2D, 0x51,
+    0xDC, 0x55, 0x09, 0xB9, 0x85, 0xCC, 0x83, 0x6A, 0x20, 0x6B, 0x41, 0x70, 0xBE, 0x34, 0x47, 0x44,
+    0x19, 0x0E, 0x0F, 0xB3, 0x61, 0xB4, 0xA1, 0xCB, 0x13, 0x32, 0x46, 0xF9, 0x7A, 0x16, 0xFE, 0x75,
+    0xB4, 0x3D, 0x32, 0xFE, 0x8C, 0x70, 0x77, 0x04, 0xBD, 0x64, 0xB3, 0xA2, 0x81, 0x68, 0x05, 0xE0,
+    0x94, 0x7E, 0x24, 0xE1, 0x9A, 0xD0, 0xC2, 0x44, 0xCA, 0x0C, 0xA9, 0x09, 0x2B, 0x64, 0x0C, 0x35,
+    0xAA, 0x19, 0x1C, 0x87, 0xC2, 0xC7, 0xFD, 0x32, 0xE7, 0x25, 0xDB, 0xAA, 0xD8, 0x6E, 0x6E, 0x69,
+    0x99, 0x37, 0x24, 0x27, 0x88, 0x04, 0x9F, 0x41, 0x31, 0x40, 0xF0, 0x40, 0x78, 0xE3, 0x7B, 0x94,
+    0x71, 0xFF, 0x85, 0xAC, 0x2A, 0x09, 0x18, 0x61, 0x21, 0x5C, 0x68, 0x08, 0x96, 0x0C, 0x8C, 0x0A,
+    0x99, 0xF0, 0x93, 0x17, 0xFB, 0x8F, 0xF4, 0xF8, 0x00, 0xA6, 0x0A, 0xAA, 0x20, 0x6A, 0x6D, 0x09,
+    0x0E, 0xAA, 0x68, 0x5B, 0x4B, 0x3B, 0x0F, 0x51, 0x43, 0x90, 0x0A, 0x6A, 0x7F, 0xD9, 0x46, 0x0D,
+    0xC2, 0x5D, 0x26, 0xEF, 0x94, 0x4E, 0x83, 0xB4, 0x79, 0x48, 0x6A, 0x19, 0xA0, 0xA5, 0x08, 0x09,
+    0x4D, 0x3C, 0x19, 0x28, 0xEE, 0x18, 0x94, 0xD0, 0x31, 0xFD, 0xE0, 0xE2, 0x78, 0x99, 0xA8, 0xD1,
+    0xA5, 0x84, 0x76, 0x9D, 0x7A, 0x9D, 0xAF, 0xB4, 0x0C, 0x5C, 0x51, 0x2F, 0x2D, 0xDF, 0x3F, 0x37,
+    0x0F, 0x1B, 0x0D, 0xB9, 0xDB, 0x37, 0x1B, 0xAE, 0xFE, 0x79, 0x98, 0x24, 0x36, 0x28, 0x4D, 0x4A,
+    0x0B, 0x0D, 0x14, 0xD4, 0x93, 0xAA, 0x21, 0xF9, 0xC7, 0x29, 0x14, 0xDC, 0x9B, 0xEC, 0x3F, 0xD5,
+    0x88, 0x28, 0xB0, 0x46, 0x21, 0x6A, 0x29, 0x49, 0x21, 0x69, 0xE2, 0x90, 0xD2, 0x7B, 0xEC, 0x22,
+    0xC7, 0x2F, 0x7D, 0x44, 0x2D, 0x33, 0xA3, 0x32, 0xA7, 0xB4, 0xF7, 0x37, 0x9D, 0x66, 0xCF, 0xE9,
+    0x11, 0xE5, 0x17, 0x8B, 0xAF, 0xEF, 0xBA, 0x7E, 0xF8, 0x9D, 0x5F, 0x86, 0xC8, 0x3A, 0xA0, 0x53,
+    0x3D, 0x9D, 0x9C, 0x3E, 0xE0, 0xD0, 0x3E, 0x0D, 0x53, 0x91, 0xC6, 0x61, 0xB9, 0x4B, 0x2B, 0x17,
+    0x6F, 0x1C, 0x97, 0x21, 0x2F, 0xA3, 0x13, 0x6A, 0xC3, 0x4C, 0xD0, 0xFE, 0xCE, 0xB5, 0xCD, 0x63,
+    0x61, 0x4C, 0xEF, 0x39, 0x41, 0x2D, 0x5C, 0x1F, 0x00, 0x9F, 0x98, 0x43, 0xD0, 0x30, 0xAB, 0xF3,
+    0xD9, 0x4D, 0xF1, 0x94, 0x74, 0x5F, 0x0F, 0x17, 0x2F, 0xB4, 0x19, 0xDD, 0x5D, 0xCC, 0x9D, 0xDF,
+    0x39, 0xF1, 0xC2, 0x99, 0xCA, 0xBD, 0xF9, 0xC1, 0xEA, 0xA8, 0x4B, 0xC2, 0x4C, 0x51, 0x2A, 0xAC,
+    0xD5, 0x76, 0x50, 0x7A, 0xB5, 0x80, 0xF9, 0x73, 0x30, 0x5F, 0xC0, 0x1A, 0xFD, 0x2A, 0xE8, 0x2A,
+    0x40, 0xFA, 0x21, 0x20, 0xC1, 0x1A, 0x7E, 0xF4, 0xCA, 0x8D, 0xC3, 0xA7, 0xB7, 0xAE, 0x61, 0xD2,
+    0x44, 0x10, 0xC1, 0x7C, 0x7C, 0x29, 0xA2, 0xBB, 0x0E, 0xC2, 0x25, 0x8A, 0xA5, 0xCF, 0xEC, 0x2D,
+    0x93, 0xEA, 0xBD, 0xE0, 0xE5, 0x42, 0x90, 0x9D, 0xAA, 0x33, 0xFB, 0xB1, 0x49, 0xF4, 0x5B, 0xD2,
+    0xC5, 0x57, 0xF1, 0x38, 0xB1, 0x15, 0x06, 0x69, 0x39, 0x93, 0x9C, 0x3D, 0xE0, 0xE9, 0x1F, 0x05,
+    0x5E, 0xA4, 0x84, 0x2F, 0x6A, 0xE9, 0xF7, 0xF8, 0xB9, 0x21, 0x0A, 0xCF, 0x81, 0x79, 0x77, 0xAE,
+    0x94, 0xF5, 0xCC, 0x25, 0x7F, 0x73, 0xF3, 0xC3, 0x30, 0x46, 0x21, 0xC1, 0x9F, 0xDF, 0x18, 0xB9,
+    0x91, 0xC1, 0x37, 0xEC, 0x86, 0x70, 0x9F, 0x5F, 0x1D, 0x1E, 0xFD, 0x54, 0xFA, 0x3B, 0x37, 0x87,
+    0x57, 0xBA, 0xF1, 0x81, 0xB0, 0xBF, 0x0E, 0x93, 0x97, 0x77, 0xCD, 0x34, 0xB9, 0x4B, 0x8E, 0x87,
+    0xC9, 0x92, 0x7B, 0x95, 0x11, 0x36, 0x25, 0x9E, 0x52, 0x3D, 0xB5, 0xCC, 0xDA, 0x52, 0xDA, 0x84,
+    0xFA, 0x0D, 0x25, 0x24, 0x2F, 0x85, 0xA3, 0xCA, 0xAD, 0x28, 0xE8, 0x94, 0x02, 0x3A, 0x2C, 0x85,
+    0x8F, 0x68, 0x32, 0x34, 0x21, 0xB5, 0xD6, 0x34, 0x10, 0x2D, 0xD9, 0x00, 0x15, 0x29, 0x71, 0x8A,
+    0x3F, 0xC9, 0x0C, 0x05, 0x7F, 0x8D, 0x27, 0xDE, 0xE5, 0xBA, 0x37, 0xB0, 0xC6, 0x46, 0x1D, 0x1D,
+    0xB0, 0x51, 0x65, 0xA4, 0x15, 0x3E, 0x09, 0x71, 0x4B, 0x36, 0x50, 0x17, 0x25, 0xFC, 0x1F, 0xE3,
+    0x4F, 0x95, 0x55, 0xBF, 0x6F, 0xDD, 0x54, 0x14, 0x3E, 0xB6, 0x49, 0xAD, 0x62, 0xD4, 0xDB, 0xA5,
+    0xAD, 0x44, 0x07, 0x77, 0xE8, 0x00, 0x45, 0xE4, 0xFE, 0x03, 0x49, 0xAE, 0x45, 0x11, 0x1D, 0x9B,
+    0x21, 0x9D, 0xDB, 0x81, 0xA1, 0x62, 0xE9, 0x3F, 0x90, 0xD4, 0x86, 0x85, 0x81, 0x21, 0x19, 0x2A,
+    0x31, 0x36, 0x03, 0x0C, 0x7D, 0x41, 0x74, 0x61, 0x78, 0x43, 0x12, 0xBB, 0x61, 0xE8, 0xD0, 0xA1,
+    0x86, 0x08, 0x18, 0x18, 0x6A, 0x14, 0xAA, 0x0A, 0x32, 0xC4, 0x52, 0x1C, 0x72, 0x9B, 0x67, 0xFB,
+    0xF0, 0x9D, 0xEB, 0x36, 0xB4, 0x82, 0x85, 0xAB, 0x77, 0xFC, 0xAE, 0xAF, 0x8F, 0xCF, 0x8F, 0xEF,
+    0x7C, 0xE7, 0x98, 0xE8, 0xFD, 0x19, 0xA2, 0x59, 0xC8, 0xCC, 0x22, 0xD1, 0xE2, 0x98, 0x68, 0xDC,
+    0x90, 0xC7, 0x2D, 0xC5, 0x90, 0x9C, 0x5B, 0x8F, 0xD9, 0x06, 0xBC, 0x53, 0x45, 0xBC, 0x53, 0xAA,
+    0xC3, 0xED, 0x42, 0xED, 0x3F, 0x2C, 0xE2, 0xC3, 0x47, 0x99, 0x16, 0x99, 0x2C, 0x27, 0x9A, 0xAF,
+    0x42, 0xF5, 0xFA, 0x4D, 0x05, 0xBD, 0x88, 0xB9, 0x0D, 0x20, 0x24, 0x62, 0x20, 0x62, 0xEE, 0x85,
+    0x49, 0xFA, 0xAE, 0x26, 0xB7, 0xBC, 0xDC, 0xBE, 0x6E, 0x3B, 0xA1, 0xA8, 0x25, 0x52, 0x50, 0x51,
+    0x50, 0x89, 0xEB, 0xB9, 0xB1, 0xAE, 0x8D, 0x85, 0x7C, 0xA8, 0x9B, 0x39, 0x8A, 0xFB, 0xDB, 0xAF,
+    0xD9, 0xF6, 0xC4, 0xB6, 0x86, 0xC8, 0x3A, 0x4D, 0x94, 0x37, 0xF0, 0x54, 0x45, 0x55, 0x9A, 0xAC,
+    0x93, 0xD8, 0x84, 0x5E, 0x71, 0xEE, 0x60, 0x81, 0x0C, 0xE1, 0xBC, 0xC3, 0x1B, 0x25, 0xE1, 0x41,
+    0x54, 0x90, 0xD7, 0x22, 0xAD, 0x02, 0x87, 0x47, 0x38, 0xB4, 0x46, 0x1E, 0x60, 0xC1, 0x4E, 0x5A,
+    0x04, 0x35, 0x1E, 0x51, 0x5C, 0x50, 0xD8, 0x53, 0x4A, 0xA4, 0x5B, 0xE8, 0x52, 0x6E, 0xC3, 0x9A,
+    0x7C, 0xAE, 0x75, 0x41, 0x11, 0x97, 0x39, 0xCC, 0xED, 0x6D, 0x49, 0x66, 0x58, 0x3B, 0xEE, 0x9A,
+    0xA9, 0xA6, 0xEB, 0x71, 0xBC, 0xCD, 0x16, 0xAF, 0x5F, 0xE1, 0x8A, 0xC2, 0x4E, 0x21, 0x9B, 0xB8,
+    0x89, 0x3B, 0xBC, 0x5E, 0x9A, 0x06, 0xAF, 0x67, 0x39, 0xDC, 0x7C, 0x72, 0x8F, 0xB0, 0x95, 0x44,
+    0xE5, 0x62, 0x92, 0x1C, 0x51, 0x30, 0xD7, 0x6B, 0xFD, 0x5A, 0x9F, 0xA9, 0x32, 0xAE, 0xE4, 0x36,
+    0x71, 0xA0, 0xB9, 0x78, 0x95, 0x64, 0x97, 0x3E, 0x05, 0x54, 0x30, 0x4F, 0xA1, 0x25, 0x41, 0x85,
+    0x24, 0x50, 0x31, 0x83, 0x8D, 0xE0, 0x45, 0xE2, 0x04, 0x6E, 0x44, 0xC5, 0x3F, 0x58, 0x97, 0xD3,
+    0x0C, 0x48, 0xD3, 0xB4, 0x5F, 0xE1, 0x3A, 0x0E, 0xA1, 0x1B, 0x54, 0x9A, 0x22, 0xAB, 0x7E, 0xB6,
+    0xC4, 0xB5, 0xE1, 0x32, 0xC8, 0x12, 0xEE, 0xE9, 0x14, 0x7C, 0xA0, 0x38, 0x2B, 0xEA, 0x37, 0x4B,
+    0xA6, 0x32, 0x97, 0x6B, 0x3A, 0x5F, 0x75, 0x0A, 0x39, 0x7E, 0xDF, 0x98, 0x6C, 0x36, 0x55, 0x25,
+    0xE3, 0x79, 0x7A, 0xB9, 0x55, 0x5C, 0x5E, 0x9B, 0x9A, 0x8F, 0xEC, 0x50, 0x34, 0x8A, 0x12, 0x9A,
+    0x06, 0x58, 0x41, 0x05, 0x24, 0xE7, 0x80, 0x68, 0x50, 0xC2, 0xC3, 0x0C, 0x2D, 0xA9, 0xB0, 0x10,
+    0x2C, 0x9E, 0x40, 0xBA, 0x73, 0x87, 0x5D, 0x97, 0x18, 0xF3, 0x38, 0xF3, 0x27, 0x5D, 0x83, 0x1A,
+    0x31, 0x60, 0xD9, 0xAB, 0x29, 0x7E, 0x8E, 0x98, 0xF9, 0x6A, 0x8D, 0xF2, 0x22, 0x58, 0x56, 0x15,
+    0xA9, 0x6A, 0x83, 0xBE, 0x4E, 0xB0, 0xE7, 0x64, 0x8A, 0xB9, 0xD2, 0xFC, 0x65, 0xA3, 0x5B, 0x6A,
+    0xB5, 0xA5, 0x45, 0x6D, 0xBF, 0x82, 0xB4, 0x2F, 0x65, 0xC6, 0xD8, 0x75, 0x32, 0x76, 0x13, 0x92,
+    0xAE, 0xE4, 0x16, 0x36, 0x3F, 0x0E, 0x61, 0x97, 0xCE, 0xA2, 0x1E, 0x7E, 0x06, 0x70, 0x0A, 0x20,
+    0xD2, 0x3B, 0x91, 0x1A, 0x47, 0xBB, 0x52, 0xE0, 0x8C, 0xBA, 0x3C, 0xA3, 0x5A, 0x67, 0x5E, 0x15,
+    0x0F, 0x82, 0xD4, 0xE0, 0x2C, 0xA3, 0x14, 0x72, 0x7E, 0x37, 0x93, 0x84, 0x00, 0x79, 0x21, 0xE2,
+    0xB2, 0x3B, 0x01, 0xD4, 0x11, 0x4C, 0xC4, 0x1D, 0x99, 0xA7, 0x37, 0xBC, 0x0E, 0x81, 0x73, 0x21,
+    0xC5, 0xBA, 0xC4, 0x7F, 0x90, 0x0F, 0x0C, 0xA2, 0xA3, 0x4C, 0xFC, 0x6A, 0xF8, 0x19, 0x01, 0xF7,
+    0x00, 0xA2, 0xA0, 0xAC, 0x59, 0xD8, 0x57, 0xD2, 0x79, 0x94, 0x0F, 0x65, 0x1E, 0x8D, 0xEE, 0xE5,
+    0xCC, 0xFD, 0x4B, 0x41, 0x9E, 0x09, 0xD4, 0x32, 0x27, 0x39, 0x27, 0x20, 0x13, 0x39, 0x59, 0x9E,
+    0x0C, 0x67, 0xB7, 0x38, 0xF3, 0x41, 0x1E, 0x77, 0x06, 0xA0, 0x1C, 0xFF, 0x45, 0xDE, 0x1E, 0xC1,
+    0x9C, 0x04, 0x23, 0x7C, 0xA8, 0x7C, 0x01, 0x18, 0x81, 0x25, 0x1A, 0xCD, 0x86, 0x55, 0x06, 0x8D,
+    0x70, 0x42, 0xCE, 0x24, 0x0B, 0x89, 0x04, 0xEE, 0x03, 0xD9, 0x79, 0x7C, 0x47, 0x78, 0x22, 0x09,
+    0xC6, 0x42, 0x83, 0x50, 0x88, 0xE2, 0xB1, 0x23, 0x8A, 0x64, 0xAA, 0x87, 0x1E, 0x9C, 0x87, 0x28,
+    0x51, 0xB2, 0xAF, 0x6C, 0x80, 0x21, 0xA2, 0x71, 0x8D, 0xC9, 0x45, 0xCC, 0x47, 0xDF, 0x04, 0xAC,
+    0x40, 0xD6, 0xB2, 0x81, 0x15, 0x6C, 0xD2, 0xAC, 0x11, 0x32, 0xDD, 0xA1, 0xFC, 0x53, 0xE6, 0x47,
+    0x36, 0xE6, 0x2E, 0x7D, 0x70, 0x94, 0xEF, 0xF4, 0xF1, 0xE5, 0xC6, 0xF4, 0x07, 0xB9, 0x27, 0x84,
+    0x06, 0x62, 0x9C, 0xC4, 0xD8, 0x00, 0x90, 0x15, 0x84, 0x20, 0xD4, 0x14, 0x8F, 0xFA, 0x05, 0x89,
+    0x68, 0x6A, 0x41, 0x22, 0x43, 0xA7, 0x0C, 0xE1, 0xD2, 0x05, 0x2D, 0x51, 0xFA, 0x8E, 0x64, 0xA9,
+    0xE4, 0xC1, 0x3C, 0x91, 0x4B, 0x7F, 0xED, 0x78, 0x5D, 0xFF, 0xE7, 0x10, 0xD0, 0xDC, 0x20, 0xBF,
+    0xFF, 0x88, 0x5D, 0xDE, 0x68, 0x37, 0x89, 0x16, 0xAE, 0x7E, 0xA7, 0xE3, 0x05, 0x77, 0xA0, 0x41,
+    0x5E, 0x29, 0x2E, 0x78, 0x12, 0x4E, 0x0A, 0x7D, 0x97, 0x36, 0x16, 0x83, 0x83, 0x3A, 0x7A, 0x56,
+    0xE8, 0xBD, 0x04, 0xD4, 0x00, 0x03, 0xF4, 0x73, 0x42, 0x3E, 0xEF, 0x80, 0x0C, 0xCC, 0x0F, 0xE0,
+    0x61, 0xE1, 0xF8, 0x6D, 0x81, 0xF7, 0x33, 0x88, 0xF0, 0x0C, 0xE5, 0x31, 0xD2, 0x43, 0x82, 0xE0,
+    0xFF, 0xD9, 0x60, 0xE8, 0xE0, 0x77, 0x26, 0x5F, 0x40, 0xD6, 0xC3, 0xFE, 0x2C, 0xDF, 0x31, 0x4C,
+    0x06, 0x4D, 0xD7, 0xD1, 0xBB, 0x12, 0x7B, 0x22, 0xCA, 0xF2, 0x2B, 0xD1, 0x81, 0x74, 0x69, 0x35,
+    0x2C, 0xC9, 0xC7, 0xF4, 0xDB, 0x5C, 0x42, 0x00, 0x80, 0xAF, 0x34, 0xFD, 0xBC, 0xEA, 0x37, 0x82,
+    0xFB, 0x8C, 0x7A, 0xFF, 0x64, 0xFA, 0xE8, 0x71, 0x1F, 0xEE, 0x2F, 0x7F, 0xD1, 0x04, 0x20, 0x1B,
+    0xB2, 0x36, 0x89, 0x8B, 0x15, 0x29, 0xD0, 0x2C, 0xFE, 0x1B, 0x37, 0x09, 0x7C, 0x90, 0x41, 0xB9,
+    0xDA, 0x35, 0xC1, 0x64, 0xB7, 0x52, 0x8F, 0x97, 0x0B, 0x33, 0x67, 0xA8, 0xB5, 0x6D, 0xB0, 0xBF,
+    0x53, 0x1F, 0xDF, 0xB6, 0x36, 0xD8, 0xDF, 0xAF, 0xD4, 0xAF, 0x4F, 0x32, 0x3A, 0x31, 0x9A, 0x97,
+    0x79, 0x59, 0x0E, 0x33, 0xA9, 0xC3, 0xC4, 0x53, 0x65, 0x54, 0x52, 0x47, 0x9B, 0x24, 0x23, 0x09,
+    0x00, 0xCB, 0xF0, 0x74, 0x3D, 0xD2, 0xB8, 0x99, 0x2E, 0xDC, 0x3A, 0x73, 0xEB, 0x60, 0x1E, 0xA8,
+    0xB3, 0x60, 0x57, 0x0F, 0xC4, 0x12, 0x4A, 0xB9, 0xA1, 0x74, 0x12, 0xB2, 0x01, 0xDA, 0xE2, 0x3E,
+    0x7F, 0xF1, 0xF7, 0xE7, 0xE8, 0x73, 0x28, 0xA3, 0xAC, 0x2D, 0x9A, 0x1E, 0x66, 0x11, 0xAA, 0x08,
+    0x90, 0x9A, 0x1E, 0x86, 0xF7, 0x50, 0xB3, 0x62, 0x60, 0x3D, 0x10, 0x92, 0x26, 0x84, 0xFD, 0x32,
+    0x7E, 0xF6, 0x8B, 0xD5, 0x57, 0x7E, 0x68, 0x4E, 0x86, 0xE5, 0x69, 0x02, 0x3C, 0xFF, 0x12, 0xE9,
+    0xFD, 0x60, 0x18, 0xDF, 0xE2, 0x09, 0x33, 0x9A, 0xF2, 0x37, 0x47, 0x6B, 0x16, 0xEE, 0xF6, 0x1C,
+    0x2B, 0xD2, 0x44, 0xFC, 0x05, 0x60, 0x16, 0x26, 0x43, 0x98, 0x39, 0x6F, 0xFF, 0x65, 0x08, 0x72,
+    0x2A, 0x2C, 0x57, 0xCD, 0xC3, 0x1F, 0xAD, 0x9A, 0xEC, 0xD5, 0xBE, 0x4C, 0x04, 0x99, 0xA9, 0xB1,
+    0x1D, 0x9E, 0x7B, 0x80, 0xF9, 0x82, 0x8F, 0x7B, 0x30, 0x2B, 0xCE, 0xE6, 0xD0, 0x2D, 0x61, 0x85,
+    0x69, 0xB9, 0x24, 0x5C, 0xDD, 0x16, 0xAA, 0xDC, 0x26, 0xCF, 0x42, 0xB1, 0x45, 0xEE, 0x80, 0xB0,
+    0xC0, 0x37, 0x34, 0x3B, 0x39, 0x4C, 0xCC, 0x0C, 0xFD, 0x82, 0xA2, 0x14, 0xA8, 0x8B, 0x7A, 0x74,
+    0x77, 0x6B, 0xAB, 0x2A, 0x69, 0xEC, 0x32, 0xC7, 0x93, 0x0F, 0xAA, 0xA4, 0x19, 0x8F, 0xF5, 0xB7,
+    0x9B, 0x32, 0xB9, 0x50, 0x3F, 0x8C, 0x1C, 0x7A, 0xCB, 0xBD, 0xF6, 0x9E, 0x7C, 0x9B, 0xAC, 0x39,
+    0x5A, 0xC1, 0xE7, 0x03, 0x84, 0x99, 0xCD, 0x93, 0x25, 0x5D, 0x2E, 0x45, 0xCD, 0xA2, 0xDF, 0xDD,
+    0x14, 0x7C, 0x2F, 0xBE, 0x21, 0xCD, 0xD3, 0x27, 0x68, 0x80, 0xB3, 0xF7, 0x2D, 0xAA, 0x87, 0x5F,
+    0x11, 0xFD, 0x55, 0x47, 0xCD, 0x7A, 0xD4, 0xE8, 0xA8, 0x89, 0xB6, 0x1A, 0x6F, 0xF5, 0xA2, 0x2B,
+    0x07, 0x3A, 0xC1, 0x6F, 0xFD, 0xDA, 0x14, 0xEB, 0x81, 0x35, 0x64, 0x96, 0xB3, 0xF0, 0xB0, 0xA2,
+    0x14, 0x6D, 0x2C, 0x95, 0x95, 0x09, 0x77, 0x69, 0xB4, 0x4A, 0x7F, 0x03, 0x8D, 0x54, 0xB1, 0x8E,
+    0xDD, 0x44, 0x14, 0x3D, 0xB6, 0xA3, 0x75, 0xB4, 0x23, 0x65, 0xB6, 0x20, 0x0D, 0x5B, 0x98, 0x82,
+    0x96, 0xB8, 0x81, 0x02, 0x69, 0xD9, 0x71, 0x1A, 0x8A, 0x54, 0x5B, 0x64, 0x11, 0xA2, 0x79, 0x0D,
+    0x34, 0x34, 0xA9, 0xE8, 0xC2, 0x8E, 0xA5, 0x7C, 0x00, 0xF9, 0x04, 0x8A, 0x2D, 0xC2, 0xA3, 0x08,
+    0x1F, 0x90, 0x8D, 0x0D, 0x29, 0xD2, 0x3A, 0x69, 0x28, 0x63, 0x11, 0x24, 0xA2, 0x34, 0x3B, 0xEC,
+    0xDA, 0x8A, 0x59, 0x8D, 0x7D, 0x39, 0x63, 0x3F, 0xAD, 0x40, 0x48, 0x28, 0xF3, 0xDE, 0xF1, 0xF8,
+    0xCD, 0xBB, 0x73, 0xE7, 0xDC, 0x73, 0xEF, 0x1D, 0xE0, 0x3D, 0xC0, 0xFB, 0xC4, 0x7B, 0xE5, 0x1E,
+    0x65, 0xF5, 0x5D, 0x5B, 0x1C, 0x4D, 0x30, 0x03, 0x8C, 0x83, 0x91, 0xCE, 0xC8, 0xF0, 0xEE, 0xFA,
+    0x18, 0x61, 0xEC, 0x11, 0x8F, 0x81, 0xC8, 0x03, 0x89, 0x03, 0xB4, 0x88, 0x18, 0xC2, 0x96, 0x40,
+    0xC6, 0x59, 0x11, 0x31, 0xFF, 0xC3, 0x44, 0xDC, 0x25, 0xDE, 0x09, 0x9B, 0x76, 0x88, 0x6F, 0x1A,
+    0x5A, 0xAC, 0x0A, 0xA4, 0xFD, 0x88, 0x48, 0x56, 0x1D, 0x6C, 0x2F, 0x4D, 0x76, 0xBA, 0xB2, 0xF7,
+    0x86, 0xFE, 0xCF, 0x71, 0x5F, 0xAF, 0xD2, 0xBA, 0xEC, 0xDD, 0x0E, 0xF4, 0x8A, 0xC6, 0x7D, 0x70,
+    0xFD, 0x9F, 0x97, 0xAD, 0x5B, 0xD8, 0x8C, 0x0F, 0x08, 0x43, 0xE4, 0x3C, 0x56, 0x37, 0x95, 0x48,
+    0x47, 0x8C, 0xA4, 0x35, 0x71, 0xF6, 0x04, 0xAD, 0xF3, 0x9A, 0x36, 0x05, 0xB0, 0x4F, 0xBB, 0xAB,
+    0xF8, 0x3F, 0xBF, 0x7C, 0x89, 0xEA, 0xDE, 0xBD, 0x6F, 0xF5, 0x4A, 0x3D, 0xF1, 0xFD, 0x99, 0xD7,
+    0xB2, 0xAA, 0x60, 0x7A, 0xA9, 0x21, 0x2B, 0x87, 0xA4, 0xF7, 0x1B, 0xE3, 0x8F, 0x6A, 0xFC, 0x63,
+    0xB8, 0xA4, 0x84, 0x6A, 0xF3, 0x02, 0x96, 0x1F, 0x8A, 0x61, 0x11, 0x94, 0x48, 0x08, 0xC9, 0x5A,
+    0xC4, 0x3E, 0xE8, 0xD1, 0xE4, 0x81, 0x57, 0x5E, 0x73, 0xC1, 0x94, 0x15, 0x25, 0x89, 0x78, 0xDE,
+    0x41, 0x44, 0x5A, 0xD7, 0x28, 0x20, 0xFD, 0x92, 0xA9, 0xAD, 0x9A, 0xFC, 0x5C, 0x7E, 0x95, 0x7D,
+    0xB9, 0x71, 0xFE, 0xA4, 0xD6, 0x54, 0xF8, 0xBC, 0xC6, 0x32, 0xC5, 0xB2, 0xF7, 0xAD, 0x3D, 0x3F,
+    0x3D, 0x13, 0x33, 0x24, 0xF4, 0xA3, 0xA9, 0xAA, 0x61, 0xC8, 0xDF, 0x2F, 0x04, 0x4E, 0xF8, 0xAB,
+    0xC5, 0x36, 0xBD, 0xE4, 0x80, 0xAA, 0x11, 0xB9, 0xAD, 0xE3, 0x47, 0x5A, 0x1E, 0x32, 0x29, 0x4F,
+    0x3B, 0xF3, 0xDB, 0x90, 0x0E, 0x23, 0x46, 0x53, 0x18, 0xD5, 0xE5, 0x3F, 0x93, 0x8A, 0x11, 0x97,
+    0xF0, 0xB8, 0xDD, 0xFB, 0xF3, 0xE6, 0x2B, 0xC0, 0x9D, 0x57, 0x29, 0x23, 0x94, 0x3F, 0xBA, 0x88,
+    0x4C, 0x3B, 0x48, 0x69, 0x3A, 0x54, 0x85, 0xF2, 0x30, 0xB5, 0x92, 0x32, 0x6B, 0x94, 0x38, 0xE5,
+    0xD4, 0x99, 0x8F, 0xBD, 0x76, 0x16, 0x95, 0x76, 0x59, 0x9D, 0xBF, 0x68, 0x95, 0x4B, 0xA5, 0x4D,
+    0x7C, 0x24, 0xDD, 0xAE, 0xCC, 0x11, 0x97, 0x73, 0xA0, 0xE1, 0xE1, 0xB2, 0x53, 0x3E, 0xD2, 0xE6,
+    0x8E, 0xDC, 0xC7, 0xC1, 0xA5, 0x4E, 0x9A, 0x21, 0x67, 0x03, 0xB9, 0x92, 0xA8, 0x65, 0x92, 0xA4,
+    0x42, 0x34, 0xDA, 0x22, 0xF1, 0xA6, 0x4E, 0x87, 0xBC, 0xD1, 0x8E, 0x8E, 0x5B, 0xED, 0x4C, 0x93,
+    0x0E, 0xB6, 0x4E, 0x7C, 0x55, 0xC6, 0x93, 0xFC, 0x7B, 0xBC, 0xA0, 0x88, 0x0F, 0x5F, 0x4B, 0xE9,
+    0x55, 0xA3, 0xEB, 0x13, 0xBC, 0xC5, 0xF4, 0x60, 0x7B, 0x8E, 0xF2, 0xED, 0x37, 0x70, 0xDA, 0x1C,
+    0xB4, 0x5E, 0xAF, 0x4B, 0x91, 0x37, 0xFC, 0x71, 0xB1, 0xD6, 0x2D, 0xB2, 0x66, 0xFE, 0xD6, 0xA1,
+    0xD6, 0x3E, 0x41, 0xDA, 0xA2, 0x42, 0xE6, 0xB0, 0x18, 0x88, 0x1C, 0x1E, 0xDE, 0xE6, 0x31, 0xDB,
+    0xE2, 0x73, 0x19, 0x8D, 0xFC, 0x00, 0x5C, 0x3F, 0x2C, 0x90, 0x48, 0x88, 0x54, 0x0A, 0xA8, 0x26,
+    0x70, 0x20, 0x32, 0x26, 0x2D, 0xEE, 0xB0, 0x14, 0x64, 0x4A, 0x3D, 0xE8, 0x85, 0xC2, 0xB4, 0xAC,
+    0x58, 0x0A, 0xB2, 0xC3, 0x52, 0x4D, 0xEF, 0xD1, 0xCE, 0x54, 0x25, 0x62, 0x66, 0x82, 0x6D, 0x15,
+    0x4C, 0x68, 0x97, 0x4C, 0x1B, 0x11, 0xA3, 0xEA, 0xE6, 0x18, 0xCB, 0x85, 0xB4, 0x64, 0xE9, 0x1F,
+    0xC7, 0xA3, 0xAE, 0xB0, 0x17, 0x4B, 0xAD, 0x60, 0x5D, 0xD2, 0x5B, 0x56, 0xBC, 0x7C, 0x47, 0xFC,
+    0x12, 0x2C, 0x76, 0x7F, 0xCF, 0x9A, 0x25, 0xC1, 0xB0, 0x3C, 0xC1, 0x06, 0xC7, 0x9F, 0xD2, 0x27,
+    0x8B, 0x97, 0xF4, 0x11, 0x0F, 0x4B, 0xE9, 0xCC, 0x0D, 0x14, 0x16, 0x43, 0x1F, 0x87, 0x7E, 0xC6,
+    0x51, 0xE8, 0xA8, 0x22, 0x74, 0xD4, 0xB2, 0x18, 0xA8, 0x7F, 0x29, 0xEC, 0x56, 0x29, 0x51, 0xB1,
+    0x19, 0xB4, 0xB4, 0x8B, 0xCB, 0x30, 0xB2, 0x67, 0x63, 0xFE, 0x72, 0x32, 0x6E, 0x61, 0x37, 0x66,
+    0xCF, 0x27, 0xF3, 0x32, 0xB0, 0xCE, 0xDB, 0x8F, 0xAD, 0xDF, 0x3F, 0x39, 0x3A, 0x1A, 0xF3, 0x11,
+    0x69, 0x77, 0xB9, 0x32, 0xDA, 0xF1, 0x24, 0xF3, 0x88, 0x36, 0x75, 0x11, 0x75, 0xCB, 0x19, 0x2C,
+    0x5B, 0xE8, 0x32, 0x90, 0xD9, 0xFE, 0x51, 0x1C, 0xCB, 0x69, 0xB0, 0x22, 0xAF, 0x96, 0xBB, 0xA5,
+    0x09, 0x57, 0x4A, 0x58, 0xF3, 0x5F, 0xCB, 0xF4, 0x60, 0xBE, 0x72, 0xB8, 0x4B, 0xB9, 0x85, 0xF6,
+    0xF5, 0xE2, 0xB2, 0xC2, 0xB6, 0x42, 0x68, 0x14, 0x52, 0x91, 0xA4, 0x92, 0xB0, 0x6D, 0x41, 0x4C,
+    0x20, 0x9F, 0x5F, 0xE4, 0x2F, 0x0A, 0x2A, 0x24, 0xB8, 0x1B, 0xEE, 0x86, 0x2D, 0xC1, 0x57, 0xC0,
+    0x4F, 0x4A, 0x2E, 0x0E, 0x98, 0x4A, 0x19, 0xF0, 0x59, 0x88, 0x0F, 0xF8, 0x7C, 0x76, 0xF7, 0x21,
+    0x91, 0x04, 0x95, 0x78, 0x01, 0x52, 0xF8, 0x31, 0xE4, 0x62, 0xBA, 0x7C, 0xF8, 0xE0, 0xA3, 0x8C,
+    0x2A, 0xF1, 0x69, 0xE8, 0x9A, 0x8A, 0xB5, 0xAE, 0x82, 0xC9, 0x71, 0x88, 0xED, 0x0B, 0x91, 0xB9,
+    0x99, 0x72, 0x79, 0x7D, 0x10, 0x87, 0x50, 0xFF, 0x06,
+};
+
+static const uint32_t opendyslexic_10_boldBlockOffsets[23] = {
+    0, 1268, 2438, 3801, 4719, 5462, 6408, 7215,
+    8139, 9095, 9957, 10656, 11874, 12917, 14251, 15436,
+    16662, 17822, 18937, 19985, 21265, 22508, 23321,
+};
+
+static const uint16_t opendyslexic_10_boldDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_10_boldGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_10_boldPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_10_boldGlyphs[] = {
@@ -2757,694 +1642,694 @@ static const EpdGlyph opendyslexic_10_boldGlyphs[] = {
     { 14, 18, 20, 3, 18, 63, 1820 }, // B
     { 16, 19, 21, 2, 19, 76, 1883 }, // C
     { 16, 18, 22, 3, 18, 72, 1959 }, // D
-    { 13, 18, 19, 3, 18, 59, 2031 }, // E
-    { 12, 18, 18, 3, 18, 54, 2090 }, // F
-    { 18, 19, 24, 3, 19, 86, 2144 }, // G
-    { 16, 18, 22, 3, 18, 72, 2230 }, // H
-    { 5, 18, 11, 3, 18, 23, 2302 }, // I
-    { 13, 23, 19, 3, 18, 75, 2325 }, // J
-    { 16, 18, 22, 3, 18, 72, 2400 }, // K
-    { 13, 18, 19, 3, 18, 59, 2472 }, // L
-    { 18, 18, 24, 3, 18, 81, 2531 }, // M
-    { 16, 18, 22, 3, 18, 72, 2612 }, // N
-    { 18, 19, 24, 3, 18, 86, 2684 }, // O
-    { 13, 18, 19, 3, 18, 59, 2770 }, // P
-    { 19, 22, 22, 2, 19, 105, 2829 }, // Q
-    { 14, 18, 20, 3, 18, 63, 2934 }, // R
-    { 16, 19, 22, 3, 18, 76, 2997 }, // S
-    { 16, 18, 22, 3, 18, 72, 3073 }, // T
-    { 16, 19, 22, 3, 18, 76, 3145 }, // U
-    { 18, 18, 24, 3, 18, 81, 3221 }, // V
-    { 24, 18, 30, 3, 18, 108, 3302 }, // W
-    { 17, 18, 23, 3, 18, 77, 3410 }, // X
-    { 17, 18, 22, 3, 18, 77, 3487 }, // Y
-    { 17, 18, 23, 3, 18, 77, 3564 }, // Z
-    { 8, 31, 10, 1, 23, 62, 3641 }, // [
-    { 8, 24, 10, 1, 18, 48, 3703 }, // <backslash>
-    { 8, 31, 10, 1, 23, 62, 3751 }, // ]
-    { 12, 6, 12, 0, 21, 18, 3813 }, // ^
-    { 16, 5, 14, -1, -1, 20, 3831 }, // _
-    { 9, 4, 9, 0, 16, 9, 3851 }, // `
-    { 12, 13, 18, 3, 13, 39, 3860 }, // a
-    { 13, 19, 18, 3, 18, 62, 3899 }, // b
-    { 11, 13, 16, 3, 13, 36, 3961 }, // c
-    { 13, 18, 18, 3, 18, 59, 3997 }, // d
-    { 12, 12, 18, 3, 12, 36, 4056 }, // e
-    { 9, 17, 14, 3, 17, 39, 4092 }, // f
-    { 12, 19, 18, 3, 12, 57, 4131 }, // g
-    { 13, 18, 18, 3, 18, 59, 4188 }, // h
-    { 6, 19, 10, 2, 19, 29, 4247 }, // i
-    { 8, 25, 13, 3, 19, 50, 4276 }, // j
-    { 13, 18, 19, 3, 18, 59, 4326 }, // k
-    { 7, 18, 12, 3, 18, 32, 4385 }, // l
-    { 20, 13, 26, 3, 13, 65, 4417 }, // m
-    { 12, 13, 18, 3, 13, 39, 4482 }, // n
-    { 12, 12, 18, 3, 12, 36, 4521 }, // o
-    { 14, 19, 20, 3, 13, 67, 4557 }, // p
-    { 15, 19, 20, 3, 13, 72, 4624 }, // q
-    { 9, 12, 15, 3, 12, 27, 4696 }, // r
-    { 12, 14, 18, 3, 13, 42, 4723 }, // s
-    { 11, 18, 16, 3, 17, 50, 4765 }, // t
-    { 12, 12, 18, 3, 12, 36, 4815 }, // u
-    { 15, 12, 21, 3, 12, 45, 4851 }, // v
-    { 17, 13, 23, 3, 12, 56, 4896 }, // w
-    { 15, 12, 20, 3, 12, 45, 4952 }, // x
-    { 14, 18, 19, 3, 12, 63, 4997 }, // y
-    { 13, 12, 18, 3, 12, 39, 5060 }, // z
-    { 11, 21, 12, 0, 16, 58, 5099 }, // {
-    { 4, 19, 8, 2, 15, 19, 5157 }, // |
-    { 11, 21, 12, 0, 16, 58, 5176 }, // }
-    { 8, 5, 10, 1, 16, 10, 5234 }, // ~
-    { 0, 0, 18, 0, 0, 0, 5244 }, //  
-    { 7, 27, 16, 4, 23, 48, 5244 }, // ¡
-    { 11, 20, 16, 3, 16, 55, 5292 }, // ¢
-    { 14, 19, 14, 0, 18, 67, 5347 }, // £
-    { 14, 13, 14, 0, 14, 46, 5414 }, // ¤
-    { 16, 19, 16, 0, 16, 76, 5460 }, // ¥
-    { 3, 19, 8, 2, 15, 15, 5536 }, // ¦
-    { 12, 19, 16, 2, 17, 57, 5551 }, // §
-    { 11, 5, 11, 0, 17, 14, 5608 }, // ¨
-    { 10, 9, 14, 2, 20, 23, 5622 }, // ©
-    { 7, 7, 14, 4, 16, 13, 5645 }, // ª
-    { 12, 12, 11, 0, 12, 36, 5658 }, // «
-    { 11, 8, 13, 1, 8, 22, 5694 }, // ¬
-    { 11, 3, 13, 1, 8, 9, 5716 }, // ­
-    { 10, 9, 14, 2, 23, 23, 5725 }, // ®
-    { 10, 4, 11, 0, 16, 10, 5748 }, // ¯
-    { 10, 10, 14, 2, 16, 25, 5758 }, // °
-    { 12, 14, 13, 0, 12, 42, 5783 }, // ±
-    { 6, 8, 7, 0, 17, 12, 5825 }, // ²
-    { 7, 8, 7, 0, 17, 14, 5837 }, // ³
-    { 6, 5, 6, 0, 16, 8, 5851 }, // ´
-    { 13, 15, 18, 2, 12, 49, 5859 }, // µ
-    { 12, 18, 16, 2, 15, 54, 5908 }, // ¶
-    { 5, 5, 5, 0, 10, 7, 5962 }, // ·
-    { 6, 7, 7, 0, 1, 11, 5969 }, // ¸
-    { 6, 8, 6, 0, 17, 12, 5980 }, // ¹
-    { 7, 7, 14, 4, 15, 13, 5992 }, // º
-    { 12, 12, 16, 2, 12, 36, 6005 }, // »
-    { 19, 20, 26, 3, 18, 95, 6041 }, // ¼
-    { 21, 20, 26, 3, 18, 105, 6136 }, // ½
-    { 19, 19, 26, 3, 17, 91, 6241 }, // ¾
-    { 13, 26, 14, 0, 15, 85, 6332 }, // ¿
-    { 18, 24, 20, 1, 24, 108, 6417 }, // À
-    { 18, 28, 20, 1, 28, 126, 6525 }, // Á
-    { 18, 26, 20, 1, 26, 117, 6651 }, // Â
-    { 18, 25, 20, 1, 25, 113, 6768 }, // Ã
-    { 18, 25, 20, 1, 25, 113, 6881 }, // Ä
-    { 18, 25, 20, 1, 25, 113, 6994 }, // Å
-    { 26, 19, 28, 1, 18, 124, 7107 }, // Æ
-    { 16, 25, 21, 2, 19, 100, 7231 }, // Ç
-    { 13, 25, 19, 3, 25, 82, 7331 }, // È
-    { 13, 28, 19, 3, 28, 91, 7413 }, // É
-    { 13, 26, 19, 3, 26, 85, 7504 }, // Ê
-    { 13, 26, 19, 3, 26, 85, 7589 }, // Ë
-    { 9, 26, 11, 0, 26, 59, 7674 }, // Ì
-    { 5, 29, 11, 3, 29, 37, 7733 }, // Í
-    { 12, 27, 11, 0, 27, 81, 7770 }, // Î
-    { 11, 27, 11, 0, 27, 75, 7851 }, // Ï
-    { 20, 18, 22, -1, 18, 90, 7926 }, // Ð
-    { 16, 25, 22, 3, 25, 100, 8016 }, // Ñ
-    { 18, 25, 24, 3, 24, 113, 8116 }, // Ò
-    { 18, 28, 24, 3, 27, 126, 8229 }, // Ó
-    { 18, 27, 24, 3, 26, 122, 8355 }, // Ô
-    { 18, 26, 24, 3, 25, 117, 8477 }, // Õ
-    { 18, 26, 24, 3, 25, 117, 8594 }, // Ö
-    { 13, 7, 12, 0, 9, 23, 8711 }, // ×
-    { 30, 41, 24, -3, 30, 308, 8734 }, // Ø
-    { 16, 26, 22, 3, 25, 104, 9042 }, // Ù
-    { 16, 30, 22, 3, 29, 120, 9146 }, // Ú
-    { 16, 28, 22, 3, 27, 112, 9266 }, // Û
-    { 16, 28, 22, 3, 27, 112, 9378 }, // Ü
-    { 17, 30, 22, 3, 30, 128, 9490 }, // Ý
-    { 10, 17, 12, 1, 17, 43, 9618 }, // Þ
-    { 13, 17, 14, 1, 16, 56, 9661 }, // ß
-    { 12, 19, 18, 3, 19, 57, 9717 }, // à
-    { 12, 22, 18, 3, 22, 66, 9774 }, // á
-    { 12, 20, 18, 3, 20, 60, 9840 }, // â
-    { 12, 19, 18, 3, 19, 57, 9900 }, // ã
-    { 12, 20, 18, 3, 20, 60, 9957 }, // ä
-    { 12, 20, 18, 3, 20, 60, 10017 }, // å
-    { 20, 13, 26, 3, 13, 65, 10077 }, // æ
-    { 11, 18, 16, 3, 13, 50, 10142 }, // ç
-    { 12, 21, 18, 3, 21, 63, 10192 }, // è
-    { 12, 24, 18, 3, 24, 72, 10255 }, // é
-    { 12, 22, 18, 3, 22, 66, 10327 }, // ê
-    { 12, 22, 18, 3, 22, 66, 10393 }, // ë
-    { 9, 18, 10, 0, 18, 41, 10459 }, // ì
-    { 5, 21, 10, 3, 21, 27, 10500 }, // í
-    { 12, 19, 10, -1, 19, 57, 10527 }, // î
-    { 10, 18, 10, 0, 18, 45, 10584 }, // ï
-    { 17, 19, 14, -1, 18, 81, 10629 }, // ð
-    { 12, 20, 18, 3, 20, 60, 10710 }, // ñ
-    { 12, 18, 18, 3, 18, 54, 10770 }, // ò
-    { 12, 22, 18, 3, 22, 66, 10824 }, // ó
-    { 12, 20, 18, 3, 20, 60, 10890 }, // ô
-    { 12, 19, 18, 3, 19, 57, 10950 }, // õ
-    { 12, 19, 18, 3, 19, 57, 11007 }, // ö
-    { 16, 15, 19, 1, 15, 60, 11064 }, // ÷
-    { 14, 35, 18, 2, 24, 123, 11124 }, // ø
-    { 12, 18, 18, 3, 18, 54, 11247 }, // ù
-    { 12, 22, 18, 3, 22, 66, 11301 }, // ú
-    { 12, 20, 18, 3, 20, 60, 11367 }, // û
-    { 12, 20, 18, 3, 20, 60, 11427 }, // ü
-    { 14, 31, 19, 3, 25, 109, 11487 }, // ý
-    { 10, 22, 12, 1, 17, 55, 11596 }, // þ
-    { 14, 28, 19, 3, 22, 98, 11651 }, // ÿ
-    { 18, 25, 20, 1, 25, 113, 11749 }, // Ā
-    { 12, 20, 18, 3, 20, 60, 11862 }, // ā
-    { 18, 26, 20, 1, 26, 117, 11922 }, // Ă
-    { 12, 20, 18, 3, 20, 60, 12039 }, // ă
-    { 18, 24, 20, 1, 18, 108, 12099 }, // Ą
-    { 13, 19, 18, 3, 13, 62, 12207 }, // ą
-    { 16, 25, 21, 2, 25, 100, 12269 }, // Ć
-    { 11, 18, 16, 3, 18, 50, 12369 }, // ć
-    { 16, 27, 21, 2, 27, 108, 12419 }, // Ĉ
-    { 12, 19, 16, 2, 19, 57, 12527 }, // ĉ
-    { 16, 25, 21, 2, 25, 100, 12584 }, // Ċ
-    { 11, 18, 16, 3, 18, 50, 12684 }, // ċ
-    { 16, 27, 21, 2, 27, 108, 12734 }, // Č
-    { 12, 20, 16, 3, 20, 60, 12842 }, // č
-    { 16, 27, 22, 3, 27, 108, 12902 }, // Ď
-    { 17, 18, 18, 3, 18, 77, 13010 }, // ď
-    { 20, 18, 22, -1, 18, 90, 13087 }, // Đ
-    { 16, 18, 18, 3, 18, 72, 13177 }, // đ
-    { 13, 26, 19, 3, 26, 85, 13249 }, // Ē
-    { 12, 22, 18, 3, 22, 66, 13334 }, // ē
-    { 13, 26, 19, 3, 26, 85, 13400 }, // Ĕ
-    { 12, 22, 18, 3, 22, 66, 13485 }, // ĕ
-    { 13, 26, 19, 3, 26, 85, 13551 }, // Ė
-    { 12, 22, 18, 3, 22, 66, 13636 }, // ė
-    { 13, 23, 19, 3, 18, 75, 13702 }, // Ę
-    { 12, 20, 18, 3, 12, 60, 13777 }, // ę
-    { 13, 28, 19, 3, 28, 91, 13837 }, // Ě
-    { 12, 24, 18, 3, 24, 72, 13928 }, // ě
-    { 18, 29, 24, 3, 29, 131, 14000 }, // Ĝ
-    { 13, 28, 18, 3, 21, 91, 14131 }, // ĝ
-    { 18, 28, 24, 3, 28, 126, 14222 }, // Ğ
-    { 12, 27, 18, 3, 20, 81, 14348 }, // ğ
-    { 18, 28, 24, 3, 28, 126, 14429 }, // Ġ
-    { 12, 27, 18, 3, 20, 81, 14555 }, // ġ
-    { 18, 31, 24, 3, 31, 140, 14636 }, // Ģ
-    { 12, 28, 18, 3, 21, 84, 14776 }, // ģ
-    { 16, 26, 22, 3, 26, 104, 14860 }, // Ĥ
-    { 16, 26, 18, 0, 26, 104, 14964 }, // ĥ
-    { 18, 18, 22, 2, 18, 81, 15068 }, // Ħ
-    { 16, 18, 18, 0, 18, 72, 15149 }, // ħ
-    { 9, 27, 11, 1, 27, 61, 15221 }, // Ĩ
-    { 8, 20, 10, 1, 20, 40, 15282 }, // ĩ
-    { 12, 27, 11, -1, 27, 81, 15322 }, // Ī
-    { 12, 19, 10, -1, 19, 57, 15403 }, // ī
-    { 6, 23, 11, 2, 18, 35, 15460 }, // Į
-    { 6, 25, 10, 2, 19, 38, 15495 }, // į
-    { 5, 27, 11, 3, 27, 34, 15533 }, // İ
-    { 4, 12, 10, 3, 12, 12, 15567 }, // ı
-    { 17, 26, 33, 7, 18, 111, 15579 }, // Ĳ
-    { 13, 24, 10, 2, 19, 78, 15690 }, // ĳ
-    { 14, 31, 19, 3, 26, 109, 15768 }, // Ĵ
-    { 12, 27, 13, 2, 21, 81, 15877 }, // ĵ
-    { 16, 29, 22, 3, 29, 116, 15958 }, // Ķ
-    { 13, 29, 19, 3, 18, 95, 16074 }, // ķ
-    { 10, 12, 14, 2, 12, 30, 16169 }, // ĸ
-    { 13, 24, 19, 3, 24, 78, 16199 }, // Ĺ
-    { 7, 27, 12, 3, 27, 48, 16277 }, // ĺ
-    { 15, 28, 19, 1, 28, 105, 16325 }, // Ļ
-    { 9, 29, 12, 1, 18, 66, 16430 }, // ļ
-    { 13, 18, 19, 3, 18, 59, 16496 }, // Ľ
-    { 10, 21, 12, 3, 21, 53, 16555 }, // ľ
-    { 13, 18, 19, 3, 18, 59, 16608 }, // Ŀ
-    { 10, 18, 12, 3, 18, 45, 16667 }, // ŀ
-    { 23, 32, 19, -6, 25, 184, 16712 }, // Ł
-    { 15, 18, 12, -4, 18, 68, 16896 }, // ł
-    { 16, 25, 22, 3, 25, 100, 16964 }, // Ń
-    { 12, 20, 18, 3, 20, 60, 17064 }, // ń
-    { 16, 27, 22, 3, 18, 108, 17124 }, // Ņ
-    { 12, 21, 18, 3, 13, 63, 17232 }, // ņ
-    { 16, 27, 22, 3, 27, 108, 17295 }, // Ň
-    { 13, 22, 18, 3, 22, 72, 17403 }, // ň
-    { 12, 21, 18, 3, 21, 63, 17475 }, // ŉ
-    { 16, 23, 22, 3, 18, 92, 17538 }, // Ŋ
-    { 12, 18, 18, 3, 13, 54, 17630 }, // ŋ
-    { 18, 26, 24, 3, 25, 117, 17684 }, // Ō
-    { 12, 19, 18, 3, 19, 57, 17801 }, // ō
-    { 18, 27, 24, 3, 26, 122, 17858 }, // Ŏ
-    { 12, 20, 18, 3, 20, 60, 17980 }, // ŏ
-    { 19, 25, 24, 3, 24, 119, 18040 }, // Ő
-    { 18, 18, 18, 1, 18, 81, 18159 }, // ő
-    { 25, 20, 25, 3, 19, 125, 18240 }, // Œ
-    { 21, 12, 22, 3, 12, 63, 18365 }, // œ
-    { 14, 25, 20, 3, 25, 88, 18428 }, // Ŕ
-    { 9, 18, 15, 3, 18, 41, 18516 }, // ŕ
-    { 14, 29, 20, 3, 29, 102, 18557 }, // Ŗ
-    { 10, 22, 15, 2, 22, 55, 18659 }, // ŗ
-    { 14, 26, 20, 3, 26, 91, 18714 }, // Ř
-    { 12, 19, 15, 1, 19, 57, 18805 }, // ř
-    { 16, 26, 22, 3, 25, 104, 18862 }, // Ś
-    { 12, 19, 18, 3, 18, 57, 18966 }, // ś
-    { 16, 27, 22, 3, 26, 108, 19023 }, // Ŝ
-    { 12, 20, 18, 3, 19, 60, 19131 }, // ŝ
-    { 16, 23, 22, 3, 18, 92, 19191 }, // Ş
-    { 12, 19, 18, 3, 13, 57, 19283 }, // ş
-    { 16, 27, 22, 3, 26, 108, 19340 }, // Š
-    { 12, 21, 18, 3, 20, 63, 19448 }, // š
-    { 16, 24, 22, 3, 18, 96, 19511 }, // Ţ
-    { 11, 22, 16, 3, 17, 61, 19607 }, // ţ
-    { 16, 26, 22, 3, 26, 104, 19668 }, // Ť
-    { 14, 21, 16, 3, 20, 74, 19772 }, // ť
-    { 16, 18, 22, 3, 18, 72, 19846 }, // Ŧ
-    { 12, 18, 16, 2, 17, 54, 19918 }, // ŧ
-    { 16, 28, 22, 3, 27, 112, 19972 }, // Ũ
-    { 12, 20, 18, 3, 20, 60, 20084 }, // ũ
-    { 16, 28, 22, 3, 27, 112, 20144 }, // Ū
-    { 12, 19, 18, 3, 19, 57, 20256 }, // ū
-    { 16, 28, 22, 3, 27, 112, 20313 }, // Ŭ
-    { 12, 20, 18, 3, 20, 60, 20425 }, // ŭ
-    { 16, 29, 22, 3, 28, 116, 20485 }, // Ů
-    { 12, 21, 18, 3, 21, 63, 20601 }, // ů
-    { 18, 27, 22, 3, 26, 122, 20664 }, // Ű
-    { 18, 19, 18, 1, 19, 86, 20786 }, // ű
-    { 16, 23, 22, 3, 18, 92, 20872 }, // Ų
-    { 12, 18, 18, 3, 12, 54, 20964 }, // ų
-    { 24, 26, 30, 3, 26, 156, 21018 }, // Ŵ
-    { 17, 22, 23, 3, 21, 94, 21174 }, // ŵ
-    { 17, 28, 22, 3, 28, 119, 21268 }, // Ŷ
-    { 14, 29, 19, 3, 23, 102, 21387 }, // ŷ
-    { 17, 28, 22, 3, 28, 119, 21489 }, // Ÿ
-    { 17, 24, 23, 3, 24, 102, 21608 }, // Ź
-    { 13, 20, 18, 3, 20, 65, 21710 }, // ź
-    { 17, 24, 23, 3, 24, 102, 21775 }, // Ż
-    { 13, 20, 18, 3, 20, 65, 21877 }, // ż
-    { 17, 26, 23, 3, 26, 111, 21942 }, // Ž
-    { 13, 21, 18, 3, 21, 69, 22053 }, // ž
-    { 8, 17, 13, 2, 17, 34, 22122 }, // ſ
-    { 9, 4, 0, 0, 16, 9, 22156 }, // ̀
-    { 6, 5, 0, 0, 16, 8, 22165 }, // ́
-    { 12, 6, 0, 0, 1, 18, 22173 }, // ̂
-    { 8, 5, 0, 1, 16, 10, 22191 }, // ̃
-    { 12, 4, 0, 0, 15, 12, 22201 }, // ̄
-    { 15, 4, 0, 0, 19, 15, 22213 }, // ̅
-    { 11, 6, 0, 0, 16, 17, 22228 }, // ̆
-    { 5, 5, 0, 3, 17, 7, 22245 }, // ̇
-    { 10, 4, 0, 0, 15, 10, 22252 }, // ̈
-    { 5, 5, 0, 4, 14, 7, 22262 }, // ̉
-    { 5, 5, 0, 1, 16, 7, 22269 }, // ̊
-    { 19, 4, 0, 0, 16, 19, 22276 }, // ̋
-    { 12, 6, 0, 0, 17, 18, 22295 }, // ̌
-    { 18, 4, 0, -5, 16, 18, 22313 }, // ̏
-    { 7, 8, 0, 0, 17, 14, 22331 }, // ̒
-    { 8, 8, 0, 0, 16, 16, 22345 }, // ̓
-    { 8, 8, 0, -1, 16, 16, 22361 }, // ̔
-    { 5, 6, 0, 1, 0, 8, 22377 }, // ̘
-    { 5, 6, 0, 1, 0, 8, 22385 }, // ̙
-    { 10, 6, 0, 1, 17, 15, 22393 }, // ̚
-    { 5, 6, 0, 0, 14, 8, 22408 }, // ̛
-    { 4, 7, 0, 1, 0, 7, 22416 }, // ̜
-    { 6, 5, 0, 1, 3, 8, 22423 }, // ̝
-    { 6, 5, 0, 1, 0, 8, 22431 }, // ̞
-    { 5, 5, 0, 1, -2, 7, 22439 }, // ̟
-    { 12, 4, 0, 0, -2, 12, 22446 }, // ̠
-    { 6, 5, 0, 0, 2, 8, 22458 }, // ̣
-    { 10, 4, 0, 0, -1, 10, 22466 }, // ̤
-    { 5, 5, 0, 1, 16, 7, 22476 }, // ̥
-    { 7, 8, 0, 0, 4, 14, 22483 }, // ̦
-    { 6, 7, 0, 0, 1, 11, 22497 }, // ̧
-    { 6, 8, 0, 1, 2, 12, 22508 }, // ̨
-    { 5, 7, 0, 0, -1, 9, 22520 }, // ̩
-    { 9, 5, 0, 0, 0, 12, 22529 }, // ̪
-    { 13, 6, 0, -1, 1, 20, 22541 }, // ̬
-    { 13, 6, 0, -1, 1, 20, 22561 }, // ̭
-    { 9, 6, 0, 1, 18, 14, 22581 }, // ̰
-    { 10, 4, 0, 1, 18, 10, 22595 }, // ̱
-    { 11, 4, 0, 0, -1, 11, 22605 }, // ̲
-    { 9, 6, 0, 1, 18, 14, 22616 }, // ̴
-    { 11, 3, 0, 0, 8, 9, 22630 }, // ̵
-    { 5, 8, 0, 0, 1, 10, 22639 }, // ̹
-    { 10, 7, 0, 0, 1, 18, 22649 }, // ̺
-    { 9, 7, 0, 0, 1, 16, 22667 }, // ̻
-    { 9, 6, 0, 0, 1, 14, 22683 }, // ̼
-    { 7, 5, 0, 1, 16, 9, 22697 }, // ̽
-    { 8, 5, 0, 1, 16, 10, 22706 }, // ͂
-    { 4, 6, 0, 5, 19, 6, 22716 }, // ̓
-    { 10, 15, 0, 1, 26, 38, 22722 }, // ̈́
-    { 9, 5, 0, 0, 17, 12, 22760 }, // ͆
-    { 12, 8, 0, 0, 0, 24, 22772 }, // ͇
-    { 9, 7, 0, 1, 1, 16, 22796 }, // ͈
-    { 7, 6, 0, 1, -1, 11, 22812 }, // ͉
-    { 11, 16, 0, 1, 22, 44, 22823 }, // ͊
-    { 19, 16, 0, 1, 24, 76, 22867 }, // ͋
-    { 12, 12, 0, 9, 12, 36, 22943 }, // ͌
-    { 11, 6, 0, 1, -2, 17, 22979 }, // ͍
-    { 5, 4, 0, 0, 3, 5, 22996 }, // ͎
-    { 19, 6, 0, 0, 2, 29, 23001 }, // ͜
-    { 19, 6, 0, 0, 17, 29, 23030 }, // ͡
-    { 22, 7, 0, 1, 0, 39, 23059 }, // ͢
-    { 13, 25, 19, 3, 25, 82, 23098 }, // Ѐ
-    { 13, 26, 19, 3, 26, 85, 23180 }, // Ё
-    { 18, 20, 14, -3, 18, 90, 23265 }, // Ђ
-    { 12, 25, 14, 1, 24, 75, 23355 }, // Ѓ
-    { 16, 18, 17, 1, 16, 72, 23430 }, // Є
-    { 16, 19, 22, 3, 18, 76, 23502 }, // Ѕ
-    { 5, 18, 11, 3, 18, 23, 23578 }, // І
-    { 10, 26, 11, 0, 26, 65, 23601 }, // Ї
-    { 13, 23, 19, 3, 18, 75, 23666 }, // Ј
-    { 20, 18, 24, 2, 16, 90, 23741 }, // Љ
-    { 20, 17, 13, -4, 16, 85, 23831 }, // Њ
-    { 19, 19, 22, 3, 19, 91, 23916 }, // Ћ
-    { 16, 24, 22, 3, 24, 96, 24007 }, // Ќ
-    { 16, 27, 22, 3, 27, 108, 24103 }, // Ѝ
-    { 14, 27, 17, 1, 25, 95, 24211 }, // Ў
-    { 13, 21, 17, 2, 16, 69, 24306 }, // Џ
-    { 18, 18, 20, 1, 18, 81, 24375 }, // А
-    { 11, 17, 14, 1, 16, 47, 24456 }, // Б
-    { 12, 17, 14, 1, 16, 51, 24503 }, // В
-    { 12, 17, 14, 1, 16, 51, 24554 }, // Г
-    { 17, 19, 17, 0, 16, 81, 24605 }, // Д
-    { 13, 18, 19, 3, 18, 59, 24686 }, // Е
-    { 26, 18, 23, -1, 18, 117, 24745 }, // Ж
-    { 11, 16, 13, 1, 16, 44, 24862 }, // З
-    { 16, 18, 22, 3, 18, 72, 24906 }, // И
-    { 16, 28, 22, 3, 28, 112, 24978 }, // Й
-    { 16, 18, 22, 3, 18, 72, 25090 }, // К
-    { 14, 18, 13, -1, 16, 63, 25162 }, // Л
-    { 16, 17, 18, 1, 16, 68, 25225 }, // М
-    { 16, 18, 22, 3, 18, 72, 25293 }, // Н
-    { 18, 19, 24, 3, 18, 86, 25365 }, // О
-    { 13, 17, 14, 1, 16, 56, 25451 }, // П
-    { 13, 18, 19, 3, 18, 59, 25507 }, // Р
-    { 16, 19, 21, 2, 19, 76, 25566 }, // С
-    { 16, 18, 22, 3, 18, 72, 25642 }, // Т
-    { 14, 18, 17, 1, 16, 63, 25714 }, // У
-    { 16, 16, 18, 1, 16, 64, 25777 }, // Ф
-    { 17, 18, 23, 3, 18, 77, 25841 }, // Х
-    { 13, 20, 15, 1, 16, 65, 25918 }, // Ц
-    { 12, 16, 14, 1, 16, 48, 25983 }, // Ч
-    { 15, 17, 17, 1, 16, 64, 26031 }, // Ш
-    { 17, 20, 19, 1, 16, 85, 26095 }, // Щ
-    { 16, 16, 13, -4, 16, 64, 26180 }, // Ъ
-    { 20, 18, 24, 1, 18, 90, 26244 }, // Ы
-    { 11, 16, 13, 1, 16, 44, 26334 }, // Ь
-    { 16, 18, 17, 1, 16, 72, 26378 }, // Э
-    { 17, 16, 19, 1, 16, 68, 26450 }, // Ю
-    { 14, 18, 20, 3, 18, 63, 26518 }, // Я
-    { 12, 13, 18, 3, 13, 39, 26581 }, // а
-    { 13, 20, 14, 1, 19, 65, 26620 }, // б
-    { 11, 12, 15, 2, 12, 33, 26685 }, // в
-    { 11, 13, 12, 1, 12, 36, 26718 }, // г
-    { 15, 15, 16, 0, 12, 57, 26754 }, // д
-    { 12, 12, 18, 3, 12, 36, 26811 }, // е
-    { 24, 15, 30, 3, 15, 90, 26847 }, // ж
-    { 8, 11, 9, 1, 11, 22, 26937 }, // з
-    { 12, 13, 14, 1, 12, 39, 26959 }, // и
-    { 11, 20, 14, 1, 20, 55, 26998 }, // й
-    { 13, 12, 17, 2, 12, 39, 27053 }, // к
-    { 10, 13, 9, -1, 11, 33, 27092 }, // л
-    { 14, 13, 18, 2, 13, 46, 27125 }, // м
-    { 13, 13, 17, 2, 13, 43, 27171 }, // н
-    { 12, 12, 18, 3, 12, 36, 27214 }, // о
-    { 12, 13, 14, 1, 12, 39, 27250 }, // п
-    { 14, 19, 20, 3, 13, 67, 27289 }, // р
-    { 11, 13, 16, 3, 13, 36, 27356 }, // с
-    { 13, 13, 14, 1, 12, 43, 27392 }, // т
-    { 14, 18, 19, 3, 12, 63, 27435 }, // у
-    { 18, 17, 18, 0, 12, 77, 27498 }, // ф
-    { 15, 13, 15, 0, 12, 49, 27575 }, // х
-    { 13, 15, 15, 1, 12, 49, 27624 }, // ц
-    { 8, 11, 9, 1, 11, 22, 27673 }, // ч
-    { 15, 13, 17, 1, 12, 49, 27695 }, // ш
-    { 17, 16, 19, 1, 12, 68, 27744 }, // щ
-    { 12, 12, 10, -3, 12, 36, 27812 }, // ъ
-    { 16, 14, 18, 0, 14, 56, 27848 }, // ы
-    { 9, 12, 10, 0, 12, 27, 27904 }, // ь
-    { 11, 12, 13, 1, 12, 33, 27931 }, // э
-    { 14, 12, 15, 1, 12, 42, 27964 }, // ю
-    { 13, 13, 17, 2, 13, 43, 28006 }, // я
-    { 12, 22, 18, 3, 22, 66, 28049 }, // ѐ
-    { 12, 21, 18, 3, 21, 63, 28115 }, // ё
-    { 16, 21, 18, 0, 18, 84, 28178 }, // ђ
-    { 11, 18, 12, 1, 17, 50, 28262 }, // ѓ
-    { 12, 12, 12, 0, 11, 36, 28312 }, // є
-    { 12, 14, 18, 3, 13, 42, 28348 }, // ѕ
-    { 6, 19, 10, 2, 19, 29, 28390 }, // і
-    { 10, 18, 10, 0, 18, 45, 28419 }, // ї
-    { 8, 25, 13, 3, 19, 50, 28464 }, // ј
-    { 15, 13, 17, 1, 11, 49, 28514 }, // љ
-    { 14, 12, 9, -3, 12, 42, 28563 }, // њ
-    { 16, 18, 18, 0, 18, 72, 28605 }, // ћ
-    { 13, 18, 17, 2, 18, 59, 28677 }, // ќ
-    { 12, 20, 14, 1, 19, 60, 28736 }, // ѝ
-    { 14, 28, 19, 3, 22, 98, 28796 }, // ў
-    { 10, 15, 12, 1, 12, 38, 28894 }, // џ
-    { 15, 18, 16, 0, 16, 68, 28932 }, // Ѣ
-    { 15, 18, 14, -1, 16, 68, 29000 }, // ѣ
-    { 20, 17, 18, -1, 16, 85, 29068 }, // Ѫ
-    { 14, 12, 13, -1, 12, 42, 29153 }, // ѫ
-    { 16, 23, 23, 4, 23, 92, 29195 }, // Ѳ
-    { 13, 17, 18, 3, 17, 56, 29287 }, // ѳ
-    { 20, 22, 24, 3, 22, 110, 29343 }, // Ѵ
-    { 14, 15, 18, 2, 15, 53, 29453 }, // ѵ
-    { 9, 8, 0, 2, 20, 18, 29506 }, // ҆
-    { 12, 19, 14, 1, 18, 57, 29524 }, // Ґ
-    { 11, 16, 12, 1, 15, 44, 29581 }, // ґ
-    { 14, 17, 14, -1, 16, 60, 29625 }, // Ғ
-    { 10, 11, 9, -1, 11, 28, 29685 }, // ғ
-    { 14, 20, 13, -1, 18, 70, 29713 }, // Ҕ
-    { 8, 12, 8, 0, 11, 24, 29783 }, // ҕ
-    { 27, 22, 30, 2, 18, 149, 29807 }, // Җ
-    { 19, 15, 21, 1, 12, 72, 29956 }, // җ
-    { 11, 19, 13, 1, 16, 53, 30028 }, // Ҙ
-    { 8, 17, 9, 1, 11, 34, 30081 }, // ҙ
-    { 17, 22, 15, 2, 18, 94, 30115 }, // Қ
-    { 12, 15, 10, 1, 12, 45, 30209 }, // қ
-    { 20, 18, 23, 1, 17, 90, 30254 }, // Ҝ
-    { 14, 12, 16, 1, 12, 42, 30344 }, // ҝ
-    { 16, 18, 22, 3, 18, 72, 30386 }, // Ҟ
-    { 15, 18, 19, 1, 18, 68, 30458 }, // ҟ
-    { 19, 18, 22, 0, 18, 86, 30526 }, // Ҡ
-    { 13, 12, 15, 0, 12, 39, 30612 }, // ҡ
-    { 17, 21, 16, 0, 18, 90, 30651 }, // Ң
-    { 12, 14, 11, 0, 12, 42, 30741 }, // ң
-    { 23, 18, 22, 3, 18, 104, 30783 }, // Ҥ
-    { 16, 12, 15, 2, 12, 48, 30887 }, // ҥ
-    { 23, 20, 27, 2, 18, 115, 30935 }, // Ҧ
-    { 20, 22, 26, 3, 15, 110, 31050 }, // ҧ
-    { 21, 17, 14, -3, 16, 90, 31160 }, // Ҩ
-    { 17, 14, 11, -3, 13, 60, 31250 }, // ҩ
-    { 16, 22, 21, 2, 19, 88, 31310 }, // Ҫ
-    { 11, 16, 16, 3, 13, 44, 31398 }, // ҫ
-    { 17, 21, 16, 0, 18, 90, 31442 }, // Ҭ
-    { 12, 14, 11, 0, 12, 42, 31532 }, // ҭ
-    { 17, 18, 22, 3, 18, 77, 31574 }, // Ү
-    { 13, 17, 16, 1, 12, 56, 31651 }, // ү
-    { 17, 18, 22, 3, 18, 77, 31707 }, // Ұ
-    { 14, 17, 16, 1, 12, 60, 31784 }, // ұ
-    { 17, 21, 16, 3, 18, 90, 31844 }, // Ҳ
-    { 12, 14, 11, 2, 12, 42, 31934 }, // ҳ
-    { 19, 20, 13, -3, 15, 95, 31976 }, // Ҵ
-    { 15, 14, 9, -3, 11, 53, 32071 }, // ҵ
-    { 14, 21, 14, 0, 16, 74, 32124 }, // Ҷ
-    { 10, 15, 10, 0, 11, 38, 32198 }, // ҷ
-    { 12, 16, 14, 1, 16, 48, 32236 }, // Ҹ
-    { 8, 11, 9, 1, 11, 22, 32284 }, // ҹ
-    { 13, 19, 14, 1, 18, 62, 32306 }, // Һ
-    { 13, 18, 18, 3, 18, 59, 32368 }, // һ
-    { 23, 17, 20, -4, 16, 98, 32427 }, // Ҽ
-    { 17, 12, 15, -3, 12, 51, 32525 }, // ҽ
-    { 23, 20, 19, -3, 16, 115, 32576 }, // Ҿ
-    { 17, 15, 13, -2, 12, 64, 32691 }, // ҿ
-    { 5, 18, 11, 3, 18, 23, 32755 }, // Ӏ
-    { 26, 28, 23, -1, 28, 182, 32778 }, // Ӂ
-    { 24, 24, 30, 3, 24, 144, 32960 }, // ӂ
-    { 13, 22, 15, 1, 16, 72, 33104 }, // Ӄ
-    { 10, 16, 10, 0, 12, 40, 33176 }, // ӄ
-    { 16, 21, 13, -1, 16, 84, 33216 }, // Ӆ
-    { 11, 14, 9, -1, 11, 39, 33300 }, // ӆ
-    { 17, 24, 22, 3, 18, 102, 33339 }, // Ӈ
-    { 12, 16, 15, 2, 12, 48, 33441 }, // ӈ
-    { 17, 25, 22, 3, 18, 107, 33489 }, // Ӊ
-    { 12, 17, 15, 2, 12, 51, 33596 }, // ӊ
-    { 12, 21, 14, 1, 16, 63, 33647 }, // Ӌ
-    { 9, 14, 13, 2, 11, 32, 33710 }, // ӌ
-    { 20, 26, 24, 3, 18, 130, 33742 }, // Ӎ
-    { 14, 17, 17, 2, 12, 60, 33872 }, // ӎ
-    { 5, 16, 13, 4, 15, 20, 33932 }, // ӏ
-    { 18, 25, 20, 1, 25, 113, 33952 }, // Ӑ
-    { 12, 20, 18, 3, 20, 60, 34065 }, // ӑ
-    { 18, 24, 20, 1, 24, 108, 34125 }, // Ӓ
-    { 13, 20, 18, 2, 20, 65, 34233 }, // ӓ
-    { 26, 19, 28, 1, 18, 124, 34298 }, // Ӕ
-    { 20, 13, 26, 3, 13, 65, 34422 }, // ӕ
-    { 13, 26, 19, 3, 26, 85, 34487 }, // Ӗ
-    { 12, 22, 18, 3, 22, 66, 34572 }, // ӗ
-    { 15, 18, 22, 4, 17, 68, 34638 }, // Ә
-    { 12, 14, 18, 4, 13, 42, 34706 }, // ә
-    { 15, 24, 22, 4, 23, 90, 34748 }, // Ӛ
-    { 12, 17, 18, 4, 13, 51, 34838 }, // ӛ
-    { 26, 27, 29, 2, 27, 176, 34889 }, // Ӝ
-    { 24, 23, 30, 3, 23, 138, 35065 }, // ӝ
-    { 11, 25, 13, 1, 25, 69, 35203 }, // Ӟ
-    { 10, 16, 9, -1, 16, 40, 35272 }, // ӟ
-    { 11, 17, 14, 2, 16, 47, 35312 }, // Ӡ
-    { 11, 17, 14, 2, 12, 47, 35359 }, // ӡ
-    { 16, 27, 22, 3, 27, 108, 35406 }, // Ӣ
-    { 12, 20, 14, 1, 19, 60, 35514 }, // ӣ
-    { 16, 26, 22, 3, 26, 104, 35574 }, // Ӥ
-    { 12, 19, 14, 1, 18, 57, 35678 }, // ӥ
-    { 18, 25, 24, 3, 24, 113, 35735 }, // Ӧ
-    { 13, 21, 18, 2, 21, 69, 35848 }, // ӧ
-    { 16, 17, 23, 4, 17, 68, 35917 }, // Ө
-    { 12, 12, 18, 3, 12, 36, 35985 }, // ө
-    { 16, 23, 23, 4, 23, 92, 36021 }, // Ӫ
-    { 12, 18, 18, 3, 18, 54, 36113 }, // ӫ
-    { 16, 27, 17, 1, 25, 108, 36167 }, // Ӭ
-    { 11, 17, 13, 1, 17, 47, 36275 }, // ӭ
-    { 14, 27, 17, 1, 25, 95, 36322 }, // Ӯ
-    { 14, 28, 19, 3, 22, 98, 36417 }, // ӯ
-    { 14, 26, 17, 1, 24, 91, 36515 }, // Ӱ
-    { 14, 27, 19, 3, 21, 95, 36606 }, // ӱ
-    { 18, 26, 17, 1, 24, 117, 36701 }, // Ӳ
-    { 19, 27, 19, 2, 21, 129, 36818 }, // ӳ
-    { 12, 20, 14, 1, 20, 60, 36947 }, // Ӵ
-    { 10, 15, 9, 0, 15, 38, 37007 }, // ӵ
-    { 12, 19, 14, 1, 16, 57, 37045 }, // Ӷ
-    { 9, 13, 9, 0, 11, 30, 37102 }, // ӷ
-    { 20, 27, 24, 1, 27, 135, 37132 }, // Ӹ
-    { 16, 22, 18, 0, 22, 88, 37267 }, // ӹ
-    { 19, 20, 23, 3, 18, 95, 37355 }, // Ӽ
-    { 14, 14, 16, 2, 12, 49, 37450 }, // ӽ
-    { 0, 0, 14, 0, 0, 0, 37499 }, //  
-    { 0, 0, 24, 0, 0, 0, 37499 }, //  
-    { 0, 0, 14, 0, 0, 0, 37499 }, //  
-    { 0, 0, 24, 0, 0, 0, 37499 }, //  
-    { 0, 0, 10, 0, 0, 0, 37499 }, //  
-    { 0, 0, 9, 0, 0, 0, 37499 }, //  
-    { 0, 0, 7, 0, 0, 0, 37499 }, //  
-    { 0, 0, 15, 0, 0, 0, 37499 }, //  
-    { 0, 0, 5, 0, 0, 0, 37499 }, //  
-    { 0, 0, 8, 0, 0, 0, 37499 }, //  
-    { 0, 0, 6, 0, 0, 0, 37499 }, //  
-    { 0, 0, 3, 0, 0, 0, 37499 }, // ​
-    { 0, 0, 0, 0, 0, 0, 37499 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 37499 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 37499 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 37499 }, // ‏
-    { 11, 3, 11, 0, 8, 9, 37499 }, // ‐
-    { 11, 3, 11, 0, 8, 9, 37508 }, // ‑
-    { 17, 3, 11, -3, 8, 13, 37517 }, // ‒
-    { 15, 5, 17, 1, 9, 19, 37530 }, // –
-    { 22, 5, 24, 1, 9, 28, 37549 }, // —
-    { 22, 5, 24, 1, 9, 28, 37577 }, // ―
-    { 10, 19, 11, 2, 15, 48, 37605 }, // ‖
-    { 18, 8, 11, -3, -1, 36, 37653 }, // ‗
-    { 7, 8, 9, 1, 19, 14, 37689 }, // ‘
-    { 7, 8, 9, 1, 19, 14, 37703 }, // ’
-    { 7, 8, 7, 0, 4, 14, 37717 }, // ‚
-    { 7, 8, 9, 1, 19, 14, 37731 }, // ‛
-    { 14, 8, 16, 1, 19, 28, 37745 }, // “
-    { 14, 8, 16, 1, 19, 28, 37773 }, // ”
-    { 7, 8, 7, 0, 4, 14, 37801 }, // „
-    { 14, 8, 16, 1, 19, 28, 37815 }, // ‟
-    { 13, 30, 17, 2, 22, 98, 37843 }, // †
-    { 13, 29, 18, 3, 21, 95, 37941 }, // ‡
-    { 17, 16, 11, -3, 19, 68, 38036 }, // •
-    { 7, 8, 13, 3, 10, 14, 38104 }, // ‣
-    { 6, 5, 13, 3, 5, 8, 38118 }, // ․
-    { 6, 5, 13, 3, 5, 8, 38126 }, // ‥
-    { 20, 5, 20, 0, 5, 25, 38134 }, // …
-    { 3, 3, 11, 4, 8, 3, 38159 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 38162 }, //  
-    { 16, 19, 24, 4, 17, 76, 38162 }, // ‰
-    { 8, 8, 11, 3, 19, 16, 38238 }, // ′
-    { 15, 8, 16, 3, 19, 30, 38254 }, // ″
-    { 17, 7, 9, 1, 18, 30, 38284 }, // ‴
-    { 6, 7, 9, 1, 18, 11, 38314 }, // ‵
-    { 10, 7, 9, 0, 18, 18, 38325 }, // ‶
-    { 17, 7, 9, -4, 18, 30, 38343 }, // ‷
-    { 12, 5, 14, 1, 18, 15, 38373 }, // ‸
-    { 7, 12, 9, 1, 12, 21, 38388 }, // ‹
-    { 7, 12, 9, 1, 12, 21, 38409 }, // ›
-    { 22, 28, 28, 4, 22, 154, 38430 }, // ※
-    { 6, 27, 13, 3, 24, 41, 38584 }, // ‼
-    { 13, 33, 18, 2, 28, 108, 38625 }, // ‽
-    { 11, 3, 11, 0, 18, 9, 38733 }, // ‾
-    { 11, 4, 12, 0, 14, 11, 38742 }, // ‿
-    { 15, 15, 13, -1, 19, 57, 38753 }, // ⁂
-    { 14, 18, 26, 6, 16, 63, 38810 }, // ⁄
-    { 26, 27, 31, 3, 24, 176, 38873 }, // ⁇
-    { 22, 28, 25, 2, 24, 154, 39049 }, // ⁈
-    { 17, 27, 16, -1, 24, 115, 39203 }, // ⁉
-    { 16, 36, 19, 2, 25, 144, 39318 }, // ⁒
-    { 0, 0, 97, 0, 0, 0, 39462 }, //  
-    { 7, 9, 7, 0, 18, 16, 39462 }, // ⁰
-    { 7, 8, 7, 0, 18, 14, 39478 }, // ⁴
-    { 7, 9, 7, 0, 18, 16, 39492 }, // ⁵
-    { 7, 9, 7, 0, 18, 16, 39508 }, // ⁶
-    { 7, 9, 8, 0, 18, 16, 39524 }, // ⁷
-    { 7, 9, 8, 0, 18, 16, 39540 }, // ⁸
-    { 7, 10, 8, 0, 18, 18, 39556 }, // ⁹
-    { 12, 13, 18, 3, 13, 39, 39574 }, // ⁿ
-    { 7, 9, 7, 0, 5, 16, 39613 }, // ₀
-    { 7, 9, 7, 0, 5, 16, 39629 }, // ₁
-    { 7, 9, 8, 0, 5, 16, 39645 }, // ₂
-    { 7, 9, 7, 0, 5, 16, 39661 }, // ₃
-    { 7, 8, 8, 0, 5, 14, 39677 }, // ₄
-    { 7, 9, 7, 0, 5, 16, 39691 }, // ₅
-    { 7, 9, 8, 0, 5, 16, 39707 }, // ₆
-    { 7, 10, 8, 0, 6, 18, 39723 }, // ₇
-    { 7, 9, 8, 0, 5, 16, 39741 }, // ₈
-    { 7, 9, 8, 0, 5, 16, 39757 }, // ₉
-    { 9, 29, 10, 1, 22, 66, 39773 }, // ₍
-    { 9, 29, 9, -1, 22, 66, 39839 }, // ₎
-    { 16, 27, 21, 2, 23, 108, 39905 }, // ₡
-    { 16, 19, 21, 2, 19, 76, 40013 }, // ₢
-    { 14, 19, 14, 0, 18, 67, 40089 }, // ₤
-    { 23, 18, 22, -1, 18, 104, 40156 }, // ₦
-    { 19, 18, 19, 0, 18, 86, 40260 }, // ₧
-    { 23, 19, 27, 2, 18, 110, 40346 }, // ₨
-    { 18, 18, 18, 0, 18, 81, 40456 }, // ₩
-    { 16, 16, 22, 3, 16, 64, 40537 }, // ₪
-    { 16, 18, 11, -2, 17, 72, 40601 }, // ₫
-    { 15, 20, 16, 0, 17, 75, 40673 }, // €
-    { 16, 18, 22, 3, 18, 72, 40748 }, // ₮
-    { 21, 18, 13, -1, 18, 95, 40820 }, // ₱
-    { 18, 27, 24, 3, 23, 122, 40915 }, // ₲
-    { 21, 18, 22, 4, 17, 95, 41037 }, // ₴
-    { 11, 17, 12, 3, 15, 47, 41132 }, // ₵
-    { 18, 19, 22, 2, 19, 86, 41179 }, // ₸
-    { 12, 17, 14, 1, 16, 51, 41265 }, // ₹
-    { 13, 16, 14, 1, 14, 52, 41316 }, // ₺
-    { 15, 17, 17, 1, 17, 64, 41368 }, // ₼
-    { 18, 18, 19, -2, 18, 81, 41432 }, // ₽
-    { 15, 14, 15, 0, 12, 53, 41513 }, // ←
-    { 16, 15, 16, 0, 14, 60, 41566 }, // ↑
-    { 14, 14, 16, 1, 12, 49, 41626 }, // →
-    { 16, 14, 16, 0, 13, 56, 41675 }, // ↓
-    { 17, 12, 21, 2, 12, 51, 41731 }, // ↔
-    { 13, 17, 17, 2, 19, 56, 41782 }, // ↕
-    { 12, 12, 16, 2, 12, 36, 41838 }, // ↖
-    { 13, 12, 13, 0, 12, 39, 41874 }, // ↗
-    { 13, 12, 13, 0, 12, 39, 41913 }, // ↘
-    { 12, 12, 13, 1, 12, 36, 41952 }, // ↙
-    { 16, 14, 20, 2, 13, 56, 41988 }, // ⇐
-    { 18, 17, 22, 2, 16, 77, 42044 }, // ⇑
-    { 16, 14, 20, 2, 13, 56, 42121 }, // ⇒
-    { 18, 17, 22, 2, 15, 77, 42177 }, // ⇓
-    { 19, 14, 23, 2, 13, 67, 42254 }, // ⇔
-    { 14, 18, 19, 2, 10, 63, 42321 }, // ⇕
-    { 13, 19, 14, 1, 18, 62, 42384 }, // ∂
-    { 21, 20, 24, 1, 19, 105, 42446 }, // ∅
-    { 16, 17, 18, 1, 16, 68, 42551 }, // ∆
-    { 14, 16, 15, 1, 15, 56, 42619 }, // ∏
-    { 14, 17, 15, 1, 16, 60, 42675 }, // ∐
-    { 11, 16, 12, 1, 15, 44, 42735 }, // ∑
-    { 12, 4, 13, 0, 8, 12, 42779 }, // −
-    { 18, 19, 20, 1, 18, 86, 42791 }, // √
-    { 17, 12, 19, 1, 14, 51, 42877 }, // ∞
-    { 17, 23, 18, 0, 17, 98, 42928 }, // ∫
-    { 6, 14, 7, 0, 14, 21, 43026 }, // ∶
-    { 12, 12, 30, 9, 12, 36, 43047 }, // ≈
-    { 16, 19, 26, 5, 17, 76, 43083 }, // ≠
-    { 18, 18, 17, -1, 16, 81, 43159 }, // ≤
-    { 18, 18, 18, 0, 16, 81, 43240 }, // ≥
+    { 13, 18, 19, 3, 18, 59, 2048 }, // E
+    { 12, 18, 18, 3, 18, 54, 2107 }, // F
+    { 18, 19, 24, 3, 19, 86, 2161 }, // G
+    { 16, 18, 22, 3, 18, 72, 2247 }, // H
+    { 5, 18, 11, 3, 18, 23, 2319 }, // I
+    { 13, 23, 19, 3, 18, 75, 2342 }, // J
+    { 16, 18, 22, 3, 18, 72, 2417 }, // K
+    { 13, 18, 19, 3, 18, 59, 2489 }, // L
+    { 18, 18, 24, 3, 18, 81, 2548 }, // M
+    { 16, 18, 22, 3, 18, 72, 2629 }, // N
+    { 18, 19, 24, 3, 18, 86, 2701 }, // O
+    { 13, 18, 19, 3, 18, 59, 2787 }, // P
+    { 19, 22, 22, 2, 19, 105, 2846 }, // Q
+    { 14, 18, 20, 3, 18, 63, 2951 }, // R
+    { 16, 19, 22, 3, 18, 76, 3014 }, // S
+    { 16, 18, 22, 3, 18, 72, 3090 }, // T
+    { 16, 19, 22, 3, 18, 76, 3162 }, // U
+    { 18, 18, 24, 3, 18, 81, 3238 }, // V
+    { 24, 18, 30, 3, 18, 108, 3319 }, // W
+    { 17, 18, 23, 3, 18, 77, 3427 }, // X
+    { 17, 18, 22, 3, 18, 77, 3504 }, // Y
+    { 17, 18, 23, 3, 18, 77, 3581 }, // Z
+    { 8, 31, 10, 1, 23, 62, 3658 }, // [
+    { 8, 24, 10, 1, 18, 48, 3720 }, // <backslash>
+    { 8, 31, 10, 1, 23, 62, 3768 }, // ]
+    { 12, 6, 12, 0, 21, 18, 3830 }, // ^
+    { 16, 5, 14, -1, -1, 20, 3848 }, // _
+    { 9, 4, 9, 0, 16, 9, 3868 }, // `
+    { 12, 13, 18, 3, 13, 39, 3877 }, // a
+    { 13, 19, 18, 3, 18, 62, 3916 }, // b
+    { 11, 13, 16, 3, 13, 36, 3978 }, // c
+    { 13, 18, 18, 3, 18, 59, 4014 }, // d
+    { 12, 12, 18, 3, 12, 36, 4096 }, // e
+    { 9, 17, 14, 3, 17, 39, 4132 }, // f
+    { 12, 19, 18, 3, 12, 57, 4171 }, // g
+    { 13, 18, 18, 3, 18, 59, 4228 }, // h
+    { 6, 19, 10, 2, 19, 29, 4287 }, // i
+    { 8, 25, 13, 3, 19, 50, 4316 }, // j
+    { 13, 18, 19, 3, 18, 59, 4366 }, // k
+    { 7, 18, 12, 3, 18, 32, 4425 }, // l
+    { 20, 13, 26, 3, 13, 65, 4457 }, // m
+    { 12, 13, 18, 3, 13, 39, 4522 }, // n
+    { 12, 12, 18, 3, 12, 36, 4561 }, // o
+    { 14, 19, 20, 3, 13, 67, 4597 }, // p
+    { 15, 19, 20, 3, 13, 72, 4664 }, // q
+    { 9, 12, 15, 3, 12, 27, 4736 }, // r
+    { 12, 14, 18, 3, 13, 42, 4763 }, // s
+    { 11, 18, 16, 3, 17, 50, 4805 }, // t
+    { 12, 12, 18, 3, 12, 36, 4855 }, // u
+    { 15, 12, 21, 3, 12, 45, 4891 }, // v
+    { 17, 13, 23, 3, 12, 56, 4936 }, // w
+    { 15, 12, 20, 3, 12, 45, 4992 }, // x
+    { 14, 18, 19, 3, 12, 63, 5037 }, // y
+    { 13, 12, 18, 3, 12, 39, 5100 }, // z
+    { 11, 21, 12, 0, 16, 58, 5139 }, // {
+    { 4, 19, 8, 2, 15, 19, 5197 }, // |
+    { 11, 21, 12, 0, 16, 58, 5216 }, // }
+    { 8, 5, 10, 1, 16, 10, 5274 }, // ~
+    { 0, 0, 18, 0, 0, 0, 5284 }, //  
+    { 7, 27, 16, 4, 23, 48, 5284 }, // ¡
+    { 11, 20, 16, 3, 16, 55, 5332 }, // ¢
+    { 14, 19, 14, 0, 18, 67, 5387 }, // £
+    { 14, 13, 14, 0, 14, 46, 5454 }, // ¤
+    { 16, 19, 16, 0, 16, 76, 5500 }, // ¥
+    { 3, 19, 8, 2, 15, 15, 5576 }, // ¦
+    { 12, 19, 16, 2, 17, 57, 5591 }, // §
+    { 11, 5, 11, 0, 17, 14, 5648 }, // ¨
+    { 10, 9, 14, 2, 20, 23, 5662 }, // ©
+    { 7, 7, 14, 4, 16, 13, 5685 }, // ª
+    { 12, 12, 11, 0, 12, 36, 5698 }, // «
+    { 11, 8, 13, 1, 8, 22, 5734 }, // ¬
+    { 11, 3, 13, 1, 8, 9, 5756 }, // ­
+    { 10, 9, 14, 2, 23, 23, 5765 }, // ®
+    { 10, 4, 11, 0, 16, 10, 5788 }, // ¯
+    { 10, 10, 14, 2, 16, 25, 5798 }, // °
+    { 12, 14, 13, 0, 12, 42, 5823 }, // ±
+    { 6, 8, 7, 0, 17, 12, 5865 }, // ²
+    { 7, 8, 7, 0, 17, 14, 5877 }, // ³
+    { 6, 5, 6, 0, 16, 8, 5891 }, // ´
+    { 13, 15, 18, 2, 12, 49, 5899 }, // µ
+    { 12, 18, 16, 2, 15, 54, 5948 }, // ¶
+    { 5, 5, 5, 0, 10, 7, 6002 }, // ·
+    { 6, 7, 7, 0, 1, 11, 6009 }, // ¸
+    { 6, 8, 6, 0, 17, 12, 6020 }, // ¹
+    { 7, 7, 14, 4, 15, 13, 6032 }, // º
+    { 12, 12, 16, 2, 12, 36, 6045 }, // »
+    { 19, 20, 26, 3, 18, 95, 6144 }, // ¼
+    { 21, 20, 26, 3, 18, 105, 6239 }, // ½
+    { 19, 19, 26, 3, 17, 91, 6344 }, // ¾
+    { 13, 26, 14, 0, 15, 85, 6435 }, // ¿
+    { 18, 24, 20, 1, 24, 108, 6520 }, // À
+    { 18, 28, 20, 1, 28, 126, 6628 }, // Á
+    { 18, 26, 20, 1, 26, 117, 6754 }, // Â
+    { 18, 25, 20, 1, 25, 113, 6871 }, // Ã
+    { 18, 25, 20, 1, 25, 113, 6984 }, // Ä
+    { 18, 25, 20, 1, 25, 113, 7097 }, // Å
+    { 26, 19, 28, 1, 18, 124, 7210 }, // Æ
+    { 16, 25, 21, 2, 19, 100, 7334 }, // Ç
+    { 13, 25, 19, 3, 25, 82, 7434 }, // È
+    { 13, 28, 19, 3, 28, 91, 7516 }, // É
+    { 13, 26, 19, 3, 26, 85, 7607 }, // Ê
+    { 13, 26, 19, 3, 26, 85, 7692 }, // Ë
+    { 9, 26, 11, 0, 26, 59, 7777 }, // Ì
+    { 5, 29, 11, 3, 29, 37, 7836 }, // Í
+    { 12, 27, 11, 0, 27, 81, 7873 }, // Î
+    { 11, 27, 11, 0, 27, 75, 7954 }, // Ï
+    { 20, 18, 22, -1, 18, 90, 8029 }, // Ð
+    { 16, 25, 22, 3, 25, 100, 8192 }, // Ñ
+    { 18, 25, 24, 3, 24, 113, 8292 }, // Ò
+    { 18, 28, 24, 3, 27, 126, 8405 }, // Ó
+    { 18, 27, 24, 3, 26, 122, 8531 }, // Ô
+    { 18, 26, 24, 3, 25, 117, 8653 }, // Õ
+    { 18, 26, 24, 3, 25, 117, 8770 }, // Ö
+    { 13, 7, 12, 0, 9, 23, 8887 }, // ×
+    { 30, 41, 24, -3, 30, 308, 8910 }, // Ø
+    { 16, 26, 22, 3, 25, 104, 9218 }, // Ù
+    { 16, 30, 22, 3, 29, 120, 9322 }, // Ú
+    { 16, 28, 22, 3, 27, 112, 9442 }, // Û
+    { 16, 28, 22, 3, 27, 112, 9554 }, // Ü
+    { 17, 30, 22, 3, 30, 128, 9666 }, // Ý
+    { 10, 17, 12, 1, 17, 43, 9794 }, // Þ
+    { 13, 17, 14, 1, 16, 56, 9837 }, // ß
+    { 12, 19, 18, 3, 19, 57, 9893 }, // à
+    { 12, 22, 18, 3, 22, 66, 9950 }, // á
+    { 12, 20, 18, 3, 20, 60, 10016 }, // â
+    { 12, 19, 18, 3, 19, 57, 10076 }, // ã
+    { 12, 20, 18, 3, 20, 60, 10133 }, // ä
+    { 12, 20, 18, 3, 20, 60, 10240 }, // å
+    { 20, 13, 26, 3, 13, 65, 10300 }, // æ
+    { 11, 18, 16, 3, 13, 50, 10365 }, // ç
+    { 12, 21, 18, 3, 21, 63, 10415 }, // è
+    { 12, 24, 18, 3, 24, 72, 10478 }, // é
+    { 12, 22, 18, 3, 22, 66, 10550 }, // ê
+    { 12, 22, 18, 3, 22, 66, 10616 }, // ë
+    { 9, 18, 10, 0, 18, 41, 10682 }, // ì
+    { 5, 21, 10, 3, 21, 27, 10723 }, // í
+    { 12, 19, 10, -1, 19, 57, 10750 }, // î
+    { 10, 18, 10, 0, 18, 45, 10807 }, // ï
+    { 17, 19, 14, -1, 18, 81, 10852 }, // ð
+    { 12, 20, 18, 3, 20, 60, 10933 }, // ñ
+    { 12, 18, 18, 3, 18, 54, 10993 }, // ò
+    { 12, 22, 18, 3, 22, 66, 11047 }, // ó
+    { 12, 20, 18, 3, 20, 60, 11113 }, // ô
+    { 12, 19, 18, 3, 19, 57, 11173 }, // õ
+    { 12, 19, 18, 3, 19, 57, 11230 }, // ö
+    { 16, 15, 19, 1, 15, 60, 11287 }, // ÷
+    { 14, 35, 18, 2, 24, 123, 11347 }, // ø
+    { 12, 18, 18, 3, 18, 54, 11470 }, // ù
+    { 12, 22, 18, 3, 22, 66, 11524 }, // ú
+    { 12, 20, 18, 3, 20, 60, 11590 }, // û
+    { 12, 20, 18, 3, 20, 60, 11650 }, // ü
+    { 14, 31, 19, 3, 25, 109, 11710 }, // ý
+    { 10, 22, 12, 1, 17, 55, 11819 }, // þ
+    { 14, 28, 19, 3, 22, 98, 11874 }, // ÿ
+    { 18, 25, 20, 1, 25, 113, 11972 }, // Ā
+    { 12, 20, 18, 3, 20, 60, 12085 }, // ā
+    { 18, 26, 20, 1, 26, 117, 12145 }, // Ă
+    { 12, 20, 18, 3, 20, 60, 12288 }, // ă
+    { 18, 24, 20, 1, 18, 108, 12348 }, // Ą
+    { 13, 19, 18, 3, 13, 62, 12456 }, // ą
+    { 16, 25, 21, 2, 25, 100, 12518 }, // Ć
+    { 11, 18, 16, 3, 18, 50, 12618 }, // ć
+    { 16, 27, 21, 2, 27, 108, 12668 }, // Ĉ
+    { 12, 19, 16, 2, 19, 57, 12776 }, // ĉ
+    { 16, 25, 21, 2, 25, 100, 12833 }, // Ċ
+    { 11, 18, 16, 3, 18, 50, 12933 }, // ċ
+    { 16, 27, 21, 2, 27, 108, 12983 }, // Č
+    { 12, 20, 16, 3, 20, 60, 13091 }, // č
+    { 16, 27, 22, 3, 27, 108, 13151 }, // Ď
+    { 17, 18, 18, 3, 18, 77, 13259 }, // ď
+    { 20, 18, 22, -1, 18, 90, 13336 }, // Đ
+    { 16, 18, 18, 3, 18, 72, 13426 }, // đ
+    { 13, 26, 19, 3, 26, 85, 13498 }, // Ē
+    { 12, 22, 18, 3, 22, 66, 13583 }, // ē
+    { 13, 26, 19, 3, 26, 85, 13649 }, // Ĕ
+    { 12, 22, 18, 3, 22, 66, 13734 }, // ĕ
+    { 13, 26, 19, 3, 26, 85, 13800 }, // Ė
+    { 12, 22, 18, 3, 22, 66, 13885 }, // ė
+    { 13, 23, 19, 3, 18, 75, 13951 }, // Ę
+    { 12, 20, 18, 3, 12, 60, 14026 }, // ę
+    { 13, 28, 19, 3, 28, 91, 14086 }, // Ě
+    { 12, 24, 18, 3, 24, 72, 14177 }, // ě
+    { 18, 29, 24, 3, 29, 131, 14336 }, // Ĝ
+    { 13, 28, 18, 3, 21, 91, 14467 }, // ĝ
+    { 18, 28, 24, 3, 28, 126, 14558 }, // Ğ
+    { 12, 27, 18, 3, 20, 81, 14684 }, // ğ
+    { 18, 28, 24, 3, 28, 126, 14765 }, // Ġ
+    { 12, 27, 18, 3, 20, 81, 14891 }, // ġ
+    { 18, 31, 24, 3, 31, 140, 14972 }, // Ģ
+    { 12, 28, 18, 3, 21, 84, 15112 }, // ģ
+    { 16, 26, 22, 3, 26, 104, 15196 }, // Ĥ
+    { 16, 26, 18, 0, 26, 104, 15300 }, // ĥ
+    { 18, 18, 22, 2, 18, 81, 15404 }, // Ħ
+    { 16, 18, 18, 0, 18, 72, 15485 }, // ħ
+    { 9, 27, 11, 1, 27, 61, 15557 }, // Ĩ
+    { 8, 20, 10, 1, 20, 40, 15618 }, // ĩ
+    { 12, 27, 11, -1, 27, 81, 15658 }, // Ī
+    { 12, 19, 10, -1, 19, 57, 15739 }, // ī
+    { 6, 23, 11, 2, 18, 35, 15796 }, // Į
+    { 6, 25, 10, 2, 19, 38, 15831 }, // į
+    { 5, 27, 11, 3, 27, 34, 15869 }, // İ
+    { 4, 12, 10, 3, 12, 12, 15903 }, // ı
+    { 17, 26, 33, 7, 18, 111, 15915 }, // Ĳ
+    { 13, 24, 10, 2, 19, 78, 16026 }, // ĳ
+    { 14, 31, 19, 3, 26, 109, 16104 }, // Ĵ
+    { 12, 27, 13, 2, 21, 81, 16213 }, // ĵ
+    { 16, 29, 22, 3, 29, 116, 16384 }, // Ķ
+    { 13, 29, 19, 3, 18, 95, 16500 }, // ķ
+    { 10, 12, 14, 2, 12, 30, 16595 }, // ĸ
+    { 13, 24, 19, 3, 24, 78, 16625 }, // Ĺ
+    { 7, 27, 12, 3, 27, 48, 16703 }, // ĺ
+    { 15, 28, 19, 1, 28, 105, 16751 }, // Ļ
+    { 9, 29, 12, 1, 18, 66, 16856 }, // ļ
+    { 13, 18, 19, 3, 18, 59, 16922 }, // Ľ
+    { 10, 21, 12, 3, 21, 53, 16981 }, // ľ
+    { 13, 18, 19, 3, 18, 59, 17034 }, // Ŀ
+    { 10, 18, 12, 3, 18, 45, 17093 }, // ŀ
+    { 23, 32, 19, -6, 25, 184, 17138 }, // Ł
+    { 15, 18, 12, -4, 18, 68, 17322 }, // ł
+    { 16, 25, 22, 3, 25, 100, 17390 }, // Ń
+    { 12, 20, 18, 3, 20, 60, 17490 }, // ń
+    { 16, 27, 22, 3, 18, 108, 17550 }, // Ņ
+    { 12, 21, 18, 3, 13, 63, 17658 }, // ņ
+    { 16, 27, 22, 3, 27, 108, 17721 }, // Ň
+    { 13, 22, 18, 3, 22, 72, 17829 }, // ň
+    { 12, 21, 18, 3, 21, 63, 17901 }, // ŉ
+    { 16, 23, 22, 3, 18, 92, 17964 }, // Ŋ
+    { 12, 18, 18, 3, 13, 54, 18056 }, // ŋ
+    { 18, 26, 24, 3, 25, 117, 18110 }, // Ō
+    { 12, 19, 18, 3, 19, 57, 18227 }, // ō
+    { 18, 27, 24, 3, 26, 122, 18284 }, // Ŏ
+    { 12, 20, 18, 3, 20, 60, 18432 }, // ŏ
+    { 19, 25, 24, 3, 24, 119, 18492 }, // Ő
+    { 18, 18, 18, 1, 18, 81, 18611 }, // ő
+    { 25, 20, 25, 3, 19, 125, 18692 }, // Œ
+    { 21, 12, 22, 3, 12, 63, 18817 }, // œ
+    { 14, 25, 20, 3, 25, 88, 18880 }, // Ŕ
+    { 9, 18, 15, 3, 18, 41, 18968 }, // ŕ
+    { 14, 29, 20, 3, 29, 102, 19009 }, // Ŗ
+    { 10, 22, 15, 2, 22, 55, 19111 }, // ŗ
+    { 14, 26, 20, 3, 26, 91, 19166 }, // Ř
+    { 12, 19, 15, 1, 19, 57, 19257 }, // ř
+    { 16, 26, 22, 3, 25, 104, 19314 }, // Ś
+    { 12, 19, 18, 3, 18, 57, 19418 }, // ś
+    { 16, 27, 22, 3, 26, 108, 19475 }, // Ŝ
+    { 12, 20, 18, 3, 19, 60, 19583 }, // ŝ
+    { 16, 23, 22, 3, 18, 92, 19643 }, // Ş
+    { 12, 19, 18, 3, 13, 57, 19735 }, // ş
+    { 16, 27, 22, 3, 26, 108, 19792 }, // Š
+    { 12, 21, 18, 3, 20, 63, 19900 }, // š
+    { 16, 24, 22, 3, 18, 96, 19963 }, // Ţ
+    { 11, 22, 16, 3, 17, 61, 20059 }, // ţ
+    { 16, 26, 22, 3, 26, 104, 20120 }, // Ť
+    { 14, 21, 16, 3, 20, 74, 20224 }, // ť
+    { 16, 18, 22, 3, 18, 72, 20298 }, // Ŧ
+    { 12, 18, 16, 2, 17, 54, 20370 }, // ŧ
+    { 16, 28, 22, 3, 27, 112, 20480 }, // Ũ
+    { 12, 20, 18, 3, 20, 60, 20592 }, // ũ
+    { 16, 28, 22, 3, 27, 112, 20652 }, // Ū
+    { 12, 19, 18, 3, 19, 57, 20764 }, // ū
+    { 16, 28, 22, 3, 27, 112, 20821 }, // Ŭ
+    { 12, 20, 18, 3, 20, 60, 20933 }, // ŭ
+    { 16, 29, 22, 3, 28, 116, 20993 }, // Ů
+    { 12, 21, 18, 3, 21, 63, 21109 }, // ů
+    { 18, 27, 22, 3, 26, 122, 21172 }, // Ű
+    { 18, 19, 18, 1, 19, 86, 21294 }, // ű
+    { 16, 23, 22, 3, 18, 92, 21380 }, // Ų
+    { 12, 18, 18, 3, 12, 54, 21472 }, // ų
+    { 24, 26, 30, 3, 26, 156, 21526 }, // Ŵ
+    { 17, 22, 23, 3, 21, 94, 21682 }, // ŵ
+    { 17, 28, 22, 3, 28, 119, 21776 }, // Ŷ
+    { 14, 29, 19, 3, 23, 102, 21895 }, // ŷ
+    { 17, 28, 22, 3, 28, 119, 21997 }, // Ÿ
+    { 17, 24, 23, 3, 24, 102, 22116 }, // Ź
+    { 13, 20, 18, 3, 20, 65, 22218 }, // ź
+    { 17, 24, 23, 3, 24, 102, 22283 }, // Ż
+    { 13, 20, 18, 3, 20, 65, 22385 }, // ż
+    { 17, 26, 23, 3, 26, 111, 22528 }, // Ž
+    { 13, 21, 18, 3, 21, 69, 22639 }, // ž
+    { 8, 17, 13, 2, 17, 34, 22708 }, // ſ
+    { 9, 4, 0, 0, 16, 9, 22742 }, // ̀
+    { 6, 5, 0, 0, 16, 8, 22751 }, // ́
+    { 12, 6, 0, 0, 1, 18, 22759 }, // ̂
+    { 8, 5, 0, 1, 16, 10, 22777 }, // ̃
+    { 12, 4, 0, 0, 15, 12, 22787 }, // ̄
+    { 15, 4, 0, 0, 19, 15, 22799 }, // ̅
+    { 11, 6, 0, 0, 16, 17, 22814 }, // ̆
+    { 5, 5, 0, 3, 17, 7, 22831 }, // ̇
+    { 10, 4, 0, 0, 15, 10, 22838 }, // ̈
+    { 5, 5, 0, 4, 14, 7, 22848 }, // ̉
+    { 5, 5, 0, 1, 16, 7, 22855 }, // ̊
+    { 19, 4, 0, 0, 16, 19, 22862 }, // ̋
+    { 12, 6, 0, 0, 17, 18, 22881 }, // ̌
+    { 18, 4, 0, -5, 16, 18, 22899 }, // ̏
+    { 7, 8, 0, 0, 17, 14, 22917 }, // ̒
+    { 8, 8, 0, 0, 16, 16, 22931 }, // ̓
+    { 8, 8, 0, -1, 16, 16, 22947 }, // ̔
+    { 5, 6, 0, 1, 0, 8, 22963 }, // ̘
+    { 5, 6, 0, 1, 0, 8, 22971 }, // ̙
+    { 10, 6, 0, 1, 17, 15, 22979 }, // ̚
+    { 5, 6, 0, 0, 14, 8, 22994 }, // ̛
+    { 4, 7, 0, 1, 0, 7, 23002 }, // ̜
+    { 6, 5, 0, 1, 3, 8, 23009 }, // ̝
+    { 6, 5, 0, 1, 0, 8, 23017 }, // ̞
+    { 5, 5, 0, 1, -2, 7, 23025 }, // ̟
+    { 12, 4, 0, 0, -2, 12, 23032 }, // ̠
+    { 6, 5, 0, 0, 2, 8, 23044 }, // ̣
+    { 10, 4, 0, 0, -1, 10, 23052 }, // ̤
+    { 5, 5, 0, 1, 16, 7, 23062 }, // ̥
+    { 7, 8, 0, 0, 4, 14, 23069 }, // ̦
+    { 6, 7, 0, 0, 1, 11, 23083 }, // ̧
+    { 6, 8, 0, 1, 2, 12, 23094 }, // ̨
+    { 5, 7, 0, 0, -1, 9, 23106 }, // ̩
+    { 9, 5, 0, 0, 0, 12, 23115 }, // ̪
+    { 13, 6, 0, -1, 1, 20, 23127 }, // ̬
+    { 13, 6, 0, -1, 1, 20, 23147 }, // ̭
+    { 9, 6, 0, 1, 18, 14, 23167 }, // ̰
+    { 10, 4, 0, 1, 18, 10, 23181 }, // ̱
+    { 11, 4, 0, 0, -1, 11, 23191 }, // ̲
+    { 9, 6, 0, 1, 18, 14, 23202 }, // ̴
+    { 11, 3, 0, 0, 8, 9, 23216 }, // ̵
+    { 5, 8, 0, 0, 1, 10, 23225 }, // ̹
+    { 10, 7, 0, 0, 1, 18, 23235 }, // ̺
+    { 9, 7, 0, 0, 1, 16, 23253 }, // ̻
+    { 9, 6, 0, 0, 1, 14, 23269 }, // ̼
+    { 7, 5, 0, 1, 16, 9, 23283 }, // ̽
+    { 8, 5, 0, 1, 16, 10, 23292 }, // ͂
+    { 4, 6, 0, 5, 19, 6, 23302 }, // ̓
+    { 10, 15, 0, 1, 26, 38, 23308 }, // ̈́
+    { 9, 5, 0, 0, 17, 12, 23346 }, // ͆
+    { 12, 8, 0, 0, 0, 24, 23358 }, // ͇
+    { 9, 7, 0, 1, 1, 16, 23382 }, // ͈
+    { 7, 6, 0, 1, -1, 11, 23398 }, // ͉
+    { 11, 16, 0, 1, 22, 44, 23409 }, // ͊
+    { 19, 16, 0, 1, 24, 76, 23453 }, // ͋
+    { 12, 12, 0, 9, 12, 36, 23529 }, // ͌
+    { 11, 6, 0, 1, -2, 17, 23565 }, // ͍
+    { 5, 4, 0, 0, 3, 5, 23582 }, // ͎
+    { 19, 6, 0, 0, 2, 29, 23587 }, // ͜
+    { 19, 6, 0, 0, 17, 29, 23616 }, // ͡
+    { 22, 7, 0, 1, 0, 39, 23645 }, // ͢
+    { 13, 25, 19, 3, 25, 82, 23684 }, // Ѐ
+    { 13, 26, 19, 3, 26, 85, 23766 }, // Ё
+    { 18, 20, 14, -3, 18, 90, 23851 }, // Ђ
+    { 12, 25, 14, 1, 24, 75, 23941 }, // Ѓ
+    { 16, 18, 17, 1, 16, 72, 24016 }, // Є
+    { 16, 19, 22, 3, 18, 76, 24088 }, // Ѕ
+    { 5, 18, 11, 3, 18, 23, 24164 }, // І
+    { 10, 26, 11, 0, 26, 65, 24187 }, // Ї
+    { 13, 23, 19, 3, 18, 75, 24252 }, // Ј
+    { 20, 18, 24, 2, 16, 90, 24327 }, // Љ
+    { 20, 17, 13, -4, 16, 85, 24417 }, // Њ
+    { 19, 19, 22, 3, 19, 91, 24576 }, // Ћ
+    { 16, 24, 22, 3, 24, 96, 24667 }, // Ќ
+    { 16, 27, 22, 3, 27, 108, 24763 }, // Ѝ
+    { 14, 27, 17, 1, 25, 95, 24871 }, // Ў
+    { 13, 21, 17, 2, 16, 69, 24966 }, // Џ
+    { 18, 18, 20, 1, 18, 81, 25035 }, // А
+    { 11, 17, 14, 1, 16, 47, 25116 }, // Б
+    { 12, 17, 14, 1, 16, 51, 25163 }, // В
+    { 12, 17, 14, 1, 16, 51, 25214 }, // Г
+    { 17, 19, 17, 0, 16, 81, 25265 }, // Д
+    { 13, 18, 19, 3, 18, 59, 25346 }, // Е
+    { 26, 18, 23, -1, 18, 117, 25405 }, // Ж
+    { 11, 16, 13, 1, 16, 44, 25522 }, // З
+    { 16, 18, 22, 3, 18, 72, 25566 }, // И
+    { 16, 28, 22, 3, 28, 112, 25638 }, // Й
+    { 16, 18, 22, 3, 18, 72, 25750 }, // К
+    { 14, 18, 13, -1, 16, 63, 25822 }, // Л
+    { 16, 17, 18, 1, 16, 68, 25885 }, // М
+    { 16, 18, 22, 3, 18, 72, 25953 }, // Н
+    { 18, 19, 24, 3, 18, 86, 26025 }, // О
+    { 13, 17, 14, 1, 16, 56, 26111 }, // П
+    { 13, 18, 19, 3, 18, 59, 26167 }, // Р
+    { 16, 19, 21, 2, 19, 76, 26226 }, // С
+    { 16, 18, 22, 3, 18, 72, 26302 }, // Т
+    { 14, 18, 17, 1, 16, 63, 26374 }, // У
+    { 16, 16, 18, 1, 16, 64, 26437 }, // Ф
+    { 17, 18, 23, 3, 18, 77, 26501 }, // Х
+    { 13, 20, 15, 1, 16, 65, 26624 }, // Ц
+    { 12, 16, 14, 1, 16, 48, 26689 }, // Ч
+    { 15, 17, 17, 1, 16, 64, 26737 }, // Ш
+    { 17, 20, 19, 1, 16, 85, 26801 }, // Щ
+    { 16, 16, 13, -4, 16, 64, 26886 }, // Ъ
+    { 20, 18, 24, 1, 18, 90, 26950 }, // Ы
+    { 11, 16, 13, 1, 16, 44, 27040 }, // Ь
+    { 16, 18, 17, 1, 16, 72, 27084 }, // Э
+    { 17, 16, 19, 1, 16, 68, 27156 }, // Ю
+    { 14, 18, 20, 3, 18, 63, 27224 }, // Я
+    { 12, 13, 18, 3, 13, 39, 27287 }, // а
+    { 13, 20, 14, 1, 19, 65, 27326 }, // б
+    { 11, 12, 15, 2, 12, 33, 27391 }, // в
+    { 11, 13, 12, 1, 12, 36, 27424 }, // г
+    { 15, 15, 16, 0, 12, 57, 27460 }, // д
+    { 12, 12, 18, 3, 12, 36, 27517 }, // е
+    { 24, 15, 30, 3, 15, 90, 27553 }, // ж
+    { 8, 11, 9, 1, 11, 22, 27643 }, // з
+    { 12, 13, 14, 1, 12, 39, 27665 }, // и
+    { 11, 20, 14, 1, 20, 55, 27704 }, // й
+    { 13, 12, 17, 2, 12, 39, 27759 }, // к
+    { 10, 13, 9, -1, 11, 33, 27798 }, // л
+    { 14, 13, 18, 2, 13, 46, 27831 }, // м
+    { 13, 13, 17, 2, 13, 43, 27877 }, // н
+    { 12, 12, 18, 3, 12, 36, 27920 }, // о
+    { 12, 13, 14, 1, 12, 39, 27956 }, // п
+    { 14, 19, 20, 3, 13, 67, 27995 }, // р
+    { 11, 13, 16, 3, 13, 36, 28062 }, // с
+    { 13, 13, 14, 1, 12, 43, 28098 }, // т
+    { 14, 18, 19, 3, 12, 63, 28141 }, // у
+    { 18, 17, 18, 0, 12, 77, 28204 }, // ф
+    { 15, 13, 15, 0, 12, 49, 28281 }, // х
+    { 13, 15, 15, 1, 12, 49, 28330 }, // ц
+    { 8, 11, 9, 1, 11, 22, 28379 }, // ч
+    { 15, 13, 17, 1, 12, 49, 28401 }, // ш
+    { 17, 16, 19, 1, 12, 68, 28450 }, // щ
+    { 12, 12, 10, -3, 12, 36, 28518 }, // ъ
+    { 16, 14, 18, 0, 14, 56, 28554 }, // ы
+    { 9, 12, 10, 0, 12, 27, 28610 }, // ь
+    { 11, 12, 13, 1, 12, 33, 28637 }, // э
+    { 14, 12, 15, 1, 12, 42, 28672 }, // ю
+    { 13, 13, 17, 2, 13, 43, 28714 }, // я
+    { 12, 22, 18, 3, 22, 66, 28757 }, // ѐ
+    { 12, 21, 18, 3, 21, 63, 28823 }, // ё
+    { 16, 21, 18, 0, 18, 84, 28886 }, // ђ
+    { 11, 18, 12, 1, 17, 50, 28970 }, // ѓ
+    { 12, 12, 12, 0, 11, 36, 29020 }, // є
+    { 12, 14, 18, 3, 13, 42, 29056 }, // ѕ
+    { 6, 19, 10, 2, 19, 29, 29098 }, // і
+    { 10, 18, 10, 0, 18, 45, 29127 }, // ї
+    { 8, 25, 13, 3, 19, 50, 29172 }, // ј
+    { 15, 13, 17, 1, 11, 49, 29222 }, // љ
+    { 14, 12, 9, -3, 12, 42, 29271 }, // њ
+    { 16, 18, 18, 0, 18, 72, 29313 }, // ћ
+    { 13, 18, 17, 2, 18, 59, 29385 }, // ќ
+    { 12, 20, 14, 1, 19, 60, 29444 }, // ѝ
+    { 14, 28, 19, 3, 22, 98, 29504 }, // ў
+    { 10, 15, 12, 1, 12, 38, 29602 }, // џ
+    { 15, 18, 16, 0, 16, 68, 29640 }, // Ѣ
+    { 15, 18, 14, -1, 16, 68, 29708 }, // ѣ
+    { 20, 17, 18, -1, 16, 85, 29776 }, // Ѫ
+    { 14, 12, 13, -1, 12, 42, 29861 }, // ѫ
+    { 16, 23, 23, 4, 23, 92, 29903 }, // Ѳ
+    { 13, 17, 18, 3, 17, 56, 29995 }, // ѳ
+    { 20, 22, 24, 3, 22, 110, 30051 }, // Ѵ
+    { 14, 15, 18, 2, 15, 53, 30161 }, // ѵ
+    { 9, 8, 0, 2, 20, 18, 30214 }, // ҆
+    { 12, 19, 14, 1, 18, 57, 30232 }, // Ґ
+    { 11, 16, 12, 1, 15, 44, 30289 }, // ґ
+    { 14, 17, 14, -1, 16, 60, 30333 }, // Ғ
+    { 10, 11, 9, -1, 11, 28, 30393 }, // ғ
+    { 14, 20, 13, -1, 18, 70, 30421 }, // Ҕ
+    { 8, 12, 8, 0, 11, 24, 30491 }, // ҕ
+    { 27, 22, 30, 2, 18, 149, 30515 }, // Җ
+    { 19, 15, 21, 1, 12, 72, 30720 }, // җ
+    { 11, 19, 13, 1, 16, 53, 30792 }, // Ҙ
+    { 8, 17, 9, 1, 11, 34, 30845 }, // ҙ
+    { 17, 22, 15, 2, 18, 94, 30879 }, // Қ
+    { 12, 15, 10, 1, 12, 45, 30973 }, // қ
+    { 20, 18, 23, 1, 17, 90, 31018 }, // Ҝ
+    { 14, 12, 16, 1, 12, 42, 31108 }, // ҝ
+    { 16, 18, 22, 3, 18, 72, 31150 }, // Ҟ
+    { 15, 18, 19, 1, 18, 68, 31222 }, // ҟ
+    { 19, 18, 22, 0, 18, 86, 31290 }, // Ҡ
+    { 13, 12, 15, 0, 12, 39, 31376 }, // ҡ
+    { 17, 21, 16, 0, 18, 90, 31415 }, // Ң
+    { 12, 14, 11, 0, 12, 42, 31505 }, // ң
+    { 23, 18, 22, 3, 18, 104, 31547 }, // Ҥ
+    { 16, 12, 15, 2, 12, 48, 31651 }, // ҥ
+    { 23, 20, 27, 2, 18, 115, 31699 }, // Ҧ
+    { 20, 22, 26, 3, 15, 110, 31814 }, // ҧ
+    { 21, 17, 14, -3, 16, 90, 31924 }, // Ҩ
+    { 17, 14, 11, -3, 13, 60, 32014 }, // ҩ
+    { 16, 22, 21, 2, 19, 88, 32074 }, // Ҫ
+    { 11, 16, 16, 3, 13, 44, 32162 }, // ҫ
+    { 17, 21, 16, 0, 18, 90, 32206 }, // Ҭ
+    { 12, 14, 11, 0, 12, 42, 32296 }, // ҭ
+    { 17, 18, 22, 3, 18, 77, 32338 }, // Ү
+    { 13, 17, 16, 1, 12, 56, 32415 }, // ү
+    { 17, 18, 22, 3, 18, 77, 32471 }, // Ұ
+    { 14, 17, 16, 1, 12, 60, 32548 }, // ұ
+    { 17, 21, 16, 3, 18, 90, 32608 }, // Ҳ
+    { 12, 14, 11, 2, 12, 42, 32698 }, // ҳ
+    { 19, 20, 13, -3, 15, 95, 32768 }, // Ҵ
+    { 15, 14, 9, -3, 11, 53, 32863 }, // ҵ
+    { 14, 21, 14, 0, 16, 74, 32916 }, // Ҷ
+    { 10, 15, 10, 0, 11, 38, 32990 }, // ҷ
+    { 12, 16, 14, 1, 16, 48, 33028 }, // Ҹ
+    { 8, 11, 9, 1, 11, 22, 33076 }, // ҹ
+    { 13, 19, 14, 1, 18, 62, 33098 }, // Һ
+    { 13, 18, 18, 3, 18, 59, 33160 }, // һ
+    { 23, 17, 20, -4, 16, 98, 33219 }, // Ҽ
+    { 17, 12, 15, -3, 12, 51, 33317 }, // ҽ
+    { 23, 20, 19, -3, 16, 115, 33368 }, // Ҿ
+    { 17, 15, 13, -2, 12, 64, 33483 }, // ҿ
+    { 5, 18, 11, 3, 18, 23, 33547 }, // Ӏ
+    { 26, 28, 23, -1, 28, 182, 33570 }, // Ӂ
+    { 24, 24, 30, 3, 24, 144, 33752 }, // ӂ
+    { 13, 22, 15, 1, 16, 72, 33896 }, // Ӄ
+    { 10, 16, 10, 0, 12, 40, 33968 }, // ӄ
+    { 16, 21, 13, -1, 16, 84, 34008 }, // Ӆ
+    { 11, 14, 9, -1, 11, 39, 34092 }, // ӆ
+    { 17, 24, 22, 3, 18, 102, 34131 }, // Ӈ
+    { 12, 16, 15, 2, 12, 48, 34233 }, // ӈ
+    { 17, 25, 22, 3, 18, 107, 34281 }, // Ӊ
+    { 12, 17, 15, 2, 12, 51, 34388 }, // ӊ
+    { 12, 21, 14, 1, 16, 63, 34439 }, // Ӌ
+    { 9, 14, 13, 2, 11, 32, 34502 }, // ӌ
+    { 20, 26, 24, 3, 18, 130, 34534 }, // Ӎ
+    { 14, 17, 17, 2, 12, 60, 34664 }, // ӎ
+    { 5, 16, 13, 4, 15, 20, 34724 }, // ӏ
+    { 18, 25, 20, 1, 25, 113, 34816 }, // Ӑ
+    { 12, 20, 18, 3, 20, 60, 34929 }, // ӑ
+    { 18, 24, 20, 1, 24, 108, 34989 }, // Ӓ
+    { 13, 20, 18, 2, 20, 65, 35097 }, // ӓ
+    { 26, 19, 28, 1, 18, 124, 35162 }, // Ӕ
+    { 20, 13, 26, 3, 13, 65, 35286 }, // ӕ
+    { 13, 26, 19, 3, 26, 85, 35351 }, // Ӗ
+    { 12, 22, 18, 3, 22, 66, 35436 }, // ӗ
+    { 15, 18, 22, 4, 17, 68, 35502 }, // Ә
+    { 12, 14, 18, 4, 13, 42, 35570 }, // ә
+    { 15, 24, 22, 4, 23, 90, 35612 }, // Ӛ
+    { 12, 17, 18, 4, 13, 51, 35702 }, // ӛ
+    { 26, 27, 29, 2, 27, 176, 35753 }, // Ӝ
+    { 24, 23, 30, 3, 23, 138, 35929 }, // ӝ
+    { 11, 25, 13, 1, 25, 69, 36067 }, // Ӟ
+    { 10, 16, 9, -1, 16, 40, 36136 }, // ӟ
+    { 11, 17, 14, 2, 16, 47, 36176 }, // Ӡ
+    { 11, 17, 14, 2, 12, 47, 36223 }, // ӡ
+    { 16, 27, 22, 3, 27, 108, 36270 }, // Ӣ
+    { 12, 20, 14, 1, 19, 60, 36378 }, // ӣ
+    { 16, 26, 22, 3, 26, 104, 36438 }, // Ӥ
+    { 12, 19, 14, 1, 18, 57, 36542 }, // ӥ
+    { 18, 25, 24, 3, 24, 113, 36599 }, // Ӧ
+    { 13, 21, 18, 2, 21, 69, 36712 }, // ӧ
+    { 16, 17, 23, 4, 17, 68, 36781 }, // Ө
+    { 12, 12, 18, 3, 12, 36, 36864 }, // ө
+    { 16, 23, 23, 4, 23, 92, 36900 }, // Ӫ
+    { 12, 18, 18, 3, 18, 54, 36992 }, // ӫ
+    { 16, 27, 17, 1, 25, 108, 37046 }, // Ӭ
+    { 11, 17, 13, 1, 17, 47, 37154 }, // ӭ
+    { 14, 27, 17, 1, 25, 95, 37201 }, // Ӯ
+    { 14, 28, 19, 3, 22, 98, 37296 }, // ӯ
+    { 14, 26, 17, 1, 24, 91, 37394 }, // Ӱ
+    { 14, 27, 19, 3, 21, 95, 37485 }, // ӱ
+    { 18, 26, 17, 1, 24, 117, 37580 }, // Ӳ
+    { 19, 27, 19, 2, 21, 129, 37697 }, // ӳ
+    { 12, 20, 14, 1, 20, 60, 37826 }, // Ӵ
+    { 10, 15, 9, 0, 15, 38, 37886 }, // ӵ
+    { 12, 19, 14, 1, 16, 57, 37924 }, // Ӷ
+    { 9, 13, 9, 0, 11, 30, 37981 }, // ӷ
+    { 20, 27, 24, 1, 27, 135, 38011 }, // Ӹ
+    { 16, 22, 18, 0, 22, 88, 38146 }, // ӹ
+    { 19, 20, 23, 3, 18, 95, 38234 }, // Ӽ
+    { 14, 14, 16, 2, 12, 49, 38329 }, // ӽ
+    { 0, 0, 14, 0, 0, 0, 38378 }, //  
+    { 0, 0, 24, 0, 0, 0, 38378 }, //  
+    { 0, 0, 14, 0, 0, 0, 38378 }, //  
+    { 0, 0, 24, 0, 0, 0, 38378 }, //  
+    { 0, 0, 10, 0, 0, 0, 38378 }, //  
+    { 0, 0, 9, 0, 0, 0, 38378 }, //  
+    { 0, 0, 7, 0, 0, 0, 38378 }, //  
+    { 0, 0, 15, 0, 0, 0, 38378 }, //  
+    { 0, 0, 5, 0, 0, 0, 38378 }, //  
+    { 0, 0, 8, 0, 0, 0, 38378 }, //  
+    { 0, 0, 6, 0, 0, 0, 38378 }, //  
+    { 0, 0, 3, 0, 0, 0, 38378 }, // ​
+    { 0, 0, 0, 0, 0, 0, 38378 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 38378 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 38378 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 38378 }, // ‏
+    { 11, 3, 11, 0, 8, 9, 38378 }, // ‐
+    { 11, 3, 11, 0, 8, 9, 38387 }, // ‑
+    { 17, 3, 11, -3, 8, 13, 38396 }, // ‒
+    { 15, 5, 17, 1, 9, 19, 38409 }, // –
+    { 22, 5, 24, 1, 9, 28, 38428 }, // —
+    { 22, 5, 24, 1, 9, 28, 38456 }, // ―
+    { 10, 19, 11, 2, 15, 48, 38484 }, // ‖
+    { 18, 8, 11, -3, -1, 36, 38532 }, // ‗
+    { 7, 8, 9, 1, 19, 14, 38568 }, // ‘
+    { 7, 8, 9, 1, 19, 14, 38582 }, // ’
+    { 7, 8, 7, 0, 4, 14, 38596 }, // ‚
+    { 7, 8, 9, 1, 19, 14, 38610 }, // ‛
+    { 14, 8, 16, 1, 19, 28, 38624 }, // “
+    { 14, 8, 16, 1, 19, 28, 38652 }, // ”
+    { 7, 8, 7, 0, 4, 14, 38680 }, // „
+    { 14, 8, 16, 1, 19, 28, 38694 }, // ‟
+    { 13, 30, 17, 2, 22, 98, 38722 }, // †
+    { 13, 29, 18, 3, 21, 95, 38912 }, // ‡
+    { 17, 16, 11, -3, 19, 68, 39007 }, // •
+    { 7, 8, 13, 3, 10, 14, 39075 }, // ‣
+    { 6, 5, 13, 3, 5, 8, 39089 }, // ․
+    { 6, 5, 13, 3, 5, 8, 39097 }, // ‥
+    { 20, 5, 20, 0, 5, 25, 39105 }, // …
+    { 3, 3, 11, 4, 8, 3, 39130 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 39133 }, //  
+    { 16, 19, 24, 4, 17, 76, 39133 }, // ‰
+    { 8, 8, 11, 3, 19, 16, 39209 }, // ′
+    { 15, 8, 16, 3, 19, 30, 39225 }, // ″
+    { 17, 7, 9, 1, 18, 30, 39255 }, // ‴
+    { 6, 7, 9, 1, 18, 11, 39285 }, // ‵
+    { 10, 7, 9, 0, 18, 18, 39296 }, // ‶
+    { 17, 7, 9, -4, 18, 30, 39314 }, // ‷
+    { 12, 5, 14, 1, 18, 15, 39344 }, // ‸
+    { 7, 12, 9, 1, 12, 21, 39359 }, // ‹
+    { 7, 12, 9, 1, 12, 21, 39380 }, // ›
+    { 22, 28, 28, 4, 22, 154, 39401 }, // ※
+    { 6, 27, 13, 3, 24, 41, 39555 }, // ‼
+    { 13, 33, 18, 2, 28, 108, 39596 }, // ‽
+    { 11, 3, 11, 0, 18, 9, 39704 }, // ‾
+    { 11, 4, 12, 0, 14, 11, 39713 }, // ‿
+    { 15, 15, 13, -1, 19, 57, 39724 }, // ⁂
+    { 14, 18, 26, 6, 16, 63, 39781 }, // ⁄
+    { 26, 27, 31, 3, 24, 176, 39844 }, // ⁇
+    { 22, 28, 25, 2, 24, 154, 40020 }, // ⁈
+    { 17, 27, 16, -1, 24, 115, 40174 }, // ⁉
+    { 16, 36, 19, 2, 25, 144, 40289 }, // ⁒
+    { 0, 0, 97, 0, 0, 0, 40433 }, //  
+    { 7, 9, 7, 0, 18, 16, 40433 }, // ⁰
+    { 7, 8, 7, 0, 18, 14, 40449 }, // ⁴
+    { 7, 9, 7, 0, 18, 16, 40463 }, // ⁵
+    { 7, 9, 7, 0, 18, 16, 40479 }, // ⁶
+    { 7, 9, 8, 0, 18, 16, 40495 }, // ⁷
+    { 7, 9, 8, 0, 18, 16, 40511 }, // ⁸
+    { 7, 10, 8, 0, 18, 18, 40527 }, // ⁹
+    { 12, 13, 18, 3, 13, 39, 40545 }, // ⁿ
+    { 7, 9, 7, 0, 5, 16, 40584 }, // ₀
+    { 7, 9, 7, 0, 5, 16, 40600 }, // ₁
+    { 7, 9, 8, 0, 5, 16, 40616 }, // ₂
+    { 7, 9, 7, 0, 5, 16, 40632 }, // ₃
+    { 7, 8, 8, 0, 5, 14, 40648 }, // ₄
+    { 7, 9, 7, 0, 5, 16, 40662 }, // ₅
+    { 7, 9, 8, 0, 5, 16, 40678 }, // ₆
+    { 7, 10, 8, 0, 6, 18, 40694 }, // ₇
+    { 7, 9, 8, 0, 5, 16, 40712 }, // ₈
+    { 7, 9, 8, 0, 5, 16, 40728 }, // ₉
+    { 9, 29, 10, 1, 22, 66, 40744 }, // ₍
+    { 9, 29, 9, -1, 22, 66, 40810 }, // ₎
+    { 16, 27, 21, 2, 23, 108, 40960 }, // ₡
+    { 16, 19, 21, 2, 19, 76, 41068 }, // ₢
+    { 14, 19, 14, 0, 18, 67, 41144 }, // ₤
+    { 23, 18, 22, -1, 18, 104, 41211 }, // ₦
+    { 19, 18, 19, 0, 18, 86, 41315 }, // ₧
+    { 23, 19, 27, 2, 18, 110, 41401 }, // ₨
+    { 18, 18, 18, 0, 18, 81, 41511 }, // ₩
+    { 16, 16, 22, 3, 16, 64, 41592 }, // ₪
+    { 16, 18, 11, -2, 17, 72, 41656 }, // ₫
+    { 15, 20, 16, 0, 17, 75, 41728 }, // €
+    { 16, 18, 22, 3, 18, 72, 41803 }, // ₮
+    { 21, 18, 13, -1, 18, 95, 41875 }, // ₱
+    { 18, 27, 24, 3, 23, 122, 41970 }, // ₲
+    { 21, 18, 22, 4, 17, 95, 42092 }, // ₴
+    { 11, 17, 12, 3, 15, 47, 42187 }, // ₵
+    { 18, 19, 22, 2, 19, 86, 42234 }, // ₸
+    { 12, 17, 14, 1, 16, 51, 42320 }, // ₹
+    { 13, 16, 14, 1, 14, 52, 42371 }, // ₺
+    { 15, 17, 17, 1, 17, 64, 42423 }, // ₼
+    { 18, 18, 19, -2, 18, 81, 42487 }, // ₽
+    { 15, 14, 15, 0, 12, 53, 42568 }, // ←
+    { 16, 15, 16, 0, 14, 60, 42621 }, // ↑
+    { 14, 14, 16, 1, 12, 49, 42681 }, // →
+    { 16, 14, 16, 0, 13, 56, 42730 }, // ↓
+    { 17, 12, 21, 2, 12, 51, 42786 }, // ↔
+    { 13, 17, 17, 2, 19, 56, 42837 }, // ↕
+    { 12, 12, 16, 2, 12, 36, 42893 }, // ↖
+    { 13, 12, 13, 0, 12, 39, 42929 }, // ↗
+    { 13, 12, 13, 0, 12, 39, 42968 }, // ↘
+    { 12, 12, 13, 1, 12, 36, 43008 }, // ↙
+    { 16, 14, 20, 2, 13, 56, 43044 }, // ⇐
+    { 18, 17, 22, 2, 16, 77, 43100 }, // ⇑
+    { 16, 14, 20, 2, 13, 56, 43177 }, // ⇒
+    { 18, 17, 22, 2, 15, 77, 43233 }, // ⇓
+    { 19, 14, 23, 2, 13, 67, 43310 }, // ⇔
+    { 14, 18, 19, 2, 10, 63, 43377 }, // ⇕
+    { 13, 19, 14, 1, 18, 62, 43440 }, // ∂
+    { 21, 20, 24, 1, 19, 105, 43502 }, // ∅
+    { 16, 17, 18, 1, 16, 68, 43607 }, // ∆
+    { 14, 16, 15, 1, 15, 56, 43675 }, // ∏
+    { 14, 17, 15, 1, 16, 60, 43731 }, // ∐
+    { 11, 16, 12, 1, 15, 44, 43791 }, // ∑
+    { 12, 4, 13, 0, 8, 12, 43835 }, // −
+    { 18, 19, 20, 1, 18, 86, 43847 }, // √
+    { 17, 12, 19, 1, 14, 51, 43933 }, // ∞
+    { 17, 23, 18, 0, 17, 98, 43984 }, // ∫
+    { 6, 14, 7, 0, 14, 21, 44082 }, // ∶
+    { 12, 12, 30, 9, 12, 36, 44103 }, // ≈
+    { 16, 19, 26, 5, 17, 76, 44139 }, // ≠
+    { 18, 18, 17, -1, 16, 81, 44215 }, // ≤
+    { 18, 18, 18, 0, 16, 81, 44296 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_10_boldIntervals[] = {
@@ -3515,4 +2400,9 @@ static const EpdFontData opendyslexic_10_bold = {
     28,
     -11,
     true,
+    opendyslexic_10_boldBlockOffsets,
+    opendyslexic_10_boldDirectGlyphs,
+    opendyslexic_10_boldGlyphPages,
+    35,
+    opendyslexic_10_boldPageGlyphs,
 };
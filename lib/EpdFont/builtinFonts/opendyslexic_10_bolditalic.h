@@ -2,3295 +2,1921 @@
  * generated by fontconvert.py
  * name: opendyslexic_10_bolditalic
  * size: 10
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_bolditalic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_10_bolditalic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_bolditalicBitmaps[52498] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0B,
-    0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA8, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0xBF, 0xC2, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x3F,
-    0xC0, 0xFF, 0x03, 0xFD, 0x0F, 0xF0, 0x2F, 0xE0, 0xFF, 0x81, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x02,
-    0xF0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40,
-    0x00, 0x00, 0x01, 0xFE, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0x4F, 0x80, 0x00, 0x1F, 0xE0, 0x3D, 0x00, 0x00, 0xBF, 0x01, 0xF0, 0x00, 0x03,
-    0xFF, 0x4B, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x90, 0x03, 0xFF, 0xF0,
-    0x0F, 0xF9, 0x5F, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x14, 0x00, 0x07, 0xD0, 0x01, 0xFF, 0x40, 0x0F, 0x80, 0x07, 0xC3, 0x80, 0x3F, 0x00, 0x0F,
-    0x03, 0xC0, 0xFC, 0x00, 0x0E, 0x03, 0x83, 0xF0, 0x00, 0x0E, 0x0F, 0x4B, 0xD0, 0x00, 0x0F, 0xFF,
-    0x2F, 0x40, 0x00, 0x0B, 0xFC, 0x7E, 0x00, 0x00, 0x01, 0x51, 0xF8, 0xBE, 0x00, 0x00, 0x03, 0xF3,
-    0xEB, 0x80, 0x00, 0x0F, 0xCB, 0x83, 0xC0, 0x00, 0x3F, 0x4F, 0x03, 0xC0, 0x00, 0xFD, 0x0F, 0x0B,
-    0x80, 0x02, 0xF8, 0x0F, 0xFF, 0x00, 0x0B, 0xE0, 0x0B, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0x50, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xEB, 0xD0, 0x00, 0x0F, 0x40,
-    0x7C, 0x00, 0x0B, 0x80, 0x0F, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0xBC, 0x1F, 0xD0, 0x00, 0x0F,
-    0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0x82,
-    0xFC, 0x3F, 0x07, 0xE0, 0xFD, 0x03, 0xF7, 0xF0, 0x3F, 0x80, 0x3F, 0xF4, 0x1F, 0xFE, 0xBF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFB, 0x40, 0x06, 0xFE, 0x90, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x0B, 0xF8, 0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x42, 0xFE,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xB8, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x02, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x24, 0x2E, 0x3D, 0x7C,
-    0x2F, 0xFF, 0xFF, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x7F, 0xFF, 0xF4, 0x3F, 0xFE, 0xFC,
-    0x0F, 0x2F, 0x1C, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0x6A,
-    0xFF, 0xA8, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00,
-    0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x06, 0x90, 0xFD, 0x1F, 0xD3, 0xFC, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0xFC, 0x02, 0xF0, 0x02, 0xF8, 0x42, 0xF0, 0x03, 0xF3, 0xF3,
-    0xF0, 0x07, 0xF7, 0xF3, 0xF0, 0x0B, 0xEB, 0xE7, 0xF0, 0x0F, 0xDB, 0xDB, 0xE0, 0x0F, 0xC3, 0x8F,
-    0xC0, 0x1F, 0xC0, 0x3F, 0xC0, 0x2F, 0xE0, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0xAD,
-    0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x22, 0xF4, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0x80, 0x05, 0xBF, 0x95, 0x1F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x06, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x79, 0x02, 0xFC, 0x00, 0x40, 0x01,
-    0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE5,
-    0x40, 0x0F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x29, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFD, 0x00, 0x02,
-    0xBF, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0E, 0x45, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xEF, 0x80, 0x00,
-    0xF9, 0xF8, 0x00, 0x3E, 0x3F, 0x40, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0x7F, 0x00, 0xFF, 0xFF, 0xFE,
-    0x2F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA8, 0x00, 0xBF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xEA, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x05, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0x95, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFD, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x2F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xDA, 0x90, 0x00,
-    0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xF8, 0x2F, 0xC0, 0x7F, 0x80, 0x3F, 0x02, 0xFC,
-    0x01, 0xFC, 0x0B, 0xE0, 0x0B, 0xE0, 0x2F, 0xD1, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xE0, 0x00, 0x2A, 0xAA, 0xA5, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x03,
-    0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xFF,
-    0x80, 0x07, 0xF4, 0x3F, 0x00, 0x3F, 0x40, 0xBC, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x2F, 0xC0,
-    0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x40, 0x2F, 0xD0, 0xBF, 0x01, 0xFC,
-    0x00, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0x3F, 0xC0, 0xBF, 0x80, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFD, 0x07, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xD0, 0x02,
-    0xF0, 0x07, 0xC0, 0x03, 0xF0, 0x07, 0xC0, 0x07, 0xF0, 0x0B, 0xD0, 0x2F, 0xE0, 0x07, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x19, 0x01, 0xBF,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x0F, 0xF0, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x1F, 0xF4,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x02, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x2F, 0xF0, 0x00,
-    0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x6A, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x6F, 0xFF,
-    0xFF, 0x40, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1C, 0x00,
-    0x56, 0xAB, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xAF, 0xFF, 0x02, 0xFF, 0xFF, 0xC1, 0xFF, 0xFA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x01, 0xBF, 0xFF, 0x00,
-    0x6F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF9, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFD, 0x07, 0xF0, 0x00, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2A, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x02, 0xFE, 0x01, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0x00, 0x02, 0xF4, 0x00, 0x01,
-    0xD0, 0x02, 0xF0, 0xBB, 0x80, 0x34, 0x00, 0xF4, 0xF7, 0xD0, 0x0E, 0x00, 0xFC, 0xB0, 0x70, 0x07,
-    0x40, 0x3E, 0x34, 0x1C, 0x03, 0xC0, 0x1F, 0x4C, 0x1F, 0x02, 0xE0, 0x0B, 0xD3, 0xFF, 0xC3, 0xF0,
-    0x02, 0xF8, 0xBE, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x50, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x07, 0xF7, 0xF0,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xFE,
-    0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x1F, 0xE0, 0x00,
-    0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07,
-    0xFA, 0xBF, 0xE0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x1F, 0x40,
-    0x1F, 0xC0, 0x2F, 0xC0, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x07, 0xF4, 0x0F, 0xD0, 0x02, 0xFC, 0x07, 0xFA, 0xAB,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x1B, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xAA, 0xFF, 0xF0, 0x00, 0xFF, 0x00,
-    0x0F, 0xF4, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x03,
-    0xF4, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xF4, 0x00, 0x0F, 0xE0,
-    0x0B, 0xF0, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x16, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFA, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xAA,
-    0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0A, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xAA, 0x90, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xF4, 0x00, 0x50, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0A, 0x94,
-    0x00, 0xFF, 0x00, 0x3F, 0xFF, 0x87, 0xFC, 0x00, 0xFF, 0xFD, 0x2F, 0xF0, 0x01, 0x6F, 0xF4, 0xBF,
-    0xC0, 0x00, 0xBE, 0x01, 0xFF, 0xE5, 0x5F, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0xFE, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xFC,
-    0x00, 0xBF, 0x40, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x01,
-    0xFE, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFA, 0xAA, 0xFF, 0x40, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x02, 0xFF,
-    0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF4,
-    0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x03,
-    0xF4, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFE, 0x00, 0x3F, 0xD0,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x18, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x2F, 0xE0, 0x00, 0x1F, 0xC1, 0xFF, 0x00, 0x00, 0xBE, 0x0F, 0xF0, 0x00,
-    0x03, 0xF4, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF4, 0x00, 0x00, 0xFE, 0xBF, 0x40, 0x00, 0x03, 0xFB,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0xF8, 0x00, 0x0B, 0xF4, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0xFF,
-    0xF4, 0x01, 0xFF, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xFC,
-    0x03, 0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0xC1, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFF, 0x4F, 0xFF, 0xD0, 0x02, 0xFE, 0xFD, 0xBF, 0xBF, 0x00, 0x0F, 0xEB, 0xFF, 0xFB, 0xFC, 0x00,
-    0x3F, 0x6F, 0xFF, 0xDF, 0xE0, 0x02, 0xFD, 0x7F, 0xFD, 0xBF, 0x40, 0x0F, 0xF1, 0xFF, 0xF3, 0xFD,
-    0x00, 0x3F, 0xC7, 0xFF, 0x5F, 0xF0, 0x01, 0xFE, 0x0F, 0xFC, 0xBF, 0xC0, 0x0B, 0xF8, 0x3F, 0xC3,
-    0xFE, 0x00, 0x3F, 0xD0, 0xFE, 0x1F, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0x7F,
-    0xE0, 0x07, 0xF0, 0x00, 0x3F, 0xFC, 0x02, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0xFD, 0x00, 0x07, 0xFF,
-    0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xF8, 0x2F, 0x80, 0x00, 0xFF, 0xBF, 0x0F, 0xD0, 0x00, 0xBF, 0xAF,
-    0xC7, 0xF0, 0x00, 0x3F, 0xD7, 0xF2, 0xFC, 0x00, 0x0F, 0xF0, 0xFD, 0xFD, 0x00, 0x0B, 0xFC, 0x3F,
-    0xFF, 0x00, 0x03, 0xFE, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0x43, 0xFF, 0xE0, 0x00, 0xBF, 0xD0, 0xBF,
-    0xF0, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80,
-    0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00,
-    0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00,
-    0xFE, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x2F, 0xF9, 0x05, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xAA, 0x40, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0xBE,
-    0x01, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B, 0xE0, 0x1F, 0xF0, 0x03,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFA, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x1F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xF8, 0x02, 0xFE, 0x00, 0x03,
-    0xFC, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x03, 0xF8,
-    0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x14, 0x0F, 0xE0, 0x1F,
-    0xE0, 0x3F, 0xBF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x40, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xF9, 0x5B, 0xD0, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x3F, 0x00,
-    0x3E, 0x00, 0x1F, 0x80, 0x2F, 0x40, 0x0B, 0xD0, 0x0F, 0xC0, 0x03, 0xF5, 0x6F, 0xE0, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xF4, 0x3F, 0x40, 0x0B,
-    0xF8, 0x0F, 0xE0, 0x03, 0xFD, 0x03, 0xF8, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0xFF, 0xC0,
-    0x3F, 0xE0, 0x3F, 0xF0, 0x0A, 0xA4, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x10, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x0E, 0x40, 0x07, 0xFC, 0x03, 0xFF, 0xAB, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00,
-    0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B,
-    0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x7F,
-    0xC0, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFC,
-    0x00, 0x1F, 0xD0, 0x01, 0xFE, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xCB,
-    0xF0, 0x00, 0x07, 0xF4, 0xBF, 0x00, 0x00, 0xFE, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0xBF, 0x40, 0x0B,
-    0xF8, 0x07, 0xF8, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x7F,
-    0xC1, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x3F, 0xDB, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00,
-    0x00, 0xAA, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF4, 0x03, 0xF0, 0x0B,
-    0xF8, 0x03, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x42, 0xFF, 0x42, 0xFE, 0x00, 0x3F, 0xC1,
-    0xFF, 0xE0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xFF, 0xFF, 0x3F, 0xC0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xEF, 0xE0, 0x00, 0x7F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE3,
-    0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0xBF, 0xFC, 0x00, 0x02, 0xFF, 0xF0, 0x2F, 0xFD, 0x00, 0x00,
-    0xBF, 0xF8, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x40, 0x00, 0x02, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00,
-    0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0,
-    0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0, 0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x3F, 0xEA, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xC0, 0xB0, 0x3C, 0x1F, 0x47, 0xD1,
-    0xF4, 0x7E, 0x1F, 0x83, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFD, 0x3F, 0x4F, 0xD3, 0xF8, 0xFD,
-    0x3E, 0x0F, 0x03, 0x00, 0x40, 0x6A, 0xA0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xAB,
-    0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x2F, 0x9F, 0xD0,
-    0x7D, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x07, 0xF4, 0x01, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x7E, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xEB, 0xFD, 0x02, 0xF0, 0x0F,
-    0xC0, 0x7D, 0x00, 0xFC, 0x0B, 0x80, 0x0F, 0xC0, 0xF0, 0x00, 0xFC, 0x0F, 0x00, 0x2F, 0x81, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x7F, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFD, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFD, 0x0B, 0xFD, 0x0B, 0xC2, 0xFC, 0x01,
-    0xF0, 0xFE, 0x00, 0xBC, 0x3F, 0x00, 0x3E, 0x1F, 0xC0, 0x3F, 0x47, 0xFE, 0xBF, 0xC2, 0xFF, 0xFF,
-    0xE0, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xAC, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0, 0x06,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xBE, 0x6F, 0x40,
-    0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xF8, 0x1F, 0xF4, 0x00, 0xF8, 0x03, 0xFC,
-    0x00, 0xBC, 0x00, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0x40, 0x0F, 0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x6F, 0x40, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x02, 0xF9, 0x1F, 0x40, 0xBE, 0x56, 0xF8, 0x0F, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0xF8, 0x3F, 0x55, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x03, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFD, 0x00,
-    0x2F, 0xE8, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x00, 0x07, 0xFF, 0xF8, 0x0B, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00,
-    0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xBE, 0x3F,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFA, 0xFF, 0xE0, 0x02, 0xF0, 0x1F, 0xF4, 0x00, 0xF4, 0x03,
-    0xFC, 0x00, 0xB8, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x40, 0x0F, 0x00, 0x3F, 0xC0, 0x03, 0xE0,
-    0x6F, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x6F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x90, 0x1F, 0xD0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xEB, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xEB, 0xF0, 0x0B,
-    0xF4, 0x0B, 0xC0, 0x3F, 0x80, 0x2F, 0x01, 0xFC, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xE0, 0x3F, 0x80,
-    0x2F, 0x41, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0xC0, 0x3F, 0xC1, 0xFF, 0x01, 0xBE,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1A, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00,
-    0xBC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-    0xBF, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF2, 0xFC, 0x01, 0xFA, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x3F,
-    0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0xBF,
-    0x7F, 0xF0, 0x3F, 0x8F, 0xFE, 0x1F, 0xD1, 0xFF, 0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x2F,
-    0x40, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00,
-    0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xFF,
-    0x80, 0x3F, 0xF8, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xF8, 0x1F,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFB, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xFA, 0xFC, 0x00, 0xFF, 0x02, 0xFD,
-    0x07, 0xD0, 0x2F, 0xC0, 0x3F, 0xC0, 0xBD, 0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xC0, 0x7F, 0x40, 0xBF,
-    0x00, 0xFC, 0x0B, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0xFE, 0x02, 0xFC, 0x03, 0xF8, 0x1F, 0xC0, 0x3F,
-    0x80, 0x7F, 0x43, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x7F, 0x40, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF6, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFB, 0xF8, 0x02, 0xFD, 0x03,
-    0xF0, 0x0F, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x7E, 0x02, 0xF8, 0x02, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0,
-    0x3F, 0x40, 0x7F, 0x02, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x7F, 0x80, 0xBF, 0x40, 0x00,
-    0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xFE, 0xBF, 0x80, 0xBF, 0x00, 0xFC, 0x0F, 0xC0, 0x0F,
-    0xC2, 0xF4, 0x00, 0xFC, 0x3F, 0x00, 0x2F, 0x83, 0xF8, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0F,
-    0xEF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0xF0, 0x00, 0x07, 0xFC, 0x02,
-    0xD0, 0x00, 0x2F, 0xD0, 0x0B, 0x40, 0x00, 0xFF, 0x00, 0x3D, 0x00, 0x03, 0xF8, 0x00, 0xF0, 0x00,
-    0x1F, 0xE0, 0x0B, 0xC0, 0x00, 0xFF, 0xE6, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF0, 0x64, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x8F, 0xC0, 0x0F, 0xFF, 0xBF, 0x00,
-    0xFE, 0x7F, 0xF4, 0x0B, 0xC0, 0x3F, 0xC0, 0x3D, 0x00, 0xFE, 0x02, 0xF0, 0x03, 0xF4, 0x0F, 0x40,
-    0x1F, 0xC0, 0x3D, 0x00, 0xBE, 0x00, 0xF8, 0x0B, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x1B, 0xD7, 0xEF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x00,
-    0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xD0, 0x04, 0x00, 0x7C,
-    0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0x3E, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0xBF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x1A, 0xFE, 0xA8, 0x07, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x3F, 0xFE, 0x00,
-    0x07, 0xD0, 0x07, 0xE0, 0xBC, 0x00, 0xBD, 0x0B, 0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80,
-    0x2F, 0x81, 0xF4, 0x03, 0xF8, 0x2F, 0x40, 0x7F, 0x42, 0xF0, 0x0F, 0xF0, 0x3F, 0xE7, 0xFF, 0x03,
-    0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00, 0xBF, 0xEF, 0xC0, 0x3F, 0x00, 0x02, 0xF8, 0xFD, 0x00,
-    0x1F, 0xC3, 0xF8, 0x00, 0xFC, 0x0B, 0xF0, 0x0F, 0xD0, 0x1F, 0xC0, 0xBE, 0x00, 0x3F, 0x47, 0xF0,
-    0x00, 0xFE, 0x3F, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x02, 0xF8,
-    0x7F, 0x01, 0x40, 0x3F, 0x07, 0xF0, 0x7E, 0x0F, 0xE0, 0x7F, 0x0F, 0xF1, 0xFC, 0x07, 0xF3, 0xFF,
-    0x7F, 0x80, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xBF, 0xF4, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x2A, 0x01, 0xA8,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x0F, 0xF3, 0xF8, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x2F, 0xE3, 0xFD, 0x00, 0x0B,
-    0xF8, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x1F,
-    0x80, 0x0B, 0xF0, 0x0F, 0xC0, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x0F, 0xE2,
-    0xF4, 0x00, 0x03, 0xFD, 0xFC, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0xBF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1A, 0xAF,
-    0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFA, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03,
-    0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4,
-    0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x3F, 0x50, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x43, 0xE1, 0xE3, 0xFD, 0xB1, 0xF3, 0xFC, 0x74, 0x68, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0E,
-    0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0xE0, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x00, 0x1B, 0xF8, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xEC,
-    0x0B, 0xEB, 0x40, 0x0F, 0xCB, 0x00, 0x2F, 0x8F, 0x00, 0x3F, 0x4E, 0x00, 0x3F, 0x1D, 0x00, 0x3F,
-    0x6E, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xD0, 0x06, 0xFF, 0x80, 0x00, 0x74, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xF9, 0xBF, 0x00, 0x03, 0xE0, 0x05,
-    0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0xB0, 0x0B, 0x80, 0x0F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xBF, 0xC0, 0x07,
-    0xF0, 0x7E, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0xBE, 0x1F, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xD6, 0x9F, 0x80, 0x04, 0x00, 0x04, 0x00, 0x01, 0x50, 0x00,
-    0x05, 0x40, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x0B, 0xF4, 0xBF, 0x80, 0x00,
-    0x7F, 0xEF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0A, 0xBF, 0xFA, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x06, 0xAF, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x2E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF4, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x1E,
-    0x00, 0x2D, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x03, 0xC0, 0x10, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xF0, 0x01, 0xF8, 0x02, 0xF0, 0x03, 0xE0, 0x00,
-    0xF0, 0x03, 0xFE, 0xAF, 0xE0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x04, 0x00, 0xBD, 0x00, 0x1F, 0xD6, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x07, 0xF0, 0xBE, 0x0F, 0xF0, 0xFD, 0x0F, 0xE2, 0xFD, 0x2F, 0xE3, 0xFC, 0x2A, 0x82, 0xA8,
-    0x00, 0xBE, 0x00, 0x1F, 0xFF, 0x01, 0xF4, 0x2D, 0x0F, 0xBC, 0x38, 0x7F, 0x00, 0xE1, 0xEF, 0x4F,
-    0x03, 0xC0, 0xF8, 0x0B, 0xFF, 0x80, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x02, 0xEC, 0x0E, 0x7C, 0x1C,
-    0x2C, 0x34, 0x3C, 0x3F, 0xF8, 0x1F, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x80, 0x02,
-    0xD0, 0x1E, 0x00, 0x3F, 0x03, 0xF0, 0x0B, 0xF0, 0x7F, 0x00, 0xFD, 0x0F, 0xE0, 0x0B, 0xF0, 0x7F,
-    0x00, 0x1F, 0xE1, 0xFE, 0x00, 0x2F, 0xD2, 0xFD, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x3C, 0x03, 0xC0,
-    0x00, 0x50, 0x05, 0x00, 0x3F, 0xA9, 0x50, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x00, 0x07, 0xF8,
-    0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x3F,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x1A, 0x40, 0x0B, 0xFF, 0x80, 0xBF, 0x4F, 0x03, 0xF2, 0x1D,
-    0x2E, 0xFC, 0x74, 0xBE, 0x93, 0xC2, 0xF6, 0xFD, 0x03, 0xFF, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xFF, 0xD0, 0x07, 0xFF,
-    0xF0, 0x0F, 0xD1, 0xF4, 0x1F, 0x41, 0xF4, 0x2F, 0x87, 0xF0, 0x2F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x58, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0A, 0x7C, 0x00, 0x2C, 0x00, 0x74, 0x02, 0xE0,
-    0x1F, 0x80, 0x3F, 0xF0, 0x2A, 0x90, 0x07, 0xF4, 0x05, 0x2C, 0x00, 0x2C, 0x07, 0xF0, 0x01, 0xB0,
-    0x00, 0xB0, 0x3F, 0xF0, 0x3F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0xBC, 0x0B, 0xC0, 0x15, 0x00, 0x00,
-    0x1F, 0xC0, 0x1F, 0x80, 0x0B, 0xD0, 0x0B, 0xD0, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0xFC, 0x01, 0xFC,
-    0x00, 0x7E, 0x00, 0xBE, 0x00, 0x2F, 0x40, 0x3F, 0x80, 0x0F, 0xD0, 0x1F, 0xD0, 0x07, 0xF0, 0x0F,
-    0xF0, 0x03, 0xFF, 0x9F, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x3D, 0xBF,
-    0xEF, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x3E, 0x00, 0x1F, 0xFC, 0x7D, 0x00, 0x7F, 0xFC, 0xBC, 0x00, 0xFF, 0xF8, 0xFC, 0x00,
-    0xFF, 0xF0, 0xF8, 0x00, 0xFF, 0xF1, 0xF4, 0x00, 0xBF, 0xE2, 0xF0, 0x00, 0x3F, 0xC3, 0xF0, 0x00,
-    0x3F, 0xC3, 0xE0, 0x00, 0x7F, 0x47, 0xD0, 0x00, 0xFF, 0x0B, 0xC0, 0x01, 0xFF, 0x0F, 0xC0, 0x03,
-    0xFD, 0x0F, 0x80, 0x03, 0xFC, 0x1F, 0x40, 0x0B, 0xFC, 0x2F, 0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x2F,
-    0xF0, 0x3E, 0x00, 0x3F, 0xE0, 0x3D, 0x00, 0x07, 0xF0, 0x3F, 0xC0, 0xFE, 0x0B, 0xF8, 0x2A, 0x80,
-    0x02, 0x80, 0x1E, 0x00, 0xFD, 0x07, 0xBC, 0x01, 0xF0, 0xFF, 0x83, 0xF4, 0x00, 0x01, 0xE0, 0x3D,
-    0x01, 0xC0, 0x2C, 0x03, 0x80, 0x74, 0x3F, 0xE2, 0xA9, 0x02, 0xF8, 0x0F, 0x6D, 0x1C, 0x1D, 0x2C,
-    0x3C, 0x2F, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x14, 0x00, 0x07, 0x80,
-    0x38, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x0B, 0xE0, 0xBE, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x0B, 0xF0,
-    0xBF, 0x00, 0x7F, 0x87, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xC0, 0xFC, 0x00, 0x2D, 0x02, 0xD0,
-    0x00, 0x20, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x14, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0x40, 0x00, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x1F, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00,
-    0x17, 0xD4, 0x00, 0xBD, 0x05, 0x0B, 0xFF, 0xC0, 0x1F, 0x82, 0xE0, 0xFF, 0xFC, 0x07, 0xE0, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0x7C, 0x00, 0x00, 0x0F, 0xD2, 0xC7,
-    0xC0, 0x00, 0x03, 0xF4, 0xB9, 0xFD, 0x00, 0x00, 0xBE, 0x1F, 0xFF, 0xE0, 0x00, 0x2F, 0x80, 0x56,
-    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xF8, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xD0, 0x00,
-    0x17, 0xD4, 0x00, 0x7D, 0x6F, 0x82, 0xFF, 0xF0, 0x07, 0xE3, 0xFF, 0xCF, 0xFF, 0xC0, 0x7E, 0x1D,
-    0x0F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0,
-    0x00, 0x1F, 0x80, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x2F,
-    0x80, 0x0B, 0xFD, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xC0, 0x02, 0xFF, 0xFC, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xBC, 0x00, 0x00, 0x64,
-    0x00, 0x02, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x02, 0xFF, 0x00, 0x01, 0xF4,
-    0x00, 0x3F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x01, 0x41, 0xF0, 0x03, 0xF0,
-    0x00, 0x3F, 0xFF, 0x00, 0xFC, 0x0E, 0x0B, 0xFF, 0xC0, 0x3F, 0x03, 0xE0, 0x6B, 0x90, 0x0F, 0xC0,
-    0xFD, 0x00, 0x00, 0x02, 0xF4, 0x37, 0xC0, 0x00, 0x00, 0xBD, 0x0D, 0x3C, 0x00, 0x00, 0x2F, 0x83,
-    0x8B, 0x80, 0x00, 0x0B, 0xE0, 0xFF, 0xFE, 0x00, 0x01, 0xFC, 0x1F, 0xFF, 0xD0, 0x00, 0x7F, 0x00,
-    0x02, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80,
-    0x01, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x0F, 0xFB, 0xFF, 0x80, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x2F,
-    0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x1F, 0xE0, 0x00, 0x3F, 0xD3, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00,
-    0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0x0F,
-    0xD0, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x01, 0xFE, 0x00,
-    0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x6F, 0x80, 0x00,
-    0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xEF, 0xC0,
-    0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00,
-    0xFC, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xF0, 0x00, 0x00, 0x2F, 0xE7, 0x80, 0x00, 0x00, 0xF3,
-    0xFD, 0x00, 0x00, 0x03, 0xC7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0xFC,
-    0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00,
-    0xBF, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF4,
-    0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0,
-    0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x00, 0x1A, 0xA1, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x00,
-    0x2F, 0x83, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x0B,
-    0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x80,
-    0x00, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00,
-    0x00, 0x7F, 0x7F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x3F, 0x03,
-    0xF4, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x3F,
-    0xC1, 0xFE, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0xAA, 0x80, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x17, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x01, 0xAF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xAA,
-    0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x07, 0xF6, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01,
-    0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x7F, 0xCB, 0xF8, 0x00, 0x01, 0xA9, 0x2A,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xAF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0x90, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x01,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x07, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xDB, 0xE0, 0x0B, 0xD0, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xD0, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1A, 0x42, 0xA0, 0x00, 0xFD, 0x1F, 0xC0, 0x07, 0xF4, 0xFF, 0x00,
-    0x3F, 0xC3, 0xFC, 0x01, 0xFF, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xAA, 0xFF, 0xF0, 0x00,
-    0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x02,
-    0xFC, 0x00, 0x03, 0xF4, 0x7F, 0xFF, 0xFC, 0x00, 0xFC, 0x2F, 0xFF, 0xFF, 0x00, 0x7F, 0x05, 0x7F,
-    0xE5, 0x40, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x05, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x1E, 0x00, 0x00, 0x00, 0x3F, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0x8B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBE, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0x40, 0x01, 0xFF,
-    0x80, 0x1F, 0xC0, 0x00, 0xFF, 0xF0, 0x0B, 0xE0, 0x00, 0x3F, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xFF,
-    0x41, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0xBE, 0x00, 0x03, 0xFE, 0xFC, 0x3F, 0x40, 0x02, 0xFE, 0xBF,
-    0x1F, 0xC0, 0x00, 0xFF, 0x5F, 0xCB, 0xF0, 0x00, 0x3F, 0xC3, 0xF7, 0xF4, 0x00, 0x2F, 0xF0, 0xFF,
-    0xFC, 0x00, 0x0F, 0xF8, 0x3F, 0xFF, 0x00, 0x07, 0xFD, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0x42, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x02,
-    0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x02,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x40, 0x00, 0x0F,
-    0xE0, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x90, 0x5F, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xE0, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC0,
-    0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x0B,
-    0xFE, 0x41, 0x7F, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00,
-    0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x03, 0xFD,
-    0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00,
-    0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x07, 0xF4, 0x00,
-    0x02, 0xFD, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xE4, 0x17, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x38, 0x00, 0x00, 0x00, 0xBF, 0x9E, 0x00, 0x00, 0x00, 0x3C,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x02,
-    0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x07, 0xF4, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x01, 0xFF,
-    0x00, 0xBF, 0xE4, 0x17, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0xBF,
-    0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x00, 0x6A, 0x86, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80,
-    0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00,
-    0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x07,
-    0xF4, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xE4, 0x17, 0xFF, 0x80, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x2F, 0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xD0, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0xBF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xCB, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xBF,
-    0xC0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0xC0, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD5, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x3F,
-    0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x02, 0xFD,
-    0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xE0,
-    0x01, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x07, 0xF8, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x03,
-    0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x02, 0xFD, 0x00, 0x2F,
-    0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x01, 0xFF,
-    0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0x40, 0x07, 0xF8, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFA, 0xFC, 0x00,
-    0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80,
-    0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00,
-    0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x02,
-    0xFD, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x1F,
-    0xD0, 0x01, 0xFE, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x69, 0x00, 0x00,
-    0x02, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00,
-    0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFD,
-    0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xD0,
-    0x02, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00,
-    0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00,
-    0xFF, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE,
-    0x7F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x7F, 0x80,
-    0x2F, 0xD0, 0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xF9,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x3E, 0x0B, 0xE0, 0x1F, 0x00, 0xFC, 0x0B, 0xC0,
-    0xBE, 0x03, 0xE0, 0xBF, 0x00, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0x80,
-    0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xD0, 0xBC, 0x00, 0x3F, 0x40, 0xBC,
-    0x00, 0x3E, 0x0B, 0xFC, 0x00, 0xBD, 0x2F, 0xE4, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xFC, 0x7C, 0x00,
-    0x02, 0xFC, 0x7E, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xF4, 0x2F, 0xE0, 0x07, 0xF0, 0x0B, 0xF0,
-    0x0F, 0xF0, 0x03, 0xF0, 0x0F, 0xFE, 0xAF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x40,
-    0x15, 0x5B, 0xF8, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7E,
-    0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xEB, 0xFD, 0x02, 0xF0, 0x0F, 0xC0, 0x7D, 0x00, 0xFC, 0x0B, 0x80,
-    0x0F, 0xC0, 0xF0, 0x00, 0xFC, 0x0F, 0x00, 0x2F, 0x81, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7E,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFE, 0xBF, 0xD0, 0x0B, 0xC0, 0x3F, 0x00, 0x7D, 0x00, 0xFC, 0x02,
-    0xE0, 0x03, 0xF0, 0x0F, 0x00, 0x0F, 0xC0, 0x3C, 0x00, 0xBE, 0x01, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x03, 0xFA, 0xFF, 0x40,
-    0x2F, 0x00, 0xFC, 0x01, 0xF4, 0x03, 0xF0, 0x0B, 0x80, 0x0F, 0xC0, 0x3C, 0x00, 0x3F, 0x00, 0xF0,
-    0x02, 0xF8, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xE7,
-    0xF0, 0x00, 0x00, 0x00, 0xB8, 0x24, 0x00, 0x0B, 0xF6, 0xE0, 0x00, 0x3C, 0xFF, 0x00, 0x01, 0xE2,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xF8,
-    0x00, 0x3F, 0xFF, 0xE0, 0x03, 0xFA, 0xFF, 0x40, 0x2F, 0x00, 0xFC, 0x01, 0xF4, 0x03, 0xF0, 0x0B,
-    0x80, 0x0F, 0xC0, 0x3C, 0x00, 0x3F, 0x00, 0xF0, 0x02, 0xF8, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xE7, 0xF0, 0x00, 0x00, 0x01, 0xA0, 0x2A, 0x00, 0x00,
-    0xFC, 0x2F, 0xC0, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x2F, 0xF3, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xEB, 0xFD, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x07, 0xD0, 0x0F,
-    0xC0, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0xBE, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7A, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x03,
-    0xFF, 0xFE, 0x00, 0xFE, 0xBF, 0xD0, 0x2F, 0x00, 0xFC, 0x07, 0xD0, 0x0F, 0xC0, 0xB8, 0x00, 0xFC,
-    0x0F, 0x00, 0x0F, 0xC0, 0xF0, 0x02, 0xF8, 0x1F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0x00, 0x2F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0x8B, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xAF, 0xFF, 0xD1, 0xF8, 0x02, 0xF0, 0x0F, 0xFD,
-    0x5A, 0xF0, 0x1F, 0x40, 0x3F, 0xFF, 0xFF, 0xC0, 0xB8, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03,
-    0xF5, 0x50, 0x00, 0x0F, 0x00, 0x2F, 0xD0, 0x00, 0x40, 0x7F, 0xFF, 0xFF, 0xF9, 0xAF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFE, 0x7F, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xAC, 0x0B, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x3F, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x02, 0xBD, 0x00, 0x00, 0x3D, 0x00,
-    0x07, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0x91, 0xF4,
-    0x0B, 0xE5, 0x6F, 0x80, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0x83, 0xF5, 0x50, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xFE, 0xAA, 0xE0, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x2F, 0x91, 0xF4, 0x02, 0xF9, 0x5B, 0xE0, 0x0F, 0xFF, 0xFF, 0x80,
-    0xBF, 0xFF, 0xFE, 0x03, 0xF5, 0x50, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x00, 0xFF,
-    0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xDF, 0xD0, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0xBE, 0x47, 0xD0, 0x0B, 0xE5, 0x6F, 0x80, 0x3F, 0xFF, 0xFE, 0x02, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xD5, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xB8, 0x03, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x02, 0xA0, 0x29, 0x00, 0x07, 0xF0,
-    0xFE, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x3F, 0xE3, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x02, 0xF9, 0x1F, 0x40, 0x0B, 0xE5, 0x6F,
-    0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0x80, 0x3F, 0x55, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0xEA, 0xAE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90,
-    0x00, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x40, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x07,
-    0xE0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0xF8, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xD7, 0xF0, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF0, 0xBC, 0x03, 0xF0, 0xFC, 0x0B, 0xF2, 0xFC, 0x0F, 0xF3, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01,
-    0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0,
-    0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00,
-    0x15, 0xBE, 0x54, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x2F, 0xE1, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xD0, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x2F,
-    0x0F, 0x00, 0x00, 0xBF, 0x9E, 0x00, 0x00, 0xF3, 0xFC, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xBF, 0x40, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFF, 0xEF, 0xE0, 0x02, 0xFD, 0x03, 0xF0, 0x03, 0xF4, 0x03, 0xE0, 0x03, 0xF0, 0x07,
-    0xE0, 0x0B, 0xE0, 0x0B, 0xD0, 0x0F, 0xD0, 0x0F, 0xC0, 0x0F, 0xD0, 0x1F, 0xC0, 0x2F, 0xC0, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x80, 0xBF, 0x40, 0x00, 0x1A, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xFE, 0xBF, 0x80, 0xBF, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC2,
-    0xF4, 0x00, 0xFC, 0x3F, 0x00, 0x2F, 0x83, 0xF8, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x0B,
-    0xFF, 0xF0, 0x03, 0xFE, 0xBF, 0x80, 0xBF, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC2, 0xF4, 0x00, 0xFC,
-    0x3F, 0x00, 0x2F, 0x83, 0xF8, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0B, 0xFF, 0x40, 0x01, 0xFD, 0xBE, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xEB, 0xF8, 0x0B, 0xF0, 0x0F, 0xC0, 0xFC, 0x00, 0xFC, 0x2F,
-    0x40, 0x0F, 0xC3, 0xF0, 0x02, 0xF8, 0x3F, 0x81, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0E, 0x00,
-    0x0B, 0xF9, 0xE0, 0x00, 0xF3, 0xFC, 0x00, 0x1F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xEB, 0xF8, 0x0B, 0xF0, 0x0F, 0xC0, 0xFC,
-    0x00, 0xFC, 0x2F, 0x40, 0x0F, 0xC3, 0xF0, 0x02, 0xF8, 0x3F, 0x81, 0xFF, 0x03, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00,
-    0x1F, 0xC2, 0xFC, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x6A, 0x4A, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03,
-    0xFE, 0xBF, 0x80, 0x0B, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0x40, 0x0F, 0xC0, 0x3F,
-    0x00, 0x2F, 0x80, 0x3F, 0x81, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x5A, 0xAA, 0xFD, 0x0B, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xF8,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF2, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xE7, 0xF3, 0xF0, 0x00, 0x00,
-    0x0F, 0xDF, 0xCB, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0xBC, 0x00,
-    0xBD, 0x0B, 0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80, 0x2F, 0x81, 0xF4, 0x03, 0xF8, 0x2F,
-    0x40, 0x7F, 0x42, 0xF0, 0x0F, 0xF0, 0x3F, 0xE7, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD,
-    0x00, 0xBF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0xBC, 0x00, 0xBD, 0x0B, 0xC0,
-    0x0F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80, 0x2F, 0x81, 0xF4, 0x03, 0xF8, 0x2F, 0x40, 0x7F, 0x42,
-    0xF0, 0x0F, 0xF0, 0x3F, 0xE7, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00, 0xBF, 0xEF,
-    0xC0, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xDF, 0xD0, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7E, 0x0B, 0xC0, 0x0B,
-    0xD0, 0xBC, 0x00, 0xFC, 0x0F, 0xC0, 0x1F, 0xC0, 0xF8, 0x02, 0xF8, 0x1F, 0x40, 0x3F, 0x82, 0xF4,
-    0x07, 0xF4, 0x2F, 0x00, 0xFF, 0x03, 0xFE, 0x7F, 0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x06, 0x80, 0xA8, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x2F, 0xC3, 0xFC,
-    0x00, 0x3F, 0xC7, 0xF8, 0x00, 0xBF, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x1F, 0x40, 0x3F, 0x80, 0x2F, 0x40, 0x7F, 0x40,
-    0x2F, 0x00, 0xFF, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0,
-    0x0F, 0xD0, 0x07, 0xE0, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0xFC,
-    0x00, 0x03, 0xF8, 0xBD, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xFD, 0xBF,
-    0x00, 0x0F, 0xC2, 0xF8, 0x01, 0xF8, 0x0F, 0x80, 0x2F, 0x40, 0xF8, 0x03, 0xF0, 0x2F, 0x00, 0x3F,
-    0x07, 0xE0, 0x07, 0xE1, 0xFC, 0x00, 0xBE, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x00,
-    0x1F, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x00,
-    0xFF, 0x1F, 0xD0, 0x00, 0x2F, 0xE3, 0xFD, 0x00, 0x01, 0xA9, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0xBF, 0x00, 0xFC, 0x00,
-    0x07, 0xF0, 0x2F, 0x80, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x03, 0xF8, 0xBD, 0x00, 0x00, 0x3F, 0xDF,
-    0xC0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x2B, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5A, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x00, 0x2F, 0x83,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0x0F,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0xFF,
-    0x40, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0xAA, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x0F, 0xEB, 0xFD, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x02, 0xE0,
-    0x03, 0xF0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0xBE, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x0F, 0xEB, 0xFD, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x02, 0xE0, 0x03, 0xF0,
-    0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0xBE, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xBF,
-    0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x03,
-    0xF0, 0x3F, 0x40, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00,
-    0x03, 0xFC, 0x1F, 0xE0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7E, 0x00, 0x3F, 0xFF,
-    0xE0, 0x0F, 0xEB, 0xFD, 0x02, 0xF0, 0x0F, 0xC0, 0x7D, 0x00, 0xFC, 0x0B, 0x80, 0x0F, 0xC0, 0xF0,
-    0x00, 0xFC, 0x0F, 0x00, 0x2F, 0x81, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x1B, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7C,
-    0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00,
-    0xFF, 0xFC, 0x03, 0xFF, 0xAC, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0, 0x06, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x06, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xDF, 0xD0,
-    0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x0F, 0xFE, 0xB0, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x80, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xAA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x1B, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x02, 0xFF, 0xF0, 0x03, 0xFF, 0xAC, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF8, 0x20, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xD0, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x00, 0x1F, 0x82, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x01, 0xB0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x01, 0xF8, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0xAC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xAA, 0xFF, 0xF0, 0x00, 0xFF, 0x00,
-    0x0F, 0xF4, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x03,
-    0xF4, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xF4, 0x00, 0x0F, 0xE0,
-    0x0B, 0xF0, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x16, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x19, 0x00, 0x00, 0x00,
-    0x7E, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF9,
-    0xF8, 0x00, 0x1B, 0xE6, 0xF7, 0xF4, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0B, 0xE0, 0x7F, 0xD0, 0x00, 0x0F, 0x80, 0x3F, 0xC0, 0x00, 0x2F, 0x00, 0x3F, 0xC0, 0x00, 0x3E,
-    0x00, 0x7F, 0x40, 0x00, 0x3F, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xAA,
-    0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00,
-    0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x7F, 0xFF, 0xFC, 0x00, 0xFC, 0x2F, 0xFF, 0xFF, 0x00,
-    0x7F, 0x05, 0x7F, 0xE5, 0x40, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x05, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xAA, 0xFE, 0xA0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1B, 0xE6, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xE0, 0x7F, 0xD0, 0x00, 0x0F, 0x80,
-    0x3F, 0xC0, 0x00, 0x2F, 0x00, 0x3F, 0x80, 0x00, 0x3E, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x01, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x00, 0x03, 0xFD, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x6A, 0xA5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2A,
-    0xAA, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF,
-    0xFF, 0x00, 0x02, 0xF9, 0x1F, 0x40, 0x0B, 0xE5, 0x6F, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
-    0xFF, 0x80, 0x3F, 0x55, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0x90, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEA,
-    0xAA, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x02, 0xF9, 0x1F, 0x40, 0x02, 0xF9, 0x5B,
-    0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x3F, 0x55, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xFE, 0xAA, 0xE0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x0B, 0xFF, 0xF0, 0x02, 0xF9, 0x1F, 0x40, 0xBE, 0x56, 0xF8, 0x0F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF,
-    0xF8, 0x3F, 0x55, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x03, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFC, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x02, 0xF9, 0x1F, 0x40, 0xBE, 0x56, 0xF8, 0x0F, 0xFF, 0xFF, 0x82,
-    0xFF, 0xFF, 0xF8, 0x3F, 0x55, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x03, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00,
-    0x1F, 0xDF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x02,
-    0xF9, 0x1F, 0x40, 0x00, 0xBE, 0x56, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0x55, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x05, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x0A, 0x94, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0xFD, 0x02,
-    0xFF, 0x00, 0x16, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0xBE, 0x00, 0x1F, 0xFE, 0x55, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x6F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xF8, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xEB, 0xFF, 0x80, 0x00, 0xBC,
-    0x07, 0xFD, 0x00, 0x03, 0xD0, 0x0F, 0xF0, 0x00, 0x2E, 0x00, 0x3F, 0x80, 0x00, 0xF4, 0x01, 0xFD,
-    0x00, 0x03, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0x81, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x02, 0x40, 0x7F, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x05, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x02,
-    0xA5, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0x00,
-    0x16, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x2F, 0x80, 0x01, 0xFF, 0xE5, 0x5F, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06,
-    0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x3F, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xFA, 0xFF, 0xE0, 0x00, 0x2F, 0x01, 0xFF, 0x40, 0x00, 0xF4, 0x03,
-    0xFC, 0x00, 0x0B, 0x80, 0x0F, 0xE0, 0x00, 0x3D, 0x00, 0x7F, 0x40, 0x00, 0xF0, 0x03, 0xFC, 0x00,
-    0x03, 0xE0, 0x6F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x90, 0x1F, 0xD0,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD0, 0x01, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2A, 0x50, 0x03,
-    0xFC, 0x00, 0xFF, 0xFE, 0x1F, 0xF0, 0x03, 0xFF, 0xF4, 0xBF, 0xC0, 0x05, 0xBF, 0xD2, 0xFF, 0x00,
-    0x02, 0xF8, 0x07, 0xFF, 0x95, 0x7F, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x3F,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFA, 0xFF, 0xE0, 0x02, 0xF0, 0x1F, 0xF4, 0x00, 0xF4, 0x03,
-    0xFC, 0x00, 0xB8, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x40, 0x0F, 0x00, 0x3F, 0xC0, 0x03, 0xE0,
-    0x6F, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x6F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x90, 0x1F, 0xD0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xF4,
-    0x00, 0x50, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xA5, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xF8,
-    0x1F, 0xF0, 0x03, 0xFF, 0xF4, 0x2F, 0xF0, 0x01, 0x6F, 0xF4, 0x2F, 0xF0, 0x00, 0x2F, 0x80, 0x1F,
-    0xFE, 0x55, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0x8F, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xBF, 0xF8, 0x00, 0xBC, 0x07, 0xFD, 0x00,
-    0x3D, 0x00, 0xFF, 0x00, 0x2E, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x1F, 0xD0, 0x03, 0xC0, 0x0F, 0xF0,
-    0x00, 0xF8, 0x1B, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x24, 0x07, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x3F, 0x41, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x01,
-    0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x03, 0xF8,
-    0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x02,
-    0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFA, 0xAA,
-    0xFF, 0x40, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x3F, 0x6F, 0x80, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xEB, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xEB,
-    0xF0, 0x0B, 0xF4, 0x0B, 0xC0, 0x3F, 0x80, 0x2F, 0x01, 0xFC, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xE0,
-    0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0xC0, 0x3F, 0xC1, 0xFF,
-    0x01, 0xBE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC,
-    0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFD, 0x00,
-    0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xAA, 0xAF,
-    0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xC0, 0x03, 0xFF, 0x95, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xEB, 0xF8, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0xFF, 0xEB, 0xF0, 0x0B, 0xF4, 0x0B, 0xC0, 0x3F, 0x80, 0x2F, 0x00, 0xFC, 0x00, 0xFC, 0x0B,
-    0xF0, 0x07, 0xE0, 0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0xC0,
-    0x3F, 0xC1, 0xFF, 0x01, 0xBE, 0x00, 0x00, 0x07, 0xD2, 0x80, 0x00, 0xFF, 0x3C, 0x00, 0x2E, 0xBF,
-    0x80, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7D, 0x2C, 0x00, 0xFF, 0x7C, 0x02, 0xE7,
-    0xF8, 0x02, 0xD2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x55, 0xAA, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xF4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03,
-    0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x01,
-    0xFE, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0xB8, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF4, 0x02, 0xF0, 0x03, 0xF0,
-    0x07, 0xE0, 0x0B, 0xD0, 0x0F, 0xC0, 0x1F, 0xC0, 0x2F, 0xC0, 0x2F, 0x80, 0x00, 0x3E, 0x40, 0x00,
-    0xBF, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0B, 0xF0,
-    0x00, 0x7F, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40,
-    0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00,
-    0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1B, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x01, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x05, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xC0,
-    0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xBD,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x60, 0x2F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x01, 0xFD, 0xBE, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B,
-    0xF8, 0x00, 0x07, 0xF0, 0x7F, 0xC0, 0x00, 0x2F, 0x83, 0xFC, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00,
-    0x07, 0xF3, 0xFD, 0x00, 0x00, 0x3F, 0xAF, 0xD0, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0x9F, 0xFE, 0x00, 0x02, 0xFD, 0x3F, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xFD, 0x00, 0x7F, 0xC0, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF2, 0xFC,
-    0x00, 0x1F, 0xAF, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xBF, 0x7F, 0xF0, 0x03, 0xF8,
-    0xFF, 0xE0, 0x1F, 0xD1, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xAA, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0xBC, 0x00, 0xF5, 0xF0, 0x01, 0xF7, 0xD0, 0x02, 0xEF, 0x40, 0x03, 0xFE,
-    0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFF, 0x00, 0x3E, 0x7F, 0x80,
-    0x7D, 0x2F, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x80, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x3F, 0x80, 0x68, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0xFF, 0x03, 0xF0,
-    0x00, 0xFE, 0x03, 0xF0, 0x01, 0xFC, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x1F, 0x87, 0xF0,
-    0x00, 0x2F, 0x46, 0x90, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x69, 0x00, 0x3F, 0x80, 0xFD,
-    0x00, 0x3F, 0x41, 0xFD, 0x00, 0x7F, 0x03, 0xFC, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x2F, 0x4F, 0xE0, 0x0F, 0xCB, 0xF4, 0x07,
-    0xE3, 0xFC, 0x02, 0xF4, 0xAA, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFA, 0xFF, 0x80,
-    0x01, 0x6B, 0xFF, 0xF9, 0x40, 0x1F, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xF4, 0x00, 0xBE, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0x80, 0x1F, 0xC0,
-    0x00, 0xFF, 0xF0, 0x0B, 0xE0, 0x00, 0x3F, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xFF, 0x41, 0xFC, 0x00,
-    0x0F, 0xFF, 0xE0, 0xBE, 0x00, 0x03, 0xFE, 0xFC, 0x3F, 0x40, 0x02, 0xFE, 0xBF, 0x1F, 0xC0, 0x00,
-    0xFF, 0x5F, 0xCB, 0xF0, 0x00, 0x3F, 0xC3, 0xF7, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xFC, 0x00, 0x0F,
-    0xF8, 0x3F, 0xFF, 0x00, 0x07, 0xFD, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xBF, 0x40, 0x03, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFE, 0xFE, 0x00, 0xBF, 0x40, 0xFC, 0x03, 0xF4, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0xBE,
-    0x00, 0xBD, 0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xD0, 0x1F, 0xC0, 0xBF, 0x00, 0xFF, 0x03, 0xFC, 0x03,
-    0xF8, 0x1F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0x80,
-    0x00, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0x7F, 0xE0, 0x07, 0xF0, 0x00, 0x3F, 0xFC, 0x02, 0xF8, 0x00,
-    0x0F, 0xFF, 0x00, 0xFD, 0x00, 0x07, 0xFF, 0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xF8, 0x2F, 0x80, 0x00,
-    0xFF, 0xBF, 0x0F, 0xD0, 0x00, 0xBF, 0xAF, 0xC7, 0xF0, 0x00, 0x3F, 0xD7, 0xF2, 0xFC, 0x00, 0x0F,
-    0xF0, 0xFD, 0xFD, 0x00, 0x0B, 0xFC, 0x3F, 0xFF, 0x00, 0x03, 0xFE, 0x0F, 0xFF, 0xC0, 0x01, 0xFF,
-    0x43, 0xFF, 0xE0, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x1F, 0xFC,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF6, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFB, 0xF8, 0x02, 0xFD, 0x03, 0xF0, 0x0F, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x7E, 0x02, 0xF8, 0x02,
-    0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0x3F, 0x40, 0x7F, 0x02, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0,
-    0x7F, 0x80, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x0A, 0x80, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0xBE, 0x00, 0x00,
-    0xFF, 0x80, 0x0F, 0xD0, 0x00, 0x1F, 0xF8, 0x01, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x2F, 0x80, 0x00,
-    0x3F, 0xFC, 0x03, 0xF4, 0x00, 0x07, 0xFF, 0xD0, 0x7F, 0x00, 0x00, 0xFF, 0xFE, 0x0B, 0xE0, 0x00,
-    0x0F, 0xFB, 0xF0, 0xFD, 0x00, 0x02, 0xFE, 0xBF, 0x1F, 0xC0, 0x00, 0x3F, 0xD7, 0xF2, 0xFC, 0x00,
-    0x03, 0xFC, 0x3F, 0x7F, 0x40, 0x00, 0xBF, 0xC3, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFF, 0x00,
-    0x01, 0xFF, 0x43, 0xFF, 0xE0, 0x00, 0x2F, 0xF4, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x01, 0xA0, 0x00, 0x01, 0xF8, 0x7F,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDB, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xEF, 0xE0, 0x00, 0x0B, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0xFC,
-    0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0xFD, 0x01, 0xFC,
-    0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x01, 0xFE, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0xFF,
-    0x80, 0x0F, 0xD0, 0x00, 0x7F, 0xE0, 0x07, 0xF0, 0x00, 0x3F, 0xFC, 0x02, 0xF8, 0x00, 0x0F, 0xFF,
-    0x00, 0xFD, 0x00, 0x07, 0xFF, 0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xF8, 0x2F, 0x80, 0x00, 0xFF, 0xBF,
-    0x0F, 0xD0, 0x00, 0xBF, 0xAF, 0xC7, 0xF0, 0x00, 0x3F, 0xD7, 0xF2, 0xFC, 0x00, 0x0F, 0xF0, 0xFD,
-    0xFD, 0x00, 0x0B, 0xFC, 0x3F, 0xFF, 0x00, 0x03, 0xFE, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0x43, 0xFF,
-    0xE0, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF6, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFB, 0xF8, 0x02, 0xFD, 0x03, 0xF0, 0x0F,
-    0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x7E, 0x02, 0xF8, 0x02, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0x3F, 0x40,
-    0x7F, 0x02, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x7F, 0x80, 0xBF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x68, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x02, 0xFC,
-    0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x07, 0xF4, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x00,
-    0xBF, 0xE4, 0x17, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xA8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x0B, 0xF0, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0x40, 0x0F, 0xC0, 0x3F, 0x00, 0x2F, 0x80, 0x3F, 0x81, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0,
-    0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x01,
-    0xFD, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x2F, 0xF9, 0x05, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x0B, 0xF0, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x2F, 0x40, 0x0F, 0xC0, 0x3F, 0x00, 0x2F, 0x80, 0x3F, 0x81, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x07, 0xF8,
-    0x00, 0x01, 0xA9, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0x40, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4,
-    0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x90, 0x5F, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x2F, 0xD0, 0x07, 0xF8, 0x01, 0xA9, 0x00,
-    0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x07, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
-    0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0xAF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF4, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xEA, 0xA9, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x06, 0xF9, 0x00, 0x0B, 0xFF, 0xF6, 0xFF, 0xF4, 0x03, 0xFE, 0xBF, 0xFE,
-    0x0B, 0xC0, 0xBF, 0x00, 0xFF, 0x55, 0xBD, 0x0F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD2, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFD, 0x3F, 0x00, 0x3F, 0x95, 0x00, 0x03, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFA, 0xAF, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xEB, 0xFF, 0xFF, 0x00, 0x2F, 0xE0,
-    0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xE5, 0x6F, 0x40, 0x02, 0xF0,
-    0x03, 0xE0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x0F,
-    0xD5, 0xBF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xD0, 0xFD, 0x00, 0x2F, 0xE0, 0x3F, 0x80, 0x0F, 0xF4, 0x0F, 0xE0, 0x07, 0xFC, 0x0B, 0xFC,
-    0x02, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x2A, 0x90, 0x6A, 0xA0, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xBF,
-    0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03,
-    0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xE5, 0x6F, 0x40, 0x02, 0xF0, 0x03,
-    0xE0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x0F, 0xD5,
-    0xBF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xD0, 0xFD, 0x00, 0x2F, 0xE0, 0x3F, 0x80, 0x0F, 0xF4, 0x0F, 0xE0, 0x07, 0xFC, 0x0B, 0xFC, 0x02,
-    0xFF, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x2A, 0x90, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF8,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB,
-    0xF0, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x01, 0xF9, 0x5B, 0xD0, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x3F,
-    0x00, 0x3E, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x3F, 0x56, 0xFE,
-    0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0x43, 0xF4, 0x00, 0x0B, 0xF8, 0x0F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0x80, 0x01, 0xFF, 0x02,
-    0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0xAA, 0x41, 0xAA, 0x80,
-    0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0xFD, 0x7F, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xC0, 0x00,
-    0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFD, 0x01, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0xE4, 0x00, 0x7F, 0xC0, 0x3F, 0xFA, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x7D, 0x00, 0x40, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x90,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x02, 0xFC, 0x03, 0xE5, 0xBF, 0xC0, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFD, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xDF,
-    0xD0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x01, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xE4, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xAB, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x1F, 0xDF, 0xC0,
-    0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x10, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFE,
-    0x40, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x0F,
-    0x96, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x10, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0E,
-    0x40, 0x07, 0xFC, 0x03, 0xFF, 0xAB, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0x5F,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xD0, 0x04, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF9,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x2E, 0x5B, 0xFC, 0x0B,
-    0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0x90, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0xEF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x2E, 0x00, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x04, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x39, 0x00,
-    0x1F, 0xF0, 0x00, 0x3F, 0xFA, 0xBF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x02,
-    0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x90, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x03, 0xE5, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x05, 0x7C, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xF0, 0x1A, 0xFE, 0xA8, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF,
-    0x80, 0x03, 0xFF, 0xE0, 0x02, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x6B, 0xC0, 0x00, 0x3F, 0xE0,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x01, 0xF8, 0x7F, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x1B, 0x01, 0xF8, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x6B, 0xFA, 0xA0, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x15, 0xBF, 0xD5, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0xBF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1A, 0xFE, 0xA8, 0x00, 0x3F, 0x00, 0x0F, 0xFF,
-    0xFF, 0x47, 0xFF, 0xFF, 0xC1, 0x5B, 0xF5, 0x50, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x60, 0x00, 0x00,
-    0x00, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFD,
-    0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xD0,
-    0x02, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00,
-    0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00,
-    0xFF, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xA0,
-    0x00, 0x1F, 0xE3, 0xC0, 0x00, 0xF7, 0xDE, 0x00, 0x03, 0xCB, 0xF4, 0x00, 0x0F, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x2F, 0x00,
-    0x2F, 0x40, 0xBC, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x0F, 0x80, 0x2F, 0x80, 0x7D, 0x00, 0xFE,
-    0x02, 0xF4, 0x07, 0xF4, 0x0B, 0xC0, 0x3F, 0xC0, 0x3F, 0xE7, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAB,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x3F,
-    0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x02, 0xFE,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x1F, 0xF0,
-    0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00,
-    0x07, 0xF4, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0B, 0xC0,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x1F, 0x40, 0x3F, 0x80, 0x2F, 0x40,
-    0x7F, 0x40, 0x2F, 0x00, 0xFF, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F,
-    0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xE0,
-    0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x02, 0xFE, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
-    0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x07,
-    0xF4, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x7E, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x0B, 0xC0, 0x0B,
-    0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x1F, 0x40, 0x3F,
-    0x80, 0x2F, 0x40, 0x7F, 0x40, 0x2F, 0x00, 0xFF, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x2F, 0xF0,
-    0x01, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x80, 0x1F,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xEB, 0x40, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x7E, 0x0B, 0xC0, 0x0B, 0xD0, 0xBC, 0x00, 0xFC, 0x0F, 0xC0, 0x1F, 0xC0,
-    0xF8, 0x02, 0xF8, 0x1F, 0x40, 0x3F, 0x82, 0xF4, 0x07, 0xF4, 0x2F, 0x00, 0xFF, 0x03, 0xFE, 0x7F,
-    0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x01, 0xA4, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0xFF,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00,
-    0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x01, 0xFF,
-    0x00, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x0B,
-    0xF8, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x02, 0xA0, 0x01, 0xFD, 0x00,
-    0x3F, 0x80, 0x1F, 0xE0, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x01, 0xF8, 0x00, 0x0B, 0xC0,
-    0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xE0, 0x0B, 0xE0,
-    0x00, 0x1F, 0x40, 0x3F, 0x80, 0x00, 0xBD, 0x01, 0xFD, 0x00, 0x02, 0xF0, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF9, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00, 0x3F, 0xC0,
-    0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x02, 0xFD, 0x00,
-    0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0x01,
-    0xFE, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0,
-    0xBC, 0x00, 0xBD, 0x0F, 0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80, 0x2F, 0x81, 0xF4, 0x03,
-    0xF8, 0x2F, 0x00, 0x7F, 0x43, 0xF4, 0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x2F,
-    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x40,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00,
-    0x00, 0x00, 0xAA, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF4, 0x03, 0xF0,
-    0x0B, 0xF8, 0x03, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x02, 0xFF, 0x42, 0xFE, 0x00, 0x3F,
-    0xC1, 0xFF, 0xE0, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xFF, 0xFF, 0x3F,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xE3, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF0, 0xBF, 0xFC, 0x00, 0x02, 0xFF, 0xF0, 0x2F, 0xFD, 0x00,
-    0x00, 0xBF, 0xF8, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0x6F, 0x80, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x2F, 0x87,
-    0xF0, 0x14, 0x03, 0xF0, 0x7F, 0x07, 0xE0, 0xFE, 0x07, 0xF0, 0xFF, 0x1F, 0xC0, 0x7F, 0x3F, 0xF7,
-    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFB, 0xFF, 0x40, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x02, 0xA0, 0x1A, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0xFD, 0xBE, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x03,
-    0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0, 0xFF,
-    0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x0B, 0xE7, 0xF4, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4,
-    0x03, 0xF4, 0x01, 0xF8, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x03, 0xF4, 0x3F,
-    0x00, 0x00, 0xFE, 0x2F, 0x40, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2B, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x1F, 0xD2, 0xFC,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x6A, 0x8A, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0,
-    0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0, 0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1A, 0xAF, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1A, 0xAF, 0xF8, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x0A, 0x40, 0x1A, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xF4, 0x07, 0xE0, 0x00, 0x02, 0xF9, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xAB, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0x40, 0x00,
-    0xFE, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0,
-    0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x07, 0xF4, 0x01, 0xA9, 0x01, 0xF0,
-    0x0F, 0x40, 0xBC, 0x0B, 0xC0, 0x15, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFF, 0x40,
-    0x0F, 0xEB, 0xE0, 0x2F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0x43, 0xE1, 0xE3, 0xFD, 0xB1,
-    0xF3, 0xFC, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x1F, 0xFF, 0xFE, 0x3F, 0xFE,
-    0xA9, 0x00, 0x00, 0x15, 0x50, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x07, 0xE2, 0xFF, 0xFF, 0x47, 0xFF, 0xF8, 0x07, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xD1, 0xFD, 0x3F, 0xC3, 0xFC, 0x6A, 0x80, 0x0F, 0x87, 0xE2, 0xF8, 0xBD, 0x3F, 0x4F,
-    0xDB, 0xF6, 0xFC, 0x14, 0x0F, 0xC0, 0x70, 0xB8, 0x34, 0x00, 0x00, 0x0B, 0x83, 0xFE, 0x3E, 0xE3,
-    0xFC, 0x2F, 0x40, 0x01, 0xFC, 0x00, 0x3F, 0x41, 0xFD, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x3F, 0x81,
-    0xA9, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x0F, 0xDF, 0xD0, 0x07, 0xFF, 0x40,
-    0x02, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x07,
-    0xF8, 0x00, 0xFF, 0x00, 0x1A, 0x90, 0x02, 0xA8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0xC0, 0x0F,
-    0xF4, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xF4,
-    0x00, 0x00, 0x02, 0x80, 0x7C, 0xBF, 0x8F, 0xF4, 0x1F, 0x01, 0xE0, 0x64, 0x0B, 0xC0, 0x7F, 0xC3,
-    0xFD, 0x2E, 0x01, 0xE0, 0x7F, 0xA9, 0x4B, 0xFF, 0xFC, 0x6A, 0xAF, 0xC0, 0x00, 0xFC, 0x00, 0x1F,
-    0x80, 0x01, 0xF4, 0x00, 0x01, 0xE0, 0xB8, 0x3D, 0xBF, 0x3F, 0x06, 0x00, 0x00, 0x01, 0xE1, 0xF4,
-    0xF4, 0x2F, 0x03, 0x80, 0x00, 0x09, 0x01, 0xF0, 0xFF, 0x0F, 0xFD, 0x1B, 0xD0, 0x00, 0x74, 0x07,
-    0xFE, 0x2F, 0xF0, 0xFA, 0x0B, 0x40, 0x00, 0x05, 0x02, 0x4B, 0xF8, 0x70, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xBF, 0xFC, 0x2F, 0xFF, 0xFC, 0x7F, 0xFE, 0xA8, 0x06, 0x90, 0xFE, 0x1F, 0xD3, 0xFD,
-    0x3F, 0xC0, 0x0B, 0xC2, 0xF0, 0x3F, 0x0F, 0xC2, 0xFC, 0xBF, 0x0F, 0xF3, 0xFC, 0x0B, 0x83, 0xFE,
-    0x3E, 0xE3, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x03,
-    0xFD, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x02, 0x80, 0x1E, 0x00, 0xFD, 0x07, 0xBC,
-    0x01, 0xF0, 0xFF, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xFD, 0x0F, 0xC0, 0x7F, 0xE0, 0xFF,
-    0x80, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0xBE, 0x03, 0xF4, 0x1F, 0xC0, 0xBF, 0x03, 0xF4,
-    0x00, 0x2F, 0xFF, 0xD3, 0xFF, 0xFC, 0x3F, 0xAF, 0xC7, 0xE1, 0xF8, 0xBD, 0x2F, 0x40, 0x3F, 0x00,
-    0x1F, 0x81, 0xFD, 0x1F, 0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xFF, 0x80,
-    0x1F, 0xD2, 0xFC, 0x0F, 0xC0, 0x0F, 0xD0, 0x0B, 0xC2, 0xD3, 0xFE, 0x3D, 0x7E, 0xFB, 0xCB, 0x8F,
-    0xF8, 0xB8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x05, 0x50,
-    0x00, 0x06, 0xAB, 0xF4, 0xBF, 0xFF, 0xE7, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xE0, 0xF0, 0x3F,
-    0xC3, 0xC2, 0xFB, 0xFE, 0x0F, 0x4F, 0xF0, 0x3D, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x00, 0x1E, 0x07, 0xE0, 0x7C, 0x0F, 0x4B, 0xD1, 0xF0, 0x10,
-    0x68, 0x0A, 0x82, 0xF8, 0x3F, 0x47, 0xF0, 0xBE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD2, 0xFF, 0xFC, 0x3E, 0x5F, 0xC3, 0xD0, 0xF8, 0x7D, 0x5F,
-    0x4B, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x02, 0xEF, 0x40, 0xFF, 0xFC, 0x1D, 0xBB, 0xC2, 0xCF, 0x38,
-    0x38, 0xE7, 0x00, 0x00, 0x00, 0x09, 0x24, 0x1F, 0x80, 0x3C, 0x03, 0xF0, 0x38, 0xE0, 0x00, 0x06,
-    0x43, 0xE1, 0xE3, 0xFD, 0xB1, 0xF3, 0xFC, 0x74, 0x68, 0x00, 0x00, 0x03, 0x81, 0xF4, 0x7E, 0x3F,
-    0x09, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x0F, 0xC3, 0xF0, 0x07, 0xF1, 0xFC, 0x03,
-    0xFC, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0x81, 0xFE, 0xFD, 0x0F, 0xC2, 0xF0, 0x3F, 0x0F,
-    0xC0, 0x00, 0x6A, 0xBF, 0xC0, 0x3F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0x03, 0xEA, 0xAA, 0x50, 0x00, 0x00, 0x00,
-    0x2F, 0x07, 0xD0, 0xFC, 0x3F, 0x07, 0xE0, 0xF8, 0x2F, 0x47, 0xD0, 0xFC, 0x3F, 0x07, 0xF0, 0xFC,
-    0x00, 0x1F, 0xFE, 0x0B, 0xFF, 0xC3, 0xFF, 0xF0, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x2A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x00, 0x01, 0xFB, 0x6E, 0x00, 0x1F,
-    0xFC, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xEF, 0xFF, 0x00, 0x1F, 0xE7, 0xE0, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x01, 0x54, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x81, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xC0, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFF, 0xD0, 0x7F, 0xFF, 0xE0, 0x2F, 0xF0,
-    0x02, 0xFF, 0x90, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x02, 0x80, 0x3F, 0xFD, 0x1F, 0x82, 0xF8,
-    0xFD, 0xFC, 0x0F, 0xD1, 0xFF, 0xE0, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x02,
-    0xA0, 0x1F, 0xFF, 0x0F, 0xC0, 0xFC, 0x7D, 0xBE, 0x07, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x07, 0xD0, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0x10, 0x14, 0x0F, 0x40, 0xC0, 0x10, 0x14, 0x00, 0x00, 0x00, 0x20,
-    0xF0, 0x00, 0x00, 0x07, 0xC1, 0xF8, 0x00, 0x06, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F,
-    0xFF, 0x90, 0x00, 0x00, 0x1A, 0xFE, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFD, 0x00, 0x06,
-    0xFD, 0x0B, 0x80, 0x00, 0x00, 0x7D, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x01, 0x55, 0x55, 0x55, 0x57,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE9, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00,
-    0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x7F, 0xCB, 0xF8, 0x00, 0x01, 0xA9,
-    0x2A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0x90, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEA,
-    0xAA, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0xAA, 0xA9, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x40,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x07,
-    0xF0, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x03,
-    0xF8, 0x00, 0x2F, 0xC1, 0xFF, 0xC0, 0x00, 0xFE, 0x0B, 0xFD, 0x00, 0x03, 0xF8, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0xBF, 0xC0, 0x03, 0xF8,
-    0x00, 0xFD, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x2F, 0xC0, 0x00, 0x2A, 0x03, 0xF9, 0x55, 0x50, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x6F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xD0, 0x10, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0E, 0x40, 0x07, 0xFC,
-    0x03, 0xFF, 0xAB, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF,
-    0xE4, 0x00, 0x00, 0x2F, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0B,
-    0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x40,
-    0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0x0B, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0xBF, 0x2F, 0xC0, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x18, 0x0B, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAB, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF5, 0x40,
-    0x00, 0x03, 0xE0, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFC, 0x02, 0xF0,
-    0x0F, 0xC0, 0x03, 0xE0, 0x0F, 0xC0, 0x3F, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0xFC, 0x01,
-    0xF4, 0x1F, 0xF0, 0x07, 0xE0, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0x40, 0x3F, 0xFF, 0xF8, 0x07, 0xFC,
-    0x00, 0xFF, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x03, 0xC0, 0x00,
-    0x03, 0xF0, 0x01, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x00,
-    0x3F, 0xAA, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
-    0xF0, 0x00, 0xF8, 0x0B, 0xE0, 0xFC, 0x00, 0x7D, 0x01, 0xF8, 0x3E, 0x00, 0x2F, 0x00, 0xBE, 0x2F,
-    0x40, 0x0F, 0xC1, 0xBF, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0xC3, 0xF0, 0x01, 0xFF, 0xFF, 0xC1, 0xF8,
-    0x00, 0xFF, 0xFF, 0x40, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xDA, 0x90,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x41, 0xF8, 0x00, 0xFF, 0x00,
-    0x3E, 0x00, 0xBF, 0x80, 0x1F, 0x40, 0x3F, 0xD0, 0x0B, 0xD0, 0x0F, 0xF0, 0x03, 0xF0, 0x07, 0xFC,
-    0x01, 0xFC, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x82, 0xFE, 0x00, 0x01, 0xFC, 0x1F,
-    0xF0, 0x00, 0x0B, 0xE0, 0xFF, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x01, 0xFC, 0xFF, 0x40, 0x00,
-    0x0F, 0xEB, 0xF4, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE7, 0xFF, 0x80, 0x00, 0xBF,
-    0x4F, 0xFF, 0x80, 0x03, 0xFC, 0x0F, 0xFF, 0x40, 0x1F, 0xF0, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1A, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x7F, 0x80, 0x0F,
-    0xD0, 0x03, 0xFD, 0x00, 0x7F, 0x00, 0x3F, 0xF0, 0x02, 0xFC, 0x03, 0xFF, 0xC0, 0x0F, 0xE0, 0x2F,
-    0xFE, 0x00, 0x3F, 0x41, 0xFF, 0xF4, 0x01, 0xFC, 0x1F, 0xFF, 0xC0, 0x0B, 0xE0, 0xFE, 0xFF, 0x00,
-    0x3F, 0x4F, 0xEB, 0xF8, 0x01, 0xFC, 0xBF, 0x3F, 0xD0, 0x0B, 0xFB, 0xF1, 0xFF, 0x00, 0x3F, 0xFF,
-    0x4B, 0xFC, 0x00, 0xFF, 0xF8, 0x3F, 0xE0, 0x07, 0xFF, 0xC1, 0xFF, 0x40, 0x2F, 0xFC, 0x0F, 0xFC,
-    0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x07, 0xFE, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x41, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0xA8, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x07,
-    0xF0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x03, 0xFC, 0x2F, 0x80, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0x01,
-    0xFD, 0xBD, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x01, 0xAF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x06, 0x90, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x7F,
-    0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x03, 0xF4,
-    0x01, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x7F, 0x00,
-    0x0F, 0xC0, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x03, 0xF4, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00,
-    0x00, 0xFD, 0x3F, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xFE, 0x03,
-    0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x1F, 0xE0, 0x00, 0x3F,
-    0xD3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF4,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0xA4, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0x07, 0xF8, 0x01, 0xF8, 0x03, 0xD0, 0x0B, 0xD0,
-    0x1F, 0x00, 0x3F, 0x55, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x02, 0xFA, 0xAF, 0x40, 0x0F, 0x40, 0x1F,
-    0x00, 0x3C, 0x00, 0x7C, 0x02, 0xF0, 0x07, 0xD0, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0x80, 0x0B, 0x80, 0x0F, 0x40, 0x3D, 0x00, 0x2F, 0x00, 0xF0, 0x00, 0xFC, 0x07, 0xC0,
-    0x6F, 0xE0, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x3F,
-    0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x00, 0x3F,
-    0x40, 0xFD, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0xBE, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0xC0,
-    0x1B, 0xFD, 0x57, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x7F, 0x00, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xA4, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x55, 0x50, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x03, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC3,
-    0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xD7, 0xFF,
-    0x5F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xCF, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0x87, 0xF8, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0xBF, 0x43, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x0F,
-    0xF0, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0x54, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xC0, 0x01,
-    0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x06, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x1A, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x01, 0x40, 0x1F, 0xE0, 0x2F, 0xAF,
-    0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xE0, 0x03, 0xF4, 0x00, 0xFF, 0x40, 0x1F,
-    0xC0, 0x0F, 0xFC, 0x00, 0xBF, 0x00, 0xFF, 0xF0, 0x03, 0xF8, 0x0B, 0xFF, 0x80, 0x0F, 0xD0, 0x7F,
-    0xFD, 0x00, 0x7F, 0x07, 0xFF, 0xF0, 0x02, 0xF8, 0x3F, 0xBF, 0xC0, 0x0F, 0xD3, 0xFA, 0xFE, 0x00,
-    0x7F, 0x2F, 0xCF, 0xF4, 0x02, 0xFE, 0xFC, 0x7F, 0xC0, 0x0F, 0xFF, 0xD2, 0xFF, 0x00, 0x3F, 0xFE,
-    0x0F, 0xF8, 0x01, 0xFF, 0xF0, 0x7F, 0xD0, 0x0B, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xFC,
-    0x01, 0xFF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xE0,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xFE, 0x00, 0x3F, 0x40, 0x0F,
-    0xF4, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xF0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0xBF, 0xF8, 0x00,
-    0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xF0, 0x7F, 0xFF, 0x00, 0x2F, 0x83, 0xFB, 0xFC, 0x00, 0xFD, 0x3F,
-    0xAF, 0xE0, 0x07, 0xF2, 0xFC, 0xFF, 0x40, 0x2F, 0xEF, 0xC7, 0xFC, 0x00, 0xFF, 0xFD, 0x2F, 0xF0,
-    0x03, 0xFF, 0xE0, 0xFF, 0x80, 0x1F, 0xFF, 0x07, 0xFD, 0x00, 0xBF, 0xF0, 0x3F, 0xF0, 0x03, 0xFF,
-    0x40, 0xFF, 0xC0, 0x1F, 0xF8, 0x0B, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xE0, 0x00, 0x1F, 0xC1,
-    0xFF, 0x00, 0x00, 0xBE, 0x0F, 0xF0, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF4, 0x00,
-    0x00, 0xFE, 0xBF, 0x40, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0xF8, 0x00, 0x0B,
-    0xF4, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0xF4, 0x01, 0xFF, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x82, 0xFC,
-    0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x01, 0xFC,
-    0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0x7F, 0x03, 0xFC, 0x00,
-    0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFD, 0x07, 0xF4, 0x00, 0x6F, 0xC0, 0xBF, 0x00, 0x1F, 0xF8, 0x0F,
-    0xF0, 0x03, 0xFF, 0x01, 0xFE, 0x00, 0x2A, 0x80, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xFC, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x01,
-    0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0xBF, 0xF4, 0x2F, 0xFD, 0x00, 0x3F, 0xFD, 0x1F, 0xFF, 0x00, 0x0F,
-    0xFF, 0x8F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFB, 0xFF, 0xE0, 0x03, 0xFA, 0xFF, 0xF7, 0xF4, 0x00, 0xFD,
-    0xBF, 0xF9, 0xFC, 0x00, 0x7F, 0x2F, 0xFC, 0xBF, 0x00, 0x2F, 0xCB, 0xFD, 0x3F, 0x80, 0x0F, 0xE1,
-    0xFF, 0x0F, 0xD0, 0x07, 0xF4, 0x7F, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0x00, 0xFE, 0x00, 0x15, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x2F,
-    0xC0, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xBF, 0x40,
-    0x03, 0xF8, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x0F,
-    0xF0, 0x02, 0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFA, 0xAA, 0xFF, 0x40, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x7F, 0xD0,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF, 0x40,
-    0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00,
-    0x7F, 0xC0, 0x2F, 0xF9, 0x05, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x2F,
-    0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x0B, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFD, 0x00,
-    0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x1F, 0xC0, 0x0F, 0xE0, 0x0B, 0xF0, 0x07, 0xF4,
-    0x03, 0xF8, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x0A, 0xAA, 0x40, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0xBE, 0x01,
-    0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B, 0xE0, 0x1F, 0xF0, 0x03, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFA, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x1B, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xA9, 0x00, 0x0A, 0x80, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x03, 0xF4,
-    0x0F, 0xC0, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x02, 0xFC, 0x3F, 0x00, 0x00, 0x1F, 0xDB, 0xD0, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1A,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x2F, 0x47, 0xF0,
-    0x3D, 0x3C, 0x0F, 0xF0, 0x3D, 0x78, 0x0F, 0xE0, 0xBC, 0xBD, 0x6F, 0xEB, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x01,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x02, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF7,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC7, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x1F, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x03,
-    0xE0, 0x01, 0xF8, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x1F, 0xC0,
-    0x1F, 0x80, 0x0B, 0xE0, 0x0B, 0xD0, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x7F,
-    0x00, 0xBF, 0x00, 0x2F, 0x80, 0x3F, 0x80, 0x0F, 0xD0, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xFE, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x15, 0x55, 0x5F, 0xD0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBC,
-    0x07, 0xC0, 0x0F, 0x80, 0xB8, 0x01, 0xF4, 0x0F, 0x00, 0x2F, 0x01, 0xF0, 0x03, 0xF0, 0x2D, 0x00,
-    0x7E, 0x03, 0xC0, 0x0F, 0xD0, 0x3E, 0x1B, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF8, 0x00,
-    0xBF, 0x8F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0xBE, 0x05, 0x41, 0xF8, 0x03, 0xF4, 0x3F, 0x4B, 0xE0, 0x1F, 0xC1, 0xFC, 0x3F, 0x00,
-    0xBF, 0x0B, 0xE0, 0xFC, 0x03, 0xF8, 0x3F, 0x47, 0xE0, 0x0F, 0xD0, 0xFC, 0x2F, 0x40, 0x7F, 0x07,
-    0xF0, 0xFC, 0x02, 0xF8, 0x2F, 0x83, 0xF0, 0x0F, 0xD0, 0xBD, 0x1F, 0x80, 0x3F, 0x03, 0xF0, 0xBD,
-    0x01, 0xFC, 0x0F, 0xC3, 0xF0, 0x0B, 0xE0, 0x7D, 0x0F, 0xC0, 0x3F, 0x42, 0xF0, 0x3E, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x55, 0x55, 0x55,
-    0x54, 0x00, 0x00, 0x69, 0x00, 0x00, 0xA4, 0x03, 0xF4, 0x3F, 0x4B, 0xE0, 0x1F, 0xC1, 0xFC, 0x3F,
-    0x40, 0xBF, 0x0B, 0xF0, 0xFC, 0x03, 0xF8, 0x2F, 0x47, 0xF0, 0x0F, 0xC0, 0xFC, 0x2F, 0x80, 0x7F,
-    0x03, 0xF0, 0xFD, 0x02, 0xF8, 0x1F, 0x83, 0xF0, 0x0F, 0xD0, 0xBD, 0x0F, 0x80, 0x3F, 0x03, 0xF0,
-    0x7D, 0x01, 0xF8, 0x0F, 0xC2, 0xF0, 0x0B, 0xD0, 0x7E, 0x0F, 0xC0, 0x3F, 0x02, 0xF4, 0x3E, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x47, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0xAA, 0xAA,
-    0xAA, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x15, 0x5A, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7E, 0x54, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xD0, 0x0F, 0x40, 0xBE, 0x01, 0xF4, 0x07, 0xE0, 0x2F, 0x00, 0xFD, 0x03, 0xF0, 0x6F, 0xC0, 0x7F,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x3E, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE5, 0x40, 0x00, 0x7F,
-    0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x0F, 0xE0, 0x03, 0xD0, 0x2F, 0x80,
-    0x7F, 0x40, 0x1F, 0x40, 0x7E, 0x02, 0xFC, 0x00, 0xBC, 0x03, 0xF4, 0x0F, 0xF0, 0x03, 0xF0, 0x6F,
-    0xC0, 0x7F, 0x80, 0x1F, 0xFF, 0xFE, 0x02, 0xFE, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xF4, 0x03, 0xFF,
-    0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xE5, 0x40,
-    0x0B, 0xFF, 0xF4, 0x0F, 0xFF, 0xFD, 0x0F, 0x40, 0xBE, 0x1F, 0x40, 0x7E, 0x2F, 0x00, 0xFD, 0x3F,
-    0x06, 0xFC, 0x7F, 0xFF, 0xF8, 0xBF, 0xFF, 0xF0, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x2F, 0xC0, 0x0F,
-    0xF0, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0x0A, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x55, 0x56, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x0B, 0xFD, 0x00, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0xAE, 0x40, 0x00, 0x7C, 0x0B, 0xFF, 0xF0, 0x00, 0xFC,
-    0x2F, 0xFF, 0xF8, 0x00, 0xF8, 0xBF, 0x81, 0xFC, 0x01, 0xF0, 0xFD, 0x00, 0xBC, 0x02, 0xF2, 0xF8,
-    0x00, 0xBC, 0x03, 0xFF, 0xF0, 0x00, 0xBC, 0x03, 0xFF, 0xE0, 0x00, 0xF8, 0x07, 0xFF, 0xD0, 0x01,
-    0xF4, 0x0B, 0xFF, 0xC0, 0x02, 0xF0, 0x0F, 0x8F, 0xC0, 0x07, 0xF0, 0x0F, 0x0F, 0xF0, 0x6F, 0xD0,
-    0x1F, 0x0F, 0xFF, 0xFF, 0xC0, 0x2E, 0x0B, 0xFF, 0xFF, 0x00, 0x3D, 0x03, 0xFF, 0xFD, 0x00, 0x3C,
-    0x00, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xFD, 0x00, 0x01, 0xF9, 0x5B, 0xD0, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0,
-    0x00, 0xFC, 0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x01, 0xFF, 0x57, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xF4, 0x7F, 0xE0, 0x00,
-    0xFE, 0x03, 0xFD, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0xFF,
-    0xC0, 0x1F, 0xF8, 0x0F, 0xF8, 0x02, 0xAA, 0x41, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x7E, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xEB, 0xFD, 0x02, 0xF0, 0x0F, 0xC0, 0x7D, 0x00, 0xFC, 0x0B,
-    0x80, 0x0F, 0xC0, 0xF0, 0x00, 0xFC, 0x0F, 0x00, 0x2F, 0x81, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xD1, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F,
-    0xD0, 0x0F, 0xF0, 0x07, 0xF0, 0x07, 0xF8, 0x01, 0xFD, 0x07, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0x80, 0x2F, 0x01, 0xF0, 0x0F, 0x80, 0x78, 0x07, 0xD0, 0x7D, 0x02, 0xFF, 0xFD,
-    0x00, 0xFF, 0xFF, 0xC0, 0x3D, 0x01, 0xF4, 0x1F, 0x00, 0xFD, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0x41, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0x00,
-    0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0B, 0xEB,
-    0xF4, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x1F, 0x87, 0xF0, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x7F, 0x0F,
-    0xD0, 0x01, 0xFD, 0x0F, 0xC0, 0x07, 0xF4, 0x1F, 0xC0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x02, 0xF9, 0x1F, 0x40, 0xBE, 0x56, 0xF8, 0x0F,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xF8, 0x3F, 0x55, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xAE,
-    0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0xFF, 0x02, 0xF4, 0x07,
-    0xE0, 0x7F, 0x80, 0x0B, 0xF8, 0x3F, 0x80, 0xFD, 0x1F, 0xF0, 0x00, 0x3F, 0xD2, 0xFC, 0x1F, 0xC7,
-    0xFC, 0x00, 0x00, 0xFF, 0x2F, 0xC3, 0xF8, 0xFF, 0x00, 0x00, 0x07, 0xF9, 0xFC, 0x3F, 0x7F, 0xC0,
-    0x00, 0x00, 0x2F, 0xEF, 0xCB, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0xEF, 0xFE, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0xFF, 0xCB, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0x0F,
-    0xF8, 0x3F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 0x41, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x2E,
-    0xBD, 0x00, 0x00, 0xD0, 0x00, 0x2C, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x0B, 0x80, 0x40, 0xF4,
-    0x1F, 0xFF, 0x03, 0xFF, 0xD0, 0x1B, 0xE4, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xFD,
-    0x01, 0xF8, 0x0F, 0xFC, 0x02, 0xF4, 0x2F, 0xFC, 0x03, 0xF0, 0xBF, 0xF8, 0x03, 0xF2, 0xFE, 0xF4,
-    0x07, 0xEB, 0xF3, 0xF0, 0x0B, 0xEF, 0xC3, 0xF0, 0x0F, 0xFF, 0x47, 0xE0, 0x0F, 0xFD, 0x0F, 0xD0,
-    0x1F, 0xF4, 0x0F, 0xC0, 0x2F, 0xE0, 0x1F, 0xC0, 0x2A, 0x80, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x07, 0xE0, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x50, 0x00, 0xB8, 0x0B, 0xD0, 0x03, 0xD0, 0x7F, 0x00, 0x0F, 0x07,
-    0xFC, 0x00, 0x7C, 0x3F, 0xE0, 0x02, 0xE3, 0xFF, 0x40, 0x0F, 0x6E, 0xBC, 0x00, 0x7E, 0xF3, 0xF0,
-    0x02, 0xFF, 0x1F, 0x80, 0x0F, 0xF4, 0xFD, 0x00, 0x3F, 0x83, 0xF0, 0x01, 0xFC, 0x2F, 0xC0, 0x00,
-    0x00, 0x1F, 0x4B, 0xE0, 0x00, 0xFC, 0x7E, 0x00, 0x07, 0xD7, 0xE0, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x3E, 0xBF, 0xC0, 0x02, 0xF4, 0xFF, 0xC0, 0x0F, 0xC1, 0xFF, 0xC0, 0x00, 0x2F, 0xFF,
-    0x00, 0x0F, 0xFF, 0xC0, 0x03, 0xD2, 0xE0, 0x01, 0xF0, 0xF4, 0x00, 0xB8, 0x7C, 0x00, 0x3D, 0x2F,
-    0x00, 0x1F, 0x0F, 0x80, 0x0F, 0x83, 0xD0, 0x03, 0xD2, 0xF0, 0x07, 0xF0, 0xFC, 0x03, 0xF4, 0x3E,
-    0x00, 0x50, 0x05, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0xFE, 0x01, 0xFE, 0x02, 0xFD,
-    0x03, 0xFF, 0x07, 0xFC, 0x03, 0xFF, 0x0F, 0xFC, 0x07, 0xFF, 0x2F, 0xF8, 0x0B, 0xFF, 0x7E, 0xF4,
-    0x0F, 0xAF, 0xFE, 0xF0, 0x1F, 0x6F, 0xF7, 0xF0, 0x2F, 0x2F, 0xE7, 0xE0, 0x3F, 0x1F, 0xCF, 0xD0,
-    0x3F, 0x1F, 0x8F, 0xD0, 0xBE, 0x05, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x0F,
-    0x80, 0x0B, 0xC0, 0x0B, 0xD0, 0x03, 0xF0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0xBD, 0x00,
-    0xBE, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFD, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xFE, 0xBF, 0x80, 0xBF, 0x00, 0xFC, 0x0F, 0xC0,
-    0x0F, 0xC2, 0xF4, 0x00, 0xFC, 0x3F, 0x00, 0x2F, 0x83, 0xF8, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0x02,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFD, 0x56, 0xFC, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x03, 0xF0,
-    0x03, 0xF4, 0x07, 0xF0, 0x07, 0xF0, 0x0B, 0xE0, 0x0B, 0xF0, 0x0F, 0xD0, 0x0F, 0xE0, 0x0F, 0xC0,
-    0x0F, 0xD0, 0x1F, 0xC0, 0x1F, 0xC0, 0x2F, 0x80, 0x3F, 0xC0, 0x2A, 0x40, 0x2A, 0x40, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x0F, 0xEF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xD0,
-    0xF0, 0x00, 0x07, 0xFC, 0x02, 0xD0, 0x00, 0x2F, 0xD0, 0x0B, 0x40, 0x00, 0xFF, 0x00, 0x3D, 0x00,
-    0x03, 0xF8, 0x00, 0xF0, 0x00, 0x1F, 0xE0, 0x0B, 0xC0, 0x00, 0xFF, 0xE6, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF0, 0x64, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00,
-    0xBF, 0xFC, 0x03, 0xFF, 0xAC, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0, 0x06, 0xFF, 0x80,
-    0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x7A, 0x7F, 0xAB, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x40, 0x3F, 0x40, 0x1F, 0x80, 0x0B, 0xF0, 0x0F, 0xC0, 0x01, 0xFC, 0x0B, 0xE0, 0x00,
-    0x3F, 0x43, 0xF0, 0x00, 0x0F, 0xE2, 0xF4, 0x00, 0x03, 0xFD, 0xFC, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xBF, 0xF4, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x5F, 0x96, 0xF8, 0x3F, 0x81, 0xF4,
-    0x0F, 0xC7, 0xE0, 0x2F, 0x00, 0xFC, 0xBC, 0x03, 0xF0, 0x1F, 0x8B, 0xC0, 0x7E, 0x03, 0xF4, 0xBD,
-    0x0B, 0xD0, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x6F, 0xFF, 0xF8,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0x40, 0x0F, 0xD0, 0x2F,
-    0x80, 0x02, 0xF8, 0x2F, 0x80, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F,
-    0xAF, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x2A, 0x80, 0x0A, 0xA0, 0x00,
-    0x03, 0xF8, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0x80, 0x7F, 0x00, 0xBD, 0x02, 0xF8, 0x03, 0xF0, 0x0F,
-    0xD0, 0x0F, 0xC0, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x02, 0xF4, 0x07, 0xD0, 0x0F, 0xC0, 0x2F, 0x00,
-    0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x05, 0x01, 0x43, 0x80, 0xE1, 0xC0, 0x74,
-    0xE0, 0x3C, 0x34, 0x1F, 0x1D, 0x1F, 0x87, 0xFF, 0xD0, 0xFF, 0xB0, 0x00, 0x3C, 0x00, 0x0E, 0x00,
-    0x07, 0x80, 0x03, 0xF8, 0x1A, 0x07, 0xF0, 0x3F, 0x43, 0xF0, 0xBD, 0x07, 0xF0, 0x7F, 0x0F, 0xC0,
-    0xBE, 0x0B, 0xE0, 0xFC, 0x0F, 0xD0, 0xFD, 0x1F, 0x80, 0xFC, 0x0F, 0xC2, 0xF4, 0x1F, 0xC1, 0xFC,
-    0x3F, 0x02, 0xF8, 0x2F, 0x43, 0xF0, 0x3F, 0x02, 0xF0, 0x7E, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1A,
-    0x07, 0xF0, 0x3F, 0x43, 0xF0, 0xBD, 0x07, 0xF0, 0x7F, 0x0F, 0xC0, 0xBE, 0x0B, 0xE0, 0xFC, 0x0F,
-    0xD0, 0xFD, 0x1F, 0x80, 0xFC, 0x0F, 0xC2, 0xF4, 0x1F, 0xC1, 0xFC, 0x3F, 0x02, 0xF8, 0x2F, 0x43,
-    0xF0, 0x3F, 0x02, 0xF0, 0x7E, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x2A, 0x40, 0xBF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x74, 0x00,
-    0x02, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xFE, 0x02, 0xE0, 0x7C, 0x0F, 0x42, 0xF0, 0x3D, 0x6F,
-    0x81, 0xFF, 0xFC, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x14, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0xBC, 0x03, 0x80, 0x00, 0x3E, 0x01, 0xD0,
-    0x00, 0x0F, 0x40, 0xF0, 0x00, 0x07, 0xC0, 0x3F, 0xF8, 0x02, 0xF0, 0x1F, 0xFF, 0x80, 0xF8, 0x0B,
-    0x42, 0xF0, 0x7D, 0x03, 0xC0, 0xB8, 0x2F, 0x40, 0xF1, 0xBD, 0x0F, 0xC0, 0x7F, 0xFF, 0x07, 0xF0,
-    0x2F, 0xFE, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3C, 0x00, 0x03, 0xC0,
-    0x00, 0x78, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0xC1, 0xE0, 0x7C, 0x3D, 0x07, 0xC3,
-    0xD6, 0xF8, 0x7F, 0xFF, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x07, 0xFF, 0xE0,
-    0x0B, 0x40, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x6A, 0xBD, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x07, 0xF4, 0x7A, 0xBF, 0xE0, 0xFF, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x7F, 0x80, 0x03, 0xC2, 0xFF, 0xF0, 0x07, 0x8B, 0xF5,
-    0xF4, 0x0B, 0x4F, 0x40, 0x78, 0x0F, 0xBE, 0x00, 0x78, 0x0F, 0xFC, 0x00, 0xB4, 0x1F, 0xFC, 0x00,
-    0xF0, 0x2D, 0xBC, 0x03, 0xF0, 0x3C, 0xBE, 0x5F, 0xD0, 0x38, 0xBF, 0xFF, 0xC0, 0x74, 0x3F, 0xFF,
-    0x00, 0xB0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x01, 0xFE, 0xBE, 0x00,
-    0xF4, 0x0B, 0x80, 0x3C, 0x02, 0xF0, 0x0F, 0x80, 0xBC, 0x03, 0xFA, 0xBF, 0x00, 0x3F, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xF4, 0x0B, 0xD1, 0xFE, 0x03, 0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xF0, 0xFF, 0x43, 0xFC,
-    0x3F, 0xD0, 0xFF, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xFF,
-    0xC0, 0x02, 0xF9, 0x1F, 0x40, 0x2F, 0x95, 0xBE, 0x00, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xE0,
-    0x3F, 0x55, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xE0, 0x0F, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x2F, 0x8B, 0xE0, 0x00,
-    0xFD, 0x3F, 0x40, 0x0B, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFF, 0xF0,
-    0x00, 0xBE, 0x47, 0xD0, 0x0B, 0xE5, 0x6F, 0x80, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xD5, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xB8, 0x03, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0x95, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xEB, 0xF8,
-    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xEB, 0xF0, 0x0B, 0xF4, 0x0B, 0xC0, 0x3F, 0x80, 0x2F, 0x00,
-    0xFC, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xE0, 0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x00, 0xFC, 0x0B, 0xF0,
-    0x0B, 0xF0, 0x3F, 0xC0, 0x3F, 0x81, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xAA, 0xA8, 0x01, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xAA, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x3E, 0x02, 0xF0, 0x3E, 0x00, 0x28, 0x1F, 0xEA,
-    0x80, 0x0B, 0xFF, 0xF0, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x06, 0xA0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFD, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x3F, 0xFF, 0xC0, 0x07, 0xD0, 0x04, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x3E, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xD0, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00,
-    0xBD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF0,
-    0xBC, 0x03, 0xF0, 0xFC, 0x0B, 0xF2, 0xFC, 0x0F, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0xB4, 0x2C, 0x00, 0x00, 0xF0, 0x38, 0x00, 0x00, 0xE0, 0x3E, 0x90,
-    0x01, 0xD0, 0x7F, 0xF8, 0x03, 0xC0, 0xF0, 0x7C, 0x03, 0x80, 0xF0, 0x7C, 0x0B, 0x41, 0xE1, 0xF8,
-    0x1F, 0x02, 0xFF, 0xF0, 0x3E, 0x03, 0xFF, 0x80, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x60, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0xF0, 0x0E, 0x00, 0x07, 0x80, 0x74, 0x00, 0x2F,
-    0xFF, 0xF5, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x80, 0x38, 0x2D, 0x2D, 0x02, 0xD0, 0xB4, 0xF0, 0x0F,
-    0x0B, 0xC3, 0xC0, 0x3F, 0xFE, 0x1E, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0x95, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xEB, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xEB, 0xF0, 0x0B,
-    0xF4, 0x0B, 0xC0, 0x3F, 0x80, 0x2F, 0x00, 0xFC, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xE0, 0x3F, 0x80,
-    0x2F, 0x41, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0xC0, 0x3F, 0xC1, 0xFF, 0x01, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0xE0, 0x00, 0x3F, 0x1F,
-    0x80, 0x00, 0x7D, 0x7E, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xAF, 0xF0,
-    0x00, 0x2F, 0x4F, 0xFC, 0x00, 0x3F, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xFD, 0x01, 0xF8, 0x0F,
-    0xFC, 0x02, 0xF4, 0x2F, 0xFC, 0x03, 0xF0, 0xBF, 0xF8, 0x03, 0xF2, 0xFE, 0xF4, 0x07, 0xEB, 0xF3,
-    0xF0, 0x0B, 0xEF, 0xC3, 0xF0, 0x0F, 0xFF, 0x47, 0xE0, 0x0F, 0xFD, 0x0F, 0xD0, 0x1F, 0xF4, 0x0F,
-    0xC0, 0x2F, 0xE0, 0x1F, 0xC0, 0x2A, 0x80, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x3F, 0x40,
-    0x1F, 0x80, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x00, 0x0F, 0xE2, 0xF4, 0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2B, 0xFF, 0x40, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x06, 0x40, 0x7C, 0x02, 0xE0, 0x3E, 0x00, 0xF4, 0x0F, 0x40, 0x3C, 0x07, 0xC0, 0x2F, 0x02, 0xF0,
-    0x0F, 0x80, 0xF8, 0x03, 0xD0, 0x3D, 0x01, 0xF0, 0x1F, 0x00, 0xBC, 0x0B, 0xD5, 0x7E, 0x03, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x25, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x16, 0xFD, 0x54,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0xBF,
-    0x96, 0xF4, 0x0F, 0xE0, 0x0F, 0x40, 0xFD, 0x01, 0xF4, 0x0F, 0xE5, 0xBF, 0x00, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1A, 0xFE, 0xA8, 0x03,
-    0xFF, 0xFF, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x94, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xF0, 0x0F, 0xF0, 0x0F, 0x40, 0xFD, 0x00, 0xF4, 0x0F, 0xD1, 0xBF, 0x01, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF7, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xBF, 0x40, 0x00, 0x07, 0xF5, 0xFC, 0x7E, 0x00, 0x00, 0x3F, 0x8B, 0xF0,
-    0xFC, 0x00, 0x03, 0xFC, 0x3F, 0x43, 0xF0, 0x00, 0x1F, 0xD0, 0xFC, 0x0F, 0xC0, 0x00, 0xFF, 0x07,
-    0xF0, 0x3F, 0x40, 0x0F, 0xF4, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0x43, 0xF4, 0x00,
-    0x1F, 0xDF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xFB, 0xEB, 0x80, 0x03,
-    0xE3, 0xD3, 0xC0, 0x07, 0xC3, 0xC3, 0xC0, 0x0F, 0x8B, 0xC3, 0xC0, 0x3F, 0x0F, 0x87, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xC0, 0x00,
-    0x03, 0xFF, 0xF0, 0x7F, 0x40, 0x00, 0x3F, 0xFF, 0xD3, 0xFC, 0x00, 0x01, 0xFE, 0x3F, 0xFF, 0xE0,
-    0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x14,
-    0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF9, 0x0B,
-    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x2F,
-    0xE0, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xE5, 0x7F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x00, 0x3F, 0xF0,
-    0xBD, 0x00, 0x0B, 0xFF, 0x8F, 0xC0, 0x01, 0xFC, 0xFF, 0xF8, 0x00, 0x1F, 0x83, 0xFF, 0x00, 0x03,
-    0xFF, 0x96, 0x40, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xEB, 0xF8, 0x00, 0x0F, 0xF0, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0x3F, 0x81,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xBF, 0x00, 0x00, 0x3F, 0xE8, 0x2F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xBF,
-    0x40, 0x0B, 0xF4, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x01, 0xFF,
-    0x02, 0xFE, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x03, 0xFD,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFF, 0x2F, 0x00, 0x0B, 0xE4, 0xBC, 0x00, 0x7C, 0x01, 0xF4, 0x03, 0xE0, 0x07,
-    0xD0, 0x3F, 0x00, 0x1F, 0x82, 0xF4, 0x00, 0x7E, 0x1F, 0xC0, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC3, 0xFF, 0xF8, 0xBF, 0xFF, 0x40, 0x03,
-    0xF0, 0x00, 0x3E, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFE, 0xAA, 0xA0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x01, 0x7F, 0xD5, 0x55, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x2A, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x02, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x03, 0xD0,
-    0x00, 0x3F, 0xFF, 0xF0, 0x2F, 0xEA, 0x90, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x03, 0xF9, 0x55, 0x50, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFB, 0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x0F, 0xD0, 0x07, 0xE0, 0x07, 0xF0, 0x01,
-    0xF4, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0x03, 0xFF, 0x40, 0x1F, 0xC1,
-    0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x0B, 0xFF,
-    0xD0, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xE9, 0x00, 0x3F, 0xFE, 0x00, 0xF8, 0x3C, 0x07, 0xC0,
-    0xF0, 0x2D, 0x07, 0xC0, 0xF0, 0xFD, 0x03, 0xC7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
-    0xFF, 0xF0, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x7F, 0xC3, 0xFF,
-    0xD2, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xD7, 0xFF, 0x8F,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0xBF, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xDB, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x87,
-    0xFC, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xE0, 0xBF, 0xC2, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x0F, 0xF8,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x2F, 0x4B, 0xFC, 0x3F, 0x00, 0x03, 0xE3, 0xFE, 0x2F, 0x00, 0x00, 0xFC, 0xFF, 0x6F,
-    0x40, 0x00, 0x1F, 0x7F, 0xDF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x00, 0x2F, 0xEF, 0xEF, 0xE0, 0x00, 0x7F, 0xC7, 0xE3, 0xFE, 0x00, 0xBF, 0xC2, 0xF4, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0x00, 0xBD, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x06, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1A, 0xBD, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x01, 0x40, 0x1F, 0xE0, 0x2F, 0xEF, 0xFD, 0x02, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xF0, 0x01, 0xBF, 0xE4, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x2E, 0xBD, 0x00, 0x00, 0xD0, 0x00, 0x2C, 0x00, 0xFF, 0x80,
-    0x2F, 0xF0, 0x00, 0x0B, 0x80, 0x40, 0xF4, 0x1F, 0xFF, 0x03, 0xFF, 0xE0, 0x1B, 0xFC, 0x00, 0x07,
-    0xC0, 0x00, 0xFF, 0x00, 0x00, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x2F, 0xF0, 0x00, 0x1F, 0xC1, 0xFF, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x03, 0xF4, 0xFF,
-    0x00, 0x00, 0x1F, 0xCF, 0xF4, 0x00, 0x00, 0xFE, 0xBF, 0x40, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0xFE, 0x7F, 0xFC, 0x00, 0x07, 0xF4, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0xF4, 0x50, 0xFF,
-    0x02, 0xFF, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3F, 0x00, 0x2F, 0x2F, 0x00, 0x0F, 0x6F,
-    0x40, 0x07, 0xDF, 0x40, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xF0,
-    0x00, 0x1F, 0xFF, 0x00, 0x0B, 0xEF, 0xE0, 0x03, 0xE3, 0xFE, 0x01, 0xF4, 0x7F, 0xDE, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x40, 0x02, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x3F,
-    0x40, 0x07, 0xFC, 0x00, 0x03, 0xF7, 0xC1, 0xFF, 0x00, 0x00, 0xBE, 0xB8, 0x7F, 0xC0, 0x00, 0x0F,
-    0xDF, 0x8F, 0xF4, 0x00, 0x01, 0xFC, 0xFB, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xF3, 0xFF, 0xFF, 0x00, 0x00,
-    0xFE, 0x3E, 0x3F, 0xF8, 0x00, 0x1F, 0xD1, 0x42, 0xFF, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-    0x3F, 0x80, 0x00, 0x7F, 0xFC, 0x06, 0xA4, 0x00, 0x02, 0xAA, 0x90, 0x00, 0xB4, 0x00, 0xF8, 0x00,
-    0xF0, 0x03, 0xF0, 0x01, 0xF0, 0x0F, 0xC0, 0x02, 0xEE, 0x3F, 0x00, 0x03, 0xDE, 0xFD, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0x7F, 0xFC, 0x00, 0x2F, 0x3C, 0xFF, 0x00, 0x3E,
-    0x00, 0xBF, 0x80, 0x7D, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xF8, 0x2F, 0xE0, 0x00, 0x6F, 0xE1, 0xFF,
-    0x00, 0x03, 0xFF, 0xDF, 0xF0, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF4, 0x00, 0x00,
-    0xFE, 0xBF, 0x40, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0xFC, 0x00, 0x0B, 0xF4,
-    0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0xF4, 0x01, 0xFF, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF2, 0xFC, 0x01, 0xFA, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x3F, 0xF8,
-    0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0xBE, 0x7F,
-    0xF0, 0x3F, 0x8F, 0xFE, 0x1F, 0xD1, 0xFF, 0xD0, 0x0F, 0xFF, 0xF8, 0x2F, 0xE0, 0x7F, 0xFF, 0xC1,
-    0xFF, 0x01, 0x55, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF4, 0x00,
-    0x00, 0xFE, 0xBF, 0x40, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0xFC, 0x00, 0x0B,
-    0xF4, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0xF4, 0x01, 0xFF, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0xF8,
-    0x7E, 0x1A, 0xBD, 0x3E, 0x00, 0x1F, 0x3F, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xBF, 0xC0, 0x07, 0xC7,
-    0xFC, 0x03, 0xF0, 0xFF, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00,
-    0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0xFF,
-    0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00,
-    0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFA, 0xAA, 0xFF, 0x40,
-    0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x02, 0xFF, 0xFC, 0x7F, 0xD0, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x02, 0xF0,
-    0x07, 0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xD0, 0x0F, 0x80, 0x7C, 0x01, 0xF4, 0x0B, 0xC0, 0x2F, 0x00,
-    0xF8, 0x03, 0xF0, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFD, 0x03, 0xF0, 0x1F,
-    0xC0, 0xBE, 0x02, 0xFD, 0x0F, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0,
-    0x02, 0xFE, 0x55, 0x54, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE,
-    0xAA, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xE0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x07,
-    0xFF, 0xF4, 0x0F, 0xC0, 0x2F, 0xAA, 0x80, 0x3E, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x03, 0xD0, 0x00,
-    0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xE0, 0x1F, 0xC0,
-    0x00, 0x3F, 0x40, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFF, 0xFF, 0xD0, 0x01, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xBF, 0xC0, 0x3F, 0x80, 0x1F, 0xFC, 0x03,
-    0xF4, 0x0F, 0xD0, 0x0B, 0xFD, 0x00, 0xBD, 0x07, 0xF4, 0x03, 0xFF, 0x00, 0x2F, 0x41, 0xFC, 0x00,
-    0xFF, 0x80, 0x0F, 0xC0, 0xBF, 0x00, 0x7F, 0xD0, 0x0B, 0xF0, 0x3F, 0x80, 0x2F, 0xF0, 0x3F, 0xF4,
-    0x0F, 0xD0, 0x0F, 0xFC, 0x1F, 0xF8, 0x07, 0xF0, 0x03, 0xFF, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x02, 0xFC, 0x0B, 0xFC, 0x00, 0x03, 0xF8, 0x0B, 0xF8, 0x00, 0x03, 0xF4, 0x0F, 0xF4,
-    0x00, 0x07, 0xF0, 0x1F, 0xF0, 0x00, 0x0B, 0xE0, 0x2F, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0xE0, 0x00,
-    0x1F, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x7F, 0xFF, 0x90, 0x3F, 0x80, 0xBF, 0xFF, 0xF4, 0x15,
-    0x00, 0xFF, 0xFB, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x02,
-    0xF8, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xF0,
-    0x7F, 0xF0, 0x00, 0x0F, 0xE0, 0xBF, 0xD0, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xBF,
-    0x80, 0x02, 0xFF, 0xFA, 0xFF, 0xFC, 0x01, 0xFF, 0x97, 0xFE, 0xBF, 0x40, 0xFF, 0x03, 0xF8, 0x07,
-    0xD0, 0xFF, 0x02, 0xF8, 0x02, 0xF0, 0x7F, 0x00, 0xFC, 0x01, 0xFC, 0x2F, 0x80, 0xBE, 0x00, 0xFD,
-    0x0F, 0xD0, 0x3F, 0x41, 0xFE, 0x03, 0xF4, 0x0F, 0xD1, 0xFF, 0x40, 0xFE, 0x03, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xD0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x2F, 0xD0, 0x07, 0xFE, 0xFF, 0xFD, 0x03, 0xF4, 0x7E, 0x0F,
-    0x43, 0xF0, 0x3D, 0x03, 0xD0, 0xF4, 0x2F, 0x01, 0xF0, 0xBC, 0x0F, 0x41, 0xF4, 0x3F, 0x03, 0xD1,
-    0xF8, 0x0F, 0xC1, 0xFA, 0xFF, 0x43, 0xF8, 0x3F, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFA,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x17, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xAC, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xC2, 0x00, 0x3F, 0xFF, 0xC0, 0x2F, 0xFF, 0xD0, 0x2B, 0xFF,
-    0x80, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x42, 0xAA, 0xBF, 0xAA, 0xA0, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x03, 0xFD, 0xBC, 0x00, 0x00, 0x7F, 0xCF, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x82,
-    0x9B, 0xE6, 0x90, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x50, 0x00, 0x3F, 0x7C, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x0B, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x03, 0xFC, 0x3F,
-    0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0, 0xFF, 0x00, 0x1F,
-    0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x02, 0xF8, 0x3F, 0x40, 0x7F, 0x03, 0xF8, 0x0F, 0xD0, 0x3F, 0x82, 0xFC,
-    0x02, 0xF8, 0x3F, 0x00, 0x2F, 0xCF, 0xE0, 0x02, 0xFD, 0xFC, 0x00, 0x1F, 0xFF, 0x40, 0x01, 0xFF,
-    0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0,
-    0x7F, 0x40, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x1F, 0xD0, 0x03, 0xFC, 0x03,
-    0xF8, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x01, 0xFE, 0x2F, 0xD0, 0x00, 0x1F, 0xF7, 0xF8, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x00, 0x55, 0xBF, 0xD5, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x05,
-    0x40, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x3F,
-    0x83, 0xF8, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x01, 0xFE, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x01, 0x57, 0xFE, 0x55, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x03,
-    0xFC, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0x03,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xAF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF7,
-    0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xD0, 0x00, 0x1F, 0xF8, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x03,
-    0xFF, 0x00, 0x1F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x3F, 0x02, 0xF0,
-    0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x02, 0xF8, 0xFD, 0x00,
-    0x0B, 0xF0, 0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0x8F, 0xFF, 0xFF, 0xC7, 0xD6, 0xAF, 0xFA, 0x92,
-    0xF0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x3E, 0x00, 0x3F, 0x40, 0x1F, 0x40, 0x1F, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x7F,
-    0x00, 0x3F, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x05, 0x40, 0x7F, 0xFF, 0x8F, 0x2F, 0xFF, 0xD7, 0xC0,
-    0x3E, 0x02, 0xD0, 0x0F, 0x40, 0xF0, 0x07, 0xC0, 0x3C, 0x02, 0xF0, 0x1E, 0x00, 0xF8, 0x0B, 0x40,
-    0x3C, 0x03, 0xC0, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0xFE,
-    0x00, 0xBF, 0x03, 0xF0, 0x03, 0xF8, 0x1F, 0xC0, 0x0F, 0xC0, 0x7E, 0x00, 0x7F, 0x02, 0xF0, 0x02,
-    0xF8, 0x0B, 0xC0, 0x0F, 0xD0, 0x3F, 0x01, 0xFF, 0x00, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x6A, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x2A, 0x03, 0xE3, 0xE0, 0x3D, 0x3C, 0x07, 0xC7, 0xC0, 0xBC,
-    0x78, 0x0F, 0x8B, 0x82, 0xF4, 0x7F, 0xFF, 0x02, 0xFB, 0xF0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0xBC, 0x07, 0xC0, 0x0F, 0x80, 0xB8, 0x01, 0xF4, 0x0F, 0x00, 0x2F, 0x01, 0xF2, 0x43,
-    0xF0, 0x2D, 0xBC, 0x7E, 0x03, 0xCF, 0x8F, 0xD0, 0x3E, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xF8, 0x00, 0xBF, 0x8F, 0x40, 0x03, 0xD1, 0xF4, 0x00, 0x7C, 0x2F, 0x00, 0x06, 0x83, 0xF0,
-    0x00, 0x00, 0x7E, 0x00, 0x05, 0x01, 0x43, 0x80, 0xE1, 0xC0, 0x74, 0xE5, 0x2C, 0x37, 0x9F, 0x1E,
-    0xFF, 0xC7, 0xFF, 0xE0, 0xBF, 0xB4, 0x0E, 0x3C, 0x03, 0x4F, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFE, 0xBF, 0x00, 0xFF, 0x00, 0xBC, 0x07, 0xF0, 0x03, 0xF0, 0x2F, 0x80,
-    0x0F, 0x80, 0xFD, 0x00, 0xBE, 0x07, 0xF0, 0x03, 0xF4, 0x2F, 0xC0, 0x1F, 0xC0, 0xFF, 0x00, 0xBF,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xEB, 0xF8, 0x00,
-    0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xEB, 0xF0, 0x0B, 0xF4, 0x0B, 0xC0, 0x3F, 0x80, 0x2F, 0x01, 0xFC,
-    0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xE0, 0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x0B,
-    0xF0, 0x3F, 0xC0, 0x3F, 0xC1, 0xFF, 0x01, 0xBE, 0x00, 0x14, 0x00, 0x00, 0x01, 0x64, 0x00, 0x7F,
-    0x40, 0x00, 0x2F, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFE, 0x43, 0xFE, 0x02,
-    0xF4, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xF8, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0x54, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x06,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x68,
-    0x00, 0x06, 0xF4, 0x1F, 0x40, 0x0F, 0xFF, 0x87, 0xFE, 0x5F, 0xD0, 0xF0, 0x7F, 0xFF, 0xE5, 0xBD,
-    0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFE, 0x95, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x1F, 0xE4, 0x1D, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0x80, 0x14, 0x00, 0x00, 0x01, 0x68, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xFF, 0xC0, 0x3F, 0x80,
-    0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFE, 0x43, 0xFE, 0x02, 0xF4, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xF8,
-    0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x06, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x00, 0x07, 0xC0, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x06, 0xE4, 0x2F, 0x00,
-    0x1F, 0xFF, 0x87, 0xFE, 0x5F, 0xD0, 0xF0, 0x7F, 0xFF, 0xE6, 0xBD, 0x00, 0x6F, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xD0, 0x01, 0xF9, 0x50, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x1D,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xD6, 0xFF, 0x80, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x03, 0xFC, 0x00,
-    0x3F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x02,
-    0xFE, 0x00, 0x3F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xFD, 0x0F,
-    0xF4, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xF8, 0xBF, 0x80,
-    0x00, 0x00, 0x2F, 0xD7, 0xFF, 0x5F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xF7, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xCF,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x87, 0xF8, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0xBF, 0x43, 0xFF,
-    0xF0, 0x01, 0xFF, 0xF8, 0x0F, 0xF0, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x15,
-    0x40, 0x15, 0x01, 0x54, 0x00, 0xBF, 0x83, 0xF8, 0x0F, 0xE0, 0xFF, 0x00, 0x03, 0xFC, 0x2F, 0x80,
-    0xFC, 0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFC, 0x2F, 0x8F, 0xF0, 0x00, 0x00, 0xBF, 0x9F, 0xC3, 0xF7,
-    0xFC, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xCF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xFE, 0xFF, 0xEF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x8F, 0xFC, 0xBF, 0xF4, 0x00, 0x03, 0xFF,
-    0xE0, 0xFF, 0xC3, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x0F, 0xF4, 0x1F, 0xFF, 0x40, 0x00, 0x0F, 0xC1,
-    0xFE, 0x00, 0x0B, 0xD0, 0xFE, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0x01, 0xFC, 0xFF, 0x00, 0x00, 0xBE,
-    0xBF, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xAF, 0xF4, 0x00, 0x3F, 0x40, 0xFF, 0x00,
-    0x1F, 0xC0, 0x1F, 0xD0, 0x0F, 0xF0, 0x03, 0xF4, 0x03, 0xF8, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0xFF,
-    0x00, 0x55, 0x00, 0xBF, 0x40, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0xBC, 0x00, 0xF1, 0xF0, 0x00, 0xF7, 0xD0, 0x02, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00,
-    0x0B, 0xFF, 0x80, 0x0F, 0x4B, 0xD0, 0x1F, 0x03, 0xE0, 0x2F, 0x03, 0xE0, 0x3D, 0x03, 0xD0, 0x00,
-    0x6F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x07, 0xF0,
-    0x3F, 0x80, 0x00, 0xBF, 0x07, 0xF4, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00,
-    0x2F, 0xC0, 0xFD, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x3F,
-    0x80, 0x00, 0xFE, 0x07, 0xF4, 0x00, 0x2F, 0xC0, 0xBF, 0x40, 0x0F, 0xFC, 0x0F, 0xFF, 0x42, 0xFF,
-    0x40, 0xFF, 0xF0, 0x3F, 0xD0, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFE,
-    0x00, 0xBC, 0x3D, 0x00, 0xF8, 0x7C, 0x00, 0xF4, 0xB8, 0x02, 0xF0, 0xF4, 0x03, 0xE1, 0xF0, 0x03,
-    0xC2, 0xF0, 0x0B, 0xC3, 0xE0, 0x2F, 0x43, 0xFC, 0x7F, 0x0B, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B,
-    0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x3F,
-    0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x03, 0xF8, 0x00, 0xFF, 0x00,
-    0x07, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x1F,
-    0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFA, 0xAA, 0xFF, 0x80, 0x2F,
-    0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x02, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0,
-    0x3F, 0x00, 0xBC, 0x03, 0xE0, 0x0F, 0x80, 0x7D, 0x00, 0xF4, 0x0B, 0xC0, 0x2F, 0x00, 0xFC, 0x03,
-    0xF0, 0x1F, 0x80, 0x3F, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC0, 0x7E,
-    0x01, 0xFC, 0x0F, 0xD0, 0x2F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF4,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x3F,
-    0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x03, 0xF8, 0x00, 0xFF, 0x00,
-    0x07, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x1F,
-    0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFA, 0xAA, 0xFF, 0x40, 0x2F,
-    0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x40, 0x3D, 0x02, 0xF0, 0x07, 0xD0, 0x3F, 0x00, 0xBC, 0x03,
-    0xE0, 0x0F, 0xC0, 0x7D, 0x00, 0xF8, 0x0B, 0xD0, 0x2F, 0x40, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0x40, 0xFD, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x3F, 0xC0, 0xFD, 0x00, 0xFE, 0x07, 0xF0, 0x03, 0xF4, 0x2F, 0x80, 0x1F, 0xC0,
-    0xBD, 0x00, 0xBE, 0x03, 0xF0, 0x03, 0xF4, 0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0x01, 0xFF, 0x00, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x01, 0x69, 0xBF, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xE4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x07, 0x41,
-    0xD2, 0xC0, 0xB0, 0xD0, 0x3C, 0x70, 0x2E, 0x2C, 0x1F, 0x4B, 0xFF, 0xC0, 0xFE, 0xF0, 0x00, 0x3C,
-    0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x0F, 0xFF,
-    0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xFC, 0x03, 0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x2F, 0xFF, 0x00, 0x0F,
-    0xFF, 0xC1, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x4F, 0xFF, 0xD0, 0x02, 0xFE, 0xFD, 0xBF, 0xBF, 0x00,
-    0x0F, 0xEB, 0xFF, 0xFB, 0xFC, 0x00, 0x3F, 0x6F, 0xFF, 0xDF, 0xE0, 0x02, 0xFD, 0x7F, 0xFD, 0xBF,
-    0x40, 0x0F, 0xF1, 0xFF, 0xF3, 0xFD, 0x00, 0x3F, 0xC7, 0xFF, 0x5F, 0xF0, 0x01, 0xFE, 0x0F, 0xFC,
-    0xBF, 0xC0, 0x0B, 0xF8, 0x3F, 0xC3, 0xFE, 0x00, 0x3F, 0xD0, 0xFE, 0x1F, 0xF4, 0x01, 0xFF, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x02, 0xFE, 0x07, 0xF8, 0x03, 0xFE,
-    0x0F, 0xF4, 0x03, 0xFF, 0x2F, 0xF0, 0x07, 0xFF, 0x3F, 0xF0, 0x0F, 0xBF, 0xFB, 0xE0, 0x0F, 0xAF,
-    0xF7, 0xE0, 0x1F, 0x6F, 0xEB, 0xD0, 0x2F, 0x1F, 0xCF, 0xC0, 0x3F, 0x1F, 0x5F, 0xC0, 0x7F, 0x05,
-    0x2F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x02, 0xF8,
-    0x03, 0xF4, 0x03, 0xF0, 0x07, 0xF0, 0x0B, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F, 0xC0, 0x2F, 0x80,
-    0x3F, 0x40, 0x3F, 0x40, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x07,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00,
-    0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00,
-    0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x7F,
-    0x80, 0x00, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0xBC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF7, 0xE0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFE, 0xBF, 0xD0, 0x00, 0x2F, 0x00, 0xFC, 0x00,
-    0x07, 0xD0, 0x0F, 0xC0, 0x00, 0xB8, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x02,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00,
-    0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xA8, 0x1A,
-    0x40, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x1F, 0xE3, 0xFD, 0x00, 0x0F, 0xF8,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF7, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xEB, 0xFD, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x07,
-    0xD0, 0x0F, 0xC0, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0xBE, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF9, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0xAA, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xE0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xDF, 0x8B, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xAF, 0xFF,
-    0xD1, 0xF8, 0x02, 0xF0, 0x0F, 0xFD, 0x5A, 0xF0, 0x1F, 0x40, 0x3F, 0xFF, 0xFF, 0xC0, 0xB8, 0x00,
-    0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03, 0xF5, 0x50, 0x00, 0x0F, 0x00, 0x2F, 0xD0, 0x00, 0x40, 0x7F,
-    0xFF, 0xFF, 0xF9, 0xAF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFE, 0x7F, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7E,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xE9, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xF5, 0x55, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B,
-    0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x02, 0xF9, 0x1F, 0x40, 0x02,
-    0xF9, 0x5B, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x3F, 0x55, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xE0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x7D, 0x56, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x15, 0xAA, 0xAB, 0xFE, 0x03, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x0F, 0xF0,
-    0x02, 0xF4, 0x07, 0xFD, 0x00, 0x1F, 0xFB, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x01, 0xBF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xFC, 0x0A, 0x40, 0x6F, 0xC0, 0x00, 0x00, 0xFC, 0x05, 0x5A, 0xAF, 0xC2,
-    0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0x02, 0xF5, 0x4B, 0xD0, 0x1F, 0x47, 0xF8, 0x00, 0xFF, 0xFE,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x01, 0xFC, 0x7F,
-    0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x7D, 0x56, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x15, 0xAA, 0xAB, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x0F, 0xF0, 0x02, 0xF4, 0x07,
-    0xFD, 0x00, 0x1F, 0xFB, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xFC, 0x02, 0x90, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x15, 0x5A, 0xBF, 0x02, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xC0, 0x2F, 0x54, 0xBE, 0x00, 0x7D, 0x1F, 0xF0, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0x90, 0x00, 0x3F, 0x0F, 0xC0, 0x01, 0xFC, 0x7E, 0x00, 0x0F, 0xE3, 0xF8, 0x00,
-    0x7F, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xFE, 0x0B, 0xFC, 0x00,
-    0x00, 0xFF, 0x07, 0xFF, 0xC1, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x7F, 0xFC, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0xCB, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0xF3, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xDF, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xDB, 0xF9, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0x4B, 0xFF, 0x80, 0x00,
-    0x7F, 0xFD, 0x0F, 0xF0, 0x3F, 0xFD, 0x00, 0x2F, 0xFF, 0x41, 0xFF, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x02, 0xA4, 0x06,
-    0xA0, 0x2A, 0x40, 0x0B, 0xF8, 0x3F, 0x80, 0xFD, 0x0F, 0xF0, 0x00, 0x3F, 0xD2, 0xF8, 0x1F, 0xC3,
-    0xFC, 0x00, 0x00, 0xFF, 0x2F, 0xC2, 0xF8, 0xFF, 0x00, 0x00, 0x0B, 0xF9, 0xFC, 0x3F, 0x7F, 0xC0,
-    0x00, 0x00, 0x3F, 0xEF, 0xCB, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0xEF, 0xFE, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0xFF, 0xCB, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0x0F,
-    0xFC, 0x3F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 0x41, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0xBD,
-    0x00, 0x03, 0xF0, 0xFC, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x10, 0x0B, 0xD0,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x1A, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x14, 0x01, 0xFE, 0x00,
-    0x2F, 0xAF, 0xFD, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1B, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xC0, 0x02, 0xFC, 0xBF, 0x00,
-    0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2E, 0xBD, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x04, 0x0F, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x06, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x0A, 0xAB, 0xFC, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x01, 0x5F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0x83, 0xFC, 0x02, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0x02, 0xAA, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x01, 0xFF, 0x00,
-    0x02, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x05, 0xBF, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x07, 0x43, 0xFC, 0x0B, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xFE, 0x00, 0x3F, 0x40, 0x0F, 0xF4, 0x01,
-    0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xF0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0xBF, 0xF8, 0x00, 0xFD, 0x07,
-    0xFF, 0xD0, 0x07, 0xF0, 0x7F, 0xFF, 0x00, 0x2F, 0x83, 0xFB, 0xFC, 0x00, 0xFD, 0x3F, 0xAF, 0xE0,
-    0x07, 0xF2, 0xFC, 0xFF, 0x40, 0x2F, 0xEF, 0xC7, 0xFC, 0x00, 0xFF, 0xFD, 0x2F, 0xF0, 0x03, 0xFF,
-    0xE0, 0xFF, 0x80, 0x1F, 0xFF, 0x07, 0xFD, 0x00, 0xBF, 0xF0, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0xFF,
-    0xC0, 0x1F, 0xF8, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x5A, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x7E, 0x03, 0xFF,
-    0x00, 0x2F, 0x42, 0xFF, 0xC0, 0x0F, 0xC2, 0xFF, 0xE0, 0x03, 0xF2, 0xFE, 0xF4, 0x01, 0xFA, 0xFC,
-    0xFC, 0x00, 0xBE, 0xFC, 0x3F, 0x00, 0x3F, 0xFD, 0x1F, 0x80, 0x0F, 0xFD, 0x0F, 0xD0, 0x07, 0xFD,
-    0x03, 0xF0, 0x02, 0xFE, 0x01, 0xFC, 0x00, 0xAA, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0,
-    0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x7F, 0x9F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x7F, 0x80, 0x0F, 0xD0, 0x03,
-    0xFD, 0x00, 0x7F, 0x00, 0x3F, 0xF0, 0x02, 0xFC, 0x03, 0xFF, 0xC0, 0x0F, 0xE0, 0x2F, 0xFE, 0x00,
-    0x3F, 0x41, 0xFF, 0xF4, 0x01, 0xFC, 0x1F, 0xFF, 0xC0, 0x0B, 0xE0, 0xFE, 0xFF, 0x00, 0x3F, 0x4F,
-    0xEB, 0xF8, 0x01, 0xFC, 0xBF, 0x3F, 0xD0, 0x0B, 0xFB, 0xF1, 0xFF, 0x00, 0x3F, 0xFF, 0x4B, 0xFC,
-    0x00, 0xFF, 0xF8, 0x3F, 0xE0, 0x07, 0xFF, 0xC1, 0xFF, 0x40, 0x2F, 0xFC, 0x0F, 0xFC, 0x00, 0xFF,
-    0xD0, 0x3F, 0xF0, 0x07, 0xFE, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x03, 0xF4,
-    0xFD, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xFD, 0x01, 0xF8, 0x0F, 0xFC, 0x02, 0xF4, 0x2F,
-    0xFC, 0x03, 0xF0, 0xBF, 0xF8, 0x03, 0xF2, 0xFE, 0xF4, 0x07, 0xEB, 0xF3, 0xF0, 0x0B, 0xEF, 0xC3,
-    0xF0, 0x0F, 0xFF, 0x47, 0xE0, 0x0F, 0xFD, 0x0F, 0xD0, 0x1F, 0xF4, 0x0F, 0xC0, 0x2F, 0xE0, 0x1F,
-    0xC0, 0x2A, 0x80, 0x1A, 0x80, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00,
-    0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x0B,
-    0xF4, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x0B, 0xF4,
-    0x00, 0x07, 0xFC, 0x02, 0xFF, 0x90, 0x5F, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x3F, 0x0F,
-    0xC0, 0x02, 0xFC, 0xBF, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0xFF, 0xAF, 0xE0, 0x0B, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0x3F, 0x02, 0xF4, 0x00,
-    0xFC, 0x0F, 0xC0, 0x0B, 0xE0, 0x3F, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF8, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x5F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x82, 0xFF, 0xAA, 0x6F, 0xF4, 0x2F, 0xE0, 0x02, 0xFF, 0x02, 0xFF, 0x96, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xFE, 0xBF, 0x80,
-    0xBF, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC2, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x83, 0xF8, 0x1B,
-    0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x00,
-    0x00, 0x3F, 0x0F, 0x80, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x1F, 0xDB,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x5F, 0xF8, 0x02, 0xFF, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xAA, 0x6F, 0xF4, 0x2F, 0xE0, 0x02, 0xFF, 0x02, 0xFF, 0x96, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x7F, 0x1F, 0xC0, 0x03,
-    0xF8, 0xFE, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0x80, 0x2F, 0xC0, 0x3F, 0x00, 0xFC, 0x00, 0xFC,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0xFE, 0x06, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x7F, 0x1F, 0xC0, 0x3F, 0xCF, 0xE0, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x16, 0x40,
-    0x00, 0x7F, 0xFE, 0x00, 0x2D, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x06, 0xAB,
-    0xD0, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFD, 0x07, 0xAB, 0xFE, 0x03, 0xFF, 0xFE,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xEA, 0xAA, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x90, 0x00, 0xA8, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x3F,
-    0x40, 0xFC, 0x00, 0x03, 0xF8, 0x2F, 0x80, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0x01, 0xFD, 0xBD, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01,
-    0xAF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x5A, 0xA0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x2F,
-    0x80, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x03, 0xF8, 0xBD, 0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2B, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0xBD, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0xFF,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0x7F, 0x00,
-    0x7E, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0xC2, 0xF8, 0x00, 0x02, 0xFC, 0x3F, 0x00, 0x00,
-    0x1F, 0xDF, 0xD0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x1A, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x0F,
-    0xD3, 0xF4, 0x00, 0x0B, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0,
-    0x0F, 0xD0, 0x07, 0xE0, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0xFC,
-    0x00, 0x03, 0xF8, 0xBD, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x69, 0x00, 0x0F, 0xE0,
-    0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x0A, 0x40, 0x00, 0xBF, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0x40, 0xFD, 0x00, 0x00, 0x3F, 0x81, 0xF8, 0x00, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0x00, 0x1F,
-    0xDB, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1A, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x02, 0xA4, 0x00, 0x6A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4,
-    0x00, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x02, 0xF8,
-    0x00, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x8B, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x0F, 0xC0, 0x07, 0xF1, 0xFC, 0x00, 0xBF, 0x2F, 0xC0, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x7C, 0x03, 0xC0, 0x0F, 0xC0, 0xBC, 0x00, 0xF8, 0x0F, 0x40, 0x2F, 0x41, 0xF0,
-    0x03, 0xF0, 0x2D, 0x00, 0x7F, 0x03, 0xC0, 0x0F, 0xE0, 0x3E, 0x1B, 0xFD, 0x03, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0x8F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x7E, 0x00, 0x07, 0xD1, 0xF4, 0x3F, 0x4F, 0xD1, 0xFC, 0x7F, 0x0F, 0xF3, 0xFC,
-    0x00, 0x00, 0x00, 0x38, 0x0F, 0x01, 0xC0, 0x78, 0x0F, 0x02, 0xD0, 0x34, 0x1F, 0x01, 0xD1, 0xFC,
-    0x07, 0xFF, 0xE0, 0x0F, 0xFB, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFD, 0x02, 0xFF, 0xFC, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B,
-    0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40,
-    0x00, 0x0B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xC7, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xF8, 0x00,
-    0x00, 0x0F, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x95, 0x00, 0x01, 0xFC, 0x00, 0xBF,
-    0xFF, 0x40, 0x0F, 0xE0, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0x80, 0x0F, 0x40, 0xBE, 0x01, 0xFD, 0x00,
-    0x7D, 0x01, 0xF8, 0x0B, 0xF0, 0x02, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x0F, 0xC1, 0xBF, 0x01, 0xFE,
-    0x00, 0x7F, 0xFF, 0xF8, 0x0B, 0xF8, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xD0, 0x0F, 0xFF, 0xF4, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x02, 0xF8,
-    0xBE, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x01, 0xF4, 0x01, 0x80, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x03, 0x80,
-    0x00, 0x3E, 0x00, 0xB4, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0xE0, 0x0B, 0xC0,
-    0x1F, 0xFF, 0x80, 0xF8, 0x02, 0xD0, 0xBC, 0x1F, 0x40, 0x3C, 0x0B, 0x82, 0xF4, 0x03, 0xC6, 0xF4,
-    0x3F, 0x00, 0x7F, 0xFF, 0x07, 0xF0, 0x0B, 0xFF, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x02, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF7, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC7,
-    0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF5, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xF0, 0x03, 0xFF, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x02, 0xF0, 0x2F, 0x00, 0x07, 0xD2, 0xF0, 0x00,
-    0x0F, 0xEF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xCF, 0xE0, 0x01, 0xFC, 0x2F, 0xF0, 0x1F, 0xC0, 0x7F,
-    0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFD, 0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x05, 0x55, 0x55, 0x55, 0x52,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x7D, 0x07, 0xD0, 0x02,
-    0xF0, 0x2F, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x3D, 0x03, 0xD0, 0x02, 0xF0, 0x1F, 0x00, 0x0F, 0xC0,
-    0xFC, 0x00, 0x3D, 0x03, 0xD0, 0x01, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x3E, 0x03, 0xE0,
-    0x01, 0xF4, 0x1F, 0x40, 0x0B, 0xC0, 0xBC, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0xF4, 0x0F, 0x40, 0x07,
-    0xC0, 0x7C, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xF4, 0x0F, 0x80, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x01,
-    0x55, 0x55, 0x55, 0x55, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x15, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF0,
-    0x0F, 0xF0, 0x0B, 0xF8, 0x03, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x03, 0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0x40, 0x3F, 0xF0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0xC0, 0x0B,
-    0xF8, 0x3F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x02, 0xFF, 0x0B, 0xF8, 0x00, 0xFF, 0x43, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x03, 0xFF, 0x0F, 0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0x0B,
-    0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0x7F, 0xC0, 0x3F, 0xE0, 0xFF, 0x40, 0x7F, 0xC2, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0x40, 0x3F, 0xF0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F,
-    0xC0, 0x0B, 0xF8, 0x3F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x02, 0xFF, 0x0B, 0xF8, 0x00, 0xFF, 0x43,
-    0xFD, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xF1, 0xFF, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0A,
-    0xBF, 0xEE, 0x00, 0xBF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xAA, 0xAA, 0xA0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x78, 0x03, 0xFD, 0x0F, 0xFD, 0x7F,
-    0xFA, 0xFF, 0x4B, 0x80, 0x00, 0x00, 0x02, 0xA0, 0x1F, 0xC0, 0xFF, 0x07, 0xF8, 0x3F, 0xE0, 0x02,
-    0xA0, 0x1F, 0xC0, 0xFF, 0x07, 0xF8, 0x3F, 0xE0, 0x06, 0x90, 0x0A, 0x40, 0x29, 0x0F, 0xD0, 0x2F,
-    0xC0, 0xFE, 0x1F, 0xD0, 0x3F, 0x80, 0xFE, 0x3F, 0xC0, 0xBF, 0x82, 0xFD, 0x7F, 0xC0, 0xFF, 0x43,
-    0xFD, 0x14, 0x3D, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3D,
-    0x00, 0xFC, 0x00, 0x03, 0xD8, 0x0B, 0xC0, 0x00, 0x1F, 0x60, 0xBD, 0x00, 0x00, 0xA3, 0x47, 0xD0,
-    0x00, 0x02, 0xFC, 0x7E, 0x00, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x01, 0xFC, 0x28, 0x29, 0x00, 0x0F, 0xC2, 0x95, 0x98, 0x00, 0xFC, 0x0E, 0xDE, 0xD0,
-    0x0F, 0xD0, 0x3B, 0x3B, 0x00, 0xFE, 0x00, 0xB4, 0xB4, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF0,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x01, 0xFF, 0x0B, 0xFC, 0x02,
-    0xFE, 0x0F, 0xF4, 0x03, 0xFC, 0x0F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F,
-    0xD0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x02, 0xD0, 0x74, 0x2F, 0x43, 0xF0, 0xFC, 0x3F,
-    0x07, 0xD0, 0xF8, 0x3E, 0x0B, 0xC1, 0xF0, 0x7C, 0x0F, 0x42, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x3F, 0x01, 0xF4, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x07, 0x47, 0xE3,
-    0xF0, 0xFC, 0xBC, 0x1F, 0x0F, 0x43, 0xD2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x07,
-    0x80, 0xB0, 0x3E, 0x0F, 0xC2, 0xF4, 0x3F, 0x0B, 0xC0, 0xF8, 0x1F, 0x43, 0xD0, 0xBC, 0x0B, 0x82,
-    0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x1F, 0x80, 0x00, 0xBF, 0xD0, 0x07,
-    0xFB, 0xF4, 0x2F, 0xD3, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xF0, 0x02, 0xF8, 0x03, 0xF4,
-    0x07, 0xE0, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x2C, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x03, 0x80, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x0B, 0xF0,
-    0x07, 0xF8, 0x03, 0xFC, 0x00, 0xFC, 0x00, 0x2D, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xCB, 0xFC, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xD0,
-    0x00, 0x00, 0x03, 0xFB, 0xFF, 0xFF, 0x00, 0xFD, 0x00, 0x0B, 0xF3, 0xFF, 0xFC, 0x01, 0xFC, 0x00,
-    0x0F, 0xF2, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x1F, 0xE2, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x1A, 0x9B,
-    0xFF, 0xF0, 0x06, 0xA4, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0xFF, 0xF4, 0x0B, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFB, 0xF4, 0x00, 0x2E, 0xFC, 0x3F, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x2F, 0x43, 0xF0, 0x00,
-    0x0F, 0xD1, 0xF8, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0xBE, 0xBF, 0x40,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2A, 0xA8, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54,
-    0x3F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFC, 0x1E, 0x00, 0xB8, 0xBF, 0xFF, 0xD1, 0xFF, 0xFE, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x74, 0x80, 0x00, 0x0F, 0xBB, 0x80, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x15, 0xD6, 0x80, 0x00, 0xB2, 0xD3,
-    0xC9, 0x0D, 0xF7, 0xFF, 0xFC, 0x2F, 0xFF, 0xBF, 0xE0, 0x0B, 0xF8, 0x7F, 0xE4, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x3B, 0xCD, 0x8E, 0x10, 0x03, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x42, 0xF4, 0x7F, 0x80, 0xFD, 0x00, 0x28, 0x00, 0x7E, 0x0A,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x1F,
-    0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x04, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1C, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3E, 0x01, 0xFE, 0x42, 0xF4, 0x00, 0x3E, 0x00, 0xA0, 0x01, 0xF8, 0x00, 0x7D, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x02,
-    0xF4, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x0B, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x02,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF8,
-    0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x2A, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x05, 0x50, 0x00, 0x00,
-    0x01, 0xC2, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFD, 0x07, 0xF0,
-    0x00, 0x01, 0xFB, 0x40, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00,
-    0x02, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xD0, 0x2F, 0xFD, 0x00, 0x00, 0x3F,
-    0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x3F, 0xC0, 0x00, 0x00,
-    0x02, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x3F,
-    0xC0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x86, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x90,
-    0x01, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF1, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0x46, 0xA4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x38, 0xD2, 0xC3, 0x4E, 0xDD, 0x37, 0xB1, 0xD3, 0xC7, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x10,
-    0x02, 0xC0, 0x2F, 0x02, 0xA8, 0x2C, 0xE1, 0xFF, 0xC0, 0x3D, 0x00, 0xF0, 0x00, 0x54, 0x03, 0xFE,
-    0x07, 0x00, 0x0B, 0x40, 0x0F, 0xF4, 0x00, 0x3C, 0x18, 0xB8, 0x3F, 0xF0, 0x2F, 0x80, 0x00, 0x15,
-    0x01, 0xFE, 0x03, 0x40, 0x0A, 0x40, 0x0F, 0xF8, 0x1E, 0x2C, 0x2C, 0x3C, 0x1F, 0xF0, 0x06, 0x40,
-    0x15, 0x51, 0xFF, 0xC0, 0x0F, 0x00, 0x74, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x03, 0x4D, 0x07, 0x1D, 0x03, 0xF8, 0x0E, 0x78, 0x2C, 0x3C, 0x3F, 0xF8,
-    0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x0E, 0x0D, 0x0C, 0x0D, 0x1C, 0x2C, 0x0F, 0xFC, 0x01, 0xB8,
-    0x3A, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF6, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFB, 0xF8, 0x02, 0xFD, 0x03, 0xF0, 0x0F, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x7E,
-    0x02, 0xF8, 0x02, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0x3F, 0x40, 0x7F, 0x02, 0xFC, 0x03, 0xFC, 0x0F,
-    0xF0, 0x0F, 0xE0, 0x7F, 0x80, 0xBF, 0x40, 0x02, 0xE0, 0x0E, 0x34, 0x2D, 0x68, 0x3B, 0xB4, 0x77,
-    0xB4, 0x74, 0xF0, 0x7F, 0xD0, 0x3F, 0x80, 0x04, 0x00, 0x00, 0x50, 0x0F, 0xC0, 0x6E, 0x00, 0x74,
-    0x02, 0xC0, 0x0F, 0x00, 0x78, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xF8, 0x0B, 0xAD, 0x00, 0x0E, 0x00,
-    0x2D, 0x00, 0xB8, 0x03, 0xF0, 0x1F, 0xC0, 0x3F, 0xF4, 0x7F, 0xF0, 0x02, 0xF8, 0x06, 0x5D, 0x00,
-    0x0D, 0x01, 0x6C, 0x03, 0xF4, 0x00, 0x3C, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x20, 0x03,
-    0xC0, 0x3F, 0x03, 0x78, 0x38, 0xE2, 0xFF, 0xC1, 0x7D, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x0B,
-    0x00, 0x0F, 0xE0, 0x05, 0x78, 0x00, 0x78, 0x2F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x03,
-    0xE5, 0x0B, 0x00, 0x0F, 0xF4, 0x1F, 0x7C, 0x2C, 0x2C, 0x3C, 0x3C, 0x2F, 0xF0, 0x06, 0x40, 0x00,
-    0x01, 0xFF, 0xC1, 0x5F, 0x00, 0x74, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x0B, 0x80, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0xE2, 0xC0, 0x70, 0xF0, 0x1E, 0xB4, 0x03, 0xF8, 0x03, 0x8B, 0x02, 0xC2,
-    0xC0, 0xBF, 0xE0, 0x0A, 0x90, 0x00, 0x01, 0xFC, 0x01, 0xD7, 0x80, 0xD0, 0xA0, 0x30, 0x38, 0x0E,
-    0xBD, 0x01, 0xFF, 0x00, 0x03, 0x80, 0xFF, 0xC0, 0x16, 0x40, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x02, 0xB8, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xE8, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x2D, 0x00, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0x00,
-    0xF4, 0xF0, 0x00, 0x00, 0x01, 0xF2, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x3D, 0x00,
-    0x00, 0xFF, 0xFC, 0x7C, 0x00, 0x03, 0xFE, 0xB8, 0xF4, 0x00, 0x07, 0xFC, 0xF1, 0xF0, 0x00, 0x0F,
-    0xFA, 0xE3, 0xD0, 0x00, 0x0F, 0xF7, 0xC7, 0xC0, 0x00, 0x1F, 0xFB, 0xCB, 0x80, 0x00, 0x2F, 0xFF,
-    0x4F, 0x00, 0x00, 0x2F, 0xFF, 0x2F, 0xB0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x00, 0x03, 0xC7, 0xC0, 0x00, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00,
-    0x1E, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0xFB, 0xC0, 0x0F, 0xF4, 0x1F, 0xFC, 0x01, 0xFF, 0x02, 0xF9, 0x40, 0x2F, 0xF0, 0x3E, 0x00, 0x02,
-    0xFF, 0xD7, 0xD7, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x0F, 0xE0, 0x7F,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x01, 0x6F, 0x95,
-    0x50, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0x01,
-    0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x2F, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0x40,
-    0x00, 0x07, 0xFF, 0xD0, 0x7F, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0xBF, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xC7, 0xF7, 0xF8, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0x83, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x01, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0A, 0xAA, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x7F, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2A, 0xFF, 0xAA, 0xBF, 0xA4, 0x00, 0xBE, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x07,
-    0xFE, 0x90, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xD5, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x1F, 0xF4, 0x07, 0xD6,
-    0xFC, 0x00, 0x1F, 0xFE, 0x02, 0xFF, 0xFE, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xC0,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBE, 0x00, 0x2F, 0xD3, 0xF0, 0x00, 0x0F, 0xF8, 0x0F, 0xE0, 0xBC,
-    0x00, 0x00, 0x6F, 0x43, 0xF4, 0x3F, 0x40, 0x00, 0x03, 0xE1, 0xFD, 0x0F, 0xD0, 0x02, 0xD6, 0xF8,
-    0xBF, 0x07, 0xF4, 0x02, 0xFF, 0xFC, 0x3F, 0xC2, 0xFD, 0x00, 0xFF, 0xFD, 0x05, 0x50, 0x55, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x07, 0x80, 0x03, 0xF0,
-    0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00,
-    0x2E, 0x00, 0x03, 0xE0, 0xB4, 0x3D, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x17, 0xE7, 0xFD, 0xF9, 0x50, 0x03, 0xE7, 0xFD, 0xF0, 0x00, 0x03, 0xEF, 0xFE, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x03,
-    0xFC, 0x7F, 0x80, 0x00, 0x07, 0xFC, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x3F, 0x00, 0x00, 0x07, 0xF0,
-    0x3F, 0x00, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x04, 0x00, 0xFF, 0xFF,
-    0xC0, 0x3E, 0x01, 0xFF, 0x5B, 0xE0, 0x3D, 0x02, 0xF4, 0x02, 0xF0, 0xBC, 0x03, 0xE0, 0x01, 0xE0,
-    0xFC, 0x03, 0xC6, 0x82, 0xE0, 0xF8, 0x07, 0xCB, 0xC3, 0xD1, 0xF0, 0x0F, 0x8F, 0xC3, 0xC2, 0xF0,
-    0x0F, 0x4F, 0x87, 0xC3, 0xE0, 0x1F, 0x0F, 0x40, 0x07, 0xD0, 0x2F, 0x1F, 0x80, 0x0F, 0xC0, 0x3E,
-    0x0F, 0xE0, 0x2F, 0xC0, 0x3D, 0x0F, 0xFF, 0xFF, 0x80, 0x28, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x16, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0B, 0xD7, 0xFC, 0x00, 0x00, 0x3C, 0x0B, 0xE0, 0x00, 0x02, 0xD0,
-    0x2F, 0x40, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x1B, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xF9, 0x05, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x06, 0xBF, 0xFA, 0x80, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x0F, 0xEA, 0xA0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x0A, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x01, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xE1, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0x8F, 0xFB, 0xC0, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x02, 0xAF, 0xF0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x90, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xF8,
-    0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE9, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x90,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xEA, 0xB4, 0x03, 0xFF,
-    0x2F, 0x00, 0x00, 0x2F, 0xF0, 0xFC, 0x00, 0x00, 0xFF, 0x03, 0xE0, 0x00, 0x0B, 0xF8, 0x1F, 0x40,
-    0x00, 0x3F, 0xD0, 0xBD, 0x40, 0x00, 0xFF, 0x02, 0xFF, 0xFF, 0x47, 0xFC, 0x0F, 0xFF, 0xFD, 0x2F,
-    0xE0, 0x3E, 0xBF, 0xF4, 0xBF, 0xC1, 0xF0, 0xBF, 0x42, 0xFF, 0xDB, 0xDB, 0xF8, 0x07, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x05, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x55, 0x55, 0x55, 0x55, 0x50,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xC0, 0x01, 0xC0,
-    0x00, 0x00, 0x3F, 0xE1, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0xFF, 0xFC, 0x03,
-    0xFF, 0xEC, 0x0B, 0xFF, 0x80, 0x0F, 0xCF, 0x40, 0x2F, 0x9F, 0x00, 0x3F, 0x6F, 0x00, 0x3F, 0x3E,
-    0x00, 0x3F, 0xBF, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0xF4, 0x00,
-    0x01, 0xA0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x01, 0x5F, 0xE5, 0x40, 0x00, 0x3D, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xD5, 0x02, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x66, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x04, 0x00, 0x1F, 0x9F, 0x80, 0x02, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00,
-    0xBF, 0xF9, 0x50, 0x0F, 0xFF, 0xBD, 0x00, 0x9F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF5, 0x42, 0xFF, 0xE0,
-    0x7D, 0x3F, 0xF8, 0x2F, 0xC2, 0x5F, 0x6F, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xF9, 0x00, 0x03,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xCF, 0xC0, 0x0B, 0xEF, 0xCF, 0xC0, 0x0F, 0xCF, 0x8F, 0x80, 0x0F, 0x9F,
-    0x5F, 0x40, 0x1F, 0x2F, 0x2F, 0x00, 0x2F, 0x2F, 0x3F, 0x00, 0x3F, 0x3E, 0x3E, 0x00, 0x3E, 0x3D,
-    0x7D, 0x00, 0x7D, 0x7C, 0xFC, 0x00, 0xBD, 0xBC, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xAA, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xFE, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F,
-    0xE0, 0x1F, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFA, 0x40, 0x00, 0x15, 0x5F, 0xF9,
-    0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x01, 0xB8,
-    0x0B, 0xC6, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x43, 0xFF, 0xFE, 0x40, 0x3F, 0xF9, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x34,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x81, 0xFE, 0x7D, 0x7F,
-    0x8F, 0xD2, 0xF0, 0xBC, 0x18, 0x0F, 0xC0, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x79, 0x00,
-    0xBD, 0x01, 0xFF, 0xE4, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x01, 0xBF,
-    0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x03, 0x41,
-    0xF4, 0x14, 0x2F, 0x83, 0xE1, 0xF8, 0x3F, 0xDF, 0xCF, 0xF0, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x24, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x2F, 0x00, 0x01, 0xF0, 0x06, 0x90, 0x0F, 0x40, 0x03, 0xD6, 0xFF, 0xFF, 0x97, 0xC0, 0x0F,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xF0, 0x1F, 0xFE, 0x40, 0x01, 0xBF, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x03,
-    0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xBC, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x0F, 0xDF, 0x7F, 0x0F, 0xC7, 0xC7, 0xC0, 0x42, 0xE0, 0x40,
-    0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xB8, 0x00, 0x2D, 0x1F, 0x0E,
-    0x0B, 0xE7, 0xCB, 0xD0, 0x7F, 0xFF, 0xE0, 0x02, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x16, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x90, 0x0F,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x80, 0x03, 0xF0, 0xBF, 0xD0, 0x0F, 0xC0,
-    0x7F, 0xF4, 0x3F, 0x40, 0x1F, 0xE0, 0xB8, 0x00, 0x0A, 0x00, 0x03, 0x94, 0x00, 0x00, 0x3F, 0xFF,
-    0x94, 0x02, 0xBF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xBE, 0x02,
-    0xFF, 0x87, 0xE1, 0xFF, 0x80, 0xBE, 0x3F, 0xD0, 0x0B, 0xD0, 0xD0, 0x00, 0x7D, 0x05, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x7C, 0x07, 0xD0, 0xB8, 0x03, 0xF0, 0xF4, 0x02,
-    0xF4, 0xF0, 0x00, 0xFD, 0xF0, 0x00, 0xBF, 0xE0, 0x10, 0x3F, 0xD0, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF,
-    0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x16, 0x40, 0x00, 0x01, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x2E,
-    0x02, 0xF0, 0x7C, 0x0F, 0x80, 0xF0, 0xBC, 0x03, 0xD3, 0xF0, 0x0B, 0xAF, 0x40, 0x1F, 0xFC, 0x00,
-    0x3F, 0xD0, 0x00, 0xFF, 0xFF, 0x42, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x0A, 0x40, 0x00, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x0B, 0x5C, 0x00, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x7F, 0xE7, 0xFE,
-    0x00, 0x1F, 0xFD, 0xBF, 0xF4, 0x0B, 0xFB, 0xCF, 0xAF, 0xC3, 0xFC, 0x7C, 0xF4, 0xFE, 0x3E, 0x0F,
-    0x9F, 0x07, 0xC1, 0x80, 0xF2, 0xF0, 0x10, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x02, 0xE3, 0xD0, 0x00,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0x03, 0xCB, 0xC0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x0B, 0x8F,
-    0x00, 0x00, 0x00, 0x64, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x00, 0x7C, 0xF8, 0x00,
-    0x00, 0x03, 0xCB, 0xC0, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0x0F,
-    0x3E, 0x00, 0x02, 0xC0, 0xF6, 0xF0, 0x30, 0x3F, 0x4B, 0x9F, 0x0B, 0xD1, 0xFD, 0x7C, 0xF5, 0xFD,
-    0x07, 0xFF, 0xCB, 0xFF, 0x80, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x00, 0xBF,
-    0x3F, 0x40, 0x00, 0x01, 0xF2, 0xE0, 0x00, 0x00, 0x03, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x90, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x00,
-    0x2F, 0x00, 0x3D, 0x00, 0x00, 0x02, 0x40, 0x05, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x03, 0xFF, 0xE4, 0x00, 0x3F, 0xBF, 0xFD, 0x03, 0xF9, 0xFF, 0xF0, 0x3F, 0xE7, 0x86,
-    0x03, 0xFF, 0x9E, 0x00, 0x0B, 0xFE, 0x78, 0x00, 0x00, 0xB9, 0xE0, 0x00, 0x02, 0xE7, 0x80, 0x00,
-    0x0B, 0x9E, 0x00, 0x00, 0x2E, 0x78, 0x00, 0x05, 0xB9, 0xE0, 0x00, 0xFF, 0xE7, 0x80, 0x03, 0xFF,
-    0x9E, 0x00, 0x02, 0xFE, 0x78, 0xB4, 0x02, 0xFD, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1A, 0x43, 0xF0, 0x00, 0xBF, 0xFD, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0x43, 0xFE, 0x00, 0x3F, 0x40, 0x7F, 0x40, 0x1F, 0xC0, 0x1F, 0xC0,
-    0x0B, 0xE0, 0x0B, 0xD0, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0x6F, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFE, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0x00, 0x02, 0xFD, 0x03,
-    0xFE, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x8B, 0xF0, 0x00, 0x7F, 0x03, 0xF8, 0x2F, 0xC0, 0x03, 0xFC,
-    0x3F, 0x80, 0xFF, 0x00, 0x0F, 0xD3, 0xF8, 0x03, 0xF8, 0x00, 0x7F, 0xBF, 0x40, 0x2F, 0xD0, 0x02,
-    0xFF, 0xF4, 0x01, 0xFF, 0x00, 0x0B, 0xFF, 0x81, 0x7F, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x03, 0xF0, 0x7F, 0xFE, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x7F, 0x4B,
-    0xF0, 0x00, 0x1F, 0xE0, 0x7F, 0x40, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x2F,
-    0xE0, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x03, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x6F, 0xFA, 0xFF, 0x90, 0x03, 0xF0, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xD0, 0x00,
-    0xBE, 0x03, 0xF0, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x07, 0xF0, 0x3F, 0x00,
-    0x02, 0xF8, 0x0F, 0xC0, 0x00, 0xFD, 0x07, 0xE0, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0xFC,
-    0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xA8, 0x0A, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xFD, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0xFC, 0x00,
-    0x07, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x0B, 0xE0, 0x3F,
-    0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x02, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x7F, 0xAA, 0xA4, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0x2F, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x10, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xC3, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x81, 0xFD, 0x00, 0x2F, 0xFF, 0xAF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xD0, 0x3F, 0x91, 0xF0, 0xBD, 0x00, 0x78, 0x03, 0xC3, 0xF0, 0x02, 0xC0, 0x2F, 0x0F, 0x80, 0x2F,
-    0x96, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFA, 0xFF, 0xE0,
-    0x01, 0xBE, 0x42, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x45, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x61,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x0F, 0xE0, 0x0B, 0xF8, 0x03, 0xFD, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x02, 0x80, 0x3F, 0xFD, 0x1F, 0x82, 0xF8, 0xFD, 0xFC, 0x0F, 0xD1, 0xFF,
-    0xE0, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xA0, 0x1F, 0xFF, 0x0F, 0xC0,
-    0xFC, 0x7D, 0xBE, 0x07, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x06, 0xAB,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x06, 0xBF, 0xFF, 0xAA, 0x90, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00,
-    0xA5, 0x00, 0x01, 0x90, 0x00, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x05,
-    0x6B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x01, 0xBF, 0xFC, 0x00, 0x01, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x02,
-    0xFF, 0xFE, 0x40, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x03, 0x90, 0x00, 0x16, 0x00, 0x00, 0x56,
-    0xBF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xE9, 0x50, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x00,
+static const uint8_t opendyslexic_10_bolditalicBitmaps[28345] = {
+    0x65, 0x55, 0xC1, 0x8B, 0xDF, 0x44, 0x14, 0xFE, 0x26, 0x43, 0x37, 0x60, 0x60, 0xC7, 0x43, 0x0B,
+    0x4A, 0x0B, 0x01, 0xF1, 0x60, 0x4B, 0x31, 0x7F, 0x41, 0x3B, 0xA1, 0xC5, 0x53, 0x0F, 0x55, 0xE8,
+    0x7A, 0xF5, 0x5E, 0x04, 0xCF, 0x42, 0x6D, 0x46, 0x7B, 0xF0, 0xE8, 0x5E, 0x7A, 0xF7, 0x22, 0x2C,
+    0x95, 0xE2, 0xD5, 0xC3, 0xD2, 0x44, 0xF7, 0xE8, 0x25, 0xB2, 0x37, 0x7B, 0xC9, 0x41, 0x51, 0xDC,
+    0x83, 0x03, 0x1B, 0x68, 0x56, 0x27, 0x19, 0xBF, 0x37, 0xF9, 0x2D, 0xBB, 0x6C, 0xC3, 0x26, 0x9B,
+    0x5F, 0xE6, 0xCD, 0x7B, 0xDF, 0xFB, 0xDE, 0xF7, 0xDE, 0x00, 0xBC, 0x2E, 0x03, 0x37, 0x81, 0xDB,
+    0xC0, 0x17, 0x40, 0x00, 0x26, 0x64, 0x23, 0xB4, 0x97, 0xBF, 0x62, 0x80, 0xE9, 0x51, 0x76, 0xA8,
+    0x1C, 0xAA, 0x1A, 0x05, 0xA0, 0x70, 0xFE, 0xCA, 0xF6, 0x50, 0x4C, 0x30, 0x13, 0xCA, 0x11, 0x76,
+    0x44, 0xE3, 0xE5, 0xA3, 0x09, 0xD6, 0xB7, 0x3F, 0xC7, 0x3C, 0x94, 0xDE, 0x76, 0x51, 0xCF, 0xC6,
+    0x57, 0x43, 0xFC, 0x32, 0x16, 0x74, 0x9D, 0x79, 0x7A, 0x61, 0x28, 0x2D, 0x86, 0x45, 0xFF, 0x58,
+    0xCC, 0x03, 0x23, 0x00, 0xA5, 0xE3, 0x72, 0x11, 0x79, 0x05, 0xC8, 0x33, 0xA2, 0x92, 0xE7, 0x00,
+    0xCC, 0x86, 0x0F, 0x54, 0x1D, 0xD7, 0xA1, 0xA7, 0xAA, 0xE3, 0xBF, 0x46, 0x8F, 0x0C, 0x23, 0xEB,
+    0x63, 0xB6, 0x1A, 0x5B, 0x79, 0xF6, 0xD0, 0x61, 0x5D, 0xBF, 0x3B, 0x09, 0x0E, 0xDF, 0x30, 0x98,
+    0x5A, 0x0A, 0x8F, 0x8B, 0x57, 0x29, 0x8F, 0x7D, 0x71, 0x38, 0x48, 0xD4, 0xDF, 0xA1, 0x63, 0xEC,
+    0xE8, 0x64, 0xE6, 0xCB, 0x7D, 0x87, 0x72, 0xB8, 0x05, 0xB4, 0x8A, 0x14, 0xC4, 0x7B, 0x9D, 0xA0,
+    0x4A, 0xD1, 0x6A, 0xE4, 0xF2, 0x40, 0xC3, 0x9F, 0x20, 0xCC, 0x5D, 0x1D, 0xBD, 0x39, 0xF9, 0x84,
+    0xA9, 0x11, 0xB4, 0xA0, 0xA9, 0xB7, 0xDA, 0x28, 0xB9, 0x70, 0x33, 0x54, 0xCA, 0x50, 0xC0, 0x5C,
+    0x59, 0x43, 0x3E, 0x90, 0x8F, 0x23, 0xB9, 0xCE, 0x7B, 0x15, 0x6B, 0xE3, 0xF2, 0x03, 0x67, 0x61,
+    0x34, 0xD3, 0xDA, 0xD6, 0x4F, 0x3C, 0xB6, 0xCD, 0xBD, 0x9E, 0x41, 0x84, 0xE4, 0x40, 0x5A, 0xD4,
+    0x47, 0xD3, 0x0B, 0xA2, 0x3B, 0x3E, 0x72, 0x30, 0xBF, 0x3C, 0x21, 0xB4, 0xFB, 0xBA, 0x23, 0x13,
+    0x85, 0xCB, 0x26, 0x13, 0x59, 0x16, 0x92, 0x59, 0x76, 0xEA, 0xC3, 0x8D, 0x73, 0xD6, 0x00, 0xE5,
+    0x11, 0xF7, 0xD7, 0x8F, 0x50, 0x38, 0x03, 0xDD, 0x33, 0xF2, 0x7E, 0xC9, 0x0F, 0xED, 0x80, 0x8C,
+    0x98, 0xB2, 0xE8, 0x78, 0x7B, 0xF3, 0x55, 0xB0, 0xF9, 0x30, 0xEB, 0x57, 0xDE, 0x3A, 0x3B, 0x96,
+    0x4B, 0x3B, 0x69, 0x21, 0xAF, 0x89, 0xFF, 0xD5, 0x5B, 0xCB, 0x6E, 0xBD, 0x21, 0x27, 0x1E, 0x2C,
+    0xC5, 0x94, 0x6A, 0x77, 0x67, 0x61, 0xC9, 0xF8, 0xD9, 0x72, 0xF7, 0x24, 0x35, 0x80, 0x62, 0x15,
+    0xA4, 0x5E, 0x5C, 0x10, 0x5A, 0x6D, 0x9D, 0x16, 0x0C, 0xF3, 0x14, 0xB8, 0xAC, 0x4A, 0x79, 0xF6,
+    0x2A, 0x5F, 0x2D, 0xD2, 0x96, 0xDC, 0xAF, 0x2B, 0xCD, 0xE6, 0xE7, 0xB8, 0x7A, 0xA1, 0x5F, 0x90,
+    0x4C, 0x35, 0x33, 0xCC, 0x8F, 0xC0, 0x5B, 0xAB, 0x53, 0x29, 0xE1, 0x22, 0xB5, 0x5E, 0xF7, 0xB4,
+    0xEB, 0xEB, 0x69, 0x0C, 0x31, 0x70, 0x49, 0xA7, 0xE2, 0xE1, 0xF1, 0xEA, 0xDB, 0xAE, 0x11, 0x09,
+    0x47, 0x4C, 0xE9, 0xF6, 0xF4, 0x17, 0xFF, 0x51, 0x04, 0xE2, 0x95, 0x71, 0x4A, 0x92, 0xF1, 0xD7,
+    0xAA, 0x5B, 0x7E, 0x98, 0xDE, 0x7D, 0xFF, 0xD6, 0x23, 0x8A, 0x2C, 0x63, 0xD5, 0xCB, 0x99, 0x24,
+    0x8C, 0x76, 0x09, 0xA6, 0xBA, 0x26, 0x91, 0xB2, 0x95, 0x0B, 0xBE, 0x19, 0xAA, 0xA1, 0x46, 0x45,
+    0x6D, 0x2C, 0x4D, 0x9C, 0x1F, 0xC6, 0x3D, 0x91, 0x4D, 0x80, 0x9A, 0xA0, 0xBE, 0x4D, 0x64, 0x75,
+    0x76, 0x28, 0xBD, 0x19, 0xF3, 0xA0, 0xE7, 0x6C, 0xC1, 0x95, 0x9D, 0x1D, 0x5A, 0x52, 0x48, 0x5B,
+    0xBB, 0x73, 0x79, 0x18, 0x9A, 0xEE, 0x9C, 0xE8, 0x3E, 0x3D, 0x8D, 0xBC, 0xCA, 0x6E, 0x23, 0x0F,
+    0x2A, 0x5F, 0x9E, 0x36, 0x99, 0xA4, 0x86, 0x90, 0xDC, 0x20, 0x3D, 0x88, 0x35, 0x5D, 0xE9, 0x94,
+    0x0D, 0x1A, 0xA4, 0xAC, 0x2E, 0x18, 0x4E, 0xE7, 0x0C, 0x87, 0x8B, 0x86, 0x4D, 0x32, 0x9C, 0xE5,
+    0xA1, 0x92, 0xB9, 0x1E, 0x2F, 0x1A, 0x56, 0xEE, 0xCC, 0x70, 0x79, 0xCD, 0x70, 0x6D, 0xE9, 0x64,
+    0xF2, 0x5E, 0x32, 0x79, 0x73, 0xD3, 0xFA, 0x34, 0x2D, 0xA5, 0x69, 0xEE, 0x7A, 0x84, 0xCC, 0x67,
+    0xD3, 0x1D, 0xAF, 0x8F, 0x8F, 0x7D, 0xFE, 0xEA, 0xD8, 0x17, 0x47, 0x7F, 0x7A, 0xF3, 0xF2, 0xE5,
+    0x60, 0x0E, 0xBE, 0xE9, 0xCA, 0xCE, 0x76, 0x6C, 0xFF, 0x9A, 0x44, 0xD3, 0x7C, 0xA6, 0xC4, 0x27,
+    0x36, 0xD4, 0x00, 0xF5, 0x42, 0xE0, 0x3D, 0x47, 0x31, 0xA3, 0x0A, 0xB0, 0x13, 0xDE, 0x49, 0x33,
+    0x27, 0x3F, 0x3F, 0x73, 0xE8, 0xDC, 0x5D, 0x6A, 0x9F, 0x72, 0x5B, 0x15, 0x83, 0x65, 0xC7, 0x6D,
+    0xB1, 0xFD, 0x6C, 0xF4, 0xBC, 0x27, 0x7C, 0x9E, 0x05, 0xD4, 0x82, 0x54, 0xF2, 0x17, 0x41, 0xB1,
+    0xBA, 0x68, 0x3B, 0xF6, 0x28, 0x53, 0x67, 0x81, 0x68, 0x96, 0xC7, 0x3F, 0x6A, 0xF6, 0xA5, 0x2B,
+    0xD9, 0x9A, 0x56, 0x5A, 0x57, 0xB1, 0x09, 0x89, 0xA1, 0xE0, 0x7D, 0x1D, 0x61, 0x2D, 0x06, 0x53,
+    0xA3, 0x17, 0xC3, 0x26, 0x69, 0x66, 0x64, 0x6D, 0xD8, 0x68, 0xB7, 0xDF, 0xFE, 0x20, 0xA2, 0x8D,
+    0x81, 0x0D, 0xD2, 0x57, 0xA2, 0x90, 0x28, 0x14, 0x64, 0x43, 0xE2, 0xD2, 0x52, 0x17, 0x01, 0xFA,
+    0x1F, 0x87, 0x93, 0x09, 0xB7, 0x6D, 0x6D, 0x0E, 0xBC, 0xF6, 0x0D, 0xE7, 0xD6, 0xC2, 0x34, 0x0F,
+    0x65, 0x84, 0x65, 0xAB, 0x55, 0x4E, 0x6C, 0xED, 0xAA, 0xA5, 0x37, 0x9E, 0xED, 0xD1, 0xDF, 0x40,
+    0x7F, 0xB5, 0xB0, 0xB9, 0xBF, 0x96, 0xCC, 0xFC, 0x5D, 0x53, 0x79, 0x1D, 0xA7, 0x58, 0x77, 0x29,
+    0x95, 0x40, 0xA6, 0xA0, 0x2F, 0x9E, 0x46, 0xC7, 0x7C, 0x15, 0x63, 0x1B, 0xC6, 0xBE, 0xBA, 0x88,
+    0x8B, 0x76, 0xE2, 0x48, 0xEC, 0x65, 0x3F, 0x0B, 0xA6, 0xA4, 0x23, 0x7E, 0xDB, 0xE5, 0x5E, 0xF1,
+    0x38, 0x18, 0xCE, 0xC5, 0xC6, 0xD9, 0x2C, 0xA8, 0xC0, 0xD9, 0x30, 0x54, 0xBF, 0x4A, 0x53, 0x4F,
+    0x04, 0xE4, 0xC0, 0x09, 0x70, 0xE3, 0xD9, 0x77, 0xA4, 0xE1, 0x6B, 0x19, 0x71, 0x2C, 0x27, 0xD3,
+    0x23, 0x75, 0x52, 0xE9, 0x36, 0xB5, 0x0A, 0x69, 0x2E, 0x3D, 0xCC, 0x88, 0x9C, 0x29, 0x2D, 0x1C,
+    0x13, 0xE4, 0x88, 0x00, 0xB3, 0x28, 0xC8, 0x5C, 0x3E, 0x5A, 0x2A, 0x69, 0x1F, 0x41, 0xFB, 0xDC,
+    0x57, 0x9D, 0x61, 0x6E, 0x45, 0x74, 0x4A, 0x50, 0xF4, 0x2D, 0x89, 0x0B, 0x66, 0xC8, 0x39, 0x2A,
+    0x5A, 0x17, 0xE3, 0xCC, 0x2C, 0x7A, 0xE9, 0x26, 0xEC, 0x6C, 0x4E, 0x15, 0x5A, 0xB2, 0x56, 0x03,
+    0xE6, 0xDC, 0x53, 0x21, 0x5E, 0xF7, 0x99, 0xCF, 0x3B, 0x3A, 0xEA, 0x72, 0x5F, 0xF4, 0xD5, 0x90,
+    0x27, 0x7B, 0xA2, 0x22, 0x03, 0x94, 0x61, 0xFD, 0xB6, 0x6A, 0xD3, 0x0C, 0xB6, 0x71, 0xC4, 0x67,
+    0x89, 0x6F, 0xD1, 0x65, 0xCD, 0xA8, 0xBE, 0x60, 0x21, 0xCE, 0x4E, 0x1D, 0x1E, 0x11, 0x68, 0x9D,
+    0xED, 0x79, 0xEA, 0x48, 0x46, 0xB6, 0xA3, 0x18, 0x79, 0x08, 0x35, 0xFD, 0xB9, 0x6E, 0x53, 0x3B,
+    0xA8, 0x3C, 0x33, 0xD1, 0x01, 0xD5, 0xA0, 0xA2, 0x24, 0xF8, 0xD0, 0x9D, 0x2E, 0xDE, 0x14, 0xD9,
+    0xB3, 0x96, 0x15, 0x59, 0xA8, 0x98, 0x68, 0xC5, 0x68, 0x72, 0xEB, 0x04, 0x24, 0xEE, 0x32, 0xFB,
+    0x78, 0x02, 0x82, 0xE0, 0xDA, 0x55, 0x12, 0x09, 0xD5, 0x4A, 0xAB, 0x5C, 0xC3, 0xC7, 0xDF, 0x4B,
+    0x51, 0x78, 0xEE, 0x5C, 0x5E, 0x91, 0xFC, 0xC0, 0xF1, 0x11, 0x7F, 0x8A, 0xFF, 0xA6, 0x59, 0x90,
+    0x06, 0x3F, 0xE3, 0x50, 0x78, 0xFD, 0xEA, 0x57, 0x09, 0x1B, 0x39, 0xD3, 0x41, 0x35, 0xD3, 0x47,
+    0x14, 0x8F, 0x87, 0xE2, 0x3A, 0xB2, 0xA4, 0x0D, 0x01, 0x5C, 0x3F, 0x03, 0xFC, 0x40, 0xB6, 0x08,
+    0xB3, 0x43, 0x46, 0xBE, 0xD0, 0xCB, 0x00, 0x90, 0x5B, 0xE4, 0x28, 0x52, 0x91, 0x96, 0x65, 0x57,
+    0xF0, 0xF0, 0x90, 0x71, 0x25, 0xC7, 0x2D, 0x1A, 0xB7, 0xCA, 0x4B, 0x66, 0xE8, 0x66, 0x54, 0x9F,
+    0xBF, 0x64, 0x87, 0x0C, 0xC9, 0xAA, 0x4F, 0x62, 0xC4, 0x0D, 0xF7, 0xDA, 0x41, 0xF8, 0x3F, 0xAD,
+    0x55, 0xB1, 0xAE, 0xDD, 0x44, 0x10, 0x1D, 0x7B, 0x05, 0x96, 0x9E, 0xA5, 0x98, 0x02, 0x21, 0x44,
+    0x90, 0xB6, 0x87, 0xC2, 0x4D, 0xEA, 0xAC, 0x25, 0x5A, 0xA4, 0xA4, 0x49, 0x95, 0x22, 0x9F, 0xF0,
+    0xF8, 0x03, 0x5B, 0xA2, 0xA0, 0x4D, 0xC1, 0x27, 0x50, 0x44, 0x37, 0xC5, 0xA3, 0x07, 0x3D, 0x6F,
+    0x94, 0xE2, 0x15, 0x14, 0x58, 0xA4, 0xA0, 0xA0, 0xC0, 0x45, 0x28, 0x10, 0xCD, 0x12, 0x16, 0xC5,
+    0x79, 0x59, 0x7B, 0x38, 0x67, 0xAF, 0x6F, 0x22, 0x24, 0x4A, 0x2C, 0x5D, 0xCB, 0xB3, 0xB3, 0x3B,
+    0x3B, 0x73, 0xCE, 0x99, 0xB9, 0x22, 0xC7, 0xE7, 0xD3, 0xE7, 0x22, 0x85, 0xEA, 0x20, 0xE5, 0x56,
+    0x2C, 0x52, 0x2E, 0xD2, 0x48, 0x19, 0xA5, 0x98, 0xCA, 0xF0, 0xDD, 0x70, 0x4B, 0xE2, 0xCB, 0xE9,
+    0x86, 0xA4, 0x6F, 0xBF, 0xA8, 0xBA, 0xDB, 0xB7, 0x3E, 0x36, 0xDE, 0x7E, 0x6E, 0xCB, 0xB9, 0x7E,
+    0xA6, 0x4F, 0x43, 0xB9, 0x5C, 0x6A, 0x90, 0x51, 0xAA, 0x49, 0x6C, 0x94, 0xBB, 0x62, 0x54, 0x17,
+    0x11, 0xA7, 0x9B, 0x48, 0xC9, 0x68, 0x52, 0xDC, 0xCB, 0xE1, 0x57, 0xFC, 0xDA, 0x49, 0xA4, 0x82,
+    0x43, 0x74, 0x86, 0x31, 0xC2, 0x78, 0x19, 0xE0, 0x71, 0x30, 0xBE, 0x0C, 0x62, 0x82, 0xEB, 0x64,
+    0x33, 0x51, 0x5A, 0xEF, 0x86, 0x1C, 0x46, 0x55, 0x7D, 0xAB, 0x9A, 0x0C, 0x3F, 0x54, 0x4C, 0xB2,
+    0xB3, 0xB8, 0x67, 0x49, 0xCC, 0x8A, 0x0B, 0x66, 0x69, 0x54, 0xA5, 0xBA, 0x1E, 0xE7, 0x32, 0x49,
+    0x92, 0x4D, 0x9C, 0xB8, 0xCE, 0x76, 0xD6, 0xB7, 0xBE, 0x56, 0x9D, 0x70, 0x66, 0x46, 0x80, 0x4D,
+    0x7A, 0xC4, 0x6B, 0x87, 0x2A, 0x36, 0x53, 0x99, 0xAA, 0xEB, 0xC7, 0x8A, 0xAC, 0x74, 0x60, 0x40,
+    0x87, 0x9F, 0xD5, 0xAD, 0xDB, 0xEB, 0x2F, 0x2E, 0x90, 0x19, 0x0F, 0xF5, 0x9A, 0x04, 0xB7, 0xFA,
+    0x4A, 0xE1, 0x62, 0x05, 0x0E, 0xD9, 0x56, 0x49, 0x8E, 0x46, 0x13, 0x09, 0x13, 0x8B, 0x89, 0xAC,
+    0x70, 0xBA, 0xC9, 0xBD, 0x01, 0xC0, 0x29, 0xF3, 0xE1, 0xE9, 0x8D, 0x30, 0x4E, 0xC4, 0xE0, 0x39,
+    0x5F, 0x88, 0xD2, 0xD3, 0x1E, 0x0F, 0xC0, 0x49, 0x79, 0x7E, 0x13, 0x13, 0x8B, 0x15, 0x2F, 0x24,
+    0x6E, 0xA2, 0xC1, 0x2B, 0x98, 0x45, 0xAA, 0x50, 0x45, 0x69, 0xE6, 0x3A, 0x88, 0x9B, 0x9A, 0xF0,
+    0x01, 0x73, 0xC3, 0xD9, 0x96, 0x81, 0x11, 0x24, 0xF1, 0xC5, 0xE8, 0xD7, 0xB8, 0xFA, 0xEC, 0x42,
+    0x7D, 0x49, 0x80, 0xB0, 0x86, 0x08, 0x58, 0xE9, 0xF1, 0xC3, 0x49, 0x11, 0xA2, 0x6B, 0xB1, 0x3B,
+    0x63, 0xEF, 0x34, 0x8A, 0x79, 0x85, 0x15, 0x40, 0x2D, 0x0D, 0xDD, 0x7A, 0x78, 0x04, 0x77, 0x3E,
+    0x9D, 0x23, 0xA2, 0x48, 0x7C, 0xC8, 0xD9, 0xA8, 0x24, 0xCE, 0xE7, 0xC4, 0x19, 0xC2, 0x31, 0x8C,
+    0xC7, 0x21, 0x5D, 0xE9, 0x60, 0x45, 0x1E, 0x15, 0x3C, 0x04, 0xC4, 0x47, 0x07, 0x2F, 0x43, 0xE6,
+    0x52, 0x70, 0xF7, 0x88, 0x45, 0x87, 0x45, 0x1B, 0x8E, 0x48, 0xDE, 0xCB, 0xDC, 0xCF, 0x32, 0xA2,
+    0x00, 0x80, 0xB2, 0x0A, 0xF2, 0xB8, 0x9B, 0x89, 0x27, 0x94, 0x42, 0xF4, 0x6A, 0x66, 0xED, 0xFC,
+    0xD9, 0xD7, 0xC2, 0xF2, 0xBE, 0x4A, 0xA2, 0x6B, 0x1B, 0x8A, 0xF3, 0x38, 0x7A, 0xB9, 0x2C, 0xF4,
+    0xB7, 0x07, 0x0B, 0x39, 0x9F, 0xEA, 0x1D, 0xD6, 0x45, 0xDE, 0xD5, 0xDF, 0x8F, 0x29, 0x6D, 0xA0,
+    0x13, 0xE0, 0x39, 0x0F, 0xF0, 0x20, 0x93, 0x84, 0xCB, 0x01, 0x1E, 0x84, 0x10, 0xF1, 0xAA, 0x23,
+    0xF2, 0x69, 0x42, 0xB9, 0x22, 0x15, 0x88, 0xA4, 0x9D, 0xAB, 0x53, 0x14, 0xDF, 0x9C, 0x5E, 0x83,
+    0xBD, 0x3E, 0x00, 0x57, 0x50, 0xD6, 0xB9, 0xB9, 0x54, 0xE9, 0x21, 0x15, 0xB0, 0xC9, 0x50, 0x88,
+    0x17, 0x01, 0x65, 0x3D, 0x43, 0xAD, 0x8D, 0x2F, 0x4E, 0x0B, 0x5D, 0x4D, 0xE2, 0xEC, 0x5C, 0x42,
+    0x63, 0x10, 0x91, 0xBC, 0x4D, 0x7F, 0xAF, 0x3F, 0x23, 0x9F, 0xAD, 0xF5, 0x8D, 0x35, 0xEC, 0x56,
+    0x73, 0xB2, 0xCA, 0x7F, 0x5B, 0xE9, 0x64, 0xF5, 0x9D, 0x7C, 0x58, 0xA7, 0xA3, 0xF4, 0x90, 0x2E,
+    0x25, 0x83, 0x65, 0xF6, 0xCF, 0xFE, 0x98, 0xA5, 0x9D, 0xC5, 0x3E, 0x81, 0xE7, 0x12, 0x07, 0x4C,
+    0xC4, 0x87, 0xFD, 0x11, 0xF7, 0x6F, 0x80, 0xDD, 0xBC, 0x46, 0xB3, 0xB5, 0xD4, 0x25, 0x69, 0xAC,
+    0x40, 0x92, 0xB4, 0xB9, 0xC1, 0x56, 0x5A, 0x89, 0xC1, 0xF0, 0xDA, 0xFA, 0x05, 0x19, 0x53, 0x2F,
+    0x5E, 0x63, 0x81, 0x0E, 0xC0, 0xE9, 0x06, 0x4C, 0xC0, 0xD5, 0x7A, 0xC4, 0x17, 0xD2, 0x5A, 0x85,
+    0xCC, 0x0C, 0xD6, 0x8B, 0xB7, 0xEB, 0x48, 0xAE, 0x3E, 0xAE, 0x43, 0x35, 0x3F, 0x41, 0x2B, 0xD0,
+    0xCC, 0x15, 0xF9, 0x80, 0x8C, 0xC1, 0x76, 0x3F, 0xA1, 0x27, 0x8C, 0x0E, 0x35, 0xF0, 0x02, 0x92,
+    0xC0, 0x0A, 0xBD, 0x0A, 0x71, 0x85, 0x96, 0xB4, 0x3D, 0xC1, 0xBE, 0x5E, 0xEF, 0xE8, 0x54, 0x6E,
+    0xEB, 0x38, 0x4A, 0xF3, 0x87, 0xBE, 0x06, 0xA4, 0xE7, 0xFA, 0xEB, 0x5C, 0xAE, 0xFD, 0x3A, 0x76,
+    0xCD, 0x9F, 0xFA, 0x17, 0x98, 0xBC, 0xD2, 0x07, 0xA1, 0xD8, 0x9A, 0x34, 0xFA, 0x7A, 0x71, 0x4F,
+    0x89, 0xF1, 0x66, 0x23, 0x5B, 0x0C, 0x5A, 0x90, 0xAC, 0x6D, 0x52, 0x39, 0xE0, 0xA6, 0x66, 0x92,
+    0x7E, 0x46, 0x9E, 0x2E, 0x71, 0x3C, 0x29, 0x58, 0xAA, 0x74, 0x82, 0x5B, 0x17, 0xBA, 0x47, 0xB8,
+    0xC7, 0x8B, 0x2B, 0xB8, 0x7F, 0x7E, 0x91, 0x80, 0xED, 0xBA, 0x4A, 0x8D, 0x7C, 0xC5, 0x6C, 0x0D,
+    0x95, 0xFD, 0x19, 0x05, 0x39, 0x8D, 0x70, 0x07, 0x9B, 0xC4, 0xA6, 0xAC, 0x47, 0xB1, 0x64, 0x65,
+    0xCC, 0x88, 0x13, 0x7B, 0x1D, 0x80, 0xB5, 0x76, 0x59, 0x56, 0xE8, 0x1A, 0x30, 0xD5, 0x7A, 0x88,
+    0xAE, 0x0E, 0x44, 0x3E, 0xB1, 0xD5, 0x36, 0xB2, 0x3A, 0x76, 0x70, 0xF7, 0xBE, 0x7D, 0xF5, 0x8E,
+    0xCE, 0x54, 0x57, 0xE0, 0x50, 0x89, 0x6C, 0xA8, 0x85, 0x1C, 0x66, 0x4E, 0x1E, 0x9E, 0xF8, 0x3B,
+    0x3B, 0x80, 0xA7, 0xD3, 0x54, 0xB8, 0xA4, 0xAA, 0xA4, 0x85, 0x92, 0x1B, 0x5F, 0xCF, 0x50, 0xA9,
+    0x92, 0x11, 0x90, 0x34, 0xE6, 0x86, 0x04, 0xAA, 0xD7, 0x5D, 0x56, 0x57, 0x6E, 0x2E, 0x76, 0xCA,
+    0xB8, 0x4F, 0x20, 0x1B, 0xDF, 0x28, 0x22, 0x67, 0x5D, 0xB2, 0x25, 0x21, 0x68, 0x14, 0x14, 0xE1,
+    0x1B, 0x07, 0xB3, 0x40, 0xA0, 0x48, 0x12, 0xF3, 0x24, 0x21, 0x82, 0x59, 0x98, 0xF3, 0x02, 0x3E,
+    0xAB, 0x68, 0x27, 0x94, 0x60, 0xA7, 0xF7, 0x9B, 0xD9, 0xCE, 0x6E, 0x3C, 0x4E, 0x96, 0x66, 0xEF,
+    0xAD, 0xC4, 0x06, 0x47, 0x6C, 0x8E, 0x3D, 0xDC, 0x44, 0x54, 0x5A, 0xDD, 0xD3, 0xAE, 0x91, 0x71,
+    0x6E, 0xFF, 0x57, 0xF7, 0x27, 0xF9, 0x5E, 0x20, 0x20, 0xB9, 0x2D, 0x76, 0x68, 0xBB, 0x7A, 0x6A,
+    0xBC, 0xF9, 0xFB, 0x7C, 0x2E, 0x78, 0xFF, 0x08, 0x64, 0xA9, 0x33, 0x1B, 0x5D, 0x57, 0xE3, 0x42,
+    0xB3, 0x9A, 0x85, 0x2A, 0x03, 0x81, 0x98, 0xB2, 0xB3, 0x0B, 0x67, 0xDF, 0x7C, 0xF4, 0x08, 0x11,
+    0x6F, 0x02, 0x93, 0x7D, 0xA0, 0x80, 0xAE, 0xE9, 0x3D, 0xB4, 0xD4, 0xDE, 0x08, 0x50, 0x1B, 0xEA,
+    0x79, 0x4E, 0x95, 0x51, 0x74, 0xA4, 0xE3, 0x9C, 0x5A, 0xB6, 0x39, 0x25, 0x7F, 0xA3, 0xAB, 0xA0,
+    0xAB, 0xC7, 0x79, 0x6C, 0xCF, 0x2D, 0xF1, 0xBD, 0x89, 0xCD, 0x9F, 0x1C, 0x0E, 0x87, 0x3B, 0x9A,
+    0xF5, 0xA8, 0x2F, 0x34, 0x8B, 0x92, 0x83, 0x3A, 0xEE, 0x31, 0x75, 0xEF, 0x34, 0xD4, 0x9E, 0x1B,
+    0xED, 0x3F, 0xA7, 0x55, 0x8D, 0xEB, 0x0C, 0x25, 0x20, 0x79, 0x16, 0x40, 0xD5, 0x3A, 0x60, 0xD4,
+    0xA3, 0xCD, 0x95, 0xFE, 0x11, 0xF5, 0x60, 0x2F, 0x76, 0x34, 0x1C, 0x01, 0x15, 0xF4, 0xEC, 0xD1,
+    0xC7, 0xF8, 0x1F, 0x53, 0xAE, 0xE4, 0xF9, 0x63, 0x27, 0x44, 0xAD, 0x51, 0x30, 0x19, 0x41, 0xD2,
+    0x9C, 0x38, 0x54, 0x42, 0xA0, 0x12, 0x82, 0x64, 0x74, 0x8E, 0x0F, 0xA6, 0xB0, 0xFB, 0x01, 0xCB,
+    0x11, 0x1F, 0x1B, 0x18, 0x72, 0x9E, 0xF1, 0x2B, 0x1E, 0xED, 0xBD, 0x9B, 0xAA, 0x84, 0x31, 0xD0,
+    0xA3, 0xCF, 0xAB, 0x04, 0xBE, 0xDD, 0x2F, 0x99, 0x98, 0x2E, 0x8F, 0x03, 0xC3, 0x7E, 0x76, 0x40,
+    0xCD, 0x30, 0x22, 0x39, 0x32, 0xEA, 0xE5, 0xFF, 0x79, 0xFE, 0x01, 0x7D, 0x55, 0x31, 0x8F, 0xDD,
+    0x44, 0x10, 0x1E, 0x7B, 0x09, 0x2E, 0xB6, 0xD8, 0x86, 0xEA, 0x52, 0xB8, 0xA7, 0xC0, 0x35, 0x12,
+    0x77, 0x6B, 0x2E, 0xC5, 0x95, 0xD0, 0x40, 0x93, 0x96, 0x2A, 0x42, 0xBA, 0x3F, 0xC0, 0x3D, 0x3B,
+    0xB9, 0x1F, 0x90, 0xFB, 0x07, 0xA4, 0x4C, 0x02, 0x42, 0x94, 0x14, 0xF7, 0x9E, 0x97, 0x4B, 0x91,
+    0x12, 0x47, 0x14, 0x69, 0x2D, 0x1D, 0x02, 0x94, 0x2B, 0x6E, 0x01, 0x0B, 0x36, 0xB9, 0xB5, 0x87,
+    0x6F, 0xD6, 0xEF, 0x45, 0x54, 0x58, 0xB2, 0xDF, 0x3E, 0xEF, 0xCE, 0x37, 0xDF, 0xCC, 0x7C, 0x33,
+    0xDE, 0x3B, 0x23, 0xA2, 0xA7, 0x66, 0xC4, 0xB3, 0x39, 0x9D, 0xF0, 0xB4, 0x8E, 0x6B, 0xA2, 0x6A,
+    0xB0, 0x3D, 0x91, 0xF1, 0x66, 0x54, 0x5E, 0x07, 0x35, 0xA9, 0xA8, 0x22, 0xF1, 0x21, 0x1F, 0xCE,
+    0x64, 0x7F, 0xE4, 0x81, 0xB1, 0xC5, 0xB1, 0x6B, 0x8B, 0xC8, 0x6C, 0x5D, 0xC6, 0xCC, 0xD7, 0x03,
+    0x35, 0xFC, 0x13, 0x7B, 0x2A, 0xF9, 0x92, 0x03, 0x69, 0xF6, 0x5D, 0xA4, 0x9C, 0x7D, 0x05, 0xCC,
+    0x2E, 0x68, 0x06, 0x64, 0xCC, 0x04, 0x19, 0x96, 0x54, 0x39, 0x6A, 0x6A, 0xED, 0x49, 0x85, 0x2C,
+    0x8A, 0xC7, 0xA6, 0xA6, 0x7C, 0x2E, 0xC5, 0xE1, 0x3F, 0x01, 0x27, 0x78, 0xC6, 0x43, 0xB3, 0x13,
+    0x36, 0x1E, 0x8F, 0x42, 0xFE, 0x13, 0xCB, 0xD2, 0x0A, 0x84, 0x61, 0x58, 0xA9, 0xB9, 0x83, 0x01,
+    0x3F, 0x9F, 0xE5, 0x10, 0x8E, 0x99, 0x98, 0x73, 0xAB, 0x98, 0xCA, 0x48, 0x1D, 0xD1, 0xDC, 0xD4,
+    0x2A, 0xDA, 0x56, 0x7B, 0xEB, 0xCA, 0x1E, 0x0E, 0xDA, 0xAA, 0xC7, 0xD6, 0x65, 0x24, 0x73, 0x33,
+    0xC2, 0x1E, 0xC7, 0x01, 0xAF, 0x01, 0x26, 0xD8, 0x05, 0xE0, 0x34, 0x1C, 0x4B, 0x16, 0x4A, 0x78,
+    0xA9, 0xFC, 0xCE, 0x31, 0x02, 0x03, 0x55, 0x86, 0x3F, 0x85, 0x65, 0x0D, 0xF7, 0x0B, 0x8B, 0x28,
+    0x71, 0x70, 0x3A, 0x01, 0x96, 0x79, 0x7A, 0xD9, 0xC9, 0x4B, 0x3B, 0xA7, 0x9D, 0x56, 0x76, 0x06,
+    0xD9, 0x91, 0x78, 0x3A, 0x7E, 0xFA, 0x88, 0x2A, 0x00, 0x24, 0x14, 0x2F, 0x28, 0x9C, 0xB0, 0xC5,
+    0x6C, 0xEF, 0x09, 0xAC, 0xA6, 0x05, 0x73, 0x83, 0xFF, 0x52, 0x03, 0x2C, 0x33, 0x18, 0x2A, 0xF0,
+    0x51, 0x38, 0x53, 0x00, 0x49, 0x4B, 0x76, 0xE0, 0xAB, 0x04, 0x74, 0x85, 0x1C, 0x58, 0x29, 0x18,
+    0xEE, 0xF5, 0x72, 0x5C, 0xEE, 0x3C, 0x2C, 0xC7, 0x77, 0x26, 0xE6, 0x3F, 0x26, 0xF6, 0xD5, 0xC2,
+    0xAD, 0x99, 0xB6, 0x44, 0xE5, 0xCA, 0xC9, 0x7D, 0xFF, 0x51, 0x79, 0xF4, 0x62, 0x5C, 0x95, 0xA7,
+    0x3E, 0x5A, 0xF3, 0xCC, 0x4F, 0xF6, 0x93, 0x9F, 0xC3, 0x74, 0x60, 0x14, 0xD5, 0xF7, 0x1E, 0x49,
+    0xE1, 0x60, 0x11, 0xB7, 0xA4, 0x56, 0xB4, 0x78, 0x95, 0xBB, 0x6A, 0x17, 0x68, 0xB9, 0x35, 0x5C,
+    0x15, 0x5B, 0xB7, 0x39, 0x18, 0x67, 0x5B, 0x3A, 0x89, 0xDA, 0xCE, 0x48, 0x28, 0x97, 0x3B, 0xA3,
+    0x7E, 0xE1, 0xB7, 0xE3, 0xFA, 0x0D, 0xBC, 0x48, 0x45, 0x85, 0x97, 0x64, 0x62, 0xE1, 0x36, 0x40,
+    0x1D, 0x92, 0xE3, 0xEA, 0xEB, 0xFE, 0x44, 0x92, 0x01, 0x7B, 0xE6, 0x19, 0xA9, 0x9B, 0xAC, 0xD4,
+    0x43, 0x70, 0x6B, 0xD3, 0x17, 0x63, 0xF6, 0x24, 0x9D, 0xEF, 0x56, 0x48, 0xEB, 0x60, 0xAE, 0xA6,
+    0xDC, 0x1B, 0x77, 0x42, 0x51, 0xB7, 0xC6, 0x79, 0x8A, 0x86, 0xAA, 0xFB, 0xCC, 0xA3, 0x41, 0xF1,
+    0x90, 0xEE, 0x7C, 0x6E, 0x12, 0xC5, 0x98, 0x48, 0x81, 0x0F, 0xB2, 0x9A, 0x83, 0xC1, 0x04, 0x55,
+    0xB3, 0x2F, 0x79, 0xD2, 0x93, 0xBE, 0x88, 0x99, 0x9F, 0xE9, 0xDC, 0xD2, 0x41, 0xE9, 0xEC, 0xD1,
+    0xDC, 0x5D, 0x30, 0x0F, 0x0D, 0x90, 0xB9, 0xA7, 0xF7, 0x16, 0x6A, 0xB7, 0x03, 0xA8, 0x2A, 0xFE,
+    0x16, 0x81, 0x23, 0x1C, 0xA4, 0xC2, 0xD6, 0x02, 0x67, 0x1F, 0x00, 0xC4, 0x95, 0xDC, 0xBF, 0x2B,
+    0xE5, 0x4F, 0x51, 0x4B, 0xB4, 0x12, 0xA9, 0xF8, 0x48, 0x29, 0x59, 0x51, 0xB6, 0x39, 0xAE, 0x73,
+    0xA8, 0x0A, 0xF7, 0x90, 0x87, 0x72, 0xA4, 0x80, 0xC6, 0x3A, 0x27, 0xA6, 0x03, 0xB4, 0x84, 0x71,
+    0x8D, 0x53, 0x22, 0x0B, 0x86, 0x6E, 0x4A, 0x69, 0x03, 0x3E, 0xAE, 0x93, 0x36, 0xD1, 0x4F, 0xF9,
+    0xEB, 0xB2, 0xDE, 0x7C, 0x1E, 0x10, 0xCA, 0x03, 0x6C, 0xDB, 0xCF, 0x52, 0xEE, 0xEC, 0xAB, 0xEF,
+    0x60, 0xD0, 0x4B, 0x47, 0x54, 0xAF, 0xE1, 0x68, 0x26, 0x33, 0x51, 0xF5, 0xBB, 0x78, 0x3F, 0x81,
+    0xC4, 0xD0, 0x78, 0x1E, 0x6A, 0x87, 0x32, 0x90, 0x4C, 0xC8, 0x09, 0x75, 0x42, 0xDB, 0x99, 0x81,
+    0xD0, 0x6C, 0x68, 0x42, 0x0B, 0x7E, 0xD9, 0xC6, 0x8A, 0x2C, 0x9D, 0x7A, 0x03, 0x42, 0x1E, 0x84,
+    0x46, 0x10, 0xFA, 0x81, 0x66, 0xDA, 0x17, 0x42, 0x38, 0xA2, 0x86, 0x63, 0x21, 0x34, 0x22, 0xBA,
+    0x28, 0xAA, 0x25, 0x3A, 0x4E, 0x4D, 0xE8, 0xE8, 0x0C, 0x28, 0x4D, 0xD2, 0xB3, 0xB4, 0x3D, 0xE2,
+    0xBC, 0x25, 0xFD, 0x2D, 0x4A, 0xB5, 0x4B, 0xBC, 0xDB, 0xA5, 0x28, 0x42, 0x5F, 0x05, 0x9C, 0x0B,
+    0x19, 0x5F, 0x79, 0x3D, 0x6A, 0x67, 0xDB, 0x0A, 0x6F, 0xA3, 0xF6, 0xC5, 0x80, 0xE5, 0xC7, 0x93,
+    0x2C, 0xA5, 0x59, 0x31, 0x5C, 0xB2, 0x4D, 0x52, 0x7E, 0xE9, 0x90, 0x14, 0x50, 0xD9, 0x3B, 0x5B,
+    0xB2, 0xFE, 0x81, 0x20, 0x2A, 0x30, 0xAF, 0x91, 0x2E, 0x84, 0x8E, 0xEA, 0xAD, 0xD3, 0xAF, 0x43,
+    0xBF, 0xE7, 0x49, 0x20, 0x59, 0x2D, 0x51, 0x27, 0xAF, 0x3B, 0x89, 0x2F, 0x5A, 0x3A, 0x4B, 0x42,
+    0xD4, 0x2E, 0xBD, 0x87, 0xA1, 0xD4, 0x03, 0xBC, 0x80, 0x46, 0x5F, 0x2D, 0x55, 0x82, 0x7D, 0xB5,
+    0xA8, 0x51, 0x92, 0xEE, 0x64, 0x8A, 0x60, 0x96, 0xD0, 0x2D, 0x5A, 0x02, 0xC2, 0x86, 0x68, 0x70,
+    0xFD, 0x56, 0x37, 0x8E, 0xD4, 0x9F, 0x31, 0x7B, 0x13, 0xA5, 0x45, 0x6C, 0x90, 0xE3, 0x18, 0x26,
+    0x8A, 0x3D, 0x46, 0x21, 0x75, 0x8D, 0xB7, 0x0F, 0xE7, 0xF2, 0x05, 0x14, 0x63, 0x5A, 0x98, 0x55,
+    0x35, 0xCC, 0x57, 0x02, 0x13, 0x61, 0x0B, 0xFD, 0x59, 0xA9, 0xC3, 0x5A, 0xFC, 0xCA, 0x0B, 0xC5,
+    0xAD, 0x0D, 0x2A, 0x69, 0x06, 0x97, 0xBA, 0x09, 0xA5, 0x8C, 0xD2, 0x1B, 0x6E, 0xF5, 0xDC, 0xC1,
+    0x01, 0xE7, 0x53, 0xD1, 0x57, 0xCE, 0xBA, 0xB5, 0x0A, 0x6A, 0x84, 0x42, 0xEA, 0x4E, 0x92, 0x65,
+    0xF0, 0x6E, 0xCE, 0xA3, 0x0A, 0x50, 0x69, 0xDB, 0xDC, 0x89, 0x05, 0xD2, 0xD7, 0xD4, 0x4C, 0x9C,
+    0x50, 0xB2, 0xBF, 0x27, 0xF4, 0xCE, 0x44, 0xF6, 0x26, 0xE4, 0x93, 0xC2, 0x61, 0xD3, 0x5A, 0x5A,
+    0xE5, 0x21, 0x1F, 0xB1, 0x74, 0xB6, 0x6E, 0x60, 0x19, 0x31, 0xDD, 0x87, 0xA6, 0xED, 0x6A, 0x11,
+    0x34, 0x74, 0x82, 0x81, 0xDA, 0x02, 0xDA, 0x38, 0x73, 0x31, 0x52, 0xB4, 0x54, 0x9D, 0x86, 0xD2,
+    0x5B, 0x9E, 0x45, 0xAD, 0x06, 0xD5, 0xAD, 0x7E, 0x11, 0xE4, 0x4F, 0x91, 0xAF, 0x6B, 0xE9, 0x1F,
+    0xE9, 0x41, 0xEE, 0x3D, 0x86, 0x67, 0x0E, 0x2D, 0xF5, 0xBA, 0x86, 0xEB, 0x7D, 0x91, 0x19, 0x4A,
+    0x32, 0x20, 0x3F, 0xFC, 0xEB, 0x44, 0x49, 0xCB, 0x95, 0x48, 0x46, 0x16, 0xDA, 0x7F, 0x01, 0xBB,
+    0x76, 0x3B, 0x21, 0x8C, 0xF4, 0x04, 0x06, 0xFF, 0xB6, 0x76, 0xE9, 0x3A, 0x7E, 0x08, 0x4F, 0x1D,
+    0x86, 0xB7, 0x28, 0xC4, 0xED, 0xD3, 0x9C, 0x7B, 0x84, 0x5C, 0x97, 0x58, 0x6E, 0x28, 0xE8, 0x51,
+    0x25, 0x2A, 0x33, 0xC4, 0x36, 0xD2, 0xED, 0x97, 0xD7, 0xCB, 0xD0, 0x04, 0x35, 0x8D, 0xA2, 0x7D,
+    0xB8, 0xC5, 0xB0, 0x1D, 0xB2, 0x07, 0x7F, 0xC4, 0x35, 0xFC, 0x88, 0xF2, 0x17, 0xCD, 0x0B, 0x2D,
+    0xB2, 0x08, 0xA3, 0x5F, 0xCE, 0x35, 0xA2, 0x47, 0x57, 0xF4, 0xEF, 0x88, 0x04, 0x14, 0x7A, 0xA7,
+    0x9C, 0x53, 0x6B, 0xA3, 0x2F, 0x0E, 0xEE, 0x46, 0x74, 0xD9, 0x1D, 0x96, 0x56, 0x3E, 0xDB, 0x71,
+    0xFB, 0x52, 0x3A, 0x19, 0x63, 0x0C, 0x25, 0xE7, 0xE7, 0xCC, 0x7B, 0xF3, 0x63, 0x14, 0x31, 0xFD,
+    0x7F, 0x2B, 0x46, 0x99, 0x12, 0x2D, 0xA6, 0x6C, 0xD1, 0x17, 0xC3, 0x39, 0xAD, 0xB5, 0x33, 0x2E,
+    0x66, 0xD1, 0xB4, 0xD5, 0xFD, 0x51, 0x85, 0xAA, 0x6E, 0x0E, 0xBD, 0xF1, 0xF6, 0x37, 0x46, 0x14,
+    0x43, 0x85, 0xE2, 0x74, 0xD7, 0xCE, 0x82, 0xE0, 0x44, 0xE5, 0xB3, 0xB0, 0x94, 0xB4, 0x74, 0x1B,
+    0xB2, 0x47, 0x9E, 0x66, 0x69, 0xC9, 0x90, 0x3E, 0x81, 0x95, 0x0C, 0x46, 0x8F, 0x0F, 0x49, 0x9A,
+    0x31, 0x18, 0xD1, 0xB0, 0x68, 0xB2, 0xDA, 0x16, 0x7E, 0x85, 0xEA, 0x99, 0x3F, 0x62, 0xF1, 0x17,
+    0x37, 0x2D, 0x3E, 0x51, 0x1E, 0xAD, 0x39, 0xCB, 0xB7, 0xCA, 0x15, 0xDC, 0x8D, 0xD4, 0x5C, 0xE2,
+    0x13, 0x13, 0xF1, 0x11, 0x7F, 0x3F, 0x7B, 0x4C, 0xFF, 0x73, 0xFD, 0x0B, 0xC5, 0x55, 0x3D, 0x6F,
+    0xDE, 0x54, 0x18, 0x3D, 0xB6, 0x9B, 0x58, 0xAA, 0x45, 0x2F, 0x43, 0x23, 0x10, 0x6D, 0x6A, 0xE6,
+    0x28, 0xA9, 0x17, 0x24, 0x3A, 0xBC, 0xE9, 0x75, 0xD5, 0x81, 0x8D, 0x66, 0x28, 0x88, 0x1F, 0xC0,
+    0x80, 0x84, 0x80, 0x25, 0x03, 0x43, 0x1A, 0x5F, 0xB5, 0x43, 0x07, 0x06, 0x22, 0xF1, 0x03, 0xCA,
+    0xC0, 0x40, 0xA7, 0x06, 0x89, 0x05, 0x29, 0x89, 0xAF, 0x60, 0x60, 0x60, 0xC0, 0x14, 0xD4, 0xD9,
+    0x4D, 0x18, 0x90, 0xA8, 0xD4, 0x0B, 0xB5, 0xC0, 0x94, 0xEB, 0xF7, 0x72, 0x1E, 0xBB, 0x11, 0xED,
+    0x2F, 0xE8, 0x95, 0xFC, 0x7E, 0x5C, 0x5F, 0x3F, 0x1F, 0xE7, 0x9C, 0xE7, 0x18, 0x85, 0x2D, 0x0C,
+    0x06, 0xD5, 0x42, 0x3D, 0xEA, 0x81, 0x6A, 0x0E, 0x24, 0xC1, 0x00, 0x45, 0x0B, 0xA4, 0x01, 0x88,
+    0x42, 0x07, 0xD4, 0xB5, 0x45, 0x71, 0x34, 0x20, 0xEB, 0x73, 0x97, 0xCC, 0x11, 0x4A, 0x78, 0xE8,
+    0x52, 0x97, 0xB9, 0xC9, 0x9C, 0xB2, 0x91, 0xCF, 0x5A, 0xE8, 0xCB, 0x0E, 0xEA, 0xB0, 0x43, 0x32,
+    0x78, 0x9E, 0x1F, 0x80, 0x3C, 0x48, 0x24, 0x00, 0x63, 0x34, 0x0B, 0x30, 0x05, 0x94, 0x43, 0x5C,
+    0x77, 0x0C, 0xCA, 0x54, 0x35, 0x2F, 0xCD, 0x3D, 0x39, 0xEA, 0x51, 0xF0, 0x7A, 0xE5, 0x0E, 0xB7,
+    0x8A, 0x06, 0x92, 0x20, 0xF5, 0x53, 0x0D, 0xF2, 0x93, 0xD1, 0x54, 0x08, 0x3C, 0x12, 0xA0, 0x03,
+    0x37, 0x22, 0x96, 0xC3, 0x28, 0xF9, 0x63, 0x24, 0x3C, 0xA5, 0x79, 0xC2, 0x01, 0x2C, 0x3C, 0x6F,
+    0xA0, 0x3D, 0x58, 0x20, 0xAA, 0x06, 0xD1, 0x7C, 0x4A, 0x29, 0xA5, 0x58, 0xC4, 0x72, 0xD0, 0xB0,
+    0x20, 0x2B, 0x47, 0xC6, 0x9A, 0x64, 0x29, 0x93, 0x36, 0xB1, 0x43, 0x8F, 0x75, 0x14, 0x50, 0x36,
+    0x69, 0x22, 0x87, 0x3D, 0x5C, 0x44, 0x5E, 0x66, 0x36, 0x69, 0xD1, 0x61, 0x0B, 0x1A, 0xAA, 0x4C,
+    0x59, 0x7E, 0x3A, 0x1F, 0x4B, 0x5E, 0xE4, 0xA3, 0x09, 0x21, 0xA9, 0x80, 0x6C, 0xCA, 0xAA, 0x98,
+    0x2B, 0x34, 0x50, 0x9E, 0x5F, 0x06, 0x7A, 0x63, 0xDC, 0x7F, 0x2A, 0x6B, 0x89, 0xE0, 0x90, 0x4F,
+    0x75, 0x8D, 0x6B, 0xF1, 0xF2, 0xFD, 0xA3, 0xE1, 0xAB, 0x47, 0x7E, 0xF3, 0x3D, 0xDE, 0xED, 0x11,
+    0x2C, 0x61, 0x52, 0x1D, 0x2A, 0x8B, 0xDB, 0x78, 0x7A, 0x95, 0x38, 0x85, 0xB8, 0x93, 0xF8, 0x15,
+    0x22, 0x0F, 0x01, 0x59, 0x80, 0x4F, 0x18, 0xCD, 0xE0, 0x1A, 0x58, 0xB7, 0xB2, 0x98, 0x01, 0x4F,
+    0x7A, 0xC1, 0x06, 0xD0, 0x22, 0x6A, 0x10, 0x5B, 0x9C, 0xE9, 0x51, 0xFB, 0x24, 0x3C, 0xC8, 0x7E,
+    0x2F, 0xD5, 0x0F, 0x28, 0x3E, 0x85, 0x7E, 0x13, 0x7A, 0x19, 0xFA, 0x43, 0x02, 0x68, 0xF2, 0xD0,
+    0x48, 0x17, 0x9B, 0xC0, 0x2E, 0xE0, 0x9E, 0x49, 0x89, 0x45, 0x69, 0x88, 0xF5, 0xAA, 0x7F, 0x6A,
+    0x24, 0xED, 0x42, 0x39, 0xDE, 0x9F, 0x09, 0x52, 0xBC, 0x12, 0xC2, 0x10, 0x75, 0x23, 0x19, 0x26,
+    0x09, 0xEC, 0x99, 0x10, 0x21, 0x22, 0x67, 0x11, 0xDB, 0xCD, 0x82, 0x08, 0x26, 0xEC, 0xC4, 0x81,
+    0x4C, 0x06, 0xA1, 0x49, 0x3A, 0xD8, 0xCD, 0x0C, 0x4F, 0x97, 0x95, 0xEC, 0xD5, 0x36, 0x75, 0xDB,
+    0x28, 0x2E, 0xF5, 0x38, 0xC8, 0x9B, 0x64, 0x24, 0x73, 0xE0, 0x97, 0x4F, 0xEF, 0xDD, 0x32, 0x27,
+    0x70, 0x02, 0xD1, 0x06, 0x16, 0xCA, 0xC2, 0x26, 0x3D, 0xE6, 0x24, 0x2F, 0xEB, 0x6A, 0x83, 0xEA,
+    0x61, 0x4B, 0xCE, 0x98, 0x21, 0x9F, 0x4F, 0x4A, 0x4A, 0x24, 0x70, 0x4D, 0x4D, 0x9E, 0xAC, 0x1F,
+    0x97, 0x23, 0xFD, 0xA8, 0x7E, 0x23, 0xF0, 0xC2, 0x2B, 0x73, 0x2C, 0xDE, 0x69, 0xA7, 0x6A, 0x46,
+    0xC5, 0x4D, 0xEB, 0x24, 0xCE, 0xB3, 0x83, 0x19, 0x3E, 0x26, 0x9D, 0x3B, 0xD3, 0x56, 0x6C, 0x59,
+    0x56, 0xA9, 0x70, 0x0E, 0x6B, 0xE3, 0x8D, 0xE3, 0x55, 0x39, 0x86, 0x22, 0xC2, 0xED, 0x8C, 0xBD,
+    0xBE, 0x38, 0x32, 0x56, 0xB0, 0xCD, 0x3A, 0xB8, 0xA8, 0x8F, 0x1D, 0xBB, 0xA5, 0xFA, 0xEF, 0xB4,
+    0xB1, 0x64, 0xAB, 0x79, 0x2F, 0x1E, 0x58, 0xF5, 0x3E, 0xF2, 0x7B, 0x1E, 0x15, 0x31, 0x2B, 0xE6,
+    0xA2, 0xC4, 0x03, 0xE5, 0x06, 0x75, 0x38, 0x14, 0x47, 0x7E, 0xE5, 0xFA, 0x97, 0x38, 0xA0, 0xB8,
+    0xA3, 0x6E, 0x4D, 0xED, 0x5D, 0xA8, 0x70, 0xFF, 0xE1, 0x95, 0xC4, 0xF6, 0x59, 0x30, 0xD9, 0xAF,
+    0x52, 0xC3, 0x83, 0x53, 0x5B, 0x67, 0x57, 0x5F, 0x9B, 0xE9, 0x3E, 0xFF, 0x7A, 0x4C, 0xFE, 0x32,
+    0x4C, 0xDC, 0x9C, 0x83, 0x4E, 0x5C, 0xE6, 0x2A, 0x99, 0x48, 0xF9, 0xCA, 0xEF, 0xCF, 0x51, 0xDC,
+    0x1D, 0x38, 0x5E, 0x1D, 0x66, 0xC4, 0x7F, 0x63, 0x01, 0xFA, 0xF6, 0x06, 0x5B, 0x15, 0x44, 0xD3,
+    0x5E, 0xA4, 0x48, 0x3D, 0x88, 0xFE, 0xB1, 0xF4, 0xD6, 0x55, 0xEE, 0xD7, 0x32, 0x47, 0x25, 0x93,
+    0xD4, 0x57, 0x92, 0x3F, 0x97, 0xCF, 0xFB, 0xCD, 0x83, 0xCF, 0xBE, 0xFD, 0x8B, 0x30, 0x37, 0x31,
+    0x51, 0x94, 0xEE, 0x74, 0x10, 0x64, 0x16, 0x88, 0x66, 0x93, 0x06, 0xA7, 0x7E, 0xEA, 0xF2, 0x4B,
+    0x5D, 0x71, 0xD3, 0x15, 0xA1, 0x55, 0xC1, 0xC8, 0xA8, 0x61, 0xBA, 0xCD, 0x81, 0xA0, 0x3C, 0x79,
+    0x6D, 0xF3, 0xE8, 0x48, 0x69, 0x3F, 0x72, 0x4D, 0x45, 0x4A, 0x4A, 0xC4, 0x3B, 0xFF, 0xAB, 0x66,
+    0xE9, 0x9D, 0x71, 0x86, 0xA5, 0x26, 0x59, 0x69, 0x77, 0x72, 0x0B, 0xAB, 0xD8, 0x8C, 0xDB, 0xDC,
+    0x68, 0xB7, 0xB2, 0x93, 0x76, 0x0B, 0xAB, 0x58, 0x4D, 0x5D, 0xB4, 0x8B, 0x5D, 0xED, 0xB4, 0x89,
+    0x9C, 0x2A, 0xF7, 0x32, 0xBB, 0x24, 0x33, 0x42, 0x0B, 0x69, 0x32, 0xCE, 0x20, 0x43, 0x7A, 0x8A,
+    0x7C, 0x9B, 0x88, 0x15, 0xA5, 0x36, 0xAA, 0xC9, 0x9B, 0xD4, 0x29, 0x97, 0x84, 0x5B, 0x9E, 0xEC,
+    0xCE, 0xC9, 0x41, 0x28, 0xD7, 0xEB, 0x87, 0x36, 0x1F, 0xA7, 0xF6, 0x38, 0x7D, 0x3C, 0xE7, 0xAC,
+    0xFA, 0x6B, 0xA8, 0xFC, 0x1E, 0x42, 0xCF, 0x22, 0x1D, 0xE7, 0xE9, 0x8F, 0x0E, 0xF5, 0xA1, 0x83,
+    0xFE, 0x4E, 0xAE, 0x16, 0xD5, 0x1B, 0x0D, 0x42, 0x66, 0xA3, 0xC0, 0xF9, 0x1E, 0x94, 0x49, 0x3C,
+    0x87, 0xDB, 0x73, 0xDA, 0x3B, 0x8D, 0xC2, 0x5D, 0xA4, 0x05, 0xAD, 0x13, 0x3F, 0x6D, 0xE7, 0x59,
+    0xBF, 0x62, 0x62, 0x73, 0x0E, 0x43, 0xBA, 0x17, 0xB9, 0x70, 0x83, 0x2E, 0xD5, 0xAE, 0x47, 0x76,
+    0x35, 0x31, 0x9B, 0xFA, 0xF0, 0x76, 0xDC, 0xAB, 0x0F, 0xCE, 0x2E, 0xAF, 0xCE, 0x8A, 0x5E, 0xB5,
+    0x93, 0x84, 0xCA, 0xD3, 0x48, 0xCD, 0x05, 0x4E, 0x27, 0x6D, 0xB1, 0x3D, 0x60, 0x88, 0x8A, 0x83,
+    0x5F, 0xA3, 0xBA, 0xD9, 0x27, 0x5E, 0x5B, 0x65, 0x3D, 0xD6, 0xE2, 0x06, 0xAF, 0xC6, 0x42, 0xEC,
+    0x13, 0x3D, 0x9E, 0x4E, 0x44, 0xC9, 0x65, 0x56, 0xCA, 0xE0, 0x10, 0xC2, 0x1E, 0xB9, 0x40, 0x1C,
+    0xB7, 0x32, 0xC8, 0xEB, 0x32, 0xD0, 0x2F, 0xFD, 0x82, 0xFD, 0x85, 0x2C, 0xD8, 0xFC, 0x7A, 0xCB,
+    0xB9, 0x68, 0xF7, 0xF9, 0xA0, 0x97, 0x27, 0x75, 0xB6, 0xC5, 0xB6, 0xEF, 0x7E, 0x6F, 0x49, 0xF8,
+    0x37, 0xE4, 0xE8, 0x20, 0x0F, 0x2D, 0x0A, 0xF3, 0x76, 0x2F, 0xD4, 0x17, 0xE2, 0x0E, 0x8C, 0xB8,
+    0x52, 0x4E, 0x32, 0xC2, 0x64, 0x4D, 0xA3, 0xE1, 0x31, 0xC7, 0xDA, 0x08, 0x18, 0x37, 0x28, 0x18,
+    0x2B, 0x99, 0xCE, 0x83, 0x1E, 0xC7, 0x61, 0xC8, 0x1A, 0xC9, 0x77, 0xED, 0xA3, 0xEB, 0xC1, 0xA5,
+    0x47, 0xE1, 0xC7, 0x60, 0xB7, 0x97, 0x55, 0x29, 0xDC, 0xAE, 0x4B, 0x55, 0x51, 0xF7, 0xC4, 0x69,
+    0x74, 0x49, 0x1B, 0xA3, 0x7A, 0xE8, 0x4F, 0x85, 0xC9, 0x06, 0xF9, 0xA7, 0x03, 0x99, 0x8B, 0xC9,
+    0xF6, 0xD5, 0x89, 0x04, 0xF9, 0xDC, 0x66, 0xCC, 0x77, 0xC5, 0x7B, 0xA8, 0x9B, 0x2D, 0xD0, 0x56,
+    0x83, 0x84, 0xD0, 0x4E, 0xF4, 0xA3, 0x58, 0x41, 0x74, 0x49, 0x38, 0xE6, 0x93, 0xFE, 0x14, 0x1B,
+    0xD4, 0x49, 0xFB, 0xFE, 0x8E, 0xB2, 0x83, 0xE8, 0xE9, 0x75, 0x36, 0xB8, 0xFF, 0x02, 0x4D, 0xA6,
+    0xB8, 0xF1, 0x89, 0x21, 0x98, 0x64, 0x3B, 0xF2, 0x34, 0x29, 0xDA, 0x1E, 0x21, 0xA1, 0x8D, 0x5E,
+    0x44, 0xF4, 0xC5, 0x24, 0xB4, 0x84, 0x0F, 0xC8, 0xD0, 0xA7, 0x14, 0xA1, 0x88, 0x7E, 0x71, 0xE7,
+    0x59, 0xFB, 0x3A, 0x63, 0xC6, 0x37, 0x06, 0xE4, 0xC5, 0xC5, 0xAA, 0x44, 0xCE, 0x85, 0xD8, 0x7D,
+    0x33, 0x3E, 0x29, 0x4F, 0xD0, 0x4D, 0x05, 0x03, 0x69, 0x8C, 0x57, 0xC4, 0xDF, 0x79, 0xA9, 0xFE,
+    0x15, 0x3F, 0xE3, 0x81, 0xFA, 0x38, 0x5C, 0xFC, 0xF9, 0xB1, 0x85, 0xC8, 0x1B, 0x2C, 0xF1, 0x4F,
+    0xE7, 0x18, 0xDD, 0xA5, 0x99, 0x5E, 0x08, 0x20, 0x0D, 0x28, 0x6A, 0xFE, 0xF9, 0x5B, 0x4C, 0x5F,
+    0x4B, 0x0F, 0x8E, 0xB8, 0xD1, 0xA8, 0xE7, 0x1C, 0xCD, 0xC2, 0x6A, 0x31, 0xCA, 0x5E, 0xFC, 0xD0,
+    0xF2, 0xF5, 0x45, 0x4B, 0xE6, 0x8F, 0xC0, 0x80, 0x39, 0xCD, 0xFC, 0x67, 0x3F, 0x56, 0xF5, 0x7C,
+    0xD7, 0x7F, 0xC5, 0x55, 0xB1, 0xAE, 0xD5, 0x46, 0x10, 0x1D, 0x7B, 0x85, 0x2C, 0xC5, 0xC5, 0xA6,
+    0x43, 0xA2, 0xC0, 0x7D, 0x1A, 0xB7, 0x29, 0x22, 0xD6, 0x81, 0x0F, 0x20, 0x7F, 0x40, 0x9D, 0x2A,
+    0x3F, 0x80, 0x62, 0x4B, 0x29, 0xD3, 0xF0, 0x09, 0xA4, 0x83, 0xDB, 0xBC, 0x3F, 0x78, 0x36, 0xA2,
+    0xA0, 0xA0, 0xB9, 0x12, 0x25, 0x05, 0x6E, 0x22, 0x24, 0x9A, 0xAC, 0x14, 0x8B, 0x18, 0xB2, 0xF6,
+    0xE4, 0x9C, 0xB1, 0xEF, 0x7B, 0xF0, 0xF4, 0x28, 0x51, 0x2C, 0xDD, 0xEB, 0xBB, 0xBB, 0xB3, 0x73,
+    0xCE, 0xCC, 0x99, 0x99, 0x2B, 0x22, 0xF2, 0x2D, 0x3E, 0xEE, 0x88, 0xAF, 0x3B, 0xF8, 0xE4, 0x11,
+    0x5F, 0x55, 0x23, 0x5F, 0x7C, 0x3C, 0x2D, 0x7B, 0x18, 0x14, 0x2B, 0x7E, 0x84, 0x19, 0x57, 0xFE,
+    0xC5, 0x9D, 0xEA, 0xCD, 0x20, 0xB2, 0x04, 0x91, 0x72, 0x4C, 0xD8, 0x76, 0x93, 0xB8, 0x19, 0xA6,
+    0xF5, 0x10, 0x3A, 0x51, 0x5D, 0xC5, 0xAB, 0x26, 0xE9, 0x55, 0xA3, 0x53, 0xD5, 0x21, 0x0C, 0xA2,
+    0xD9, 0x2A, 0x6E, 0xF1, 0x51, 0xFC, 0x74, 0xF2, 0xDC, 0x9C, 0x3C, 0x6B, 0x07, 0x17, 0xBF, 0x74,
+    0xE2, 0x62, 0x39, 0xEC, 0x87, 0x01, 0xFB, 0xF9, 0x42, 0x6E, 0x40, 0x14, 0x1D, 0x01, 0xF4, 0x17,
+    0xCE, 0xDA, 0x16, 0xDC, 0x27, 0x20, 0xD6, 0xBF, 0x81, 0x44, 0x02, 0xA2, 0x1F, 0x61, 0xDA, 0x0B,
+    0x9C, 0xAB, 0xCE, 0x12, 0x80, 0x98, 0x13, 0x11, 0xF8, 0x2A, 0x2A, 0x2E, 0x15, 0x33, 0x10, 0x81,
+    0x1F, 0x8E, 0xBB, 0xE7, 0x3C, 0xE2, 0x66, 0xFD, 0x16, 0x90, 0x7F, 0xC3, 0xBF, 0x7B, 0x31, 0x7E,
+    0x1A, 0xED, 0x57, 0x81, 0x75, 0x33, 0xF2, 0x24, 0x4B, 0x0D, 0x47, 0x3D, 0x12, 0x20, 0xE1, 0x05,
+    0x3C, 0xDD, 0xFA, 0xE3, 0xE9, 0x67, 0x79, 0x76, 0x4C, 0x8B, 0x41, 0x67, 0x4C, 0x87, 0x61, 0xCB,
+    0x39, 0x0C, 0x0D, 0x5C, 0xC2, 0xFD, 0x61, 0x47, 0xF7, 0x03, 0x8C, 0x0C, 0xBE, 0x8C, 0x7E, 0xDC,
+    0xF0, 0x99, 0x64, 0x31, 0x02, 0x48, 0xBE, 0x46, 0x63, 0x20, 0x2D, 0x94, 0x68, 0x2E, 0x22, 0x2F,
+    0xE1, 0xD4, 0xD1, 0xFD, 0xAF, 0x64, 0x44, 0xBF, 0xF5, 0x55, 0x99, 0x0D, 0xBD, 0x05, 0xAE, 0x5F,
+    0x77, 0x95, 0x09, 0xED, 0x5F, 0x45, 0xC9, 0x19, 0x01, 0x45, 0x26, 0x6E, 0x9E, 0x9C, 0x45, 0xDC,
+    0x51, 0x63, 0x03, 0xC5, 0x22, 0x21, 0xB0, 0xF0, 0x8C, 0x12, 0x9F, 0x10, 0xF3, 0x43, 0xAF, 0x8C,
+    0x0B, 0x06, 0xDD, 0xF6, 0x42, 0x04, 0xB9, 0x9A, 0xFA, 0x99, 0x26, 0x7B, 0x2D, 0xAB, 0x81, 0xA7,
+    0xDE, 0x0A, 0x70, 0xA9, 0x6D, 0xFB, 0xBC, 0x54, 0x12, 0xE9, 0x71, 0x85, 0x7C, 0xB2, 0x95, 0x87,
+    0xC1, 0xBC, 0xF0, 0x35, 0x6E, 0xAF, 0xF5, 0xD0, 0x49, 0xAD, 0x16, 0x6D, 0x35, 0x3A, 0x56, 0x5B,
+    0x15, 0x19, 0x3C, 0xEB, 0xAB, 0x35, 0xAC, 0x4F, 0x9F, 0xEC, 0xEC, 0x23, 0x52, 0x8A, 0xBB, 0x2D,
+    0x0C, 0x71, 0x6D, 0x28, 0x14, 0x5E, 0xAD, 0xEE, 0xE0, 0xAF, 0x20, 0x2C, 0x17, 0xAC, 0xCD, 0x8C,
+    0xA8, 0xF5, 0x44, 0xAE, 0xC7, 0x9B, 0xB4, 0x8D, 0x99, 0xB9, 0xDD, 0x6E, 0xAF, 0x38, 0x57, 0x84,
+    0xF7, 0xFD, 0x9E, 0xB3, 0xEC, 0x8C, 0xD6, 0x23, 0x45, 0xBE, 0x00, 0xFB, 0x59, 0xF6, 0xA5, 0x27,
+    0xD7, 0xB6, 0xBB, 0xD2, 0x51, 0x87, 0x8D, 0x42, 0xE7, 0xC8, 0x9D, 0x05, 0x57, 0xB0, 0x07, 0xFB,
+    0xDD, 0x3E, 0x23, 0xF7, 0x7A, 0xD3, 0xB4, 0x91, 0xF0, 0x08, 0xCA, 0xF1, 0x98, 0xA4, 0xFC, 0xC7,
+    0x43, 0x97, 0xE9, 0x1E, 0x80, 0x85, 0x7C, 0x0A, 0x94, 0xAD, 0x94, 0x13, 0xEC, 0x21, 0x17, 0x00,
+    0xCC, 0x7E, 0xFA, 0x52, 0x3F, 0x7F, 0x73, 0xA6, 0x43, 0xBE, 0xD7, 0xEC, 0x56, 0x74, 0x2C, 0x2F,
+    0xC3, 0xA0, 0x18, 0x15, 0xBC, 0xE6, 0xCC, 0x75, 0x80, 0x52, 0xEE, 0xC3, 0x89, 0x98, 0x51, 0x38,
+    0x3C, 0xC1, 0xB1, 0xDD, 0x4E, 0xBC, 0x8D, 0x1C, 0x6E, 0x32, 0xE2, 0x29, 0x86, 0x9D, 0x63, 0x0D,
+    0xE9, 0x8A, 0xF7, 0x08, 0x3E, 0xB9, 0xF8, 0x35, 0x41, 0xC3, 0xBD, 0x28, 0x59, 0x42, 0x4B, 0xF9,
+    0x08, 0xD8, 0xF6, 0xE5, 0x2C, 0xD9, 0xD3, 0xEF, 0x1E, 0x5D, 0x13, 0x2B, 0x86, 0x90, 0x35, 0x69,
+    0xDC, 0x26, 0x19, 0x71, 0xF3, 0x74, 0xA1, 0x0D, 0xB6, 0x0D, 0xD8, 0xB3, 0xE4, 0x98, 0xEC, 0xED,
+    0x8C, 0xC8, 0xE1, 0xDD, 0x41, 0x2C, 0xDB, 0xA5, 0xE9, 0x04, 0x68, 0xAB, 0x03, 0x1C, 0x80, 0xF0,
+    0x51, 0xCA, 0x49, 0xB2, 0x27, 0x97, 0x50, 0x35, 0xC8, 0xA3, 0xF0, 0x3B, 0x0A, 0x0A, 0x8C, 0x73,
+    0x54, 0x33, 0x72, 0x00, 0x8A, 0xAC, 0x04, 0x44, 0x5C, 0x4C, 0x0C, 0xD7, 0xB3, 0x58, 0x59, 0x2E,
+    0x81, 0xA3, 0x92, 0x75, 0x69, 0xA3, 0xD8, 0x8D, 0x9C, 0xC3, 0xD9, 0x74, 0xAD, 0x60, 0x70, 0x05,
+    0xCF, 0xEC, 0xF4, 0x89, 0xEE, 0x6C, 0xDD, 0x60, 0x0A, 0xB0, 0x6C, 0x58, 0x65, 0xC0, 0x69, 0x1B,
+    0xB1, 0x4C, 0x08, 0xA6, 0x4E, 0x8E, 0x84, 0x6A, 0xB3, 0x79, 0xFF, 0x41, 0x6C, 0x7F, 0x11, 0xFF,
+    0x7A, 0x2C, 0x8F, 0xAD, 0x7C, 0x46, 0xD7, 0x5F, 0x5E, 0xDF, 0xD6, 0xE0, 0x11, 0x0D, 0x61, 0x35,
+    0x04, 0xC6, 0x18, 0x39, 0x29, 0x30, 0xB8, 0xA5, 0xEF, 0x48, 0xD9, 0x04, 0xBB, 0x75, 0xF7, 0xB1,
+    0x2C, 0xD5, 0x50, 0x4C, 0x2A, 0xE1, 0x79, 0xCA, 0xB4, 0x1E, 0xAF, 0x61, 0xCC, 0x01, 0xC3, 0x0C,
+    0xC3, 0x0F, 0x3D, 0x96, 0xDB, 0x4F, 0x24, 0xC4, 0x8A, 0x1D, 0x69, 0x22, 0x2E, 0x72, 0x62, 0x3C,
+    0x91, 0x54, 0x10, 0xB7, 0x2E, 0x02, 0x73, 0x53, 0x00, 0x82, 0x7C, 0xB0, 0xA1, 0x31, 0x51, 0x03,
+    0xEC, 0xF6, 0x07, 0x8A, 0x30, 0x60, 0x82, 0xC1, 0x6D, 0x68, 0x70, 0xD5, 0x1F, 0x61, 0xE9, 0x26,
+    0x36, 0x74, 0x42, 0x43, 0x48, 0x7B, 0xA3, 0xFD, 0xB3, 0x09, 0x9D, 0x37, 0xB3, 0x74, 0x63, 0x6B,
+    0xDB, 0x89, 0xFF, 0x41, 0x56, 0x76, 0x89, 0x1D, 0x3C, 0xE3, 0xBF, 0x46, 0x1F, 0x5F, 0x32, 0xBD,
+    0x73, 0x9B, 0x7A, 0xBE, 0x66, 0xE7, 0x23, 0xC7, 0x52, 0xFC, 0x7E, 0xBC, 0x32, 0x36, 0x12, 0x47,
+    0xC2, 0xB9, 0xB8, 0x15, 0x98, 0x98, 0xCB, 0x15, 0xE6, 0x6B, 0x44, 0x30, 0x21, 0x41, 0x8C, 0x4A,
+    0x7F, 0xA4, 0xD3, 0x91, 0xC7, 0x09, 0x63, 0x71, 0xED, 0x79, 0xFC, 0xE0, 0x25, 0x08, 0x3C, 0xFF,
+    0x67, 0x92, 0x3A, 0x12, 0x73, 0x0E, 0x2A, 0xC5, 0xE2, 0xB5, 0xCB, 0xF5, 0x2E, 0xA7, 0xF3, 0xD0,
+    0x46, 0x69, 0x63, 0x35, 0xCB, 0xFF, 0xF3, 0xFC, 0x07, 0xBD, 0x55, 0xBD, 0x6E, 0xD5, 0x30, 0x14,
+    0x3E, 0x71, 0x24, 0x22, 0x91, 0xC1, 0x4B, 0x11, 0x12, 0x4B, 0x1E, 0x21, 0x2B, 0x03, 0xD4, 0xE1,
+    0x09, 0x60, 0x67, 0x80, 0x11, 0x78, 0x06, 0xDA, 0x98, 0x85, 0xF9, 0x3E, 0x01, 0x13, 0x0B, 0x13,
+    0x2B, 0x43, 0xA9, 0x2D, 0x31, 0xB2, 0x78, 0x41, 0xAC, 0x96, 0xE8, 0xC6, 0x80, 0x91, 0x32, 0x04,
+    0xF0, 0x8D, 0xF9, 0x8E, 0x73, 0x7B, 0x7F, 0x68, 0x29, 0xA8, 0x43, 0x3D, 0x9C, 0x38, 0xF6, 0xB1,
+    0xCF, 0x77, 0xBE, 0xF3, 0x63, 0xA2, 0xEB, 0x9A, 0x88, 0xC4, 0x08, 0x41, 0xCA, 0x42, 0x94, 0x91,
+    0xB6, 0x47, 0x91, 0x1C, 0x51, 0x9D, 0x12, 0x91, 0x4C, 0x29, 0x90, 0x1C, 0xC5, 0x44, 0x72, 0x80,
+    0x6A, 0x3D, 0x50, 0x1D, 0xCA, 0x91, 0x44, 0x2C, 0x70, 0xC2, 0x50, 0xE2, 0xF3, 0xAA, 0x23, 0xE9,
+    0x1B, 0x47, 0xF5, 0x80, 0xED, 0x2A, 0x8A, 0xB4, 0x78, 0x34, 0x91, 0x49, 0x38, 0xDE, 0x42, 0x74,
+    0x25, 0x84, 0xA6, 0x9E, 0x85, 0x48, 0x3F, 0xB6, 0xAC, 0x94, 0x8E, 0x41, 0x04, 0xB6, 0xC7, 0x82,
+    0x32, 0x9C, 0x3D, 0xFA, 0xCB, 0xA8, 0x52, 0x47, 0xB8, 0x10, 0x66, 0x55, 0x4A, 0x96, 0x94, 0xAF,
+    0x47, 0x52, 0x0E, 0x08, 0x5A, 0x47, 0xAD, 0x95, 0x1E, 0xC0, 0xAA, 0x00, 0x60, 0xEC, 0x4A, 0xA2,
+    0x25, 0xD4, 0x74, 0xDF, 0x61, 0x13, 0xDB, 0x4D, 0xA8, 0xA7, 0x7B, 0xFD, 0x28, 0x00, 0x24, 0x32,
+    0xB0, 0x25, 0xBB, 0x35, 0xC1, 0x4B, 0x08, 0xB8, 0x79, 0xB2, 0x6B, 0x68, 0x86, 0xB5, 0xCC, 0x34,
+    0x78, 0xC8, 0xE5, 0x31, 0x44, 0xCC, 0x38, 0xF3, 0xE8, 0x07, 0x6C, 0x33, 0x84, 0x92, 0xAF, 0x2B,
+    0xE1, 0xAA, 0x2E, 0x71, 0x63, 0xC0, 0x11, 0x11, 0x69, 0x62, 0x5A, 0x7A, 0x20, 0xB5, 0x20, 0x56,
+    0x06, 0xE9, 0xA8, 0x1C, 0xAB, 0x01, 0xF7, 0x61, 0xBB, 0x48, 0x64, 0x4E, 0x6E, 0x26, 0xCD, 0xB4,
+    0x58, 0xD0, 0x0B, 0x96, 0x21, 0x3C, 0x35, 0x2C, 0xC8, 0x4C, 0xDD, 0x1F, 0x2E, 0x1F, 0xDD, 0x86,
+    0x30, 0xAF, 0x20, 0xEE, 0xB0, 0xF3, 0xB2, 0xD1, 0x3B, 0xDB, 0x57, 0x01, 0x44, 0x3A, 0xD0, 0x59,
+    0x0D, 0x06, 0x96, 0x22, 0x67, 0x4A, 0x6A, 0xA0, 0xF0, 0xEC, 0xE5, 0xEB, 0x2B, 0x06, 0x22, 0x62,
+    0xAB, 0x25, 0x96, 0xFA, 0x91, 0xAF, 0xA7, 0x34, 0x20, 0x9F, 0x5C, 0xFB, 0x3D, 0x6D, 0x30, 0xDC,
+    0x5A, 0x63, 0x4E, 0x17, 0xCF, 0xF4, 0xFF, 0xCD, 0xCC, 0x66, 0x66, 0xE7, 0x6F, 0xB3, 0x3C, 0x9D,
+    0x19, 0xF6, 0x75, 0xD6, 0xDF, 0xCC, 0xB4, 0xF1, 0xA7, 0xB6, 0xCC, 0xAA, 0x9A, 0x4C, 0x67, 0x56,
+    0x08, 0x95, 0x36, 0xDF, 0x66, 0xC5, 0xC6, 0x9A, 0x8F, 0x73, 0x2A, 0xC9, 0x60, 0x3E, 0xCC, 0x8A,
+    0xE5, 0x60, 0xEC, 0x34, 0x17, 0x1E, 0x6C, 0x98, 0x6E, 0x65, 0xC4, 0xF5, 0xF3, 0x91, 0x36, 0x7D,
+    0x4A, 0xF3, 0xDD, 0xCC, 0xD0, 0x7C, 0x98, 0x73, 0x79, 0x58, 0xA3, 0x19, 0xCF, 0x99, 0x2D, 0x56,
+    0xB3, 0x75, 0xDE, 0x5E, 0x62, 0xE6, 0x4F, 0x67, 0xC7, 0x6B, 0xFE, 0x1E, 0x6F, 0x07, 0x5E, 0x72,
+    0xA9, 0x70, 0xAD, 0xC1, 0x2F, 0xD6, 0x2D, 0xDE, 0x9C, 0xAD, 0xDB, 0xA4, 0xEB, 0x88, 0x42, 0x45,
+    0xD8, 0x9A, 0x00, 0x6E, 0xF0, 0xD3, 0x5B, 0x44, 0xBE, 0xF5, 0xA8, 0xD2, 0xDC, 0x53, 0x50, 0xB0,
+    0x8D, 0x47, 0x22, 0xA0, 0x79, 0x98, 0x0E, 0x3F, 0xC8, 0x12, 0x74, 0x9B, 0x40, 0x7D, 0x57, 0x8D,
+    0x50, 0xAB, 0x62, 0x76, 0x9B, 0x73, 0x0B, 0x51, 0xCC, 0x84, 0x37, 0x2C, 0x44, 0x4A, 0xDB, 0xE5,
+    0xF0, 0x60, 0xDD, 0x41, 0x8E, 0x58, 0x1C, 0xB0, 0xD8, 0xA7, 0x7F, 0x8E, 0x2B, 0x41, 0x27, 0x99,
+    0xBD, 0x8A, 0xC3, 0x55, 0xF2, 0xAA, 0xF8, 0x89, 0xB0, 0x17, 0x43, 0x6D, 0xCF, 0xA0, 0x51, 0x5E,
+    0x64, 0xB3, 0x49, 0x57, 0x8C, 0x0A, 0x3F, 0x40, 0x65, 0x3A, 0xEE, 0x74, 0x36, 0x57, 0x14, 0x50,
+    0xC1, 0xEC, 0x0C, 0x91, 0x7B, 0x1F, 0x56, 0x94, 0x66, 0x88, 0xAE, 0x98, 0xA8, 0x1E, 0x81, 0x53,
+    0x64, 0x0C, 0xB9, 0x92, 0x14, 0x27, 0x4B, 0x95, 0x33, 0xC6, 0xA4, 0x75, 0x28, 0x49, 0x2C, 0x9E,
+    0x72, 0xEF, 0x47, 0xD7, 0xA6, 0xA9, 0x05, 0x06, 0x73, 0x1F, 0x0A, 0xEA, 0x73, 0x3C, 0x9F, 0x20,
+    0x39, 0xA2, 0x00, 0x60, 0x5B, 0x31, 0x09, 0x80, 0x66, 0x2C, 0xA0, 0xB5, 0x4E, 0x64, 0x12, 0xD2,
+    0xCC, 0x48, 0x31, 0xAD, 0x70, 0xAE, 0x08, 0x93, 0xCC, 0x1E, 0xFC, 0xED, 0x35, 0xD4, 0x90, 0xC4,
+    0x86, 0x31, 0x28, 0x4E, 0x58, 0xC9, 0x0D, 0xA2, 0x60, 0x81, 0xAC, 0x1E, 0x77, 0x5A, 0x2E, 0xD3,
+    0xD1, 0xAC, 0x82, 0xB6, 0x77, 0x61, 0xCC, 0xD0, 0x8C, 0xA6, 0x1E, 0x96, 0x95, 0xAE, 0x83, 0xB2,
+    0x8D, 0x53, 0xB6, 0xD7, 0xAD, 0x03, 0x57, 0x5F, 0x60, 0xFA, 0x17, 0x1B, 0xC1, 0x93, 0x05, 0x12,
+    0x6A, 0x44, 0xA4, 0x42, 0x5D, 0x01, 0x30, 0xB8, 0x21, 0x46, 0xCF, 0x38, 0xA9, 0x65, 0x7F, 0x39,
+    0xC9, 0x9F, 0xE0, 0x8B, 0x65, 0x4D, 0xD5, 0x0F, 0xF0, 0x06, 0x77, 0x12, 0xED, 0xD7, 0xBE, 0xA1,
+    0x58, 0xDB, 0xE3, 0xD2, 0xE3, 0x75, 0x4B, 0x5D, 0x8F, 0xF7, 0x65, 0x99, 0x55, 0x5C, 0x7E, 0xAA,
+    0xDE, 0x6D, 0x9E, 0x48, 0x0F, 0x6E, 0x47, 0x30, 0x7F, 0x44, 0xAA, 0x3B, 0xC2, 0xC1, 0x48, 0xEF,
+    0xDB, 0x13, 0x8A, 0x77, 0xF1, 0x58, 0x3C, 0x47, 0xC3, 0x3A, 0x44, 0x9B, 0x43, 0x6C, 0x06, 0xE4,
+    0x48, 0xA8, 0x83, 0x0C, 0x65, 0x90, 0xD3, 0x5B, 0x8F, 0xE4, 0x70, 0x60, 0xA2, 0xBB, 0xF1, 0x10,
+    0x80, 0xAE, 0x2D, 0xB8, 0x33, 0x10, 0x77, 0xC8, 0x6A, 0xDC, 0xF1, 0xF0, 0x10, 0x74, 0x79, 0xF9,
+    0x75, 0x29, 0x82, 0xB4, 0x07, 0xC0, 0xA3, 0xA5, 0x0D, 0x14, 0x25, 0xB5, 0x2F, 0xC0, 0x22, 0x48,
+    0xEC, 0xC0, 0xA8, 0x98, 0x7A, 0xBA, 0xDC, 0xF8, 0x0D, 0x9D, 0x54, 0xB1, 0x6E, 0x1D, 0x45, 0x14,
+    0x3D, 0x3B, 0x83, 0xBC, 0x52, 0x46, 0x62, 0xD2, 0xA4, 0x09, 0xC5, 0x36, 0x34, 0x20, 0xC4, 0xFC,
+    0x80, 0x61, 0x16, 0x1A, 0x24, 0xAA, 0x14, 0xD0, 0x84, 0x1F, 0x40, 0x34, 0xF4, 0x88, 0xF0, 0xD6,
+    0xA4, 0xA4, 0x49, 0x7E, 0x00, 0xB9, 0xA0, 0x40, 0x16, 0x22, 0xAD, 0x91, 0x6C, 0xEF, 0x2A, 0x29,
+    0x28, 0xD2, 0x6C, 0x0A, 0x44, 0xE9, 0x25, 0x04, 0x59, 0x22, 0x45, 0x46, 0xF1, 0x42, 0xD6, 0x68,
+    0x77, 0x87, 0x73, 0x67, 0x6D, 0xCB, 0x26, 0x49, 0x61, 0xE6, 0x69, 0x76, 0xF5, 0x56, 0x77, 0xCE,
+    0x9C, 0x73, 0xEF, 0xB9, 0x17, 0x40, 0x0F, 0x98, 0x0A, 0xD8, 0x01, 0xF2, 0x16, 0xB8, 0x82, 0x17,
+    0xAD, 0xFA, 0x2B, 0xD8, 0x38, 0x60, 0xAE, 0x5B, 0xD3, 0x78, 0xDC, 0xC0, 0xA8, 0x3A, 0x1D, 0x2C,
+    0x6C, 0xB3, 0x8E, 0xBD, 0x2C, 0xC6, 0x5E, 0xC7, 0xD8, 0xDA, 0x18, 0x61, 0x8E, 0x46, 0xC2, 0x34,
+    0x80, 0x6B, 0x90, 0xC5, 0x06, 0x76, 0xBF, 0xC5, 0x98, 0x77, 0x27, 0x30, 0x6A, 0x1A, 0xE0, 0x63,
+    0xA7, 0xFF, 0x89, 0xA5, 0xC3, 0x98, 0xF5, 0x3A, 0x98, 0x4A, 0x30, 0x3C, 0x82, 0x1A, 0xF2, 0x05,
+    0xA3, 0xF4, 0x71, 0x84, 0x3B, 0x08, 0x0C, 0xDF, 0x7E, 0x1D, 0xE6, 0xEF, 0x0E, 0xEB, 0x11, 0xD9,
+    0xC3, 0xE1, 0x2C, 0x9D, 0x8B, 0xE1, 0x64, 0x9B, 0x6F, 0x02, 0x23, 0x19, 0xD5, 0x36, 0xC0, 0xFF,
+    0x3C, 0xC0, 0x1D, 0xCE, 0xE7, 0xE5, 0x99, 0x67, 0x5D, 0xD2, 0x67, 0x1F, 0x4F, 0x10, 0x81, 0x79,
+    0x6B, 0x1B, 0x51, 0x88, 0x80, 0x11, 0x94, 0x88, 0x82, 0x78, 0xA2, 0x11, 0x31, 0x86, 0x45, 0x24,
+    0x6C, 0x05, 0xCD, 0xF7, 0x17, 0x2D, 0x72, 0xBE, 0x7C, 0x79, 0x1E, 0x4E, 0xC7, 0x59, 0xB2, 0x45,
+    0x76, 0x82, 0xB5, 0x8D, 0x51, 0x92, 0x45, 0x72, 0x02, 0xC4, 0x7C, 0x49, 0xAE, 0x16, 0x8D, 0xB2,
+    0xDC, 0xFE, 0x37, 0x03, 0x08, 0x4F, 0xC2, 0xFE, 0x4E, 0x7C, 0x30, 0xA8, 0x60, 0xA7, 0xEB, 0xA1,
+    0xA0, 0x82, 0xC8, 0xA3, 0xFC, 0xAE, 0x1B, 0xFD, 0xD7, 0x35, 0x58, 0xB8, 0x16, 0xE5, 0x2A, 0xC6,
+    0xA3, 0x3B, 0xF2, 0x31, 0x0E, 0x72, 0x24, 0xB6, 0x6A, 0x5E, 0xAD, 0x96, 0xEC, 0xBC, 0x36, 0xA0,
+    0x1E, 0x75, 0xFC, 0xC1, 0x50, 0x4D, 0x03, 0x57, 0x09, 0x2B, 0x4F, 0x6E, 0x5F, 0x33, 0x59, 0x4D,
+    0x11, 0xDB, 0x3C, 0x56, 0x18, 0xA0, 0x76, 0x81, 0x77, 0x84, 0x34, 0xC3, 0xB0, 0x76, 0x2B, 0x71,
+    0xCF, 0x26, 0xB2, 0xEE, 0x5F, 0x54, 0xF8, 0x0A, 0x35, 0xA9, 0xDE, 0xEE, 0xCD, 0x1F, 0x9F, 0x57,
+    0xBC, 0xD2, 0xC5, 0x78, 0x93, 0x54, 0x88, 0xAA, 0xE7, 0xAD, 0xCE, 0xC7, 0x89, 0x4C, 0x1A, 0x15,
+    0x6F, 0x49, 0x2C, 0xE5, 0xD8, 0x32, 0x19, 0xC9, 0xBC, 0xD4, 0x48, 0x27, 0x19, 0x22, 0x0D, 0x29,
+    0xCF, 0xED, 0x5E, 0x1D, 0x7D, 0xD2, 0x31, 0x1B, 0x55, 0x1D, 0xE7, 0xA4, 0x91, 0xDE, 0xF1, 0x7F,
+    0xFE, 0x48, 0xD4, 0x5E, 0x90, 0x51, 0x3F, 0xA2, 0x9F, 0xE8, 0x4E, 0x5F, 0xF1, 0x40, 0x83, 0x82,
+    0x7E, 0x1A, 0x04, 0xFD, 0xFC, 0x72, 0x1D, 0x0C, 0x0B, 0xB3, 0xF7, 0x41, 0x2B, 0x34, 0x7D, 0x9C,
+    0x15, 0xA9, 0xDA, 0x5F, 0x92, 0x7A, 0xC4, 0xAD, 0x6D, 0x29, 0x1D, 0x37, 0x12, 0x51, 0xB5, 0xF9,
+    0x06, 0xF2, 0x30, 0xC3, 0x72, 0x17, 0x0F, 0x27, 0xF8, 0xDF, 0xA7, 0x97, 0x71, 0x14, 0xED, 0xEA,
+    0xA8, 0x28, 0x05, 0x55, 0x48, 0x52, 0x7D, 0xE5, 0x3F, 0x46, 0x82, 0x15, 0x96, 0xA2, 0xDF, 0x52,
+    0x87, 0xE0, 0xEA, 0x1E, 0x45, 0x8B, 0xBA, 0xCC, 0xBE, 0x5F, 0x8E, 0x6F, 0x8B, 0x96, 0x01, 0x45,
+    0xA9, 0x68, 0x3A, 0xB0, 0x07, 0x76, 0xF9, 0x21, 0xA3, 0xE6, 0x46, 0x49, 0xB5, 0x2E, 0x43, 0xB7,
+    0x70, 0xC8, 0x02, 0x8A, 0xEA, 0x3F, 0xF7, 0x56, 0x82, 0x3F, 0x48, 0x37, 0x3A, 0xFA, 0x56, 0x8E,
+    0xBA, 0x52, 0xDE, 0x41, 0xBA, 0x6A, 0x6F, 0x09, 0xEA, 0xD9, 0x03, 0x60, 0x3D, 0xED, 0xAF, 0xC1,
+    0x13, 0x99, 0xEB, 0xED, 0x44, 0xEB, 0x5D, 0xB0, 0x3B, 0xA5, 0x04, 0x23, 0x32, 0xE6, 0xB8, 0x07,
+    0x4D, 0xCC, 0x83, 0x26, 0x48, 0xB5, 0x55, 0xD8, 0xD1, 0x61, 0x34, 0x4F, 0x47, 0x7B, 0x38, 0xE2,
+    0x84, 0x25, 0x23, 0x79, 0x59, 0x46, 0xC0, 0x90, 0x82, 0x3B, 0xA9, 0x1E, 0xA9, 0x17, 0x8D, 0x5C,
+    0xE7, 0x4E, 0xC9, 0x29, 0xE9, 0x62, 0xB1, 0x3A, 0xD6, 0x24, 0x5F, 0x57, 0xF6, 0x3E, 0x92, 0xF4,
+    0xF0, 0x3F, 0x53, 0x9D, 0x08, 0xC1, 0xFD, 0x16, 0x98, 0x89, 0x28, 0xB5, 0x60, 0xA7, 0xD8, 0xD6,
+    0xCB, 0xF1, 0x64, 0x41, 0x31, 0xE1, 0x7B, 0x3C, 0xE5, 0x25, 0xD4, 0x47, 0x31, 0x0A, 0x8B, 0x09,
+    0xF5, 0xD3, 0x02, 0x7D, 0x89, 0x67, 0x2D, 0xD1, 0xBE, 0x05, 0x84, 0x58, 0x38, 0x6F, 0xC4, 0x1B,
+    0x75, 0x89, 0xD4, 0x7A, 0x4F, 0x3A, 0x35, 0xE9, 0xA0, 0x7B, 0xCD, 0xCE, 0xCC, 0x3B, 0xD3, 0x99,
+    0xD6, 0xB2, 0xB7, 0x6C, 0x5B, 0x34, 0xAE, 0xF1, 0xF2, 0xAB, 0x56, 0x15, 0x63, 0xAF, 0x92, 0x32,
+    0xFB, 0x5B, 0xF3, 0xAA, 0xE2, 0x74, 0xF2, 0xB0, 0x35, 0xE8, 0x10, 0x3D, 0xD7, 0x55, 0xCD, 0x5E,
+    0x6C, 0xEC, 0xDD, 0x1E, 0xA3, 0x87, 0xBB, 0x39, 0x14, 0x61, 0xB1, 0x4B, 0x63, 0x49, 0xDC, 0x3D,
+    0x92, 0x58, 0x7A, 0x78, 0x3D, 0xF5, 0x37, 0x33, 0x22, 0xD9, 0x7C, 0x6E, 0x5D, 0x04, 0x4C, 0x2A,
+    0x0C, 0x66, 0xC2, 0xC4, 0x32, 0x9B, 0xF6, 0x98, 0x89, 0x9D, 0xF4, 0x71, 0xE9, 0x2B, 0xFF, 0x78,
+    0x30, 0xC1, 0x36, 0x23, 0xA7, 0x53, 0x69, 0xEF, 0x71, 0x3C, 0xF8, 0x8D, 0x48, 0x9F, 0x76, 0x8E,
+    0x79, 0xE5, 0x00, 0x51, 0xF3, 0xF1, 0x54, 0x71, 0xAF, 0x72, 0xE8, 0x74, 0x92, 0x9C, 0xE2, 0xD4,
+    0x2D, 0x17, 0x80, 0xB0, 0x2D, 0x0F, 0xDE, 0xE5, 0x70, 0xB9, 0xC7, 0x7D, 0x7F, 0xC0, 0x67, 0x1F,
+    0x7E, 0x77, 0x56, 0x8B, 0xC0, 0x88, 0x18, 0xC1, 0x91, 0x1F, 0x81, 0x38, 0x03, 0x59, 0xBA, 0x0D,
+    0xC2, 0x13, 0x43, 0xA0, 0x44, 0xD0, 0x42, 0xE7, 0x53, 0x6E, 0x96, 0x52, 0xB1, 0x50, 0x32, 0xFF,
+    0xCC, 0xE2, 0xA4, 0xEC, 0xFA, 0xD6, 0xC4, 0xB2, 0xCF, 0xEC, 0x90, 0x65, 0xB6, 0x5E, 0x2D, 0x53,
+    0xD3, 0x62, 0xC5, 0x77, 0x94, 0x7D, 0x7C, 0xDF, 0x2B, 0x27, 0xB6, 0x43, 0x4A, 0x2F, 0x41, 0x52,
+    0x8D, 0x4C, 0x23, 0xCF, 0x45, 0x9C, 0x5F, 0xCA, 0x9E, 0x9E, 0x09, 0x5D, 0x25, 0x43, 0xE8, 0x14,
+    0x9E, 0x9A, 0x7F, 0x2D, 0x4A, 0xA0, 0x17, 0x0F, 0x41, 0x0C, 0x07, 0x35, 0x88, 0xA9, 0xF4, 0xD3,
+    0x67, 0x7C, 0x9A, 0x83, 0x43, 0x31, 0xD8, 0xFE, 0xFD, 0x4E, 0x6C, 0xF6, 0xA4, 0x91, 0xA7, 0xC4,
+    0x93, 0x9E, 0xA0, 0x24, 0xB7, 0xEA, 0x34, 0xB1, 0x4C, 0x42, 0xB4, 0xE9, 0x6A, 0x77, 0xE6, 0xEA,
+    0xA4, 0x20, 0x4B, 0x57, 0xEB, 0x34, 0x59, 0xF3, 0x25, 0x30, 0x85, 0xBC, 0x95, 0x42, 0x2E, 0x2F,
+    0x6A, 0xD8, 0x24, 0xA8, 0x97, 0x44, 0xAC, 0x6D, 0x1E, 0x2B, 0xCC, 0xDB, 0xBC, 0xDB, 0xC1, 0xAE,
+    0x61, 0x26, 0xC7, 0x6C, 0xB4, 0x95, 0xDB, 0xE8, 0xF5, 0xE0, 0xCA, 0xD5, 0xFB, 0xC1, 0x06, 0x7F,
+    0x70, 0x5C, 0x9C, 0x09, 0xB5, 0x30, 0x13, 0xAF, 0x7D, 0x99, 0xC6, 0xA6, 0x24, 0x63, 0xF7, 0x79,
+    0xAB, 0x5D, 0x08, 0xEC, 0x7F, 0xAC, 0x7F, 0x01, 0xB5, 0x55, 0x31, 0x8E, 0xE5, 0x44, 0x14, 0x2C,
+    0xDB, 0x62, 0x3A, 0x70, 0xD0, 0x11, 0x48, 0xB0, 0x81, 0x49, 0x01, 0x89, 0xBE, 0x00, 0x52, 0x5B,
+    0xE2, 0x00, 0x24, 0x44, 0x24, 0xE4, 0x10, 0x70, 0x01, 0x76, 0x6C, 0x86, 0x2B, 0x70, 0x00, 0x42,
+    0x76, 0x84, 0xB4, 0x7B, 0x80, 0x61, 0xDC, 0x82, 0x80, 0x10, 0x4B, 0x1B, 0x12, 0x8C, 0x11, 0x2B,
+    0x11, 0x90, 0x74, 0x60, 0x69, 0x0D, 0xB2, 0xDD, 0x54, 0xB5, 0x67, 0x86, 0x11, 0xB3, 0x88, 0x60,
+    0x85, 0x25, 0xF7, 0xF7, 0x97, 0xBB, 0xDF, 0xAB, 0xAA, 0x57, 0xEF, 0x19, 0x0D, 0x50, 0xAE, 0x40,
+    0x17, 0x61, 0xAF, 0xC6, 0x2A, 0x36, 0x3D, 0x8E, 0xEB, 0x21, 0x4E, 0xEB, 0x50, 0x8F, 0x17, 0x58,
+    0x6D, 0x68, 0xC2, 0x52, 0x2E, 0x4D, 0xEB, 0xCF, 0x66, 0x33, 0x3B, 0xA4, 0x6A, 0xEF, 0xA2, 0x4F,
+    0x7B, 0x99, 0xD2, 0x58, 0xEF, 0x3C, 0x7B, 0xD2, 0x7F, 0x03, 0xFB, 0xFD, 0x0A, 0xF7, 0xC3, 0x0A,
+    0xFF, 0xE3, 0x82, 0xE1, 0xA7, 0x05, 0x77, 0x2E, 0x33, 0x9A, 0x49, 0xA1, 0xEA, 0x60, 0x83, 0x62,
+    0xD9, 0xDE, 0xF5, 0x0C, 0xD6, 0xBB, 0xB6, 0x6B, 0x19, 0x0D, 0xFE, 0x37, 0xDE, 0x69, 0x87, 0x4B,
+    0x1B, 0x72, 0x3C, 0xE0, 0x15, 0x1D, 0x0B, 0x40, 0x35, 0xF2, 0x9E, 0x88, 0x30, 0xE2, 0xBF, 0x2F,
+    0x0F, 0x3B, 0x5A, 0xE6, 0x2A, 0xD7, 0x2A, 0xA2, 0x2B, 0x17, 0xFE, 0x5D, 0x51, 0x2D, 0xDF, 0x01,
+    0xA9, 0x03, 0xA3, 0xB7, 0x30, 0x89, 0x31, 0x75, 0x7B, 0xC6, 0xAC, 0x19, 0xB3, 0x22, 0xD0, 0x8A,
+    0x19, 0x1F, 0x6F, 0x54, 0x60, 0xE7, 0x26, 0xDE, 0x36, 0x83, 0xA7, 0x0E, 0xE5, 0xAC, 0x98, 0xA8,
+    0xF8, 0xD3, 0xCD, 0xA8, 0xD3, 0x84, 0x6D, 0x20, 0xCF, 0xA5, 0x58, 0xC8, 0xA0, 0x5D, 0xAA, 0xE8,
+    0xE0, 0xCD, 0x64, 0x7E, 0x59, 0x71, 0x99, 0x5A, 0x9B, 0x46, 0x70, 0x47, 0x33, 0xDE, 0x1E, 0x8B,
+    0xD2, 0x90, 0xDA, 0x64, 0x68, 0x4C, 0x56, 0x47, 0x06, 0x4F, 0xDC, 0xE0, 0x7E, 0xDD, 0x50, 0x3C,
+    0x7A, 0xBB, 0xFF, 0x17, 0x1A, 0xD4, 0xB0, 0x15, 0x0D, 0x0C, 0x7C, 0x34, 0xD1, 0xF5, 0xF0, 0xEF,
+    0xC7, 0x83, 0x87, 0xBF, 0x0A, 0x28, 0x13, 0xE3, 0x37, 0x09, 0x07, 0x91, 0x0C, 0x76, 0xE0, 0x6D,
+    0xA7, 0x83, 0xC9, 0x3B, 0x99, 0x26, 0xFF, 0x0C, 0xCB, 0x0D, 0x15, 0xCA, 0xF9, 0x11, 0x50, 0xA4,
+    0x4C, 0x5E, 0xA7, 0x5F, 0xFD, 0xF0, 0x05, 0x69, 0x45, 0x13, 0x25, 0x75, 0xE0, 0x4E, 0x41, 0x53,
+    0x0C, 0x5C, 0xAA, 0x1A, 0x5D, 0x27, 0x06, 0x1F, 0xF0, 0xB4, 0xFB, 0x92, 0xA4, 0x6C, 0xD8, 0x94,
+    0xCE, 0xB7, 0x64, 0xC4, 0xAC, 0x55, 0x4A, 0x8B, 0x96, 0x44, 0x64, 0x4A, 0xC1, 0x25, 0xB2, 0xA8,
+    0xC4, 0xD2, 0xF5, 0x48, 0xAD, 0x0F, 0xF0, 0xA3, 0xE2, 0x17, 0x4A, 0xAE, 0xD7, 0x11, 0xA7, 0xE7,
+    0x5F, 0xDD, 0xCF, 0x5F, 0x3F, 0x9F, 0x60, 0x19, 0xCA, 0xFE, 0x4E, 0x17, 0x04, 0x4F, 0xD7, 0xD8,
+    0x50, 0x4E, 0x54, 0x31, 0x52, 0x86, 0xF7, 0x70, 0x49, 0xCE, 0xA9, 0x65, 0x9E, 0x31, 0x87, 0xA8,
+    0xFF, 0x58, 0x6F, 0x4F, 0x5E, 0x50, 0x2B, 0x96, 0x97, 0xF8, 0x4D, 0x12, 0xE1, 0xEE, 0xD9, 0x0B,
+    0xE8, 0x89, 0x18, 0x86, 0x56, 0xAF, 0x45, 0xCC, 0x6B, 0xA3, 0x93, 0x70, 0xCD, 0x95, 0x64, 0x7C,
+    0x4A, 0x62, 0xF5, 0xB4, 0xAA, 0x6C, 0x24, 0x56, 0x2D, 0x96, 0x75, 0x5C, 0xE5, 0x8E, 0x94, 0x54,
+    0x35, 0x21, 0x1F, 0x94, 0xD7, 0xA7, 0xC4, 0xFA, 0x90, 0x06, 0x9A, 0x89, 0xC4, 0x2C, 0xBB, 0x66,
+    0xBE, 0x03, 0xC3, 0x73, 0x8B, 0x11, 0x92, 0x9C, 0xE4, 0x65, 0xD9, 0x09, 0xB3, 0xA3, 0x78, 0x66,
+    0xBF, 0xAE, 0x87, 0x00, 0x9B, 0xE7, 0x84, 0xBA, 0xF9, 0xA3, 0x18, 0x19, 0xED, 0xCE, 0xD2, 0xB9,
+    0xE0, 0xFB, 0x5C, 0x09, 0x41, 0x75, 0x04, 0xA9, 0x8A, 0x04, 0x95, 0x41, 0x38, 0x9F, 0xB2, 0x0F,
+    0x14, 0x4C, 0x85, 0xB4, 0xE1, 0xBA, 0xC2, 0xD9, 0x1C, 0xAE, 0xBD, 0x85, 0x38, 0x9C, 0x12, 0xFE,
+    0x44, 0x80, 0x65, 0xB4, 0xE1, 0x21, 0xD6, 0xBA, 0xB7, 0x81, 0xE8, 0x2C, 0xDC, 0x17, 0x74, 0x8D,
+    0x25, 0x3E, 0x42, 0x2B, 0xF7, 0xEE, 0xB0, 0x0A, 0xC3, 0x39, 0x3E, 0xD1, 0x87, 0x8E, 0x78, 0x3E,
+    0xC9, 0x2D, 0x23, 0x17, 0x31, 0x3A, 0x72, 0x60, 0x95, 0xBC, 0xBD, 0xA3, 0x40, 0xF1, 0x38, 0x0B,
+    0x39, 0xA1, 0xA3, 0x82, 0x44, 0x18, 0x0C, 0x9D, 0x0A, 0x01, 0x51, 0x33, 0x1A, 0x11, 0xCE, 0xA8,
+    0x66, 0xC1, 0x53, 0x00, 0x3E, 0x94, 0x69, 0x7C, 0xA0, 0xBD, 0xB1, 0x90, 0xBF, 0xEC, 0x71, 0x7A,
+    0x97, 0x95, 0x65, 0xA9, 0x77, 0x81, 0xCF, 0x51, 0xCC, 0xEA, 0xB4, 0x23, 0xD3, 0x03, 0xD2, 0x27,
+    0xF1, 0x6F, 0xEB, 0x49, 0x2C, 0xD5, 0x38, 0xAD, 0x3A, 0xD1, 0x9F, 0x91, 0x58, 0x68, 0xD2, 0x78,
+    0x92, 0x6E, 0x7A, 0xCE, 0x66, 0x23, 0xB4, 0x22, 0x20, 0x00, 0x1F, 0xB3, 0xAD, 0x62, 0x3D, 0xFE,
+    0xD3, 0x33, 0x9F, 0xF2, 0xA5, 0x3D, 0xF2, 0xC5, 0x0C, 0xB9, 0x50, 0xDE, 0xAC, 0x9B, 0x8E, 0x65,
+    0xCC, 0x02, 0x0F, 0x31, 0xC9, 0xFF, 0x04, 0x1A, 0xC3, 0x7C, 0x12, 0xD4, 0x0B, 0x74, 0x02, 0xA9,
+    0x66, 0xD4, 0xAC, 0x6E, 0xCF, 0x65, 0xBB, 0x56, 0xC8, 0x05, 0x28, 0x14, 0x07, 0x2E, 0x56, 0x73,
+    0xEB, 0x94, 0x13, 0x0A, 0x34, 0xF0, 0xC0, 0xFE, 0x84, 0x7E, 0xC8, 0xF3, 0x83, 0x14, 0x24, 0xB4,
+    0x1E, 0xED, 0xD4, 0x8B, 0x05, 0xF9, 0xB7, 0xF8, 0xEC, 0x68, 0x6B, 0xBD, 0xCD, 0x5D, 0x2B, 0x5B,
+    0x5B, 0x4D, 0xC8, 0xF3, 0xFF, 0x55, 0x6F, 0xAA, 0xD9, 0x04, 0x25, 0xE2, 0xE1, 0xE2, 0x51, 0xCE,
+    0x31, 0xF4, 0x65, 0x8A, 0x54, 0x9C, 0xC3, 0x96, 0x3E, 0x16, 0x6C, 0x6E, 0xA2, 0xF6, 0xD5, 0xF2,
+    0x26, 0x73, 0x93, 0xF1, 0x58, 0x0C, 0xE2, 0xF7, 0x3A, 0xDE, 0xA2, 0x3F, 0xCE, 0xB8, 0xAB, 0x56,
+    0x28, 0xD9, 0x26, 0x1F, 0x00, 0xBE, 0xBE, 0xDF, 0xAA, 0x6F, 0xC8, 0xEA, 0xCA, 0x6D, 0xD4, 0x76,
+    0x82, 0xAE, 0xF9, 0x7B, 0xC0, 0xAD, 0xD4, 0x0A, 0x19, 0x7C, 0x2E, 0x43, 0x6E, 0xBE, 0x26, 0xDE,
+    0x28, 0xEF, 0xB6, 0xE2, 0x49, 0xC6, 0x2F, 0xC1, 0xE3, 0x41, 0xC0, 0x68, 0xB9, 0x66, 0x20, 0x12,
+    0xC5, 0x92, 0x75, 0x97, 0x1A, 0xFA, 0xEE, 0xE1, 0xCE, 0x97, 0x85, 0xFE, 0x51, 0x01, 0xC8, 0x87,
+    0xB3, 0xE0, 0xE8, 0x14, 0x69, 0x4C, 0x4A, 0xB2, 0x91, 0x7C, 0x94, 0x4B, 0x40, 0x56, 0xF8, 0xDB,
+    0x4A, 0x7C, 0x75, 0xC1, 0xBD, 0x3F, 0x4B, 0x54, 0x29, 0x9C, 0x47, 0x28, 0xE6, 0xFB, 0x5F, 0xA7,
+    0xF4, 0x4C, 0x0B, 0xB7, 0x74, 0x02, 0x33, 0x9C, 0xE7, 0x31, 0x49, 0x02, 0x3B, 0x8B, 0x58, 0x6C,
+    0x5C, 0x08, 0xA7, 0x9A, 0x39, 0x37, 0xAB, 0xC8, 0xC1, 0x63, 0xA2, 0x99, 0x59, 0x74, 0x7E, 0x37,
+    0x34, 0x65, 0x5E, 0x93, 0x7F, 0x79, 0xD6, 0xA9, 0x2E, 0xC7, 0x0C, 0x3A, 0x8A, 0xF3, 0x27, 0x5E,
+    0xF2, 0xFA, 0x0B, 0xBD, 0x55, 0x3D, 0x6E, 0xD4, 0x40, 0x14, 0x7E, 0xF6, 0xB0, 0x58, 0x8A, 0x0B,
+    0x37, 0x04, 0x09, 0xA5, 0x70, 0x9F, 0x02, 0x9F, 0x80, 0xD8, 0x47, 0x48, 0x91, 0xD0, 0x50, 0xD0,
+    0xD3, 0xEC, 0x0D, 0xB2, 0x86, 0x13, 0xA4, 0x80, 0x9E, 0x22, 0x91, 0x60, 0x0B, 0xB8, 0x40, 0x88,
+    0x7D, 0x04, 0x8B, 0x0B, 0xE0, 0x82, 0x44, 0x22, 0x34, 0x2E, 0x8C, 0xD8, 0x8D, 0xBC, 0xFB, 0xF8,
+    0xBE, 0x67, 0x6F, 0x14, 0x89, 0xDD, 0x20, 0x24, 0xC4, 0x48, 0x1E, 0x79, 0x3C, 0x33, 0xEF, 0x7D,
+    0xDF, 0xF7, 0x7E, 0x2C, 0x22, 0xA9, 0x60, 0xA4, 0x8F, 0x30, 0x1D, 0xED, 0x61, 0x3A, 0xFB, 0x84,
+    0xA9, 0xEB, 0x44, 0xBC, 0xF9, 0x4C, 0x76, 0x2E, 0x7F, 0xB6, 0x52, 0x68, 0x23, 0xBE, 0x6A, 0x2D,
+    0x61, 0x3D, 0xA9, 0x24, 0xCA, 0xD3, 0x52, 0x12, 0xC1, 0xB4, 0x27, 0x93, 0x4C, 0x52, 0x4F, 0x71,
+    0x5B, 0x6D, 0x5A, 0x8A, 0xC4, 0x9C, 0xDC, 0x82, 0x36, 0x22, 0x9D, 0xE3, 0x55, 0xB5, 0x15, 0x4F,
+    0x55, 0x33, 0x29, 0xA6, 0xB0, 0x93, 0x96, 0x6E, 0x21, 0x51, 0x2D, 0x69, 0x16, 0xB4, 0x12, 0x55,
+    0x7E, 0x27, 0xAE, 0x9D, 0x68, 0x27, 0x5D, 0x02, 0x13, 0x93, 0xD1, 0xE4, 0x22, 0x4B, 0xF3, 0xC8,
+    0x8E, 0x75, 0x23, 0x6D, 0x78, 0x91, 0xFE, 0x75, 0x46, 0x17, 0x1D, 0x4C, 0xE2, 0x2D, 0x50, 0x7D,
+    0x2B, 0x86, 0x79, 0x35, 0x15, 0xD8, 0x12, 0x6E, 0xC9, 0x74, 0x89, 0x2D, 0x0F, 0x2F, 0x3B, 0x97,
+    0xAD, 0x6C, 0x00, 0x9E, 0xFF, 0x09, 0x38, 0x2C, 0xEC, 0x13, 0x73, 0x49, 0x7F, 0x22, 0x2F, 0x4E,
+    0x0F, 0x64, 0xCD, 0xD8, 0xFA, 0x88, 0x03, 0x05, 0x6E, 0x81, 0x62, 0x03, 0x2A, 0xF8, 0x34, 0xC1,
+    0x03, 0x46, 0x42, 0x82, 0x58, 0xF5, 0xDE, 0x73, 0x58, 0x59, 0xC0, 0xC9, 0xF1, 0x6A, 0xAF, 0x21,
+    0xEA, 0xAB, 0x29, 0x3D, 0x74, 0x12, 0xF2, 0x32, 0x50, 0x94, 0xA4, 0x6A, 0x76, 0xEF, 0x91, 0xA0,
+    0x79, 0xDE, 0x9D, 0x1E, 0xCA, 0xA6, 0x11, 0xCE, 0x48, 0x4F, 0xFC, 0x79, 0x9C, 0x85, 0x17, 0xE3,
+    0x1C, 0xC7, 0x73, 0x28, 0x98, 0xA7, 0x87, 0xBD, 0x22, 0xE9, 0xD5, 0x07, 0x58, 0x85, 0xD2, 0x70,
+    0xE1, 0xEB, 0xF1, 0xEA, 0xD6, 0x59, 0x50, 0x13, 0xAE, 0xC0, 0x05, 0xE4, 0x09, 0x96, 0xFF, 0x8B,
+    0x13, 0xC6, 0x2C, 0xAC, 0xF0, 0xAD, 0xC1, 0x26, 0xCE, 0x16, 0xD5, 0x06, 0x5A, 0x45, 0x0E, 0xF3,
+    0x9D, 0xD1, 0xF2, 0xE7, 0xCF, 0x6A, 0x0B, 0x2A, 0xF1, 0x90, 0x57, 0x54, 0x22, 0x40, 0xCB, 0x29,
+    0x3F, 0xB6, 0x46, 0x4C, 0x8A, 0xAF, 0x37, 0x79, 0x10, 0x12, 0x01, 0x9D, 0xC5, 0x80, 0xE9, 0xBD,
+    0x5F, 0xC3, 0xCB, 0x1F, 0xB2, 0x08, 0x09, 0x37, 0xD0, 0xB2, 0x3B, 0xD4, 0x20, 0x36, 0x95, 0xC0,
+    0x2A, 0x85, 0x65, 0x37, 0x27, 0x8E, 0x15, 0x29, 0x9D, 0xBE, 0xC3, 0xB6, 0xDD, 0xEE, 0x8C, 0x53,
+    0xC0, 0x17, 0x68, 0xD7, 0xD8, 0x55, 0x78, 0xF3, 0x21, 0xC4, 0x6E, 0xBE, 0x36, 0x42, 0xE0, 0x4A,
+    0x26, 0xE7, 0x4F, 0x67, 0x88, 0xCF, 0x2B, 0xF8, 0x07, 0x0D, 0xD7, 0x58, 0x74, 0x20, 0x70, 0x45,
+    0x0E, 0xC9, 0xFC, 0xDF, 0xA3, 0x63, 0xFE, 0x0B, 0x4B, 0x39, 0x20, 0x52, 0x24, 0xBD, 0xC8, 0x83,
+    0xBF, 0x43, 0xC4, 0xBB, 0x88, 0x04, 0xA0, 0xA0, 0x1E, 0x22, 0x44, 0x19, 0xE5, 0xEB, 0x37, 0xB7,
+    0xD9, 0xA5, 0x74, 0x12, 0x7F, 0x41, 0x1C, 0x43, 0xAA, 0xEE, 0xE8, 0xD2, 0x6B, 0xD6, 0x07, 0xD5,
+    0xB2, 0x2A, 0xE9, 0x19, 0xB0, 0xDC, 0xB2, 0x81, 0xA1, 0xF1, 0x30, 0x8A, 0x56, 0x6C, 0xC6, 0xD1,
+    0xB1, 0x53, 0x18, 0x49, 0xE3, 0x6F, 0x2C, 0xA3, 0xEB, 0x69, 0x6E, 0x34, 0x69, 0xA4, 0x34, 0x9E,
+    0x48, 0x44, 0x2D, 0x07, 0xF3, 0x47, 0xC0, 0xE9, 0xCF, 0x41, 0x35, 0xA2, 0x29, 0x94, 0xB7, 0xF8,
+    0xB5, 0xDC, 0x35, 0x58, 0x3B, 0x4C, 0x43, 0x2A, 0x21, 0x90, 0x82, 0xC5, 0x96, 0xF7, 0x01, 0x40,
+    0x9A, 0xB9, 0x66, 0xA8, 0x1F, 0x0A, 0xD2, 0xE7, 0xD9, 0x20, 0x89, 0x8D, 0x88, 0xA1, 0x0E, 0x48,
+    0xD7, 0x01, 0xAE, 0xB8, 0x1F, 0xD8, 0xF7, 0xDB, 0x70, 0x53, 0x42, 0x6F, 0xEF, 0xCB, 0xD0, 0x82,
+    0xFA, 0xAC, 0xB5, 0x9A, 0xCC, 0x46, 0x7D, 0xED, 0x39, 0x2B, 0x40, 0x2B, 0x91, 0x22, 0xB3, 0x50,
+    0x6D, 0xBD, 0x06, 0x65, 0xA7, 0x33, 0x44, 0x4E, 0x17, 0xBE, 0xCA, 0x43, 0xCD, 0x8A, 0x52, 0xCE,
+    0x25, 0x5E, 0x1E, 0x6A, 0x0E, 0x40, 0x40, 0x54, 0x58, 0x69, 0x5A, 0xB7, 0x1B, 0x2F, 0xAD, 0xB2,
+    0x03, 0x2A, 0x91, 0x94, 0x94, 0x11, 0x53, 0xC4, 0xA0, 0x74, 0xC1, 0x5A, 0x09, 0xEE, 0xCF, 0xAC,
+    0x51, 0xE2, 0xFE, 0x77, 0x80, 0x3F, 0x0B, 0x16, 0xE2, 0x2A, 0x48, 0xFC, 0x98, 0xAA, 0xB5, 0x1E,
+    0x56, 0x25, 0x56, 0xD1, 0xCB, 0xA2, 0xB4, 0xE6, 0x61, 0x27, 0x2D, 0x34, 0x5E, 0xB1, 0x10, 0x53,
+    0xC6, 0xCF, 0xD0, 0x39, 0xE3, 0xBE, 0xDD, 0x96, 0xE8, 0x22, 0xD4, 0x61, 0xFB, 0x96, 0x83, 0x28,
+    0x3B, 0x23, 0x23, 0x2A, 0x13, 0xB1, 0xD0, 0x25, 0x69, 0x37, 0x86, 0x81, 0xD2, 0x80, 0x8D, 0x35,
+    0x32, 0x04, 0x3D, 0xED, 0x05, 0x82, 0x36, 0x1E, 0xAF, 0x4B, 0x4A, 0x06, 0xAE, 0xBB, 0x11, 0x27,
+    0x6A, 0xFC, 0x53, 0x8A, 0x95, 0x6A, 0x1E, 0x43, 0xA2, 0xB6, 0x57, 0x27, 0x69, 0x24, 0xC9, 0x3D,
+    0xBD, 0x78, 0x6E, 0x51, 0xE4, 0x5F, 0x86, 0xA0, 0xA1, 0x14, 0xA4, 0xBD, 0xAF, 0xDF, 0xE4, 0x76,
+    0xE7, 0xF3, 0xEF, 0xE8, 0x7C, 0xDE, 0x79, 0xCA, 0x1F, 0x01, 0x7E, 0x47, 0xD7, 0x08, 0x56, 0xE2,
+    0xC1, 0x52, 0x0B, 0xE7, 0x61, 0x8E, 0xB6, 0xF7, 0x84, 0xBF, 0x8B, 0x06, 0x2B, 0x57, 0x8F, 0x4D,
+    0xFA, 0xCC, 0x4E, 0x5A, 0x33, 0x94, 0xB1, 0x12, 0x1C, 0x56, 0xC7, 0x71, 0x65, 0x9D, 0xDB, 0xBA,
+    0x9C, 0x47, 0xFF, 0x32, 0xCA, 0x06, 0xE3, 0x27, 0x37, 0xFD, 0x13, 0x5F, 0xD8, 0x30, 0xFA, 0xC4,
+    0xFE, 0x7D, 0x8C, 0x0E, 0x98, 0x9A, 0x96, 0x8D, 0x0B, 0x53, 0xC4, 0x69, 0xE5, 0x65, 0x31, 0x65,
+    0xB6, 0x6C, 0xA3, 0x1C, 0x49, 0x65, 0x49, 0xB3, 0xBB, 0x8F, 0x95, 0x2E, 0x4D, 0x8B, 0xA2, 0x1C,
+    0x15, 0x9F, 0xF1, 0x37, 0x98, 0x05, 0xFA, 0x66, 0x52, 0x9B, 0x10, 0xC9, 0xD0, 0x12, 0x6A, 0xD9,
+    0xD1, 0x93, 0xCD, 0xB5, 0xF0, 0x0B, 0xCD, 0x55, 0xB1, 0x6E, 0xDC, 0x46, 0x14, 0x9C, 0xE5, 0x42,
+    0x60, 0xC1, 0x82, 0x4D, 0x0A, 0xC3, 0x2A, 0xD8, 0xA4, 0x0C, 0xC4, 0x1F, 0x48, 0xB4, 0xF4, 0x1F,
+    0xA8, 0x51, 0x9F, 0x3F, 0xB8, 0x1F, 0x88, 0x43, 0xFE, 0x41, 0xDC, 0xA4, 0x4F, 0x13, 0xC0, 0x51,
+    0x0A, 0xB7, 0x2E, 0x64, 0x1D, 0xF3, 0x07, 0x84, 0x53, 0xA6, 0x61, 0x97, 0xC2, 0xCD, 0x16, 0x2C,
+    0x08, 0x83, 0xC7, 0xCD, 0xCC, 0xE3, 0x9D, 0x0F, 0x52, 0x0C, 0xD7, 0x26, 0x84, 0x15, 0x97, 0xBB,
+    0xFB, 0xDE, 0xBC, 0x79, 0xB3, 0x73, 0x00, 0x02, 0x80, 0xAA, 0x07, 0xCA, 0x08, 0xE4, 0x0B, 0xE0,
+    0xFE, 0xC0, 0xA3, 0xC7, 0x3D, 0x04, 0xF8, 0x94, 0x7A, 0xFF, 0x31, 0x8D, 0x59, 0xAC, 0x26, 0x4C,
+    0x7E, 0xC1, 0x5B, 0xAC, 0xF8, 0x01, 0x6D, 0x53, 0x22, 0xF4, 0x7E, 0xDC, 0x45, 0xA4, 0x34, 0x21,
+    0xA4, 0x05, 0x79, 0x4A, 0xC0, 0x2E, 0x35, 0x8C, 0xD7, 0xE3, 0x55, 0x35, 0xA0, 0x4D, 0x91, 0x0B,
+    0x11, 0x55, 0x1A, 0x81, 0x8B, 0xC6, 0x42, 0x96, 0x8B, 0x86, 0x59, 0x89, 0x99, 0x14, 0xF5, 0xC0,
+    0xA1, 0x25, 0x04, 0xE8, 0x5C, 0x96, 0xF0, 0x85, 0xC7, 0xDD, 0x72, 0xD8, 0xA7, 0x19, 0xC5, 0x96,
+    0x91, 0x03, 0xFF, 0x6E, 0x5C, 0xEA, 0x00, 0xBF, 0x72, 0xCD, 0x2B, 0x76, 0x31, 0x29, 0x41, 0xCC,
+    0x7E, 0xE7, 0xE0, 0xD3, 0x5C, 0x71, 0x98, 0xEA, 0xE8, 0x76, 0x1C, 0x50, 0x77, 0xD5, 0x7A, 0x9B,
+    0xBA, 0x32, 0xA5, 0xD4, 0x30, 0x48, 0x52, 0x71, 0x3C, 0xB8, 0x5B, 0x5F, 0x29, 0xFC, 0x1D, 0x11,
+    0xEC, 0x09, 0x25, 0x0C, 0x1B, 0x23, 0xE5, 0xB4, 0xB1, 0x62, 0x61, 0x6F, 0x8F, 0x20, 0x76, 0xBF,
+    0xF4, 0x2C, 0x38, 0x62, 0xDD, 0xCF, 0xB8, 0xCF, 0x0F, 0x64, 0x22, 0xE1, 0x0A, 0xA1, 0x2B, 0x9B,
+    0x6A, 0xF0, 0x3D, 0x8F, 0xCD, 0x97, 0x0B, 0xB1, 0x1D, 0xC0, 0x24, 0x70, 0xE4, 0x0E, 0x97, 0x89,
+    0xF1, 0x7C, 0xC4, 0xB7, 0xF9, 0x44, 0x26, 0x16, 0x2E, 0x88, 0x2A, 0x32, 0xE0, 0x6E, 0x2C, 0xA2,
+    0x68, 0xC8, 0x94, 0x22, 0x37, 0xEA, 0xFE, 0x21, 0x57, 0xE1, 0xC5, 0xFC, 0xB4, 0x78, 0xB6, 0x69,
+    0x45, 0xDD, 0xBB, 0x03, 0x59, 0xE7, 0xEE, 0xD0, 0x11, 0xD5, 0xBE, 0xF1, 0x33, 0xD3, 0x33, 0x6E,
+    0x62, 0xD9, 0x6E, 0x55, 0xD9, 0x07, 0xF2, 0xEA, 0x0F, 0xA8, 0x47, 0x76, 0x23, 0x0D, 0x2A, 0xB2,
+    0x2F, 0x4F, 0x43, 0x57, 0x7D, 0xBC, 0x4B, 0x0D, 0xC9, 0x48, 0x4D, 0x18, 0xC9, 0x75, 0x3B, 0xF8,
+    0x23, 0xE1, 0xA5, 0x4A, 0x6F, 0x88, 0xA0, 0x43, 0xD8, 0x75, 0x3E, 0x16, 0xFD, 0x29, 0x6F, 0x31,
+    0x6C, 0x32, 0x59, 0x3E, 0xBD, 0x3A, 0xBD, 0x7E, 0x98, 0x59, 0xE4, 0xEC, 0xD2, 0x87, 0x58, 0x4C,
+    0x45, 0x1F, 0xBA, 0x9A, 0x5F, 0x97, 0x22, 0xE6, 0x23, 0x5F, 0x5F, 0x1C, 0xF4, 0x5A, 0xC4, 0xD0,
+    0x87, 0xBF, 0x92, 0x7B, 0x38, 0x62, 0x2F, 0x22, 0x35, 0x43, 0xD0, 0xB5, 0x26, 0xE5, 0x71, 0x92,
+    0x04, 0x8D, 0x9D, 0x4C, 0x63, 0xC5, 0x61, 0x32, 0xF4, 0x54, 0x42, 0xA1, 0xE8, 0xE4, 0xB0, 0x56,
+    0x8F, 0x0C, 0xBE, 0xD7, 0x1E, 0x97, 0xEE, 0xDE, 0x4C, 0x6C, 0x11, 0x69, 0x37, 0xFC, 0x14, 0x24,
+    0xF9, 0xFD, 0x84, 0x8B, 0x62, 0xD8, 0x6B, 0xE7, 0xAF, 0x86, 0x36, 0xDF, 0x20, 0xE2, 0x0C, 0x11,
+    0x5F, 0x80, 0x98, 0xBF, 0xEF, 0x90, 0xBE, 0xC7, 0xD5, 0xBE, 0xF3, 0x7F, 0xC7, 0xFF, 0x4B, 0x2F,
+    0x63, 0x3F, 0x42, 0x0F, 0xAF, 0x7F, 0xA4, 0x89, 0x3B, 0x78, 0xA6, 0x1C, 0x2C, 0x51, 0x75, 0xFE,
+    0x4E, 0xC1, 0xEC, 0x4D, 0x3B, 0xEC, 0x05, 0x5B, 0x00, 0x36, 0x42, 0xF5, 0xF2, 0x79, 0x86, 0x97,
+    0xDF, 0x21, 0xFD, 0x94, 0xFD, 0x3B, 0x67, 0xEF, 0xC7, 0x73, 0xDC, 0xB7, 0x16, 0x61, 0x86, 0x9B,
+    0x90, 0x45, 0x89, 0x24, 0x1F, 0x55, 0x0E, 0xEF, 0x0F, 0xA3, 0xF2, 0x64, 0xDD, 0x6D, 0xFB, 0xFE,
+    0x4C, 0x3D, 0x5B, 0xD9, 0xB4, 0xE9, 0xF5, 0xE7, 0x2E, 0xC6, 0xC3, 0xA6, 0xD1, 0x72, 0x34, 0x14,
+    0xD6, 0x9F, 0xED, 0xD5, 0x78, 0x20, 0xD8, 0xC0, 0x30, 0x84, 0x22, 0x7C, 0x82, 0xC3, 0xA6, 0xE7,
+    0xB3, 0x01, 0xD4, 0xAD, 0x33, 0xED, 0xE1, 0xF6, 0x8E, 0x62, 0x1D, 0xD8, 0x83, 0x6F, 0x1E, 0xD5,
+    0x3D, 0x5A, 0x8C, 0x6B, 0x56, 0xD9, 0x80, 0xA2, 0x20, 0x42, 0xC7, 0x93, 0xEF, 0x8C, 0x70, 0x42,
+    0x64, 0x53, 0x45, 0x8D, 0x06, 0x22, 0x20, 0x0D, 0x7E, 0x52, 0x42, 0xA6, 0x2F, 0x4F, 0x55, 0x30,
+    0x37, 0x91, 0xB4, 0x8D, 0x98, 0x49, 0x22, 0x26, 0x5B, 0xC5, 0x0B, 0x2F, 0x16, 0xD7, 0x19, 0x38,
+    0x8C, 0x32, 0x01, 0x27, 0x77, 0xE0, 0x3E, 0x1E, 0x20, 0x7D, 0x8C, 0x75, 0xB6, 0xA2, 0x2B, 0xF3,
+    0x13, 0x3F, 0x8A, 0x24, 0xDC, 0x6F, 0x99, 0x3B, 0xB1, 0x24, 0x30, 0x8B, 0x31, 0xCE, 0x1C, 0x64,
+    0xAA, 0x6E, 0xE4, 0x2E, 0xF2, 0x90, 0xFA, 0x24, 0xDF, 0xE7, 0x76, 0xB6, 0xB0, 0x88, 0x4F, 0xCD,
+    0x85, 0x20, 0xC5, 0xDA, 0x7A, 0xCA, 0xAB, 0xF9, 0x64, 0xE5, 0xB6, 0x16, 0x91, 0x15, 0x90, 0x30,
+    0xB1, 0xC3, 0x83, 0x6D, 0x27, 0xBA, 0xCA, 0x6D, 0xCE, 0xB6, 0x2D, 0x98, 0xDD, 0x94, 0x45, 0x4F,
+    0x39, 0x15, 0x43, 0xD9, 0x57, 0x7D, 0xDD, 0x13, 0xC1, 0xB5, 0xAA, 0xE4, 0xB9, 0xD0, 0x93, 0x84,
+    0x6A, 0xE4, 0x5E, 0xA6, 0x5E, 0x95, 0x26, 0x34, 0xAC, 0x9C, 0x49, 0xF6, 0xFA, 0x42, 0xDF, 0x9C,
+    0xD5, 0xAD, 0x83, 0x5D, 0x0A, 0x5B, 0xB6, 0x4B, 0x31, 0x92, 0x26, 0xA6, 0xE4, 0x05, 0x3F, 0x68,
+    0x62, 0x37, 0xBB, 0xED, 0xB9, 0x7C, 0x39, 0x0A, 0xA6, 0x5D, 0x51, 0xD7, 0xC8, 0xA2, 0x92, 0x1C,
+    0x55, 0xF6, 0x4A, 0x89, 0x13, 0x73, 0x29, 0x3B, 0xC9, 0xF6, 0x67, 0x61, 0xB9, 0xDF, 0x70, 0xA1,
+    0x96, 0x17, 0xCA, 0xE8, 0xE3, 0xE6, 0x19, 0xD5, 0x63, 0x61, 0xB3, 0xB7, 0x5C, 0x5E, 0xB4, 0x7C,
+    0x2D, 0x0D, 0xB2, 0xC3, 0xF7, 0xFA, 0x12, 0xF4, 0xA5, 0xEC, 0xD8, 0x67, 0x4E, 0xDE, 0xD9, 0x69,
+    0x60, 0x12, 0xF8, 0x7B, 0x03, 0xAF, 0x66, 0xD7, 0xCD, 0xF1, 0x97, 0x03, 0xAD, 0x82, 0x86, 0xE9,
+    0x64, 0xEA, 0xB8, 0x39, 0xF5, 0x0C, 0xC6, 0x26, 0xA1, 0x0A, 0x55, 0xFD, 0x86, 0x7B, 0xF3, 0xB1,
+    0x6E, 0x3E, 0xA3, 0xDE, 0x62, 0xDB, 0x66, 0x26, 0x37, 0x9E, 0xBC, 0x50, 0x8C, 0x6C, 0x82, 0xB5,
+    0x06, 0x6F, 0xE2, 0x06, 0xDD, 0xEF, 0xB4, 0xE4, 0xE7, 0x23, 0x21, 0x9B, 0x57, 0x63, 0x23, 0xC8,
+    0x1A, 0x6F, 0x7E, 0x2D, 0xC5, 0xE1, 0xC7, 0x5A, 0x36, 0x2E, 0x8B, 0x37, 0x27, 0xB6, 0x1F, 0x23,
+    0x7A, 0xFE, 0x53, 0x73, 0x75, 0xF1, 0x18, 0xB5, 0xE0, 0x75, 0x70, 0x87, 0x07, 0x09, 0x7E, 0x79,
+    0xBA, 0x47, 0xC3, 0xCF, 0x47, 0x43, 0xB4, 0xD5, 0x92, 0x97, 0x2A, 0x13, 0x40, 0xD9, 0xA3, 0x17,
+    0xBC, 0x97, 0x30, 0xB9, 0x89, 0x4C, 0x18, 0x45, 0x3E, 0x1E, 0x81, 0x29, 0x79, 0xA5, 0x9F, 0x12,
+    0x95, 0x79, 0x81, 0xAF, 0xE2, 0xF9, 0x0F, 0xB5, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x9D, 0xDD,
+    0xD5, 0x61, 0x09, 0x17, 0xDB, 0xA7, 0x71, 0x4F, 0xE3, 0x9A, 0x82, 0x5B, 0x87, 0x48, 0xA4, 0xA4,
+    0x81, 0x9A, 0x16, 0xC4, 0x6F, 0xB8, 0xD8, 0x52, 0x8A, 0xB4, 0xF9, 0x07, 0x49, 0x41, 0x95, 0xE6,
+    0xDA, 0x14, 0x49, 0x6C, 0x29, 0x45, 0x8A, 0x34, 0x86, 0x86, 0x82, 0xC6, 0x12, 0x3F, 0xE0, 0x56,
+    0xE0, 0x24, 0x86, 0xAC, 0x3D, 0x79, 0x33, 0xEB, 0xEF, 0xF8, 0xEE, 0xB8, 0x02, 0x29, 0xC2, 0xD2,
+    0x67, 0xAF, 0x77, 0xBC, 0x33, 0xEF, 0xBD, 0x79, 0xBB, 0x1F, 0x91, 0x5E, 0x96, 0x71, 0xF3, 0x0B,
+    0x6E, 0x61, 0xC0, 0xDB, 0x86, 0x41, 0x15, 0x71, 0xE3, 0x86, 0xA8, 0x48, 0x74, 0xFD, 0xDA, 0xCA,
+    0x85, 0x8A, 0xD8, 0x0E, 0x54, 0xDF, 0x47, 0x70, 0xC5, 0x9A, 0xE2, 0xCF, 0x15, 0x6B, 0xCF, 0x47,
+    0xC4, 0xB0, 0xB8, 0xE4, 0x09, 0x6F, 0xC8, 0x69, 0x38, 0xCA, 0x5B, 0x27, 0x6F, 0x0D, 0xDE, 0x30,
+    0xE5, 0xE5, 0x16, 0x1E, 0x6D, 0x64, 0xD7, 0xB0, 0x91, 0x8F, 0x61, 0xA5, 0x76, 0xE8, 0xB1, 0x9A,
+    0x9E, 0x13, 0x39, 0x7C, 0x5E, 0x75, 0x57, 0x86, 0xCF, 0x30, 0xFC, 0x23, 0x51, 0x75, 0x3E, 0x50,
+    0xBF, 0x90, 0x43, 0xAE, 0x0A, 0x35, 0xFB, 0x19, 0xC3, 0x48, 0x15, 0x7E, 0x7D, 0x1B, 0xDD, 0xC2,
+    0x53, 0xF5, 0x33, 0x8F, 0x47, 0x10, 0xED, 0x93, 0x4C, 0x08, 0x20, 0xED, 0x9A, 0xD9, 0x00, 0x41,
+    0x89, 0xA5, 0x9F, 0x75, 0xF9, 0x8B, 0xA7, 0xCF, 0xE8, 0x4D, 0x34, 0xEF, 0x46, 0x7B, 0xD1, 0xB8,
+    0x8D, 0x8A, 0x05, 0x58, 0xC8, 0x27, 0xAA, 0x99, 0x4E, 0xDB, 0xEE, 0xAC, 0x06, 0x83, 0x2F, 0x80,
+    0x7D, 0x20, 0x83, 0xA5, 0xA7, 0xA0, 0xD2, 0xE8, 0x2A, 0x8F, 0x79, 0x24, 0xA9, 0x07, 0x72, 0xC8,
+    0x1E, 0x1A, 0xE8, 0x80, 0xCC, 0x3A, 0x6F, 0xFE, 0x99, 0x6F, 0x51, 0x2A, 0xCF, 0x57, 0xCC, 0xBF,
+    0x30, 0xA7, 0xC0, 0xFC, 0x8A, 0x19, 0x11, 0x03, 0x3A, 0xF8, 0x66, 0x22, 0x1B, 0xC9, 0xCC, 0x57,
+    0x65, 0xC5, 0xAC, 0x59, 0x94, 0x7C, 0x50, 0xEE, 0xE5, 0x28, 0x2A, 0x1C, 0x4D, 0x0D, 0xFB, 0x94,
+    0x20, 0xB8, 0x87, 0x29, 0x60, 0xDE, 0x54, 0x92, 0x8F, 0x86, 0x75, 0x79, 0xDD, 0x7A, 0x8C, 0x84,
+    0xC8, 0x30, 0x6A, 0xDF, 0x21, 0x59, 0x1D, 0xC9, 0x61, 0xF4, 0xAD, 0xD2, 0x3F, 0xBD, 0x19, 0xD7,
+    0xE5, 0x54, 0x3A, 0x4C, 0x79, 0x58, 0x62, 0x52, 0x68, 0xB0, 0x42, 0x58, 0xAE, 0xF2, 0xAC, 0x16,
+    0x69, 0x84, 0x5B, 0x61, 0x08, 0x2D, 0xD1, 0x77, 0x6A, 0x3B, 0x25, 0x81, 0x85, 0x82, 0x96, 0x42,
+    0xF7, 0x3D, 0x68, 0x24, 0x6A, 0x51, 0x86, 0x91, 0x7A, 0x73, 0xD1, 0xA4, 0x72, 0xB2, 0xA8, 0x20,
+    0x4C, 0x0A, 0x48, 0x27, 0x54, 0x7C, 0x54, 0x2E, 0x63, 0xCD, 0x3C, 0x80, 0xCC, 0xD0, 0xB2, 0xA8,
+    0x21, 0xA6, 0x11, 0x39, 0x20, 0xB0, 0xBF, 0x0F, 0x97, 0x3C, 0x88, 0x54, 0x7F, 0xF5, 0x50, 0x70,
+    0x89, 0x6C, 0x02, 0x51, 0xA3, 0xC8, 0x63, 0xE7, 0xEC, 0x34, 0x91, 0x0B, 0x1C, 0xB4, 0xBC, 0xFC,
+    0xC4, 0x79, 0x02, 0xFB, 0xF0, 0x3B, 0xC2, 0xF6, 0x03, 0xB0, 0xAD, 0x14, 0x6E, 0xC3, 0xB7, 0x10,
+    0x86, 0x21, 0x13, 0x1C, 0x2F, 0xCC, 0xFF, 0x13, 0x36, 0xDF, 0x89, 0x30, 0x52, 0x56, 0x7A, 0x58,
+    0x77, 0xF5, 0xD7, 0x93, 0x7F, 0x3D, 0x17, 0xBF, 0x27, 0x3B, 0x3F, 0xD9, 0xDB, 0x5A, 0x37, 0x52,
+    0x69, 0x57, 0x38, 0xCB, 0xE7, 0xB7, 0xEB, 0x5B, 0xD0, 0xEE, 0xBB, 0x52, 0x0A, 0xC9, 0x25, 0x9A,
+    0xC9, 0xD5, 0xE7, 0x87, 0xC9, 0xE1, 0xF0, 0x20, 0x87, 0x43, 0x95, 0xC3, 0x7D, 0x9B, 0x5D, 0xCC,
+    0x6B, 0xFE, 0x8C, 0xB3, 0x03, 0xCD, 0xBE, 0x75, 0xD4, 0x4A, 0xF2, 0xDC, 0xCB, 0x15, 0x7B, 0xE3,
+    0xFC, 0x5E, 0xA4, 0x9D, 0xF6, 0x65, 0x87, 0xCF, 0x73, 0x56, 0xBF, 0x3F, 0x41, 0x52, 0x0E, 0x0C,
+    0xC2, 0x43, 0xCE, 0x13, 0x97, 0xF2, 0xD3, 0xBF, 0x61, 0x96, 0x84, 0x61, 0xDF, 0x9F, 0x9C, 0x31,
+    0xB8, 0x1D, 0x83, 0xDF, 0x77, 0xC1, 0xE7, 0xFF, 0x3A, 0x66, 0x44, 0xAC, 0xDC, 0x26, 0x15, 0x25,
+    0x77, 0x2A, 0xB7, 0x50, 0x9B, 0xA5, 0x1A, 0xE6, 0x5E, 0xA9, 0xA2, 0xEA, 0x3C, 0xA0, 0xFE, 0x9B,
+    0x3B, 0xF3, 0x23, 0xFF, 0xD5, 0x54, 0x7C, 0x01, 0x60, 0x27, 0x47, 0x5F, 0x65, 0x82, 0xDA, 0xD0,
+    0x9D, 0xAB, 0x93, 0x3C, 0x56, 0x78, 0x19, 0x4D, 0xAE, 0xC5, 0xBE, 0xB9, 0x86, 0x03, 0x6A, 0x02,
+    0xE5, 0x0B, 0xD1, 0x25, 0x34, 0x86, 0x3B, 0xA8, 0xC9, 0xB1, 0x44, 0x67, 0x92, 0x9B, 0xD1, 0xE2,
+    0xDB, 0x08, 0xF3, 0x24, 0xE1, 0x14, 0x1A, 0xBB, 0xF5, 0x12, 0xFE, 0xEE, 0x75, 0xA4, 0xF0, 0xF2,
+    0xDD, 0x8C, 0xFD, 0xC3, 0x08, 0x2F, 0x38, 0x0D, 0x8B, 0xD5, 0x73, 0x67, 0xF9, 0x4B, 0xA8, 0x05,
+    0x33, 0x44, 0x6A, 0x63, 0x95, 0xF5, 0x7D, 0x0A, 0xCC, 0x00, 0x7A, 0x96, 0x09, 0x9E, 0x5C, 0x29,
+    0x7D, 0xD6, 0x37, 0x0E, 0xAA, 0x7A, 0x1C, 0xAB, 0x7D, 0x83, 0x72, 0x6E, 0xF2, 0x43, 0xD5, 0xBD,
+    0xA0, 0xE7, 0x18, 0x46, 0x3F, 0x56, 0x43, 0x8F, 0xED, 0x91, 0xDC, 0x52, 0x4D, 0xB5, 0x2A, 0xD2,
+    0x8A, 0xAE, 0x35, 0xB6, 0x5D, 0xE7, 0x47, 0xF4, 0x0B, 0xBE, 0x0E, 0xC9, 0xC2, 0x40, 0x4C, 0x2B,
+    0x15, 0x3C, 0x22, 0xCC, 0x8B, 0x84, 0x7B, 0x84, 0xFB, 0xF3, 0x57, 0x08, 0xFF, 0x8A, 0xD3, 0xD5,
+    0xC7, 0x75, 0xC5, 0x9E, 0x04, 0x48, 0xB7, 0xA1, 0x9B, 0x86, 0xEF, 0xC0, 0x77, 0xFD, 0xD8, 0x23,
+    0x1C, 0x71, 0xDC, 0x56, 0xA9, 0xB8, 0x34, 0xA0, 0xF6, 0x3A, 0x4C, 0x07, 0x57, 0x94, 0x42, 0x41,
+    0xFF, 0x22, 0xB4, 0x9F, 0xFA, 0x47, 0x72, 0x24, 0xDC, 0xDB, 0x15, 0xA5, 0xB1, 0x5B, 0xDE, 0x2F,
+    0x76, 0x15, 0xBC, 0xBE, 0x0B, 0x74, 0xCF, 0x2E, 0x76, 0xC6, 0x70, 0x08, 0x4D, 0x6B, 0x93, 0x4B,
+    0x3E, 0xFA, 0xA9, 0xED, 0x7A, 0x75, 0xC5, 0xE1, 0xC8, 0xDE, 0x72, 0x7A, 0x9C, 0x0C, 0x92, 0x3B,
+    0x3B, 0xE7, 0x93, 0x87, 0x9F, 0xA2, 0x65, 0xF5, 0xDD, 0xE9, 0x60, 0xDC, 0xEC, 0xA0, 0x5A, 0x2B,
+    0x35, 0x74, 0xD3, 0x05, 0xFA, 0xDA, 0xB8, 0x2C, 0x47, 0xB5, 0xA0, 0x91, 0x30, 0x2D, 0xF8, 0x6B,
+    0xE7, 0x54, 0x0F, 0xE2, 0x0D, 0x9D, 0xF4, 0xEF, 0xE3, 0x4A, 0xB9, 0x75, 0x2A, 0x88, 0x4B, 0x01,
+    0x5B, 0xA5, 0x7F, 0x89, 0xFF, 0x17, 0xED, 0x5D, 0x56, 0xA4, 0x9E, 0x6B, 0x49, 0x60, 0xA0, 0xC1,
+    0xA1, 0x79, 0x3F, 0x99, 0xC7, 0x70, 0x68, 0x2B, 0xCC, 0xA7, 0x1D, 0x51, 0x21, 0x68, 0x4F, 0x6E,
+    0xC6, 0xF3, 0xDB, 0x2C, 0xDB, 0x04, 0x37, 0xBE, 0x98, 0xA8, 0x9C, 0xB1, 0xCF, 0x43, 0x83, 0x43,
+    0x35, 0xC1, 0xE4, 0xE5, 0x04, 0x4F, 0x87, 0x06, 0x16, 0x5E, 0x01, 0xB3, 0x8C, 0xE0, 0x1F, 0x86,
+    0xD0, 0x99, 0xCD, 0xAE, 0xF4, 0xBF, 0x5D, 0x1F, 0x00, 0xC5, 0x55, 0x3D, 0xAF, 0xDD, 0x44, 0x10,
+    0x9D, 0xB5, 0x95, 0xB8, 0x70, 0xB1, 0x0D, 0x88, 0x22, 0x85, 0xFB, 0x34, 0xFE, 0x05, 0x64, 0x8D,
+    0xF8, 0x03, 0x34, 0x8F, 0x86, 0x82, 0x16, 0xD1, 0xBC, 0x3F, 0x00, 0xCF, 0xE6, 0x1F, 0xBC, 0x26,
+    0x3D, 0x25, 0x49, 0xF3, 0x5A, 0x0A, 0x92, 0xDD, 0x8E, 0xD6, 0x42, 0x42, 0xB4, 0x2E, 0x92, 0x06,
+    0x0A, 0x2C, 0x64, 0x45, 0xBE, 0xC9, 0xDA, 0xC3, 0x39, 0xE3, 0x28, 0xEF, 0x43, 0x29, 0x90, 0x40,
+    0xE2, 0xDE, 0x77, 0xBD, 0xEF, 0xDE, 0xF5, 0xCE, 0x9C, 0x73, 0xE6, 0xCC, 0x58, 0x9E, 0x0B, 0x5F,
+    0x2E, 0xDB, 0x52, 0x2D, 0xB6, 0xF8, 0xD9, 0x96, 0x70, 0x29, 0xFF, 0xE4, 0xD5, 0x9C, 0x8F, 0x76,
+    0xB7, 0xDA, 0xE1, 0xF0, 0x66, 0xE5, 0x12, 0x3B, 0x8B, 0xB8, 0x89, 0x7D, 0xCB, 0x8E, 0x4B, 0xB1,
+    0x16, 0xBC, 0xA5, 0x5C, 0xCA, 0xD9, 0x96, 0x8A, 0x4B, 0x3D, 0x5B, 0x36, 0x3F, 0xFB, 0x89, 0xB1,
+    0xA6, 0xD6, 0x82, 0xF5, 0x52, 0x6E, 0xD2, 0x0E, 0xA2, 0x83, 0x1F, 0xA5, 0x9F, 0x70, 0x67, 0xC8,
+    0xC5, 0x2A, 0x5E, 0x11, 0xB1, 0xD2, 0x11, 0xDB, 0xBA, 0x72, 0x3B, 0x62, 0x3B, 0x5E, 0xFD, 0x8C,
+    0xED, 0xDF, 0xFE, 0xCA, 0x08, 0xB2, 0x6D, 0x52, 0xE7, 0xA0, 0x52, 0xEE, 0x5E, 0x93, 0xD3, 0x4F,
+    0x75, 0x92, 0x38, 0x46, 0x6C, 0xCF, 0x4D, 0x96, 0x26, 0x57, 0x3B, 0x61, 0x28, 0x13, 0x69, 0x42,
+    0x52, 0x45, 0xB2, 0x4A, 0x6F, 0xD2, 0x74, 0xAF, 0x36, 0xFC, 0xBC, 0x91, 0x46, 0xB1, 0x95, 0xB3,
+    0x1F, 0xFD, 0x10, 0xE4, 0x82, 0xC8, 0xF1, 0x6F, 0x0A, 0x5D, 0x5F, 0xE4, 0x32, 0x13, 0x6C, 0x3F,
+    0xC4, 0x4E, 0xCA, 0x2C, 0x4E, 0x67, 0xC2, 0x92, 0xF6, 0x7B, 0x1E, 0xFF, 0xF0, 0x2B, 0x06, 0xC4,
+    0xD7, 0x52, 0x11, 0xDB, 0x9D, 0x7D, 0xF6, 0x1E, 0xBD, 0xFA, 0x85, 0x18, 0x90, 0x1F, 0xF7, 0x64,
+    0x20, 0x95, 0x38, 0x80, 0xAC, 0x9F, 0x8B, 0x4D, 0x8A, 0x2C, 0x40, 0x18, 0x41, 0x5F, 0xDA, 0x14,
+    0x12, 0x55, 0x19, 0xA5, 0x5C, 0x51, 0x96, 0x62, 0xC3, 0xB6, 0x53, 0x89, 0x2F, 0x3E, 0xD2, 0xA1,
+    0x55, 0x1C, 0xAF, 0x95, 0x29, 0x70, 0x99, 0x40, 0x06, 0x17, 0x89, 0x7B, 0xF7, 0x2E, 0xC7, 0xD9,
+    0x0F, 0xF8, 0x31, 0xA3, 0x26, 0x59, 0xEE, 0x62, 0x78, 0x80, 0x52, 0x44, 0x2A, 0x14, 0x07, 0x68,
+    0x9F, 0xF8, 0x6E, 0x3B, 0x50, 0x83, 0xDC, 0xE1, 0x3B, 0xC5, 0x91, 0x5D, 0x5A, 0x1C, 0xF3, 0x08,
+    0x59, 0x5C, 0x47, 0x2C, 0xE6, 0x66, 0xE0, 0xB9, 0x91, 0xD2, 0x21, 0x99, 0xD3, 0xF7, 0x98, 0xA3,
+    0xD9, 0x58, 0x79, 0x08, 0x42, 0x58, 0xB8, 0x0C, 0xED, 0x24, 0xDA, 0x41, 0x24, 0x48, 0x15, 0x25,
+    0x0C, 0x20, 0xD5, 0xA4, 0xA3, 0xE2, 0x65, 0x2E, 0x21, 0xC3, 0xEE, 0x36, 0x5A, 0x05, 0xDB, 0x7D,
+    0x6A, 0x4F, 0xF7, 0x74, 0x22, 0xA9, 0x19, 0xE2, 0xC0, 0x4B, 0x41, 0x75, 0xA5, 0x96, 0x80, 0xDB,
+    0xDE, 0x4E, 0x56, 0xA7, 0x0B, 0xC0, 0xCB, 0xD8, 0x5C, 0x80, 0x63, 0xF8, 0x77, 0xEC, 0x9A, 0x04,
+    0x37, 0x42, 0xF7, 0xBE, 0x93, 0x76, 0xAC, 0x56, 0x71, 0x4F, 0xE4, 0x61, 0x77, 0x2B, 0xA4, 0x23,
+    0xE9, 0x83, 0x96, 0x57, 0x23, 0x47, 0x5E, 0x1E, 0x08, 0xD3, 0x41, 0xAC, 0x5C, 0x19, 0xC0, 0x98,
+    0x09, 0x68, 0x87, 0x64, 0xD4, 0xA4, 0x19, 0xA5, 0x5E, 0xC4, 0xB8, 0x15, 0x7A, 0xF9, 0xE5, 0x2E,
+    0x46, 0x4E, 0x58, 0xBC, 0xEE, 0x60, 0x27, 0xBD, 0x12, 0xFE, 0x4D, 0x7A, 0x6D, 0xAA, 0x66, 0x43,
+    0x43, 0x30, 0x77, 0xB0, 0xB8, 0x68, 0x37, 0x27, 0x63, 0x47, 0x83, 0xA0, 0xB1, 0xF0, 0xAE, 0x47,
+    0x30, 0x20, 0x41, 0xD9, 0xAB, 0x4C, 0x53, 0x4D, 0xCC, 0x24, 0xC6, 0x51, 0xEA, 0xD3, 0xAD, 0x02,
+    0xED, 0x57, 0x10, 0x80, 0xFA, 0x9A, 0x06, 0x4A, 0x10, 0x61, 0xAA, 0xD9, 0xAA, 0x56, 0x27, 0xD8,
+    0x8C, 0x9E, 0x26, 0x23, 0x84, 0x12, 0xB4, 0x5D, 0xAD, 0xB4, 0xA6, 0xC9, 0x0D, 0x2B, 0xD2, 0x53,
+    0xA0, 0xD5, 0x82, 0x1F, 0xFA, 0x34, 0x40, 0x8B, 0x76, 0x71, 0x71, 0x12, 0x23, 0xF5, 0xFB, 0x13,
+    0x5B, 0x90, 0xC0, 0x1F, 0x4B, 0x75, 0x2C, 0x90, 0xCE, 0x96, 0x77, 0x15, 0xBA, 0x7F, 0x42, 0xD8,
+    0x57, 0xBA, 0x80, 0xC6, 0x5E, 0xA7, 0x28, 0x7A, 0xF6, 0x0C, 0x75, 0x52, 0xFD, 0x65, 0x71, 0xAA,
+    0x5B, 0x90, 0xF0, 0x18, 0x00, 0x9A, 0x95, 0x23, 0x45, 0x5F, 0x5F, 0x19, 0xDA, 0xD9, 0xEB, 0x1F,
+    0xE0, 0xD4, 0x4E, 0x0F, 0xAC, 0x68, 0x1F, 0xE0, 0xF3, 0x31, 0xD5, 0x22, 0x27, 0x4E, 0x8F, 0x1B,
+    0x26, 0x68, 0xA1, 0xAE, 0xB9, 0xE3, 0xE5, 0x79, 0x57, 0xCC, 0xE5, 0x04, 0x85, 0x56, 0xB9, 0x90,
+    0x67, 0xD2, 0x76, 0x41, 0xFC, 0xAF, 0x71, 0x00, 0x2C, 0x14, 0x04, 0xC2, 0xB3, 0x1A, 0xFD, 0x88,
+    0x39, 0x33, 0x85, 0xC1, 0x2F, 0x7E, 0xAA, 0x72, 0x9D, 0x0B, 0x2D, 0x15, 0x05, 0xD6, 0xF4, 0xF0,
+    0xF2, 0x6B, 0x76, 0xF4, 0x8F, 0xE2, 0x60, 0x56, 0x94, 0x3B, 0xC9, 0x3D, 0x00, 0x42, 0x6B, 0x62,
+    0x1B, 0x7F, 0x1D, 0x26, 0x26, 0x06, 0x12, 0x94, 0x47, 0xD1, 0x21, 0x50, 0x33, 0x41, 0x48, 0x39,
+    0x86, 0x97, 0x79, 0x06, 0x88, 0x7A, 0x8C, 0x18, 0x38, 0xC5, 0xC6, 0x29, 0xEC, 0x62, 0x92, 0x96,
+    0xDB, 0x9D, 0x9E, 0xF9, 0x6F, 0xE1, 0xB2, 0x90, 0x89, 0x89, 0xE9, 0x50, 0x60, 0xB3, 0x3A, 0x5E,
+    0xE7, 0x2C, 0xDF, 0xCC, 0x0E, 0xB9, 0x40, 0x20, 0x8C, 0x66, 0xD8, 0x49, 0x0E, 0xF7, 0xD3, 0xB7,
+    0xFD, 0x40, 0x0A, 0xB5, 0x4D, 0xF1, 0x5C, 0xCC, 0x78, 0x26, 0x3C, 0xE7, 0xA0, 0x1A, 0xDF, 0x82,
+    0xAE, 0xC6, 0xBB, 0xED, 0x5E, 0x73, 0x2F, 0x00, 0x95, 0x3B, 0x7D, 0x01, 0xAF, 0x27, 0x54, 0x21,
+    0xC8, 0x23, 0x71, 0x1C, 0xF3, 0x35, 0xA6, 0xA5, 0x84, 0xCF, 0x77, 0x28, 0xA1, 0x74, 0xD1, 0x2E,
+    0x36, 0x8C, 0x30, 0x92, 0xB1, 0xB7, 0x62, 0xD6, 0x87, 0x31, 0x0C, 0x4E, 0x31, 0x8B, 0xEB, 0xEC,
+    0x31, 0xA8, 0x26, 0x98, 0xE9, 0xE9, 0x27, 0x4F, 0x87, 0x23, 0xF5, 0xD6, 0xE3, 0xCE, 0x89, 0x6E,
+    0x94, 0xF2, 0x3A, 0xAD, 0xFF, 0x33, 0x51, 0xFE, 0x92, 0x5E, 0x5C, 0xF8, 0x8C, 0x60, 0x05, 0x58,
+    0x19, 0xF4, 0xA0, 0xD9, 0x16, 0x45, 0x80, 0x18, 0x76, 0xCC, 0x8A, 0xC0, 0x0B, 0xE9, 0x3C, 0xB2,
+    0xA1, 0x81, 0x1F, 0xD6, 0x9B, 0x6D, 0x1D, 0x4F, 0x9C, 0x53, 0xB0, 0x31, 0x9A, 0xC0, 0x6F, 0x4E,
+    0xDC, 0x6E, 0xFD, 0x27, 0xA6, 0x87, 0xB4, 0x30, 0x9A, 0xA3, 0xEC, 0x36, 0xCE, 0xEF, 0x23, 0x27,
+    0xBE, 0x26, 0xCB, 0xF3, 0x02, 0x02, 0x87, 0xD7, 0x71, 0x85, 0x65, 0x77, 0xBA, 0x73, 0x70, 0xC7,
+    0xE8, 0x75, 0xB8, 0x7C, 0x03, 0x40, 0x1D, 0x45, 0x95, 0x9F, 0x8E, 0x27, 0xAA, 0x0E, 0xC4, 0xFB,
+    0xAD, 0x74, 0x55, 0xB2, 0x27, 0x2A, 0x79, 0xB1, 0x91, 0xF1, 0x1C, 0x79, 0x19, 0x13, 0x06, 0x5D,
+    0x40, 0x87, 0x9D, 0x9F, 0xE4, 0x7F, 0x7A, 0xFD, 0x0D, 0xC5, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10,
+    0x1D, 0xDB, 0x09, 0x2E, 0x2C, 0xE1, 0x34, 0x14, 0x90, 0xC2, 0x35, 0x14, 0x71, 0x8D, 0x84, 0xB0,
+    0x25, 0x0A, 0x4A, 0xE8, 0x53, 0x40, 0x1F, 0x50, 0x7E, 0x20, 0x39, 0xAF, 0xF8, 0x82, 0x54, 0xD4,
+    0x29, 0x28, 0x50, 0xF2, 0x03, 0x14, 0x80, 0x97, 0x8A, 0x82, 0xC6, 0x0D, 0x2D, 0x9C, 0x44, 0x10,
+    0x05, 0x05, 0x16, 0x32, 0xC2, 0x89, 0x6C, 0x0F, 0xEF, 0xED, 0x39, 0x97, 0x23, 0x22, 0xA4, 0x00,
+    0x29, 0x1B, 0xED, 0x4A, 0x37, 0xDE, 0x99, 0x79, 0xEF, 0xCD, 0xEC, 0x44, 0xC4, 0xAB, 0x45, 0xC4,
+    0xEF, 0x70, 0x84, 0x8A, 0x23, 0xFE, 0x58, 0x89, 0x64, 0x5E, 0x2B, 0xA7, 0xD7, 0xAA, 0xEE, 0x88,
+    0xA8, 0x56, 0x12, 0xA8, 0x1A, 0x89, 0x7B, 0x4F, 0x24, 0x99, 0xC2, 0x9E, 0xDA, 0xF9, 0x31, 0xE4,
+    0xB0, 0x69, 0xCB, 0x48, 0x0C, 0xB5, 0xA9, 0xB0, 0x7A, 0x3C, 0x24, 0xB3, 0x72, 0x20, 0x85, 0x0D,
+    0x74, 0x5F, 0x4D, 0xAC, 0x3A, 0x48, 0xAA, 0xB8, 0xE7, 0x95, 0xF4, 0x90, 0x17, 0xBC, 0x60, 0xE0,
+    0x0F, 0xCF, 0xE4, 0xA3, 0x95, 0xC4, 0xBC, 0x3A, 0x49, 0x9B, 0x0C, 0xF8, 0x88, 0x18, 0x49, 0xBE,
+    0x22, 0x21, 0x43, 0xB9, 0x24, 0x03, 0xC3, 0x4F, 0x1D, 0xEE, 0xF8, 0xA9, 0x0A, 0x42, 0xE6, 0xDC,
+    0xB2, 0x79, 0xB8, 0x08, 0x37, 0xD6, 0x7E, 0x86, 0x56, 0xAB, 0x15, 0x07, 0xD6, 0xD1, 0x24, 0x56,
+    0x5F, 0x0F, 0x46, 0xA8, 0x85, 0xD6, 0x23, 0xD2, 0xA4, 0x73, 0x40, 0x2F, 0xE7, 0x61, 0xE7, 0x70,
+    0xAA, 0xEA, 0xD4, 0xC1, 0xDC, 0xE4, 0x65, 0x82, 0x8C, 0x71, 0xD5, 0x7B, 0xC0, 0x5B, 0x88, 0x15,
+    0xCC, 0x25, 0x2A, 0x5A, 0x22, 0x0C, 0xAB, 0x25, 0xD9, 0x82, 0xF9, 0x70, 0x06, 0x6F, 0xB5, 0x65,
+    0xA6, 0xB5, 0xF5, 0x2E, 0x52, 0xBD, 0x03, 0xD9, 0x22, 0xE0, 0xB9, 0x25, 0x12, 0x41, 0xDD, 0x6F,
+    0xF8, 0x52, 0x2F, 0xF8, 0xC7, 0x66, 0x0D, 0x71, 0xDB, 0x89, 0x93, 0x10, 0x47, 0xD0, 0xD3, 0xBA,
+    0xCD, 0x63, 0xE9, 0x0F, 0x35, 0xC8, 0xB4, 0xE1, 0x01, 0xF7, 0xAC, 0x59, 0x1A, 0x8B, 0x10, 0xCD,
+    0x8B, 0x28, 0x25, 0x25, 0x70, 0xD4, 0x3C, 0x25, 0xAD, 0x4B, 0x3A, 0xAF, 0x2D, 0xCB, 0x70, 0x53,
+    0x92, 0x5A, 0xB2, 0xA3, 0x92, 0x98, 0x71, 0xC9, 0x11, 0x04, 0xC3, 0x9D, 0xE3, 0x14, 0x13, 0xBF,
+    0x11, 0xAF, 0x87, 0x4B, 0x34, 0x8C, 0x65, 0xF1, 0xA7, 0x0B, 0x08, 0x42, 0xA8, 0x19, 0x30, 0xE2,
+    0xB6, 0xE4, 0xB3, 0x7A, 0x64, 0x3B, 0xCC, 0x84, 0x3B, 0x5E, 0x69, 0x1C, 0x86, 0xE0, 0x73, 0x69,
+    0xD1, 0x28, 0x0D, 0x12, 0x80, 0xC8, 0xBC, 0x22, 0x37, 0xF6, 0xF6, 0xF6, 0xEE, 0x41, 0xD3, 0xB7,
+    0xD8, 0xDF, 0x95, 0x69, 0x63, 0x38, 0x85, 0xCD, 0x88, 0x5B, 0xC7, 0x6C, 0x49, 0x35, 0xD3, 0x39,
+    0x80, 0xD1, 0x23, 0x84, 0x32, 0x77, 0xB8, 0x09, 0x5B, 0xA2, 0x76, 0x54, 0x07, 0x4A, 0xCA, 0x1A,
+    0xA5, 0x43, 0x88, 0xE5, 0xAD, 0xD1, 0xD8, 0x1F, 0x83, 0x7C, 0x04, 0x1A, 0xD0, 0x32, 0x97, 0xD8,
+    0x4A, 0xA9, 0x16, 0x25, 0xBE, 0x36, 0x3C, 0x97, 0xE2, 0xD8, 0x14, 0xD4, 0xC2, 0xFE, 0x46, 0x93,
+    0x65, 0x03, 0x7A, 0xC4, 0x04, 0x3A, 0xF5, 0x91, 0x15, 0xC9, 0x36, 0x2C, 0x4B, 0x1B, 0x57, 0x63,
+    0x51, 0xBC, 0xB6, 0x98, 0x95, 0xC4, 0x85, 0x67, 0x41, 0x96, 0x4F, 0x94, 0xF8, 0xAF, 0x7C, 0xB0,
+    0xAE, 0x63, 0xDF, 0x16, 0x07, 0x4B, 0x3A, 0x59, 0x05, 0xC2, 0x49, 0xD0, 0x8C, 0xBF, 0x50, 0xA6,
+    0xDA, 0x75, 0xEA, 0xC6, 0xD1, 0xAE, 0x84, 0xF5, 0xAC, 0x8D, 0xC0, 0xC4, 0xED, 0xC4, 0x38, 0x62,
+    0x24, 0x33, 0xDF, 0xE7, 0x83, 0xBB, 0x52, 0xBE, 0xE7, 0xB3, 0x01, 0x79, 0x3E, 0xE9, 0xF3, 0xC0,
+    0x9D, 0xA5, 0x69, 0xC6, 0x18, 0x77, 0x55, 0xDF, 0xAC, 0xFF, 0xB8, 0x7F, 0x5A, 0x53, 0x7A, 0xB5,
+    0x0F, 0x99, 0xED, 0x31, 0xD5, 0xA3, 0x20, 0x6B, 0xC4, 0x79, 0xE6, 0x8A, 0x5B, 0x29, 0x2D, 0x32,
+    0x66, 0x53, 0x0F, 0x4F, 0xBA, 0xC1, 0x8F, 0xB0, 0x93, 0xB4, 0xF2, 0x07, 0x0A, 0xA8, 0x39, 0x40,
+    0x66, 0x16, 0x28, 0x81, 0xAD, 0xCC, 0x23, 0xB4, 0x97, 0x85, 0x05, 0xB4, 0x94, 0xBC, 0x0A, 0x83,
+    0x6B, 0x05, 0xA1, 0x41, 0xA5, 0x8C, 0xDD, 0x07, 0x60, 0x1D, 0x9F, 0x80, 0x53, 0x6F, 0xFE, 0xD6,
+    0xFC, 0x7A, 0x57, 0x92, 0x4F, 0x56, 0x7E, 0x7E, 0x90, 0xE0, 0x1D, 0x2E, 0xC5, 0x66, 0xB1, 0xB9,
+    0xAB, 0x70, 0x9A, 0x82, 0xE3, 0x4B, 0xE9, 0x82, 0x3A, 0xAC, 0x63, 0x93, 0x9A, 0x6D, 0x19, 0xFC,
+    0x26, 0x6C, 0x22, 0x9B, 0xD9, 0xEC, 0x8B, 0xA2, 0xAD, 0x5B, 0x1F, 0x82, 0xF9, 0x5A, 0x1E, 0xFB,
+    0x78, 0xFB, 0x18, 0x3B, 0x48, 0x33, 0xE5, 0x70, 0x7C, 0x76, 0xC1, 0xEC, 0x96, 0xF7, 0x10, 0x12,
+    0xB6, 0xC2, 0xBD, 0xF9, 0xDF, 0x16, 0xB9, 0x45, 0x36, 0xAA, 0x22, 0x1B, 0xE3, 0x2F, 0xB1, 0x24,
+    0x97, 0xE4, 0x99, 0x49, 0xF3, 0x22, 0x4F, 0x91, 0x85, 0xEC, 0x32, 0x37, 0x98, 0x7B, 0x3C, 0xFD,
+    0xB9, 0xBB, 0xD7, 0x24, 0x96, 0x43, 0x12, 0xF4, 0x62, 0x57, 0xD2, 0x72, 0xE7, 0xE2, 0xE8, 0x71,
+    0x45, 0x76, 0x82, 0xAF, 0x1D, 0x06, 0x11, 0xE6, 0x94, 0x9A, 0x7F, 0xA4, 0x98, 0xBA, 0x83, 0xC3,
+    0x33, 0xE6, 0x48, 0x09, 0xF8, 0x06, 0xE4, 0xF5, 0x5F, 0xAA, 0xC8, 0x2B, 0x29, 0x09, 0x81, 0x6F,
+    0x41, 0xBE, 0x69, 0x0D, 0xBE, 0x20, 0x54, 0x1A, 0x52, 0xAC, 0x90, 0x06, 0x7C, 0x0B, 0x33, 0x23,
+    0xDF, 0x3B, 0xF2, 0x1C, 0xF5, 0x20, 0xDF, 0x73, 0x54, 0x97, 0x06, 0x0A, 0xA4, 0x24, 0x06, 0x8A,
+    0xEE, 0xBF, 0x93, 0x52, 0x5E, 0x1C, 0x91, 0x0E, 0x27, 0x59, 0xAE, 0xBA, 0xA1, 0xE1, 0x7D, 0xCD,
+    0xDD, 0x4B, 0xEC, 0x4F, 0x61, 0xD8, 0x96, 0x09, 0x79, 0xA2, 0x4D, 0x49, 0xB3, 0xF5, 0x5B, 0xB0,
+    0x7C, 0x82, 0x2E, 0x05, 0xC9, 0x60, 0x28, 0x6A, 0x70, 0x64, 0x93, 0x2E, 0x54, 0xF1, 0xEC, 0xF5,
+    0x0B, 0xBD, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x48, 0x3B, 0xD2, 0xBA, 0x98, 0x26,
+    0x69, 0xB6, 0x71, 0x1F, 0x24, 0xA6, 0xA1, 0x4D, 0xC6, 0x21, 0x05, 0x05, 0x05, 0xF9, 0x11, 0x14,
+    0x68, 0x1B, 0x28, 0x28, 0x23, 0x3C, 0x51, 0x90, 0x22, 0xD1, 0x90, 0x9F, 0xB0, 0x45, 0x8A, 0x6C,
+    0x28, 0x22, 0xBA, 0x14, 0xBB, 0xEB, 0x41, 0x29, 0x29, 0x30, 0xB4, 0x14, 0x99, 0xE4, 0x15, 0x14,
+    0x14, 0x0C, 0xC2, 0x02, 0xAF, 0x62, 0xFB, 0x72, 0xEE, 0xF8, 0xED, 0xA2, 0x47, 0xA0, 0x02, 0xC5,
+    0xD2, 0xB3, 0xFC, 0xE6, 0xE3, 0xDC, 0x73, 0xEE, 0x3D, 0x73, 0x87, 0x68, 0xDF, 0x17, 0x0F, 0x89,
+    0xCE, 0xC8, 0x06, 0x32, 0xA9, 0x9C, 0x89, 0x98, 0x6C, 0x4F, 0xFF, 0xF2, 0xB8, 0x58, 0x32, 0x56,
+    0x34, 0x66, 0x24, 0x3D, 0x91, 0xEB, 0xC9, 0xA6, 0x02, 0x03, 0x5D, 0x53, 0x8D, 0xA4, 0xF2, 0x80,
+    0x49, 0x00, 0xA0, 0xD6, 0x63, 0x1A, 0x60, 0xF6, 0x62, 0xC0, 0x79, 0x4C, 0x17, 0x33, 0xD5, 0x91,
+    0xAA, 0x51, 0xB6, 0x58, 0xE6, 0x09, 0x48, 0xCC, 0x3D, 0x29, 0xBC, 0x89, 0x34, 0x73, 0x22, 0xAA,
+    0x78, 0xF9, 0x2B, 0xDA, 0xBE, 0x2F, 0x8F, 0xB0, 0xC7, 0xF9, 0x3A, 0xAA, 0xA9, 0x58, 0xC8, 0x85,
+    0x5D, 0x36, 0xC5, 0x50, 0x8C, 0x54, 0x85, 0x0A, 0x34, 0xC8, 0x11, 0x4D, 0xC5, 0x44, 0x2A, 0x56,
+    0x91, 0xEA, 0xC6, 0x79, 0x3A, 0xC5, 0xCE, 0x32, 0x21, 0xBA, 0x39, 0xE7, 0x40, 0x4E, 0x70, 0x3B,
+    0x1E, 0xF0, 0xFA, 0x25, 0x5C, 0x08, 0x31, 0x03, 0xB1, 0xCF, 0x3A, 0xF0, 0xA7, 0x4E, 0xAB, 0x0C,
+    0x17, 0xD4, 0xBC, 0x92, 0xD6, 0x23, 0xB5, 0x61, 0x15, 0xC1, 0x32, 0x92, 0x35, 0xD4, 0x3D, 0x88,
+    0x64, 0x09, 0x25, 0x68, 0x87, 0x55, 0x81, 0x15, 0xEE, 0xAB, 0x80, 0x8E, 0x23, 0xE0, 0x8D, 0xC4,
+    0xA8, 0xE4, 0xA5, 0xB2, 0x9E, 0xB6, 0x11, 0xBA, 0x78, 0xE9, 0x5E, 0xC7, 0x13, 0x3A, 0x35, 0xC1,
+    0x04, 0xD0, 0x35, 0xDE, 0xDE, 0x1D, 0xD4, 0x68, 0xA9, 0xBD, 0x35, 0x98, 0xE4, 0x98, 0x91, 0x8A,
+    0x68, 0x79, 0x06, 0x4A, 0x20, 0x08, 0x29, 0xC1, 0xF7, 0x46, 0x43, 0x20, 0xB4, 0x82, 0x5D, 0x3E,
+    0x2A, 0x57, 0x48, 0xAA, 0x05, 0xD8, 0x1C, 0x91, 0xE6, 0x56, 0xDE, 0x53, 0x99, 0x76, 0x73, 0x74,
+    0xED, 0x01, 0x5E, 0x8F, 0xA1, 0x14, 0xD4, 0xEE, 0xC9, 0x7A, 0x17, 0x18, 0x3C, 0x6C, 0x44, 0xAD,
+    0x20, 0xCA, 0x0C, 0x2A, 0x55, 0xA3, 0x9A, 0xD5, 0x04, 0x6D, 0x5C, 0xF2, 0xBB, 0xC8, 0xF2, 0x37,
+    0x1C, 0xA1, 0xF7, 0x57, 0x9E, 0x3A, 0x24, 0x87, 0xD9, 0x85, 0x02, 0x22, 0x11, 0xA4, 0xE5, 0xEF,
+    0xA0, 0xB0, 0xE6, 0x0D, 0xD2, 0x58, 0x71, 0xEA, 0x50, 0x61, 0x4E, 0x16, 0x98, 0xDD, 0x58, 0x49,
+    0x45, 0xA7, 0x42, 0x90, 0xD7, 0xE7, 0x8E, 0x24, 0x01, 0x54, 0x4A, 0x64, 0x87, 0xDA, 0x8F, 0x3D,
+    0x19, 0xEF, 0x76, 0x89, 0x29, 0xCC, 0x4E, 0x18, 0xB3, 0xF7, 0xD3, 0x15, 0x95, 0x5A, 0x1D, 0x17,
+    0x9D, 0xB8, 0x0E, 0xAD, 0xFB, 0x63, 0xD4, 0x62, 0x88, 0x16, 0x21, 0xB5, 0x98, 0xA4, 0x7D, 0xC5,
+    0x8D, 0x5E, 0x5C, 0xA2, 0xF6, 0x19, 0x2A, 0x7A, 0x74, 0xE0, 0xD7, 0xFD, 0xB5, 0xA8, 0x10, 0x70,
+    0x48, 0x9B, 0xCF, 0x00, 0x57, 0x85, 0xBF, 0xBB, 0xB5, 0x23, 0x5A, 0xDA, 0x46, 0x4D, 0xCE, 0x57,
+    0xC9, 0x85, 0xBA, 0x77, 0xA1, 0xF5, 0xB6, 0x47, 0xA9, 0x37, 0x13, 0x99, 0x57, 0x03, 0x19, 0xC8,
+    0x31, 0x92, 0x69, 0xF0, 0xD6, 0xA8, 0x13, 0xAC, 0x80, 0xD2, 0x92, 0xF8, 0x42, 0xEC, 0x00, 0x73,
+    0x23, 0x5D, 0x97, 0xF9, 0xB4, 0x5B, 0x49, 0x06, 0x5A, 0xAB, 0x9F, 0x06, 0xD2, 0xB1, 0xF6, 0xAF,
+    0x1D, 0x10, 0x13, 0xD4, 0xA0, 0xC4, 0x96, 0x1D, 0xC1, 0x2B, 0x01, 0xBC, 0x06, 0x68, 0x5C, 0x6C,
+    0x43, 0xEE, 0xB9, 0x04, 0xEA, 0x51, 0xAE, 0x2D, 0x2A, 0xCE, 0x10, 0x95, 0x88, 0x48, 0xE2, 0x10,
+    0x60, 0xBE, 0x05, 0x16, 0x35, 0x7B, 0x2C, 0xF2, 0x5B, 0xD7, 0x98, 0x1E, 0x18, 0x3F, 0xC0, 0x9F,
+    0xCF, 0xF0, 0xFB, 0x76, 0xA4, 0xC3, 0x2F, 0x1E, 0xFE, 0xD3, 0xA1, 0xFC, 0x1F, 0x65, 0x56, 0xA2,
+    0xA8, 0xC8, 0xDF, 0xD7, 0xE9, 0xC2, 0xC7, 0x74, 0xFB, 0x22, 0x92, 0xCE, 0x96, 0x6F, 0xA5, 0x2A,
+    0x72, 0x68, 0x21, 0x2A, 0x7B, 0x9E, 0x9C, 0xC8, 0x90, 0xBC, 0x60, 0x45, 0x90, 0xA2, 0xCB, 0x60,
+    0x27, 0x83, 0x6E, 0xC9, 0x33, 0x5E, 0x66, 0xA2, 0xCC, 0x8C, 0x32, 0xC3, 0x8F, 0x8F, 0xE4, 0xCC,
+    0x70, 0x46, 0x49, 0x82, 0xC2, 0x19, 0x3B, 0x6D, 0xA3, 0x09, 0x03, 0xB1, 0xB8, 0x84, 0xB7, 0xBB,
+    0x62, 0x6B, 0xC4, 0xB6, 0xF8, 0x1D, 0x3C, 0x19, 0xD7, 0xFA, 0x8B, 0xA8, 0x49, 0x0C, 0xBD, 0x7E,
+    0xCE, 0x12, 0x8E, 0x05, 0x5D, 0x60, 0x9B, 0x9C, 0x45, 0xD1, 0x94, 0x8F, 0x4A, 0x6E, 0x20, 0x4A,
+    0x78, 0xD1, 0xA1, 0x7F, 0x93, 0x9A, 0x1E, 0xAD, 0xA5, 0x56, 0x58, 0xA9, 0xB7, 0x99, 0xFF, 0x2F,
+    0x9A, 0xF6, 0x9B, 0x03, 0x6C, 0x3B, 0x43, 0xE3, 0x43, 0x34, 0x09, 0x20, 0x5E, 0x22, 0xFA, 0x2C,
+    0x37, 0x85, 0x5D, 0x53, 0xBE, 0x01, 0x79, 0xC5, 0xA0, 0xD1, 0xAA, 0xCE, 0x67, 0x21, 0x13, 0x56,
+    0x91, 0xF4, 0xFA, 0x61, 0xCC, 0x4F, 0x8B, 0xF5, 0xA5, 0x10, 0xDA, 0xFB, 0x4A, 0xA2, 0x88, 0x56,
+    0x69, 0x6E, 0xE8, 0xB3, 0xAB, 0x25, 0x45, 0x2E, 0xD5, 0x92, 0x1D, 0x41, 0xAE, 0x38, 0x77, 0x6E,
+    0x19, 0xD3, 0xE7, 0x54, 0xA3, 0x35, 0xCD, 0xD2, 0x49, 0xB1, 0x13, 0x77, 0xC9, 0x28, 0xDD, 0x11,
+    0x4D, 0x44, 0x63, 0x1D, 0xFC, 0x1D, 0xA5, 0xCE, 0x75, 0x90, 0x12, 0xA3, 0xF9, 0x63, 0x95, 0x6B,
+    0x4C, 0xAF, 0x87, 0xE2, 0xB8, 0x48, 0xA6, 0x39, 0xA9, 0xC2, 0x55, 0xA2, 0x44, 0x72, 0x41, 0xE0,
+    0xF2, 0xFA, 0x39, 0xDA, 0x9B, 0xD9, 0x04, 0x7B, 0xB7, 0x5E, 0x6C, 0xE6, 0xAF, 0x7F, 0x9B, 0x3E,
+    0xFD, 0x28, 0xFF, 0xEB, 0xE6, 0x9A, 0x17, 0xB7, 0x1C, 0x13, 0x5D, 0xBD, 0x8D, 0xB0, 0x1B, 0xC8,
+    0xFB, 0x7C, 0xE5, 0x7D, 0xA2, 0x5F, 0x32, 0xBF, 0xC7, 0xA3, 0x5E, 0xB2, 0xA3, 0xBE, 0x9F, 0x71,
+    0x24, 0x0F, 0xBD, 0xB9, 0xFF, 0x72, 0x3C, 0x75, 0x1F, 0xFC, 0xF8, 0xFB, 0x74, 0xC5, 0x84, 0x4F,
+    0x9E, 0xBE, 0x03, 0x0D, 0xF7, 0x96, 0x1B, 0x9B, 0xC9, 0x36, 0x08, 0xE4, 0x6E, 0xE2, 0xE6, 0xBA,
+    0x2B, 0xBF, 0x63, 0xBA, 0x26, 0xBB, 0x5C, 0x31, 0x9A, 0xE7, 0xBD, 0xE6, 0x46, 0x9C, 0x80, 0x0C,
+    0x36, 0x68, 0xF0, 0x72, 0xA7, 0xC1, 0x10, 0x4C, 0x07, 0x0F, 0xCA, 0x47, 0x92, 0x3F, 0x39, 0x90,
+    0x68, 0x77, 0xF9, 0x2A, 0x65, 0x49, 0x09, 0x07, 0x33, 0xE0, 0xB2, 0x71, 0x7D, 0x5E, 0x26, 0x8E,
+    0xA0, 0x36, 0x56, 0x53, 0xFE, 0x86, 0x93, 0xBB, 0x20, 0x5E, 0x2A, 0xFD, 0x9D, 0xEE, 0xCB, 0xA1,
+    0x2E, 0xE2, 0x87, 0x55, 0x40, 0x97, 0x7C, 0xBB, 0x88, 0xED, 0xF1, 0xFB, 0x3C, 0x1D, 0x3E, 0x09,
+    0xD2, 0x85, 0x7C, 0x31, 0x50, 0x11, 0x9F, 0x5E, 0xEF, 0xDC, 0x1E, 0x8A, 0xF5, 0x62, 0x18, 0xAC,
+    0xBA, 0xF4, 0xC8, 0x9F, 0xBD, 0x55, 0xBF, 0x6F, 0xD5, 0x56, 0x14, 0x3E, 0xB6, 0x9B, 0x98, 0xC4,
+    0x52, 0x6F, 0x06, 0x22, 0x21, 0x50, 0xB9, 0x1D, 0x3A, 0x45, 0x95, 0xBC, 0x74, 0xC8, 0xD0, 0xE4,
+    0xBA, 0x62, 0x60, 0xC8, 0x40, 0x06, 0x9E, 0x3A, 0xB2, 0x46, 0x1D, 0x1A, 0x06, 0x46, 0xC2, 0x73,
+    0xE0, 0x0F, 0xE8, 0xFB, 0x13, 0x3A, 0x42, 0x32, 0xD0, 0x4A, 0x1D, 0x2A, 0x95, 0xC4, 0x4E, 0x32,
+    0x30, 0x30, 0xD4, 0x90, 0xAD, 0x93, 0x11, 0x48, 0x51, 0x59, 0xB8, 0x6D, 0x1E, 0x92, 0xDB, 0x5C,
+    0xDF, 0xD3, 0xEF, 0xF8, 0xBD, 0x17, 0x85, 0xD0, 0xA5, 0x4B, 0xAF, 0x64, 0xE7, 0xDD, 0xE3, 0xF3,
+    0xF3, 0x3B, 0xDF, 0x39, 0x99, 0x09, 0x2C, 0xAB, 0xF6, 0x4A, 0x45, 0x77, 0x62, 0x9F, 0xDA, 0xBF,
+    0x93, 0x8C, 0xA6, 0xC2, 0x95, 0xE6, 0xF6, 0x45, 0xC2, 0x99, 0x2D, 0x5C, 0xCA, 0xAE, 0xEF, 0x1F,
+    0x4E, 0x0F, 0xBC, 0x3E, 0x6C, 0x4D, 0x99, 0xEC, 0x5B, 0xA3, 0xF6, 0x5D, 0xA1, 0x8E, 0x5D, 0xF2,
+    0xC0, 0x2F, 0xBF, 0x72, 0x69, 0x06, 0x35, 0xE5, 0x88, 0x33, 0x6D, 0xA3, 0x96, 0x8A, 0x5C, 0xD9,
+    0xC8, 0x53, 0x98, 0x5F, 0xA5, 0x36, 0x7E, 0x02, 0xCF, 0x0F, 0x86, 0xF8, 0x9E, 0x94, 0xAD, 0x2A,
+    0xFB, 0x35, 0xE7, 0x3B, 0x44, 0x91, 0xD5, 0xE5, 0x6E, 0x34, 0xD4, 0x65, 0x11, 0x0D, 0x29, 0xE5,
+    0x43, 0x76, 0xE6, 0xF1, 0xD3, 0x97, 0xCD, 0x4E, 0x9A, 0x19, 0xD2, 0x9B, 0xAD, 0xAE, 0x12, 0x86,
+    0xDC, 0x11, 0x79, 0xB1, 0x23, 0xFA, 0x89, 0xC8, 0x64, 0x64, 0x44, 0x37, 0xD7, 0x2F, 0x9C, 0x2A,
+    0x55, 0x95, 0xEC, 0x1F, 0xFA, 0xA5, 0x7B, 0x27, 0xCF, 0xBE, 0x6B, 0x7E, 0x5E, 0xA6, 0xEE, 0xF4,
+    0xF9, 0x80, 0x79, 0x6A, 0x95, 0xA6, 0xB7, 0x87, 0x05, 0x1F, 0x31, 0x23, 0xA9, 0xB8, 0xB6, 0xE6,
+    0x60, 0xFF, 0xC4, 0xAB, 0x1B, 0x76, 0x49, 0x4B, 0x92, 0xF3, 0xBD, 0x9E, 0x61, 0x6F, 0xB8, 0xA5,
+    0xAB, 0x71, 0x7D, 0x57, 0xAD, 0x3C, 0xB7, 0x73, 0x6B, 0xB3, 0xF7, 0x1B, 0x73, 0xDD, 0xEE, 0x2A,
+    0x24, 0xC1, 0xB6, 0xE0, 0x0A, 0x6A, 0x9A, 0x5F, 0xB0, 0x5B, 0xBE, 0x75, 0x50, 0x35, 0x1B, 0xB7,
+    0x56, 0xD8, 0x32, 0x53, 0xF8, 0x36, 0x63, 0xF7, 0xC9, 0x2F, 0xFB, 0xBF, 0x2E, 0x2E, 0x1E, 0x41,
+    0x61, 0xE6, 0x33, 0x9D, 0x7F, 0x19, 0xD9, 0xC5, 0x9A, 0xA6, 0xAF, 0xBD, 0x7C, 0xD5, 0xFE, 0x78,
+    0xEC, 0xEE, 0xAC, 0xA1, 0xAC, 0xCD, 0xE1, 0x3D, 0x33, 0x23, 0xF6, 0x80, 0x23, 0x23, 0x95, 0x4B,
+    0xF2, 0xC1, 0x2A, 0xFD, 0xCB, 0x49, 0x57, 0x2A, 0x75, 0x60, 0xE3, 0x3F, 0x5C, 0xE4, 0x98, 0x14,
+    0x5B, 0xC3, 0x9B, 0xBE, 0x55, 0x02, 0x6C, 0x49, 0xDF, 0x14, 0xA5, 0x61, 0x97, 0x30, 0xE7, 0x63,
+    0xE5, 0x82, 0x6B, 0xCD, 0x3E, 0x7A, 0xB3, 0x25, 0xAE, 0xD2, 0xB8, 0x72, 0x26, 0xAE, 0x9B, 0xF4,
+    0xBA, 0xFC, 0xB5, 0x8E, 0xB4, 0x4F, 0x50, 0xB9, 0x0D, 0x1B, 0x6A, 0x69, 0x61, 0x6C, 0x31, 0x85,
+    0xE7, 0x36, 0x05, 0x27, 0xDF, 0x92, 0x76, 0x0D, 0x31, 0x57, 0xF1, 0x5B, 0x26, 0x7D, 0x54, 0x4B,
+    0x66, 0xF4, 0x05, 0x32, 0x05, 0xA8, 0x9F, 0x13, 0x05, 0x28, 0x56, 0x41, 0xF2, 0x03, 0xA0, 0x02,
+    0x3C, 0x73, 0x23, 0x63, 0x25, 0x48, 0x25, 0x82, 0x43, 0x64, 0xF1, 0x0A, 0xDC, 0x87, 0xE9, 0xCF,
+    0x67, 0xC1, 0x4D, 0x62, 0x4F, 0xBC, 0xC9, 0x6C, 0xFB, 0xA5, 0x20, 0x5F, 0x73, 0xD5, 0xE7, 0x3A,
+    0xB5, 0x21, 0x0F, 0xA4, 0x65, 0x63, 0xDB, 0x87, 0x13, 0x8B, 0xD0, 0x87, 0xB9, 0x69, 0xF5, 0xFD,
+    0xA6, 0x75, 0xEA, 0x39, 0xD7, 0x53, 0x81, 0x17, 0x69, 0xC0, 0xE1, 0xF7, 0x9A, 0x55, 0xE9, 0x36,
+    0x76, 0x63, 0xCB, 0xB0, 0xD8, 0x9D, 0xE8, 0xDF, 0xA4, 0xB8, 0xA2, 0x0B, 0xF4, 0x9F, 0x4F, 0x50,
+    0x52, 0x8A, 0x4A, 0x2E, 0xAA, 0xAC, 0x9C, 0x13, 0xFA, 0x7E, 0x0A, 0xA7, 0xF1, 0x5E, 0x43, 0xD3,
+    0x6D, 0xC0, 0x82, 0xE8, 0x3A, 0x0F, 0x88, 0x2E, 0xFB, 0x01, 0x01, 0x5F, 0x41, 0x6C, 0xBA, 0x4D,
+    0x00, 0xF3, 0xC6, 0x25, 0x51, 0x3D, 0xE7, 0xAA, 0x0A, 0x7A, 0xBD, 0xDE, 0xD7, 0x43, 0x05, 0x3B,
+    0xE1, 0x06, 0x8F, 0x1A, 0x12, 0xD5, 0xF2, 0xED, 0x23, 0x79, 0xC5, 0x52, 0x62, 0x2A, 0xC5, 0xF2,
+    0x7B, 0xB5, 0x9E, 0x39, 0x1A, 0x3C, 0x8C, 0x80, 0x11, 0x19, 0xFE, 0x7D, 0xA4, 0x2F, 0x15, 0xAA,
+    0x6A, 0x0C, 0x6B, 0x0A, 0x9E, 0xE3, 0xB3, 0x90, 0xB7, 0xA6, 0xC4, 0x8E, 0x3D, 0xA9, 0x77, 0xBD,
+    0x2C, 0x90, 0xF4, 0x10, 0x34, 0x8F, 0xE4, 0x47, 0xBF, 0xA3, 0x33, 0x99, 0x6B, 0x16, 0x76, 0x88,
+    0xA8, 0xAC, 0xD8, 0x3C, 0x6B, 0x28, 0x78, 0xB4, 0x30, 0x38, 0x17, 0x72, 0xF6, 0x31, 0x97, 0xA0,
+    0x8C, 0xA7, 0x2E, 0xAE, 0x84, 0xA2, 0xBE, 0x34, 0x40, 0xE2, 0xA9, 0xBA, 0x1B, 0x14, 0x4B, 0xA1,
+    0x14, 0xA3, 0x30, 0x07, 0x64, 0x06, 0x93, 0x6F, 0x12, 0xDE, 0xBC, 0xD9, 0x42, 0x53, 0xD8, 0x09,
+    0x3C, 0x92, 0x34, 0x97, 0x02, 0xDB, 0xA4, 0x87, 0xF8, 0x59, 0xA7, 0x78, 0x6D, 0xB2, 0xDF, 0x7A,
+    0x44, 0x66, 0x42, 0x8E, 0x44, 0xBC, 0x62, 0x40, 0x61, 0xE9, 0x33, 0xB1, 0xC4, 0xAC, 0x7A, 0x96,
+    0x5A, 0x5A, 0xD4, 0x2C, 0x23, 0x9E, 0x83, 0xD6, 0x2D, 0x0C, 0x22, 0x1B, 0x35, 0x94, 0xEE, 0x21,
+    0x41, 0x9F, 0xB4, 0x14, 0x35, 0x69, 0x7E, 0x9A, 0xB6, 0x20, 0x2A, 0x5C, 0xC4, 0xD4, 0x74, 0x33,
+    0x1F, 0x57, 0x1F, 0x22, 0x09, 0xD7, 0x95, 0x54, 0xD5, 0x45, 0x2D, 0x24, 0x68, 0x3E, 0x02, 0x53,
+    0x90, 0x8D, 0xDC, 0x18, 0xBE, 0x3E, 0x84, 0x69, 0x35, 0x2A, 0x48, 0x84, 0x1D, 0xD5, 0x04, 0xBF,
+    0xF9, 0xAC, 0xF3, 0xB4, 0xFE, 0x1A, 0x86, 0xA8, 0x4E, 0xFB, 0xA2, 0x8C, 0x84, 0x03, 0x1E, 0x15,
+    0x00, 0xD4, 0x85, 0xE8, 0xAF, 0xDE, 0x2A, 0xD0, 0xF1, 0x00, 0x06, 0x6B, 0xA0, 0x9D, 0x34, 0x8A,
+    0xB3, 0xF5, 0xA1, 0x16, 0x14, 0xA4, 0x7C, 0x35, 0x6A, 0x07, 0x5C, 0x16, 0x7E, 0x92, 0xDA, 0x15,
+    0x70, 0x4A, 0xB0, 0x8C, 0x04, 0x54, 0xAE, 0xE6, 0x48, 0xD7, 0x63, 0x4C, 0x85, 0x1C, 0x21, 0xBF,
+    0x96, 0xEC, 0x9B, 0x11, 0xF0, 0x20, 0x20, 0x64, 0x5A, 0x3E, 0x9A, 0xF2, 0xE3, 0x2C, 0x76, 0x11,
+    0x6F, 0x73, 0x3E, 0x06, 0xB6, 0x81, 0x2B, 0x28, 0xA7, 0x39, 0xD2, 0x36, 0x39, 0x80, 0xEB, 0x0B,
+    0xB6, 0x2D, 0xA9, 0x32, 0x98, 0x08, 0x32, 0xB0, 0x04, 0xA3, 0x5C, 0x87, 0x9E, 0x4C, 0x25, 0x31,
+    0xD2, 0xA4, 0x8C, 0xB0, 0x05, 0x8A, 0xB4, 0x54, 0xC7, 0xCD, 0xF9, 0x2D, 0x93, 0x77, 0x00, 0x00,
+    0x25, 0x98, 0x0A, 0x0B, 0xA4, 0x53, 0xA8, 0x0B, 0xDD, 0x08, 0xCE, 0xC8, 0xB3, 0x8E, 0x7A, 0x80,
+    0x0E, 0x79, 0xC3, 0x2F, 0x1C, 0x8F, 0xB2, 0x87, 0xFE, 0xB0, 0xCB, 0x73, 0x8C, 0x61, 0x47, 0xD0,
+    0xEE, 0xD6, 0x9E, 0xDE, 0xF2, 0xF1, 0x4D, 0x4D, 0x6E, 0xE1, 0xFB, 0xB7, 0x53, 0x66, 0x21, 0xCA,
+    0xA5, 0x04, 0x37, 0x54, 0x4A, 0xB1, 0x50, 0x4A, 0x5A, 0x20, 0x3B, 0xE4, 0xF4, 0x6C, 0x6D, 0x4B,
+    0xDB, 0x3B, 0xB6, 0x61, 0xFF, 0xE1, 0xED, 0x64, 0xD6, 0xA2, 0x5A, 0xF6, 0x91, 0xA6, 0xBB, 0x22,
+    0x08, 0xDF, 0x65, 0x22, 0x90, 0xE6, 0x75, 0xF6, 0x2E, 0xB4, 0xAA, 0x84, 0xA0, 0x34, 0x98, 0xFA,
+    0x65, 0x72, 0xE4, 0x82, 0xA1, 0xB6, 0x71, 0x2D, 0x1C, 0xE4, 0xCC, 0x70, 0x13, 0x3B, 0x09, 0x61,
+    0xF2, 0x33, 0xA0, 0x2C, 0x75, 0xC8, 0x64, 0xB2, 0xA0, 0x4B, 0xEC, 0xC1, 0xC8, 0x06, 0x18, 0xAA,
+    0x86, 0x9E, 0x10, 0xED, 0xC0, 0x05, 0x99, 0xAD, 0xA2, 0x14, 0x02, 0x70, 0x1D, 0xCB, 0xC8, 0x87,
+    0x96, 0x9A, 0xA4, 0x76, 0xB4, 0x11, 0x34, 0xCB, 0x88, 0xB1, 0x0B, 0xC3, 0xBD, 0x02, 0x86, 0xCC,
+    0x07, 0x16, 0xA3, 0xB1, 0x27, 0xDB, 0x35, 0x5B, 0xEB, 0x1C, 0xCB, 0x8A, 0xB8, 0x81, 0xE7, 0x29,
+    0x9E, 0x3F, 0x59, 0xBA, 0x29, 0x85, 0xC7, 0xCD, 0x18, 0x93, 0xAE, 0xAE, 0xDF, 0x06, 0x42, 0x64,
+    0x1A, 0x11, 0xF9, 0x2B, 0x18, 0x23, 0x64, 0x91, 0xEB, 0xCC, 0x54, 0x49, 0x85, 0xFF, 0x9A, 0x36,
+    0x76, 0x81, 0x43, 0x0B, 0xC0, 0xB5, 0x2C, 0xCD, 0xE9, 0x7F, 0x3B, 0xFF, 0x00, 0x65, 0x95, 0xBF,
+    0xAE, 0xD5, 0x46, 0x10, 0xC6, 0xC7, 0xB6, 0xC0, 0x12, 0x2E, 0xB6, 0xA2, 0x81, 0xC2, 0x3D, 0xCD,
+    0xBE, 0x40, 0xA2, 0x35, 0x4A, 0x99, 0x82, 0x14, 0x41, 0x29, 0xF3, 0x08, 0xBC, 0x40, 0x24, 0x5B,
+    0xA4, 0x48, 0x19, 0x1E, 0x82, 0x22, 0xBA, 0xCD, 0x6D, 0xD3, 0x70, 0x6D, 0x44, 0x41, 0x91, 0x02,
+    0x2B, 0x14, 0x69, 0x1D, 0x29, 0x52, 0x0A, 0x8A, 0x2C, 0xC8, 0x12, 0xE6, 0x5E, 0xDB, 0x93, 0xDF,
+    0xAC, 0xCF, 0x05, 0x94, 0x1C, 0xE9, 0xF8, 0x78, 0xFF, 0xCD, 0x7E, 0xDF, 0x37, 0xDF, 0xCC, 0x11,
+    0x91, 0x2C, 0x8A, 0x88, 0x6B, 0x78, 0x2C, 0x7C, 0xAB, 0x81, 0xC7, 0x6D, 0x39, 0x3E, 0xE1, 0xF1,
+    0x2E, 0xD9, 0x5A, 0x47, 0xA9, 0x26, 0x65, 0xF4, 0x20, 0x32, 0xD2, 0x46, 0xDC, 0x9B, 0x99, 0x51,
+    0xDF, 0x49, 0xAE, 0x1C, 0x71, 0xCA, 0x91, 0x76, 0x15, 0x46, 0x93, 0x8D, 0x46, 0x46, 0x4C, 0x15,
+    0xCA, 0xC3, 0xFD, 0xAD, 0x9D, 0xF4, 0x0F, 0xB4, 0x2B, 0x56, 0xA7, 0x4D, 0x1D, 0x3D, 0xA7, 0xC5,
+    0xDB, 0x15, 0xE9, 0x11, 0xEC, 0x71, 0xA7, 0x3B, 0x2E, 0x6B, 0xF9, 0xE6, 0x8B, 0xB4, 0x9D, 0x1B,
+    0x8B, 0x8D, 0x51, 0x88, 0xF9, 0x5A, 0xE8, 0xE0, 0x26, 0xBF, 0x4B, 0xB8, 0xAF, 0x33, 0x40, 0x74,
+    0xA8, 0xA6, 0x5D, 0x01, 0xF2, 0x66, 0xC9, 0xD6, 0x3E, 0x8C, 0xD5, 0xD5, 0x5B, 0x46, 0xFA, 0xF5,
+    0x2A, 0xBA, 0x84, 0xA9, 0xD4, 0xE7, 0xDA, 0xF8, 0xD5, 0x31, 0x1A, 0x43, 0x2C, 0xF7, 0x5C, 0x4F,
+    0x91, 0xA5, 0xBE, 0xBF, 0x82, 0xCE, 0x90, 0x1B, 0x44, 0xFF, 0x97, 0xFC, 0xFF, 0x73, 0xEB, 0x89,
+    0xFC, 0x22, 0xBD, 0x84, 0xA6, 0x8C, 0x65, 0xE4, 0x67, 0x95, 0x62, 0xF5, 0x9D, 0xF8, 0x17, 0x70,
+    0xDE, 0x9E, 0x9D, 0x58, 0x2A, 0xBC, 0xAB, 0xDD, 0xB0, 0x32, 0x28, 0x4D, 0xAE, 0xDE, 0xA8, 0x8C,
+    0x92, 0x9D, 0xC3, 0x3F, 0xA0, 0x51, 0x91, 0xC4, 0x18, 0x2D, 0xE2, 0x1D, 0xB9, 0xF9, 0xA4, 0x88,
+    0x62, 0x54, 0x1C, 0xB8, 0xB3, 0x95, 0x57, 0xDF, 0xB9, 0xA1, 0x80, 0x89, 0x04, 0x5E, 0xAB, 0x58,
+    0xCC, 0xB2, 0x1F, 0xCB, 0xF1, 0xF3, 0x65, 0x55, 0x15, 0xAF, 0x1A, 0x91, 0x90, 0xCB, 0x6A, 0x58,
+    0xE4, 0x96, 0xA3, 0xC0, 0xB7, 0x98, 0x3E, 0x41, 0xDE, 0x8E, 0xBB, 0xA5, 0x34, 0x44, 0x89, 0x18,
+    0x68, 0xCA, 0xF7, 0x6C, 0xDD, 0xD8, 0xEA, 0x7F, 0x8C, 0x52, 0xC4, 0xD0, 0xC8, 0xCE, 0x2D, 0x7E,
+    0x08, 0x1D, 0xD1, 0x16, 0x21, 0xF4, 0x40, 0x68, 0x84, 0xE5, 0x45, 0xE1, 0x58, 0x4F, 0x12, 0x5E,
+    0x43, 0xD6, 0x82, 0x49, 0x89, 0x46, 0x1E, 0x92, 0x0C, 0x40, 0x2E, 0x35, 0x5C, 0xFA, 0xA7, 0x70,
+    0xDA, 0xA1, 0xBF, 0x49, 0x28, 0x97, 0x6C, 0x29, 0xC6, 0x6A, 0xAC, 0x25, 0x3C, 0x44, 0x64, 0x1D,
+    0x4B, 0x66, 0x3D, 0x2A, 0x27, 0xBF, 0xB4, 0x7B, 0x93, 0x5F, 0x9E, 0x37, 0xAE, 0xA9, 0xE5, 0x0B,
+    0xF9, 0x21, 0x8F, 0xE5, 0xE8, 0x38, 0x18, 0xB4, 0x83, 0x4F, 0x57, 0x75, 0xAE, 0xF9, 0x52, 0xBC,
+    0x44, 0x59, 0xCB, 0xE1, 0xD1, 0x04, 0x04, 0xCE, 0x2F, 0x44, 0x6E, 0x8E, 0x04, 0x71, 0x71, 0x45,
+    0x40, 0x60, 0x99, 0x12, 0x87, 0xAE, 0x01, 0xE2, 0xCE, 0xF8, 0x01, 0xA5, 0xB0, 0x49, 0xB5, 0x5B,
+    0xBA, 0x83, 0xB4, 0x3B, 0x4D, 0x66, 0x89, 0x3C, 0x51, 0x6E, 0x1F, 0x91, 0x08, 0x02, 0xA4, 0xF5,
+    0xB0, 0x5F, 0xC0, 0x4F, 0xD5, 0x84, 0x06, 0x1B, 0x74, 0xDC, 0xD0, 0x4A, 0xB6, 0x54, 0xF0, 0x6D,
+    0x36, 0xE8, 0x41, 0xEE, 0x22, 0x5F, 0xE1, 0x18, 0x86, 0xBB, 0xDB, 0x77, 0x1B, 0xD4, 0x35, 0xB6,
+    0xAA, 0xE9, 0x85, 0x9D, 0xC5, 0xCC, 0xB5, 0xFD, 0x67, 0x06, 0x29, 0x4F, 0xF0, 0xB8, 0xE1, 0x69,
+    0xF2, 0xAA, 0xFF, 0x0C, 0x5E, 0x32, 0x97, 0xDD, 0xD8, 0x92, 0x07, 0xB3, 0x76, 0x82, 0xB7, 0x3D,
+    0xFC, 0x26, 0x3B, 0x44, 0x37, 0x1D, 0xB4, 0xAB, 0x0D, 0x1C, 0x10, 0x0B, 0x8D, 0x38, 0xDF, 0x2D,
+    0x61, 0x73, 0x18, 0xAA, 0x7D, 0xA1, 0x2F, 0x4C, 0xF0, 0x35, 0x2C, 0xBD, 0x91, 0xFB, 0x43, 0xBF,
+    0x27, 0x97, 0x99, 0xF6, 0xEF, 0x8D, 0xB3, 0xBB, 0x52, 0xA3, 0x2D, 0xBD, 0x45, 0x4F, 0x28, 0xE6,
+    0x54, 0x99, 0x9A, 0x12, 0x56, 0x1C, 0xB3, 0x59, 0x32, 0x4A, 0xDA, 0x34, 0xA7, 0xC5, 0x74, 0x51,
+    0xBD, 0xB7, 0xAF, 0x38, 0x5B, 0xE9, 0x4F, 0x4B, 0x6B, 0x82, 0x4C, 0xFD, 0x57, 0xA8, 0xAB, 0x8B,
+    0x8B, 0x35, 0x39, 0xCB, 0xBE, 0x65, 0x6A, 0x66, 0xEF, 0x90, 0x09, 0xFE, 0xAE, 0x46, 0xB9, 0xB9,
+    0x9A, 0x85, 0x0B, 0x98, 0xDC, 0x79, 0x76, 0x18, 0xA0, 0xCD, 0x9A, 0x7A, 0xF2, 0xE7, 0x1B, 0xF4,
+    0x86, 0xC0, 0xD9, 0xFE, 0x54, 0x39, 0x66, 0x0C, 0xB9, 0x90, 0x7A, 0xC2, 0x5A, 0x94, 0xF5, 0x40,
+    0xC9, 0xF5, 0x82, 0x5F, 0x97, 0x4A, 0xA9, 0xDE, 0x16, 0xCB, 0x97, 0x1A, 0xF3, 0x25, 0xF4, 0x83,
+    0x7B, 0x7D, 0x89, 0xC3, 0xFD, 0xAB, 0x39, 0xDF, 0xD7, 0x76, 0x70, 0xFA, 0x3B, 0xF5, 0xBA, 0xBB,
+    0x25, 0x43, 0xEB, 0xB1, 0x42, 0x08, 0x09, 0xB3, 0x5B, 0x33, 0xED, 0xFA, 0x8F, 0xBE, 0xFE, 0xB5,
+    0x9C, 0x8C, 0x96, 0xE1, 0x9E, 0x4F, 0xDE, 0x36, 0x86, 0xA6, 0x05, 0x45, 0x84, 0x90, 0x8D, 0xB3,
+    0x02, 0xA2, 0x15, 0x44, 0xC7, 0xF1, 0xAE, 0x5F, 0x84, 0x9C, 0x8D, 0x25, 0xC9, 0xC3, 0xF3, 0x57,
+    0x94, 0x51, 0x38, 0x9F, 0xCA, 0x77, 0xF4, 0x29, 0xFF, 0xCF, 0x4B, 0xF6, 0x6D, 0x9E, 0x3A, 0x9A,
+    0x4C, 0xFC, 0x72, 0x93, 0x3E, 0x06, 0x46, 0x8D, 0x0E, 0xF5, 0x62, 0x75, 0x5C, 0x2C, 0x7E, 0x92,
+    0xFA, 0x39, 0x97, 0x5D, 0x90, 0xB0, 0x62, 0xE6, 0xA5, 0x7E, 0xC5, 0xAD, 0x7B, 0xDF, 0x48, 0x71,
+    0x45, 0x7D, 0x9B, 0xB9, 0x05, 0x37, 0xA1, 0x3B, 0x94, 0x7D, 0xF2, 0xDA, 0x66, 0xA3, 0x54, 0xEE,
+    0x3C, 0xF6, 0x16, 0x87, 0xCD, 0xE4, 0x38, 0x0C, 0x74, 0x28, 0xCD, 0x0D, 0x33, 0xD9, 0xC0, 0x04,
+    0xEC, 0x3B, 0x3C, 0xF8, 0x78, 0xC5, 0x22, 0x78, 0x59, 0x31, 0x8A, 0x9B, 0x7A, 0xA8, 0x38, 0xF3,
+    0x08, 0xCB, 0x33, 0x4E, 0x69, 0x31, 0xB1, 0x9B, 0x58, 0xDE, 0xCA, 0x59, 0x1E, 0x0D, 0xBD, 0xD4,
+    0xE4, 0xA7, 0x50, 0x88, 0xDE, 0xEB, 0xAE, 0x3B, 0x23, 0x35, 0xDA, 0x37, 0x68, 0xDC, 0x0E, 0x26,
+    0x18, 0x29, 0x1C, 0xC2, 0x22, 0xFD, 0xEC, 0x29, 0xC9, 0xAD, 0x56, 0x6A, 0xF3, 0x67, 0xD4, 0xD0,
+    0x2B, 0x9D, 0x8A, 0x4B, 0x7D, 0x4F, 0xF5, 0xF6, 0x1F, 0xD8, 0xEB, 0xD7, 0x5E, 0xFC, 0x6F, 0x5B,
+    0xE8, 0xDC, 0x9F, 0xEA, 0xC6, 0x72, 0x6E, 0x2B, 0xFA, 0xA9, 0x95, 0x0C, 0x24, 0x77, 0xAB, 0xD8,
+    0xDB, 0x47, 0x22, 0x77, 0xB0, 0x64, 0x44, 0x1A, 0x58, 0xA5, 0x49, 0x90, 0xC9, 0xA6, 0xC0, 0xB2,
+    0x02, 0x1C, 0x85, 0x1A, 0x40, 0x5C, 0xCC, 0x37, 0xA9, 0x23, 0x2D, 0xC2, 0x4F, 0x56, 0x1D, 0x24,
+    0x0E, 0x62, 0xEE, 0xFA, 0xD1, 0xD5, 0x97, 0x67, 0x88, 0x0D, 0xAC, 0x26, 0x4C, 0xB9, 0xD2, 0xFD,
+    0x0A, 0x73, 0x6C, 0xBD, 0x25, 0x43, 0x46, 0x2B, 0x49, 0xC6, 0xDA, 0x21, 0xB5, 0x36, 0x29, 0xBE,
+    0xF5, 0x59, 0x5A, 0xEB, 0xC0, 0xED, 0x24, 0x11, 0xE1, 0xD7, 0xC2, 0x44, 0x07, 0x05, 0x8B, 0x2C,
+    0xB7, 0x83, 0xFF, 0x70, 0x43, 0x27, 0xBB, 0x26, 0x62, 0xBD, 0xE4, 0x52, 0x24, 0x2E, 0xED, 0x81,
+    0xB0, 0x4F, 0xAE, 0xAD, 0x42, 0x17, 0xE9, 0x40, 0x60, 0xA0, 0x66, 0xD0, 0xAF, 0xA9, 0x99, 0x86,
+    0xC6, 0x77, 0x38, 0x72, 0xA4, 0xBB, 0x62, 0xC8, 0xD4, 0x56, 0x4F, 0xD3, 0xDC, 0xE7, 0xA6, 0x2A,
+    0x96, 0x73, 0xB1, 0xE4, 0x36, 0x0D, 0x54, 0x44, 0xB8, 0x41, 0xDF, 0xB8, 0x75, 0xD6, 0xA4, 0x2E,
+    0x97, 0x59, 0xDD, 0x5C, 0x1C, 0xED, 0x19, 0x6D, 0xAC, 0x6D, 0xD7, 0xD6, 0x85, 0xAD, 0x25, 0x03,
+    0x5C, 0xAD, 0x40, 0x66, 0xA9, 0x2F, 0x1B, 0x84, 0x39, 0xB5, 0x1F, 0xA3, 0x6A, 0x65, 0x1B, 0x30,
+    0x70, 0x3D, 0x7F, 0xEC, 0x16, 0xD9, 0xF9, 0x6E, 0xC4, 0x27, 0x1A, 0xC2, 0x6A, 0x38, 0x87, 0xD2,
+    0x7A, 0x94, 0x9E, 0x36, 0x96, 0xA9, 0x9B, 0x59, 0xFF, 0x98, 0x4F, 0x21, 0xFC, 0x6C, 0x4D, 0x64,
+    0xBC, 0x9B, 0xFA, 0x7E, 0xFA, 0x03, 0x70, 0xC7, 0xE9, 0x13, 0xA8, 0x7B, 0x67, 0x67, 0x67, 0x0F,
+    0x98, 0x7E, 0xC9, 0xF7, 0x9D, 0x9A, 0x10, 0xCE, 0xE2, 0xD8, 0xA9, 0xEB, 0xCE, 0x68, 0xED, 0xB2,
+    0xFE, 0x6F, 0x67, 0x44, 0xCD, 0xF4, 0x2F, 0xCB, 0x7F, 0xB8, 0x54, 0x8B, 0x9C, 0xFA, 0xFC, 0xA7,
+    0xCF, 0xBF, 0x5D, 0x55, 0x3D, 0x6F, 0xDD, 0x36, 0x14, 0xBD, 0x14, 0x91, 0x08, 0x08, 0x07, 0x2E,
+    0xCD, 0x12, 0x0F, 0xDC, 0x8D, 0x36, 0xFA, 0x03, 0x79, 0xA6, 0xD2, 0x25, 0x43, 0x96, 0x0C, 0x75,
+    0x0A, 0xB4, 0x43, 0x97, 0x2E, 0x5D, 0xEA, 0x35, 0x43, 0xFC, 0xC4, 0xC4, 0x43, 0xC7, 0xFC, 0x85,
+    0x0E, 0x5D, 0x6A, 0x14, 0xC9, 0xEA, 0xC1, 0xB6, 0x98, 0x78, 0xC8, 0x90, 0xA1, 0x6C, 0x96, 0x0E,
+    0x5D, 0x08, 0xF4, 0x0B, 0x88, 0x07, 0x13, 0x09, 0x81, 0xD0, 0x00, 0x25, 0xF6, 0x50, 0x76, 0x32,
+    0x54, 0x82, 0x84, 0xF7, 0x24, 0xDD, 0x7B, 0x0F, 0xCF, 0x3D, 0xF7, 0x90, 0x7E, 0xA6, 0x6B, 0x46,
+    0x04, 0x1E, 0x69, 0xC0, 0xC9, 0xA3, 0xB4, 0xA4, 0x1F, 0x27, 0x6A, 0xB2, 0x26, 0x52, 0x7F, 0x38,
+    0xA2, 0x92, 0x89, 0x64, 0xE9, 0x89, 0x46, 0x4F, 0xD4, 0xE2, 0x0F, 0x0D, 0x86, 0x48, 0x04, 0x22,
+    0x36, 0x11, 0xDD, 0x28, 0x96, 0x78, 0xC1, 0x1F, 0x8D, 0x37, 0x2D, 0x1E, 0x2C, 0x07, 0x1B, 0x8B,
+    0x97, 0xA5, 0xE4, 0xEE, 0x4E, 0x58, 0xDD, 0x92, 0x61, 0xF5, 0x40, 0xFA, 0xC3, 0xA3, 0x9D, 0xD3,
+    0x3C, 0x94, 0x12, 0x75, 0x29, 0x5E, 0x15, 0x24, 0x1C, 0x91, 0xB3, 0xD0, 0x72, 0xB1, 0x99, 0xA8,
+    0x41, 0x30, 0xAF, 0xE9, 0x65, 0xA0, 0xCE, 0xD2, 0xD0, 0xA3, 0x04, 0x4F, 0x0C, 0x4F, 0xB4, 0x1D,
+    0x7A, 0x6A, 0x66, 0x05, 0x30, 0xF2, 0x7D, 0xAA, 0x11, 0xF8, 0x9C, 0x04, 0x2A, 0xE3, 0x1D, 0x4A,
+    0x53, 0x5B, 0xFF, 0x53, 0x45, 0x41, 0xBA, 0x22, 0x95, 0x15, 0x33, 0x9F, 0xC7, 0x8A, 0xFE, 0xE5,
+    0x5C, 0x3F, 0xC2, 0x67, 0x32, 0x37, 0xC5, 0xF0, 0x42, 0x0A, 0xEF, 0x54, 0xAF, 0x48, 0x5A, 0x69,
+    0x79, 0xE0, 0x9E, 0x25, 0x16, 0xE9, 0x88, 0x0E, 0x49, 0xE3, 0x54, 0x56, 0x19, 0xE1, 0x85, 0xE3,
+    0x91, 0x07, 0xCA, 0x38, 0x07, 0x1A, 0xA9, 0x33, 0xDA, 0x48, 0x27, 0x1D, 0x2F, 0x65, 0x66, 0xA5,
+    0x14, 0xC2, 0x65, 0xAE, 0x6F, 0x7F, 0x83, 0xF4, 0x2D, 0x6A, 0x82, 0x3A, 0xA2, 0x2F, 0x96, 0x75,
+    0x6F, 0xD1, 0x61, 0x6B, 0xA5, 0x39, 0x60, 0x51, 0x52, 0xC7, 0x02, 0x0F, 0x9F, 0xD1, 0x9A, 0x5B,
+    0xE9, 0xB6, 0x36, 0x32, 0x82, 0x6D, 0x57, 0x12, 0x8D, 0x4F, 0x7A, 0x42, 0x41, 0xEA, 0x10, 0x88,
+    0xE0, 0x35, 0xD1, 0xF1, 0x95, 0xDB, 0x89, 0x47, 0x7D, 0xD7, 0xAB, 0xE7, 0x20, 0x7D, 0x14, 0x3E,
+    0xF3, 0xA4, 0xEF, 0x78, 0xE9, 0x72, 0xD7, 0x0F, 0x6D, 0xC8, 0x4D, 0xEA, 0xF6, 0x82, 0x74, 0x47,
+    0xCA, 0x68, 0x1E, 0x8E, 0x58, 0x96, 0x27, 0x41, 0xF8, 0x5D, 0x69, 0xF5, 0xE7, 0x61, 0xAB, 0x42,
+    0x89, 0x6D, 0x59, 0x72, 0x03, 0xD8, 0xF6, 0xF6, 0x36, 0x80, 0x7C, 0x47, 0xF4, 0xD3, 0xC7, 0x84,
+    0xFD, 0x28, 0x02, 0x12, 0xA2, 0x13, 0xD2, 0xE6, 0xCE, 0x0C, 0x3C, 0x4C, 0x4D, 0x52, 0x4B, 0x42,
+    0x59, 0x13, 0xEE, 0xB2, 0x24, 0x5F, 0x04, 0xE1, 0xD6, 0x48, 0xD8, 0xC4, 0x25, 0xE1, 0x7C, 0xA7,
+    0xD4, 0xDE, 0xE1, 0xE6, 0xF7, 0xF7, 0xF7, 0x47, 0xAC, 0xAB, 0xA9, 0xAC, 0xCB, 0xCA, 0xF7, 0x31,
+    0x5D, 0xFF, 0x8A, 0xDA, 0x02, 0xB5, 0xD4, 0xB6, 0x85, 0xBA, 0x64, 0xE2, 0x20, 0x62, 0xFD, 0x05,
+    0x1A, 0x12, 0x11, 0xED, 0x64, 0x7F, 0xCC, 0x62, 0xEB, 0x3B, 0x9A, 0x78, 0xD8, 0xB1, 0x43, 0x49,
+    0x62, 0x61, 0xAC, 0xBF, 0x94, 0x06, 0x09, 0x5F, 0xEF, 0xDA, 0x32, 0xDC, 0x67, 0x5A, 0x2D, 0xFC,
+    0x21, 0x8F, 0xB2, 0x2D, 0xF2, 0x8F, 0x4B, 0xBE, 0x48, 0xB1, 0x96, 0x6B, 0xFF, 0xEE, 0xC1, 0x7F,
+    0x57, 0x1C, 0x4F, 0x4B, 0x62, 0xCF, 0x1D, 0x16, 0xD0, 0xAB, 0x7E, 0xDD, 0x64, 0x3A, 0x84, 0x54,
+    0xC3, 0x52, 0xC1, 0xA8, 0x32, 0x37, 0x33, 0x8D, 0x25, 0xC8, 0xC8, 0xCB, 0x54, 0xC5, 0x73, 0x79,
+    0xDC, 0xA3, 0x9A, 0x28, 0x54, 0x9C, 0xDC, 0x57, 0x98, 0xC8, 0x08, 0x94, 0xB2, 0x4C, 0x00, 0x89,
+    0x34, 0xC0, 0xA8, 0xAF, 0x42, 0x94, 0x09, 0xB1, 0x1F, 0x10, 0xEE, 0x20, 0x42, 0x41, 0x3F, 0xAC,
+    0x3C, 0x4B, 0x48, 0x25, 0x03, 0x14, 0xA8, 0xDC, 0x35, 0x43, 0xBA, 0xA7, 0xED, 0xFB, 0x13, 0xC4,
+    0x0E, 0x9D, 0x41, 0xBF, 0x17, 0x64, 0x40, 0x01, 0x51, 0x4C, 0x34, 0x5A, 0xA8, 0x7A, 0xAA, 0xDC,
+    0x85, 0xA6, 0xF6, 0x01, 0x1D, 0xF1, 0xD4, 0x94, 0xF4, 0x01, 0xC8, 0x27, 0xF4, 0xB4, 0xA7, 0x87,
+    0x02, 0x91, 0xB9, 0x6A, 0x20, 0x8D, 0x8F, 0x32, 0x0B, 0x13, 0x1D, 0x36, 0x6F, 0x13, 0x16, 0x82,
+    0xC7, 0xB8, 0x79, 0x4A, 0x6D, 0x71, 0x2C, 0x42, 0xD7, 0x4D, 0x90, 0x4F, 0x6C, 0x1B, 0xA4, 0x0C,
+    0x3B, 0x4E, 0x61, 0x8E, 0xEC, 0xCD, 0xCA, 0xE1, 0xAA, 0x2E, 0xEE, 0x16, 0x8D, 0x3F, 0x7E, 0x64,
+    0x12, 0x31, 0x02, 0xCF, 0xD8, 0xF9, 0xD7, 0x8E, 0x76, 0x21, 0x56, 0x01, 0x49, 0x53, 0x66, 0x09,
+    0x64, 0x76, 0x86, 0x95, 0x2F, 0x23, 0x26, 0x01, 0x6D, 0x1A, 0x17, 0xC4, 0x33, 0x78, 0x1D, 0x3C,
+    0xCD, 0x1C, 0x0C, 0x39, 0x6D, 0x79, 0xC6, 0x2C, 0x8F, 0xB6, 0x58, 0x95, 0x64, 0x6A, 0xF6, 0x6F,
+    0xEF, 0x5F, 0x2C, 0x7F, 0x5C, 0x63, 0x84, 0xBC, 0x3C, 0x9D, 0x80, 0xC1, 0x22, 0xA7, 0x30, 0xD2,
+    0x02, 0x35, 0xE4, 0xFC, 0xA8, 0x54, 0xE6, 0x4A, 0x5F, 0xD7, 0x38, 0x0F, 0x1F, 0x30, 0x30, 0x84,
+    0x6D, 0x58, 0xC0, 0x70, 0x68, 0x94, 0x47, 0x6C, 0x20, 0x0D, 0x39, 0xD4, 0x1E, 0xC8, 0xB3, 0x54,
+    0x89, 0xB0, 0x60, 0x04, 0xFD, 0xFB, 0xAD, 0xA0, 0xE7, 0xDA, 0x2A, 0x27, 0x43, 0x1B, 0xDA, 0xC4,
+    0x26, 0x94, 0xD7, 0x00, 0x25, 0xEA, 0x30, 0x63, 0x11, 0x74, 0xF5, 0xAF, 0x3A, 0xC3, 0x55, 0x58,
+    0x06, 0xA3, 0x23, 0xCD, 0x83, 0xD6, 0xED, 0x36, 0x0B, 0xA9, 0x76, 0xC5, 0xA2, 0xA2, 0x09, 0xC5,
+    0x41, 0xFE, 0xED, 0xFA, 0x3D, 0x56, 0x54, 0xE7, 0x49, 0xBE, 0xD9, 0x87, 0x40, 0xE0, 0x12, 0x28,
+    0x06, 0x55, 0x55, 0x97, 0xC8, 0x8B, 0x7F, 0xA0, 0xD4, 0xE2, 0x29, 0x02, 0xCD, 0xDC, 0x84, 0x5B,
+    0xA1, 0x6B, 0x19, 0x57, 0x22, 0x71, 0x0A, 0x4E, 0x4E, 0x40, 0xC7, 0x0F, 0xC0, 0x09, 0x25, 0x0E,
+    0xD2, 0xB1, 0x09, 0x4A, 0x8B, 0xCA, 0x56, 0x6F, 0xC2, 0x15, 0x70, 0xB9, 0x01, 0x0C, 0xAE, 0xA9,
+    0xBB, 0xA0, 0x44, 0x20, 0x0C, 0x6B, 0x3E, 0x57, 0xFD, 0xF1, 0xFD, 0x04, 0x10, 0x8F, 0xB1, 0x1E,
+    0xBD, 0xBD, 0x4C, 0xAF, 0x7E, 0xF3, 0x94, 0x57, 0x65, 0x22, 0x7B, 0x77, 0x0E, 0xF4, 0x0D, 0x84,
+    0x3F, 0x18, 0x91, 0xB4, 0x99, 0x14, 0x0A, 0xBC, 0xCE, 0xEA, 0x25, 0x00, 0x95, 0xEE, 0x24, 0xA1,
+    0x0D, 0xED, 0x79, 0xD6, 0x03, 0x78, 0xE9, 0xCE, 0x5E, 0x2D, 0x56, 0x55, 0x72, 0xB5, 0x29, 0x50,
+    0x74, 0x56, 0x5D, 0x10, 0xF4, 0x2D, 0x9A, 0x12, 0x55, 0x48, 0x15, 0x30, 0xE0, 0x80, 0xDE, 0x72,
+    0x36, 0x83, 0x5A, 0x1A, 0x53, 0x79, 0x05, 0x81, 0xEA, 0x59, 0x26, 0x3D, 0xA1, 0x99, 0x06, 0x3C,
+    0xE0, 0xF5, 0xD8, 0xDF, 0x3C, 0x22, 0x72, 0xF4, 0x29, 0x81, 0xB4, 0x40, 0xC2, 0xF4, 0x51, 0x81,
+    0x24, 0xB7, 0x01, 0x2E, 0x33, 0xA6, 0x2B, 0xF3, 0x09, 0xE3, 0x9D, 0x9B, 0xD8, 0x65, 0x1E, 0xC6,
+    0xC4, 0xDF, 0xCE, 0xB1, 0x3D, 0x7D, 0x17, 0xC4, 0xD9, 0x49, 0x90, 0x05, 0x16, 0x33, 0x49, 0xA7,
+    0xE0, 0xF8, 0x9D, 0x57, 0x76, 0xD3, 0xDC, 0x30, 0xCB, 0x72, 0x0F, 0x5A, 0x8F, 0xE2, 0xCB, 0x34,
+    0x5F, 0xF8, 0x2A, 0x29, 0x0C, 0xD2, 0x01, 0x3C, 0x11, 0xB4, 0x48, 0x74, 0xED, 0xA1, 0xF6, 0xCD,
+    0x9F, 0xA5, 0x97, 0xDF, 0x1F, 0xD2, 0xFA, 0x1D, 0xF4, 0xAE, 0x8C, 0x8C, 0x13, 0xE9, 0x3D, 0x4C,
+    0x4A, 0x6D, 0xBB, 0xBA, 0xEB, 0x29, 0xAF, 0xA9, 0xFD, 0xDD, 0x53, 0x37, 0x2C, 0xAE, 0x2C, 0xCA,
+    0xE2, 0xD3, 0x0C, 0xEB, 0x93, 0xB8, 0xB6, 0x46, 0xDB, 0x44, 0x34, 0xEF, 0x39, 0x7E, 0x77, 0xA5,
+    0x3E, 0xE2, 0xAF, 0x3D, 0x0B, 0x91, 0x0E, 0x1E, 0xD2, 0xAA, 0x23, 0x25, 0x8D, 0xDC, 0x73, 0xFC,
+    0x35, 0x64, 0x92, 0x39, 0x0C, 0xE9, 0xDE, 0x15, 0x82, 0x3D, 0xAF, 0x69, 0xA2, 0x99, 0xCD, 0xCD,
+    0xC4, 0x4B, 0x0B, 0x2F, 0x95, 0xB9, 0x2D, 0x1D, 0x9C, 0x65, 0x1D, 0xE5, 0xB3, 0x39, 0xA8, 0x9D,
+    0xF7, 0xA1, 0xEB, 0xFE, 0xF5, 0x5A, 0xFD, 0xEA, 0xB4, 0x7A, 0xE2, 0x8E, 0xAF, 0x28, 0x94, 0xA9,
+    0x76, 0xDE, 0x4B, 0x23, 0x2C, 0xA0, 0xC3, 0x29, 0x30, 0x16, 0x19, 0x89, 0x8E, 0xAB, 0xCF, 0xF7,
+    0x75, 0x80, 0xC1, 0x74, 0x55, 0x11, 0xA4, 0x88, 0x8D, 0x6C, 0xC4, 0xA9, 0x0D, 0x64, 0x43, 0x1B,
+    0x4B, 0xBB, 0xB1, 0x7B, 0x98, 0x11, 0xBA, 0xB7, 0xF2, 0x45, 0x24, 0xD8, 0x72, 0xB7, 0x97, 0x54,
+    0x80, 0x5E, 0x9B, 0x2A, 0x3B, 0x08, 0xBD, 0x03, 0xC3, 0x70, 0x4A, 0x5C, 0x88, 0xBE, 0x0F, 0x8F,
+    0x66, 0x00, 0xDB, 0x24, 0x14, 0x8A, 0x90, 0x37, 0x0C, 0x5A, 0xC0, 0x61, 0xA5, 0x47, 0xBC, 0xC3,
+    0x9E, 0x82, 0x71, 0xD4, 0x76, 0xB3, 0xDF, 0xEC, 0x2F, 0x4C, 0x49, 0x9E, 0xD5, 0x5D, 0xAD, 0x76,
+    0xBF, 0xB8, 0x80, 0x3D, 0xB5, 0xC1, 0xF0, 0x38, 0xD1, 0x63, 0x27, 0x5C, 0x55, 0x31, 0x43, 0x9E,
+    0x5E, 0x58, 0x2A, 0xFF, 0x5C, 0xBA, 0x4D, 0x57, 0x87, 0xB8, 0xFE, 0x10, 0xE1, 0x5B, 0xC4, 0xA1,
+    0x4D, 0xEC, 0x72, 0x9F, 0x5C, 0x34, 0x7F, 0xE1, 0xCE, 0xCB, 0x01, 0xEC, 0x23, 0xD8, 0xF9, 0x05,
+    0xCA, 0x86, 0x13, 0x74, 0x8B, 0x69, 0x61, 0x1F, 0xD7, 0x8F, 0x51, 0xCD, 0xAA, 0xE2, 0xAE, 0x16,
+    0x43, 0xFF, 0x3B, 0xFE, 0x03, 0xAD, 0x55, 0x3D, 0x8C, 0x15, 0x55, 0x14, 0x3E, 0x33, 0xD7, 0xDD,
+    0x49, 0xBC, 0x09, 0xB7, 0x41, 0x8B, 0x25, 0x32, 0x95, 0x89, 0x41, 0x71, 0x1A, 0x0B, 0x8A, 0xDD,
+    0x77, 0x07, 0xB6, 0xA0, 0xB0, 0x80, 0x42, 0x0B, 0x63, 0x81, 0xA5, 0xB1, 0xA1, 0xD9, 0x82, 0x90,
+    0x85, 0xB9, 0x5B, 0x59, 0x50, 0x48, 0x21, 0xD4, 0x14, 0x14, 0x64, 0x2D, 0xA0, 0xA0, 0xA0, 0xD8,
+    0xF7, 0xE6, 0xC2, 0x16, 0xB6, 0x43, 0x81, 0xAD, 0x83, 0x09, 0x8D, 0x14, 0x5E, 0x61, 0x30, 0x83,
+    0xB9, 0xF3, 0x8E, 0xDF, 0x99, 0x79, 0x85, 0x26, 0x5A, 0x18, 0x9D, 0xE4, 0xE6, 0xCD, 0x9B, 0x99,
+    0x73, 0xCE, 0xF7, 0x9D, 0x9F, 0xEF, 0x58, 0xE6, 0x43, 0xE6, 0x78, 0xB9, 0xFA, 0xCE, 0xA9, 0x40,
+    0x74, 0x95, 0x48, 0x37, 0x44, 0x03, 0x51, 0xEE, 0x29, 0x8D, 0x44, 0xD6, 0x51, 0xD6, 0x11, 0xD5,
+    0x44, 0x6F, 0xDE, 0x22, 0xA2, 0x48, 0xB6, 0xB4, 0x65, 0xEE, 0x74, 0x30, 0x3E, 0x89, 0xBA, 0x25,
+    0xBB, 0x1D, 0xC8, 0xFC, 0xD4, 0x91, 0x1A, 0xF0, 0x71, 0x2D, 0x76, 0x4C, 0xA4, 0x70, 0x88, 0x1D,
+    0x51, 0xE1, 0x89, 0x4C, 0x8B, 0x13, 0x28, 0xAD, 0x3B, 0x4A, 0xB8, 0xC7, 0x47, 0x38, 0x16, 0xCF,
+    0x70, 0x6D, 0x22, 0x1A, 0xB3, 0xCB, 0x98, 0x39, 0xE1, 0x0B, 0x37, 0x7B, 0xBB, 0xD7, 0x99, 0xEF,
+    0xDB, 0x82, 0xE2, 0x81, 0x0A, 0xF9, 0x35, 0x7F, 0x55, 0x75, 0x73, 0xDD, 0xB0, 0xBC, 0x6E, 0x2C,
+    0x73, 0x47, 0x17, 0xC5, 0xBE, 0x80, 0xA1, 0x40, 0x25, 0x8B, 0x93, 0x89, 0xA3, 0xA3, 0xE2, 0xAB,
+    0xA2, 0xA2, 0x34, 0x4D, 0xE1, 0xD2, 0xBE, 0x70, 0x64, 0x01, 0xDB, 0x00, 0x40, 0xC2, 0x00, 0x60,
+    0xE5, 0x80, 0x43, 0x05, 0x54, 0xD5, 0xDD, 0x86, 0xAA, 0xC3, 0x48, 0xB5, 0x67, 0x77, 0xC2, 0x81,
+    0x92, 0xEA, 0x15, 0xA8, 0xE4, 0xAE, 0xA2, 0x79, 0x2A, 0xB7, 0x8D, 0xF1, 0x16, 0x59, 0x88, 0x69,
+    0x97, 0xE1, 0xB6, 0x40, 0x10, 0x44, 0xDF, 0x46, 0x86, 0x72, 0xE6, 0x56, 0xA2, 0x50, 0x0A, 0x0C,
+    0xA6, 0xA1, 0xB5, 0x64, 0xDB, 0x3D, 0xF5, 0x3B, 0xED, 0xE6, 0x47, 0xF9, 0x3B, 0xF9, 0xD7, 0xDC,
+    0xF0, 0x3D, 0xD0, 0x39, 0x42, 0x99, 0x53, 0xFD, 0x46, 0x16, 0x90, 0x96, 0x79, 0x16, 0x2A, 0xE3,
+    0x17, 0xBA, 0x8D, 0xA6, 0x19, 0x72, 0x17, 0xCD, 0xA3, 0x2E, 0x7F, 0x18, 0x2D, 0xF0, 0x6D, 0x07,
+    0x9B, 0x86, 0xAB, 0x4A, 0x68, 0xD5, 0xF0, 0x6C, 0x70, 0xE3, 0xC7, 0x7C, 0xFC, 0x1B, 0xD3, 0x08,
+    0x53, 0xFE, 0x06, 0x47, 0x52, 0x21, 0xF9, 0x06, 0xA6, 0xB1, 0x62, 0x74, 0xA2, 0xAC, 0x83, 0x82,
+    0xC7, 0x23, 0x44, 0x3B, 0x94, 0x7A, 0x32, 0x4B, 0xAA, 0x96, 0x69, 0xBB, 0x6B, 0xCE, 0x84, 0xAD,
+    0x8B, 0x7B, 0x1C, 0xB5, 0x54, 0x46, 0xAE, 0x35, 0x09, 0xD9, 0x1E, 0xA5, 0x24, 0x18, 0xA2, 0x03,
+    0xE5, 0x68, 0x96, 0x34, 0x64, 0xCA, 0x40, 0x99, 0xB7, 0x7D, 0x1A, 0x72, 0x76, 0xBD, 0x3E, 0x13,
+    0xAE, 0x28, 0xFF, 0xA0, 0x28, 0x7F, 0x9D, 0x1B, 0x5F, 0x71, 0x16, 0x8A, 0x65, 0xD2, 0x8F, 0xC6,
+    0x49, 0x09, 0xBE, 0xCA, 0xD3, 0x25, 0xD2, 0x25, 0x71, 0x6B, 0xF8, 0x61, 0xBB, 0xBB, 0x95, 0x1D,
+    0xFE, 0xD0, 0x57, 0xBC, 0x0A, 0xF0, 0x19, 0x65, 0xDC, 0xEA, 0x12, 0x9F, 0xEF, 0x12, 0x6D, 0xD1,
+    0x57, 0xF3, 0x94, 0xA3, 0x74, 0x50, 0xD6, 0x5D, 0xAE, 0x5B, 0x94, 0xBD, 0x98, 0x1C, 0x09, 0x08,
+    0x5F, 0x39, 0xF5, 0x88, 0x43, 0x76, 0xED, 0x55, 0xA7, 0xCF, 0x95, 0x97, 0xCC, 0x82, 0x2E, 0x99,
+    0x48, 0xF7, 0xF3, 0x48, 0xE1, 0x24, 0x7A, 0x61, 0x73, 0x71, 0xA1, 0x39, 0x55, 0xB3, 0xDF, 0xB1,
+    0x4C, 0xF7, 0xF4, 0xCA, 0xAC, 0xEE, 0x92, 0xE5, 0x82, 0x3A, 0xED, 0x36, 0xD3, 0x60, 0xDC, 0x81,
+    0xFA, 0xBD, 0x26, 0xCB, 0xDE, 0x70, 0xA7, 0x1F, 0x2F, 0x55, 0xB0, 0x7B, 0xD1, 0x04, 0xDE, 0x8E,
+    0xB6, 0x41, 0x6E, 0xD2, 0xDB, 0x34, 0x76, 0xB1, 0x1C, 0xDD, 0xD1, 0x3F, 0x5C, 0xB5, 0xA3, 0x82,
+    0x7D, 0xFA, 0x3A, 0x2F, 0x8B, 0x1B, 0x0B, 0x94, 0xBD, 0x47, 0x6F, 0xB6, 0xF6, 0x53, 0x81, 0x4C,
+    0x6A, 0xB9, 0x0F, 0x8A, 0x5C, 0x1A, 0x50, 0xD0, 0xCB, 0x52, 0xF2, 0xD6, 0x53, 0x71, 0xAD, 0xA5,
+    0xC1, 0x96, 0xFA, 0xB7, 0xE1, 0xEF, 0xDC, 0x15, 0x2D, 0x9A, 0x3B, 0xD0, 0xE2, 0x6C, 0xA3, 0x9F,
+    0x5D, 0x74, 0x96, 0x97, 0x29, 0x5C, 0x9A, 0x27, 0xE5, 0xD8, 0xB7, 0xBC, 0xFF, 0x00, 0x45, 0x6C,
+    0x70, 0x28, 0xE5, 0xEB, 0xD3, 0xD0, 0xE1, 0x79, 0x82, 0x26, 0x07, 0x4F, 0xC5, 0x37, 0xC6, 0xA8,
+    0xD9, 0xF3, 0x1E, 0x9C, 0x7A, 0xE2, 0xE7, 0x41, 0x77, 0xDA, 0x5B, 0x87, 0xD1, 0xA0, 0xA8, 0x43,
+    0xD6, 0xE2, 0xF6, 0xF4, 0x20, 0xB7, 0x3A, 0x58, 0x6F, 0xF7, 0x18, 0x35, 0x96, 0xC1, 0x52, 0x2C,
+    0x41, 0xE1, 0xE7, 0xFC, 0x0A, 0x84, 0x01, 0xD4, 0x03, 0x38, 0x42, 0x7F, 0xCD, 0xF0, 0xF7, 0x3C,
+    0xA2, 0x49, 0x8E, 0x98, 0xEC, 0xFE, 0x9D, 0x24, 0x4E, 0xC3, 0x89, 0x59, 0x49, 0xC0, 0x40, 0x87,
+    0x69, 0x54, 0x60, 0x9E, 0xC9, 0x98, 0x01, 0xD1, 0xBE, 0xB8, 0x38, 0x86, 0x21, 0x67, 0x9A, 0xA5,
+    0x61, 0x46, 0xEF, 0xE5, 0x3F, 0x3B, 0x70, 0x52, 0x78, 0xD5, 0xAF, 0xDF, 0x02, 0x32, 0xA4, 0x23,
+    0xE1, 0x81, 0xD6, 0x56, 0xE1, 0x2A, 0x81, 0xEB, 0xB3, 0xE6, 0x0D, 0xA9, 0xB8, 0x7A, 0x0D, 0x31,
+    0x00, 0xAC, 0x63, 0xE2, 0xCC, 0xCF, 0x3E, 0x97, 0x3E, 0xC7, 0x20, 0x35, 0xEB, 0xC2, 0x57, 0x8A,
+    0xDE, 0x89, 0xC6, 0x30, 0xA9, 0x48, 0x1B, 0xD3, 0x13, 0xFA, 0x50, 0x58, 0xAB, 0x96, 0xF2, 0x12,
+    0xA0, 0x31, 0xE3, 0xB9, 0xA3, 0xF9, 0xF8, 0xEB, 0x21, 0x40, 0x32, 0x77, 0x69, 0x40, 0x37, 0x44,
+    0xFD, 0x22, 0x9A, 0x97, 0x71, 0xC5, 0xF0, 0xC1, 0x98, 0xA9, 0x9E, 0x92, 0x0E, 0x6F, 0xE5, 0x63,
+    0x48, 0x02, 0xB2, 0x69, 0xBC, 0x58, 0x41, 0x7F, 0x0A, 0x37, 0x35, 0x2B, 0x5D, 0x99, 0xB2, 0x1C,
+    0xFF, 0x5C, 0xA3, 0xF4, 0xFA, 0x24, 0x79, 0x7E, 0x7C, 0x8E, 0x70, 0x69, 0x18, 0xEB, 0x00, 0x0C,
+    0x42, 0x01, 0x4E, 0x68, 0x52, 0x1C, 0x11, 0x1C, 0x70, 0xC1, 0x54, 0xA1, 0x27, 0x45, 0xDE, 0x64,
+    0x76, 0xC8, 0xE2, 0x51, 0x85, 0xD4, 0xDD, 0xFF, 0x80, 0x28, 0x9C, 0x22, 0x6A, 0x67, 0xD7, 0x93,
+    0xA6, 0xEA, 0x95, 0x0F, 0xBB, 0xCA, 0x85, 0x5D, 0x7D, 0xFA, 0x69, 0x9F, 0xA7, 0x1C, 0x66, 0x8A,
+    0xDD, 0x97, 0xAB, 0x88, 0xBA, 0xFC, 0x82, 0x36, 0x31, 0x36, 0x41, 0xA4, 0x62, 0x07, 0x0D, 0xF7,
+    0x4A, 0x04, 0x26, 0x73, 0xA7, 0x4E, 0x9E, 0x4C, 0x9B, 0xFB, 0xC1, 0xE8, 0x43, 0x6F, 0x97, 0xC7,
+    0x13, 0x9E, 0x04, 0xF2, 0xBF, 0xB5, 0xC5, 0x43, 0x4E, 0x16, 0xE2, 0x05, 0x4C, 0x28, 0x4C, 0xA4,
+    0x84, 0xE9, 0xDA, 0x84, 0x24, 0xFF, 0x18, 0x85, 0x05, 0xE5, 0x2B, 0x48, 0xC0, 0x1C, 0x5E, 0xD1,
+    0xAB, 0x29, 0xF8, 0x09, 0xB9, 0x0C, 0xC7, 0xE0, 0xDE, 0xDC, 0x0D, 0x54, 0x9C, 0x83, 0xE6, 0xCB,
+    0x03, 0x59, 0x0A, 0x50, 0x7F, 0x18, 0x02, 0xD4, 0xFA, 0xED, 0xBF, 0xF4, 0x7A, 0x44, 0x72, 0xA2,
+    0x1A, 0x92, 0xDE, 0x40, 0x38, 0x8B, 0xA8, 0x42, 0xDD, 0xAB, 0x17, 0xCB, 0x2E, 0x7B, 0xFE, 0x32,
+    0xE8, 0x5F, 0x0E, 0x83, 0xE1, 0xB3, 0xAD, 0x19, 0x4C, 0x93, 0x77, 0x90, 0xD4, 0x36, 0xF7, 0x27,
+    0xDC, 0xC6, 0x4A, 0x82, 0xA8, 0xD7, 0x12, 0x72, 0x29, 0xF1, 0x00, 0x51, 0x0F, 0xFF, 0x34, 0x9C,
+    0xA8, 0x05, 0x1A, 0x46, 0x56, 0x0F, 0x5A, 0x21, 0xD2, 0xB8, 0x7B, 0x54, 0x87, 0xDC, 0xC8, 0xF2,
+    0x21, 0xFB, 0xA3, 0x9F, 0xB6, 0x4F, 0x22, 0x5E, 0xC6, 0xF5, 0x63, 0x44, 0x26, 0x64, 0xFF, 0x48,
+    0xDD, 0x64, 0x01, 0xD1, 0xFB, 0x5C, 0x4E, 0x1B, 0x68, 0xD4, 0xA7, 0x69, 0x05, 0xDD, 0x5A, 0x2F,
+    0x77, 0xD3, 0x76, 0x46, 0x9D, 0x29, 0x37, 0x33, 0x5F, 0x88, 0x92, 0xF4, 0xAA, 0xD9, 0x4A, 0x42,
+    0x4E, 0x07, 0xFA, 0x89, 0x08, 0x6D, 0x29, 0xE2, 0x1C, 0xC6, 0x5D, 0x75, 0x1C, 0x06, 0xEF, 0x8E,
+    0x3B, 0xA7, 0x60, 0x96, 0xF1, 0x7D, 0x7B, 0xF8, 0x04, 0x5B, 0x47, 0x3A, 0x19, 0xF5, 0x90, 0x35,
+    0x46, 0xF5, 0xCD, 0xCE, 0xB4, 0xA6, 0x1C, 0x92, 0xCE, 0x3C, 0xAB, 0x51, 0x59, 0x50, 0x1F, 0xF0,
+    0xE3, 0xD5, 0xAA, 0xA0, 0x6F, 0x4D, 0x2B, 0x6B, 0x3E, 0xF6, 0xD6, 0xC6, 0xF2, 0x8E, 0x92, 0x77,
+    0x62, 0xFE, 0x2D, 0x92, 0x3E, 0xA0, 0xC8, 0xC1, 0x04, 0x98, 0x03, 0xCF, 0xE3, 0x3A, 0x81, 0x79,
+    0x3E, 0x99, 0xAF, 0xAF, 0xCC, 0xFF, 0xFF, 0xEB, 0x0F, 0xAD, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14,
+    0xBD, 0xE3, 0x41, 0x6B, 0x09, 0x17, 0xD3, 0x40, 0x93, 0x14, 0xEE, 0x11, 0x30, 0x2D, 0xC5, 0x6A,
+    0x67, 0x44, 0x4A, 0x9A, 0x2D, 0xB2, 0xFF, 0x40, 0xB7, 0x3F, 0x00, 0x3B, 0x06, 0x8A, 0x14, 0x29,
+    0x36, 0x15, 0x75, 0x0A, 0xAA, 0xD4, 0x14, 0x14, 0xC9, 0x7A, 0x36, 0x5B, 0x6C, 0x89, 0x93, 0x08,
+    0x51, 0x20, 0x65, 0x8D, 0x12, 0x24, 0x20, 0x12, 0x3B, 0x02, 0xA3, 0x75, 0xB2, 0x63, 0x5F, 0xCE,
+    0xB5, 0x5F, 0x48, 0x1A, 0x04, 0x05, 0x96, 0x3D, 0xEF, 0xBD, 0xF1, 0xCC, 0x9D, 0x73, 0xCE, 0x3D,
+    0xF7, 0x3E, 0xA2, 0xE5, 0xB2, 0xCC, 0x1C, 0x09, 0xC3, 0x4C, 0x25, 0xC6, 0x91, 0xAA, 0x49, 0xB3,
+    0x27, 0x93, 0x5D, 0x4F, 0x64, 0x2E, 0xA6, 0x65, 0x49, 0x24, 0x79, 0xD9, 0x10, 0x05, 0x6E, 0x3D,
+    0x95, 0x7F, 0xE6, 0x03, 0x22, 0x77, 0x33, 0x65, 0xD2, 0xD9, 0x5D, 0x4B, 0x54, 0x77, 0xD9, 0x20,
+    0x46, 0x99, 0x9C, 0x37, 0x43, 0x68, 0x66, 0x22, 0xBF, 0xC4, 0x7E, 0x83, 0x64, 0xC7, 0x4C, 0x2D,
+    0x4F, 0xE4, 0xAE, 0x0D, 0x54, 0x9F, 0x45, 0xAA, 0x66, 0x09, 0x48, 0x74, 0xF9, 0xAC, 0xD1, 0x4F,
+    0x1E, 0xC5, 0xF2, 0xE4, 0x24, 0x9A, 0x9B, 0x27, 0xD1, 0x99, 0x1B, 0x1D, 0xBD, 0x76, 0xD9, 0x1E,
+    0x11, 0x35, 0xA7, 0xE0, 0xC9, 0xF1, 0xA3, 0x4C, 0x6A, 0x76, 0xDC, 0x93, 0x49, 0x0E, 0x5B, 0x5D,
+    0x0C, 0x89, 0xA8, 0x9D, 0xDE, 0x22, 0xAA, 0x11, 0x9D, 0x14, 0x73, 0x06, 0xD6, 0xE7, 0xD5, 0x48,
+    0xC4, 0x8D, 0x49, 0x54, 0x8E, 0x58, 0x23, 0x37, 0x16, 0xB3, 0xFC, 0x92, 0x89, 0x0E, 0x31, 0x0B,
+    0x4C, 0xB4, 0x3F, 0x85, 0x81, 0x8A, 0x85, 0x75, 0xB9, 0x6E, 0x64, 0xEE, 0x64, 0x14, 0xAA, 0xD5,
+    0xBC, 0x22, 0xBF, 0xAE, 0x70, 0x6E, 0xBA, 0x47, 0x15, 0x1F, 0x46, 0x95, 0xA1, 0x4A, 0xFD, 0x05,
+    0x03, 0xCE, 0x97, 0x1E, 0x67, 0x81, 0xD3, 0xB3, 0x11, 0x50, 0x0C, 0xDE, 0x50, 0x26, 0xEB, 0x4D,
+    0xD4, 0xA9, 0xC0, 0x09, 0x9F, 0xC9, 0x12, 0xA0, 0xB4, 0x12, 0x55, 0x80, 0x15, 0x9B, 0x68, 0xEB,
+    0x75, 0x35, 0x0A, 0x2F, 0x20, 0x27, 0x37, 0xB6, 0x18, 0x7E, 0xB6, 0x91, 0xEA, 0x58, 0x25, 0x32,
+    0x7D, 0x31, 0x21, 0x1E, 0xB5, 0xBE, 0x82, 0x46, 0x7D, 0x99, 0xA9, 0xCC, 0x7A, 0x02, 0xAD, 0x02,
+    0x31, 0xC2, 0x31, 0x0E, 0xAC, 0x13, 0xC4, 0xD7, 0x53, 0x8B, 0x08, 0x0B, 0x58, 0xC7, 0x49, 0x10,
+    0x63, 0xD0, 0xC0, 0x86, 0xC9, 0x2C, 0x51, 0xB1, 0x1A, 0x93, 0xAF, 0x0E, 0xAC, 0xB0, 0x92, 0x2D,
+    0x55, 0x4F, 0xEF, 0xD2, 0x27, 0x6A, 0xD0, 0x7D, 0xD9, 0x39, 0xAA, 0x3F, 0x1F, 0xE8, 0xA0, 0x06,
+    0x72, 0x1C, 0x22, 0x82, 0x8A, 0x9C, 0x83, 0xC8, 0x86, 0x54, 0xCA, 0x9E, 0xAD, 0x06, 0x94, 0xCC,
+    0x09, 0x8F, 0x2D, 0x7B, 0x9D, 0x68, 0x87, 0xD4, 0x2E, 0x66, 0xDF, 0x44, 0xEA, 0x31, 0x5F, 0xC3,
+    0x03, 0x50, 0x6E, 0xC0, 0xF9, 0x90, 0x55, 0x98, 0xB4, 0x72, 0x24, 0x8C, 0x42, 0x22, 0x5E, 0x0D,
+    0x78, 0x4B, 0x14, 0x27, 0x7E, 0x11, 0x5C, 0x30, 0x8B, 0x10, 0x93, 0x2C, 0xE0, 0x35, 0xD6, 0x69,
+    0x59, 0xF7, 0xF6, 0x46, 0x95, 0x8F, 0x97, 0xA0, 0xA4, 0x46, 0x18, 0x64, 0x00, 0xB1, 0x44, 0xF3,
+    0x9D, 0xDB, 0xD0, 0x94, 0xF4, 0xB8, 0x3E, 0x25, 0x90, 0x55, 0x69, 0x0D, 0x21, 0x8F, 0x44, 0xB0,
+    0x20, 0xF5, 0x8E, 0xC0, 0x01, 0x18, 0x5F, 0x41, 0x0D, 0x48, 0x9E, 0x64, 0x93, 0x60, 0x51, 0xE1,
+    0xBB, 0x3D, 0x64, 0x88, 0x7D, 0x8B, 0xF4, 0x16, 0x79, 0x73, 0x70, 0x68, 0xD6, 0x6D, 0x12, 0x42,
+    0xF0, 0x29, 0x11, 0x0A, 0x1E, 0x5F, 0xE3, 0x28, 0xCE, 0x05, 0x67, 0xDD, 0x11, 0x6E, 0xE8, 0x6A,
+    0x7F, 0xBD, 0x65, 0x1A, 0x32, 0x9E, 0x2C, 0x78, 0x10, 0x04, 0xF8, 0xBB, 0x4C, 0x22, 0x8C, 0xD2,
+    0xEB, 0xE7, 0x7B, 0xBB, 0x0B, 0x59, 0xB7, 0x21, 0x5C, 0x09, 0x2B, 0x24, 0x5B, 0x49, 0xE6, 0xDB,
+    0x4B, 0x18, 0x3D, 0xBA, 0xC6, 0x74, 0x65, 0x5F, 0x26, 0x35, 0xC0, 0x15, 0x19, 0xAB, 0x5B, 0x72,
+    0xA8, 0xA9, 0xFA, 0x58, 0xCC, 0x19, 0x56, 0xF2, 0x8A, 0xC7, 0x8A, 0xBB, 0x6D, 0x22, 0xB8, 0xF5,
+    0x17, 0x49, 0xDD, 0xB8, 0x5D, 0xC6, 0xF4, 0x1E, 0x9E, 0x49, 0x9F, 0xAE, 0x95, 0xC0, 0xB0, 0x3F,
+    0x5C, 0x6B, 0x46, 0xC7, 0xE2, 0xEC, 0x70, 0xC2, 0x0F, 0x67, 0x21, 0xE0, 0x72, 0xC0, 0xB9, 0xF6,
+    0x7B, 0x3E, 0x4C, 0xC2, 0xA5, 0xBD, 0x10, 0x9E, 0xE6, 0x92, 0x85, 0x11, 0x94, 0x14, 0x7F, 0x88,
+    0xB3, 0x45, 0x7F, 0x10, 0x12, 0xAE, 0x62, 0xCB, 0xB8, 0x1C, 0xCA, 0x8B, 0x3D, 0xDA, 0xF5, 0x2D,
+    0xB2, 0x08, 0xCC, 0x54, 0xCF, 0xE1, 0x07, 0xEC, 0xAD, 0xF8, 0x46, 0x76, 0x13, 0x96, 0xF6, 0xED,
+    0x7D, 0x1E, 0x81, 0xCF, 0x8C, 0x66, 0xD9, 0x05, 0x1F, 0xA7, 0x55, 0x04, 0xB7, 0x7E, 0xE8, 0x7E,
+    0xFD, 0x44, 0xFD, 0xD9, 0x8F, 0xB2, 0x23, 0xFD, 0x64, 0x86, 0x58, 0x99, 0xF7, 0x3D, 0xD5, 0xE1,
+    0xCC, 0xCB, 0x69, 0x8D, 0x18, 0xB5, 0x91, 0x24, 0xC5, 0x8D, 0x51, 0x97, 0x4A, 0xB5, 0xE7, 0xE7,
+    0x3D, 0x85, 0xD3, 0x27, 0x68, 0x09, 0xF7, 0x87, 0xB0, 0xD0, 0x5C, 0x42, 0x7F, 0xB0, 0xE9, 0x16,
+    0xEA, 0x3A, 0x36, 0x8B, 0xBD, 0xA2, 0xA2, 0x7B, 0x8B, 0x81, 0xB7, 0x32, 0x7E, 0x91, 0x74, 0xA4,
+    0x2B, 0x98, 0x80, 0x23, 0x29, 0x28, 0x5F, 0xF7, 0xF6, 0x7C, 0x82, 0x11, 0x23, 0xF2, 0xA5, 0xDA,
+    0xA7, 0x0B, 0x3E, 0xB7, 0xC1, 0xD5, 0xFA, 0xF7, 0xB1, 0xB0, 0xA3, 0x77, 0xE1, 0x69, 0x14, 0x5B,
+    0xD5, 0xF8, 0xA1, 0x86, 0x92, 0xFD, 0x55, 0x18, 0x7E, 0x69, 0x08, 0x09, 0x55, 0xE5, 0x9A, 0x85,
+    0xC7, 0x88, 0x05, 0xB5, 0xD4, 0x57, 0x0B, 0x6B, 0xE8, 0x41, 0x0A, 0xED, 0x5B, 0x58, 0x6E, 0x86,
+    0x6D, 0xF5, 0xE5, 0xB8, 0x69, 0x7C, 0x52, 0x5B, 0xA5, 0x7C, 0xB1, 0x8B, 0x6D, 0x26, 0xF9, 0x95,
+    0x45, 0x3C, 0x0C, 0x73, 0x40, 0xD4, 0x81, 0xA5, 0xDD, 0xF0, 0xB0, 0xCB, 0x05, 0x5F, 0x08, 0xA7,
+    0x5A, 0x82, 0xDF, 0x7D, 0x4D, 0xA8, 0x6D, 0x47, 0xD6, 0x92, 0xD9, 0xF7, 0xE5, 0x99, 0xD7, 0x90,
+    0x05, 0x77, 0xDB, 0xA0, 0xBF, 0x40, 0x14, 0xAA, 0xCE, 0x7B, 0xE8, 0xA7, 0x86, 0xF0, 0x18, 0x81,
+    0x3D, 0x15, 0xF1, 0x55, 0xFD, 0x66, 0x92, 0xBE, 0x10, 0x41, 0x09, 0x3E, 0xB2, 0x3D, 0x39, 0x8F,
+    0xD6, 0xA0, 0x2F, 0x04, 0xF0, 0xD1, 0x37, 0xF0, 0x80, 0x39, 0x3B, 0x1C, 0x48, 0xE5, 0xCB, 0xA5,
+    0xA3, 0x4A, 0x05, 0x4B, 0x69, 0xA2, 0xE1, 0x02, 0x6C, 0xF5, 0x87, 0x64, 0x7A, 0xDE, 0x71, 0xE8,
+    0x5C, 0x0F, 0x3E, 0xE4, 0x0E, 0xB5, 0x80, 0x52, 0x07, 0xED, 0x90, 0xB7, 0xBE, 0xA2, 0xE2, 0xCE,
+    0x2D, 0xFA, 0x9A, 0x46, 0x4A, 0x3A, 0x29, 0xB4, 0xB1, 0xE2, 0x37, 0xE4, 0xF0, 0xF1, 0x04, 0x5E,
+    0xC3, 0x92, 0x2B, 0x03, 0x56, 0x76, 0x9B, 0xE1, 0xFD, 0xB6, 0xF9, 0x54, 0x1A, 0x27, 0x84, 0xEA,
+    0x69, 0xFF, 0x47, 0xC9, 0xC3, 0xD9, 0x3F, 0x08, 0xD5, 0xFC, 0xBB, 0x50, 0xD5, 0x4B, 0xA1, 0xD0,
+    0xD8, 0x04, 0x28, 0xB2, 0x0B, 0xD4, 0x01, 0x7E, 0x9D, 0x96, 0xF4, 0xD5, 0x0D, 0x55, 0xE8, 0xF9,
+    0xBF, 0x67, 0xF5, 0x22, 0x53, 0x8B, 0xA5, 0xC0, 0x8E, 0x5D, 0xE8, 0x43, 0xC8, 0x32, 0xE8, 0x1C,
+    0x85, 0xE4, 0x0E, 0xE7, 0xFA, 0x01, 0x77, 0x86, 0x01, 0x28, 0xF0, 0x31, 0xAB, 0x3D, 0x36, 0xFF,
+    0x1B, 0x20, 0x37, 0x1E, 0x5C, 0xB9, 0xB7, 0x43, 0xB5, 0x23, 0xD3, 0x82, 0x29, 0xC9, 0x9F, 0x05,
+    0x7C, 0x07, 0x9B, 0x5A, 0xA4, 0xA1, 0x8D, 0xE5, 0x69, 0xD6, 0x89, 0xA5, 0x67, 0xD3, 0x4C, 0x36,
+    0x2A, 0x29, 0x75, 0xE8, 0xEA, 0x1A, 0xF4, 0x94, 0xE0, 0xD1, 0xAF, 0x58, 0x1A, 0x16, 0x32, 0x3A,
+    0xA0, 0xC1, 0x98, 0x84, 0xDC, 0xD5, 0x09, 0xFD, 0xCE, 0xF6, 0xC8, 0x0B, 0x77, 0x15, 0xAF, 0x1D,
+    0x64, 0x1D, 0x9A, 0xFA, 0xC5, 0x1D, 0xF6, 0x16, 0xBC, 0xBC, 0xC3, 0xBF, 0x52, 0x0E, 0xDD, 0xDA,
+    0xC8, 0xD5, 0xF0, 0xB2, 0xDC, 0x8A, 0xDB, 0x45, 0x2A, 0xE3, 0x0E, 0xDD, 0xD5, 0x9D, 0x69, 0xD0,
+    0xBE, 0xAB, 0x68, 0x69, 0xD4, 0x09, 0x65, 0x04, 0xE3, 0xF7, 0x8E, 0x27, 0x7C, 0x8F, 0x47, 0xC5,
+    0x64, 0x3A, 0xE8, 0x44, 0x95, 0xDF, 0x54, 0xD2, 0x7F, 0xBF, 0xFE, 0x02, 0xBD, 0x55, 0x31, 0x6F,
+    0x1D, 0x45, 0x10, 0x9E, 0xBB, 0x95, 0x7D, 0xC5, 0x49, 0x6C, 0x43, 0x84, 0x04, 0xC2, 0xD7, 0xA2,
+    0x00, 0xDA, 0x12, 0x0A, 0xDB, 0xBB, 0xE6, 0x95, 0x14, 0xA4, 0x88, 0x45, 0x49, 0x43, 0x81, 0x28,
+    0xA0, 0x49, 0x41, 0xE1, 0xF8, 0x4E, 0x4E, 0x41, 0x41, 0x61, 0x0B, 0x09, 0x51, 0x50, 0x90, 0xDA,
+    0x42, 0x72, 0x43, 0x91, 0xE2, 0xC5, 0xB7, 0x4E, 0xE3, 0xD2, 0xE7, 0x02, 0x68, 0x0F, 0x25, 0xA1,
+    0x20, 0xCD, 0x0A, 0x9D, 0x94, 0x95, 0x7D, 0xEF, 0x86, 0x6F, 0xF6, 0xD9, 0xC1, 0xBF, 0x80, 0x93,
+    0xDF, 0xEE, 0x9E, 0x77, 0x77, 0xE6, 0x9B, 0x99, 0xEF, 0x9B, 0xA3, 0xCA, 0x13, 0xF3, 0x82, 0x8C,
+    0xCF, 0x98, 0x47, 0xB2, 0x3E, 0x9F, 0xB6, 0xEF, 0x92, 0x6D, 0xD4, 0x48, 0x44, 0xAD, 0x53, 0x11,
+    0x13, 0x53, 0x39, 0xA4, 0x49, 0x07, 0xA2, 0x6C, 0x4A, 0x53, 0xBE, 0xA0, 0x0A, 0x93, 0x9A, 0x0E,
+    0xDB, 0x9E, 0xA8, 0x60, 0xE6, 0x8E, 0xA8, 0xC4, 0xE4, 0x89, 0xF4, 0x7F, 0x53, 0x43, 0x72, 0x8C,
+    0x1D, 0x91, 0x09, 0xB9, 0x4C, 0xB6, 0x57, 0x0C, 0x5B, 0x75, 0x97, 0xA6, 0x2C, 0x14, 0x3C, 0x68,
+    0x6F, 0x0E, 0x9B, 0x4D, 0x8A, 0x94, 0x0D, 0xAA, 0xA3, 0xD2, 0x1B, 0x9C, 0xA2, 0x91, 0xB2, 0xA8,
+    0x7A, 0xB1, 0xE8, 0xC8, 0x02, 0x1F, 0x40, 0x06, 0x2A, 0x7A, 0xA0, 0xB5, 0xEE, 0x98, 0xAE, 0x9F,
+    0x4A, 0x30, 0xCB, 0xA1, 0x09, 0x50, 0x58, 0xCE, 0xE2, 0x62, 0x0B, 0xDF, 0x35, 0x59, 0xA0, 0x33,
+    0x5E, 0x63, 0x5B, 0xF7, 0x85, 0x6C, 0x0F, 0x39, 0x30, 0x66, 0x23, 0xC9, 0xE1, 0x16, 0x36, 0x5B,
+    0x6F, 0x9B, 0x6A, 0x54, 0x83, 0xEE, 0xCA, 0x05, 0x3D, 0x2E, 0x06, 0x00, 0x32, 0x5B, 0xD8, 0x6E,
+    0xB4, 0x6F, 0x81, 0xAF, 0x0C, 0xB6, 0x31, 0xC1, 0x62, 0x5B, 0x8F, 0x55, 0x2C, 0x82, 0xE2, 0xF2,
+    0x19, 0xDD, 0x7C, 0x78, 0x89, 0x6A, 0xA4, 0x7C, 0x2C, 0x47, 0x52, 0xB1, 0x8C, 0xF0, 0xA1, 0x07,
+    0x2A, 0x02, 0x22, 0x2E, 0x7B, 0x13, 0x48, 0x77, 0xB6, 0xA7, 0xCA, 0xDB, 0x0E, 0x40, 0x6A, 0x3E,
+    0xB0, 0x4D, 0xCB, 0xC3, 0x2D, 0xE2, 0xCB, 0x51, 0x72, 0x89, 0x00, 0x47, 0x0C, 0x79, 0xC4, 0xA0,
+    0x06, 0x0C, 0x45, 0x28, 0x22, 0x95, 0xA1, 0xC6, 0xBD, 0xBE, 0xED, 0x30, 0x4C, 0xD7, 0x9E, 0x56,
+    0x64, 0x90, 0xA8, 0x32, 0xEE, 0xDB, 0x26, 0xE7, 0x0B, 0x1E, 0x33, 0xFE, 0x71, 0x6A, 0x1D, 0xAB,
+    0x58, 0x74, 0x9C, 0xC7, 0x3C, 0xD4, 0x34, 0x66, 0xA3, 0x69, 0x8E, 0x69, 0x01, 0xA7, 0x5B, 0x13,
+    0x80, 0x9C, 0xB3, 0x9B, 0x90, 0x92, 0x60, 0x3B, 0x60, 0x94, 0x52, 0xF0, 0x96, 0x0C, 0x4D, 0x95,
+    0x92, 0xF5, 0xE6, 0xC1, 0xB5, 0x71, 0xA0, 0xA0, 0x62, 0x32, 0x5D, 0x31, 0xF1, 0x42, 0x0D, 0xBB,
+    0x7A, 0x16, 0x36, 0x54, 0x37, 0x98, 0x2C, 0xCC, 0xF5, 0xD6, 0x60, 0xD5, 0x79, 0xD4, 0x27, 0x17,
+    0x3C, 0x8B, 0x16, 0xAE, 0x99, 0xA3, 0x96, 0x3A, 0x7F, 0xE5, 0x5E, 0x5D, 0x3E, 0xBA, 0x90, 0x1C,
+    0xF4, 0xD4, 0x22, 0x0F, 0x06, 0x55, 0x2F, 0xA5, 0x04, 0x52, 0x75, 0x2B, 0xAC, 0x10, 0x0E, 0xC9,
+    0x0B, 0xB2, 0x02, 0xEC, 0x78, 0x31, 0x58, 0xE4, 0xDC, 0xBD, 0x21, 0x67, 0x03, 0x08, 0xC7, 0x42,
+    0x92, 0x1E, 0xC5, 0x98, 0xC4, 0x0C, 0x18, 0x24, 0xCC, 0x92, 0x83, 0xB6, 0x59, 0x3A, 0x78, 0x2B,
+    0x52, 0x3B, 0x2A, 0xFE, 0xA5, 0xEC, 0x49, 0x7B, 0x32, 0x0D, 0x98, 0x91, 0xFE, 0x9E, 0xE0, 0x8E,
+    0x37, 0xDC, 0xBD, 0xCB, 0x8D, 0xF5, 0x54, 0xBB, 0x2B, 0x32, 0xF0, 0x13, 0xFC, 0x80, 0x95, 0xF9,
+    0xA3, 0xC3, 0xF6, 0xF0, 0x21, 0xD2, 0x99, 0x78, 0x2B, 0x1C, 0x00, 0x82, 0x85, 0x20, 0x40, 0x1A,
+    0x13, 0xB7, 0x6B, 0x78, 0xB8, 0xA2, 0x35, 0x5D, 0x13, 0x1B, 0x86, 0x81, 0x41, 0x2D, 0xE6, 0xD8,
+    0x3E, 0xC3, 0x7E, 0x26, 0xFB, 0x46, 0xE2, 0x7C, 0x48, 0x02, 0x19, 0x60, 0xF7, 0x7E, 0xFA, 0xEB,
+    0x20, 0xC3, 0x69, 0x1C, 0xD9, 0x84, 0x4B, 0x07, 0xBE, 0x92, 0xC2, 0x3B, 0x74, 0x72, 0xFF, 0x0E,
+    0xD9, 0x1D, 0xA2, 0x35, 0xD8, 0x75, 0x60, 0x18, 0x4D, 0xB5, 0x53, 0xA3, 0x6D, 0x40, 0x24, 0x5F,
+    0x75, 0xD6, 0xD7, 0x8D, 0xE9, 0x98, 0xAA, 0xA7, 0x23, 0xE9, 0xCB, 0x01, 0x71, 0xA3, 0xCE, 0x50,
+    0x89, 0x24, 0x4C, 0xE8, 0x29, 0xB9, 0x02, 0x83, 0x52, 0xAA, 0x44, 0x58, 0xA0, 0x4F, 0xA2, 0x30,
+    0x25, 0xE6, 0x46, 0xEB, 0x6A, 0x15, 0x51, 0xDA, 0xBD, 0x11, 0x6B, 0x32, 0x67, 0x7D, 0xBE, 0x18,
+    0x11, 0xB0, 0x03, 0x23, 0xA8, 0x12, 0x3E, 0x39, 0x89, 0x41, 0x42, 0x30, 0x5D, 0x8A, 0x4F, 0x12,
+    0x58, 0x0A, 0x95, 0x04, 0x04, 0x54, 0x0C, 0xC6, 0x03, 0x45, 0x5A, 0x0A, 0x8C, 0x0C, 0x15, 0xA7,
+    0xEA, 0x65, 0x94, 0xB4, 0x53, 0x02, 0x82, 0xA4, 0xF5, 0xA5, 0x70, 0x7A, 0xBB, 0xFD, 0xCD, 0x25,
+    0x28, 0x49, 0xB6, 0xD5, 0xAB, 0x8A, 0x08, 0x98, 0x5B, 0xB4, 0xE2, 0xD4, 0x00, 0xBA, 0x5A, 0xD7,
+    0x82, 0xF2, 0x28, 0x89, 0x7D, 0x10, 0xC1, 0xE1, 0x1A, 0x7E, 0xCF, 0x3A, 0x58, 0x8D, 0x52, 0x06,
+    0x29, 0x36, 0xF2, 0x08, 0xED, 0x49, 0x89, 0x9D, 0x95, 0x5A, 0x7F, 0x3A, 0x6D, 0xDF, 0x48, 0xFE,
+    0x6D, 0xB7, 0xAC, 0x49, 0xEA, 0x33, 0x80, 0x5A, 0x3B, 0x54, 0x51, 0x07, 0xEC, 0xAB, 0x51, 0x0E,
+    0xB5, 0x47, 0x72, 0x5F, 0x8C, 0x28, 0x04, 0x88, 0xF7, 0xFE, 0x8A, 0x3C, 0x64, 0xA6, 0x54, 0x69,
+    0x2F, 0x83, 0x38, 0x7B, 0x09, 0x6F, 0xD5, 0x00, 0xBD, 0x54, 0x11, 0x79, 0xA8, 0x22, 0x54, 0x8C,
+    0x39, 0x9D, 0xD7, 0xC2, 0xA1, 0x02, 0x27, 0x29, 0x17, 0xEC, 0x1B, 0xF4, 0x88, 0x2C, 0x56, 0xD5,
+    0xC7, 0x70, 0x75, 0x94, 0xE0, 0x51, 0x31, 0xA4, 0x2C, 0x25, 0xD3, 0xAD, 0x88, 0x71, 0x81, 0xD7,
+    0x49, 0xE4, 0x8A, 0x0B, 0x1F, 0xE2, 0x77, 0x2F, 0x55, 0x00, 0x11, 0xE8, 0x7D, 0xE6, 0xD3, 0xDF,
+    0x8F, 0x2E, 0xBE, 0x0F, 0xB9, 0xC8, 0x76, 0x42, 0xF5, 0xAD, 0xAB, 0x5C, 0xE5, 0x4B, 0x5F, 0x06,
+    0x15, 0x90, 0x56, 0x11, 0xF2, 0x7D, 0x69, 0x3C, 0xA0, 0xA9, 0xF6, 0xA2, 0x38, 0xE9, 0x48, 0x27,
+    0xF8, 0x89, 0x72, 0x04, 0x7B, 0xA2, 0xDD, 0x15, 0xB9, 0x57, 0x5C, 0xCD, 0xFB, 0x86, 0xFF, 0xF0,
+    0x9B, 0x79, 0xA7, 0x5D, 0x28, 0xFC, 0x7A, 0x1E, 0xD6, 0x28, 0x96, 0x6E, 0x5D, 0xF9, 0x8A, 0x17,
+    0xA8, 0xC4, 0x4C, 0x9A, 0x68, 0xBE, 0xA4, 0xD6, 0x3B, 0x4B, 0x18, 0xDE, 0x78, 0xF4, 0x2E, 0xF1,
+    0x56, 0x79, 0xED, 0x77, 0xA9, 0xCE, 0x43, 0x1E, 0x4B, 0x0F, 0x5E, 0x40, 0x5D, 0xAD, 0x74, 0x05,
+    0x64, 0xEB, 0x4B, 0xA8, 0x41, 0x44, 0x0D, 0xC9, 0x00, 0x62, 0xF2, 0xAA, 0x26, 0x49, 0xD2, 0xB2,
+    0x87, 0x40, 0x3D, 0xE8, 0x39, 0xB7, 0xD5, 0xD3, 0x7E, 0x63, 0xBD, 0x38, 0xF5, 0xF3, 0x6F, 0xF4,
+    0x77, 0x7B, 0x43, 0xCD, 0xF9, 0x65, 0x40, 0x86, 0x94, 0xA7, 0x1D, 0x49, 0xC8, 0x44, 0xE8, 0xC4,
+    0xEB, 0xC9, 0xE9, 0x26, 0xCD, 0x0B, 0xAF, 0x9B, 0x47, 0xD9, 0xA0, 0xC9, 0x64, 0xFF, 0xCC, 0xC2,
+    0xFB, 0xF3, 0x5D, 0x75, 0xB6, 0xDF, 0x6D, 0x32, 0x74, 0x29, 0x1A, 0x04, 0xB7, 0xF6, 0x9D, 0x3A,
+    0x1F, 0x68, 0xC7, 0xD0, 0xEA, 0x03, 0xE0, 0xDD, 0xA5, 0x95, 0x6C, 0xD6, 0xFC, 0xE9, 0xEF, 0x3D,
+    0x7F, 0xEF, 0x83, 0x9F, 0xD7, 0xF8, 0x14, 0xF1, 0xFF, 0xFA, 0xDA, 0xBA, 0xFA, 0x84, 0x8A, 0xA5,
+    0xA8, 0x81, 0x20, 0x13, 0xA6, 0x77, 0xCB, 0xE5, 0x0D, 0xA8, 0x68, 0x4F, 0x08, 0xBC, 0xB1, 0x53,
+    0x0B, 0x55, 0xCE, 0xD1, 0x73, 0x03, 0x52, 0xD9, 0x2C, 0xE8, 0x18, 0xCB, 0xC1, 0xF8, 0xCA, 0x23,
+    0x4A, 0xBA, 0x23, 0x36, 0xCA, 0xE5, 0x65, 0x09, 0xAE, 0xBC, 0x61, 0xE7, 0x45, 0x44, 0xAD, 0x62,
+    0xC6, 0x2F, 0x42, 0x39, 0x94, 0xE8, 0xEF, 0x46, 0x7A, 0x6C, 0x19, 0x8A, 0x1E, 0xCB, 0xAD, 0x85,
+    0x2C, 0x45, 0x8D, 0xF6, 0x84, 0xB3, 0x63, 0x7A, 0x1D, 0x77, 0x3E, 0x97, 0xD6, 0x61, 0x18, 0xDA,
+    0x94, 0xEF, 0x8B, 0x9D, 0x66, 0x53, 0x3E, 0x54, 0x52, 0xAC, 0x98, 0xA1, 0x66, 0xE8, 0x69, 0x32,
+    0xC1, 0x70, 0x9D, 0x46, 0xE6, 0xBF, 0xEF, 0x42, 0xD6, 0xCB, 0xEE, 0xBF, 0x1C, 0xBB, 0xD5, 0x4E,
+    0xFE, 0x2F, 0x4C, 0xAD, 0xD3, 0x47, 0xCF, 0xA4, 0xB1, 0x90, 0x6F, 0x03, 0x89, 0x8B, 0x2F, 0x68,
+    0x75, 0xA8, 0x9C, 0xE6, 0x6F, 0xA7, 0xCF, 0xBA, 0x50, 0xF3, 0xF3, 0xC7, 0xF4, 0x35, 0x24, 0xA1,
+    0xE4, 0xC6, 0xF4, 0x83, 0xE4, 0x0A, 0x95, 0x79, 0xF6, 0xB6, 0x7C, 0xBC, 0x1C, 0x2C, 0xA0, 0xE0,
+    0xDC, 0xD0, 0xFF, 0xF9, 0xFC, 0x0B, 0xAD, 0x55, 0x31, 0x73, 0xDE, 0x44, 0x14, 0x7C, 0xD2, 0x11,
+    0xAB, 0x50, 0x71, 0x0D, 0x6E, 0x98, 0x61, 0xAE, 0x67, 0x18, 0xEE, 0x0F, 0xD8, 0xDC, 0x81, 0xCB,
+    0x14, 0x71, 0x01, 0xB5, 0x5B, 0xA8, 0xCC, 0x0F, 0xC0, 0x96, 0x86, 0x14, 0x29, 0xC3, 0x3F, 0xA0,
+    0x49, 0x11, 0x68, 0x92, 0x32, 0x85, 0xE3, 0xBB, 0xE0, 0x22, 0x65, 0x34, 0x14, 0x50, 0x22, 0x26,
+    0x19, 0x28, 0x5C, 0x70, 0x09, 0x9A, 0xB1, 0x82, 0x25, 0x3D, 0xF6, 0x9D, 0x3E, 0x67, 0x12, 0x28,
+    0xA0, 0x40, 0x33, 0xBE, 0x4F, 0x96, 0x74, 0xEF, 0x76, 0xF7, 0xED, 0xED, 0xBD, 0x4D, 0x54, 0x7C,
+    0x46, 0x8D, 0x27, 0xC3, 0xD1, 0xB5, 0xC4, 0x9C, 0xDC, 0xB2, 0xB7, 0x94, 0x83, 0x61, 0x1E, 0x69,
+    0x2C, 0x02, 0x33, 0x4F, 0x74, 0x2D, 0xC8, 0x48, 0x4D, 0x1E, 0x71, 0x7F, 0x87, 0x88, 0x3D, 0xE1,
+    0x62, 0xCA, 0xE3, 0xD7, 0x5B, 0x3D, 0x46, 0xE6, 0x2E, 0x7F, 0x13, 0x89, 0x6C, 0x1E, 0x2B, 0x9E,
+    0x31, 0xC4, 0x6D, 0x7C, 0x52, 0x47, 0xF9, 0x50, 0xB7, 0x32, 0x1A, 0x99, 0x7A, 0x97, 0xB6, 0x9E,
+    0x59, 0x2C, 0x7A, 0x6B, 0x39, 0xE8, 0x52, 0xC3, 0xBF, 0x3E, 0xA4, 0x43, 0x66, 0xAF, 0x50, 0xA3,
+    0x78, 0xB9, 0x4F, 0x74, 0x2C, 0xDF, 0x3D, 0x7B, 0x97, 0xF0, 0x40, 0x6A, 0xC6, 0xE2, 0x47, 0x6E,
+    0xE9, 0x3E, 0x1E, 0xEE, 0xD0, 0xE6, 0xB2, 0xAD, 0x9A, 0xC8, 0xB5, 0x6A, 0xA0, 0x86, 0xEA, 0x9E,
+    0x66, 0xD2, 0xB1, 0xB8, 0x7A, 0xE0, 0xEB, 0x04, 0x68, 0xA6, 0x2F, 0x17, 0x72, 0x5D, 0x39, 0xD1,
+    0x6B, 0xD7, 0xB0, 0x22, 0x31, 0x60, 0x97, 0xA1, 0x2F, 0xF9, 0xA7, 0x5C, 0x3C, 0xFD, 0xD7, 0x8B,
+    0x15, 0x34, 0x8A, 0xA4, 0x47, 0x37, 0xEB, 0x01, 0xE0, 0xCE, 0xF8, 0x0C, 0x34, 0xD5, 0xE4, 0xC6,
+    0x00, 0x7A, 0xF6, 0x27, 0x3E, 0x80, 0x18, 0x05, 0x87, 0x0B, 0x59, 0x57, 0x5F, 0x72, 0xD6, 0x28,
+    0x64, 0x41, 0xA0, 0x08, 0x0F, 0xF2, 0xAF, 0x13, 0x65, 0x48, 0xD8, 0xC9, 0xD3, 0x82, 0x57, 0x18,
+    0x61, 0x7D, 0xEB, 0x56, 0x25, 0xCD, 0xD2, 0x3C, 0xC1, 0xDC, 0x9A, 0x6F, 0x8D, 0xCD, 0x84, 0x4F,
+    0xFB, 0xB0, 0xC7, 0xA9, 0xE0, 0x51, 0x27, 0xC3, 0xED, 0xEB, 0x80, 0x3E, 0x2C, 0xD3, 0x5A, 0x6C,
+    0xE5, 0xE2, 0x72, 0x4D, 0x54, 0xEB, 0xFE, 0x85, 0xC8, 0xB5, 0xFD, 0x6D, 0xBF, 0x5D, 0x7C, 0x42,
+    0xE1, 0xE6, 0xA8, 0x7B, 0x06, 0x03, 0xDB, 0x4E, 0x20, 0x66, 0x5E, 0x4C, 0xF6, 0x36, 0x2A, 0x86,
+    0x6F, 0xCE, 0x84, 0x82, 0x5A, 0xA6, 0x20, 0x14, 0x34, 0x3F, 0xC9, 0x85, 0x9B, 0x85, 0xD3, 0x0A,
+    0x3D, 0xEB, 0xDA, 0x64, 0xAC, 0xD2, 0x70, 0x71, 0x84, 0x59, 0xF8, 0xF7, 0x59, 0x30, 0xDF, 0x9E,
+    0xC2, 0x20, 0x98, 0xF9, 0x0C, 0x0D, 0x05, 0x66, 0xF8, 0xC9, 0x93, 0x7E, 0xB4, 0x50, 0xDD, 0x2D,
+    0xA4, 0x12, 0x53, 0x31, 0xA1, 0xE8, 0x69, 0x00, 0xDC, 0x20, 0xDD, 0xF0, 0x98, 0xE3, 0x31, 0xA1,
+    0x13, 0x31, 0x3C, 0xF1, 0xBD, 0x81, 0x9C, 0x47, 0x0B, 0xA3, 0xE9, 0x74, 0x52, 0x83, 0x1A, 0x8B,
+    0x09, 0x7D, 0x64, 0xFA, 0x94, 0x82, 0xA7, 0x2D, 0x00, 0x51, 0x02, 0x46, 0xFE, 0x8E, 0x5F, 0xEB,
+    0xDC, 0x83, 0x13, 0x7A, 0x9E, 0xE8, 0xA2, 0x2B, 0xE1, 0xA4, 0x99, 0xAA, 0x09, 0x45, 0x5B, 0x7D,
+    0xBD, 0x33, 0xAA, 0xB7, 0xAA, 0xDF, 0x55, 0x1D, 0x1D, 0x46, 0xB1, 0xEC, 0xDA, 0x7A, 0x2C, 0xD4,
+    0x03, 0xF7, 0xBC, 0x76, 0xC1, 0x7D, 0x35, 0x51, 0x95, 0xB0, 0x03, 0x42, 0x35, 0x90, 0xEE, 0x03,
+    0x00, 0x6A, 0xBC, 0x8E, 0x78, 0x3D, 0x9A, 0x48, 0x0D, 0x56, 0xAF, 0xE5, 0xF5, 0x82, 0xD7, 0x36,
+    0x06, 0xAF, 0x27, 0xCD, 0x1F, 0xB3, 0x87, 0x15, 0x3A, 0x2B, 0x42, 0x48, 0xEF, 0x75, 0x12, 0xB9,
+    0x44, 0x94, 0x28, 0x6D, 0x80, 0x54, 0x74, 0xB2, 0x4B, 0xE3, 0x97, 0x34, 0x3C, 0x28, 0xD3, 0xA0,
+    0x7E, 0x49, 0xEA, 0xFB, 0x54, 0x9F, 0xF5, 0x76, 0x6F, 0x6A, 0xEA, 0x11, 0x2A, 0x40, 0x0C, 0xB8,
+    0x16, 0x24, 0x69, 0x41, 0xCD, 0x62, 0x26, 0x17, 0xCB, 0x6C, 0xE1, 0x09, 0x2C, 0xD5, 0x08, 0xA8,
+    0x58, 0x8C, 0xA9, 0x1E, 0x8A, 0x05, 0xB5, 0xCB, 0x99, 0x4C, 0x02, 0x2D, 0xDB, 0x57, 0x62, 0x90,
+    0x1A, 0x43, 0xD4, 0x57, 0x43, 0x6B, 0xFE, 0xFC, 0x8E, 0x5B, 0x0B, 0x7F, 0x78, 0xD7, 0x97, 0x1C,
+    0x9B, 0x2E, 0x0B, 0x44, 0xE2, 0x14, 0x2B, 0x9D, 0x71, 0xD2, 0xC3, 0x20, 0xAE, 0x3B, 0xBC, 0xB3,
+    0x8A, 0x55, 0xA4, 0x2A, 0x3A, 0x3A, 0x51, 0xBD, 0x6E, 0x8F, 0x64, 0x5B, 0x58, 0x9A, 0x54, 0x32,
+    0xAD, 0x2B, 0xA1, 0x0B, 0xFC, 0x29, 0xAA, 0x1C, 0x43, 0x84, 0xCE, 0xA2, 0xBF, 0x53, 0xD6, 0xDA,
+    0x0C, 0x54, 0x7C, 0x4B, 0xFF, 0x1F, 0x5E, 0xFF, 0x0A, 0x2F, 0x09, 0xDE, 0x76, 0x83, 0xB7, 0xE0,
+    0xBC, 0x23, 0xC5, 0x64, 0x79, 0x0B, 0x49, 0xBB, 0x8C, 0x78, 0x6E, 0x1B, 0xC1, 0x30, 0x02, 0xAF,
+    0xDF, 0x2D, 0x53, 0xD5, 0xAD, 0xD8, 0xE3, 0x11, 0x8D, 0x75, 0x67, 0x3D, 0x82, 0x0B, 0x91, 0x95,
+    0xB1, 0xFB, 0xB9, 0x4A, 0xE8, 0x1D, 0x9D, 0x92, 0xA8, 0x5B, 0x60, 0xBA, 0x43, 0xD1, 0xFD, 0x75,
+    0x73, 0xB4, 0x0E, 0x2D, 0x5D, 0x2A, 0x78, 0xCA, 0xB6, 0x26, 0x3E, 0xA4, 0x53, 0x85, 0x5B, 0x8D,
+    0x5B, 0x87, 0x65, 0x91, 0x79, 0x85, 0x24, 0xD0, 0xE7, 0xF0, 0x64, 0x89, 0x79, 0xBA, 0x5B, 0xE7,
+    0x02, 0x86, 0xED, 0x73, 0xDA, 0xA9, 0x67, 0xC0, 0xB2, 0xEA, 0xF7, 0x56, 0x51, 0x7D, 0xF4, 0x43,
+    0xBC, 0xDF, 0xED, 0x7C, 0xF1, 0xC1, 0xFB, 0xE6, 0x3A, 0xC7, 0x25, 0x21, 0x9C, 0x8C, 0xD7, 0x11,
+    0xDB, 0x71, 0xA4, 0x5D, 0xCC, 0x1E, 0x04, 0x76, 0xD3, 0x81, 0x14, 0xC8, 0xD5, 0x48, 0x28, 0xF0,
+    0x44, 0x3A, 0x4D, 0x68, 0x4D, 0xC9, 0xC9, 0x32, 0x1E, 0x3C, 0x42, 0x0E, 0x35, 0x7C, 0x83, 0xBB,
+    0x72, 0x99, 0x43, 0x20, 0x7D, 0xCE, 0x97, 0x50, 0xF4, 0x90, 0x7F, 0xEE, 0xCB, 0xB9, 0x99, 0x61,
+    0xB3, 0xE7, 0xFC, 0x07, 0x74, 0x7E, 0xCC, 0x07, 0xA9, 0x58, 0xF4, 0x14, 0x62, 0x3D, 0xBA, 0x33,
+    0x49, 0xB5, 0xC5, 0x0C, 0xA2, 0x53, 0xC8, 0x7B, 0xDD, 0x25, 0xDA, 0xC8, 0x46, 0x75, 0x36, 0xB7,
+    0x8B, 0x57, 0x12, 0xAE, 0xCA, 0x6D, 0xE2, 0x5A, 0xAE, 0x19, 0xCD, 0x9C, 0xCB, 0xA9, 0x5C, 0xAA,
+    0x51, 0x2D, 0x7A, 0x50, 0x6C, 0x53, 0xC5, 0x2E, 0xE9, 0x70, 0xD9, 0xEB, 0x7B, 0x17, 0xBD, 0x39,
+    0x3C, 0xEF, 0xAC, 0x79, 0x12, 0x9D, 0x39, 0x88, 0xCD, 0x35, 0x2B, 0xAE, 0xEE, 0xB3, 0x8E, 0x39,
+    0xB6, 0x21, 0x06, 0x1D, 0x89, 0xB2, 0xA8, 0x82, 0x1D, 0x39, 0x62, 0x67, 0xA6, 0x2A, 0xD5, 0xBD,
+    0xEE, 0x74, 0x34, 0xD1, 0xB6, 0xCE, 0x3B, 0xFF, 0xDE, 0xAB, 0xED, 0x78, 0x52, 0xF5, 0x62, 0xBC,
+    0x24, 0xB9, 0x27, 0xC1, 0xD6, 0xF4, 0x6F, 0xE4, 0x8F, 0x92, 0x67, 0xE5, 0x9C, 0xA1, 0xE7, 0xDE,
+    0xCB, 0xEB, 0x53, 0x69, 0x79, 0xD3, 0x08, 0x87, 0x1B, 0x72, 0x90, 0xDC, 0x4C, 0xB2, 0xFA, 0x2C,
+    0x30, 0x1C, 0x42, 0x42, 0x1A, 0xAB, 0xE4, 0x68, 0xC2, 0xC0, 0x54, 0x8A, 0x9D, 0xE4, 0xE0, 0x91,
+    0xB8, 0x87, 0x59, 0x1A, 0x1C, 0x60, 0x1E, 0xDC, 0xDD, 0x55, 0xF4, 0x69, 0x7F, 0x22, 0xFB, 0xBC,
+    0x85, 0xD2, 0xA8, 0x63, 0x87, 0xBF, 0x25, 0x60, 0x7D, 0xD1, 0xAF, 0xB1, 0xB9, 0x20, 0x2C, 0xE1,
+    0x7F, 0xAA, 0xC0, 0x83, 0x1E, 0xE0, 0x46, 0x0B, 0xE5, 0x04, 0x0F, 0x98, 0x1C, 0x47, 0x80, 0xAF,
+    0x25, 0xC8, 0xED, 0x6F, 0x39, 0xFB, 0xD2, 0xB4, 0x19, 0xEA, 0x17, 0x18, 0xF4, 0xD3, 0xF1, 0x8D,
+    0xAA, 0xF3, 0x15, 0xAD, 0x4A, 0x1A, 0xA0, 0x65, 0xB0, 0xE1, 0x8A, 0xD5, 0xEC, 0xC4, 0x5A, 0x4E,
+    0xE6, 0x83, 0x4F, 0x26, 0x65, 0xE5, 0xE0, 0x75, 0x82, 0x52, 0xE8, 0x64, 0x4E, 0x2A, 0xEF, 0x93,
+    0x84, 0x3E, 0x9A, 0x1E, 0x6C, 0x36, 0x94, 0xEE, 0xBE, 0xE3, 0x29, 0x40, 0x00, 0xF7, 0x18, 0xCE,
+    0x7A, 0x0A, 0x3F, 0x8D, 0xFC, 0x4F, 0x3E, 0x1A, 0xE2, 0xE8, 0xF3, 0x19, 0x27, 0xAE, 0xCB, 0x74,
+    0xCA, 0x1E, 0x41, 0x93, 0x40, 0x69, 0x07, 0x6D, 0x33, 0x9B, 0x33, 0x56, 0xCE, 0x79, 0xAA, 0x5F,
+    0x02, 0xFC, 0x5F, 0xAD, 0x55, 0xBF, 0x73, 0xDD, 0x44, 0x10, 0x5E, 0x9D, 0x70, 0x34, 0x13, 0x15,
+    0x47, 0x81, 0x9B, 0x50, 0xA8, 0x4F, 0x81, 0x1A, 0xFA, 0x13, 0x50, 0xA4, 0x70, 0x91, 0x14, 0x31,
+    0x85, 0x29, 0xD2, 0x40, 0x43, 0xE3, 0xBF, 0xC0, 0x96, 0x98, 0x94, 0x34, 0xFE, 0x0F, 0x42, 0x41,
+    0xF5, 0x52, 0xBC, 0x96, 0xC6, 0x3E, 0x61, 0x17, 0x14, 0x6E, 0x14, 0x28, 0x29, 0xD0, 0x0C, 0x14,
+    0x30, 0x29, 0x9E, 0x12, 0xCB, 0x33, 0xF7, 0xF0, 0xE9, 0x96, 0x6F, 0x4F, 0x0F, 0x8C, 0x49, 0x18,
+    0x18, 0x06, 0xCD, 0x3C, 0xDD, 0xD3, 0xFD, 0xD8, 0xFD, 0xBE, 0xDD, 0x6F, 0xF7, 0x88, 0x48, 0x2D,
+    0x2C, 0x13, 0x51, 0xCA, 0xCC, 0xCD, 0x3C, 0xB4, 0x98, 0xE4, 0x11, 0x73, 0x94, 0xB0, 0x8F, 0xC3,
+    0x14, 0x64, 0x20, 0x6F, 0x2B, 0x19, 0xA6, 0x32, 0x4E, 0x9F, 0xE4, 0x3C, 0x61, 0xB0, 0x38, 0x82,
+    0xA1, 0x4E, 0x82, 0x2C, 0x9A, 0x68, 0x45, 0x86, 0x7E, 0x1E, 0xC2, 0xA2, 0xA1, 0x12, 0x46, 0x79,
+    0xA0, 0xA2, 0xC7, 0x56, 0x4F, 0xC5, 0x40, 0xF8, 0x24, 0x3D, 0x52, 0x1D, 0x7D, 0xDD, 0x78, 0xCA,
+    0x1F, 0x3E, 0x77, 0x11, 0x84, 0x27, 0xB3, 0xE4, 0x67, 0x4E, 0x0D, 0x7A, 0xDA, 0x1B, 0x8A, 0x0A,
+    0x96, 0xDA, 0xAF, 0xE4, 0x5C, 0xDA, 0xA6, 0x97, 0x0F, 0x48, 0x53, 0xD9, 0x51, 0x85, 0xF3, 0xEB,
+    0xA5, 0x4C, 0xB2, 0x93, 0x23, 0xDC, 0xA9, 0x50, 0xD7, 0xEE, 0x77, 0x53, 0x79, 0x7B, 0x48, 0xA4,
+    0x05, 0x6A, 0x2E, 0x6C, 0x92, 0x08, 0xEC, 0xD5, 0xA7, 0x60, 0xAE, 0x04, 0xA8, 0xA0, 0xFD, 0x05,
+    0x3C, 0x64, 0xEE, 0x24, 0xD2, 0x14, 0xE6, 0x42, 0x54, 0xC9, 0x8E, 0xC8, 0x32, 0x63, 0x04, 0x22,
+    0x1F, 0x30, 0xA7, 0xE3, 0xEB, 0x72, 0xB7, 0x92, 0xF3, 0xCD, 0x4C, 0x3B, 0xBE, 0x6A, 0xD9, 0x3C,
+    0x3F, 0x2E, 0x6F, 0x31, 0xD7, 0x03, 0x03, 0x36, 0xDB, 0x8E, 0x5E, 0xFF, 0xD8, 0x06, 0x0E, 0x3C,
+    0xA9, 0x75, 0x51, 0xA9, 0xF5, 0x47, 0x3D, 0xE8, 0x38, 0xB2, 0xF0, 0x63, 0x76, 0xE1, 0x00, 0xE1,
+    0x49, 0xC3, 0x42, 0x26, 0xC7, 0x99, 0x8A, 0xFD, 0x69, 0x73, 0x2C, 0xB1, 0xA3, 0x00, 0x1B, 0xC5,
+    0x6B, 0x0B, 0x70, 0x81, 0x0E, 0x3E, 0x14, 0x3F, 0x09, 0x47, 0x74, 0xDB, 0x8B, 0xA7, 0x41, 0x62,
+    0xD2, 0x61, 0xD9, 0xCB, 0x9F, 0xCA, 0x60, 0x56, 0x8D, 0xD9, 0x44, 0xC5, 0x15, 0x10, 0xD6, 0x88,
+    0x7C, 0x62, 0x8F, 0x36, 0xC6, 0xB6, 0x2A, 0xE4, 0xA8, 0xCB, 0xB0, 0xAB, 0x66, 0x7F, 0xBB, 0xDA,
+    0x87, 0x5B, 0xBF, 0xB5, 0xB7, 0x3C, 0x05, 0x16, 0xE4, 0x4E, 0x5D, 0xEE, 0x74, 0xC5, 0x3D, 0x47,
+    0xF0, 0xA1, 0x66, 0x21, 0x90, 0x3E, 0x1B, 0x10, 0x1B, 0xC4, 0xAA, 0x3C, 0x1F, 0x28, 0x75, 0xE1,
+    0x2F, 0x9C, 0xFE, 0x57, 0x70, 0xC9, 0x03, 0xD8, 0xC2, 0x0A, 0x7E, 0x40, 0xA7, 0x8E, 0xA0, 0x1F,
+    0x04, 0x66, 0x7B, 0xCF, 0xC2, 0x83, 0xCB, 0xE1, 0xA0, 0x7C, 0x78, 0x42, 0x07, 0xA2, 0x2A, 0xC0,
+    0xC0, 0x29, 0xA3, 0xDB, 0xC4, 0x1F, 0x92, 0xFE, 0xD1, 0x51, 0xFD, 0x24, 0x46, 0xBD, 0xDC, 0x89,
+    0x43, 0x3A, 0x44, 0x35, 0x53, 0x5D, 0x46, 0xD5, 0xE9, 0x0B, 0x4F, 0xFF, 0xF6, 0x29, 0x06, 0x13,
+    0x72, 0x6C, 0xE7, 0x8C, 0xBF, 0x06, 0x87, 0xDC, 0xD5, 0xDE, 0xC0, 0x48, 0x7D, 0xCE, 0xF7, 0x21,
+    0xAD, 0xD4, 0xDB, 0x8B, 0x29, 0x8A, 0x37, 0x20, 0x9B, 0x60, 0xC9, 0x2B, 0x51, 0xBF, 0xE6, 0xB9,
+    0x7C, 0x6C, 0x2C, 0x10, 0x88, 0x67, 0x56, 0x7B, 0xCD, 0x51, 0xA2, 0x08, 0x6C, 0x37, 0x6F, 0xE2,
+    0x79, 0x51, 0x36, 0x2B, 0xFE, 0x7E, 0x2D, 0x81, 0xE2, 0x91, 0x77, 0x44, 0x4C, 0x93, 0x1E, 0xCC,
+    0x84, 0xAD, 0xEF, 0xF1, 0xA6, 0x22, 0x29, 0xED, 0x67, 0x81, 0x9F, 0x94, 0x51, 0xCE, 0xFA, 0xBB,
+    0x38, 0xAD, 0x26, 0x5B, 0xFD, 0x03, 0x85, 0x85, 0xFA, 0xF2, 0xD6, 0x17, 0x77, 0xAB, 0xDC, 0x99,
+    0x06, 0x56, 0xC9, 0x7C, 0xEB, 0x8A, 0x33, 0x61, 0x54, 0x9E, 0x3A, 0x61, 0xB4, 0xF6, 0xA6, 0x06,
+    0x3C, 0xB3, 0x3A, 0x17, 0xFF, 0xC4, 0x3E, 0x62, 0xCF, 0x78, 0x15, 0xB1, 0x9B, 0x19, 0x3B, 0xA2,
+    0x3D, 0x6D, 0x7A, 0x45, 0xAC, 0xA8, 0x55, 0x10, 0x0E, 0xD6, 0xF1, 0xB9, 0xD4, 0x50, 0xD0, 0xDE,
+    0x48, 0x9E, 0x1A, 0xC0, 0xC5, 0xB2, 0x1A, 0x8F, 0x63, 0xC8, 0xB3, 0x17, 0xFE, 0x6F, 0x63, 0x9D,
+    0x3C, 0x14, 0xDB, 0x52, 0x7F, 0x2D, 0xBD, 0x99, 0xC3, 0x96, 0xFC, 0xF6, 0xA5, 0x6C, 0x30, 0x0F,
+    0x1B, 0x77, 0x8E, 0xC5, 0xB9, 0x04, 0x8D, 0xDE, 0x4A, 0x02, 0x95, 0x4B, 0x09, 0x06, 0x5A, 0x03,
+    0x30, 0xBE, 0x1D, 0xAA, 0x6B, 0x2D, 0x22, 0xE7, 0xCA, 0xDB, 0x98, 0xF3, 0x18, 0x0D, 0xA2, 0x77,
+    0xE4, 0xE4, 0xBB, 0xF8, 0xDF, 0xA2, 0x82, 0x10, 0x6D, 0x90, 0x52, 0x3D, 0xBD, 0xA1, 0xA1, 0x2E,
+    0x0F, 0x02, 0x1D, 0xDD, 0x5A, 0x6F, 0x8E, 0xC3, 0x1E, 0xD8, 0xDD, 0x7E, 0x2A, 0xD5, 0x05, 0x24,
+    0x2D, 0xFA, 0x14, 0xA5, 0xB0, 0x80, 0x4E, 0x92, 0x3C, 0x02, 0xEB, 0x63, 0x91, 0x5B, 0xF6, 0xD8,
+    0x43, 0x6E, 0x4D, 0x09, 0xC7, 0x16, 0x1B, 0x3F, 0x99, 0xCF, 0x02, 0x07, 0x8E, 0xAB, 0x85, 0x08,
+    0xAF, 0x82, 0xB8, 0x51, 0x1E, 0x89, 0xE8, 0x77, 0xA4, 0x2D, 0x1B, 0xAB, 0x37, 0x1D, 0xB2, 0x0F,
+    0x3C, 0xFA, 0xA4, 0x74, 0x8F, 0x12, 0xBB, 0x3E, 0xBE, 0x4E, 0x07, 0x18, 0xE7, 0x92, 0xFA, 0x9A,
+    0x7F, 0xFE, 0x53, 0x3C, 0x24, 0x4C, 0x79, 0x0F, 0xAA, 0xA6, 0xD2, 0x23, 0xBE, 0xB8, 0xCD, 0xE1,
+    0x82, 0x4C, 0x63, 0x1D, 0x4D, 0x19, 0x6A, 0x74, 0xA8, 0x61, 0xE9, 0xF1, 0x95, 0xA7, 0xC9, 0x2C,
+    0xFB, 0xEC, 0xA5, 0xE7, 0xAA, 0x5C, 0x7D, 0x83, 0x7D, 0x53, 0x39, 0xA4, 0xDC, 0x73, 0x53, 0x30,
+    0xAA, 0xC8, 0x0E, 0x06, 0x5F, 0x15, 0xB7, 0x85, 0xCB, 0xA5, 0x36, 0xB7, 0xF6, 0x2A, 0x92, 0x8E,
+    0x6C, 0x21, 0xBD, 0xED, 0xDD, 0x9B, 0x29, 0x48, 0x87, 0xD4, 0x91, 0x07, 0xE1, 0xC3, 0x14, 0x96,
+    0xDF, 0xE7, 0x56, 0x9F, 0x72, 0x9F, 0xBE, 0x0C, 0x63, 0xF2, 0xAB, 0xF7, 0x74, 0xE2, 0x0D, 0x99,
+    0xA9, 0x68, 0xF4, 0xA4, 0xBB, 0x6C, 0x4A, 0x07, 0x15, 0x00, 0x6A, 0x41, 0x9F, 0x0A, 0x79, 0xF0,
+    0x8B, 0x3D, 0x20, 0x46, 0xBD, 0x7E, 0xD2, 0xCF, 0xF6, 0xA4, 0x81, 0x2A, 0x94, 0x5E, 0xA3, 0x3B,
+    0x18, 0xAD, 0xC9, 0x0C, 0x0A, 0x35, 0xDE, 0xEA, 0x1E, 0xFC, 0x0D, 0x84, 0x91, 0xF8, 0x02, 0xA4,
+    0xFA, 0x00, 0x52, 0xF7, 0x9F, 0xBB, 0xC4, 0x5B, 0xD3, 0xE5, 0x57, 0x2F, 0xF0, 0xC5, 0x3B, 0xA0,
+    0xE1, 0x4C, 0x2F, 0x25, 0x56, 0x95, 0x5E, 0xE3, 0xAB, 0x33, 0x43, 0x16, 0x94, 0x34, 0xEE, 0x64,
+    0x3C, 0xA0, 0x74, 0x9C, 0x5E, 0x11, 0x93, 0xA7, 0x20, 0xE0, 0x13, 0xA7, 0xBD, 0x1A, 0x4B, 0x9F,
+    0x0E, 0xD6, 0x09, 0xF6, 0xEC, 0xF9, 0xC5, 0x90, 0xAF, 0xCE, 0x10, 0xBA, 0x7B, 0xBD, 0x40, 0x2F,
+    0x46, 0xDD, 0x96, 0x7D, 0xD1, 0xDE, 0x6D, 0xEE, 0x34, 0xB3, 0x62, 0xA2, 0x25, 0x12, 0xD1, 0x10,
+    0x05, 0x73, 0xE3, 0x6A, 0x48, 0x44, 0xD4, 0x31, 0x37, 0x5A, 0xAE, 0x2D, 0xED, 0x90, 0x56, 0xDC,
+    0x56, 0xA6, 0xCD, 0x47, 0x34, 0x7F, 0x44, 0x4B, 0x79, 0xC9, 0x93, 0x25, 0x11, 0x69, 0x6B, 0x2A,
+    0xD2, 0x7D, 0xD1, 0x51, 0x3E, 0x62, 0x39, 0x83, 0x4A, 0x8E, 0x1E, 0x05, 0x29, 0x79, 0x8E, 0xD7,
+    0x5E, 0x35, 0xDF, 0xAB, 0xB5, 0xBC, 0x14, 0xAF, 0xFF, 0xF0, 0x91, 0x9F, 0x5E, 0x8B, 0xF6, 0xF5,
+    0xB5, 0xB1, 0xDF, 0x03, 0x03, 0x9A, 0xDA, 0xB2, 0x87, 0x02, 0x5A, 0x64, 0x41, 0x8D, 0xE4, 0x35,
+    0x22, 0x67, 0x3E, 0x63, 0xB9, 0x24, 0x54, 0x6C, 0xAD, 0x00, 0x13, 0x2A, 0xFA, 0xCF, 0xCF, 0x6F,
+    0xAD, 0x55, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xEF, 0x92, 0x58, 0x3A, 0x17, 0x5B, 0x85, 0x22,
+    0x57, 0xB8, 0x07, 0x9D, 0xB6, 0xA1, 0xA0, 0x88, 0xB2, 0x46, 0xFC, 0x01, 0x41, 0x88, 0xD7, 0x40,
+    0x41, 0x1D, 0x1A, 0x5A, 0x8A, 0xE3, 0x6C, 0x42, 0x99, 0x22, 0x34, 0x50, 0xA7, 0xA0, 0x40, 0x49,
+    0x91, 0x86, 0x32, 0x39, 0x2F, 0x41, 0xE2, 0xCA, 0xF8, 0xA0, 0xA4, 0x88, 0x05, 0x48, 0x48, 0x34,
+    0x2C, 0xC2, 0x81, 0x8D, 0x58, 0x7B, 0xF8, 0x66, 0xFD, 0xEE, 0x4E, 0x44, 0x49, 0xA0, 0xE0, 0xDD,
+    0xE9, 0xF9, 0xD9, 0xDE, 0x9D, 0x99, 0xEF, 0xC7, 0xCC, 0x52, 0xD1, 0x8F, 0x44, 0xCC, 0x03, 0x39,
+    0x66, 0x32, 0xCB, 0xBB, 0x51, 0x31, 0x39, 0xEF, 0xBC, 0x4E, 0xD5, 0x84, 0x1F, 0xCC, 0x9C, 0x6A,
+    0x7C, 0x5D, 0xE3, 0x5B, 0xEF, 0x4F, 0x76, 0x54, 0xAC, 0xF8, 0x33, 0x1E, 0x2C, 0x9E, 0x16, 0x2C,
+    0x1B, 0xD6, 0x9D, 0x81, 0xA8, 0xFF, 0x89, 0x88, 0x76, 0x23, 0x55, 0x1C, 0xF4, 0xD2, 0x77, 0x3D,
+    0x25, 0xE3, 0xCD, 0x7D, 0xAC, 0x43, 0xDC, 0x8F, 0xE3, 0x6E, 0x70, 0xBC, 0x28, 0x66, 0x6F, 0x78,
+    0x24, 0x2B, 0x4B, 0x9D, 0xE9, 0xA8, 0xFA, 0x21, 0x12, 0xCD, 0xAE, 0xA1, 0xFA, 0xFB, 0x89, 0x4E,
+    0x3F, 0xFF, 0x6B, 0x45, 0xE6, 0xEB, 0x40, 0x6D, 0xED, 0x75, 0x5C, 0xC8, 0xFC, 0x1C, 0xCF, 0x52,
+    0x74, 0x64, 0xD9, 0x4B, 0xA1, 0xD6, 0x3B, 0x4A, 0x94, 0x2A, 0x66, 0x94, 0xC8, 0xDD, 0x72, 0x3E,
+    0x69, 0xE6, 0xB1, 0xCA, 0x91, 0x46, 0xAA, 0x1E, 0x6F, 0x77, 0xE8, 0x90, 0xF2, 0xB5, 0x3E, 0x1A,
+    0xF3, 0x75, 0x71, 0x9D, 0x5C, 0xCA, 0xC7, 0x33, 0xFD, 0xC7, 0x4F, 0xD1, 0x0F, 0xF9, 0xDA, 0x4A,
+    0x6D, 0xD8, 0xB9, 0xF4, 0x39, 0x52, 0x0F, 0x48, 0x72, 0x8B, 0x32, 0x1B, 0x5C, 0x5F, 0x02, 0x21,
+    0x79, 0xF5, 0xE6, 0x9D, 0x4C, 0x09, 0xE0, 0xF8, 0x75, 0x17, 0xAF, 0x61, 0xD4, 0x16, 0x44, 0x2D,
+    0xD1, 0xEC, 0xA4, 0xF2, 0x63, 0x00, 0x97, 0xD5, 0xA8, 0x3C, 0xAF, 0x46, 0xF5, 0xB9, 0x5A, 0xD0,
+    0x94, 0xAB, 0xAC, 0x78, 0xFC, 0x67, 0x2D, 0xC9, 0x09, 0x29, 0xEE, 0xC1, 0x68, 0x7E, 0xCC, 0xE1,
+    0x5E, 0x6C, 0xA8, 0x5D, 0x68, 0x4F, 0x63, 0xD9, 0x3E, 0x72, 0x36, 0xE7, 0x6F, 0x0F, 0x95, 0x94,
+    0x99, 0xA8, 0x98, 0xCB, 0xDB, 0x8B, 0xE6, 0x85, 0xEC, 0x19, 0x79, 0xC8, 0x8B, 0x74, 0xA5, 0x04,
+    0xFF, 0xE5, 0xD6, 0x5B, 0xCF, 0x80, 0xBB, 0xF3, 0x09, 0x7D, 0x21, 0xE0, 0x9A, 0x32, 0x00, 0x9B,
+    0x6B, 0x12, 0xE9, 0x68, 0xC1, 0x3A, 0xF4, 0x28, 0xE6, 0x7B, 0x02, 0x0C, 0x95, 0x4A, 0xD5, 0xD5,
+    0x22, 0xF0, 0x70, 0x53, 0xC6, 0x4C, 0x47, 0x86, 0x56, 0xDC, 0x01, 0x00, 0xC7, 0x02, 0x09, 0x6F,
+    0xDA, 0x95, 0xB9, 0x73, 0x6F, 0xDF, 0x14, 0x68, 0x04, 0x9D, 0x03, 0x5D, 0x78, 0xE3, 0xB9, 0x6C,
+    0x27, 0xA4, 0x34, 0x43, 0x39, 0x22, 0x60, 0x02, 0xB9, 0xC8, 0xEC, 0x5E, 0x0F, 0x28, 0x01, 0x99,
+    0xDD, 0x43, 0x4F, 0x4A, 0x32, 0xD7, 0xC2, 0x9D, 0xC4, 0x37, 0x27, 0x99, 0x0D, 0x08, 0xD0, 0xC8,
+    0xFC, 0x32, 0x37, 0xC0, 0x87, 0x9B, 0x3E, 0x6E, 0xDF, 0x52, 0x31, 0xC9, 0xD6, 0x2B, 0x9E, 0xCA,
+    0xDF, 0xB0, 0x80, 0xB3, 0x68, 0x4F, 0x7E, 0xEE, 0x51, 0xDD, 0x55, 0x41, 0x4F, 0xD4, 0xD2, 0x01,
+    0xE9, 0xC9, 0x78, 0x72, 0xF7, 0x23, 0x29, 0xB0, 0x4D, 0xF5, 0x43, 0x60, 0x10, 0x55, 0x0C, 0x42,
+    0x93, 0x48, 0x5F, 0x8A, 0x44, 0x2D, 0xF4, 0xA9, 0x40, 0xB4, 0x82, 0xE8, 0x17, 0x51, 0x8A, 0x16,
+    0xD6, 0x1D, 0xDE, 0x94, 0xAB, 0xAF, 0x2E, 0xA3, 0x4B, 0xEC, 0xF5, 0x91, 0xCC, 0x77, 0x13, 0x55,
+    0x7F, 0x3C, 0xC3, 0x6B, 0x8E, 0xCC, 0x20, 0x58, 0x55, 0xD2, 0x70, 0x11, 0x0C, 0x62, 0x86, 0xB4,
+    0x42, 0xE5, 0x56, 0xB4, 0x12, 0x2C, 0x7E, 0x45, 0xEA, 0xC6, 0x35, 0x9F, 0x8E, 0x2B, 0xD0, 0x3B,
+    0x08, 0x09, 0xE5, 0xC9, 0x2E, 0x27, 0x38, 0xD5, 0x4D, 0xBA, 0x0A, 0x1E, 0x14, 0x08, 0xF4, 0x58,
+    0xC9, 0x64, 0x87, 0xA7, 0x26, 0xBD, 0x4A, 0x3B, 0x0D, 0x38, 0xB3, 0x70, 0x0E, 0xFE, 0xC0, 0x36,
+    0x22, 0xB9, 0x8F, 0x10, 0x42, 0x14, 0x46, 0x43, 0x8F, 0x5B, 0x89, 0x33, 0xDE, 0xAC, 0x71, 0x06,
+    0x9C, 0x45, 0x96, 0x0A, 0xB2, 0x81, 0x2F, 0xE6, 0x9A, 0x44, 0x06, 0x97, 0xD9, 0x58, 0x53, 0xC1,
+    0x6C, 0x60, 0x0E, 0x4C, 0x92, 0x09, 0x20, 0x46, 0x7D, 0x4E, 0xEF, 0x35, 0xCF, 0xD3, 0xDA, 0x78,
+    0x50, 0x8E, 0xB6, 0x39, 0x90, 0xC8, 0x46, 0xFC, 0x22, 0x4D, 0xA2, 0x27, 0x27, 0x71, 0xAF, 0x23,
+    0xA6, 0x9E, 0x25, 0xBA, 0x10, 0x01, 0xEF, 0x48, 0x6E, 0x93, 0xDB, 0x23, 0x37, 0x47, 0xAE, 0x85,
+    0x96, 0xCC, 0x23, 0xB6, 0xAA, 0x5E, 0x1A, 0x49, 0x28, 0x81, 0xD5, 0xBA, 0x93, 0x45, 0x32, 0xAE,
+    0xBC, 0x08, 0xDF, 0x5B, 0xBF, 0x6D, 0x99, 0x3D, 0xDA, 0xD7, 0xDE, 0xF8, 0xBB, 0x14, 0x4D, 0x63,
+    0x5F, 0x0B, 0x3A, 0xEC, 0x51, 0x8B, 0x07, 0xE3, 0xE5, 0xDD, 0x19, 0x6D, 0xE8, 0x2D, 0xB4, 0xEE,
+    0x6F, 0x74, 0xB0, 0x0D, 0x12, 0xCB, 0xF8, 0x20, 0x94, 0x57, 0x1E, 0x4F, 0xEE, 0xCA, 0x71, 0x6A,
+    0xCD, 0xEF, 0x92, 0xFF, 0x55, 0x53, 0xF8, 0x0F, 0x8C, 0x1A, 0x5E, 0xA9, 0x8B, 0xE3, 0x04, 0xB7,
+    0x99, 0xBF, 0x1A, 0xBA, 0x44, 0x14, 0xA8, 0xEC, 0x72, 0xEB, 0x36, 0xF0, 0xFA, 0x80, 0x58, 0xA1,
+    0x48, 0x5B, 0x7B, 0xCA, 0xCC, 0x31, 0x43, 0x1E, 0x16, 0x70, 0x95, 0x14, 0xB7, 0xB5, 0x90, 0x68,
+    0x64, 0xC2, 0x2A, 0x69, 0x21, 0x0F, 0xC5, 0x60, 0x4E, 0x90, 0xED, 0x8B, 0x89, 0x32, 0xD8, 0x59,
+    0x71, 0x42, 0x83, 0xEB, 0x81, 0x4A, 0x4F, 0x95, 0x27, 0x38, 0xAB, 0x6E, 0xA4, 0x36, 0xCC, 0x5F,
+    0xFC, 0x57, 0x88, 0x70, 0x36, 0xE8, 0xEA, 0x23, 0xD9, 0x0C, 0xB4, 0x62, 0x95, 0xE5, 0xDF, 0x87,
+    0x9B, 0xCD, 0x2C, 0x31, 0xBD, 0x90, 0xAD, 0x35, 0x49, 0x99, 0x5A, 0x84, 0xA0, 0x3A, 0x57, 0x1A,
+    0xF3, 0x83, 0x41, 0xAC, 0x5A, 0x7F, 0x4A, 0xC0, 0xD3, 0x73, 0x63, 0x46, 0x60, 0x6B, 0x5C, 0x67,
+    0x9A, 0xC3, 0x62, 0xA6, 0x0F, 0x8B, 0x58, 0x05, 0x15, 0xCC, 0xE0, 0xBC, 0xF9, 0xAA, 0x2F, 0x16,
+    0x0C, 0xBC, 0x58, 0x45, 0x39, 0x31, 0xDC, 0x60, 0xD0, 0xAC, 0xFD, 0x99, 0xDA, 0xF0, 0x97, 0x8A,
+    0x87, 0x88, 0x75, 0x63, 0xA4, 0xF2, 0xD1, 0xD3, 0x7B, 0x62, 0x47, 0xA4, 0x9E, 0x0A, 0x40, 0x04,
+    0xA5, 0x2A, 0xE8, 0x0E, 0x24, 0x7C, 0x09, 0xEC, 0x46, 0x18, 0xC1, 0x78, 0xF7, 0x35, 0x77, 0x51,
+    0x0D, 0x77, 0xEB, 0xE6, 0x52, 0x75, 0x6D, 0xD2, 0xDF, 0xC0, 0x2B, 0x2D, 0x97, 0x01, 0x92, 0x1F,
+    0x9C, 0xA4, 0x09, 0xE2, 0xC2, 0xB6, 0xA9, 0x64, 0x6A, 0x88, 0x02, 0xCE, 0x63, 0x40, 0xAB, 0x45,
+    0x6C, 0x6B, 0xFE, 0x14, 0x0B, 0xF0, 0x6A, 0x12, 0x19, 0x04, 0x99, 0x6A, 0x9D, 0x79, 0xCA, 0xFE,
+    0x72, 0x62, 0x35, 0x23, 0xED, 0x8E, 0x23, 0x46, 0x5A, 0xEF, 0x68, 0x91, 0x45, 0xEE, 0x11, 0x9C,
+    0xA7, 0x70, 0x40, 0x32, 0xF4, 0x15, 0x4B, 0xB3, 0xC4, 0x51, 0xA7, 0x10, 0x62, 0x01, 0x0A, 0x2C,
+    0x95, 0xDF, 0xC2, 0xF9, 0xBF, 0x82, 0x54, 0x84, 0x92, 0x9C, 0x08, 0x83, 0xE9, 0x8B, 0x7D, 0x64,
+    0x1F, 0x8C, 0x45, 0xB2, 0xA1, 0xF6, 0xD2, 0x29, 0x87, 0x79, 0xCF, 0x85, 0xCD, 0x06, 0x47, 0xAB,
+    0xE3, 0xF9, 0xF4, 0xC7, 0xB9, 0xCD, 0x66, 0xF3, 0x26, 0x4E, 0x82, 0xD9, 0x6D, 0x8F, 0x03, 0x39,
+    0x48, 0xE5, 0x26, 0xF5, 0xCC, 0xF1, 0x09, 0xA2, 0xFE, 0x06, 0xBD, 0x54, 0xBF, 0x8F, 0xDD, 0x44,
+    0x10, 0x1E, 0x7B, 0xE1, 0x0C, 0xB7, 0x22, 0x9B, 0x22, 0x57, 0x80, 0x00, 0x53, 0x50, 0x24, 0x27,
+    0xC0, 0xF4, 0x97, 0xBB, 0xB5, 0xEE, 0x15, 0x29, 0x28, 0x48, 0x91, 0xD4, 0xF0, 0x1F, 0xD0, 0xA4,
+    0xA0, 0xB8, 0x3B, 0x5B, 0xF9, 0x03, 0x10, 0x0D, 0x12, 0x52, 0x9A, 0x27, 0x41, 0x81, 0xAE, 0x42,
+    0x28, 0x05, 0x12, 0x07, 0x36, 0x97, 0x02, 0x21, 0x84, 0xB4, 0x21, 0x12, 0xA2, 0x42, 0xE6, 0x47,
+    0x8D, 0x16, 0xB0, 0x84, 0xC5, 0xAD, 0xDF, 0xF0, 0xCD, 0xFA, 0xBD, 0x70, 0x27, 0x5D, 0x44, 0xC7,
+    0xEA, 0xD9, 0x9E, 0xB7, 0x3B, 0x3B, 0x3F, 0xBE, 0xF9, 0x66, 0x88, 0x64, 0xB1, 0xAC, 0x7B, 0xF1,
+    0x5D, 0xC8, 0x6B, 0xA0, 0x53, 0xEB, 0x51, 0x87, 0xA6, 0x1E, 0x68, 0x3F, 0x73, 0xA9, 0x2F, 0xA2,
+    0xB8, 0xAD, 0x20, 0xE6, 0x64, 0xDA, 0x20, 0x62, 0x02, 0x51, 0xB7, 0x47, 0xB4, 0xA3, 0xBA, 0xA4,
+    0xCF, 0xCB, 0xA5, 0x48, 0xBD, 0x29, 0xB3, 0x76, 0x8F, 0xAC, 0xF2, 0x10, 0x6B, 0x11, 0x29, 0xB9,
+    0x89, 0x95, 0xC1, 0xEE, 0xA8, 0xF1, 0x0A, 0xFF, 0xFA, 0xCD, 0xF1, 0xB7, 0x17, 0x8F, 0x7E, 0x03,
+    0x1A, 0xD7, 0xB1, 0x31, 0x28, 0x26, 0xDB, 0xEA, 0x81, 0x98, 0x0A, 0xAF, 0x46, 0xE8, 0x34, 0xCE,
+    0x7A, 0xE3, 0xF5, 0xA0, 0x82, 0x5A, 0x24, 0x1C, 0xA3, 0x6D, 0x6D, 0x97, 0x7B, 0xD3, 0x67, 0x41,
+    0x8D, 0xE9, 0x82, 0xCE, 0xBD, 0x45, 0xD5, 0x4F, 0x5C, 0x5A, 0xCF, 0xB5, 0xF1, 0x15, 0x0E, 0xAC,
+    0x53, 0xC1, 0xF8, 0x94, 0x45, 0x65, 0x16, 0xCF, 0x53, 0x7E, 0x3D, 0x28, 0x36, 0x83, 0xEC, 0xEB,
+    0xA1, 0x70, 0xA2, 0x67, 0x3B, 0x2E, 0xAB, 0xE3, 0xF3, 0x7D, 0xFC, 0x97, 0xC5, 0x0F, 0x89, 0x0E,
+    0x88, 0x0A, 0x60, 0xD6, 0x12, 0x50, 0x48, 0x7A, 0xA2, 0x23, 0x22, 0x2B, 0x39, 0x2A, 0xE6, 0x63,
+    0xE6, 0xDF, 0x05, 0xD5, 0xFD, 0x95, 0x4A, 0xD6, 0x51, 0x0A, 0x15, 0x60, 0xB1, 0x03, 0x95, 0x32,
+    0xDE, 0xF2, 0x94, 0x40, 0xE5, 0xF3, 0x78, 0x4B, 0xD7, 0x44, 0x8E, 0xE8, 0x55, 0xA2, 0xC7, 0x56,
+    0x60, 0xAD, 0xD7, 0x51, 0x59, 0x2C, 0x43, 0x5B, 0x94, 0x44, 0x5D, 0x4F, 0x62, 0xC3, 0x1E, 0x00,
+    0x3B, 0xCB, 0x5C, 0x8A, 0xD1, 0xCC, 0xC5, 0xDD, 0x28, 0x76, 0xB4, 0xDE, 0xFC, 0x06, 0x85, 0x01,
+    0x0A, 0x9E, 0x8A, 0x32, 0xEE, 0xC2, 0x19, 0xE5, 0x75, 0x8C, 0x31, 0x81, 0xA8, 0x20, 0x3E, 0x09,
+    0xFD, 0x8B, 0x4B, 0x5F, 0xE9, 0xE1, 0xE1, 0x9C, 0x2A, 0x66, 0x32, 0xCC, 0x1D, 0xE8, 0xB1, 0x20,
+    0x54, 0xC9, 0x21, 0x91, 0x11, 0x86, 0xB8, 0xC5, 0x6E, 0x48, 0x50, 0xB6, 0x16, 0xFE, 0xC4, 0x2C,
+    0xD7, 0x52, 0x48, 0xA9, 0xE6, 0xAE, 0x14, 0x13, 0xBB, 0x2C, 0x95, 0x86, 0xE1, 0xB7, 0xD5, 0x68,
+    0xC6, 0xEA, 0x6F, 0x7E, 0x0D, 0x0E, 0xD2, 0x79, 0xDE, 0x72, 0x36, 0xD8, 0xEE, 0xA1, 0xB0, 0xF6,
+    0xEE, 0x7A, 0x79, 0xC5, 0xB8, 0xA2, 0x5D, 0xE4, 0xCE, 0xD6, 0x0B, 0xDB, 0x36, 0xB7, 0xC7, 0xAA,
+    0x05, 0x9E, 0x97, 0xB6, 0xB7, 0x25, 0x8C, 0xEB, 0x91, 0x83, 0xB4, 0x8D, 0x88, 0xD5, 0x0F, 0xC8,
+    0x34, 0x7F, 0x13, 0xE8, 0x7C, 0x70, 0xCD, 0x51, 0x1A, 0x00, 0x76, 0x76, 0x0F, 0x0E, 0x62, 0x9A,
+    0x92, 0x4D, 0xCC, 0x4C, 0x30, 0x8D, 0x79, 0x25, 0xE1, 0xF2, 0x15, 0x32, 0xC7, 0xEF, 0xBD, 0x4F,
+    0xE1, 0xC2, 0x8F, 0xCE, 0xB8, 0xAD, 0x2D, 0x5A, 0xD0, 0xDD, 0xBB, 0x6B, 0xF3, 0x15, 0xB3, 0x11,
+    0x3F, 0x15, 0x9D, 0x0A, 0xD4, 0xD4, 0xF9, 0x92, 0x32, 0xA8, 0xFA, 0x57, 0xA0, 0x98, 0x0E, 0xE9,
+    0xC2, 0xF4, 0x13, 0x2F, 0xAC, 0xCB, 0x7D, 0xD3, 0x5A, 0x07, 0x54, 0xB1, 0x2E, 0xA4, 0xEE, 0x56,
+    0x31, 0xF3, 0xC1, 0x66, 0x6E, 0xD8, 0xD1, 0x5F, 0xFA, 0x3D, 0xB3, 0xDB, 0xC5, 0x7B, 0x49, 0x67,
+    0x13, 0x90, 0x7D, 0x4F, 0x64, 0x9D, 0x5D, 0xFB, 0xC5, 0x87, 0xA3, 0xDC, 0xCC, 0xBE, 0x9B, 0x0E,
+    0xE9, 0xB9, 0xAC, 0xFE, 0x78, 0xC7, 0x1C, 0xF7, 0x56, 0xB7, 0x43, 0x3E, 0x73, 0x47, 0xFA, 0x76,
+    0x77, 0x35, 0x1E, 0xAC, 0x95, 0x12, 0x6B, 0xE3, 0xB2, 0x93, 0xBE, 0x78, 0x10, 0x43, 0xA8, 0x13,
+    0x9F, 0x0E, 0xAA, 0xCF, 0x3A, 0x64, 0x04, 0xF0, 0x3D, 0x2A, 0xFC, 0x12, 0xA5, 0x38, 0x78, 0x51,
+    0x4A, 0x34, 0x92, 0xEE, 0xA8, 0x22, 0xED, 0x33, 0xD0, 0x16, 0x98, 0xBC, 0x1C, 0x8F, 0x60, 0xA7,
+    0x9E, 0x72, 0x72, 0xF1, 0x53, 0xB4, 0xF1, 0x63, 0xDB, 0x48, 0xE3, 0xEA, 0x1B, 0x54, 0xBB, 0x72,
+    0xC8, 0x15, 0x5B, 0x30, 0x0A, 0xD5, 0xA2, 0xCF, 0xC6, 0x08, 0x41, 0x2E, 0x68, 0x99, 0xB1, 0xC1,
+    0x3D, 0x75, 0x82, 0x62, 0xC3, 0xFE, 0x9F, 0x28, 0x6C, 0x20, 0xF3, 0x07, 0x7B, 0x78, 0xC8, 0x7F,
+    0x66, 0x41, 0xE8, 0x99, 0x3B, 0xEC, 0xD7, 0xC0, 0x6F, 0x1B, 0xE7, 0x42, 0x32, 0x75, 0xB0, 0xE6,
+    0x37, 0xA4, 0x51, 0x8A, 0xD1, 0x08, 0x36, 0xDC, 0x6B, 0x06, 0xA9, 0xD9, 0xE1, 0x07, 0xC6, 0x93,
+    0x92, 0xDA, 0xAF, 0x56, 0x3A, 0x81, 0x9E, 0x4D, 0x5B, 0xE6, 0xCC, 0xA7, 0xE8, 0x56, 0x5A, 0x2F,
+    0x10, 0x5D, 0x8D, 0x0D, 0x72, 0x24, 0x04, 0x05, 0xCB, 0x01, 0x01, 0x7E, 0xA0, 0x2F, 0xF2, 0x02,
+    0xE1, 0x8B, 0x9A, 0x6C, 0x29, 0xD5, 0x36, 0x88, 0xE1, 0xF4, 0xF0, 0x22, 0xC4, 0x66, 0x7A, 0xF9,
+    0x15, 0x5E, 0x52, 0x6C, 0xC4, 0xB2, 0x74, 0x8D, 0x2A, 0x27, 0x72, 0x8B, 0xC5, 0x48, 0x93, 0xB7,
+    0x7A, 0x19, 0x75, 0x2D, 0xF1, 0x49, 0x4F, 0xAF, 0x04, 0xEC, 0x1C, 0x88, 0xDD, 0x99, 0x27, 0x73,
+    0x7F, 0x80, 0xAF, 0x11, 0xAC, 0xA9, 0x88, 0xBE, 0x68, 0xE0, 0x06, 0x49, 0xE5, 0x78, 0x94, 0xB4,
+    0xBE, 0xE4, 0x59, 0x01, 0x37, 0x0B, 0x9C, 0x4C, 0x49, 0x67, 0xD7, 0x26, 0x2D, 0x0F, 0xE0, 0x48,
+    0x4B, 0x63, 0x71, 0x84, 0x9D, 0x62, 0x18, 0x9B, 0x1F, 0xE1, 0xCF, 0xC6, 0xCD, 0x1B, 0x96, 0xC7,
+    0x8A, 0xC3, 0xF3, 0xF4, 0x69, 0xC3, 0xF7, 0x19, 0x14, 0x83, 0xB1, 0x4B, 0x38, 0xB9, 0x55, 0x93,
+    0xF9, 0x0C, 0x0F, 0x9C, 0x48, 0x45, 0x2C, 0xAE, 0x6E, 0x7C, 0x5F, 0xD3, 0x27, 0x0F, 0xBE, 0x7E,
+    0xEA, 0x2F, 0x0E, 0x05, 0x37, 0x9D, 0x1E, 0xAA, 0x5F, 0xD1, 0x79, 0xFD, 0xD6, 0xB7, 0xEF, 0x5C,
+    0x54, 0xF5, 0x13, 0x0F, 0xBD, 0x0E, 0x2B, 0xD2, 0xCB, 0x24, 0x90, 0x91, 0x12, 0xE7, 0x46, 0x9C,
+    0x0D, 0x82, 0xD8, 0x72, 0x5F, 0x72, 0x96, 0x66, 0x27, 0x25, 0xFB, 0x5A, 0xE8, 0x51, 0x08, 0x55,
+    0x0E, 0x44, 0x35, 0xAC, 0x4A, 0x12, 0x69, 0xB3, 0x79, 0x26, 0xAF, 0x0D, 0xA2, 0xC7, 0x4B, 0x54,
+    0x3A, 0x50, 0xB5, 0xC0, 0xA4, 0xE4, 0x16, 0xBD, 0x9C, 0x2C, 0x76, 0xFB, 0xAA, 0x1E, 0xE9, 0x32,
+    0x1D, 0xAC, 0xC7, 0x16, 0xC3, 0x23, 0xAE, 0xF4, 0x34, 0xC9, 0xD4, 0x34, 0xCD, 0xC4, 0x2C, 0x30,
+    0x04, 0x95, 0xA8, 0x2A, 0x09, 0x93, 0x33, 0x69, 0x6A, 0xCA, 0x17, 0xA0, 0x06, 0xF2, 0x1C, 0x81,
+    0x0E, 0x30, 0x45, 0x75, 0x91, 0xB1, 0x3C, 0x8D, 0x50, 0xA7, 0x8C, 0x54, 0xB5, 0x50, 0x83, 0xB5,
+    0xA7, 0x63, 0x57, 0x3C, 0x62, 0x55, 0x53, 0xFC, 0x50, 0x35, 0x50, 0x85, 0x7A, 0x26, 0xB3, 0x10,
+    0x4C, 0x81, 0xB7, 0x14, 0x50, 0x1F, 0x9E, 0xD2, 0xBD, 0x21, 0x1C, 0xC8, 0x51, 0x88, 0x67, 0x49,
+    0x06, 0xD1, 0x8E, 0x84, 0x8F, 0xF1, 0x39, 0x47, 0x47, 0xED, 0xC7, 0xC9, 0x89, 0x40, 0xD3, 0xF8,
+    0x56, 0xBD, 0xC4, 0x9F, 0x79, 0xC1, 0xD3, 0x48, 0xE3, 0x51, 0xD3, 0x22, 0x29, 0xCD, 0x82, 0x8C,
+    0x1D, 0x28, 0x6F, 0x25, 0x40, 0x38, 0x06, 0x07, 0x50, 0x7E, 0xC4, 0x9C, 0x4E, 0x9C, 0x40, 0xDB,
+    0x9F, 0x1F, 0x27, 0x60, 0x45, 0x92, 0x88, 0x31, 0x0B, 0x12, 0xA5, 0x19, 0x84, 0x21, 0xF9, 0x40,
+    0x9B, 0xA0, 0x70, 0x1F, 0x49, 0x33, 0xA7, 0xFF, 0x6F, 0xFD, 0x03, 0xB5, 0x55, 0xBF, 0x6B, 0x25,
+    0x55, 0x14, 0x3E, 0x73, 0xEF, 0x26, 0x03, 0x19, 0x93, 0x9B, 0x66, 0xD7, 0x05, 0x35, 0x63, 0x61,
+    0x21, 0x4B, 0xB2, 0x63, 0x21, 0x18, 0xF4, 0xBD, 0xCC, 0xA0, 0x60, 0xA7, 0x79, 0x82, 0x56, 0x22,
+    0xB6, 0x0A, 0xE2, 0x5A, 0x2C, 0x98, 0x22, 0xD9, 0x19, 0x14, 0xB4, 0xB0, 0x48, 0x1A, 0xFB, 0x14,
+    0x5B, 0x2C, 0x01, 0x89, 0x42, 0x8A, 0x57, 0xAC, 0x79, 0x77, 0x13, 0x30, 0xC5, 0x36, 0x4F, 0x17,
+    0x37, 0x95, 0x30, 0x59, 0x91, 0x15, 0x1B, 0xEF, 0x2E, 0x83, 0x3B, 0xC9, 0x9B, 0x99, 0xEB, 0x77,
+    0xEE, 0xBC, 0x47, 0xF0, 0x0F, 0x70, 0x48, 0x4E, 0x66, 0xEE, 0x3D, 0xBF, 0xBF, 0xEF, 0x9C, 0x10,
+    0xB5, 0xCF, 0xFC, 0x54, 0x8F, 0xC8, 0x3B, 0xB0, 0x25, 0x51, 0x60, 0x59, 0xC6, 0xB5, 0x6F, 0xC8,
+    0x1B, 0x25, 0x81, 0x26, 0xFC, 0x44, 0x09, 0xC5, 0x44, 0x15, 0x79, 0x25, 0x49, 0x43, 0x6A, 0x48,
+    0x51, 0x86, 0x03, 0xE1, 0x0E, 0xD2, 0x21, 0x0E, 0xA2, 0x1A, 0x26, 0x9E, 0xD5, 0xE4, 0x55, 0x01,
+    0xAC, 0x45, 0x1E, 0x6B, 0xC8, 0xC4, 0xB2, 0xEF, 0xA0, 0x60, 0xF9, 0x02, 0xFD, 0xE7, 0x99, 0xD9,
+    0x66, 0x19, 0x6B, 0xD8, 0x09, 0xEB, 0x43, 0x43, 0x55, 0x6C, 0x32, 0xC8, 0x61, 0x22, 0xED, 0x57,
+    0xB7, 0x26, 0x7A, 0x17, 0x58, 0x88, 0xA1, 0x53, 0x76, 0xAF, 0xCE, 0x99, 0xCA, 0x58, 0xDE, 0x66,
+    0x21, 0xF3, 0xF1, 0xDD, 0xF4, 0x96, 0xC7, 0x79, 0x27, 0x4A, 0x73, 0x62, 0x1B, 0x50, 0x32, 0xC8,
+    0x95, 0x52, 0x8D, 0xE4, 0x89, 0x93, 0xE7, 0x54, 0x9C, 0xA3, 0xD4, 0xD9, 0x19, 0x96, 0x61, 0x76,
+    0x7E, 0x97, 0x9F, 0x07, 0x29, 0xF9, 0x24, 0x3C, 0x62, 0x95, 0x9A, 0xD3, 0xF2, 0x1F, 0x71, 0x25,
+    0xF1, 0x9B, 0x37, 0x89, 0x7D, 0x73, 0x02, 0xCE, 0xD1, 0xE0, 0xDC, 0x51, 0xCC, 0x8E, 0xBC, 0xF6,
+    0xCE, 0x39, 0xDA, 0x70, 0x77, 0xCE, 0xFD, 0xBC, 0xAB, 0x44, 0xE4, 0xCB, 0xBF, 0x1C, 0xBE, 0xFD,
+    0xDB, 0x2B, 0x3F, 0xDC, 0x3B, 0xAA, 0x9D, 0xF9, 0xBC, 0xD0, 0x91, 0xB8, 0xB5, 0x78, 0x62, 0x75,
+    0x97, 0x0C, 0xBD, 0x2B, 0x1B, 0x9F, 0x82, 0x44, 0x15, 0xD4, 0xB9, 0xDC, 0x8F, 0x0D, 0x1A, 0x7C,
+    0xD1, 0x6B, 0x64, 0x32, 0x93, 0xA8, 0x72, 0x61, 0x71, 0xB1, 0x13, 0x9A, 0xE9, 0xE4, 0xE2, 0x3B,
+    0x56, 0x2B, 0xBA, 0x2E, 0xF5, 0x55, 0x32, 0x41, 0xD6, 0x71, 0x01, 0xE5, 0x5B, 0xFE, 0x73, 0xB2,
+    0x9C, 0x5B, 0x5B, 0xEC, 0xC4, 0x65, 0x98, 0x73, 0x7A, 0x73, 0xB3, 0x4F, 0xCD, 0x3E, 0xBB, 0xA8,
+    0x2A, 0xAF, 0xFF, 0xAA, 0x89, 0x87, 0x6D, 0x17, 0xBD, 0x7F, 0x6A, 0x52, 0xB6, 0xA6, 0x78, 0x54,
+    0x8A, 0x5A, 0x1A, 0x35, 0x54, 0x59, 0x4C, 0x37, 0x44, 0x29, 0x0A, 0xBC, 0xEA, 0x38, 0x49, 0x45,
+    0x25, 0x2B, 0x65, 0x54, 0x9E, 0x66, 0x83, 0x44, 0xE4, 0x73, 0x2F, 0x2F, 0x7D, 0xF4, 0xDA, 0xDE,
+    0xE7, 0x7B, 0xD7, 0x4D, 0x3A, 0x8C, 0x33, 0x40, 0xD0, 0x53, 0xFA, 0x53, 0xBA, 0x2E, 0x10, 0x7D,
+    0x4D, 0x55, 0x69, 0x2E, 0xCA, 0xE0, 0x3B, 0x9A, 0xA3, 0x25, 0xEA, 0x4B, 0x13, 0xEA, 0xB8, 0x48,
+    0x8D, 0x28, 0xA7, 0x3F, 0xA0, 0x59, 0xEF, 0x13, 0x89, 0xF4, 0xA3, 0x22, 0xE6, 0x0E, 0x3C, 0x2F,
+    0x75, 0x2C, 0xD7, 0x96, 0x1F, 0xD8, 0x3B, 0x1B, 0x28, 0x8F, 0x64, 0x1D, 0xA0, 0x33, 0x53, 0x6B,
+    0xB4, 0x16, 0x19, 0xD7, 0xAC, 0x81, 0xFC, 0x03, 0x27, 0x45, 0xB8, 0x8E, 0xEA, 0x3A, 0x11, 0xCA,
+    0x23, 0xCF, 0xDE, 0xF9, 0x90, 0xCB, 0x5B, 0xE0, 0xF2, 0xBA, 0x9C, 0x77, 0x4D, 0x0F, 0xF4, 0x67,
+    0x66, 0x61, 0x4F, 0x96, 0xF2, 0x1B, 0x71, 0xA0, 0x07, 0xF9, 0xCC, 0x16, 0x6A, 0xF6, 0x8E, 0xB3,
+    0xE1, 0xF6, 0x4B, 0xCB, 0x73, 0x3F, 0x7A, 0x16, 0x1D, 0xB6, 0xFA, 0x12, 0x03, 0x2C, 0x12, 0x07,
+    0x82, 0x00, 0x07, 0x22, 0xED, 0x90, 0xE0, 0x26, 0x37, 0xC0, 0xD5, 0x30, 0x2B, 0xDC, 0x05, 0xA8,
+    0x41, 0xFB, 0x48, 0x05, 0x1C, 0x0A, 0xCF, 0x5F, 0xF9, 0x34, 0x6E, 0xC1, 0x03, 0xE7, 0xDD, 0x4D,
+    0x3A, 0xFE, 0x2C, 0x5A, 0x2F, 0x9C, 0x2F, 0x08, 0xE0, 0x31, 0x59, 0xFB, 0x44, 0x97, 0x5B, 0xA7,
+    0x08, 0xC3, 0xFE, 0x65, 0xD9, 0xDA, 0x0C, 0xDA, 0xD7, 0x49, 0x0C, 0x56, 0xC8, 0x1C, 0xB5, 0xD8,
+    0xC3, 0x8D, 0xD6, 0x77, 0xDC, 0x46, 0x44, 0x3A, 0xAC, 0x0A, 0xB7, 0x93, 0x2F, 0xFC, 0x49, 0x13,
+    0xE7, 0x15, 0x71, 0x80, 0xA3, 0xF8, 0x93, 0xCB, 0x5F, 0x58, 0x82, 0xE8, 0xAC, 0x43, 0xAC, 0x23,
+    0x2C, 0x15, 0xB8, 0xF6, 0x1E, 0xE7, 0x3C, 0xA2, 0x10, 0x16, 0xC2, 0xB7, 0x18, 0xB9, 0x90, 0x45,
+    0xDA, 0xA0, 0x61, 0xB6, 0x5A, 0x27, 0xD9, 0xF4, 0x0B, 0xF2, 0xAB, 0x47, 0x18, 0xD3, 0xB3, 0xDF,
+    0x31, 0x9A, 0x4F, 0x8E, 0xA0, 0x31, 0xBA, 0x9B, 0x51, 0x64, 0x57, 0x91, 0x92, 0x8D, 0xBE, 0x87,
+    0xB0, 0x86, 0xAD, 0xA0, 0x32, 0x76, 0x92, 0x63, 0xE6, 0xEC, 0x90, 0x24, 0x74, 0x29, 0xD8, 0x44,
+    0x27, 0x55, 0x38, 0x09, 0x3F, 0x26, 0xD0, 0xEE, 0x59, 0x1B, 0x31, 0xB5, 0x15, 0xDB, 0x6B, 0xDF,
+    0x42, 0xCB, 0xA2, 0x40, 0xC6, 0xDA, 0x67, 0xDE, 0xDB, 0x6C, 0xA4, 0x01, 0x67, 0xE5, 0x59, 0x71,
+    0x9A, 0x44, 0x66, 0x05, 0x73, 0x7D, 0x7C, 0xEC, 0x62, 0x79, 0xD6, 0xDA, 0x36, 0x54, 0x6A, 0x1B,
+    0xA0, 0x6C, 0x87, 0x13, 0xB7, 0x3D, 0xAE, 0x25, 0x41, 0x2E, 0x05, 0xB8, 0x91, 0x92, 0xC4, 0x05,
+    0xF2, 0xE2, 0x15, 0xA4, 0xBD, 0x6B, 0xDF, 0xF6, 0xC8, 0xE7, 0xE6, 0xC3, 0x06, 0xC6, 0x89, 0x1B,
+    0x7A, 0x3F, 0x6F, 0x51, 0x89, 0x2A, 0xD6, 0x6C, 0x12, 0x68, 0x1A, 0xA4, 0x5E, 0x3B, 0x6F, 0xDC,
+    0xE1, 0x41, 0xC2, 0x73, 0x6C, 0x33, 0x34, 0xDD, 0xB3, 0x19, 0x70, 0x11, 0x56, 0x03, 0x07, 0x69,
+    0xC1, 0x72, 0x54, 0x3A, 0x4C, 0x5D, 0xF7, 0x80, 0x95, 0xB2, 0x79, 0xC3, 0xC1, 0x60, 0x1C, 0xB3,
+    0x2C, 0x29, 0x3E, 0x7A, 0x02, 0x50, 0xD2, 0x43, 0xCB, 0x28, 0xB4, 0xF2, 0x4B, 0xE4, 0x2C, 0xEC,
+    0xEB, 0xE8, 0xAF, 0xB4, 0xBC, 0xDD, 0x7C, 0x48, 0x64, 0x31, 0xB3, 0xC3, 0x2D, 0xE2, 0x35, 0x19,
+    0x72, 0xE8, 0x28, 0x4B, 0x39, 0x43, 0x5B, 0x5D, 0xB1, 0x3B, 0x83, 0x9B, 0xB4, 0x0F, 0x5A, 0xA2,
+    0x57, 0xAE, 0xD2, 0x0A, 0xE6, 0xF0, 0x24, 0x39, 0x7F, 0xBF, 0xD9, 0x1A, 0x2F, 0x43, 0xC5, 0x2B,
+    0x23, 0x64, 0x11, 0xF1, 0xA4, 0xB8, 0x71, 0x49, 0x5D, 0x53, 0xA2, 0xD2, 0x6D, 0x10, 0x84, 0x02,
+    0x53, 0x7E, 0xE5, 0x0F, 0xCF, 0x30, 0x14, 0xD4, 0xF7, 0xF9, 0xA8, 0x2B, 0x58, 0x55, 0x51, 0x41,
+    0x61, 0xE1, 0xDF, 0xAF, 0x28, 0x6C, 0x04, 0xE2, 0x04, 0x09, 0x41, 0x0A, 0x90, 0x00, 0xC9, 0xED,
+    0x53, 0x74, 0x0F, 0xC0, 0x96, 0x2A, 0xC7, 0x7A, 0xBC, 0xF6, 0x46, 0xC1, 0xEC, 0x3A, 0xC1, 0xC2,
+    0x11, 0xF7, 0xCB, 0x81, 0x5F, 0x08, 0x5B, 0xC5, 0x07, 0x35, 0xD9, 0x7A, 0xAA, 0xF7, 0x1E, 0x05,
+    0xE5, 0x18, 0x06, 0x78, 0xF5, 0x33, 0x5E, 0xEC, 0x19, 0xB6, 0xA9, 0x4A, 0x20, 0x42, 0xDE, 0xAB,
+    0x57, 0x21, 0xF6, 0xBA, 0xAE, 0x49, 0x15, 0xF7, 0xA8, 0x78, 0xFA, 0x61, 0x7D, 0xDA, 0x93, 0x0F,
+    0x6B, 0x14, 0xF4, 0x77, 0xE3, 0xAA, 0x62, 0xE2, 0x20, 0x73, 0xD9, 0xA4, 0x68, 0x51, 0x95, 0x66,
+    0xA0, 0x02, 0x78, 0xEC, 0x17, 0x31, 0xA3, 0xC1, 0xBB, 0xF4, 0x63, 0x9E, 0x4D, 0x64, 0x77, 0x01,
+    0x1D, 0xD1, 0x2B, 0x9E, 0x7D, 0x3F, 0xEF, 0x8A, 0x42, 0x98, 0xDB, 0x32, 0xF7, 0xF2, 0x4A, 0xFE,
+    0xF4, 0x45, 0x5E, 0xFA, 0x77, 0x0F, 0x7F, 0x36, 0x6A, 0xF3, 0xF0, 0xC0, 0xA8, 0xD5, 0xAF, 0x0F,
+    0xF3, 0x50, 0x25, 0xFE, 0x30, 0x0A, 0x33, 0xA5, 0x57, 0x54, 0x1E, 0xE9, 0x2E, 0x1A, 0x9B, 0xBD,
+    0x28, 0xB8, 0x7F, 0x74, 0x69, 0xD7, 0xFD, 0xE7, 0x98, 0xAC, 0x7E, 0x10, 0x05, 0x80, 0x30, 0xF5,
+    0x30, 0x21, 0xFE, 0x08, 0x9D, 0x19, 0x40, 0x2B, 0x38, 0xC6, 0x49, 0x07, 0x24, 0x10, 0x43, 0x2C,
+    0x7E, 0xC5, 0x03, 0xD8, 0x7D, 0x86, 0xB1, 0x44, 0x6F, 0x04, 0xA3, 0x25, 0x1A, 0xD3, 0x56, 0x1D,
+    0x72, 0xFA, 0x4C, 0xCD, 0xF1, 0x03, 0x76, 0xA0, 0xF3, 0x60, 0x22, 0x7C, 0x06, 0xA7, 0x53, 0xE4,
+    0x3B, 0x7C, 0x2B, 0x86, 0x96, 0xA6, 0x07, 0x67, 0x99, 0x9B, 0x67, 0xF5, 0xD7, 0x36, 0x38, 0x5D,
+    0x39, 0x9A, 0xCE, 0xF0, 0xFE, 0xE7, 0xA5, 0xEB, 0xB7, 0x60, 0xF3, 0x8C, 0x81, 0x76, 0x83, 0xD6,
+    0xFF, 0x95, 0x9D, 0x9D, 0x9D, 0x55, 0xB8, 0x3F, 0xC2, 0xEF, 0x63, 0x47, 0x30, 0x75, 0xC2, 0x14,
+    0x64, 0x4A, 0x1A, 0x90, 0xB0, 0x70, 0x30, 0x4B, 0xB6, 0xD8, 0x1C, 0xF1, 0x0B, 0x4F, 0x22, 0x1F,
+    0x6E, 0xB5, 0x4A, 0xBB, 0x70, 0xC3, 0x08, 0xC9, 0x9A, 0xFE, 0xBF, 0xE7, 0x5F, 0x95, 0x55, 0x3D,
+    0x6C, 0xDD, 0x54, 0x14, 0x3E, 0xF6, 0x6D, 0xF2, 0x50, 0x2C, 0xE1, 0x0E, 0xA5, 0xAA, 0xE8, 0xE0,
+    0x85, 0x95, 0x9A, 0x81, 0x91, 0xBC, 0x7B, 0x49, 0x07, 0x86, 0x2E, 0x1D, 0x00, 0x31, 0x20, 0x65,
+    0x41, 0x0C, 0x2C, 0x59, 0x8B, 0xF4, 0x1E, 0x76, 0x85, 0x04, 0x43, 0x87, 0x64, 0xA8, 0xD4, 0xAD,
+    0xE9, 0xC0, 0x00, 0x5D, 0xBA, 0x74, 0x08, 0x52, 0x52, 0xDF, 0x52, 0x89, 0x0E, 0x1D, 0x62, 0x5A,
+    0xC1, 0xD2, 0xA1, 0xAE, 0x5A, 0x14, 0x81, 0x90, 0x7A, 0x55, 0x5C, 0x70, 0xE0, 0xDA, 0x87, 0xEF,
+    0x5C, 0xBF, 0xB6, 0x33, 0x57, 0x79, 0x27, 0xF6, 0xF5, 0xF5, 0xF9, 0xF9, 0xCE, 0x77, 0x3E, 0x53,
+    0x7C, 0x75, 0x8B, 0x88, 0x52, 0xEE, 0x60, 0x0B, 0x58, 0xC5, 0x58, 0x1D, 0xA5, 0x36, 0xB5, 0xB8,
+    0xC7, 0x32, 0x71, 0x37, 0xF1, 0x72, 0x82, 0x6B, 0x39, 0xC1, 0x44, 0x31, 0xB3, 0x93, 0x8D, 0x5E,
+    0x5E, 0xF9, 0x0D, 0x26, 0x96, 0x2B, 0x4A, 0x9D, 0xD8, 0xC2, 0xCA, 0xC6, 0x10, 0x36, 0xBA, 0xB0,
+    0x51, 0xD3, 0xB8, 0x8E, 0xE1, 0xA7, 0x1A, 0xD9, 0x2F, 0x61, 0xE6, 0x72, 0x4C, 0xDE, 0xB8, 0xC6,
+    0x5B, 0xA4, 0x99, 0xCB, 0x09, 0xC3, 0x61, 0xC1, 0xBF, 0x5F, 0x57, 0x9C, 0x13, 0xE5, 0x0E, 0x31,
+    0x19, 0xC7, 0x93, 0x2E, 0x33, 0xA4, 0xEB, 0x3D, 0x43, 0x8C, 0xB8, 0xEF, 0x79, 0x84, 0xCD, 0x9B,
+    0x69, 0xD5, 0x56, 0x37, 0x5D, 0xB5, 0xC6, 0xF7, 0xEF, 0x77, 0x78, 0x8F, 0x6B, 0x64, 0xC7, 0x92,
+    0x62, 0x47, 0xCB, 0x7C, 0x08, 0xA7, 0xFE, 0x45, 0x2C, 0x43, 0xCF, 0xD7, 0x87, 0x72, 0x39, 0x09,
+    0x85, 0x2A, 0x96, 0x04, 0x63, 0xC3, 0xE1, 0x41, 0xF1, 0xDC, 0x8A, 0x2B, 0xF6, 0x69, 0x40, 0x60,
+    0xE9, 0x03, 0xAC, 0xB3, 0xA3, 0xCD, 0x65, 0xC7, 0x69, 0xB1, 0x75, 0x6E, 0x23, 0x54, 0xA8, 0x1F,
+    0x6E, 0xC0, 0x7B, 0x1E, 0x80, 0x48, 0x24, 0x2C, 0x45, 0xD5, 0x50, 0xBE, 0x08, 0x45, 0x67, 0x29,
+    0x72, 0x52, 0xDE, 0x49, 0x4F, 0xEC, 0x15, 0xFF, 0x91, 0x70, 0x99, 0xEE, 0x9B, 0x7C, 0x9B, 0xF4,
+    0x06, 0xE9, 0x29, 0xE9, 0x0A, 0x25, 0x97, 0x19, 0xD7, 0x31, 0x97, 0xD4, 0x52, 0x74, 0x25, 0xC0,
+    0xDE, 0x47, 0x12, 0xEC, 0xA5, 0x13, 0x09, 0x68, 0xC4, 0x50, 0xC5, 0x92, 0x70, 0x2A, 0x05, 0x65,
+    0x02, 0x67, 0x2E, 0x20, 0x6B, 0x89, 0x57, 0x48, 0x51, 0xA1, 0x0C, 0x31, 0x91, 0x94, 0xA5, 0xA4,
+    0x1B, 0x4A, 0x10, 0x48, 0xC4, 0xA4, 0x6D, 0x28, 0x98, 0x6B, 0xCD, 0x3E, 0x5A, 0xFF, 0xD5, 0xD0,
+    0xAA, 0x00, 0x65, 0x90, 0xFA, 0x32, 0xFF, 0x1C, 0xA3, 0x00, 0xED, 0x51, 0xB8, 0xA5, 0x4F, 0xF1,
+    0x5A, 0x82, 0x08, 0x70, 0x91, 0x35, 0xE8, 0x31, 0x02, 0xA0, 0x84, 0xEF, 0xC4, 0x03, 0xA2, 0xF9,
+    0x23, 0x94, 0x6D, 0x97, 0x38, 0x1E, 0x21, 0x93, 0xEA, 0xF0, 0x6C, 0xCA, 0x7B, 0xB4, 0xCD, 0x36,
+    0xE1, 0x67, 0x6B, 0xDC, 0xCC, 0x75, 0x97, 0xFF, 0xB0, 0xBE, 0xE1, 0x62, 0x00, 0xA1, 0x0F, 0x49,
+    0x7D, 0xB3, 0x28, 0x40, 0xFE, 0x23, 0x3A, 0xA0, 0xA0, 0x49, 0x2F, 0xE4, 0x41, 0x13, 0xD9, 0x22,
+    0x17, 0x3B, 0xE1, 0x7D, 0x9B, 0x3C, 0xD9, 0xB7, 0xE9, 0xFE, 0x66, 0x99, 0x6E, 0xAF, 0x9B, 0x2C,
+    0xCF, 0x29, 0xCF, 0x35, 0xB0, 0x99, 0xD2, 0x74, 0x75, 0x4E, 0xF3, 0x99, 0xA7, 0xBD, 0x5D, 0x4F,
+    0x47, 0x82, 0x9F, 0x95, 0xAB, 0x66, 0xD1, 0xB3, 0x28, 0xB0, 0x70, 0x88, 0x50, 0x98, 0x26, 0xD0,
+    0x24, 0x13, 0x9A, 0xA6, 0x4D, 0x86, 0xD0, 0xCC, 0xAD, 0xE0, 0xE4, 0xA5, 0x2B, 0x5E, 0x4A, 0x44,
+    0xE4, 0xEC, 0x1F, 0x43, 0xAF, 0xAD, 0x1F, 0xBE, 0x2F, 0xB7, 0x7D, 0xC0, 0x18, 0xDE, 0x2A, 0xC1,
+    0x4D, 0x07, 0x2C, 0x05, 0x1A, 0x8A, 0xE5, 0x76, 0x24, 0x63, 0x86, 0x47, 0x3E, 0xDA, 0x49, 0x7E,
+    0xE4, 0x06, 0x4C, 0x3F, 0xCD, 0x83, 0x41, 0x39, 0x54, 0xD9, 0x91, 0xC5, 0xF2, 0xD3, 0xC8, 0xE4,
+    0xED, 0x97, 0x2D, 0x22, 0x21, 0x03, 0xBA, 0x21, 0x00, 0x56, 0x6C, 0x11, 0xE6, 0xFC, 0x30, 0x2F,
+    0x36, 0xEF, 0xBA, 0xDD, 0x13, 0xA9, 0x35, 0x34, 0xC5, 0x01, 0xC4, 0x48, 0x6C, 0x88, 0x40, 0xA0,
+    0x49, 0x5C, 0x06, 0xE2, 0x91, 0x24, 0x1F, 0xF6, 0xBE, 0xA0, 0xCF, 0x69, 0x2F, 0xE2, 0xC7, 0x60,
+    0x09, 0xD0, 0xDB, 0x40, 0xD6, 0x51, 0x85, 0x4C, 0xC0, 0x0B, 0x19, 0x1F, 0x20, 0xA6, 0xE0, 0x60,
+    0xB2, 0x60, 0xF1, 0xB7, 0x80, 0xC1, 0x8D, 0xFE, 0x84, 0xD8, 0xF2, 0xFE, 0x2E, 0xA9, 0x77, 0xDB,
+    0x63, 0xF9, 0x97, 0x0F, 0x3B, 0xFD, 0x60, 0xDF, 0x65, 0x61, 0x0C, 0x1C, 0x38, 0x69, 0x68, 0xD2,
+    0x8E, 0x91, 0x64, 0x9D, 0x20, 0x7A, 0x83, 0xD0, 0x79, 0x9A, 0x11, 0xED, 0x48, 0xF0, 0xC8, 0x2D,
+    0x6F, 0xA5, 0x46, 0xFD, 0xC2, 0x7C, 0x09, 0x59, 0x0F, 0x15, 0xBB, 0x6C, 0x30, 0x51, 0xD5, 0xE9,
+    0x5A, 0xB8, 0x23, 0xA3, 0x9C, 0xBA, 0xD8, 0x07, 0x92, 0xED, 0x92, 0xD4, 0x71, 0x94, 0xA4, 0x19,
+    0x51, 0x49, 0x71, 0x87, 0x6A, 0x4D, 0xC2, 0x6D, 0xFA, 0xA0, 0x48, 0x6F, 0xDF, 0xB6, 0x6B, 0x8D,
+    0x91, 0x26, 0xBF, 0x03, 0xF4, 0x90, 0x59, 0x49, 0xAA, 0x0E, 0x21, 0x70, 0x33, 0x5E, 0xBD, 0x99,
+    0xBD, 0x9A, 0x1C, 0xDC, 0xA9, 0x0B, 0x6E, 0x84, 0x6C, 0x19, 0x3C, 0xBB, 0x31, 0xA7, 0xCF, 0xE8,
+    0xB8, 0xCC, 0x06, 0x6F, 0xA5, 0x83, 0x70, 0x1D, 0x6D, 0xE5, 0x52, 0xB9, 0xAA, 0x4E, 0x6D, 0xD1,
+    0x6A, 0x93, 0x35, 0x3B, 0xB4, 0x42, 0xEA, 0xA2, 0x3C, 0xBA, 0x18, 0x57, 0xF2, 0x2A, 0x23, 0x70,
+    0xA3, 0xF8, 0x46, 0xCC, 0x5F, 0x3F, 0xE4, 0xF2, 0x86, 0xAE, 0x93, 0xBA, 0xA6, 0xF9, 0x52, 0x88,
+    0x05, 0x91, 0x48, 0xED, 0x6C, 0x52, 0xEF, 0x28, 0xD7, 0xC6, 0xAD, 0xA3, 0xDE, 0x51, 0xD5, 0x1C,
+    0xD5, 0x20, 0xBD, 0x2D, 0xE4, 0xAF, 0xA4, 0xE3, 0x46, 0xB2, 0x87, 0xF6, 0x4C, 0x4F, 0xC5, 0x6E,
+    0x96, 0x96, 0x6E, 0x57, 0xDD, 0x73, 0xC9, 0x35, 0x93, 0x79, 0xC8, 0x0B, 0x78, 0xB9, 0xC6, 0x03,
+    0xC4, 0x61, 0xC5, 0x8C, 0x98, 0xB5, 0xA1, 0x35, 0x23, 0xC4, 0xC2, 0x0A, 0x11, 0x05, 0x0C, 0x3A,
+    0xDF, 0xF2, 0xE3, 0x60, 0x0E, 0x42, 0x38, 0x9B, 0x83, 0x45, 0x82, 0x52, 0xE8, 0xE6, 0x02, 0x6B,
+    0xD8, 0xE4, 0x63, 0xDC, 0x3D, 0x95, 0x2E, 0x02, 0xBE, 0xE2, 0x60, 0xA0, 0xAC, 0xAF, 0xDA, 0xE4,
+    0xDF, 0xFD, 0x6B, 0xB7, 0xFC, 0xAC, 0x1D, 0xA6, 0xE9, 0xF6, 0xE4, 0x66, 0xF9, 0xD4, 0x1D, 0xA5,
+    0x0C, 0xB8, 0xC6, 0x8F, 0x80, 0xD2, 0x2A, 0xDA, 0xA2, 0xEE, 0xA0, 0xAB, 0x33, 0xF4, 0x3C, 0xD9,
+    0x84, 0x97, 0x4F, 0xAE, 0x04, 0x67, 0xE5, 0x22, 0x95, 0x62, 0x31, 0x86, 0x51, 0x27, 0x49, 0x08,
+    0x91, 0x9D, 0xC8, 0x2E, 0x48, 0xDA, 0x07, 0xBA, 0x93, 0x48, 0x74, 0x98, 0x79, 0x78, 0xA2, 0x57,
+    0xF0, 0x7B, 0x26, 0x3C, 0xD9, 0x34, 0xA3, 0xCB, 0xE0, 0x5B, 0x82, 0xC4, 0x7F, 0x22, 0x5A, 0x3A,
+    0xA5, 0xD8, 0xFE, 0xE5, 0xDE, 0xD2, 0x67, 0xB6, 0x93, 0x9F, 0xFA, 0xD9, 0xB3, 0x7E, 0xC2, 0x77,
+    0xA0, 0x4F, 0x7D, 0xE1, 0x28, 0x7F, 0x04, 0x1F, 0x15, 0x48, 0x1E, 0x3D, 0x45, 0x69, 0xEA, 0xA3,
+    0xB1, 0x53, 0x52, 0xD9, 0x96, 0xE4, 0xB1, 0x2B, 0x98, 0x68, 0x01, 0x65, 0xD2, 0x84, 0x59, 0x09,
+    0x5A, 0x79, 0x41, 0xCC, 0xDF, 0x5E, 0xE4, 0x27, 0x68, 0xA4, 0x40, 0x33, 0x50, 0xDE, 0x40, 0x88,
+    0x62, 0x1F, 0xF5, 0x82, 0xCE, 0xAA, 0x38, 0x59, 0x12, 0x49, 0x82, 0xAB, 0x02, 0x24, 0xE1, 0xC7,
+    0x10, 0xC1, 0x5E, 0x1D, 0x42, 0x56, 0x0F, 0xBE, 0x52, 0x7C, 0x99, 0x92, 0xE1, 0x1C, 0xD1, 0xF7,
+    0x10, 0x9E, 0x83, 0x92, 0x92, 0xCB, 0x44, 0xA7, 0xCE, 0xD1, 0x12, 0x6E, 0xF9, 0xA0, 0x94, 0xA7,
+    0xF1, 0x70, 0xEE, 0x7A, 0xDC, 0x73, 0xAB, 0x82, 0x7E, 0xD4, 0x61, 0x28, 0x96, 0x5F, 0x0C, 0xE1,
+    0x7C, 0x31, 0xD0, 0x2B, 0x7E, 0xD1, 0x31, 0xF9, 0xC2, 0x4C, 0x2C, 0xBD, 0x7E, 0x1A, 0x2C, 0xE8,
+    0x45, 0x16, 0x3C, 0x55, 0xA7, 0x07, 0x0C, 0x6F, 0x61, 0x32, 0x9B, 0xD9, 0xA4, 0x49, 0xEA, 0xD8,
+    0x27, 0x78, 0x18, 0x68, 0xD5, 0x42, 0xED, 0xE0, 0xEF, 0xE4, 0x95, 0xC5, 0x48, 0x1B, 0xF9, 0x12,
+    0x6C, 0x94, 0xF2, 0x9D, 0xF3, 0xA1, 0xD9, 0x96, 0xD4, 0x20, 0x4A, 0xAD, 0xEB, 0x9C, 0x81, 0xBA,
+    0x1A, 0xA0, 0x2F, 0x8D, 0xBE, 0xE0, 0xA8, 0x50, 0x5D, 0x6E, 0x95, 0xD7, 0x25, 0xA6, 0xEE, 0x5E,
+    0xA7, 0x3A, 0x2A, 0x2A, 0x93, 0x43, 0xD4, 0xDB, 0x88, 0x31, 0x82, 0xE7, 0x8B, 0x4E, 0xC4, 0x28,
+    0x48, 0x03, 0xE4, 0x47, 0xBE, 0x2E, 0xCD, 0x28, 0xE5, 0xCA, 0x15, 0x83, 0x09, 0xC2, 0xF3, 0x52,
+    0xEC, 0xED, 0xA8, 0xD7, 0x91, 0x08, 0x9C, 0x16, 0xB5, 0x7F, 0x02, 0xF9, 0xF5, 0x15, 0xE0, 0x3A,
+    0x83, 0x24, 0x9B, 0xC2, 0x28, 0x3F, 0xE9, 0xA8, 0x32, 0x1A, 0xAC, 0xC3, 0x25, 0x58, 0x6B, 0xD9,
+    0xA8, 0x1E, 0x13, 0xCF, 0x77, 0xE5, 0xB3, 0x25, 0xD0, 0x97, 0xF4, 0x7F, 0xD7, 0x7F, 0x6D, 0x52,
+    0x31, 0x8E, 0xD5, 0x30, 0x10, 0x7D, 0xB1, 0x59, 0x22, 0x91, 0xC2, 0x34, 0x4B, 0x9B, 0x23, 0xE4,
+    0x08, 0x0E, 0x48, 0xF4, 0x14, 0x2C, 0x3D, 0x35, 0xC5, 0x6F, 0x69, 0x20, 0x81, 0x13, 0x7C, 0x1A,
+    0x6A, 0x0A, 0x56, 0x5A, 0x85, 0x82, 0x0B, 0x40, 0x62, 0x69, 0x2F, 0xF0, 0xB9, 0x41, 0x0A, 0x1A,
+    0x3A, 0x17, 0x5B, 0x84, 0x95, 0xF3, 0x87, 0x37, 0x0E, 0xBB, 0x5A, 0x24, 0x2C, 0x4D, 0x34, 0x76,
+    0xDE, 0xCC, 0xBC, 0x37, 0x33, 0x56, 0x44, 0x40, 0x0B, 0xBB, 0x6B, 0xD9, 0xDB, 0xD8, 0xF4, 0x48,
+    0xEE, 0x80, 0xD1, 0x46, 0xF8, 0xC7, 0x09, 0x2E, 0x8C, 0x28, 0xA3, 0x87, 0x59, 0x5C, 0xC0, 0x5A,
+    0xCE, 0xF0, 0xF6, 0x0A, 0x75, 0x48, 0xA8, 0xE6, 0x0E, 0xF6, 0x8A, 0xE8, 0x8B, 0x07, 0x7B, 0xE8,
+    0x71, 0x61, 0xDD, 0x1E, 0xC6, 0x32, 0x66, 0x84, 0x8D, 0xBE, 0xCD, 0x21, 0x4D, 0x9F, 0x72, 0x0E,
+    0xA4, 0x6A, 0xCE, 0x49, 0xAB, 0x59, 0x2F, 0xAC, 0xE2, 0xCD, 0x82, 0x49, 0x64, 0xAE, 0x45, 0x92,
+    0x19, 0x86, 0x01, 0xF0, 0xB2, 0xD2, 0x12, 0xBA, 0xE1, 0x33, 0x7C, 0x0F, 0xD4, 0x07, 0x66, 0x8E,
+    0x60, 0x66, 0xC0, 0xD0, 0x0A, 0xFA, 0x0C, 0xC4, 0x04, 0x94, 0x0B, 0x7F, 0x93, 0x7B, 0x23, 0xC7,
+    0x1C, 0x76, 0x7A, 0xF6, 0x5C, 0x79, 0xDC, 0x9F, 0xC4, 0x89, 0x34, 0xC2, 0x64, 0x7C, 0x6A, 0x81,
+    0x4A, 0x18, 0x07, 0x82, 0x98, 0x9D, 0x57, 0x90, 0x11, 0x4F, 0xD2, 0x0F, 0xD9, 0x32, 0x75, 0x54,
+    0x57, 0x7F, 0x93, 0xB6, 0xDE, 0x17, 0x75, 0x59, 0x00, 0x0F, 0x1D, 0xA1, 0xF6, 0x52, 0xA1, 0xDD,
+    0x44, 0xA8, 0x15, 0x85, 0x7A, 0x85, 0x1A, 0x51, 0x68, 0x9D, 0xA1, 0xDB, 0x99, 0xDE, 0xAD, 0xA4,
+    0xF2, 0x75, 0x2D, 0xD8, 0x4B, 0x6A, 0xF3, 0x1F, 0xE2, 0x77, 0xBC, 0xB6, 0x97, 0xD1, 0x84, 0xC6,
+    0xF5, 0xCD, 0xC7, 0xC5, 0x6B, 0x8F, 0x69, 0x04, 0x5C, 0xCB, 0x5C, 0x8C, 0x4F, 0x7E, 0xE7, 0xB0,
+    0x7B, 0xFA, 0xE9, 0x94, 0xD2, 0xA4, 0xC9, 0xBA, 0xA7, 0x37, 0x34, 0x33, 0x17, 0x95, 0xBA, 0x11,
+    0x34, 0xCB, 0x2D, 0xEB, 0xB7, 0xF8, 0x07, 0x53, 0xFD, 0x07, 0xF3, 0x52, 0x94, 0xA2, 0xA8, 0x6E,
+    0x21, 0xF1, 0x46, 0xD9, 0x16, 0xEA, 0xFD, 0x3D, 0x4D, 0x70, 0x73, 0xB5, 0x58, 0x72, 0x69, 0x6F,
+    0xDF, 0x56, 0x4C, 0xAD, 0x0F, 0x75, 0x74, 0xB9, 0x08, 0xCC, 0xD1, 0xF4, 0x7E, 0xAD, 0xDF, 0x2F,
+    0x6B, 0x72, 0x3F, 0x64, 0x3E, 0x29, 0x72, 0x87, 0x0A, 0x31, 0x9F, 0x6A, 0x71, 0x21, 0xBD, 0xE1,
+    0x98, 0xB5, 0x1D, 0x23, 0xEE, 0x9E, 0x42, 0x5B, 0x6D, 0x55, 0x8D, 0xD3, 0x62, 0x5E, 0xDF, 0xBE,
+    0x71, 0x26, 0x5F, 0x38, 0xD2, 0x86, 0x7D, 0xD1, 0x69, 0x5F, 0x50, 0xA5, 0x42, 0xB5, 0x0C, 0xAF,
+    0x81, 0x3C, 0xE5, 0xC0, 0xA9, 0x0D, 0xFB, 0x3C, 0x04, 0xA3, 0xEF, 0x55, 0xBC, 0x51, 0x77, 0x7A,
+    0x27, 0xBB, 0x51, 0xA5, 0xCD, 0xAC, 0xD2, 0xA2, 0x8A, 0x6A, 0xE9, 0x2C, 0xEA, 0xB0, 0x96, 0xD7,
+    0xB0, 0x5A, 0x7E, 0xE6, 0x9D, 0xE0, 0x46, 0xEE, 0x44, 0xA5, 0xED, 0xB2, 0xF0, 0x29, 0xE0, 0x1C,
+    0xC5, 0x9E, 0xBD, 0x38, 0xD7, 0x86, 0x70, 0x1F, 0x4E, 0x5E, 0x49, 0x56, 0x79, 0xB6, 0x25, 0xB6,
+    0x79, 0x2F, 0x94, 0x7B, 0xA5, 0x51, 0x26, 0x6F, 0x8C, 0x57, 0xB7, 0xCC, 0x6E, 0x97, 0x34, 0x4B,
+    0xA2, 0x65, 0x09, 0xC7, 0xD6, 0xD0, 0x60, 0x69, 0xB0, 0x7B, 0x3C, 0x02, 0x5E, 0x4C, 0xD2, 0x72,
+    0xEB, 0xA4, 0xF5, 0xF2, 0xEB, 0xD9, 0x96, 0xF5, 0x0F,
+};
+
+static const uint32_t opendyslexic_10_bolditalicBlockOffsets[28] = {
+    0, 1151, 2283, 3484, 4706, 5593, 6393, 7400,
+    8355, 9222, 10183, 11129, 12089, 12913, 13892, 15021,
+    16194, 17509, 18697, 19852, 21046, 22179, 23248, 24298,
+    25387, 26605, 27854, 28345,
+};
+
+static const uint16_t opendyslexic_10_bolditalicDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_10_bolditalicGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_10_bolditalicPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_10_bolditalicGlyphs[] = {
@@ -3326,699 +1952,699 @@ static const EpdGlyph opendyslexic_10_bolditalicGlyphs[] = {
     { 13, 8, 13, 1, 10, 26, 1839 }, // =
     { 17, 14, 17, 1, 14, 60, 1865 }, // >
     { 16, 27, 14, 3, 24, 108, 1925 }, // ?
-    { 21, 19, 21, 1, 18, 100, 2033 }, // @
-    { 18, 18, 23, 1, 18, 81, 2133 }, // A
-    { 17, 18, 19, 1, 18, 77, 2214 }, // B
-    { 18, 19, 20, 2, 19, 86, 2291 }, // C
-    { 20, 18, 21, 1, 18, 90, 2377 }, // D
-    { 18, 18, 19, 1, 18, 81, 2467 }, // E
-    { 17, 18, 17, 1, 18, 77, 2548 }, // F
-    { 19, 19, 24, 2, 19, 91, 2625 }, // G
-    { 20, 18, 21, 1, 18, 90, 2716 }, // H
-    { 10, 18, 11, 1, 18, 45, 2806 }, // I
-    { 19, 23, 18, 0, 18, 110, 2851 }, // J
-    { 19, 18, 21, 1, 18, 86, 2961 }, // K
-    { 14, 18, 18, 1, 18, 63, 3047 }, // L
-    { 23, 18, 24, 1, 18, 104, 3110 }, // M
-    { 21, 18, 21, 1, 18, 95, 3214 }, // N
-    { 21, 19, 23, 2, 18, 100, 3309 }, // O
-    { 17, 18, 19, 1, 18, 77, 3409 }, // P
-    { 20, 22, 24, 2, 19, 110, 3486 }, // Q
-    { 17, 18, 20, 1, 18, 77, 3596 }, // R
-    { 18, 18, 22, 1, 18, 81, 3673 }, // S
-    { 17, 18, 21, 5, 18, 77, 3754 }, // T
-    { 21, 19, 21, 1, 18, 100, 3831 }, // U
-    { 18, 18, 23, 6, 18, 81, 3931 }, // V
-    { 25, 18, 29, 5, 18, 113, 4012 }, // W
-    { 22, 18, 23, 1, 18, 99, 4125 }, // X
-    { 16, 18, 22, 6, 18, 72, 4224 }, // Y
-    { 22, 18, 22, 1, 18, 99, 4296 }, // Z
-    { 16, 31, 10, -1, 23, 124, 4395 }, // [
-    { 5, 24, 10, 4, 19, 30, 4519 }, // <backslash>
-    { 16, 31, 10, -5, 23, 124, 4549 }, // ]
-    { 12, 6, 12, 3, 20, 18, 4673 }, // ^
-    { 16, 5, 14, -2, -1, 20, 4691 }, // _
-    { 8, 4, 9, 4, 16, 8, 4711 }, // `
-    { 14, 13, 18, 1, 13, 46, 4719 }, // a
-    { 13, 19, 18, 3, 18, 62, 4765 }, // b
-    { 12, 13, 16, 2, 13, 39, 4827 }, // c
-    { 17, 18, 18, 2, 18, 77, 4866 }, // d
-    { 14, 12, 18, 2, 12, 42, 4943 }, // e
-    { 12, 17, 14, 2, 17, 51, 4985 }, // f
-    { 17, 19, 18, 0, 12, 81, 5036 }, // g
-    { 15, 18, 18, 1, 18, 68, 5117 }, // h
-    { 11, 19, 9, 0, 19, 53, 5185 }, // i
-    { 14, 25, 13, 1, 19, 88, 5238 }, // j
-    { 13, 18, 19, 1, 18, 59, 5326 }, // k
-    { 10, 18, 12, 1, 18, 45, 5385 }, // l
-    { 22, 13, 25, 1, 13, 72, 5430 }, // m
-    { 15, 13, 18, 1, 13, 49, 5502 }, // n
-    { 14, 12, 18, 2, 12, 42, 5551 }, // o
-    { 19, 19, 20, -1, 13, 91, 5593 }, // p
-    { 15, 19, 20, 2, 13, 72, 5684 }, // q
-    { 12, 12, 15, 1, 12, 36, 5756 }, // r
-    { 14, 14, 18, 1, 13, 49, 5792 }, // s
-    { 11, 17, 16, 4, 17, 47, 5841 }, // t
-    { 14, 12, 18, 2, 12, 42, 5888 }, // u
-    { 15, 12, 20, 4, 12, 45, 5930 }, // v
-    { 18, 13, 23, 4, 12, 59, 5975 }, // w
-    { 18, 12, 20, 1, 12, 54, 6034 }, // x
-    { 17, 18, 19, 1, 12, 77, 6088 }, // y
-    { 16, 12, 18, 1, 12, 48, 6165 }, // z
-    { 14, 21, 15, 2, 16, 74, 6213 }, // {
-    { 9, 19, 8, 1, 15, 43, 6287 }, // |
-    { 14, 21, 15, -1, 16, 74, 6330 }, // }
-    { 9, 5, 10, 4, 16, 12, 6404 }, // ~
-    { 0, 0, 18, 0, 0, 0, 6416 }, //  
-    { 11, 27, 11, 2, 23, 75, 6416 }, // ¡
-    { 12, 20, 16, 2, 16, 60, 6491 }, // ¢
-    { 17, 20, 14, 0, 19, 85, 6551 }, // £
-    { 15, 13, 14, 1, 14, 49, 6636 }, // ¤
-    { 18, 19, 16, 2, 16, 86, 6685 }, // ¥
-    { 8, 19, 8, 1, 15, 38, 6771 }, // ¦
-    { 16, 18, 16, 1, 17, 72, 6809 }, // §
-    { 12, 5, 11, 3, 17, 15, 6881 }, // ¨
-    { 11, 9, 14, 6, 20, 25, 6896 }, // ©
-    { 8, 7, 14, 6, 16, 14, 6921 }, // ª
-    { 15, 12, 17, 2, 12, 45, 6935 }, // «
-    { 12, 8, 13, 2, 8, 24, 6980 }, // ¬
-    { 12, 3, 13, 2, 8, 9, 7004 }, // ­
-    { 11, 9, 14, 6, 23, 25, 7013 }, // ®
-    { 10, 4, 11, 4, 16, 10, 7038 }, // ¯
-    { 12, 10, 14, 4, 16, 30, 7048 }, // °
-    { 16, 16, 17, 0, 12, 64, 7078 }, // ±
-    { 8, 8, 7, 7, 17, 16, 7142 }, // ²
-    { 8, 8, 7, 7, 17, 16, 7158 }, // ³
-    { 7, 5, 6, 3, 16, 9, 7174 }, // ´
-    { 17, 15, 18, -1, 12, 64, 7183 }, // µ
-    { 16, 18, 16, 1, 15, 72, 7247 }, // ¶
-    { 7, 5, 5, 1, 10, 9, 7319 }, // ·
-    { 7, 7, 7, -1, 1, 13, 7328 }, // ¸
-    { 6, 8, 6, 7, 17, 12, 7341 }, // ¹
-    { 8, 7, 14, 6, 15, 14, 7353 }, // º
-    { 15, 12, 16, -3, 12, 45, 7367 }, // »
-    { 22, 20, 27, 2, 18, 110, 7412 }, // ¼
-    { 23, 20, 27, 2, 18, 115, 7522 }, // ½
-    { 22, 19, 27, 2, 17, 105, 7637 }, // ¾
-    { 16, 26, 14, -2, 15, 104, 7742 }, // ¿
-    { 18, 24, 23, 1, 24, 108, 7846 }, // À
-    { 19, 28, 23, 1, 28, 133, 7954 }, // Á
-    { 19, 25, 23, 1, 25, 119, 8087 }, // Â
-    { 19, 25, 23, 1, 25, 119, 8206 }, // Ã
-    { 21, 25, 23, 1, 25, 132, 8325 }, // Ä
-    { 18, 25, 23, 1, 25, 113, 8457 }, // Å
-    { 29, 19, 28, 1, 18, 138, 8570 }, // Æ
-    { 18, 25, 20, 2, 19, 113, 8708 }, // Ç
-    { 18, 25, 19, 1, 25, 113, 8821 }, // È
-    { 18, 28, 19, 1, 28, 126, 8934 }, // É
-    { 18, 26, 19, 1, 26, 117, 9060 }, // Ê
-    { 19, 26, 19, 1, 26, 124, 9177 }, // Ë
-    { 12, 25, 11, 1, 25, 75, 9301 }, // Ì
-    { 13, 29, 11, 1, 29, 95, 9376 }, // Í
-    { 13, 26, 11, 1, 26, 85, 9471 }, // Î
-    { 15, 27, 11, 1, 27, 102, 9556 }, // Ï
-    { 21, 18, 21, 0, 18, 95, 9658 }, // Ð
-    { 21, 25, 21, 1, 25, 132, 9753 }, // Ñ
-    { 21, 25, 23, 2, 24, 132, 9885 }, // Ò
-    { 21, 28, 23, 2, 27, 147, 10017 }, // Ó
-    { 21, 26, 23, 2, 25, 137, 10164 }, // Ô
-    { 21, 26, 23, 2, 25, 137, 10301 }, // Õ
-    { 21, 26, 23, 2, 25, 137, 10438 }, // Ö
-    { 14, 7, 12, 0, 9, 25, 10575 }, // ×
-    { 41, 37, 23, -8, 28, 380, 10600 }, // Ø
-    { 21, 26, 21, 1, 25, 137, 10980 }, // Ù
-    { 21, 30, 21, 1, 29, 158, 11117 }, // Ú
-    { 21, 27, 21, 1, 26, 142, 11275 }, // Û
-    { 21, 28, 21, 1, 27, 147, 11417 }, // Ü
-    { 16, 30, 22, 6, 30, 120, 11564 }, // Ý
-    { 13, 17, 12, 1, 17, 56, 11684 }, // Þ
-    { 16, 18, 14, 0, 17, 72, 11740 }, // ß
-    { 14, 19, 18, 1, 19, 67, 11812 }, // à
-    { 15, 22, 18, 1, 22, 83, 11879 }, // á
-    { 15, 19, 18, 1, 19, 72, 11962 }, // â
-    { 15, 19, 18, 1, 19, 72, 12034 }, // ã
-    { 17, 20, 18, 1, 20, 85, 12106 }, // ä
-    { 14, 20, 18, 1, 20, 70, 12191 }, // å
-    { 23, 13, 26, 1, 13, 75, 12261 }, // æ
-    { 12, 18, 16, 2, 13, 54, 12336 }, // ç
-    { 14, 21, 18, 2, 21, 74, 12390 }, // è
-    { 15, 24, 18, 2, 24, 90, 12464 }, // é
-    { 15, 21, 18, 2, 21, 79, 12554 }, // ê
-    { 16, 22, 18, 2, 22, 88, 12633 }, // ë
-    { 10, 18, 9, 0, 18, 45, 12721 }, // ì
-    { 11, 22, 9, 0, 22, 61, 12766 }, // í
-    { 12, 19, 9, -1, 19, 57, 12827 }, // î
-    { 12, 18, 9, 0, 18, 54, 12884 }, // ï
-    { 20, 19, 14, 0, 18, 95, 12938 }, // ð
-    { 16, 20, 18, 1, 20, 80, 13033 }, // ñ
-    { 14, 18, 18, 2, 18, 63, 13113 }, // ò
-    { 14, 22, 18, 2, 22, 77, 13176 }, // ó
-    { 14, 19, 18, 2, 19, 67, 13253 }, // ô
-    { 14, 19, 18, 2, 19, 67, 13320 }, // õ
-    { 16, 19, 18, 2, 19, 76, 13387 }, // ö
-    { 16, 15, 19, 3, 15, 60, 13463 }, // ÷
-    { 24, 35, 18, -3, 24, 210, 13523 }, // ø
-    { 14, 18, 18, 2, 18, 63, 13733 }, // ù
-    { 14, 22, 18, 2, 22, 77, 13796 }, // ú
-    { 14, 19, 18, 2, 19, 67, 13873 }, // û
-    { 16, 20, 18, 2, 20, 80, 13940 }, // ü
-    { 17, 31, 19, 1, 25, 132, 14020 }, // ý
-    { 14, 22, 12, 0, 17, 77, 14152 }, // þ
-    { 18, 28, 19, 1, 22, 126, 14229 }, // ÿ
-    { 21, 25, 23, 1, 25, 132, 14355 }, // Ā
-    { 17, 20, 18, 1, 20, 85, 14487 }, // ā
-    { 21, 26, 23, 1, 26, 137, 14572 }, // Ă
-    { 17, 20, 18, 1, 20, 85, 14709 }, // ă
-    { 18, 24, 23, 1, 18, 108, 14794 }, // Ą
-    { 14, 19, 18, 1, 13, 67, 14902 }, // ą
-    { 18, 25, 20, 2, 25, 113, 14969 }, // Ć
-    { 12, 18, 16, 2, 18, 54, 15082 }, // ć
-    { 19, 27, 20, 2, 27, 129, 15136 }, // Ĉ
-    { 15, 19, 16, 2, 19, 72, 15265 }, // ĉ
-    { 18, 25, 20, 2, 25, 113, 15337 }, // Ċ
-    { 13, 18, 16, 2, 18, 59, 15450 }, // ċ
-    { 20, 27, 20, 2, 27, 135, 15509 }, // Č
-    { 16, 20, 16, 2, 20, 80, 15644 }, // č
-    { 20, 27, 21, 1, 27, 135, 15724 }, // Ď
-    { 20, 18, 18, 2, 18, 90, 15859 }, // ď
-    { 21, 18, 21, 0, 18, 95, 15949 }, // Đ
-    { 20, 18, 18, 2, 18, 90, 16044 }, // đ
-    { 19, 26, 19, 1, 26, 124, 16134 }, // Ē
-    { 16, 22, 18, 2, 22, 88, 16258 }, // ē
-    { 19, 26, 19, 1, 26, 124, 16346 }, // Ĕ
-    { 17, 22, 18, 2, 22, 94, 16470 }, // ĕ
-    { 18, 26, 19, 1, 26, 117, 16564 }, // Ė
-    { 14, 22, 18, 2, 22, 77, 16681 }, // ė
-    { 18, 23, 19, 1, 18, 104, 16758 }, // Ę
-    { 14, 20, 18, 2, 12, 70, 16862 }, // ę
-    { 20, 28, 19, 1, 28, 140, 16932 }, // Ě
-    { 18, 24, 18, 2, 24, 108, 17072 }, // ě
-    { 21, 29, 24, 2, 29, 153, 17180 }, // Ĝ
-    { 19, 28, 18, 0, 21, 133, 17333 }, // ĝ
-    { 22, 28, 24, 2, 28, 154, 17466 }, // Ğ
-    { 19, 27, 18, 0, 20, 129, 17620 }, // ğ
-    { 19, 28, 24, 2, 28, 133, 17749 }, // Ġ
-    { 17, 27, 18, 0, 20, 115, 17882 }, // ġ
-    { 20, 31, 24, 2, 31, 155, 17997 }, // Ģ
-    { 17, 28, 18, 0, 21, 119, 18152 }, // ģ
-    { 20, 26, 21, 1, 26, 130, 18271 }, // Ĥ
-    { 15, 26, 18, 1, 26, 98, 18401 }, // ĥ
-    { 21, 18, 21, 1, 18, 95, 18499 }, // Ħ
-    { 15, 18, 18, 1, 18, 68, 18594 }, // ħ
-    { 14, 27, 11, 1, 27, 95, 18662 }, // Ĩ
-    { 12, 20, 9, 0, 20, 60, 18757 }, // ĩ
-    { 15, 27, 11, 1, 27, 102, 18817 }, // Ī
-    { 13, 19, 9, 0, 19, 62, 18919 }, // ī
-    { 12, 23, 11, -1, 18, 69, 18981 }, // Į
-    { 13, 25, 9, -2, 19, 82, 19050 }, // į
-    { 13, 27, 11, 1, 27, 88, 19132 }, // İ
-    { 8, 12, 9, 0, 12, 24, 19220 }, // ı
-    { 21, 26, 33, 6, 18, 137, 19244 }, // Ĳ
-    { 21, 24, 9, 0, 19, 126, 19381 }, // ĳ
-    { 22, 31, 18, 0, 26, 171, 19507 }, // Ĵ
-    { 18, 27, 13, 1, 21, 122, 19678 }, // ĵ
-    { 19, 29, 21, 1, 29, 138, 19800 }, // Ķ
-    { 15, 29, 19, -1, 18, 109, 19938 }, // ķ
-    { 12, 12, 14, -2, 12, 36, 20047 }, // ĸ
-    { 14, 24, 18, 1, 24, 84, 20083 }, // Ĺ
-    { 13, 27, 12, 1, 27, 88, 20167 }, // ĺ
-    { 14, 29, 18, 1, 18, 102, 20255 }, // Ļ
-    { 13, 29, 12, -2, 18, 95, 20357 }, // ļ
-    { 16, 18, 18, 1, 18, 72, 20452 }, // Ľ
-    { 16, 21, 12, 1, 21, 84, 20524 }, // ľ
-    { 16, 18, 18, 1, 18, 72, 20608 }, // Ŀ
-    { 13, 18, 12, 1, 18, 59, 20680 }, // ŀ
-    { 32, 30, 18, -10, 24, 240, 20739 }, // Ł
-    { 22, 18, 12, -7, 18, 99, 20979 }, // ł
-    { 21, 25, 21, 1, 25, 132, 21078 }, // Ń
-    { 15, 20, 18, 1, 20, 75, 21210 }, // ń
-    { 21, 27, 21, 1, 18, 142, 21285 }, // Ņ
-    { 15, 21, 18, 1, 13, 79, 21427 }, // ņ
-    { 22, 27, 21, 1, 27, 149, 21506 }, // Ň
-    { 19, 22, 18, 1, 22, 105, 21655 }, // ň
-    { 28, 21, 18, -12, 21, 147, 21760 }, // ŉ
-    { 21, 23, 21, 1, 18, 121, 21907 }, // Ŋ
-    { 15, 17, 18, 1, 13, 64, 22028 }, // ŋ
-    { 21, 26, 23, 2, 25, 137, 22092 }, // Ō
-    { 16, 19, 18, 2, 19, 76, 22229 }, // ō
-    { 21, 27, 23, 2, 26, 142, 22305 }, // Ŏ
-    { 16, 20, 18, 2, 20, 80, 22447 }, // ŏ
-    { 23, 25, 23, 2, 24, 144, 22527 }, // Ő
-    { 19, 18, 18, 2, 18, 86, 22671 }, // ő
-    { 28, 20, 25, 2, 19, 140, 22757 }, // Œ
-    { 22, 12, 22, 2, 12, 66, 22897 }, // œ
-    { 17, 25, 20, 1, 25, 107, 22963 }, // Ŕ
-    { 12, 17, 15, 1, 17, 51, 23070 }, // ŕ
-    { 17, 29, 20, 1, 29, 124, 23121 }, // Ŗ
-    { 13, 22, 15, 1, 22, 72, 23245 }, // ŗ
-    { 19, 26, 20, 1, 26, 124, 23317 }, // Ř
-    { 15, 19, 15, 1, 19, 72, 23441 }, // ř
-    { 18, 25, 22, 1, 25, 113, 23513 }, // Ś
-    { 14, 19, 18, 1, 18, 67, 23626 }, // ś
-    { 20, 26, 22, 1, 26, 130, 23693 }, // Ŝ
-    { 17, 20, 18, 1, 19, 85, 23823 }, // ŝ
-    { 18, 23, 22, 1, 18, 104, 23908 }, // Ş
-    { 14, 19, 18, 1, 13, 67, 24012 }, // ş
-    { 21, 26, 22, 1, 26, 137, 24079 }, // Š
-    { 18, 21, 18, 1, 20, 95, 24216 }, // š
-    { 17, 24, 21, 5, 18, 102, 24311 }, // Ţ
-    { 13, 22, 16, 2, 17, 72, 24413 }, // ţ
-    { 17, 26, 21, 5, 26, 111, 24485 }, // Ť
-    { 16, 20, 16, 4, 20, 80, 24596 }, // ť
-    { 17, 18, 21, 5, 18, 77, 24676 }, // Ŧ
-    { 13, 17, 16, 2, 17, 56, 24753 }, // ŧ
-    { 21, 28, 21, 1, 27, 147, 24809 }, // Ũ
-    { 15, 20, 18, 2, 20, 75, 24956 }, // ũ
-    { 21, 28, 21, 1, 27, 147, 25031 }, // Ū
-    { 16, 19, 18, 2, 19, 76, 25178 }, // ū
-    { 21, 28, 21, 1, 27, 147, 25254 }, // Ŭ
-    { 16, 20, 18, 2, 20, 80, 25401 }, // ŭ
-    { 21, 29, 21, 1, 28, 153, 25481 }, // Ů
-    { 14, 21, 18, 2, 21, 74, 25634 }, // ů
-    { 23, 27, 21, 1, 26, 156, 25708 }, // Ű
-    { 19, 19, 18, 2, 19, 91, 25864 }, // ű
-    { 21, 23, 21, 1, 18, 121, 25955 }, // Ų
-    { 14, 18, 18, 2, 12, 63, 26076 }, // ų
-    { 25, 26, 29, 5, 26, 163, 26139 }, // Ŵ
-    { 18, 22, 23, 4, 21, 99, 26302 }, // ŵ
-    { 16, 28, 22, 6, 28, 112, 26401 }, // Ŷ
-    { 17, 28, 19, 1, 22, 119, 26513 }, // ŷ
-    { 16, 28, 22, 6, 28, 112, 26632 }, // Ÿ
-    { 22, 24, 22, 1, 24, 132, 26744 }, // Ź
-    { 16, 20, 18, 1, 20, 80, 26876 }, // ź
-    { 22, 24, 22, 1, 24, 132, 26956 }, // Ż
-    { 16, 20, 18, 1, 20, 80, 27088 }, // ż
-    { 22, 26, 22, 1, 26, 143, 27168 }, // Ž
-    { 19, 21, 18, 1, 21, 100, 27311 }, // ž
-    { 12, 17, 13, 2, 17, 51, 27411 }, // ſ
-    { 8, 4, 0, 4, 16, 8, 27462 }, // ̀
-    { 7, 5, 0, 3, 16, 9, 27470 }, // ́
-    { 12, 6, 0, -1, 1, 18, 27479 }, // ̂
-    { 9, 5, 0, 4, 16, 12, 27497 }, // ̃
-    { 12, 4, 0, 4, 15, 12, 27509 }, // ̄
-    { 15, 4, 0, 5, 19, 15, 27521 }, // ̅
-    { 11, 6, 0, 4, 16, 17, 27536 }, // ̆
-    { 6, 5, 0, 4, 17, 8, 27553 }, // ̇
-    { 10, 4, 0, 3, 15, 10, 27561 }, // ̈
-    { 5, 6, 0, 7, 14, 8, 27571 }, // ̉
-    { 6, 5, 0, 4, 16, 8, 27579 }, // ̊
-    { 17, 4, 0, 4, 16, 17, 27587 }, // ̋
-    { 12, 6, 0, 4, 17, 18, 27604 }, // ̌
-    { 18, 4, 0, -8, 16, 18, 27622 }, // ̏
-    { 10, 8, 0, 2, 17, 20, 27640 }, // ̒
-    { 10, 8, 0, 2, 16, 20, 27660 }, // ̓
-    { 9, 8, 0, -5, 16, 18, 27680 }, // ̔
-    { 6, 6, 0, 0, 0, 9, 27698 }, // ̘
-    { 6, 6, 0, 1, 0, 9, 27707 }, // ̙
-    { 10, 6, 0, 5, 17, 15, 27716 }, // ̚
-    { 5, 7, 0, 3, 15, 9, 27731 }, // ̛
-    { 5, 7, 0, -1, 0, 9, 27740 }, // ̜
-    { 6, 6, 0, 2, 4, 9, 27749 }, // ̝
-    { 6, 6, 0, -1, 0, 9, 27758 }, // ̞
-    { 5, 5, 0, 0, -2, 7, 27767 }, // ̟
-    { 12, 4, 0, -1, -2, 12, 27774 }, // ̠
-    { 6, 5, 0, -3, 2, 8, 27786 }, // ̣
-    { 11, 4, 0, -2, -1, 11, 27794 }, // ̤
-    { 6, 5, 0, 4, 16, 8, 27805 }, // ̥
-    { 10, 8, 0, -1, 4, 20, 27813 }, // ̦
-    { 7, 7, 0, -1, 1, 13, 27833 }, // ̧
-    { 7, 8, 0, 0, 2, 14, 27846 }, // ̨
-    { 7, 7, 0, -2, -1, 13, 27860 }, // ̩
-    { 10, 5, 0, -1, 0, 13, 27873 }, // ̪
-    { 14, 6, 0, -1, 1, 21, 27886 }, // ̬
-    { 13, 6, 0, -1, 1, 20, 27907 }, // ̭
-    { 10, 6, 0, 5, 18, 15, 27927 }, // ̰
-    { 11, 4, 0, 5, 18, 11, 27942 }, // ̱
-    { 11, 4, 0, -1, -1, 11, 27953 }, // ̲
-    { 11, 6, 0, 5, 18, 17, 27964 }, // ̴
-    { 12, 3, 0, 1, 8, 9, 27981 }, // ̵
-    { 5, 8, 0, 1, 1, 10, 27990 }, // ̹
-    { 11, 7, 0, -3, 1, 20, 28000 }, // ̺
-    { 10, 7, 0, -1, 1, 18, 28020 }, // ̻
-    { 10, 6, 0, -1, 1, 15, 28038 }, // ̼
-    { 7, 5, 0, 4, 16, 9, 28053 }, // ̽
-    { 9, 5, 0, 4, 16, 12, 28062 }, // ͂
-    { 5, 6, 0, 8, 19, 8, 28074 }, // ̓
-    { 13, 15, 0, 3, 26, 49, 28082 }, // ̈́
-    { 11, 5, 0, 3, 17, 14, 28131 }, // ͆
-    { 14, 8, 0, -2, 0, 28, 28145 }, // ͇
-    { 11, 7, 0, -1, 1, 20, 28173 }, // ͈
-    { 9, 6, 0, -1, -1, 14, 28193 }, // ͉
-    { 15, 17, 0, 3, 23, 64, 28207 }, // ͊
-    { 21, 16, 0, 7, 24, 84, 28271 }, // ͋
-    { 15, 13, 0, 11, 12, 49, 28355 }, // ͌
-    { 11, 24, 0, 1, 8, 66, 28404 }, // ͍
-    { 5, 4, 0, 10, 3, 5, 28470 }, // ͎
-    { 19, 5, 0, 0, 1, 24, 28475 }, // ͜
-    { 19, 6, 0, 3, 17, 29, 28499 }, // ͡
-    { 23, 7, 0, -1, 0, 41, 28528 }, // ͢
-    { 18, 25, 18, 1, 25, 113, 28569 }, // Ѐ
-    { 19, 26, 19, 1, 26, 124, 28682 }, // Ё
-    { 19, 20, 14, 2, 18, 95, 28806 }, // Ђ
-    { 17, 25, 14, 0, 24, 107, 28901 }, // Ѓ
-    { 18, 18, 17, 1, 16, 81, 29008 }, // Є
-    { 18, 18, 22, 1, 18, 81, 29089 }, // Ѕ
-    { 10, 18, 11, 1, 18, 45, 29170 }, // І
-    { 14, 26, 11, 1, 26, 91, 29215 }, // Ї
-    { 19, 23, 18, 0, 18, 110, 29306 }, // Ј
-    { 23, 18, 24, 1, 16, 104, 29416 }, // Љ
-    { 21, 17, 13, -4, 16, 90, 29520 }, // Њ
-    { 17, 19, 21, 5, 19, 81, 29610 }, // Ћ
-    { 19, 24, 21, 1, 24, 114, 29691 }, // Ќ
-    { 19, 23, 20, 1, 23, 110, 29805 }, // Ѝ
-    { 18, 27, 17, 0, 25, 122, 29915 }, // Ў
-    { 18, 21, 17, 1, 16, 95, 30037 }, // Џ
-    { 18, 18, 23, 1, 18, 81, 30132 }, // А
-    { 15, 17, 14, 2, 16, 64, 30213 }, // Б
-    { 15, 16, 14, 1, 15, 60, 30277 }, // В
-    { 17, 17, 14, 0, 16, 73, 30337 }, // Г
-    { 18, 19, 17, 1, 16, 86, 30410 }, // Д
-    { 17, 18, 18, 1, 18, 77, 30496 }, // Е
-    { 30, 18, 31, 0, 18, 135, 30573 }, // Ж
-    { 14, 17, 13, 1, 16, 60, 30708 }, // З
-    { 19, 18, 20, 1, 18, 86, 30768 }, // И
-    { 19, 24, 20, 1, 24, 114, 30854 }, // Й
-    { 19, 18, 21, 1, 18, 86, 30968 }, // К
-    { 18, 18, 13, -1, 16, 81, 31054 }, // Л
-    { 21, 17, 18, 0, 16, 90, 31135 }, // М
-    { 20, 18, 21, 1, 18, 90, 31225 }, // Н
-    { 21, 19, 23, 2, 18, 100, 31315 }, // О
-    { 17, 17, 14, 0, 16, 73, 31415 }, // П
-    { 17, 18, 19, 1, 18, 77, 31488 }, // Р
-    { 18, 19, 20, 2, 19, 86, 31565 }, // С
-    { 17, 18, 21, 5, 18, 77, 31651 }, // Т
-    { 18, 18, 17, 0, 16, 81, 31728 }, // У
-    { 16, 16, 18, 4, 16, 64, 31809 }, // Ф
-    { 22, 18, 23, 1, 18, 99, 31873 }, // Х
-    { 17, 20, 15, 0, 16, 85, 31972 }, // Ц
-    { 14, 16, 14, 3, 16, 56, 32057 }, // Ч
-    { 19, 17, 17, 1, 16, 81, 32113 }, // Ш
-    { 19, 20, 19, 1, 16, 95, 32194 }, // Щ
-    { 14, 17, 13, -1, 16, 60, 32289 }, // Ъ
-    { 23, 19, 24, 1, 18, 110, 32349 }, // Ы
-    { 12, 17, 13, 1, 16, 51, 32459 }, // Ь
-    { 19, 18, 20, 1, 16, 86, 32510 }, // Э
-    { 20, 17, 19, 1, 16, 85, 32596 }, // Ю
-    { 18, 18, 18, 0, 18, 81, 32681 }, // Я
-    { 14, 13, 18, 1, 13, 46, 32762 }, // а
-    { 17, 20, 14, 2, 19, 85, 32808 }, // б
-    { 13, 12, 15, -1, 12, 39, 32893 }, // в
-    { 15, 13, 12, 0, 12, 49, 32932 }, // г
-    { 16, 15, 16, 1, 12, 60, 32981 }, // д
-    { 14, 12, 18, 2, 12, 42, 33041 }, // е
-    { 30, 15, 31, 0, 15, 113, 33083 }, // ж
-    { 10, 11, 9, -2, 11, 28, 33196 }, // з
-    { 16, 13, 14, 0, 12, 52, 33224 }, // и
-    { 15, 18, 13, 0, 18, 68, 33276 }, // й
-    { 15, 12, 17, -1, 12, 45, 33344 }, // к
-    { 13, 12, 9, -3, 11, 39, 33389 }, // л
-    { 16, 13, 18, -1, 13, 52, 33428 }, // м
-    { 17, 13, 17, -1, 13, 56, 33480 }, // н
-    { 14, 12, 18, 2, 12, 42, 33536 }, // о
-    { 16, 13, 14, 0, 12, 52, 33578 }, // п
-    { 19, 19, 20, -1, 13, 91, 33630 }, // р
-    { 12, 13, 16, 2, 13, 39, 33721 }, // с
-    { 14, 13, 14, 3, 12, 46, 33760 }, // т
-    { 17, 18, 19, 1, 12, 77, 33806 }, // у
-    { 18, 17, 18, 2, 12, 77, 33883 }, // ф
-    { 17, 13, 15, 0, 12, 56, 33960 }, // х
-    { 15, 15, 15, 1, 12, 57, 34016 }, // ц
-    { 9, 11, 9, 0, 11, 25, 34073 }, // ч
-    { 18, 13, 17, 1, 12, 59, 34098 }, // ш
-    { 18, 16, 19, 1, 12, 72, 34157 }, // щ
-    { 11, 13, 10, -2, 12, 36, 34229 }, // ъ
-    { 17, 15, 18, -1, 14, 64, 34265 }, // ы
-    { 10, 13, 10, -1, 12, 33, 34329 }, // ь
-    { 12, 13, 13, 2, 12, 39, 34362 }, // э
-    { 16, 14, 15, 0, 13, 56, 34401 }, // ю
-    { 13, 13, 17, 1, 13, 43, 34457 }, // я
-    { 15, 22, 18, 2, 22, 83, 34500 }, // ѐ
-    { 15, 21, 18, 2, 21, 79, 34583 }, // ё
-    { 15, 23, 18, 1, 18, 87, 34662 }, // ђ
-    { 15, 18, 12, 0, 17, 68, 34749 }, // ѓ
-    { 13, 12, 12, -1, 11, 39, 34817 }, // є
-    { 14, 14, 18, 1, 13, 49, 34856 }, // ѕ
-    { 11, 19, 9, 0, 19, 53, 34905 }, // і
-    { 12, 18, 9, 0, 18, 54, 34958 }, // ї
-    { 14, 25, 13, 1, 19, 88, 35012 }, // ј
-    { 16, 12, 17, -1, 11, 48, 35100 }, // љ
-    { 15, 13, 9, -5, 12, 49, 35148 }, // њ
-    { 15, 18, 18, 1, 18, 68, 35197 }, // ћ
-    { 16, 18, 17, -1, 18, 72, 35265 }, // ќ
-    { 16, 20, 14, 0, 19, 80, 35337 }, // ѝ
-    { 19, 28, 19, 1, 22, 133, 35417 }, // ў
-    { 13, 15, 12, -1, 12, 49, 35550 }, // џ
-    { 14, 18, 16, 3, 16, 63, 35599 }, // Ѣ
-    { 14, 18, 14, 2, 16, 63, 35662 }, // ѣ
-    { 23, 17, 18, -1, 16, 98, 35725 }, // Ѫ
-    { 16, 13, 13, -3, 12, 52, 35823 }, // ѫ
-    { 23, 23, 24, 2, 23, 133, 35875 }, // Ѳ
-    { 18, 17, 18, 2, 17, 77, 36008 }, // ѳ
-    { 21, 22, 23, 6, 22, 116, 36085 }, // Ѵ
-    { 15, 15, 18, 4, 15, 57, 36201 }, // ѵ
-    { 10, 8, 0, 6, 20, 20, 36258 }, // ҆
-    { 18, 19, 14, 0, 18, 86, 36278 }, // Ґ
-    { 16, 16, 12, 0, 15, 64, 36364 }, // ґ
-    { 17, 17, 14, 0, 16, 73, 36428 }, // Ғ
-    { 12, 11, 9, -2, 11, 33, 36501 }, // ғ
-    { 17, 20, 13, 0, 18, 85, 36534 }, // Ҕ
-    { 11, 12, 8, -3, 11, 33, 36619 }, // ҕ
-    { 30, 22, 31, 0, 18, 165, 36652 }, // Җ
-    { 21, 15, 21, -2, 12, 79, 36817 }, // җ
-    { 14, 19, 13, 1, 16, 67, 36896 }, // Ҙ
-    { 10, 17, 9, -2, 11, 43, 36963 }, // ҙ
-    { 19, 22, 15, 0, 18, 105, 37006 }, // Қ
-    { 13, 15, 10, -2, 12, 49, 37111 }, // қ
-    { 22, 18, 23, 1, 17, 99, 37160 }, // Ҝ
-    { 16, 11, 16, 0, 11, 44, 37259 }, // ҝ
-    { 19, 18, 21, 1, 18, 86, 37303 }, // Ҟ
-    { 13, 18, 19, 1, 18, 59, 37389 }, // ҟ
-    { 19, 18, 21, 1, 18, 86, 37448 }, // Ҡ
-    { 13, 12, 15, -1, 12, 39, 37534 }, // ҡ
-    { 20, 21, 16, -2, 18, 105, 37573 }, // Ң
-    { 14, 14, 11, -3, 12, 49, 37678 }, // ң
-    { 28, 18, 21, 1, 18, 126, 37727 }, // Ҥ
-    { 19, 12, 15, -1, 12, 57, 37853 }, // ҥ
-    { 25, 20, 27, 2, 18, 125, 37910 }, // Ҧ
-    { 20, 22, 26, 3, 15, 110, 38035 }, // ҧ
-    { 21, 17, 14, -2, 16, 90, 38145 }, // Ҩ
-    { 17, 14, 21, 1, 13, 60, 38235 }, // ҩ
-    { 18, 22, 20, 2, 19, 99, 38295 }, // Ҫ
-    { 12, 16, 16, 2, 13, 48, 38394 }, // ҫ
-    { 18, 21, 16, 2, 18, 95, 38442 }, // Ҭ
-    { 13, 14, 11, -1, 12, 46, 38537 }, // ҭ
-    { 16, 18, 22, 6, 18, 72, 38583 }, // Ү
-    { 14, 17, 16, 4, 12, 60, 38655 }, // ү
-    { 18, 18, 22, 4, 18, 81, 38715 }, // Ұ
-    { 18, 17, 16, 0, 12, 77, 38796 }, // ұ
-    { 21, 21, 16, 1, 18, 111, 38873 }, // Ҳ
-    { 16, 15, 16, 0, 12, 60, 38984 }, // ҳ
-    { 17, 20, 13, 0, 15, 85, 39044 }, // Ҵ
-    { 13, 14, 18, 3, 11, 46, 39129 }, // ҵ
-    { 15, 21, 14, 2, 16, 79, 39175 }, // Ҷ
-    { 10, 15, 10, 0, 11, 38, 39254 }, // ҷ
-    { 14, 16, 14, 3, 16, 56, 39292 }, // Ҹ
-    { 9, 11, 9, 0, 11, 25, 39348 }, // ҹ
-    { 15, 19, 14, 0, 18, 72, 39373 }, // Һ
-    { 15, 18, 18, 1, 18, 68, 39445 }, // һ
-    { 24, 17, 29, 4, 16, 102, 39513 }, // Ҽ
-    { 17, 12, 15, 1, 12, 51, 39615 }, // ҽ
-    { 24, 20, 19, 5, 16, 120, 39666 }, // Ҿ
-    { 17, 15, 13, 2, 12, 64, 39786 }, // ҿ
-    { 10, 18, 11, 1, 18, 45, 39850 }, // Ӏ
-    { 30, 28, 31, 0, 28, 210, 39895 }, // Ӂ
-    { 30, 24, 31, 0, 24, 180, 40105 }, // ӂ
-    { 17, 22, 15, 1, 16, 94, 40285 }, // Ӄ
-    { 12, 16, 10, -2, 12, 48, 40379 }, // ӄ
-    { 18, 21, 13, -1, 16, 95, 40427 }, // Ӆ
-    { 12, 14, 9, -1, 11, 42, 40522 }, // ӆ
-    { 20, 24, 21, 1, 18, 120, 40564 }, // Ӈ
-    { 14, 16, 15, -1, 12, 56, 40684 }, // ӈ
-    { 20, 25, 21, 1, 18, 125, 40740 }, // Ӊ
-    { 14, 17, 15, 0, 12, 60, 40865 }, // ӊ
-    { 15, 21, 14, 3, 16, 79, 40925 }, // Ӌ
-    { 9, 14, 13, 2, 11, 32, 41004 }, // ӌ
-    { 23, 26, 24, 1, 18, 150, 41036 }, // Ӎ
-    { 16, 17, 17, 0, 12, 68, 41186 }, // ӎ
-    { 8, 16, 13, 4, 15, 32, 41254 }, // ӏ
-    { 21, 25, 23, 1, 25, 132, 41286 }, // Ӑ
-    { 18, 20, 18, 1, 20, 90, 41418 }, // ӑ
-    { 20, 24, 23, 1, 24, 120, 41508 }, // Ӓ
-    { 17, 20, 18, 1, 20, 85, 41628 }, // ӓ
-    { 29, 19, 28, 1, 18, 138, 41713 }, // Ӕ
-    { 23, 13, 26, 1, 13, 75, 41851 }, // ӕ
-    { 20, 26, 18, 1, 26, 130, 41926 }, // Ӗ
-    { 17, 22, 18, 2, 22, 94, 42056 }, // ӗ
-    { 18, 18, 22, 7, 17, 81, 42150 }, // Ә
-    { 14, 14, 18, 6, 13, 49, 42231 }, // ә
-    { 18, 24, 22, 7, 23, 108, 42280 }, // Ӛ
-    { 15, 17, 18, 5, 13, 64, 42388 }, // ӛ
-    { 30, 27, 29, 3, 27, 203, 42452 }, // Ӝ
-    { 30, 23, 31, 0, 23, 173, 42655 }, // ӝ
-    { 16, 26, 13, 1, 25, 104, 42828 }, // Ӟ
-    { 15, 16, 9, -2, 16, 60, 42932 }, // ӟ
-    { 14, 17, 14, 2, 16, 60, 42992 }, // Ӡ
-    { 13, 17, 14, 1, 12, 56, 43052 }, // ӡ
-    { 19, 24, 19, 1, 24, 114, 43108 }, // Ӣ
-    { 17, 20, 14, 0, 19, 85, 43222 }, // ӣ
-    { 19, 23, 20, 1, 23, 110, 43307 }, // Ӥ
-    { 16, 19, 14, 0, 18, 76, 43417 }, // ӥ
-    { 21, 25, 23, 2, 24, 132, 43493 }, // Ӧ
-    { 15, 21, 18, 2, 21, 79, 43625 }, // ӧ
-    { 18, 17, 23, 3, 17, 77, 43704 }, // Ө
-    { 14, 12, 18, 2, 12, 42, 43781 }, // ө
-    { 18, 23, 23, 3, 23, 104, 43823 }, // Ӫ
-    { 15, 18, 18, 2, 18, 68, 43927 }, // ӫ
-    { 31, 27, 20, 1, 25, 210, 43995 }, // Ӭ
-    { 13, 18, 13, 2, 17, 59, 44205 }, // ӭ
-    { 18, 27, 17, 0, 25, 122, 44264 }, // Ӯ
-    { 18, 28, 19, 1, 22, 126, 44386 }, // ӯ
-    { 18, 26, 17, 0, 24, 117, 44512 }, // Ӱ
-    { 17, 27, 19, 1, 21, 115, 44629 }, // ӱ
-    { 20, 26, 17, 0, 24, 130, 44744 }, // Ӳ
-    { 22, 27, 19, 1, 21, 149, 44874 }, // ӳ
-    { 14, 20, 14, 3, 20, 70, 45023 }, // Ӵ
-    { 11, 15, 9, 0, 15, 42, 45093 }, // ӵ
-    { 17, 19, 14, 0, 16, 81, 45135 }, // Ӷ
-    { 12, 13, 9, -2, 11, 39, 45216 }, // ӷ
-    { 23, 28, 24, 1, 27, 161, 45255 }, // Ӹ
-    { 18, 23, 18, -1, 22, 104, 45416 }, // ӹ
-    { 22, 21, 23, 1, 18, 116, 45520 }, // Ӽ
-    { 15, 14, 16, -1, 12, 53, 45636 }, // ӽ
-    { 0, 0, 14, 0, 0, 0, 45689 }, //  
-    { 0, 0, 24, 0, 0, 0, 45689 }, //  
-    { 0, 0, 14, 0, 0, 0, 45689 }, //  
-    { 0, 0, 24, 0, 0, 0, 45689 }, //  
-    { 0, 0, 10, 0, 0, 0, 45689 }, //  
-    { 0, 0, 9, 0, 0, 0, 45689 }, //  
-    { 0, 0, 7, 0, 0, 0, 45689 }, //  
-    { 0, 0, 15, 0, 0, 0, 45689 }, //  
-    { 0, 0, 5, 0, 0, 0, 45689 }, //  
-    { 0, 0, 8, 0, 0, 0, 45689 }, //  
-    { 0, 0, 6, 0, 0, 0, 45689 }, //  
-    { 0, 0, 3, 0, 0, 0, 45689 }, // ​
-    { 0, 0, 0, 0, 0, 0, 45689 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 45689 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 45689 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 45689 }, // ‏
-    { 12, 3, 11, 1, 8, 9, 45689 }, // ‐
-    { 12, 3, 11, 1, 8, 9, 45698 }, // ‑
-    { 18, 3, 11, -1, 8, 14, 45707 }, // ‒
-    { 16, 5, 17, 2, 9, 20, 45721 }, // –
-    { 23, 5, 24, 2, 9, 29, 45741 }, // —
-    { 23, 5, 24, 2, 9, 29, 45770 }, // ―
-    { 15, 19, 11, 1, 15, 72, 45799 }, // ‖
-    { 20, 8, 11, -5, -1, 40, 45871 }, // ‗
-    { 9, 8, 9, 4, 19, 18, 45911 }, // ‘
-    { 9, 8, 9, 4, 19, 18, 45929 }, // ’
-    { 9, 8, 7, -1, 4, 18, 45947 }, // ‚
-    { 9, 8, 9, 4, 19, 18, 45965 }, // ‛
-    { 16, 8, 16, 4, 19, 32, 45983 }, // “
-    { 16, 8, 16, 4, 19, 32, 46015 }, // ”
-    { 9, 8, 7, -1, 4, 18, 46047 }, // „
-    { 16, 8, 16, 4, 19, 32, 46065 }, // ‟
-    { 13, 30, 17, 5, 22, 98, 46097 }, // †
-    { 15, 29, 18, 4, 21, 109, 46195 }, // ‡
-    { 18, 16, 11, -2, 19, 72, 46304 }, // •
-    { 7, 8, 13, 4, 10, 14, 46376 }, // ‣
-    { 7, 5, 13, 3, 5, 9, 46390 }, // ․
-    { 7, 5, 13, 3, 5, 9, 46399 }, // ‥
-    { 20, 5, 20, 0, 5, 25, 46408 }, // …
-    { 4, 3, 11, 4, 8, 3, 46433 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 46436 }, //  
-    { 19, 19, 24, 3, 17, 91, 46436 }, // ‰
-    { 10, 8, 11, 6, 19, 20, 46527 }, // ′
-    { 16, 8, 16, 6, 19, 32, 46547 }, // ″
-    { 16, 7, 9, -2, 18, 28, 46579 }, // ‴
-    { 6, 7, 9, 5, 18, 11, 46607 }, // ‵
-    { 9, 7, 9, 4, 18, 16, 46618 }, // ‶
-    { 16, 7, 9, 0, 18, 28, 46634 }, // ‷
-    { 12, 5, 14, 4, 18, 15, 46662 }, // ‸
-    { 9, 12, 9, 2, 12, 27, 46677 }, // ‹
-    { 9, 12, 9, -2, 12, 27, 46704 }, // ›
-    { 28, 28, 28, 1, 22, 196, 46731 }, // ※
-    { 12, 27, 13, 2, 24, 81, 46927 }, // ‼
-    { 17, 33, 18, 3, 28, 141, 47008 }, // ‽
-    { 12, 3, 11, 4, 18, 9, 47149 }, // ‾
-    { 11, 4, 16, 4, 14, 11, 47158 }, // ‿
-    { 16, 15, 13, 1, 19, 60, 47169 }, // ⁂
-    { 20, 18, 27, 4, 16, 90, 47229 }, // ⁄
-    { 29, 27, 31, 5, 24, 196, 47319 }, // ⁇
-    { 24, 28, 25, 4, 24, 168, 47515 }, // ⁈
-    { 23, 27, 16, -2, 24, 156, 47683 }, // ⁉
-    { 23, 36, 19, -1, 25, 207, 47839 }, // ⁒
-    { 0, 0, 97, 0, 0, 0, 48046 }, //  
-    { 7, 9, 7, 8, 18, 16, 48046 }, // ⁰
-    { 7, 8, 7, 8, 18, 14, 48062 }, // ⁴
-    { 8, 9, 7, 7, 18, 18, 48076 }, // ⁵
-    { 8, 9, 7, 7, 18, 18, 48094 }, // ⁶
-    { 7, 9, 8, 9, 18, 16, 48112 }, // ⁷
-    { 8, 9, 8, 7, 18, 18, 48128 }, // ⁸
-    { 8, 10, 8, 7, 18, 20, 48146 }, // ⁹
-    { 15, 13, 18, 1, 13, 49, 48166 }, // ⁿ
-    { 8, 9, 7, -6, 5, 18, 48215 }, // ₀
-    { 7, 9, 7, -7, 5, 16, 48233 }, // ₁
-    { 8, 9, 8, -7, 5, 18, 48249 }, // ₂
-    { 8, 9, 7, -7, 5, 18, 48267 }, // ₃
-    { 7, 8, 8, -6, 5, 14, 48285 }, // ₄
-    { 8, 9, 7, -7, 5, 18, 48299 }, // ₅
-    { 8, 9, 8, -7, 5, 18, 48317 }, // ₆
-    { 7, 10, 8, -5, 6, 18, 48335 }, // ₇
-    { 9, 9, 8, -7, 5, 21, 48353 }, // ₈
-    { 9, 9, 8, -7, 5, 21, 48374 }, // ₉
-    { 15, 29, 10, 1, 22, 109, 48395 }, // ₍
-    { 14, 29, 9, -6, 22, 102, 48504 }, // ₎
-    { 20, 27, 20, 2, 23, 135, 48606 }, // ₡
-    { 18, 19, 20, 2, 19, 86, 48741 }, // ₢
-    { 17, 19, 14, 0, 18, 81, 48827 }, // ₤
-    { 24, 18, 21, -1, 18, 108, 48908 }, // ₦
-    { 20, 18, 19, 1, 18, 90, 49016 }, // ₧
-    { 25, 19, 27, -1, 18, 119, 49106 }, // ₨
-    { 20, 18, 18, -2, 18, 90, 49225 }, // ₩
-    { 20, 16, 22, 3, 16, 80, 49315 }, // ₪
-    { 19, 18, 11, -2, 17, 86, 49395 }, // ₫
-    { 17, 20, 17, 1, 17, 85, 49481 }, // €
-    { 17, 18, 21, 5, 18, 77, 49566 }, // ₮
-    { 23, 18, 13, 0, 18, 104, 49643 }, // ₱
-    { 19, 27, 24, 2, 23, 129, 49747 }, // ₲
-    { 24, 18, 22, 6, 17, 108, 49876 }, // ₴
-    { 12, 17, 12, 2, 15, 51, 49984 }, // ₵
-    { 20, 19, 21, 5, 19, 95, 50035 }, // ₸
-    { 14, 17, 14, 3, 16, 60, 50130 }, // ₹
-    { 14, 16, 14, 1, 14, 56, 50190 }, // ₺
-    { 16, 18, 17, 3, 17, 72, 50246 }, // ₼
-    { 21, 18, 19, -3, 18, 95, 50318 }, // ₽
-    { 15, 15, 15, -4, 11, 57, 50413 }, // ←
-    { 15, 15, 16, 2, 14, 57, 50470 }, // ↑
-    { 15, 15, 16, 4, 11, 57, 50527 }, // →
-    { 15, 15, 16, 6, 14, 57, 50584 }, // ↓
-    { 24, 12, 21, -1, 10, 72, 50641 }, // ↔
-    { 13, 23, 17, 3, 22, 75, 50713 }, // ↕
-    { 15, 10, 16, -2, 10, 38, 50788 }, // ↖
-    { 14, 10, 13, 2, 10, 35, 50826 }, // ↗
-    { 12, 14, 13, 4, 12, 42, 50861 }, // ↘
-    { 11, 14, 13, -2, 12, 39, 50903 }, // ↙
-    { 17, 14, 20, 1, 13, 60, 50942 }, // ⇐
-    { 18, 17, 22, 4, 16, 77, 51002 }, // ⇑
-    { 17, 14, 20, 3, 13, 60, 51079 }, // ⇒
-    { 18, 17, 22, 8, 15, 77, 51139 }, // ⇓
-    { 21, 14, 23, 1, 13, 74, 51216 }, // ⇔
-    { 15, 21, 19, 5, 12, 79, 51290 }, // ⇕
-    { 17, 19, 14, 1, 18, 81, 51369 }, // ∂
-    { 23, 20, 23, 0, 19, 115, 51450 }, // ∅
-    { 18, 17, 18, 0, 16, 77, 51565 }, // ∆
-    { 17, 16, 15, 2, 15, 68, 51642 }, // ∏
-    { 17, 17, 15, 6, 16, 73, 51710 }, // ∐
-    { 16, 16, 12, 0, 15, 64, 51783 }, // ∑
-    { 12, 4, 13, 1, 8, 12, 51847 }, // −
-    { 22, 19, 20, 2, 18, 105, 51859 }, // √
-    { 19, 12, 19, 2, 14, 57, 51964 }, // ∞
-    { 21, 23, 18, 0, 17, 121, 52021 }, // ∫
-    { 9, 14, 7, 0, 14, 32, 52142 }, // ∶
-    { 15, 13, 30, 11, 12, 49, 52174 }, // ≈
-    { 20, 19, 27, 4, 17, 95, 52223 }, // ≠
-    { 20, 18, 17, -3, 16, 90, 52318 }, // ≤
-    { 20, 18, 18, 0, 16, 90, 52408 }, // ≥
+    { 21, 19, 21, 1, 18, 100, 2048 }, // @
+    { 18, 18, 23, 1, 18, 81, 2148 }, // A
+    { 17, 18, 19, 1, 18, 77, 2229 }, // B
+    { 18, 19, 20, 2, 19, 86, 2306 }, // C
+    { 20, 18, 21, 1, 18, 90, 2392 }, // D
+    { 18, 18, 19, 1, 18, 81, 2482 }, // E
+    { 17, 18, 17, 1, 18, 77, 2563 }, // F
+    { 19, 19, 24, 2, 19, 91, 2640 }, // G
+    { 20, 18, 21, 1, 18, 90, 2731 }, // H
+    { 10, 18, 11, 1, 18, 45, 2821 }, // I
+    { 19, 23, 18, 0, 18, 110, 2866 }, // J
+    { 19, 18, 21, 1, 18, 86, 2976 }, // K
+    { 14, 18, 18, 1, 18, 63, 3062 }, // L
+    { 23, 18, 24, 1, 18, 104, 3125 }, // M
+    { 21, 18, 21, 1, 18, 95, 3229 }, // N
+    { 21, 19, 23, 2, 18, 100, 3324 }, // O
+    { 17, 18, 19, 1, 18, 77, 3424 }, // P
+    { 20, 22, 24, 2, 19, 110, 3501 }, // Q
+    { 17, 18, 20, 1, 18, 77, 3611 }, // R
+    { 18, 18, 22, 1, 18, 81, 3688 }, // S
+    { 17, 18, 21, 5, 18, 77, 3769 }, // T
+    { 21, 19, 21, 1, 18, 100, 3846 }, // U
+    { 18, 18, 23, 6, 18, 81, 3946 }, // V
+    { 25, 18, 29, 5, 18, 113, 4096 }, // W
+    { 22, 18, 23, 1, 18, 99, 4209 }, // X
+    { 16, 18, 22, 6, 18, 72, 4308 }, // Y
+    { 22, 18, 22, 1, 18, 99, 4380 }, // Z
+    { 16, 31, 10, -1, 23, 124, 4479 }, // [
+    { 5, 24, 10, 4, 19, 30, 4603 }, // <backslash>
+    { 16, 31, 10, -5, 23, 124, 4633 }, // ]
+    { 12, 6, 12, 3, 20, 18, 4757 }, // ^
+    { 16, 5, 14, -2, -1, 20, 4775 }, // _
+    { 8, 4, 9, 4, 16, 8, 4795 }, // `
+    { 14, 13, 18, 1, 13, 46, 4803 }, // a
+    { 13, 19, 18, 3, 18, 62, 4849 }, // b
+    { 12, 13, 16, 2, 13, 39, 4911 }, // c
+    { 17, 18, 18, 2, 18, 77, 4950 }, // d
+    { 14, 12, 18, 2, 12, 42, 5027 }, // e
+    { 12, 17, 14, 2, 17, 51, 5069 }, // f
+    { 17, 19, 18, 0, 12, 81, 5120 }, // g
+    { 15, 18, 18, 1, 18, 68, 5201 }, // h
+    { 11, 19, 9, 0, 19, 53, 5269 }, // i
+    { 14, 25, 13, 1, 19, 88, 5322 }, // j
+    { 13, 18, 19, 1, 18, 59, 5410 }, // k
+    { 10, 18, 12, 1, 18, 45, 5469 }, // l
+    { 22, 13, 25, 1, 13, 72, 5514 }, // m
+    { 15, 13, 18, 1, 13, 49, 5586 }, // n
+    { 14, 12, 18, 2, 12, 42, 5635 }, // o
+    { 19, 19, 20, -1, 13, 91, 5677 }, // p
+    { 15, 19, 20, 2, 13, 72, 5768 }, // q
+    { 12, 12, 15, 1, 12, 36, 5840 }, // r
+    { 14, 14, 18, 1, 13, 49, 5876 }, // s
+    { 11, 17, 16, 4, 17, 47, 5925 }, // t
+    { 14, 12, 18, 2, 12, 42, 5972 }, // u
+    { 15, 12, 20, 4, 12, 45, 6014 }, // v
+    { 18, 13, 23, 4, 12, 59, 6059 }, // w
+    { 18, 12, 20, 1, 12, 54, 6144 }, // x
+    { 17, 18, 19, 1, 12, 77, 6198 }, // y
+    { 16, 12, 18, 1, 12, 48, 6275 }, // z
+    { 14, 21, 15, 2, 16, 74, 6323 }, // {
+    { 9, 19, 8, 1, 15, 43, 6397 }, // |
+    { 14, 21, 15, -1, 16, 74, 6440 }, // }
+    { 9, 5, 10, 4, 16, 12, 6514 }, // ~
+    { 0, 0, 18, 0, 0, 0, 6526 }, //  
+    { 11, 27, 11, 2, 23, 75, 6526 }, // ¡
+    { 12, 20, 16, 2, 16, 60, 6601 }, // ¢
+    { 17, 20, 14, 0, 19, 85, 6661 }, // £
+    { 15, 13, 14, 1, 14, 49, 6746 }, // ¤
+    { 18, 19, 16, 2, 16, 86, 6795 }, // ¥
+    { 8, 19, 8, 1, 15, 38, 6881 }, // ¦
+    { 16, 18, 16, 1, 17, 72, 6919 }, // §
+    { 12, 5, 11, 3, 17, 15, 6991 }, // ¨
+    { 11, 9, 14, 6, 20, 25, 7006 }, // ©
+    { 8, 7, 14, 6, 16, 14, 7031 }, // ª
+    { 15, 12, 17, 2, 12, 45, 7045 }, // «
+    { 12, 8, 13, 2, 8, 24, 7090 }, // ¬
+    { 12, 3, 13, 2, 8, 9, 7114 }, // ­
+    { 11, 9, 14, 6, 23, 25, 7123 }, // ®
+    { 10, 4, 11, 4, 16, 10, 7148 }, // ¯
+    { 12, 10, 14, 4, 16, 30, 7158 }, // °
+    { 16, 16, 17, 0, 12, 64, 7188 }, // ±
+    { 8, 8, 7, 7, 17, 16, 7252 }, // ²
+    { 8, 8, 7, 7, 17, 16, 7268 }, // ³
+    { 7, 5, 6, 3, 16, 9, 7284 }, // ´
+    { 17, 15, 18, -1, 12, 64, 7293 }, // µ
+    { 16, 18, 16, 1, 15, 72, 7357 }, // ¶
+    { 7, 5, 5, 1, 10, 9, 7429 }, // ·
+    { 7, 7, 7, -1, 1, 13, 7438 }, // ¸
+    { 6, 8, 6, 7, 17, 12, 7451 }, // ¹
+    { 8, 7, 14, 6, 15, 14, 7463 }, // º
+    { 15, 12, 16, -3, 12, 45, 7477 }, // »
+    { 22, 20, 27, 2, 18, 110, 7522 }, // ¼
+    { 23, 20, 27, 2, 18, 115, 7632 }, // ½
+    { 22, 19, 27, 2, 17, 105, 7747 }, // ¾
+    { 16, 26, 14, -2, 15, 104, 7852 }, // ¿
+    { 18, 24, 23, 1, 24, 108, 7956 }, // À
+    { 19, 28, 23, 1, 28, 133, 8192 }, // Á
+    { 19, 25, 23, 1, 25, 119, 8325 }, // Â
+    { 19, 25, 23, 1, 25, 119, 8444 }, // Ã
+    { 21, 25, 23, 1, 25, 132, 8563 }, // Ä
+    { 18, 25, 23, 1, 25, 113, 8695 }, // Å
+    { 29, 19, 28, 1, 18, 138, 8808 }, // Æ
+    { 18, 25, 20, 2, 19, 113, 8946 }, // Ç
+    { 18, 25, 19, 1, 25, 113, 9059 }, // È
+    { 18, 28, 19, 1, 28, 126, 9172 }, // É
+    { 18, 26, 19, 1, 26, 117, 9298 }, // Ê
+    { 19, 26, 19, 1, 26, 124, 9415 }, // Ë
+    { 12, 25, 11, 1, 25, 75, 9539 }, // Ì
+    { 13, 29, 11, 1, 29, 95, 9614 }, // Í
+    { 13, 26, 11, 1, 26, 85, 9709 }, // Î
+    { 15, 27, 11, 1, 27, 102, 9794 }, // Ï
+    { 21, 18, 21, 0, 18, 95, 9896 }, // Ð
+    { 21, 25, 21, 1, 25, 132, 9991 }, // Ñ
+    { 21, 25, 23, 2, 24, 132, 10240 }, // Ò
+    { 21, 28, 23, 2, 27, 147, 10372 }, // Ó
+    { 21, 26, 23, 2, 25, 137, 10519 }, // Ô
+    { 21, 26, 23, 2, 25, 137, 10656 }, // Õ
+    { 21, 26, 23, 2, 25, 137, 10793 }, // Ö
+    { 14, 7, 12, 0, 9, 25, 10930 }, // ×
+    { 41, 37, 23, -8, 28, 380, 10955 }, // Ø
+    { 21, 26, 21, 1, 25, 137, 11335 }, // Ù
+    { 21, 30, 21, 1, 29, 158, 11472 }, // Ú
+    { 21, 27, 21, 1, 26, 142, 11630 }, // Û
+    { 21, 28, 21, 1, 27, 147, 11772 }, // Ü
+    { 16, 30, 22, 6, 30, 120, 11919 }, // Ý
+    { 13, 17, 12, 1, 17, 56, 12039 }, // Þ
+    { 16, 18, 14, 0, 17, 72, 12095 }, // ß
+    { 14, 19, 18, 1, 19, 67, 12167 }, // à
+    { 15, 22, 18, 1, 22, 83, 12288 }, // á
+    { 15, 19, 18, 1, 19, 72, 12371 }, // â
+    { 15, 19, 18, 1, 19, 72, 12443 }, // ã
+    { 17, 20, 18, 1, 20, 85, 12515 }, // ä
+    { 14, 20, 18, 1, 20, 70, 12600 }, // å
+    { 23, 13, 26, 1, 13, 75, 12670 }, // æ
+    { 12, 18, 16, 2, 13, 54, 12745 }, // ç
+    { 14, 21, 18, 2, 21, 74, 12799 }, // è
+    { 15, 24, 18, 2, 24, 90, 12873 }, // é
+    { 15, 21, 18, 2, 21, 79, 12963 }, // ê
+    { 16, 22, 18, 2, 22, 88, 13042 }, // ë
+    { 10, 18, 9, 0, 18, 45, 13130 }, // ì
+    { 11, 22, 9, 0, 22, 61, 13175 }, // í
+    { 12, 19, 9, -1, 19, 57, 13236 }, // î
+    { 12, 18, 9, 0, 18, 54, 13293 }, // ï
+    { 20, 19, 14, 0, 18, 95, 13347 }, // ð
+    { 16, 20, 18, 1, 20, 80, 13442 }, // ñ
+    { 14, 18, 18, 2, 18, 63, 13522 }, // ò
+    { 14, 22, 18, 2, 22, 77, 13585 }, // ó
+    { 14, 19, 18, 2, 19, 67, 13662 }, // ô
+    { 14, 19, 18, 2, 19, 67, 13729 }, // õ
+    { 16, 19, 18, 2, 19, 76, 13796 }, // ö
+    { 16, 15, 19, 3, 15, 60, 13872 }, // ÷
+    { 24, 35, 18, -3, 24, 210, 13932 }, // ø
+    { 14, 18, 18, 2, 18, 63, 14142 }, // ù
+    { 14, 22, 18, 2, 22, 77, 14205 }, // ú
+    { 14, 19, 18, 2, 19, 67, 14336 }, // û
+    { 16, 20, 18, 2, 20, 80, 14403 }, // ü
+    { 17, 31, 19, 1, 25, 132, 14483 }, // ý
+    { 14, 22, 12, 0, 17, 77, 14615 }, // þ
+    { 18, 28, 19, 1, 22, 126, 14692 }, // ÿ
+    { 21, 25, 23, 1, 25, 132, 14818 }, // Ā
+    { 17, 20, 18, 1, 20, 85, 14950 }, // ā
+    { 21, 26, 23, 1, 26, 137, 15035 }, // Ă
+    { 17, 20, 18, 1, 20, 85, 15172 }, // ă
+    { 18, 24, 23, 1, 18, 108, 15257 }, // Ą
+    { 14, 19, 18, 1, 13, 67, 15365 }, // ą
+    { 18, 25, 20, 2, 25, 113, 15432 }, // Ć
+    { 12, 18, 16, 2, 18, 54, 15545 }, // ć
+    { 19, 27, 20, 2, 27, 129, 15599 }, // Ĉ
+    { 15, 19, 16, 2, 19, 72, 15728 }, // ĉ
+    { 18, 25, 20, 2, 25, 113, 15800 }, // Ċ
+    { 13, 18, 16, 2, 18, 59, 15913 }, // ċ
+    { 20, 27, 20, 2, 27, 135, 15972 }, // Č
+    { 16, 20, 16, 2, 20, 80, 16107 }, // č
+    { 20, 27, 21, 1, 27, 135, 16187 }, // Ď
+    { 20, 18, 18, 2, 18, 90, 16384 }, // ď
+    { 21, 18, 21, 0, 18, 95, 16474 }, // Đ
+    { 20, 18, 18, 2, 18, 90, 16569 }, // đ
+    { 19, 26, 19, 1, 26, 124, 16659 }, // Ē
+    { 16, 22, 18, 2, 22, 88, 16783 }, // ē
+    { 19, 26, 19, 1, 26, 124, 16871 }, // Ĕ
+    { 17, 22, 18, 2, 22, 94, 16995 }, // ĕ
+    { 18, 26, 19, 1, 26, 117, 17089 }, // Ė
+    { 14, 22, 18, 2, 22, 77, 17206 }, // ė
+    { 18, 23, 19, 1, 18, 104, 17283 }, // Ę
+    { 14, 20, 18, 2, 12, 70, 17387 }, // ę
+    { 20, 28, 19, 1, 28, 140, 17457 }, // Ě
+    { 18, 24, 18, 2, 24, 108, 17597 }, // ě
+    { 21, 29, 24, 2, 29, 153, 17705 }, // Ĝ
+    { 19, 28, 18, 0, 21, 133, 17858 }, // ĝ
+    { 22, 28, 24, 2, 28, 154, 17991 }, // Ğ
+    { 19, 27, 18, 0, 20, 129, 18145 }, // ğ
+    { 19, 28, 24, 2, 28, 133, 18274 }, // Ġ
+    { 17, 27, 18, 0, 20, 115, 18432 }, // ġ
+    { 20, 31, 24, 2, 31, 155, 18547 }, // Ģ
+    { 17, 28, 18, 0, 21, 119, 18702 }, // ģ
+    { 20, 26, 21, 1, 26, 130, 18821 }, // Ĥ
+    { 15, 26, 18, 1, 26, 98, 18951 }, // ĥ
+    { 21, 18, 21, 1, 18, 95, 19049 }, // Ħ
+    { 15, 18, 18, 1, 18, 68, 19144 }, // ħ
+    { 14, 27, 11, 1, 27, 95, 19212 }, // Ĩ
+    { 12, 20, 9, 0, 20, 60, 19307 }, // ĩ
+    { 15, 27, 11, 1, 27, 102, 19367 }, // Ī
+    { 13, 19, 9, 0, 19, 62, 19469 }, // ī
+    { 12, 23, 11, -1, 18, 69, 19531 }, // Į
+    { 13, 25, 9, -2, 19, 82, 19600 }, // į
+    { 13, 27, 11, 1, 27, 88, 19682 }, // İ
+    { 8, 12, 9, 0, 12, 24, 19770 }, // ı
+    { 21, 26, 33, 6, 18, 137, 19794 }, // Ĳ
+    { 21, 24, 9, 0, 19, 126, 19931 }, // ĳ
+    { 22, 31, 18, 0, 26, 171, 20057 }, // Ĵ
+    { 18, 27, 13, 1, 21, 122, 20228 }, // ĵ
+    { 19, 29, 21, 1, 29, 138, 20480 }, // Ķ
+    { 15, 29, 19, -1, 18, 109, 20618 }, // ķ
+    { 12, 12, 14, -2, 12, 36, 20727 }, // ĸ
+    { 14, 24, 18, 1, 24, 84, 20763 }, // Ĺ
+    { 13, 27, 12, 1, 27, 88, 20847 }, // ĺ
+    { 14, 29, 18, 1, 18, 102, 20935 }, // Ļ
+    { 13, 29, 12, -2, 18, 95, 21037 }, // ļ
+    { 16, 18, 18, 1, 18, 72, 21132 }, // Ľ
+    { 16, 21, 12, 1, 21, 84, 21204 }, // ľ
+    { 16, 18, 18, 1, 18, 72, 21288 }, // Ŀ
+    { 13, 18, 12, 1, 18, 59, 21360 }, // ŀ
+    { 32, 30, 18, -10, 24, 240, 21419 }, // Ł
+    { 22, 18, 12, -7, 18, 99, 21659 }, // ł
+    { 21, 25, 21, 1, 25, 132, 21758 }, // Ń
+    { 15, 20, 18, 1, 20, 75, 21890 }, // ń
+    { 21, 27, 21, 1, 18, 142, 21965 }, // Ņ
+    { 15, 21, 18, 1, 13, 79, 22107 }, // ņ
+    { 22, 27, 21, 1, 27, 149, 22186 }, // Ň
+    { 19, 22, 18, 1, 22, 105, 22335 }, // ň
+    { 28, 21, 18, -12, 21, 147, 22528 }, // ŉ
+    { 21, 23, 21, 1, 18, 121, 22675 }, // Ŋ
+    { 15, 17, 18, 1, 13, 64, 22796 }, // ŋ
+    { 21, 26, 23, 2, 25, 137, 22860 }, // Ō
+    { 16, 19, 18, 2, 19, 76, 22997 }, // ō
+    { 21, 27, 23, 2, 26, 142, 23073 }, // Ŏ
+    { 16, 20, 18, 2, 20, 80, 23215 }, // ŏ
+    { 23, 25, 23, 2, 24, 144, 23295 }, // Ő
+    { 19, 18, 18, 2, 18, 86, 23439 }, // ő
+    { 28, 20, 25, 2, 19, 140, 23525 }, // Œ
+    { 22, 12, 22, 2, 12, 66, 23665 }, // œ
+    { 17, 25, 20, 1, 25, 107, 23731 }, // Ŕ
+    { 12, 17, 15, 1, 17, 51, 23838 }, // ŕ
+    { 17, 29, 20, 1, 29, 124, 23889 }, // Ŗ
+    { 13, 22, 15, 1, 22, 72, 24013 }, // ŗ
+    { 19, 26, 20, 1, 26, 124, 24085 }, // Ř
+    { 15, 19, 15, 1, 19, 72, 24209 }, // ř
+    { 18, 25, 22, 1, 25, 113, 24281 }, // Ś
+    { 14, 19, 18, 1, 18, 67, 24394 }, // ś
+    { 20, 26, 22, 1, 26, 130, 24576 }, // Ŝ
+    { 17, 20, 18, 1, 19, 85, 24706 }, // ŝ
+    { 18, 23, 22, 1, 18, 104, 24791 }, // Ş
+    { 14, 19, 18, 1, 13, 67, 24895 }, // ş
+    { 21, 26, 22, 1, 26, 137, 24962 }, // Š
+    { 18, 21, 18, 1, 20, 95, 25099 }, // š
+    { 17, 24, 21, 5, 18, 102, 25194 }, // Ţ
+    { 13, 22, 16, 2, 17, 72, 25296 }, // ţ
+    { 17, 26, 21, 5, 26, 111, 25368 }, // Ť
+    { 16, 20, 16, 4, 20, 80, 25479 }, // ť
+    { 17, 18, 21, 5, 18, 77, 25559 }, // Ŧ
+    { 13, 17, 16, 2, 17, 56, 25636 }, // ŧ
+    { 21, 28, 21, 1, 27, 147, 25692 }, // Ũ
+    { 15, 20, 18, 2, 20, 75, 25839 }, // ũ
+    { 21, 28, 21, 1, 27, 147, 25914 }, // Ū
+    { 16, 19, 18, 2, 19, 76, 26061 }, // ū
+    { 21, 28, 21, 1, 27, 147, 26137 }, // Ŭ
+    { 16, 20, 18, 2, 20, 80, 26284 }, // ŭ
+    { 21, 29, 21, 1, 28, 153, 26364 }, // Ů
+    { 14, 21, 18, 2, 21, 74, 26517 }, // ů
+    { 23, 27, 21, 1, 26, 156, 26624 }, // Ű
+    { 19, 19, 18, 2, 19, 91, 26780 }, // ű
+    { 21, 23, 21, 1, 18, 121, 26871 }, // Ų
+    { 14, 18, 18, 2, 12, 63, 26992 }, // ų
+    { 25, 26, 29, 5, 26, 163, 27055 }, // Ŵ
+    { 18, 22, 23, 4, 21, 99, 27218 }, // ŵ
+    { 16, 28, 22, 6, 28, 112, 27317 }, // Ŷ
+    { 17, 28, 19, 1, 22, 119, 27429 }, // ŷ
+    { 16, 28, 22, 6, 28, 112, 27548 }, // Ÿ
+    { 22, 24, 22, 1, 24, 132, 27660 }, // Ź
+    { 16, 20, 18, 1, 20, 80, 27792 }, // ź
+    { 22, 24, 22, 1, 24, 132, 27872 }, // Ż
+    { 16, 20, 18, 1, 20, 80, 28004 }, // ż
+    { 22, 26, 22, 1, 26, 143, 28084 }, // Ž
+    { 19, 21, 18, 1, 21, 100, 28227 }, // ž
+    { 12, 17, 13, 2, 17, 51, 28327 }, // ſ
+    { 8, 4, 0, 4, 16, 8, 28378 }, // ̀
+    { 7, 5, 0, 3, 16, 9, 28386 }, // ́
+    { 12, 6, 0, -1, 1, 18, 28395 }, // ̂
+    { 9, 5, 0, 4, 16, 12, 28413 }, // ̃
+    { 12, 4, 0, 4, 15, 12, 28425 }, // ̄
+    { 15, 4, 0, 5, 19, 15, 28437 }, // ̅
+    { 11, 6, 0, 4, 16, 17, 28452 }, // ̆
+    { 6, 5, 0, 4, 17, 8, 28469 }, // ̇
+    { 10, 4, 0, 3, 15, 10, 28477 }, // ̈
+    { 5, 6, 0, 7, 14, 8, 28487 }, // ̉
+    { 6, 5, 0, 4, 16, 8, 28495 }, // ̊
+    { 17, 4, 0, 4, 16, 17, 28503 }, // ̋
+    { 12, 6, 0, 4, 17, 18, 28520 }, // ̌
+    { 18, 4, 0, -8, 16, 18, 28538 }, // ̏
+    { 10, 8, 0, 2, 17, 20, 28556 }, // ̒
+    { 10, 8, 0, 2, 16, 20, 28576 }, // ̓
+    { 9, 8, 0, -5, 16, 18, 28596 }, // ̔
+    { 6, 6, 0, 0, 0, 9, 28614 }, // ̘
+    { 6, 6, 0, 1, 0, 9, 28623 }, // ̙
+    { 10, 6, 0, 5, 17, 15, 28632 }, // ̚
+    { 5, 7, 0, 3, 15, 9, 28647 }, // ̛
+    { 5, 7, 0, -1, 0, 9, 28656 }, // ̜
+    { 6, 6, 0, 2, 4, 9, 28672 }, // ̝
+    { 6, 6, 0, -1, 0, 9, 28681 }, // ̞
+    { 5, 5, 0, 0, -2, 7, 28690 }, // ̟
+    { 12, 4, 0, -1, -2, 12, 28697 }, // ̠
+    { 6, 5, 0, -3, 2, 8, 28709 }, // ̣
+    { 11, 4, 0, -2, -1, 11, 28717 }, // ̤
+    { 6, 5, 0, 4, 16, 8, 28728 }, // ̥
+    { 10, 8, 0, -1, 4, 20, 28736 }, // ̦
+    { 7, 7, 0, -1, 1, 13, 28756 }, // ̧
+    { 7, 8, 0, 0, 2, 14, 28769 }, // ̨
+    { 7, 7, 0, -2, -1, 13, 28783 }, // ̩
+    { 10, 5, 0, -1, 0, 13, 28796 }, // ̪
+    { 14, 6, 0, -1, 1, 21, 28809 }, // ̬
+    { 13, 6, 0, -1, 1, 20, 28830 }, // ̭
+    { 10, 6, 0, 5, 18, 15, 28850 }, // ̰
+    { 11, 4, 0, 5, 18, 11, 28865 }, // ̱
+    { 11, 4, 0, -1, -1, 11, 28876 }, // ̲
+    { 11, 6, 0, 5, 18, 17, 28887 }, // ̴
+    { 12, 3, 0, 1, 8, 9, 28904 }, // ̵
+    { 5, 8, 0, 1, 1, 10, 28913 }, // ̹
+    { 11, 7, 0, -3, 1, 20, 28923 }, // ̺
+    { 10, 7, 0, -1, 1, 18, 28943 }, // ̻
+    { 10, 6, 0, -1, 1, 15, 28961 }, // ̼
+    { 7, 5, 0, 4, 16, 9, 28976 }, // ̽
+    { 9, 5, 0, 4, 16, 12, 28985 }, // ͂
+    { 5, 6, 0, 8, 19, 8, 28997 }, // ̓
+    { 13, 15, 0, 3, 26, 49, 29005 }, // ̈́
+    { 11, 5, 0, 3, 17, 14, 29054 }, // ͆
+    { 14, 8, 0, -2, 0, 28, 29068 }, // ͇
+    { 11, 7, 0, -1, 1, 20, 29096 }, // ͈
+    { 9, 6, 0, -1, -1, 14, 29116 }, // ͉
+    { 15, 17, 0, 3, 23, 64, 29130 }, // ͊
+    { 21, 16, 0, 7, 24, 84, 29194 }, // ͋
+    { 15, 13, 0, 11, 12, 49, 29278 }, // ͌
+    { 11, 24, 0, 1, 8, 66, 29327 }, // ͍
+    { 5, 4, 0, 10, 3, 5, 29393 }, // ͎
+    { 19, 5, 0, 0, 1, 24, 29398 }, // ͜
+    { 19, 6, 0, 3, 17, 29, 29422 }, // ͡
+    { 23, 7, 0, -1, 0, 41, 29451 }, // ͢
+    { 18, 25, 18, 1, 25, 113, 29492 }, // Ѐ
+    { 19, 26, 19, 1, 26, 124, 29605 }, // Ё
+    { 19, 20, 14, 2, 18, 95, 29729 }, // Ђ
+    { 17, 25, 14, 0, 24, 107, 29824 }, // Ѓ
+    { 18, 18, 17, 1, 16, 81, 29931 }, // Є
+    { 18, 18, 22, 1, 18, 81, 30012 }, // Ѕ
+    { 10, 18, 11, 1, 18, 45, 30093 }, // І
+    { 14, 26, 11, 1, 26, 91, 30138 }, // Ї
+    { 19, 23, 18, 0, 18, 110, 30229 }, // Ј
+    { 23, 18, 24, 1, 16, 104, 30339 }, // Љ
+    { 21, 17, 13, -4, 16, 90, 30443 }, // Њ
+    { 17, 19, 21, 5, 19, 81, 30533 }, // Ћ
+    { 19, 24, 21, 1, 24, 114, 30720 }, // Ќ
+    { 19, 23, 20, 1, 23, 110, 30834 }, // Ѝ
+    { 18, 27, 17, 0, 25, 122, 30944 }, // Ў
+    { 18, 21, 17, 1, 16, 95, 31066 }, // Џ
+    { 18, 18, 23, 1, 18, 81, 31161 }, // А
+    { 15, 17, 14, 2, 16, 64, 31242 }, // Б
+    { 15, 16, 14, 1, 15, 60, 31306 }, // В
+    { 17, 17, 14, 0, 16, 73, 31366 }, // Г
+    { 18, 19, 17, 1, 16, 86, 31439 }, // Д
+    { 17, 18, 18, 1, 18, 77, 31525 }, // Е
+    { 30, 18, 31, 0, 18, 135, 31602 }, // Ж
+    { 14, 17, 13, 1, 16, 60, 31737 }, // З
+    { 19, 18, 20, 1, 18, 86, 31797 }, // И
+    { 19, 24, 20, 1, 24, 114, 31883 }, // Й
+    { 19, 18, 21, 1, 18, 86, 31997 }, // К
+    { 18, 18, 13, -1, 16, 81, 32083 }, // Л
+    { 21, 17, 18, 0, 16, 90, 32164 }, // М
+    { 20, 18, 21, 1, 18, 90, 32254 }, // Н
+    { 21, 19, 23, 2, 18, 100, 32344 }, // О
+    { 17, 17, 14, 0, 16, 73, 32444 }, // П
+    { 17, 18, 19, 1, 18, 77, 32517 }, // Р
+    { 18, 19, 20, 2, 19, 86, 32594 }, // С
+    { 17, 18, 21, 5, 18, 77, 32680 }, // Т
+    { 18, 18, 17, 0, 16, 81, 32768 }, // У
+    { 16, 16, 18, 4, 16, 64, 32849 }, // Ф
+    { 22, 18, 23, 1, 18, 99, 32913 }, // Х
+    { 17, 20, 15, 0, 16, 85, 33012 }, // Ц
+    { 14, 16, 14, 3, 16, 56, 33097 }, // Ч
+    { 19, 17, 17, 1, 16, 81, 33153 }, // Ш
+    { 19, 20, 19, 1, 16, 95, 33234 }, // Щ
+    { 14, 17, 13, -1, 16, 60, 33329 }, // Ъ
+    { 23, 19, 24, 1, 18, 110, 33389 }, // Ы
+    { 12, 17, 13, 1, 16, 51, 33499 }, // Ь
+    { 19, 18, 20, 1, 16, 86, 33550 }, // Э
+    { 20, 17, 19, 1, 16, 85, 33636 }, // Ю
+    { 18, 18, 18, 0, 18, 81, 33721 }, // Я
+    { 14, 13, 18, 1, 13, 46, 33802 }, // а
+    { 17, 20, 14, 2, 19, 85, 33848 }, // б
+    { 13, 12, 15, -1, 12, 39, 33933 }, // в
+    { 15, 13, 12, 0, 12, 49, 33972 }, // г
+    { 16, 15, 16, 1, 12, 60, 34021 }, // д
+    { 14, 12, 18, 2, 12, 42, 34081 }, // е
+    { 30, 15, 31, 0, 15, 113, 34123 }, // ж
+    { 10, 11, 9, -2, 11, 28, 34236 }, // з
+    { 16, 13, 14, 0, 12, 52, 34264 }, // и
+    { 15, 18, 13, 0, 18, 68, 34316 }, // й
+    { 15, 12, 17, -1, 12, 45, 34384 }, // к
+    { 13, 12, 9, -3, 11, 39, 34429 }, // л
+    { 16, 13, 18, -1, 13, 52, 34468 }, // м
+    { 17, 13, 17, -1, 13, 56, 34520 }, // н
+    { 14, 12, 18, 2, 12, 42, 34576 }, // о
+    { 16, 13, 14, 0, 12, 52, 34618 }, // п
+    { 19, 19, 20, -1, 13, 91, 34670 }, // р
+    { 12, 13, 16, 2, 13, 39, 34761 }, // с
+    { 14, 13, 14, 3, 12, 46, 34816 }, // т
+    { 17, 18, 19, 1, 12, 77, 34862 }, // у
+    { 18, 17, 18, 2, 12, 77, 34939 }, // ф
+    { 17, 13, 15, 0, 12, 56, 35016 }, // х
+    { 15, 15, 15, 1, 12, 57, 35072 }, // ц
+    { 9, 11, 9, 0, 11, 25, 35129 }, // ч
+    { 18, 13, 17, 1, 12, 59, 35154 }, // ш
+    { 18, 16, 19, 1, 12, 72, 35213 }, // щ
+    { 11, 13, 10, -2, 12, 36, 35285 }, // ъ
+    { 17, 15, 18, -1, 14, 64, 35321 }, // ы
+    { 10, 13, 10, -1, 12, 33, 35385 }, // ь
+    { 12, 13, 13, 2, 12, 39, 35418 }, // э
+    { 16, 14, 15, 0, 13, 56, 35457 }, // ю
+    { 13, 13, 17, 1, 13, 43, 35513 }, // я
+    { 15, 22, 18, 2, 22, 83, 35556 }, // ѐ
+    { 15, 21, 18, 2, 21, 79, 35639 }, // ё
+    { 15, 23, 18, 1, 18, 87, 35718 }, // ђ
+    { 15, 18, 12, 0, 17, 68, 35805 }, // ѓ
+    { 13, 12, 12, -1, 11, 39, 35873 }, // є
+    { 14, 14, 18, 1, 13, 49, 35912 }, // ѕ
+    { 11, 19, 9, 0, 19, 53, 35961 }, // і
+    { 12, 18, 9, 0, 18, 54, 36014 }, // ї
+    { 14, 25, 13, 1, 19, 88, 36068 }, // ј
+    { 16, 12, 17, -1, 11, 48, 36156 }, // љ
+    { 15, 13, 9, -5, 12, 49, 36204 }, // њ
+    { 15, 18, 18, 1, 18, 68, 36253 }, // ћ
+    { 16, 18, 17, -1, 18, 72, 36321 }, // ќ
+    { 16, 20, 14, 0, 19, 80, 36393 }, // ѝ
+    { 19, 28, 19, 1, 22, 133, 36473 }, // ў
+    { 13, 15, 12, -1, 12, 49, 36606 }, // џ
+    { 14, 18, 16, 3, 16, 63, 36655 }, // Ѣ
+    { 14, 18, 14, 2, 16, 63, 36718 }, // ѣ
+    { 23, 17, 18, -1, 16, 98, 36864 }, // Ѫ
+    { 16, 13, 13, -3, 12, 52, 36962 }, // ѫ
+    { 23, 23, 24, 2, 23, 133, 37014 }, // Ѳ
+    { 18, 17, 18, 2, 17, 77, 37147 }, // ѳ
+    { 21, 22, 23, 6, 22, 116, 37224 }, // Ѵ
+    { 15, 15, 18, 4, 15, 57, 37340 }, // ѵ
+    { 10, 8, 0, 6, 20, 20, 37397 }, // ҆
+    { 18, 19, 14, 0, 18, 86, 37417 }, // Ґ
+    { 16, 16, 12, 0, 15, 64, 37503 }, // ґ
+    { 17, 17, 14, 0, 16, 73, 37567 }, // Ғ
+    { 12, 11, 9, -2, 11, 33, 37640 }, // ғ
+    { 17, 20, 13, 0, 18, 85, 37673 }, // Ҕ
+    { 11, 12, 8, -3, 11, 33, 37758 }, // ҕ
+    { 30, 22, 31, 0, 18, 165, 37791 }, // Җ
+    { 21, 15, 21, -2, 12, 79, 37956 }, // җ
+    { 14, 19, 13, 1, 16, 67, 38035 }, // Ҙ
+    { 10, 17, 9, -2, 11, 43, 38102 }, // ҙ
+    { 19, 22, 15, 0, 18, 105, 38145 }, // Қ
+    { 13, 15, 10, -2, 12, 49, 38250 }, // қ
+    { 22, 18, 23, 1, 17, 99, 38299 }, // Ҝ
+    { 16, 11, 16, 0, 11, 44, 38398 }, // ҝ
+    { 19, 18, 21, 1, 18, 86, 38442 }, // Ҟ
+    { 13, 18, 19, 1, 18, 59, 38528 }, // ҟ
+    { 19, 18, 21, 1, 18, 86, 38587 }, // Ҡ
+    { 13, 12, 15, -1, 12, 39, 38673 }, // ҡ
+    { 20, 21, 16, -2, 18, 105, 38712 }, // Ң
+    { 14, 14, 11, -3, 12, 49, 38817 }, // ң
+    { 28, 18, 21, 1, 18, 126, 38912 }, // Ҥ
+    { 19, 12, 15, -1, 12, 57, 39038 }, // ҥ
+    { 25, 20, 27, 2, 18, 125, 39095 }, // Ҧ
+    { 20, 22, 26, 3, 15, 110, 39220 }, // ҧ
+    { 21, 17, 14, -2, 16, 90, 39330 }, // Ҩ
+    { 17, 14, 21, 1, 13, 60, 39420 }, // ҩ
+    { 18, 22, 20, 2, 19, 99, 39480 }, // Ҫ
+    { 12, 16, 16, 2, 13, 48, 39579 }, // ҫ
+    { 18, 21, 16, 2, 18, 95, 39627 }, // Ҭ
+    { 13, 14, 11, -1, 12, 46, 39722 }, // ҭ
+    { 16, 18, 22, 6, 18, 72, 39768 }, // Ү
+    { 14, 17, 16, 4, 12, 60, 39840 }, // ү
+    { 18, 18, 22, 4, 18, 81, 39900 }, // Ұ
+    { 18, 17, 16, 0, 12, 77, 39981 }, // ұ
+    { 21, 21, 16, 1, 18, 111, 40058 }, // Ҳ
+    { 16, 15, 16, 0, 12, 60, 40169 }, // ҳ
+    { 17, 20, 13, 0, 15, 85, 40229 }, // Ҵ
+    { 13, 14, 18, 3, 11, 46, 40314 }, // ҵ
+    { 15, 21, 14, 2, 16, 79, 40360 }, // Ҷ
+    { 10, 15, 10, 0, 11, 38, 40439 }, // ҷ
+    { 14, 16, 14, 3, 16, 56, 40477 }, // Ҹ
+    { 9, 11, 9, 0, 11, 25, 40533 }, // ҹ
+    { 15, 19, 14, 0, 18, 72, 40558 }, // Һ
+    { 15, 18, 18, 1, 18, 68, 40630 }, // һ
+    { 24, 17, 29, 4, 16, 102, 40698 }, // Ҽ
+    { 17, 12, 15, 1, 12, 51, 40800 }, // ҽ
+    { 24, 20, 19, 5, 16, 120, 40960 }, // Ҿ
+    { 17, 15, 13, 2, 12, 64, 41080 }, // ҿ
+    { 10, 18, 11, 1, 18, 45, 41144 }, // Ӏ
+    { 30, 28, 31, 0, 28, 210, 41189 }, // Ӂ
+    { 30, 24, 31, 0, 24, 180, 41399 }, // ӂ
+    { 17, 22, 15, 1, 16, 94, 41579 }, // Ӄ
+    { 12, 16, 10, -2, 12, 48, 41673 }, // ӄ
+    { 18, 21, 13, -1, 16, 95, 41721 }, // Ӆ
+    { 12, 14, 9, -1, 11, 42, 41816 }, // ӆ
+    { 20, 24, 21, 1, 18, 120, 41858 }, // Ӈ
+    { 14, 16, 15, -1, 12, 56, 41978 }, // ӈ
+    { 20, 25, 21, 1, 18, 125, 42034 }, // Ӊ
+    { 14, 17, 15, 0, 12, 60, 42159 }, // ӊ
+    { 15, 21, 14, 3, 16, 79, 42219 }, // Ӌ
+    { 9, 14, 13, 2, 11, 32, 42298 }, // ӌ
+    { 23, 26, 24, 1, 18, 150, 42330 }, // Ӎ
+    { 16, 17, 17, 0, 12, 68, 42480 }, // ӎ
+    { 8, 16, 13, 4, 15, 32, 42548 }, // ӏ
+    { 21, 25, 23, 1, 25, 132, 42580 }, // Ӑ
+    { 18, 20, 18, 1, 20, 90, 42712 }, // ӑ
+    { 20, 24, 23, 1, 24, 120, 42802 }, // Ӓ
+    { 17, 20, 18, 1, 20, 85, 42922 }, // ӓ
+    { 29, 19, 28, 1, 18, 138, 43008 }, // Ӕ
+    { 23, 13, 26, 1, 13, 75, 43146 }, // ӕ
+    { 20, 26, 18, 1, 26, 130, 43221 }, // Ӗ
+    { 17, 22, 18, 2, 22, 94, 43351 }, // ӗ
+    { 18, 18, 22, 7, 17, 81, 43445 }, // Ә
+    { 14, 14, 18, 6, 13, 49, 43526 }, // ә
+    { 18, 24, 22, 7, 23, 108, 43575 }, // Ӛ
+    { 15, 17, 18, 5, 13, 64, 43683 }, // ӛ
+    { 30, 27, 29, 3, 27, 203, 43747 }, // Ӝ
+    { 30, 23, 31, 0, 23, 173, 43950 }, // ӝ
+    { 16, 26, 13, 1, 25, 104, 44123 }, // Ӟ
+    { 15, 16, 9, -2, 16, 60, 44227 }, // ӟ
+    { 14, 17, 14, 2, 16, 60, 44287 }, // Ӡ
+    { 13, 17, 14, 1, 12, 56, 44347 }, // ӡ
+    { 19, 24, 19, 1, 24, 114, 44403 }, // Ӣ
+    { 17, 20, 14, 0, 19, 85, 44517 }, // ӣ
+    { 19, 23, 20, 1, 23, 110, 44602 }, // Ӥ
+    { 16, 19, 14, 0, 18, 76, 44712 }, // ӥ
+    { 21, 25, 23, 2, 24, 132, 44788 }, // Ӧ
+    { 15, 21, 18, 2, 21, 79, 44920 }, // ӧ
+    { 18, 17, 23, 3, 17, 77, 45056 }, // Ө
+    { 14, 12, 18, 2, 12, 42, 45133 }, // ө
+    { 18, 23, 23, 3, 23, 104, 45175 }, // Ӫ
+    { 15, 18, 18, 2, 18, 68, 45279 }, // ӫ
+    { 31, 27, 20, 1, 25, 210, 45347 }, // Ӭ
+    { 13, 18, 13, 2, 17, 59, 45557 }, // ӭ
+    { 18, 27, 17, 0, 25, 122, 45616 }, // Ӯ
+    { 18, 28, 19, 1, 22, 126, 45738 }, // ӯ
+    { 18, 26, 17, 0, 24, 117, 45864 }, // Ӱ
+    { 17, 27, 19, 1, 21, 115, 45981 }, // ӱ
+    { 20, 26, 17, 0, 24, 130, 46096 }, // Ӳ
+    { 22, 27, 19, 1, 21, 149, 46226 }, // ӳ
+    { 14, 20, 14, 3, 20, 70, 46375 }, // Ӵ
+    { 11, 15, 9, 0, 15, 42, 46445 }, // ӵ
+    { 17, 19, 14, 0, 16, 81, 46487 }, // Ӷ
+    { 12, 13, 9, -2, 11, 39, 46568 }, // ӷ
+    { 23, 28, 24, 1, 27, 161, 46607 }, // Ӹ
+    { 18, 23, 18, -1, 22, 104, 46768 }, // ӹ
+    { 22, 21, 23, 1, 18, 116, 46872 }, // Ӽ
+    { 15, 14, 16, -1, 12, 53, 46988 }, // ӽ
+    { 0, 0, 14, 0, 0, 0, 47041 }, //  
+    { 0, 0, 24, 0, 0, 0, 47041 }, //  
+    { 0, 0, 14, 0, 0, 0, 47041 }, //  
+    { 0, 0, 24, 0, 0, 0, 47041 }, //  
+    { 0, 0, 10, 0, 0, 0, 47041 }, //  
+    { 0, 0, 9, 0, 0, 0, 47041 }, //  
+    { 0, 0, 7, 0, 0, 0, 47041 }, //  
+    { 0, 0, 15, 0, 0, 0, 47041 }, //  
+    { 0, 0, 5, 0, 0, 0, 47041 }, //  
+    { 0, 0, 8, 0, 0, 0, 47041 }, //  
+    { 0, 0, 6, 0, 0, 0, 47041 }, //  
+    { 0, 0, 3, 0, 0, 0, 47041 }, // ​
+    { 0, 0, 0, 0, 0, 0, 47041 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 47041 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 47041 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 47041 }, // ‏
+    { 12, 3, 11, 1, 8, 9, 47041 }, // ‐
+    { 12, 3, 11, 1, 8, 9, 47050 }, // ‑
+    { 18, 3, 11, -1, 8, 14, 47059 }, // ‒
+    { 16, 5, 17, 2, 9, 20, 47073 }, // –
+    { 23, 5, 24, 2, 9, 29, 47104 }, // —
+    { 23, 5, 24, 2, 9, 29, 47133 }, // ―
+    { 15, 19, 11, 1, 15, 72, 47162 }, // ‖
+    { 20, 8, 11, -5, -1, 40, 47234 }, // ‗
+    { 9, 8, 9, 4, 19, 18, 47274 }, // ‘
+    { 9, 8, 9, 4, 19, 18, 47292 }, // ’
+    { 9, 8, 7, -1, 4, 18, 47310 }, // ‚
+    { 9, 8, 9, 4, 19, 18, 47328 }, // ‛
+    { 16, 8, 16, 4, 19, 32, 47346 }, // “
+    { 16, 8, 16, 4, 19, 32, 47378 }, // ”
+    { 9, 8, 7, -1, 4, 18, 47410 }, // „
+    { 16, 8, 16, 4, 19, 32, 47428 }, // ‟
+    { 13, 30, 17, 5, 22, 98, 47460 }, // †
+    { 15, 29, 18, 4, 21, 109, 47558 }, // ‡
+    { 18, 16, 11, -2, 19, 72, 47667 }, // •
+    { 7, 8, 13, 4, 10, 14, 47739 }, // ‣
+    { 7, 5, 13, 3, 5, 9, 47753 }, // ․
+    { 7, 5, 13, 3, 5, 9, 47762 }, // ‥
+    { 20, 5, 20, 0, 5, 25, 47771 }, // …
+    { 4, 3, 11, 4, 8, 3, 47796 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 47799 }, //  
+    { 19, 19, 24, 3, 17, 91, 47799 }, // ‰
+    { 10, 8, 11, 6, 19, 20, 47890 }, // ′
+    { 16, 8, 16, 6, 19, 32, 47910 }, // ″
+    { 16, 7, 9, -2, 18, 28, 47942 }, // ‴
+    { 6, 7, 9, 5, 18, 11, 47970 }, // ‵
+    { 9, 7, 9, 4, 18, 16, 47981 }, // ‶
+    { 16, 7, 9, 0, 18, 28, 47997 }, // ‷
+    { 12, 5, 14, 4, 18, 15, 48025 }, // ‸
+    { 9, 12, 9, 2, 12, 27, 48040 }, // ‹
+    { 9, 12, 9, -2, 12, 27, 48067 }, // ›
+    { 28, 28, 28, 1, 22, 196, 48094 }, // ※
+    { 12, 27, 13, 2, 24, 81, 48290 }, // ‼
+    { 17, 33, 18, 3, 28, 141, 48371 }, // ‽
+    { 12, 3, 11, 4, 18, 9, 48512 }, // ‾
+    { 11, 4, 16, 4, 14, 11, 48521 }, // ‿
+    { 16, 15, 13, 1, 19, 60, 48532 }, // ⁂
+    { 20, 18, 27, 4, 16, 90, 48592 }, // ⁄
+    { 29, 27, 31, 5, 24, 196, 48682 }, // ⁇
+    { 24, 28, 25, 4, 24, 168, 48878 }, // ⁈
+    { 23, 27, 16, -2, 24, 156, 49152 }, // ⁉
+    { 23, 36, 19, -1, 25, 207, 49308 }, // ⁒
+    { 0, 0, 97, 0, 0, 0, 49515 }, //  
+    { 7, 9, 7, 8, 18, 16, 49515 }, // ⁰
+    { 7, 8, 7, 8, 18, 14, 49531 }, // ⁴
+    { 8, 9, 7, 7, 18, 18, 49545 }, // ⁵
+    { 8, 9, 7, 7, 18, 18, 49563 }, // ⁶
+    { 7, 9, 8, 9, 18, 16, 49581 }, // ⁷
+    { 8, 9, 8, 7, 18, 18, 49597 }, // ⁸
+    { 8, 10, 8, 7, 18, 20, 49615 }, // ⁹
+    { 15, 13, 18, 1, 13, 49, 49635 }, // ⁿ
+    { 8, 9, 7, -6, 5, 18, 49684 }, // ₀
+    { 7, 9, 7, -7, 5, 16, 49702 }, // ₁
+    { 8, 9, 8, -7, 5, 18, 49718 }, // ₂
+    { 8, 9, 7, -7, 5, 18, 49736 }, // ₃
+    { 7, 8, 8, -6, 5, 14, 49754 }, // ₄
+    { 8, 9, 7, -7, 5, 18, 49768 }, // ₅
+    { 8, 9, 8, -7, 5, 18, 49786 }, // ₆
+    { 7, 10, 8, -5, 6, 18, 49804 }, // ₇
+    { 9, 9, 8, -7, 5, 21, 49822 }, // ₈
+    { 9, 9, 8, -7, 5, 21, 49843 }, // ₉
+    { 15, 29, 10, 1, 22, 109, 49864 }, // ₍
+    { 14, 29, 9, -6, 22, 102, 49973 }, // ₎
+    { 20, 27, 20, 2, 23, 135, 50075 }, // ₡
+    { 18, 19, 20, 2, 19, 86, 50210 }, // ₢
+    { 17, 19, 14, 0, 18, 81, 50296 }, // ₤
+    { 24, 18, 21, -1, 18, 108, 50377 }, // ₦
+    { 20, 18, 19, 1, 18, 90, 50485 }, // ₧
+    { 25, 19, 27, -1, 18, 119, 50575 }, // ₨
+    { 20, 18, 18, -2, 18, 90, 50694 }, // ₩
+    { 20, 16, 22, 3, 16, 80, 50784 }, // ₪
+    { 19, 18, 11, -2, 17, 86, 50864 }, // ₫
+    { 17, 20, 17, 1, 17, 85, 50950 }, // €
+    { 17, 18, 21, 5, 18, 77, 51035 }, // ₮
+    { 23, 18, 13, 0, 18, 104, 51200 }, // ₱
+    { 19, 27, 24, 2, 23, 129, 51304 }, // ₲
+    { 24, 18, 22, 6, 17, 108, 51433 }, // ₴
+    { 12, 17, 12, 2, 15, 51, 51541 }, // ₵
+    { 20, 19, 21, 5, 19, 95, 51592 }, // ₸
+    { 14, 17, 14, 3, 16, 60, 51687 }, // ₹
+    { 14, 16, 14, 1, 14, 56, 51747 }, // ₺
+    { 16, 18, 17, 3, 17, 72, 51803 }, // ₼
+    { 21, 18, 19, -3, 18, 95, 51875 }, // ₽
+    { 15, 15, 15, -4, 11, 57, 51970 }, // ←
+    { 15, 15, 16, 2, 14, 57, 52027 }, // ↑
+    { 15, 15, 16, 4, 11, 57, 52084 }, // →
+    { 15, 15, 16, 6, 14, 57, 52141 }, // ↓
+    { 24, 12, 21, -1, 10, 72, 52198 }, // ↔
+    { 13, 23, 17, 3, 22, 75, 52270 }, // ↕
+    { 15, 10, 16, -2, 10, 38, 52345 }, // ↖
+    { 14, 10, 13, 2, 10, 35, 52383 }, // ↗
+    { 12, 14, 13, 4, 12, 42, 52418 }, // ↘
+    { 11, 14, 13, -2, 12, 39, 52460 }, // ↙
+    { 17, 14, 20, 1, 13, 60, 52499 }, // ⇐
+    { 18, 17, 22, 4, 16, 77, 52559 }, // ⇑
+    { 17, 14, 20, 3, 13, 60, 52636 }, // ⇒
+    { 18, 17, 22, 8, 15, 77, 52696 }, // ⇓
+    { 21, 14, 23, 1, 13, 74, 52773 }, // ⇔
+    { 15, 21, 19, 5, 12, 79, 52847 }, // ⇕
+    { 17, 19, 14, 1, 18, 81, 52926 }, // ∂
+    { 23, 20, 23, 0, 19, 115, 53007 }, // ∅
+    { 18, 17, 18, 0, 16, 77, 53122 }, // ∆
+    { 17, 16, 15, 2, 15, 68, 53248 }, // ∏
+    { 17, 17, 15, 6, 16, 73, 53316 }, // ∐
+    { 16, 16, 12, 0, 15, 64, 53389 }, // ∑
+    { 12, 4, 13, 1, 8, 12, 53453 }, // −
+    { 22, 19, 20, 2, 18, 105, 53465 }, // √
+    { 19, 12, 19, 2, 14, 57, 53570 }, // ∞
+    { 21, 23, 18, 0, 17, 121, 53627 }, // ∫
+    { 9, 14, 7, 0, 14, 32, 53748 }, // ∶
+    { 15, 13, 30, 11, 12, 49, 53780 }, // ≈
+    { 20, 19, 27, 4, 17, 95, 53829 }, // ≠
+    { 20, 18, 17, -3, 16, 90, 53924 }, // ≤
+    { 20, 18, 18, 0, 16, 90, 54014 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_10_bolditalicIntervals[] = {
@@ -4089,4 +2715,9 @@ static const EpdFontData opendyslexic_10_bolditalic = {
     28,
     -11,
     true,
+    opendyslexic_10_bolditalicBlockOffsets,
+    opendyslexic_10_bolditalicDirectGlyphs,
+    opendyslexic_10_bolditalicGlyphPages,
+    35,
+    opendyslexic_10_bolditalicPageGlyphs,
 };